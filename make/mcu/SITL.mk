@@ -2,10 +2,17 @@
 INCLUDE_DIRS    := $(INCLUDE_DIRS) \
                    $(ROOT)/lib/main/dyad
 
+ifneq ($(SIMULATOR_LIBRARY),yes)
 MCU_COMMON_SRC  := $(ROOT)/lib/main/dyad/dyad.c
+endif
 
 #Flags
+ifeq ($(SIMULATOR_LIBRARY),yes)
+# the library is loaded into the host process, export only the step API
+ARCH_FLAGS      = -fPIC -fvisibility=hidden
+else
 ARCH_FLAGS      =
+endif
 DEVICE_FLAGS    =
 LD_SCRIPT       = src/main/target/SITL/pg.ld
 STARTUP_SRC     =
@@ -38,6 +45,12 @@ MCU_EXCLUDES = \
             telemetry/srxl.c \
             io/displayport_oled.c
 
+ifeq ($(SIMULATOR_LIBRARY),yes)
+# the host drives the scheduler through the step API instead of main()
+MCU_EXCLUDES += \
+            main.c
+endif
+
 TARGET_MAP  = $(OBJECT_DIR)/$(FORKNAME)_$(TARGET).map
 
 LD_FLAGS    := \
@@ -53,6 +66,15 @@ LD_FLAGS    := \
               -Wl,--cref \
               -T$(LD_SCRIPT)
 
+ifeq ($(SIMULATOR_LIBRARY),yes)
+TARGET_LIB        = $(OBJECT_DIR)/lib$(FORKNAME)_$(TARGET).a
+TARGET_SHARED_LIB = $(OBJECT_DIR)/lib$(FORKNAME)_$(TARGET).so
+
+LD_FLAGS     += \
+              -shared \
+              -Wl,--no-undefined
+endif
+
 ifneq ($(filter SITL_STATIC,$(OPTIONS)),)
 LD_FLAGS     += \
               -static \
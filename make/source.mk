@@ -12,6 +12,7 @@ COMMON_SRC = \
             cli/settings.c \
             config/config.c \
             drivers/adc.c \
+            drivers/adc_oversample.c \
             drivers/dshot.c \
             drivers/dshot_dpwm.c \
             drivers/dshot_command.c \
@@ -76,6 +77,7 @@ COMMON_SRC = \
             fc/init.c \
             fc/controlrate_profile.c \
             drivers/camera_control.c \
+            drivers/accgyro/accgyro_fifo.c \
             drivers/accgyro/gyro_sync.c \
             drivers/pwm_esc_detect.c \
             drivers/pwm_output.c \
@@ -130,9 +132,11 @@ COMMON_SRC = \
             sensors/compass.c \
             sensors/gyro.c \
             sensors/gyro_init.c \
+            sensors/gyro_fusion.c \
             sensors/initialisation.c \
             blackbox/blackbox.c \
             blackbox/blackbox_encoding.c \
+            blackbox/blackbox_predictor.c \
             blackbox/blackbox_io.c \
             cms/cms.c \
             cms/cms_menu_blackbox.c \
@@ -169,6 +173,7 @@ COMMON_SRC = \
             io/rcdevice_cam.c \
             io/rcdevice.c \
             io/gps.c \
+            io/gps_nmea.c \
             io/ledstrip.c \
             io/pidaudio.c \
             osd/osd.c \
@@ -176,6 +181,7 @@ COMMON_SRC = \
             sensors/barometer.c \
             sensors/rangefinder.c \
             telemetry/telemetry.c \
+            telemetry/telemetry_scheduler.c \
             telemetry/crsf.c \
             telemetry/srxl.c \
             telemetry/frsky_hub.c \
@@ -217,10 +223,12 @@ SIZE_OPTIMISED_SRC  := ""
 
 ifneq ($(TARGET),$(filter $(TARGET),$(F1_TARGETS)))
 SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
+            common/crc.c \
             common/encoding.c \
             common/filter.c \
             common/maths.c \
             common/typeconversion.c \
+            common/vector.c \
             drivers/accgyro/accgyro_mpu.c \
             drivers/accgyro/accgyro_mpu3050.c \
             drivers/accgyro/accgyro_spi_bmi160.c \
@@ -271,6 +279,8 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             sensors/acceleration.c \
             sensors/boardalignment.c \
             sensors/gyro.c \
+            sensors/gyro_fusion.c \
+            drivers/accgyro/accgyro_fifo.c \
             $(CMSIS_SRC) \
             $(DEVICE_STDPERIPH_SRC) \
 
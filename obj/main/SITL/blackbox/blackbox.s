@@ -0,0 +1,4869 @@
+	.file	"blackbox.c"
+	.section	.gnu.lto_.profile.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\247\013\375("
+	.string	"\226\355\255FP\030S\007\223\3212\344\372\361\320P"
+	.string	"\250\215K\002\221)\313\314&\276\026\210K\b\211\002\333\025\254\245\261`\274\357\373\276\257\272\256&P\374vc5H)?/\006\013&Z\200\013)I\354\244\355%\333M\344\226Dv\221"
+	.string	"\222"
+	.string	"\240"
+	.ascii	"?\353\274N\316/\245\362\365K\226\375\231\221c\272\304\3119g?"
+	.ascii	"\353\030\020\237\036\345+qn\336\246\346\373\323<M\362{\221\374"
+	.ascii	"\005Fec\352\344\3142X\342\302d-qn\376\341\276\037\376\231\357"
+	.ascii	"\217|\376"
+	.string	"\307\257\237?\377\237:\257\273$\313\246X\367\2734\267\256\032\232\344\f\362X\323}\246\237\356\363\313\374\374\374\341\207_~\371wv\327\213\216+\033\371L\245p\215K\274;V\333\267}\343\363\370\343\337\277\377\341/>\374I\2367u\365\205\243\340:,K]\355\313\353\215p\364E\365|hX\344\f\302\003\244G\222\037\351\341\376G\307!^m\031\224\374F\337\337\250\027=R\306R\215\020\23161I\345\227\367\216\341GB\321\33130\211\321%\242'\372\347\303\373\237\177\340\237o\3409\364C?\307\203\334\353\025\272\013l\036\002\337\177\300\367\027\360\375\003\364\027\332A@\337{\337{\357\037\347s\237\217o~\003\370\336\303\363{\371;\337\233\377p\365\224.\234\237P\320k}\325\270\200\346\347\314\357\317|%\363\227\001\203\210&J45!\271|t\211RL\317\334W,[\034\211\370Y\347\303\312\b\021\277\365\344\354"
+	.ascii	"C\030\373\317\306B\262j\036\210\017\036:\004\311W\273\2527\016"
+	.ascii	"\375\273\363\233/}\351'e1C)[6hP\276\333\233\223\256\250\275g"
+	.ascii	"\336\203\nV\225\001\003\177n\234\307l\255f\027\242\037}\350C"
+	.ascii	"\243P\244T\375\267\265\225fa\t\271\333\346\020\263\025(\364\343"
+	.ascii	"_\330\235\340\004\350C\241\017\277\322\307\237\364\361+=\377"
+	.ascii	"\244\347\257\254\325\304\230"
+	.string	" \221\340\340\343\006\0173\370\346\002\005\tz\276\351D\360\315p\307j\373\266E\252\247\372\342E\2578UC\331\322r\213T\037 3/+\036\337\261\006\251h;b\031o;v\250\343y\241VYZ\216\257\253`U\2778x\326\021\255\325\r\0333\030\027VL\215\370Gu\315\215F\334\325^\265\314\350\177|A\2542bm\223\253l\f\372i^\304\312U\337>B\030\30604\274$/\344\272\303\267,.\342Y\b\227\331`\213\367\006^\001d\361}\357\211\326\335\n#\035\245\312\326\246\342\351\237\236\372^\241\340Y\212\032k\r$D\341\364NNt\331\034\331\332\211\351O\247\317\237VB\027\201N\250\3615)\221)II\n\225\306\321\004N2\307\030\236\007\022\240\304\021\212u\204\214d\024$%)\250S\217\016o@\324\204\321od\357\274\020\3556h2\212\343ce\345\254\270\234\371\350\313\323\256\364\325\242\311\265"
+	.ascii	"\362\336\344\263\370I\333\375O\251\231\212\343#\301\254\373\361"
+	.ascii	"\203\313?\266\363\232\034\326\314\251\263\3201\264q\2118\332"
+	.ascii	"T\t\320\211\211\2037\272X\300\007\362\357\335\342F\354\212u\016"
+	.ascii	"\264lb\210gP\375\344\276\370}D\242\347\323\322sT\347]\322M\250"
+	.ascii	"6\374\n\207S\333#\254\337^?\277p\321(+,\212\340^b\b\005\205Q"
+	.ascii	"\204\336\0358\253\007\361\302\354\367\251\331\206^\344=bc|M\277"
+	.ascii	"Fr\274\236\371\213E=M\355\236U\216*\341\241D\360Ji\372\020f\035"
+	.ascii	"\323\332\276\373\024[u\305\024\321PE~4\361A\240\275=\273\333"
+	.ascii	"8\022\357\255\351\312Pz {\320/\225u\016\261K\262\213T\020\356"
+	.ascii	"\355\247\371&Oxzc\221\004\031\260>8L}\360p^\255\202\206\003\321"
+	.ascii	"\214\303f\326\003\324[\212\302\036\257\252\204\241\226\322\263"
+	.ascii	"\322\376\257\377\233\004v?\305\033\333V>Y\207\3130{\360[in\362"
+	.ascii	"w\222\304\032\377\365\266\030\300A\215Bi|Y\353\220\360JT\371"
+	.ascii	"\275\007\257M\007\342\261\"'\373K\2044\251\347N\374s<\324C\365"
+	.ascii	"\032\343\330\033F\264#\303\270=#~\316\332\2764\350!!H=\274\240"
+	.ascii	"LIH\254}\253\017\221R\200\025\341\020\257M\213\236\373^\307\007"
+	.ascii	"Zj\365q\241Pc\316\227\221\230_=R\272\034\351U\301\262\347\262"
+	.ascii	"\202\036#\304i\315$\026\321\243\343\215\354\374\376\362\217\031"
+	.ascii	"\034Nj\217\270\315\261c\017\325FZ[`\306\200\021\232\023\275\322"
+	.ascii	"\341\357\367|\307\232[\263D\262N\235\r5?0O|\202\346\317\327`"
+	.ascii	"\316d\255C\337\026\260jB\251\354,\341\304\336<\206\232\375\307"
+	.ascii	"\331\370)\253\031\323\367\005>\035\271\200}\3728`N\333\263W|"
+	.ascii	"\377N\f\201\f\303\323\221\224\267P\030\323\350\333:\322\271\207"
+	.ascii	"r\262\252\276.\230\271\376\307\371\365p\217\242\tJw\315\337\275"
+	.ascii	"\314\255\261P\003 \235m\313j\005\005\245\025\251rs\b\253\307"
+	.ascii	"\n\351\356?\246\357D\361\371K\006#\020F\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\026\003M\t"
+	.string	"2\311\033\037\020g\2451\347\340\356\031zQ\314M\236Q\326\310\337\""
+	.string	"*\240\325:\353\322#\353\211\334)\005n\301\021\234\003\247\300\031\240\003\030\0243\370LD{\271\2665\353\\\251N\211:\231J\230J\322\221(\004\372\343\331\216'g\2636\302\247\311\354c.Z\266\242Rt\242J\024r\341\240\265/{\354\267\346h0\364\\\354+6\241\237\235F\304\016\001_\250\260\024\215\222\016\240\002\242\"\342\006\022\340\204!\006\205TU%E6\n\373\261gjl\210k\020\254K\017\332W%\214\376Gd\022\210\346\302\332\241\322/\312\210de\224n\275Fn"
+	.string	"UWT=\332Q$f\363\375\244\247\204&[\272\r\302\332!\335i\033P\217"
+	.string	"\ndi)\037w\033\316/\216Y:/}\365J\323v\325\316\356\260\272"
+	.ascii	"q\0072\322 \025\004\220\254\\F\032\264\2275B/\307\004\351C\204"
+	.ascii	"\222_\200J\243\264\245\360q\212\314\377\323\216\320\023\220\030"
+	.ascii	"\235\211\205\302\354\360\314y:/\326\207\fKP\311\346\304\2435"
+	.ascii	"\033DR\344\234s0p\220\324T1"
+	.text
+	.section	.gnu.lto_.inline.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\037\027\3559"
+	.string	"\226?\332GpZN:\223\202\b\0312\333\305\240\363\214g\021\004\254M\372c\364\265\246\322E\350\0279\325\336XK\025\356\003\275f\334\215\315\275}k\373\323\036\b\354\227\366I\311nR?\t{.2\320\264\322}\337&C\032\331r\247\270"
+	.string	"\304"
+	.string	"\322"
+	.string	"\304\377Cl\335\226\330!\226Rb\2078\304\177\237\036\036\001;\001\210C"
+	.ascii	"\253N\016\020'im\325\230t\210\247\276\303\005\246$c\271\356\363"
+	.ascii	"\003/\222\2350\363\250\020\257X\035\232\253\365\002\376&\306"
+	.ascii	"bG$\211\203\247+&$-\007\203\017\377\243\245=\362\002\2358Iw\353"
+	.ascii	"\\\370\253?\316s\320\037\207\177T\275z\274k\361k\361F\313}F\373"
+	.ascii	"h\037\257\366\325N\342\257}\344mv\367O\247\177\243\277\377Bl"
+	.ascii	"\377\353\004s~7*\210\377\350\324\377k\253\360R!N\376w\333\304"
+	.ascii	"[\335\rt\033>/qw+\323\237\211\321\350\236Z@\374[&\326\243{j\361"
+	.ascii	"\374A\347\031\006\327\207\303g$;\257z\204\255N\034\006E\033\327"
+	.ascii	"\332\304*\230\314(\350\325\027uy7\324\247m\233\377\220\305qx"
+	.ascii	"dn\026K-bk}l\323\tl\357o\337l\021S\301\331\036\2462J{8\351\253"
+	.ascii	"\002\223\026q\322\376n\243\256Z\230\037l\177\376\347GK~\227\235"
+	.ascii	"q\205% bkm\030\330\224\257\0017`\201\027\352\266\330b\305$J1"
+	.ascii	"\2132\263\273\025U\213F\364\305\356\244&\360\250"
+	.string	"zT\375zd=\030O\274\204/\276h\274\321\366m\231s\305R\210\204\026\373\270\336\3307\332\356[\356>'\361\033\331[\247W\273\223.\333\226W\003\277v\037\331+mL3x\264\273\317\304D\037\356\363\371$\222\376U\177H^\314\3355x\272[rkq\005\336\341\266\361\245tw\200s\b.\273\373\367\r\327MH\032\016b\323U\033\263+2\274\206\337r\0269'\0313\243x\331\304J\214=\342 \203\322\205a6d\356\253Usf\317L\020W`K\201\255\275q(\250<\177\216\301r\017\261<\037B(~\002\005\310\214\340/\334\337\377\304W\335\035\344\326\335\t\212\026\242\030\313\212\026\024\313\224b\025wG\270\274\313\213\376\273\343\242[\311\243\022\toZw\023\201B\307\241\321\3357m\335\275^\302\377\247\273V\244\313\206\235\022\305ZmO-\226\354\021\354\355\331>\305\036\033[\035\206\2554g\317_Q"
+	.ascii	"!\265\371}\351\327\004\301r\266\232/\217\377\353t\321\340\361"
+	.ascii	"\330K\277\216 \227\342\363\023\\\272\373\200\031\023%\226\356"
+	.ascii	"I4G\\xc\305N\247\216\035\267\345\346\256\300\030\355T?Z*\367"
+	.ascii	"\344\326\342~O^5c\274\221\311\255\027\241z\371\252\302\264\371"
+	.ascii	"\224\022\013\007\2320\352\221\f\342KW\275T\224R\253\006V\323"
+	.ascii	"\370u\326\266\345\301\241\354\337\245g\246\267\243>\331=\271"
+	.ascii	"58!\217.dd\fQ'\373\3339+_\260\330\rU&\313m\\\325\242m\364\350"
+	.ascii	"\031E\262J\334\254\236"
+	.string	"\325\244\333\353y-\236\213\347\"\022\033\317\306\263Eu\376\033\261}\022Xu\2029ZR#N^\315jv\337\310\221\314gtc`\3261<&h\353\227|Wj\035p^bk\326\262\253L\360G{\006\210o\343\371T\263\340\036\2348\201\316\250\3411\032!)I\222B\2419\341\004\2041\346\230\203\346\001\022\340\0229\005\342$\306\020!\f\315\210\004\022\211\210$%\005I\n\222\016EK\354\206\200\006\3518\310\344\352\266\031(B!\025\224R\352\275\272,%\334#\357Qik\r|\305\262\274$\310#B\236\314\257p~\214\363\231O\350l2\026U\321\374+\244\227}^\003h\325\276\242\272\030M\235\212a\330zN\243\300]\b;\003=\276\023\336\032\344\204\026\320u1\006\311\\z\321\017\227\027\020\315'1\352l\210\001\r\302\302\023k\322\312\372\221r)N\217L\220eQ\361\233\201R\231*G\004n<\322"
+	.string	"\322eF\221\nV\212\312Q3\007\232\262Vk4$\303\326\213\271G\214\265ai\206\307\306\3141\312\357^\016\004v1 N\216\013\272,\037\333\374B\346\355\225a\t\312\002\030\007d\337us1\353\315\274\230\347\302\361\273B\tH\2311\250]\032\262&\205v"
+	.string	"\233\204%A\210\016z\035Wu+\274l\275Z\303\031\272G\240\031\315\270\224\004\331\306\250\347{\t\2120'\325\331fR\337\025\205\021\216\233\307\021\343I\020~2;\227\356\371'@\177E\251\033\333\371\375\231\0204\240\335\234\276wy\303\354$O\345q\236\025}\301\002:\3016\2020\275\343 E\327\251r"
+	.string	"\321R\016\007\367\2620,\335\007\246\307!Q\250\032'\307\241Gy\317\2630/\343\017`\271 \360\327\220\311\253\335\236m\341\254Wf|\331\275w\354}\374Y\005J\214a\336\205\341|O\307\340N<RB\331\371\361XW\313P\342\226F\336\365Z\217\006\f\b\\\351w]@\202Q\242\371\223\312qF\002\023\255?\312\006\305\376\177\2304\"45\200p~_\300\0344\250F\242\013\001&\266\267H\222\335\213\020\275\n\342\021\270\037$|\232&\0363=\213mp\340i\225\214\203B\023\302\360J\321x\335\246\177\371Q\003\320\245\244\222\302\266\240\352_\352\007\374\376\337\017`|\t\375\312\377x\021u\322%\315\321\004\220\371@\320\207D\030\362\206!\275\346\nM\003O\375Q\200\263]\324km|\227\236]@\241\2222\314O\275+\336=\005\333\212\252"
+	.string	"\\,\215(r\345\036X\026\034\360;$\241\205"
+	.string	"\247\220\330\224\375\355w\246\253\003\b\361\307\245\260.\241\266\035\243%\007\226\027\020\251\236\r\323\211\212|\265\026\006\022\302\276\007\211\023\340"
+	.ascii	"\200\004\334\2348\311\217f\3358\203\236\307+@+\260\267\307\020"
+	.ascii	"\252\374=>\211\026:\357\316~\344\256\223\227M\255\303F7\2435"
+	.ascii	"\3440\025\241\254\360N\200\254s\006\251eH\200\305f\036\302\331"
+	.ascii	"\035aL\300\202Y\360\007\310\t\261tr\211\307O\230x\221\333d`\231"
+	.ascii	"\n\233\267e\020L\334\207\330\331}\256\360\336\304Z\262Z4\274"
+	.ascii	"\250{\b\\X\235\262\300j\002(\365\300\271\275l\200\252w\330\331"
+	.ascii	"U=\200-;\270u P\311\3272\204\243\247C\225\257\307\341\350\324"
+	.ascii	"<\227\320\r\213M\210\210\262\375\026\243Pj\277\313}'\035O\223"
+	.ascii	"\365r\005\032\365\260\354\360\1776\247\225\365d\335\377z\235"
+	.ascii	"\356\035\rq\037\262\363\333\201\254r\344\377\300b\024O\271\364"
+	.ascii	"\367\253\375G\257F\331\355\312+v\252\365#\323\355\265k\321\337"
+	.ascii	"\272_\313\2749>pe\177\353\376z&\377\230\336\313\366\017\3519"
+	.ascii	"\212n\021\035\322\375\321\267:\276\373\351\f\314NTN\2300T\024"
+	.ascii	";}&3r\226\257\033\265\237\f\370\306\332Pd\340\206e4\303\177R"
+	.ascii	"%\017\210\355\363\363y\372\021\321\203hr\203\253\325\323\242"
+	.ascii	"\315\250\3032\317\353\205o5l\253\232\200\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\2135\205d"
+	.ascii	"\212vT\031<P\3566\007.\314C3\261\253\322\213\205\255\277\344"
+	.string	"\347\021_'\177r\217]$>Z\357\252\355\312@\326L\326\226\245g\275\017p\rn\337HM\235{\377\377\277\275\2315\261\265[J\231\002\217\001\213\001\177\001\232\254\255\321\305\032\231\032\230Z\225R\2235'50\"\246u*\365\246-\242\345\221\223\346\013-J\251I\232\022\032\221R\327L\351\342\336\204f\277\333R\244D\245\256\355?\245\256\251\331\357\306Sj\022\3579\033\315\316\262\227\314J\315*\031\232\32593\2732\013#M\255\331/\271\211\224D\372!\337\220]H%\243d\227JM\"j\263_\331\234R\223252+\245\256\311\302FR\343%I\343\2407\373\035\363\264\031\271\214S\306$\242t%\235(\316~\265\235RoMFO)5\251\303J\275\347\354W\023\311\234J\275\237\230)-\242\263\337<fg\2779\316\235\375\346-\271\t\250Gy\366\213\355\354\331/.\203\251\214\355\027\277B?\373=k"
+	.ascii	"\332/\013,h\277 \252\212EB\373\325\322EC\373=\240#\"\332\257"
+	.ascii	"\255\324\244\226\226\242\375\312p\021\317\301X\016\316\370\207"
+	.ascii	"\214\366\213K=b-\234s\255V \005\212\023\231H,\342\031\203\027"
+	.ascii	"\323\302\031\177\221\230G\023\231X \023\2530\316\013\020(\310"
+	.ascii	"\355=\216x\350(g<tD\346\\\302\300\203"
+	.string	"\007x\b\351\007\214\215\341b\325\224@\226\326XZ3E\020v@j\\U,b;\030\327\301\016\310\307\016\310\214u\261\370\"\353\277O\037\374\212\310L\304\243\330\177\376\307z++\374\220\310\374\217!\340L\304x8\211\314\370\201y\024{<\212\341o\2215\371$2Qc<\373\177\tOz\372\237\240$2\035hH\344\310\320H\2201\234G&\3633D2.\031&!q\230\027\2420z\f\347\025d\376\031\033\234_\357\321|\206L\306'C'\244\025~M$\226\351\035Y\230\265\036\2033.K\273a\377\211\304q\374\220\361\212\214k\030g\037\377\300\f\205\314\305\342\003\377W\365\377\367\377i\016\207\3531\2242\346\177\221\307\2141\217ql\263f\263&\023$@\377\377}\037#c<\254D\346\021\207\303COd\346e*L\245\306{\366|\310\277\242[!3\006\303`\343\377\237\377\277\305?+\013\353\3019\003"
+	.string	"\240\343?\307\377\337\370\267\36144\032\234\363\036w&\356q6\303z\364\374\377\371\203q\241B9Ch\324H\343\341%2\2233\2368\326\364\026\254\265\340\024*2\321\003\306X\313"
+	.ascii	"\3028th\f\302!\277\306\370E\004\f\341\305\211\274w\327\2325\371"
+	.ascii	"\377&\020!\302\203\203d\022\377_!\204\037?y\254*\236*\026\301"
+	.ascii	"\300\262\346R,bb\326\0210q\f\002&\344\023\227\257O]0\021\350"
+	.ascii	"a\230\207\231*Q\251I*@Tp\250\260P!\331Tj\222\313~o\212n\202\274"
+	.ascii	"\354\367\226\006\314~oR:d1\354\007\347|\013+K\225\232\374\204"
+	.ascii	"\311\021\237R\337lo\376\263-\215\315J\2517\005-d(\346q\231\037"
+	.ascii	"\222\031\232\3118\f\313\264m\312\022\233\020\"\250Z\246I\207"
+	.ascii	"JM\022\302`\377\271\b\030\330\220\0069\327\002\211\225\001\274"
+	.ascii	"\254\007\266f\357\201\002[\223\307\253\352\342?\223\307\303z"
+	.ascii	"\267]\327-\223\307\243\341\276\366T\317\305\275L\027\375\241"
+	.ascii	"\251\371\013\266'\n\274\242\375\251\362\255\223\367\323\344\342"
+	.ascii	"^T\217e\245z\235&\200,\013m\313\201\\kz\365?|\270?uZ\247\216"
+	.ascii	"|\036ou\203;\323\267sW\025\353\177\370L\0360\265\355v\234je\371"
+	.ascii	"\026\356;\313\271N\226\373\314\036\377Q\375\217\345\246\333\262"
+	.ascii	"(\317TW3\025\360W\237ra\233vU\345\276\235\251\256\250\313\323"
+	.ascii	"\025\310vWE\315\035k\340{\352\272+\353s\315\356r!\352\356\270"
+	.ascii	"\311\242\334\300\263\375D\205]l\312Q\266\267X\177\366\235\352"
+	.ascii	"\325\252A\263\267\301\253O\327\335\352\256,0\353\315\037\027"
+	.ascii	"\320dWw\375U}\017\246\\h\366\364DMw\365\265\347\325\367s\375"
+	.ascii	"\231\275\340V?m\337\362\316\243}\007z\271f\333]\316\332\276G"
+	.ascii	"\313\177\346\331\323-\336\242\247\331\362\002|\3733;\033t\201"
+	.ascii	"|g\256\254W\317\3527\264\272\334N\227;\323\216\222\310\231\250"
+	.ascii	"z\035\247\016\207\354O\235f\361\365\037\344\037H\212LL\361\343"
+	.ascii	"\377\265\0364\b\0177\2219,\353\361\023<\212\200\323\244\033i"
+	.ascii	"}\201\372\332T\241\202\242\257N\240\276<\031\311Z\203\301\031"
+	.ascii	"\247\305p\3169\037\372\n\365U\352k\0249\244\017\035\004\205\""
+	.ascii	"\334\276N\351A_\3051\303\377k\r\217\f\205\214\032p\337[\323\034"
+	.ascii	"o\315\235\352\b\233\313r\267\315\365V\025Y\317\353\354\306\372"
+	.ascii	"\026\355\342\001\236]\335\035\347\231\253\033\344\005\376\324"
+	.ascii	"\345\264N\335\354\333\216\200\355Bnv\261fOE}\356\272\376Zs\307"
+	.ascii	"\022PyOCP\220pA\002\0062\345q\267\203\260=hu\016r\270\026\025"
+	.ascii	"v\026\353\273\313\317\334\217EI\340\276\325\345Z\035\371\352"
+	.ascii	"\217]y*\232;Y\276\202\300\372\366\307\325\234\313\343l\210\023"
+	.ascii	"\266\234\013\333\2639\027[E\177\267.\376\273}\227\256\213\202"
+	.ascii	"\314\366n\020\350\006[\334\276D\205\331\007u\372{\312w\255i{"
+	.ascii	"\255\240\216\366\275\307\335t\025\246i\337\271|Kh\365\354\332"
+	.ascii	"\252=\206\253v\226\r\356p\337\177\250\013\\\327\224\366[\325"
+	.ascii	"~\232m\333w'\n\304\372\023\375m\326\347\322\236\366\256\212\256"
+	.ascii	"\300\036\274\263[&\007\272U\337\356X\332\257\300\256n\356\330"
+	.ascii	"\375-\371\355-]\331\355\333\271(\220\306\305\275fi\027\366\224"
+	.ascii	"\366\"N\270\350\361\337\354I\333\367\235\312\205'7U\364g\236"
+	.ascii	"\270\2533\200\005\266\273)\312\253\372\037\276\2523\353\201\301"
+	.ascii	"SE\271\250\376v\325\305\323\316\232?\266\273h\226\f\025]\341"
+	.ascii	"~8\323\325\327v\326\347\016\360rQ!g{&\352\252\034\353U\224\367"
+	.ascii	"\314te]u\335\231\355\026\277:{Y\217\266*g\335\001\264w}=\264"
+	.ascii	"s\231'\313\271\330\225w\366\036\202\340\250\302\002\241r\322"
+	.ascii	"\314\210\210H\222$\351\022\n\020\206\205q\032\327\032\365\022"
+	.ascii	"@\362h\212\3428\f\243\020!\204\030C\f\"\n\tDDDDFDd\332\001\372"
+	.ascii	"\031 \304s\326\201\b\211b\231+\t\262\300\256\002\222K\356\270"
+	.ascii	"H\201\034\240Y\311\013\315\353\316Lk\212\310r\363\350\311\345"
+	.ascii	"9h\261QD\351\217\244\354 \tR\325\207(\354\352J=\301\335St\344"
+	.ascii	"\272\021\373\003\3719\"\254\210\353nY\bK\006\004n\247\307M\262"
+	.ascii	"\020\242\025\037\330\203\005!\273\202\276\355,\340\250<O\356"
+	.ascii	"\216\204\026\200\022\002\020\356^\300\032\247\0316\326@\267\026"
+	.ascii	"\331\300\004\213\377\370\212I\013%^T \342Oip>n\b\246\200;\246"
+	.ascii	"D\t\276\\\024SR\2160\017\013\237\300\032\270T\277f\237\274(\214"
+	.ascii	"\356CN\316\341b\203\034}0.\3708j\243\336h\372\202k\332\342\021"
+	.ascii	"\244\352\025\005]\032\323`\214\035\263\023&x\231\200\275\337"
+	.ascii	"7~\302J\020m\001\274\302/,K\372;\235\204Nbz\360\362a<#\360\024"
+	.ascii	"\275bb'3\035\342s\241\210\240\360\200\266\315\211\230\22088@"
+	.ascii	"\022S)T\034\274\203\315\t\253\217\255saG\267\235S\314\314\367"
+	.ascii	"\005\353\026\342\241\255P\027>\220iqJi\363L\220\177<@z\234\242"
+	.ascii	"c{\224\252\376\002\005q35\371[:\005"
+	.string	"\342z\277y\310qr\246\262\3659\016`\036\262r\376?\375\002\200*\037\275\242x\267\225\304\254\213\363\2635\265\006\242s\242\350\370j\177g\315\262-0\002\310\235\251\322)\203\340\001K\320\367\320@\320>\230\033^\n\206\237\217H5\005\301\332\233oo\230\203\036\301\214[J\223 \363\2262\031\360\267\2417x\007D\200d/\345\333\331\361\225\352G\n<1\031K\304p:\260!\317\227\357\3473\365\204j\035\246\270>\327\023R\355L\326\306c\017.\222\207\217\024\267\345m/\207)}R\234&\347\207\006QA\bp\273\030\256^O\276,\036\356\324\002a\001\334s\352\313\3678\\\2610\274\361J\247fZ\222\017-|"
+	.string	"8<\227^\326q\371k\252;\203\223\350N\022G\001H*\027\342\023\\\003`\272\035\006\205\213\250\0205\035%\300B\257\323@\264\264\330\0368\013C\020\250\230\207\344\022\027\027 [\317\024\247\315\350\024\270\021\031\323-\250V\267<\315\221\315h\232+\371\217\237\213\361$v\312\345~\177\263s\340\020\337\033\b-\260\034"
+	.string	"\346\246\236\214%\312\210\366b[\345b>&\260\205\023'\021\256\213:\030\016\227\250o\2578\356\366v\272\363\362>d\277\312\342N\304Q\204\363H\026\336D\306\350\230\340+\"m\314\331\005{\013ML\335\277\371\361\262\001\270\202\365\362\311\310_\346\034{\341;A<\331\206'J(?\026|}Qr\177B\022\325^\220\207jT\213\276h[\233~\033\264\007?\375\202/\341\331\022\333\370)*]E\ni\377\b\203\020G\023\363D\352~%\354e\312O\241\026\371\213\230\266\274:@\233\317\031e\215\264\2340B&O\004\345\033\315k\023Fj6\366\021\034\343\270zxO\027wj\372\306\374\257\242\fU_\020\220\306\307#\217\241\310\342;\337k\033\200\027\030\243\352\363\345~"
+	.ascii	"WS8\270\"\324N6\013f3Zu\202\326B?\r\261:\031\222\230\311Mp\372"
+	.ascii	"\020\006\256\215.=\321dOil\f?\310\031\3221*\246\004(\220\013"
+	.ascii	"\004\314_\2100\237\262\2228\205M\200.\211V\322\231\343\227]\255"
+	.ascii	"\330\341o/\023\007t\031\177y\357m9s\2224\330\314"
+	.string	"\330\353\2135L\3516\241$@(\303\346\t\206M\273\227\246\302\241\210\301P\001y\222\276\323\325\350j*\006\330\216\200\206w\f\231PA0\317\252\307\267l!\224\317\231~\271F\272\372\231\352\203\315!\032\324y{\240u\2753\005\030\375\377uv+\232\324\347\314\233?N\316\206\245\227\360{\2705b\003\370\346\316\345O\215\321HM&\354\271\341Fu\260\357\026\240ML\n\351\345\337G\016\037=\034\255RC\033\372g\327\333J\212\207\216(\006\2205ZB\365\034\351+{\322\303\273H\330\363\330\347\221\013\263\372\346\tz!\222\t\315'\235Ga\251\321\3413\322\343~\201Nz\274\345\t\242\315k\367\221\376!;\2028\271#4A^a\307*\271HG\026%\354!$fzc\036\006\"\374E\251\251\027.\016\0317\265:A\322\362\372\240\363\333\357A\266\377\247\026\306EU4\337\326Z\177j\201PM^:\211N"
+	.ascii	"\365cq\037k\360\224\322\330\023\350\330z"
+	.string	"{F\222~\204\211rY\"\033b){\307,\370\240\255\346\3661\n\263\320@\023N\376\t\003zp\375X+\021\300\315\216\021\n\211\341&\365@\312\236\357\273|\231'G\360\265\317B\217I \222\203\005\027\\\261\304\r\304 \007\256<!Sw\020mU\257&\253\021\"\205C\305*\r^\200\001\227\270:\035\350\275\344\017ro\345A\031a\312\306\261\321\016\3071Y\315J\337\002\013\2566&X\t-\215\327\033\243Y\035\200;N\363~f\257\3359\243\034\203@m\212_\216\216\354e\201\223\207\200b\377\037\022\242J\350A\247\342\240`\002\r\276<\021\301\246\037\204\003\301R\221\237\374T\233|\247\206}\323\344\232\242\305\321\375\266\210l0\034e\272\020*j\271\277\025P8\236q\025w\342\274A\354\350q\030\320%_o\023\253x\267t\250}\301$-\300H\272\320 \016\2341\266L\244\bD\021\213\251\370\226a\026"
+	.string	"\021\304\262CO\271@\t\037\271\301\370\366\255\244\252>L\301Y"
+	.ascii	"\313\215S\367#\303\026\261\005\322\347\370\225\365n\036\301b"
+	.ascii	"PL\034\331\253:\323\\\366\370\021\t\225l\253\335\005s\031\022"
+	.ascii	"[4-$\312\305&\235\002\006\225\247\234\025r\271+\315\016y\337"
+	.ascii	"\226\347n\013\344\347\f\245\001\002>\341$\210\321\264\327\271"
+	.ascii	" \264\347\340\032"
+	.text
+	.section	.gnu.lto_.pureconst.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375 \217\225\003"
+	.string	"\362\210\033 P7\244\003!3C\265K\272\351\003\177\373\377\177\366w\300\277\020Nc\267EZn\020\301T@\221\267\365\261\276\325\247\372R\027uO\327tK\227\364\215\256\350\206.\350\374\\\317\355\214\234\273\271\232\23391\347\345Zn\345R\306\311(\271EN\310\3718\035\267q2\306\305\250\030\021\277\016\327p+\214\204;\030\0057p\001\037K0\306\\\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`e\005-\024"
+	.string	"\246\025H<\020S\224\341"
+	.string	"P\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P)"
+	.string	"\300\336\335\335\312\242\242=\215\343\b~\035\204\202\252\232\250\252Q\036`\331^\364\331\220\t$q\201\261'i\330B\t\004\201\373\204\304\022)S/"
+	.string	"9"
+	.string	"<"
+	.string	"e\366\277\200E\2422"
+	.string	"U\204:ERtj\345Z+"
+	.ascii	"\317GB\336sb\312\213\036P'\267\2553S\236A\321\211)\347\211V\033"
+	.ascii	"\230\362V\203\330\344\300\034\233d\223\246fY"
+	.string	"-\036d\360-\225*\231!k\301\332\310E\213J\301_\340\004\257\304\217\367\3363A]\026+zERkuUwuW\307\371\213\300\367Q; \027j\241\302\245\374RPI\341\267m\302K8\202\004\002e\365\230\342<>\035\375`\331\314\341\301Q\352\247P\363\374\206\215R\215\215\306\f\0311\n\243/@\034\320\007\346M\345\345\271\271\003[6\226M\247r\235m:\225j\313\203\016\202\352\317\223\304\365\256\327\021\377HD\b\020\317\017\357\201\035H\024\007j\303\032n\006M\271\003\244Q\030\306&s\223sY\347\351T6\200\266\250\200\024\221$I\322\030P\0021\250\312\312\003\021\260\225\"\220\025)HRPH\007`@eF\223\320\b)9\211\035>\266\027\256nk\261\316\t\027=)\342\243\023\240\272\035Pw!\"$*\254+\357Y\021V\026\0130\370z\371\003\354U}h\204\206\017ErX\3109i\306\017"
+	.string	"'\207\021\317//\360\007\n\350#\376\f\302\250\016\3376J\n\274\2018\227\212\314pB2\200aPHe5u\034\373\030m\031\213\306\001\213\247t\212\247Zu\336i\\\347\031\033\245\36464m\325\""
+	.string	"=RH\277\347P\n\025\330\245\216g\317(\2711\360\035\3561)\211\355\272\227\n\244\033M7\261\032~\300\232\361\272\036\002`\254x\320\254x\321\203\321\177\017\310\207\215W\346\035\031\376\342\340\224\257\035\242\224\221\242)\240<\312\007\221\204G\360x3\231m\221\216\016=\327\001t\247z]\031^np\221\232\007r\035\215\004%b\323\314<~\213}\023\205T,`\253"
+	.ascii	"\275B\203\203(\025\222\023\201\262+\362\344;*\343\212\276<\271"
+	.ascii	"=E\3377V\347\245}bL\253a\005\354HWL<\031\252\373cuQ\220\251\326"
+	.ascii	"\3355\206o\366\317T|)\221\361~l\217L\243\270\366\330\314L\272"
+	.ascii	"\322\323\211(\326(\244t\024\200\002"
+	.text
+	.section	.gnu.lto_.lto.f60325d2ebc28b97,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.99.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375 \244\215\004"
+	.string	"\344\007k"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\303\336\341\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\205\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\006"
+	.string	"\310*\b\204#\236\262\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.101.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375 D\355\001"
+	.string	"\004\0037"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\001\320\017\005\001\006(\035\001\003\002?\202\210\2000\177}\277\001{\276\001y\275\001w\273\001u\274\001s\273\001"
+	.string	"\004"
+	.string	")2`\036O\261z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_blackboxHeader.102.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.103.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\300\250\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\270\377Qy\276\004\330\376\001}\301\003\230\376\001y\304\002\005\001'C\206\bw\375\001u\307'K\206\bs\230\375\001q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.104.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\004\r=("
+	.string	"F\275\341?@\246j\016\307\r\013\340\311E\305\307\340?\325\313nkq\326\306\237-a\347\246\206"
+	.string	"~:j\233\275)lka\331\030\372\200>\242\333\240\337\326\031g\234}\253\300\236\277l\3433\261\266M\231H\320"
+	.string	"\330"
+	.string	"\312"
+	.ascii	"/\f\264\315\246\n\376\376\310\317\007[p/\347\221\237/\276@8\230"
+	.ascii	"\277\017\306\240\b\311hQ\376>\026h\233\013P\344!D\307\376K\224"
+	.ascii	"\337/.\2252\354\361\035\333\257/\177\242v\rjz\307\026\024(\377"
+	.ascii	"\037\354\033\372\37096\336\237\374\177\361\037qX\253;\266\335"
+	.ascii	"\236\374\200G\035\350\360\304\371\001c\017op\307\216\273\223"
+	.ascii	"?\020\036\"9\225\251\255\261\035\273N[\376\3008\005\332&\222"
+	.ascii	"\371O"
+	.string	"cW\235Lnu\231\331\261\321\316\362\017\302\304\363\035\201\266i\236\037\032\301\233\253\036+6\222m\344V'\215\235\264\321p\216\035'\207\216&\353\372\362\032A\266#)-\215\360\213`W\327\333`mr\235\257\243mruS\003`\320\017\206m\226we\271\324\024\361\022\240\253N\352y^~\264&#\300O\037\365\331`&\273=\352\263\305\003\362\340Q\277\r&\020\207L\316\311\251\337\326Y\n\274\331\211z7\330@\033[\324\273\305\007\350\244E}\034\354s\256\272\254\330H7+\213\3728\026\347\333bh\233\b\022$\325\266z\214\fN\213\227{q\276\035\206\266\031@\201\267y\343F\352\347\340\030\347\313\205\266\271\324\244&\315\324\323\305\013\314\224\231\372:\230\001\0301a\246\276N\306\371\036\3216\223\032\364\241.\\\250\336.\013m\323\201_\271j:\317\202e\306\343\3054\316\267\006\332&\323\003*S\250>\017\206"
+	.ascii	"E\214\352\363\342\bL\340&T\257\007\247\347K\205\266\251@B\022"
+	.ascii	"$\352\353\305\023\302\212\250\277\007S\360 .\004L\375\275x=\003"
+	.ascii	"D\334\210\037q%\276\304\235\370\023\217\342R\274\212[q-\276\305"
+	.ascii	"\275\370\027\037\343d\374\214\243\3615\316\306\307\034\351q\\"
+	.ascii	"\216\2379\232\253\371\232\327q7\207\363;N\347\261\353\361:\347"
+	.ascii	"\343w\376\307\361<\220\013\362=\347\363Bn\310\377\034\320\031"
+	.ascii	"y#/\024\361^\337\343\337\007\362`/\344\213|\330#\371$\317\344"
+	.ascii	"\233\374\223\020\037\005\004\212aZ\222\016\312\213\251\360@\250"
+	.ascii	"\363m\270\344\336;yx\206\0136\333\022%\331\007\341?b$\373`|\224"
+	.ascii	"$2$;\241\331\007\371\312^\b\017\377\207\217\354\2051\322\333"
+	.ascii	"\363\370\256\374epR\220p0\177\031\201\300E\212\362\233\301\005"
+	.ascii	"\222\016%B\224\337,^\243\344\327\227\377\f\016@hP\376\263e\026"
+	.ascii	"Kt\323vu\241\264X\026K@\271\026\211\256Y\272\200:\221\302H\304"
+	.ascii	"\221\016K\253\254\264XdM\250mR\351f\021Y-w5\002p\323\252\033"
+	.ascii	"J\245k\\\335t\305\232\323v\325*\246L9-\"\225.\026\t\266MK\234"
+	.ascii	"%\321hl\315\322\304\t\022l\233#\237e\r\227e\213R\252\232&\225"
+	.ascii	"\331F\325j5,[\326e\213\303\222\275\321\256\306a\251:\341`\253"
+	.ascii	"\256\324\024\253\352)\213\230\026\237\324\326\370\344\024\241"
+	.ascii	"d\265\326\366\311e\331\366I\251t\325\025k\225jYW%Z\255\255\326"
+	.ascii	"\200\262\345\364\234Nk:\355\326vZ\256\347:O\353i>}\327\200:\257"
+	.ascii	"\0075\241.\324\206\032\260\003\273Q\013v\241wy\017\367\341@\374"
+	.ascii	"\313\207x\200\377\250\241lE\314R\230\362)d\031\003 #\021\031"
+	.ascii	"\233\016\021@4\207\fA\b\223\252\251 \307\315\247\254\023\251"
+	.ascii	"?\227\276zK\265\363x\203\351\370\227d\375\203@\026\311\3518\211"
+	.ascii	"\300\313\b\\\271S\001\217\013\320\323\201\373\270\224\216\231"
+	.ascii	"\020\260\347\341\255N_\026+\240/\264\022\301\201\004\272\342"
+	.ascii	"\b0\274>^%l\rh\225\032b\230\016\005\211\177u\321j7>CZ\003\333"
+	.ascii	"\035\203@\325\373k@\2152\340\211\342#\003\036G\201|\f\240\371"
+	.ascii	"V\255D\364\003\250\257\275\333/o\342\220\372Q\236\357\325/\262"
+	.ascii	"\005$\330v}\357\346|A\372A\324\337\356Y\320F\3711\005^8\276d"
+	.ascii	"\200&\260\200_ \300\025P\236\215\306\210\020\243\316\344w\255"
+	.ascii	"\234#/\016\347\374C\031\356=\330\213\354\250\374g\244v\026\305"
+	.ascii	"\376\217\361PO\n\271#\340y\206Y\362\237h\344\303.\304JL\034\367"
+	.ascii	"\036|R/\316\351q\365\n\327\376\217\373\007\351{\361\221zp^\277"
+	.ascii	"\253G\224\366\377\240q/!\020\233\353\336H\374\256\342\274i\177"
+	.ascii	"\334%\005\027C\363@\022\241\205\376\177\\\234\202\355]t\t\211"
+	.ascii	"\bq\375\211:\333-^\375\003#\204\320(\236'B\025\343\026\240\321"
+	.ascii	".\304\253\367`\222\003\272|\331\302\262\0259[A\250-\334\f\365"
+	.ascii	"\035<\206\260n\242V52\221[\210\250w\206O\033\327\210\f\370\013"
+	.ascii	"\325\270\266\351Zv_\210>"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.105.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`<\001\025\013"
+	.string	"\204\021\272\001"
+	.string	""
+	.string	"v"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\255\222\351\311\n}\276?\202\210\2000{y\277\001w\275\001u\273\001s\273\001q\274\001o\273\025\001\006\005\001'A\206\bm\230\316\004k\302\303\005\005\001'L\206\bi\330\315\004g\306\307\004\007\001\005\001'Z\315\004k\314\315\001w\313\001u\274\001s\312\001q\273\003"
+	.string	"\330\314\004k\321\322\001w\320\002\005\001'e\206\be\230\314\004c\325\326\035\001\026\n\005\001'q\206\ba\330\307\004_\332\333\331\3308]3\334\0014\327\001\324\001\323\001\317\001\316\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\022GPS_ground_course"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\nspeed"
+	.string	"\raltitudecoord"
+	.string	"\013numSat"
+	.string	"\005time"
+	.ascii	"! \360\"\022\233\007 \030\376pC\030!\002A\2242qO\264\363\030"
+	.ascii	"\343\363u\221VpK\"\335F\207\3148Oh\250\247dlBP\376\033\222\303"
+	.ascii	"4\306\261\333\255\374\267\3212\376g\270yf\277m\255S\326\305\320"
+	.ascii	"\203)\002"
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.106.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\330\312\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\230\325\004}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.107.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\361\313\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\330\336\004m\302\303\003\005\001'W\206\bk\230\336\004i\306\307\002\001\005\001'f\206\bg\230\335\004e\313\314\312r\206\bc\330\334\004a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222]\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureFields.108.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\375\b"
+	.string	"\244\r\237\001"
+	.string	""
+	.string	"E"
+	.string	"\005\001\006\035\001\006\001\005\001\006\030\001\002\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\360\315\n}\276\001"
+	.string	"\005\001?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\025\030\330\356\004}\303\304\001w\302\005"
+	.string	"\230\356\004}\310\311\001w\307\004\005\001'7\355\004}\314\315\003\230\355\004}\320\321\002\330\354\004}\324\325\035\006\030\001\177\005\001'@\206\bo\230\354\004m\331\332\001w\330\001u\327\2748k3\333\0014\326\001\323\001\322\001\317\001\316\001\313\001\312\001\306\001\305\001\301\001\300\001"
+	.string	"\bgyroADC"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.cRaw"
+	.string	"\005time"
+	.string	"\034"
+	.string	"X\r4Xu\254\326\th&a\243&Z\367\245\255,c\220"
+	.string	"\206V\225\331\307x\001\f\255*\263\222\361\002\fi\203\241A'\300P \031\020\004\350d+C\275\342"
+	.string	";\"4+\254\326N\021p"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.138.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375 \375\275\006"
+	.string	"\222L.4Pm\222\016$\207\250J\3316\267\324\335\310h\021N)\3122v\336\237}\373\267\205\206:*\270Y@\214\346\231\231E\024\321\207\013\2661\363g\265\266\265Md\nW\231\bk\223Pi\0246\217\001A\263\360\252\313\341e0[\r\007\327{\260\254\353]\266\354\210\001\037\004\335r*E\304\2066@\355\250\007\347f\f\321q\325J\335N\245T\021`\342\343J\277y\034Z|\247\304\212\337\215\316\335\t\243Q\202\205d\212J(IB\201\220~\354/\023\024`g\3350D%\211\204>N2\267\207\027\315\352\262[\216N&)#\332\310Sg1\310\314\2356\222\350\330_\340\037\370)\002\n"
+	.ascii	"`\251'3 \f3\205\273\021\312\022\327\304\307\210\274\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.141.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\037\027\365Y"
+	.ascii	"\252\225\314 P0\220\312I\007l\261\355\212j\275\251\253I\267\252"
+	.ascii	"K\005\345\336\225\251^\\\217\236\205*\261\331t\034\317\220\252"
+	.ascii	"?\212GO\302\212R\261\205Y\302\001\224\032\b\302\200 \204{\244"
+	.ascii	"lpo\251,z\252z\323Lu\376\3761M\325"
+	.string	"\377U\265~\211\225R\246\020\002\271\001\370\001\374 \016?\007\310\3079\037x\376\r\312\257\225\217\336\360\177(\277+\237Q\3762\260rzL3&|-\304[\332\243oMZ\207\352\300\344\377\322\265\260\204\013#\007&\313\332\227\233'\313-{]\210<,\271t\331!\314\236\226m\262\0343W\235\313\2745,\0344f%\217\311\026g\2664\342J\215%\233=8\346\262o-MS*[\005\204}\373F!\243\262\007\302\267\206\265A\204};\017\021\271&L6\021\376\340\242<\177\t\177\360?\363\277l\333V\302:G\370\365\244<\212|\345\220\246o(.\005\\4i\203\352\242\277\005\252\213\376\277\325U\tO\356[Z\217\233\036{^U\366\322\364m\252a\330\344b\255\270R\221\302\252\212jJ\n\305\321\030\005U|rjbZR:\221d\002\351\310\250D\021\021qH(h\b\364\343\323\303\263\243#\f\346\340"
+	.ascii	"o*\372kN~\267\026+\270\346\004l\305s\257\314<Y\205\231<NA\306"
+	.ascii	"\t\nVe\266\n\257\fS\341\221\341\2516R?,\2120?\3601\214\017lL"
+	.ascii	"\"\212\323\232{h\240n\334\205\221a\343+z\331\2479/\3544\227\205"
+	.ascii	"\233\316,\323p\257\t\006\315\322\t5\2618V\212\333\023jb8p\322"
+	.ascii	"\225\033\330\004\230^\323\013\222s\217\234l\324\306\306%dh\342"
+	.ascii	"P\024e\211\2420\021\312\032\017\3454iJ\021Z\262AKx\250$\t\003"
+	.ascii	"U1i\376$\3619\322\223\266<i\274s\306d\235!M34\302\r\253k\222"
+	.ascii	"\241\t.W\331\346$\251\211\2251N\013\300_\024\323\207\025\326"
+	.ascii	"Nl\371\013\022S$o\325\304\310\370\346&\313\307j\312\tzl|.\370"
+	.ascii	"8\263\025\310\302\242\3011%\377v\306L\370%\245i\272n\313)\214"
+	.ascii	"\361\340\246\003\323\303\027$G\204\230a\221s\223\302$\006\257"
+	.ascii	"\234\261\2563\265\341\302\314\326\005\261!~\370&+M\323\363\327"
+	.ascii	"\230\217=\213\375\177\035\374\307\372\201t\004)\217\025g2n\341"
+	.ascii	"\201o\222E\017A\004\274_\021\324E\225z\351\226\333\334d`\266"
+	.ascii	"9\271\270o\307lM\357\327hOj\356\035$S\350x0\022\337\346^\257"
+	.ascii	"6\\\334w\036\376sT\300\373\265\3157\330\t\251\353\352\255\357"
+	.ascii	"\230\335\276\272=\275-fc\264\206\246\256\201\234Y\370\223\250"
+	.ascii	"J\021\3738\377 rr\002\3678\213\021\3314\001;\253\360'\221\315"
+	.ascii	"r\210Q8\177\t\355\261\255\261\362\354\365'\261\3132\210\273\316"
+	.ascii	"<\376$r\3612\354\343\224\267|\200\230k\276l\376\\*yL\263\036"
+	.ascii	"\276/\022<&tX\035\333\232\021\337#\376$\232\321Q\363%\342O\242"
+	.ascii	"\020^\204z_4\301\033\314|\2379\273C\322&\224&e\276C\374I\224"
+	.ascii	"[\342\004\261B,\231?\201\013\004\326H\373\364\330\326\322!w_"
+	.ascii	" \376l\221\267#\324EW\314\377\347\312\001\3014K\323\255e>\371"
+	.ascii	"+\205Z4\251\351\210\350\301Lc\3406\377[\327\376\322F\373\367"
+	.ascii	"\227\246i\3726\362\347\360qT\376\215\312\267Q\3715*\237\306\371"
+	.ascii	"\013T\276V\345+P\3713*?\201\312\227Q\371\bT~\214\312?\240\362"
+	.ascii	"aT\276\001\225\377\242\362\0138\337E\345gU~\213\363\t\250\374"
+	.ascii	"\001\316\027\240\362\0038\037\200\312gq>\326\371W\347\247\250"
+	.ascii	"|\253\363\253*\237\352\374\251\312\227:\377X\371\306\363\243"
+	.ascii	"*\037\352\374\342\371O\225\357t>\323\371K\225\257\264\316\335"
+	.ascii	"$!\037I\310?\022\362\215\204\374\022B~\221\220O$\344\023\205"
+	.ascii	"\374!!_H\310\017\022\362\207\347\003\241\374\037\224\357s~O\220"
+	.ascii	"\317\023\344\357\344\360u\316\027\326[\254\007t\214\271#\231"
+	.ascii	"\313\226\003z\347\214\224T\234\026\246\211\201\265$\225\314q"
+	.ascii	"\016I&\311f\322\t\357W\322I]\024\007\025[\346Aq\246\331g\225"
+	.ascii	" 2.\023\217K$\366U\021\021\f\306\002\246\226\264\305j@\303\320"
+	.ascii	"r$\313\305\031\320\253\205\330h<e\201\315O~\300\346\267; g\266"
+	.ascii	"x7V7\024d\\\036\036wh\250\261\204\202^"
+	.string	"\264\034\330\0221j\356\360z\266X\013\350\027;\034\311V\252\024\320\273\303\260\3364\25351p\033\250\177\222\206$\024\336\257\233\3467\273#\352x\344\005\021\343\323\003\312j\027\277-\326\026\235\305\345Hvs\266\350\345\262\313\304sr\231\260\317\372i\264\001\232\200&\216\361\322\201\267X\003\350\001\272\034\311R\242\004\320\333\205\271|x\214\313;\307\025\022\352c\017\017\013$H\326\330,\276\034\311k4\030{\277\3544\332\223m\265\226IJa\031\222mKG\346\277\007\354$\351\366D&MS\026.X\355\0050M\323\025\213\236\233\037\300hJK\262A]\264\366\322\3419\373\372\372\316l\261&5\332\225\213\222yV\302K6\370&y\f\0312zWXn\341[r\265Y+?\352\370\364t\202\035\265\034\343\325\206\253\201\n\325\301>{\261\320\265\305j\325P`\216\344#iV\275`\222\020\346\030\227q\216\033\024\324"
+	.string	""
+	.ascii	"\203\303\031h\350\312i#,d\251\274\200\275@D\315\035\233\255T"
+	.string	"S\2059\222_@\223\352\r\323=\312\"\242\340\020\265\363\307\256M\021`\243\255V\355\336\261\233\362\317`\"Zg<\204\206\r\0348\352\242\375[\263\224\343sr\341\355\263n\032\355\214\032\227\177\307\035v\n\377\260\005\250\265\321\276\033\204\204K\032\332F\3767P\235z\335v\t\007\260\"5\250\271\303\003\246[\254J\355\324u\214\327\262\213\373\276tGr\231\003\3004\031\354\320\341\201\016\n2\330\221\003\3479\244B\3301\201\0059$\270`\202\251\ftH\200\301T\016\016:\230\2222\361\035\032T\300\301\224\007;vp0\025|\343\3326r,e3\313\212\245F\241l2\255\230\332Iy\366\224z\352\241\362\314\031\265@7)\317\302\240\212\315I\232f\274\346\212SMB\023\017n\216\211\247,\317)\313\234KU\275Y\224eaH)\332\311\n\331\222\242\253vR\006q\nau\005b\304\217\213\036*\201d\361!"
+	.ascii	"\b\263\347\330C\345\217,\302\250\336<\345\017f\020\200\336Ik"
+	.ascii	"\206y\315U\001b\234Y\0037\307\273\311\nt\240\346\356\372\332"
+	.ascii	"\355\263\272\257\257\317\006\254+\343\262\212\343\"!\365\322"
+	.ascii	"\212\2536RVq<\301\356\266\324\334u\212\243\327\206e\247\333\020"
+	.ascii	"f\233\n\255\372\323\035\245\007\263\321Z\363Cf\005\212s\205}"
+	.ascii	"V\212*\3432\325q\217\216\232\311\252\352F\017`vD~6\372F\225#"
+	.ascii	"\231o\317Fo\025\252\031\326\247\271\f\027\301F$\333\306\222?"
+	.ascii	"~\324E}\372\0032*|\313\261-\0061\205\302\270|<\256\221Q?I\241"
+	.ascii	"\250\341V\003\215\256\001w$\247AC\243\027\356\330\303=\315ow"
+	.ascii	"l8\354,\007\243V/\260\n\264\326\225#9o\b\005z\257\244\260\317"
+	.ascii	"\212\342\351\235.\366zm\351\"\303xI A\222dduQ\236\306Y\352\364"
+	.ascii	"\316\030\016\"Y\226\024\222<;\253\213\352\254\201\262<a\213w"
+	.ascii	"tuPO\306e\247\343\226(\321S\305\247\031q`R\210\250\271\333bM"
+	.ascii	"\240g\304\035"
+	.ascii	"\311"
+	.string	"vb\022\350\215s\0226/\231\342?Y$\211\306\373%\004S\327\265'\344\215O\257\251\321\352\226\351\204qY\351\270EE]\265\324h2\232\230`O\304\360\260\b\264\f,G\362\017a\020\350\305\202\323t\363\2414T\347#\310\2116\302\3024IGjN\017\221\200\201\277$\217x\3111\303W\204\211#\343\262\321q\211\210:\005\322Q\f3\260'[\001\201\310\250AP\003\031C2\"\"\201\210$\005I\322\001\021\006\204 \304X\225\007\021\300(\205(\203fd$I\262s\340\360\361ey\224\225\376\b\231\272\373\273\352*\2330\206\323_\204!\262\027\205k\324\365\030+\001\034Mn\276vC\354\026\310\311\026!\364]D\245\352\264X\177\220|\027n\234\336\027\3004\243\314d\357\030qf\324\3615G\322.\025G\366\022\331\321\350\tb\032\017RW\242;a;\031Q9\223\n\332\233\260\035;\331\363\250\320\272|"
+	.string	"L\032\310\274:g\035nY\263X\240\\Q\261\311\275\244o(\230\2464fJ\330\271\251,\245'>\240\034v\227\230\006#t\222\243mc\346X\347`\234\023\n\333_\257\303y\371[\270j1oU\356l\231-\216/zb\326\350\305\257r{(\341\216\350T\314\030\325]\034\260\366\210fG\343\337qB#r\233w,\267\204\347\202q\253\033\221z\342\371\220\3279#\223\317bcv\351\"vI\342\027q\232\362\363ZaFO\020\263f=\276\272&E\235\021?\253\016\"\203=\264q\335]\330\027"
+	.string	"6\032\315Y\247u\022\257H\320)\233\363\f\250\242A\314Q+l$\234\002\347\204\n)!u\033\201_\037R\207\241F('\371\004yF\236\n"
+	.string	"\221\026\236\013\260`\332\201\340\271\261\f\215\005\211s\312\222e\004\206u\\\272!\022\201\212c\251\005|\206\020\265x\232\300\302\323\007\027\305\013|c\366\216@v4t\002\021\361\341l\245\263\303\261\034=\333\nu\324F\355"
+	.string	"\234l!\344\001\f6\377z\274\034q\260\023\305)\303\002\256\303\271\332+\b\003\244%\327\307N\nI\021;\032\301#\030\303\001\347\264O\231\363\203O\236h\274K\233v\362/\025\352\261d@:Q\336\211\260\f\206\037\241\201z\266bIP7\352\264\f\361\372@\225\237\217\021L&\216o\0257\355&\321\020\234\2567\177\266\005\177\203\211\305\241\345c\213i(\256\374[\234\324\230\257\274\375bi2\244:;\242;\2317\033&e"
+	.string	"\266\024\206\276\233\210\324\006 \224<\200\261\017\251R\021\025\370y,$\270\245\255\3336\322\216\227d\273\353\237\n\364\365loL\261q\245\004\272\305.h'\326\345\326"
+	.string	"Z\355\030\253\214\314#\262\235\b\356Q@"
+	.string	"\237\265\321{b\341I\210\024\367\001g "
+	.string	"\036\300\301\bX\342\t(\274\364\033X"
+	.ascii	"\230 F\232$\030\017\330\366\211\354\274\035\360\235\005\017\240"
+	.ascii	"-\261\004\250\030\334\334\\\027$N<\272\033\330\031n*F\213N\t"
+	.ascii	"Q\350\027\002~7\214\3440^\004\2039c\n*AN\004*\263\375\263\255"
+	.ascii	"F\230\3302N\350J\214\0260\267\177\367\252\204g$6\036h\367x\327"
+	.ascii	"s\271\314z\234Y\317\245=\353\350\356\331u\037P\f\233\373\243"
+	.ascii	"\177\bQ\020\242 D p\203\303tkP\350g\332\213\037"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.142.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\255\001\365\017"
+	.string	"&\235gE"
+	.string	"\321$\035\323\313\320\271\217\265\300\245F\036\235\017\034#\322\004\325+\f!\225l_\252D\2118@\261@h\210\330\200\330\214\024K?\031\273\343\377\377\377;\002\315\341*p\375L\340\tW\265\226\032\333\336[\312\224\002S"
+	.string	"O"
+	.string	"V"
+	.string	":6+\026;v\367\322\017\216\231\372(\302\247\231\362w\376nXD\332\226}\364\222\3453d\332V\257\001\215\022\033\316=c6UF\020\0234\2073\177\246\355\345\211\354.isI=wx\303\362\3216\232\347\350\301\356:\265M\346\376\270m\030\333\013\354\333\b?\335Zq\354\322y\356\370\322\360\245\337K\253\2463\3237\005\300\361b{M\267\253\241+Z \b\203\304yn\037\205\317\231\364\024W\221:\017\313Wf\257\201\320\311\031\332\345\022\034z\344\343P\344\003\342\341\273\200xx\222S\266P\201\227\315\030\004-\236\"\310\351\220\252\372U\217\250\n\236J\340\2065\003\246H\225\335\211f8\356]\210WT\317\r\227\344a\220\214j\233`z\356!5\202b"
+	.ascii	"\271h\246B\"\262L\265\205\022\375\025\357A\361G8E%\257\035\372"
+	.ascii	"*\361p\245\346\347\204\216\226\354l.Km\331\017\t\020N\260\323"
+	.ascii	"\363id\005+\231p\"\241Pr\235H 1\271N\250\224k\344\200\261\n\021"
+	.ascii	"P\227\005\fC]$n\2578\366\316\237!H\006P\213\252F\332\262\003"
+	.ascii	"\r\226\024@\210t\214\001\017\177\273\273Q[g\211QK\212A\305\362"
+	.ascii	"\201\261Qe\227\020\252\213k9\236\252B\375\212C' @\002\243\220"
+	.ascii	"\252\033`\352\305\003\177O/\332\"&\325\257\217\271\264\0020\327"
+	.ascii	"\342\330\303\026K\260\240\344\022n\034\262\030\212\235\302\004"
+	.ascii	"\203-,!\020k\317\214>\253\232\r,k\305\213\235\202Z_\254\240\215"
+	.ascii	"\254\244\036\032\332B*\353\364\323Dw\f\205*R|\313\246eu\330\264"
+	.ascii	"o\022\314\023"
+	.text
+	.section	.gnu.lto_blackboxSetState.144.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\256\005%\035"
+	.string	"\206\257\252G\220\332M:\202\202\253"
+	.string	"Pae\326\216B!"
+	.string	"\fY\274h\3026Y\025+BO-k\220N\357\215A\2436\003\ne\243\233z\3153/\213f\252\005\004h$\002\033GQa\251;\357\263\253:c\233\264M\310\336)\005\222"
+	.string	"\216"
+	.string	"\232"
+	.string	"\323sN_\001\212!L5\200\277q\266\313T\224\263C\362\013\210\216\355O\373Y\327\342\375\310\221m\273R^\274v\205\022\274S\236tp\004\365\344x\003\365\244y\266\230\202\244\355Q\260\322Zb\202\266\2739\332\343\274\337le\255\222#\235<\377\201\017-?`\357\267\n2li\345XMM=\023\204\234\260%\310X\273\260\365\222\214\025\2246RNP\247\301\247%\245$\0307\240\257\226\273{\251&\250r\326.\354\256\347\017\350t\353\3346\025\333\026l\022GX\3027#\2352\252~\227\203\031\371?\314\242h\376w\322/\252'\357\024,sU\2064\213~\222W\254&46\275\231f\341\356R-\376\026\001\305+>\226"
+	.string	"o\252\252\370_"
+	.string	"\326H\371\224S\261\335\320T9\371\223C\031\313\357X+.U\\~\023\0325T\342/\231?\252'\243\272\262\256v\355#\261-V\356\366\236\343I\224\312+\353jw,\204\223\225\342\210ML968\347\330\302\336\244S\366\307\245<\354\037\371\3538=\316iJ\003q2h\350\351\251\0338\314\377\374.\242\331P\211\366|+\307\021\335\224\223\236u\020\372\221\231\005y\020\232\364B\202gXO^\307\021\301jn\310\314\242\034G\2642\254;\267?\234\215\261\214\211\275)8\206F\346jti\306\256\272\216#Z\rI:E\355\020G\243K`\021?3\342$\221\246\375\310\bL\233\204\017\035\273\210:\206>\332\263\257\253\366\317\307\350\020P\355\256\005?\314\305\230\360\177\234\364\t \240z\362E\220\030\341\376\227\203\t\332\t\t\325\223.\202f\320\230|r\005:\"\037\"\017F:\025\245\177vZ\354J"
+	.string	"\375\370\244(\221Sq\302'(\3673\304\"\267\323\300\273\025\272\241\034\321n7\224\323\021\356\307\245<\\\206\021\031\"Q\237G\352w\2314\214\212\024\315\264\037\331\225W:\322\002c|4Y\372\362\315\242+\365\374\315\031GX<#\363?\236\221z\022\004\024\327\233(\341qa6nt\306\230KS\211\322\261+\f8\364e9\216X\264\365\356\343m\361\264x\026\314y*\343mU\2778\227\267\205\201\207'\r\255\214\301\034p\203\325\b\277\360rz\016P\355\"\301y\200\203\250aD\254\224*!QPP\220\024$\007\320\002\021)\353\034\021 \271dlH\032C\271~\006\340\342GL\002\0236\305\032`\314\3503D/\231\372e\022'T\341%}\316*\022KR\203\005Z\021\250\335"
+	.string	"\353\261\2331\f\247\2071\022\004\265\264\351\f\030h\267\004\245\032\233\034*\r\262\372m\340"
+	.ascii	"^\337R\357\220K\005^\352\261\003\251O\005 \271\266\035E\017\343"
+	.ascii	"&\002\227\355\2367g\240\\2\245\004WU4\236\363\254\310g\302\317"
+	.ascii	"\t\210\0301|$,'\365!b\255J\nf\217\364\320\355\004\003\f\017L"
+	.ascii	"\244\206UH\007\256\344+5\016\336/Q\365\335\202J\377\031:\364"
+	.ascii	"\255\225\213\355\310\232\306)\001\255t\302)%<\227\235\372\335"
+	.ascii	"\203\356z:(\344e\323\210P\017\201\030\272\"\374\237\300oYd\355"
+	.ascii	"\300\0132qt\332\226K\211\227#)4\013E,\n\254[U"
+	.text
+	.section	.gnu.lto_writeIntraframe.145.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\333\027\315^"
+	.string	"\372\231\304!N0\220\322\351l\271-\256\302\021\331\227\367\253\30220\237\024C\2367\3207O\004\240\201\272\322(\001\201q\261\351\023\371|\203[\375\251\007\034\200\034\303\274\256\275\321s\035\207\343v\037\\G\216\207q]\263\212\0072\"\021E\2147\221\335RJ)\021\002\331\001\031\002\327\307\341\231\253\207\332)\351\301\3560\335\200\335_\272\273t\277\265en\346\026\344&d\343 \337\021.\271\367\256H\305\204\331\"\336\271\004\232\f.\271\367\211\"\365\343\016dc\223\031\376\374X"
+	.ascii	"3B'}_h \275\236\267i\303\3476\327fh\"\335\363\302)\312\362\f"
+	.ascii	"\365\270\363\232\313\332]\370\256o\330"
+	.string	"\355\035D\230<)\274\367\026\2206\212$\266\217\325\202E\206\276,xE\204wE6d\271R\224&\213\225)Y\352z\313\027\347\031\035\226*[\250p\221;~\031\273\367J\351)6\372\311G\2771\033\314\035\245W`62\216~\3627\273,q\266\335{\215\2152\343`66\312\323pl\354\266v[\373\215k\347\356\335n\0022q\026\336\373\004\321(K\245\215\362\263\201l\243i\373\330FW\346\301\241\0347Y\305\344\354k\212\341\275w\352M`fbS\261\210\344o\342\263\271H\\\373\311\251\211\tjI)\t\211t\324\301\350XD4$\024\004\364\343\323\303\263\243\223\203sc\264\251I\213\026%\276\257\334p\255t&\027\367\327B3\331Ou\355D\274\361C\241\254\367~\274@\244\"s\301\257\t]\360\246\242\211\022\302\350\232\251\273\350\032\212\210\254#\"\357\275Y|\251J+U\351k\301\223\210)\025b"
+	.ascii	"p\216,!l\256\221\212&\002{\311\r\20666\022\302\346\372\250"
+	.string	"\257\223\366~Ty\363\016nm\344\326\346G(]\004\345\211\023\261\365\020\233\023\027R\322AJ\2228\020\222\376A\242\346>G\272\347\210\021\347)\322;E\210\270N\220\316\t\342t\034 }\003\344\314\215fmc\226\264\366\243\314k\222H\b#\353\224\270\263\367c\214(\302\313\2136'\210\320V\254\321\234\346\322\330\314\341\304\326k\342ZY\236\362\257\205\246\b\375\304\017\205Vn\350\275\037dD \037I\230\r\327\016\326T\272\027M\334{\331\231\315\260f\017\315\374N\314L\0013\320\211\357t_ix\250\036\375\326\353\024L\334\221.K\247\262\211D\035'\370\027\361\220)\346\344!\372\237ye\2626\241\032!\207{i\300d^\331\\\271BI\033M\357\275\377E|F\3120\305\370y\357\375O\343-\333\342\307z\034\021B\206\017\214\227\343\300\304{\033\312\276\370\026\337_cJ?<\\\335^|ki\017Q\350"
+	.string	"\235nc\276\302\365\231-\267\342\316A\025s\200\024\0215.\333\250\177\321\235\foG\336\317\254\300\002\310.\323\206[\334j|\002\005\n\333h\177\321\035\331\030\2213\225\346;\313\314\200\003\336L\206\002cE\317\353\223QM\206\213"
+	.string	"\300{o"
+	.ascii	"\3344\364\030\025\334j\215\362\003\020x3!\260\215\236\370\242"
+	.ascii	"\220\030\f\235nv]~\310\374T\372\2471wG1\f\262\344\037\302\314"
+	.ascii	"\003\214\271C\307\3272\207\227\262+y\255\363j\235U\353\314e\235"
+	.ascii	";\260\3168\254\363\r\353l\303:\327\260"
+	.string	"\3164\2543\007\326yk\006\226u\226q\343\034\243\001\233/\350/\3150\254\363\013\353\334\"ufa\235'\260\316+\254s\004\326YE\n\353\334@\2775\237\350\301f\253\022\r\330\\\325]\232\251\332\231\204\217\363\b\037g\021=\316S=\316R=\316!z\234\243:L3\210v\376\220:{\340q\206\332q~J\235\235R\347&\2433S\352\274\224:+\031\235\223Rg\244\321\031I\307\371\310:w\310q6\312q>\3468\027\031\235\211l\234\207p\234\205p\234\203\2543\320\215\363O\352\354\203\343\334\223:\363X\347\235\033g\235\033\347\234\033g\034\033\347\033\353l4:\333\3308\327\024\235\323\324\271X\343lSg\264\350L,:\277uv\353\334\335\303H.\216O\n\023 \377\367\f\035\214\276\3037\335\222\313\361\213\336\350{\271D\t\350\201\\\307\255\306*!\277\300/\330F\217_\363E_\314[\026\372\255d"
+	.string	"\2504x\237J\246\212\350\273\257Q.f\177lvG:\310$\311\360\005>i\035o\373z\n\25368\237Z&\275\327\313\212\335\213\357\251fX\315AE\243\242\371\372\236\322\356\006\227\202\323\355\255\203\233\320C\\b\250\207\236\267\242\r\375\021\255\255\316h9fg9C\216o\271\243\020^\322\261\b\021\026y\021\246^W\224\337T\210\202`\270Rz\335\n\026\364G4(uL\261\241\256\301d\227\013\235\374\256\"\004\364\363@k\016\247\2626\177\276a0\303b\346-\250o\230\244\257\337\227\205\365\233\016\310\347\313\343|\236\204\031\035\333\217\352\267\303\365\352\223\353\273\316\247\307\355j\207\267\255`=\177Ds\362\307\024\353\351`/\305\361\035\260\341\370\266\302\303\323\303UX\221\334"
+	.string	"N\361<\211\262C3o;7\340\204\330\370\033(\330\370\276\242\263\023\343wx\016\017\373\311\352|\214g\377\032\313y\234\327y\"4\313%J?\364\341J\326f\316\267\224\3007Ws$k\363\2035\2045\004\333(\316\333\26724lc95\236 i|\215\"4\276\357pH8\361&M\004\037r\363G\264$r7\0344\211\322w\3539\020\262\365\215g<r\243\315\033\277\351\244\334\271\222\021"
+	.string	"dE\253\262\371\276\241L\320\214\035\t\017\3215@\326 e1\2048\331\212V\363G45B\233\006\326\370\251\342\033p1\025\3372\324\244\037\244yX\372\r\327\022\360\251\311\245\237\3065e6\305\243F\036DS=X\210\246\372\036\214k\277\367&\213\237F\365)\276\007\355\b\236\333O\363b\221\365\310\230\373X\221\374\360\252\304="
+	.ascii	"\240\370)\312\270\260\331\031\220\204\351D=\331\021<\221\036"
+	.ascii	"I\274L\360+>\002\347\261\342\235\212\214\261\370\t\276\355G5"
+	.ascii	"\213\357\275F\327\310\362\224\177,\234A\337\0063\266\260\262"
+	.ascii	"`\240Z.\2560\270R\221\205\245\345\302\202\027WY3t\264dla!\220"
+	.ascii	"\205\245\205\225\201M\215\326\222q\225\225\265\205\200\016\273"
+	.ascii	"\220\252\201\325\"\206\213\n0h1%\303\202\n2\230r\221\265\301"
+	.ascii	"\224\024\022c\315\270\312\232\322\302\302\312\2322>\273\372\207"
+	.ascii	"\360\002\315B3\205]\257\344n\225\316\362\007\371\021T\272:\325"
+	.ascii	"\212\025\333\350\21539'5<\220\263\021\317_FF\342{\231\202\026"
+	.ascii	"+\342G\254M\275\210\227\372\251'\272[\332\205x\251\037\022\\"
+	.ascii	":y4o\261Q\037\342{\271E\371\037\250x\351\275]\315\344o~\230z"
+	.ascii	"\345N\305\303\263Q/\3047\367\267TA\371\313\367\341A\216r\016"
+	.ascii	"\2179\346\303?\017\256 \"`?\2059\346wp\245\257\343\003\272v&"
+	.ascii	"\205\315\356\211\330T\342A<\030\210\026\323<s\20468}\032\217"
+	.ascii	"`2\315x\240%\2324P \332\352\301\232\260\333\311\302\241\007L"
+	.ascii	"X\337b\272CX\242\031\204\362d\227x0\023\332\352=I\034\230\377"
+	.ascii	"\"\206.J\223\325\317\370\026\312\267\303\245S\306\227x\254\177"
+	.ascii	"\301/\020<<\324\313\370c\337\362\214[\275\2077\262a\271\246\302"
+	.ascii	"\237\236Y\325\242\346y3\241\036\351\365J\026LD\230a\337\245v"
+	.ascii	"\351\273F\371\357'U/|j_\237m\364\351\233\260S(\341\344\230"
+	.string	"b\312B\2674L\237\306\335\254w\306G\034\324\017\341\221C\362\362@\003\366\275\302\322\2479i\riz\247oA\246o\3622n\346\317\r\321\346;\333(\323\367\030\263\032\224\230~\326\243L\024f\r;\276\377\222>\215\215F\220.x\324\310QTW\301\370\252-\304{\357EV\375\005\037\024\347\206\267tF\371\222\322#\177\351[0\351\225\276\277\322\320\260\2225\226B\225L\327%}c\t\264Cz\344\367*\346\203+\331"
+	.string	"\202%\220\276\003\033\035c&h\346\377yo\022\351a\274\347}\245A\341\314j\030U\320\233y\364\304'!\nz\312O\362\221\007\201\341\250qD%\221R3\"\"\n\222$\205\264\006\321\005\204\030\245\030\254z\021"
+	.ascii	"\035c\220\241\032\232\024\244X\f\377\306\200\0374B\237\206v7"
+	.ascii	"\320wSv\321\016\236K\022\232\241\367f\330\200\231\025\246=\315"
+	.ascii	"jY\021.[\212\374\263\210\036Ck\202"
+	.string	"\324\253\024\345G\323\231\023^P\231\236\371\220\332\320\"v\275\255\243\025\320\230\247a\245\026\301\240\343\364\334\374C\177!S\261,W\271\263\213\256\250\371\367l\023\307\352k\255\237\362\307t\t\311\0130\363f\250$\355\004\345g\375\275\2433\017\352\350\326\375\325\315k\267R\022\034'x\233\033\345\013FE\300ql\334A,9o\321\032d\361F\206p<Q\233\356\257\202\263\023eO^\024\024J\255M@2\277h\023\362aQ\22015\013L3\337\240\350\023\035\235\372(&\361\2270\305\272\203\005\275V\006m,<\251\215\251\246\220\262\024\212\021\240E\322s\221\236\347\343\006\216\255\275\2365\221\260s\312olN\350=4\362\305c\264\n\215\024\314\240\215q|\250G\304T\bg\255\250\306\325\351\016\344\221\241\237\322=\221hY,\024\262&\203^\244\215\302\020\005\367kZ\227A\207\342x\034(/\021\004\271\312\205AA"
+	.string	" \210\243\304\206\013\341+\231\001\312F\253\240`'\304\231\032\027\262O\274l\\\024p$\250\271\274<\b\035\211\351P5"
+	.string	"b\304D1\261S\241\224\363\206\342\372{\215\002\025h\347\304\224a(\022w\377"
+	.string	"\004\260zZ\262\211\266n*\246\200\002\271;\304\271\355\245\344\305\220\313\242V_\250\317\224\035\347j\324\346\020d"
+	.ascii	"\227\346\230\303\225\236,\b\357\033\036\251\217\331\304\314\264"
+	.ascii	"|F}'\273\257\f/\001~\364\260\250?\301U\032\232svH\354\032\206"
+	.ascii	"\"q\367\177\033\021\211`\302\334U\037'\366\236\346\216\314\375"
+	.ascii	"?\001\f\276\277\360\252\265\214\346\246f.\320\264|BZ\341\335"
+	.ascii	"\245}k;\241\241\312\215s\226&\213\332\230\265\332<t\263)\272"
+	.ascii	"\215(\257\223U\3614\344I6\252\275u\3351Si\035\362\367\002(h\036"
+	.ascii	"\033\3670mo\036-A1u\221\222 W*\0041\3603\265\246\321vV\230Q3"
+	.ascii	"\31709;\321\017<\001\273\177LV\233\241-\355#\021m\247\311\273"
+	.ascii	"\310\360D\234\323K\0274N{a\026rI\031\354@\007Y<\267o\2319\017"
+	.ascii	"{S\236y;\3311\031\300\207\355\344\355u\r\316L\205\312\321\033"
+	.ascii	"\217F\213lv$\177vL\212\001\037'~\255TJ\255\265\326:\n\257\355"
+	.ascii	"\224\376\342'\322\017\"\t\301E\324\3052\335\032\276\t\330\314"
+	.ascii	"\257x\fa\366\017\242+bWT\320\034\"\3328\326\245\243\b\222\036"
+	.ascii	"&\273 osc7\013\251lT\222\340\t@iC\262\341i\206\261\247\005\372"
+	.ascii	"\340V\"\025\251\244f\356\006g*\254N\026JX!\200ek\356\376w\345"
+	.ascii	"\250|\020\327\276\372Aq\342\200W\t\241[ |\252X\3639\234\004\227"
+	.ascii	"%\374\235h\267\3635\330\257a\221\347-\247\356\304\304\236L\214"
+	.ascii	"\263Kl\027\354\026t\313u\331r]\266\\\227-\327e\313u\331r]\266"
+	.ascii	"\\\227-\2676eK\334\300\371\022\330/o\251X\271v\273p\205\226\232"
+	.ascii	"6\232o\306\242\006"
+	.text
+	.section	.gnu.lto_blackboxWriteMainStateArrayUsingGroupPredictor.146.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`!\005\035!"
+	.string	"\346\275\325H\220\332M:\204\243\3651o\312\313rP\203\263\277Jg\271\334\b\205\217\367\270\233]x\230\026v\333s\354\233\257x\305z5J\332EF\222L\022D\221Q\004"
+	.string	"\335\263\201\223\346O\n\036;\347\240\371\266\266\215\020\"wJ\001\302"
+	.string	"\261"
+	.string	"\302"
+	.ascii	"\266\356&\275\330\227|\314"
+	.string	":\344\f\fJ\246\222\204)\034\200m\361\250p$OB\365\260)\235\332\245\276\205\032\030\215\264Z\217\006n:\302\361f\304L\003zt\024\"f\265V#/\270\335\364\251\375 \027B\365!(J\235z\305\345eV\353\321\310G\267\233C\017p\336,\317;o\232\312.\323\303\252U\013\300b\020\223\250\325Z}{\303\266d2\231|y\274MJ\365\323,\327F\251\374\252\237\245\r\213\205\216\235qX\"\255\245\235\335\311\0255{\274x\371\2613\340B6)\032a|o/n+\025`\251m\355\214\304\022g\215\370\345c\247YF!\245\266\244Z\253i\321\350\342\276\335\366\013\333M\266\331\023L\364E\246\363\346\367c7\317l\221\2619\263\242I\373(\244\333\025V\206\343\206\327\206\255\243.\322Q\023}\310/@\350O\356\240\033\371\201\036v\377\\\311\355s\344\335\373\361\357\271\331\315\243\324<\224z'G\255\263\324"
+	.string	"(\365\216R\347\344\250q\226ZG\251s9j\334R\337p\3246\034\365y\2436O\352\362\244^\0335=\251?`\247\203\211\361K\246\324\312\"\331\246n1\317v\374\311o\366\207\375J~\244\3753\037\212uO\244T\330"
+	.ascii	"\323\321\341v&\276\023\353\314\034\345\325E}\n50\257\264Z\353"
+	.ascii	"\006\262\227\331:\2338\023'\330j\2423\0212l\353\263\267\375\360"
+	.ascii	"Kx[9\317\265\355\207>x{\356\241\234\202\027\344\232]\261)X\306"
+	.ascii	"\322=\n\264?\353\263\2755\327\236P\201\276\350\262jm\225}1@\034"
+	.ascii	"\264\242\355\244\243Yx\030\032\230\207\271\200!C\206\363\246"
+	.ascii	"\271'\027R\254\bc\327\225\343\307n\227\177$\034ki6\rg\321j"
+	.string	"\255\270\301\005\215\2271Wt\315C\265\326\0238\211\266hO\324\022\236\313\273h\360\275\314AI\351\274I\264/{\201\"dh5\204h\225\373\203\345Z\262\320;\n\233]\037\243[\251\262\3734[e`gt\277\275\275\232\341\227\220&\335\263t)\031\342\033+\232<p*P\267Z+\222/\345S~\276\327M/\005A`\324\257\351\303R\360\t\327\364`P\352W\"HPb)\370dF9I\001\177\346T\020\030\005\325\344\300\351A\324\022\024\b\020\022\202A%\236')`\220\311\364\357\350\004\320\203\210\237\322\b\017>\247&%\022\276_\020\312w$\300\300\247\245\240/\n\b\f\372tG\253'Y\255\360\334.\343d\224B\273cl\006\316\333,\240\345\355\207\034\271rE\327^\326Z\253\271]\274\025\332;9\005.d\230a\215 \312\263\366\003\b\364E\017]m\225\203vgy\366dC\036:\273\323A\247\267"
+	.string	"\226\307\313\230\330\360\353W\276\333\240\245dC 9\233\333\335\226n\2065p6'\004\316\317\352\326T3\374\302mnO|cE\306)\302\315\313\237:o\342\366Y\001^\250a@\344\230\200\020D\206HDF\032C\032\003\220\002\2211\253\016\020pF4m5\310\023?\370\222\030T\027\f\323\377\3232>\273\316k\2304\001G\343TH\fy\312\220r\036\306@\022t\310\222(n\326\241\322\363\370\310\250\203\317#h\326\256\035N\243\366S\2060s\024\206\342\323\243\317\214\325l\t9\360w\216/\2301\035\277B\334\271GK\244\203\007R.?Es\t<\232\"\365\326=\246,\217e\267\375\222W\240\f3\253h6d\274\3258\034\262\005\004\027|\243\207vi\177\006+X$\234\013\024eB\204(]\227]bb\347\237P-xw\333\201\205\270#\300j\227\202\307\315[\224\270\007"
+	.ascii	"(*\235\036\032U\250\001"
+	.text
+	.section	.gnu.lto_writeInterframe.147.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\251\032\245j"
+	.ascii	"z\254\330%K \216[\031\016\245\214\224+e\207\223\334oi\206\310"
+	.ascii	"\3124\303c\335\205\fW\340\373\020$\025<\325%\315\325\363\330"
+	.ascii	"\303\354m\002KU\200E\252\300@` \0203\357\024\260\202\231\354"
+	.ascii	"~G$W\307\334\335\335o\310#{\223-e\222\001B\002 \002T\002G)\257"
+	.ascii	"\221\006\336\242\224\227\250\310;T\344\025*\362\006\025y\217"
+	.ascii	")\257\021\345\325\200\362\026\2337EyQ\224\227\210\362\236\315"
+	.ascii	"\333(/7\357\277\345\211\013`T\304\256B\340\272\202\035\316\260"
+	.ascii	"\316!\342}9\237?\360\307\3637\377"
+	.string	"\023~\024\3764\177\335\213\273\037\334\243\230:\301=\342\201A\214\331\036={\300\331a\230<{\304\223\201\032\034 \255\" \207@;,(\373\362Z\340\323\243\263\247\334\353kAoO\236\345\031\234\016\177\224o\002\t\335h\311;!\333\362l]W\274\263Y\"F8\346j\276f\367\270L~\267\275\002\341\337r\314\272\256\307\023w\231\354\036O,:\231\2339\335U\270\335\036\353\234\320\340\302`\007\\\263m]\345 (\242y\n\352\3238)Z\353\254\027\373\203##\270\256r\t\024O\\\271\342\231\317\251G\001\312\271\2429\341\340\264\005)\236\310Pr/\243\376\204\013\224\204pq\004\3275\254F\361\304\257E\3731\217S\337\334\274\257c\3531xAL\030\301u]\253N\334\023\305\023\241\256\204\236x\036\t=Q\335\335\3234e\335Z\0017\246k\016\206u]\257\332\203\356^:\317\223j\373\247\3347=\325\207"
+	.ascii	"!\025\005\365\301C\007\016\033\236\234\232\230\226\224\246\222"
+	.ascii	"\220\216\214\212\210\206\204\202\250\214\307b\212\022\317fu\237"
+	.ascii	"\322\220Z\266\331z\210\272\203\250s\013S\201\245\352\322pT\n"
+	.ascii	"\207J\001\r\177 s\017d\232\334!\356\034\342\306\360\0061\177"
+	.ascii	"\022c\002;\301\275\351\204\202;\241\354\3020\323Y\204\002\004"
+	.ascii	"^\n\341J\217\022\302\247\006\037U'\354\213\035'\261\035\211\355"
+	.ascii	"\003>\362r\243\023\312\313\t\265\256\353\032\027\251\235H-\013"
+	.ascii	"\017-/\264D\343\2403\310\357\r\313\353\204\235\235*\312\352\374"
+	.ascii	".\370(\2670,L\225\322\350`\354\356F\276\3731j\313\230\331\213"
+	.ascii	"gQ\2350\345\211B\n\247F\021\256\034%;qH,y\024\233\302\347\363"
+	.ascii	"\374t;\013d\306N\032\261+\357\263\204\340\n~^'\314\354T\002\013"
+	.ascii	"\301\353v\347/1.\346\224\306\272\256\313^bc_\021\337e<\273\273"
+	.ascii	"d\267)F\234\245)\324X|w\177\246\330\352Tj`T\270\243\351\263\302"
+	.ascii	"\234)\275\265Rl\365c\007\365\357N\247\3061\375\251dj\250\320"
+	.ascii	"\322\325[\273\\\246\224\013jb\241\027Y\024\262,\257]\033l\005"
+	.ascii	"\307\211\313+\262yl,>\273C/\262\250\2766\261n\346\nA\325\276"
+	.ascii	"\335YI\005L\231>|w\244p\f{\256\353G\240\337j\265\337\245\344"
+	.ascii	"\3420\026\023\262g[\035<\370^<\320\023\277\325\007<\2112v\177"
+	.ascii	"\3138\345\023\033{\027H\001P\032\332\330V]\201\212\215\266\206"
+	.ascii	"\336P\230\\n\200\244\330/\344\f\370\313\213OL\373\201\200\304"
+	.ascii	"\346F;\005\224l\343\342\303\345\013A\317&v\223^\322\215+\331"
+	.ascii	"\344\354\273\001\264b)\314\325\3756k\006\360\226\220\342\272"
+	.ascii	"\256-\226W\013\020(\2629AO\344\206\261\326\f\344\244\b\350}\027"
+	.ascii	"\316\362$\361\256\371\346\241\273\n,\300\367\332\021}\252\314"
+	.ascii	"\221\322[V7t\002C\r\006\007Z\353l\317\320\304\3758\211\361\267"
+	.ascii	"\256\353\213=\341\013\031\330\263\235\270\r\f\341{\rAOl\240\323"
+	.ascii	"\264>\030\226qxQ\370pW\216\213\233\351\367V\266f\273\313n\232"
+	.ascii	"\226,K\26433,e\312+dV8\030\023\013\003;\025\224\367[(\257\n%"
+	.ascii	"\345}\322\004\345eR\201\026\312\253\204\002\224\027\311\361|"
+	.ascii	"\215\240\274\021\240\274XO\363u\340u\337\006\202\234\317\027"
+	.ascii	"\310\017\037=\336\374\362x\363\273\343\315\257\216\007~s\034"
+	.ascii	"\317\027G\363\336\030\342\2651\304K\200\020o\r!^\032B\2743\204"
+	.ascii	"xe4o\214\346\205\221\362\016\220\362\n`\344\r \345}a\344u\221"
+	.ascii	"\362\266\b\342e\221\362\256HyU\034y\001HyS\034yQ\244\274W)\357"
+	.ascii	"\211\224\327*\3455\221\362V\031yK\244\274$\214\274#R^\021)/U"
+	.ascii	"\312;\225\362\206HyA\034y\245R\336\250#/T\312\373!\345\365`\344"
+	.ascii	"\355\220\362r0\362nHy\237R^'#oS\312\313d\344]*\362*\025y\223"
+	.ascii	"R^\244\2247G\\\342\330I.\363(\021\363\252\232D\233\350&@<Z\253"
+	.ascii	"\317\302\344\262DW\001\252i\227\363\247ViS\242/\007\020oD\223"
+	.ascii	"x\201\375\324\264\317\211q\237Z%\306\210\376\340s\220\241\371"
+	.ascii	"\031\276\254\316/\214\322Tw\331\333\375\314.0\201\220(\350=\217"
+	.ascii	"t\364\016+\203t\212V\372{I\"Z\220\252\247ZD;\315\231\270\216"
+	.ascii	"\246\240\317\274\344\222\213\216\272F\325w\263\326\264\302{\352"
+	.ascii	"\332T_\016\332\036R3w\252\013L\323\310\304\203\350\300P)\252"
+	.ascii	"\272\216\376\342 \260\f\007}:'*\351\224\\G!\372,\364\032\004"
+	.ascii	"\321Q\035\242\235\n\223mR\r\242\017\247)\325\227\263\006\325"
+	.ascii	"QM\234S\257\360\033\265L\016\252\32114=\303f\024>TQV\367g4\266"
+	.ascii	"\007j\254\215X\237\257\310\214j\366\206\350at\276\206\255p\260"
+	.ascii	"~\337\020\232\0376BXw\266V.\202\306\252\213\240o'\250\231{\301"
+	.ascii	"\213p\301x*\275\3471H\3478s\364\233\377\271\256\353J\225\243"
+	.ascii	"O\245\211\270\274\331K.?\230Q\327\230\332Cs\350\017\235\346u"
+	.ascii	"h\017h\324\264\347\321\325\251u\350\347mh\016sj\232\013\265,"
+	.ascii	"|\346\304\206~\034\264;C\274>\235\272F\304z^\203N\315\324O\215"
+	.ascii	"\352%\333\232\332\251\214\232\366;59\225y\246\251\177\267\206"
+	.ascii	"\267\324L\375\256@\203\334T\323\256\270p\234\312\244R[\3527\321"
+	.ascii	"\356\340\272\313\352\374D06s\231\253~\301\037\254\353\255Y\254"
+	.ascii	"z\220\376\332\037\375\224\315\231\222\324J`JP\032\301\003~K*"
+	.ascii	"\362\361\265\260Wl\346j\300\202\032i\242\227\256:\216\376\302"
+	.ascii	"\321\337c\346\216\024\216\341\357\262\"w&m&\2166\322G\\\324\004"
+	.ascii	"2\372\304HGm\324H\315v\3116\2566u\355{j_\236\367w\324\337[C\022"
+	.ascii	"2\b\352\332\317\254\372\001\263\271P3jt\354\354\320\020\317\004"
+	.ascii	"06\304fn\225#i5*d\230\264\222F\342EIS\255)\2374\223~Q\233\370"
+	.ascii	"\223\376\236\023\335\312\364\270\354\2400\003Q\0275\333u\005"
+	.ascii	"2\372\346\2418\232\250\237\347\305;f\324\374I.\271\372\332\302"
+	.ascii	"\336N\022\034\342\213*\302\336\034)B=\304e\313\220\226\254\342"
+	.ascii	"[M\256u\204H\222$Kl\020i)\031\362#\b\002T\311\020-#Dnh\035)\222"
+	.ascii	"\205D\213\210\222!\255#K\262l@`\204H\221\034F\206\034\311*\242"
+	.ascii	"\205$\353h\261N4\311z@\002\254!F\036\270:Rd\310\004WXI\224\\"
+	.ascii	"\235\370\260YH\210$\271\322\312\312Jru\224\213\362\356\262:\362"
+	.ascii	"\326\030\nFi\256\275\340\004(\347\272n\231!x\002\222\017\335"
+	.ascii	"\016\323pH>d\037\322\216\035\364\304'\3136a\bot\t$\330\350\355"
+	.ascii	"7\267\033\375\344\bpP\002\332F;\001J\272\325h\002\232F\327h\247"
+	.ascii	"\274$\336\214\246\321Mz\222K\r\276qP\031=\243\237\214\303\325"
+	.string	"lH=\305u\215r\257m/\375\001\022\020\017R\317\036\251\007\225\321L|w\334$K\210\321j\036\230hf\227\030\206x0\272\2678YR\353\2649\257\301\316\322K\030}\267%\013px!\006\020\240_\364"
+	.string	"}=\311\266"
+	.string	"Z"
+	.ascii	"3,H>v\177\001\270\350\027M\326J5\r\306\0372\260\257 \371\260"
+	.ascii	" \272\350\017.\355\216U\276\360\001\321\314M;\003"
+	.string	"\353\240LZW\321\322_#\203[\364\266\320\311\336Z\026\335\242\203\314\364\321\005\312\301\273\310B\344\037\276\027\213~!\035\233\325P\220K\252\231\233\005\214\013\235>|\200|\317\322h_\227\362l\026i\330\033 e(\256\253\224\026\333_\255\001\022\320.\362P\335R\267\320\023\277\354\2639\307\221\031a\031\327\214\3424\277\f\3472(4:Eh\311\263~\336\2074\217\241\212\207f\256\031\330\226\255\242Y\257X\372n:\310`\253\357\231\253S\320]\265K\315\340\017\2409I\016\315\214\013\364\004\245\367t\362\321?\372\253\3540\355,\213A\331\1773\305?\332\303\227\n\367\247p\303\212?\025\235\242W\264\323\234\217\206\002@\253\350\027\002\320w\203\242Sl\300}\32429\024\235B,p\3142\356\251\231F51q\272\32445\351=\231z\264\217+2\360z\245\017\307\351\352\316\211\266\352\253n\262\353\321M\002O\364\325"
+	.string	"6\301X\217\272&gE\224\203\266\007\256i\211G\357\231\264\243{\220\371)\"\353\3531)U\320J]pwSU\007\322_\037\374=\350\202\223\243\244\325{N\355h\036@\352\374\336\264,5\023HW\320\001\202\037\250\262H-\022R\207\034!\021\021\221&IZ\003\302\013\020\006\242Q+\265\365\022\200\0231\013\304\3161e\"I\222\244\335\240\306\021\237\027]\032HO\243\233\353\371\276=\177\001\026\r\307\245:\026\026\240\213D\303\242\rl;\017\234\036\344\032h\030\260ZDo\n\302\373}\347\276\236\307#\001b\3118B\240\375K\321\2673\370[(\r.n\367@\034h4\20352\005\277\031\201@\320\350\355\373\n-\036\"\\\364\240`@a\344\004Y\317Z^E&\310\261\336\237\261\336\211\316\324H\333\252Tt\322\304N\323\\\222\033"
+	.string	"yM%D\030\305\210c\267q#\325\315\022\320\347\323n\221g\004\003Jd.\241'\234\032m\001\213\251\227\007\353vF\354\214\232\211\"\323^\370\023\300.C\330\351?\305O\036\376\363\207<\nmm6\321a\376Ry\2376\367\206\333\230W\325\211\362\304"
+	.string	"1_\225V0\312a\364E\265\253\333b\326\302;\217{M\245\260\306\200\212\347\017\333\"\376\223\242A\301c\312\025"
+	.ascii	"s\362\033\326\246B\217\361\375bp\254\365\211q\"\021\006K\035"
+	.ascii	"\266\032\271?\273\360\250d\264{\210\324\271$-y\344O\334\223\304"
+	.ascii	"\037lL\202\211\360}7\342{\265\025\260&HzE\272\324\027w\300\030"
+	.ascii	"\025\261\320`\217\211\217\025S\203"
+	.string	"3\354\177&`\231/\366\310/-\362\233Gl\030\243\033\263\334\261\033qL\235\361\206\310\215\262\032\f\032\033\013\201f>`\b\034\321\310\310&P\366;\021\370\201U\333\245<\371\200V\275A\370[<\200\017\355A?\021j!\362Q\226-Z/\334]\263\260\177\336w\330\341o\264\016\307:\bj0Q\301\303\325m\325\037\371o\241\034\306\360\021IF\227[t4\336\"\313\243\275U\256{\346\332\245\033C\314A\316\255Q~\217\253Lp\\\237\321\251\211`\253|\033\206\320\013D-\331\227e\026\353\332\220\355d\244\346\263{`\232\235\232 \3231\314\223ne\364 \275\202\277K\3539\f`4\333x:\235+p\206\\\273d\316@f\255\272e}\366z\n\177\205\266\\\032\"t\363\274\315\0323\326\236\026\013\303\217\312\214\005\366\335<^[{\331\260\352\n\355\371\250\204\366a\212V\3376D\261\r\017d\243?6\035"
+	.string	"q"
+	.string	"\340\2110\375\340\036\274\236\216\222&\267s\306\223\177\311>3\373\360H\332{\023\224|\260z\213L\330\232\352\252\267\243\026\265\247\305\ba)\310\3113\313\367\200\036:f\2055)\316\313U\240\346\002cL\322x\265\274\302\f\373\226H\230\036!\350\312\272\221I\273\237d\f\371{\330\217\251\n\0313\t\033"
+	.ascii	"Mk51n\356\334q\2516\263o\030\"\325\331\263\006\372t\340\3024"
+	.ascii	"l\024\370\240+b\265\300:,A\215\354\210\214\334\017\226\003\254"
+	.ascii	"\206\355\300\217\253>\030(\030%\332s\256\333\242\222\263\266"
+	.ascii	"\277\001-&ER\032\220v\205l#\211\024\217K\207\305\353/\253U\362"
+	.ascii	"*z\221jKe\027\234\333\317\270(\356\201L\004\2422\275\203\244"
+	.ascii	"*p\370~\022y\364\335\237\r$\342R*\357(\201\327d\272\317$QW\267"
+	.ascii	"\031\317b\242\312Q\302\031H\f\026\002\032@X\320\342\272#A\016"
+	.ascii	" \026\310.\210\275\364Z\212VM\306Oe\306\237\345\247\253\323D"
+	.ascii	"\322\334;\261\251\315jD\302\033\f\256\325>)2\007}I\353\352\202"
+	.ascii	"\3529\21290`{|\346\300\341sO\032\325\250Y\225\246\001\036\355"
+	.ascii	"\237s\236\262I\353\325\276ifH\371\306\230\231\266s\274$G\316"
+	.ascii	"30\003Fsn#]\023\252\306\210\360#\023~\024!\221<\256\372o\211"
+	.ascii	"\275TD\001MD\340\033X\246\r"
+	.text
+	.section	.gnu.lto_writeSlowFrame.148.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\375\001%\020"
+	.string	"\026\235gF\320\026Q:\224\315.\256\004\206\031\304\017\361\224\215Y9\337\016v&\334C\2446\314\265\0136\2527`\310,\305u\324\301\326\303\246\307z\005\337\211\223\351\207\342\340Q|\036\300%\310ZL\004\003\bO\032\331[\312\224\002O"
+	.string	"L"
+	.string	"X"
+	.string	"1\207\212\307~\373\227\031\305\207q\330\352\261\032\270=\020\366bg\227\304\312\243E\335\243k7\300=\0028\001\356\321+\373\310\001\021\313j\201\275nx\226\354\256\247(\276z\256\374\313\036\372Z\254'\b\302\356:\277V\211[o{\201\355\026;q\0022\246\374\367\350\233\270\307k\312\017\0361\233\274\271K\353\270i\234\335!\225\377\254\302\304V\013\241,{\306J=a\037\356\356Zsl\230\016\305t\007\323\240\230\346`:j\032fZ5\235\231~\001\001,\212\264N\304gw\304\255\311\326\002!\345\234T8mG\367\003b\341\024\244\034\315\302q\320\334\340T\345\022\362\212E\265\315\340\262\227"
+	.ascii	"Cv\327\301\235|I\240F\375\205\333\250\001U\345\n\362\243\251"
+	.ascii	"\252,7Ol\f\247\221\241'\365;. \257\001y\265G$\005.\235GC\267"
+	.ascii	"\273\r|\031\237\021\343\353<:\251\022\315\314\350\003g\222Hu"
+	.ascii	"\202\221!\215f`\274\r1#\223GB\245<Q\002\2378\224P\236\207\323"
+	.ascii	"\t\345\241\314\366p5\247\263\265\250\331(\b\327\300]\023\017"
+	.ascii	"\220\304\310\233W\356\367\270\217\027_\307\021\\\\p\\F\\(A\220"
+	.ascii	"\237]&!%\305gO\240\240b[Q\013\251O>v\032+ \320\002\221\031\\"
+	.ascii	"\007\340\326\033CG\030\330\221<\225Dl\210\\\naL3\314\016\024"
+	.ascii	"1\215DF\376f\250N\226\211\254\204\231\200\223\022\031\333-\f"
+	.ascii	"\023r\b\330sB/\2531gdW9L\326\373\271`\201\220\265{\023\027\323"
+	.ascii	"`\005\332\365K# l\024\fI\374\215\306;\247\277\214i\013P\346E"
+	.ascii	"\233\311"
+	.text
+	.section	.gnu.lto_writeGyroCaptureFrame.150.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\261\004=\034"
+	.string	"\306\363\260G\260\326M:5\374\316\030O\372J.\316pQ\235=\350\305\323\300\274\023\337\257\023D\024\007|\032\037\272\032i\257\307\023H\013;\256\372\304\362\305w\241fc`\270\206\202q\350%>\374\377\311\307\372\033\262\204\220M\344N)\232"
+	.string	"\220"
+	.string	"\236"
+	.ascii	"T.\2767v,\023u\346k\327\006\317\247\031\214\237rw.\355#y\024"
+	.ascii	"\356R/pn6\3117\343\311n\257\307>\343\247{\027\020~\216\007\020"
+	.ascii	"~\3328;\f\216\322\036-\2102\023\303\nlwm\nD\264\036\354\335\240"
+	.ascii	"\342>\212\341\004U\342|\361\307\367\002NX\220\272~\273\243\217"
+	.ascii	"\340\315\026\033M\277%)\352x(\376\374n \314\247\333\351\370\004"
+	.ascii	"ov\227\266S\002\025H\246\035\222\004\213\340\270>\353\b\234\254"
+	.ascii	"|]\277\035\216K\361gw-u\273\033\267\354\266\253lC\260\301\247"
+	.ascii	"9\234\252\302\244rr\3142i\255[Jh\023\255\220\327Ybmq\205}%\351"
+	.ascii	"\221\335;\222\ne\377\253O\266NN(\215s\251?\300\225\334\265c\335"
+	.ascii	"\264)m3\245k@\351\331\224\246\001\245eSz\234\322\"(\035N\351"
+	.ascii	"\tJ\203*\255*-U\372\004`|\325\240\261\273\230\255\335\032cg\226"
+	.ascii	"kj\r\271\222\037\353\247\272\332\377\201"
+	.string	"\233Ua\252\211\310\253\374,\317|\253_\341\216e)\227\0016\305\364\265\273\017\306\317\035P\336\347\231\335{\022\334\003VTG\325K\362\234\246L=\247\351\245|^I\322\314A0\301i\252\243\265\037`[K=F\365e\250}\221YtdD\235:\352\264\nU\274\242\341W\274\335\265\262!\002\357\263J\250\277\n\242\005\352\324\307\020\313\311\261\240S\341p\200\267\233\344\300\356\360)\037>\007|\001\365Y\237MNWG\264rrLuw\217T\241l\003\220\2526\210\020;R\257\252=KD\220\242\210\030w\267\201\017\345Z@\026\272\311\353n*!\210]\342NL\214\273I\r\374&\036N\214B>\375\027\341\347\365\001-n\004\304b\350F\"\274\r\251@\001d\024Z\310\247\005Q\320\t!\240\241 [\n\023@(lBEF6\037\002&Rq+\262\261 \"*\262\315z\373\257>y\024\033\303\225S$\273"
+	.ascii	"w}H8\325\377E%\307\214\243\276\327\301\340\246\252\204n4\336"
+	.ascii	"nN\326t/\017F\276"
+	.string	"\020\177B\370\211\2434NT|]Kv\344\344\230\2211\314Q\365\232<\257\325\304\232\346h\355G\030\226\315\210\032\245Q\233\231\326x\351\302e&S\232\021\327B\341\\2\375\217IX8@\366\374U\367Y\320\341\351\354\013\030\356\373yb<\270\224\246BY\fZ\250!P\345\2242R$\"\201\310H\222\244\003\240\002\021\262*\017\021\300-CC\"2\f\222R{\006\240\321PD*\002\272\235b\245s!\325e\"\3325\275\201\352'\"}_N2\025\302G\201\031\206\200\017\016\357&\350=]CU\210\027\234\335\243\353A\357\255$R\230\354\332\030\232\317\020\354\370\225V+\301\266\337?\3641\0248\357]4\266\306\006Ar9\200\\\310s\004\307\017y|\255\001#\004gHO\241mT\277\235$\330\344\324N\357\304\022\003\215\273\304\341D\\\001x\354V\264>Wf\263\2614bZ\364\332\323\337\r\354\322y\342"
+	.ascii	"6\025\2139;\020\252\360\266\003\324\035\022@\340\013\\T"
+	.text
+	.section	.gnu.lto_writeQueuedGyroCaptureFrames.151.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\221\0015\017"
+	.string	"\006\334cE"
+	.string	"\221(\035\fo\367\234\315\2032\334l\006\364\0208\351\313\312\321\202\276\242V\r\027&\220\307;\027&e\254>\352\313z&9\234'mEH\206\356\322\277\333\334\273\267\013\022\375\177w\025\033[\277\021\262\267\224)\005P"
+	.string	"I"
+	.string	"P"
+	.string	">\307\"\273\206\200\322\034\201\274\2200\241\210\231sr\353\301QE\227qU\344k(c\005k\201\243\313\270\225N\037\002\200\245\350\221\305`\356r\275"
+	.ascii	"\2224\206H\371\336\345QD\350\"\301Z`\312u30\347\264~ \352\326"
+	.ascii	"n{\201m\002\366c\001\372\357\3227\321.uw\307\247A\263\337\263"
+	.ascii	"\b]+\030k\346Dg\313rQ\002wWl\325H\357a\221\305\274*\366\2527"
+	.ascii	"\253\326\254z\273Z\273Z^\035W\275\252\326\253\357!B\2350\200"
+	.ascii	"\317\361\232\3634\3231cH\030\020v\213\303\343n\241\311\325v\203"
+	.ascii	"aJ\rx\\\271\267\300\201\2443\357\306\275i\306_\375\304\210\337"
+	.ascii	"b\005 \375\007\322.w\377\"|\215H\001P]\233\304\323\177.\320\001"
+	.ascii	"eG\366U\024:3>\333\025\376\002\001\204e\316\351)q\023%~\313\245"
+	.ascii	"%\230\004\356>&x\"\f\272O\003\021\316\001\350C\302u\241\022\356"
+	.ascii	"\243c\357\301H\210\213\340y!\216\243\232_\025\0042\031db'K\222"
+	.ascii	"\273\262Y\315\036\240\201\242\262\025\t6\273I\251\320l\307\265"
+	.ascii	"!\025\347\2343\372\017\321\374\024o\205|\272N\273<*|\305\334"
+	.ascii	"\330\226\365\317\206\266\333\006% \200\002\241T\026\007\240\365"
+	.ascii	"\344\300\336\3405>\026\035\262\265S\356\313\230\223R\021\013"
+	.ascii	".\025/\243\202`\370\007<\227\2501\274\305\240\262;,\314\234\017"
+	.ascii	"\032\214Q\324 A\221\032xE\241\262\303\231\243\302G\335R\024\227"
+	.ascii	"\271XT\231\221M\240kO\374\bL\020e"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureSample.152.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"\225\n"
+	.string	"f\223IA \307*\035\367\303C\220sDY&\035\001\274\005B\036K\303%\316\316\216\222+\214\302J\300\3511\332Z\352\377\201\021\246x\034\013\211<\b"
+	.string	""
+	.string	"p\024B"
+	.string	"VM\030\220!\024\230l\215l\262eJ\0017"
+	.string	"6"
+	.string	"5"
+	.string	"6\226\r\025\005\265\326o\212\214;\276\233;\372\b$\352\035\346\365\331=\304\004\2742\244\252\323\020\3708p\333\267E\256v/\234Z\253\227Ev\334\364\266%lG\330\237\001\273\276w\031\314\325\"\317`\245VWnA\035@\001\3142\266\277\366MN\033_\323\360A\255\262"
+	.string	"-\265\226\020\336`N\033\256\361N\273+x\247\036m\004/G\352B3\216\351\223\367\351I1\260\332\233\375\223\243\234|\022c\230\366\254S\337\344\235~\336v\007\262A\201\030\r\226\332\234]\242v\206\330\177\202\222\327\315\023\304~\355\247\001#\212O\b4A\022}D\261\004&\030\334d\204\236\n\260c\341\371D\240N\350\003\305\321\267apx\361\021?R\030\212_\246\254\270sRS\205\353.K\247=*\355Y\356&\312\003\027\020"
+	.ascii	"`\251'30\034&\214\205\253\226\234\2410\241n\205yH\204\2507\004"
+	.ascii	"X0\345\022,\261\2322\356rK{40\265\007"
+	.text
+	.section	.gnu.lto_blackboxShouldStartGyroCapture.153.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`y\001\305\016"
+	.string	"\006\232aG\360\2606\035\300\315d\321\031\217W\352q'8o\252\r:\037b'\031\3168\313\361;X\270\031\255\035F$=\350\177\373\013\021Y\376&\243\222+\333mB7\221\025V\344\375\351\255\361\261\222\315$\247\330H\333[\356\224\002P"
+	.string	"J"
+	.string	"K"
+	.string	"\222\363I\377P\257\245\"\305\n\230:&\340+e\337I^\fZnXn\270\370:\234\316\003*4R\262O\303\034`\203E\207\211\234\357R\337\tR\211\340\311>\323\374\230\201s\372\352\022\365\225\244\304Bj\255\226\336\007\336"
+	.ascii	"n\033e\033\201}\023\001\005\300\231\034\025\230T'G\233E\222\033"
+	.ascii	"\332\337q\034G\257\312\2664\265\364\264\364Z\372\331Wz\240\240"
+	.ascii	"\300o\250Q+\312\330\2528\024\206\213\355\022;s\002\005%\346\b"
+	.ascii	"\230\220x|\330\2008\321\354\324\312\322\226\304\271\177\260\213"
+	.ascii	"\316\r\027w\311l\007[b\354\350tr\364\315\211XC7\214\371b\322"
+	.ascii	"\300G.\333\302\005yo7\200\347\241\362\344\230\226\364\236\021"
+	.ascii	"\24387\374\2129ZpXs\3277$\203\303${\354\303|\005\347\227p\006"
+	.ascii	"\022y\357\324'\271N\277_=\026\201`\330B\020D\"\021B\332\204\007"
+	.ascii	"\"\0224\321hD\003\001y\243\340`\244U\330\266\221\226\261\352"
+	.ascii	"W\345\006.\242\210}\346_\375\323\262\t!\276\330\307\234\356\211"
+	.ascii	"m\272\016\351\2664k\255\365\263!\013\031/:\013RP\354\300f\315"
+	.ascii	"\334\005iN\204\037^\272# \260\002\021\271=`\353a\027\260\347"
+	.ascii	"\363 .k\234(\270\353}\364\211\332\314Jf\300\2509\344\036\313"
+	.ascii	"\361N\2625\271\335?<\331\306\307\203\003\032\025\2738\330\"\031"
+	.ascii	"+\273\331}\356\354\331\216<\274\317^\343C\266A\022=\3516\307"
+	.ascii	"(2d("
+	.text
+	.section	.gnu.lto_blackboxStartGyroCapture.154.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`j\002\355\024"
+	.string	"\306\350\214H\300RRcr*\314\303`\366\276\201HU\027\r\335\220 \226w>utb\233\260\346p\b-\312\025\303)\373Mb\254\330\"G\374J\265\370D\304<\223\262\203\277\321\004\220\245?\342\024\240tW\2452\333\020\266\245\2242\245u"
+	.string	"l"
+	.string	"}"
+	.ascii	"\366\357,l\007\346\374\356\356wGLKR\367\212Pp\353\006\254[\377"
+	.ascii	"X\237\366\217\216d\273O\307\255{\203r\310\270\367\267\300)\254"
+	.ascii	"[\223\223\210\267\365\004\304[\333\354\250\003 \356\215\001\023"
+	.ascii	"R\217R\325\275\367EQ\334\366J\247\315\177\360-Rw{%qZK\206\200"
+	.ascii	"\254Ft\270jrc\330s\341\247\217.7\247\310\312\275\327\223\324"
+	.ascii	"\355n{\333-\266Y\354\331"
+	.string	"\024~\321\255ef\346\311[\177F\274=\375O\017j\205\217Em\232\007g\256\336\275W\345\246\247\303\252\304\316,\355\037nR\"\373\365\336{M\207\354:\355\022\231\036\357\373YuZ\254\323V\234\256\3424\265\323\263N\177@\001\025=v\367\001ro\2102\310\035\332\246\024\007\376\366}\245\013\355\3218O2\200\036\324xk\343\330\343\355\037\364\030\2671\201uoN\305\247\361\032\024*\270\270\210\267\223>x[\325\333a\345\373\214\250I^\224[\257\334\246\220j`>\351\301\227\223\030\t\213xG\244\200_\020}!\206\f\363\244-\275\375\352D\271D)\221\347OD\027\215\t>\345\346\225]eY\372\370\2118R\027=\017\017w\030\217\001\343\027Y\003\f&\336\216\364\302'\030\361\243\307C\3729\265c\224\212\234\262\354/f,\277\305]l\b\260\032,B\255Fv#k\331\274\310hd,\324jd4\232\207X"
+	.ascii	"\307R>\314bfb0\0161\257\032\031\030\315+F\263y\245\224x\326A"
+	.ascii	"F{\325f3\332k\374\355\274^:\344\226\020\320p\207\342\234S\357"
+	.ascii	"\rrp\340/\005\234\245M\346\310aD\373\001\004\024!\023\303\034"
+	.ascii	"\275Y\244>\216?\351\260\264\264\210\267\324\211\234\262T\244"
+	.ascii	"\326\211\207W\251\025\341q;\211\224V\212\200\212\307\b7KOJ\351"
+	.ascii	"{\206H\b) @\002C\210\231=\340\324\233B?\020#Q\305\023/\026\207"
+	.ascii	"\002.\317\\\r\303\037\003\026\240IatT\202\216Vw\256\321\246\341"
+	.ascii	"-X\205\005\005x\303\221\202\345u\226\265\267\312\234\265p\313"
+	.ascii	"I\205p\200\203\327@.\254NRD\301\225\330\331S\261\035\2367\021"
+	.ascii	"\301H\251Q\204\024\316\275pDExy\276\311)\232\331\003"
+	.text
+	.section	.gnu.lto_loadSlowState.155.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`H\001=\r"
+	.string	"&\331XC"
+	.string	"\2216\035\333T\211<\305\266(\306~\216E\325\203*u\035\005PPs\364|\377\351d\0073\302\243%tP\204;\003+<\3248b\302\241\331\002\200\240\026k\002\220\327D\013\355\207\321\344\t\221\275\245L)D"
+	.string	"A"
+	.string	"H"
+	.string	"\376\210\223\320\376b\362\316.\211\206\305\356w\300\237\352\321\337=\324c\365"
+	.string	"\324\2435\273\306"
+	.string	"\r\273%h\021\003%&\307\356Z\372\341\332S\363_\342\033Ne{z,\330]'\247\262r\353m\027\260\215\300\376\214\336?\314\202\001\227\335\321\271G_\244oI9m\3600\312\223\375m\251-\366\341\356\256\225d\307t\365\227\237\202\351\b\3230\323\252\351\314\364;\002DpXy\n\216\335\016'\035k\2123 8\266\237\016\252v\204\253HUU\031\224\035\235\264'\200\362\\\252\226:\027\246\023\335|\265\257\247\b\251vW\201\217\"\003\001@\343\231p51?\021\342{\026\te\210z\274Jp\271\021\202\245R\037&#\361\275\244\301r\230\233\300\340\007%\330\210\b\372\372d\300>B\027h\344\303\242 \002\"\261\256Ld}\b\030\253"
+	.string	"\222Y\0270,\2638\337\036\256\222\274\351J\246\221\2368\252\315\3403P\246ATX\352`@\265\035|E\211\312\340j<i?\200\220\347\240\252\215\356E\033"
+	.string	"`\251'\023Z\373\002\303\005\013P\004\300"
+	.ascii	"\203@\210Ze\006\242\302\265E\370\260\204\342\370\032\205b\205"
+	.ascii	"\200\270A\005l\325\360[\215\307U|\226\336\2100V=\030p\t\241Y"
+	.ascii	"M\001wy\321N2"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.156.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\342\002\r\025"
+	.string	"\206\245\204H\320\016)\035@\2511W\215J \323y\340\313Wg3\370d\334\201Y*\004\377L\003\365\311\301\314\231N\374oT\026n\334\277\317\241\037\354\032a\r\352e$H\324B\210c-)\007;\233\365\200C\244\343\023B\b\221;\245q"
+	.string	"i"
+	.string	"n"
+	.ascii	"\341m\026\237\307\253\357\3208\312\336\306\210\273\030\250\035"
+	.ascii	"\217\207\376 \037z\001\003\026\323\016\264\224N\034DR/AP\273"
+	.ascii	"=\226\342\234v\0259\212!\250\223\346\217 \020Zj\222p\271\362"
+	.ascii	"*\232\223,dh:B\310\350\346(v\334\314\350\036\272\370Z&\210\221"
+	.ascii	"\353"
+	.string	"p\325\310\335@\216\335=\317'L\3166\347\b\262\273\236\270\334\314\215q\3336\266\037\330\363)B\261\251\252\003=\b\203\257c\224\224y\334C?E|x\315p!$\345\201GW\233Sv\257\234\272\263\017\256~\2607\300i\325w\356Q\247U\247\247N_\200\202#\233\022\020\321\013m\321\333\230)\251\375\205E \356\363\357|\332\267\337\343\373\274\362G\274\307r\237\225\257\313>\367d\244\241iW\246A\357\005\304\207\344\007\210\017GR\361u\022\344\354.\005\361\241J\307\035M\022L\315C\335\331\343\252\262\037\246\333\214r\200I\336)\304\377\334\250\250\345\232\307\251~\211'\342\347\242\345\317}0\022\347\273\212g\003f\314\367|\bF\356\326J\334\304\212\257\363\320#0\230\370\320&1\231\307\371$x\034~7-\347\356\226\252;\255\r\341\374$\335f\224\247^G\375\211\227\036[\257Yk\026\242\022+\tQy\235"
+	.ascii	"x\315`\262\b\025JRb\026PVv}d\210\211\220\270Z%\"\254\023X\313"
+	.ascii	"\204\345\222\241\260>\0208v\341%c\315b1\031k\325\333\223?M48"
+	.ascii	"^\3057\024\306\366\206~\005\017\351WS\033\250\"0m\t\023\214~"
+	.ascii	"\266\336nI\352\3164qT\335\006\246\322IIGq\005\334\275qp\237\277"
+	.ascii	"\3117\247\254R\024#0\0039\2735\215\245\243? \240\002\031A[\007"
+	.ascii	"\240\365>\003\316\260e\030\330\223\354\246\265\"7\342\366q\024"
+	.ascii	"\202\344\242X\2156\270\276%V\016\317\026\263i\r\\\002\200&\244"
+	.ascii	"\3056\224f`M\013\307ytc(\b\243\241m\334\273\034\210\257\312\305"
+	.ascii	"K]\020\013\205&Y\"\231\303@\305\311\333\242\016\336Z\003qM)\355"
+	.ascii	"2x\370\370x\356\341\016\024\304i\300\202\021\26760e\372c\005"
+	.ascii	"7\337\227\032\007z\031\354\030\017\244^\313-\0305\037\303\016"
+	.ascii	"7\362\336\326v="
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.157.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\225\t"
+	.string	"\246\320@<\020\005+\035"
+	.string	"\200\371\230\006-!m\003o\200\242n\373{\350W\241N\\WV\220\224\256\267V~\345\367\203\026b\251\001\032\001"
+	.string	""
+	.string	"y\204\342\002&U\241\202\037\"P\255do\271S\n-"
+	.string	"."
+	.string	"0"
+	.string	"7]j4\371W9G\025z\\\016\204\254\2534\270\225\340:aJ2\210\324X\004!*\306\200\207\335uT\205\253{\3366\204\355\006\333\272\247\270\263g\250\250.\373r\265e?\372\263\240\006\267z\310n\027d\027`m\023\006\305\366;6\3314\237\301\026!\346\344\303%\267\273\237\276\00229\233\370rs#Qu\351\023\274\353\001m&\025u\266Ig\311\020\330M9\370+\227i\370&\237\346(\305\253>\375\222\367y\355\210\325"
+	.string	"\310\002\016y6@\320D\350C\001\372,$>\025_hD\372<\n\006/\"F\037\006\b\216\276\316\354t\271\332\342\274Fl'EIu\211<\232h\001\266\273-O\211\005\021"
+	.ascii	"`\2517\023\032\200\002cx\r\343w\004\321X\t\313@\270I\310\002"
+	.ascii	"\305\343\357\007\001]\303\355C\360\227q\305\245\213\331N\274"
+	.ascii	"0\241"
+	.text
+	.section	.gnu.lto_blackboxStart.160.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\314\001\375\020"
+	.string	"V\235mH\340\262\2521\220\326\002\023\230P\213\255.\200GV\336*\207ek9X$\217\326\275c\226\354\333\350\223'\254*\304\221{*\225\327\255\310\220K\340<cU\220a\0067\030\213A\353@lx\310\270\214\242n\032\221rK\231R\\"
+	.string	"Q"
+	.string	"]"
+	.string	"D\003b\256kA\220\206\330N\357\336+\322\021\255\331\372\310V\220\316\226\357\372\210dskR\2131\342\200Q\332\274\202$8 |a\211\001,@\203\027\273\355S\246\214\231`\251\2549\005Gj\210\340\021\22600\301\007\241\032"
+	.string	"\3458\347\310t\357\365$K\232\233t\333+\266\025\330\323@-\363d\213}\265\364\271\203E4!\337\3555\1776n\234Tf\377;\026\261\024\246868m\351\364\303\223"
+	.ascii	"\232\221\241\371\314\307\2753?!\227Wg\224\260}\037"
+	.string	"\367\334\313u\\\252\365\250x\261\277\3427\230\353\330\244\346\023\276\3320v\370:C\267\354D\244\331\335po.\202\327\337^\342\331\335\370~\270\346\020\357\310\320\343Fu\261\247(\235\016\221iKH\241\267=\300\256f\2027R\027He*\373Bu`v\357u\361\023\264\241^\0202D\217\244TFO\300Z*@\227\0036\213\374\234U\276\263\"\335\013c\340\353\336\242\202\237\363j\226N\225\\X\241T\251\323\004\224H!\345\244\"\246X,b\t\211W+\021X\242\205\325\212%\206\270\327M/:\216F\246\355\340\301<\351\333n\032\251k\b\005\207\037Ke>\367\201\036\344\002\341\344\304\276\2066h=$\220\243X\377\347;\024?\307\247T\312\2766\350\300\343\363\360\232?\031\001+ `\2021d\327\003`\352\311\003\302pea/\005\"o\357\027m9B\323\330\270-F&rh\265~\247\307\255\350eAu"
+	.ascii	"\303\300)I\353\212\r\332\254\251\333\222\370J\022\340\020*x\371"
+	.ascii	"\354\355U\226\245B\215\216\356\002\236%\312\341\276\215b\344"
+	.ascii	"\264\221\003\302\270\215|\334+\224\0377\017\207C\200t/\276}P"
+	.text
+	.section	.gnu.lto_blackboxFinish.161.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`e\001\345\r"
+	.string	"\306XYD"
+	.string	"\2216\035\344\204\016\234\351\206\312c,\275\335\034{\347\266\205\225R2\006!P\357\332\035\034\3623m\246\262\337\214\202\216\274Lw\235\304\330\312\245\371\336~T\372\275&W\360N\f\351Sz_\210h\223-S\nB"
+	.string	"C"
+	.string	"H"
+	.string	"\326\247}b[\237\267\374\261\305\203!\266@\b\003\203\211fw/\t\342\237OJ\352\307?\351"
+	.ascii	"\270N\373\3548\265\3516\\\206\266\252\343\013W6\335\005\251\033"
+	.ascii	"\234\335\265r]\312]\3356\210m\005\366[\004\366\301\213\310|\026"
+	.ascii	"W0\321s\237\276I\365y\t2\343\302\203\021\201t\264\301\220J\025"
+	.ascii	"\373r\034\307\031\226\037lU\177\343-\036\212\206\224\273\310"
+	.ascii	"\354\242\2144\3664W\270\330\276\017\363\322\311_\274`\3054\332"
+	.ascii	"\335\245s6\251\371&n\216\2465\376\205\037\013)Ul\373*,\"\250"
+	.ascii	"\021\021xV\2358\212\247\260\230 F\024`\200\351%.cQg^x\034\236"
+	.ascii	"=\253>\225[\217\223\260-r\354j\367\2669:\275\214\326\303z\034"
+	.ascii	"\330\264&\356|X\300D\036tB \210\\\021FBH\256\216\247\344\372"
+	.ascii	"0`LB\003\317E\001\303<\227\005\202N-\351\317\320\322\341\004"
+	.ascii	"\222!?\206\232\002\324v0\"G\374\2443\220\001\322\304\320\360"
+	.ascii	"\013Y\250\215\372$\325\307c\225_\232P\242\347\374# P\202QFU\017"
+	.ascii	"`\324\023\207\206K\304[\0028\\\370Q\306\304\207x]e\354vZ\024"
+	.ascii	"\025^\335\363\262=\263\305\373B\252\017\337N\201\335\031\215"
+	.ascii	"\237\006\016\257\3706h\315sKC[_h(\341g\017\013q\275b&]\264\235"
+	.ascii	"!\343\360\2523\3532E\006"
+	.text
+	.section	.gnu.lto_startInTestMode.163.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`g\001U\017"
+	.string	"\306\\hG\360\260(\035:R\302\376Q\337\372{\257 \341\n%\317\260\302\227C\337\241\234\366\276A\3162cn=\265\266O&\374Z\306X\307='\337\370\r\316\020\371\220z[\314x\305R{\313R\2044Ye&\232l\"wJ\001V"
+	.string	"O"
+	.string	"S"
+	.string	" \252\r\033\324\\+(pv\327S\0217\235\233\233J\223\037@\f\317u\036>7\003+9`\036\242jK\200\023\312tD\025\271m\013\\.:|Tm\037/B\334t\304\224\324\216\250\262!\330\335\307.YD\224\224\035\237\335\265\\\211\255\273\343\266GlG\260\357\022 \\1\037N2\307\036QR_\366\267\325\026\373\263\273Si\225\322\007pX\r\026K\353%rvY98\266f\312\300|v\373&\374\3611\227\231>K\021\2600\366\342M\315e\306\356\310\340\323\236\356\323\343?\270\317\356\004\270\317wl\262e\004\253N?\276"
+	.string	"\r\330L\215JC\327T,\022\233\276\254'q\252 -FJ\336\370\nR\267\233r\340\247\270\212\317\177\3714\206R\211\373T\3350\242\205\r\231\334\335P\365e\024\356\032\242\331\244\344\r\373'NC\361_\234\341D~\365\351\237\350cW\320\242\t&\3407\241\244$!\204\344\001\204\220\021\b\262P\002\261\310\243\341\013\215\210@\027B\036\211\b\210\344\211\300\222\3479\340\257d\004z&\337\007z\235\361tm\361\347\244(n\200\264)\200\344W~\354\037\224\206g!\343\020\316\024\256\323y\242\201\241\331x\310\177\304}\357\031\316\256 \"\037\033"
+	.ascii	"5\263\007K=\231\001\353\034\242\365\022\336\3666C[ \212\304\n"
+	.ascii	"A\210xP8\016\267\357om\033\"{$\310\271`\3430L\b\256\211(\231"
+	.ascii	"\320\272\260\227U\226\227&\200\273W\205\320-a\\P\341\267\253"
+	.ascii	"\224\001"
+	.text
+	.section	.gnu.lto_inMotorTestMode.165.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`y\001\225\017"
+	.string	"\326\234hG\340\320(\035\310\220\233\351\032g6\214\2527\275/\270\024U\321\365\364\222"
+	.string	"?!\360\274G\375\345lX\301\\\f\360\333\275\0170\356\331\260\bi6b\2141\306\020\212\201L\307\"Fy\274\002^\255\273\305\376\336[\312\224\002Z"
+	.string	"K"
+	.string	"U"
+	.string	"\366\207\023(`\361\212\200\013\313\006\002[\217\353\004\2169g\334z\370\3522\302\325\225\317\272T\241!\242\305\0054\267\230\030\265\227\206C(\"\264C\004\002#\302\373x\265\350B\220\237\230\031\244\227\013\024\211\261\310p\233\353\313\253S\035\221\3149\255\336\013\303=\272\355\023\333\007\354\363\0047\307\221\340\207p\312\212\336{\364W\344\343\3676\017\031r!\213\335\300Z\372\3313\226\356\214\375\375\276\357\363\312\330V\227VM\262z\004\325\022\252#TC\250^\253u\325\027\020RbF\3427x\346\204\371\212\246OTQ\243z\233%9\f(\234N\362Q{\274!\003\026\216\222\273p\367V!\326\351\347"
+	.string	"j;0\321{\273\nT\263\302\247[\226]\303D\013\030p%u\025\004-\b\200\332()\275\247{\016\262nY\327\235\333\217lw\3067I\222\307\013\032P\213\352\360o\222_\322Z]\260\356\001F\215LH\225\234\240N\017J8\b&'\024\016\245J\341F\n8\025\241\201\212SI\245T\334l~e|\0316\032.\235X*\262\005\345\350\300\177%G\373b{\264&im\007\347\234S\312\215[\332\273F\324\344\232>\300Zq\007\324v\244\310!\264\027p:l\210p}\024\017\037"
+	.string	"\263\312\371\256\213\253Nz\260\256A+N\310\315!"
+	.ascii	"\202;\004W\262`\306\202\005\260\2220\315aa\2259\257\314\354\003"
+	.ascii	"\253P\245\334U\013\\\230\\\231\316\257Z\026\245VY\\\030!\306"
+	.ascii	"H\360\366\252\240\0034\222)\227VW\263\254\271\007"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.166.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`7\001\265\013"
+	.string	"\206SIA \253j8@j \t,A\205\273\217|S\274kE\243'."
+	.string	"3\303\242\326\006\bu\343\037\203\221\235S\366\360L\273\355/\3679/\004 D\352"
+	.string	"l2\236l\302\271\2360\212\371\320mo)S\n3"
+	.string	"2"
+	.string	"8"
+	.string	"\273)c\207\245q2\226\355w.\331\031&N6\324\230PC\201m\330]O\007\274\364,\371?\360\213\210\n\237\017\035\273\353\024Q\251[o\373\302v\306~\205'Y\316]3F\n2S\216\336\322\261{f\261IJ\362\2421X5\332IC\333\025\246\n\260\277\255\252\354\247\267\247\365\351|\372\235D\200U\352\255\013\001\033\013\316\340\353x<\226sjA\324`\312QAL\365"
+	.string	"V0\016\2319\354\225\212y\251ty\265? \213\223\206\230#"
+	.ascii	"!v\227\303o\335\025\362W\347<\"\345\305s\016\3764# \347\363m"
+	.ascii	">8\036\210\307\006\344}\242\221\247\2510\030\322\021y\" (\362"
+	.ascii	":\327~[U\371R`\205fR\023o:\223\020\001\302\203-\201\001\231\252"
+	.ascii	"\003\220\202\2007o\020\212\300\260\273\001\" \260\002\031*\365"
+	.ascii	" \325\033\021\372\273\030F\002s\3674\030\207\230p@\001\224ql"
+	.ascii	"L\021\254<\202/\374-\204\266\347\215%\037\330d\366\334\301\274"
+	.ascii	"\211\217\264\356e\216\341\333\221z\220\360cA\207\204\2021\023"
+	.ascii	"\265~\320\357C\200\323-\332\365\004"
+	.text
+	.section	.gnu.lto_writeGPSFrame.167.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`U\005\245\034"
+	.string	"\226q\256G\220\232Q:\004\310Ku\2769\355_\347Y\222\350)\230g\001\342\322\312r\245\367\024\020\221\227\277\005\331?6\332\223t\257\356\266\236\273\271:\325"
+	.string	"\320$\317\363\353\312MX\207\357E\236z\360\305\300\336\332\376\336[J\231\002\217"
+	.string	"\213"
+	.string	"\240"
+	.ascii	"|*\371s\362\245\344\267\344s\363\267\b@\024\215\033K\345\252"
+	.ascii	"\326\247\342\234\3525\265\216|\241l\024\026k\365\005B-\264\235"
+	.ascii	"?\213\237\266si\377\227\377}\262S\343R\271\270\254\326\036V\262"
+	.ascii	"j\265\272\335(\266\263\300\332\350N\271At\347\307\177M\200\027"
+	.ascii	"\225\211A\227'')rj\255\270\006\262\343\312\346\361\273U+\003"
+	.ascii	"\006\231V\342\330\226\t\330`\211\323\023l\222\266'#\300\255Z"
+	.ascii	"\236\021\3741\303$\324Z\317\300\340\215\375\334\377\025\376C"
+	.ascii	"\370\347U>.n\220/6Y\375\035%\352\255Z\206\3121\204\307\0331g"
+	.ascii	"\232\370\353\\k\335\003t\250\211z\235\240~\\\374w\312^\355\276"
+	.ascii	"\302\213P\342\005\356\374*\321\235C\275Q\026\001\024\254\341"
+	.ascii	"\216)(\037\027?\343_\355\267\350\277\304\343\005\036A\224\022"
+	.ascii	"\257\246f\372\255~\334?\376\225\265}\374\222O$\371CK\265+\200"
+	.ascii	"\362m\224/4\371A\222\017\004\343\377H\276\017\214_\223\374\036"
+	.ascii	"\312\347\241\374\035\312\247Q\376\214\362e\224\037\243|\030\r"
+	.ascii	";FL\030\031\227\024U\021\307\372\037\227\214L`M;\326\267+"
+	.string	"X0\271\b\303\217R\373et\342 \b\327v\215Sc\325\204\tt'\254#\230\321\362QX/\271\242\341+l\227\243\241\341N.\264W\207p\013\321\306S\366\354\233S\035\237\205\335B\312\262Z.\034C\006^`\006\272S\366\346\020n\221\2226\356\3769t(\300-\240\273\027\013\006\222\237\207\315\3325\370^i\361!&\\Awr\257\0243T>.\336\026kE\254\326\372\340[e\255\200\370\nw>I\247\243;\267\251\r\341\026Q+'6\354\226\2244\240(\261\353\365R\350x\2563R\301\0131B\227D\"\004\256\204R\322\022N\327;\2013\"p\236\211]\017\207\202\307\353\341hV\276\225\265}\\\246$\350\345\353\337m7\256Ac\006\313\210\301N6\242P\363\213\334\200\037\3344:\251\r\371\247\206\0023\345\024p=*\032\026\205z\243\204`\244\250\202\200,\035\244\332pNw\001\335|!\021\203\276"
+	.string	"\3754\220\220\215\003\347\207\350Sk\037\"\353f,\022kS\353\222\352\341\351\236\331N\363\364\204\003\243\311\357\310\252\311\031HsD\204f\247w\207\220\213H\233\265\254i\3032dfc\222l\250aP\345\02036#IAQA\322\001\240\002\021\231\263n\021p\251Q\f\t\215l\314\032\240A\323+\002\031\230Q\026l\221j~\005Zl\226\270\261S\3412\3421\241\013\3439\323@+\003eB\202\334\275\245\341\202\316\317\333\273B\220~O\366\346~js\236{\tK\354R\177i\301\2618\344e\330\312\244/\347\025\243\317<c\266\311\022\260`:*'\206\373B\240}\364\332\217\371OO\257\345\023\177\207\n\351\274\r\023\356\333\363\240#h\253\001"
+	.ascii	"\026\316\261\245Y\003-\355\350D\325\203(\317\f\223\341\303\261"
+	.ascii	"\306M$C \300o\n\330;\\8\222E\033#d\371\222C\007A\337\233\023"
+	.ascii	"\352@8\357(T\033\363F!\325\266\206\351W\242'\246\372\345\221"
+	.ascii	"\346\"?\205\\j"
+	.text
+	.section	.gnu.lto_loadMainState.168.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`p\r\355;"
+	.string	"Zg\204\026?P\246N\007'\360\337\370\324\337\377\n\225$\006I\217F\177\251\252\364\036\237\302\017\311\016\375qUka\215\366\006\023\210h\232\350\211\026\3676\322\245\0363\331\017\337\217\234\020OH\310\336[\246\224RU\001=\001X\001Q\207\204\254\365\335\340\272\026\031t\264\346A\367\226\335\354\306\353f\323\255\246\333\256\233\331}\246U\346\326s\313#r\307\007d\215]\323p9\033ei4\334i\230h\307p\0309\355\244\0206\2126\231\256cb\2316s\373\f\017\246u\317\332j}N'\340\2722=0\205\355\2242{\364\272\2666\020G|K"
+	.ascii	"\327u\315j\224+\b\033e\346v\346\016"
+	.string	"\323bn\323\371\340\341\272F\271\323[Wf\003v lt\252\241\322Fm;\245\215^fB\002\312V\261\b\316\274\263:F\353\272j}\025f\241p\311ZK\374\177\241\2656\345o\313l\266\351\355\342\222R\022\021i(T\231R\264\311\276_\356\272\266\310:\177\216jb]\264jY\021,\275'\315\211\235\020\b\270\327zL|\251I+\351\265\345s\213\213\262\326\244\223\336\362\232JK\332\022'RQYsk$5C^[>\"qQ\326\334z\330f\037\334\235\271P\315@eMI\253=\246\244\231l\222\237-KzOZ\322Bh\273\363\323k\312<E\212C\322\250\020I7Y\246=iV\354\003GS\373\3416\316H\177\247i\024\211\367wT3\322\256fX\327\225\375\250\266\326\f\240\231\233\t3\253`N\372\n\335D\231hnO\210\210C\037R_\350\241\013\001\376\251\317t\320\207\026\204~\n\242\375"
+	.string	"\365\241\210\346\254\037\021\335\347\337\222h>{\364\374w\034\345\337\223\316\037O\t\253>f\023}\007\205\260Q\003}4\324\357o\005\315\356\244\350:\334\334\352\223k\276\025\021\222\316\246\303\202[\270\360>\272H\033\355\217\243\374\233\243\033\363\301\357d \240\336\363\203g~\321r\272\204\353\272J\340\216s\237xE%\225<\322Fu(\007=\337\306|\220A\277\341a\241o]\327\t\334{\355&\006\267\262Q\2261\303\373\330(\367\214\264Q\255\017S\nz\356\215\371 3S\314\037\311\334\023\222\201\200\374S\230Gt\340\322\200\241\231\315[M\327\375\240\3174ku\263yA\3435c5\233\346\253V\323l\325v\315U\252\263\202\241s\002\324\231\nu\236\032:K\251\316\b\254\363\001\241\263\001\325\271\200\352L u\036`\235\005X\347"
+	.ascii	"\252sT\352\fe\235\237Tg\247\324\031\200unR\235\231\254sQu^J\235"
+	.ascii	"\225\254s\222\352LL\235\221\254\363\020u\026Zg\025uN\2553\212"
+	.ascii	":[\353\374\250\263[\347&\021?E\326\354@~\"[\3271\005\001^\200"
+	.ascii	"\226\013\316|\313\356\231\3671\300w]C9\345\332\362\374x\261\341"
+	.ascii	"#Y\245\243r\375\3731e\365\325\225\360\352\271\276\210\234c\027"
+	.ascii	"\245\305\337\356\322*\031\304\335.\033\324G\275M\364\004E\301"
+	.ascii	"\257\206\334\"\336\307\247\357\273\206\"#\307\226\207\354\305"
+	.ascii	"T&\264\303\277_SV[=\032\303I\255\274\355\316O2\265\372\016_D"
+	.ascii	"6\3618=\222\273\264\352S\363#\227\r\300;\275\025l\002\300\305"
+	.ascii	"\327\270)\3644W\273G\222\334\266\266\264\321\246\3575\215jQ>"
+	.ascii	"\232\333\363\202>\222\273\351\247\260J\347G\374\373yVW=Z\203"
+	.ascii	"\256\372\2463\343G\346\201\255GJ \246}d\325\217\370\"\022\357"
+	.ascii	"\317\254\311\017\037d&\"n>\344n)>\323\333>h\334\214\300\304\217"
+	.ascii	"W\f\203>\007\342A\256\023(W\212\224\264\321\342\267\236r\321"
+	.ascii	"s\311\315\356\262*\211\3642\245_z\333'I\311\307\270\211\225\254"
+	.ascii	"\342bWL\204A_\257\225{\345\302y\037/\\\332h\322\367"
+	.string	"\233R\321\334\036\361\005\357\262*\256\035\335-HO|;\350\354\221\225\017\237\371z\271si\037\221~\212\354\305\370\311M\254\013\246\031]1[IE\275\350\216a\326\260\301\373\270!mt\370\0012:\314\206\027\030X\216\r\3050\0339\2766\200}\205}\325@\302\201\302\253\206\214\023a6\274\300\300rt)q\227\203\035_0ft\275\240\001C\313\206\214\0275\264\272\300ph9\220\342\257\033^`Za__`ZD\346\332\023\222\201\200\375Sx\350\245-\317\330\377`\005\237\346.\017\330\271\235\361/\352\005\275\214\327\231\3613\306?5F6l\322F\321F\025|\277\301\341y\356%\300s\346\333i&\370\007$\267\210\252\215\213\371DGCF7\016\246\204\317\371\027#\0349F\2473m\224\352[\t\034\234'\335\024\237{)1\250\004\036\243\036\357\343\324\333\247\\\033\251g6\362q.\306>QxGC!"
+	.ascii	"\031\003y\037\245\236\234rc\212\217\344\241\237\022\206\177\277"
+	.ascii	"\244\254^\260\365\013\352\330\245\005\217\341\235\352\234x\020"
+	.ascii	"|\334]J\031\007y\026\343\337\201G\360\326\216\331\035,\216\205"
+	.ascii	"\233J\2073\026:dLdL\2246z\340[/o\356\355\344\224\251)\031\370"
+	.ascii	"\255o\301\263G\\\316l|\032\033y\037\r8\351\221\353\222\204\244"
+	.ascii	"\341\337o\230\325X\217\346I\032\213\210\365\032\026\2315)\360"
+	.ascii	"V\356R\252\317(\350\311\313f\355dq*w9\305\221\227\3158x\305\304"
+	.ascii	"\322F\013|\3475\312\005\316\356\211D\300\201G\271K)(\227-j\300"
+	.ascii	"\023x\013G\300\200\201\004\250A4\004\025s\206DfD$I\222B\007\361"
+	.ascii	"\005\204\030\347\034\231\007\021\020\245t\016"
+	.string	"\315\0043RP\220\324\352!\246S\260B\005\202:\240\025\023\031\343\327\213$\311z%\f*\201Vp\221@\300\241\317N\255\202\201|u\207\307\315\320\311\206\004\214>\367\366\200<+iv\277\334#\371\320H\030\220\236\222\311o\037\\P)\004\354\033\370\374\023\303\363\3669_\263\3038\303K\2227\227\370u\373\270\320\215G\307\021\263&\034Z'\244f\005\341\036J\326exl\261\235\262\204\0264>+p\206\372B\364:\376\030\241\344\217l\354i\205\212\240?7\254\233\360\206\210\242\305\231JP\006\001\211\361\030\002\300W\261Vvq\224I\306`\346\325\025x\265\224\033\f\211\322\003\200pz\013|G\215\257\350\346\315^\243a\371:\t:\334\201\017L\355\342@\3618\360\303m\205\361P\311\021\350F\373\fG`>7\215;\354\231&\261\364g\214\003-\317\301!Vq\313\257\345\006k(\343\013=\362\002@\027\215\317"
+	.string	"\235k\226c\201\231\251\313\351[Yt9L\234\336\202{X\365\356y\356\277M\337\177X\365\356y\356o\220\277\377\260\352\335\363q\361sb\247`j\350A5"
+	.ascii	"\006\273\035@\026\250\370\372\330\347\005\372\005\033`!7x\242"
+	.ascii	"\032\312]#j\211\355\"L\222=\030\370\370[\376\267\252\360\"\r"
+	.ascii	"\002\001|\020\244\223\370\245\342\205\237\274;\0076D\260P;\260"
+	.ascii	"#\367GA\203\031FP\336\016:\274H\254\302aV\365\3125\226=\ny\253"
+	.ascii	"\325V v\t\334\305\243\2406Dz\235Xx\356\2030\222\352\202\203\320"
+	.ascii	"\272\033)\001\017\022 \b\313G\340D\242\351\023\221c\325\033p"
+	.ascii	"\200\2156u\013\025"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.169.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\206\022\005]"
+	.string	":\235\340\"N0\320\332\031\003\325\001|\301\fu\177U<\243v`M^f,\227M\246[`s\276\n?\253]\301X\0051\370o\365\306\\Bp\363\377\022\362\303\300xry\020\f)\275\365\\\007\007\243W\265\344\231\001"
+	.string	""
+	.ascii	"fB\377ko)eJ)\005\036\002\342\001&\002\3351tO\351\316k\034o\275"
+	.ascii	"n+Md\356\277*\267poS\342\272\217{\013\027\375\264\222`\322\267"
+	.ascii	"\207\3619\230'\r\344\333\253Q|\206\221\276Tb_\341\246r1\206-"
+	.ascii	"0Y\244\020\261t\026\346\"s\365\025\036\322\235A\342\224{\337"
+	.ascii	"\267\310\305\\l\366\231spS\351*\375BO\271h\245\002\344[}\033"
+	.ascii	"-\216\252f\314\023=\246\344\230\364=\273q\322\027('\250$\317"
+	.ascii	"+Jl\007\002\324\302\023\332\246x\255o\232\364E\033\222\005J\345"
+	.ascii	"B4\313\235\2067\245w\260Rp\204\220\243\237\264]\216\206\302S"
+	.ascii	"\266y\337\265\300.b\263\311\265w\332&,\346\352\3553$T4cf\254"
+	.ascii	"\316\334\322n!G\323\261\030 \344;Vw$\357}\245\"8\001i\367\264"
+	.ascii	"\315\022{\247\215\016\242xo9\r\370\337\327\351B\336\373\276\""
+	.ascii	"\370\211\330,\211\0239\330\005\"\003\253a\004u\220\351D\360}"
+	.ascii	"\245P_\002\033\271\333JIHGI\243\016EDCBA@?>=<;:9\310\243\221"
+	.ascii	"\003N\361\306\2068l\331\365\335\345\006k\245a\324\r[\237\\\r"
+	.ascii	"khx\235t\327HwR\374h-A&(\244\253\315\273\025\007\r\223K\3035"
+	.ascii	"\243x\262\253M(S57\"\001\215Iw\030F\025\3155\221\234\017-q\241"
+	.ascii	"9\270\246\022\017\232[\223[\2228P\264\177\252\315h\3035\337"
+	.string	"\334'\216\017\352=<Gzgm\032S\345LW\233nkO\017hY\3035\215\270\316\212b.\256\255\253M\023\326\247\263\303\222\323\326\31066?\362\365Q\265\031]\223\306\325\311K\nA\272\332t\256;@\360\274\364t\210sp&\215#\244\213G7\303\2505\264\020\332\246\332\f\002\304\211\035\206\327\303\264\342\031\323\333\325\250\310\220A\343\331rMR\375\230M\355#\270&\236\263k\223S\213\007]m\nY{\266\2140\003\231\257\036\364\033\317\304\326\344\373\276=m7;\033s\037F\275\357\313^v\206\326\274\324\314\216\306\334C\346\343\226n\243\202\313\202w\331\315'\245\336\346\207O0b\212\275\325\022_\352}\272t\016\237\370\303=&a\222\267\317\354.q\347\274\313\206\337iD\030{0\013\332\006\227\t\361}\307\006\340\036\3235\260X\245Z\264]\326\242m\266}\001\350\314\2709\347\364l\002\335\340\332\1772"
+	.string	"\277~W]\337\213\246a\213\030f\375\246\366\252\005Je0\032\346\205<ek\"\260\377\344b\225+\2776S\353sW%\352m3\265"
+	.string	"\274\331S\377_\325}a\206\321_x\352\303\234@\007N\365\260\275\357\033\200\227\006T\200\333\255Y^\200\312\273\214\252m\366\377\001(\225$\321\260\365\237Eu\200<\2765hY\374\207\2251R\007f\314\321\260\177\324\212W\361\376C]\002\355\226\375)\276\2730\t\303\274\220Q|\001\337\337\323f\321\034)\254\003|\262\202\230\0272K\305\374\237\314]"
+	.string	"s\312\031\177\021f\243s\226\321\031\313\350|et\266z\347\031U2\214\316\r\264\225\346\030\354L\325P\272\247\336\031\306;\277xg\027-\327\335\242ch\226\352h7\213\236\322\034\325R\272W4^\267\212\316kN\321t\335(\272Iw\001\357|\202\235M\264_s\211\336k&\321z\315"
+	.ascii	"\030\235G\030\235\241\214\316O\357,\342\235\235r\234C\274s\323"
+	.ascii	";\203xg\246w\376`t\366\360\316K=\316JG\347$\2433\022;\037\275"
+	.ascii	"s\362\235\215r\234;\3608\027\3618\017!\235\205\216\316AFg\240"
+	.ascii	"\035\347\037\035g\037\326\271\007\351\314\203t\336A:\353\274"
+	.ascii	"s\316;#\337\371\370\316\306\2433\216\321\271\230\343|\363\316"
+	.ascii	"6Fg\"\322yxtn\337\2315:\257\357\374\034\234\235\203s+\241\370"
+	.ascii	"\352\376\232P\323<\240\364\355Q\250\346\365c\365\336\332\257"
+	.ascii	"{/\305\247\340\rLB(A'\b?\377t\333\345\321*}\3031\035\211\313"
+	.ascii	"C\351)x{2H\200'q\340\366\240B!\351\373\2047'>HoP\244\037\256"
+	.ascii	"\251)\342\234\213\366\270\255\021\013\240\204\202e\302\274\260"
+	.ascii	"\355zl\211\302#\200;5O[f\327\207\373\201w\031{\224%7p\225\307"
+	.ascii	"\025\""
+	.string	";\377d?\353\243\022\216\236\001\350\232$i\311'\2117\372\344\bFo\263v\203\237s.\255\r\b\013`t\250g\216\3375Z#3\352\024\244\214'\361fg\272\303\367\032\211\016\357Q\226`\361\033{\260\234\242\227\301\266\003\355\320\027}\013\375\320\277\231 \241o\037\356\017W\013\200]\210\216+.\220\n\332f\203\276W\200\322\220\244\325\206\364\251!\375G\003}\257\325}\361 @\200\276\371z-\003\r3\030U\302$\272\344\270\325^}\222\037)\020!\363\007\306\352\033\370\253of\332\007\016\302V\b\256\232Z\333\254\325{hK\233\361\r|\377\274S\317\370\316\322,\034\220=1\300'j|\376\347\337G\fw\b\321\315\347\333,\b\317\257\370\236\037v\211z\235\347\371 3K81\327\313\262C\315\3308\332\025\377tgX\250\373\262\363(>\306w\230%\222\024\257\363;O\324e\t\327\364:/\364\240]\352"
+	.string	"\355\b\377O\006:(\034D(i\262\003\347\237\3547.^\351\016\213\323\346\305\237x\263\226\275\2077\335\t\\\"D\332fe@\371\342\312\344<\007\276\201\23395\362s\376\3278\017\337\341L\344?"
+	.ascii	"\335\033\214\036\237\254\313l\200\361\306?~/O\3600\027\253\301"
+	.ascii	"\355\306\356\b\356\323\335g\333\254\361\215\332\322\234\034\347"
+	.ascii	"O|k\361\327m#\276\357\262\313\\#\304e\323\360\301=\342\276y\227"
+	.ascii	"\301\370\344\362\301\326b\213w\3417,\376\305w\277\023\317\314"
+	.string	"\346{\253-\276\223P\3077\346hh\264\23248\377\200mza^8(X\374\034af\2708\347\242\355\\\032\b\304\1776O\225 3\f\377\351\242\320\336|W\035\030\017\001\234\265\364\034A\326R\025\313\004x-%\261\226\222I\004\216J\0346\254,`\225\\1\274\224_\030\\\341\334P~}iu9\2404\200+\206W\227\025\r,\244\004\312\254\357RfY)i\024\263\220\312,\255\256/*\244\324\361\346\353\006\016.\251\033\027Y7\270\260\224^=^7\270\264\276\264nhI\240< \313\206RK\002\244\325\227\re\226\261\313\212\206\224r\313\252\313\005\007\306z\272\200\353\252\006\226\225\215+\250\033ZV[PX]^POF\314E\201\262\013\352\213\213\253\013\252(\r\353/\302L*IT\037\001\324\316n\350n\335\324\266q\333c\263\243\302\372Y\2330\361\034\025\366b>\224\3769\342\251~\2352\343"
+	.ascii	"\267\210^F<\004o|I\377\344\302S\237\277\251\236j7\337\264\b\226"
+	.ascii	"\201z\277\255\036\266\276\356\255\366\351\241\376\315h\241>}"
+	.ascii	"\2147-I\242\002\370MG\211\366\211x,n\327h\235^\304\367\322i\305"
+	.ascii	"\3513x\303\222$m\214\037\023\351\237\034\342\035M\335\027\247"
+	.ascii	"\016\361&\356\314\344\r\216\031{\260\206\301\t\341\321?\271\345"
+	.ascii	"\366\2440\251\0305=\373f\354\003\375\220\201\b\231?\"\017\346"
+	.ascii	"\342\222S"
+	.ascii	"\337\364\016\255\3232\346h\252\360\364'0o\312"
+	.string	"'\220J\323\377|\211v\257\357\373\276F \\\340\251\n\274\251\024wL\017\342\201\326x\024\236\252p(S)\354\230\240\350\316\2609\347\242zN\226\bv\020\252z\007\252\372!\217v\321\035\031>\"\234\326j\211\356\310@\203\252\276\304\233}\370\256z\023\035i\224t\254!.}\254\304\177\370\233\347`!\2230\254\350\237\254\037\236\021\242/\222\225\324\301\017@02\177`\230Z\254\317\222b}\3775\210\026\\\bt\316\245\025[H\233\016i\265U\317\352\251!\303G3\230\241\n\375\223W\207\353?\2731\\\202\232K\263x\226N\215\0308\227s\2078\005\262\216B_\342\2025\353\201\255\352\211\276\350\025\026\026\026\366V\213\364\036\276\2674\261J6\210e\351\024\003r\362\245\357>\217s\305<\260\221\021\227M\310I\262\007c\245_\372\201s\250\221(\345\020C\n\221\214\210$I\222\346Q\005\304 &%$;\021"
+	.string	"5\210\240\232\0311I!\035\221\016J*1a\"\300q\\\342\275\246\233[_\006AG\371b\351\354TP\322\035h\360?x\020}\302\311\034P9\213\240~\214M5_%\311B\267\217\024!0\231\2502!\006\316\274\306R\223\324\b\nH\2407\016&\211Iy\257Y6\246\001\031D\345\230\375\r3hrD%\207s\274\035\270H\377\367\007P\270\201\361\025\037! 2\220{\rbx\364\320\214\204\360|\246\262\326\3062\370F{\214^\t\177=H\306\3757E\n\245w\016\212y\333\374f\210M\350\341\300^\311\310\027\005\212\315c\032\177?u\360JZ\f\023\2436\232[\016\372\022c\270\234*e\036"
+	.string	"."
+	.string	"\037\304\307\325\250%\272u\024\303A64 x\271\345Z?\327\343d\332\326\277&&g\302\032|Rj\347\304[\210\357R\320\200R,\344\357T\200\301/\266hV}\340\247|X\034\222\246\354%\276R\363Q\b\020.\241\273+\271\027\202\213z+x\315No\225I\b&\276\357ie\262KI\246d3)\377\024Y\254\341\326\370\252$\032\345@\240>p\340zZg67\334\027\304\361\220'\264C\325G\304\270?H\321c\206\343!\2321xv\206z\244z7\206d\007g\360hjk~\200\t\021C\037\277\374\316\200\375-\267\023\353\r\025\274\307\007\251V\220\001\2108\340\324,#bj(&r"
+	.string	"\305"
+	.string	"+#}\013\356n\236\336~\201\376\235\221y`\323W\300\323\320\nc\307\036V\r\346\221\264p\306n\\@}\266\003\226_\336U\245=)\2721\355\f4P(2\325\2038\352\321\355(P.\025.\265\225\212"
+	.ascii	"\371\003\315X\271Ah\227\276+\232?\244\352j\227J\374\002U\006"
+	.ascii	"\353\260\260\312y\312\233\nl\357,\210\262\370B\007\373Y\207N"
+	.ascii	"D\366\006'\275$T\nW\344\\\036\031\"\245\001\016\333\0044P\315"
+	.ascii	"\013=4\372\351N\342\373\327\274\271J`\024 \322\320%\242T\202"
+	.ascii	"\220\300m\354&\003j\2131\037\243\302\277IX\030\254\317\356\317"
+	.ascii	"\333\346\314\324\3440)\022\214\207\tHU\246p\343\356\033\022\001"
+	.ascii	"\b\343\t\205jxs~\006\261\224Z\n\212B\2654I$\017Q\233;\276P\017"
+	.ascii	"\314\360\246k\203FB\244\336o{F\003\017O\203Aat.8D Q\261\332\202"
+	.ascii	"\310\353\337\240\355^n\355\253\361\357&(ziFV|\367\370\\5\343"
+	.ascii	"\244\221\246\266\210\325\341\204\224\b\361\223F\314ux*r\331\027"
+	.ascii	"\321E?\314=9l\013\212\204\017\333WE]\260(s_\333\213\227{,\003"
+	.ascii	"\324_q\203\206\221\240!L\353\340\345\267\333\212C\r"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.171.f60325d2ebc28b97,"e",@progbits
+	.ascii	"(\265/\375`\326l\r>\001j\022\206tQ\020 Gi\215\001\037\356\271"
+	.ascii	")\243\243\035\017\300\344\343q\364\20091\031\201\207\302\303"
+	.ascii	"\331U\270\314\274\274\247\247\313\375_\3228 j\020\261\337\300"
+	.ascii	"^\357\n{\fh\276\2149\001Kc\206a\255\016%o\016\313\272\224C\022"
+	.ascii	"\213\260\370\333VF\221$\245\224\002\255\006\004\007w\007\316"
+	.ascii	"\344:\373\322\353\354;\\g\327\361:;\324uv\245\327\331s\270\316"
+	.ascii	"\236\364:;\222\353\3548^g?r\235\375\371:\367\240\353\334\202"
+	.ascii	"\257s\007\272\316\r\370:w\033\327\271\331\274\316\375\347:\367"
+	.ascii	"\232\327\271\375X\347V\303:w\337\353\334i\212\316\215\346u\356"
+	.ascii	"3E\3476\363:w\231\242s\363\275\316}-:\367\336\353\334d\212\316"
+	.ascii	"=\346un1E\347\326{\235\333\352:w\336\353\334xE\347\276{\235\333"
+	.ascii	"\256\350\334u\257s\207):7\230\327\271\277\270\316M\367:\367\234"
+	.ascii	"\353\334r\257s\307\271\316\r\367:\267\027\327\271\337^\347v+"
+	.ascii	":w\233\321\271\331^\347\256\026\235\273\213\321\271\327^\347"
+	.ascii	"\346Rtn5\243s\347\360:wZ\321\271\251F\347F{\235\373\314u\356"
+	.ascii	"-F\347\326\362:\267\231\353\334Y\214\316]\366:7\026\327\271\311"
+	.ascii	"\214\316}\345u\3561\327\271\247F\347\026{\235\333J\321\271\303"
+	.ascii	"^\347\006+:\367\327\353\334^E\347\3562:7\327\353\334[\256sW1"
+	.ascii	":\267\326\353\334T\\\347\236btn\034^\347\226\342:\367\rF\347"
+	.ascii	"\216\362:7\224\242s?1:w\326\353\334N\212\316\335\304\350\334"
+	.ascii	"X\257s3q\235\373"
+	.string	"\312\350\334\322\327\271\227\270\316m\203\321\271\255^\347V\342:w\022\243s#y\235\373\210\353\334UF\3476\362:7\225\353\334SF\347.\362:\267\224\353\334D\214\316\035\365:7T\321\271\207\030\235[\310\353\334OE\347\016btn\247\327\271\201\024\235\273\311\350\334?^\347\366Qt\356\250\321\271{\274\316\315\303un&\243s/\275\316\275\243\350\334:^\347\206\026\235[\311\350\3349^\347N*:7\222\321\271q\274\316}\344:\367\323\350\354|\235\233\2563\323\350l\364:\027\271\3165\030\235o\274\3164\270\3166^\347\032\2563\215\327y\351:\023\031\235\225\257\363\004\\\347!\243\263\320\353\034\344:\003\275\316?\256\363\f\257\263\004\\g\037\243\363\214\327Y\206\353\334\363:']g\236\327y\307u\216atF\276\316\021p\235\217\2573\004\\g\031^\347\007\270\316\0160:7\340uf\200\353\034\303\353\274"
+	.ascii	"\327Y\001\257s\002\\g\004\030\235ax\235\017Pt~\341uv\241\350"
+	.ascii	"\334\302\353l\200\242s\001^g\002\270\316,\274\316\003p\235Wx"
+	.ascii	"\235\005\340:\253\360:\247\340:\007\340uF\301u\326y\235Op\235"
+	.ascii	"Mx\235a\270\316/^\347\022\\g\027\257s\013\327\231\204\3279\247"
+	.ascii	"\350<\302\353\314\302u^\361:\253p\235Ex\235Cp\235Ax\235?p\235"
+	.ascii	"=\030:w\360:"
+	.string	"\247\360\340\214\342u\306\361\340|\002\2043\007\257\363\006Eg\r^\347\f\212\316\030\274\316\027\024\235M\f\235-x\235+p\235)x\235'(:\227x\235%x\235#\030:C\360:?Ptv\340un\240\350\314\300\353L\342u^\340\203\363\210\327Y\001\017\316\"^\347\020\037\234\215\2573\b\017\316\305\016\316\037:8{ :w :\023\211\316C\242\363;tv_\347\033\327\271\275qf[g!\353\374\255\263\263\316\375P\022\312\306\352\256\320\005~\236\225\247\217A\300\347\027\226\313\223\006\353\266\322\316\334l\243\247\334k\252\224\255y>\237D\356\261\276\302L\344\033=e\026\r\031\031*\257\347\363Il\226\371\0063\261Ygfr\207\265\030\023\255\024\t\237R\030t\203PLp\233\345\366\352/f\203\025\365s\351\331GP\314\350(\363|Z\341\240YF\3416\013\242G\264\315z\213h\233\345\017D`\262\023"
+	.string	"9\216\314t@\007\b%[\363|ZI\361K\332\331|\307v\\\307a\030\f\177a:\236c9\216c8\366\302o\354\306m\314\306U\356\302k\314\205\3258\007Nc*\243\361\031oa-l\306Y\270\214\2610\031_\3411\236\262\030[yQ\202\213\026$\344\214\300b\205\n\021B"
+	.string	"\341\003\017:H\201\002\347\004\007\033h\220\001\006\027\230\260\240\002\n&(!A\004\020<\340@\003\f"
+	.ascii	"\200\304\002#\024\020\021\302\b\242\370\301C\007\342\360uoZV"
+	.ascii	"\370\356\344>j\276S\321EV\227\247\245\311\251\331\216\016\254"
+	.ascii	"\216\216*\214\234 \030\273\250\334\365\013\032Un\216\216:'\007"
+	.ascii	"&'\027'G\005'\027\365\242\206\n\367\006\207\347\246&\n7\327"
+	.string	"\006Ge\353\213\302\201U\341\250\272\274]\327\336\300\270Dp\242O\0134MM.Z\215\346\340i\321\265kZ^tm\216\272FE[\243:\333\242\206\247\205LTm\316L\r,\213ZV\231 \2260<\262\273h\330\334\0252\3240\352XX\3264,*\366%\310V\276\256/\002\243_Y%\370E\277\250\\t\t\266\350\242\222\220&\332\225\225\343G\355\242\032\241K\211\305\334\212-0\025[Y\"lQ\205\240%\b\202\326\365\003-6\017\362\250Z\324\016\264\300Rhe\241p:\352\024A\034\352\224\271\023W\352\024*\007\324)Y\033L\241\322\300\216*\345\232A\323Q\245P1\220Bu\301\0365\312\325\204\367Q\243\200Y\340|\324(\321\n>-j\204\002\007\244\032\311\232`0:%X\342\311\242ST\t\246\300\"\300\213NeApG\235\242z\300\216:\025u@J\260\201\263\250\324\225\001c\225*5\007"
+	.string	"\022B\020r\254)\362"
+	.ascii	"\022\2443a\0076P\273\276\341\307\023_ \304`4\nl\204P\001\005"
+	.ascii	"\220$9k\021\302\r\312\250\251\3510?\232\bG\370\310Z\352\033~"
+	.ascii	"`y\bjtH\324\270\027}\272\202\230\243>\315\025\261|\230\213>\201"
+	.ascii	"y\240>eu\370\360$\204X\215>E\207lQ'\301\227/\3524\347\266\034"
+	.ascii	"\325\t\354\306\253Q\247\254\266\305\332\211X`&\n\232\026\004"
+	.ascii	"I\222\263f\267h1\313\022\006\366\345\325\305\265U\345I\226\223"
+	.ascii	"&XL\256\244F\250\246\212H\021\211\202\362\021\355\301\203ii\207"
+	.ascii	"\216A\301@\3006l\376\326\360]\367\310\214\021\243g\245\233\223"
+	.ascii	"\213\203\363\362\346\226FE;\333\242\305,K\030\330\227W\027\327"
+	.ascii	"V\225,'L\256\244F\250\246\212H\021\211jc`:j$?\240\240Jm\fLG\303"
+	.ascii	"\246\034m\fLG\n AB\223A\b\"\tZ\277p\003\252\270 \037\232\222"
+	.ascii	"\204#\300$!\323b\355LMH\35670\236\317'\373R\023\220\346\236f"
+	.ascii	"~\2710\2676\230e8\n,\216f\024\373d\217\232R<\3254b\244m\366\304"
+	.ascii	"\373 \3175)!\321\315$-\007\337\\czI\316\206\231\233G\204\201"
+	.ascii	"\315$\200\034\260E\252\344A\027\270\3403\370\r\3304\255^H\233"
+	.ascii	"K\\%\037\263\246y\205\345*\271\027\250?b\r~\003'\302\2764\032"
+	.ascii	"|\307\351a\360\031<\021\2361\203\301\367\340\225\211\277\340"
+	.ascii	"\275\032E\310\267'\2746\245\360\224\246\226V\333\254\211o\261"
+	.ascii	"f\201\252\312\335\037XR3\214\021\026<\263SK8\306\271\365T\253"
+	.ascii	"PL/\235\231k\367-x\022\252JTH>\350\256E\365R\240\202\357\251"
+	.ascii	"\320\352\304j@)\236\363\251\367\244T\n\276\202o`KX\247\003F"
+	.ascii	"\030\246\331\345>\237\317\257f\230X\333,\005\357W\275\216\372"
+	.ascii	"2\023\361Vp\355L\276\305\332\263\212d\201ASW\342\331\031\264"
+	.ascii	".}g\362\r\205B\222\023\3169\267\306\232ddm\263.\375\276\322\032"
+	.ascii	"\210\241Y\251\276\240\374(\304\004pN,\025\256\345\255Y\206cm"
+	.ascii	"\232\271J>-\361\023\274W\267\b\331\232hM&\345f\232\260\332T{"
+	.ascii	"!}>\237*\232e\341\232\260Ks\255\332lkk\233-\361Mv%h\306\030\301"
+	.ascii	"K\240\346lr!\365\2564\347\022\034k\226W\275\004~\344#x\257B\005"
+	.ascii	"\333\310\201\200\340\254\371\326\302\332\204s\225\\\252\305\371"
+	.ascii	"\204c\365\"/8\247\365\223\331\223\236"
+	.string	"O\034\02507\351\232`\274\227 \370\004T%\375\021\367\232n\2630p_\212\017\220\215\371p\340\037\250\023Z\ts\200m\253\357C\003_N\254\026]\316%8R\307\301\3007\360\216\326\274\023V)\022R\021j5\363\232z\3151c\332f\031\370\026\353\024\252T\251\376\201\235i\206\341\301\263ppb\251\260\336\320\334k\362\271J\375'\\\373\301\301\346jK\342=\353\331\241PH>\310\013\274\002O\342[\211\013\311\007y\304/\2205\342_\021\257@\023\021\337qW|\325\016!\230H\367\214\037B\211\320\252i\006M\263\257\257m\326Hf\215\b\342{*D\342\304j!m\275*\271\022J\177\304\305\007\361\r\025\024\026\021N5\375\270\233p\363\257\331\306\233m\332f\213zjC\026\022i\006z/q\007\302\250\346\340\221\023\311{I8\304\211\325B*|r>\341\250\265X\2070\013\023\366\005\257\031\306\353\341?"
+	.string	"q6\275\020\376h\260\034\037\276\004\322\037q\013gv\356p2y/yx\030\252\220\376\210\273\256\313%~\207\357\251\220\311\331\344\302\252%\334\341|\202#\225\226\200\n\225zt\020&\371 ~\321\272y\177\370=\025\342p65\235\223\253\324G\204O\347Sw\221\016q\225\372I\320\371\344\205\265\225"
+	.string	"\235QR\256\022\221\360\031\365G\177S\316$m/5;\374\027\352\325\274\237\323\210\260\233\260\363\2103I\233\244m\366}\005\364Z\256\333,\314\224/-\216\367\364\3238\227\364\225+W\251\347\214\023\313\205\325\211\253\024\003\203f{\372e\234Op\244\317\247R/9\243\270J0`\320,\263S\212s\212\367\022\303P\245\364G\334^\372\203\323\2175e\216<\360\325x\344`\337\352\311\360\357\3615'\320\rN\217_\f_s"
+	.string	"\335\274\340\361\347\275\361AyV\325\361\333\3615\307\017\312\355\277\360\203i\353\333\203\362\254\222\343\237\343k\216\032(6/\374pn\3256~7\276\346\364Au\351\302_u[S\343\347\302\327\2344P\\\250\374inj[\370\317\370\232\303\007\225C\026~\26342~,|\315\271R\247\374c|\315\331C\013\343\267\302\327\0342g^\374_|\315\311\333\262\305\317\305\327\234;-T\370\265\370\372lR\252\"fR\370q\340kN\227,P\370\243\3605'\r\252\314\t\177\226\033\026&\374X|\315\241B\221-\341\227\3625\347\354\212\022~+\267\261#\374H\370\232S\0065\245\3427\302\327\034,bR\374E\370\232C\346f\345\241\370\243\370\232C\006\365\342\211_H\t\203@\370\235\\\b\372\340\377\321\"\220\007\177\017\022"
+	.string	"w\360/\345\260y%~\350\bk\036\211?\211\005\337?\371\217V\\\003\331\005U\210a\303\336F\004=?\3665!\320\245a\357\003!\316\f\373\231\017\274\\\331\371<x\033\303N\246\0037+\273^\n\264;v<\024[\302\260\327\341h\241c\377r\302,\216]\216\203\2607v/\033\200\261\261\267i\360\265\306\336%\003\257\034\330\3250\350Bc\247^\300\245\205}\213\211'e\354Y,pr\205\235\254\202&b\354S\n\230\200\261\207Mp\325\305\356U\202\252\n\373\226\004E\246\260S\211 \352\006v)\020\240\211>a\207\362"
+	.string	"\032\246&\354N\034@\243\343\212\235I\003\2016\260/a\200M\022v%"
+	.string	"\340\253b?B\202\314\024;\325\002c\240<\253\234\b\273\324\b1>\204\035J\001=\017\302\376$\302\n\345Y\345M\354@B\320y\224\335\207q\316\231\330y\200\220s\035\354;\370\312\"\317\255\3509\330\225\370\312\342\316\355\203\343`G\342+\0139\017\203\354\317\016U"
+	.string	"\271\003\211Y\177\334l\206N\324p\373\361\225\005\033\324\213\206;\r_YT\3352\334fn\230\354q_\333+1\334cXi\036\267\225\257,\322\334\204v\334w?\005\206;\214K\315q\323uW=\315\020\201\362\254\202\343\216\343\253\333\316\255\266\331\316q\263#\213W\025\346~c\346\353;\265\255\241\362z>\217\232\212\231\314W_z>\237\317\247\006\315\272\277\200\025$0\027df\247V\2679\267\334\347\363\251\202\273\332l\316.\347\2273\314\031\3266\353\376\003\252\234m\265\177\3637wPA6\241\327t\334\3473I\005\267Zs\t"
+	.string	"w\223fY\205\025\270Wh\233m\177E\335\025/\252/0\034>\310l\005\251]\255\017\314\021\341[1s\367\003f\235\321\372\267b\026Z\366c\214\211Ir6\314\200\263\225\346j\313\334\302\013\336K\354\267Y\230!_\222\376\210\205\357G\376\231\027\300\200\266\227\204_\"\351\217\230\273\254\267p\032w\023\206\201\251\336K\315\376\367\rU\256lA\341\360A\366\367\252\367;\250 \016\037\344\021\336\317\274"
+	.string	"\006\264\275\344_\"\351\217\230\273\254\263p\032w\023v"
+	.ascii	"S\275\227\232\345fj\333l\177\2135\0078\006\001\251\276\240p\370"
+	.ascii	" \263\025\244\026>\237\317\247\277\025s\013\237\317\347\223_"
+	.ascii	"\t\363\353\354YCgg2tvi\2035\373\221\266\322\354U\354\354E\206"
+	.ascii	"\316.5tv\"\257\263G\025\235\035j\350\354C^g\027\342:\373\323"
+	.ascii	"\320\331\203\274\316\356\344:;\220\327\331\233\212\316\376\343"
+	.ascii	"uv\037Eg\217\276\316\336\303uv\036\257s\337i\037m\203B\332\367"
+	.ascii	"\324\035t\003\335/\352w\032\222\313\246\211fG]\203\366]e\372"
+	.ascii	"\3239S\343\304Z\341\246q\245l\371>\313\341\232\021\263\205O\313"
+	.ascii	"w\232\216\276\023\314\366\306\270UY\276\315\240\256\265\t5*\223"
+	.ascii	"\305\305+\373n\323\373\034\335fyfL\300\362=u\355\3340\356\017"
+	.ascii	"\262o,;\\:#5drW\276\331\036\007\035\2141\270\267\300\351\367"
+	.ascii	"\030\223\313\326\204\032\001N\273\210\r\312\275\360\372\006\373"
+	.ascii	"\266\362=u\2714\255\372\2125\007\275\016\373\266\202\326D\353"
+	.ascii	"\253\365\204{\306|\353\273-M\027\366}\325\373\372\0063k\242y"
+	.ascii	"\325\315\302|\3632k\031\231\364\353\275z\325\365\355\325\303"
+	.ascii	"%k\242\271\032\253{\205\371\346W\251;\306\224c.1\351<\317\332"
+	.ascii	"\365\256FO\214\353=\017\260Z\302V\330\227Z\225\357-\037.\327"
+	.ascii	"\217*n\025\255\357\271\277n\263\2745\027T\276\247.\025\027\207"
+	.ascii	"\233\257)\337T\232\334(B\246<\301\341;\356JMX\013)N\260n\260"
+	.ascii	"n\370\226\342\344J\233\320\"7\330\020\345\273\r\315\026\tP\224"
+	.ascii	" \271\201z\362\r\345\3115\322DC\362\304\235\312\372n+3%\307\311"
+	.ascii	"\367\324\225rb5\0267\2129$\312U\272y6\371v\"\345\n\2216q\203"
+	.ascii	"`}\317\355u\233\345I\031\201\311\367\324\005\342\376h\367\256"
+	.ascii	"\276\231L\271=\262\256\\&\351w\233\236\230(,\226|O\335\035.\024"
+	.ascii	"\316\206\357%F\334"
+	.string	"\244&\024\007\033\\\034V\337mWy\335fyR+\224|O\335\247`[\226\344[\311\221\2336M(W\222?$\337qv\335fyCT\034\361\353k\247T}\037Irs\246\t\265RU\306\310w\033\230n\263\274'\021\250\256N,\027\322\0332\255t\352\233\312\352F\257\t\3052\225W\344\273\213\336\\\267Y\236S\bR\337\323\233;'\226\013k\035s\t\363\312Uj\211\020\371\226\302\272\371\322\204\236\021\231\213\372\256^\301\r\202"
+	.string	"\025\347\245U\032\362\r\345\344\246\215\313\220\252\220\3578\267\300\017\236\326\324\324\004\371~zrCm\242\271\0059s\372f\253\266\361"
+	.ascii	"\310\367\364F\313M\026\026\257\351\033H\224\033\262\271\246\261"
+	.ascii	"\037\337l\\\376:\360!\026\266\026\375\366!\345\306\313.\312\325"
+	.ascii	"\343\273M/\315/\005\217*V*\314)L-W\211\rc\372\346\261u#\245\t"
+	.ascii	"\025\303\024e\351;\356\254\017\005\364{\307\367\364\346\211\263"
+	.ascii	"\251\311\254N\230]_\256\022{\005\325\361\275#\354\206I\032\035"
+	.ascii	"\337sz`J\337P\261\033i\032%\033r\274\227\231\321\341$}Oo\224"
+	.ascii	"8\261^X\2210\307\230d\256\022"
+	.string	";\004\351;\251\354\306H\023\215\311\006\351\337\233\251\306\361\335v\345X\272\315\360\340N\034}Oo\244n\242\330\244~~\037\231\335\by\3663\210\363\273m\354\215\203&\020'V\t\322\037\316'8Va\037\363\233[nz(1\377\005\273a2\372\256\352Y\251nP\364=\275\331\341\304jq\003u>\341X\205z5|\021\332MR\023\352\266RM\036L\272\032\376\005\273\301q\343\273\313\025\324W\267\031\336\232\006\313\257\3614|Oo\236\202al<\rm\232\320\216c\323\305\306w\334\025\215\257\261\246\tm@\251_\247\241\361\rH\364\313\276&\324\343\254\317\347\223\00533\255M\303T#\302\244\363*\321{\234\036\2273\312\367\352\025\024W\267\031\336W\006\023\370\236\266e\234X*\254W/C?\2011Mh\313\265\326V\f\363\255\273\350U1\351\232*\034\372\226\303\023\372\246jma \201\377\371 \27309"
+	.string	"}\020\335\234\034\320\f\377\003\347\345-k\006\237\227@\033\212\226\215\371\346w\325,&\235\323\371\274\363\255\315x\247\303A\312\005;\237|\031jM+\025m\2320K\317\3138kB\333N\272\205\371\326mV-\325\236o;\236OfiB\235\314Z\306|\353@)\226V\303\363N\026\343w\2564\241\2367\306|\363\271\251\027\223\316\343b\274\347YA\276\307E\2312\361\200\207\300G"
+	.ascii	"\254i\265\302\352"
+	.string	"\325\264\302\001;~\004\266\232\320\306\223Va\276u\234U\213Mz\374\306\223\341!0\245\t\3653+\016\314\267\036\224Ji@\031\336\317\364\034\360\017\210\322\204:\037\024\346\233\337Y\237ha\3229\235\324\001\357|N\032\360Nw\005\225\325m\2067\304\202\004\374\002\236\001\337\323\026\253\275\232\022\3033`\255\265\241\t\355;+\346[\307)\251\306\360}\247\200_@\265E\322\204z\331\021\346[\013V\265\237\002\336\313\020\360\thk\251\232P\337\233b\276\271\235\224\231pm\021\246\234\333J5\335\230t.gm\031\332f\021\360\276w\005\326B\265Q20\3010\353\230um\2630\274\313\351Aau\233\3415U`\200w\341\017\360=m\2054\255\\H\333 B\351\013\177\200\023mSQ\357Y\1770\363\232\004\232\2624\255\2176\372\302\367\236^\013\357B\313\243\310\343\230\230y.b\254,M\273\324\356h\341=\256"
+	.string	"o\200\026Z\364e\322\273V\211\231\347\022$)K\323\346h\223\n\360_v%mC\201"
+	.string	"~"
+	.string	"O\200\357i\213\243i\245\242}:\233p\254\302#,<\001\002u\332\016\320\251\314\332\206\r\013\337vW+\374"
+	.string	"\326\350\370\231\324\317\251\314\252\246o\205\3673\025^"
+	.string	"ht<\215U\217=\223\244\314j\246\214\n\357i\364\254\372&8\341Q\370\024\256M\253\025R2B\250"
+	.ascii	"|\nz:}g\265J)\363\312\303\013\300\367\235\316\243`\247\343\324"
+	.ascii	"\272\2612\2570`t\336\251W&\374\tt:\3567\206\235c\362\271\003"
+	.ascii	"ue^rq&\274\373]qABW\242\305\227\3600\276\247\254\227\246\325"
+	.ascii	"\212\250\2330\351\305\3038\301Vu\032\257\013\223\257I\214\255"
+	.ascii	"qy\361\215\347\342K\300as\320\3614k\032\223\317\215uT4\027\357"
+	.ascii	"iz$|\013f\313\330-:\036(}>\223X03\367X-L>\207\300\251\f\nk\226"
+	.ascii	"\305\233\253m\263$\274\007^q"
+	.string	"1\362&A\016\231\023\253\2041\246\031&\032W\351\323\214\3609}\254\225\242&1V\326$\fl\204\357\271\"m\021\260\360\342\022\263\342Y\370\261ZR*SVDU!P!%\312\027\021^\305\037\233\245\323#\352\312\2248i\"\302w\333\225\220\265\007B\370\236\262L\234X+\244\254\264\271\207c\3756\020>\204\367*\263\rk\245\323#\326\312\252\250\274\236\317$\025\215\205y\210U\302\f|\007\314\\A\023\343\365|>Y4\313,\0226\ts\360\250\211\224\243m\026\204o6=0'5\007>\370\236\262UN\254\276\302R9\243p\254o\304\203\377\200%\302J5\241;\232LLm\263\036\374\210+\250\037a\r\234\350\236\262PN\254\027RV\310G\023\340=\272\315\352\276\030\350\340{\312:9\261V\260MM+\034\353'17{\260Q\226\007\333\243\351\243\251\351\344\3246\333\301\217\270Z\3526\253\353\372\002"
+	.string	"\234O\361=e\227\234M-heu8\237\364\325\373P|\212'6G\022\212\3679\275\023\217\363\r\310\r\tL\004tL*i,\207\220;3\020!\201\216<\311\237\030H\"\037\236#\021\317O\322\247g\004\221\211\222J\032Kd\262\347\225A#F\222\207\310I\032?\310\032\307\344\017\217\317q)4\203\210\307X\344\037\241\035\241\245\220r\350\bdc\350(\202\201l\f\035y\222;A7\210\202h\034\223D4\214\254L\362\370\324\020R\016\035iP\376 }\224I\242\020\307\344\022Y\303g\271\203<&y\204\200\224>\310\006\230\350'\031\024\204\234\261sl\200\203\204|v\224F\006R\"\217K\"\245O\3171H\350\370\203\334Y@\006\022\310\003#c|\340\235\035\244\007\256a\306\261g\210\030\342\003\3270\303\250"
+	.ascii	"\3270\003D\317\320\3171\251D\332\340Q\"g\2048\332@\336\360\300"
+	.ascii	"<A\310\030<\310$\317\013D\203\210\307g\310\003\017wv\220\037"
+	.ascii	"xI$$\024\343\330\323\363\362\221\006$\320\f>CD\307\236\236\""
+	.ascii	"\017\021\035\223K\344\217\320\220\262\247'D\322\206\b\037\242"
+	.ascii	" \244ry\344Q\"m(\205zx\222\311\036\022l\003y\343\310\223\\\""
+	.ascii	"\2252\222\313 \237c\222\210\206\210#Q\f\244\221\347Gh\006QR9"
+	.ascii	"cI\202\223<B@\307\033K\237\032H\245\214\243\3172\b\031\002\001"
+	.ascii	"A>\005X\232\300\3433d\364\021ad\032\220?Ie\007\036\242\301\023"
+	.ascii	"\344c\303\307\003\367\364\b-i\354\314\330Y\n\005\025m o\024\271"
+	.ascii	"\206\031\307\017B| \202k\230q\f\272\3013\202k\230q$\"B\016\331"
+	.ascii	"\020\3721\036\225\311\345\217O\317\021H\231\\\362\204\340\344"
+	.ascii	"N\020\262\006\017\362\003\007\371 e\034\211\034\344\003t\344"
+	.ascii	"ie \201~\2225\222?6\2207n\030\205\025\\\230\261\263\364\031z"
+	.ascii	"\031\205\025\\\370\371\021R\272L\264"
+	.ascii	"\364\001\362\371\351\320\356(]\3461q\342e\242\035\345\313\313"
+	.ascii	" \037\241\241\031\220Ie\214#rhY\344\344\022\251<\"\207\226/\013"
+	.ascii	"\r\321\220<*g,_\346\361\001:*g,]\236\201\"\371\343\323#\244\034"
+	.ascii	":&\227H\345\217\220r\031$\264\223b\247\307\002\""
+	.string	"\242\344\216\220r\350\310\3433\024\202\201\204\202\222<\307\235\240\033 8\t\344\263\034\022\022\372yY)D\024\224\204a\031\224T*i\354|\340\0234L\274\234\224\201\\\376\b\325\370\371I\356,\2211j\200X\"c\324 2\r\023\317*xp\334\331A\3360\217\211\023<&Z\356\3004\230\240\241\003\226\223?\310\035\242\243\220\362\206\f\"\rH\240\016\234\374Y.\205\2243\226A>@\035X\310g\211T\226p\301u\201\310<&\236\177\2205\224\311e\220O\211\025\210\234\004B\006\225X\366 \225:D\016\022\362Y\"\201\224B=A>%x\224H\241\023Bp\313\311%\222\207;@\001\002\212\020Z\3442y\002\221\211L\224\320\200\310D\006%\210L\224 2\361\201\203\204|\210|j$\225!x9C\206\317OO\0202\371\243\323\201\211L<'\207n,K$\225H\033@J\237\024>,\203V\260!D"
+	.ascii	"\3432h\205\0312|\004\260\2441\264\244\321\202Rh)\004\024\202"
+	.ascii	"wP\320 \024c\206\035\344O\214\024A>H\240\024;J\242\024($`\241"
+	.ascii	"\241\2442\305RHH\231\202\310\314l\005G\277\022\356&}\203ei\302"
+	.ascii	"ng\333b\355\002\232\341Q\226\366\334\316\326\213<\0233{\221\367"
+	.ascii	"G\342vk\20618(\350\225t\251\247rn\025\245\304)'\362.\365O\224"
+	.ascii	"rn\271D\"N\344\277.NJU\262\326\306\343Q\337S\"\024QH\207<\250"
+	.ascii	"\367(3D\247\" \016\345\306\025\3707\246\031\306\316\220\357)"
+	.ascii	"\361\207\023\253\311\210\321\016jh\210LE\203\304\035"
+	.string	"\304\245\242\276\"\277\242\277\242\277\266Y\037\002\370g\215!\344{J\204\022s\220=\275\013)jC\304\241\323$\220\332\210G\304\347\323w\334\025\330]\267\331\030\272/H\017\362=\035\n\016\001;t\025\005\016\377\212\006\375\206k\214\216\220\214r\344h\233\365 U\270\374\266\302D\300\235\276\247\303\276!\232\016O\200\274;\r\313\030A\233L@\236\256\333l\f\334\227c\323\225L\207\251\037\357M;\206zE\326\037j\266\342\232a@\300}|O\207xC\273\016=\242\357>\230\206`\212\232\355\213\221Sw\241\363\250\027\256\2767\031\274\307\367t(7\204#\376\361x\357\321c\350\246\323qmFN\315\306\306\343\fW\337\026\333\003\230\272p!\346\371\322;\223\217a\232N\267Y\331\250iH5r\352\252\364\371L\2422D[\232\343J\363\267\346\200\035[\234X}ehF\354\242\343}\307\323\020\013\231\2164[94"
+	.ascii	":&\266\245\364\016\0352\004\373R\372Cc@\216\256-\252\244\367"
+	.ascii	"\034QC*S\222\370\266\264\304\200\364=\035Jqb\365\2314\212\221"
+	.ascii	"\224\321\224\253DD\302\361\216dd\230\345\004\307\365\257l\001"
+	.ascii	"~\364=\035b\r\257\206f\374\371~tdh\303P\311\320\312(\211\225"
+	.ascii	"\321\222%m\263\376\274n]Q\300\340\367t\210\304\211\325X\252\214"
+	.ascii	"\256\214\260\\\245\241\027\301\357A'\303)\251a\021\243'Q\214"
+	.ascii	"\244H\021,\303\265\367'\226\200\300\250!g\200\337\201S\206A\200"
+	.ascii	"\f\235\214\264\266\214\272\272\332f\033\220\314\037\030\002\332"
+	.ascii	"\374pb\225 \035F\277\330|\267y\257~\r\231t\206;\206KFabFccm\263"
+	.ascii	"\315&o\253\013\206\277\357\351\020:\3141|\262\346\373\357\275"
+	.ascii	"J6\304\2413<Z\223B\034\327\335_\225\003\370}O\337\3017p\230D"
+	.ascii	"\315\267\337{Ui.\255\263|\350\276o5\337J7 \371 w\232\357\276"
+	.ascii	"\177 P\251\f\232\3574\337e\357_\221\337\273\306\310l\213\021"
+	.ascii	"\032Z\333l\243\371\026k\241V\0226)\325\327\224\027\312|\237\351"
+	.ascii	"s6\365\0254\303\037f\276"
+	.string	"\317\244\275e\370\314|\263\361}\227Q{\367\310\360\261\341\352\262u\203\013d\276\257\337\323W\214\263\251\204\327:<\332\373\276\256\275wv{\337]\306|\223\251\276a\300\214Q\301\013W\332\223\026\304\320\311\275|z\337b\332^/Eoz\\\270\250\177M\232a\030\300\372=}\333\336\352\013\227\367m}{\271\350\250\345Q\267\256\232a\024\300\356\033\357{\372\246I\321\214\340\214\344\\\245\027\013\364\356\033\217\356\325Rdv\367\335\246W\367m\007\346-+\302R\247B\032\256\263?\033\232a\020 \314\367\364\275\342\304z\361N\337)`\276\303\324\275aE``r\340*\373K\302\302\027/.$t\337_\356^-*te[U\3150\0060\367=}qxox}\310}\317\345\275O\234\274YFzc\214\366\366\332f[\256\013\027\226\251f\030+\304a]\275Gp\337q|\257\rV\r\307\306E\366G\244\031\206"
+	.string	"\274|O\337$\357\021\277\267o/f^*\235\267\310;e\204\206\215\372\214\374\214\374\332f\373\355[\254S"
+	.string	"\343\"\333\002\033\322\fC\005\267\357\351K\344\205r\357\332\276\335\214\376\336\247&\232\021\227\266\327\211\355\273\355\352\203\f\246P\375\236\276M\257\017\267\255\313w\325\250\315\313\303\255\313\322\332w\365\252)0"
+	.string	"\\\276\247\257\016'V\213W\311(\320h\320Ur\317\324\276\271\034\275HM\2649\265\367(\207\207\204\250\263\340\246\211\204&gJ\221\210\210\210$I\222\326\243\033 \b\307q0L\241\331\006\023\300CG\347\304a<M\364 h\030\243H\227\221\016k\351\342\023\324\350\204\243\026|\341 \026Ng<\200\271vf\212\313\273(\001\362\230\240\322HS}=\335\255\341j\272\021\336\330g4\221\226\326\"3H\216\004C\r\374\242"
+	.ascii	"|`\310\022v\260\017\362N:1\2600\004\013\200\357\214Z\034\202"
+	.ascii	"\276 \004\270\354\0301\001\201\006\223#H\217tR~\270\321b\037"
+	.ascii	"\001\341%#\326}\007\363\205\260\373\312\366\366\230}\243\214"
+	.ascii	"\227\216\310\307\370\034\212^\367~\213\351\021Q\301E\210 \020"
+	.ascii	"0\332|\327w\204\350$\256\344\3038\f\370\246p\266\020\344\263"
+	.ascii	"\373\231\343|\342\025\3255\026D\200\303\177\305\3354\350\330"
+	.ascii	"\270\326\204E/\031F\323*Zb\326\317\366\tG}\n\372\210E\024]{\016"
+	.ascii	"\275\313E\253\t\350\341\366\376\027\"\241\313\\"
+	.string	"\022e\320\301p@\213\214Y\374H\355\322:Y\221\351\352\002\300\376\220h\321\275\330\247W\363\327=\033h\347\272H\353\\\267\277[\255o\206\312r\335\030\376\312i\335\211\356\360\354 \330\302s\262\217tZ\270N\324s\236#8M+V\345\270\332\032\331\\\354\354\327\220\273\335rL\225T\225Q+\017\3172\305\r*\001u\f\346\203\241\007\252\241\334\326[;\212\200h\272yW\227\227\276\020\216\342\311z\f\244\024TMz\216\370\370t0\303\266.{\346\362\351=fe|\031\203\225\344\302\227\317\273I-\2251\367o %;XCS\022L\2468l\037u\341B\245?;\bXlh\036w\fOI\005\337\022\255U_\027\354\b\rS\364\2159\264\344\220j\226\246\032_D\204iL<\232\233\266}F()\323\311\363\250]v!\323+gu\314.\034\362o=O\212\r\306\\\b\344\337z4f\232\261\315\325\304"
+	.ascii	"jCj\255\231`\211;.\020S}"
+	.string	"|V\017j&\255'\266\244c\325\b\244\343Vc\035\342j\225J\231ZK\027\232>\371\003\023\375\220\305\037s,l\250\\[\006$y:\306;\321v\341\324\320vi\304\350\320\r\f\212\222\324\374\317\235\322;\223\224\273\026\305~\326\2134\252\353\254\266K\277\001\301\360\021\350\364\346\033}\204\236\232e\313N\335?_;\330\020\230\025`\rI:\3023\205w\2759\017\350\233DM\357\321m\303-\223\366\036 \237C\235\256\b\244\303\3205\367\212\205\231\246\251\266\220\211\275\255\007\243\260QBCU\025f\fpo\353M\024\371dUV\001\032\370%{\025\007H\243a\377\340\260\266\205\304\346u5\0352\266\f\344\272qQ\236\322 \345\275\300\362/l\330\337'\254\343\202C\377\320\332fZ\216\323\031\321P\2640%\\\332\217:\330\303H\034\343\3055/"
+	.string	"\353\341\036\337\273\320jfM\231\273\320g\242\222\253j\332\332\343\241\ta#\272\346\232\216\026\357\324k\\)rD\n\212 \260\013\312#\300+\315l\244\222\221\243B\236\354\202l\333\303\304\272a"
+	.string	"v\375\216\306\212\312\021;\337\016\304E3\256\212\002\033\265\003\017\343"
+	.string	"\333=5]\333\304\332\003C<)\275('P@\371\b\301g\304\267\265\260\006\222\272\356e|\254\031\316A\007\361JT\031\247K\f#\341\336\247q.\\\362O\nU\376\007@\364\366\341s\024\270\032[\3501c\t\261\205\302:,\273\315a\372.\022\314\031t\356\374|\274\351<\224ee\201q\001}\253\307\027\235\266I5n\004\340?\"\253\254\355\001\271?O[\347\230$"
+	.string	"\255l}\307\177\357/c\307\r\360\033\215LV\035\274\323*\033\013\300\362\002\300vl\301\341z\240V\224\376;\266>\004:J=\tv\341\242\314\205aB0\260%\350\236\331\331zq\021`[;\216*Z\355\"\371\344\362\027S\364\251\313f\260{%\230'\267\257d9\276G,\022R;\316t\225L\306\001|\264\233[a\177\001\303=\243\252@\333\247\311\203\002\256V\002\226\n\360\217Is\005\340\215\242e,\346\021\334\237\0179#\020\377\260\304.\022\210\211-7\013\220\201\016\003\212"
+	.ascii	"]\355\023\217\337\335=F\3060|\203\351\035u"
+	.string	"0\251\277\304\332]\233\350Y[\nid\341\243v\304\276\254\315b\317\276\347c\rGq\0373*SOJ\0337N\377E\376RkW\315\353\326\3472\310\263\233\350\335I\257qJ\354\205\002\251\244\216\2007\026\f\026\023/\222\032\366\240X\365\256\177\330\3431\376\200\324A\371\036\030d\022\352\225b@\232\006O\213zL\357\020kkaH\277r\225 ^{\223I[\r\007\344d\b5)P,\001m\220\372\330&H.HOd\311C6\002\3445&\301\233\257\177 \3620\303\362e\034p\037\325 \322\254@\251\356\013\226\347\240\220K\372\375r/\370r\204@\366\030\001\356#\217\276\337c\013\316\206$Ev\023\n\227z\n\021\200s\206\t\347\224\316\351\032\200)\r\337\346\001\315c\211\270\3528\0205I\237%\034\344\364\275\276\3465\220i\005\201\304\257\211\265\321/\262\351\t\034\332K\266\220\277\375R#\001\"\001p"
+	.string	"\301\345y\003]\tPX\017\361\311|\345K\n\210p\205\204\221\301\231\237P@y\315H\253`\261\240\n\320\t\f\225\324\222O\255\031\224T\272e\343\370\030\276\345\370\270o\001\305)\337\230\221\207\267m\024\221\344\355\316f\262\224g\251\022\221\017\2549\373\203\266\240A\313\002\2118L\366\314\324a\274\016\n\351L\245\225B57\240\232"
+	.string	"\016D^\201\221\343\217\224j\354 u!\027\261Y\343d\032\334\333S\352Dj\352\354\254\0030#5\211*3\0366fO\304\310\033N[`\002L\356IkdaaF\016E\277\277\236-\266\233\022a\366\035\211\350(\250\264\242\372\364\334D.\235\246\255\3637\314\214\314\017\257\"\371\362\220PK\324\276\317uL\313\362A\002UsK;\322\204\332B\223\210Bq\300\"\314-i\340\302$\356MB\001\314Fh\343\213\300\302\335Q\207\035%c\261@\300Q"
+	.string	"c\220\263pt\006fOr@`\235k\360\221\312G\216\234\016M\326VXs\361\212\231\324\302o\207\244\320\273!\223\325\034\235U\025\207\336\357\034\205W\030\316@\002\2403\021\352\025\004\202\310Z"
+	.string	"\376\205!\021\037\244>\315\253\023\263\t\313l\204\207\315\232%\340&\205\324\3722\364nL\351\354\013\271'\336r\306c\315qt6N@|P8\321?\"\2209!0\217\374\341\t<l6E\274\004e\225\344b\327\r\177\360\020\222{\203\323\332^v\t\212\273\300\232\3616\330\312CO^\030\013\367\373\226\203E\377\036X\3368\026\374\255U{\201dk\252\255\315\322\255\335\202\213\201\2431Y3\244\347\333u\371\211\\f\371\375\377\264\203\236\035\241\001\346\006l\311\030\177u\340\264HW\3420:\346\352\"\245\273\3212\233Yf\030\244\231\350\036\275sc\242j$\254\260wP\341I\304\313\023\325A\252S\245\3661`\205\210b\354\001\303\345m\b\350?\375s*\033\020nd1d\314\242X(\206V\243;'u,sH"
+	.ascii	"\243\352\353\374\251g\2363\322\005zP\257\241\030\313M],\224d"
+	.ascii	"\252\245\b\363E\300s?o\265x\246Z/\373\3430\3761@\0221\301\003"
+	.ascii	"\3261T\362\305\332\235\323\020\037\346HSN\177\276\342\210\271"
+	.ascii	"\b4\351\001\001\254\013\225\234\027}E\024J\003\235\274\262+="
+	.ascii	"\306[\352\313\rdje`P\236\300\323I\020\211\236D\214\211\016\200"
+	.ascii	"\365h\021zr`0\211P\3601.\270\034\0043\304\377\245\b\2104\372"
+	.ascii	"\347,n\255\262\251BG\304\007\230\003\246\236\306\322\270\330"
+	.ascii	"\252b\207\246d\277\036;\352\307B\037E\364\274\"\026\313\327\341"
+	.ascii	"\005\177/\374R\244\3660\206\346\206h\206!\270\271\263\213\356"
+	.ascii	"\002\247}V{\340\373\221\212>\354\375"
+	.string	"O\351e\3074j\352<U\336P\032$\307g\024\372\316\361\031\205\276\363\370\311\301\301~\303~\206\375\f\373\331a\2774?\375-\360\333\020=\216a\350[\365\330\277\207!\325[}\202=\340\370:\023i\361\371E\344N\344\320J\003\243N0\263\237=\f\306\225b*\006\026\254\313l\223\374\320K\272\203Q\247\270A\227|F\306\222\340\204>\351\030ZJ\312\f\272\21432\226\tG\364I\307\300RR\346\320\311\234\221\261H8\242\237<\f\226\2222\205N\346\034\215J\302\021\275\344a\224&Z\220\022-\247\3016D--\2522{\030\214\312\323\025\271\210\313~\245X\n\0318\351\317H\256r4\006\375\354\236\001\316\016\306\320\035A\241\362\341r)I^\203\221\r\301J,Cp\322\367\343@#+\331-\302\246\233\2216\357\367\206J`\022h\304E\322d*\224h\350+\241\215\034\242R\242S\331N\020\016\376\231\265"
+	.string	"v\005\224\025z\033y\321Qsv\264\203\301>:\221N!d\245\200h\023\313\352&\"\222\215\240\352\242\336{#\277"
+	.ascii	"&O\305\2224\205\350mu*%\313}\225\311\025\235)\277S\005\336j\253"
+	.ascii	"\205\345f',S\024\362\004\037\251\330\003J\365J\006\262W\225]"
+	.ascii	"\225=\\\352\004l\356,\213\252?c\267V\224\322\2455S\013Ppl\371"
+	.ascii	"Y\222l\272n\213\322\367\\\317m\313m\224\024\013\242:S\306$P\001"
+	.ascii	"\030\"H\224\376\271\221\207d\320f\017\207"
+	.string	"G\004\250\274\3651<\361G\314 z\0164*GFE#\365\352a\225H,,1o*\346\036>\327\ft\035B=k\032'\353S\3024\315St\332\366c\f\275\201I\255\372`\b\0176\307.\332\004o*$\226Z\272\264\276f\3118:"
+	.ascii	"=\310\030\236C\326\203\367E\374\003\353\217\347E\240\035\312"
+	.ascii	"\027|\304\003\365\r>J\026Ut\301G\273\2507\2305\203\376\267\\"
+	.ascii	"0q\360\316\013H1\272;\325\263\022\357J\315\264rQ\335M\324\263"
+	.ascii	"\022\347Z\251s\206lZ\235\264\366\026\352Y\205;U\346Z\271\224"
+	.ascii	"v\026\352[\211;UfZ\273\250v\026\352\343k\326^!\344\362_$u\234"
+	.ascii	"."
+	.text
+	.section	.gnu.lto_blackboxWriteLiveSysinfo.172.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`~\fE9"
+	.string	"ja\244\025DP\346Q\007g\222\2259\302\314\022=y{\255S\215(9\352.\320.\202O=\205v\365Okw\004>Z\202\307\021\225\201\035P"
+	.ascii	"C$\200\252\002\001H\027s\334\202\t\335!\036\362\037\273\271\333"
+	.ascii	"n\"SJ\001G\001,\001N\001\027\356\310\332\312\250[\371M\032_U"
+	.ascii	"\353b\266\225M\025?s\017s\037\363\334\355\355g\374\254\035M\277"
+	.ascii	"f\250\216^\326k\023\265\272'\330\261\335L\277c\234\314\321\313"
+	.ascii	"L)-\245\261\322\265\252\303\342\240\306\3650.\246\373\355\033"
+	.ascii	"^\326-\242n\203\3428~}\355\276\321\375\372\372\335T\355bN\326"
+	.ascii	"\257\324\301P\371X\016\217\231q\013G\375\232\3061\026\206\326"
+	.ascii	"W\237\032p0\377B\345a:x\261\2264\016\3623\213\246\2019\360\265"
+	.ascii	"\227Z_[\352A\326\327\326\217X_{B\005\252\206\221\254\224}\"P"
+	.ascii	"\237\3150\203\342X\312\224\2438\354E\300\037\321\320\353\372"
+	.ascii	"\332\036\273\362\362\303\355J/\262\020\255k{+\223%\304\201@/"
+	.ascii	"j\334O\200\033u\215((GU\033\002f\241\316y\203\200\250q\334\237"
+	.string	"\033\025\216\317\201|Q\323\372\264\bz\274\006\3235\202\334\016\326\026/xE\305\371f5\237u27\242\360\026\035\004F\307$\310\226\257O%I\220\0341\242\305t\263\254X\026\213\2213g\202\005uy\276\204z\346\035p\262E\367\313\332\301S\222\303\326t2\377\036YU\377=\rq\034\367;\263\202x\033y\267\253\350v\004\335\356\240\336\032\224o\227T\205e\310\352\247\375\317\2358>\355S\2675\271\366=mjq\355y\354\314\301\323\376V'N[\273[\317\265l\356Kb*\034+\361\022\266\366:=wANkM\255\235N\317]pK\243\343M\254\257r\332\323z\356\302Z\232\303\351\356\271\tQA_q\254\364g\317\2753f\340k\316\236%F\362w\335j\336\304~\316\371\355\230\317\252\257vw\t\177\323\324\306ql\241\335\215\243\231h\367\362\265Q\244xw\246`}\375\354C\242k]\302\226_\355"
+	.ascii	"\337\255b\305\273\363@^\002B\265B7\255rB\\U2^~\342\031O\335\031"
+	.ascii	"=\271Y\260\236\237\310\362\354xB]\364-\365Fc\273\205\303w\247"
+	.ascii	"g\037h\002I\351\246;\262\262[Z\365\371I\267\347j\265J\355\354"
+	.ascii	"\244\273\375~\320~;\3600\357\003\375\235\324~#\265\337\003\334"
+	.ascii	"o\001\356w\320\367\035\300\375>\362}\003 \3726\032\372.r\277"
+	.ascii	"\201\357\367\317\375&z\277\207\334\357\367\375"
+	.string	"v\335o\337\373\335\272\337\275\367\233u\277W\3377\257\375\316\355\367\367\276]BL\377\372e`\262\320C\177p]\330\3367\023AI\332y\230d\265e\272\025'\260\262\252e\372\221fV\366P&\262z\256\241\354t\272\334\3746\177\313\315_vG\213\353S\002_q3(\325#\201y\364h\231\256l\263\357\307k\301W_D\003\234\345\245#\273Z\\\230\035w2|\260\260\371zD\240TB`!\020\340\210\264L\030l\356\345Gk\336-\033.\362X\260\2216\216wX\350\007\362W0\022X\t\274\265\305\372\312f's\020j\242r]\302\326\3325{\331\373\200\257\270\240\250w\302\\\276\007\332\244e\262P\342\3455{\363n\311\374&\374$\n\334\325\305\372\312\313\356&\316[\256\253\263^\023\373 SQ\342\207\353O\233R\354\013X\007\371A\366\246\326+\177\331\324\356\325\260\024x\n<\205\365\325Av1\316"
+	.string	"\314\031\334\363\213\326\362\253\355s\330\005\037\204\336\301W\274\fK\313T\241\300W/\363:X\013\004\2708f\272\023\346\3222?(\200\273\300Q\"@\250S\272)3+{\212\027\307L2L\307\276\332\bN\334\201=\301\274\314\311`\261\r\035^\354\311f\225\225]\340=\215\243\tq&b\304\273\263\035\215\273f\350\330<NMt!4\022m\b\235p\030\2116\244\220C!\001#\021)C*\312XD\016\205QNE\344\2240\251\241\022(=\200J\320\353cTT\02195\f\366Q\n\207\320\311\305\324\023\021\n\251\241j\344@:\035\235\206F"
+	.ascii	"=\225 w\024\321\210\024>\331h\373\230 7q\206\024\222\210\024"
+	.ascii	"B)!\215B\344Q\311E\221\304\021\022\352\243\246\236\262\020)\364"
+	.ascii	"\340\202\206\324\013d\2618\003\305\320\b\354\341\022\216\342"
+	.ascii	"S\214\241P\306\023\023\r)\341\f\246\241\361\310\264t\240\213"
+	.string	"5\210F&d\261hdz\245K\347\305\331I\273\027u\217Y\032\236;\314:\231\267u\324)fir;\314&\345\036\335\235\224[\3032Wu\2161\237\216\245\361\212\220\362Y\023\020z\306\235~\274\211\035\220\221rF{2?f@\316mkl\317/u\236g\276\200\002\304\300\225\301<\226\240\317\203y\347\3014Z\020\316\351@\005\344`\\\2376\277\243\034\024K\332\371\331\227\344\333\0224\031\3272].@\016\352y/\001\262\343\351\002\220\217\362\253\355\371/\370\t\200\374gqsbDE\331hK\322\316\315\262\260I\261\244\231\225|\376J\262\217Qv\267\256\260\344\237\257\222\fT\224?L\227\236\350\020p\n\234\224$\025\002]\033\200\352\250A@\303\034TFFDDD\222$I\007\340\002\021\241!\326\001\021 \255TL\215\fI\n\222\306\213A\340X\251S%\327\245\351\034h8\375\344,\253\031\3179M"
+	.ascii	"\314UP\034\324\244{YH\320\026e\246o\211\003\323\006T*\003\002"
+	.ascii	"Anw\016\217+v\034\370\366!\203K#\002\201\324\336\301\n>\253O"
+	.ascii	"\310\316`\256n\035b\024\031\365N\256\by\005v\021\365U\262\337"
+	.ascii	"*\177\222<\255\242.&\207\360#\227=\227G/\234\002\205\006\026"
+	.ascii	"\362a\341\260/\215|\021Ws'\262\364Nz\335\323\226J\323\226 \243"
+	.ascii	"\306Q[\033[\267\372\333\213\314!D_\344\025\035\312<[Eo~\364\206"
+	.ascii	"ju\355\360\234du\004\352 \237\223H4\327\205\230'd?k\336\024j"
+	.ascii	"\241\230\\og\330\250\n\252\023d\360{\326\363\036Qs\376\354\030"
+	.ascii	"\231\353\b\350!\036\233o\352\225k\304~\314\316\354\316\271b\261"
+	.ascii	"j\016\224d7\377\250@\344\312wn\r\363\271o\262\026\r\307\271\022"
+	.ascii	"f\315E\314G\034fJ\001\330\266\203K\314B&/\274\270\205\340\357"
+	.ascii	"2\017\003\204uB4\247\021\304jCp|\230N\352\307R\207\3777:\377"
+	.ascii	"X\353\372\271\240\223\377\240\205\035\362\334\242\302#\027\365"
+	.ascii	" \226\373TKC\365\b\262l\301\007\366\321\2362\177M~\245M\205L"
+	.ascii	"\nP\004\230\267?\246\305dY\367\03162~Z\024=.\f\027\215\030!\214"
+	.ascii	"\225\032%\320\356-\005\244\360\334\2179\345\314#EA^Q\3020\"\337"
+	.ascii	"JFD%\226\207z\300\325 \201@\235\275\344\22265bCJ1rn@\230\026"
+	.ascii	"\025\251\341\037"
+	.text
+	.section	.gnu.lto_blackboxWriteHeaderBlock.173.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\200\003\205\030"
+	.string	"\206\356\240I\300\026U:\350i\266\341\363C2\2109q\245\242\301\236*hGD\367\b\\\300Y`\027BDXD\321\266uy\272$\221j\363,\272\273\350>\004A\251>\222\355]\001\035U\205\271\367\231\232\366mQ\017K\b\331D\312$\003\214"
+	.string	"\202"
+	.string	"\214"
+	.string	"-\266\324Z\017\234n\003\263{\3771;\020\240\261\246\336`\2208\252\265\352\354\002\3634gd\336}\217\373\230\375\fqT\2551\260\034\325\332\323\331\035\363t{W\221\247\346o\310\323\335\335\004\013f\033$"
+	.string	"G\343\202`\211\205\316\007\246\326\036\253g<\350tl\016\332\337w\tV\256\034\331\361h\247*>\0028\361n\334\243\001\036a\202\377\235K\360p\343\352\207\263q\337y\004\317\306\\:\250\265.\357x'\276\344w\267\265\273\021v{H\n\204'M\277o\212\204Pt\304\032\027w{4n\031\273\037k\307\330]\336\325\317\037\247yU7\372\246J^\233\023}Q\007\362\323\224\2743\224W\206\362\236(o\f\3455\225\274f\311[2/I\362R\312;R\336\246\274Ly?\200"
+	.ascii	"\016\"(.\\R\253\211\242R\215B\221\344\270\321O\364\0131\002\252"
+	.ascii	"\251\275\250(\023JK5\036\274h\377\333=\235\362\356l\357\333\323"
+	.ascii	"\356\022}x=Q/Bh)\327\021kK\202\007\236J\206\3472!\241\3232\266"
+	.ascii	"\214#W\365\177/\020\304\313\215T\243Z\325:ErIOr \320^h-\360\360"
+	.ascii	"\220\247\251\276\220C \236\300\341\n\266\351]\327\213\277\333"
+	.ascii	"\377>\352xqk\332n\357\253\204D\265M\277\350\246\031:a1\227d;"
+	.ascii	"p\310\306Q\377\003\211\352\266%}\t\362\344\306a\266\033\325\214"
+	.ascii	"\244#r\277\273G/\271!\333\372\334\b\314\254\2652\330\023y\221"
+	.ascii	"\f{\241\323\335\020\343\357N\3671\362\224;=<\354\363\003{\311"
+	.ascii	"L\030<\370\374\2744\220\262\327\205\326\013\003\271\256\035\020"
+	.ascii	"\261\236\f\256\226\206\036\326\017\254\265\201\345\222u`\355"
+	.ascii	"\020\330\030\207\227\214\345!\026\223\261N\275\372]uN\255mK\323"
+	.ascii	"3\275j\212\244;ez\246_\245\n\025\231\276\357\243\322\351dx\322"
+	.ascii	"SO\201\005\240!%\246M}\352\347\\\330bzD\202\362\304\324\025\316"
+	.ascii	"\340\3604\333\311w]T]\266\331\317\r5)\373)\316 \217\025)V5\331"
+	.ascii	"\273\023(\344\340\232\266\264q\232\354g\311\355\260qq\307\246"
+	.ascii	"\035< \240\"!\243\353\232\b\f|=)\340\r\243\307\263Zx\013\266"
+	.ascii	"\013@\331#\344\330\346^+\306&\b\023\267\260\2373\222h\024<`\306"
+	.ascii	"\t\331-#+C`\327\266\022B\234\202\271\021\206vi\207Y\332\256m"
+	.ascii	"\034\326\310\026\377\204'2\274\341A\222\\\357sVejZ\016\271\357"
+	.ascii	"\212\303\nv\302\303\352a\026\3601\302\244k\021\323\202\323b\216"
+	.ascii	"\237\230\377\271Ek\237\323\305z\002\266\r\2320\r\3200ltK]Q\023"
+	.ascii	"\231\256\201\002"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.174.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\035\f"
+	.string	"6\327R@ q\223\016\270\220\242\020\322B\030pD\370D\002\202\312(\001#\325\227\223c\354\203b*W\265J\220\205\027\032F\2473\01666'\b \biE0\020m\"2\210\030=\327Z\221O\366\2262\245@"
+	.string	"A"
+	.string	"?"
+	.ascii	"\357\004\246Cc"
+	.string	"\366\215s\"\026\263\222\202\004%\307\356V\032\342\330\237&\346[\266\354\217\332p}\031\222\007\035\0016\321\323\310H!y\367,\331F\231\036\037\273\353\324\266\f7\274m\005\266\023\330_\020\245\037\276tj\372T\246\206\013\r\267\301b\027C\334\261)0\006\t\333\277\330N\356*\260\237P\300\f\330QW\202\200:4G=\355\2378\n\354\245\n\006\260\013\342\005\214]\356\2009\324\241\346\005\246\303\261\205\252\211\363\233)\265\323\315\030\245\212\005\304\030q|3]S\177\241\203\350(_\021\301\037a\221\221\27462\035^\337\375\225(\3210\301\301BF\233\313RM\354k\2141ZI\366O\376\351\001V\310b\360B!\037\t\037h\017g\302\325q\340\261\036t\252\220\006\026H\345\001\211T\234\214/\b\037P\025\272.Pu\341\366\357JR\221S[\003\376\310r\345ow\367YrR\2506\310\225\327\f5\273\312\207\025"
+	.ascii	"`\251'3\b\3200\242\030\003f\355\230i\006XI\264--\b\027\027N\322"
+	.ascii	"P\030&4t\r(\206\321@\370MM\201{\301\324\024q\227\233j\217\006"
+	.ascii	"\246\366"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.175.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\374\001\215\021"
+	.string	"V rF\340\322&\035\023\213+\270\224j\220z7S\247\"3\305\324\006\273\004$-U*\231\222a\3140\003\320\257\262h\034\026\260s\206.\340hl\003\342\030\232a\024\023\326\257\271\202\274\344\017T\022\020\346\370\302\222M\244L)["
+	.string	"X"
+	.string	"b"
+	.string	""
+	.string	"\036Qn\262=j/\331\036\355\032\233{<g\226\255D"
+	.string	"g[\t\302\022:F>v\267\323\021g}\213\232&\313\177\320C>\260\365-"
+	.ascii	"\330\341\221\303\265\021\360\3461\234T\r\345H\2463\002\346h'"
+	.ascii	"= ~<\350\211\001te\236Vv\327\371\201;\367\351\266[l/\260\323"
+	.ascii	"A\241Oi\313P\310\177\327\277h\302!si\313~\271R}\354k\253=\266"
+	.ascii	"\246E\2644\247i\325tj\372$'J16|vc7C\bde\261\006\212\277~\373"
+	.ascii	"\376\212\307j^d\004DH@\273\313]\310\207}\350D\254\277h\276;\373"
+	.ascii	"\357'<\261\264\253\341\300\243U\002\332S6\021M\305r\220\204a"
+	.ascii	"\310\343)\033\247\"\372\234\017\256\f\355\313\370\f\325\212\205"
+	.ascii	"e{\344\364\261k)\206t\250\340q\313a.&$vW\301\210\316,\374\230"
+	.ascii	"TahF\037\223\352a\037@\243\351\350\263\020\241\013U\037\247^"
+	.ascii	"S\261\244\233\234\331g\361\026.\376\217_\274\350{\333cj\201\035"
+	.ascii	"<6\031\250\031T\203\031\230U\205U\210U*\026\274\224\213\n%!\325"
+	.ascii	"\301\264\240^:U\214L\247rbo\302*\246\233\361\274\230\216{\331"
+	.ascii	"<\350\277\320\324Cf\243\256\215F\333\025\301\340\257\037v\001"
+	.ascii	"KE\031\332\260kl\245\374\326\300\243WZ\031$\226\344\213\016{"
+	.ascii	"\260\t\021!\001}>\204\315\217E@\345?G\317LxH\n* P\2021\246\220"
+	.ascii	"\007`\365\004\001?\274\231\260r\001\347\330;bo/{\370[\241\b\214"
+	.ascii	"\231\315M\027\027\262\252\205\306N\250\315\220d\024\023!pC\373"
+	.ascii	"p\256\367\004q\255i\211'\216X>g\232\342\260\030\357\017\304M"
+	.ascii	"4\bck\n\312\023\237\023V\2009x4\006\346H,\262\350}\033\345\002"
+	.ascii	"\316\305\273M\256f\017"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.176.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`x\002U\024"
+	.string	"\246\343~I\320\362&\035\214\227\215\032\020\033\021\b\002\240\254P\321\231Tw\327\217\335\303\177\232\300\004(>\254\307\027\346\374\321\232i\003\231\300\212\341\303{w[\220\333\344\002\365HJ)\367\001\2305\006\342\034\031\210\031\022g\214\275\311\336)\005e"
+	.string	"b"
+	.string	"q"
+	.string	"\273:(\247N\t9\365\355$\3654\344\003\352\251Mc\177\247\377,\263\235\n\330\354,\301h\204s\002jw\301\tt\331+\365\246\224\371 +\"\2418{U\211 N?\334\363J|z|\214\2105\236\311\322\016\347:\0339G\304\033\317dwOt\231#\326\244\004Y\331]\313P\334\271An\273\305\366\002[&\005\364EW\001\013\331\245=\364Q<E\213/tj\027\030\365a5\206A>\374<\322(\356n\346\314\276\325\344\374\261\357\355\364\261=\351\257J\253\250t\365\244\345\224\376H\311\216\034\036\376\243\307n\207QjwT\251\304o\277}\337\350:\232\347\254bk\372^\344\343~t\233\354\267\231\357\316~\307\304\210\364\024\363\233\277\031Q\213q\031\022&\260H\226z\252\232GL!`\310\034\367\262\212\255i\250\316\027\256\027\001"
+	.string	"7x\224\356B&\347\002\003\203vi\024\352i\235\025H\212F\216\b9\355\n\307\265H\202vW\301C\035-Z\276\220\234\307\335\213\2621\r\361\320\344(ww6\347\217Q\376\311\322\341\250\221Q\016 \275{\251\276\350I\257\025g\321r\275^\365\001\253\230U\203\230\027\227\006\227\210[)\033b,\227\326\312\002\013|iY\301\300\026L\0060\245\304\261\013.\0300&\026\203\001\277\033\355D?\207\261gG\233\265:\343\355\222`\200\273\200\247\234\034k8\311p\021\234ze&\247\250\001\371\334q\016\352\221\255\t*<\360\007\325\327A\210 \037\232\316\231\247tF\033\336\374\261\374I\375&K7c\034G\036?\251\252; @\002c\020:\356\240\352\t\006\304\260\005\302\312\r\350\336\336\310]0l\r\307\366\350\354\212\212"
+	.string	"\312@\023\022\"\333\201GZF\331\264%Y@\016\221\361\017\031\316UR\235\225k\244\3042\";"
+	.string	"\f\353\007!\006\021;<\313\030\016H\034P\223e\b|\361\223b\261\303"
+	.ascii	"Q\2036\215\024 \216\003\333\001\222\035\270C\351$\323e\266\301"
+	.ascii	":\321\"\212\2759\026=X?^#\354\004spmL\324\021\021\026n\317\226"
+	.ascii	"\332|s[\253\364"
+	.text
+	.section	.gnu.lto_blackboxShouldLogGpsHomeFrame.179.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\r\003\235\026"
+	.string	"6\251\220I\240\230Q:\nf\334a\251\317\t\016\374\265c\201\304\277E;\254"
+	.string	"\377 H\007\006Uq\037\330\343\250\253F\017\374\3510-\241\374\025\216\276tp^\232\215o\301FY\307\205\356\307\201\003#\347\005\325\262\360\243\021\2627\2212\311}"
+	.string	"q"
+	.string	"\200"
+	.ascii	"J"
+	.string	"(5\252U\324\210\364\301bw\277\367\375\347\363\247\025uP\365\305\345\256\317.\353\362\273?\273\254M\240\340gk\002\206\200\242\300T+\267\032S(\005\276Z\305k\037\305)\303\346\332\036\350\243\250\244V=QA\322\355.\336x\302PJ\345\021\022;Vn\210C!V\216\210;\f@\225\324\244\225\263\205\007xD\216\356t.\312\0211\2135\224\322e\\N\367]}ww\273;\263\333\016\002\\EJ\346Z\332\330m\314b\226PJih\274\206\216\206\235\235y\311\355bBp\031\262\221R\312`\017|\324l\337t\2714\036>\356r\3173/\337wzLR\225\302\363\371\b\342\272\013\264q\367v\337\265\326\272\255\264;y]&oky[B^V\310\313\322\274+\311;J^\261yg\310+\2337l\336n^n\336\2770\322\221\321\210\022\257\001T\202Sf\262\272\231l\275\314diV\377\266\263\t\301\251"
+	.string	"c\351\013\t\356"
+	.string	"\030\005\235\310\356\355\252gg\230\021\034{\305\0370\305\036\373D1l?\016\304\302\205\233\233y)\366\002&\331\263\177\273r\036\357\201\263oZ\f0>\0166/e_\007Ua\354\032\230\260\"\"\354\336\206\335\335HS\262\007Y\242c\366\251\245\034a?Hp\3468nt?\b\376+p<#\335\275\345~\347\314`\"\024\033s\201\240\345\310b\260\r9/\016;\260\331+\326\343\341\345\"\260\264\016:=\257\0174Z\317\213\005\fz+-\317S\235\345\251>\313\205\220\332\021\356k\363N\037\253j\225\332!\376\265\331\322E\273\333\322[\023\324\266\r)\245t\354\336O\264H\001El%\b\323\245\300\017E\215\212\202\344\205\336\300l\265K\317$\377m\204\027\2210R*D\263\037r\"\023(\330\330\314\313V\377w\366A\271\340\371~SO\002? \220\002\021\272\263\003\340\365:\005L"
+	.ascii	"\006\032\t\336\345/\3131\"3h\233w\216\003\243\001\031p\253\236"
+	.ascii	"\031ged\213\244\343\373'\306\360\304Z!\360\215\227\037X\243\363"
+	.ascii	"\222B\f\330%y\274\031\006\242\224\215\324\022\240\340D\005vA"
+	.ascii	"\177h\300D\271\261\037\371z.X\020\026:\337H\367D\027\002@\362"
+	.ascii	"\263\275\271H\030\307\223q,\224\322Z(\375\034\341\220u\024`\340"
+	.ascii	"\022\200\313\321_3-t\376\254\265\t\275.\004\034o\3238V%\320="
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.180.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\001\002\265\017"
+	.string	"f\232^C"
+	.string	"\221(\035;\374\220\211\254by\031a\234\300\377Fh\244\207\261(\364+\317\274\352p\217\350\277{E\333\313}O\035\351\350X7V$\263\363Ej\375\255\3574\246\034\367\313\304\202\307\2264\213\366\336R\246\024J"
+	.string	"B"
+	.string	"P"
+	.ascii	"\273\034^86\006\272\220\260\375\314$\233F\200\013[B\320m@\255"
+	.ascii	"\330\330]MC\234t\3704I~\007\310&\325\225\0165&\177Xgr\005\320"
+	.ascii	"\225<\002\273{\023O\r\335)\263\003dw\235\251\256\303\035o[\201"
+	.ascii	"m\003v\216\002\251\307\360\341\364\023G!\342\217\360\bI>u\350"
+	.ascii	"\223\304\303+\306j\225P\231\362e\247\224RW\366\337\352\211\255"
+	.ascii	"i\216\246\263\247\261\227\336<\255\321t\3244\314\364\313\264"
+	.ascii	">\235O\337\243\200\210\226\207gx\005%\325\025\246\032\365\250"
+	.ascii	"\310(\311\033\336(\246G\3450\265\374\305\203\316\266\305\303"
+	.ascii	"\215\n\230\241\322\350]\250\034Q]_\371D\250\221\305[| \200@\361"
+	.ascii	"\020\352\001\226k\346\351\212PT}*W\021\n\341\270x\250\232\240"
+	.ascii	"\005\243JM\361T\215_$^\003\336>F\234'\264u\"x4\t\240N\210\266"
+	.ascii	"\211F\264\217\001\346&|D\032\005\216\023iY\312\376\255\236\200"
+	.ascii	"x\2111\351\tz\244\275\200A>e\325\322>]\3018L\003\013\254\026"
+	.ascii	"\024\031\216\306p\361L9/\0162\035\261XfT\237\350R\201\305\202"
+	.ascii	"\"\223\273\0337 \300\002\0311\243\007\340\252'\"t\252\004|\374"
+	.ascii	"Q\342\334\313e\355G\232\022\b\r1f\023\205\242fe\210\345\224\231"
+	.ascii	"%\340\321')\306\371\262\361\330\210\203\006LV\376nHq\243gw\366"
+	.ascii	"\302\331\270\363ay\032\336b+o\223w\363,v\220\250\331\370\305"
+	.ascii	"\252k\227:\2201\334 Gm\361+S\263\2436\312R\226\230&\032\212\016"
+	.ascii	"\3615X(\023\r\330\236<\374\364\326\3222"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.181.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\255\006\225$"
+	.string	"\346<\334Ip\032R:\223\b\005"
+	.string	"\202\234\2703qSc\241\362\304/S\200\201\231\316\355,\345\222+\225\267h\303\302\177\264\3718+\253\302\230\320\273\003\202\032\334\225\266\016\342\320`\275H\306>0\374{I\221\323x\367\266\344\023B\366N2\304"
+	.string	"\275"
+	.string	"\313"
+	.string	"\335\375\333}\2623\3337ct.\347\254+i9;\031\264\020{\025x\236\365jz"
+	.ascii	"\353\325n\273\307\fX\312D\007\311/\246359\347 \356z{\035_N\217"
+	.ascii	"\207\263\323\345X\334\252\246\370\266}\034Q\356\230$^\307\267"
+	.ascii	"\314Iy\264(\303|\r\211\225\006]a\201\352\245\300+P\246\257!\257"
+	.ascii	"\322\237\026\326\333\303\220^\227\207#\302YC\342x\030\322\352"
+	.ascii	"\356\226UW\267L\201aH\252\233\003\312r\232:\033\206\224\272\270"
+	.ascii	"5\344T\n<c\272\353\313\016\224\345\264\274\032\365\264\227\\"
+	.ascii	"\332%\215\027\247<M=\216\275\244\2144\250\f\2244/\373\245\221"
+	.ascii	",\336\213#\3129\367=&\235\336;\357\276\204\356\216\320\275*\b"
+	.ascii	"Z`:\240\\-\204\210\242\242\365\252\017\377\371\333,\273S\226"
+	.ascii	"\232|\340\026\256=XJ\253\007\021\315\0266\343]\323\375&w\"\354"
+	.ascii	"\363h#\022\367G\022\353\325\036\374%G\260%\232\343\212)\245t"
+	.ascii	"\243\335\316\342\305[\335\307\321h4\332X\253{w\033\270\273\375"
+	.ascii	"\323\335\376\311\335\356y\363\337\321\335\366\345n\363\330\333"
+	.ascii	",{\033\307\336^\331\333*\356v\212\273\215\327\333"
+	.string	"w\275} \003kL\240~t\313\271)\332&CU5\260>\332\227$\335\331\r\236X\304\222\224\374\311\342\316\306\220\205\n\213$?sqgCx~Q\343\242\373Gn\366\342\316>\331\263M,\347\274\273\332\375\242{w5\335\005Ubp\276\366\213\237\325\202]|\321\224S\240;\274\325o\177\254\300+ZE\216\240\331\302\346\313O\260\3760\020\257]\230\244\2127\3327\353\026\310\275\264L6g\343P\237\313\273\264B\372<\256vK\244\035k\307\326\253?|\263_fY\220+fS\207\264\036\017\221\200)p\237\3372\327\356\266\214\002\276J)Pc\256B\223\254\354\267\241V\345|+S\304D6\312\177\300`\371\301\022\226R\230b^8\274\365\344<|\207 \261b\201\207\177v\005\3057a.Pe\220\202\026\357\265\246L\332\352s\2735l\270J(\001w\007ws\360\200\246|\202\0321\361\207\032\340v\177"
+	.ascii	"q\177\354\203\311r\003-bb\233\241\"Z\245!V\237UH\036\214P\224"
+	.ascii	"\350\260\"\205\321p\230$\344\265P\250\305\321\b\023\302\242\023"
+	.ascii	"#\202)J\024\241\b\n"
+	.string	"\207HA\241_\037\2510\032\006W\034\035\r\203;\247\322\323\214\265Z\307\025\005U\302\305\031A\\O9\347\254\323\0065b\242O\032\221\034>\026\343\030\334\342U\272D\226\306\243o\334\340\332\214\245mO\276rV\254\342\017\351\005g\323>Mx\320\335\326\370\232\266i\350m\305\023\226j\311\273\265O\007\274\272\215z\232\366\306\317\353j\233\212\017\365t{k\366\214\260\371\350\341\255N1\306oN\035\215\231\237i\253p\264XX\330\001\233\216\223i\225l\316y\250/\346c\332\255\256v\271\\\257b\f\343\3516\326T\272Q\002\\\316.^\273\303\212\317\027\232\262\n\224\247&\200\225\250\2010D\221SlD\202H\222\202\024\322\001\260\002\221)2n\020Hgl&I\032\003`\303\241Y\322\364\222\303\024\326\276\215K\037\204\260n\033\340!p\3727z\263\204\244\265K\360~J\205\340\256\034\327%s\023\026\b\200\033\222"
+	.string	"\351Q3\230\007\013\240{e\r\036\366\276\376\3121\202\270\255xA\204\340\203P\210"
+	.string	"\345e\225\274\261\036\2440\021\243PQ\305\004T\200\305\247*j\202{a\373\363\365\006\336\345\220uh9u\005y\374@=6\362gv\316\205m\306:S\237\032E\255\001.\375\342\307\216\206\262j\333\365\252\037\210}!4\326\007!\006\205\002p\233h:\303LW\355\265\366\017\362\307\376\233\337\321\"\024\366\007G\006s=\027\001\251\346\036\236"
+	.string	"\321LM\265\223T:\214\300\377\\\253\bV"
+	.ascii	"{PB#\225\220\204\034C\306\035 \342\244\304\342\277\350g\260\022"
+	.ascii	"\240\340:\206y\377\270[\304\001\241\326\246\304\317q\306Z\007"
+	.ascii	"\251\022\236\363\334\222\261S0\032]\330|\2236ER]]\r"
+	.text
+	.section	.gnu.lto_blackboxResumeLogging.182.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`c\002e\024"
+	.string	"\246e\205J\260\022R:pu;\272<\331\300pE\374\320\213)\311}\331\021\262Vo\320\376C\251\326\370\231\337\367\220\022j};\251\007\024\305\212T\237\031\375\013\371\305\315\207$\005\314y8\026k,\207T\374\201\007\305\377k\225l\262wJ\001l"
+	.string	"e"
+	.string	"x"
+	.ascii	"{\237\025?=\300\335\020(\257f\320z\365\256\365i\037\351I\266"
+	.ascii	"+u\260k\227\210\006\324\356.\201SZ\257&'\021_\303\013\020_m\263"
+	.ascii	"\257\bx\330\233\202\037\236\035&\037\273\033\243&n{H\247\315"
+	.ascii	"\177\357\256Rw{\bt\032\226\024\215\310\032\321\341B\023\252\252"
+	.ascii	"\235\373>A\350rs\206\250\354\256g\251\363\271\353m\257\330v`"
+	.ascii	"\317\247~\n\323j\363eM|=%\177NYA:3h\357p\223\032\331\017wwM\213"
+	.ascii	"\354:\375\n\231v\211\323\255+\375a\235~\200\003:x\200\036\264"
+	.ascii	"c\267"
+	.string	"'\bd\253\252\224\212\363~\373~\323\1777_2\313\323\324\215}\246\373l\230q\276\344\327\357\351hwa\2576\216\r{\235\357\031f\357\356\302v^\316\327'\247\2220\301\305\205\376w\024\235\214\243\251\253Y.\202W\253\334f\220p\300\374\322{\026N\222s\002\016!\225#\277 \372>\f\031\346KWz\373\017\022\301&J\215<\177\"\276\350K\317Fn\3760\200`0\310\343'\242\213\276\350?\f\341\240\036%\233\215\243\370\352\242\367\335\300O\217\023CIA!\2655\314\374b\264\020:\265a\336\213\021\311\261\273\013^b\035\306\235b\002#\315\206f$E\032\227\221\006C\241Ff$I\233\231\210g)\034j/13\331\206\227\230\f\214\214\026\233\2214\261\224\022\327fF2VS\253\2211\330N\347\341\322\"\277JDU\351P\234s\302]\242\006\347\375@\336\f\272\300\f\251\375`e\276\364{\177I\261"
+	.string	"f\001s\364f\237E\364q\334\212\005BK\213\370\n\263B\361\242\304\022\271L\274QA\204/K\250EkD\230\0212 \200\002\021;\252\003 \352\315C30\206:\t\350\2009%\n\033\311\336;\031~\255\t-\262XB\266\003\016\005\370\310-\356\234\35496v\231\225\231\220w\002T7\240"
+	.ascii	"n:R\263\314\315\262\326V\227\265V\312rJ)\234G\306b\326\271\262"
+	.ascii	"Z[\272>\226R\247\344\303\206\301\230\030\016F\224\306\272p\251"
+	.ascii	"\242\b\017\367^\270LE\272<\321\344\024M\354\001"
+	.text
+	.section	.gnu.lto_blackboxUpdate.183.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\264&\305\200"
+	.string	"\n\272\b*N0R\332\031\003W-\025\\\206Y\021BxV\364\257\326U"
+	.ascii	"\371\233\nV\257\353\362\204\275\340j\270\255\230\007\004N\235"
+	.ascii	"H}\325\305+\343.\016\204\021\004A\020\025\021A\020UU\315n\317"
+	.ascii	".\233r\351f"
+	.string	"E\360\343ED\215%\366\312-SJ)\230\002P\002\230\002\274\032\235\2072\316*\353\3742\316^t\356\246\312\200\016yg\326\304\365\\\306\336 \3231otX\245\213\350\315\334|\034@\325\232{\335\006}k\352\275]\311s\213*\235x-\024\257i\007\305\253\353\250\216\036\343\365\017\312\327\324\301L\367\206\247t\312]\020\006*n\350\004\207\247t\302\235\271a@\005\312J\226\346\373\276lN\246p\241\"c\n\230\264Vk\001\307\t\257\252\005)\ru\241\307\270\211\244\235\t\272\300\214\246nq*\247\336\367\205\322f0\364\030\177\033\027\030\230\373I\223\311\320c<l\343\303S:\337\3675\366\220Y\006fc\017o\332\231\333\331O\267\235\320\3002\357\273t\262\366\276c.\370E\261\207>\215\263\366P\355\021k\017\331e\366\3531\254\327D\323\226\222\231\340\373\276D\177\325n3\032\237\261\031C\3412&\343'<\326"
+	.string	"\003\013(0CF\002\b\034\020\303\200\002`\0200\200"
+	.string	"D/\\\004"
+	.string	"\300\220P\013\026+\202T"
+	.string	"\245\370\361A\321\303\263sB\307D\t\022987#D\204\260\001QC3cde\212\304u\250\276\273\334\256F\207\274\2032\035\233\321\316lp6\203BV\203s\331\017g2~\242\302H\022\234\232\021\243\204\227\263D\372p\036K\252>*\221%\262\2077"
+	.string	"\244\227K\323\025\347\210\233\326\315\022\031\344\031P\235\226VAz\201\235%2\b\241+P8\306g\240\311\030L@*\306\021\030\024\364\003\212[\242\244\276\3040\200\230\025\345\317\257\013\350\343s\030}=8\001{=\200\252\243\234s\n\322b\305\327_K]\\"
+	.ascii	"\275.N\264W\347/\304\326\\\004@,\002`N\316\207\250\264j\225\265"
+	.ascii	"F\327Bq\336\002\313\025g\201\205\212\257 \026M\220\365\214:\245"
+	.ascii	"Aj\255B\355k)\315\201\324\246x\212\037)\356c\005\205\230\367"
+	.ascii	"\270\361\330=}\007\356D\230\353\304\231\220+\001\326t\022]\236"
+	.ascii	"C\207\263\3457H|\204\235\210\301#\036\"\313m\362@\020\213\364"
+	.ascii	"\272\231j\224N\203\003\225\317|\375\330-M\271\221X\304\327@Y"
+	.ascii	"kN0\366\006\227\361)\2528Z\254\370\332n\t"
+	.string	"J\035R\3169\265X\377|-E9q\345\341\303\237\245\220\301V\325\241?\2660m\2674\250\342\004\341J\266X\373\017&$\177/Yx\200Fq\342\334\201K\013KJ)\211eB\256\352\373\276\275\\\032\264qb\321\373\276\354I&!\315\0254\363jdf\017\230\177*\bR\032\253\036\310\330\253.~/a8\363\320\256\324\332c\276\203[\244\370\276<\232\016\346R\2518\270E\326\"\253k\3452\275\223\305\277\251beI\372\227\364G\326A\203K\222!\376\360g\226eY\360\332\315Z\327'\376\316\026\036J\244O\257|\211\233\325s\314\256\226+q\267\032N\357}\337\030=dO\342_n\227\233\304U\342*Y{\270~\317u\trf\267\211\013\346\235\034\376\372T\205\374c\377\261\205)~\273\317U\375\2430\337r\237\305\367E\212\301\256\345H\\1n$=d\007 \200\340c\200B\001s\262\303\247\022\200"
+	.ascii	"\275\372\"\330CWuQ\342\216\267\264\231a\260\340*.\212\264\332"
+	.ascii	"X\377\217t\2349\003\r\274\223\377\275w\005\326\201\355U\302\274"
+	.ascii	"\244\303g2o\340F\304\3448\263\007 x'\271\367\214H\243\310?\262"
+	.ascii	"hpI*\317z\364>\224\355!\271\030\356\346Y\375\217\236]\t\n\351"
+	.ascii	"U^$\004\021F\030a\355\241?\013R\350\244\355C\213hR%\370wt\302"
+	.ascii	"\177\246S\261+AH\321s6o`\227\252\031\363\304\016EC\347\304>d"
+	.ascii	"F\215\211]\210Q\314\313m`\017\302>e\371\017\366\032d\300\306"
+	.ascii	"\234\315\036\354>\212]\177\236\304\316\203H\347;\330\221+\222"
+	.ascii	"\350\224\375\035\016qz\215\341&T\263\376\234M)\267\230\357\252"
+	.ascii	"c\223\027\2570\334?8\325\025g\363\255\002\344\006\303~\305n\022"
+	.ascii	"\222d\244\326\234B\375\205\231\375\324<0\307Vz\362\025R\337,"
+	.ascii	"/dn\277\366B\002"
+	.string	"7\022.\201\206w\222\306\332\303\376\016\324\360\224O\250\035>e\036C\3723\231\373\247\323\351 \177\016\314\254\263\016\031\347#\032\347\025f\234s\030\235\215h\234q\030\235o\030\235U0:\3330:\247`t\256at\016\241\235t\317(:\017\025\235\205\212\316-Xg\0262\316+X\347 \326Y\005\353\fdtNat\3761:\373\260\316(f\234{Xg\036\326y\307\350|\202u\326a\235M\260\316%Xg\022\254s\016\353\214\303:\337\024\235G\260\316\"X\347\020\254\263\r\353\f\202u\256a\235iX\347\031\326\331\310:\263\254\263\f\353\\4:\023\215\036?\"\330D|\357u5-\375\360\3473%\264\3624(d\n\235 \212\020VB\310E\221\\n@\002\227z~p\033>\320\r\360}\b\024\374?\267f\317\236<6\255\233\315\367\036WX\024\311\245$\t\370\356\360\355\301\351\3118\315!Q:\301\234"
+	.ascii	"\361"
+	.string	"9t\217}^+\267\245\317\364\356Z9-o\327\302\305\265rrU@|\017\323\3169U\252\213\352\374\034\023\226\216\353\240$mK\224\317\251\037WHX\201\206\267X\013\265\301E\225N\023o=\332\344\252\310\261\255\311\361\240&W\242\246\245s\233\274\346\207NpH\224O(\0224\237\354!Z{w\006\245\275#\373\262\266NK{wg\205\346{\230;L=\221\344\326r\236Iat`t\315&t:,\241\303\271\001\264\305d\242\302\337\210&\361R\341;z3\363\\[.\036I\313e\235\322\372,.\355\226\307\372\253\226KCA\371\214\020\255\332\276eU\333\247|\034\332.=\264}}h3\337\303T\242%\345\307\270\021\037\345;\376i\310\017\321z\247o\262c\367\351\231~\311\256\370\276\257\b\033N\346\227s\351\024\336\006\036\267\201\017\344kH\341\033\317\346}\337\020\306O6\267{\\\375{\264\200\257\324"
+	.string	"\326'\265\200\217|\244\326K\373\245\005\\[\300\265\207"
+	.string	"4G1~\017\263k\314`!\334\230M\241'\215\311\023\223'\025\314\013\023\230\327ja\224\227&1PK\016 "
+	.ascii	"\247_\364\274\350\371\365\265^\017{z\316\026\250\245\346I\327"
+	.ascii	"\370:\246\326\021\360\256\213\315\333-\326\020\276\306\257[\224"
+	.ascii	"\240\220{\334\006z^+\335\022\302\367^\373Sl\211\3629\264\352"
+	.ascii	"\201\214\206\215\300\373\355V\2722\267\203-\241w\222}\207\036"
+	.ascii	"\211\213\"\315\310\024y\217\271\226\250\373\3544\027^\347&\255"
+	.ascii	"SY\346\334\243\002\3206Av\221.\347>Y\350\005\340X\334\244\206"
+	.ascii	"\202\2725\337\027\t\201\036\306\255\0034\273\275\271?@`\265\271"
+	.ascii	"[C\301z_\0366\315}c^\305\375\261\346l\256\222\017\367\307\217"
+	.ascii	"5)\315n+\263\013\304\r\342\235\224\371\036\346\021\347{\303\037"
+	.ascii	"\217\210\rv\2135[\305J\324\370Lv)\016\265\3412\271Mn\323\332"
+	.ascii	"C\343]\026Z\322\2071\315\355\347h\037\334p&\235z\321C\334\214"
+	.ascii	"\335r\260\370\240\270[8Xe\275\024\345E\260\371\330}\36217\013"
+	.ascii	"\007K\254\215\362"
+	.string	"\322\004\263\303\247O\277\"\326\273\364V5_\263gaK\001\214\302\213\023n\324`\201\b\207\321\215\033F4L\350\360\340\204\0335:`\001\307\tGG-\320\240a\032/^02\301\006\215\022T0\201\bG\215\022n\020\3218\322A\364\002\005\033\3458\341\210\210\005#\243#\"\343\330\216\376\0348\311$0\272\343\221\254Ji.z)\2002a\013\261\254\223\233`\350{97\3643\250Q\221\252j\255$*\375\223"
+	.string	"\213\223\026^\023L\223\265L-\205k*\303|*#\320\361&\224\355\301\351\370&k !t\202\312\347\216\323\263\t\201\320\236\233P\332\003M\276\307D\212\255\253\317\201g\266\370\376*\353R\245\305\267\223\332\031\330\220\333\221\267\"\026\337\313!,\336\241L\236\324)\355L\204D\331\355\210\233V\003<\260J\205g\355\241\322KMc\267\222\362\341\245B3x\273\002\243\n\311\013\231\271}R\243\270O\025m\305\3138\361U1\360L\263^\222V\310\323\351t\272@\320\367\262,(\310\211\013\337\0231\263\236N\247\205\n\250x\023\242T\324`\205\252J\372\367\327\\ttB\302\031jX\003\252`hR \320\311"
+	.ascii	"\372\232\035\250\200\236\250$\201\024\357\363\357\327Q~>\305"
+	.ascii	"\357\230\251o\252\233\236\372\365\363\375\346\363=\255B\"\200"
+	.ascii	"\"\207\367\024i\255\274\223(\336\207\347{\276\271\230</#\355"
+	.ascii	"M:\325C_\007\204}\351\020\343\n\204/\257\022a\272\302\030\360"
+	.ascii	"EE\364\261\226,\300G\257\020\305\210U\221\254\025\276\2418M\254"
+	.ascii	"A\030;W;\377mxK\224O\002\230m\232Y\263\370\005\0253@\326\232"
+	.ascii	"Cidy\004\274\2533\372\034_\"P\251\360\304\317x\243o\265\006\342"
+	.ascii	"\352\n\202v\346\205T\213"
+	.string	"\250K\032\264\332\255\255\265\207'\276\333\272\b\240\363](\244\363\035Ed\202\312\304\313H\203\002\326E\030EF\365P\227\364\005\240\213$\355\023\357\312\022\200\222\270\232\367}\001(\361\315\245C\211&\"\204\320K\372\207\374\343\316\373\276C*\021'\325I\025B\245\3313\266*\251J\342i\234,5!\361M\227\345-r\376\277\324\244\316\371\376R\205\364\307f\201\363G*\020\033`n\023\316\313\230\002\006\f\212H\017u\205E\217N\270\"'\254\253IP\t>\343\231[\261\366IW\222(\322\037U<\223\271\333\262\025\307\034\023P\013\340]\027UI\355\321\226\231\265h\216\266\366\020\3077[\263\270\233V)\237P@7\"\370\210n\247\250\265T\274\22378D\275\251\207\272\244R\214x\037\244?\252;F\274\214)[\300\002\203,\250\002q-\315J\247fD\202H\222\202$\303\030\022\f\020\206\002I\b\275\353\001\022"
+	.string	"\3630I\204,\203J\215\314\310(HR\243\322\034b\021hpN\303\273D\325\234!\277\007\220\007Y\n\313/Wo,\t\276X\t\343\337YE\033B\241.C5\307\271\007t\236\206\177\232\001\267q\223\314\017\244\237\367n\343\323_\272\316IN\255\2505B\002\270\324\016\303:\225\357\312\364kD6aT\332\224\340\035\324X\004\2715\246'm\213I\377\322LZzh\"\207\230|\332\226_\3246\230\254^\206\340o\250\026\f\375\201\026K\352\353\335{\210\272/\242V\216\3513e\367\301\237O\364\032\300\200n\304\205\314\342\035\236+\236\\\001\335N\005\334\201\257\330\317A\317\3217\271f\r`\224\322x\002r\264@3;\223\277\fH\220\322\226{|*ql^\033\324\201\215\211\037c\322\313D\023HP\001=~3q"
+	.string	"B\312t\241\360\033m\2405\340\035\340n\345\362+}i\027\340\271\332\265\364\243\227\233\3608@\f\327(G\235U\344\3540\342\316\351\240\\p\202\r\352b\242\317"
+	.string	"P\212H\301\275!\313p\214q+8%\036F\\\214\3063\032\227\223S\377JX\243\t2\206/\212\366\222Ve\325\237\250\373\021\027\334\213\352\263\254\033V{(\257/:O"
+	.ascii	"\254XM\270p&p\255\355Y\361\200\312\r\376\263<\250\224\373H\001"
+	.string	"\3656CC{\264k6\n7\r\242\322\351w\350\230\322\274\227\352|\217\210\351\200u\343!0\025\361]v\302\362\256\b\350\017q[\267\023U\263'G\3241\225Tu\341g\363\252\2037\326\031\301\202\202J\331\2378$\315t\200>dtEQ\"LT-\027#\031\245\210\335\215\343\367\243\033\372s\232\177\021_@\353\030\320\274w\320p\336i\340Y%\206\247I8\034\367]\260\315\263\307\373\372S\361\361Y\337\325=\017|A\262P\007\024\257\177\023\3070\265\220\311\327\007-\362v\350\254\213\023\263\345\004|&\322\226\007\325\005\361X(\327\346d\347\274\311\006%\177\023\203\354\351q\202OJ\3234o<\202N\222\363+\255]'S.\355\377\244\361c\316\360\351\307\306S\023\2467\240R\314#\004\241\351Y\221\260c\262E\345z\343\f\341\252\271\366\346\031\336k\257\231;\363\336\222\213|P\202\207\312-\304\376\3006\272"
+	.string	"\241 #\204\270i\"'$\032\023\225fV\306\277\271u\244\257\247\337|\302w\325;\344g~K\036\325d\334g\352\377*\321\247\245\203\t;\263\232$\022%K\263\312\265\237\345\032\254zd\2415s\0220<"
+	.string	"\277&]W)W\273[\234&\337\357\005P]\240\r"
+	.string	"\244p\241ttu\372\343\024\007\276\225J\254\213\302h\001\346g%b#\250\023\356\247\306\037\303\224>\221$\\\3637\350\030\266\341\337\013K%\214\305$\367\364a\313\266\001o\001oE,\271\331\366\024\235\245\004B~\215\025\332Y\315\300\002\215U\336]\303\b\351\331\350\227\315\367\272\306\333-\260\223|\005F\033!z1aL\274\362s\"g\301c\204\333a6\233\f\261\213\007\272M\002b\016\214g\264\301w|\313\350\377\023\2043\007\316\333\244I\341Y\222Vu\220L_>\370\033o\013 \365O\373\346\371<N\034\007]0a\2542\273P\201.\361\006\270^%\204\230\026\262:y\206\334\301\355G\230W\202V\307\n;E-\277\005c)\200\272\030\273/\373\201Vl-SXk\350\006%\243"
+	.string	"\211K\b\020"
+	.string	"\221j^\224H\031\234\200JE\373e\220\001\3670\222\315\fo\237\243\\y.\002\"\352\324m=v\247\255\017Rq\325\334\032\274F\302\351H\375"
+	.string	"\243@$\235\0377g\251d\260\350\031mA\305\255\002\\\335\225\320\006%\353\316\024g#\362\b\323\206\007\n\330\2224\233h\002\nv\201b\354\375\214tv\r#\302\323,L\367i\277\226\262\022\375da\273\223\274\342\b\2308I<\372m\027\rmf{Z\366K\263\355v\250\335\360\3228\354\320\002\037\362\375\323\220t\256\347MY$\260%\323$P\223\370\305\303\327\022\340\244\270v\017.\213F\360&\240\334r\242\204,k\357e$_\307\202\274]\276\335\222\352\373\027\340}\001\005!\031\263\314\244\377r\006\251\314\260d3\235RS/\245s|\256\301\247\342\"\213xa\016\002x9\336-\364\254\236\020\302c\251\326@\032\373Gp%\347\207\024\230\226\253\2140T\013\021\r\004\234\212"
+	.ascii	"\231f\300\266\001<\277\020\234\177f7`\202\006\316\002\266\330"
+	.ascii	"\302\024\363\036\007\004\n{\033\007\357\217\027\02143\221'\345"
+	.ascii	"\036\264\004\265\222(]\030\203\346H\251l\n\347\b!CwB\316_B\364"
+	.ascii	"\210\313\3422\315{\374\335\036\253\277\334\364\177\206Mc\003"
+	.ascii	"\256"
+	.ascii	"'rmG\024\217\025\030\267\230\3228\323\266K\\\361\223\005H\005"
+	.ascii	"\231<\205\230\321.\007\334\024y\336\232I\235l\307s\023\207\222"
+	.ascii	"\0322\262'\311j\t\345V,\035\377\301\006|\274\243\327\274\177"
+	.ascii	"\367\375\215\320\311\336L.\243p\364\325L\t/p\207Wa\371\262\243"
+	.ascii	"\036\2403\235\007&`\255q\354.\030s8'\017\034\335YPt\334P\323"
+	.ascii	"\234nP\n\3258R\323\222T\204(\265\240QR\237\005\3751\312\344\020"
+	.text
+	.section	.gnu.lto_blackboxCalculatePDenom.184.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\325\t"
+	.string	"\246\322B;@\245*\035\365\345~6\376L\335\367F\377\251A\216p\021w0E`\377\256\347R\256\306\030Y.\026\330\346\031\001\244\260\016\253IXjFm\304$\372\2225\260m\033!\233H\231R2"
+	.string	"0"
+	.string	"."
+	.string	"\206i!\307\352\202\321J\275\n\354n\227\371e{\324N\260=\352\306\301'\350\177\344\013\0231\002\252U\351\311!\354\256S\265\252\270\365\2665\266\017\354_\002\361i}:3}\212F6\300\3421\331.\305\314\300\n\210"
+	.string	">l\203\266\305\016\003\030<\3572\314\225\335\f\223\223\335-\360\206\362h\333\027y\013tQSU\217\0029\345\314\327\324\247\016\234\344%#\337\303\021\244\274\212\264=^1\035\027\246\234\331a)U\303\276\266\312\262\237\346\036\376\333]\177 /\364I\250\200F\n\037\021\347\343\354\331Hx\235\006\017\307\241\323\205\0308\240\316\363At\033\214\275\207\317\327\211<\357\353,\341^[eq\2321\351\311\233\252r\032_\250\220\021"
+	.ascii	"+!\201\245\236L\350\f\n\\\374b\201\031\314\320S\004\306.\327"
+	.ascii	"p\020Z\300&\204\003\346@f`DP\001\007\240\362\230\332I\006"
+	.text
+	.section	.gnu.lto_blackboxGetRateDenom.185.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375 \373\325\006"
+	.string	"r\314.5@o\222\016\233B8\374l>&\264\246\233\222.\274"
+	.string	"l?o\251\035\233\330o\233\216\035QP\241\374\372\r\f\303\34394\017l9\334\236\363\036Tnv\023\231\002W\234\013\313\343Pu\036</\242\241\003\361\252k\342q\b\266$\030\256GaY\327\323lY$!\026\204\020\343\"bE1-\251I\305-m\361q\325J\335\017@\251\242\200G\310\235~\313\034\206|3\211\244\337\215\316\335\314\306\245\324Q\223J\346\306\t&Y\250\224\221\037\364\232\021\022@c\003\031Y\213\301\007\212\350\344%s{(R\254\016\273%\351\202\206iE\033eu\001\n\231\271\323F\034\035\373o\376\203\037$\n"
+	.ascii	"`\251'\0230\2013\3348T\204\272\3175<e\304[B\220p\347L\355|\002"
+	.text
+	.section	.gnu.lto_blackboxGetPRatio.186.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"\245\b"
+	.string	"\006\32096Po\322\001\203\276j\336 \354\360\2410\310!\264H4\263V\335\275\307\0064B\322li\026?\273qDA\377,\221rcj$\374\265E\367\206a\t\331[\312\224\002)"
+	.string	"+"
+	.string	"'"
+	.string	".sr1\340\003\324\241^\200:\\\215cW\314?\310\027LVJ\266Rv\255\024\346\234\326\255tq\357m\033\330N\260\375\022\352j\325p\325\357\251w\325\252\352g\240I\345-)sZt0\223\005\242p\330\026\331\032\337\343\037\"c\007\024Z\206`:!\221\004\336}\"\037\361|\244\374\352\236\024\363\220s\021\376\206A!\375v\350\207\250\303/"
+	.string	"\206\246\235\315e\272\031\366\337\334\223\355\2666\023\262\343\2618\016\235\370\320\300\371D\353\002\305\r\201%\004\303\025%\244\274\242\206\233\177sO\325\026h;2\334\352\255.\334Wt\214\264\013\020"
+	.string	"`\251'\023\372\377\201\221\026\220\"\220\005\226"
+	.ascii	"\213M\223S\306\332\246\322D\250\366\\\310A`\006\263`d\270VL\302"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_blackboxCalculateSampleRate.187.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\205\002u\024"
+	.string	"v(\210H\320\360(\035\245\333\001\037\327n\344\364>\372\t3\246\230\271\376S\025\210Vl`\036c\274\020I\223xh:~\021%\325TYPy\231\342\001h\361"
+	.string	"m\365\360\003\314<\370Q\306I\365\345E\373\253\375F\310\336$I\231\002v"
+	.string	"e"
+	.string	"t"
+	.string	"KsN\330\335\230-\242\n\017\266g\354\224\355\257\255!T\304\214\376@p\2343\203Q\2129q&>\0015\262\324%5\256\266\244F\3336\200`\3063\230\r\215\306"
+	.string	"\035\"\033\220\2159q\261o\320\231\312\350}g\326\017\005t!\241\b\306\r\207\246\262\202F\233p\275\034\375\n\247\346\225\3149u\204\356\rN\315\356\2072\347\364\336p(\250?\265-\263}\300\336\025\001Z\302\305\332\3012\230\325\233F+\314O\026D\256\217H6\035\315\356l\034m\337c\2537\347\234>\217\355\365\210\376\250\212|\r\363:D\256_r\355\222k\020\271n\311\365G\\{\3045+\256;\344z\025\327\034q\255\212\353T\\\243\342\372\024\327`\\\177q-\343:zk\317[\337[\257\267\326"
+	.ascii	"Q\247H_\004K\266\234\025\352\251\307\240\\\270\243\316\311\323"
+	.ascii	"Q\217A@\241\016v\360\247_FS\250\253\355\016&\337\363\212\347"
+	.ascii	"\361\336:\223\022\204\317\202:\223!\2779\241\340\265F\f\225\367"
+	.ascii	"\036\224q4\3359'\355;5\013\t^Q\3140aT\263L\376\016\276eH\376"
+	.ascii	"\273IS\274<\311\322M\311{<I\316\246\373\225i\252\213\364\016"
+	.ascii	"\240(\364\251\355\316{\375\257\341\207\232\222\b2\026\231\024"
+	.ascii	"\005/\322+'\017d*-+)\fTb\rXR\\b+1\016b'\002,{Y\020\023\223\221"
+	.ascii	"\311bb)\334\324H@?\"\016\036\b\033y\t\315kV }}\344\352\372\353"
+	.ascii	"\260#\220\273\236`\350\246\024\362\326A\376\013E\037_\275u\r"
+	.ascii	"w<\376\301z\004\217G!$!\3558\353_R.\334)\240\247w\374K\002\n"
+	.ascii	"u\034_=\n\345l:\325g\0328~\fG\241\217\246\256z\f\n. p\2422Ww"
+	.ascii	"`\352\2411 \023\207q\0201\353\020:t\253\322\200o\";\310\317\221"
+	.ascii	"\b.x\235\355\0238\247h\263\302\344\032-\217fc\267jw\266+\261"
+	.ascii	"\035R\372\003j\325\352\034\270\330\373L\262],TU2\200d\2665\312"
+	.ascii	"\206\377\301\t\b\327%\202\266\341^\2416\354\240\252\247\020\027"
+	.ascii	"\017T\231\345\213\031e5\266K\225\001"
+	.text
+	.section	.gnu.lto_blackboxInit.188.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\013\004E\031"
+	.string	"6\353\227H\260\030U:\b"
+	.string	"\037\232\217\306\353\255l\336\200bE\2644\257\232LC\302\346:\357f\202\016\220\214\213\032h\277\215\331\343\216\n\375\234nP\215\217\213\245f{\350\345Ok{\366\323\206\306\303\373\203\316\341f\311&D\356\224\002\177"
+	.string	"\200"
+	.string	"\203"
+	.ascii	"\265\232\030f\251B\343\220\031\266\357\357xN\304m.\355\254\364"
+	.ascii	"\210\260q\017x\364\376\363\333\210\333\214\200g\372h\217\260"
+	.ascii	"M\037\327\344\322.:N\247\002h\341\213\365\270Rk=\255\214\227"
+	.ascii	"'\351(\356,}2\206\307\313\r\001\315pN\336N\222\315V\234\2221"
+	.ascii	"\270\317\234\235k\bh\266\342#\214\304\024S|[f/q@\255\365\265"
+	.ascii	"\317\0223\327\234dL\255\325S6Cq\217n\373e\373\200->\b{X\016\327"
+	.ascii	"\034\232\210\312\302\352\373\332_\210\244\020\275\370a\361r_"
+	.ascii	"\310\207\\\300@C\223\2633\354\tR\343\"\354\035\310w)\326\216"
+	.ascii	"\260\307\206\372?\016d\223\341\346\206~t\t\366\256\242~\217\353"
+	.ascii	"T>\2177\254\346e+\372\361\271\023\370\005y\362\302V\2455\207"
+	.ascii	"6\3165\227f_\254\033\303\246\323&:]\032\247I\342\364\210\234"
+	.ascii	"&\3514\245\323\3438-\212\323\273\323s\247\037\240\200\f\236\024"
+	.ascii	"_\022\024Spfp|\003JZT\316g+x\023\"\322\262x<|n\342\322,C\231"
+	.ascii	"\200\330\t\257\314Z+\316.m\264\273\250\\\222\327\304brG\333\002"
+	.ascii	"%\310ILH\256\277\344A2\013ffd?\272\344\316\340\270\006Nw\225"
+	.ascii	"\300\262\210;\356cB\233\301\2234\030\325\372J\340\0379\022\007"
+	.ascii	">\317GC\210\020\201~\024\367\266]"
+	.string	"\020x\333\365\215\274'aB\205\n\364\343\f\312~sww\027\023\356\261\324\253\350\fN\301\204X\241T\251\032\r\250\023\207\233\232\r\247\024\313\303\tF\200W\035lX\247\017\253\025\353d\302\265.\326\215\341R\216\232Pk]6-\360B\r\232yY\275\213\320\322\232\3660\032\256\322x\203\247\3139\361!$\2276\345VL\345\366\353\370T\b\321\245\271\264A\375\242K)m\340(}|\350G\323\320\216\017\331\357e\215\372\276G)k\345O\251\243\324A?R\310\321\001]\264\346\360I\321H\247\236\2500\252\313\307\343^\322\t\201\001\f^\250a4\310\230!\b\022\022R\222$\205\306\240\002\221)\253y\021\320\255\222H\332j3\240\375B[\032i\203\013\257\301\343_C1l\243\310\366!\366\250\242:\331h\363\311Ox\337?\004\325e\3714\363\353\305P\212Mb\202V\320\"\n\222\367\370\"\224\275\225\034\326\341"
+	.string	"s\333\024.\272\326\363%B\252\022k3\020\230~R&\243\fR\355\371)p\314\236_5\3716\314\304\360\3274UB\302Ds\003\036\006\264\203^\234(\305\224\272\260$!\022\026\276\\\377Y\330\247"
+	.ascii	"a\b\372I\321\314\033l\247\247hn\343,<m%a\211!\263\t\355u\210"
+	.ascii	"\3542\177\003a\274\3777U\202\341S\232\233~\212\270\2671F\r"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.291.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\265\013"
+	.string	"\346\024K@ \213*\035H1\"$\004\220$\206ji\020/\302\257\tcXwi2\030W%~\271\234F\276\275|\f\001\307f\307@{g\230"
+	.string	"\243\006\260\020\211\005:\216\322+\036\013\341\3574\"{K\231R7"
+	.string	"6"
+	.string	":"
+	.string	"[\312\360NR\260\f\273\273=\352\201\223\0165#\311\247` :\257t\230\235'\340\032\341\241`\305\356\276\3654\361N\231\022\217\024\314\356\372a\300\255\335\266\206m\f\373\235*S\316RY\326x\270\272\2625\035a\032jZ3\235\231~%\277\013\n\273"
+	.string	"f\034\266@\214\260\300~kd[,\217o`{d\307\356B\260\001L\262c\023$\001\250\334`\250Q\237\222\231`\177\300\361p\234\366\b\325\"\201J5a)Y\352\353\035\272\013\377G\273\246\276\204\300)g\366\035\334\365\361\0258$\312w\217\276H{\274n|\0204\004\336\\B8\rg\223\351h6\217\216\214g\333\200B\333\205\302\334\007\007h\003\3418\320f\261\235\207\253+W\fL\260`\322\023T\226?\332'\362I`\200A\237\273[Re9\252\352\310\253B\036"
+	.ascii	"g\325\253\333\030D\004\2634\"\005+\020\002\006\007?$X\2073\006"
+	.ascii	"\232\300\302Yp\347\005\213OC`\261\2458\003U\026\002\242`\230"
+	.ascii	"+\334\035&\b\316\210E\235\013Lw\032\030\256\275\242pijJp\353"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureSample.part.0.374.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\257\004\225\035"
+	.string	"\0265\270H\240\330M:\003\016\233\007z\342K/L\370\345\360C\341a\366L\tK\301h\f)\312X\207\343\216e\342\260\337\326\265\0027\177\322\322\257\267\361%\267\321>\267[Co\244\247&\306\372\026\365\224u\375m\2334\262\211\334)\005\234"
+	.string	"\232"
+	.string	"\242"
+	.ascii	"%y\363\234/}\037\272\020\313\032d\362\234\366\207\234\310\357"
+	.ascii	"C\027\256\325\n\345\305\244\326\262\301\251m\310S\232\017\030"
+	.string	"O\305\013\030O\355\007\261\355c\362\317\006{\251\243\"\030n%Y\215\325Zw\247\233\303{\261\274\307\371;I\033\251\270\263\366\363mA\242\223\nh\"\200Zk.\230$:\2001\307\t\3441\343\364[\247Qfb\300\340\214\213c\224Y)\204\f\252\311\351+\336d\005\265r\301#\021\347\003\254\307\263>e\004\215\346\f\360\032\215B\255\325/\242q\333n{\207m\016\2668\025^\034\266\2566\235#\247q\264\351\231\332\364\215\234\266\321\246k\327\272\311\227?\215N\217\307\272\3518-\216\323;NO:}\002b\023%\335S\255Kge\325\006\345\242:\326\177\344\327\372\332\367\225<\211\277\245\3453\315Q]\342\256\327\246\372\030cC00\265\326\rd\221\373E|>\222g\371\206\345\233\007\276_\2550\rQY\227n\036\374~\265\342\025\251\016M\r\277,\220\247G|\267\032\232\005\312\332\304\344W\335\310\357VC"
+	.string	"*\225\372&\034C.`j-\031\234Z\002y\352\227\342\241&K\224\177}"
+	.ascii	"\021b\036\030b<\255\355\267.\226\t\305\310\270\266\326JDik\213"
+	.ascii	"\270\327\b\b\3020\b\266[\034\n\211\207\t\307Dp\362'%\374\251"
+	.ascii	"S\363t\206\306S\034a\030Y\215\375k\255U4\260D\246\306U](\357"
+	.ascii	"\025\224\241R\332\225\362\270ts\252\264\034M2]\275qq\204_\200"
+	.ascii	"8\211Kw~\351\356\256qW\\\332\222$\247\232\317\335=\322\223\321"
+	.ascii	"<\363w\356\223\314\374&\347:\341Oy\207g\036x\352\363\214\247"
+	.ascii	"\337g\235>\021\202\2219\025\315\263\271R\336\332o\224\241R\n"
+	.ascii	";7\301\353e\020b\321\363!{(R\364\360\202\306 \020\275\236\035"
+	.ascii	"\034!\237\036\020\220\n\035\234ulX\374\344\360\350\360P\344\354"
+	.ascii	"|vx=;\035\240\240\235M\002\377\244\350\001\355\204~~\200v\267"
+	.ascii	"S(Z#\222n\230g}\001\224\221\251\247!N\264\2252\315\213\352v\267"
+	.ascii	"\210\fN\256\214\006'\367D\252\266\354\305Zsru\253\2132\023Cz"
+	.ascii	"\312}\371\r\017\206a\202\260\354\207\227.\270\315\315\340\264"
+	.ascii	"Tx\026,3\373BX\006\204\353\266W, \270p+\030&\b\305\306\252P9"
+	.ascii	"P\214mo\273W\222\314\016\314\332\332\0328\214\007\332\226\346"
+	.ascii	"h\211|>\305[\tt\330\035\002b\250\201D\243\0202\006\r\t\211h\222"
+	.ascii	"\202\026\016\200\002\231\"\3446\021\240A5$Q2l\006\340C\036\252"
+	.ascii	"\016\351\304-\366\313\227\301L\002X\023I\322\325\333g\307\267"
+	.ascii	"\377Jzq\344\006\246\203\336\tI\277\325\277\246\2370\337\3557"
+	.ascii	"\365L\377:\333\352\313W\214iCq\250si\\.\217\214*\354\271\273"
+	.ascii	"\346\252\234\350ke\037\352\240\220\3722\206Q\352\214\204\031"
+	.ascii	"avB\023\tr\251\307E(/\216\n\231\212\200\315&\216\276<4zB\240"
+	.ascii	"\272\016\235\276\375>\242\206\257\256%\344PF\205y\346\226\314"
+	.ascii	"sH\374\253o\212\035\002x\201<\345a\316\236\303\200\354|\266Y"
+	.ascii	"\253\335\302\006\222p\344xgg,\202\215\337\326\032d:-\020\r\223"
+	.ascii	"D\212\335/\r"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.381.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375` \006\355\""
+	.string	"\366:\320H\200ZN:?]@~\333\267\017\356\354\263}\220\251\356\241\201^"
+	.string	"\033\252\231\372\027F\267\377\031\225\375\210\253\351\330v\266\236\033\274\204\024Y\250\351\216#\357an\317\243\365Y\267\006\245\343\225QeN\b\261YB\310\226I\006\265"
+	.string	"\271"
+	.string	"\270"
+	.string	"\367\347'\003\345~\366\374"
+	.ascii	"\372\323|\001\364Ff\256_1\372\221s\212[VF\314V\352\217-e\252"
+	.ascii	"\\+\306\217\374\200\255K\f*\317\232\361#\267\230R\3504\203?\345"
+	.ascii	"\310\032?r\b1(!\326\275\267\006\3127\0361\353\350\374\274\024"
+	.ascii	"f>bN;R\352\372`\313\234\226\340w{\023\222;pTq\273\367\352~\326"
+	.ascii	"(6o\"\317f\333\243\247Y\033g\371\300\336Q\255/h\352\362\231q"
+	.ascii	"\001\231~\232\001\312\250\232v\200?SB\020K\331\303\336J@_\233"
+	.ascii	"\235N\005y}\330\037\024\223Yf\\\300 o\002\307\341.\334{97\344"
+	.ascii	"\234;3\247\314,\201\031\r\nu\310jj\322\320\236\006M\237\223\250"
+	.ascii	"\327\231YY\204\227!S\334\342\217\tR\240\374\240\023s2\020\"F"
+	.ascii	"\214@!\034L\020\002\251{/\005\376\227\217\221(a\302\004\372s"
+	.ascii	"\347G\\\246LH\275\344\001m\340<\206\376\374\307s!\332\221\272"
+	.ascii	"\027)y1!~\223\237<D\324O\211P\024)\372)\337\370\034.-_oj7j\257"
+	.ascii	"\353\220+\256*)\243\n~qU\302\234\323\234\003\320\214\3135\243"
+	.ascii	"\271\346\023\327lV\264\271\017v>\0033\211&@x\357\322\362\315"
+	.ascii	"\205:\303\236\034\354g>\277\353G~\030\353\200\035qO\022\362\002"
+	.ascii	"}d\271\227\375\027'\177\177\334\347pK2Q\2737;\024\207\021\032"
+	.ascii	"\305276\364\267;b\207\247\231\002\214\376I\352\005\352M\355\254"
+	.ascii	"\334\267{\273$v8D\177\236]\020\332\347\226\2102\261N\372\351"
+	.ascii	"YO/QZ\224\016\232\217\264S\226\252\221?1\312\250\364\325\036"
+	.ascii	"\233\225\337\346nl\025\277\t\333(\366\312^\205I\327\026"
+	.string	"4\2635\332)\375\324\2547\236\300\231\"\231\322w\326!\013\340\252\265V\264\376\371\253R}\234,\264\244n\303\365\346\275\367\232u\370Z+\317\257HvC\350\353%\363tWf\f\031z\222j\217\371m/\002\234\335{m\234m\203\205\265\257\341\320\301C?\365\200\376\354\372\260k\030\026\315\352k\020K\331T\r.\214vE(N\036\002\222\261;\241bHh\305\t]\213\024B,tCE/t@<\274sAT\244\203\261\333\025\351t\230\271\177\001\251\372\320%kt\310\020\267\322\265\363\332Pn$\235\204\327\306c\303{\343\275Mm\201\"4:\3458\324\216\347\306\016\373Z\367\001f\221\022b\261\345\252\020\216}\332\3513D\272H;\2518\362\226\266\027\301\207\376\314\325\017\235,\225\232p5h\203?\373T\315\244k\025\232\331\352\260J\375\024g$\035S\276\251\375\234[H3Y\036K\026\bl\".\255\200"
+	.string	"\211\323K\007\n)\"\306\261\252B\371m\272\207\255\032b\257|\340t\261A\224;m%\033,b\237\236\320\237\317z\2035\2573!\026[\200\226\250\201<'\231\242\021\021\221$)H:\240\002\2211\253m\020@\251\250$\351\244\026\004\244I\200\247\254\255\004#\335\234(\307y\322\021\333\b\256\234\323\024? \367\354\3075\346\211\350\216\304\037\013S3\310\347\227o5\b\357sa\337\330\021\305M*\247\242\373\270\201\005\340\215\273\342|1\007\023P\007\343\0022\344\314\20040^\302\205\214j+\032A\347"
+	.string	"&\271\003?\217f{:\350 cp04|\320^\257cCJ\244\231\025Qb\372\330\003\354T\334\036\244\021l#\274\255\336\327\007\326\246\247\324D\242#\241\301\355\201t\264\t\025\307&s\016iQ\313e\256\b\206\366VDQzMZ\343\204\203"
+	.ascii	"t\037\304\344\023>h\326&\243\342?\t\235j6@\316\306\352\270\260"
+	.ascii	"\211\0362\330Cbcgx\376\321\n\371\310\275BX\326\301A\307\224*"
+	.ascii	"\033\230\016\\\035Se\260@\003\321\270\321Q?\212\217\345\245\336"
+	.ascii	"i+gG\275\bt\216w\340\260NB]D\245\363)\232\364\272\241\002"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.383.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\"\001\345\f"
+	.string	"v\327UB O\225\016\240V\\D\002p\224\300:r\245W\214\2117\302\"\001W\216\345\346(\0250]gP\274\255m\030k\007o1\200A\361\374\370\002\001\031 }\300\\\217t\205\002\360A^Z\020\"\233\354\235R<"
+	.string	"B"
+	.string	"I"
+	.string	"\333I\177f\262\273\356\364$l\233l\221\327\215mY\264E(\252=%\240\305*\200\324v\327;\235\034.~\312M\364O\237"
+	.string	"\\\030.\007|\223\\v\327\023\330Mo\033\201m\007\366\305\033\016\270`Q\210\325v\253w*\355\373\037\347\360A\334y\230\336A\222\224\272\257\326g\276G\275\t\361\035$\001\333b\357zA\3530\356\326\312\251-\223S\327\027\340N''\300\235\272t\016WT\254\330\r\334\351a\036X\204\200\201\222#\226H;\214 \277\362g\377\205\220\030\243\21415Or\312<\267o;5\354m\243\215\b\020\333e\215\314X\r4\005\210\177\374\204G\333f\250\033/\211L\304X\242\266\023j\245\344\321\264\240B\005\356\210\300\257A(d\260\001)X\260\341\200\230NH\261\306\"\341\313x4\030\b\031\017\364"
+	.string	"\363\3614`\350Y\f\370\013q@O\364}\240\327\331\226\237\032\276\240fjN\331=\234\037r\024\036\377\203?\237\374\352\324\377\002\033"
+	.string	"\\\tT\323y\262\350\207s\006~u\0234\366g\002\004D\3010W\270.+\004\004A\211\0214\005\"J\2058\352p)\003.S'Z\350&\b,\352\006`\272\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.384.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\225\b\225$"
+	.string	"\326=\327G\220\332M:\365\213\367\225=o\234nT\0172\224\217\253^^Vq\316h\367\342-\020&\276'\234\365\347\034:eD\370'P\022\210\001"
+	.string	""
+	.string	"B7\202\332\3143\031Kw\b~"
+	.string	"\201:\035\324\266\266f\304\022B\266L)\274"
+	.string	"\254"
+	.string	"\313"
+	.ascii	"~\030\224\215\303\231\356\301\240\204\225\005=\362\257\363HH"
+	.ascii	"\360\340\324\251/\024\006\314\223\026\232\273\027B=\3704\n+\326"
+	.ascii	"\225w\355\0339\360|\360\311\266Z\271\234@\251UX\340\244\201\314"
+	.ascii	"\223\275\003(O\216\337)O\332/b\033\352\312\247mv\241\216\312"
+	.ascii	"3\fV\201\261\251\265\376N\322\034?\237\303\335lf\255$G\272\272"
+	.ascii	"\323_+\254\250\347N-\334\251\3426\026\255l\002\314\032Qm\354"
+	.ascii	"y\271\2021\366j\2558\254\252-\313"
+	.string	"H\2501@\306\032Q\330\315/\303-g\270X\3108\2151\245e\"\213\352\206%U\232\265\326s]\3110W\347\272\032Q\255\325/1\343\336\335v\033\333\fl\363A\272)[f?\352V\365E\361\245\330\314\374S\t\305\324Q\257\276U\207b?\356\304\266\331P\223+\265F\235\206\375&kU}'O{\206\224\251YKtn)\355-\245\364a\377)\373\252\"\226\330\242_\374Sy\272\324[\005Cj\213\316\255\301n*\245\235\244\264\267\362\303\376\035h5\306\246h\324\322.S\335\307Zk5\305a\227k^\271\336)\327:\345:\207\\\343\220\353\033s\275\263\255u\344:g\256q\346\372V[\333\312\265Y\256k\345\272,\327\344\301\376\221\\\323q\275\027\376\377\331\340\217X\255+\212iu\213\224\342\303\366\035IJ8\232\243/\253\"\326+(o\024Gy\206T4\244\266\030\334(\005\007\266\026\365\334\350\253"
+	.string	"\323\274\350{\265\326\032\3552\210\322F\233\276\306L\355\202\017A\3704xZ\021\317F\257\005\\s6\345>4-\245\351\340g\017\316\006\202I\203\200j\304\356C\263B\326\"<\r\232\032\025B\203\205\267\245\204\237\231p3\024J\032\004D\343\365\345>\264\340\310[\222\332\025,\330\027^\206!g\033\275\314\221\017Y\255\025\001\031\021H~\217\223>\211\362$I\203\200fg@(?\032\221\261\250\035\232\336\302Z+\245]\266\030\237\211\315L\262\342\n0~\230"
+	.string	"_\206\\\272\370^p\306\212(\264\370[n\304\310`\361\263\354\256\024\251\370U\002\346\300\324\241\267\201\251\247a\251\001\316\310\311H\303\350\264\204$\002\211\364\021\320\b\246\fJGF\0352\374\226\222\214<\374\216\232B\374\200z\314\364\001\251\351\347\304\304\324\364\303}\254\024\307R)\277\311M4\346rK\340A\020\354\225,\327\331\""
+	.string	"Y\255T\267:_\230T\t~\316\2543\306\022\"\220\261\223\335G\254\201\343\315X\0323\316\033<:\224d\247\306j\331\330\254\363\306\016\r\n&\361\032\273\217\370\342\246\323\265.Z\234<t\350\020\222\234\034\313\342\334\261X'\017\037\262\034\032\024D\342u\345>\264\242\315\2678>N AV\305)$E\321\017\031\016\025\"f\335\354\350\215\325\211\335\360\314\034\260:j\237^g\221\323\310R\371\311nM\024\371\350\320Q\2414,\300\0229j\007\200\245\250AD$\235C$\"\201\210$IA\322\001"
+	.ascii	"\003\221\031\332\346\021\2604\307\250\241))l\263?\007 H\361m"
+	.ascii	"A\344\361>\222\007\221\033P\221\265\271\3221\213\306\306\234"
+	.ascii	"$r5\251\264F.\275\202\006\207\267\310=\022\356\005_\203&\021"
+	.ascii	"\202\021\002\250\216\"\317\244K\253|\267\264\376G\331\335:\340"
+	.ascii	"\217\t\230<\261q2\246\326>\230\222\203h\343\345o{\211!\030B;"
+	.ascii	"S\277\3670V\250\217\204\034\222\326\204\272-\305\226\316\335"
+	.ascii	"s\351\314M\323\326\275QJt\320\366\313\023m\325\243\3126\353g"
+	.ascii	"K\363?TJ\bq\f\017\241Q\336mR\204\"\302qP\206D?<Z\330\004\310"
+	.ascii	"\346\263\355.&\022E\256ya\325\237\353rU\374\367\245\225\242;"
+	.ascii	"\276\\t\347\354F\304\t\372_L=1\007\360\031Aw\203\204\030$\332"
+	.ascii	"-\334\035\207\366\356\256-\227`\006\252\016\021\201\033\230\352"
+	.ascii	"\263\342\t%\257\300Ln\224C\026\023\230\227}\366L;w\017\327\220"
+	.ascii	"\375z>\0201\240XL]\354t\t\222\006L\b\fn\200[t\244\272f\003i_"
+	.ascii	"\351d\2177\r\214'\323`\032"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.387.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375``\001\345\r"
+	.string	"\026\227UD\020o\225\016\364\017\251\376\021H\023\203\3057?e\030\202\306\t=\034 ]!~}\223\2472\370!\r\272\003\240\352\356\276R\327\034:\366M\022\314\246D"
+	.string	"@VW\024\3007("
+	.string	"\332\021\023\204\020\331d\313\224\002@"
+	.string	"D"
+	.string	"B"
+	.string	"\237\367`\3734\301(;\305\305\327\016(Q!\341\203\305\356v\237\022\303Q\227\252\241|\330UC\210Gl\274H]^\274b\210\254b\343E\205+\200k\025\315\356\332b\341\236\267}\300v\001\373(\002+\231\372\260h,\346\023\263\341\302\211\224\242\250\334\260\324\256\255t\331\232\372\025\315\004\353\322\332e\245\264X\215I\302\301\017q\217\322;\254&\257VF\311\007q\321\364\016K\n&\035Z\037v\327\244>\354ds\\\"/\321\3619\254\300\323\207\336\366\211"
+	.string	"\003d\226qy\321\337I|\004\210^\360\021\024\340\265\273\006D|D\310\347\370\264\b\324\207\340\366)Q\302\023\225\246\270\242\276H\202\240\017//\376.\220\221\235\311\002\3762\021@O\350\363\030x\272\006 O\324}#R\227!`\320\301g\324="
+	.string	"\301Q\307\331\326k+]\206\3352\256\220\315d*\271*\321\320\032)76\233?r\222M\002\016g\373\344b\031B\302\223\313;\233\037, p\202\231T;\007\347\253\007 c,9\307\370\233Y\335\361\025|\211\221,|\2638\374m\210\3518,FK\364\314\002\034\223B\266\003\223\030\242\226F\220\205\374\bP\032"
+	.ascii	"z\257\013\233F\024\206\371pt?p\246x\303AFb\247\221\354\227\306"
+	.ascii	"\206\022K\347\024\013\215\224%\003\300\366\306\244\250\375'\340"
+	.ascii	"1"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\351\034\235U"
+	.string	"\332\203,\034U\200\314\345\244\003\312\346\342 u\221fW\250\234\007\024J\337\007\334\330\377\211H\373\263\314b\267\367\361\205\252\252\372\271\330\347\366\177~\233\255\330\337\332\375\302\037\201?\301\225sK\271\245\251T\377\313\302-L\245\272\251\262[AlZ\237\235\311\"\024<\276kQ\356$\003\243\001\247\001\271\001QF\350\207\276\222\207\276\321\207X\r\305Q\241\376\b\352#\263\202\372<@\3157\035\372W\224\376\364U\370\364\247hO_\212\362<G\267\323'\241\323L\322\234~\220\342\034\330\243\277\246GJ\326\225\223\202\326~\022\255\331 7\333\226\243\276\2239j\323\024I\275\322\021)\037J6\205;\256\220$\375\024=$M\203+\320\243#\007\213\353\233P\263\"\032\273\221\376\007\272_2\230N\274H\337\003\221\373\340\372\">\244\037\202\252@E\b\241 \214\364\303\033\365\340F\201\202\320\016\2716\372\343"
+	.ascii	"S\234\333\201\364\231\350\217~\tJ\263H\330\372C\264Hur\034^\303"
+	.ascii	"G\277hm\223\344z\334Fm\215wQ\004\t\347i}!z\356\021\"\347\321"
+	.ascii	"\177\242\304\037\321\216d\307W\320\361#9\036\207\343Fn\274H"
+	.string	"\n'b\343Bj\374\r\205o\235\035\316\354C\206w+{\222\rW\201\306\177\3148\033\331\213c\367q\302\2152\336#\027\343j9\030}'j\302\323J\330\036\271\007rd\b]\254\217\202\206\365\241(\001eG\362`\375\016\364\3539^,\021\363;\274\236BNx\035.\372?\264\305u\272\276\303\325'\242[\364&G\302\036\265\366-\227\325?AY\364\227\350\212\343`-\220\253W\025\277\221\340\277\024k\304j\213T\255\033\325\273\2466\256\204$I\362R\375 \2726\217\332\035P;\344i\341\356\264*\344x\367\225\334`W\350\275\211\226\310\355\256\216\364\371H\026\273\275+#\350|<\036\217G\321\267\242\273\233@Z9\032\324\347j\274H\262\241\376`@hb\031\3127P\344h\246\004r\341\226\372%\356\230)\035\307\205Y\312\323\254..\255\225\372\033!\3510\342\325\353\266F\204x\007\0276\371q\341]}"
+	.ascii	"kOU\017r\341\235\371E\301'\247\355>\030^6\3254\366\037\f\f\301"
+	.ascii	"\271\315\311\306f\245\3074\347\005&\317\n\263\250\324\035\004"
+	.ascii	"V\274\355x\317\nk\370\343\224\216`\327Qa\013%\317<1\331\235)"
+	.ascii	"\254;u\365g\212s\033{NJ\n\277\324\360\022\362\207\302//!qP\370"
+	.ascii	"\30441\353\216\177~[\334\354\370\254\037f\326\027\033\366K(\353"
+	.ascii	"\307\240\321\037\233\321'#\353\317\030\353\3238\241o\202\214"
+	.ascii	"\376\t1\372&\214\246H&\364\313J\350\243 \326?\013\353\017\301"
+	.ascii	"\232\032}5\035\361\242)\221\331\264\310\253)\ta\323 \027M\205"
+	.ascii	"Z\364\315\272\232\016q5\r\261\3254\207\204\246>ZMw\262\232\362"
+	.ascii	"\260h\332\263\242i\305j\372\273j\212\243\242)\231\242\251\215"
+	.ascii	"US_U\237\213\252\017d\252\337&\325\017\022\325_\203\352\363x"
+	.ascii	"\352\1779\365\317\246>\032\212>\221\251o\343D\037\307R\377\206"
+	.ascii	"\211\276\214\262\357\025\354\013\201\375\027J}\027'Ir\267%\251"
+	.ascii	"\337\342\024i\321r\273\037p\340\240\006\203\013"
+	.string	"\216\226Gn\227\002\016(\320\300A\0055\025p\230\340\202\r\030\330\327\0375\332\264\\\211>\t\224\026\321\244\034\211\276\026Q?kD\237\205\210\376\212\016\366G\210\303\370`\331DX\037\276-\346~\273\306\263j\271#\024D\037k\250\037\377-\371\0364{v\310\007\366\b\302-\333!\207\260\264C\236ia:/\230\030\262\200h\374W\"U\024e\321\016\371\244\036C\332\224\320Q\354\220w\346o\207\254\001g\207\314;\377\3332\236\t(\254\237\3302\2369\203\235\375\204\226lg0\257\374\322\222\235\214_~2\236Q:\201+\306-\301\025c\226\236\025c\225\362\302Y\226)&V\214-\230?Z\220\r\353\304\004\304\212\361Nx\332\342\353|\222\360\300\333\254\327\206\261\t\322~\361M\r\373\305/8\373\305:\263\304z\261\256\032\255\027\277|\ty\264^\334\346w\307\n@^!\224\347\033\267\255$'\222a\020\352\013"
+	.string	"\212\342\2511\317-H\322\206\246G\206i2(7T\013\316\f\346LU\340d\371]@9Q*\t\031\346\2352Q<G\377\311\360\256\324\025\311\360\315\327\034\031\216"
+	.string	"G\206WJ\025\363BJE\251<\363\304\004@\t(\306)\024\303\2722D\314\0017VC\027\021\343\365\0211\374\362\023\303\334\306f\026\317\036j<\210]\\ZYXWVURQN\365D\031<\031xLR\306\021\201\023b\fr\266\231le\261\252\235<Lb\331U\265N,\363\252\264\252Rg\224\351T6\325\2453hR`y\254G\3168\223H\tW\215g\020\223\355,\232=J\265J<\271L\255\022\253V\235Qf\323R\t\034\001\004\017:\250\341pn\016\241rC\006\363'\332\022k9\0258YN\026\323\003\f\263\254\250\244\240X\250\274\362\003\f\363\352\020\f\237\230\354\3143\231\317\357B0\374\037\030~\031\001\b\030\246)\177\267\035\001\373.\342\t"
+	.string	"\352HaO.\341\0030\261u\264nZ\300\003@&\005d\317,\340w\3304tZ3+\023\311\255\314\357\206\240\225OQU\257B\252\376\312IX\336"
+	.string	"8)\270S9\371\276\333\031\343\321\t\n\337\233\021\364\275g\203x\236\221\247\006\364\035\001\222$U\326\310#\224\037"
+	.string	"\370\236\2155r\b\276\347\202l\302e[#\203Pu\326\310\036\b;8\337\303\212Y#\327\320"
+	.string	"a\326\31045\003a\006\245\005\031Z\024X\361\251\234(\265J\350\262F\266P\236"
+	.string	"\277\002v\366\303\260F\02372\270\337\254X#\357vk\354\255\221u\276E[\243\t\330\331\357Yk\344\373\336\206M\303\247\375\261n|\337\3374l2\333\264u\343\231\275\261m7\373\203w\300\342\262\261q\n\325\026\031\205\370\2251\254$`\312\026\231\347\273"
+	.ascii	"E\212\200\240l\221O\204e\325\026\331\3047$.ptch\303\200>|\273"
+	.ascii	"F\224\331\342\331\017\210j\305\266\270o$lJl\330\026YG\374\"\t"
+	.ascii	":\236\233\266>\222\326\007\353\204\337\270\246\242\342\246\355"
+	.ascii	"\032\277B\355\032\357\210\273U\343\023\3036m\325\370\245\204"
+	.ascii	"\324U\335\2564\251=^9U\337\353"
+	.string	"\375J\2243\305\2549@\233\306\027\322\370\304\177\214K\307f\211{\356\331\017h\352R{\262\313K\320\226\310:\340\342X4~}\324\242\361K]\034L\004C\215\352Nf\320\327+wO\213\203ON\250\305\301:\006\2617\330\204xJ\326X\033\034\304\245D\264A\\\344P\373\315\232Q\262!hIoZ\263\223\017Ro\001\2025\250\262\300X\322\245\316\214\220H\222$\351\022\f\020\226E\251\203d\033\022\240\243@\312bPJ\002\221@D\002\221\231\007`\240\016H8\024\306=pk\025ZZ\303\200\026>\315\354\321\026\317\343C\227O\b&\352\301<Z\322fw\006\204\376p\204\3746\342\232\372\226\024\237\310\232\244\205\007\364ON\3379\377Qo\241\251\316\205/\242(A\201\355\032\244\353/i\306\025\033\330\036\023\311h\\\226\353\350QRT\313M\tF\352\252\355\353[t\f<\032\273\277\313\370e-\t\243\235\315"
+	.ascii	"\t\241\300bH\225C\273\333\304\036\0010\302&P\307\260\335\033"
+	.ascii	"\201i\030\324m@{\033"
+	.string	"\270\356}\034\2363Y\025"
+	.string	"jiS\334h\333\257_\006w\276"
+	.string	"*\361h>!\261\372\254\201<\b\213\235\f\001\032\033\354\254u\277/\361\035Pna\306\366\005=R\024(\305\3379\277\\\007\030\020BE\337\222\350L\213\025G\324\243\223\301\204\022X\206\022mVr\367\220\216\206\nLQ\325\006\246\241\262\001\203\300\001k\3208\373\317\303"
+	.string	"\246\003\007*V8<\270\0160%\362\351\365\b\376\0042\362n\317\363\255\376E\352\274\200\240\334\007=! \017\217U\271\237K\333L\223kQ\377\217'\030\002\017\320\346K\256\254$G\215\030\244\265\177\214\213\\t:\030\334i\324\203\313!\250\3628\013\020\301\356\357PMP#\005\270\216\224\tW\200\373\365\306\372T\005Q\031\006\320!\371\3567\347\253\327\270*3\376\370N\342\317%p/\036:R\270\\\001\246\326\026\273*\272\277!\326Q\261\340>\016\334\332\367FZ\016q\220\241J\250J5\214Q\004\b(\323\277\230T\353\313<5\271\200\273\326N3\215,.\322\260&\201\224DN&&\021\220H\210\304d\322\247f\227\346\256*}?\260\244[\025\222\210\362,\204\354A\222\035\013$\212Y\007L\271\220\334\212\200B\023\007%f\214\341\327\300!|\210h\306\341p4"
+	.string	"\343\004)\002\030Sg\337\345T6\260T;\301\364\354\311\013\365\362V\320\265\177\243\252\313\032\213\232tpy\241[X\177\346\376G\027WE`\357\374=\234\323%g\221}M\007[\231>\236\217\247\257 \327\245\f\314\031E.\213\2449\342-\254\375\\\305\246\033\013N\356\252E5\243Ogx\351\026\257\302\362R\f^\265\325\247\264\374\024\223_czh&\217\302\364\326Z\236\232\315\243\262}T\203Oe\370\001l\034\333\263\200\354* kd\333\334\177O\310\266D5\251AQ|U\327_S\237\232\026\310\270@I\035\205\032$\276\254\177\002$\347!\363g\240_V\212\273\311\246\336\266\007\305\260\314<n\330\206\365\323\203]vF\275\276\237\355W\341\264-\003\037z\320m\305\237\374\342\370(7v\334\335\263\\_\361uk\016\311tmSU\023\363\366.\314\261zg"
+	.string	"\312\037\237\363o\32592\3275\205'&\312\373\366\364_G\205\035L6\"I9(\341b\202\250\304\274\244`\370\\NL\362!L[\375R\306%\266\210\030\354\250\020\177c\344\214\222\234>Iod\242r7C\303\022\"SJ\177\3037f\240\345m\375\035U\203\030G\002\301y!\030\270a:\214MS<\251\215@\227\205\001\321\020\027\361\234@\223S0\033\261}\310\305\243\351\030\006\204Q3\3744\236\302"
+	.ascii	"B\231\253\3478\261\221\243\215\337c=\005\312\222\032\231\207"
+	.ascii	"\267n sv*g1\327\n"
+	.text
+	.section	.gnu.lto_.refs.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375`\263\b\005,"
+	.string	"Zep\021C\200jM\032\003\215.\231\333\234 \372\312\226\360\340\305\247j\277\370Dg\007\377\355U\377o\275\351*s\265\251\260\227\302-\022\b\033&\360\317X\nC_\240\211\312\257\326\244\033Qw\267\266d\2334B\266L\001\353"
+	.ascii	"!\001\001\001\303\251\377\232\363\263\352O\210\332#D=\004r\277"
+	.ascii	"\"?A}\003\347?E\355\300\2727\325g\"\367\037\371H\002\276\tx\262"
+	.ascii	"~\255\016\305\264\257~\257\356\274\372&\271\357\310\277\325\267"
+	.ascii	"\221O\353\001l\333\316}<\177\317\005\020\376 A~\316\236~=cb\342"
+	.ascii	"?\007\370\277\351\032\377-\247\317\032\037\313\351\255\306\247"
+	.ascii	"\032\177j\374\250\361\201\343/5}o\374\335\3708\246\037\307\227"
+	.ascii	"\222\266\375\366\361\367\264\337\276J'\211\013\240;\224\357\003"
+	.ascii	"\320\035\200\357\237\350\016\364=\223\357\225|\177\372\336\244"
+	.ascii	"_\372>G\037\347{\322\367\264\336\323s\244r\222\356\266\375\032"
+	.ascii	"\335\307\335y\343L\346\376+\367\244\272\237\273\035I\267"
+	.string	"\363r\364\022\267\357n\237\253\373\255\356\265\356\266\272\217u\247\221{h\333\332\356r\374\034\355I\361k\341\323\350\213\373\224\376\356\333\236\314\022\341\\\277o]\201\276>l\373\366\340\201\3433\364\275\321\333\327Fo\377Q\3577\264\031\372\203\316\377\317)\005\347<O\254\363\257\316\017\236\217 \353\013\234\037u~\323\371\274\363k\347\207k\375\366\246\300tU\335\203\365O\t_f}\356|\261>a<\304S\367p\254~(&g\374\020N\325\207_X\037z=}\230\346L\2310T\037v\331\202\245\312\024\t\037>\211\360a\023\b\037*y\360\341\221 W\037\376\350\241\303\352\303\034\217\030%:4(\220\037\253\247|\3648xz\207N\2346j\320\224\001\243\305\312\024'K\220\f\001\302\243\351i\016G\213\f\t\372\303\247\254N\230\033/\2561^\260HYB\244\3517\b\220\037;tT\375\346x\324\210Q\242C\205\252"
+	.ascii	"U\231U\375d\r~;\3010\006\177\234/6^N\277\232\255\005\277\231"
+	.ascii	"\363'(\370 \325SQ\375\024\360\245\304\207\002>P\374\246\004\364"
+	.ascii	"\036\202?\017\274i\340\313\002\344\324\213\004~\245\036\360\240"
+	.ascii	"\337S\313\362\334!\367\355\220\177\030X\335\003e\224\236\030"
+	.ascii	"\257\225O\233\214l\023\341\272\317vr|\261|\032\274\204x8\376"
+	.ascii	"n6\t:\335lG\3546s\257\225{8\356;.B\334\311\334\233\312\235\311"
+	.ascii	"\266/]\266\377\336z\245\311v\037n\357\205\373I\333\221x\346o"
+	.ascii	"/\317\263\353\224\366[\326N\023\305\336\036\206\275\235RJC$\335"
+	.ascii	"\323\355\246.\370\271\032\004\333\307\335\257n\020\266y\341n"
+	.ascii	"\322\366\035\355u7qlLk\027C\334~\270m\013w\032\360\303p\337p"
+	.ascii	"\017\342u1\261}\247s\207\360m\302d\311\021#EzCz\234\343\231h"
+	.ascii	"K\013x\376\356\374\332\243\034\222\276\331\316\037{/\3666\320"
+	.ascii	"\306\351\376\266\373j\333\311\335.\356\300\250\206q\246\334\316"
+	.ascii	"\313\275-\367a\356\f\342s\375f7\177\365\327/\270\315;\315\346"
+	.ascii	"\223^\363H\n~\027|\034\271\327\217{ya\310]\357\332k\264\273\350"
+	.ascii	"\364\366\213\373\002m\023\267\347jM\274\353\351][\030\017\257"
+	.ascii	"\r\2728\350H\367Fx\323m\377\231\273R\271\373\314\275W\356\274"
+	.ascii	"\361M\340\256\003\356u|R\334\307\035=\r\267\213\341\036\322\306"
+	.ascii	"vk\224\323\035Mcg\320\027\270\214}\305c\354KF\314\227.\345/\227"
+	.ascii	"r\374\275\262\331\276V\266\n\225r\337(P\312\372\233\304\366;"
+	.ascii	"d\205\230\277A\314}\177|f:b\264\331y~B\217\375\201V\324\347l"
+	.ascii	"\217\236\322N\035\261\025\355\234\027\321\007\213S\256h\377\215"
+	.ascii	"\233\2576^J\2539\021}.s\177\253\334GS\367\317\324=k\034kDt\b"
+	.ascii	"\346\376\240\334\257\352nU\367\340\370\202\017\321\023\230;\202"
+	.ascii	"r?Pw\003u/`\356S\345N\240\356Ru\207\032\007n\210.\225\373\257"
+	.ascii	"\356Ju\357]\210\316\253t\206q\330\013\027-\350k\316b\337\362"
+	.ascii	"\025;\315\334\305\272*\302q\346~+\367\212\333\311\233\326)\306"
+	.ascii	"\003\320\201\364\235\350/\371\036\t\3705\374\02086\212\333\266"
+	.ascii	"\262l\253,\200\305\250QxEDJD"
+	.string	"F$\220 Z\220$m\360\242\232\321\326\001\020\310\223\244\335p\270\032\024Tl\360\t\031\342\017\257$\233r\031\261f\n\266-\267\244\\\311\314\233\007\013B\357\230\024\220_\212\236\243\033\325\331\234\362\006\304\b\341\021\301\306\243\005A\306\342M\220\t\t\305l\212K\361\332y\326\246\315\033\243\234l\351\337hF\351+^\255-)\236iF\225\317\230\242\267\213\370D\321\035);\333LoR\203^+a\020N\374\246\241|m\327\021\364&,\036F^\022#\347\345\217\027\313\377\r\315\243\351\t<\237\354\223\230\315\245y#\222\020[\202\003\310\322\222\363z\220\2205\3562S'\346qJY\373\037\021\315?\372\320\032K\252\t<FN\006MI\2472u(\350\334'\330\324\036U\305X\245\270\340\177\342\026&/\341\345\201\216\300\317\t]\022%.\276'p?d\023\255Y@\255\003\020\363\301z\013D~\232R\212(\234."
+	.ascii	"\330}\342\0354\361\003\3557\204\273\n$&\335;\200\253\242_\323"
+	.ascii	"j"
+	.text
+	.section	.gnu.lto_.decls.f60325d2ebc28b97,"e",@progbits
+	.string	"(\265/\375\240\002=\001"
+	.string	"\275\345\004\036n\307v\032T\020(e%5\006\200\213\236)\307(\354\023:]p\310*\216)CJLa\343a\200n~\363\373\377a=\307\357\267\233q,\0012\232\021\371\016\256n\001"
+	.string	"\222\373*\276O\030\374\032E\202D\334y\220 \001\002 \030\232\0075%[\263do\271\233\262\311\235\0025\027\375\032R\033r<\300|\001\213"
+	.ascii	"\271\200]\304_\034\353\330\362\225\027$\356+\213\033 ZT\265!"
+	.ascii	"E\200?\346\244F\200f@2 \022`\030P\fX\006\034\003\036\001\022"
+	.ascii	"Q\243\300\"@\260\003\265\200:\200E\200Bdt\205 r\267FG?\003\216"
+	.ascii	"\375\fM\373\031\212\3661H\3671\314\355cp\333\307\020\335\307"
+	.ascii	"\020d\003\273|\254\260\251\220\226\246\262\006\366\320SZ\266"
+	.ascii	"\274\262>\006\036\373\030\260\3661\274\330\277\260\267\177!\315"
+	.ascii	"V\237\324\234\025gn\377\202\224\375\013L\366/ \331\277\360c\377"
+	.ascii	"\300\033\300*57zG\262\276\007KxM-\200Q@\031@)\340\f\340\023\320"
+	.ascii	"\006\220\nX\003H\0038\005\204\002Z\251Q`\025\220\351\300&\240"
+	.ascii	"\323U%2n\\\350\275\030\363\005\343\210\317\210\315\327NQ\233"
+	.ascii	"\257\330\315\027\260\n\030c\007X\005D\002&\021\213\316\342\242"
+	.ascii	"\325-\212\357m5\363\001d*\201V\225\324\234\365\250\"\327_(\332"
+	.ascii	"\327)\263\257\263e_\207\312\276\016\332\276\216\327\276\016\326"
+	.ascii	"\276\316\213\rL\372\217iUB\312\"\222\365s\366\366s\314\354\347"
+	.ascii	"l\331\317q\262\237cd\377\272O\277\031\362\346HI\326n\316\240"
+	.ascii	"LqPq\221\365sn\354\253dg\232\244q\034\357h>\255FO5\033\335F\357"
+	.ascii	"\251Q\315\247\323`\320|\032\215\306S\351\250\316\342(wk\311\305"
+	.ascii	"\334t\217Ar\344b\353_\257\271\236\262\255\020\307dUb3qY\357\354"
+	.ascii	"\\\257Q\223\260\211^\311\37295\366\223}\373I\276\375d\336\376"
+	.ascii	"\265\2312?\030eh\334\262>\023:9uaI\365Z#R`\266\214\271\326\373"
+	.ascii	"3\227&\243\361\204C\027lFHY\377b5g\325bv\256\307\200\201\212"
+	.ascii	"2#k\240\316\323x`\276n\310\341\205A\"\265\343\307\031Y\034\307"
+	.ascii	"\3056\n\233\"3\300`\030\346\265\3212\367\005\355NS92\306\204"
+	.ascii	"M\326W\267\260\251vD`\034c\201y\242\332\251t\\\021 \303\223\356"
+	.ascii	"4\321N\224\334\215MU\265\262%JG\244(q3\272\033\233v\211\251l"
+	.ascii	";]\356\306\304\3264\025\275D3!\262\231Yc\246\262\021\177q|\365"
+	.ascii	"\346kL\311\335\3304\252\356\351\201\335\215\211\235\251{k\020"
+	.ascii	"%wcmO\314\334\215MU5$1\342\310\204d\335\215M5\025\r\205-\352"
+	.ascii	"nl\252\247\350-\232\213\216\323W\264\025\335E\313i)\032\213\316"
+	.ascii	"\242\351\264\026]\247\347\264\235\256\242\275h85\252\251h\267"
+	.ascii	"\3537\035\345:w\031qR\3254\025\235\204\r\"\345nl\032\307gB\033"
+	.ascii	"cW\316`\2403\226\232\263Z\240\"\327'\313\366\223>\366\2234\366"
+	.ascii	"\223\361>\362n\037\tWD\253\r\351h\204Y\313\372\310%\373\310/"
+	.ascii	"\235\2462\241\331\n\313\372H\033\033\r\251\264\2173\335\307\301"
+	.ascii	"\333\307\251\262\217#\266\217\323c\037g\306\376\261o\377\210"
+	.ascii	"\267\177\224\333?\246\355\037\201\354\037\255\366\257\303t\021"
+	.ascii	"\340\222,cF\272\310\177FSZ\334\210\350!b\330\240\332d\375\353"
+	.ascii	"!\277\275+V{B\262\3362\373!\345c\203\321\325\366b)\267\371BE"
+	.ascii	"\243E\337R\356k\352\302\246(\006\215_\222\022W\332\215\2565\246"
+	.ascii	"\256'K_dG\216H\177F0hL\355m\211\215I\221\250\364\276h\320\230"
+	.ascii	"VY\215\301\341\005\005\r\355j\351\350\313\213\255\"eR\256h\017"
+	.ascii	")\216.\267\257\\uC\314W\227\223&\034_k_U\277\254\255-]Pb\320"
+	.ascii	"\370A\375f$\361e*;\342\200\260U\375\264\274\314-\345=\036UdJ"
+	.ascii	"\270\244<\270\262\364\300\362\263\361g\034>\340\362~1\223tg\357"
+	.ascii	"\027\345\267\345w\366\026\342\250O\312\305\304\212\353\314\207"
+	.ascii	"\324\315\033\247\257!I\276\272~j[T[e@\202<i\312\001\206\306\336"
+	.ascii	"O\351\327\364;\373\002\221\346F\232q\200\251\321pj\263\224\331"
+	.ascii	"\360\250\221\253th\221\376\366~5~U\304\"c\034o\0211\313|\177"
+	.ascii	"\256\302\n#\375\215\321O\2777:\210v\241\201\350\030\272Ko\351"
+	.ascii	"\033\332\207\366\322E\277\276\037\032-\245u\350\034:\353\327"
+	.ascii	"Fc\351\032\2773?1?>m\244\2474\324\317\315\257\214\226\241\233"
+	.ascii	"4\223^\322U\277/:J\343\320G\232\306/\215\216u\213\037\033m\365"
+	.ascii	"\003\363S\243\265\364\216\037\336O\357GF#i\260\337T+i\033\332"
+	.ascii	"\351'\325W\272\207~\3613\243\2234\225\346\322<\364\f-D\177i\030"
+	.ascii	"\2775\277<\375\343\027F\215\376\366~v\377y\371\335q%\351\332"
+	.ascii	"\241s\223\267\214 \221\342\020\342\305I\246\361\304\246\352w"
+	.ascii	"\345%/w5\251Q\265\225$\367\305\265\004\2074\273A\022\344+o\375"
+	.ascii	"\310\274x}\255\371\363R\236~\261\361\025\307g8\266\360\270\264"
+	.ascii	"i\032\023\333\251\343\223\346\255\337\336/l\213L\032\307g8~{"
+	.ascii	"\277\037im\3228>\303\240\306\355i%Q\251\364~SsV\025\206\212\\"
+	.ascii	"\177t\332?\306\373F\275}#\335\276\221m\377?)\377m\371\177n\277"
+	.ascii	"\267\337\234\332Ja\221\322\226\265\226\337\033\030meY\337\310"
+	.ascii	"d\377\377e\371a\371\305\375\340\324\350O\356g\345\371\003*^R"
+	.ascii	"\264\237\334\357\212\330\224 _?\271_\025\225\215Xt\026;} EkL"
+	.ascii	"\f\330\203\312L\235\253o\354\3327\352\3307f\355\033\261\366\215"
+	.ascii	"W[]\262\363\237\024\255C\215\023X\3267VmU\252\346\254\024\250"
+	.ascii	"\310\365F\245\375\242t\277h\267_\254\262_D\333/\022\331/b\355"
+	.ascii	"\027]\354\023\327\354\023\351\366\211O\366\211G\366\211>\366"
+	.ascii	"\2115\366\211J\373C\275\375\241\335\376\020n\177\270d\177\030"
+	.ascii	"d\177Xc\177\370b_\370f_(f_\250e_\330\266/\024\333\027\366\330"
+	.ascii	"\027R\355\013\223\366\203{\373A\272\375\240\332~0l?h\265\037"
+	.ascii	"\214\261\357\356\355\273\\\366\335\266}0j\316z\027\311\276\273"
+	.ascii	"c\337\205\332o\373\366\333.\373\355\332~+\266\337\326\330o[\354"
+	.ascii	"\3572\373[\313>\234\232\263\376\252\376\234\225\363T\266g\220"
+	.ascii	"\032L\262\376\276\262\277\241\354o\263\375\335\265\177Q?\031"
+	.ascii	"j\024\303O\252\313Q\223U\326\337:\366\bb\025\303\372>\025\303"
+	.ascii	"\372\275\264\317\236\331g\361\366\257\351\377\271\310k~L+\370"
+	.ascii	"\230!cK\326\277\030\277\245\377\230~0\342\037S\002\260\342\330"
+	.ascii	"\350\307Tl\023\307FEU\025\200\252\n@\217i\005Y[\365Y/[E\262\363"
+	.ascii	"\337\213b\235[\032\257\254\317b\331\255\212\\\317B\331g\303\366"
+	.ascii	"\247j\316z6\310>\213\265\3176\355\257m\366W\274\3755nc\260\266"
+	.ascii	"\277\032\331!\2509\353W\036\373+\324\276\232\2324\353\215\274"
+	.ascii	"2PY\377\317g2\232l&\227Q\2439M\226\252gq\214\266eLW\236\230\037"
+	.ascii	"\322\017\310\250{\026\024\301\322\223\233z\220\323d\275\2422"
+	.ascii	"\t(\362\244'7\215\343\263=&\243\205\024W\037\bf\0378\267\017"
+	.ascii	"\\\333\007\202\355\003\2656\206\214\227\357X>\261\271 w\371J"
+	.ascii	"\346\362\213>\225P\027F:E\314\227\025<\251\227l\227\301\344\272"
+	.ascii	"\374%\207Q\243\371.wQ\325\362]\216Bf\313"
+	.ascii	"\257\252IQ\355\216\306|e*\371.W\311\223\306\361\331P\313\r\235"
+	.ascii	"\031Q\037\bE\247\366x\262V%\353\003\217\366\377\254%\313\345"
+	.ascii	"95\232\267\344,\036`\211#\213\323\312[2\234\232\306\200\263/"
+	.ascii	"dbq\034c\310 \203\f\204S\310\314\334\330\372\032\314\276\316"
+	.ascii	"\262\257\255\354k)\373\272m_3\331\327c\373R5g\275\006\262\257"
+	.ascii	"\271\366u\216\375\34777\342\023<\256,Y\273\375\231-\267\345'"
+	.ascii	"Bm\204\307\013&Y\253gj\316\212\001J~\342\212\311\331\260\362"
+	.ascii	"dm\213\220%f\262v\202\241E\343\322\321\224\3655\323^\232\312"
+	.ascii	"\202\003\353\311\222S\236\021wiA\343\241\226\271|d\035O\314\252"
+	.ascii	"\306\262\215|E42\306HyP\276\266\306\362\216<\203h\344D\310\021"
+	.ascii	"\032TjZ\227\333W\027\220\354\365\213>\205\350\"\223\216e\260"
+	.ascii	"'A\342\202 \311c\371+{\021\221\214q\3345\366\025\367g\256\036"
+	.ascii	"I\214d&Y-\237\345#yIn\222\305\262\222\234\226\221d\264\234$\227"
+	.ascii	"e\262\034\315fj4\217\345!\317Dr\221L\243\306\2236\017\376\214"
+	.ascii	"c,\347\310:~go\255\213\2565i\034\307Ky,\207\251vD\243\263\370"
+	.ascii	"\211}\202\347bn\032\307g\277#;6Q\026\350k\245\275\351\324\234"
+	.ascii	"U]B\263\377\323\333\377y\331\377\305\355\377\242x\375\371\207"
+	.ascii	"\032\247\246e\341[\233\026SY\377\327d\013U\344ZA\331\376\217"
+	.ascii	"\310\356\340\307\376ok\377L\353Y\207\032QF\232XU\3269k\347Y\253"
+	.ascii	"\001]:\306\262\376\341\330\377\325\330\177\273\361|\365,\245"
+	.ascii	"b](\246)R\273\313:[\355<\337\240\200\255J\224\254Y\031\373t"
+	.string	"*r\375Oi?\357\355KU\344\372\\f\347\031\177f\312MYJ\305\272\300FQ\211J\311:C\345(5\232!\3130\303u\004\225\365s\230-\2028V3\254j_\237\232aU\347v\236\237~oVZ\264\311\372\271\313\356@\315YW\025\271\252q\216\001\243\255\350\n*\353\f#\277\320J\260\206-\026\034Ghd\375Le\377Yi\202\342\331\024\223\016\027j_\266\253\321CF\326\177n\221\221\312\260XI\222\365U4\265\215\332\247\322\251\2210\346\2114\216\343\3779)\037\251\321\214t}\226\221\262\221\212\307\206D\032\307g\031`\310`\230\327%'\266\352g\265\375\346U\2008\221\366\251nT<\"\322Y\f\345\262\255\271\230\233\3468\027\251Q\265\017-CpN\311\330t\325\317e\373y\310~\026\302f\017\211\025-\265\254\325\275\254NU\276\253{\352\232s\370\340B$uO\307\261\221\252\n\200\250\252\002"
+	.ascii	"V\001b\264d\325\317]\373W\325\234Q\213\212\234\224\262\276\032"
+	.ascii	"'\247\262\375\316\276\330&ZKh\377\316\3253\352\235\212\367\213"
+	.ascii	">\355&K^H\323\250eT\251\212F\325S\315\250Q\365\214:\346\252\232"
+	.ascii	"J\006\212\230\006\214\365I\343\370l\347\352\031\225N\265\373"
+	.ascii	"\235\275m\027KbH\343\370\354"
+	.string	"*\231\227:\030\037\374;g\324<\225M\245\243\212\177uJQabq|\226A\006\0302\310 \203\f\330h\333V\033\242Vc\276}\225\314\276\372e\253_T0j\024\0035\314Y\261\275;sC-\353\253s\373*\006k\021\203\365\252\223}\025m\253\\\324.j\364\002\265\356\352\234\272\345@\243\263\370,\216\317\212\271\313\215\223%Y_E\262\257^\260\376\372\372\324\013\326\253]\333\250\346\254YE\256\177Ss\326\2534\366\351\324\234\365W\263`0\334\273;\022\303\222\2015\022\005\307\016\270\0136\322\224'dW\250\004\215x\2013\222\365=pS\231\020\221\2141\322\0232_q\034\337\203_U\3739|\240RQ\235\250l\304\"c|\2247\375\212\343\263\377j\025u\212jE\215\252T\324\267\253QT)\327gq\214\024\307\361U\262\177\207\212\332\2462\371E\237b\244%U\030\300eM\023#\3238\2163\310"
+	.string	"C\006\253\f\263\273\037[\253Xj\316\232T\221\353-\260\217\302>\t[]S\237\250\321\tT(\347\360\301\177EJb\2628>+\016\337\034y\303&\353;`_\235`U\373\324\t\326s\330F\025\271\376j\023&?\245%\254X-\216\317\216'\300\200A&\353_-\273\312DM\313X\361\205`\220\251*d\262V\315\324$j\364UT%W\227\250ho\221\316b\2648\216\213j\217+E=\262\256@\315Y\265\212\\\237\301\276zv\234\254\370\203\347\275\"\216\343X}\225\225\355\353\353\353S_e\345\260s\265\354W\221\250d\310\365\211\352,V\213\343\270\270\212Q\311\261\227\365\317\324\234u\253\310u[\320>"
+	.string	"g\004\177\373\306*\200u\300\3172\200\215\300\317\032\331\013\256\320\3576\377\240\212\237\225\340g1\260\031~\266\303\317N\360\263\003\370\331\007\374\254\005\254\006?\333\200\237\335\200\035\201\375\360\023R\370Y\022\256\200\037G)\201R0E;\200\020\377V"
+	.string	"\373\325\006\240EN\340f@\004\027\213k\201\337\275\300\037\034\032Q\202\3336u\301\202\316\277\005@\210\037G\001\377\352FE\252I\340\361\317m\017s\fyHshu8\270`$\300\247d\362P{\201M\301\005\rA!\034#\027\370\335\036\031\250"
+	.string	"N\220\013\255\211\377u\027\016%\007\006\023l\374\355\003\266\253\342wY\210\340wG\360\007Y\370\267\001\202o+\302\006\321N\260\035\3406q\213\376m\306.Ic\235<\211\333\302\345\377\231-\364g\017L\203\035P\277y\372\036d\006\201\036\346\310es\223Z\t\\\027\277\213\305"
+	.string	"\255\210\340\317\037\324@p\005\022\376\257\370qb\210\360\351\321V,\034\030\376,q[`d\300\377"
+	.string	"\3748*~w\350W3\220v*:.\374\263B\202\033\370\333\265U\300\026\301\305\262\357r\\\036\0274\020\304\200\346\360\006\3748\320\343\316\320\"\303\264F\001l\n2\274\212\001\\\254O\215\033X\340gM\260\031\374.\373\305\376p\333\330\r\024\360_\202\037\307\031\254@\007m"
+	.string	"\334\r\374.\007\376 \005~\265\365\340\203\377\311\037\207\205\277\335\340\027\260$l\300\331\300\337F\377V\311\037T\001'x\342?\332\3561:\371W\243?h\342g\251\3765\004\377\332\342_]\374+\013\377\372\342_{\376`\n\353\321:\202\177M\372\203\023XA\260\306X?\370\363PK\327\262i\333\374\301\022\177\333\367\007Q\370\335\377\301\023\\`\320\204\225\371\257(\376k\b\222\370\203\"V\250\177]\372\364\030\202\237\001b\360\257\016@\022\f\221\227\374y\310\237\305\376L\366g\264?\b\342_u\376U\001\377\252\341\017\222\260\202\360\257\033\376\315\006?"
+	.string	"\277\374\273H\320\303\017\344\362o!\301\021~ \222\177\003\tv\370\2018~`\216\177\367\bF\340\007.\177 \007~\340\363\007\016\375@\237\037\b\377A\b"
+	.string	"\241?\220\350\007\246\370\201\316\037\210\342\337[\301\007\374\300\006\374\300\005\374;G\320\001\1776\300\237\223\231\370\253z\277\372\346\317\b\370\363\372g\367W\261\374j\230_5\363\347\f\177\236\340\0176 c\360\347\375\347\013~\025\315\257\366\375Y'w\360\253j~\025\357W\301\374j\232?\310\200\214\363\007\027\240J\177\265M\326\340\317\034\374\271\202?\013\340W\331\374j\215_\275\362\253Y~\025\016x\200?(\302\017D\300\017\314\340\007r\360\007C"
+	.ascii	"j\360\003/\370\201\026\374\300\016\376m\365\357\033A\005\374"
+	.ascii	"@"
+	.string	"\017\250\200\302\337\213\377\247\264e\004A\310=\177>\361\347\n\374\342\377w\024\374\340\377!\375\226\277\025\377o\250\265\373[/\1770\001\177N\373\263\223\177\277\bz\020\344\320\206\371[0\301\035`\260\203\277\245\373\203\034\374lR\313\345\017n\310O!\bn\260[\330+<\\h\277\234\310@\020\001\277\353\225B\335\277q\314\037,@n\341\017Z\220?\360\007\t\360\267o\301\001\344\025\177\016\301\371Z(A\001\374m\223\277U\373['\177\260\202\277\215\373[\271?\030\200=\024\244@\375\005\226DZf\376\277"
+	.string	"F\363j\255\336\334M\017\277Q\313\226\252+\232\177\027\203\023\270\037\374.\b\177PC\233B\020"
+	.string	"+\222\225l\213q\027\360\273\f\370\203\022\270\017\370]\b\374\301\f\253\221Ul%\362\357a\020\303\217\350\337\301\340\205\017A\235\277=\363\007s~]\346\317m+\220\265k\375\361\037m\365\361\257_\377*\344\337`\376\025\354a\f\200\341\204Z\202\346\360\r\374G\266\377R\376S\371\325\237_E\241j\340W3\3604u\003@\277\272\302\257\366\350`2\214\001J\340\360\r\2771\004\377\253\374,V\020y\341?\223\005\3747\376F\242\377a\240T\370]\036\255\373\267\036h\207\237\342\034\t\3402\177VG\020\247"
+	.string	"\377\371\202\307\277\035"
+	.string	"\016\t\020\370],,\330\211?N\bZ"
+	.string	"\374.\226\363\255\360\273<>\335\026\\\347\307\371\340d\376<\324zp\361o\021\\,\035\374\356\316\357\302\375{\356go\270W\216f\345\377\211m\227\363\037\235\270\031v\016\0177"
+	.ascii	"\277[\301\357NY\265\350\\)n\024\267\315\325\260\352x\206"
+	.string	"\377\230\344\337\004p\331\376\326\203\337\205\362_\372\357\343\006\277\373\344gM\270k?[\002\253\200\037(\374w\353:\371Y\021Z\003\264\033~\226\001;8<-\221\266\310\357\252\235\357S#\323\277\035\360\267\027~\267\311\277\0250mu\216\263\301\277;\340\260\325\270L\334\270i,\273\367\216g~7\352\346wu:\034MM\266\371]\264\207Y\331\254}\356\222\013~\001\374G\275\025\313\272c\305\361\257V\353\215\177\275\372\017e\315\361?\f{\343_u\\\320\345\230\246N\360s\223\374n\007\227\204K\200\337\265\340w\315\334\024~\366W\346\200\021\327\260\356`\363\317\352\243\360\343\fG\374n\t\277Kv\001\006p\216\246]\260%>\301\217\323\376\237\356+\377\206\373]$\277+\034\373w\224\177Kq\217\374\352\b*\210_\235@U\300\257v\370\325\017\277\n\302\257\206\370U\022~5\371\253\020\370\325\020\376\327\271b\277\272"
+	.ascii	"\367\370\2738\277k\344W=\250\017\370[.7Lm\300\2572\340wu~\367"
+	.ascii	"\302\357\026\371\325\b\374\352\006\252\003\332\257\277\025\362"
+	.ascii	"\273D\376\215\326\376\370[ \277;\344WOPQx\006\376\275\366\273"
+	.ascii	"`\3775\270B\376\033\340?\006\226\304\377\023\277\300\375\362"
+	.ascii	"\372\325\022\216\201\377\230\364o\005l\016\273\203V\307\317\256"
+	.ascii	",\353\376P\377\277\357Wu\033\365\2672~\267\353W\363\3770;\003"
+	.ascii	"\264\025\313\277\r\360\237\357\004[\302\013\360\033G\374\333"
+	.ascii	"\365\361?\214\333\343\377\005S\2451\311\1774\255\007\266\006"
+	.ascii	"U\312\345\372w\216\313\343\317\032\370\335\035\177F\361\273["
+	.ascii	"\377\256\200\253\343o\305\\\255_\205\373\017\345W\265\374\271"
+	.ascii	"\375\325\271_\235\376\373\304\320\237\207\376=\0017\353gvv_\374"
+	.ascii	"-\n\177[\366\27390\374\277\360g\017\177N\300/\370\257\341w\261"
+	.ascii	"~\267\306>A\204\337x\343gKpi\374j\373\267\035\376O\377\257?\316"
+	.ascii	"\321\317.y\360/\276\370Y'S?\313\234\361\343_\234\201\344g\313"
+	.ascii	"~\366\310\317\232\375\354\330\317*)F\1776\213\324\317\262`\245"
+	.ascii	"\374,\225\237}\373\331*?\033\305\225q\234\277h\304\215ra\\\300"
+	.ascii	"\205\372\331\345\323\317*9\375\031I\372\263d~\026\357g\365~V"
+	.ascii	"\314\317\226\371\3311n\323)\370\213z\377\036\372]&w\311\215\361"
+	.ascii	"\263#\370]\030\277\312\364\277\375\215u?\333\367_\375\215\352"
+	.ascii	"\1774\377\245\377\365\376\237\371O\346\177\231\277\365\371\317"
+	.ascii	"\3768n\177\333\342oa\374\355\213\277u\361\267G\177\233\364\267"
+	.ascii	"J\177\273\364\357\n\376\326\351w_\374\355\363o\215\376\266\350"
+	.ascii	"o\177~W\351\277\361G\002\340w]\374n\322\357\036\375n\321\357"
+	.ascii	"\216\340w?\360\273,~W\305\357\022\375\356\320\3576\177\267\003"
+	.ascii	"\277\273\302\357r\340w3\360\273\027\370]\025~\327\304\357\222"
+	.ascii	"\370\335\022~\267\303\357B\340w\031\360\273!\374.\b\277\353\301"
+	.ascii	"\357\356\374\256\005\277[\301\357\002\340w3\374\356\205\337\305"
+	.ascii	"\371\335\341\357\256\277\373\277m\363\267g\3766\357o\303\374"
+	.ascii	"\255\227\277\345\362\267r\177\033\345o\331\376\326\311\337*\371"
+	.ascii	"\333\262\277E\362\267G\376\266\310\337\n\371[ \177\333\343o\267"
+	.ascii	"\376V\306\337:\375-\323\337\376\374m\006\376\366\002\177[\201"
+	.ascii	"\2775\361\267%\376\326\204\277\025\361\267$\374\355\206\277}"
+	.ascii	"\300\337z\370[\235\277\355\360\267\020\370[\006\374\255\b\177"
+	.ascii	"\253\200\277\375\340o=\370\333\235\277\345\340o\007\360\267\005"
+	.ascii	"\370[\002\374\255\004\177\033\200\277\235\340o\001\360\267\027"
+	.ascii	"\376\026\371\267\306\277=\376\355\360o\335\277\335\177\273\376"
+	.ascii	"\255\376\367\233\177\357\375{\315\277\245\377\326\373\367\230"
+	.ascii	"\177\213\371w\336\277\361\376\r\346\337w\377\266\373w\227\177"
+	.ascii	"\323\375{\313\277\341\376=\345\337h\377V\362\357\263\177\233"
+	.ascii	"\375\233\354\337b\377\016\3737\330\277\275\376\355\343\337;\376"
+	.ascii	"\235\365\357\253\177S\375{\352\337R\377~\372\367\322\277a\374"
+	.ascii	"\273\305\277\221\376m\364\357\370\337\"\370w\013\377^\361\357"
+	.ascii	"\024\377\206\377\355\201\1777\377\335\363o\345\2777\360\357\f"
+	.ascii	"\374\333\002\377>\361\357\024\376}\302\277K\370\267\210\177\203"
+	.ascii	"\370\367\207\177\217\360\357\b\374\373\001\377^\300\277\025\360"
+	.ascii	"\357\017\376\315\341\337\035\374{\303\277\021\360\357\f\376\215"
+	.ascii	"\301\277\r\360o\013\376]\301\277)\370\267\206\177g\370\367\205"
+	.ascii	"\177\353\374\373\370\263\037~v\375\267\361_\373~u\202\177\027"
+	.ascii	"\377\025\311\257\022\340_\215\374{\370\357\340\277\333\177\025"
+	.ascii	"\362\257Z\377O\370\327\030\377f\377\r\374s\b\376\277\371\325"
+	.ascii	"\337\377\351\277\365\257\216\370\325\023\376\235\177\025\371"
+	.ascii	"\263X\377\323\376\375\237\315\373\3314?\253\346g\247?\273\346"
+	.ascii	"g\267\374,\227\237\245\373\331)\177\036\372Y,?\233\345g\345~"
+	.ascii	"6\356g\235\374\354\223\237]\373\331%?\233\366\263h?\013\366\263"
+	.ascii	"B~\366\353g\201\374\254\216\237\315\361\2637~\326\306\317R\375"
+	.ascii	"\354\214\237\225\361\263Q?\373\364\263J?\353\342g\223~\366\350"
+	.ascii	"gG\360\263!\3703\322\317~\340gY\374l\212\237\205\177\326\371"
+	.ascii	"\263B?\313\374U\246\237\265\300\317\376\374,\317\317.\177\226"
+	.ascii	"\003?\273\201\377a~V\003\277\346\360\263\027\370Y\025\376\327"
+	.ascii	"\375\254\211\237-\361\377\304\377\346\257.\375G\373Y\023~\266"
+	.ascii	"\204\237\035\361\263\"~6\304\317\202\370Y\022~\226\375Y\340\257"
+	.ascii	"]\374\354\357g\325\237\375\277\256\371W5\377J\366\257G\376U\354"
+	.ascii	"_\303\376\025\354_w\374\353\326\277\352\370W\031\377\032\365"
+	.ascii	"\257M\377\312\364\257K\377Z\342_\037\360\257\"\374\3000?\260"
+	.ascii	"\313\017L\362\003\267~\340\212\037\030\201\037\350\301\017\304"
+	.ascii	"\371\1771\376\037\322\377c\361\347\265?[\3757\341\317\"\370\263"
+	.ascii	"\007\376\354\374s\007\376\374\363g\237?\277\177\376\340\317\034"
+	.ascii	"\376\354\301\257\022\375*\363WK\370U\024~U"
+	.ascii	"\002\277\352\376*\373\253\353\257\002\377\363\375O\363\037\313"
+	.ascii	"\177\270\377W\376[\371\317\344\277\211_\265\300\377\270\377!"
+	.ascii	"\364\365\365\365\375\026t\360G`\310\017W\f?\001j_\325\222y\344"
+	.ascii	"\031@\250\206l\206{y\306\357\354-\004\020'i\034\307l2\230\212"
+	.ascii	"GDbkz3t3l\243F\207l\206|@\035xc\334l}\023\324\354\233@f\377\303"
+	.ascii	"\351\363\025\227\276\250'k\320\254\341:\"\313\032G\0225\215\315"
+	.ascii	"W\236R\323T:\265\017c|C3C5\3034\3033jt\210f\250\367\241tXf\210"
+	.ascii	"\006\2705$\243\341HI\233\355I\253\206h\206fj\332\007S\247\274"
+	.ascii	"6\300\035ovF\256^o\302\2271\302+fn\212\262\276\tZ\270\f\353\206"
+	.ascii	"`\206^\206_\206w\303.\303\274\241\335\020o\030F\215\016\305\f"
+	.ascii	"\227|x6\214\036C\025\270\241\230\341\025\253\031yV\246C1C\270"
+	.ascii	"U+\216*\200T\274\365D\313\027\227\224\341Z\334W\327\224,P\344"
+	.ascii	"\244Z\206b\206V\334\244[J\206kps]T\206Q4\034)\211\260\202e(f"
+	.ascii	"\210eHg6#\317\n\224\022'G0\350\271\341\026-vOij\262\276\tWsZ"
+	.ascii	"\206M\342\252\214\344>\324\242\246E\233\265\254\207q\277-nv\030"
+	.ascii	"e\371\337\016\315\276\276X\311\022\244)H\232\254o\202\324\276"
+	.ascii	"\tL\373$\372\366I\250\331'1f\237\204\335>\t\271}\022U\206om`"
+	.ascii	"eX3\262>\211&C\267a\333\366\221\325\3255d\373\260MCS\027\022"
+	.ascii	"\022f\373$\302\206N\2041\224\332\354e}\022<\206j\303&\231H\232"
+	.ascii	"(bC&\0376\311g\306\360 \223\365\323\f\323\376\267\256\232(\256"
+	.ascii	"\275\264!Z\036\027\273i\326C\264\341\222&FFGY\237\304\215}\022"
+	.ascii	"S\033x\022-\366%\260\267\377a\331\220l\203)@vd=\034\"\271[\306"
+	.ascii	"\362R\005eG\326y8\226u\244\240\2422;\"\346\002\007\332\226\254"
+	.ascii	"\207bw\313\373E\0327|F\206a{x:\312\206E\324\3500lHd\030\226\235"
+	.ascii	"\3240\2477Rb\303\350\021\032U\264\276\004\316\354\1778d\b\366"
+	.ascii	"\204\207\333\226\254\207`C!h\212\024\235e\375\265\203\200y\341"
+	.ascii	"e\377\037\372\030z\r\177\f\201\f\273\324\3500\310\220+\356\212"
+	.ascii	"\032\032\025\263\257)I~U\356FD2\3061\\\224}\r\203\f{ `/Kk\254"
+	.ascii	"\214\225\335\234P_\002\\\366%0e\377C\036\331+\r\206\021\215\035"
+	.ascii	"\303\034}R\255$[:\204gpuP\262\326\212\202\242\002\227\365%\220"
+	.ascii	"d\017s\f\251T<\"\324Y\f\305>q3\304\032\336\030^\rq\f\263\324"
+	.ascii	"\3500\307\260\306\320\206z\026+\251Y\275p17\245\361\346\313\315"
+	.ascii	"TW\237\213\271\3510\307p\006\020%\027s6\254\004\341\022\352K"
+	.ascii	"\240\307\376\207U\177\353jYS\343+\353K k_\002M\373%\274\331/"
+	.ascii	"\341\314~\t^\366K\240\262\377\241\324\217I\351\354\250\"\005"
+	.ascii	"\201\242DF\324\020\2322<\250\017\243\362\230*3\037Y\017\237v"
+	.ascii	">\204\"\036)\272\341\225\365\004C'!\336\260IX7d\032.\341\324"
+	.ascii	"U\311\222\3650\306\230'mV\262~\tg\373\036t\021z\321\352\373\212"
+	.ascii	"\273\023z\371E\237\266\224\2727R\302\b\305\374\242O\333m\t\033"
+	.ascii	"\026+\355\005\213\305EiX$\234\"\234\373E\237R\330\212\261\246"
+	.ascii	"\r\326\260H\270e\013\306\327tO:D\022\272\031&\r\217\206.\206"
+	.ascii	"-\2060\206/\204o\206\361PI\33074R\243\303\"\341\336\205|B6`\206"
+	.ascii	"EB2\3025\277\350\023\nK\370\200R\206E\302/n\244v\303\"\241\024"
+	.ascii	"\252\263Um-\216O\203~\t];H\246\"\327\227@c\277\204$\255\013\327"
+	.ascii	"\374@)\3021B5m|S\232d\235\306M\222\327G\226\365G\210\331g\204"
+	.ascii	"z\373\351\027}jah\211\221\n\315\b\321\250Q\341\031\241TxFX\206"
+	.ascii	"\235\216\221\34670\262\262\254\372#\266\354\217`\262?\202l\177"
+	.ascii	"D"
+	.string	"\221\335\306j\316\212'\314\003\0361\263e\225\365GX\341\215X\332\027\261\267/\302n_\204\232\320ne\n\213\303d}\021>\204u\"f\354\207p\263\037\242n?\304\333\326\202\027\245\263\221\365C\020\331W\311\250l\021V\231\223j\301\"\274\002F\232E('\214\023\302\251Q!\026\241\025-\304\322Va\343\266\006\236\026\rW?\304\327~\b\251\375\020M\373!`\354\207(\332\007\261f\377\302(B'\353\020&r4\226\324\370Jc\372r\243\304\306\031\216<4'\251\320\211\220\211\320\2110:&\245\206\217M\270&l\023\276\t\241\b\335\204O\324\250\320\211\260\311\205j\252\226\237\232$R\244F\355\252\310\365 \242\354\203\200\262\017\202\311>\b%\373 \310\366A\020\331\007\361c\037\304\326\376\205I\204e:\242\204\315e-,\023\"Q\361\246Rf\276\246fjTX&$\3030\324\302z\261\246\365I\230\356\223"
+	.ascii	"f\377\302\261)\036X\316\262\276\272\205/\316M\337\0267kT\266"
+	.ascii	"\274\346\214\232\275/$\027*\233\233\020\210\260\206PJX%\024\""
+	.ascii	"\264\022\362\020v\t\213\bg\b\275\204D\204a\302/!\225\360\210"
+	.ascii	"pJhC(&\364!4\"\274!\f\"\274\022\376\020\346\020r\t\267\204C\204"
+	.ascii	"YB,!\016\341\016a\017\241\226\220\206P\207\032\025\202\t\241"
+	.ascii	".\214\022"
+	.string	"\312\270\376\361\320{!\235\376f\250tT\r\020\323\223\026\005\323\360I\271\204`\301<\025\257\351\013\355(.h\306M\360\315\322ZR\231\235\030@\037OZ\300\t\301\204N\302\247$_LN\276\224\332\244HY\244l_B\030@\037P\232\204Frq\234\264M\236\224\n\0311*\333\322\236\260IeS\223\n\301\202l\304\240\021\202\005\307LI\221\201\023\213\343\263\366\316\016\f\022\022\372w\246\346\254!\250\310\365$8\021>\251l\354\220\276&3Y\237\204%\373$\b\331'\001\307>\tR\373\037\316\354\177\310\262\377Am\377\303\217\375\0178\366?H\355\177P\332\377`\264\357ao\337\203t\337\003\335\276\007\265}\017_\373\036n\354{@\332\037a\272?\202\230\375\021\344\366G`\262?\302\330\376\b\\\373#4\355w\320\333\357pe\277C\222\375\016Y\373\035^\354G@o?\002\\\366#\020e?\002J\366#"
+	.ascii	"\266\037\001\032\373\017\342\005\303\374\236\270\225Q\005\277"
+	.ascii	"\004\301\250\321`\230\340\335\231\227$\037\004\303\004\355\202"
+	.ascii	"OB$eU`\254\372\021P\332\207\200\231}\b\320\355?X\247u\265\204"
+	.ascii	")\353\1770\005\357mL^\0241n\036PQ\331\302d\t\306\005\261\004"
+	.ascii	"\345\202[\202\\\202tA\270`\227\340\234\032\rj\tVy\320J\360JS"
+	.ascii	"\233\236\226 \224\240\225J\307%B\315^PK0\032|\242\322q\3519>"
+	.ascii	")\037\033\320\307\026-A)V\234\336Hi+zX\246\350h\365K\315YuT\344"
+	.ascii	"z\b\200\355C@\307>\004h\354C \306\376\003\332\354?@\314\376\003"
+	.ascii	"\264\354? \312\376\003\320\366\037@\266\206\364+\323\242EH\326"
+	.ascii	"\177\200\017\265`\0235\032t\022T\362`\232\0172A'.\233<C\245\343"
+	.ascii	"\322ca\326!g\334\240V\235&\006-\310$\270D\215\006\323\322\306"
+	.ascii	"\244\031\025\300\212\223\031\252i\006O\263-6[\337\001f\366\035"
+	.ascii	"0\267\377\340Yp\314\f\226\250\242\254\257j\351\021F\232\347%"
+	.ascii	"\207\366Ce\233\013\002\364\021\f\013\032\t&"
+	.string	"\t\026\t\212\005\311\202eA\263 \222 \221\340\0215\032\034\013\202=8$Sy\026\202\345\253k\013\027\320\007\036\017\240\217\340X\320\007\030ip,\370E\304)\257\3154\216\317\326\254\271:5\0304QE\256w\300\217}\007\340\330w\200\323\276\003\214\366\033`f\277\001\\\366\0330e\277\001\321\375\006\200\3557`\307~\003j\3547 \306\376\203;\3263jvMZ._0\306\357\354m\267i\335\220j\005\227\202V\032\222\304\226\202\250\231n\005u\004s\004\261\202Yj4\250\025\304\221\203Z\301+0\340\334\032\266\024D\3154\250\025\274\241\262\021Y\n\242f\310\205\205M\212P\237\001i\366\031\200\267\317"
+	.string	"-6\324\326Z`\2155\241\n\326P\243\301\252 \023\233\254C\245\343\0221\026'\rV\271o\2024T:.\021o\344\244\272H\232$iV=\225\2050\246eY\237\001@\366\377\240T0*(#\b\245F\2033\202NjOn_q\034\317`\373\232\021lj\373\232\341\366e\251\017\250\234\306\314\246q\034\027_d]\225q\365\027\300\267\277\200\271\375\005d\331_"
+	.string	"\332\376\002\310\20202\b\343\356\326\342\254\277"
+	.ascii	"\256\255\024t\241F\203/\\7o\202-~go\333Mk)\370\302e\343\266\321"
+	.ascii	"\212\361\345\232\361Q\265\352$\fC\036XEpd\375\005<"
+	.string	"\355\253[\202EY\252\357+\210\0244R\243\301\243`\034<r\373\3246KA\324\210\305q\234\001\206\f~{hZ\244\253\376\002`\354\213\240f_\2042\373\"\340\355\213`\305ms!(\203.L\215\254/\202\224}\021\222\354\337\335s\363\204\204!9e}\017\242d\251->\351\225\274/U\315I\023'\264\2665\325\256\351\213\254\312\033\033\351\224\251TUs{\363\225E\213\222/=\366\0300\252\232Z\r)\031\327\213\213\347\316\271a\334;W\214\253\306E\343\332\271\\\\0n\032W\352\232q\247\356\026\267\214\333\305=\343~q\327\270t\356\030\267\316\325S\243n\236\033wW\316\325\202v\325\305\304\206TUc{aE\214\264\311\227\252\256%\\O\232,I\261\314Q\321S\325\240d)\0270\334<\027nG\312\336WW\236\233F\024c\002#\202\201n\t\222\026 \350\374\246\346\254\031\250\310\365\"\200\355\213"
+	.string	"\265\037B\337~\bg\366C\250\333\017A\312~\be\373!\350\330\017\301i_\001j\366\025p\267\257"
+	.ascii	"\270}\0050\331W\300\220}\005"
+	.string	"\344\330W@\323>\bj\366A\350\262\017B\333>\be\373 l\355\203Pc\037\004\245\375\017\312\354\177P\267\377\001\226\350Y\032\222./n\022\327\314%s\313\\$j\324=s\307\256\305d7W\213\270cMy\323i\230\325\227X\325\227\021\033_\356\231{De\003k\312\233\212\255\205}\311!\324\377\240\307\376\007X\373\037\310\330\377\240h?\001b\366\023pe\377.\021w\210\022\035a\274\262\006\013\036m\271\302\312\372\tX\262\357\001V\336\215_\025\361Gc\207\313\303\365\341\006qu\270?\\.\027\210\333\345~\271=\334-W\210\032u\275\334\034w\263\\\25556\364\244;\256\227[\303\365r\255~U*\035\225\036s\275\334\031\356\224J\307\245\311\332H\257\252\244T5\327\353\247\364kR\351\2504\2217\3228\216q\344}\271^.\325\007h\232\272\264\231\016\313X\331\375\320\240\363\223\232\263\016@E\256O"
+	.string	"\214\375\004\030\355{\260\267\357\001\231}\017\356\366=\330\262\357\001\226}\017\334\366=8\333\367\340\307\276\0073\334)\325N-\242\001\302\367#\353{"
+	.ascii	"c\337\003\243\375\2732\256\230i\301\221u\346!\205\t\214\3104"
+	.ascii	"N\016\216ej\002C\243j\323\267\3430&0\"S20fgl\033\326\215\213"
+	.ascii	"\365\211\225\301N\225\271OL`D\246-\\l**&0\"\354\023\224j\347"
+	.ascii	"R1\201\021\021\003\276\255cy5\370\230\300\210L\335\247\326\215"
+	.ascii	"\253\324\252qa\264{\256\223\333\242=\323\242i\307\270Pm\233\366"
+	.ascii	"M+u\227\334#\267\251\325k\247\355\032\367\205\033\267iZ\276\226"
+	.ascii	"\215[\324\226q\215\332\276\226Lk\306\215rc\270L.\222\353B\215"
+	.ascii	"\272I-\336\333\274V\214\233\324\206Q\361V2&0\"l\033\366\215\026"
+	.ascii	")\227\235\026\220-7ism+\277\350S\tK\216\324\250\232\362\302n"
+	.ascii	"\351\302\356\375`\337\230\300\210L\231\234T;\rIq\214u\345Vi\231"
+	.ascii	"c\263\204\320\342\251\204\272\274+\034[G\b-\236Z\030G6n\254o"
+	.ascii	"\230\300\210Li\2749\332Hp\322\243\244+&0\"\323\270"
+	.string	"(w\212\t\214\210\215m\265\251\324\236\334$\326\306\023[5e\002#2u\223\332/@7\033+\025&0\"n\322\306\322\326\205\320\342\251\204%A\244|n\022\313\206\335\373E\237$p\264\245\310M\332F\254\023/\226\b\023\030\221\251\233\324\336\255V\230\300\210\260Vw\223X\034l\226.6\313O\311\0237mHhu\352L\315Yq\300\250\310\365\034\330\354s\020\263\317A\313>\007*\373\034\324\3669\230\355s\330\321\326\375\373\312\206k\273\b\243\244,\241\311\232\213T\207\321\226\254\317\241\306n\347v\226\326,\204\026O!\352\250\332\271VI\253\345\027}\222@]\215--\235\032m\347\332$o\317\332\3501``cL]\241\255Z.\230\345\313\322\215\254\317\301\305\336j\341\332+K_pmZK\345\027}\n\241\025C\332\302\265U\200nD\244\263\270h\225b\002#\"\026\327fi\261\250\321\026\256\265\202a"
+	.ascii	"o_g[\177g\315\376\216\227\375\035.\273\245\362\267KZ"
+	.string	"\264vJ\306\212KB\365\226\265\024\267\315\321\031!Y\177\007\313\276\007N\324`\324\305x\302DkIJ\326\244uk\241\264m\355[\033E\215\266l\355Z\\\313\3262\271[\022\032\002\204\fa\257\272\300\275\t\365w\252\354\357\260\355\3570\331\337I\262\277#\266\277#d\177\007\310\376\321\2519k\003rl\fgj\316\372SR\221\353w\244v\026\206\"\025\2616^Yg\036RMbT66M\366\322\360\002\r\270\205uq\267_\364I\247E]\022i\034\307@)f\200uWK^V\3235a\200>\346\276v\236\330\222\227\325\264\305\332j\200n6\330(;V\n\213Ef\227\351b\347\244[N\213\272gf\311\313Jl\217Q\367j\260D\226\274\254\246k\366\220+\366i\311\313j\272\351Z\254\315ew\321\220$'\005h\0074\363\213>\265MK\332\244\\\255\213\326)\311:\375\240\305j\253~U\032\216\324"
+	.ascii	"ik\240\321\302\332\020#m\261\326-\300,\277\350\323\tZxR\026\013"
+	.ascii	"o\214k\325\321J!Y\325l\272:\026\213\2452;k\261\326\260u\016\310"
+	.ascii	"*m\261v\034\213f\311\313\252\305\332\323\266E]\231\264\355j\263"
+	.ascii	"Z!-X{\243\365j{\264[-WK\244\265ju\264FZ\036mXK\326~\265c\355"
+	.ascii	"\220V\254\005\322\342h\257Z$mY[\244\r\322\036im\2649\332\037"
+	.ascii	"\355\216\326G\253\245F[\254\215\005\224r\206\355+/\265X\033\r"
+	.ascii	"K\265\344e5\335r-\326\336\242'e\261Z\254\355e\203\321\360\"\216"
+	.ascii	"\263~\260oK^V\323\026\013\230f\325\352\261\266i}T\255\221\002"
+	.ascii	"B\177\347EK5\365,B&\307\031\032S?\037\3220_3\336N\025\345=\371"
+	.ascii	"\022\325\312\200j\213\314p\"FK\024T{G\326"
+	.string	"\246\346\351-\324/\315\325\016 0\222P\315p\313\272mR\211\260\351`I\313\324.!\355)\231\213\361viOEB\246nM\326\355\213\026\306\376r*J\202\261s\300\305\275\251\312\372iZ\245\377m[\306\313\026\256\254\377ViKH\033\222\254\337A\221\335\006\303\257\t\322\221\026I\215\266I{O\255M\332|\355\221\206#\245\330H\353"
+	.string	"UMYh\204\361\213\275(Z\377\355\321[\243\246&\251R\326mQ+'5\003K\326\357\240\305\376w\237\032mc2\030\344\030\022\225\365\323\3547\377\333\314\303\213\036_\326\333\315S\334\244F\326mb\250.J\262>\007h6\233\275\227s\030\331Ae}\016\312\354s\260e\237\203,\373\034\254\355s\020\335\347\300k\237\003\255}\016h\354s\300\244\267\245\277\2636,]\372\364\316\354o\360\262\277\001n\177C\332\376\206\"\373\033x\354/E:/+mY\177\003\325\276\333\020c\253_|\273K\236\241bM\263\020\t\313\372\033\220\331\252\224n\177\003)\373\0330\331y\203\260\375\r\274\3667\320\332;\261\232\263\256O*r\255b\004Jk+\353o0\265\237\335\270\275\331=\244\354\2566Tv\224=e\277\251\321-e\267}\357\330<v\017)\333\207\033)@/\233M\206"
+	.string	"\3240\335}M\177kX`\320\\\375\r`\354#\300\315f\373w\217\375cCqc,\301\322\221\365\023`\213\245\245\266\254\217"
+	.ascii	"\274\264\355d7\331h;\311V\333f{\311\216n%\373l3Q\243{m\217}#"
+	.ascii	"\331d@\344\230\356\276\246[B>\220\341I\371\274\306\034\021+\233"
+	.ascii	"c\272\373\232n\355\265\035D\fW"
+	.string	"\021\240\021\230/#s_]a@\243-_{m\213\001\335T:5\035\246E\272\265\327\366W\336\327\332&\262\207\250tj\261\021\224\bR\230\356\276\246B\2453`L\022\350#\340lk(*r=\002\200\354#`\307>\002n\354#\300i\037\001E\373\032\354\355k f\203\t\215\246\332\270d}\r\352\3665\240\262\257\201\223}\r\314\3665\b\333\327\340k#5\330\261\257A\325\316_*r\275\00626\362L\315Y\263\230\212\\\327\267\255ck\251\235EQ\312:\353\307\205\210\215+Y_\203\027{\347\330X\353\230\336\321S\326\317\240o?\0033\273\315@\313~\006n\273}\312\340\310v7\325\246\221\243j0\341\312zj\215\341\304\306\227\254\237\301\326\376\277el)5\272gl\250=c+\355'\225NM\204\224<\351\236\261\243\330i\324\016\034\023\030\221i\034\307\0312\310\200\310\225e\206j\325?\300t\377"
+	.string	"v\333I\205/f4\262\376\001\340\366U\264\030f_{i\277(\333M\233I\215\356\245\335\036\311!\326b\325?\200\225\375\003\254\355\037"
+	.string	"m\377"
+	.ascii	"E\366\017\260c\273O*r\375\001\242\366\017\220\264\203q\231\035"
+	.ascii	"\224b`\267\2051\006m\373\030\030\331B\f\270\3660V\221+\273\367"
+	.ascii	"\263t,\027v\232w\310\361Qe\275f\263\371\3202\222\3651\250\261"
+	.ascii	"\301`\221z\261\361Ffg\226e\347\013\226\257.1sY\360\302\260H\353"
+	.ascii	"\356\246\322\251\251_V\262\334\335\215\330\3061\034\2227\326"
+	.ascii	"\f+e\321\260iX=\366\f\253\206\035\303\226Q\243,\0316\217%\303"
+	.ascii	"\206yR\324\001`Kg\252\246q\034\007\251\336\224\300$\3651\230"
+	.ascii	"\332\307\300\305>\006H\373\030\024\355_\360f\377\0026\373\027"
+	.ascii	"L\367/H\263\177\201"
+	.string	"\231\375\013\364\366/\330\262W1*r\035\322=\331\304\013\216lc\254\"W,Q\316v\020\311\372\027t\355{\220\305F\212\233/\366\n[\205\205c\251\260S\324(k\205\215r\366\006{u\f,\226\0256G\033\251\025V\007{$\204\026O'h\361I\255\260H\330\267\020Z<\235p\264'\3354\222T\351\t\365/\310\261\177\201\214\375\366\347*v\214u\013\356\235E\321|\254C\336(M\201\302>a\327X65\312\266\261\\f\037\023B\213\247\266E]\234\264\215\335b\235\204\320\342\251\215\261dN\312\266\261dZ\3306VN\252\272\271\"\335\342\352&\254\032\223\266\t\323\335\233\254\177\201Q\023\226I\2213g\336\262f\231\270\r\311\346d(e\315&a\321\214\362\334\314`\321\330%j\320\250\306\262Vb\204L\212T\3267\300\336f\243\354\231\320E\017+\322\3754w\373\337\252E\332\216\254e}\003\200\3317"
+	.string	"\227}\003\310\355\033\240\312^c5\207=\362\347-V\213\025\023\006\231Ae$k#,\037\324\217\260\254o\200(K\204-\242F\3310\026\214\rc\267X!!\264xj\235\216\304\260a\354\220,Kg\252\304\\&WQ\220\254\372\006\250\3327@\013\366\353*\254\bV\326/\200\336\276\032e\203\260^Fgb4\311\232\365\002F\263\250H\311\232\345\301\376\370\337\262F\320\206\320e\375\263?\272\350t\320H\313\332\007K&\314lM\326/\200\334f{\260\\Vc1\225\254_"
+	.string	"'\233\335\361\266\377m\321i+jF\326O\323\352\031Q\220h\311\372\005\210\356\027\340\310\326\005\360\332/@\326V\013\320\264].\025\271\036\261T\344z\013\336\354[\200f\337\202\273}\013\240\354[`\204\235\301\356\305\260\343\222\365-\300\301JY"
+	.string	"\265o\001\322>\001\3706\016\001\244\373\004\330\262q\350\330%6\306W\354F\307\302`_\250Q6\006\253\224[d\251\252/6\006\353\"K\255`KfQb\031\210\023\263\267\352\023\200k\237"
+	.string	"Y\373\004\260\261\1776\211EJ\"3\003&k\366\350\f)\306\024\0337Y\237"
+	.string	"F\373\037\260!\373j\203\344\253\2175b\213\324(\033\257n\220v\330x}\243\262\335X\371\226\214P\005\241y\345\330\372\003p\333\037@\330\376"
+	.string	"~\354\017\340j\377+\337\272\246\310\035\225\245\254\3275\300\255\265\214\321\230\257\266u\r\360\215\214tM\263\252Y\247\353\236\032]\327\254f\276\236Y\321"
+	.string	"\333\276\256\311;\200n\033\314-\005Q3\005BY\327"
+	.string	"\331\n ]\n\242fZ\264\301d\f\315\325\30335gU\341T\344z\001\244\331R\026\357\006\037T\326\027\200\230\r\234b\266\344eu\267\352\255u+\336\372e\005\263\216Y\363V\272\265\313\352e\345\262\212Y\303\254vjt%\263n\035\330\006\214R\005\244\003\326\375\242O\373IR\225\024\310\n\226\266\364\005\264\003\232\3211\346\202i\3711i8\212\343\253*wl\311\313jJf\035r7\r/\342\030\316\206;\265\344e5\335\242\356\271aK^VbUd\200s\352\336\357\354\213e\262e\005\224\362\225\314\272\005\230E\303\21386:\342\276\255d\200iV\255\020Z<\225\260\325Df\r[\347\214\200\270QUq@9\rGq\214u\303%[\362\262\232\256d\200h\234\310\310\254:\326\037!\264xj\233\322\230V2\3003y\206\206\24486\272\341~-yYM\3438v\241\306\320\224\251@_"
+	.ascii	"a{\325\222\241\250\203\207\221\227\254/\200\035\333\310:\366"
+	.ascii	";\373\002q\324\204e\225[\263\250\3215\016i\215[\221\254n!\264"
+	.ascii	"xB\341\210I\032\267\302]\356w&$\216uX\2558\226xX\321L\270\260"
+	.ascii	"\340\330\372\025\344\355\347\246&\031T:\256\b\200=A\203rD\352"
+	.ascii	"\266\222\255L4\034)\221\200\203\"u\362*\3046\216\263\324\236"
+	.ascii	"\214I\3270P\351\324>\274\255n+\333\253x\211\241\255n\253Z\006"
+	.ascii	"\225\216"
+	.string	"+6**\300\214%-\351\264\312ze}[\251\254R\326)\253\2255\212\032]\335\3266 \223\264)\033\034\375\nv\354W\200c\277\002\032\373\0258\355W\320b?"
+	.string	"}\373\001X\263\037\2001iP\212\364\2728e\375"
+	.string	"\310)Y\227\250\321\025m5+[\317t\214\371B[\243\353\031\316\230<6R\323_[\036\232\264U?"
+	.ascii	"6\366\277\236%\t\276)\273\361&\311jF4\013\262\244#\353\007\340"
+	.ascii	"h\237\2026\373\024\244\331\247\200\314^\307\376\225\310Z\004"
+	.ascii	"\350\344E\234\213\254W\261\235\257G\222\270\226\242\262\276\340"
+	.ascii	"\313>\005]v>SsV\fT\344z\n\256|\255B\202l ^\254\250(\371\nR\247"
+	.ascii	"\026\203\361\372\032\344dV\274\"+|H\326\256\036m\246\242\004"
+	.ascii	"\311\372\024\354\330W\243\253\217\036\231\215\310\013(\\_{\354"
+	.ascii	"\t5\b\371\344\346\244\262~\232\225\307\377\226xg\3466%\353\177"
+	.ascii	"\345\261\203\310\324%\316\332\261n\265j\300\270A\222\365)\270"
+	.ascii	"\261O\301\324\232\225\363\312h0\311\372\024\300\300\261b\251"
+	.ascii	"\3215\007\220\017\303\232\003\250\006\270\307\2069\223\003\310"
+	.ascii	"f\275\241\322Q\031c$2n\244*\023+o\314\254zmZ\253\304|Y\2556\326"
+	.ascii	"+5\272\336x\fe\275\001l\263&\021\213\216q\274\243\315\327\215"
+	.ascii	"\265\305\272DD:\213\243V\275\243\274\252\f\031d\020\\\332\272"
+	.ascii	"Q\264\365\377\225j\255\241F\327\252\225F\324:E|\242\225W5\255"
+	.ascii	"Z\235V(\rGJ\"\250\344I\367\024\037Tz\254\372\023\274\331\377"
+	.ascii	":5\343\205\333\220/Y\257R\356\f*:*Y\177\0023\373\277\032]e\\"
+	.ascii	"m\022\222\024\227\365'\b\263\257F?f}"
+	.string	":\031\335%7U\226\365'\260\333\237@\313\376\004X\366=X\227\324\274\365\205J\247\366a\216\314\032ceR\243\353\322\nc]\002\272\311\242'%\006\031\202\244l\325\237\200mk#HM\264\254J\253\213x8$s\243\n\221\254?\301\222\375\t\222\354\377\353\321\212\244F\327\244\325hM\002\276Y\2134\034)\215\270\342\223\256I@7\301 C\362\252\246q|\206!\203\fX\035R\222\370X\365'\220\332\377Z\264\3065\224\330\332\234\001\257P\331\001Q\243\300> _\214!\210\007#&\223\365'`\332\237 i_C\233}\rg\3665|\331k\200\323&YfbY_\203\2265\032\252\354k\210\262\257am_\303\222]\006CQ\306\215&JY_\203\327\276\007^\200`~\321\247\275\306#\b\031\240T\215\002\365\200a\200z@<\340\030\225N-6\222a\301\232\243.T\323\265)\233\251U\347\001\305\024c"
+	.string	"q\321%\315\363\262\017\200\267;\340\227\034\225\346\003\355\256l\037"
+	.string	">\200]\352\324\360\275\310\372"
+	.string	""
+	.string	"r\001@\324>"
+	.string	"\224\366%`\263/\001\231\r\224\273\312\266B|\341\230\345\t\307\027,D\222\222\020\311\372\022L\331\377\201W\324(\020\016H\005\016X\005hE\245S\213c(\004\034\2211D:Um\304\035m\321\332\312\201n\371-LT\221\254/A\330\276\004Y\373\022\310\330\352\223\212\\\205\261\232\263^\202\026\033\350v\267\234\267\224\271\232f\255\236\211\331\352\033\360\t\260I\360\355\256\314\\\216)\016>i\023\340\025\0335\240\023 \023\340\032\020\r\230\246F\201M\200\321\003\225"
+	.string	"\227<\237\3051Rn\302\332\223\002\233"
+	.ascii	"\267\200g*\035\227\226\213\201M\200Yz\355\024)\"<\210Z\245Ss"
+	.ascii	"V\r*r}\206\271\235\204h\006\n\026\223\254\237\201m\357\b\243"
+	.ascii	"\242y\005o\341-y\227\364r\265U\365%\353\267\260d'\353T;\273/"
+	.ascii	"d\\\305-!\033\027&lY\277\005\257$]\222\3168\2253WD\363\246\005"
+	.ascii	"\033Z\264$\347\330*\034`S\300\027QQk\346\360\360\214\320\005"
+	.ascii	"\311\372,\362\222q\3118+SxT\246]SnuY\237\305\332\225+I,`Vzh\246"
+	.ascii	"k\323\023\243\027pOb\271\320\347\006\213\305\217d\225d\025\343"
+	.ascii	"T\362\310\227\236\334\264\005\022\216\254\317\302F[[r\212\252"
+	.ascii	"$v\252\300\321\020\351\020/\353\005\025)ON\231z\221\225\225u"
+	.ascii	"2\3120K\361\016L\021!Y'\337\206Y\270|X\205e\235tc\301\004\005"
+	.ascii	"JRG\324\225\227\\\333\2244\\\262\376\n5K\226$\327\3240+=4b\277"
+	.ascii	"%Ec\214\234<\2716\346\253\007\215\254\223j\311\030pR\256\270"
+	.ascii	"e\235l\222L\033C\222u\222I2\255\2751M+\223u\022-\231\206D\017"
+	.ascii	"N-\231f\204\252\262U\026\203-\031MF\223"
+	.string	"42H\001mD\261\200\311\372+\302\222e\311\262d\222+J\264\306\304\334%\027Z|fO&q[+\353\203[\201#9\226\034K\");\323\223\023:1\351\261%\211\344nT]OY\177ESR,)\2063\005\211\222\273\261\351\031\032\247%Y_\205\232d\221d\221dX\031\330\335\230Z$\343\007\22205-\311\214\353\210]rHr\b\316\224*\242\224J\306d\317M\326W!\227\334\361d\217\344\216\244\220\242\222\325\nu\004/\214\312\217'\205<\371\305\341\203W\201\002\346\213+\353d\220\253=\3160Q\312\372I\257V\210\030(o\262N\002\331\340\006_\2166\311\256\353\t\263D\231\332\310:\351\343zC(Q.\253$W\222\207\212*\311\254dVR\307\233=\346$I\224\244\326\223:t\236\2264RT\230\r\247\206SI\254\036\254\325\025\233\247b\223\216,GXI\034rsrsY'\257P"
+	.ascii	"\013S\361\224\274\221\264\221\264\0214\273\n{\023\323{E\230\340"
+	.ascii	"\262~\2126\311\032\311\032\306)\fXEi\202oWam\332\230\310d\375"
+	.ascii	"\024uI\251\244T\222\006\331W\261\305\032),SO\322\020\306\035"
+	.ascii	"Q\025e\235\2341\314\322\252\001C\363F-\351\224tJF\361\271gB\234"
+	.ascii	"\306$\241\236\214j27\035\222u\362\251U\322W\342\242\304]JWJ2"
+	.ascii	"a\300*2\363\001\021+=4S\035\305\350K\234\\z\222\351\310&\024"
+	.ascii	"Cg\264%\031\243E\326\236]2F\022\006\037\231=%Q\236L\321\314\222"
+	.ascii	"/\216N\350\264DS\304H\032%\215\222-0`\025\231\021\301\312\225"
+	.ascii	"\336\034\232\370\254+\331\"\231\324\304\006/\231\224D\332c\022"
+	.ascii	"E\032\306\330zJA\370\262N\036\t\367\366^D\305\330\275y\223\214"
+	.ascii	"U%\261\023+%\245\206O\354\227\004&\216\255\357\311X\203\261("
+	.ascii	"4\242*i\322 \333`\300*J\263\302I\251\341\233\026\253 \3411as"
+	.ascii	"d\033\"W\232\240\262F\362!\301h1bMD\366\376\267*\024\201\223"
+	.ascii	"\262\207\234rI\023E*k\344\032\253\2707!Y\237hm#\325\b\233h\034"
+	.ascii	"7h\300e}\242\2601G\226\031\203<\303R\301\320\003\311\346\n\317"
+	.ascii	"j\032+Ya\360\263\003\207\234\231#\317\\n\355K{\313BJ\331/^\342"
+	.ascii	"\224d\215\324\003\332\220\221G\204\314\337\n\271\344\346\314"
+	.ascii	"d}\242x\037\336\313\313C\2069\362e\266\004\213A~A~A\206Q\225"
+	.ascii	"\304N\032\320\\\335\275\261mR8\030a\220`h\314M\221`H\b\263\221"
+	.ascii	"\227\365a\263\272:\244\027\fXEe00sU\3674e\225Dy\001fw\244\027"
+	.ascii	"\025\257\305\230\332\233\254\341\245\2719$\027\f\322+/\271\266"
+	.ascii	"F\f\260!tGr\351\202\004\315\215\254\221[4\236\226\023\266\247"
+	.ascii	"3S\216\2742\005)WTS\343\230*>B\212\257pH\260e"
+	.ascii	"\310Vu\004\013\356H\271#\3438|\200\2741l\252\222\245&kd\026,"
+	.ascii	"H+A\263*-\352\262FVQw4\321u\241\362\267\3022?\246|d}(\231}\350"
+	.ascii	"\02777d\024\225\214\206\02131\"\232&3\332\274\035\031\245\212"
+	.ascii	"\272\206\b\032\037\032\257h\204M\214\273\254\017\235\362\344"
+	.ascii	"\t\222-9\267"
+	.string	"\362qUy\203\204r$[\025\2478\274\262\254\257\207dA\276\314e}(\032\032\032\322\311\177H\361U\222\265\212\206\021\263i\013\303H\030\263\264#\235 \325z$\355\210\313\032\331\204]\362r\022g}\350\016$\023hR\222$H%\031\306h\0301\2332\231r\345\n\031=R\t\231\241\024R\334Z\326\3103mf\330\307\327\207\3664SV\206\363\206\001\253\250\214\005G\236\364V#7\254\300\331!Ab\234\"R]\205\275]0\305\312\233$F\214 \217\250Jb'\367\311j\215\224\330o\354\305\035\016\261#\217\f\323\244\321\231\031\0312\004Y\004\003VQ\032Wl\n\217\312\224X\267\003F\f\"G\026)\036\025\371\301F\3242\024\033\343\245\306V\220 H!\252\222\330\t\276\362\222\023\366=\261\023\362u\244\020]\227\344\016\f\336:\347\324\206/\353?\231\272\272\220@T%\261\223*F\303\210\231X\034Sa"
+	.string	"l;\362\342\365C\215\"\201"
+	.ascii	"\221H9\243\301\366\277\005j\251\021\343\226\365=\320\207\344"
+	.ascii	"\201\344\201\354\241*\211\2350\250\271\362\222\023a\013\315\031"
+	.ascii	"\256#{\254\305T?<p\206\234qd\215_\215\"g \267~w\352YL\205UTF"
+	.ascii	"\0046W]`\323X\211\n\203`4F\224K\326?\022\353\310\255#up\370\340"
+	.ascii	"c\304\302\356\214\262Fj\235H\245E\2124\353#s \263\376\326\035"
+	.ascii	"\262\205f$\353{ \307\376\006J\246\240\240\262F\342\310D\306,"
+	.ascii	"\225\311\032y\365*T_\246<\2207\346\264\352\216\262FV!m\250\321"
+	.ascii	"\307!\255~V$Jq\341\201\252}\365q\353\b\324\307\255H\032GR\375"
+	.ascii	"m+\345j++\353{ j\377\310\251\277e\327\356l|e}\0170\355{\240\205"
+	.ascii	"\360Lx\206\224\201\001\253\250\314\001\236\256x\204M\343\230"
+	.ascii	"\n\003\315\203\257\f/k\244\fd\324^\r,7Y#\241z\266\232P\311\372"
+	.ascii	"C]\366\217tB:\031\21700\306Hu\323\267\370\211J\203\034\367uV"
+	.ascii	"$\353\017\265\2059\216t%\262\026Q\2438a\220L?%\252XF\006ue\333"
+	.ascii	"\353)I\226\254\221K\254\321\227;,Y\177(\272\257\222\225\3019"
+	.ascii	"#\006\007M\236t\r\316\236J\307\025\201\260-R\240\033\0343dxI"
+	.ascii	"8l\220F*\035\2251Fj\233J\3438F&\341\250\001\343\002\031\003\t"
+	.ascii	"\003\251\204DB\266@\276P\243\310$\034>d\022N\232\"\032$Mh\030"
+	.ascii	"5N\231\217\321p\244$\302\fY\204<R\243H\243#\2156\0372\316\022"
+	.ascii	"a\356Jk,C\006C3v`l\254\372G\3068}P\316x\234\311\032\347\r\025"
+	.ascii	"\215\270\244\254?\224c\3778m\324(\216\233\223\331i\304\242\260"
+	.ascii	"\371\230+>\264l\354\0175\341L\267\027\351\215\271\254?\244\264"
+	.ascii	"?\204\264\357t\263\357\234\356;\317\354\037\347\f\216\031\264"
+	.ascii	",h\346\314hY:\312\372N\275\2153\006G\2578\366\266\343I\326\307"
+	.ascii	"!\363\277=\301\307\226'Yk19.\310\027S\326\307\311#\202\361r\022"
+	.ascii	"\315\3728xO\372\320\324\310\232\310\267[8\271\\\340\336h\303"
+	.ascii	"a#\353;\235\340h9\316\035\216\026\234/:z&\203x\224\304J\203 "
+	.ascii	"\035\233\231.Y\353\262\263%a\262\306\251\303\361\262\213\374"
+	.ascii	"m;e\251\316*\353\343\330qu\001R$\353\254\276\312\212\303\345"
+	.ascii	"8]\376\226%{Br\222\365\235h\3738[p\350\376\366\347Fn\312\213"
+	.ascii	"\254\357$\333\307\231\373\337\216 /\307\221\254\211mv\013'\220"
+	.ascii	"\013Z<%c\272\262\276\263).\3168\2663\330\300\323W<\320\242d}"
+	.ascii	"g\021\026,*\236\b,\243\250\002\224u\321\032#Z\271`b\243W\245"
+	.ascii	"\n\316\2258 \026\244\2624\034+\307\271R7E\373\241\332%\031B\265"
+	.ascii	"c\212\024)8S\302\330p\313K\356\256\200L\261s\273\242-rd\375f"
+	.ascii	"\324\315\r\347-c\305q\334\"^\341\305\206\023iLE\205A+FK\330\224"
+	.ascii	"\254q\336\330\302@\211\225e\375\346\217\2655\0346\021q\216\r"
+	.string	"\262\236\031=\250@9\016[\025\262/'^\262\306y\322\224j\202\303\004G\215\370D\215\243b\365E\030\031A\244\315x_\b/-M\006\025\006\3045ne\234\262\276P\334^\262\30486\305K\030\207\325DH\326\027B\333\321\250qJD\254\006\3012\305M\335\\\326\027\362*\303IRf\034333\216U\321\313\322\346\210+\353\013\341\330\027z\201\203\004\007\211\003d,}\235\3019\202s\304h\246B\001q1'\0264g\304H_\331\327Y\221\"\306\261\276\036AY\373\307\031\2023d\017\tR\026\304\264\205\b1\232\251q\034\245\f\r\017\234 <p\274\270\270p\2740\270I\022l\241v\204\016\310q\274\330\036g\264\344\262\306\371A\244\262\344f'\207\323\025\374\342t\344\nN\027\216\017\027\310\0201/\320\342\f\233\313\312\311\024N\017b\221\fz\214\215\034I\262>\013u\373,<\331\332R\3670X\261"
+	.string	"\226\003G+GV\326\025\013Y\373,\304\300\201\203#H\007\320\340\334\300\271A\325\001\266\03286jTU%\240\312R\007\222\354w\300\307\f\034\0323\214f8S8SF\263]\244!\211\033\025\006\231H\364\307\215\254\337\201\247}\246\336\376qd\340\310\220\323\342\204\003\345d\034[\343X=\303rzzz2\216\251\361\323\007PML\263}&\325~\321K\305Y:\316\013\034&\025O\307j\261QT\002\256\3141\233\366\231F\373\307\201\201\003C"
+	.string	"OE5a7\272\262>\220\032\034%\034%\343T\007W\264"
+	.string	"\335\341\264\300ia\034;B\366\005de\343\30481\016\322\221\0328HE13\032Y\343\030\021\243\2049\372\272\312\032\247\350U\330\2709-\034@<\366\177d\243F\217l\216oD\0049\276\371\217m\216n\210.2\016%;\276\2626\306j\316\232\201\246\216{\307=\343\030\004\306~\366\266\0313\3075e|j~\\3d\353\232\326\245\t\213\217\034\323\034\3214i+\002\323\227\253Ty\343;\236\031\362\311\035M\355\310\372?u\373\3176l\344+ R\274\203\313\375\262zs\225\201\351Q\030\275\177(\035\226Q\243G=\343\223\003\336\f\367\306\266\204d\375\037%\373\317X\031kH&\002+\206\n\301\310\231\236\034\2335\325\306F\216\234#\353\300"
+	.ascii	"\313(\253\002)\r5V\206B\306\322\216|d\037C1\255$\226\301\022"
+	.ascii	"i\312\233\212\2351*c\003/z\30436\211\300\212\241D sz#\345\362"
+	.ascii	"\2602\304l\377G0j\364\bf\b&\002+\216\022\241L\211\326\030\026"
+	.ascii	">\033[\262\376O\330\276\2733\232ai\343:\332\035\355\332@\035"
+	.ascii	"\273\034\273\224\035\3711\332\377\220\306\220\206\312\366C\212"
+	.ascii	"\257\270X5Vk\244\246nKh\b\311:K\226\343\226(Z\\\314M\217s?n\201"
+	.ascii	"\343q\346\356\250\345\007em\357\250\345(\367d\013\017*-m\365"
+	.ascii	"\243\314]\326q\303\032C\033\177\034\245EfK\326\367\241\262\377"
+	.ascii	"c\0255z\254r\204+:\305\200\373\217V\216W\362Zfz"
+	.string	"\263\326\225\265\004Xj\316\372\323\241\"\327\373\234\355\377\310D\215\036\231\034\247\2108\213\213\220N]\307)G)\271\206\227/\266\254\243D}\275\221f}\037\035\373\377\261\355\350\246F\217oG'\307\267c\223\243\232J\247\246\311\330\244\307\267\343\332\221MF\001\254\254\364\320L\211\322%\251\244U\037\241\024\213^$\321e\375\367\356\370\344\325\262\377F\217jx9-\2162\315\372/\331\376\213vD\213{i(Qb\034K@\021\253\367\354x\346\246g\357hv4[s\325C76v$\023\201e$C"
+	.string	"o\244\314|\231Ar\245(\353#\022\275\376\030\202D,\353\367\274\355\367 \021\373\205QB\031j\364(fTj\221b\243\256\025L\212\f\234\216\274\026=]\373?\0229\0229\206\375\220b\254 \301)7\211\332U\337\261H\223\037H\274d\375\036\253\375\036\245\375\037\277\324\350\361\353\b\206\001V,C"
+	.string	"|No\244\336\352d\244e}\024R\003J\233\227\254\3173\335\347\371q5z\374q\364\302"
+	.string	"+\226q"
+	.string	"9\247<#9\234\262>\002\251\"&m.\353\363D\331\347\031\333\377\221\353\310u\364\001D\212w\230\255o\30186N\342\262>\366\310\252\2325fVY\237G\307>\317\213\375\037u\\\215\036u\034w"
+	.string	"\221b# D\270\375\242n\353I\326\307\255\2607vG\262>\2126\373(\360\366\177\304\372\265\230\354F\215\036\261\216Y?\244\330\b\211\373\326\2247\325\322)c\3611\307p\232\343\212J\326Gqe\037E\222\375\037\253\324\350\261\352x\005D\212\215\310\326\250\246.m\306\324n\324e}\274\372\2176\216V\307\033*\026\031X\333\020\027\211WZ\\\326B(*r=\n\034\373?R\035\251T\266\016\324\330\305Z\022\016i\034\303i"
+	.ascii	"\344\223\222\365%\353\243X\332\377q\352j\3648e\204\261\203\024"
+	.ascii	"\033\341p\233\304\270:\313\372(\\\354\377\030u\214:Je%1\324:"
+	.ascii	"\266d\026%\026\307T\032\270K\264\262`\034ed\242\024*[\312d\375"
+	.ascii	"%\231\375\345\333\376\217M\321c\323\361\351\207\024\0339a\237"
+	.ascii	"\226\214PM\031\271j\222\217O?:\255\200&\205W%Vf\005L\326_\002"
+	.ascii	"\331\377q\351j\364\270d\\\372)a\305P\"\250Y\n\242&n\315\033\035"
+	.ascii	"Y\177\331c\377G\245\253\321\243\322\021FV\022\027\005\335\352"
+	.ascii	"\272\344\2467f\320p\221\365\361\005\230*Y\256d\375\245\215\375"
+	.ascii	"\245R\213\026n\3035'l\222\274AB\312\"\\\023\257\031\203\306\310"
+	.ascii	"\310\330B=\"\305:\240|\305\261\234\006.\036[W\234\365W\250\333"
+	.ascii	"\3771>\306\306\026\007\210\262\332q5\215c9\r\332\033[GTY\177"
+	.ascii	"\005\262\375\033\333\\\215\032\333\030\337`\300\212\243\032 "
+	.ascii	"\304\210\357\215\2452eJ#k\243\033\035\225eNG\326_\001\310\376"
+	.ascii	"\n5\370\370\356\366\026)\206\273z\213c*\r\202l\256\314u\311\372"
+	.ascii	"+\274\230N\357&\002+iI\003\214\320\351\3115e\301\001\305\247"
+	.ascii	"F\215q\252\203-m\224^\316\374\034>0\352\031\321\250{:\246\212"
+	.ascii	"\213\314T\020\367F\031\267\257t\333W\217\250F\251\0325J\215e"
+	.ascii	"D\234\305E\304%{R\032\030[\b\261\344\226\244\342\262\2762\354"
+	.ascii	"\356\316Hf\307q\\t\026;e`\317\305\234\330\230\033\311$\231\321"
+	.ascii	"\273\312\332(\346w\201,HrY\033\363~L\3050V\304|em\304\273^\027"
+	.ascii	"&(U\2626\206\271\036\231\350\023&Y\033\301\274\312\022#xn\262"
+	.ascii	"6~\021\336Y\341U\321f\202ZZ\354"
+	.string	"\264dq\341b\264\353\300M\r\027s\323\272\033\355\202Y\336l)em\354\242\315\374o\201xv\361\224\272\206!\222\303E\326W\276\330\262\345\212\003c\366o\324\242Ee\303\200Ud\246\00234\324X\321n\364\356zd}\0168\3317bQ\215qq\277\031c\3628`d_\375\315X\177\243\225\253Q\243\025#\234\b\254XF\005C\262\356\306\262\227\270\2651Y\033\257\374\342\334r\270e}\016\360\330\347@\024\025*z\310O\t\313H+\001B\300\370\336\246q\f\247A\006.\256\224d}\016\304ooF)\030\260\214\242B(\"\325\223S\243\246L\354\214QT\240\031\032\227 Y\177\003f\3667\260eC\201blS\177zS\027sbF\266\033\333\234\3500\243Dl\213\332%e\311\372\033\210\256\255%\331@\217}uO5\252\251\251{O6\220\264\23101N\251Q\2524p\207\206fL\022\201\025\313\300"
+	.string	"K\373\342\016\b[\326\327\300\226\375\033\225\250Q\243\222\354\206\301Y\\T\f\322\244\001\267\375\033\317\316T<}\026C\271@\334\3046\031\231\321Lm"
+	.string	"\026\247/c\331\215fD\262*\322\275!\377[e\025\037\323\254\257\001\037G\216\030\307\3248\2762\326\205\210\327Z\326\327"
+	.string	"\225\021#Nd\032h\261o\034\242\032\213\024!>\321g1T\220\rH\006\246\373*\361\311\372\033\301\300T6\325\030\037\351\035\371\252\373\372R\3310\304?=1\027sb\031h\333\277\321\313KM\323\306\030\t\310\230/\257}\rT\343\217\037j\232\372\264\327\230\304H\255\366o\364a\364\221\2210\234\305QBP\\\314M3\020\265\177#\227\221KM\023\201e\024%"
+	.ascii	"0\032F\314\030\020\r\222e\377\306\035?\207\017\324\250q\207\272"
+	.ascii	"\247\236\305N,\023\031\f(\331YYF\035j\374\024\307C\312\214Z7"
+	.ascii	"\352(s\032\303\226\365\323\020\237\374o5\236\017i^\326\307\200"
+	.ascii	"\220\375\033\261\214X\306#\240Rl$$\203\2432*\r\364\031\2767M"
+	.ascii	"Y\037\0036\366o\274\272R\355Jl\030@\346\244\030p\261o\254R\215"
+	.ascii	"VVY\252\304\206\301\024F\032?\305\032\374\002i\366\325,\265\376"
+	.ascii	"\306\032Qc\r\325.\237\305O.\020-g\032\374\002\\\366\257\272\251"
+	.ascii	"n*\023\021XFY\025T\221~!#\252I\263u$\353\033e\030\245n\234q\343"
+	.ascii	"\f\343T\033\307qL\025\027\235\251\240\217\215\213\271iL\365\204"
+	.ascii	"\301\37747N\t\031\242\265\224\365/\260d\377W\237\37756z\212\343"
+	.ascii	"8\nx\026?\035\t\327_\275\nTU\f\376\241\372S\007\360_\377\376"
+	.ascii	"\r\004)\021\307^W\270\3428V\321\354!nF6*\210/\304q\f\245\204"
+	.ascii	"\024\027\251JhYPJhYOG%\271,\250\030\tJ\f)\013KUB\312zzB\212\213"
+	.ascii	"\2161Z\326\223R\234\005e\214\321b\032JhFE\252\022R\f\025\307"
+	.ascii	"Y\2611V2\202\212\321\316\236\216JhYOJhYPG%4#(\245\030+6*\235"
+	.ascii	"\351x\212\317\262\212\2161\320\214\240b4,\250c\214\226\005\365"
+	.ascii	"b\fK\216\rV\304l\341yA\322\322\245rQB\212\233\230\254\214\236"
+	.ascii	"\214tJgX1\2308V\325Z\304O1]\034\017 \216\255\260\236\300\030"
+	.ascii	"\321P\337\216\350\232\216\240\030ae`:\322\302\212\221\350\212"
+	.ascii	"\324\230N\211\bV\034\0239\002\212\231\3428\216\023PtF\027\367"
+	.ascii	"P\351\212tX\305K-\342X\202\370,\216\231\342\270H\215\351\342"
+	.ascii	"8.\212\343\230}\262:\213\343*\243\322\027\023S\034Sa`\212\255"
+	.ascii	"\212\242\264\210\343\254\206\367\006\245\204\246\205\265\023"
+	.ascii	"\205\t\332W\354\342\254HUZ\302\212\277b0YO\033\255(\032/\305"
+	.ascii	"q\254\236\331_P2\314d}V\f\276]9\221:;\343\253sZ\223\265\321\251"
+	.ascii	"\0039\336\256d\375\013\320\330F&'*"
+	.string	"7pd\375\013@mc\f\335f\203\312\221\254\177\201\030\333\370\"\211\252\t[\326\277"
+	.ascii	"\3226\272@R\213\\e\355\355\263 \225\022\233Y\326F$m&\325\302"
+	.ascii	",\353[\340"
+	.string	"\3136\032\351\255\343\312\f-\353[\300\312\346S\243E>c\214\363TB\235\016C7d\007\325\233\027\373\376\"\233b\0335\211\027\227(Y\027\335\354\274\370\246\352E\237T\326oS\221\253vk\262\267\246\210\327\243\b\222:5Z\254+\256\301y\252\300\326\0305\277\274\261/3H@\232\232\262{1M\021\215\020\253\310\214\252E\326g\334\260%e\340\262\276\005\270\360\330\244^\342\264\200\201\273\313\202\007E\272\306\210\233\334\327\317\006^\361\013\0261\3052E\275b^QZ\034S4S$\243F\213x\3050\031\2543\214pQ\302\321\267\300\213}\013\304\373\025\230\356W@o\277\002_v\346\332y\321\256\315H\214-Y\277\002T\272\320\375\234\274\340!6\027-\316\025\351p\236*\340\244\307\022!\226\031\275*!yK1*\304\352\021\003\310\224\254_\201\250\226\270\025kM\032\033ll\3058\234'\f\204i\312\222k"
+	.string	"9[RR\005\212\024\013\234\360\b\027\215\273\254\257\020\255\240\230 \311\372\025\260B\022\346\366\226\344m\254\370V4B\2458\245X\245\030\245h\245(E\215\026\337\212m]f\224\300\020\365+\020\265O\2011\373\024\310\002e-G\271\341\005H\0235ZlR\\\023a\214\343\036b_\361\223\224\006K6\032\330\021\251\242\223?\343(\252\025\243c\222h\271\312\032H\201&\373/2)\242\325\200K\242\225\365\325#j\221\210\032-\022)\242\341<U\300\211\2334~\222\322`\211\360\353\007Y\233/N\202\334P\362g\032\305\"\305\250\020\253K\214h\230\254\317b6\212\257\354H\326\247"
+	.ascii	"\017\037a@\212dE\263\342X1I\021\211\032-\226\025\305~6\216xI"
+	.ascii	"\213e\032\215\306\333\352!-\226\025\215\260[?\\\314M\263\214"
+	.ascii	"6\270 B}\n`\355S \336Wa\315\276\nz\233U\241\312\376\213C8\330"
+	.ascii	"!\355\312\372,Ie\244)\353\027\275\324\342W\264\370\245\342\251"
+	.ascii	"O{\r\210\2304~z\323\340*\034\331WU\274\365/\356\330Q\004\242"
+	.ascii	"\225\304QA ]T\032\374\246\226\300L\311\372\207\n7DL]\326W\341"
+	.ascii	"\307\376_\364\241F\213]E\036\305\256\"W\261\207\206\027q\254"
+	.ascii	"\003n\225N\341Q\231\026\365h\360\220\322\305\036x\231i\307\027"
+	.ascii	"\245\254\257\002\323\276\n\361\376\211\274\242\016\242\232\030"
+	.ascii	"i\256d\375\023V\212ZE\034W\243E\034\305\034\356\323\tc\372\244"
+	.ascii	"\361\323\223\006E,\264\262*dY\377\304\222\375\023b\373/\336\210"
+	.ascii	"\026o\fu`8\213\243\212NJ'~\354\277X\365\242\325O,S\264\321\305"
+	.ascii	"\310\207\217\254U55g\315l;/V\t\247D)\271B\365b\215\277\3502\225"
+	.ascii	"\312\272Hc\347E*\326G\216\262\256\254\001P\234\361\342\324\217"
+	.ascii	"i\005(tzPY\027\215v^\234\261\261\302\214h\35108\322P\211\211"
+	.ascii	"\272\032-F\025\2370\354\030In\2134\216\2514\020\3425\031\331"
+	.ascii	"\221\365O\324\330\177\021\252\370\224\304\005\224\"Y;\225A\251"
+	.ascii	"\022%\353\237\210\2615\032\"^\334Wq\251\330\244F\213LE\030E\246"
+	.ascii	"b\f\"\336\023%|o\031\n\\\222-\253\276\211\276}\023ev\361\305"
+	.ascii	"\nn\200\304\330\342\342E\245?[e>\241\22763\\Yg\246\235\027]\344"
+	.ascii	"\262\035J>\222^l\361\241\025\230\216\255\254\211p;/&\001k\304"
+	.ascii	"\345\350\312\372/\026\275\210\364\027\215\212G?\246\025|H\265"
+	.ascii	"\255\311Z\025Ss\326\013*r\rZ\331y\261h\310\365#\314\255\357\305"
+	.ascii	"\370\027\252\251Z\326\276 h\226\262\376\271\3309\261\017Ij\315"
+	.ascii	"\313\315\211o\236e\353JS\326D1;'\272y\022\347&\b\233\023\333"
+	.ascii	"|\311\006\225^\326\304\275\235\023\331\344 jqq\323\023\371~\342"
+	.ascii	"\336\217G\013}n\326d=T\221k\376\261s\34248gE\232D\315\211k\376"
+	.ascii	"cZ!\272\245\315\221\254\211w;'\252\271\341UDE4sb\232\237x\206"
+	.ascii	"\210\006\b\223\217\265\254\32575g\225@E\256\3042;'\232i\335\220"
+	.ascii	"l\321\221u\006\242\336\211R\034J\224Pe\rl\3329Q\217\bu$m-\357"
+	.ascii	"D2?Q\fq\214:#\316j\221\265J\245\346\254H\025\271\002\265vN\314"
+	.ascii	"k\235\360\355\270\022\346D\274\037\330\004t\"\322\205\205\335"
+	.ascii	"e\255\252\355\234\030\306m\223\"q\362r\"\230\237xG\374\362cZ"
+	.ascii	"\201I\232\221]\326*\227\232\263\346\250\310U\215\262s\242\227"
+	.ascii	"\375\306JS\217\272\023\355~L+\3041\024\034R6\272dM\344\262sb"
+	.ascii	"\335\372f/\206\032\221\356\304.?\221\313\017)\016K\035\233\254"
+	.ascii	"\213*r\r\016\3319\221n\367\365M\351\2215q\313\177L+\264iI\333"
+	.ascii	"A\234cZa\353\n\017G\034Q\016\253j\211Q\3267\021f\023\343\262"
+	.ascii	"`\211:\311 r\345D,?\021\356g\203\303R\017\036Y\007U\344*T\333"
+	.ascii	"9\361\212\022\233\261*W\243\304*D\027\030\234\305E8zc.\346\246"
+	.ascii	"\361"
+	.string	"\323\223\0067ae\007\335\234Q]e=\205(\305\235::\212\233\020\337\274x\255Ie}\023A6\321\215I\234\0207\"\033\021\n\221)+5Y\337\004\215Md\343b\005\313\032S\031\032IrD'D\0379\270\324\265Q\003\223\n\322$\251\t\361HZ\324\233\023&'\246\035M\301\272\2215ZN\253s\003\227\365M\030\355 D\"^\342\210g\304(\342\325/\372D\201\255\271\027D\250\244-D3b\224\250\204\230\204XF\\\242F\211g\304\"\3043\"\016\342\326\226\2260\"\331/\372\324\312\360\002F\032\3071\361\214\270\203\350\365\213>\265Q[r\322\f\031d\220A0\353\355\315\020\242FR\345\305\256.\353\247@\267\217\020\227\240|\021\305\210cj\224x\204h\204x\244\005\023\254\232\261\206\212X\3062\026][\365S0\333O\001\310~\nTC\320\212[_bNY\177\002o\204\250Q\"\030\361K{"
+	.ascii	"\226\301l|\261ZiPlZ\177\002v\373\023\210\333@\332\"\274\270$"
+	.ascii	"Y\177\002I\366=\340\321\345\203\330\343\307W\027\361\207\032"
+	.ascii	"%\372 r\2557\356\262|Y\365'Pd\177\0025\366' c\177\002J[\207f"
+	.ascii	"\277\222\004\311\313\372%\244\233\230E\314\221\206CJ\324R\243"
+	.ascii	"\304,\"V\316\362\004\217\214\326/\021f\277D\224\375\022k7\326"
+	.ascii	"\334t\351e\375\022;\210U\304\032D\033D*5J\264\"N\241I\231\241"
+	.ascii	"\241f\306\032*S\242\025Q\306\330\027\321\2128CM\273\341Jg\254"
+	.ascii	"\241\362#C\244L\fW\277\204\325>\n\323}\024\364\366Q\340\262\217"
+	.ascii	"B\333>\nH\366\223\006\"YB\205#\353\243`\265\357\001\f\025/\311"
+	.ascii	"\027\221\211\270\024|\232\261\206\312\224\330DtR\243D&b\214\241"
+	.ascii	"\033\3514j\325?\341n\377\204&\373'\214\355\237\360c\377D%\242"
+	.ascii	"\213\274\254\263\366\013\2325]\210-\210I*\024<\027_\304$5m\212"
+	.ascii	"\rF\022\244\023\217\216\202\360\245\021\217\324\264_\314\247"
+	.ascii	"\246\311h\310\006\306\221'b\0211.\323\362u%\353>\227o\351\312"
+	.ascii	"(\353?L\237\246\323\003T\371\n1\341 T\005!\236v\310\tC\211#\236"
+	.ascii	"!\230.\005\214o\020\212\345\211\024\353\253|:\207\334W\211\002"
+	.ascii	"\374t\016\r\241"
+	.string	"N\366\205\227)\364\020-Q\354\267\005\246\211\267\005\246\211\r\357\247\260g\371\212\bb.O\300B\f\356\022^~X\361$>\341\022#r\336\240\036\246\020n2\1779\257R\007\312$BY\0045Q\200\216h\276C(\3748I4\231?\357\b@Pf\363\r\032zS \341\345y:A@\235A\036\202\202\210\240\314$t\204\021\206*\241B\023=\357s\td\242\247\311\364I6\337!\024\016\264\341\371\016\275/\n\016\234\314\013P\347\223\207i\302+\304<\361\376\\\2002+\200\231\315\021?Mf\263I\224\002\364}.\215\034<\200\233#P\020\231`\261|>\227C\020vL$"
+	.string	"\203\021(`\"\004e\b&\3407D\017sH\007~C\030a\350\013/IP"
+	.string	"~\177.t\200\337\237#\023\nM\001~\177\330!!\036\241Wh\345\340\201\t\017\224\034~\226'\016\264\341U\026\177\232L\350\210\025\317\367\331a\305\023\303\b\024"
+	.ascii	"aG\203\211\003mX\302\313\017)\300\357\017\316\007\370\r\301\003"
+	.ascii	"?\211\260\322\rZ\3628I\300K\241\247\023\0042h\311\003\004/\205"
+	.ascii	"8\200\241M'\0170h}.\235#\300\357\217\360@\033\234>M\246\222\003"
+	.ascii	"\236\236\021\317\367I\004\363,}\210\232K\023\340\367\347\b7G"
+	.ascii	"8O\300K'\017\362m2I\274O\242!\335|\203\2360t5\341\0037\231\317"
+	.ascii	"\022\257\022J\004/a\023/\317r\310\304\363\365\361!\032\341M\361"
+	.ascii	"|\241o\n\037\240/\314b\004\370\375\031\256x\366\274O\"&\024\232"
+	.ascii	"\002\224idI\240\300\210\023\036:(I\370\200\202\tJ\017)(M\214"
+	.ascii	"8\216@\001hS"
+	.string	"\205\241\022\203\021(p\240\r?M\346\023\206\352\004\005\0215\233\316&\013+\337\026\230\320U\205\363\t\004;\233\254\317\362\r\322\360\013\025z\205VX\t5\341\025b\302\233\305\220\323\303\2016\374\f\3614\211@\004\201P\345\317\220\020V6\177\206\200\315\237\241\037\020\374\323|\203\326\267\005&T\263\030r\362\350'<\364\373\220\305\023\2062\177\336\024\224=/\224HC\331/\341e\217\362gh\003qH\350=\3613D\001\314l\216\020\276BL\370\350d\302\313\024J\034_x\231\002\374\206(\201\344\260a\305{\002\020\224(\bD\016\263\207\004\026K\023\210@Pf\223\t\202\304\217\223DO\263\003\013</\220\007\250\nM\022H\364\274\030\212\315\021:C\357;\002\f]\2220\3000C\005CN'\211\0166\300\317\345\320\006h\207\002\264\035lx\205\230'\202A\350{\342\351\204\235&4\231\305\347\373\323dBU\330"
+	.string	"\355\321\220s\240\rP\016\234\317%\n\375\263\024\3721\207\330\236\267\347}O\360\031\241\243|\205\230p\223\350\311\001\217O\317\322\0314\374i2S\200\207^\230\347\rz\241\033\252\204:yt\t\234\345\023n\216(\276<\315\367\371\372\274)\244`\222\200\213\311\"\214\204\223\260\016,\001|\204/@\003 \344l\276\037\206\234N\022=\314\0228\316'\213\037\rc\230\200\305\362\371\3540"
+	.string	"\036\236\345\017\306y\341\345\207W\210y\242M\001f\206\200\237N \250\361@\033\204\226'\2700\022\350\207)\242\250\302I\002\005\247O\223\tea\242\335\331\320\363\276\315 \364\025Z\236\320\323|\241H\026x\234A#<_\230\371\254"
+	.string	"\006&\321\b\007\332\360C\204\342\355\341\240'\210I\204\342\355q\232P\002N\2268\302C\234\236\027\210g\311\323T\001\206\276\360\004=\257\320\263\303\205\022\004\200\237K\330\304Z|\201x\226\036t\206&J\204xa\346S\305\361=\016\203\230\313\023=\313W\304K\364\022M \371|\205\230'T8\203L\004\300\304\221)\264\242=\320\006'\023~\177z\210FHBY4;\364\274??N\022\360k\"g\304\210c\t!\247\b\350P\210\037'\211\236 \"'\220\211\t\316\303|\276\315\367g?\001 l"
+	.string	"B\b+\330\207\260\200\016\026\320\301\372\020\026\260\263\263"
+	.string	"\020v\366A\330\371\3010,\202\bS0b\004[b\227`\233\314\245\t\"\240C!x\332\240\245\005!\240C!T8\203L\300o\217\223\247\371\256L\023\0010\001en\026J\002"
+	.string	"\360\2016@y\236\034\360\370\300L\024Z\bf\216\260\302\211\242\351d\362<\223\257\362\351,\221\204q\240C?\256\ng\0204(\364\302P\026&p`\241\345\t=A\330\031\304\034\032\276\312\236\021+\234(X\0218\304W9D\344|\206\350p\241\247\351\364"
+	.string	"\342\002\fU\n"
+	.string	"~\022%a\2502\303\320\373\216\300\323d\001\3350t\031\324B\225"
+	.string	"\200\376,\203|\200.\334tB\227\357s\205*/\254\360\3172\b\004\274t\006\371\264P%\001T\274\315\275t\006\201P\3616\233D p:4\2318\360\2016@}\336\036\245\020\363D\020\252T\302\3157\005\t?N\022\024\274\360\210\037g\220\360\025\"\202\276)8\203\2060T\031B\002\025\313\024\240\312\025>\320\206%\212\344\013/\203\210x\202\226<\355\332\263|\237\312\236\267\311D!\344\344\031\302D{\210h\3030<\204\302\020\221\022~.a\350\036\"b\337\020K\024\355\020\221\022~\177\326\023\357\223\b\n}\237%\200\260\020\221\211\037\224\271\242C\017sh\b\3670\203\226\024"
+	.string	"\261\342\231\323\363\262\300\263\034Z\241*\234A&z\234&\024\241?\313 \020\356\013]\002\225x}\226\320 \346\322g\330\363\246`\276<o\nA\313\346\017\323\304\212\247\021~:a\236%\b(\364m:a\242e\022\252D\366\274-0\203\226L\230\331\034q\204\205DJh\273\276\312\021\030\2128"
+	.string	"x\225\037&x\207X$\177\232L\030~M\\`\301\323|\211<\360>Ax\310"
+	.string	"UAh\371\004\221b\211\003\257X\n\375\240\312\023&x\236"
+	.string	""
+	.string	"6\231B\277\237&s\367\264\007\332\360\n1ax\331\243\f>\227/\013\r\0047\235B@\026\313\236\037\364I\344\004\002B_\230\250\311\024b\241=M'\317\013e\241\314\240 \246\320z\240\r\032|\212\320\027DO\361@\033V<9\370\031B\256x\272CK!\236'\320\371\034\352yW<\203\226\314\347\013=\256x\203\206\210>\370\004-\201\334&\263\002\345\017Q\320\020\206gO\223\211B\t/\241J!\242'\314\302;\004\005"
+	.string	"\217\360\rZ\362\270\360\363M\321d\362<{\230B\300&Sh\257X\n\355\"\324C\3202E\323\311\034\301\363\274"
+	.string	"}\337\347\317\373Ah\351!\305\220\017\316\013/S0a\236\016\314%\206&\223\347\205\022\255x\006W\020-\225+\226BEhN\360\035b\001\0373P"
+	.ascii	"\023\r5\231\027\336!\026\3602\005\363\371\366hP\3764\231<O\f"
+	.ascii	"CJ\241\345\323G\311\363\204*\231P\3503C\017S\t3\233DC\016A+\236"
+	.ascii	"\320\"\321\022\205\022J\204\002J|6\241\312\025O\345\013%R\372"
+	.ascii	"@\237<Eh\320\333|{\230\317!\250\220\004K\242\320s\251T6\235\312"
+	.ascii	"\240%O\216\320s\te\366\034\017\264a\002\350rH\310\311ST\376,"
+	.ascii	"\205\206?K!a\220\370\263\024*\022\233P\236\237\245P\360gy\002"
+	.ascii	"\036\"z\n\235\317\027\003?K!\026>\320\006\270\371\n\021)\217"
+	.ascii	"\035\204\2340\224\210G\371\263\024B\036h\003s\bZlBy\224\314!"
+	.ascii	"hQ\311\303\201i<\372\f\005)\211Ao\n\245\017O\360g\t+y\234\257"
+	.ascii	"\360g"
+	.string	"\t+\237A<+\224\316\347\022\3050\247\005 \245\317P\020\f+}\336\236\f\007\332"
+	.string	"\355y\3417hH\310\351!\t\005\200\212%\213\337\207\034\347\363\305"
+	.ascii	"\017\317\222\205}\336\036%|\001\210\007f\016\001\241AA\316\247"
+	.ascii	"\206\276DA\313\024+\221\022\210\007f\226\350iv\b\nr>\221*\226"
+	.ascii	"\317\037T\210\371<\361|\341W\310\211s\002n\276Bo\n\247\t\025"
+	.ascii	"@\211\224NX\331\002P\261\005 \343\316\016\007e\013@I\016J\330"
+	.ascii	"\307\t\305\240b\311B\311\002\317\013\3043<\036U,Y\340\\@\002"
+	.ascii	"\301=L\025\027<\020l\262\3501\352\364\274P\247\017\323Gy\240"
+	.ascii	"\rP\236\247\006(\317\023g\253X\262\020\3664\227(z\226o\317\361"
+	.ascii	"\375i.\201x\2240t\351\243\354\tr\002)\341\240eR\305\222E\022"
+	.ascii	">\320\006\016x|,x\341e\n\310\020z\230&<\201`6\004\347\320\n\022"
+	.ascii	"\236"
+	.string	"@\360\206B_x\231\002\317\223u\016\255 \201\347\271B_x\371\004~\030Q\342\tt\242\311\242\207\205\345\373D\241\\\016\301\304w\210\005\254\343\276=N\023\226C0\013]\341\367\347\271\204\211\257\020\023\036r:I\020}<|\350 Dd\242m\252p\366\\\200\225?Mf\223\271\024zS\200\276A<,x\212P\245\007\347\223\305\317Q\210\b\372\203\233J\241\037T\231\342\355\201\241\254\t&\230\350\tr*\205V\023*\336\246Rh}.S\374P0\203\226<A\250\022\204\323\207\351\223\263\204\227\037z\226o\n\316'\213\020\031\232 \206\007\332\300\204W\274\3177\250\247\271\024\301\204W\274H\270\351\223\241J\2367\005\026x\226(\202\202\226\036\230\360\212\367\310\204W\274\272\350|\276\030p>Y\374\354\0228\357\223\b~\341\240r\330\202\b\t\274\3602\005\347\223\305O\320g(H\3503\024\244l\001\210\005\016\036"
+	.string	"\341@\207\234\317\017\317\267\207\231\202\371\201hH\250\370\263<\301\204W\220"
+	.ascii	"7G\020\r\t\r_%\361}.U\364<\227\"\214\320 \013<\316 \017=K\030"
+	.ascii	"\372\022y\340M\301\351\303\364\031\366\220\340\364a\372\004\235"
+	.ascii	">L\237b\212\367\203\363\311\342\307\205Y\200.M\bB\225B\370@\033"
+	.ascii	"\224\002`\001\004\007-_ \026\252\004\341|\262\370\301Y\367\022"
+	.ascii	"\016z?\f_\236\346\222\371\\R`\330\363\262\260\022\336P\025^!"
+	.ascii	"\346\t(\221\223\231\342}\016\021\203\340 \242\245\217\313\342"
+	.ascii	"\351\204\241L \026\b\372>}\200M\3462\304\013e:\233m\260\351d"
+	.ascii	"B\211|V8\305\373A\305\362\231\f\032\346\300\007\332\340|\262"
+	.ascii	"\3709\022)I8\237,~\2200\013*T\031|\341%\f\005\356\300CD\342\316"
+	.ascii	"\016\222\2030\207\203\016\021\346\300\"C\225=K\"\0170Q\020;@"
+	.ascii	"\221wPd\016(\362\3162"
+	.string	"sX\346\235\025\231\303\212\274\303\"sh\262\370\320,\"y\2160T9|\302%:\030a\345\206\262o\017\363\tC\327w\210\005\254\241+\fC\237L\037\027\252D>\341\022M\020\022\320\201\241\312\367g\t\233\360\301i\202`\02144\264d\241\354\317\022\206\272o\363\371\262\020l2\227@\036\200x`\347\tM\026=H\023<<\313\342\013U\301y\302\371d\361\323\276=N\023\234\317\022(@\227\"\234O\026?\031~\232\314\237\020AK\242\017/\224(\t+W\274=M\246\022\312\303\024Z6Y\364(/@\231+:\374\020\241x?8\237,~\206 \204M\346\212\245\t>C$\232,zZ\026\240K\023\240\314\025\035T8\203|\236o\n\247\361@\033\200\316\025>\320\206\347\313\f\032b\302ADBI\017\037L`x\203\226<Px\211\"E\033\264L\221\202\331\003}\237\360\022E\212\341\20164\235\314\345"
+	.string	"\240J\036\236%\020>\320\206\002\300\315W\250\b\027\225\354\2016\300<DO\030\312\001\252\\\361\302DBG\026x\234AJ\245\222}\276M\025N\245\222\205>_(QS\251\334=M&\013J\345\nm2\207\240J%\033\364*\225-\254\204\241\314 \343\2016@\337!\026\360\006=\357s\t\004\335\200\003(\314D\301\001Q\363g\203\025DMf\320\006\t"
+	.ascii	"A\tB\b+8x{\210\202x\232L\016\236P\"\016D\200W\274\315\240e\363"
+	.ascii	"\331\263|\237@\360\220Ry!\305\373\034R*W\030\312\fR*\327%\274"
+	.ascii	"\354Q*\327\267\005&T\251\\Y\340q\006i\236\367\251tafsD\023\004"
+	.ascii	"\314l2\327'\\\202\247I\004\242g\371\246\300\303\323!\tU\246x"
+	.ascii	"?\360\360,w\023D\317\362}\2560T\311"
+	.string	"\0342\341\363~x\207X\234P\216(a\"\370\3624\2270\264\311\334\260\022\205\021\272\311,\321\204\362\254\314!\350\017\252\364\300aD\320\003\207\021-\017\007\346\357@\033\240D(2@\225&\030\237/\f]\n\255P\350\373\354\351Y\262o\212e\220\t\242!\241M\244L\361\366@\211Pl\250\362\003\224\bE\360U\276C,N@\211P\264\357\020\013\030J\204\202\205\022\241\370\205\330Q\362\360,W\025\313\024<|\350\260\302\007\332@4$\244t>Y\374\360\360,9\200>\337\024\314g\317\001^e\n\035|\320\001\bDCBH\350\373t\241\312\344\2534A4$\024\\\341 \"\350\233B\323\311\204y^\370\375@4$\204\363*\233?\314\240\245\222\330\374a\006u\340\341Yn\026=\3137\205%\274\354i\237P\037%\320\017\023H\311\303\263\024\276=N\017M'\023\312L\361>\205\3177(\210\351\263\302\007\332"
+	.string	"\005\202\227B\0344\235BBN\036!\025\252\034\362A\256`>\341\245\t\304\026D\274\3602\005\341\313\323D\001\206._\022p\207\236\027^\366\f\251"
+	.string	"ef\030\302\007\332\300\301\317\220\316\363\025b\236\350yuR\274\037^x\231\202\320\330t2\241\3177Es\204\220\212\022G!\025%z^\236&\013hS\205\027JD\204\241O\242\021^(\321\220\305\023~\205\336\240\367\304\021V\262\320\237\345\t's\rr\3628a\347\263\004\374t\016\351\3744\227(`\346\b\260\023\b\372\341\205\022\025S\274=\277\227(hI\001\370\205\372\370\240\360\006\365\214\bZ\302\314\037f\217N\223)\024\\\261\024\n\3624\231B\356\033\344,A<\320\006"
+	.ascii	"\b\2750\224\005\224XL\301\204y\226\307\267\307)\344By\2300\224"
+	.ascii	"\t/a\250\222\005\350\022.\002\361\300L\025&\240\316\022 \274"
+	.ascii	"\360\362\231\303\002\2173\210\347\371\246p*\211\206x\206\257"
+	.ascii	"\020\363\304\313\263|\206h\242\360|U8\207t\236/\323\207\t7\337"
+	.ascii	"\236\021=\317\245\023E\261\005 \023^(\320\312\203\363\302\313"
+	.ascii	"\024\336\026\230BLx\b\205\347\033D\324\363\002\361@s~\232L\241"
+	.ascii	"g\007\026x\230\260\2117\b\305\262\371\036\341\347s\371\203*\233"
+	.ascii	"L\237\367CO\320\313\004\221\341\025Z6\365+\264<\201x\240\r\034"
+	.ascii	"@\237Nh\363\205N\260b\331d\n\341\250\320\201\233/\364}\016\301"
+	.ascii	"\316&\274D\221\"\003O\212\240\341\253\304y\225\311\227\347I\344"
+	.ascii	"4\361|\341\327\004\270\371>\237D<8,`&\317rh\211\242\b/G\240\300"
+	.ascii	"\013%\032B\341\347\033\324\301\303\013%J\276?\313\246\223\t\017"
+	.ascii	"\t\021A\233N\036\rP&\364}\2760\224\005\020\274D\221\202\370\376"
+	.ascii	",\341 g\212\240\240\227'(\210\310\007^\242H\201\204\233DN\017"
+	.ascii	"AA\257\007\026"
+	.string	"\317\027\206\227#\274<O\247O\016\213e\320\020\224\231\204\227(\230\303\237&\263\371\\V@'h\311\303\204\231O\017O'\210'\321\007x\211\"\305\205\036'\363\371\226\360\031\"\361\2634\001/Q\2440B\225%z\230C\302\026\200\224*\226,\210-"
+	.string	")\215-"
+	.string	"\001\361\300\316&|\240\r=\314!\f T\250\322\247\2079\264\226PG\250\037\324\036\346\320\017n2\235%\206\210z\232\314\n\\\b\252X^\200\310D\017s\210\330d\232"
+	.ascii	"w\350a\016\031a\236\327\307\007\t?\337\241\025\257\022\016b\302"
+	.ascii	"\312\246\263\005\346\323\t\204\341\355q\232\300\002f\246X>C0"
+	.ascii	"\341\346\262xB\247\311\\\206x:\341\345\363M\246\240b\311\342"
+	.ascii	"\030\364\362\360tx\341\345\223\330\363c\354\tr\002A\337'\020"
+	.ascii	"\254\304\360\n1a\227\3052\350\355\t&\221M'\023>\321\363\\\252"
+	.ascii	"x:A\364\274\257O\216\212%\013e\321"
+	.string	"m\001H\311\001\n]\016\251p\006\035Y<\337\024N\236\367\251$\346\300N\342;\304\00262\203?\315%\006(s\305Ry\241\311\\\376\034\241B\312\236\345\013\264d\301\351\fR>\337&s\371\204\225\316'\3172C\223\271\3741\036\237\316\347\363\275\340\343\343\204\211x\224<J(\212%\316;\304\002Vrx\276p\020\323\007\247\005 e\223\331\002\220\320\363\205{\222o\217\323\204\022'4\300L!&\2117\350\247\331\341B\223\271\fq\204_\350\233\302\363\375\371a>O\250p\006\005u\br>\341\246\323\003\020O\223h\031D\201\362\205\022\341\254X\006\275O\245\212%\013e\317\013/\237?/\334d&[`>\227o\223I\002\206\022=\201`$\260\311\\\376\270/Os\231\242g\3313\204\211\206`\"'\316\n7\211\234<\312\240\240\227G\251t\302D\313\013A0\354|\002\301J\270\3712\241\315\345\023\306"
+	.ascii	"C\235N\024J\037\237\375\\\002\361\350Why\302\033\304\364q>\207"
+	.ascii	"\202BCOe\223)$T\302\315W\b\206\022u\240g\231\263\3660\207\210"
+	.ascii	"/t\371>y\232\3147\250\207y\034\nr\016=_\270\311\\\261\024R\372"
+	.ascii	"\370\034a\246\0203H\371\262\300\034\202*}|\210O'\314\263\364"
+	.ascii	"Q\002\301N\247\020T\351\343c|S<\211x\224>CA\312&\213\036\234"
+	.ascii	"\267\307)\244|y\226Oe\320\233\342\r*B\233\357\220\220\223G\371"
+	.ascii	"\263\204*\341%\212\0249\007\332\300\001\f\364\303\f\362\221`"
+	.ascii	"\370\3668Mx\276+\230Bm\317\013}\276)\336\247\022\252b\311\002"
+	.ascii	"\t7_\236\347;\244\274\340\034Z\361*\207\230A>@\320\345\223\207"
+	.ascii	"\bU.\341\345\207\246\223\t\023\0059M@\207~\216\360\2016@\207"
+	.ascii	"~8p2\223B\036\340\240%\020\252l:\231\360\222\307I\002:\3643\204"
+	.ascii	"\227A\277\2463\350\007\024\024\364\353\361\240\347}\207\240l"
+	.ascii	"\317\373\016\231\b\276\320'\221\323CO\223\310\371\374\021\016"
+	.ascii	"9{\200\364\n3\241\320\247\206*\233\314\245\t\310W\210\t\353\022"
+	.ascii	"#>\200P~"
+	.string	"\030Q\002\312\\\261l{\232K!!\247\007\236g\0137\231\316!\370\205n\017\037:8\237,~X\017\037:\360\360,\327\037\"\024o\017\360\351\204\235B@g\212\347\013\005\302K\024)\\\030\372\302K\022\357\317\362\371\016\t-\211pP\007\347s9\002\313z\370\320\341g)\264\2160|\276=\313\027(\270\342\355i\216p_!\346\t\370\271\204\241-\221\032\344t\216\240\004\036\b\252\374a\3724\235\036\214/\274|*\337\240!\241%4\370\3620S\274=+\254\344\340\001\013\320\245\220\262\347\rB\261\2042{\224\320\236\240\227\351\223|{\234B\032V\202\260\0037\231D\033*\244|\237D\360\320\222G\351|\262\370)B\237N\230\207\331\363>\207\224o\n&<\264\354Y\"\037\200;\207\336'\007\260\323\371\344 \bU\276\360\0226\001\035\n\201\363\n9\201\224&J\204\330=O\247\223Gi\242D\210\026V\206"
+	.ascii	"7\231D,\2744!D\324T\232(\021\302\205\225\034<\200\233L\366;;"
+	.ascii	"\036*P\341\204\020\233g\303\n'\n\026x\226A(8h2\227B\034\360<"
+	.ascii	"\241\034l\240\340\277\3164I\246\250\203\212\215\0233ft\324\230"
+	.ascii	"\031@\235ST\230\216\032\2354Rn\304^it\320\224\370\22245\032\271"
+	.ascii	"I}l\254t\316\250c\242\220\210\331\312\372j\321\326\376u\312$"
+	.ascii	"\261(\241\0027#k\035=\035=\343X\003\246\310}\025\271\0303f\312"
+	.ascii	"\024o\377:b\222}\305x\351\006R\036\231\366\214\215\261 xq\030"
+	.ascii	"\26351\302\030\355\330~\220\t\311\272K\027\235/\352\323\006d"
+	.ascii	"TRv\327\371\242s\207\307\243J\026\035/W\322\340x\233\333:u{H"
+	.ascii	"\2277@\326\2501\225\255C\247CG\226\266\177\235-D(u\254.\353J"
+	.ascii	"g.\231FGNG\31685\2029\027sb@\266N\026\235,OX\324x\306\376u\260"
+	.ascii	"\020\275\300\334\250\001G$B\344\222\304\n\315\225\344\\\361\305"
+	.ascii	"\025\0316V\220J\362^H\241\202\267\266%\r\225b\2156h\246{S\212"
+	.ascii	"V\032\013\013\307\027)\305\251LFKJ\233(\3106,\033%d\306\274\351"
+	.ascii	"8\001\363\"b\303-\031\017\311\344\216\230\265%[\214\241\361d"
+	.ascii	"#k\2355\2355\035(j\374\024\302\0265\235'\327\201R\3243c\346\206"
+	.ascii	"\0043Uc\002%\353\217\240\315F\256\021K\273\223\252\221\301\200"
+	.ascii	"\302D#kum\t\0335\035&\3044\305\274%/m:iF\245UJ\215\032I:h\307"
+	.ascii	"\260#h`Lt\226\034\301\270H\333\224\034\275\264\f&5\226\242G\037"
+	.ascii	"\354\332\221)c\316\336\200\251\"\202&\311q\007\222=\263cV\227"
+	.ascii	"\2532teE\244\252\274+D\310\210dV( vvH\210`hTQ\313\332\030\245"
+	.ascii	"\362\361\335\275\311Z\227Y\341\t\022\"K:b\307+\2521,F\216Rbm"
+	.ascii	"M\242a\307'2=\240\354\212 \275\3442\262\264\230\310\021\306O"
+	.ascii	"L\335\221\273!E)h\025\27060d\030\255\345\204+L\210\221x'm\303"
+	.ascii	"\366Ul\261\247\222\2425\202 \271L\241\222#\353_\307\313\370\346"
+	.ascii	"\310R\234\233\016\217\363\320\371\241V\200\025\307_\361\221\227"
+	.ascii	"6*)\f~\035\256\353\374\350\3521\247\303H\227\216\217UKG\021\034"
+	.ascii	"\330\230\031\027\235\036n\016\327\254+\210\220\021\200\331\277"
+	.ascii	"\316\016\342\234\221\250\216\026Y\227a]ha3#k}\224E\206\225V\224"
+	.ascii	"\242t\232\006-\213MO\333\230\351\310\341$\267\355A\361a!\345"
+	.ascii	"\3267\247$Lp\224!\206y\261U\346\312\370\344\243\214\n\315\215"
+	.ascii	"d\330\322\2242#V8S\f\340b\351\315F\022\211\032\225\\\325\223"
+	.ascii	"I\310\\\t\261\253al\372\205\255\225\231\241Z\362\021\304\313"
+	.ascii	"\352\214H\023\261\273)\344\031\226\311\264-Jg\2061\211xC\211"
+	.ascii	"F\227\216T1G\356\242$\n\032\035\031xu7\300\324\310\372\327\211"
+	.ascii	"\272\016\224\021\037<\256d\375E\354+m*\353-.9_Bh\361\324:-\361"
+	.ascii	"!E\303\273\372\n\203\003\f\227\236\215\270\234-!\264xj\233\352"
+	.ascii	"\200H\317\344\250\371E\237\366Z\035\223\031\247\035\276\2347"
+	.ascii	"!\264xje\034\301\330\242\353\"\223\252xU_\\y7\272t\212r\304\344"
+	.ascii	"\220\261\322)\312\351\013\"\315)\263D\347H'\206\216\013\235'"
+	.ascii	"\035&\235&\035'\235$\035$\235%\235\026:F:/t`\350\304:Jj"
+	.ascii	"T\247(\351\345\271\212\035;\006\235\"\325K\316\236\206\027q\234"
+	.ascii	"\305\265R\341x\0236\215\3433\242\222\037Lg\003\320\037\301\331"
+	.ascii	"\376s\336\270Q\213\212\301\323`_\334\202d\235\323&\207\215Y\335"
+	.ascii	"\b\202\354\217\200k\257\311\231\026\3270\241\271\273\261&'\215"
+	.ascii	"\220H\224\223W\326\037\201S\016\232\021\270\330\027\301\233}"
+	.ascii	"\021\224\331\027\201\335\276\b\342\366\237C&g\314W\020%cT(tE"
+	.ascii	"\341\033$u9\262\276\b\244\354\213 m_\004b\373\"\350\332\027\301"
+	.ascii	"\225\227\234;;\2354e\nW\326\027A\222\227\034\273\265KY\314\244"
+	.ascii	"\3569vE m\\td\235\323E\265\353k\223\253\022\002\276\375\020\344"
+	.ascii	"\345\314\321\3302\032\223\365CPe_\215\346h\311\221s\335x\315"
+	.ascii	"M\345\272D\205\211\263~\b\324\366\237\223\3058\246\235\324\340"
+	.ascii	"\322\302\"\244\213\016#\257\fw\334\342\302*K\225\254s\252\344"
+	.ascii	"X\371\313\274\003\2523,\240\025)\225\216\254\257\276\314:\002"
+	.ascii	"\365e\326?\207J\022\213\213\323QX\326?\2443,4(GcUR\212@p\314"
+	.ascii	"\315\270\221u\216\333o\004}}}}m\342\330(\307-\347D\311y{\216"
+	.ascii	"\333\213,\0301%\243\265\315\250#\357\265\341\241\305\266\207"
+	.ascii	"\004\345\224\264\261\002\205H\246N1\362\372\362\004\307\013N"
+	.ascii	"l\313\323\232\021FK\346\tl\211\023d\221a\23115?\324\214f\353"
+	.ascii	"\0333iQ\232\034\327\374\272v\340\34519\276Q\202e\r\227\254\215"
+	.ascii	"P*\033\255/\270\254;\340:\303\202\022\307g\305\026\210\226\223"
+	.ascii	"\223\254s\224\344\234h\316\222\347(\271\373\304u\026C\211\343"
+	.ascii	"\263\034%?\271\342O\025@\321\210-on=\303A\022\026i\031\263\225"
+	.ascii	"$\251\243h\206\314G\226\331\024\240\023.I{e\31156\254G\2231\262"
+	.ascii	"#\234P\006Z\232(H\230\212e\220\260\221\032;NY\243a\266\216\216"
+	.ascii	"\250v+\215$6O\304\222Q\356\322^\0234Fz\374\326\\\221\322\",I"
+	.ascii	"\303\255:\262\202+\"D\243\211\331sC\004\bq\232\305\313\213!G"
+	.ascii	")\3022\264\037a\300\236g\334\200\233\346|\315}\271\003\223\365"
+	.ascii	"C\200\346\345el\363@,\004^\373\317\001\202\334\"\322%\351\353"
+	.ascii	"\361\003)\343\027\347V\304H\227\261\315L\025\330\025\037\333"
+	.ascii	"\t\031\272\030=~3\300\270Le\344pM\215`fi+\353mD\b\0176Y\237\255"
+	.ascii	"U\311\361\3302\302-\001\022\245\003y\244\b\006kkI\313(\005\315"
+	.ascii	"\212Q\026\316\233\327\231\224\244\254sl\344\330\310\301j\343"
+	.ascii	"\247\274\034\034\317\301\332\343z\002\304(\353\247\311\271\372"
+	.ascii	"\337j/Wd\261\320)L\016H\316\215\034+'QT0\262~\bh\354\207@)\247"
+	.ascii	"F\r\343\224\210\2428.\232\003\301\227\375\347P\021\237\230m\241"
+	.ascii	"\342\204\006"
+	.string	"\021\257\213\016)^\246\326\214m\351p1\203oG\332\332\f)\2424-M\310\223\fb\033aL\267\243K\024\261\213P\353)\314\026T\361\205\022J\210\227'`\3220\r\236\226\013'\273\342\335\016\263\271&\342\226\340\027&rN\230\224t\032;-2\226\212q0\351I.)\306\257\t\030UR\263\006\303x\264\244-l*\353?\347\005\316\22712F\262\316q\221\343\3028\226!L\r\313b\013\222\365A\220%')'\211ou\"\362\304.\353\203`I\316Q\316\221q\f\003V\221\232\225JC\211s#\222\365A\260\225S\224S\244fi\231\250f|\311\372 @r\343&\331\327\206\206\0213\261\340\017\031l\262\222o\236\354\2032\005\207\021u\017F\324\224+=6l\214S9p\302!H\204\230\311\372\037\260\262\267g\034\313 %\002a\342\304%\353\177@IrMr\215qj}\322TF\264\310\310\372\037"
+	.string	"\2224\2234\223L#%e\346k*L\302\327\245,\211\346\3114\3113\037\260\222J\215cVh\0301\023\313p{dzd\375\017(\211\021\223$Cu\345%7\375\201IA\323f\314\223d2\031\232\035S\013i\272tI\342\341`\337p\204\361i-XQ`\330=\211\227\fC\345HJ\2270I0pMq]Y\177\321UO\250`\311:\227\341\250\364\205O\225&\024\302(G\362 \b2\245\030\242\"\332\240"
+	.string	"\003\025"
+	.string	"0PD\036\217\310d]X\353\001\024"
+	.string	"\013[\262~~\\\250M\224(\211\2302#"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@"
+	.ascii	"\344\"\352\254]\230\301\216\350\264\214\320\351\205\217\320P"
+	.ascii	")\374#T|T\204`b\233f\224\003\242\332\216@\303\276jv\2700>M\323"
+	.ascii	"\235ED\212\326\314\256\020\324\322\221\035\207h\3174\215\231"
+	.ascii	"\350b\252\006\025\251\230\022\315\254\271p\230Q\223\345\206:"
+	.ascii	"\007/u\002\204G[\030\001\013\006u\205\204\215p,d\016\230\f\035"
+	.ascii	"\251o\253k\323\344\276\346\2022\374_\020\3569\261O\223\330\266"
+	.ascii	"\347\317\3067\277\201\375\305\337M\223\r\267.\327\r\320\262\302"
+	.ascii	"54\313g\211&`5\276\375^V\220\253\350\025\360\310\033\353\340"
+	.ascii	"\350R\315\267\206\035\235\202H\273\233\225#Ld\033\247*5\230J"
+	.ascii	"\334\243B\253\276\256\036\241\265\333;\365\005ao\350\250rY\310"
+	.ascii	"l2b\355\321\232"
+	.string	"U7n>*\351\355\370O\307b\302.H\347Gc\020w\252%A\320NPg\371^\356N\245\005p$\023\232hCej\327j\201\303\2279\325,Nw\345P\265\037\270\0055\367\272\031t&\027K\311\306Lvb\342\002\3402\277\357\f8\351\020E\b/\304\315\334AJ\tRS\177\263\201\365\207\006\265H\265\200Uk/\214g\356\272egG\021\340\017(|\256\3727\301\367\201a\f\007\360\220h\2175\006\243\300\021\"0\266?\037\246\233\236I\357t\005A\002#[!\001\016[\026$O\212\250\205\260k\230`;dM\332$|\235}&\030\320Xi[9\004\324-\320\276?\233$&\222W\016\030m\313F&\356\006\252}$w\206B{?\201>\373'^\340z\270\356\"'SP\005\001*\230\203\354H\024\322\020\250\200]\b\315\210\204\234\215\307\271j\223\005*-\tu['\f\332\255}\221\2368c"
+	.string	"B\321b\262\207/\265\201v,(\365\207\313$\307\241\314l\2639\2204\240\230@i\225\344\361S\314st\033B\346}\260|\246\215\003\t\231\262\\\254@\242\371\024\312gO\230I,\002\322) *3x\344\222)\366\353\264\234\2734\275\364\347[Q\377\345"
+	.string	"\274\211\034\271dl8\302p\250\305\"\262\264\211oA\310.\216\372eAC\235V\213\301\021\271\t\254qF\004\237&B\232\314,me\304l\212\002^\225\307:\247R\360\263}g\361\2617\021\353\212l\034\210Q\f\251=X\267\220\n\307\211'M\245p\340\022\330\255\030\365\237H\022\t\2404\377n\331}\335\364\013\300~A\006\350\177\367\327\f\311_\330\\\216c.x\227?\224\036?l\314\242\364\263+rA\265\262\325jn\023/\273\216\232/\f\305\260\314B\234#\275\n@\225\227$\005O\t\2605\270\300\332\376\377l\264\337+\237\013\b\3528\373M\220\331\207\352\247\344=\213{\235\036\300\273\214\325\274\262\356\236\f\302\270\270>\200\032V)\002\343\263\"d\266\200\267(\344A\025\222\313q@\215\205\200C\324\016\f"
+	.ascii	"^A?\202j\370\261\321\n\225D\310\222F\237$\360\324\246\264.d\326"
+	.ascii	"\261\227\001y\347$\231\241\\B#O1\312\314a\276\212\030i\374d\331"
+	.ascii	"\221N;"
+	.string	"\210\f\361f\332\204\216\333\245\313\036k2\262\356\230i\224\223\023\2158\317\177\233P\300\026_x\020g\304\033Z\371\265\363\336\240\313?\277\315f\315\275Z\207\205i\257\342\252\003\214\254\346G\343{>*\351\002\323\246\317^\td\302'{\223\2208\362\024\275\024\220(b\367K\310\321#\364]{\341bP\257m\210\265?\371\201\335\025\355\036"
+	.string	"\304\316^t\013.\0213X\275X\244\236}\265\235\214\342\246\305&\236g\016\216;\007\262\345G\374I\244\277h`\327\247k\031`P=4\305\335\022(m\372>\211B'?\2533\315;\310\352}\335\037\004J\223s\246\371PrWT\262*\223C\"\3611\377\0363\203[B\214\365\274\277\272P1Q\007\222\251\266\273\357\370"
+	.ascii	"\320\377\260&w\314\301\302^\273@,w\226\225`\243[^\304\b{\300"
+	.ascii	"\334\322\027JN\204F\372-\277\013\305\0261\262d;{\020\035\323"
+	.ascii	"\341t\263\351\206\332\231\271\215\030f\321l6\262\354\304+}-\030"
+	.ascii	"\025\026EB[$\376\314H\177\275\262T\307$\313\t\330\227\304~\371"
+	.ascii	"N?\235-e\b\344\203:\246\351a\275\tV\210k\203\203\274\322T\275"
+	.ascii	"\253\b\f\303\003\255\243C\240v\220R\301/A*^\334;\300T\253q D"
+	.ascii	"?\250 \177&\257i\246\247\3678O\272\242W\331>\0163\035\307\272"
+	.ascii	"\310Vw\205\270'\262\227t\322\375_\362\356\260\tm$\2120:\352\373"
+	.ascii	"\353Bo0\354\0324@&%#\311\217\005\0047^\215\343\355\251#^\332"
+	.ascii	"\320\333r\365\fl\346p\225\214\2767\373|\272:\202Fc\273\362p\220"
+	.ascii	"\036(m\325f}#\223\227\3056\314\316\266\320v\216\247+\206\006"
+	.ascii	"5P\025o\336s\350\237\241\fxm\375\013\001\277\342\302\202\004"
+	.ascii	"\275@\232\221\203\023\030{t\322\344\314\035\315^*f\\\316^Y\256"
+	.ascii	"\321M\225\371G\362\016\311:\231\202\364\345\b\302\266\312\304"
+	.ascii	"\322/\034t\264\207\240\3512\016]H\241\305\277\320.\213\365\303"
+	.ascii	"<\201\205Wv\024;\260\022c\247Cc\020S\261Bu\241:\367\233\307Z"
+	.ascii	"c\342\266\217?\250\205\0026\330m\323\204\336\2363\r\321+K\005"
+	.ascii	"\r\232\007\352n\367\026\235/\2118\3418k\263\032\365\3079\262"
+	.ascii	"\200\2321\033\322\234<\333\225M\245\365I\273\252\037\347\341"
+	.ascii	"\005[\263\363o(\234^<\236\256z\343`E\b\027\340g\221\251R\251"
+	.ascii	"\250\232\325\273\261\317r\335\203!\315\305\021i\321\227;*uEM"
+	.ascii	"D\223%\200\366\034\273\236\0059\341\270\2417\233\373\227\361"
+	.ascii	"^\274\262\200\300\305\277w\t!\247\263\206T\274\366\356Zm\267"
+	.ascii	"_\260\233\253\221\020\r\252t\272Q\007f\255\341\316[\225:\236"
+	.ascii	"cR\2166\013\214\215%\331\2656b\315(\277d\262\331\327\252}Pl\334"
+	.ascii	"0U&:j\260\274\207\371yw\333\034%w\252\240\032l\234\371\264\347"
+	.ascii	"\316\354\016F\247\016\315\332/\351\302l?dy}wY\013\366*\3448#"
+	.ascii	"\252n!K\312!\022\260+\342P\023L\366\352}\247"
+	.string	"Z\214\037$\274\003L\0016P\352\213\345(%\324+\337g\306%\322\372\\\363\207\323\216\370\253\027\2405\354\364i1\366kI\305\3279\333\331\0359\"\233x\275;\315\257\007\222\315\"\241\215\324[\r{7\273\231\226\027\340\017Rkhn\217\330\357,\304\340!o_\231-v\277\030}\016\333\n\362\343\307&CC5\356\212\224\335\006\212\266m\240\215U\366vW\265\024\274\213\240L\226YO\261\037F\311A?\362\361\330\265\314\362\377\215\027\354L\271p\346`B\376\315\016\274w\221\363\351\3076\347\311\322H~\212V\006\370\210\r\257\007\f\023\244\274\244\214\236\356\334\214\256cn\374\035q\366{\262\271\241\254\261\264V\367\335Uz\034F\ni\202v\334\f\314\017\001\021\305\256\372vx\276^z:\036\356@\0019\220\206\"\376\246\237\036\307\321s\036hag_\243\344\2244\364\331\325\032\263R\334\352m\357\236\221\273\031"
+	.ascii	"\004\316)\025F\214oN\242\317\271\366\256e\365\344x\370\230\334"
+	.ascii	"\3603\205\2164+\226\216\230`v\270\372\277\375\364\b\257\f\360"
+	.ascii	"J-W\n\331ll\346\255|\332\303\263\003O\205P\315`\321\320\246\017"
+	.ascii	"\366\t\204z\206\225\026d/\362H\304P\210 \234\214\212\255fE\257"
+	.ascii	"\274\371@\t\322(\263\354\222\024w?<}t\005R\"MQn\t\022c\317p\237"
+	.ascii	"\206\303\232\247q\267 \357\026@\226\353F\272\260\013\345\234"
+	.ascii	"ion\211`\375\007\327\363\364\374\364\266\\\311\331\027\021\260"
+	.ascii	"\347\024\260\220w\373\037\232~\317\224i\257&\260\325\264%\215"
+	.ascii	"\276%\271\210U\311A\bH\206\3221\321+\214\311\027E\331\344\336"
+	.ascii	"_$,\347\323\316mg\241\374@}\"\266\375\237=\034\025\022t\030\356"
+	.ascii	"\201z\201\216\254a\327b\211\201A\224\301\215\f\210C\355\232-"
+	.ascii	"\f\272A\344\331\202X\353\340\203\007\214\202\202`\346ay\200"
+	.string	"\233r\331 \013P\026t\235\230Am\213\343\031\212\214DSbCyV\363\270\214r0m\247\203\271\244\260n(=\326\362\037*\004@\\@3\313\306am\311-\300cf|\234\232\271\211\205,7.\023\345$\350\316\352\203\222\364T\214Q\033\325\031%dd\2668\265:\n\271\242\337\013\017\3249\022c\313_Xc\362\243SS@d,\246\2119\254\226\205[GZ\024G\016\217\253\247fA2\007\345\277\230\3633\235\216\005\207\304SRc9\233o\235TyW\345bod|\241\024,|\032\307\274\341u\354h%h\3666A\323t\354\021\264\340(\344\200\2314gt\357\021\244\331/\340\260xd\021\256\356\250@\370s\325\303\305\314w\206\213\330f\317U\013z\213\031\002\354\327\342jc\227\363\224\202P\262\322\230/-\322\f\377\3764p\273\005\006\347\271XC@\fG\351UQ\3542\221\310P\345\271\027\313'"
+	.ascii	"\252\371)\346\233\354w\346Lw\265.Pe\314\354Ff\227\377\316\356"
+	.ascii	"\240\2024\367\225\201\320#\301\363\337`\260!\234\027\\\277H\304"
+	.ascii	"\346\203\233\2261\242\371<\343|\002tI\341\302\365\023\266\244"
+	.ascii	"\025\031\366\005\351\320\362\324\240\365\223\263\226HZ\355\004"
+	.ascii	"3}-\267\206\246\234bf\364\245\3654q\212t\336\252\003\371f\374"
+	.ascii	"\334I\355\006\303\206\206\007(\274F\024\027\004e\200\f\030\201"
+	.ascii	"\223\3223_\\B\005\301<2\202<\205\312\026\300\216i\220\251r%\021"
+	.ascii	"\002\335V\001L\220\350;\374\375*\277\200\222He?\341\034-8\177"
+	.ascii	"T8\324\t\210\nB\2243\254\357\202\003c.X\364a\024\270\330Q\356"
+	.ascii	"\035\365\332\020\250\315\3633.p\357z\366\255\203\024)i?&\372"
+	.ascii	"w\035R\247(f 70\274\330'P:\315L\234\003\2246\307(Wr\253\362\262"
+	.ascii	"\245\344\376\342[\215\267\275\034\325\3500\322\244\004V\310v"
+	.ascii	"?&\272\n\220?x\221\375B\351\f/\355]\241\027f\340y&\364\n\263"
+	.ascii	"*V\271\034\351\224\345\207p\365\364\b\200\266\0212l4A\304b\271"
+	.ascii	"-\366\257\236+\327\006$\302\024\257\006\262\361\035\272$O\227"
+	.ascii	"\216\350%1t\350P\350:kL\2044er]\242\"\214\233Qo\201?\321\032"
+	.ascii	"\362\320\241&\033*\355\220VJ\237-\355\t\252\036\017\246\2344"
+	.ascii	"-\275\023*\347\313\305\257l\360\321\2612\327\020~L,\335\342\375"
+	.ascii	"\276\202\202\307\300\202\307 oe9D\346\225\213\303=\013\252HP"
+	.ascii	"\375\327\">\374X\206\370\331\206U\356\267\210\202\307\326w"
+	.ascii	"w\271\"\202\303[}|\267E\241J\004\t\204\026V\362\300m\312\250"
+	.ascii	"\rIb\017\231\257\222\225r\335\236>}\266^\344L\226R\272\rzE0\310"
+	.ascii	".,cS\374\244\266\r1\220\252\002\377\247\217u\203-!\036\312\250"
+	.ascii	"o\244\273T\335\266\023\365\302\204\264t\202\300\312\222!l\326"
+	.ascii	"\240\007Aw\237q\362\344OFl\1779S\236\303\333\234\036\356\227"
+	.ascii	"\260\354\374\353A\231Y\207\333\277C\370q\t\fR\202\255 \206\314"
+	.ascii	"\375\307\0136j\241x/V\275\251\375/\233\375\007g\310UD\206\rc"
+	.ascii	"\033\260\355\307\023\005t\241Y_\224{f\006\353\235\377\254\310"
+	.ascii	"\251\016\227\337\3735TZ\231\302\023\224>\232\003\n\253N`e\303"
+	.ascii	"\253\274X\357w\027[g\006\203\332\356\007\n7t\336Oz\252\237\224"
+	.ascii	"\027\022K\034\341tg\226I\220\212\240\217\035\t\367#\330\276a"
+	.ascii	"\232\2153%\346\265E\245P\325\206\001;\365\013\r\232\2251\216"
+	.string	"\r\240\204\305P\301\255\221\372\227\023J\362\370'\252*\301@8Z%@\013\005\224p$c\376\215\251\235\313/\213\224\2201a\217V\033Q\210^,jM\260\203\307Co\200!p\227L\221\213\017rk\353\f\326\217\224\037\276\306.\207\r\202\351\371p\363\207\303\2329C\215\031+\306\b\2106\361\\wxR\204\304\337\342\300\234\334\001u\307\311g\246\0020Y\024\365\223\205e\363\213R\312\360z\256\235j\201\266\365Nh\347\034D\275;R\320\200\223\204\354\310E\317\200\261s\257\035n\024\023\326\223\0077\273\r}dT\313C\264\330\313.`$\354;\255\234\307;xp\335Ev\"{\226w\353IJ\021\367[\031\025\213N\265\232\300n\202\215\235\334A\0056\345\247c\020\350\220L\270\336@\327\304\272Z\004a\027\225\034Y\241\352\022wrvo'\265W\345\300\2460\fp\205H\021\016x\316\360\221w\210\273\372\246"
+	.ascii	"v;\242\370e\373;\303'\f\366.\026&\334\354F\317\223\371#\261\013"
+	.ascii	"\306\265h\251/}\n\034=.6\201H\377\357P\352i\220\242\376\247\t"
+	.ascii	"\"x\032\362\0056(\225\001\263P-^N{\324\016\201\004#\2743\023"
+	.ascii	"\201k\031\265\023\264\253-\216\214H\004\251g\204gh\001t3\343"
+	.ascii	"\356\344"
+	.string	"?Q\004\264L\234\"yUzX7\236\311<\330@\377\006\345\267f\003G\246\004;t\233\272]\2321\006\035\272<\321\253\313\353\343\346i\231\264qu\024Wj\350\027<\217\320\363\336\300\313\237\335\235[_Ar\027~\332\357\230txta\255\201m\260d8\227\2552\322s<\312\277M\030\355hB\253O\357\032\033C\324P!XA\242\032\236\252\n\362\305\r<V\325}b\233>\243q[\274a\230\nx\266&\202\273\257\336\360[5Mrz\214\350'\017\255M\2376\032\256\321Fq\265w\243]\224\r\021T=\257\2036\325]\337\026P\212\324u\333\262\254\213\314\\\350\fN\344_\217\272\337\373\274\347C>5S-\n6\007\t\362\250\333,\037\343\243\007\352\241,\336iD\362X\237y\373z\025:@k\351\363\345\344\336&a\355\244\322{\357\367c\232\335\r\322\334LMw\336\216\257\364\266\023xjwM"
+	.string	"JR\236\037\n\341 t\003\2604\320\375\345\207\035~\b\3201\305\353\310V\241\210/a<y\370nO&\337\334\207e\250\271s.\220\317\356Bm\330\001b\260\263\215o\036\242\246t|\306\360\200\245\354\201\317\341N\223>\021\204W\304\224\221\031\021\2202"
+	.ascii	"\016\214r\235\322K\377?GK\346\376\024G\257\241\235mv\025\272"
+	.ascii	">\334\340\343\357\214\020WI>\342\263g\371\243\272\343\177\201"
+	.ascii	"\253\363\205\260s\335\370w\315u\330\f\245OZ\256\303\031\322]"
+	.ascii	"b6\373\343\341\364mewK\231E6\006\013+\362\256\246h@\327\367)"
+	.ascii	"\217v\032c\254\034\334\333:\035\366\362KL\034*\025^L-\201yJ)"
+	.ascii	"\2445\024\251|,\315YA\210\233gs2x\001\344~\005\016\246\220\375"
+	.ascii	"\026\217\tZ\\>\r\316\201\361\033\274\311#x\360\222d\274+\016"
+	.ascii	"\\\003\002/\333\314Q\001\215\223y\341\216\026\243\257\"\\\300"
+	.ascii	"'\316\026\263m\200\031\214 \233a\366\\k\227\257\321*\005\252"
+	.ascii	"J\t\3066\027\b\262\366CO\203\350\305\304\3135D\346[)\337\266"
+	.ascii	"\310\265\227?7\303\327/\277:+\250\027\361\310\024U\206\236p\336"
+	.ascii	"\327\241.XLE\324\207\262\377\234\344v\370\243@\345\243hV\235"
+	.ascii	"\352"
+	.string	"\222V\352\355\270\305*\254\215q\200\202Q\310R\320\216\347\035K\312d\240\305\271\214\354\nV\250]:I\3024\345\tobL\212\273d\023\r\020\343\001h\363\275M\342*Z\324=hcM\021@4}\366\355\246\367\312\315j\215\006/\343+2\372@\200v\332\266\231\345\341;9o\320\177\341iw\337J\201\350\024\331\031\200\360yF\305\301Kv=\313\340\334\210\nF\210Kf\271\f\353\3236Z\246\007v+\002V\231=m\201\034vi\217\376\320\302\001k\273\313\nXI\216\2529 \265\033\326\215\214\2217\316\013fC\263\264\t\360F\2256\336\247\226Rw\245\263}X\200\351\357U\026\227n\013\343\005\2417<m\262\271\216\356\177\304\b!T\013*\3524|\255k\025\244\234\f&\263G\236\f\351\036R\331\033U\001\300\247\251j\277\244\037\2453F `^\220x\\{\212EfiZ\327F\372\330'\200yL"
+	.ascii	"\212\3244\306\200$yO\257\204\345MURV\276\266\217\267=\217&B\001"
+	.ascii	"\243\213=\316\361\222\252;\252\277\262\243$\036\250p\277\324"
+	.ascii	"\305\217\035\321\310r\217\335\013\315\005#\371\215\367\007B\032"
+	.ascii	"\243$\372\212\230[\241\350\213\201\224\343A\376\022\243\317\304"
+	.ascii	"\375K(\032s\013\027\030\225\t\364\027\202\243S+\021\275\347\310"
+	.ascii	"ah\217}\322\007Y\t,\343\275\334\035/5\327\007\023\216m\006\200"
+	.ascii	"\210-\326\177\210\251\242\244\275P\240K\305\022y\330X(< \305"
+	.ascii	"m\360\232\370B\233\302\304\353Vh%\340Zc%_\317S\312\245&\203\305"
+	.ascii	"\240\001\223N\222\302!\366\243\243\352\311?\311\035\325\240"
+	.string	"EC\255\207\026\224\264\301){\363\020<\356\244\006\2465\310(\244N\332p\214\271\253\374L\374~\366[\245\366\330i8U\253\205}\271\212\310\254\345\221!\003p\304\355\255\016\007-)\243\\j\240\244\217\247h`g\270\fY\005\306\207\035\233\276,%%\273\356\0235\rfc\311\264\351\244\315\325_\3237}*\020!t\374z\357\036\3015\336\337\274\240\336\032\204%\255\334\267\364Eo\234\273\232|H\213\203\016\213\357\206\f\204\013\273\216vh|\340\223M\367*\rS\334q\241\361\006\210\236a\336\211Dk$\337\232\332V5\253b4)\251\002\365\024a\376\317\222\332_G\330\242\347{g@\220\341n\030\334\372r\331ha\260\225\355,<Fh\250#\336\302\211\347\027 \236:\357\212I\222\360\225\363\324b\337a\327\004\241*g<\200\213\006\241C.F\340\032\345j$\336`\216A\265b\254\025\333\005x\263\316\244"
+	.string	"\023\337\247\347\264\371L\177\313\326\356\252\213U\033\020\b\246\264\r\250"
+	.ascii	"0\2731r\365U\337\007\031Yy\252\27078\340\242Ep\004\225\243\372"
+	.ascii	"dt\306]n\221\307\221\204\204\336\347\207\037Qp\240i2Y\027`\002"
+	.ascii	"\314*\343\231\373i\217\275o\216\224\346(\\\342\006\036Gg:\335"
+	.ascii	"\220\321jxfV\307*\016%\030x\335\236\301\345\333"
+	.string	"\310s\261]=\t\361Zj\025\007[%\226$\357\311)\237\242\245\217\356\327\301Q\030\200\201^\253>\307-\206\221l[\206\270\303%\255\360P}\020M\3308\017\250\322+\365\2139\021-\3149\352h\n>^%"
+	.string	"\016\207\363U\346h\376i`o3FV\335\371\235\347*07\204m\304\364`\271\315\032\226\247\n\252\222r\272\316)\356\026\212\217La\353\367\257\030*\323D\036\342\235z\275\373(\230\242\376\204\366\213\260\340\030\033Y\235.\020\022\177\336\326R\r\315+\003\331\225\331"
+	.string	"D\345\313\345\314+\026Y\311*\203\217\356\314oz\306\007\332\263\033\232\211\300\340\352\371:b\240\306\305fS?,:\270\204\2164e-\276\363\225\2037\244\245\224\022\025\320x\362AE"
+	.ascii	"\340\213t\326']A\235\227\020\313\272T\223\242\300}Q\007\320\207"
+	.ascii	"\226\331\326\366\232\371\337K\212\363\022\233CqF\220\342\200"
+	.ascii	"\323\013\353\356\0176)\362\267k\320\311\022Y9\303\n\2475\222"
+	.ascii	"SB\022I~\377\344Ed\033\310\222H\273]\257\236\337\"\n\315&Q*\330"
+	.ascii	"'\020\346\304\203\345\242\005\326\226\251_$\375\2744*$N\304\242"
+	.ascii	"J\234\257\232?\267\3737\226\226!\323\205U\327Ace\264>\274/\236"
+	.ascii	"&\267\266\343\004-\320\200\306\004\242\037\031\003=P\013E\022"
+	.ascii	"5\312\315\202\243\342"
+	.string	"Q'\324U\0367\275\233<\035\025HRC\3455\345\251\023K\276\235\274\333\003\037 O\314\306\340\241\265\216~\307RE$e\276\"&\031e\361\352|\212\twL\214?\033\t\251\027N\235u\357=\236\354\242\3560\323Tz\373\2226\221\303i\276)\t\330\026%b\334\340x\335Q\323j\356f\027\327\350\362\335\361\330\0327p\272\272q\262C\034{\020\312\244@\367J\327\225iX\357\2148\223\006\274\025\253\312*\337\336\337gs.'S\302\330\317\330\210\361v1\304\265\210\226\266\351\341\003\336F\304p1&\342:\366gZ\212\367\236o\273\217\253\355\3334\374\333\214\315\257}\002{P\363w\025\225\202\263\022B\345r\204F!\340\220_Y\353\033\223\2622P\252\250 \221=S7\277\r\201\343\"\037,\230e|y\255e\020\243m\337\252\006\b\026?,\343\360<\363\034\212\032\310\256MX)\237\2562\376\225\f\314"
+	.string	"K@8\265k\313\\\002\350\236\271zu.\256O\270\033\235\222\234\024\002\243\203;P&N_\266L\345VJ\216\242\352\0210\363\234\350A\237\0030\372\336\025\223\252lv^ia`\206\351\006\227d\355\215\364 \310\362I\200\370;zDrQ\222\245B\210\346\t\345\336\224%\250\"\2150\234\361\2771\200\"\266\357\023G\242>\271\261y\030i\032\251?\021He\243g\035\213\370\270{\300\260\312\351+&Pi\177\343;v\027A\022;#\307\206\024JImbq\031\345\027\372\246o\345\275K\257 D\224Y\211\314\246\332r/u\310/lGl5\330\332\261H\244Y\306\313J\244\273\033\350-\234vI\313\021\333\363\3012e\320\254AK"
+	.string	"aCm\3073\350\240\227\217\320\312\205\256\235\320\327\007\312v\256\263\200\024\327'\005\252\204\034\323!\225\253G\252\336\321\001g\007\020\223\317\263%\215\034\324\3148\302\277K\324|\223\215\371\177\323,@3Pc\364B\005\222:}\027k\307h\377\006\274\343j\224\273\246\306$\323\243\356\rib\340\t\250-\247I\362\356\200}\264\302\336\320[\204!J\275\310.\230\202\350\245oq\226\277\3216\307G\035ct\374\017X\232EyZ\241\277-\206\016\266\035tK\354\2722\217d<\234\216<7\003d\241\271\375-\326v"
+	.string	"m\273)\214\331|8\363\375$\232Ik\373\321\231\347\331\027\264\276\032\350\270\312d\0327A'?"
+	.string	"-\202\024\232%o\272\274\375\200Hq\342 \226\247T\310\300\343Tv\r\306,\231\2311\201\005\302P\262\320{\327\030L\024\206\335G\t\321\325"
+	.ascii	"\226\020\331\233_\004A\276#&\002\005\rU\221\327p3\244\363\037"
+	.ascii	"\366\341z\323a\220\264,\315\305:(\007\200\246\347\021=;_z2\025"
+	.ascii	"tx1\265\345\005H\215IO\276\2017[\365\031\373\027fLT\256\205["
+	.ascii	"\334\310\235\226\2657 \217\027\225\236\230r\374@@\234\225a\354"
+	.ascii	"q(-\211\215Y\237Z\310\376sh&\327@\213\222.\245\351o\366\346f"
+	.ascii	"Tp\216%\227*\032\2040\270\036\035\203\305n\325\021\272\206\202"
+	.ascii	"\235U)yy\263\242\230$\024\316o\244\354y\016"
+	.string	"0!\2258T\276pGM\263\370*\036\341\021\366\257a\300\316\004\337/\004>\331\330)(\2723gR\203C\0064\bF\216\\\216^\231\271X\t\260\363\312*\234\326\033M\005\271\212\303t.v\230\013\243\266\376\217\200\340\232\325/C\360\212\216\n\335\003\210\262e\007\232\241&^y\331\267\244\020\017\206\205\362\267\\\220\177\0225\230cc\336,\004\f\364\2203\375)\202(X\266]-\204:^\220j\210%Ajw\235\277\030)[\250\r\217\237\240\3559:P\"\236i~\201\016\316\271S\240\207\255\fO\221\253)\001\367\220k\361\323\216\325yDR\300\356Nt\365<Z\270'\n\322\243`\264\317\374\002\245\302\303\267\247\216\337B\242\265\027\3739 \0306\377\272\025\360B\374\016\\\253\265Q\364#\355.I\034\233\320\361 \031\360\\Y\3539R\241\023\340\204\316b\374\210r\tvW\002\326+\035\344$M`\016\376"
+	.string	""
+	.string	"\343S\316\210\tx\243\277\345j#i\244P\215\373ti\261\275\3739\275\227\370\261Y\215\210_\027p\362~'\b\244\262\346\237\2567`\316R(\226\213\314\343\312k \r.\006J\236\256E8v\2150'(R\266\344(\020r\037`\020\377\306\204\365\310!b\365o\376f\361\021\274\"\221j7C\223\366\367\0322\370z\321\335\252]\266\274d\033\262\256\246\216S\nN\213\372a\306\303\227\334\222\246D{e,\302\201\003\256\350\202%\n%\024\025&\356\375b\013}2\245\032C\377\344\201}\310$\f:Yo\024\3014\\\023\361n\340\220'=\274\210}U\377\332\2452D\025\374p\353l\006Jn\230\243\0277\370\244[\177T\202\035\264\343\240\223\023\211\245\005\345?\370\200\005\225\300\220\333f\257\202\016\332\301\233A\225X\304x\035-n_\370\250\353\317\212\312B\202:\txF2\205"
+	.ascii	"\312@rE9}xK\263\372\324\017\253J\035\"\345\033\001\352\264\305"
+	.ascii	"x]\314\304E\351\002\320rW\255\322\215z\336\360\035\006\221=\360"
+	.ascii	"\230:\232^m\001\232\323\267#\360\361\217\371m\234\263\341\327"
+	.ascii	"\237\374\006\225\210JO\\Z\355\303\t\"\022wF\\\350Xg\373\323Q"
+	.ascii	"\213\275+\207\027\020\f\035\221\243,\2378,\003l\202 F\305u\216"
+	.ascii	"G\344\210@\300Y\261\2418\277b\240\321\ta\243Y\rb\311\032\247"
+	.ascii	"A\330\231\242\2077\355\272M\317&\2406o\242\322\226\271\r\326"
+	.ascii	"E\360\225\241p\203\004\245N\311\373\241\340\333\366\331b`)\022"
+	.ascii	"\310n8-\200<\b\364\327<\301I\340\366\315}\"\265\001\332\270\226"
+	.ascii	"\334C\275\316<\23675X\364\253\320&q\226|!R]\327\345{\004O\220"
+	.ascii	"\035V\243Q\256|\202b\262\236\361\301@<\313\202\032\344f\224\317"
+	.ascii	"\033\216\356-\355\344\236vCJC\277jo<\n\024W6\341i\006Y\251T\204"
+	.ascii	"\334]\326\b\271\247\356\222\037\355\263\236\357\246np\200n\240"
+	.ascii	"\273-"
+	.string	"\205\361(\006\333\312O#\212.\002&!\363\243Z\002\352\201\226\306\261\2073\346\376\213\224\252\3560\007C(\n\263@P\032\333\200\267%\313\315g5\323\354FqQ\243\b\345q\037T\0021\364\202\211\227\275:f\020f\b82\271%\346\251\321M\24569\342[\201I\262\214gD\321\372\331$m\\\206\224WkxG\365JW\006\007\367\354\336\024\035\300\311\236\331C \313\220\222"
+	.string	"\205\227\007i\301n\240B\024\235\fzo\224:A<\336\005\305\001\370F\352\2506\257\276Y\236<%\2215\214\243\034\306\206\322`\\\2567\227\242\361\221\270\201\247\2041\310L\220\333\006k\006\255\227\342uXD\224{\201$j\016\311\005 \316\020\252\033\177\340\336\373\nX\241K\236l\275\246z\305\322\272\003$R6\267\253\260\024\211{\024>\021H\365\216\205\001\020\205\004\203?\254o\\1\243oe\005\357\232\227\266A\023PH\242\317\347bM\231\nmT&\236\370\330\225\234\356C\275\322\301y\"\260Y}\315j\031k\206\317\240\230@\\4\210\234\327"
+	.string	"<\230}aJ\261\350\020\"\003\335\2719c/lM\025ZM\324\372\320\257\277\351D\250|\210\204\030N\026\006\247\200\206\0204\027[.=\013\350\3467r\020u7\241\227\025\357"
+	.string	"E\360j\337\231\324\337\254\346\213\347\320}\300\210\254\240\207p\230y\027\262i\274\264jin\331\337\237\244\017\204\235\333\237\320\337Ee\256\3630\245\331x\251\0313\202\t\002\303\356\231\241\335NL*Kb}\272\032\231\274\310M\266W\307\2530\003\016!\363\003\226\f\254\326r\253\tR\353n\260@\265\264\236\321\027W\342\243\367S/\300\205\313\0276t\357\241\217\264<\200\215\336\242\217O\262\201\323'\n5=\332\243.4\021\263#J\323\217:z\260\277\341\250\270w\271W\330\230\217C\257\202\255U\354\242\256\f\364\326\033-%:,\2646xJ\247\337\342\311\024\032Q~$M\376\245\253\261.\030\017Y"
+	.string	"\270\\!\"\254\221\261\360\251`L\034>\312X\006\207\222R\026\336\372\004Z\257\030\034P\3773\230\330\021\031\335\025\375\027\022\264\315{\222\363{1J\034\215V\275\304eb/p^\256\334c-\251Y~\256#\230\376\026Z\037/I6Bnk\231\343'\342Jb\002l\241\242\372\313\244\021\003\325\033;_\246\343\235\257(;\230\271\224\234\241$\226w\343>\002\367p\216 \326\367\371\316\214\351\331\342T\246\"\013\317A\321\355\345\357\273|\357\260\355\345\247\034\202\241\033"
+	.string	"\3070"
+	.string	"$B\371\367\032\270\201\221j\005>\332).\223\272\261-\214\035T\215\213\252\302\210N\264eA8\254;\205\341d\240\335\300\346zu\275\356\241\314\302\313\242v\031\\\217\024#\323\340\323\254i\372O\f\242 \202\fP\006\257|\255Jv\246\3244\212D\253B\354B2\226\243\322\367\301|>\r\333B\241\376\333\2626\201\036E-\211\323\001\236\360\311\370h\255\243\271\"\374}\2529\377\315)\257\216{\347Jr\332\262t\341l|\205\366\304W\301\310\0272\223\376\261\211"
+	.ascii	"I}\214\205\320\230\247\006\"\2015-\365\203=L\274\"/\242\307\032"
+	.ascii	"^w\307\343.\344)\246\253\025~W\236\241H\357\201\306\276^-\253"
+	.ascii	"P\367\314\300\372xv}\373/\017nK\227\252\027'\304}\244\316\246"
+	.ascii	"\f^\366t:\325\256-\204\231N\200o'\330\374{*GB\352\223&\376\033"
+	.ascii	"l\334\236\233-\034\3274\212\276r/\034\2445\342\207ld,\02283\213"
+	.ascii	"\261v\240\372\221\013\365N\310\324\225m\\\031VJi\340M\033\304"
+	.ascii	"\267\031\005?\036\337i\2221\315.yL\222\305jo G5\353\367;\200"
+	.ascii	"\322\207\322\024\341E\327\341!\340;y\362\301\203^]\346\027\253"
+	.ascii	"+\262X8\310\366X\036\t\340\004a\030\220\243\206\277R\234\257"
+	.ascii	"\336\013\256\203\2740UE\3102y\304\356\247\003\302\227\031\235"
+	.ascii	"V>\223N\210\213@\266\3224\345\342\f\202z\2503u\336\206\300\363"
+	.ascii	"\357\037\231\222\030\336\024\237\236 (\004\005\356W\340\277*"
+	.ascii	"\216\027\256X\351\3556\354\363\246E\235S?\363\322*E\2765\214"
+	.ascii	"\213\262\260G9\244\033\303\226\005\217\355\016\307c\222#\n$\021"
+	.ascii	"\016\273\024e\242\231'\204\205\206\"\264G\365C\302\"L\235\307"
+	.ascii	"\231\030\233\007\373\202\204qk\235\002\376\254\251\222\327\262"
+	.ascii	"u\237\242\212\222\t\232\2652\034xo\227\250\f\330\005\252\310"
+	.ascii	"\"\316$:P\270\232\036\030&\363\355\224%\367n\024\342\210\360"
+	.ascii	"id'\003\232\244\034\n\020+\245\303OK\017\222\272Z\001\264`W'"
+	.ascii	"\037I\211\n`\3155!\026'\242G\353Y8\375\305\026:\035\\\212(\372"
+	.ascii	"\344\2023;\215\350C\241\300y\357\350\240\3146\205\243\220a7\352"
+	.ascii	"B\333\303\n\330\227z\n\305\017\310\212\002\0377\330a\337l\341"
+	.ascii	"\310P.\302\215AG\362\330\272tO\333\270\330\0171\0353A\251"
+	.string	"\210S\021Y\206J\216\270t\256\234:\202>\363\366\363X\322\252\334\343\337P\367\302\315\273\365\013\217 \232h\234\350\032:\244J <w>\234*r\350\017\344c\001\256\203Uk*\202\260\264H\021)\020\022U\276\320\203\021\220`\017\t\353\210\307\3616\260\347Z;\032f\210\023+:\355\246\001m\006\210k \016k\302\226\325\273\355q/\"$\241\004\361\264\240'\006\340I\322~vm\256\207\253\2638n4n;nj=\364yH!\355\317\327\"\217\227\263\333z\305\364709;\003\215\002\315|Ta\315\b\345\254\342q\276\bG\2307\257\0378\327\0071\341\362\026\256\204\377x\315\341V\tD\024h\233SR\252f\205\025\206Q:\333XI\2468\353\375\237r\217\021\302\320\301|n\037\002\020\261\3058a\t\247\324{\331\2072\264\302\237P {\222\340\017\337C\251\306D\305\250\314\255>\221\376U\250M\021\t"
+	.string	"W\025\263Y\364\266{A`\247\302\312\177Y[\013\266i\267!\206l\022\367\345\177V\323,\236\234\240\202D\257\240\315\305\255c2\300l\3077,k\r\343\261\355&\210?\236\375g\021d\243\300\360\004B%\342\304\206\354\371\215\320A\261N_\346<\241\033Cw\2614\177+\376\357\257\327\326y\352\254\242\342@\202H$\325\r\317;\207\2301!\037\237\270\235\364E\245\322\t\312x \246\363N]\016\255\177\033u{\035K\2645+\346\307\351\f\266hT\033\364\017\365\336\245\201\313)\236\343W&bv\t\002\347\374\305\311\247\242\233k\306\021\330L\2566\242\002\031kQ\n\323"
+	.string	"V}[\n\231\212\375\362\375\300p!\247\222\177\355\244\356\377\251'\317\271\377\355\372|\3155\316\363\255>\356\265o\031\332`a-x\021\213\177\341?"
+	.string	"\003lK\374\242\034\310\f\036\177\226\240\235\005\004\303\342"
+	.string	",\260\016h\016\"\201\002yG\037\215-("
+	.string	"D\027\314\3024 )\312\313"
+	.string	"\237s\336M\001\"-_\325\020\261\337\r\250Nu\b\r\3001\003\0316\337c\270@\345k'F\376\007\376\240\364k\267\336\210\335zaF\177\351\212&\030%Y\344bo\035AWy\254;H\344-\336s\303\346q\2421\235\203\r\364\023\3732bF\032l"
+	.ascii	"\035\254\021\357P\306\363\365A\260<:\354\366\027\356Q\304Ng\354"
+	.ascii	"\021\325tj\274uj\022\317(I\332\301t\036\016\215\304\263\316\324"
+	.ascii	"\312\346$j]\302\232~\235\004\220\036L\034\301 \215\335g\237\235"
+	.ascii	"\203\374"
+	.string	"\321\314\031\375\275o\f\220\267p\036\217}\276\221\220G,\017\031\003\303|e%-fOq\303"
+	.ascii	"\300\220Q^\3334$\243\305\365\227Q&\247\217\314BQY\333\020\256"
+	.ascii	"\f\"\031BD\t\207*\207\272\266\254\273\021\242\032b.B\202d\311"
+	.ascii	"\373\f\001\202\374n\205V\335\307Y\251\336\212\265\346ME\247\364"
+	.ascii	"V\314\027\242\317\363\346\337v\254\377U\303PU\206\200!\022\351"
+	.ascii	"3\315\336\350MX\340\324"
+	.string	"h\004\027\233;\241p\271\315A\211v|\007\336r\2040~%\231_\b\214\227\006\334\375\263\273><\220q1\333\354Z\035gI\226k\202o\223w\221\230\374\234\363\237L\244e\205\006y\222\264\260\3315\206\276\265\355\t9(\232\310\370<\221\206\345qJ\226|v\374\214\363F{\217Z\307\202\300\034\332\264\321\342\215\013\360Y#\207lM\223l\266\004l\366n\212\242\231'\317\200\346\232\317\0307\0239\205 \220\177\267\3777\316B/\3151\347\370\242fS\315\327U\273\357\203\305\237\246g\325\200|\003\315{\234P{\330\255z\372\nlU%\016\341-\257E\be\346\303o\242\004\330\245\276\221q2\023\031\325G\210\327^\331\370\234;\320\223\366\354]\351'x\315]\362\177\300@\315\276\270g\024M\016\237\016S\\\361\022~P_\021\202\317\217\234\221\006Vk\"\204\324\313 6\273\261\214\001^l\264\215\250I\226Q"
+	.string	"\244b&\031\177/#`\257\020A\362\020Q\220*\n\244\361A4!\322B\271\376\f\204\"n\204\257\342\305\2144\314<`\241_\363\342 \302\267\356N\021\032\035\221"
+	.string	")U5\363\210\2743&\003\027*\363\035\213\345\245\021L\262\037@\325\357\325\315\267\300b\330\271\334\374\272\275p\3203\320\210}u\2623\237\023\\\375[\330\213\006\246\220\222\223\313\020\240\367ij\022\002h\324Ai\371\326\237h\200`"
+	.string	"%.\032[A\251\006\356\007\333:e-\351\351\013,g\005v\333\003\273/\022\252\246\362\315\364\225B\013Y\fw\356g"
+	.ascii	"\341\006\325\235i\210f\030\264\273Zp\314\303c \251s\177K9\271"
+	.ascii	"bR?^\bo\357\336\204*\005$\277\332ra\2007"
+	.string	"\240a<;\235.0\023~LO\025Rx(&c\033\354S\225x\0354\370_\333g\314'\033\rV6[o\375\236\021u\253\323</\362YERP\333{\025w'\257\026\024\245^\315Kpq\031p\230;\247;\nU\003O\246J\003\\M\2141\340\226\017\212\343\266\377;\265&\215%/k\322HX\032\364\004V?\221\035\"\344Du\001:\001\346\237\352E\310\036\035\367\354,\021\352\274\307\257\330\031\210\025IVK\320h\306\275\327<\362\301\255\370\262H$M\036\372\371\201\035\311\022E8\214\244\246\241}\r\205\224\303:\230\tY\353\317\200\260\253\343\353\264}Z\036W\341\"\326wyz\315@:aq\fP&)M\351\311\025\2055n\025\210R\"\2011\341\214\205_)\3010;3\221S\n\3230R\310A\bk\346N\020\005\026v\312\261\313\242\231\322\307P\215E\375\026|\232\256\036\2343\337\330\305F"
+	.string	"\362$h\001\277\f\261d\305\323^\367 \325\004\256\342R\212W\221\322\361\021\361b\341\002\247\343\005:9h\254-\247\206n\004}\233\006\177\002"
+	.string	"4\330d\f(\321=1E_F\247\344!o\036\223\242\237~\241\254\336^E)P\351\272\230\013\305\252\005\276\216\354X\240\031G\034\305K\235nT\275\317"
+	.ascii	"t\357\230n+\241\001"
+	.string	"#drc\023iJ\374\240\216\374\216_\364$#\263\246\3116\013\271\004n\316Z\304\330\202Qo\204\265\220J\373\224\240{\231\266W\210b\345\326Pe&\215\016r\003\323\214\260\027\226\277\352\344`_\330\332j\262aR\n6\303L9\224\323\327A\274\027XJL\224\341^\271\337\321\344\332y\021el\f\037`\265\021)h\365\257\355\361u\3362}\236\245\231*E\323\003\002\266OU\347\023\303\365\356\371*^\274\"\027\n\025k\321R\205\375\247\024\367\316Pw\357\365\202\310p\221+a\311\f\213\312(\334\327\220\236\033\322\273Mt\252\253\316t\b\272\344\276\"\001tn\352\256\232%\275oj\277E\263\203\335I\246\364\350\364\326\270\303\236|\265\035\376\343D\212\225(\323T\004\2124\204\314Y\343ge\177'\233\260\304\321\340\257z\031\330_s\344\351\312[8p\220Qt\036\202\374\226\250\035q\330\340\377\243\211\264%"
+	.string	"X}U\234\225\246C\347\322\004\021\316\r\346\273\355\333\273\206\316=\200\230\036w\323\220D\336\336"
+	.ascii	"a2\277O\310\273\0137\340\006pw\341F\310\306\036~\302X\227\216"
+	.ascii	"uOEJ@\337\225}3\031\027aj\353\357-\256\345F\025\200O\272@\300"
+	.ascii	"\356\224\026\022]P^\324\035\374(\367\220\230\b(-\362\232\235"
+	.ascii	"l*~M\001\337@6\253\016')\264O\304\331+\241\357\376\022\226\022"
+	.ascii	"^\273\303\276U\3045r\203\330C\210\035DJ2\243-\315H\2067k\271"
+	.ascii	"z\020\023\304\357\212\232\211\374I\235\312\205e]\315\343\206"
+	.ascii	"\003\325\353\207\234\037\2737\274l|A\363y\312\272\2324>\350\367"
+	.ascii	"\300\340\013g\336\246x\255\327\200\"R\3128uV\230~\216\005\235"
+	.ascii	"\364\301\\oN\273m\207n\021g'\0263 \304\013 a@w\343\205{o\212"
+	.ascii	"\347\0232\251r\232\366l\317~\261\303\"M\255\203\004\372:wbH\352"
+	.ascii	"\247\375L\036\336\237\n\021V\235\313\314\303\300s\347\310\332"
+	.ascii	"~v\237\213B\361_\376\260\002\305\017\252\304s\035\001\024\335"
+	.ascii	"Dh\221\233\317S\300\366\366\316\274\362"
+	.string	"\376{\364n$l\001T!\312E\234\271[\264\265\237 \023\277\240\n\331\201\266b\311\017\225\266\250[\306\242\250\221\265\360\366\347\256\270\022\n\313R\231\305?Y\020jb)\317\334\300e\363d=\343)\274\030w\004\217\301\311>\350\025\"\366\004pq%B\334'\200k\245_,\370!\265\001\354x G\276\326\215O\024s1\367\254,k\362\201$\214h\002Xn\202\025\235\213.\351<Z\256\303\266\365|]$\026\230\214\347\317\247\257\266i-\314v\341]\211#\323\220X\302\220\227\033\310\206\215\013\3633i\033g\234\315\310\351\325\313.P/\n\013\202\233\271\353\203\255\367\370\353\367oB]\355\347\325F\327\036ohys\303l\237`u6\260\254\264u\372\265A':\031E\364\277\347\006\3079\237\372B\343Y\356\034/\027Kk\017\n\335<\251\332\177\037\252.?\204\013\320\021\246H\t\021N\216\356J\360\274\375\223"
+	.string	"\371E\036\343\243\004\355\223[s\264\030I\032\277\364hSa\254\201\033\230\0070\254\321\256u\254\221*\341r\312\263\274\356\331Rd<h.\255]q!\315\325\374\343\202\307c\222B\247\326tQ\313\202\231!{u\201t\n\032\330\030\254\003l\3275j9\003\030\276\021\020\263\003]^R\340\236\324\020\265\246\367C\373Z*{\371?\0364\34597\306\037\034\302\275f|\213\255J\224\236\276\210\337\272\236\321\356B8w\224\306j\300^u\345\326\016 \316\005\230\022\334\231\351mt\344\321\256e|\234Ve\320K\260\304\336\335\362@\356\254\372\341\216\020j\311\363%:\272\254\342U\364\345hR^\362\006\\\301\270g\313\363\206R\371`\\\311\322\216h4\371\371\347\2261)\3160}\355,\361<\261G\016/m\353@\"\374\031\0070\222^\242\001\r"
+	.ascii	"\267 "
+	.ascii	"\330\002\255\363v\325\",z\236\213xH\325x\3332\312\334\275:Y\276"
+	.ascii	"wE\363y\347W'\327\306/g+\020n\353\310\214\273\303\246skS\367"
+	.ascii	"L\027\222\020\311\330,\244\221B\271\254x\013\320\251\306\355"
+	.ascii	"s\277\310Cy\f\340\260SX\272\270\f\332\323U\303\016\365\305\337"
+	.ascii	"\212\304\033\252'\005\367y\236\274\037K\017\316\231)\245\331"
+	.ascii	"\3069,\2352\237MM\357%\033\007\264\317.\230U\334\306\216b\274"
+	.ascii	"\032Fj\230q\367\334\202\253"
+	.string	"\002\255\272\003\316/\334.$\253\333\336\272\357=\355R\350\306|\353\373\345\325\314\317\242\302\304\022\331s\326h\235\036\227n\201\236\202\247s\253y!\367\274m5\274(Hu\315)@\304rz\307\035\313\tMhv\021\212.\373\222=\224{\366myD%vC\363\3518\266>c\304\030\306C\300?\366\244\026\177\217\242\277_\307\034\252\216.:U\254\351\371m:\n^\372\021\204\023\2468*2\207Ot\355U\211\310\320\226\322\361?\373.\222\237\322\200\253\200\210\212\235\356$nm\t\003\331\037`\3715\220\306\370@3$[\250\026\3567\337\001\215+b\016R\264\267\200\377-Q\276\336\332\335\273}.\336\371[\332\330duGi@7ao\272\n\265\311B\314a\245R\\\"\355\316\352O\232\312\210\370\233\025\r\321\311\3152\340\314\325WW\017\365a\203\3503\262\302\207\214:\351\002v\213\230\350\3168\357\343\331\027"
+	.string	"\302\336\b\342\fA\306\257\305\234P\300\t\247OQ\013\345\276@\345\330\305}x\271\350L\027\262.K\334-\t24C\\\322\216\241.C\322\215>b\274~A0\267J;\274\027\240(\005?\t\210.bE\302\237\261\\\257\2132\323\202\351/\260v\351\227'\260\363\370\250@\221)]\357N\303\361c\345i~\273x^\303 =\232\346S-V\026Wl:U\217\fG\367\366vvw\315\223B\207\235\361\301\326\307\373\316\300\333L)\343\311a\300/\273\003\366bi>\232X"
+	.ascii	"@\351S\373\357\343e\372\376\326\217\214\237\221\022\307M\300"
+	.ascii	"\001'^\335WI\310g\320\036\020\002\312\036\033@\306?\232\325\215"
+	.ascii	"7)b0\331\177\023\206\377\021')\306"
+	.string	"\221]O\033\326\374\357\253r.\315\267!8Yh,N\253\355\264\370\2624[7\240\245RvJt\260};\322E0\320ZX{\301m\253\321\367\002\360\\b\306\307n\372T6r\001\003g$\225\341\260@\177\223\341\370\215d\237\211\375\021\321\357\371\324\367\306{LHbu\332\037\177\230`\200\3747\202\037!\230\276\220\212\365\202\322|\246\361~\361\314\362n\2310v\350zW\365^\033\275\361\307\211\360&\032\317gm|\036\353X\033\333\355\300\374\337\311\rr\326L\362\224y\351\272\240\335r9\326\330\374i\017r+\267Ds#ga\270\226\005\361.\232\375\252uQ\232\237\363\212\205\301S-\017\261\303k\ts\333\263\256\362\336N\033F\320\277\004\371t3e\r^\346cdd\300\273\003\346<Zw\361\333\257\374\020\213\036h\357\262\321\326\273/b-\027\274\025\306\367*\325W\213\247\266\326\b\250\001\212\037/\364"
+	.string	"+\217\255\376o\323\222\217\250\272!\036\233\360\350j,\376\001\364c\243n\326\303\003S\376\253\033\035\207\032\316t\263\321}\313\260\374\317\272\257\261\315\304\327\214\237]\256\351\016\200\350\036\013\374\261\375\205=q\177\347*bO\rv@ \033c\373O\rX\323pO\240\206\255\246\255\326\370\326n^\375b\277Z\261\034\017\313\225f\313]\377\237q\377\370\236e\351\243\327\275\221\304\001\227f\362\314\037\366pt\301\210\255 i?\355fK\357\325\317\221\\\362\307\315jcG\350i\272x\263\020\376\f\310\365\244]&\f\327\003*\337n\351#\206\007\246\2259\001\3773\305N\037w\330\200\236\201{\336\214~\357\350\220\272\356\021\372\356\257\346\367\267\2528\336U\374C\276w\222\332nx\307\320\037\230\312\360"
+	.string	"\346\207<\036\260T\377*X\036\216\2654\246(\327\300\351\222\367Y\214\276\335^\316\201\3010\274!\332\202\2555~\360\370q:\336\220\356\3103\267\326\341\305\0175\356\004:\372\206\376\343@\342\337\024\031\r\311\336i\221_\336\2007\034\032\027\204\352\017\265\360\341\371\367w?\316\031hkX\275\037p\333\337\026\364)\323\374M\332\330\307\033t\270\343\307p}\274\\?[\301\024+x\362A\312\373CT\214\377\375g\250\274\374"
+	.ascii	"Z/*)+\354q\336\3133U0\001\261\003\n\375V`\376\023d\003\345\363"
+	.ascii	"\361\377\277\373\266\222\206I\324\231\260\235WR`\224\f\306KR"
+	.ascii	"5<$\253d\311D\350\022Yz\207$w\036\007\203n\271\204\320\016\301"
+	.ascii	"\336\263%\313m\331\346\365\375\317\263\342\326\342\206C`x2\226"
+	.ascii	"\253\303\027\235\371\273\337C\266/\270\3367c\f \373\276\021\335"
+	.ascii	"\361N\361+J\037/<\275\036\f\223\324O\351\2175lo2\357\3136\373"
+	.ascii	"iH\235t\314\236\217\316]\260\275\"\032g\276t\305\240>{{B\320"
+	.ascii	"\226\007){\223\375\277\315\215\360^\177\246\375S\315q\354\321"
+	.ascii	"c(\233\322\362H\025w\366v\236\242> \372\035\212K>\347S\351\013"
+	.ascii	"\225\316L\233\372'\230\331\217\376\363\300]\213>\303\250O\233"
+	.ascii	"\360\270\177\302\273+8\r\f\317P\364\256\256\247%\215s\031\177"
+	.ascii	"\307\314C\257\036T\342@q\367\327\255\250\220\231\021\275\214"
+	.ascii	"\3335c\302\371\021S\016l\031\224\nk\376\364Bt\016\337\321\003"
+	.ascii	"\221\262\361\372/\376u\n-S\007\366U?\243\250\303\271d\367[|~"
+	.ascii	"\001\357\304\227\354\241\311\201\253\274\202iWO\235\t\225x\002"
+	.ascii	"\250&\210\227\337\351\341g\220aL:{\243\022\317\230\257d\273\264"
+	.ascii	"\371;(\\\242\301\363du.\267\311\021;l\256\377bt_o\374\005\205"
+	.ascii	"Uwn\007_\247\313\373\235\024g\003aA\267x>3\215o\271\327\333%"
+	.ascii	"\352\304\333_\367\345^\267\301_->f\354\365>:\343{C\265\177\350"
+	.ascii	"^f\253\323`\3276\311\177\355\366\366\361\332\006\351\037\302"
+	.ascii	"ar\037.\335\371\212\263^B\220\3233\333\005\341Ia{/\362\323o\311"
+	.ascii	"e\340op\276nLn\354\335\304\352\321\242\253\356\363t\373\033\323"
+	.ascii	"\277,\354\310)\236\354\rjpL1\207\004\373!\351Fi\177\303\277\242"
+	.ascii	"A\325\213\376\223J\234\270\371\215E/\n\2752\211q\337P\370\024"
+	.ascii	"\241}S\234_\332\352\303\016\354r\260\233\n\203\265\276\214\231"
+	.ascii	"I\273\231`\316iw\262\234#\033\302v&\365\273\021_iZ\302\213\366"
+	.ascii	"\305\235\320\"\336f\327F&q\035K\336\263\277a\232\211\225\362"
+	.ascii	"\314\013\257c\237\223\016\365\361Z\025\177A\335\027\224^\n\253"
+	.ascii	"\006\301<\005p\230\257?\2511^\370\002\2229\310\305\267ee_\341"
+	.ascii	"[j\330\273y\247\327\033h\346Z/R\033\356\362\335\252\355z\347"
+	.ascii	"\fv\177\313\346\256\177l\314w\313W\346\036\303\274\236uW\317"
+	.ascii	"\266Y\274p\3626\362j\241m[\311u}\357:7\365\320\357I\274-\322"
+	.ascii	"3u}\301\262r`{Mn\234\362\272R\343T\352\2554\335\333\335\"\314"
+	.ascii	"{\205\231\363\322u]\325\006\306\311+gM\315X\362\036\264_\257"
+	.ascii	"\206\205[~?\327\262XC\367C\223\037E8z\3149!YVe1\t\2673og!|\013"
+	.ascii	"\023\177\307\332\365\224\351<\371U\377C\321\341\215\373\033\255"
+	.ascii	"\"!\257$\f\f\213|u\3714\316\307\211PfH'\266"
+	.ascii	"\377A\371\177\250t\270\232\313\357\353\276\034zz\313\347%\203"
+	.ascii	"\376\036\365V\306\331q\003\336\244`\034=\212N\017\373\317\n\263"
+	.ascii	"\266\234\230\235\327\200\251Wi\301\337\030\227.\332\2415\375"
+	.ascii	"\305\225\327\375\355\251\246\017.\337|6\335\232\335\304\343}"
+	.ascii	"\373\261p\376;\204\322\377\271i\037\337\024\317\022\333*j\233"
+	.ascii	"\364\372F\2713f\276\307\330B(\0374w\035\200\217o\024k\0234\274"
+	.ascii	"\337\032\263\210t\n%F\301+h\242\364\017"
+	.text
+	.section	.gnu.lto_.symtab.f60325d2ebc28b97,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \b"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\t"
+	.string	""
+	.string	"blackboxGyroCaptureSample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\t"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\t"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\t"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\t"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\t"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\t"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\t"
+	.string	""
+	.string	"blackboxGetPRatio"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\t"
+	.string	""
+	.string	"blackboxCalculateSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\t"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\t"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\t"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\t"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\t"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\b"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\b"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\b"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\b"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\b"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\b"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\b"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\b"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\b"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\b"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\b"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\b"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\b"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\b"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\007"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\b"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\b"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\b"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\b"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\b"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\b"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\b"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\b"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\b"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\b"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\b"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\b"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\b"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\b"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\007"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\b"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\b"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\b"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\b"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\b"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\b"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\b"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\b"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\t"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\t"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\t"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\t"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\t"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\t"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\t"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\t"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\t"
+	.string	""
+	.string	"blackboxWriteBytes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\t"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\t"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\t"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\t"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\t"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\t"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\t"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\t"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\t"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\t"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\n"
+	.string	""
+	.string	"blackboxAdaptivePredictorSelect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\n"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\n"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\n"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\n"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\n"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \n"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\n"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\n"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\n"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\n"
+	.string	""
+	.string	"mixerGetThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\n"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\n"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\n"
+	.string	""
+	.string	"blackboxWriteArrayUsingAdaptivePredictor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\n"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\n"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\n"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\n"
+	.string	""
+	.string	"blackboxAdaptivePredictorInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\n"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\n"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\n"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\n"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\n"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\n"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\n"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\n"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\n"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\n"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\n"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\n"
+	.string	""
+	.string	"blackboxDeviceFlushForceComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\n"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\n"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\n"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\n"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f60325d2ebc28b97,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
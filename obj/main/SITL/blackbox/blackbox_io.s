@@ -0,0 +1,1173 @@
+	.file	"blackbox_io.c"
+	.section	.gnu.lto_.profile.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\245\b"
+	.string	"t\f\210\001"
+	.string	"\034"
+	.string	"\377\200\262\223\006\024\002"
+	.string	"\002"
+	.string	"\002\001\003\002\004\002\005\001\352\263\360\321\b\002\240\342\234\212\n\003\006\007\226\223\225\252\r\002\b\376\201\211\336\n\006\006\002\006\t\n\342\326\223\246\n\004\001\002\007\013\311\231\247\372\017"
+	.string	"\f\352\344\207\261\002\024\r\016\254\362\367\256\005\002\002\b\002\b\017\374\350\342\361\002\020\274\205\242\255\006"
+	.string	"\021\363\200\205\336\016\t\023\331\356\217\003\024\264\334\327p\022\002\002\002\n\002\001\002\013\002\f\002\n\026\030\300\254\300\372\f\t\031\307\276\344\257\003"
+	.string	"\032\330\370\241\354\t"
+	.string	"\033\222\252\354\340\007"
+	.string	"\034\340\336\302\365\004\004"
+	.string	"\002"
+	.string	"\035\352\326\271\264\013"
+	.string	"\036\232\320\325\236\n\016\r\037 \317\377\205\350\003\004\002\002\t"
+	.ascii	"# \200\002c5v\270\230\370{}\2310\013ka\376V\324\305\251\243\312"
+	.ascii	"\356=\003\r\324\357\244l\001\253\224R \025\277w\353\320\347\212"
+	.ascii	"\271\300\020\005\001\322\205\325L\223P?`\315(\232\261]\201\370"
+	.ascii	"o\306gA\245f\203\232U\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375 \256]\003"
+	.string	"\002\205\016\030\220)i\f\377\377\377\377\377\377\267\001\366\300\n\001\217/|\315\205\3342\005\347\322B\036\353\330\3062\266XE\342-\210\271\0075\234\n\207\260\244\301\202\r(`n\362H\3272\022\024"
+	.string	"8!$\034\276\351\221)\330\210\312\006\212!h"
+	.ascii	" \302\264ls\f%\330W\221Un\304\264\361bs\323n\316\320\245A\315"
+	.ascii	"u`\200\005"
+	.text
+	.section	.gnu.lto_.inline.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\263\002}\f"
+	.string	"\206\221B@ \307*\215\001\220&\207\222\027\361,w\n\3469\236\2563\225Y\202\312\002\tw\213\230\221\236\030\030\253\n9\273\003"
+	.string	"t+k\001\206@ \001\220\227\262\030X\341\005-fF\226\220\b\026\320\2262\005,"
+	.string	"0"
+	.string	"1"
+	.string	"\241V\354\276\202\322\300\234s{\353\366/\374\013=\271/h\347\234\363\340E\213*q\024\230\330_\263\272\256\243\r@2\255>\317Yv\004\245\232\352\305\255\001\345\001\221\201I\304\t\305\203\326\331\373\317X@\026\005\031\263Uw\347\355kHb\346\3769\r\3558\347\344D;\206\234X\335\227\277\".\031\005(c)\rD\2119\013K\225\226"
+	.string	"\330\345\204\377b\316\211\241 9\302\251\232\352\225y\243\335n\321\321\002Xa\211\334\376\233U\325\325b\003\267f\032#\036\270\004R\247\321\373\003\356\306\002q\364|\300`(\316\020\0172\222\t\204\013m\202\022\327\200\313\236\216C\003\247$'1\3326\303\377_\270\375\n\030\004\0019 \200\302Au\007\320\002p\345z\366\250)\200\310\274x0o\311\273\203k\255#y\016If>\211V\\\312=\345 D\r\274\245x~\207\027\353\301\3255\255\243\taC+{\327\306t@.N\017w\270y\233z\rp\343\360\032\016\346g\f\214\210\261\200oB\207\021\364F@\001\216\230\375\347\215\004\274\210\343\035v\231\366\260\355j\326q\013\320\272"
+	.ascii	"\321\200\006\237}\026n\253j9p1\346\253h\316\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"\255\006"
+	.string	"\022\212\035&\200EI\00730/0\315g\006f"
+	.string	"\364\302\315le(#\006\027\f\376\003\177\370\213\377\033\307\0206\202\004I\231\002\177\234\211@\376\361\216o$\372$\343\027\277\"\200-\0355\035U\266\345Du\326Zk\224\260\0170)\267\276\371\021\277\341\031~\251\263\035\030\353-=Fv\035W\341YQ\375\341\303#\325D`\006/}\301\263\361\232\240\231 ~Z\275"
+	.string	"y3\243' @\002\"PX= \241#N \027#,\004\311\310\262'\2730\312\361!\026\232\t\202\310\277@\f\200\202\352A\002\340\232\020\020\036\335\013vK\246]\311I\304\304\377\316\203\r\354\315'w\344/\373\253\375\226\245\240\032kl*D.\266\304\253\021(\302"
+	.ascii	"\212r@\002?\226\025`\b"
+	.text
+	.section	.gnu.lto_.pureconst.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375 A\335\001"
+	.string	"\022\304\r\026\220+\035\272\232Pff\346;\223\373\242-~\2406\3352\\\272\003\257\350B\363y9\263\231\314\\\256\362\251\233\\d\036\237\361\025\227\270\303\223p\203\013\\Sf&\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\275\005"
+	.string	"\342\207\030!\220)\351\377\017\250\354|\377\203\376\363\020\315\335\351h\353\206Z#e\253\207`\253~\205\375h_\312\024G\016H#p'\225\026\371\227\306(\225'\250O\311\026T\200J0:\202i\212\007JT\r_\346\302?G!\201N\271\323\016\376\312\257\367\223\225\263\316\246\274\351\\\345\253sQ\256\350\362L\013\236\217% `\202Be\365\365\001\312\004\255M\210\254Rnd\330\303\025a=H\261'\027\253\364u\371\223\346"
+	.string	"\250,\322\230\255\304\n\b\227\223\301\b\210\251\207X0\272\256B=D\340\215\334a\203\001\222\221\b\346#\237\037+\321\305c\314\242\334\375>\267w"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.d1c303b3ec87765d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.38.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\335\n"
+	.string	"\306\223KC\020\311*\035"
+	.string	"8g+r#O!&\25381\332\001~\032\232 #\314\211'\024\266*\231\203\370\306f\026\343+[\rjPM\236\266\271\253:Z\212\322\007"
+	.string	"*\361\3528Y\352\"\263ik\t\331{\247\0246"
+	.string	"7"
+	.string	"7"
+	.string	"3V\001\332\356v\364\345\341+\235\241\177\3305\342\230z]9\255\017\262\005\002\030\306U\355\260\264\0348\354\363dT\315\211\231\330]OqT\271\267\333\266\260}a\177\006\030\032\003\210\332n\253Va\313\rA\200\277~\373\207y\343\0178\201\360/\324\327$E#\312h\020v\311\210o\226\310|3y\007\356[\346\r\3347\207\366\354$\200},\022\312\325\034\033\240(\240\324e\024W)\247\345 \366`5)x\233?\b\367\275\023p\266\310\310\274Xi\307\212P\226\320\224M\246&u\331\257\273\273\246.\366_w\345\002\247\317\3130\201\030\242\022E\205h\364}6@\216C\036\217\244\021\342\2018B\237\016PW\"}<\272\320\007v\236\216=\323\350\353N\236\367u\033r?\241$\241\252\232\231\225\332\037\340\274\350\005\003\001\020"
+	.string	"8\263\002K=\231\001a\330`ay6\350\030\2265\332"
+	.ascii	"\020N6\016X\323e\364W\227\005l\021\227y\252&\247hj\017"
+	.text
+	.section	.gnu.lto_blackboxWrite.43.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\004\003-\025"
+	.string	"f\346\205I\260\022R:s\324cE8\306\3309\2410\\\221a&P\202\262\231\037\212\277\320\016G\316P\270\213\021\3537\267\371Y\007\021i5\3778.\263\336\262|a\277S\324\243\036\2247\375\361\203\351F\364\n\300\177\373\377\336D\312\224\002u"
+	.string	"a"
+	.string	"u"
+	.string	"\270#\341x\347\364!1\315\031Tq\001\327\243qv\220\007\213\346\2276\354\226\252\346\234\263-q\334_\256\226\214\341*\316\207\365r\376zN\350\256'\235\301\357\307\324\210\036\241\267\200.w\261\036\217\3060"
+	.ascii	"Q\b\253\363\350\020\024\242<E\355v4\364\371\206\004|8|Hz:!\200"
+	.ascii	"\035CRO\272j\350\351T[,sN+\257\327s\303n[\3106\002{\007\004\362"
+	.ascii	"\253{\036\237\356\301\253\250\371F\266\335\364\274G\377&\037"
+	.ascii	"\277\007^Ax(\362\001\203r\232e\007u\272?\373\341\\\"\373H\177"
+	.ascii	"\211T\217\254Z\266\352\230T\303\242\372\265j\327\252[\253\226"
+	.ascii	"\241:\252zW\255\253\376\311mH\325T\n\325\234\034\262\212\314"
+	.ascii	"\250H\343\204\355\333O\262c\217\331V\265\r\034\bRn\312\017U\b"
+	.ascii	"[\333+orYP4\347L\340\327\270\215\007\276\321\243!\274\274H\271"
+	.ascii	"\2605\351\261\303\312i\326o\202\347\213\332\375Y\301q\344kOb"
+	.ascii	"\205\017\035\275\262/\343L804\232||mK\t\310\221+\206\276&[\353"
+	.ascii	"\202\321\332\250$eE\242q\355\231\bz\236\\\024\235\315\261\337"
+	.ascii	"\342.0\320\324\324\310\307\270)~P\370\200A\272,\316#\342z-3\026"
+	.ascii	"lh\027\242eVl40\031l1524\233\230\231\004\032Zm&sCa\266\"\300"
+	.ascii	"\266\t37\263\n6\333\315,\026\314=\234Kd\226\334\352^&\272k7p"
+	.ascii	"\240\347\371\300\263\224\354\256u\207\365+\021Y/\\\255\221\315"
+	.ascii	"q\035._\202\322\273I\266#{\262d'\254\033\037\344\376f\374\265"
+	.ascii	"*@C\262\247\226\277&c+sj\271\3056\366\b\261\322\035\250y\024"
+	.ascii	"\367\347\247\004> \240\002\221)3\017\240\325\023\032:ib\220p"
+	.ascii	"I\242{\311\365\212n\361\276\206_@3\274\324\b\226\025J\305\225"
+	.ascii	"\"I\260D\205|\330\320\347\034\243\025\037&\276qm\370\233(|\324"
+	.ascii	"\341\230m\013.\301[\263p\2143F\273\222\204\f\236\203\0250o\342"
+	.ascii	"\355\024Xi\003S<\270\332\271\300\365\340j\023\035.\366\302f\233"
+	.ascii	"W\241\306#\317R\324\262\305N\264h\217\250\312\347\306\267\207"
+	.ascii	"\024\332~\364\352M\227q\336\370\026\202\335\224B\354\001"
+	.text
+	.section	.gnu.lto_blackboxWriteBytes.44.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\200\001\205\017"
+	.string	"f\236iE\360\316(\035CT\326\031\372r\032\274\302\216o\004t\303\314Z418\241\377\263\2300\356\n\r\241[\376\267\215\001\220\206Q:\372u\031\327\273\201o\340\231\2447d\241X\034UUYK\024\255\346\331\354\336R\246\024U"
+	.string	"V"
+	.string	"P"
+	.string	"\037\360y\264\312\316\271\347\262\237Ay\311`\354\356\246-\006}\337\367\035z7L\325#\324T\3712\317xa\001\343H\036!\310e\342!"
+	.string	"\347\202\035<:5\237=c\034+!\210\223\353g\207!\272\035\030w\362\004-\330]'\214\313p\177n\333\202m\005\366I\004\251\351\003(\340B%\245E\203\266\360\326\344\213\2617\261\346\303e\267o\302\237\311l3jy\3131\350t:\215G'\320\036/\262\235\336K\250\036c\033\207v7\340\320\354\356\206\021h\217#\370\264\337\375Eu\230\221\013\330]QA\263\353m\370\200\366h\357\004>\217Z6\005\221<\314\243\226\222X\025\352_\274z\374\023\030*h\035\374\221\317\243\352c(\253\374|\ri\352KD\260\362s\324\353g\207=\335\367\352Y\345\247:\223\302\305\251\262\330\036+;\\xt\254+\266\3500\177\3501\277v\331\0353\raZ\237\016\246CH=\b\371"
+	.string	"\371\220R$\007\320%\216\223\251\301\205\223G\204\022\t\304c\0131\221$l%\224\310\306\221\341\323\204\017\324\226:\235P\233\310[]W|\231k(F\334\254\224\025\225\305!\034\025i\344\220\032\217\032\3234\352sdV\264\222\347pw\027\332\300\243\212\364)\335N\211\212\226P\003\035"
+	.ascii	"`\251'3\260\317#K-\332\262Zr\023\t\242\270#~G\210\321\023\320"
+	.ascii	"b44\314\240\340DK\037\223\271P\267\254)\001\236R\372#\316\030"
+	.ascii	"N\007l\200&\322\024\226\240]\234\023Y4CU\343\001E\304t\315'"
+	.text
+	.section	.gnu.lto_blackboxWriteString.45.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\350\001=\021"
+	.string	"\266\240qG\360\260(\035\273\227fU~\002\270+\006\301\037\343\276\032z\304\2336\036\036\374\236\323\016f\374&6?k>\332\376`\251F\374\250\202\340u\177\002\036\006\017\213\246W\277\3722\323b\315\204\034\275\231\331,!do\271S\n\\"
+	.string	"_"
+	.string	"X"
+	.ascii	"\217\201\266\315\024_\302\273\334\260ff\324Z?\216\023\330N\347"
+	.ascii	"\007l\247\353bn\034\307\361S\274\247\004O\347J\320\227}\302\304"
+	.ascii	"\344\264B\324\351\344V\257\016\001\302\325\374\340\321\251y\355"
+	.ascii	"\322\025\252\344\374\300\362}\355\023Dl\247\025\262\\r\017j\255"
+	.ascii	"\226\255\360\302\275\335v\212\355\006\266<\020\322\007\260\301"
+	.ascii	"\242\205\203\261\326\327H\243\342\320\032\017\247\3752\276\211"
+	.ascii	"\323\374\232\275\031x:\tC\220\001Sk\365>\343\317N/a\233\332\354"
+	.ascii	"\004\203\223\355\235\336\006}\231=_fB\207\262\320\315r\\\350"
+	.ascii	"\324Z;N\275\240;\225\366c>\002\274H\341\002j\205\321\240\250"
+	.ascii	"UL`\005\335\251\305\356\"\002{\030\254\036\237\346D\304\347\340"
+	.ascii	"\233\366.\f\333\356r\373\225\020*9\232\356\266=\261qg*V\341n"
+	.ascii	"\313\316}\rVOJ\216\366\344\256=R\"\337\372\026x\245\300QY\224"
+	.ascii	"-\252\344\266\330\377x\341\321\361\302lP'\375\341\244\273M\232"
+	.ascii	"\243\322\333i7\275\314=/\376;\003\243K@\0211\021\221l\246;\344"
+	.ascii	"A\032EH!\205\214\204@HB>\223\021H\311\027*\231>\017\003&\235"
+	.ascii	"\210J\037\n\211T\372<1\365\205\315\275\354\257\360Z\201\223Z"
+	.ascii	"\025\335\026\177^,h\351\006\331q\272.\333\2461d7*\222g\326Z\353"
+	.ascii	"Dp\272\240}\206\330\316\212\206\r\371Y\237\026\022\311\267\314"
+	.ascii	"\321\355'( P\0021\n\253\016\240\352\205\300\240\033\334\354\347"
+	.ascii	"l5H\243\364J\215N\212\254\242\265\\q\375\232K\206\331\325\235"
+	.ascii	"5N\300\314\361)\326\236\256k\342\327\356Tz\321`\257\340\032\220"
+	.ascii	"J\376\re\206PY\272a\320Eq\027\307j\301\205\277Ku ;\353aws\315"
+	.ascii	"b\217\007H\304t\275'"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.46.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375 \311M\005"
+	.string	"RI#+pm:\240\321Z\327\211+\032\274\372\320]\371\033\254\016\254ho\253\020\352\263\023C\245Q\177\027W>=\231R\305E\210\376\336)\005\316\254\252)(\025kd\227\003\243\020\355z\320l\223P\253\340\032YltR\353F+\261\373\f\t\335\364l\321\223Sc\037\2603\264\3453\237\321\2248\355^R\250%\005F\036\333\257\314\331\245\213\234\275\250c\t\215\273K\347\346\334%\347\037\364\301\007V.\005\210\335\265\374@\314=o\333`\373`\233\021\t"
+	.ascii	"`\25173\340\234\031\003\276\3345\334-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.47.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"e\n"
+	.string	"\206\023H=\020\005+\035"
+	.string	"\032\365\241\376\254i\f\205#C\f\355NJ\227{\354\213\254HM*7\265n\026\353Q\2643\242\230\314\270;\001\240\260 \330|X\305\276\023\205\207\206\224m\021![J\231\0026"
+	.string	"4"
+	.string	"8"
+	.string	"\243\2266\231\216\320\300Tv\335e\3105\035u\362\216W\017\311\322\tR\236\001<X\314\207tM\205\215\035\210"
+	.string	"\371\332\345\210\272\373\033#=\364\237\376o\370\217\360+(\252\002\365[\326\233.\256f\022\202\313\265\266\367\227\256e\332\257\263y\366\177?\277\347\335/GO\312\335\315\003L\267\254\007\240u\237K\311\377\325\377y\302\302\352\001?\211\2531ff\226M\307\326\035\335}0\360\242cm\200\313\264\344D\230i\254\005\3402A\312\314ky\377-\024%\325\351~1\\q\232\303\270\222\350\367\f\325jL\277\007/\205D\023\204\206H\222(\215&H!\205it\nK\250T\0302\270X\021\201\n/D\021\025~\312\226\362\354zS\207\232\217\025\226\275\216\340\231y2\307\377\311\027\265\3305=\373\017"
+	.ascii	"`\325{B\300z:\236a\366\322\252\025_\200\311\260V\321\"\2610\""
+	.ascii	"\272\206\327\217x`\b2\356\\K\323oa\226\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForceComplete.48.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\025\f"
+	.string	"\306\326R@\020Q\225\016<e\336\255\343\345\013\304\020\344\003G+2VgT\274\314&4\254\004\254f\025L)l#\030?\245\023\017\205\335"
+	.string	"\223\tE\200\262`1\257e\215\217\305\021\212\003\244\261\265d\313\235RA"
+	.string	";"
+	.string	"A"
+	.string	"\t\026|\334}\fIW\205\243Wlw\334T\304\273O\225\235\177\326\247\207\013\033\037\350}\002"
+	.string	"?\\g"
+	.string	"\220\021\f\r\fM\005\033b%\001\240HJ\211\203\335\265\374@\017wv\333\017l#\260\037!\253\320\344\022A2\304\036CRS\366\347*\312\266\364\264\264\252\364%\224\223\251\244\032\241\037\343\222Bp,,ca\302\366}\327E\317[6\260\212\231Z\273\253=\263=\266\366\217\2559\336\313\366g\306$\334\016\273{\340\331\200\0260O\346\360\207\207xRMYO r\275\370\223`y5^\304\020I\020\333\334S\\\230\354\212\030\370\343Qp\374\022\317\234\241#\377=\363;\221g\327\006\001\276P8\214\004\r\234%s\251P\260l\0250\025\315v\331p6J\001s\026&l6\f\034\267\331\264\021\364\271\212R\b2@\250X!\375.2\225\203\355\251g\275#\304\t\330\r\032 \rMM\372bF#\377\251\252\006\024"
+	.ascii	"`\325c#4\327\n\324\tf\342C.\331\nPt\375\231\3655\303p\026\016"
+	.ascii	"M\026\026\216\021\234=\256\211D\231\320\204\206@C\344q\347h\266"
+	.ascii	"\024/L("
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.49.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\311\005u&"
+	.string	"\372F\220\017Fp\336M:s\300\216\020W'\242\006\215\210\246\363\275\274\327\250\326\203\255\213\312\267\263\260\223\300\363\231k\177t\250;\250\347\005>\030\346\320\331\023\246\204\353\207\\\347.-SKOSs\225ukjM\332&D\356$\003\350"
+	.string	"\321"
+	.string	"\344"
+	.string	"G\362\255\374\212\323\313\232~\245\2109\036meD\034\317\373l\225\032Tf4\2347/\3661\247\037o\234O\304sK[\332\234{\217\017n\362\204\363&\202\017\2607\313\373,\016f\364\346\231\235\230Q\246`\301\211\323\037\217\3548\327\331\324\025=\367\036\177m\344\351{\274\035\252\313\2358k\226]S\376\323{\001\272\306\350hY\025\317[\333\351\242\316\244\322\336\264\254\260\216\n)\021\350\256\206\030\304\354\t\230\020\261j\016\267\001\371\362K\033\026\2607-\253!?\231\020\257J\004\367\336\253!\002\251\270\037\267\245\203bZ\217^\225T9 M\2217S\325|\260\370\262\204pe\246\326\253\212*}l_E\216|\245\252\202\252]\356\366L\261A\253\204e\205(=X\275*\250Zq\033\356\275\\\207UVg"
+	.string	"g\276\311\314J\314&\210H$\321\313l\343\033\n\0249`\3127Y_\017y\361\021P\177\237\3022\253XQ?\364\365\221\377\327\017'kP\375\024\347<r\211\367\336\006\004\226\254=U?\314\326E,\253\333\310}!\373\006\"s\003U\36703\213\237\021\235\367B]\340g\271\226\"~\222\233l\004\243~x\223\017\303\336|\177\312k\230\027X1L,X\223\314Gam#\363\313\333[\314\\Y\b\255\034tV.\360*g\240\227\235}\\\271\367\343\231g+\357\320\312\350YYwV\316\235\225O]e\\\256\262=+\233\266r\211\253\334\266\362\017`"
+	.string	"+bqmi\266\343\335\221\354s\327\314/J~\374\253\374eo\346\363\303n\206\343X8\311\311\233\"\330\275\367`|*'\013Y\267A\257\214\333Z\256\215\307\247F,\377\315\341\244F\220\244\\\\\366&\257,\r\312\235`M6\241-y\233\263`\r\226\037g\033\371ce\226\177\303\336m\314\313\254\277ayM5d\013\b\325"
+	.string	"$\223\311;\037\262@]\240\271J\025\2055\311\270\346\263y\033\031iW\252$Ubo6\332\260\016\203\312\353\372\264\2115\373w~\352\304\336\313m3\247O\322(\365C\\\003\350q\203\244S\216&\r\263\315CK\342\332\370\033\"\324a{\213{9\356\3231k\366\265\270\304\323\322\261\f\37427\303\241\354\340\301z\2607\315\306\031\361\274})\033\250[m\352\017\177\370\0300(B\234\367\336\262snnob\335|\264\213\021\301O\302#H\2208\033\326!P\357\345\276f6q\242~\330]\273\302\262\336\346D\365S\034C\002\215\030LDH\277$ \022\022\260\310"
+	.ascii	"\214\243\027I\300\016:\033F.\222B\0301\021\225p\321D\324\202"
+	.ascii	"G#\tx\304\244D\202i\t\250\204r\221\004\340\021\013\033\300\026"
+	.ascii	"2\212\210f\264\370%\035\021!\375\212\226h\374$(`\240\222\321"
+	.ascii	"\322\217\t\b\\\372\241\301\227\267\2678@\327\330\024\027\236"
+	.ascii	"\21064H.%?\265\275\246j\336\020la\257\215,\303\342Z\250\201\017"
+	.ascii	"4dl\3100B^\0339\205\030\024\355\024_:>\236\321\354\315\236\313"
+	.ascii	"\"Cl\343\222\203\360\240\246b\336u\236\017\353\004\365.B\231"
+	.ascii	"\032\031\033r\327F\224-\213\r\332[\314CV\327B>\270\310\316@\325"
+	.ascii	"=\004\266PA\352\332\310\017\216\366\315^\257|d\005\261\263\306"
+	.ascii	"\215\256\321\266nS\177\202wr\255\353\240+RR\204O\211\330\263"
+	.ascii	"s})&\302\323y\235\224H\221\324hl\013_joW\301\232\fd\250Q\034"
+	.ascii	"C1\203\020sdh$E\211\306P\002!\244\314\356\021\240A$F\223T\206"
+	.ascii	"\003\213\334\264\262\004n\362\343\237\247G%\\N\262\224\357Y1"
+	.ascii	"\335\323\313E\241\322 \001\237D@!\034.\311\023\007\324\033\235"
+	.ascii	",\253pff2\341U\254\030i\270\033\3542R\274\300.\034\240y\354\207"
+	.ascii	"\265tUCo!\036\252S\t\350\306\252\241d\346\214\033g\340\310\217"
+	.ascii	"\321p$\244S\205\246GLc\026\b!\342\244\366\360\262s|\334\332\222"
+	.ascii	"\033\0257\fW\360\245\205\374\270\344\211_p\321\217J\270S\300"
+	.ascii	"\240Y\314\226\030a\026&ReL\314\265\324C\240\017\244ZM\210ba\f"
+	.ascii	"\260\306\203vO\226s\262?\307\271\372%\233\017\037h/\251O\350"
+	.ascii	"\325\216H\233N\2252\276\234\025s\263#\214x\246\032q\177\302\376"
+	.ascii	"\022\347;\254c\324"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.50.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\335\t"
+	.string	"\366QC; \345*\035\200\326\025\340A\300\214\001\200Y]\b\251\261\204\316\253\343\372\022\322`\217U\377\177\262Q\201w\230\240\226\324n4\200 \220\t\312\004T\025\221\001A\320ZW\337\b\221;\2451"
+	.string	"1"
+	.string	"1"
+	.string	"\344\356v\032r\3237\235&\377$\327\200\341\367\255\340\272\t\314T,\233\020\265-p\220\037\003aj\316\200\207\335\365\004C\217\233\273m\007\333\n\366\t\002%\314\271k\203H\003\021a\247Y\263G\324T\227\375m\265e\177\372\334K\031\t\240\024`\267\243F\333\030\2472b\373\033\233\354\227\217\257=\212\250:\t\240U\277\314kW\273\313AX\305\276Y\272%\005\306Ru\351\0170W\003\023\227\324\234\331&\275\004#\263\233b\360\305\3032|\221s\336(\315\203\347\374\016u<\221G\303\003E\204>\022\240\216B\364\231\350B#R\327I\260W\0011\352.<o\324m\306\323\267\325\226g%vR\024k9/GR\366\315r\323L\333\263\230\017\020"
+	.ascii	"`\2517\023\272\202\002\263\370*[\221\037\314\262Y\333g\262\250"
+	.ascii	"\242\020\006\376p\217k\242{\b\371e\bq\351b\266\363\026f\031"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.51.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375 \321\355\005"
+	.string	"$\nm"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\376\231\276\004\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\355\263\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367\236\001\221\216\217\220j\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001"
+	.string	"\244\003\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\t"
+	.ascii	"`\325\273B\300<\207l\025\274k\270`\304hB\344p\347`\355,\003"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.52.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375 \365\325\006"
+	.string	"b\214/5Po\322\030 v\202\202\313\205\240\021c\341\243\372\306\357W\302\202\250\324\262\265o\271\250\265\207\013\267\004;\004\317,\243.E\260_\207Ot'\366\203\243\221\275e\n\021\360\341sU\240N\034\330\332\300\013\302\002r<V%\301y\237\253\232xV\254x\233\203!E'>\020\204\361i\246H]i\225"
+	.string	"\006\"7\3729j\316\343\225ZW\372\346\331\30022\rI\331\305b`v%\203\"\362\207^\363\267\246&Y\240/'\223\312\356LXA@3\377\013\f\241\245N\020\214`\204\203dr\332\235\317}\250\324&W%Q\252\244\243\205\305\345$\273\320\026\340\260\2737\214LCw\372#\374\r?)\t"
+	.ascii	"`\325\223C\300<\207l\025\274k\270z\3048CH\341y\033\326N="
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.53.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375 \307U\005"
+	.string	"BI#+pm:\240\ft\327\2634C\001\376\"\251~\206$\272\310\377\366\321\221\374\231m\214o\324\377[+u;\305\003D\207\272\265[\312\024\317\254\2511&\023\333\262\213\303\344C\273\0342\353\"\322:|B\032\235\224\314\331\311\252V\226\n8~\177\3758n\376\005t\324\374\274\225@L\270\036S7\230B5)0\372\374\367\376\352\t\205w\272\265\003\026@\"K\350\324]e\344,]\246_BHY\036,\272\373|\t3\373\270\377\r\377\021\377\271\n"
+	.ascii	"`\251'3 \0306*lV\341\270\206{E\f\"D\016w\356\266\305\t"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceWorking.54.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\225\013"
+	.string	"\246\325O@ Q\224\016?"
+	.string	"\340h\220Y\231H-\374\311EP%\026\247Q\251\0259@e\0318\312\301}\365I,\256q\237]\2753[\345l\272\004\200M\246d4\256\332%\200\371\207\233\3755\331[\312\224\002?"
+	.string	"7"
+	.string	"A"
+	.string	"\331\273\220\323"
+	.string	"\022^i\005\216\335\356R\021\317\01653\177tx\325\241\207\3726\032-8\217+$0#\204\r\n\267\301\004\0371<\002p\244L"
+	.string	"\226\335u\232\270\016w\274\355\007\266\025\330w\020y\323\243\017\262\036\257W=Q;>\220h\371\331\335\226\232\262\017WAl\247\243\323\252\351\314\364\255\316\211\323\006\356#2vO_\216]\305\027#\266E6\305\013\030\210\034\333K\256\"\344\213x\303\341X\217\251\030P\237\t\017Z~7&!\313aw\021l\274\325(u|\204\351c\245\232\322\033\260\256\005Jj\220\322\263\215=\005\205\311.\251\201\217\342$\037_\344\321\026@\001\316T0\r\204\013\030f\223\271H\300\\\035\315\205se<\237\253r\300\330\204\b\236\253\002\206y.J\247\035\256\2028C\t\020,\\\244\237YW]\200FU\325\240\266h\272AM9d\245F}\tF\022"
+	.ascii	"`\325\213#\364\245\215VG(,[\2625\206\212Z/\r\251\270\005R6u\212"
+	.ascii	"\213\202\303\264\350B.\210Yi\203\345q\315Q\245CQ\253\240"
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.55.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375 \334E\006"
+	.string	"\324\nz"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\307\273\203J\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\200\200\200\370\305\207\237\267$\221\202\205H\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307\272\001\221\314\356\r\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\177\244\003\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\t"
+	.ascii	"`\251'3`\236\031\007\016\3115\2745bd!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.56.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\275\002\205\025"
+	.string	"\246(\220K\260\324Q:Y\303\302[-\354\027(\274\367\320!\006\001\252\361\357\272\372\327\036\314\270\361'S\305;\243?\026\334\275\333\266\377\317.0\004NR}\374\314\341b\355\007\375\217=\301\320\3320l\301\276\202\334\006\225\240&\204l\"e\222\001}"
+	.string	"o"
+	.string	"}"
+	.string	"\367\345\274\362\324k\220\352\275"
+	.string	"Rk}9]\004\346i\313W\310\323\361*\344\351\316v}\034\bT\007\364\222pES\265\326U\233\370\354%I\307\346\331\336EG\f\016\221N\235\227>'\001\234>\247\343\201\035T\217\311y\033W\242H\360P\235;<\376\367q\205\256Gm\210t\366\274\307"
+	.string	"Dp:TgmL\2603\005\302\344\2641\227\016j\255\313\271\223\347k~wqv\267\301.\027\t\247\373\033\362\364]6\335\020\332\r\371h\\\334\005\326\270y\273\037k\255u\273\304.\345M\241\274('\372\236\224\334\3675)oIyI\346\245\314;\216\274\335\274\314\274Wa!\006s\264\350)\365\020X;\024\215T!\205\221\342D\277\357\274\373\335\263\330\007\211\326i\254G\225\366a\025\374\035\tM10Ow\017\334U\235\376\277U\355\205>4\0132AtF\216\"\267\023\322\346\355\002\0378#~\371\203zO\270\245.i\2637\324\220c\267\230\226\306.O\034\302\261y]\322l\003G<a\356]\327\213\237\353n\261\265\316\356\223\256\204\263\017Z\n0\030y\312\035A\307c\310\017\215\213&P\365Pk5\020S!\324\341#;d\362\211\350\346m\237"
+	.ascii	"\371\026\020\334ac\"\273Ks\243\032\263V\233\202}\321]\304\366"
+	.ascii	"A\247{\341\206\237\013-\026\277\\36\017^/\331\004\222u\301\304"
+	.ascii	"`\254\f\261\026\215k\246Bke\0016S\263r\311nV0.\033\263y\311V"
+	.ascii	"\030b1\331J\005\244\375G\021!\255k\245\t\305r\344\351\207\233"
+	.ascii	"\204D\215 S\272\306\177\177\210\023\\\277N$J\247\364\201/\300"
+	.ascii	"\301\351&Uk\263Q:\247\307M\252\306\305-\233\354\223\246\021r"
+	.ascii	"\333\325f\234F\016\204\230\030\362\264l\022\332d\037G|\214\313"
+	.ascii	"\220\221\300b\221\247\264\037|. \260\002\221\271\252\007`\327"
+	.ascii	"\023\002\252\341\t\031V\027\n\347=\033K\020\rNJ\305\301\303Z"
+	.ascii	",\032\303\324\332bfa\222\027p3\r\205fx\210F\300d\317w\275\005"
+	.ascii	"\216\013\367\320\233m\0234\313Eg\034m\302x\025\234tY)\222))\036"
+	.ascii	"\013\030{r\237|\240A\244?\365m\252\317\210\256-\301LzI\207\242"
+	.ascii	"\306\3475E\255\200\002"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.57.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`)\001\035\016"
+	.string	"&\033bE\340\262(\035\222\221 \020\020\241\343\b3!\360 \316%\263\3640\230+\273\036\300UD\004\315\245\321\350}\373_C<\007\340#\235\253\242\271\312\0307\314q<\216`r\300\036C\367\002v\005I\254\332\261\367\2262\245O"
+	.string	"J"
+	.string	"P"
+	.string	"5%Z7>vg\332\310C\361\360\235@<\324\021?\035>\315\223\017\240C\035\206\376\236\201W\006\033\240n\365Ff\364\360\340t\351X\251O\301LNL\200N\365B;48.{\266t\254\314\020\223\335u\272\272\rw\274\355\007\266K\354\303\0043)dR\331c\317T\251/\373oU\204\375\330\037a\3729\255/\235\232~\b\307\363\342\322\335\005\316\356K\317\217\325\2012L\330f\261A\2663\037[y\003vE#\003cw\027\230\301\347\320\266\177\342(X|r\300J\3014\b\tL;tP\t\344\257\017;8O_ \246\212\330\334p\204\267(}vW%>\213\337\240\370\260C\247l[<L\305"
+	.string	"\"\247&\2261x\354\204P}9\352UdCc\225<\366U|\305\212\017s\005.\357:\364\271xx\275\354\bt\324\200\005\034I\345\202\bzD\262\225 X\330D(\243\023\t\"mB\351$E\033\2318\215\344\2007\n$\223\246\262m&\r4K\375\275\247\"\255\016A4\177\212\227\3751-\016/\322?E\325\026\265IJUP@F\265G\244\274\353\351ST\216\017\211\325\260\273\001\025"
+	.ascii	"`\325\333B@\030V\303F\256\"@\246Y\201\253^|\001n\203\025\032"
+	.ascii	"\204\302I\234\0208\210<\215 Y$\023\266k\342\231\026\232d\202"
+	.ascii	"$~flizTA\235\001"
+	.text
+	.section	.gnu.lto_blackboxWrite.part.0.76.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`#\005\375\037"
+	.string	"\2469\307F\220\234M:\005\337\221\231\231\241\377R\272\204\354~\020\t\220\002\267\262\347(\033\370.\214\t\335\332\231\266\271\357\261\325\357\f\350\366\300\b!\250\305\002x\3379\235\376jH\177d\251\304\330!d\244\304\022id\023\271S\n\255"
+	.string	"\257"
+	.string	"\255"
+	.string	"Gr\261\335\307\242\210\250\2005K\202\217\262\260\263Z\201E\247~0\236\022]\200x\032^H<-\275\363F\334\300\201\356E\244\016\254WX\336i7p\260{\021)o\255[ae\265\002\027\234\232\301xj\237\210m\035\226w\366\232\003\275\352\2031~\301\263Z\353\355ty|wr\254\2114\334i\333\371\266\254\251\223\265#.\0316>\026\340\222\241\365Z\231\365\233\242\226o\322i\225E\343a\230`K\313\f\237\254\252P\200\027\035inF5\367\013\226\215\220\250\326\372\340'\214\254\336\234"
+	.string	"n\253\035\325Z}\336\215\273\274m/\333(l:\003a\335\035v9\035\3043\rTN\377\330\246}z\310i\036r\272$\247m\3444IN\217\344t\215\234\026\311iz\262;\034\247w\247\347\215\374\037p\340\352g\253\326\2534;5\0075\363q\262\277\311?\345Vt^q\324{Q\025>\361*\023vV\251\200ET^\005\312+\366E\025\217\313"
+	.string	"\230+\337\355\324\300\361B\366}(f.\247\350^\346d\"\036\260bE\271\224\335\313\234\306Z6Z\005\357\264A\032O\201\346\205\304/y\022\337I\023]e\342*\036\276\332\204E"
+	.string	"B=\211\007\320\b\262\025Vk-\327\007\352\374\240K2\335\307\242\214\025\0326l\020O}\266\306K\003\343\331\236\235U~h`^.\317\016\335\261-\271\345R9\276!\033\256mE5\276\037\364I\342\270\344R(\266'\211\265\035\367> ^\376%\211C\207\016\342imov\004bht\366\263\326:\265\333eq\303]\032\343B5\353\330a\036%\322\025\367\276\255\336L\263\277\345\\\242>\200"
+	.string	"!\236\322\255\231\241\201\005\230v\b\021\363V\341>\370\327\200!\247Ko\247\0344\347\356\332#\224\346\255LT\265S\366\261<K\316\3772\023n\336\n'\236\356\222Z\337\271w\362pH\0172?4\336L\233\333\345\265=&aD"
+	.ascii	"\367\244\344aiI\304\341\23228\341\236\\Xh\361TF\345R,\016\352"
+	.ascii	"\204\022\013j&\243\\\211\021-rK&\230\224N,\335R\224PBqcjr\272"
+	.ascii	"\031\031pN\005\256\351\366\224\3135\335J\333\363G\274\355y\037"
+	.ascii	"\222\333\225$\236\321^\022!q\302\235\023\034\203\026<N\005\n"
+	.ascii	"p\202vH\314\017\255HL\t\226Z\231\373,\002\034<\306\314\364\254"
+	.ascii	"\033\n\207\fL\353\265\326*\002"
+	.string	"m\3176\215qYs6N\273\"\273#\273#\342)\320R\2614\372\263\266\025<M\205\t^\265V\b\376\231\243\271\340\177\235\032\003\022\222xz\2537?;\024\374\241\371J\325\325\217P\302\245D\237e1f\346cNF*k\250q<\245\220Sf\246$H\320\202\0244\035\220\002\221\"\254\007\021p\305uZ\320f\377\f\034F\245\344@)f\301<-\215e\030\221\270\240\027T\013\250\007\304\374E$k\201 \367\301\007b\327\276\035~\004\220)\177\347\0074+\200\\\0050\030\255\237\343'\006#\220\267E\365\311\234f^\216yXu\305\352\366\204\276F\016@\346\035\256\343\366\020\205\251\226%\340\237\022\243\003T\371\3312\031\246\212&\243\262F\360\350G\342P\321\345\311*\241sH\354A\340b\204\016\273\273\001@kz\250'o\357O\373+\333q@s\005\241!\356D\250\270\231\350L\351\226u\0072\355\314\276"
+	.ascii	"\264\022\360_n\274Z6M\314j\315\314\200\204m\254[\330\fn\344b"
+	.ascii	"\221\2419`E%\211\203j\366\371\222X\370\374"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.81.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"\365\013"
+	.string	"\366\025O= 1T:\f\201\221(\214rD\273%l\016\037\b\201\346\242~\331J\200Vf\036\334n\004\252n)d\243\336\234\321\223\376\002@Z"
+	.string	"V\f\n#\271j\005\027\210n\275\237\277\211\224)\005<"
+	.string	"B"
+	.string	";"
+	.string	"(l\271x)\333\266\\D\036=t\241N\"G\206\027\262\335\220{\324\021\037]S\033\371yR\221\256\007\217\340\213\265\300\361RuxN\256\001\300\354\256#\036\356x\333\nl/\260\357 \001B\354\242>x\254\210\b3\301\3023\bc\322\200A{\311\230\221B\266_H\t\277\"d\020\201\320\305A\362a5\2039\374"
+	.string	"\310c\344\002 \277CWa\255\261\343\304\356n\367A\317\336l\221\275=>\006>%\331\207\361\030\026\374\022\246\360\311\237\036\375\217\306/6[\225\362\303\205mOG\304\265\251\335M\360x\360\022\0326n\220\262Gj\313\252][e\331N\253\323\031\323\207P@\004~P)\340M\245\3430\270\320i l2\0214\234\004N\246\303m<\037\256r\300\335\204\006\036\256B\327y\270\355\332*\313\007?\311T\325\r\266U\215)\251I\265e[\222W\273\323\345O\251\001\031"
+	.ascii	"F1\003V\275\234\305\250\267\241\321\016*@\0139\207\3605\315\360"
+	.ascii	"\bo\3462@\024\fs\205\273h\"\377\f\221\347\026\006[\375\320\251"
+	.ascii	"\216\267\031\347\2025QP\247}IMQ\363\376k\313\030"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.86.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\237\001\325\016"
+	.string	"\306\331^E\360\222(\035(\205\255\3278/x\375\240\361\353\226\267\253@#\243\3331\f\271\221e[\322T\\pa\265\242W\036\322\364\326\307\n$\177\373Kq(Y,\203\342\230\223>\235o>\n;\263\037\235 \262\267\224)\005G"
+	.string	"K"
+	.string	"K"
+	.ascii	"'l\2276\330d\363\370W\263\247\341\301\264\200\355\356\366\250"
+	.ascii	"\"n:\324\214&\377\336\001t\252\323av\252\016W\270\340\005\026"
+	.ascii	"\202D\225\202\001p`p\334{fP\2412\t<\212\234\354\2565\017wv\333"
+	.ascii	"\rl;\260\017$vL'L_\333z\b\220\331\325\220#dW\261EBE\311,'(\f"
+	.ascii	"/0F\220\033\024\260M}\n\276\247h1\213\201\257\206\303\310\207"
+	.ascii	"\230X\013\266\373m\217\376^\222=j/\220=\336\276[\316\262\332"
+	.ascii	"pu\356{%\273\323y|\276\214\317\b=\020\211\262\307T\006\254\033"
+	.ascii	"\031\357+\031\214h\243\303\304\217\221\274\332*\\\2763\202\224"
+	.ascii	"\236\354\273\370\213\025\177\204+\220\362\335\243OR\005\221#"
+	.ascii	"\026\343\2229,l\227L4\223\307\222\330\306|\234rH*\2155\036\256"
+	.ascii	"\316\004\206\3409`\220\207\023\241\\\340R\"\200>\022R\266\t\242"
+	.ascii	"\217\312\006\032\2216O\002s\024B\243\315\002\307\215\266\016"
+	.ascii	"\\\2351\212\353\345\242\250\326j\225\256\033/8 \355\017(\337"
+	.ascii	"\231\304U\342\205\322\223\365\266\251\301Z\251\3228\037\312R"
+	.ascii	"G+v\244\022\307\001( p\202\031\263\363\346\230\001\257g\377\303"
+	.ascii	"\376\3310e\225u\343\030#\302f$n\274\210\023\207\202\031p\365"
+	.ascii	"\354)f\036\\\007\326\265\260\247\313N{\323\332\306\307M\273Y"
+	.ascii	"\2201G\036\214\360c,%\3067D\376\326\031u\t\260dY\2346@[\312\212"
+	.ascii	"\201P{3\342\320j\334\273\360\030"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.94.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\355\001\215\021"
+	.string	"\006atG\320\224M:W\306=\215\"\0221\005\251\203q\236"
+	.string	"\253!\221E\261\261\253hF\005\346,\rO\360v\355-\024\032\326&\307X\334\263&\254\034z\004\027^bQ\034\274#m\244\223~\230C)\2048\3216\262\267\224)\005`"
+	.string	"b"
+	.string	"Z"
+	.string	"3\370\341\274\035\333>\214\023\321xF\001\307f\304\204!\0275#\246\335o\365\230r\003\335#|\201\356Q[|\366\b5\273\231\2379^\315\243\005\037\245\234\021$\257\304!|"
+	.ascii	"\302\307-\300\022\213\037*\217\226*\300\303\201)\273\373\242"
+	.ascii	"\247\216w\223I\340\035\212ew\235\352\271Q\267\315\262]\301N\225"
+	.ascii	"\351\354\322G\301!'\224\237]\021M\2326E\354!TC\346\030\270\266"
+	.ascii	"\017\307\203R\004\351\210\210ii\337\002\243\323\220q\f\202\017"
+	.ascii	"\307\003\240\307\266D\210\277\324\355[\3469K\360\001\362bwU\367"
+	.ascii	"\213d\266\312\246\261U\326\374'\373\326\333\261\346g\314\300"
+	.ascii	"\001K[a\333\261\273\r\036\355 \365h?\206\314\001\317\335\255"
+	.ascii	"Q\275\331vu\251\260\334\021Z2\261\335\272\016Wjw!\3709>`\360"
+	.ascii	"\203b\335c\352\211\214\3378\216\230\037d\227\227|\316\243\377"
+	.ascii	"\2420\037\245!\233M6\261a[\226$\205\333\235\335Uy|\321\217S\262"
+	.ascii	"4\244&\235Ro\326\356p\025\310>I\307\177?L\245\025\025\316\260"
+	.ascii	"\222 \346\202\231aE\267V^.\027<\274X/\255\026\r\254\025\007\227"
+	.ascii	"\226\r\253\026,\266ZQ\340W\007\027l\005\363z\301V*\333y\270\n"
+	.ascii	"\344\0035\023O0?\353R\317\343$j'~\362\237uQulG5\213\215\336X"
+	.ascii	"#\203\020BMG\253*\254\217\220\204\002\t\324\033T\325$\222\013"
+	.ascii	"\222\252\332%\325\2364' `\002!\347\350\034\354\354\237\252^4"
+	.ascii	"\305B\2740\322\214\360s\301\216\3137&\267_+\353\304\213/\225"
+	.ascii	"\320dH?\341K\230\261\b\210\334F\242\036f\034.\031\n}#D\377\205"
+	.ascii	"\264\232\251k\210\030\323\271mS\233e7\257kd\353\306)\221xa;\032"
+	.ascii	"Xs\265j\262\033x\002\306\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\177\003E\016"
+	.string	"f\024OB"
+	.string	"oL:\304U\273\203\231\213\252\033\324\353\357\fTW\n\222\313z\007\207\031\007\204M\304\213\214\234\323\364\377\037WUU\t|\373\355\377I\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\300\0078\"\375\037\234\025\244h\273\311-S9"
+	.string	"<"
+	.string	"?"
+	.ascii	"$\221\034}\024\275\311A\364O\350^\321y$\350N\021?7\212\350\t"
+	.ascii	"q\266N\215\003\332trm\375\246\206\223\2665\323\363\276\r\366"
+	.ascii	"m\023\032*\231s\316\314]\"\332\226D\bs\332\231\260\300oz{,Z\202"
+	.ascii	"\255#k\207\321\376\232\335%{+v\026\354\253\370\272*\272\f\"["
+	.ascii	"\034\311\262\b\271z*\252\216\212)\177\220\250\237\342\351&\323"
+	.ascii	"K\260\f#/J'\005\031\0327D(\250\370T\226\253p\224\325\026j\027"
+	.ascii	"':X\360P:\223\315\330x\365\343x!\334\037\017\356\020\016n\260"
+	.ascii	"\301\355\301\340\264p\301e\241\202\317\022\334$\020\334#\016"
+	.ascii	"\334 \f\334\036t\006V\017U\f\025X\204`hV;:\002\224\001;\021a"
+	.ascii	"V?\324 \250\241a\204Y\375H\030\001\253\336$\300\252\310e\271"
+	.ascii	"\320e\225C\027\f\231\260a\001\260\025\016\325\221\013!\210-\253"
+	.ascii	"\035\235e\003A\250a\f\006\2043('\205i\r\220\002\241+\342\006"
+	.ascii	"\021p\024H+B\204D4&R\266\035 \276\017\321\207\3337\205\242wL"
+	.ascii	"\2141S\003G\343\306\002\322W\237~{\b\024\016\205?\365\240/\206"
+	.ascii	"\357\376\025\201Cn|\266|\017\325\355\356\004\334\b\\8]\033\304"
+	.ascii	"\345\235\230\230\230;\243L\224X\325\332\230\315\017w\005\373"
+	.ascii	"\375\223\342U\036{j\205M_\224%\020v=0xH\340\334I\006\202fP\247"
+	.ascii	"N\027E~ gS\005"
+	.text
+	.section	.gnu.lto_.refs.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375 \325}\004"
+	.string	"\202\n\034\037\240\245i\f\377\377\377\377\377\377\377\003\360\367\377\317\377\366\255\375\335n\364\315\227\364\246M\344N)zKo\"\034\227\266J\333\243\251j\264X\036\244\202SX\203f\031\001e\315&\257b4\031\007$\266/\227eh\025d\001\020=\320\032K\234\336\355\347\241\324\"C\207/\316\263i\tn\007\316\026\3202\3042B\027\332d\320\342\024\035=\253R\023\002\013"
+	.ascii	"-\001f\0023\034\001\004\366\250\030 \232\251\300O\270\274\323"
+	.ascii	"|LC\026\253@\001"
+	.text
+	.section	.gnu.lto_.decls.d1c303b3ec87765d,"e",@progbits
+	.string	"(\265/\375`\274+\355\271"
+	.string	"\272\035y?Y JQI\035\356\337\260\353\206]\371\212\372\360+\025X\245-\213\307\343\310W\277@\242\177\022-\2572Y"
+	.string	"\212F`$\326=\336s\007k\001\262p\002\344\363HP\340"
+	.string	"\n\220\026\245i\022*)B\350-\232.\001\302"
+	.string	"\277\216u\332%\\\306\350?\225\273\365\373=\244L)\005e\003\327\003\017\004p>a|n\206\021\f%K\272\013\322\332\016-\216\246s\344\311G\250\033X\007\350\366\262\030p@\243^\305\331L %k\222\326\234|\313\243N\306\357n\213E\303\004\352\312\245t{\333\026G\273\\I\225I\227\r\270\234\333\342\277\370\243\227\361I\037\343\225\336\350\215\017\343\217\237\337\305#\275\314#y\353Q\247k\257s\273\356is>\346\234\333\215t\373x\324\341\034\314\345J\346\243T\021"
+	.ascii	"GnMts9\267\032\364h\240\223\204\207R\033\"\247\314\2202vaj\232"
+	.ascii	"\235C\332\320w\316\215\361\342r\333\322\342\037Y\242\\\311\271"
+	.ascii	"\230\356\334\223\036Y\2432\003\242\366\363\370\342q;c\224\302"
+	.ascii	"\260\271\360\305\311\337p\2020-Y\311\360.\215\2230s\256\261)"
+	.ascii	"-\312\343~$\265\375Nm\207S\333\327T\0363\266\3062\203u\225\244"
+	.ascii	"\313c\267\342k\336z\360+\267\230\004\272\203S\246\310\232"
+	.string	"\013bj\273\207\324\243\356!m\377R?\270\021\265\375Jmo\252N\305\315\274\025\341g\3550\270\224\2569\266\331Y\303\006\006\207\327\343v\033j\273\210t\307E\244\3551\324\017\316!\305\256!-\001u\016a.\366\304GccT\217\233\030\366L\255l\345%\036\245\375\271\323\003\254J\324c\367r\260(\030Z\331c\377\362&\336f\340N\332\2378\224\2361\266\271\315\271\335\371\035w_]\217y\234C\372\030P\3333Ho4\352\031\244-\246\273\334H\321\001\245\366\270yj\233\240v\353\032R\357RkH\031\273<n\017\324\366\326\223t{\0217\342\\\027\031\203\231\275rn3\330\334Y\251\315\031\200\203~\303\311\331H\316\271\202\034+LZ\362\343\356F\322\02343\007\275\243>[\347\220\252\256!\355\366\213T\302N\367\225\340\351P\336\307\202\234\241\373z\267\177}\2111O\342Gt{\327\027\240\333\333'\200"
+	.string	"~\203\037@\210\356\037\353\366\027\017"
+	.string	"GBr\370\020%t_\241\n\376\343\256\275\333}/\360\335\227\002\335\336\201\007\3216\335\037\245r\272\177@\3677\273\035\352-\350v\024\357\241\373\375+\350\376\031\nPH\200[\360\023t\367[\367KP\242\373:"
+	.string	"\247\373.\240\333W\370\f\335\256\301\363\334t\277\230\366\356\313\201{\371\035\013\274N\363t_\037\241\017\r\301"
+	.ascii	"\272=\350q\330\277\351\366\264\267\371\232\356\356\351\356"
+	.string	"\n:\203\356\320\375a\335N\366j\267Sy\232\256\351\276\024t\177\332\375\337\355u\335\016\327\355j\335n\326\355e\335\376\354v\260no\322\355\316n\347\352v\030\335>\244\333\263\272]H\267\377\350v\254n\267\352v\035\335\356\201n\247\352\366\251n\217\352vf\267?u\273S\267k\240\333ot\373\262\333it\373R\267\013u\273R\267'u\273\261\333s\267o\240\333Yt;\333\355\303n'\352\366`\267\003\273\375\327\355)\272\275\327\355;\335\316\363\013t7\224n\237\240\333)\350v\013tw\\w\213u{\n\335>\201n/\241\273Q\350n2\335\255\242\333G\350\366\bt\273\b\335\356\323\355 \272\235\247\333/\350v\017\335^A\267o\350v\r\335\016A\267g\350\356\021\272\373\254\2739D\243\321hw*\242\233\306J\267\005\315\033\344\370 \242\304\bJ\\\373q~\347I\362\222\215\213\244\035\fs9O\331"
+	.ascii	"\337ya\243\251\202\203s4\034\305j\276\265\377\366j)\262\221\t"
+	.ascii	"\203\260LC\355\337\342\357\346\355\273\275\362\"\263\261i\302"
+	.ascii	"\0074\331n\3204.\324\366W\246X^\013\226oKs\366\226\271\224\314"
+	.ascii	"\313\244\210\376\265\277\322\317\366l\337\246\026s\356\t{\216"
+	.ascii	"Y\316\345\345R\204JfL\016\031Y\274\375\266\231\"bm\215\307-\306"
+	.ascii	"\357f\240\344\334\242\300\240v\312\245v\232\215\311\2343\323"
+	.ascii	"L\233\223F8\251\317\270\213\350\316\361\353!\272\033\347\314"
+	.ascii	"\201\234\213Y\230aT Q\214-|\310=\003\315\371\330,6\240\251<6"
+	.ascii	"k \235\315\\<Z\0253$s\263\210t\346\234!\037\217E\020\2309\003"
+	.ascii	"\322\231\225\371\310\212\322s\333,\346#3g\310\307l\374\200<6"
+	.ascii	"\225H\247Q\231\001\351l*\263\263\231y\362\321\230|q\314\311\f"
+	.ascii	"\331\331\374\222\235L%\017\322\311T\"\235M'\367B\202\371\241"
+	.ascii	"dcB9q.\3441\313Pr2&y\240\310\226\231\333rv/\244\234\f\221\263"
+	.ascii	"\0233\331f\254\341O#\250\f\243'F\246wP2\202b\346#\024\031\204"
+	.ascii	"\231s\020#\241\254\204\200b\013\315U\016-F9\345\030H9O\240\224"
+	.ascii	"s\32134\347\\\3149\323$\235\332\234o\360 \261\224\224r^\366("
+	.ascii	"e\247b\030R\316\357\265\345\251D:\241\230>aK\234X\331E[t\254"
+	.ascii	"\334\326L\252\316\"W\216\001F\305R\316\210{\\\245G\215z:\342"
+	.ascii	"|\334iR\216\217!\275R\025\266\345\356\323|RL\310\302\250\177"
+	.ascii	"\366o\366h\375gO\005\347\370g8g\243;\b\035w\0203e=\214]oS\244"
+	.ascii	"\024\2411\305\243&\314N\b\013\217\237\354\313\372a\370\261\374"
+	.ascii	"0 \200\231\263\361a\330!\223\263q\307\035\204;\bL\004\352\252"
+	.ascii	"I\212{F\313\207\351\310%\211\221B\246>\273\354\301\252\244\024"
+	.ascii	"\253\036\367\314\023(D\312\224]\276<q\362`C\264\212<n'\215\366"
+	.ascii	"\314d>\246X\236\307\264&_5gL\240\264\217\275Z\235\0271\270-y"
+	.ascii	"\3343CT%\357\374$\317\365K\276\313\333g\362G\372\2218Yc)N\346"
+	.ascii	"\215D1\362\002\367@Z;\254\250 u\317\344\267\336\340^\310\007"
+	.ascii	"\350\260\230|\026\0032\027&\255\234\333\036\r4\270\361\362\002"
+	.ascii	"\016):\270g^\2508XNm\254\345\213\270\223I\225\335\343\306b\352"
+	.ascii	"k\375\020o\237H\316\271\221zz\031\037\267\240\351\262\264q\253"
+	.ascii	"6\266R\333\013\327P{\212s\370q\345\305\342\022\222\f*\206\317"
+	.ascii	"_\375\324\013\037\337\343y<\326\357x+o\377\352\253\332\333^G"
+	.ascii	"\3436\347'\007\240\362;\207.? \022\375\250\277z)\007\273\355"
+	.ascii	"Su\321\225\344p<\331h\r\006\026\007\335>\177\365/\370\235N\261"
+	.ascii	"\315K4P\310\034j=4\\`Rdt\260g6\265\257\231\332wL\355{D\355k\245"
+	.ascii	"\366\363\336P\273\277\351\302\205\261\025&\312\2678KK;\230\314"
+	.ascii	"\317\321eF\304\370\370s<e\240\036\307\234\030\301\341\304b\271"
+	.ascii	"<\362\270\337\351[pf\226@g\206\022\255\033\217\177\3716\274\355"
+	.ascii	"\3607<\216\312H\311\244v g\357\220z4\352\035\322o\362\351\257"
+	.ascii	"\241!M.\333\274\363\301\216(\"\217\257k`\241\003MVX\216)\032"
+	.ascii	"\036v\332&\245\250\031\"r\350\330\214\264\230\224:oI\270\024"
+	.ascii	"_\331\237\314\322\361\202\224\307\277\3243\243\205\245\244\351"
+	.ascii	"q\337#U\t\023\037[\352\322\001'E\355\t\253,-\007\326\024\252"
+	.ascii	",-\300m\035q\247\214\265\036N\326\355\343\346^\232\254)\301q"
+	.ascii	"Y\n\370\2501\022\316\230\214Xf\262\223D\206\f6B\2710i1 \353\212"
+	.ascii	"\222bc\343CU&TC\262<\276w8\003"
+	.string	"\201\223\212\362\370F\241fMM\257\016^f\3122\177\204\202.H(rqq\267.\0058.LZ\367\210\334\230\032]\337:\035Cb\by|\347\336\b\315\230\250\030\306\274X+\211\002\003\362\370\312\371\330N\325\026\"\310\307WLw9F\3718{|\3038\232\221'1*\217/\030\007\323vO\266\027^\356\222*,G\262@\373\262A/\334\215S\227\314\342\227\005\224\321\311=\3472r)\"\007\312\215!\314,}\341\372r1"
+	.ascii	"\007\327\213\214\262\246\334\343\353v\273x\333g\367\255u\304"
+	.ascii	"\\|\235}\251\355\001\357\263\364ni\235e\232\030\334\343\276m"
+	.ascii	"W\013\020)g\026\227\332\005P\2234)\225\367J_,G\312\220\326\206"
+	.ascii	"\250\327J\337\265\356\032\237\222\001\265\022\244\312\027\036"
+	.ascii	"M:\256\324\326\241BC\273j\251\022\2454\r\352\205\223\264\276"
+	.ascii	"j\216\206#\265\306\003\252I\212\224k\326\303,~\371`\013\2471"
+	.ascii	"\303`P\351kv\221`2#1+\217\357\024\007\273\222\305\b\325\213A"
+	.ascii	"\251\262\004\312\343\326)\212\211\3352\347i\215\260Xa\351\024"
+	.ascii	"\335\222\242\310\372\226a-G/f\214\331\260m\261\203\216m\035\325"
+	.ascii	"\2319\253<\237\037\245@\330\333R\013\211\335\332S\217'O.X\317"
+	.ascii	"Y\346\302t\303tD\353\240\364\005\263\231j\241h\244"
+	.string	"\006*'\347\205c\311\222\333D\312\351\246\rL\t\325W\337&9\317&\035`\327\013\247-\3467/&5qn\\\216:F-`\275\360\270s\212]]\327\231~\025\2638\275P\267\265\345:\325\350l0\357bP\213t\221\313\345J\222j`\315\345\274\024\201\307T\361\361l\373\252X\346\310\274x|\215\\$\277\203\254\006\020$\367\310\024\031g;~)\337pBF\345n9\035\316\223\324\215,cC\206|\224\024\331\250\304\300G\233\\n\200\323\006UF\352HV\326G\345R:\254+s\3138f\220 WH\363d\033)\0308\265-U@\256\220\217\222\036\035\241\032\362\270q\222~\374\370\272\024i\f\3141K\255*=\354\220`\260\260\276\216\312\363f\211\025e\r5\365\362\270<\256\225\232\323\261\344\230\245\326\216\r*0Tn\217\276V\377d,G\326\031\016\f\246\261\247/\035:\276\316\227\271(&\335\272"
+	.string	"\352\242\314\017**GK\30142\005`\253\n\2218\035'\027J7.\246\356\224\337\365\344b\334\007\037I\233+\315\346\215J\301\314L\037"
+	.ascii	"yra\232\313\331i\003u\352H\313\326\205\362%m\027\331\343v\303"
+	.ascii	"2K\206\031\223\371u>\3449f\251\245\200\246X\313D\275O\367\351"
+	.ascii	"\353\324\314AH\316-\024q\233rjo\257\323[\301I\362\f\035\250\245"
+	.ascii	"\034js;M\037VF\036\267M\362\306\215\217v`\341\351$\302\247T]"
+	.ascii	"=\221ij\272\313\rv\030<}q\241F\337e\231\217\t\022F\307O\331\311"
+	.ascii	"\262KbkS\257\362*/\r0L\2343\031rO3\372\322\240q<k\362\3702}3"
+	.ascii	"'Z\027uv\031f!\254HZ\331\322\222\243yRm\"\005\003\256\006\212"
+	.ascii	"z\225\256\322G\325\334\263\005\235\002k\267\332{\274I\367xa\b"
+	.ascii	"\340\036\365=\2720\332\223\306\234\215r~BB\303B\322\315h\371"
+	.ascii	"\343\"\365\205q_\340\252\243\251\263\307\027I\023\303\352+7\257"
+	.ascii	"\213\217\222j\t\342\202\213\307]ST[\245\242v_\3435>\324\204\017"
+	.ascii	"8U\311\335\315w\037-S\346\243\035\306<m\250vP\035\243V\202X5"
+	.ascii	"y\334\252\017\265\325&u\356\355\346"
+	.string	"\276\216\216\356\3538\340`\246^e\\\\b\372\353\376\254\306\007\020\250\030wj\323\244\311y\373r\016&\"\033\215\030\204%\307\302\204y\247\2369\346(-\254\234\227\001A\277\025A!\n\235\225g\323B#\210Blo\210DP84$\004\n\376zC\226\030\024\002\325\260\301\337]\203\277\241\341\312\256\276\r\301\225H\250\323B#\210$V_\021\020(\370#1$\026\221\210\200\345\255\032\370\021S \260(\030\024\006i2 \034\n\261\302 \315\212\336\n\304\353\260\210\b\007W\340\220%\246\353:\f\241\005\n\031|\253/\370[\261\301\267B\004bo\005\256'\\\300#\"\016\021W\266\007$\004\002\035@D\034\212@\005\320\316\n,\321\320\003\330\337\0201\330\033\242\240\202\370\243\240\205FL@\374\001\201\277\241\364\206]\203|EB\304_p\005\022\255'\f\327\237\241\242\022\202\204#\260+\004\202?\025\206\302\024$"
+	.string	"\002\213B8A\374\371\202\017\b\022\216\020\374\005\255'|?\"\022\254P\320\017\270\242g\035\022\216\340\373\231\300\256A\303\036\233\2417\\Y\021\206\253\t\303\265E\217\204\020\304\232\225\025\242\030ZY\342\n*8\260*\210+\273\302\t\b\210D\302!\b??4\301\225H\002+\217X\304\366X\025\036>\364\210T\254,\206+q=!\003\0234\020\205@\024\023\364"
+	.ascii	"\r\205!\b\021\213\200!\200pA\213\036\t??53-4\202\204\017\370"
+	.ascii	"+\352\020T\364\263\372j\210\354"
+	.string	"\357\304\317OJ$a\330[\201@,\2617\302\317O\016N\207\310)1\202\035\366\210F\254\354o\230\302\206\006\372\r\327\340\032\2446\002:(@\007&Z\320\264\t\017JxP\"m\023\036\370\370x\320\201\217\332\035\370\\\226\027\024\374\r{B*X\036\221\204u\350\307\252@\241\360\004of\330\023\002\302+/\204\r\020\b\177\022\2540d\327\241\025\270\262\022@\240\002\261G\002P\260h\005\316\312\023!\002\"\342\020\221((C\213\325\027\024\201\027A\013\215\270\200\310\013\372\255\b\nQ\360\254lo\310[\201DC=\342\315\n\364c\261\372R\025\210\275!\236\217\370\363\361\210>\340\372[\261\2018\304[\207E,Q\017\210'\034\256\020\264C\034\nY\240\237o\035\022\361V\026?\226\250\347\353i\240a[h\004\t\342pe\361\033\372*h!\321:$\301\n\205C\0227\303\365\267\342\307\006W\337\317\206\310\303\251"
+	.string	";\024\232\300\263\002\177z(\260HW\336\352\023\222`\263\372\204Cx\345I\200\035\n\211r\210A\341\217%\022\322\254l\357\004_Q\357G]5\360S\241\262<\0234\254:\304\361\365\326\024,\317"
+	.string	"\007"
+	.string	"\376z(\f\327\025+\212N\264`qX\374V\240\365\204\036\226\327\201\017\033\374\025\2516=\266\007B\213\241\316\2205A\004`\3577\\\211\034\332\307\007\305\007\n\224"
+	.string	"\001\025h\204\360\307k!\374Q\001\250\007\374!\021\374\365\206H"
+	.ascii	"\r\211$F\200P\001\250\367\003\004\366P\254@\337\017\347\007\230"
+	.ascii	"\324\033\032\226\217&*]\031\r:,\007Kk\034\3319\271z\265{U\245"
+	.ascii	"\256hu\235gQ\204d\365\270\\:b\236\262\246x\340\035`\210\274e"
+	.ascii	"=\256\322>\331j\273\264HI\341\252\020kK9\324p\025\246z1\034\331"
+	.ascii	"\212\n\277`B\226\243\271*6GQ;'<\365ULE\334\244\310\242.\f:e\035"
+	.ascii	"\324G\271\222q%\346q3\372e\203\n\312\205:.\032i\306\307-\r\227"
+	.ascii	"\227'Y\216\033\205\363Tu\304\366\364PU\213,)\206\003\033\253"
+	.ascii	"\272\2108\261\023F\212\263Ad\312c|\343\246\313\2160\251/l\003"
+	.ascii	"\317\3003p\rO&\343\b \245\212\235\221\271\274\244!\242\03375"
+	.ascii	"\256Q\206\344\026\306\312c\314B\227\331}!\271\362\030\323\350"
+	.ascii	"2\23235\250\034QL_w\".\206\224\362\255\334t\201}\240)\t"
+	.string	"\227>\227\220,\3012t\324\262\260\2651\325n\254\364m:sfX^\304\360\273_K\213a\224t\325\226wVi0\320\276\336\240I\217_\224\221\360\364\004\203\221fk8\332l<\306G|\304H%<\273"
+	.string	"\303\262\003\016\007J\314\021\222\203\304\250B\331H\t\343\316\230\241\031\021\031I\222\244\003\242\n\020\004\203i\222\b\256\035\022\240\004IMK\310Df$I\222\366;\231\tC\316\\\234%\300\204t<U7"
+	.string	"F\315\322x\324%\273\006\233\265\233p%\226\334\001?%\204\266\354\272"
+	.string	"W\260\277o\204\257FM'\252\342\177\364,\361AX\365\246l\016\022\275j@U?()[/\301 a<\300\026YE\360\022\270\t\213\301\005\243\260\224\234\330\033\275`\213\022\335Od\317\205\224>2\217\f\bc\254\026\275\\\331\016\306\202!\036\022\2303@\215p\266\027\246\361\006\2257\026\337\257\003\002U}\177\373\017M\213\246?\227\320Ed\216<\214\244~\tf\303\257\320\231\331ab*\243\377(sD\246\270\340\016\363l<\341*\230[R\203\360\001U1\025\274\236\215\275\226\261\350\002\217\377R\230\315(.\313\027\344\003kBp\246\3440\215\276\377D\332\3509\333\020\005-\223G\201\007\017\t\326\340\336\023\305\260-\364\006\375ZU\005)\351\212\306O\244\320"
+	.string	"t\300\034\032'\231"
+	.ascii	"\325apL\340\242\033\272n\312\207Y\0227Ncu\367\216G\025]!\021"
+	.ascii	"h\313\217D\256\365t\247\033bH\260\355\222\362{\200\272\234%\b"
+	.ascii	"\b\337\325\340\254\276-\304|\363\242\363\356\310\222\316\007"
+	.ascii	"f^\217\322\262\207\276)\b\035:4\341#\203>\f\230&(\256\353R\304"
+	.ascii	"\255\301(\202na`\236.\221\225\210q\335\304\222\234\371u\261\243"
+	.ascii	"\304\361\204\212M\312n\034\200\324u\223t0\3265\006\360\346\346"
+	.ascii	"\301Z\251\3052\230\300\344\332`D\311\343|\307\f\004\261\024\272"
+	.ascii	"JyQO1\213\245\366\376\323\266]\210{iclb2|\207I\255i\247rR\304"
+	.ascii	"\006\263\016N \303\033"
+	.string	"\264\331\005\375\341\334\213\241\316\343@Tk\366\343\253\200C_\251&\334\2625;f\177\201\177\bb\341\260\277\bY\006\374\030x\003V\016i\373\r\360\330\200H\265\335\001>\020UK{n\206D\025\3374\323\222\314\2353T\031\"1<\f\366x\016\214\203\004\277\267\373]\340(\204\316\252\021\235\3551\020\242F\025M}%\341\357|\333\236\245Gk1y\353DV\007\016\303_v\323\223\023\225\3371\212\301\352\177y\357\360\341\336\013\324\314\377\253#\353S{!\005]\306.\210\345\\\034\235g\030\202<\332\003\355A\234\340\226$\303\030L\371o\375\fw\265vrk\357vW\001\373i\375\333\3265\2351\264N\361\fLz4\023\2251\254\005\353+!\376zR\203\032\316\005^\232%\320-\2164\3103\254+\373A1-\b\361\313\204\211/!\263d{\362\312\365\357\nM\245+\202\363\347\220\260u\322LM\261\254\233"
+	.string	"\271\243\2517\331Z\372\353\2564(OU!?>\207\354\004\337C\307\253R\206\363\013l2]\032\254R\375\274\216\2239\267\354\215h\211\006\244\263\256\177\001\320\343\343\024\003c\314\" \225\200\234\312\343\232\341Tf\032\r\315\262\227k\212q"
+	.string	"\224\261\b\225\343\031&\241\205\306\bD\345\220\031\260\340\3152\331\265\247\221um\002<\261\2716\314W\252\007\023\031J/\205\231\272YX\374jX\226\001\006\024\211\r\344\361`\211\326C\f\244@\335\241;\210\202g\201\204\004\234\033\034\261\030\242L\214\0274z\020z\2436\256T:D\026\243\300\023\036Sp\261\354\315'\361\245$\t\335\310\246D\344\314\2238\322F\206mn\270\363\241\304ldh)\272[\251\313%\0271\005\215Kb\004\361\216\352$H\361\323\005S\2101\bH\343 \203\276\025/\3646Gy\345\275J\320\362\344g\237\367\221\\\253&[X\346\361\232\345$\365\343~\001'3\017\361\206\347\016\352b\006\r]4\323\036m\204\217\274\245\312\317\266Q\2312\036qa>\361U8\262N{\374\023Wu\232\230y\212jA"
+	.ascii	" Z\305+\033\261\027\017\206\267\305\001\021CH)\373\336\366\223"
+	.ascii	"h\241\265\007\033\324\\\266\034\314\035\321\363J\371\270\273"
+	.ascii	"_\372 \032\037;h.\025@zw\022@4\225v\207g\205\0243\343\344\246"
+	.ascii	"@\334\264\222\303A_\227\234\317J\004u\367\234\251-i\202`\260"
+	.ascii	"\262!\"n\204\223\277\361\207\334@\305\272[;\372qS7\320\231T\326"
+	.ascii	"a]\327qH\305\342v\205\032C\301P&\315:\351A6r\264^\260\200<k\261"
+	.ascii	"D\340\033\301\217rFV\204\030\031\210\221\031uG\354\330\232\006"
+	.ascii	"c\372?;\024\354&'\005\350\327\317\331\252S\2336R\230L\336y\232"
+	.ascii	"\022\035w<r\343i\021T\254\016nb\340oU\266\343"
+	.string	"\027\326\252\207]}\030\343`\317\024\266\365\203\213|\317\"\207\372\n\230E\213k\252\234\301TX9\322!\215\275\002\234\224\347\372\225N#\340\276#\3556(Dg(\365\231\363\216L\032\377\330\235r\222`\3240\364#m\246\310\001_\035X\267=\316\357\264\237\366\303\226\270\371\006^\206\266\335`\275\300tE\304\3757\366\027\270\353\277\346\316\013\002\210\244\261o\035\303\200\206w\276\002\024\007\234\216\357AH\222\207\265\210\307\"\340W{\334{\322#D\247\333\022\246\354\351\277\001\340\345*\201\214z\301<\351\302\276\255\265\375\007\214i\352;\250\365\022\334\322Ml#\264\215\262\2711\3342\265\022\323\331\326\235,\224\246\331\036\347F\300\242Le\216\333\264\251\250:l&4\f\267\237L\306\365y:\246\315\346\200\372\351b\355\322hy\254\373\232 \237_\202=\313c\017p,\002\312\222\200\332\200\2445\313%\t\350\310o\374\032"
+	.string	""
+	.ascii	"'\365TH\020\347\217\360\030\225!K\2151\f\"\312>\374\241\251\235"
+	.ascii	"q*\2655\251\202\337ZF\3250\331\350B&\023\221\374\206\207\263"
+	.ascii	"3;d4'\360\302\032j`R\247/`>\341\321d\355f*\031\006M!\016\277"
+	.ascii	"J\225\302\333L\240x\366Q\002\320?!c\273\233\2215m\037i7Z\006"
+	.ascii	"\037\303\033\360#\217pi\256x~\253\302\177\301\302\247\306\177"
+	.ascii	"%\246)\027?A~B\202?z\037\321xp\271p|\217\006\023G\016\363\211"
+	.ascii	"7\217\266\327\204<\005\016\033h6A\337\366\206\f\006\317n\257"
+	.ascii	"E:\3770|.\357\342\"\277\325\361\2019\377\204\256e\2350_\006F"
+	.ascii	"q\223Q\037e>\374p\241\333?\273\3640\240-(\307@O\241\357\344\276"
+	.ascii	"\001>\323\361{\245\207\370A\250\371\316\231\276\371\272\027\265"
+	.ascii	"#\341\334wn\215\321\3346\3023\240-$\320\231\310\256\352%\347"
+	.ascii	"\367\017t.q\037\3471\035\340\340\300\025\224\037\301W\356\177"
+	.ascii	"FxV\370.\f\203B\363n3|f\273\013M\370\227e\177s\372\335b\025q"
+	.ascii	"\337\365u\272\225\207\003\370:\373\355\375\307\3475>u\016\301"
+	.ascii	"\313\222\377]^\374DK\240\203\302\243\373\350h\310t\027_iv\005"
+	.ascii	"y$\200\377\211\\E\237\276\267\347\037}lx\037\325\026\314\270"
+	.ascii	"u\331\004\363\006\202?\236\350y4\033\271\303\377\340\255\307"
+	.ascii	"3=\263\243\375pr\260\341!\216|\231\312Im\tf\272\254\025"
+	.text
+	.section	.gnu.lto_.symtab.d1c303b3ec87765d,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"blackboxWriteBytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"blackboxDeviceFlushForceComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"isBlackboxDeviceWorking"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d1c303b3ec87765d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
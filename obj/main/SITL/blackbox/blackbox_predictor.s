@@ -0,0 +1,363 @@
+	.file	"blackbox_predictor.c"
+	.section	.gnu.lto_.profile.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375 \215m\002"
+	.string	"t\003\201"
+	.string	"\005"
+	.string	"\326\201\354\324\r"
+	.string	"\001\336\353\312\307\013\004\002"
+	.string	"\002\001\002\002\002\001\002\321\357\336\205\016\f\003\232\230\315\260\013"
+	.string	"\004\307\302\346\363\006\036\002\003"
+	.string	"\002\001\002\002\001"
+	.string	"\b"
+	.string	"9\002^"
+	.ascii	"n.\260\023C\316\330\225\016\224Y\334\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375 n\355\001"
+	.string	"\024\002b"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001"
+	.string	"\002\003\003\003\004\005"
+	.string	"\001\001\003\201\204\f"
+	.string	"\002\201\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	"\240\210\225m;\202\240\002"
+	.ascii	"\2112mP\252\006\346\275\224d*Vn\240\r"
+	.text
+	.section	.gnu.lto_.inline.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\275\006"
+	.string	"\022L'-Pm\222\016`H4\215X\312\242\361\017D\3140"
+	.string	"E*\250DK\f\260\365M\f\305\220\312N\253\252i&\322\200\016u\303\244m\"w\n\257d\002\374\206\317\2424\222\t\261\220\374\0033\233\216\216\202\242\235m\020\334\\\200h\016\276\177\2102\304p\037\345\f\276\005\r\237\274*\324S\274\342\377\320\216\346a\307\b\233PG\211\237\255B\216\006\207Cr\2620\243\305\254\277\260\323\266\340\2226\332\022\314\n\006\372(\340\243-\300v\002\206\375+\375s:\250\267\260m'|\213(\322v\340\237\r!\027"
+	.ascii	"\254\205\003v\212\0277\344\315Vc\260\001Z~\201\246\202\351\312"
+	.ascii	"0\003Y\2755\004\247\232]\207\030\254\320/&\004 \301QV\202\024"
+	.ascii	"\300\0244\006T\210aiX\003n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375 \272%\003"
+	.string	"\322\005\022\033\260\247\320\001H\"\315\001\356\006@\222dk\031r\222d\032\206\354\b\331{\313$\003;\361\210?\274\341)E\200\f\216\262\b \204\24708\215ag\217rQ\261\305\022\013\370g8;\377:%\233\222\267\225X\234\277Z!\n"
+	.string	"S\311\005\310"
+	.ascii	"\354\370\351CeO\021\f\326\021\207\013\001*\203l\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\001\232\004\002\232\004\003\200\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375 \305\315\002"
+	.string	"\202\304\r\027\300%\035\357\3723g\371\377\377\377\177\363\241\310\030BZk\222H\231\002\377\247.\334\233L\262\3416\244AD\003\320o\217\361\253>\345\247~\357B.p\007\304v/\002\r"
+	.string	" SE"
+	.ascii	"\344\021\265\215%N\210\305\212\031\b\036\302`\217j\304\345\002"
+	.ascii	"\260\017\224\266\2016"
+	.text
+	.section	.gnu.lto_.lto.b99517631924b88e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxAdaptivePredictorInit.3.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375`T\001%\016"
+	.string	"\226Y[C"
+	.string	"\261&\0358\377\231\345\3466n1q\375.\357\021\232\356Uw\255r\034(W\363`\300\321\270\242\372\267\024\234l\210b\005X\200\376&\253\252\252\226\021\b\bc\036\023\350\255\217\371\345\273\314\220F\366\226;\245F"
+	.string	"G"
+	.string	"G"
+	.string	"\261[\233#\344%\200\215\0167<\377\261,\3214\354\\\3706G\230o\253Y\370\211\250q\342J\216\020\344\277"
+	.string	"\356\005&\200\341L\017\236\210q\332\306o\265s\342b\374>\013\376\367\2358\020\256\345\266Z\333\006\255C\004V\271\276@$B8\376\017==\236\023i\324X\345\326]m\323\302.6\253\272\202\307q\200\272\241\343\277\210c\031\\\216\006\240?\332\372\265Fy\305\346\024K\b\310]T\036f\374\335HK.\307v\016Y\216\227\tX\016*\035\227\307\303\020\026\201\235\237\004\335\354p\030az=\255W\254\266\033\214\263R\200\346\177I{\30102\\\377\025\274\260\240!Dc\302\261f\261\034Q5)v\264\274\236\314\377\245\314\231\266+=\377\177S\246\3758e\303#\003\250\210D\313TD#\b(Z\312\003\f\331I\004\221\211\204\023\214\302\310d\002&\322H\030\311\201f)(\032\246\222e\032\366\321\335~\3124\256rZ\322\324g\222\325V\260\f\322"
+	.string	"\025(xb\316\024\024#?\231:O\304N\230\021;\235\n# `\202Q\254\312\016\240\242\300\352MB\257\032c\304\330"
+	.ascii	"\007l7\350\007\303\355$\272@\013\260\206\347\374\264wk\031?\255"
+	.ascii	"\016\332\247\220\225\030\333\b\\\264(\234F5\326\2515,\230\276"
+	.ascii	"\006E\254\3576\273\025.,\032\"\274\227\372`\335\254\237D:\327"
+	.ascii	"z\002"
+	.text
+	.section	.gnu.lto_blackboxAdaptivePredictorSelect.4.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375`4\003\225\025"
+	.string	"V%\203I\320\322(\035\212x!G\324\205\232Y=@\350~mD\\13\n\216~v@\220\001\331\2209+ua\244o\233\006o0\003(Y\222\223\307\244\360\305\003\354\231\236&\342\257\301\321\304\244-\r4\315[\373\2374\262\267\224I\006o"
+	.string	"h"
+	.string	"p"
+	.string	"*\223b\317-\202\017\233\240\245n\021\366\372\210\367)\037\300\373\344\022\237\362\245x\365Xv\324wJyS\362\312\364??p4\332n4G\205\020\262\331\357\224B\002G\347\247\317t\236\222.\036\036DH\00577\332z\251\0259\237\037.[7\016\362\325\335\252[m\371@_\034\243\355\226\363=\245t\267\256\355\206sU]Us\250\352\003U^\0054\373f\036UWKWW\027\177\325\203\256\336w\327)W%\257\262\\]^=\200\0055\002\206tw\030\233z\3074J\361\240\177w\241\027\252{D\223\212\273\320\003\251J\277\323\033\262\207 \344~"
+	.ascii	"\351n\222Ou\360}\256\352\214\252JUwU\257\273\317\314E\031\002"
+	.ascii	"\256\256\355L\314\350\026K\024\345\373T\361{\213\347f\002%\237"
+	.ascii	"|\335N\251\266L\227\335\335^\202Ov1Kh\254\331\241\355\270S%\323"
+	.ascii	"\220\335\026d\262d\024\210\"\233\"\027\273[2\216\317\341NGm\231"
+	.ascii	"6\274\b<A\222Q\202\304|\222d\344\362\030\262o\271A\222n\266c"
+	.ascii	"\314\211@\003=\335\215\242\212\3410`\276\356f0D!\303\200\236"
+	.ascii	"\023\237z\031\357\363\234\313\2610\232\355\310\335M\303\214S"
+	.ascii	"\025\003-Gi\314$\004cb-\023X\302\027\t\032\300\225\n1\025\013"
+	.ascii	"+\260\013-*.\260X\b\0033A\240\340\013K\b\213\001\301\020\246"
+	.ascii	"\022\373o\346Y\361k\306\264\243\025\377\347\213\302\207\210n"
+	.ascii	"\266#\212q\312\":\265\230\225R$\367\274\317\343\026\263^\364"
+	.ascii	"\250\331\241\035\364T5\274\r\260@\215\221\234nI\310lG>1N\377"
+	.ascii	"7\363(\213h\272\230\225\226\344\223o\002I\250\201,\205\fDH\231"
+	.ascii	"\231\031MAJ\215\001\200\002\231\262\242\007\021\220\261TfJR("
+	.ascii	"4\007`r\300\243\214O\345\315\266o\347\303\232ed\245\334\237o"
+	.ascii	"\016\2503p\305\265\241)e\3749W<>\204\021\265D;\367\276\302\222"
+	.ascii	"\232\365w\257\331\n\310\265\236\364U\331\202q3f\261\315\257p"
+	.ascii	"N\200\214\2116\023\330\364c\226]\264\037'\260Z\\\030\363\324"
+	.ascii	"g\2531k/\303\345(\203s\347\301\2675\257f\363\216\205\002i\331"
+	.ascii	"^\020\016\001\237WZM\202P\224\216w\353\204!9{\201@<\234\335\350"
+	.ascii	"\314\353\017"
+	.text
+	.section	.gnu.lto_blackboxPredict.5.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375`\323\001\005\020"
+	.string	"f\235fD"
+	.string	"\221(\035\253\324!\371\027_f$\0329\270\006\325!\334I\336A\305\337\224&-\243\030\232\217\202{\272\r\324Ch\"\224V\3734\366\237\031\270+\021\254@#\224\201\037\223\370\235\214\232\355\326\366\367\336R\246\024S"
+	.string	"N"
+	.string	"S"
+	.string	" d\320\354v\037>\3209\264\355\2378\n\024\227^'b\025WT\027dl\354\256\346\361\216x\370. \036j\210\227\016\237f\3117\035n\340j\336c\376jp3\252U\207\353\311B\354h\305F|V(MN\310\356:U+\016w\274m\006\266\025\330I \217\371\007\306\331\2402\207\335\231R[\354\353l6\273ae\261\235\3568\3159\314\037\337\375\360/\377sZ5\235\232\376'\272\314\030P\263\2332\303\2616\360\005\t\333(6"
+	.ascii	"\033\346C\002w\245\027`Q+\030h"
+	.string	"v\367\303\b2\377rb\317n.Q\241\2466\340jR*)\236\260\227\315\213z\345\250\306R\256|)B\275.\340fR&N9\363W\334\303\2247o\305Z0\224\205\337\302\262\316S\\\313\232\361UXvX\214\237\304\303T-\3502\266ew\341a\327t\025\3332\247jO\234kY\013\n\006LD\033\t\0260\021m$\350q\bd\033\225\204H\036\2106\222\203\n\243\021\b!\221\b#\332\004\022\021\tZh\243\240\201\200<\"\2116\255d4\332\264n\377VY\234\254\327\313\353\350i\2744(\307\303*!K\250\252\031l=\371\260;\304\2247\017j\313\035\213\251\035}2\251* \200\002\031\3021\017`E\315\227\013m\247\301\210\255\220Zz\252yC\2331\261\016\243\245\2725\271\005\310\211\374C\0206\330\320\361\256mk\027\216~\331\212N\\\3714\017}\304b2\274\245v\321\234d\215A\r\177\314\231"
+	.ascii	"5\362\270\2071\bT\005\017\215x\312\021a\031\3213d\\\367M\317"
+	.ascii	"\267\313\336\023"
+	.text
+	.section	.gnu.lto_signedVBLength.6.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375`i\001}\016"
+	.string	"V\\bC"
+	.string	"\261&\035\037\n\252\nh(#\t\236\320\355\023g\244\374S\357P}J\260\204\211\212\255\302&\232T\217\236\037A\b@e\232\335\310\376\377\357s\245\323>\004PY\356\352\253(\360:\302ZB\310\336R\246\024M"
+	.string	"L"
+	.string	"N"
+	.string	"\273\253\300\013\256G\333\276\211\247R\\\202\236K\327\031\341rB1c\327\303@\027P=\302\007\250\036\225\304K\207\232%\337\002q"
+	.ascii	"\003\302\005\252\333\016?\\=\035\007A\273\373\230\347Jg\312\264"
+	.ascii	"@v"
+	.string	"\327\211\352<\334\361\266\037\330n`\177&,\376\334\273=\207\371;b\272\023\323\234\230\276`\332\212\351*\246#L\303\230\326\230N\230>\200\252\346E\201\231]\016_\215\275\211,^\356\375v\212\037c\016\333\336\311\265u\270Tp%d\354z\b\036\315 \3630\031\314\331\025Q\263\"\252\225Z2P#\324\0016\247TGSU\241\215\206\020\\~\276\246\376tC%?\373\273\306\030\247\024\227\037\204\332\222\271\273\233~?\251<\352\261\341\345D\013S\322\360\225\035jW(\311\243<\352\221\202\346\306\244\233\355m\251-\366\341\356\2565\"!\024\021\022J5\2620\022\272\020-\372\3202\023\021)\302H#\201\200!\013\221 \n\215\204`\024H\241\t\230H+\301>\0168#\031i\230I\226i\030\207\267\207\253,NMp\205\221y\323T\035]\261\375Q\220\212r\346\350\347\322J9J\300\206\245\227\245\006d\242\006\032"
+	.string	"`\325\243Z\350\253Wp<\t\007c\240\332"
+	.string	"\020\002\006\007c\236\332\300\251,\307\264C\352\350F(\2225\212\210"
+	.ascii	"\327\230\360\270F\225=\302\360L\220\212\"V\250\321\212\2379\""
+	.ascii	"5NQ5\266\253\224\001"
+	.text
+	.section	.gnu.lto_blackboxWriteArrayUsingAdaptivePredictor.7.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375`T\bu+"
+	.string	"\032N\240\020Dp\234J:\003\265\266@\026}\252KUp\235\024\201\240\026%\373\211\335X\222\031\264 \240\371vD\270\320\355o\257.\254c\355\300\340#\235g3\244Ps\007\356\377\253_\336\337\210z\021-6B\b!r\247\024\371"
+	.string	"\330"
+	.string	""
+	.ascii	"\001\217r\274\026\277s0LLp\212O\345v\277\342\240\025$WU\262\216"
+	.ascii	"\210=)QG\233\232\020\255\313\212\022&\211\024z(>\235\203\226"
+	.ascii	"\342;\224\013\f\235\203;\322\227\246)\323K{p\013;\370\362A\333"
+	.ascii	"+\367\271\255;\361\035\331\223\022\321\224PI\323\264\311\032"
+	.ascii	"\320\227G\344}\314&q=20\221s\241\276\271"
+	.string	"\230b\341\325\276\222/\331\272\333\213\240\236\224\bWF%M\337\232\034\205\276\364\333\177\314\227\350}\314\227\336\262\371\376\226\226\036.H\214\2707i\232:-\017\237\307\343\361x\362\355>\353\326\321\323,\311\255[\376\223#\225\345\031\303\270\216\222'\f\032A\016\006\354\006\031\025\247\317\356t\257_a^\365\034\"v\023l,\257\304;\311fl\316\030f\343$Q'\254h\376\370\270\373\001c\367t_\"\2333\206\211\275\236\025\3224u5\206\325\270\201\267]\304\266\226\215\016\005'P \276\213\375\027\216\256U\260\273/\022\2517\027\363[\367\3055\257z4\322~\177\345\245\031Y]\214\277\256z\334\235\303\002\243\306.\232\375\346U\037\225\026g\317\273c\302VK\330\352\b[\r!j\253\241\320\352\007h\365\323\335\376\006hu\323\337~\246\327\335K\257r+\275\311\277\340V\356\2443\371\025\334\311\237\340Rn\244\255F"
+	.string	"\254>\332j\243\263\372\300V\027\235\325D[=tV\013\241\325\006\320\352\240\255\006\332\352\002g\365\017ZM"
+	.string	"\255\366\331\352\001[-\340\254\356A\253\003\240\325"
+	.string	"\266\232g\253w\316\352`\255\326\331j\340V\243g\365Y\253\315\255.\317j\262V\257Y]\315\352S8m|\021:\246)\215\343\234T\257\264\023\362\272\277\312o\345\227r\322\276\003\307\363\347\330\346;\335\2154\345\272\231}9hZ\n\306\347jL\275\306\324\322\263T\351x\327\221\033\323#\326?\333\036\016G\212\301\336\343\216\026\350v`\215\264\016\254\220\027\242-\332\222\216h\207\316\b\355\220\320\336FY\235\201e\263\346\301\006\255\2015\375\316\345i\372\202\200\036,m\201\005\332\363\356g\013\374\254\331Fv$\260f\312<\255\317\022\330\323K\323\307\354\371\fxRZ\001;`\3176=+\240gM;27_8\002\254\23007\252iZ"
+	.string	"\033`\3156\f\376\345\003Q\224\035\342zSPy[9\204?i/\314\227"
+	.string	"\226\250\207\035O\345Y\233DU\275\261i\217\210\313\345\244\335Y\236=\351\202\273c\"\310\264:k\036!CS$\362-\007\356R[\322\242\013\334\033!\313+\232\241[\256\322V\277\242\332\271\350~x.Xs\317\273;3i\313\275\032\031\226\342\032\271I[\375\354k\321\n+\262\254\252XP\r\257P*\025U\030\260J\220\250\232\032b\255\330\241\"15\244b1uV\035KE\226\225\260t\360\304\202jxU\016\207YB\022ha\203\241\025\226\260j\004\325\360*\204\226\225\210\023\302)\024\"\234TTM\245p\022\016W85P\262\325\025\325\320\t\313\312j\350\024|\353\372\356\260\237\034\235\023\323\353Z\257>t\321\f\304aF\355\222\251LG\332\257\004\213\264Bd\204\201\353B\254qN\236\213\346z\306\346VJ\330\357\261\315 !"
+	.ascii	"\317\206\360\255\321N\330/\244\215\332\323\275\254A6W4\003\252"
+	.ascii	"\b\326\326\300\241\336\350\t;\264\b\310\265\262\272\242\332\337"
+	.ascii	"]a\314\214\260\022\226\214+\266\031m\321FX\020cyE39\257rlze\321"
+	.ascii	"B-\204\335\273\242Z\007\323h\241v\303\330\\q\255\353G\\\325\317"
+	.ascii	"\027S\003\204\215\\4<W/W\242\371\320_\312\254]4\324\322\263\243"
+	.ascii	"kj\276\313e\271\224\371W\215\001\200\236\250Q@\246\230Q\306\206"
+	.ascii	"d\244 )(f\r\260\002\021\252\242\266\001\021\200\255DE3\232\222"
+	.ascii	"Bik\fi\214@\230\016\266\017\265\373Z\265\207\022[\373\240Z\324"
+	.ascii	"\t\242\355\317f\262\241H\013\to\351pNy\322\240\021\227\003<\354"
+	.ascii	"\030\275\235\340~\221\032\022\331Ke\233\017{\024B\324\3375\013"
+	.ascii	")w\231\340\200\262\374&\001\024 H\035X\207$\376\316\245\235\361"
+	.ascii	"\r=\033\330:\035\364\036\305\240\202a\013i\2513K\023\244\237"
+	.ascii	"!\244\303\321 \253\256\263\222d8\252\251\202=\345\345\322\204"
+	.ascii	"\230J\te\\\260\022\374e\313\307\307\021\311\0332\240\376\364"
+	.ascii	"Q\177\003\002\251\374gF\021hp\357\201+w\037\222\007\332\023\265"
+	.ascii	"\247\020\270\307\213g\264o\242\260)\002\300]*\240|\375X\227\337"
+	.ascii	"\256\254\003\200\243<\026\034\250c\"\346HY\260d\237\375b\231"
+	.ascii	"Q\"\005;\330`\215\f\375 \274\325>\262\327\2453P+\017\031\235"
+	.ascii	"3\271\251\b\356\217\253\207qww\320\347\371\272+b4Vg*\320\351"
+	.ascii	"f\351%a\360\320\375\220\006 <\356jp\003\234\372\2651Y\200E\212"
+	.ascii	"u\277\246\207\020i\323 \266\342\255\363\227\2503/*"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375 \353=\004"
+	.string	"R\006\030\"\220+\035\033Lr\210\310\210v\333\345O\210z\223x\370\377\377W\247\333(\376$PY\3246\221r\313\024=,\036\n/\272@\371@\354(\026\206\243x\tC\247gp\300\376\267\210\025Y`\212\310&\003\031pk-M\301\016\301\230\332\246\374\304\006>\365\314KZ\267\225\206\341\377?V\251m1\001\017"
+	.ascii	"@\024P0W\251?\004\303\247H\211\231\376\024\f\317\257D\266d \f"
+	.ascii	"@\370\316\357\200\030\bG\0073\017"
+	.text
+	.section	.gnu.lto_.refs.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b99517631924b88e,"e",@progbits
+	.string	"(\265/\375`\357\t]4"
+	.string	"\332["
+	.string	"\024F`^R\007s\223\tm\030\244\0346\330\272\027Q\370\263\213\021h\313\205\231m\0378L!\353\372R\215\264\275>r"
+	.string	"\257\251\004QKQ\226\202\246+!\314tDX\263T\233\24344\320\037\347\373\221\322\315\246\2642\245\016\001(\0010\001\005\250\376\235O\210\304\250P\2213\367\377\0325h"
+	.string	"$W\225#J\315\216\026\304REIqn\247\325\317:\213\271?\273vG\233\031\316\215b\365\367\"UH\303\332n\245\333\245x\230\227a\367\037\371\377\0020\331\243\315\341\354d>\305\241>\257\322\036\305\337\356A\276\377\374\177\203z\336\246?\2408\267\205\265\235J\017h\237B\363\326v\237\032\344>\325\307~\355O\"u\331|?hw\246&U\007g\214\327\236\023\251\b\274H\315R/\202\322\355_\016\346\333%\253\334\207\376\277C?toG'8\367\353E\352\352Dj\267\253A}\242\333\201\214\272\361\256\273\315\374\270O\267\257=\335\216\226\273}j\326\335\013"
+	.ascii	"t\273\231\356N\323\322\335ek\267\273u;\257\333w\335\356\335M"
+	.ascii	"\327\335\323\356f\323\335p\335\335\326\335U\272[\255\273Gt\267"
+	.ascii	"\230\356F\353n0\335\315\245\273\327\272\033\254\273\207\272\333"
+	.ascii	"Kw\253uuuu\335>\242\033'\350\346\251\b\3772\205\222\320\226\365"
+	.ascii	"\344\323\311L>]\346\320#\237\375g+dE\272\314\344\027\227)\224"
+	.ascii	"|\266\314$\322\311\034\002\262E\204\215\312\215\363\313\321\222"
+	.ascii	"\310\267Rf\265K!i\362u\037\356\337\241R\277T\360\237\345.\341"
+	.ascii	"Z\036~v\224Z\035\257\264\256\277\377\177\244<j\271\217\224&\231"
+	.ascii	"\270\377L\216O\257\234\300\276\322\347r)\273\225\365UR\377\003"
+	.ascii	"\376\375W\376\263\376\322\377g\377\237\267\314z\377{\b%\273\224"
+	.ascii	"\312\377\246\221\362\263X4\251\177\fEs\306L>\265\334\037\332"
+	.ascii	"\224g\327O\275\254w=\234s\271>Y)_5]\273\2308\334\340\354R\017"
+	.ascii	"\343\320\216\272\030\347Zc\271\242\253\f^G\335\300xt\b\224\033"
+	.ascii	"8;\233{q\350\221\177i\037\363\266\346i\337\367\005\2323\346J"
+	.ascii	"\016\316B\216e\255\361\357G\252\327\325\371Q\2273\23616\257\026"
+	.ascii	"s\361\265\036\224\247\22138\253\031a\254\256;r8\267'Y\265\370"
+	.ascii	"\026\207z\324\257\264c\361,\235\337\177\244\204\356_\324\305"
+	.ascii	"\334\212K\241\031\f\213\334\377\267\207u\377<\352f\236\026kf"
+	.ascii	"8\373\235\265\353\312\353\013g\267\323\363c\216\254\r\316^\307"
+	.ascii	"\335x_l\270@;\232u\240}\265\341\334;*8p\234\016\277\373\337\305"
+	.ascii	"\233\242eC\356\233Y\276\036\2170\253\351\\;\335\030\234$\352"
+	.ascii	"\013\t\316.\307\323~\342\326\246\266p\3668>\346\352u#G\327\246"
+	.ascii	"\333\370\324\233\027\330\342v?\332W\272i\237zZO\215\264u\353"
+	.ascii	"\202\006\215\263\021\372\243\032/r\337l\372xq\316\260#k\332\331"
+	.ascii	"\364\032\001uv\3348)'\035\23185\352\2345tbj>V\346\236a8\247\361"
+	.ascii	"+;i\233\224\267\257\265\235\214\227i\177\203\372\233\303\255"
+	.ascii	"\357_\001\320*\202\2256\367\315\245\317\341\272#P\360\262\336"
+	.ascii	"?\330\377\027\360\301\001f\304\016\316\r\307\307tw\217z\206\211"
+	.ascii	"\220)\234\033\267k\343n\365\333\345\377c\361\274\277<"
+	.string	"\366\332y\334}\335?\276s\005\277;@\346?\310\326\233u\211Y\353\003\347\356F\360\335\335\356\344\237\035\372\367\227\311\247\223M\222\211a\016\275/D\300?\267>\371:\231\331}\374\357\373#\235\314\027\311\327]&_\227\025z\244\313~,\210D\rK<\"\212\372\351\201\323P\030D\032\022[\264 \002\r\004\233\210\300!\007'&\032NB\032=\247\241\020\212\304\f\246b1C\320(,\232\360\005\2118`\024\016=\030h\340\223\321i\030\374\240\241DSp\350$\204\002j\240\260\030\034\006\235\326\236\220\344 \251\202\f^WP\202\240\004A\355\nJ\277\237R\322o\355\244\337.\351g\034\ny\306~b\320D\027\301\"\222\221H,\"\371\004\211\232\202F`\220E\020j\205Z\n\021\214!4\272`j\312@\300\270\024A\202q(\204\261\366\357\267\001\001\t\020\035V\340\203\"\321\b\0246\005\213.\226d\020S\254"
+	.string	"2\261H\2014\0242\265@\002\026\241\220\036\370\214PD`^\342\251\235\234\2654\251\267\207\246\314\r\016\266\202k\333\301\206\2053\256\302\370\006V6\256\3026z\310\027W\345\377\326=\001\220{\002\236\350\221vL\315\235\263\3267@\263\211\025\316QQx\312\310\335\251\371\n\242fa\310\233\251T\343)/\373\246\221]\333\212\217\370\350p.\366W\023\274|\334\231\373o\372\224\314X\231*\241C\007\263\030\306\220"
+	.string	"\360\242:.\301\337\230]\343\272\270x\340\354u\036\327\343\222\026\200\272\250\301,\245\224C\"3#\"\222$I:\200\002\021\261\263:\022\300F1n\211\215\210L\220\024\224\244\260l\007\302G\274\243_?@\\\254\303\227\363\330\240|\026\351\347lE\201\241vA\356W\247-\264\2046T\236(\302@r\231\207\303\340F@ZH3\261!Wk\236F\350~\336+"
+	.string	"\253\244\264>\025\242\263.\364\225v\022\225{w[a\215\f0\233r\253\0020\006"
+	.ascii	"\300\331\230F\006=\262EeN/I*\264L\236\303\354K\301\233G\300\210"
+	.ascii	"\354\246\3068M\205\321\032\347y*\032\3365\360\215~\026#\260A"
+	.ascii	"\031\271\327\242. \001\263Z\226g\370\345(*\201%\327\004\352f"
+	.ascii	"\355c\265\376egp\233\376\250~\202\006Lo\235KO\257Q5\r\326\324"
+	.ascii	"O7H\204h\370\224_\2315_\251\200$i\004F8\241\370\033]j$bMB\227"
+	.ascii	"<\240@\313xM\004\260Z\342\324Lw*Z\335\"\220\352\242\272pU\314"
+	.ascii	"\b$n&\306\311\013\200P{\352\276\252\345\276NW;\212\002\353\274"
+	.ascii	"\310,\322\344\200\224 \355\261\032S~@\377\2019\003}B\244\021"
+	.ascii	"\354\245Rt\002\035jQ\220\307gR\200\215,\271\004\351\272\342\""
+	.ascii	"\277\315\264\021\311\001\313\375\005\317\007\337\320\303|_^\344"
+	.ascii	"\335PS\363\230\347\033\271\231\312O\324\2067\373\321\177\340"
+	.ascii	"\r_\3627\341\223=I\336\353_\337B\304i_\f\017\376\376\236T(\207"
+	.ascii	"xU\001"
+	.text
+	.section	.gnu.lto_.symtab.b99517631924b88e,"e",@progbits
+	.string	"blackboxAdaptivePredictorInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357"
+	.string	""
+	.string	""
+	.string	"blackboxAdaptivePredictorSelect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"blackboxPredict"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"blackboxWriteArrayUsingAdaptivePredictor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b99517631924b88e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,185 @@
+	.file	"build_config.c"
+	.section	.gnu.lto_.profile.210073913b76c3fc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.210073913b76c3fc,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\222\252\354\340\007"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.210073913b76c3fc,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.210073913b76c3fc,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.210073913b76c3fc,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.210073913b76c3fc,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.210073913b76c3fc,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.210073913b76c3fc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getMcuTypeId.3.210073913b76c3fc,"e",@progbits
+	.string	"(\265/\375 \331=\006"
+	.string	"\324\nx"
+	.string	""
+	.string	""
+	.string	"."
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\303\255\234\002\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\330:\221\250\300\004\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\317\025\307\207\236\003\002"
+	.string	""
+	.string	"\244\003"
+	.string	"\200\200\200\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	" ./src/main/build_config.c"
+	.string	"\t"
+	.ascii	"\245\214\223\031\020\f\037\025\026\253\200\350\232\227\205 \302"
+	.ascii	"]y\265\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.210073913b76c3fc,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.210073913b76c3fc,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.210073913b76c3fc,"e",@progbits
+	.string	"(\265/\375`\f\002M\023"
+	.string	"\006\246\206K\320\3208\035\020\313?@,\275@\237\240\034)4$fn\265H4\241B\021\343N\024\307\263\244\336\302\364\272\254H[\362_a\256\230\321^O<\200\200E\241*\244N\243\363q\334\247L\364\271\311\352)\031t\361\252 \205H\237H\031j"
+	.string	"l"
+	.string	"n"
+	.ascii	"\226\347\374y"
+	.string	"b\026\376\223zq7\321\270\252C\273l\346/\360\373\317\376\332\307\375\257\377?J\332\375C\230lm6\373q\006\314N\253+f\376\216H\206\221i\323\234S\\1\224\326Nsk[\331\371\332\217\320\022Lk\320e\377\333\006X3=\324\350<!\346\346\300\3147fnfn\301\314].\227\3131\363\211\231?0w*\0015)j\376\266\233\247:\017\237\242?y\276\033\177o\232N\242&xG\032\366\236e\370;\226'\317\332GKK4\326\320\246h\r\355E\315\223\257mI\333-y\232a\317EK\233\216\246\311\246\250Y\273\301x\201\300\222\267\231\321\306\322\204\263\367\374\321\337D3/I~\332Y\036\2157m\024\303\331\304T\214g\337\377\004f\261\234\363$.C\245\337\347\277\001\217\307\006\311:\257\205Db\030\315(\321y,\001\354\333A\r\324)s\333:\005{\266\363\351\177CH#\b\027E\235w\352"
+	.string	"\237\327"
+	.string	">n\3247\322\250\217Q\360\205\361G\341\023\220\023\200\314\375},\377w\360\270/c\245\257=\272Q\314!Mj\022f\366N\342\221\373\332s\003\334)\032Et\336\031\346\037\315\337\227a\030|\342\027L\013\226\212y\275`)\220\326\212\013\b\213\"\203S\204\007* \253\244\305U\341\345\305Za\301\340\222\241\220zqMpI\261`\031R%\007X\032\264`6@\220a9\210i\265\224\230\345\202\265^Z- \237\250\024\250R4|p\312\312de\362q\312J\024W*\021d\225Hb\356\023\355\303\375\323@\375\32376\375\217\375$F\b\2509n;:\216CC\211\320\354`Q\203\203\373\306\274"
+	.string	"\245\003\034"
+	.string	"Dh\225U\3442\251\211o,\\\\s\207QD\263\242\275\245\227\315:Sb(\\)\315EIQ3\322"
+	.ascii	"E\005\201g!Z\343hkXj\r\247` \251i\214\320CE-\331\241\273\227"
+	.ascii	"\302\346\2466\256=W\314t\306['\031"
+	.text
+	.section	.gnu.lto_.symtab.210073913b76c3fc,"e",@progbits
+	.string	"getMcuTypeId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.210073913b76c3fc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
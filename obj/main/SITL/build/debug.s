@@ -0,0 +1,242 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.1b322af80863cc2d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1b322af80863cc2d,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\242\375\331\303\002\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.1b322af80863cc2d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.1b322af80863cc2d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1b322af80863cc2d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.1b322af80863cc2d,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.1b322af80863cc2d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.1b322af80863cc2d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.6.1b322af80863cc2d,"e",@progbits
+	.string	"(\265/\375`\312\n\3655"
+	.string	"\252b\200\02560li\016\0030l\266\375\2766\022\006a\254`\225z\205P\200v\013"
+	.string	"C\005"
+	.ascii	"\030b\2737%6\322\245\300\320\267\355n\351\317;\n@g\327\367\333"
+	.ascii	"\252\251\331\224dJ\001W\001H\001T\204>\350\335\322\244=S\210"
+	.ascii	"b\234\343\210\334:\344q\253\222\366\\\341\235\3209\242\255F\332"
+	.ascii	"\263\205%\245'r\355\264g\215\244\364D/\035\355\371\302\321X\347"
+	.ascii	"\212\\<\344q\213\214\366\214a\210Q\217+\342C\036\267\244h\317"
+	.ascii	"\031\036H\351w\256I\036\267\212h\317\032f\235~\367\246\221\307"
+	.ascii	"\227\245=o\200\245\303\361>\224\366\314\241\025\352xk\344\361"
+	.ascii	"\365\264g2UB\317S\311\343\033\322\236\313N\311y\336\003\322\236"
+	.ascii	";\220bs\275\225<\276\207Pq\256\367h\264\347\017\236\212\376\310"
+	.ascii	"u\265g\020\233\212\376\350m#\217\177\324\236\3150\275\371$\267"
+	.ascii	"\005y\364O\332\363Y%\027>\351m\311\243\337i\317!&\275\360=7\006"
+	.ascii	"yt9\332\263\bHp\276\367\316 \217\316F{\036\241G\303)\2715\310"
+	.ascii	"\243S\321\236I8\212sJ\257\022\355\271\304\2428\257\204\203<z"
+	.ascii	"\020\355\331D\"\035^\351\315\241=\2370\244\3035\271<"
+	.string	"\310c\253=\243\030D\347\232\336\255=\247\260\233\363Mi\332\263\n?r\276\351\365A\036W\364\3313\347\234\334\037\344\361\314\217\027\370y\306\216\207\256K\213'V]d\001\001r\364$\236\215\344\361\265g\274E\005c\022C_\347\355\374\235\307\363z~\317\367y?\017\350\355^\320\017\372Bo\350\021}\242\277\373E\337\350\035}\336\353\375\373\220^\322OzJ_\351/=\246\327\364\233\276\323\331\177zP/\352G}\2517\365\250>\325\257zV\357\352_},\263\237\005\302\030\007\301\" G\204\250\300/\013\316\202\013\340\t\2549\013/\200ouj\367\267\245\212M\277\276Sl\033\334_&un\370\345i\317\277Pt\034\334\037!\355\031\200\247\"\207\367GGs\232#K\243=se\022\222\375\272h\317]\226\346\312~S\264g\257=\271\262\367\307D{\376\212d\2543sgi\317`\217\214uf\357(\3559"
+	.ascii	"^\334Y\030#\343\234\2637S\322\236\305\024\305\205p\361\264\347"
+	.ascii	"\261Cq!^\001\204J\021n\036\355y@\240R\304\233\t\374\211;\341"
+	.ascii	"f1\332s\001>l'\336LE{6\220\307X\207\302\315\007\352\214u(|\b"
+	.ascii	"\350\024S\3702i\317\t\342\300\245x\367\264g\005n\344T\270>=\355"
+	.ascii	"y\301\032:\025\276B\3323\203G\203\272\235\353k\360e\342\334\316"
+	.ascii	"\347@L\351\201|Z\264\347\007\377E\207\007z}\020\236\013\234\013"
+	.ascii	"r}\021\262\030\353\\\320\273J{\226\340\032\347\370 S\332\363"
+	.ascii	"\204\017ii\266iY\004\216\341u\253{\237\255\220\270[VU[\201c\230"
+	.ascii	"Xd\200w\0331\001\036\266\251\300v5QvE\331\222]\333\265\341\272"
+	.ascii	"M\005X\335%Z\306@\224\330\236)\313\252[\215m\317\242\271\236"
+	.ascii	"\273]\211i\b\360\231\002\321v\370\006\344\302,*D\3236\030\344"
+	.ascii	"\302\300\223-S\225\270Ov\210\266\301\240\030f\213D\266\250\266"
+	.ascii	"n*\332\232Y\246hb\370L\211\302rM\033\242B\224m\335v\027\016\022"
+	.ascii	"\323\026\370\303Da\271\331\326\215e\321\205c\220\315\220\203"
+	.ascii	"\001'\243L\206\r\032r0\312n\320x\021W\026c\007\2172\262\004\030"
+	.ascii	"G\016"
+	.string	"\270\035e=p\340\330Q\346\205\207*\272\026\203\255\272\337\322\276\260\347q=\316\307\373\370\037\007\344\201\\\220\023\362B~\310\021\271\"\277sF\336\310\361<\317\037\371\353\221\\\222\3579%\267\344\227<\223krN\336\311?9(\027\345\243\274\224\233rT\236\312W9+w\345\257<\226\313rZ^\353\203\274\220'\362E\336\310\037\371$\257\344\231|\223\177\362P^\312O\371*o\345\257<\226\327\362[\276\313{y0\037\346\307<\2317\363g>\315\253y6\337\346\337<\234\227\363s\002\370\034\252\303|\246\346\233\331\205\337\366\311\262%\032\211\201g\200S\250\3563=M\242\252\246@\224H~\231{\354L\323\206e\027\366\302\373L\213\300S\315\\\273\360\232Y\262\353\017\013\211\233(d[s=\303\360\t,\262(\233\226\\\230\r\006}\370\024\242,\333\271\203-\033\fr\275\255\255;\270\256jA0.\334V\356"
+	.string	"8\030D\201a8\f\257\231jj\20683\023\341V\n\307\360ZD[3f\267J\f\376\360WZ\026\331\332}\002\207h\360L\033\226\233"
+	.string	"\016\262\355.\201h\312\205\323rh\002\203\352\271V\262\355[\331V\016\213[l\315x\253\353\360\\[vx\356]4\3030\332Z\364a\025\005\026Kv\227\302\325\013\253\261\333\207\335\312\364\334\255p\237,\372\205\3679D\313\315\266\3526K0\f\206\327UM\333\264\034\246\241a\370d\313\335\246\rQ5VU\205kkn\001\370\215EY\224;\255E\331a\t\206\203\304\224\304(qm\205\305\315\256\235\304\265u\333b\370m\263\247\360LO\226"
+	.string	"\336'\233\242A/<D\205-\360\207\207*\312\232\347\336\252\331\232e"
+	.string	"l\226\001\200\274\250A(\203\254\226D,))H\222,c\260\")\032*\017\021\300\220\202\215\240\326\236\001j#t\202\005\223i5\024\250E\017.zAP[\262\016<\031/\227\357\036\331qg\231Uff\364\375X\027\376\256v(\202\237a\300Ey\327\021@)\245;m\334\35495\205\375\021\232\321\023\256S\r\\\262\277?t65\325 \002\267\004\256\307\"\0249\265\244\030{\267Rx7\201\370T\307\246\252\222\222PFG\302\243\233JV\234\216\026]\327\367@\240;\303f\211\230\372b\204\016P\037\030\200\322S\037\310i\275\321\2655\034\203\235\255\002'\212\001\002H\315\364\024\222\265\021_\030c\373\023~\006\276"
+	.ascii	"\221j=S\266\350^r\346>\377\326\333\331\234\363\002\377\026\301"
+	.ascii	"!\033x\214HP\315\234q\315\353\212\333yc\305\331E\302\302\331"
+	.ascii	"\245\206\320\0058\235\303}\352\353a\261K\277}\314\263_\316P\333"
+	.ascii	"H\244\022*\024M\"\211:\232\316=\320!\221A'\313R\327\323_\300"
+	.ascii	"l\035\221\201\0012e\230\214\362n\256R\250pl\002h\331S\235\336"
+	.ascii	"\277\314\334\214\253\277z\374\215\024d\034I\345\034N\240\031"
+	.ascii	"\236\005\017]\202\216\b/\237\311CS\271H\353\257t\226\004\243"
+	.ascii	"\307\245CQP\231+\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1b322af80863cc2d,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	"\201\204\001\005\001\004\002\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.1b322af80863cc2d,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1b322af80863cc2d,"e",@progbits
+	.string	"(\265/\375`f\n\2552"
+	.string	"\212^\244\023B`^N:\177\243geLb\\\023j\364!;\362\257\366\021{#\217\237\343\220\364x\310\331\216\262\343\235\201\323\372\206\026\216\264Q\323FIh\360@\267\270#\203(\223\024*&\035\364\254\264'o$S\n\364"
+	.string	".\0012\001\324o\263\217v/\037\023<\326*Uk5 \304\222\365%\267\324\376\230+\211\210\305cR\200\360\354\nlJ\022\355\007g(\013\326\322\257]\214\317\3660f\322`\"\037j\025\255\326z\266\f\307Z\243\316&<Tk\224\360\177\360?\240]\272\306\332Lj\f\276'O\037\214\375\264\253%\231F\255dU\326Z\2054MW\025\336R'?4}iO2\375/.\240V5X\200\357A\375\320\244\306'\231^\237m2\366M\330/a\237\204\375\021\366C\330\007a\377\203}\017\366;\330\347`_\203\375\f\366\227\354[\260_\301>\005\373\021\354C\260\357\300~\003\373\b\354+\331/`\177h?\200}\241\375\240}\240}\323~\221\375\265\177\333{\266\365l\343\331&d\033\220\355?\266%\330Ob\233\217\355:\266\345\330v\263Mm\307\331\336\345r\271\264\235\264me\037\021\005\201"
+	.ascii	"\371\262\246\322\222,\365\001\331\267\373\237\263\265\250U\n"
+	.ascii	"\300\0222\257\271\017\315`\237\323\367S\224$\216Kl)\360Iu\310"
+	.ascii	"\327\235\317\005\324\352uf\345h\016\234\227\024\237=?\326\252"
+	.ascii	"D\262Z\343\262\265\364v~\347H\245\343\361\363\\\217\213\242\222"
+	.ascii	"5y@Q~P-\r\360\241\271/\372z\324z%\363\313\345\225L\037\210\234"
+	.ascii	"\315\244\341\310\313\275\316\001\017dhv\325\350\246\202Y7&\350"
+	.ascii	"l\351\347N\347\310\005\247\003\260g\266gh\251{\370\374\005\346"
+	.ascii	"\227_`\032\312g\377\r\371\267\313\371\021i\031\322\256\032\265"
+	.ascii	"*\250@N}-\365\345\3307\3633\217\263\233WL\333[\352\307\261\257"
+	.ascii	"\346k\036\267\307Z\335\314-k\260\220-=\233\2679r\302\335\370"
+	.ascii	"o\016\307?\251d\rSkR\370\263\023\210\211r\251\003\032>\177\202"
+	.ascii	")\374\004\363\001\236d\036\315\351\247\361 \346\325e)\321\223"
+	.ascii	"L\246\323\2073\271\250\341\312[\272\016V\370|\263\377\f\371\263"
+	.ascii	"\273\375\210\265V\235Y\305+\177\360\252qI\005\237"
+	.string	"\024\025,32A&\205\340\024\223@-b\231/\033]\353\2054\247E\213\235\245'~h\nPsz\237\034\275\331\235\035\341\332\343\241;\274\274\245\336\243\275M\326\tP\b\035\336\325\322+Xrz\231\030\205qy\021[\232@\311\026=\036\235\334Y\352\335\262\267j\223\320E\205\205-\375\0169\275Z\3014Ujm\220d\355)\326\275-\365f\331{\265XK\245HX\333\322#\250:\275V?3gr^K\225\226j\215w\304\304\031\263\324k\264_h\217\274\311Y\003[:\341\315\3515\3425\350\bY\221\342\366\351Bsh\251\267h\357\220%b\3446\347\207j\351\017<\311\\\342\351\025\342;j\331\322\265\324\300\006\001R\224F\034\324\266\324\013\304\376\335N\235\255E0\f\313J\371\241\371\264\323+%\254cFP\225\375\261Qv\300\276\314Y\352\215r\3739\271RBwz}\230{yD\224K\205\313="
+	.string	"\202\364t\005Y\352\357\331?t=\242\324\223\262\245\027>4\315B\247o\210\b\017\025\034\326\322\242<<\340\2241\316\324R\037\317\376\240\0232\227cw\305\245>\363\241ytw\372\202\200RWmU\226\376\002P,6\234P7\234\214\212\240Xp0\372A\261`\302"
+	.ascii	"u\303i\207OG\223\r\247\0247\236\234\240`4\351\bZ\311O8\232r,"
+	.ascii	"A==\345X\002\346p1\003\006\365y\212p\240\002E\t\037"
+	.string	"\f\013K1j8\355x\261t\303\311\205\215%\0309t,Y8\240\243\311\206\013\024M1\236N\310\330\361\242)\006\322\030\345\026\327\327\220U:\314[\2240;61]\306<+\306\336\272k\301\2707u\360\244\234\3360\313e\032)`\324\326\326\256\030\227z\325\354Mn\032\222\02355\255\2457~h\016\350:\275H$*\263\265\266/^\300\326\332\260\226z\275\330\013e\321x,\365\b-5\036\273\323{6\207\215\035\262\213\031\013\252+k\306\326B\217\n\021\271\245\273\345\364raPf\r\334R#-Y\220\360l\225\335-\365f\261\027\313\226!\301\371jcd\351\217\037\232\004\256\234^2 \2318\275\261\245IV\306\322\216X\225-\365\216\331\357\263U\230\212R\240,\265\233A\247\227\n\027\242\241.S\304\202u\016\214n\251W\314^)\033\266E%Z~\226\332\356C\023\t\312\351\215\262c\312\270\270\245"
+	.string	"\300\276\350\274\320\324-\365~\331\033\200\267\25018E\024$\214\013Dd\244\240 \311r\240\"\021+\"7\021\200\235\222D\3202\262u\003el\336,\352\2354\333R\031\364\017\253\036\243\002\204\307\307\033\243\b\312\302\301\230hp\f\265\360 ^:C\004M\212\276\265`\266D<\022)`4\214\303\022c\315\235-5\340\t\b\037\025.|\362\227\206@ P\353/\0045\357D\304\330\261\330\321$4\222\333\341d\202\373)\255\260_:\275!\215\017\203A\343`\374J\261\203o\321A\3604-`\353%\332\241,\177\006K\213\221\365r~W\362QD\002\340\261\274\nbY\327v\0018N\216?ChE\\\035L%\001\017U\021\314xNLhF\2606f\261l\016;\222\0329\216*&\242\251"
+	.string	"\320$\005\262I$\357\261\346v\270\276\003\317\320!\004\303r\344\315n\2449\200\202\340"
+	.string	"\243m\347\341"
+	.string	"\256\204\274\207n\344^B+k/Q\216r\006<\221V\331\327\235\336\310\264\3430\223m\330\366\013\204\002\221*\210\221g\331\213:#\307a\346.\007f\375qS\222\3103\217\211\315\213?\035V\0373eR_4#\227\\\216\025\375\003~\320\263\242g.|(\2079\032\341\001\005\375x\200x(K\354\323\005\375\223[\311\226\232\177\311\003"
+	.ascii	"u\373*_1\272\250\026'\240\n"
+	.text
+	.section	.gnu.lto_.symtab.1b322af80863cc2d,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"sectionTimes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1b322af80863cc2d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
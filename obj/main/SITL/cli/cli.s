@@ -0,0 +1,8511 @@
+	.file	"cli.c"
+	.section	.gnu.lto_.profile.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001F"
+	.text
+	.section	.gnu.lto_.icf.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`K\016\325="
+	.string	"*]T\025: \244Nc\221\303\334\246zS("
+	.string	"\244\022\233"
+	.string	"&\"\300Of\232\325t%r\356\261\267\340\013\030\2049"
+	.string	"?\203\372\273\360?\203\260\t\246\367\270\263\332\355F\2336{6IR\006I\001J\001B\001\032t\334V\306J\230AC\3714\212Q\303\240\345*\334\036E\027d\312\276\2633\013\237\373\004\361(+\300\207\367\237`\2064w\207\020\005\330\255\223\347\2655a~\037&\350'\215\204\375\371_\006\232a\003\023A_\273\247g\021\202V\022\270\030\347\201\322\225\336\027\222w\f\035hg\333\340\233\244\224N\322*[kl\240\227\214\213p\211\f\224\256\344>\021\035\331\036-\210r\312\027\324\326HF\201\276\343V\036\310\004.\2369;Y\004MCwo\217\240\016D\037\375\223d\333t=\271v\213\020\265\fP\237\225|o\304\b\0048\200\317\177\235\214\r\3065\351=g\357\320n\252\343\260\300\271C&\351R\363\nX\346q\200|\371g\236a\024\311E\300\347H3\224wJ\320\353\3031e\233\3426*\003V\365\002\005"
+	.ascii	"0\3033\226\354\317\232\f+\302cH\007\275\nsK|\352f\226\3305\320"
+	.ascii	"\031?\377\374w\2275m^S\277\212]UJ\330\235\364\313\202\306|\341"
+	.ascii	"AH9\307$\347\335\177\231\323\n\272\361\343\377\205\274\302\304"
+	.ascii	"-\233o\376Is\264m}0\363Mr\233\226\203W\352\334\355\345\227\337"
+	.ascii	"\377\367\365\243\316I@E5z\233\351y*Ic\254\225[?d2x\bE\362\201"
+	.ascii	"\3411\206\307\027\232\270\025\n\366\320\327:2#\343\241gm\341"
+	.ascii	"\363\251\333\313!\272B;(T8\205\353\t\227\360'(\341\237WVG\204"
+	.ascii	"\b\217\017\341\361\037\\?\372\257\272\252\035\016j\"\033\256"
+	.ascii	"\033\016>\275\324\245\016\357\260\255\331"
+	.string	"\226\215\006\f\276\340Lq\2423Z\215j\350\375\346\357\017\016\215\250\031l22\320\f\005Z\201\364\n\016\365(9\017\022\317,\006\202K\023\\z\004\327Gp\250K\231\230\313*b=\035\370\201\247\033\370\023\324\217\233\326!\027R\003\262\001'*Z\036\265\026\324S\265L\245^\313/\360\002\247\236z)$\205\020\345\261\320P\306\261-\256\025zi\335\243H\205~.\342\202mL\201\342\200\205\225z'bk\031c\232\211+\246\307M'\360\246O\231\036K\337\004\237\201a\243-\241\257\227\226\276\244_a\006\244\246q\216\325\200\273\337r\304\323R% \316\216\3359\212p+\377T\257TJW\372\231Wl\245\237)\355\032\032\213|\f\241\231a\320 \356\001\241\237U\007R\334\207\267k\373E\213\207'\236;\273\307\016\332\t\211\357\217$\007\335\334\3125~m\320\316\354\327\243\261\227\235\325.B\312\275E/\351`\337"
+	.ascii	"m-z\276b\025!\267\227\214\313\220\377.\365\366\330(\267Uo-\332"
+	.ascii	"FG\273\013\353:\206>\326g\254\303\300\372\362/d090\2156\327{"
+	.ascii	"&k\221ko\215\370\b\027o\301\342,.\300\255\003\026\367hg\225x"
+	.ascii	"\211\025\327Wq\235\342WGqu\342\321e\324\304\241\256\242\322\227"
+	.ascii	"\370\362C`D\224\206b\373\n\211\223\240\276rk\177`\333\212\325"
+	.ascii	"\255\234\267\272\325\210W]\217x\374\252W\035\312\265r\255\265"
+	.ascii	"UI\262cElDeJ\004\325\324\227w\272\323C|Z\025\007\302\255\305"
+	.ascii	"M\001\361\031\304\207\351?\\\372\017w\336\303\365\243\246&\031"
+	.ascii	"E\222\222\204%\303\245&\312\274\357\272\221\334\310\344\240\310"
+	.ascii	"M3`\020\265O\342f\2271B\254\223"
+	.string	"\016\237>\206#\345\302\372\232\350wP_!\027\223\375\351\233or8\207k\370\206k\270\326T3\035:\265\302%\372r\262\004\003)\231\036>\240\337\025\304#pVZ\241\325\310\353\344\250\017Q\221=\370\230E#\242\235}\302\270M\016\321P\2620\2756B\334\271\213\314\227\275 L\2173<\3034\352)Xw\226\b\304y\347\033:\266\2261\246\355>\017\327\261|e\316P\334\236\363\374\363oN\036\342Bh\313\331_\200|\333\rg\036\343\365\266f\273\201\032:j\355\331{E^\344DN\344C>\275\220\307\017\362 \007\362\r\377q}\037\237\276\307\365y|\372&~1\322n=\246d\232\305?{\315\216O\177g#\037>\261\235\267\277\227\273\303\311\026\361q\264\361\346\317\356[X\307(\270\357f56/4[\215\226\371\274\321\323f\333i\031\315\032H\270]\247e\255j\335\344\246\333s\372Z\207\216\353\310"
+	.ascii	"'\032S6\267\3454\264\221\341v\273\323|\035\262\371\3558\375\204"
+	.ascii	"\223\366\006p\303ix\233FN\334~+pY*F\304z\321\263\323f4Ag\366"
+	.ascii	"6\232\203Os\\\372\247,F-\221p\2339\357|e6kV\350\3542f\366*\207"
+	.ascii	"\316&\303\201\343\361\322\367*\373\356\354\254~JZ\001\333\356"
+	.ascii	"\261\033\3277\256\037?!\321]\307\266\230\215\333\370s>$t\373"
+	.ascii	"\333aT\247\252\361\005\207\341?3,e\373\252g\277Dg~\333\313\006"
+	.ascii	"{\337@\207tx\273\213f\036\002\272=n.4N\343\345k\253\222\355\257"
+	.ascii	"\031\237\006\201B\250\221)QD\210DdD$I\222\f\007\361\004RB\207"
+	.ascii	"\206\356\006\022\200\004\032N3BHFfD\212RPP\220\fs\034mY\370\026"
+	.ascii	"\324Eh\270\240\315m\246J[(O\347MT:\346\346\243`\246\353&(\251"
+	.ascii	"\272\255\275\262L1Q\372a\353\240b\366\256&\326T\324\325\363\310"
+	.ascii	"\363\3033S\357\347_Nw\252\322{U\371:yU\377\351\225\300\345\340"
+	.ascii	"W5\267bs\376Wuv\367\215\364\341\227\321\326v\n\326z\262\211l"
+	.ascii	"\350\2166Xu\267;\223"
+	.string	"\236*\204@\273\270:b\266\022\361\027\206\330\326\363\202\304\216\"\305\372x\nW\245%z\276@\313\377\250\335C|c)\245\363\311\256\013\247'\267\265\216\305h\f\232N\373\316`\313\"~\227\34733M\276vwV\332\021\211#\023\377\315\267I\223\003\312\350\300\363\365@\023\266\367\350\034\b\205\253\203\3556e\031\"\\\0068\357?\376w\276\365q\340\256\373\241+N\235\371\317\023\255;\202M\322]QJ\361o\223\300W\364\360\247\362\316u(\007\326\370\346g\343Q\021z\3623\245H\300\314\f\334\030`\367\213\274\363\343\313\262\021\261rC7\231{\204K\036\362\271\032\247\313\321\322\323A\032\355\203E\333\364\001\024\234\226k^W\"\360Kl\312\375\224\344\225\362\214\226E\276\320:\324p%\21216\274\357\344>\2349\355+\352\345v\262\217hK\205\240\230^\312\325P^'\376\236\304\r\322\367HbV\342\243\211\367"
+	.string	"\025\345\301\266\311\352YO8&]\002\245*1\207\333\213\375i5\344\267^\024L\003\020\223+<^< \267\320\272\215\b!\177\222I\007\314!Q:\325.l}4A2\356{Q\027\017EU\216?2C\367\310\261\351/\216\217"
+	.ascii	"]\013\242\362\334\366\017)C?\330\332\352yHRV@\244\301\355\357"
+	.ascii	"\263\355\016\224\220\312\235Sf\240\370\013\013\3738\023\224\001"
+	.ascii	"\217\021zd\234\026\031\251\321\006\317\274v\177\243\343\277A"
+	.ascii	"\304\340\317\303\207L\233\204\2602\304\001\027\373S\3238\003"
+	.ascii	"|\250J\272W\330\002\276;G\277\204\370\241\214\244&V\364\343\306"
+	.ascii	"\242\034\002\270%\263v<\373;\032EM\201\322\364\234\244?m&\016"
+	.ascii	"\274\210\220H\352<\317\257\2329\021\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\261\037\2559"
+	.string	"\006#`.\240\262\244\320\001\300+\211J\205'S\335\270\214#\213-\013'\300O\341;\242\234\034\361\346\242\212Y\224\211\317` bkv\357f\311\336;\311M"
+	.string	"Y"
+	.string	"R"
+	.string	"\255\006>\f\026<\265\343"
+	.ascii	"\304\236\032R\327\t(\240\262\025\324\275\022\034\202\003U\253"
+	.ascii	"\201\333\253\200\021\300\021\351\262{\254\001\262\275\322=Tl"
+	.ascii	"\001\270w\364\242~\336\036\351\372\266\023Z\205\356\231]\226"
+	.ascii	"U?U\366\275\366\261\365S[\203\352S&\205a9\275\300v\364d3\321"
+	.ascii	"\271\270\326\"Y\254\270\253\020\335k\327Nqw\362\022Gq\367\204"
+	.ascii	"\211\022$F,\342f\210,\020\037\362\366\320\201\303\006\r\275\f"
+	.ascii	"\325\326&\fU\265/T\355,dk\267S^\205\243\2205!m\t\031!\253\344"
+	.ascii	"\344\357\006\341\301\327\001vT\032y\002\210"
+	.string	"uC\301\326W?tU/\325\223\320n\005\331\275\233\334\231,\251\366\236l\246\004;%\351!\271#eg\326F\262\310@\243\205d\006\001b\331\376\303G{\360\330\241cQ\216\272\236g\034vwc\033V\327\330\032XIcg\006\346\266\214\3461\260m\363\275=\322\327\241\323\366;\307\344\324\230u\241u;\236\"R\307A8\244\337\340n\260\r\366\331\334\232\274\246\006{\0324g\322\314\255\263\373\256\310\214\301SL\230\202\301\363\313\365\322\272\313\326\271\340o\271^\313\237\005\313\025l\273\225*iT\336\236\262\224\366(\026\203\003\250rL\023\215$I\246\0032\n0\016DQ\034\346\030\037\022\300\001I\f)I\222c\n\0313$\"\"\"\022$\005IA\322\001\351\032\226\322g^X5|\033,\332\017\304\361e6\022<\331H[\033\224\220\312\217\0172{\360\030\315G\326\234x\022=)\231\270\214\366\233+\322b"
+	.string	"\235~\016\356\263B\036\342\201\342\352\272\252|"
+	.ascii	"\022\276A\336=\224\305\361\232t$\030m\331\3307f\b\360\003\036"
+	.ascii	"\334A\263\030Ye\311\300\212\274LP\232I}\334Jl\177\212p\236\313"
+	.ascii	"\324\375\245\340\005\252\250g3.\3762\313\276!\217\302\314l\315"
+	.ascii	"\314E=>\226g|\032<+\247\023~\035\004E\"N\034\032\315\245q\333"
+	.ascii	"\204\243N7\3367p\202\002]d]Q\217\2708g\363\351)m\377\337x\332"
+	.ascii	"\225H\367\370\343\n\247\332<\265\255\272\035/\273\320\334p\251"
+	.ascii	"\212\271\234\322\362e\207\341\r\013\373\236\332s:rf\030\276\265"
+	.ascii	"N\004{V#?\276\213ce,\306\2370YW\273\204\372\323"
+	.string	"\271\316\232\253I3\262\t\331&\340\3610}\320s;\003\365\222<J\037\241\3403\220\246\365\004\020\004\032X\323\320\352\310\330\370\342\342\274\3222\224~\233\254\3751l\200\364\225= {8\366\316U\360M\024\036aB3s~D\013\343\306 \344h\201j\246\324'\352\322d\226i\304\271\237\261*\356\245\355p\324\030\216\246:\250\335g!\036p\212\253\374\023XL\320\375\\*,e\352\217<x\027\001Kh\233\r\037\247)}f\002<\255\253\313\371\301 \306\277d\367\037\213\031\326\315a\312>\315\201\020%s\264\325\376\246G\260\331a\\\241\2504\374\246\363\017\226\247\0135\312\370F\367\263\002t\361\264\212<\251*\024\020\0042G\r=\210\b\037\330V\201\026K\302d\242\255=\246OM\314\342G\366t\223\252\210\250\001\210eO\n\336\355\314.EqH\227\240\3543GZ\231$5\007vL\346D\244)J%\221"
+	.string	"\0229\324\3000\030\244Pnn\307\253\264\277\"c\367!M\btE\354\325t>4\277j\224\021\222c\0046u\024\222\303\263\204\265\217T\254\021\003\333\n4G~\016\2522}\325\016})\333\330\214Q\326N(\221y\356#\300\251\315"
+	.string	"q5g\204l\t>:\201\356\353:\325GT\261\323\rRk\365\022\\N_\220\321\220(\331\n\n\b\210\310\022X\351c0\313\373\03543\222\b\327On\"[#\330\307\031F\204\002O\215\021'\327\271\035j\200&\221\203\neGU\003\n\310\245\f\353&\344\311\033\206\272\256`@a\307+x\321\247\343\253\351^\337Y W6s\224\244JF\001O\230\210\233a\2468\272\220:\204\352\364\331g\370\371\340\243\354\321\262o&\306d\r\334DA!\331\370#L\203\005\347\352\242\377\020\366^\261\225\236\357\326 \t\266\223\325\3306\305)\f\357\f\230Cj)C\364\307BQ\303\276\254\032\336\204\236\212\337\244\227\201\314\374\205\f,\031S\32103\006\300X+\205\021\031Vd$\302\f\305\305*\322\357\345"
+	.ascii	"\263\254\005Rf:1\317>\231\334>\002\225\n|7\341VM\n\301\220\313"
+	.ascii	"U\342@\256\030VXoC\364\303i\270M\263\020*d\356\215\024c\331j"
+	.ascii	"A\244\217F\340\35530\354a\323\254Xd\343CNP\327'\203!(D.T\300"
+	.ascii	"\352\037\205G\312M\3140/\313\333\007\254f\252\312\250\213yx_"
+	.ascii	"n\333\244\265\211\251kYk\255KZ\203\t\253\254\345Q\002\315\317"
+	.ascii	"Sth\274\201\371\213\004<[\362\226\254\233]\267\317.v\241\324"
+	.ascii	"\316\032\204\205\313\037\351\233U\371"
+	.string	"\024\343\332\252\361\250\031]hMc\005\247\357u\0067\262\272\360\365~0\350s\252\230\026\307'\230\231\360\021a\331\003\216q\017\002\350\307t\035\336=\013\373\246\235}\264D\304(RFL\244+3\231X\020Y\037k\302G\223+\233\227\352\253_\253Kb@5\340\235\036\323\250UlL\210\361\214s\266\023kJ\241\213\030s\360u5\006Q\216\332\223\211\233\3746b\264\265h2\206\267\"X\3617\025\262\246\261\342G\271w&I\370~)~|\301\221\341\002\245\003\013\334f\201>\237j\251]\356L<x\031\313\217\243\344\264<}\3724\322\315\317\3703r\330\3347DRXl}\315\237\277\246\207r\361:\201_P\350S\211Ok6R\244\320\367\270\214\236\347\210\3623\354]\212\031\f\2238\321\3124\353\305a\2568'\274\340\221\253,eY\220\207\313\313\234\310\241Rt1z\264\2135y\365\232\340DP\002\016"
+	.string	"\302D\203\224\325\205\326 T\327fa\3349\256\301\024\240W\206\307\"\364\334\333C3h\\\005\363\337\244\\\211\370\201\243\363T\212sSw\350}\211T\355\240=f\304\263\037\240\264Z\325\236\214!\215\032\222\361L~C@#D\362\264 \315\016x\346P X\317\026\326QG+0W\250&\023w@%\252\377\230P\302\320\017\006h\262\026d\375\365\220"
+	.ascii	"3C\246\023Y\230\340\277\221\337)\237;\375\262\351\330\215\205"
+	.ascii	"V)\202\300\"\301\177\236\206fR\006pq2(\017\362\236\345\265\265"
+	.ascii	"\rM\025m\361E\306J\001\374rb\201sLS\265\251v\026\316\362\314"
+	.ascii	"\310\221<^EF\353\355\030\212\206Lro\003\340T\256\311\333=\207"
+	.ascii	"}/\n\271\020\343\001\245\350Hl\354\300\243\312\261p\321\234E"
+	.ascii	"N"
+	.text
+	.section	.gnu.lto_.inline.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`XFm\272"
+	.string	":\342\024.L \324RI\007\024or{\317\3056\215C\233\023\276.8\221Oo\250\r\311S\236\235\030h\237\232cN\342H=\256Y\300\260\220z\230\f\330\250\201@\205V\216x-\226\343\270f0\256\035\357\024\371c\021\344V\323\255mI\333[\312\024\217\002\335\002\331\002\177\261\337\363\337\272[\230\244"
+	.ascii	"7\2215.ET\360\377'\206\343\004,\b\001G`\343v\002\301SCR\357\242"
+	.ascii	"x\374\017\rG\005\177@\361\270\373\340d\232K|aAAz\232hV\354\234"
+	.ascii	"\255\270\001\303m\002\212\330Lw\013\275\f\3123\"\370\025{\243"
+	.ascii	"\262\254\365LO\317J[\277=\217\003\307p~\235\230\254\273\201\027"
+	.ascii	"\200\326\0378"
+	.string	"<-Om\360\351\360T\211\317\004\222CF_\222\377m\340\335\377U\274\337\265\002#\177\003/\355\277\n\22060\325\326\300<h`\036\374\006\266\212\253N\277M\363\316\336\236!\023\017\200\211\207\300SC\222%\006\217J\371$\025\237\344$\343\246FL=\322\374\327\210F\315.Y\201\232\b\371_)\336\322cL\220\360(68\231X\253\n\035=\340\357\304\207\256(\201\207\305\227\022\271>\001\374\3507\242Y\344\3774\207H\213\023\024\344\177\241x\210\021\263BF?a$\377&\216\222\366CI\222\227\023CK\234\270\360\177\361H\377\013}\377\017\\'N\342D\216K\360F\177\0213?\370\342qO\377\"\246\342\265JBRq\325\271Ml\355\r\321\213&\377\337\301\373\37561\037'r\\~\377\275x|\361\310\377\203\363?\377\227\342\335\3756\315\267j\006(m\0168\005P\332\\=\021\377\313\344;\375\377\304H"
+	.string	"\245\315U\376\367\211\237"
+	.ascii	"J\233#\372\374\377J|\2751\337\272\263|\347J<W\033\214\247\026"
+	.ascii	"vf?\374\022\365\375\363:\370\307\373\177~\255\312H)\246\372\277"
+	.ascii	"\\\366\307U\377\277S\344\217\251\356\3732M-\26502\365\374\337"
+	.ascii	"x\260\367\345\313&\276\002\224\006\004\351\303\017\231f\0248"
+	.ascii	"=\267\362\304\023\267\277\3154\331\250q\262\347\350\334\347n"
+	.ascii	"\342#n[KT\274\326~U\342,\2574#\363\\k\3553\255}\2465\330\r\221"
+	.ascii	",r{\332\177b$\316\\\261C\340L\373\306\334\333\333\373\"\177\247"
+	.ascii	"\311$-N\bi\004E\267\0059\251\326m\357\366\356\355\367\205\232"
+	.ascii	"d\272\272\264|\314"
+	.string	"\367\377\313\341\313a9<\227\303rX\016\271\317\3450x\016\236\203J\263\273\257\346\203\333\347\340\3669h\203\273\333\270'~i\276u\267\2113\361\254\264\347\363\022ww\223\277Uw\033\377\340e\314\347\340\375e\314G\361\376\304y(\336\266\305\262S\\\365e[\336\026\344\247xi\211\363\333\202\234b\252\023}\233\370\255\273Q\374\233u\023P\b\\\310\323oI\204\242\013\371oI\3244\343p\321m\t_\3174\367\366\366\370\3208{{yB\372?\00152\201\250\351\205H\221\216q\027vW\t+\210\326\03787\314\254-k~\376'\330\302\n2\241\334\357?m\342/036\244Z\235QL\002\257o\342\272\037[`\350\371\354\304r\232\260\2251\372\243\330\314l\317\032\b|\377\017\340\345q\205< \210:\203\b\335\315Y\370\375G\001\344\022\027\304\3176\377\213\203\215\034\321\203\210\337\005W(+\373\235~Q"
+	.ascii	"\345\374\376E\001\\qd^\371N\213\307\177p\205H\313\367z6AN\261"
+	.ascii	"]\225#N$x}\305\301B\334\232\\)_\376\211\033\253.Nm\037Xuo\206"
+	.ascii	"\276\377\003,\335\016\300T\"\220\003p\025\317o\216\251e'\215"
+	.ascii	"\356|\256\302\024\372\216\210\024\235~S\004\333\024\375\233\""
+	.ascii	"\3704\307\224\260\033\"\351\365Nl\254\022\307\r\215b\256Bq\340"
+	.ascii	"\206\364\177\013^\376\277$\220-\270\212\371+\305O\354\362\240"
+	.ascii	"\034\214\260\370\202\373\264\274\301\204\366\364\354\350\351"
+	.ascii	"\366\351\022c\351\242V\206<\361KL}\\\265g\226\353\024\002\222"
+	.ascii	"\025|\n?\n/\0369\257\273\311\237p\302\3673+Y\353\272\243\247"
+	.ascii	"fc\352\016\005\357\232\f\312+\257\222\250\351\362\"\303\367_"
+	.ascii	"\307p\255\312H\035\\\365\275[\253,\362>\260\t>0\017\376\341\254"
+	.ascii	"U\026\251\203\247\264\334qiy\231\227P\364?Ep\215n\204\210K\263"
+	.ascii	"=\242\330lM\0326\273\265#\374\373\375\226Do7v\205\314$\220\004"
+	.ascii	"\226<{0x\bD\333H\274;\267\313J\005\017\002\022\022\322\221"
+	.string	"\216D\201\223C?l3\333\003S\355\236\331\252\227Kfw\270\323\224\"\367&\314D\022\361EuO\353\177\243l\222\306\036v\330\"{`\252\035\356\013\362<\274 w\270\023\033\365\356\250\235H\372\300\203w\300\301O\313\371_\007\036\263:\254U\020R\007\256\372\374>M0\335-\374\006/\0365p\232\235\001\006\027\374\026T\260_2\n\2328\21101u\210>\301\244\222\026\327\247\3165\\g\266\374.\001\265Q_m\314\255\272\254#G/\177\f\232i2\210\017\360ob\2665'\306\025|\377s\020\2639Xy\2219L$^i]\217{\004\364O\3638<!=F\351b\373.\\l\237]\324\340\356V*\267_\326\330>\2275\210g\342\273\356\006\340L\374\311\311m)W\223\266\005I~\233\246]w'\035\002J\351s\230\217r\252\177\340\305\243\t\262\226\300\005\263@\246\302A\002\271j\307\360\324\304\214\356"
+	.ascii	"\214\"go\304\324\253#\023\255\023I\r\374\fl\323\274\353n\242"
+	.ascii	"/\260\313_'\306KSgNQ3\346\240\2743y7\330+L\f\336\357\365\365"
+	.ascii	"\206\221\232\3516\006?\374P\312\231\346Zw\233\250\\\206\331\367"
+	.ascii	"\205\232D\316\262\216\033\374\006\256 \334\230\020\345\371\022"
+	.ascii	"\304X\212\375\242g\307\320\001\267\341\f\266S\t\260\316\002\367"
+	.ascii	"E\257}\020\344/\305]\354\220\314Y\300\377\346\3400lj\2762x\r"
+	.ascii	"\264\231\367\3534\337h\240/\342\355\346?8\347v\377F\264\276\210"
+	.ascii	"\353\260\201{\241\217\321t\371(\373\200\211\207\020\302\023f"
+	.ascii	"\276\006\373\347\032l\032\214'\t#\241-\273g0\022i\270\210\240"
+	.ascii	"\2471\303\310u\265\361\321\236\201\221H\3035g\313\356\236\301"
+	.ascii	"u\366\024:\243\304\2661\205\\ac\023|\245M\333\006}\255J\274\204"
+	.ascii	"\020\020z\204\257\265k\355\032\263O\233\2679_\255\375Z\266R="
+	.ascii	"-\207\335\276\246\301]h\306\336\327\222\313\222\313\341\366p"
+	.ascii	"\270=\254D\"\221\270=\334\341\226\335\347\312=cn\371Bwg_k\367"
+	.ascii	"+\023\027\"\222%\312\003\257\335\335g%\336\261\002\346e\314\257"
+	.ascii	"\221ww\360r\333\300c\336\212\227\251x\316\252\326\262\303mA\272"
+	.ascii	"a\331\002\327\366\306\266U\273nYv\212\2516\351\0135\313\210\321"
+	.ascii	"I\263F*\325\216\377}\244\273\217\036u\247_\022\024\223P\320\023"
+	.ascii	"\323\351\341\372Q\266-\241\003\013\340N\367\321\324K\344\261"
+	.ascii	"\363$\305\231\350\342\360\314)\277\264\305\343n\271\037\022\207"
+	.ascii	"\333C\342\207D%\366\002\207\006(\370!\367\207J\263\347\214\205"
+	.ascii	"\321s\237i\216\t\361\366\344h\254G\030\2663\2518\253c\017NP\307"
+	.ascii	"\233\325A\245X\353N\\\334\347\374\006p\237\212\256D\321f\360"
+	.ascii	"\216\224\363\375k\202\374\377e\247G(\213\006\374\357\024\317"
+	.ascii	"a\003\342\343r\2571\367\245N\253<\r\232\307c\346[\334\0352,f"
+	.ascii	"\034(`\306\364\224\003\005L\231\341\004a\344\0049x\b\226-K>\367"
+	.ascii	"\031/\036w\022\t\261\301\t,"
+	.ascii	"\002x\372E*\362\311\001\377E*\212\342(e\350$q\361\372'~\023\202"
+	.ascii	"\304\020\030\371\343\3405\202\376l1\020\003\b2\306\324T\"\n\036"
+	.ascii	"\273\273\371\f/\036\275\346\236\376B_\321\353E\257%\306[K\023"
+	.ascii	"[>\203s\"\347\004\031V]\237\3124\033\253\356\017\321\017\305"
+	.ascii	"dX\201\240\244\360\375\207qF\302\340\274\266.&\017\fex\3618["
+	.ascii	"\224\321\251\301\026\372\257\320\027|S==\023w\223A~(\013\322"
+	.ascii	"\203\363e\004\3372\177q\314\036k\316\310\334\314cx\361H\277F"
+	.ascii	"4\005Y=\375\036\375\274\226/\314\253\377\036\375\376\003\321"
+	.ascii	"\003S34\203\225\306E\177\320Sf\004\220\n\372\377E\024\362\305"
+	.ascii	"\224\232^y\356\350\274\016\006\fF\264-_\326T5@g\272\222\376\202"
+	.ascii	"\213\177\361\030t\323\335\001|\277\024\032\224g\004\321\327\313"
+	.ascii	"\316=\177\367\313\261\216l}\314/)X\270\266\210\027\233\205\236"
+	.ascii	"*\361\353\025\037Z\037\b\221{\305S\347/\023\277\261\001\260f"
+	.ascii	"23\357W\211\227\314\335\235\371hL#\272\250\325\355\225\2306\255"
+	.ascii	"=D\027o\245\270\212\201?L\340z\260X],\344\032 O\364\216wH8\346"
+	.ascii	"X\327Z\233\024\337+\315\204\334\310\025\022\226\3551\004&\300"
+	.ascii	"w-\217\030\274)\300o\021T\360\324\302~_+N\\\244\217\221!\200"
+	.ascii	"\337*K\345\337\037\375\270\344\002\335\355Q\313\233\2407\313"
+	.ascii	"\265\253\366&\3536\026}\247\314/D\274\304\031\331\022\267\025"
+	.ascii	"\343K\304\245l\224I\267x\234{{{{\374\372%j&\310\314l\247D1\233"
+	.ascii	"\2556V\270\310\227\f\210\327#j0\240 x\204\370\3657\230\3168\205"
+	.ascii	"\211\317\006\013\031\023\bk\257\320\260\220\bT\002\371\037(\345"
+	.ascii	"\300Z\235\221RL\265\363\0335\277\310X\231\3634\337$F\376\203"
+	.ascii	"v\345\315\005Y\033\034\255\030\337\261\277\222\3754\335\306\362"
+	.ascii	"+\306XJ\334\306X)a\t\227\223\037\016\367[$\033\266?#\\\216T\342"
+	.ascii	"\366`p\251\r\241\"\301\327\310}taY\311\203a\322\201\363G\355"
+	.ascii	"\205\276`+\212\314\177\311\346\016\361a\343\200\377\211\203\227"
+	.ascii	"\340\261\301z\230\272_\237C\314\204\355\035\221\361\331cc\361"
+	.ascii	"\035b\344%Xw\304\\\370)B'\307\202\357\261\016{\001\267\353\207"
+	.ascii	"\346\305#\257\221\235\271\200\024\366\362\272\221\035\376W\314"
+	.ascii	"\315\2202c(@\003g\b\332\007\337 @\214\350\016:\273\203\247\366"
+	.ascii	"\367\255\025\020\344\016\316\261\363\333\304a\320\312\240\371"
+	.ascii	"}\271\366L\237f\223"
+	.string	"\356>\022\356\217,3|\342\334\332\250\370\376\360Cmb\\#l\201Rf\345f\276[\274Jz\232\020\241\247\004\305G\\ys\365:s{\274x\234[<.\021\323\335\342q\367@\330\350\361\243\306R\320\354\330\240q\025\f\3268k\375\026\36178O\034\022\211\335\303\332e\017\313rv\235u\322\3563\245=\303\374\32256eO\211}\2524\237\250y\002\346\350\365\325\211\203\370\350r&\300\353\022/!\366\265\346;WZ\313\262,\231\273\317L\334\3563\221\006\253y\242\206lO\354\025gb\240$\030`\220\361\025\346\241\330\332\330\260\310\321r\267;\024\337\247\3516\327\206\356d\276\275s\277Y3/O\022P\212sL\2226\274\343\375\b\036\273\305c\326\374Y\350[\246^\344\0175\tM\241\013c!\246\0359v\224\340\216\321\303\336\004\351\033\363c\n\234\275\342\177J1\0265\275\275\017\372\033\017OI;\260"
+	.string	"C\231f\022#\034\022:\223\030\341\304\2408\212\031 -G\024\314\b1+\177X\034\207-\205\276\362\\\006\205`\2503H[\026s\3201\246fD4I\222\016S\023@\320\2008\030\222\213\005\344\356\003\023"
+	.ascii	"\303\211\350\001\022"
+	.string	"=\rc$\245\f3\206\210\210\310\210\210\210\210H\232$\0350\0246\224\237\267\275\350\024\213\216:\024p\347\0135\302\371\203\2454\300\017\353\374\274e\247\336>\261\345(1\367\357\t\0072P\323@&\033b\021T\301\300k|Q8\315j)Q\366{Z\004dS-$\023\310:%N\350\226\312\377\2501\221g}\323\332p\\\306\003\f\3656\364\352\225f\201\255`\337\346\252\327\277%\326\b\302GA\300qI+\007'X\252W\327\342F\307\300\265s\3633\025\207\241(\243%\212\355v\341\032\3708\340\261R*\177\304\311\273y\007\252\007bVc>C\364\t(,(\343\300\216\2220:0\327N\236\016\224<\326'\215\022e\023<\033\316\342K<-p\226F\365r\031\342\247\323\370_\\\220\005]\"\244\204\376\026\333z+\271\265@\b\224\235#\004~u\350z*\364w\013\354\0204*}\306\366_\276Q\306\267"
+	.string	"\207\207m\224\305\246\237r\241j\264O\241\361\267\275\027k\202\f\260\335\357\001\365\177\236\246G\355\212\216\t/\251\036Z\341\027K\327\232\347R\242U`~\037\330\307_\2241\036\276\360R\007|\330\262R\311\301\302\350\032\240\227`w\001\031\246EI\303W\332S\212\305^0\006\344\326\351:\nx\316\207\321\254\f5\263\0038 EB\tiO\221f\037\264\220\237\3238\214\335\016e\226\247\220i\337@\244G\271^\336\350>G\271\023\216\302\0259UN\276\271\264\006\371\024Y\310\004\240\330\021\244\237V\233\025N\234\321}0\225\312A@\354\326\2237M\370\340\371\276tf\263\3368\233\202\b\021\253\345elO\256\267\335#\364\2256\355\rh\257\361(4%\371&L\374\370\230\203\250\247\223\242i_\360\024v\251\2420e_\234\020\333>.\242\240\332\257J\240S\225\313-\201j\350\261"
+	.string	"\265\315pY@,UqYZ\317\200\326\251\344x,\275\003:\213O\024\340M!'\246 \330~\b\256\223Yoy\214JD\034\263\345\353&F\271u\362\013\347\303\r F\210\227d@\242\377\361\240V\322?\211\f\3222\223\224%\233\344_\372\305\027U\265\315G\256\0227\270RW\217\352\275TS\351\201\326\211v\0034=`\203p\266\304/q\225#\227\236B\b\227\276\270\310F\203Bo\357\333\177\246\205\233\213\224E\361%v\313Ms\bL\216P\213\272"
+	.string	"\362xA\257\237\226\266\325\317i\202\276z\220\026K\230\253\243[\244g\032Y\335\212\365]Y"
+	.string	"\321\254\"\367+?\326\r\tF[f\350\343+\267\235\353@#\177\242\222_\277\017\354\0348d\242n\364\b\257\3414\f\226\254$\231>$2\213\256l(\352\201\321\346~\035\330\0361su\021Q\343\332\235\240\223\224}tw1\223\370\215\004p)\231UJ\314\264k\2128q=\266\016\302\344"
+	.string	"\013\275\271<\236\222Ww\006\216\217\026\374\311+\310!\020Y\016\233RfHo\272EX\367\217\230\363\032{\t\310\322{\261\345\260|Hn=\034\nz<\\\335\351\001\220\026\357\371\360P\247X\020\263JQ\0073\335\307O"
+	.string	"~\260\342\231^Hi\345N\257,0H\0338\307\320\377\233\315?J\234\240\nq\b\257J\304\342$"
+	.string	"\377-\345\002\230\267\272R\307 \233O\314R\326a\204_E\320\207bSHy*\266yg\321\267\347\254\177!3M\3727;(`c[\227\377\347>\031\321xO\3005D\rE\346uT\027(h"
+	.ascii	"\033\251\r\310\364\347\261!I\303N,\027\334J*~\356\216\216\355"
+	.ascii	"\275\354\315zA\307\270s\371\355\246\367\347\017\202f*\364$\371"
+	.ascii	"\003!\367n\256\r\307\031\306\025<\200\2777\225\353\321y\275\354"
+	.ascii	"\233\003\201&\177\001\206"
+	.string	"\302d=\311&\013V8\023h\363\207\020)\363rN\221H\363<N\031\311\273\235\215\t[\366\305ar\007\023Q\217\311\315\004fv\227\004\365uT\310\342\336\200.\314\374\256\225\374\222\375\352O\256\376\356xr\223wB+\205\252'\313;\244m\246\365\324H\261\226N\244\255\352\203td>\267\200\037\007rw5\307\350r\350\2623W\206\\\324\214@fvp\360\265\221\340i\204@\016?\231A\255\265\022\2414\031\314zCo\340\230\301Eyd>\332j\324MX,g\246%a\206\021\303\244\362\263$\031`\355#\213(,\320)\324\270rl]\242\363UB\231\233\352H|D\330yO\"\250v\362Nh\312\253\360l\024\374Y\215N\337\340]!n((8\345*\252\f\216\360\331\216\213{\320H\345\005\336\262\243,K\236\247A0J\201\300Oh\336\214\365\013\360\007\251\234\b\363\024j\"\363\214@K\222\311\356"
+	.string	"P\003rI]\tj\260P\262\211\341\366yB\254\341\022x)\275j\363g\303\305\245\357\245\235\352\372\314\311O\330\337N8'q\362\314\325\277G\034\210(\277\337$J\013\215\030\313H\335\005\375\r\260\212/\275"
+	.string	"\260\364{\302\244\371=\274#)H!\325\311\325\\\231\366\266\027\276=\240`\274Fo\217\202\320\r\340\004A\264o\021\261\304\004\237>\374\327\325C\372\330\332C\323WD\211#\342o\236\215%\201\303\244\341\207\023\316\331/\177\0358(q&N\216c\337\347M\354\023wx\327\334\313\023N\362\023\205%\251\302\254\033ll\367@\253&PC\350>\013'F\274\354bT\305l"
+	.string	"9.\324Z\321\304\\\311z\245\205\257\205\037\031\377\027d\013\"\264w\370\262\373`GO\030\342\325,?\207\312\bH,\241]\271\031\037\"\214x\226\300\306l\2055\270\324\327\244QB\310\364f ;\322\r\360c\024`\353\216\334\rW\221\251\260\332\n\037\320\310&_\031z\253\243\332\254\357j\343\210\304S\341\266U\036\200>\327\324{\344\257\004\226\344\203v\267\332\005O\006X\261\377O\251w\n\357\35147,\374\234vU\333L\335\031\023\325S\207\003\017\225A\364\265\251R$\006\003\351\361\037\263\234\351\330\355f\347\177N|\330\342\333y3_\327?4\033\355\321\253\216y\331\007\275~=\214\242"
+	.string	"\270\212`\245\036\017\271B\204I\341X\036#\236\300Y\0276\316L\251-pg:\341\256\n\035\271\3445\327\270\356\253\024}\240imh@>\305\032@\303\r \353l>\247\245a\234}\356-\204y,\204\275\317k\340\306\006\030\330bX/\216\332xe\366\201\221\331>\272HO\361\243\021#\261\232KL\347\257\236\272f\220\346\206\343\265\351\"9\300\346Y-\255\272\035\371\333\247\311765\312\205\022(\211\324Y\255\323\025\272:\376\275F\231*Dny\237\310\216\370\247H\324{z\355\231\036\360\364?&\242'7+\b\310,\226\022\330\202#R\t\306j\315K+\223\363\313@o\032&\245\261\323\223\322\361\002\347\007O\361\271\034N\253\215\t2\253\346\002\335\275,\274\265\201\246\314\022\316\205\342\20403M4f\027\007\n\254\317IwIb\004\213g]\017\254\200b\354\222\372"
+	.ascii	"\363T\255\257\276\"$\025\261\340\277\246G\001\326\246N\256$\210"
+	.ascii	"\r\367=~ns\250\236\357c \233\371\210B\215\373$l{\224\031t\027"
+	.ascii	"\325\371\204`\017\321\001pof\026\371qMfv\372d\024\257 \242\215"
+	.ascii	"B\277\312M\247\200Y\345R\t#\265\242PD\264\372\332\036\027\fx"
+	.string	"+\223\036\020\0242zI\035#\022\210k\003h\267oE\321$\326\347is\270\026\263\207\320\nK\212\225=.\\\024\210-||\215\037:\335\327\005l\314oX\326e\216I\323\210\247z\026\314\244\236\345\347\033\022Vr\260\244\262\352\033-V\275\376S{\037l\272\201L\343#m\250y\307\226+g\254\"\025\027\221+\253\005\020\305r\224WK\004\356{\376\2454\301\0269c/\227eS\\k\332Z\254\f\303\263Ox\031\261\327kpkY\036\007Ev\017\205\244\022\301\215\031\274L\370\303\001c.-\251~\031=\262\224-c\032\256\251P\b\202\207\1772\374u\254\2130\373\\\331\017\276\242%\250ux\315\222\026\023\003\373*\211\330J0f\013\366\360L#\217\363X\246\201[\005Z\004\360\024\347\263\264\322\330\261X\373\b\031J\342\210\311\302\033-\212[\364lS\363m,\336v/\253\250\251\037\254\005\311i&="
+	.ascii	"c\341\302\227\255Ex\262h\3679y\357\323\251a\250\216\002\301\375"
+	.ascii	"\342\340\251\213|\023\352W\241vL/\325\026$\005C\002 \t\030{\333"
+	.ascii	"bt\304U\261\3053q\354}M\177\004\033\224\201j`\002Cs\246\372\202"
+	.ascii	" \222\007\362\373`8z\b0p\227\201\227\225\\o\t\203\276\325\353"
+	.ascii	"B`t\214\373\024\354%\301\210\365\203,C\372\241\020\032\353a\332"
+	.ascii	"&\312-\345bw\036U%p\207\t\267[m\210\007\242\363`M\362\262\273"
+	.ascii	"\260(\327\031\365G9IP\211\006\355\004\311U\337\bB\"\2258R\252"
+	.ascii	"\003}H\216\364\273]\273r\222\fUq\276\277H\273\352#\256J*\253"
+	.ascii	">\230T\030\347\r\242\226y\346rG\2740\221\232\002YU;\214dgB\245"
+	.ascii	"&\300T\276\307\253T\230\215j\205\336a\251\351\325\267\231\020"
+	.ascii	"\300\305?*F\220i\221F\245@\020\020H\304H\304M\361Y\020G\020\035"
+	.ascii	"V\211\016\354\265\244d\206\251 \211\261\200v$\335\300)|1F\357"
+	.ascii	"b"
+	.string	"\363\261\220\1778\370\242\220/\226\276\242\302I\244\326\245?\021\266\257\346y\340\273F\370\252\007\n*\331R\364\325\204\214\f{\322Q\037\262,\026\201\f\314A\306\341\244v\341\321\001\306\264\222\323\024\355\203+|\007\360\250T0\302\250\204qwIP\325*7\353\345\252\320\250)\235\230\037\350\263\":\276\276\036\234\243\373\361\350\241;\007\334G\305\214(#N\207Sl\222\256a\330oa\350yE\004\025\263XC\305\342\264hK\2050\341<\364\306\221j\224Y\200\254\241\304`G\222\007\002\227p\245\3369\225\301\213\315\n0\t\225%F\373\260\351\326\006\316Mf\310\343l\320\354vo\332\377\020\244\rtt\300\007\3665\004\303\250\bt\356m\006\317\226\270\246\301$x59e#XG\261f\247\f@\347o?a\200\025\265\223\t\227_+ \303b5\214\212s\320\033\025\034y\n\037m\210\300\236\234\220\002X\303_\204"
+	.string	"\2611IO\236\321\313)\321[\373\3673\207\007<\001\240\242\272\n\337Pj\222t\232\227i\214\2667\313_>\021Dx\0065\251\001\270[\234\340'&\205I\213\226q\360E\206%#\315\232\336\"\232\036\362\322\225\314\024Z!=U\341y\231\ry\342E\370\204<\250\315^\270\212\310\303\211\017\007\032\340\345\254\027p\367\330\301\373N\013\336\274{\274\243\"\016\220\365\\\223\3608\214t\261\013\037\300];\007\346\322\322\223M\266_\203\302\275Rl`\363\315$\"\024\3627t\311|\244KC\245\205w\325&N\351}\220\230i\224"
+	.string	"m\231\r\r\215\023A"
+	.ascii	"\235\331\017\021\376\246P\020\320\275\003\344L\rs\327\331\\\316"
+	.ascii	"\347\021e\203A\263B\310\210*\352tu@\036Atb\335\204\351\267\026"
+	.ascii	"P\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\254\200\035\377"
+	.string	"z-U>Z T\262\232\016\303\275\356$\007\252\3570/\232\255sOII\361\307y\256fqu3H\\\275\n\031\337\344\352\224+\3076>p\021\331o\376vl\024\372\333\357S\003@\250\333\022\220\204\006\317y\214m\035\317le-\rC\311\370\217T\315n\271\266m\333f\2557I\262SJ)\235\003\333\003\341\0039\250>\263K\016\220\235N4\013\332\202\352\335!\241FT\357*\330\373\007\026\201\2529\325\255bn$\372\201#g& hS\036h\020\036\356T\204\352\315\334\342\311\341\211\214\352\251T\216\205\360p'1\252w\247*\325{O8\250\336{\205\227\bA\317&^\"\004m>\215\206\360p'\024T\357\335=B1\300Br\254\243\b\017w\n\242\236::\207\363\244\003\220>\201Pn\242\001;\030\301tD\303@\031\f\246,\244+\220B\237)\364\311"
+	.string	"\212\003\263\020$<\\\227\204\232T\363N\237;}.\200.\021\2022\002f\315|C\022\036\256\023\202N\237:\275J\272{\201R&\334}Qm`%<\\\247\205\227j\276\365ysa\367l\332\024\350z\t\017\327AQ=&\325gN\2379\316WZH\202v\027\245z\267\204\t&(\273\202\267\252\235\205\256\243-\001F\265\244\232M\350\323\004#IH\340\336Mb\202\366\322\017\355\313ep{<%G;F\004>\223\300g\007\202\231T3N\23780\032\355\335\244\356Y\322ar\202\211\005\273\2023{\247\016\035:f\272\027\346\036ji\341!\260\013<\\gC\235\021\002\373\362\302\360\023\036\316\255Tg\035nU\252\031"
+	.string	"}\002"
+	.string	"\365Z?;\024\212Z\341\345\034\373\024\233Ts\216>s\364\251\244;n\302\265{\366\331u\252\317\245>\225\b\005)\340\317\335\263\013\356\016\n\017\347)\250\216D\365\256\251\251\001\315C;\335\275\3029\350o\216\307\237\0349x\247P\030x8'\302s\236c!L\205\207s\\u\346\001\267\315\266JE\233\372\340\004\3708\017\356*<\\'A\307\025\036\256}P\375\006\332-2S\310L\361\203\037\314\300\303\265\026\325=Uw\252]\305\334Cv\317\356\030T_\206\361j\372T\302B"
+	.string	"\016Nw\251\346\245>\225\364\331\203\231]\310\001:\212 Kp0\300\024\017\327P\252\367n\222\002\354\236<\213\205\207\353\036:\002t\223n\205\356,<\034\2171\200\323\211\212\207\343*\250\n\354\204"
+	.string	"v\231i\013\332\275\013dwS\330=\177\334\372\344f\030\346\366\261\236\313u;\363\316r\2633\367X^\355\311~v{2\027\036\216\177\250\2562\233\315fU\237\251n&\0013s\307\243\013\017\307LtP\250\342\341\224T?a\007\036\356\b\335\341\205\207;\241z*g\227Q\340\246&\244*\030\036\356fkj\307g\307P\230\237\360\331\265\017<\034L\365\335\263\231\206\356\324\t\314\354\037\227\320\234\343\034\2249\007m\346\034\357\371\200\356\027\346\306\351\315%\201\227\ne)\334\2749\2729\336)\364Lu\253\372da\356"
+	.string	"\354\236\252\336T\3572\367\363\023\314RX\307\355\206\347r\274T\350\362R\241\315\236\313qL\2573\333XF\345r\271+\274S\350\255\251\251\251\211O^[\237d\r\026v\202\271\t\016\303\303\241\252w3\337\354\256\315\356\326,\347\370d&1(3\223\030\264\231\211\f\017\307\325iG\323\365\351\322g\252\317\231]\356\242\374\363N\241\235jnf\231\335\223\317\356d&+\224\231\311\nm\336%5\264{\31344\247\232U\314\355\322\273-\375"
+	.ascii	"\226.)\265\234\343\335=\273\213\262\334E\341\345=\273n\326'\331"
+	.ascii	"\374\302\334\236\252OU\2370\314\215\332\355T\236\352\323\231"
+	.ascii	"\233g\350\223g`\357\323\373\344^!\314\354\3135\354\313\020\273"
+	.ascii	"$\021\0024g\f\347\230&\2615\232\252\267\312\0047A\270\251R\275"
+	.ascii	"}\013FbuJ\260G\334\340f\006R\334H\271yrs\202\352{SD\365\276\301"
+	.ascii	"@\365\276\251\241z;\341\341hhQ\275i\300\240z\357\311EG\243\005"
+	.ascii	"\325i<\251\216\203v\032ItLh\fQ}\231\306\016[h\321\356\321hR\275"
+	.ascii	"m\256\234T\312\250~\003\233 ,-Q\261T\305\022\026\236M\017\252"
+	.ascii	"/\251A\273g\323E\365%S\262\250~b\261\224\305\256\3402\350\233"
+	.ascii	"\033\336)\324\346\212\352\336\021nc\204\217\301E0\312\246\206"
+	.ascii	"\352=\203\214\352=\303\007\325{\f\366\0348\207z\025nv'f\320\240"
+	.ascii	"\272\024\325{\227\372t9\300\007f<\361a\306\0213\210\250\336\355"
+	.ascii	"\f'\325\333u\300^\205gd\240zw9\2249\207\316`\342\304\t\263\024"
+	.ascii	"\256)\243\246J\365\366\274V\265\367\2605UT\357\2240\017N\205"
+	.ascii	"s\347\025\355\235\025\355]\307\035\340\033p\327<\251\356\355"
+	.ascii	"PsD\365\316g\3005CT\257qR\275k8P\275\333\263\007n\326\301a\300"
+	.ascii	"\335\361\200\251\224\356\202\273#\226\226\272X\252\202B\255o"
+	.ascii	"\240a\254\200\261\342\213/jr\250\016c\005W\212\372\202+m\206"
+	.ascii	"\311\325\314P\235.\215\225\352]\227\001\232.\252w;\360p4Tx\341"
+	.ascii	"\341hBP\235.\365\251jf\f\264\224\b\270\200"
+	.string	"oMMM\022\240\311\301\b\325\273sF\007\252\013X\300\303\302+\260;\263E\365\356\204\303\314\025\3159\250\023\301\315\316/M\232\362\rM\0067JIs\322\212\311\356\331\271\031\026\2348\007]\024\263\r3DT\357\031\020T\357\235\301U\357#T\357E\3458\3072cT\227\301\242z\307D\365N\006\211\352\r\206\207\223\021\242\272\214\r\325;\231\246\352\035\243E\365\256\006\325;\246\212\3521/\250\036\263D\365\346\t\350\300\f\005\363\013\270\371\344s\212\366NH\216\275=)\357\024zzan\246!\246\210\352MM\315Q0\307\004Qc\232T\357\032\006\b\325{)\f\017\007\303\005\214\f\304\240\235\324=\230\f\332\273\274d\205\366\236/0JT\357\034\346\002\325\351\213\225\352T\b\036\356\345\211\352\364\305\207\352\224\b\036\316\245\214\352\336R\031\036\316\245\212\352\335\202v\227\"\252w,\350\245\034\355\336)\230\245\340\216"
+	.ascii	"\355\275\302=\003m\216\200\213\006\366d$T\247=\250\336-<\340"
+	.ascii	"\026\032\3448\327\242\202\352\264\005\210\352\315M\033%\312\311"
+	.ascii	"-ML@\320\230\030\336)\264\2330\307\320=\231\245\312\377R\026"
+	.ascii	"\033T\257\301\303\261\030\301\342\204\305\002\325;\177a\356s"
+	.ascii	"\367l\23560M\240E\300\275c\214\301K\005J;\355:\026\033\252\253"
+	.ascii	"\216 \203G\205:\333P\215Q\275C\241X\005\334aTo\225\02702`\317"
+	.ascii	"SeQ]e\205\212\212\352\273I}\003m\212za\356%\034<\234\212\206"
+	.ascii	"\352\235*\243zK\301\035\0057\353\340M\201Q\235\256\347`RR\252"
+	.ascii	"\317\254\247VP\335\002\036.\345\244z\313\236)\016T\357j8\207"
+	.ascii	".\347\320f\035\234\203\207\363\300\250\256\312\200\207\363\244"
+	.ascii	"x&\250\256B\345r9\024\270\031\245\202\300\355\246\244m}\246\232"
+	.ascii	"\231\00420\365B\260\001\017\347\361\260\251f%]\252\233\233P\362"
+	.ascii	"\230T\357\270\335\346\315P\035\t\325\273m\224\027'\223\271;\325"
+	.ascii	"\314\303\314^.\347<\227\323\301\303\241tP\2757\007\325\273\315"
+	.ascii	"\242z7\245z\267'\212\212\352t\245\250\216\222R\275\243T\357v"
+	.ascii	"O\336\301\303\241\202X\342+\017\350$\224\017(\016T\037A\033\301"
+	.ascii	"\304\303\362\b"
+	.ascii	"\226\311\t\223\017\315L\370\204\342\r\203\362\311wOT\223\352"
+	.ascii	"?x8\032>-\".V\221\236w\261z\276\374N\330\325\233\"\021L\rIV\272"
+	.ascii	"l\b\216\263\323\266\204X.\227-\277\017\305\020\034\203T[\366"
+	.ascii	"\206\237,u"
+	.string	"\332\377\362K\321\035\225H\261\244\353\355\367\226\264\0363\320\034\315GR\002?\004\307\331\r\244\275\022$=D\023$\277\310\232\245l\3661\224`L\265\341\217\235\017fC\002\250\360\225\2601\030\211H\214\350\226*|\277\243\024\200\217/\347y\374\377\277\216\rU\370\272\005\362\375\367\205>\276U(\200\037\337\357\bb\001\301ZD\217T\223\205\266\231\321M\314\371\031h\216\261\325\226\266\036HJ\340\177i\353q\003i\377f\3156\032\375\033\375\020\221P\t;\200\357C\037>>\031\034\2265\305R\265\317#\332f\240\322\2333\033x$\372\304l\371=\217\247[~)\225\013\335Z~\365a\257\237'j\025\351\211\261\204\376\345\252Y\235^\333\347K7\374|Q\353z\371\376\374\274\272-?\337\360\373 D\200~\\\257\236\367i\305\206\212`\260W\217\215\005\002d\345\343\264;\253\024V@\350\232H\220d\263#\320\024\207\260"
+	.string	"\r\261~\210HhG\371\345|\371}\217/\277\307Aa\351\206\242\315\206bX\023\037\211\221\t\036\371\260\006\322hcO\315\2065\261\333\022\265\264\221\354\226\024Cp\234\231\343x\344\205^\260\257\311\036\251&3I\320,E2"
+	.string	"\253\200\027n\250\\\350\362\026\361Q"
+	.string	"\037/\334H\300\217\027n\260\254\367^\267f9\316\276\024\221j \022\243\017E%\260\254\331^G\fG\332\003\005\365<RM\246\004\212\263\272\341\3671k4\223\201G7\322eo6\260\306\226\337'\2014\324\226\037\217\226-\277\027I\233\t\212G,[\322j\326\024K\221\244;\233\2012R,s\354\250D\212\345\315\222bI\212J\"9c\303\357o2Z\231c\353PP\253H}\027`\261\327\361q\261\204\204^=\357b\341\345R\200\253\b\307\232\266\244\232\214n\013-\037\027\020\335\035\007\204 \316\006\265\\.V\221\036om\337\215\224\331\033H\353Q\223\321^D\252\201\344\313\226\337\363\2104\260\3668*\027\227}\034\225\313i\221j2s\034\217\2100\225K\313\326\226\021\026Q}W\253H\354["
+	.ascii	"\372\001\300\256B\321$\307\244$[\371\346\350\202\271\261\013"
+	.ascii	"\b\277\325j\347\205\377y}\313\007\210(V\364\372V\020\320\317"
+	.ascii	"\0136\364\255\030\013\366[\033ef\322\370\241l\006*"
+	.string	"\325\200`6\374\336\307\305\372\360{W\253\305B\2545\344c/\327\227\337\363\224_\216m\021q\261`\377\363\372X\321\313f}ZA@\254\237'\342\002\"\202\261\206`6\346*z\365|\314\325\022*\"\002c\275\017P\020\313\210\013\210\306\022q\001\025\271\200b\256W\317\267`\257\237\326\220g\241\005d\244\005\373\026\021\253\0254\364<\336\247\025\353i\305Z>\337\202\265Xx\242\001\254\312\305\367]@\017{\301`-\034\034\034\227}\036_\034\034\234no\244\357\315\364\275\375\330\371NK\276h\267\201\rx\247P/\332\275eN\302\303\341\260R\275\251\211\227\224 \002\305\356\362\013\026\007\0278\236T\247\273\204\207\303\301\244\272w\243\214\352\215\342\033b\334\370\342F\225\352]\216oDQ\275\273q\202\352\335vLp\367\356\362\023\336]b\202vC\361p6\302\250\336\2626\236\250\356\331P\242\272\r\017T\357]\001K"
+	.ascii	"\212\r&\325\233\203\004\341+\234C;\212.\307\255\243\323\3551"
+	.ascii	"\340\356\301\306\004\252\257\300\303\325\250A\365)\252w5\240"
+	.ascii	"\234RM\237tR\237*&(\255\221D\r j4\251\336\273\235\202\345%P\260"
+	.ascii	"\254\204\017\264O@\023[\223f\"\222\372\344\370:5\322f\212\344"
+	.ascii	"\217\346WSv\023\353\213IIL!R4k-\225\213\n\253\244\210P\370\005"
+	.ascii	"\211\301h\234\365|\371}Q\217\020\315\336\276\333\316\363\224"
+	.ascii	"\245H\206!\030\203\021h\022\225\3607\220\246DV\276N\371=OO\217"
+	.ascii	"\345\t\277\034\311$Db6\374~$\223 }j\313/H\371\3215\372V\335\226"
+	.ascii	"am4\022\313O*\262\261e\354uh\226&\232e\022\242\026`/\230\013"
+	.ascii	"D^'\224\231:\337\027~<EC=?\273#\t)\232&x\344\211\302/\347\215"
+	.ascii	"\370\330Y\355\374\t\2409\033\215T\222l}\317\017 \230\345)\221"
+	.ascii	"\300\331\321\207\217T\223\321H\226\315>OM$I[\017\315\362\350"
+	.ascii	"u!6$\324\252<\352\303^O\024~<|\020\025\t=\021\027\020,F\264\263"
+	.ascii	"?\232o\212\345\227\037\313\013j\bfK\233]\255VH5YX\223\ra\201"
+	.ascii	"\301\007\306z\ra\331\325\233\"Q\314z[\212&H\322\025IP\206\220"
+	.ascii	"\004\221\244v6\003\273M\255H\202GN[\033e%)*y7\333\262\345h~\316"
+	.ascii	"X\3732f\275E-\335\362\373\024M\345\002\263\244x\223\321\276e"
+	.ascii	"U.\246X\272l\022H\353\366f\003\273M\255\267\250%E\263\004i(\034"
+	.ascii	"#q&\226?\003k2$\0319\276H\216f)\222\025$mH\262\243\332h\364\242"
+	.ascii	"\022X\322\254\250\004\226\247\025\221\230\037\326D\233U\321\300"
+	.ascii	"\032\f!\t\216G^\366yT\373\345\327-X\263\265l)\363Im\313[\037"
+	.ascii	" \030`-XQ\254\207\365S\344b\t\305\354\352M\221h\306\226\244H"
+	.ascii	"\332L#\360\310V\003i4{[a\347\373P\006\203\315\210VC\2127\231"
+	.ascii	"\220\352\264<\342\354\b8\223\201J,\226-\277\357\226n\350\262"
+	.ascii	"\341\367<%9\232#\355g3\020fW\341\3672\273*M[\222i\033\1776\003"
+	.ascii	"\037\251&+\213hv\025\256`\255!BE\256\217\025\r\305\212^&\254"
+	.ascii	"\217\253\350E\364D\\@.\260\202\206\276f\303\357obX\223=9\036"
+	.ascii	"\215.\233\360\373\260f\033\313G\252\311\222\200\263\241\031\224"
+	.ascii	"e\303\357\305\231\354h$\223D\023$a6\366H5\031\022s\034iD\337"
+	.ascii	"\003{\034\233\205\265bA@?\250}\036\221\006\222G\337\002\354C"
+	.ascii	"\3214\022M\321\347qnl\320\277\\\252-ia\n;\337*\374T\246-\251"
+	.ascii	"\006\36487\213\312I%%1\237\024\315\231\354\310\347qr\344\274"
+	.ascii	"\2679\257\004I\370=\317\321\321h\332\214@%\031)\206/*\311L#\326"
+	.string	"\343\340\354\216\243\243\361\264;F\323\006\322\3351\003m5\220\346\255\353\005\024c\005\275\206`\255\230\013\350e\311\261\254\211%\fF\245\310\262bm\254\2356\374\236\024\217\320l\265\177\001\325dC7+\322\300\362E\022\374\0375\260\306\206_\322\314\266\354J<\362\346X\373pf\033\215p\204%\204bML\032q\230b\311#\210NML\032?I\b\212\344\f\374R\246rY\205\337\217\346\207\337\323F\362\350\303\3603\311q\350\333U(\316\216\2005\361\207\020\025=)*\215\037\332\300#\357\303$\307\241\035\2732e7\361G\263\374^\234\031%1zR\224aLz\035\244\232,$A\031\310\361\007gm\337\363\370\035\033\032+\263\257\343\233\004$I\226\314\206\337\363@b\"\325\304\331#\325d\244IDc]\257\327\371\371y=O\031\2122\214\263\031\353fw\204\337\363\f\265\320\312\371\360{\236\"1\"\256VP"
+	.ascii	"\326\350{\036\037W\321\353\347a\255X\017\013\306*\322\203c[\260"
+	.ascii	"\242\030\313E\004\210H\305\323*\nb\031\371\230\253\005\203\025"
+	.string	"\365\374*\206\360\250\263\007\233\224\245A\246\220\310\310\310H\222\244\003\243\022@@\210P0\024\213f\313\350>\023"
+	.string	"A\n$\261xL\026\215\006\303H\224\303H\210\001*D\0201\306\f\t\221\210$I\007\b\006\r/\363,\352\346\247\003\222<V\033P@~E\\\317\353\223HWW\213J\021\254\362\353\f\223<\200\020\221\243<\350q\3416\252W\252EY\344Qc\017(\212\306\212*=\2414\320\177C&,\360\365\326\345\271\265>s\353\027w\300\001\267"
+	.string	"\013\244249\252gj\326\327\333\207\235\247\340\303\264\213|o\250\307\274H\361E%\222\350\reH\\\021\342]\371\231\371\270\007\335\013\037\335\225\327\337\314\224k\f\225\352"
+	.ascii	"\274bc\345\3201u\373<\332\310O\251\370\026J\347\035x\030OZ\217"
+	.ascii	"+\260\201Er$\355\f\312\245%.\337\031\223arFO\\\250#\324\345\211"
+	.ascii	"\236\tBw\231\b\007\223{\201\206\033\212.\301\222\004}M\016\031"
+	.ascii	"\0179\242\224\234\026\22285\223LX\244\026Em\020\237\2110\214"
+	.ascii	"\257\360\240\226\242\312Y\021\237^\264!\346bJF\216\321s3R\334"
+	.ascii	"\036\370q\036n\351\367"
+	.string	"\343t\363\244VO\366h\321\345`]\350\325H\005\223_\326-\036Y-\225\024\271B\221\nP]\250\033\230\207\002>\340:\307\253\323Q\033\312\240\201\220\322\302\244\314\211\302<\365L\272\237%\301\250\306\206\341i\341\f_\177\032t\311#%>N\275\212yI\027\207\316\"<\023\256\240\t\275\016C\363\275u\035\332\r\025\245\202\263S\224\034\271\322\267\306\260\214\2525[\201\331T\312\241\371\211\343\362\030fu\020\rF\241\344v\236\313\327\235\356!\345\2067\354gS\2005\332\227\224A\243:\212T\321\336\031\234G\330\026\310\210\317@\026\251\nz\"\366\307\035\255\214\036\226\224<\3419\316\"\022=\314\343L\247\236|\177\245t\264\370B\326\2567\3638\250\372 \310-1\240\304w\367\034i\267\211?\221h\200\357\357\336\353D\273\027\350\332\206\247K\302{\\\316\331\031P5\305\255\271m\375<\314\016\360\363\354\2619E&"
+	.string	"\343i\266S$\261\242\340\210\325z\277\224\233\331\336Hi\376@2fqw;\001"
+	.string	"\240`m:\202^\341\b\335\363\021?k\t\037M\257\202f\217\372M\372p`\316b\215\2554\264\2565\331\024k\207\265\362\252@G\036\236`i\224\227\273\222I\353\004H\304!\244\037w\023\327l^\265\276#\372;V\357K\255\231)\254O\224?\207V\273\202\237&\023H\326\342\233\373\035`Z\n^#c\362\314[D\3733+{/\325Q\2542\202\327\247\316\344\253+\342\260U\2520}\226\242\027\240<\020K\002rQ!\177\342\360\245\b\2170`w\360\037\260w\205F\220\361\345\031\3328x^\243\226\327\330\022\244\377\204\f\321U\333J}\020\244\254+|V\332\361&m\325^\374\256(p\017Km\253\362h\256j\365\276\215\212\274\034}\3321ss<7\327\001\350\016\007x)\313"
+	.ascii	"8.r\327\032\363\003\354\361\336\366\215\260](rX\343[O\022)\364"
+	.ascii	"\207\001\275H6\fRMC\rt\211\212\364\034n\341\207Q\267\005\343"
+	.ascii	"\245\304\331\013\224\214\033\177\2272s\241\003h\347\232\030\003"
+	.ascii	"\334\311\363\203%@e\225\225\205kd\347\310\037\327i\030\004\371"
+	.ascii	"\007\242\375\037)v\350W\265\337\340J\2120/\365\267\335o\210\013"
+	.ascii	"\254\245\2027\360\262hH\bd8\364\302o`\255\n\370\261\331HSD\200"
+	.ascii	"\037\331\030\2777\235Ab\331\252\335F\372\227\332d\256\363\221"
+	.ascii	"\367O\264\213\371\034\240H'\320\007y\240'\333\340\314\210D\204"
+	.ascii	"?\374\222NZ\301|X\374\2522@\n\304\352T\023\226Jc:e\336[j,8;\265"
+	.ascii	"\225\345xKh\362\253\253\021n\036\b\262\221\203\215\240\305\353"
+	.ascii	"[m\021\276B\336\271\216O\243\0037%9b\030\005\244_\013@\206\340"
+	.ascii	"\230\216@\305\262J\034N\225\326zt\005\243\244\347\301t\374\236"
+	.ascii	"\202b\361O\333\003\255h\036(\333\214\347wt\261\003!\3620n\331"
+	.ascii	"l\212z\253\343F\254)\035\372\321\356\031\203V\032,\243\254\350"
+	.ascii	"\325%-\353\302JX\324QZ\261+D\350\035\351=\264\236\340[[\275H"
+	.ascii	"bEO\242\372Q\205\253p5\241*@\220\035\260\212'\376\375\360\027"
+	.ascii	"]\034\227t\261\r\237\031\331\302\242\t\256\300\206]x(\361\210"
+	.ascii	"R\222s\353\251\312-\321~'f\213\030\302\320W@\333)\261~\336\307"
+	.ascii	"Hzf>A\034\226\216\372\236\371\231\265\203\222N\270l2nrq\300\334"
+	.ascii	"\252\004\276\260Lid\323\311\374\241U\206\373\f\341,\016\343W"
+	.ascii	"1lp"
+	.string	"G\343\211u\335\033\026e\373E\310\261\315\007\206\n\2126E\003\320\004\272\316\332,@\320.\225\006A#\345\034\003+\351\267\346}\354\001\023\231G\371\370\367m\366\225\216\316t\320\360\264\321\025@\n1\241\001\220\323/!<\004\006\270\234Z\261\222\232a\302I\235QQk\356\201\334E\037\374\255\211\314^(3\201\242\206n\233\253\253c\225\022\246\311!\007\221\274\323\001\005\311\331\233\375\025\307\234\200\346\245\363\001\206he&>\203\302qe\037\2207\246h\222\372X\272s\327\377\257*\034t\0324\237\234T\222\036d\360W\202\365\372\324\376\276S\343K\215\020]u\034\002\300a\221-R8[^\333~\210H\271\267\234%x\261\376T\266\273\3700\235A\254\3678\376\362\261\220\342\"-n\005\030'\360\036\205\367$\214\211e\377^\016\2114\347\260\330S\250\340\304\325L\225_*\256N\262\220\223@H\324\354\271_H\030"
+	.string	"\263\204\311\220\272(\032,\365\276\273\020\266b\345\215\324g\300\246\305$\007\322\361\n\310|H\324\341\217:P\332\250\034\214v_\200IDfE\230\237!-\3212\002D\3233\245\344\346\306`\264\020\337p\210\nJ\2208\003\200\321\321\333JQ\233(\222D\301\257\\\336`\277W\354\363\211#\265\3335z\207P\251\243'l<GC\302\2677\365k\222&\r\230E\005\354d_\311\304c\326\341g\274\3065\312\277\030\321N\341\363(\360}`\367\305\036\215V\262{3\032K\376f,Bh\355w\037\244\276v~\342\007\002\004\330\266\327l\370V\233\323\265C\233|\2626\341X\253\036zBl\207=7\372\037b\347l\207v\327\031"
+	.string	"\346\036\303\322q\220jj\003\245\200\360D\245#\257\267\004c\356\2336&\241\355Q5\224\2616\245W\235\032\027g\317\213\273\230\270\373\003\322\r\274\345\334\233U\252\250E\373\376\231\206\267"
+	.ascii	"/E`\025K\374\r\327\365^\241'x\324\020d\025\024\2551\256\304\215"
+	.ascii	"NG\221%/\030\343\325\265C?0\346{[\273\361\374<\220\016g\316a"
+	.ascii	"\362\324@\234\271\177~\257\205\356\352{\252\360\206H\240\322"
+	.ascii	"&G\231\227\026M\333\305~\t\3315\350F2\203\021\360\336i6\276\033"
+	.ascii	"I1F\264\2445\242sY{)\250\214yV\205\376\317\f\203\304D\253\271"
+	.ascii	"=\247V\376\205P\310\026\306\344\217\313\226[#\235\231\336\021"
+	.ascii	"\345\235!\320\266\004I\321\201\031\360\341_\203\325A\024eZ'\264"
+	.ascii	"\310Mk{\341rx\210~\306\221\210\b/\200\317\337O\315\217z\017P"
+	.ascii	"aIM\260c\324/\230UaC^l[e\023H\372\374\227\361\264\366p\277\240"
+	.ascii	"\256:\006Y\264\217C\307\201\241\345k1G\204\255k\300}\033x(|\005"
+	.ascii	"\271N\273;\335\337"
+	.string	"I\310\266\217g\325,>\371\217~\321iA\235\202\277\0044^\001\357\0177,$\376\240\035\021\213\325\244\257\003\356tR\030\366z\235<\346\343\207\024\345\377\350\310(\241G\266<\343\260\271\030@\320\023\211\242:1\275\264\350\334B\231\247Ts\025Vu\225w\347T\355\304\236y\001a!Hn\360\231\270\201\300\311\n\240_]"
+	.string	"\264W5\233\343\215\346\273|\252\027&\326\b\345\217\326\307\264g\333\0045\203?\274\314Br\017\203\337\330;C\260"
+	.ascii	"|s\265\203Pkl\020`\005\037\236(\310A\242%P8P\316\244\314Q-\201"
+	.ascii	"\031\271d\3263\225P\210\324x1\224g\306\"\3167\0071\310{\\\253"
+	.ascii	"\376\316h\t\022g>U\202\022\217\303\350\030\0201\216\262\317\234"
+	.ascii	"\313"
+	.string	"^$!\031Qt)\035\017\2221\215\f\245\345\fk\307\375\334\n,\017\246\027\227\321z\306\313\273i=[x\013\235\036\340\376\036s\270\013@8i\260\n#\030\223\311J1\002\201\323?\276\266\260\037/\247g\220#\2118\261,E\026p\223\356\b\211\312\206\366\236\330\343\375\214in8>WP\245P\034\002\326\207{\217\225\201O\321B\353\334\2228\3543{6\240\344\024#g\t\027\324u\006\217\251%\332t\275d\330\302\336NBm|\375>\247r\316\330\336\212\005\2354\246Vj\370\325(\3738K\272GXOU-\006@\005\260\331x1w\rT\260\226\0254\356?\024\360p/^-\277\267\252N\235l\026\300\360dk`E\n\237\247\265\005Q\245/,\243\316#\272R\022Gs^\202\376*\021K~\034\217\276P\375\235\220-&~\201\256?\327\332\343\331\372\024\325\205\216\230\337Z\033\220\336\027\304\345\231\333"
+	.string	"\233:\366M\221K`\353\017\347{|\346\314U\\\357S\322U\256\304\"\"\f\006B\277\nF\024Fj\2401K\037'\370\366\325#\302[[\200\302\032\324\217\001\0313\227D[\020D2Q\264f\331U<\005\266\346\377\304\301z\372'(\217U\272pSA\004\307%nl"
+	.ascii	"\004H~-M\256ob\362b\3422\373?\016|\210\017\265\26543*\r~!\320"
+	.ascii	" \303\360A\030s'\026\331v\007:\332tI\373\023=\3450\370\034\304"
+	.ascii	"\35208\275\362N\323&\361\347@\252\230S<\361b\213z\"\003\005t"
+	.ascii	"h\013\357\333\214\3315\342\2748\riZ\353\330\033X\311\t\026\260"
+	.ascii	"\200G2\333\366\004(\307\177\352\237~\023\323=\335|w\264m \314"
+	.ascii	"\342N\204\216\305Y\316\0016\217\334\212i\202\370\236K\230c\304"
+	.ascii	"^Dl\251\252\276\240\3245\217G}%)nZ4\236D&\360x\3668\202\354S"
+	.ascii	"aA \030\034\034\t\013\n\300\364B1\314\330\202f\2323\375\221\204"
+	.ascii	"O"
+	.string	"u\f\366\r\236I=\306\025!\326\205\024\305F\020\340\025x\"\004d\270\263\335e\220\214\256:\371GJ\337\3216\220\252\370\361=\226\346\005w\326e\252\232\r*UQ(\236\244A\356\323Sq\256Y\361\357\205\026\022\210\323\"H\241U-j\035\027\004GFC\214\272\204o)\353\351\0011\365k\235\255\236`\311\025\206\330\365\r\346\275B\036\271Ec ,\273D(\263H\333\247\002\341\321%+\270\303\253\340\004\373\313\203\017T\263\341J\315Sj\315\221\357\210C\276B\204\353\236\367\272M\310zJT\273dK\020\265V\224\303\035\303>\324A\375\347\211\276W\350\320#\001\313\262\225\273U\"\340h \303\355\252\223a\217K?\226 \335\261\324ll\245L/\2079x\322\034\362\216\030\372\325z\tZ\270x,\264.\356\345R\324\244\237E\333\262\022\201\222\221\3470N9M\013e\013\331\2071\310\231\375^\313\023b\006"
+	.string	"\216\305\351\f4\262xW\221\317/Jq\314\026\023\377\fj\t{\351\345pSY\355v9SyW\303\201\332\260M\"+\210,c\276Z\372%\347\226\336\250"
+	.string	"a\254\237\312q\320\031\211\220:\300r\013`<\374\003\022E\222\276\260\207P?\013|2\025\325H'\031\222\004Z\313\322\243\347#\017\307,hf\361K\332\343\217\331\233\0022\215\217\342\314\232&\037\037\373\261\271\030\371\236\024\177\2552e\024\271NF\305\244\272o\342\242\025\313\204\375\363\371R\237\305\300\342KT\237\257\2022.\211\305\347\305tr+\245\2545~%\003;}T\0265z@\271Qt\f\316z\034@\305\231[\035.\262Y\217I\262\201\033\251\022a\251e\362\221H2`\237.\204\273J\b\231\356\020\324`\024\024\030\034\256\253Cb\250\362\316\270I\326\340\004\273\261N\317\333|\271\022\306C\347u\311\371\200\277E\354\330\315\215\025\263\217\231DM\314Q*\021\027\242\f\243Ml2\026\260~\237%\004\364A\215f\251\300\360\266\013\237&U\3106\213\254@\217KtN\275n+r\345\201=\274E"
+	.string	"\f,B?#\252\213\320}\227\200\334\220-vb\360\250\242?\376n\026\bh\234\2030B\307\304\220%\364&\"\345\004\372%d\353\357]\210~e?\210^!\016\263\036\266z\307\356\217&B\327\373\026K\347\265\342>\215^\\\203Y\037Y"
+	.string	"\240\237\200\261=mm\301\013\254n\261[\335'\355_\313\264\017\200\300\351\373\276\345-\021\321\304\265\262\331\203\331\371\243\223\311\204\350\232a\332N\030\026\004\217\206\211\334i\263\007\355\275Im\327\235\322\335n~\226\270aML\311\214'\034k\317\244\306cuI\204\355<\374b\272\314\n\342\3326\217\350\201\363\254\t\202\263\214\303j\031\034\345\342F\374\346K\016zJ\300<\224;7<t\2257\375\033s\223Z\214%\223H}\343\341U\020\233\363j\336\272\255)\022@3\201JqrW\214\261oHj\327\2364\213\247J\215\304\263/\360a\002>\231\023\"K\022\377\206\234\340\223M\344\244\367\357q\2714\264Tjj0k\223Ct\350\030\fc\255M7C"
+	.string	"\211t\240\257\353\307~\220Qu\235s\260~\037'U\376\307\276\205\371\310:\\\247T\253I@\354\205/9\347\331;\034q"
+	.ascii	")f\\\270H\f\037\202\005H\336\354\244\214\324\371\005\257P\026"
+	.ascii	"\022O>Q\022\220\006o\210\203D\316\200b}\332\207\n\246\322 \223"
+	.ascii	"7\241\r\301\034\341-\367\263\276\273H1^\206Q\233\201]F\320gm"
+	.ascii	"\352\221\216|Q\241\211&K\334F&\2011fT\234f!6%\261\223)D\203Z"
+	.ascii	"\245\263N\312mYa\205\353\275\262|\021T\361]\035/0\322,\363\324"
+	.ascii	"\322a$\227\337S\007\263\267]\323fi\264\315e/K\226!#\213Ku2\346"
+	.ascii	"#\0336\270\216\260\242\257\245\323\1775\017\263\f5\036\267\356"
+	.ascii	"H\354c\324Ol)\006TH\355\360VO\242\177\305\332K\302\315m4u@\341"
+	.ascii	"\377\363\217\206\377@\321\027j\027c\214\330UU\312\247\027\235"
+	.ascii	"\005P\036N\005\225\032\317\177\006\242w\302\245\305/\205a'A:"
+	.ascii	"\177 \273\272\345<\337\r\221\272\243\tIKp\225y<H]\320$\022\t"
+	.ascii	"\256v\203r\227\214\247)o`\2304\322\036\316>f2\235\353\366\r\342"
+	.ascii	"bx\273\233o:_\312\260\177B-\204\343\036c\270\276\2067/\333c\372"
+	.ascii	"\003\333\361I\200\300Q\301\203\376\030E\256\363\367%A;6\021\326"
+	.ascii	"\373\323n\375\364\224\343\361!\342\331;J\227\254\245\324\205"
+	.ascii	"\2149\b\024\025\005\347\022h\316:d\255\233[.\200~\334@M\231\306"
+	.ascii	"\364\240\003N\235\363\207Y\234k\371\246\276\004\311"
+	.string	"\265(\tL\243\313\f\f^\325\375\245\256]~\200\033\202:#G2a\n\304\224\314\217 \205\nw\336\265\332\206!\n\343F\002\316\271\022<C\232M\253y\030\271\255\346\272\022\200c\016:5\005\332a\250#\035\263~R\017\003\276\310"
+	.ascii	"\272\003\346>\343V\2705W\263\345\303b\333\331\352.\263\244@\302"
+	.ascii	"\200\225~\001\316\001\031\263:9\213\204R\315Uh\207U\320\321\341"
+	.ascii	"\337y\203\2145\231Y\314O\343j \035B\224yL\031A\347cH\320\223"
+	.ascii	"\303\027\321\274\315\260\240\367\342\234\225\275\302\263Yh\001"
+	.ascii	"\245\035\004\230 \270\275\210\334\202\344\342\305\221%"
+	.text
+	.section	.gnu.lto_.pureconst.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"\315\t"
+	.string	"\246[M,\260\262\244\320\001\274\331n4c\231\371?\350\234\007Yn_#\310\\\325\026\003\273\3737\277\177v\377\377\377W}D\373\207\257;#\331\002D"
+	.string	"B"
+	.string	"B"
+	.string	" \254\017\356\301;8\007\337\340\032<\203c\360\013n\301\251B\003\n>\301\222\340\021,\b\336\243\317\003w\340\f\254\005J\n\024%p\004~\300\rx\001'\340\003\004\022\340\n\024@\021"
+	.string	"ES\nM\024\n-(E,\"\326\020K\210\025\304\002\342?,\037\336\303\342\241\264\303\322a\345p\034~\303m8\325P\242\2414\303\222\3411\034\206\277p\027\336\302Y\370\nW\341)\034\205\237p\023^\302I\370\b%\021V\b+\243\225\361\221\361\215q41\2760>0\276/>/\326\272(\315Gi\\\234\266\305\322\242\224\305\t\213_qd\245\247\212E\305\247\270\024+\212C\361'\356\304\2338\023_\342J\034%qB\342G,#\036\276<><N\273\243\317\354(\255\216?\233|#\037\035_\220\017\310\367\243\2649>9\326\342\370\340\370\336Xsc\255\21556\326\326XScM\362\225/\215\322\320\370\316\370\314\030"
+	.text
+	.section	.gnu.lto_.ipa_modref.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`H\r\2453"
+	.string	"\212B\374\rBp,i8!\004\341q\350\022\262\332\200\345\347\340NZ\222\277\247Z$\23525\037\260\273Zf\330(\024\255\021\361\344p\302C\352\211\325\300C\216iW"
+	.string	"aH\250\344`\017h#\353^\324,\331[\312\024\272"
+	.string	"\332"
+	.string	"\316"
+	.ascii	"\265\332\371 \341u\261\267g\250\325N\\r]\f\027\326B\005^\n\237"
+	.ascii	"\340$\354*T\355\236\004'a\237m\262\022\243j\332\353\334\332l"
+	.ascii	"\216\021 \360\203\335\263Z\315\371u7;\370S0s\331`\301\016\373"
+	.ascii	"\351\323 \\\253\225Q\314\337?\274\n\236\340\211\330U?\265{\b"
+	.ascii	"\016\374\267\235\223^\243-\0303\267\230\021?\026\270\021\370"
+	.ascii	"\005\004@:\200\277\b\357\321\177Z:Ky\306\204\367LH\376c\275\343"
+	.ascii	"\277\313T\274\247j\302\373&S\274\237b>\215\026\373\037Kci\323"
+	.ascii	"\270?\227\345\277\313R\274/k\257\363\365\3034\332\323\357\367"
+	.ascii	"\347o\037\336\3772727\266\361\253;\205_@\201\357A\023D\304\305"
+	.ascii	"\250\024\373\312\212\332}\346\301\337\221\003\267\2427 \026\227"
+	.ascii	"Wo\027\335\270\rE5\224\266\256\346tX\327\007\260\035\232\356"
+	.ascii	"N\304KDt\210\231\244q\004\266;3\246\264\247\034F\372\310\031"
+	.ascii	"NB-\256\"@\250\025\024jY\365o\312|\244\214\251.0a]\t\f\025\212"
+	.ascii	"\261[\032F\024\241\027\243\220\3665\026\227\227Uw)\353rc)\307"
+	.ascii	"\324\262\374\016\342\361;\204b\036\217\201[\004\366l]\325\351"
+	.ascii	"N2\204\277g\376\307\257\240'2\254\213"
+	.string	"K\312{\360u\026\372:\365to\240@\2746\233\314G:1\252\236=\223\305\256P\361%M\206\f/\212\254\254\023\200x\317&\232x\355\331:[\307\022$\376\021\027!\363m\b\020R\373\301C\007&\016\377\277\264\2015<\bo|\251q\257,\b\265{\271\177\327\312J\225'5\332eu\024\260\306%}u.\207\252\235\365/\3513y\251L\221\222d \3554h\216[\365\215\362\357t<.\224#u\337\271\263\273\033\274\246_7\260\021o\016\307\334\203\212\215X\206\343\232\237\335f\020\226vJ\354\266\242\346P\004}6\331\024GB\367GGl.\315kj(\303)\355\363139G\3617\t#\376\356\312\274\204\327V\322(\236 \212#\210\252\215\342\221\223\273I\"I\372:\363\344\320[[u\320\205\024yd\231M\236:K\331\314\321\310y\231x\317\264L\\\2264\332r\037\226\331L\262\210\314\307D\242"
+	.ascii	"\f\201\224\350\376\241\264\325\273\306\362\242s^\305\364\004"
+	.ascii	"\016\177\223}\004/\241\312\330\313\247%\250%(\035\030f_\322\260"
+	.ascii	"\364\244C\303\354%\224\016\f\261\361\300\257\327\3069\212\302"
+	.ascii	"\273\013\007\251\307l\221\375\244;(lR\214\332\275)nq\207pk\017"
+	.ascii	"\b\n\373DG\257b\332@B\373f\037\374\324\235\026\261\327\315\266"
+	.ascii	"qb\223\227\315\0325d/\372\n\205\314O\203\346\f\027\377T/T\355"
+	.ascii	"\324\214\322\332tJ\214Y\267\352\247\356\312\024\373\352\250\330"
+	.ascii	"W\335m\325gT\3552`\215\013\n\273\n\275u\226@\374\375R\3619n\217"
+	.ascii	"w\353]\261\213\006\034\366.,\355;Tg\026/m\254\261\033I\267.\230"
+	.ascii	"\357\027\004\335*\227\257\227\355r\303\0161\314\331\250{\261"
+	.ascii	"\270:K\261\353\004\016\241\360ny\203\364\327\272\326\021\373"
+	.ascii	"\301\240\226?q\262X\002\201l"
+	.string	"\250!9tjFD\222$Ik\201\004H)\347\254\204=\022\200u1\246\035sJJRRR\250\2633\006W\020=\263\220\002*\213\206\274\266\262\364\177\254\334\227\257\202N(\024&\211M\005\225\340\260\226*J\370\t\306q\316\327\255ag\214\231\215GR\233\371^\266\331\340\314K`\\\220\376\305\270\2001\323\210\302A\325\355\274t)QY#\342\201\366\b\204\221\004|\001\036d\0043\b);v\223\331\377/\243e\326]z\035\213PE\235j@Mh\026\274\363\273t\f\322\270]\270\223X\"\277&\025Y|g\207\t\206\360\023bz\363%x\277 \240\324\200\264\324JPBH$\213\324\034\325\317t\361]\0056\302}\330J\361\311\374~8\226\305\274d\005a6\341\253\232\274\241h%\021\207{\374\270\314\321\213\337\021\314\231\211\030\3222\311\347  \245\226\226J\360\005\233\261\210\017~\225I\254\355U\306\243"
+	.string	"\",\305\036\347\236t\367\351\247\t\361\235\214m!H\337\340\237\367\375\307\364\332H\244\346\361Z\"\347\275n&\302\330\025\025\316+\324A\203k}w\212\"\002ng\311\242\360\324\222\352D\3109\031i\025\245\356\250#\207\273\356\336IV\003\271\315#\235L\342\271\307\025\256\r\005[Y=o\026\003\363\261\376\213\346:\251\311\303\336\251\215\351\350~8\244H1\272'\216\206 \214\367E\340\2075\225rT\205y\324\244\264\n\330\233\237\274\033\247\211\006$rEz\2045\201I\021\032\234\243\030\340\212-\336l\\\017\030\360\357\355\331(\326\202\234\211?1/6z\371\341\314SF\250iSdd\242\377y\227\327\267B\356\271\323j.\260\275z\241\245y\021\024>k."
+	.string	"\215\032 \004\2309\033\004\314cD\304"
+	.string	"\004\236\003,\262\315\263\344\257\242;M\342x\001\243\227cB_\354\241\226^\251{\363\265\004\235\300?\347\354\351\205&N.\365\030\370\306\306`\2268H\354\346"
+	.string	"\301\370?\314\031\371\2118Unm\024\343#\363\336\275S\233\026\307\375W\036\231\212\001\342\300\215\251S\201h\364\307D"
+	.string	"\r\211\247\373\321\206\216<\342!=\021\366\335\205\007\263J\317>S\332\n\367\335\250]k\267&\224z\017O\251\266{\236F\031\300\226\025b_%\333!(\303\200z3\017;<_\016\020Z\200 \217\025\303\364$b_\243\032\330\273\302\221V\310n0\256\317"
+	.ascii	"F5\262\377\233d\336\257\260\2169b\225\273\334\2574\227*\264X"
+	.ascii	"\027\214\004|\201|\326\317\264\272\354\303\332\3515d\246\232"
+	.ascii	"=\274\223\374.\246\314\202\354\365\371\2471\004n\371\032\275"
+	.ascii	"\275\230\337\016\0161\243a\302\013\272j\330\365\2561\261 f\275"
+	.ascii	"\034F\305\354f`\\xjAu\021Y\t\222SH~D\262I\305^f"
+	.text
+	.section	.gnu.lto_.lto.b84a98da57d3b9ef,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerNames.211.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`6\003-\025"
+	.string	"\326\344\211K\240\230Q:\301\363\034\214\3475.\353\336\203\256qrt\306\030-x\025^\2077\300)ZG\215\177\207\315\002v\370\270:*\350\323\311\365c\306\332AZ\271\022v\264\305\360\212\364!\276u\341\327\341\321\037\364\210\3346\266U\016B\322\016s"
+	.string	"s"
+	.string	"w"
+	.string	"ExC7\337\004~\333\f\351]\242\233\317\204\337"
+	.string	"\204\277q(<\t\374\016 5\341\026\335\374$\374\026\300\303w\221\360{@\216\nF7S\300o\0027|0OM\031n\206\200\337$\215\033~\027\220\361\323p\363\003\3746"
+	.ascii	"c\003\207\233\033\340\367\001\027\300\013\303o\004+\200/((\253"
+	.ascii	"\022^\202\301\374\245w\207\233E\374Np\362\036Zo{\322\332\221"
+	.ascii	"\f\377\362\241\030\024\223D%1DL\024\261S\033\205\301\021I\016"
+	.ascii	"\254\230S\240\233E&\fb\t\277E\361\203\250\204\337c\226\320\230"
+	.ascii	"\3254\304o\230.X\370\335'[Z\256\360\273u\262\205\0057f\ts7\277"
+	.ascii	"\n\277]VT\270\212\320\335\335\374)\374\216\251\222\302\357\027"
+	.ascii	"\224\337\215\302o\231&\300\353\204\3373J\200\343\260\351(\360"
+	.string	"\233\346H\004\t7\377\004~\327\004\250z;K\033{\336\326Z\272\342r\262\227\355\335\024Y\350\301.\024\r\031\301zG?\330\ri}\030\210\216`H>\337\021L\306\306vtrt\2632\007\364\262Oq\025g\361\026\177q\247?=\306g\034\3525n\343Q\307q\035\337\361\036\367\361\037\007\362 \027\362\251\023\271\221S\035\311\223|\311\231\334\311\237<\312\245|\312\251\334\212\202_\375\312\263\034\353[\316\345^\002\366\274\2550V\325\315\312\034P\313\236=\243E\313\236\332IsY\236\335h\333\322l\247\020\217f;w\250\317\214\215\355F\253[\240sYU\267\226\250O\272\312\322W\214\255\2512\031\017G'\247\306\322\314\031\017\207\001\357D\315\237\231 \227\375\341\321\231?-\233\006\335L\034/]y5U\245A\313\334L\306\336\314UMe&J\263\2358\032\033C\317r-]\326eM[\031@\250\021p$)"
+	.string	"\213\334Q\224\222\244\315\320\002\031+z\020(\2020\022\247\003e(\233\210E\275\262\027;|-Ay\252#\305\007j.\222\205\374\315\264\225\233\362\322H\020\346FMFn\022\377\206\362N\3631]\316s\317\246W\002{]9\355u\264\324\025\037rB\332\253u/\246"
+	.ascii	"v\"\372\274;K]\233*\326\254\333uW\246\247\352\005\201#S^\234"
+	.ascii	"\232\272\020}^\204\3431"
+	.text
+	.section	.gnu.lto_featureNames.212.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\272\003\025\027"
+	.string	"\366\351\230I\240\332Mc*gEP\222\342\315@\002\240\335!\312f\203\327\341\211Wx\2059\\,;\321\177\037GA\334F\227\371\260\237_\253<\326V\212\275\373};\215\354\355\215\361\020\030"
+	.string	"a\256\016\317z\243\371<O\263\306\bi2\311\210"
+	.string	"\210"
+	.string	"\203"
+	.string	"_\221\177q\240\354\b8}\212\374\233\323$h\207\323O\345_\035%F\370O\3717@\222!\231\026\225\004\234\276)\377\356\030\021\260\205\022\3414)\377\326\204\360\212pJ\224\177\007\3740\222im\035\341T(\377\022\340Q \313"
+	.ascii	"\326\004$\234\232\371\367\300\215\236\005\234\222\371\027\001"
+	.ascii	"\215%\f8u\220\177\023\310\310\2005\340\324'\377*\200\261a\206"
+	.ascii	"\345\025\306\"\214\211)}\324/\007\234\332\374\273\340\265w\230"
+	.ascii	"\371\255\317\265\306\236\002V~\345Y\256\345\\\336\345`\377\362"
+	.ascii	"0\027\3631\f^\3062\331&\353dA\330\324B\331\020V\204\035a\245"
+	.ascii	"l\tk\302\307\242\350\tc_\230\240\232\032T{\302\252\310S=l-\211"
+	.ascii	"\234\210S+\225\177c6\312:\345_\331\323\222\354j\013,\377\336"
+	.ascii	"\017_\371w\306zxW\376\245ym\206\314\020\346\312a=Y\026U\r\230"
+	.ascii	"k\345\337\231\027\253\374K\333b\203\345\201\016\247\257\312\277"
+	.ascii	"7UJY\326\026\004\234\276E\376\0050%\346&?}\332\324\020,uZ\374"
+	.ascii	"p\025\315\215\ni\232\372\252\313M\206\033\275\355\220Vw\247\b"
+	.ascii	"\364\351\034*\236\344wSy<G\024x\266\244#\"$\033Oi\311\306S\253"
+	.ascii	"\275\nEJ\266\013\275\236\222\215Vux\216\"\016\275\211\272\217"
+	.ascii	"\334\2018\365.\376\342U\217\361\031\267z\215\333\370\325q<\307"
+	.ascii	"u\\\353;\336\343>\016\344A>\344D^\344\\?r$\357\272\327\227\234"
+	.ascii	"\311\235\374\311\243\\\312\277N\345\001Ug\232\343wCo\267\017"
+	.ascii	"=\177r\342\210#E\235Y5\313s\243\272<K\035\255\236\243x\242%\220"
+	.ascii	"\0167\255\216\237\250\303}\342\312M\253\333\314\311D\\\230#?"
+	.ascii	"mSw\372\fu\341\030\236\263\n\366\304\252.\310D\307p\034?\375"
+	.ascii	"\231\250\220\316\251\346\326\335\300\017\025\367\3265\325\024"
+	.ascii	"\365\271Q0\034gu\367\215\346\026A\\\301]\312j\216\024A\375\005"
+	.ascii	"\351\022\207\216!I~?\267\235\252C\220,\003B\250!<\353\004R\021"
+	.ascii	"\314\254\242j\341\020\003\021\232u\003\020 c\270\n\322d\f},\337"
+	.ascii	"L@6:\312\027\231\2321\304\352k\200\232m\207]\257mD4ek\233\007"
+	.ascii	"\036\230w\002\325wHu~\367\261\337\373A\320yy\036\037&\210\376"
+	.ascii	"\263zv\274:\320\001~\324\021cEj\34214\250\310y\330\034\351J\013"
+	.ascii	"\255\305&,\225\314\355W\356\322taE`\314z\nc\311\253y\311\003"
+	.text
+	.section	.gnu.lto_rxFailsafeModesTable.214.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375 [-\002"
+	.string	"D\003N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\002\005\001\006\025\177\001\001\003\005\001?\202\210\200\030}3\276\0014\275\001\274\001\273"
+	.string	"\300?\202\210\200\020{3\301\0014\277\001"
+	.string	"\006"
+	.ascii	"\200\b(\327\316\t\340\\J\353\030(\002"
+	.text
+	.section	.gnu.lto_sensorTypeNames.215.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"e\007"
+	.string	"T\f\331"
+	.string	""
+	.string	""
+	.string	"T"
+	.string	"\005\001\006\177\001\025\001\007\005\001'\002\206\b}\005\001\212\001\206\200\200\374\233\336\320\313\n{\275\006\005\001'-\206\by\bw\300\005\005\001'2\206\bus\303\004\005\001'?\306\003\005\001'D\206\bqo\311\002\005\001'J\314'O\316\001"
+	.string	"?\202\210\200\300\001m3\317\0014\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\001\274\001\273\001"
+	.string	"\bGPS+MAG"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\004GPS"
+	.string	"\fRANGEFINDER"
+	.string	"\004\005BARO"
+	.string	"\004ACC"
+	.string	"\005GYRO"
+	.string	"\020"
+	.string	"\270\212nv\201y\212\033\260\004\340\032d\f\b\203\214U\305\037\310\r\220\3103;\220cA%N\261o"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_sensorHardwareNames.216.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375 \233\375\003"
+	.string	"\264\006l"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\203\344\364\031\001\177}"
+	.string	"\005\001\006\025\001\004\350\317\001\177{\003\2507\177y\002\037\177w"
+	.string	"\002\177u"
+	.string	"?\202\210\200(s3\302\0014\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\007"
+	.ascii	"T\021\002\344\326\034\004\362\2659t\235\271\r\240\b"
+	.text
+	.section	.gnu.lto_mcuTypeNames.217.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\200\001M\r"
+	.string	"$\026\314\001"
+	.string	""
+	.string	"\250"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\340\316\n}\273\001"
+	.string	"\005\001\006\025\001\016\005\001'2\330\365\004}\276\r\005\001'@\230\365\004}\301\f\005\001'N\206\b{\330\364\004y\304\013\005\001'b\206\bw\230\364\004u\307\n\005\001'h\330\357\004u\312\t\005\001'n\230\357\004u\315't\330\356\004u\317\007\005\001'z\230\356\004u\322\006\005\001'\200\001\355\004u\325\005\005\001'\206\230\355\004u\330\004\005\001'\214\330\354\004u\333\003\005\001'\222\230\354\004u\336\002\005\001'\230\330\347\004u\341'\236\001\206\bs\230\347\004q\343\001"
+	.string	"?\202\210\200\370\001o3\344\0014\342\001\340\001\337\001\335\001\334\001\332\001\331\001\327\001\326\001\324\001\323\001\321\001\320\0015\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\rH743 (Rev.V)"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.cX)Y)"
+	.string	"\023 Unknown)"
+	.string	"\005H750"
+	.string	"\005F76546522"
+	.string	"\005F44110X"
+	.string	"\005F303"
+	.string	"\005F103"
+	.string	"\nSIMULATOR"
+	.ascii	"% `\203T5\006Q\214z\325\256h<\026\243F\"8<\tc\374\260G/!\373"
+	.ascii	"\232\227\037\363\362c\236\363\373\3465g\335\224\254om\262v,\266"
+	.ascii	"\372\326\263\336Z\326\231\313z\346Yck\267\254\025\366\033n\021"
+	.text
+	.section	.gnu.lto_configurationStates.218.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375 \256\315\004"
+	.string	"d\bT"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\370\316\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'0\206\b{\by\276'A\206\bwu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013CONFIGURED"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\020CUSTOM DEFAULTS"
+	.string	"\rUN\006"
+	.string	"\211`\215w\001\332$\3153\214\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_cliWriterFlushInternal.219.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"-\t"
+	.string	"\246\320>80s\322\001l\006\276\344aj\316h\307\030<2\363\021B\245\263\032\016\204\305\031\227E\213\266\200m\234Xm\r\b\372\032\234\256\001\353l^\253\323\342~\036\315\222\275\267L)-"
+	.string	"-"
+	.string	"1"
+	.string	"\217P;\377\262\003\274<\326\343\307a<\310\251I\021\360\\\021\001$\344\345\262\353\206\327R\0251\354\256\365\345y\334\362\266\033l+\330\246\t\266\257\366W\316\322=\266\372\300.L\007f\367[p\302\350\322\337K\332\345\350\004\332\245;\233\347\037\311\212JL4\\\200vw\302\221w\001263\027d\251\207\3031\003\275\322\024\032\234\250\264\354\2704\310\376X\nE\354\307\335]C\230\375\330\257\262\300\347\346\241g\267cHhg2\006\205\024\334I\205\342,4o&T\3046'P\020\022s\343*\246\251\344\024\305\211\233\252T\212\233\244o\037\027\302\354\3603\313\200\255\030U\241}\201\241\1779 \017"
+	.string	"\357b\314\304\023\277p]\0034\302\212F\265"
+	.ascii	"\004\016\rA\ba\025\314\273\004\320\254\246\210\273<U\223S4\265"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cliPrintInternal.220.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"%\n"
+	.string	"VRD=0\345(\035\3005\310\237\336\013\237\024,\307\2252\320\320\022b\311=plM\020\265\220\350K\273\343c\237\302\2658^\353&^\034\fH\300A\035g\344\203D\035\305\022J\032\331D\356\224\0022"
+	.string	"1"
+	.string	"4"
+	.string	"\235\212|\361\273\246\361\363\037~@\005\236\256q\034W\215\363\321\022+"
+	.string	"S\332B\314\004\344\341\343\nD\305\250q\330]G\025\270q\313\333~\260\355\261O\020.%\266\277\261\035\347\305L\341\321~\312U\276\273L7\330e\301\274v'\203\023\270K\317w\266K\356\234\355\322\237\035\340\263\265\232\021\224\f\026\002\273\033v\311\"^e\251\247\206\226L\200\332\264IE \031\260\002 \025e\366<E\ry\235\2043V\226\375\371ow\375\362\363V\356\240#\006BfWcV`a2\036i\244\036\210\024\362J\233?\236\220\304\247\243\bELt\037o\324y:\026U\200\274\216$\022y\335f\356\225\025\236{\361\200a(J\323\342\246\252+[\306M\245\006\023"
+	.ascii	"\357b\310\f\355g8\004\207\\\360\n\227\262!T\277\241+0a-\027\034"
+	.ascii	"\204j\213\025\306\003\325\300\02507@E\031w9\252&i`j\017"
+	.text
+	.section	.gnu.lto_cliWriterFlush.221.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375 \362e\006"
+	.string	"\002L,1PO\323\001\240\363i\275\242hT\b\324D\032Xg\221*\247\031\216!\260\021B\217\205\2000\255 \243\b\316L\271\371z\271\2460A\337\335\204H\231R\206\322D\3017Q\3601L\t\013\017Z\016O\np\325\240`\275\207\252\262^\324\355\225;\020\301hJ\341'\2576DD>z\240B3\373$/\231\360?,q\345\343\035\377z\356\\\rT\\2\264\314\330]\226\272a\277Y\345\354\247\337\b\204\244 \260\354^d^\026\343\240\200\330~d\314^y\327\261\220\307\211\205I\313\356>\3458\366\304\374\217\034 n\331\023*\330]g\3340n=\201m\215\t"
+	.ascii	"3\00178\203s|\241k8]\b\3762.\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_cliPrint.222.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\265\007"
+	.string	"\322\31766Po\322\001 \033\273\325\373\314(\025\211\354\215\347\255\270\231\002D\333\275C\205\032A\314\356\310\222\303\331f\314\225\214YFu[9 \356\314EVf-\355&eJ\001X(S[\037\220\203\005!@\f\017\320\3022\370\361\370\212h\300`\350\2720\330\211\373\314jg\205\322i\244\026\326\244\352\325\316$\362\234\007.t\263o\362\023\n\377\303\023\242<\367\347\213\252\277k\002*dc\224);n\251\034\3663\273\273\326\316\276\351\327L\377\t\210\274,\270\354f\244b\366\364X@:\266\237\366GN\242\335Tq\200\335\256\244\262\033\017\\\260\371s\274\247\372\333<\240\372\263f\243\036=\366)-\030(0\273\013\265\343\332S\363_r\016G\332\236\032\204\335ur$\215[o\233\300\266\201\355\225\t"
+	.ascii	"\357b\310\304\253\276h\217\013;`\324%\254f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliPrintLinefeed.223.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"r\213+3PO\222\016 [n\325}\225\231\021\327|@\220J\026\305dX\257fc\304\332\036B\242\304\243\331\2646Fd\226\310\016\255\344\f\016u\3248\364\232\335D\246\017\020\340\323\206\3630\271\bN\003\204\233\252\t\2671\230\222p\250\034\005EUN\302\262\bzA%\313@\215\243V\221\216T\024\2042;}\026\001\235\004M\243\277\300h}\267\025\224l\003\257\307\256\206\036\337L\"\350\361 \245\205\241$\323\023\003\223Yt\002\362W\332z\227b\241\254\t\013\007\311Kf:\374\250\325f\335\206T\340}\2566"
+	.string	"\205\314\274\275OG\307\376\b\277\346\367\004\t"
+	.ascii	"\357b\310\204\006\340q\200\013\3335\221,\004\3742\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_cliPrintLine.224.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"M\007"
+	.string	"b\31624Pm\323\001$\213\363+ZIAT\220\246>\234\212Fbe(\243\324\370\307\216\020\212\277y\003\033$\005@UD&\324z\206\262\375\223\316\342\355\377n[\246\024\025\310z\235<\237\205)6|\022\030\342TY\321\303)\345\240PE\020EUq\303\335\322\237\326\003\225n\342\205\212\311\326z\350\220t\241\207U\312|-DD:k\212\214t\024\017k9,\037Fk\351\377\373\264\326\233\235\260\223R\202\200\362[\264\260\274\203!\033\233\266\316\326\034\356\270\274I\030\340\327F ?W\320\201\214a9s.\206\031\007\\\f{\265'\3464\356\017\223\n\217\225\377\361e\370r^\265G\326d\"\314\2111\370\337\314D\027\356s[\201\266\004m\267\n"
+	.string	"\357b\310\304\023\276hq\241\264\031\\\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliPrintHashLine.225.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\355\007"
+	.string	"\222O76Po\322\001\240^\271S\362t\345\254!\367\006\322\265]XY\030\270F\032#F\020\347\2166~8\333\214\241@f\\\025\366r\241\250\237\352 l\243&\215v\223;\2456\350"
+	.string	"\004\304L\024R_\037\320\303%#@\r\020\362\312B\362\3031&\341\220I\021\206er3\367\230U\317\013\036_\206j\270\202\252\366\004\252\253\340\347M(\004J\273\243s\025\326(\001\341\321\266\270\200\347\fSR\337\206n\366\334\240~\330\307\354\356Z=\373\246_c\001I\205\201e\267#\345\262_<\211ll\037\332\0379\211v\023\306\007v=\024\312\356\364\370\300z\364<\247z\264NP=Z\263W>K\233\ty\3418i\331]\251 \327\0165\377%\327p\335v\230Q\330]C\256#\335z\333\035\333\036\333\247\013"
+	.ascii	"\357b\310\304\263\276hq\241\202i@\352\352\202!\227`\233\325\024"
+	.ascii	"p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_cliPutp.226.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"u\b"
+	.string	"F\321;5@\217\322\001\2335R\376O\231`|\022\270\027\254\340\n\320~I\260ayT\266-\001\360S\tH\2118\3270,\254:8A\371rx\307k\353(\371\204H\231R+"
+	.string	"+"
+	.string	"*"
+	.string	"\031\017`\234\265kU\374<\256}`\230JZ\376o\331\341\316\330\325&1\300\tE2j\f\377\213'\224\206\233nk\3206\241\255+' m\255i\233\330*,t~\025\315?e\302\372\317)\202\261\265\210G:\257\352\262\300\257\na\375\217\323\203\214\263>o0\316\002NLg:\003RXL/%|\265\217\204\311\321\032\373\377\246\252\365\312\316\374\354L,bXk\004)\024\317\312\237\361ry+\013\036\016C.\327\371@p\233\304\307!b\343D\243\255\263)(\364 \332&@ \321\246y7\366T\265a\243UJ\213j\210\231e;\242@\237Zp\221\244\006\n"
+	.string	"\357b\310\304\213\277h\300\005\002\346"
+	.ascii	"\346\032\373*\fVP\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliPrintfva.227.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\025\f"
+	.string	"\266\226RA"
+	.string	"s\233\016\270\007\350\n\372Dz\321\n\300\037O\214T1\254ozI\201z[\242NV)\232m\370Ap\016;i\300\rFH\336U\257\022\024\240\305\004[\003:\032\353\252}\036\237>\331[\312\224\002@"
+	.string	">"
+	.string	">"
+	.string	"\321\232\375\343\236\211\305\240\b\261\322\002dw)-q\355PS\363?z\206\353\266C\017WX\200G\016\025\002:\025x@\304\210\031\037=5t\240LL\203\335ur]\207;\336\266\003\333\f\354?\b\242\037j\372\023G\244\343\262\261\313\341e\310~\261F\n\333\327\330\316\364a\260`\360\261\300\367\354\314\243\023<\355\267\270\013\355\242\f\037\260\033r\241\261\353)0\202\351\321\3367\322\343t\002\322\003\334\325\256\340\311s\006\200c\305\267\242[v;6\334P\247H\327\b\243\036*)\304~\313e\244\370'l\001%\317\241H\217W\375\340\022\004\304'_loK%a\037\356\356ZC\366Y\376\370\325\205\264HL<\006J\262j:\251:\031&A\2625rM\260(\nW\325\241\254\314C\215l\214\231\220d\324\t\206e\224\306\333k\310\020^|\037\005\301"
+	.string	"i\227\\\034\026\037H7\213dT\250\217\321\301\246\335\317\003\025"
+	.string	"\357b\314\fmg2\207\241\n\277\267\b]@\324* p\210\020\256\021\003\301\004+\256\261\3130$\230\006\256857f\240"
+	.ascii	"\025E\334\345\251\232\234\242\251="
+	.text
+	.section	.gnu.lto_cliDumpPrintLinef.228.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\321\001\275\021"
+	.string	"v\342yH\340\360&\035\330\310\344\317\322\007\3260C\250\203\233\340\271\3574\202|@&\327\247\223\013$et\254\354\270p\375[\327\2003~\3706\332\034]S\205+\304\003J\266C\305\351BF\212J \032P_\002\016\023D\310\3362\245d"
+	.string	"`"
+	.string	"g"
+	.ascii	"G\341zP\006\003\330\335\201a\264;\242x\300\367\256\344#\336\273"
+	.ascii	"y\021\357\235m\0278\340\362\353\243\b\234\016\016#jh\271\335"
+	.ascii	"\021\224!\376z7\245\276|\017\021\366\316\303\347I\244\231%\273"
+	.ascii	"\013\"\312TN\0034\271\017 bl\006`\252\211q\332\365F\224\251v"
+	.ascii	"\250\354\256\325F\354p{\267\355\300\366\212\255'\001\222\307"
+	.ascii	"\376\320\377}\374\273\007\375\323j\365\324\377\370\221Q\356\006"
+	.ascii	"\205\243]\234\246\0343I\235\213\237\027\335\276\n\337\346\223"
+	.ascii	"_;\221\353E\255\257\206\034\006$|p\2739"
+	.string	"'\357\254\340{\367\221\344\266\313>\331\236B\237\271>\204\201$de3\037#\004\343'\365\343\213\3448\210\200\220P\276wV\265\017\024!*\274\345\226p2\t\363\207\316\370\244=\241%uK\362\320\223\177\305m*\001\033v\3676\366\nFo\343\333\376)\335\220\226p4\022f-1\003\2048_^'Yf5d\312t\217\260K\235\237\024JR\366\330\304\273\2140\243!S&\207\334\304\233\362\362\264\023xq\233\311\250\351\304\264\311\036a*{\354\317\335]\007\341\005\225\tU\254\025\213'\343\322\nYR+1.a\013&\365Q!&l\360\242jI\370\214JiqA\201\026ZB\025\210b\305\200)#^\275\244X\240\314j\305\002O\343~\256\344\361iG9Q\253\311\263\370m_`\303D\255\305\374_\236\312\033\333*\2552#c\357Zsw'\001NH\233,\242\366\003\bG\273\204\213I\230C4\037"
+	.ascii	"\3571\270\026/,\013zm%nv\005c\315\017\321\242\"\b&\2129@fTC\242"
+	.ascii	"\226+RH\200\205\004-\230|\030\204]f\353B\212\213\f'\362h\357"
+	.ascii	"\bK\201\234R\301\340\n#\006\027\341\016\002\332L\020\304\273"
+	.ascii	"\252\\\357*{"
+	.text
+	.section	.gnu.lto_cliWrite.229.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\315\t"
+	.string	"\206\222C;0%i8\336c\317\037\332$\036,\177\314 &\317\270I\361(\256UT\365\007c\307\316hF\210\335\024\245@\254\016@\334\3603\202\300\214la\025\247\250\243V\224*\261{K\231R1"
+	.string	"3"
+	.string	"1"
+	.string	"\273\236\242\034<\247\t\372\247} \024Y\347B\256\334\201\316M\013\201\370\342\022HLdN{v\210\256L\220\303\356:C\021\344\356n\373\301\366\202\375\007\231NM\037d\020\3031\305\354~\334\b\254\255\243a\261}\221\355L\233\324"
+	.string	"~\266a\335-q\231\331\035\031\254\020zg\320\006\3601eA+5\030L\200\r\260\002)\346x\330\250W\237\253\304\013\317+\007\330\257}\\\371*\326P\345\303w\276\352\363\356\252\";\002b\255\274\331#+\365\304>\267*\263?\373\273\024_\372\033\225L\237gQ\212\250\360>T\312\033\025\370t1\201\3622N'\224'\032\367\334\252\314\020#\266\226\272\270P\246^m\214T>4\002\207\262\334i*\251\247&\017"
+	.ascii	"\357b\314\304;\240p\t\006(\343\025H\325\034|\r\261\027\324\260"
+	.ascii	"\240\013yK\306>\225\032'\356\334T\355L\321\024\024"
+	.text
+	.section	.gnu.lto_cliDefaultPrintLinef.230.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\356\001u\022"
+	.string	"\346#\177I\300\322Q:P%\254\333;\350 \243cP\220\201p\202\337\260\206\231\001\017\303A\237\302\317.\030\333\020\214\216\177\324_\263Eo\363\013\373i\263\3610:o\013\035\367\006\343\235rc\234\263h`*\262\034b\377\254&do\231Rl"
+	.string	"d"
+	.string	"l"
+	.ascii	"Ag1\273\220\006\253j\355QB\252u\\1\201\324\277\223\263\300\177"
+	.ascii	"\364%\340?\3336p`f\332G\023;!\035bp\320A\325:\206\263\304i\377"
+	.ascii	"\350\\\232\017 W\373\007\342\224\246\220I>V9\034\312\332A\201"
+	.ascii	"\033\311\335vR\026\023\211\247\221\034\016M\021a\343\303u\337"
+	.ascii	"\234\234m7\244\245\326\352\305\345<\334\340mC\260\355b/\203\237"
+	.ascii	"eY\226\236>\366\213~\325\307\377\273\320O\275^p\375\221+\215"
+	.ascii	"P<^e\255;e\220\233\245o\006\320\217n\337\205\317\363\312\337"
+	.ascii	"\335h\366#\331\353\006\236\006'zd\255<*\377\254 \365\357\243"
+	.ascii	"\311\355\231\275\262M\207N4{Q\006\023\222z#\002BB0\246\346~\244"
+	.ascii	"\231\374\307"
+	.string	"RP\215\225\324?\357\332\017\022&4E\221$\333\244\232\266\330r\365\220DV\345\177q\236\005\001:\265\326\343l\230\030\261g\024E\342\314\232U;\340\246\001\3320\232=\316\347\375:=\025K\267Y\263w\264\270\201\203\316\037\237\006~sS\334c\355\233\324\203i\304\234?F\001?)\0209\335\026\210O\216\002\322\371y\335\013\254x\262\345\330\205\260mi\217\265\235?v\"\206\265\021eb\260\027\320\346%\023_\\.5/QF\343\022\211\251\021\035\314\310\310*\244\334b\201y\265\302\0130\242L\330\212\325\204,,\303f\\\261\320\006\006\213\205\253\261\236\326\351\343]\335W\234v\273y\030?\357\013t4\355d\320\237\006\356\314\261\275\323-7\323vZk\255\237\214\326\332\223\200\034\332\322\001\326~\020\201\214\"m\263\346\222\r\" \200\202\031\301\365\237\030x\211\027\243x\265A\024\020\266\017\302d\347\300 \225\255"
+	.ascii	"\035\210m\2170\271\202\035\310\031\306m<a\234\316\b7E\036\361"
+	.ascii	"c\333@#\216\024\336\335|{\307\227\"\247\016\346\025\006\203\013"
+	.ascii	"\356 @3A\342\025\267\240Q"
+	.text
+	.section	.gnu.lto_cliPrintf.231.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"U\n"
+	.string	"F\023F< \345*\035 \325`OJ\344\212\001\262\301\320\216\314;\025Fd\200\002*S/\030\226\274\210\b\266m\262\r\2434\225A\025"
+	.string	"B\0245\223\340@XP\\\221\236\202\303m\215\033\355\235R0"
+	.string	"4"
+	.string	"5"
+	.string	"\324\365\236\355Ts\201\355\324\237-{\035\331\257\3104Tf\273\313M\221\177\227\237\377\3307!\013\274\314 \354\256e\310\352\270\347m\033\330\006\331\027\005\313Q\013\240r\241-%\207\375\366\0373\307\257G\371\016K}3V\t$\263qw\3659\365Gs\372\201K\373\256\237|\177U\274\263\333r\261\354V\220\0174\017\2407\222\340eN\273{\360\210\037\233\374\374)\217E\024l\204\366\004\205|\350\216\350A\0331&hWP\316\020\373\230\335]\317\226\375\327?3\027\353\f\300\251\266\001#\t\211\032\231\274na3)Tj q\247\322\310\304\221<\b.\344q\347\240\340q\250\256\3638N\335cv\266L\305J\033U\323\302)\314.\210h\204\311\232\003d\211\301\2046^\314\023"
+	.ascii	"\357b\314\304\2131\\\340G\355\230`\203\304E\300\003\0326J\n\b"
+	.ascii	"\203\350\370U\023\230]S\320p9\234u0n\236\242\002\356\362\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_cliPrintLinef.232.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\335\n"
+	.string	"\006TI? \305j: \325\2407\001\0025\3108p\005\217{[\004"
+	.string	"\261\f\351\001\204P\304\036j\324\212\226\320o\315nj]%\265G\205!\200n\002\250\002\261\223zS!\035\024 Q\023\223\240\275S\n3"
+	.string	"7"
+	.string	"7"
+	.string	"\013\3357\227\347p\337\272\033p\337,\332\004^\256\366\001j!/\263\335\365j\312\305S\321\377\353\03125\236\0164\354\256)\231*\271\353m+\330\366\330\177\b\263s\003\300.I\255\200I\266\t`\335\365\333\242\377\262\306.\337\"\336U\372\202\240\034X\"\346.\252\363\315\235\356\333\017N\355\257\234E|\253\343\233]\025,\266[z\034T$\001\243\231\036ut\206\"\f\250\325\006-8\247\nG;\277\313_\030\t#\244\255\301AOzs\256h\346G\035\355r\244\025\305>fw\327Ue\277\365\327\356\247,\240\fJ\002\215B0\202\363\367\021M|\036\205\b4\362\276\360\302\373p\fV\204B\217\004\202\241\247)\367\230\255*C\230\310L\365\344\022f\367\204\301t\321\232\013\250\375\205b4\363TG\023\004\024"
+	.ascii	"\357b\314\304\023|\270Q\213\017\263\340\2070\034\220\270\bx@"
+	.ascii	"\303FI\001a\020\035\277j\002\253k\212\310D\334\251\200\301\020"
+	.ascii	"y\212\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliPrintErrorVa.233.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\267\002\345\023"
+	.string	"\326#\201H\300\324M:h\026U\032K\250\215\245\223x\354[N\250\363\317.\272\314\224U\024\277\332\2001\266z\037Wd\032i\371\212o[\307\212a\230\231h\224\201e\222u\032\206v\372\215\t\344\364Y\220\247\343R}\263d\023)S\nh"
+	.string	"a"
+	.string	"s"
+	.ascii	"\366\223\256\244\373R\210\017\330\035\232\232\261\373K\261\002"
+	.ascii	"\327\243\1777\t\037]/\020>Zg\003\371\257h[F@>NW\273;\323\025"
+	.ascii	"\327=\214\240\246\316o\255\220\364|\273\207(\036a>\036\030\333"
+	.ascii	"\335\236\004O\\A\004;\250Z\300|<`\202\024"
+	.string	"*b\334\3519\302\267\223\331Z\331]g\317g\342n\335\366\214m\nv\376\b\376\213\303\310\361Y\270\346&\337\273\t\037\257'I=\202\224\200t2\313\376\355R\211\354\203\273\273\326!\373M\177\311\177?\354K\377\013L\207\232\216\232\0065\255\232NM\337\300\211\b]\005\311\211\332-\221ed\253b\r#\333\177\331\316\364\231\232@\034\020\260<LA\016|\0276\311\243\031\374\216,x\006.\336\013\312c\304\021\365D\251(H\311$K\324\256`\2016D\004\226\025\217\356L K\024\246\177\272\200\301\265\253\363\036\2506\255\346s\003T\375\211\302\262a\213q\361XP\036\225\206j\013j\352\245\031\353\321\035T\252\376@!\275\362O\2271\223R\264\313{\357\346\342=@\261q\036\362=\003\240:\252\352\321]\372t\220\230R\347\204\327\fL>x\262\210\003\226\311d\240c\r\324\261\226\b1\030\027\030\030\b2\231,"
+	.ascii	"\355C\326l45\261\230\034\315eC\273\345p\033B\333\215\326\242"
+	.ascii	"\341Vk\271\246\"\303\2416\353 C\273\315j\271\232\231\212\211"
+	.ascii	"q4\266\334\314\006\207\313\315^\277=\270:\024\211\baY\351\350"
+	.ascii	"N\250D\307\tyHh\035I]\t\321\311\254\335\335E\2340\254z\016\034"
+	.ascii	"\026\027\337%|\fU\177\244\220@\252\227\t\0016 \340\002\0211\343"
+	.ascii	"\006\277bL\216W1\321\226o\204u\035\352\346\232\330\356\026\363"
+	.ascii	"C{\031x\226\3240\026m\346\255\034\316,\304X\306\367\030\305x"
+	.ascii	"Kh\276qyq2\006\207\355\026\233\305<\021\313\265d\036\303\"]\227"
+	.ascii	"\234\313U\035*W\245@\"Bx`\214\275\026lc\215(8\316\203\031\346"
+	.ascii	"\n\232d\260|n\300\211\"^\302\001\013+77j\270)\305\331\003"
+	.text
+	.section	.gnu.lto_cliPrintError.234.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`e\001\345\016"
+	.string	"\226\033cD"
+	.string	"\261h8\200C\024\276Ka\305u\352m\363!\240\251/\024V'\013\343\225o>\2754\303\363m\036o)\225 \013\026x\177Cb\333\316\257\252\004\201\216\351\312L\306\035\314\274\376\n_\336\241\332\275\367\2262\245M"
+	.string	"K"
+	.string	"R"
+	.string	";\212\030A\347\232\307\177\266k\235\023\330\256\231d\343|T-\267z\351\320z\355n\247(Nz\246I\362\337:"
+	.string	"\021Uz6\342\232-\250\201*!"
+	.ascii	"\245\222yD\340"
+	.string	"\310x\353\351\001\225\222\311=\330]\247\210\nqk\267Mb\273\201}\233\317vw\255)\373\343\317\235\365o\232NM\337\363\035\373\2721\262\261\013\"\226c\272\321jV\227\371\355\277e\217\017\363\030\322eF\337\023\013\311\212\345\332e\t\271f\005\235k/0\346$x\332\177y\013\322Y\034\376\261\233\242\201\261\001\3322\3036&p\250Pu1\312v\225\020CC%u\330w\361\027(~\nW\b\345\305\320v\355\252-1X\2200e\314\036\t\242\342tS\033\f?\260\205\271NZ2\227!\377\314[&\006>\210v\206\ry\321\0379^0\327\212\226\354\261\224\352b\007\366\b\240\236\206<\361@QHa\003\201\036\204\t\340\307\371\033\tY\370\272\013!\017\354>\221I7\362q\210\001$\352N\302P\324y\306}\266\232*Yqc\322\024\217\262\335\023\016\\0\031\313\006\344g^\023AD\265{\272X\32291"
+	.ascii	"\261\275\357\300\212\226h@\251\001  \220\202\021A\273\001\377"
+	.ascii	"bL\343\205\021m>\3679\262d\335\336R\035F6\373-R\316\313:\346"
+	.ascii	"\007\316\036\336\216Gp\214o\340\326\220%\"\022w@\nw\355\354\202"
+	.ascii	"]\016\254\177\034C\016\3155X#\002.\212|y\322\344\024\315\357"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_cliPrintErrorLinef.235.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\305\f"
+	.string	"V\330WC\020q\233\016L,z1\r@\361F\013\236gw$\204(\030@\361t\367/@\t\007\316\261\314\314\226P[\275^\310\"+\2017\235P#\210P\221\245\344\2129\367\244\027AB9\357\001o\337\2156\331;\245A"
+	.string	"C"
+	.string	"G"
+	.ascii	"O\361]\004t\314\256\350\244\305\356x\300\005\256W\217\317T\257"
+	.ascii	"\327\003"
+	.string	"T\257\376\354\031\037Gk\221bt Qv\027\243&\376}~\376\311W\304\020\360\323b\260\273\236b\210\210\233\3366\001\333\n\354\177\b\324\356\256\251\310\376\370\327\213\374\024\235~\3457\026\245\006H\306n\210\223\215P\251\276 \275\344\267\177\322\027\177\344$\337K>\276!H\003\322I\271\013\302y5\202\353\365\232\021\244\001\260\033H<\030\370\264\217\"\t6\266\366\031p\025_\221\301?a\t\333\274\270U\257\247\017h\230F\204\346\311\226\271\031UJQ\233\3532)%S\031R\320\326\344\374&';\004\200\330\335\213\266\005\f\363\2421)0L%\007\n\332#8i\t\373\001\266p\320\354\302\364\3108\257\213P}\270\314\001\004N\263\254u\266\t\032Fa\3138L\363:\260N\306]\205\217\207yt\235\207]\306=\265Td\217\213R\210j\360\007\265KbA92O\306\314\233\234\205g3\332\r/fW\030\026"
+	.string	"\357b\310\304\273\274h\361P8M\214\244\221C\004\213\306)lc\0134\214\224\360\022\025\312\271f\027\314\345p\326a\034\023r"
+	.string	"\206\301\260"
+	.ascii	"\025\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_getMinMax.236.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\024\003%\023"
+	.string	"f\340qG\340\262(\035\333\271\017\001\252A\265\356\233\251+\346\002\0210\326\210\005\tb\007\002W\344\330\016\362q\373^Om=\231\3173\333\346\024\217\337"
+	.string	""
+	.string	"\346a\230a\306h\204\223\213de\3214V\301\311\257F\b\331D\312\224\002Z"
+	.string	"W"
+	.string	"`"
+	.ascii	"\366Y\274\305\353\266\224\017\330\205\321\201\263\033\222\030"
+	.ascii	"\301\367\350\360\247\356\361\273\251{\364\313\006z\030\263\236"
+	.ascii	"\314\017\331M\221\335\005\265\366\327#\247\371\362\017\224\250"
+	.ascii	"1\243\301\036_C\334m\316\2558\332\231\321N\\U8\003\273\013\200"
+	.ascii	"\266\222\351=\330]\347\214\326rw\267\r\3016h+\211\273+\016\374"
+	.ascii	"\233\f\036>\025)\335\3435\312\210\320\330byd\207\260\324\024"
+	.ascii	"\366\271U\030[\323\246\327\374\002\036\376\001n\373Gb\232\324"
+	.ascii	"\245\277\230\366\272t\027\323\221Ks1\255\\:5}\002\030ZzF\360"
+	.ascii	"\354\262\034\021\355-\346\310\330~\311\256)j\220\241u\200(x\006"
+	.ascii	"CfBRU/3\212\245\236\243\"\211\361\311mh@\375\254\216\263\341"
+	.ascii	"\361\364\223Z\252\005\t=\306\013\354\270\301\262(w\027\246\246"
+	.ascii	"a /\310%\217\352d\3703b\220\231]\3730l\003}\273\260\243p\316"
+	.ascii	"\226ehf_v\301\243Ios\006/+id\357"
+	.string	"\250\356jR\247\314E\305\254\273h}\001\"R,EY\261\324\225\n\241V\225\2548\250@\224U\212\005\252\\\037\300\222\223[\035N\\ \210V\313\005\226\302=\267\n\343\317\307\304-\246*\221\364))\302}zn\237\220g\322\251'\341>&$\240\360\036\025xtJ\252\031\321\274x\362\004q\361\002\247\321\302s\354\340(\325\210hl\252\276\216\211o\214\370\326\351\036\037I\250aP\004\225RC\023\244\240 %i\306\300\002\231\251\262\r\021 A\247L\025iR\250\214\001\337|\362\270'M\335\262\002\224\231\272M5\316\213\264KvX\315\372G6\313E\370\366E\037\355Rv^\005Y\362\300%\3045\252,\033Z\304\026\240\b\212\217\t|\361\363\022\005\022\005\313E\344C|\2047#\2331\237\2315\376\240\370\271\350,\220m\272\020]\366\306\250\037\253\264\fL\257w\274\357\317\211\322:p\241`\035\r\254tZ"
+	.ascii	"\\\235&A\n'\247\250\031g\331\211\224\n"
+	.text
+	.section	.gnu.lto_printValuePointer.237.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\275\024\265Z"
+	.string	"Z\225\020!N0\216\332\351\253\267`\2320\227#\007\240\334=\020^\220\001A\373\255\3425HI\224\013<\252\310r\343y\nU\334\034\215\347b*\223d"
+	.ascii	"m\024\020(H8\351\356+\372N\002\347\"\364\002"
+	.string	"\342\273*\336T\362\322\367\224X\362kdwK)\245\373\001\320\001\006\002\316E\2423qufY\347\265\350<$:?\353\354\254sO\375\224\251\342\223r\366\343\375\332n\220\302\031.u\275K\322u\335v\335r\335Uz\310\334\314M\307}\245\357\330h\307x\303\013\247\"\355\313\354^h\213b\257u\214\307\264j\273[\3061iU\r\315\275P\004\346\330\330\253\\\007e\316\362T\024{e\3567\35686Ri\270\266\2530^_\256\333>\310\316\200\004\336{\225ze\024\305^\231C72\363\352\314\"\234\332\226rA\267-\301\340\324\362J|\024\036\223\004\204\267i\340\243s\255\334\200,\2653\267Z\257\265\315\306A#\357-\242w\345\336\266\017lT\354\225\333:\311\366Zl\036\266Wn\231\001}\256\256\223\304\231\026\326\0244\367\336\246/\201\273\260\207m\315Go\273\003\322Q\323\250\210h\210)\264T\006q"
+	.ascii	"\372\361\331\240!\331\303\263\203\324\311\301\2719\032mj\212"
+	.ascii	"Dv\035~\222\267\334\304\250)M$-S\345\027\267\345\354\016HGt\335"
+	.ascii	"\234\243s\243\"\"+q>\304\254\233\203s\241%1J\031\264\246\346"
+	.ascii	"\034\236\2609P]\377\244p\347\304}\362zC^\022\327\260\007E2d\242"
+	.ascii	"A\353<\331d\356\004\357\221\253\002\305\204\274\225\207pg\020"
+	.ascii	"\t\250\363w\2263\327\3052g^\310\210q\035i\034#edDZ\f:\204\265"
+	.ascii	"\3013\202\307Cb\320#\354\315\220x\025\004I\357A\363\206\001\f"
+	.ascii	"\006\336u\\\273\326V\225\037I\340\372j\343\220\030\227W\333\f"
+	.ascii	"=\004\332\305\320{P\257a2\b\222\254F\203vy\r\\\361\t\021\t\033"
+	.ascii	"\242\354l\355\270F`\314\007UMP\214K\332\303\026\203F\261\236"
+	.ascii	"W\354\261/\255\313f\313j\375\356\361\325IC\017C\270|\320{P\260"
+	.ascii	"ar\2051\027zJ\017\241A\267\270\023\243\356\275\354Y[\\\315\036"
+	.ascii	"\232\371\231\2309\004f\244\230\255\363H\235_\272ii\341#C\314"
+	.ascii	"A\203\3639f\246Z(\023\260\275\342\034\037\352o\274Y\2175\376"
+	.ascii	"\361\373\211f\374%_\326\030\252\026\326\346\205\232\267\031\203"
+	.ascii	"\343\304\r\266\327\032\342C}\221\370\313\261,*]\272\253{k+/"
+	.string	"\235\375\266\322b\244\224\325{\237\235e@\361\t\003iE\002\336Y\314\274z'\257\317\276\317a\021\366\350?\036,\270s\260\275\256\337Z]\377P?\374~*\251\362Bv\372\377\245\233\217/X\204\255\327\021\230Q\235\236\206\365\266\224\204\r\177\352\307]\035\256\261\300\r\346\233\254\300\275\347G\274p\177\351u\210\331\r\273I\\\230\031\260x\257\263\207t\207\335\263\250\331\2757\251\327\025O\302\236N\310\304V\262\376+\266\370w\\\017\003\243T\004\237\212\226+\350\377\224\273\003 \033\364\222\324\326J\326\304\367\224.\356\271\205\261\362Anj+\331~\023\317\216\025\255b\027\215\367\242x\257\325\023w\226\326j\201\242\t\032\260\275\366\277\235\024%C\326\330zx!s\233\323\177\312\334=\275\253\016\362\027a\216\321l\3350ZJ7\013\326y\005\353,\245\"\005\212\226k>\321r\315Q\035\245\033\212u6\321m\335%\222\316"
+	.ascii	"\264\\\363SWivjg\022=\316#Vg\021\253s\210\325\031\004\353\334"
+	.ascii	"\324\316L<\316\037\214\316KFg%\036g\017\253s\022\353\334a\307"
+	.ascii	"\031iu>Z\235\233Hg#\244s\021\322\231(\307y\350\306\231i\343,"
+	.ascii	"\304:/Wg%\353\034\264:sX\235\201X\347\037\244\263\217\216\363"
+	.ascii	"\006\243\263\006\243sru\356\311q\346\301q\3361:#\215\316:\253"
+	.ascii	"s\316\2153\316\321\371\306\350|4:\033Wg\033\033\347\232\232\317"
+	.ascii	"\334z\265`}\327;p}k\324\347;q\230D\307|\214\230\264D\204\252"
+	.ascii	"#\024\237\017x\265/\215z\365\316\006s\242\260\341\247|\001\313"
+	.ascii	"\342\007\370\321\347\204\201\357\317\312\007\365\300\024\321"
+	.ascii	"\360S6\372\242o\2641Ok\247Nh\037\214\276\263H\2518a[z\3217\235"
+	.ascii	"\233=}\321\333\214E\307`\021\022\231\304UI\266\324\257N\2714"
+	.ascii	"\2670>\326\307\26733\301\300$\340\236\013=?e\226\310\333N\324"
+	.ascii	"\263D\236\310\023\317\202\275\351\240x\026\354\231\223\342\223"
+	.ascii	"o^t8*\336\202\263<\254\272\033\245~z-\023\330O\270ite\354F\250"
+	.ascii	"h\324\232\220\300^\002\363\352\275\332\324\232\024a\027\222\246"
+	.ascii	"%\346Y\367\232\370\343\333Y\230`\240\007\351\3664R\036\242\217"
+	.ascii	"jo\373\204\310\257\353\314\316\320\237x\357\322\336vm\350\215"
+	.ascii	"cA\242_\220\314G\361\336\245\275-\024\246_\bZt\204>\305\230\366"
+	.ascii	"\236\020z\343\030\020*\037t\303\361A\311y\025\357]\332\313\242"
+	.ascii	"\270|\343\230\007~Z]\276\3253P\330\371*a\013\216{qWe\220r\203"
+	.ascii	"\031#\002\367^\013\016\302\027\347b\027\302z\016\345\"\331\205"
+	.ascii	"\3366\251\357\271F\302\361-\241b9!\267\n\335/%\246\f\360\353"
+	.ascii	"\346\247\234\223e\214\361\253\221$\245vz-\3457`\320+\201\274"
+	.ascii	"h\362\240]\262\364\303(\350\233\312\330zxa\017\357\275\367\330"
+	.ascii	"N\037\343\227U\035\234q\343\222\267\025\317j\313\224d\355\221"
+	.ascii	"\3423\006\322\tm\022\207\343\223R\255\336\331!$\211Aj\363Svz"
+	.ascii	"\016\337bn^\230\032\3509\374j\3469\344\347\201\276\317\034\353"
+	.ascii	"\005\022\031\267i\376l\227\030\221\265L\374\252u\322k"
+	.string	"\020\331\317\367W\024LX\215\317\267\025\257r\200\375*\320>\201\200\355\325\347}N\303C\375\206a\3625$\177\311\247U\330'C\261'\r\317\367\f\306h\327f\260\275\362 \037\352w\032\206<\325d\226`V\320d\n`\300\212\002Z\270H\301T!\305\200\002\r\300\200\341\"\005\020\177p\256\240\371\\@\001.\206\334\302\005s\252\311$\362\216&\023\004\223\345%\347\035\315\347\251\346\343\250q\3431\220q\343\327\032m\303\306\016\t\206:hX\200\243F\016\005h\354\260!\203\307Q\207\f\036O\343\206\214\026S7f\020y\006S\r\0333\232p\324\220q\243i\206\216\n\232\230\222\234\203\002\032:\232,\310\221CG\223\361\366\027\231\322\335\201\237\035\265\307W\261\217\320\034\345\3644a~th\341OO\"\220\n\314\021\231_\361\271\001R\2570\236\231*\fU\013\003\204a\275S\214\213\241JC\342\331\250\024P\220\355"
+	.string	"g\246\"C\005\303\004M\250U\312(\022)\322O\371Uh\262\377\265e=\245\232\001R\257\257\202\021\324\003\360Z"
+	.ascii	"T\2456\354\030\036\375\324\233Me\206\035\361<\334\376\234\205"
+	.ascii	"\366R\231\341\200\355u\304/\371\276\n\265\272\216t\303\371\201"
+	.ascii	"Q\215\366\250\316(\251\004\213O\nD(j:\377b\303O\210\315\2313"
+	.ascii	"\024\210\224Z\304\337R\207x\021\337XQ\020\377\364!\336\347\236"
+	.ascii	"\204M\017\342[\006\347\362b\251\252g\324\364\215&e\301\tY\037"
+	.ascii	"\337\230\004\n\006\0161\275U^[\204*M\353d{eZz\017\377\241\250"
+	.ascii	"\364KO\257\364?`\250\n\035\257u\366[5K{\205D\206\305\303\263"
+	.ascii	"]\322.N\330z0\223:|R\225\333\275\350723\277\322^\035U\357\265"
+	.ascii	"\n\200\316\353"
+	.ascii	"Z\254!\267>\262z\345n\265\330^;|\277\225y\340rm\020\002\266\334"
+	.ascii	"J+\204D5n\251\212\364\035(\345\"\3106\355>2T\241\245/I\243*\217"
+	.ascii	"\276\031\245\005A\204\342sj\013\365\031E+\013\372\251+\351\277"
+	.ascii	"\025~\256\317\007\207\243w$n\\\352\372\350\231\302D\201\352\256"
+	.ascii	"\030T`\024/$z\311q\375<}\323\256\233\217\2014\213`\364\351\033"
+	.ascii	"\213\257Ipe\2047\226\276\322X\372\216\263d\225\b\201\235\250"
+	.ascii	"q<\343\030cdFDD$I\222\264\006\241\005\304\030\306\030\263;\022"
+	.ascii	"\300SA\211\244\314\231!\222\202\224\324\250\323\001\347'\345"
+	.ascii	"}R?gwW\227\344n?\263/^I\325\271\2242\341\006t\\&\344\006\334"
+	.ascii	"#\327\244B@\275\247\257-\351\373\333T\002\361\031\337\254iX\214"
+	.ascii	"\246 /\362\336\256\353\225\321\371\271My.\231\323]^(\034(\333"
+	.ascii	"\336\352\310\256\001\326ogA\364n\210\305\325c\233y\352\361\200"
+	.ascii	"\313\266W\202\031!\220*\216\371\355\016q\373\336\007\n\224\301"
+	.ascii	"\305\030\346P\215r\204\327\003\"\207\272si\254r\337\261\255b"
+	.ascii	"\354\207W(\331\363\245\341"
+	.string	"\372v\302{\223W\020\350u\325\254\210\326B\030o9\243\217\214\270\254\033+\221\363is\274h\366'\330z\274Tu(+lR\224Ep%\372\317I\232\025\323\3322c\370\311t\232Z\234\017\317zN\226-\016\256{\213k~\206\337\037\305\233\272#\301\213s/T+\204?\\\004\275w-oo\346\036G&\224>uVL\336\367\203\213<\006\224X\273o\322#I\360\317\257d\271\226\017\026\370\351OB\312\206\250\344\200<I<\037\215:\241\024\335\345wS,\033t\211\"\323\023\351\254\267\232\273\200\306'\224t\001\275\333o\3472\276]_\325\016\016\306/\351\017\240\035\311\354rI\324\255\237_\277\335L\205G\255 ;\002\364\367\277\200~\202\362\210G\212\370\035\221\030\264\255F!1\270\302\017pN\032\232\323\254\225A\b\016\204~\343&\t\376o\241\361'+>\232\322\242\b$:\246\303\323P\261\"\327c\225"
+	.string	"4?\363\264#{h\334\252\013\254\357\021\375\221q\366\370\213R'U\254\246\023eg\310\271i\314W"
+	.ascii	"\3076\215|7\321#\031\224\221\221\344\242\r\321\305\310\310\333"
+	.ascii	"\270\327\244\240\225\374\310\023\216\032Z|\006\3623\217<\236"
+	.ascii	"7f\372\005\246\2206\032\177\372\253\021\242I\203\275\\\307\034"
+	.ascii	"\032\005`\347$\243P\026\366W\035c\343SPS\\\305Y\302\211\262\254"
+	.ascii	"`\332\354\373\f\215\006\256\030J\017\220!@\r&H\023\213\213\250"
+	.ascii	"\273\317\251\264wb~\226K%\230\320\316\020\355\301\340\311#\203"
+	.ascii	"'<\236\031\007x\233'\320\020Y\361\337\277\332y\374*\241YJC\332"
+	.ascii	"\223\334p\235\206\220~R\212|f\220\001\312\216T\321z\027aR\377"
+	.ascii	"j\210\250\216)\275\030\224Q\\x\242_-\022\213\003`\240\204\017"
+	.ascii	"\212q\221\017q\n(d\204\005\310\237@\230\2061N\325\345\3105\313"
+	.ascii	"P|\035\267}g\312A`Yp6\270\3029\274,\024R\213\001D\321i+v\257"
+	.ascii	"\213i\222\321*\264\232\0060N:G5\273>^\232\331\022\351\241I\304"
+	.ascii	"ns\016\375\202\034^,\026\220\242\305\205\022\016\276\205\350"
+	.ascii	"\276>E\251\322.(*q\006$^\026+\334|0\341\024B\341\233=\333\221"
+	.ascii	"\225\271A9*^\272[I\330j"
+	.text
+	.section	.gnu.lto_valuePtrEqualsDefault.238.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`I\f\2159"
+	.string	"\272d\370\025AP\236N\007#\245\305\362\2229\204\224\242\223\033\263\340\241\312I\270~U\276\301r\306\370\205?J/Q\372q\177rl\206\003\3204\200\200\340\034\r\370q\235\303\212\2643\253*\232\211\bm\"\367N)\245Y\001-\001H\001b\351\375q\037\016\233_\335\224{\241\033\362\230\257o\332m\034q\350"
+	.ascii	"\003\357\275\021\326V\263\264\226\260\336R\343\251\fz\321\210"
+	.ascii	"xl\204uT\255\362\203\265\325\247\024\213\034\363\241\234'I\350"
+	.ascii	"\226\341\355\220rg\356\272\266\013\353;\033\255\274\367\355\316"
+	.string	"\230{\241\007x\300\332*C\333\310\266\2726\221mUA\2030\026K2\033\023D@g\307\251\205\360^\250\325\037\341\216v\nm^\272X;-\233\230\226\224\222\220\216\214\212\210\206\224BAI \344\321X\\\211VM\337\305\270\211Zz\255\201,I\036\035hc\355\224\022\315x\310\365\233\347]ze\030H\246\3038}i$\315\256\233\2200Y\351\245*V\\\251\n\025ObCj\322GrM\334H\216\211\027\005!R\322CI\224\2702\t\022\027J\243\360x\022\324\326\311\271g\233\003\261\rq\344\272'\312\231\240[Z]\037\031\312--H\033\347\236A\274\370\346\t$}\202\232{\256\371:eI\234\220v{\376\260F\276$|\f\345\366\254\263D\242\326\275\267\303\264\b\272\250\240[\232][\265V\233f\236\372\350O\r\260\255\361\221D+K\215\334\024\271\323z\355ghd\356D\255{/\273\016\264\264f"
+	.ascii	"\315\354+\230\031\004\263\261\031k~\250\020\3650\363\363\320"
+	.ascii	"^Z\006\337z\275\276\301\253S\346\206\334}\275\264\375\f\236\335"
+	.ascii	"\371\203\214I\364^\211\365\3362\007\334c\304\236&\326%\255r\333"
+	.ascii	"\260\255\366c\255\035\026\336\335\360(3t\314\037\216\271\257"
+	.ascii	"\342\f\017\371\337\230-T\320\2420AB\204\306\322\235\325\320n"
+	.ascii	",\bW}\327\375@un\240:3\260\316\013\254\263\002\353\234\300:#"
+	.ascii	"\260\316V\r\246\271\252\2674\037\350\274f&U{i6Pt\236*:K\025\235"
+	.ascii	"\013(\235\t\024\235\243\224\316\003\220\316\002\220\316\001\204"
+	.ascii	"\234\241\202\234\237\204\234\001\0049;!\235\227H\347\246\242"
+	.ascii	"3S\321y)\351\254\224tN\002rFJ:\037\0019\033!\235\213\220\316"
+	.ascii	"DG\347!\243\263\362\350,dt\016\":'\213\316@Eg\244\352|T\235\215"
+	.ascii	"\253sQu^Wg\"\321\331Zg\325:\247\252\363\253\316\256:\367\205"
+	.ascii	"%4dp\262\320\335y:\320\313#zx\373T2M\032L\367\226\356\274n/\235"
+	.ascii	"27s\177\341\016\303G0\314\327FXG\370am\265\231\303\270\271t\227"
+	.ascii	"\326\343#\267\227\032\206\262^\371Jr\006Shpa[\025J>\326\007%"
+	.ascii	"_\365\003\364py\332\n\234\356\274\277 \310\207c7R51M\221\331"
+	.ascii	"VV_\341]\216=>\\ze\030\270g\374\267\032\026\350\233\317\201G"
+	.ascii	">\320\267\363\307\361\221\337\316?\306_\377\370D<N\265.c\326"
+	.ascii	"\027\237IK\023J\013\306\330\260r{\331V\327\3573 7<\312\366\261"
+	.ascii	"\236\370\335\204R\365\366-\230\216:\324;+\266\230\245z\342\236"
+	.ascii	"\031%x\177-\322\372\306\334\017\353\025\252\251\255\017\307\215"
+	.ascii	"\207\0330m\373\343\266\363B\350p\373\371Z\034n9\275\303\311%"
+	.ascii	"\342\206\373\r\003\256\367\2165\033\367\322\206\021\271Qr8\271"
+	.ascii	"\367Nu\033f\006\354fc\3005\356>/\364N\265\332\340;L+\363\376"
+	.ascii	"\320\372\234\376\207\211\r\236\013\03234\342\303\261\275rF\205"
+	.ascii	"\360\326\216O\032\024\215F\243-e\017\374\031[\365!|\017\246\317"
+	.ascii	"l\365\235\257yH\346Q\376O\2779\264\232\022\003\342\3224\305\375"
+	.ascii	"\367s\355O\241\372p\214\324\274\"\367W\217\334b\007\350\314f"
+	.ascii	"\376Y\337"
+	.string	"\217\211\321\223\372_\275\017:\377\334\350\320hJ0\375\330C\237\001\021\345\027\242\371F\264\272\364\363\357\271,\032\254k\206\f\256/\013\006c\206\327\0050\030\\/\270\272\270\220.dl\275H\301\272fl\255\340\302\360\005\026\303\370\005\026\343\277\266h<\253\250b\321\245\302\n\006\213\255\027V*\276dXU\031\261W\f\256/+0/\257/\253\343\r\354tI\365\021\"(\373\376\324\364\335x\262@\247\207\343\243\216&\013OH\027u\212\261T]\365g\2346\031\210C\207\307)\306\366Y\3253_\025\024\023\305cS\346\206\235\336{\357\222\257\311$\341m\2313H\023\336\2261BD\341\355\336\234 \255Vk\356\311\035+<\247D\2527\300\354\252\267\360Gdm\321&\033\233n\367\343fMKJ\314^\260\340%0-MI\375T\201\217z\251\271\032\005\262\236\200_1)5P\330V\243\004<\326\017H\003\274\200"
+	.ascii	"J|E\356\\I:2b\266\002\005?\001\351\b\352\001\034\212\335]\200"
+	.ascii	"\312\372\247W\032<\264pa\313\266\n`\371X\357\324}\272\351\227"
+	.ascii	"Mo\265\030\365\251C\245hH\311\354\004\t\236\002\321\320\277\351"
+	.ascii	"i\246\245gR\372\245\244?z\245'"
+	.string	"\016\026~\310\220\224\365H\317\304W(\"\003\227m\365\250\350\261\336\310\233\325X\242/\372n\316\021\275\345S\332\231C'\224\004b6\002\004\257\025\364p)\205\262.S\222\377\306C/t\"\200\370\250QD#\031S##\"A$I\2224\006\360\002\021\031\252\315\001\021 %cZ\325\202\246\320\030/`\357\214\030S G\251\025\253K\365I%\373\365R\217\336\262\370#o\243\342.w\242|2O\344\323oC\324:\254#\234P \212\357\301sM\201{\177\353\3662\026\312\357a.\256N\366k\021\264\224\217\361\363\253\234T\200+w\025Hz7\b\375\272\272\377\222x\bF*\3206\357\223\246\203\222\264\006Ve\355\255\177`\232\213\332.\031\007\375\2228e(\315v\212^R\320UpJ\324\300L\001\313\212\226%\336\254\372\256\342c\377\231\313\366_\242\373\301\276\377\277;\374\313\365\177\200rx\305.c\006S"
+	.string	"\2178Q\270\321^\312\222\370\026\345\300]w\245F\fAD{k\267\311\302\020\272\33108;Ld\227r\032\266\306\336\253\306\337\254\261\367S-\236W\0246\374\005B0\306\n\b\301%Au<\365\254\347\205f\346h\3063\352\201\316\307\237\260\311\265<#\307\301"
+	.string	"}\0037x\017\361\r\200\363\343\256\022"
+	.ascii	"#\264W\336\372p\314\331\332\371\003\247u\020d\272]\322i\004S"
+	.ascii	"\323\2676eP \307\230jm1\017\365\212|\275\327m\023\024S\327\343"
+	.ascii	"\252\230\241\024sW\332\240\2544\007[[\264\301J&\202Eh\004\034"
+	.ascii	"\377\r\t\242\330&\377\237_\353\233\244\262B\013\314\007\205$"
+	.ascii	"?\214\225\244!E\222\336\031\310\312\204K\221\321\221\310\302"
+	.ascii	"d@6\002\016\301\332\t\252\236^\001\334s=\350 \225\231S2\222&"
+	.ascii	"\3126\214\251\272\242\350M1\217\032"
+	.text
+	.section	.gnu.lto_cliPrintSectionHeading.239.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`e\001\325\017"
+	.string	"6]lH\340\320(\035\222\020\256\030Q\022\035\244ni\277\234\202\314~P\377"
+	.string	"R{0\376Z\307\036\256>\210\250s\315o\307\337\347pj\257\336\305i\340\330M\214f\020\244\027\302\025\272xjr\274\312\352\366\316\320\fd\354\275\267L)Y"
+	.string	"X"
+	.string	"T"
+	.string	"\341\347\360$\364\323{"
+	.ascii	"\372\031?\\v:e\\\231?;e\300\241F\r\016\037P\303\2474\341\200"
+	.ascii	"8\002\320#\303&\345\202\0366f\210\2005Ig\035nJ\240m\243,\275"
+	.ascii	"(:!\002R\220\bP\300\3008\317W\006\244\355~\234\324Z\2751 \206"
+	.ascii	"\373\343\266U\266\033\330\017\021+\027f,\200\027\361S\353L"
+	.string	"\022R\025\2321H\330\216\331%\333\336\357\310\004\214\324\232\216\n \005r\355\003\tb\337\271<\034\200\313\241\0132y\237\336\265\237\363\025\261\207\023\fR+\215\016\240ZC\223\013x\237\004\244m?\305u1\313\"\214\355\205\306@\016\347\306\303\243\326.\210\212\204jq\346g\360\331\260\233.\224\3065\322\331=J*\n\222%\364\361&t\206F^Bg|\2244n8\332&=\326\224\330\031\212\226Q\031q\025F\260\330q\203\250\266Fv8\333xc_\326Z\253\243\215\375\335O\037\376\363;\277\364z\347\372 \001\255\027\004\025U\n\345\224\022!D\345\304\342\340\005c\275`\253\220\025\327\351\001\253\005\206\342\031e\222bA}\252\324\251\345C\265\\\237\t\211W\254\224\326\367Z\255Z_)\254\2176\336\225\361\036r9\267\037)\343y\356!\345t=?\363-\276Q&\372\344%\322\250\2672\332\022\\\373\030?\034"
+	.ascii	"\3571\330\020Z\260\016\251[\200\033[\261\016\315\300*B\325\260"
+	.ascii	"`\027\330\"UqY\305\002QI\343v\021\304\320\n\252]\003\t6\2341"
+	.ascii	"$\202\276}\256%\240\344\301]R\332 \026:0\241\353Q\233C\255\363"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_backupPgConfig.240.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\255\t"
+	.string	"\266\322B;0\345(\035\236\213\027P\275.'\302R\\\240\016\210P\032J\361*\214\316?\332\300_\240~\202]\3408\221\271\215U\305EDD2\200\301\223\217\260\344\341S\325\013\244\022\262\245L)1"
+	.string	"0"
+	.string	"2"
+	.string	"\3419\3311\355\007\3311{\266"
+	.string	"\204\215\375\032J^N-\003vwS\221{O\317\177\312\tP\251\3579"
+	.string	"\261\273NT\312\343\326\333V\260\315`\377!+\373\340\237\305t\214i\325tf\372\332\206\244\225zKf\267\343E`]X\314\210\306\366\323\376\311Q\274\203\245\033\354\256"
+	.string	"\300\354\206\035/h\307\034w\211Z\300\002Eg\341T\023X\327\324\316\251\200-\276B\322v5\034|\225\016Ck\035\363K\331\261\353U\252\031\023\320\224/;\374RC\354\307\335]k\240Q\372\343\tQ|\266\212P\204h\373t\244\315\30317\222\350\266\013\216\3536M\270\217\253+k\001>\\&\315\360&SU\243\332\240P\036e\r\b\207~\266'\002\017"
+	.ascii	"\357b\310\304S\274h\304\005\204\250\364\300\220\237r\202U3\232"
+	.ascii	"\312\302f\30280\353\022V\263\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_restorePgConfig.241.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\225\t"
+	.string	"\266\022B7@\223\206\003\273\2641S\017\2237\n\316\221\335r\251\3370\251:\327\335U;|\273\255\327`,c!\033Y\315Q\024\003\034\231\357\342\022\244\370F\213a\327\275\267\224)\0051"
+	.string	"0"
+	.string	"3"
+	.string	"\343=\3335\356\004\3335\203\366L\001\306\206\n.\227\224\n\315\356v\352q\360\t\3727y\200j\025>\001\032v\327\251Zm\334z\333\007\266\023\3543\004-\373\342\277e\351,K\253\2463\323\347:#-\253\207\260\354j\304l\366\245\301\210pl?\355\223\274\004\274x\372\300n\013\366\262;~\214\300]s_\311T\340C$=\305S5\200]S?\251\033O\034\305\304\355^,\370'_\005\007r\315?m\327\256g\261djDT\306\3541L\355\260\237\355\356Z\003\242R:\004\032E\204:\211\221\003\251\013}\246\016\344\261Wz\370:\n\317\373:\316\270\317V[\346b\\/\224Z\270\223\251\252\231\332\242Q^e\016G\206\206\266!\002\017"
+	.ascii	"\357b\310\304S\274h\304\005\204\250\364\300\220\237r\202U3\232"
+	.ascii	"\312\302f\30280\353\022V\263\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_backupConfigs.242.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\206\001\245\017"
+	.string	"\266\\hG\360\260(\035\262f/dO\366\270,\204\352\037\3151:6\013&f$*\026*kR\356\233N.\263sdf-\372S\213\020\267"
+	.string	"\262L\3437<\003\317\300\213\200\r\307G\325)=\260\362\256v\275'\204\354-eJ\001S"
+	.string	"T"
+	.string	"S"
+	.string	"sz\313\301\033\314\n\315\f\230\025\032\032\217\341\035\265\364M\306\345\264\344\203\246o\030.#\227b\275x\200\251(R\233\325<<i\f \242\365\355Z\347\"\002\026Y\313\003L\211\237\030\033l\374uU\001U\252\334\310\234\323\272\002/\334\335m\267l\203\330\017\003&]\227\215\007\233\017\336\026\3730\330\255\252>"
+	.ascii	"\321\214e\001<\b\034s\262vt\346\215\254\tq\330\355\223\360C{"
+	.ascii	"|\231\227(\035VA\300\2241\017\352\304\344\314\346\f\023\\\332"
+	.ascii	"@w\351\360\237\355\262\373\307vy\217K\366\r\002\251iR\020#K9"
+	.ascii	"A\233\001\321\007\376\261\351v+\212\275\300P\2158\351\2169\325"
+	.ascii	"\265M&\350W~\370\00139/nPkZ\207\246/\212\026)p\327\345_\244C"
+	.ascii	"m\306m\213I\333\267A\f\007\2455\373&\036#\371.\246p\242_]\372"
+	.ascii	"'\373\327\013\200,h,2\031Pt\307\016\003\017J\324\240\220\020"
+	.ascii	"\004\220\027!\304\200\304\003\215L\274\220\217\277\022\007#O"
+	.ascii	"\302\367\215<O8?\202\262\247m]'m+\376zt\241A\007-\207\\\227\027"
+	.ascii	"\340l\267\\\215s\350\003\251\241\253\242\342\353\346T\315<\205"
+	.ascii	"(\336\345\322$\337\366m\227\272\273#&Ci\355q\3169\003  P\002"
+	.ascii	"2U\324\003\257\030\362\320\364!\300D\210Cv,\266\331\272T\370"
+	.ascii	"u%\230Y[\224\030\204\230B\032\276\302G\035%,\b\346\202\311\030"
+	.ascii	"\033\2541\256fL)$\262\nI8\364q\305\313\214\262;\374\214\267\221"
+	.ascii	"=\256\360p\r\367\321\030\340\036"
+	.text
+	.section	.gnu.lto_restoreConfigs.243.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\315\n"
+	.string	"\266\324K>0O5\034 \006\343\340\020\0217\350\232a\204}\245\336\026\353\370'&\205\330a{\177+\330\377\177[n\f.\r\307\347'\2464\024T\352\023\313\237k\177\001N!P(\217\325\266\275\245L);"
+	.string	":"
+	.string	"9"
+	.string	"\033\017\366\033\320a\214@\342\305\356r\212\301K\357\231\246\347c\204\337\263\b\351\232\0050\235 m!(\223\250\270\320\342\252\247(\feB*\273\353\004C\n\267v\333\005l\003\260?\t>$S\032\211\302\247P\354\216b\260M\241\225H\235u\373 |\321\233\277z\b\357,\007\031\273b\037\302<Hx\355\212\002\256\271#r\315\342%\217k\221k<\256}\263g\273\b\372\335\342w\002\031\306\227*\312\236\307\365@\213E(G\373\"\336\362\370\034\334\240\223\007\257\371\035\275\352\034\241\211\227iU\341\2231[\374RQ.\r\256\r\326\223}\326\255\231\001\t4i\013\345\242\300\302e.\0060\234e\303\341(\022w\032\004\033nA\327m\270M\334\353\311\225\217\2022E\371\342'c\032\323\275da\304\207]\b\007U'\330\220\2649\f\362\2405\017"
+	.ascii	"\357b\314\fM\3478\374>\323c\357\0016\331\301\004\3532\016P\205"
+	.ascii	"\326\205$.\364\313\025\343\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_getPidProfileIndexToUse.246.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"M\n"
+	.string	"\246SG:0\257\322\001\207\341\345=\274\327\370d\030x\200\276\217\342 \315\344:\003\370`\216\031\350\333'YE8\037\035=\367\260\024\017\nH\244\350}\007\324;Es\216\257\244\355-\245L\0016"
+	.string	"5"
+	.string	"8"
+	.string	"\373\355\224\315\337wg\233A\311\240\215\241\b\356l\255\004\020[\333\022A\205\303\020\020Sr\223[\245\354l\231%\242\230;\205Z\3539\024-\366\230\375\277\360\237\340_\016\277\r\344\216\375+k\303\376\363\273\363\347\371\314\374\315\004\344(\304\245\265\324Z1\272T\2239\"\373o\3725?H0\375\343\250@\226\216G\311*\004W\253\215\266F#\267K\366q\"3\374G\214x\303\256\227\343\205jp\257\"R{u\307\276%a\2667\035 \267\024\347\376\245m\215\364\335\370D\2117\334\371-avn\027\334\\'\036\003\367<\037\220G? \217>|\030\034\250'\032Q\317\300C\020\r\"*\021\n\211\250\306VW\326\206\335\200D\316\326\\t\327\334\254\377\334\235S\243\344\354X\317\346\254\254^N\034\017"
+	.ascii	"s\2046a\303\360\243\\\313\304\004\001\021=+\204\305\340C\333"
+	.ascii	".\214\351\230\351=X\006\256=A\211\377T\215\032\227\202\002"
+	.text
+	.section	.gnu.lto_getRateProfileIndexToUse.247.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"]\n"
+	.string	"\226\023H?0\211*\035\204\337\177\376\200\231\270\342P\007\2036@V\316)\300\0309U\265\2251i\205\f\364\355\223\254B\370=\246\030\3434nT\006\006\030J\371\326*\215\364Y\034\273\200\336\311\337[\312\224\0024"
+	.string	"6"
+	.string	"7"
+	.string	"\357.\343j\347\237\365\310\313\025\276>\320\273,=.\200\245o\264\210b\001\032\300P\234\310F\017\316\272\222@\220\252V1\347\264~ \200\033r\333\026\266#\354kv\313\323M\331\217sQ\266\325\232\325\322jU\365#\f\023T\340C\006s~\314(\314\006r\301\312\266\307\226x\202\302\343\356A\344E\240\030\200\215\022\304\346lm+ 3]\323\n\201\203\030Q\233c\243\377\264}\201\023h\275\373\245 <\355\246\272s \337\211\314\005!\2442\373\007\036r|\225=:\372\357\322\357@.\277\022\003L\037\235\005\346*\027\f\267]0\334\246q\271\310\3308\315f\25388\263\201\241\331:2\031\315&i\315\307\271([`Q\256\204\300j\253K\262\255K\371,(\312\257\\\b\t\243\n\037\r\017"
+	.ascii	"s\2046a\303\360C\t\237\227\200\025D;\b\261b\360Al\327\304t,\364"
+	.ascii	"\036\"\003wOP\355?\245\243F\253\240"
+	.text
+	.section	.gnu.lto_getValueOffset.248.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\217\002}\022"
+	.string	"\026\343uE\340\320(\035UX\r~Z\2427\307\270\343\314Y\0228\302c"
+	.string	"\0032C\214\342\353\243n\242mj\257\227\377H\016\003\212\357m\t9x\234\033\304\203\r\263\314@8/\247\323\230\007\020\201vu\354H\333{K\231Rd"
+	.string	"Z"
+	.string	"f"
+	.ascii	"\276\316wZ>cy\200\335\032\030B\2733\004\376\340\016=\343l\373"
+	.ascii	"\037\016\242\305+\020\030\027\227\017\234\"W\210\242\335\331"
+	.ascii	"\311t\217x\230\027\020\017u\303W\217\360i\256\374\356qA\017P"
+	.ascii	"\020\344b\376\316s\0054;D/X\314\025\346\205\025M\273\273\001"
+	.ascii	"k\275\034\215\354\256\363\005\303p\217n[\305v\210\235/\002\352"
+	.ascii	"t\311\260\f\341>*\334\356K\002\277\207\301\n\307\341\320g\211"
+	.ascii	"\207\327\363\374\255\230\251\345"
+	.string	"\350\270\344\315\236u\2516\366\337\356\256\265\306\326t\311\351\016\247I\237\375\033Ns/=z\351\250i\370\322\357\245S\3237\225h*\300\276\023\264k\341Vc\207`\212\016\266[l\016\333\231\016,\355X<%\311\340\203\342\252\013\220\224\033j\2374\310\277R\237v~\211\203\020\325\236\3328\345*R\035J2c\233q\240\247d\fuY\273\372\3074\0026\231\335\356A\276\220)g\202\t\377\004g\273Y\331\b\237\204i\334n\367\230\241lqh\334\\\204m\332\037\263M\313\327\206\034\226\016\310Zi\363\200\027\210\327R&+(%\022\240Q\"'(\250\223\203\223\222\224\023J\245r\022\361p\352\201\211\352\024!\225R\2358l{\266\177\2535.\271`:\351\257\242\006\027,\006I\372\230\237[\013\355PN)\330\3464\225\345\377\334#/\216\364)I5F+f\340\253\030u\244#\027-\017\254\274\031j\324\273l"
+	.ascii	"\322F\231\344_P_\223\0054 \300\002\221\271\242\007\274\307\203"
+	.ascii	"\220\221F\2045I\200\214\017\003\311\343\352q\350\314\332\317"
+	.ascii	"\266\332\313\244U3R\336\256B\373\013\361\305\022\007z\301\260"
+	.ascii	"]9\007sX\020\254\316\221\024\024\301L\315N\t\006\315\036\374"
+	.ascii	"\225,.\347,** B\276!\341>\344R\220\234\b\240\0078\201\004,\231"
+	.ascii	"&\026Z<w\005\241\301.=\202\310\025.\360\020\313\315\371\\f]F"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_cliGetValuePointer.249.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\025\002\225\021"
+	.string	"\226\242uF\340\322&\035\222\250\036G\302\233\020\345r6\222\033#da\265F\037_\375\352Jj\310\030}Q\0139\333\r\265\323c\317\342,\300\326\324$i(\224a\3143\214\306\253W"
+	.string	"H\200\361\321w\365a\313\022B\366\2262\245`"
+	.string	"Z"
+	.string	"f"
+	.string	"\007\036m\300{\314\003\311<\265\273\303\243\306\356W\342\002\336\243m_\305W\274\354\036\352\201\003LG\301\217\r\315\213\244\335o\345\357#\334\243w\025\367\250=\177=B\315\227?\363\250CH\020"
+	.ascii	"\211!\0333Z\210\353\211&\203$\273{\333\263\206\026\313\354Nv"
+	.ascii	"\3279\243\201\270\271\333F\261]b'M\266\227Vy\351T)\215\372w\237"
+	.ascii	"\016\364\213x\351R\227\366`\272\343\322\\\227\2160\r\271\264"
+	.ascii	"\306t\302\364\005\234z\210h\217q\333\375p\013\2628\342\221\211"
+	.ascii	"\177\277}\337\305\203l\223_\336\302\bjDI\273kz\261M\217\267_"
+	.ascii	"\276\315&\333_L\200\315\261\247\351\370\301\361\261\373\005\022"
+	.ascii	" \304(L\255(wwF\335\302\241\022\307\206G\347\007\322\016Y\002"
+	.ascii	"\261/\3433Z|\037GH\311\317R\270G\224>\350\004l7rF\260\300Ae\252"
+	.ascii	"\315j\345g'%\221\351\214\257\251*\204f\210)\034\306\212\267+"
+	.ascii	"K\340\013M\250\340\371<\3722\334\343\365\266\307\0245\242\037"
+	.ascii	" X\336\354/\226Z\302>\\\335\t\254\226K[\032XT6D\263LVXX+\013"
+	.ascii	"+*-+\226\013\303\312d\304.\027Z\256U\006\027\027\327\312\364"
+	.ascii	"\301\016Ww\334\335\b\301\324\202\033\036UiIkl\227\324'0\215E"
+	.ascii	"O9Mu\352u\372\023\f~\304)L\315\bFUUi\026u@\021\313\233\241F\375"
+	.ascii	"\200\024Q\273\001J~\006\365\"rl\007\247\361\300($ \200\002\031"
+	.ascii	"*\253\003_\f\200\342\235-\342\372\203\375j\205M\257\215\023a"
+	.ascii	"6D\022]\263\350\233\265\002\202E\026>\273\213V\214f\211\2676"
+	.ascii	"\261+\204\215o\333\360\320\200\316\f\20368\253\027\366\030Y\235"
+	.ascii	"Ydc\303\023\022#\203\034o6\200\227\003\237\013\2328\320\316&"
+	.ascii	"\3402"
+	.text
+	.section	.gnu.lto_dumpPgValue.250.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\371\004\215\037"
+	.string	"F\372\314H\200\236Q\007\323T\303\023*\267\2115\246*\327\267c\f\341_\360ID(\235_\372\2247Iy\004\277\034\315\235\260\327\251\307>\235m\263|I\260`\020\244\"\210\005\227\204\301\274\004\310\240\317\027SdK\310\336{\357\224R\n\273"
+	.string	"\244"
+	.string	"\272"
+	.string	"\355}\252I%\253\214\340\007\021\226\232+\306\nl\257\021\r\323%\206\245\240M\316\260\305\212M\370&\215\\j'2J\333\025J)y\220\266\271\226\354\355\f \333\025\"\215\013\274\265\330\346\271w\252K\225{[\006< m\223\231\271\2274\326\022\263O\243\211\311\207\203+ \304'n\356mq\334\266\317\331f\332"
+	.ascii	"\3166\377G\263\235\242\247Y\276\263\334(\221\206\240\227\226"
+	.ascii	"\342\021\330)J\344\343\t\252\321\033}\226\t\320Xi\243\036\211"
+	.ascii	"\245\217\221H\261v\034\272IT\217M^\036q\202\022\372\327\216\301"
+	.ascii	"r\275\367vW{\215\243\320\035%\272\367\262\027\217O\315\262ff"
+	.ascii	"'f\3461\227h\002\356\317|\002\205w\021\350W\341\003\271\337\377"
+	.ascii	"\331\020\347p\256\247\350\322{\205\022\270\275B\354\322!mr\317"
+	.ascii	"8\333\354W{\200\001\211\312\322b\3621\346\026\350O\305\334\345"
+	.ascii	"\275\367\362O1\267V\367\332[\315C\275\325-\324N\272\203\232\253"
+	.ascii	"\371\326\311f\240n\273\177f\316=\2513\017;\333f\316;\251s\215"
+	.ascii	"\235uh\3164\232\263\212:\317Tg\331\3149M\235\321\231\363)s6S"
+	.ascii	"\347\362t~\324\331O\347.\340\2632\3328v\222\312\275\306\2618"
+	.ascii	"\367\313\274R\244\271\272\223\355\314K\334Q\272\213UfN\376\312"
+	.ascii	"\013\025\006\330+v\211w\221'\360hz 3\263Y\355\205e\242\363m\265"
+	.ascii	"\003\354\252\002\221b\324\371T\\\372\366\256\244\333{\257\371"
+	.ascii	"T[\232\366=$\231\225\366*R\n\225/c\234\267w+$\031\241\303i\277"
+	.ascii	"\367\002\377\300\251~\n\344\030\241\303a[\0378\203^}5(\005\n"
+	.ascii	"\021*\200\013\375\354\203\236\331\002\006\357\342\320\223\340"
+	.ascii	"!\373\3317q\316\355e\337R]c\304\034B~~\372\0338x\027o\277\016"
+	.ascii	"\037\310\346\243\237\376\313\031V\005;t\026\364+\0041\277\374"
+	.ascii	"\363{X\025\3641\3767\377\345|h, \256x\020\361\373\b_\300\326"
+	.ascii	"\370\370\3173\2270\341]\374\177\2614o\276z\0023^)\254>\002\253"
+	.ascii	"\322\316'@]\221\344JG\277\234\212\335\005\337Q\356\367b\247\323"
+	.ascii	"S\022\261\302\205QQn\307b\326\302\227\353\220\304\373\025\245"
+	.ascii	"\273\337Q\016\206\271\343\345<\024\361t(\353\032\030\035\351"
+	.ascii	"p.\214r<\234\256\347\3035\360a\244\244]\017\247\204\204\324\303"
+	.ascii	"\251\355\355\362\376\324\320\367\227\032$_L\037Lu\334\036\236"
+	.ascii	"\357\371\366*\303\363\252\2250,\333s\217a\245\320\036`bT\351"
+	.ascii	"P\007!\314\366\355\264C\314\325\243\013\234\231\r\302\nAq\264"
+	.ascii	"n\320\004\037\310\b\\A\357\374\317\257\317\314\026a\215\254\304"
+	.ascii	"\332\357|\237\031V\005\301\324~\307H\330\220\250,\255\002\256"
+	.ascii	"\363\334_,\022\331\021\314L\024\326\275\303.\262I\322a\211X\250"
+	.ascii	"q4\205\214R\312\314\314H4\243\265\f\007\300\002\021\"[\007\021"
+	.ascii	"P\261s\312LR\312\001\203\251\372-E\376\232qD{\251\363)\274\320"
+	.ascii	"\f\027uED\350\022o\322\2119Y\274\233\034\305\f\210\367`\032\003"
+	.ascii	"\326\303\030\323\244\325\321(c-\341J\354I\250\030_}`\341d[\213"
+	.ascii	"\333\212\354\206\261\t$\003\216\237X]-\331\"Xr.|'\257\210Md\266"
+	.ascii	"\021\354\330Q?\377\220\016\2357\"S\321J\021\307YK\342\334B\336"
+	.ascii	"\235^\314\325\321\376\265>!\253\275fzxa\263\001A \2236\t\036"
+	.ascii	"\"\277\031\241\003\320\273\274\243\324\252\376\247s\032]o\233"
+	.ascii	"\336s\310\322\220M\246\177"
+	.text
+	.section	.gnu.lto_dumpAllValues.251.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\356\003e\035"
+	.string	"v\367\302K\240\326Q:\005\320\331\365n\350\276\026\274\"}\t\313\353I[\223\342\006\356\362\276\035\347\261\336M\204##\303\332\3777=\373\26529\tk\325C|gL\003\347\t|\271\236\033\310\003\377\203\237CXW\311\352E\237\020B\266\334I\006\255"
+	.string	"\247"
+	.string	"\257"
+	.string	"\310\377\360\035\b\t.\357\235\301\205"
+	.string	"}9\253\257\314_\272\017\337\231J\234\346\336\243$\222{\221\t\230"
+	.string	"\372\222\221\2571_\242\247\231/\331\307\334\2456\274?\006\307(\351\220\255{\257\255m0Z}\207\241\247Y\332\256>\276\323\255Q\262\b\261\370;\314\236C\0248n\225\302\205\315\351\302\222:T\260\2425\210\212~\266\270i\r\310\230ZQ3\305hK\254(TK"
+	.string	"\305\324\342\334{c\305a\265v\301p\313\b\240(\264\262\256\264\312\223\257CE\241\332\207\372\205\343\225\027\032DE\257\347\203{/Wb\221\350\034sf\326\301\314\027\230{*2}\340\262f\326\201\250'\316tM\n\003\213\013K\250\177\314\310_m$\346\347$uu\341>b\276\2619\323\037\340@~\332\243\3164g\345\331\314\233~\231\023\371e\177:\243\347\233\316&\254r\211V\266]\271\273r=+\277& L\220\212\220#U_A^\024_anU)\225\343Q\377\023\363\217\360\223Q\274\331\265\272/n9f\301\252\200\336\b\037\212c/\231\371\251\207#D\336b\f\225\250\246\245\255{\221\007^\262\016\372\3621\346\246\022\265\331\025\006q\002\301\n\371\020\337\211\214\260\263+4\272\341"
+	.string	"}\211c;\262\246\351"
+	.string	"\315la\247\236h\323\215$\013JU\332?\376\013\340\t%\263\221\246>k\031\246\372\035SW<\312\2230i\335:^\265\034\245\270\330F\352]\220+a\355bZw[+\251\327\254+mI\352U\373"
+	.string	"\363=k\256iQ\260~13\206C\321\220\301\250\325\343^a\203'\035\276d\004\323\243\311\235\360\314\227\357\fF\255#\023\2552o\340PO\3447e1\251\n\366\217\371Kx\005\260\334+<\221\231\177\256\244\203-\351^a\216\324\223\334\354\225^2.g\236\2303_\322\364\223\267ZF0\301+FX"
+	.ascii	"\353W\027a2,6\313j\271^\317MD\251\373.h\307\303\217\216\347\226"
+	.ascii	"\373\020\003\202w\323\t\341\323\343A\177\200tA\270\334N\256\327"
+	.ascii	"s\023!\313\371\334(\360\370\340N\306)\320\365\340l?\272\233\217"
+	.ascii	"\r\267\343\331\024\3240P\210\334\316\026\004\004\264\263\305"
+	.ascii	"\220\367}\344\364\233\310\362R\005\354 \026\254\221X\346\311"
+	.ascii	"y\003S:^\245\311\312ClO\263\357tX\322QJ\232\2543}\366P\227\035"
+	.ascii	"\201\312v\331O\275\200\237r+\t\366J<AG\307n\031\277p\025\001"
+	.ascii	"\353\327\355\275\367\242\326\236\217\221\306\2402m\232my\266"
+	.ascii	"\331C\314\177\317D\373\246\017\365\rFQI!\031\301\372UU\234\265"
+	.ascii	"zvG\250Q\030\304\210R\210\031cf\202\241\240\302\220\033\200\002"
+	.ascii	"\2312\253\007\020xX\232\264\031\037\022\316\337,\033\022\031"
+	.ascii	"\212\fmo\002JH\216\323\013P\354\022\033\362\241\313\360\315\005"
+	.ascii	"\004\302\007K\3244\035L\034\200\350\343\315\"p\201\223\267]F"
+	.ascii	"\227\004[R&\027\252\254c\277\220\254A\212\305\264\371f$S\334"
+	.ascii	"\2669sg\341\017\333\222\355\b4@\245=\244\245\326\322\026\307"
+	.ascii	"{\3701b\326\241\250U\260'S\\_\246\2307;\363\346,-\177p8\032|"
+	.ascii	"E\001DuX#P\253\335\016\231\362\362\003"
+	.text
+	.section	.gnu.lto_cliPrintVar.252.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"5\013"
+	.string	"FVO@ O\234\016#\034\017\256u@\320\002\242\351h\360@\342w\250\205\"0\221 \002\030Q\200\024\356\023\366(\376k\235Nz\214I\005!d\0355\313\227\226=\340\202\b\210:\340Z \022\332D\356\224\002;"
+	.string	"@"
+	.string	"9"
+	.string	"\033\2328\261;\023\330"
+	.string	"\344\322\363\024\353\022r\001\326\245;\273E%\303z\fF2D'\217\335\305\024\304\273\307\316\377\351\221\017\364\036/\007\273\353\370\201\034n\275\355\002\266\033\330\177\020\273!\365\261(\211\"\304M\277\375\237,\261m\262\213\311\256\330\203\341\350\343\305\356<p\351\213]E{\301\245\373F\205\317\001\035J\220R(\210\323Be\262!\022\032\020<\332']D\367\322\205\007\330\266\364z\017\0340D3@1\345+\252\332\235O\374'5zt\304@\205\324\263\247\027\365\203\375jw\327\032\332/\375\3277~\353\246[~\376ZE?\002`\004\013\360\034*6\234\207\243\233\315GB\305a(hF\303@\210\240e\2273\213f\223a\0234\030\r\313\270\016f\241x\343d8\314\263m\034&\231\373j54\244#\205\002)\006k\304\253T\325Kmm\213\377L@\244^\017"
+	.ascii	"\357b\314\304s\242pF\347\205\b\\s,vw0\020\013\"\200\023`/(\f"
+	.ascii	"\206\005\250\320\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.253.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\257\013\3459"
+	.ascii	"\252a\250\025CP^N:7\230\274\261u\221\237\013]^\364\2645\373,"
+	.ascii	":\251\343\251\354\263\336\300\272\372C3\274\005$\026\357\005"
+	.ascii	"y\310\263!\002@\030p\212\206\300\312\361`\037\f\320\361dq\325"
+	.ascii	"\375\315\032\261\204\220\275\223\fD\0016\001K\001\354\212{eq"
+	.ascii	"\253+\356\254\342\306\031\367%4\t\212\263#f\215+\353\211\276"
+	.ascii	"^\203\206^\275U\r\226\217\371\341\342\372R1\227s?\346\t\251\025"
+	.ascii	"}\277\212v\360\352(\264_\221\352\225\330G\373a\272\370\265'X"
+	.ascii	"p\017\027\004\271\214\276^B3\2749\266A\357\033}\360\265\237\332"
+	.ascii	"\257/v\367q\367\331\336\346\336M\310\215\357\013eZ\367\276Q\b"
+	.ascii	"\275\240\375\332\321/\261_\333+\261_\333\355\356cb\276\313\n"
+	.ascii	"kC\266\344\006\275\357\033\225\245t\021v\237dD:2*\"*\022\207"
+	.ascii	"\255\220]\325\214\335\276\0029s\270\276\226O\332K3\306Azs\264"
+	.ascii	"\232\345M\331\002\215T!\323\353\312\3538\305\324\f\204\374\324"
+	.ascii	"\\z\004Z\234KpQ\024\260\347\211\312\300\234\274\210\240\f\254"
+	.ascii	"\311\211\252\003\2774\177\327\342l\242.y]\341z\035g\030\036\252"
+	.ascii	"JL\314\344y\035\247\023\025*\317\226\260kq2\301\255\364#\314"
+	.ascii	"\360\352\236\027\242\261\033\304\322\326\277\235\204\331\233"
+	.ascii	"9\266\30020\264\253ZLv\t\315\216\n\361\253\2313t\312\330\026"
+	.ascii	"\361+\213%\332\241\331\275\314\211\306b\341\207\367}\033s}\201"
+	.ascii	"\275\225\336\375\251\356\216v\023\201\004\237\373\353\242\267"
+	.ascii	"\366\021"
+	.string	"\343\374\350\371\254h\232\276o\363\\,\332\246\005\247\026.\360\271z\003\0313/\273\373\305\367`x\230v\214O\245\276b\230\342|\301\2474\320\r\353\316\221Iu\004\317T<\375<\252\021;\335\327t\306\r~\023K\247_\0276\247\033\301\207\367\316\332\230\337K\366\364\201\211\005[\370t4\027\246E\007\371-\361\241\fPB}9\237\341\365\363\376\302q\323\177\243'\307\256\337&\312\314y~l_\324\364\327 \257dy\311\350\372u\335\327\276\357\362b\375&\262w\215H\226\367}\033\234\351\356\276_\254\205\276\3167\3726\370\352\224\377\366\007d[X\260\257\367&\366\331)7\336Z\222\3253^&\331\276\257\326\205>\031\027\214\215\266\312\327\276\020\366\353\363\272\344SE\254\315\r\013\017vG\2278\237\245\021Dg\2543\224n\250\214\373)\343v\272\333\237\340c\336\005\b\034\356=\200\305- \343fbq\0373\356"
+	.ascii	",\356\245\214\033\200\212[)\343N*\3426\026q#\rq\037\021q\033"
+	.ascii	"\021q\027\rq\023\265\270\213,n\242\020\367\220\305\335\nq\013"
+	.ascii	"Y\334\001\375?\261\0052T6`\007\357\256)\226\205\007\361\027\221"
+	.ascii	"1\177\016\207\271G\232\246@\276\230yi\314D3\274\301\275\342\034"
+	.ascii	"N\342\0369\200\244m\366\300\323\277B\275\367DN\0201\237\365\203"
+	.ascii	"\260\004\362\n\307\007\b\273\031\372\233\016\363Y\273JX\244\374"
+	.ascii	"\262\270=Z\230P7\376\222\341*i\373n\023\366+R~W\230Q&\312G\371"
+	.ascii	"M.\355\033\217-\312F\371M-\005rQV\3430\301F\334&B\266\276\201"
+	.ascii	"\213\270\317\2434|lbl\357\253\225\341k\343.L\304\035S\333}\342"
+	.ascii	"\232\261\347r\317\330\257D\371\322;\245\361\361\311\322;\246"
+	.ascii	"\263\205\302\217\303C\334)KP\227J\333\244\341\344Zq\261|\356"
+	.ascii	"\317\217\236V^\246\341\246\273\345l\240]0\323\365r3S\254%\246"
+	.ascii	"\230\037\346#\352\236w\201i\376\364\027GO\330fb~\024c\r3Q\355"
+	.ascii	"\203n\333\245\202 \016\r\363\245\302\334\272k/\344\266}\216\373"
+	.ascii	"vB \236\027\310F\230Y\301'\0339o\254\232Y\300\020\"\332\346\t"
+	.ascii	"d3/{\315,\211\0072q:@*"
+	.string	".\346\017\007\350\232O\267\227\263\232\317\267%\210U\342~&\336\007\305\373\250\370\035h\337\363\2409\013\335\236h\324\002\235B\005\022j\304\b\025L6\252\246\224V+\216\032nX\331\250JR!\177H)\225 \214\275\203An$Tn\244\206\035I\036TR=\214M\203\006\203c\363`\200\204\200\224\200\324\220\264Q%\245D\322H\372\310AE\005\"\300\324\177(\255\252DX\355PN\325 *\245z\344\236\021a\212jFT\325\224\024\216\250\031\312\035Q\021\226:\207\216\2442\312*G\016eT\261\337g(\335\002\336\351a\345\254\276\231\037\037Z\222\364(\366r\005x\234^\005\266\315C\001\337~\367'\3006\3431\013\340\022\342x'S\026P\b\247%/\227\305]v\300r\201)_n\317-@>^\035\302V\222\2773\275\032\304U\334\345\343@\251\330\005\310B\260'\037\234?\001vAZ\232\342N9N\257"
+	.string	"\344\245\3743Y8J\262\003\023\237\271[\0300\224("
+	.string	"\371\203\236z\002\335\316\346\177\373\241\200\317\243\r\270\333\355r\213\204\371\211H\325\262\004\372e\345\245\237Q>\353#0DPC\26650[t\302\356j\225h@\033hMm\213N\370\256\002Y)\343\26289IY)\337\013\217%\213p|S\261gR\376\227g\034\265\253\357\373\276E\371\254/\375\305\266\324\214\024\361\221\267\332\022\310\003rW\007\200\334\250Q0\245\230r\306\320\210\004\221$I\322\030\220\002\221\031*\253\003\021\320,\350\234*\222\321$\205e3p9"
+	.ascii	"\201\265\233"
+	.string	"\037\310Il\003\230\332\377\031/\352\313p,/FCvG\006\212H\003\007\253\022\007\026\250%h\3014\347\366\312U\356(\351T\030\3727\303\224\356\210k\226k\360gXX\"\336\327\275\2149\230|\361\262~|\037\360\204\355\266\017(u \001 \345P\272\230}*\255b(w\205\214\272\312\005\307\b\207\037\302\210N`\250\364h\020g\316\231KF\031p1NH4TnT\352\260\332\370\331:\226\333\327ly\264\303T\2626\371\212\017\0317\353\264\021@\005\247B\267\b\377\274\006\267]\257\343k\242\0030@\247\372\270l\307\354\356\307 Z\351\224k<$8\26217\n\273\003\270\3227\273\372n\rN\315J\271%k\202\307\016\306A\214O\276-\216\256:\303M\251\343T\204\240/?x|Uq\026\356<\370\020\211\357\245\342\035\374v\021\230\214\020\261T[\221+\025T\253i\031lM\020\030\313\333\346\270m"
+	.string	"W\254U\026Y\211x\242t#\212A\035v\3300\202\032\366\007\305\021U\264C\234\177\274\230\265a\330\353DED`\230\017(V\220\303\307U\253\271\340\206\033i\256\022\022A\344b\276\252\002\317\3313j\216\\:\230\325p|\362\266G=\033\032\365\272\222\223\r\250\217\223\032Gq?\3711<\313\264\037\340\225\035\323a\351\245\n\214`\262i/\n\221?\224\225L\233\371?\037\r\3527\371\252A\340\212R\245\022\351"
+	.ascii	"\211\234\271\237z\323\332G\345\031\206\340%\227\200\265\371\232"
+	.ascii	"\t\351\216m\263\352|\tK\0032\314x\177"
+	.text
+	.section	.gnu.lto_cliSetVar.254.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\206\nm0"
+	.string	"zQ\324\021D`\236N\007?\f\204#\367\265\302\353\350\304\261\001\260\227v\177Ns\307\242A#HP\350\217}\303ta\202\305\261\226^\250\361\023\274\222\241\177\"^\036\337d\367\016[p\351\210\250\324\200H\204\354\275\345N)\245\023\001\355"
+	.ascii	"\n\001\274\3445\305[w{\013\017M\217\r\0057\027\350]V@\213S\366"
+	.ascii	"\240\315E\337\256\3335\342\240\361\261\271w\215A[Fb\366\265\236"
+	.ascii	"\202l*0\030x/\230\337\226{\333\2168\301\332\226\bmg\356(\235"
+	.ascii	"\206l5\031m\274w\b\230-\367\256\035\361\201\265-\257\3651m\273"
+	.ascii	"vO\332\226\221\314yA3n\325\022\332\232d\2258\367\336\244/\322"
+	.ascii	"\310\3769\372\364\360\030\213\304\341\216\2160\b\\\325\324\242"
+	.ascii	"\357Hn\003ysY\\U\375S\346(\306GK\017\005+<R\214J\222 9\322`"
+	.string	"[F\322 \363\b3-\236\021\207@zG\371\303u\3204 L\204\352SP}\352\352\321\300\272\255/\224\250\311\026\017_\325\247\365M\232\2156`]d\255\356\350T}\332\321v\310E\003%\272\367\316p\324G\203my\005\271\260\322b\001\260-2\364\321\005\3121:\272nk\f=\232\t\303k\270v-\256+w\365\351\336\313\236\305\325\325\f\324\314]\204\231\237\230\2019\002\315\031\376\307\252S\223e)\233\337\364ulh\260\274\217\273\331Bi\177\323\263'\275\256\374\311\314P\215%j\275\027\213\211\373\n\362\211\324\232\244-\267\214\264m\277\323\017?>5+\177\262\216\033x\346\021$\274\263\020\274/\235e\232X_\305\274V\345/\306\334\350\375!\314\326y\202u\226\200:;\241\316\021P\347&&\bK\016\032(!\035u[\263QS\351.\352e3\202V\3536@D\240\335\232\207\200\316B\252\363\200\325Y"
+	.ascii	"\352\034 u\006\220:\007\245\316@\326\371\307:\037Qg\037\325\271"
+	.ascii	"'u\346I\235\215\252s1u&\252\316C\353\274c\235uPg!\352\034L\235"
+	.ascii	"\201\251\363\212:\253\251s\212:[\353\214Z\347G\235\035un\nD("
+	.ascii	"W\270\232\214\363^\034\3179\267i\271,\351\266n\267\356e?sw\225"
+	.ascii	"~k8\0262\007=OdC\343\024\362\274\361\033(=\317\247U\222_\305"
+	.ascii	"7\026\355\202J"
+	.string	"O|\007\303'\246A\232m\340\220\266\035>1\f\r\360\305\336\330Ix\245\177\356\274\004\2357\352\035\341\353\330\235\021~\177)\257\234\251y\351^\366\001Y_\214\3258\")\204\027z\213\273a\231~\350\265\230\203?\274\313r3\364A;\025\370\353C\370\247[z\340[\277\244\372\253:\227.}\372L\377tI\035\366\323\256C\232yX\271?\244m\355\023\303\356\336\264\276\254\374y4\023\206g\033FZ\364\266J\357\311\226f\302/}\3035\0173\371\367lf\246\350O\3707j\364\335\217\306\034\377\377N\376Y\201h2QEw\034\242\351D\264\035\272\363\357\257\037\317\263\226\353\026}\315*\367c@\345\355\013\372b\334a\270\305\240F\346\270\277x\032\216\262\033\244\0137\223\363\326{\253Z\311\026\315\257\354\336\253\240\271\260\262;\310M\213Rv\327\256\202\266N\306\245\223/T*P\274\324\212\022P\035HPM\265"
+	.ascii	"\222H\001e\002\225ZQ\002\212\205\245\202b\361\034\2054\242DT"
+	.ascii	"\322\211\021P&\222\242\250R$!\035y\n\205\024U\222\212\251)\252"
+	.ascii	"$\341\332\355\037\302\253\034f\323\352\257\270\343\272\377\371"
+	.ascii	"|:\177\212\364\316|<\321\216B\317N\003if\341B\332V\350\211ak"
+	.ascii	"\346\3468\361\031\360\003\236\310\206\347\354\353\321#\340\331"
+	.ascii	"\257\220f\030\206w\031\322\266\002\236x\2057\347\354^\312\311"
+	.ascii	"\301\023\240\350\003<1L\2153\371\267\327/\372\232\306\372\362"
+	.ascii	"\214\227[\f\235\037\367\337\203\221\303\375\005K\034n\276\206"
+	.ascii	"\203\223\226\026\241\217\257\231\364?\356-\335\037\301\343\366"
+	.ascii	"\314\b)2\317\f\217^\350\215\231e\007\351\211\210~x\027C9\346"
+	.ascii	"\314\213\b\340\203\376\310\350\001\0049\207F\017\364Hm\220f."
+	.ascii	"4\244m\201\236\030\226\306ngo\311\317\033\2753\223\177\3077\352"
+	.ascii	"\237\367=\237?\352E\025\215\345\215\371|{)\231`\344t\344\334"
+	.ascii	"\202\r^\350M\216\f\350\340\t\274\026s\317\023\370\200\337\250"
+	.ascii	"qL\345\224BR2\222\024$\205Jc\360\002\021\231Z7\021\320<\250\234"
+	.ascii	"\"\221!)H\032\003/\240\001\347\360\214\325]p^\271\302\215d+/"
+	.ascii	"\346\217*PK\345\b2\007\023\321\254|p\027\357\307h~p\304V\026"
+	.ascii	"\240\036h\001\366\2570\360\305\020\275\n\322\013"
+	.string	"\260:\344\033>\233B\033\016\277\025\254\336\233\272t\372p\210\3024\354$\221I9\276I\265\203\223\216\357\233z\002>\200\2275;\240\206\210~\257;Q\366h\345\213\272\030\200\031U\230e\246Kc\022\240(@\035\336\r\314:\230\234\373F\360\013\r\b\022\267\337N\344\034@\320C\234\220\202\364\036\314[oS\271fgw\313\356Wp\032\273\251r\210\210io\f H\266\321\003\212I\272`\262\213\024\001f\222P\327X\361\353\224J\\\370Z\030\341\341@\024\t.\276\354^\223+\341lR\321\3158\341\374\2115\r\346\331\303\355#\347F\276w<\230\343Dp\374\323\003k\264\032\304\353o\364F%\361\235\240I\267\\\037A\016\200a}.\002e\277\205\201n\212\300\246\0250Q\333\355/\300\355w\276Su\243\rY\252\202\\\307\240\005j\031d\0253|JJ\027\\\241\030L9\263\316\221\313\254\300\312\262H;\374"
+	.string	"(\332b\342\027\224\343Nq\310\271H\fz\343R>\230\260or\013\t\356\364\304\225\316\377\027\300$\003\352\216\004\3529\346p'\3364\004\253\221\352\323\345"
+	.ascii	"\024\340fF,\031\317\\^\r"
+	.text
+	.section	.gnu.lto_cliPrompt.255.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375 \353\215\006"
+	.string	"\022\f.5@o\222\016\316\262\220\361HJ\002sh\207E\203\224\0344\374#RC\271@\265\215\322R+(\204y\fS\024\3055\372\202f/\204c\344\030\035g\324\376&2\005\033x\004\006\246\251\017\310\201z\020 \206\207GY\022\357\323\271\212h\260\336DUY\2173\312\242\350M\311d\303\300\214'W\224\246PtF2C\315*6\241\003\204Noq\341\232]\226R\311\246\201\330\2170\207!_Mf\346(z$\200i\321Jr\311\364\230\221\311mz!\371\313\371\372\230\202\215\304\024T:8VH\231\371P\244W\335u{\322\200L\303\352"
+	.string	"\0262s\227i\037\035\373{\376\204\037$\b"
+	.ascii	"\357b\310\204&\340q\202\013\333.\203\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_cliShowParseError.256.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\255\b"
+	.string	"6\220>< \0057\0356-\201\023\250\264\005 \302\321\034\265\\\b\252\311\024\031\026\240*r\327\215\214\r\030\207\"2\274\356\007\350h\370l\013~\220\202\366\241\005w\013\356\2109O\0335\262wJ\001*"
+	.string	"-"
+	.string	","
+	.string	"\307\374\3314\004\250\005\027H\223\221\026\233\335\255\024\345\337\347\347\237|@(\202\237\234\206\335\365\f\305\222\233\336\266\201m\006\333,\001\253\177^\236\230\031\36175\273$\001"
+	.string	",\013{I\351\330\376\264\257r\325\367\025\310\005vG\030\227\335R\301 \355\230\313\177\262c\332\007\262$+\204\2128\233/\277\302\001\222\331M=\354\320R\t\007\307&\265=>\346C#\264T,\024\005\355\022\234\364\304\376\265\273k:\332\017vx\220\030\211 \n\"H\243\n\n\321\204\307\304\225H\026\334\306\361\026:]l\025\343T\342\352\346i\324\320\307]\206\311\253\033]\347\325N\271\277\226\216\326Z\001\t"
+	.ascii	"\357b\310\304;\276h\203\013\373`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliShowInvalidArgumentCountError.257.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\365\b"
+	.string	"\326\320@= \3458\035\350,HM\202(\017\231\001\304\236\372\001\210\350q\025\004b-!:\314\b{1\211\200\b\222\001&\025\345\350s\350\001\017N\210\200\355P\017\226\032\326\237\201ad\324\310\336)\005,"
+	.string	"."
+	.string	"/"
+	.string	"'\340\276Y\264i\fFvdp\251\220\274jv\267\322\224\213\237\242\177\327\003\310\325\370\271i\330]Orur\323\333>\260-\262\375\n\246,\373\255\177j\0023%\253\313`\273&\001"
+	.string	"ll\203Y\341\330\376\264\317\362\026\361-\220\017\354\262d/\273\345\202?\3357\227\357p\337\272\332R\226\273YL,\204\212\230\233\223\276\274\013\307GfWu\262\243S) |\233\324\366\370\230'\2350\203\305Tt\264\313qR\024\373\332\356n&y\245\t\221\207\344=H\224 (B\036\207QD\250\302\033\025\234@\223g\001~\033\177 \324\305W1P&\260~)\215\n\3528\3148\245\352F\030\246*\247\334\007\t"
+	.ascii	"\357b\310\304K\276h\205\013\373`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.258.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`?\001M\016"
+	.string	"\346\231`F\360\262&\035*\370@/\222\017\2479lO4$\347<\201\327Mgbo5\276\215\203\314i\352\220\250\02202\362\024s\0133\003\326\"\347\371\251\350\325?u\365<\300[\252\311\224e\r\023q\267\026\371do\271S\nJ"
+	.string	"M"
+	.string	"H"
+	.string	"3{\t\366\351\316\3369\371\260^\002\030,@\310\350\261\273\233\246x\367)5v\376o.\362\201\336g\006s9\002\302\\eI\013\347\005"
+	.string	"dI\224\227L\211\337<\206"
+	.string	"[b\fi\260\273\216\0378\342\306n[\202\355\t\366E\004\017\377\213\004\340\241\002<O\317\356K\317\217\325\2316Z\330\376\307\266Y\241@c\334\325\275\3067$\311\262N\230\310\331\335\024#\310>5\031C\226\023\222e\271>\224G\3733\177\321\235\246\303\005\354\306\354\310\331\rS\\ \373tx\023\354\0018/\0272\213S\245^?\34340\030\310\261\353\362o\225\271,8\360\251jk\330\020\377y\300\313\316\314\222P/\276dZ5\324,\330U= 8\\:X\221\307\016\275\250(\354\313\335]k\214}\233\177\276\346\227\247\3715.\2014\b\"\007Z\t\244\211B!\n+\241\007\332J\004\221\266\002i\fV \002\034F\234\242N\234\232\270\021J\232\270\221\250\304\221BLR9Y m\250\323\210\333H\252\325\246b\342\324\005\223j\313\220J\251\266O\270\017\342C\307\203\266\314O\254\300\305\177\226o\005\035"
+	.string	"\357b\310\f\rFH&@\326P"
+	.ascii	"\263W\250\306[-\003\256\024\bR\300A\242&R\301.u\r\3501c\2009"
+	.ascii	"\220YP# n \006\\Q\302\270\2400\030\026\240B\217\273\274\263\311"
+	.ascii	"\2460\327h\025\024"
+	.text
+	.section	.gnu.lto_nextArg.259.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`Y\001\315\016"
+	.string	"F\333bE"
+	.string	"\221(\035\003aF\223r9\017\316\342\037\026j\250J\350g\246\330r;\271\207\201\360\007\320\t8\013\017\032\260\331,\217}\213\030\321\005\204\223\252\252*\321\250 \235\021\324\"\177\347$\355\317\204\373d\357-eJ\001K"
+	.string	"N"
+	.string	"O"
+	.string	"\007\221\217\233\013\220\217\373aS\350\335P\267\313\bW7\037\343\276\033\244.t\311\3518\215p]V,\217\016\005.Ha\002\304U\327R7RHB\345{\325\035\270>\026\251S\271b\f\346\234VR\247\341\306n[d;\201}\016\001?\274w\253\252\277\371\260A\243\373\267\2323\303\353\233\255\330b\304\275\337>\361U\346\330\3666"
+	.string	"sf\2763\245bj\314\351\025xt\246Gm\0170\247I\206\305\234\236\001\023\330<\376\304Q\234x[\f#\021\313\201T*\005\206fN/\263\027\036)5\250\225;`U\343A\343\352\226\274I\335\030\312\321\362\"\343\202\342\200s\316\t\021\\W.\306}0PJp\372\332\230\025\223\314:j\310\355B\302\265)T\320\223\342*\315kCk\264!\333\013\351\236\354+\230y\021\302k\2621\031\217\n\032\310d!h\r@%#\2326\241\323\341\216\bI\204NVB\362@B\326\321>\231\b\210=&#Z\006\362x\264\214\343\315\257i\r\341U\034\303\366\255\327JK\264\\\213\334\223C\376\221\337\263\274\3048\214\205\317F\304\267\303\365\261J\035D\372\272k\206\313\212\270'\007\036"
+	.ascii	"\357bd\025M\3519\231Y$\243\365\231y\002\3133!\032\355\306\227"
+	.ascii	"\212\033\355\246} \205PW\233j8S+o\221\nBP\342\276\025\017o\302"
+	.ascii	"q\024a\241\362\3753C\235\262\204#V*C\021Zy\315\203\201\242l\272"
+	.ascii	"\346\023"
+	.text
+	.section	.gnu.lto_processChannelRangeArgs.260.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\001\004\225\034"
+	.string	"\206t\271J\260\224U:\331$pj\210\253\332\0133K\371l\003_\2059\200]\255M\003\361\346\222\237\363Z(\027\305\t\316\367?\334\233\006\343\217\377\323l\323\245\375\307\332\275\\p\356\254o\306\303\006\244\322\342\206\341\370\204\337\b!{\313\235d\246"
+	.string	"\231"
+	.string	"\246"
+	.string	"\364\304\335a\367\016\035\207\334[l\300\b\314\333\363x\217\035\336\365\t\036\236\220\003\243$&\200\034\357-\322\270\370\031yk^F\336v\f\246\257\3053\213\356\336b\231%ik\323\035\337\370\t\275\223\t0X\342\255:\233q\303\306\233\250\b\252\n\240\234\204|\351\264'\330\243,\030B\240\233B\302\237\227,N\266\202,nk\002\253*\""
+	.ascii	"\202\277*\200\307\207\206+\310Ck\225\0015=y\323\0174Q\361S\031"
+	.ascii	"<\301\021\344\n\372h\177\351\027\214\242\250\b\t\201NK\b\367"
+	.ascii	"^\246\300\240\360\354:3\0371\363\rs3\005=d.\366\350g\024Yq\202"
+	.ascii	"{\210Y\346G\177\200\027\177Y\354Lg\330\213\244\034s\342\017\363"
+	.ascii	"r\245\263y\342\271,)\223%e[R\256%\345&)S\222\362\007\304\234"
+	.ascii	")\202\357r\344^\237\223\313\225\262Dj\234\351W:e>\037\310\237"
+	.ascii	"B\334\2113\274\240:\336{]A\370ML\f5d\264\244\352\336[\301\374"
+	.ascii	"\017\376\022#=i\347J:\277\302{\024DFQU\367\026\027\334r\004\363"
+	.ascii	"\326@\275\214\f\301\354\272=\363\016\263\213\231\373hD\321\f"
+	.ascii	"-\222\220y]\237\261E\202\265\2317<\252\266\254w5\365\203\345"
+	.ascii	"\006\025\331\303f\346\360$5\363\336\373\200\217\004\003M\001"
+	.ascii	"\031D\267|\022\344\355\201Ub\335-3^\0351q\305\243'\033\3415="
+	.ascii	"Y\035\322l\353\343\214a\2042\340\035k\352\364\333!\202KL\337"
+	.ascii	"\022_P\031\247\220\\\224>\3321\315\364\207\345\225\343\fE\302"
+	.ascii	"\232\366\237^w\020\r\3011\205d\245GO\206\241\257f\266\301\241"
+	.ascii	"\007\302\372M\217\035\317\242O9\236E\265\207\274#_\335>\256\262"
+	.ascii	"\030\243\370\250\025\267h\331\3146\034=\360\325_:\354"
+	.string	"x\352\220\362u\t\nE$EK\007|3\363\341FW\263\321n8\233\rG \247\006\242E\324t\270Q\260\311\325L\335M\007'Aw\253\261\351\330\344\"t\300\311\251\201\210\325\330\334j9\233\323yh\246\231\301\311\241\241\335pj6\032M\356\003mf\3068\01759\232\016\207\313\321\\E\336+\253\354\227\227\276\3610\2513\213\024\257{\255\0362\214\225)\323\263\244-Dz#7\273\347K\277O\322\226'\363\325\\)L\227\335C\243\274\336{/\253\2072\032\234ta\362\243V&\3313\031\007V\371k\244m\262\353\225\237\013\276\022\0135\223?\202\274\265\3352^e\351\t\342\321\263\fM\250A0\210\214BH\021\022\232h&H\352bp\002\241:b\007\020X\311\244I\2265\036\306\352\313\256\253\330,\"zb\026\234BFy{ \207uhq\260\343\256\037\277h}\2443\241\305\224\266Y+\325P\350"
+	.string	"V{W\026\316a\255@2\246\"\023\256a(B\346\266\364\005\007\240z%\277\253\325!\373)@\252\325\255\334Q\373\217\206`\036\344Cs;\017\020d\r\037\211\236B\\\335\232\261:\b\204\340f\206\2100\020I\336\354\314v\260T\246\201\221\002\257\361\333\225\235\202\374"
+	.ascii	"\250h}\362\345\214\226K/[\321\233:\365\003"
+	.text
+	.section	.gnu.lto_isEmpty.261.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"e\013"
+	.string	"\306\225O@ Q\224\016\017\241\303%\344\025\001\374\304Lm#\203\234\t\2510f\002\211 \333\343\220(\252@\207\376\257\337\215\324\237d\037\022\227H\013\b\024\nP\001\247|8h\365\367S\370\227\t\332{K\231R="
+	.string	">"
+	.string	"="
+	.string	"\207O\223\344\177u\250bC\b\020.Jd\245C\013\303\037%\343x\230\335\235d\250\324\227\341T!\224\354\364*\251\022\356\253\247G\206\312\334P\260\273\316\n\031\310\035o\233\201m\002\366/\001\373\321\321\330\0250E\007\333#{b;\323\276\207\177\030}Dt"
+	.string	"\273\032\211\023\273\233\001\017\260\016\275\335\022\017\255W\342\241m#H02)"
+	.string	"G\t\306\201U\327!B\306\356v\251\206\223\002\252\205\342\365B\022\203\305I&\204,\016W\001\247\026&BL\331er\252\024\n\265(\252.x\201\312\031\366VJ\025\261\377vw\255\232\341G~}\351\324\364\3433\\\370\260"
+	.string	"r\n#6\017:\034\f\364\211\336h8\0206W\207\323 \302\265\301>\227\306b\217\004\007\330\005\362x\260k\262\355Usj\201\347\313<\325\3036T\214ION\205\372\216\032\246\354\"T\021\377Y\302\251R/\020"
+	.ascii	"\3571\226\020\032\241\0162\fEe\225\271\325\321J\023\tD\001\215"
+	.ascii	"\353\t\341s\031\345\252\361\023\313\302D\302UU\r\351]\005\n"
+	.text
+	.section	.gnu.lto_printRxFailsafe.262.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\242\007\305)"
+	.string	"\212Kh\020Dp\236\316p7\250\312\210\376-z\334\360\r\343\201\243\332|\227\374@\343y \370\256\335\2524\334\317\344\302\222qz\005\033\301\254C\3229b\341\332\231\202\030+\377\234\354\303s\f,\222\220\032\331{\357-e\222\001\364"
+	.string	"\330"
+	.string	"\363"
+	.ascii	"p_.0\216\213\202W\215\fK\037L\314v\337\270\314\225L\271\346\030"
+	.ascii	"\302\002\026\367\243\003\b\305\273m\231+\331\332v``\246@\211"
+	.ascii	"\241>\313\276m\201?wW\313\013\341\227r\035\373\331\201)\247\330"
+	.ascii	"YWe\323\317m\241\376d\340\356\366Z\214<TjX\202@\261\362V\212"
+	.ascii	"\277\302E\364\263~\245%yR\177\256R=\357~\312\251\024\217&c}\353"
+	.ascii	"J$L\334\272*\2376\201\372Sx!\364\247\371 \364\347\026w\337\020"
+	.ascii	"\321X\273\036,\305\216X\354\254\353:\354#\013tS\371M\271x5EO"
+	.ascii	"\263\271\270g;\202\344]\327U\263\225\304\021;\032\034d\346\204"
+	.ascii	"\245\230\234\267yq\332\244\307Q\036?\177c<n\232Ledv\370\214\321"
+	.ascii	"0\205\316\024q\363\3459l\354\213\373mgJ\272y\335\265\215\365"
+	.ascii	"8\247\024\326u]F\216\345\370\372\276\273f\273\013f7-\nO\370;"
+	.ascii	"\006}s\337\350\304\213\367lR\277\277<\024\235\244[\332\035\333"
+	.ascii	"\336\f\336\323v5\356\206\364\006YA7]\251wQT\361\221K-\204\034"
+	.ascii	"\313\323\3133v\327\256\262\213\373l\367Eu\310\312l\233\355>\030"
+	.ascii	"\336\355\373\364\267\257\323\325\376\246\307}\231~\345g\260\364"
+	.ascii	"\265_\301\321~\245k\371&}\355+Ly\221~\274\007R\336#\225\327("
+	.ascii	"\3455\360\343-Jy\013\250\274D)/\201\037\357P\312+\244\362\016"
+	.ascii	"Hy\203R^\240\224W\200\312\373\223\362\006\370\361\372\244\274"
+	.ascii	"A\225\027@\312\013Ly\177)\257O\345US\336\324\307\213\246\274"
+	.ascii	"\247\312k\246\274\215\3622\312{\bKw^i\324\2266\372N\271\336\330"
+	.ascii	"\223g\255;\345\226\334\355\177\373\343~-7w/\367-{.\017\003\372"
+	.ascii	"{\311/zh3\314\034\250\203\360^\346\002\032\350\247\005\264A\362"
+	.ascii	"\323\367\222$\023\005\355\210\201\035\240\223z\277\006\303w$"
+	.ascii	"\341\354\254\253\361H\r\252\361R\026\374<{C\007>r\315\325Gw\255"
+	.ascii	"O\007X\251\333y\220\260Os5\037\314\r1\002=r\004\372\323\247\235"
+	.ascii	"\330\310\001\350`\377\f\200F\177$\347\242\240\235o~\r\354\364"
+	.ascii	"\f\311f,+\360\235C}\375\353\2463:Q\333\327'q:#j_\356'\234\344"
+	.ascii	"\234\036\332\315\350\220\3051\373l\371&P\263\373\212\032\236"
+	.ascii	"46_|g\203,\354\264\207}B\b\332i\377\270\207\366\217^\236\372"
+	.ascii	"l\364\f\f\357\270\267[\342aL\250\353\372\025a\017\246\210\344"
+	.ascii	"\204\232\204\253\203p\324\362\312\250\2405\275\373\251\231\356"
+	.ascii	"(\367\303\237\273S3\365.1\212\217\354V\200\324\301\204\273\251"
+	.ascii	"\235\372\004\353\322\f\232\251\3179c\033\\)%a\224\222pKIhUE\244"
+	.ascii	"\202\221\365\023%dtA\313\212\270\325b*\030\225f\271\b\201\342"
+	.ascii	"\252J\2128\225\342\007\302\205\325\026\221jJ\nI\013E\025\325"
+	.ascii	"\025\226\005\253\251\253+b\n\013STD-\253*\"\024\214,\"\025Z\304"
+	.ascii	"\016,VlI\251\033\325\240\312*jxUE\\1\214\312\322\0326\020Z,\026"
+	.ascii	"SYC\027XXYC\240r\255;\333\3256\037uzy3\332\253N\355\263\r\212"
+	.ascii	"A}I\226dG8\336\260/\357\203\262\004r\204C\207}\266\373\222\313"
+	.ascii	"\033G8^ja\2071\232\2646_|\347\346\272\256k\372\277@\223\372A"
+	.ascii	"\277\355\247\230\2652/\336\303(\322\201F\352\364L\214\355\302"
+	.ascii	"\367\364\0340\352#<Fv\006\364\212U\276#IWA5~\313\202\237\033"
+	.ascii	"\310\272k\213\332@\247gaw\034NgN\021Q\027\210C\324\357r\250\037"
+	.ascii	"I3QX\231\343M\311y\304AM\300\302P\023\300\023q\2747C\003Z\310"
+	.ascii	"M\200\210\250aD\305\210B\304\320\210L\220$MZ\003\240\002\221"
+	.ascii	"\271\2629\021P\251C\316\225\246\225j5\210Pg/\242\304\022\001"
+	.ascii	"4\335\t\221\371\320:\224\310C\244\376{\2608\"M\266\\\346]%\032"
+	.ascii	"\f:$\037\"\266\001\002\017,\211\001r\362\031\310\377\206\320"
+	.ascii	"\220\373|ZLr\n>\336;E\305\340\220@\244`\212\210\254\236\203B"
+	.ascii	"Z\245\023\216s\215B\244\007\300\221\203Xxz}Z \032\307t\336r\276"
+	.ascii	"\201r\342\225P\353\3119\333\320\355\315\375\001\016^\366\203"
+	.ascii	"sW\237\340\373,\220=\300\021\223\346\221\367\3611\351\271p\254"
+	.ascii	"\203T\303P@\261\313\022\376\276\267\037D\304\251\\\224\237\025"
+	.ascii	"\205\326\005\245\347I\261\030\365\356\327\264k\013\302\265\323"
+	.ascii	"\216\352\240\036M\371m\230\031\004U_\3416\210i\355h$s\261\216"
+	.ascii	"\354\361FP\312\221C\232D\232\002@\313J<#\026\246\311\343\234"
+	.ascii	"\304\204!\240\335J\r<\316\321\356\371\005\333\352`x\306\201\214"
+	.ascii	"X\027\277\363\372K\226\202\202>\004\376\353\240\177"
+	.text
+	.section	.gnu.lto_cliRxFailsafe.263.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`l\f\305D"
+	.string	"\372w\244\032@@\346Q\007L\207\341\223\335V\306C\024F\005DV\023\376\367D\344\013_\f\331^\024F\210\340\345B$\300\313\250s\366\266u\347\373\321u\bna\374!\373\035\376\020\202\320\\xK\366\336I\246\024\230\001q\001\236\001n\276<\227eo\n\232\366\275\260\363\351\353w6\212b\322L\366\364\034\263cc\324\002\350lq\365\247\226\356\306\016*SG&\200\316\312\345(\"\245yL\351\255\211\035\333\006W\323\036\327\3015>\23225;Y\227i \f@g\337\337\034\256\203\017\"\274\236&L\007\242\251\034\276\234\245Z~\306\335^G\263\303\3632\003\375L\347\360\345\354\274r\266!"
+	.string	"\235\235z,\355\261\207\345\270\333\331\274\314\353m>|\2303\225:\273\234\245\f\332"
+	.ascii	"\320\331\226:\261u\026\350O\255\263\375v\357M\001\311H\b\323"
+	.ascii	"8\3147F9g\343[i'_\245\336+~]*\212\b\365\3444lbZ\022\272A\245"
+	.ascii	"$\340\257e\327\237\302o;\031\322\245\242\340\2668\021\352\351"
+	.ascii	"\207\001\255L"
+	.string	"\213;Q\235X\326\"\336\025<\034\200V\026\365\2462L\253\326\\\256s\252\023\272\376\326\252j\276\346\204\202\227\320\312\240.\324\323&\352R\235N\3544\301\301'kN&X\351\207\241K\033\263Bhei\236\264>\210#\243s\252s\311*\364\262\267\346k\3163\f\\\333)S+Nu\236\255\024\350\244\345y\236\031\376\255Ogr|\234\352\214\256X|\270,q<&nW\342XZ\323\251\316,\353\002\276\251\"\217[bv\375\264CC\234\352\324\262V\230\016A\344p\216\205\220)\361\252\244v\304\037x\304\247\226\310\200\254\305\234\263\303\371\2005g\030\214\177\030r\316\215\233de\336T\336\355\322\356\256\353V\232\006}\226]\224\270\312\376\263\205\315\267\360,\240\251\026\202\323|\3159\347\365\237\036\326R\275\205\257\002B\244\272|\242\304\325\226\302\377\007\276\373=\201\275\331E \217l\"V\362\306k]\215\277\245"
+	.ascii	"6\361w\253`\201\275\371_\\>\262\251\036\377\357Y\004\216\031"
+	.ascii	")\211\253\337\200\255O\313\377\263\335\253\026\231\351M=\225"
+	.ascii	"\276\321\372\273p\003$\206\033\365\020\023\370\356\026[\330\233"
+	.ascii	"\376\016\347>$\216\211]\037\237\330#\273\245J\374\317n\217\260"
+	.ascii	"\247&\355\247\322m\301\345\274\265\\\334\017\032\030\375\316"
+	.ascii	";\313\347x3\3608\336XW\013\\\334\n\334\215w\002os?`\345k\274"
+	.ascii	"\r\270\270\013\270\324\235\200\323yWy\032o*\027\367\224\213["
+	.ascii	"\312\305\035\345\342&\272\270\241\204\270\237\\\334NB\334C!\356"
+	.ascii	"&!n&\027\367\222\213[\350\342v]\334\301%\334J.\356$\0267P\210"
+	.ascii	"\373\327\342n"
+	.string	"]\334\254\213{\305\270\337\305\215[\334~A\301#e\0364\323\274\357#\315c\325GY\217\275\333\342s\334\343\270\313\271\323\271\337\271\273q_\343\216\306=\215'u{\273\035\327\353\016v\227\337\351\037\3217ar\316\035\354\352\016\312i\2473G\006\217,m\202\310x\323\236\027\307\307\232\315\244\271\214\3519\306\210\215Q\227\227\277\351\326\t]\024\354v6\355s^\347m\034\257\203\001cx\224)x!\253(\372F\331'\315\023v\357\301+\370\306KE\303\270\365\037\274\353\371:&\213]\0338i\020)\253\356\257\r\334_\013U\201\2636\031\303F\370k\252Lq\363L\314]z\326\273\035G\220\224\253\266U\332\324\005\033\\5x\334W\205\214\361\231\336\316\3560\223r\032T\351\001>\340\344\205\202\377T\201\242'\366\310\267\3332\227\364\317~\267\321fY\235\221#\343\366G\f7\212\201\225\257\224\ti8\371N\201"
+	.string	"\315YL\313\331\306\031#\337\247\2257\032m\235\315\372"
+	.string	"\321;\006\037|"
+	.string	"ofp\224\236\301\257u\"\275j@HX\257\364N\307Y<\315\352\226_\202k\316D\300\177&r\254g\317\310MY\200\223\336\345\270\243W\r\013\232\363\322\233\355}\336\350\325\262\276[\232\257Z\373ry\275`ob=\360\223~uE/\364\005\223\005\370\236\347@\352\333XU\310\222\244kW'\321\317G{\365l\022\316\221\033\240\002\330"
+	.string	"\231\267\f\366\346\325\343\274)\216\364\260\207\265\277_\360&\240\220\334\372\300\335)q\325\214\033\n\363a\031\234\237'\022\034N\367\033\306\013eh\251\360$r\353c\3139k\021r>\r\355Y\234m\016\036\2607A\264\316\376\276-\203B\022\323\326~\202g\353|\373\216\347\300\275\267\261:&\233W\275\361Z\366\013|c\246\231\023\220:+\355?\207\036\326Z\375\237\201\003\343VG\f7j\366\255\036\317u\325\210\022\330\233\354\027\0358\2017\360\036\347!\366\024\t-\202\003\t\022\031>h"
+	.string	"\266\260_X\025\271\254\2129\254\2123\272\266`\350"
+	.string	"k\352\030Y7b\340\330\3622\322\370\362\362\372\342\252\352\030Y:\300\214:\300\236\216/\276F\2748\342\270q\024\326\360c\215\0358\326\365\230c\306\026\212#XW\016\033G0\027\354\210\203k\013l+\206\206\343\213//!\030\216\032?\343H\203\306V\f\256\037\214\034.\376H\243k\306\321k\213\304\013/\256_seu\315\3402\322\350\332\3622r\201\3350f\021\373\253\306\021\314\210\343\353\013\314\030\224&\035C\362\225/\265\"*'\246M\242IF\355XsF\273"
+	.ascii	"\347C\2763\270\352\306@\203\332\210\030\360\360\312\235\r\306"
+	.ascii	"\362\"!@\225\300\245\303!p\026\310\313\304q>\374ce\216\036\363"
+	.ascii	"\221\300Bk\304@MA\337 B\200K\027\263\234\2522#=Q\300Q/\365\005"
+	.ascii	"\336\337\340\347;&\300\317K\006\\:\024\201\221\027I\221\371\310"
+	.ascii	"\326z)<\304\211\037\365JO'u\313'\270\210C=\361\037\322r\355\351"
+	.ascii	"\241\320\302\204T:>)Q\236X:\321=1m-\362\355\316)\317\035J\223"
+	.ascii	"K[\223\361\241\342\240\264\265\013\276\352\205P\275\352\331$"
+	.string	"]\0367@+\360\223\027\214\005\357\303N\264\236\030\275K\276\323;3\022\2230'&\351\240K\316\206\035\354\242{\304\264%q\325U\ny\016\233\314`%aI\324\271GI\220d}\323K=\231T\231\221\222-\335\331\241&%}\b\034\2511!X\233#\224''o\211\351\f\227\205\005\321\3460\031vz\323\320\3223}\325\223\t\034f$*\341/\375\024\3362\200\364\250q0\304\024S\246dFDD\223$i\f\200\002\021\242\262\316\001\021\220\27536#I\ni\f!\243\324\275'.\244\3549\370\253\206/?\275|\263\203\372-K\320-{?\314\037b\240!h<\002\316\274\351\035\021\017\262'q\364\017UB\245\335\256\\\006\251Ek/\020`\330>kH\344\017\201k\227\035'F\376\372\210\200\223\356\366I\230\356\217\224\334\362\375\251\025\330\311\221\005*\275\337\267\035i\347\034\346\273\306\207\316JL\356O"
+	.ascii	"Rk\301\351\247\206C\023\364\013\324\025z\024\325\234l\313s\322"
+	.ascii	"\267\032W0_\301)r/\232i\213\306B\212;\350\321{~/\305j\356\006"
+	.ascii	"\345\270Vvu\343\216\376\027O\241\324\210\352\004\020\f\350\303"
+	.ascii	"\326TDM\306\220\246\204zk\241\367.!`\314)X\r\240d[\357!\241!"
+	.ascii	"t\235\177\301\3344L\3732\200B\323\344\007\254*\270#%N\321\215"
+	.ascii	"\207\234\247\302\363\205\0262U\207\200x\212\352\227\214\204j"
+	.ascii	"\013\207\324A\252o\030w\253"
+	.string	"\rG\017\002\324\356\022\37692\0246\252cwE\352\317\242\366\362E\310{\370/\257\330\262\233\227Hm\343\255N.\004\230\262\364\332\332\004\036\206\215L\373j\300\305Qu\206\023\263\243n\177\222\302\350S\377\363\027\271`\002\030\276\0032$\315\003\367+jcJR`\241f\233\034\317\007\032Z\\\212\274$q\036Z\2470%\034\222\021\305i\205\200\227\202-\207\367\b\332\343\302\276\333\313Z\352c\272\2330h\246\246\212\205\270%\303\037"
+	.ascii	"\302C\0200\027\2251\315Z\200\374\213@\030\004\201#\253\327\226"
+	.ascii	"\317\220\020\315\241\257\226\212g\027\306QDo\213\246\350\201"
+	.ascii	";\256oH\025\306\341\206p\241\233Ft\260\263a\212\026\215X\217"
+	.ascii	"\374\262\367\270W\2777\322\017\261\267\321\370\017"
+	.text
+	.section	.gnu.lto_printAux.264.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\013\3158"
+	.string	"\032f<\026AP\244N\007\323p\t\255M#\240\017r%~\252\021\004gx\361\323\266+\271\261$\233e*\314\306\n\345\336O9\b?\254QJ"
+	.string	"\0205\301A\340/p"
+	.ascii	"fp\273Mp\036\365&!m\357\224R\nY\001.\001V\001|L\263\303\210\205"
+	.ascii	"\303v[a4\215\260Mm\n\022o\216\f\267\231\206\366\231\366\343c"
+	.ascii	"\337\016%\274\271\247\232\203\b\312\346\013s\"{\262B\212\316"
+	.ascii	"91\315\356\215iX\376\b\021\2152\205\007s\231\261\224u{\262mG"
+	.ascii	"\274\266N\330m1\334z|l\225\231\307\340p2{\262l\353\234$\205v"
+	.string	"\205,\373\244j\225k\334V\373\310\314\037FG\236\027`\360\334>\370\263\273(\333\313\016&#\326\354\013\\\325m\225\237\267\235\271\355z\213\262\357z\260\221e\345\364\370X\366Y\305Q\267U\247N\"\266\232\366\021\261UV2\353a:c\311 \370\005b\342\025\262,{\365N\030\251\323g3\322\225]\204$\032:\256\306[$\252\351\273\222;\257\241\3329\313A=6\262.J\377\254\020I\303YK\222^\b\304\224\323zKG6i\213k\242'\2716\270\036B\322G$tkG|\205\363\353'\2725#n$\322\267\345\332\334\272\330p\326\334\032\220\351\304.{k5=z+C\007\311v\2266\240C\305\310\221\r\315\323\264@\234@+\r\330Op\326\336R($K\310\264_{\032\233\231\177\353\265\352LRhg(\327\026\327^\324\300\262,{\223\255\255\331\250\231{\0013_a^\225\002\334;\210\025\236"
+	.ascii	"\021\271.~\342\3301\363@\354?\341)\274\032E\253\262\364\3035"
+	.ascii	"\304~\377F\243[\372!S}\177\373\365\007\272\026\314r0\257P\231"
+	.ascii	"\037\376 \337\335\222g\244Cx\252~\360\314\\0\274\233\022>\251"
+	.ascii	"\311E\320\220\020\355\311\230\237d\376N\346f\222\322%\220\237"
+	.ascii	"\t\363\210\353\034\242\3134\203\350\275f\017\327yC\3775cu\264"
+	.ascii	"9\003\206N\323l\241\301tW\350\276f\n\355\245{\202\204\016\323"
+	.ascii	"\r\241\357\272\037\\g\253\353\\\325|\315\rzL3\325T\207ifp\235"
+	.ascii	"\027\\g\251\325Y\301uN\260:G]g\004\327\031\352:?\255\316N\327"
+	.ascii	"\371\300u6p\235\013\254\316\004\216\316\003Vg\001F\347&\2433"
+	.ascii	"\323u^Z\235\225\256s\322\352\214t\235\217\256s\200\353\f`u6\272"
+	.ascii	"\316E\327\031y\235\211V\347\241\243\363qu^\215\316F\243\363\275"
+	.ascii	"\316E\2423\361:\253D\347\264\350\354E\347\316\232\232\263\214"
+	.ascii	"\003\306O\320\017>Y!\207\203XA\265OJ\377uG\273\323t\227\351\336"
+	.ascii	"\353\346\353\356\353\036\323\227\371\217;\332h\0320jM\337hZ4"
+	.ascii	"L\036^\207\241\032\013&\325\256ESwg|';\221\252\233I\364\215\t"
+	.ascii	"-n\370\252Oc\226\362\252?~\321\037}\322/=\325s\003RR)\312A\t"
+	.ascii	"\343\354X\026\255\233J+\027\255\341\244Z-\276\022\213\262\316"
+	.ascii	"\273\311)\013\367d\254\364K\177\346(Y\022JO\2435\203\364IZ\272"
+	.ascii	"O\026\322\373h\367\352\356\312\362t\200?j<\r\340\003\030=\200"
+	.ascii	"-M\270\307h\317\360\256h\206\374\"\264\270\246\346(\221\350\221"
+	.ascii	"\377\204\320\350\206\236\350[\311\245\357dE\230c\254\266\303"
+	.ascii	"\241\325\252:C\337\177-\264\356\316C\327\001q|\037-\3240\275"
+	.ascii	"\353o\370\325\371\004\312,\304,\242\351d\315\3611\210\304\372"
+	.ascii	"=\245\375k>|\343D\256(\247\261^m\373\033\374\322W\272\350)$\276"
+	.ascii	"S\035#fx\265\354/\316\227%7b}\037)\321p\214\337\203\332<\303"
+	.ascii	"%\277\317l\002\205w3\3037\233\0223N\321nV\\\2265\223\300\315"
+	.ascii	"F\331dq\243\264z\277\373\264yuwH\237z\3651\374\237i\217\b\022"
+	.ascii	"\277H\374\316\3034\222\276\372\315\004\340\026\236\3023\267H"
+	.ascii	"z7\323\177>\355\233\340\331\223\261\177\205\267\360\r\330)\360"
+	.ascii	"\346\334\240UY\272Y`\020\267\364\235\001<\226\300)\307X\262I"
+	.ascii	"+\351\265j%\275\276C\330\214\344X\r.\242\034`.\036\354\304\026"
+	.ascii	"\227\214\257\256\031\267\253m\210\231\200\361\325\265\225\344"
+	.ascii	"\212\261\222\020\2331\226|\301\265u \254k\353\013\214\303\027"
+	.ascii	"X\227X\362F\227\230\026\026\327\026\230\027\223\214\260$\t\032"
+	.ascii	"^c[\227\265\254\272fh]}u%\275\256\264l\204]Y%1\030\r.\033Wb`"
+	.ascii	"`6\256\216O\266\237\ts^_=5J\f\t\313~"
+	.string	")X\364N6f!2F\361;dB\235\3238%b\360\235\327\3069\277BL\250K\370\251OC\352>\235\262,\313\"\337\3318\210T?\342\213<9\3742\030&n\351\207N\264R\265XT\n\023z\f\361VV?\340\017<\202O\360R\013\2444\370\005\337\314B\n^\312\203\370\370\243\340U\264l\242>\2017\263\242^E\333\246\016\352\021<=\224\323?m\361\037L\2476\206\006\376@\2017\360\337\206\300\027\360\263,\251:n\0265G\340;\256\r\3642\265\001\257\242\r\034\022\360!\276\350l\017\235%\024\360\355\326\272i=\205M\346\021\004\202\276(\027\217B\3013\262\276\223\033\260\215x\242A\230P\225x\377D\2010\241\317\035Fl\360i\r\330\r\327<\023\250bxN\177\352\031|\232\207\177/Q-M \276\207\f\n\200\301\250Q0\b\221r\206Dd$HAA\223t\240\002\221\261*\325\001\021"
+	.string	"\255D\020\322HR\2224\006~r\341H\rU\322q\202@s\372?\202\017\360\354shC\253>\252\310\342\\\201\004\200%@\b\022\311\004R~\252\272\fK\013Q\223M\213\250'\270UG\327\232\323\336\302E+:\023\227h4\303 .q\f\224~\344y\372\270G\234\n'q\304\001\342\r\335^\311H\324Dk\230\253"
+	.ascii	"\210\326\203?oTAD\326\312\226\004\212i\265O(V\016bp\303Nh\270"
+	.ascii	"\302[,\030\be5\251\204?K\355\016\322\0265\315\315\n\246;S\255"
+	.ascii	"<\013lN\"pz\236\375(\365\232\251z\251G\235\243\243O\023\256\365"
+	.ascii	"\251|\007\265\f\200\261\371\312{\310X\354\252\3427t\023b\320"
+	.ascii	"\"0+\372\3136+:^\312=\3227\354\t\031b\005H\261X\230\202\251\223"
+	.ascii	"\366\020}\261\376?o\031\366\356\344\031)\203M\222B,:\032\023"
+	.ascii	"q3h\355\311Mb\317 \200\246,\272\244e\357\007E\360\266m\226\235"
+	.ascii	"\352N\331\344g\322#\007?\nS5,\206\267\224DSb\210\263\313@\321"
+	.ascii	"1/\217\261\007\230vZ\036\226\230~\254\303\002\323\263\303\r\006"
+	.ascii	"\230(\3366\243&\b9I\0345\364\037\255%\300\202\302M1-\330\244"
+	.ascii	"\206\225\367\330\220\b\226\334\367\243\266\235V\304\271\357\020"
+	.ascii	"\354\211\022\367\034\336e8qj@\216\246\376\303\214N\005"
+	.text
+	.section	.gnu.lto_cliAux.265.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`9\001E\016"
+	.string	"\026\233aF\020\221\223\016\360W\037\220\353\005\340a`\252\302\177\253\214\241A\353\346\364\001\313<\002\214\315\023\360U\021\330\335Z\377\317\245\274N@Vf'\221\256V\204\271\f\"\024,\b\352\013E\304/\225(\365tk{\357\275S\nM"
+	.string	"J"
+	.string	"O"
+	.ascii	"\340A\365\264\363\001\365\324%\373F\001\2235-\200\321\342d\305"
+	.ascii	"\216\335\275\344\210\227N\247\214%\3770\367t\237\351\264\243"
+	.ascii	"\362\t\340S\271\234\bZ.t\b\370R\023\344\231\350\016\363\370"
+	.string	"\341C\305\310i\260\273\216\335\227r\327\333\216`\373\201}\224\006QQ\212\260/\3030\f-U\366_\376z\360\2473\372\235\257Nx R\316\202c\327\013{l\r}\261\262}w\270\n+ a\243ew?\377\330\216\240\207\031 \217\366]\236\242\364\227\222\177\354\252bhv\301\004>\3209ug\235\205H\346X\331=\275;\313\006\371\f\346Yy-5\\v\227A\314e2\237\345\324\026\264\370N\253\247?\206jo\\|\347\313\224@Qs\362\225\233\026\2154\207zI\201E#\025o\314\211T\332\244\r\361\335e\200\031\031(6\255\22449\276\020\"e\"\334\026\202\215.\254\202\201\214D\033\3116\021\004\221\r\343\030\013i#\330E\242\211\266\013\033\221\256\020\310\\\206lti\340\270\321\365\001O\237+Uv\300#\204M\353$Qsw\227\022\210TViK\230@c\f\023o5?\242_R\375\220\032\032"
+	.string	"I\231^\t\377.\306L\274K\nWz\021\301A\242\335fX\f\034\314\032D\267\211\252\370\202"
+	.string	"\t\261\232(\031\354\023\2561V\270\017T\003W\300\334"
+	.ascii	"\025e\334\345\235M6\205\271F\253\240"
+	.text
+	.section	.gnu.lto_printSerial.266.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`l\n=1"
+	.string	"zU\364\022DP\236N\007\2577\307\f\315\027\322\022\002\017\255%\320\334\210\b\306i#EIfV\366\204@p`\314\234\025\244\272z\025\202}\321:"
+	.string	"\304\001\216\201-Z\005\302}\344\032u\325\302\023\250\355\335m\357\235dJ\001\030\001\005\001&\001\355\022\026\3641\001\357\252c>\220\032\233%\036\306f\330?%\216\305}\257\333\257\264\367\265\261\243\246\226\216\005\f)\214\032\233\025\245S3V\256[i\347k\243\263\335\275G\003\251I\215\243p\232)\265\2560\216\251P\3166\n\327Y7v\367\347\325\300[\013q\007\006B\246\372\224\245S\261A\024 nV\321\301\300u\266\251\256\347n\257s\273\245Oo\364\033\307o}Y\342\230\312\240\225\\g\221\374\330:\273zP\353l/\273\337\020\215\305aRU1N\274\3028\216\221_\244]_\251\336o^:\374\272\305\226]?/\333\365<i\256\217\031\310\027\rsx-\226\355P\343gv\254\255U\204p\326\234\31734\312\314/\22135w\213?\274]\217"
+	.ascii	"\311<\371\211:\327$6!W\214Q\262\314~U\327\020\276\235\245\371"
+	.ascii	"\272>\rj\251c\214\216\255G\263$O\357\363\\\026m\346w>g\245Sj"
+	.ascii	"\235\341\333\231\232\347\242\2058\216;?\243g\336F\357\356\275"
+	.ascii	"\356&\353\206\201\002yI\035A=vm\213\377\315\035--\n]_\332\016"
+	.ascii	"\326\346\357\252\262\246\231\357\264P\366\357.a\"\3733\377\004"
+	.ascii	"\267f\243\360-V~\0277\347\177I\n\202q\334\254R\341Z\256\3348"
+	.ascii	"nReY\246aI\305\315\331h\235\365\367>_\231\210\225\201k\263\233"
+	.ascii	"\212\345\304\327+3\324\362\355\223\035<\224#\277\233\2052\373"
+	.ascii	"3\352\217O<\203\206\203d\037\326M\r\313/\355\366*"
+	.string	"B\262%\375p\335\021\252\250\374\316}\312\251\270?\210\362<w\007>uG:\026\357'\337\363V\340\324\344y\336Ln\356\2456\267\022\234;\001\234;\311\315\215\340\315\215\004\347>\340\3466\360\346>\202s\033\271\271\013\274\271\t\300\271\213\334\334Do\356\2416\267\020\234\373\b\347\036\340\346\016zs\013\200s\003\271\271\003\274\271\001\300\271\177\334\334>o\356\0368\267\321\315\r\277\271_7\267\313\346.\272\271[77[\314\275\026s?\233;\2679S\202\031\232\224\212\313\317%\301\241\367i\202\246\256\315\256\350\224\215\377\363@?\340\217/\364\235q,\231\024\337\310\024\266\325\3051\231?\227N\\2e\223\263\355/\237,\241d\177\366\221\017D\266\230-\217YQ\345fR*3\231\204\036\352\020\314\224.\207]\240\312qR*\221\351\370\376E.\017\335\t\317s8@\300\007E\361;\206\205\002\362\030\246\360:t\200"
+	.string	"|"
+	.string	";\227\023\207\020"
+	.ascii	"]\226\303y\363\323\363>K)\336\206\315\232\036DC\027.x\301mW\343"
+	.ascii	"\201\031\326\336\300\241\365'\207\326Y\343\037\031\371{\037~"
+	.ascii	"w\"\266\007G\363\241\002`r\302\031\344\373~(\227H7\365\311N\357"
+	.ascii	"~\325\203\271\025\337}/\276;\271P}\373E\3514\321\211(\226\023"
+	.ascii	"\033\312\331\247\372\037\343\374c\346\304.\312=\336a\332\377"
+	.ascii	"\365\273E\214\310\376d\377\206\033\231\217\231\301$(&Y!\314\324"
+	.ascii	"\372\253\233'\232\203\231\341yqq\334\364\347\227\244\253\251"
+	.ascii	"\366\300r1\377XcS;O4\0372\006\230\327\276\324\317\247\376\210"
+	.ascii	"G\b!`\275\225\265\204t\344\265u\0056C\313G\351]_$X\304Pf]i\265"
+	.ascii	"\200\277\266\300\256Vhi\bb\241\\\021\203+\303\326\225\262K\313"
+	.ascii	"\253\347\205\327\025\b\0310\300\262\334\306j\240\334\302B\306"
+	.ascii	"P^\301@buy!\033\034\233K\206V\027\362\213\213\253\013i\244\306"
+	.ascii	"\376pz\356^\341\341f8(\366L\370\245\375\036q#\314U\005\235~\271"
+	.ascii	"\241\275\272M\357z\376\306U\3138\375r\324;=\324\371\374\215S"
+	.ascii	"e\215\3438~\213L\337\353\352\364M\017\355v\247\321*\370\b\337"
+	.ascii	"Cn\01630\257\215\231\023\363\026\367\245\355m\252o\234~-\325"
+	.ascii	"\177U\3338\375X\357\342O\017\255\302q\352\265U\337+\353\364L"
+	.ascii	"\017-z\243?\360I\237\340\225\226\220\2541\333\207\365\323/}+"
+	.ascii	"\265\3427g%wD\351\027\340\251\305]XP$\331D\304H0\301{\2239\274"
+	.ascii	"e]\206\033\222\204\364\b\242d!nA\220\3500d l\007\216\336\200"
+	.ascii	"]^SK;\3123\354\220\321\262\017\243\037\"\360\0052\217\263(\201"
+	.ascii	"w/sz!\262Y.+\372\241\241'\3129>\004\200\276\250Q@&\021bdDFD\224"
+	.ascii	"\246I\032\003\320\002\221\241\241q\003\021\020\2513\016UIY\310"
+	.ascii	"n\323H:\362|\331\005\234\202p>5\221>\270\243\220\305\341\370"
+	.ascii	"\213G\036\271\200m\341\004\373\\\307\366P\215\355J:\215r\267"
+	.ascii	"<\313\376\302{\nL\327\2275\b\243\3637\202\275\305\240\331g\032"
+	.ascii	"\321\b\344V:\252\255\262I\277:>\270\357:c\200\226H\024\316A*"
+	.ascii	"\244\305\020\211\004\343^3\220\026w\025\267\325\346\260\223t"
+	.ascii	"\024\200\351\237\271\017\210g\362\222\210\221\207m\262\364\207"
+	.ascii	"\022\275\017\3159\340\270\375\357\260\346\301\315N(q\352\212"
+	.ascii	"\253\201\200^\223\204\005)\021\337\016\260@.\247\034&\303X\017"
+	.ascii	"\022\311h\237a\223{\230\254\007r\005\344\230\003\026\213\350"
+	.ascii	"\"\017\t\303\221\354\0301\006\321%\222m\ri\276{uG\346\325|\200"
+	.ascii	"\005\323\342\213\213\030\\f\346\265\202\007\\\024\250\b\222\353"
+	.ascii	"x\224\307\177\335\260h\354\365\n\003\256\215\344B\310\374\324"
+	.ascii	"\342\"\316D8a\256C\213\247\236#\027\326\232\246\244DT\204\206"
+	.ascii	"\3126\301\220\366\232\031d\3321\364\271rm\017P\2000\303\250\234"
+	.ascii	"Z\351\316.\3028o\246\211\306s.!y\342\036\245\003\236\271\321"
+	.ascii	"p\200\001\306\177\200B_\200\035\035\363'/\035D\177.-V\353?\267"
+	.ascii	"\024\206\210?"
+	.text
+	.section	.gnu.lto_cliSerial.267.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\260\rEG"
+	.string	"zz@\033=0\340N\007\307M\005`>J\003'\270\1777\01341g\263\260\342L\370\360\246\234\262\227v\330\374K\2238\200\004\b\314\300D\007\3009L.\364P\333\233\216\335\324EG\2046\331I\246\024\253\001\210\001\240\001\216\355'\242\233\231\372\0314\2476+e\233\363\034\013-t\313\301\324\313\244y~\3138"
+	.ascii	"e\251th\222\341\201\224\037\263\323\361e\273ls\276fh\372\262"
+	.ascii	"]\214\023N\275\260\031=\327e\3671'\373e\233s\256\320\364e\225"
+	.ascii	"\353Ko\230\034n>r\315uF\326C-\240d\316\327+_v\203n|"
+	.string	"\335q'\201\343n\007\364\300\251\013\362\360\244\234\371\016\023s\276b5\201\246/\373\352\321\327\227M_z}\331\323\356=NnY\255A\026\017\216P2\347\254\365N\332u\367\352\r\205\247N%\235\222\212\202zrjb\212\002XRJB:2*\202>\211\234M\346\273t\037O\333\351\324\234J\272W\007\306\247\300\032\251\364\221\362\307\271@@\034\345B#\377\220\370\343\334\027\227\301\035b\244/\336a\250&u^\374\311I\257\t\217\211\212\037\216\336\001\020\2624E\nVj\214Kbv\3615\372\350\203\004\345\312\334\023|t\226=\324g\257\216\213\033\021Y\261\211]\274\310E\260E#\310\037\347\252nT\316\217\352j\36204\212\336\213\224s\366\2759\274\027i\256\317}&!r%\244)\"\347j<\300\343\034\022\027K\261\323\307\027=\300\225\271/\330\211\275x3\300^\335\021g\272Sr\340d\361\307\271#\256"
+	.ascii	"\274%\207p\370-\342Kw\351\0161\322\210\356\315M\020\371\207\344"
+	.ascii	"I\347\206\335\327Z\206\f\340\344^\235\240\277\213\240\352\206"
+	.ascii	"\210\021]\233\033\215\303$\217c\035\307\321\261a\314\354\312"
+	.ascii	"97\246\322\325yWy7\376\320\335}\335"
+	.string	"\317(\001_\242ur\316\017zLq\234<\262\206+\335\360E\301[\346x\025\374\257A\026\n\200\263\276{\n\206\002v\252\202_\032^\231\324J1h\300N\315\372\252\005~\365X\317\204<t|\303\302\206+;\nC\275\033\337+\367D\307\3460zB\355\366\360\001\037\332]'\267o\316vG\273u\235p;\217\267}\304\353h\034\016\n\034U,d\223\004\314y\315\215\277)\321>\305\227m\002\005v*\212\327\227\356)\336n\025,\260S\333\r\257\240\321\302\365` \270%\377\326\256\361\372\267\030\274\323\206\t5\022\276\372n\257/\354T\177\307\272\207![\311m\333\253u_\331\360[\273\335\3078\326\241\353\347\353vA\367\013]\023\234\321\233+\002\204\007\r\266<\214\267\002/\364\316\302\362\253\373\025\021n+\001\256H\306\233J:\345\212\336RQE\270\241\234\270\237\234\270\235\236\270\233\240\270\231\234\270\243O\334"
+	.string	"\240\270\227\234\270\225\236\270\223\240\270\221\234\270\217\236\270\215\240\270\213\240\270\241P\334O(n\"/\343\355t\342n>q3\211p\277N\334K'\356o\342\306L\334\276\001+rP\216\230l\336\323\271f\271JCY\273T\244\342\214\356\212\356a\334\013\335\311\270\227q?\343\314n\357\3664\355j\372\311\230\203/{g\033\303\023\333\027\373\251\330\214Um\327L\307$4\223\b\b\303\206'\366\327A*\251\002\346\234\237\330\007}\214\033\372ai/\224\022\372MnYG\312,\321!\211}\210"
+	.ascii	"\226\336\332\313\345Z\236-\205\334\r\265\334)\331\365\021&!\271"
+	.ascii	"\236\366>qv\256\177VN\272\033\376\035:\3422\342\330\264&,S(\273"
+	.ascii	"LP\023\007\316\350\255\325\374{N\345W\370\246\350\255\375\364"
+	.ascii	"\264\227\350}o\020N\033&\224\366r=\3213Ab\261oU\266A\356\177"
+	.ascii	"[\255\032>\324\216nN\346@+;\253\021\211\241\366C\330\227\215"
+	.ascii	"@\b5\026e\225\254$[Iv\367\236f\316j^uW\222\263\222Ur\316V\276"
+	.ascii	"\254z7\374s\324\272aJl\310No\356\371\326n\376\362\315h\270\240"
+	.ascii	"\351]3\347\266\b\355\200<\3204\211;\315\233\352\275S\275w*Z="
+	.ascii	"\323\003\341\031G\257t\031\357\373V\337\030\356\310\373\\\217"
+	.ascii	"\315h\341%\223\251\025;\365\375\252\b\277|%\353\2315p\224R\f"
+	.ascii	"!\002\032\252\231?\222Dom\b\377a\"\377\f\332\241\202\360\256"
+	.ascii	"\306\223&\377\266h\333^\355\357\020#\2558\337\332x\321\233\222"
+	.ascii	"\3316pX\346\225K}\034~\267\336\261\336\314\223=\204\3032\267"
+	.ascii	"^\300\307\265\373F=f>\370\006\037\327\336|\353\035\217\372\007"
+	.ascii	"o\004\211X\371V}'\216\235Bq\252\037\374\377^7\205\016\033\235"
+	.ascii	"1\224\b0\2217\343\333>\355{\267\250L\255`\247\342\367\311\277"
+	.ascii	"$\332\267B\301A~\314\267\366\324\341\235\220\245{\332kthG\351"
+	.ascii	"\266\247\275Q\037\247\365\255\377\265\310?\003\030+\313t\013"
+	.ascii	"v\352\326{\366\317\210\266\355\355\342\330i=\006V\240j\252ad"
+	.ascii	"\215y\211\231\205\331\320*\023k\302\021\006F\306!\354\314\213"
+	.ascii	"\004\030\232W\213\"17+\243AtF\2066\003\355\205\031\0050\2611"
+	.ascii	"\257\033Jfg4~\314\353\306\277\020sAVf\341\214,\314\314\f\355"
+	.ascii	"\253(\214Ll,l\206\027\b\260\031_\314\376\312\022\033\373\322"
+	.ascii	"\"\023\363\232\241\365efC++\332e4\302\314\264\316\312\312\314"
+	.ascii	"\264\236\327\265!\336\265\366l>\204\352\353 \371\252\201\276"
+	.ascii	"\205\003\310F\212\346\346\2747\301\317\270o\303\340\312\256\200"
+	.ascii	"\217^\351\243\357\364O\017\365\215\371"
+	.string	"z\034b\356\315\221|sj\217\312\346\233\317\035\360\345\225\367Tm\312&)W\315x\257\326P\277\274\242\007P5\360\351I\350\331V\003E\340j\236\023\3237\031az\035}\216\223'0\222\273\350\322\003\260[\352\262\002\027\261SB\372\244!H\257\243o\316d\013\\\207\351\216>\nE\261\350\215\336\341(\233E\317T\334\363\244\032(\270\206+[\002v9Su\024\300M\177Xi\t\264FM\312\227).|!\310T\016c=\311P\313\233\004v\262l\221\202\222~\0239\245\357\374\270vs\347\2005=[\006\337\370\211zk\373\242\273^\\\022\277\247.\251\257\3728\271\303$\202O\020\276\233\002\236\352\343\372i\352\333m6x\351\307U\025\360\023\211\307\335\335\234s\206Z\222~3I\277\335\"\251\347\035f\361s\232\360\355\"I\177\352\343\272\023x\325w\275/z\bB3k\360\223\364'\274\021d\2335o\325"
+	.string	"]yN\226\3176_\263\225;ec[\236\023\235`\037\266\211\251\310\003\201\017\250Q@\004\025SfDDF$I\2224\006a\005\004!'\035\226\007\021`\261Snj\322Ja9\037\313\243\324\262h+\"\223\312\351;j2\320\037/\356\204|\220\"\221Q\333r\224\234!\013\343n\233\236\237\002P\345\275\240\006\227v\304\263\332v\366\006\"\3503\013\334\340Kzgf\351\367]\336/=c\363\276;\224\310\233IC\3048}\032\265\350D\020\326Rrt>\331\356sB\210H:\"\b\31070\365]8\200\203p\205RA}\320\225\240 \315k\024\304#\355\006\035"
+	.ascii	"\221\347\3020F\245\367\312G\341\036,\020\232_\227\001\320<q\245"
+	.ascii	"\374$l\340\312\307Jb\243\005H\333\006O\236\372\371\f\272\025"
+	.ascii	"B\033\r\261u=6w\373T\277\304\\uRq\237\202kI9\244\263\357O\341"
+	.ascii	"\325\275\241\361\024\355\265\036\021tes\034\324\213~B;"
+	.string	"!\311/\215\r\232#J\031\333\362\316-(\365*\236T\325\273\307y\230GD5\214|A\261{N\371\376mv-`\024lI\350"
+	.string	"\251\277Z\377P4\245\364\201\216q]E\316\bZ\027C\231\326\253rt\242\363\2154xY\237\231\"Ky:\334\0273\b\331l\203\n\030\352A\306\267F\233\020\206/\n\023@\362\232\321\201\ra9\340Gz,p\t\344\254\333\362B\250=H\376\364~\026\227\372\324\264\221\177\200\023\260\266I\257\372o%\250V\220[_\034\300K\016%Ze\222C\341[q,\371\003\nm\234\303\250\033\370\201&\nE:g\313\321\244\340@\234S\004\332r\316\3633D\244\317\235-\274,?\250>C\3409\363,,\326\243\003\2142\001\3614\035n\300\376\013\tW;t\036\343\\\341\270ysV\324[\305.%\336"
+	.ascii	"5\264\270\002\205\341v\364\264&\362\350\036\275\027\216\330\032"
+	.ascii	"Zn\252\234V\222\343\016\304\372\355\211R\250?U\023\030\244\202"
+	.ascii	"\3622\207\256\207\357\355\315\251\246N<\320\217\030\272\251S"
+	.ascii	"\324"
+	.text
+	.section	.gnu.lto_cbCtrlLine.268.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\266\001=\020"
+	.string	"F^jE"
+	.string	"\221(\035\363\211\"\207TF\311\254\2561~\366\356E\001\370\233\220<G\315;\327\366\233!\375\237\327x\364\177t\214\334\b\252\320\363\354\257\277\253\252\365O\2304\214\264\215\346\315\030e\377\315j\375\204\220M\244L)T"
+	.string	"T"
+	.string	"T"
+	.string	"F\340=z\366\020\367\350\235"
+	.ascii	"\367h\320\2361\300\332T\203\332\213\226\013\216\335\375\264\303"
+	.ascii	"\301sq\323\004\375\323\316q\205\251s*\217(\235\220\225\033\200"
+	.ascii	"0\303uKP\263\342\006(<\331B)!\\\247=1\204\253\314\356\301\356"
+	.ascii	":]\341\353\356n\233d\333\201\235^?\247i\325tn\351\007(\220\003"
+	.ascii	"\304\3531*vSnt\254Ld!\342/\277\375\323\334\361M\334\005\374\213"
+	.ascii	"[|_\373\0131j\265\232\335\005y4\003\357\321c\323\331K\200g1q"
+	.ascii	"\334\345 C\201\367( \237\366G\234\004x\231k|\300.L\006\263;["
+	.ascii	"\020 M=\355\020b14\255\035\252\017\316\243 \355TVy\343\337\204"
+	.ascii	"\343\250G\235-\r\253{\260\251\201Q\215\031\344\235\252j\306F"
+	.ascii	"\013\215\223\264\361\265\323\247\340\364\nb\305\300h\355P\345"
+	.ascii	"\215=K\245\306\354o\273\273V\230\035\323\240\230\376\304\264"
+	.ascii	"\347,?\347/\262\244\n\245\220\b\236\322\t5\332P\026H(\022\323"
+	.ascii	"\250\363H$R\032}$\"!#\337\350T\362\211B6M \235>\224\311t\372"
+	.ascii	":\263\375\266\n\343\254\324dT\272\342:iK\0309\212\025\0272+M"
+	.ascii	"E\215\371\203\373\034P\321|h\231q\342\034\375l^\246\252\332\024"
+	.ascii	"J\362.{\2604e\221\036eC% P\002\"\205\327\r\301\271~6\006\333"
+	.ascii	"\203\2205\217\266B\206I \207\020)\275\263\210fH\213\362\340U"
+	.ascii	"\f\241\201\2570\315\240\227\020_\252P\f\276\224\"\265w\274\001"
+	.ascii	"\346\030\222\034\205\246\330e \373\332e=\313\262~\023*\215\311"
+	.ascii	"\0355\270\221\027!\003\024\327\024o\3235\204\005\005"
+	.text
+	.section	.gnu.lto_cliParseSerialMode.269.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`v\001]\016"
+	.string	"V\233`D"
+	.string	"\223\223\016\377?\350\332F8\323"
+	.string	"\265\330\315\277\273FC\314F\320\n\270\t\366\231=\336\364|\025\302\f\366-|\334\372\336\004\222\242~<\320\377\277\006\005\240:\306\b\024\371\227A\2749\026\223\020\262\267\224)\005O"
+	.string	"I"
+	.string	"O"
+	.string	"*\007\241\027/\301*G\f\n\036\273\253\0258\311\365\b?r=*\210s\277\"\324\344\374\247\336 dc\306\310\373\374\342\360(\n%\234\271\302\021\032\027\255"
+	.ascii	"\036\f4i\325"
+	.string	"tx\352\331y\240L\214\301\356:G\036\351\306n\233\305\366\002\373*\002G\335\232\351\314\3643\002\037p\220~c\263+3\004\310\262\242\214\020G\3756\347\247,\342\243\254\372\222\366\032j\254z\350\330\335\222G#\310\036\323\276\211\237\270\177\031>`\267\264\202\261\373\235\330@\366\350/\263\355\223x\t\316\016j\262\200\356\364BM\016\240\305\311C\226\\\265\263y\262P\220A\240\232\262UC\023C\215\341\272BH\335\200I\037\306\362'\236\242%\333\025}T!\023\235\034x\274\324\266p!?\272~\205\210\035\254\220~\354\357\223j\262\017WK6\366\357\277`v\361\250]:\232\022a[\201\0226\217\232\203\2422\201\243\261\250<X\3218\235\026\r\205\304\033\205\224\216\346\331\266\216&\362\355\341j\311O\3752\335IH\304\324\020\252B\355lC=\215\021\033X/\n\272\234\267\352R\3054\336\374\210\231\001\345\220\030\035"
+	.ascii	"\3571\346\2107\350\025\b\254\240\207\r\315\260\027\264\016\034"
+	.ascii	"\001\333\001f`\t+\344HB\212\212\270F3\001\272\206\213\254 -Q"
+	.ascii	"\214\212\027\267`\212B\215\240\212\fNL\322\006\261 \022(\003"
+	.ascii	"\362\005fL)\024\024"
+	.text
+	.section	.gnu.lto_cliSerialPassthrough.270.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\311%\205\257"
+	.string	"z\027\001?O \006q;c\233!G\020$\350\257\0264\nH\027\245\352\356\321\373\274\007\350\323\021\007T+\362\232*\265\360\337dw\357\255l\017\237\020\234\276'\036\256\203;\007"
+	.string	"`\274\030\330\227\375\267\337\004A\337\254\206X\201%}%\376\257\312(\245L)\245\347\003\221\003\353\003/\330\241\235w\272\216A\3538\335\202\335n\272\331t\373u\257\351F\323\275\327}\246\333L7\231\356\267\356\270\356.\335^\272\277t\323u\207\351\036\323\375A\01717s\303\341\226\303?qt\004\351\023t\343\027\310=\310?\202G\261\251 ``\2316\334o\370\307\315\002\372e\276="
+	.string	"\005\377\002\357\330p\003.U\260&\350\027\370\347\267\344\303\005\310\234\032n>\376Y\343\003\265\343\346ve\312\255\327i\370g\217\355\372\025{\333G\234<\266\300)m\257h\260\"x\325\td\322\346\361\217\031:\204R\3761\303\263\2450L\233\265\215\307\r\002\377\220\341QA\r\2330k\204cm\257j\3035\227\226\353\271\006\323u-\246=\350;\376y@\333-\373\003\t\264\"@\375\246aB\332^\377\r\321B\354\230\276\265(3\f\333\251o\227W\205\372\005\276\023\320\365P\337\"\357\253\361#\\\213B0\242\304\262\277\364p\265\334^0\026\372\347\346\200\027\n\244\270|, u2\345}\303"
+	.string	"\240\355B\201\204W\357\3550@\351\223\300\367u\223\321j\351-\313\216c;\267\313\355\r\302B\377\360\336\027m\257\256\332B\354\033\005\352[\304\355\025c\371\276\302\254\021\276\257[S\257L\242\355\325\215\202;N\355\314\275\326l\313nK\366\204\3675;\023\346}\335\236\030\251\355\225\335\232\210\355\265m!\266\327%\263\033\013^\257\026\t\351\217\346\026\302\367}\243\276I\333r\\\tw\f\314sxxx\330\252[\363\320\272l\226\343.\314\205\343x\013ka8~\343,\354\346\242\005\213\025*R\2408\221\200\211\022$\020\030!\"D\024\324\223S\023\023\210%\245\017IH\036:pp7h82\312\200\341\202\205\242\n\354\205hH\210\302\004\t\021\202\200\210?>=-\017\273\252\357Kn\036)\255f\271.C\236K\306\232\271\250<^`R\214N\320\t\034\323\200>\234\343\364\226"
+	.string	"i\336\242\016\3212\364\\\362\243\031\316\350\311eA\205'\327\227\363\333\240\3239\213\234\037oZ\305\340\311U\201\263\233\240\037\220v\001\330\352\221'\027\330\241\2670l\026\206iaw|\205aZ\230\035WQX\307S\324i\024\205t\374\004a'\2402\005\212\t\241\365\302\bU\"0)\3167n\302M\036\026/\301D\254M\223@"
+	.ascii	"\220\215\217\370k\021\252[f\332\334`VV\330ia~\036\342\257\317"
+	.ascii	"\243\240\362\372\351L\032\251;5\361H1\225\001\301A \345\3655"
+	.ascii	"\353\226\310\340\271R]\177\250\243\363\244\247\030\230F\002\243"
+	.ascii	"\272|_\334\203\231\016za^\322\302\346\234\003\017\264N\030\300"
+	.ascii	"vU\241\261"
+	.string	"/kZ/LNuZ\263\201\221N\323\3057\360H\345\365\n\245C\270V\370\024k\323\032\332\374\250\255\215\326T\227\3153\250DO\322\250\264^\230\232\312d\007\246\016\3151\\\351\013Asp\316X\260\"\215z\321\004\244<\260\n\275u\245\331\213z\002\314[g\364\3442\242\362\244\035R\351\2640)N\244\027\246\201\227\017q`\"\026\245\205\340PxSfB\n)v$8\ti_\004u\005[\324I\353\205AQ\377\215\313]\247\205\225y\020\031\220^\030\022\325M\013\203\342\304\025\220\315\017\217\324]\253W\244\250\341\342\363\022\004\203\366\301\240{x\244\304\240t\253\036\355\235\251\322zacj\207#J\346\372\2569\244\205\025q\036\207\322\354\023'gG2`\333g\230\021\266}\337\327'H\223m\231\355\312\252\371\353[+|\212Ei\265\221\244c\315\272!\317%E\372U&23C\202\202t\251Dh\226"
+	.string	"\366]\373W\020.w\036\251\367}\331\235A\304\232\001\320\314,3{\020f\rN\001ee$<\224\221\346\312\234\tj\"\277\364_\314\f\370\022\027%_R\237_\313t\037JJ6\3126\356\247\206e\352\305\177Q\302\b\017e\265\023\300J\370N\203;\323D^\302\013\251i3\247\211\274*\247\2466\355\212"
+	.ascii	"&\305\031\024\341\273\355M\371F\260e\372V\2047\372*\243\201\314"
+	.ascii	"\314\005@\035\344\027\303\201\276\361\034\213R\216rN\313\354"
+	.ascii	":J\275\026*\353x;\203\336}\241<\\jy;\201\336\345\324\312\220"
+	.ascii	" !\022_m\351\347\211-\274\226Mo\347\317\230\021\"?>\037\245\252"
+	.ascii	"@$u\366\274O\317\277\237\232\220iW\221n9\265 S\237\266\212\n"
+	.ascii	"\377Z\376\360v\266B\205W\352L\215\304\276\322\364<4\215\355\214"
+	.ascii	"\372\336\367u\352\273%X\321\331\373\276'z\3756\316\301-?\f\342"
+	.ascii	"S\226B\332\367\3552\301\216\226\324\262\274\200\007\333+\317"
+	.ascii	"w\232\024ia\033\to\337^\216e\260D\202\344\033\204\356\265\257"
+	.ascii	"\273$\205\201.\224([\332\207rS\300\262\337\317\020\336x\376d"
+	.ascii	"\251\244]\3222\373\215R\2570\240\313&\336N\366]\356\212\340\324"
+	.ascii	"\013\203\266\013$\f\324\362;<\017\035\322,\245\345w\270\373\233"
+	.ascii	"[R)\313\204\275\tkg\312\022v\263\365M\227\265h\022v%\252\233"
+	.ascii	"\276\265(\031C\321M\311\200\375\2107\333\261\275\316M\031\343"
+	.ascii	"'\257\025\320m-\372&!\302N\354\246}_\255&c\346$\257\024m\212"
+	.ascii	"_\300\314n\272\311\334\371\202\350\225\352[\356\212\0310\262"
+	.ascii	"w\314\r\177\217\315\233\227\265\311\033\257\347\226P\206\372"
+	.ascii	"\234\215\347bK\r\222\372\336\227\331"
+	.string	"\316%Z\313l@\245^\017@e\271\201\267\363\306\017\315\331%)\fd\276\026\373\203\341h\347\240\377X\0321\345_T#\324g\226\341\025\260\335\b\rpj\274\f\376\253\337M\303-?\254\342\315e\007&\330\271\030\260\264\322F\351\365\277\247\315\273\334\013\007w\024^\252-\331\274\235K6\266W\177 32\r\212\340`\231\227X\\\013G\337i\346\027}\270\304\275\3042O\265\035\252\026\252\231e4\035\266c\023\314,\242\357f\360\211^\031 \205.\032g\313\017\215\fC\220\242b\360~>3\003\002\360vr\313]\2412\r\232\203\027\366\017\345\356\301\366\327\200\373\353r:\\\344\007xf\007\036\360v\366\367]\003@L a`\327k1\273q\371C\231\273)\004:,\374f\314\335\326\335\317V\322eM\246\271\2214\221\006\322h\232\227\311\036\035\2479\253\005\233\221\355\246yG\3735\037o\3748\033\333\255\373"
+	.ascii	"\315\246\231F\2775\317\3505\315\013\364\231f\0311:\256\231\252"
+	.ascii	"\2734\303\230R\340\205\224\213\026=\246\231\205\217\363\n\037"
+	.ascii	"g\025?\316(\332L\363\t\242s\002?\316&|\234K\f9\223\020rF\340"
+	.ascii	"\235G\274\263\210\376\322\034\242\351\232\243|\234\241|\234\237"
+	.ascii	"(8;Mpn\nrf\nr\006\261\024\344\254\324{\315\037|\234\223\202\234"
+	.ascii	"\221\202\234=\0049w\br\346\340\343\354\022\2357\3708k\3500\315"
+	.ascii	"GA\316FD\347\fDg\fD\347\013Dg\013D\347\"\242s\205 g\"\242\363"
+	.ascii	"P\220\263\020\321\231\002\321y\202\004g\tD\347\bD\347\240\b\316"
+	.ascii	"@A\316D\242\363O\220\263\017\321\271\207\350\334\0029\363\270"
+	.ascii	"3Kt^\211\316\352\217\363\3738\373;w"
+	.ascii	"3A\021\007\267\247E\n\344\371\334\002>\332\351\373y\301\243)"
+	.ascii	"\2618\375\216(\335\210,g\032Sf\240W\306\364MQT z\031L\233\355"
+	.ascii	"\245\216\237\210g\3726D\362N\224em\323;\371u\210\2072S\223%\246"
+	.ascii	"GF\343\254\264E\201\200*\225,i\231\337W\005\372O\252\241\276"
+	.ascii	"e\333\322J\337\365\201\370\023Z\310@\345p\245w\235(\241\0342"
+	.ascii	"\340Jj\276L\251\001Z\313\374+w\246\314\327*#3\362\244t\204J\351"
+	.ascii	"y\304\016\343\220\261\265\271F\306\212t\232\246\241\346\260\216"
+	.ascii	"m[\343\300\t\003e\007G\217D\332\364PF\372\244\020%\225\243\r"
+	.ascii	"Z\246\023V!3e\026\251\302\305\364Pn>:h\340\354\261S\376\274@"
+	.ascii	"\244\3516N\036[\263N)\371\037>|"
+	.string	"\367}\230\262\203\rVZ\246\227\221\303\022\265e\310R\322/\021\231\223\005\316^\322\377\017\034No\301\022\254G\357\316\224l\355\277\\\352\034\254\341\334J6\326\303#}Ts+\261\260\234E\t\347\355Lz\36552\365^Tk@O\303@\2625\244_\307\030\002r-u\234\026\017/\342\3150P\351\305\277K<\203\206S\262\265\017\017e?\313\373\322\254Cr2\335fy]\232u\036zN/\320\301p\351\350\254\257\303\363<\r\327\222\376\355m*\266\216\022M\ra\234\237B\004\f\322C\035\2609|?\013\251\214\3728|\363\265\222\230\241\031\031\033;E\033\363\340~\353)\267\370\034\034!(_%\027\367?8\351\236'\025i\207\207rc\261\313C\003\370\2069%\030o\347\362\233\n\034\266\353\007\2345]\337\206g\303\240\345Yisj\031\237\374\024hg\340\370\342\200\310\330\320qx(\331\373\317\036\f\343"
+	.ascii	"W\303\377\333\035>\270?A\034N\201\036\270\004\353#hf\242o$\340"
+	.ascii	"\216\242\254c\r\337iZ\275\202f\006\216o\316\210S\220\265\256"
+	.ascii	"\r\321\274(\315\272#'\323E)\222f\235Q\317i\026\377\305\032\036"
+	.ascii	":T\364=\b\347\367\223A\bkG\024\352\304\250\0315\025k\3645\330"
+	.ascii	"P\031\215A\263+\254\320\001 a\206\2072\017\b\0272\374\377\321"
+	.ascii	"h\352\030\035\343\327A;l\340\032\356\254\n\020\f\017e\013\237"
+	.ascii	"\301O)\306\203\226\351t1>\203\fh\341\2413q@\027\275P\024\343"
+	.ascii	"O\374\227\21198mE\026~\375\257\3651|\237\3615J\273\243\273\226"
+	.ascii	"\351j\356\211\307\360<\320B>\246\253\025J-<\224\241\372\302#"
+	.ascii	"\035p\013e\224Ro\347\205W\221D\217\355L(\007KX\370\226\366\n"
+	.ascii	"\002\032\230B\247\300.\027\02410U\346\025\241i\231\256D\256\r"
+	.ascii	"\311\364\223|\240W\341\241\334m\001\316\232\017h\fM}\210\377"
+	.ascii	"\342\241\027\0375\344\342\217\376\253\350+|\r)\333!\235i\350"
+	.ascii	"+z$'me\330n\310)B\205_"
+	.string	"\305\354p@\306\3266\204-J\364P\236 \317G\331\027\245P\250\376\253\001y\0254\353\204ZI\217\231\364I\263N\275\3610\0248\233\222ziY\223\213\332s\372\305\177\261*\324\342\213R\262f\235\332\324.\376\213\2414\214?#\002E\t\234=\365}(\263\n4\345\023\225Zi\326\265N\246\2318\365\0344\365\314N\275\002\377\305@/\236\325\366\005^\263\216\330\335\203\345\240\027/^\352\277\372\256\273l\256L\033PSs\353\342Y%\272\3601\223J\233u\254\262.\276\305\1775\200,\312\335R\203\216C\026E\271\307\266\222\357\3026!S\247\246\372.\373\025hZ\270\370\342\310\270\374\220\333\263\227\205\376\005\256\021\276n/\210\366;Z\025\330\t\021\215y\032z\242\241:\320B\nBuO\024^\210\202\234g\023\347\362\302\n'l\365\027\034\021H\231C\030g\202\027\266{\002\343\034\234\360OFM\032\354\016\200"
+	.string	"0\334\035Gd\321E\036\201\270\031*\313j\002\243{\314\302Jr\2159l\364\260\341\"\215\022\034w\270N7\256\254\212\310*\t\220\307\030\036\030\252\350*\340\300\003.\322\030\301\321\315\252B\212"
+	.string	"q\314\322qD*\300-\032o\\UA`\3035\026\217:\222n\\Yee\031\261\\\247\036\305*#2G\225\213e\365\344\003\004ULrY\270E\036U5\334\242\353\204\304PE\343\225q\307\3215\326p\263\216Wn1\007\217\243\r\267\230d\304n1\311MQL\"\026\223(\260QG\025\226kDV\271#\334\342U\225\333\300\005.&\271Hc\r\035<\256\\\001\314\270\262j\300-Z\345\250\212\340j\206\0056^\035\257Vf\031+\0016\260\214?\354\372\321\312\215\310*\t\212\310\252\005\220F\035VY@7\252\262>\353\212\307q\n\013y\314:\352\370\311\312\301\243J\001F\030F\254\007\260\254$\314x\240\307\252oX)\340\3528\345\203\265\326\230*\362\250R\300\230\243F\325\225\221\210\314\202q\264\272\262j"
+	.string	"\b\231\005\343J"
+	.string	"\003\020\221\205<\356\210"
+	.ascii	"\301\r\036G$\004YXXU\r \217XWF\007l`\031\207\220Y;\214\021Ta"
+	.ascii	"\361\3408f\375\004\306\342\225\325j\274Q\205\205ed \313\210e"
+	.ascii	"D\022\215WV9\214:\252\002P\324a\203\207m@Y\345\260\021ueU\245"
+	.ascii	"#\312\006\022+\n\212\210\217;\214\310\250\254\343\021\031\365"
+	.ascii	"\343\266\325R[\317\225eF\317\213\305IC\306\326Dn\230\230Y\300"
+	.ascii	"\213\004\352\373>]\364\007\335\201oh\376{\315\235\\\302\252\370"
+	.ascii	"\025\320d\223\346k\241q\322p\266\342{\362p\370\323\223\n&+qV"
+	.ascii	"d<\224\201\234T=~\245\343\242\3574\215\377:>\215\367'\234\231"
+	.ascii	"\"s\246\304\350%\226\306\367\370\006\354\0024\201\324Q9I\242"
+	.ascii	"\021\302x\350\023\327 \211\366r{r\3261&kSG\254\261G\257\217X"
+	.ascii	"\024o|\366f\021\256$\225\307Kn\320\362{\2404\222\254\202\342"
+	.ascii	"\373H\324Na\233\2317\265\225\244Z\340\324K\2117\365"
+	.string	"w\022\013\233\225%\t\267\2277e\"\341\222\224\363vf}\313i\241\302=\351\264\353\265|\322\276\024*\320G\026\371+\034\227\016\340\376\214x\002`\222u\336N\344\273;>\201\357\301F@\023\b\237P\324\315\353\305Cy\001\354\216_\271\270\240\375}\335\002X\234`N\212y\272\244\007%\372\222v\017&y\027u\366\276]&z\345\237\373/I2\3112\311\244\224\355u\307\207\020\225ce\314\226\037\246\210\023\247M\312\304\037\337\355\232\206ah\222{\336N\023\257f\331\0233\345\372\341k'\371X\346\244_\222\315^\333\264+p\346\344\233\244\340_O\220\333c\233r\271\b\001\007\256\305C\231N\342\033/)'9\247\3043'\013\223u\340\224\372J|O\033\002O\342\033L\323\360\350\021x\033M,8l\032n\255\t\206a\361\320\021\377\263\027\327\004\356O\304G\375\210\357\346\220\246>z\021\3176\261 \257\371"
+	.string	".?l\267\247\326\212\207\362\372\227\202?K\362\316\216\350\231h\362\260e\256]J\275\376\025\024\374X\224ZYQi\224\253e\256[J\275\316\370\257\347\212k\002\347\307\200\317\370\306{6\245\027Q\263e\252g@\350\251h\323E\337k\272\204\f\2468\303 \r\2127\213\372\347\332\362\006\356\004\005\376\364\215\327\276\357V;\241\276\224?\2428\210IP\337\343"
+	.ascii	"\034\304\270\247\037\021\275+\304{\016\224`EgAZ\246\312\201\020"
+	.ascii	"=2\323.\036\263\255\301\004X\0249\362\004\r\234=\037M\324\230"
+	.ascii	" \321@\376"
+	.ascii	"\37744\265\214\266\267\261\275\276\022\r\344;\257U:hwp|qMhB\b"
+	.ascii	"$"
+	.string	"\361P*J,Fgm$J\247ny\002E\340\241\374\001\203\032\250\002\321(\320\302\030c\b\321\214\310h\222$\035\202\n\020\206\243i\236\306\264\007\022\300tEICe\244f$I\222\354\214\001\321\351\032lg<\246Iq\352\031\222\342XL\b\205:\355\277X}\020\340\200\214_\321\300\362\263i\310\003\313\356\345\\\210c\025\230EB\f\277x\"\224\360\245@\216\356\026v\253\213*+\020\b8\370\222;\320\020\265\347\302\263e\261/7\324Mw\200\232\211\323\f\317\017k\354\370\350\037`\316\316\304\242\215H\271\306\364\336:\250\337\325\202\001\036\232\350p\336\232\332\347*c=F\375\310\304\350?\007\n[\00641\271I\362s\3274B|\271\211\254\024\236\275W\330\201\"\005\343\354\200\020/\347J\0029\364[\224\322t\314\275PO\022>\361t\325\020\016\350A\300\356\377|3\351\002\0035\240'!\361\263\357\376-"
+	.string	"&\340\355"
+	.ascii	"m8T\234[I\r\267\321qR\267\323l\366\030\262\234\272\356\374\332"
+	.ascii	"]S\021Q\336\330\027\220\0325\266\027\265\2210\036\214FJ\b\b\006"
+	.ascii	"Q\022\246\347\350\337\216n/\211\272\346|,\247]\342\220JD\317"
+	.ascii	"\3066%\027\212s\312\301w\363\024\266+@N\331\200dVi:\375\032\215"
+	.ascii	"\227\364\177\335z\261Y\b\370;y\264\223Z\375\374\333&\233\375"
+	.ascii	"'\210\021\204M\255\267\223|\263\261\3438\261\344\2045\224a\373"
+	.ascii	"y\\\360\027\2714\267\354\313C\nZ\232V\351\361c@\304\033z\213"
+	.ascii	"\225\240\347\373yR~\201B\247\367\235\001#3a\362\211w\345C\361"
+	.ascii	"\027\007\335\240\375\013\025\350\302\214z\264\027\346\023\312"
+	.ascii	"6M\310\263\264F\366\bt\346\250{\307RDnZS\306s9\200\223\212\240"
+	.ascii	"5O\350\023\223\360\177\320t\004\212\260v\337&\"\271\002\035p"
+	.ascii	"\301\360>\177\335)\340o\002\016\331-#\321g`\225[\230\212\026"
+	.ascii	"\372\201T\340\f\r\231T\233\346\367rK}\025\346\344\252\026\225"
+	.ascii	"\\1\250=\245\340\364\247je\\\343\340\247@#@&\324\032\202\212"
+	.ascii	"\223\2454S%\320r)\325\007\304c\300\177\311e\005"
+	.string	"\2312\266\030\"\007\301\036\235R?L(q\227\302\3372\333\223_rf\021\371\374H\372\023R\220\313\250\256Y,)\t\324|\030n\272\205\335\254\001l\307\2773\372h\243\230\247\2652\236}\007\016\360\241B\217\007\f;\220\363\264\ryF\237Ch\360'\344\227\245&s#2l\342\035\343e\210~\310A\275\033j\307g\0131\033\207\235`\304\002\225q\231rV\231\362\032p\216^\3201\242\314\245<x\353\242\300V\020|\251\037\232\205\221Xi\234\303\353\250\205\341\332\346\020MX@2\323\3421\224\240\333c\240\300\304!\200\361l\024F\201\274\003\210Lg\242\177\243E\204\214\373\365\001(\227\002{%\363\245!\263kXch\373\356\257\352\r\226\005\236\247\202\210\265\224\n\372d\375\361\360U\003\037\357V\3244\023\326\004|\207\004\3653\373}\304\262\246y\272:A\203\"e\374\312\236>\351l\354\034\022\225\215\353\220"
+	.string	"\240\323\322A\325\374D*\024\265r\273y\"\344<h\274\270\235\034\247\022P\203\257\251\201;3\366,\006#\375\254\320\341\316!\353\221>\366\234\2051\020`\177\2030Q{_\355\004\360:A\3779\201}"
+	.string	"\362\340\2042\244\310x\255\306\233\370\341\350\305Hv\307b\313Ox\260\212\227\353\356\372\355GQ\246\356m\016\266\262\247K\301\bS\265\200\371\023@P\253Y"
+	.string	"2\240T \336\255\273\251dM$\205\034\334d\033\212[\023w\177]\310A\226\211\312$<\264\205p\\\225&\177u"
+	.string	"\350\005\2762\201$\217^{j^m\366\337\246\f\343\032\264\016JBE43\363YU\3757C\224\267E\321\311\217\020\2164/7-3~\346\302\023:k\2567<\007\342<B8s.gX;\325p\200\351\376G\220(IX"
+	.ascii	"\262\344\033F\361\305\314\350{Q\212\337\363\035\350\375\260\n"
+	.ascii	"\352\317@\260Kb#\n\r_\007je\311(\300\350\177}!\204f\230\340\325"
+	.ascii	"9=\307\311\020\334\225\235\251\351\324\220\234]\201 \004\306"
+	.ascii	" n\364'\034x$\373?\236\304C\347\327\225\250\210\027 \211\235"
+	.ascii	"*\305<\001"
+	.string	"\226\233%x\211~\325\344\331\304kW\330\2205BT\177\363b4\323\021\271\304\231\203\200V\335a\331?Z\002C|\324\255\250^Q\007\37627W(I\357*\242A)\347\356U\262mnW1B_rAn\330p\n\301^R@\214R\245\240\266\017\330\372\352\355\216\301\302\251S\307|\005c\357\201\236\2001\334\366\200\340\274\210\315\314\377\007\350Gu\344\342<>x\005n\033\300N\033=W\377\213\271\315o\210a\f\315\273<\246\027D\266v`\360\254W\271\217\216U\032\276\336\260\320\272\272\232_\021x\004+\177\211\262#\035%\030rv\240\276\001nj@\312\33124\f\331\232\212Q\013\346\245\202\355\270\332\0026\007\205\367\035\027\223\321\216\322\352\225{E\001\0164\257\242?3\002Y\374.\226\364\277X\224\223=\271\324{\3623j\237\246\323\013\331MZm5\356\366\222#\314\267\337\233\247+\024\223\204\230\002\201"
+	.string	"\b\250"
+	.string	"j\0277F\306\203\351\002\271\320\234P\236\264\365\004^\213\213\241\275(\375A\325'PAG6\0361\205\347^\314\243\315j\260\377jP\251\001\325\311\371\372E\354\227\242q\213e\217"
+	.string	"\241\274\035\306\347|=\340\310\016\034[\215\021\212\266h\177\217\325\337\254\024\204\245\345\031\b\326J\312\2508\322\240,\336#C\253\373\333\314c\f\nB%\023j(\360\bvq\310@\003\335U\313\n\006`X\303`\277\232\240h\3640GW\021"
+	.ascii	"\314RgK\177_\272\303\350\342\233\016\215&\354\241\2573\254\027"
+	.ascii	"\004\006Ds\363T\224\270[\277\347V\2101\026\367.<\334\205\265"
+	.ascii	"*`\n\023\366\341VAm\033\222\230P\214\325+t\b"
+	.text
+	.section	.gnu.lto_printAdjustmentRange.271.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\213\b}-"
+	.string	"\nR\274\021B`\246\316ps\302\252{\024\304\256w=\271\300#\037mqNPe*\305b\217.\b\020\217\345\335p+\220hP\034|\330\243\207\341\313\354\376\177\275\251A\214\245*x\203\177\335C\307\275\273\355-e\222\001\t\001\355"
+	.ascii	"\020\001:\376\006\255oN>('\363\207\371\367\376/7w\277\373"
+	.string	"1{\276%\"\243\224\027\304\013\021\314^\314\221K\2647\303\\\201\034\327\035Iyr~0\032@P{\230\264\340\332q\325\201\326\311\005\022K\357e\257\267D?w\367K\214`\333q\215\033J\312\365\331\005Z\327#\326\317\035\246?O\264\273\335E\006\227/\"\360\006}\361\361Y\324\256eF\023\322\332\266\205IV\372s\217\351y\367v\307\242\366;\032\253\256\353\2216c\326\365\230\265T\351\317\340\227\200?\315+\001\177\256\332\256\236\246\033\353\332\003%\220\"\227@\353\272\n\273n\243n\036\277@V;\n<\315f\265}\336\245\214y\330\222zqkGM\306!f\355(\256hz\001\222\362w=6\006\016E\361\361\263\307M\023JN\233*Gq7L\2519#`\216<\303\305\265q_\357W\306\275-I\2758\037g\024l]\327\345\267\270\035\337\364\273\013dw\215\354\246\030\002\021ZB\233f\334\250\f}\325"
+	.string	"\337\334w\223\302\306\177\253\325\357#\177\372\031\221l\311\274B6\370\257\367\\\371\261\354-\342\007\215u\007\275[\266\202\377\266\325K9\246\034\227~n\275\266{\\\343V\262{$\274>\034\333Iv\301\274\272N\346;\341x?\327\367\276\022\256\345\217\260\365.\377\203\337\375\016\036\346+\374\227\257V\326\273|\027\240\274X(\357\225\312\253"
+	.string	"\345M\200\362Z\241\274\bT\336*\224\227\n\345\235By\245T\336\003(oP\3455\200\362F\251\274P(\357S\312["
+	.string	"\345%\220\362:\241\274M*/\023\312;"
+	.string	"\345]By\005\250\274J(o\022\312\033"
+	.string	"\345ERy\001\240\274G*\257\021\312[\244\362\022\241\274C)\257\212\362\246)/\212\362\002O\336\023\3455Q\336\006\3622\220\367\024\270\362\260\311\301S\312u\362\270\006\375eL\032\235\232@\003\353\204\374\351)\221\303iJ\271gG\207\205\317 \247=\324E}\324I=\240\233Z\253\367x(\240H\302\364\321\331\255\253\333\337*\244n5\254~\232}!\003\377m\315\225\256\327\226\251\2334\334N\030S\023\215h\214w6\346|\251\007\\\316\005\364\222R\013\330\360d\035%4m\001:\311\215\316\351k\006\210\324\001\272\331\270Ii\244>\207\307\t\323\352\333\016\207\343\341\247\325\022"
+	.string	"}+\3065F\243>\002q7FM4\256Y\022uQ\210\263\t#2\252=4\342j\324&\032\331,\357\320N\223\305B\273$\236\246D\272\256m[\3733jo&\322'?\321\346j#wW\304Y\rl\257N+r6\260\177\366\213e\272\332l\264.\210\233\"\326\273\273\272\331\024\371"
+	.ascii	"\360\313|BK\350]12\376[w\363\251c\346\r7WO\350\363\035D^\020"
+	.ascii	"\244\033\0256\306\361\207n\214\371\031@\256~\232\273\263\246"
+	.ascii	"\224s\247\215\005-w\313 \230V\025<S16\234:\033\252gC\266\200"
+	.ascii	"\306b\230\006\203\314\250\354gD\020(\314\312\306\206d)\206(\020"
+	.ascii	"Y\244\rO\220\2151\241\221\2410\033~ \232\221\265 \242\245\251"
+	.ascii	"\030\033\"\255@\033rx\321\"m,]1\2552\026bB\263\262a\013\241\330"
+	.ascii	"\031\232Pki]\274 ;\023\022]\2708\023\022\035\327w\222\274\247"
+	.ascii	"{W\212,\375l4\033\332JV\265r\202\251O\224C\212H^\2705\317\005"
+	.ascii	"\375\274\253K\224sE$ouV\303\261\335\\\322\310\315u]W`+Y<\312"
+	.ascii	"&E\244\331\225"
+	.string	"\372Q\022)\"{\237\006\0246\334\371\256\366)\235\024\221\246W\257\331Y\275\240\341v\377\030@\255\006\353\353\375\364\321%\310\004\372\251\243:\330T\235\240\257\260\324\260\b\033\253_,\244\240\257\006\205)\350/\343\234\245U'@\320V\315\204\252\032\201\240e\325TSI\365T3\241\003-\005(\254j\311\037\250\276\003}\036F:K\003\035\364c\300\b\325Q}\302\240\372\313XgY\240\237\374r\024\b\200\232\250a,&\221rfDD$\030\3214Ic\240\002\2211\252\325\001\021\0209\207\220S\243IA\2325>\001~\233Z\203Rt\013\366^:\375g\202\025\234\034BI(\240\311,?\027\271\276_0\214\203\346\273=r\367$\375\300s\342EK\017\bw\321&q\300\250B\r\244p\233\326\"\301\026H\374\367`9%\026\022t\034\177$\261`\252\277\177\\\250\252q\351\016\321\350\240\202\r\0242i\327x8"
+	.ascii	"\022G\035\326\301\301\020\246\002\252#\360K\032\332\351\240Z"
+	.ascii	"\375`hZ\203\357\0165fP\240\362a-\314H\305\365\020u\251\222\264"
+	.ascii	"\204\r\274\247\237,\373\230\214\360=*\222\236\233\352\246\255"
+	.ascii	"\024\255VO}\233\372\242\361\376@\t%L/)\330\330\237t\352\351 "
+	.ascii	"1R\204Q\247\356v\300\020^]%\306uj\371\366H4}HP\023\026\207Z5"
+	.ascii	"3\373\3615\205m\3353a\252YG\302h\227\3203\245\377BPB(w}T\206"
+	.ascii	"\316f\220CA\204*\267\034l\361d\330\0166Y\303Y@\357PA8\t\fF\313"
+	.ascii	"\333h\372\013\346\237Ky\233\205q\276\312\356<m\273\260\377\232"
+	.ascii	";\025"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.272.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`<\001=\016"
+	.string	"\206\032`F\360\260(\035\360\367\022Z\204p\017.\201\270\337D\206\316Dm9\320\336~vs\325\370\223\244\nl\337[\253#\036\217\277\224-0\b\023\231\375\031\235\311\345\300f\341N\031kPNl\372\252\222\211n\215\354-wJ\001J"
+	.string	"I"
+	.string	"M"
+	.string	"\237\006\017\302>;\017\200}\032e\333\f \331T\202\0304%04v7S\021G}J\215(?\365\3319\271\344\370N\256\322\300k\305\f"
+	.string	"\037K\202Z#\274\277<j\370V1r<v\327\321\3738\334\330m/\260\335\300\376\027,M\331\340*j\b\373\032\206ahE\261\357\362\313\203\277\312\350wn\343\241e\322\341\037`\354\266\302\033[3Y\254\330\2761\334\204\021\220\220\341\271\307v\0043\330\350x\264\317\362\026\324]F\376\331E\241\221\331\005\017\270@')D\n\223\262\253\272w\227\335q\024\032\247\204\211\312\013\226\335Up\3421\233\257\362i\t\\\274\307a\237\177\005\314\356H\361\236\037\323b\246\246\344)7/\031\365\005\354\n\301\345\202\025o\314\211\252\266I$\336\273\376\345\337\240\242\005D\215W\236\0202\235F[w2\211P"
+	.string	"\021}h\245L\213@`\033q!['b"
+	.string	"\322i\034k!.D\313F\234\250\313\264\222)\013\201L\262\260\225\262\023\211T\312<\240\352\036*]\311\335\335) \252J\265\035<\230q\206\244\265\"?\321\037\301\374\017\354\256\007\034"
+	.ascii	"I\231^\t\377.\206\314\320tF\316\037 d\202\200+D\033\315\260."
+	.ascii	"\270\2225Hi\023U\362\005\001\022r5\0214\330\342\256\331kD\263"
+	.ascii	"\302}\240\032\270\002\346\006\250(\343n\276\231]S\223k\\\n\n"
+	.text
+	.section	.gnu.lto_printMotorMix.273.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`M\t\3351"
+	.ascii	"\nY\250\023FP\332R\007\277Il\"q\305\276\217 N\370\222d\005\237"
+	.ascii	"H\241\204\263\261\233\312K\261\311[2\007\256\230\322\240\244"
+	.ascii	"\313\224\212\206\353\350\362\261}\001\200x\352}Y\366\222d\340"
+	.ascii	"?$\274\301\\|\262\233\333\310\336R\246\024$\001\023\001,\001"
+	.ascii	"\371o\311\325H\341\336[\352\353\374\357\034\266s\376\326\332"
+	.ascii	"_c\354*V\2707\025\351[w\272\337\376\277}\334\313=\235\303s=\242"
+	.ascii	"\250x\261\200\223b\367\026{\365A\226\342\245\374\224\251w\223"
+	.ascii	"\372\r\335\256\365\372\243po,\244o}\251\007\273\353(0\330\304"
+	.ascii	"D\254\355U\310\324\2072\365i1\2207\273J\315\006\002\367[\247"
+	.ascii	"\272\237\335\377\354\235L=\232\f7\356\375%7\2677\025\201\023"
+	.ascii	"\271\337&\177\207\370-\3739\304o}\312\375\013\222\306~:\270r"
+	.ascii	"E\331\310\354\275\225:\314\335g\251\357o\236z\3705\272Eb\313"
+	.ascii	"\352<\345O\367BSB*A\267\254\347\303l\361\006\026\0176\002\030"
+	.ascii	"\302\256\277\243\312\257\020\255\2567\026/|iq\275\033\364\245"
+	.ascii	"\265\365\305$X[\231h\223\025e\223\325\317WY\320\334\2629\\p\325"
+	.ascii	"\327\202\305\305\036\250*\351\202\263hd\226\245\340\244\311\220"
+	.ascii	"\337\373|#\253\212\325imy\237\004\213G\326\177\367m\230\031\365"
+	.ascii	"\314\360K\253\353s\361\302\336\333\263U\226\326\373\361\335\035"
+	.ascii	"\320\335\363\334\335h{\317\226\231\336\251\t\266\245\231\221"
+	.ascii	"\017u\333\rC:\255\245\356\324g\326`tbjt\271\006s\177`\340\321"
+	.ascii	"\376\013<\337\373\321gy7\372\277\367\242\007|'\372\300\367\241"
+	.ascii	"_\373\027z\274\367\240\327{O\376\225w\240O\373\377\371(\377>"
+	.ascii	"p\366\236\267{G\362|\224w\001\307\354;\307\354:\307\3549\307"
+	.ascii	"\354\001\216\331q\216\331o\216\331\001\034\263\333\300\331k\336"
+	.ascii	"\354\3077;\374f\177\337\354\3067\273\373f/\276\331\2119{k\314"
+	.ascii	"\316\346\354\332\315\236\335\354/a\002!\025\340\332\265K\013"
+	.ascii	"R7\216\3033\333\257\255;\362|\377Y\376\377\376\001\377\003\377"
+	.ascii	"\361\376\365\376\257\374\333\375\273\375\303\375S\371\237\373"
+	.ascii	"\032\367w\177,\376}\357\367Z~\313W\035\016,k\002hF6\346\376M"
+	.ascii	"\177d\211\223U\324=f\0236\365;#\223\203\301\203\251\347s\221"
+	.ascii	"|R7\016Xpj=#\2637\025Z\305?\357\255\374\236\303W\306\376\351"
+	.ascii	"\352\305\354\226\362d\327\"d{\357\030.^\034\356 B\344\267\262"
+	.ascii	"\321?H\230\345GC?]'\363\350\032]@\273\217(\221\337\312\200v\002"
+	.ascii	"\201\352\247\037u\215\376h\232#}\324\305\260\351a\264\253G\037"
+	.ascii	"\351\214&J\334\341j)\373\027\330\207\244\250\301\312<\2541\274"
+	.ascii	"\332\250aM .\272e\244\203\364\253\177\330\242uE:\251\215z@\\"
+	.ascii	"\364_\207\332\340\033QK\235\005\321\3256U\265\242&jW\027\343"
+	.ascii	"\242[D\032H\02752.:\244YM\324\317d\332\247&\330VG\225\017\r\215"
+	.ascii	"4s\332w\215\237M\314Z$&\3765\253\005\"\315\234\362\225\241\315"
+	.ascii	"\310\207a\342_k2U\030\322>\203B\272\325_\375\023aS9\350\022\252"
+	.ascii	"\\$j\247\243\325R\177\353\013i\037\257/\3170\200\\L<\230X\211"
+	.ascii	" H\223\230\346\225\235x\302\330\201\2305i\350\276|/\261\322\232"
+	.ascii	"@\fH\223\230\342\225\241\031\261\032\023\310j\251\307\356\236"
+	.ascii	"\207X\315T\033\254\312e\334]\351\271\304Db{WA\360\037|\301\364"
+	.ascii	"c\035\213\241\211"
+	.string	"\206\240e\375\243\265~\350\222\233\367=\342\353\254\037\232\204*\037:R\277\376\036\027%\227\212\222/\232\236\236t\230+\232\360Qj\t\343\315\020;-\235.\230j\234\234\240\230\354\n\245fST+\265\204\241\233^\301\002\006\rR8Q\260\314&\b\025-\232\226\226L+^\fM'\3472\005\323\022\017\223\351ES\022\023\252\t\225\364\004\325\214\235J7,\342eR\324\223s\311u\245\004MNJ\312\026M\313'\245\0223V&\330q\250(&\246\262\t\005\305T\302\324\375\032\314;\230\3613,\234\241\251\334\340\244\330\275\277,\374\334?\335\343\024\246\345C/XK\335H\304Xd\226\375\312\215\002\264\263\331G\363\350\2533/.\354\336{\277Z\352_}\243\365\372$*\347\032\320\316\262<Z\300\277\223\210\324\017\364\337\375\2076\2636\250\017\0029\200\316\321:z\007\3511\320\261;r@:q\311\034,\377\026\024"
+	.string	"g\n\341\217\\5j\251\347\"\322\333l\271:\211\312\021\017|\217\276r'\220m4"
+	.string	"}\243q4R{\206j(\006\301\322\305\307\331\336\320\267\332\340B_\355\350\333\036\016I\371\255\234\335<\350\206p\344\210n\342\212"
+	.ascii	"\350$2\277\340\277yp\255\214t\200\263\250aT\204\020\"3E\"\"a"
+	.ascii	"\202\264 \351\300"
+	.string	"\002\021\252\252t\020XEU\222BZ\003\366-\353@\\\371@t\316\330d5*\273K\200\246\344\025\246\357~\204\311\r\200\322G\3646EX\322\004a\211.\035\321\007\030]T4\020\220b\303\226\017\322Uu\223\355c\373\337\357\3249\211R\201\227\276\006oD\307D\001\033\003\235CW\373\222\326\311\363\307Xr\333Gv&gD\307\2404\331\200Q\304\033\207\314\376C\204!\204U\266#\023\301\222\255\225%0\013b\253\307\240\254y\367\341\215\336\033\025\022Y\333\315\256\327lA3\223\r\223_\305\322\266\324\233\322*j\273\325\247\241\372\335\314\f\314w#1\353\370\334\353:\004]-\276\360\237\020\372\306\363(p\035\310B\311O\371\356t\034\215\234\302\2321\323\274j\331h\306\252\n\224\366\254\277\327vu\"h\261'\374+\337\252\252]!\315{\353\320)N\344\343\203&\244x^B\020K\016&\221\266@\ta^"
+	.ascii	"\257C\235]\305h\361%W\332m\3739c\352\264\240\237\256\271M\r\202"
+	.ascii	"\273c\324\322u\006\026\324\313\350\335\202\204\260:e\306N\224"
+	.ascii	"2kQ\207u\344kb<\026\312\256\377\260%\250"
+	.text
+	.section	.gnu.lto_cliMotorMix.274.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\337\fEB"
+	.string	"\352qx\031@@dN:\2172\211\225\031\322N@A\325/n\001\b\022!\020z\200\\u\264\024\300\037\343\247}le-\\\263\003t\2418\375z\302\326\217\337ed~\034\263\322\225\375\017\035\2334B\310\336I\006\202\001m\001\207\001e\315W\215h\210\r\2249\210\001\310\351\332K\222\236\366sw6\261\377\346p\334\307i\275\277k\357\211\f\022\004\204\276\357\333\325~\255R\335\byz\371\336\253\271\t\016B\337\267\311\340ks\265_\233A\376\032\034w\237y5\356\327\b9\324\373\272\335\321y\337\246\203F\320~\355\346\217\354\327\366F\366\253\333\r\030\300\354\035\343\022\364K\302\031|\337w+\303\365\033w\267lO]m\276\225T\367\004\006L\t\b"
+	.string	"@\352\030e,B=951-\021\225\206\255\220]\251\324\214\013\270}\347\0170\035!\r\311Q\033;\201\001S\002\324\243\240+\177\347[\242Q\263\332\374(9\203\003\2309"
+	.string	"3_\260\224\227\037\275t\301Q\\n\344\222\267\005\027\265\034J\245\352\003D\346|K-\352\201(U\354.\267\314\202\237\324#\022/\312\363-\323\250Y\320<G\317\213\303NI:(S\212e\r\312\233\204uQe\230\2653\265\311-\245\340%\"\\]\223)%\252\026\324\230\311r\276e\0245\273q\3469\036\033V\202\362!\336\255\370\226L\271\345\023\334\362-\247\334y+\271\245\023,T\205i\313B\347[2\325\256E\212\240\334\316\f\263Ja\230|m\231\234*)\267T\203\325[Yc>\253\030\354\372\2644\251\225\251\037\023\005\317\235\307hjH\214\213/ \314\360\276o[YY[\3636\360n\034\242\273\213t+I\nY\t\316\t\225\365n\320;T\331\255\031\034\347!s~\005\360z\016\354\351^\250C\353\241=c\201\365\365C\b|%\316Qi\323\246\024zV!N\034<5\277uw"
+	.string	"\334\027\302\366G\260\257\273\240\022\230\321\241\367%\273\362u\335\r\276g\"\033\0059\347\224\314\367}\273"
+	.ascii	"=\020\212>\227\257\255b\005\276r\005\373\365g\301v\267p\201\257"
+	.ascii	"\354;\177#xS0Rh\362qvc2\336\023\360a\372\363|\276\210W\0061j"
+	.ascii	"c\276\357\331\225`\355Y\006\254\257\255\026\220\220\rd\264\376"
+	.ascii	"\016\366\371\305\034\2422\374\250\227\260\201\334\035V\003_\371"
+	.ascii	"\274\2047\245\"\205\226\345\261\356&\362^\212\326\306p~\353\027"
+	.ascii	"\260\242\302(\255\263[\267\327\2047\177\t\\\020\264\034d-Pp7"
+	.ascii	"\357\253\257\371\255N\347]\365\346\333@\213\233J\352r\336\307"
+	.ascii	"(c\361q\336PC\334OC\334NC\334MC\334LB\334K\277{\023\205\270\225"
+	.ascii	"\204\270\207\307\335\0367\333\342^\205\270U!\356,\304\215Y\334"
+	.ascii	"\277`\301\021\262\357\215 \242l\250\371\"\231Fz\367\326:_N\347"
+	.ascii	"\277\373"
+	.string	"\345\374n\3768\367\343\004\220\036BNz\274N[0\244\007\310\3534\t&\340`^\234\224\313\263W;\203\376\332\230xE\376\244Gz|NWH3\035\354>]\337\256\211_\345\370\250\nlU\316s\204\312\314\375Y\312U\031\353ya\003h\356\021|\345R~\336\337\004\311\222\246\024ZV\205J\027\247\374\006x\251<\241\004\034\235\242\263\266:)nzM\371\255[]\222\312\304\214\366H\322\264\344s\211\315m\027n\363\2378\351\252%H\322\236\375\300r\227\270M\2224\245\320\b\370tpY\t\225\020\235\356\006\030\t\b\223)\261\271R\252\314\362X\023\263R&\302\325\005\232\302\223\022e\032\346\313Qe6s\r\213~\201d\366\316\362X\177\372\356\303\256\231*7N:A\346\276Dn\350\226\036\340?/\311\255\302u\350J{F\003\353\253\325\233\013'\365T\203J\241f\004\224\2501C\344\3234!S=\325"
+	.string	"\r\017\275TFc\363\345H\374\221\233\245}\337\262\256\376\340\245\356\026\325\355\342~a\335/\354W6\037\357\352$\246\363L\0352<U_,\314%\306%\203\257\\3\336\023\370do\002_\037-\303\276s\345<7\350\013\002\367\214\233\006_\311\225\037\250d\257\353%3\247\315o\252\032u\325\270l\3323\030j\276\363\3056\201I\366(T\321{$\314o=D\264z\345\365\021U\243a+\357&\362\3049D\030\261\371\355>\330c\366\312F'\033\301\2636$\236v?\257\2725\374\257\237\303h\240Hm\023~\327\375\343\211L\254Pc~GT\202\375*!n\220\fO\373\230s\276\335;\300\261\231&'\221\341i\235\202\303\006\021\036\330\336\221\240\n\006\030\f\0279@(5\207\020\032DTm\360"
+	.string	"B\303\t\021\036\230\032\206\213\0346\326\346\001\266\003L\214\355\031Zb`?\302nl\361\230!#\314F\214\251~\330k|\201\315\370Z\305x\350\310`8\302l\200\335p!\002\306\215/a\177i\205\331\370\332\302\021\346\342\306\326\227\330\216-\255c\347\320\001&\266\305#G\016\261-b\223\354\331\255Ht\317\036YF\"!\320\001\013\031\374u\360\226\016\\qGb}\215\016i\324\364\224\362J\241\022\330\262\fx\337\317\367\333\301qv\272\033`8,\367\363(\232\275d\036C\360\007:\265\001[I\207@\302u\3212\355\204[\"\200-\r"
+	.string	"\204\334\252\2241Ge4\365\255\307F%\n`\314\0202\321y\347|\222\204\2530\357P\231r\247\365\224\331=\321)"
+	.string	"\236\2549:\310\255F\025\263Q+M\226\026\233T1;\310D\347\234@N\271{\310\024\263\025\212\323\203\362\344O\226Sf\375\242K\216\371\255\233"
+	.string	"\032\027\344V\213P\271\230\321\262\362\212,\004\247 +\343=Q\265\250\374\326PyA&:\355\232\306\360\022Fx\224$\321S\320\224YA\201\220\214y\037\232\221\236I>\241\032\374\316\267\203\004\001\223\317'\006\207\312h\n\242W\n\004\213L\271[\003F\322O\242\030B{y\272c\3404?|\204m\244\f\304\200\257\314\334$\276\222)\013\333\004.\332+\343\013\003u\225W$!6W\177\366\312\362X\377\231\231=\t\357#\201"
+	.string	"\250Q<#\021c\206DDF$\005M\322\001\300\002\021\231\251\342\006\021@\255s\254J\222$i\016\257\260\037\r\277?c\331\277\036m\200\377\270\001\272\220\372\2179\260Euz\306\2730\317\340\375kZ\251\270\237\026\003(6\021\351s\253\2677\251%\361\217\226\007\303s>^a\315EA\221\210C\343Mr\213$\260I0"
+	.string	"\364\207\347\324y[\260xt}m0\\\231\361\254\312\"\177z\246>\257\221\255\314[\024|D\304m\310gI\354\020\033\003\007"
+	.string	"\241\220\037\036S\235\357q\302\202\334I\235o\0136\266\210\214\306\342l\212K>\346zX\202\3633\221_h\243\310\200\203\024h!R\241{\367J\331\313\211\220\001\214\351M:\235r[\340-\026\226\351\301.\275@T \\\223V\304\\?\251\005\021\314\2606)\250\tm0$\260\241\001\230\322\\\"\340!\f\341qn\266\004z"
+	.ascii	"\214\326F\300\013o\007d\370\t\335\301+\322\025\226R\257\223@"
+	.ascii	"bF\311\372\202\245\037\017\242\004\351M2\002\024\017dY\004\324"
+	.ascii	"e\200?Me\022{\341WC0\366hz\037\315\315ia\357g\200\2240\330p\300"
+	.ascii	"\347\353o\227G9OI\206js>\346z\021\226;\n\n4\001\337\022I\360"
+	.ascii	"\020~\n\316\251D9_\002\231\032\230k+"
+	.ascii	"A*\362Z\231\331\024\232\223\235\007\031\331\3135\313\237\203"
+	.ascii	"\2050\377\037J\376\006\354\324\237\327\247\203\306+p\300\030"
+	.ascii	"\311\3210V\342F7\330\341\367E\202\177 \017\"\364\\\024 \005\334"
+	.ascii	"jt\024\002\375\373j\233\216G\303\302\004\242\322\\\365\345\310"
+	.ascii	"\305\013\037\022[\3001\300K\276\204\341vI\250\274\020\370\023"
+	.ascii	"\217\274\375\343;\203\272&\244\001\350*\274]\232CO\273[\356Q"
+	.ascii	"B\2334\257\027\022\013$\227\266\231\246\001"
+	.text
+	.section	.gnu.lto_printRxRange.275.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\017\005U!"
+	.string	"\006>\330K\240\024R:\325\364\021\343\250C\311B\274\3063\364>\371\241\376[n\022\f\266\tN\342zMY0_\243\347\016\364\367\332\266j\334\266\357:\252\f\2226@N\223\367n\2746\244\377\2418\267\255\317\343\345\026rm\373\204\020B\344N2\300"
+	.string	"\272"
+	.string	"\303"
+	.ascii	"?r\355'3s!\335\226\214wH\013K*\211U\3565\372\374d!\365\347k\314"
+	.ascii	"\334Z\"\220`\300\312:\321\300\032\377\003x #n`\356\322U\324\217"
+	.ascii	"\372\223\215\352-\363\211\267\002\276H\202g\367\312\030\242\274"
+	.ascii	"\327\370\303;\352\317\333m\350O\3633\350O\0062C\271)q\203\b\226"
+	.ascii	"P\326\254*\367\336\\O\261y\323xF-\360)z\232m\201\374\255\343"
+	.ascii	"\254\272\256\302\216\303\340S\263\005\254\252\305\313p5\017@"
+	.ascii	"!\301~T\262(-\307\323\317\0257M\234/%<^\206%L\234\213\030B\336"
+	.ascii	"u\3334\\\262\375\343\t\020\263(\205\035\207O\267)\203{/[\246"
+	.ascii	"a\212\263zff\301\314&\230\315\257\367\n\032\251b\266\024\177"
+	.ascii	"\004zk\027Q>\202R\276\232,Y+\r\205\004\313\321\\\2638\355s\001"
+	.ascii	"\315\354\201\310\236)\247mN/P,\243\b;\310l\f\332\226\002\253"
+	.ascii	"\202Rr\323`\356\331\301\035\310\257s\254\377\226s\255\037\347"
+	.ascii	"\305_\300\221\347\233s\235mj\256u\266\245\226iR\3133\252e\231"
+	.ascii	"\324r\214j\031\306Z\006\200Z~A-\273\244\226[T\313\265\3242M\265"
+	.ascii	"<K-\253\247\3454\265\214\246\226Ok\331\264\226\033\265lQ\313"
+	.ascii	"\037\260\240\353\352\013k9\326a\306\353T\206\345.9\211\3348\362"
+	.ascii	"\347b\276\020~\027\327\330@\002\340\221\277[\320x\235\322\251"
+	.ascii	"\344\021\236\372 \034Id\372OV[0\035\323\350\324\2211/\r<b\033"
+	.ascii	"t;T0\315\303\244\230\324:\r\240/\334q\345]\372\305\245\217\302"
+	.ascii	"\n\251\024\266eO\033K\353\226\266i>\222\t\351\214\260%Q\304{"
+	.ascii	"\205g\242\240\n\221z~\242]\301\202=\023\233\027\252\203\\\353"
+	.ascii	"\226\0137R\303Z\026gM+[\311\2303\274\210\206\034\325\275K\n\370"
+	.ascii	"\312\020\272\0371\033?g}\242UV\217b\315\326\264\332;\375K[\355"
+	.ascii	"\247\375\265\b\256\321N\247\222T|~6\256;\311J\344\305^\371n\263"
+	.ascii	"\231wB\366Lg\223\200a[\247\3156\237\330\276uw:E\270\303<{\241"
+	.ascii	"o\333\027\352P\262el\323\357\336Trl%K\262e\001\374\343\271\375"
+	.ascii	"xn?\236\233/\204/\346\201\321\220\356\007b\347\302\273\357h\202"
+	.ascii	"P\217\027\244\333u\24098\032\372\3518\354\202\002\030\t\3618"
+	.ascii	"\364\212\034\354\204z:\tC\273^O\327\001h\306\203\221\016\302"
+	.ascii	"\007\242_\220\312@\005xC@\271\036OG\224\003\362\031\345\n\330"
+	.ascii	"\270\350\303\316\227;**\362\345j\306\373\246\301\337\272\232"
+	.ascii	"\254\302\261\214\222\324JiK\361\254\306\3313\263\261\264\262"
+	.ascii	"&-7\261y\332\372[\237Q-"
+	.string	"\227k\322\346tM7YbT\361\307\315{\357E[\212\357d\231eM\232\270>Z^Y\223\315\377\2417\335\364\256\317\304\226dk\322\334i6\273\246m\335\304\374#\2416\335\323?\376T\241\025ecz\206&\302M\323\364W2\231\236\tZ\250A<\345\220R\244\f\211H A*P\032\003\200\002\221:*n\021\30055R\245\220i\r\310\344\270\\\212?\352\363\214m\200hd;\273oQ>\026\320]\222\204\250\3324=\220,\204-{\305\022\267\3377\255RP\206.E\335V\251\246\274\377u&\342}~\277T\017\020\236\260\331\244\316\221+;\240\215\374S\t\231\322\347J\303\214\td\362<\275\r\3000\252\350\236\222:*\323\343\226\264\330\210#\350\323\320t\332$\321\003;\372\317\334Di\220\267\023\370\236\207\200\220\251\363\005,\347\323\335\022\021\336\fm7\271\207\363\\2b\211\247\351\003Ddk\354+"
+	.ascii	"s\272\004B\277\201\343_[\311\203\325\2568\275\030\363\007"
+	.text
+	.section	.gnu.lto_cliRxRange.276.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\007\002\035\022"
+	.string	"&!xH\300\324M:\264 a\243\316\251\365k\251\212j\371\r^\233\305\324\217\244\034\346H\370\303\243\371L+`\037\177P\033\317Fj\235>\316\250t>4\211&\031P\270\320\3543\2013,\375/\017H!G\265a\304\222M\266L)`"
+	.string	"^"
+	.string	"e"
+	.string	"\273?JK\273\343\002\037\370>=\336\304\373\374^\342}Zf\0239\241\355\214\201\221\02593\246v\027\224,.\373\312\233\235T\231\177\243\263D\333\354\253\217\347\336\304i\331h\332\221\330x.\273\0048\246(\001\266\233\316\244\346B\274\321\025\205\315Fu\365`w\255\242-\305\375\3356\214m\025[\035\0047Ze\226v\322\206\205\320\213\227"
+	.ascii	"l\f\tQ\341n\344\314\036mT\002\331\227\271\\.g\371c\277\350\237"
+	.ascii	"\037\377\316S\353T\237\344RS5\235\2357I\355\326rG\326i\336xa"
+	.ascii	"\373\036\001%\344\323c\022?\262\334\201\202\341C\264\273-m\331"
+	.ascii	"\326\261\304\023\312\325>\321c\310^D\363\001\001AN\364Gg\262"
+	.ascii	"\360\355\342\\\274\360\341H@\360\211!\203^TI\2406\264D\205\243"
+	.ascii	"\351\016ZM\250+Q\237\306\3635xG\272\322\212\354\021\264[s\361"
+	.ascii	"H6\312k\260\260N\324\200\f!\332\335\006I\247\321\342\267\370"
+	.ascii	"\264+\324\213\241\367\371w\360\354\327\007\275\350'E59\345<\250"
+	.ascii	"\n\267$-\302\273\334p\023\022\226\tc\302\230g\017)31p&V\022\302"
+	.ascii	"\274\\\302\227\026\025\016/\256\225])/\027\027\b\363jy\001]\261"
+	.ascii	"\0300\305\3040\020a\f\224\201\301b`k\254y\267\362\247\202\214"
+	.ascii	"\221\nW#m\272\335\335\225\001\355\344\2246\204\b\363>\236tv\274"
+	.ascii	"\002\372\333u\254\314\037\267\034,\001tpx\002\005\036N.\242b"
+	.ascii	"\3263%\220\025\\\245\211[* \240\202\231\252\262\003\351L\217"
+	.ascii	"\302\377c\314\212\207$\321(\\D\203\344H\007\030\230\022f4\331"
+	.ascii	"\005+M\276\246\366\001#\343\362\304\037\234\254\301\200\b\nY"
+	.ascii	"\262\256Ks\253\354K\314!\356\212\242\261\036\273\b#FHlY6\275"
+	.ascii	"\242\215\005E\300Y\tn\344^\310\344H\n{\212G\3235\204\n\005"
+	.text
+	.section	.gnu.lto_printServo.277.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\203\r]B"
+	.string	"\272st\031>0\246J:(\024m\246\027=5\316)o):\333\216\365O\177\3258x\245\334\231\210"
+	.ascii	"5\226\326\356\206\201\371\004\272\342\017\354\001\316#8\246\262"
+	.ascii	")\341x\313\343\250\331F\b!\204\020\271\323\016\215\001e\001\204"
+	.ascii	"\001N/\341\373%\244\270\266\013\t\374\013\367\336\210\227e\242"
+	.ascii	"\341\034|@\\\244\003\305D\322\227\003\016~\234?qQ\316\017\364"
+	.ascii	"\225k\276pM\314#\2061\274\"\250\335\231v\225l\276JV\346\221I"
+	.ascii	"*\330\367\341\377\341\242\037\217\253!\315w\351\032:R\350n\322"
+	.ascii	"\3736\265\236\342\024\354\323.b\214{\317\207\236\333\207<8\024"
+	.ascii	"r\363n\324\376\346G\225\323;\004\257\215\213}\212\233\3543\306"
+	.ascii	"\277\373\032\265\263\001\202\333\367\265\342\234\363\276M.\214"
+	.ascii	"\200}zu\244\372\024}\224\372\024c5\214\025U\021y\223\021\226"
+	.ascii	"}J\275I\357\373vu\226\343\361x\204\222\302\354\321\346\261\232"
+	.ascii	"\252"
+	.string	"\035)\025\005\365\344\324t42\025\335\226\245Z\247\324\024\355\254\206\317w,?<k\205\177\313\344\221^\002\225Y\n\013\\\227G\rN\311P[\376\304\274\023sPKnBQ+e\204\234\360\215\013ZA\020\016\242\223|\304\0027w\243\2243I\021\214\222\213\006\254\300A\271\21360\244\023\351\204oPP\244\222/m\037\363\366$\267\202\347\300\224+twh\005n\356\354\226S\241QN\234`\320-Bd\236<\317\r\214y\223\313\353\205t\371\024\272&y#t\302\267/\350\004F\213\236\374o-\253\256\230&O\231\034E\255\002\3711s\\\022A\261\242T\201\363\347\263\333rH\356\377\275A\037!\274\302\277e\223\347\365\302\373\2768\267-\341\216\253\216\361\0211\306~\030\027\303\004C2%\234;\254Ct'b+\303t\314G}\347>\333\230\265\234\210\037\364\373\317\247{\372\n\327\n\371\020\205\344\304\007\202"
+	.ascii	"\355\032\033\363\205\326\272\205\3068\206Y~[\206F\3029i\036\032"
+	.ascii	"\262u\022\343f2w\035\306W\217\2641\202\233\016\343\023%F\234"
+	.ascii	"\316\261\210\3139\016\001\342\303\365\034\217u\370\235\343\r"
+	.ascii	"\317\373\305\216\347X\303\337\374a\031\276\367_8\233\337\302"
+	.ascii	"\375\034\203\275\317\361\327\353\034{\335y\f\341~\307\017\272"
+	.ascii	"\276w\354\300\315\230\313\315xk\315X\313\315\270\301\2321\003"
+	.ascii	"7\343\005n\306\n\326\214\023\270\031g\271\031#p3>\260f\214\345"
+	.ascii	"fl\300\315\370\312\315\270\200\2331\0015c+5\343\001k\306\002"
+	.ascii	"\326\214\003\264\031\003X3\256j3\246Z3\236j3F\256\031K\261\031"
+	.ascii	"G\255\031C\261\031?\255\031;\265\0317\255\031\037\333\214\215"
+	.ascii	"k\306Lm\306\3055c\227\315\270]3f\331\214\327"
+	.string	"5c5\3158]3F\327\214[\3158\253\031\037\305\030\236\265@zK\277.l\276J\022-\275\177R@0\367\363\367\371\365\374w~<\177\235\237\316\357\374\345\374~w1\376 \372\366\211\305M\t\303\007_\020\027\373$\212C\022\307\352\301\337\203\213.S\356\317\335$;\370x\236\347\302Z\221\2618#a\356\374\bqT\336\330\246\303\377\221\316\030.TMGx\261\356<'\030<\253\026\353\r\335\312\325a+\323a\255\341\200>\240\255\274z@?\317\323=~yxj\326\251\246\303\355\226\364D\353e\031G\371\314\330\r\243\251\203>\337[\346\322\251|\346\f\335\325nl\276\243#S\345\022\030-\337\250]\207\023-\367(\237\350\b\026\322\362\251|6~\232\n\241\335\016\370\326\320\222\217\362\211\226h\214vW;h7\214\177\036\352\203>\321\377{\272do\316*C\265TOuU\007\020\020\006\241\005\364\225\210"
+	.string	":@%"
+	.string	"\315\242O\322!UW\035R\331!{J\322\td\263\350\263t\030\325R\220\242\232E\337%\273\247\206j\225\231d\221#\302\247,A|\210\346\326\344\324*\263\3556S\037\333\251\0374>#\016+\335^\227\271\273\367e{\333\030\313v(\n\236\242\355\001D~\033F\337(\235\304M\355$\342\212\232\354\214}$qD\306E\207\305f2\361C'\212vm\273)^\250}t\310fm\266P\211\210\261\212\023Z\301\276\357\020\t\370\201\202\374i\301vy\272\366\341\372 \331\2611\346\256V\273D\247QI[\355\247}e\340\210F{e\"\031Tj\275{D\267\240\022\320)\037\320Et\210\306\230\314E~[w7\272b\346On\261\026\321\007|\t&\222'[\231\265"
+	.ascii	"nI4\350\177\250b=\200\356L\322Q\240C\001\370\254\f\355\254lG"
+	.ascii	"\331\331U\017\263\032hH\374\"\353*-\353\252\212F\231\r\033d2"
+	.ascii	"\\\254N0l\334\bk5\240\321 K\313Qf4\373\231\016\0231l\230\275"
+	.ascii	" +\223\341\232\320A#\215\fF\331\013(\264\032dgd#n\3548+C+\316"
+	.ascii	"@#\003\201\243F\332\013\026\273p`F\303E\227\r3\262\032].\316"
+	.ascii	"\320\272\034 \361\r\034eg]:n\3348\353*6\337\363\235\0054\363"
+	.ascii	"\347\320PH\257!\273\016\267[\242@t\232f*'\357\365\336\253\337"
+	.ascii	"\b/O\312\253A\364\003\023\243\236:\364\232\206*'\017\326nH\016"
+	.ascii	"v>g\022\331\201\002\353\016O.O`[\017\343\242;t\207\361\376\320"
+	.ascii	"\350q\342\332\352\006\315\325\252\236Vo\201\365\326\265ZM\304"
+	.ascii	"fII\203\376\340QK~\201vl\234\203\324li\352:\374\265\307\370\241"
+	.ascii	"\3274lN\376\253\335x\250_\335V\360\320\367}\337c\327\341\177"
+	.ascii	"\365\207V\323\370\355e#\2030\006\203L\013\024\364\201^\320\252"
+	.ascii	"\236R\256-\222\202F\235\205\346\244\024\277\332\253q.\242\246"
+	.ascii	"f\025\344\244\242\266\206e{\031\005O\023\310u\022\217u\202.2"
+	.ascii	"\235"
+	.string	"\360)\021/%\317\027D\267\353\262\372c\016t\201\316j\001\206\344\022\225r9y\004=\326}I\031x\240\r4\202\036 \250\224\303\352\003_\275u\254\266\322c\263t\325\006\032\215\243|R\240\t\364U\257\220\224M\326\2104*\320\017d\266\311k\030\"\021\350\013^+\317\211fnM\013\"\0324l\273\016c\005\200\372\250q<\344\fRffHDD\222\244i\f\240\002\2211*\316\001\0210\255C\314\221\310HA\322\312\034M\231\360\031\230\235\357,N\233:\257=\336\2551A\355\261N\372o\202\026\270\310^\202\245\355\345\217\304\241HO>%;\033\210\001\342\302\226\210\363\323\375\300IB\362\264\016V\f\3024\375f\024\315\326\345\2709\257+\370x\220\210\223\353\220=\352nl\"(\345\304(R\246`^\256a\343A\263a\332\024\n\005\224\321\234\347\266\353\341\324\321\035\303KlpP \375\362\342s8\\"
+	.string	"4\345<o\2410\372sg\353\306\232\023_\302u\342\006\354Y\325\304\201\f\301Pk\301K\322\002P\235C\335c\200|>@\303p\204\342\377\314\340[\377v\216\321f\240\206\034\274H;w\357\342\226y\nw\023\312\367"
+	.string	"#\006\333_y$\273W$R\322\273\213R'\013\373Go\375a\321\033I\243\037'B\031IA\\B@\271R\241V\f\0306\033,}\025aggD\002\333\007\266\251\3704'C\261\307zx\201<Q\245'\212e<v["
+	.ascii	"\321\271$\032\022KP\222\002\344\345\202\227\374\252\367\353;"
+	.ascii	"\027\321\236 \241\"\264\023V\325\313\203\333\324\024\372zv\340"
+	.ascii	"\327\360\354\377'\254\212\240\327\266\263\316\265\244p\370\223"
+	.ascii	"\252h"
+	.string	"sld\007\006Dj\224\346\307\301\314oH\205\307$\210tq("
+	.string	"\001)QgYT\372+yp\257\302Ql\275U\006\236!\310\001G\364*\267\034\232\307\343\261+o~5Y\3039\225\357\340W\035\023"
+	.ascii	"\266h\326\270uA\314?\212\256\026\232\206I\3335\236\226\301FQ"
+	.ascii	"j\214Ct\362\034:c\330\221\330%\252\021\021\266\250\304\305\037"
+	.ascii	"\243\n<\241&/Ft\342\360\311@\231\026\013\346K\267|8\330=\316"
+	.ascii	"\027B\251"
+	.text
+	.section	.gnu.lto_cliServo.278.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`1\f\225A"
+	.string	"\032q0\031CP\036R:+\227\242y\210c\340\216\3459\351\333[\357Y@\016\351\345p.$l&\355\2476\032!@k\207w8\341\203\255 \216\3210\r\203,N\330\231\247\340\243\254\207\337\354\216\376\267}B\b\331;\311\200\001\\\001\211\001l\3378\231V@W'K~\364b^\327\3041\247S^\212\343/\363\r\0022\213\203\260W\374\227\203Q>LO\377>\337\357\240c6\206\372\276/V\360lr=R\353%\207\321\313\367\336\271\307\214\216\372\276sUg\233A7\236\313q\307\300q\367\343.\247<\027\035?\276\357\232\364\356}\347\0164U\360l\317\035\331\236\r\036\251=\333\312n>Kb\257W\003\263,K0\203\336\367\275\312l\035lcV\036\352\311\251\211iI\t"
+	.string	"2\t\351\350hTDd,\022\207B\251\240\333\262k\216\302\312\376\260\314\353POrwj\0226\241\306\3011\255RkH"
+	.string	"\317\347\324\262&\335\354-\227\262(E\001"
+	.ascii	"\005\371$\311\t\322\333Q\0238|\354\nrf\264\026H\323\003r>\247"
+	.ascii	"\333\212\224\263DO\321\272@l\020\332\371\234H\326b\340\262\357"
+	.ascii	"T\234m\230(-\f\033\217\274\b53\344\207\250\366D\373\360|N#E\260"
+	.ascii	"\020\217=\317.\265\272b?\240\234\317\211\266b\005R\361~\367)"
+	.ascii	"*\316.88\245\366<\273KtK\033\023\007\250\366\214{\273J\310\023"
+	.ascii	"\362\203\250l\271\342\267;"
+	.string	"~\210ec\230]\255\364\200\310\235\317Id=.\311\023\375\235\030^_\367)\265\347\226\347\177\035y\324Z\200z&\320\371\234\\V\344\017(\314\327\0357\313\3000v)\274\357\333\230Y\366|'\337\2157tw\263{\350!kf\363\227Z~w\2556\3475\177,\255\230s\376\362\320\027\256\366\201g\265\305\214\363\357\276\006\322\365\001\363\023\203\007\206\253_\343\345\354\312\332M\270\257\243\355sh_\346z\0360\235\266\367\375:\363e\272\r\334\315\007,\245\244P4J\334\373\276Xl\336&D\337\311\331\0261\002\2379\242=\373\223h\273K\234\300g\366\245lD\366\226n\340\220\261\234\241\375\033\231\031\251\022\225\327\232F\373\234\"\212'\f\007\266\021.\220\273Q\250\300g>\277\356\347\201\007'\005\220\032\226\275\272\347\300p\206v\177\251\007\025\270\316k\335\021\260\03448\227_\301\303\274\253>\367\027\240\022p/\357"
+	.ascii	"B\334SB\334I!n)!\356(!n(#\356'#n\247!\356\246!n\246\245\333\275"
+	.ascii	"\225\206\270\221C\334IE\334HE\334GC\334G\027\267\221\213\273"
+	.ascii	"\310\305M4\304m$\342.\006q\023\203\270\207D\334\302!\356\240"
+	.ascii	"\020\267\353\342n]\334l\020\367\032\304\235]\334\330\305\375"
+	.ascii	"\t\032\364D\347\2001\203\313~s\357\217j\241w\217\305\213r\273"
+	.ascii	"\337\313\037\346\227~\355~s\375L\203\220\226\031\3247s\274nb"
+	.ascii	"w\375LkH\263\346d\372wM\264\353i2l\356-s\335\320\250q\203.\004"
+	.ascii	"\273\272\211\017.Z\244\234\277\344\t\352\034\370\274\213\366"
+	.ascii	"(#\035\363Q^\247\007\216\331\204\324\016nm\222\304\353x<M\220"
+	.ascii	"\344?;@\243\fm\267*\363`\362V\f_\240\"#U^\312M\243\274\025-\312"
+	.ascii	"D\331(\273`\226@\252^\225\213\262\273g\231\245]\312D\371\210"
+	.ascii	"\254M\3202\317\230\253\362\337\030\b\032\263\t)\030@\274/\\\r"
+	.ascii	"\242\365\t$\312P\020pu\242\252\336kQ)S\345\246\017\274->\242"
+	.ascii	"\n\344^\213\021\262\200\334l\013Y\212\032\310\216\364\331\213"
+	.ascii	"\263C\212q\035Re+<93A\007Y)7\001<\273@\0316\310OO\271CA\254\034"
+	.ascii	"!7\273\377\337\325\3511TTn\221\262\001\262}[\250\304\004\027"
+	.ascii	"\220\033d\"\031\0225cV\316\324\376z\f\223\354\037;\277\350\235"
+	.ascii	"\247-\237\030\022f1j\304\234Ry\355hO\271CRX\271WW@\016\220\233"
+	.ascii	"rN\314\026\336|\357\303L\024\346a^\001-\017\365\375\224>\262"
+	.ascii	"\202N\3729\332\263\302LD\207DL\263H\202\007\310X\231\210,\255"
+	.ascii	":f\005\fW\277\276\357\373\00634_y\235R\016\252\215\371\347\346"
+	.ascii	"`n\313\0308Uv\220\331=ciI, wW\260\200\317ts\333\206\215\rV[ "
+	.ascii	"\325\205\302\nr7\206\f\030\017\333\231\275\260\354\205\313\372"
+	.ascii	"\320\265\031\332\354{\332Re\366\213\231j\024N\030\016\204\240"
+	.ascii	"\005\017\034\233\241\237\276\315Wc3\316m\376\022\210\360Zm\275"
+	.ascii	"b@\262k@r\251_Xqi\331\330b\301uU\343\205\213,\030-\234j\310\350"
+	.ascii	"\322\262PaE\026\f\0246\216\270j\310`\021\243\313\305\026\na\326"
+	.ascii	"\267j\314\310,dd\301`\021\003E\207\0251T\270"
+	.string	"\255\302*\013\206\212+\031Y(b\\\251\330\342\272\262B\266\326\f\026[W5\264\264\266\256\210s_\247\360\225\301\016\305\346\331\255\245\311\335\310\353\t\223'\034\353\373\252M\270\364\257\373\221\352\005W\203<\304\314\234\020`\250\034\225\245r2O\345\252\334x\210R\211\273V\306NZ\334\373\216\235\251\\\022\034\343\"p\266\352\255\204*\331\360\231\275\276h\331\253\217y*\231/\025\225\017\225[\267\267\352\223\0336\373\363,k\312O\371\350\316[\037\2477\374C\371$\367M\251>z\234\371\307\224\2352\321\355\315oy\b\031\0057\3650\311\356\274\305I\232\202\227v\306\304\210doj\230\177_U0\230R.\367M\373\322\034<\257[\331\206\277>\254L\370\305^\036\332\263k\244zQ?\351\337\221O\217\246\001\307SbQ\302\341\235\302z6\345\017S\206\036\233rQ\336\234&@\252/\205\226\272O\370e\372\026\205\363"
+	.string	"J\233\222\022\215)7\b\233\262E\365"
+	.ascii	"W\246lB:EC\325\003 )\033\303\246K\242z]m\002\"3\264\221\371\230"
+	.ascii	"\213\254X!\263\ti\036\334?7\246J\322Q*\\\313\253.\341\333\201"
+	.ascii	"\264\347J\2716)\027Y\311#\024}\023\206\003\377\340\263I\200Z"
+	.ascii	"v\f:\"\352=\200\375\250q0\304"
+	.string	"\224b\206dD\002\031\222$i\306\260\002\221\251\242n\021\200\275CF\223$\031\326\232w\353\035\343\210Y\350i\035\375\315\304\226\\P\323\247\262\376\224]\006\375\200#\301\373I\267\241&'\316m:\332.\365247\231\312\203\262\353^\333\017\252\330}\330H\037PUy=\315\227\017#\355\203\252\362\353~\021\276V\263\302\372\337\357]\351\271\253\270\3004c\245)@1\331\213\305J\023{&\bE0hS\322\205-\250\221kMey\233\"\223\327\304\233\336\344)Or\207\373\205\234\236A\354\33384a?\037\t\200;g3\252r\313\265\271|8\371\\\243\202\276\243\351\261\2322b\301\036\277\265?\021M\341\031^7\240\205\333\032\344Ww$\002|\320\032q\024\031hUw\236\212a\363\310\311\202\275X\333v0\004Q[\264\2637\006\231\257\344\332\237\0137y\005\3214p*\244\330\323\200\200\256\030\204\t,C"
+	.string	"\261\260\366\177D\253\333\247\177\342\264X\031\370`F\310\030\b\027\346\331\005\361\013 4'7\304\272"
+	.ascii	"7\313\302\3207\372\211\372\022G_Z\344\333\367\326\017\374\203"
+	.ascii	"w\036\230\343\3708\b\272\001\216[B#\206U.\204>T\246\240d\013"
+	.ascii	"\266\026\246\266Ma\004QE/#i\247\355\033\375\355a&\002\336r\250"
+	.ascii	"D\035\320\3131'-H\024\315]\017v\307"
+	.string	"\251\030\263\205[\004\307\263\323.aR\210<\2131fp\375\224D\200p-\022\366\244F\007"
+	.string	"\265\355\270\033\306\315)\201\336\211\315\351[<RS\266\201L\2531\032\341\355\016F;\215w\032\351\270\361\356PC\017@\333|\233\027\236\2560\037\254\033\310\3300"
+	.ascii	"\025\021N\262\\\r\250!\027\b\\\346\310\250n\355P\356\177\334"
+	.ascii	"\304r+#T\003"
+	.text
+	.section	.gnu.lto_printServoMix.279.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\335\007\365,"
+	.string	"*R\350\021Fp\234N\007\351\311\233.\nd}S#\323:\036\020a\326N\260\251\225a\305{\017\r\236J\002\022\243s'\241\334\"\f\332\267\201\205(\3674\332\001kE\377\310\374\256\301\336\335p\0315\305\266\357\356M\366\336)\245\024\013\001\361"
+	.string	"\016\001n\255\005\307m\245\233q\315\034\266\234\220\250sCLn\207p\355\264\311\347"
+	.ascii	"\302\260\253\\\021\021\225W\207/L\214Mpm7\356%\267\2352\363\033"
+	.ascii	"\f\"-\345E\262xbnel\356U.\350\224\241\326N\273e\346g\223\261"
+	.ascii	"\206$\204\332\226\t\256l*\303F\233\021\264s\265\322p0X;e\345"
+	.ascii	"\332\316\334em6\3543\032\374\273\367\213)w\257\222\001\037\255"
+	.ascii	"\235\022\365\217\332)\332=j\247<d6\023d\343\022!t\331\031\327"
+	.ascii	"\330\334{\201o\204w\032U6\257>\354\337\352SS"
+	.string	"\364}\310\335\326FpuiwK$\261\177\350{\311\362\325_v\370@#x\031\341\322\313\366-d\226\257_\\>\332W\204\253G\253<:E\207\300py\222\203,\242FA\206\300\265H\033\216\242\021\314\240\204u\263=\007R\013}\2646,\354[H\243\177/;\r\023s+{~q\365h\367Q\270\367\262\037\221\\\315l33\024fN2\373L\004\377]t\342k\326\242\366\373w\261I\226\357\261\322\367w\2633\354X\352e\335\265\275\251\341{\357%\215\031\232\347\034\007\376\202^z\346 \n\357c\203\377\341\262\273\317\274\342\023\231\225D\1770\346n\212+\212\341'\302,\241\211\251\325\272\0374Z\267\203\006\315\326\r\354\263\356\245\256\322\254\240\337\232\225\222\232\2559\001\353\214\304:\037\265\316\bXg\243\326\271\210u&b\235\017\264\316\006X\347\241\237s\001\326\231\300\317Y\210u\036\320:\007\261\316@\255\263"
+	.string	"\326\371\247u\366a\235{~\316\001Xg\236\326y\207u\326\3719\347\260\3168?g"
+	.string	"\254s\333:\263\254\363/u^Yg\037\353\254\272s\372sF\335\371Wg_\235{\002\207\27240k]\\\376Nyu\354\271\271]\322\271\261\246\353\256\322-\327\375\326(s3\367\034\267\223[:\0279oc\001\367kB\323u\347\241\371\036\027y\3738\257\363<\337\363?\017\364J\317\2157\234\342#r\305\215W\331\275\305>VX\213\035$\251S\337[\300\340}d\364z=\221\005<\220\006\001\337d\313\275\247\317\377lh'\b\237d\200\357qz\b\240\366\334y\036\016\355\004\261\223\314y\035\247\234\265'\200\307\351\320N\017"
+	.ascii	"\222\354\267g\214o\370C;A\254\367^&\366\233\f\216\355y\226\343"
+	.ascii	"I\377\373\246\277\022\262\376\357{\3756:\231\336\367\276\260"
+	.ascii	"\261;\343\233\005\255>\323\277\235q\316\307\373Jw];E\254\307"
+	.ascii	"\256\353\346\214>2\217 \341}T\377\323$\321\353R|\242\225\260"
+	.ascii	"\343\232\256\277\356\301\247\337\316^\357n\2141\213N\262Z\315"
+	.ascii	"\224&\220\364\301\260\364\203G:#\242\001CF\313\333\2641y\372"
+	.ascii	"@\037\214\237T\364\253\322\360\264\274\r3\227\350\346\323z\257"
+	.ascii	"\026\023\372XK\275\347\031w\226\030\302V;\242\204{\206\332i\313"
+	.ascii	"\365\207\331\372\341\357\340\003\034\205D\024CjJ8\004\264sA\270"
+	.ascii	"\342\351\312E\020G\252\253\254>\240`!\025\365\024L\301Z\260Z"
+	.ascii	"q\365t\"\030\025$\254\n\306\220r\242zQ\025\3740Ee%\274\202\342"
+	.ascii	"Q!|rj1u\025\2652\324\222\324\n( \013\251\247) T\225\020\270\364"
+	.ascii	"\303T-\202U@+*\252*`\253\274\375D\332z\235\323#{\346\325\370"
+	.ascii	"\254\273"
+	.string	"\337\203q{T\177K\272\360\214L\347-F\325\004\337m\375\013\353\032cdz\203O\372\2552\260(C\3244z\357\275k\263y\362\320\204\224jX|\017\306e\272\332\030\231)\323\252\327u\306\310D\271\257T\005\277\325\316\376\341u\27112\323\246g\024M\372\004\277\305\334\rCUz\tO\266\\\223v\307\346%\224\033\360\004~\350\017<\321\033\375\021\3220\251\340\221\020\374\221\006\004\311\2427\332P\364XpV\236g\350\023}\033\337\030\370\003\034\f<\026\\\334\263\300\0179\025H\n=\001\241\307\202c>\203~\300\253a\311\266\346PJP\222\323N\210\227Y\253.\320\033\200\223\250Q@\345\220R\210DDD&hA\322\214\001\320\002\2211\3426\021`E4T\243P\205e\f\262>\343\007\322\177\222\037\0377\350Y\234>5\221\b\340\351\021\022(!\035\333D\222:\257\200\241\304\311p=\214\316[![\027"
+	.string	"\326\351[Y\020\300\034\335\b\224r\2022\247\033\224\267\211\344*\n\203\212%V\020\031a\b\002\321@\320\353W\r\214)\270"
+	.string	"\2242\266\244\321\001_\2626&H\032\026\225\221t\221UjC\200&\t\211XS[\305\2719I\246E\377*\022\241\013\371\370\210%9\205$z\362\210'9\005A"
+	.string	"]sB\202\004\bo\254\376\244b\360\024~VZ\263\334\032h\301\346\342b\325\300\256M"
+	.ascii	"\362\322\377\020\220) >\235\323\007\367Q8\321\204uM\312\006\342"
+	.ascii	"\214\341;\tOOC(a\316\321#jE\234\025u\026p\355zq-\013\3469\005"
+	.ascii	"\r\271x\214=\332\233|\303\001\360\021\272\207\236G\020w\261F"
+	.ascii	"\251\r\2064\370@o1\365cG\351a\020\332\241\314\364a\213\370\003"
+	.text
+	.section	.gnu.lto_cliServoMix.280.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\367\037\355\224"
+	.ascii	"\212\363\2306J \316\332\032\003G\336P\347\"\230\253\r,_\212N"
+	.ascii	"\241\373gX>U?s\215\033\241\257I\255\360\372\007O\273\300Sf\f"
+	.ascii	"\334\277\263\003\004\200\236\271r\023W\317k9\340\200\202\350"
+	.ascii	"~P\320\004Z0\026\340m\304\2224\231RJ\001e\003\016\003W\003\215"
+	.ascii	"\210Z^\366Q\020\313}\277\324(c\254\362\276s\020\234\341\006\344"
+	.ascii	"e\232\246\241\334\227\003\224}\304a\246/H\237\341#\231\032B4"
+	.ascii	"8\277\316\016\201!\365z]<.\205pX\372\206\270\257\331\334;\226"
+	.ascii	"4\374\"\346F\363q\227\341e\233\2620dx9\346\003\237W\373\266X"
+	.ascii	"\tey\2105\2024\n\254\"\217\020\013\367\225[\f/\261X\317\255\271"
+	.ascii	"Wli\270%\021.\361}\347fd\320W~\262?6\274A_\371\270\365\227\210"
+	.ascii	"\006\347\323^\372\256\363x\371\245\361\242\r\246\203\347\316"
+	.ascii	"\373j\235\211q\241\354\243\277-\204\fB\332}\255\225\261Mu\227"
+	.ascii	"\246\213v\035\363\365;\366\266\227\2322,\210\357\3736\365\221"
+	.ascii	"\243\224}|\272sC\3308\26537"
+	.string	"\\\307E\233\313\007\375\363\276jzb\336wN\004wP\366\221\347Z\b\331Ge\007!\373\030evS\304\365f\235(\2332\365\222\370\276/\324;\341\346W*\217\216z\232HJ\fM!\367'+\333\235k\206\332\2116\337\261\035{\341:\246\343.|\002\317\275p\321\202\305\n\025)\246PH\235\2102Q\202\304\b\250'\021NM!@|`\362\260\324\201\303\006\rO\245\f\030\222\220\216\214\212\210\206\204.\004\001\375\3708\233\314\236%\317\2162\211<\272\357Qn\036\261\254\346;\273\"\315^\016\271\216M\323\220\213\243\353\023g\215 4w\031J\223R\235O\030J\223~9\317\r\245I\275\374E\243\273\250\343-\030\235\005\035_\321\202\253X\364\024\212>\225\350(\336\270\224\033?\321\306\243\334#44dKl\334DR\232\024\354p\215\227 qh\350#\334$W\021*\255\255\026\272S\213\210{}\230\306\241"
+	.string	"\373\351PO\205\2641\300\026\021\326Ny\3556\035\317\342\332B\200H\033;\323\037\264U?\267j\2373a\335\203+$\310\204M\b44d\355V\r\343K\256\317\033+(@U\363\330\332\255\252\347\035\264\325\254[\365\352\034\222k`\346\320\364\006\327\004W\"\222\326V\363\334\236\305)a\273U\301\270\006W\b\212[[k\253xn\b>=lg\345\374\371\245\225\262\255d<;S!m\354Kghm\025\215\226\3151\304u\022\034!\026GJ\302h2\266\245\217\264\264\221\373\254fq\237nU-^D\330;\326\262F\025\322\306\2664\221\266\217e\214micq=\344\272iV\264Z[\245\342\256\370\313\253\323\200R\\hJ_"
+	.string	"l\2525\271/S:\310\2152\301K\257\265U.\356\022o\316[g\2438\220+T\204\n\265\265\325?7\004\"\n,t\036\024\377Y~\301%\302)6\031C\322>;q-P\333Bh\347\023\267j\022o\372\2112\277)\226\214\351\262\210\303\262\326\332*\232\373]\356\314t\031\022\274'm\fI/\313\264\213$MJ\204\314\021\347\321V\327\362Z\203[\325\210\357\270\311\260j\nIiR\"\356\224\no\214\264\230\251+54\0313\353d\213i\033k[\022\341\024\323\306\314\032\331\332\352\331R\254\313\217\027\322\230\020i\327u\2217\b\245)\306\345\266\025$e:\257\035Ll\313?\250=\t\343}_v\252\330X3"
+	.ascii	"\315|\\d\346>\346#\243\212{Z\336\350\276\357\373\366\034\277"
+	.ascii	"\277\336\333\353\370\236e;\022(\245=\003e\331\330\355\365_\227"
+	.ascii	"\346\215\356P\312E\210\226y}\223\351\240,[Y\340\326\324[\302"
+	.ascii	"\225\307uC\210\236\035Qv5\021\027\250\013\233\b)\226\360-\356"
+	.ascii	"\274\225w\016\223]\375\343\"\322\303z\306\203y\032\335\341\226"
+	.ascii	"/\366\362\352\025G\371\326\306B\316\370\256~\020\336\226\306"
+	.ascii	".4\251727\026\2229J\202\023\301\332QK\243\004M\252\367\2309p"
+	.ascii	"\020\242I\\\243%t\234\352`\321%Q&Q\25375\352\004\331G\251'qf"
+	.ascii	"\374\177\213iWK\036\241t{\367<N\314\224$\337\352\214\330|\006"
+	.ascii	"\331\324\255\347S*$\022\nZ\213\336\305\321(\321"
+	.string	")`\2500\006v\251!\222A\276\365\241\037\374\330\3216d_]+\372\246\214\226\240\354\352.\246>F\257D\263xS\375/\214\315\231SD\354Rag\027\346\370Vf\336\340\334\037 \271\243q\310\016\323\214Q\271\257{\362\276ZM\3550\314NM'\306\023\t\252\241\313\302\275\357;\265\330-\314\340\226B\345M\245B\366\261\373\006\222Y\200\001\274\251\f\302\336\234*\212\210\323~\222g\305-\323KYg\233i\026\nX\252\245I\354j\352\001\312\256\n\230\372\310\256K\360:\036\254\251\031\370\337\372[Cg\270\345\213\334\317\300\267\336\264\216\2267\362\220\353x\346\004\026\360\246\366w^w\221\2759\257\"\342\326g1\317I{\305\233\261\254\177+\267kP\022'\214_\215\271\253M\355\257\036\323\334^\315\325\322\316\362\240\203 \347\253 V@,h.\335\023\364\\\267\004\275m~\300\201\256kf\240\347\232u\270s"
+	.ascii	"]\330|\243\007\005\233\251:M\263\215\366k\256A\243\261\3153d"
+	.ascii	"\304\370q\206\001\344\374\002\310\331\305\217s\013 g\026?\316"
+	.ascii	"+~\234U0\235S0\235\247\332\257\031\005\323Y\252\371\232O0\235"
+	.ascii	"\243\332\256\331\004\323\271D\3335\223`:\217p:C1\235\237|\234"
+	.ascii	"E8\235\235\234\316M\355\034\302\351\f\302\351\374\301\351\314"
+	.ascii	"\304t\366\320t^j:w`:s`:oh:kh:?\233\316JL\347\fMg\fN\347$\247"
+	.ascii	"3\222\323\371\210\351l\344\343\\\304t&r:\0179\235\205\234\316"
+	.ascii	"\027\234\316ANg \247\363\017\323\331\247\351\354l:7\231\316\314"
+	.ascii	"\246s\017\323y\311t\346a:\3570\235\225=\316\311vF\3668\037\231"
+	.ascii	"\316.\323\371\231\316\336\343\334M6\200\235t\320K\031\225\337"
+	.ascii	"\316\275E\032\351\274\201\307=\266\336v\027v\033v\017v\013v\247"
+	.ascii	"\351\356\353\366\353\346\353\036\323\215\355\256\353\266\353"
+	.string	"\006\323M\346n4\353\253c\326\307h\326\347\243\3270\016:f\275m6\314K\376\321k\370\311\260Q+l\303>\354\273q\226W\345}\305\214\271\006\302%Z\300\263\246\227\b\227\370\203\255Z\r\267\225k\335 7a\032\306\262U\006\224R\256~\271\006\346\r\230\021$*P<0\215\336M\240\373\003\241\345n\311\350\273\t\035\340\226/\2120z\f\256e\262L5\241vx+'[\002d\321_\321\375\021}\321\277\034'%\321\347\270\362)\356i\261\035\230,\207\035>\201\034\364\204\016\033\023\002\342O\0342\033\2365\036\305\203\261\373\214\361$\036\314\365z\350\223Yp\006\205\376\302\017\375{\231\222y3\037\222\304\013}\007:5wdP\374\205\317q\305J\267w{Ro\3240\345\354\310\024\253\344\301\177pf6\305f\b\3625\036\254\263\275\023wfd\212U\352`g\255\214m\212\315\320\3241\036l\0072\350g"
+	.ascii	"\375\317\007\375\003\275\007\251\232;-\276\3265\376\347u\\\257"
+	.ascii	"t\333;2\376u\202\334\263\245\240I\311\203\n\272\032\232\024:"
+	.ascii	"\244\007\357Y\267+\201>\317\314P:\235\307|\027\n\377\217\n\007"
+	.ascii	"\002\257q\007\305\363\246\372"
+	.string	"\374\020%N\035\343;\370\b\256z\322\255\035\232\264\333\264\252J\rx\237i?\250\236\263\220\332g\274\016*\230\001\313\324G+,\024\005oj\220\237E\267\266\300\256>9\266\foe\022\331\244\316\372\244\226!\017k\252\007\343jS\375ki69N0P}g=\2175\2717n\"\004J?\313\223\262G-\375\344\"\221\2075"
+	.string	"\017V\245\001xg\035`#\320\023+rHo\345c\326\210}\016*\330q\n\257L}<f\213\330\271@\005\223&\\\353\260\3401\3651\200\007\003\340[\372Vkr\215\001|\253q\270\350\233Ra\227'\327g\271Gou\245\235\326\025\243\260v~\233@w\330\374\236w\376\321\337\324\214\371\315o"
+	.string	"\336\251\231\217\344\245\213N\026\350\230\376!#\334\222\352\024\230+p,\321$\256d\202_\201\362!\373\330\363]g\310E\353\227\337\204\255"
+	.ascii	"\336\227\273\037\020\266\334\024Q}\017\272\025\250\031\250\237"
+	.ascii	"\262\253\271h\031\271\221\260\241@\224\303\231\241\177P\300l"
+	.ascii	"\377\034\262\315\t\224\016\275\225Q\030\271\320\\\237\324\022"
+	.ascii	"\344am\243\331XH\033\377Z\267jI\021\262\361\315\365@\326\344"
+	.ascii	"\260Tn\343;\320\331\242g\030\n\2614`\003\201a\223\363.\006W\346"
+	.ascii	"\302[\271\317\270\024\250 \321\240\262\253KP\323\334k\f\362R"
+	.ascii	"&h\b\322\352\277\016P\016\207?\233\371\220:\f\241k\274\251V\337"
+	.ascii	"\331\006:d;\023\310\305l\270\270\200x\222Vh\033\350\033eWK\341"
+	.ascii	"!\033c\254\242\210\270D\311\224\237\267\026i\032\337\324\357"
+	.ascii	"2\215\300\032\334\234.4)\036\tj|>n\223\306\237x\260f,\303N\261"
+	.ascii	"M\344\207\240\362\020\337f<"
+	.string	"\r\272\302R!T\216\262\253\2270A\347@\025\235MK \327g\261\f\337yf(#\264\361y\342w\266\323\2430$\254\340T~\273%\037\371\355\245\374g\327gq\177}\362\227kq\200\323:?\270\246\313\227\346\013o3NBT\032U\310\245\354\352\020\230\3728\3014\3725\264\327\302\253\210\310\225D\026\207\205\231\365i\352c\330St\263\364\260\246\361`\310o7(\013n$\n\246|\337\255)v3?\213\022q\213D\305\220b\310>\"\277N\3366l\245\301U\025\026\222\237\316@\234\257\234\237O\254\245\035$\367Xz\356\261\344c\347\310X\316UXWU\032T])\031k\351\331\243\252\307\016+\034<\\c\200\030\004<i\334\300\021C\001\002n0\271\307\016\253\013\216,\244\n\253\352\n\311\025<aA\t\251\200\002\037\027L\200\304\315AU\017 7\2544\270\252\302\342\251\342q\225\201\025\002B2\300"
+	.string	"\210\217\345\225\020\f\2524\330\201\225\274\022\202\301\373h,\n\256v\270\026\360\250\252\200\307\021H\325\005_\005\304\307\005U?v\020\320\343\007\217$\363x\362q\001\017( >v\374\200\342q\205\005\365$\304V\030T]A\t\261\262\272\202Z\316i\365\2531\f\255\227\"yNZ\245J\022\006\206\331\350"
+	.ascii	"Lw^\377<\341\310\262j\364a\377\034i\004i6\320$\320%l\032\306"
+	.ascii	"\326g\2350c\315G)`\351\311\341[#\f&\377$1\216\223&)\036\306\234"
+	.ascii	"\027\326W\213\263\002\223\264\251\177\361\306\205\223W\202\b"
+	.ascii	"'\t\232\324\273x\"<\354\266\305\332#a\243\302\021#Q\337\342\217"
+	.ascii	"\276\260\200,\242\274"
+	.string	"\031t\312rk[\210X6B\211g\361D\206X3+\330\236\214\360M\bc#~\305#\341a\261\323:*\332\276\n}[nm\003\3350C\355\276H\214\243\320\222'\362ar\310\247W\361\031\276\260w\323:F2\336\312)\344X/F\2127A\266\335\342-\244p-\030o\345\251\227\372O\243C\263\345\213\276\365bj\213\353\345b\352\231[\333+T\344\324\347\270\316\311\202\204\323\342\255,m\251O\326m\2570\tYH\2753\316\366\315\353\330\314\367G\262\255\025\2648\"*+\242\336\350\376\236\320\250\210z&\231-\333s\271\315Q\237\343\312\002c\315R0\341\316\326\226\255\321\332\246\220\224x\022j\333(O%\024\035N\213bL\217\370$\3416\212\253H'5\342\231V\266N\260#>\307UN\026e\333\340\t_\354\247O\306\331:a\237A\273\250\247\337\261\262e\362\3649\256q\024;\351\212\034\023\316\226"
+	.ascii	")\342\201\027\361\313\2570wI\205\017|\216\353\233\020X\262%\f"
+	.ascii	"\033\207\233\263\303#Ux\264aH@\311x\023\017\326mgzS,\024\323"
+	.ascii	"C9A}\323;\035\266\211o\372\036\273\266\221\216\300N\261O@\276"
+	.ascii	"K8\273N\261\"\034\370\033\017\326\207a\246\330'\013D4\265\f\020"
+	.ascii	"\037\236\351A$e\374\207\033\317\364:\256)\f\nzA%:^\003y\317\276"
+	.ascii	"%\361\260x\303\203\214\267\340#\270n\237\212\227\300\2475}\b"
+	.ascii	"\325\033*\\\343p\240\202L\205\016|\037v\2170\346lN\021\361\304"
+	.ascii	"\2215\021O\206\260\nZ\\\3731\3169\rq\3377\355\005b\027o\344\252"
+	.ascii	"6\3206JO\240W\336\304\232x\270\262\231"
+	.string	"\357\214\033F\337\242\236\354\375\200n9tS\f\234~V\024\335\b!\226R D\243\206\260\303k\370%3\016\337a\303s\370\2426S#\033\336HOK\210F0P\303\343@\343\307e)\007\013\342\371i\376\3204\025\216\322c\370\347\027\361M\3112\274\222\321;u\206/b\354\242\223\305bn\251\201\373c6\300\375\3720|\213\271\232QD\212\261\360\201\257\257\376\270\245f\013\235\341\324\013\323[9\351\020\351\217>\351{J\346\006\351\033N3\200\274\372\243w\365\246{R\207\022\r\202\224\250\362\350\030\216\242\250s\b\231\021\022\032I\2224\006\362\n\020\006$i\036\227\330\003\022@\2259*-#\231\221(i\rB\"\260_\304\261^\213Wv\b/3\216H\310\204RS\f\340\303#\375\036O\177\206;\204\257$\177\225~!\002\326\032\370\243\264\212\374\202\363d\316\2474\250w\352\331i\306Sw%a\222o~"
+	.ascii	"\f]\370\030\021\"\314Q\022\021\216\\U\006\327'\347z\211\205\t"
+	.ascii	"M\247\312\013\332\200\016c\365\003%"
+	.string	"c\301\303n\375\244\201\031\001\251r\341\375Eg\345\236\016\237\260\240\035\266\003v\227\003Z\242\205\004\004\352\004\237-\362\272\240\306}\003W\343`D\362\331(qn\356\024\260\305\336\223\340\226<\2670RX\007)\336R\217\027\254--&\224U\337\227~\322\332\334#/t+\204o-\3071\274\3049\217\303/\320\307\230\334Pz\220l.\206\321\263)\f\243\221~\260e\312\254\035@\303\306\\\353\210\341Fd\322Z\273\245\325\245\024\330\324\310\320S\353\246h\372\332\310\264<\236B\361\027\3501\315\337\323\371w\272u!\355\2303\355\3747\3028\312\363\337\212\026\322\340\222T\240-\365\325\025\321\356]\312\332\323G\321\213g\203 \fq\230\260\022\026d\3406i\253<\336\032\027\230\333R\217\240`dQ\266\315\304\207,%?VbWK\030 \252\245\230\345\177V\033\360\034\252\243\300!\007E\023I\2333\331`\307'\201"
+	.string	"\016\216]\204Y\"\003\342\371d$\215\364\267\224\267\320\372\242h"
+	.ascii	"\212:\024\242\315V\243>O-\003\307\313F\236\003\216\233\236\313"
+	.ascii	"$>\2429NX\2234b\020~MN\313\223\204\243X2\314\320\324K\255,\345"
+	.ascii	"\213\200\027\201\n`XU\032\335\312\203\023\016\257K6,H\277w\n"
+	.ascii	"tY\225\231\222\303x\024f"
+	.string	".\325\343\224\337\354\313\204\3436\3166\027\245R`\211\372\276\277I`S\213*\202-\346\313\323\206\372\245Xn\244\2758'\331\\\026\200\233"
+	.string	"\222\377E\260\362\344\236\376\0220"
+	.ascii	"\271>\216\036\221\254\342\242 \210\371\327\372@2?\332ur\212\t"
+	.ascii	"\264H\202'\252\366\323\323J\027\177\370\343\206\2765N\252@\262"
+	.ascii	"k\005\2141\326\007\032\245\342\253\256u\216Z\242\017\016B/b\375"
+	.ascii	"\257\003\266\221\320\357v\345\232F\264u\020S"
+	.string	"\221M\264\321\032\342L\370(\362\007\21249\211\201\302UR\320\204\020b\025A>\2708\236\200\342\311=\022\227D\370\267\3469\343[\r\313.1\217\177v8\"\006c\331\377\002\232\262o`\260hF+\0043\250\247a\345}\356\271\2218(V\314\034x\326\304\343\307\353R{\220\361\315=\375~,\226\274U\331\361\263\317\347(\246W\331\005\344\364\006r\313\207\003\373\226c'R\265=\251X\037oH \216\302\227vH\254\226\211\273e\021\2259n|\334G\277<IF\236\345\375\332\240\2058\256\232\216\265\025a\321\250\245\327\3626\246;\233\230\353\350I\336o\322\377\260gGY\312\307\023\322\\\201\026N\300\007\237\306P\003\372\363\rO\004:\3413\211\256~\252\307)\275\f\201\206\220\252\222Y\367/e6\371N\344\201\210C!1,\002}Q\264ciK\034\343\226g\325mY\223m\226n\374\335\016*]C("
+	.string	"\201R\361\305\371`\221\300\344\362"
+	.string	"\272\016{\361b\211\0246\0010\0218\346E\303\331Y\202BK)\301,\020\013\351"
+	.string	"\r\331\316\306wv\034.\037P04, >\306\002Gd\001\253H\031\231_\376d\022\335\232\220\013\320?fl\2458\013\330Ph\330\320\"\332\242\033\230\320\307\024AI\bz\204\034\344\200\f\212\221\360\326~\315\326\017\273\217\334P\027\032]\331$\330\034+\304\035T;\230P\256\354\363"
+	.string	""
+	.string	"\243\263a\247\347\324%\325\016\177-\354H\373\375\304\371\214e\312\230\246\225;\237u\246)#\274v\363,\353\031*-\360"
+	.ascii	"q\312G1@\236uT&\\\276\2519~\273_\373:\240\333.\257v\t\013\265"
+	.ascii	"\340\206\266\262g\362s9\262,\336\na\3412\275?\212\3701\347\265"
+	.ascii	"\367u\324\272\260\326CG\b )3\254U\347\300\366\243\273:\300\376"
+	.ascii	"4\250\357\335~\033\216~\241\263\216\240.x/ wL4\302\024\207\b"
+	.ascii	"\031\203;\377C.\021\0218\342\211\210\260\210\263@D\253\267\003"
+	.ascii	"v\206{\310\355\217v]@$\364\316q\342\202\352\361\357\007\305|"
+	.ascii	"\005\007W0\214>\237K\r?\233W\f\227\240\235\321\371#\037\003F"
+	.ascii	"$'p[\256\n\3022q\231\260\320M\373\351\267\332s&\311\310K\234"
+	.ascii	"V@}\274h\310z\243\244\213E\277\237\\\352w\373\337\311\301\263"
+	.ascii	"\"\354yCZ5l\006l\005\310^G\203\364\034\001"
+	.text
+	.section	.gnu.lto_printName.281.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\257\001M\021"
+	.string	"\266\341wF\340\322h8\222H\312\200\237m\\\025\343\352\354\356\034\257]\351'`7a*F\0354\214\353}KIkT<(k\237\032\006Ml(X\243\212\347\301\3430$G<\032\356W\016@\3050(\016\372M\366\336R\246\024]"
+	.string	"^"
+	.string	"d"
+	.string	"k\003\022O\341?\217\341\323~\317O\310\356\303\301 \2737.\204v\307\223\013\204\377L\037\001\377y\037"
+	.ascii	"\376\263\314\316A\322ag(C%n\271\243\335E\351\210\313\356i\312"
+	.ascii	"|R\n\210\210\233\335\373p\005\200\253y\246\335}\356Y\203\263"
+	.ascii	"e\222Rv\327)\342<\334\337m\253\330\256`\347\0273\340\277\353"
+	.ascii	"u\030\311\340\321\321rg\217\263\324\034\373\336\356\256\025\307"
+	.ascii	"\276\317\037\202i\322\203n\360?\377\007\246\365K\247\227~\210"
+	.ascii	"\206\031\265\032\271\241\035-\032\327f\327c"
+	.string	"\211>\335\316\203~\373\317\271\344\004(\262\007m0\315\306\265!\341\250\031{\216v\307\003\377\314\300\316\361(d\377\231!\t\020B\030Ntvi.\246B\032\225\222\177\251\241\332\252U^\264\351\2463\203\232z\272\375\240\345\316\3634\007\006\313i\350\354\332.\276`\375\006I/\202\240\345.swg\2529~\213_)\344\212\200l\330\222\207\375\026\360\n\352}\334t\265\334!8\213\026\007F\273\273\300v}\305+\334\265)P\021\20391\"\021>\245a\006L\rV\256\224\213\211@\210\210H\254%\223ZYA\200\265R20+\021\026\326\212\313\353A\354\325b\275\224Z`\251\b/.\231\f\241U&\254\226\n\345\302J\271P\252\030\030\312d\304\257\227U\f*\366z\305\240J\343\336[\305q*IG\206xn1\322\327Y\220\020\302\204\210\236\013!\315\204\222\177\2525\245\233\035D4\255Y@\252>\305\003\034"
+	.ascii	"\357bT\215goB$\275\276\017\263\220e5\210p\b,L\006\307c\320aC"
+	.ascii	"\234\210\206\2531\301bBk(X\337\013VqM,\230#\342l\be.\260\277"
+	.ascii	"\251)p/\230\232\002\334%`\300\242\312mW\321\003"
+	.text
+	.section	.gnu.lto_printBoardName.282.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\r\001\005\r"
+	.string	"\246\230XB"
+	.string	"\2216\035\034\n e\301F\031N\215\251V\303\006\373P\243\372\b\212\270\360g\212\207\262\352\177#\"g)n\003\220R\370\231\351\313\207\\\262j\361\0358\">\301fD\373\223\fC\002\243F\366\2262\245C"
+	.string	"B"
+	.string	"F"
+	.string	"\217\360\002\246G\203\354\031\004D\313%`qB\305\004\215\335\305\364\303A\217P\023\344S \031\357\343\036-\034\212\254/\224\252\371:x\355\356G<W\276P&\005\262\273N\357\253pO\267\335\300\266\002\373$\001\031\272,\331#.\325\203}\270\273ku\261\037\363S\232\2060\255\232\316L\037"
+	.string	"\002\230\227\013gQ\261K\241dcI\261\005\b\313\366\323~\210\213"
+	.string	"=F\2023\273\035^\254\330\035y\270@\365x\235c\ny\317\227H9\250O\321\202\201\324)g\205\332\244\272@\206_\"\202V\275\370\333\364\250\2527V4\240d\311T\332\237\223\274\227z\030\016\235r\317\335\345\324\035\3235\204D\214P\326p\200wL\224^\255\t,.T\002\376\030\2708ZV\342@\304\223m!\232\221O\306\300D;\021\251\274\371\350\220l\260\222N\246a\033\317\007\373\340\360f\302\361`\020\266\315\203Y\243=\\u\261\325\262\201\204\242]\324$\324\217\216\2023"
+	.string	"\306n\312\275\007U\212\307\201G\2733\022\030"
+	.ascii	"\357b\310\304\003\274hx\210D[1\212\265\367\004p\300\f\226hB\213"
+	.ascii	"\023V\246\262\354\001\253\251vA\006\373\016\f\270\204@\254\246"
+	.ascii	"\004w\t\030\360\252\342j\246hiz\023J\031"
+	.text
+	.section	.gnu.lto_cliBoardName.283.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`:\004\225\036"
+	.string	"&8\311J\220XN:\200\2211\372\t\331a\370J\216Q\006>\250\345\233|\221\033\026\220\325aA\270\2067N>\251\317h3+6P\211\373\310jR\317+t=\371\3163_\336\222\203\252E\230~\001\016\324\314\226\2066\212YB\b\221;\311\266"
+	.string	"\250"
+	.string	"\262"
+	.ascii	"adi\367\032\027\334d\0076k4A\205\301-\363\203\\k\275\220\243"
+	.ascii	"\313\334[\205D\311\275\306\006\214\300v\223\215\2379o\332\036"
+	.ascii	"\340\274\311+\363\331\200\245+|\020\226\204\251K\355\336\253"
+	.ascii	"\353\032_\217\273\2450/\350i\226mW\376\327\017\230e\341\212B"
+	.ascii	"\244(<\016\235p30\343)\352)r\207\323\013\013\263\303)\n\312\276"
+	.ascii	"\2347R\034\203\254\315x\222:z\226j\331\221)\2468,k\252b\254\245"
+	.ascii	"E&k\252\367\336\264\270dK\244\223\213\264\250d\273\234i\302A"
+	.ascii	"<\322)\252\274I\013\313\362\257[\024\305$k\321\t\367^\266\304"
+	.ascii	"\342\3239\346\314\214d\346\023\314\315\025G"
+	.string	"\347M\333%\026\024PH6y;\266\324\224\243\333\212\215N\\\367\320\013\215K\212\222\335\3028\313<\"\310\236\230\353\236B\305\343\230\324B~\343\272\273\230\272 \331$\303\330[3\003\211\354\211\357\032\250\027NkiJ-d6\nm[1\277\223\311d\222\273\212\271\264Ls!\277\314\267\316\271{\235q7\376\267\3232zZ>Q\313fi\271<-\267i\331\226\226?\240\251\310\232T\254x\212\257{\233\222\\\356\321\\\202\365\255\337\353\\\377\342t\310\273\326{\031\375>\335\237x\022\326D\202\355\246Zn\035\001\270\310\373\242U4d\300\200i\253$?\373=\232\234,\310\277b\336\216=q\347\274y6\t3\264\254\026WV\324\236^\b\330\\\037\354c\027.f#\203m\b\264\271y\260\213\361(0\273wx\242\006\3330\307\346\246L3o\360\261'\362\213Pe\035\231Z\3107E\0260\320\0057;\006\207"
+	.string	"K\323\267\3165\263\207\017\366D\263Q\251\251a\013\313\002Z\226\034\317\266b\232.\373\366\003\306\346\312\376\327+0\231\312\235\313\3167M\263ej\221d\223\r\341\310Eb\006\317n{&c\231\177\200\354\211\335\327\232Jj\241\345*P\302\250\322w\332>\r\276\021\020>\333\025?\214\363\003\002\r\375\250%~\033"
+	.string	"0/\303\256\367C\241g\307\223\223\262M0\201\215\032\201\347\203a\327A\345\320\343\365\364\370\350\2508\024x;\275\235\005\035\225\227\243r\340\351\365v:j0\301\315\320O\250\213\200\210B\274\374\206\202\204~@\240\236\b\240\017e\037N\220\220O7\024\004\004\324\371\212\202:\234\031&\"\361+\322\225 \"*\322\245\306\373\362vUJUvD\352\244\362\336{q7\326\366\365\306\311\274b\255:\306\216J-l\26133\344M\201=\330\237\254<jV\037\266\241\221\315M\3465k\005\022C&\365\007O'\253\326\241\314\320\324\256\250H\035X)\332\026\251\356t\354\211h\337\307\224\022\224M\250a \244\f\204\210P@2\023\320(,h\016p\002\031*4\017\020P\tU\315\001"
+	.ascii	"3\253\036^\300\275\336t\033EzP\344\375\214L7@\266:\373\200\242"
+	.ascii	"\025#\005?D\234\270V\355'zr&+\231\313L\346\321\211\375\036I!"
+	.ascii	"\024\276[hC\363\340{5\343f\001\345\032Z\226/\032}\013i\257\361"
+	.ascii	"FZ\315\322\214\202\177\363\352\233\376~\326\301\267o\b\321\\"
+	.ascii	";\343\032D\250r\361\216A\262\\\270&\242\031\033i-\301\034 \240"
+	.ascii	"\214\352\253\367\036\037\217\324M\235n\360\213\225\272\252\367"
+	.ascii	"\b\251\260>a\004\273\363\375f5\370\017"
+	.text
+	.section	.gnu.lto_printManufacturerId.284.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\022\001\035\r"
+	.string	"\346XYB"
+	.string	"\2216\035\\6\230\013\026l\255\312\321\375\317w\017\314\020M\204+\261>\367\330\314\017U\343\277\021\221\263\210\305\0055\224v\346\326?I"
+	.string	"\024 F\351;t\033a1\367_\001\233\"\261u#{K\231RC"
+	.string	"C"
+	.string	"F"
+	.ascii	"\324#|\007\365\350\220\rc\300h9\004*b\250\220\230\261\273\231"
+	.ascii	"rx\350\021j\206\374*"
+	.string	"\203\361>\356\261\302\341\350\372D\251\034_\007\261\335\375\313s\345\023eV\231\335uz\037\205\233\272\355\005\2663\366I\002(T.ty\262K\\\352\006\373pw\327\332b\337\345\2574\raZ5\235\231>\200\003/\022,\234Tb\227t\262\261\246\270\302\303e\373i\037\304C\204\356\022\301\230]\r,R\354\226@L\300z\304\356\021\356\214\344=c#\345\240\376\004\213\fS\247\234\025j\224j\202\027\376\b\b\232\325\301\367P\217\252zc\005\003J\236\\\245\375\001\345\275\324\177\310\320)\367\334]N\375A]\033\210p!\312\032\016\360\017\252\322\3535\201\024\376\024\300D:\f6\316\006:\331h\034\200J4Z\307\310G\243\300D\003\211X\336\204tH6YIG\243e\233\355\223\205x\330c\302\331\262\023\217g\313\256\322\036\256\266\\,4L(\332E\216\204\372\322Mp\004\264\330M\271\367\300J\0011\360\350\030"
+	.ascii	"\357b\314\304\003|\2641\356\022m\331(\326\310\023`\002\026X\267"
+	.ascii	"\t-NX\231\312\262\007\254\246\332\005\031\354;0\340\022\002\261"
+	.ascii	"\232\022\334%`\300\253\212\253\231\242\245\351M(e"
+	.text
+	.section	.gnu.lto_cliManufacturerId.285.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`J\004e\036"
+	.string	"68\310J\240\330M:\2004\372\371\362\205\030\266\302\005\352#\377\360\361\004,\252q6\237O\203{\356k\023|RYn\214\314il\017e8gkX\270\265\300\240\226x\324\364\225\302*\353\005\301\367\271\004\337V\310\365\212\037\t!\204\310\235d\265"
+	.string	"\245"
+	.string	"\257"
+	.ascii	"_+\304\356\0056\370\310\020L\013D\321\305\301-\363\207\234H\372"
+	.ascii	"\"H\027p\257\024\230\222{\201\017X\201\371\221\201\237!?\232"
+	.ascii	"\037@~\344\224\371\212\201\024W\215\340\365\305\247\305\345\336"
+	.ascii	"K\353\032O/;c`\314\222\034\305\266)\277\314IP%\to\212\221\237"
+	.ascii	"zY\231s\"\240\321\004\365\030\341\016\246'\013#\336\210ym\371"
+	.ascii	"\016&(qf\t\307z!S\fk\222VNN\206\214\321h\222\361\222\024Q\260"
+	.ascii	"\240o\366\353\2115R3\306\316\237\317\216)\254\350t\376\224l\013"
+	.ascii	"\231\240D\364\336{\256[\026?\236\265e\316\275\227\355\372k:\003"
+	.ascii	"83\013\231\331\211\271\263\002T2\226\331'g\277\332\376\020\305"
+	.ascii	"k\365\357\236\342\023\244\254\273\207\344\006\226\025%\333\205"
+	.ascii	"\001X\346\022@\366\353\254\305/*\027A^\253\374\226uk\371\276"
+	.ascii	"$\331!\307\330\263\231\205\210\354\327w\315\223\216;&\246\324"
+	.ascii	"*3P\265=\305\374\036\016\207Cn)f\3212\315\213\3742\277:\317\276"
+	.ascii	"u\226\035\370\237\243\345r\264L\226\226G\321\262HZ\356\321\262"
+	.ascii	"\025-\277@S\001Yj\361\342K\303{\227\206^np\\\222\343W\377\326"
+	.ascii	"\261\316\305g\326\265\322o\235\370m\272_\021\366\245\302f~D\305"
+	.ascii	"+$\231+\274\377M\005\375\037QJ\255\332\2540\037\026LO!9\331\367"
+	.ascii	"\361\344P\216\370U|\323\261_u\310\217d\233\250\2625\346\244\304"
+	.ascii	"J\214g\036\260\263~\327\233`8\023\033\032\314\336\316\346\343"
+	.ascii	"\273\316d\003\003*\367\366\276r0{:6\037e\232\271C\217\375\312"
+	.ascii	"?B\005#\350k\225iK\226\274\224\r>\366l\013\001K\323g\317\232"
+	.ascii	"\371\003\b\373u\354\322+\252\327\252H\366\024\323\264\330\262"
+	.ascii	"+1v&\366\271^AJT\2003\030\371\246i\266>'\236\0356\003\357\275"
+	.ascii	"c\b\262\333b\341'\031\021\302\254\342#\221\037\273\rha\361\224"
+	.ascii	"d\207\366\336{\305#\322\366\003\214\363\003$\0025\322u\230a\n"
+	.ascii	"\027D\354\334vzxl\265\n=\270\232\006\031\266)Z`\203J\270\365"
+	.ascii	"d\250y@yp\267\235\235\036\033\212C\341\246\203\253Y\260\241\267"
+	.ascii	"\t(\317\006\034\256fC\213\026\334\f\351\202\372\347\302N\267"
+	.ascii	";2\312\371\2208\032\362\021\232\351\206\200\202tB>\270\037\241"
+	.ascii	"\\\3119\034\240\240\034m\b\310G\210\226\333\025\321pf\230\310"
+	.ascii	"\204nG3\"\"\332\321N\340\275x[\352\244\n\022Lj\036\213\262\033"
+	.ascii	"k>\265\"\231\323\034\251\216\036A\245V\373d`\337\365\260\264"
+	.ascii	"GM\372\303\354\235g\363\2219\r\222\n\231A\341\361\037\221RR\""
+	.ascii	"\177\252\302\005$\013\215\223\252(1e[!Z\263\331\257eN\250a,\204"
+	.ascii	"\220\203\306H@3\"$\005\246\306\240\002\221\251:\017\020P\351"
+	.ascii	"D)\fc\230u\256\231\363\277\033\236\371\242D\027\377\376\274,"
+	.ascii	"\013\034\267\201\016O=F\321\210\365\264\017\3258\356_{\rz\204"
+	.ascii	"\240U\r\313d3\300\303T\003\021\b\305\274k\266\3119xu-9\030G\271"
+	.ascii	"\307\202&p5\217\302\331\r\244\315\307\2200\361\252C\315\355'"
+	.ascii	"\212\271x\335g\332\266#D\353\332\331k`\241\352b]\f6w\373A\242"
+	.ascii	"\224i\245\241\001'@\234\300\244\270\177\007\360\340O=\216\324"
+	.ascii	"uT\273{\247\354J\311\211\017\243\245\3431T"
+	.text
+	.section	.gnu.lto_writeSignature.286.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\317\001\005\021"
+	.string	"\226`qF\340\322&\035S;\336\367\354\243;\204\320\221\267Y\257C\2157\241cc,\266T\367\377\202\254\250\322\002\006\317o\305.\337\246e\237\b\232\206\030\214 \206\365\331X\377l\276\356\236Xc\245\0225\364E\322\310\336R\246\024\\"
+	.string	"Y"
+	.string	"["
+	.string	"\005\270G\177/\331\036\271\017\330\036\315\262\203\020\230\331V\203 \024\256\231\321\356v\272\302&\207\337\r\223\365\b5Y>\317!\216\314\307+\326z\20472At\212\315@\b\256\036#N{\302b2\t_\324\\O{\304\221\001\275b5OR\204\335u\276b4\367v\333+\333\022\354\004\020/}vsO\2234\275m\351\030\323\020\2465\323\251\351\2230"
+	.ascii	"\002\202\304e>\273\"jEV(\346p\361\331\355\317\360i.\371=\247"
+	.ascii	"\301\372\354\344K\263\377\200\023\304\242h\367C\360h\007\334"
+	.ascii	"\243\t|\311v~0C\024<\355\307\270\f\326w:<\300\256\215\r\034\273"
+	.ascii	"\037\212\003vK*\377\262\211\247-ojR\222\376\307\313\211\272\351"
+	.ascii	"\363'\033\247Q!\221\007C\025\352\177\\G~\r\016\031\270\026>\314"
+	.ascii	"\366\250z\230,&k\276\2264\365^\216L\326\314\351\365\264S\b!\323"
+	.ascii	"\341:\212\311\232j\321N\212\022\2527\366\327J\022\036\036CV\033"
+	.ascii	"\373\364\235\337\364\357\001\336\260 \201\201\210\372\210j5\201"
+	.ascii	"E\245a\245\342R\001\365b\362J\n\352\302J\347\202Ri\351VT/]J\211"
+	.ascii	"S\030XT\335*\225Ru\245o\317\363\303T\354\020\212Q\231\2507\036"
+	.ascii	"\321\321\223F\2354\354Bz~xH\"\207\273\273PoN*\200H\006\344\235"
+	.ascii	"0%\324\373\374\006\neh\327\373\313\002\347=8\360H\322& \200\002"
+	.ascii	"\2423\356A\265\376\030\341h8\271\020\003\013Z$\316z\323\261v"
+	.ascii	"\232\005#\374\306\340\021\211@\3418\334\r\372V\177&\331\004o"
+	.ascii	"E\361\231\242\200A{\242\354\013Dk\374\312\301\312\020\231\354"
+	.ascii	"\256E\323*\336\330Q\004`\345\264K\260\b\356\025\313\361\300D"
+	.ascii	"L\327z\002"
+	.text
+	.section	.gnu.lto_cliSignature.287.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`z\n\035;"
+	.string	"Jf\340\026@@\346M:\2057\320\347\315\303\2432\304@\267L\317\351\357\317c\323\255-\317\247\232\316\274E\201\r\f'\330\351\206~\312\232\202\314~t\247\016x\334\343\357\344\310\364\203\252mcF,!d\357$\003R\001A\001_\001\352\357\346q\356\354`_\316\347\264\247\263\343Y-\177\b\337\223L4\347,\202\275ZL\337\034N\373:\036\221\236e\266\330\2537\027\317\346t\355\333\364xNf\026\372L\024\315y\331\340jG`\257\246CN\\s\233>\0249\370\355\376\231\243i\237\006\310\241r\306bw\227s\363A#`\257v\363\304\365*{\251\365j\267\335\213"
+	.ascii	"\230e\244\204'\22737\223r\316Z\270\255\213O\233o\366\266\247"
+	.ascii	"\"NIEA=9\r\205MA& \373[\325\264\n\337\266\317\224\206<\025\321"
+	.ascii	"\212M\215\313\247\244\242\264@\351-\337\322\242\334\022\356>"
+	.ascii	"\375\342\250D"
+	.string	"\317\354\261\251i\271\223\033\225;\224[\272\351-\327\256\360\370d\324\210Mm\313\233\244\334\340\024\271e\224\313\224^\315Q\322s\275\245[\032\340\215\031\334\235\267\222[B\271\300\364\223\242(z\206\263AI~gv\331\237U\0265'_S\314\006\016\3360\355,\305\200\206\314\333\361\222W\275\363\037\342\242L:\263\307\246\026\367\364B\234\274*e\020\265#\351z\313.)\021\t\027e\331\305i\200\265>J~w+\275\345\223\364*\320\225Dw\376\242\245\221\335\373\333\220s\356\253LS{\003x\367\347\272;\332\315\272\t\030\373I\206!\303\030\377\354\322\275\202\225\210/>\336Q8\2450J\312\221\335>\034Mc\005\212Ju\273\371\316\263Z\341\333\375\017\230\003C9'\257T\301&_`]M\200\273Y\270\270W\366\021e\251\224w\206\221D4:~R\314\354\237\0014\337Ua,\335|\343|Dw\250\354R\322"
+	.ascii	"\311\031\2071\263w\254V\030'\235\214\350\376\224]J\315\343\266"
+	.ascii	"\300z\335-@\375\314-\217\255\360\371\316.\t\271}\ru\213\270\033"
+	.ascii	"F\214{\345\361\235?\023>c\362^\264\f#\273\233\310\213\231\211"
+	.ascii	"\336\306(i\214\245\373\301\323\374\tN\347m\365\346_|\2357qx{"
+	.ascii	"Jx[Jx;jx\033Jx\373Ix\333ix{\330t[8\274\335$\274\035l\272\315"
+	.ascii	"\024\274\r\274\267Y\246\333\277{{\375\335V\357\355\024x\033\263"
+	.ascii	"\267\357\357\3669`8(H\21609\224\276\234\221\364Y\312y\352\235"
+	.ascii	".\277\363\353\371\353\374m\376\272\237\316\327n;\375\347\361"
+	.ascii	":\210\347y\332\353\031\003\276=\351\200\261W\001\340K\255w|<"
+	.ascii	"e"
+	.string	"\275\374\264\270g\235h\316w'\330\333\365\357:x\265\216\002\"h\236s\24297K\260\017vwH\333\344y\334\236\260\311\327a]\275\335M\266Q\022La\223\2372\247\r\020\204;t\323Z\031\340v\245e\232\r\361\347\264\371\311#\303\310\276|\324\020i\302\314np!\276b\034\334\342E\254Mq\332\267VK\033w\257\024\342\177\251\242\340K\013\346^\331\204\037\351\262O\370\232\004\217k\020?\013\335\241\253\333\335\216i\347\356\225A\314\242\n\031F\036\200\242<&L\230\311\347u\306\320\375\351q[`9\237\206\201J\232[^\220Tw\007\304\314\006RZ\037`\225RU\243-H\332uy\232s\316,f6\025\0373k\352\212Y\214\326@/(\2439\252\313\024\2515\223\325\242a\223\317E f\302\327yv\251\357H,lK\337\307z\025\310\026R4\245\020\032\024\001mV\240?\314|\200\177w\024\212\244"
+	.string	"J\256\371\2703\226\346\314\246!\312\346\366\365\017w\367\327\343\264j\b\270)\035\251\370\207\235\234S\360\316.\t\311\303\244\317\313\212\231+\356'\3621\300\255\300\325\263\321A\177\347+n\001M\264\347\304\300}\332\363'\027k\374p\257T1\256\324\366%/\371\260\225\320\361\302\246\f\345\234)\334\253a\205\234@\022p\357E\254)\376\236\343\221\2402\244\354.q\342B\225$F6\306E\234\006=vU\024vVQ\307\021\205S\033\275\300\276\266\272>\204@\301\324XcWXE\013F\260\021[)\212_]F//0\256bV\007\343\207.#\207\342W\211\256\256-\256\342\330\025\203\226\321\005V\302C\321\313\370\305\265\345\265\005\202k@/\350`\374\3422\232XaTP\234qU\264"
+	.string	"\342\353C\227qD\261C\210\021[)\272B\034\350\2768l\034u\2443\304\2168\354b\307\032\030\230C\007\212c\216\035:b\210\321\b\033k:\212\205\3258\332\210\3215\303\206\214_\313\310\n\253!CK,,\206\r-\0319\306\264\262\210}\003\3071\207\226\216\0337rh\005\3637\b\301dgB\005\304z\234\226\326\320\034\202\334\2427\304\036mx\324Mu\300\252\022d\257\312P\220Jl\362\202\202\360\005\351\203k\222g\206\221\025\244\020\201#\005\341NM\341#\202K\313[`$\r\225()|\305H\341\177\021"
+	.string	"\006\217\022\250(|.O\242\360\nh\337\204BnoO\032\356\355n\223\226\314\200\233\031\233\374\023\353jw{\326\022A\324\306\227W\006U"
+	.string	"\n\017\371\250i\356E\377\343\272D\373\001\345#\003\351\206\t\264\346\364\204\257^\205\213\244M\273W>\341\217\251R\206\221\367\327f\007n\210\231}Kw\302\357\213v\213\034\373[\272M\322.\271W\266K\326\253N\030\007\324\322\236\023\252$V\216\b\017\310P\200\321\250q,\303\024TH\211\214\210\214\264\240\240\031\003\220\002\221\251\252z\022\340\325Q\210Q-\250e\377\331\f\3770\3120Z\346\f\3030\333<\f\247\200\331\367(\037o\030SQc\037F\343\330\374\201v\327=T"
+	.string	"r\320\372#\032\013X\0269mu=\026\002\352K\340j\231M#\210\345\331,\\\331\233\375\346m\236\247\311N\263\027\r\031+|\234\033\232*\023\230\033\254b\232uM<\036z\275\201c\023\273[\312\037\3041\\\252#"
+	.string	"\272\r\0173&\027\221\343;6*i\030mT?^\327\253\334\026\213vixF2U\366\251\316\n\302\252\320\334\361V\240\bl\364\006\304\027\345\260 \2030YeQ\3164\350F\310U\272\365\r\266\225\352:\333\177\351\343\342P~\351\234`\032\255\215\373\310\034&\212=I'c\221\344\312\317\255\375\2575\310d\343K\252Fv\362uZRM\340\240\322\252W\361\360\033-\211\272\253\n\316)\276\330\334\240\255\\\0137\\\247\236\205j\375\231\200\026J[\215?\350"
+	.ascii	"\272\007O91O\266\247\370\0052\212\002\264g\373\317A\307\034d"
+	.ascii	"\264\202\324\321\342\365\367\373s \3668\316\227O\031\332\002"
+	.ascii	"\350\310\3164\204\233P\016\\\030\311\371t\313\244\322\347}qP"
+	.ascii	"\217:(\340\213\n\320\213\375\024\2751\374f!(#@i\220\003'\fw\344"
+	.ascii	"\254\201\2760i\006\211\242\277\310;\271e\300z\306\345\223\212"
+	.ascii	"\254\375PVV\201Y\004\2202\211\237W\200\t\262\371\237\005\204"
+	.ascii	"&Vb\r4\244+\372E\375\265\313\250\001"
+	.text
+	.section	.gnu.lto_cliMcuId.288.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"-\t"
+	.string	"\366\320?: \221\323\001\244`l.\215\n\200S\221\027\023\031\002\304\351\311\026[\027\027\bZu#\323\246\005\032\2065\001\2045`\030\210\024\220\260\341\263q\365\021\024hD\242\352&\261{\247\024,"
+	.string	"/"
+	.string	"."
+	.string	"\027\310\216Y\264g\b6v\004\271>T*5\273[i\310\305O\321\377\311\001\310\325\370\2519\354\256'\271\352\270\351m\033\330~\260\r\023\246\240\026\213\307Ehv9nl\366\205\271\214\330>g{\226\0272\236O\373$/\021o\202\361\200]\326J\313n\251\340\203\355\230\313w\331\261-\031T\303\332\234\267+\363\274\363\243<\345\324\305\354\246N\242\266\024C\3021\233\302b\236t\247\365\362R\321\321.\307IA\354svwMY\016\256hX@(\020\201\021(/\034\370H\340\350\013C\020\242\320\323\354}\300\221WI`(\254\236\351T?\235K\022\237\251N\224J\246\312\225{\316R\226\271\226\353\025\016"
+	.ascii	"v\264V\302\277\213!\023\317\374\242).l\273\006\261\302x\240\032"
+	.ascii	"\270\002\346\006\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_printFeature.289.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`H\b\275/"
+	.ascii	"\232W\360\022F`^R\007\363@\236\217\021`\341,\200\013d\"\023T"
+	.ascii	"m\2421q\3632\017\016\f'Gs:\367\020\223%\207\365\177\340\261 "
+	.ascii	"\204\343\007\365!\3165\002\207z/A|4\217\221\3336iW\326\270\215"
+	.ascii	"\354-\367N2\245\036\001\013\001\024\001\256l\266\223 T\271\026"
+	.ascii	"*\241\0252w\261O3\246\206\325\261\264\2575\233\005\2060\013\231"
+	.ascii	"\277xO#tht9#\027x\332\031VO/\333\335o\305\325\252\374J\214 0"
+	.ascii	"g\245\211\251\200\\\335\007W\221\201\002s\026\220c\322E\312\250"
+	.ascii	"c\346l\005\251\221VO\333o\267\243\271\224*\2372\243w9\377\330"
+	.ascii	"\302\314\031\211\324E\253\247B\377\301\236\242\356\203=\355\252"
+	.ascii	"\3566A\255l\005\241yl\325\350r\316\304\037\362\353 G\221\336"
+	.ascii	"\370\253\034\300\317\327cy\273U\005\342\024\375[\325\236\364"
+	.ascii	"!\2716V\016\240\307\262\275?uI\b\030\231\373xxOl\307e\207"
+	.string	"?\300t8\317\343\274t8s\354\356x\370\312\364a\234\227\030*\3149\373\322\207K\274r\\\325\257\310\034\210\252Z]G<\316\213\b\2524g\316\315\327\374r}a]\314Sr\303S\033\216\242\n\346\332\340\374\276\264\320\237\256#F\366+\353\276\257\271\002\271\2674\347\332\327\r\277\352R\316\271\257\361\013\314\233\307\273\035Cw\277\350V\265\002rb\260\234I\277\201\004N\030\372e\355PX\302G\245\311e\3359\355l\336$\001\265\036\333\235\260\247\022\336\327\034\205\"\027\006\313\3116vu\353>\371\246\365\365\335\273H\277\300\217\276\373I\305u#\361\177\306\232pr\346\266\336\252\033iu\277\254\333\225\210\314\231\353\017\322m\201\202k\361\236\260\273-A)\202\267y?p\244{\222Wqw\260\273\335\200\350W\334\221|\212\373\221o\3616\362,\336EDCC\277\342-\374\333B\352\355\240\365\366\001\365\266\001|\273"
+	.string	"\276\r\204o\023\300\267\203\352\355\001\353m\001\370\366\017\276\035"
+	.ascii	"\337\366\301\267{\360m\036\3656\360o\377\324\333\276\365v\017"
+	.ascii	"\337f\361m\036\276\275So\257\353mU\275\215\361\355\024\337F\325"
+	.ascii	"\333\217o_|\333\227R\264I3\243\326<{'2w\325\325\311p\251\033"
+	.ascii	"\022os\337\342\256\305=\213\243\335m\355n\277\347\221\016\215"
+	.ascii	"\216\331\315.=\203e\247q\326\3042\307\326\001k\252`\331}Y\337"
+	.ascii	":T\214\355\372e]\274\001\323\233K\r\336\227g\322\234l*\360\203"
+	.ascii	"4\273\226Z\330\2355\221\264\313\353o^\364\\\215\246\302\367\244"
+	.ascii	"\357\2124\217\264\313K\374\341sy\007\374{\227s\342q\035\326\234"
+	.ascii	"\263\224\332\341\274\314\007\324\217\2366\b&\354F&\354\351/A"
+	.ascii	"\232&\032\231\024\267\253[\347h\3169\343/kW\372NM3J\273D)|\243"
+	.ascii	"?|\341su"
+	.string	"\273\303\300Eo\201\251\206\221\272-2\254[wS\034\342\367\345\215)g\256\347\376\276\035\214\210\235\220\346\0312\264\234\267\3348b\335\n\201\300S\337\037}w\261\351\272\261\205\355[u\357}\354\367\336\237-\027\336\243\317~\260\331\212\355\236\367\252\262\r\333}\320\323\314\331\216\365\356\360\327\247\360T>\324_\375\315\323W\337[\267\t\217_=3#\323\016\003\247?\341\257\235\226\013\372\367\323W\237\255\330?\372\336\336)\372#\377\0176\267\352$\275\377}\374l\303\260n];x\177Wz\232$-e\304\266\224\021\222\320)\212j\252\350d\242wAjE\221\352\205\223\357\311\243\246>\234`\361T\242\350\204\2027\265\202\252h\302\251\004\253B\252\b\205\252\220*np\001EUb\355&\006O+\232\210,\236\212P\304\246()\"\203\237n\341\302)\2128\325\242E\024\221Ef\377 I_\277\200a\312\231\273z,"
+	.string	"_\326\354\232O\311\b\n\320\337\334\350\271\3327\364\215\002\207O\364\\f\\\250\211?\331\b%H\323\305\307\317\315wr\232^\332e/\3027\272\022\375\320\0307z%\246\032\307\244o'\244\013\021\003\227\315\214\t\334%\372\240\b?\343\300\007\275\037x\360\006\236wv\226,\360\017\376\305"
+	.string	"=\317\027\370\240\222\300\003\275\252F\340\335\315S7r\3164g\262\027Lz\236\017>\253<\306i\305\330\236+\364\355\316\r\036&\207\346\t\207u\313\004\002O\007\b\370\001?/\340\257\262\345\022\340y\376\347\203oZ1\237\017\360\352\033\237\007:;:\333f\303A\307\310\373\262\236\367\037\016\236\347{\376\237\300\3471\372#\007\2763\335\203\362Hf\253\016\226\231\200\222\250A0\303\034R\306\021\022\021\021\021\322$\215\001\220\002\221\261\"z\021`\265$vZ\230\202\244\003\240w\221d\324\235\217ft\005"
+	.ascii	"\fBR\367\211\335\201\323o\2239\263\n\263\313z\301\025\261D\202"
+	.ascii	"\207PV\247\374\233'\217\216\221\262X\362\206\202<\212\244\323"
+	.ascii	"[X$\346,dpp\025z\363\305a\256`\275\240T8\271I\334\307\360\233"
+	.ascii	"O(F|D\"2\310\261\240dLg_b\346x\216\3243\213\0361\b;\264\203\310"
+	.ascii	"S\re\250\340b\255\032\302$|\232\005f\033\020\216\364\220\020"
+	.ascii	"4\327\272\361,\375A\t|\016\b\331\230\315p\362b7\366\036\265B"
+	.ascii	"\"\r\r;\205\006\351\365v\b\221\3660\214L*a\037\3730\337\207\260"
+	.ascii	"R\342tB\033\377\243\212m\300\231`\332\363\301\210\211/\027\333"
+	.ascii	"\247\001e\365\020\302\367T5\311\370E\r\340\260\352\2745\266\245"
+	.ascii	"\320A&\256\264O\340\251\203&s8A{\234l\205\235\t\252C\317\037"
+	.ascii	"h\005(\005n\342\031\325\340\r\340'\r\333\316g\344f\322o\247\n"
+	.ascii	"\217\006\301\252\273@v\273\005\264\316~\366|$-!O\342|\311\235"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_cliFeature.290.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`8\013u="
+	.string	"\312i\334\027B@\242Nc\223U\305\347d\266\373\316fL\253\205z\"W\036\353\270O%\303h\237g\212\201\215;\264\027#n\241\200g\231\177\200\224\271\034e\0020\006\227\0041\025\215\2728b\317Mh\223\275\267\224I\006k\001O\001p\001u\277\313I\273,\037\326\3007\024\316\345s\360\351t<\026\213\377\203-\36001\216\253\n\336f\b\357\333&\253\253;\020\027\\\347\374\270\313\301\327\302\343\3138v\262\347\027\307\325\246|\340}\233\253g\272o\337\023\271o3\234\263\234"
+	.ascii	"]\261V\204@4\322\272<q\034;7\0246\231\223\316V\237\211X\370H"
+	.ascii	"G\004\006\b\b`\004\200YD4\264\024\nR\002\375$\221\307\327\350"
+	.ascii	"\266\354\326p\276\326\221\202\300\021\306Y"
+	.string	"\237\210\245\375\b\360G\252 \032\002\003\262\\@\341\024\216m\266M\337t\200+\202{t\214\334\3264\200\270\266\351\024\315D\252\301%\026\261\026\344\334\320^8Uc7\227;\301\003J\321Dfbi\037\212\362%\233\240\254\314\330\013\247QXf\232&p\376\005M\013uPs\313\023g\r\332{\223\033^\334\333\0231$W\226\035\250\254m\252D\377\274p\232do\211N.\231\211!9\222}\320\225'\311\013\247g\354\317\242t\315\333\246d\372x\367%31\271\277\357r\326\357\020\017\324\260\013\333\330\215E\356*\303\244\311\260\250n\331\t\213\211\177\312\260.\326\330\0056\345]\276\32465\242\331\261o6A\342\227;/\234\036a\231`S\274~w\375\025\006\325\332\230!\216\343\254\275\302\304\236\223\236\263v\3129\233\345|t\n\371g\216F\004K\242\204[\302}\253\367\342!\236\267\277-}\325U\344\302\020Y"
+	.ascii	"\372x/s\202y\026\307\321{\245x\243"
+	.string	"#\230V\264\320\367\312\327K\033C\270\364\306\t\227\275\2519\313E\332;*\2706\367\206K/\346\234_\\\214\216\246\2638\346\222\220\037\346\2021\362\245\274\315OP\372^P\356[\245\255\342P\361M\3137\322\276\242\264\317\226\276f }\264s\246!\245\357\365\375\273\237\b\231\231\2515\221kk\345\\\205\352Mm\263\245\313\232\267\223\234\0378\221:7]\313\237\340~\317\006\n,5O\367\254\344\352\234\204\364\352\177Tt\276g\242\353=\017=\357yy\273g\241W\237\203\376\367\2544\352\fd\324\371\347:']\235\221\327\371x\324\371\275\316F\243\316\356\253s\373\352\314\032u\336\327Y\273:?B\r\30595u\201n\266a5\006\273\356\211\t\333\277\265\377\375|\277\337\257\367\347\375t\277\335\2159?\347\377\345\003\346d^2\016\234\230\270<}\377\222\223o\375\262\232\\\3258\f\351\345\r\257\303\3736;\210"
+	.ascii	"\237\017\253\251U\215\301\214job\342\362`x\367\330\030/f\325"
+	.ascii	"\334\252qn\307\313\357\222\367C.0\316\205\367\355~\202g\322\276"
+	.ascii	"\345\322k\r|#\355\023B\332B\373\353_\354\364Y6wf\205\216v\320"
+	.ascii	"\376\312CK\033\031\004\356.Z\326\340G\273\271U \366\315\031\332"
+	.ascii	"Y\031\352\373c\262\334\324\246S\271\357\266\272\265\003\325\216"
+	.ascii	"\375/g\305 \362A\r\365\310$\024\222\211\"D\207\320\232\b\rb\363"
+	.ascii	"\241\355\334\027C\244\203*\215\373^~\347\306\224#\b\204H\321"
+	.ascii	"\20065\327p\233\356\345un\324x\245\344\303i\356\333\246m\002"
+	.ascii	"\261n\316P\217l+'\302\ty\373Q"
+	.string	":\267\321 \035!\310\217\371\320\376Js#\213'\3161\356\357\235]D\244\263\346>jcu\3118\260\032\363l\355\215F]\201\354D\203 \025\334\335=\346\3360\351\244}\274\037\302U^\370\312\033\205\301\364\026\306\002\277\351{\271Csi|\b\243[+\007]\257\327\3533\031\367;ig-5\222\351\002\323`9\026\3209\303r\360\026 \203h\374\254\211\320wS\237\345.\367\203}\261\303;s\206veQ\214JZ\357\353}\315\006$7Not\205\207\017Z/M\221\260k\020\212\021;wS\307\274=T\332\354n\267V\224\032\201\352k\336\233\335\227\366Y\356\005\337;\307\341\2369C\273=\3200\3008h\355\246\346#\231\361\3016\0324sf\177\314\227\373\213\207\253\367\315\262\213\023\202x\343\230kB9\3529%\343\251\312\351\315QWR\034\216\371\251\n\353';\211\3200\242\311\341C\b\r(F|"
+	.string	"\312W\b\232l\2560%\365\224CC2\343\270\222\232js\363\n\001\233\233\025\242\236S2\236\252\234\220O+,\034O\317\031\306g\016\033TO+W\352U\317\251]\343\352\211\212}VIM=\251\236FDQA\0313\024\003\251)(g\225\324\023\225\023\312\352\312\311\200\231m\334xZ9q\330\260a\345LV\267\026\237akC\027\221\212v\201\300\271\235\247\304\t\230\243\344>\030=d\203\322\21759\302\256\255E`\n\177\005y\243's\003\3032"
+	.string	"\b\034\2464\344\215~\272\327\332\b#h\003E\340#\210kl\204H\276*z\004\3549\321\026f\022\303;\001|\300H\020(y\243\207\302KZ"
+	.string	"\376D\006\255TZ\266+|\214Xf\321V\356\257+\nJ\221\3661\217;\231\217\317r\225\273\265;\223\006\264\r\354\355E\271\027\034h\007\251e\021\214\356\201\352\353"
+	.string	">%v"
+	.ascii	"\374\354\233!\367q\007\375\354\246\320Fn\244Z\226>i\237\255\006"
+	.ascii	"\221\013\036\323\251\017FC\341&\f\334P\337(\026\323\333\004P"
+	.ascii	"`\264\242AE?k\342\321\230\234[\321Q\201m4\250\250e\350c^tD\241"
+	.ascii	"\343\353q\037\360La\314P)\223\373c\3438\216\21165\237M\260L\332"
+	.ascii	"\267\374\261\\,A$\322>\241|,\227\350\310$\200\324\250Q,\004\231"
+	.ascii	"c\206dFd$)L\2411\240\002\021!+v\021@\255D\222\315"
+	.string	"&\231\346MP\221e\252\334\251\231\367?\275d]:\257\220\005\334\214\266\265\207\326\021\253Q\333\311te\201$\021\257H\365\343I\357\224y\350$\316\274\331\306\227 \0334\013\274\2643k?\020x8\355\354h\244\245Q\274S\205qJ\001\2420F\337b`\262Z)\370\350`\300nZ\030\202KS\367\326\266\307b\b\273y8\327F\266\267,\223\205\261\375\327\221\353\202\2235\354\307\263=\007\315\231l\344=\263\240y\0029\336'?K\030\250\220x'g\021\321W\034M\204V\231\310\r\335\305&n\035\331\242\202\345Al\t*\341\r\177\263\177\263\b\207\361\026\301\r\327b\336\202\355E\321\024R\023\226\3240\220/\03514\301\370`\317\032\2475{\020<\376'\276so\301I\017k0\213;\236\023\343dE\240\301\262\357r\005c2hm|9\320.\207yc\007\023vE\013{\207fL\202\235\304\230\270_\215"
+	.string	"\024[?\235\355(\277\312\276\353\246og,?\223^\241VA\206Q+\013\023\001+WN+\364x\fU/\241\207\206\250\224\313\226\270\342x7\006\215'\201\013T\230\016\nR\206C\263\3145O\031\210\231\276\350\022\020?\242nS\365\272\"\257+0}\241m\016\201\nB}\371\027\246\355\n0|\232\267\260\320\363\226I\242\255\2468\202\211\217wk\017\034\255\357\022\361\325\362\303\350"
+	.ascii	"\301\202\2541\024^\262\345\325~\370y\334\f\245\350\256mn\307"
+	.ascii	"\245\314X\223\2221\227\032"
+	.text
+	.section	.gnu.lto_cliRxBind.291.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\345\013"
+	.string	"\246UOA O\234\016@/\030V\017\344Tp\0221\003\236\324\302\204!\316i"
+	.string	"G\301r\034\3311\335\330\203\231\375\034i\223m}f\001\223 X\264\200\007\034\306\271\354$\203\0074*\\\307\260F\264\311\226)\005="
+	.string	";"
+	.string	";"
+	.string	"/@,\3547\200\305\207\013&b\354.&=\334\373\234\244z\276\2442\001\303\357s#\374|\252>\227V\330\231Bv\367#\256\031B\216\252\244\262\273V0\334pS\267\235\300v\001\373\007\002\247.\376*\325\237\020(a\340\360\025\245]\r5h\3548S\200\260}\313\266\212\023H"
+	.string	"\256\366C\\\204w\021\205w\354\202F(v\305"
+	.string	"\026\251>-\236B}V\367\240>\355\331\001\225G\300\310\247\275-\370(\004c\354|\323D)iw\r\364\240'\225\226@]*(A\352\350\fSjC\210\240\007/\257\"\324b\344\310\317\026?\225\035\354O\273\273\226 \373\242\007\276\256\013\303m\027n3`i\334\226\3214\026\004\027M&qvm\231\f\3436\213\006\3136\016\260\213\342\216\201\266\301\036t\335\006\263\304\375\264\022d+$c\254 9\223CO\342'\264\017\027\273\236\203\230\031"
+	.ascii	"+\341\337\305\220\211\227G\243\341!&\314\212\260\352q\324\202"
+	.ascii	" \266B\211\007\311\200IU\273\372\202}\344\032\320\nC\203Bp\031"
+	.ascii	"\030\021\240\242\004w\t\030\330\324}CM\336\256R\006"
+	.text
+	.section	.gnu.lto_printMap.292.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\256\005%%"
+	.string	"jB\324\016Gp\236Q:a\3276B\214\017\360:\214\3555\300O\250\366Z\b\211\355\254\206-`\305\273\347\246\353g\266Y\272\355!\274B\267\247F\027BY\207\0056\310\204\202R>\306\023\227\244.\235\271%z6K\b!{\357$\003\326"
+	.string	"\313"
+	.string	"\333"
+	.ascii	"3\206\002\344a\326\225\t6y.\301w\231q\0019\037\371\363@\375\331"
+	.ascii	"I\365\266\373Y\256%x,\032m\313\331\212\013,\347\344\203V\240"
+	.ascii	"\376$z\016\375\211/\204\376\354`7\332\220\215,\224\260\334R\374"
+	.ascii	"\262\226s\326\335$\255\036'\3376\033<n\275\331\324\024=\361\265"
+	.ascii	"\301>\276*k\032\217\302\343\212\254\246\200|\305\007\332\224"
+	.ascii	"I9\033) \330\bH\221\256C\221\372ao8\305!U\205\221\324\322\252"
+	.ascii	"\036v\033u\254amH\246|\\\265\232\242z\332\343(n dlGn\215\221"
+	.ascii	":\353\261h\317\240#\021\023\345\234\327\243\r\213\261\220\017"
+	.ascii	"/8g#E\205\035\300\211R\265\036\207\366>\354 \226J5\253)\037\267"
+	.ascii	"i\205\234s[\343q\352\r\364\356>\353\356\027\335\247\205P\266"
+	.ascii	"y\301\340\340\023v\033g\205\356\321\007\334\356\336\n{c\356\346"
+	.ascii	"~X1\343c\207x\205\335I\241\275\310\356#\251\021\233\364=\322"
+	.ascii	"mT\364.?\202{\371\207\256\365\316]\353\027:\326?@\265\r\364\255"
+	.ascii	"7n\275\035\354mSm\253\250\355T\265\215\252\266\317\3246\266\331"
+	.ascii	"\276\252m\233\332~\002\337\236\2546_\226[7N2\347h\372\311f\247"
+	.ascii	"\230\223o\375^\277\230\037\354\270\373\017\363\257+\037\326k"
+	.ascii	"\004\t\301\203\375\210\204\311\234\003\275\032\333:!\006\210"
+	.ascii	"3U\322\222\353I\t\365g\237\353]\301{\001\237\211\371Tg\313.;"
+	.ascii	"9K}P\177>\007\270\020\272\365\202h\230\314\307\364k\314,\313"
+	.ascii	"Z\316\311\243\237\335\241\373j\305H\313\340%Q\215\325\333\345"
+	.ascii	"-\303\024\225\366Q\347\024\264-Ysp\3169\333.\262\037\366\007"
+	.ascii	"Yb\301J\213n\343\273\336\333\377\002\305]\243\033t5\326$\n\251"
+	.ascii	"a\233V\275\310\266\350\321\327+\247\203\003\335\250n\240[t/\031"
+	.ascii	"\232^$\2667\246H\351@\357\021|\177/\234\rm\237\177\b2\210\233"
+	.ascii	"\363?t\275\353\024\264\264\247\177\371\n\310A\311\214w\360=\313"
+	.ascii	"L\350\3106\360\030\340\373,L\246\025\213\305\205e\013_\344\230"
+	.ascii	"\017]\024\355M\326\234\241\355\323\367v\267\214+}AJr\316H\370"
+	.ascii	"\313x'M\b\365g\216F\004\036A\002\275\221\004\372\363^\tgb\277"
+	.ascii	"\366\276\370\007\3126\227n\306\004\002%9\017\221\272w/\243\244"
+	.ascii	"\346<\234@\306\002\217\200\034&3\320\237\277\251\026\232\231"
+	.ascii	"\020-b\001\375[@\324\264\363\245?\026;\240\013\036\320\022\360"
+	.ascii	"\304\305\260\004<q\353\335\351\351C\212\026=\024;\236\212\233"
+	.ascii	"\207'\026\300\335\022\017\005\200\024\275\245\026L\027`8\251"
+	.ascii	"+~\273\244&\037\020\205\332J\020z,\224t-z;\237N\311\351\247\203"
+	.ascii	"\220k\246&\236\223\356\211\211\311I\267&\363W*j\314\240n\r/ "
+	.ascii	"\316\331\212\202\235.\266\251L\272\036\346\036\rGT\310p\006\354"
+	.ascii	"\305\376\225\204\356`\352\251\222s\246\303A\006\023\317Z\316"
+	.ascii	"\304\033;\250\304&\006?\321\017 \336E\005\215Y\361\n\373p\376"
+	.ascii	"\345\313\311)c\346Y\303\203@\n\0174+\266\255\327v\243.1m\t\316"
+	.ascii	"\346\256z\033"
+	.string	"\004\221\364\252\351}\261\312v\321\373\25320\305?\367\241m\256\364\341\224 1\323\252\340\201\262\315'\267\213\354\264J5\272\017\273\252\266T\026\225\266\003n\250a(\303\224r\006\241\021\221`dF\333\214\001`\002\031\272\252n\021\240\2754uRh3%\236A/:F\372\201\304k\375%\376\024yK\254\027.\240\r\f7\356\212\357b\240\254]\354\355b\341\250\205CY\006Z\203%\343\301\355\227J\326\255\237\333\372S\244\261,\240\377\315\302\007Fn\243\217= o3h\022\220\225\215\207\\C\3257\f\260\177\023\204\"s~\021\256\021\3455\341?q$`\304l\200\363&\360\037MI2&\031\267$\001\330\377\371\260\307\3268\275\3139\221\017t\361\246I2\335\316\232\253\031\220\252\251h{\363\240U\020\252\r%\303\267\364Ml\304jJ\352\250g\337\232\270\331\257\f\274\037l\037\375sL'\001K\340jX]"
+	.ascii	"\343j\341\231\374\002\345`X\322\364\340u\235Rt\323\353t}\003"
+	.ascii	"\313\337\344\275?"
+	.text
+	.section	.gnu.lto_cliMap.293.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\331\007m."
+	.string	"\272Q\b\022DP\036R:3\236\364\211G\321\257\003TK\277\260g\356l\340\246\232K\335\211\216K}t1\346\366\330\365\225n\226L\007\261\002\0211\t8C\004\003\320\001\206\007J\205e\213\302\332k\265o\377\263YB\366N2\013\001\370"
+	.ascii	"\022\001g\313\361\034\226\337#\220\233?>9O\021\234m\007\355Y"
+	.ascii	"\245\365Nu\324%\370\355>\227wi\336\013\217\017\345\254\244-M"
+	.ascii	"\316S\247fj\317\366\364L\340\331\366J\340\331\356fw"
+	.string	"^QW\316z\340\246\357)\006P\316\371\t3\351n\241a\267_\247\357um^\231\034\022B\036\215E\342P\330\006\201\354\212\227\267\331\007\313\2722\211\366\241&F\256\320\331\221h\307\265A\027 \"\277\213\022Y\213}\3179e\327x\255\263\027\315\302\210\234\370\273\350\020\"\230\363\016O}\313GW\246g\026\346\344\302\001K\302\310\336\256Njjx\311\267\267 \247\022\rr\203\353E\253\352\375.*d\245\0207\006\204\b\366\274@*: zfadg\327\340\217h\235#X\327\n\245\267\207\354\324_/\260\255\273\016\247\210\035\267b_\256Meo\304~\027-\2622\343$\311s\352\007P\211>\2717x!\347\334\027\n\026\366f\276\373`\335\035\325\r\224\023~\37548\256\332\234\363\237\364u\340{\221]\274\2041\276\263\312\326\375k#|1\222\017\274:|\277\316\334\3160\226\366?\200\215\ne\211\225\344"
+	.string	"2a\354\334K\262V\345\272}}\314\204\317\367\364\323\272\177m\274K\270\273E\325=\364\370\324'\345\\\371\263\343\302Y\335\323\255\213\245wj\220\2505V\322\315\300\251\351^~\002g{3}\372/%!\035\275\314\333\250\275]4\274\r@x\233\350\336f\376\3662x[yo'\207\267\207\332\333\310\341\355\343\360\266Qx\273\330\336&\336\333\303\340ma{\273\035\336\016\016o\003\205\267\331\366\366zo\343\340\355\013\274}\007\021\242|\215\275\256.g \177\202\262\035\013\027\345l\177\333_\346\270\373m\343o\275#/\016K\316\231\370\213\271\333\251M,#hB;\346d\232o\273\361\354\314m\325\315 >9G\241\332\204\017\363\265f\001\2727t\240jQc\327\205\263\326\276=1\304\266\t\263P\366q?:\302\254\237\275/\t\340\342\370\r\217.\001\334\rB\304\305\243eK"
+	.ascii	"7\271\252\020K\327\374\b7\3759\313\266\31226\273\304\037ciZ&"
+	.ascii	"\306N\326\252K\314\304\247;\242\304}7\022\025\360\240K\f\344"
+	.ascii	"[p!V\342\"=/P\344\017Z0\211o\266v\207\350\016\341\277\035NT\233"
+	.ascii	"\263\363\320\376\233\323\231X\377\344l\237\210\002\036\032\205"
+	.ascii	"\"\305=4\211\225\272pV#\361\020\036\246U\347\236~H\017G\2144"
+	.ascii	"\036\213\330H\304\305\027D!^\302\303#,\304H>\252d\236~\006\346"
+	.ascii	"\364d\001bi_\001\321\334\355\3528\"o\f\240=\255"
+	.string	"\373\307bi\007\333`'\314B\227\355\325gn\204\357e\355\016\327\355{\232\0361\271\025K\237\003h\204\23502\ro\316Y\326\342\356\376p\267\253\345Y\316\031\352\320>A\334\342KG\350\002q\267\324\324=4\210\225X\f\304w\305,\306|\317M\203\200\222\f)\253`\273P\200\003\353\251\205\fe\325Y\330P\201cP\301\300T1\252`PYI\205Xa5\025\354)\005U0\246\236bTIY=Ma\321xR\300\354+\031TXO5\256\256\260\236\210S\255*\277\240\205\267^E)!\017M\226\003vC\266\2227\326\234\315,\274\355\347\023\346\376u\323M\372\333\367\232iL\274f\224\326Y\302@sJS\355\036\332\b\264\374\271\334\213PytX\366\206\260\264O\275\0012$\003\334k1\t#!\341C\371\327\234s\026B\302\f\3601\355\316\237\242\021+\035\264\317\236\246\2256\257\bC\250\302\021a"
+	.string	"\370\034\236\247yE\300Y\316\\P\335\315,\307\323\334\002"
+	.ascii	"/g.\bg\357\020\341\035ys\201\3400\231\037\201\324 \233]D\260"
+	.ascii	"1"
+	.string	"\216\261\221\035\261\264\343\316\204\261\037>&\r\346K\256\313\210\245}\211\217\373\f:(O4\306\307=\t{5\224\236SJQ\351\336\314\355h\b\222}\315\361\343\222\263\026\235\327\301\320\0314\\\r\300\263\177\273\033\211\200\240\250q4\304\2244S\"\"\"\242I\2224\006\200\002\231\251\262n\020P\251D\223\fcS\340\367@\037xqS\320\245H\375He(\321\306\f\330{fi\177\223_\303\361\332\233f\013R\337\207]1\r8( \247*\215\275?\326\17768<v\353\375\315\376f\343Lp\313 \312\350\316\354\353\330\r.\245\220afH\322$`\036E\347\037\233\300ur\0347\2038F\217\310\300J\212?\371\341\260\232_\254\251P\003\2042\032\265\205\367Qs\002\032\263\355\363\3018\274b\253v\337\272\027\023\373\373EV\305&|Q@\336\r\310\td\005\027\342\365\211\273\332I$$\253\373\345\r\375\245"
+	.string	"\365B\261\224\004\333FE\275C\336\305\245F-\343e\227\024\336\376\r\333\355G\305\220\003b\300\377N\233x\346\336\352B\353a\272\"\031"
+	.ascii	"\231\032#:h\372\231\200g\001\354\201_\332\325\321\2627\001f\244"
+	.ascii	"J.\035\013S\277\3503(~X`6 \377\327\034\272\245b8\003\b<\206Y"
+	.ascii	"C\210\363\002/\371\307\034%=o\3502l\214\322\377\366\313\202\211"
+	.ascii	"\nb ^\277#\354H\341\321\n\"\265I\326PW\323O\214\213\353\"'\253"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_skipSpace.294.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\255\013"
+	.string	"\026\026P@ Q\224\016\234\b\230)HC\bg\bA\356\2761I2foU\244\243\250\244\353\300\223\255\033\217y\263\r\333\343\304"
+	.string	"\025L\3726\t"
+	.string	"\251 `M\032\242\bC\220\311.|\224%{o)S\n<"
+	.string	"?"
+	.string	"="
+	.string	"\207\n\302/\261\303\247\211\371\025\251\233!\322>\207\257\312J\"8\264\354]P%\"7=GZ(\037\211\216\353M_@\322\235DZ\307\263R\260\273N\221\246\341\216\267\235\261M\300\376\201wf\372\025\202\022 \033^#\265[J\335\330\021(2\302\266\307\246\330v~\303\016`\327ck\261\313\025\360\200\311\341C\216\302cL3d\240\017\tbl\030V\330\330\345,s\257\304\303\311\003\304\327\237PA\303B\242\354\247\250\320\231\354\356A|,\036^+Rw\032u"
+	.string	"\275\335\335g\003O\215Z\221t,.\230\beJO.2M\365\303\346>y\t\201*\261z\330\021~\373\365[WF\243\241\320 \032c\3318\300X\0206\f\036X\230K\202e\251\230\023!sY\0238\234\313\242p\373\367R!\324\313\b\3410\002\322\020\324\017\337\364\227`\274\360\240Q\375R5ud\333\002\336\211\001\024"
+	.string	"\3571\216\020\rN\244\214i\250\r\207>h\003\022\022\312"
+	.ascii	"\314F\201\210\226;\024\273l\331\273\031{\376\314P\250,\301-}"
+	.ascii	"\252\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_checkCommand.295.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\266\001\365\020"
+	.string	"vatG\360\320&\035\362\337\325\213J{,\300\347\334\241L\361\260\306\305S\347\245\271N\325Y\254C\211}Q\357\350bF_o\177\037\247\223\202:F\347\016<\003\317\207\035\016\340\3705\025\326\23539\020\202~#\204\354-eJ\001f"
+	.string	"X"
+	.string	"_"
+	.string	"\0371\343\324NX\321h8Pt\342\006\2064'\350\031|Iv\271\235$\273\\\237\247\236\311\270\232\362U\317>rbF-\327\316e\034\031\"Z\241\210\330\260#F\225\025\322\205\020\227M\354\222ndp\256\225n\344tb\274B\\\254X \007\006\022\177]q\\5\252\332\312\234\323\332rQ\270\265\333>\331V\261\365#\027Y\361\363\341\310fU6\250\322\355\261\277a\030\206^\036\203\034\350\357\016\376\234\325%\253\267L\255Eu\026\325R\252\243\325\033\325\272\352\207\030\bqc\347\261\2419uB\036\363H\252\350`{\306\346l+(\001\307"
+	.string	"=P\352\"s\362\224@1'\210\342"
+	.string	"\333\245m\377'\2733\256)<\274\200\021\263]\020T\003\200\312\265?\027}+\333\223\270r\037\273\351\341\303\"\310ls\316s\360S\331e\334\343X\240\321\320\337nwIL\304\210X j4\364Q\331\320\261\333c\001\327U\020D\303F\223\334\351\227\333nm\023\003}K\367\204\265*\227\224[\033\345@\337\372\376\025-0,\247\023\352\323\\`L/-\247O\363\227bz\371<\030\023\313\311\373b\036x)%F5p\211\361 \240P1\036\007\316\307\271<V\275\320M\\\260\210\027\372_\037\221 [Z\034\333\245\365\n\315\326\3049\347\314Ft[\033A\002}\013D\333n\267U\030\201\177\2655\311\211\031\2612(\254B\213\")\223\305\036"
+	.ascii	"\3571\376\210\267\244\t\002\007\205h\324\r\034-fP 0\330\255\217"
+	.ascii	"580-\300*\240\332\031\246\b\306xzlq\360l\307\005\3105\225\220"
+	.ascii	"#\"\327\004\016\n\301e`\004\250{\307O>\027\226\273\340SG\031"
+	.ascii	"\reM3"
+	.text
+	.section	.gnu.lto_cliRebootEx.296.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`F\001u\016"
+	.string	"FZaF\360\2226\035P\235l\216\334\310\370\006\033\004U\324\253\301_\345\311\375\331\250\037\374\371\365\361\034.\220*o\250\031\370|\331\216\253\001j\337\217\016X^Z8\n3\242G4"
+	.string	"\376\021\327\317\371"
+	.string	"0\343\267\275\311\226)\005M"
+	.string	"I"
+	.string	"L"
+	.string	"\363:\001\354\323'\233\247\200\207\375\026\354\330\371p\323\263\273\233\\\361\323\347%\365\344\237\b\261\001\206\337\347c\374\201MO\013\fI\374\322./\215\245\242G\026\242.\0041:#\004\204)\325\217\203\335\265\202\241\210\033\273m\b\266\033\330\267\t\240\027\005\007>\355\r\034\364\240\023\250p\306\224\374\354\325\247r\306\376\265\273k)c_\374?\252~\306\200G\r\314ypvA\264\210\3548s\264\310l_\355\2778\214\323\305\026\003\330M\241\343\306\356\352\304\006@\237%\327\260\007\343\247E\316\002\214\031\245\234\261\337\202}$\026\2045c'\245C<@m\013)R\245C\242\227\266hT\362\233\323\350\340\327\230\304\351\301O\237\303>/K@rJ\270h\313!\265W\272\234\021%?\177\364\253\313`!\241\331}9\250!&\225\270\b\241"
+	.string	"#\246\021\311S\231`\352\272\013#o\304\"\024\016\203h+q*+\233\310c\331P4w\031F\336f\352:o\313V{)\343Lt1\272H\324\224\220\362\032\242\211\021ubM\244\b\2438~\260P\\\232\332\024*\310\317 \232\r\261\273&R\345#\034"
+	.ascii	"d\n{\027cfh<\223\035\037,b\367\354\260p\260\306\033\263\026\340"
+	.ascii	"\013\250\242\365\312\022m\020YX=&\035\321\004\203\030G8\236j"
+	.ascii	"\314[h\304Ha=0\352\022\026\261\032=\3562\314\026i\n}_S\017"
+	.text
+	.section	.gnu.lto_cliReboot.297.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375 \325\355\005"
+	.string	"4\n\203"
+	.string	""
+	.string	""
+	.string	"#\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\233\3375\201\200\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\347\371\001\226\314\3477\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\204\340\273\276+"
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\006y\001"
+	.string	"\002\004"
+	.string	"\203\003\202\340\275\276\013\244\003\001\200\300\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\t"
+	.ascii	"3\003\226:#\\\270\3175\334-\204\3612\004\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_cliBootloader.298.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`y\001\345\017"
+	.string	"\226\235lH\340\262(\035\024\023B\\\036\023\362+L\373/n\016\301\200;\202<\013A\022l\244}\334 \306A\306?e\375\262\224[\001'\3063\rS\253\360\371\216^`\260\r\"\227\025\370&X\265\263\035\265\223x\306\265F\310\3362\245X"
+	.string	"Q"
+	.string	"^"
+	.string	"\"\356\033\350\002\270o^\331:\003\\\225\325 '\306\345\206\247\326\332M\024_\235\333\350\334\225\037B\262\316\225|{9\245\"5\027\035#\244\213.p\361\224\b\221\255\235\024\201\217\032;#d\013\025\301T\214\247\371\206 [\273\237\224Z\253w$G\334\237\333^\261}\301>\213Nq\330\217\237\2479\311L\226\203\326\232,\273d\355\204\261Ok\255\3253f_\366s/\177J\327;\327\017q\260#\342\3455\234ZaA\200T\332fC\306\366C\266\267\364\240\223\340k\337\305_\254.\373p\222Zc84j-\025\370"
+	.string	"\350\233\313\007\0248\273\202\205\023\030&\002\354k>\003C\201\230\025\320\353\201\3117\233T\332\217\376L\366c\266\220\261\343\006\2350>\371\316\317\211\236\031\033\036"
+	.string	"v\236\205{\315c|\240Z_\0375\200^\fL\276\201\341~\334\371\231,\207\366Z\034.\330\212\351\016\334\347|\365\310\330\364hm\315\237\245\323\001\366L!8\022=\023)<\251\3020\303\b\202\312\204\021\352\033\261\240>\225HR\245<\321\200\301P\244\036\352;y )\202\t,}\\B\371N\245\016\365\221\300\256$\246:\024\221\303\r\236\330\251\302P\354Be\375\2149\005\304l\341\b,7m\025\t\373\321\32473$Rl%\373\007\035"
+	.ascii	"+\341\337\305\220\031\232\316\344\301_\222\233\275\204j\037\\"
+	.ascii	"q\202 \2441\\v\347\022- \214F\260\t\024\f\327\312~\220\325\325"
+	.ascii	"\256\326`\013\272\306\266\302x\240\032\270\002\346\006\250(\300"
+	.ascii	"\035ii\357+\341\212[\250("
+	.text
+	.section	.gnu.lto_cliExit.299.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\032\001\355\r"
+	.string	"\246\231_F\360\2606\035\374\213\231\300\262;{\252\364\203Vx\2033r\210\263\f\243\337B\333\204N\003\261\234]L71/\002\221\352\324\250\304\256\247$,\243\n\306\201\016\313\243\231\345"
+	.string	"\221D+!\356g\310\213\332\277\255\367N)G"
+	.string	"L"
+	.string	"L"
+	.string	"\322~\212\253(}E\207\007\330=\311\314\354\216\007\\\340s\352\361!\365\364s\001\365\324%\033\307\200\017\033*\250\251\001\342\005\316\356^\323\304K\227%\377,\016\"\276\204\227\236\006\273k)\276\214\270\347m\023\260\035\262/\"\356>\003(\232\224i\206\366\310\267\270\013P\344\304n\313E\225OK\202\221S[\303\006y\321\322\006\217U\316\312\303\f\3551\224\263\204\375\217\335]\317\223\r2Q+\227\020$\256S\263\353\262\323cS\224\006\n\333\007\331\226#\007\033\222\0077D\244]\301D'\225\2632\375\244\3723\2479\261\020\n\325S\006\252\0351(\325\227\361\031(>\214/`X=\245\240\272\301\361\263j\033\301e2i\263\273\013|\030\217\241\3710\247\036m\362\342VO'\250nbt\260\310\035\003\220\016N\001?\316\002\265\221\207a\310,\221\266\202\201\236\212E\242\211\276\316z"
+	.string	"\301\2015\362\266\025L\343F4o\343\264\016\213 \3522\217\263\222\215\313.o\303\272+#\201WI\210\277\f\032\351J\371>\322\005\032\367\037;O\006\241r\244X\246I\202\311D\005\031"
+	.ascii	"+\341\337\305\220\211GI\243\341\"\326\274\006\346H\246A\300w"
+	.ascii	"3&\201m \307Ge\005\222\313j\277\"\263A\220Z\033.\254\2550\036"
+	.ascii	"\250\006\256\200\271\001*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliGpsPassthrough.300.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\335\b"
+	.string	"\266\320=:0\3456\035"
+	.string	"\030\366\203\211\217\356\215\303@\307ci\310\340\233c\214\250\345-8@\265\21593f\314\004\275P8B\275\024H\t\005\227^\263P\366\004>s`\202\232\b\331;\245,"
+	.string	"."
+	.string	"+"
+	.string	"\004\326+\203\266LA\306\206\f."
+	.string	"4TN\273[\251\310\301O\320?\312\003\304Q\370y9\354\256\2478\342\270\351m\037\330^\260\035\023\r $\217\2270\273\033e\2005U,#\266\237\331\236d\305L\302\247\375\222\233\200?\261\370\300\356\330\262\262K*\030\001{e\362\032\353\025\366v\004h^\264\001\006\r\355\247\274D\341\223<\021\232\027C\326\253S\201S\211\344C4K\233\f'\r\261O\355\356\232\2166\235>\025\333\207\363t:\355\332:\316C\247\323.k\033\316\243\325\017\307\351\252\366\201\352Fc\017b\373\252\204\347}5#\367\324\322\321\331K\207ID/\214\315\323\r"
+	.ascii	"\357b\310\304{\277h\301CkC\260r\rm\205\361@5p\005\314\rPQ\300"
+	.ascii	"]^\264\223\f"
+	.text
+	.section	.gnu.lto_parseOutputIndex.301.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\023\003=\031"
+	.string	"\266/\254H\220\232Q:\260\312\2320\325\235\033C\006\202\224K\007\332z\345\325z\"\236+\f=x\264\303\241o\375\325F\377\345\311\033\303#fao\252\022WOF\334 c!`\314\274~\202%\221\276\313p\371\276H>!D\356\224\002\227"
+	.string	"\211"
+	.string	"\231"
+	.string	"7\306\270N\255UZ\250\324j|\340\004\347K\033O\333\376\221#\351\331\\\033\230\226\210\021\276\234\b\233\200\325Zm\264\363\230/\311\357\230/\327\307{\3179cfI.\355\371\276\347\\\3539;\276\266|\361x\232\372\371\245\251\307"
+	.string	"\020\243n\222\267)\251\203\251!EZ\260\022CFF\f\322\322\274j\0323$F\235$\031\240\251\302\206\307\t\310PF\004\322%}\214\270\3012#2\221\007\216LV\327:\245A\374Q\032\273Pk5\035\022\237n"
+	.ascii	"\267\035e\033\312\246\\\002WX_\200\324\215O*`\355\025<\372\341"
+	.ascii	"l\257u\002o\274\240\272\200\353\263\215>\272E\373d\255\265z\253"
+	.ascii	"\354\033\377\235g\375:?"
+	.string	"\336\2633\371\005\220\324'I\035#\251\315\222\272\\jr\251\227\244\246%\365\013P\2603E\206\264y\323\224Z\235\302\340\324\256\322\312\325\217\277\335\363\265,\363\217\346z}\252\237\021\346\353\t\232Zk\203\227\256p\222\324\2260\241\367\254\0277\"\220\332B\222\005\002e\002\003\314\301\251}%_\322\013\227\022\244*\327,\327\200\032/!]\277(=\262\316-~\337\f\351\222$\366\255W1q\342\f\232\310\321\005\\\037\221\037iv\230[\364_\230\344\312\300*\243\263\273\344\256\031\241\324\303n.s\266\273=NMg\204V~4l\215\254\201\nS\016\240\263\375\326\243\340z\310\324\032\3740w\006\203\026\020\241\240\037\372P\274\246\272\230\326g\037\207ep\220[\364,\r\226\027 u\343/\335\013\343,\3210\313\250\255\302\210~\370}\022\035\277\365\375W\202XQ\331-\272\301g\273\302c\256\r\371\320\036\320 \320("
+	.string	"i\020\372\001A\253\201"
+	.string	"\302\320\341&D\023q\373 \342\346\201\226!\210\303\317\b\241 \005\256\361t:\334\216kC>4\032\212\243\"\336M\307\005\321\320Q\220\022\013$%\026;\031/\307\003\322\351~Z\354t:\\\200\0249\244%2\302\t\r\031\345b\316\325\212t9\333Q\021\316\310\226K\342\331j<\336!\021%\331\224v\273$\233\314XO\326\255\362\214\352\206\227\330mP\335"
+	.ascii	"r\326~.\r\333\347\372\302\322\376rzh\214+\204\202\333\031\334"
+	.ascii	"-x\271\2636\211\022\264\340\372\\\273\271\261\r1 \220\002\021"
+	.ascii	"\262\253\007i\036\031\345E\247<\002\217\177<y\211\230s\357}d"
+	.ascii	"Ez\230Y\303+\374\310\267\372\270\345\356?c\013\017\221\256\215"
+	.ascii	"\3574.\321#\3650r\232\347\261\350\271B\002k\270\333\017\253="
+	.ascii	"&\3712\301\337\336\026\306\007\266\305\363'J-\230\211W{rk_\213"
+	.ascii	"\245\215&\340\025`\356v-)\240\237\032\300\367\2035\372{M\316"
+	.ascii	"VY\253\201\002"
+	.text
+	.section	.gnu.lto_cliMixer.302.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`-\006}'"
+	.string	"\312G\330\017D`\346M:\223\007\235F$L;\343\371+\004\300\225\277A\b\0351U\222V\300\223\360\213B\374\260\237\233C\253\312\347\361h\021\271%]\301K\006-S\245>\021\246o>F%\021\354\256?\373\304\022B\344N2\352"
+	.string	"\327"
+	.string	"\356"
+	.ascii	"w\352\3644\357\275\f\2162\004\365(\361\264J\035p\rn\231\037v"
+	.ascii	"\261\365av\274\350^\257\2635\367*\035p\002\365(+?L\217\252\017"
+	.ascii	"\220\036]\231\371\b\270\272S\021\352\362`-\007\335{\213=\205"
+	.ascii	"\317\315\343\001?\225\347\336\271>\b\374\021\371zC*/\025\242"
+	.ascii	"g\333\225?\365\340\3317d\275\r\n\233\223\302\225\344@,C\376\353"
+	.ascii	"\312\242\305\304\022\361\300\340\312|g\005\261.U\316\246\265"
+	.ascii	"\344l2do~\246\304\366\276\274\006\26078CYL9$\026#W\317%\272f"
+	.ascii	"\332\331\264\216\234\274\253\254+/\373\201,ZH,\257\267e\344\351"
+	.ascii	"\251\222\\x6-*\276\255\243ES0\346\232\2609(\\M~\236\026\332\024"
+	.ascii	"\311\002n]\235\366\013\316\317\227\267?\266\254l\007\270\345"
+	.ascii	"]\270\367\262Enq\235\213\316\374\016\314\f\203\031\205\021a\250"
+	.ascii	"\354\235%\362%\316\331I\226\363\373\330\321\030Q\271@^]a\367"
+	.ascii	"\036\217\204\241\036'$\035\345\323\022\365\260\1770\270Q7V\237"
+	.ascii	"\2662pV\226\216\337F}4XvT\366\216\207\354\260\231\243h\330#\337"
+	.ascii	"_\376A\230bksM\253\236bVV\235\302\324\030\263\356$\337\022\265"
+	.ascii	"DQ\343\366b.\3600?\322\321\315\234\215\256<\017oFv\026\242\226"
+	.ascii	"\203\250e`j\371w\345Ot\263\263\357\226{\267\254\246\226y\247"
+	.ascii	"\345\364\226\321\324\362\231Zn\324\262=-\237\310C\255\252mY\027"
+	.ascii	"\327n\312\233uG\350\256\241i`7\373\311~3o\346\237\021\255\224"
+	.ascii	"w\253\327\347\255\0316\350c\3742\262\034>\304\352\n5\357U.\251"
+	.ascii	"G\355\227\354\343\223y\231\365fX\355\227\353\276G\311\002}\256"
+	.ascii	"Bve\334\306\220\254\3327;\236U\313\321\333\026\365x\202\013\t"
+	.ascii	" \023\355\3165\257zJ\230G\316L\355$\017%Q\013\364\021S\f\235"
+	.ascii	"\224\237#\025\362w\244j\037\312\212\327YS\373e?\005\025\272\363"
+	.ascii	"\222\006 P\024!<\004\366c\247\263\202\031RY\305\324\343\207U"
+	.ascii	"\f\223=\222\177Fnn\315\"\277\226\251\004\2669_\302\366b^\363"
+	.ascii	"0`\3239\031\324\r\352qC\322Q\016"
+	.string	"\035\354\221\274&\036{\212\215:\355^\026\223\211e\267\264\347\330D;\311\314H\026\355\217\035N\210\2437\021\352\261B\322\b\022\366H~\340\344\252\247n\\\315\304\022\237\315\333\2348Q\250HU\244G\321.VISz\367\331H\313cW\225\275c\333\335\307\262c\026GkR\357\265\222\300W\3635N|+G\371\351\205=\362Ez\324v\220\254\217\235.\261\234\341\003\023\b\"\006\016\036\230J\200\340\360;y\302\023T\213&(c\323\r&\037\333\250a\204B\271\206\002\342\004\251'\034\306\017=\276\3612\236\240\372I\206\021\352)F\023\b\0271\234x\354\244d\204r*\31206\305(:I\325(*\r9j\306\223T\321FT\224T\321\247\244z{\361\005\252\256z\023\354\244\333\213\372\210\316\216\254\312m\314\214\211\227\033\340IT\324\276`\003Z\237$x\273\367\376A\367 \377\374\353\223\024\330\301\276\257\201="
+	.string	"\f\316\r\313n@\032&\200~\235\374\265T\257\177\3758:.k\307n\213#sF\244d\177\346|\326d\203\267)\352qE\322Q\244f^\253\254_l\b\020\021\353\342\353$\363\344"
+	.ascii	"\217z\310D\343#|\333\213\372\007\263\275\327R)\036\227\247\327"
+	.ascii	"?\373I\307\216l.\355\274\367\336\336\002\313\274\202\255X\226"
+	.ascii	"?\020&\232\223\271f\325P\007r\250A$\304\2304\206\031\"\221@$"
+	.ascii	"h\333\214\001\220\002\021\2612\017\021@MklS\320\314\001RC\355"
+	.ascii	"\r\037;a|\n\277\177WB\032u\365\204\216^h\251\341\326%S\213\245"
+	.ascii	"\274f)\301Kb\254\364_\345\210\363c\024\035\037\372y\367\366o"
+	.ascii	"+\311\266\241>\242\322\321l)\241\331\256\023<[\2632\254\376x"
+	.ascii	"9\302\262\203\254;\213\275\242\343ad\204\343\326\342\025\020"
+	.ascii	"\031\363\350\221\\\235\254GO&\332~\305\265\"\202.\271[\330bx"
+	.ascii	"\320a\350\273\360e\367\271\243-jg\205\311i\314z\246\215B6\334"
+	.ascii	"\026\"\031\365\027l\252\352\321\343\202\260\210m~\232rkF\325"
+	.ascii	"\222(\314\n\350.\223\257r`I\300\277\314\304\331Q\305\203\224"
+	.ascii	"\032\026\344\323g*\3010\360\344\367I\353\256ae\376?[J\344\255"
+	.ascii	"\370\352\275\003\"x4\262\324=K\246\264\260OZ\322\026\2764"
+	.text
+	.section	.gnu.lto_cliMotor.303.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`(\t\r7"
+	.string	"\312`|\025CPdR\007\201\327-4\2372\360V\022\204\242\374\330Y\235\3642\355\f\025\237d\013\321\302\021_\211\362R\234\3347\266U\206\304P@\222\001\202\202\363\016\005\b\213\312\007*V\243\315\212\221\266\355\275\367N2\245H\0013\001G\001$\324\306tH\273\312\220\265\343\2034-K\316m\027\316\\\0253]v&\036)\232h\316\315\nn\346g\257\227i8\317^\331w\310\221\252Es\316H\276\266\004\327W\243\212\233WwI\216\273]\214\227\275>F\207\013\345\fE\255-\347\246R/p}\355\246\027\261\276\272>\304\372\372v\343\r\330\312\310\tR+J3z9\347\245\227\342\272\305n\247\323\351\324\325\246\367\357_/\"\032\002 T$\016\003\b\203\202\300\237\333\262\253\372\370m\007v!\275\210\310i\305\207"
+	.string	"\b\251\355\026\220+N\307\234\242R"
+	.string	"\024u\3637&\270(\346\304\241c\211y"
+	.ascii	":\346\225\266/,l3\200yU\361 :\346\022\325\230sv2\246\022\034"
+	.ascii	"T\023@a\262\347tL*\252\361\rT\351d\314$\030H\307D\262\205\177"
+	.ascii	"GQ\274\216\270\333b\301\243g\304[\325B\331\227)N\3074\242\276"
+	.ascii	"\031\032\033w\372\021\031s\f\263J`W\222-\242\002W\245\217\300"
+	.ascii	"\230F~\225\222\256\345\001\363:\342*\213\305N\233\230=0\2571"
+	.ascii	"\177\365\301\027\034!\303.-\265h\356\311\035w:\346\352\312\302"
+	.ascii	"\270\315\220sn\274\354\362\362\026\340\335\316\245\273\211t\267"
+	.ascii	"n\001\037\006m\245-\"\036\250\230/\271I\\'5\236\2333\322\277"
+	.ascii	"\232 \245N\007p\272\033\317\375\313\025\313\314\334\314\016|"
+	.ascii	"%~\220\\\233\346^T\013\367}\235\03534+\021v6G\203\202\310n\351"
+	.ascii	"l\336&\305\321.\347\244/W\270\311)\006\276\266`\302\2764\360"
+	.ascii	"x\215/\b4y\314\322\203\245\0161\202\357~z\201}\331\276\006(\017"
+	.ascii	"t\210\307\\\231\377\260\266\301\372\2738\253\243\205\001u\020"
+	.ascii	"\017\370\356\030R\330\227\376\356t\357!\007\027\335\213j=\262"
+	.ascii	"\273\211\304\037\326\355\024|\274\235\351\207\322\275\244\224"
+	.ascii	"\364\340\350"
+	.string	"O\357#\037\343\216\340\200\001#\0277\001o\272\017p7\357\242\227\361&\372\031\357\241\320\325\274\203\202@\027\367\257\305\355\262\270[\0267\313\342^=\215\267\272\342\376\0257Vq{\204\327\231UgFz\345\35143\220i\240\f]\335\260\270\233\373\323\275\214\373\031\3674w5\3674\336v\253i\177\353\240\033\217\273\351\016)gko\353\240\257O\034F\255f\356\n>\363\322\304\350\251p}u7\343h\216\306\327\334\331\3014\r\247\3464\016\322\262,9\347\3118\005\230\300w\277a\3362\354\313\365\275\315\213\326\370\366\030=\201o\274\324\203\205\247B#&\266\265v\316\346x\032$\210mp\223T\f|\345\340\301\016\237\034T\371\310\366\210\024e\320\207\331\271\025\373Ou\026G\234N\365\214\270\025\213\377\337\215\036\217\310\303\373\243\354\303\302\323!\031\233\217\340\217\370\007\236\253\177\3027\372\005_}\256\366\206c\017\374"
+	.ascii	"2a\234\354\251\2733 \244\354\013\360\303\032\207\364N\371t\225"
+	.ascii	"\376I\252\246|\252HN|.\035\322:\312\247\273$D\256\315\227j\340"
+	.ascii	"\207nP\0136sT$\027\272\300\017\222c\023\247\"y\360\271\256\330"
+	.ascii	"\3417 C6\267\247N\3159\347\337\207\265;}\225\306Q\242\265\017"
+	.ascii	"\276Y\341\367*\374\240\347j\265\r\376\356\244l\312'\233\364\255"
+	.ascii	"\256\301\007>W\216\257\2619)\234\317\327\330\007v\351\235\217"
+	.ascii	"\017.\311\211\257\364\355\023\357\231\374\312\302\323\3667\356"
+	.ascii	"\357&\320\017\244k\204\207\337\035b\004\366\345\2030P-9\3675"
+	.ascii	">0\320\366\303\032\202'}\0032[\346\366\324\335\t\300I>\374\022"
+	.ascii	"&\260/\223\376\337\370\226@\223\217l\217\343\t\332\264\351E\221"
+	.ascii	"X\352N\236\3301\303\006\355t4V\240a\214\212b\"\266\323\321X\301"
+	.ascii	"\351h\0246\007\023 4\234`\333\210\241\274\312jF\225\325\210\342"
+	.ascii	"\207'\253(\246\023TSUSR@\252\252\031O5\230h\2640\232f\374\215"
+	.ascii	"''\031P\353\223\f\250\250')&\021NRMm7A\200\212jZ\222\001\305"
+	.ascii	"$\265\324DEc\tBQO\315x\242Z\252\232\232\242Z\n6\263\3233`}\026"
+	.ascii	"\356&\322Y\324\366\261\373ZR`\217\310\020\242+5g0\f\236\346\036"
+	.ascii	"5\303S\037\022Z\353\323\"\234\313\253\002\300\325\340\3742q\342"
+	.ascii	"&]\351m\016`\255\357\bt\353\221B\037\326B@\304\343\267T\002 "
+	.ascii	"y\361\271\212\377{|\345,\316\375\337\273\262\017\002\356~\303"
+	.ascii	"^)\330\227\356{\222&Y\217\364#0hE\212I^\374\343\027\310\323C"
+	.ascii	"kYx\240~\036\371\332\3677/\221\247\367LF\261\360\364\017\320"
+	.ascii	"\251\345\021\221\360\321\253\357j|\357\255\222\300\356\265\342"
+	.ascii	"&q0x\261\274Z\360\032\237\224\375\356\256\341~\372\231\300.\347"
+	.ascii	"L\241\235\217\367y\267\264\217\371\332o\227\327\013\366\345\353"
+	.ascii	"\205\365\325\227z\216\236}\001@\362\350$\243oFEn\350\277&\220"
+	.ascii	"X\200\2072U\177U\376\311;\253\263\376\321\343>\001\200\270\250"
+	.ascii	"q,\244\020SH\031\031\031\031\205I\232\016`\002\2311\253z\021"
+	.ascii	"\320=D4)HZ\003u!\220\341\237\310\243HZ\034\322\002\375\307\004"
+	.ascii	"@\327\225%;2\342\257\020&:\240\334\025s5\244\244$n\302\002.c"
+	.ascii	"{q\3722\021\234))3\277\244\270\276\324\205\364@)F\234\220\344"
+	.ascii	"\353\031\351\224\233\275\367\375\001!FO\300\303\316C\315'p\367"
+	.ascii	"\252S\b\221\001\025\023 \231S\023\375\274\354c0\226\034)\213"
+	.ascii	"\322\321T\234\314\305g\322,#\320R\256\213M\336\002\026#+\\\222"
+	.ascii	"\007\237\342\002\352-\250\031\350\363d\220\304\240\332Oa\244"
+	.ascii	"\250m\026\224zW\261\024\201\203I\206j\217v^\355\321U\311\266"
+	.ascii	":\234/7\353\003\n\332\2666\325\372\030\301\211w\244|\214-\357"
+	.ascii	"\303\264\342\036\212\027F\336*Q\n\304\325@\006\030x\013o\213"
+	.ascii	"\332\200\001eC\3313\323Z\257\321\336\246\306\224\033\277\222"
+	.ascii	"\313\361t\003\n\036\252\367\003\027\025\236\nDB\342/\234;`O\330"
+	.ascii	"\302x\2121\264\273\366\200\331d\002X9\3201\344\324\325\3514W"
+	.ascii	"\b\365b\261\330\331bV\321\254uk\3230\313!\363\r-\200\3765\222"
+	.ascii	"\036\312b?\036b\3420\025\312_\300\307!\351\022\261/y\201`\245"
+	.ascii	"\363\276B$\2060?\205\r\245^\377\205\202\320\006\030\357\230$"
+	.ascii	"f\372\204\31503\f\322\032\"5\033'\246\305x\235M\212P\003"
+	.text
+	.section	.gnu.lto_cliPlaySound.304.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\032\005\245\""
+	.string	"v\376\337Ep\236U\007s\310\364j\240v\303\267FX\003\3228\227=@\f\364\036\253\274\302\220\365\033Dy\277\306\233\225C,9\262^\341<+wz\212\243\365\300\362}h\021G\263\005?\230\350MA\215\277\375\367\336)\245\024\315"
+	.string	"\275"
+	.string	"\317"
+	.string	"f\367.\227:\345\005\314\276lA\207\251\235\271\253\364W\260\255\274h"
+	.string	"\367v}\001s\3572\001#X;\345e\033\251\235\256]\244v\312A\346:\001\262\256\220A\273U\314\242\347\336\273\373!\214z\260\203\200j\354j\243\251)*\364\036\344\256%\205\035d"
+	.string	"\210\246\244O\ru\220&\311\031UH\230!\355\205\344\341,\255\t\203\022>o\252<\203h\371\350\365\306\304F\333\272\f\311\345\205\324\34144\302\227\224\"\266d\021}\260\246\231n\266\001/d\017WqtjK\022\263\034]m\264\020\312\324\246\t\217.C\366@\213vxi\323^\310-\3772\344\016Tw\357\355f\37319t\2475\335{\331\215I\255\346\241fn\225\231]0\2433\002m<z\037\3733\346dj\177\334\267\032\"\327\260\273\264\027&\303}\204\261x\214\267\221\307\250\235\372\247h\313L\321\001\303\333\206\262%\213\315\277\222W\250\375#\230qb\370\036f}\350\231\177(\274\215\375\335\354\236A\206g\311\323,\306\013\231\227B\177%s;\035\255c\027\376.\346\266\322-"
+	.ascii	")w\204#\272\365\262{\250\301\232k\354\332a\3154\325YM\235\323"
+	.ascii	"\324\031M\235?uv\324\271\017|+\245\006\215\034\375<\273\267F"
+	.ascii	"\333\347:S1J\336\033\254;\254\237\271\233\331M\006\342\306\322"
+	.ascii	"Y\202\035\306d\372j\335\226\301\246\375av\357u\260v\252C\273"
+	.ascii	"H\005{q\273e\267\223\312\226H\030V\"\224\222\206'\033\331s\371"
+	.ascii	"4\003pg\t\245\366J&z \023\316\215\350}\254\315\221\333\320\301"
+	.ascii	"\333x\373\226\323\336p\306x!\213\363\326\322d>,xs/\261\215 V"
+	.ascii	"\"\004\245N\005<s\b\021\336Fv9\177\236\316\254\027\"}\331\262"
+	.ascii	"\263\376\226\255.3\266\357\342\365S8L\215~\372-\006}\366\314"
+	.ascii	"\317\034\256\257_#\007\214\013\355\225\234#;\243\221.u\001<y"
+	.ascii	"\320\334\257\177\374\322HqV\244-\2623\244\372J\277\367\nS\324"
+	.ascii	"\266\276U{\244(&\204{\332\037s\377\337^L5C\316<\305\3636\376"
+	.ascii	"c\001\031\322>\367\036Z3L7a\\C\364\336{\321Wrw\203\2621#B\337"
+	.ascii	"\365B=z \023N\220\343\236"
+	.string	"\271g\302\003|\225\244{@\225T\302\327\303\222\252\2022b\252$\035\013\036\225\257\247\003\376H\350\250|*~W\272\237\323\021Sp\352\360\264Ag\301\351\302\007\t\031\240tQOQQ\025p\275\346YI\371P\236\257W\305\263\222r\242\262\232\242\361\224\202^\325\324\316\327\223\262\332M\001\257v\n\214\370w\202\007\334\245\370\375\200;\240\345\355&\030?\364\022\324\")6\377\350\033I\333\245(\306\022}\323i\247\024\305T\244\257\375\361q+\236\226KQ\214\275=\243\352\372\354\037\231\225\\m\022|\242C\340\3543\007\247\004\251x\033\325_j\243\f\360\332\263\316\340\227Q\360\312J,\361\255\023'\361\205\\\300\231'TXj\2338\207/d\366\323ph\347\370R\f\211\020\240\001~\373\326\322h.\020\bc\2501<\344\020C\306\210\220\00422$J\033`\002\231\242\263\016\020hi\232\264\006\377v-\310\277G"
+	.string	"\264#B\211u\225\002ch\247\f\302@nm\200@\n}\201\274\256\230\253#%\255\372\265\251Xa;$4t8\370&\020\037\244\300\001z\t\266=\3535\007z\225\206aC\343\355I\027]L\351\037>-\263w\274-ES\227QP\241c\036FDG\307'\230\342{\226\232=\360R\261i\272\264\177\350\376\330\214Z\361\376\034\232mUK\316\341\034\361\337\345\035\230\252\311\347\275"
+	.ascii	"\301\321u%\030\336\221\002\367\247\362\002\"\237\220\337\271"
+	.ascii	"cs\200\251\367H6'\202A\314y\343\374\251\035.\366SD\322\370\337"
+	.ascii	"\235\333q\232\t\200\007P\203\027~\034\341\017"
+	.text
+	.section	.gnu.lto_cliProfile.305.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`:\002M\023"
+	.string	"\306$\200H\300\224Q:KP}o\277l}\334\356r\3568\005=\261\345\356(\373/KO\304\001\331o\037\240\002\202G\374\276.\263V\277\231\330\264\035\356(\035w\r 8\021Y\367N\310\265\224N\263\340\204<?\277\221F\b\2212\245k"
+	.string	"b"
+	.string	"m"
+	.string	"s\336n\344\230\223T\340\002\341?\223O\001\377\205?\001\3779f\023\tp3e\fJ$\234\234\2229\247jY\370^\215=4\201\237\267\032\363k\262\207\237\355\334\204\232\201\342\240I\r\347:\232~\254rgd\205m\347\236\347\340\307\247\205I\355\306[\334\320\216\007]sj6\272'W\323\313\234\323:\326l\367\351\266M\330\206`\353*\367\346\234s\267\307W\227\037=\\xo\366\201~\361\271\033\005\252O'\357\360\344\377\231\324\036\250\336O\255\236\372\251\007%\f\025_\032\232S\247T\232I\237\221\214\347n\037\347\353,\372B\257\021{n\304\247m\376D\214rH\2219'\202\177^\020\376c\361.\332V\222\304.\301\325>\215\377\304\016T\342\251by\264@v8\242o{l\243\350\356q/\302\240\022$CHk`\r\033\364\243YnVf\335\335\343\300Y\232ii"
+	.string	"j\257X\372QQv\245\216\244\032\001)~|<\335\t\034\201\037:\221\207\333J%\2379i\037[!\315\345\300?{\372m\2709\"\300/\007!!6\272\304(\r\327v\275\364\343\367A\027K\243$\233\225\331\244,\2161\300\302\222iux\301hD\277u\326LK\206\345\202\241\020\343Z\231\274ji\311\254T3-\030\227j\005\003\241jI\361\213\206\005S\205x\275`*\221\234\337\233_f[\363\"\034\240\342\332\021$\004\375e\245\210\007\211iEOkO\250p\335S\273\022\t\265\247\265\216GfZ\332\340\271\361"
+	.ascii	"\267\307\372\017\240\2670!\037\353\255\250\263\224D\305\302\005"
+	.ascii	"\375\210\332\353\036. \220\202\022\252\365c\370\307\030\242h"
+	.ascii	"\271s\334\257\326V\265p\205\227\357\310!\255\363xc\233\021\250"
+	.ascii	"\371\003\344\262\003\274\231&^\327>\031\332j\242\355}\335\253"
+	.ascii	"p\273^\267\365\002#\202k\314(%\2128S8w\323\215Y\213G5\256pn\200"
+	.ascii	"Q\362\2124\251\350\310\332F\217\237~o\343\027\334\030\237s\256"
+	.ascii	"\265\324\t"
+	.text
+	.section	.gnu.lto_cliRateProfile.306.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`E\002\275\023"
+	.string	"v\345\203I\300\224Q:hj\007@uxB\226V\376\227Vd?\332~\227\216]\364v\2611\240\025\023\352~H\025}a\373\272L\205\372\315\304\246\355pG\351\270k\b\300\351\352,y\361\237\201v\232\376\tNd\366K>\331D\312\224\002m"
+	.string	"g"
+	.string	"q"
+	.string	"O\231S\007ec\316\335\002\033\020/\275\373Jx)^%\2744\315\026\322\3023k\r~\277\236\236\2229gkY\370^\245]L\205\022\\\245\371\270\332\305\333\206\236Z\031\231xx\202\353\271\357\246\022\200\017\367S$\0274t\020|\200t\324\342\004\307\003.\257\t\307\225\256?\270\035]\225kJf\316i\035qA\267\352\266G\330\236\261\025\026\366\256vp\3169w\213|\215\351\261\303\205Wg?\351g\275w\257B\265\352\273[\374\356\227)5\030\252W\252\025T?\245\205\t\to\350>Ms\226\3701\231Q\362\006\214\367n\237\347\373\314\362\227\316D{\017D"
+	.ascii	"\233\212\231\"\344\303\221 2\347Lpi\006\342\345\013x\226m\335"
+	.ascii	"\205\030\242\340j_\306\221hO\022\021\372q\265\367\241X\037Ax"
+	.ascii	"Nr\213l\013\320\335\363\376d\201\345\307\005\361\346\300\030"
+	.ascii	"2\350G\277\360l\315\272\273\257\321\323\304\246?\243\250\355"
+	.ascii	"z\351G\325\034@9\241(\235\001'\220\216@\337\013\350\b\337t'\016"
+	.ascii	"*+|h\034\315y\373\b\023o1\b.\r\252\\q\177>\204_\rK@vt\211W*\256"
+	.ascii	"\035\223\351\307\357\225~\240\\P\324\316\326\002\2569\360\362"
+	.ascii	"\262\201m\220\315p^943\024\037\366\327\r\314\346\025\243\221"
+	.ascii	"P\023s\245\354\202\201\331\270Z70\232X\3135\363\320\202Y\261"
+	.ascii	"\f\3475k\345\310d\263\026k7\277:\313\330V\347\205H@Yk\317@P\272"
+	.ascii	"\214\313\023\321\221\224\213\252\326\2160A?\372\276+\021P.\305"
+	.ascii	"jUk\035\215\330\3647\203H\007\025n\221\345;\204\340\316\226x"
+	.ascii	",\270\217a\344\223\204\205B\205. \260\202\222)\336S\370\267\030"
+	.ascii	"\002\3212\347\250\377\255\325ja\b/\337\301CZO\216\031\324|\002"
+	.ascii	"r\2603\264\361\026\262-q\t\264\265\331D\\\373\274\226\351r=\257"
+	.ascii	"\327\023\215\b\245\261\243\222\250\343\214p\356\246\033\263\026"
+	.ascii	"\357j\257ln@Q\352\212,\251\310\310[F\217\236\206m\003$X1\200"
+	.ascii	"\330\275\326\n'"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.307.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\215\f"
+	.string	"vWUC\020\2176\035\023`\200\n"
+	.string	"\0021\201\b\340\003\242\256\262c\210!\252(H.\n\233\034\364?\267@\257\336\f!\243\263~\302\334#\304\252.\301>aq\205\022,v\200\225\273\374\006\024uG\237\354-wJ\001A"
+	.string	"C"
+	.string	"@"
+	.string	"\323\247;\233\205\256\311\206\230\274\216Q\330bw+\005y\367)5v>"
+	.string	"/\364\211\271\004q\225\007\276\016\027\001<\221\314\234\244\214\036>v\3606b\264lv\327\221\344}\270\247\333\206`\333\201}\n\001)v=\224V6e\256 a\373\027\333r\344$\335K0\310\001+\032\021\322\200\372\314H\215\366\002\006\335\301\f\353\256\210\225\004\217\366M\374Dw\021\r'\260\373\235\230\354\202\n\214\200\3724x\314\364I\275@\0344\344\353T\307\321\013\215X\272\212GI\205\324\217\270\001eCT?\307gL\327\207\227%8B\020\022\024QT\261\301P\324\017\373rw\327\372y\276\344\227\027\371\365\340\177\312"
+	.string	"\n\217\021\216\223\002\026@\234\b\037\r\343\2422`\227\347\001\326\311*l\334\204+\373\b\3004\216\204K\263,\2664Y\307\252<\031G\253,\016Ti0\336>\030W]\3306\256\272\200\373\215\206n|\332\022\245NU\265A\030\361$?\374&\027"
+	.string	"\357b\310\204\366\343\210\206\0010\034\024\212\021\rA`^D\252#\270\205\273\260\036\fK\3720/\204\177\204Q\270\f\022\006"
+	.ascii	"#\002T\024\340\216\264\264\327\224pS\n\265\007"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.308.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\245\f"
+	.string	"\206\027VC\020q\233\016\277h\242"
+	.string	" b1\300\200`\340\035B\007J\324\216\004T\335\331\221\0369\370[\376\021_\353W\031\261\333\372\311\361\246Q]\345\333/'\340\225\216\273/P\301\r\277\371\227\200G\237\354-wJ\001A"
+	.string	"D"
+	.string	"A"
+	.string	"\324\247;\233\206\256\312z\240\274\027\246\260\306\356Z:\342\335\247\324\330\371\035\036\351Ss\331\341*\t| l"
+	.string	"\360Jr\023\203\305\364\3601\203'\022\343\245\263\273\216#\036\207\233\272\355\006\266\027\330\217\0203v7\234n,\313\204Q\302\3661\266\345\311Q\272\247P\220\231-\211H\241\240\372\334H\2156\202\004\335A\020\353\356\007\034\006\036\355\253\370\212\356&\026\036`\367\223\241\262\013\036p\201\352\323\3405\324gu\001\001\030\224\344\353TGS\216\220xzK\210\223\013\251%\361\302\312\242P\375<\017B]\037^\232 aq\002e\245\024[l\220\024\265\304\276\334\335\265~\236O\371\345M~=\370\277\032\320\202\304\t\3115\004\023F\227\003\221\366\341\251*d\236\020\203\f\364\221\260q\0202\217\213\313d\332\365\300\243a\027c\234\017\b\263B\237K\2630ndq4\336D\031gyl\033ga\300}'DE>}\211R\247\252\332\243\217\370\021?|'\027"
+	.string	"\357b\310\204\366\343\210\206\0010\034\024\212\021\rA`^D\252#\270\205\273\260\036\fK\3720/\204\177\204Q\270\f\022\006"
+	.ascii	"#\002T\024\340\216\264\264\327\224pS\n\265\007"
+	.text
+	.section	.gnu.lto_cliPrintCommandBatchWarning.309.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\356"
+	.string	"\025\r"
+	.string	"\346\227\\G\360\2226\0350\323\236V\2102\335\031\263\b\341\364E\250*B\346cT\337i\373\342\301\177\237\260\304j\032\265\360\034\033\363\316=LlQJ\232\234\321`\243o\320\223\372\251\222\257\224\307\2348\230r[\241\221\336d\357\224\002E"
+	.string	"C"
+	.string	"L"
+	.string	"\037\200\235\032\264o\346\332\354\tL\274\371"
+	.string	"\203\307\356nS\305\301_S\202\376e\016\022\212\250_$>\257\0026h\260"
+	.string	" \246.\003&P\304\270\314%\b\321E\312l\301\356Z\206\342\210\233\336v\212\355\n\366M\0023\205\375kw\327\223e\177\374\351c\376\231\211\324\340\314\300<D\316\256\210\234\037\333\2422V\330\276\307\036O\"\0016ES\002\301\245\375\026w\001>\346t\001\273,\0356\273#\211G:\247\036\037\202\235v\002\337\226\301d\3726\317\270\277v\262T\253\036\255\016\323\345\302$\235\004T\253\035R\254\241\2321}\302\3504\201\251\271A\223#%}\030\223\237\371\013\r#8v_\036\266t^\022\0348\235\323\336\300A>4U\255pZ\036&\312\036Q2N\341>\021\270O\210\003\235h\265\0039\250\r\264\225\372\221P;\255\2520\250\017 h$\032J\r\235\324PE\321jWW4\225\016\324uU\001\205\322\250\364\211Z2\026\222\210\233@\3622{%#\013\336V\032\211H\233\367a\330JBl\272\300\022\022"
+	.ascii	"\357b\310\304\263\241\320\b\034+\343eI\265\f \001-&\354\346\034"
+	.ascii	",\f\327\200V\030\003\030\006\303\002T\350q\227\247jr\212\246"
+	.ascii	"\366"
+	.text
+	.section	.gnu.lto_resetCommandBatch.310.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"\345\006"
+	.string	"\022\f.2PM\324\001\247\234@"
+	.string	"\204Q\031>\315\323\313_\223\320\233g\300\352\205\251E\221\030\326\326 \023U,\314\320ef4\231\362\313\214e\263zQb\367N)\256P$U\032I\225*D\007\t\264V\013\024\032\360D!T\224a\232*\372\204\373\t\006\210\030_J\2116\037|\217[\032\f\274\013x\313\3619\336a\371\026v\270\344\2677\376\345\274\241\274\3137\261q\242\311\321\01639)\3543;A\233\371\207h1\021\275s\343.7\252\354H#ra\373\2171\233dn\310J8\335\n\004\b\312\356\322Yq\354\022\363\257q\201\255\313.\001\nv\327r\353\"\356y\002\333\031\001\r"
+	.ascii	"3\001\2178\003\344\335\003c\240\211\2410AR\244\270&\366\205\220"
+	.ascii	"_\206\b\227n\314\326v\235\026"
+	.text
+	.section	.gnu.lto_cliBatch.311.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\315\001\235\020"
+	.string	"f\236mG\360\2226\035\260$\337\215\276?n\021x\375\302p\366\022P\213\302\016"
+	.string	"\216\224\353\322\253\212@\374\001t\033\230~g\313\nh|\037\215\363\371o\030|\\\2728\331\237\301hh\272\2255\307\372TZ*E\332\356\266wJ\001T"
+	.string	"U"
+	.string	"]"
+	.string	"\b\262S\213\377\324\323\354\005\352\251O6\217\2717[\242\216"
+	.string	"\341A\306\217\335\325&\212\237\216UzMy\362\261\020"
+	.string	"0D\035\313V^\261\020\030\256\234\222\370\345\t;\244\3109 T]\240\335=\314\345\2070%%\026\332]K0\024qg\267\375\331\206`?H*\006\"\247u\332\246\f\362\340\347kX-pZ:\252\211\262\305\224\234-\366\3478\216\243'\213\375\227\037\273\370\327KZN\351\013\370\314\016\030\037\254\325W=vC\214A\026\207\342Xa\373\036\333R\324\220\243\340\322\276\313c\234\376\262\341\004vYh\334\354\212\013\034\324\3368y\320\257a\271`\321\322I\231(:[f\334\306\210\303\312&\207\t\227\235\377\244\326\bI\251\330\300\330\331\335\275~R\345\364dt\3704\2579\361U\270\002I\036$\325S9\261\023*4\255\025\212\034?g\213\023\374\223D&'E\002q"
+	.ascii	"I\337\325\307|\246\224\355\252\016b\310\002\026\215>o\373L \013"
+	.ascii	"\334\267\221\200D&[\327\225\034\030\360\347m\237\251\216LH%\243"
+	.ascii	"n{ \3528\314\334\b\251\204\323LH[\247q\236I\033\371\270ta\344"
+	.ascii	"i_\251\344i\036\021\345\327'K\306z\201\323\322A\231\251\013\373"
+	.ascii	"\310:\261iG\220@'J\326\020\371\230\337\230p \005\205L\325@\344"
+	.ascii	"\001+ \320\202!1;\223\360\277b\314\310\2131\364N\237\026#K\237"
+	.ascii	"\306\274\273\261C\232\f\033\201#Y7\261\266I\355\016\241\0313"
+	.ascii	"\302\272\\^*%\216`p\302\243N\036\265\023\315\333h\310\302\265"
+	.ascii	"\003Z\016\275\320e\030\021PQ\b\2274\340\343\200\345w\265\334"
+	.ascii	"t]!\335\326\n="
+	.text
+	.section	.gnu.lto_prepareSave.312.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\250\001\315\016"
+	.string	"\326\031_E"
+	.string	"\257(\035\200uu\f\006-8\344\f\262\220\214}\220}Q\265\2359\350R\035\361\326A\364\377c\302\204\200\211\242\217v`\n\3516\343D\356\360\377\377\377\216\376ZTT\335>\340\357\376x\252\2374B\266\224)\005M"
+	.string	"I"
+	.string	"L"
+	.string	"\236\237\361\221\336\311\324\271\002\032V\300s^\243\002\236\344v\341Z\334\2709\361B\343\243\020?'\017&\3177!c\334P\255\260\360\241\331\300\342.*\251T\215\317$\022\330\335\267\236(_)\223\343\261\273N\323\267rg\334v\312\266\001\373\262-\252\027\260$C\333EJ]\331\3270\fC+\213\355\264\346ttZ\323\007p\0223\032\0275\3401\244\330=\2051V\246\241\370`\233\304\366\270\343"
+	.string	"\211=\335\031U\206\r\025\342\244\004\214]W\247\254{\357p\234M\213\232\001\251\231\215K\333\201H\336d\001),\020\262\222\222\236\242b\251\320T?^/\b\252\035\240\214\254ev\023\213\272\202y*\202\021\021R\007p\370\325\336v\375x\331\230\344\314\376\313Ex~\007K\030\311\233\256\371#\333\265\353[\217.\240L\006q\204@@]\b\004\3241\b%\b\351@#\221\216\343cQ\003\005\243\356\201H4\352<\256}\\eq"
+	.ascii	"\030\312&&\306\275\365\237`(\02311=\3145E\261\255\251=J\264d"
+	.ascii	"\273H\217\273\273\035]q\013Z\234\b\013\211\252\025Z\004* \320"
+	.ascii	"\202!1\233\003\0132\264\226\024\376/\022\3778\300q\013\213\020"
+	.ascii	"\362\206\031\026\265\353\001+ \036fq\341\r\3720)k\023\275X\371"
+	.ascii	"\313\215>T\261^\261\033\032'\030B\222\3045\276\001\342\034wt"
+	.ascii	"\343\267\226\013\265W\211&\2270\305\350\250\324@x\250\330\032"
+	.ascii	"\366\350\333\005\313"
+	.text
+	.section	.gnu.lto_tryPrepareSave.313.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\335\013"
+	.string	"\246\026SB q\223\016\034q\244\304\025\030\033P\360\214\333\331Y\260a\334\322\003\034\261\225"
+	.string	"+~@\215\351\355\261\221\240\215\3159\342\332+\205\226H\b\021"
+	.string	"\340\201\207\342\0131 \r\005\342\301\313<!do)S\n@"
+	.string	"A"
+	.string	">"
+	.string	"\266\315\240\001\310\232\201\221\r\007UR\203d\305i7^Z\342\332\237\246\346\007\340\266?\013\304\365mFN\".\234\310\023\320B\"\343\335\263\003\027\312\254<v\327)\342>\334\360\266?lo\354\177\004\244\024)%6\324\024\327\303\016\035\013\003\2728\361\370\333 \277\363\305\217\332[\223\335ndP\2148\221\016\034\032\201\225i\237t\024\320K\030>`w\324be7&p\306:t<\206:\264^\200:\fy\321\365\331\264R\"\241z\342k\024T\005&*&\0254D\262\3050m\013\027\362\"\250\357N\340E\f\024\226\034,!\335\354\270\245\236\330\177\273\273\326\221\375\322_=\3360}"
+	.string	"\013L\314\bY\306\301\260\nY\305\351\2008x\320\301*c\232\020\b\330\025!\004\244sa\237\354\322`\354\221\300\371\\\024<\236\317u\211{\035\371\335\317!%\304\006\026*\371k\224\365\232\252A\355\221AC\317\312J\355\tY\020"
+	.ascii	"\3571\302\020\232Q\007k-\300.\2540TS]9N\234(\272\f6\277L3\273"
+	.ascii	"A\221\252\tV\313S\3154%\036\215A\355\001"
+	.text
+	.section	.gnu.lto_cliSave.314.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"}\n"
+	.string	"f\323G? \3458\035\340\254#\320J\034\201\231\270\321U\204\201\207\366\020\001\022\017\227+\214\277'\333\217\266\177 \366b\022\023\3320\031@\310\037"
+	.string	" \003\002"
+	.string	"\005(\250\020:\350\005\363\006zjD\356\224\0025"
+	.string	"6"
+	.string	"3"
+	.string	".\005v\327S\222\213\327t\212\376_\337\214\244\351Z\007r\325\026d1\004\bH\224\326Q\235\214\177}z\220\24795\017\273\3539\222\037\367v\333\020\266\035\354\037\004\273\252\003\0066\266\311\240\330>\307\366,5\0020|\332W\371\212x\327\306\013vW0\260\335\262\301\n\3357\227\357p\337\272\033p\337,\332\003ta;\302\205\250:\0020u\006w\225h\021\200\2323sS\325\276\300\230\037\257\t\251VJ\f\245&\2734Me\331\327vw\255+\373\345\277\335\365\253N\277C"
+	.string	"\300b\021\271\311K!\222h\004\002?M\b\374D\200\300O\343\317#\032}\036I\364\001\275\257T\341y:\016'B%\317\"\fK\036\247\334k\253\253Tk&\306\241'm3\355\220b~\264\276d&\013\022"
+	.ascii	"\357b\310\304\343\240\241m\035K\205e@\265\t\034^]A1\254W.\f\255"
+	.ascii	"04(\004\227\201\021\001*\312\270\3131\233\244\201\251="
+	.text
+	.section	.gnu.lto_cliDefaults.315.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`U\002m\025"
+	.string	"\366'\222L\240\226U:\020^\370\325x\353\027\271\036o\023\322\t\271M\207$\037\251\215\315\232\021\2510\246\371\016\022G!\216\367\343?\035\264\326\354\242\006\037\2615=O~\363u&\344\203\327\202W\344q\007\247N\214\254\231Fl.!\204\220-\223\fy"
+	.string	"t"
+	.string	"\201"
+	.string	"G\267#\235\270\200{\205~0\335\273*\340\030\364%\257o1_\242'`\276\344\033\363\022{\231\256\013\363\007\354\t\217\367^\225\215\361\333O\263$m\337\370"
+	.ascii	"T\334O\364w\263\227Ry]\2320|\302\334\023\017\365w\222T\211\352"
+	.ascii	"\035aQud\203\335\261EJ\335\265%\021\030\201<aQsd\013\220\215"
+	.ascii	"\364\301\367\217\272\353>k\356\275\334\251\032tF\317\314%\230"
+	.ascii	"9\306\334\255E^\017\331\001\025\331\333\314\333\020A(]G\361\331"
+	.ascii	"\246e\246"
+	.string	"\365\364\323\333\007\217\032\211r\217F\235\3051\257\270\266C\314'\357\275\227\255\020\363\221\376\363\353o>\351l\311\346\266\315_Y\320\243\b4\032\376\216\354\323z\201\246H\271\305\262\211\350I?\363\037\344\0243xp{\222\215\274*.\216IL\321\016#\360x\357:\363\222\035\240\275\232P\222\340\315|\340\003E\2328A]x~\323\203\330\3704x\302\252\237\256\314\227)'\037\321\310\211OO\341\002\315l\001\347E1gq\374B\304\360\242\001\345u\220y\311\314\301C\351\273\301\242\250\263:\226\220\b)\007\364\225\356\343C\214\f\020(\217\202\314\313\3232\263Z\375\224\277\344\244^(\306\035\013s\254\250A\332!\236y[\024\301$+m~\307\274\322\227^\350\275\274\247\"P^\215\314K\230\254\237\266=\340#\302\021L\253\361\364\260t\\90\262\032\314N\354U\253\271h\256\231\013\337\340\2542\\\300\201\211\260\252"
+	.string	"a\303\315*"
+	.string	"\313b'm\347\245\023\223\331\270H\260h)W\354\305\343\202\261nr`\255\223[4/\236\226*\366b\301T\255\031ME\323\302\262\021\256\231\252&\223\315T\251\365\276\306\307\346N\003m#\241\2372iq\177\020/E\317\264C\3542\374\021\351\021\355\205W\031\376\220z\304\376m\246\265?\314l\255\305\rg\004* \200\202\231I\353\203\"\354c~\004\026B\343\021J\005\2000\220\\\366\346\332\230\331E\234\366>\342\"5\333`\323u\023\276_\003\207^g\013Y\270\333\211\211\030\013\031m\221f\303\257\366\227\265o \002\262e\260\023\365?\0020gjwE6\006\212"
+	.ascii	"\261\"j$)\336\245\221$\273\266\327lAD\001"
+	.text
+	.section	.gnu.lto_cliPrintVarDefault.316.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\370\002\255\027"
+	.string	"f-\240E\240ZQ:\304kl\237A|\354q2\276\304\314X\r5dR\215\357\304v\022>\320\322\234Y\305\312t\373\377<>g\272\377\356o_<\247\364\340<\"\217\034\024\256\023N\332\020\351\\\337\\\343\223F6\2212\245\212"
+	.string	"\202"
+	.string	"\216"
+	.ascii	"I\023VD\352(K\325\234\277\b\227\2760\352\217\307\201\327\324"
+	.ascii	"\001\215$\\\3557\335\351\366\247\036\0270\247\222\231\2519\177"
+	.ascii	"\023\334`\274\364\357=\342\345\370\001\342\245o\266\233\235S"
+	.ascii	"\323\210x\364D\024e5\347\224m\222\337.\303\325\233\177\340[\274"
+	.ascii	"\036\356R\310\303\020B\325\0279\256\336P\330c\344\204\307\323"
+	.ascii	"\323\351\206\n\324\240\231r\251+\220\336P\270\240\310\221-\007"
+	.ascii	"^\177\364r\252\254\016sN+\257\027\344\026o"
+	.string	"\273\205m\024\366r\bS\227\301\317\362b\306\330\204\207x\371\375\222/\230\204\344\364\344C\257\354\037N\027\211\375p\3169\275J\366\237~\002\217\272a\207\272_\377\375<-\265\213\245\336\271\272\325R\217,5\253\245\026G\265d\251C\251^Q\255R}\003\026\272\214i\242\"ute\327\374\246\321\025\235I%\301<y\324\017e\037\213/e\227/`\270=JG8}\023\367FB\024.TMV\030\306\313\037h\227m\250\035:\213\002\347\231C\322\320\342l\217x\030\022\255-\240\246hM\025\227a\362\346H\250C\204\255\006_\220\t\201\212;\256\211\023z\036lc\273\305Y.k\307\r\317\354\226r(>\305\332G-\221\033\256\270\337-\345\364\312\273r\3033)\356E\005\227\026+D8\276 \024\230\362\254\315\302\205\236\267\253\245H\312\020*\335\342\264\227\246\210\314.\022\177\207\370\332\n\276`\022 \033\235\316q"
+	.string	"\325\265i5=\357\2651\335\342\374\325\3358Du,\343Z|\306\031\216m\250\t\331f9b/\0346\241Y\214\032\210\033\266\231\220\215\032"
+	.string	"\0315\264&d\233\345\220\265\237Y\t\030?4\226i\024|l4\031\r\237\331\217\214\026tCF\241\307@5jA2\034@@A2\327o>\234\253\004\274\200\")LT>6'\035\250}\233rc\242\021\231VU\271\305\231\201F\270ky\226\300\3327+7\247\030\321\342,wg]\3736\273\245\034\231\235\275\034_\260\t\311)\246\255\365\305x\b\023\370\202J\220\232\346\334\235\367a\334}xpi\207\020\241\0010 \200\202\021)\244\007\333\347\373`C\264\207\236m\237N3\304=s\003{<\260\r\037\026\\\026;\006H\3209\224[&l\313B\346b"
+	.ascii	"\336\202\302\2071%\201h\276\206?u\201\033&\231\363\b\030\320"
+	.ascii	",AC\220?]\343n6. \305\353\201.L,h\226U?\346\357dZ\373\232o\337"
+	.ascii	"n\305\324\f\367^\370\303\002(4\300\221dM&[\023Q"
+	.text
+	.section	.gnu.lto_cliGet.317.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`p\007m-"
+	.string	"\372O\300\021EP\036R:\213\201gD1D+P\332P\007a\006\017A\2408p\360\252\303Q\353Q\255\315\247\252\2525\002"
+	.string	"\362\006\233f"
+	.string	"U\013\001\f\340\244\304\201)\235\004\2528\306\020\313\224\342\200~\373\337\032!D\356$\003\t\001\364"
+	.string	"\021\001\374\354q[\345X+\340\310\263\331&\332\266k\037\376\345l\354\333\270\f"
+	.ascii	"\343X\033@\371l\316\211\266m\273t\225+\374\256&\245w\315G\033"
+	.ascii	"\246_\346\247\275\013{\265\037\017\320\266eoum\273\006\201\025"
+	.ascii	"\374\256\362\332\215\326\253\277\027\255W\231e\306\323m]\033"
+	.ascii	"\2666\327d\201\311k\333\266\251\233\260\360\262\037\"\016\205"
+	.ascii	"A\340\317\267\252i_\226\357\366\017fj\356\222\313\342\207\304"
+	.ascii	"NL\037D\305\374\371\233.\261\324\210\213J\362nOp\245+\354\016"
+	.ascii	"S\337\221\213\312\337t!I1\350E\307\\\356Wkyu\205L\230`\017& "
+	.ascii	"c~\035\270\202y\231\375N\344\t\246\324C\306l\336\347\025\\f\255"
+	.ascii	"FP\312D9YW\263W#W\323\005[\364\314\f-\221\251\201\347\021\212"
+	.ascii	"py\274iZ\324\214\223\3637]_)\223\234\263/\341\022\353\366\345"
+	.ascii	"\036|6\363\350!c\202\375\3728\264m\3137\271d\236\211\316|\"f"
+	.ascii	"\226\301\274\372\t\314QO\343\264\300I\333ba8s4(\322K\271\312"
+	.ascii	"*V\254+\326\253j_\356\352\227\327\035T\254\213\232\361\356\265"
+	.ascii	"\233\335\221\331,\252\272\006\\>\234\213\027\367"
+	.string	"I>\334\203O@u\201\242)\031\030\275\246;\215\321\255Ayf\007\275\315\257\273\230'\276\024\206\222\272OJ\255W\273Lr\317\373\366\263\n\031\357\036\017/\363\024\215\373\344\273\241p\302\306\002E\257\272\310\274vu\333\311|\fN\364\360\270\313\230\225\034\374yF\372\332\217\340j\377\201\365r\321\343\316\304\241\020x9\370\273\f\\/\377\336v\366\335\313\353/\253\276\313\351z\271}\227\357z\371L\023\324@\323\264<\233l\372n\255\345\332\033\324B\3251U\036\367\267\375\3177\363\231\345X\030\247#m\337Z#\223\311l./-OD\230\3031\013\231\307\337\370K\224\177\204<\230\205W\357\301\334\215\205\314\001r\277aJ4.P,<g\016\305K\b\017P\020\353dR\022\306\347GJ4\260_\204\373\271\347\261N\006M~H\025\r\256>a\243\240\025y\364C4&\264x\t1\336\2231N_;\373\360\375"
+	.ascii	"\330\262\322\216\351\341\357a<\277\337\217\326\253\003Z$X\020"
+	.ascii	"+\317\303[qg\332\266x\261\233l\225\256\026\245\\\306\260n!.\360"
+	.ascii	"\243\365\327E\3157\313\353\352\35613;\345v\330*Z\3528\021\261"
+	.ascii	")\007\345"
+	.string	"\3219^\217\036\272\332j\3332<+\324\340.\035\251\01743{\306f!\004Ev\221\025\\\265?\3678\354\026\002s\332\026\371$\313\345\207$\321\200\355\302z9R\236\t\202\036\273\270r\007%\345\031 \350\261\232\324IS\333\311K\037v\n\257\273:ll\370nz\030=\tuBj\203\324/3\243\243K\032\271j\203\376\320I\333\311>\326\265\255\330\360\260\256\036#\270\bZmf\020!\356\223kg\030;\362\210\253)\301`N\333b]\340\f\302\251\303\211\244\017#Lthqb\004\221\317I\032\222p,X\247^\343iG\343\210\262\361DEU\345!Jj\006T\216'*\")\033S5\244\250\236NDQA\371\030*\302T\r\250&\033SOTMPV8\232\"\030q\325\r)\253\246\034UUVM\3025\343\273L\211\026\bj\354\253\241\r\367oW\213=f\375\220+\202\260Z\267\251D\363#"
+	.string	"N/\215\230\n\207\355k-_K\360\272s\307F\347\"\017\004\006\234-\273<\366O+\277\356\036\207\330\266\354\264\3641\336=v\353\205\333\215\224hh\240\321a;\231\230&\250\364\"\317f\236,\272\313Z\234\006\205}\267?\213\356.}\310L\354`{"
+	.ascii	"v\220o{\213,Wz)\314.\331!\354\220\365*\260[\t\b\215\227\361\356"
+	.ascii	"=m\333Y\004\205\223E\b\320As\332\303\026\266\026\363\257c%\266"
+	.ascii	"R7\026\263\271\275{$\310\364a;\350G\315\322\270!\305,\\\244>"
+	.ascii	"p\204m\242\245Q\270Hal\222\200\220\250A<\347\020B\n\225H \"\005"
+	.ascii	"I\223\016p\002\221\251\253z\021\200\301CF\233Ba9\013\314\327"
+	.ascii	"\213'\370\226j\346\355\3645yJ\013\b\367+\013l@\217\300\2252\354"
+	.ascii	"\212;A@\205DE\237\177\217\364\203\303\003\376\225DbU\230%@\273"
+	.ascii	"\363\n\213y\271\021\367D\b\234\"L\205\374\221M\316ql\264=Jf\230"
+	.ascii	"v\320a\313\027\333\316\024!\tK\207\373\307\267\331p~_Tj\024\343"
+	.ascii	"%\247%\341\225U\315J\201\274\316]\265\355\326p\344:w\326\322"
+	.ascii	"gu4\n\313\031YK\207\tA\262\373o\030\265\213\226\363\2424%%\244"
+	.ascii	"\322\317\026\023?\001\275\306\263\327\221\367\032\037\211\264"
+	.ascii	"\210\361\213+\f\004\263\367\274%\232N{\203\311F?9E<\375^x\261"
+	.ascii	" )\3759\331\025\0011\035G|crR@V\275C\330\261~\367\221\024\003"
+	.ascii	"6\013\221\366(\247CT\263q\003\313\210\230C\247\3702\327\031F"
+	.ascii	"\227\360\231\231\353\331\016\353\226h\250!\214\264\326\2211\031"
+	.ascii	"\224\341V\246\005\364_Qh\304\336I\233\201\374\024r\367\361!\206"
+	.ascii	"4\244\030\317\244\227\273\232\207\001\374_\b\246\002"
+	.text
+	.section	.gnu.lto_getWordLength.318.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\033\001M\r"
+	.string	"\306\330YC\020\217(\035\243\007ILH*Y]\030h\026\334\320g}1\364\320\271<am^E\345\216\372\300W\233\306YD\222kk\321\313\n\352\232\001"
+	.string	""
+	.string	"\202`\324\n\247\003T\205\270\202\234\035\032i{o)S\nF"
+	.string	"D"
+	.string	"F"
+	.string	".\361B\n\245\304\314.\207)\006\277\314\016\237f\346g\330X,N\232\311\341\323\230R4\b\320L\317\243%\003s\325\023\245\225\362m*\327\253~\305l\254\325ISyj\020\354\256\363\244Q\270\343m\213\3306`_\024\334\017\337K\253\246\363\334}"
+	.string	"\003^t\020Q\341)\272\335\224\016\306\252\2000\033l\217\354"
+	.string	"6\027\303\221i\037\304C\214\236*9g\227\305\304\313.\307a\002\327\241\271k\304\303\353\031\361\260\300\201\2213\335\227\225/\241>Em\234$\246\336\305\210\026\023\262e\237D\004\222+{I<L\035\331X+\224\005\322\333\335}\316\236\021\237nT\302\306:q\302\241\224\235\256P\2304\325\026\2333I\017\227\226\214\225\305\3368}=\365k\036\f>\nBD\037\361\343\021\001I\020\"\372\270\334\351\3604\350`\037\317\002\007X'\364"
+	.string	"\353\3200h\004$\204A"
+	.string	"\201B\230\271\375{O\177\351\006IKV\275\364(1H\331Y\243W\325\023\017\245\354\240\266\370\252sfV|X\321\215:\032"
+	.ascii	"\3561,V8814\323 \321\206\330\212\367\017%@\334\035\353V\220\020"
+	.ascii	"Qfa6\nD\264\334a\323*a\214P\237\205\300\b\030\007\206\005\250"
+	.ascii	"\320\202\n\002\267\351T\215\034\024\345\3275\237"
+	.text
+	.section	.gnu.lto_cliGetSettingIndex.319.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\301\002\355\026"
+	.string	"\326\253\230H\300VQ:$\006\020\220\362\277<B\276'(Q\240\n\350\307\030\013\026\223\222$\310\214\377\223\034\340\327\262T\177\207'K\255\362\231\324\360\357\005\222P\371\001\204\354g\0203L\304_\t\375\206M\023Z\374\267F\310&R\246\024\206"
+	.string	"{"
+	.string	"\204"
+	.string	"?U\022\250\332\037r\"\266\377L\\f\316\240\244\2459\177\013\214"
+	.string	"u\351\037\352D\017b\363\216\234K@2D\037%\024E^\346\374\271\002\234F\274\324\013\020/\267\206G\3359j\024e\270\272\343\337\216\272\224\026=?\342\321q(\306\305\001:\037([f\270\350\271\f%\b\361!\264\300\240\223U\357\204\206\255\236.\254I\272\362z9\335\037}\303P\223\322\256\027\343:R\230sZw=\027w\352\266\177lO\260\225)\277\233& B\222\303\033d\267\254f\035\370\307\374\367\257\216t\253RV\217\017\336bJ-Q\352pTo\250\326Q}"
+	.string	"\004\262\b\001{\336\024\234\223\305\023\230\351$\227\3408\322\037\274\332\267\177\304OB\322\321\231\002h\316\3000\362aj\200\272\021\377\310\253K\027\335\310\366 \211"
+	.string	"8\240)\363\302\310\347\211\2269\177\n.\315"
+	.ascii	"uY\023\336\266\331+\333\241\332\r\036\330\016,\341\2353\313\263"
+	.ascii	"S\313\332\347\030j\352bV\215\025_\344\372\274\373\215\001\022"
+	.ascii	"\263\273\005\212P\204\301\351\323\277\205K\224\240p}Vp]Z\221"
+	.ascii	"*9\375b\032\375\252v\2656\207\016\372\235n\215no\236Q\325\332"
+	.ascii	"\036>\350w_\003)z\0209\345\366f\373\365%\230\003\033s\346 \330"
+	.ascii	"\246])fCe\316\\\204$Wr\023\376\306\245e!\304\357.\375\020\342"
+	.ascii	"\245j\237t\0134T\\\3711\004\247O;\305\n\360\310\256\317\0161"
+	.ascii	"\234\327\205\233\231\254V\213\351\254d\007Q\273\231\305D\210"
+	.ascii	"1\234\327,4\314F&\002\346\232\311^8.\030M\307eC\343\234\0211"
+	.ascii	"\232\253\226\223Cs\255~\363\033\344\027\271\214\323\024!?c8\343"
+	.ascii	"4\205\b\213d\355\270\2745\005\334\362\350@\255\317,&\261\265"
+	.ascii	"\022\210\232'\256\334\nP\302\225\3733y\023\f\341o8\203\006\361"
+	.ascii	";\r{@\250'\234s\316q}'!\212\333\332\037}\305c\250II\367\303\243"
+	.ascii	"O\332\304\310\216%1\f\305M\0053 P\002A\352\256\036\317\030\021"
+	.ascii	"\321\316<\025F\314\373\212-\304F*\361\256\244V*Y\315u*\372\355"
+	.ascii	"\222c\211]\304\2472\030\227\323\020-\270E\227\263\312\032&G3"
+	.ascii	"\216\240\235Z\215@\033=\021\315\035kc\201\232\231jv\360\227\340"
+	.ascii	"\037\333\205\362%\376\273Fk\003\024\202\231\327.A\002\237\b\017"
+	.ascii	"\334U\247\\\317evc\243k\\?BOj=\344v/`\321\324v2"
+	.text
+	.section	.gnu.lto_cliSet.320.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\f\"}\235"
+	.ascii	"\252\002\2519Q \210Q:\303\001\027\346[\336\374\0210\324?\314"
+	.ascii	"\2352\357{\324\306\021o\367w\342E\300Y^\341\300\250\317\327q"
+	.ascii	"\007\362\247\245\r\366\341\361\317\303a\316uE\3164\363\223\276"
+	.ascii	"\373\372\220\355 \243\033y\362q\030K\003\265H\034E\357\223i\210"
+	.ascii	"\020)\223\f\220\0034\003\213\003\274\307%\257\361\310[<o\377"
+	.ascii	"\360\262\222\367\217\302\302\253\256M\313\334\022\300~\023\267"
+	.ascii	"\032I\274\263\352\031W\300r;\377\235\377\360G|\341O\347\177\341"
+	.ascii	"\237\363W\377\276\377\357\007\374\337"
+	.string	"\374{\177\233_\315\277\346\317\373\321\374v\377\230\277\314\317\302\017\346\367\362s\371\347\356a\367w~x\304'\362\272\311\351X5\001Q\240S)\3255T\310\025\215gn:\005M\r\025\f\265\350\030;O\202Jj\3213m\205jHC(C\302(h\031up\307\tsev\202\233\254JE\231+{\253>\316^\316&\253#@y1\255C\275\342w8\017\004\244*\233+\353r\202\3743a\256\314\253\272\004\271wG\232\246\206qm\205n\366\324M\276\031\002c\032X\345\342\273\013\233l\263w\314\254\270\025L\005`\265M\313\212\334\233\3234\r\244\306\021\301{\336\3656\211\346\rm]\327\2445{\207|~!\347\306\352\320\326\365\253\ny\243\232\275C\232\302\251\373\362qf\337\002\232!\305\265n\275B\362b\352W\330V(\302\230\223\371\335\315l\222\205\036>\253\336\332\003\201\271\261\256\002 Wx\005\234/\303"
+	.string	"\237\247\331\352\303\004:\266d"
+	.string	"\310\033}\330\t\353\001\353\325\023\245\251_\334\256h\341\274\035\220\342\032\266>\3454M\375\306\264\025R\240\302>\314&\301\004)\233[r\350\364\272\375\227M\336\350e\210\tsK\356D\200\2741\303\345N\267I\n\274\213\363s$\370\\\231\255\312\022\240K\002\037@\336\310,~y\344\342"
+	.ascii	"^\245f\353O\327\334\2228\325u\215K\272q\233v9\316\001yJ\347\335"
+	.ascii	"\267\335\315\3717\253+\327\025J\335\230u\215[Z$\344\215\033\367"
+	.ascii	"\240\343\215\310/\2177\256s7\260\3271\353\330q\t\234\255.\205"
+	.ascii	"\353\2722\365\t\313\263\035\366\211/\306}G\024\235w\321\242\211"
+	.ascii	"\305\n\025)\230P,)%\2350\301@\t\022#\220D,\020\202\t\342\303"
+	.ascii	"\221\207\016FEDCBA@\313\037\245O\017\207\r\032\222\0310 y\216"
+	.ascii	"\306b\263s\237\001\354y\027-x\234\224Hj]zM,\340|\305\337\315"
+	.ascii	"\370\261\212\024L~y\214\302\257\310L\373Z\303KT<V\242\252\341"
+	.ascii	"\2444'~\225\346&Z``\357\353\f\257h\270\304^\332\327\033\223\b"
+	.ascii	"\024\303#\242\034\ts$\025\211\325\2665\021\200\013\250\tq,Sa"
+	.ascii	"\312\\\"M\355\214\001s\020*|\361R\007g\374\020\370\037\030S\303"
+	.ascii	"\2720?J\333\373\302\302\036\212\315\205\316\314\367\276\372\212"
+	.ascii	"0\334\264L9\265\215;D9\262\345Fl/b[c\"\266\242R\332\227\026\036"
+	.ascii	"\242\376\007i\032\270\345BW\036d\305\205+\f\264\344qrr\344\357"
+	.ascii	"?J*i_S\330g\357\013\205\"SO\n\367\204pr\304\357\034\376Z \343"
+	.ascii	"\rec\254\301\316\255\312Q\203\223/&G\rn\324\224l\b'_\177\306"
+	.string	"d\323\264\257\332f\350\344H\3403|\357k\211\031%\214\241\270\024\003\343\346{_\200E%7jJN\367\020i_b\214,\362h\031\271\362\275\257\300\342\213:\325\025\376\005\312<S\023~\374\227W\360\244\013\021\353\315\0270\023n\324\342b\361\004\231\032\b|\357+\254\030\304\346\t\234$X\026w\361D\225\f\035\016`X\305 #W\242\247;s\201i1\3638\255\353\272\034\005;\362m\340\273E\rv\337\264{D$5\370g8JS\216RS\020\t\375\231\0227~0\330$<\222\262m\321\373\031ds&C\237\255\216\306\320?\344\360\262\270\316\023\f\235\201\317K\314Z\330\fFv\323N\363\220\037\325\321L\0054\262\331l\332\227\347\304OO'\026?\n\325&\244lj*\356A?5\221i\037\0354K\f\366\240\267\234E\370Q\005\364\315\034\250\312Gf\214a\325\001*,|\301\220u\017\272)\347\367"
+	.ascii	"\307\370\336\0359\350r\032\341G=\3505)[\022=2\202}i\310>\333"
+	.ascii	"\036%\307\233\265\261\216q\271*h\236\236\261\346\330<Jx\t\003"
+	.ascii	"\212\257\262N0'\022$\307\033\217\2154%\354\212\023_\\\327u\345"
+	.ascii	"\351\263!\307\n\372f\375/O\266\231\346\275\201\222\265\340]\247"
+	.ascii	"\tN1\rl_zX\375\334\025l\3543\351\017z\3279\346,cB\373\271\305"
+	.ascii	"6\366\267\020\371\352\035t\261\253\246y\211[e\2608q\231\270\373"
+	.ascii	"b8\211\363\311\020\365\f\t=\231\023\234S 0\323\352'\n|\304i\005"
+	.ascii	"\205\0130'\226\245\257\356\241']\211ko\313^AHP\3275\353\321\335"
+	.ascii	"m\316\341.'\226&)\353\232\365\342\306e.\226:\247\305W\271q\235"
+	.ascii	"jQg\n\307\033\317\244\037\346\030\356L\363\342DK\270\342\304"
+	.ascii	"n:3Z`G$~\035\027q\256"
+	.string	"\rIYW\350\243\316-H\350\335J8\335\234p\374\350\026I%0\250\367BJ\235\252\261\317\366\304;8r\037qY\253\371\245\003d\225\275\003\332\030\206K\311\025'2\210\267\024\232\024\177*_5b\222tu\237-\t\307\016:EX\2347r}Y\\g\337\0354\273\260\205x\305\211\013\2029\350\335\0314\370\321\367\351\276\034\303\347\246gX\315\352\347n\334\223\373l\367\2172i\343d\033\312\356\367\276?\273\331\301|\317\344h\276G\362\274\357\275\336u\256G_\344\325\357\267>\347\373\254\277\360\375\363t\276\315\027~\033\360\277/\021!\336!\007\374\n\271\235\257\017%o\217\337\371N\375\360;\302\021\277\"<\361+\245\344\rA\210w\207\020/\b\037\363\215z\231\257\216s\371B\235\313\367\351,|\025\360\267\377\203s\371z\360\271o\007\217\3739X\362^\360\276o\216\377}q\374\315\367\306\367\276\001x\233/"
+	.ascii	"n\367\265q\273o\215\333}-\270\227o\005\347\245\261\344\245\240"
+	.ascii	"\210w\306\222w\202 ^\031E\274NJ^\t\202x#8\362\3068\362\302\020"
+	.ascii	"\342\205`\311\373@\021\257\003?\274/\212x\033\020\342u\241\344"
+	.ascii	"m\261\344mb^\026A\274+\224\274*\224\274)\224\274LE\274(<\360"
+	.ascii	".-y\225\224\274IJ\336\023E\274&\200x\031X\362\226P\362\222P\362"
+	.ascii	"\216(\342E\352\300+b\311\273\200\021o\210\"^\246\020/\210%\357"
+	.ascii	"\007#\336\243\"^\017A\274\035\204x\215\202x\213\226\274D\347"
+	.ascii	"\035\"\342\025R\362\006)y\201\210x\227C\274?A\274\312%\257\317"
+	.ascii	"\222\267'\210\227\203\222w\203\020or\311\233\001\210\027\303"
+	.ascii	"\222\027\031\304\313\003\024#\232\304\2106\272C\352\017\236\353"
+	.ascii	"H\341\312\352\300\211\205\020\321\333E\254\3504\233H-\320\"\026"
+	.ascii	"\350\017\244p`!\232\331\317\352\"`\210.\032d\366\005\317\201"
+	.ascii	"\322\267C\302?\360lE\372F\310\004\321\333ZV\325\036\037\250#"
+	.ascii	"\340E\347|h\020]\004\334\200\211|h\004H\337\362\364\216\332C"
+	.ascii	"\177\253\213\2039\372\250\215\272l!\362\340\250\263\346\t\374"
+	.ascii	"\250\207\276\234s\241\364-\215^\326\3405\274\255\240\367\344"
+	.ascii	"C\r}\200X \372l\373\271,\027\230\330xv\226\3570\030\264\302e"
+	.ascii	"\303\227mA\243\263[\204\200\320\\\331\224*"
+	.string	"\004NPF\\\236\300\223\r\001\016\"\335U>A\264&\322\017SX\220J\002\024xN\323\n\f)r\232|G\237\260;Y\252q\204\364\003\177\001\237\2219\303\267\25359q\206G}\266\033\350\264\\\034\255<\017}\266\022(1z\327\313\346\306\002\231\374\306\317^\302\334\030`"
+	.ascii	"\214,\270\327\334\030\225-;!\356{\215\346\272\321\035z\003\035"
+	.ascii	"\2715F\335\241\217\205\001\251\214|\302\b\265\300\3713j\021\260"
+	.ascii	"\274\b\327\336\226\216J\206\260C\237-\017q\337\271\210\251?\365"
+	.ascii	"K*\037\036\"\321\036\310\361g\315\265\305\241\032}j\336\232\242"
+	.ascii	"\037\310q\213D5\332\002\016\373\215~W\367\264\231\006\022\262"
+	.ascii	"Q\321"
+	.string	"\215.\212\363&:\207\003\025\205)EI'j\rWv0T\017\2515S\340G\211\3728v\2459nmD}\266wZ9\016\265\206+r~m0pZi\256\035o\034\352s)\t\352e\013\365\241Y\220\3374G\240\016\352C\323n4P\037\303H\200\3314\327\214?a\204mM?\326kn!2\n#D[\303yM\267&\\s\002M\271\343\215\313>\365\306\2640\30262\267\267803\303\241>[(\274(A\347j(<(P\322\001\320\\+\364\323\347\352b\227.\254\246I\347B\212\027N\323T\001\005\265\005B)h\316\374t\007,\257\301\240\266\203\320w\201N\342r\004^\307\227&\316\020hy4\021\340\362\243\346\256\270\256N$\250r\341\304\315\200\225L\255~*\373m\246p\342l!\356\037\227\027\245O3\233\\\236\232\3734S\037S\200\013\227\217W\367\340\255yO\367\360y\271Y\013;"
+	.ascii	"\237\315\361\316\346y[&j\327$\263$\335\222Do\003\276k\232\361"
+	.ascii	"\352\353\035\250\216\317\214\261HV\222\236\f\370H:*M"
+	.string	"\023\317\001)\333\240\336\006R1\344\200\2449\364\367\344\362\262\270N\036\177!\241\311\206\2754\371\212Fa\203mn\254\243\343\320g\013\033lC\346\366\266\241\217\244{p\013\021\007g\370\336\035\367\3157G\250\276\346\037?\272\241\337\302Y\214\224-O\017\312b\252P7\364\331\026\177t\034r&lp\213\\\037\317\020\265C\335\215)\254>\371\220\307\f\332\241\006\270\345\270\257,\212\270m \021\235\027\310\230\260-o\211+\224\300\262\026&R\312\252\002P\257M\313j\226e9\205\rD\256\353\363d\373\243\343\215@+t\314\n\032\247\355n\340O\306\321\325\304\215 \024\325\314\266\030q\257\367\243c\262A\350\345\2550,N\004d,TL\324v\305\211\305H\0246hF\326V\205\255\0049\336\230l\003\204\r\242\221\271Q\t\202$\002OqbA!%\252\033/Z\202\216\316\320\\\235\372\321\221\310\362\302\234dK\203"
+	.string	"7dl\300a\231=\252\230@F$\367"
+	.string	"\032\b"
+	.string	"\007\r&\006\027T\300,\261T\202\211\301\005\314\f0\240\241\301\f\031\030\310\2501\203\251c\304\222\n&\215\t\230\032d@"
+	.string	"\034L\013r\330\300@\203\fR\354\022/\r\0342r0)\260qC\306\0069llXf\f&\220\021\307e>"
+	.string	"d\007\017\251\252\252( \314*\036Q?~\004\231\261\214\232Z\200\217 \030\236\252\236t\024Ix\372\361\343)\371\243J"
+	.string	"SOB\216\033\364\330\250\312\240#*\004\250\252'*\036\036RTM\344\211\252\215!T\355\340\021u#jj\001OR?\236\204\374\020\211\322\301C\312\250#j\007\217\247\020fD\005\231z\022\242a\352IHK\235G\324T\377\250\362\301\200(c\024\017\251\251(\252\247\034:\250\240x\026\n\205\324\024\024\023\017\251'*&\250\037@\230P\004m\017\037Q?\230\252z\364\370\301\224\214[\337P\326\351\252\261Np\001\306\034\264U\236\025\0331)\037\034\221\227#\324\026t\232\372\214\243\\\260z\243\326*X\365)\375!\241\034E\312\207\246\2475\375v\240\302\202 \013Nz\024\337\230\036\023\323\350\237i:+@\2538H(+i\n8\255\030}\332\344\270\3200\242\211\315e!s{KF\311\260V\024;\324h\036\301\324\217A\247b[v$\230\372-z\250\3216ltO"
+	.string	"\214\332S\220o\257\265>\221\246~zm\205k\334j\342f\356\364\344\303\236+l\016UP"
+	.ascii	"g%\247\311\252\217\202N>\t\313\303zC\207h<\254\263%E\237iq\217"
+	.ascii	"\226\352\031\275kEhe\b\304lF\037@\272'\242\232\3054As\232\234"
+	.ascii	"_\217\346g\263Y\331AZ\035\"\241wS\342\306\t\214ef\320\264\267"
+	.ascii	"\350\036_8i\232\240\2201B\313\350\277\240\306e\367\225%\350\244"
+	.ascii	";=\233XL\247fN\265\004\375,j\\K}\266\033A\263\237\\\336TG\320"
+	.ascii	"\r\005\321x$PP\351D\322\215\252n\222\2101\241\364\013\232+F?"
+	.ascii	"M\316\317G\303\350\030\335\207[aXO\300Q\204\206\321\254E-\232"
+	.ascii	"\270U\346\202\366\321\207\243\026\315Kz\240\217V\034B;\320R["
+	.ascii	"\315\007\372jf\320~: \242\210t/MObbbb\213\016\241O\3604\371\023"
+	.ascii	"3\321\344:\276\350#\013b]\260\310\3655\232\363\253\311eu\274"
+	.ascii	"\361E\033\205\341R\322@_\216YV?\231\201,\337Q\201\032\261.j\205"
+	.ascii	"w\321;\272\332\nU\214*\315$.Ph\362\025u\251B\306\204\312\024"
+	.ascii	"\027}:b]\252\220\271\031\351\023\242\234I\201\362d\352n\r\254"
+	.ascii	"\233P5@E\322f\315$M]\326\3443\372\210u\201\322d=6B\367\360\205"
+	.ascii	"\2251|\273j\021\272(\325\2429\220\356\221qb(\251\346\365\314"
+	.ascii	"&\335s{s\203\244\004\216N>\351\3344\021\344\273 \211>\333!\350"
+	.ascii	"T\032m\241\271\262\260-\273\243\244\347h\256\017\320"
+	.string	"it\313\016\351E\232\013\371\344\004\036A5\216\034\335\324\274'\244\233\232\203\234\0210ro\350\020W\220\216Pz\216~\264\257E\355\001g\321/\322\355B\025+\021\021k.\341GYt\325\r\230\231aU\313\013iEo\233\320\214\016\201R\321+\272\b\310]\316\0248\021\025\204)\032E7\240\310\324)\230P\364\r\005{\305\023\261\324\333G\232W\315\261(\245^Rj\004H\341\356\222\332D7\233\353':\351\204\211>!\034\231\303-\0130\320\333^Vw\232e;J4\003%:\001R85\022\215\324\177v\361\220\003\202\236\250\322\340$N\342\244bN\315\214\210\214$I\032\003\262\n\020\210Bi\036\327\222\017\022\340D=\007\204\212\021\222\021\322$\331\237\003\021#\306-\247\025?\217\340M\371\241\243O\256fk\221>\025v\372\0301\302{W\240I\241\343q'\210-\330\330}\350TDh\310\250\243\335\371"
+	.string	"\b\353\016\237\364f\361\031\262R(5\b\033\0202\261k_\237*\2400\251j\256\301\027P\344\215\202\247\341/\242X\213\022\b\266\262\347\363Lj\210t\211\267\234\343\317*Q\356[{\306\241\206l,\224C\316\234\203@\351\0205\242\033\306z\272&\214\270\347\335\305\201\322\022\237\030\020@-\327\2178.\332l\364u)|'\300'\004]\334I\032\005\326\216X-Z\263\364%}\2423\025\244\210\032\320PF\230cu_/}\267\271`]~^\364"
+	.ascii	"\310 ?qX\240\324\261.\220Tj\327\222\332\n\375\306RR(\242\256"
+	.ascii	"\266tB\351\210\212\316\261\037S\372\0057\204\020\260\017\031"
+	.ascii	"\277\026\312y\333\370,\320\366\023\220k\243\244\220NB\325c\226"
+	.ascii	"\367"
+	.ascii	"Rq\370\305b\274\334\032m\331f\232\271<3\325$<\216\316\025\362"
+	.ascii	"N\021\265\001E\355\306\345([x\277\205/\036\201\262.\342\272\002"
+	.ascii	"kb\326\003\203\257\367`+D\n"
+	.string	"]M\347\247\304\324ji\347\006(\214\237Iz\264E\317\276\016\024\372x\314&-x\\\321\200\034^\256\004\264\001FV\343\304\313$\203(/\231\202\304\222P\343|\254i79\373\305e\335\331_2sz\207\022\374\331W\363\306\342T\372\320I\371\2265\260\313\\\017\215\207Z\243\032\326@b\td\242\342G0A\007\273\023p\374mQ\257\232\177\r\210%D\377-\360\341\f_\221\245\fx\356\325fs\220\023a_\"(\225W\021\312\352\331\221\260\013\312\275\340\363u\242_V\001\246\262c\350\265\342\206~\013\274\235\376u\217i\330\200\374\204\261\212\345\274\223c\020\201\263\304\260\024\362C \371\314\3146\370\017\334&(\223\347\340\230\023\256\022%Uj\nY\017O\346_l\275n\276+\026?=\200\325su\323CVT}0\t\023\231iW\263(\213\352\357\371\267\250!\236\235\341\342\247\211\317\323\021\357\361\252y\354"
+	.string	"\225\304\260i\n\306S#\217\210\214I\323W\376N\\\337\256x\377\255n8<X"
+	.string	"\020\003{xvf\357b\235(\246=W\202+\0259i\005\2740\305\300\274\266c\024\b\227\024o\260\006\033\221\301\340bgM\234Q\357\037\275a=}\021\"\336\233 r\341\356j\233\256n\3063\250\\K\213j\037K\304.G\2205\343c\367f\211u\262\2252\032,9r=\331Zr\t\252\320H\\*gZ8,\374\215~\225\304I\350\260H\304\352\340#h=\376x\310\332\326s\273\220\3453\224_\373H\0351Q\302\022w\231\367l\253\035F"
+	.string	"l\203\007\261\301\375b\350\n\310W\306\240X\267A\001\3132\362\246.\361\371p\253|\231\323\004\347-F\356y\336\316\346\217@\250\211=\306R,\n\310\330\234\307k\210\365\020\300\213\016\363y\001\323\250\016\303\200\270\256\304\261}\017\235\002c1\230\242\211\312\270\n0\362n\341\326\335\212\322\353H\n\002(we\001Px\237\212\002-\007\336\002V\317\277\255\242\226\230\352%r\301_\300\\\257\377\2712\343\241\347\315T\273\304\351\341O\204\335*\bU\022V\234\001\351\377w\325c\034`\017\350\346\361\362\323\367\031ED\277\377\230\266\272X8\":"
+	.string	"\245f*a @c\250a\224%Ab'VI(\300\026\214\314\330\035\213\357\261n\203\222JN\034\036b\026\246\bF\213E\202\300\332:\360E\373\216J\251\267 \237\330\036\362\"\264\022\227\030M\256\262\213<\204\341\003\354\211g\351\217\254e\275\003\f16\f\254a5\365Uw\004\024\245\277\252`/\270\036*hR+\330\374+\nH\216\260bh"
+	.string	"\306R"
+	.string	"U\265l\351\263\236i-\005\033u\272.\be\303\233\263v\336(\225\b\243\237\256\3604'+\006,\223@e\354\330Y\350\247\321j\231\334\210#\257|H\234\031\300R\254"
+	.string	"T\361\222\320\223\346\225\335\241~z\373\341\b\225\274\320\230Z\032.$\0207\372\001\372w\327\351\031\271\"\3517\243z@\357Cu\253.m\312\242D\3655\317x\001\013Z\261\177\314\241\335\001\232f\302d\370\004\370P\206\020\324\336\352\020}"
+	.ascii	"\275\",&\n\261\241\177\0202\273l\r\250J\240\016Z\272\242p\255"
+	.ascii	"' \301\t\001\371\367\254\226\177z\247\373\306oE\212\202k\261"
+	.ascii	"L\210\247\363g\336Bc9[\217Y]\\\r-\303;@U \336,\337\341\205\265"
+	.ascii	"\026_yK\205& \343\013>\325\334\337\301\2554\002\347\226V^h\025"
+	.ascii	"1\334\323\230QK\025\247Ppp`\027\362\300\234\256\376\374\355\260"
+	.ascii	"\314\321C\335\026\371<}Q\361\323b\363L\345\2101\221$I\371]\303"
+	.ascii	"e\206\305 5\233\345\255f\t\\\354\206%\307\332"
+	.text
+	.section	.gnu.lto_getMcuTypeById.321.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\275\013"
+	.string	"\266\025PC\020o\225\016\203\242\204\001+\016R\001\024\252=\354O\024\315\325\343\252\310\200\261\267\302\374j\005-\033\302X\327\234T\373\022\005/"
+	.string	"\210\274\346\004\024\347\306E\320\263\234(\252k\356\263\317\320\"\237\354\275eJ\0019"
+	.string	"="
+	.string	"="
+	.string	"\255\027\273!\347\360\025\355s\373\207\366\031-\274\273\214\332\371\243KJ\306\305\006T\354\003%<r\200%i\331\335\263\256'\320S\245dv\327\372\201\021\356y\333&\2669\373%\001\341\257V\177\202\270X\214P\035\265b\027\302L\266*&\f\203m\221\275a[\325~\210\213\020=\f9c\227\002\212\327n(\342\220\355\323\"m\373\037\016B\344nd_\253\t\232\206\026\017\002\244\350I\0077\321m\273K\342\227x\213\201\177\341\323\r@\372\357\323\007\305\016/\025\363"
+	.string	"#\351Lww\024c<\244i<\3532\203\312\305\201D\212\222\302\260\303\221\306\n\366\345\306\225\345\003\326\b"
+	.string	"\2409\321\004\330\bp\324\033\f\307\300\206C\300\031p\200\333x>\034\246\342N\202\002\036nA\247\343\341\034\356\345\306\225U\375\023\n4\274\224\254\303\256\351\337g3].\237g\335#\312\370x\212\316\004\024"
+	.string	"\3561\322\026\220K\033\204\213"
+	.ascii	"\323X\031\302\300A\230\363\030C\240+\351\202TX\315\205\334h\f"
+	.ascii	"\007\252=\232\214=hW\224\022\220\252\322:\343lW)\003"
+	.text
+	.section	.gnu.lto_cliStatus.322.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\\\024\345k"
+	.ascii	"Z\274\334)L \224\322\032\003\311\333{\253?\333f<\260\314z\212"
+	.ascii	"\3676}\245V\350\242V\263\315\350\034\237\357\325o\301\020\333"
+	.ascii	"EYw\363\276\322#\250 \3417\360\352\035\277S\034W\213\367\234"
+	.ascii	"\033x\316"
+	.string	"\226 S[EL\007\224\225\230H\345\226)\245\024\210\002X\002\231\002,l\347\240\2403\020\353\374\303:\263\254\263\317\217sO;\363\260\316\301\037\347\035\326\271\204\2173\260\307\371\027t^\203\316\276vVy\234?\350\354A\347n\254\031gS4+lR\352|\235\332[d\217\316+\365\275Ei6\335h\272\245\335f\272\313t\303uk\351f\353\366\322\035\246[L\367[\36307\020l~\234uA\303\343\232\343N\323j\244Tl\0226*I\246\357\253\226\002\032\245\277\320\2617(\0066*aS\252\037\270\317p\320L\262\2152)\203\206\347C\216\203e\216-\226\332\3335\303\f\017\315\312\373\252\361h2\334>p\020N\211\030\025\353\262\003\330\276\357-\315\245\277t[\273\365\030\016\312\240\261\3547\022\324\367\310\313\034\202ETL\r\0041I\257\030Q\263\351\003\300\036\032\314\262\303\004\371y\245o\257\340\244\"\267"
+	.string	"\260}=E\321\302\265K\363\260l/&\3740\307\336v\301I\345\207\351\373r) f\247\205+\033\303\375\f\031{\201\240lT\356\246\357\373>\365\016\275\266l-W\352\333\345\035\322\202R\364\n\036\032\336\373\252-\265\217\007"
+	.string	"\266\257U]\r\0058\304v\346F\353\264egQ6\320\373.\371\"\346}\325\230\230\005\260}\254\326Bk\373\200-\\\333\307K\3468\377\212y\223\254R\350hm\301{\337\267\351i\340$\337\016\377ZUk\006\252\313F\221t\002\351\310\250\210hH\310\2040\b\350\207\365\351\341\t\356\224"
+	.ascii	"\376V\237\372\276\344V\243gs\236]\314F\241\376\262\212@\3515"
+	.ascii	"\\YT'$\246o=\006\315\223f\360J\353\023\304\350\231\032Z\236\022"
+	.ascii	"\257\264F\302\322GX\316\334\350J\027\251\355\025+N\244\304+J"
+	.ascii	"\017E\201\342BO\332\304\2231N\\\370K@\256M\260\210\232\341\241"
+	.ascii	"\345\315\340\005\326AM\032\250\t\023\377Q_\204\235q\241\205\324"
+	.ascii	"\220\005\321j\314\234\025k\237^\303%\326S\270\302\274\347L\022"
+	.ascii	"\347Q\323\244\247p\305\340A\225F\223)R\372L\253X\303\205D\335"
+	.ascii	"\201\003\323\326r\255b\nW\r\276\243B\211\027X\227P\201k\270\276"
+	.ascii	"T'\337\352j:p\006\257#\3753"
+	.string	"\322\353N\027\f\355S_L\335\216\360\351r\252BE\240<\203]Y\256\372ti\251\355\373\276\301.,\377\366\2413\210\212uA\313S\342u\244\375\227\300\373\276\354\317.\257\346\024\315\354P\314=\207\371\347\210\277\305\354+t\001\337\315\037j~\321Y\363_\353@\337q\316\345\016A\344\312\001:\335\205\254gr\267\322Z\300\003\375\217\fLK\263\216-\254\351{k\234C]#\222\3349@\247w\271\200\326\345I\261\236\311:8\235\270\371\276\214IX\235\336\202\2576!zK\021(*\250_\306K\375\363\31058X\216\004\023\233\375\237o\255#\005\274\317\263\337wN\275\246\357q\317\373\270y\256\002\025\360}\261j\260;]\313M\302\255\343\356\271{k\373z\276}h\225\210\25767aiY\376\031v\246\353\031\001o2\216\265l\262fY@\247\277ZK\"i\323\274)\326\357K<\3177\031g.\267\204V"
+	.string	":[\314\262\210\3263}\264\236\322\211\233N\327Yv\265\260|\341\205\265}<\357o\336v>\370m\244\221X~\001\337\367\255\301\215\327yK$\334N\332\307\313$K\261\245\330\332\276\235o!\230d\001~\211g\322\322k\"[\226y?\201\277\203d\214\310dY\203\367\363\367<u`>h\235\021\251\357W9\313'\313(@g\327 e\3756"
+	.string	"*\313*\336O\337\363\320\351IW8\363\022\3132M\211\256\312X\336\264u\177\365\233L\337)\300\272y_g?q"
+	.string	"\235m\244\005\003\016x?\271u>\223\221\374\237Y\202\t\274\237\352\267X\317\344\"g\276 \207\367\363\277m>\223o`\251\365q\355\367o\347Y\263\351\272\356\310\355\2045\320\341\375\324\261\266\257\177\347\253\007'aiG\206\370\036\263Z\323\277\214\271\235\314\220\230\362/an\270\346n\262\316\375\272\315\246Yy\305:W5[\363\217fk\036\201u\366\321e\232Eh4\315\036\264\264\271\2036\323\314A\213i\326\301:\037\300:\337h-\3156\232\255\331\200.\323\374\324p\315\005\364[\263S\2775\023\320\3165\202\3164X\347\001X\347\031\254\263\f\326Y"
+	.string	"\037\347\030\254s\323\2173\214vfb\235\211>\316K\254\363\013\241\263\013\241\263\022\353\334\202u\016@\350<\024:\263\360q^!t\006@\350\254\202unY\347\024?g\024A\347\244\240\363\t\326\031)\310\371\210u6\002r.\352q&\352q\036\002r\026\n:\233`=zE?\276\273\320\315\241!Zj\003~\353K\007\360<8p"
+	.string	"o\003j'\307h\370?\336\267\260\030\276:7\302\263x\267\022\205\262\347\234\236p!\315J\321\227\261\013-uQ\027\272\2710C>\376\306o\215\3601\276\342\260\254\370\021\276\301\270H\226+\376\005\324\316\214J\004\300\373\370\"0N4*\236\333\272\b\257\227Y\t\353}\207\254"
+	.string	"\340\217\3328\177h_\305\037\325qN\207\370\236\227n\177\2553\206\365\314\036\3722n7\311\232\342yf"
+	.ascii	"\342\336\256\f+\263K\346\246\370'\250\235\234\024\313\316M*D"
+	.ascii	"t6\005\204\234\007\036\2733i\3263y\212\307M\223\3516\227\t\n"
+	.ascii	"75\270O\214\240vW\244A^\220@3A\244Q\374\016\037\336d\372\213"
+	.ascii	"+\005\370dv\243.\025\357'\2127\202\332U\221&eq\253\260W\200N"
+	.ascii	"\207\362s\323.\226\365\304'=\223\363\254\230\203\253\203\367"
+	.ascii	"\363\304\373\244tr\322\274i\334\230\360\313* \003\343bC\020R"
+	.ascii	"\025w-i\013\320\351L\216\036\351{I\264\211\020Zz?\"\334|\001"
+	.ascii	"}\260\036\275O\341\342\321\017\232\230]\036|\212\373\205\311"
+	.ascii	"\254}\3546\270\024\027L\233\353\346\266\266\357\350\233z\016"
+	.ascii	"\221&?\026|\301E\327\336\264\356\301\007}\257\361'\356\0308\240"
+	.ascii	"\323\225$A\341\300I\235\317d\327x\0237N\016\350\36408nD1\324"
+	.ascii	"Q\343\363\364\026|\221\331[\203\3434P\340\326\265\0263'\334!"
+	.ascii	"\254\355\363\340\037\314\026\030\321\013}\321\267\363\006`\263"
+	.ascii	"\231u\350\211\276\235S:\370\241/\332\242\245\267$\004\240\022"
+	.ascii	"'s\315\314\271i\322\254\355\023\372\024d`mW\306\226_\255\305"
+	.ascii	"\314\303\\\314U\303\306m\323fm_\007\337j\232\0026`a\362\230M"
+	.ascii	"\nV\020=\375\356\300\201[\205\337\357\2637t\r\2218\236/cG\322"
+	.ascii	"&8x\035o\342\335,\312\244N\353\210\3609\370\337\242\245\367\364"
+	.ascii	"\304\026b\260\006\006f\255\216\215N\363KK\013Q\202_\306\277\037"
+	.ascii	"\202D\370\226\353\2402tnz%\270\217\353\323o)\327\240G\256\275"
+	.ascii	"y\372\227[\347\304n\304\217\270oT;\367n\275[\333\027\364}\246"
+	.ascii	"+h\202\365p\345\315\335\356X\020\333q\205\320\361\036@\341$1"
+	.ascii	"\243s\263!o\332|f\211/\343\340\363\327\315~\201-\232\247\325"
+	.ascii	"\346\274\305\352\217\200\3571\335P\266(\236V\233;\221v\372\255"
+	.ascii	"\035%\375;p\211c"
+	.string	"\002\327n\022VV\337\351\t\b\234\034\266*?\265I\251\250\266G\225\024\025R\201!N\"\217H$\003-\016\031\020\260\354\"9l\231\332+\244\321\312\252\270\243\315\0215Tj7\020 \006\214\030\355\213\266G\321j\352\270A\013\346"
+	.ascii	"\203\226\030eUD\266\025`\320\201\003-\2615NA]A\265\304\3410j"
+	.ascii	"\370\244\201\0058\032\340d\006\255U\225\021\211\f\202\243%\n"
+	.ascii	"9\031Uu\2042&[*)+ \032\264TF\253\344U\216#\206\032\302P99\274"
+	.ascii	"\221\034\256\334\022\377\210\274\352\321\226`\242\363S\233<\""
+	.ascii	"\257\034\370\341\251\035\305)\251b\t\305VH\221\212\230\034\266"
+	.ascii	"OUG)\253\"2H\017)\036UG\034M,d($F\373\224L\032\221QQ\305\226"
+	.string	"\0305l\237\214'H%\333\037PE\253\034,\370\204\007&\210\032\336\370\001u\234\302\321&\207\255\0068&\020&\217@\254\244v\254B\214QU\020\b\215\310\242\tQ\310\342\003I\237\037\311\"\225*\325\311#\220\217\252\nr\344\341\373\221,N\220D\036\223U\306\034QF+(\243\2251J\310#\310\216\267\212r\243U\021\003!\3105\331\2438\305\303g\254\222\2322R\025)\210\242\202\3721\024\f\251)\250\246*\251\"U\023\0242\331\004C\210\217@\214\310&\253\343\021\331\024T\033\322\277\004\032gN:\344\233l\202\227 \352\373*A\240\303tOw\360=!h\034F\361e\334@4\020\036\235\021PN\270\257\212\241\223\243\207t\3656~\353j\265\241Z\371\232#S\223j|\267\3618\356\232\320\313q\261\334N\371\306\341(\337\260\322Ny\347\312\273\265}5~%C\002\227\367f\343i\274\373]G\353\310"
+	.string	"Oc\306\017\360\016\247\005\246|b\317\370\266\022=\213s\3221z\345\373\334\223\210V\301m<\263r\b\245\234\265\237F\337@\264\243A\343\214y.qY]'\214\226\272\310\r]\232\260\243\252?\240\263\234Y9G\231\347\375\274\372\b\240qrh\243L\202U\326\001:\377L\232\024k\251\233\214\257Q\3561\201\316\357!\216\024i\026\3237\275"
+	.string	"i\334\246\233\005t\376\222\030/\3003i\305\370N\002\3067\241\260\345\256\340\375\204\361+\334\230\220.\267\005\357'\323\236\264y\300\033\3607\376\305\313\220s_p\215"
+	.ascii	"\235>\307\342\375\002\202\3702\236\335Y\304\322\023\337D4J\334"
+	.ascii	"\327r\351\233\240vs\244\315g\276x\037\324\316\b)\026\222\213"
+	.ascii	"\257\372\242;%\027\217\264\245\305+=\322\234[\267\370\367r\244"
+	.ascii	"F7\027\201x\250q \345\224s\244HFD$I\222\264\006A\005\204('\235"
+	.ascii	"\264\016\021 \255dP\315H\222d9\272W\230\303\274O\3167\004\004"
+	.ascii	"\312\301\360if\2243"
+	.string	"\241\3772\032a\244 o\220\314\021Afj\212\212\271E\311\367<\360T\343\354\037{H \371\227\032\246ZA7\327\243\\\033\324\216\360\020\274\247\207b\027\217\022\336{F\323\304(\202u2\346?\267\316Ny@\0251\352\311>\2438 \205\037\034\021\210r\366\002\023\257\233\200 \232H/\332\"aK,\321\305\233\354K\f\226\333\344\352\355\246\266[&\204\022\215D\240\021\"\005)S\346C\310\203\265\273\006\n\217|\215/\205/4\321\252\267\276\2373\220)\t\300\257\b\357X\225:t\253Y\363=F!\204\223\030e\377\301v\324r\310r]\352~g\f\224y[O[\275\210Md\245%\277\031\202\002\032o\206\224\205ZQwF\221W\320k\016(;/YC8[\313f)\334\357\013\013\252\316tm#\273\2056\237\372\006{A\214\207\003Z\315.\234[\345s\352 h4\t\310\023\333Q\341.v\013\300g"
+	.ascii	"\244Ds\320\264\271k\352P\2124\207y\2758W\317\025\033\256\335"
+	.ascii	"\353\274\254\336\001x\021\366o/\357qV\246\336\226\354$\251\272"
+	.ascii	"\277I\033\303\016\357/\304\262\320\370\304\221T\252\220\245\035"
+	.ascii	"\213\374t\324\036#\266/\373I\272\2420\177^\346\320P[\037B\217"
+	.ascii	"\2139 \252!\002\372\224\211\363a\306cG$\247\366\253C\247\"\356"
+	.ascii	"\263\204\203\206\361\332\233lXA\017\026\377\265\007\221)\214"
+	.ascii	"q\217h\\\314\"th\306\024@\312\037\031l\245\236\263\241\314\201"
+	.ascii	"-\325w\220p}\251\200\031\221\002M=\n\027\312\004\350!\222\372"
+	.ascii	"\370\232\311\344\275\316\363\356\005Q\373f}(\0047\244Q\232\304"
+	.ascii	"\340Py\2210q\240\317\213\221oJ\355\270`{\220\364\367F\367\343"
+	.ascii	"\373\231\016K\243\243Y\032.\242u\304y\215\340d\007\026\022\252"
+	.ascii	"\352\364{\272\344\314\320\222\001J\346M>~\257\034\264\346\022"
+	.ascii	"\302k\254\f\357\302\273\233\267\244\020^8\256\0064R~\232\f\225"
+	.ascii	"x\247Hi\265\271\0316\226\200\35730\241\277\327\226z\206g\375"
+	.ascii	"Q\265\275\214A\333\240%8\350v\266\326b\202\311#\370+\256\245"
+	.ascii	"B\006\235\370\002\260qr|\353\003`k\242\202\220\346\2260WZ\205"
+	.ascii	"NSy\301\0250k\363\222\263\230>\200\277\267%\n\024\244\026\223"
+	.ascii	"\356\254\n0\347\227\177zx\314\321a\220\034\213]\030\203\t\363"
+	.ascii	"T\363\263\200\375\303\314\220\210\034\201^\231&\266\256@\376"
+	.ascii	"!\362\330\345\311O\022\n\027I\241\345\027\255<\024$;C\260\202"
+	.ascii	"\223Q\246\322\221\216C\220OWy\3379:\322\205\001\350nb\242N\251"
+	.ascii	"\017\366'\365\2743Q\314\360\221_?\244ce\202H\003\t\2701q\032"
+	.ascii	"'\202q\310\037"
+	.text
+	.section	.gnu.lto_cliTasks.323.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`A\017uP"
+	.ascii	":\214\374\036P0R\312I\007\232\332Ub\257Tvm\207@\226Z\313u\276"
+	.ascii	"|%\367\372Ymj\225\346o\252Xu\347|\316\206\200\230\"\316\251="
+	.ascii	"Z7@G\251\3131\210\235]jV!E\030\005P\372\237\273\272?\345q\004"
+	.ascii	"\221\251\356\377\177>\356&\215H\231d\320\001\271\001\335\001"
+	.ascii	"{\336T^\233\363\326\033\336\237\r\257i\303\353{\017\337\262\362"
+	.ascii	"\366\217\227M\336S\020D\342\214\225\263S\361\202\242D\366\246"
+	.ascii	"@\355|uP\316\345\257\373\201\370\263\374=\374q7w\277{!\366]\366"
+	.ascii	"\344R$e;+\326 \352\202\370\250\245l.`P\351v\317\335\373\260G"
+	.ascii	"\376\207k1\036\210\020\030\035S\202\236\205t\312\020I\024%\223"
+	.ascii	"\240\336W\242\0172\217e?\267\347}YD(\0227\005\231DQ\270\034\365"
+	.ascii	">\376\225\313\355\031\267\\*\027Y\215\233\342\026\345\200z+\347"
+	.ascii	"\301\370\036\226\013O\227\022\264g,n\312[\022EQ\246\373\366\251"
+	.ascii	"\336',\031\216\204%^\234w_\345n\306\277\225\360\036\024M\233"
+	.ascii	"\243CQ8\030\333\242\336\267p\0172\357\253\3771\3573\356\222i"
+	.ascii	"\224\016=bNa\003\273\"\005\212\242M\035\303oooo\357%\334\267"
+	.ascii	"h\217\332x#\025ED\301\241#\241 \240\037\237\036\236\035\235\034"
+	.ascii	"\234\363\306\246\376\314\022\330l\334\377\f@`-\213^X\031\327"
+	.ascii	"\215\334\256\242J\2276.bbF\345D]\376\2618\266\2632K\314\250<"
+	.ascii	"X\272Hn\211\342a\310\334\312 \"O\302.\307\306C\345o\b\221'\017"
+	.ascii	"C\246CI\003M\262\356s)\03711{\273\320\223\007\001\325\360\237"
+	.ascii	"\031\356#\303\f\334S\203\023\346\241\241\t\357\254Xb\226\344"
+	.ascii	":\245N\024#\274\036\206,I\351\204T\242\346R\310\220p\316\221"
+	.ascii	"\343\0341\302\347\3617\307R(\205\354\005\2669{=\243\373\n)d."
+	.ascii	"\360\257\024\206!{\202\004c\263|\327\333\201?\003\226\230Ay\353"
+	.ascii	"\224}\225B\024E/w\026+\363b\376\031\200\242\350rX\231\331\027"
+	.ascii	"\351\273|\264{\024vq\302\002\267i\234\266\031lZ\b\355H\346\314"
+	.ascii	"\333\022\327\206\352o9\031#\024\240\030\243\r5}\233q\315\210"
+	.ascii	"\2030m\256)G\226P\373\207v$\303V\332\374\032G\263\026\2605,\330"
+	.ascii	"\354]#\025\243\233\371\260_\013}\275\310?a\266J_(\332\305\302"
+	.ascii	"\354\247_\274xo\273}\035\274\222&\273x\357[\006\212#\322j\253"
+	.ascii	"\355m\230\335gb\334\341H\033\335\247\373\004h\3071\277k\302\n"
+	.ascii	"\226\337\007&7\220\003\216\374\240\242(\032\305}\242\035\307"
+	.ascii	"\260\031\361\351\216\274Q\303\240zw\201\006\220kvCZ\316\313\220"
+	.ascii	"23\214\003:jz(gcyge\253-\367\215\370\347\3563\004\336\2315\345"
+	.ascii	"^\004\223g\003=\274\222\3517-\306\315\364c\301\323\003S2\235"
+	.ascii	"\200\026\333\003\201|,\007\303\003\330\004E\323\207IP\323"
+	.string	"\r\222zT\300\017\333\340X^\021\273\257\346R\261\202\233\016\335j{\201\371\326\200\007&\276\030\315\356Z\360/\027T\024\375\212\332\017q\"2\330\323p\337\022\247\370aS\346}\357\363\356\210\304\231\267.\336\333\205\363\342V\333=\215&h\222\333i\273=\036\330\221\303\253#\2077\307\311\213\203\201\327}o\020\300\274\003\344\360\326\310\341\245q\362J\235\3137\n\352I\200\031N2\232N\336\0308\2740\036\367}Qy\231*\257\213\312\273Ty\225N\336\244\2237\200\223wx\362\2660yY\374x\001\250\274+*\257\260\362\"U\336\243\037\257\321\311[t\362\022\235\274\301\223w\250\362\002+\257\220\311\033Ty\201*\357O\345\365\251\274=\317\362\345\251\274;\225W\247\362\346T^\234\312\001\004\264\023\320M\333\377\362(hF\257\371\324\002\264\330\0065\365\226\246S\313x\217\376\334O1kU\366R$!\224(\272\244"
+	.string	"\344{\222Vx\217U\020*\200\241\274\214C\214\306\314\224e\tj\265\225B\301\b\206tBM\031mi,/\215\335\220\346\002j\265\365}\361Y\0163\212=\017\205\232\362\221\244\373|_z\226M0\0229\036\013I\367\r\260\304H-\354\025=@\177\013\247F\"\217+\253)\023I\272\357[\370\313\250\302\260HM\237w\326\\\345O\253\261\n7\035\234\370t\032"
+	.string	"\375\034Z"
+	.ascii	"\240\357\305\311\331\212\243\260m\336\272\216\032\251\177\303"
+	.ascii	"\332\016\310#G\375\343\356\250\206\255\247\325\026\357F})I\216"
+	.ascii	"\374\300\250w\320\216z\300\036\352`\023uQ\357\264MKMa\204\001"
+	.ascii	"\t\255\246\237S+Q#\315U\324O\333h4\321\231\327\350`\377\346\313"
+	.ascii	"\305\254\321C\375\264\316K\250\201\375"
+	.string	"\264\2657%b\020\352+\264\243\036\033O\253\355\351\016\004\207\247\006\211\316\003O=\243\305N\367\037;<5)\350\354\350-s\234\272\251\305^\304\203\372K\364\242\b\352\235\273#\024gv\247F?\365\003\315J\326\336\2204\332\251w\364\223kor)\222G\251s\013\3239\357\304\203I\2744dptt\215z\021L\250\336q\006f/\007\250ut\260\314\177\032\250\227\264<y\237\376i%-=\275\323>=\275\223\266\346\246\207c\263\2472\207\222xi\300\334\344h\032;\215\203\306\311\2216v\032\210v\314;u:G\017A\001\266\346'\3466\314\234\326i\244$\322\266$\023n\303\304\351\234>J\"Er\266M\343\364S)R}\266N\2245\267<\26057\255\266\374c:c\301K\363Vq\264T\213\211\t[\224rr\032\366\254\326U\020\254)\241PX\274\"ZYaM\tw\360p\240\305.\341\260\261"
+	.string	"\004\t\360\020rp\345\243\030\244jJ\b\225\2220\202\030[\214\032\226[U\205\345\201o\265\256\250@\2402\367\307\024U\007S\346\026\241fdE\r\221\266Xc8,:\rc\024\237\244\206\302b\324\260\305\n\227\262\240\234\206JB\030\302\342\f\031\303\235\275\331,\253\246*\242\026\226\226\260H\304\252\022B\264\342"
+	.ascii	"\004\242P\230\025\244I\b\321J(\034\241\203&*-\"\020\241V\226"
+	.ascii	"\217*\341\217,b\004\n\370x\226\026Q+\313\207\265\301U-.\360#"
+	.ascii	"\213\250e\n!Z\335X\005\341Q$b\341\240\342\200\b\204\n\004\242"
+	.ascii	"\016\325\225\217**+b\216\242\325\324o\247b\370\250\232j\272\362"
+	.ascii	"A\264j\232\002\222\325\024#h\261<\240\002\322\244\205\205\005"
+	.ascii	"\244\351\204\353\272\334{\306\314\270\331u\265\227\321\016\336"
+	.ascii	"\335:b\353.\210\363\331\230\0316;\257\346R\321j\353\364\002\021"
+	.ascii	"\003\355\223!\310\364(>\376F\037\317\001\216\352\335-%\266\226"
+	.ascii	"\340\207\335\350\027Q\362\325\\o\202&IW\264/\036\325\f4N\332"
+	.ascii	"Z\026d\212\304\313E3\365\222\027f\262\325\204\321\230\232\362"
+	.ascii	"\0240:F\177\f\330\232<F\333*\003\243\243\234\274u9\30100\365"
+	.ascii	"\221NZ\251]\364\307\244m^Pp\222\245\276\232%\266\364\370\310"
+	.ascii	"\326\0316\262\225\334JCC\020\363>\245~\227W3wF\264\2605\013P"
+	.ascii	"\242X\201H\b~\301\b\003\260\t{\t\216\231I\262\304-z\330\001t"
+	.ascii	"R_\bnaK\rpk\257\246\334\304\205\346Jz\321\001\f\313n\321\017"
+	.ascii	"\342\025\2115,J\244u^>sh\252\004\217\236\272l\261-\217\234\372"
+	.ascii	"\005\213\326\200W`\025X\364\345\336\300\235\221+Cso\222A\250"
+	.ascii	"G/\220\247\241\004\350\005\336\364S\213\255\220\214\336\022\030"
+	.ascii	"\201\035\250"
+	.ascii	"a(\344\224S\b\215\214\210\214&I2\0341\005\0041\350$;\017\021"
+	.ascii	" -d\222\315$I\24516KI\365)|\305pSiC\202\2649\343e\001ox9\304"
+	.string	"\331\341\231\242\246\t\272\215{Q\030F\274xG\346\016\345\033\037\262\336\367z\220s;\212\254\266\243\024\025\372\236r\241\306\226\324 @j\013\343\032\262\266\272\265\001\no\211\200T\240\366\325~T\362\017dR\325<\224\206\201\332\037\247f\016T\007\003\225\r\222\177\313\2657\251l'\317\305{\007\361I\t\r\027\243\353?\262M\364E#\346\347\0226\203\016\215PU\213\242\034\322V\345\224\244\023\246\257kn\300\016\244\366\326/\235\227[\034\036i\202\233\020\3751\2358\250\220\230\373\304`L5\325[\345\205\233\t\265\326$I\033\251\327\306\256\021O\007\236\317\020\032:-E\r\272\214mD!\005,C\221\2716\002\021\002|\245\303<$\371\003\001\236dBl\217\212t\265\247\254\024\335\235\005\306+\225\005jV&\235^\335\0248\016\353]F\033\203\313\n\3657\r\032\022\267\003d\306\304\354\303\316\r\357\206kq3."
+	.string	"\254\023\\\317\346\231\304hG\t~\030\321c\324\307Mv\034\252\362\244\234b\327\310i\241\303g!"
+	.string	"\362\366\b\031\217\006m'\267\001g\3645\275\374\272]\347\025\301\303\302z\370\230\265\034\240[i\212?\310\305\246N\214b\365\270E\027\223\345:\226\372\344\272\\\003{(\2558\343(\020\342\023\002;\022M\330;\036\260\254=w7\361z\007\272\321E\332\266I\360M\340\332K\364'\226\201\314\316\025\fzV\277\354\215\020>\270\353\343\212d\263\263\315\037\032\f%p\037!\366"
+	.string	"\257\302\030 \202e\303\321\240s\346"
+	.ascii	"\261\021N\353,+\006\251\277\001<\275\"\347\033\026\267\004\256"
+	.ascii	"%\251y4UI\026\211\0243\026\357>&\030\207\216\230\373\006\224"
+	.ascii	"\377\n\037\035\310\355\322\230\351\356B\037\347\352!\206\343"
+	.ascii	"#\274\230RIiv\304\377=f9\314-U\234z\370'\025\037\237\216\374"
+	.ascii	"\200mX*\276\357\327\216'\200\342K\\\245\216\211\360\207\204\226"
+	.ascii	"\372\303\022\2477\304&\223m;\376"
+	.text
+	.section	.gnu.lto_printVersion.324.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\203\001\375\017"
+	.string	"\226\234kI\320TQ:d_\032\216mo\2300pV%T\362\200\373\265H\356\002\372\332Q\211OJtLa\206\255\325%qx\243\002\274\302([K\020\036\300\362l\023\263\356\234\354\035\301"
+	.string	"\255\345\230\236P\345Q\326+H#\204\354\235RQ"
+	.string	"R"
+	.string	"\\"
+	.string	"\256\337F\240<\t\020\016\220\202S\3738\317q]\006\211\017\330\265\355\360\354\336\026\330"
+	.string	"x\317\267\237|\367\300\023\370\356\331.R\227gm\276\030-J\330\020\332]\261\262\270\353\324\345\177\306Mf4\257S\321\204\3355\235\321\240\270\353m\247\330v\331\367\t\265\372\322Qu8\314z\003\004\255&\247\361\032g\367\033\207\230\371>\233\371\356\275\002\250\t\222K\221C\203\321!\373\026\243u\205\375nw\327\325f\237\272;u=5=\365\301\357\004\3758\022Ts\235\237\335\023CK6\347\365\270\260\375\221\355Jm\007\020\002/\224\030\201\325\230\013P\273\002\213g\002\211M.V_F\241\307\375\347B\255\001\241\271\2002\021&Z\253\017\206Z\363A\313"
+	.string	"\312\316\363\320\360\035\357\331\340\337\3343\207\016Tt\023\371\216\273\216\361SQ\353!D\202\262\224\351\336q\317\201\0220dW\366Y\n\224I0\225\037\350g\3566>\235\302\006\236\031\204\017\302\323\347\226\207T\031\0033\266P*#\237%R\204\225\026\n\244\026\027\026\004g\351\200H:K\244\224\004&\314j\345\2055\232*\255U\311\222\t\200R\215\026^T\244\310dX\306\220\342\252\034U\"\311:\305\360\304\246\f\212%\266L\223%\216n\260w[m\006\205\300\b# \260\202\241\242\333\363\003[\220\200\342}c\210\307\313\226hi"
+	.ascii	"Fq\257\277\247]s\273\301;\273\303\243\253\f[\335t!\fd<\030\363"
+	.ascii	"\t\355\304\254\311\367\016\206\211\357e\030\303y\224=\002K;\240"
+	.ascii	"\251\341\336%\300\226\204\017^\\\236\f"
+	.text
+	.section	.gnu.lto_cliVersion.325.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"-\b"
+	.string	"\262\01798@o\323\001\270^\234\0031`A\230\341\233>AZ\3445\006\006\203\235\227\343,D\034\0049\211\210\265\177\273\204\020(\252\016\004\363\307fRj#\260\345\016HD\204l\231R\033\210\373x:\r\333\272N\202\247\3230k\034\356\243M\020\327\351\246\366-L\216\306\236\302\366M\006\317\373ff\334W+E\316N\243\215\024*BJ\330\322\315U\332\r\016z\321\005\247\321E\n5!C{\fUr\330\257vw-E\366I\277V'Q)\265\244d\374\304e\327\"\006fQ\254\022\017\333\317\330\326\361aes\265\017\362\020\360$\210\007\354\212FL\273\243\201\t\262[\036\257\271ne\027\270n\031\264Y\344\232V\343\372\250\240\020y\331\335);\016^A\377\245\003\210\241\360\212!\354\256U\fa\334\362\266\007l\037\3306\t\f"
+	.string	"\357b\310\304\333\276h\306\005b\327\320V\030\017T\003W\300\334"
+	.ascii	"\025%\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliRcSmoothing.326.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`x\n\r5"
+	.ascii	":Y0\024C@\344U\007/\301\333%\210\220\b\254\3526\327'@\252*t\212"
+	.ascii	"\"\231\f\214.\357\343C"
+	.string	"z\237o`\201p\020\241'\236\277\367\367\242\202S\204\305}\"\272\325Aq\241\n\252A\325\027mk{o\177)S\n&\001#\0010\001=\355\257\253\335}\265\267\256v\366\325\316s\265\357V\273f\265\277\003\247\2729.l\337\306N\226m,B$[Y4M\376\313?\2278\1770\376\363\357\362^\342\377\342bH\026D\036\376\230\337\230\\\275\317\016\365\177\325\177\356\316\005\206\226\245Ad\"u~;\362G\226\341\016<\353\r^\r'\243\016\301k\367\307\362Y\342\3272\343\217d\271\b\0333\262\f\227\300\t\274\317:\334+\265\317\276\217\324>\353\261\273\237-\233\221\251\355\033\365\254K!Y\226\255\266\221\217\037\211x4\024\006\215\200?_\357u[\226\267u\354\357V\350E\247d\217D<\032\036\341\301P\324\334\2640\311\007\347\250\001\371\241\215\200\324\377\371\350\241}\002zn\205!7x\374;G\215\355\253/"
+	.ascii	"\212\332\016\355\256}\353\233\256=\033\234\316<X\226\345\337"
+	.ascii	"\324L\363x\006\376\234\271>\230\3275\246g<%\033L\242\277)To\236"
+	.ascii	"\201\037or\374\0345$<\2459\"|\276\372\032m\372\324\332\255 \313"
+	.ascii	"\262"
+	.string	"\353\350\364\306{\322\273\377\004\367'\341\376\312\005E\242\270\2213\243y\352E\2555\236\002U\345\235_\272\241Jz\025\024\340\r\030B\254\213vj{`\353C'\314\277\211\2550\305o\357\034V\224^\345\354=\265\267\2353E\036g\3716.\367\312\262\354\300\237M|%\336\362*\201\321>\273\367\203y\024U\352\032+\020\254L\363\360\374\305Z\275\231U=P\332\375\002\006\375Q\275\213\322\253\0335\032\230\260\336\231\305\006'\351\265\215\025\372L\242?\254{\267\275V\373[E5\017T\033r\367\016oF\353\225e\250\003\1772_\346\203\277\222g\035D\b\375\321\020\333G\207*w\247\245L/\362$\375q/f\204\320M\226\347\217\226x\347\017S\317\272\237H\241?\352\254\364*g\205n2\027j\367#R\177t\3006!\275\246\261>7\231;\334S\3576\367\347\311\273\210\373\177y\237z.\357\003X\355O@\355"
+	.string	"\\\355N\257\366&\240v\246\327\276\324\323\256\364\323\236\364\323\216\004\324N\354i?b\265\017]\355\302W{\360\265\033\365\264\003\177\332\177?\355>\237\366^\356\274s\036\212\342\201\002\021I\003\234:\023\025\335\234\213\336Y\323"
+	.ascii	"\"a\355P\215\337\376\330\254e\"\323i\261\031\023\236\245\375"
+	.ascii	"q\032m\017\016\256\230\272\224\264\217\266\322\367y\244\235\264"
+	.ascii	"\213r\304\215\364\324g\261\031q\177\"m\026\267\275\035]\246\241"
+	.ascii	"\261\021\nt\372Y\340h3\351P\357\334\371\342\264\034\237\025i"
+	.ascii	"\274\363\317\255\365\022i(~\233\242\324\016\207\2571"
+	.string	"\263\341\344\215\323\332\341f\242\375]\2346\334\302'\265\216\025\241]lCi\372\316\377\206#\270\205\373\307\350\370A\361Zp\253\250R\345\334i\241\322F\373\343>P\314\306\324\343\235\177\210\331\327%c\252\177\334\326>k\264\177\f\032\217\337~7p\377,\345}w\323\372\366o\007\2603C\351m\337~ \317'\026\322\333\177=\242\205\310\353\211\333>\016\335\235\317\023\033\241\340&\313\320\007x\236.>\302\213\223D\343%\355\263R\357r\373\253\377\326\021\241\312q\2514\273\335\375a\276N<\005\212n-~\022G\321\037ux\336d\336n\367\347~j\267\373\347+\274\315\356w\351~\252\235\332\274\375\001\236\245\205\305e\201\203\226\207-\f\\YX\301\267\365\252dr\311:UW\024\374\032[(\231\310\253*/\343\030\230\361\213\252\347U\313\346\230\221\312u8\006\213.)8B2\271l\216\035\2250\262\205\262y\264"
+	.string	"G\025]L\252\t3\221M/e\022n\216\205\201a\301QM.\366\325\305`\201\224\202.)\237s\260\220\245\001\013\004\254\225\345k\032\231p\022\026\261\005w!\233Gd\023y\005G=\371\026\006.\016X\031\\\207# \303`p\301\360\205-8jI,\004\362\313\310\314\360bkE\013#\320\3304^\255"
+	.string	"S\262h.\227_ \216L!\022L\351\205\3742fu}\035]?*Pz\035\255\300\224\306/\253#S\314J\201\222/\303\220L\253\346r\311\264\372\301\225=O\336E\244v\200\254e\373\211\344\346\244\303d\347\235\265\030;8V\250>ChN\b\261\315\231\b\252*w4\304\211\307\231\347\2355\026\2733\021\334\274\274\rw\233\241\177\332?d\217\006\022\247=m\342\223Zw7\350\214\324NHu\366\251{gM\345-\350"
+	.string	"\330"
+	.string	"\370qZs\002r\nzg}\243i;9\t\351\034M;\371\244\3661\272\322\036\200\311\250q8\303\220t\204D$\020\021I\222$\035\300\002\021\241\"\333\021"
+	.string	"\251t\212\325\004\221$\305b\344+\224O\352\373\021aiuC\0252\272\371\002\315S\366\007\030\235\252\323\221\t0$\375\020IG\331\2777Y11\023.\210`\222\016\204\262\354\227O\364\021\353Bm\017\253W\347\372\227\tX\234O9\356\317s\342\300~\301x\265\tE\206\221\335\270\3354\215\352\251\244_H\364T\347\255"
+	.ascii	"\t\267\321yQ\030\255Z\257{\262x\342O`)\306\325\252\230?{xF\017"
+	.ascii	"B\361?\241\3275B\230\255^qJ\230~\361PT\340\373\373\342\361E2"
+	.ascii	"\357\270\372\230\361'\034\321\233\027\243gP7\266\231\216E5\007"
+	.ascii	"SE!\343\330\217\216\003\241\2549=\307\376\016\022\205[M$\223"
+	.ascii	"x]\367\203A\033\225\3137M\303\222\226\2676|\240wm\252N\366\034"
+	.ascii	"\370\3076\227#'A\352\352`\245\\\265b\300 \262\005\375\r\276\032"
+	.ascii	"\340\277'O\210\024S4WC}\"\003\302\230\r9Me\020\212\bR\367\321"
+	.ascii	"`\210\201\007H.T\022M\273h%V+\250tZ\f{\271}\216\325\234\224\241"
+	.ascii	"\270\177\274\b\036\320`\372hCX>\224\311G2a\353b\330\003\322\b"
+	.ascii	"j#\262\360\337\356\227\\\361\202Yq\b\017B\2008\0054\3776\\]\005"
+	.ascii	"b\3234\nA\375\243LZQjO\374\241\267q\220&\335H~\306,\2027\324"
+	.ascii	"/\231\242H\356\216^\330\003\346`\241\326Q5"
+	.text
+	.section	.gnu.lto_printConfig.327.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`_ \215\221"
+	.string	"*\347\3544M \216Z\352\275A\210@w)\022p\201\343\001\234\277\336\226\311k\324\002\276\017\340\340\301\323\211\027r\322\372\037\233\354\210\236\372h|\234\237p\231\\"
+	.string	"\b8"
+	.ascii	"%\365\347\314<\204\322\r:\003\211\363\026Y\006nL\331\1771v\244"
+	.ascii	"\355$S\n\033\0031\003D\003\215\302\001\275M8\326\273\204\347"
+	.ascii	"y\007\340Q\246x\223xr\362:\357\2466\367\bdn\246c\356\2456\267"
+	.ascii	"\bd\356\020\307\334Jm\356$dn\020mn$d\356\243\237\334\037\220"
+	.ascii	"\271=\264\271;\374\344N\"s\033\265\271\213\216\271\211~rs8\346"
+	.ascii	"\036js\013}\356\240\f\271\201<\367\2066\267\2066\367\0172w\006"
+	.ascii	"\317\215ls\037\333\334\030\220\271}\332\334=\237\373B\233\233"
+	.ascii	"\007\231{\007\231[\347\230;\347\230\033\347\230"
+	.string	"\333=\346\2769\3466\036s\027\217\271?\347\3169\267{\264\2006,nmS\262k^\020.\266\221e!\306\026\255\030q@w\254{\236\273\236;\237{\024\367)\356u\356v\373\027@\027nV\230+\207\243\311\0213\327\213\177X\027m<\027k\215\031PU\033t0\r\270(\361\226D\355\0351\233.\333\220\305\360k?\035\013dLk\033\007~m\016T\f\315\246T~m\027\232R\351\321m\305\367\374J\353\360\351\200\365\254|bl\334\223Cn\254l\206\233\367\236\035UwTqA\305\255\335:\335\201\337u\316T\312\222\016\272u\274\330N\277k?N\357\260fnq\034\353\354\270\024\227s\273\326\3619\247\203z\035\226\217V\217\030C\tS\262l\f-p\275\230l\035i\234\022\002\212-\021b-\037LlY\354\003Q@hc\2628\353\360\250\372\005\347\246&\216\341\226\274\330'\272\333\334\r\200\t\250\253"
+	.ascii	"\202\303\025\221\315\271a)\221\341BX\201\311s\267\273\271\023"
+	.ascii	"\250\277\275\216!\216\201\340U\211c\270\021}\344z\261\341\374"
+	.ascii	"\307\350E\327\221F/B\273\311|\\%.3f\023\245R\324\304q\354\364"
+	.ascii	"hF\243\021\251\337[8\357\344C\375\311\251i\004\323\222\210\020"
+	.ascii	"JI \220\216>x\350\2204\"QD\304aH(\bh\203\206\237\f\310#\006\237"
+	.ascii	"\236\013<;:98\356\215\261\330~\206\266\267gvR\342\004\353\304"
+	.ascii	"\262\374\311\311/7\215\030\354\313LK\\\266d\021!\224\006=\t\213"
+	.ascii	"5\203hqn\344Aq/aTZ\001\306\024y\342_\3562R\220\033x~t\203\342"
+	.ascii	"\213\037\217\252kX\334\022\177\334\300\363\017v\356\301\256."
+	.ascii	"wh}\350\332\247\277'9\031\344\306\234\033\3159\t/aY\222\204\021"
+	.ascii	"\346\242.N\364\346$sp\363\241&.\324\244M\006U\257\244\220\201"
+	.ascii	"\334\332\362\006#\256\301H\221\374C\3043\020\031\222\221j~t\255"
+	.ascii	"5\307\320\006\320\245f\352^\302\324\332\2355\322/\236$LH\366"
+	.ascii	"YK\022\226\226{Z"
+	.string	"\021\206yi\334K\230\226\366\307F\021/\036\371\002\217YY\336\271A\361\343\206\231\353\270\227\260\351\216\234s\202\343x\t;\241M\306q\254#\273\035~\334 \363\233\026\251\343\016\314\0051i\313\004F\2111Z\354j\271\276\325\031#\003\346\202\330V[b\005\261\023\334\316;$\t#\313\371\006E\034\307\235\275\304nx\003\340\335\217\244;\263\351\026B\013_knM`\275<\370\352w\271\n_\215\330r\033\254\307\007_\257Y\340-A\220`'X\302\302\005s]R\316\303~\360_R\372YH\\\270q\034\037\201\t\001\34119\277C\370\246\225\263\335\r\007\346\"\260\240\033\307\\\002t\036\222\211\300\204b\3401c\214^\304y\343\225\351]\233\231\2237\255\r-\204\300h\216\006\343X\313\275:\247e5\370\260}\210\027\0336\003\243\311\356\005\2431z\361\t\021N4\203\355Z\242\301\365\330}\307Vm\310\345\375"
+	.string	"\201\263H0\033hW\226\004|\300Y\243\301,7\232\347\222\274\b\301\026\264k\260LY\217DC\017:\316\314dxj\033I\305\352\244V\f\356 \030w\344\304\332\244\326\036G\343"
+	.string	"\374\227\353J\306\233o\306e\021n>\017\251\202Y\245R\267\023\371\351\013J\302\205\263\024\260\\\r\265\001erV\305n!\311\240bFcn4\263\361\300\001\305\201\224\303\215f\260\020`ge:@\340\204\034\237\212\341\251\235o\270\361\375G\034!\220\361/"
+	.ascii	"\316\201\211\023\203\352 \332\341FsV\331\030\226\013\f\312\303"
+	.ascii	"(\315\207\033\365A\"\26031,\327g\r\200-T\342#\365\377\207\362"
+	.ascii	"\305\b\0243\200\204My\311!\370n(\025\212\026\004\366#q\311\213"
+	.ascii	"\005Q\232_\022t\rJd\256L\216#\211\206\\\237\345ik\f\253\364\270"
+	.ascii	"ep\004\341y\340\273\335q\372\037\251X\232\324\252\003\365O\377"
+	.ascii	"\245d,\342\270\222\361\351\213\357vNA\334\\\337\226\240\234\021"
+	.ascii	"\2530lRn\267B\225@\231d\367j\267z\316\024\304*\211\206[\237\325"
+	.ascii	"y\313\237\376?/\251z\025J\311\266r\366B\216\037\360\272\036\340"
+	.ascii	"\026\025\201\347\251\235\037\316ZP6\267\352F=K~%\260\037z;IW"
+	.ascii	"2:=\324\027\340\025\367A\376jXu\236\332n\347\307*e\306\250\340"
+	.ascii	"8\360\335\272M\357\364_\376/Z\200>q\255I^$\341\037\004\366\343"
+	.ascii	"I\216\217+\031\233\336\201\367\264j\rAi\t[9\3538O\355<Wf\f\354"
+	.ascii	"F\201o\212]1\262\370\246\030\n\305\005\276)fB\273\342\037Ka\266"
+	.ascii	"\205W\321%\247x\022\377\225\347\n\263o"
+	.string	"7\236\306\233b`\214\356\224\242g\005i[\30726\305\242\237\035\313\230\253\024f\311dw,c\323\177\201`l\340\237\246Q\n\335\247\036o\370\335<\020\026g\240MJ\fB\235\270Q\257c\261\303\20077\343\002\017\037B\237$\340F\035n\201\034y\013W\221\342\n2)V\270Q\257\256\370\023`?\306z\344\264\266\332\247\016\272\212\207\305\260(1\310\200\033\365#*\376\004\t\331,\266\263\230\2459\362O\355\020\214)\376E\\\030\256\274\246\205\262\337\271 \324\210\2648\216\272W\004n\324\323\222\274\250\300wOPAv\257\024\237\261\205\331*\211\206]\237\325\r\267\225\237\332\355\237\315f\263\375@\272=\013\352|\336J\327\363\326\300\337\334!\200z\300\001W\301\275\201c\356\026,\026X\241\"\205\303\271+p\314\001\261\225\304\003!\nS\346OO\364>XU\023\244\203:`\311\231\024=\365I\366\273\237\002\205"
+	.ascii	"\2207\237\021\202\255\267K\b\022\254t\317I\233\032\221\373\001"
+	.ascii	"J\340\331\237\031@\016O\355\026[\206\215\214P\373k\2749!\250"
+	.ascii	"\310a\2127h\346\026\300\177\301A\021\371L\367\216\264+\364\375"
+	.ascii	"\333[\343\321\3649y\277\032(2\303\342\366\332 \341\035K\341\035"
+	.ascii	"K\032l\373\352kC\354\035\033\303\361\346\310S\222\375\372LX\f"
+	.ascii	"\025M\255\203fn- \227W\362\356x?.I\336\262\026><\252(\341\201"
+	.ascii	"\344\365\301\343\245\032y\251 \210|\221\327\307\331K\245\242"
+	.ascii	"\275jh\260B\204@\237\f\tM\255X3\267V\312\226O{\211\274\224-h"
+	.ascii	"\257\221\023ES,H\360\202\274J^$/\333\003y\331\232\322\376\307"
+	.ascii	"\237\275J^&/\333\313\366V\337&h\207X\037<\240M8\034\247\326\266"
+	.ascii	"\036Z\276\354}\362h\264L_(\r\024\231\031\"\001\333\361J\211{"
+	.ascii	"\351t\274t9\236\354\225\"\367\322\321\331\275xN\260d%@\233"
+	.string	"\334"
+	.ascii	"M\251\030\232\271\265YY\376\306{u\243\274;k\237\233\330\253\367"
+	.ascii	"\346\275\327\267\361^\217\236\204\007{\365^\276\367\372^\337"
+	.ascii	",\357\226&p.\226\003x\307\362^\257\337G\301\322\315\3645\336"
+	.ascii	"\277\337\360\027(\302\013\330\037}\021A\f>\327w\275\200o\340"
+	.ascii	"\213\370\"\276\202/au\350\372Y\257\030\243\264w\214\033}\277"
+	.ascii	"26X\256\316-@ul\210\243\353k{+A\022\221\274\264\226\b\275\207"
+	.ascii	"F\016\237\337\342\302t\277\205y\315{\250&'\276f^4/\342\233h\364"
+	.ascii	"\"\207G@\r\211\210\2268h\350\375\007\033\177\372\241w\303\352"
+	.ascii	"\016?)\231k\245I\021t\234\342a\337\316/\237y\333\344\3004?3o"
+	.ascii	"6\033\371`\001\317\257\f\274\225\005K\ra)R\032\231\\\bou\301"
+	.ascii	"Ri\r\370\213-N4\004!+\337\273d1\260\215|\306\273t3\3450\260\330"
+	.ascii	"#\377\344\360\206\020\340EBx\254\257Y\020F\003\021\230\301\300"
+	.ascii	"c8`4\264\034\260\216 [\260\314\354\327\354\005\336\341{ip\231"
+	.ascii	"\033}\256$/\n\005\275\020\354\343\003\320\007\275\217\221Z\331"
+	.ascii	"\342\221\273\300>\270\344>\370\214\n\243\251\031\275\b\364F["
+	.ascii	"t|\033\326(\310X\256\033\336\255\204?\257\341\211\3722\374\017"
+	.ascii	"\037,\267g\227\341\233[t{\211o\314\214\374\316V\240O\220\200"
+	.ascii	"tV5yM\222\027y\336\b\214\344D\017\351ga\220\255\260\022\002:"
+	.ascii	"\343e*0\223\226\r\256\032\253F/\"\25549\206?>Q`\324\314\3471"
+	.ascii	"\274K[\320\262\253\363\371\233\260)^\0173'o/r\347\271\024E\r"
+	.ascii	"\323;C3\267l&\311\213=\357\004~\222\335K\371\320\036\321\317"
+	.ascii	"\352\013\337\363~\341]\272\247\301\363\374UU\007\242\264\205"
+	.ascii	"\235\327y\r>\267\221Z\331\222\002C\211\002\323\305\301x;\357"
+	.ascii	"|jR\262\n\260\034\\\206\002\323\331\301xxF/\352\274_\361b\227"
+	.ascii	"\351\335\0313'@\004L\357\304\\\360\006\005\244!\213I\362\242"
+	.ascii	"\343e7\370\232\177\254L\t-U\265\314\221\252Zj\350b#\223:j9\265"
+	.ascii	"t&\223S\312*f\ff\323*\271lZ]9\227\315\017=\305T\302\240\321\274"
+	.ascii	"\241\321ti4\2271\252\224\315\r\244\2248WUK\252+'\326\006RJ\243"
+	.ascii	"\246\201\245l\227RVT\032D5\235\242\202z\206\222\252m\031M4\232"
+	.ascii	"N1f \235<\235\334ic\313hr\016\265\214&\247+\0311\230S0\204:\207"
+	.ascii	"'I\203IE\225\303\323\323N\244$N\033\373\246e4M)\231\315\245\323"
+	.ascii	"\311\212\271\241\227M\254+\345\022\206\333\336K\017\224N\253"
+	.ascii	"\252\244O;cT1\257\256\226\316d\322\352*\251lb\305`\302\250\262"
+	.ascii	"\212J^-\235\313\246R'w:)"
+	.string	"U\245\244\242\262\212J.e\\%\257\232\312+'PWY1\235\315\245\007\356\213b;\245pzjJ\331\366\262\251\374@\252\251\224\201\323Nc\317p\273\271\274r*\251n\256\224M\034\032K\251*\006\226SL\030VM\t\244\2303z\232K\032L\252\236\253),%\214\245\n\347\224\022\253\203%O\363\252\202\030UL)\345\262\005\r&\224\225\007\315\245\363\310\201S\t5\203\nK\312uVY1\257fX\335H-\247^(\253V,\245\254\240dD])_\370\300\200\301Ta%e\\V1\247\226TJ\b\244\250\242n:\252\2119\025\345T\305TR9E5\235NM?m5c\331t\272\262\262j:\351\300iy\033?\020\260\"9\260Z\277\365\264\2032)\202\025\301\201\335j\3438\216\237Fx\342m\260\272\321\342a\031\233\266\3063\217(\355\251\347F\213Z\326H\330\035\212qzj?M\257\205&"
+	.string	"\331\312k\032\021\310\364#"
+	.ascii	"\333\256\226\213\351\207\342\352\020\355V@\233\216Xj\227\020"
+	.ascii	"=P\f\330\030\223\2106!^\304\273\2316\316\206\370\241\263\272"
+	.ascii	"4\211o}xB\326tI\351a\245\367/\325\"\202R\262|\355\262qDDR \210"
+	.ascii	"O\372\214\307f\r"
+	.string	"\2107\212\253;\223\370\246\205t\364H\237\361\020\323\034\275\321Y]a\342\333\220!\233\226\020g\3343i\306\254J}^\306\315\246W\316\230\271\235Y2\204\262\031\245\025\367\236|P\"<\260\\c\236\327,n\264\bW\026\006\3166mY\323!\370\354\363s\243E\2625\034IW\320>|\371{\036\266m<\374\007\300\367\362\347!\256\316/\361\r\304S\233D\230#\350\337\254\371\360xn\342\277\\\030M\374{\371\021\276\b\247 =\325\316M<\364w\332\252k~\035\002Q|\207\367/k\202&\036E\326{\033Ts\364T\177\2161rA\306\325qQs\346\303k\201\263LOAhW\037\266\353\257O\302\244\247\0307\332\236\031\001&$\313\361\312\230\330\303\005S>#q\204\311\357\327\373\275\347\230\366!\375,|\036\036\242\361*c\364\311\247\231\317{\353Wy\242\351'\3423\361i\224\301Y\335^b\207\247\366"
+	.string	"^F\236\3657kH\364\327N\022\367\262D\253I\322\205\261\304{\326\363`\253j\205Q3\025\362\323\027\375\263\3153\333\342\213\336\377\034gIU\r\261\304\267\370\316^e\264r\366\325\004\263V0r\002\360\002\202\257\250\322\340(\324\322\240RhfDDF\222$\035B\013\020\210Ba$w\347\001\022@4E\320K\347h\222\244\003\020l>[\207ii\375\201|\343\365?\317"
+	.string	">\247\361\030T\261\267\001\256;n\371\340\b\310$\222\203\025z5\317\257\342\344\255A\022W\254\330\263\354a\307\311S\004\342*"
+	.ascii	"\215A\202\360\260{\225\214 %\325\372\322\214\027J\315\210)\325"
+	.ascii	"[B\3301\302X\316\367\276[\204\251\230J+Th\321&\370\372\211\t"
+	.ascii	"\352h\266\224E\317\254\206\247Bh\240\247\177\271%\250S\350VC"
+	.ascii	"\273\244(\364S$\247\245\032\367\2072\250.\3507\202\001\032\366"
+	.ascii	"\200E#\322g\260$\221\254\"\317l\255L\356\n)\023\245\331\260\022"
+	.ascii	"\241 \n\341\323\277\023R.\276\213(d)y\355X;o\305\247\231\316"
+	.ascii	"\341\005r*G\215pJsp\310e_R\\\224x\323\320\362rE-\270Kc\035\321"
+	.ascii	"\272\361\370\350\236\237\336VD\371E\256/\345{\3277g\225a\001"
+	.ascii	"\2321\177\227\257_[\257\366\211\323\263\312\324\275\203\253/"
+	.ascii	"\201\326\266Q}\271\310<\347\250\335\034M\250\262)\276\354\352"
+	.ascii	"\241\"\006\251J\361_\204\335\020\222\354B\355/\334*\312uZKM\f"
+	.ascii	"\003\334\310\216\264\204!\001#\005n?\024\256\205g\3154j\244X"
+	.ascii	"y\260\337\225\236z\016\344\b_\264\352>\242\213Gk\230N\262\"r"
+	.ascii	"\365\245?\225\272\320\373\251\232X\364b\215\214zq\032\245@\202"
+	.ascii	"a\335a\3617d\324e\361\207\321:6\0014({\311_L\207\210\361\321"
+	.ascii	"\303\221\267Lk\347\316m\303\006\257\n\265L5\232~\300@x\357\367"
+	.ascii	"\016\r=CW\240yX\273=I\203\023\255\375O\n\226\346p\307t\375\327"
+	.ascii	"Bw\215s24\235e\fHU\213\032\030i\241\206<F\327\356\367\334\334"
+	.ascii	"\340S\207f\372\221\f\212\023\375\242\\A\314\f\305\0234o\361\006"
+	.ascii	"3\205\005/L\206\367L)\017\013#Oe%\004K\374\216\240&\220F\026"
+	.ascii	"\020\2161\356\177\243@\237>T>?\022N\026\206\374%\231\306\374"
+	.ascii	"g\266.\202G\257\r\334H:ITW\236Y\254\335BX\006|9c\376\303\337"
+	.ascii	"\2411pw{\006W\374\234:\275\005\275\f\007\271\314"
+	.ascii	"C@\354R\006H\272\240\001Y^\257\273k2\361\017\360\356O!\nY=\032"
+	.ascii	"Be\202\266S\267\001\335\316O\203\006DeW\342\020\200Ev\036\227"
+	.ascii	"f:\213\266\376\236{\310\331\"E\320\211W\t\022\034\233>\003s\314"
+	.ascii	"V\t\375'8\001Ib\277K\270\234\n\205\261\223\236D\251\213\227\230"
+	.ascii	"\345VX\255tu\001\214\017'\257\027\027!\322\305J\023\210!X\260"
+	.ascii	"\244u91,bt\336\202}\242\211;\221\033\223\310\357\202&\306\326"
+	.ascii	"B\230%\252\2276\340)|\003\004l\004\367\006\312\0324\212\306\356"
+	.ascii	"\202eE\n[\001\315}\323W\002D\021\365L)>\340\200\325\363\bQ&\316"
+	.ascii	"\235\366qd+\202]\370\317\"\230\303\321I\233\231fz`(\264q\363"
+	.ascii	"\343\353_\0266\210Ad\257\205\331\315\302\006\376\\G\207\244\022"
+	.ascii	"\205\272o\260\232\270\274\307M\235LE\026*\224\013\216\263W\271"
+	.ascii	"\225\331q>\2271\021N\212\356\374\311\036\241F\032`\341\3166\250"
+	.ascii	"\351^\256\322C\335S\330\"\262|\"\024\215\032\223\02648\364\340"
+	.ascii	"y\216t\031C\017\016S2L"
+	.string	"Z\322\033P\334]\017\200M\311\022\215\335\177\336\242P\307\331\370?[\365D\207lE\223r\3110\330\333\241\005k\007\316L\266\r\254:3\317\245f\315\340_\200gr^\265\224h[\357\254\342w\367\233O#\"\200\212@\325\214\200\206\377\212\"\220p_\340\222\303\367\311\273\226?\032\2259\027\324\"T\326\361`\226\333\367\370\033\222/\226\235\314\365\202\345\"\213H\307\273\004\261\311\022<\\PsC[\350L\233\007\026\314\251\027\021\233\306\256\213\324\312\213\0013\273\200\026\343\322g\241\001\353$5jD\037\020\205,\023\005j\215<<;\301v\232\303\022C\225\367* \271\204\2237\355\"\013on\243\352\230\030K\327\375\035\006\304vB{mj\274\253\263\r\220C\320ZY\235\257\b\267,\177\306h`\341rQ\177\234\242\341\257\312\326yw\003\246i]\332g\321\327yH3k\034\307\"\365\3504l\304\232IWV"
+	.string	"\332\2746\242\366\205\026\243f\016\261\267\357\335\226\341\013\303\006\351\213\305!\253~\324\366\264\2333\241\353\316\334N\324`jy\325\343jB\020}Dta\027\350\321\261}\350\004L\256T\333\230!0\337\231\263\302\323+|\341\233 Y^\324\275v{\031B\206~\b\260N~P\320X\240\262!%\207\247i\341(m"
+	.ascii	"\361\371H\302\203\265xi\333u$e\177\b"
+	.text
+	.section	.gnu.lto_cliDump.328.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\215\b"
+	.string	"&\320;9@\345&\035\340mx\330\213K\302\351\300\003\366\357\356)Bh\020\222\305\341\241.\305\030\201\234e\204\0071\235\016$E\257'[\363\361\233A\006\360l\313\031\f\"\275\233\334)\005)"
+	.string	"-"
+	.string	")"
+	.string	"\321\235\355\242[\332\216j\003\343\242$fw\245~\274;\354\374\223<\340\023y\207\325\302\356\032~\"\215[o\233\300\266\202m\224!0\273\031\001"
+	.string	"lJ<\001\261\375\215m8%Z\020\016\355\213|\244;i\342\002\273#\223\322\356Lp\201\365\350y\216\346\321\372\200\346\001\216\360\340\252Pm\210\b\370\317\006\250\223)e\262P\317\236\036T\017\373\231\335]\353\310\376\374\365\244\037\306\257\260x'\025\216\007X(\003}\264\253\3024\017\303G\273*_\235\ft\311P\346\321\344\3059\310\016\307[\003\306\311\207m\343\344f\3563\253#[\250\227M\231(\264\"\f"
+	.ascii	"\357b\310\304\023\277h\300\005=\256\261\2550\036\250\006\256"
+	.ascii	"\200\271\001*J\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliDiff.329.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"}\b"
+	.string	"&P;7Po\322\001 \031\227u\334;\037\323\331F\fV\023\225^"
+	.string	"Y{\273\316<\314>A\234\036\002\0071y.\202\336YF\025\rQ3\306\265\323\235\304s\020\351\335\344N)*"
+	.string	","
+	.string	")"
+	.string	"\321\236\335\242{Z\r\353\002\203b\344ew\245v\334;\364\374\213\034`D\372\016-\204\3355\034\221,n\275\355\001\333\007\266M\002\037'\273\02510\213\022K<l\177c\033\316\007\226\316\241}\220\207x7A<`\267Dr\332\235\006&\270\036=\317\321<^\027\320<\216\260sU\250v\203\003\374\310\005)\325\\\241&\364\263\347\007\225\303~fw\327Z\262?\177\275\351\207\361*+\033.)\031\017\231H\013\2016\314\312\266O\002h\303,c\036-\204I\221\366\331$\326-H\017\307\234B\326I\006\216\353\344f\3563\253%_)\325i\205\212P\211\f"
+	.ascii	"\357b\310\304\023\277h\300\005=\256\261\2550\036\250\006\256"
+	.ascii	"\200\271\001*J\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cmdTable.330.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`S\024\375W"
+	.string	"J\210\344\036Q0\326*\352\263$\264\241\226v\013\002\327XKF\264\220\316!Mz\321\033\352(|r-\3160'\373\311B{\376\003d\262\027G\366\n\022yBd\344\375E\3101\035\323\341\276\307}\017\336\361\274\226q\274\032\366\230\235\300\312)\254\377\277\220\255\311$e\364\001\367\001\306\001|p\nc\"\243\202:}\020\2664\005\032{\301\364D\260i\212(\312~):;\305\177J\021g\025DMO\247\0258\205\375 B\203grn\241AJW{b0\331\037\204\356\237\370\013\361\004\366{'/<M`@i(]I\241\025"
+	.string	"\222\375It\357\304_\311\0178\360+\313\007T\t\367\300\351\013(\353A\203\017\276\250d@\rp\272\342#\300\016<\360gz#\257!\212\240?\202\340\364\345CH\237(\031\177\303\017\341\277\3649\274~8\2405\334\200S\327\233!Wh\r\360@~\006\3764\274\020W\032Y\020t\211\250\351\211\bN]RE\242f\274\322\367\340/\303\247\256)\037\203\353\007\324\bj\251\256\266h\364\271\202\377o\313\305d\005z\004\tN]1$\341\242E@\024\333\356\321Y>\334N\241\205:)\301\351\315#\005\272\244\tN/\224\036\324\311\007\237\340\364\347@A-\224\023\260\252"
+	.string	"'\236\340\026\317\235wc\007\225\"jz\002F\001\326\310\3326\216\316\316\341\226N\020\2252\005\247\357E\016\n\205\251\340\364\251\310\340\240Rh\025\234\376\022\364\nJ#\013\030\306"
+	.string	"%\266e\243\263Kp\353\006K\003\374\373\245\033\340\364\231dm8\350"
+	.string	"\247Vk\r\216\017\326\361"
+	.ascii	"\315)\001\313d1\333\222\321Y3\334\2429\363A\b8\265q\312\340\300"
+	.ascii	"6\215l\214\b\037$\001\247H7P+\305\thF\353\200/V\334\002\257L"
+	.ascii	"@\001\247+\200\301Q\303\351\r\033\033\004\250\270p[\205\204Q"
+	.ascii	"\210S\020\266\3344N/\310\241\226\n\330&\352\367\343\221\200\215"
+	.ascii	"\001\263/+\265\355\224\316Z\341\026\013\311B\376\371\340\221"
+	.ascii	"\301\225\022\367pj\243\312\016\242\246\247\337/m\001\247\n\310"
+	.ascii	"\354\253Z\027`\366U_@a\027\210E\305D\237\337\217\207\005b_5\326"
+	.ascii	"\242V\026\025\004\373\"\241\273]\370\375\342\305\b\013e\251:"
+	.ascii	"\221\340$8\025B\302\005\307\007\205ppBe\020\300\004\247O\323"
+	.ascii	"\324\255r\257\360\233\005\213\320\017+\247\022\242\246\247%8"
+	.ascii	"\r\312:\233\240\226\312\252M\224\353\026\261\257\021\272\033"
+	.ascii	"\305\357\021TN'\347\023\234\006aA\241GpP\225l\212\321\007\203"
+	.ascii	"\260@AgdYai\275\234\354\373Dw\241\360\033e\210\263\n\034T\204"
+	.ascii	"L\2103\212\024\234\006\ty\332\361A\240\255)h\016'\2538Q\260\353"
+	.ascii	"\303\276?\350.\020\3742YrBQ\301)\320\036%\247\024\256\202S 4"
+	.ascii	"\327\t\250\313\025\364\226ee'Vd_#\272{\204_$MZ\230\316,T8\005"
+	.ascii	"*\302\003\027\264\206\f&9x\356\r\373\016\321\335%~\211\350\360"
+	.ascii	"\001\006\032\222\303\026\016g\325\351\005\247?_\300\240d\226"
+	.ascii	"\325V\324\317\235a\333\251K\203\220\017\210\232\236~\266\\UE"
+	.ascii	"\001]\245}{\350\256\f\374\376\270>J\374#u\323\237%7\006T\352"
+	.ascii	"\203?KaP\0313\230\234\230j\232\n\242b\177\037\335_\301\357o\353"
+	.ascii	"\307\006+\316;\030\367\251\302\204\017b=\247\030t\206\323\225"
+	.ascii	"\031-\241(\366\360\347#\005\206\243\007{!sFk\250\211\375N\350"
+	.ascii	"\376\t\376x\356`*;\247\03148\305Odun\037d:\325\264a\361f\177"
+	.ascii	"\226\356\343"
+	.string	"\360\237#\007\007\201s\256i\203\323\030\026\0231\253\023\013\355JWXZ->\315~%t\317\206\377\022\337&V\265\346|\203\263p\032s\242\246\374`\314\2078p\264\\\210!\303\337L\231\030\017c\3169tp\n\333\252\023\007\200.\373\277\350\336\212?\360J\013\314\r\303\346\310\274\234{>\230\346\264\203\326\240\272\222\363\"\013\025\177.[`c\264\234w\316<8\205Y9\243\230\003\343\243\366\037\241\373)\376V\276\n\fJ\352\334\203\003/\252\215\242<\302\006'd\322\314\021d\263\223\274\314\311\216\013\315P\314\273pw]f\244\\\217\354HfY\206<\013\252\215f\303\206\rq'\321\310=n^\356\2468K\322#9j\221\344\263Z\266\321\"\020{\341\321\254\226i\021\210{&B\205\325\222\324\321{/\267q#y\003\240\232\272t\325\334\270M\235\033C\244[\213j\243\351\336.\3241\303\200\246y8\316j"
+	.string	""
+	.ascii	"\325\254y-\230Y\354!y\2245\222\231M]\346\242l\352\\\002\325\246"
+	.ascii	"{\317\f\307\334.kB\325\267y\371\252Y\250\216I]w\355\023Cr\367"
+	.ascii	"\0034d\352R\367\037\240!\232\217<\232e\232/\0347\237e\232\250"
+	.ascii	"5\2574\303~\353=\222\324\321u9\3134\275\353\365\031\031\253e"
+	.ascii	"O\250\226\260Z\232\241Yf]\031\232.p\035\311]v\255#\357 \221\312"
+	.ascii	"\241z\203`\357nE\343\016y\321\255\227E\020\304\250$O\367\"\223"
+	.ascii	"${QP\265Y\254\026\333\305z\261al\0226\215Uc\337X&l\023\266\216"
+	.ascii	"\315c\241\260T\330*\036\206\347\361>\376\307\327\3606\274\016"
+	.ascii	"O\344\217|\323\003\361K\036\312\017\361F<\324_y,\217\304W}\230"
+	.ascii	"O\342\317<\232\307z7\037|:\237\347\241x\255\237\342\302py\\ "
+	.ascii	"7\310\255\341\332pw\240\340\366p\223\334&7\210K\304\225r\245"
+	.ascii	"\356\324\325r\251.\230ku\313Lp\331Hp.\271\334\\3\373\242\321"
+	.ascii	"]5\374\256Q\202E\232\006]\302CtdgN\"\037,\202\323! FP\353\204"
+	.ascii	"\312\n\030u\265o\030\335\025\303/\231;f\250G\0227,\244G\006<"
+	.ascii	"\327|P\250\313\0214\007\225\025\360\267\004U\347\306\260\347"
+	.ascii	"\020\303\037s\324\334,{9\304\320F\323\273\360\326\2659\352\333"
+	.ascii	"\254f\336\364N\337\306\036\256\354\215=\025\252\257\027\272j"
+	.ascii	"\251E\362\266s\344n\324\263L\363\365\302Y\2469Pa\265D\272\231"
+	.ascii	"\341Q\016s'\017\250\342\250sR6{h\226B\325\327\215p\265\001B\n"
+	.ascii	"%\334\310\235\314\036\214p#\247PB\356$N\034\367Q\326f\270\315"
+	.ascii	"=\356\005\352\356\350\326\2563i\216;\013Pm\234\3545X5\n\252;"
+	.ascii	"-\222\f\324\206\352O\001\325\226D\2165\026\025\207\333\342\253"
+	.ascii	"\226:\327@}\325\314\343=\021F}A\367\360(\2514w\275\020\247E\027"
+	.ascii	"\262m\267\013\223t\017w\210=DJ*\223\222\2726\313\220\327&\250"
+	.ascii	"\346\366\351W\305\265\3248\332\0039W\315zw\024\356\036\352\200"
+	.ascii	"Qm\265X-y\271\026%/\227g\274*o\247\2218'o\271\334b\214j\313\215"
+	.ascii	"\273\233eF\272\365P\2275\027.\252\003\325&\356\334o!\2567\206"
+	.ascii	"\274\366\242\362B\356\252]\213\235\274u\032\325F\343\205|V\303"
+	.ascii	"U\334F\275\033\217\325\256w;\262\233#y#\373ms\034\231\305=\003"
+	.ascii	"\346\242\226{\307\202s\322,{7\030\260\332I\223\344\246\316\261"
+	.ascii	"\250\345\027U\034{di\324B\270\343\005a\241\252w\033Gv^\316:G"
+	.ascii	"Tm4\237\026\307=\253\001U\0227n\243\027\273p$\267\031v\315#s"
+	.ascii	"n\334H&I\362\322\350\326\263\254\372z\254\226\270\260\334\355"
+	.ascii	"\020\227}\275\250F\365u\\\313\236wz\314\276N@}U\223$\217t\317"
+	.ascii	"\342\030f\255#,]T\001j\201\320\250q4\313\234R\""
+	.ascii	"2\""
+	.string	")H\n\222\326\241\005\3040\004\231\255\007\021\300<\306\2341#M\322\030\300\021\213\236\364\0174\213\031x\021\350Z\244O\273\236\213\240\366\301\347KA\307\020\317\370\035\213\2170\342\243\277\315\3576\0056\225\n\\\203\013\215\3703\2006\005\231\277k\327_\242G\343O\347=\240n\030\237\215\034U\213\211!\006\212\035\356\203hT\303\320_\350\303\007\206\275\205z\031\2063\372qCe\354\221\356\202\244\265\017Z\017F\234v`\220\271>\247Pm\nkn<\377\177Bv\243\201X\246T)\\\321\005\021\360\264\343a{C\216\360\351\244\212\234$\375\204CS%x/W|\3674az\nbiK]\273dN\254\347\340N\207\364\206z%O-\345\373%\267\016\320\267\334>\341\314Y\250\276T\252\244\242\345m\231\272&\275=\022\3502\r\240\025\317\256\344\237\004q\233\225\266\031\216\032\023K\264\034\263\265\260\021\220Y\2673"
+	.string	"\225"
+	.ascii	"T[\270\004\307\335\366\327\200\277\355\330]N1\003\307\305\210"
+	.ascii	"b>\371\340\007ul\201[\221\211\203s\"J\375\271\234\337\302T\301"
+	.ascii	"\020gN\214\302\202{\260\344,j\r\025+\330\007Y\247I\263"
+	.string	"b\240\\\310\365\"\255\276\005Q\356_\225\005L2\265\236\252T\217\200\265\231#\025%m\212\372\326\330+p)\005N\301\240\030\177\034\247\205d\224'\260i\020f)\226\177\274,\030\257%\037\206\207b\267\372\234A6\235\325\236n\302\356\271\212\267\241~\200\206\241-0\307\250\323\374\236\312h%\210\006\036\314C\003\302\255G\210\203\201\007\270}6\326\274x\026dh\204?ky.\3721\377\231\235\226\335\020\307\202WQM5+\023\311\300[\365-)e\205\315\3561`\001\326^|L\272\374^\214h\370\235\201\2018\316\301\314`a\223a%4\352\034(\367;\352\236d6\303t\252\244`\252\311N\242\"\326\003\261*\354A\030\253\302\025\241\f\"\005\003\207\177k\301\304\\\256\204W\376\035\032\200&\245\262\251\266\312\0047v\302\325x\273\021,\f\341i*8\313}b\342\266H\314]L\375\374F\0134\254\377\032F"
+	.ascii	"\302\226\205C_\200\301\215\2057\t\300\327[\220\302\004\017!\257"
+	.ascii	"\335\322T\240\305\013\351\260\240/`\336\306\302\211\354HG\210"
+	.ascii	"\223\372\326\236\237\202\360\\\032f\270q\035GG\305)\206\0309"
+	.ascii	"\217\254\366k*\004\236\240\203\267Z%=5\370*\tP\2606\351\036\222"
+	.ascii	"\007\206\327\205c\201\004\206\357\342o\271f\3052s\365um\342\f"
+	.ascii	"\316\326d\003e\252\223\264,\326\310\301\360#\372\207\342\222"
+	.ascii	"\003\006W\312\371\274P\315#R\266\255/\307\335\347A_\200\225\215"
+	.ascii	"\2057\t%\030\031\3636\276:~\314<\016\\\233\212\036\372\b\214"
+	.ascii	"\243\261)\311\301D\336\354b\234\307\332\275\336w\376\213\212"
+	.ascii	"$\314 \252\313\003\251\020\356\021\027\320\222\206\372\271\302"
+	.ascii	"\027%\321\313-\312\302\330\244\325\323\227j\302\330\254\025\201"
+	.ascii	"C\325\247\003pE\210('\036\207\261(I`A9M|\230\366\016\336\b\200"
+	.ascii	"\f\247\342\254\f"
+	.text
+	.section	.gnu.lto_cliHelp.331.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\373\005\265$"
+	.string	"*A\240\016Gp\236Q:\210\201\001\001\001R\201f\227\207\374\372G\025k\311\004^\206\241\201\366\352T\030\257\336\225C\374\323\235\215F5\224\264=\364\217Fs\245E\006X$U\275e\276X\022t\035x\033\037\261|k\215\020\"w\222\001\327"
+	.string	"\305"
+	.string	"\335"
+	.string	"\316\260{\225\016\030\311\366\224\225\007\240>\265]\247>e \363Y\337\260\213U\303bS\325e\317\275\267\327M\030\351\250\362\234\263\300\017\t\005\001\345V\334\315VSS\264-\220_\323\200.\0013#4\373R\f~\210\353BdD$6H\n\221\013\335-o\200\214\230e\201\320\263\031\302<\031\021\013\305\240\365\354zShsL\214\307\257Z\306#\307\031\371\315\310\2357 \205X\304\332\fh\031\211\274\206\036\225\211U9\031\221\bz\340\250\004\314Z\254\262\352\311\210GRTW$\f\234\240\342\024\332"
+	.string	"\316\024#k\221\312\242\350\202:d\362\004\025\245P"
+	.string	"@\236\f\357\274\265*R\331~\363*\272\316\232^|\264\214\307\333\232\206{/\333a\321x&:\36390\263\2179\035\021\352S\333\317:\352\271\222\365\225\344a\377X1eN,h#9J}?-\345H\331>\\\263\272f\206\302a?|\337y\242'\032\233(|\352Hu\260\357\bY:\273\221\314\312\240\005\212\343e\205{\213Y\200\321\223\177\321\225\277\356\314sn\375\2263\256-\337n\331v\313\265[V\255\345\364\226Qk\271o\331\266\345\017\260\320G\351u\205\211%\326f\312\013\344O\332\035K\313@9\363\337\342\344s\3417y}\312\357r/\3003s\240\267yy\030\033t\23553\330\236\356\320\177\311+C\230"
+	.ascii	"\374\226(\364\022\271A;H]t\366x\355\271W\311\340)K`\266J\035"
+	.ascii	"\317\006\267\314\367\372\027\360\311\035'\272w+\271\026\320o"
+	.ascii	"\236(A\331\030<K3/YB\373\307\206Y\217,3\b\021GW\311*c\302\016"
+	.ascii	"\342lsB \321sk"
+	.string	"\244\233\333H\374i\006\307\306\354\232\262\005\260\265\376\227\277I:z\336K\365\341\t\033\325\006^\212\025\n\256\222E\306\246:\370>M\322\362\324\230\324\332\030\023\001\2566\277\001O\261Z\013\t\301\272\360)\262j3\263ha?\344\013I\244\3260!=\325\374\np\245Q\373\306c\332V\326W\233)R\021\252\215,\363\264\317\004M\233\205\213\243ar\300u\346\307{\232A\333h9&\255\213\337\024}\034\323F\362u\250\335\327\032\262\272\266\315\254\344\263\037v\247H2\325Af^z\030\023\357y\257\024\005f\216q\260_\002\256{\245*\210\371\230\031\350\235<\345&'\365C\247\314\203B\300\333\241H\372\260K\341!D\007\025\033J\354\222L\0241\024\202\033\016He(\004;\007;\365w\250%\031\276\033J%\242j(\341\226j\374h,5)\231\200\321\344\253\261\357\301\217\206\257W\343\247\324\324\363=A\365\036"
+	.string	"`'\033KO\275\033NNO\275Uy\337[WI2c<Z8t\300\352\372\\\216\007\370\225"
+	.string	"\230\305F\225\304{Z\324\314\033:\004\270J~\215Qu\220\355\022?I\204\032\311F\267\263\245\212G\354\030\204\346\3266j+0\277\365\213\033Q\030\032Z\330\025\240Fr\004,\253\200\007ab\305\251\002\263l\305\350\212\353/\377\037L\2546U`\366`\276\266\025O\213\031\026%heG\357\2757\327H\276\363?V!\351Q\005\206\373\243TF\323\265qm\305\374\347P\003p\250Q0\345\0303\310\230\210\004\"\"i\322\034\220\002\021\2522n\020H\250Dj\222\326{\300G&\214\231f\253?\007_-f\250\233\033E{c`k\355oLYJ\230\242t\237\2123\264>wa\351\310\032\311$\337c\204\365\333"
+	.ascii	"z$\363\322\036[\324\325\330\264\300\222\314\372W\230\322\202"
+	.ascii	"\224\304\315\036\267Jt'erW\341X\321\211\2249\302\3041vx\334\205"
+	.ascii	"\201\017N\361|y\256HS\034\340\033\202\370'_\016>\243\f\1770N"
+	.ascii	"I\020\377\342\353\362#A3~)#\242f$sEv\251\247\340\013cG\335\272"
+	.ascii	".O\340Ve\n\013\2528Ji\003\247y\313\233Sg\315A(\302}[^\004\034"
+	.ascii	"\245\270\340\303\304\355\377\005\212\025BuOX\360_\374\026\264"
+	.ascii	"\3202p\377\265\370\300\030\250\021]\3603FJ)Oa\206R\001"
+	.text
+	.section	.gnu.lto_processCharacter.332.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\221\tU7"
+	.string	"\352^$\025BP\244N\007\023\331o\325["
+	.string	"\241\262Z\331\233\220ds\225\321oY\006\226n9\240\032\203)F\3455M\023\370\2545)\001\001P\240q1\372\311`\004\206<\377B\344"
+	.string	"\204\242\016j\264\311\336;\245\224\002B\001&\001C\001J 7\313\211\0067A\203p\203\367\3129h\225\025\3105rm\225\355\243\265\325.2\263;\263\204\nm\303\371\340\277w\254M\231{\265 \260\023\333j\313\214\347o\231+&$K\343\262\033\274\367B}\024\247N\345\232\217\314~\333\003\004\004PJB\"\035\031\025\001 :\032\207\212\304!+\\\325\364\275\345&za\365"
+	.string	"\001\251\2040^d\214X\360\2605\033\363\315\003\270\265\271\022\025Oz\233\342HaT\022\003\267@}p\320\262\257\267FJ\231\236\220A\233\215\271\2266\275\351\343z2\337\374H\255\215\212\312\276\322\032@?\231hl\3143'J{\017\211\263\237L\262tC\031\240[;\231\370\361"
+	.string	"\224\257\2616\366\223)\306\306$\363!a\224\263{\210\223\fPO\331\327X\027\325\322&6\346\022'\026\275\270|\230\376\234sM?\231JR\r\\\332\320z\256\017\2601\2238+\214\202\362\025\326B\017\353\025\254\325\364(\211\2309G\257\255\364\301\034+Jz\356\207\247i\003A3\177\220D\246,\213^Z\376O\246\224\264\351\336\333\\\332\273\274\224\356\302\250{/\373\322\353\253\231@3\367 f\236bf%\004\n\324\272"
+	.ascii	"R\233\307\312\364\027\230\024\212\242\344\b\232\323\254\334h"
+	.ascii	"\246\210~y|\203\367f\351\365\231\024\334k\255\362\212\251\251"
+	.ascii	"\225E\013\357%\3237 \037\350\205\n\376x,"
+	.string	".rf\027/\274\227\234dH\334^\237\362\261\330\302\363MZ\372M\356\2535\375\316\362\357\237~\272\307e\304\370\257\3321\261}\254K\357\377{\\zJ\217v7\007\341\005\371o2\325\332\017\203\216\216\226\007bn0\035\206\212{\215e\314\360^\266\312=\343\233K\267\220\300\260,\2172\313a\3717\231\333\361\240`E\370\2370'pB\320^\232\231\032\256{\251\353\232\223\220\356\214\244:\037\025\235\215\212\316E\2533\321\320\371Ht6\016\235\207X\347\242\352LT\235\207\2523\333_\232\205\252\363*tVW\347tu\376\325\331U\347~\312\020D\020\256\315I\246\366\177r\227Ht\320\355S\365\250t]\367\227n/\375\314t\334v\355\344\342\227\035~\2054\271FcN\2628\202\021\330\272\262\007n\204\030\260\035\307=\307\305V\271\273\264\\\333^xD\005V\306og\213P\346\001r\213\313\362\250\321\032\336\025"
+	.ascii	"G\344\363\020\362\205\337\305\351\261\325\364\025!\260!\247O"
+	.ascii	"\202J9\235\r&\001\n\377\004\223\250\026\242o2\2064c\202W\351"
+	.ascii	"\024\231\203T\2013\344w\335\265\037)\n\200\367n\361\351>m\227"
+	.ascii	"\224\203\024{\357\326\3606\337Y[E\276\277\321\301\321\362@\215"
+	.ascii	"\206\311\346\356\370\315\243\025\371\t\376x\346V\310\271uE\351"
+	.ascii	"Q\3676\276\264=F5\355\364\315\266\344C\337w-8\365\004\230\207"
+	.ascii	"?\204\360^:}{5\371\301\"\332\016\t\366^-\013\334uT\230`\327v"
+	.ascii	"\254\255\016\275\001\277\274>\320\2700\320$|C\337L\256\314\\"
+	.ascii	"\243\001\223"
+	.string	"Jg\177\355\354\024\312<<m}\bT\221\242\246\370M\366!\373\337\307\007\212\207\345f\260\016\277k\230G\215\370Mn\352\344Z\f\324\362@4\332/\311\336{/<\213\377\204\246G\024\215F\243M\265\262O|\341\230\255\261\367\2533\027f\370M\274f\337\313\370\330'R\346\375\271\205u\247\367\336\313\022\367\272\317mP\364\301\210=Q#\\\327\177\363c\226{\324_\013u\233)\226\r\323\253\237\244\314\223\243\374\373\222E\351\321\274\340\304\b\017 \0264\261@\241\242\351A\207\022\034H\2200!\325Tb\312D\t\021%V\024\340\034:\254nT\2551lP\375\325\215dU\016\253\244\320\252\251\232\251\236\252jPA\335\250za\003\212\n\307\025\324\023\222\223V2p@\345H&q@\025\345.XGe\275\022l\300\004Gz\346vI+\326\244\365X\274\364H\037cK\220?\256BY\314\334\303\221$\221\016\226"
+	.ascii	"\215I\226G\371\310\215,\367\034}\017n\t\302\227\301\331\266F"
+	.ascii	"@\323\241\013|\312\242\007\026\240\377\202X\335\037] \3335\311"
+	.ascii	"\270Q\212\323U\253\321Ku_W\255Eo\364\2755\266\364E/\354^\342"
+	.ascii	"\211]IJ\343\304\352\374\350\366\216\200\275\005\"[\262\027\002"
+	.ascii	"\206<\311\006<\353\fA\372&\231&z\034\336\345B\256Z'\255\231\367"
+	.ascii	"\2625[[%z\241\031\033;h\030\004\367\333\374fu\320M\347@\246\220"
+	.ascii	"\316\234\253\215\322\242=\275\372\266\036k\355\350\233\334`\\"
+	.ascii	"\353h\226Wh\260O\226G\215\032x\337yV+\345\301\031\025v+\303\202"
+	.ascii	"V\373\316o[\205\251\265\302nQX\320bi\265\034\273\374\351\373"
+	.ascii	"\361XC\255\247Y\021\002O\372\343\263\3619\005!\022\307W\200\266"
+	.ascii	"\245\005\265\\\002\200\275\250\201\030\205\030T\n\321\210\210"
+	.ascii	"\bI\3224\006`\002\221\241\253\342\001\020P\207\204$I\222\016"
+	.ascii	"?\\\200\2672v\256\343\370H\215\210I|#\342\020}\335\235\225\340"
+	.ascii	"\266A\321Z\304u$\006\200\233\356\024+\346\211x\223\216]\0348"
+	.ascii	"\202\264\240\313\251\317\342.(\260\222\363"
+	.string	"9\366\030#d\3504\013\3024\005%\036=\207\2214\223\327\317r\320L\351#\250\036\311L\035\334_T\312\032\241;\234\3300R\\\017\025\376B\377\214\220\362s~0`\321]\224\320\321\215\360\313\031\344\257\350^\253qg\037\303\206\361p\243\"\32791\300\240\177\335\230Q\257\215\216f\325Q\211A\270~\377\324v\305\013<\353\342\357\b$8@\302j(aAc&\n8b\230\230\220\371\307\204U(\244\340\212a\217\346\315[\275\227I\205\357\202\025iI\251\003\311\210?}n\224\244\364\t\006D\355n\334\301\251\366|\273\177\020o\315\373\263\277\344\304fayW\227S\001\206\203\343Pv\275\366\215:\253\207-\305\314\347\323y=\353\263'\274f!\027St\233\253y\366\3349w\3714/\0267P\240\222\264\202\025\207>\017\016\377\317\027\237b\346\211WB{\356\037\303;'M\304\372\270(E\215\255z\247="
+	.ascii	"\027f\250%\206\231\257\004*(g~\035t\3231\270\332%\373MX&\372"
+	.ascii	"(\017\372\240b\2548\236\275e<\336^\316l\210\326\030\365w|A\250"
+	.ascii	"\3330[\341\215\215'\255\310\234c|\207G\366\366k\013\"G\250\324"
+	.text
+	.section	.gnu.lto_processCharacterInteractive.333.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\022\rUG"
+	.string	"*w\254\032A0bR\007\367\276\n\364\252%\002a/\337$\334\236\260~\2505\247[\222G\366,J\031\264Z\326qO$\327C]"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\252\022\"XR"
+	.ascii	"}\253\210e8)b\366J\322m\367\336I&\031\234\001\177\001\235\001"
+	.ascii	"S\2765\301yv3\340\260\016 ;\314\364c\354\360\353\306\330a/n\255"
+	.ascii	"\0318p\372Z\020\375\363,\266\307n\236\271\020h*\331a\247\326"
+	.ascii	"}~\266\233\303\204W3i\234\340<\317Uoe\357&y>j\"M\345\257\233"
+	.ascii	"k\"\354\364)\251&3\nj\371\244tjbJ\"\217KF\245$\244#\243\"\"\252"
+	.ascii	"\"q(\013c\370\375\355\324N\354\332\362)\251&\235\334f\276QeR"
+	.ascii	"\0069\267:\3672\343l\245\216\255\226\331QP\257\325\020\301(\316"
+	.ascii	"\255\206y\211\006\245v\034[m\333K\"\355u\320o\314\213\316\237"
+	.ascii	"\336\2533s\235\020\333\275:\266\272\266\225l\331\355D\227\266"
+	.ascii	"\233\324\234i\253y\222\213#_\341\220$[\234[\335\362^\r\376\271"
+	.ascii	"\313\262\217U\274\264\370\222\020K{\245\3437\346\245\305\215"
+	.ascii	"\\\224\234[\275\342\330*\226\235$\275\312\371U\361\212\342HH"
+	.ascii	"\355\265\316o\314\353\314\217\314\260U)\333\310\354eb\253b\273"
+	.ascii	"\350\225\300\226v\346\334j\330\373b\264n|\316\233\330\352\331"
+	.ascii	"&\362g\024\247\342V\317\260U3\273\370\372\034'Z\347V\241\274"
+	.ascii	"\024\306\370\324|\216k\023\253x=\361aS~\017\354uy\342\334*\330"
+	.ascii	"k\0043\263\347\330\352\327\026.i\257i~c^`\036\277\005\376\244"
+	.ascii	"\001<&\3312-vE7l\324%-v\r\331\257\020k\316\335\210\366\272\305"
+	.ascii	"o\314\353\211?\267\n\346e\316\363\354l\276\251]\320\275\205X"
+	.ascii	"\363<\353=\355\362r\r\300\265\336zZk\023Z\023\357\002`lDb\003"
+	.ascii	"\036\277\003\"\367\373\360;\235\277Q!\317\363\323\247\332\335"
+	.ascii	"8\036\n\235B\305\366\251\212\025,\266O\343w%S\242\277\245\265"
+	.ascii	"n\341k^\310\363\314\365@\273\232\fYr\026 \261\303\360O\350k{"
+	.ascii	"\356\256\266\372\367\3373\322C\317\335u\037D\245b\007\326\212"
+	.ascii	"\255\276DX\\\230\007\324\004N\356}k\235\333ii\317\242e\314\330"
+	.ascii	">"
+	.string	"uX\373\214\330a\253\3679\177\327\204\305\241\211\261}=\213\372\326\276\374[\365\217\370\037\006\\\036\256=\250\367\373\377\3579\322%\025\366\177\234t\350A\342\002\357\357l\276A\017\217\r\024\217\366\016\272\273Z\273m\355\267j\355\312;\301=\372\313\264\306\2520\301\312\327\334\013PMI5\231\376\346:\n\312\345\\/\367\326O\036\347Z)o\355\344Z\327M\362\326L\362\326Iyk\344\336\372X\334z\211\270\265Q\270\265\222\274u\222\2745\222\274\365\021qk#\341\326E\302\255\211\210[\027\205[\023\207[\017\345\255e\341\326\302\275u,\334\032\216\267~\341\255\037\336z\303[\373\005\337\263\267\345\307\r\363i\335<'\351\026\232\267\360\035\027\177s\217s\327\272\313\371\253\265k\355m\332\3058\031/\343s\272(\007\204\271\2254\317ejv\r\264\233Lp\r\017\201\f\347c\234\036\007\004\013Jd~Z\257\262\323\355"
+	.string	"7Y{\030ws\372\233\326;\227\231\237^\003\262\001P\333\351\274\253!\311A\216^\t\360"
+	.string	"b\373T/\221\350\261m\271~K\027\207\340\311\032\337\252\225\337\364\236\007.\317\220J\234\240R\032Oz\036\205\222^H\206\327G-\tiP\217\313\217\364\273,kD[|\255u\016\027\264\261\f\334\333\354\221\272) >x\262nHo\325o\031@01#\371\231\\\370_\240$\024\017O\032\323m\304Z\353\021\376\307F\224\331<\317W~\252\314\376\216\236\217O\001\271k\305L\177\364\233/k\304OT\f\272\273G\300\224\035\275\325\220k\305\362\377\030\334\234+0`"
+	.ascii	"\031\005\211\213\277$\243\345\317\237 ;Eo5\372\342;\026.F\020"
+	.ascii	"#\242/z\341\235(\032\024O\007\242\207p\326\366\364;5\202h\177"
+	.ascii	"\021;\\|\247>y\276\360\211\357Q4\371\207\357z\362S\365}=w\267"
+	.ascii	"N\b\341\b=<;\203\332t`\233\021(Do\325\356\3036vp\250\210S\257"
+	.ascii	"$6\277\351\251MSo{\270\324\t\244\227V|\207R\237'\245\233\032"
+	.ascii	"2?J{\315\"\255{*\204<C\254\207\257\274&a\002i\266|*\235\347\231"
+	.ascii	"H\3007\317Q9>G\304K\302\204<\317\321\341\354\232O\354\360\362"
+	.ascii	"}IX\\\026N\016\327\036|\347\267\352-\\*\331\001:\311\213\247"
+	.ascii	"^\352\251\372\0256\215n\200N\332\344\345\3537n>\363\251Z3\335"
+	.ascii	"\030/\037\353\213\004\263\323\300(\032tw7\335\360\255\272\320"
+	.ascii	"\235\267@\371\313\356\274\251\007\256\357\245\030\212\276\t_"
+	.ascii	"\261\371\307\266\276\013Zf\312\257\356\260 \302\202\025\312\017"
+	.ascii	"\fV(\213\3325\210\025JbQ\034\003G\326\373\340\361\302G\217\035"
+	.ascii	"q\214\0342v\2744<\313uV\002\0327\262\252r\320x\201\243*\213G"
+	.ascii	"\217\252\004G\255c\207\f\036U>t\350\340QUt\233\375\3134\326\363"
+	.ascii	"\241\356gJ\301~z\255\235T\234d\005\376\351cd\277\002\213\034"
+	.ascii	"\212J\2219\255I+rT\304\236\223\255\013r\255\365\207=\305FR\212"
+	.ascii	"\374\347\364a\257\240)\240n\267\333u\2558\371N\357k\331/7\276"
+	.ascii	"=\213k^\205\231\261\002\227\007\266\302\225\303|\253\356v\211"
+	.ascii	"\327-7\312\320\026\372\345<;\232a\221\243\026\bm\271v\232\264"
+	.ascii	".PD\024\302\264~\212\240`L\226\004\266\267\355%*\220|J\274mw"
+	.ascii	"9\271,\3619\257r\264\202\263\213\323K\023\022\275@\333!\277\245"
+	.ascii	"\367\310\250<\365\305\177yP\224\311\027\002\327w$\371\001\212"
+	.ascii	"WH\315\211"
+	.string	"\300\025\246\n\257\337d\324S=U?\3621\344m*\362\217g_\356\332P\033$`MT_\341\267Y\026I`T\354\370\314\245?\276\3631\376\322\227M\304\206\274\245\306?\322\303\013\034t\367\334\335\355gO\232:L\202\200ah\220\236\306\267\035 \223<%\253\217z\252\366\344[\267\326N5g\326\315\026\212\234s\004\323\245\t\257_c\323C=U\277\3627\026\216\216\266\203\266\227w|+\034\207\372\t\377S\262G\272Q\264\346\036\272f\023k\355\fc\301H\357n\013\265\225\376\304\024\256\337\332[\027\224\376\210\f\357O\355\337l\351\222-\005\201\026\250\2018\244\020D\210dDD$I\2224\006\341\004\3040\t)T\017\021p=dV\322\264\033\377|,\227\366{>\341\033\355\310\020\314y\223O\003\372\f=\221\246\261L\304\032y\201\357\027\002\bV\001Y\002\b\232\336\200\317\034\t%\242\215\003F\200\032\225"
+	.string	"\237\201\356\306\302\364\373\"R\370\322\225)\213\177.\212tR\247\006\324\227\341"
+	.string	"\224\026-\244R\n\340,\006\322\005Z[Xb=t\305\r\210i::\366\246\320\023\032\320R<"
+	.string	"\332\004\007\253\260\343\324\023\001\303\314\263\206\360\033\n\325\305\241\320\017\354u{7a\234\375\\\234\270\023\372\017-J\316\032\272Fu\244\216K\317^\200\f\363lj\tA_\032\n,\242>\304\033U<s!\213\370,\241>\020k\f\310"
+	.ascii	"\245\357\275.\023\362u\006\357\370\275\367\300\2112\300\206\274"
+	.ascii	"*\023e\306\307F\177Z\226{\222V\031{\242\033z)hd\246N\332 \020"
+	.ascii	"(\003\033wZE8\355\256\364M\033<\334\215\n\223\037\020"
+	.string	"\205\203\016El#\006m\030DC-\301\0219\344\241\357-\306\001\354\3702\215\372A\020\336w\337\227h\325(\023\357\205\370\301\253nO\006 C\244\007~\342\315\206\226C@\005\213\f\236\356\030\203\223\200_\\\025iK\275\232\004a\240#e\205f\264T\250n\027\2559\372\210N\205\024\256\n\312\002\035\t'"
+	.string	"s\3678,T\022C\240\232\025\215\260!\362{\036\343\220\375E\306\033\f}\336\223\201\326$\257\277t\365l\027TE\363\270\002\261\001/*\370\254\353\f\240\204U\316\006(\224\303(C\016\221\205\260\212C9\3658\3559\2174\351\231\034\373g2h\275\253*\002b~_D\332\301\311s\002\235\037\340/\357#\332\202\301\023_\200.\364ga\303\035gi\035\330\200bs\265\232\021\375\344\271t\201x\205\2406\214R\337\033\002\366\013\321\017\3222*\233L\361\214\230&\245L\336EF&?\226\336\262\265\314\351\216\225\323*E\330\276\020\2519\365\234\017.X\207\305"
+	.ascii	"\0047\006\005\303\263\366\272>\323s\f&\032\033\355\017"
+	.text
+	.section	.gnu.lto_cliProcess.334.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"}\b"
+	.string	"\022O990s\322\001\f\331\271\302\n\334\2448\177U\324Q\243\350hU\277d&\031\230\305\363m\033I{\013=.\260\002\016H\322P\320\247\032\324\355\006=\342\217\367\3156B\210\224)\005\346F]\211\223]\211\223\017\335\202\203\344\276\b9\032\260\007\321\360I\t\317\373\244\3505OBm*\333\324\236\240\320\213\336\r\021D`<\353\323\366eX\321Q)\314>\312SN\376\210+Lz\361\232o\332\256}\357\272B\213\006\346d\205\322\230\375\nuAdZX>\336\017\373\352k\005/8*\036g\331\314\251\021\373\2317\332\f\211\355\213\f\332;\004\026\363\002T\322\201\301\3223\347\224\033\002*\370l\025\364\001\306\360Y\210\343\233\035\254\\j\002\306T&\220c\322\272\353\2321\252TA\2449\247U\0347n\355\266\023l\033\330\216\t\017"
+	.ascii	"2\003\302p\301\204\245\032h\f{\375\264o\240\350\201\301\b\305"
+	.ascii	"a\273\214#R\201\274\f1.]SM\323\300\024\024"
+	.text
+	.section	.gnu.lto_cliEnter.335.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\363\001\325\022"
+	.string	"\226c\200J\300\324M:\342\231\204\024\355l\304\354\350\203\252\354>\320B\020ei\210\220"
+	.string	"L@/\254\265\035x\265^\356\326d\002UN\204\006.l\n\325\372]L\002-\337\375\250\320n\013\310\003\220\225\260?\017t\033\035\275Y\"m\357\224\002d"
+	.string	"g"
+	.string	"q"
+	.string	"f\261\250k\245\246\224\372\005\016D\206\322\220\037>_!d\267D\222\253\315u:^\230\330>\265o\364\243\362H8'\260\013t\304\264{\252\030\305\365\316\347O\274w\256\033\360\336\271\264\203  \261:\255\241\036\334\222\325\356\2025\350\345i\351?\351"
+	.string	"L\236\332i+\302\356\232\232<'\356z\333\fl\2076\235\t?\237\003\346\332\265\335\364o\034\207\006_\350\235g`\260XX\035\354L9\345p\265\346"
+	.string	"\264Um\231\007z\323\335\316TS.\247\326\334\252\376\322m\340\324\210\242\367N\301\323\325\217O\317\177\343\371J\247q\343\013\371\003\215\336|\347\323\274w\020|\236\254~\214\210\330h\022\373\274\321\232\302>kw\327\025\310>\322\337\352h\345\214r\250\b\n\375\371\036%\321\211\212]\235\233e\221K\007|\275\263\313\2432i\300\224\217\334\002\312\252v\213\013\275\351\257VV=\016\211\355/\036\255\265\252\340\236n\226p\251\027\327n\016\213\017\365\250\t011\336;Z\023\324\340\021E\204\344d\3410\212XH\231U\325gz\323\b_\310\027dd\274w?bV\035\240\255\372\023C\206\0357\224\027~\331\320\204\035^\337(~)\263\021\004\031\216\237H~/R\026\"|}\241\215\b\362K\t7\2100\337\013\205\226\217\303L6\206\344\314\245D"
+	.string	"\0139\212\025h`\2621\244\2258\266\"\243\211\2013\031\254\006\214\2154p\345\304\242M8\202\244(\216\240\311i;k+\220\275C\205\"g\253\267 *\023\017\250]\266(]\030\311\335j\315\r\250\317}\031\303\263\003# `\002\221cf\033\277\030\022\361\306d\344"
+	.ascii	"\t\306\270O|5\036Q\314%\313\033\273\335a\tr\377\372\313\305\326"
+	.ascii	"\323`-\30316\232\263=6\026\206\233\t\355\017;/xq)\347\203\334"
+	.ascii	"mG\3603\306#`\204DI\333\242|\326\n\253Y\214\206]^\264\201\f"
+	.text
+	.section	.gnu.lto_cliPrintInternal.part.0.505.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`q\001U\016"
+	.string	"&\334_C\020\217(\035\240\202a8\225\n\005\016\374\216\300R\364\201\212\330vQ\271_\335\302t\242\361\357\367\250/\376\353>^\324\206\301O\214\253+\002Q"
+	.string	"\224\n(i4\261(*"
+	.string	"\r\312n\026\250\221\275\267\224)\005L"
+	.string	"L"
+	.string	"J"
+	.ascii	">\212m\021\211Gv\214s'\213\205@\021\351f\354nv\250 \2549:|\232"
+	.ascii	"q\344\277\273\006j#\035&j\333\360\367\260\323\310\b\001\233\351"
+	.ascii	"u\270ZX\357\236\251\255\224\272Q\242\344\311\361\210-\330]c8"
+	.ascii	"\334\330mwlo\354\263\002i\b\323\357\2455\277\272\017@\243\300"
+	.ascii	"ew\344\345\262\037 \213\204\355\333\357Dv&s\370\225JHUB\257\003"
+	.ascii	"\231\347DO\001!\300\255\006\022g\332Oq\025\243\247\200|\300\256"
+	.ascii	"\252\325b\227Cph\003\230Cs\327\304C\3149\342\241\003\036\276"
+	.ascii	"\b?\024\017U\033\264d\244<\374\355\356\252\232\330\326H\250Q"
+	.ascii	"\355O\205<\312\005NJ\362S\250\327\247\017\206\310K)_N\360k\352"
+	.ascii	"M\264^\030N\204\344\313z]\261r\332RM\254\261\343\304\325bU\331"
+	.ascii	"_\375\330\271?\306\032\350C\265\016\310\243Y\210\346l<\0218\331"
+	.ascii	"\004\317\003\t\031G\373\3106\032\177(t\264\f\364\371hY\306v^"
+	.ascii	"Uv\320\201\245\244!\320\0012\252\r\301\223G\371\335\237a\245"
+	.ascii	"\204\305\244\244\367\"\246\351\002\305K\246^S\266GTe\360\302"
+	.ascii	"\224.\373,.\004  \240\002\261\263\035\1778\364#\213\266\234\227"
+	.ascii	"3;0\224\202Q[\003c\216\357\376s\301\377\365\310\275<\007\330"
+	.ascii	"\236\207m\330\020XF6\273\232W\242\233\025$\271Ck\013F\362j\366"
+	.ascii	"m\r\207\177.\016W\343\272\323\257\025c"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.part.0.506.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`k\001]\016"
+	.string	"VY]F"
+	.string	"\261&\035\340\006O{\302[\326r{#\355\f\250\303\211\232t\035\256\256\246#uZ\031\200=\bf\202`\340\315\275QD\226\275\226\240\252\006wR\300\017\302w\333\003\234\255\323\365k\211\347\205\264ak\355\336{\247\024C"
+	.string	"I"
+	.string	"J"
+	.ascii	"\016\357\3219\255\027uN\355\247\260\335\3318\017Kl\213=\033g"
+	.ascii	"\264\262\337\202\325\211\f18v\027;\225$\356]\306\351\371\267"
+	.ascii	"\371\007t\371.\001\270px\024\360\351i\260\273\256\035nz\333 "
+	.ascii	"\266K\366i\0043\332w\361\027\336e<c\206Ve\204\207\326\356*\250"
+	.ascii	"\247\327\274\250s\030\026\312\365}8pj\311B\031\205V\205\005\""
+	.ascii	"\250\247 \307\370\260\373*e\024\356\206\026\307h\177\305Yx_\245"
+	.ascii	"<\300\256\312Fk7Lpj\002\3654\\\201\032\273,\007'T\026\006\006"
+	.ascii	"NO*\304\203\276L\316\215\233\025\371E\371b9\347J\225\375\360"
+	.ascii	"\377\214 0\025\273\032v\350\330\020T\006\212\303\3743\177\315"
+	.ascii	"\245}\373-:?\3460ncP\r\r\215\t\220:\323]\237]\021\033\026\031"
+	.ascii	"!\205\220\\\016JW\211I\351*!\211<0\031!\t\031`!\333$\352\264"
+	.ascii	"I\323\226\241\246i\313H\0206\315c\355\343\024A\303P\247l\303"
+	.ascii	"\264\324\t\366\341aN\202)\205Q\340\270\024\006\372\\\251r\315"
+	.ascii	"\311qsAb\220\362\305\366'>\306[\001% \240\202\241\232\325\001"
+	.ascii	"\357\030j\022n<\243a!\216#\2342(\211v\230\351\332\204f\273\025"
+	.ascii	"\262\3332u\342\367p\021\231[\370\253,\273\274B\031\353-\220l"
+	.ascii	"p1BRv;\254\256\360a\"\364\273\310L\247>\314\205\315\025\300\345"
+	.ascii	"\305\357\224\232~\302\032\003"
+	.text
+	.section	.gnu.lto_getValueOffset.part.0.508.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`C\001\215\r"
+	.string	"VZYA \221\222\016\233\360nxG\007`\273\362\034q\326\2002\013X\365RV-X\361\216\244\207\250\367\2555\344\226\250\205\247\030]^[U\226\201"
+	.string	"2[Px*\232\260 \227\272q\373\201\220\275\267\224)\005G"
+	.string	"D"
+	.string	"H"
+	.ascii	"\376\210\313Xn#M\263\355\207\270\210\216\261\002\024>\037\017"
+	.ascii	"\0200)&`v\267\352\020\300;"
+	.string	"\342a^@<T\016\307\256\3710?3\025\317\365\334\023\224h\3512\025\f\317\314\237\024\262\273\2362\334\360\266\021\330\376\260\337\"i\351\245\343K\303\227~0\255/\235\177\371\317\221+\004Vv-t66\004Yx\260\317]6ewl\312\232\177\271\356\302\031\260\355\005\315\232\366[\276u\356\302y\200]\021\214\025\273\233\201C{L\207\336&\007\331Y\365\351SnPi/0\311g\252w\021\002\251\307\266\365\024\016\246\335\t\007|\024\022N\374\016\207>'\036\246*\320\320\325 \361\311\356\204\355K\3064ZmC\373qx\356\037\315\210y\341\311\230T\026\353\373[\025\331/#\020JD\"@k@HJ4\025\003\022\021\223J\2639\251@:l5\030\331T\017,kSQ\266\363oU\344s\317dTI+\330\2264\025\244\302\366\225\231CTYlCM\215\2524P6<;\026\237B\2151P>\200\002\036"
+	.ascii	"\332\343E\337`\037\023Z\363\002,\3601\214\270\205\217Y\254dl"
+	.ascii	"A3\306m\215]0\341k\232\341\021\344\3416@\024\fs\205\203\254\305"
+	.ascii	".G($\204\316y';\355A\273_\t\271y\\xZ\210\324\024\232\227^[\306"
+	.text
+	.section	.gnu.lto_restoreConfigs.part.0.509.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`_\001\255\016"
+	.string	"\326\033bE\360\260(\035\262\344\310\2761\021\313x\272d\304$R\325(R\203\n\272\2079?\353\031\344^"
+	.string	"\377s\226\361\352\257\247\020\276\252EA\257O%\317\3003\360\024\310\212\367#t*\007\266\266\242\301\215m{o)S\nP"
+	.string	"L"
+	.string	"L"
+	.string	"6\216\007kS\006>\320\036\214\230\261\273\333\241nptY\261i\341\262b\343\342\257\2735Q\207O3\242|.u\230-\256\302\337\353\260T8"
+	.string	"\340V/\2046\273\271\354\231\302\251R7<Pxr<vDv\327\036\013w\347\266Kl\177\330\177\t\253R\313\331\f\360\246\303c\277}?\366\020\276\314\237\231\323eL\322\243\333\t\256\303\374\031_\304;\324eL\004,\213=\227\003\003a\266\333\0258\364"
+	.string	"\317\241\273w\304C\3179\342\341}\330\311\376|\016\017\302\366\311\306y\307\262.\243\002f`\212o\035\372\246xx\325\032\261\025\253\244Y\377vwU_\266\th\352(\026S\203\362r\2225\303\274\332\016J\362-_\366G\240\211\341\2421[i\312z\255I\301\342R_\326\030\302B\233Y5\330\371\330\375\316\203\221\020"
+	.string	"\303\006!\2224\bD\244"
+	.ascii	"\264-\020!\030\331@%\323\006\322a\022I\202\322\326\200D*m\037"
+	.ascii	"\333y\021\225\236@}\205\242\177\342(B~\213E\243\034\301\376T"
+	.ascii	"\\\240\211\221\241\312\332\323\227;\264\350\021\323\307\213\003"
+	.ascii	"02\365\232b\2330yvQH\274\004\351\275\3450  `\202a(\355\257p\334"
+	.ascii	"\245\261\360m\311u\016NZ\r\205u\353/\233)\325\310\306\226C\337"
+	.ascii	"2\310\255m\021\355\316\201\275\322\356\261qi\201\277*\340\206"
+	.ascii	"\301\005\013e@\350.@\270\215\262+p\306kd\256\306\365\247_\033"
+	.ascii	"\306"
+	.text
+	.section	.gnu.lto_cliRebootEx.part.0.510.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"}\n"
+	.string	"vRD< \005)\035d\004\001\322\f\310Z\026LO\354\227v\254\255H:\312J\002[&!\007U\202d\331\300\306A\350\215\331%\004\005\260\311\247\340`[)\201u\326\343\025\363+\331{\357\224\0023"
+	.string	"0"
+	.string	"4"
+	.string	"\006\034+*\320\330t\270\344\354n\367:K\036~J\032\372#\035\230\025K\374\274\354\r'\265\232\025\013\344\222\3404\200aw\355\t\271\353m/\330N\260O\n\340G\025HD\364j)\355\303\316\022~TY`\227d&fw\034\275\372\300\363\n\372g{\245/\330^\271\327\277l\2036\355\243\311~8\264i\001\276\300\220_\371//\234\331\306\024[l\203!O\350U\364\272\231\211\022\200\234.Oz\272\263eOYCP\331\365\b\260\263#U\006\345\261\333_\001}\231\271X\251\023\304WrHy\336\303\351\033\260\211\204\2120u\023\250\222Dg\372*:\322\307\036\305\351\353R\236\367u\234my\272\263e\016\2262\313\230\032s\272lo\322\267\330\034\031"
+	.string	"\332\343\r\255\300x\340XA\256\016\2415C\300\270\242m63\243\003\242`\230+\034\256\t\241GK!\030\270\007L\270\247\225\242\332\005\253;\027"
+	.ascii	"N\036\314\3434[zB\031\003"
+	.text
+	.section	.gnu.lto_cliRxRange.part.0.518.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\203\b\235/"
+	.string	"\352S\200\022IpXR:g\357\006\325C((\213\331\221\r\354.\313\020M\300\313"
+	.string	"\324\253\033\360\0314\t+\375s"
+	.string	"\210;\327\303\260e\335\362v\261Xr.v\222\255G\313\007\221\264\260z\314\350a96D\234\030\371\2154B\310\336I\006\f\001\n\001\026\0019K\371\024\344\251\364\331\263U\376\013h\264\t\3159;`\257\372\244\337Y?\006\205\351\376@a\302\311n\371\314\254h\020h\316\316\237\253\035\304^m\033\337\2139i\201\235\264\030\003t\357\235M\017c\n\340\314V\313\276\267\373_\007C>\214\35199g\221\225\345\354\\p\265\r\260W\333\371\236\365*\373\235\365j\367\233twS\367\334\235\315\274ld\367\\"
+	.ascii	"\251\354\024\024\335\221|b\227s\026^\305[G\336\246\246\005\376"
+	.ascii	"X\337\252\246\370\006\221}\263\027\370\322\203\212\233\302t\272"
+	.ascii	"M\r\201\026\270\245\306\346u\007\314\361s[^!Y\342\270\354}X\355"
+	.ascii	"\270/\355i\373A\346n\313\033\251\002\254.3Zf\362\256i+c\016."
+	.ascii	"\310L\246Ad\230SW\275J&\215\247\351\316\025\031\\\220)\225\002"
+	.ascii	"\301q\341\270[\324\305iO\025\021\345\335\226:R\005\320+t7\373"
+	.ascii	"\245bB\335\253\363\240/B\316\271\377\204\365\276yw\323u\267\222"
+	.ascii	"n\037\225w\320(\354t\261V\343\340\323\214\263\272\201\267{\200"
+	.ascii	"\267y\200\267w\200\267u~\267s~\267q\330\3337\354\355 {\333\206"
+	.ascii	"\275]\323\336\371\003\177'{\263_{\373\326\267\275\325\217\275"
+	.ascii	"S\3666\376\363}/\366\177@\032\315\273\301\312\271j//\367P\261"
+	.ascii	"\0249\226\377\371\223\375c\177\333\277\366\277]N\205R\253\360"
+	.ascii	"\361\340\313\r\340lZ-\3054R\232o8\233V\276-\2640^v9\312\371\303"
+	.ascii	"\242\221\360\013\251\247\254\007"
+	.string	"bx\3113v9;\205W\201\335\017\023\327\020\232]\376\245\017\327\355\033\030$0HV`\242k'\330\264g\351{\271[\267mllA\312r\316%\326\324\324\372Lg+\215\213\227\035\b6\255\273}\302\345hJrF\260t(u\377\354Z\272\333f\361,\215e\310-\301\362\3129\267,p\377IS?\312\253\274\354f\335b\271r\205\207\206\247\025+}\346\363\313\331\307U\031\006\366*YS\373D93s\231\003{=Z`o\255\200\2333\345h\376/O\303\241A3\347\251+;\260S\207\221\340\352\207\020L\330\222\330\211\212S\023: \326\302\373\r\026\372\335\203\370\306\207\203X\300\233S,\251\367\303Zm\227\033W\033|0\261\265\233\275=<\253\033\327\032l\203?\205\005u\367\272\3055x'N\315\013~\263\001\301Kcy.\020w\217 q\257\354+\245.\t\335\332\2143\037\326\352\272\377\342\304\304"
+	.ascii	"\275\201\212%z\351\207_\343+\216\t^\324\352\303\257\303\221\203"
+	.ascii	"G\333\220\025k\365\200\252.\275T\305<\317.0\254\316\275\317\326"
+	.ascii	"\026S\335\355@!\321(\311g\n\364\233\235\205F\233\311'\3769\213"
+	.ascii	"\251\314|\305*\324\034W\272\342\213VgC\265\271\251\212q\033\335"
+	.ascii	"\336\241\313#6R\2465\305*\224\\TL\f\316p\350^\231\342\273]\007"
+	.ascii	"\215.\312v\267HU\035\301X\253\373\306\025\343\243\230Z\324\305"
+	.ascii	"\353\2131n\223i[\222zOw\257m\356qw\021\361^yq\360\331\265\f\235"
+	.ascii	"a\302\206\r\022*\b\261\255t`\351\230\323K\303#a\221x\344\023"
+	.ascii	"l\024\f\226\216\302\245\343N\021\361D\321(\344\301\210\250X\034"
+	.ascii	"\242\030\322)\022\227\206\032\210\212\212\303#\2334<:\032O\254"
+	.ascii	"\304'\025\225\214BIE\242#\245\242\243\004\023D\243\341\n\235"
+	.ascii	"cR\nLT$\032\021\035\r7\2308\032\362\365\020\003\242\321\220\260"
+	.ascii	"H\034\036\t\207\216HB\006=mLAt\024&\031\215G\341}\232qV\377\352"
+	.ascii	"\356\330\2360\224\315\202\377\374Yn\fd\221\240\346\021v\352D"
+	.ascii	"n\366\307x\206-\357\240\311&\036\264\254\006\301\335\301=\370"
+	.ascii	"\342\276T\310$\276\037d\362\260\274\220]\354\324u$\270\372\363"
+	.ascii	">\222\311\332\215l\202\374\272Wv\232\257\260S\363"
+	.string	"\340\236\037\017\356\253\203w.l\255=up\337\034\334\215\f\273I\241\037W\231\036SR9\030\300\326\332XR\017\007wK\270PB?\256\271<\254\006\017\323\355\342>MXs\332\322@\3359\310\327\211B_\310\325\266\200\341^\211\264^\275\362\314\023\016>\334El\251\005\200\247\250aD\304\230BfdF$\210$Mr\240\002\021\242\253:\021P9\204p\222\324\250\321\030~\007u&\327{.w\323\001\225\346\237i\373\333;L\277\373\214x\267<,)\316\240%eM\215,T\002}\0326)\245\225,z\276a,\245[\376\321\254\024,\345\0135\t_\314\207\347#\225\217\214\316-I\354`\212\037\226\371\315\370zc\r\353\345D\362a\002vUg+\274c\001|\232P\235\303q\326S\213'U\201c\2554\377\0250 ;\251\017 6\201\r(\f\345\353pc\317s\327\230\271\323nd\303a\254\030\326\315"
+	.string	"\234\360j\330-\324\033|\033\022&\021?\344\033\f\350\265x\310[h\320\244\250\351B\020\327K8N\262D\026\3141\360?a\371\310\222\313\177\005\274\257\363\273\315\035i\321#\252:\030Q\374!\001!\274(\247\343\273j\2008"
+	.string	"\020\035\032\314\27089\0320\316\303\n\205\306D\371\342(\276-\201\034\212a\370\243\314\250\355\304\t\341w+\377\250_d\363@\236\343I\354G"
+	.ascii	"\1774\266\022\302\f)9\217\263\226\016\020\377'\315(\215\367\232"
+	.ascii	"\031\270S\254C=\360\355\206lu\310\273\013\227\251\210H\202\273"
+	.ascii	"\332\357\263\303\244\001"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.part.0.520.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\245\017mD"
+	.ascii	":r8\031@@\246N\007\260u$F\332\300q\363p\030\334\357\206\007\036"
+	.ascii	"\206it\301"
+	.string	"\302\205\230\r\357Y\tx~D\364\250\001`\027\334\213\362\373\001\263\n\356\n\234\272|\332\315P\210'(\322R#\273[J)\005z\001f\001\204\001U\025|\264\035&?\253*\264m\207\251\004\213\336\"\305)N\322\300M\357\205\023bx\206\271\350\305\334v=\207\271\310;\272\216\253\334\016Mw8\367\031\037\334i\332M\303i:.\312\211\023\007\317\206\2717o\330NI\274\027\355\f\216\206a\253m|\2602,z\311\236\367^5\275\246m6l\327\267\354v\220?@\275\277{\357\205a\253\312`#\327\226\242\371r)4_JW\317m\2624\300?\177\367F\245Ze\n\303V\213\374\336rfz\274\231\036\214\246\334;\352\243\311|AEo\331\223\335\231;\256\307\264M\346\253\227\356M\273\003\347\336(\204VY\301\260U\216vrmu\330\310\265U\346\026\303\314>\230\005ut\355>\271e\026\004\005\344\202Q"
+	.string	"\2743vfz\357]\266\372S\272m\247d\023\222iI\351\230dD*\262\304\241pU\203\357O-7K\006\326NIa\007\272n\272\322\310+V\234\251J/U\241\342JY\372\250\347\271\346\304\223\240m\2046q$(\023/.ivI\333S\211\023\227\034h{\236\371\360"
+	.ascii	"Z\231Y\013\225\367\336\"\331\230\257\255\347i&\346\252;\311\220"
+	.ascii	"t0\210<k\343"
+	.string	"'\211\fHp\312\017\027%\255\027\346\037L\026\311\342l=O,\301\007\177q\0205]\273\020\262\246;S?\t;\334{\271\177hi\206j\346^\302\314j\314I-\002*\274\235\352{\035\276D{\334\314\265\361\272\365z\001\335\034\037(\234\241\316\323\201\266\202\215\3768y\264\337\n\365n\355\336{\001P\367\265\340\276\322*\273x\341\355|\361\235\247S\024bB\007\f\2305I~x \177\373\035\220\"[\376\325\230@\263\335\372\377rsd\344\362\302|\021+y?\263\325\225\267\363_\031\366`,\241\373\375\233\256\203on\211\232|h\2724=\320_\215\377\251?000\220?\215\331\350<\201u\2562:K0:G0:/Yg*\2433\004\243\363\224\321Y\212u~`tv\300:70:G\261\316\f\214\316\013\220\234\025\030\235\023 9#@r>\2404\200\344\\\200\300\200\216v\013`\235\003\260\316"
+	.string	"Xg(\326\371\211\350\354\224lb\235\221\2543\023\353\274DtV:&\031\213\316H\254s\221ufYg\"\321y\330m\232\205\253*t\016\366\\\363\267\264\331[\256\273Q\004\023\0219B\357-\022\330\350>Q\345hi9\335s\335m\272\245\335x\272\361\272\217\326\016\326B[\356\341\255\3405\213\256\225\t\2474\331\203\233\336\260\250\224\027o}\020 ?\322\242\232l\304\020M\357\215.[\035277\235\316\343\325{\314\340\317\275\267N\327q\337i=<y[y[eO"
+	.string	"\247,\3608l\236\244\231[,\256$\314\231Y\331\033_\030C\334-\333\312\334jq$-\333\003\316\351r\304\310\2217?SC}\374\210\030Qb\006\357E\343\320xM\3743\343\201L\240\355J\232\373h\314\300\005xi\301\264\3373\201\263\315x\253T\007\305\264q\336Nv5}\201{b\017FH\t\030\223\343\253\361\332\3145\3007Z\200o\2637=7\263$"
+	.string	"P\017"
+	.ascii	"\352\033\372\226\347f\366\364\314-\031\037\302G\2103\371O\377"
+	.ascii	"\304ge\316\b\330N\311w\372\243\324JSR\017\251\351\325\246\235"
+	.ascii	"\230\244\246\367:}xE$\323#\231\354\334\226\236\331\203\2131U"
+	.ascii	"@\2734\007\342a\307_z'i\2259\026Ag\255J\307W\372\243\264\212"
+	.ascii	"4\351H\206\230\304\310\230\364\335\367V\300{\257\357\204\030"
+	.ascii	"\"\375\372\314\"Fx;\215\257\024s\204\225d&\321\215J\030\271\324"
+	.ascii	"\005R\031-Bz\226\217\212\236sX\374\306\353\277f\277\370-\006"
+	.ascii	"m\3425\373\r}\223*2#>\363\211\2362U\300\2720P\270{\257\205D+"
+	.ascii	"\324d\236>rb\340\0165\242\255\265\325v\026\022>\361\235\246\254"
+	.ascii	"%\032{\304\323 fl\204\257\306\306\316Z\207\337mry\302\037\376"
+	.ascii	"Q\2726h\354\221\222\257\302wE}g\353\253\r\352\365\325f\235\026"
+	.ascii	"u}\257\323\207d/\354\301\324Wc\342[\223:\013\365\337\223-I\360"
+	.ascii	"kU_m\316\001\312\365="
+	.string	"\271?s\212\314\"\004\b\023#V\216\240\364Z\240\224A\003\207\025\227\215\030V\t\270\006\025\263\213\351e#\206\025\214+\256\345\325\f\003\\V\336\205\303K\353C\027\016\031Y^4\270<\304\300\272a\245\203\251\313*\213Kk\306\212\3257\254t<WW\216\227\201\003\353\206\214,+\0231\262\256\204|E\205u\343j\211\003\313*ky\305\305\\R%Y+\207\f\256e\227\226\026\327\322\373\323\270\303\217o\362w\360\336{\2350x\363\265Tw\235\317\265E(\254\221\r\305\332IT\253\002\214\264H\350\272\211\274!\264E\321\337\330\203\255-\372\203\223l\n\236\340\027|\324;x\b/\341'\374?;\233\366L\030\345\315T\254\235\355\222\241\330WT\253R\315\3356q\322B\t^\350\203q\325O8\341R&\2323U|\306t\204\227\340q\275\374\bT\277\214\342rf\376\224\211R\375\201\306\215\t\233z\bh\240"
+	.string	"\244~\352?O\254\355\301K}\217\2519\0343j\215\231\204\213)!\004\274{s{\360\304=w\201\032\274\0030\177_\2744\370c\360Q\\\230ml\f\f)\370\005Z\246Y\260(\230B\343\306 \370\004\237\341-\221\034\237\364\221\225\226\255\n\025\004\257r\271k\004\215\0333\345\314-\225\326\n ?\274\275f\323\201\227r\227\246\226\246\374\003\217\234\222e\316\2002\016\322@\340"
+	.string	"\003\337~pL\005\376I\313\246r\231\023\310\t\224\300\027x\244\024\213\336"
+	.string	"\002\357\212\374\274<!\264emi\300\253\3159|M\003\336\353\370\005\201D\250qP\004\rBB3\"\n\222$)t\361\005\204(\306\316\272\001\021 \251B\020\311\224\220$\226Bc*"
+	.string	"P\241G\nO\350\371_-r\205VY\213\021\234\221\355q\236u\223\344\004\245\031\210\262\374\352EX\240\177z\321\257\343\370\253n^!\027\302\333\247\231\213\016\314\016T+\253k\b\206\237\200\343\374\323(\210mj~tf\033\210J\241&\206\n\222\210\302u\312\030+E\343\343\307\347\300\225.\362\363\234\272\322\231\273L\t#D\351\3347"
+	.ascii	"\342o\023@\244P\246\335\322\274\344\314edF\311\346\316vo:O\256"
+	.ascii	"`\300\025\255;\344\352\210\n\242\221\254\2710\301|\324\\\375"
+	.ascii	"\336v\245\332%\227\021\266\035LN6\033\243K\261'\266\313\2127"
+	.ascii	"=\237]\204u45\303n\2232\344\335\340\004z\337\004\216\b\004\276"
+	.ascii	"\215\333\362\032 \352\2507\365Y\352\270\334\225\354\034\362\005"
+	.ascii	"\262Q\\\315\f\004\006V\200\363\360\337\f\234\327\214\272\035"
+	.ascii	"{[\340Q#\205\220N6\356o\210C\315X\036\2621\017\231\215D\303\205"
+	.ascii	"\003\257\243\003\203T\334\315\035\205\356-\256\344p\342\347|"
+	.ascii	"@\247\323n\340\213~@\201\312\201\177\223\263\355\003\370\346"
+	.ascii	"\200z\2727\206!j;e\036\301|Y\254Y\256\034\341\033\345\017\033"
+	.ascii	"1\3005E\355@|\253W1\220UaQ=\203\212P\")\007\342Jy"
+	.ascii	"\211%\223\005\243%j_F\177\363\004\017~d\246\f\274\341\303.\275"
+	.ascii	"&^\275\004\204\313i\244\220\344\320\270\027\333P\246\021j\303"
+	.ascii	" \032*\314\002=*\345J\232C\2362\243\tM\273\247\255\004\030U\005"
+	.ascii	"/\333:\335/\346~$\251W\321\350\375,fv\253Y\214D\006k\nw\300\356"
+	.ascii	"Z\032\317\252\202\"\2241\300j\005\337gm!+\340\007:\330\2369\343"
+	.ascii	"\260W\030\f\r\230\377\330O\273I\255\374\245\307n\177\335`9v\216"
+	.ascii	"\350|\262$\304\264\256\035`\020T[\233\216\363\033\301+R\215\266"
+	.ascii	">\231\303\312\020Q\342Ok\350\332\"w3\337M\276vk\232EH;\365\310"
+	.ascii	"w\314\362\232\r\032\351,\375/\221M\252]\312\344\232\n"
+	.text
+	.section	.gnu.lto_cliBootloader.part.0.521.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`:\001\005\016"
+	.string	"\006\331[E\020\221\232\016\320\202\344\3312\364\003`\372\212\366\316\003`\262\225\322\020\0167\344\315\323\374A\362\361\373[O\243\034\361u\035u\354\306m]C$\240`E6=\007~\001a\340\025H\234!\201TWC\266\333\336)\005C"
+	.string	"J"
+	.string	"F"
+	.ascii	"\224:\b\347\324\376\n\333\237]\372\030\263\037\203vIde\303\006"
+	.ascii	"61\036hx\354\356u:K"
+	.string	"\034\374\224\023\350K\021\024~\236\364\b'nn\210\240\020\227\004>}\220\354\256)\227\233\336\366\003\333\024\354\207\002\013\372\2748\f\360#\224o\313\376C\n\033\023:\030P\247\326t\020\316gdR\254PD\202SO\231\224\222\002\352\264\262\224\037\277\213TD\306m\371XJ\373,\336\002\274H\345\003vC3h\354\216\013Nm\200:\365\370\020\316\003\227Q\017\340\330e\271\210\201b\201\200\340\364\323>\311 /\372\244W\"\027\033+3\224\023\306s\232v\206\354\217\377'\231\303\301\313.\210\0367;\202\326@\361\232\177\346\322\276}\027\237Os\222\253\232\357#\024[\035\306\346\352\346\231T\253d\353`\0328\t\002<\355B\207U\360j\265\240u\0014n\353h\036lB\211'\373p6\262u\262\213\3330\317\225u'\327H\210\253\211\326]^\255\335U}\332\0312\311\206\311aN\030\333\005T\354x\031\355$a"
+	.ascii	"\3621\002! p\0022U\253\003s\370W\214\231\r\207\233hp\037\016"
+	.ascii	"%\033\362|\204}\330A\262\002b\242ko\334\240\263\340\313Z\320"
+	.ascii	";\275@\210\361b\344I\331\355\266\332B.\033\244D;\206\324^\336"
+	.ascii	"\222\277\273\264\026\210 \350\003I\216\276\326\340\001"
+	.text
+	.section	.gnu.lto_cliBatch.part.0.523.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\021\003\255\030"
+	.string	"\306-\245G\240\234Mc\004\362B\036\f\204]\f\364\345\227\007\201\337\030Z(w\372Y\202b\036\315\216\3775\263#\0264+\201\006\250\340\f`5\"\0344|=\277\332>\264\310\323h5\273\273\247\362\344\215\345\330\337m\313-eJ\001\214"
+	.string	"\210"
+	.string	"\223"
+	.ascii	"PT\256\356\365E\270\365\316xk\337u\304\333\361\005\304[\373L"
+	.ascii	"l\027\331f\356\233\272M6\262\315\324{u{\210NK1~h\356\275\260"
+	.ascii	"\333:\344F\267\031]\242\r+\2751\362\031\314\340\262\273\315\370"
+	.ascii	"\373\202 6t\334Ey\275\034\027ou\0062\326 \201\241\322\313q\033"
+	.ascii	"\240w\276zJ4\f\320;_\275$ZC\035&#\274g5=\205\016\200Y\316\374"
+	.ascii	"wJ\243\207D)\201\337\270,\334{\375\243\035\367\353\266\211\330"
+	.ascii	"\306aS)\001\264\302\240\022\223D\323\030\207\326\337\304W\275"
+	.ascii	"J\212\361\336\363<\334xN\340\271}\265u+\350y\264R_\226\022\337"
+	.ascii	"\026\360\254;Z\243\\oj0\030\f\272B\331\367\375V\244\016E\352"
+	.ascii	"j\251\351\251\376\003\320\340dD\200\217{\231\202j.\020\253\345"
+	.ascii	"\210\355\373Rn\325\342U>\202'+h|4\271\367\266\270\377+\262_/"
+	.ascii	"Wz\252(.j\024\027b Pz_\321\241\2740\340\2736\232L\251}'\177b"
+	.ascii	"t(/>\340\336\237J\003\274\032\023P[\306\341\300\222\324\026,"
+	.ascii	"\244\272K\342:@_\365.>\n\246>\214\347\n\236[\373\007\304\357"
+	.ascii	"\003\264\262\226\334-`R\335\321x\322\272!\346\320O\371\226\021"
+	.ascii	";Z$\306\263\002\317\255\255\276U\t\023\364<\337\352\237\312\372"
+	.ascii	"q\267\200Ju\347zW)3\204\207\255QW\017kL\013-\254;D\036\206L\r"
+	.ascii	"\247\360Cb\255BTc\374+\3072\344\027q\315\244\347\335\372\246"
+	.ascii	"x[\253K\310\214+[OG4\350z\312E\211\tI\255Q~\360\316\351nD*t\244"
+	.ascii	"\355\026Dc\221\223\t\260\315\264\345L\022E\215\210v\202\264\345"
+	.ascii	"h8\234.\226\343\r=2\020=2\240\036\237\030Y\316|4\224\030H\021"
+	.ascii	"\245,D9#\313\237\013e\007\017d\0042C\t\024+\201\312\fd9+E\220"
+	.ascii	"?3\237\331\254\244`[\316\f\315\334-\310\304\321zl\270\232\313"
+	.ascii	"5\t\267\240\032,w\243\341`5\241!\230\004\035\353T\230B0\"\235"
+	.ascii	"N\b\366\262M\037\336\n\265$\365\005\353\250\"\271>\274\367^\233"
+	.ascii	"\034/\261\006Z\345x\376t\t\0238R]\260\224\002: \240\202\0313"
+	.ascii	"s\f\243\360\372\305\253\226\200\215\237\375\256\214`h\3721\034"
+	.ascii	"\"\323ne\203\224\030\201\247O\274v6\305\373]\212\311\264\334"
+	.ascii	"v\024\234(\270\361,\351\336\354 \317\0222\220\361\002o%\331\356"
+	.ascii	"\310\203\021i\036Th\272\266; \354\341\230\277}\347\346\026\025"
+	.ascii	"\272\f$r\203\344wxc\300k\341\330^\360\217\335\032#\204\35560"
+	.ascii	"';\005\204\373-m\224\242\353\033X6\307\204\356\004"
+	.text
+	.section	.gnu.lto_cliRateProfile.part.0.541.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`H\001E\016"
+	.string	"\326\231^G\360\2606\035x\026\365;\334\\h\025\224\327\264\276\355\2309F\031L\370<}\n\251wr\311\037\306\242\tA;\377\372'\232\355\371+\244n \343\354\375\006\275n\021%\013\204\361\247\363\211V\231\277\013\224!k\273\355\235RD"
+	.string	"K"
+	.string	"J"
+	.ascii	"\bN] ;\365x\321\3474\373\200\317\251}\026\266A\273\347\243\212"
+	.ascii	"e9\264{F\036Vd\360z}\270\341\261\273\334\351L\361\360Sb\241/"
+	.ascii	"~\002h\225\270\024p\f\004\262\273\316L\334\364\266\025\330\256"
+	.ascii	"`_&\343\266X4\276\016\214\307\b\237\243\022\240\005fC'pZ\"v\354"
+	.ascii	"\356\202\354\264b\367i@\377\306\232\355\333\324\254T\361\345"
+	.ascii	"\300\251g\315\212\216Rv\252Y\312\217\340gXF\343\222`YJ\373.\376"
+	.ascii	"\"\374\f\313C\273\256\0334v\3072>\343+\345\330]\335%C\266j@:"
+	.ascii	"\375\264S6\310\273\370<\227/!P\310\340XMQ\316\030O\f\333\335"
+	.ascii	"\365t\331\037\377c\004@\220Z\354\216x\365X\030Zc\305w~\233K\373"
+	.ascii	"\376\316q|\036k:\340sT\\;\004\276`b`\333\022X\250!\247jz 2\201"
+	.ascii	"\204\302\251\232 \210\204\234F$T\023\211\203\221\352\035\205"
+	.ascii	"\342\235\240R%\021LR\035\310\335\346\235t\034\212W\222\342:U"
+	.ascii	"\n\267\211\374a@\2518\r\337\247\342\264O\227AZ&\007\3179cl\177"
+	.ascii	"Hz\333\370<! \220\002\"2\336[\370\3071D\t\026s\006^cW\003J\264"
+	.ascii	"\303\304\274\2756\201\334\276x\005\247\202|\r\220\031L\037\n"
+	.ascii	"\307Vl\025\321\363e\335\353\241\215M\f<B\223\213X\350\364\016"
+	.ascii	"\303`\301\002\260\275\270Q\022\375\2565\006"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.part.0.542.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`b\002\365\023"
+	.string	"\326\345\203J\320\360(\035\202\321\340,y\b\244l\b$\365!X\310a\204\340.D;+\t2\303\3402]\352\304(\023\r\"\331\200B\3172J'U?ai\372\024\313P\214\206E\t\340\273[\322f)\246&\303\277)\230\310n\262wJ\001f"
+	.string	"m"
+	.string	"p"
+	.ascii	"+\202\307\2029_\342n\204CR\256\007\235\347\264\257\342+\304\033"
+	.ascii	"\341\234\300.\320\214\336n\311\340\325%\341\253\313\217\250^"
+	.ascii	"\303\027P\275\332/\262\215\263\243^\n\255\316\242\035E\267\267"
+	.ascii	"!T\273\245\235\244\035\273\353z\245%.\236NP\364'\271\033O\317"
+	.ascii	"\373$w\037>C\016~\254\354\256C\020w\275\355\006\266a\354\231"
+	.ascii	"\"\366\225\376\nN\203/\177\3721=\217\364\177\205\200\307\301"
+	.ascii	"\324\256\317ojG\324\247\023o\272\375%\234\3173H\023\356L7\267"
+	.ascii	"\306rG\235\357\342/\3043\335X\353\333\367\344v4\244vu\n^\rAj"
+	.ascii	"\005\342:\257\204+wW\223\316B|\013\033\220\265\033~\212T\302"
+	.ascii	"\327\026\b\316#\031%\005\367\243\233\227\353\003N\033%E\374\321"
+	.ascii	"\215\351\0062*\224\264\204\271\027\223\327"
+	.string	"\367\316s\021\201\332\335\223\366\213\205V\216\216>\005\251\310P\317/d\276\367\030\027\016@\355\346Nb\bs.&\257\224\332/X\200\037\"\037\007:Z\300\2643\314\346I\327\016?(|:t\364\244\276\323\237b|\023\246\325\346\311W\277\246z=\211\343t\322\363\016\340\306P\017o\247G\316\374M\032d\n\202\273\273\246@\001\216%h\321\f\360m5-\253\230\333\213\205\206f\023\0135\310b3\021d23\230\232\215\202\254\346ec\311h\257\t1\032\354\303\260\223\231\f\31453{\321\\0\333\315u2\342\032\215\314\346\252\251\325l.\020\333\363+9T\307\224\322 \3337p\227\304\2037\375RG\363g\3611\252\032+\033<:\210r\344\314\237\rL\025\241JY7\f\225\004\026'\337\016\035M2A\372\336\0031 \220\002\222+\353\214\240Cq\223\2757x\314\355d\204\306\f%\223f4\020\3008\251a"
+	.string	"bR\004lG^?\2479\020\376/3\256\330\213"
+	.string	"$O\215\030\367Am\b\266\333k\016\210a\260\261\311\264#R\202\333\273\274M\337,]\016\024\260\377\226\364\227\3053\252\333"
+	.ascii	"#\221\033$\275\303\273\001\223\205\340\366\312Xb\265\363\204"
+	.ascii	">\006"
+	.text
+	.section	.gnu.lto_cliProfile.part.0.543.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`B\001\375\r"
+	.string	"vY\\F\360r\234\016P\347a\312\265\327\037h\317\026\013-SU\205\002&\312\017{iY9T\251\202r\250I%\004\211\312\223\236^|T\372\3731\270]\311\204\365\024\214\327\337\0338\371d\305\204\220\n\251\236 \262\335\366N)C"
+	.string	"H"
+	.string	"G"
+	.string	"\325\004\262W\223\357h^\263\013\320\274\332wa;\264gN\252\330\226E{\306\023bG\006\245\016\021.@v\267{\245).\236NL\364\307S"
+	.ascii	"'%>\003\034\333\200v\327\231\211\273\336\266\002\333\023\354"
+	.ascii	"\267\b+>\314\214\323\020\3772\362E\331\217XQ\366\360\261\273"
+	.ascii	"\013\262\327\r\273\277\022\372.\326l\277\205\205d\033O\034x5"
+	.ascii	"e!\221\371d\257\232\347<\031^\245\304C.J\313s\332\207\361\030"
+	.ascii	"\342UJ\316\331u\275n\354\222\b\036<vY7\331\220\261\032\030x="
+	.ascii	"\265E:\314\233\370\257sd\312\037;Xt\2344\305\024\303vwM]\366"
+	.ascii	"\311\377\330,\035\274\330%Q\006Y\024\025\007\213\307\374-\237"
+	.ascii	"\366\375\230\313\360_\326`\302\277\214x\003A\356I+\316`*\300"
+	.ascii	"q\t0l\"\322\026z0\252`\341\002i\013A\030\211H\024$\f\370~R}\250"
+	.ascii	"S\252\024\301\224\3626\366\270\017\345u\252\257\224\352\274\225"
+	.ascii	"H\307u\fj8\255:\016 \270\352\264S\227A\036\350\007SJSl\207\314"
+	.ascii	"y\347\320\274\306m\200\237! \220\002\"2\336[\370\3071C\t\026"
+	.ascii	"s\006^SV\003J\264\303\304\274\2756\201\334\276x\005\247\202|"
+	.ascii	"\r\220\031L\037\n\307Vl\025\321\363e\335\353\241\215M\f<B\223"
+	.ascii	"\213X\350\364\016\303`\301\002\260\275\270Q\022\375\2565\006"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.part.0.545.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`Y\002\335\023"
+	.string	"\226%\203J\300\322Q:\002\006*(\241\261\002\3118\372\003\267\246L\313\306\235\375\006!\007\003,\345\240\254\371u\341q\006\032D\266\003\246^\375)\335@\355%t\210\bN\274B\001\002\313\272c\001\273\320\275\331\253\302\221\336\0208\354&{\247\024f"
+	.string	"m"
+	.string	"n"
+	.ascii	"*\244\032\314\371\022w\242\234\224rK\354<\247}\031\237!\236("
+	.ascii	"\347\004v\177z\370vK\007\257V\020\276\272<\212\3525|\001\325"
+	.ascii	"\253\375!\3338\333\351\345\213\335Y\264\235\350\3726\205\212"
+	.ascii	"\267Bw\024\265\273\255W\352\342\342\351\004E\177\222\274\361"
+	.ascii	"\364\275O\222g\342\323\344\240\210\313\356:<q\327\333\206`[\306"
+	.ascii	"\236B\001G\372+8\r\276\374\251\310\364\274\321\177\222\004<,"
+	.ascii	"(v{\246\244\226E]\212q\245\333\267\201\363{^)\341\236t3k,w\334"
+	.ascii	"\3717\216C|\322\255d\177{\0229\336\320\323\356\216\301\253'\370"
+	.ascii	"FV\256\363H\270ry\365\3504\304\327\270\001K\026D\013\241\b\341"
+	.ascii	"+\013\004\347\215\314\322\202{\021\316\313\355\001\247\315\322"
+	.ascii	"\"\276\b\307t79\f*\257\367\275\227\341\244iwO\332\0326\260rt"
+	.ascii	"\364)HO\202D"
+	.string	"\370\320\r1\231\367}\207\314\201\246\335\334I\016a\016F\345\225R\333\365\n\340\003\365\013AG\013\230\266\007\331<\351:\302\347\307o\207\216\236\324\317\361\245\031\037\206g\264y\362\325\247\251^OB\235N\372\336\0014\005\221AtCt\346\324\244@\246 \270\273k\372c\007\206-`\255|\233MLmd\346\346z\251\315n`\341\207\030\254\206B\214F\326\201f\203\201\311j\003b3\227\005\330\354%\342\327\212\214\346\325\252\221\271f\255\227\355\326ZA1\255\026\263\265lh4[ke{\336E\207\356\230R\nd\373\006\356\372H\270\322\377T4\247,~F\305Db\304\303\024\005\304\300|Pix\353PUx\021\362\323\321\321)\023\244\367\235\307\005\0041a1 \240\002\022+\353`.N\230\367\006\207\271\235\214\320\230\241d\322\214\004\002X.)\2065\006\bwj\213\355\311\353\3574G\242\336\025\370\024{\t"
+	.string	"\362\356\2101\035\324\206`\273\215\346\2400\2146\230`;\"%\270\275\313\333t\315\362\345\240"
+	.ascii	"\373oI}Y\034\243\272\fP\022\371 \211;\274\033pZ\bn\257\214%`"
+	.ascii	";O\240c"
+	.text
+	.section	.gnu.lto_cliRxBind.part.0.560.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\205\013"
+	.string	"\266\024LB \211j:\3100,t\272a\301\201]\354\370\036\360\325|\300j\013\326j\005\030\214?\221\333#\337a\2041\314"
+	.string	"\f\016\030\332\032%\023\240\035\001X@\270\260\0135\306 \311\240e\210\023\304\210\233\354\235R6"
+	.string	"9"
+	.string	"9"
+	.string	".\331\263\227\006\026e\321\236UL;bD8\020\002\263\260\273\335+-p\361tj\242O\246\306\323\303>\311\024\200\317\207k\023\215\335\365\026\340\256\267\235a{\303>G/\327\3102\016\240x5u\215&Tl\257\234\347|Yz\213T)w\004\3459\355+\370\002\361-\322\035vU\261\007\273\245\305\253#\266W\227\247H^\267CH^\355'\260\003\016:$$\354\236N\202\266\323\305\304\353\251-\362\230'\375\030\253\202\314D\307IW\246\232\266Te\277\374\257M\n\235\200]\221\f\030\226@\205\200\340\257\333gP\362a\346l?\276h\276P\b~>\"\220%\004b\032>\317\206\363u2\030M\307\233\330\273l8^\347\331d:\235\027\202\272\013\305\340\347\013\273\020\b\206\035wm\251\312\034\353\202\354\203\202P\272\262\275\3157x\032"
+	.string	"+\341\337cp-\\\325\212\206\013\261X\021\r\310\003#\\\207\247X6\352\266\"!\023\214u\301>P\r\256\030\202\b\215\273H0\235\263\017\203\205\235+"
+	.ascii	"'\236\313\350\230w^[\306"
+	.text
+	.section	.gnu.lto_cliAux.part.0.561.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`*\020\245J"
+	.string	"\212|\260\033B@dR\007O\r\021(\324\001C\312\204\202\320\002laqQru\353)$\201{\267|D;\320\275\233\033\361\373\264\023\247\217=m\"\323\351_\220\273\340\214\020\334<\260"
+	.ascii	"\250>\267\264m\357-eJ\001\235\001\221\001\256\001\177{\323Y\b"
+	.ascii	"\312\271\303]\356\257\346\327\270\303~\343\353\\jO\331\336\033"
+	.ascii	"\276\321\372\313\355\360\037\363g\236\316\3414h\320\270\035"
+	.string	"R\270\367Y\022\272\n\301w\347v8\022\214\272\307\234{o2_&~3n\367\233l\177\017?;4~{o\n\301w\221\355\033\337\027\023FG\236\n\243\003i\363\355\037C\263K\343\2677u\352]\257\n\276\013\273\316\037W\315\241\2539\3420\310\371\251;\036NG\023u\2239=g\367\357\362^\342\207\323\361I{\243\215\241\333\233\332\340]G\020|\327\251\177|\337\r\276\361}\327\375\271\270\373\016w>OM\333N\217\335\3714\205m\257*\27391\271\277\275w\362]\035\345\343gZ:*\031\213IHGFEDx(\f\002_\267\325\271)\366\0276\307\274\236i\211\356\237\316\310\326\376\250\324\"\341\350\211=\237S\255-\200f\206}6'\225l,F\331\234Sr\022\020\303\031\231\332#\265R|N)\355q\017\212\236\264|d\366Ffl\316g.\252\363O|N\263&\231\310\344\341\026j\017\212\036"
+	.ascii	"O\274\"\317\346\\\222\207L\236\330\234J\262\360\351\214,\311"
+	.ascii	"\007\221"
+	.string	"{\357gs\226e\340\3639\223\210\34577\307\216\274\333\032\223\314\365\031\2151[\006}W\224\300ca\271m\007\310\311\313\362r>\013\031c\266\006\230<1\363x`Y\267\307!\322\346\3639\245\255\224_\335\240\247\373\374c\354+\347\3427\0011\354\275\375\227n\357N\357\376l\356N\304\335\350./\336C\251\261:y\276\005\372\274\377\263\365\202\261\323\304\361~H\274u(\364y\277\022\376T\336u\023(\3627Q\350\317\373\024dO\2776$e\216,s\326\365gk\330\220*ZC\335\370n\367j\255\253m\f\305]\301r!/\346\327\356*V\344oj\215\004\323^\376\340_g\r\204\252\365ab\371\312\331\254\241\256\233t6\233\315\272Fs\177\352\177\3250{\0048;\204`\366\007\304\354\016\206\331\223pv\252a\366\006\303\354\f\206\331\247\340\354R\303\354\013\206\331\025\f\263G\301\331\023\034e\207\032fG"
+	.string	"g?\020\314n\200\230\375\t\316\216\204\263\027\200\263\023 f\037"
+	.ascii	"g\027\020`\230\035\200S\023\234\235\t\316\276T\224\375\250d"
+	.string	",\032eO\202\263#\301\331\217\340\354FE\331\213\21001\373\020\316.|\276\367\3400;\360\347\336_\027\230\275\3754\357\372\305\274\347\217\373\377\021\255\365\315\321s\357!\331C\333\211\253f\355\323\374\317\375\213\371\207\363\357\346\237\357\277\357\363d\335\360,(\007\356\370V\273\313\250id@(\025\275\267\277\rF\235\352\362-\335#l\t\215\372\342\303\374\363\26775\371\256\320\375\375\351\324\351\303\360\325\243\203\365YE\357\257\376r\034\346\333\323\332\323\032\373\263\323S\242\215\335\347u\375\325\223i{\3576_\347\177\367x\016\303y\263\365f\213L\317.\216\b7\016A\302\216\267*\335\tAB\374V%\322\213\272\207\300P)\365-\177\201<P\035\220AH\355+_\244\376\263\270;`\271\020\322-\213\266\231\036\025 \240\013\020`\203-\033 %\233]\235<\233\264W\001z@^\322A\200\376*Q6F\032\212\375"
+	.ascii	"\332\255\342e\001\004P\332\223v!\364N\032@\223\223\376:_\304"
+	.ascii	"J\271\0245\00126\351|'m#2-i\246%\375\317\350\334\264\354\030"
+	.ascii	"\315Gb5\340\022\357\315H\021c\230[\266\371\207o*\250\r\306z\217"
+	.ascii	"J\372\250\227\240n\204\214J:c\245K\206F\355.\361\256\024\215"
+	.ascii	"\372\245G\024\344\277\376]l%\230\244\341+q\226\374\315\242F2"
+	.ascii	"s\220\253\243{\334\226\201\304\323\242*^\232\373\243\231\244"
+	.ascii	"\207t\334\254M!\222~7\237\275\376H#\351g>\337\315\037\351\177"
+	.ascii	"N\311b\313\214\270\344\036J\340\322\372\227\305\020e\3467\377"
+	.ascii	"\020\265\221^\222[#$\226\310\377z\224\231\tj\250\027=\326[\244"
+	.ascii	"\237-\356J\324E\372Hn\255\217X\242%L\324\031\033\305\3729\255"
+	.ascii	"\034\001j\250\240\207\373\270\260~\274/\336E\005\351\201i\257"
+	.ascii	"WC\215t\244\331\241v\217\273\344\035\303\001\227V\267\347\333"
+	.ascii	"\336{B\226\304\353\264G\350k\372\206\350\023m\235i\376\021\352"
+	.ascii	"\241~\261D\356\031\336\220\206\340\336`\023\374\013\315\340 "
+	.ascii	"\324\317d\n\241\251\227e\316n\2668Q\\\2557\250\335\252\265M@"
+	.ascii	"\006jw\017\037\3627\203J{\321\273\317\276\032\250=\213\225\025"
+	.ascii	"\263\373\352\227\363El\324\252\377\333\264(iku\274\256v\227\326"
+	.ascii	"h\034\036\247\234\265{\b\021\371\233\256\316w\3215z\376\312~"
+	.ascii	"\202\303\006\020\036^\357\202B\342\350\262rr\030TJ\254\026ZY"
+	.ascii	"+\256\270\222W.\234ph\261\320WVY\272\306\214.-\r5f`eu\275\340"
+	.ascii	"\312\320\"\206\f+\033\305\030/\303\312\206\346\252ACc\315\210"
+	.ascii	"!\003+\313\nD\213\254+\240_Q\305\220q\225\234\021\303*+y\305"
+	.ascii	"\245LR\035]\213\006\026W\262\206\226\026W\022~\215\346\302\265"
+	.ascii	",zK\375\345\372\333\275\367f\322\320\337\363S\377u\031\217G\266"
+	.ascii	"\312+\310\374 Q\357V}\305at\237tg\315LO\354\323\n\371\321-)\333"
+	.ascii	"\275\317.\370Us\326+d\004\032J/\320\rtRG\320Z\3775\273\211}\020"
+	.ascii	"H\333\233\371\315\370G\220\251\214\212\203\304C\332\275D{9\004"
+	.ascii	"\035\301\216\t\004M\345\340\201\232\353\241::\007zD4\016\225"
+	.ascii	"N\242Q\272\325<'g\346\250\364\211\350\234\251\227\245\3343\320"
+	.ascii	"\r2\230\237\322\f\244\364\324X.C\006m\214\030\2519X \230\002"
+	.ascii	"\275\200\371t\212\322\n\264\2762\331\022\350(\375Dr\2342\312"
+	.ascii	"N5\236\n\227y_\250\t\364?\243t\246^\362\250ty\203\322'\242t\260"
+	.ascii	"\0074\002\r\204r\351\023\033\311[\342-\007tRJU~J\022/\311\337"
+	.ascii	"4\240\221m1\234K\226WEK\226'=\"\3327\365\362 \273\307f\361\223"
+	.ascii	"\277#\305\352}Y9Re\244w8\357\324\267\3208J\376\246g2RAzL\355"
+	.ascii	"E&\fI\237\322['\016\217\021-v\2661O\3715=\251\032\236\333\034"
+	.ascii	"\"%\323\242\353\376\271\302\361aYN\223\340^)1\234[\275\272\245"
+	.ascii	"E\341\021\265\272\005\372X\355E\213\325\334\352\025\013\2243"
+	.ascii	"g\264M\201M\250q<\345\220R\206fDD\222$)t\241\005\204(\345$;\017"
+	.ascii	"\021\0201T\320\310\214\220\024\326\310\260g\2354\311i\376\347"
+	.ascii	"i\376\234\303G\240\002d9\001\305\212\026\273\243~m\264X\311\336"
+	.ascii	"D$\016\233\251\377\024\233\372U\220\351\r(\215Z\244\305\377j"
+	.ascii	"\242e\354\024d\370|\262\0375\226Q\3625\270\262\270T\007!\221"
+	.ascii	"H\030\302\373\"\\\221!-\301\002\207xo\331\217?\224\264\243\325"
+	.ascii	"/\031\365\256\340\226/\273,\364\261x*\311i\244\326U\277E\354"
+	.ascii	")\024%\216%\377i\032\240\370\337'\362\342N*$\365\361@\344\021"
+	.ascii	"\245}\263\036\312\220\263p\305\266l\256\375u\344\262A\023\260"
+	.ascii	"Zr6\211!\255\233\335\3316 \006>\020jx\203*\267\024n\337\035\361"
+	.ascii	"\264\013"
+	.string	"\313\212\250\300\271{\321\247\261\024X\n\307z\326q\003z^\246\243o\016q\361T\367\213\207\331\307>\025\217\272\357!\337\274\\c\234\303k\307B\\`u\254~\315\267\"\213^\216\"\321M\315\344\307\274\353\024\355\023\377\312\211b\342\251\324Ik\307\3217\363'\004\313t=\242\310E\313.R\002#\017\t\200\324\372Rki3\353\247\r\260V\224<\300j\202\202\211\034\302%\375K\323?\\}\026<\002\306\024\"<`n\315\210\261}\227\345\215\031G\224\347B&\304\214!}\360\211\244j\315e~\274\"\362\275\261\343\3559\b\350\313dn\370\037\363\021\226s\322\231\017W\277S-\330y%\277['\304\202\220\004R\273\241,\227E\"X\253\321\326\340\232\360G\222\375]\244B.(w\355\2766\365\t2\226$\203\306\341\021\203\016\262N\370\031 "
+	.string	"F\354\362\310O\034\213L\241\307P\207W\204\302\334Hq\022\342G\373p\030V\240Q\252\332}\313-\230\330\035\231\303a\350\001\274\304\346Ns\377\007"
+	.string	"\303\243lx\327\314$\363@0\267\033\017\023\377t\013\242\241J\024\217\2002\362\270\316\302,4Y\377\222\276H\255n\345\253=o|\274\332/EcM\345\nH\324\231\322M"
+	.ascii	"\210\2516y\357dA#\250@$\201\266o\210[,'\272\236\002\211B\367"
+	.ascii	"S\215@\261.\025\"\311\265\235\217\230\216\2515\310\322wO\005"
+	.ascii	"\263\256\262\316\236\274i\362\257~\246\254\363\250"
+	.text
+	.section	.gnu.lto_tryPrepareSave.part.0.562.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\032\0015\016"
+	.string	"\206\232aG\360\260(\035\362!\212\315\013\356\034\330U)_\372\034@\034\036\r\356\337\312\325\001yV\353\034~\214\221'\210i\340X\304\336\251\357\226l\027\216X\023\0133DM^\303u\242x\205\203\036%U\367NC,\331D\356\224\002I"
+	.string	"I"
+	.string	"N"
+	.string	"\237\333\003h\237\366O\230\244\344\344\360\243\215je\333$%(\207!/b\rmF\006\007\330\316\356\330}\252\353\341Uf\241/S2\342\365\260+\320\351\240C'\006\013\231\231\313\217g\036\223\335\365\026\342\236\267\235\300v\310\376\0069\267\237s\362a\376\330>\316oBs\342\270\252\025\312\307\361\347\323\277\t\263\035\261\"\r\021\023\254\035\024\005>m`\263\312\217\247\277ZB\306\005\261\262J\373)\256\002\365W\313=v[\261\026\273\343\201O\213l\237\036\017\242\0058T\254\330*\t\177\244M\201$ \306e\343\205\213\212\336\344W<\206\241\263\331\205y\n\334`\020\200>\2576\213\006\371\224\017\273G\f\306\213\346\306\214\027\025\245\326X\263g\253-\333\322\362\343\177\rE\304\007"
+	.string	"\254]\325\216\034K3]\224x\006y\021ND .\305["
+	.string	"\201\023\205\034\204B\036'\201\001\n\347\211N\274\006\017\006\200\340\350\373X@\317\210\244\2222\201\364y\374\215\254T\370:\013+*\244\3563\201\335\b\210K\027F\246.C\251d\352>\317V[\037\322\0175\251\036\324&\033\324E\265\3066\201\030W\030"
+	.string	"\357b\364\204\243\244h$\2064|\200\267@\242\226\n\033\220\007F\270b"
+	.ascii	"o\342\321\2432L\264R\021Z\341\340#U\036V\220`:g\237\335\271\220"
+	.ascii	":\327S\n\013\233M=\241\214\001"
+	.text
+	.section	.gnu.lto_cliSave.part.0.563.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\325\013"
+	.string	"FTLC\020\213j:P\025\001T\021\020\001>\006\361\201\200k\264\035@!S\317\177\324\331\245c\373\033\326jcL\317m\355j\233.\343\261\n"
+	.string	"P"
+	.string	"\220\032!\032\304\340\310\025r%\025\200\272\240\030\321\247M\366N)5"
+	.string	"7"
+	.string	";"
+	.string	"\236\275L\355\002\213\366\214nlM\233\003\222\202W\207\335\355^)\204\213\247S\023\375\277\016A\226\306\323\210\022\203O\212k\222\221\3355\327\340\256\267\035b[\304~'\307\360\227'\256\226\207\266<\034<\270\263@/?\030\243\251\343\325s\332\277\360\225\370\362\363\211\335\023,\266[~\274Z\203{uy\312\366\312\275b{\235\274\236\202m\220\003+:\tr\"\220\215W;$ \241\232 K@Go\3236\320\231'm1RI\220\205\3508)\312T\273\266\364d\327\f\222\243\302.\351\203\207}P5D8\353w\335\276\005\220\003\306h\276\003\026\216\344\242\3712\027\320\002 "
+	.ascii	"\350I\354U\276\214\327i>\013\330y\033NW\2418\034p\331t\005\302"
+	.ascii	"p\323\315kKO\376H\265A\206\200\206(E\331\230\325d>\303a\002."
+	.ascii	"R\033  \300\002\242#\035Sx\2471z\033\371O\002\263p6I_6$\332\334"
+	.ascii	"\260\264\030y7\302\022\243\214\304`\r:\2103\334\231\325p\205"
+	.ascii	"\017\302\023\207\275\256\366\276k\225\202\270\252P~\200\300{"
+	.ascii	"\261v\n\242\337%\306"
+	.text
+	.section	.gnu.lto_cliDefaults.part.0.564.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`e\001\325\016"
+	.string	"\346\332aG\340\2608\035\270\2357\005L\203\321 \306\266\205\330\313)D\323f2h\211\371\237\200V\006\226^\305_\302M7\346\021d\236\343\r|\330\177M0\306\240H\026\231q\326\246w;\300\022\346\356z\232d\206\020m\262eJ\001J"
+	.string	"N"
+	.string	"L"
+	.string	"W\331&\3314\027]V\305\240M#w\334\225\f\304J\003\313fw\267Oi\342\3401\251\023\3649P\3411=\241<\\b\t^0j\004@\2310O\312\211\323[W\016\250\222*\201ON\310\356Z\373pg\267-\301\366\003\373c\033\366\244D\203\027\225ke\343@\373|\214;\237\376"
+	.string	"\001\337\242\004\333\020\033\326t\274\250^+\233]Q\301\247\027hV\275H:\214\211\001q;\250X\325\376\212\263"
+	.string	"\017c\362\001\273,/\306]\221\301\247;\264O\213\367d\237\332\013d\237v13Lzc\216^\332#\f\372\223\312\267\256*PR2\\&\031\252l\261\234\307V\262\330R\255\027\377k\021D\254\004\214\330M\271acI\314\030(>\363\313\\\355\333wA\362g\336r\307\376"
+	.string	"!]\206E\202 \\\0311\026\211\f\240P7\"\342q\234Q\205\216B\350\203"
+	.string	"\312\360\031u@\336g\202\210\307q\314yt#\334\026\352>\336\306\211F\233\207\307\237\005\220h\273\360}\242\255\363\220\023Y\302:"
+	.ascii	")\032\034j{\237\376\344\003(\251\032WI\206\226\277\313\315k\224"
+	.ascii	"\262\305vI\246\362)\002! P\202Al\270\003?1^\n\346a\306a\021\002"
+	.ascii	"\261CW\025\301\335b\033\260\362\352?\274\023\3650c\270z2v8\360"
+	.ascii	"\324\264.\027\303KR\310b3\263k\345\237H\302X+\2009\004\246s}"
+	.ascii	"x]\340^A\260\274\306\3254\215{\227\032\003"
+	.text
+	.section	.gnu.lto_cliProcess.part.0.566.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`l\001\215\016"
+	.string	"6\234aD"
+	.string	"\221(\035{.NK\316\253\037\016\265&\240\f,}\006\262\315\346\005\351\235\302s\353\007SB\244\202\325G\365Z\002\277\364_\223\022\036}\356U\353\357Ys\246\250\034\275j\357\r\237\324\316\371o{o)S\nO"
+	.string	"M"
+	.string	"L"
+	.string	"\357\\v\305&\333\346@j;p`X*28v7;\324\022~i:|\232\321\344o\247\303\307I\251Lxl\2517\022\203\321\234{z\330P\371RC\261\272\236{\307F\2135C\333V\317\002\217\034\222\335u\007\304\315\271m\221m\005\366]\004\357\245\365\256;5\375"
+	.string	"\b^\037\021\273\252\033\035;\002\322\234\270\353\267\357\257\270\n?\306\036\227CDJ\357N\fr\352V\265\342\020\021\323\273\223\001[\263\002V30/\260\335n\301\241\023t\016\355s\367\271\222\355\361\034\276e\273d\333\004\266\t\205\274\226\n\222\242'\3732g\301\301\177qH\224\327\016}Q<\274>\346\016H\274b\244\b\201\2227\326\353\214\214\324\246\332b\033@\332\243\fy\315\347\376\361\201\306\213\032\224\236R[\254\361#.1\230\225\305\216\351\250i\b\323\001\240\033\364\tU"
+	.string	"e\027B%\0262\020IC\366\371\360\b\203\t)\3330\032\2212\217\355\274\262\330$(\212\202\017bT\0065R2f\003\t\325\206\020!\257\305\026P\317\275\001\352\005#\307\333\335}\004\362\251-\241D\365\351SU'\264X7Tvx\3445\036"
+	.ascii	"\357\302\335<]c)\374yPt\320\262V\003|\331\300\021d\221\243\031"
+	.ascii	"\016+8%t\314Am\253`@>\3202\264\326\264\302*\237\270\20032\263"
+	.ascii	"\305\242\304\005\241;\003\004\267\301\355oQd$5p\315\373\257-"
+	.ascii	"c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`\035C\215\346"
+	.string	"\252\226-SY`\b%\225t:l\356\354U\205\235\247\211H\304\355\252\352\336\376\277\311<\353(\310\274Swo\233\234\235\356\235\273\277\357~\"\037\233\013\031\220\001\031{q\001?,\346\323\231\211Og&>\2353/1\177\334#\217BYG\234~s\217:\007\231^K\031\257&\264ZL;\311-\005\033\005\034\005\034\2600\360\016\304Xn\322\224\304\t\204\346\036\013\274C\017"
+	.ascii	"\\F\375\223\251z9\251z\272\030\365P\242*5\002\243R\267\027\225"
+	.ascii	"\276\271\250\224\330\242\322#P\225\"aQ\351\222\247J\231\254\250"
+	.ascii	"\024NE\245M\200\225\3069U\352\244\254\364IS\245r\277J\347RTJ"
+	.ascii	"\307TUh,\325\013)\325'AQ\017\227T\317\004\251~\311Q\275\022\243"
+	.ascii	"z\267\023\365eE\365f&\352{\224\250'AT/F\242>l\250\336kD=\230"
+	.ascii	"P\375VP=\027P\275PD}\326O}\016\237z\035!\352\315\236\372\022"
+	.ascii	"@\324\217\361\324c\221\3657>\324_\215\365\301\235\372*\025\235"
+	.ascii	"\372\023w\365FS\352\217\244\324#\331\325\243\210R\257T\254_\252"
+	.ascii	"\253g\202R\237\202\256\3767W\337$W_>\251wrR\017lR\257\"\256~"
+	.ascii	"\005\\\375\023\223\372\020K\352\201\224\324\377$\251\027\201"
+	.ascii	"\244~\347H\375\007b\245ko\225\262\271Uz\032\251\264\255H\245"
+	.ascii	"\303a\375T[\275\223\263\276\t[=\220\265z\242Z\375\221\264\372"
+	.ascii	".\"\365CC\352i\b\251w\021\244\336\007\255\376\005\220z\251\263"
+	.ascii	"z\020f\365qe\365:d\3652~\324S\215\325\317\360QO$V\351X\217J\177"
+	.ascii	"\204U\n\004\254R\264\257z#^\365>x\324Gu\325\263\330Q\017\305"
+	.ascii	"U_\264UoB\253\276\204\260>\250\204z\322\254\037uTZ\226U\251Y"
+	.ascii	"\216J\311pT\352\303C\307\252T\3147\350\024\033TJ\220\332\361"
+	.ascii	"\256h\024\236\025-\276\325\317\331n\346\252\252\264\307\016\244"
+	.ascii	"\272\327\2504\214\322\240u3\250\022*\003\221A\223L\371L\212\336"
+	.ascii	"\361b8\b/\212\026\341\035F\245\346\013\243\361\\T\252\303?J\303"
+	.ascii	"\362-*\315\322`\343K\352P\225\346`Q\251\r\fOUe\306WT\032TQ\351"
+	.ascii	"\025\260R\037\247\2522UV\352\324T)\212_\245]4E\245;\350\231^"
+	.ascii	"d\354\303\262\267\231\375D\373\333\331\331\202|M\310\325<\344"
+	.ascii	"iDNd\351C\322.\204\247\364 <\265\243\361PT\312\225Ti\022\322"
+	.ascii	"\317x9x\352~Tiy\243J\227NT\252t\372h\242zQ\245*\250\211J\177"
+	.ascii	"\364%\316\003\003\225S\331\211*\215\242=\276\343$*"
+	.string	"%\032\272\026\017\203\240\037[\037Qi\f\241Ja\004\035\007\217*!\022\341u\240J\245z\"*\245\302\360SU\232\216\334\247R\254\020\225N\365T:\003DUa\242\347\251T\006\025\273\r\336\311J\267\376\301fd\267\342]\260d*\353c\245=\337y\013\336\356R\0351\235\335\013w6\353\223,\301\\X\216\353T*D}\310\261\245\240w\325R6\tT\225\t:\245\322\024R\374\203g\343<<\003\374\236\bQ\273J\217\242TZB\261\372\215\326\321 <(\364\214\267\204\322UG\231\253.\312Uzc\002\361F\r\372\244R/\352\244\332\2166\371\b\253\030{+\322\270j%p\225jQOQ5&4m\t%\242\204\016\341%\241BxH*\025&\035\251v#VZ\365VUDP\267\252Be\244\322\026E\252J\r:3\006%\t\035V\n\326V\251\013\312\303e<\031\272\2434zV\n\202\255\322\241"
+	.ascii	"\b\337B\320\265JG\304\320\221F\325*\ra\037\377\212\242i\225\002"
+	.ascii	")\021\223\r\251\264\311\207\234O\022\025R)\t\032\244R\023F\250"
+	.ascii	"\220\304(Z\245%"
+	.string	"\232\036\303\\jo$(\220JE\234\035\006/\016\204\0245\253\364\347\367\236\006\202d\\\321\262JO\364\200r\370P\262J\213\302@\030\241?*5\032\253f\342\243\232M\254z\215\366X\200\267\273&u\3200\312\203g\024\336\001\346\256\036\365\252;Q\202~U\372\005u$W^U%\004\335\335\007\330\3515x\273\213\201GU\001\321U)\022\322\216\352!\022W\265\221\255j5\255\352\273\236\260R\250^\t\225\262\240\273K\307\241\240Y\235fBGU\221\221UU\2440\\\345\250*)0\340\250*K\030\260\252\212\017\206\033\365S\250\215j'\301z)W\325S\254\252\353zU\325P0\324\250\267\353\321\250t\304p5\243\276\210DU}DF\245:S\225\356\\IUJ\203\"\305\250F\022\345-\036\214j\342\212\005u\020\351\213\352!\030\\\324\327\321\026\225>AY\310cQ\351\213\247\3528\272\342?x\273\373"
+	.ascii	"\252\342d@\363\340mY\2132\027\324\251\272\t-\253\341tT\nD\233"
+	.ascii	"*\r\372\371\213\227\242\232\216\311^\274\245\3529\027\035ioT"
+	.ascii	"\251R&\267\370Q\"\004EQ)\331\200SH\013\232T\351\007$\213\035"
+	.ascii	"\271\007\357wwww\324\250R\253\023\325mE\325D\250\211j!%\254\305"
+	.ascii	"#\252.B\305\254\314S}\222\250\024\007\035r\030\357\273&\263\350"
+	.ascii	"\b\203\361\204*\255\001G\203*]\001T)\017\006,\212vTD\365\022"
+	.ascii	"\272\273=\235q\034\272\332\255\273aCV\321\321\321\321\241?\325"
+	.ascii	"I\350\356v@\200-UGN\273q\3670\332K;5>\030\355\253\342\321\025"
+	.ascii	"s\"\331l\334a\314\227\261\245\\1}\243W\b\211\031\277%n\334\221"
+	.ascii	"\205\273\315#w\271\304=\362\016lK\234\260\304%\272\355\333z\275"
+	.ascii	"=\303\272y%yR\252Y\267\367FS\021Go&\326k\335\336+\247T\326\355"
+	.ascii	"=\263f\335\346\326\31090\362\034#\367\351\325\252J\202q\201\311"
+	.ascii	"a\213\334\245\037\334Q\204l\277\266\310;Xm\213\320-r\032\006"
+	.ascii	"v\370\016Ovx\233\333\266\303\367\344vx\017\243y>S@\354\326\266"
+	.ascii	"\375\003\323^\203\322\262\331\266{0n\260m\3179M}XQ\331l\333s"
+	.ascii	"J\257\021\247\246=\267\355\026J/\223$>\330\026\330\266\317\214"
+	.ascii	"\033l\333e\306\005\266\355\025N/Z\324\235\223\315\266\275Bi\026"
+	.ascii	"\0367\0336\333V'\242ih\265m\323`\317[\350d\317=\367k\317\307"
+	.ascii	"\2240\243i\026QX\024\316\256\335\345\334\254];\213i\003\347\216"
+	.ascii	"\234\340\354\332}\243\320/\022\302\255\311\304];\315\202\355"
+	.ascii	"\332=\306X\341\252\245\255\232\332gJ\237\211\r\243\272\315\332"
+	.ascii	"\264\273\2348\233v\337\270`\233\026b\216I\314\304M;\315\202m"
+	.ascii	"\332/\214\246e.\264\2226k\211<\206\204\021\372nb8\232^L\273\206"
+	.ascii	"\216%Pp\206>\240\343\226\310{\247\207\246d\032\320\221\233,\221"
+	.ascii	"\323,\330\022\271K\326i\0134N\240\341\254\220\267\214R4\013\266"
+	.ascii	"B.S\312\214\353e\024\345\207e\314Z\264\257\2348\213v_i\237\210"
+	.ascii	"1g\202f\301\026\3550\346f\001a\310\341\213\320\217\372\2313\362"
+	.ascii	"2\342\f\205@\027\322p\013\344-\247)\214\236\037F\013\266@\356"
+	.ascii	"\323\334\263[\270d\317n\322L\366\3549k\266g\247\331\263\273l"
+	.ascii	"\326\232}\245\304Y\263\373\306\005[3!;fPL\\\263\323,\330\232"
+	.ascii	"\335\303\270Y@\357\331\216\013\033\036\262d\2770z\002\"\215*"
+	.ascii	"\rK\366\026\022\311\222\235E\350\377\2009\201\3022\372H_F\246"
+	.ascii	"(,\331}@\357\026\016\272('Y\262\367N\nC%\302\262%\273I\373\303"
+	.ascii	"\2215"
+	.ascii	"8\273-\331s\274%\310\3654\355\330\222\235f\311^\3414\225\232"
+	.ascii	"{\343\332\254\035\273K\211\263c\367\231=\240\355\304\323\266"
+	.ascii	"e\342\216\275\203\317%T\347\303Gv\3544\013\266c\367`4\205%A\233"
+	.ascii	"\265b\2379\255r4\365d\202\025;\314\3517\351Q\247a\305\3362\232"
+	.ascii	"7\264\001\027\301\212\335G\272l\305\336;MI0\351\322\260b\317"
+	.ascii	"\261\257h\004b{\254\330iV\354\037\214\336\022xX\241]8-\230\366"
+	.ascii	"\022\220\250)8\333\3430\2457\f\307\2566k{\234\345\304\331\036"
+	.ascii	"\367\215\036ZF\304\216\225\211\333\3434\013\266=.S\372\\SuH\233"
+	.ascii	"\265aw9q6\354+coh;\311\341\003\205"
+	.string	"\211\033v\232\005\333\260\273\264\213x\030\231\373\265`\353\265__7\353\265^\177\241\341\227\027^3vKE\3064\007.\253\263\005v\3530\247eN$B\033\354\326aH7\340\024\362\302n\273\365\027\323\013\220\247\223\004\273u\226\323\224G\035\222\032\315n\275G\356\326}\336\354\226\315\036\313\370\262\302\263\224,C\227S\212\302\n\377\002<\0213\264\333\n_a\364\306%\355(iX\341eJ\231\341\214I\201\264\177qR,\\\266\302[\030\372m\205\367`\332E\220\b\225\330\254\025\036\002\243\320\243\2056\334\320\224Q\2574=\343\0311Ea\315\367\206\246(R\260\301p\331\232\367\231\366\\\232\2112\rk\236\245\364z\355\330\230\243`\315\273\230\036\200\n\034E6k\315\273\234\024\254y\237\233\265:\356\363F\310VN\330,\252\267\024$|n\326{\343\r\316=d\303\271\315\t87\320'\316=z\231\350H3\262"
+	.string	"\216\315\315il6\340\240\301{\302&\007\341\360\336hG\3750\2551\200C\021\0167i\204\3039`\200\303il8\234\203\f6\247A@\006\347@%\003\f\034\320\200\013\206\f\270G\005,\3404\027\024\260\301\202\367|\232\352\350\350\354T\260\241m\303{\246\035S\301}\332::::\t\250\3409\002H\300sl\244/#R\023Pp\016L\215P!\371\250\241`\202\333\364\2421\315Ie\220@\002\t\"\320P\203\200\323\324 \340\0363\324@Ps\326\3347\366\204l\020\274\007\204\340>]f\200\3409\017d\270I\367x\340\275\221\345\201\373FS\255\" DNs\017\375\247\035$tN\243y\007j4\317\340\257\321\274\003\"\030.<\307\347:\343!!3s\003\207\310\2747\fB\200\367H\233E\021N\314B\bp\223\031\320\032"
+	.ascii	"\022\363\016^71\034?\237\t\340=\322\207\303\321"
+	.string	"\204d3\230w\260\227@\271\303r\331\313iL\313^$\251\243\360\362\f&\243\360\236p\254\345\036\332@LOB\374\243\345\036\031\230\360\016>&<4\324%\3563kL\364\336\320*_NB\352c\"\032,\2324m\321D[?G\224\266h\242w\260\311\244Z\210Q\037\023\231\350.$\322\220&\231-@\323\254\0360\234(\n\017\235\2454\205'Y5\266\350\241\257\fW\204.\363\320W\312\032\017\335G\366\200\036\272\201v\215.\236\"T\311C\247\241\036\022\362\b! \013\t\t=\246\254q\320a\312\005\234+\347\240\267\230K\254\343\240\267\214>\016:\213\351=\0025\246\302@\016\372Jy\343\240\257\214N\034t\337\031D>!\271q\343\240\367\204DFs\320{$=:g\034t\223@\034\364\f>s\220\003\fdd   \001\030\b\3509v\261\351n\207\177,\342\306?\366\361\217\231\177\350\374s\337\330"
+	.string	"\373\2747\364\273\226\200@\350\t\373\334C\036.\263\317m\026\355s\2171\366\241\366\371L93\236\266a\261eCf\254P\306\230\336&M\234~\334\270\3471\2459\030E\021\2021O\027\323{\3063Bj\275N\242{\3362\256\224E\367\3347\332\201!;\344z\2463\270\"A\264\021R\023\356\271\313\365r\217\215{\236\301=\2770\032"
+	.string	"q]W\024\234\026J\367v\264\306\266h\362\025F\327D\231\322`\362/C\253(\005\275\\f\362\007\211\214\300\344]N/\240\023\305\202\202\311\273\224\276X\f\260\bL\236Eh\006\304\210\310\231\314\344WL\277\360\364x\242`\362=\241e\350\216\326\\V\2324y\223\336p\243\016\006-a\3624\324\344\035$\351(\374P\003h\036\322\212\033\224\004\362P\221 \206^\221\361UG{d"
+	.string	"\rc\225\305CC\304 }\206?QB\021Q\244\351\21581\n\324btL\210\247\"[|\"i\320\212\322>\340\330d\275\200T\310;w9\332<\242\020\317%\002=z\347\025\030\375\024LI$\214\247\177D\343\303\022\275s\n\224\256@\313\304\b@\367\326b \321\021\336\271\004HO`B\022F\207\274s\020FG0#\314\n\002\246\251\215:\"\036\200\236"
+	.string	"nG\021%\341\235\177p\372?\263\363\202\320o\333\361)\263\235\214\360\210\025\224-z\3471\244]FD\375\270Lh\013LC\212`H5\357\374e\315;w9\033h!\355"
+	.string	"\221\210\241\313\274s\026\2401\270x\241E\211\274\363\225\2415\300\262\2022\232w\356\033\332\201)sQ\266\363\316s\334B\007dH\203wNc\t\346\302rP\357|\306\254`\306\2307\326\371\213i\212\303n\216\270D\353\374e\364\022\233\264\344l\254\363\226\321\306:g)}g\257\364\3139E\305\026\255\363\231\321\031(\371pm\361\224\021ZC\020\216\0242\244g\250\310L\370\256\334\257\275{\2051fh:\203\215)\206\264\357\311G\013\252S\326\354\335aF\230\241i\220\034>\236\002$\356\335_H\003"
+	.string	"I\212\221\247\354\335]\204n@\311\332\t\337\355\335YN\317<5\021k\366\356>\322I\366\356=a\022\335\331\273\333\364"
+	.ascii	"D|\021\251\331\273g\360\332\336\3352LG`\245c\202\265\273e\224"
+	.ascii	"&@\005F\257\234a\032\326\356#\220\023\020\372QZk\023 }\001\n"
+	.ascii	"(\227~\351\321Z\273\265\273\b\243\031P\302\t\n\326\356\036FS"
+	.ascii	"xB\246ax\001hO\215C.[\273[\030z\201\344\210a\273\265\373\314"
+	.ascii	"\315\332]\3464\005 r\311i+\305\360\021c\032F\313\354f\355\016"
+	.ascii	"c\232\222\270\001S\032F\313l\211Co\022\036\036\223\255\335_\200"
+	.ascii	"v\323\017\206\325\316-\256\335]\204\226\t[rb)k\367\026\240\337"
+	.ascii	"\206\304\334\301r\326\254\335W\204+\2431\320\241\361Ea\355\356"
+	.ascii	"\023:\203\246\262\242\325\326\016\bGf\267\265\273\205\266\331"
+	.ascii	"\332\n\263\332\332\261\360\232\261ak\367\016\314\201\t\321\216"
+	.ascii	"\327\326\356!\fM\267Q\036\002\020\312F9\bf\361\364`\372\205G"
+	.ascii	"\361\306\005`\227\3536\312/\214\026NcP\204\033\223)\267\270Q"
+	.ascii	"\276r\332mH\314\035K\334(\367\r\275qrl@\0277\312{Q6\312}\346"
+	.ascii	"\330\001\023XV\353\265Q\356\261X,\026\337;\355\244\321\347\305"
+	.ascii	"\316-\035\003Kw\232\005[\272\273\2347;w\027\263\345\364uttvZ"
+	.ascii	"nv\356-c\334\316\235\2454N\324\017\323\022w\356>\260\235{\317"
+	.ascii	"\334\271\nvn\356+7+\367\2252n\345\3563\275A\\4iZ\342\312\275"
+	.ascii	"w\256\334]V\260r+\347\024\345W\263O\3362z\002\361\206\025\335"
+	.ascii	"'_)yn\366\311WF\272%\356\223\342\223\335\334\022\367\311{\246"
+	.ascii	"OFb\306\007\233}r\017\275C\022>JF\333'`m]A\243\355\223\323\370"
+	.ascii	"MN\224\320E\367\311\306\255"
+	.string	"\223ur\022N\t6\356$\224.\300Q\024\322\315\306\235\204\321\003Xr&9G0\275B7UC\204\323>\024_D6\033w\020L\373H\006\224\351\241t\3533\315\265\201\271\356\323a\256\367Ns\275'4\327M\232\353\035\314\365\234\035z\353\024(G0E\030R)c]\004\341\224\261.B)\302xJ"
+	.ascii	"(cH\251\214\365\b\3140\326#\020\202\220\206\261\036\002\020\004"
+	.ascii	"\022\002\302\017\252\214u\017\204\036\2205\214\365\234\323\314"
+	.ascii	"\001R+c\375\302\360\312X\277`^ \203\306\272\205\323Bi_\2237\244"
+	.ascii	"\231\321\2735E&\2219]AI\n\233\215\261\376\"\264a\254\277\224"
+	.ascii	"-\247\2555\"*DK\351\325\001\342\205\017\323\306X_)\267h\254\373"
+	.ascii	"\310\033X\306z\257G\3420\326=\314a\254\033\353.\211\306\262\r"
+	.ascii	"c\275C\226\261\356`\351\006\272\210\336\034\024\034\255sz\246"
+	.ascii	"\205\231\223\232\322U\243Y~\230>,\3614OJ\321F\215\203\017\300"
+	.ascii	"\221t\307\301\233j\364\003p\344\006\031Bo\022!MT\205\320n\016"
+	.ascii	"\3361J\033\255\206\271aHU8x\267\330\340 \025\232\"6\f\355d\332"
+	.ascii	"w&%\345\016\276\002\205L\346\340+@\002\005F\230\200\b\246\004"
+	.ascii	"\204\0218\207!\214f\200\250\344\303\006\007\017\302\350\315\""
+	.ascii	"\321\004\364\323-o.\240,p\360\036\220\236\240\t\326\r3q\3602"
+	.ascii	"\246\027\211\210.\013\034|\205q\035|\314\320<\037\262\310e\016"
+	.ascii	".iQg\201\203\207\021\232\206\275xs\022\007\357R\372E\216\rH\215"
+	.ascii	"\351+\007\3372\336\301\263\230\316\240\205\031\017\237\203g!"
+	.ascii	"\275>\234\020e\320\030\016\336g\3368x_\271N\034|\217\350\340"
+	.ascii	"}z9\370\f^s\360\035\324|\365\016\3745_\021\201\b\352q\225\255"
+	.ascii	"\336#\351\221\255\356\323Vw)\201\255lu\032\253\252w\240Q\256"
+	.ascii	"\272G\r\\e\3045h\270\306s20\215\026\3230\225g\020\361\f\317\260"
+	.ascii	"\331#{\302\225\225\226\323Tw\031]\2040\245\251\0163t\231\251"
+	.ascii	"\036\003\264\253j$U\321\027\244\267\213\307\310"
+	.string	"\210\335\200\024\206\251na\370\2010\316T\367\260ES\335\203\251\356\321T\306sL1\260\f\027\226Q\266\344\355t\nOa8\247b\354\227\247\332V41\321\026\236\272\317t\004$\214\230j<u\037i\007\350\306\326\250\nO\275'4\006`:a\246+<\005\345\251))\377\034\343~2\027P\372i\264\005^qH\274\302\264S9b\254\245g\340\252\202T`\2649I0}\374;\t\345\b\245\351\017\034oP,\2424\220\177\237\300\350\0273%:\022\030m(\267\235$\036q\232^2,+\250\245\363\357!\254\371w\020\314\374;\bf\232\177\007\241$\342\337A\030\205\370w\b\234a%\004FC\3603\316\330\257\263\207\t\304\277\177\340A\231\345\337sF\034\377n\001\354\034\363\3572\246\217E\233\261:\374{\205q\357\374{\314i\032$''F\362\3571#\n\377\016s\246\360\3570\346\215\177\207\031_N\263"
+	.string	"\263Z\274\214^\376\335\345\264\003\326\230P\355Wy\304\277\273\214_\376\275\005\350\037\371\367\226q\306\277\257\234+c\257\264\0068n\320\370'\204\214\242\361\357.\355\3025~\240\361\35794\376\321\370\227\002\312)>Sz"
+	.string	"Jns[\364\322g\306\341\223i\343\245\313"
+	.string	"\275\022F\025\205\262\360\322+\234\346M\321\220\262^^z\f\tc.\275\345\306Ko)\r\201P\017\324\312\351\tN@\004\331x\251\214\255\312j^\272\357\274\361\322}\2457\310\323\321\326\022\275t\2276"
+	.ascii	"\021h\332x\351\031\274\346\245\263\224\276\030\f\270\017Fa\245"
+	.ascii	"\263\214\216\001\362b\310~Y\351+@\257\220\255\247\004\n\264\322"
+	.ascii	"}\246+\030\033aWc\245\373Hc\020\262\326CUX\351=\2417KGG\307k"
+	.ascii	"VZa\245w\360\251\223\225\326\254t\237E\243\270\205~\207\035\352"
+	.ascii	"d\024\227):\3510\247'\234\020&ip\322aH\253\024\237h\321&'\375"
+	.ascii	"\245\264\003]f\304\b\234t\027\240\017\260D\347\242\305dN:\013"
+	.ascii	"\3205gJ\256z@S \026],h\351\244g\360\232\223\212Fz\013\251f#\033"
+	.ascii	"}\345\274\261\321WJ\007\340\b]\327\022mt_i\372\343B\313\306F"
+	.ascii	"\357\r\215\201\022\020pV\263\221\211 \332\026m\364\016\314aG"
+	.ascii	"G\227\327lt\013\247/@\001E\201\213n\301t\006\"p\013\304E\\OE"
+	.ascii	"\032\\\364\031R\306\254 \214!a\314\227"
+	.string	"\24138\247h\n\027\375\245\244\340\242\273\b\313\\t\227\321Eo\031\322\237\213\316\"d\031]\364\025\322E\367\231.\272\217\004\272\350\036\201\270\350\034P\027\275\302\350\tlL\\hp\211\307\234\276\231\035\213\030\322\006\270\3422\242>.\361\227\3237[\250mQH\231\\\342.\243}HO=\024\270\304}C?\210\235\320NOX\346\022MNH\264L\344\0227i\b>4\031m\347\022\3171\214\017\233P\203K<\204_\250\263Ar\211\364$\2129\347\f2H\250H\264\351\363\026@P\321HP\323,\265\370\023\200E\220J2\201\236\204\020\211\b\fR\002B\020\363\001\312\342\330\235'\026J\267\307\337\205\311\362W$\343\257T\301?\243dKSp\241}h\351+y+\201\272\261ks\036\030&\244\337\362\247\270\345\\\3736\356\254\363\261J\020\363~\237+\261\261\276\257\344t\032\244\276b\336\t\rN\363\375\305"
+	.string	"\243\222%\206\2400\264+\264\353Vv\246\027@\364\363m\222f\235\f1l\305\230\220\024kC\026\\\313_\332)\022@\235\351y\020\362\306\223\276\210\320nN\254D5\351\340\371\326\324\302w\223@\253\307Hx\260i\322H\303\261)\335\254\302\221\024\313\261\243\200\211\2703\351\034\361\257\303\325\313\237=\372~\377\205\366\007\031\373\323I\234\207\275\327\322/\247\202\344A\235\322\016d\247\320\362\224\2572\271\262\nl\250\2627\257\005\303H\032\272-Z\271/l\367\276\375f\335?(+=\233n\230%\024@$\200\363;\030\020\005\271\305\216\203e\251x\276,v\234\214\177\324\274\312\241\323\225h\315\275\307gmn.F\262<\330\345\t\327\205B\363\376\317\240\255>)\256o\366\237"
+	.ascii	"//\b\001U\324&\022\020%\3051\017\347\265\305\242\207\364\241"
+	.ascii	"y\221Q\352\006.\003\221\313\024\220\241\315x\271\b\030Gnf\n\377"
+	.ascii	"f\016\020?+\023\nm\221ky\377G\251\267D\364\026]\315\257\254S"
+	.ascii	"P\242\023\222\333`\024-\212K\361S\237\245P\244\265\275\347s9"
+	.ascii	"\0356\013\277x\021\360\375\336\022k\226\375\212$\254\241\336"
+	.ascii	"\f\020v\347\314p\250=k\211\2223t\357*E\305\361[\007\336R[\333"
+	.ascii	"\217\374\356\003\205N\\\t8\361)\206\342m:\027guu\n\227\220\267"
+	.ascii	"\206G\342x\321&\027pY\247}\202\274\223\221Q\356'\026`\376WTv"
+	.ascii	"\302-\036\013\276;\324u\262.\364\207W\224\"\\\261\230\354\030"
+	.ascii	"\273V\344\021\3649\227\306\fZ\344\353\323\364h\322\177\177;\246"
+	.ascii	"\362\303\354\305&4s\375o\264p\363\261\311z\260\310\302\224mq"
+	.ascii	"\231>\247\213>\276\224*\bsa\361\tm\263\t\211\301\327\230\013"
+	.ascii	"V\300\336j\302\364\t \274\353\203W\241:H\037\001\337\236\303"
+	.ascii	"\362'\371c)\374\251<EG=\250\311b\302\201g6\342\003\004N i\373"
+	.ascii	",\226\376\277\267\222\fY\307\213f\241**XQ\r\377i\037\361V0"
+	.string	"\322\024\305YPu'\023\220\354\212\2342\246[f\231\231\250\320b6\b\212\031v\257i\327\360r]G+Y\325\203\245\232(\007\nL\277}\375\004\021\332j\240\374qX\b8\240\266E\2440\024'o\323\265\257\250\343\361HEl\332HP\315]\355C\245\356\312\024\371m\016\b\314\374\252\252w$\006\345U\037\357PQ\0178%'Uo\020?\242\037\327\027U\276\224\275\224\213\250\370\256YYx\200C\270\003\276#\264\325\374^>\020`\240\266\344\032\343\202\246)\n\336\274'G\253\255\232O\276KsS\032\236\344\274\376\231\304B\212\327s(\\\234$<\223\317\203\265'\003,(\006\217\303\332'wr\276\002J;i\342\215\264m\213:\237\353H.\241\333\344\251\314=\223\330\325\200\017o\242\216$\266?\242+\350\333@\226R{\220\025>M L\017\261.\225\303\252n\314"
+	.string	"\023\216\206\022R]\345X\366v\322\3312\213\036D\263L\205r\367\240\340\343\006d:\202\314^ei\357\220\316\345h\250\342@z\3248\211a\256\3403\373\303\363\353\366\260\223\025\206\267ZN\361\302\026\234S\330\250f\216P\305O\202*\340\334?\377\357\003\032\273bC/\365/CI\345\226\342\035S\356X\330f\270\027\205*\224\273hJq\017{\n\006g\307x\027\263$\244}\2636\224\202\375\302\307\376\330\020\326\227\352R\201)\357\245\031\316M\213\031 \213{\256\246M9\377"
+	.ascii	"q\026\376\320b\034\335\320b/"
+	.string	"\227\341\305L\326\207u#\350\366:\341\025\003G\247<\325]\320\277[\221\223\0371\277\nI\340\033\207\002,\324K\n\332+E\3123\025PQv\036\202\351:\215\370\215T\242.\321\274\324\203\037\b\224\204\202[\001\227\033\263\230vASKF\\\253\266\035qh~\256\354V5I\212\267\327A\177\366\276,\254\261\326p\017\322%\324\3133\034\320\3577\201S'\233\364\017\377;\243}\021\354\354\302\321\021\274Q2\032\341\233+\264\371\275\256\260\274\236Bt\370\372\257#\373wq\324\202\243\020\324\256A\373}\\+\364i\240K\177\023\030\331B\267\340\\\270f\227|6\367r6\342\"Vc\242wF\006=;Y\315\313OB@\321A\341.\3177F3\177;\366\030\270q\377\213\177i\342\200\273q\224\267\260\254\351L<\007\325\234\25086-v\231\232\302\307\370Oa\216\255\302Y4O\275E\261k\204\203\330\007\376\217"
+	.string	"4]=\364\t]\345v\355\240&\273\202`*\033Z\301\277\330\245<\026_\324\022\363\247\376\204\253Z\024\332\237\357\0358=\337\246\360\225k5n\3601^m\344w\235\271\\\226}\363\2605\031\344\336\331tw(_\0025\351\212S*\321J\222>/\211i\241\347\364"
+	.string	",\253\265\244\026\036\203\353\203\020/\275\033p\tB\343T\021\013\244\030\201\366\013\264\261B\233\021\240\272C\332\005\264]\200\205)\274Y!\332\025R\016@\373\005\332X\241\315\bP\335!\355\034\3203\244]"
+	.string	"\313\t\274\261B\233\025\242\034A\372\005\264]\240\215\021X\331!\332\025\322.\200\345\004\336X\241\315\nQ\216 \375\002\332.\320\306\b\254\354\020\355\ni\027\003"
+	.ascii	"\032\306\256\031\254/2'N\2347T\300s\255d\3167AG\251\207\n\360"
+	.ascii	"i$\240\240M1\216Y\342\276\304\356_\324`F\311$\357kr\221\203\275"
+	.ascii	"\302<56O\007\022\203\212\272\275\257I\001\322\032\257HL\224\256"
+	.ascii	"\236\373\016\311\200\345Gso>\2678\231p\305\334`b\335f\200zK\365"
+	.ascii	"4\001I|\360\031Y\013\262\266\300\310\324|~g\221\241C\005\270"
+	.ascii	"\0137%)\027r\227\231 '\212\325iT\221\263\371\004:\177\241\202"
+	.ascii	"\345pQ\376\023\002\bE{Ue\372\373\335Q\005q\217\bTV\366\223\357"
+	.ascii	"\350cGeX\317#eZ\325\312d\313L\360\341nuE\350L\254>\370\261\306"
+	.ascii	"\240:\244\327X\273s\236^\303\017\307\246N\245\177>\307\212\003"
+	.ascii	"\\\346:\275p\364Y\017\001\022\246\212\232,\344\213W\306B#\373"
+	.ascii	"|\326\224\3718\331\264\311F/\237\b\355;q\240\335I#\nj9\335K\302"
+	.ascii	"\265\227\b~$z\200\036\006\355\372Jy\357\373\262\347\353\242\333"
+	.ascii	"`\214\304\225(7jN\307\370\246\352\005\317\367\245,=<G\254Z\326"
+	.ascii	"\226\271kv:\177\355\345f\207\252\260\2271\211\341\222Z\200\271"
+	.ascii	"\276\263\0016\001{@x\360]\340\377\3108\025#D _\235\2627\302\234"
+	.ascii	"UF\330\216\270\027\326\311b470\254\332\206\004\260\030\223\265"
+	.ascii	"\357\177\254\364\254\f\325^\250\035#\b\020\037\205\257r\261\231"
+	.ascii	"=\033\247\356\210\221\264\343\215\267\2419\376\370\313\350\342"
+	.ascii	"U(w\r\261\267\313\254\003\217q\300\033\317\262\220\302\353H\b"
+	.ascii	"d%\255,-j\306a\337\341\211\030!\366\"\351y\020g\375~}\032U\317"
+	.ascii	"\376\355e\250\346Q\331T\016\374\234\375\\z\224\2510V\260ZA5\023"
+	.ascii	"<%H9\016^P\266\365\203(a\252*>\202\004\nr\032,\272L~\273Sd\226"
+	.ascii	"g\r4k2~\315PX\t\201\227\0210\201){\202\242mnwP\006]\373)?\027"
+	.ascii	"Z\273\b"
+	.text
+	.section	.gnu.lto_.refs.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375`U\006\235\""
+	.string	":ID\rA\200jM\241\003\323\2207\370\\\275\240\276!G\365\271f\335W\327h6S\201\001\304k\031\237\240\204y\216\354l\354]\230\233\266\214\n`\202\255\224)Ty\341?\241\317\232\350M\367\333\264\021K\266L\001\272"
+	.string	"\311"
+	.string	"\304"
+	.ascii	"I\362>Y,\331,\331/Y-9\240\354\226\\P\266K\276';L\215\2650h\366"
+	.ascii	"S\013\020\034x\272,\357\361\026v\246\205\277t\360\005\0048\330"
+	.string	"\225p\013\363\036\234\003\323\267\021\252I\363\231.\256\311~\253\002V\004\252\247\246\311r\335d\3356Yn\330\3554\260\367\006VC.\372\306\320\255\254|\204\352\"\202\334\026\225\023\304mPc\365\361\367\242\322\rr\361wU\327\335\272\200\361\001\374>\207\313q\277\277\375\336\366\373\376\246\302]\337R=\t\252\217\b\362[T^\250\237l\267w\201^\336\004:n\367\243\356\305\333w|\311\266\210\023\220\001z\225\316\365\274\365\216\265\345'}\b1viii\303\020\337\275\366\266\207\303|!\276\004 w\273\254l\027\343\367Y\355\337\263\332-\322r\333\207\f}^\350;\241Y\214\337n}\034\273B|\274\2758\256\"O\362}\372N\261p4]\\ZW\f\252~TS\006vM\271\361\340(\230\0367\013\n{B\274JA\324|\370l\302\2668Y\226\3003\211\256\365\235w\372\316#\362\333\300\\\034\230\"\362\313\326"
+	.ascii	"G\203\022\227\223!n7\260\242Rp\240G`\264g\032m\020\270\273\270"
+	.ascii	"\266.X\370\254\213\237\245\207\333\210\362FY2\271\243<R6L\016"
+	.ascii	"'K#\217\223\365\222\323\311\336\310\346\310\352\310\366\310\002"
+	.ascii	"\311\n\311\022\311\026\311\032\311\036\311\"\311\027\245T\326"
+	.ascii	"G6\021\272$\253\304\352)^\322w\304n\022\333M\272\256\203\272"
+	.ascii	"H\362\253\361\274U\277~\252_\271\323x\262GlG5\254\363tc\303n"
+	.ascii	"\221\361\255\n\021\030L\025\f,\037\200+X\267\025,K$7U\207t\005"
+	.ascii	"\035\322\n\311\r4H_j\220 \027\2108\216\327\223\327\376\310\253"
+	.ascii	"z\375\307\353\276\001\001\036\346\271[\257\213\274\326\007n\\"
+	.ascii	"\257g\257\335\221K\r\020\373us\210S\230\200U\257\207pU\257\376"
+	.ascii	"T\034o\240\300|\362]\275\356\215\334\025\253\215o\230S\336\036"
+	.ascii	"\255\221\343|\227\206\355\252\325\324\356\214\034\302\356\257"
+	.ascii	"v\375\007\265\f\361*\021Cr$\f\254C~\324\367\243\347<\333y\360"
+	.ascii	"\331\363\206\364J\270\037=\312\237t\332\337~}T*\313m\025\346"
+	.ascii	"\351\353\335\254\r&]\245\273\246}\223u\223m\223e\2235\313\002"
+	.ascii	"\3077T"
+	.string	"25\377\240\300w\3204h\276\251g~W3\277\324\226\271drg\307\\1\275Tx\354\250\216\207\017W\373.\fVR\t\236^[\033\016\263at\003xmx\301\344\271[\373\245\213]\372e\301\201\031\272\266:\366Z\024\262\036\370\016\024\350\330\330X\226\213\256_\265\001\251\021\2435E\275~\242A\201x\375?\275\262W~\235Z\231N\253<\247T\306\362\345t\312q*e\264F\311\177\363\243\237\315g\371l\ne\263>\311_S\260\321d\340\322j\330W\250\223\317ZN\236\325&\271\2042\021\373\200\252\250Qd\205\020)\"#\"\"A\244I\222\016\260\242\233\031\352\006\020\340\256\001A\302\377\030\020\201\215\364\375\253a\031\201)\265iq\024R\216\265\307\226\223\274\2514\254=\0317\242\250\351\202\b1\275@*=\304K\037x\306\242`\255\222\236nG\006\307\200\201\031\001\217\t\253\256\\B;!\224\263L0"
+	.string	"*\b#\253\024\013\214\232\363\3011&\032m\370\021\r\032B\315\372t\353<\243a0\b\205Q\213M\2258\242n\307\203\017\226\260w~['\b\0305Y)k\201\250%\362y+B\201 \224Zk$\221\20526L\370D$\273p\236"
+	.string	"\323\253_\023U\204t\025\216"
+	.string	"\324\332&\t\245C\300\372\fd}wZ\245\031u\254\246E4\326\226WN\352\242\031\303\016\360m\362Mh\366\005\363\240\"\206\306"
+	.ascii	"\332\200\306\005\3718\302I\234\315\231\031}\bj*\225A\212;\020"
+	.ascii	"\b\257\376\213\020h"
+	.text
+	.section	.gnu.lto_.decls.b84a98da57d3b9ef,"e",@progbits
+	.string	"(\265/\375\240\306\201\001"
+	.string	"=\272\005\236\207\bb\036R\020(\005\265i\f\223\310\"?\257\326\355\261\211JlUSE\323\2644\326\2457C:\300m\223\231&9\373\355\334H\273\326;\360\245B\372\267["
+	.string	"\354 \305\001\016R\234"
+	.string	""
+	.ascii	"\002\004IM0\301<\203S$!\036&e\212\232\220\335\326\344\356\226"
+	.ascii	"D\356\024\037\032<\036\332\037\211\033\344 whIZ\375\315\270s"
+	.ascii	"\022\013m\0030\270\377\243\217\037\177\374\231*We(\246\036\030"
+	.ascii	"X_\326\031M\346G\037o\203dHnm\207\211\210fW\366zl{\036<\245|"
+	.ascii	"c\321D#k\031\231\037\257,\332\242\032\221\036l\314'k\202=l\347"
+	.ascii	"\261c+\213H\326k\310\260\256\036MY\177\357m\242\242\343\322\b"
+	.ascii	"BII$\036[\203@\234`t\035\231\232bt\035\231Zh\rFA\r\002\005\035"
+	.ascii	"U\214 \224\224<\332\2631\030\307i2SG\253\243Z\322\376\261g\024"
+	.ascii	"\003iP\353Xc\004\241\244$\213\037\242#\321\212;\031A())\264G"
+	.ascii	"\243L*\257`\0029c \253\027G\246'\251#\216\243\213#\324\bBI\311"
+	.ascii	"\025{QG\240#\216c\227\325\r \177F\203\301\303\305\361\353Xv\f"
+	.ascii	";\252\035\317\216h\307\264#\330Q\307\321\354\270\343\230\343"
+	.ascii	"8v$;z\035\305\330\353\021\307\321\306\217\\\307\033eG\034\307"
+	.ascii	"\253c\026\253\347\026\373,Y\340\245&#*1\216\323\230k5\214\322"
+	.ascii	"\002\240\277\311v\033\263\320\366z\354\263\375\346\332\377\261"
+	.ascii	"\006\r7\265&\201i1\016?\270\033\354\365\270u\234\361?>\333\323"
+	.ascii	"2\222\365\267\324\376n\302:\312hJ12\354\313\372{\005\326\026"
+	.ascii	":V\305\360\327\022\022W\326w\023\217T\356\340\276\353\267\357"
+	.ascii	"\032\331w\205\354\273l\373?B\035_t\335Xs\222\265^\023f$\333\243"
+	.ascii	"\312\372.\331\276\313\265\357R\355\273L\373n\212\355\001\373"
+	.ascii	"l\257\307B\223\216JH:h\310\020\255'IG\244%f\3615\353\377x\364"
+	.ascii	"#R\323\306\233\222\253\254\217F\371\252\361\r\257no\277\245\333"
+	.ascii	"Oc\237\355q\310\t\313\307I\326o\317\366\331\3531\205\220\262"
+	.ascii	"\nW^b\326\377\177\024\372r\311\022`\234\365[\257\375\270\343"
+	.ascii	"\317\321\247\b\213(\203Y\037{\322\\\037\277\276\"Y\277\275\332"
+	.ascii	"\031\315/\377\2355A\003\024d\327X7VO\313\001`I\002\363\r\r?C"
+	.ascii	"*\224\005\346>\305\f%Ka\365\236\2341\320[\342\240\"\273\344\217"
+	.ascii	"\3121\316\215\271J\236\222\0273#{\315\212\271\311\263\223\374"
+	.ascii	"\3440@\024\263`\276b\365\264\034P\0068\3304$ksrj\277\263'\210"
+	.ascii	"9\221\275f)\207I\213\245\344\301|\310\352=\245\305K\257\220\301"
+	.ascii	"\302\270\230\r\226\205L\376\240Z\375\347CCf\220\264\254(Y\347"
+	.ascii	"(\356\223\323\221\240\254\337\002\355?\023\262\327\\\270\017"
+	.ascii	"\303\344\026\263\376\341Kd\313*/\353\267=\373\310\305\235\323"
+	.ascii	"Xh\253\001\373l\217|\262\217\004\334G*\331G\342\335`3b\230\227"
+	.ascii	"\365\221w\333\002\276\f6\320\020 eL`\226\202T\220\344\355-Y\224"
+	.ascii	"[A#k%Mk\204MY\037\351#I\316c\257Y/\343\245!a\345\366\216t\351"
+	.ascii	"\345#q\017!\bdS\202g\211q\234\006\263\301\006H\036a,\032[}d\326"
+	.ascii	">\362i\037y\264\377l\244\210v\313\221#\253\310\357\226jUY>\262"
+	.ascii	"&\222\227\360\2650\313\372H\237\375\017x\344\037\032~\206T\210"
+	.ascii	"#K\373\363\\~\313q\314c\034\373\240u}\240\306\312\261zO\n\030"
+	.ascii	"3+\233\313kw\242\341gH\005\260\262?\327e\271L\227\207d;\366\232"
+	.ascii	"\3472\220\347 Y\310aB\3703\332\\Nc\345\230=i1\222\233\245\347"
+	.ascii	"\267\224\030\307i\033l\260\301\0060\033,\017\311\232\300\301"
+	.ascii	"\372\317p\317qr0\274$\217\274!\271\312\3722\317p\3176\351)-v"
+	.ascii	"\213\343\270\251\314\032\362B0\353k\274\315\246\261\320\026\206"
+	.ascii	"}\266\327q\331G\362\013-\250*\353\353\036nmn~KB\256\317m\177"
+	.ascii	"\002\307\032t\236\332\024\260\254s\217=C\254\211(\353\314v'*"
+	.ascii	"z\210Vd"
+	.string	"\375\303\327\375O\352\026rdH\262\276>\333\327c\373\332k_sm\347Y\231Kfg\345\226u.\313\231,\233=\227\345\261w\b\3410P.\323q\354\303\262\0270Y\366\002d\235\r\037\036\255\276\326\332g\257Y\f\n\0050(\301\260\025\333\307\023\275\025;\3004\226\327\033Y\326\205Z?J:\362U\353\024\264\b\344+G\213CI\"\213\254sW\366b\2570\031G\223]\362s\024\225\3655\325\036A\314\302\264oda\332?\337`\345\362\036\222\242\037.#$\"\221\301\254\254\377l\243\306\213\3457\344G\3264\334\200z\202\370\020\312\372\272i\237-\3133r\223\373\303\317m0\313\310YY+oe,\366\232gd\030y*S\345\252!\0373\330 \271\305\221\255\253\205\024>\006\325\3305\326\355\310\326\265\205\374\200\260gyF\266\312WG\266\256\235\242-\310\214\354\224\245\216l]I\242,\264\3018N\333"
+	.ascii	"f\203\r6\330\340XE\310\2225X\003f\032U|\360\310\372\032i\263"
+	.ascii	"C,\264]a\237\355\237c\374I%\022).\272\262\276\036\332?V\331\177"
+	.ascii	"\226\312QdL2j\304\315\244\334\242\216\026Yg\027\371\3053T~\212"
+	.ascii	"3\024\bSq\354\223\241\232T\342\330\247\311\262\027\260\354\005"
+	.ascii	"z\314\352\306\217V\377\230\270\177\214\262\177|\2623S\032P\034"
+	.ascii	"\3071\3156\033@UY\377\210d\353\261}\307\264.\027.E\030[\310R"
+	.string	"9\246\305m ~\\\203q\034g\025y\305Q-i\267\265\221\r\306qZ\225<\224\302\306`\034\307\331\210\025\302\312\035\323\272\334\266\254\261\3018N\313F,\035\233\344\230\326\325B\226\330`\034\307\377\263RF\312G\231E.\312K9\211\275f\243\003\031\261~,\3411-n\303\371\335\030\214\343x\203\230\rX5\246\243A\247\326 \023%\201\322\232\311\276(RnY\377H\267\177\024\222Sh\230M\311\206\217\254\177\004\333\377s\020{\315B,\243\316Blc\006:\252%m\270\266\242\346\016\2742'\255\363O\032;V\3104\230\365\217V;\307\271\207\275f\237\353\265\251\230-\216\323\226G\237&$pY\237\325\240m6666\262\032\264?>\355\037{\366\263\342^l6\231\tU\311\372\371o\377\203?\026Q\261+\216\201\316\246%\262MX\304cZ\334&\342[\034\214c\240)\254\"{e\023Y)\033l"
+	.ascii	"\2434\243\333\261\242\325\317v\233\215\302\032\262\327\030\366"
+	.ascii	"0n2\025\367\220\244d\375\374\266E\020\307lL\31366\2621\355s\333"
+	.ascii	"\240\217\034v0\262~\266\261\377\263N\330'\354\225\205\302\n\236"
+	.ascii	"\375\301\002yN\213c\2668\216\377\301\037\033\310\364q\306@A\215"
+	.ascii	"]q\314\306Ba\233\260\201\307\264\270\275\"\305\320`\034\263\301"
+	.ascii	"l\260\301\022\312\317\331T\253\237g\354g\244\r\230\366\306\301"
+	.ascii	"\360\301\224\365\263\320~\366\331g\243l>\030\2558u\247\230\365"
+	.ascii	"Y\274\275\307.yb\302^\331=V\311;\204P\026\307\361\0060n\222\325"
+	.ascii	"\224:\255\317\326\355\263g\373l\330\316\203i\263\366\244\224"
+	.ascii	"e}vj?\204:\251\017\210\260v\314\036g\374\343\027\325\025\307"
+	.ascii	"l\377Y#,\022\026\217\275\262G\330\273\263s\354\220\263iq\f\024"
+	.ascii	"\307\361\331\264\016!\260G\330\"\254\3351\255+\376\341"
+	.string	"\313\221\301\332\265-Jb\034\263m\260\001\314\006\311%]O|l\375\352~\006\366%\260\323`$$\032SY\377\001\373\016\3300,\264=\262\317\226}c\341\330+\005l\334;\204\360c\317Z\\\026\307i\315%\243\030\343b\326\037a\237\245\240e\033Y\n\332\313\354o\260-`\241\255f\237\355\335Xh\313\362`\331\330k\006l\333Y46\355H\237\2648-\216\323\232\233oP*/\353c\260\317\3668sI\034\302\333}6\203\366\330\330\310f\320>\357\377\261\320\326\311B\333\314>\333'\262\320\366g\315~\226\214-\243\3408T4\025\273\305q\332J3\255\311\350*\353\247\261\320v\263\317V\231\177\345\361\207\003\367\005I*\177\262\312\017\003>\203\307a\020\201\267\375\337\232\021\354Vl\374.\362\177k\266\006\023\350"
+	.string	"\377\201`\312\226y\322f\325d%\1776\222\3652\223\214\344\317P^\366\177\363\017\373\345\273w.\377\351j\337\377\222\305\231\360\257P\235\370]\036B\215\001\035(\027\330L\034\350\360%\025\240C\274]\372\205}\264R\001\254\367#\313`\017\356\264H\233\365\326\270\037t\340\334"
+	.string	"r\310\245\021\242\002Y4\003P"
+	.string	",_\273\344g7\300I~V\220\rdG\300y\377k\030\365\004\374M\004\270*\220El\235"
+	.string	"X\022\346\234\2322\177\322)\371\364\303w?r\310\345\200\332\317\222\340\302\254\217k\001f\016\r+\270p=\030M \302\325@\302\337j\275*\274\037~\230\210\335\337\316\360\256\360\277 ~\270\356\r\361\267?m\374\267=?L\367\277\"~x\310K\201\037\216^\004\313\343\035\374+U\366"
+	.ascii	"\376\267fc\340\374\360\2731\340\271\n\332\254\267"
+	.string	"F\004\254\206}\201\323\203\353\323A#,\347B\223\034\362\1776\003y_\204;\365\037\204\277YBF\356\016\371xte\374p\\\bg\326\357b\3750\334\017\277\375.\024\354\343\207\335\376\335\201\313C\263\203\300=~\230\355\337n\033\214\271C|m\256\255\265e\354*W\007\351\201\035o\r\210\300h?|\366\303c?,\346\272m$\333\004\374\365\3039\376\355\201\315\227\331?#\377|\374s\376\263{\023\177\023\304\217\026\377F\203\271\334V\224~\327\002\"p\247\307\f\\\235c\207}\375\221R\230\266\024\266\361o\r}-\004^/\270\306\357\352!\211\300\315\315\202\334{\021-@\201\3775s\031\377\026\205\026\003?\214\001\230\306\357\222i \267P\340\366@\312\301\001p\003a\310\323|\263\025\307\366\3034\310\272v\304\377^]Bx\353\337k\310 \227\305\337\326\3003`\255\177\233x\273\266\027\020\234\365#\013\340\212"
+	.string	"\205e\234\205\f^`\254\327\020\246\372a\003\300VdQ\332J\217FA\247\240\302\257?\374\372\330\200\377qz\001?+"
+	.string	"\375\200_\277[\006\206\241M\370u\004\266~x\001\331\355\177\235\362\006,\365kV'\377\243> ;B\212\225\346\277E\200\243Jp\376@\375H\305\027?\322\360\230\217\232\204\003\350\270\313_\311\374a\027G\030\2164\377q\304\177\254\371\221A\360\223r\005v\202\233\216,\374\307\013\374G\013\374G\n\374\307\n\034!\360\037C\374G\027\216\"~\270\305\257\224\340\207\231\376\343\207\377(\302\177\\\341W\006\340\207Y\300K\260\322\337*\217\035\374\257;\0012\320"
+	.string	"'\375\355\316%\360;\223\374\310\030\376\255\370>\377\267\345\207\221\376\327\005>z%x5\274"
+	.string	"\370\337\n~\330\350\207\213\336\013\216&\374/\006\357"
+	.string	"~x\305\377r\370\221\036\370_\017~\230\350\177?\370a\025\377\013\302\017\017\265\032^\021~8\005\362\002?\222\304\217\204\341\337R\376\235\370\303B\333p\307\277\013\217y\017\376p\320\377\"@\307\370w\023\030\b\376\3318\033\360\270\001\022\361\215\371_\022~\330\347\177\027\360\277\f\370\341\236\021\376\327\204\037\216\267\036<\202\377=\341\177Q\370a\021\374\333\217\005d\022\354A\211\f\202C\360\267&\370\376\027\375+@\366\036r\211\325\300\343g\253\274] \200?\274\310\217$9$\371\\\021\360\007~\326\311\026`\033\201gh\273`\024\377\013\303'\\\021^\232\033\r\"\336\025u\200\006@\362\177\351_!#"
+	.string	"+\200\225\035\3773\3608\032\327\002\025\200e\3707\n\330\004[\345\355\332.\300<I\020J0\227m\r\377\244\t\317\340\005\266\376\254\001\224\3767\340_\021@\216\217\005\234^\377\256\373\267\335\017\357,"
+	.string	"\354\177k\206\374\267\340_\311\372w\001\376\275\301\017\353\270\037\320\300)\001\027\004\255\034\274\200\017\374,\tRZ\273\344\005-\035K\302\022ko\020\301\335\252\321\2013\003,\t\255\226\004\340\234\037I\343\203\022HG\024\374\333\b\306\371\221EL\005\370\335\030~\367\346\207opL\207\374\256\007~\227\372\3031\374m\313\233\323\n\302\035x\347`\017:\314$\277\262\f\236\376\312\264_\251\366\3036m\326[\243\364\001\227\370\225\327_\331\366\303$\224a\377E\354\027N\3775\370W8\354+\245\220_\371\366\303\322\3375\241}w\f\270\346\235\333U+(\374\217\333\035tM[\004\323(\265\376{\360\257H"
+	.string	"\036\361\267\t\270\206\251\225\022\376\244\364O\222\370\341(\313\203\311\244\340w\343\344\024\022\330\005\270V?{"
+	.string	"C\366\020\206\037\371W\201\263\001\277+\375]\022?<#\202\206\331\366\273\033\2009\360\273q\223ug\340\r$_T\371\223Q?\254\001\226\207\313\001\246\331\337^\301\031H\342\240\220\300\345gG\350\240\305ZF@\231\367\267'\300\030\200/\220\344\220\274\371\225L~\330\002g\251"
+	.string	"\253\344\332@\246{\300\337\252\360\303/d\260\037\226\300\237\205\\D\036\222\337\032\233\215\256\f\260\013\177+\007\3630\005\377\215\243DT\036\376\312\304\037na+W\223(\364\316\337\036\301,dj\006`\377\025\360\257\340\034\263{\370\303 ~\267\250J\025\261\002\031T\370_\202\277\311\267k\254\\@\231\200_I\302\017\257\320\372\375G\021\300\0210\241\004\341W\206\360\303\020\370[9x\001\217\203?\374\310A\345\003~\030\005\370\204\037\331\204\204gp\342\310\363\037C`\302\311\237T\300\002~\270\204g\320\376-\345p\b\262\023\370}M\375pH\377\355\005;\340wEP\006\376J*?\334"
+	.string	"\267\003\230\001\177\313\242\034l\345~e\341\017/\340g'\270\b\005\004\371\317\301\277\342\202\235@\331\007'\200\035a\217\375o\376+<0\002~x\0046\356\207\017\240a\bS\226 \303\264<\037\367\346h\337\274aw\220\201E\330 \207@v\2442\341\020`\020\376\362\316\301\037\374\360\006\230\002\330"
+	.string	"?\254\301\177\314\361\300\177\352\357\334{\235\313\237\237\177\216\3713\314\237_\216\324\334\362\303,/G\017\374\231\002"
+	.string	"\224\375\307\340o\242\310\004\310\034\024"
+	.string	"\001?\033\202\333#\00498"
+	.string	"\360\005\260\005?+\001L\001\374\362\347\016\227\371\233J?\374\314\033\374\310\240\002\374Y\203?s\220\t\360\347\001\3740\313\237;\330p\001\374M\243\247d\021x\345O\362\365\375\260\363w\365X#D\340&\314\\\376p\322\211\003\221\237\255\333"
+	.string	"\007\2244y\374\256\tJ9\030\251\274\373\225E~X\037\363\266\376\3601O\221\203n\240\346@\tp\206\331c"
+	.ascii	">\225-\343\277\n\377\n\210\304\037\211\227\fL\n\376\257\024\022"
+	.ascii	"\177\226\376\271\304\237\247\354\bg\241\025\312:7\202M"
+	.ascii	"\"n\024\013\373d\357}\017\r]\250\346\001\330@V\220\355\373Y>"
+	.ascii	"\326\357g\001\363\341\t\200\370\374\037"
+	.string	"\200\337\231\301\257\004\241d\341\177\007%\360+E\374/\224\377\250\344\177\235\022\003\357\223_\t\303\337J\360+\243\377\353\344W\326\274M~e\f\277\362\346\177\005\377#\332\377\006\376G\037\377\013\370\267D\357\2372G\351\001%\365\177\375\224V\345\fJ\031~\345\007\376\267\357\325\300\313\247\354y\231\374\357\336\337\026\200M\373\225B\2772\305\377.\371\331\256\237\225\361\277JX\261\277\035\300\337\022\340W\212\340\177\365\376V\346\177\223\374H\3067O\231\364\"\371\217PJ\247_\371\364\277x\377q\351\210\022\3525\322\276I\024\311\031\376\267\310\237\374y\357\376V\312K\344\230\244\244RV\375\257\235\262\203\377\270\243\334\360\277u?\233\343\177\234\273r$\372\217E\377q\305\361\350?\032\335\260H?{\365\277s\3771\220G@\346W\356\250\364\263$\200\340\177\327\357\234\362'A\274qm\342\2220\351\202\210?9\201\377\205\313\200"
+	.ascii	"\332\013`\017\357\225+\302K\223?\240\220L\373\223j\377\373\366"
+	.ascii	"\347\007\b\371\217;\257\217\\\302\237\034\362'\351\376\327-)"
+	.ascii	"\343m\373]9$\335{}{\344\021\222f\3773x\331\376\f\342Us\211\374"
+	.ascii	"\367\3607o<\340\317(\3749\205?\177\240\373\335\272\377M\373\263"
+	.ascii	"\n\377\353\222b\177r\354\177\321\376\f\201\277\005\312\"\376"
+	.ascii	"\367\354\317\026\320\220"
+	.string	"G\370Y\022.0\367\177\203\277\211\265\343\366\326\325\t\374\255\005\376\327\354-{\311\016\375Wb\274;~d\222\314\344g7\220\365\376\027\354\317J\362\223\377uy\311\237$\374\223\205\377\253\343\317|I\304?)\345\177\277\362]\256\313QX\r\310\242\027\340w>\177\327\2047GVD\300\366\371\367O\320\377\342\370\223\034&8\366\375-\004\376\026\304\377z\375G?\266\312\377v\375\312,\245\326\377\336\370\333\251\227\353\177\006\336\030\257\215\377\315\372\217\202\254\004\307\023;\376_\302\277\302\272*\336\253\026\204\277=\300\377Z\375Y\361\317S\376\327%u\374I\260\377\255\"\341\030`\225\231qS\360\377\202\337I\302\317N\300j`IXz\370Y\016\374\354\006\376\307%\017\360'G\370_\252\277-\362N\375\177c\214`5,\333\222\034\376\244\007\377\353\342g%`5\350\370]\024~7\205\377}r\372\221a\027\341zHq"
+	.string	"\235\337\355\340=\201"
+	.string	"f\325\007)\002\373\201"
+	.string	"\342X\346\0132h\002L\032\377\333\364#\341\360~v\371\277-v\207c\374)/\323\217\354j\362\262\370\221:^*\0062 a\206\377(\374\316C\267\205wI\002\377\337\337i\265c\370_\245\177s\340M\3326/\3223(\022"
+	.string	"\t\247\220\375\200\367\210\305\300\365z\215\3766\352-\352y\006g\021\361\256\370\221E{\206\303\357D\373Y\020D@\004I\026\177\222\351\177\211~\226"
+	.string	",\0077\354\206W\305\317\372\270\360?\346gR\375-\341\033\364\273\020x\201~v"
+	.string	"\377\001Y\003\260\002`:\231`X\310\367'\033\360\376\264P^\036W\344w\225\027\370\337\032\0130\275\334\327\347o\031\337\236\337=\222p\370g\036Y\021\27003\346\177\343?\031\375\337\031~V\004?\013\002\366\304\177\300\r\004h\033\033\335\032\031\340\370Y\rM)\313|\006\"\224\255T\005\377\222\204\337\355\340\177Q\374H*\357\211\237\305\200\235\200en\367?\216\340\337\020xe\370Y\335\374_\023m\323\313\303:\177d\220\365GV\371\336\317\262\374oU)\200-\363R\377\307I\300\262\37738\314\tp\f\374\177a!\2015\200\n\377[\370\235J\377\023\377OaW\376\327\003\377\233\374w\302\276\377\273\363\263\031\024\340\177\335a\376\213\270\006\003\334\345_r\330\360\237\345gn\300%\300\253\303Z\300%\341\377\363g\312\300.`\002\267"
+	.string	"$|\202\237\331\002\316\177\347\357<\262;\374_\376Ni\333\362\346\020\275\374M\350E\2649\226%\222*\376$\321\377\342\374\355\333{\363'\221\3767\206?\231\364\277\035x\247\"\334\242\226\277\031\363\267ho\211?\251!\t\375\223\024\374/\tV\303\231\3772\306\237d\376\311\346\377J\377k`%@\276xCpE\250q\201\277\315zk~W\204\255\346\004~W\204\227\346w\201\232\311\337\235\340\035\341\212\340\377\376\231U\376\266\354\215\262\027h\323\226=\277;\301\357R\360\277#,\360\366g\"\340o\313\336\350\317Z\340\310\177\371\201_\243\030\362k\031\236\374W\332~-\366's\253\374_\030\376\273\377\n\340\277\241(\377\025%\377\006\372\367\317\177\374\373\312\373\273\206\377;\363\263>\206p\340o\027\260\201\037\271\246\201\037\t\b\200\277)\370\357\352\177d\337\f\374H\252\0231\374:\304\213\201\367\002y\347\265"
+	.ascii	"\362\352\255\300\217\364\272\300%\370\235\200\377K\201\377\025"
+	.ascii	"\361\277 \376\367\303\377\242\360\277&\374\257\003\376\227\001"
+	.ascii	"\377K\302\377\"\340\177E\370_\020\376\327\203\377\315\340\177"
+	.ascii	"\007\360\277\027\374o\005\377\253\341\177%\370\337\227\377m\371"
+	.ascii	"\337\345\377\266\377\253\3777\377J\306_I\345W*\376\312\304_\211"
+	.ascii	"\370+\013\177\345\340\257\024\374\225~\277\222\311\257L\362+"
+	.ascii	"\213\374\312\271_\371\366+\177\374\312\266_\311\343W\252\375"
+	.ascii	"J\263_\t\366+\277~%\216_\331\365+\267~\245\326\257\254\372\225"
+	.ascii	"Q\277\362\351W*\375\312\024\277\322\347W~\340WZ\177%\365W\346"
+	.ascii	"\374\312\233_)\375\225\321_\231\201_)\342W\276\360+Y\370\225"
+	.ascii	"\017\370\225$\374\312\003\374\312\020~e\207_\271\341W\n\340W"
+	.ascii	"J\360+Y~%\363W\272\277\022\371+\217\177\262\312\237\234\362'"
+	.ascii	"\245\374\311\302?)\370'\373\376\244\221?I\367'\205\374I\265?"
+	.ascii	"9\366'\301\376\344\214?\231\365'\243\376\344\213?\371\364'\231"
+	.ascii	"\376"
+	.string	"d\322\237$\372\223@\177r\206?\211\363'I\374\311\350\237\234\300\237t\341O\262\360'M\370\223\016\370\223\013\370\223#\374I\017\376\344\005\177\262\202?I\301\237\\\371\223\315?\251\374\223\373O\266\177R\377\311\374o\306\177c\360o\305\177'\376\333\360\337\205\377\036\374\267\223\177\003\376\333\357\337|\377\336\373\267\222\177#\371\367\221\177\017\371\267\335\2775\370\335\017\374\033\356\337q\277\313\363\357 \377\376\361o\267\177_\377\315\366\357\265\177\247\375{\354\337a\377\006\373\367\327\277q\374\233\353\3375\376\275\365o\255\177\313\370\367\325\277\253\376=\365\357\027\377v\3727\323\277[\374[\351wu\376}\364o\244\337\235\376;\305\277\203\376\035\377[\004\377\006\301\277g\370\267\211\177[\377\355\201\177\353\374\033\347\3371\374{\372o\022\377\236\371\267\005\376\035\342\337\022\370w\004\376\255\302\277K\370w\003\376\275\200\177\223\360o\004\374\373"
+	.ascii	"\377\356\360\357\016\376\275\341\337\033\374.\315\277\007\360"
+	.ascii	"\357\013\376]\301\277)\370]\250\177?\377\235\374\335\306\337"
+	.ascii	"=\374\335\302\337\025\374]\247\337U\362\273D~\267\356w\347~\327"
+	.ascii	"\355w\257\277[\366\2738~\267\306\357n\375\256\326\357\312\370"
+	.ascii	"]\253\337\235\372\335\250\337}\372]\246\337-\372]\242\337\005"
+	.ascii	"\372]\237\337\215\177\227\003\277+\202\337\005\301\357\236\370"
+	.ascii	"]\352\357\336\374.\211\337\205\341w-\360\273\027\370\335\t\374"
+	.ascii	"\256\013\277\033\201\337]\341w=\374n\n\277K\302\357\"\340w\017"
+	.ascii	"\360\273\037\374\356\206\337-\300\357f\360\273\032"
+	.string	"~\227\202\337u\371\335\225\337e\376.\374\273\312\337\335\277{\374]\366o\033\3776\361o\r\377\266\360o\241\374m\223\277\375\373\333\275\2775\362\267v\177K\367\267s\177\013\367\267i\177k\366\267`\177\233\343o\275\376\266\306\337n\375\255\326\337b\375-\325\337J\375\255\323\257e\370\333\243\277-\372\317\302\2573\360\353\b\374\355\t\377\221\311\337\022\375\307\251\377\310\342g\327\376#\211\037\211\370\347*\177>\374s\341\337\016\375m\212?\373\375Y\310\337\n\3759\206?o\340o\201\376l\201?w\360g\n~v\356g{~6\372\263-?\313\301\337\376\374m\317\337\316\360\267&\376\266\372\267;\177\213\363\2676?\262"
+	.ascii	"\177+\375\333\021\177\013\303\337r\340o5\360\267\030\370[\013"
+	.ascii	"\374\232\372\267\024\370[\t\374m\013\177\013\342?\366\375m\004"
+	.ascii	"\376V\205\277E\341oM\370\365\006\376v\001\177\233\200_\307\360"
+	.ascii	"\267\007\370\333\017~\266\352g\225\376\343\323\337\312\374m\007"
+	.ascii	"\177[\200\277%\300\337^\360\267\032\376V\202\277}\371[\226\377"
+	.ascii	"\350\201\277m\376\355\373\267\312\277E\376\355\361G2\376\372"
+	.ascii	"\002?\262\312\217\244\362#\025\177\344\224\037)\345G\032\376"
+	.ascii	"\310\301\037\331\344G\002\376\310\277?\017\371\221L~\326\311"
+	.ascii	"\217L\362#\255\376\254\363#\361~\344\335\317\026\371\221u?r\356"
+	.ascii	"\317 \374H\270\037)\344G\372\370\221m\377\221\202\037\331\343"
+	.ascii	"G\256\375\254\217_\277\360#\325~\344\316\217D\373\221e?\222\354"
+	.ascii	"G\206\375H\035?\322\353Gv\375H\032?R\306\177\374\177<\361#\257"
+	.ascii	"~$\325\217\234\372\221/~$\213\3779"
+	.string	"?r\351g\217?\333\341gC\370Y\345\217<\372Y\022\376g\360#\213~\344\320\217\f\372\221@\377\t\360\263\002\370/\342\177\006\376\337\374\254\005\376\307\375\354\004\377\017\377k\370Y\t~\344\317\177\300\377u?\322\347Gz\340G\336\374\310\022\377Q\377z\354\327a\277\326\361\353\034\277\236\341\327'~]\375\265\007~}\363\353\351\2579\360k\r\374\032\003\277\246\300\257C\374\232\205_\203\370\365\n\377\021\312\177|\362\037\001\377\243\337\177\344\373\217p\377\321\352?V\375G\252\377\310\364\263<\376\343\322\177\214\377\243\b\376#\212\377h\342?R\377\343\316\177\324\371\2178\377\261\304\177\304\300\177\374\340?\272\374\307\346\177d\376\307\345\177\314\377\221\3753\343\237\021\377l\370\347(\177\376\373\263\335\237\351\376\034\367\347\267?\243\370s\365\317;\177\276\371\017\342\317\034\370\263\006\376\234\201?_\340\317\b\370s\b\231\303\2377\374\031"
+	.string	"\177\236\340\317\311?\357\237E\374\331\303\237\205\362\263O~\326\310\317\016\371\331\266\237e\373\331\022?\353\363\2635?K\363\263#~\366\002?\273\200\237\035\341g5\374\354\001~V\204\237\005\341g?\370\331\r\377C\374l\007?k\200\377e\177\376\340\377\221\377G\215\215\215\215?\210\251_\204\001\374U\b\003sY\303_1\326\326\236\262\316T2\207s0\225\304z\374\350:\214\343\207c\330\313C\016)\027Y\347?\026\332\3027d\016w\271OTCjY\033\200\306a\256\037\256\001\333\340Q;k\314:k\261\320v"
+	.string	"\354\263\335H2\207i\f\021\r\325\310\032\336\372a%x\206r\212\016\272\035Yg'2\207\265\300\340\230\354\200\255\254`\031\354Z\214\0043\244G\206\006\360\235\\\232\220\254a\031\356\340\020\037eY\303W.\221\013\227g\244\311\212\377\3116\017\211\212b\326?@\322\206a\3000`\252;\3438~\311z\316\226\022\341\251\303TY*^\001\2245\034\0039c\251'\312\025Z\216'\031Y\377"
+	.string	"ApT\rV\033\035\025\370\205\022o\310\213+\353\213\320\004v\001?\301NE\006\217\b\263\206\233|\004\275\021\311\372\" \331?\314\304^\341\026H\262\2714\247\254\177\310\312\375O\"\255\020\233\300e\r\263\270\321\f\247!Y\303J2\207\227\220DS>\332\262."
+	.string	"l\304^a#\030\t\0041\257%x\312\031olD`\244?\311\003>j\013\265\330\214\300e\355\306,\264\275\bhY,'\351\225qie\375\303C\207W\374\260\n\230\250\360h\211,k\235\306B\333\273\245\2209<t\034\343\301\230$\353\267\261\317\026\026\372[C8\310\211\237\021\244\254\331D\270\3470\320\017\373\300?QZUbd\235\007Yh\273A\346pO\216\300\025lYw\300>\333\267\361-\226 &f\3752B\301\020\307ij6\352\336*\177\013\370R\311P6\214\266~d\315\306\261\3206J\212\022\244\245)g\257\357\224W\n\314T\274\244"
+	.string	"\257\236\255/\227nH\242S\326\027\201\306\376\337\304W\212X\321\021\270\254_\304g\252\\uV/\031\311\273\312\372\"D\355\377-\374{\370\277Q^C\267\217\n\330\213\254\363\035\013m9`\237m\322I\346oa\225P\220\035Y\277O^(\354\365G\336\301\2475\231s)|\034\311\372\"\264\330g\177\244\035\001\373#\355\3776\371\353\344?\0069\n\311P0\300\221\225\261\310\372\025\224\371\333$00\312^\326\027\\\377\006f(\030^N"
+	.string	"\3754\372\375\005\374\225Z\357\337\034\233Z\212\254sX\237\314_?\344\031\030\232S\326\004P\302^_%/\023\r\246b\026\032\210y\355\210B\372\373Z\261\344\335;>a\247\004\365\246\262\262f\321c\241m\256\301>\333\207\220\270\3777O\t\370&\311P0\370lme\315\272\261\3206\007\221\371\233\007\017YZ#r\344\005\362\3421\215`\0219\312\232\2352\"\363\367\310\013\344H\225\033Y?\211\260\327\227\310{\247\301\224O\016\005\240Qq\201\035\231\302\266\260\262~\357~4\302N\2758"
+	.ascii	"\310\325\215\254\037\202\335\376_\272\263\327\227\356\255S\200"
+	.ascii	"\234Z\224\263\226\307Q\340a\020@\260\266\254\037\302\332\376"
+	.ascii	"_9\366\372\312\275s*L\305K \240)-\301K\214\343'\016\220Oup{Y"
+	.ascii	"\277s:\362\024\036\337\022^\326\017ak\277qP0\004\321\203\242"
+	.ascii	"\224\365{C\346/\334\024"
+	.string	"\330\016\253 \177\337\3767\307+\344\332\303\207I\326\254\026\013m_ 2\177\2030\332\035\315\310\272\205}\266\357\217\253X\222\310\224\365{&\363\327\307\026\225\031\2156\366\372\266\035\017UH\213{f\b\317\226\302\342\244$\016\036\302\324\376_\266\277\327\277Uz{\364x\021)\313:?\261\320\366\030D\346/\233\333\203\020I\374\362`V\261\261\"I\326\357\032T\024\216+\254\2545\024\231\277j.\216P\321x\323\376\367\354E\313P0P\305\245\t\311\232\275c\241\355\004\354\263}\315\216T\374\372\254\306^\262\2660v\212\312\372!\f\215\355\370+\366+\237\274a/\376\216\250\262f\377Xh\353\266\311\374\335\201\004kra\343\353\265\361\352\310P0\250%\241\"\2265\333\305B\3337\207\314\337\257\246\024W\317S\326\320C\344\034{v\244\310\336b\326\257\327\377\336x\273\220[LoR\262f_l\310\374\345Zj\325"
+	.ascii	"\203\313\332e\306\337\032\377\273\365\322\310P0\250\245\001\t"
+	.ascii	"e}\fc\241\355\001\330g\373j\311\374\235\241\301\302\204\304\310"
+	.ascii	"Z\204W\306\337\254\177\307\261j34V\221\222\265\276\222\371+#"
+	.ascii	"\317n\020\r\353\357\325!\023$,\262~\257\316\367V\250\225u\033"
+	.ascii	"%\363\327\312L\306\320\326[\365\206\244\207\f\252w\212I\343\013"
+	.ascii	"\361\372\306\370;\345\3660\252\302\224\365\013\343N"
+	.ascii	"\252RHa\314\372\215z\227\215\212\215lR\254\035\221\231!\334\333"
+	.ascii	"\342m\372\353\364\327\351}\261\3438\356I\213\221X9\265\263\245"
+	.ascii	"\260\370)I\203\367\305\262q\355\t\224\254\337\247;Q\nn\275 \203"
+	.ascii	"\372\237\314O\360\354\254\262~\b\361\376\317>\377m\354\223\024"
+	.ascii	"\307\361\0222-N\372\201\333\237=\213dY\r\376%{d\003\360_\237"
+	.ascii	"\004\030'\342X\352\215J\034\307\254\341\316\001\347\003eA\374"
+	.ascii	"\377\032\304q\017\033\307q\322\020[U\317\312\020\233O<\324CO"
+	.ascii	"ie\210\255Ji(-\246z\211\331\256\342\241\264\251\036="
+	.string	"\325\023\307qO\216\323b\240*\245\030h\252gg(-N\212\323\246z\2341\220\222s(\315\247g\210\255J\211\035b\233R\032b\233RZ\211\201\342\236\030\310\207j\003M)\r\341M)9\207\330|\224\206\200\252\224\330\264\251\230U2$\255\252G(f\363Y\306q\\\224\326\325\003\307\261OR\334\263$\033\305U\203F1\214\230\325\023K\273\212\343\270\307\355\317j*\231\366\023\353\r}M\331\b\305\361_l\004B\017\333\223\026\307q\212\370\247\207\215c\241\264\2448\376\231\202\341)\216\343x\212e\222\")^\306@>E?VS\260\320\317T\212\370\213\212\215\3438V\032b\263\232\222\221\273\262u\305?i=\354P\321T\334\025\377U%m\266\0366\312\222\215\306S\021\323\363\030\275tPe\375.1\375\342\234`e}\020\366^\245\027)\277Go\322_\244\247\305eq\234\366\"U@\245\311\262\0274_"
+	.ascii	"\271\303\321\352\242M\366\004\313\215\310\212\227\210\265\261"
+	.ascii	"\244\205\017\220w(\331d\346\246\227\365A({S\244\265<\3558\312"
+	.ascii	"\272\ri\303\252Q\312\2156o\013\017\311\373\243\\\314q\305s\312"
+	.ascii	"\372,\020D\027]i\211F]\207P\203Qb\fJA\032T.*\247\254\030T.*\r"
+	.ascii	"\333\261\243=\246\304F%\2257~}\224\214o\217\262\n{U.*\025\217"
+	.ascii	"\210hs\203N}\020\232\366AP\332\007a\305>\b)\366A\350\331\377"
+	.ascii	"`\312\376\007\204\373\037\004\356_YH\270ch\026\b\345J\302_\037"
+	.ascii	"*\0073\024\f\331\311\213\263\255\254\331\301'2"
+	.string	"WBa\212\365HqeM\201\322\211\262\211T\022*M\262V6\371\223eJ\301,\345C\t\206_\326\313\230\205\266J@\231+\003\341\310\222\\e\035\243\374S\362\351\350\243+\312Z\311\347\326P*\361q\322u\246\344K\252)\367\224L\224}J?\366\252\344S.I\236)\371\222h\3114V\317-\216\225:\310;:\203\221,S\362%\315\0060xt\006\003\352:\306\246\324\377@m\353\271\201R\212JY\377\203\260\235\344\221d;;\032\243\263S&Q\016Q\032Q\022Q\336)\221(\217(\343\224s\312:\245\234\022OYDI\307^\225yJ\247'\317\222kG\256\244\\2\350E\f\345U\217\"\256d]r\357jL\211CWy\313P/\224c\312<%\226\262\351h\214.1\016\354h\214.\354\310\245\314K\302aE\r\306q\2322O\t\227\004\"\246\214;\032\243K$R\346%\375\224-F\020J\202"
+	.ascii	"\326Q\236R\206\362\315\307\206r\351\310\025$)D\303O\034OI)\313"
+	.ascii	"\224y\311>"
+	.string	"\244\301<e\223\022\306\bBI\311\243\036FG e^\222I\222OCP\034\373H)\273\216\306\350\022\225Jc\206\204\026\350\177\340\263\225B\232WY>|Y\277C\341\316Rn\035\323\272R\3709\032\364\241\f\242\374\301^\225@\200\224@\2244\224h#\b%\265\360c4\bD\351v\274c\232W\034_E\2651\216r0\352\253V\221\030[\277\303\216\375#\336\216\030VO\313\0018\200\224\211\241)k(\3014\374\f\255p\027dP\354uUn]dcG\026c\032\260zn'\304\241)\315^\307\025\006D\211\246\f\213\031@\213#\034\312\036\3126e\232\222M\271\246\344\241\274*\325\330\253\022My\206\274\366H\\d\321\227)\334\227\021\334\227\331\333\2279\262/3\267/\003d_\206\307\276\214\230\016\230\334\003e\tR\326\227\321\332\377\2258\2249\330\253\362K\311eC\331u\345\244\353K\351\245\354\272\352"
+	.string	"\311Q\326\361M\320\260G\253\357\201\337\376\225]7^F3)\306\033J.\346\331\215\242\253\254\357\001\334\276\007n\373\036\250\355{0\266\177\345\214+\267\220>T\034I\221\265RK\346\312\031AZEKYg\300>\333{\220c\337\003\256}\017\254\252\224VT\333\006_\024]\326\367\340\250JI\345\026\377)\247\256\244j\003{\354\024=H\241\224\202\242\322$w#\353s(\334g\257\312(%\224\220/\025A^\\\t\365w\b!\227\301\212xyLY\377P\351\342\177\222\331w\0067D\351B\371d\264$\256R>)\235\222\210\177U\310\262>\007\300}\016K\224L\202fN\327\254\317\301n\377W*)\227\330\253\222E\262\211\222E\362/)\270"
+	.ascii	"\030,\222N\224HO\252\fn\300^\355\030\013[\255\214\225EM\272\224"
+	.ascii	"GJ#e\022{U\"]\211\224|\222Dd\366\254\304\261\f*]HI)IF\252\016"
+	.ascii	"\006\215\244|m\360\026aI\365l\375_I\244\\\301^\225EJ\025@\312"
+	.ascii	"!\253\002|\031I\371JT\026){\224?\032~\206T\240\023\034\334C\266"
+	.ascii	"\350f\264\372\034~\354_9\244L\241\002.\207_\326J!e\213'=\272"
+	.ascii	"\254\317\341L\031\304A\307>{\275\023\245\317\237\320\300k2\313"
+	.ascii	"\372\034\272\3669\314\330\347\200\265\223\214\311\304\344b^\225"
+	.ascii	"d#{"
+	.string	"M2&\251$\031s\240\021(\203\314\0339\310\314Z}\016.\266\336\001\324\206$\353\244br\312\362\211T\335W\326\347\200\264\317ah\237\003\220a\362\220\275&\021\223Q\222\210I(\311B\r?C\037`(\016&\021s`a\b\210FR\334\2539\264\255V\177C\221\375'\013\t]\f\t\241\202$\362\304\304Fr0\331$\220(~\222\3657\314\355o\360\261\277!m\177\303\327\006L\006\266U\235\205e\375\r[\200\033\252\3667\300\330\337\340\264\371\300Xw\211Nm.\353oH\332K\232,\244\332\206\262~\007\213\373\037\330%\213d\335H\222T\302^\223zI#I\275\344\221d\236\006\025q\\%\306\0344z2\267\374\221\270\330\324j\274$\222\346\n\033)h\230\341\341\330\357@\212H\362./\365\330\352@\211H\007D\373\006\220\222\034\302\356!*\252\310\372\006\370K\316\031 \311\276\001\352\366\r\340\266o"
+	.string	"\262\235\024\"\007C\034\247\305q\374\262b$)\306\327\017\366+\b\355+\353\033`j\377O\272\261\327\244\217d\217\244\217\3445\331\006\345.\031-y\221\030\3071\314\006,\324\221\237$Z\267=\231\226\343"
+	.string	"\227td}\003\374\354s"
+	.ascii	"e\237\003\275\375A\366\331\302\034\f\331\311\264\303\345\251"
+	.ascii	"$\2040\022\263>\007A6\233\206c\263qI\262\261mv\246h6\3666\310"
+	.ascii	"\312i\nN,\031\226\003\261\336\202\222;\236\f\373\265\227.b\345"
+	.ascii	"\330%\"U7\262f\177\310<\271C_!\"\341H\202%u\034\311\372\002\321"
+	.ascii	"\222:\262\024<E\326\"\205O\362+)\303\013\f\b)\353\177\260\"\203"
+	.ascii	"a)\016*\t\376\264!\001\031jd\002\224\257\216\220\236\f\022a-"
+	.ascii	"\2620J\034\314h*\030\273Z\360!\351\332Tf\260\370\363I\316HN%"
+	.ascii	"\261\222.\222WI\252d"
+	.string	"V\322+y#\031#\031\225\264Jv%i$m$s$_$k$\245\222\\\311\252$\216$TR+\t#\271\305^\2232\222MO:%\237\030a\304P\203)\262T\340%5I\366\370\275\330U\264\006\203\332\212\230\362d\216\240\be\260\024DI\031\311%\300\301dQ\276\232\322\325\227\224\261\033\231aFcya\033\034\365x\220\t\211\240s\034\013m7`\237\3559 \332\337"
+	.string	"p\177\003\"\373\033\370\330\337\300l\177\003\033\373\033D\355o\220b\277"
+	.string	"O\366\013Pd\277"
+	.string	"i\373\005\350\332/@\325~\001\222\3665\250\262\257\201\340\276\006w\373\032\244\355kPc_\203\247}\rR\354g"
+	.string	"e?\203\275\375\f\346\3663 \333\317\300\306~\006V\373\337\213[q\305\025\241\212\255\270\001\241\213\273)\211>for\207\210[J\226\202\247t\034\306(\313\332MKd\237\355\236\223\371>\334\215\215Cfl\303\035eE\225>\036Y\373\265}\211al\273p\017^\311\201\345e\275\007\367\223\274\002\001\211E\212Q\211\204\354u\017n(\032fi5\245\342\207\326'"
+	.string	"\342>\001\372\366\277\235\354&jC\210?\004\357X\037\031\n\206\255\026,\222d\315\222\311|\0136\367\340\016\271\002\001[)AB\245\355\267\377v\337\346c\257\033p3a\225\320\320\2531\030\302\222\\\206\201\016\252\305\262\304\r\270\367t(-\226%\3561\026BsJ}\002\334\355\023\340m\237"
+	.string	"c\373\004\250\332'"
+	.ascii	"\213\375\357$;/\331\347\204)\205\256\213\3226\005"
+	.string	"\t^\007Cl\310\330xpy*~\021D\306\221m$(\t/\250\310\267\2217\3360,\312z\337\311|\027y\201\230~pe\235$\262\355f\330\331\245\310\372\377w\035\fI-\350\266\262\246\001\223\254\241\270\302\207n\b\034\353\311X\"\267\347t.\202z\202\2225\223}\266;N\346[.\337p;r$\353\345\206\333>\373m\023m!;\b\313^\235\221\254\2018\001\362f\227\365\007\320\350F\351\331@\215]B{n\217q\007m\025\273\210\307\342\240\033\305mT\341F\211\261\206\266\232k\350V9\252%\275\200\265bp\227\031E\331j.\343\353\210\272\302r\3311\255\313\275ZM\031\334l\333l\367\330<v\333\276\356\037\333\307>\333i\333m\243\3555\366\272\325\266\330\367\330&\333A{\210\312\240\332>\332;\216jI-\360P\334A[m\247\250\342\022n5\267\220\225S>\025\335Xr\373qDQ\203\376"
+	.string	"\002\367\253\307B[\266\214}\266\037\200\335\376"
+	.string	"\330\366\336\361\357\240m\264\301\220o\212C\332\262\326\021\243D\023l,\313\372\003\240\261w\216\255\264]\034\325\222\222DV\033\307\376b\257;\307~\261sl\250\355\345S\3035\022\263Af$\2522\322\352.![V;\262\376"
+	.string	"\242\366\3312*;\030PqRgFd\246\212t\365a\345\031\031\264*2\030eg$\006Y\034\215=c\333\330\\[k\327\3307\266\214\275\305^w\326\276\372F\332I\327;kW\235\025\031\214\343\370}\212\033\372k\321\037\200\213\375\001\020\355\017 \305\376"
+	.string	"\200\366\007\320\263\217\001\343>\006\213\373\030$\356cp\270\217A\341>\006|\373\030\004\331O0\023\360;s\312\372\030\244\355\263@\230\016\307L\306\361\335Y\327n\261\227\024\213\366\236\022\267\323nb\257\273\305f\241\323\342\330-)F\025&\324\352cP\265\217A\323>\006I\373\030\b\355<\305B[\f\330g{\0014\356d\314B\211\366\n\244X!VT\326\027@\037\221"
+	.string	"\354\366\005\300c_"
+	.string	"\\\373\002X\332l\022\373l\367Ok\004\026\003f\375"
+	.string	"\030\356\355\023\200$\373\001h\333\017\200\215\375"
+	.ascii	"\274\330T\002\325\364\030\367\331\262\277$\203"
+	.string	"\211-\022\253\274A&n\"\333\344o\212\273\350*\272R\330\253\233\350\"&\272\207\207\323\240\"\216\357\240\334\261\242\033K.\002\255\234\224\372\027\364\330\277@m\377\202\260\315N\261\317\366\027pm\266\313\035l\312*\222\006\345\311\316\033\332B\362\344\256\223\314\244\224\345\303ur\267\311\017)uU\\\301\345\226_\022\250\254\177A\240\013\350\002\272\177\256\337Q\307Qa\340\033\204\305\266\304\355s\371|\004\303\374\262f\342dqJJ\326\277@h\237\365QG\206$\317\225s\351\200\360(\313s\211\270GF\020JJ\022\361\020\033,\313s\355\220Q\032~\342\030\206TkX\224\365\225\270\304U\342\356\271I\\=\366\352\346\271x0\311#VJ\016a}\013\366\366-\030\262\177\367\210\021\026\016\215\251\356\316-\362\026y\rQ\312\372\026\264\355\273\263G^A<\366-@\333\267`\307\234;$\213\225q\035\311\372\026\310\230\263"
+	.string	"j\377n\234\033\344\215\353#\314\323\312WLd\034O%\312P\034\f\342b-\016\272B\3347\027\210\013\347\372p\177\260W7\210{\275\333\346\272eMq\203\2705\334\036\254\236\226\306{\342\006qg@\031L\016a\372\312bjV\217\205\266\032\330g{\013\2146\033\2630\310\3245\353W@e\333"
+	.string	"\004\222\003\217k\314\275\341v1\217q|\225\244k\310\327\021\035Fp \ts\307\\\257\274\3018.sy\270jn\232K\346\232\271k.\232{\346\212\261Ww\314\335qw\313\245\001\344\216\271`.\020\026\215/\022\3438\355\001_}R\\\364+x\333\257\300l\277\202\256\375\nb\354W`\264\017"
+	.string	"\306}"
+	.string	"\f\356\003 \317\355BF\355'\240\242\246\254\017"
+	.string	"\"\373"
+	.string	"H\333\007@\327>"
+	.string	"jl6\211\205\266,\354\263="
+	.string	"Z\354\003@\305>\005U\366)(\334\247`o\377\356\3251iJ\217\250\034\256\325\021\253\312\245\232R\266\344.\353\251\027\310!\322V\326\247@n\377\310\002I\fW\312\215b\257.\f\027*\b\f\267\311uqTK\332o<\360`\270/\f@\346\025\345\254)\204w5\334\372\024\240\355S\360\345>1\021W\034\022\311\372\024\304p\235(h\332\277\333\302e:\322&$-k!*\2224\271\262Xb*\022\332\312\332]\372\217L\356\217\253\224\247\204\303+\353\244\227\253[\\\326\327\300\270\377A\320\353\216jI\373J\003\206\273\3025r\213\\$\366\352\036\271B\307+\rhhu\271G.P^\001$\306\240{\344\246p\2114\374\f\305>U\035\350P\312OmN\216(\211T\034\357\216\216\320X\213_"
+	.ascii	"\241+\342\016\035m\3000\260^\370e}\rS\3665(\331\327\220\267\257"
+	.ascii	"\241\310>\306,\264\355 s\327\207\216j\212\333\343\306-\224\354"
+	.ascii	"\240`\220U\032\275\016\033\031\341!\034\327x\361-\343\337Ri\253"
+	.ascii	"d(\266H,v\224\265\036b\241\355\325\330g{$\222y\273x\246w\bDq"
+	.ascii	"\312\016\265+\241\254\333)P0h,\030\2011\262f\321d\336&\306\331"
+	.ascii	"\tQ\221\202\210\244,\356\311\341[\304\263r\313 [gWY\267\2062"
+	.ascii	"o\017\227wY\203YW\020\245-\334p>zA\2404\201!\021f1\250kU\223"
+	.ascii	"v\260\205b\365\027ce\335By\335\022\306/\276'\255\223\326\354"
+	.ascii	"\205\022\3046\360\255\223\277\025l\233\354\260)!;\262^\336\261"
+	.ascii	"\317\266\005\224y\033\bG\371c\023\313Z\202\366\257\365Sr\002"
+	.ascii	"h#\353\276\345\022\013!)Y_C\333\376\221\205\036T\031^^\201\365"
+	.ascii	"\242]\322\"\301r\301\3272i\367Z%\354\265]\322~\320.i\363\362"
+	.ascii	"\025\323'"
+	.string	"-N\n\361\263\367\025\246\224\372\033$S\352k\200\332\327\240b_C\320\376\004\215\373\023\024\356\277=27\327\025W\227\365\221I\214QG\273Ci\004\257\237\017\310x\234\305%\206Eaky(m\f9\213Ktc\001\344\254\335\301\352\271\235P6e\260G\223\266HK\2445\322\302\265w\355[\373\243\245k\201\264rm\220\326\256\035\322\ni\343\332:\366\332\316\375G\242\326G\232\220(\355\\\333&\304\352,.\361\3104\226\313n\f9\213K,c\273\300\026\007\3438\236k\257\271L\020M\255\345\301\352\271\2350\367\004\255\335\301L\306qUbW_;\327\232\265;\230@i\261\222\013gu\026\307\226\244M)"
+	.string	"ZO\320\266?\001\331\376\004^\373\023T\355O\260\364\272v-n6\211\034\306\210\313\372\023\b\355K`\270/\201\222}\t\202\354K\240c_\202\252}\tT\354\307P\331\217\031\334\217Q\262\037\023\267[0\330\247\351MI\326\217i\333\217\371\332\177\373\345\345V\005\212X\326\377"
+	.string	"+0Fb;\243\335ji\2645\332\254\026G{\243\355j\271Z\033\255V\233\203\275\266^\255\214SMA\031R\345$\315\212\225k\322\005\245\370\302\005+G\345\251\212L\353\325^\t\016\312\264^\255T\013\003Ni\353+\261=\333\262\221(\201~\f\326~L\213\375\230\237}\230\304}\230\277}\230\271}\030\266}\030\033\273\205\361\267QG\274\f\005\303\020P\325W\326\207\221\332-\373l\017\323\264\017\363\263\377\342d\377\345\310\376[\247\266);)%I\322.\275m\372[\026-S\333\342\345!\203\360\251\211\210w$\226\365\335b\026\332&c\366\331\266J2o\227\222)\206\024\223\262\026"
+	.ascii	"\373l\225\201Z4\244\264Hm\220\362\007\222\030\255=j\215\334="
+	.ascii	"8%k\255Q["
+	.string	"\004+{\310uM\311z\005\3141H\250\007-\353\277\270\355\377\355P\253\202\275\266D\255P\220\226\250\005j\203\260l\f\266Dm\n\326N\311\307E\364\"1\331B\352mE\253\377b\266\377\262\265\3776\250\375\351\033\244\"$\353\277X\245=\r\t9k}\332\236\027TXDY\267=loZ[\203Y\263s2oc\005\320\270\032C6\"\031\303\364|\242d]%myc\020I+\353\277\250@.\"\025\331+\222\n2\0219\345\017I\345xE\310\005\326\244\302\301\327\242\325\177\001\332w\t\334?R\n\022\021\231\324\245b\206\210(K\324\016\213 \r\221Q\330\232\220\265e]\2704R\205\351)\353\2730\331\377\221P\220O\220\203\354\025I\210l\"\310\332\215u\3051\333?@\022\"\235\260v\254\336\223\002\354\312\3302$!20K)\263p ~%\352\271 \203\332\372.g\373.a\373.8\366]\266"
+	.ascii	"\377\246W^bY\373)\233\024\031\273\221\365]\222\366?\300C\346"
+	.ascii	"%\351\222arT\362\267\207\\\202T\202\344C\366\261W$\023d\022="
+	.ascii	"d\236\225 \222\t\362"
+	.string	"\016y\304*p\020\311\344\250\227\227\260zO\261\217\217\007fI\202g-\017\250=!\260\276K\212}\250\023;$\222\344\324\013\036>Y\037\312\267\017\315C\032\311T\222\370ye}\350\334.\002u\333?\222\210\035\017#c>Y#\355\220uH\272>\031gyC\216\244{\206\202!\216\203\304`\202Z\2225rN\346\310!-\343\224\025nY7\221r\3108\344\337\024\027I\3108(\030\222\266^\037\r\257\254\177$\034\362\215\253\211YR\326B\230wqI\262>\324l\367\0219A3\002\354BCJ\242\213R$v\365\375P\351\022\232\"\343\004\207LC\326@f!m \331\2207\220c\3103\244\033R\013\251\206lC\372@\362@\322@\006A\316@r!\201 \315\220?\220]\3105\244\027\022\r\371\205$C\206!\257H\035\310\034H\034H1d\031\022\f\271\205\334\301^\221=\220VG^!\261\324\032U"
+	.ascii	"\031\3129X\275'\005\204A\031TB\242\203\024\221=\2202\216\272"
+	.ascii	"\200\26082\230\373|\252\240\035\375\301`\345~t\305qZ\213\"\271"
+	.ascii	"\257\207\225c\324S\277\214\0242\nHW\323\035\262\007\222\nY\305"
+	.ascii	"<\306\361\025ZW\f\037]O\254\334\033\223\021\265_\306\205\220"
+	.string	"\256\027\310\250 \203x\177F[\302\313hIy\271/nD+\022\324U\376\334\307H\324\305\264X\3245D\305\223)7d\017\344\212&\203eH V\216y\214c\030\213]\271\017\331CS\361\302!\210#1\216\323\222}L\376\310V\320\207\036\355c\032\013mG\200\376 \253`\210_\334\034\215G\205Y\277\245\312~\213\340~K\221\375\226\267\375\026\033\033\t\245\233\220`qe\375\026\254\375\226\242\375\247\342\3763o\377)\267\377\274\356?\307\366\237_\373O\032\373\317\252\375\347\322>\213\342>\313\222}\026\270}\026\260}\226\255}\026\030\373,G\373+\211\373+M\366W\214\354\257\244\355\257P\355\257\250\330w\022\356;\351\366\235d\373N\252}'\213}\347\317\376\240\341~\223\211\342\024\2661p\251\017\361z\312\257\245\350\304,\005\267Tw\206B\262n\246\261\320\226Md\237\255>\224\271F|\253\004)\364\311\032"
+	.ascii	"\206Q\206\322V\336\2725(N\262\326\205\373m\305`\326o\332\355"
+	.ascii	"_\023\352AX\r\211\305\227~r=\370k(z\252C\321\214\254\254_\366"
+	.ascii	"\331\036\367d\256\237\264aC\213cN\232|\0019\004\313Z0-\310\334"
+	.ascii	"\220A\243\254\337\364\261\377\301\022\025]~\272O\377\351@\366"
+	.ascii	"\252\001\365\3363\232f\022D\t\321\221\005\337\341\230@\316x\305"
+	.ascii	"OQW\031\240\326;\034\253\347\026\007\251\031\300\313k\261,1\216"
+	.ascii	"c$/\362\212\224\372\315\255\315\306,\264}Sj\277\311\264\337D"
+	.ascii	"\332o\252\330\277N\242\363^\036\210hQi\032\330\340r\242\221\350"
+	.ascii	" WRBE\360\364\221\374&\026F\246\217\254\310SI/-_\034\020\022"
+	.ascii	"#\327E\314\226\226\370d}7\024\2244\225\365\231\212\373\277\246"
+	.ascii	"\323v\272\216\275j\":\356ZN\317q\021\321d\371\252\307\320 \021"
+	.ascii	"]\246\341\216jI,\3744\016\036\271\210\350!\254\034\226\212\301"
+	.ascii	"e\254bJo\3533\001w;\305B\3333a\237\355\231F\366\257\315\256\341"
+	.ascii	"\256\3372|E\262\2040k!/\023\030Nvd}f\333\376\241}\3506}\325@"
+	.ascii	"\264\033{\325A4\333\261K\257\375@\031\354\261\330udr\2468\030"
+	.ascii	"\307iA4\217'\203>\320\246t\351 \272\001=Q\316\302^(YRD\230\372"
+	.ascii	"L\247}&\320\376R\312\326j,[\333\214\305\254\277\324\333_\276"
+	.ascii	"\355/\313\366\227X[/\311\\\233\001@H\235\\\326_\272\330_\376"
+	.ascii	"\354_\217\211\325)9!\314Z\357\320a\354U\213\305\313\027+\316"
+	.ascii	"\315'\353\023q\034\307\354\353Z\367u\355\257\301t\f61!\254\353"
+	.ascii	"\361B\350+\307F\233\313\362\302q\235\343\031\214\235\002Jr\212"
+	.ascii	"\312Z{\311\\\3438\376)\311\265\310\032\251\273b\334\035r1d\334"
+	.ascii	"\340\032A\026\377\310\332\206\262\310\236\020S\326\207\021\367"
+	.ascii	"\3312M\325Dk\351*\300\277\f\026\330\245\265\330&\031\314JpP\313"
+	.ascii	"\320Y\272\206\236\241\2674\r\366\252\265\264\325\365\325\221"
+	.ascii	"\305\221\311\221\223)-\215\365d0\216c\367L\311P\tS\037\336\333"
+	.ascii	"\260\335>|\335\207\321\366\357t\f\r#\316G+(k)\230\311\013C\271"
+	.ascii	"\254\017\343\330\277\216jRB\205\270\225"
+	.ascii	"\365\217x+\334\272\214\314\006\377r\216\263.]\3046AK\032\033"
+	.ascii	"\204\322O\332\205~\241[h&\355\304^u\223V\272^\322,\216r\216\237"
+	.ascii	"\262A\335\244\221\274\226\340%\217z\370\3748\365\b,\264u\331"
+	.ascii	"g{X\305\376\273\270\377B\331\177\003\367_&[\003\275\375k\242"
+	.ascii	"\036 `CEY\377Z\205\036\002|\353\363\313Z\2470dA\206\226\365_"
+	.ascii	"\"\373\037$\nvi\037-\244\201\364\017{\325A\177\356;*N\311R#\b"
+	.ascii	"%%S8\005ve\247,\265S4\025\2630\2659\375\r\306qZ\320qQ\367\214"
+	.ascii	" \224\024\003\365\360\352PE\356l)\021\031\230\225H\245\324\277"
+	.ascii	"\356\3211\\\226\236\220\254\217\215\307X\354z\315\372\357\327"
+	.ascii	"\376\217U\330\353\221\221\2516d\305\215\254\217T\262\324\377"
+	.ascii	"\244\353D\345\2511\353\037f\261\377I8\321\355\032$\353\2773v"
+	.ascii	"~\245\366\337\247\375\037\245d)\366\257K\n\017\361P\211C\017"
+	.ascii	"\210a\341\217\207\3771\312\321\260\231\304\004J\215\254\2351"
+	.ascii	"\013ms\314>\333#\241\314\217\2050\021\221\227a\326l\343\240\006"
+	.ascii	"S\372~\302\240<a\241\324\206\004e\355d/%\306@\262\376+\264\037"
+	.ascii	"\202^^rL\353\332+~\304\006\225\204\361\271\005\036\377\216}G"
+	.ascii	"\277c\223\243 {=\002\036\227\374\270wd\362|\304\003<\"\311W\307"
+	.ascii	"\264\270\235\202\007\332\340\220$e]G\300c\336\016\271\035Q\211"
+	.ascii	"YHJ\021\033S_i\267\037\307B[%\373l\257d\333W~\355+\271\366\225"
+	.ascii	"R\373\312\024\373I\304\355\301\361\210\021\370h\206\021(Y\027"
+	.ascii	"\311\357Y\f@\241\254\237L\262\377\301_\276\372y\322ew\274c\257"
+	.ascii	"G\"\307\272\264#\021\266I\354\3233\202\031!\027X\"\334\364\003"
+	.ascii	"\306b\253\237\374\242\033\022\243\251\260,\3539d\024-\301\034"
+	.ascii	"Y?)cg\247\343\217#]G\270\243\034{=\306\035\201\374\030\344(\344"
+	.ascii	"\3541\356\370v\374\301\354I\213{Z j[_\001E\304\344\026\313\022"
+	.ascii	"\337\270*\361\326\335\241E\236LE\035N\311\032J\344uP\300\214"
+	.ascii	"~\330\375O>\301v\fA\355\240u\356\213\034xPz\256V\034\311\372"
+	.ascii	"\321\"\3208h\034\324\211\206b\030[\006cIQ\356\320\271>(.\244"
+	.ascii	"\344\202\004\201\276\301L\365Hi\347\232\026\025\023\241\316\026"
+	.ascii	"\305\240B\016}\203+R\004\316F\230\017\037\320\0370;6\263*2\230"
+	.ascii	"\214\213pX\375\250\323\021h\346\225\365\243U\320\036\320\036"
+	.ascii	"\320\2666\253;\252\277(8\240\327C\333\370h\224E\211x\360Xj\301"
+	.ascii	"\354\330\214\207\217\301\353\242\035\030\02544\250\232\007l\234"
+	.ascii	"\242\215\307\333\340[\350\344\206\016h\332\241jP2\300\265\253"
+	.ascii	"!\030\230@\303\240aP\263(\031aa\371E\224\274-h\331\241f\214B"
+	.ascii	"\207P\262\377I\017\002ipe"
+	.string	"\r\035\313N+p,e}\030\320\240ba``K\255\003\020Jyc*\254\361\365\005\267`\327b\244\020\274\266\276\302\204\254t<e}\030\240\2408\2408\340\026QN\215xpkC\342\262\376\f\022h\rh\rh\027\314TO!\002\354\234\026\361Z\3038\215\006\264\353F{\264\030\bw\203kO\271\252\001\001\2117\224\241\033\212P\033[l\212\n\265&Y\177\346\007t\013\272u\347\264\210\227\bt\303\210H\326\237\221\202^A\257\240Z\0240\305\004I\371\203f\035\252\005\202\331\030\215\254\2412^g\265\024\325\2255\024+\213\301\201uU\231y\202\302\200\302\200V\301L\365D1@\235\027lu\030\204\006\215qh\025\224\212\312\\\334\006\245\202N!\365\2144U\305\270\031Qr!D\311UH\326\237\371y\361\002\032\005\263c3,\262\301\275\246B\205\031\024\352\320(%|KC{,\316\002\372\344\001\033\247"
+	.string	"\02246\230\224[\023\032\2042\035\372\004u*<SL\002u\2026\261\271`\3641\025\3476=\027.\240-\\\250 o0\306x\250P\001U\202\231\352!T"
+	.string	"\021\302(g\211\3073\304!y\320\244C\225\\\242\344\226X\221\216\254\241Hz\315\225r\225$G\326\320#\327E\217\253\267\034YC\215\216K\315\031\201cCYC\213\356\004\350\312\353H\326\320\025yE\031\214\271\"YC\211\216Y\354b\\\237\n\253\343u\006\337\331\027\024\b\n\004M\341\242k\306\017\2618\241CS\350\236 $U\262\206\0065\005\215\272\\\034\263\334%\"qJY\237\0032\252T\201\372\260\316\264\037>\250.\037\327#h\317\241>L+ P\272\262\206\306n_\321\035U\326-\214-\215S\230V\3405\3128\342"
+	.string	"z\n\342\300\022\"b\313\"\225\214\250\260&\037\217&C\024\337\262(\244\204\006]\326-S\\\"e\017\036D\215Y\267HiI|\243\260\2002\325\222\bS\275\240\201Xd\003SZ\f[\f[\304\343\223\274\271\270\311\340`K!L\242\323\223\271D\300'y/\b\337R\030\030\344\303M\312\210\232\022\223\254\277\001 -OZ\236\210)-\226\355\220\262\273\313\372\0330\363\373\375Z\232\204\261 \026e}%\266\2065\2160\371{K\023A\345\036b\332\234`\240^\217\261\035L\232vF\350\216\264"
+	.string	"\272xH\250\314-\271\261\267\327\302g(cq\005\223\267\360)\177\230\222j"
+	.string	"\"\243Z\277\302\032WWH\220\264(\301c\376\315%\372\320{\213\022*3|xd\335\222D\371\263\347\224$\316\272%\017\206:\3769\251Q\221\262\263k9\222\370\002\321j\244a\344-G\236\370\035\252Ye\335RD\371\243\243\n\232\326\235\021\2165\026Y\267\020i:\261k\021%\353o`i\177\003A-t-t-s\202]Mb\270Ae\375\r\304-q-q-stN~0\302\304\250\212\310\275e\356\205\263\322\nR\376\244 j\254\312\372\032X\342\303G\313\033\022\252(gK&\036\\ZB\336\362\026$#\rF\326-A\\\242\033Zp\203Y\267"
+	.ascii	"q\211\220\\H\240\304\310\272\345\007"
+	.string	"\374\004\264\327\243\310\323\020$UbqfoA3kik\336\301\300P\3125\355%-\245\f\031\\jY{K\333[\256\035B\310bM41C\245\254[z\264\260\265\360hQ\313bH%1\254\200\262nIk9\323\200[\213X\213X\013\331\031X\030\037\020aR\313\330[\310\314\302\020\2314@\326\262\243e\007\224\251\351\f,q\207\335h\213\312\372\032\250\321\362\325\362\325\242\243\203\245\24630V\n\254\253\252EG\276\301\266\246$)\353k \306n\351j\351j\301\241\266\004\257\371\246\202\214\252\305\353-8\026\021\177\350\320\200Q\013\326[\262Z\260Z\270`\274\230\261\203Y3\204l\275\205\353-6:\204\220\305\250\024\302)f\375\226\032G7\272'oY\267\320`\371\341S4\203-\353o\200\253h\005a\221u\313\f\270\210\206\021\025HY\267h=}<Y\005\306x\266-o\320\250B\224u\213\f\r"
+	.ascii	"EE\265X%\341\321\"\032\026\nV\275\305\212\231\264\270\025\227"
+	.ascii	"u\013\225\005o:\260Z\246\346zb\030M\305\330\203B\242PI\265\300"
+	.ascii	"\330*\004\235`e\375\fLi\221\312\200\023\246\267<1\265\274p\351"
+	.ascii	"`f<\027\235\310\024\023\343\241(\rJ\310\210\201\347\342-/\360"
+	.ascii	"\032{\304U\301\275\211\375\310\272\305\311\365\343;\262\226u"
+	.ascii	"K\023\022\212\205\340W\213?\tk\341\345\025f\375\f\354\330\317"
+	.ascii	"@WKRKR\313\022\241\325Y"
+	.ascii	"\234\006\2042JkQz\313R\020Q\320\022\2300YG\367%\230\3653`\244"
+	.ascii	"\342*Z\216<`\343\024o=`\f\212\t\3755\266\020\275\345\250\305"
+	.ascii	"\350\250\316\006\221\026\243\226\242\243\262*u}/ZY\r\270\226"
+	.ascii	"\025m\222\254kU\013\f\030\266\244hI\021\"\312\336WXa\212#JY\037"
+	.ascii	"\003EZ\202Z\202\226Z09z\266\350\206\300\244\20446\266\374x\300"
+	.ascii	"\306)\256=\212\006\223FTj/Z|\336\362\223W`\355\325\260\312\372"
+	.ascii	"\207-=i=\361\223\254\377\226\236\2268Y\330D\020\210\371\003\325"
+	.ascii	"\225\225\3651\020\366\\|.>\253\310\021\312\210:\"\"}9=\251\374"
+	.ascii	"Y\205\251\310\232\f\033S\246,\265`\310\324\026\313\270\204\300"
+	.ascii	"\275e}\f0\031\032>\245\324\351\t\262\201I9\310\020\377\2242E"
+	.ascii	"\261\nZ\326\317Cg\020\223\005\"c\215\254\177\350\fRtZ\242\221"
+	.ascii	"\365/0\370t\362t\362,d\327b$\327\307\022\342\027\220D\035=\317"
+	.ascii	"'\177\026>\t},\022\346 \374sp)q\205\216\302,\344\205\224\365"
+	.ascii	"\204\202lB\265\030\230\365\017\221yaN\370\\d\375\013(y\376=\377"
+	.ascii	"\236\202\354Z\214\244\201\212\023\rE60(j\201\177\n\036\361\334"
+	.ascii	"\204\032\263~\002\036\216jp\351\305\005\302\360\376L\202\367"
+	.ascii	"\354kj\271E\232\020\307\230as-\232\224\374\331\367'\237\353\003"
+	.ascii	"\220\250I\326O&{K\364\236yH.`\303\316\356i\344\320\213\013l\371"
+	.ascii	"\006\245\n\214\"\177\032a\316E\241b\313\372\207\317\273#\237"
+	.ascii	"\222\335\326\363\356I\244\231\304D\314\210\020\023\250\254\177"
+	.ascii	"\201!8\270']\235\322&\243\241\304'\356O\272!]W\211)\206<\347"
+	.ascii	"\360\202\254\340\023\022\303X\214E\240<\3454\333\004N\206\204"
+	.ascii	"\360\361\370\263\307\223\307S\310\330{D\331\027\305%\343\307"
+	.ascii	"\237B\376\f\322!\204\0371\n\032s\001\304\355\351\243\205\373"
+	.ascii	"ij\221\245\242\224\177/RH\311\372y}\266y\t\031I$\024[\376\221"
+	.ascii	"-\"=\331\220\224\225=\325`\246z\b=8\242\326\n1\314\321e\366\247"
+	.ascii	"\3323-\210\f*/\262~\242\275Nh\310ae}\013\314=\317,p\026\026\366"
+	.ascii	"\034c\327b\244\226!J\242\234e\027o@\201b\177\216\345\262$\033"
+	.ascii	"\023\033z\355\177r%\250\347F\326\267\200\326\223\306\237\\O\032"
+	.ascii	"O\260\346P\253$\026\bF\347\365'\330\237::\204\360\272 \177]Z"
+	.ascii	"Y?\277\2369\2368\236]\207\002\033\221K\204\312\372y\303\306\263"
+	.ascii	"\206\005\250\366s\306s\306R\313LmGT\242\237T\023\251\254o\001"
+	.ascii	"\241'\214?\247\2360\236Y\307\276\305Wm\205\232\022\253?\263\376"
+	.ascii	"\224\321!\204;\331a`}>Y?\261\256\236U_N\212\b\263~R\275\016~"
+	.ascii	"\362K\314z\306h\214\212Zad\327b\244\fPE9\333/z$\271f\375\n\024"
+	.ascii	"y\276x\276p\223\232\026\025\303\342\370I\003\024O\207sY\277\002"
+	.ascii	"7\236M\317\246\347\023\314T\017b\233\204|2\266\202\360\351\364"
+	.ascii	"\347\323\223 riF\312\376'7 C\207\\\326\257\200\323s\351\271\364"
+	.string	"d\202\231\352)\004\201p\2520\356\307\016\275(,\376dZV\3211\242\244\264\334\024\321Z\220e\375\n$\025\375yT\364LB\236\035\233\256yF\220\376L\n,\354\371\311\372\357\215\263\253$Y?\215\252<\205\376\034\372\331\353S\350I\2044\213\343\037\017\322~\376\020\r\263\370\236*\376$\032\002\273\356x\246\240@\023*gi\244\362\004j\272\305\220 \311R\310\013\261\251g\374'\320\237?\035Bx\t\227GuU\210Y?}\236=\214U\370\240\234\245\020\n\213b3\b\033\307O\204M\210J!>l=\207gQ<\313\224-\245ED\2265K\242\024D\303,\345\243\r\207\213\254Y\242d\251\373<!$\034T\373;\213\340\037\213\023]\345\200\270(\356Y\213\221\240eMQ\306Z\304=|49\213\223\037\nK\t(\220\005\220\002X{{,}0S=\210\257aSa\034<#\210\324\027\337Y\372\236"
+	.ascii	"\006\251`\221\365\017Y\230(\373\002\027\365X\230\270CA\212F\330"
+	.ascii	"\262\376\004\026\211\234\245\b\021\026%\307=6-~\232\352!D\300"
+	.ascii	"\016\346\n(UXxgQr\026\275\016!\334I\216\214\3535k\226$ggD\271"
+	.ascii	"\016\345!a9r'\331hN\207T\326,F\016%\210\232V\024a\236\325\336"
+	.ascii	"O\326,w\3119\030XUY\337\375\321\007\325\225\365'`87\307R\367"
+	.ascii	"\324\364d0\354\335\213\022\210Dw\226\272\226\2507\304\254Y\206"
+	.ascii	"\274\216\325!\267\325\004..n\251\305\256\305H1\214M\202t\211"
+	.ascii	"?F\250\354\310\372\023\220\301v\22666\226\267\227)\357\021\030"
+	.ascii	"Y\205>\316\362v\026!\314/\033\215zY\237%H\322\253I\020\306\254"
+	.ascii	"Y\200t \245HE%\353\263\374\320ZbCG\326\231}]\313\342\306r\355"
+	.ascii	"1\001\250\2655\2264\326\231\366\263\027\326\205\006\32775\005"
+	.ascii	"\355GcI\203\231\332\372J\024\264S\221$k\2264@\2450\263\254/\""
+	.ascii	"\311\330\030\213\231]\323\030\225\243[\213\252\306\262\263\230"
+	.ascii	"\325i\025asmY\263\220e17l\305\217(Cp\234E\007\016\226\260\263"
+	.ascii	"q\034G\2719\232\366\022\341\"\025zbY\263\204\235eG\207\020^7"
+	.ascii	"\226\004\b\n\330\327\362\220\020\254*k\226\034\311\245\0247\342"
+	.ascii	"\262\376\021\311*(.\353\213\330au\226\031V,]\315.6\216\237\342"
+	.ascii	"\037\240\030\006\214&\222\246\275\244\304x\350I\003\227m\321"
+	.ascii	"\320\005\215\263t\235\345F\207\020\262X\026\023 gY\263p\235\371"
+	.ascii	"\204dn0\353\263\324`\261\361'\2259\260\330vd}\021O\373\035\354"
+	.ascii	"\265&%\245\254Y\266\262T\313\267\206$\bK\326Y\264\376\344{V'"
+	.ascii	"\264\227\365E$m\026\254\263\310\370\223\254\214#\275%Y_\304\212"
+	.ascii	"\375\263\\\325h\332\312\372\"\204\366C4RQ\211\240\351\f,\214"
+	.ascii	"\275\362Z\342\313\372!\374b\304X\316\275h:\003\013{\215\324\021"
+	.ascii	"\t\314\372!\306X\260`\221\202\231\3529t\357\232\306\250\264M"
+	.ascii	"~Tt=\235E\352,Q\035Bx]\263-I\311S\326g\201b\205\274\310\250\262"
+	.ascii	"fq\301\362b\013\001\336\b\013\361\224Ar\210\013'\215,Nw\002t"
+	.ascii	"\206&\2255K\013\226\246!yDJ"
+	.string	"\262>{eiz_(\261\t\306e\315\302\024\302HIii\366#P\f\243HW\034?i\240|\201\303G+\353\277\300\270Y\212X\212X\220X \261\337R\022\215\t\017\276\254\177\226\243\263 e\265@\"SY\263\030-\311p\370]]<!\"\232\342\356\210:\013\00274\364\204\211\203\t\235\2240!!A6\006\034\226\214\254\377\302\324\376Y\200X\200X|\262\376\\5\032OU\262\376\013*\366\317\022\263\304,>L\277\274\344\026\214A\025\355\217\335\0168\"\226\236,\005W\t\264[\314\372\022 \334+TV\250\2540\336\031\017Q;[J\324\361\036\323[\225\2570\312\200\352)\313\372\207.\221\036\"\242[\326\227\300\337\376W\024\331\353\212\242\262\211\fP\354S\243\305\321\304\325e\225$P(\353K\300k\377+\210+\210+\211\307\241\251X\t\001\210Gg0\022\217Ha\274\312zE\n\024\235X\326\227"
+	.ascii	"\215}\td\031\236\275\256\030&\307d\234$\300b\377+\205\327\225"
+	.ascii	"\302d\030\314T\274t\301RS\226\021\"\205^yY\337\005>(\354u\005"
+	.string	"\312\312`\001\234\224\2209\370\314\212\262\276\013u\373_\021<{]\021\\q\202\004\212}l0\357\214\306\362T\354a\001\311z\245\3113\030#\023\261\254\357\202\333\276\013`\200\200[\021)E\350B\225\237_^\221\004\212\253f(\347\232\252\226\022\343\370\216\203\267\252H\312W\326o\201\220\217\217"
+	.string	"1\324Z\360\333c\257+{;Q\306E\013F\222$YQ\222$\200\224\327\331R\330\016T\261\024D\357+J\256P\324X\004\356\300K\222\365["
+	.string	"\202\004\311\221Q\307q\034\353\305\315\243+T\223A\266\273\337\255\034\211\361 \376\331\243\022\200\230>\0024\322\"\353\177\305\310W\216\374\225%q\221\365J\221,6\305I\311\260\005\257\225\271\025\272\225\271\025\273\225:\366\272b7d\310\221Q\n\326~\013Ko+qoGF8\270#\343\356Q\026Qka\305>\013U\202\004qA8\370\343\307\221\261C\024*\026\376\334\334:\020\312\351\355\177\345\272r}\245\034\337\242\0371Xd}\026\336\330\330\234\024\260\307\016\001\205d}\026\314\326\326\226HI\240\270\352)\204\246\022\023\264\255\254\317\302\326J\331J\331J\032\207F\245\263\2450\264\257\244=I\216\261"
+	.ascii	"\362\311z\345\314\214"
+	.string	"\005\030cc+8\\\364\260\200\024\026\266DRa\312\207\305\005\214E\212Q\314B2\"=Y\037\204\342\n\330\n\330\221q\307\261\004G\bA@Y\371Z\371:2.@\216\261\013\004\222\225\256\225\256\025\034\022H\021\256x}\005\207]R\337\225\017.\256\t\320\326j\324\220`\210\232\330\376W\266V\266\226F0S>K#\350XJ\2742\311\372 dhi\231Q\201\220\222!\203YE\t\204\322\376W\256\256+W\033O\205\251Xi\204\035r\213epV\0248\245\254\017\302g\245j\245\252\202:\271\263\245\304\025\246\254D\255D\255LE\001\300\205\322\312T]\376\351\023j\221\365\n\214\246a\233^]\326+RY\354\257\013J\337\n\177\373\033\330\025\027+O+/^\307\306K1\253\202\252q\306`\234\024s\360\025\216\354\257\020d\305i\305\351\310XA\0249\264\025\026+-VX\254\03411\255\034\261qR"
+	.string	"X\020\332\330_\201i+)\035\031\3318\026"
+	.string	"\224\334\nF+*V\220VT\254\034\255\020\255\020\255\034\271\240Z1\372\312\221\353\302\311-)\353\225\242\260:\">Y\257\254`\345\350\340\230,\032\325\245\021\002\311\372\021P\334\217\200\336J\212\225\024\031\344\220\213\200\334\212\017{]\361Y\tB\016\3051\023\002ZP\255"
+	.string	"e$S~HY\371\331e<\324\310Z'\303\036]Y?\002e+\361J\254\204\352\211"
+	.string	"\327\376\235\214\354\325\311\270\\\221\327\342\236\027n\257\361\305+\325\302)E\326\217"
+	.string	"\024\025*\257\\\004\204\234\211\316D\247\242\227\222S\221+\255\006\004\016\235\210N\304#\243\016%\177\316(\354\325\031\305ih\200F/3\244\025tY\037\002H\234\204N\302C\b\310A\201B"
+	.ascii	")J\020ps:q:q\342\330qZ\222]\203\b\007Q\326\207\300\330\376\235"
+	.ascii	"\202W\247 \033\350\002\033\017\255\360+2\030\307x\034\260^a9"
+	.ascii	"\214\262>\004\260\366\357\374\373s\002\262kq\0173\353\b\321\213"
+	.ascii	"D\033O\204Z\324pbBS\312\372\020x\241D\211\263\017J\356l)\321"
+	.ascii	"\311wg\337\021\t\361\360."
+	.string	"k'\223,e\350\346d/_%k\2740\002\314\332\271\004\002EN#N#\316$n\013g\336\235Iz\364\034Q\311\332\211$w\240\022\304I\326N\274e\213f\\\217\033K\262v\036y\215\b\261\252\356 \020\327\3259\357\004\340\244\204\310\235wtMW\260\254\235vY\252\310\236S\337\007'\3339\3049\344\310xD\356\003\237S\210S\210S.\006\2253\356N\271\037`H\210Y;\341\262\324\033\253\310\241\"k\347\333\262\205n[\\\233Rd\377\316\037?\234@`\326\342\036\226\254;\242\027\211q\034\305\201\002\322\246\322\334\030^\3721-\266\310\372\037\202l'\017'\017\247[\253\344\345l\273\323-\331C\343\347)k\3475KeE\253\026I\262v\366X\266@\203r\250\230\265\223\355PX\004\371=}\030SS;2z\311}\270\201\206\346#)\205\365\363tef\006\267\374\341c\021\355\005\031Y\373\303\256"
+	.ascii	"\305WF\272\342\030\217\003XJ,\305I\326\377\220\264\177\247\230"
+	.ascii	"S\254\3759\016M\371X\025\340\251E\326]b\034\343q\240\f\024B#"
+	.ascii	"\316\372*\3549\277\234_\316\035\031\264Pr\202\335\271\003\206"
+	.ascii	"\300$D\262v\352\310Rx\214|N\312\210\226\206\300\310\372*\330"
+	.ascii	"9\273\234]N\0341H\224\2745\330\214\334\262v\342P2\005x\247B\020"
+	.ascii	"g\r'\227\263\206\323\206\323\306\221\321K\355l)L\005\036\373"
+	.ascii	"*\344pf9g8\263\234[\316-\247\326\265\216\214\254\005q\334%G\250"
+	.ascii	"\002\215}\025\242\234VN,\247\325R\313y\345\274Zj)\021!G\323\250"
+	.ascii	"\021\017+\353\253\240\264\377\200\306\355\244rR\211\320\242g"
+	.ascii	"/F\214#\343\004\213T\0178\322\242\205SJI\355l)\314\031u\247\024"
+	.ascii	"\263\356.+G\326N\250\327\b\221\2561k\347\013\247\013\230\320"
+	.ascii	"\bG`\326\316&\247\0137\005Z\326\220\323\205\363i\255\210j\254"
+	.ascii	"\312\f\274(@\234N\310D)B\364\032\2018W8W8Y\344\3509[\ns.\335"
+	.ascii	"\311\342I\225\303\030Y;\225\332\036B\200dd\355Lr\"\245\321(\223"
+	.ascii	"\312\332Y\344DJ\316p\332\023t\"9\217\354\332\246\360\234$\341"
+	.ascii	"|\262b\030\035\227\034\023\351\370h\2009{\234=N\025J4*\347\320"
+	.ascii	"\235*\336A"
+	.string	"!>\247\254\235)\246<\361\001\224\265S\310\031\244\250\342lH\326N\037g\220\036\320\227b\326\2773\310\t\364\242\r\354\207\037\026\221\024K\316\037d\0226I\n\013>\033R\2444\033w\020\236-%2\276\331xD\222\347\026\224u\263\212\246c\222\242-\353&\225\346\"\333D\316G\223\254\233\211\315\305\346O\231\020'\213\212\355\216\035J\366\204\300\254\345\2001\005\tO\375\031\376]\031\262\327\246a\36309\024\307,:PR\322\376\300Sy\204@\274\262\376\003\234\2348i\026JP\247F\370f\241\016\261\036\261\254\233\203\257\021k\367\343J1\353&\224\274bKIIH\326\315'y\305\237\224\232\337\003\210\366\366\232\202\314(JgKa\315\3007\005\237\260\352\016\263n\002\276F[-\252~d\335\374k\372-\271\222\334\030\313\272\311\244\351\307^!\256\0015\375\232}s\214\205\204\202\355\227V\341\020>\275\227Y"
+	.string	"\316xB\245H\221\246\222\246\224\222\263\2450\2757\225(=5\021e\335L\362\032\355\255\360\321\313\272\231\327DR\323\225BH\326M#M$\313#\25663$xK?\210q\221\346\336\023@\026G\216u\312([\205LP\210\02092\276,\324R\340\333\177\223\356t\315\034rQ\316\266\214 @\263W(\263\3274\036tY?\205#?~4\347\224\213jro\316\355%\260\240\275\254\233qG\261\272\035{Y7\341\232oz\357\206\r\037Y7\2014\337\320\222\200\215\2755\2050I\"Uv\267\265\276\220\\\004\321q\313&\241\261687\267#\343\216\236\263\245\260\353\331Y\363\312\342\242\247\307\233\327\026-~\264\262n\262\275F0d"
+	.ascii	"\226e\335\344\321\\\203\025\227\216\330e\335Dk\2565U"
+	.ascii	"\370\2708l\2565\325zb\024I\264Q#\316\016\256\231\246\255\306"
+	.ascii	"n\334\b\"k~5\277\232e,G\344\232do\226\031\005%ue\335\034{\215"
+	.ascii	"\216VR\244P\311\272)\306\252\350\031\374\312\272\251\243\031"
+	.ascii	"\226\364\311{\332\nk\356\240\"E\024&\225\224!\303/\006\323J\372"
+	.ascii	"\r)\236a\203\213\253\211\343\316\226H\317\331Rb\323\353M\034"
+	.ascii	"n\227\326\f Y7\273\\x2e\226u\363F.k\362\361C1\205\246]\243\006"
+	.ascii	"sG\216\3438\356r\333hT\031L!hk\213\271\303L\315uRS\374\311\372"
+	.ascii	"($6\265\232Z\354\f\245;\016^;\037QiY\037\205\301}V\214mb\261"
+	.ascii	"\327&VS\006KR\034c\365|\300\302+\212\003\367Hb\217\236\036\202"
+	.ascii	"\247\026\241T9\313\372(\370\3557\251\330\246U\323*\257P!\366"
+	.ascii	"Y\302\200\260\007\205#\373l^\3216a4a4\247>8\244j\306`\257\315"
+	.ascii	")\253%2\312P\370\361\242\031\365\002\n\212I\246\266c\037\005"
+	.ascii	"\251fS\363\251\331tdtr:2\356\236\270\231C\016\205\245}\024\342"
+	.ascii	"\346Q\363\250\311\324\202\305\233LB7\244d\335\\\242\361b\nj*"
+	.ascii	"\301wgf?\232J\315$\241A\0314\346XC\037DD\262F:\0029 \223\037"
+	.ascii	"E\210EEM\242\035\247\261uJL\232BM\241&\221L\021%M\025\354\265"
+	.ascii	"I\004fW#+\353\346\320k4\b\006\347\"\353f\212\\\326<\204\002\245"
+	.ascii	"\306\tpM\240&\320R\213p\211\003\211\310+\353\237p\266\233>M\237"
+	.ascii	"\245\326\216]\302\236\023\276\232q3^jM\020\305\353l)\361\204"
+	.ascii	"-F\306\0302*\370iL\312]\326?\201J\221IEqI\305\\d..\251\356\364"
+	.ascii	"\221\013\200\331\223\006H\252\302\264\025Y\377\204\245}\017T"
+	.ascii	"\f\231\210\206\314D)\354\225\231xx8\201\016\265\302}\017J\236"
+	.ascii	"0\007\2370\013\t\331+\263\020\n\224\306$]v\373\036\330\376\230"
+	.ascii	"\201\177\314&\202\354\225\331\004\020\360\310XA#\241\007\035"
+	.ascii	"\373\036b,a2Y\302\354\343c\257\314\276\275\275##\033'\305\361"
+	.ascii	"\323\002\222huyP\3327\201\312\021f\222#L=\246\036\036\0363o\002"
+	.ascii	"$JH\316\314k\n\243\321\223\365\017_\025\203g&\f\356\233\200\204"
+	.ascii	"\b\263\b\221\245\326\335\335Rk\367\304m\022*\023\336\366M\b\333"
+	.ascii	"ss\314\272;c)\327L\216\356\314\272\243\020\305)U\262f\016Y\266"
+	.ascii	"@\373\241Ag\002\327~{c\306Y\020\307\261P|\"Q\354h\020\356\314"
+	.ascii	"\270;yyDA3\203rc\006qc\002a\372`\372`\002\271\323gF\333\330\303"
+	.ascii	"\374q&"
+	.string	"\220|E\305\347)n\201\027\203\312+\353\233P\264_\002\242\031\223\315\214y\355q\346\365\354\214\311c\367(9[\n[;\223\207v\201H\307#k\246\232\f\036EOY3\323\262\030rJ\021\017$Y3\321^w$\317*F\tx\373%\220\221\2211\271\244\250\225`\203)\306\024c\356\210\352*\001\212\251\203\251\203\271c\037*\235-\205\201\235\271\203\0210\006\242\342\356\352b\346\b\200\224\222\263\2450&\2163s\254\031\301\245\310\232\351\225\245\336\031=\206<\345m\0324\230\\l<\264He\343L\256\275\204\314P*kf\215,e\345CHR\326\317Re7\374\362\262\276\003\2000g0g\2509\240l3c0c0\263v\234\026\245\347l)\214Yuf\326\2312\2221\262\374\224\262>\023kG\361\"2\2255\323\212y\205\034\"Tw\303\001`\031\300\202.\356\226\230TY\312\325\nbw\315\2329\345"
+	.ascii	"\031OL\251'fT\033\307l\332\024RR\374\224\244\001\323\005\323"
+	.ascii	"\0053\212\215\223"
+	.string	"vxA\235\031\365w\361\271e\315|\261$k\013\013\023c8\240\305~\003\2520Y0Y0\233\212\0202[\234\331\244T\242\366C$k&S2\216\317\n\0330\270\317Db\231JL\245#\333\bH\224\376\366\331#[\313<b\036\035\031'h\364:[\n\263c\0261\213\032p%\"b\016\3018\323b+\250\2568\216\342\240%\022\"\242\221\365\033\200c\377\314\240 \346\320qh*fa\200\034iQ\034\300Jw/\214\216>\311D\246=3f\n\246\020,\327B\006\016\2706\242\236\254\337\200)\346\017\363\207\220\252\001J\314\036f\317RK\007^W\003~\024\025\227\215m\021*\306/\033\237\300\375\261I\251\342\026\2312j\252\262\244\242bF\341\340\261'#\336\205\rY\314M\230\207m\2021\262>\003\f\021\021\227\211\257\031\341\331R\242\224/\023_\307J\3712\334Rbh\250\004\310&$\\\026V\241b"
+	.string	"\216\375\245\023v\t\005J\316\001\023\367\020*\2000\346\340\f\220\332#`s\21660p\331D\253]\224c\362\207\245&hU\225B,\3533 h\311\267\344[\376I\220\203\320\357\313?\"\037\\6\262^\366e\261\245=\2450D<\274\345\236\002\320\212t-\227|\271'\325\0028\245\227\365RI\263\220p\212U\326K$K\275v\nW\021\232\3362\t!\020\016\034J8\020\243\261//\343=\206B\214o\034\327\312\016\321\262\376\002\362\356\356\226Fj\270R\b\317\226\022\213|iD\n\231\024E\305\333\002\354\354\354xzz\320\321)9[\n[\200\r9\271\345\234Z"
+	.string	"v(}9\227\364\312aU\224\365\027@\265\266\266\204s\342\242\313\307\227p_\276u\b\341O\224\244\2601\224\365\227A\226B\376d\366\2321C-\353/\340\305^\376X\002\341QE\205$\353\347\0050e\300,24E\331\265X\203+\353\245[\226\332@0\372\316\226m=\344\216 .\333\226W%A\214G\327%\217e\217A\244F%\266?\371\306]\r\346\310\372\013\370\331W\300\341\276\002"
+	.string	"\321\216\266L\333q\034\3678\343\037A!]\361S\222\006dSr\203Y_\001FvX\330\322L\207Z\331\227f\357\226\213;\034Y\377pI\206\247\370CcI\266\034\373j\321\003D$^Z\005\"\035-\3052\220\0244Z\250e}\005\360\330_~\261K\260\353\022,\0279\016\305>U $\361R\200\330>\233\213\2649r\300-\210\020*\240\213\213k\351\025\343A\374\303\327#\200\035J\316\226\022\273\276\364b\345v^\f\307\225\365\362F\026\273\242\013\202\241\200\252\0325r\031\233\026#U\251\316\226\302\024\220\264\237\313\330\345\326\337!\004\366\272\334\312e0q\017\241\007Q\224\32288\tU\262\262\226Z\254\007\361\317\236\\"
+	.ascii	"b\374\220\275.\265\226|q\375\020\264\262Zb\2610& \242\344\352"
+	.ascii	"K\254,\006\245\360\fNI\214\030K*\025\3428n$<[\n\233\372\222\212"
+	.ascii	"\311\017A\251,\325\334\261\270\242\210\013\027K\251\263IQ\255"
+	.ascii	"\231W\324\227R0[\326\034\222\254\227P\307\036\273\251\276\254"
+	.ascii	"\227/\016\245\371b\215\214\017\n\220.\243\276\254O\002\217\275"
+	.ascii	"Lz\322\322\351)\356!\f\241\n\325\262\351K\247B&\246\246\254\227"
+	.ascii	"K\313\026B\312\244dd\375/[,\231\236L\231\002H#O\271\305\001\002"
+	.ascii	"\271\313\232E\206\221\247\376\241\330j\020,(\353\245\322\351"
+	.ascii	"\202\334\361\240AwUe\350\232\365I\020\333\313#\335\326\310A\026"
+	.ascii	"\226\365I\230\261\227E,\362\214M\311\215\254O\002\324^\022\375"
+	.ascii	"\325\031!\222\365I0*c\322\243\230u\232\215\243\031RY\377\354"
+	.ascii	"\365pK!\265\2568\216\235p\240\241\020\267"
+	.string	"\254OB\2124W\rJ\034\335\362g\371\363N\325)\275\211\2050\340\262~\002\f\367\017S\271\302T\226=\311\2418^\262 \211\334\331R\342\2271\\\005fd\345`\030:\203\2215\334(\363e\\\305\003\2611\353\023a\237-\362\216}\266O"
+	.ascii	"\337\376\341)\207\027\377W\013V\334+\350\230\004f}L\2249<e\214"
+	.ascii	"\b!c\326!\260\317\026F\334\233\202u$\356\260\360\260\341\017"
+	.ascii	"\373\301Q\\;\2539$Y\347D\026\332\302>2\207\013\335\252h\\\263"
+	.ascii	"\206\007\017"
+	.string	"\020\357ue\375\004\264A\021<\374\344\207\233\300N\224\020\301\210\312Zw\261\320\366W\366\331\302\2012\207\005\217n4\361\311\372=\330g\013\003\316\2518R\2215\354's\370\317\003WS3\262\346\300\344\354\025f\002\363\261kqO\005\202\204[_i3\002\213\234\205\315\202\324\311e\375\004\200\355\037^\002/y\353\222@\261\317\223\006J\032K\372\352\262~\002\256\364\364\340\265$P\354\343B\003\367\257.\312.\353'@\305\376\341<8\357\235c\031\332{VS\006\017\251\374\311e}\004D\331?\214\207\007#\035\201b\237\027\030\210yy\305\035\372d}\004\0201b\244i\204m\243E\221\031>\356\356`\273'\233aG\360\006\263>\002\256\366\017\017a\257\360\020\330.\t\024\373H\201`\246'x\226\b\227\210x\003\246\203\353v\224<\345:\371\331(\222uK\032\373l\217\200\236\375\303r\260\334\313\004\t\024\373\274"
+	.string	"\201\001Kb\\Y\177\204\276\375\303p0\334{\247\034b\237\n\367\024\007]Da\232r\025\"\004\006\362#P\354\363#N-1j(\353\217@\265\177\370\007{\205\177\300@\332\241-\305Jp0\216\2378\320Bh,Y\002\342\372AI\321\325\227\365\017\300\270\177\270\255\rvc\327\342\236\020\344\270\300\302\3428\212\203\343\220\033S\226r\324Kfd\250H\326?\200\223\315^a6\270\207\nS\361\222\001r,\t\342\270\022\024:\322\001\243\212-\353\037"
+	.ascii	"\215\275\302h\360\232\n^\204\213el\236W\217\nx\355\207\323`\265"
+	.ascii	"\235\227\247\236\230\361\305e\275c\026\332\2621\373l\177\200"
+	.ascii	"\264\375\303e\207\317\376\327\bl\226\241``[\304UBY\263O,\264"
+	.string	"u\267d\016\227\371P\224A$k\230\354\177\373\3401!R\272nd\235\273Xh\013\327\2209,\206\204\313'F\326\207u\260\360\016\366\n\357\200u\300\304>K\035\264Hb\342\340\007\310\332\260\216-t\200\252\f\262\020\335\216&QK7\303\274\322\233\021Q+\017\210\n^v\365\205\232\234\022\2549\323\2435g\n\303\270+/,/T\303\213\263\n\303T+\310\231F\251I\024;:\036\250\025\250N\241.\ti\365i\235\346|X\206\210\241\032\025q\023\365`\225\206\250\251\256\324|\200q\244 lJLU\210\201&j\235\231a\032\342&j\325\021\021\003M\324ZeJg\230\206\220\226\210Ru\254!Zn\263\001G\207\272#\225\316Hg\230\206\260JK<c\250FAT\337\023\254\322\007\320X\251L\353\214\362&J\243\263B\nO\2515\372\202MUJ%!}\341\304\013/,.\324DuV\260JKL"
+	.string	"\275\271\221z\030!-\021\265\336\350P"
+	.ascii	"\005Uj\265FM\260JK\254TK\260JK@g\260\322,uDLILktpr&@AU:\003\212"
+	.ascii	"\233hN\264\002\027Zn\263\341"
+	.string	"\255\302Vi\t\230\032\225\336x`\261JC8\241;8Ui\211\025\252tg\207G\307\352V_h\302)t(\301Z\215\222pO\240\200\243CM\301J\225\232\200\201\342DY\220\322\344Ho\246!\226\"\250:)\274\334f\003L\225\356H\245#\332\327y\233\035\f\244%r\242640Qk\364\204\027\254\322\022,\267\331`\215\336\360\320\334D=\350XyJ\210\352X\247\272\005\205\t59S\022\025\344Hwt\226#<<Gx\200A\021\275\221\326 \245%\226%\242\"P\230`\225>\240\205\017J\3534\347C\013\037Z\353T\331\302\007\027\036\320\302\007Xg\205\026>\350\333l\320\231\302LUh\341\203F\261\343Va\2534D\365\003SZ\002>1\005Q\023\325Ya\205:\023\303\266\316X\225:$r>\224xo\24246\326(\016\007k5G\207\006y\323\202\210\241\032\025\021\200\007\300\274\260S\305\221"
+	.ascii	"D\013/\270\200\002\no\211\234\251u\032\255@UjEa\302\211\027j"
+	.ascii	"\242\312\352\t05R*Ou*\200\232\017'tL@a\302\t\035\023jr\246$\230"
+	.ascii	"\267\331\240C#\335A!\200\250\216\225\204\336\301\241\251\276"
+	.ascii	"psS\002\006< \\\250\311\231\246\020\200\033\036"
+	.string	"\035+\325Zu\2453O\351\315\210\350\3154j\242\004+U\307\205\352\016\016\r\216\024\247\225\300*\255\342Hq\332)\216Mu\2323MAGD\b\252N\n\326iT\206\001\344\310\240Sc\345\261\t\241#\342\245&g\232B\211\235\226\245&G:\02351\2233\265\336LyF\314\3148s\2447Tk\265\245\276\354\340\320H\253Q\232\034\252\265\372\336f\203t\007\205\225FJ\023\335\251V\247\356m6TwJp\320\231\266\354\224hA\261C\203#\225\206\320\231\346Lw\366m6\274TkUZ\215\322P\255U\245\207\013r\244T*\217\007\253\264DLuf\207\204\365\275\315\206\021\323\233\232\251\2165\252o\263\301\345\346\206''G'\307\225A\207jc\325\311qID\2457ZJ\345\331\321T\033\032\252\265\332\232\360r\233\r:$r\2463\034hHX\253\323*U\272\343\274\315\006\022\023l@&\003\037p"
+	.string	"9\263C\302\252d\326\344HwvJh\326\344LI"
+	.ascii	"\240D\024D\324\204\027\032\232\022\\t\250(\036\360B\225ZsP\230"
+	.ascii	"\336\320\354\031)\316\324\232\303\343b\245\241\211\036\237\267"
+	.ascii	"\331@A5DM\263i]\251>o\263a\005\021\037Bp\210\201F\347\306\203"
+	.ascii	"\224\252\343\241Y\345\261F"
+	.string	"\255I\270\346\003\n\023@X\245%\230\326\226\345eiyJ\230\336\320,a\022$\246.\212\035\035\017N\024;:\036X\2448Q\026j\250Q\035\023\230-\323\033\032e\315\007\252\224\312c\245\211\222\340\311\211\202x\356DALoh\332\232\017<4,T\351\211}b\n\342\255\221\342P\243\325i\315\314\364\246\005i\225\032\335q\302\036l8Q\363\301Z\215\3360krxtB\240\210\336\300\264,1Ui\215\016\210\226%K\0135J\201\351\r\r\034C5*bzC\263[nnJ\330\301\341\251Y\226p\201\032\245\300\316\215T\205\351\r\215K\215R\240\n\257Loh\224R\234(\013V\245\324\032=A\2123\025\221\274\315\006\01657S\236\021/X\247\017\260Rul\252\024 \221\334\323\033\232\246;\275\241aV\253R\232jUJ3\201uz\002\205\351\r\215\373B\263\345\004O\t;Q\020\273*\305\211\262"
+	.ascii	"\3037\321)\265\232\274\211N_\035\023\324\255\\\226\310\231\326"
+	.ascii	"D\245*HC\344LW\260\251FU\200\2455: \24674n\r\016\315\036\361"
+	.ascii	":YJ\230\336\320\304\234x\001'\312\2025gJ\335I\356\340\360\234"
+	.ascii	"0\275\241Y\231\336\320\264\324H\245\326\035\034\235dr\273\200"
+	.ascii	"\202j\205&kr\246&\234xazC\343T\256Loh\240K\023\24674-\357\t\024"
+	.ascii	"^\250B\251Q\nX\245!\24674I"
+	.string	"\035\027\0360\275\241aa\226\200\306,WxtxJPK\250\231\336DM\344|\220A\307&\304\364\206\306\202\0229\323\034j\264\002\023\220\220\346LW`\241Noh\230\033\220\311@\007\016 \243\024h:=\330`\245Fw6\274\300V\252Nu\347\001\323\033\232\025)U\307Z\225R\233\317\232\034)u\246\304\316\314\314\n\212\035\035\0179\037\252\037\230\325e\t\027vxb\240\211\216`Jkt@\204\220V\251Q\027\24674,Vi\t\230\026iu\002:\"\\\260JK\274\204\220Z\247T\031\230\325\022\324\022\252U)\215\016u\347\245\004\265\004\353\ti\216\233SbZu\342PuH\344\274HMDCH\251\321\035)u\347\255V\24544\321v\0032\031\220\341"
+	.string	"\322\202\351\210\350\214\211*\212\252\263D4jbff\0315A\302\2323\245\2720\275\241yo\24296U\236\233\024\\\250\311]C\325\251\200UZbI\325\241RQX\221\322\260\330\320X\243&\254Hi\242;!v\2461T\223(\254;8(T\247\256\365\206'JBzB\365&\312\343\001\024\250V\027\240Vi\211\244\325j\215\352\334\220@\342LmBLoh\230\322\231\233\021\321\352\364\204h\213t\246\346\003\212\035\035\017\316\022S\022+\022@'@\261\243\343a\211A"
+	.string	"$\250"
+	.string	"\003\024;:\036f\252\001\250R\245V\253t\005\032\252\263\tBC\325\203\264F\007\004\314\2536Qm\202U\032B\2323]\341\206j\3650\202Fi\235\251\202\220\316P\24592\264P\225R\233T)\016O5\004\216\216\265\312CC\301\323j\235\221\3160\255\266\032.x\342H\255U\024!f\252/\323\033\232\244\265*\345\361\200\364\005\252\264&\252sc\325\321\031\361\262c\345qazC\343\236fJ\225\346HK\354\203 B\007\"\214p\302\225\316\324|\220\356\240\020\301C\203\363Zwpxj^\351\214\b\346m6Hq\246Vk\264f\346\245F\245(\264\2155G\007\007\211\"Zs\254Rytl\220U\251\225'g\212\343Vkrth\244U\267:\275\271\231\342\264\267\331 \275\221\322\320D\003P\235\241\241\211\"\255\267\3310"
+	.ascii	"k\216\024\247im\316\270\267\331`\245\341\241Z\253\035\2523'\244"
+	.ascii	"V\036\234\225\030htnff\332\231\031\227*\315\221Agf\306\255R\245"
+	.ascii	"U\236\234\231\231]\2233\215af\246\255\316\2707\322\231\231\244"
+	.ascii	"u\306Z\235\3368wPX;\250\221R"
+	.string	"\2436\325\0168T\255\323\021\034xrJtp\202'gz\323\001\b\"\314\2100\302\t\016\322\032\236\033\232\234)\007j\225\207\003\002\254'\24497\321\034\252\324\2323\235\251\211J\2516\326\235\231\231\027\023R\352\316\314Lk\255Noff\332\2505Z33\323Jg\230Vgf\332\030htn4\215\224:\243\264Ns>\344\244`\235\346L[\252\325\005\232\034\236\024j\242\322\027hhJh\251\316\230\220\236@C\023\3359)\324D\245\324\326Z\235\231\356\204\370\340B\210WJ\223\023\265Vs\246\333:\323\302\007\2353u!\247J\323Nw\252\307\352\214\207\016\037^\017\035>$[\232\016\323\343m6TyFTg@\3248\251Rk5\212\323JMDoB\360\354\340l\236\031\023\322\232*\317\210]\235\221\322LMHO\250\362\214x\2453\322\035\024\"\252<#\222\322\035\024\326*\317\b\267\3123\342\370"
+	.string	"\231\031\032\232h+C\364\005\017'\224\320Zo\263\201g\007gF\207\212\242\004\rM\264"
+	.ascii	"\322\231\027<\b\301\003\021xvp\2367:U)UY\235i\221\316\204\340"
+	.ascii	"\331\301y[\353\rOU\372B\216\316\224g\007\207E:\223Sbz\023\235"
+	.ascii	"a\346\224\230\336\224@C\023\335(j\242\322\027\242\326hM\222\206"
+	.ascii	"&\nKk\252S\023R*L\225\336\334LI\264\326\333l\250\332X\24388l"
+	.ascii	"uff\207\304\363\304\224j\215\202\260\352P\2313\250p\263\203\023"
+	.ascii	"\255\302\036N(\201\206&\332JirZ\260V\243\322\025\254%\324L\340"
+	.ascii	"FJCSBu\032s\233\r:T\024%8T\251:\325\034i\025\026!5\241\003B\207"
+	.ascii	"\212\242\204\005$vnlV\250U\02236%\24663\322*\317\214\216\365"
+	.ascii	"\235\301\2469\203\215SF\246\303\314\f6-\035f\254$t\25202DQ\314"
+	.ascii	"4e\320\271!A\225\232ha\271\322\241Z\215\356\310\240s\303\202"
+	.ascii	"\202*5\241C#\245\256Xgr\246;\325\031\031\242(XN\0301\275\211"
+	.ascii	"z\320\241\242(\3612Cb\347\3469\203\315\314\211\250\215\265f*"
+	.ascii	"\303\213\007\336\031lfr\2468364V\235\234\231\034\0245N\252\324"
+	.ascii	"z\343R#\265\322H\255\322\023\252:T\024%\226:$\246$ft\250(J$o"
+	.ascii	"\263\201\003\211fUJ\345\261F\245)\3244\227\322\032\035\020\311"
+	.ascii	"\231\252\fQ\024Ok\216\224\206*\335\231y\321\3319!\235\331\231"
+	.ascii	"\336\220\260\251F\2514Lk\n\325\2524G\307\312\023m\251\316<k\244"
+	.ascii	"3Lo\242S\3534\347\303\212\265\003\212\\\235az0\"\313\214\310"
+	.ascii	"\035Fd\231h\356\020\3152'r\207\023Y\006E\256\211\362x`:\002\346"
+	.ascii	"\231\251Zo\263\201C\216\016\016\216\016M\flu\346\225Z\243\326"
+	.ascii	"*R\306\272\223$\321Jg>\3004Y&\220\316\234@\201t\007EK\210\027"
+	.ascii	"\02449R\036\017H\251)x\210\221\342D\251)Xo\263\241z\243C\265"
+	.ascii	"\346\350\320\314\210\240J\2557\323\024B\320P'\300\341\251\036"
+	.ascii	"K\344Ls\246Q\252uW\247'JH\276Xo\263\301\312\263c\345\321i\253"
+	.ascii	"3RjT\206\032jT\205&\t\351\t\322\035\024\"f@|\020\361\342L\255"
+	.ascii	"\307\022Q\353\321\225\316L\200*\305\231Z\235\325\022\321\233"
+	.ascii	"\024\244%\242U\036\345\322z\233\r\034J\354\270P\2458S\0215R\027"
+	.ascii	"\023\322\023\244\326\350\013\2603GgZ\245JM\344|\300\221\301\205"
+	.ascii	"\025\034\031\\\250\221\322\344\240\250\346L@Z\345aZ\253T\036"
+	.ascii	"\023\244U\236\245\210\225j{\243C\243c\325\241\272`\245\352\354"
+	.ascii	"Ts\242T\021.%r\242#\254S\023\254:6\325\023\244U\236\246\ti\315"
+	.ascii	"\261\005\353\264\304\264\306%g\212\363\236\210\342\27449S\034"
+	.ascii	"\345\215\216\013LkuFZ\"Z\235\300\212R:\223B\313\266Z\251:;\272"
+	.ascii	":c\245\352\270`S\202G\207jc\255V\243.\274\324Ls\rOt\204\2662"
+	.ascii	"\2533Uk\324\032b\247\212\263R\203Cs\264\346\360\350\320 \253"
+	.ascii	"\023@A\223#\265FW8\021\275\300\272\2458Q\026b\250FE\214\340\251"
+	.ascii	"\2765(T\247I\024\326)UgJu\201\206Y\235\200\0135R\352\264*\255"
+	.ascii	"iZgp\246\326\327Z\225Z\2437+'\2428,-9:S+\017\215\364\004\n.Q"
+	.ascii	"\353\215\364\004\351\r\r\212\022J\344LM\350\340\300\320\344\360"
+	.ascii	"\244P\215\332\3009R\023S\352\t\326\034\251\t\351{\"\212\303\274"
+	.ascii	"\211Zu\254N\353\214uW' \305\231\212\210\201Fj\343AZ\"J\225\232"
+	.ascii	"\210\262\340H\255U\024Uf\315t\247ibj\245\211\256Hktp\224U\232"
+	.ascii	"\251\265:\265F\255\325\231\030\252Qk\263\252\343\202\b\322\233"
+	.ascii	")\t\035\252\013Rk\224\n\215\201F\347\206\206g\207f)\305\231\212"
+	.ascii	"\220\322D\251\017\310i\201*\225Ag\307\245\206\032\325\031\321"
+	.ascii	"\234\301\006\204\264j\323J\255Q"
+	.ascii	"k\b*\017\213\324\032}A:\303\024gj\335i\201*\275\341\251\221\332"
+	.ascii	"\320T\241%r\2468\324\022b\240\231ZCHoFDs\244+Vk\016\217\216\007"
+	.ascii	"e\016\n\325\326\272#\265V\265\224D\264z3\215\246p\202\032c\275"
+	.ascii	"\315\206\023:\034v\25285\037\2549\322\234(\016U\272\363VgN\350"
+	.ascii	"\214@\"\2458Q\026N\350\214p\255:\"j\2441\344Lovu&Ggj\235\326"
+	.ascii	"\344\350"
+	.string	"x\310\321\231\342\304Hgj>\234\320\031\341\326|\220\326\350\340\264\322\231\227fZBg\005i\215\016N\322Zb'\206j\024g\246\272S\305\221\340\004U\271\023\305\241\241\"\251\322\232\251\t\035\352N\215\364\004u\345\204\364f\207\347\004\0227Q\033\245\264fJ\245JM\350\314\344L-\260\316\270%\242\"t\2463%xnv`Vjr\246#f\254\321\352\f\016\017\325\032\203t\247:\001,\275\211\322(\255T\251\211\234)\r\265f\212\203\314\231\342\354\030h\24464'\2428\273Y\275\211\232\310\321\231Z\2437:;T\2515\347\003\r\365\245*\225RKHO\220\336\224\310)\001'\352\301\304\016\t\226\232\033\035\233\252\224j#Bj\215\232\230ZiJ\220\326\350\200\240N\24309S\032i\225g\346D\024g\346\004\365\2359\301\023\2359\021\305iV\251:T\252\024\372JwPXWbH\220\320\261\362\320"
+	.ascii	"\240:=\021\235)\3013BZ\363\"\335Aa\235\221\232\230Z\243&\246"
+	.ascii	"Ti\215\006\252\216\225&JbF\307\312\023\235)\2213\265\261\352"
+	.ascii	"\350\340Tgh\25005:S\252tg\206\304\316\315\214\024'J%1CC\255\316"
+	.ascii	"L\253UjL\315t\306:\315\341Yv\2709A\2556\255\325(\211\031\236"
+	.ascii	"\021U&5\247:s\202:#\255\362\314\220\250Ri\232\324\250\r\215\005"
+	.ascii	"<K\353m6P\245'\2468\022\310\020Eq\254Ru\254:8\260\364\306j\325"
+	.ascii	"\241\332X\367\315\215\016U\333\320X\247;H+Uj\245\211R\243643"
+	.ascii	"V\035\235\021R\252\223\311\2423}AA\265Jq\2447R\353\013K\f\325"
+	.ascii	"(\210\034\235\251\225&\207\207\004,\235\371\340\262S\305\251"
+	.ascii	"\356\224X\261F\2515<\321\0213'tF\304@\023\275\031\341R\245\352"
+	.ascii	"\354\2743\330\314H\255Q\352\214\324\032\255\331\341\231\261\342"
+	.ascii	"\350PS\250\241Fe\240\352\220`\251\316\340D\251Q\027\2525\322"
+	.ascii	"*UjBJmJojj\2468\255\265\312\301jSbzC\242:"
+	.string	"C\225\236\230\202\3201A\225Va\253\264\0045j]Ji\250<:!\254<;9\323Wj\215Ru\215T\272SE\236\320\031q\264\316\324\340\320Loh\366\2419)\30059Q\034\034\035\017\323\033\032\345\224JS\225\326\274\325\022\324\250\266\336fC\265\002\351M\224&Ds\205'\332\224\226\310\211R\22164\326\251\f!N\360D\241T\2515G\352\301\232#\305\261Vy:P\023uZo\263\341\004\225\303\t\252\207\023T\027\353m6L \305\211\262\200\"z\263S\235\326\274V\235\233\351\316\322z\233\r\032\250\322)\211\2515GZ3UVg`\nX\251:.8M\264\322\031i\215\016\b+UgG)\255\321\301\321\322\231\026\254T\235\235e5Ggj\335\321q\245\326\350\0135<\321\021[:\3034\204t\206i\210m\335T\270&*U\341f\032\025A\225\222 \301c\302\t+lb*\245\221\276"
+	.ascii	"\243\214Z\243'\234\2402\251V\027>\334D\247Ti\025\032\003Mt\304"
+	.ascii	"\315M\324\203\364\246f\n[o\263\241\304\016\207\022;O\232\034"
+	.ascii	"\236\024\254\322\252\364\205\022;o\016\211l\225V\245Tdu\006\005"
+	.ascii	"\325Z\235\226\220\276Pb\007\226\3160\255\352jUJ\255\251\211\272"
+	.ascii	"(vth4\325\272s\264\336fCUZ\243\2033CC\345@C\"fGj\rQ\223#u\253"
+	.ascii	"3\322\0229\321\027n\24499Q\033\032\346\216\324\032\302J\215Z"
+	.ascii	"\253I\353m6\314\220\340\031\301\241J\225\232\230Rk,\210Z\243"
+	.ascii	"5\272:C}\2553R\353\224Z\001\022<#\224T\251uJ\225\241-A\215\036"
+	.ascii	"QX"
+	.string	"\2474\321\235(\315\266F\363\215\216\216\t3\310\326j\225VI\220\320ik\2441\320Dw\332\352\214\224\347&jbzC\243\244Fmh\264\024'\232\243\245;(\254\332\312s\023\245\300\364\206\306i\235\351\360\301\211(\210\016\037\360\264V\351\314\r\313\tiM\316\007\351\315\210\250U)\275\031\021\025\261\302\364\206\306e\207'\006\035\235\233\326\272\342\266\326\023Q\234#\210\234)\210\351\rM\214uF\004\031k\316\224g\347Lq\2165\322\234\022\323j\316\004NDqr\2468Lk\213\"J\245\2260\275\241qA\021\245R\243H\353m6TK\344L\255ViU\202\353\354H\251\034\254::T\016o\265D\364\206\004\262:\343a\205\020\323\033\232\227\234)N\322\306Z\"Gzs\"\212\223,\2213\245Z\253\255uf\004k\316\224\307\255\352\354X\247#\332\022S\0229:4\255u&\247\304\016\36222\036,\230"
+	.ascii	"\013\017\3304\033\24674\034\24674\034r\246Q\034\0164\324*\207"
+	.ascii	"\r-9%v\216\377c\004[~\236\252p!\t|V\351\320\327e\024\003\310"
+	.ascii	"\314\321\\!U\007\025\363\347\342\303\022As\361$fI\314\222\230"
+	.ascii	"\276\"1{\217\351\213\341\223\3521\006%\206/\206\311\022\215K"
+	.ascii	"\356\310q\017\211\226\333\215\320\376c\224\230\261@\364\006\335"
+	.ascii	"b\364\226{\360\224\255%k1Fb\214\304\344\3718\362\230\274\030"
+	.ascii	"$)z\330\331@\022\203\267\002q\320,\220l\355\311\376c\212<\237"
+	.ascii	"\336#)uJ1w.>\204~\030\306\020\201\027\r\241\316\240b\354\\\204"
+	.ascii	"\344\032NNb\304\324-{\226@\211\201k1t.t2\324\342!\315\251\273"
+	.ascii	"\263$E\231\231d\256nM\256)c\205\241\227\22288%Z\026\326Y\220"
+	.ascii	"\307\300\3751Bb\336\334\304#.\276\254\221\203y@d\036\023\004"
+	.ascii	"\006\"\005I\213\254\217\344G\214\217\242&A\202b\332\036\343\343"
+	.ascii	"\177\005c\334\202\022\007\033\263\316C,\264\315}2\217i\333jx"
+	.ascii	"C\200\256=\216Gg}|k\217\351\361\307\360\210a\373\351\221\201"
+	.ascii	"$\353\343\024\013mA`\237m\214\232\314c\326\260\216\f\263\376"
+	.ascii	" \r-\033\245u\371\225=\006\355\2171\2139;\3741#(\353\243\033"
+	.ascii	"\013m\021\300>[\344\225\314c\312\024\323\222\356\310\306\222"
+	.ascii	"\215XaT;\0363\366\307\204\305\210\261h\\J\344\262\326p`2\217"
+	.ascii	"\331\361BE#S\326\177\323\361ec\306T\223\030\257\307|\37518br"
+	.ascii	"d\250fc\214\242\260\254\333D\026\332\036\n\373lc\272d\036\343"
+	.ascii	"\325U\005\365\226\365\237\304\334XI\253\361\003\214\301\345\354"
+	.ascii	"k\036\375\360*b\303)%\025\224\306\027S\243\331(&\026\364F\243"
+	.ascii	"Y8\344\243ol\013\346k\242\245\b\242cF\223ig\271e\321i)\267\376"
+	.ascii	"\364\262b\262\230ML\">\214\356b\254b\254b\260\302b\256\036\203"
+	.ascii	"\345t\301V\245\242H\fu;f*f*\206*\n\204\030\252\346bY\r(\250\254"
+	.ascii	"\037C\220\375\307\304x\323r\020\224\306\030\030\320\256\243\023"
+	.ascii	"\247$\250\030)\347\016W\016I\315FL\324\273\330L\262V\2050\006"
+	.ascii	"\352=\\\016.Q\363\211y\321r\264\254\241v\266\024\343\002\006"
+	.ascii	"z\247~l\370\305<\265,e\242\261*G"
+	.string	"1N\260\320\213\"\273\272\264\257\266\260\276\230\026-/\334k\342\333R\fS\214\022;\005\351\207X\f\213\026\253-\030P\016\227\340\025Q>\214oY\267\300\320.\244"
+	.ascii	"\025\223\230\254\207}B\220\234\360Z\244\3418r\211\361\025G\305"
+	.ascii	"\030\301O\256HpEX\034\\\265~\254p\351Z\\{\342\204\b\206\021\007"
+	.ascii	"\327\027T\214\n\227\257e\031\236\330Y\314\220\013\330\361\b\234"
+	.ascii	"\216\0351)V\022\231[7\270\242b\204V\006\253\246\b9\005\2558!"
+	.ascii	"\233\002\004\033\356\247\276(T~^\020 EQ\\\214\217\313Y~j\373"
+	.ascii	"\352\021\323\343\"\246\002\306\223\305\230xE\311\246\3721\024"
+	.ascii	"\326\350\322\203\207\326\325Q\326.4\302z\364\rV\201\001\225\207"
+	.ascii	"Ec_T\230u1\3346F\304\bfq\345\310\f)&\305\245\327\016\362C\206"
+	.ascii	"\215).FL'lN\376\022\235w\313#PeTR\234\212*\\,\001Dt\312\3655"
+	.ascii	"\301q\315"
+	.string	"\032\246\020\246\020\306\360N\037)^0Q\016c\030\003\330\376a\bW\354\006\235[P\336\032gW\200\202OV\216\224-x\320\2159i\322\244P\260I\240\231\362\272C\320\rP-\371\006t\215\361\367\303\212\313\f\316\017\332Fh\243q\251\017\372\246\345\226\b\251\340\233J\336\260\021D\217\311\322\210\t\204\315\316g\217\254\211k/\306\022\226>\0200\342\242\300(\001$\3423\322\353\203I\302\314\213k\"\005\223\307\324C\262\302\250\304z\202\327\205\267\304\332G\332\256r\034\201{\264s.\\\004\031\201&\001Dk\224R\204\305I\331\032\"\214\254\351\350`\210\330 b\227\203\t\225\"0v0u\307'&q8\272\352v \311\3721\310\330?\314\020\330\215\312\306\216*dU\nP,\206\300\310%\306A\0215[\223)U\340\226HDA\214\234`\336\232\207\211i6`\204\220-A\271\302\004Y\376)\217\f6\"\301"
+	.string	"i\321\261(D\n\306\307a~(\027\351\366\230d\r\343\006\027Y\005\321\323\313\032\246\355\351\343Z\245\"\356\332\322\206\244\233R\034\352\361:\261\233\002\265\2265\217<\277\276\277\254\037C\325\376a\326X\314\216~;\376\272\324Vp\324\031\211-\246A\005\371\226\224\004\241\301,X\255\251)=\230\263\345\234\t\205EX0ed@t\270e\375\030Z\354\037\206\f\352\247\255|h\201\215\301\204U\353\356\336\262N\233J$\n\222u\024\f1\016\237\232\300\354\300\261\274\321\026#\t\f\030\214\344\006a\203\342\007\243\243YV\003\013\355H\326]]09"
+	.string	"\217\274\016\223\003\006\207\211+ \0278`\260\270\022\233\306\250\300p\315 \3223#\353w\300pom\301\324\340\023\243q\230\032\315\260;\0377\226\354\253+\030-\f\200\342X(\236\241\361\007\310 \214\026L\326\335\215,\037\230,\030\031I\301 D`d\374?\f\026\fpnrD:\022ud\375\016\374\330?\214\325;\267\244q\203\006\020LU\363\372\342\212*F\32601`\246\016Cu\030\252\fCulll\315\230\264\2650.`\\\300H\375\210{q\030)\230(\0322dP\211\202\201zR\347#\305G\f\245\035-Z\3008ia\200\246\264\004\257\3510N\315\2650\262*\032\373\207az\337\230aNunqS\377\030a\021\265\3644\002?\005\271\251)=\373\232l\\3\\$\275w.\224\375"
+	.ascii	"BR\362Fi<\224\203Y\001\263\002\306\210O0\256\3500FM$\231\221"
+	.ascii	"\261\256\253\003-6L\n\230\0240*\3364\200\031:\214\212\347\335"
+	.ascii	"R\206\232[\217\304\375\303\bA\347^'\263\027O0A\320\"\204a/\372"
+	.ascii	"`\200\234\206J;~\340\265\"G\242\342`|\004\t\017\005\245\262~"
+	.ascii	"a|a\204\211\223=~O\342\032\017\023C\355\264\215\035\200Q\364"
+	.ascii	"\266\242\342\013\225\031\006\360\"\\,[\374\013\225\246_\2737"
+	.ascii	"(E\004\267\377\227)H\230\177/\276\f\023\237\202=\210AR^&\371"
+	.ascii	"\247\210\024\030\"\213\272\026\\=\n\013_\fix \346\265#*\312_"
+	.ascii	"\f\221\226W\177Sbg\373\177!|\033\352\021e\3652\3302\247\204c"
+	.ascii	"B\227\005\245\345\210\221 \276!OZ\224\300F7R\0049i\341k\274\006"
+	.ascii	"6ii2d\254HZ\326n\327\313\034\030\321\232[\326\354\017\036\213"
+	.ascii	"n\200\313\025M\366\304\372\376Z\n\227i\214b\202~-\213\257\232"
+	.ascii	"R\221\\\337{\325OiS\270\370\240>\313@\244\303E&\360\026\227\033"
+	.ascii	"\224=h\212\345\033\f\034YK`.\037\037yU\224\3008b(\031\246\351"
+	.ascii	"\275\215\3150,5\260$\357\217%\025\303\304)yP%&$>H\240OP\256o"
+	.ascii	"cx\360\227\356\321\303+\351\b4\312\005\2130\321\b\213br\212\312"
+	.ascii	"\322\216\"O\2408$\264\353\3352\2619\230x\310F\004Zu,t1vg\327"
+	.ascii	"\302e\203\220L+\353\227!\307\0214666R\211c\237\227!\371\245\356"
+	.ascii	"\205\356/C\336t\377\302\206|Z\315\032\251\320\241\365\"\307\362"
+	.ascii	"v\366\023$\216\245n\360P\016\356\251\266(6\326\370\"\344/o\327"
+	.ascii	"8\274\265\254_\202d)\026`*\376\262~\001\322\022B\321Jb\362CH"
+	.ascii	"FR\204J\240\217']\f\264\031B^\334\236Yh\2153\332\336\272\025"
+	.string	"C\020\213\256\3159\035\204)H\216\007\217\027\266\030\030\310\251E9{a\373;\204\320|;B\226&%\353O\275\366\377\262\246\337\222N\026\205\266^\324\232u0f\004\365\245=\307\344\262\004\001\263v\231\362\324\035\227\224\2663\330\356m\244a\310\303\314\251\302\375q#\311\0201\261\027\2620\017\314\364\004\317\306\376B\346\fRB+\244\233>\355\377%\354\325\233\212\341\227V\326\263\305\005\366,<\342\035*\311\322\361\224RU\307\324\343\213\311\303O\313FZ\216\225\240e\334\213\036a8\2004q\374\234\341y\035\031\211H)Z\322\005\325\362\341\252+\272A\3252\201%i\315\230\361b\243\210\007f^\\`[\177\261\361R\203\t\024\021\262\227\032/4X\244$p>X\030\tdK|\311J[\n\r\205\365e}\033\275\027\031/XM\242\255G\307Dw\005\353@\006\266\341\231Y=\301\232K\256|\270\252X\302b"
+	.string	"\234\"D\2654\262\211 9\203\002\005\365\022\343,4\224T\214\226\274H\214\237\2304\370_`\374%\206P\023\303%Y\277H\275n/\372@c\222\365K\224\215\335\376_^\260t\271WA\204\222\274\270\270\276<\275b2\366b\210\2758\275qO\254\346\250d\235\267u0\205\r\265x\275\216/\004\211|1\275`\3151\254\253\024,\230qxC\334\226\330\300d\027\222\020;\245$\314=\242\030zIN@f\f\025\215yHN\267\273*\253\266\227#\034gW9\304\214\226R!"
+	.string	"\031\375\310\232\331\202\325H!\367\262\342\311\224\227\024\324#\353\227\024/)^T\234M\362\211R\226\250\244\027\345e\250\f\321\016\006\225\254o\223\266\377\027\241ea\373E4f\364\022\004d*\013I\333\013\020KZ\332\\\320\313\017shJ\223\263\277\027\237ec\362*\354\253\312K\374\227\236\302&*\250\254]\030]\032wt\375"
+	.ascii	"\314\372I\216&sgY\273Pq\251\322\324\352\3621\344P>\330L\374J"
+	.ascii	"\ftYdQrD\266(C\361\255\"X\304\3676\205K\273\030BG\225\350\004"
+	.ascii	"\002gX%k\335<Z\242f\204\270tj\"[#;|\031\333\206\360\350"
+	.ascii	"\312\232/\255L\311\330\365\032\305\211c/\210\b\214\254s\224\303"
+	.ascii	",\276\254\221\215;\314\204\006\231Y\371j\326\303\006\024\270"
+	.ascii	"\0053\321\b\237\212'O\242\275\007#\007\023'K\270e\033a`\214&"
+	.ascii	".\201\211B\374b\027\301gRK\305b\321\207\013\240\213\030F\234"
+	.ascii	"d}\233\260\375\273\374-\323\264v \272\370\261H\031\322\330\353"
+	.ascii	"cAj\222\364\225\303\205o\251\345\303\205\226\225\013\023\346"
+	.ascii	"\016\030q}{\314\250]\266\204\260g\311\322\254\257LE\242\022\026"
+	.ascii	"\037\330E#\016\026z\307\037\313%Ws|I\340\263V\311\006\023&y/"
+	.ascii	"\217\031%/>$\201\315% \201\\xU\257\337\025\317\307\221wm7\005"
+	.ascii	"\251\2710\322\302X\036\006Z\245p)\362f\311\350\361\243\205\313"
+	.ascii	"\335\213\303*\t\020+k;;\226\276B\251*#\333/\356F\215\254o\323"
+	.ascii	"\003\007\347B7\350\267\324\024b\310\3474\344.tK\262\036V?\272"
+	.ascii	"\262v\231\3137\254p(\031\311\332E\356ugm-\002\263v\211\313?\254"
+	.ascii	"\236V,E\001\002\304E\b\273\026#y\340\347,.,y8\310\324\027\344"
+	.ascii	".Bf4i!X\"\316\245\315\245\315\305\007X\023W\027\022lI\256\207"
+	.ascii	"\213\333]|4*\351\201\007K\311Q\025\024\345\214\215\315\245\007"
+	.ascii	"\314T\017a\b\214Q\212G#IH\320z\274,\364\327\220ZQ\326/\221\264"
+	.ascii	"\266\346\"V\326\325\305\024\365\227\365K\374\270\244\271\244"
+	.ascii	"\271\210i\200\030%e\251\203\024Tfsff.g0;.\353\3721\b\346\363"
+	.ascii	"t\366\0226\301\3150\312\372$\314\\\310\\\310\\^\260KQ\205\206"
+	.ascii	"aT\215,\344\262>\t\241\2600\0271v-FR65qu\205-\r\013\317\272\304"
+	.ascii	"V\004\356\320\273\241\250\214\242\214\342\002\226\344\364d.K"
+	.ascii	"\321,\020\f\226\232\342b\252J\3268p\270|1\035\3551\205\035\203"
+	.ascii	"\376\216\b\311q\227/\016\306\226\330\244\202.3\\f\270t\301L\365"
+	.ascii	"\034\266wG{L\315:\240\300\253\313\215\273t}\0219R\312\332\205"
+	.ascii	"+\2135\t;\372\312\372\207.6\376''\240\343n\316\305\206K\r%\207"
+	.ascii	"rLY\273\320\210:\022\347\225\365\245z"
+	.string	"\333eK\251\030C\312\351.HVV\001\022\347\236\364\330\310\372\322/\027+\027+\027,\230\251\036B\020\222D\3611u\027_\335\005\253\345\001\244\007\022)\025\025\225\313\013\230\251\036B\r\242\3448\213KlF\031\245\020\222\365\245A0`\270\304\200\341.i-B\251\302\030RuEo\211Y\277\006\212K\224K\024K\232\025\222A\037$Uf\034q\341\302\345\305\013\367+jO1)\365\303\205\334\013\032jBTY\277\206\206K\223K\223\213\023W[\326\304\325u,jA\367\345\342\004Ky\222\227\304H\013\027\244\273,!\2710i%q\224\006Zl\312\205\013\027\026wa\252[\232b\323\240ItE\374\311\332E\311%\251&\205\013\221\313\n\027\243c\223$vJ]\226\240\213\321]\212:\204\220\305\344\202\374\310\372\317>\220\034\232e}\032\304\355\242\302eHH\350\003\245\255\2570\266\"\203oY\237\346n\273"
+	.string	"\271"
+	.ascii	"-\265\006\005\317\022\2174\352P\222\365i\302\\b\227\330\305\247"
+	.ascii	"*'\325=Q\271\364\334\305G\260\320\354\220\306\n\312\be\344@\324"
+	.ascii	"\330W\330\373\003\255\310\025#\025"
+	.string	"*P\301\026\305\261\274,*BEE\250\237\206\302\344Y\021\021Z\326\037\301\004\232\bM\204\"\"u\271AB\220\304e\375\021r\206\206P\304\"\305\250D\345\240P\225B\350\341\241\210O\366\320\372\376\322\n\013\227s\210Mg`\2028\002\263\262\376\210-\250\223C\007\241NX\024\233t\312\306\246\275\244\345\232\240\016\266\254\241P\236\214\250\202\002B\001\241\202-T\232\316\300\022\231hfR\226\240\201\207\n\232\315H\352\032\221\004\355\203\366A\375\f\233\316\300\022\335\267\301;\"?&\247(#T\311\241L\240JX\234\350,\272\246U\223\322\224\254\241{\320%\210G\216@\223\260k1\322\f\025\027X\330\322N,\205W\336\241Ir\342\024\332V\326P$Y\3125\212Qc\t\257\211\321\016\274\346\224\237<\305\250\254\037\355\203\322A\351\240\001\235\360\250\224\205\314Zf\205\302 \007\023)c\016\251\232\231M@\002\363\025"
+	.string	" 84\030\216\207T]\327\265\003\024\200\021R\300~x8\252\216\224,\213\024D\004D\004"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\b"
+	.string	""
+	.string	"q]\247O2\003\301\265s\213\030-'=\3202\254\"\373L\252\027fN\001\204[xN\226\244{\210\316\360\223MqJ;a\207\227\306!\310\365\263\203\232O_"
+	.ascii	"\f\254\305\367\032#\003bb\311\2474n\003 }~\203\274\217\227\006"
+	.ascii	"\262M\240\346!\317\334\006\266\263\2304\017\"\212\nq\031\023"
+	.ascii	"\200\247{\255\361\351\013\235z\332\337~\021\215\311+\327\220"
+	.ascii	"\022O\303\351wH \003\204F\2524k!\331:\274\350\271q\b>\267*D\036"
+	.ascii	"(U\013\3338\222\226\246'\261\177 \3122\355jy4\351<\315*\177W"
+	.ascii	"\374\244\216\246\232\316\247\033\027\336\365\032\241\212\206"
+	.ascii	"\213O\371@51\245\344-(:\375G\2244\303WJ\216H\336r\373\272\036"
+	.ascii	"\236\256\347D\b(e,~9\242g\324R\307\224C\200\3034j\004%[\252\f"
+	.ascii	"\255\035\321 \t4\256\2153\n,\306\231\304\263+\314\306\316d\017"
+	.ascii	"\321\253\335\267U!t\337\347\270F\341\225\241c\204\333=\001\205"
+	.ascii	"\256\233s\261,\020\265\221\236\200z\t\224\266\312\356\201\374"
+	.ascii	"F\306 \n\310\006\005\256\333\332Y\032\027\225plS\271]P@\301y"
+	.ascii	"\203\200\244\230C_\310Gz\214f\236>h\267\031\006\341L\356\274"
+	.ascii	"/]\252\370\230:\354\372\2155_\314\024\330n\211\316H\317\250g"
+	.ascii	"\372\006\323\246(D\351\373\003&9c\"\345\253\227\330\371V\372"
+	.ascii	"\360u\367\203\274\266\327\317\366\373\205V~\263\027\333\334\367"
+	.ascii	"\214\271\237\257:K\361k\247\360\0313\243LXhu6\022A5\236\376\204"
+	.ascii	"\334\374\003'\342\356\356\255*W\245\024|\336\n\223\036\037L\265"
+	.ascii	"\023\022"
+	.string	"\031\315x\200\364\256z\254L\255Xx\3113/\201T\311\235\316i\037]\227\032\004\214\336[\256>=\266\342\344%\326\315z=\207z\357\353\237\227\251e\bN\357\262prmUW\246>\002\322\240\335+\275\314\213 ,\316\362\016\366B]XO\t\373\003\260W\320\314I\365M\220\031\324\251\333UI\026,\221\331\305F\323xY\037\372\353\356\271\002_\2003\347\267\243\203\345\030\360-T\026\201\024\026-\314`9tJt\177\360\375>1\272@\351\212\212\2421\225\236v\363d~\031\331DV*\214\2448/~\bNi\377\206\027\322q\352\007\r\301\374\267\335\031\247u\213\373\227\206\263\227\3735\365`\360Ve\264qj\312-e\332B'\302\310vQ\257h\254\371@\340S\341\b\221C\235\023\355\267\301=\275\f\327 \321\226\205;\2448\377\256\247\317j\007W\363>\2732\f\327\357&W r@wBu5j\351"
+	.string	"\250\024\354\333!\352\200\2410E*\""
+	.ascii	"E\331\360\214\234\005\331\250\333\356\237C\003D\230\025\266v"
+	.ascii	"\235\312\261F\343\236(\006\022\330R\005\201tCK8X>:\251}\025S"
+	.ascii	"&\302C\314+^+\031\216\026x \324\035&\210\236^\365\323\255`A\352"
+	.ascii	"t\222;f\313N\347\306\230\271<\326(_\242\263<\304*\372+\236\025"
+	.ascii	"\233~<\025\250\t/\304\356\2515G \214"
+	.ascii	">\3051\322\213N&\316\020\026w{\321\354b\2579\001\257\034X\022"
+	.ascii	"\220|\240\035\206\343\020\215D\026{\267\226E\217\230?\323\312"
+	.ascii	"W\267\301\244?2,\255\032\224\312\036'\221\371\005\332)\004\034"
+	.ascii	"n6\016\3658\203\036+Hx\375\313\b\266\260|\260\366W\005\236\001"
+	.ascii	"\211\034.\246V\355P=\002E\262\2555\022\324n\320\2029u\2343\220"
+	.ascii	"c~\0041k\t\215e\027s\356rH\206\237\322\273/)l\353\205C\022X\216"
+	.ascii	"H\300\214\222\314\252^K\025\333\227\322\336\234g\016\322:B+\220"
+	.ascii	"W84\304\224I\002\2576\023\230\343\311xS\262\3563\036zL\341\237"
+	.ascii	"\235\347\2641F\330)\b\351\202L\f\034"
+	.string	"B\273K\037\016\274K2\376\n&G\006\310\376\251\312\300C\362f\203z\303\370\002\360m\td\332\331\373nU\232[\254\345Q\242\203\263wO\357gk\003\255\203\021\370\215\201\356\345\216\004\213\241\336\261\200;J\276\240'\260\330\371:\316\263\352s>\016\363\275\213\333f\321\n\356\221\370+'\3067\361\376j\325\013\354m\017\277&$$F<\017\260(o\375\353\365\370\256\031\323\300\340@\302\336.\201\271\357~\215\213@\311\324{\032\3158\r\253\256\016\347~\203\020\210#\353\213\242\326S\021;y\036\"I\323\212\005s+\240N\2774\004\276\016~\016gB\302\343]\353Hh\020\342Rfn\377vu\367$\261x\030ZZX\277\r\202\200\004P\335gz\f\306\362\030\276\265-\022\330,\251\223 Vx\224\f\241\273#\337v\356r\001\202zQ#\273V\003\213\027\004\277e\241\246\331\376\3523\342re\200\335\206\024\305"
+	.string	"\321\242v|\001\310,\371%\261\034\224TR\374*+\301\336\267(\225\331N~\313,\262\004\352f\204IfD\037$\0056\306\223NJ\324\ng\224\3139\322\261\024\27750\331N\325.\324\232si\314\332v\261\3003%\357C\n\347\277R\246?\373\trl+/\301F\303f\244\237\301\301J\247\254\302\030\355f\256\216l\366\200\232I[\0346\370\330'\261\374P\020\225'\307Y&\323\007I\300c\362\265\364om\302\372\315d\003\313\006\017\203\035\321\305\243\343\0208n\232\310\254\327\034]X\247h\023.\261e\274\004\236\207\206h\032\231`\220F\"\343\001\215"
+	.string	"$\224\320?$\022\225b\273\253=\231\2530\027\201\353>\336W\004\346s\251.\371\222E= 1\245\264\252\352y\212\200\343\324\025\341\346;]\375\242\304\246ri\370\303??\271\"V\340v\033\210o5\223_3e\204\242DM\326Zd\203\200\315v}q\b\037\367\327\314\304\fy\007\374N\3518Nl\367\255\240\234\351>\2135="
+	.string	"\242I\207\030}\336o\275\231\004k"
+	.string	"\256\311\200\232\032\035\202t\221a\243\315\005Q\232\233&\361\222\346\003a\337\013\005\360\007eq\351\337\026[\313\234R\345\351WUzCE&z\253]\002\305\371\315\b\301N&\264L\t\005\376\320\225\304T\253I\311\237ts\005\200z\2416\247\300\326\301cQ\355\262[\224\244b\021\240\311K\023#\031=C\236\372\265\2543S"
+	.string	"\246\334m\232\212\262\202\314\241F\2415\303tl\242\"2R\032\371\200\007S\0162d\355\317\240\233u6\220\364\242\227\365*\275\214r\357\030\021"
+	.string	")pg\311\230}<Q\215+\356%C\031\236\r\347\323\335'8\377\rd\037\243X\t\371\024\302p\020\275\335\215\007:\021\030`\024\240\227\333ka \024\323\214f\"\233K\001\216<\366P\371\034P\214\324\307q\372N\327\206U\210\034\276@\367\214\013\224\310W\301b\310\331\006\\\205E\223=\025.`\0040Z\024\276T\213\363\220\254;P~w\234\246v\253X\265\006\354\335\365O\277(\2472$y\3421\352\313x\013\242\310\320\376\3113i\263\024\026\332\022\372\003\335y\0218#\333\376\306Pk\247-\004B\240 *\221\336\357\033\r\007\3577=\325\225\006\b\020AF\264\316\301e\223\252\004\"\245\244E\252\325:\241L\371\225*Ja.>\013\3334"
+	.ascii	"!\327\356D(\341O\327\036\304w{\350v\263<w|'\300ML\342\262\206"
+	.ascii	"\352I\2036\n\362T\ns\304\213\241\246\233U\320sR\361\024\035\307"
+	.ascii	"\355\275\035\257\304\333\3042%\001-\037\222\236\213d%\300\326"
+	.ascii	"^\020z\355\021=/FtG0\016T\241\243U\007\267\323\307\201\350y>"
+	.ascii	"v{\f\351\302\321\030(\262\3306V"
+	.string	"s\361MMt\277/\265\304\355\266\341\354\023Z\231!Q=\324\372f\206\025\016\377\3438\342e\002a\214\270J\200\354-\034\334\364e`\224\006\231\243\264\277\231b\262g\317\326Xc\210\343z,\317\203\256\365)\316\235v\321\030b\247\345\242\270\331\212\373\370\016\036\365\234b|\\A\312\246\201\312 \244\233\327\223\334Uz\3138Bo\306\023\371\204\034\371\204&\034\375v\3522\325\252\216jbx\006\"\337\235\225\007EY\370\352`\352\345\002e\035\013\361\211\237\372hk\230\270:\324\237\302\257\237\267\232\310\260\302\271\314\3146\312\320\213\232\335\002\345\361\341bMv1\214\303\220^{\035(\271j\211\226\273\202\263\243K\233e\327R\372\241,0\372\332\236%\325\016\006\b\376\3002\316\331\232\021_<\205\203;\253\356E\330\034x\202\367\310n\237\272\017\274\253\"Y\354o\025J>G$\016\301\007)\322\223\027\205\003\270\254\356"
+	.string	"\r\241\271Z\231\300B\243\314\025\272 e\032{\363\206\303\241\231\372\016\017\266\267t'\"`\022\217\322\264\244\023\345\333\276\354\211"
+	.string	"\307:'\265\035Y<D\344\322\225$=3r\347\262R\005T8*+\352\230F\345"
+	.string	"\333\n"
+	.string	"\335\214E\273\277\365\r\005$\017\370QH&^R\353\006I\322!\004\245{C\030\340\223\r\275\005\313\3317\301\224+\023\272\202\324\363\307wmS\274\312\331\032\217V\351\352\202\025\300"
+	.ascii	"\260\273&\236\221\316\021\331\251\031$t\3663E\311\005\377\024"
+	.ascii	"\212u\321\224\253\217uop\337\337C\031kZ"
+	.string	"o\3114l\320\313\226NT\210\204\211M\360\277\360\303\224\247\273\332\314\202Vpc\246\330\347\222\022\013\356\313\365\033V\240\323C]B\235)JT\344 \253\377\026\b5\314\337\340\b~@\301*l\027i\245\270\306\311\306\246\257tlkyS\363\304\336$\330\233\370\245A\256\361u\365*\256\343\t[\362\314\227\367\237\335\022\007\214\211C\032>\036\f\325\226y\330\245T{2h\225\242\357.\226)\376\213\321\227\351\f\037I\207\034\371\301\225\0015\245\310\2352x\024\005\n\206]\320\262\264\007\371z(v~a\221\2712g\351d\263\344\343\026\022\336\036\231\f@\326\b\252\377\267\001a\026\316Kj\314\337+.\031\263\367(\366\326\350'\244Vl\246\323\263\032\272C )8\232\226\343Y\353\202\272\016\022\201\224|}\320=\035\267\3500\307\305\301\034\253vs\232\001j\204~\026c!\342A\252\330\235\275*\2766/\273\220"
+	.ascii	"\005\336\033\216\316\206,\205\374\272\210\253iT3S\3716Yz|w/\007"
+	.ascii	"\207\341\220\273\021\312\210z\371=\215\227w\371ZEB\271\027\177"
+	.ascii	"\357(`@\347\354U\b\205n\2613\362S\253Er\277\f\363C:\264\273\252"
+	.ascii	"\313\207( \320\350\366\337/\r\022u\203 \36185\204\247\"\f\241"
+	.ascii	"\302\265%\376\206\313\245\331Bu\245\275\361\251\241\344\027y"
+	.ascii	"\277Q\220@L\322>\346\340\fut\177\213\r"
+	.string	"\346\371*G\2500\361\221\373w\232\321\223]\206\001.gg^\272\332#H\326\022\034Y\340W\235M\361\301\263\350Xn\t\377Q\241\034(e\252\251\356oA\331q\214\313\311\322\325\n\243t{VJ8p\265\306Cq\257\1773\265;_M\001\372{\206\344o\375\201\334\006\242\003\252\364\301\034\035\253\3212\361U?\355\372\027z@VN:e\367\212\262\223\311\0043"
+	.string	"\205A\033\221P\374\026\232L\276\313\021\261^A\004\032G\354\327\323"
+	.ascii	"3\376\251X\361;"
+	.string	"\224Z4$\314\230#\231Y\242\264\201)\256\214\253\211\177\350\211\246\215\270[\322\337\330\251)b\331\376\315\003\240\311E\236\352]\354%d\375\322]\235E\370\261w\347[\247(\006\240\273c\032\227\244S\310\300\2630\222\270\254D\314\237\366\310\256\307\302\024\220Z:4IT;\nqg\"\020M\\\272\276\256\317\237\225T\304]\250\332.\321)\247\347\261\301\314)\336\362\tq{cu\300\377\274\337\336\305\355$\374\322\375\205\020\253\276&\266<\223\023\024~\005\r\220\243\363\317xi]\033\030gR\301$\203\304\336^\345\023%\225\303^\n\271Q\355\rY#xH\237\007\026\326\030\376<4\004\304\211\\\200\353\005\314\316\215\372\201v:\233\324|\235\034`#\241\207aM\035^\263g\005%/n\3663\003\347\365\247*\2134 \215\231\254\243l\205\267\013\276F^E\336\322\214\241\030\247h\261\356\200\323\320\222\341\244\273\313"
+	.string	"\262k\271|\261\232J\366H\365Y@~\271y,\0313Dne@5qmC\246\331\251\252B\342\0253\f\017\300\333h\342j\007\277V\255*"
+	.ascii	"\232L\2456\304l@\002D~\022\255\375\005\200\350\234\\\224\320"
+	.ascii	"u'\326`\340\210\027s\207\002\253\313\320Z1d\262\377\361Y\237"
+	.ascii	"V\362\017\214\216\004n;\036H\321q\n3^\262\227\025p\225\224\375"
+	.ascii	"@%l\320\001q8j\200\264\003\263\371\025\210\245\215.0\263ez\367"
+	.ascii	"<\307\237\376\225QA\355'd\304\343f\306\371\f\013\214\273\353"
+	.ascii	"\315\335\302\022\310\211\305~\013\222\272\305N\270@\027,\354"
+	.ascii	"\002\254|J\353Sqz\233\316\200rZ\222 \210\032!7\254\244\220\330"
+	.ascii	"\341\320(\001\305}\203q\212\rvr\271\257\371d\264b\354\372\367"
+	.ascii	"0R\020\212^3t\252\003\352&\205_\034\364|C\276\314\301\217\236"
+	.ascii	"\020K\305\353\327\002y\356\3539$\021\357\343\242\035E\354\342"
+	.ascii	"^+,\300.\310T\320f\332\005D\247\223\242\335n\211\003\016\247"
+	.ascii	"\222`w\212\261*\273M\202LV~\037~$[\210b\034\253\320x r\332\b"
+	.ascii	"\364\220Y\356v\346zSM\307\311\303b\037\274\371\214Z\334u\360"
+	.ascii	"\215\307\335-Q3\303\r\377!\354I\250\367\206,\304W\217,\323\375"
+	.ascii	"\3467])@\326\342\255T\357\253{\0068\252\360\200\371\323\213\020"
+	.ascii	"@\3742\355\013\256\252\365\306\335\032\003\233\016\301Q\016\b"
+	.ascii	"\332\3351\022\263\213N^\375?\240/\2546\244\027\225\211M\322\233"
+	.ascii	"\232\306\233\3762<\211\211\031\344GbN=\235\341\310\320J\277w"
+	.ascii	"\333\252\270\016\354\f\304\241\225\2468L_B\272\203\304'\031\210"
+	.ascii	"\211\b\252\211nV\325^_-\346\331\f-\\L\25014\214\016!c\356\004"
+	.ascii	"%\377P\256\340\226*\261\237L~j;\350\323\343T6#\314\240_\232\204"
+	.ascii	"GB\371\362@\274\350\221\342\275\037\346\234\213\004\2023\007"
+	.ascii	"B\375\251\305~\331\241\213\031i'\202\350\354s\213KI\235l\361"
+	.ascii	"\367#\227\361\370bx:\006\204RI\312$\337}Gz9^\205\332F\246$\225"
+	.ascii	"\321\226%\304X\034\312\201\020\240Ta\2538F\003\261\332\222\243"
+	.ascii	"\2225\\\203\374\003\276y\2756K\257\b\240\2761\361\313}\027]E"
+	.ascii	"v\270\373]\246Wi\304c\366!Qg\254E\275G\3424\023)D\273\351\256"
+	.ascii	"\345C\342\336\315\332\340\360D{\335\235A\031H\355\3346\304:\032"
+	.ascii	"\325\213\243\033\027,\347\216{\317\346t\016\206:\230\264!\310"
+	.ascii	"\212\2504\233\256u\373\360\272\263\017;\032P,@\002@\204\230\034"
+	.ascii	"\343?\311\235?\023m2\305\016\335\244\3015\260\221x\006\241\330"
+	.ascii	"}\3615\346\2420\230cx\031N\0350\345|\373\013\333\316\021\231"
+	.ascii	"q>?M\274t[=P\237\202\276!\206E\356\325#\301K\037zL\377\236\246"
+	.ascii	"&\363~^X\273\220\001\204 \317\0045%,\365\220\2275~ki\273B\275"
+	.ascii	"x\244\325d\221\237\366o\\\r\3265\264\270at0 \365\n\023\030dw"
+	.ascii	"\314\241\362\207\334ea]1\177?\243\017\200\266\230xp-j6\321v5"
+	.ascii	"\325\266\275\277\220\036\307~\200\211\267eY%\215\016\210\026"
+	.ascii	"\275\317\376\224\356\366\375\002q\371\254\253\246\277\004\324"
+	.ascii	"\331e\034UtU^|78\227\024\330\333L_\341rj\206y\271\210\306\023"
+	.ascii	"e\310Y\244\031'\351\236`\345?\006h\275\0309|:\310\\\023\340\013"
+	.ascii	"\021\376\263\254Xb.J\031\231\333 A8\362\0049\016\210\036Y\304"
+	.ascii	"\243\001je\362\256\217\002v\300 \372\024\213\274\f\275\200\273"
+	.ascii	"\203\316:\270\300\2578\330k\244\263d\356\305^\271\340V\250\346"
+	.ascii	"G\252@\221\342D\347V\027\364\340\002S<"
+	.string	"9`\325\331\344\231\234\302\351\215V\nVGD\317\351\0078\221\232\227<\207\334'\3509QswyT\310\263e8doa(c\213\213T\376@\253~\333\326\013\371\276\\\304$9F091)>4R\305rl=\250a\366\222j'.y\350\370\016\362I\317=T\360h\253\031\027\025f\223\353%\215\016\302\333\246\234S&e\262a\312R\346;\240\022^\212N\021\311\1774\006\215(\327\375xj\331^]\004\321\363\242\3278tVi\313\304\2320\205U\271\340\243\r>\217[kp\314_\306\270\300\217\252\202\022\261G\0135\330\224n,\025\236\2412\004\260\020\024\213\330\3014u\203N\333\035\377\026\244\n\306\256v]\266\332>N\002\232gj\243\277\326\034v\254N\273&4\357\025^\240u\324\027\225\005\201\330t\204\302HN\336\201<\332\365<\316\322\354\272\213b\177\245\"\305u\247R\302\357\252\314\367_F"
+	.string	"\002\2328\222\034\240W8\265\005v\211\303\336\b\021)z0\t#qx\220\007\221\346(\232\332y|\253\255=/;r`2W[Hm\201;\216H\002\310\332?A\207\300\340@\2607\231\323\223S\220@\270\236Y~h\002\351\300=l%\270\271\242\005\2619\306\213\216'+\0317\"Fi9m@\343\335\242\025\210\003\340\2664\277\224I$\256\373\323\246\031d\021Vs\213\307\335*\242F\026\315a\0262\323"
+	.string	"\344\2244\272g"
+	.string	"\310\341\201\206\257\325O\203\330^j\212\304e\347\215\361\274\316\204#\312k\313&f\216B\202\221\311?\275\272ER\"\320\343\004\276\222\007-\217\210\257(\327\017\233c\n\002>o\231\322\221"
+	.string	"-m\"}\342#\3720F\r\201\237E\272+I\321$\247\222w\346\373uM\3202K\264}l\024\327\b\215\333\270\261CX\356\200\361^"
+	.string	"\257G\216\264R\016\311\241\232\323\227\374`;\326\006\270}\263'\002\003\236e\356"
+	.ascii	"\260\233\241\340\341\352\313,\240\223:\376\356 \251,\316Z\347"
+	.ascii	",\245.A\215(\267u[\363\210\226\"M\b\177Yq)u\266\217\363NZ\351"
+	.ascii	"\013\2750\307S\350\353 a\0258\315G\3569\3153\256\"}\223\200J"
+	.ascii	"\307n\354\246774\rb\2776-\202\001&\364\376\262\252m\340"
+	.string	"\243?"
+	.ascii	"N\246v\n\023H\227\201\310s\251\240$\323\303I\203\273\242\355"
+	.ascii	"i\242[\3304w\253*\373\341\264\321Y3x\026\016\324A\264s\355\315"
+	.ascii	"\315\352]\244@\303\274\304\247"
+	.string	"\271\\K\034\350\316\276b\376+w\227\275\3323V\"\225\037Q\215]\306:\020\276\b1\256\277\013\233\206\341\257\211P9\352\337\207yLh\220i\271\177\022\026y\026\211\332-\200\353\205\234\230\232%\005\"\271;\223\362\262\026\356{\366M\267Y\2438 \2157c\326\013p\376\n\247\231\242PG\255\315#.\374\313\362z\363:\203]\017`|3\025\346A\n\330\223\363\306\336\200\366\356,F\300\266\325H~A\\\306\3626N\307\"\nP\013\006\374.\340C9\243_\365\217\245'fy2\334-\335\003\363*\342n\2177T\326\336I\\i\243\306\323@I\327\006\227\021\277B=\0355\020yF2\276\233\013\230\314\364@\34453\005\205\334\006?\227~\23085\035\262\027\357\214zJ~\025\273\235=7\251\361\022\034\231U\212\221\003\f)\257!\376\247.\226\214J\2710\366\207i\246@\275%\363\323\203%v\343\307\247"
+	.string	":H`\005)\371\266\001L\257\005\337\205+l\261\243lM\035\240\345\200b\367+p\356(\205|H\0347\235\347\033&\247p\213+&\377\302Vw$\216*V\256\001\354\340$\260\324l\211"
+	.string	"J7\017\201!6\220\377\001k\315\307'\026\336~\r\204iA\203h\307<i\236V\225\343\017|\344\350\334\312\315\251\242\336E\005\001\004\265&Z\252\356E\272Y\253hjN\025\212\026\035\013\214\034\342\024F\374\237"
+	.ascii	"<n\271\0179\356}\333yO\356\276#'\244\210\013\354\265@\272,|\024"
+	.ascii	"\021\347Bt\310P\253\247\224\2218\362\261X>\246\327^\251\020N"
+	.ascii	"F\314\225\026\363\234D+a\302\347\362\375\"\263O<\302\235\214"
+	.ascii	"\241\223S/:)\255\326b)`J\234\213J\210\224\245\f\256\252L\t\316"
+	.ascii	"\341\321\304\3156\016\273z4\031\323\217`D\201\302I\357\242\374"
+	.ascii	"\025\317\205|k\204\267\212\3246\232S\221\022\330\225\004\242"
+	.string	"\245J#\030$t\302^\370\243\352\205'\256e\365\205p\304%\346\rk\344\177\233\021O\303\357\312\244[f\272\027\2143l\261\024S\007.g{B(M\336eb\263-[\007R \3425\366B\256\357\225\353X\376l\013Z\r\306x\212\tw2\"\3560\277\300C\030\320\306\276\007\321z\202v,y\376\231\235]\\\242Lx!\262y\260d\006b\326\243\352\035\022)\315\313\222\304\212\331\261yL\231\253\f\254\371\325\346\355}\360\021>\037\311\362e\312\fA\272tT\031\216\241\017\223\274\022\"\350\001|\001\203\031\375\021\325\245\325C\215\250b\234Z]4c\365o\272\034[0>\220\256+c\3619\256\231\307\242\355E%\335I\375;\210\033\260\032\204)\035\357\217\300\3475\362\363\035\246\335`\222\314pC\247\032y\200\325\206I\345\272%8\225\354-\203\006\237QO\020wQ-\221\310\242\177\033\177\314\346nlZC"
+	.string	"MO\330b\250\335t\275qZ\361\365/\321\343\246\037M\2313n\3138\313\003\350%$:]\f'\341Oq\332\343\322\b\007\233VT~\353\227\341S{\037+\r\367+\244$\361Id\177\236\334}8r\274\371\332 \374\332\321\323"
+	.string	"+\347\3659F?\236\230\316\203\006\201\220\236\240\251A\375\361T\226\332\213\030\305\302\300\310A(\257B\351\003\212\020\213\344\351\225\215\25661\375\215<AA\333\307\272\024I\220\246\344n\013\213b\323\360\274J\224\213\331Y\371\242\216\274\005\241?\357\302W\360\352\367\234\273\310\353j\364\205W(\222|\360\007\341ti\023\276`\035\333s:\213\257}&\0260\313\276\207\n\277\016\252\320\016\307>y\334\3243z3kT$\250 \243\265\262\254\205\2267 \232\243&i\372mJ#1$\247\370@U\360V\256\"\345\353>\233\342\200\371o-\234\234v\255\270\361\202I9\372\262\377\272\203\371\340V@H\225=\033\324"
+	.ascii	"\322qk\r3\210\024&\177\037\371q\367\031\363z\231\341\305\351"
+	.ascii	"\3633#\337y7$\3559k\216\251=\343\321^0&9\343\314\275;\2060\300"
+	.ascii	"l\336\222\330\027\331\320\353f!h\225%\211\035\327A\204\342h\251"
+	.ascii	"|\r\206vl#&a\013]\366N\352M\213\323z\233\350\213\303\233a\261"
+	.ascii	"H\343\340:&\230\217\323:\342n\3665\237\373OJU\365\207\225\177"
+	.ascii	"\r/!i\276k\277\265\336#N\250\306_=\345\242\013\340\326\224\364"
+	.ascii	"\3676\320\227KMu\237.t\001\230\"\230\272|\236\372H\314R\3732"
+	.ascii	"\303\251\005\026H\266\333\347\\h"
+	.string	"\242\270\363\337\342T\330l\205\303\241\273\313\206,:\214\212\321\304v\341E\302\307\253\3359\b\022A\277\254\265\350\362\333\313C\200\245\201\240\224\027F\224@\216O\343oM\024V\364[a(`\345\371\032V\331P\036\f\377q\314\366]\263\317U+\210\225\275\337+\035W\036E\300X\341\363\2044)\nzL\363\347\271m\210h\031w\235\254\335PF\367\310)l}\021+\317\260d\003\213V\037T-\276{\t\245\353.\352\203\"a\267\203%\236\273h%\231\005\021D\272A5\365\275& \332\"4\bE\r\330\031\200\360R\367\253\264b\252 \366\267Bo\371\n\363[\247K\340\025\231\240\222gHa\245.h\304\203\036\006~\235\301p\"q\277\037L\214\325?\373\031E\336\313\344\277\342V\212\302@2\"9\225\304e\367\316s\236j\223\357\206D\034d\236\275\230\023\316'G\231`W\033\272\\pK\245-}\322N"
+	.string	"\252\305\371>\350\211\333\335:\352\024NR\200X\304\360\3609(?\375\264\f\351 _\215\376\177\353S\275j\346\264\226\210x\354h\006\355\310\355\246\266\203\2227\375\223\325\001\007\261\256\270\307p\226\033\223\324a\310\341Q\034\276\274eZe\237\324|Ee\306@\241\307\201\325\327\243\303\261\230\250\370A)g\364\323\322P\212\335\002\214\001\364\"Vk\023\022q=\016\365\314\246\2440\330Z\227\217"
+	.string	"\344\267\236\265\030\250\3014[\313\214\332\302B\306MR\321\005\217\021F\3433\002\345\256X5\200\034\004\314\234\240}\266\3551HU\213\351\270v\334\305y\260Io\364\235\033\373\216\303\026\375\251\337\342\210\037O\377\3713KAw\003\347\205\377R\023\323\021\335\303\312\252\253\247U\222b9:\204<[\365m\266@\2552\230\360I\311\312\315\325\361\215Vjm\272\254\201\342y\026\251\226^!\304\325A\236Yod\215I3\261\301Yd87\022\023@\204\216-\345\214\201\227*\3102\002n\251\362.4\213"
+	.ascii	"z\264\373\236\214\265\004\200\022I\350\265\033\236\236xZp\002"
+	.ascii	"\215\371#\353,\203\322RM\215\363\021h\001p\307\213\272\0260J"
+	.ascii	"\t\254bD\320K\260\027DO\222\255\331\222\264R\0077@\204\026\216"
+	.ascii	"\213w\202\270\023\2235y\2405\256\327J\235\246B\214\335\215Y\240"
+	.ascii	"\274\023\313\003\300k\201$mT\335@\303\352\311\355C\216\254\f"
+	.ascii	"`E\257\024P\270\263&L0\025\030\242\2362/\233\273d\253\207\304"
+	.ascii	"`\t\2273\036\303\366\314\026}-\323\315b:\242\232H\t)\260,\t\376"
+	.ascii	"\262\300\326\361f\314\022U\210\372\307\177\217\"!\373mf\037\374"
+	.ascii	"_\342\024*h\232\024B\250O\023\247oO\020\025V\252\311\311\031"
+	.ascii	"\235\204\360r\320i\f\375\326\207\253\013\204"
+	.ascii	"\201\035\216\236U`\002}\374\203\317\020\b\230\342\352\364\231"
+	.ascii	"|9+$\3532\320O\004\223tm\304g,\276\251\021\017\020\201\026\217"
+	.ascii	"\2346\"\324#\350\2603\210b\350}\021\204\2110U\325z\201\215\\"
+	.ascii	"\\(\002\223\320\304\226\306\r\301\274\245\n \253\273\211Q\034"
+	.ascii	"\254m_v\344\362\220\264\324\327\"\323\244\317\024\314`\315\373"
+	.ascii	"\247X\255\237\325\361\300\366\035\274^@-\030@\257\261\357\"\305"
+	.ascii	"b\221\240\277!S\310\370\2633\322h\246\037qK\\\375\004\242F\342"
+	.ascii	"\346}\na%\027\270Z\211\"\f\216??\305\030 W\376\314\261\270\356"
+	.ascii	"\255\211\236\333+Ta{U0\360ln\366X\336\351'\324\016\344#\036\026"
+	.ascii	"\251\210\016\315T\327\b\006@Q\302\216"
+	.string	"\242\2424\013\t\351E\2133\262\030\r\236\300\361\365\352/G\252ps\223\272G\327\353\2337G\340TK\275\234>\006<\230\264\t\223\226K}\375\244\224K\225\004\306\307\226\347\362\377\212\3640\241\273\343\300A@\276\2226t\022{\221\005\tF\320\227\334/\370u]\013q\247\005\007:\304\\\223\324U\013\357b\255\006\004\213\257\320\022\224\2736\026W\250\274\030\214'\372\305<[\243Z\f\200\231\247\273\327s_\200d\210\024w\247\274\235\bm\003>_\310V0\375\023\310\007\262\347\027\311V\026\274W\275&\237\267\216\313J\302=p\267\366x\353\215\325R\354y\320\251&\303r\344\020\305\357\313\266^e\216A\340\306R_\342\211\"!\374\316;\304\277't!6M5\314\260#\337\242Z\241L\200Y\342\375\002&\002\"+\"\202\367y\334\264\322l\365\314^\334i\255\236\033\321\337[\373\266<\223>\271[b\222D\346"
+	.string	"_\304Z4\0208\316r=\340\252\377\222l\214\252n\341\264kF,\230\271\207\273\324\203\356\305M\254\237\275\230 \225P\006\206V\364\003r$m\211\020\025*\2743\231Y\021\324\026q\b\326\253\246\310q\343\273{6\311\214\317\006\274\242[\222?\333\355\222"
+	.string	"\236L\244lhh\b\002o?J\311E\3209jI#\332o9]\256T\245X\237\323&T\216\355[z;r\313\006I\277C\033\217%\3464\260\363\273'\360"
+	.ascii	"m\242\207\245I\322T\bq ^\220`N\271S\246\263)g\334\017\262J_\326"
+	.ascii	"\260'\341(\213\263ri\2245N\247X\302Y\231<OUD\361\262N\317\333"
+	.ascii	"\374\031\231\027~\333\341\267l\315\204&{CV\366\230\005u4B\320"
+	.ascii	"\035\363\216\226\241\266\255\243\357\203\361^b-"
+	.string	"X5\247\242\177\327q#&\237\336\372\302\004;\3154DQ\337\221\037\273\261\242\277`\204\225\323\026\037-K\324\255\212m\373\211:\344Q|2\343\351lL \202\016\006\234\263\365v(\377\306\233\354\237\\\315\370\177\367I\030\372(\336`\367r/xPr\241\314\256\243\202\027\273\354r\300<q\340\372\r\035\330\3350\237r\034\262\245\322J\266\316\200\245\2603\3174\016\2332>1\225\"\002\364\322\317)\243\361\020\242o\305\234A?\304\225iw\311\020\226k\205\307\245\334\001\243K\013C\357\245A_pe\364Nkw*\334\016F\270y6\346\320@\007\315;\204Y\267q1y[k\227G\331i;\331\351)b\265\211\266\212 D\246\315\220\202\216s\t\344\373\252\206\330\001\203~\261VNw\222-\316\324\371\262\362\242\032\007\003\253\327\334\232Ik\236f\004=\214iB\030\255\265\\|T\312P;\355\310p\3112\220"
+	.ascii	"\016\0272\\\210(y\353\006\224q\001b\207~7\222M\330\362h\326\016"
+	.ascii	"S%\321\017\227\177D\263d\276\316\3456\277\3628\030\200M/"
+	.string	"\217\236\222\305u\023\r\243\220l\347C\356\346\254Wj\207\370\376\250\335\245\f>c$\314?p\302\030G\322%]\213R\265\250\340,\256\017\036\264\rg\277,=\376@}\002+s\224\rv\002A\0224\220[\221\243\327&\016C\243KC\321\245\333\313\n\354\330\312\031\024\342\262\360\027\367\027\274\215\370$\313+X,\372P\301\007\256\270\367hrF\313\370\362\037j\222h\025\316\205P\244\006\304\355\231\270\222\200\364y<\033\037\234l%\327\274\210\200\275\313v}\241_\203\264\260\203$\r\b\315s\332\226\252\235\304z\217\267\205\177i\206\021\037\356u\221\025?\2243J\0203\354m\033\3276Qp\275V\272\201\352\366)\224\307\267q\013\242\203\0207B\307l\3462b[\025\007\231z\305\347]\276\201pZ\361\220\201G\024%\231\r\343!\344n\310)\321-\362C\275\360J\377\023TL\215\002a\026\321\200\217\207\002\013\023"
+	.ascii	"\333A\346-\343\\0\211\210XU\212uqi\035!\263\307\252r\351<\002"
+	.ascii	"\232Y\372\2048\271\254\270\224\251j\2734#\354\303[\370\200RQ"
+	.ascii	"\3228\023\346\277\207\313\013ONH&B\327K\363pW\331!\310\367\327"
+	.ascii	"\374\303\r \004\202}\325\266\275t\314p\317sM\222P\"\257\0043"
+	.ascii	"A\212\007\207YV\361\245\373<\r\221\023CB\313\364\301u\00229\324"
+	.ascii	"\372\342/\004\265\313\200\267\347\276\340VY\333\022\305\314\313"
+	.ascii	"\275\335H@\234\373\371E\231\212\327'\\\213{\225t\235\367\030"
+	.ascii	"\"\247Z\340\351\253\035.\342\231\300d\206\033\313g\0324\177{"
+	.ascii	"\005\022\315.\317\t\007/o\216I8\214\"/\330fW\215\377D\2102\334"
+	.ascii	"+pL1\355\030y'\276qFA\277\315x\372\276\374\300\222!x7@\366.W"
+	.ascii	"\352\033\031\3607wY\314\251\\\037\365i\2634`\254\361N4\207B\221"
+	.ascii	"\312\032\213\242B\207l\nf5Y\0060\003\331\260U6\210%$\241\262"
+	.ascii	"[\272\274\223\343\023\232\003\002\206\3343f\320\311\347\2279"
+	.ascii	"sQ\342_\331e\366\205{m\022z\245\2759\375\007\273\320\271e\243"
+	.ascii	"\334\277g\b\333\364\356\2430\240\205\336\271$)\013\236\226\314"
+	.ascii	"\375%\313\005\321\371\035\210\210\263\253\300\031\316\260$\256"
+	.ascii	"\352x\277\376\351-j\216\322\316\370[\314\0261sY\333\351\353\262"
+	.ascii	"\274\017\001\266J\307\257`\212\244m\264\033\tv'\241\206\024\243"
+	.ascii	"\263\200\313\254\3420h\323\233\302\272\r\353E\367M\2153\234|"
+	.ascii	"s\322\033\362\334w/\t%\213\255\262\r\007@\202\315\3443(\271\315"
+	.ascii	"\266\002\013\032O\247\335\204\320s\023\245\263 G\376\300\376"
+	.ascii	"w\231\211\005\352\004(\300o\005\020\035\266w\034\364O9lL\207"
+	.ascii	"\271s\215#i,\3508\326#1\260\221\2015\f\370K\314\031\333\347 "
+	.ascii	"\214u+\216\346/\025\234\245n\310\240\022\240\b\331\354\202\016"
+	.ascii	"L}\001>d\373aW\235A\017Z\223\271\320\211\255\355\360\343\375"
+	.ascii	"\235&!B\263\214\341<- \346\177F*\255\264\323F.\360\362\013^\237"
+	.ascii	"G\013\216\325f:\033\220\333\350h4t\214\316s\315\235\273\020/"
+	.ascii	"\214r\r\342\026\200\214Z\207NU{Et\201\032\235xUf\017\312\227"
+	.ascii	"\277\244\2314\034\256\272](VoU\272\364Uz\312\342\262!4rE\030"
+	.ascii	"\215\354\216\025\034\215\370\267\037\357]E\330\233f\037\234\250"
+	.ascii	"\246\352\016-D\013\222?\370\264Y\231U\273\364Y\177\017>\324|"
+	.ascii	"\246\261c3\210\224d\305Z\307\026\fx\274v\001\210!\036\345F\370"
+	.ascii	"w2Z\361\343T\244Ok\023\036\024\0241F$\020\345\2200*\221\370\322"
+	.ascii	"\"/\321o\353\340Y>^lh2\"\370\367|\224\237\351\313\205\276!\020"
+	.ascii	"\311S\f\230\354:\213\030y\\L\373\206Ba\356\347\364\025h{\275"
+	.ascii	"vp\2759O\336\233\005-\365T\354"
+	.string	"3(&\202\353k\332z\347\214r\005\251G\325n\330DT\006f\264\233\326\333\233lW\312Lt]\326\204\262\222E\220\206\002\374E\034\372M\033\0369\254\2705lI\210\2477u3\035\r{\032\247\304t%\226#\265f\320O4J\257?\016/F&#\274I'\"0\370!\026\353\036\003\032V\fV\235X\2045\315\356\351\245]\222\344\002/\254\235\002o\264\364\3740 \033\356\253\203\034x c\nD\202\260\020(D\201\270\030r\177~+\020!N\006\320"
+	.ascii	"!M\214<W\371\333H\033\025\366\331\030\205\204\"\372F\265#\301"
+	.ascii	"P\200\361\373\255\346\365\264\032\216\237\230\312ZVp\276?\262"
+	.ascii	"[\337\201BoO)\3012V\351e\216B\004\367\034\377\326 \347\312\315"
+	.ascii	"{\304O\370\276\b\304\237Fe\216\\\322{\255\220\352\221\177\247"
+	.ascii	"\272\3208\213\305\316 ![\365\241\360\005\270\034\0068`\265\351"
+	.ascii	"\033\232\224M\346\250\022\331i\320)\230!\227\362\203\326\247"
+	.ascii	"0\0374\277\214,\233\013\030\024\366\234\033&\251\346\306h\277"
+	.ascii	"\331F{\321\031\211\211\244\036l\223\370\026\034\021\304xj\003"
+	.ascii	"S5q\016\375\267\235b\304\260\276\0308p|\246\254xz\"TV\331H\225"
+	.ascii	"E\021!\260\035\237ec=\036$\215\213i\273\223\316\334\221\324\006"
+	.ascii	"\003\026l\250U^>`\222r\262\337\206\007\204y\275\344\272C\265"
+	.ascii	"0\220\007\251\261hy\373"
+	.string	"2\263\257Z\022dk\261~\350A\242\305\301M9pf\343\244\323m\331 C7\020b\f\340?\017\352\366\033Q\272e\313*\177\203Y\356\001;1\327J\r\2706\225\231\355\221\364\263\017\220\211\274?\016\376\f{\261<\305\245A\3758{\344\222\002H\335z\374\034h\331\371S;c\240E\225P\205\304\217sC\223E\212h\345\035\t\025\220hB\233\273\357o\353\233\025L\237\352\230\215\266P\216kr\322\272\272\201hn\304y&\024\2128\226c\003\027\037\245\205aiS&\213\242\021YEeI\025.J\325\335\215QQ\214\352\331\253\357s7\332\013\342\016\220\220\300cur\rY\312\033\201\21106\236\215\3420\006}\346\227\306\340\324\317y\372m\260\022d|V\300\3331\021)\212*\006\026'\037\204\253\371\376\340x5\022>\023\331B\006di@\350\255\235\202\006\321\233OJn\267\t4\203p\343\225/\337\262"
+	.ascii	"\311\371\002\276~w(\275\330u\\\230\013\372\005\264]\006\026\335"
+	.ascii	"\241\334'nl^r%kg@\020\200\223w\222\037SF\b\035p(RpY\030\240Y"
+	.ascii	"\240\322\224(/v;c\267TR\271a\347&\300\377\206\032-\r& \365J\021"
+	.ascii	"F=\341\207|64\202\350\fO\035\357F\025\246Y\214\335\262\031q\315"
+	.ascii	"}\031\025\214\257o\267\260\020&\013\272\342\274 z\037\315\321"
+	.ascii	"\023{\023\2657\261L(n\321\274c\332\223\267C9$\2666\202\3757-"
+	.ascii	"%\026\037Kz\225\334@\343!\362\200\261\323\003\311O\3610\"\204"
+	.ascii	"C\346\350F6\314\031\222<\020\037\201\006\356\212\027\337\210"
+	.ascii	"Ur\027;\374\266%\202\201\021N\0257?BO\355-\304\3117\024\302\301"
+	.ascii	"\367%\333\366\203uq;\244\365\365\245\243\227\002\315\006\302"
+	.ascii	"\232!\356T\2672\223\330A^&\240JaP\fC\3123Y\216\326\016\340$\023"
+	.ascii	"\005\203L\213\"d\303\3718\317\016\006j\b\371\264\351)B\020\002"
+	.ascii	"\347@3J\202C\201\246\r\252\304\231+`pz\201\310=\241\363\374\032"
+	.ascii	"\263z}`\374T\256\rg\023\335\321${\217\374A\207\240\365)\213\231"
+	.ascii	"\213\321&\031\222\315\232\020\245\343\256\377J\301\352\330\356"
+	.ascii	"V9\316\222((\330\211\225\"Jn\241(a\tsT\226?\372o\353|d>.\240"
+	.ascii	"\034x\035\246\377\036n\336\323\210u(\253\215\204 \310\371\237"
+	.ascii	"\227\230\361\f\013T\340\207\325\023\237P\366\374\311\305\304"
+	.ascii	"\333\321\226\200=\336\237\t\022"
+	.string	"$uzVgR`p\217lK\237\376\305\204\231\327n \020\003\266\001\251\365\211\006\370\356\274\300f\251\333p\025\351\221~(e\336\220$e\363\214~\307\271\230$o\235\311RE\326C\f\240~\022\343\370\374\336\204\342\367h[\261\3455\272\313i\332\216\376\274\321\022-\356W\316\250Q\302`V\336\343\237\35290\311\356\304\227\301\200\340\357-\372U$\r\214\242j[o\220p>\332'<\251\206\272>P\233pf\260\270O#\362\205\213{\r\207\210dO\212@\341\304\306\235\223\340\002\375\300\305>\274\373\004SkJ\235\322\034\270\355_\r\206\017\222\225\2030\320\220\007\270\3473h&\355\240\265\256\323\3619\231\37594\373\356\221\210\214\213\004\202\203\336\216\245\324\227\345\350\273\312\213\276\246\350\370fdh\232\032\220(\310`\226\034\376\206\024\007\250\200\207\313\202\034a\266\211\352\001\344\306u\343\225\005\300\233\360\324\310\315"
+	.string	"\361\265\227$7\275\246\332\333\016\322`\242{0\225\\-\371}{"
+	.string	"\270\013\234\310\261M\354,2\b\321i\034\023\241{\303\003\233\017\004\350\215\b\355\326\334\023)\314\313\373~^f\245\002\361\202\016t\235\344\023\3449\006,\004\271\031K\231\013\376\377\343T#7\277+\372\350\225Vj\315\357xV\260HRo\306/&\377\211_z\305aH\376\354S\006\222\224\337\326\351\350\317\020_\007\240\330\264\242aA\224\215\030\001\326@)U\264\023\275\271~\022#\031\333M\346\3251\224\020\332"
+	.ascii	"\025\230 \243\331\235)\n\177RU\3619\254r\331Gz%h@\021\321\250"
+	.ascii	"\231\005W%\275i\231\243\273\203cp\"\3531E\267r\177$WE\\\221\332"
+	.ascii	"\231\205\310J\323\337\304\345\320U\236\316\261\330S\202\250*"
+	.ascii	"4\202\224I\274`p|\224\203\222\246\364\351\275\214BF\b\340\240"
+	.ascii	"\350\036\r\034\306\254\\TSw\363\005\b[u\322\237\370\207\222\301"
+	.ascii	"\266\344\372\004\252}s!\320\243\374\201\267\031\302\333\356\301"
+	.ascii	"\217\033w\302F\366Q\211\233U\024\346\255\203\357\210\324\354"
+	.ascii	"\245\311)\320k\263\325\210a9\204\252vF\363\177"
+	.string	"r?\263E\340i%\227\223\232\016\216U\007\307P\270\213\373U\217T\313YD\341\253\270)UJIE\222\246{mA\023\374=\233\262\351m\t\"\016\0250\331\367\3547V,\2477^\316~\332\013@\310\361\261A\312mV\322\204T;EN\203\314\321\r\007\247B&\377B?\f=A\317\200#\220\033\346\202\216w\310\201\361\226\265jQ\233\365(}9\202j\275\361\275\261VN\334\370\bm\260\236\366?\362\177\n^a\3408-\r\270\270:\251\366~\f2\274\263\270\tP\316\0337\r\302\216\261\351Y\037X\025\315\270\355H\204\003\245C\002Y\373\313\260F\2368\372n\"S<UC\306\300H\202\243 \322;\206[\315q\302\001\342H\267d\260\303R2s\274\t\001\007\342K\235:\211{|\307\244\372\374\013t\272\036\250NDmr\b\224~\266(\357\363\027\365\273Y\271\237Dx\326b\332\317=\237b\3243"
+	.string	"\222r?+^3oD\332-|\214ES7\265\241d\b\373BaY\025|\203>AU/*\357\005\002\324\300\261\005\335\322\020\373T\327\225c\324-\246k\205\026\310\n\024N\271\360"
+	.ascii	"\236\024\022\262\007\004.r\223%t\277\240P\342\335\271\022/\030"
+	.ascii	"\177\357\310\030%F\017\206_\246Q\313K\253_\240\220y\345\n\234"
+	.ascii	"*\325\230e\316N\005\226\026D\337\212\235\317aF\035+R/+\313z-"
+	.ascii	"\301S\331PCfI"
+	.ascii	"\254Na\\\np\031\330r\3613\330\2633D\256\005\331\333N\005\001"
+	.ascii	"Q{\2717\221\216\220Y6\303\252J\275o\301*\021\217\001\275iHK\323"
+	.ascii	"\230\220\036+\b\336\177v8\370\017D\024\245\323]#\035\223\bx\004"
+	.ascii	"\372\301Y\377\223\206O\3361\352\225v\3524\264\366`\034\001B@"
+	.ascii	"\b\312;P\253\017\345\032^~\211:\263\352\367\016\213Z;i\177?\345"
+	.ascii	"T~\347\370\276\036\344\0048\260\262\006\273H\b\302\257$`\216"
+	.ascii	"N\032\321~,G\270\276c\210v\222L\2627\376\2671/S\0353\341f{T\255"
+	.ascii	"\221\336E\202G\005Hj\006\247\322\271M\261\335_\321\005\372\254"
+	.ascii	"\031X\363\204\312\034\236D'\n\223\250\264\3019\017f\347\265G"
+	.ascii	"\343E\026\235Y\353\210\027\234*\177\007\344\250\2544\bY\021~"
+	.ascii	"\210]\335\305\326\033\253\255\365\346}\0202\370\374c#\241{)\271"
+	.ascii	"\006\2140\355\250\3476PB-\254.\332\341b\364\220\301\253hC\266"
+	.ascii	"\0133\023\026\326A\035\205!\216hY19\002\b\337]3\016p\327\225"
+	.ascii	"q\240\036\037\242\360q\030\245\250y\322t\340\310\222\027d{\213"
+	.ascii	"/)~\"\343r34\303F"
+	.string	"\241\271\342\022\257\363\016 A\2604\254\327\b\336\247T\007\330\232L\261\263\350O\316\016\210\201(\252\267Y(\303\327\370CN\367]qjN\311i\024\244R\327\365\027\220;!S!\005\016\247\017\345o<\255cWEuXbz\375\216\005\203\244g\223tV\346\317E\333I\321\313\n{;\016\276\322\224f[\005\220<b\301\215\026\027(y\351K\301\333t\361:I\314cT\272\261\367\027J\221\024v\310\247\347\004\356I\\E\324\204>\022N\213\032\270\004\234\233\016\242\357?\335P\207\001\033,A:\253\352\007\326\214\025F\037\266\270\020?\240\263Xq\027mrS\234\376\320\002\361\310{g\247\237`G\344\035i7\007h\004\227\301U\270\202\202\266<\241N\252n\346\036\271I\227\321m\366\230I?\274\240\025\257\260\333F\211\031W\266*\330\200\232\233\037\204\232-\371\025\" \315\273\276\r@zw\205\274q\3615\177"
+	.string	"d\001\303Q+>"
+	.string	"J\314\345\274L\203\377F\273\3678\360\357g\206\377\227\206\357 qC\365\032\3519\317\350\311\016\310B\032\001\027"
+	.string	"\361B\005X\316\204c\374\006\004:r2\340&b>Sn\303?l\002A\360~\271@!:\020B\214\001\267\245m\367J\334<>C\361\320\246T\2461g\205\356+\254`\270\366\r\212Y\301Y\322\224\304\030D\342\002\327\205\270\361=!\377l\264\331.h\310\366\033\020\035J\031"
+	.string	"\231\204\352\266\327\006\353\316\231F\255\233\002\025r\313\272!\217\373?\304\271Fv{\n\006\254DU\304h\356\312h-\213^\b\216-\223\022\375\201-\273\354wC]gM4\274\300.\371\177\250h\217\226\226N,Xt\3747\264$\210OJ\343\177\013m2[\027\374\374]o\273\222\220\357\315~'AZ\024G\347\217K\n\207W/^\2167a\310\002\336\223\242c\006\f\220\251\253\251\037\325X\177JaZ\372.\245\375\223\316\241\233\237\352\372\320\213\316d\244\325\213\r\213\273\017\035\026\200"
+	.string	"\226\023I\350\250\350\216Z\237F\373As\371B\225$\225\363h>p\271\365\227eR,\270\277\023!\337<\372\347p\233\322\310\3551\254\355\nvI\017|W\216@I\371\\\224Qt\2161r\252\017Q\324\032W\351\267X \263\001&*\022\3708ZR\032\232\216\024\002\336o\351\0270\216\026\274n7\213\\\331\227\365\\K\\0/l\361H\324I\177U\023Q\341\206\254N\301\255\\\272\362$\210\210\210k`\321~\326s,P]\nH\330\203F\267\206\3774\030o\321zy\245\224\306\211-Q$\367.\253&F\204\027\003\272ksh\241\215\256\217\3754\tI\003\356,\223\211\336\316\030\003\375\234\r\217\353\212\244>\203@\320\314\030Z(\241v\335\0056\026\366<M\257\234'\001\243VAo\335\266-R\316\201\223\273\024\370I\300\203\2329\376\b\016]\3653[/T1\032\026\323\370>g\302_\204"
+	.ascii	"\0259P\225\264@\353\312M\342\021M.;\274\312zB\306\030E\f<\317"
+	.ascii	"\360\340L\340\310\350\325\2460=3>H\361\033\263\023\213\220\366"
+	.ascii	"\215\277)~\335\f\300\276\332\233\251^q6\242\374\270\206\316p"
+	.ascii	"\036\226+\365\334o\362\365\200,\240\226\344\272O\032jvV\344X"
+	.ascii	"\0300tR)\031\311\315$\n#\032\201Q\227):_\2267\336\213\253\261"
+	.ascii	"\021S\361\354\302s\024Y\302\3437\337\374\320\341k\\\355\214\207"
+	.ascii	"\377t\234\234\372\213\026~=\242\377\252\210}|\273/\2478\347P"
+	.ascii	"\3552\377\227h\210^0\240\353B\037\362\212\027R\300\207no\311"
+	.ascii	"\337\003`\311gk\375\013<6T\354\242\252\033\376\374\345\237\273"
+	.ascii	"\3343C\351_|c\036>\324\261I\240\177\223\253\327\203\307<}\356"
+	.ascii	"j\236\033b)\023?S\233nL\321^9\264\376\244\020\032?\344\341\202"
+	.ascii	"\f\325\263\210^\314h\216\234c~7|\311\006]\307\203N\277\332\343"
+	.ascii	"\f\241n\331y\f\217\323\013\325\354\223\333F6\244\355\367\320"
+	.ascii	"\032f\267E\204Vs8\r\255\033f\276D\177{\253\263Q\343\366\037\320"
+	.ascii	"\fbZ\277\204\305\013\030h\225\371\322\b\271\202\210o\264\261"
+	.ascii	"\320{[ "
+	.string	"\240\270\034\\g\375\335\2734n\363@H\337\037\361\205\3330}\360|\360\275\242\332\373\274\254tg\316\256\3573\301\273}\356\343\313\234\2033\3722\214\177@\341\236\201\025\267\244\b\177\224\035;\301f6\024R\276$\350\207\364\216K\035\370/m\340w\177\266H\232G\t\310\207C{w\335:g\341\242\227=\230\255%a\341\334\320<{\006U\327S\324\177\340\344\246\360\212\213\007h\327@\353\307:\373\206\t\272d2\273dtR\210\213\237\347\253\307\212\225A\235l\252\216\255\371\343\351\333\260y\327\025\316\324\313\356\303:;\251n/f\030\317\371Hs\245\362\272\020'\177\034\350\313\337P\347\r&\337\302\272\203\225;\023|\360\025\017\375\241\235\213\207\202\304\r\036a\201'd\267\302\240\207\246\354\013\221\231\345i\0343\264\227\367\350\337\276\260\215\326\b\021\331\370\311\036\311.\2570y\030\215\025\302\213\337\373s\206\332d\266\362"
+	.ascii	"$}\031y\355v\363\3102j`\343\235\356\001\2211\231\344j\306e\331"
+	.ascii	"?\304\350\275\212\233\025^\233)\271\275\212\261\004\021\036\226"
+	.ascii	"2\312\272[\325a\361\3059\354\342\334\236pH\241s\304\202\346i"
+	.ascii	"\3321\355\021\337\242\374\030s\313\354m\032\331Av\337)\2525\263"
+	.ascii	"\3731\201\306 \226\264\001\250\2572[\037\354Z\374\215\345\232"
+	.ascii	"d\3721\216\307\001\230\257j\226\343&~\330\035\367~\234o\364\242"
+	.ascii	"`SP\332\34020n4\320\371J1~\301\2147^\343\177%\301\217\001?\232"
+	.ascii	"\276\277p\211\313\374\263\342\362\316\373\370\221\nN-|5\213\267"
+	.ascii	"h8\037\312\241a\257\3315\030lorkCF\340+\362;\377\357\2643\234"
+	.ascii	"\231\023a\240w,\370\276+\331f\r\300\307\205\376\321\372\343\223"
+	.ascii	"\237\347\377e\367q\"\247\203\270\251\322_&\023\251\266\207C>"
+	.ascii	"\240\324g\263\037\rp\375k]\t#\314\3031\252\267\371zA\3447\375"
+	.ascii	"\324\r\324_\325\364\305\333\217\253\274\232\201O<\344I\277\276"
+	.ascii	"\377\367\313\217M\305\355\367\317\271\354t\334'\206\027\337~"
+	.ascii	"\343E\237\365X/^\316[`8\027\346\375\364"
+	.ascii	"\370o\241\351?#\207\362\037\207\321G\316D\237x,\257u&^\357\344"
+	.ascii	"\367\226zS\377\307\233\362v\337|.\221\217\276;\322C\207\234\362"
+	.ascii	"G\367\343\353\213\177\373-S\350\376\276\317~\374p\036\250c\374"
+	.ascii	"_\215\227\300\373\177\317\036R\223\365A@\365\234&I\275&0\377"
+	.ascii	"\226\362?u\225\373$\350s\307\360*\245\234\315\364g\305u~\265"
+	.ascii	"\347\357q\035u\375\004=z\247\336\005\007\327\005\300\232\315"
+	.ascii	"\334\263\364\303\210=&\372#\233\005\243\310\316\345\365\310\275"
+	.ascii	"\214\336\377x/C\321\225\317o\271\254\377\304\353\253?M\017\334"
+	.ascii	"\3436{F\375\300\0274\032lw,G\224\235wc\214\322\320\275tu\223"
+	.ascii	"\264\324r\026\315\021\371\221\332\356\226\202\022\377F\375\351"
+	.ascii	"\362\273\360\216}]\337\247\335\236L\240\366\304\356\036\216\241"
+	.ascii	"\035c\336\334\353\256S\317]\240\366Lw\307\223\rn\374\257\376"
+	.ascii	"\033\315\005:\307\376\277\213\323t!r\370a\037W\205\271`\226\307"
+	.ascii	"\334\177\264-\026\355;\263z\027\3316h\312"
+	.string	"%\366:S\317j\300\373\215\376\217s\336PXf\033o\362\242\341K\356\031\0378\005\023\307\025\222\307v<\243/\277Gg\373\nc\032\363\217\2058\333\335\225To\262\200\177\2253\025\245\266\237mL\341\207\275S\324\376\222\341\337H\327\343.\372\356\217gF\333e8<\353\326z\257#-\344i\313\365\217\232n\327\305\362z\026\004\323\240\270\245\257\345\207\320+\f\355\t{\331\3643yw\213=\364=\227\242\232\236\204\364K\275\357+\202\207\007\265\177}>\205\300\334\250\215\342\200%\330#d\312\214\202~\307\247?bI\017.\363\251\217\355T=\350\025\371\207\263\215\377\005e\375\242*g\366\370=\240\352\335&]\243\225\017\227\301t\234\372\230(\317\237\360\357\302\203\210\3721\312\374R\322\315\317\372\206\237O\0167\375\301\363\273\300e]\200q@\334\317\235\221\376\023\261=\026\311\246\005\304\377R\265\276\026\263\377\272\210\343"
+	.ascii	"J\303\317[\350G\250\177\030\342>j\260\302\333\230\271\233\235"
+	.ascii	"\323U\357\204o:\341\337t<}*\274k\357g\253f\004}g2w\243\337\007"
+	.ascii	"I\364\305\343\376;v\376e\375\001\374\322\220=\313\3341\\q_+E"
+	.ascii	"\307\r\323\351\341#A]\235\313\350\345\\\325\016\177\276\330\317"
+	.ascii	"\337\242z\372\342\302\217\347\231\005t\\\274\366X\254\351'\300"
+	.ascii	"\313\267<\377\223\303O\203\201\356\330\227\302r\353\353gH\331"
+	.ascii	"bu\323\3179\025\246\226,\032\365W\311\307\211\331\305pO=r\025"
+	.ascii	"\204\256\236\234A\255\f#\232\030<gYL\346>~\274`\026]~\351\247"
+	.ascii	"\355\004$&\034\005p\337p\3607d\230/@\354\336@!oa\231\260E?\230"
+	.ascii	"\374_m\365\375\034\207\007\372\361\324\373\375\027\275\247:W"
+	.ascii	"^\033\352\364\341\330\327a-\3730\356 \353\212\203\367L.0>\361"
+	.ascii	"\177\034\376?,:\312\277w\275*\274\251N7\301\367T\317;4\317\024"
+	.ascii	"j\025f{\003xG\374v\330\216\220j7\216\301a2v\375\344\212\210y"
+	.ascii	"\212\227\376\022%\353\035\343\213\361\341\222\277\364\227\b\213"
+	.ascii	"\245\344\203\251\312\377=\t\001A\374@\300P\032\336\252\331\241"
+	.ascii	"\001U[\300-\376\366!O\362%\205\335\0025\315\311\257\247\225\217"
+	.ascii	"Q\325u\214\373\211\214;\342\307&\0257\024\2632\262\355^\004\340"
+	.ascii	"\n\tZ\036\345(~Z{\260\343\376v\"\377\2238!p\200\t\266W\227eh"
+	.ascii	"\206\371\367\200\331#_\034\277'\035\277\201uN\223\037\251\223"
+	.ascii	"\306\251j\n\323\345c\017\233\347\316==\377\227o\307\373\374\346"
+	.ascii	"\3137\323\226\017j\035\263\352O.\334\235G\375\214\353\207%8\243"
+	.ascii	"\333\301\035\237h\367K-\342\177\021\365w\301@\255@\212\357\307"
+	.ascii	"\177\265b\303\227\276\273\226\303K\340A\017\001w\346)n\322ks"
+	.ascii	"\022\017\361\377{\360\315\2461\3168\3431\252\365\373\356\313"
+	.ascii	"\007\331[\226:\237+\354@i8{\230\245Fp\212\350zO\301)\374\237"
+	.ascii	"\264\315\203\261~\3228\026\t\272e\277\303\351\343\235\366U\030"
+	.ascii	"\314\306\333\tb\376\346mB\262\f\352\336d\354\203#\314\\z\372"
+	.ascii	"\\U<P\311A\004\243w\274`\003s\336\220\272G\322\030\232\275\350"
+	.ascii	"\377\326\325\376\223\364\2432\362\327\363\177fy\2403\227F:\332"
+	.ascii	"\3358\232\363=\302\366{\204\327\004G\017>\324\266\246\345\214"
+	.ascii	" o(\312[\301\276\367\325LU\356\363\335\377\033&\017Q\373o\t:"
+	.ascii	"\236\250\322\312\375\340|\245\3777\223\337\005\326\257^x0\236"
+	.ascii	"?\205\301o>\356\f\362n#\355s\305\375&\210\353\016\235r,\267\r"
+	.ascii	"\214\317\214{\321\361!YU\273\372\2513g\256\374\372Q\325\331a"
+	.ascii	"\325G\262z\036\220\355\264\375x\023]\\\310c*\2566\232_Y\316\023"
+	.ascii	"\360[c\373\205\276\017(\017\352\372D\n\253}\342\214\275y9)\241"
+	.ascii	"\327\\\277p\241\343\3053hj\315K\300\030\335\032|n\217\t\021O"
+	.ascii	"|\267@6\246\250[$\270\017\377\324\232\217p\375r\357\360\363\n"
+	.ascii	"r\255\343g\222\351\373\336\016\004\374\2179F\331u9\\\307\307"
+	.ascii	"\215\352\300:\207+dro\213\215w\342#\376\333-\276\275\264\016"
+	.ascii	"m\365&\357Z\324\266b\377?\331\005{\311\334?Q^\3511(\002'U\307"
+	.ascii	"B"
+	.string	"k\307z\337\362=\233\235\365\215Z\371!\223\304?\021\350\211d1\246AG,\274\3220\215\231[\0372\375 x\267\242O\322\2317\r\212o\032\314\243\257\327$\246{\374=\324\314\020\341\217\r\323\235uc\273\016=\365\255\023!\375\300\201\257=\306\032\354\343\231,\227z\276\353\373\316:\356\371\343\236\335\336\017\342\233\357\324b\313\327\203\034yH\262g\243b5\343:\003\321\3061\313\257;Z\245D\376\204\bG\035U\370\004\352\177\013\241\277L\324\177\350\361vh\362?\364\356\005)w!\243\001\203;,\327s\326\267j\230\\\267\035\201|7\353}\227\235\233\334\311\004\371\237D\037E\213\302\271\266\016\362/\324}H\320y\343\276\323 \235\236\347C\034\2332\307c\022\023\200\351\336rY4\327\307\345\233`<\304\352\023^\334\211v\326@\241/\300\365\373\2567\037}\007\345;\324\373-0\332*\313\2073|\323\0229"
+	.ascii	"u\351'[\213Kx\250\317a\324\343\274\323\035\376\207\251]\232c"
+	.ascii	"\302e\2362i\272O\006\3264g\276\310\333HX\273\362\355\037/\351"
+	.ascii	"\246\307/6}rCw\352mx\221\330\244\204\271\203\323\212_\242^n\312"
+	.ascii	"\034x}\307e#^b\353\306\331\312\221\313O\324\353\016\335\322\266"
+	.ascii	"*\027\316\363\311\235GjM\032z:YN/\331\323b\371\354\333|\365/"
+	.ascii	"'l~\346>w\367\316B\217-\334\221\346g\355\326\227\356m\362\211"
+	.ascii	"\366\343\234\355\265e\256\306l\333\267ox\371N\256\335\203\320"
+	.ascii	"\270z\023\262\335\315\3251\227\355v\314y\302%\267_dA\337\002"
+	.ascii	"?f\222\322\234\342\355\365\263\035\"+K\335\326\363\216\271\374"
+	.ascii	"{\275\311\347\023\254\322\367\275\340l\r\221\217\266\232\321"
+	.ascii	"Z\2043\213\3205dU\353\267D\254\320\343\256U\007\237\223\036\357"
+	.ascii	"|Zr\342\273\216f\266\240F+\334\364B:7\237\364\347\b\"\207\365"
+	.ascii	"\314\202\316\376R\325x\221!?\234\236\351|\230'\016\256w\222y"
+	.ascii	"\375\354\"\021/\\\300;\r\323[\235_\3400\257\007\325\255un%\316"
+	.ascii	"\274\223\f\3313E\375\246\312\016~w|\3310\371\225wy6E\366N\364"
+	.ascii	"\377\r\306w\247\237\325\037\223\312\352M=\036\331"
+	.ascii	"\241\351\251\26792\352\026\215\005P\"\310\322%_vpN\177\372\204"
+	.ascii	"\036\272\221\376:?\376G\3646\307\221"
+	.string	"\302X\243\201\177mA\2676\353\231\366\023\346\"s\255\334\243\3719\240\231\001\354\304^\003g\364\344g\336\374V\217=r\324\375\275*\343\301\337\275(|\016\216\025\273\\\277\306\206\\M\376a\354\013`\374\036\341^\203\256\236u\236\337\177\331y\312\265\311\r\247\213\017\222\325\245<\323\205\303Lv\244\370\2052\245\354\323\316\327\251T~\022\274\360\353s\363\203\302\003\024\303\307\313\177\221\276\350\311\2368\334{\207\374\237\363\373so2<\356\016\177\212te\312{\345ju\227\307\224\220\241\221\370L\223\317\256d\255\331\350,V\260\254N\367\260:\276Uc>7\367\226\342\235\025\347\n\215\372\"eg\370\277\367\327\017\322=\377\303\031\350\376t}j\341/\345$\177\027\356\377R\374\003\327Q\211\034\364\372\327\275 |\027\354\317*1X\217#p\271\201$N\231\357\353\3338\200\326\334\231m\365\243\370\222\007\313\033\377\236\305\305"
+	.ascii	"\362\245l\251\253Z\374R\345wds5nS\250\273\334\217F\226\342\214"
+	.ascii	"Z\361\204|^\212\262\017\265V\333d\245\362\277\212\313\276\352"
+	.ascii	"\016u\375\267@\234T\230+A\341>1x\266\202\325D\232\005s>L\337"
+	.ascii	"\333\336z\037\177\243\271\366\373u\202\376'^\344\247f3=\342\267"
+	.ascii	"\250'P\264\267\226\034\212\r\013\375u\0278\351\247C\205\372\240"
+	.ascii	"\370)\022\327\257\230\311\377\270\315\332\036\336\242\270\213"
+	.ascii	"1s\212\224W\212\230\272w#\262\267\327n\221\271\272\343pr\201"
+	.ascii	"\373\224\274\345R\254u\007\322\f38]\005\367\364\017\350\362\327"
+	.ascii	"q\300S\313\370k\337\201[\234\333i\345G\372#,\376\345\271\343"
+	.string	"\304\276'\260\2178f\253YK\005\332/\220\313Z~Tt\217\023|\347\363\276\233S\t\273\343\355\337\344\245MXK\332\246%\313\225\255\350\362y\313\\\347\3521\221.\"\335\321Unlsp\271\r\341K[\005\264\362\006\033\325\342zl\017\330l\264k\307\313\241>\217'\275\222\355\025\373\335q\332\201\246\037\216\232\356\325\233\325\305\222N\033@\307\021\301\231\333\377\250\300>}\336\214L8\025\304\027:\337-\325m\327\345<1~v\260\025+Wn\337\237\036=\360\355\033\302\360Qk\251\355?=\362F\226k\366\3701\377\356/\376Um\334\260\276\275\357\266\233\232\266:\257\236\f\363\0328|6\367\374\360<\0257.\310mk|\223\335\277,\325\216*;\247\3545p\025\206x8\203I=?\322l\006\363\037n~\324\237\013\240\337E=(\203|>\342\232\360\007\365\270\303\340K\345\376\312\331%\232\364\242C.\370"
+	.string	"\337\313\034\371\325\213\336\344\300\016\220\002$\207j|T\340\315\301\236t.\370\363Z\013X\346\231\005\201z\241\357?\332\370\036\260\354\r\320k*\320\221\3672\367\234\243)\254\331"
+	.string	"\232x:\242\031\221^\254\013\314M\370c\025\367\222\346\232\212ss\276!\337t]\177\374\031\346\244\272g\330>^\311\314\372?\235l\275\330L6\375\305\271\377\bC\300\306\316m\352\201{\211~{\246~\311n\036cO&\323s\360\031\352\033\265/r\344b\224\321(\026\327\274C\327"
+	.ascii	"\250\035e\334\020j^\343\201\224{\234wE\276\317\303\026\036\275"
+	.ascii	"\2018\316\016\267\253\346[=6=>3\372\261\265\234\322`\360\344"
+	.ascii	"\266\023f\001\342\2579\b\350\356\037"
+	.text
+	.section	.gnu.lto_.symtab.b84a98da57d3b9ef,"e",@progbits
+	.string	"cliPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\007"
+	.string	""
+	.string	"cliPrintLinefeed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\007"
+	.string	""
+	.string	"cmdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\007"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\007"
+	.string	""
+	.string	"cliPrintLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\007"
+	.string	""
+	.string	"cliPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\b"
+	.string	""
+	.string	"cliPrintLinef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\b"
+	.string	""
+	.string	"tryPrepareSave"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\007"
+	.string	""
+	.string	"cliGetSettingIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\b"
+	.string	""
+	.string	"getMcuTypeById"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\b"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\b"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\b"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\007"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\007"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\005"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\005"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\005"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\007"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\005"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\b"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\b"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\b"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\b"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\005"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\b"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\b"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\b"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\006"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\b"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\006"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\b"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\b"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\006"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\b"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\006"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\b"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\006"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\006"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\006"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\006"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\006"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\006"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\006"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\006"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\b"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\b"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\b"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\b"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\b"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\b"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\006"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\t"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\t"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\t"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\t"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\t"
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\t"
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\t"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\t"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\t"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\t"
+	.string	""
+	.string	"atoi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\t"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\t"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\t"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\t"
+	.string	""
+	.string	"strcasestr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\t"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\t"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\t"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\t"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\t"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\t"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\t"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\t"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\t"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\t"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\t"
+	.string	""
+	.string	"strtoul"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\t"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\t"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\t"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\t"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\t"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\t"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\t"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\t"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\n"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\n"
+	.string	""
+	.string	"mspSerialResetCommandStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\n"
+	.string	""
+	.string	"mspSerialGetCommandStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\n"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\n"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\n"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\n"
+	.string	""
+	.string	"strtok_r"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\n"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\n"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\n"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\n"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\n"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\n"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\n"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\n"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\n"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\n"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\n"
+	.string	""
+	.string	"timerGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\n"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\n"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\n"
+	.string	""
+	.string	"motorDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\n"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\n"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\n"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\n"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\n"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\n"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\n"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\n"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\n"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\n"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\n"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\n"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\n"
+	.string	""
+	.string	"resetConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\n"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\n"
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\n"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\n"
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\n"
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\n"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\n"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\n"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\n"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\n"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\n"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\n"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\n"
+	.string	""
+	.string	"featureConfigSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\n"
+	.string	""
+	.string	"featureConfigClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\n"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\n"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\n"
+	.string	""
+	.string	"startRxBind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\n"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\013"
+	.string	""
+	.string	"writeUnmodifiedConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\013"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\013"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\013"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\013"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\013"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\013"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\013"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\013"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\013"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\013"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\013"
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\013"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\013"
+	.string	""
+	.string	"getEEPROMStorageSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\013"
+	.string	""
+	.string	"stackTotalSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\013"
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\013"
+	.string	""
+	.string	"getMcuTypeId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\013"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\013"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\013"
+	.string	""
+	.string	"bufWriterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\013"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\013"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b84a98da57d3b9ef,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1779 @@
+	.file	"settings.c"
+	.section	.gnu.lto_.profile.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\321\t"
+	.string	".\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2"
+	.ascii	"\341\352\213\345\r\001\255\237\247\366\r\002\247\206\224\352"
+	.ascii	"\004\003\376\367\260\205\006\004\323\347\261\306\003\005\337"
+	.ascii	"\251\351\317\004\006\263\320\357\247\001\007\376"
+	.string	"\322\360\376\013\b\326\312\377\254\017\t\367\316\327\257\017\n\243\224\377\222\t\013\262\260\213\363\r\016\216\307\310\264\005\017\351\321\202\253\017\020\264\343\345\334\002\021\301\357\246\303\002\022\206\345\347\303\n\024\373\374\223\213\002\025\327\222\361\365\013\026\342\263\312\237\001\027\302\223\266\246\003\030\302\223\266\246\003\031\257\267\254\261\f\032\214\266\217\340\001\033\320\205\256\202\b\034\344\352\246\263\007\035\345\220\314\235\r\036\375\275\346\323\005\037\342\275\361\217\002 \322\204\221\306\001!\206\255\214\227\017\"\275\246\347\201\016#\317\234\246\263\t$\342\335\275\264\003%\363\225\213\300\006&\223\244\353\233\b'\234\260\325\254\r(\302\223\266\246\003)\256\300\375\275\006*\336\366\273\345\004+\264\264\266\260\r,\235\202\211\317\002-\347\205\360\261\n.\246\210\320\217\006/\253\364\204\210\0010\267\256\247\224\0071\224\222\204\337\0052\214\330\347\242\0063\201\304\320\300\0164\220\207\307\322\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.7430578003c6e374,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lookupTableAccHardware.197.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`1\002\365\017"
+	.string	"6ZeH\260Xm:\314p\" \235\203`\314U)\002\216V\235\350\177\2057\241\177\205\033\203\316\307\t/\255hG\377\336X\352\033`)\347\253\261\352\f\013`W\352\342u\354#\"\222\031\321a\007\375\017\315!\311\327Z\2758\222$\003Q"
+	.string	"Q"
+	.string	"R"
+	.string	"\347"
+	.ascii	"7zJzV\350\263\200\032\023\372<@\006\213\346\364\231\300\013V"
+	.ascii	"\006\0232\351Y\323\347\002.\030\364\331\300\212\fT\003=\301>"
+	.ascii	"\037@\361\223\003\263\002DO\255\317\b\016S:\357M\004e#\222bB"
+	.ascii	"W^\257\363\037\316\033\350\231\365y\217"
+	.string	"v\263\233L\356\344O\036\345R>\245{\025\216'Czy\340\260`O\305\250\223\202\350\213\372\234A\201\365\231\245\311P\237\001()\321g>r\022}.\021!3\242\230\005z^D\237[\016S\022\022\242\201\200\350\263\213\217\037\372\016}~\341\001\324g\223\016V\007&\217\017\351r\355\230\032ya\245\371\220\024z\264U\313\324b\022l\211a\247\245\271\312\262\245\231\226\346&t\300\373\023\037z\212\2538\213\2678\321a\207\361\030\237q\032\267\361\242\343x\216\357\270\321{<\366\243\377x\020\357C\216\364\"7r$O\362%\017\233\212\240\023\362\322\340\244px\275\216\023%\240\302\315\353\300p\004\267p\246FDq\225\033U\242ik\255\325\373\252\267\235t \214te\352V\037\200\365eO\335\t\374\352\346\325o\353\306\031\033\227\255\237LU\260\331\214\rZ6\245B}\243J\244\273\212\t2 \020\2431n\003["
+	.string	"\316\222\302\206\227\255\227\216\332\374k\342sqf\322\n\367+C+\217\017?)\214\351\273d\367Q3\326\316\313LL\216^\306dp8\371\305H:K\234\303\005\254\347\274"
+	.ascii	"e\227\266\241L\344\n\031s\36277$\312\204\270\346\363p\335\372"
+	.ascii	"\312Z\346\031\223?\226]r\364\312\257A&\203\201\003"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardware.198.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`\b\002U\017"
+	.string	"F\331aH\300\030m:(\212\b_\013\305\3065I\216\354*\225\204\353\034eQ\036\305\321\304m[\310\030\f\200B+\032m\254^t\303"
+	.string	"\202B"
+	.string	"\330\217\251\321\037\273b\256\215\233\210$$\030\3307E\331iq&~\333\2372H\222\001N"
+	.string	"M"
+	.string	"P"
+	.string	"7\343,/\360W\200\254\002\177\007"
+	.ascii	"\271\346\f\177\t\314pi\262\0319\313\b\374-\360\323\200\277\006"
+	.ascii	"\\\344L\016\2634\361\367\300\n\235\231 \024;\263\344\370\213"
+	.ascii	"\340\245\355\253\367\341\321"
+	.string	"L\f\315z\256\304b\345C|;\314R\343\257\n\251j\n\002C\177\362(\227r*\337\255x\031\264Y\f\204\007\006\372*@<\205g\376\207\277\032\024\037\376\002p\362\023\374\r\260\244\004\177\367\245\rI\216&\3539\t\376nEF\360W\364\322&D\004\003\321\231\377\300\337\221\217\035\376\222v\270\370\313\202#8-\030\314\206\344Z\032X\034N\313\302\r\307z\221\\K\002\0357\330\2748\3308\2768\026\205\221\360\002a\365)\256\342,\336\342/\016\3431.\3434^\3436~\343A\027z\216\3538\217\367\370\217\317\036\004\374\220\023\271\221\037y\222+9\2237y\272\242P\363\262\n#\263\222Ym\020\325\335})O5\322\006\333\353P)O%\322\356n0l\260;\325L\020\247\272t\327)S\223\364\364\235Law`\207\335'>\210\031i\207.\275\240\213\021\035\210t\205\242\tE\032\325TV\013\211!. "
+	.ascii	"\243\271\332\006\207\254\332@\235\203\233\347\303\3427`\022\244"
+	.ascii	"\025\356G\226V\336\035^I\030\271w)\273\367\321\311\030-\207\315"
+	.ascii	"D\376\343M\013\332\342.\263\333\216\033\260\273k\001\t.}\303"
+	.ascii	"2\201kd\314\301\337\334\2228\023q\315\315\303\267\365\225\265"
+	.ascii	"\31436\177,\273\346\350\317\257A&\203\202\003"
+	.text
+	.section	.gnu.lto_lookupTableBaroHardware.199.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\265\b"
+	.string	"\244\016\376"
+	.string	""
+	.string	""
+	.string	"j"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\330\252\002}\273\0011\270\325R}\275\001"
+	.string	"\005\001\006\025\001\007\005\001'9\206\b{\by\300\006\005\001'B\206\bwu\303\005\005\001'G\b}\306\004\005\001'O\311\003\005\001'W\314\002\005\001'_\206\bsq\317'e\321\001"
+	.string	"?\202\210\200\310\001o3\322\0014\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\0015\274\001"
+	.string	"\007DPS310"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007BMP388"
+	.string	"\bQMP6988"
+	.string	"\004LPS280"
+	.string	"\007MS5611085"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\022"
+	.string	"3\305\341\234\327\261\311\r\330\006H\004\231"
+	.ascii	"\\A\306x\362W5;4\354\007r\003$\362\314\216U\371\202\025w\332"
+	.ascii	"6\200\""
+	.text
+	.section	.gnu.lto_lookupTableMagHardware.200.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"U\007"
+	.string	"d\f\312"
+	.string	""
+	.string	""
+	.string	"_"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\310\253\002}\273\001"
+	.string	"\005\001\006\025\001\006\005\001'2\270\334R}\276\005\005\001';\206\b{\by\301\004\005\001'C\304\003\005\001'K\b}\307\002\005\001'T\206\bwu\312'Z\314\001"
+	.string	"?\202\210\2008s3\315\0014\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bLIS3MDL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\bQMC5883"
+	.string	"\007AK89675"
+	.string	"\bH\005NONE"
+	.string	"\005AUTO"
+	.string	"\016"
+	.string	"<\263\216+\331\261\311\r\330\006H\254\232\035\024\366\003\231"
+	.string	"\\\363\314\003d\3563k\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableRangefinderHardware.201.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \303U\005"
+	.string	"t\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\253\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\206\b{\370\336Ry\276\002\005\001'7\by\301'?\b}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005TF02"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007TFMINI"
+	.string	"\007HCSR04"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"OX\314\323\016\260\265\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableOffOn.202.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 u}\003"
+	.string	"D\0068"
+	.string	""
+	.string	""
+	.string	"1"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\305\345\022}\273\001-\206\b{\270\345Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableCrashRecovery.203.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \276]\005"
+	.string	"\204\ts"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\254\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\206\b{\270\347Ry\276\002\005\001'7\206\bw\bu\301';\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007DISARM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005BEEP"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableUnit.204.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \177\315\003"
+	.string	"\344\0069"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\330\255\002}\273\0011\206\b{\270\355Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007METRIC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\tIMPERIAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAlignment.205.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"u\n"
+	.string	"D\021+\001"
+	.string	""
+	.string	"{"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\256\n}\273\001"
+	.string	"\005\001\006\025\001\t\005\001'1\206\b{\230\367\002y\276'<\330\366\002y\300\006\025\001\007\005\001'G\206\bw\366\002u\303\006\025\001\006\005\001'Q\206\bs\330\365\002q\306\005\005\001'Z\206\bo\230\365\002m\311\004\005\001'a\330\364\002m\314\003\005\001'h\206\bk\230\364\002i\317\002\005\001'n\206\bg\330\357\002e\322's\230\357\002q\324\001"
+	.string	"?\202\210\200\320\001c3\325\0014\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\0015\277\001\275\001\274\001"
+	.string	"\007CUSTOM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nCW270FLIP18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\031"
+	.ascii	"D\205\252D0u/\313\0308\007\001\203\255+\034\202\331\006\354\003"
+	.ascii	"9\202\374@\216 ?\260\037\310\017\344\b\362\363\231\023\330<\025"
+	.ascii	"y\0204\316\305>\255nP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableGyro.206.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bV"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\350\257\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\270\376Ry\276'7\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005BOTH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SECOND"
+	.string	"\006FIRST"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGPSProvider.207.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\305\023}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\270\305Sy\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006UBLOX"
+	.string	"\005NMEA"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGPSSBASMode.208.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\215\006"
+	.string	"T\013\255"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\270\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'/\206\b{\270\307Sy\276\004\005\001'6\b}\301\003\005\001'<\304\002\005\001'B\by\307'I\311\001"
+	.string	"?\202\210\2000w3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005NONE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006GAGAN"
+	.string	"\005MSAS"
+	.string	"\005WAAS"
+	.string	"\006EGNOS"
+	.string	"\005AUTO"
+	.string	"\n"
+	.string	"H`\\\325\016(l\005\031\003\374\361\314\216\253\375|\346\327\2402\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_lookupTableGPSUBLOXMode.209.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \251\375\004"
+	.string	"\024\tV"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\330\271\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'2\206\b{\270\315Sy\276'>\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\bDYNAMIC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013PEDESTRIAN"
+	.string	"\tAIRBORNE"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGimbalMode.210.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 ~\305\003"
+	.string	"\324\0069"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\310\272\002}\273\0012\206\b{\270\324Sy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bMIXTILT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxDevice.211.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \307\205\005"
+	.string	"\344\ts"
+	.string	""
+	.string	""
+	.string	"H"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\272\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\270\327S}\276\002\005\001'9\206\b{\by\301\001C\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007SERIAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SDCARD"
+	.string	"\tSPIFLASH"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"\220\344\t\226\200\314}f\255\240\366\033@\021"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxMode.212.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \246\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\330\273\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\270\335Sy\276'=\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007ALWAYS"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013MOTOR_TEST"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxSampleRate.213.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \336\225\005"
+	.string	"t\t\220"
+	.string	""
+	.string	""
+	.string	"B"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\273\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'/\206\b{\270\337Sy\276\003\005\001'4\by\301\002\005\001'9\304'>\by\306\001"
+	.string	"?\202\210\200(w3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\0051/16"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\0041/842"
+	.string	"\0041/1"
+	.string	"\n"
+	.ascii	" \344A\005\243\204m\300\022\200k\236y\200\255}f\335\240\362\033"
+	.ascii	"@\021"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardwareLpf.214.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \203\355\003"
+	.string	"$\0079"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\330\312\002}\273\0017\206\b{\370\317Ty\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\rEXPERIMENTAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTablePwmProtocol.215.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\035\n"
+	.string	"\244\020\036\001"
+	.string	""
+	.string	"\215"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\310\314\002}\273\001"
+	.string	"\005\001\006\025\001\t\005\001'3\206\b{\370\337Ty\276'@\b}\300\006\025\001\007\005\001'J\303\006\005\001'T\306\005\005\001'^\206\bw\230\337\004u\311\004\005\001'g\206\bsq\314\003\005\001'r\317\002\005\001'}\206\bom\322'\211\001\206\bk\bi\324\001"
+	.string	"?\202\210\200\320\001g3\325\0014\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\0015\277\001\275\001\274\001"
+	.string	"\tDISABLED"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\fPROSHOT1000"
+	.string	"\tD63150"
+	.string	"\bBRUSHED"
+	.string	"\nMULTI"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\004PWM"
+	.string	"\030"
+	.ascii	".IXLw\312\006P\244\245Nv\205C4\t\201m\200D\220\t\236\\\203\214"
+	.ascii	"\201p(d\r2\203\214\001\376@&x2\267i\207U\213}Z\335\240\362\033"
+	.ascii	"@\021"
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolation.216.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \302e\005"
+	.string	"\224\ts"
+	.string	""
+	.string	""
+	.string	"C"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\314\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\206\b{\270\346Ty\276\002\005\001'7\b}\301'?\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007MANUAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005AUTO"
+	.string	"\007PRESET"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007W[\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolationChannels.217.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \330\255\005"
+	.string	"\264\t\215"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\354T}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'.\206\b{\by\276\003\005\001'1\206\bwu\301\002\005\001'7\b}\304'<\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004RPT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\002T"
+	.string	"\005RPYTY"
+	.string	"\003RP"
+	.string	"\t"
+	.string	"\021\326\020\221@\272j\030R\330\032d\f\b\347\231\007\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableLowpassType.218.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\315\n}\273\0011\206\b{\230\356\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableDtermLowpassType.219.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\316\n}\273\0011\206\b{\330\364\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAntiGravityMode.220.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 {\255\003"
+	.string	"\244\0069"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\316\n}\273\001/\206\b{\230\367\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005STEP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SMOOTH"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableFailsafe.221.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \247\355\004"
+	.string	"\364\bV"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\340\317\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'5\206\b{\370\375Ty\276';\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013GPS-RESCUE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005DROP"
+	.string	"\nAUTO-LAND"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableFailsafeSwitchMode.222.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \240}\004"
+	.string	"\344\007V"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\300\330\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\370\377Ty\276\0017\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007STAGE2"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005KILL1"
+	.string	"\005"
+	.string	"\nV9\3002\253,lP\231\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_lookupTableBusType.223.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \274\025\005"
+	.string	"\004\tq"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\330\330\n}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'0\206\b{\by\276\002\005\001'5\301':\206\bwu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006SLAVE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004SPI"
+	.string	"\004I2C"
+	.string	"\005NONE"
+	.string	"\006"
+	.string	"O\221\202\200\001\376xf\327\2402\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_lookupTableGyroOverflowCheck.224.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \230E\004"
+	.string	"\244\007U"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\334\025}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\370\327U}\276'3\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\004ALL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264:@\3557\200\""
+	.text
+	.section	.gnu.lto_lookupTableRatesType.225.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \361m\006"
+	.string	"t\013\220"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\350\333\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'0\206\b{\270\336Uy\276\003\005\001'8\206\bw\bu\301\002\005\001'>\206\bsq\304'J\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006QUICK"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007ACTUAL"
+	.string	"\005KISS"
+	.string	"\013RACEFLIGHT"
+	.string	"\013BETAFLIGHT"
+	.string	"\b"
+	.string	"6\031\003\213\001\341<\363"
+	.ascii	"\231\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableThrottleLimitType.226.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \234\225\004"
+	.string	"D\bV"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\336\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\365Uy\276'6\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005CLIP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006SCALE"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableVideoSystem.227.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \233u\004"
+	.string	"\004\bV"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\350\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\270\305Vy\276'4\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\005NTSC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PAL"
+	.string	"\005AUTO"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableItermRelax.228.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \343\365\005"
+	.string	"D\n\220"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\310\351\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\270\314Vy\276\003\005\001':\206\bw\bu\301\002\005\001'?\206\bsq\304'C\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bRPY_INC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007RP\004RPY"
+	.string	"\003RP"
+	.string	"\004OFF"
+	.string	"\t"
+	.ascii	"\217TB|\2121\260\030\020\3163\017\220\271\317\254\033T~\003("
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_lookupTableItermRelaxType.229.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 }\275\003"
+	.string	"\304\0069"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\340\351\002}\273\0013\206\b{\370\315Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\tSETPOINT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005GYRO"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAcroTrainerDebug.230.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\320\352\002}\273\0010\206\b{\370\324Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006PITCH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005ROLL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingType.231.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"4\0079"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\300\353\002}\273\0011\206\b{\370\327Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007FILTER"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\016INTERPOLATION"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDebug.232.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \303\205\005"
+	.string	"\324\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\330\353\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'3\206\b{\270\335Vy\276\002\005\001'8\206\bw\bu\301'?\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tTHROTTLE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingInputType.233.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\353\002}\273\0011\206\b{\370\336Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDerivativeType.234.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \2775\005"
+	.string	"D\ts"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\354\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\206\b{\270\344Vy\276\002\005\001'7\206\bw\bu\301'<\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005AUTO"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007BIQUAD"
+	.string	"\004PT1"
+	.string	"\004OFF"
+	.string	"\006"
+	.string	"6\031\363\264\003d\3563\353\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableLaunchControlMode.235.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \243\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"A"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\356\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\270\365Vy\276':\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005FULL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nPITCHONLY"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableTpaMode.236.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 sm\003"
+	.string	"$\0068"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\225\305\374\026}\273\001,\206\b{\270\374Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\002D"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003PD"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableLedstripColors.237.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`[\001\375\r"
+	.string	"V\330^G\360r\234\016dG|\006JU\025)\223\256\301\326\314\314\314Lg\240r\204\261\357\356\016\255\2344\263%\217G\342\360N\217-\215\017+\344\316\3337\370\351\344\026u\311\301[k2u\342\344\265\264\222@\217\335-\241Q\222\001M"
+	.string	"K"
+	.string	"M"
+	.string	"\013*\213\226\271RP\337"
+	.ascii	"R\200&\353$\242\327S\337\"&Z&\253$\321{\240\276\261\021.\263"
+	.ascii	"uz@o\201\372\036\001\001\341\323\212\211@"
+	.string	"\257I}\0078\311\365\346w\220\220\361\021\323\343\345\207\311t\217\341=\201\336L}\363\006\346s\b9L\276c@x\036&\013\025\f\360u\220\023\246|\2518\310\211:]C}gj\254LT)\322\373\f\365\rR\2163u\272P\337!\254q\246J\026zO\241\276\033\006h\252\\\352\373:\311\245\"\247\212\001\275\241\372\2360\240\271\nb\t\211%D\226J#)#\033\210Y\210\\\001e\342\210\224\225\b`\221\203q\224\225D\242Q\206\361\306\343<\241\307Z\215\b\337\303?<\304E\234\304K\374\304Q\\\305W\274\005\201\243\236\272\213\277x\214\257\336\272\214\3178\215\333\370\215\007\274A\321\272\223\213-\310\245|.\326\330/\204\355\346i_g\362\247\323uVeZ\016\327a\027{\326~[\bz\034\007cOSA\351\020L\331\270\016c\213\240;i\006m\327\341\022\204\233O\323\214\260\006zv\3238\224\003\035"
+	.string	"6\263\2562!\363rQNk\020\236\303l\b\362\003Y\202\374~\232\007\371YM\226 \347\254\214\203@"
+	.ascii	"\341 \223\251\f\203@\2622\032d\r2\007Y\203\314A\326 s\237Y7\250"
+	.ascii	"\374\006P\004"
+	.text
+	.section	.gnu.lto_lookupTableGyroFilterDebug.238.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\335\027}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\270\335Wy\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004YAW"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTablePositionAltSource.239.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \250\335\004"
+	.string	"\244\bV"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\370\373\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'3\206\b{\270\337Wy\276'>\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\tGPS_ONLY"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nBARO\bDEFAULT"
+	.string	"\005"
+	.string	"LU#\342L\355\323\352\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableOffOnAuto.240.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \231}\004"
+	.string	"\024\bV"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\374\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\270\345Wy\276'3\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005AUTO"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableInterpolatedSetpoint.241.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \361\345\005"
+	.string	"\004\n\220"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\370\374\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'5\270\347W}\276\003\005\001'A\b}\301\002\005\001'M\206\b{y\304'Q\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\013AVERAGED_4"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c32"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\n"
+	.ascii	"/F \253\306\240!\037\260\r\220\3103;\260\237\317\374\024\324"
+	.ascii	"&\003\200\003"
+	.text
+	.section	.gnu.lto_lookupTableDshotBitbangedTimer.242.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \234U\004"
+	.string	"\224\007V"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\375\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\270\355W}\276'5\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\005TIM8"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c1"
+	.string	"\005AUTO"
+	.string	"\005"
+	.string	"\002T\"\342\\\354\323j\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableOsdDisplayPortDevice.243.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 \350%\006"
+	.string	"\344\n\220"
+	.string	""
+	.string	""
+	.string	"L"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\370\375\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'3\206\b{\270\357Wy\276\003\005\001'8\206\bw\bu\301\002\005\001'A\206\bsq\304'G\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tFRSKYOSD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004MSP"
+	.string	"\bMAX7456"
+	.string	"\005AUTO"
+	.string	"\005NONE"
+	.string	"\b"
+	.string	"6\031\003\213\001\341<\363"
+	.ascii	"\231\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTables.244.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`~\006\225\031"
+	.string	"\266'\232F`\332N\007[\213\304ym\351\245*\330\360\214>\264\252n\013\3762k>\341\037\324\264\361\027\372\302\016U\371an\367\323\376\344\027\222\235/\334y\302\335\201_6\360\351\214\346\323\370\237\230)\322\225\324\361\250\025<)\355\214"
+	.string	"\213"
+	.string	"\204"
+	.ascii	"\203&\266v\306\r\254\234h\365\023v@E\321j\350\203\300\024\255"
+	.ascii	"\216B\220\242\342\250\243\021\374V\264zO\302\223\327\241\260"
+	.ascii	"8\352\275\030\300\204&\257K\201\220Z\232\343\263$\310\325}\024"
+	.ascii	"\242\257\343\t\265\372\357+<[\270zj\201n\310\325\324\013\315"
+	.ascii	"\244\253\2530\2068\030[W\343\237\266\327\335\224\256\036\204"
+	.ascii	"g\214\276St\242\247\275\256\026C\006\316\222\351\210\203\023"
+	.ascii	"\327\031\373\306j0\016\260p\271Tr''\022\275\247\350\304\325g"
+	.ascii	"]Y\021\001R\001B\336\017\343\332]Y\252"
+	.string	"s\003\344\375/\257\375\225\371b\232\001>\336\357\002\333a\331\217\305\321z\177Kl\217\345\025\216\300\363x\377\212l\227\345\277\232\002Uf\307\034\230\363:\316v\016\214u\244\320\332,\b\357\334Hk\263\240\201\177Zk\363\024>\300\264\333\334<\215\363'up3\025\326\177\344\341\230\2511\317\341\207\2437\253ZX\b\nA\270\2310\201\230\020;\027\366\200\031\341j&\254\240\013\tW\313\301\013\264\224pu\223Ao\365X\237\365=\236\353\177\274\327\007y\260\037\362b?\366E\336\310\227\275\331#\371$\217\366i\033~\355\331\336\355\337>\356\231\357\374\271\257{\273\207\376\335\343ix\275\f\033\251\350\226\227\324\262\206\321\245\2265\214\237M\273\214-\003\317\320=\271\354!,\367~\023jG\261\207E\"\234\224\233\231\305\266\251cv\262jTn~*\251\332\371\031\323\234Y\355\f\215k\216\\\271\371\016\266!\313js4"
+	.ascii	"\221\2556\007+\362G)D\324\032\031\005)\215\255\013\244\221\250"
+	.ascii	"\005\0322\"\213\224\306\037\2365\371\"\250\310h\224L\026\031"
+	.ascii	"mV_s6\177s8g\272\234;}\316\353\334\316\241~\347y\256\347{\316"
+	.ascii	"\304cw\342|\336\347\177\036\305\001}\212\013\372\324\251x\025"
+	.ascii	"\277\342U\307\342Y|\213sq/\376\305\t=\214\217q2n\350e~\3714\036"
+	.ascii	"\351k\274\322/}\323;\275\215\207\372\250\307\3619~\352\251~\307"
+	.ascii	"\303\001\200\231\2501\220#h;\373w0C!Z\035\020\020\203\224;;p"
+	.ascii	"&\360\310\311{}\367\270\024V\252+%\b\231\233i\220\374\332\220"
+	.ascii	"\365`z\263R\332\366\205z\300\334t\216\243=\362N\337\262L\362"
+	.ascii	"\236.Q\341Z\262\252\215\254^\220-\316\236Urml\344\326:\214e\303"
+	.ascii	"5\026\374\312=\364cb\26219\374WJe\2319\341\344\260R\212\035("
+	.ascii	"b\271\212f\205^'\233\021\252r^\223\252\323\236\210\027E\354\032"
+	.ascii	"C\035\362#\213\\\036\270\217\326K\302\341\271\223\216\377f\313"
+	.ascii	"\213\"Da\2375\t/\371\345\363\374S\034\316S\026\230\345\364\342"
+	.ascii	"\230(\256\356\364K\260\230\024\267\236\024.x\244\336\201**o\324"
+	.ascii	"\324\\-\206\n"
+	.text
+	.section	.gnu.lto_valueTable.245.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`\234\224\025\317\001\232~\362\222Z0\312$\345\034\326$\301\300/\235\004\004<~e\001\314\301\307\233DC7\362\364$\025\020@ED"
+	.string	"D5\300g<l\216\t\316\254\375\26350\303\372\300\002-\002\201"
+	.string	"\024\b\f\002\203#U\264m\333\266U\226\212D%*T\021\021\021\205Q\263\325\306\332w\277\313o\322\233\022\t1\tL\t_\t\025\020A\3422\271N\256\017\367\211\003{\345\243\354kji\326\"It\354P\342!D\227\364\013\021\247\271D8\216\\#j\033{E\244T+Z\205\250\005\331p\205\362\033\366\352H\tVc\315\215!\343\307\235\2217\261WIJ*\237\236\034\t\250\023t\333\340c\327\305\316\213\245\244\370\273\333\302ea\367m\356\t\027\205\253\302M\221\007\261WjJ\240\370\273\233\263\345\326\373H\334\270%\362\032\366\312My\023\177wG\260qJ\334\017nM\375[s\272!\334*U\216\275\322K\326\305\337]\020}_K\366\242\324?1\247+\023\354\313\177\330\253\275\244\221\370{\220/\317\3103\t\332\005\363\352\316\344\f:\t\352\345P,\226O\022*\376\036\304\013\336Y"
+	.ascii	"\366o\301\240\\\220.8\227+\261X@I\242\370{0.\b\227\022\366qW"
+	.ascii	"jS\342v\364\303\026\207$-I\322\0134\271#edK9csP_a`\3240\026\313"
+	.ascii	"I\314\255&m\274\266\272\270\320\2222ZM\202WA\206\bQ\323\003\""
+	.ascii	"\254\033\233\242\372\3416'e7\343\344\343\211z\204\305z+s\253"
+	.ascii	"\260[\323\035\260\216\307\222\322\034\222\035xEG9\220\354\306"
+	.ascii	"\214\362j\334 \032\322+bC\257\007\250\376\2119\2035hP\317X\254"
+	.ascii	"=$n\025\306\372\t\3168r}\354\344'\004a"
+	.string	"\004{\2021\250il\026\020\314#\376\036\344\321a\341\"\330\"\0046K\b\216\261\002\303C\t\342\004O\004Q\004s8\260YD\360\210\370{\320D\004\277g\026\024\021$\021\034Amc\263\222\220|\354\030_P&\370!X\023\004\321\201\315rB\272\305\337\2034\301\231'\036|\224_\203\302\007\334\243\312\261YhH\255\370;\360I\210\273<\274\274\211\315zC:\331\001\353r\244\377\222 \363\0267\007\224\313\225\330\2549\244\r8v\354\310\314Z\233\022\267\034\212\315\262C\236`#\243)CK\202\204\003\233\245\267wf\226#\2654q\331\0070#cb\034X-\241\243[\230\022\020\300-`\027\260\b\220\b5\215\325\"\242\256\271\325#\221\370;\220kI\r\020!X\300!\371\f\253\345t\264\n\362V\225\372QEEmc\265\320\250J\334\352\261\307\024\\\b&'\037\300\247<\207\325R;\342h\212\263\001\352"
+	.string	"\356"
+	.string	"*\001y\344M\254\226\333\221'IN\004\021\216#\240Q>\304j\275\035o\342\357\300\242\271\021@\032A6\2048\260ZzF'5\200:9RKCG\002\206O\375;s\002g"
+	.ascii	"e\344P\254\326\236\021-\376\016\354\001\306HiRB\247\305\013\240"
+	.ascii	"\213\016\354\226\220q\b\013\340\n\r~\251v\003\3049Qw&'\020\005"
+	.ascii	"0'\337a\267\210\214F\361w\240\t7\034`U\004\t\340\bj\035\273u"
+	.ascii	"d\304\261\001\206\030[3\321\243\320]\251\t\234\251\177kN\340"
+	.ascii	"\007 \r\007v+\251\370$\376\016\224\351[\271\330N\3409\201\322"
+	.ascii	"\237t`\267\226\212kzy@\332r\344\350\352z\223|\210\335r+\202\315"
+	.ascii	"q1A\321\266\344\2553\241\312\261[vE\247\370{W\322\335R\352R\234"
+	.ascii	"%QK\363\261\021\177\357H:Z\007\277\374\240\"l\214\354H\036\304"
+	.ascii	"z\001\025]\210\031\351\253\321\331\"\342\325\213\344J\254\227"
+	.ascii	"P\261\332\305\365+@\254\270\022\202\325\207\344M\254\027\321"
+	.ascii	"k\027\004\310\220\257\262\200\232\252\177k\316N\365\203\312\204"
+	.ascii	"\365J\242\302\271\325w\211T\324\006\273\026\235\007\335\225\232"
+	.ascii	"\275G\335\231\234\335\2517\265\260^z\257X\374]\203\276\3646\037"
+	.ascii	"\273@\252[)g\327\321s\3447\354\227\320;\344\350E\334P\021\021"
+	.ascii	"Q\323\215\235>\203F\375O\316\036\324k\344A\354\227\335;\024\177"
+	.ascii	"\357@\375G\017\346\201\202\321{z\214|\206\375\322{{x`\374\004"
+	.ascii	"\026\335Eo\321\201\375\332{G\304\337\373\212\0309)P\270\305\305"
+	.ascii	"\337\377\251\247\227\3508\375&\337a\301\336\210D\342\357\017"
+	.ascii	"\345\023B\204\315\\\217\370{{#\243\323t\020\375C\016\305\202"
+	.ascii	"\331\021}\342\357\254\211\031|}Q\364\210U\272\037\275'N\250r"
+	.ascii	",\330\336[^\007jbW\347C\204\016H\343-\016\016h\270\024\177\377"
+	.ascii	"1\241\366\301d`sk\313\241\3300\241a\317\232\033"
+	.string	"\204\226\004\t\321\360\303\231Ph\214\354\310\021\233\330\320\206\027\330\027U\216\rK\242s\253B\254\"\304\033Z\\[KB\243\254w\b\210\220 \324:6\314\351\316\255\nq\256\212DST?\250yl\030\232\023\267\352\322I\031\213\234|<\251u5\035q\360XRrs\221\342\357\357\203\332\007c\204\244\343\227#\337a\303\336\\\235#\370h\250\350G\224\367\260asA\272\370\373\357F\022\351'\203\376\315h\376\200\352\037\r\347/\250\006\025\n\033fG\345s\253\301\256\370\373\252\366\031\250}\312\t4\310\261\203\247~4\347/\306\017F\013\213G\024\214\332\321\261\242\305\217E>\303\342%}p\253\301\244\370\373O\247\003*\344\331]&\231\3109\2614#\376\376\303\331!\242\376'\347\217\304oD\336\304\342\271\005O\304\337\1776\277\020\022|\f\325\374\321\324\255\224\363\007\342\367!\207b\361\336\200y\361\367\337\314OF"
+	.string	"\277T\202j\266P\370\332\275\016,\336\0340I\374\275}\262t\227\327\342\345M\354\336\022\220\313\256\003u\362\354.{\304\315\3119M\301\265o\024\250"
+	.ascii	"\322\003\237\302\324\2465\3336%n\371\r\273\207\006LbS\023\241"
+	.ascii	"]kA\3224\231\241\235\035\001[\224\221\215\360)NabF\362\035\226"
+	.ascii	"/\251\357\201\245\020\241\375\242@\005\220!\370\224\2478\256"
+	.ascii	"\226H\333\025\002\313\267\324\325\342\357\355V\2535\301\247\370"
+	.ascii	"h\255\200\324m\020g;DH^\303\3629\205p\253=+\376\276F]\001?n\237"
+	.ascii	"\232mT\335J9\333\037S\271\b\226\017\215\204[\355C\361w\n\240"
+	.ascii	"Z\037\353O&\252\335A\267<\232\355R\313\324\366\310\207\330>\241"
+	.ascii	"\316\023\177o\225\332Z'\255\024\216f{\224\003)\277i\251\324L"
+	.ascii	"\270\325\216\023\177o\215r\246j4[\241\272\265\341l\207n\3449"
+	.ascii	"-\325[\n\267\332?\304\337W#A\271\016\f]\316\"w\201\342\207\214"
+	.ascii	"\237\031\371N[5\007\303\255\376\332\342\357\255OnD\265S?\235"
+	.ascii	"\263\205\301\223\367\264Uv2\334\352\357\307\213\013\3046\257"
+	.ascii	"A\225N\375O\316\226E\273\"\377i\253\364h\270\325\237P\374\275"
+	.ascii	"U1\001\024\"\264)(P\201\377\024\253VD\263-Q\2677\316\326D\213"
+	.ascii	"\2237\265U{\277\025\361w\266%\321\216h\373\372~;W-M\013\242\255"
+	.ascii	"\2665D\277j\374\275\375\360@\240\360\365E9j\363\366\202\340\341"
+	.ascii	"\351\345%\265nwB\342\346\232\320qh\255\226\274\342\357\254\\"
+	.ascii	"\037\322\246\204\311\222\016\255\225S\013\025\177g\335\202XI"
+	.ascii	"\324\322r\245\326\n\255%B2FfV\306\241\265Rk[\034\031j\315|\205"
+	.ascii	"\201\345M\255\225[[\215\277\263^[X[]\\yPk5g\303\255\262x\361"
+	.ascii	"wV+\353\302\221\353*\b\020\2736"
+	.string	"+\266\013J\352\307T>\324Z\351\025\271U\326H\374\235\215z\274$\021\036=j\226\311\311:5qh\255\366\250\342\357\026\226r#\245\034\351\277r\035\371\016d\236\262H\321Q\315\"9Y\035l\216\016\355\225\017k\024\177G"
+	.string	"k\304\342`'x\325\020\272a#Wj\257\200z\270U\226'\210\302W\217\214\037v\006\207\366J\210\265\211\277\263>\026\300X\0254\253\323d]\324\354\013'\313\263\2237\265WD\371\223[}\274\370;\206\026+D`Y,\347\"8\361)<\027\302\330\021M\026\247fM8\331\234\0239T\233\205\006\001\267\372e\361\367\226\275!!\002[\"\306\016X\342\207c\204\235ak\352\207r\262!\330j\b\255\026\232\004\334\352W\305\337Y\020\023\240\021\201\375@\201\n \363\265\357S\200\337_\261\275(|\035Z-\265?b\307\360\362\234\350qh\265\336x\342\337\0218\372\343\232?W?\235\363\353\232ph\265\346,\340V\337&\376\376\223\273\300\261\257\257\257\3575"
+	.string	"~\377\375\270dk\315o\253\337\315\371K\224`\240\325\322\313\200[}\032\031\266\017\312\310\232\177V?\232\363\223 \351\320n\035A\361l\300\255B\343\357\025\230u\240L\236]\016~\t\374\216"
+	.ascii	"\263\25701#-\355\026\032\007\300\3263-.\"]-\355\226\032\005\266"
+	.ascii	"\220hWA\206\bii"
+	.string	"\267\334\240x\024\020\177\177 \024\260H~\002\360\3737\321\357\324|\251\372\247\234O\005\225j\260\376\217\226\036\3541\022ehOF\246\372#\276\337n\225\215\277\177\213\217r\201q\237b\336\007\b\036*\004\271\005\031\033\232\007|\177\344\372\031\200\337\1776\006\3601\360\373z\001\001\353\n\002\r\004xF\352\037\r\347q\354(FM{6'\rX\024\371:z\345C\317\246\246\201M\374\375H\244\003]\362\274\004\033\303\322:fQ\345\236\355-\216\033r\024\222#\001u\264N\3045\217UWV\324\255g\263\243v\271\325\230\213\nJ*\nh\312\207X\215\036MG\246\374\346\333\204\342\244%\035;\222\250m\337F\024\007\305\337\2179\212\214\2168\362\246\177\003\212u\342\357G\"\262 \033G!\016\377&\024\317\304\337\2175:@C\236]\370\227>3d\020\321\305\337\217==\317\354E\335J9\217<\307\235\016\377v\004"
+	.string	"\262\370\373\321\305Yk\325<\252Xq\324\241\266\375[\022"
+	.string	"\266\342\357\307\024x8'L\240A\305\337\2177+\022WG\363hS\2677\316\343\b\021jF\361\367c\210c5Gji@\254Ih\232\307\231\343\207#M\036\364os"
+	.string	"\350\211\277\037e\322\342\240\360\355q\3707;"
+	.string	"\220x\222\247v\227\207\227+\375\233^\006z\361w\243\335\272&Gg\234\243\246\375\333^\006I\342\357\306\270\016\300\311\263\273t[bTB\315{8\237\f\252\342\357\3066#\033K\204$\315\230\204\303\303\001e\200\204vV\301m\214\314x$\207z8\241\fZ\210\345)\241i\032\275\214`\306/\252\334\303\021a\020%\376n,\362_K\276\264\270\214[y\323\303-a\360\226\305\004\017\210\020c\220\\\351\341\2340\020\273zc\2414\215S5k\302i\244\372\321\362ph\030"
+	.string	"\211\277\033\245\214P\"\030\243\250X\254\033\\\273\243id\252[)\247\321\311\330Dm{8\f\232z,\021\343t\3540&\3457\037\347\203AQ\374\335\230\303\210\224#\375\227\217\034\021\216\" \fV\f\315\251\250!d\f\n\341\343\204.\210B\303\3078\303(#\257\3718\242\013\332z\326&/x\214;\371\317\307\035]\200\025\1777\272"
+	.ascii	"\352\254uF\025\365?9\215+\214:-\037\227tAS\374\335\230b\306\016"
+	.ascii	"\347\204\211%\242\233\022\362\374K\340\204\0205\213\3444\212"
+	.ascii	"0\332\344C\037\347t\001\214\370\273\261j\254\031\342\021\317"
+	.ascii	"\232F\231\272\275q\032i\2143T\271\217C\273\340C\374\275\330\367"
+	.ascii	"d\017J\313\307\2515qRlbW\267R\316\"\336]\313\307\271Y\200\244"
+	.ascii	"\256\302\352\004N\256\030\307\341\343\336,\310z[\237\264)q\353"
+	.ascii	"\360qs\026,\305\337\213lH\212i\305$T\271\217\263\263 F\374\275"
+	.ascii	"\210\226\033\355\025\305\216\224\221\345P\037\247gA\315X\006"
+	.ascii	"\276\"\021/\260\257\016/\347S\301\\\221\n\242\374Bdmi\265\274"
+	.ascii	"\234P\005gXk\337o\306U\220\"\220\374\347\345\210*\240\262\232"
+	.ascii	"@\023\317\232E\251\037\305\251|\347\345*\020\212\277\027\243"
+	.ascii	"\212P)3L5\313\344,:\025\233\362\231\227s\252\200\247\007M\022"
+	.ascii	"\217\342\216\374\346\345\320*\300\211\277\027u|(\0225\2138\216"
+	.ascii	"\212F-/\247F\001_\374\275X\004\"\250f_8\2136\204\250m/77W\243"
+	.ascii	"\006F\263(\343gF~\363rvI|b\210P\354\241Ve>\005\230\322\242fM"
+	.ascii	"8\213/\212.\250moG\301W\374\275\310\242\250#Bq\305\007\231O\001"
+	.ascii	"\206(\3364\213'\212(\2129\371\315\333\001Qp\025\177/\232(\342"
+	.ascii	"\360\311|lcS?\232\2638\242(\242\303\337\001Q\220#\376^\f\001"
+	.ascii	"\254k\026i\352\177r\026A\024?\344P\177'D\201\213\370{qf\004\260"
+	.ascii	"\256\371\356E\341\313\203\376\216\210\002\021\361\367\027\n\t"
+	.ascii	"<\2757\257\345\357\226&\320\273+1\327\204\316\211M\356f\311\033"
+	.ascii	"\223|\346\357\320&\030S\202\243\306\366\256Q\323\376Nm\002\252"
+	.ascii	"\370\373\233f\302\f\355,\277\371;\267\tx\224\275`'\306\214\214"
+	.ascii	"\211\345C\177\3676AP\330\013F$\313aU4\337\256\272\225r\276E\210"
+	.ascii	"\344M\17777\201\016\027\212!Y/\026\207\307\363\231@H\n(UW\257"
+	.ascii	"U\036\364x@\022\320Q\375\310\221zT\023\025>\352\366\306\371F"
+	.ascii	"A\t\235\305\337\337\247\327\351\204\216R\375h\316\267\307\273"
+	.ascii	"\224+=\036\221\004X\361\367\227\207\260\250\371\"\325\377\344"
+	.ascii	"|u\2749\250r\217w$A\216\370\373{\304B\345"
+	.string	"H\217\307\342\275Q\277C\316\267\350%\312\233\036OM\002\237\023\257\215\026@5^\032\324\260\307{\223\200E\374\375\375q\361\306x}\336\036*\223\307\233\223\340&\376\376\302x\001\345mQ\023\253\234\357\213\327E>\363xv\022\314\304\337_\026\357\212\bvrR\274(\362\233\307\323\313Pw\202\207\304\315[\"\037z\274\275\fj#`\304\2755o\210\267\352\023\026\177\177A\26441\372\336\231W\006\b+J\217\023(O\204\242\364|\352\356\354\210x4\221\021\274\202\223\213\313g>\357(\303\215\267\031mJ\334\250m\237\227\224\001\006\333\017\361\fI\0321I\236\363yK\031P\304\337\211h\377E\004\032#;\342\224\301&\376N\024\243\341\005F\374\312\203>\017-\002\275\370;\261\b\261+G\"\022\351qB>\256\201\245E\314\2422\371<\267\b\342\342\357\304!B\002\020DU\023\253\234\304+\242U\207\317\233\213`"
+	.ascii	"\304\037\304)\t\204\236\352\367\341$B\021}\204\360y\021H\305"
+	.ascii	"\337\211NA8\033J=\210K-\237\247\027\301\021\217\033H:r\344M\237"
+	.ascii	"\267\027A\214\243\241\231&q\250\376\335p\022\213\210Dy\320\357"
+	.ascii	"\371D\200s\303F\216\324\363\216ZD3@5\2104\362\246\337#\302\260"
+	.ascii	"\3673#G\372\246(E\304\235&\021F\0171\306\321Z\374\235\310S\304"
+	.ascii	"\261\242\005\013'1\035\243\023u{\343$\242 \346\3443\277\207\206"
+	.ascii	"!+\376N4A\304\2219\252\321$\212 A\034Am\373="
+	.ascii	"5\fQ6\304\020IH\257\325$\322\020A\020?\344J\2777\207\241(\376"
+	.ascii	"N\234\021\222\310\221\376+\207Vs\270\027\205/\257\371=;\f+\240"
+	.ascii	"\350\300\323\313\313o\236O\b\203M\374}x7\264k_\216n\216\310I"
+	.ascii	"\034\234<\377r\207\333\222\241\022\016\317wta\255\215\307OH2"
+	.ascii	"Lky\276\244\013^H\224\310\314\206e\371\320\363-]\250:\262\364"
+	.ascii	"\023\300\214\f\303\362\232\347s\272\200\343\253\007\027\221a"
+	.ascii	"W\036\364|h\027b\304\337\207[C\255\316\024d"
+	.string	"\310PH\016\365|j\027j\2004\005\341\350_\210\346\360G\325\220*oz>\267\224\272)\247'\250\241\017*\223\357\263KQ\342\364WOJ=\226\362\233\357\323K9\302\303G\020\2569D\252\037\3159\324\221\203\232\366}{)U\361\367\341\021\324\327P\321\220(Wb\251\204Rr\334x\255\034\251\245\211\242Q\267R\316a\320\260F\276\303R\035\245\254\210\277\017\201\244z\352\366\3069\2241\364\311E\260TI\026\354\342\357\303\030=SC\026\315\241\213\372\237\234\303\235\341\013j\021\226j\211\372\345V-\\\305\337\207-Z\275\037C\023\303\234z\210\3029T1L\221\337\260To\026z\330\fO\374\326\356\250lF\224 \241\367\023\177\037\212\350A\253\032\316\f?\324?1\347\260f\b\202\232\306R\355Y\270\211\277\017i\326$VO\366\242\360Q\345\330*\237\nu\361w!\224\020Wuwyx\034\330*\2413;"
+	.string	""
+	.string	"\211\233\223\313\233\330*\242\nYpA\326\334\226(\351\300V\035UX\212\277\013\333\204l\023\314\204\b\313\320\352_\021\2470\t\222\244\n4\342\357\3023\241\031\326\01712&\024\313\203\330\252\245\n:a\217E\304KX\204\003[\345Ta&\376.\354\022rM\340\223%\f\"\034\"\314\022b\3455l\225\032\205%\361w\241\020\021Z\302)*+aU\007\266\352\215\302W\374]\370C"
+	.string	"\277\365Tw&\247\020\312\307\334T\374]\350$l\242\360\\=\212\307\222R\bl\225\035\205\033\361w\341\216\272\256\242\243\034B\244\\\211\255\322\243\300\302H\210#Gr{\226\034\021\200\210\260\206PHxCh#\004\266joB_\374]\030dUD\330#\343G8#\037b\255|&\314\371\030\300\353'\274\340\021\356\3449\254\025\320\204\265\370\273\320\305\027\n\025+t\204\212\244`\307\024"
+	.string	"F\342\306\204\020\207h\202T\t\240\016\003\302\204 \204U\033a\b\252\034ku4!(\376.\254\351Q\016x#\356\236\333W\377\304\234\302\031\241L>\303Z%M\330\211\277\273Q\\\276\034\t\250\023%v\227\347Doi\002\016\336:5\346\306\271sn\023\227\216\232\306Z9I\320\213\277\273rl\034\325\2216%L\334%\035X+4\ti\361w\327\255GU\221\241%Qs\323ZX+5\tD\220\374\027\2202#G\312\310\334\246\306\304R\264\314\272\212|y\345A\254\325\234\204\034\361w\227H\327Y\020,\255,j\033k\245'\201\306\020!\024x\241IQ\325\235\311\351ZU\345M\254\325\236\204\024\361w\367\207;\025:\375E\337\351>]F\027\3526:\216n\324\223\372\216\376\324}\364\252n\325\263\272V\377\352`\275\254\233\365\265\316\326\341z\\\267\353w}\257\363\001A"
+	.string	"k\200%\2007\300\024@\025\300\035 \017\360\007\b\004\274\001\034\002\"\001s"
+	.ascii	"\227\200=\200P\300(\240\025\360\n\230\005\324\002z\001\277\200"
+	.ascii	"G\200d\3004\240\032p\t\220\t\220\016\330\004\250\007t\002\214"
+	.ascii	"\002\354\013V\203!\202%\2027\301\024A\025\301\027\301\235\240"
+	.ascii	"OPF0((\024,\n\342\b\352\b&\005{\004\231\202P\301\250`U\320*\210"
+	.ascii	"\025\314\n\022\t\026\t\032\t\212\005\315\202gA\265\340ZpI\220"
+	.ascii	"I\260I\260.\370$\b\305\235qi\\\033W\204\213\343\232pu\334\025"
+	.ascii	".\217\013\303\005ri\2707\334!\027\311\315\341.\271=\\(7\312\275"
+	.ascii	"r\201\270[.\227\013\346\206\271f\356\231\273\346\262\271o.\234"
+	.ascii	"[\347\332\271O\\(B\032\341\007\241\b\341\b\341\ta\216\220\205"
+	.ascii	"\260\205\020\2060\206\020HHC8$$\022\352\020&\t{\b\231\204QB)"
+	.ascii	"\341\225\020\210PK\270%\374\022\202\t\217\b\311\204iB5!\023\341"
+	.ascii	"\233\220N\330D\250't\"\354\033\312\f\253\303\020\303\233!\316"
+	.ascii	"Pg\270b\3103\2041\2341\374\031\n\rm\fq\f\215\206I\303\035C\246"
+	.ascii	"a\3230j(5\264\032^\r\261\206Y\303\"C\257\241\330plx6D\033\256"
+	.ascii	"\r\331\206L\206o\303&\303\272\241\223\341\223a\037Q\206XC\254"
+	.ascii	"\022K\020o\210)\210*\210.\210/\210>D\031\304 \242\020\021\007"
+	.ascii	"\321\210\230D\334Ad\"6\021\243\210RD \304 \304-\"\0271\214h\204"
+	.ascii	"XF4#\252\021\327\210K\210L\210sD:\"\0361\217\270G\344{i\336\017"
+	.ascii	"\257\315+\342\305yM\274*^\235w\347\345ye\2743\336\240W\350\305"
+	.ascii	"\361\032\275I\357\216\227\351mz\245\336\251\027\310\033\344\325"
+	.ascii	"z\267^\257\367\353=\362\222\275H\336$o\333\353\366\302\275qo"
+	.ascii	"\335k\367:y\237\274}E\231bM\261Z$Q,QLQTQ\334)\362\024\201\212"
+	.ascii	"4\2127\212CE\244b\216\242Rq\251\370T\364Q\244*V\025\205\024\207"
+	.ascii	"\024\271\212]\305\260\242\221\242Y\361\254\250V\\+.)2)\316\025"
+	.ascii	"\351\212yE\275\"_1\212\361\203\021\204q\204\221\2041\307\210"
+	.ascii	"\302\310\302\330\302\b\303\030\303\370c\0042\3320\3360\032\031"
+	.ascii	"\217\214<\214J\306'\243\017c\225\321\3128\304\210e\3542\0221"
+	.ascii	"\206\031\215\030\313\214fF5\343\232\221\211\361\315\330\304X"
+	.ascii	"g\3243:1F1\366\035A\034k\216$\216%\2169G\024G\026\307\026G\030"
+	.ascii	"\307\030\307\237#\320\361\306q\350xtD:\3628*\035\235\216O\307"
+	.ascii	"\251\343\217#\220c\220\343\326\221\353\bv\f;\0369\222\035\321"
+	.ascii	"\216H\216kG\266\343\222#\223\243\334q\356hw\274;:9>9F9\366!?"
+	.ascii	" A m\220\"\2207H\034$\nd\n\244\013\344\013\244\017R\006\262\006"
+	.ascii	"2\bI\204,B\346@\352@.!{ } \241\220T\310*\344\020$\026\222\b\262"
+	.ascii	"\b\322\bR\fy\206DC\262!\333\220qH9\344\035\022\017\t\005\271"
+	.ascii	"\007\317\3004\260\bx\004l\002>\001\257\200Y\3000\340\030\360"
+	.ascii	"\017\f\004\333\200o\3009`\035\360\022\334\003\206\202\243`+\370"
+	.ascii	"\n\306\202\263`\"p\021x\f>\002\243\301H`6\270\r~\203\341\340"
+	.ascii	":\330\016v\002?\201\373\2222\311\232d5I\"Y\"\211\"\231\"\351"
+	.ascii	"\"\371\"\331\223\364I\322H\326H\016%\211\222H\311\034I\245\344"
+	.ascii	"R\362)\351#\371#I\225\f\222\024\222\334Jr%\303\222F\222eI\263"
+	.ascii	"dZR-\271$\311$I\227l\222\314K\352%\371\222Q\224 \2245J\022\312"
+	.ascii	"\022\312\034%\ne\013\245\013\245\217R\206\262\2062HY\244\304"
+	.ascii	"\241\324\241LR\366(\200\322\207\022JI\245\254R\nQ\016Qv)\211"
+	.ascii	"(\303\224F\224eJ3e\032\001\224J@\240fq\200K\306\206\346\001-"
+	.ascii	"\r\233[\333R\21555y\376%Z\022%\222<\347\267\320\b\260\023\177"
+	.ascii	"W\236\361\030#;\222+\375\226\036\001l\304Z/\260\257\226\337\332"
+	.ascii	"\003!\257\310O\213k\213\303{\001\245\305\337\225YJ,\t\375*\210"
+	.ascii	"\022H"
+	.ascii	"\336\364^B tY\001\245~L\035I\305\337\225Q\302\246''\016\357\225"
+	.ascii	"T\3044\303cI\251\224\007\275\327\022\b0v\b\217r qx/'\020D\304"
+	.ascii	"\337\225F=\312\033J\"\345P\207\367R\333`gC(G\352Q\025\226\210"
+	.ascii	"\312\237\372\237\234J\032J\240\020\336\313m\003Y\374]9\343\205"
+	.ascii	"Q\263&\234\312\036e\214\226\367z\3330$\376\256\344Q\276\020A"
+	.ascii	"\271\343\241E\320"
+	.string	"\255\b\245\243d\241\\AM{/\273\r;\342\357J\025\312\024\030\214E8\312\023J\023\271\322\177\371l\230\021\177W\336\034\225#\224\"8\374\027\320\006\234\370\2732\204\262\232#\271,\2161\220cM\345\214\362\203\222\206\332\366_I\033f\342\357J\231d_\006\370\311\036\224\016\377\245\367\346\304\016/y\327\341\277\3664\204\305\337\223u\312\261f2n.)\027\302\203\001i\200\202{\333@B\233\022\267\374\346\301\2224 \305\337\223l\311\265\"Z\335\3368\223I\222H\362\231\007S\323@#\376\236<\033#;\222\007=\230\233\006\035\261\n^5k\302\231\004\373\312\207\036\354MC5\376\236,\222\354\022!I\304\353S,\300L\315$\226VV\313\203\351\335\305\337\223CR\254\200$\257\362\234\017#\032\300\222\370{\262\nG\324\224\324\321\030\024\006&\247\246\226\017K\n\322#\251f_8\223<\222;\362\241\017[\032"
+	.string	"S\374=\251#\003\024\034GI#j\333\2079\r\240\250H\002\241\0336\320\006"
+	.string	"#h\202\031@?-\037\2466\200\022\361\367\244\f\nxb$a\344A\037\346\366\301^\374=\271S\301\212\272\225r&[\260\310o>\354-.\376\236\324I\2528Z\360\223\321L\342\324I\023\316dN\362D\313\207\315\225\305\337\327\037\311\233\\\307D\316\"waS\263H\316\344\210\244\b\240\017\266\342\357\311\020\030\320$i\222 \222\037Z\236L\310G\374=9\223\301^\024\230\257\345\311>(\202\022\007"
+	.string	"\274\232er\302zp^\336\364d\037\354\304\337\341\273\271&tI\037\224\220\2133j\240\204\311\222|\350\311\226<\340\213\277\303n\271\021L"
+	.string	"\322\3405X-\017z2'\017\340\222l \254k\302egf\324\266'CC\213\277\303d\034@\205\211\301F\250G\236l\316\003#\361w\030\f\366\312\221\340\243\"\220"
+	.string	"\266\272\270\354\262\264:\250\021\244no\234\360\020!y\316\223\351y0\025\177\207\201x\360\243\212*\277y\262=\017\222\246\244DhS$?\200\231\234|\300O>\036\300\210\277\303M;\224`\036\371\314\227\001y\220\023\177\207\2234\300CF\365C9a$\370\210\332\366eB\036\200\210\277\3038`\"\021\340\"\236O\001\246"
+	.string	"\277c\260\001\256Q?\232\023\026\202\203\250m_F\324A^\374\035\246\001\202\317\fXF\376\363eG\035\220\305\337\341\036\002\274\340\201w\362\234/K\352\240\313E\213d\001R\350\300*\362\233/[\352\340G\374\035F\001\347(\r"
+	.string	"\227\200q\340\233|\350\313\234:H\212\277\303$\016"
+	.string	"\177\240\331\236&\\\255[)'l\003\207\310\225\276\314\255\003\031\361w\270\006\006qA\006\b\210R\377\223\023\226\351\313k\276\354\255\203\021|\t\320{\342$\337\3712\001\3445\261\253\263\373\242\233\303`\001H7&p\310\267\034\352\313\364\004\340\264DI\006\001`@\332\232\032u\353\313\366b\304\337\221I\220H"
+	.string	"\320"
+	.string	"\344\030\231\031\262\214\272\365f>\002\2209\022\305\201\003\202:_a`-oF$\027\177Gz="
+	.string	"\231\265\325\205\344\312\233\336\354\210\2032\255\256d\001\320\f\210\020d\220|\350\315\3648\320\212\277#\257\220VRA\031\251\037S-o\266\307\301S\324T\020\247\251\376''\362\t\351D\205\362gN\034\300\210\277#\231~\354P\342\201v\"\211\352\257\214\220H\310#j\333\237\251q\360!\376\216\304ac\350F\207?s\333 .\376\216\024b{\232\310\237\372\351\234H\032H\240|\347\317\3466 \022\177G\316X\257\276`\324\255\224\023\331\023\203h\003'\236\035\027\310\212\232Er\"[ Y\264\374\332\321\006C\361w\244\016R\0050\b\322\0042\007y\"i\003\025OBF\224@\222\350\360kK\001\350\213\277?\324\220\232\020\310j\376\363kN\001P\303B\312 i\2203hZYP\370\366\334\226\264\360\364\362\250i\277f\027\200\031y[tuM\362\232_\333\013"
+	.ascii	"\t:\256\267\270#\\^\363l>\032\3301\351jS\342&d\266F$\211\332"
+	.ascii	"1-\204g;\322\300\352\254H\331\331\321,\207z\266$\r\212\304\274"
+	.ascii	"\002\353\312\364)KW\352\225!\022\326\240a\004\226\r\022`\346"
+	.ascii	"\030\031\271\342K\032_\261\351\027\351\2045\031\255\247\312\225"
+	.ascii	"\276]d)\376J\220\200?\353\225\n\313\345\\\\G`\221W\246\304#\264"
+	.ascii	"\266\361\345rF\256\315\031:46g\350{l\316\320cs\206\026W\225\372"
+	.ascii	"9/\345\346\fE\026\353\351\215\204W\332\236a\230\366\314B\217"
+	.ascii	"P\337\262\312\214\033\327\273\226F\217\353\223~\221W\226\262"
+	.ascii	"\324\236U\336ui\313\314\032\032\034\256\316%\3152\\\213\353M"
+	.ascii	"\201\210\2774t\266W\344\245}\313\365}\333\027\326\341\312\262"
+	.ascii	",N\355\245mL\256#\260PXG`\301\200\273L\243\265\205\371\245\266"
+	.ascii	"i\346MG\233\321zigXo\232\266\2334S\366PC\345\227\351\nr\365\340"
+	.ascii	"2\313\036f(\2742k\031\257\243.\306\025\277\347\025y\303\323\203"
+	.ascii	"}\323L)\324\256\347\t\242\365\222\276]<\330\257\007[\302\352"
+	.ascii	"\274g\250|\3134\263\266m\372E*Oo(\206\3659\205\3167r\275\231"
+	.ascii	"\365\324\226\260^X\361Y\2459C\361g}\337\266\324\216iRX\227\313"
+	.ascii	"\271\302z[X\357iS\236`\\o\250L\333.\3704e\275m)\276\254\231\264"
+	.ascii	"=\225\351\227\032\237\316\314Y"
+	.string	"\366 Uq.\347\247J\206\242\207\031Z\\\231\321\031\n\225\276+\024f*3\351e4\346\216\272\310\364\355\002\257\312#\024F\302z\323O\351\273\322.\317\371\305\266\245K\331f\301\217\3075f~&'\300H\237r\004+m\2730\225\026V\346\373Y\317+)\360\232\264g\251\n\3629\253@\353\346\273\306\340\365r\236\316E\0173\224\302\363\351\262R!ZC\357\372\246m\032\277cX\214\253M\3434\324\270\244q\232\231\362r\313\364\355\202\264\351\347,\343\263\312R\031c\3238>\253\310\364\322\226\256\244X\220\2602\245\265MO\361Y\245F\256\315h\035\265g\230\013\353s^\326xm/e[\272\"\333.L\f\304\232Y\\m\272~Nk\374\351\002E\3163\375\234\227\367\213\317*\365\r3\307X\230\326\317\025\030\351\023\371\234m\334\205\216\312L\020\210+\023\204\t+\214\364Y\\Y\2325\013\023\004#\223f\202"
+	.ascii	"\257\364\375t\231\3126\215G\351\245\022\n3=\302\253\364\305\246"
+	.ascii	"\357\250\213\\\333xr\305\355\031\277\345f\264\226\237t4:\263"
+	.ascii	",S\2305T\266Yp\327f\271i|\266\211E\343\362\035\022a\346\030!"
+	.ascii	"\361\275e\2309f\350\234i[E\236\247\370q\236\342B\t\025\236O\251"
+	.ascii	"\215\204m\032_\316\366\314\262\224q\251T\205\266\361\2319u\221"
+	.ascii	")\254\323\332)C\227L\331\005Z\023\237\317\031z\277P{\276kfr\205"
+	.ascii	"\332\263\214\337v\275\"G\245\362s^RXm\232Y\277H\355\251|O\233"
+	.ascii	"\305\030\274\276g\025%re\272\314"
+	.string	"*\362=m\032W)\375\254\237sS\246o\027\n\036\244O\225\343J/\243R\231\206JYd\234\276\345{\332\264"
+	.ascii	"\302=m\302\302\225\031\235U\2303\315\224a\346\230\342\312\244"
+	.ascii	"o\233~\241m\2309f\302\n\225Fi\246|\337\364RjOef=MF\351\027\332"
+	.ascii	"\236b\250\200\306\347\227\032_\3164S^Y\221\322\316\031\227cf"
+	.ascii	"\2309\352b\013\240\030\255G`\221=\314\320\t\253t\352\201\226"
+	.ascii	"\351\027\333e)\257L\237r4\206\231\242d\302\022\326\021X\344\r"
+	.ascii	"\311u\004\026\346\221e\211K\243L\345\035\245\247P\351Rn\316\267"
+	.ascii	"\214\317*/\024\326Yf\326S\t\025b\360\372e\266\233r\215G\347$"
+	.ascii	"\323\236al\351\n\223\246W*,\227\363\220\331\204W\346S\312r\323"
+	.ascii	"\265t\212\323w\312JCk\234\270\306\314O\232\371\256\023V\t\310"
+	.ascii	"5\306\246_\244K\332\226Y\356\331^\036g\\z\\_X\271N]\230\321\032"
+	.ascii	"\246\270\3324^\277k\021\352r3\353)\274\216\300\"\337\367<\205"
+	.ascii	"\221>e\2309\346\270\036)\244\2547Tf\3164\313\354\224J\237\027"
+	.ascii	"\326\273\3660[\260\351h=\333\270,\265\227srZ\273\356\212;\255"
+	.ascii	"\231\301\225\340\264\006\256\300\025\340\204\225\005oFi\033\277"
+	.ascii	"+\254Qi\215+\337\025_\322++\022p\233\236z\240e\374Y\343rT:Bm"
+	.ascii	"KYR`[j\333\264\205ueE\212\273,o\225Y\271\312\364\355\242\\=\314"
+	.ascii	"O\332\226a\346\030\231I\343\263\335\244\361h=\201\370\2560s\314"
+	.ascii	"\020~a2q\227)\356\"\225m).\205*W<\352\"]\322\317zEjOe)\3562\343"
+	.ascii	"\364M\3332\214\364\371\2341\254x\224^\332\364\324\246\233\315"
+	.ascii	"\332\306)hFg\345\032\255\347\246\374\224\332xT\272\224Y\226Q"
+	.ascii	"\227\371)a\265g:Z?e\374v\261Yp\343\023\307\2456\013.\343Q\272"
+	.ascii	"\276\243\263\215\247\254\323[\246\361\371)\235\256\254$\235\365"
+	.ascii	"\364\226WV\216+^C\353\247\354a\206\312++\311\325\226\342\313"
+	.ascii	"yEf\301\245R\350-\257\254\300+~K\245*\362\312\212\220^\316\266"
+	.ascii	"\374\244_\350're\3228\364\211\027W\017\364s\352\302\\y\316,2"
+	.ascii	"\364\211\037W<Z\313P{~\3162\216KY\216+\364\211\313\321Zf\326"
+	.ascii	"S\342\363I/i[\002\206'\355\262\342!f\004y\271\234\2313\315\302"
+	.ascii	"t\301k\3749Kk{~IY\233Q\351S\306\347'\223\246\247\267\314\214"
+	.ascii	"\272H\355&\005+\275\214\316\370]3#X\361(m\333.K\2729\343O\351"
+	.ascii	"\213\274\274i\350\324\306\260\274\351\013lz\n\245q\231I?U\346"
+	.ascii	"\273f\31216NC\351'\215O\260\336\313\032\277k|\306o\331y\3178"
+	.ascii	"r\245\231R\250\334tQ\241\231D\230[\276\245S\003\3104>\333\360"
+	.ascii	"J/g\273)Ke\033f\n\2574>\3332=B\r\255\361\251T\266\351\247\013"
+	.ascii	"\223fY\336\026\326f\264\206\332\263\354\\\326\370-\323O\2259"
+	.ascii	"JKX\2414~\307\334\262\224f\326/0\313\213\314\\\276\024\237\322"
+	.ascii	"%~\273|\2009\3130R\033\303\372\234k\233\276+\254\267\215\343"
+	.ascii	"3\205\325\031\255\237*2}\273\310\323\033*\343\266t\0323?\247"
+	.ascii	"w\315\254 Z\313L\372i\\\233\365JT\272,\256\036\244*\262\264\216"
+	.ascii	"\326\323\341zcX\237\363\213M\343\321Z\306\247P\032\307g\371\205"
+	.ascii	"f\312x\035\255/X\243\322\372\266\351\027\371)]Jq\251=\275\260"
+	.ascii	"\322\266\013>\323+2\275\254_h\346\322\326\240A\203\006\r\032"
+	.ascii	"4h\240\2471\370\355\242r\\o\027\225zz\273D`\271\2416\256\367"
+	.ascii	"M\333L\346,/7\324\266\364\216\322\267\204\365\371\224\332\311"
+	.ascii	"\225e\211\327S\345\n3\307\310\321f\375\234\345\r\262\324\216"
+	.ascii	"i\302\353M\343.\321\032*\343\364\275\262\"\225\351\250t\004\032"
+	.ascii	"Z\343\026\2304\324\236\345h\r\255\260\3368K\263~\256HXo\231\206"
+	.ascii	"\3268T\306\357\232)?g\\\212\3137>\343\267\262\257\364\322v\221"
+	.ascii	"\3362\376\234\345\250\264\306\353[:\225\240\201\206\316Qy\203"
+	.ascii	"l\323\267\213\354A\252\202\\i\350\034\225A\220m\372v\221=HU\220"
+	.ascii	"\353\322\203\273\031\255q\234\276?\250\237\313\017\242\365\f"
+	.ascii	"\375`i\337\037xpa\225Ni\373\003\\*\265? \2564t\216\312\004\220"
+	.ascii	"m\372v\221=HU\220\353W\275\325c}"
+	.string	"\326\027y\257\037\373#\237\366j\317\344\337\336\356\357\376\311C\371>V\206\265aE\260(\330\024,\f6\006\013\304\322`\207X\"6\211\335\301>\261>X*\266\212\025\302\016a\211\260EX#\254\030{\306\242\261k,\033\373\306\302\261u\254\035\353\204}\322\312\2643m\210\326\246=\321\346\264-Z\027m\214\266\247\005ji\264DmQ\253\243Mj\233Z\247\226\252\255j\261\332\254\266H\353\325\216\265GZ$m\222vI\313\244\245k\233\264z\255\2236J\333\367\253\371U\177%~7?\024\277\024?\027\277\027\277\236\237\317O\350g\343\207\343g\364K\372\355\370\365\3701\375\240~Q\277\252\237\325o\310\017\353\327\365#\362\013\373\031\371\225\375\314~i?\265\237\222\337\222\237\334o\356w\367\303\373A\371\355u\231>\323kz\265\217\350$\272\211~\242\253\350\001\214\314\250\024\345\034P\"\361\360\310\314T\t\f\004@"
+	.string	"Hc\0304P\020\227&r\"\227w\024\200\032|rB&6`(\020)\23160C"
+	.string	"\200\016y\261\200\2064X\323&\302\252v\263;\316\350\264UGo\374\f\027\333\024\200\3629p|\241\027|\216}\t\203\204\034]\r<6\322\241\357\304\03778\254\002\331\236a\034?\tjMA\\\223n\264\317;\032\220\231\271\375)\0254,\363\261hx\0303\315?\346zK\234e\301\327\226Y5\215\213\270u\314c\377\345Di\3502\263\\\306\315&\377(\256\326\n6\326r"
+	.string	"=\240\265\236n\200\232\206\346\243\312\346\001\227\023\0048\f$\003\246s\304T\256\271\b\263\023\205\205\336\252=F\256\300\271\271R\373\034\021\210W\002h8\213\227\332\263J\200\352\246:\032~\342WA\254\3043:lH\352\240@,\363{_\263\212\273\261z\020\226f\026\301\224\231\"q\177\254\324\361\250\352\363\374\246\330UG\312(\216\331\034(\376l\364j_\361\364.\214\350y\254\3251*\236}\274,\177\211<\245S\301\003g\276\020\320\036\306\033s\213\350"
+	.ascii	"\005s\373\363\235\377|\214;\036\200\321\347s\355\334\203\217"
+	.ascii	"\037\363\306\024F\204\036\245\262\226\024\306\316\374\207\330"
+	.ascii	"sb\326\221\320O%v>\323\312k\207m\300\210\251\240\373v\244J\220"
+	.ascii	"`\266\262]\322\261\316\246!\231\002 9X4\r\204\265\365\267\033"
+	.ascii	"\276F\331\025\242O\210s>\242\202$\303\354\205={\t\317\331\227"
+	.ascii	"\254k8N3\306#\201X\225\335\367\226\035z\246\n\241\233\271\326"
+	.ascii	"(T\b(\025W|`\217\370\"z\234\037\027X\354\206eM\017\t\271\200"
+	.ascii	"\274\030\245\235Ix<U\321\202!\206\t|o\244\374\336A\332\272Z#"
+	.ascii	"K\037{\272:\240[6?\347\367\253.\374\031\364\005\351\032\345\255"
+	.ascii	"\3401\362\004\216\020hLT\221\366\250p\341\374\334\254F\272\212"
+	.ascii	"\345\313\206p\330y\204\304\372F)\350\033O\254\202\016\017\237"
+	.ascii	"\361\377\357~N\230\307\335|\020\225\360\265\232\266,\n\374\317"
+	.ascii	"\362Zq\246dQ\256\267Ob\333(\367\017\255Pm\024D\201c\250\\\\"
+	.ascii	"5W$\2032\373R\367\022W?\326=2\262\312\215=\"\363\004\305\373"
+	.ascii	"\324\215J5\b\272.\207\315i\353\245ECW\351\351\2608w\2578p_\f"
+	.ascii	"D\260HE\002c57\204\234\003]5\231\234\353\227\313ta\036f\006\200"
+	.ascii	"-\317\375W\317?\350\026\264/\313)\030\366;\242\312\031\213s\240"
+	.ascii	"~0\357\222\001=\335\372\217\211\273i\264\240\346S~r\203\270\202"
+	.ascii	"\244.t\355\24086a_\364\252\220\341\342+\324\321[\032\352N\243"
+	.ascii	"\377\004s\333 \377\216\376\357\bP\230:b\004\263\b=!ReO\324\220"
+	.ascii	"*\356t\333As\224\2218\013\022\375#\363\206\241\317\2752c\333"
+	.ascii	"s$c\001\357\277|$\034\032)\275M/\270*<\\\257\331\022<\314\300"
+	.ascii	"S\265\272\330hoi\306EB\017\321\367\352\315\225\221\325>\255\230"
+	.ascii	"\276\217\240\337\013y|1}\021\342\256\021\356\223\023c\374\257"
+	.ascii	"\2753@f\326\226\326\335\037\376\363\001\302Rh\370\201\314\254"
+	.ascii	"H \3133\335\330\233\277\237\375\213 @\251J\301}\201k\321\303"
+	.ascii	"\032\261\006b\313\371\220\372i*\025\320U\fQ\234|\027$\323>\341"
+	.ascii	"\t\204\252`'\021\320\252\320xp\243,!\251}\277\214\372\036\205"
+	.ascii	"9\277\n\252\261\345A\211u\337,^\333m\243\373\031\321|\323r\241"
+	.ascii	";\031\027\241\231\250!wp\006u\277\241\243s\245\306\027\327=\231"
+	.ascii	"\325x\207\262\231hY\211n\344\204\372\273\331\311B\314+\204\255"
+	.ascii	"\217\264\340s\0258\250!\277s\320\0053\0257\272\2356\302yw&f,"
+	.ascii	"\255\250\336V\304\351-\212#V\034{\315\354\272[\377\257lT\303"
+	.ascii	"\004Oe\231R2\261v\335\035w\332sz\026\311\234\037\b\324\245\270"
+	.ascii	"o\370\004\376g\220(?\315\356\037d{\337\321\375\326u\351x!iq@"
+	.ascii	"\021\341I\255\033\230\212?\201\bco\277@\373\366bsX\016\336\017"
+	.ascii	"\006\002O6W\305\214\307-\177\\s[\354\347C\320\225\030P,s+v2\266"
+	.ascii	"\277\216\335\330\366u&\313\303\004\371\230u\356\333\244\363\017"
+	.ascii	"\226\275\315E\202>\\\031\306\317#\371\344\377\266\253\252wj\331"
+	.ascii	"I\233\035\363\257l\247\267\224\340\306\307\356^\374p\177E\212"
+	.ascii	"^A\021\013=\377\212e\271\211\216\037;\242\204`\362\017\272\241"
+	.ascii	"\267[?"
+	.string	"\235O>,\214\304\207\323&\230\232l\334\350\341\373s:\\#\275\356-&f\3331\303\242N\\\342\272\232\242\034\377\215U\324\34213\356\263\253\024~a\0362\347S\300\2000_\017\022\023&\310\001\276N\002\311\334\341g\020/\211\365\362\032\033?\3301T\243\264\252\275\337]4*\260@R\027\231R\032\225\322C\336h\004p\215\340\262\341\331\352\227\3102\t\226\021\203g\204\304%\267\356T\307|1\351\226\250h\340!\"\371o\304\341w\215\274\217<\\V\034p%\234\252\3115\264\322\305H\321\253V\250( \006zg(\251\022`\323\212-[\205d\372\343\367\214\365\213\356\363\244\023&\241d\267\333jxN(]`\330\300x\331\200.\322\324\210U\305\002=\\\315\331\315\032\207\373\200N)\204\031\036\254Ys\020v\303E\273\030\220G\n\273\246\\x\201D\212pD\314*\334\233V>,\254\254}\266\252\344\347"
+	.string	"\032-\2103\200\354\204\373M\027\005=y\\'V"
+	.string	"=\272}\357q\017\341t\353*;'\ng$\363%PU\236Z\353I\t\254\304PT\222\344x\201_\365\003U\037Y\022u\223m\020c\322f\350\364\2323d\"\f}\006\315\340\352\023\022B\235\320\334\016o\257\221\323\256o2\355\217w\353]\346\232G2\242\345\210\372\274\202i\304[^\333\315\376\236l\351\244\313\005\371\250\246\200\226$\351\201(\2410\241\260\304\223\240\202\245\034\025\247\375I\377\206\207\367r\013e\324c\355f\371\323[\3120\220H^\304B\004x\236\006_\b\247\n\374-\004\367\253\267\310\340kK\221D\232\027\221\351\303y\353\026l\360eC\223\222{J\003\177`\005g1\255\360\264\017~0!\344\275R\207w\333Q\266\"\325?\206I\"\312~{,\320FZ\271\320R\261#\374D\370\346b\3132Y-\022\200D\240\362Vl+,A\267.$\337\231\363\345\372\214\254\340/"
+	.string	"\037\357\"T\323'`\206\326\243\027\336A\321\022Fk\362b\234\254\206\277\234\236qN,\316\234\374*z}\006p\231K\277\311\177\275`\207\241\313\315U\323B@\343\253\257\024\360\022\004\027\353\237>N\216\313f\351\272\227\b\227$\031\003\227kKh\357&\3119\257%WT@\224e\236\224\276\016\220\006\307?\360\001\372\212\200e\026\303\034"
+	.ascii	"2\302GU\207\034\227.\002\033M{\025\232\3520;\231w;-2GX\032?\366"
+	.ascii	"\2644\225h\004A\320=\355\315\004\200\317W-G\232\036}\2774jf8"
+	.ascii	"\231\177\277\331\266\300G\024\237\345\366\364g\211\271\373\336"
+	.ascii	"\372\247\367\227Z;\325Z\017\2435L\234.\nZ&\204:\313Q\211\024"
+	.ascii	"\026Wn6\207\352Ja\211x;\032d\\\367\321\037.\005v\226\271\343"
+	.ascii	"\376\353b\203\330*\232$\354\034I\315\374\001\307p^\275@\202\366"
+	.ascii	"\315!\325w\340Ob\260\377\320\034\023N\321\231\213\271\007SUN"
+	.ascii	"t`\302\255&\364\267\226Q\304Y\236\037\316E\206\035\b\375&\222"
+	.ascii	"\366\323\372ce\251\336\331@\247tuF-\276`?\300\257\212Q+\376$"
+	.ascii	"y\020/0\237x\256\226-o(\376f@\276\020\032\320\311O\322yi\323"
+	.ascii	"\242\177\032DOc}8e\262\210+ZI\022N\177\315O\216\031#\247\032"
+	.ascii	"v\262EW\033\2208\232W\024\271\267N\fT\332\006\311\265\232^|\354"
+	.ascii	"\\\352k\232l\205\302\336\372\215\325\373%\177p5\204\335\214\020"
+	.ascii	"\030=\312\377\036\027!\352a\233;Q'i}{\\\207\374(PkE\341\347\320"
+	.ascii	"XpU\b\303%\320\253]\313{\330^UW.8oV \207\314\254\215I\205\254"
+	.ascii	"\204\272S\016\340A\340\210\020q&\355"
+	.string	"q\211o\335\227\326\201\025\321XR\320\203J\263\007\242\363f\025\236q\332\237({\035\250\215V\013Q\210\305\007\n*;\031\323\314bv~!]{\372\346\030\030g4\330\332\331/.\260#\275\365\022\003\361\331\307\235B\222\264?\022sU\002\214?\215E\302O`\275%3\262\266\200\230\001\3245\035yy\003v\240\333\274J\307\367\324\244\2400C\351P\242^i,\001\321\3035\354\315l\177\"0\370\203\027\035<<\366\232x\235\3067\262Y\274\004\0202\277q\200hE\026\274\254\022.\217\2166\221'\303\205B\326}\311\306T\037\322kQP\211\321;O?\302\323&\326\350Tq\247\233'\0320+&\351\340\314\250\344\001pG@\361*O \326\257\232\264X\375Ga\021.\302\306\345\271!\006\005\306X\006\315{\257\211-\271 q9e\025\2445\347a\374\324\336\260\311z\374\305\022\213\n\022\242\263\002\342\347G"
+	.ascii	"\240(\277U\257\304]\006$\221\365\251\377\250 \263\344$\316\376"
+	.ascii	"\212\037\274e!0\031\353\017]8\237I#\373wb\273l\2636\230\366\334"
+	.ascii	"\346\370yYwE^\361\372{A\325\275J\371\224\377\303\367\336p\t\377"
+	.ascii	"c\374s\251\365C\214\231\247\337@\301\177\264AB\347^\037A\210"
+	.ascii	"n\231\211 \305;\233g\313\234\315r\233\332\312\362\3033\302$\250"
+	.ascii	"s\307\244\331Kz\261\376\230w=rR\352\026-\376\373\371\310\210"
+	.ascii	"^M\365\"\013\334\230\320Dj\371{O\206"
+	.string	"e\334\213\241:\267\347\266s\260\\\005"
+	.ascii	"6d\255\352\326\344,\344\017\260\202\324\321}\276\367\337\362"
+	.ascii	"H\035\333\205J\355\302~A{\b\227\246t\215\367\b\273\311\021p\273"
+	.ascii	"\030A\377\004d\342\224\020\t\300_\233D\302w\252D7\275x\007 \251"
+	.ascii	"qK[\240)\177\265\022\265D\004\335\251/\330P\220\002\270\247L"
+	.ascii	"F\n\202\301g\003\340\302"
+	.string	"\024K\3461^\331\234\026\267\302\335qV\240\007\224.\020XH6n\016\254\024\277b\326\301\215\n_-\031\215\234\216Y\244\025Pc\213\372\027\347\346\242\306\026o\033c\224\220X\001\2163\0014\263\231O\207\0022%\t\304\355\003|\361\357\254\332\035%~\215\252\205B\327G\326\023\355%\231T\373\227\nX\030\024\245\322\3269\2160\013\241`\300\201\225\373Z\237\rF\263\036B\253\316\300^p\334\225\241C\016\312\321\322\rA\004Z\374U\273\233\350\263\001\246\200\261\f&\213\t\267}`K\333nN\\\331Mh\002\243\206\304\002\026\372\332\005\211\262\b\224Z\355m\213<\266\240{\001L\300:\362cfs~\006\256TC\306+frb\362\270A\257\345\344\026\246\375>\212\315m\345(\003\361\361\005\334\2643\231\032\261\271\312\214\215~\245|\023\312R\261\211\323\244\236\0232\377%\366\364{\231\0267\203SoSi\200\026"
+	.string	"\037V\306\377\325\205\251G\0048\221\024~\203z\026\356\3053*g\261\212dR\241\227\231+\354\250R!\030fe\277\263\211\221]\271\273G(\310\030\327\017\277p\bHu\207hW\255c\206\r\232\377\nGMq\262\226\355\241\230\232\b\022\360bX"
+	.string	""
+	.string	"\255\257\326\302uM\002"
+	.ascii	"A\254Z\027\373\303\3153\2001[.s#\030 a\231\312\013{\317\270\246"
+	.ascii	"G\346\022\206\341.\037L\271d@\3631\351;\t\362*\334wDC\023\310"
+	.ascii	"\2321\236\263\t$\357UI#%OE/\003/\226\350Y0"
+	.string	"'.\335\365\212\003\020 \326E\337\360?\2220)\236\346\013\363C\246C\306G\234\333\356Y0\247\300\370\320ve\235\313\017v G\303*\342\365\360^A\273*\364\266\226\300\306\230Km1\tH\247\340\037%V\255\300\260\271\230\261\301P\020\024\013\323\207\257\020\206\2251\"\353\300tggV@U\222U0\025F\253\300\355O\364\236)\256\335\312L\302\312@\022\233\034\335\003flu\3273\371_\265\203el\316<\352q\300\"\346N\302k.\246\227\222k>H`\256\3142\337<\017\345.\004\350D0p\277\272\3027\263\326g:\213\343]\2432\302\273\r\346\226\213\300T\326\343\320\233\003|z\243{\002\236\276r\321z2g\002\007\332\354\206\232\322\266B\260\322\260\234\261\034\023\242\217\0059\373|\"\361\323\004\372VU\234\334D\313\254P\277\2541\304\215q>g\317\217ON`\025\302E3n\r\343\013\3747"
+	.string	"\223\223\250\036E\254\260\353\365\364\213\260=\3622:\330{\030t\216:"
+	.ascii	"\210\363\317\344\003!\n~\233\341j\365*k\0330;\231Q&\022\037\213"
+	.ascii	"\027g\336\242\024G\b|}[r-s)TB\376\325\\\277X\340\233\232\356"
+	.ascii	"\271/L\251\357\343\302I\240q.p\016\231MiP\212\225b\324i\301\267"
+	.ascii	"?\325\027\316\034\277\252~^#\317\312\247N\031\026\027TZ\373\006"
+	.ascii	" \300\342\247hU\025\257\230\356b\017g)\240G\253\274ni{\250\037"
+	.ascii	"^\242\370\261\342\201\356,\r\327\226\023\224J#\352\202\261\205"
+	.ascii	"\027Z\017\211\260/\037\335C\3040\220`\322{\013\275\244\017W\016"
+	.ascii	"\371\037\254+\361\261M\245h\345\016\244M\373\177hD\224\304fo"
+	.ascii	"\341\251\016z\031\005\036\357\354Y\035;\013\021\372\203pN\017"
+	.ascii	"\226\275\215%\231T\203_\277\002\177\317\027V\225\324\027\334"
+	.ascii	"\017\200\350/D\375\346\376\361\216\344\375\2701M\336'G\253D\275"
+	.ascii	"\330d\\-\007f\331\316\007'f\313Yd\3252\345\003h\b\017\251: \353"
+	.ascii	"\\\206\336n\241\332\325J\353\372~\345\352\327e\240\232\327^p"
+	.ascii	"U\034\217\224O\354\013\215k\230\241\1775\005\013`S\3126\232&"
+	.ascii	"\301\033\206\247\2450\025\f\226X\246\tc\323lr`\323%\006$1\030"
+	.ascii	"\226\026\002\315\226/\365\354\003]\273\2250\2047\316\351\360"
+	.ascii	"\215\267k\222\035f\343\2345!\375}\244-R\032\223#6\r\312=\301"
+	.ascii	"\270h`\364\322Fe\006\220\345\251@\307i\0267\266\341\253\313\251"
+	.ascii	"\313\226\002\232\024\303n\266\004,&\335y\2378\003\366M]u\"\351"
+	.ascii	"*\241\344/\270>>\345\306\376\2745\237j\311X\226\236\324\324V"
+	.ascii	"\034\244\227k'\216\203c1\255\200@\307\326\006\b\334\304\033\317"
+	.ascii	"19\234\310\367\233\207\227~w\365\232\356\203p\321\024\017\274"
+	.ascii	"\250\232\013\362\213'\346\3134\007\327nx\266\237M\246\303\230"
+	.ascii	"\314\270_\363\340\231>\304\2239m\341\343\021\322\nO\366\223\233"
+	.ascii	"e\\\013<K\016\242\271\201\333H\341Ej*\350\331V{L\256\200\220"
+	.ascii	"\267k\004\325c\266\350\247\242\262\n\370\260"
+	.string	"\365\247\223B|\225\317\307\267\213e\275\326B\007\337\035\300\240\016\205\037RG0\321@\335\316\004\255\034\2176\211\331\224i\307\326\242\017\323\306\334\376j\275j(\220f\227\004\024\233\262\345\326\306\2706\331\207\317\243\275\235n\246\rt\274\357\267\234\263=\n\261\274\2275\365 \r\316\345\323d }\301\n=v\223\300\2323w\251\216\335g3\224\256\022\311\351\243\312\346\024\243p\027\263\370\335l\036\027\343\0035bA\377\200U\220\233\031Xv$5\037\227\265;\224<\375\310>\201\242\032\264\346>\333\027T\365\317\224Q\022\316\325%{6\271\035\277f\024\263\304A ?aJ\305o\223\341$%@e\346\265\250'\034\317.\033<\215>\301\022\fs8\326%u2\364\375\304#]Uu\303\021\261!Uf\272iieV\\\236o/\3734;A\334\3770\3200\337\322i`\203\331g\336~_+\370\224\3575]\233`"
+	.string	"\246\232\327"
+	.ascii	"}\333\2601\273\032\311\004\177+\264\037^\363cm\303\021\006>\234"
+	.ascii	"\354cw\315\300<\315\\\"\2664s_\301\314\ns\311\322\360T\330\347"
+	.ascii	"\214^\025m\302\223\333"
+	.string	"\022\323} (\272\206\233\302\036\032h\340\240\0233\255\t\355g\364R\246\352\264\321\317\207\017$sH\224\267S\372\315={-t%\315r/E\375\365\251\013\316\241\007}\034\236uq\302\221<1\017SC\314e\366\007/,h,\357\265\262c\214\3245U\226c\035e\032T\324\303\355\263#\231r\330\"s\362\315\272G\207\300\211\335\031yj\327\324\007\220\354l\353\366\265\031\220f\316\373h\274\311\273E\356n\177\020\270\r\033\370\b\016D\204b\313\035\216\t>BM\350Q\314\b[6\220\307\201\353\034\377_-\224\033\3022\310\356\320\243\260\302\033\340B\377\376\315~\2024\262\357\343S\232_\203\332\3655\262\203\304\276\337\034\037 m\261\347x<I\244g\226\237\030)\266\351@\310P\307N\027\330\376Y\345\321\277\227\277U\213\034w:R\203\027\200lZj\007\027\203M\270 v\257\253\334\231\211\367\345\322\232\035\r"
+	.ascii	")\034\226M\200\331\220\231W\354\004\013'K\375';\2059%\320\207"
+	.ascii	"c\032\274\224`\222\251j\231W\005\264%B\212*o\207\243J0\332/L"
+	.ascii	"\236\203ws)\2747w\225\243\204\216\3773SZ\351\216\001srI\025v"
+	.ascii	"Y:9\266Q\360\342\300\320\276\340\343\266)\252xv\024\376\257"
+	.string	"\250\211\0343W\250{\303\305D\242\266\t\247Y\026\322Dj^\377p\005\230JekiZ'I\260\364\330p\030\006Dq\256w\252U!\\\371|\235\220G\240\352\336\037\360)\035a1Ty\214\372%g&Hot\205\355\254s-%\271:\022\334\372\233m\325\202\324\203G9\001\221\240\262\277N\371\f=\313\342$\254h\356\023\350G:p}.!\223\310m\356\330\245\030\024\207g\203c\036\2268\031\321x\246(e\334[\023m\026\033'\013\035[\034]2\305\327\021K\271DA\360\033\203;g\264Y\236W\021\312\215dt\376\271,\371\22274\001\343/\234\213}"
+	.ascii	"G\223\322\205P\017\tB3\007s\240tX{\276X\023\276/\226\0130\t\024"
+	.ascii	"\n5\347\351%a\021\325\030$\0227\315\311\276\003\233\260\036\330"
+	.ascii	"\272\002\224\343\rK[\256\227t\305\320\215\325\222\321\346S\270"
+	.ascii	"\023\016\036\351\036\344\260\310\217\364\231I\346\215=\327\243"
+	.ascii	"\215C\374\323\271\324/\024\311\222y\206\346\3542\0251\306\236"
+	.ascii	"BM$Wz\235\321\217&\315\322\230gD:g\037\034\017\241=\003>\354"
+	.ascii	"\013\301Y\236395A\2351\261/\026\341>r\247J\225??\301~D\335\211"
+	.ascii	"_\2409&-"
+	.string	"\206uK$]\373s\332M@\375&\246^u\006\277.\250\360%P\004\232\312\353j\340\354\r\020?y\037&\347ZDx\352ogq\220\2202{#[6q(\240Y3\373\246\257\267\307\206\026\017\301\207LT\030\334\352\233\262\221c1\206\201|2$\242\203&!\251\205T\340\261\026:\264\375\3304\032\247\241d#F\273\217\230\232\350`\221|]0H\b\006\324m\243\244\026J\001A\300><\036\016~\243S\036\362#\204\246\310\314\272|\223\313\016Ga0\023\371b}\353`\242\304\024\337U\257\352\207\211\216]\313\rz\032\225\330G\250\240\221\213\006\356j\317\224\026\004\344\221[;\303an\324\270\306\360\271\343\332\235\310\255^Vx\nL\333S2\225%V\213j\313\026\330\\!Kp\n\265\fS\017^\246\244\315%\202\n\200!\367\037\370Z:\0160\036\313-w\235WL\302Z\375H;%a\270\0312\027"
+	.ascii	"\222\n<\266\331\002xL\036z\213\234\365Y\312Y\345\241&\255\f\275"
+	.ascii	"`\316\230\317Hf\203\265\273\304\214\2552+\216B4aq\316[U\217\207"
+	.ascii	">++\342<\241H\313\256\337\216Mx\324\242\264vC\343a\234\032\235"
+	.ascii	"\234\322P\253zLh\\\013,\344\224K\022lY\257\357\222\r\326\204"
+	.ascii	"m\317 \266\317\017\352\264t\251\336qLF\257O\223\006\267\352\350"
+	.ascii	"iS`\353Y.\304\027}u\257}N\001\320\367\017G\347\313\323;\r.\313"
+	.ascii	"C\257\313\205Y\226\275\250\303\321H\227\"V!\302'\242\230B\333"
+	.ascii	"\021\362\377B%4\013\277\362k[\214\262\354O.\304\236V\354\336"
+	.ascii	"\224Q\207%\210\223\016\n\335\231\241\035C\023\331\2551A\323\033"
+	.ascii	"O[j@L\333\2118\206F\316\320\325\230\345n\343\221\265\031\333"
+	.ascii	"a\257?\354\036'\375K\344\352a\212o\233\216\203"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`\022\001\275\b"
+	.string	"\242\31512\360\232$\035"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\3661\221Md\023\331D6\021\260Md\023\331\344g\340\031x\006\236^M\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"$!x\244%-\355\210\210\317\262\345\031\226\257\212\271rW\335S\231\253\230)o\241\254ur\226\311X%[\325=\222\253\21292\214\310T!O\201,\365qT\335\363\030\252\343\247br\354\264q\223\306L\031\343`\274t\261\222\305I\025\327P\2144\361\221\304Fu/\342\242\272\0071Q\335{x\310a\241\206\203\030\036+\346\3022\305T8\246\230\t\277 \f\264\315s\260\230\213\301a\005\377\020\3543p\217\300;\001\353"
+	.ascii	"\234\323od\333\324=7\215\266\327\177=K\034\254\210\250m\0014"
+	.ascii	" \320k\341\251\255X\261D\036y\344\221\332\nK\362\310#\217\324"
+	.ascii	",ImI\036y\310#\217<\362\310C\036\220GS[\261b\311<F\216\336\372"
+	.ascii	"\226-\213,7\332tcDF\036H\036y\310#\217<\362\310cjK\362\350\034"
+	.ascii	"\265H\022"
+	.text
+	.section	.gnu.lto_.refs.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375 g}\002"
+	.string	"r\306\022\027"
+	.string	"\235\264\006\374\377\377\377\377\377\314\275R_\257\324\327+B\204\020\251\310\247\232\332\242\236\232\226\222\216\212\206\202~zvrnjfb^ZVRNJFB>:62.*&\"\036\032\026\022\016\n\006\002f\261W\353vw\253"
+	.text
+	.section	.gnu.lto_.decls.7430578003c6e374,"e",@progbits
+	.string	"(\265/\375`U2\355\303"
+	.ascii	"\352,\001AV JQ:\303\001\266\370o\0025\314\363B\335c\361\210\267"
+	.ascii	"cW\355\321\3261\002'\345\031\325\3738\214\207\245T\273r\346\206"
+	.ascii	"\375\351]|\2401\342\204\006\240\227\343\345\370e\214o\3674\257"
+	.ascii	"uW\200R\224hB\225\247\244\275H\333\244(\345 \314T\025\333\355"
+	.ascii	"(\267\224)U\003\002\004;\004\013\345\314TU3\017\302l\031OR\006"
+	.ascii	"Ui)\260\314\212\331\262\223\t\227\302hrj\252\252\031\220\007"
+	.ascii	"\017;`Z\254Th\237\365\322\363[zf\222\236\305\322/@\355G%\305"
+	.ascii	"\217\373\214\225z\331.S{\273\256\227\345\362\020\"T\017@6P?\316"
+	.ascii	"\304u\237{\244\347\246\364\214\224\346\001\241ZW\314\210\351"
+	.ascii	"\245\027Q\205\207\007v\031\324\026y;\226\252"
+	.string	"jve\265l\226]\027\313\336}\251,\335\227\251\252J\252\252~\311\376\340\037B\304bY\274\265\302\203\304T\237p\362z\314\020\353SU3\017\036\200<\334\340-\277\250\245\375MK\277\313\364\233\2252u\236\236\202P\355H\277R)\320\376\240\347\372\240\033e\245\354\312a\247<\204\210\237He\252\330N\032\2604\177\334_\031\351\227\003\272\201\313\001\3752\245\027A\232\301\376\240\235\266?pj\232\245\311\243\n\367Y\244?J\277e\177\320\367\355\017\272j\301/\3332\361A\241\246\230j\232\252\252=<T\234\376\242p\237\271?hz\267>(\367A\355\017\n\"\211\003\351\267l\327\354\273\256\331\226\341\250*\023\016\314\001wog8\372T(\272\017;\177`3\266\270\317A\312x\273e\350&Y\261]\013\260J\276\314%{M\022\223\311TUfO\016\\\017\265(\356\f\373\203\362\372\240\337`\354=I\252\210-"
+	.string	"z\006\006n\001\320\177E\374,\202\237C\360\263\007~f\241\3749i\364\363\361\347\342\317,\374L\364\263\320\317A\377\376l\340g\r\374|\201\237-\260\341\277\227\377_~N\341\347\023?\233\3603\t?\217\3603\211\237A\230\340\277\230\377c\376\233\371\371\001?7\340g\006\374\274\200\237?\370Y\001?\003\375\347\237;\370\031\304\277\032\020\360s\005\377\346\374\313\363o\372\357\001\376E\300\277\034\374\333\301\277\037\376M\300\317\006\370\271\303\277\024\374\213\367?\313\177,\377\363\376c\340\347\242\177%\300\0330\001x"
+	.string	","
+	.string	"\326\2003\330\342"
+	.ascii	"0\006\314\201/\370\227\304\277!\374K\002\003\340\277\003~\306"
+	.ascii	"\321\246\266\204l\f\354\337\275K\360\237u0\020\341\221C\212-"
+	.ascii	"\370y\003\r\031.\226\220@pt\376g\007\212\316\241P\003\027P\241"
+	.ascii	"\202\237\177(P\002S\360\263\017\t\234\341\347\036\233\177=\300"
+	.ascii	"f\364\262\234gs\224\177"
+	.string	"\211\370\311c\3707\005\213\177/\300:?\347\364\374\f\003\226\t\276\3719\375_\365o\007j\376\363\356\337\034\377)\342_\032l\3633\372\233\377\334\340\337\270\234\377\354\372\367\305\3175?\367\317\3777\360_4\377\376\375\353\367\357\231\177\315\374[\346_1\377\362\375\337\371O\r\3776\377\375\362\257\226\177\261\374\213\367\257\335\277U\376\245\373w\356_)\377\312\375\353\366/\333\277k\377\246\375{\366\257\331\277e\3772\377]\377\025\3737\354\337\257\177\217\374k\344\337\"\377.\377\365\372W\310\277\\\377n\375\233\365\357\325\277V\377\352\370\267\306\2770\376m\361/\322\277\"\370\027\004\377~\340_\345\277\310\177Y\370\227\370\257\360_\f\374\213\302\277'\374;\201\177\025\360\337\354\277\210\377T\376\207\b\f\f\f\374q\376\333\350\375\032d U~</\266(\371\302\375\363\305\1772\235Mg\230$.{\334\247S\360\247\013&T"
+	.ascii	"\207p\373\254\017\212\243R\245O-Z\350\365\030s\"\235H\fW\343"
+	.ascii	"\244v\236\017\246\365\313\246J` \3375\323@\341\234y:2\307}\233"
+	.ascii	"-@@\376;\235\250\f\260\3643\362\245\252;>\264\031\031-\027\334"
+	.ascii	"G\371\312\354\312e\370ol\325\001\343eg\205\373\354\307}|U3\306"
+	.ascii	"\205\214>\356}\022<\237\351\2532OE\270\271\003\2241c\300\304"
+	.ascii	"\366v\345=\346\353\302"
+	.string	"\361jZ\022\303}\016\363\363\027\006sjyBr\306\275T\202\347f\003\202\\\205qs\006\250U\227.|\327!\007\372\342\312\256|\205\365F\220\261\242t1\242\250p\237\267\374\214\205\263\360\325NS[\222\0227k\t\236\363\266\320h\"\305]\263>\350\331\201\030\272]\231\216\357:dPU-\027\253\215\2204O8\270\317v?\327q\025\276\362\020&\207\224\340\331\312\t'\307\204\206{\201\350\240\354\312Pxn\204\f\252\212U\267\\\205X\240\f\341>O\3719\216\345\370\212\267H9\355qs\224\340YJ\216R\324\232\027\367\315\372\2405\207\253As\342\204\341:dP\225\262LY\326 i\333\225\333\030\256\003S\265\301\223E-\352\303\212\256\2455\235q\237\337\316WlM\245\026\005\310\035\"xvC\277\240T\235\311\342\257]\371\213\231\214\300T\221x\336\316\244gF\260\374\326n\310d\374\b\344Fc\002\325"
+	.string	"\006\022!\303}V\373\031\214\3038M\207j\345\214\344\270\343F\003:\227\230\220\224p\277\306Fj\306Kv\3453f\236\311\270\354@LUeSU\365\214\307X\311\007LP73\260\272\230\360\031\307\220\305k\206X\337\215\024\017\267\032\247t3\220Q\262\362hi\242i\343f\346L9\265\255_RN\022<\213u\340\212\n\b7\210\365A;P\367\007E\325\276K\277`\273g\273\356\031\037\271qR\325\032\035^\360\302\264\366\251P;>\234M\302"
+	.string	"\372\301\340"
+	.ascii	"\2740Z\334E\322\224\220\330\324\230\270\317h\233\306/\244PU\r"
+	.ascii	")\2200H\302p\027\001\272\021\342\007#I.\3752Y2\217\265\262\226"
+	.ascii	"\227\326\305^<\204\211\260\220]y\311X\254\305[\f\304\311\311"
+	.ascii	"r\343x\307i\2664\321\244\326t\333\267m\302\224\307d\333x\311"
+	.ascii	"\\\034\3444[\246MhlK\356\301W\247\331\362\346\205\226\022\017"
+	.ascii	"@'`\033^\231N+\341 \200j1\274\245\353\264?\250\004\353\223\365"
+	.ascii	"\337\340\324\231\311\261LK\337c\351\317W\374\343t\212A\305\224"
+	.ascii	"\240'IT\226\220\233&\1770Hq3\025W"
+	.string	"\235\255\330\207\312V\t\240R\325$\266\352A\243\252I=\273\032\354j\320a?\206\254\241\375\376J\337/\244o\257\224G\300\334\320\203\326\245d\305#\325[0oM_\3153\334\202I\236\027\024\327@CK\022\305J\374\324\324\305Q+\267s'si\203\246\025\326TU&Gm\335n9\231K\023Z`S|\203\245X\007\333\340\034\214cW\216\272R\3246\267\357-oHSUU\017\033<,Y\324\214f\206\016L\343F\211\251\232\335h\021\303#\215\373\035\225\276e\314\3201\243\321\245V&\215\261+\313\340\245f\031\314\3040N2\250\364\r-F\017\022:1\034\335\374\202\271a|Q\315+)7\261\323\256\354\342]F\305\3349\223n\324\275u@{\266\003\372SJ\372\223,\375\031\226rR\317\2151&\300\255\364\036\204Y@\277\245\252*\005\256\230\005|\221\345\257\251\252J\377Ye\244]7p\323x\360"
+	.ascii	"\2043\006\005\t\f\264\177\336H\327o\377v\335\260h\374\256<\231"
+	.ascii	"\341\3769#\r\201\252\356\006t\003\003w\003\372\263\311\214\332"
+	.ascii	"\013r=\366\3221Kf\327-\263|\337'\001>\312\312\246\270\027j+\370"
+	.ascii	"^i\200-Y"
+	.ascii	"\033\023\303\273r\322b?\217\335\221#Z\270\231,\370N\202\343\326"
+	.ascii	"L\362\024\326`_~8i0\253\024lv`hp\267\221\340\373+\245:\202\344"
+	.ascii	"\007\222#\247\216.Q\372\310\337F\032\006\266J\301\025\345f\206"
+	.ascii	"{\277\366\007\325\260>h\027\t\276_\330\331\022r\344\215\273\002"
+	.ascii	"\"\275\244\321\205\005K/\377\323\251\207\260U\n)\325\212\211"
+	.ascii	"{\247\366\307\253\273\266\35002\246\273\376\016\322B\330*\305"
+	.ascii	"\034V\224\031\334K\265?(\005\\@\264d\255\r\204\315G\324\b\360"
+	.ascii	"\270[+\370\336Js\006F\032wO\026\353\361\350\271\300\n\203\005"
+	.ascii	"#'\311\227?)W5tx\204\2712\345\307\251\203\347\314W\323"
+	.string	"\234\325i\225\303\003\017\212\230*\236[ aRZT|L$K\345\363q\312\235e\360\262\336z0\034\216\024%9?\036|\307VW7\267\203\377b|\321\331\215@\207j\227\205\327:\376\236\352\034l\225\"\306\b\246\300p\277\271?(\017\216\033(\332\223\030\226}\203YE\326\025'\025\225\336X\"\313\301\375\216\372{F\333`\253\024;\212\\aq\337\256E\360]\243&\007\225\252 4\240\262\226\254Iq\277\241\376\263\313\272y \020\320\fw\317\b\276\237\252\3105\225p\353\254\217\214\030;d\270\374h\352\030\377\211\243a\240NJVF\270;\350\027.\030\t\331\025\223\225\267\213\306\352\301\305\207S7\351\250\302z\321Mfn[\\M\246%\035\262'\033F\270\337K\177\267h\245\0201\200hq_\312\376\2409i\202\357$\247\277\260Fju\t\212n\251\325\377Ls\006\262U\n4p\310\030\270\375Aq"
+	.string	"\321\324\2209\225YC\363s\224u\302%e\303\312\237_\223\301Rg\303\357?\311\234g\262\270\361mq\177\260?}fP\320 \222\205\373\247\2314\036\300.\030d\202?\313`\320\026\327\204\333\346\347\230SLN\336\031\235\332)\346g-'\037[\245p\253[\222\305\335a\177\320fS\214i\375\352\211#\"D\b\223-\273\236[\316/#L-k\354U\221[u\250\276\252\254\224\270\177\356\375\247\336\311EG\251FZ\037\367\331%\370\323\313\2204*T\270w\326\007\265Q\233=D\264hy\252k\306"
+	.string	"\304\314\020\356\367\320\300\202\205\357p\240Lx\233\322\344\303\303\223"
+	.ascii	"\230\266f\016\030*\2524\334\347qbg\247\266\344\031\253Re\310"
+	.ascii	"\330\222\212\216\016\004\030\323\372\305\26347\007f\207O\212"
+	.ascii	"\024\276\353\260\247\307\264\366\355\304\301\355z\302\235r9\230"
+	.ascii	"\326\276\2320+\177>V\346\337\036\223\373g\334\17769\235\240H"
+	.ascii	"\220\270\240\342>\237\004\177B\271Q\363\313\212\302=\301\372"
+	.ascii	"\2407\314\251\235177%;SllbK\235\276\2655\346\353\002\323\241"
+	.ascii	"KK\333\363\322!;;c8\034\250\033\267\275\255\246\016\226\231\331"
+	.ascii	"\236\216\245\215\032h:0\312\312\370o\002\250\t\310xj\366\334"
+	.ascii	"\270\262\346\220a2\021\340\202i\375\252\262\256\\\230\326/21"
+	.ascii	"\261\r\376\230\326\257\034\"aa\374\027$I\316\216\257/\276\253"
+	.ascii	"qR?x\005\0369\362\341\005\323\372\205\343\305\210\021\346\273"
+	.ascii	"qR7hcZ\277\236\024)\222\006\007\206\345\271\344\273\016~U^^{"
+	.ascii	"8LB\204l\341rr\235\\zT\236l\235[\374\367v\263<\263\316,\346\003"
+	.ascii	"\302dy#u^\235W<w\343\244\032`,M\223\376\347\216]\317"
+	.string	"\035\247\325\351D\245\3328\200\022\032ZS}=ORd7x\370\315\305\340\376Y\365\237<\316\036=/\334\300\262\302}\372\b\376\244z\362\243F\037\367\311\326\007\325@\205\212\213\332\365\214:u\f\301\251\342eu\241%\204\216\215\373g\216\363\006\203q1\335q\2378\202?\247x,\313\211\213\033\375`\225\261\353)\343\254\001d\271yLb\224n\212X\225A\003u\3168\2378\016\bU\026\356]\013\376\204\352\271\362F\306\213\273\231iYK\273\236K'\214\234\245\027<dW\001C\244\260\005!\244p\004\344P\310HT\201B\022y,\036I\030\t\rKlP\"\217'\260\020\026\215\222\304\020\204\222&\220\303\"b\nB\303!\243p\005%\021\004\345\221(\031\002\006J#\361h\244\034\236\020\032\036\225G#\224\305\021\304\344\361\204\013\224Eb\004\204F)LpD*\203\214G\302\022\032\206+\210J\341\n\"\222"
+	.string	"GFF\022\0020d$\022)\217\307\242\023A(\204\200\034\032\211Bd\nGd\320\b\027\204\305!\n$\024\r\225I\026'\216C!b\005*P\022\213\210%\206E\245\362\210$J\241\207\205\240!\021\211\026\216E\025\310\341\n\023\027\034\201\300\0029\\q\f\032\242@\224\024\"I"
+	.string	"\021\005)\211-\234P!L\026\211\302\b\370\260P\022W\b\221\"\020\225\306\021\026\024!\207\312\020"
+	.ascii	"04b\221B2)4j\341X\"Y\034\032\215B\"\022\0020\036\211Ja\361h\204"
+	.ascii	"\034*\215$\004\241P<\006\035\225G\344\tE-\234p\"\016@\b\025\211"
+	.ascii	"G+l\030:Za(\3043$,A\bBP\320\b\025F%\206Ha\013BH\341\bG$\013\021"
+	.ascii	",(\nW(\"\212\360s\"\016\206CBe\361\270\002D\022yL\032\207I\016"
+	.ascii	"\311a\221\320\204a\020\362\350x\0029T\016KP\032\207H\344Q\220"
+	.ascii	"\206\241R\210\302\260hT$<\301!\210\270b\030\202\013\307\025X"
+	.ascii	"\b\022\026A\330`\001\023%@PA\303P\350X\302\211\021 \234@\016"
+	.ascii	"\205\210+\216\310\023N\234 B\005J\343\260\3108D,\216\240@I4\252"
+	.ascii	"\320c4\241B\205\211\f\312$\212$\232\324Q*\207I\025*\216\250\320"
+	.ascii	"\220\205 \241\021\232DA,\006\341 \205DA=,\022\032{h\304B\331"
+	.ascii	"\312\n\020\213A\031\224(Bx\340\202\260\204\020\036\034\241\312"
+	.ascii	"!\212\342\004.\f\205\214$(qJ\030\035\261p<\026Q\245\0046\250"
+	.ascii	"\322\005a\321Y\202\221X\002\261\030\264\301H,:\205\206"
+	.string	"\306!b\322\250\202\013\302\"#\261\210G\211\216 \026\203*`!D\"\2055\312\023%\207\204E\0255I\024$J\234 \026\2034\030\211E7D\312!\343\260\350\202\260\350f\310HD*\223\250\022\305\0076\311\243\221\222\270\002:DTa<\006\241J\024\306!\243\032\343\220\321\211s\013~4\032\"A(\217G$\210\034\245\361\350H\202\005Ri\204\300\260\270\2020\205\341QQ\270\202\002%\n\005\004\225F\342Q\372`\220D\006*\230 B\032\304Ar\310HT*\207I\020\304b\020\b#QX\004\"\b\231\004\301\301\00650\315\272\342\003\214\373\035\3707`\247a\253\024:\266\314\250\342^\016y\3017\232#7rt\375\371\251\275@\204\216\373\355\367w_\237Y\265NH\023n>@\231\340\333L\213\345\231\021\303\375\201\314\030\236/\034q=\346o*-f\347lI\022\026\356\335\n\022|\363\245i\344f"
+	.string	"\t\323\244\242\362\221\307\375n\376\275\244\301\350\340%qqqoZ]\360\375\345I\215\262({\355\205\211]\263\275X\245@\223\247\345\007w\343\005\337]\244h5\271\350\241\031\323w\206\373\255\367w^o\311q\201\327\027\305\275v\373\203^\340$\370\326b\303U5\026$\013\026\0351\344\342\270\337X\376\306\353+{ysO\334\033"
+	.ascii	"\273\340\373.\007\220\215/\211\033\003+U\302\260\256\232\270"
+	.ascii	"\337U\376.\322u9dV\320\200q\357\222J"
+	.string	"\360M\327\303\303\013i\212\373gnJ\f/lK\334\357)\177Gi)K}\315@n\326\340K\360-\227\222\321=Q\212\203\262\004&0\214\373\r\345o'\375\204\255RT\3011\333\270\027"
+	.ascii	"h\301w\023\035"
+	.string	"1[\314\300\340\336\246\230g\274\270\337o\177\267\265[#\021\211\"\306\315\003`\022|\263\331,\tS\247r\013`M\255K\214,n\334o\265\277\321:\215\273dp\255q\257\005K\202\357\263\233\267$V\256\2707\230u\f?\240\364:\206\277\265\266M\207\312\224+\177\334=\025|\227\005\006>\001\322d\315\\\262\204\b\024\367\233\371\237OZI\204<\250\2433\264Q\032\312X\032S\2129\221\221\321$i\f\363\024@ @\2200\240\254\252\353\001\023\200\020GT\3614\016\225D)t$I\n\205=\346\024\201q\200oy.\217\341\021\f\272\300\343F\356Q\036\320\315\206&\372\223&s\267{\017\221`,~\232\244\b\312\327\001eR\221\367\213w2\353%O*\257\277\371a\217\3672f\362\005\243\376\264\320\364b\357\003\211\264!vK\016\006I\r\340`\357\030*\212\345\254\230=\214\021l@\307\200\244\230\23557"
+	.ascii	"p+\212\316\204H\336V\264\325\"_@~\363\317\037&{}\007s\265H\274"
+	.ascii	"l\350\271\201\267\275K\203\033\006\f\344\0075\003\300o\377\222"
+	.ascii	"\217\374P\216\232P\232\350\314`g\2710\336s-\023\373\325J\022"
+	.ascii	"\030\373T\2442\317\274<\376%\216fh\342\277\036\2133\361\335\304"
+	.ascii	"/\024\235\202\333\020\272K\032\254\334\035y\004>k\307ONv\361"
+	.ascii	"\263\202\353-$\277\232\341f\tc\005\021\324\330\251W\323\r\267"
+	.ascii	"\256O}\326ha2\026\274\346\306iq\b\344\244O9\310\353\033`p\b\311"
+	.ascii	"\032\360X\216rE\213\200d\200\243\021\024\210O\240\035\335\372"
+	.ascii	"\300_@:\0164\202\234)9S\313;\261\023\\P\027P\006\232X\2535\031"
+	.ascii	"\b~\360\217\315\033\210ar\220\373\270\241.6z\331\253\355\237"
+	.ascii	"2\302\035l\337\355\274\333\\\352\006\007r\233?\230\013\342I\376"
+	.ascii	"=\262j%\013@\0331V$\3408\005\332\021\202}H\314\350\273t\261g"
+	.ascii	"\316\214&\177\001\t\260\307\340\231r\006\277\215\305\255\227"
+	.ascii	"n=|\344\021?\272J*\306l\273\351\351\253bu\260l\033E>\362\321"
+	.ascii	"\323a\327\030\022\352u\020\3632\233Qk\306\206\013\312\252\002"
+	.ascii	"\302\376\007\005\222\031\377\331\223\b\034\213\224\221]\342\013"
+	.ascii	"\257\300\330\020\242S3D\304\2754\202\022\333}=BmD\rE4\261\022"
+	.ascii	"\235\217gJA\220\023\302O\201\335\260\3666\n\f\361\t:\230G\"\036"
+	.ascii	"\024\237\223"
+	.string	"7\327\225\023\002\267\350(9M\252\0343\256\025he\217pa\313<6^\207;\346\303\242\211\r@\377dT\007\356\"NG<\305\237d\227\203\255n\230\204\373\301\245\020\323\344d\020\225\333\244fK\231\2671M9]\024K\352l\\\271\205\341\226\307X\007L\225GcE\252Io\2016\325?\227\302\2734\232\232\255\373\332\237\355\240\354\233\260\007H\327\"\350\223\333\346\214\247\255\362\303\017\267)\3023\255\366\233\250\327K\322.fY<A\307\006BK\242:cLn\"\203\376\323]2\352\372\213n\351i\227\334\237\216 \307pO\207.\320P\3151\263\030\226\212G\234G4\231\353m\350>#x\270\324\272\240z9\230\\iY>\314\204\222\244\262\313\257P\365\217_\324d\241h\335f\323p\350\325\006\350%\375\266\022b\211\237\366\253F\2738=\246\007wv\301\341\350f\367\216\205\242\207\236\324p\033U\217_\233"
+	.ascii	"\f\273p\267\017\371\251\215\254\350j\364\021\034+\241\226\t2"
+	.ascii	"\205\\\226\347\302"
+	.string	":\313C\355\300x)1\266\260Yd\345I\230\017\236\006\\p\2232^\341J\347\362)\377\001L\247-\237-K\316\200g\215\255\272\002\333\003\223\240\311T\365\006\374\027\323g\307\346\263k\244\262~\207o\304\335p8A_\b5m\251\222\3266\321\ncc\201\344t\322J\240B\204\\6q\b.\371\317\177zQ\227\027\006(s\007(~\343\3612\277o\034\3739r\332\274\024Y\004\326\375\277\340\037\302\374<DE\266b^\024\321n\001\017\006\3017M\324\305h;\220\201\210\022\327KY(\f4\316)@\363\350\206\213\244,x\254\027\n%~r=bR\013\257\347\220r\354\311?\371a\223IB\201\346.\314\222\267f\344\3416n\211\365Y\225\225/\277\265\277d~S\257\206\364f\3252)\037\331V\340~\327f\020\331\240J\256eO3\360@Q]\244\1770\205_\342\365)\206\t`;\023\322\266\277E."
+	.string	"\002f\211X\013\002`\201=\312\r\005{\234\224v\245,s;l\024E\t\364af\273\320Zp9\225\345\200\204\341\2104\020\221\177\201\350+\256\235&\035\277d\217_\346Q\335i}S\236\253\330\377S\332.\025\264\336C3\366\256\242\371P\230T\315\374C\261\215\370\265\335\274\331B\341\317\262g\333\202\254\325\236\022M\270\376\263&1\313\324?\204\237\306*E\335\206\277\272\016\315\311f\243\245\320O7\204\375I\2013\202"
+	.string	"]\314ZF@4\204\031\342X!\0061\325)\213!\f\037\220\222\205\200~\374!>\r\312%\316\241\020k\252\357\005\226\b\207\316\370|\306V\346^\314\231\035\221u\242\005\275E\202\n\252:\215\030exx\247wW\237\243\240V\346\360\321\201W\255\220\356mp\005d3=\331G\363\217\270iIZ\243\324\212\266\017\305\004N\332^~\\q\030\365\323\265O\3757\030\336\331\314$E\340>b"
+	.ascii	"\261="
+	.string	"\370\263\355\235\2532+\331\3219^\371\301\302\024\016x9\212\366\324\002\202\266\266\316\024?CF\3149[\324\273\200\3328F\310\373\256\225\037J\232Z\236\216\001\024\013\035\263\246\253\036\220\024\333\267LZr?K\001\263g\305\277\236\320 ~\305\301\303\264k\330\"H\331\031\023)-E\213x3\025^\271\266.n\357=\006.\247\215g\001C\260\322v\230\375!\222\204Yl\317\"\200X\254\035\234\2254F\225\013;\020$\317\206S\237Dq\005\304\032u5\320~N\312|\313\240N\213\207\214ea\371\350\212\0031\362q\264\247\347#\375\255\361a\b\006#\377\236\276\220\312\271\002\033\211\334\217\020\304\316\203\377Y\313\376hU\2116\304\227\016\020\216O\330k(_\262)t\332\r0\347{\002~\200r:P\0042\321\302\317\004F\305\211\034\243U21$\\\264\354\005\211V\345<X\265\202)v:;\210\273\235\233\333"
+	.ascii	"Q4\0060\272\267T|e\236\312\2453\025\027\324\355;)\236[\321\013"
+	.ascii	"Ty0\253(\231UK\373F\342f\245,D\360S\344\350[ng\036*\203(\365"
+	.ascii	" -\322\032 \321\315'9\207\365\337%\375\223\257\375\337\357\263"
+	.ascii	"\b~\236M\025\335t\351\"z\016P\326\260\346\0308m\301\236)\300"
+	.ascii	">\302\312\037\360\276\201\321\013`\235`\335\0078]\300\356\001"
+	.ascii	"\360:\300\026\366\237\367}\"\343\243s\375\206\3137\356\216\234"
+	.ascii	"}m\365\336\350H\233\357N\336Y\034{\360E{W\346\306\\{m\354\336"
+	.ascii	"\326\210S\357,]\036\032\321\316\0333\027\255\214\333\307K\023"
+	.ascii	"w\2760\322\277\013\367\026\337\305;w!\366m\017\035\213t\320y"
+	.ascii	"\026\245+\341\340\343d\367/\n\\\362f\217\215\267{\316\267?:]"
+	.ascii	"\213\322}w\363\301z\226|\200x\310\274k\217\212\224\207\377\b"
+	.ascii	"s\314:\032qo\336\307\241\033?\331g\347\353\001\2617I\266\227"
+	.ascii	"\340Wl9\202G<\360\364\277\357\270\240\034\230|1\2759\275\f\321"
+	.ascii	"\242\270\367w\305\rv\274m}#D\371\312\203\327\316\334\313\360"
+	.ascii	"\022\330<\242\364g_\347\376\350\026\3715\024\376\361\305\276"
+	.ascii	"\246\245\027\364~\326\250\320\236\177\262o_\024\313~\267I\261"
+	.ascii	"\316\257O\374\245\327\273\331\320\322[;\337\315#\370\321\270"
+	.ascii	"\265;\321\206\226\376\255\333x8\033,i\035^f$\364\312N\030\325"
+	.ascii	"\312\332\004\376\254\272\355\343\013\236h\364\217\273\261\262"
+	.ascii	"\266\236\266\256o\332\334$9\3010\313\031\345}2a\227Z\256O\205"
+	.ascii	"\306'{\246\rd%w\340ow\367\006\316\232t1\353v\2110<\254\226\017"
+	.ascii	"Ux\372\032\216\007\375\251\275\325\376\224\233\225\021\301\225"
+	.ascii	"?;(\262Nx\024\323\246\337\370i\267\242paar!\231\312.\201\177"
+	.ascii	"O\327\277\026\250\263a\317\351\370bk\203\303C\344^\0366\034\177"
+	.ascii	"\360bdn\f\216I\001\215\341w\335t\005"
+	.text
+	.section	.gnu.lto_.symtab.7430578003c6e374,"e",@progbits
+	.string	"valueTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304"
+	.string	""
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"lookupTableItermRelax"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"lookupTableItermRelaxType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"lookupTableInterpolatedSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"lookupTableOsdDisplayPortDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"lookupTableLedstripColors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"debugModeNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7430578003c6e374,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
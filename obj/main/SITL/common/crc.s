@@ -0,0 +1,819 @@
+	.file	"crc.c"
+	.section	.gnu.lto_.profile.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375 \301\305\003"
+	.string	"\344\005\265"
+	.string	"\n"
+	.string	"\361\227\272\362\n\002\002"
+	.string	"\002\001\001\266\215\250\327\005\002\274\244\244\271\b\024\002"
+	.string	"\002\001\002\003\250\332\217\346\017"
+	.string	"\004\235\324\210\003\002\002\003\002\004\005\235\372\252\212\013\006\326\203\330\353\r\003\002\004\007\365\370\256\366\013\002\002\005\002\006\b\355\200\324\221\f\004\002\007\002\007\t\244\210\232\272\t\006"
+	.string	"\n"
+	.string	"6\t\364\f\003\253\240A"
+	.string	" FI\030|%"
+	.ascii	"X\"X\003\006m"
+	.text
+	.section	.gnu.lto_.ipa_sra.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375 \305=\003"
+	.string	"\364\003\271"
+	.string	"\b"
+	.string	"\002"
+	.string	"\003\002\003"
+	.string	"\003\003\002"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\001\002\001\200\004"
+	.string	"\001\001\001"
+	.string	"\200\f"
+	.string	""
+	.string	"\b\004\006\007\002\001\002\b\002\005"
+	.string	"\b\001\020\b\f\t\002\200\002"
+	.string	""
+	.string	"\b\b\t\006\004"
+	.string	"\021"
+	.ascii	" \005\030\360\264\347\325`\003#\027h\006C<\241H\220\027\tP(|"
+	.ascii	"s.<JXp\0010\031d\262\001,"
+	.text
+	.section	.gnu.lto_.inline.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`W\001\255\007"
+	.string	"\222\313%,pK\222\016\374\271\006\250\327\374\372\363\377\2755\204\265\350\310\300\360\254-\375oN_>\013\004\3759\276\340E\357\343/\211\255\221-w\nK\316\261h\027\202G\273\016~&w\321.\205\311e\264\313`u:\315\007\243h[\361\315\257n%q\037m\241\001(\247\221\271`\030(\307\221\271`\022v\216\360 \bn$\233\240\031\022\r\211x?\337&\330\321\266\340\213\260\302\250\2654\234"
+	.ascii	"\215\334*\304h-\013s \315\351\274$\245?\200f\377C\233[\004\333"
+	.ascii	"\366y5\035\002* \260\"2\272\003\034\2678\305\002v*\f\337\313"
+	.ascii	"\3346,\274\213\317\202\244\002\230H\306)\362\272\\\342s\307~"
+	.ascii	"8\267\2150GN\013\374\273\341 c\006\235\365\226\273\240#@l0\031"
+	.ascii	"\307\211\200\"9\320\"\377\033\346%\022\035\373!H4\353 \\[\330"
+	.ascii	"\215dvH\374u\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\235\003"
+	.string	"\222E\021\032\260%\351\f\303"
+	.string	"$IB\230$9\346\224\007t\3156k\033!\004o\"\223\f;\346\177(\n\301\026\364J\234Q\265K\333`\226\221\252I\307\246\343m%2l!\005O\002`\003\205\237\220`\017k<g6!\022"
+	.ascii	"\241\0245\310\007\f3\230D\240\336\301(\353i\005\214\013Y\017"
+	.ascii	"f`Dq\002\025Z2\t\244Y\004&\255@d/\327\026\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\200\004\002\265\004\003\230\004\004\200\004\006\265\004\007"
+	.ascii	"\231\004\b\265\004\t\271\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375 \226\315\002"
+	.string	"\244\003\212"
+	.string	"\b"
+	.string	"\002"
+	.string	"@"
+	.string	"\002\003\200\007\300\005\300\007"
+	.string	""
+	.string	"\001\002\003\002"
+	.string	"\274\006"
+	.string	""
+	.string	""
+	.string	"\200\210\221\370\357\b\004\002@\006\007\001\002\016"
+	.string	"\001\002\b"
+	.string	"\001\300"
+	.string	"\300\b\004\t\002"
+	.string	"\024"
+	.string	"\f"
+	.ascii	"o \004{cX\026\304\272$X\t2\001\375FU\251%\n\315\340A.\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.lto.13c21a1c5e5e739b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crc8DvbS2Table.3.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`P\003\201\""
+	.string	";"
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\002\177\005\001\006\025\001\003\005\001'\204\002\002\177\005\001\006\025\001\002\005\001'\206\004\002\177\005\001'\210\006\002\177?\202\210\200 }3\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\200\002"
+	.ascii	"E"
+	.string	"\212\317\301\204K\016W\022\335\230\226\323\034Y\256\353$ao*\345\240\371\274s68}\262\367\211\314\003FH\r\302\207\336\233T\021\037Z\225\320'b\255\350\346\243l)p5\372\277\261\364;~\307\202M\b\006C\214\311\220\325\032_Q\024\333\236i,\343\246\250\355\"g>{\264\361\377\272u0N\013\304\201\217\312\005@\031\\\223\326\330\235R\027\340\245j/!d\253\356\267\362=xv3\374\271[\036\321\224\232\337\020U\fI\206\303\315\210G\002\365\260\177:4q\276\373\242\347(mc&\351\254\322\227X\035\023V\231\334\205\300\017JD\001\316\213|9\366\263\275\3707r+n\241\344\352\257`%\234\331\026S]\030\327\222\313\216A\004\nO\200\3052w\270\375\363\266y<e \357\252\244\341.k\025P\237\332\324\221^\033B\007\310\215\203\306\tL\273\3761tz?\360\265\354\251f#-h\247\342\200\002"
+	.ascii	"\203"
+	.string	"\323Ps\360\240#\346e5\266\225\026F\305\031\232\312Ij\351\271:\377|,\257\214\017_\3342\261\341bA\302\222\021\324W\007\204\247$t\367+\250\370{X\333\213\b\315N\036\235\276=m\356d\347\2674\027\224\304G\202\001Q\322\361r\"\241}\376\256-\016\215\335^\233\030H\313\350k;\270V\325\205\006%\246\366u\2603c\340\303@\020\223O\314\234\037<\277\357l\251*z\371\332Y\t\212\310K\033\230\2738h\353.\255\375~]\336\216\r\321R\002\201\242!q\3627\264\344gD\307\227\024\372y)\252\211\nZ\331\034\237\317Lo\354\274?\343`0\263\220\023C\300\005\206\326Uv\365\245&\254/\177\374\337\\\f\217J\311\231\0329\272\352i\2656f\345\306E\025\226S\320\200\003 \243\363p\236\035M\316\355n>\275x\373\253(\013\210\330[\207\004T\327\364w'\244a\342\2621\022\221\301B\200\002"
+	.ascii	"\013"
+	.string	"\026\035,':1XSNEt\177bi\260\273\246\255\234\227\212\201\350\343\376\365\304\317\322\331\265\276\243\250\231\222\217\204\355\346\373\360\301\312\327\334\005\016\023\030)\"?4]VK@qzgl\277\264\251\242\223\230\205\216\347\354\361\372\313\300\335\326\017\004\031\022#(5>W\\AJ{pmf\n\001\034\027&-0;RYDO~uhc\272\261\254\247\226\235\200\213\342\351\364\377\316\305\330\323\253\240\275\266\207\214\221\232\363\370\345\356\337\324\311\302\033\020\r\0067<!*CHU^odyr\036\025\b\00329$/FMP[ja|w\256\245\270\263\202\211\224\237\366\375\340\353\332\321\314\307\024\037\002\t83.%LGZQ`kv}\244\257\262\271\210\203\236\225\374\367\352\341\320\333\306\315\241\252\267\274\215\206\233\220\371\362\357\344\325\336\303\310\021\032\007\f=6+ IB_Tensx\200\002"
+	.ascii	"\325\177\252\376+\201T)\374V\203\327\002\250}R\207-\370\254y"
+	.ascii	"\323\006{\256\004\321\205P\372/\244q\333\016Z\217%\360\215X\362"
+	.ascii	"'s\246\f\331\366#\211\\\b\335w\242\337\n\240u!\364^\213\235H"
+	.ascii	"\3427c\266\034\311\264a\313\036J\2375\340\317\032\260e1\344N"
+	.ascii	"\233\3463\231L\030\315g\2629\354F\223\307\022\270m\020\305o\272"
+	.ascii	"\356;\221Dk\276\024\301\225@\352?B\227=\350\274i\303\026\357"
+	.ascii	":\220E\021\304n\273\306\023\271l8\355G\222\275h\302\027C\226"
+	.ascii	"<\351\224A\353>j\277\025\300K\2364\341\265`\312\037b\267\035"
+	.ascii	"\310\234I\3436\031\314f\263\3472\230M0\345O\232\316\033\261d"
+	.ascii	"r\247\r\330\214Y\363&[\216$\361\245p\332\017 \365_\212\336\013"
+	.ascii	"\241t\t\334v\243\367\"\210]\326\003\251|(\375W\202\377*\200U"
+	.ascii	"\001\324~\253\204Q\373.z\257\005\320\255x\322\007S\206,\371"
+	.text
+	.section	.gnu.lto_crc16CcittTable.4.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`95-\343"
+	.ascii	"\352\222\035UJ\200\216\004n:0J\354\354\320Q\344\313:\221\272"
+	.ascii	"\004\235xgffffF\313\220\213\316L\353\020\034\022J\365\237\204"
+	.ascii	"R\375'\241T\377I(\325\316Q\274U\262\360\205\222\365\355\212\365"
+	.ascii	"\255\222\365\335,\215G'{\357\275eJS\r[\005\013\005@\005\314\206"
+	.ascii	"\353f\307\265\\\3175]\3279\202'x\317\025|\301\031\274\301\035"
+	.ascii	"\334\347\017\016\341\021.\341\023N\341\025n\341\027\376s\f\317"
+	.ascii	"p\r\337p\016\357p\017\377p\020\007z\210\213\370\210\223\370\006"
+	.ascii	"^\342&~\342(\236\342*\276\342,\336\342.\376\3420\036\3432>\343"
+	.ascii	"4^\3436~\3438\236\343:\276\343<\336\343>\376\343@\036\344B>\344"
+	.ascii	"D\036\364\"7\362#G\362$\027\272\222\017}\311\231\274\311\211"
+	.ascii	"\356\344O\016\345Q.\345SN\345E\257r\243[\371\321\257\034\313"
+	.ascii	"\263\034\351Z\276\345\\\336\345^\236\364/W:\230/=\314\305|\314"
+	.ascii	"\311\274\314\315\374\314\321<\315\325|\315\331\274\315\335\374"
+	.ascii	"\315\231\016\347M\217s9\237s:\257{\204O\370\336+\374\3023|\303"
+	.ascii	";\274\357\037\036\342#^\342'\236\342+\336\342/\376\367\030\237"
+	.ascii	"\361\032\277\361\034\337\361\036\377\361 \017\374\220\027\371"
+	.ascii	"\221'\371\r\276\344M\376\344Q>\345U~\345Y\276\345]\376\345a>"
+	.ascii	"\346e~\346i\276\346m"
+	.string	"\376\346q>\347u~\347y\276\347}\376\347\201>\350\205~\350\211>\370Eo\364G\217\364I/|\245\037\376\3223}\323\023\337\351\237\036\352\243^\352\247\236\352\213_\365\306\267\372\343_=\326g=\362\265~\353\271\276\353\275>\371_\257|\260_~\330\213\375\330\223}\331\233\375\331\243}\332\253\375\332\263}\333\273\375\3333\037\356\233\037\367r?\367t_g\021l\202\355Y\005\273`\031l\203u\260>\373`!l\204\225\260\023\226\302VX\013{a\177\026\303fX\r\273a9l\207\365\260\037\026\304\002m\210\025\261#\226\304n`K\254\211=\261(6\305\252\330\025\313\242\201m\261.\366\305\302\330\030+cg,\215\255\2616\366\306\342\330\034\023X\235\022\314 \006C\b\276\036\f\330\036\334\360e\336q\311\227y:X\257\221f\233yt2\317\203/\363`\370F\024\251\256|[\231\347\302\227y#|\231W\023"
+	.string	"\3465\b\300\3508"
+	.string	"g1#"
+	.string	"\363T\3702\017\303"
+	.string	"eN\007h\2048\004xI\221\347\324\305\227yA\n`\036\304\002~\222\f\200z\342\313<\t\007\354v\036\300<\r\b\030m\020\201^\233\223\200\210\322\004\230G\344\313\274f\005\374&\305\002m\365\273@\234\020\0066\"2@\201\252\313</\r|Ml\300\307\303\227y_\035\210\202\362"
+	.string	"\363\344>"
+	.string	"\001!\bZ2B\220D\302\227ya#`^\026\t\024\022J`\206c\002g\352\320`\203\227\023$"
+	.string	"\r\005\3143JAG\265\250\300\205DV\300\274 _\346\271\265\200yW.\340\300\031\337\016\261\201\001\232\303\020\363\200D\"X\t\266\003[\221\213\r\031\265\260\354\310Q\254\220\230\307\220\304<\032aQK\311gl\b"
+	.ascii	"\235%\346)\360eb^Q\f_\346}\020\335\003\311\251\331\324"
+	.string	"\236\230\347\003\205VD\365\214\224\224g\201M\325\r\251~t|\213\314+\251:\020n\030\271\230V\022LG\026X\360e\336\t_\346=\360\315b\036\0202\206K\253\210\212/\363\242\270\016\220\312\256\260\036\257\005\212d\247\230|\371\022\207\222yK`\005\250[\356\\\204Q\241\360\025c^\027\034_\3465\221}`\253\214ySfo\276\263\217\037\276h\314kK;\b#RC\206\254\331\260\260\365\305B\233\334\f_\346\221\275e\300x\300\254\3109\200\353\3525\017\250\220q\314\023\223k@\022\337\267\265\003:\037\2229\250\203\001A\350\331I\250\222\350\035l=)0/\271\020\002%\206\340\\\203\267m\340\320\241\341\243\211{8\300r\202\030\303\210hP\2218\201\230p\245 \n\346uU\034\240h11r\261\345\362;\250z\303`^Q\306\002\3144\332\216\033\036l\340\220\251\351h\300\362\030[~4\326\r\210\323 "
+	.string	"\033\003&\204\316C\204yG#\027H#\231r\333\200'X\""
+	.string	"\021\023\346\265\234\034\0209\2400\317&\005\344L\305\355\212\357\n\363pXH\220\320\322\fY.\313\260\227\241\021\214\253\240\305\260\305\213\314\301\\\307\214\027\024\r\305W\215\nxl\246&n\334Hp\030$#\347E\250C$\307w\207y?\036\233\322S\323\364q-\342O\317y\001\271EU\220J\204\320\301Ph\b\354\204\b\302\"\b\304T\364\3044R\243:\222"
+	.string	"\027\322\nP\322\321\203\220\fL)Aj\3509\025KW>Lp\033M\235QB\264"
+	.string	"\235\023q\370\364\244"
+	.ascii	"\345@:Q\f1&\005\2465u\244F\245\001\244b\217|T\271Z\214\361\340"
+	.ascii	"j\310\212s\330\216\t+Wd@,'\322d\2310 \021`\305W\213ye[\375 \306"
+	.ascii	"\345Id\027K\365\274^\220\223d \310W\232\214\262\221\326\300\\"
+	.ascii	"\222\226,|\303\230\027\"\346F\242\261\306i#s\016cY\223\314\354"
+	.ascii	"\240i\346\214I\026\320\202\232\322\\\nN\215\223(k\352\005\033"
+	.ascii	"\273\374\264\035 \371\334\322\246\336\034\270\305\324\200\002"
+	.ascii	"\216\215=M?S\306u/J\316I\352\346\272i\211\216yM\016\276u\314"
+	.ascii	";\3312\207\t\337\223\355\001\037\034\234\300\003\001\275uJt\327"
+	.ascii	"9\321\311\223\242\225gE/O\213\026;/\232\354\374\265\331\211\321"
+	.ascii	"hgF\253\235\032\315vn\264\333\311\321\314\263\243\233\247G\313"
+	.ascii	"\235\037Mw\2028\302\t\364\336\031\342\013\247\2107\234#\356;"
+	.ascii	"I\034\342\334\300%\316\022\2478M\334\342<\361\337\211\342\031"
+	.ascii	"g\212o\234*\336q\256\370\307\311\342\300\263\305EN\027'9_\274"
+	.ascii	"\344\204\361\2233\306SN\031_9g\274\345\244\361\227\263\306cN"
+	.ascii	"\033\2379o\274\346\304\361\2333\307sN\035\3379w\274\347\344\361"
+	.ascii	"\237\263\307\203N\037\037:\177<x\002\271\321\031\344H\247\220"
+	.ascii	"\013\317!\037\236D\316t\006\235x\026\371\323i\344Q\347\221O\235"
+	.ascii	"H^<\223\334x\n\375x*9\3269t\344\271\344['\223w\235M\236<\211"
+	.ascii	"\256<\235|y>\271\330\t\345dg\224\233\235R\216vN\271\332I\345"
+	.ascii	"lg\321\335\316*g\236Fo\236V.w\036\235\356\274z\204\023\353{g"
+	.ascii	"\326/\234\310o8\265\336wn=\304\311\365\022g\327S\234^oq&\377"
+	.ascii	"w~}\306\251\374\215\023\354;\316\345\177\234a\017<\305^\344\034"
+	.ascii	"{\222\223\354K\316\262?9\315>\345<\373\225\023\355[\316\264\177"
+	.ascii	"9\325>\346\\\373\231\223\355k\316\266\2779\335>\347|\373\235"
+	.ascii	"\223\371='\334\377\234\315\017:\343~\350\224\373\3409\367F'\335"
+	.ascii	"#\235u/D\021~\210&<\023\332{\"\252\360O\350\302G\241\f?\2056"
+	.ascii	"|\021ux#\352\373#\372\360X(\304#\321\210\337B%\276\013\235\370"
+	.ascii	"$J\361J\264\342\227\250\305\213\241\027O\206\376\336\f\305x4"
+	.ascii	"4\343\325P\215gC7\336\r\345x&\332\361M\324\343\345\320\217\247"
+	.ascii	"CA,\002\n\264=4\304.\240\"\266\001\035\261>\224\304B\240\033"
+	.ascii	"X\t\264\304R\240&\326\002=\261?\024\305f\240)v\003U\261\035\350"
+	.ascii	"\212\375@Y,\020m\261\"\250\213%A_l\t\ncO\320\030\233\202\312"
+	.ascii	"\330\025tF\003\224"
+	.string	"\306\272\2405\026\006\265\2612\350\215\245Aq\254\r\232cqP\035\263\231\255'\236!\257B\373\"\211\260\220\332"
+	.string	"\350\202/\021\3374\276\\|\241\022h\274\370J)\330\264\220\t\024\006\337\"\276kN\025\364Q\343[\302\367\327\353\212\352\t$/7\276)|7\3706\034s\224g\021\254\252\347\240\343`*\017\034|\223\250\336<\002\345K\203\357\021\337\266/*\006\034\276\306\205\233ON5\227QW\260\001\235\360\315\200\t\341\013\3264\327+s\262,\344\304\f\320R\242\341\207/\031_,\276L|\205\344^\200D\276Rt1\003\020\351\005\n\261 \276f|\221nv\346\bZ5\025|\205dT0\3027\302\251\256s\306\214W|#\370\372\360u\341\013\262\024\307w\330l\371p,\210\232\036\276b|\217>\343s\344\016\331\262g\0242\251V:\370\262\360\365P\202;\206\335X\361}\340\273\3449\212\365@8}l\320\302\267\311w\330(qKK|A\370\272"
+	.string	"}\370F\\\215\361\345\341\373`\025\326Jp*J|=\370\262\270IG\323\n_&_a\003\214|\227;\2768\240\306\013_9\276L|\261\370\222Ih"
+	.ascii	"h\202-\253\314/\346\352\232\370\206\230\300\370\\\035\206\023"
+	.ascii	"\337\021\2762|\205*\264\316\370\"\371\232\005Q4\207H\303\305"
+	.ascii	",\321\361%\276%\251\260\351|8\360\255\342\013\326\"E4%\337\034"
+	.ascii	"\276/\r\033|S\334xH|3\370\236\260\031\265\332\0240\311\367\206"
+	.ascii	"\357\202w\340\2701\360\245\342\373\325\306\367H\003e\210&&\201"
+	.ascii	"/\024_.\2704\242\213\r,H\320\206\274\345\311h\213\357\f_\004"
+	.ascii	"\244(\276+]|k\370\366\370\376JL\324\232\202|\327\342\2120L\372"
+	.ascii	"\305&\250\300W\212\257\227\017\3770\020\007\261\020\0171\021"
+	.ascii	"\007\271\210\215\370\210\2218\211\205\254\304C^b&nb\";\361\023"
+	.ascii	"Cq\024K\361\024Sq\221\253\330\310V|\344+\306\342,F\262\026o1"
+	.ascii	"\027w\261\027'\371\213\225\f\306K\016c1\036c2.c3>c4Nc5^c6nc7"
+	.ascii	"~c&\303q\223\343X\216\347\230\216\353\032\241\023\272\327\n\275"
+	.ascii	"\320\f\335\320\016\355\353\207\206\350\210\226\350\211\246\350"
+	.ascii	"\212\266\350\213\3765Fg\264Fo4Gw\264G\1774H\003;\244Ez\244Iz"
+	.ascii	"\203.i\223>i\224Ni\225^i\226ni\227~i\230\216i\231\236i\232\256"
+	.ascii	"i\233\276i\234\316i\235\336i\236\356i\237\376i\240\016j\241\036"
+	.ascii	"j\242\016vQ\033\365Q#uR\013[\251\207\275\324L\335\324\304v\352"
+	.ascii	"\247\206\352\250\226\352\251\246\352bW\265\261\255\372\330W\215"
+	.ascii	"\325Y\215l\255\336j\256\356j\257N\366W+\033\254\227\035\326b"
+	.ascii	"=\326d]\326f}\326h\235\326j\275\326l\335\326n\375\326\001?\364"
+	.ascii	"\2533Peo\240`\335\201.\373\003\rk *\326\"\350X\223\240d]\202"
+	.ascii	"\226\365\tj\326)\350Y\257\240h\335\202\246\365\013\252\3261\350"
+	.ascii	"Z\317\240l]\203\266\365\r\352\3269\350[\357\240\314\356A\341"
+	.ascii	"\372\007mv\020\032\327C\250\\\007\321\2716B\351\032\t\255ka\212"
+	.ascii	"\320\3034\241\231\322^\023S\205~J\027:*e\350\251\264\241\213"
+	.ascii	"\251C\033S_\037\323\207\306J!\032\231F\364V*\321]\351D'S\212"
+	.ascii	"V\246\025\275L-Z,\275h\262\364\327f)F\243\245\031\255\226j4["
+	.ascii	"\272\321n\256\322\314\224\243\233iG\313\245\036M\227~8B\n\342"
+	.ascii	"\275\024\350\013i\2107\244\"\356KG\034\"%q\211t\003\247HK\334"
+	.ascii	"\"5\361_z\342\031)\212o\244)\336\221\252\370G\272\342\300\224"
+	.ascii	"\305E\322\026'I]\274$}\361\223\024\306S\322\030_Ie\274%\235\361"
+	.ascii	"\227\224\306c\322\032\237Im\274&\275\361\233\024\307s\322\034"
+	.ascii	"\337Iu\274'\335\361\237\224\307\203\322\036\037J}<\230\376\270"
+	.ascii	"Q\n\344Hi\220\013S!\037\246C\316\224\02291\r\372SZ\344Q\251\221"
+	.ascii	"O\245G^L\221\334\230&\3711\025:V\252\344\310t\350[\351\222w\245"
+	.ascii	"L\236L\233\\\231\022}\231:\271X\372\344d)\224\233\245Q\216\226"
+	.ascii	"J\271Z:\345l)\225\273\245Eg\246U\336L\215.\227Z9]z|\204\364\352"
+	.ascii	"{)\326/\244Y\337\220\"\337\227j=D\272\365\022)\327S\244]o\221"
+	.ascii	"z\375/M~F\372\365\033\251\362;R\260\377H\227\017L\303^$\025{"
+	.ascii	"\222t\354KR\262?I\313>%5\373\225\364\354[R\264\177I\323>&U\373"
+	.ascii	"\231t\355kR\266\277I\333>'u\373\235\364\355{R\346\377\244p\037"
+	.ascii	"\2246\177(\215\373`*\367F\351\334#\245t/L\353~\250\"<\223\232"
+	.ascii	"\360D\265\367O\252\302G\251\013?\2452|Qmx\243\352\360G\325\367"
+	.ascii	"X\352\303#U\210\337R#\276K\225\370\244:\361J\225\342\227j\305"
+	.ascii	"\213\251\026O\246^\274\231\372{4\025\343\325\324\214gS5\336M"
+	.ascii	"\335x\246\312\361M\265\343\345T\217\247S?,\202\nb{*\320.\250"
+	.ascii	"!\266A\025\261>u\304B\250$VB\335\300R\250%\326B5\261?\365\304"
+	.ascii	"f\250(vCM\261\035\252\212\375PW,Pe\261\"j\213%Q]l\211\372bOT"
+	.ascii	"\030\233\242\306\330\025UF\003u\306\272\2504\026F\255\2612\252"
+	.ascii	"\215\245Qo\254\215\212cq\324\034%\rSW\213\224\207Q[J\333p\260"
+	.ascii	"\264u\360]jB\224aU\004\255\005\207\027/$#:p\rRT8I\215\343\332"
+	.ascii	"\230\325\216\320\203\204\210\230\214\\\223r\254j\201Up2J0\214"
+	.ascii	"C|\323D\234\230tQ07@\207\210\236\260\017\030"
+	.string	"w\032e'Io\033 \375\240\330\266lvz?t\023|\221|k\316\230J\037.\016`\232\233\253\212\241\031\361%y\232(v\345\373\232r\340\233\263\001_\213\"\026\250\tQd\221\305y\327P\350\261B\261\261T\t\262\235\034qD\245y]\315$$\240\005\344(\374\201\2530\013\323*\222@\001bP\360\252Q\342\222yJj\272\035<\241dX-\261|\270\007\"\204\357K\037\325\265\t\261\025\210~|Mn\3702\024\213`(\350`i.\305`\t\313\370\006U\234\320 H9EW\033\337+#\216\224\021\214U\035\037vVd\210\"\311&\271.\t\256\221\270\357\242\201\263t\336\222Tt@\030\223\236\243\210>3\206\261T)q\370.`\360-\226\244\r\361\235\3709\343\r\244\222\0271\303\\>dN\2244\220\234\341-g\353\t\252\331\263\231\372\312qp\034\207S\343[4g\305\344k#1)<\276+"
+	.ascii	"\210q@\205iCy\304f\343\025\325u\t\3551\303C\241%\324F\2265\214"
+	.ascii	"[\361\250Qx\342\332qK\312\350\037J\r\310T\013\035\\\207\320E"
+	.ascii	"\253\311\f\210\bm\314\344\347A\f7`|\2137\313(+&\204\017\314\313"
+	.ascii	"R\b\021\255\263<\374c{8\310\372\360\220\375\341\240\005b#\033"
+	.ascii	"\304HV\210\205v\210\207\226\210\231l\220\211\266\210\237\254"
+	.ascii	"\021G\331#\236\262H\\\264Il\264B>Z%\306\262CF\332%\336\262L\334"
+	.ascii	"e\2338i\211\254\264N\274\264O,f\241\230\314F\261\231\225b4;\305"
+	.ascii	"j\226\212\331l\221\335l\0253\255\221\233\326\212\345\354\221"
+	.ascii	"\351\354U#X\254\356\331\254^\260\310n\260Z\355\263[\ra\271Z\302"
+	.ascii	"v5\205\365j\013\233\354\237\375\352\f\253\354\r\013\326\035v"
+	.ascii	"\331\0376\254\201V\254E\354"
+	.string	"X\223X\262.\261e}b\315:\305\236\365\212E\353\026\233\326/V\255c\354Z\317X\266\256\261m}c\335:\307\276\365\216ev\217\205\353\037\333\354 \033\327CV\256\203v\256\215,]#\331\272\026\236\b=<\023\232\351\3545\361T\350\247s\241\243N\206\236:\033\272x:\264\361\364\365\361|h\254\023\242\221gD\007v\307\332\240;\026G\3251\301\016\247\0042\230"
+	.ascii	"\202\257\007\003u\207\177T\036\016R{xH\365\341\240\372\303F*"
+	.ascii	"\020#\251A,T\205x\250\0161\223J\304D5\310Oj\021G\251F<\245\036"
+	.ascii	"qQEb\243\232\304GU\310X\252\022#\325!o\251K\334\2452qRmb\245"
+	.ascii	"J\344\245\352\304b\352\023\223\251Pl\246F1\232*\305j\352\024"
+	.ascii	"\263\251T\354\246\026\231\251VqS5\262\234j\305t\352\261\021\324"
+	.ascii	"\253\356\251X\275\240fu\203\212l\237\252\325\020\352VK\250\\"
+	.ascii	"M\241v\265\205\352\325?5\331\031\352Wo\250\312\356P\301\372C"
+	.ascii	"]6P\rk\021U\254I\324\261.Q\311\372D-\353\024\325\254W\324\263"
+	.ascii	"nQ\321\372EM\353\030U\255g\324\265\256Q\331\372Fm\353\034\325"
+	.ascii	"\255w\324\267\356Q\231\375\243\302u\220\332\354!5\256\203\252"
+	.ascii	"\\\033\251s\215\244\322\265P\255\353\341\212\320LkB\023\327^"
+	.ascii	"?\255\n\035\265.\364\324\312\320\305\265\241\215\253C\037W_c"
+	.ascii	"\255\017\215\\!zk\215\350\256U\242\223\353D+W\212^\256\025-\266"
+	.ascii	"Z4\331z\321f\353\257\321V\214V[3\232m\325h\267S\246\231\353F"
+	.ascii	"7W\216\226[;\232n\365p\204\365\303{+\210/\254@oXC\334\267\212"
+	.ascii	"8\304:\342\022+\211S\254\033\270\305Z\342\277\325\3043\326\023"
+	.ascii	"\337XQ\274cM\361\217U\305\201\353\212\213\254,N\302W^\262\266"
+	.ascii	"\370\311\352\342)\353\213\257\2540\336\262\306\370\313*\3431"
+	.ascii	"\353\214\317\2544^\263\326\370\315j\3439\353\215\357\2548\336"
+	.ascii	"\263\346\370\317\252\343A\353\216\017\255<\036\\{\334h\365q\244"
+	.ascii	"\365\307\205+\220\017\327 gZ\205\234\270\016\371\323J\344Qk\320"
+	.ascii	"\247\326\"/\256Fn\\\217\374\270\"9\326\232\344\310U\350[\253"
+	.ascii	"\222w\255CO\256K\256\\\231|\2716\271\330Jt\262\325\311\315\326"
+	.ascii	"'G[\241\\m\215r\266U\312\335\326)g\256T\336\\\213.\267V9\335"
+	.ascii	"j|\204\325\352{\353\361\027\326\253oX\261\336\267f=\304\212|"
+	.ascii	"\211U\353)\326\255\267X\271\376\267v}\306\352\365\033k\362;\326"
+	.ascii	"\257\377X\225\017\\\301^d]>\311\032\366%\253\330\237\254c\237"
+	.ascii	"\262\222\375\312Z\366-\253\331\277\254g\037\263\242\375\314\232"
+	.ascii	"\3665\253\332\337\254k\237\263\262\375"
+	.string	"\316\332\366=\253\333\377\254o\037\2642\177h\205\373\340\332|\2435\356\221V\271\027\256s?\\\351\236i\255{\342\016\341\237v\t\037\265\353\375\324N\341\213\273\2057\356\030\376\270kx\254\235\303#w\276\337\332=|\327\016\342\223\273\210W\356$~\271\233x\261\035\305\223\355*\336lg\361h\273\213W\333\375\236m\207\361n\273\214g\3564\276\271\333x\271\035\307\323\355:,\302\316\303\366v\037va\007b\033v@\353\333\205X\210\235\210\225\330\215X\212\035\211\265\330m`\177\273\022\233\2613\261\033\273\023\333\261C\261\037\273\024\013\334\251X\221\335\212%\331\261\330\222]\213=\331\271\330\224\335\213]\331\301h\260\213\261.;\031\013\263\233\2612;\032K\263\253\2616;\033\213\263\273\231\300\006A\257\005\024\"$\260\236\257\204e8&\341E\3043\032\213\344\332\201Q\024N\006\337\257\267b\nO\2072\356\350*@\356"
+	.string	"\254\343\213\354Z\026\245$\t\312\260\244\207\023\276\fC\261%\210\225\226\0073\037sz\341;!\245\346\201\013"
+	.string	"\314\224U\271\301h\334\\\021\233\036;Zt2!\025?FL\363\005\325\2402\304\3253a\262)\243\220\371\tk\302 \\p\332\246\270Mg#\r\001O6?\2359\016\2547\241*\221\034\270\r\243\233O\361#\305\301#yT\302T\330\"\272\212\211\253"
+	.ascii	"!kj\341\033\261\354\036\2459\216\034 \252\0206\214\032(\264\021"
+	.ascii	"\255\240,9\020d\217\225\b\323\304\247\3002\034\223\350\301\020"
+	.ascii	"\317\020\202^([H`\016<\035Iq`G O\001\326\361U\"i,\216\326\242"
+	.ascii	"\026pN2\336\212|\305\\V\"\036\314|\350\364\302w\342 \254\253"
+	.ascii	"\210$A)L:a\037\303\325Y\323cG\313\214.\344GJ\355b\206\251\312"
+	.ascii	"MB\343\206\351WF!c#\304\b\203p\2311\372BkP\031\342\352\231l\314"
+	.ascii	"\345`\025\205D\340t\214U>\375\366\301\031mS|u6\3224x\262\371"
+	.ascii	"y3\306\217\025=dM-|#\226\r\242\304Lq\340\233<\202+9\260RP\301"
+	.ascii	"\026\003\210F\350\202\262\202\344Z\013\244\256\307\212\211\305"
+	.ascii	"\001\244\372a\303\250\201BCy\370\007\355\341 \324\207\207\320"
+	.ascii	"\037\016\242@l\204\0061\022*\304Bt\210\207(\0213\241A&\242E\374"
+	.ascii	"\204\032q\024z\304S(\022\027\321$6\242B>\242J\214\205\016\031"
+	.ascii	"\211.\361\026\312\304]h\023'Q\"+Q'^\242O,\206B1\031\032\305f"
+	.ascii	"\250\024\243\241S\254\206R1\033Zd7\264\212\231\250\221\233\250"
+	.ascii	"\025\313\241G\246C\257\032\001\305\352\036\232\325\013(\262\033"
+	.ascii	"P\255\366\241[\r\201r\265\004\332\325\024\250W[\240\311\016\204"
+	.ascii	"\371\25030\227\254;\324c\3778\223\027\210\220H,\220\301x\332"
+	.ascii	"\357\023\200\202T\034o\343\322KcI\007\3617\266\200\002\250\376"
+	.ascii	"\211\\\335=\333\274\320+\344\003*\345\275!8\345\311\323\216\256"
+	.ascii	"\307\006{\035\256\224z\256\275\337\022G\222\364\321\263\323\272"
+	.ascii	"\027\370T\243\320y3\267\263\365\305\013^\300\233_\260d\213\324"
+	.ascii	"#x\tr\006u\302\372\230{J{^\265$\222Z\bSk\322u\021\317d\b\262"
+	.ascii	"x\306\335r\232\354\230\255\2554\206\246\353O\"\226N\316\246\037"
+	.ascii	"\372>I\216\202\342'\017\316\376!\322\020\303v\200\212\231\001"
+	.ascii	"\311\213\247\251\325\333\354\034\030W\"=\206\255;\200,9\243b"
+	.ascii	"\027\304\341\253\3573\026\n\202>\334\324\032\207\023&\251\341"
+	.ascii	"\t&qmU\356\316\254[\352-\232l\f\266\224d\215\200c\022dr\216\356"
+	.ascii	"\024\300pZ-\211XE\032\246\265\253\216P\326Oj\336d\374l\337,a"
+	.ascii	"\273>\264\273\221\337e\273\255|\350s\202\006\316Q\325\351j\r"
+	.ascii	"y\007B\315+\fb\346G\200\344\266\301}\256{2\343\343\215\255\350"
+	.ascii	"\363\235C\314R\304m\224P\"x\bf\325K\374\207N\020G\267=\004pm"
+	.ascii	"\027\331\036\305\236\324\207`Q\354\005\311\004\345\3015\317c"
+	.ascii	"_\352\260\274\265\032\226k\031\022\342Q\2077\255n\225|k{\b\032"
+	.ascii	"<\225\326S\356E\224\307\350\267\357\233\236{\255'rf\340\2605"
+	.ascii	"\206H]l\222K\315\236\001\332M\231\215(\264\nN\240\343A$D\215"
+	.ascii	"D\266\242\361X\230\333!\0209q\355\301\235\037B\344L\3343\255"
+	.ascii	"\356E\240\252\372\241\277\013o\206V\354%5\371sH\251\332\233\r"
+	.ascii	"gA\374\035\rI\367\345yv\024\020\222\350\244-f\241\023\ny\324"
+	.ascii	"\2204\370X5~\325\2503\251\203\351\022\031\251\250<\217\031\230"
+	.ascii	"\031N\267\263q\317\314\227\031bS\334\367d\177\025c\031\333\306"
+	.ascii	"S\252X<\303^\340\226\216\357}\225\230\350\027\200\241\354\013"
+	.ascii	"\021xc\221\264\307\006I\370s\025T"
+	.string	"\266\033Z\236\021\364\316a\261E\233\272BL\266\203\366;\353r\202\217E1\n\232\001.\251\316sfPG\002F\254\006\356\377.X\363\221\364\006\224Q$\212`\245V\343)LTX\333\021\n/\n\r]*Zj\234\230Hi\242\305\352Z\302\233\r9\311\234\207.\305\221$\376\265\347\301\241Z\200\244\353\317\224\323\373\016\306xR\337t$\375\352\226\265\253\244c\n[\261\026\377\214\233\027G$\017Z\021W&\343\336\306\220\223\202\332\245r\017N\341xJ\3144;\352b\366_x-\324\347P?2\004]\037k#\352\366\302\273x\262\247\253O\320-aZC\337K\2701w.\226,( \361D4\201\255[B\255\202\265\270\370\022:\241+\376\245\376\374y\342\263O=t,dx\276*\331oCay\304\242\320'\321\025\202$\210\335(\n\370W\017\206\034J\323\343=\021\234\243\277Nk\371\315[/U"
+	.ascii	"?5_\372\303\340\004\314\237BJ\212O\003\205\316"
+	.string	"\353\002\371hc\216\310\206G\262\034\003(\371\017\334\370*\257z\3006\\|\344\352\r\001J\030\277H\013U*3\232' \230\016\3651\370b\003D\302\211\361\0039\031\022\2171t]\256P\374.G\353b\332\324\301Fr\242\317Z*\256eL\377\264\243u\304\231W\246)\221d\020\263a\362\244\232\236\005\037\300\252\250,\242QU!\336/\005\362zr\275\211\350\360\241\017\217\276h*s\310\320\317(m\343\271\246B\310\036\217\250\227n\204\r\ny\263.\240\270\200\213\003i}+\315\016\275\214\206c~\356\316\341\207_\240:\211h\037\253\224u\203mq\323\023\225\315\337\342^O\223\220b\210\312\324\003\264f`\234\315\f\210\313\210\t\206\324\257~\314\217\262\264d\021\003\277\376\3468H9\253a\242_-\005]Vb\271\213\341\274l\2223\216Ghb\362\275\2205\344Le\250\242\272\005U\321\277k\265\307\035\235\307"
+	.string	"\261\233\254\271\332C\032\220ol%\343#\230$x\311\262\262 \204\345\035\021\353\340\311\255\374Zu\005p\331\333%[\037\2603-d\251\236\265\364\250\323\241\346\367\321\331\277\213\262'_\266\246*\241\210\366\355$\237.\302I\233\032\210\302mrA\324\373\350e^(\241k\367\233\344D[\346\321\316`BC\243Qp\306p\020m[\262\027\262D\207\325G\003?}v\3138\323N0\270\210\371T\027\302V\222\006\360\023\225bm>F4\275\204\316?\333^\322\252\324\315V\324iC\3055\036\030\353\217\250a2\250\222\210\205\255\021\350\246\274.\267\006\340\266\360cw\365\337\265\301\200\314w\236$\353)\243.\344\016\270\233H\272C\325\213S\0349\202]\307\232\326\013\373v\253\313\366\020\fx\340\365VJ\234/\034[\311\035\211\371\320KT\335\332\017\262\030"
+	.string	"\200\301\247\033bI\326|5h;\307\317R\035\210\013\031\301q\313p\373d\013\203\f\254\032\372\311\r\3217\364\374Q'\202# \2666\276,\f\216"
+	.string	"\233\214L\242Z\347l\331\304\016\006\301\324\266.`\302l\037\332;9\263\f\222|X\310\274\354\353\374\361bM\006Eb\357\305\306\350`M\273\b\364\bi8\004b\3327A\033\275)\341\207\373\372\023s\353D\361\367\302\274\240\261`\273\001"
+	.string	"\032t\265\267\206\266?\310\037\311V\372N\232\341\f0\240\333\323\275\371g\212\"\350\025.\340\310M\215?\262\324"
+	.string	"\205\013\340\214d\357\331\363,\200\234\361\006`y\323B\305\t\275\212\303\262\b>\203\323s\316\221;\274\346\345BD4dP\005\224\227I0g/\204\333\016\242\303\351W\"\037P\201\243\330\265\031\301y+kI\207"
+	.string	"\001pg\234E\347\t\022\025\f\370S\026l\030\021>\307\361\004BlQ\252\266L\024\020x\f\301\305g\020?\2043A\031\215\th\332\337\303\227\302\022\341`\264\316\016\323\005\026\242}\232h\370$\036v\332B\233\223\307\251\327I\033"
+	.string	"\230?}\211\230oL\354\201\t\273Y\376\022\221|>l\331\020\373|\322\320#\230!>\225\375A`\342F%\034\370\2453S>\2666bB\bex\3660\350\270\b\206\253\235\030\020v\265QE\200\\2\213\353\207\362\245\301Hp\211\201\001E\200!8\031t\262\3243\3426.P\002\350\004\023\330F\nx<0f0\266e\353w\002\226K\033\301\235\316\"P"
+	.string	"$"
+	.ascii	"*\210\235I\210o\300\3110\203\211\001\306\00630\n\\\2045(\310"
+	.ascii	"\2144\t|\266\335e#$\214\324\372e\227\002\004.&\277\275LY\003"
+	.ascii	"\202g\340{\002\210!t<\326\223Y\026g0\342\337B\356\210(j*\366"
+	.ascii	"\324\333\347\037\031\025\035\212\255\334\220\b\013u\337\013m"
+	.ascii	"\257t\311\245.\2205\350\002"
+	.text
+	.section	.gnu.lto_crc16_ccitt.5.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"\035\f"
+	.string	"\206\330S?0\217\222\016\360\240[D\3346\256<\340\273\244\217A\336p\303F\344L%\225\202)E\001|\321G.\214\r3\212\250\344\323\032\n\361"
+	.string	"\031I1\261\345\226\366ur\263\217\3044B\366&I\246\024C"
+	.string	"="
+	.string	"@"
+	.ascii	"\271A\204\212\314\255\323\315d\327"
+	.string	"\266\006\341\020\237f\270\241Xx'2h+.\231[\025\300\004\236\035z\300\263{\007g\306\254\266\212\021\314H\001r\201\242\004\304(1\310\314\"I\311\005\367n\273i\313iM!?i\217\325\024Ky\2633N\261\247c%\304>\304:\304F\307\036\261\210X\0030\206t\221\321\200Ef\205\320K\266p-\037\332~Z\252U\260\340\343\315@\237\251!F\002D\247du\031\033$\274\342\021\331\203]'|<\223\330\325\037\317Nz\007F\213{\364wk&\231\273?\230?\272=\302\323\377\3072\022\343\256x>\336#/ \fu\272\217,ZL\b\206\332\r\004\317\241u\224\001\034\2660\353\2654,\314\252:.\217\347\262\252\216\007\034\236\312\302<*\215\002\275 8\300*\t\327\205U\324\226\376\t\365\003!\007Us\351\324\255b\0010\232\t^\363b\213\331\304\325y\221)\262\321\226\343\022\0218(\231\"\001\023"
+	.ascii	"2\001\023\337\fJ\005\203P\202\230\034\330\264\314\323dV\026\272"
+	.ascii	"\214\347\324Lg\336\354\232xH-\242\304D\361y\023\314\005*`\360"
+	.ascii	"3\317\253\235d"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.6.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`\344\005U#"
+	.string	"\212B\b\016G\240\330M:\005/\240\376Sc;Y\351\265\n\264\006\342\017p\300\321\013\3367^\301\b\314O\331rY\216\311\275u\342 "
+	.string	"o\256\315\274\006\274\026|\364*/9\307\265\351\273\317\215\371\207\035\217\347\333\020\221F\bI2\311\316"
+	.string	"\273"
+	.string	"\316"
+	.ascii	"@\375\230\2602sN\032\bU\232E\253>\251\217\370\2474$\"\302\351"
+	.ascii	"\302fF\035\361\201\003\202\021\021\236\273\251\262w\342\307\330"
+	.ascii	"\234>#\213\352\200\264H\304E\236\2745\"\264"
+	.string	"\231Q2P0 -\036\b\277\252\3669\310\223\205\250\230o\346\274\0223\362\221\272k 9\025\347\214\341\225dN_M\211H\213\356a\037O\232[_\326\324x\204\007\257H\2319}6\033\353\214\026\3279\243\305\317\310m\350\263\3164|\316\344l,\303oN\235\324\365%EU\302\244\213\335\316hr\264\360H\266p\031\316L\244\260a,SVa\222\23110\377\274=*\335\2069X\370\376\271\b\310%E\305\302;\2330\347\324\225\242Ra\245\261\252f\251j\004UQL\332d\344\371\3360\200_\273\240n\313\366\\OLP\375X7\360\240\357\226\235\226n\313\364\300}\022?1^\020j\313T}\272=\226\252\223\262\314\214\351\257T\311U$r\265F\256\036\355\252Q\321\256. W\025\354*Q\202!!\003\261\021\330\2105\310[\366\001r\025\310Bl\003?Fb\365\3511\020+\317\256\356\354j\201r\225"
+	.string	"\315\252\016\271:`Ws\312U\034r\365\206\\\265\331U\001\345j\r\271\032\200\\\005\260\253\264]\245)W\313]%\311\325\331\256\216\273*\226\253\341\256\236\\\335\331\252m9ZW,T\2313E\331\231iE\004\273a#6\022\253\273\354\245JS\020\016:\367\216!T\242\326\214\372<\350:\337\256\335\016\335\2269\234s\316\360XC\354\363\004'\001\344\332i\r\370\315\207.\370\213\222\204\254#{\271A\350\322e\300%\320\300y\016\227\343\334gl\036\3407\177"
+	.string	"\374\302`-JB5g\271\001a\261\251\271"
+	.string	"+[sW\001\237"
+	.ascii	"\370\354\001n0\274\252\r\246\242d\240\243x\312\315\\R\326\"\200"
+	.ascii	"\033Hs\362\264\367\220\225\247\201\342\362>Mz/\200N\336?\257"
+	.ascii	"\025\031/\3502\347F\236\003]\227\347B\247\352d'JB]T\025\311M"
+	.ascii	"n@YsF%-1\023\\\350\032\026uI\303h)\213j\r\243\305\331\205\274"
+	.ascii	"\200\211\377\307\213`xU\341E\265\222\n\034\310\032j\021\037\213"
+	.ascii	"\364^\354\177\223\016\037\234\201i\351C\270!\204\006\246\245"
+	.ascii	"\016\343-\304-C\210s\302]qH8'\234\215\251\311\203\207&\234\215"
+	.ascii	"\211\303\315\203\r\347\004\302\206\264\243M\037\226\234l!\232"
+	.ascii	"\232\234l4\037\224\177\245\032\316z^T\364\232\025:\254@]G\376"
+	.ascii	"\\^\261\n3\n\371\374\207\314*8\""
+	.string	"]\303\222\347=A\3779\211!_\242\326\314\254\201\177.D\024\025\246\013\333\322\252\375\350H8D\257\005sY\036S\252\331K\354v\024\346\3505/`\013^\340F\037\311xU\n\276\340\346\005\241z\256\340c\327.\350/\357\234\350\366\362\020\013/]\330\326\231\236\357\020x\201\233\214\002\201{\nX\326{\0015\036K]\376JM\306\n\305\023\3349Zx\255\201\373\274\347\237I2V0>t\r\027\301y\336\273U\312\030o\25014\342\214s\206\031\022\031\021M\322V\003\240\002\021\262\"\017\020XFS\332t\327(\t5\240&\340\003S\314\325c\344 \023\250'Q\357\265\026iKx=\246u*^/\020\332W*\364\"\307m\236\256\227\242\275\031\351b \\\336=\262\205\357\315\326\214\224\245\303\332U@H\033\273\b\3015\035F\002\\>>Wn\0231\037\271\303qa9\246\3114\343\007\031\372\306\212pE"
+	.ascii	"\276y\003\r\232\2640\221\315\240\302p\355\225\266<e\006$\361"
+	.ascii	"\320\270Ao\260MW\234\334L\211\375\2262m\217]\037\030i\271\345"
+	.ascii	"N@\257\247\t\373\236\255J\370t\341\341UPF\337\353DE\005\202\003"
+	.ascii	"\236:w\f\"\273\006\016w\244\312\206r.T\340_}\216>\347\025S!?"
+	.ascii	"\037\0339\016L\337\364\304\357\177\313\016\355\177"
+	.text
+	.section	.gnu.lto_crc16_ccitt_sbuf_append.7.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"u\013"
+	.string	"V\227P=0Q\223\016#\002>\fO\262.a\255;\225\277\337\237N'L>\fv\245C\340\037\343\177\202\214\360ITF[\375\264\313K#\022\nU\303\212\254\221RIy\205\207\215lF6\2212\245>"
+	.string	"@"
+	.string	"<"
+	.string	"#\027^`\267\203\002\264\033\023\030\301\273s\274\001\351\356}\"\335\031\263e<\202\330\233h\001\362\251\261\273\224~8\366\304\374\177>i!\331\023@\203\335uj!\035n\275\355\003\266\027\330\217\020\357#\277$\245#\227\326(\235\231\276d\002z\341`\306.\207\315\306\206\234\212\020\367\374\366\377\261\304'\361\022\330=\025\336\202\336\006\r.h\354F\313\235\025\274;\002\231\321B\f\313\323\376\210\213`\017\372\324r[#!\257MZ\371\320\314\251\252\312\002\344FGn~zM\245\300\370\020\341\221\233\247\224\324\256(\344\265+\203\025\"!\f\232\3311K\365`?\332\335\265v\354{\356\351\361\017\320\202zY\230\213\343.\016\0045\274@\013R\034\325fSA\212C\203\331P\320\342P\027\212\253\t\031\213\272\252\312\242$q\037\255v\374 E\250C=< #\205\231\274\346J\006\315<i\244\001Nl\002R\003\020"
+	.ascii	"3\241\325(\306\362\303\213B\bHQ#\f\327\034\202\271\034\316\034"
+	.ascii	"\3321\3411\240\r4\001x\003\224\025p-/\204I\006"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.8.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"}\t"
+	.string	"\006\022A90\345(\035\236\023S\b\270/\006\254\231\203\333lbv\300\260\343\353\351\022\332\323\247\363\177\303\372\334\242\031\301\354\f\254\214\024\207Vh\034\317l\275L\337\225PWK\b\2212\2450"
+	.string	"/"
+	.string	"0"
+	.string	"\233m#$\214\f>d\245\270\215\226\023\211l7\214\252q\360\t\372\0079\347\344\345\265R\242\"=1\013\273\353D\251,n\275m\216m\003\373\002\001i\356\256_{\353\327L\247\246\217\271G\205\314\205!e75\003\260*\033\254\303\366\310\316\330.M\254 \363-\320\272\213\361a\262\033\036\230\023\360K\241\020r\221\220v\216o\226\020qG}\363E\3347N7,\260k\352O\001J9\263\246\252W\r\345ta\312\231\035\222R3\354k\253+\333\001\236w_\247\356:\335\327E\220\367\371x]\0049x>\261\373B\2613`\357\241\341\213\021\236\367\305L\270\327VW\234\022\224\324d\333\023\037\3616\261\277 4\254\r\020"
+	.string	"2\241#h`-\2610\001*h\034l\206\003\004\347\032~\225E\021\230"
+	.ascii	"A5p\005\314\365\031xz\036|\265\363\t"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_update.9.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`\n\005\355\036"
+	.string	"\006:\306G\240\226\316p\204?l\362\324\322\231\262\250{\264\374\211\364\346\0328\343.p,\035\037\314\214\242\017\371\306\264\276S&w\357\"3\b\"\274\032\274\303\353\360jl)\270\210\320uT\024q\367\231\331q\032\264\311\336[\312\224\002\266"
+	.string	"\236"
+	.string	"\263"
+	.string	"\347\210\227\323\351F\207\026\r\276\226~BQ\345\206C\017l\347I,p\322\f\314\2234\336\325t/\r\343\313\351d\202\003\002\363\344\316\270j?\306e4\235h'\2079\317+&\005\210\337\225'\315\313\224'\255z.\240\367<K\210\3518O\342\001\0130O*X\320d\340\211YSe\212aT\r)\347I\354\355\t\240\216\304\033\347q\2017qen\\\005\372@?\306\244\2526\334\034\001\245\270\025-\021/M\021\317\215\270\247\251\025'BEb\004rc#{\361:\254\022\352\250\005\342\373\342\t\234\215IU\201\270\342 \234\347i\225\252\372p\257\334v\226m\0076i\023X\266\2775{\263\252\006\345B\250o\266\331/\223\217(QU\202\372f\023\205\272X\366\201\262\334\330\274W\266\251\356Qu"
+	.ascii	"S\315\263\243\303\3139\327\217\363\257\373\346^\277\315\211\177"
+	.ascii	"\r\315\303\356\335\314\271n\031S\035\223S\303\230\352\027U\003"
+	.ascii	"0\325.\246\272\305T\263\250Zg\252WLu\316T\233\252\306\231\352"
+	.ascii	"\322T\223\252\036M\365\232j\305\251\357C\323c\310\204\265\363"
+	.ascii	"\234z\233r\246\221d,\376\365\207\335\277q1[\347\244\333\360\266"
+	.ascii	"\215I9\317S\227d\353N\336n\362\301^\264.li\f\013\263\212\003"
+	.ascii	"\352\205P\337>\236\347y\216\2135\343\273\335Y\246\263\261\227"
+	.ascii	"mY\035\n7\362;\024\003W\363\375I\221\227=\024\227\005@d]\226"
+	.ascii	"\327\306\262\271m\271\360\264\337\203\034\270\020\337\315\320"
+	.ascii	"X\366AVV\007DW\026Gmhe.\271\271\375\321\177\374\356u\263\237"
+	.ascii	"\371\036\370\320\273l\357U.n\037U%X\366rk\312\206VA;\303y\374"
+	.ascii	"|\262l\377\234\314\307;r\236N@:\276Ch\274\212\223\2660T^\352"
+	.ascii	"\244?T\236$\327\007\005\331\356\270\227Y\335\335\221IT\b\341"
+	.ascii	"sH\370\231*\374\245\362\244\356[\234\231\r\255\202\372\246\013"
+	.ascii	"f\366T\265\033G\257P$t4^P\262P$\204\241\fR\n\2520\372\220|k\337"
+	.ascii	"\217\017\311\327+2\"\"2\362\365\212\206\202\210z>\244\244\336"
+	.ascii	"O\215\215\216\204\220zJFFH=\0351\370\0217\26399\353\022\202G"
+	.ascii	"Zp\205f\361\271![MJ\336ni\250lU){\326cNfgn\226f\231\272\2228"
+	.ascii	"\251\033.\301i\226\267/^\300\323\230p\355\013\b\343K~\274#\027"
+	.ascii	"S\342\313\311J\322\263<$<\033`fc\226g/\366\001WP\272\326\300"
+	.ascii	"\"\304\354\251\316\336\312\305\362s{\345\267m\225\330\235\275"
+	.ascii	"\226\026\232\326\354n\207/\336l\333Z\261:\353QqVf\207{\003)a"
+	.ascii	"\366/\272\320\234\324\315\273\275\t`\250Q<\242\030s\210DD$ m"
+	.ascii	"\2224\006\300\002\221)\343\016\020P\307\244\302f8W\374m\273h"
+	.ascii	" ~\241\211\360OWL\005\361\013\201\007\351#\177\315\215\233(\034"
+	.ascii	"\210\260\036\212\237\325RBW\304\231\341?\204\255H\252Of\371s"
+	.ascii	"iI\235\312!\210\243\313\365X\2655\245\260\247J\327\313D\235v"
+	.ascii	"r\302\360/5\317P-4\260\262\241\216\337.\235\350D\272\223q\r\254"
+	.ascii	"\247\265\222\204m\307\0042\241`\254\224\371\037RRZ\250\273\373"
+	.ascii	"\002\272h\272\333&A\352\233O/z&\231Np\313\303\276:+\363\267\n"
+	.ascii	"\304\326M\337\254\324\354\325\003\216!Z(c\3528*\232q\340:\247"
+	.ascii	"'\376\374=\351,\361\007"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_sbuf_append.10.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\315\013"
+	.string	"v\027R? Q\233\016\257\200\213a\013S\ti+-\215\300\277}S\304\017\301\232\005\n\230\340F!\352m\243\366\002\2463L\202q^\367O!\b@\365\225\013R\317\020\250\005\375\253\340\367m\275\211\224)\005>"
+	.string	"@"
+	.string	"?"
+	.string	"\241\316\007\354\202Z\270\330\215\n\234"
+	.string	"\3769\276\300\364\007O`\372\363f\327x\f\261_\021\3621\202cw+\005\361\355\271\371\0279\200\016\204{R\020v\327\331\201t\270\365\266\021\330n`\377B\206\217?\365\320?Mi\351\245UJg\246?1P\"C\202\215]\016\243\034K\362^\214\270\350\267\177\021S\314\300\301v\221\006\270$(\0253D\224\354F\313\237\027\300\214\034\032\226\247\375\023G\261=\251J\251\345\266\205+\337A\255x(\347TUe\361\261\203\322k*\245\303\243\304\307\330Sp\340\356>\360G\262\f0\2443\375]\005x\200a\"\344\311\221\035\271\324\017\366\245\335]+\310\276\350\001Vf\251\226a\264\315\3236\023\324\326\305\312\254J\203]\027fU\232\n\230\253\262\262Mu9`\fC&\2534\f\313*J\334K\253 G\270A\342\321\217\003\244\244\223\332\031\n\371\316\225\r\312\031\252\244\223\030#J\022"
+	.ascii	"2\241m\034X\270\360,j\234V\3411\215\355[\\)\023\202\341\232h"
+	.ascii	"\207#\3406\230\320\004P\004\215\001\024\001\312\n\270\226\027"
+	.ascii	"\302$\003"
+	.text
+	.section	.gnu.lto_crc8_xor_update.11.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`\225\003\265\031"
+	.string	"\346o\246I\260\226Q:\345\025l\324\300\241\243\211d\036~\025v/\361\330\f\022^\215!\f\027\226\215\230k\256\264}\360\203_\256\202Q\275\313\030\205\037\353c\003\377\007\375\216\253_\347\344\372\373c[\201\235\275\266\271\332O\b\331[\356\224\002\217"
+	.string	"\213"
+	.string	"\222"
+	.ascii	"\037\026\210\247\005\346J\3738\236c\347\243\233\336\252\025\005"
+	.ascii	"\024\004\343\005\200\247\342]\340\251\245\274\216\346\255\325"
+	.ascii	"\204\017!\265\216\tl@<m\340`\307\264\217+\202@\0266n=\250\324"
+	.ascii	":\276V\005M\316\361\016=\227v1\004\351\\I\363e\230\232\200r<"
+	.ascii	"\027\337Dh\204M\206D\007-\020\001\312\021\235\316\360'\310\305"
+	.ascii	"*\3673e|NC\316\273\304\345jr\306\020\361=\357\007zA\200r\".\303"
+	.ascii	"\b\265VK\240\\\210\033u\333,lO\260\267D2+|N^\024\366\200\230"
+	.ascii	"\2244\314w\367\213K\213\353\272?@\213\305r\245{u\036?\200\225"
+	.ascii	"\217\277\352Hw\352\273\335-^w\207(i"
+	.string	"\020%ME\351)Jo(-A\351\023x\3211\251\240\244\326\240_\225\272\204\016yq\244_\351\337}\355\333_\262U\267w\374\244\3738\317\252]\316\254#X\325\207\247\203!A)\347\325&\204\302\341n@@\322\021y\204\304$\236\222S\255#\202S?\020Ow\374h\347<t&\253\372\234\b;\227B\357g{b\355\215\334\206X\267\021\220e\267Ho\212\355\251F7\205\277tZ\204\2641\333\241\b\204\364u\300\324\342.\245\310D\214\032@\244j\305\305\355\335\003\345\236\306Q\022\037\351\263\270\362\207\215FM\376>k\255u\352\270\270\003\366\274O_/\b\314\2466f!\364\236\334\206j\007\022\323\340\267\3603\200\2470\373\245O\031=%8\022=\362'7\351\310On\375U\355j\245\023\333\214\232\374\031\300~= i\272=\365\310\237=\362\310Ma?7\247\211\325\334L\232\231Lgb\300\271\020\253\331"
+	.string	"\316\340\314\320L\330\f\266\206)\200\315`\257\230\314\306F\006{\3052\314\330\274`3\016/\0050\226\335\324\314^82\331\354\245\032\353g\030nK\313\256\210\214\226\364lM\344\035\305\304\310\005\370\262\236teQ\213\3131\302\001\272l\215\021\b\352\332p\265\250\365p\004\305G\372B38j_\366\206\351\210mF\270\340\272\354\243\024\331pA\254\265\346\200\247\240\020&p\246\226eq\236S\334\225"
+	.ascii	"K\327\265\277\r\265\226n\003\246\244\226\310\nH\250a4b\fR\b)"
+	.ascii	"4D\001iK\265\006\220\002\231\302\332\001\020\200V\242\264\031"
+	.ascii	"\024\334\257\037b\247\"\352A\232\0262\352H}\222\016bG\344A\004"
+	.ascii	"\371W\035d\277\250y\212y{\t\301p\317GJtXO\207\003\\\375\340\264"
+	.ascii	"'\344\306\267\027O\310)]\300\234\242\274o\243\331\365\353\205"
+	.ascii	"4\265\242\360\177N\003\307\254.ZJ\354\204\232\024(9\341\345W"
+	.ascii	"5\340Zj\\)\230S\252\207\311\335\022m\275q[\006\337D\203\030\364"
+	.ascii	"`|\336%\207'i\300\212w\372\352\3219B\r"
+	.text
+	.section	.gnu.lto_crc8_xor_sbuf_append.12.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`\243\004\265\036"
+	.string	"\026\271\304J\240VN:\205w=A\346\005\247?o\223\207R\327\251GL|\323s\306&\250\223\363Z=\312\006QP\345\377}\205t\277w\317l!\215W\306\215\321a\274\034e\306\005\300\336"
+	.string	"\037Gz(\351\241J\315\254%\204\020\"wJ\001\257"
+	.string	"\247"
+	.string	"\260"
+	.string	"5\\4\340\235J\350\365\2474\003\002m,\270\324s\360\256c\350$R:\251\206Uc\265\n\013\234t\202\363d\200\3615\333T\310!I\201S\3735n\243\367\250\016g\251\365\3040\253V\241\001\0178OZx\230\362\344y\227\362\244{6\223\013S\324\017\221 \351\200Rk\305-\n\217=:\nos{?\315\222\034\227\366\374\033\027"
+	.string	"v$)H\364\363F\224\226~\324$\361\322\002WR\220\304\311\321<\372\320\244\022<\032\031\220\215m\235\353\024\030\364\321\361E\210\357\271N\200\210\225\024\fqjB\250\265\232&\005A\334\263\333n\262\r\301\036U\004t\231\3543HA6\346=a\237\324876546\352\031\231_\33516j\230\227\032\265KK\215\232\345vR\257\250\244<\353\266\321\250k\337\272i\327\272g3j\363\302\277|\324O\232\324{RSJ}"
+	.string	"2@\212\\\300\252\365C1J\r#\267Z|\353\327\372\263\376\253\217\366\375\036\357\372\360Y\276\326\267\316\345\032\217\252\336T\217w\034>\226)\302\311\214Zk\355\344\225s\024\364n\0054\326\245\007C$&\265s\024\360n\005\204\300\334ZAc\354\244\037\234\037\3325\236?\365\252\363pm\207\320X\227n\325h\030{\037H#n\267\217\362\266,]\304'\2772\037\271L~\327\311\247\251M\331\241'\017\324\037*m\013\274\223'\023\253\262\177!\343\212\226K[\240m\357\312\336I\n\314\210\222\231\266\263]Yj\365s\362\215\265\326:.\023\216\323V\205\210e\333\332\246\254\003\342\021\244\021\027\242\001\203\317\302\327)O\326\366]\037a\020\211"
+	.ascii	"K,\225\327Qpmn\271\263\245b\277\0308k\356\271>\222\ri\202T\266"
+	.ascii	"R,\026\2137\261\244\213\263\246HK>Zt\271_\272\246\330\317\311"
+	.ascii	"\347\334\2758\234\265\326\005\376\217 \236\223E\207M\021s\362"
+	.ascii	"\024UD\213\266\320\027\271]n\177\276\343\303\3633\356\354t\274"
+	.ascii	"1h\247\023\004D\006\001\355\254s\007r\273\034\316G\327\323\243"
+	.ascii	"\313\341|2\350\364\340r;"
+	.string	" \334\201\031\353~xv\270 \235n\207\253\t\213>\2324\0333!HX\321\372\374Bw\311\265)T\240Or\200\243%r\314\356\376\306\t\200\021A*+:\271>+\002\325T\332\254G\362fe\026(\004\025U\326,\017\224\007\022fidv\266\033\244\224\030Q2s\231l'\270\314\332\354\317\227\327/\006\315\316l\315~IX\004\013B\345\311\231\254\257r\264\355m\201\036G\332\336\274,\314\346|Q\271l\313\276\234-\353\262\022\210\305_\031\313\336\266%Y\250q4d\2144\304\22023\022\220\026\264-\006p\002!\2523\017\020XWB\332\264\006*\316\343%\374{:\342\274\037\276\017\307\0338\346=\203>!S\036eBAb\351\007,\026\253(\302\020\t>\034\355JA\326\036\353\017%ti\034U\241\3357\f\223\304&\324\337\362='X\360L\302\304\211Jk\"\f\375\025\332t|\255\203\374\340a"
+	.ascii	"\030\253LL\243\304\204Pwd@\273\242\206\025|\337\226+\316\202"
+	.ascii	"\203\367\013z5\246m4\341\266Y\003\213\315\374\t\340(Y\212\bk"
+	.ascii	"\263\036_\245\031\376zi\332X\320')\314\034\200U\272\2737\032"
+	.ascii	"V@!\017'\025$9\344\0243\347{\324Y\224\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\375\004"
+	.string	"\242\307\033$\240)\035\250\257~8\356\327X\357\035dO\376\323\377\243\332\355\313\254\375o\377[\367\267MH\354&\233H)Sv\021BRE\265FqjL\3611LqrT\361\245*\344Qu\3345\036\300\335\265\037\025\306\005\270xS\374I\334A\2749\3502\034\220\205\263\204\244\212\"\234I\2651\332\301\262l\347\333\211}\233\"\301ew\327}\245m\214\004\022"
+	.ascii	"`h0\264\313\320\255A\242f\030\240\036>@\250\277\264j\004\303"
+	.ascii	"eO'q\202G;\3609\240n\n\256\333I\347\255h\342\321\2512"
+	.text
+	.section	.gnu.lto_.refs.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\007"
+	.string	"\005\002"
+	.string	"\001\b"
+	.string	""
+	.string	"\001\016"
+	.string	""
+	.string	"\001\022"
+	.string	""
+	.string	"\001\026"
+	.string	""
+	.string	"\001$"
+	.string	"\001\004"
+	.string	"\005\003"
+	.string	"\005\006"
+	.string	"\005\006"
+	.string	""
+	.string	"\005\t"
+	.string	""
+	.string	"\005\r"
+	.string	""
+	.string	"\005\021"
+	.string	""
+	.string	"\005\033"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.13c21a1c5e5e739b,"e",@progbits
+	.string	"(\265/\375`k\016\365E"
+	.string	"\032u\244\031DP\234N:\253\200\362\312\204K\005Ty\363\243\213\304|~AM(\006\021~\222\361\250Qk\371\322\335\016?WV3\346"
+	.string	"DE\232\277\357\212\210C.  \024\241\034HZ\210D\021\004j8\244\032\222\266e\nJ\001\212\001\221\001v_\332\360b\363\355m\003puU\346\342\365\025\330\367\221\261\023\373HL\327\025\335+*6\274\276\353\376~\233K\207\031\342#\027\330\207\327w\230\277\251\355\245\351\332\315\031\232s6\200\004\254\322\323\342\265\341\372KW#4\230\267\\\317\375\307\371\3467\347\027\211\313\370T\273\340\225\250\t\030\261\003\366\035\367\241\267\274\341\230}G0\026\023\023;\202\021i}K\276\273"
+	.ascii	"\250\252B3\304k'\346\334\004\214D\271\005\030[K\362\275E\200"
+	.ascii	"Q\312\365f\344\207\262\2615\274\026\335\376f\353\266\b\305\326"
+	.ascii	"\312\315q9\277E,\324N\256\r\257\177\233\200\221m\001\306\366"
+	.ascii	"p\002?F\321 \0024\020\372q\211\277;\374}\324\364\337\215\035"
+	.ascii	"\222\b\005\310\037\203\340\36058\211\351o\343\206\277+hx\204"
+	.ascii	"&\372\361\002\273\3770\002\024\375\030\371\277Og\370\017\341"
+	.ascii	"\177\013\240\277\017\377'\026\3776\360w\201\377\370\307\311\277"
+	.ascii	"\227\376\266\360\267\204\277\037\374\335\340o\244\277\025\374"
+	.ascii	"m\364\367\200\277\221\177\037\377\356\377\210\377\001\377\257"
+	.ascii	"\371\037\365\337\316\334\177\275\377\203\377\003\377\357\375"
+	.ascii	"\317\373o\346\177\231\377u\377\333\376'\370\177\367?(111\361"
+	.ascii	"\307d\177c\375AH\001,\324\235\266x\356\224\250\245:\247-4lZ\224"
+	.ascii	"\325\326\204\214J\254\217\254\321Zh6\022\365rJ\211\370\332\327"
+	.ascii	"\315\1779w\034\221,m\220\263\227+\375sn\265\230'\237\221\347"
+	.ascii	"\234\323\3557\347| \372\024s3\224\257\265\342\346l\345y#G54_"
+	.ascii	"\276\f\245\371\232c^\331\212H\316\b\24297;\363\345\234\2339\347"
+	.ascii	"\243\324\353\315\271\213\250=\213Fs\3462\212f\257\346\030\"9"
+	.ascii	"\343\270@1\323\226*\346&\307\300Q\317\362\324\333\354\263\374"
+	.ascii	"\027&e\251M.\331\252\220=\233b\325\301k\323\351:]M\352\302\267"
+	.ascii	"a\3339\020\364\315T\2407\205_qxE\n\302\276\223\214\310N\"\034"
+	.ascii	"l\337\242\206\232\315\275\341\265\345\364\234\367`\013\346\036"
+	.ascii	"\324\340\346\354\354A$b\316Nd7\203n\006\353\232\230\031\030\343"
+	.ascii	"z\037q\002\205\244Ty{\342\025\320\250\215\364\331\361\301\353"
+	.ascii	"\243X8\375\246\253\375\327}\3576\355w\2437\347\271\234\363\273"
+	.ascii	"\315M\357\r5\213r\036s;\313\371}\206?\371\327lz\257\370\242\345"
+	.ascii	"<\006\206l\326\301m\345\311\3715\2320a}v\001\3043\256\017\301"
+	.ascii	"v\023{\r\354\337|{?\3245\206z{w\270M\236\325S/oH\316\026\025"
+	.ascii	"\223\274\277\321t\232\306\223\201\304\342\372\262\203\367\267"
+	.ascii	"\232^\323w2V9W\246Pe\241>j}\366\340\225\b\2779\2379B\276Z\321"
+	.ascii	"13e\252\334\f\353\360\332c\232LW\217:+\366\232pvf\207W"
+	.string	"\254\004\213a\255*\326\302\\'\336\334\214\221W$M\036\274%\0246\245eO\031\240-A.2Y\323)\316\302\331\315\371\354\b\007%\220\320\b\026H\210\207u\234\325w,\236\2221\201x\305G\372\216\311/z\006\267T\247\302W\315\005\242\212G\370s\327\327\n\0329\276\372\234b\"V!\037\274\342*\034\005t\325\252Ql\025t\326U\310\007\360\250\365\324\203\006\257E\272\357\353H\224-{\305\2676;[\b\361\023?\361T\307\3455\256\244 \351aX\213\211\034O\001\241\355\371\242\302+\036\322t?\324%k\364\340\025C?\310\204\246\251\365\035\243\336\025\242\236<\366\255\326\335\247\332}p3\2004E\233=\204Y\232E\001g\234\004\017\235$\211\353\221$}d\3367H\fX5\213\216}\343\351<\357\303j\0376\"\333\314\271\371\346+c5I\2214y2\227W\022R\013\214\233\266\347\215\370/mh:"
+	.ascii	"9A_U\341\231\203\327\326\323tC_hv\200x\275\235#\2418a\374\366"
+	.ascii	"\360\372&c\215\331)\3159\037\371y\263\364\t\300\330?\335I\277"
+	.ascii	"P\027\273\301\3775\027\021sF\322f\310V\251s*\301\353\177\244"
+	.ascii	"\374\264\234\233E\371\315\322\226\032\326l\275\364M\213\336\314"
+	.ascii	"\304@\246\216\345\366\r\233\256n\306\371\315\235\241aS\036\355"
+	.ascii	"\353J\333\327m\022e\250\333\314\371\235\022\265q\316f\267\324"
+	.ascii	"\260iKu\247E\031\232\233\231\352d\022MAK\346\212#S\322\005\024"
+	.ascii	"\023\307\362\005\200\001K) \310%\0263~\220\030Z\352\3414\343"
+	.ascii	"\007\r\247&\345R\271c\307\223\001(\346\023\215\035>\234\002@"
+	.ascii	"\345\230\361\324b\004\362FL&\016\245\322\211)\251\\*\203\256"
+	.ascii	"\304\261\204\212\202\262\301^\003\223\005\246& \3077y\300\340"
+	.ascii	"\001\203\361M\036\222I\017LI\366L\311\"\323i)\303\362\351\206"
+	.ascii	"re\376\306\205\032>f\350x\202"
+	.string	"Z2{(\270\324\016\250\245\022SJj\251\024D#\n\252\330\303\251\206\217\031=\214K\346\216\"\323\251\351\310tbJ2\243p\370`\237L\216@r\241\302\004\253\274\240\\*\225\242\244t\350\220R*E\341x\322\241\244\\\366P\272`\340E\350\353R\331\271\347Z\027^1[Q\bb\316N\314\206\261\033n;f;\362\370\227\326:\215kT\356|\231\251\201\255e|\207Vi\\Mv\305)\230\005J\321H\226\301),S\270\f\265\356\275\"e\225R\3453\264\322\004\332\032\223\323\302\253\231\031\246\322D\357S\020\fa\327\tS\243B;\246r,\323kr\004\257\370l\035R\005\321\275\023\273#X\327\226\225a)Fln\263\022H\b\224\3477\347\026\345XJ\357\035\337\f\377\232-\334\004\0263\213\2358\301P\372M\201\034\021-i9s%\005\215\311Q\357\220\035C\371\231rH\307\207W\374\004G\201\260"
+	.ascii	"\302u\321\255[\252p"
+	.string	"9)\034\033\373C*qS&\217^X\030\006[*[;>\201{b\026\306u\345\242\020\n\271\261\201e,]]\030\254\254H\021\313\017l\317\3271\230\320\025\251\237\033\016\2017\250\3014f\020%32#A\222\202$\351a\005\304 F\251\263\003\021@)\243Jj$I\222,\233\001\210(\340\367\275@\t\306\241\344\305\376\b\242M\275\260\335\271I\363~\345H\314\343\313\303\374<8xj\214\036j8VC\031U[;\271\n?$JI\261\303\2779\377\261\274\252\b\365?\370vu{~R\007\353\365\361\021#c\276%\n\\\305\004W\242@W \006\360j\237\201A\b\340=pW\310\fH\206G\217\327\202pA\230\351\033k\n\350\007\212h\355n/G\351\222\230\256`\256\005d\217\005\034`n\265\321\n_\360\217\252\024L\247nBle1h\346\247L?dii\321\374l\016\320]\252A\375\266~"
+	.ascii	"q\360\377\036\234\304>\301\320=/@\313g\177\203\b\251h\232\327"
+	.ascii	"0\013\020\007\372\374\236m0}_\r\322h\022\311\3068\2339\373\200"
+	.ascii	"\364\33007 !\374Q\006Or\237t\244{\352!\376\243\307+\022b\004"
+	.ascii	"\013w\235\021\334\204+\r\246\375\003\340\352\004yK\t\350\233"
+	.ascii	"\266z\317\371g\002\2175\357\220\240\224&\231g1y\314\267\235u"
+	.ascii	"\347T\303\352\013\350Z\372\356\253\3718\027xR\315Rt>\230\347"
+	.ascii	"Y8IK\322\256\262\215\303\233\b\264j\251\247"
+	.ascii	"V\366g\221>]r\025\222\t=\322\364\255wd+8D`/\232N\313\307_\342"
+	.ascii	"@\027\f\331]\337\2323D8I\372\"O\314\346\377\035\035'a\001q\207"
+	.ascii	"\351\210\007@\271\301(N\025\321\"\f\270\017k\343\365\246/>\306"
+	.ascii	"\275/\354\016b\343b\242\374\245\007S\366\320H\202/\361\330\n"
+	.ascii	"`\362\377\375\210\243A!\037\277\247\372OZ9h\347\316x\244\226"
+	.ascii	"\354\326\330\"P\n\025d\323=\201\027\374\301y\363k\274\\\226\364"
+	.ascii	"\007\254\027\304C\362b{P\342\016\373ZW\256L\376`=\022n\001_\250"
+	.ascii	"\027\305\237\214\367\311\177\005/\250]\351\001;\013\246\177\177"
+	.ascii	"\236\353\020\314\024i\021\374g\357\351?\004~\366\275\211<\303"
+	.ascii	"\347\0259c\333?Y:\370m\337\342T\357w\376O\027`<\320\357\375d"
+	.ascii	"8\246\375\325\364h\316\007\357\"}\321\351\336W3\202v\203\204"
+	.ascii	"\200\272j\320*xK]\005"
+	.text
+	.section	.gnu.lto_.symtab.13c21a1c5e5e739b,"e",@progbits
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"crc16_ccitt_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"crc8_xor_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"crc8_xor_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.13c21a1c5e5e739b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,205 @@
+	.file	"encoding.c"
+	.section	.gnu.lto_.profile.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\350\335\352\372\n"
+	.string	"\001\277\261\216\273\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\003\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002"
+	.string	"/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375 nM\002"
+	.string	"$\003b"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	"\001"
+	.string	"\001\002\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\300\002e\001"
+	.string	""
+	.string	""
+	.string	"\003\003d"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"Y\t"
+	.ascii	"P\355\024\216\231=6\327\365\211\036O\2736\200\005"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\001\003\177\001\003\177\002\001"
+	.string	"\002"
+	.string	")\241l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.2ef0693c2c3ccde4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_castFloatBytesToInt.3.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\007"
+	.string	"\222N45`m\322\001@\203"
+	.string	"\005\025d\235y\350\264ilev\tL)+\211\2336K\376\363S\376~\f\252\245A\0200C\217o+\310Y\361\034\001\337\242%D\356\224\002\017\356\245\201\3108\016\361\31260\213\030\026/\230q\0320xi\022PS\320\030\261\321\340D\214\032\264\272\233z\2062\2152:}\262\242\356(\022.\377\02721\"\217\223\317[i;\317\313\215\326\3243\324\346k\232d?\312\322\0300\375\030+*?U%\035m;\255\325\366=\223:\322\200\337D\204\344\177\246\230\213\253\266\365\207A:\335\250\216\203S(]\204\244\374\03540\201\305\025e\001\213\253\024y\363\333j\227\214`a\002q\036?"
+	.string	"\206\377} .\303M\267=h\233i;\n\b"
+	.string	"2\241k\037\030"
+	.ascii	"\023\236k\370\r\013W\207p\001Pi:\355$\003"
+	.text
+	.section	.gnu.lto_zigzagEncode.4.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\275\b"
+	.string	"\266\320<8@\305(\035\235j~\240s^fZ\310\2359\354`\035\321\337%l3\301=Q\333\253{\317(\037K\345\340g\242(\212\341\fqVI<S#\027\243\031\355\337[\312\224\002,"
+	.string	","
+	.string	"+"
+	.string	"\r*'\221"
+	.string	"\273\033\314\274\300\362\347N`\371\323\216\213\236\"\377\254'\214\244\240R\243\347\305aw\235\250T\306\255\267\255`\233\301v+NM\3772pb\320\332\305\210\275\026\345\225|\330\016\331\030\333\231_]X`w\203E\262\273\013\326\004\374\331\366A\036\022\262\310m\036\251w\235`\244\2149\325\271N\032\b\267\211\305i\352[1\3014wzU"
+	.string	"\246W)c\3666J\345\260\357VU~_\375N\323\252\031\235\212\b\216\305s\266\201\320<\0171\323:P\213\237O\314\240\346\341|`\006\232\200\233\003G\211\016\bR\304\b\202\230m\357VUO3$-Y\365i\f"
+	.ascii	"2\241\307\037\230\313\004#*4\232\361\307\f\3135\034c\002\227"
+	.ascii	"j<:\204\003~\246\351\264\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375 65\001"
+	.string	"\3602"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\003"
+	.string	"\002"
+	.ascii	"\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2ef0693c2c3ccde4,"e",@progbits
+	.string	"(\265/\375`\311\002}\027"
+	.string	"v\256\242G\300\030q\341p]\334\356u+^\0344\207\207\236}Q\265\201'e\243&\306\271\263\f\240\207\233K\261\026\360{;\231\263\2323\036a\340\323\032\202\210\b\350\004\267'\250DTGv\006U\f\216\331N&-M\244Od\n\202"
+	.string	"\211"
+	.string	"\214"
+	.ascii	"\177\221*q\265\332\357\242@\355\266\221\211\316\357\351\252,"
+	.ascii	"9K\265\006\332bRD\305}'\035\267\344A\217\373\321\315\f\325Q\350"
+	.ascii	"<\377\027K\210;Y\\\361\276\005\262@\033d\243\025\342MW\310&Z"
+	.ascii	"z\365?j}\232\214>\336\007\263\004\300o\007\200^\205\336 FI\371"
+	.ascii	"%\330\013M\374\177im\004\332\3560"
+	.string	"\3036\203\241\355\261]d\233\310\266\220m\016\266?\333Ol\223\326u]mo\260}\303\366r\001\237\220\232\247\245\350\230:\224\233Y\322H3u\365cy\3640\245J\256xz;Uez;K\365v\246J\025\035\177\364\\3%\307\222v\353I\225*y^\275\215\252R\315!\024\224s\322b\307\222v\0255\033i\246ve\212\376\350_\235\316\315\005\277\r5\217\310\236]2\333\251\230!!\321M\377\033\250\315j\240\247\355\312\037\364\377\231\205x-\302\230\356\356\263\273\321\206\355<:\377\201\247\177\355\037\367\273\377\343\377\222iK\037\366\006mn\211\234\372?\373e\274@EYw\214\266\334\205me\312\301e\312\220W\304Kd?\220\260GN?\320\177\004\253\363C\367\305\373\326\310\3526h\265C)\3124\005K\f\235\367\031\026zW j]\327uW\240\265\230\226\207\022\037G\274\317\036B\317\006O\232\377W"
+	.string	"Ho\316N\240\275^"
+	.string	"\273+[\300\222v\301o\233t\262\362\363\340\262\204;\212H\030\036\314cn\0015O#O\025\211R5S\271\335\231\342\244\251*\323\007/\020\242+v\301\246\006\205\r\f\305\311\t,\216x\341\260d\242\210\303\nP\"\224\3054\210\035r^\262\023\024d5\242\b\f\262\234\032\327"
+	.string	"\273`8\257\330\313&t\004\231\00623&J\236\241q@\343"
+	.string	"\364\fM\253E#\323\n-\323\"\311><\200 \213\301Jn\265*\300x\340\220!t\305\330\304` DW\354\305\212\21177\242\213\025\203\325\334\260\\89\254\030\004N\222d\213\302TA\225\235.=\300\024:F\232\022oQ"
+	.ascii	"\026@8\274x\237\265\354\020\220\312\017\215\035\357\363\332B"
+	.ascii	"/\221U\2759;' @\002C\212\341\354\377\354\325\342\371\230\205"
+	.ascii	"VI,\304\312\231\246%\337\211\277F0\024\226\254\317k\336P\241"
+	.ascii	";\302\230\245T\020r\n\240\261\274\200F\216\315\215\300m\004V"
+	.ascii	"\004h\212\201\370R\331\314\002\033\220if\211\226\233X\247\234"
+	.ascii	"\302$\334\034\354\361\275W\226\3576\226\026\330B\007Y\334\335"
+	.ascii	"\365b\252\f"
+	.text
+	.section	.gnu.lto_.symtab.2ef0693c2c3ccde4,"e",@progbits
+	.string	"castFloatBytesToInt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313"
+	.string	""
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2ef0693c2c3ccde4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
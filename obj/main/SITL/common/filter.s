@@ -0,0 +1,1511 @@
+	.file	"filter.c"
+	.section	.gnu.lto_.profile.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	"\""
+	.text
+	.section	.gnu.lto_.icf.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\201\005\265\017"
+	.string	"d\023u\006"
+	.string	"#"
+	.string	"\203\255\266\373\b"
+	.string	"\001\263\311\277\326\001\006\002"
+	.string	"\002\001\302\265\230\372\n\032\002"
+	.string	"\002\002\003\243\352\335\360\007\022\004\326\375\336\313\t\n\002\003\002\004\002"
+	.string	"\002"
+	.string	"\002\005\002\004\002\006\005\335\306\312\314\017\016"
+	.string	"\002"
+	.string	"\006\253\211\215\221\b\032\007\220\262\224\236\n\""
+	.string	"\b\333\350\350\322\003\030"
+	.string	"\002"
+	.string	"\t\217\356\205\275\003$"
+	.string	"\n\231\321\207\230\004,"
+	.string	"\013\365\323\303\376\001\f\353\345\356\356\0060"
+	.string	"\r\223\325\374\364\r8"
+	.string	"\016\377\360\237\217\017\357\204\362\317\0038"
+	.string	"\020\311\373\357\337\003@"
+	.string	"\021\367\270\301\267\003\030\002\007\002\b\t\n\002\013\n\002\f\022\323\251\254\352\001\023\240\342\325\376\006\024\356\361\330\337\f"
+	.string	"\025\321\307\201\370\r\004\026\353\220\276\200\006\001\027\211\337\230\303\r\030\217\364\362\333\n\020\031\225\326\304\223\t"
+	.string	"\032\206\223\232\231\013\033\311\276\204\302\004"
+	.string	"\034\245\233\254\343\013\020\035\344\247\274\230\005\036\267\320\322\347\001\n\002\006\002\016\017\002\016\002\020\002\016\037\332\256\355\220\007\034"
+	.string	"\016\020 \353\244\214\202\003\002!\305\226\356\215\004\f\021\"\374\313\343\277\017\b\002\022\002\022\002\007\002\023"
+	.string	"M\250\361\031A\"B\024H\223\024\032\003p\0022f\3249\022"
+	.string	"\202\030\003\2020\001\2031$\3130\201\021 \303\204&\230`hh\342\266\003\263A\251*\221\b5\272\353\327{\373{g\265\027Md\206\256\032\227\374\211\251L8\370\256\2406\225\021)\203\022\036\"\323\217\323N\024\356A\303\250\027]\327}\377X\335Hd\307\356\b\243>\314B\177E\253V\2340n\210V\376\036\302\270c\004[e|\334\270\204y\313\f9\244nfT\272\271\013\312(\023"
+	.ascii	"\372\224)\2641{DIR\0163\250\005?\032t\233\327>\253\241\211\366"
+	.ascii	"\242\024\240\365.\246f,GO*\261\376w\325\317\351\246\244\307\177"
+	.ascii	"\351\230"
+	.text
+	.section	.gnu.lto_.ipa_sra.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\200\001\305\006"
+	.string	"BH\030\034`e\323\030\203\244\3030\f\3030\260&\217\223$\021\027\302\237\0066\021\262\267\224)\005N\353\342#\331S\322\256E \001\337\217\317\261\252\365n4\372\352"
+	.string	"\274^|<\306d\277\026\212\263\304!>\034\031\364\206\247@\0308\202@\3631\213\262\252\030\305\"\233q\031dv\313m\245\236:\273o)i\223; \340\002\032*nN\02310\214\262A-\200\\ c\222\233%#\2139(\027\240\021lD 2\030w\030\024\310"
+	.string	"\021\031p\216\250\212\300\320\270\025"
+	.ascii	"\267P\202\0045b\211H\n\260\001\\\306\2661\204o@\006\005\243\270"
+	.ascii	"e\3307\262\260\314\310\202|eF\226\362\241\314\204\322$\263\344"
+	.ascii	"\027\3170\220\037\237\300l\275LX`\213\3665l\274\n/\030\b\255"
+	.ascii	"\270n"
+	.text
+	.section	.gnu.lto_.inline.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\253\016\335&"
+	.string	"\226r\250G\300\226M\032\003\024^\307*\370\006\276\220\367w\315(\036\243\030\361\b@\213\336;\022D\330\230*\266\330\201l\235osY{\244\r-7yE\251\244\215\300\024\225\331^4x\023=\034B\206\243\347*bA\323\032\221r\247\200"
+	.string	"\250"
+	.string	"\215"
+	.ascii	"<\031\2214\213\024\013\033:\177-\027\237\213\022\317\322\303"
+	.ascii	"\005\030\f\001\320\263L\005\3679n\356\025\301\325\246\263\016"
+	.ascii	"\211\351\331p\367\004wO\0311\255\335=s\317(&\0277\356\t\203\235"
+	.string	"\017\210^\2573<<k\236\245\221\353\240s\267\252(\007\213Nzt\2556\3659\201\246}\347<\313A\360\374\376\316\334\356\312\274,\202\037\177\351;\031\327\2656s\374l\375\207\335]\372|\245\345\356\256>\201o`\004\337\256\325{2\036\217H\251\313r\344\213\201\003h\221\246\235\017\016j\205\323]\201px\003@iP59\311\240AvC8\330F\231p\272,E\352\264\223j\301\340\032\032\335N\352\205\205(<\\\022\005\2734\344\214'^\216\t@tWR\022<SK!<\034\022\260\004N\327\205\250\007\017\267Dh\020\314Nj\006\004\r\211b\227\204\201e\2204\212\207\3331P\252'\336\216\327a\034\374@\360pH\342Q\r\241\3260]'\007)[4\355~\344\314:v;v\313\2178\255\277\232N\341tZf\376(\241\\Q\245\320\311?? c\214G[2\331]\233\205\342\037\024]\347V\345\276"
+	.string	"\003\305\330\215\325\272\r\210\335\242~\263\314\201\203\262\360\0204\n/z=\313\033\246\335\345\361\311\370\223\031#\205\226O&}\255\365H\241v\227\350\037P[,\237\005\317r\226}\207c\310k\246)8\370lI\257d\352D\2435\025\261\273\264s\317\237{\246\232\343\371uw~\243d\255Ss-\253\276k\231\213j\313-9\337O<\334\021\233no\252\307\315#e\b\"8\036\r\002\037\273-`*\342,\351\365\276\270\336\246Uz=."
+	.string	"\216tH\257\307\005\347\002\323\344\302d\351\005\207\222 \337K\246\272\250\0211r_1E\005\225o0\374\004\303\031k0\fi\371dL\224\225k\360\333AZ2\235\260\261\304:A\020\203\312\2701u\265D\363\037\310\250\031u$\355P\342\241\344C\t\210\306\n\255\241\334p\207\b\0222\232"
+	.string	"\312\2448cDD\023\247\237\t\374\253'\306)V2\260\334\274-\255DA\205\t\232y\375W\206L\021\005\025\006\350\241\030\273E\233/i\236\2269=\201\t\250\001A\007\025\311\214\224\244$i\f\361\004\304)\246\034T\366\022"
+	.string	"4%H\304\020\031\022I \"\221\004#3\223Q\2202bl\016@\027v\206\017E\337rz\217\333"
+	.string	"0\244\313\245j?Od\215\300\"3/)\020\254.\301r\342)\266\rV\264\304\260\262F\243\320\340b\242/\034\302\310P"
+	.ascii	"8\321\275\"\211\352\306W\333\307A\rf\224H#X\224\342\364\221\263"
+	.ascii	"\227Y\354\323\347\227y\034\265*&\006\265\343Ju3\\`\026N5\275"
+	.ascii	"7\303U\334\252Y=+\241\331\227\374\2414\341muW8v?Ai\343\"&\243"
+	.ascii	"\3021\351\201\\Rc*\267\201\030\021\360d\374F\2256\213\316\277"
+	.ascii	"h\302\277>\276\017\312\356\215_\364:n\366\377?\377\007@Jt)\342"
+	.ascii	"\260i\247FQW\3131*I\353\023\224)\256\032\260"
+	.string	"\3023&s\245H\321=$\305\233\312\373\372\324'\313\311\n\331\035\261\261\356\372%1\261\331h>\016~\004V\334\221\233\0162\250~@2\bE\227~\324\233\2565\371\224\301z\201\247\235&\2360\302\313\364\210T&\223o\001\205\235\243U\353\320!\207\3200K5\001\276\021,\004\231}\302 \227\262\351\272\263\025\247\234\007'Jn\251\016\326\224N\244\361\322W2m\220\274\302\247\261~\325f\3211$\247\344\230$\257\360588Px\fY:\302\211\370P\260\303\275|p\240G\217\017\271\f\226}B\304\273lJ^\351\205q\204|\004D@\256cI\215\016\236\034\246\020\251.\314\374\021\333^\212\227\264\326\237\264\3664\026\325\261V\213@\213\036h\211\344\210\336\321a\224\264\343g\322\032,\212\341\024l \"\336\204D\315C\257\243\254\253\261\220\231@\276\317\374\230\t\033\344\247\306\\\236i\016\022c\362\206C\030l"
+	.ascii	"\336\230\356\2438>9\344\230\357/SP\345h\213\n\344\325\3056\020"
+	.ascii	"Y\270\301\274\347r7X\266\213B\007D\fO\207\306}S\375\013=\275"
+	.ascii	"q\205\236\330\356s>\314Cu\345\262b\303s\253\357\375\374\360\312"
+	.ascii	"\344\302j\002\317h.\354j\3436!\006<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\240\002e\013"
+	.string	"f\22040`E\224\016"
+	.string	"I\202C=$ Dtn\2130\255h~IA\024EA\003\257\003w\036@\325V\025\375/\372\2056B\244Y\233\222\266\211$)\245#"
+	.string	"+"
+	.string	")"
+	.string	"\022cE\2550\367y\330\363\224\274\210O\377LM[\350 \346\333\314\257O\265.\363\035\314Gk^\bE\004WU\034\006\223j\255\265\366W\376\032\223\332\305P,\231\370\214\326h\"9\200\370\021f\300|V \371P; @M\220\207\243\021\020\376\244@\265\017K"
+	.ascii	"\313\245\332\207\231z\321\247\370\223\257I K\321g\020~?\311#"
+	.ascii	"\211\n\331B,[t\202S\021\240\"\003\264\274\255\274X\231\272m}"
+	.ascii	"7\253\335,w\321%\360\035\255\027~n\360\037\374J\333]\310N\307"
+	.ascii	"+\342K\026\026G\250\261X\347\230MP\240\224\346\220\002\251\241"
+	.ascii	"\242\033\022\240\324TEAj\230@\016\353\377g9\302\001\301l)>\017"
+	.ascii	"fT\360\2358\270A5q\236\310\200\377\344>\007e\265\211\016\202"
+	.ascii	"\302wG\361-Z\005\231c\233\004\270\207\261`\204\017\310\246\357"
+	.ascii	"/E\210h\311s\274']\203N!Ki\331\023\350\257w\265\025o!\234\314"
+	.ascii	"\341qe9\210K\214\n\345!B\200\324\337\204\024&\002\b\305\373-"
+	.ascii	"=\f\237\243<U\tX\302\241@\032\200\024A\bU?U\235\"\306\252\234"
+	.ascii	"w"
+	.text
+	.section	.gnu.lto_.pureconst.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375 h\215\002"
+	.string	"\202F\023\034p\213\032\003\003\300\005\324\003"
+	.string	""
+	.string	""
+	.string	"\200\265\377\377\377\377\223adkF\266Yh\233\fF\034\316\274\341\f_\270\302\023B\020~\260\031\274\340\004\037\270\300\026p\200_ny\345\224O.y\344\220?\356x\343\214\353\213+\236\330\216\335\335#"
+	.text
+	.section	.gnu.lto_.ipa_modref.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`I\0075\021"
+	.string	"\246\322<5`I\223t\024\302\260\326\201\301\343\372`>\020\353\300\334\270H\024\r\266\240\"\311Ve\366\377\373\030\177\215\216\241\305\330\310\307\377\247\\\214\b5DPk\204\310\235\002("
+	.string	"."
+	.string	"1"
+	.string	"\211\021\205\f\252n\264\226\206P\353\343\361\230\223:a\302\224\022\272\224*\275\356\\t\237\347\212\346P\223\322\274\235q\363\354A\235\251\260-\2347\346\300\006\267\034\320\004\254"
+	.string	"\257"
+	.string	"\324\003\364\240\347\320\345<\325\325"
+	.ascii	"-\362.\3622\206\367\232O\2507\252\230?\025\331\3321\355\351\372"
+	.ascii	"\201\240\251\003\2571\006\026\\\210P\262\250\347\231\002\357"
+	.ascii	"\326\245\213\237\236&\007\315\025\201\235sNq\205&\026<6*\262"
+	.ascii	"&:\232;\312\230\023\005O D\2100\321\244\222\346\222V\301Ll\r"
+	.ascii	"<~\244y\0042\346@\312J\260(\\\240\204\2123\301"
+	.string	"\375<\036\347\312\200d\224\321\214%\2044^\027\200\222\250\240\322\314L\222L\007\240\002\221\251\032\356\022 \0039\006\264\2242\210\030eJD&\230`\224\024\225S\340\006<<kD\344\234\251\017Q\007~LS\016\034SY\005\177\004\243v\261\3214\246ab\3752;\204\246\227Q\002\323\357#\203\025aE\323p\tjR\fz\305\370fA\245\277\2259n\003D\212g\234\342\023\254RV\304\252mG\340\235\013\300\230\363\371\037\276\210+l\346\242\325\305\351\331\rF}\207j\036j\024\205`\243\2058@\"\300\307k\351]V\300\342@&\361\265\357\206A\262Y\233\255O\324}\3269\263\341\375\f\230\004\334fE*\177\225\305\334\316:PM\342\346Q7\326D\324:\201\250\3379\033O|\200M|\323s7\022\231\324\223\254)\353\245\303\310!T\257d [\351\225\3255\272\036\201\300\320\217\226&\211\232yg,@"
+	.ascii	"\362\317)x<9\241\037\213\364@D\350\225\252\207\177\342\023\345"
+	.ascii	"\343\"K\263\200\376\r\376\033\300\235\337\233\005\370\335\346"
+	.ascii	")K\323\273r\261\375\335\233\256B\202\356\231\334f\t>\352e={\224"
+	.ascii	"\300?"
+	.text
+	.section	.gnu.lto_.lto.1adda0f48fa10b84,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.5.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\265\007"
+	.string	"2O56Pm\222\016$\243\210\"YZ\257\315\203/%\247\264\024\231b\262\026T\230\231\335\220\311ja}\326\227\03573S$=Bb\025X\343\026\306\251mck\215\020\231\002 \211\217\207c]k2\332\006\004\301y\200\236\254\323\3114\320\303q\350@\215\026\0013\006g\237\215\006AY\246A\354?f\253|\244\337\205\342U|\f\271\227\361\255\362\221\276\245\266\017\323 He^\244V\022\3052\361\370\267\307~\347Z\372t@\346I\n*31/\324}C*\2625NT \223D\202\312\214\230\023,\265\216\226\377~\024d\373S\0259:\024J,L*\231\t/-\270jU\035\270j\275\215nu\333\355H\017L'\321(T\007\320\220\231;\321\b\243\277\376\b?\303_\n\013"
+	.string	"\322\032h41\264\n\3075|\232\305"
+	.ascii	"Y\220\225\220@\240,\203&\214\224\224\3165\311"
+	.text
+	.section	.gnu.lto_pt1FilterGain.6.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"=\n"
+	.string	"F\223E< \345*\035H9\002H\005\355\030V\002A\201\230\177\002\274\266&u#"
+	.string	"Q\220\357\331\\Q\343 Fq\245-\366\b*@\233(\\\306(\t\310Z\346\023\205\213\250\346\210\332&r\247\0244"
+	.string	"3"
+	.string	"1"
+	.string	"\255\247\200\2668\341\261\001\201\371P\021\260\273\034\347\006\231\317\355\005\231O59x\t\372\207\275\023 \226R\225.5\021\273k\231R\211\334z\333\t\266\037\354{\002\254\203\225\335\220\261\266\264\351r\362\327o\203>\314\033\333/\213\333\262\034\205\025\003`w\027>\355\020\312\032.\357\262\350\201]Y\253ew\031\254 \360i\333\017\252z\235/1\324\210T\213'\251\321hk\210q\254u\354\232:\252\312\022Q\263\223\034\355\260$\265\304\376\266\272\262/=\037\376\333_\256_^\372\032\202\022\024\262\002C\2228:\013\320t\347\371>\244\214\020\210\033y\"\221\327q\243\320\205\210\353\276\r\316\203`O\343\363q$\317\373\270M\270\337\256\253\251\034\223\236|\335t\352\007\240f[\022"
+	.ascii	"2\203l\215\321cb\311\f\177T \232\272\3035\361\327\242F\265\310"
+	.ascii	"6\0132\021dA\270\013\030\001\371\300\260\240B\013\200\312\330"
+	.ascii	"i\347\023"
+	.text
+	.section	.gnu.lto_pt1FilterInit.7.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\245\t"
+	.string	"V\022C;0\345\2521\200C\336\346\307\257?\004\346\201\216\210\323\326k\372\324HX\210\026\b#\025\220vyC}\023X\037\306\210\030\030\0300l\311\274W\022f\330QS@{[\357\275\245L)0"
+	.string	"1"
+	.string	"2"
+	.string	"\\G't\346<#t\346*\266\002\030>\b\002\200\274h\377\277ib\321R\254\335\342LJu\262\034\250\370_\231R\211\270\323m7m'Z/\004\n\004\376\220Z\201\317\270\027\224\266\326\264\225\243YD\273\032k\346\207\211\221\375\347T\3023\367\260Y\266fyEt\313\344\203\177\005\223\375#\247\020\236\003\016,\025\222X[\271i7\354\322\230\367\237\242~up\024"
+	.string	"81u\346\"Rh4\224\254\265\343I\316\222\326\333\377w\256Z\273\354\315-[v\006#\001\027\016?%Q\b\324\325\323\t?%Q\b\364\221\300\321\b\364|\244\220\305\350\363\204\031_\247\241 \306'\374J \030~\232\361\336>W\345\006\314P\323\243\333l5\f\013\016"
+	.ascii	"2\241'\034\030.\250L}Nj\217\245\255\240\207U\353\302z\f\363\002"
+	.ascii	"\201\301\025ijJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_pt1FilterUpdateCutoff.8.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\375\b"
+	.string	"fQ?9@\345\2501\240\256\327_\317\341\036\341\341\303qo6~\300\341\005P\0312,N \366\242\200 \343X#Ns\363*\212\216\203\300*{f{\227\341Q\261\264\377J\"eJ\001-"
+	.string	"-"
+	.string	"/"
+	.string	"\b\232\345\346\003\315\262^+S\340\030\b\320\341\212\371?\243\210=C\2576\2125)\325\311P`\342\177aJ\365\341F\267uh\033\321V\0261\251B\322\326\233\266\360\363\211\347V_\325\374+0\260\377\234Bl\226\r\031\303\326%6\361\3142\331\340_\261\300\376\217\323\207\315\262\237\003\030N\351k\373/Q\27342\b^FL\232%\003\013"
+	.string	"\b\n\316\332\357\004cH\353\314\3777\256Z\267\354h\226\reAK\202\313\3571\023\360\025\356>%Q\b\244\325\323\351>%Q\b4I\334h\304y&)D1\232\236\356bv\026\312Y|\272Y\342\270nn\276;\363\270\252\034\020C\305\215\306\330\006\f"
+	.ascii	"2C+\025\003\b_Z\\z\b\265\256\241\3070/\020\030\\\221\246\246"
+	.ascii	"\204;\274h'\031"
+	.text
+	.section	.gnu.lto_pt1FilterApply.9.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"}\013"
+	.string	"\266\326N= O\234\016$\232\002\027\\\364\346`\306\313V\b\032\372\204"
+	.string	"\037 \003,hm\373"
+	.string	"\324E\374\246\037\257\001\361\254\224\255\rT\003"
+	.string	"C"
+	.string	"\260k=\023*0\356W*\342\240F\366\2262\245<"
+	.string	";"
+	.string	";"
+	.string	"\325\243\271\312\266\017\342!2\333\203\234\206\321\244M\220\320\305\330]\313\300!\323#\374\200\351Q3<{f\376G\034\246\b\255\370\200:OJ\301\356:?\240\n\267\336\366\001\333\023\373\021\002T\246c\246a\2465\323\231\351\003\230B,\bx\273\024>\031\333\021Ql\260\235\331\017\333\231/\331\263\306\256\212\027\033\273\033q\202\247}\322Ed\3478\027\260+:\261\261\313E\214 q\306\346A\313\317\327JU\251n\343\240m^\"5\342\302\017N\302\336\304\3572\020\252\335\375\350\321\347L\217W\252C\367\201\344\311\317\346:\251\030\354\303\335]\253\310~\351\257\316\375\001\232M\006c\211\223)\022\254\242i`a`a\256\313\345\242X\030\313\202\213E\301\034X\222\002\2762\025\314\322\\\027f=\270\275\035\025\262Y\350\360\250\346\250&\002\264\340\370\300\360\344g\250\327\250\220c\273\240\232\n5\023"
+	.ascii	"i\231\"34\030AhB!\270qp\334\t\264\212\031\003\\\256(\232\233"
+	.ascii	"\302\242\026\373\201k\214\310\202\254\204\004\002e\0314\361\244"
+	.ascii	"\244\230\256I\006"
+	.text
+	.section	.gnu.lto_slewFilterInit.10.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"U\013"
+	.string	"\346TMC \2138\035H\261\3302\bq*\242Z\220\341\276l\305\204\333vX\"I\257l\020\264[p\030\032\350\365\245\265\231\306\b\202\221\020\312\026@\202\303&\247n\251\361\236\303\322\300dj\3135>)\322&{\247\0246"
+	.string	"<"
+	.string	":"
+	.string	"KZ\234\221\275\232|\005\366\232\235\002{\365hs8\211`?\201"
+	.string	"\200\023kw7z\340\343\347\350\377t-$\362|Bt\354\256gH4\340\246\267]\261\355a\237\013\244\177f\230\203\f\026\345\256\200\326\207]\325\013\nl\237b\233\\^\022\033"
+	.string	"\024\342\230\344%\214/\271\264\266\213a\203jw-\326\310^1\256O\373\020\036a<\251\363\211\335\021J\265\001)\013\r.j\227\034U;\244<\024(m\317\212\315y\005\227\331\356n\370\024NL\"4$\350`\257uA\212\001\3533[6\351\231\324\200\375kw\327td\337\364c/\375\327\003\"\232/\023r`F\324\304\316\353@8\234&\3240c. 'j\272\221m\363y\336\207\3316]\210\267a\300p\273\\\370#\341\300M\374>p\243\220\373k\351\310\037\017V\037\n2F\355\360\001\024"
+	.ascii	"i\231\"\023/\307\321\342\202\njCJ\330M\275nj\217\271\255\360"
+	.ascii	"1k\215\013\303\200\031\003\230\013:\247\204`\201\300\340\212"
+	.ascii	"45\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_slewFilterApply.11.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\274\002U\021"
+	.string	"\026\036jF\360\260(\035x\337?\350\316u\263\030jn\261NF1V\004\271\376\b+C}\314e\037\234\022\325\365\031C\032\337\206\343\353K0\312\255\023Wl\"\233\310\336\213\217U\322\370%\353\240V\271\351\346\260d\357\275\245\224)X"
+	.string	"N"
+	.string	"X"
+	.string	"\360\003\301\"Q\033R^pt7\367Q\017\251\021\352"
+	.string	"\251\221?\250I;\332\224\021\362\232\256\023\004g\030f\250\250N\332\231 m\246\254\264\220\332h\240\303jEa\214\n+\233\ne\031\200J\002\374t\267\302t'\250P\273\023\324\335_\025\325J\337\241\377=\374\017\371w&\372\251v\354~\356^\356>\356\036\356\236w\277\273\327"
+	.string	"\022\007\006\201\024\335\024rr\364\213\030#\342\277\351\337\376\357\252\313c\357t\267\250!\353\356\217'\320\375\365\245'L\372\231\250\200n\026\214\254\373\3738\002M\343?\355\377\265\204\2320\375\261\221[,<hL\02227\031\024n\f\331\203\3210+C\2062R#P$\272\202yk\221qmw\237\230[_V^"
+	.string	"\253AY\234\377%\252b\371@\210?P\024\217i\335\035r}i"
+	.string	"Ac1\221\032\225\331fv\363:\331\234\377;-\267~\205\315,\217\272\250n\001\245\222\021\222(\312\207@<\221\222\003\021\003\216\324\215F]\210#\211\024\214\270\220G\302\201\024x7\"\342q\245\256\363\270\355k\205\312,\017\177N\0305\363p\344\340\302\325\211\361D\033\032\227&\233\371\327\335s\262\007\253\221\254<5\300H\336Zf\\/\031Y9\302rd]]\260\221\272\021: \300\002\0311\363\351\232\"\"?\006\235\242\216s\335\034\321\325\\\0361\303\305\t\032'O\314\254\002,\252f\252e\020\3425m\316}\326!\006T\340&{ \353\312\340\3701\253\304r\007\2414\321\346\313\264c"
+	.ascii	"-\353P\236Z\253\224\222\r\270\373\332%!\033\274\023I\022M\227"
+	.ascii	"\271\375\021++'\020d\331&0Y@\236\343\355\210\302p\032,\0339\023"
+	.ascii	"\021\231\201\375(.3\272\247\267v\225\001"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.12.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\345\t"
+	.string	"\006SD=0\307(\0350\237\206ZZ\365\305\255W\375\272\2573S\250\003\330\247\033\031O\032A%m\375\216\317\020\234\004MY\237n\002k`\240;\204\036\025\275\216e\006\027B\320\376A\310\336R\246\0242"
+	.string	"1"
+	.string	"/"
+	.string	"6\n~!\"W\260\242\241\302`w\261\314\023\254Gx\004\353QA\356==\377)\217\035\036\004H\245\320\363\232\330]'\251\304q\353m;\330\226\260\257\020\361i\370\264>\235O\337\322"
+	.string	"\340\013\016\354n\254\032l\202(`\304\266gc\354\017A\304\363'\243l\331-\200\022`w!\374p\360h\3337\371\211\027P\257\227\302\324\310\200j*\324K5\"\261Tu!\0255j\2525\300\322\250\327T\215JD\271\262\277P\352\207}\270j\262\237\276\376\375\326O\177 \215\333p8[\207\221]@\032\267\341\264\356\243e\027g\032N\353*:\034\354\263y<[\206}:\024\036,\343.0\r\2037\013\215\303\272m\3430\314\267\207\253\246K3\031*r\020"
+	.string	"2\2417(p\362\213\005\002\3729\n\030|\314\261\\\303\213h\001-&\0240\0072\003#\202\n8"
+	.ascii	"\225\307\324N2"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.13.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"=\n"
+	.string	"\246\323F<@\305\2521\340i.\273\272\370\\W\254\355\271\267\326v{\326i8B\344t2@\310\033j\377\250\020#LsM\242\273\313\017\247\013\0260\352O\373y\346\324\200\330\226\277\335{K\231R2"
+	.string	"6"
+	.string	"3"
+	.string	"\030s\035\235\320\231\303\030\2413W\261=\340\021\345\016 \340\003F\373\357\315\023\213\226bm\2303)\325\311\362\"\361\2772\245\nq\247\333n\332zZ+\004\007\251%\370\214\033\220\322\326\232\266\363\265\261\031\334\243\204$B\216\006 \332\325X3?\001\232\354?\247\020\030s\r\233ek\226[D\2678|\360\257\n\310\376\221\323\207\245\2561\263\240X\263w\373Q\233m\316)g\233\241!\235\252\003\202\221\213\314S;\236\3444i\275\375\177\347\252\365\313\336\354\262\247[\266\354.*\006\030j\017\237\351CQQ\372\302\320\027j0\276p\242\240+\250\023~&\013Q\310#\201\243\021\b\362H\242\317\310\003\205%\257\263P\360\342\013=\023\b\206\236f\274\267\317U=+3\324\354\350E\326\001\020"
+	.string	"*C\244e\212L\274\016\032\r.\304T\335<\256\261\001f<\240J\204\021%\304\r\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_biquadFilterInit.14.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\305\be'"
+	.string	"\352D\334\016F\200\334M:\0177N\tP\374k\020\260qt\364\026\342\234\263;\202\374\331I\256^\311\377\347U\202D\377L\254\205\246\021\324+\233#(\300\201\223\250\354\234\255\365\341\336\260\231#_\034j\350\037\335\330\232%D\356\224\002\335"
+	.string	"\303"
+	.string	"\336"
+	.string	"\376\267\274\313\217\367\362/\017s1\037s\263\223\361\317Y\031\25123\305\037\231\f\245 \233\"\324\230\fa\2216rT\200\t\202BLI\017\031\245D\330\226\021\\|T2C\206\260\301|\314Q\361("
+	.ascii	"$mMN\255\025\302M\203\260K-3\326:|\371X\n\325\241\325\024"
+	.string	"\016{\245F)T\203E\200`\240\306S\231z\025\037\355S+\031\034d\2555\202)\344n*\225\247\366\245|\312\324\273l\\@\255YGd\255\306\b~\220\273i\343\207n7s'p\273\351)\233\355F\255z+f7\260\264\325Zw\213\344S\277\231\345\322)\237*Q\023bQ\375\306d:\300S\236\314K\256!I!\226\217\357U\320\352&Tk\325a\235%\305i\250\265\232\n\261z\334\270\333\206a\233\206\235C\006eV4Y\016\355.\r\342\021\212hq\310\034\035\2606\f)z\341\320\022\335\360B\013.\225}\274\230\233\034h\325\031\222\3112\301Z\253\226\350\016X\332E\300~\351\376\344\262\242I\013\355\367\006DH\235SN\025M\332F\252\227u\215\330/\353f\331\357\372\0330X\260\244 \201R\022\002\244#\243k\371\017|\354.\372\327o\340d7\321\313\356\241\237\335\003^\345\027\360+\277\320\301\356"
+	.ascii	"\347r\003x\330\035t\344\rt\261\373\347`n\035\245\366\241\324"
+	.ascii	"9J\215\243\3247JmR\352\222R/\245\246\224\372\023tmg\220\324j"
+	.ascii	"\335\221\314S\321L\261&\007\373\271\374a?\362\027\373\301\374"
+	.ascii	"c?\331_\366\237]\347[\311\334\332O\264\002\330\334:m\325\301"
+	.ascii	"\255\355\373\036\240\305\255\323V\234\333"
+	.string	"\332*\236\347go\353\264\245v\226\231k\263\370\035\037s\265V\013\276\235)\256\026Al\226\330\270\335\244X\204A\253[s\235\266\314\234eh\376\362\206`\231\350\234E\244eZ;\271\216\226)\355$\026\255\321^Hb\346\234S\345\346\024\314\211\231`\035\3209\213J\353 \355$&\355\005-1'\227\332)\030VY\264\f6\211\316Y\314\"\332\005\233\264V\264K\233\224v\022\025\354\325\234\\DK\203\345z\030r<\213Os\334\031\032\025\325\263k\304_\363\337\320\037l\3746\277\302Q\254D\324\370k\314\226\253\225\352D\177\306\355\246\251\260Z\261\025\237\346\023sZ\225G5V\246\233\007\226f1C\273\242{l`w\213\002=\025>\250(\363\205\024\225z\242\275\025?\027=s\302\tJ\341\004\255p\202N\350Q\n=Z\241G}\277\032\037x\367\305\350yX!\345\003\246\360\001\177`\370\200\033t7?I"
+	.string	"\372b\270`\221b\367\"\n\n*\352i\367\202E\017j\367\004\224\332I0r\324\317\007\334\305\210\212\002\356~\214\365e\335,7\2551\021,oM\231`\177^l\313`wI\200\0356\215\231H\313\033+\263\013\226\002\330a\323\227y\264\274\257Ri\177^a\273\2644h\207MOL\243\345=\351z\003\264\303\246#&\357H\231\264?/&[\356\227\374\354\260\311\207Y\264<\037\345\317\213\270\n\326\305\224.\252\333a\007;hUke*\274-\202\352\030As\264\321\253\333$\350\r\037m\323%\333\004\r\036i\341\304\310@i\363Y\273G\253\002\254\317:\005\200\235\250aLf\020R\314\314\210(H\222$\255\001\320\002\021)\2536\022"
+	.string	"\0251S\032f\210\244\230\271\244 \246b\315X\024\255\313\322Q\365~\371Gr\212\330\334\351\027\223l2#\026a\275j\307\227Q\345s\036\210\372\274y tbg\222\326\302\241\246~\336h|u\336\215hFu\204\303\3471u\032s\375\016\335Cf\277\201\246\235\300h\254\264\305"
+	.ascii	"\274\033Q\274,\210\320*;V9+g\340\255|\305\r\346\342\371\026/"
+	.ascii	"\031=\347X<p\017\346\032b\"\205nF\260Q/\bV^\311g\354\320\365"
+	.ascii	"\346\356m@\305\303\022\003\223\264\005\002b\256\345\b=\f,\351"
+	.ascii	"\330_C\273\375\276\327\"\305\236\351M\311r\346\037\352\207\363"
+	.ascii	"\374;\021%\224\224\244r\037\220\376\243$l\267@\324\211\312\266"
+	.ascii	"\035j\272X\036\n\267\316\367V \334;f\013FF\364_,U#\366q\207\035"
+	.ascii	"\211\0014\275\203\003`\271\245\252\017\244\276\003\007\004\036"
+	.ascii	"0B\221\336\260\240\316F<~Kx~l0\240\037\025\201\233\336,\rR\005"
+	.ascii	"4\237E\251G\277\202\004\301&K@\255\263\254?"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.15.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\264\002\355\021"
+	.string	"F\337pI\340\262(\035`I\2157d|\361\302\204\262\347(\370_\020\001\212hJ\370\034\007^{Lp\314W\340!,F=\313\235\352\227h\\\345]\354\212m\\\005\034\340\020\207P\250\215\307\252\031\"-\t\372UmO\032!D\356\224\002U"
+	.string	"a"
+	.string	"U"
+	.ascii	"9.]\332\0052\262\355n\211S\337\273\021\356\323~\214\313\200}"
+	.ascii	"\346r\001\2736A\266]\262\304\013\276w&O\300{\367}\200\367\316"
+	.ascii	"0\273\350\344\315\236h6\202\206\321\356\202\252\342\260O\230"
+	.ascii	"\377\237\227dhb\237$\007\273\353)Cc\342\326\333F`[\203\255\t"
+	.ascii	"\002\367\271\271\333f\377D\235^\f\221\034\355\2228*\262B\335"
+	.ascii	"\r\026\247\375\265\337\347\267\235\263\377\236\333x\371\037\237"
+	.ascii	"l52\370\3200\324\\\216\304\240v&DO\213\0136\315\345\027+Q@\004"
+	.ascii	"Q\215\310\356\222\274\263\005\233\343\371P\024a\307%\207\332"
+	.ascii	"\031\030\036\b\252\363\342P\033\203\342D\203I~\006\354\001j\257"
+	.ascii	"8\314\313X\201\213\035[\2431\333\254\007y\2528@d\342\201\272"
+	.ascii	"\033\313up\2528D2\267\236\303\345\267\273\f|\034 <\030\270Y\341"
+	.ascii	"\342\275SU\234\037\267\331\313<\262\311\330\324\024\366\271\335"
+	.ascii	"]\253\215}\236\337\364\235\277t\235\377{\316O:\355\366^\273\273"
+	.ascii	"\251\226y\3222S\257y\362\232\341\312\253\302\204\207.\024\n\033"
+	.ascii	"Z\341\230\022\216'\226p|`\362\2542\031CW\207U\n\250\"\262X\242"
+	.ascii	"\nTY\241\260@\325\330\002M\016X\\\tG\320%\212#x\"\367\334\252"
+	.ascii	"\215%\300\020zQ\030{\352\243H\326\351\320\215\323\036Cd\252<"
+	.ascii	"\002\004y\021r\253\0010MZ\322OI:\0038 \360\002\031\261\321\003"
+	.ascii	"\370r\020\f\221\346)\363xG2\034\214\204\214\035\210*F*\030\033"
+	.ascii	"\260\001\201(\030;`\325\206TZl \206\3433\210\3041x\177!\033\177"
+	.ascii	"-S\346\320\037r:\266\234!DJ\b\345\234\315R\0069r\033\303\020"
+	.ascii	"I\034\311>\361^J'\235\361j\303x\333]\256\266\232\304n\362\274"
+	.ascii	"xY\006,\021F\024q\023\203W\244\261) ./\332C\006"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateLPF.16.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\007\003\355\022"
+	.string	"\206avH\340\3604\035\360l\360\264?\017Zs,/\036\261\211Gd?\237&\304\205`G\266\261=\004\303\361\017\201k\360\004\3218*\031\376&Y"
+	.string	"s\250\021\375#\344\f\346Q\246C\345\361\301U<`\203]\236\212mi\223\275S\n\\"
+	.string	"d"
+	.string	"\\"
+	.ascii	"!v\030\314\361*\302\377\230\364\307\356\213\035\345\356\216\230"
+	.ascii	"d{\025\311>\355\367<Ex\037\231\013\330\325Y*w\307\021'\330^="
+	.ascii	"\236\200\366\272}\200\366\352\320\216\372"
+	.string	"\270\263w\232\301!H\307\356vt\304\303\317\320\177\320?npf>S\rv\327\363\006\007\304Mo[e{\202Mm\002\0018%\032+\241]\017=x,S\205\225x\322\017\373\221\376\362\231}\237|\351#\035\366\244+\231;2\"*z\271\\\341\207\302\227\257\260I\016\356\305\037\272\353E?2gD$\341\345\212@dR\244&d;\330\274L@\260_.dr\233\371P`\203S\021\216\335U\360\352\007\333\3539\333\024(&\013\331\232\324/U,\314\337\030\301\t\031\233CgX_\332(\345yj}\217\221\212\261\034\206F)\217S\353\245[\356\302\244\201\235\335]\340\267\320\220\301'\361\352\313h\257\225^\351*\236\246\230\2178{\330#\315\244\"\354gKu\354\227\367v\244;u\330\255=\351\256\007\372\263\377\374\364>\377\f$0\263\004f\222\304\314\222\230\351\271\234\230Th\361\300\024\017\344X<\320\001"
+	.string	"\315(+\320s\271\240\222\322\255|,\326\207\322\255\250\234\260:\024\260\245[\035\360\207\301\003;\227\357\003;n\024\037\364\355\305\202I\2444\336(TT+E\237b\032m\272\321\252\264\206I\020\250*\332\210\345\200L\237\202f\362(\304\036\246u\266+\2522J\351\f> \360\002\021\261\235\003\312C\244y\212\b\355\216\354\311"
+	.ascii	"\b\212\354}](6\025\354\271\230^\230\033\366\nl\264\231\245\365"
+	.ascii	"|=\r\362r\314\024J\342\004\243/\210\301\257e\021\316\330\341"
+	.ascii	"\037k\332\031\343\365\241\005\313d\201\\\303f\0219\320\230\227"
+	.ascii	"p\214 \344\320\226\201v\302\025\ta\033\244s\tCHy\036\343\025"
+	.ascii	"I'\345L\321j5\020\003\336\036\240\343\214(\306M\214\256H\363"
+	.ascii	"S@\\^\264\220\f"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.17.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\374\002\r\023"
+	.string	"\246\243zF\340\322h8\212t\b\202\005\n\244\n\220\367\302 A2|6\352\035\006\023=s\230y\314\217.\310I\256{\332\232\345\312\001\236\254\225\343\204\031\3470\306\235\261\327\301\006\212\203J)\n\237\304\303/\261M\366\336R\246\024a"
+	.string	"Y"
+	.string	"m"
+	.string	"\273\t\356y\001\230\371\035\343L\332\375\341\301\263\273&V\360\264_\373\211\330G\230\247vgf\360\354\216&F"
+	.string	"\336\363\b\332\366K\334D\314\306u\343\b\233\317\202\320\205[\321\356\206\005\256\372\356u\037\371\356\251\210\307\2361\377\267w990h21\317Q\203\335u\322d8\334z\333\006l3\260\025C\231\263\307\230T\032\373\335\352\214}\333\255\372\316O\362\361\037\311t*\323\"\231\016\3114*\323\247L\203d\332\224\351R\246I\231\0063=\312\364\227i/\323]\2465\323\231\351\227\240<\3248!\332\325\220\353\261A^\317\315m\277\035\363o6\331\266U"
+	.string	"c6"
+	.string	"\240\321\024\351\3303\022 j\322\223\022\330\301\272\017\210\236h\302{L\372\034$\375\264\244\001|\200:R\222\226\330\230\341\310Z\347\001\365@55\321\365\026#=\316\323\324O=\241Y\bY\346\334\251\252\247#\0273\034Y\313Wt\372[MMt\271\nU\024\034$zM\355\204f82\277<\205q\340\356\242\370(\036P"
+	.ascii	"m`\276{W\222\330C\247&\0060\225\027\227\325\353\203\275\260\254"
+	.ascii	"\260\274\317)'\257\025L\205\025!\\q\265Z\256\224p\205\005\241"
+	.ascii	"\025\246\274\\\302\023\001v\261\254^!\314\345z\205\246q\337\255"
+	.ascii	"\316\250\024\225\241C\220\2502\2534Hf\323\371 \002\345hC$j\267"
+	.ascii	"\\\206'\376\320\001!\3068\335ppC\2036\224R\224\2524E4DSz\340"
+	.ascii	"\266\372\217\210\246\217\204\277\b\321\274\235\264\244(\035\300"
+	.ascii	"\"4 \340\"\021+z\351\232\"\"\236\224\024\r^\202N4\020\rU\305"
+	.ascii	"\177\301\200u\0335\316\032\204/.5\030h\275\273\342\270@\352\254"
+	.ascii	"\2319b@\311w\240$\",O\f\224|\007\224\004\363\362x]\303\244\346"
+	.ascii	"\302\020HI$\034o\235A7\2051K\311\206\370\r\261B\022\027\030\205"
+	.ascii	"\340MlU\032\221\370p\226Rhr[%\t\004,\263\211\247*\305t\t2"
+	.text
+	.section	.gnu.lto_biquadFilterApply.18.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`b\002\315\020"
+	.string	"\266_lD\020\257h8\300\\[&5\211\336\366\206\322s,>1\272\3475\254h\327\244KJD.4\211\320d?\365\367O\351\216X\002H\332*\002"
+	.string	""
+	.string	"(\231\\\032\236\3771\005\244*\2146\262\265v\357\275\267\224)\005V"
+	.string	"Q"
+	.string	"Z"
+	.string	"\27303.\273\273a\003O\373(\357\300\372\370q\214\335W\t\227\335q\303\004\274o\036=\333\376\206s`\331-\332x\301\204\013\021\t\221\315\354\356'\340"
+	.ascii	"\270o\332C\3347-9\353\311\362/\273v\022;\341\032i=;\005\273\353"
+	.ascii	"t\215P\270\365\266\007\330N`g\213)\177\306\307\037#\323\240L"
+	.ascii	"\1772\355\311t'\323\234Lo2\255\311\264\227\351.\323\\\246\267"
+	.ascii	"Lk\231\326Lg\246\257\3619A\201`\266+a\366bc\266\027\fW\371m\226"
+	.ascii	"/3\307\266J\004\2575A\303URa\305\356\026\370\346\003^\346S\334"
+	.ascii	"bM\233z\252\311\210\031\302\2349\244\234v\312\215\020a\340Cp"
+	.ascii	"*\322tS\225\021a\017\276\242i\027\256\270PM\ri\262\210$\251\203"
+	.ascii	"P\345P\221\241\327TMF\204\205^\375\203[\274\335\345\360=,\200"
+	.ascii	"\340\231|p\337\256\232p%\206\002\2223{l\245Z\260\257\255\276"
+	.ascii	"\354\253\334\241\007\252\216U\212\204\342T+\217Si\343<\022\241"
+	.ascii	"H\252\216R\203\357\004\232L\340\350;\225\030\230\276\021*\365"
+	.ascii	"\211\002\030\364 \241>\025\b\242>\316\270\327V_!\375\210h\210"
+	.ascii	"\001\321\320 \205\371hGA\036\375\224N\302\303\321\216\203\213"
+	.ascii	"\340h\027\262\3046\372\342I\2212\027\013\215z\272\321\316\204"
+	.ascii	"Hb\272\213F/\3534, \260\"\231\263z\251M\021\212\007L\242YI\320"
+	.ascii	"c\003\271\264`\320\233\321\030\3505\034d\0024\214\254\264`\024"
+	.ascii	"\2446`\004\343M\316\214E\037\206<%\004\341\341\340\240\256\354"
+	.ascii	"E1W\243P\321\033\306\234\222\035\361\333cu\024\027\326\206`O"
+	.ascii	",E\024\221\350p\026)4\275\255B\002\201\226o\342\311\245\230\256"
+	.ascii	"N\006"
+	.text
+	.section	.gnu.lto_laggedMovingAverageInit.19.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`[\001\305\r"
+	.string	"V\331[E\360\2606\035\332M!-\256\231\240\331\026&%\233m_\216\035\270W\327Cl,b\267D\3367\266N\255MA\354\202BI\321\301\030c4\204\305\326\342p&s\255\0131\246(\007FO\236_7ivw\3332\245C"
+	.string	"E"
+	.string	"M"
+	.ascii	"\366[n\302\273\013\311\003\354\242nV\354\202\t|\340\2724\370"
+	.ascii	"\001\363\362\272\200yi\317\216q0\304~f\005E"
+	.string	"&\334],\202\270w\365\374\313\034\300)\305t\3558\330]\353)e\303\035o[d\273\303\376M+\0334i\374`\337\332\335uD\331\217\371\257\277\374\363.\277%\325*\325\007\211\250\302\031\fV\273\032V6V%Y\214\260\375\217m+\3064\004Bk\002\303\322 \202?\341\375\245\244\2415\3712(\270.Cz\r\006N\242\311\326\355b>j\374\t\211\357\321S\342\005\312\215\224m\025\331\023\236r\212\206M\030^\321\336\256\3024\222\203\r\213\312\2146\367\024\235\257&G\345\245i[8\212\322\265\273\013\374\231\013  \030\"H\346eG\007\017+-8%\032\037\"\020\342\b\203\366`\204\213@\322F<\323\031G7\n\241\240}`$n\333\270\f#i\036\033\226u \030G\001s\025F\035\026\302q\035\366\001\367\326F\224\255\032\252\034\031%\361\263\237M\333\3435\031L\213\020\007\244\032\021\\\202\246?9\034"
+	.ascii	"i\231\"\023\017\377\242\301\005\027(\177\301\205,\326\370B6;"
+	.ascii	"\\\037\020A\212=GSS!0IQ\035\2520\337\342F\231\260\3305 \300\206"
+	.ascii	"VB9\230KB\260 |\246F\301eij4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_laggedMovingAverageUpdate.20.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\206\003\005\027"
+	.string	"V)\216J\320\356*\035\213\272\034\034\370\340\244\252\217\3478\215\374OZ\230\026i\224:\221\031\f\031\340\222\243@\243[\337F\342\353\007j\020u\373\256A\2157\030\032\245>\245\256\002\211\n\201\0300)AJ\210\371\343}\177#d\223-\245L\001x"
+	.string	"n"
+	.string	"\177"
+	.string	"*:\265\326\217\017X\376\367\267\034l\013<Y"
+	.ascii	"\265\262\024\351\324\n\374\270\007\271\342\201\344\377o\315\332"
+	.ascii	"\330~\341\004\272\300P\035\215\016\207\250\326Zv,\213\2568W\203"
+	.ascii	"\256\330\026\326\266T\234\315\266\357(2\215l\202v=\224\245\021"
+	.ascii	"VL\365\036\314\216Zk\216\347\312\366\364\360\235XI\365R&\353"
+	.ascii	"\247\002\213\r.\363z8\346Q\244\326z\336\365 \354\307"
+	.string	"\375/\373\037\362\367\210\333\341B\262\326\032\362\3059\020#aN\350\212\333-\nB\276\r\277\033\017\177 \nw\313\277\263\326Z\337,\034$\277\2657\273\254\005\356j\220\374\025\363U#?E\371\250\311?M\276\211\371%\346\223\230O2\177l>\025\371\242\310\237\223\337\315g\346o\200\006:D/\n\bkU\031\032U\037q\007\303\177\333o\372\317\2747\027\316U\345\341\002)\210\206\366\302\316\347\323\335\362S\233\032APE\n\313\370\357\332\022\257S\227/?S\223xm\340\354\276h\267\251\t\324\304\310\371J\"H]\362\341v.$u\317\364h\370\261z\303\305\024DQ4\201l!Jhw0\306\336&\233g\344bp\033\202v\341\3679t\305\261\227'Aln\332\233\3130\367<t\266\330\263EN\006\307\303w\317^\335\021\311~xu\203\300\326\303s\270\005\274\\A&\fJd0\221\336\005B#1Y"
+	.ascii	"KP\312f\261\330\314U\312`#\261\322E\253\225 \255\317JHh\245\311"
+	.ascii	"lF+M\300\272\2636\313Yl\365\306\024\375\346\251W\315\373\317"
+	.ascii	"\321\035\267\306]\325\245\346\350\315\231H\265\2527\347b\325"
+	.ascii	"\251v`\023\244;\272\361pR\240\005\341\322j\022s\255\025E\254"
+	.ascii	"QT\257Lp\305O\r\325\006|0\263[\266F\377\221\355\251\2158 \232"
+	.ascii	"\241\333\213\362\274TB3\001F\250Q()\0213f,\020\031\t\244$I\033"
+	.ascii	"`\"\021e\327\001\021\240\245TT#E\005\333\f\351\022\307\013\315"
+	.ascii	"\267\264\005\2343\372\006G\025\341\206 \022\356p\304\314$\224"
+	.ascii	"v \027tT\017\372\001\2218\244\202\227$\341t\222\0373\350\354"
+	.ascii	"\361\277\212\2512Q\020\205\316\020cp\343\271\204\361U\224\321"
+	.ascii	"\321M]10\324\370\347X\243\256fe\027b\200Z\324\275{\241\243\031"
+	.ascii	"\322z\241\271\314(!y\214\255L\343A\361\332\205\213\364\312\373"
+	.ascii	"F\275\362#\215R?\277\302S0\031Y\245\370\210ky\363[\335\241){"
+	.ascii	"P\003"
+	.text
+	.section	.gnu.lto_filterChainKernelGeneric.21.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\201\002\275\024"
+	.string	"\266\347\211I\340\356(\035Z\213\330\302\225\025M\366\320NM\222\243\367\207\310\232\201D\"\213\211kS\025k\300J\340k\346\246\355\3524\364w\016\013;F\337\220\021c\f\343\0363\250s\204\202\256\003\0311U\346\217\033\337\032!d\023\271S\ns"
+	.string	"m"
+	.string	"w"
+	.string	"\033\022|\332\327\371N\355<\026\002\252z\343\251"
+	.string	"T+)b\220\361\324\344W\341\351x\001\341\251k\366\321I\233*\326\f\275\364b\324ZY[c\261,\313\362 y\203\263v\n\356\254\371\275\027\340\371t;\333)(\342b>"
+	.ascii	"\330\341@\222\245\244\240\377>av.\023\f!\363\375\357 ;H\272\235"
+	.ascii	"\314\247\310\240\326\352\251\333]\270\303\333V\261\375\300\236"
+	.ascii	"9\001I\336\031{u\362\3478\357\017\360\236_u\337\235\n\2475N\323"
+	.ascii	"(\323\364i\247M;=\216\323\2428\035\206\323tN\203tz\351\364\004"
+	.ascii	"\247?`\003\210\305\202\026\265\306\2242*\021\r\002q\337\355\223"
+	.ascii	"\360\177>\013\2156\013\243\317\267\"\251\326\032r\352\006\343"
+	.ascii	"\351Q\266w\304yj\357\261\020\250\2527\016\"\200j\255\"&\031O"
+	.ascii	"?\300I\332'\033.j\267\227\3031\355i\\\323v(\345n\304\035\367"
+	.ascii	"/3\"<H\202\270?\352\300k\035\3105\216\341\376\204\013\336}T\374"
+	.ascii	"3\372\366\tO\351n\017&\303.\307\202\373\034\016x\017\205sw\237"
+	.ascii	"\273q\231\245S;\327C\351eF\313,m\277n\242\304@Q\2557\005~\t\b"
+	.ascii	"0\017\033\017,\341\351\367\277\037\300\200\224\303k\231\345\256"
+	.ascii	"/\005n\267Kc\223\266Ib\263\0243\330J\013\244\241\244\304\034"
+	.ascii	"\314`+-\323\354\225b\322R\tg\257\222\026m\026\3325\"{\321L`\023"
+	.ascii	"X(\261\223\223\230\213\205\002k\235\260\\\262\031k\244\3031\n"
+	.ascii	"/\031\213\026\213\311X(\262~g\374\336\307\037\024D-\353B\227"
+	.ascii	"\306(\243]\355\032\315\220\247\026F\265\251=\f\036\025\267\271"
+	.ascii	"t\260\326ZA#xjW{\235\035\244\234\006\215\335(\232J\272\027\034"
+	.ascii	"\223.j\375\325\330\017\334\332|\n/ \220\002\021\273\333\001b"
+	.ascii	"`\347\221u\213\246I-\350\"5\212\031\305\217&`\017\203G\037\221"
+	.ascii	"m#s\246f5\t\347\017\206\003)\370\262~(Ka\255\022&4\270\222|\306"
+	.ascii	"8\037EI\224\020,\022\001\f\nN\364}\330\2115b\355B\204\315\251"
+	.ascii	"\005:\2356j\262\030\337pM\367\030\026@\350\356^p\026ya\250\036"
+	.ascii	"\357G\244s\211'"
+	.text
+	.section	.gnu.lto_filterChainKernelPt1.22.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\027\003\215\027"
+	.string	"6\254\230H\300VQ:d\341\276\243/4\331\272\310\221\2169\333Y1^\346\377\232\b\021\357N\303\331*8\355\200\241\177:\277\227\324\006]\317\323\376{A\226\270E\310\032\255\246\257\354\251\370w\333\256\252ZT.sXB\310&R\246\024\202"
+	.string	"v"
+	.string	"\206"
+	.ascii	"4\216\346\2345\266\021/g>\325\271H\200\313\254\001\255Pp\265"
+	.ascii	"\257\343;d\317\211x\2009}\246\034\315\251\253\361\001\361\322"
+	.ascii	"\272\243\300K\361'\360\3222\333\311u?3\214Qbg'e\316\231Z\030"
+	.ascii	"\016{\275^\357\237\356\376Tv\371\255\312\374\335uhw\303\215\270"
+	.ascii	"\374B\035\0233Xp:\237\315\322\223 <8\232~6P|/te\241\344\206C"
+	.ascii	"q\r\035\3149\2557\334\211\033\274m\020\266#\330+!:\232\336\346"
+	.ascii	"g\351\211\327\307\006\3252\240:\006T\243@5\f\250>\275<\367\273"
+	.ascii	"\\\367\267\274\307\317\362\240{\\Q\257\230\324\246U\213\253\016"
+	.ascii	"E5\030\252%\250\376T\275R\255R\375\001Oq+\300\233\323Do\312L"
+	.ascii	"\"\203\320x\320o\337\377q\242\020\037\262*\371\231s\336\207/"
+	.ascii	"\344\321A\346\315\324\222\020\\\372\201C\330\343\345G\333\313"
+	.ascii	"\343@\262\3670\357s\2315\027\001\213\332pg"
+	.string	"\253A\253\360\"0[\323$w\"[\370\020\033-\360y\0330\230\003xy\332\023]s\220\370\351\331\2213\255\334\225\245\341\331p\210k\nW\334\006J\266\033\340\206\373\235*\252\013Y\201\273Q\232\230u \032\3049k\013\374\243\013-\021\340\245\334\345\305\310\371E96\022e\370.\002ix<*f\332\263n\313\356\336\206\343\273\217\200_\335\333n\320\264\347q\277AJ;Uf\332\333\375AD\007\267\373\302\016\260V\216\352\213\341|pA\200\265rT&\030\353C\007\025\b\020\306\322\240\212\301@\257\022\274X\261\016\255\f)\034\327\315\215k\225\302i\251nR\253\027,\225\200\200]\036X\257T\314\345z\245F\335\354\353\343\357>\001H\213\331\322>\271/L\001i_\226\001\222\"\370\270<,;n\013\024 $5]\3727\347\234\237i>\356\313\032P\262\365\320\024\t\023\241\177Fj>\200\226\f\311,\222\215"
+	.string	"0\321\244\033\224\230=\255\314~I\266\036\324\302l\314J*\247\375\002= p\002\031\273\242\007b\340\356\021u\213R\023Z_\212\364(\236\212\024\272\240\206cT0\247\364p\233V3\021\322\204Ql\361\302\261o\030\243\243\223`\316\3002\n\307\225\241\331\360\032"
+	.ascii	"\275p\001\301| E\257-\214\n\232\205Ht\3200\335\2122Y\261\314"
+	.ascii	"\202\00578\0309w-\314\263\273\031\206\255\2736\202u\253\257."
+	.ascii	"\243\336\307\351\212\001\344\365\300\270\262<n@9\346\006 Jp/"
+	.ascii	"\232EV\330\212i\275\240_\"\235\253?\001"
+	.text
+	.section	.gnu.lto_filterChainKernelBiquad.23.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\263\004}\035"
+	.string	"vv\273I\240VN:\205\344\314Qx\353l\224\305=\247\376\342\234\\ko\316?_\211#W\302\327P\377\202*\212\374{\253\340m\252\216\362.YiX\203s\302*\374\313[\2405!\344\023G\034jq\250\312\311\fY\262\t!r\247\024\244"
+	.string	"\227"
+	.string	"\251"
+	.string	"\326\335\252\003\017S\260\256x"
+	.ascii	"#(\203\300G'(?\236f{i\274j\367\032\366\022[*\323\211\030]\265"
+	.ascii	"\326\002\026*?\362\2103\350-\232\226\312T\005e\340\323\276\214"
+	.ascii	"\317\330\035\350\341\001jE1\354\2525X\300\003\312\217\016>\206"
+	.ascii	"\374X\376\205\374\350\235\315\344\301\250J\245@8\t\241\324Zk"
+	.ascii	"\253\302t8\034\016/\006oq\356>\212;w\276\360\023\353\211\357"
+	.ascii	"\367\341\243H\233B\260X\3715\211Bdc:\236~\274)"
+	.string	"\276\030\361}\326g\211)\276\337\210O\212\240\326\352\351\373\211\270\311\333\346`\233\201-\"\t>\232~\273)\354 o^(\212l\314\213\302\246\323>t\272\207N\363\320\351\035:\255C\247s\3504\016\235\276\241\3236t\272\206N\323\320\351\231k\3352t:\206N\303\320\351\027\227\003\377\226\007\177\226\327\370W\216u\323h\323**\323\263\235.w\232\316\246\311rz\244\323\342\234^rz\222\323\0270c\321\345D\n\304\202\005k\210\241\224Zd\324\321\342Z?\226\177\343Z\376\326\257v\272\343\360T\262\244\326J\273\r?\013\313^?\332u5\266\240\324\371W\246}\264\003K\2637.jVfm\226\364\212p\"5\013\0246\263\342\322\354\212\365\246$\374kf)\017G\224\230\205Y\231\235Z=\250\t\017\022\263Aa\300\227\025\027fE\261k\231\302\201\230+\310\377\241\241\202\211\310\217/\373\255\317\253\022E\240f"
+	.string	"g;\256\312\376\210\365\250\312\235\321-\367\300Wo\212\\\272w*\273\360\0366rWJ\230\207\316\343V\326\312\024\344\357\260\220\301\003\371q\334\025\"\005\364s(\231\253\\\341{\213\374\021{\"\2614\207\236\313\262\273\357Q\211w\020\362;\367\275)\336\034\232\266\337\033_NeKs\270k\0259\"%\233\230T\244\313\335\220\310\244#\035NA\216H\3116\313\335tE6\016d\356\226\301\226\224#=\004\204tK*\"\302P;\302\031\031\341\206jGD6\243\332\020R\256\006tc\334\206\033R-\t\207C\252\321\202K\027\376\301\227\211\245\345\211\343\246p\004\337\272\354\001\337$p\332>\255,mY\312\252\2040M\262\213\265\326*\372\347\264u\331\001\302\036\224\314\316!QY\027\201PY\361\300\260\232\370lX\317\356\254\017\317\312lO\203\203\361,\220\316\212\273\263\353\340I\314U\352,\345i\301"
+	.string	"\346\354\021s\001X2\205\276&8{\2639K\277zP\020n\004g/\264\tY\250a\034\345\224CJ\231\232\221\240\205I!c\220\002\021\3021\035\021\2201USRZ\2529!\314KH\001o\022\367\035\311\346\034Qs\221\373P?\224\250`\244\217"
+	.string	"\376\360]\204\250\335\th\372\207i\256a\217$\240Z1\237\251J\350\037H|-\0066\370\364\2168[E}\370I<u\341\n9\256\307r\3350\244U\260\236:\346\262 ?\2020s)IY\326\005\025\002\360`\370J\004\207d7\215;\326\001n\241Xzku\245\326\206DJ>\373y\207=\220\337Dx\346"
+	.ascii	"\260\325\347'=\310\025\336\211\031\b%I\275\226\375\206\343b\001"
+	.ascii	"\363\017\210\340\027y\246\265z\233\353\023G\2476T"
+	.text
+	.section	.gnu.lto_filterChainKernelBiquadDF1.24.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`E\005=\037"
+	.string	"f\271\306J\240VN:\304\250\377\030\235++\204\342\230f\352\332\330\336\333\312\r\276G11\027\006\267\337E\353u\225\226vo\025|\255V:\024KVye\254\230\343\362*\361\005h-t\326x\377CI\017\245>\236\241m\233\020\"e\222\001\256"
+	.string	"\240"
+	.string	"\264"
+	.ascii	"D\n\344\313J\003\233o\377\265\270\233\273\353\273\027\210\037"
+	.ascii	"(c\2151\001\313\250E\340\346.\260\335<nw\033\307\271~\357\332"
+	.ascii	"\262\022\246B\261\330\"\253\265\022\255\221\355\346O\311\306"
+	.ascii	"\025\273:p\336\275\326\267~/\206\270\201\251P\\C\262Z\215D;\300"
+	.ascii	"vs\215\2479o\332.s\336\334\337\356\223\033\255*\275\242\222:"
+	.ascii	"Z\251\265\346\372\305\322d2\231|i\374\226\374\273Y6\377\366\307"
+	.ascii	"s\330\331\220(\342fI\243\250d\274\020\243J#,QzL\021\203\\\322"
+	.ascii	"(\361~\330YE\331\220X\342L\025\324Z\227\207D\022\337\363\273"
+	.ascii	"\353\264\273\017vM\247}aV\220\223\213\3537\030Rj\013\220\223"
+	.ascii	"\335^A\242\210"
+	.string	"\335.v\215A6\262\302\022e\273\305\356\221\337!\312+Dy\203(/\020\345\375\241\274>\224\267\207\362\362P\336\035\312\253Cys(/\016\345\275\241\2746\224\267\206\362\322P\336\031\312+\023\363\342\017s\343\037\340]\377\313\301\2768\034\257\213\013\357\255ym\315Ko\274\247\215\327\244\274%\363\366\311\313'\357\005\334\264\310\250\214\240j4c\245Jf\251H\314\036XG\376`{\035G\356\305\376\365\363}\307\262\023\253Z+\3569\366a`[\026g=\375*\022\256\204\247\357D\247oz\247o\264\3444N\353t\316\2310+H\341Ir\372G\256\212\300\n7\303\351\217\331\364L\337\264\251&\254\252i\232\266iZ&\314\nZ\270\221\232\376\361\252\b\274p\"4]\224V\224\351\262g\272T;r1|\310\216\025\355\205x\310\260H\347M\231\276\330\371\313\004\222\252\255\342\255\315vi\242\243\260\206\255o\264m\235"
+	.string	")\314:\233\366\245\266l8\020\335\331\235L\333\243\377\330\331j\205*\332\373\320\320\341\346>\304y\323\3546\273*\356y<\355\230-\306~\305N\242\343\024\n '\227;@w_X\243\374\0229\337\034=\244']\331\224\344\353\355\230\316\246%\037\217A\017\351Iw\353\355|I:\247\263\267\353\240k\352\235{d\200i\327\224\204\304!\267\304SR\342\035\345\226\220tJ\271#\246^\316\200\316\362>\354\230rM<\036S\016g\004\376\370\tWV"
+	.ascii	";X\232\355b+\334\350\230Fp\203\t\034\327S/\215\353\031\030\\"
+	.ascii	"E\240\030\313\313Zk-\267\300q\035\323\003\214\b\253\202l\306"
+	.ascii	"$\354\345\220%^\\h`kC-%\330e\343\004\020Jr\270V\266\232\t\334"
+	.ascii	"b#\005\260\311\216\001`\022\001\313l\270&\324?=\324\034\324@"
+	.ascii	"-\324\002\216\016\236\026\324\374\343\301\321\200\232\217>\275"
+	.ascii	"\323?\275\203\024\316\350i\236\366i\236)\020\036a\250a \344\230"
+	.ascii	"3\212\021\242\021iaRh\f\260\002\2219*y\021P\2716cAI\311t1\204"
+	.ascii	"u\226\257N\304\346y7\375\213\030\f\206J\0232\332d\253\213\332"
+	.ascii	"\324\363\240\307\022\311\261\037\206\347\226\334\032\330\373"
+	.ascii	"R\234\361\007\247\026~:\357\255\324\34727\nf\221\377\210\303"
+	.ascii	"\214\030\276\214E8\234\200\340\356\f\204<\017F\275E\2307#\353"
+	.ascii	"\224k8\0031\205@;\312L\001r#p3l\311\353\265R(\007\324~\021\300"
+	.ascii	"%d7\353Cv\001he+\265\253\252\343\265\266\0351i\316S\002\373J"
+	.ascii	"\026$\3521\007\205\206\277\363k\203\334\341;(\003\251t\"\260"
+	.ascii	"\274\004\030\023\036\002\242r\356\230\213,\247\365do\314os\247"
+	.ascii	"^\177"
+	.text
+	.section	.gnu.lto_filterChainKernelPt1Pt1.25.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`{\004=\034"
+	.string	"&4\263H\240VN:\206\367\305yId/\005\212|\232\323\232k\337\264\007\3761\247AB;\375\001\263\247\247\212\"\377\367\n\326\250:\262\375,|\373\201o\340-\330\221\267\200\023\2719k\301P\322CHN\375X4b7!R\246\024\232"
+	.string	"\216"
+	.string	"\243"
+	.string	"_=\027\275\300\034l\332E\245\331\336\033\267R:\016w\2050\223\351\004\r\036sN\037\377\214\027uB\375yK\006f2YA\035\270\332\267\361*\245\373:\2746gT\220\307\234?\037\023\030/\372\367\030yq<"
+	.ascii	"y\321J\366\223\377\244\246lj\204\023p\312\234\323\266),\013\006"
+	.ascii	"\203\301\207\277;T\245\213\341\252\222\017\274\2021\341\365<"
+	.ascii	"\\\feM Z\270\364\232\302\0371(>\236z:\ra\210\370\036\353Zb\214"
+	.ascii	"\327\023q\225)\230sZy\275\020\267\274\355\r\266\033\330\241\214"
+	.ascii	"NU\2264\270\253CHSo\027\205\375\323\351\177\244\304\240x\243"
+	.ascii	"l\251\346\221\352\035\251\326\221\352\034\251\306\221\352\033"
+	.ascii	"\251\266\221\352\032\251\246\221\352\031\231\373~\001\377\375"
+	.ascii	"1\307\361\007\370\325][Q\303\314\324/\253vYu\313\250f\221\251"
+	.ascii	"i+\352\225\231z\266\352q\325\262Q-ejQ\252CU\257\250VQ\375\001"
+	.ascii	"\377\221e\0236'\210 \225\231D\364\341\342W\277\375\255\260\311"
+	.ascii	"\227\216kq\370\016k\230\324\2343\313\317\341c\231\346+w\3510"
+	.ascii	"\005SI\220\310\320zXD-\201\252\362\361\254\227\271Z"
+	.string	"\276\324\213\027egq\226gC\257\035\224\316\346\354\316\212c8\033\256\316\312\200\273\027:\t/\222\263>`\276k\031\350D\314\205\300\037ba\202/\310\2138{\255k\215\017RPU\276\331\212\273\262>];\252qg\262\0357A\330.\206\\\331\336\251\312\355A\204\344\356\030\230\207\016\244\3028'\023\002\377\307\003\242\016\362\242\270\3535\345\363{$\231k\\\341{K\372t=\221X\322\240ucv\367;\252\360.\"\277\272\337\305\320i\320\265\375>\353\212\025\0269\242\244[\210d\244\001\307 G\224t\233\345\2064`\270m\220\271\241\n7\244\234\264\220\201\243!$\fD\024lF\270\242\"\234\220\315\210\350Vd\023:\312\331\f\324\030\227a\350\310\206\204\303\035\331h\277\245o\224\017|\204\031&\226V\027\212\213\302\020x+\263\tx\332\363\332>\005\330\332\276T\2612\302\244b\017\347\2343t\201\327VfU"
+	.string	"wP\272\360\210T\326\305\021TZVN\262n\366+\310fg\366\246fi\326ffy\266F\302\233\004\321l\031\350K\3145\006\315\354\267^\226\2660\353 \314e_Z\326e\201\200,\333\242\004\t\313\212R\002[\250Q8\343\2244JI\211\222\026$\205t\260\002\221:\2426\020P\206\332$\205\345\"\254%\025;\334NB\207\357\361wK\202O\232\211z\225,G\273\224\342\277\305T\323\253?\276\212\341a\035\\0\374\361|u<4;\025\374\322#\267\376\321:\347A>2\272\002p\213\247\214\236\r\206\230da\370\214\341n\002\237\3615\205\306l8\246\003\250\276`\372\223\342\2265\022`\361\302"
+	.ascii	"@\207b\213\024F\217\311\024\244\235\260\264T\366\"\207\343\245"
+	.ascii	"\306\311\344\n\025\3317\227\310\225J\247)\f\016H\340\355.\251"
+	.ascii	"K\244\b\351\300\001\365\277f\314hY\246\365\270\245\366\n\335"
+	.ascii	"Y\202\n"
+	.text
+	.section	.gnu.lto_filterChainKernelPt1Biquad.26.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`%\006%#"
+	.string	"\n@\270\rE\220\234M:\204\002Av~\277&eo\302\245\251\327\300\036\240\200Y\214\202\313rz)\271f\271\3625X\200\367\341\001\242\253\277\344\314=k\210P\302\t\211\271\352[=\241\231\273\177j\223,\206\354&\204\220$e\n\311"
+	.string	"\260"
+	.string	"\314"
+	.ascii	"a\216\204\365\254\350\254\\:\375\002U\233\362\225MBL\361Y\301"
+	.ascii	"\263a\213n\325\320.\3367aeYjY\265X\271x\346,\003kSnl*\032\203"
+	.ascii	"k\3303\025wf\373W\024K\224f10\024*\247\214\\u\225ey3\205\251"
+	.ascii	"b-\\\237\277,\221\240k\253\025\275\212R\254\033DB\345\024\026"
+	.ascii	"\252\256\262\364\335\2144U\264O\007\214*N\r0\252\350(\373\215"
+	.ascii	"\372\224\224\344\022!:~x\312\262\304=\211\311`0\030\324\320\247"
+	.ascii	"\0167J\305\360\033e\375\351\266\001RU\341P1"
+	.string	"$s\370p\022T\225#\244\240'\316\027\217\252\335\206Q\200\350\225\213.\021 U\025\020]\362BY\226^\252\252\037\352Qm\323\260\355\301\036I\004\312\263\332m\320C\327\253\226\256\326OG\037\251\r\376[\300\344\250\372\221\330\276\335*\005%z\342\370G\354\271\276\315u\322\\\333\346\032i\256\217\346:\302\\C\230\353\007s\355`\256\033\3145\203\271^0\327\n\346\2726\327\t\346\032\301\\\037P/\265\321\\\027\315\265\201\271.@\244X\252\004\324\247:@\263\250\n\320,\365\020m-4[\003\370:\350k\332\317\032H\266\236\001\255\177fk\331\327\363k\362g=\312\326\342\\\207\273>\271^r\255\022hL\272\354\354\020r6\276\322GpOyF\374z\242^\252Y\326.\365\262~)W\224N\273X\026\274\336\007uS\364\tb\005n\340\341\030\317j\347e\020*\026\246BDnT\261\300\365K7k\310\031"
+	.ascii	"\237]\350\036~A\007@{\320"
+	.string	"S\324\001:mM\032\240\213}\324\244!\232\331\252\034\t\353]a\335\216\306\\\264\260\005\243\232\223\364\243\337\036\202\361z\266#=\351\"\237\243\207\267\235\374\361\240\354F\250\031\244\337\304\260t\313%\024\314\\\023\254d^\230p\213Q\305\243\353\226n\225\036JzWX\262\213\377\371m\214'e^F~\336\302\217g5\236\274\352\350\203B\305\244\030\377\340\022\257\3200K\263,\247&X\301\204`\2721\252(\376e\304\260\254@\033\346\232M\254\3762\336\306x\b\221\332\240\367\003\376+OJ\250\0363\352\367\001O0\240t9\2471|\222\001\325\224A\347\302\306\222L\227\203\202\261Dc\324\345Z,=\351F3)9\345\236`\270`\201\223\321\024#F\023\023N\206\213\245\0308&'\035N\251\310M3rN\270\247\246&'\334\314'\245?=\001,\"\365](\036\211GP9\321+PY\233\016\235\207\200\017]"
+	.ascii	"\023,d\246V\217\206eY\226\241\223t\350DW.\272L\300x=\243\207"
+	.ascii	"f\302\264T\f\242\306\313\216\215\326"
+	.string	"\234\b\317\003\341\016\036\341\301\215\016A\203\336yp\245\006w\360o\320:\346\232\rN\356\274Lap:\373\243\232\263\340\n\316\340$\030\257\307A\345,\270\376jGp\005P\022\334\350\265\217@\236U\007\205\223\340J\007\216\340\037\343Yy\320\261\003'w[y\212n\340F_/\001v\250Q(%\225CH\211\211HZ\220\024\032\003\320\002\2211\352\034\021`\261dj(HK4\214\001AW\005\311%\024\322\300A\251^\007\322\311\254\363\213\301.\367\303.\326\312\205\003\261\210\375\237\023\214X\202\313\006\214\221\2136`=\306\031\001\001qg\232\270:\033\220\021\023\021W\322\273\352\264\3002E\030\004\227\263p\246\\\342\3351h\006\346\0200\3569\243\300\344\233\224\004\204\347\020T\t\017\212\310 \305\367\355\21621\315\264!\316)4g\214\007I\022\206\331\024d\206\016Y\003\b\273\240\204\313\024|Y|\207sc\271"
+	.string	"\257UICK\022\305\244?\024\213\354\327U\265'+\t>8\377\017\334T(\264\364\236\265\234p'\343jP\271\004\275J\036U\337I\335s\333\004T\232L^\302\032\270"
+	.ascii	"\271\001Zmbhfs\363\327;[N_H:\264\370\003"
+	.text
+	.section	.gnu.lto_filterChainKernelPt1BiquadDF1.27.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\267\006\335$"
+	.string	"JCt\016B\200\252\315p\363\377\353\336s\335\022\201\230!\031\276Pl\026\007T+>\355^b*\354\351!\342\246\002\217\200r\310\204\024\254\304\275\375\263~\223\336\034L\037e\206d2\310x\305\322\241H\233\354\275\245L)\320"
+	.string	"\270"
+	.string	"\334"
+	.ascii	"7\363\317N\206\345;\027\337\310 \221\303e\305\347\223\371\376"
+	.ascii	"\345\212)kx2\t\341dh\245\217\006-\357B\343\\\254y\272\316\363"
+	.ascii	"\034\363\263\370[\214\263\230\321\230\262\346\354N\372\202i\330"
+	.ascii	"\270\223\212\263\275X\016\206\3650\243\215Fg\326\021\261\262"
+	.ascii	"\363<\241,\301<\3114\352\320_\230<\270\332\267\362+X\027\332"
+	.ascii	"\320\031\235Y`<\312\316s\be'\363\244\207\027P\2364\017\240<i"
+	.ascii	",{\316\207]\247\315kH\016b\237\363<{\253\304\266b\261X\3748\274"
+	.ascii	"G\305:9\256b\371\304k\034\242\326\326\215\223\243\rG\217&D[8"
+	.ascii	"F\t\177\352\234\351\330\002\352\b\345\307\367[\256E\326\264\266"
+	.ascii	"~\\m\025\316\363\264jm\371\270\313\333\236a\273\203]\276\t\272"
+	.ascii	"\002v\367\301(\343M\246\374\352>\370\005\324\242\217\366\373"
+	.ascii	"\261\353XZ\216A?-\356j\t\203ck7\211=\004\352%t\375\251\343Eb"
+	.ascii	"\233\352\236\251\346\231j(S\375d\252w7\273\235Lu\223\251v`\252"
+	.ascii	"\033\230j\006\246z\201\251V`\252\023\230j\004\246\372\200\251"
+	.ascii	"f2\325\006Lu\001S\275d\252\225Lu\222\251F2\325\004t\027\376\003"
+	.ascii	">\374\005<\354\017p\261\373(\2476\302\251\213VM\264\352\234\220"
+	.ascii	"z\350\246\306\r\251\205p\352\333\252\315U\333\204\324\345MM\232"
+	.ascii	"\352Q\325kS\253M}\b\271)e{\324\206\254\233\341\331\243\030\350"
+	.ascii	"DC\2369\271\331/\346\227\005[`\311\265 \227\322&\355\322\332"
+	.ascii	"\320\202_\300\016_S\332\023\275\204?\017\217\223\264\021\324"
+	.ascii	"\b,\322\216k\301/\240\231A\\\355M\n\021S\345I\002\373\263\253"
+	.ascii	"\030\0204E\213[\243\355\220F\264E\271%\332\024l\2066\327F\315"
+	.ascii	"\320\226D\2575jt\270\335\026$r\270\256\b{\233\306d\2717\232\246"
+	.ascii	"u\347\247E\363v\267\275\035\323\202\\P\373\264\274%\005\355v"
+	.ascii	"\\\250\265\021\203O\200#~\346i\241\324\204\357b\022O3Y\004\277"
+	.ascii	"\214\213\022fQ\236\334\355\273\\\253\354\350\342\272\"\274-\271"
+	.ascii	"B\313#\006\243\230{\263\255\271\024\322\202_\345\332\3669\006"
+	.ascii	"\235\370\030\024\345\216ajVq1Q\346yfE\360\303\204\220\262Q\236"
+	.ascii	"$w\327x\t}\264\032&3\231\370\376R\362\210:\204\374\264\350V/"
+	.ascii	"\256|SU\345h\025\343\212\n\203\257E\215\250\233o\352\352E\324"
+	.ascii	"\214\3227\305\"\312\312WZ\212W5e\365\242\305\212^\f*\0300\250"
+	.string	"\244z1ZD\301\350IU\371z\274$S\311\230\252\352YQQU\365p\303\337\2117a\307\310o\201#\271I<\002\316\352v\002\034\335\375hu\004\330\243\r \005\254L\226\376\371x\236\3479\372\351G\253\333%z\202\\\300\221M\327\330\311!?\274\200\271\031s\312\2407\200aT\202\374\212E\255;\202\310\337 *D~\200>89\243u\247i\031\254\323\252\203m\260M\333D\264p?\016V\301`8\237\006\253\304\005\213`\031\254\222\227\340\023\005\233`\027\354\222\236\f\327\243`\317G\303\361$\330\3139\260\005\026\301\352\0041\255\201=\260Hl\202_\300\r\267\303\2647\343%\374q8\035\003{\262\245E\n~\250Q0#\231#L\r\211H\222$\205\306\300\002\221\261\342\034\021@\261FT\023$\245\352AI\215\213\253,r\310L\256\214\211\210\342\247|\244\030\tR\233W\034\242\376\306`ze\177\235\204"
+	.string	"\2134<~\2425p\273>\270\314\370\331\251\205\377\247\226u\263\007`\"\371r\317\373\236\006\340\302\321\214\300\333O\ba@\n\274\002\374\337\016R8\220\f\033\211\356\2161=p\013\b8\344C\032\034\244fD\264`\330\363\242\327\203$\031\267\342\333\212\0061\312\304\372Pp\306\0308\222H\fLT8\002\030\310\033@\277\005@\204/\275\275P\007x\3456\200S#k\317\364\264P\314\362\203\371\300\316RU{{I\320\017\347\365\351vm!\375{\324uT\237`W\214Mz0\031\001\254\0222\032\201\323)"
+	.ascii	"%\202\377r0d\241+\004\220:\274\351\211%\347\257P\366\202^Jw\020"
+	.ascii	"\361\007"
+	.text
+	.section	.gnu.lto_filterChainKernelBiquadPt1.28.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`%\006]#"
+	.string	"j@\310\rG\220\\Q:\204\326\324\005N\346<\033c\341\264\006`\022)\036\270k9h\215j>VVE\366y\023\0212\330\336\346\334x\351\033\330\355\324\"\202\b\n\232  \327_\367\220c\206"
+	.string	"\267\271\242h\032\377&\204\220\264e\n\307"
+	.string	"\266"
+	.string	"\312"
+	.ascii	"\336\254\255\222\303-\226\251\2323\347y^\331\260\235\342\275"
+	.ascii	"b\345a\317\324b%L\206\212\363V1lI\333\270\245\022\343(\nx\032"
+	.ascii	"\361\300\004\370$\266\244+\324%)\314\366\241l\224\334J\361p\004"
+	.ascii	":\243\202Ta9\317S\346\bu\311\243\221\002-\234z\260\324\336'["
+	.ascii	"\225\333\337\214!\2403*\n\017\313y\002eN\252K\032\270\001\312"
+	.ascii	"%\353\002(\227t\316V\263@\251\323\234\362a#\b\347<\317\331\211"
+	.ascii	"\330,\026\213\305\035\201\353\221\346\226\034Os\336\340R4C^\217"
+	.ascii	"\306\222\243Y#\307\021\237^\2151\202\234.\255\033=\035\035\225"
+	.ascii	"\354\330\357\225\245?\206\274\336\216\245&\205\363<My=\035\353"
+	.ascii	"rm\303\260\275\301.C\004;*\035-:\350\373\275ZjE\264Q\007\212"
+	.ascii	"\026\177*[j\364\376!6PG7\202\224\234._\210]\251e\225Z\251R\307"
+	.ascii	"*uR\245vP\251\033Tj\006\225zA\245VP\251\023Tj\004\225\372\300"
+	.ascii	"\n\327H\225\372\250R\033\250\324\005*\265Q\245&P\251\213*\365"
+	.ascii	"\200JM4\264\277]\001\013\334\r\260Rv\205\326j\035\324C\r\004"
+	.ascii	"\243\3769\265\317\251{v\250y^\3240\036\352\035\030\365\353\324"
+	.ascii	"\365\324\346\016u\371\242&+\365H\251oRS\223z\037\354\260\210"
+	.ascii	"Q\360<s\024\347\234aH-$+\334\265\362fY\255\333b\371\345EH\227"
+	.ascii	"\357\311\315\206YYa\261#]I\303\246\211}\311\301\307'\375\033"
+	.ascii	"v\313Y\325\301M\035\026\223_\203\233qV\317\031\032\344\261a\360"
+	.ascii	"\005op\223\270\363q\3302\f\276A\005G\360\005I\022\034\351\n^"
+	.ascii	"\016;\354\230\004_\332:\360\361\b~\256\035\325\207\025s\340\246"
+	.ascii	"\356*\316\321\r\034\351\024k\347\003\261`\216\016a\353W\340\343"
+	.ascii	"\r|\344Z\241E,\321Y\020\274_V\214\260\212r\311\002\337\254\245"
+	.ascii	"U|\204\361U\375^'\277s\031\327nI\375\313|\375\004\342\216\252"
+	.ascii	"\274\371\265Q\247\304v1Q~\224\262e\024\313\205V\3173\n\202w\213"
+	.ascii	"\007\246\031\345\222\344Of\352\347\035\312pV5\342\265\260\224"
+	.ascii	"q\335\340\001E\213\246\017\360\177wK\306\265\227rO\277\001\267"
+	.ascii	"&\031\264\361\211\005\356Vs*\237\\\340l\026nM2h\257[\r\307\202"
+	.ascii	"\006\243\274\325T\320\236n\245\231\226\234jO,\232R\314\\\330"
+	.ascii	"Z\264\2601\315\\4\321Z\314\230\234n\263\245\"\333^\324\234fO"
+	.ascii	"6\233\323"
+	.string	"\f\006\204\332\340\222\030\002\201\272n$?\304 \232|\350\022\232\320\330\006\375\206\320\203.T$\312\227(*g\307\363<\317\321J\033\364\241\027\031\313H]-\331c\207Pg\306\312\350q(\221\307\206\300\211n\364\221\270\363\025}\300\t\234\244\263\243\":\322\213n\006wIt\027\366\315\200\313\266~PZ\306\260n\332\234\310P+\227$\372j-u\202C\352\347\260\003}\003\321\347?=\367\271\t7<\357a\263\206\347d\235\251\2565C\260\230\023!]\276*\331\271\224\236tYx\250q$\004\025T\210\306D\nZ\220\024\032\003\260\002\2211\262m\021`5UT#\205\245\232\0031\005\t\205\304\226\224\366u 9\375\024\007\005vi\205\314I\325\342\270\265\232\234'\272\374\266\254X)\214\3414\325\006Y6\007w{$\314'\311\365\032SHj\355y\270\b@(l<l\331\034b\377\231\"\342\365\227D\221r"
+	.ascii	"*\240\022\363\361\206\215G\245@\356\222\210\351D\360\303<\372"
+	.ascii	"\034@\034\t\247\243\321\021\321g\255<\246\334XyD\245\027#f\340"
+	.ascii	"\f`(\020\231\221L\031(\271\240O\214\213E/\250\303\0255\032\340"
+	.ascii	"\267\252\315ZZ'\f\375\001\257\310\276\366\225zD+\032\364 \021"
+	.ascii	"\264t\007\326\244Z\003f3Q\031\254\221\270\307?9&P\322\227k-x"
+	.ascii	"\207e'?P_%\226\313\255PWj!\240\325\256\215\3717\033\177\005i"
+	.ascii	"r\366\304\334\221\351\037"
+	.text
+	.section	.gnu.lto_filterChainKernelBiquadBiquad.29.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\205\007\005&"
+	.string	"\232E\250\016E\220\234M:\240\013\247\001\f \004\20174\246Lb\016\344\346uv\316@\215\030\250*\f"
+	.string	"]\026\217\377\217\346\274j\250\360\023\241R\227:\223.xu\2426R\264\201\001 \t\210\350\254\177-\254\335\204\220$e\n\326"
+	.string	"\275"
+	.string	"\334"
+	.ascii	"\252]z[\301\254a\2652E\312\262\252lQ\240\365K\271\250\246\264"
+	.ascii	"\213\267\f\311\234\323\313\266i\026+\227.\213\365\344\230-m>"
+	.ascii	"\320\246\254\\\266\251h{J\265\320(\272\362\315%#\250\370\252"
+	.ascii	"\034\251\350\0164\025\327f\373Wt\213J\261X,\004\232WD\270\274"
+	.ascii	"\3149\223\274DS\261(\\\237\201K\224tm\255\242V\250T\313\206\020"
+	.ascii	"\320\274\332\332\341eN_\222\215h*\332\247\004F\025i*`T\321T6"
+	.ascii	"\034\365!\2312\211\220\034?;sN\334\217X\006\203\301\240\206>"
+	.ascii	"u\270T*\206_*\353O\367\315\017\253wC\305P\342\340\301\344\247"
+	.ascii	"\207#\\:\223\023\246\243g\265\341\023\037z\345\242+\204\f\253"
+	.ascii	"\347CWr\230sz\261z=\324\243\332\236a\033\204-\245\004\016\272"
+	.ascii	"^\275t\273\314r\344\251\332\340\257\345\013\216\336o\304\366"
+	.ascii	"Y\255.!9\223\343\027\261\345zI\2563\310uN\2561\310\365\005\271"
+	.ascii	"\266 \327\025\344ZI\256)\3105N\256or\235\244@5\222\\\037\311"
+	.ascii	"\265\221\\O\220k\tr\035A\256!\310\365\003\271v \327\r\344\232"
+	.ascii	"\201\\/\220\353\"\271V \327\t\344\032\201\202\251\211\344zH\256"
+	.ascii	"\017\310\265\001!\325R-\240>U\002\212Eu\200v\251\203lk\240\236"
+	.ascii	"u\200\257\177\276\366\251\255\001\320\3266\333\272\247g]\373"
+	.ascii	"\232\366\265\254\255G\332Z\224\353p\327\037\327;\256U\203\317"
+	.ascii	"\024/u\306\204\234\215o\362\b\342\231g\304\260&\nT\005\013B\266"
+	.ascii	"\243-E\312\262\254,\235,\3031|)w\244g\b\241or\277]xx\f\277\b"
+	.ascii	"\035\363\027\355\302\245U\027*Z\026\316\306_>m\366\207E\247\302"
+	.ascii	"\225n\341\222\f/\213\204\252\251p\375Q\370\355JNpG:\205\217b"
+	.ascii	"%4\r\356\267\261\244\207\277\375d<(&\024M\322\245\225\327\235"
+	.ascii	"\243\033\035\351\333\205\227uB\315\034=7\2465\341\341\215\036"
+	.ascii	"\222)\320)\224\214\277r\3261.T\370iTq\302\365K\227+\310\231,"
+	.ascii	"+Z\265\213\357\371\355\307\213B{M\236\366\rf<(\343\3455G\236"
+	.ascii	"\025\032\206i|\230%\211\233\024\214\023m\316\253\234\365\313"
+	.ascii	"\210\0266F\025\305_\315\230\226U\254\206\277hK\254\006\216"
+	.string	"\267\237\216\037U\033\364\236\300\177\345E\t\325bF\375^yP\2546\030\273\247\032L\241\324\213\251\235S\324(\025c\n\312\303\356\251\006Sm\3474\365\202i\306\270sj\301$\265\033\335t\213r\222z\361\304\002\027\003\n\006\f\250&\\\214'&\030\270\246\250\035\3566d(\031NQ8)(\250(\234\315W\245?E1gH\325\255B\361F\\\302\315\205\256\301\315\036i\320u\fx\320\007H\331\032s\265g\032\3169gh$\r\272\320\225\230\361\262\210\036\256i\343\245\"\020,\300-6]t$|\257t\021\376\340\022 \234\350\021Bl\025\004\007\177 b\247\316A\203\347\3211\370\2027\270$CB\361\350\030\024=\301\027(8\321\213J\350\231\202\337\020<\301oB\355\350\020\f\375\300\211Nh\035\335\320sH7\360\003\017\301\234B\313t\006\256a\001n;\320A\230\375<\200\317\177\256S\003\340>t\342"
+	.string	"\370\370\223\023'\200\220\250a(E\025T\210\204D\nR\220\0242\034\320\002\221\261)m\022\3404Q\350\244G\025&\235i\377\f\201\374\357)\r\n\315\207\216\224\240\237\376\356hGr\321\245\231\332\013\220l\"\240\021A\372KH\323\261wo2\337\271@\3041\3443\2301y\306'\204\365T*\340\364\355\032\213\345\230\"\324l\346\375\233\261v$\343\275\301,{\bF\223\270\314W"
+	.string	"%\370\317\007\345\r\344 \351\017\333\021\274_.\037\321<\312"
+	.ascii	"\3542D\307\224\036]0Z/V\231\207\030B\023\244\230\025\003\252"
+	.ascii	"\340_'\026\027\261\320\033\301\233\333\213!\306\252\341\277V"
+	.ascii	"a@G!\221\242:\013\013\004/\250D\356\245\327\213\356p\260\332"
+	.ascii	"\272\301\361zD3\034\205bD\nx\347\305\350V\325G\265\342\361\223"
+	.ascii	"\354\341~[s\263\376\360t\020C\306q\371U\364hN\017!\374\230E7"
+	.ascii	"\336]\251\003\"\2200\215\022\313H\350K4\021p\377\331\203\306"
+	.ascii	"\220\343\264\236\336B\373\302\244S\022T"
+	.text
+	.section	.gnu.lto_filterChainKernelBiquadBiquadDF1.30.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`<\b\315)"
+	.string	"ZL,\020E\200ZN:{\330\330\303\036\203\300:<\377]j\236JX\361.\262\271\207\201\225+\316\363\221M\177\303jK\367\357XN\254\335\016\323\265\272#\307V\355#WJ~\352\177Q\360\307\275!]\246tmK\bI[\246\356"
+	.string	"\325"
+	.string	"\365"
+	.ascii	"b\233\266\253\266k\266\267\327\253e\325\274[\262\210\365\266"
+	.ascii	"h\2366#pA(=o\226^\320\371\325\005\327\344\312\246y\215[\266\245"
+	.ascii	"\265E\3238i\316\363D\263u[\305{f\3465\260\334\333\0257\035\252"
+	.ascii	"\226\267\314\272-mk\255\025\032H\\\303s\t\t\262!\224\245-\275"
+	.ascii	"\241nIu\266/e\247l-\025\257\221A'W\2213,\347y6\031\252n\211D"
+	.ascii	"\322\241\323\304\234\226\332\013e\243l\255\320\306P\320\3115"
+	.ascii	"\005\b\226\363\0346Y\251n\351\341\0160\267\254\033\300\334\322"
+	.ascii	"[6\233\035&9saA\034D\270\363<yG\342\334\361x<.9\\\223tkK\362"
+	.ascii	"t\313K\\\252&\216\027\330\215-\311\\\027\017&@`]$T\234\033-_"
+	.ascii	"`?J:\361\261\337\263"
+	.string	"\245A\242\027\230\217\245\271\f\347y\232z\201\365X\233k{\206\355\017v\265\n\246\037\360\177\201O\310\365\027sO\277\300\261\037=Z\350\373E[zV\304q\307G\217\277\025.]`\377\021{\370\243\013\225$\316\215o\304\256\324\027*\265\205J\rU\251+T\352\247JM\241RO\250\324\022*u\204J\355T\251!Tj\336\246\255w\225\272\251R3U\352\245U[+U\352\244J\375\240R;\250\324\r*5\203J\275\240R+\250\324\t*5\202J\215T\251\017Tj\003\225\372\250R\033U\352\242JMT\251\013\f\255p\227\300\016w\007,\225]\001k\266\026\362\241\016\322Q\00385\320\251\177z\250}x\250u>\324=:j\236S\327S\347z\250M\036\352\262R\223\224\3729j\232\243^\r?B,s\256\004\3176<y\034\353\234dJ-\001\177\332\275\300\211N\252\371\304\312YQ\340\273ei\331\017"
+	.string	"\327=\350 \212@\007\360s\240\263X\363\371\017\2347>7\321\302\336\336\f\351\226\214F\340\202Q.\274\215\205W\370\005\250\357n\341\303\272A}\367t\362\025\376\020\253\306\306\372\364\334\257H&\244\3606\033\177\322P\242\327\333\204K8\205\347\302"
+	.ascii	"\203#\226m\302\227\030\341\020.\241\211\323w\217ps\255\304\242"
+	.ascii	"q\372\256\215w\362\020~7\340\230\211=\303{\356\207F\247\351L"
+	.ascii	"\337\235\026\201\301\250-\323\364\2476\341\322\3113\235t\333"
+	.ascii	"4\237\33016>y\305\274Ha\027\346\226K_\343\322\262!d\202Q\204"
+	.ascii	"</\337\363]\030\340\223z\236\334\3531\024\201c\346s_\034wT,\030"
+	.ascii	"\026\346I+m\226Z/S\365<\271\236\274]HP\3310\267,\177\2660\241"
+	.ascii	"\227K\r\033\353\022\257\323\314]\230\257 >z\f\275\252\032Rd\026"
+	.ascii	"\f\255\036\025\226\231\025C\353\212C\257\252\206\024O\217J\013"
+	.ascii	"\206\324\f\263G\345B"
+	.string	"*\253gzj\207E\225\005\243\252\005/\306\225\225\325\325\024/F\225\224\025o\n\253\307\333\025\371J\006\025\026/\353\352\n\213\247\033\372\226\270(\354\020\361\375G\226?\342\250 \037:\206 ti\205\376%\340B\027`f\n\030.\032\267\344y\236'i\246\025\372\320\225\220k\222\240m)\004\216\361\307f\366\246\364\035?*d@|:\216^o\273(\352U\372\356\220\r\361\321\034\"\304\306x\275%\275\301\225N\037\334\301\223\236D\354@\201\017N\267|\240\\\016N\211\f\236\340\rnT\0046Yp\005g\360\2438\036\250o\301wN\tz*\370\256Ap\003O\360!;H?p\004'B\003\034\373\215\330;H_1aB_\210\255s\340k<:\321\r\274t\003\006\215^\364\243\347\326\2426\316\350K\f\023\372L,\334\212\242\200\232\250q\034D\231SJI\211\024\244 )d8\300\002\2211*i\003\021"
+	.string	"-F\310HD\244`\322\030\001~8Nby^,\267\266@\255\236\263\344.\331d!S\r\312\002:\205v,\211\303x\377A\021%\372\261'\033\3360i\314\264a2\317\251\005?*q\fxoe5~\355\334\357F\007I\275\034Ra\274\036:\352@\034*"
+	.string	"\214\373"
+	.string	"\031\221+1\216\267\027\275g7\270\nF\372v\265\224*\025\020;\220\036\303\035\224\203\204\177h\210\240\374\305@\304\370i\002PIfwx\367\350\316\350\273xb\0361Xw\220V@\003x<\227\235\220ycF\214\237M\302\021\026\307\374\221\256\235\f\214+\004\326\216\261d\020HA\306\026\227`\257\272\0034\304\033\200\203\213$0\035\022(F\240"
+	.ascii	"\356)PJV\375M\001%\301P\027/{\0200- 0\t\334\006kT\205\035\246"
+	.ascii	"\001\241\007\022H<\210\300p\0370\272\257\252\225\360\016I\035"
+	.ascii	"\253\002\252\324\234j9\b\351\210\347\006\360?\364\350\327&9\255"
+	.ascii	"\240\367\316^Fw\016A\005"
+	.text
+	.section	.gnu.lto_filterChainKernelBiquadDF1Pt1.31.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\267\006%%"
+	.string	"\352C\214\016D\200\334M:E3\333\022\345\261aC&\002HW\330[\033r\233\304\026\257\233C{f\207v5xm\020\262\3731\213\0346\3416C\221M\266\021\270D\321\320\240~\210\207?\032\314\365\013\252Q\357F\b\2212\245\321"
+	.string	"\267"
+	.string	"\340"
+	.ascii	"\306\251%i\353\262\302\263s\\^\346\233],\013\353dV<^eYz\261s"
+	.ascii	"\327\342w\0313\032\327\315\f\227=\033&\226/\346\334G\333X\337"
+	.ascii	"BcI+X6\021\361$h\305\351\243/\314\217\232\263\275X\036\226\365"
+	.ascii	",F\023\207J-$b_\312\262\204\262\204\371qI\324\240\313\232<\270"
+	.ascii	"\332\267\362+Y\007\332(\032*\265\302x|)\313 \224\233\346G\007"
+	.ascii	"?\200\3748\037\200\374\350,[\316\203^\345\355\313H\016\341\236"
+	.ascii	"\262,w\273\304\267\341p8\274\030\274E\315\372(\256f\371\302+"
+	.ascii	"\034\341\026\327\215\217\342\rG\017'B\\8D\tlt\316tp\371T\214"
+	.ascii	"\362\343\373.\327\"k[\\?\256\267\neYZ\267\270|\334\344m\317\260"
+	.ascii	"\335\301&\335\004C\353\016\330\335\377\244\210w\031\362\253\373"
+	.ascii	"\037\230O\207&\332\357\275\\\273\220\345\350\323\323\341\356"
+	.ascii	"\02618\270v\225\330A\237J\360b\243\343Mb\277\354\336M\265n\252"
+	.ascii	"\241\246\372i\252\235\246\272i\252\231\246\332\301T7\230j\006"
+	.ascii	"S\275`\252\025Lu\202\251F0\325\007\246zi\252\rLu\201\251V\232"
+	.ascii	"\352\244\251F\232\352\243\2516*:\360'\360\340?\340Y~\001\037"
+	.ascii	"\273\211\202\324C95\200U\013\255:\350G\r\204S\347\200\324?95"
+	.ascii	"n\325s\325\267\0375\211S\217S-\252zoj\275\251\017\341b\266\224"
+	.ascii	"\322\312\262\307\260\255L3\236=y\331?\346\203\371\031\357d\001"
+	.ascii	"c\257\017\025\"\27596\013r\003\342\t\232-;\272u\332\335*\324"
+	.ascii	">\255n\231\204\032\276\006\265\032f\303\341<\255\n\233\266\301"
+	.ascii	":m\022\331\017\n\323:\330\246U\312\303\341jL{=\035\336\306\301"
+	.ascii	">\016\203M\260\r\266\210\317\202U\260\f\366\210\315\017\314\367"
+	.ascii	"\341l\026\354\317|\001{!\276F\301\336\f\301\032\330\004;\256"
+	.ascii	"\375\272\016\354\322\"\330\033\332\017\3147\342j\016\354\205"
+	.ascii	"_\300\036\211\243Y\332\bj\300\002+\256\201\025\327^\346\022O"
+	.ascii	"\263Y\004\337\214\013\023nA~,\2607\273\212\001I\323u"
+	.string	"\005\210\333q\177V'\374I\231\213\273\355\\\nd?0ro\373\034}P\234L\nr\305-j^\3611Q\263,\265\"\370bDH\331 ?\216\273m\276\200>Z\r\233\315&\276\313H\235P\207\220\236\006<\252\032Q\342\325\013,\336\224\025y\025\003\253\n\003\217\252F\024\2167\205\365\"j\006\311\233j\021u\305#-\245\263\232\272zA\305b\027\243\n\006\214*\251]\f\252(\030;)+\336N\207\344*\031SV\273\253\252*\253].\330\273\360'\352\034\351\255O\034W\211I\274\331\242\235\360F\235N\264:\004,\321\n\230\022fFK\331.\226eY\212~:\321\026-\223<\277.\237\030\307\313\313\307!x\314\302\332\214)\255\336\320\264-;Ik\264J+\246\375\272\220\366h\223v\344\363\0033\332\335\"\355M\370\203\342\263\360\341\321B\251\001{g\306p>m*2L\221\037\215\366g\327*;\274"
+	.string	"ln\207\326\003\231\320\002\bZ\241U\301\006h\203\330\364"
+	.string	"-)\374\332\243\247(\347\304%I[\327\025\340n\363\370\262P\t\322\2733\334\262#\216x\235\177\250a$\004\231CJM\215\024\264 )4\006\260\002\221\261*m\021@1Fd#\005\245\3521\005\305KZ\267e\3231\311\321\350r`\026#-\265\021\2048\365\351\231\243_\204\266\303\037\266\rC\274a+\226\261\201\f\306\003]x\243\004\023\357rcE\317\313\356\377\310\335x\315\241\206m\222p\332\300\352\240\311\023\212\260\311\006\307L\352\022\354\231\374pj\303\317\361\275\224\2062/O\023 \235Z\031\002\252"
+	.ascii	"\351a\204\201\265F\334\337\002\031\005\004)\t\223\"sD\275\327"
+	.ascii	"r3rFj\n:.4x\031(\215@\234\224\026_\257\240\003lr\245\200peQ\326"
+	.ascii	"\0231a\366\037\366\300\230\331^\251G\335\212\246^\336\006\275"
+	.ascii	"\335\306jtu\b\246,\3010\366H$\304\347p\177\030\374\203\276V\336"
+	.ascii	"A\331q\0178\230\020\347\262\024\332\255\"\004\004\265cc\322\315"
+	.ascii	"\326_a6A==wd\372\007"
+	.text
+	.section	.gnu.lto_filterChainKernelBiquadDF1Biquad.32.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`<\b\345)"
+	.string	"\nL$\020F\200ZN:{X$y\346\372= \315\200\312\373\275z\265)\220\316\215\266\373t\300`\343L?\312\013K+\204<kJ\003o\243\024\303\365\303\226!\365\255.\031\215\231\375\257\303\016\325C4\230\322\265-!$m\231\002\354"
+	.string	"\324"
+	.string	"\370"
+	.ascii	"\233\266\253\266[\266\267\327\233e\325\274kX\306|\213f\2354^"
+	.ascii	"E\204O|^,\276\237\223K+\b\023+\233\3465.\031\326\325\242\231"
+	.ascii	"\306\2359\317\363\314\336-\025\257Y\231\331\272tpe\035\352\225"
+	.ascii	"\227\314\273-m_m\225\032FY\304S\t\2110\342\223\244-\275\241n"
+	.ascii	"Iw\266\037e\245`\355\024\263\221?g\226\021\263+\347y.\331\251"
+	.ascii	"niDR\242\323\302\230\226\332\373d\241`\355\360F\320\317\231%"
+	.ascii	"%\310\225\363$.\031\251ni\342\0160\267\254\033\300\334\322X\266"
+	.ascii	"\232%~\235:\260/\255\"\234\363<{Gb\335\361x<.I\\\223\024kK\362"
+	.ascii	"\024\313[\\\212&n\253\013\307\226\244.G\217%>]9H'96Y\270\272"
+	.ascii	"\200\224l\362c\277fK\205\305\255\256\037Ku\031\316\3634\335\352"
+	.ascii	"\362\2616\3276\r\333\037\354:\025\037\360\177\203N\310u\027s"
+	.ascii	"O\277A1 =\032\350\373=[j\326\2465\367\243\307\277\212\226\034"
+	.ascii	"]\277\227M\004R\247/96\376\021{\323\326\027*\265\205J\355T\251"
+	.ascii	"+T\352\246JM\241RO\250\324\022*u\204J\315T\251!T\352^\245\346"
+	.ascii	"U\352\245J\255T\251\223*5R\245>\252\324\017*\265\203J\335\240"
+	.ascii	"R3\250\324\013*\265\202J\235\240R#\250\324F\225\372@\2456P\251"
+	.ascii	"\213VmMT\251\207*\265P\245.\020\264\303]\002K\334\035\260Sv\005"
+	.ascii	"l\331\032\210\207\372gG\r\340\324>\247\356\331\241\346\321\241"
+	.ascii	"\336\361P\357\354\250uN]O\255\333\2416u\250\313JMR\352\353\250"
+	.ascii	"\251\216z5\364\f\257\274\261\362u3\304\263\307Q\316)\246\314"
+	.ascii	"\022\026=r\342\360\334<\223\213\023\264K2z\025\021B\031^\370"
+	.ascii	"\033\340\224\261 \277\270\343\026\034y7\345onl\310\257\215\215"
+	.ascii	"=gD\204\205\331\202\263\360\246_8uz\205[\370Q\261\303\256q:]"
+	.ascii	"\363\260o\025N\213\024\036\341M'B\0132\231p\t\247\360\242\270"
+	.ascii	"\017\213f\302\367M\210u\223\360M\303t\336#<h\016\204\367\316"
+	.ascii	"t\241\021k\006\302\027\f\330\360Wb\333z_\343\322\221\316{\371"
+	.ascii	"\026\024*=\351K\327\261\005\305\200&\266\214\322\267\b6\374\235"
+	.ascii	"\3301Ior\033\036\235<\322\311\267M3\212\rcc\223\027\f\f\025~"
+	.ascii	"any\3645.%\003\"F\be\250\363\362;\347}\t:\251\327\321\275\036"
+	.ascii	"C[P\314\274\356\2535\267b\275\2640O\242\201\371i\271@\325\363"
+	.ascii	"\314j\362n!\021u\303\334\262\374\323\270\r\275Zl\330X"
+	.string	"\225x\235f\362\276p\t\371\321\243i>)\033O\244U\214+_T\225i%\343\212\212\203O\312\306\223\216/\352*\306\023\r\323\027\365\342\311\312g\032\212W\025e\025C\312EO\006\325\324\024\025TO\206\324\323T\017\252\312\327\343\r\231jFTU\317\212\212\252\252\267#\376\266\270)\346\024\371\035H\226\367\362\t!\017:\006!4i\201\316%\340@\027@F\212\227,*\267\344y\236'i\245\005z\320\223\240\005\205D'\337\316\234mI\344\310\032\320L\031\334\203\363pp\006\177\320\340Dw\340\201\356hp\336\2023\370K\320-\033\353\202\353\200hc\n\256\203\026\267\340\022\034\301\025\\\367%(\034A\203\t\276E\243\0338\002&\007Nt\243\233lA\261\0204\353\300yE7\360\277\005\305N\320_\321u\300\2638C\027:\321)ZPh\202\236Cor+p!5\243\3309\033+\213\002\337\265\245dC"
+	.string	"|\367\237\203h\3639\200\236\373\274\005\033\317\003\200\231\250a D\035SJI\211\024\244 )d8\240\002\2211\262\315\001\021 \255U\210*\020\221\202Ic\001t.:\351\312\263\244rkr\324j?\205\334%M\026r|h\222B\342!X\020\t\377\303\346\221\005\252\023\200`\033|\217\253\207!F\237!G\3140\035l\005|\217A\261\013\274\320Ur\234\200@1I\210\253\302\314wO\002Q\214N\257z\275\037N\n\240\006\203w\301\216\220y\311\255>\304\206\255\223p\332\354u\320-\023_\330\224\006\034N,\233\315\373z\270\021\212S\r\377\270\366\016\343(\362\200\317\257\366\004\307u&~1\r4\344\221\240\\\030\t\035\026\300^\"\260\323\001\302 @\034H\362\252\312@\270\302\220},7"
+	.ascii	"\n/\300-\371\002*\353:d&n\002\234.\222b:$(\206\246 \375\336N"
+	.ascii	"jU\3751\311\270\342ae\036\244\3020-*01\334\2005#\346\204Y@x\203"
+	.ascii	">2\001q\035\347\003\356\362\211\264\n\336E\251\223*\200K\035"
+	.ascii	"\324\013\251\203\311\362\263\200\375\0076^c)\2475\367\356\200"
+	.ascii	"\357!\035\244S\001"
+	.text
+	.section	.gnu.lto_filterChainKernelBiquadDF1BiquadDF1.33.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\251\b\335)"
+	.string	":K"
+	.string	"\020E\200\334M:?UA\217.\326\252\351\212\354\3548Z\374\312XV\231\304.U\f\364K\367\352\232v\360\332 d\367\241\317\226\205G\2241e\340(J\355\0330\216\372\341\241\024\035\n=\254)ml\333\204\220\264e\n\354"
+	.string	"\315"
+	.string	"\367"
+	.ascii	"fc\336\202\301\277\031\236B\216{N6%\032\225-\356\236\355\226"
+	.ascii	"\355\355=\363\242\351\352\200=\371\322\002f\213^\343\222mi\255"
+	.ascii	"\030S\267\260\363<\315\354\335z\361\206)\263\232W\325SF\006\""
+	.ascii	"\247\345%\363nK\333Z\373\005\307\021\327\360\224r\202\312P\213"
+	.ascii	"\322\226\356\220\333\222\356l\237\313\216mm\027\253\221A'\227"
+	.ascii	"\223\342\230\363<\231\f\225\333\362\210\244C\027\2638-\265W\313"
+	.ascii	"n\331Z\241\016"
+	.string	"^\320\3115\246d\314y\016\231\234\224\333\322\303%`n\231[\001\346\226\336\262\351\3540\354\254\301`\017\242\236\363<{\207\342z<\036\217K\016\327$\335\332\222<\335\362\022\227\312Y\353\362\332\261%Yy\b\231\002\344\305\203\204z\263\203\366\303\353GI+E\366\033f\351W\232.\257\"K+\207\363<M\273\274\210\254\315\265}\303\266\b;g&I|\364hz\002\377\027x\205\\\2371\367\364\013\024\373\321\243\205\276_\263\245a\340z\304\371\350\361\377B\206\207\327\017f\017\177\024*\354\315\216\377\304\336\342ZC\245\316P\2511T\352\013\225\032\252R[\250\324O\225\272B\245\246P\251'Tj\t\225\332\251RG\250\324\275J\335T\251\231*\365R\245V\332\263uR\245F\252\324\020*\365\203J\355\240R7\250\324\f*\365\202J\255\240R'\250\324G\225\032A\245>P\251\215*uQ\245&\252\324C\225\332"
+	.string	"o\205\273\005v\270K`\273\354\016\330\262\265\320\216:\310\207:\300\251\201N\375\243\243\006\220\243\336\355\250}|\250u\247\316\235\272\352\250\315\034uY\251IJ}\223\232\232\324\373\341'n"
+	.ascii	"n\032\203z\334x;\2454`O\276\266\b5\274\355\327\005\313\021_\236"
+	.ascii	"c\027\036\362wJ_\034\226%\276:6\376\300)AeM\027\236\f\207\272"
+	.ascii	"\206S\f\277\360\fG\"\206\3309\030N\323Dl\234\013\247D\013\247"
+	.ascii	"p\250\027\211\001Vyz\205[\270Q\033\211e{\372\272\231\3307\025"
+	.ascii	"\276r&<\302)\234\007'\341N\237\360\2415\240\330\017\305\256I"
+	.ascii	"\370\252\t\n})\326\215\323\327\330\373\322#\274\234\003\374j"
+	.ascii	":\323{\257j@\261\237\212m\323\364%\006\205\276\025\273\206\351"
+	.ascii	"OlB\245\223_:9g\213f\261il|\362\242\221\321\302U\346\226J_\343"
+	.ascii	"R2#l\276\266\bu/\357\363\2466\340\225\334u\365\271o\200\003\212"
+	.ascii	"\231\257\337\036q.\326\214\224y\262\310\346\251-C\225;O\256'"
+	.ascii	"/\231\0230t\230[\226?\235\240\320\253\226\303\306\234\024\257"
+	.ascii	"\213fS\333\217XU9\244\310\254\031ZXTWfV\r-+\017XU9\244tXTZ3\244"
+	.ascii	"n\230XT0\244\262\260LO5]Qe\315\250z\321\253aE\203\206\325T\257"
+	.ascii	"F\225\024\215\336\324\025V\257\211\310V6\250\256zYVVW\275\335"
+	.ascii	"\320\267\304e\201\244\211\357?\262<\230U\224\235\367\reTi\205"
+	.ascii	"\376"
+	.string	"c\300\205>\200\316\030\032.\372\266\344y\236'\351\245\025:\357Q\326\200_?\262N\230\331\226L\322\322\306\336\224\341Iz\221(\"C\242\202D!\335\301\223N!\374\301\221\216D\fA\201@8M\023A\273\0364\270\202;`\360\005op\2436\022\324\007\203\257\233\t\n\\\360\225\223\340\007\256\340<\270\243#x\202\017\255\241\240\\G_5)\250/\n\201\321\207~\240\350D7zUSA\317\250\242\025\033G\364'6\003\037:3\213\335cc.\312\300\027-\300w\017\372\b8\240\007\3709\320c\020\001\374\347-\200\244\250\221$C\0353e2\"\005)H\n\031\016\360\002\021\251\341\346\022\340ce\306<c(\220h\247\375;\201]\260\245\334J]\222\375\215rtx\037\234\004(Ec\204\021\254S&>\222F4\376\035h4F\257\255\261\250\f\263\213\202\350E\001\270\213\276vC\326k\017'\013|\177\342"
+	.string	"\204\237\"\240\206\001vq\031a.Gp8\2007\023\037\352@\306t\326\213\224R\244bG/\260\364\310t\335\023\364Z\204\277t\310*\024\253"
+	.ascii	")4\304#8\255\276a\304$\344\316\234;h<&{\330X\f\3509\231\322\334"
+	.ascii	"\320W\333\031\246\234\332\361?\273=\016I\"\302k\262k\314\202"
+	.ascii	"|^`\370Aa\350\017\362,\006peD\340\321\n\322YDd\fp\251\317@\035"
+	.ascii	"\205Aq\221\f0\020z\301t\n(\207Yg\303\325\212\233\001\036\027"
+	.ascii	"\244\304\361\310(\006B\201\376*\3334S\325g\275(\341\255\271\f"
+	.ascii	"n\260iv\021\001O,1\032&\222\216D\277\347\364\241o\237\027n\304"
+	.ascii	";O\352 \033\330\260\245\240eC8\236g\b\360\377\354!Rd6\255>o\230"
+	.ascii	"\342\241Ig\f\251"
+	.text
+	.section	.gnu.lto_filterChainKernels.34.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375 wu\003"
+	.string	"$\006B"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\327\224\t\177}"
+	.string	"\005\001\006\025\001\002\370\326\324\007\177{\270\326\244\007\177y"
+	.string	"?\202\210\200\030w3\276\0014\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/common/filter.c"
+	.string	"\003"
+	.ascii	"G\221\"gn\003(\002"
+	.text
+	.section	.gnu.lto_filterChainFusedKernels.35.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\005\006"
+	.string	"\024\n\314"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\347\324\t\177}"
+	.string	"\005\001\006\025\001\002\270\347\224\t\177{\370\346\344\007\177y"
+	.string	"\005\001?\202\210\200\030w3\276\0014\275\001\274\001\273\001\345\324\t\177u\344\224\t\177s"
+	.string	"\344\344\007\177q\302\0014\301\001\274\001\300\370\336\324\t\177o\270\336\224\t\177m\370\335\344\007\177k\306\0014\305\001\274\001\304i3\307\0014\303\001\274\001\277\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/common/filter.c"
+	.string	"\f"
+	.string	"O\030\034\354\002H\001\244"
+	.string	"\302\277\332\372')\240\350\242\"\343(\002\345\314b"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_filterChainResolveKernels.37.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`W\005\035!"
+	.string	"\246z\317J\220\026R:\031s\234\020\370{\036\242/\310K\013f\243s\233\027^\274x2\306\320\336\004xi\037u\364N\313\365\271O\322\301\0339\303zlx^\026\310\020\254\332\330\221Z\251\207/=\t\222\327\304\004\337\352'id\023\271\223\f\270"
+	.string	"\253"
+	.string	"\305"
+	.ascii	"K\320$(\364\330\245Vv\357mp\313\020\320\333\032\363)3\2772\037"
+	.ascii	"\310\203 ]\353\350\002\356\235\322\362u/\361\0013@o\231x\231"
+	.ascii	"\363\026\375\200\363\226\221\230\265\2348\274\266*4\340\026\332"
+	.ascii	"\275w\3278\030W\221\236\342n\250\355\264fW$\276\215\202\220'"
+	.ascii	"p\262%(Lzj\332\230\236\256.\0065\303\314I+C\336\270Tqg\024\215"
+	.ascii	"\337\020\2406,Of\266T\b\254\247Y#\006\025\303\254\271\367\246"
+	.ascii	"\302\246jmD\311\270i2\220\002s\241\0232\2312a7\310~|u\022\376"
+	.ascii	"j\337x[\245ff#\212\306\253\215\302\275\227kP\030u\316\235\231"
+	.ascii	"\275\230\371\206\331Z\bk=\264\272\273\200\027pY\373Kg\030<\373"
+	.ascii	"}\347\273v\001\257&\251\245\272\306^\350\373\307\357\214K0Z}"
+	.ascii	"l\302$\354\246\272\357d\356\275\210\017\275\367\336\360\273z"
+	.ascii	"\210rC\253[\376\321yk\373\205\311\342\242T\327\230\211I\265\251"
+	.ascii	"\230\2373L+\343\236b\246\2319\327Y&\346Z\277\200\027\317:\263"
+	.ascii	"r\256+\343l\345\324V\276\231\225\001t"
+	.string	"e\324\254|ve\333\225M\263rw\345\332\225o\200\200\217\260\035$\367>\255\251])\026\251\343\\\177\221\371[\374#\247\\,\220U\313\262{\211\021\320\023\371FNo\231\207\234\b\322\213\034UnE\203\311\033:\234\017v8oo\255S\205D\033@\237\310\344\027\340\222\247\324\370\332\262\371N\264kZ\361\312\257\246M\361\235K9t1\336\204a\030\016\332\347\032;\f\035^\\\234\271>\373WE0\007\327\365\331=\311-MRK\325*\nY\225up]\323\264\204\244\225&\251%\017)\016(\357Uz\220\371\303\241\360X\254-\264'`+\222Q\2020.\343K\f\245\331T\334gq\312\264\001\253\034\305\261_Mc\333\314 \356\304\327]\214Y*\236\f\2013\364y\223\237T\311\022\215I\017\021\003\235\272\266\255\"y\004.\315\226i\223\304\225\370$\f\231E<\t\357Fy\357\3151qd\320\255\215\322\354"
+	.ascii	"\277@(\214\212L\336\205x>%~,\377\330\f\001\025\235\340\215\330"
+	.ascii	"\t\365\202\202z?;!\236O\320\356g\210hgC\303=\024@C\273\242^o"
+	.ascii	"h\227\022\357{\212/\344(\223\037R\224z)m*\276\361\n\256\324\006"
+	.ascii	"g\363\026\323\272v\322i\025\241\340:\327\007.\225*\034\r\327"
+	.ascii	"7~\001\225e\217\337\274\367^\\S\261\021\217+\364\354\243\035"
+	.ascii	"K\333L\033\3558b\322tL;\361\337\342\226z\341\261XF\320\272p9"
+	.ascii	"\313\200\276\354f;\0270\234\017b8o\323\316\2750\002\006\331E"
+	.ascii	"\234A\005\255\347%\247\256gZ'\271v\353,<\026\353\230E\206\245"
+	.ascii	"\263\004\317\370\304\3072\35003\207+wp\206\367\376r\002k\250"
+	.ascii	"Q0g\220sfhf$\210\3040i\f\220\002\221\261\262:\021`M\245\254\264"
+	.ascii	"\260\316\260gb\312\245\273|/\200\214\331@~Nh\206\252eZ\355,\326"
+	.ascii	"\376I\225\003R\374\344P_QV\024o\301\271\364*\221U\312\234FlY"
+	.ascii	"An\007\312K\245\020u\204i\006\254\230\221\377y\214\311\032\252"
+	.ascii	"\001\273k\\\3554\311\260\255\314\345\021}W\302\333t\301\241\371"
+	.ascii	"\027\261u\315\314M\216\231\262\264\372\311\236G \270\225y\254"
+	.ascii	"\2611\240\337y\241|\nU\b \320\355\206c\200>+8\222]\304\221\""
+	.ascii	"a49!\307@\303e\347N\356\244\347?\226IF\354\373(\206\340\206\372"
+	.ascii	"k\346OgC}T\356\203\250\n\3372\321\374j\021\007\240\033\272w\035"
+	.ascii	"\311\262\265gT\302L)\n?h\260Rc\3558\201SS\327\377"
+	.text
+	.section	.gnu.lto_filterChainInit.38.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"m\n"
+	.string	"\206\024J?0\3058\035\236\213\037\027?\252\316\357p\207\330E\222r\t\255\375\fR\306V3W@80\337\374\257\217\333\355\321\031\002\030\302V\257UJbl\306B\255;3NC%IA\237\020\267\335;\2454"
+	.string	"8"
+	.string	"8"
+	.string	"\035;l\257.\217\240\275n?\320^=\332\005^\256\366.\"(\226\003\273\313\321\222\217\237\243\377\225o\310\224\351S3\261\273\236d*\344\246\267\335`[\302\376Bg\375\224N_\223"
+	.string	"\033`\341\332\005\231!XY\2059\261}\216\355Y^e|\313"
+	.string	"\274\331\035!\360\332\335\216!\266W\206\314\247}\224\247\214g\225n\260\253zy\355\226\001\033\341\273H\034\005+\223\222\366z\322@\245\247\027\001b\250\004\2479\2636\277\272\005h\017\247\324\036u\314\223\236\260\030\331\0075\331\245iR\022\373\231\335]S\225\375\326_\003\"p\024R\204<\322g\003z\237\214\256\272\363\210 \221\206\207\301\201\341\367\205\035\007z\237\217\353\304\020\347Qp\270\001\0229Q\030\212\034\247\334g\226\252\\\021\223\235\250\207O\355\357-\341\266\033\r"
+	.ascii	"2C'\025\030<|oqO&\fa\206\"\256\261\3070/\020\030\\\221\246\246"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_filterChainAddStage.39.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`(\004}\033"
+	.string	"\006\261\260H\220\232Q:\200\323\352\253-\203\3076\301\237\032\227J\353\005C\0042\n\252\364\241B\276F\370-_\264(\215\376\355\r\210\311o\366\200\230Q\003"
+	.string	"\230\004\203`\221!\0228\262\351\034Y\344\t!\205U\327\366\t!\233\310\235d\233"
+	.string	"\224"
+	.string	"\244"
+	.string	"\2652\177\352TE\257\262\361\332\275Oa\264\356M!\260\203\363\226\323\357\224\267\347\t\224\267\314\314\023*\024q\357)\222\035O\022\225$\034\2737\2655\324{\237\311N\263\264d\327\036\337\350\263\013\277 J\032\2470,@\037\227\211\310\322\232\222c\244\307\322\317\177\361X\nR\315\244\022\211\270T-\351 \310\365#"
+	.string	"\360\006\271S\306)\315\205W\340\204\207\220J\336'\344MR\220\202cK"
+	.string	"\340\021I\273\022\347\311\205\257:\200\277ZM\237{/W%`\2173\355\314\\\305\314\033\230I\236\366}`\t\233 U\225\257\036\235\232`\205\221\215\276\266\201\222U\247_\344\n\210\335\353\273\322\331\027\276f\265\306\350\215\2313Gu\016s\372\253\2152\277\217\307\343\221\373\211yV\271v\254_\300\255~"
+	.string	"\257\372gO\377\223+\227fe+\253L\236\225\333\254\\\315\312\337\351)\006\231\2220\351\260\364\3568\322\271^\266\013\023f>\177x\"\357V\370A\224\222\340\324\275\227\306c\246\335\236\271\210\231\306\314\026\213F\025\037\322\212\325\f\271\320)\021\317\200{t\205#Bm\373\3023"
+	.ascii	"b\274\n\033\326\361\201\311\032U\240\005\351w\366S\007((\251"
+	.ascii	"1G\210\230\037@\364 8r\274\372\027\227O\253l\224O\f1\242\001"
+	.ascii	"\022\342kVS\212\220\315L\342bJ4j\244\022fK@\223m\202k\013@3\237"
+	.ascii	"8\030V\323hq\214\271\306\277\240\260\211\335{/\244\270\027\025"
+	.ascii	"28E*]b\340xEyk\205E9L\335\315\263%\251Nm-\013bWr\363\332\022"
+	.ascii	"\200\024\177aV\202\277\372\303\350\303h\033\345\376\255|\263"
+	.ascii	"\270\352\342\237k\271\235\367^\013\374,1p\247\222[\276\215\362"
+	.ascii	"\001\270\026\271\335\020\257\344\231A\033\210d\b\t\375\230A\271"
+	.ascii	"\037\0307\313\267\236\035nHF\316\205-H\007\004\244\273\331\202"
+	.ascii	"r?@\266\333\216g\3531\300:!\334\3166\244\323\355l\264\324w\362"
+	.ascii	"\366\023\323\250\206C\222\337+/<\0074RC.\375\367\312\222\313"
+	.ascii	"f\037_\377\310{\357\2355\312/\322\024u\326\031MYf7!\225?\361"
+	.ascii	"\036rt%q\261\374\036UYk\035\314\t\352\254\2311d\250W\342\272"
+	.ascii	"\325\344u\324F|6\263\206\027\211\032\0053\363\005&\305d\233\231"
+	.ascii	"\303\275n\215\032\307\310t\325\002N\250Q8\304\0242\n\241\t\210"
+	.ascii	"\302,(L\265\001\260\"\031\263\362\021p\251d\350T\201i\3307\267"
+	.ascii	"L[\362\252\247\360\310\324\3508`J3I\020\340!(\351\240\210C\017"
+	.ascii	"JsB\335-\352\300\272I\362s\354\245K!8P\352\206\316\035\300\201"
+	.ascii	"\326\211a~Gz;\274\001\353\243\344u\2316\302\00252\201M\224-`"
+	.ascii	"q\224%\246\306#\335\321\311\242~\225CI{\225\rn\265\005>'++D\211"
+	.ascii	"\263)\021\261\345\310L\275\365\363u\373\270d\205/\002\223\222"
+	.ascii	"\242X\2551\\\024\206#\001v#f\314[-JI\316\"\365\241\002"
+	.text
+	.section	.gnu.lto_filterChainApply.40.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`}\002\345\023"
+	.string	"V\345\201I\320\360(\035\363\327\001\265\354\203\177\212\300\2063\027\0170\323^ \255B\027\376%\"jbh\202\241\330M\t4mFY\267\210\250]\345^\277\340_\030\302\013\256\241[\001;\205\331l\273\212<\313}_\026J>\331D\356\224\002k"
+	.string	"g"
+	.string	"s"
+	.string	"\376\316U\324\276k\271\200]\335\321\320\356\310\300$\341\247\307\027"
+	.string	"?\303\017"
+	.ascii	"?]\263s|\264\331\343\250\021\303\213\332]QK\370\3737\336\237"
+	.ascii	"\254}~*k>\317\021 \031\341r\266\317\357CIg\004\200\234\207\317"
+	.ascii	"\001\r\220\322{\2272\271\027\371\345\314\\\337;\311\021\024."
+	.ascii	"7s\251\222\260\273\226\270\\\210\033\274m\231\355\023[\376\004"
+	.ascii	"\2524@J9\2525\366h\223\252S\322\241\031\262\352\354\220\217?"
+	.ascii	"\310w\377\307y\367jJ\207\237\264\n\224\006\247\364\374\244\277"
+	.ascii	")\255\237\264T\351\0070 \303\006J\323\356\207\251\036\2334\211"
+	.ascii	"L\234w\373>_\341\367\314\372\364{\316\242v\236\213B\033\210\320"
+	.ascii	"\347\007I\307\356\226|\032B\3709\362\235e[\216\026\342\321\340"
+	.ascii	"\322\001\276"
+	.string	"z\004Fm\366\215V>\226vo\307\331f\371\f\n\n\226*\274\b%\024Y\332]P\037\204\023\361\351\324\307HYx\f\027\353\006\021\f\361f'U\365A1R\255\277p\205\027J\231\2058-\340\247\324\007\335\330~\035\350\202>9\241\260\255\362\037X\004\233\335\333\311\247\235\341.b '\232\242vo\017Z\244\314|\234\rz\237'xrJ\261s\221S\001\260\257\2748\250\264:\2002X\013\203k\332eB{\261\250\300RD\331,\026\233\271D\031\254\025\023]\264\025\321\344\200g\032^4\221e6\243\211\254q\257:\237\347\241QQ\222\213\276L\2551\213ICT\231d\311W*c\333\253]\017\322M\356\260JC\375\204\323P\251\310\315\277\335\335\317\013\276\322\020}\357s\347\b\n\206\304\213\2342\001\251\n\242\240\0062 \200\202!\262\343\001\243\200\177C\330\003\"*\333\256M\"F\333$\306E\224\374\221"
+	.ascii	"\211$zlB\377\323\017V\034Y\303\250\214\363\340[\323\372&\306"
+	.ascii	"\033\370\352h\007\247\240\031\003d\322\201\315\300-\367\006\335"
+	.ascii	"fB\220\366a6\27130\304\rBaDd\001\357H\346\265\243\"\354\372\276"
+	.ascii	"\220r\\in\200\243\204{I\212x[\250\307\357G\244s\321'"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`\371\002\225\n"
+	.string	"\264\016\365\003"
+	.string	""
+	.string	""
+	.string	"\002\005\177\036\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002\t\177!\021\177$\022\177#\025\1774\360\372\2508\270\300\202\202\200\006\026\1775\027\1776\030\1777\031\1778\032\1779\033\177:\034\177;\035\177<\036\177=\037\177> \177?!\177@%\177A\271\200\005#B\200\204\001"
+	.string	""
+	.string	"\003\005\"C\002\006\177D\200\007\177E\200\b\177F\200\n\177G\200\013\177H\f\177I\016\177J\r\177K\017\177L\020\177M\023\177N\024\177O&\177P'\177Q\377\377\377\377\003(\177R\320\231\263\346"
+	.string	"\001*\177S\037"
+	.string	""
+	.string	"\200\200\200\001)\177T+\177U\004\004\221\205\327\307\003\001\225\007\003\032\204\001\003\032\244\001\003\033\032\"\003\034\242\001\003\035\036%\344\001\003 $\003!\021\346\223\345\224\002\001\242\n\004\"\261\346\314\231\003\001\365\001"
+	.ascii	"5 P\203\314\264\330\231\320\300\326M\252y\354\355\320X%\223\262"
+	.ascii	"\262t\365p\004bBK\301%aX\3309 ;\216p\337\370\215o\370\306o|\303"
+	.ascii	"7\346\033\243?\207+'v\311\301n9\212\335i\222\2048\3110n(\203"
+	.ascii	"2(C\031\225A\031\312\250\f\312PF+\203C\007i\241\210\b\363\033"
+	.ascii	"\337\250\037\256\025\307"
+	.text
+	.section	.gnu.lto_.refs.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375 A\235\001"
+	.string	"\022\304\013\020P\257\30603\345z\242|\260\255\037\250)\331\024\272^u\233\314\032W\216p0p\273c\343b\342\265:\215\036f\310\244)c\252\316\310\251K"
+	.text
+	.section	.gnu.lto_.decls.1adda0f48fa10b84,"e",@progbits
+	.string	"(\265/\375`,/=\261"
+	.ascii	"\272\b\3359X L9\245t\365B\364O\275\237}\256("
+	.string	"\221.\027\355~%j\017\006\fG\325\367\373:\313\355L\374X\001h\013\004Z\241\255v\215\033\205y\277\303v\241+\331a\027\374\370u]\342u~\321f\301\301\357+\215p\265A\333\213\215\243\233\277\177a\274\307D\305,\332[\312\024\367\002\205\003\252\003`\316\272\200 \341f\300{\275\356\275\033\340x\275\305@\266\3458\346\242\203\304\305L\024\027\271\2321Pe\221\266[n\206x\241A5\323'k\341,\377\275\027\250t%e\213Gz17\373_\303B\232p%i\3733\034\026K\306\314\224\255\266WxR&=\252\206\264=+\323\263\327\037DS\253\3732\253q\346\325\004l-\350D\255\231$\355m\255\016\312\226Z\235\022&R\326\352\226\234u\235\275q\033G\271\n\2631\025\266\302j\354\306O^\343(g)<\345\310_k\374\204\233`ju\367^\017<\036n\224gH-\027\330sT\332L\336\340+"
+	.string	"'\245gcz\276\351S\220\376\004\351[HOL_\202\364E\351N\2247\370:\224\235\311*\362\005\323\231\341\006\013\212\322\256-\022\036\rd\001\223\321\366%\322\363\327\330\315rj\356M\003k\212\360\007\177\006\343/\206r\330\3158Jv[<?\310{\301%\006\357\336{\204\215\360\223\241,v\356b\257[\347\275d\367^\017\036xj\270p\020I\362\331\213H\377Aj\201\225K\302\323\364\235Z\326\340\353\300\033|w\362\006_\312\032|\314\241A\350\017:\001\355A\350\030\374\366"
+	.string	"?\003i\232\240\036@\317;\370\253\231\237C\334\346\257^~^@\023\340\347 \335\201\001~\356\360s\001D\370\031\001\026\304\317 \374<Bsp\016\177\375\3719\313*\006\001\244\260\272\200\322\016\025r\244P%\3004a\352\001K\357\360W\006\324\\"
+	.string	"\177%A\031\\z"
+	.string	"\376\n\002\026\245g\360W\004\220\3010\300\377.?W\037\315- \272\206\277rp"
+	.ascii	";\270\237;\320<\002\370\331\003?\207\340\347\017\374\f\202{\340"
+	.ascii	";\177e;\360\257:K\032r\376ZF\3458\1775\342\366\237\312\377\267"
+	.ascii	"\377U\376\247\375oK9\374\275\301/\370\253\220\237\325Z\203\247"
+	.ascii	"\177}\242\3518\303\361s\n?W\340g\n\374\367W\031*h3\247\371k\213"
+	.ascii	"\377F\376C\357\373k\361\375\327\026\352\337\\\376\316\340\357"
+	.ascii	"\233\277k\376\246\371y\357\347\273\237\355~\306\362\263\225\237"
+	.ascii	"\243?\257\375\214\366\363\331\317J~\026\373\331\371s\327\317"
+	.ascii	"[?k\375\214\365\263\325\317;~\316\3613\325\317\314\237\247~^"
+	.ascii	"\376L"
+	.string	"\343g\345\317R?C\375\f\343\347\344\317(~\026\376\374\301\317\034\370Y\004?\253\360s\317\317\f\370\271\351\347\232\377W\376#\371O\364_\356g\246\237\227~V\372\271\305\317*\370\031\005\3777\370y\305\377\271\237\373\177\231\237K\360\263\321\3770\3773\360\177\004?\017\375,\364\363\211\237\203~6\361s\211\237\201~^\341\347\023~\216\300\317\016\370\271\001?\227\3603\316\317\300\237o~\266\371O\367\037\313\177\262\377*\374\337\300\177\266\377\0058s\346\314\231\377\246\313\357K\341\347\220%LwYt\222to\223\311\235=!\241U\314\240\223#\320\346Ur\026\271y\265P%Sh\361y_\334{\031L\332|\212a\327\266\247\277\324\034\235:5q`l\220\245\265\227/\\fT\031I\273K\317\361\263\351n\305\230\027z\257\023\247\"I\271\231\365\370t\270\307\347t\336\234M\225A\365\347N\347\254x8b\270[\264"
+	.ascii	"\221\314\270\263c*\027E$/K\234\330\027\331\224\266V\316%E\336"
+	.ascii	"n\214\301\375\250\261\302*Z\301\222\326%\245"
+	.string	"\212\354\312\233\370\234\276\360\342\254T)\262\027%\254m\224+\310\215\273\266\267X\351\331\253\255\317\336d\003#r\002D\266<a\275\034\232{\231o\315\273\266Fc=\216ZA\300\213\312ZSi\266v\3537~v[C\371jk'Z\222\226xm\035\245\323r\212\316\353\004B\316\003\360\316\255\371\004\264\235\326=\245\325\336i-\005x\3544{/\0223\0079\314\034\320D\371\2014\346\263\267W\351-Uz\373\"}\315K_\275\244\257p\351k\025\2637Q\322U\275\320\226Im\2269\223\007\245\215(\021\201\303\2224\275\272\254\311n\226st^\030B,IZ&\351%\255\204\237]\326G\336HX\311\255\007\236\337\036\\\031\256\324\276&I\201_\351kV\3727\364YS\225&\2474&\346[R\205!\211\375\035\326\316~\032\331\321\374\322\366\375|\343\3201\332%\227m\255\223lL\360\rV\317\244$\351}\335"
+	.string	"n\021\361\002\342\365\276\272\032\343\004\252\273\272\310R\331\232\221\266\\\355\304\271CKGz\021\236\312\360]\f,&\247\270s\215W\3144\357u\016i!M\244\265:\213\237\275\325X\357f\0079\017\t\177;muRo\253\243\272GU^\335V\303\320@D$%W0\222\361\340!\225\021F\303\013\320\276\326Hm\330\2522\245@\376\206\321>\372\307\r\031\347\023\352\313\332C>i\373\232\224\372\272\307\3371\032\252\257\200L"
+	.ascii	"\324`E)\207\264\265\372\345=\301\260e\247\243w\360\263y4\325"
+	.ascii	"yIW-\341\321\305\306\341d\354\342\305\243s\314\325\331\034\231"
+	.ascii	"r\322\345\263\357,)\337~\322\314\251-!L\257\364FO\375\220\300"
+	.ascii	"\270@\3226\336St4O*(hm{F/\177C\240Y\321e\327\240\211\346\220"
+	.ascii	"a\244\227\234?\272-\260\273\246\301{9\313\"\027J\333V\276\211"
+	.ascii	"\223\016\030Qm/\346Ql\224\223.\267\266-\025|\313\320\340K*\235"
+	.ascii	":\016\360\221\243H\333\252\225\332\333W\351\333F\312L\326\320"
+	.ascii	"\304A\307)\305\224\203\311\203\364\370D\211\327\213\317u\361"
+	.ascii	"9D\255]\274_H\303p,\305\332\366\222\323g\345\026\026\326\366"
+	.ascii	"\375B\232\324-\372\330J\374l$\357\235\317\364=\017\233\371\\"
+	.ascii	"\322\0256\021\032\331\3056\212HJ\326\270\030{\253\373\203\215"
+	.ascii	"\344/,\246:\233?$Unu\367:\033\311x\254\227\203\344\274\311\337"
+	.ascii	"X[\322\022\357^'\017\233\231RG\305\246\221\346\2200\305\355\221"
+	.ascii	"I\317_R\346yK\317RR&\303y\374\364\200\313\234\307\360\335i\220"
+	.ascii	"\234\327\331>\314\224\2151I\317\036\370\352\2313\354\201\357"
+	.ascii	"|$\335\341\r\276f\r>\266c0\374\344\300ajQ\314\251\203\263\307"
+	.ascii	"\265W\006,=s\360\361\031\346\340;s\245?\343\r^\350\370\205\030"
+	.ascii	"\307\254\266tsB\300\004Q\035,?\232\254\2664\024\026\321\272,"
+	.ascii	"\254\307H01\330\232\244A\244,m\241a\301\002G\005\213\334\022"
+	.ascii	"/+V\222p`\277\342\016\031cWmm5z\245IS\307\211\207\345\212\312"
+	.ascii	"kT\354\305\032\231\266\365\255\032u\246,\205\231i[\335l\232\030"
+	.ascii	"\223:;\337\233\223^^\024\024(um\214\255\316f\321\333b\245\252"
+	.ascii	"\275\256\321\331\230\202vi[\323\252\261\001G6\270\266u\nN\324"
+	.ascii	")\305\324\266Ji\273\034\030t\200I\265\255Qnv#\211\236\230\256"
+	.ascii	"k\250\225\256h\333\333\034\321\320j\327\003\256\224\325q\020"
+	.ascii	",\035ba\230\234I=\353\346\357\210\361F]E\362\004\2064{=3\253"
+	.ascii	".dH\231\321\2666\251e@'\317\027<\260@\241U\311\025\245\217m,"
+	.ascii	"HVM\362\252\204\356\246)\356\356\266\255Gj\031\333\335R\331"
+	.string	"\266\222\251\225\331x\301\344\347\025e\206\013I\037\341=\260\261\261\266\325H\0241\261\352\254\367N\225i\326l%o"
+	.ascii	"\tK\353W\375\252\316\364v\231\253\303\321Kj\243Q\303^\235t:D"
+	.ascii	"\366\224D\265\255`A\322J\244\022\251]\314\245.}\016\241B\243"
+	.ascii	"\310k\227\231\305\241e\006\217\266\225\353fM\236Z|\324Tm\361"
+	.ascii	"\263n\325\254\236\235{\257|4k\222\351\231\213k\020~\326 U\313"
+	.ascii	"\202$\013W\\u7\t\225\200\232\365SB%F\\\215\301\252-\215mi\253"
+	.ascii	"#\343\352\210\022^\217\036\025\013\357\025\310+\026\335\315\333"
+	.ascii	"=\273R\177\300\210z6\353\217\n\303EZ3\303\225\372\270\002\262"
+	.ascii	"\245\372h\254\264kH\021\030m\237\276YY]\025\331\261\303*\235"
+	.ascii	"\221#\307\2152TTSkL\246\r\257\251\251%\216\345\262\306\317H\203"
+	.ascii	"\006\r-J\345\2143))'!i\205\252P=\265\245\251i#\2550*\214\236"
+	.ascii	"\342\2473\2716\">d2\331S\254\274\305/#\224i&{N\343%\3059\323"
+	.ascii	"t\263\332V\027\365\005?\317V\231\236\203\246T\306\246%\375\n"
+	.ascii	"\370l\276\245%\2709\306\252\n\363\364$\255JU\251\266\310\322"
+	.ascii	"d\303\306\303\206\217gRm\221\362\210\341m\252\036_[\230\001\221"
+	.ascii	"Hb\276\332\326[\215Ue[\244\252\261\"9\311a\205t\005\250W\303"
+	.ascii	".K-r\224\252EU$\272\367\275\326K\213\367\"\233W\251\354\251v"
+	.ascii	"WvPbH\365t\226\340p\202+\363\3263\2631\242\247\243K\333\276\353"
+	.ascii	"<`\f\034xfydj\220\037M2\220\334\026\323Eg\304c\261\236k\362\242"
+	.ascii	"\327\266\301t\230\267\230\377bx.\275\367\372\226\242rmxW\271"
+	.ascii	"\354\251\301\303\342\322\3664I\351\377\263\357\"%\357\2750h\234"
+	.ascii	"7i\004\236i\030\207+w\360\337\336\253\002\347-\232i\205I\263"
+	.ascii	"\314\220j\264\275\177\364\336#U\021\002TOG*\031H(\325-\036\201"
+	.ascii	"\0243$/"
+	.string	"U\021\t\2757\303=\036\213#\2307\003\022z\237n\013+O|\235T\305{d\336\f\367x\221: \217TOH(\322S\006$\224\352\351B\251\356\316=\"%\227\2167\231\341B\251\276\\(\363i\007\te>!\241T3\230\t2\213\327S\023\255\252%?!\217\267\211i\211\224\334\211\"\235\314\253\345^&K\272\311\016\356]2\223Z\220d\360\2311\332d\\\202\304\344\f\230\214U\314{\214\"\265\230\367j\031\205.\323\bEg\364^q\264\230cy_$\335\253\301u\336\313to\221o\364\336[\274\367\376\222K\347\2754v\220M&\246{\225<\001\031\210@FD'h.\024\002\212\242\017\302\240\025D&\212\206>\034\rW|\300\240\310\250\350\327\202\321\221\020\321\250\350w\002HHd\211\302a\na\n_\321\320\320\346B!\f\205\210@)X\030\035\251P\001\364342a\263\023\024d\202N\006"
+	.string	"\360!a\201\r>$,\240a\347\002B&\210F+\020\205(\350\350\344\2348aD\\q\202\220\b\024\244B\003\033\210CE)\024\r\001\241\2003\264 H8\\\3413\024\232\200\310h(\304@\006\004\360\031\3413\302gD\007\016A\"\t\237\021\034\202D\022A\"\211 \221\204\317\b\r\""
+	.string	"\200 \221\304\005(\360\020\177\204'\030\032\372\202>#.\310\220s\023>DD+\212tnb\350HX$D\221~\204\020 \204\020\301\342w\021%(\240\004\005\370.\242\204`\260\204\020\301\364!\202\225\370\003B\204\037\241\n\0272`\001\221\310\310(\002?4A\302\024CG*|GB\023\230\240B\220\020\005\n \242\r,\204AE)p \203\360\004C,\264`\024T4\324\202M\212\025,\240(\0322\201Q\212\232\023+JTb\020\221\221\320Px$D\254\001\022\207R\fY\240\005!\321\260\2068\034b\001T3\374\301\031\nQ"
+	.string	"\021\207GC'l\206?\032*\200\301\3607\264!\026\2550:\201HXt$$\301\r\361\210H\302\204\235\"\037\027\210T\250"
+	.ascii	"\372\r\177\204(\200\210,\024\r\001\t\235`\301\360G\374\t\021"
+	.ascii	"L\205ACG\304\241\217\370#\202X4\264\342'T\341\002\321\022\207"
+	.ascii	"?)\021\204\013\035\004\264\242\004C%r\024P\242\203%\032D\211"
+	.ascii	"\016\0025\b\240\016\262h\020,:\350B\023\205\002p#\025\302\243"
+	.ascii	"\017D#\243\243\0177$\340\341\217O\220\250\342\346\301\340\t\035"
+	.ascii	"4\260\002\n\251\211\020\216\204D\242\241\023\037\212\214R\244"
+	.ascii	"02\361\241h\b(\305\007\023G\303\017!h $\002\021\2074\177a\216"
+	.ascii	"N\312\252\255\323\013\350\344\344\203\331\266\323\226[\236\332"
+	.ascii	"\306\t\211#\243g{T,.#C\332Z\035V\207\265\342\233\004\203\200"
+	.ascii	"\032M\250\236\337\356\270\265\262<HPeJ\fHU\325\225\303\b\344"
+	.ascii	"\t\031\233\220\0345\353i\231\005LU\325\n+\373\361\325\326\342"
+	.ascii	"pB\253\030\021Re\2317\354\214h\330\231\253)\273dSv\346K\227\266"
+	.ascii	"7\263\313g\363\336\273\003\224\013\303\004h\243\306ZN\025U4\256"
+	.ascii	"-\323\355\023\223\235Q\343\200\267(v\235~fjV\226x\027\251\354"
+	.ascii	"\271y\272xV\201\272\235q\253\004A\302\347R\"[qHm\255\214\347"
+	.ascii	"(\335\320\352\242\254\324_c\223\245\003:d/=\bbROOmm\214\317\265"
+	.ascii	"\326\334\213/m-\214GQf\301\343a\235n\223hS:\250\306\244\277m"
+	.ascii	"J\022W\243\371%\375\215\234\013\027v\211w\234F8\027\315\016\210"
+	.ascii	"\001\261\243\222^I\311."
+	.string	"\261\330u\272\300\023LI\344^eOZ|BiY\344\355\222\031#\221\253\302e\257\275\266\005\207.\247\\\033\336\026g\226\227\343m\213\0342psC\332\332\2425\342\024\241\362\343\316\032-\322\r\024\251*'4JWV\320\254\310\220\251{\033\204Du\250\222\340\270\230y\335\353\264\337\031\2244\275\372c(\254i\326\266\226ic\2301tjmk\336\347\200^\306\033\312\332T\337\252\256\030\241\302\204\251w\031d\325\311\265\341\3310}Y\271\215y\275\243\313\213\341\026m[\305\324\037uK\b\023\247\337\034\275x\251v\035\356\256\\\033\336\017\0073F\334\227W;\263\034\267\"Sb\332\326\272\032\267\260\253'm\345\342\342\352\034\222\251\332\303\351\210S\227\327\271$\246)\254\266UK\345B\223wE\203\t\227*\347C\371B2\203\367\250\342\351<Gb\206\310\020\211\210H\222$\351\002\013\020\004cY\226\326\024\037\022"
+	.string	"\024A\317R\314)##\"#\022$I\212\352\223\306\032\004L(\360\223\0255\025\217\240\342I\374\206wI\261\361\033]d\330\207\347\300R\t\306\232\007\036\022\026\200\276\377X\3152\031GZ0\214\\>'^h\224\036d\214\f\364\340\223"
+	.ascii	"K\311\242NH\202\203I\364xJ\"lG\t\331\311\255\034g\336#f\314D"
+	.ascii	"(\020\363\241\260R4##|\t\030\232\353\"\355\301\345]<X\274xo\025"
+	.ascii	"\021\020\202b\203\275\315\363p<\360\365\317\351\f ?\237\251\t"
+	.ascii	"c\251\325\374\177\365_U\230\270)\206(\247\214\311\3216\260\213"
+	.ascii	"\323\030\320h\326w\210lJ'F\216\266\036\307\331\352.l\357\f\322"
+	.ascii	"\262\313\343C`\026n\244\201 Zp\317pl-[O\322\0274@\016\177\343"
+	.ascii	"\207P$\325\235\273\016$\222\032 \266!!Bn5\312\002\013\2206\271"
+	.ascii	"%\202\201\354\0330]\346\263\216\327\225\300\250h;\335I"
+	.string	"q\330i\357\361O\3307\316NDG\032\335EnWh\367\361\225\026J\272_\b\343\262\r\271\342\300\f\377\027h\362%\333\351a\347\334\231Ew&F&\301\016[\316=C\t\337\304\007>\231\302/\005X\206\377\225I\024\276h\004\003e\217\335W;\316\221#Z\365U\204l\244\320\233\216N\307v\207\366\355A\312S\241M4\304\335\223E P\235\311\333\363#\360\232S\022\270\314\326\340\350$\225\355\217L\220auL-x\303\220:\377\347\002\"\340\301\"\004\325\240\354\224\006S\265\254\223\277 Vl\234H=L\330\267xe\354^\305\234\2350\341D\277\332\221X\272\007\013\314c\353_`\203\370\352e$sR\344\027go\375\337\273\377\206\210\034,m\241\323\331\302\272w\024\260\276\217\371-&\0377[["
+	.string	"\247\242P\007\203\002\266\347twM\034\364\342\356J\236\220\310\241\022S\233f\n7\367L\252\214"
+	.string	"%d/\220\230\275zo\210\024\"-\372\365\356W\315\242\2703\271.}!z\247#"
+	.ascii	"\306s\0374\265\022*\221\226\237\3244y\230\360Jg\375\374\021\030"
+	.ascii	"\363\241=]\335\330\230\246_f\214ZD\237\206\017*\236\301\2033"
+	.ascii	" \342\223\245\324T&\351\332\307AD\246 }\3701\211\201\331\332"
+	.ascii	"\007\243\224\254s<\322\336x\255\244\212)H\036!\025\374\303\247"
+	.ascii	"\256s5X\354\215\013\033\356\032\007\253\025\\\346p\005\360\006"
+	.ascii	"\303\"&\313?\230\263\207\312\313]\367\307\263\267F\313o++\337"
+	.ascii	"JT\307\323\322\f\324\232E]\205=~\346\256\2665f&\213\303\374\211"
+	.ascii	"E\031@\367\256\360\207\0068y\311AbZ\321\330_ \032\2203\225\206"
+	.ascii	"\0176}\312\220)\363\377\\\251\301\222\316,<i\330p\212\025\223"
+	.ascii	"C\350\334W\336\324<<yo\315\233\211`\240\231\231\353VJ\240\245"
+	.ascii	"\271>\026'\212mxSE\370\243J\2553\373O\263\306B\343\362\2329\372"
+	.ascii	"z+s^!\353\022IP\215\357\016\027\371\214\220H\357\244\354\017"
+	.ascii	"_/&\017\350\351\316W\363\242k\205\305\271|\374\324w\360\323\\"
+	.ascii	"\371\330\216\310\231\254\233\240xY\rW!0U\b\372C\271\311{\377"
+	.ascii	"\016\321\253\017\210$\fP\321\036\203!\225\354X\270\342\232g\353"
+	.ascii	"\261\245\364^Z\351 '$~N\313gD-{B \311\373\254=\261v\317)\264"
+	.ascii	"\245]\310;\305m\275:\277_\332b\f s\311\261\371\347\343[7Q\221"
+	.ascii	"$\020\bH<\213Zl\304f\026\030\204\336c\2354\354^[\003\024\236"
+	.ascii	"Q\343.\022D\177\314eh\272\037R\0024\220\202\224\367<\210 \320"
+	.ascii	"n1nj\212n\300z\246\020k6 \350K\002V\366\250\214Vc\362_\373\305"
+	.ascii	"\301N~t|P\030`\314Y\355\347\020\377n\022c\200\b;"
+	.string	"\232\203->_B\347\314\267V\345\225\374?\304\263\215 \020IX\373\301\025\340\206\306\234\267\377\235\323}\003\377>\204\b\005O\261\274\236\323\231\262\377\t=\017>dB>#\362F\350=[G\234\232_\003\372rU\030\377N-wSU\037\256P\200PAD\002\354\343o\365\260]p\312Y\273\305d\316\211?d\362\257$\225\034U\365g\004\210\206\250R\357\207\324h\373Wm\217~\232\372\356\365\236i(\257\246\001\223,&\005\221\235A\3627\307]\003\2542\034\335b\305>e\237\013\272\025\\\373\027\224\353L\2137d\222\002\3310\2260\230\331Z\034\327\300\245\317\272+\231'\255\375.\377\300\306\337br\213w\276`\030\314\267o\305\311P\246C\30073!\347\022g\034-\377\253\376\210\334\257\360Xw\272~\246s\256\024t('!V\200\nz[\330\301\216R\256\216\266\260\001T@\316\353\312\242\267\0036\242"
+	.string	"\365'P\321Y5\347\357U\360\347W"
+	.string	"SV\006\221CL\233\340\002\344\273i\371L :[\023\210\316\300\b\374,\267\300O\r\317\037V2\002\231\016\364\235\323\342\036\333\020^\245\252\342\344$\264\222n\262=\257Q{\351Jv\233\331\362@\201\026\3700\272bL\217\017\330\017\336\351\245\b\255b\030\333O\366;\265\2435\177{F\216m\026\326\233\371"
+	.string	"\360\340\224e\337Z\204\210U\341\032\006\020\251\002^\2172x\027\214$\342\320T,\032L\274\325kKD\306a\342\312\177\022D\333\037\302C9\036#z\302\253\242I4\233\323\277\204\325\027\355\035\340[HN\216\337E\324\212\360\267\220\277\20669\341P\367\233\220\333riH~\035\304le`\274\343\354\265\352\235\2259\0175\313g\354\276\335R\304\263ro\334\323_\330\236\002f\205\275T\370\275\330\215\274\273X\211\201\r\006\266\0277\351\307Y\213\t\322kp.t\326\221|\246$?\247\266\355\324\372R\341\274M\355\202\352\336\246\376|]\230\374)k3\3621Kq\354\3211\302\341g\315\304\333\243\321\017 \177\340\263\324H6|\310Q\2737;\277+\343G\nGB\362\n\243\243\3577\034\360\303\341t8\273\030d\326"
+	.ascii	"Xo\225h\\\302\347\354w\243\357\243\226\275\377&jt\321}^O\270"
+	.ascii	"\371\355\231\210\357\350\337A6n\360\343\243\006,\277\016Z\321"
+	.ascii	"\337\377\b\363\211\\\244\233&\034\354D\272\360I_\204MT\007\023"
+	.ascii	"\fb6\036[\352\340e\312\307\335<\222\303\355\264,\246\201\376"
+	.ascii	"\246\241!\250\233\373\235\"\034\231\326\233zw\314\306)\t\347"
+	.ascii	":\371\033\033\367\256j\253\356?@\272\241Q~Xs\344+\3545\356\243"
+	.ascii	"<\276\266]\201\373\023\270\206\007\366\034%\267\025/0\333g\273"
+	.ascii	"\375\220\232a\360o\275\226-\307\366\f2\315\226\257\327xx\331"
+	.ascii	"&\275\204\026\263C\376kq\324b\352\311\300y\221\341\027N~\343"
+	.ascii	"\277\216.E\357\365\243;\202OdI\032\270\273\367\300\347\367h\220"
+	.ascii	"\276\020H\353b\017\337e\374Z\315\361\356\020w8?\240\321\317\376"
+	.ascii	"\034\2636\324\272&O\377\374I\265\374\335\374\002\321&\370\312"
+	.ascii	"\024\336\341\261\355\355I\0261\273\205\353K\224\277\365\371\363"
+	.ascii	"N\217\0271\343\200W\020\270\324{\335\023\331\357\317\r\365\206"
+	.ascii	"\212\017x\260n\231\353l\214\354e\017\362\315\3667\232\335\377"
+	.ascii	"\361\352\366\374\272\376\001C*>\262\346\312\356\365p1\363\212"
+	.ascii	"\223\302\211r\002\363\004G\270\216\302\334\343\324\212\017?\244"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.symtab.1adda0f48fa10b84,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"slewFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"slewFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"filterChainInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"filterChainAddStage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"filterChainApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1adda0f48fa10b84,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
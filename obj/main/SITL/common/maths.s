@@ -0,0 +1,1484 @@
+	.file	"maths.c"
+	.section	.gnu.lto_.profile.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\350\005%\013"
+	.string	"\264\020\334\006"
+	.string	"!"
+	.string	"\341\333\245\345\002"
+	.string	"\001\337\352\303g"
+	.string	"\002\203\270\227\357\001"
+	.string	"\003\264\245\347\210\r"
+	.string	"\004\346\353\250\236\002"
+	.string	"\005\354\336\272\246\003"
+	.string	"\006\246\240\335\225\r"
+	.string	"\007\347\231\311\265\t"
+	.string	"\b\267\332\206\371\013"
+	.string	"\t\271\225\217\236\002"
+	.string	"\n\352\222\314\276\016\002\002"
+	.string	"\002\001\013\223\242\326\261\005\026\002\f\326\331\347\361\r\004\r\350\355\231\037\016\231\274\327\315\004"
+	.string	"\017\202\362\202\320\006"
+	.string	"\020\326\360\230_"
+	.string	"\021\244\330\372\372\n\f\002\002\002\003\022\277\337\362\237\002\030\002\004\002\002\005\023\343\267\372\377\002\036\003\003\024\207\330\371\361\002\002\002\006\002\006\025\356\322\327\356\017\034\002\007\002\007\002"
+	.string	"\002\b\b\002\b\026\242\333\255\257\0038\t\t\002\t\027\333\332\376\205\007d\n\n\002\n\030\234\341\340\262\001\220\001\013\013\002\013\031\f\002\f\032\r\r\002\r\033\016\016\002\016\034\017\017\002\017\035\244\246\246\251\f\006\036\275\305\343\240\f"
+	.string	"\037\354\261\352\343\013"
+	.string	" \364\207\213\233\001"
+	.string	""
+	.string	"$ P\202'BT8$\270\256E\211SG8\300B\220\356\350\321\b\260d$.\035\341"
+	.string	"KF\017"
+	.string	"\327\026\330"
+	.ascii	"\260f$\361Sw\312u\335M\231.k\361\023\023v\273.s\006\331j1t\242"
+	.ascii	"\311\201\352\316\f\217\306\347\027uQZ\313\021\306os\201\331\326"
+	.ascii	"\024\327\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\007\001\325\006"
+	.ascii	"\002\310\031!\2405\351\377\377\377\377\377\271\252\252\252\032"
+	.ascii	"\300\310\232\2215#kF\266\221\264\355mvo\262\211L)\245|n\310\243"
+	.ascii	"\346p\032\214\305\333\274\2127\201P\344\002\250\253\360h\246"
+	.ascii	"\217\3230>\373\324\241\226\314\314@\026\255\253%\253\361^\356"
+	.ascii	"I\341\004\017\216\322\325\216^\\[\366\331]\025\264\001\225n\005"
+	.ascii	"%\246\335\267{F\330\2008 \340\002\"\"z\276\330\002Z,1`qh\321"
+	.ascii	"`\207\340\270:x\fb$`\265\f\001\033\372\f\013\337{0\f!\030\314"
+	.ascii	"\364\222o\t\310\372W\334f\304\262\230DVT\204[@\203\341\210\202"
+	.ascii	"#R[\231+\21015\030Z\n\206\007\321(\376\020\3046D\322\006T\334"
+	.ascii	"\24273l\303\254,zm\306\017\267\234\246\260\t0\220c\271axq\241"
+	.ascii	"\206"
+	.text
+	.section	.gnu.lto_.inline.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\\\f-&"
+	.string	"6t\250G\260XQ:\200\210\266\017\251p\347#\231Q"
+	.string	"\321\036\310\006~kC\274{\254\207}\234\3560Bu\202^lg\217\222\036\036\375ow\347+\\P\341\321\376X\373Fu\340\247`\253=\265\026\350e}\233\266\210\336;\311\024\222"
+	.string	"\225"
+	.string	"\221"
+	.ascii	"Q:J\327\336\212\306\201)\212\220@\3008\312\350\b\203.\240\350"
+	.ascii	"\330\335.\333\356\263{c\340oz\006[\324(\301\274\216FC\333\205"
+	.ascii	"\024!\211\370\fw\273{\322\032j#\365!\202\212\222\265\337\263"
+	.ascii	"\273\223\300\3636\321JC\221\020\tU\001\340;\002N\035m\024\224"
+	.ascii	"\246I\017\273{\263\241\355y\365\247\024<\303\334\006\346\037"
+	.ascii	"b>\001\332;\245\340\315_\360\rk\360\006\221\320\322\311z\177"
+	.ascii	"\366\335]\317\316\371M\205nI\301m\230\363\021*tK26\002\277H\b"
+	.ascii	"R\203e\355'\212\220x\244\345\274\261\214\335\362\363\345\347"
+	.ascii	"K\330\217\224\226\264\320O\177\372\005\247.\264\352\312\301\r"
+	.ascii	"\324\252\333\250.l\240\252o\260g\210\363'GJLf\f\240\305\216]"
+	.ascii	"g\360\304b\345P"
+	.string	"\026\013\272\270\034a\260D\022\031J\267tY\302\216\002\350\007\310\354\361BLS\216\274\233\267\272\356tu\035\235\340\255\236\301\321J\2038\216\004\3358Y\332\262G\265\375D\322\320\017y\333\252\253\252.i\350G\213[ \320m\315\201AC<\244x\366r\273\2332K2\306u\355Cv\227\345\177i\001l\332s\250\327\353\373\324\206B\027\303\034\370\342\207\205\021\0131\f\215q\236\333\335AyN\224\214\311\340\315\305\216\355\300\223_\0374\334\261\273\323\262j\3169'\234\035n\036\270P\226\375WC;\262Xq\216\333]\027\007h\321\276\251\237#A\273\027\277\3148\322^%\210\223\031\227E\307\351\307\351G\330\207~X,\231\235\305\227{\203\301\020\005\221P\323\311\250G?\306\016\302\304\020\016Z\352\024]]_\372\322\2272]t\266m\224k\337=\367\241\364\007d\324@\224\335\020\255k\322n\210\224\013\320@\002p"
+	.ascii	"\024`\341@\232\232\230\324\211\205"
+	.string	"\033551\231J\315L\223\335U]\224\3355\021\032\231\303\260B\202\247\302eX!\301\343`\325\262\335cw\035\330^dwiP,\265#\340^\363jV\032V\340v}\027\220\317n\317\234\251\025\022'\245\007\344\023{\256Wp\272:\020^\257\232\357\233\261k\354\nw\013\374\315)\331Ow7P\241\r\201c\242\234\337K\327K\255k\323\250\365\354+c\354n\214\037\201\t\250\361L\207\320\314\210\210\244\240\005)4\0061\205L1\306 \274\001\022@\0031\207\023\245SFFF\202\021\221\202\244u\2625\006\362\002v\034\240\234\323\244A\341x\330_;\304H\177hR'\200E\310\353\356x&\235T\0358P\344\352\270\017P\260\017\372\013\301\271\007\224}\031H\357\315\224\006\2342\025\364\311\344\231!\335-u>\037)H\231\340\337>w\232\377\336\337\313\016\003\331\340\223\226\323\312\002)\311e)?\354y`\356"
+	.string	"L\237\022\021G\177R\024`OY\023\"\300\"\375\275\221\356{\327I\365\346\265\004qE|\243\035\222*t<\315\035\370\244$]?\323\316r_^C\201\200\262\323\343i\275c\006B\316&\237>\210B\321\350\361\023\255r J+%\302E\222\223\027\"y\2238o\375R\352\003\371\302\225\256y\263\364\235\236\370\017\274\252\346\314\311V\312\247\026\235\034Ny\021>\275\216\305!91y:\354,\255<{\f?\312\255\357\"K\327\216\365\267\027\214}\361\240\304\340-\221\353\344>\374t\302^Pb\357#\334\361\365\332Y\210f.4z7\245\242\216\370\\Q\262\324m\200\233\317\"'\033\204\224\237\233=\355\007\253\307\220}\3164*\323\024\355&A\224N2\201\313\243v\002\267.h\246fE\023\207]h\006\237\226\341x;\031\2602h\367\276\225\026\027>,Y\320?SW\025\202L\264\017\214\316!"
+	.ascii	"\267mkV\263z\201\004p\350\301\357Q\367\310\023\203N\212\013\177"
+	.ascii	"\355\003\307N\263\032\n\025z \227 \220\343\234\346:\340\to\343"
+	.ascii	"\237#\036.\322\032\272\356)\257\241\372\350Pq\251\262\252\275"
+	.ascii	"\313\227n\351\271\234>dvE\205\344\327@\325l,\367\375L\341\305"
+	.ascii	"O\031\263\033\fjl2CE\316\321uH\320\031\332\016\300\307\303\272"
+	.ascii	"\270=\256pD\372\321\203?j8\333\2676\032W\222\350\005#\312({\255"
+	.ascii	"{\203\022x\333\304\246\251\277\3766\370\310\224\004\224A\007"
+	.ascii	"\257\302\202\222mM"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\313"
+	.string	"u\007"
+	.string	"2\313$*\240'\351\203_zt}\205\376\377\333\377\275S\353\377\260\252\361\367\377\377\377\267\326\310&\244\265\275Ik\255\265F6\331r\247$\003\370\374W\360\374\207\340\031p\314\357\324\266)\020"
+	.string	"0\261$\362<\346\274\220\322B\212\213\twJ\330\224\212\3553\323U\306\245u\263\214\366!\313\317\207\362\225\321\265\306\246.\3469\0325\252\226\321\374.\252p|'\321\370\315\342\230\363\235\262\262\371\315gZ+|\250\003C\004D\204\350\205(R8@\360\323m\276j\321"
+	.string	"\333\020+ \220\2022\253\016\226\241'\031\214\364b'\356`\r\321 \2271\204qE\203Uu\037\246\200\3043\004\0077pi:W\361Um\353\004g\313-\276\200\257\2039Hw[[\2208a\260\345\352\206v\006f/\032>\3301\262\017"
+	.ascii	"\222\251f\320\242\230n\363\0169N\001\206"
+	.text
+	.section	.gnu.lto_.pureconst.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375 h\335\002"
+	.string	"\202\306\025!`m\322\0010\\\211L\002\254\226$3\b\202 \bB%\300K\t\360R\002\314tw\267\316nm\007\2632)s\362In\344B\356\343:n\3432\356\342*\306$>\304w\370\f\2630\tsp\0057\360\001\276jRs\232\322\214&4\237\317\313y5g\314bf\227"
+	.text
+	.section	.gnu.lto_.ipa_modref.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`c\001%\006"
+	.ascii	"\222\207\027\037\2207\351\377\017\263\252\257\357\276\272\273"
+	.ascii	"\234\333\346\237\027\340\267\265\341\357\355\317\360\277*\202"
+	.ascii	"\034)S\254Z\334)(!\016\r\263\026\305P@\222\366\276\335\356\177"
+	.ascii	"\253\310W\3210\204\331\370R^\017\207\203\277\245\210\002>\214"
+	.ascii	"\346\214=\357\253]\r\314\030\2379?\312\225RA\004\354\\c\366\344"
+	.ascii	"&\002/ \360\002\221\261\252\003>\"\200F\030\336\0343\232\245"
+	.ascii	"\005\275\213\030\235O\306\322\242\364\341Q\316\203m\r\266lY\200"
+	.ascii	")\346\006\306\235(b\r\001\230\236\314\321\035;\256\263 dF7\342"
+	.ascii	"Ei\337\256A\345@m-\305qF\020\246\b\244\260\027\227\352\226jJ"
+	.ascii	"\274C?b\275E\3502\r7HF\202\0135\004"
+	.text
+	.section	.gnu.lto_.lto.8730f30e1588ce87,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sin_approx.5.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\025\f"
+	.string	"6\327RA\020q\224\016; \034-\264\364Rb-4\245\337\347\260\333\213T<lX\020)8vI{\020(\374\364\307\336^\267H%w\273\250"
+	.string	""
+	.string	"(\267I\021`\266\214\345%\326+jm\315\222\275\267\224)\005A"
+	.string	"?"
+	.string	"A"
+	.string	"\027.\030fx\240\250\261\2731s\f\374s\037"
+	.string	"\377\324C\226iv\247\231\371"
+	.string	"4\323]%\344\352\016\210\270\b\t\240\235\034&\006\207\223\247\236 \032G\246\245`w\235\037\232\206\373\335\366\002\333\321\276\203\252\351\324\364-\002H\b\274\330\315\260\262\2610\336\n\021\337~;\363S\276\330\336*\270M\301\200\304\t\312\356n\376\274\251\374\345QV\331\262\333b\204\212\335E`\003\225?\333~\211\233\310lU\203jz\202\017)(\272\275\004S\037\2340\341\310\024g^\202\327\324w\210\234re\250\327GB\303\343\306S\250O]\303BF\207\211\205\\\331\233)\265C\t\210\222\020\326\021\353\333\r\217\372\337\323\356\250;#\320\207\344H\267\207#\2120\352\\\021\204]\027\346\211\240O\347\212\236\220(r\n\030\223"
+	.string	"!\024G\030\026\212\227\275\216X\233\ri\225\355\3248;M=9\227OUAl\230O\355\t\024\340?,u\001\024"
+	.string	"f\020\302\251\031\235\270\202\027>h\250:\354U\251\215&\354\2350\333\213\261w\246\r\256qB\304\2161\016\322\214="
+	.ascii	"1Q\341\n\240\362\264\264G\003S{"
+	.text
+	.section	.gnu.lto_cos_approx.6.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`=\001\305\r"
+	.string	"\346\232]C\020\217(\035\250\001\323\253T\360\037j\254\375Y\2317\"\264\344`AVBv\030\002\023\227\370\233]\375\227h\232\363p\331\226\263\247\002\266\001\020\240*,"
+	.string	"\300!\200\030\322\t\2720\220\326}B\310\336R\246\024K"
+	.string	"I"
+	.string	"J"
+	.ascii	"\366=\374\003g\253\022H\310\220\274\224R/vW\333\270\306\365\b"
+	.ascii	"\017\340zT\r\347\01659\377)\207'\013!L\236\310a\311\025\0220"
+	.ascii	"I"
+	.string	"Q\222\341\211\240F\013\006\227\247\236#\336(\023;\260\273N\223G\341\216\267\255\300\266f\377\024(\177>}\214\201\n\001Z\273\023Z1\226\025Mp\370\367\333\367Y\376\371\251\025.t\224U\345;\355n\310_q\346\321\241\253D\200+\002A\007\027\026\273\313\361h\216\354\234\235\311\243Xe\314.\212\023\211\335-\340\001\331\243\035%Z\264\\P\324A\256K\031\260\254F\t\303\033\007\271\242^P\243F\020+J/]\266|\205\372\3245'T\220V\235\352#J.X\353\034\355v\232\324\353I&\242l\331(Qj\006\373p\365${\032\203\351\013\246\343\277\033>\240\316G\b\f\2717\035\037\007 \017\216\326\3318\234m\243u><8\332\306\363\321:\004x{\320\300\243\201\266\315\243e\272\303\325\023\033*\266`\303*\255\262\235\232LGlg\372\224\237\204\344\261:\025A,\257\376\367\201p\335\204)T\221\f\030"
+	.string	"i\b\361\3350\026,\270\303\354MT[ \325F"
+	.string	"0+0\277\242!T\354J]\346\032~\262\201\323c\027\2720\f\\\302\252\351[\342D\202X\306\004\021\025n"
+	.ascii	"*\217U\215N\321\324\036"
+	.text
+	.section	.gnu.lto_atan2_approx.7.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\254\004\375\033"
+	.string	"\346\361\255I\240\330M:\300W\235>\360xE\003s\212\332s)V\244\211\214\265\263O\246\005\345B\310<\247\306{\220(\377\347\0244\241\352\333"
+	.string	"\237\002\354\361\024^\345\325\326\342\245\231\323;@l\300d<~P\263\267F,!d\313\235R\233"
+	.string	"\207"
+	.string	"\235"
+	.string	"7\0228\371w\203\353U\025\023tS1\016\0344\202\036\215\003\237\227\341\237\307Z{\274\270QkE`\003\255\203\266}\030\217\361c\377hOI\305\211\200\020\362e\325Zk7\227\205\007\351c\302\203\233\342?w\215-1\004\351\316\037_|@]\030\005\361\220\003\272K\367Q7\200\027\242\304l\r8!\242\350\"- \004\205\222\017\tQDi\273\037#\204fH\342 \371\312u\230\324\225\033\361\215\345p\364\246\326z\251\317\241\334mN\361A\255\325\323CN\304\375\272m\236\355\0066m\0210+\333O\035\302N\207EJ\271\315\3221+\2634\037/\013\263\nt<\310\254\240Y\332=\240\271I\366i]$\333\206V3\243\371\364\314\247ew\272e.\343\2179\324\r\363\336\377\342\322\022{\324\r\3734\313\247_\237v}z\374t\353\323\342\247\303O\203\237\246\237\336O\317O?"
+	.ascii	"\314\311\316\004\212\242\305\352U\020e\225z\005\346`q\247\037"
+	.ascii	"\352\217\372\332\267?e\277\246\375\343?\335w)\277\242\214\026"
+	.ascii	"@\371w\243\024U\023\367Z\226m\260\304\265\257e`\005\207\356"
+	.string	"h\\\327\326|\344\016\311J\221qq\250H\236R\223#W;p\342\266\366V\341\212+\300\212\344\225e\216\202\033.\200(t\301\005\340#y$\254\234\250Uv\351\326\370\310\035l\347\356\316\250H\336\327\277\357\252\262\256\256\314\005\255\310\245\333\3576p6\216\252\035\224e\026\256\326 \002\260\375^\247+I\336\215\312vfi\366R\207\241\"\253n\263\234\331\317\370\334\371H(\267Y~\326Z\201v\223\374\263=\t\310\266\210\250\351\t\tnR\261\314\006=\026x6\202\204\036\n9t\3039\334:8=\027|rvj\031l;;6\235Z\006\f9;5\035\236\236\032\016\3156\r\026xj>6\033O\355\325\253\247u\221V\2146k\332jY\027\227\215\221S\256\202\366\346jY\233\265\321A>\t\032\245>.5\355D\332\232\206\261m\211\331\031Q\222V\214\3226\202\321\217\\:\216(B\216\304M\362\2154}"
+	.string	"k\266\002\323\025:\333\330\016\275\354\214\b+\234\315\020\222rU\263>FR\344\022\270I\336\300\304d^\211\t\310\322,l\207l\317\210\210<\375`\331\326\316\3665\310a\250a<\244\020S\210\321\004\"\222\302\202$\035\300\002\221)c\035\020H\206\2144\311p"
+	.ascii	"Bo\b\013L\340\312j*z`\264\371\024\003j\020\333\345\327T&\273"
+	.ascii	"\030\b\251\035\202\372&\006\314n/\262)\037\333\230\215\275\005"
+	.ascii	"\027\356?\226l\036\272E\3221l\370,F\22283\005\f+\001!kfp@\177"
+	.ascii	"\025\2047\201\024\311\027\034l{\223\320\275V\324H>n\231\332\032"
+	.ascii	"\314\210\203\251n\317\315YqO\277T\033\021\005V\266\311\321\214"
+	.ascii	"\006%A\242\310A\331\001[\240T\242\276|\023:\n\236\2338\270\314"
+	.ascii	"[\r\031b\256\200\207\302\213)<\256\001\367R(46\025\2231d\233"
+	.ascii	"r\007\205~\337S5\016\353\355\321?"
+	.text
+	.section	.gnu.lto_acos_approx.8.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\374\001u\021"
+	.string	"\366 tG\340\322&\035\220"
+	.string	"\002\n4\333_\310\025$\017\374\346\306\236\207\022Y\272\030=\347\304-\310\343o\337\\\205L\350\367\257\027i\306\264\205\212\31109\306\030\215\326\211aF\334(\037\013&x\024Y\332\3106B\b\331R\246\024]"
+	.string	"X"
+	.string	"f"
+	.string	"\317\3649\026=\232\263\306\212\030s\316\006f\300=\263\355\343\234E\312\026%\254\204\211\007\275\210\331\031\232sz#/\240=\223'\240=[\022O]\256\246|\325\345_\255Q\2065\363\225\013\200F\354"
+	.ascii	"\300\002\245\210\253g\346\261\353\212\365\251n'sN\253\f\313\303"
+	.ascii	"\235\335v\004\333\017lu\t\243\rS\351\332\330\227sk@\016\273K"
+	.ascii	"\327\271\273\347\374\244\253GWsWoWkWgW\313\253\367j\275\372\001"
+	.ascii	"6\024@\tn\314\311a,\232?\331\214\023\207\375:W;\345\267x\314"
+	.ascii	"\235\216\305\021P\300\\}0^\016`\0269U\007\003a\020O\2179g\311"
+	.ascii	"3\227p\001>.B\035\333r\253\371\204.m\267\335v\302\033\033!D\024"
+	.ascii	"\201\331j\033\362#|u+7\333\0038\302\233\017\253\f?D\340\256\\"
+	.ascii	"\0044B\327'\036\204\n\r\020\306Q\250\246\333]\005<\341\215\324"
+	.ascii	"\257}\001\203v\031\335\021pU\356\326\342\255\340\2340$_\t-\036"
+	.ascii	"\341\353\323\321\244\355\366\261\313\024\255\034\341\020\214"
+	.ascii	"\006(/\332R\301\205E\005\245\275\334)&,\023ZPL\336\312\311d:"
+	.ascii	"\245x+\024PL^\n\212\3053\021\361\311\202\n\312k9\235P^\007\233"
+	.ascii	"\227sk|\032\034\227\226\006,\310\216ve{\264>\201\331O\2266F\350"
+	.ascii	"G\202\354_\2551|}\227\341\003\210f\327\306\242m%!m\310\006\234"
+	.ascii	"X\017\250D\346V\267\264\017' \200\202\221\200Q=\355\b}(qZmX'"
+	.ascii	"{i5\246\266\306\nwm\025\247c\223\013m\304i\347U\366\313\251\203"
+	.ascii	"\233\207\206'\370u@eb\261q;j\2535\244\357\340mF\303\001\357\325"
+	.ascii	"\236\217\234e\206\r\351}\276_\2218s\002\003FjB\270\002\310gR"
+	.ascii	".\317u\366"
+	.text
+	.section	.gnu.lto_invSqrt.9.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`Y\001\375\r"
+	.string	"&\033^B\020\221\223\016\237\002\276w\004\202\020\3772\027h\31150\247\026`\371>_N\326\bq-b%\270[\373\301\236\036\301\r\276\367\331\033(\025\001\240\020\240\002\240\357H\316\325s\257\177\255YB\310&I\246\024J"
+	.string	"D"
+	.string	"N"
+	.string	"\231\037\232\245]5\2310J\264\310\314\005M\220\371\265\255SX\005\251\355,n\004\t\323\220\301\201\205\216\314\324\fX\300\345g9\300\345w\021&\031I\265[l\241H\351P'%#\346 3\213\250\223\017\356\335\026A[\006\255e\002\355\261\036sn\307,\366\207\261\034c7\306j\214\315\214\305\214\275\214}\306Z\306\376X<\326"
+	.string	"\260\0343\n\2542;\254v$\314sa\302\234\335\222\352\226r\332r\032\262\222\207\001(\0205nd&\210_A\002\326\377\367\363\330R\235\377\326\2572i\367\177df^L\17731Nl\306p\3411f[Q`\317}\023\024\231\255\307\251s\255L\323\201\217w\376"
+	.string	"\305\306\226:\341\252^\021\241/\262\314l\340\371\205\230\231\027\023\256Z\256\204\017\321\332\312\253\004\020&T\370\210\274\f.(\204D\244\344\023\322FD\241\220\b\244\215P\370\2044\320\210D\013!P\221\005\t#\255D$\032i\034.m\345U8\357\270\340\2001\375\324\315\261s4\233\354\3305\330\263\217R\\\256\377\330\255\332R\357\355\314\341\206\353\250\332V\002\033"
+	.ascii	"2\241\367)0B\032*(\004\374\013E;\301\230\230\203\206\206B\307"
+	.ascii	"\3429X\211i(+\313\201\206\026g\030\301\252TF\257\262\3065\253"
+	.ascii	"\257DqM\244\316\026Qc\302Y\0241Q\341\006\240\362\230\332I\006"
+	.text
+	.section	.gnu.lto_gcd.10.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"E\013"
+	.string	"\346\325L=0M\225\016\350\031\023\302\217\347J\275\024\362\032\"\300S\026\370\250\f\2067\327\214\254\312\377\353g\b3\013F"
+	.string	"\316v\303a`\200\013\222\332\f[\203\177\f\244X\035\205\3246\262\267\224)\005:"
+	.string	">"
+	.string	"6"
+	.string	"\360\021\353Q-\370\326\334\036\241\346\346\377;\314P\022\001\302\020\341\221s\b)\252\324\311\202\373\300\306Gd\372\367\fq\236\324\310\263Q\331]'\210\203p[\267}\300\266\001\373\005\002z\357\316\247\337\250\220@\"\200\211]\321\n\305\216\210\247\013\2667\033b{&\311\363\235Q~\354R\230\360aw%\036\340x\274\206o\330l\024\364J\334+\244x\320\341\304\356^\002\216a=\006\266\307\201J\362\277_\304[\232\032\372wG\nD\027S\r3\252j\210\300S3D+\016%<\251\262=\316\341\356\256*\311OJI\225\262\216\354{\277\365\356\217\357\356\230\226a\020D\214A\246\276L4\t6\026\354\3124\f\323.W\246\300\202]\227\214\346\232"
+	.string	"\260\266"
+	.string	"\223\2716\232\226\271 \336^G\266SU\257\377\376pp\352\344J=\204\370pQI\352J\003\355\004\024"
+	.ascii	"i\004.0\307v\032\177 A\026>\264\306\332\247g\0034\021-\201M\b"
+	.ascii	"\007\314\201\314\300\210\240\002\006T2?e\037\216\222U7\325T\215"
+	.ascii	"v\225<"
+	.text
+	.section	.gnu.lto_powerf.11.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`t\001\275\016"
+	.string	"\366\333bC\020o\225\016(L\003\b\252\n\372\236i\361B\357"
+	.string	"\301\262\030kv\035u\363\237;\251\022+n\030|<\354\315\314\357'\201\276\2415\276v\001"
+	.string	""
+	.string	"\200Fu\t-\307\303\001Rt\027\020\252\221\240\275\345N)N"
+	.string	"N"
+	.string	"M"
+	.string	"\313\025\270\200\312\247|\200\312\247~\260\026\206\341\354\362\273e\f}J\215!\277u)\242*1y\242O\251\221R "
+	.string	"x$\251!\213\215\334\365x\362FQ\212\360\270\336u\004\252\227\311\363x\324\036\354\256\243\311\313pWn\233\202m\007\366I\004!\016\376\254G\373\366S\370.\320$\233\250c{\201\032\032l\237\267C~\313\027\333,\3036Q\307\200\022J*\266\273\t>\315 ~&\341\260\302<~e\230-\273.BV\354\356\002\037\330>\177\342(B6L~ !GAa"
+	.string	"g\354\006\032\365\263\226\311\205(\273\334\335\225V\360\250\233\316\027\245\r\243\030Z\365\252\351]\237&\252Wi\304(\206\252\257\022\222\247\372a\177\242\250\001\"\213Y;\330\2336\377\375\362\253_\017\336\361\254\373\026\213\207\024\025\006d\354\246\302\224=\231#\001\240\016G\247\231\240\t\034\237\215\247\262Qa\243\233O\006\202\264\006\363\211"
+	.ascii	"\312p\270N\307\341t\032\256#!\303\3414\236\017\207!\340nc\343"
+	.ascii	"\341@]\347\341.\337^\312\353\234G\231J\234X\320\321\324\017_"
+	.ascii	"L\350\246\n#\236\356\372E\244\005\252\365-\006\213Y<\331\266"
+	.ascii	"\f  \200\002!\333\016\033\201z\354\025{D-\344-\016H\223\237\361"
+	.ascii	"\201\231\325\266X\321\254=\330\322\355\026rLq0\330]\203\355t"
+	.ascii	"\255d%LB\340\020\254A\300\303\202\241\001\345%C\226\220,\362"
+	.ascii	"\302b\037\357K\244s\321'"
+	.text
+	.section	.gnu.lto_applyDeadband.12.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\031\001-\r"
+	.string	"\006YYB \255&\035\024\003_F\214r\r\007\253\035\302\274\220N\313\001P\236\253b<6h8\b\214J\261\243\216\312\265\262\322\316G]\f\320nI\200"
+	.string	"\026.H\020\200\342\200E%\301\0247\206\350\275\267\224)\005F"
+	.string	"C"
+	.string	"F"
+	.string	"\273V\200k\300?w"
+	.string	"\360O-<t\370\234f\310'9L\371\303\310R\356\334\206\211\023\200Z\221\321d\243T7\240\024#!#\0239\r\324\212\314[\236(\031)\323\302cw\235'Y\204\333\342\266/\333\005\354\207\004N\277o\277sZ\177\372\323\351W\030#P\034*v!\304\025k\342\2110\331w\2615\267Gl\215\275\245\254\314\237D|\261[\341\003\210\335\021\001sT\177\266}\r\3370\342\220\333.dP\243\340\200\303\314\006\242\214y\322\301D{\252\245B=)\203(\343\357\301D\"\345D`\352\201\t\246\227\022\243Le\210\024(\025U\315\256\345\325\211\227\230Q\246\234\252z\227\033(a\210\244\231\222\214\366F\222\252\331\327\030c\264\262\330N\303\234\317\205\200su8U'd\301\325\340y\323\361\221"
+	.string	"\344\362X\037\314\343\3016\326G\301\345\2616\240\017\253c\303\030\203\016\310\002\3010\220\245\331\366\312\342tP\023\005\314\351\275\013\025\230\007\351\207\340\025\305\366(Q\221\335\356.|zR)\031"
+	.ascii	"|\bX\325Q\024\026_d\242\200P@\235\2373\001n\017V\r\025\2000\221"
+	.ascii	"\250\336\341\214]eZ\247\256\201\244\020\026\230\003\203\201\021"
+	.ascii	"@\005,~\346\223\223]\200\313Uu{\253\235P"
+	.text
+	.section	.gnu.lto_fapplyDeadband.13.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\025\001\025\r"
+	.string	"\326\330XB\020\257&\035`\225 \372S\226\325j\311\2149\350?D\306\004\232t/\360\354\"w\344\205\334\377\356\257\243\3627FL\303\311_\264V[\212"
+	.string	""
+	.string	"\200\n \024w\353,\267"
+	.string	"1\2409d\377\336[\312\224\002F"
+	.string	"C"
+	.string	"F"
+	.string	"\273P\3007\336]{\200w\247\026>\372sMs\344\217\374\241\334i\\(o\215\243\244\021@\251\320p\256Rj\3538\315P"
+	.string	"p\221\332\006J\205\346.\317\223\313\224\211\361\261\273N\223k\302\215q\333\225\355\003\366\033\004v\246_\246\335\263\277\275\345\327Lg\246\277\321H\241:\342\256\204\370bS\270\022,\266G6\307\316X\300\347[ 8c\327D\210\021\273%\003.\260\271\263\355w\270\207\221\035\323\262\013\031\256BC\204\0175\033\031\323\004D\t\346\024S}z\323\006R\306\037\206\345D\252)\346\030\3339@\025A\205\026/(J\231J\022.P)\252\230\233^A^fJ\231\262\352\365.o\0340\300\230jH2\332\331H*f_c\214\321\272\022\236P\005\342\251>\236\315\307\301\202\352\201s\307#$\201H\005\202!\013\004\262:0\244\240\002\301\216(\004zp\330b\360\021A\021\313\022AN\266\327\025g{\232+dD8\227\221\"s\312\324\023\365\007\211\222\334vw\237\323\233N\244\030"
+	.ascii	"\177\b\030\326Q\033\013:\214\034Y0\003l\001u~\316\020\270\275"
+	.ascii	"Q\353(J\026\324;\267\214u\355\032\3704\241\20090\030\030\001"
+	.ascii	"T@\343g>9\331\005\270\\U\267\267\332\t\005"
+	.text
+	.section	.gnu.lto_devClear.14.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\245\007"
+	.string	"RO65`o\032\003T\276\221\214\031\006\3005I\307\326/\346\346c\002\253[a\205!d\365\377\275\355\342\036{\310]\005C\236\030\\\321\351\020MA\301\024[o\271\245L)\022\033\207X-\323y\360h\266\311\341\266\215\323&\007B\263M\255\353\314\214A\271\210M7=\034\327\315\354\273\255GR\0336R\241h\321\004\267\023&i\n\366\177\241\036\241\250\020(yX\326\237\3132\256\260\250\\Bp\325~ \0309Z[\377\337Hjm\262\241\225i\250`L~\214\325\313S\022\345#kk\330:\304\"\236M\037\017\374$\220\223\377S(\002f\331\317\005\227%f\202\313\262^\333\342\257t\243N\027(\325\377\031;\354\031z\265O\016\020\215@\206"
+	.string	"\f\377\013E\243\f7\272\355A[L\333\222\t"
+	.ascii	"3C+\0258\b7d\002+\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_devPush.15.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\302\002m\022"
+	.string	"\006\341rF\360\320&\035X2\356\375\177\347\247\025\312ZyMJ\242\225\265\315\372\275\377\234\357\0013\215\031|\314\322\341A7T\322\320\240\363\364\027V\002\315\254\204\334\300rD)\222\311\373\320\350\211`F\001b\t!do)S\n]"
+	.string	"P"
+	.string	"g"
+	.string	"&~s\272\213\345\001vchxv_\"N\260=\372u\220\354q\273\200\354\321'\233\350\257\231=l'\003\354hw=\r\361\323#\324<\371\3179\267b\265<\276\034\222X/W\250\240\025\243\303\007\313\005\202\004\201\020z\316S\003+\225\251-\330]\347\212\305\341\316n\273\201\355\021[I\002\331\303~\265\244\312\330\207\273\273\326\030\3738\177\351\256\377#\323]\246I\231\3462\275eZ\313t\226\351\230i\230i\325tj\372\004:\236\240\220\242\335\r=v,P\364\241\261\375\316v\276~\342t\034\307\314\355\266\320\341\331]\021\213l\217\007\340\323~<T6TK\n5\302T%z\034S\325`\206r\270\262\347F\320\007\030C`\177W\021}\204\216\216(|\347#\207Jj\253\\\3071\003\\\215\220\215\207\223X\265\200Te\034\362\324\001795\\R\207SS"
+	.string	"\230\371\312(\344\327\324\017\251Z)W8\n\377l\273K\342\303\036\\\330D\260d\217WE\321\260q\241\002\030n\341\004\202\332dD%\302J\211\311C\371L\246\317\304C\221Pb\362LRT\274\221\002\376&\234\244x+\337\227\342u\257=\\\2151\203\036 \224\246b\2470p\254\214P.\034\214(Z\031uj\233\316\202\244\233v\234B%\325\244J\312\2516\343gS\r\206\310\306\245\255\310TUS(C\325\212\n5\323\253^\244F\315\0027 \220\002\221\271:\017cB\377H\f\261\035\252H\366.\2551\323\312Pj\242\226\2107\270+\277\3362\273\272\256j"
+	.string	"\206+\255\206\240\303\272"
+	.ascii	"\311\316\256\213\300rz\035\232O\267\234E.\020\275\216{\336H\252"
+	.ascii	"\240s\255\b\n\342k\211\221\337C\202\321\306m\337\242D\357\225"
+	.ascii	"8\210\372@H9\216\347\3304\277\3116@v\251\220\r\232?\342\310\350"
+	.ascii	"\214\321\025ip\312\340\345n\223ou5Z\270\007"
+	.text
+	.section	.gnu.lto_devVariance.16.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\035\f"
+	.string	"\006\230S@ Q\224\016\f\301\260\275H\300\315J\254O\026\316\"\"\320,\f#&&\216\006"
+	.string	"h(\227Y\360l\026\333v\267UO2\322\246\013\t"
+	.string	"\025\f\020\020C\274\227\027\231\"\214,\026ido)S\nD"
+	.string	"="
+	.string	"A"
+	.string	"\035W\321\302B\210\031\273\213Un\240z\204'P=\252\206o\207\232\233\177\031\036+H\035\3500@\267q\205\024S\211\r\001\235\b&Hep\361\017\317R\307eJ\032\354\256\223\324a\270\343m;\260m\261/!\336/\321t\3244\314\264j:3}"
+	.string	"\223\221\324\205b\367\302WcSD\022\034lo\366\304\366\323>\310=l\367>\037\260{\372\030\261\353-\260\002\353\321\236e\333\357\360\217\315FAoC\237/\255b\214L\234;\027aT*\202\247\007\311\224R\345\260\345W}\021rB\2244lO8\b\213X\273\313\300\017\331T\260:\036\375O\365x-\300\002$\224\237\355\201R9\354\303\325\223\255i\353\001\0242\017\324\230\253\003\301s\3110\215\226e\032\006\323D\270d\030\206\323\301.\212\265M\206\203y4\215\203M\274\275\236\234i\224\355<\020\265d;j%\244\034\204PS-\225\230\030\215p\371Y\025j\024\031\301\be\023"
+	.ascii	"\022\0230\245\346+\032>d\305\346\3420\021\006\325\260\240\020"
+	.ascii	"\334A\013$,\037_7i\026s!'\250\031\354\310\330\203v#)\2011\357"
+	.ascii	"\324h\025\024"
+	.text
+	.section	.gnu.lto_devStandardDeviation.17.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`/\001\335\r"
+	.string	"F[_D \217\223\016\210A\237\302\333D)\322\007\270\342\022?:\013\004\345\007"
+	.string	"H\305\224\217\005@,4"
+	.string	"\233\006V\373s\314D\376\354G\322\350\337H\b\201\002\f\020\220\2610\232\025S\331\216;\262\215\020\262\245\224)\005M"
+	.string	"F"
+	.string	"O"
+	.string	"\034\336\241\263U\373a@y\n\026\023>\310\2101j\033\037`\035\356\005X\207z\341\335W\263\363\257\362\325\200R\221<\222\357\3063\271\256\206\351\204\t"
+	.string	"O\264\034+\0131O=K^(\363J\020ct\222\274\222\033\336\266\002\333\035\366Q\001'{\323\232Mc\233\2764mm\032nz5\255\377\376\334d/VZK\214\025fd\"\f,\201\362Y\236\022\371\212uE&\023\261\263wv\226\366S\356\241\3737\362"
+	.string	"1\236D\220\210\361;`\003\330\241?\314\266\037\212\351\36522a\351\245\320e\324\202sUK-\030#S(g\036<\204UP\013\250\310\f$\323J\365\304\035W\325\025,(D9\303O\371\363\026\273`1F\004>\b\t\020|\224C\177D\237:GI\214\r)\240\234\261\277P\352\211\375\215\032\021>\026\250;\234\017\203\020\217M\003\341\266\215\353h \r<6\255\343\371h\034\rs\016><Z\b\307y\264\314\266?\320\365\344T,\213y\031\221V\331N\002\032-\331^\335"
+	.string	"i\310\233\324\250\275q\326I\253W\371)\224\\\300\210\224d/\205\001\027"
+	.ascii	"I\214\211\245\005\020\3312-t\357Y.\307\373a\325@t\262\204\342"
+	.ascii	"\307\343\271\232\260\\\303\313n\0026\025:h\230\026\342z\r]2A"
+	.ascii	"\202*\034\334\215\244\032\244)\251\306\245\240"
+	.text
+	.section	.gnu.lto_degreesToRadians.18.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"}\b"
+	.string	"\306P<7@\345&\035U=@\214\346]@\\\301\200\216\324\2125\321y\312\005\324\251(\305\267m\360\3155z\020*\365$\035.\303\350\017\277\263\202fP\377\fm\263m\233H\231R,"
+	.string	"+"
+	.string	"*"
+	.string	")\n\222\230\335\215\233\023d\016\253\017d\016u\343\335\263\363?\362\n\345\004C*\201\236\032\206\335u\222J\030\267\336\366\201m\005\333)\001{\361\245V\005\236\234lw\266e;\323~\310E\272{\022\206\273\246\022\223\335M0B\300\241@\332\366?\016\322\331\250\312\343\3508K^\370\276\227\211\335\220\301U\365#\017Q~N\275~\344\022\312\317\366@\251\032\366\253\325\f[\323z\357OM\037Z\001Vb\313\006\034\206m\016X\203\306\027\207{\370t\262\350\321\262L\273\242\007\242\223\305k\343\"\247\300Z\004\266\305\217\246m\321\362\366\266\352&\244\"\033u\013"
+	.string	"\025\246\r\n"
+	.ascii	"2\003\302\260R\b0\254.qM$\310\202p`\202\200\023O\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_scaleRange.19.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\357\001\035\020"
+	.string	"f\336iF\360\260(\035\352>\272\214\250\031\237\3635\373\375\307\022R\304k\364)[3\374\246`$\006\246zk-\204T\"\216\332\021$\n\3356\007\026,\244<\263N\002\356%\231t?B\377P\037\005\200\377\215\020B\266\224)\005V"
+	.string	"T"
+	.string	"R"
+	.string	"\241m\371\340\222`\206\206\001\231\033\002!\214\311\3631\236\331\263\353a\304\213\335\035`\001\3355\333>\314Q\250\354Y\fE\270\376\342\302R\201cw\275\222\217l\327\342G\3335}\271\352\251\362o\363x\003\323i\271T\236\034\202\335u\266\\\031n\275\355"
+	.string	"\266\033\330I!\232\376h\332\223\351.\323\\\246\267Lk\231\216\231\326Lg\246?r\016&Rl(\340b\367\302N\216\235\241\301 \361\330/{\332*\277\305m\f\222\031'\256\206\320\266\324\264^\fV\234\205\3521\343|W\030<\254\032\0136v\327\344\232\027\204\335G\033\215g10\031\233\252\206\3647V%4\215\272)IN\210jJr\003D\243r\251W\325Xc\365b\311\035\177hj\324\341\241W\007\260\030\254\035+\271c\207*\251!\354\307\335]+\b\217\036\273E\227\371E.\273C\017\377\220\307\374 \237\371?N\363{h\032\024\245?\370G\332R(\024\b\335G2\201(\355\364\201\nL \212\253p\233NP\021R\245\223\227\362\235N\237\311K\221P:y&\020\345\235"
+	.ascii	"\3607\001\005\364R\337\007z\240po\217\264dEY\f\322\321G=\n\322"
+	.ascii	"\257:|\364\235z4sD\032\322N\017\300tV'8\025\275D\224SR* \340"
+	.ascii	"\2421\013\036\024\202\025P\006\374\260,\201\256\2114\330p\337"
+	.ascii	"\200\3551\331q\f\341\rfaP\034x\322Q\276\241\365\231\001\037\213"
+	.ascii	"w\352\232\224\021\213\006\336d\363\n-\224\244\207\342K\004-\264"
+	.ascii	"\031\300\346\fG\262N\300\256d\234\304\016\311:\021o\220\305\001"
+	.ascii	"0\217\251=d"
+	.text
+	.section	.gnu.lto_scaleRangef.20.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`b\001]\r"
+	.string	"\366XYC\020\221\232\016+\2048]\0320\017\257\234\202m\266\241\207)\230\020\006\366\3521\271\346\364O\353\367z\326\2337\262\232D\255\216\3774\362\025_oIm\204\255\310\255\300\005\320\250\013st\304\254\033m\"wJ\001D"
+	.string	"M"
+	.string	"?"
+	.ascii	"\231]\030o\305\356\032p\201\352\322\266o\342'8;\224\276\020\""
+	.ascii	"\036sB\322Rcw\257\315\003L\227\322\001L\227\n\342\334#\347_t"
+	.ascii	"\t\306{)A\361<R\nv\327\261\004E\303\255\267M\300\366\003\373"
+	.ascii	"0\002\217\216\217>\307;\314@1\002\301h\367ddc_H\026$"
+	.string	"\036\372\301G\233\363U\\d\013t\270\301\320\261&$\033@\016B\016+O\006\001]\f\007\032\273\353q\351\006.\016\245\2165\371\244,`\271\001\262\"\343\300\007z<^\305\241\003-2\252Q\020Q\007\212z\255\364.\272\022\224N\032U\266H\225\364\n\301K\321\201>qd\177\236\250\037\354K\273\273V\017\266\036\2725_\3713\007\357\352\337O]\345\237\316\362\313\273\374\322\2435\234G\370\f\231:\233\210\204j\206`\332&\263\2511\300\264\215\262pc\037\333\204\016'\273Ff\226M\354\032\241\300\311.L\333\256\217\001\236\025D\264\2533\247vY\337\336\266tsA?\226\252ji\214\321\245h\264R\325\004\336K\027   #9j\003\034\202\r(\003\272a\367\302\212\303|\023\215\036\n\234\260\021\372\246.\032\031\321f\340\215'3\261a{\226b\363\332\346\016W\262N`G2'\260#\031'\2007\300\342"
+	.ascii	"\236\307\32422"
+	.text
+	.section	.gnu.lto_normalizeV.21.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`:\002\315\020"
+	.string	"6 nE"
+	.string	"\223\223\016\234\374Yg\225msp\256NHF8\356\301\360\224\330!s\206\234|\230\206\321\360\276\271\366\215QF\340d\031\310e\224\206\261\227~\327\240>\277\204"
+	.string	"\254\r0\304\220\355\306sl\333\b!{K\231RW"
+	.string	"Q"
+	.string	"]"
+	.ascii	"\360\333\021y\332Oq\025\252\277\240<\300\356\212\213\232\335"
+	.ascii	"O\304\t\266G\177'\220=n\027\220=Ze\353\370\307\262\237Q\351 "
+	.ascii	"\023dw9-q\325\241\246\312\327H</\330\352P\3045\004k\301\321\356"
+	.ascii	"^\346\351\001\306\312\324Hv\327\371\202\205\270\343mG\260\355"
+	.ascii	"\300\316\226\366\341\356\256u\305\376\367\003x\314-\372\313\037"
+	.ascii	"\3124(\323\237L{2\275eZ\313t\226\351\230i\230i\315tf\372\003"
+	.ascii	"B:4\036\304v?\304\204,N\264iy\314o\3772\006\371+\016\243z\214"
+	.ascii	"i\266\025\210\002\256\034\026\235\335U\360h\006\333\343(j`D\013"
+	.ascii	"\f\216V\356\330\223\233\332\235\206\354/\221\216Z\272\262\246"
+	.ascii	"Q7\375\217L3\325T\033\222\372\213L!@M\215\nk\270TX\031\263\252"
+	.ascii	"*\324\230c\303[\250.\270q\275\246\352\f\327\t\2269\234\205i\266"
+	.ascii	"\335m\340\317P8\331L\240d\217\327\350C\006\212\227\224\214\331"
+	.ascii	"\337*\225D&\236\205S\tC\346\245J\025 \t\225R\223FR&^\211\211"
+	.ascii	";u&SG\342N\027JL\034\t\225\342F\016\270\313PBq^\327\2418\320"
+	.ascii	"\267\207\253+\226\300\003'EY\020\24412\005\251\347\002\344\243"
+	.ascii	"6\252\037\365\\v\270n<Z3\341$d#a\274z\210\364\352Q\317%\307u"
+	.ascii	"\303\312\335])\215\355D\260\005) \240\202\031\261\341\003\263"
+	.ascii	"\320\216\307\020j(\312\366\256h\\\263\262\332\266\r\332\0250"
+	.ascii	"K\313[\321\fb\316&B\222\024\260\251,\366\fLJ[\0341\341\220:A"
+	.ascii	"X\230pS\232w\304o\020\313T\\T\fA4\023\013vD6\257v\f.\212\007"
+	.ascii	"3\214\b\200(\340K\032\260x\271\355\352z"
+	.text
+	.section	.gnu.lto_buildRotationMatrix.22.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\342\013\375/"
+	.string	":T\320\021D`\236J:303[~qir\240\356\201\003*\037\177\301imE\t\235\006\346\020\342;\321:\211\027\276\237\207F\2642\334%\261|\246\215\302O\335\203WE\333\341\245\263\377\275\275_\253\255\221M\210\224I\006\023\001\350"
+	.ascii	"\n\001|\373-d\311 I9\345\261\354\263\354\260\n\331\204%jR\374"
+	.ascii	"\312\376\004I\272\355\335\n\212O\331\245\037x\222ri\232\242\330"
+	.ascii	"\035\376\334M\261\257\262\303\024\247\262\302L\363R\223\b\037"
+	.ascii	"\0309:\033\202?\353\237\034\312\243\\o\207R|X\310CB\001o\225"
+	.ascii	"\004\204i\312\245\311\236V\360NnG\366\273U\006a\250\031\3550"
+	.ascii	"2\027\230\246)\324\317\265\n\376$`r]\213#\241\324\314.\255x\336"
+	.ascii	"\275\334\347\310N\367\342Ci\372\246\334K\323:\251u\n\376\334"
+	.ascii	"\272\027\325\237\301\003\250?\227l\227\315\353\340\322CYr\366"
+	.ascii	"\204N\232\246\3056r\262\023\201~\206>\302 ZO\263\231l\177\275"
+	.ascii	"\013\321\326`\234\230<\320\217e\222\177\334>\3641\306\215}\332"
+	.ascii	".\274\030\265\036\177m\034,0\344\006\333\321\263\276\027\210"
+	.ascii	"Sc\343\272\343g\214-H6s\274\315\247d_\016\342\332\321,\nCD\315"
+	.ascii	"\263\234\323\326\314\230\321\2544M\227\321\326n|\203\276\273"
+	.ascii	"zv\327\303\356PE\335v\177u\350\312x\317n\335\221\273\310\356"
+	.ascii	"\315\264\337v+\357V\345\325By\263P\336\b\307\362\205Py\261*\357"
+	.ascii	"U\345}\200\362:@y\033\234\357kUy\253*/\003\224w\001\312\253\340"
+	.ascii	"_\276\t*/U\345EPy\017\240\274E\224w\352~_\251\312\033Uy\241P"
+	.ascii	"\336'\224\327\351\200_\003\225\267\351u\277\200\337}\227\216"
+	.ascii	"\367Uz\3367\351R\276H/\363=By\003\240\274F\225\267\250\362\022"
+	.ascii	"\235\356\007Py\207*\257P\345\r\252\274\304\312\013Ty\177*\357"
+	.ascii	"\260\362\372T^a\345\rV^\264\362\326\312{V^\263\362v\345\345\312"
+	.ascii	"{\t-\207\315\b\223^\326\2456\366\340I\301\234W\222\034\313\317"
+	.ascii	"\367\177\371\375~\300\277\314\177\367\343\375y\277\224\373\354"
+	.ascii	"\276\314~\251\004p?FL\230#~\373?\270/\373>/]\336\002E"
+	.string	"\375%\320\020\252\315\347\201\2172\n\320FG\035\240\373\250\277\374i\352= T\177\314P\b\325\026|\340\021<9\365\223\201vjj\003\3751\335M\3750\035^\207N\037I\316\321\371p\357\375\016\364\377\204(T[}\340\253\212S]\224\352)n\251\376_\220\252\367_\030\364\373\320\023\252\315|\340\257\026(\350\005\tZ\001U'\350\367]\315\271\251\372]\270\016\347\r\367\365\316n\311\267\344\034]}\357\371\036d\231\235fkA\265\361*\231\266:m\331\334\301\327\274A;\260\352\006o\253\376\026\223\310X\275\307\022BD=\232V\233\r\203\255\304\t#\244\273\310\326\375D\315\352\017v~flg\t\374D\215\320Y}$\204\216\320'^\2333=X\r\241\237\345L|K\244_\231\362Q\316\344\200I\227\315\322\264\214\351\215\325\267\362\241\273# ^\362\270^O\263J\"\334.\211\243\371\n\246i\312\340\f\006\343"
+	.ascii	"\270#?\367/\352\317\007c`^*L1c\227\230\261+\250\002\314K\214"
+	.ascii	"\005\230\227X\020\314\3505\3065f\f\013r\215\225\b\001\342\334"
+	.ascii	"\256)\261\021c\\_E0\343\327\227\261\253\b\346\305\365"
+	.string	"U\354\n\023+N%\255\321D\210\260\342\230\321\030V\034\226\335\004:\343\326\234)\177\036x\242N\253\320\005LY\037w\250\205\004\001\262\325U=\324.\350\376\204\372\207\233\017\245\016j\241dR\007m!\366`\343\001\324KMl\223\fR\tR\003\365\367\350\224?:r\340\030\366Ow\236a\207\321AA\372\364\232\232\ra#\265\217\222\245\026\356A\306\005\273\006\215\264\244F;\330\246\026dR\251\321\276\334\334\034\004\215\344\0312\316\276Z\352\317\363\r\233:lU\212\315\370\310eD}v\355\316\203\214;\236\0356\267D\232\315\351*\213\314\354n\324\367\\ \202K\323\324*\303\365h\3103\201\003\321L\213\372\223\363\240\271\251\352\2506\333\305\334\037Q/5\226\336UG\265Rc\331\021uR_\335A\306muT#1\001.\217K\274\270#\261{_&\200\334\250Q@$\225R\246FD\244\240 I!\215\001"
+	.ascii	"\003\021\231\352\034\022`SE\n\203JAl*\243\240<\r\233\001\200"
+	.ascii	" \32690\020\306q;\2453<}\250\226\347\276\246M\036j\303\325\033"
+	.ascii	"\027t\260\240QIK/\217\213q\322&_.Biu\254\f\215\023#\204\022\310"
+	.ascii	"\325\221\257\321\2323\225ts\243\204\216\035\304\236N\371`\344"
+	.ascii	"9\221\360\256\272@\177\307\301\325b\363\025\017\332\033(@\033"
+	.ascii	"\3240\001\n+}m\022\371;P\0330\345\300\224X\364/\216\r\034\017"
+	.ascii	"\344\fJX\n\t\355\233\327\361\222\306Y\361J\335$(/eX\276\300C"
+	.ascii	"Nn\326\2007c\275\2049s\356\354k\"d\326e\035x\363\366\265\255"
+	.ascii	"\2447-ik\235;\373\002\b9\271\254\003o\376\372\ts\346\334\331"
+	.ascii	"\327D\310\254k\353h\300\315\337\255\007\341TF\315\211\031\244"
+	.ascii	"\241\200\215\343\021\350J\205\272\013\031\253$\354X<\356\301"
+	.ascii	"N\f\276\321MC\233\370f\375\350\020\372B\356\261v\220\233O\025"
+	.ascii	"\344\276\245!\021\307\260\013ic(\222D\234\025\330v5Z\027Q\350"
+	.ascii	"O\273\032\255\033R\"\340\363\257\273\034\007b\001\330A\244\322"
+	.ascii	"\353\317\036\001b[\\\243\277O` @\366\204\037\214D\007D\316\341"
+	.ascii	"\032\324\301\2049-F\341\216bC\314\243\\k\304h\317\001l@\005\005"
+	.ascii	"\002\325E\204\304M\360;n\002l\272\253\377\225pRC\035\332\212"
+	.ascii	"\021\310\024K\375\003"
+	.text
+	.section	.gnu.lto_applyRotation.23.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\251\005U\032"
+	.string	"\266\355\236H\260XUc\262\027\235d4\272\211\024\020<i\305z\016\326@S\357\234\317\230\346\2114\247w\216\333E\362\367Ct\341|\333\247\352\326\237\016X\377\031\357PP8\362G\225Q3\315\233\035\326u]Yv\264-\267\277\224)\005\203"
+	.string	"y"
+	.string	"\222"
+	.ascii	"\377q \273\017\371\364\254\205\371\202\206\212\313\2738\226@"
+	.ascii	"^\234\235\376\032E\274\207O7\270\350\3578\217\335\205H\220<\025"
+	.ascii	"\025|0M\271\367\342\\\364\003\240\252\332O\331\246f\211(8\247"
+	.ascii	"\366q<\307\356A\016r\327\275@8~\367\232\n\214\200\274h\363\260"
+	.ascii	"\361\"\371\327x\321;{\351f\357\336\311\022\n\241,\367^Z\225\361"
+	.ascii	"\335\351\316\277\216\243~V"
+	.string	"\360N\355\204{\257\351\317\n\026w\275m\002\2663\330\343\201th\233<Zc\330?\335\nd\377\367\337\334\367\023\370\320?\340\277\333\346\276{v\363\007\360\241[\366\240?f\251i,\365\214\245\226\261\3240K\035c\251_\226\032\306R\273,\365\213\245nYj\226\245^Yj\225\245NYj\027K\215\262\324\244\245\266\226z\264\324\242\245>Y\352j\251\251\245~\201VS\222\b\303{S\f\233.P,\252q\376.\344\210|\024\310\020\367a\007\344\352W~\252\330*V\262\312\224l\352Xm\255\021\006}^\351J\316D\347QzK\232\320\373h\2748\326+%\235\352xt\302\305\254\326z\252\261 \320\347\211z\n\216D\347=\220\216\\\250W\353\211f\310\352+\255\242\357\204\r\037:\264\021\237\006\220l'x\021\235\002\275{\257\003\333\211\200 \207P\270\t(1^|5\220T$\304'\004#\233\020?\362\311"
+	.string	"\306\314\"n\3443eE\330\300/\262@\""
+	.ascii	"\022\215\213~9^\224UqI\023S\220\211\035nxn\032zF\016\033nF\236"
+	.ascii	"\233\206\236\323\b\033NW\273\260S\332t5]\211c\365\3349\013r\037"
+	.ascii	"t\265\033m\247\274\335\312\034\332\216\255v\243\345\340r\264"
+	.ascii	"\0052\227<\036p4]Y\342h)\363\276\002\031\203\020h\242\372\230"
+	.ascii	"\246\3329\3523Sa\225F\246\316\324\032!\345\321;\224\211\2510"
+	.ascii	"\025\366\25215\026\0246iy\271*\fS\026,.\246\227z\245UW\365\205"
+	.ascii	"U[\265Fh\245\n\025\226\252\272\324U\252\252j,(eI)\205\252.P\236"
+	.ascii	"$\241*\312h\313\r\262:\361\031g\250A`e\024TR\223$e$Ic\300\002"
+	.ascii	"\221\031#;\021\360\244\"J\031i\b\225Q\220\273\001\242$\016Bg"
+	.ascii	"\315?\021@\002\004V\364\251\324L\232\021\375\341\351\031\356"
+	.ascii	"B\t\236\210-\312\303bi\026\270\327\266\355\020\222re\235\235"
+	.ascii	"\251\022\222\341s\007a\030\2412+\315\210\036K\265\371\205\001"
+	.ascii	"\337\025j\254B\225\020H\224\214\227\277\267\324B \302\272\213"
+	.ascii	"O\022\274\322\262\235\216\2447\017\311f\255G\275\322'\036\324"
+	.ascii	"\245\246\332\301N\b\021\007k\331\215\003\230\205\031\374\301"
+	.ascii	"\023Rcy\226\365Vz\304\344\362\235\271\277\311\230D\034\361h0"
+	.ascii	"\270{\317\263\016\215\006jx>\020\202)<\244\224\r\214e\327 \003"
+	.ascii	"\266\341\004\n\220?t\323E\261\250"
+	.text
+	.section	.gnu.lto_rotateV.24.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"E\n"
+	.string	"vSG=\020\0059\035"
+	.string	"\017aW(\244\235?,\270r\340\327?\2620\362\313\366\001\360\357\257\214\235H\310\0325J0\322U^\360\013\200\332\005A?"
+	.string	"\032\200\377\343\310\300\345\240h\020\331F{\247\0241"
+	.string	"6"
+	.string	"5"
+	.string	"\257&o\320y\325^\320yuh\337\234D\331\313|x\224"
+	.string	"vw\243'\017?C\377\345\003\306\225\370\351a\330]\317q%r\323\333>\260=\262\017\n\033\2530\225\277~;\364K\177|\327_\302\277R\232\250zH\001\221\355\252B\257^\320^'\t\302$3lB\237\366[\356\022\276\245\361\201]V\314\314.\251\340\004-)\316n\311H\346\2323{\346a^\242\264\221R\273\342b~\364\204\215\304:\250h\223\342\244&\3669\273\273\246,\373\344O\337\372g\207`\245\246\201f7d\026 \030\246\017\344\034N\236\t\344@\357\023\340\300\211RD\265\270I\"\224\004\310u\333\311\353:\217\264\235L\\\267\221>\324&\002\331\243(}\033\350y\337\366!\367\234\245,C\260\3046(\207\003\020"
+	.ascii	"3C3\215\341\217\370\274\210\257nB\003\327@\237\211\022.\034\356"
+	.ascii	"1\2010P\r\\\001s\003T\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_quickMedianFilter3.25.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\312\003\265\027"
+	.string	"\306\351\216J\300\020)\035[\250r\260\037H\2475\016_\233\301T\272\237u8\016/\270@\272\373\254\303\302iP\026\335\2113\265mr\367AF\332yd\221m\212\242(\314o\375\373\205\346\325.\016;\320qy\003T\214XB\b\331[\312$\003{"
+	.string	"t"
+	.string	"y"
+	.ascii	"\247[\206\367\360\017\261%gi\341\366\3450\314\350\236j\255.\326"
+	.ascii	"U\337\351\274\307w\332\025\266?\313\357d\362cJ\f\301\217\316"
+	.ascii	"fr\017\226\314\016\274\025\265\233\354\243\316S:9,\206\354\324"
+	.ascii	"\340<T\262\341\204\374\330n\030\234\360o\262f&KGc:\005\324Z\003"
+	.ascii	"\334\"\314\003Ls\213\341\251\301\346}\242\317#\336\256v\2639"
+	.ascii	"\203%\265\326\345\332\255\346\273\361\335U\332]\222\335\316\020"
+	.ascii	"2~m\236\335\217\227\377jyU\337}G\312\233\242\274\"\345\r)/Hy"
+	.ascii	"?\312K)\357d\336\236\274<y\017\322\361\304\202\301\214Z%\364"
+	.ascii	"j\324$j\344\363\335?\364\213\330\023\355\270\337\221\241\314"
+	.ascii	"\026\356\230\200Z\341\351\334\215\355u;n\320"
+	.string	"\205b\037z\te\266\0059\237\246Z\253\310\351\212$m0\357\036\304C\304^\302\234\243V\236\"\023\265\226\2555\020\006\270\375\232\266\003!\0252\f\325\372z@n\344:2\354\353N\340(\005\007\243\031\367h\343V\354\351\217\006k,\362\261i\356$\344B\206\241>k\255u6\356\3447\366GO$\032\205\336]\224\353\310\002K\265\326\004\024\251\026c_\004\201\f/\354a\372493\356-\367\252\273O\3330\277(\2767\367i?1\334\333\261\337':\005\342\355f\242f\334\353\256\265\312\272q\273e)_\371\203\357\tI\013\212\213\311\313\245\002{\275`'.\225\024\223\227\353\204\245\305E\002\262\260\225\006,.\027\030\214\3055\226\365\257\315\243j\326\254c\366e\326\272\243\340C\177SPKEcG\261a\360\356\341\004\246\032\267\251\026{\325\223j\216\032\021;\234>1\344\022$\3169\0313l\334\206\r6"
+	.string	"\250\023\374E\372N\303\376\013\260\257;G\013\246\006i\177W\224\273\371\032\301\322G|\265e\255\365\353[\250qP\247\234\251\200DDR\220\202\244\325\200\002\231\252\253\007\021p\2714y3\354\006b\330D|[a\270PB\351\345\3434\312\213\352\226\364\211\222t\020\263\237j\001\267\370\022\205\275"
+	.string	"u\t\323\330\363\342\373\255\026`v\370\213|+=8\bY=\314\353\200#\033\206\334~\b\203@\327\246\311\200\241\213v\240\250\234u\363\254C\360z"
+	.ascii	"\210%\360\241\034\340\005}\232\020,g\316\t\312\220\037\300\f"
+	.ascii	"\214\237\220\361&\244~\001+\f\004\224\203/Z\251\247\201\333g"
+	.ascii	"\370\200C\204\354\024\274\004\303\302L\031\333@\325\327x\360"
+	.ascii	"\002I\300JXc<\323m\311H3\004 3\331T\r"
+	.text
+	.section	.gnu.lto_quickMedianFilter5.26.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\252\006\025\037"
+	.string	"\3663\262H\260XQ:\360\250e\300)\003\344B\003=i\246\031|Z\375\251\335\320Z\345\222!\024\243\221}\312wZi\275\332\330\203+\004\322kNw\324\237\324\237\207\277\203\237w;\34162\276\270\315\332\377\366\177#\204l\"eJ\001\243"
+	.string	"\216"
+	.string	"\234"
+	.string	"\322\274\3618.T\343\033\310s\221\013w9tzX\346\2345\227\007\b/\301\307\302\313may\220w\203z{\f\366r\265X+U\nu\032\305P\202\2537_d"
+	.ascii	"\3368\272\202\313\331<\366\342\260\027@\372\332\335\265s\241"
+	.ascii	"-\025g\251\360\321U\212\253R\240\320\324\211\243N\230\320S\001"
+	.ascii	"\026!J|\\\302S\242@\020O\217\212$\036\262r:\240K/G%\210\362\001"
+	.ascii	"Ib\345<\200\b\200\202d\334\350\272\223\303QP\306\210\357\215"
+	.ascii	"\016\0169J\302\345F\\E\006sN+.\027\342\006p\373\031l\323l\331"
+	.ascii	"\024\272?>\030Q\260x\177l\331y?\214\325//\272cR\r\223\352\227"
+	.ascii	"T\273\244\272%\325,\251^I\265J\252SR\215\222\352\223T\217R-J"
+	.ascii	"u(\325R\252AU/\250VP\375\230\230\217\022\007\2779A\374\264\314"
+	.ascii	"$R)\306\213~\242\237\207o\344\224_t\033mx\306\242'=f\343\345"
+	.ascii	"h\327\370=\247\274\343C5'\3320\332\3604\330\031M\231s\312.-\033"
+	.ascii	"/\277\002\200\252\375\034\327Qs\036\207\277\346\374A\n2'of\230"
+	.ascii	"\361\001\227\343>\nM\334\367\376b\362d\305\325\355\213\220v="
+	.ascii	"\341&`z\217\0178@\204\206P\270:\207+\227\302"
+	.string	"\020\222\016\3324\013W\300.\346\275\333\270\357\335\300\220&Y\224n\364'W\347\023\320\312V\304\251\354\261\335\221\2672\004\245\2036\035\234sNpu\277\205\261\225-\350\313\361Y\333\017\336\273\2750\3159\025H\037\216\212\257\244\3416\302\3609\354wL\334\350\317\2720\273\373\234\031\340]$\374\352>'\bG\177\216\355\367F\2275\216\222t\266\334\350o\027H\210\210\017\273:\233g\023\023n\341\031n\031\332\005\t\030 \314\324*\330ffl2\265\n\023 \314\324dh.\324h\004l\263\020\201\246\206\301f\243\251\245x\363\373\363\262.7\213\343\r\340\234,\026\234\350\237\262C\177~Y\262\021{m\322_H\273\036\030l_K\260W\026\277V\207\004\351*\344\303Qq\271\266\345j\265VK\254\031\020\026kWK\312\232\255v\265\272\331\221juVmj)\250f)'6\234:\255\224\037\217Y\021Q\250=\355"
+	.string	" \032juK\314\tf%<\211{\204I\231\354z\306\325#\037\327]\025p\\\235\307\025w\325d\004\274}a\200\233\250\221PF\221\220\214\210\024\024\244 i5\320\002\221\251\252\007\022`\204=\007\305\350HJZh\375\357\"D\207.X\371][\035\013\222\263c8\037l9\367\001\211\257\374\244\341\252GB\b\226\207\032\372\026\032\360@\202KH\032E\310\025\033IVj7\031\333g\225\242\237\226~\006\201[\354\336\306\031u\325\346w\241\bv\264\201XM\r\333q\355\206F\240\266\246\236}\t0\223\235\262\374\370\032 \264\365\022o+\023\032\223-t-u"
+	.string	"9\360\3429\273\005\3567\027\340o\310y\301\327\002G\251S\230\303N\325\322L\265\354Z\177\277\220\220\223i\b\270\243\234\326-~\344:U\252\003\"\227\f\214\t\274{\0359\005\323\264\320\364\242\363\225F\031\361\0071y1\202&jCV\2036B+\300\311\034\224\374\202\372\265\n\315|c)\352`\252Vh\310\301\256bS"
+	.string	"\372\341\242"
+	.ascii	"\271~\227d\334`\303P3\236\3604\316y\013\246X\024\334f\202X\231"
+	.ascii	"%\340:\2234\253\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter7.27.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\027\013}("
+	.string	"j@\264\rJ\260\224U:\370\236y\2519u/\027\343\334\201\317iC\303#!\311\211\275\327\201\211\240\213.\022.\006c8\305\262\345{U$\303\342\243t\247\264\277\035Qk\341\033{z\265,\351'b\003\332\025m\333\266m[I#\233H\231d\320"
+	.string	"\262"
+	.string	"\303"
+	.string	"\346\351\032\315']Ig\211\244\021\305PY\034\362s\264Rk\035\302<W\236\222\277\225\247}bY'\215_\222\211\007\276\270\374|=^\313N\227\303\335l5\332L\026\203\275\\-\223UR\262\231\270g\311\2201\240\216"
+	.string	"\r\355\034\270\364\227\245\031\354\"\343?\031J\354Kz/)\006\363\220\336\202\004\203wG\327\035\261\340\334\212\343V\250\340[\212\333R\030q\255xZ\021\005\317J\\V\202\004\307F\0346B\004\277B\334\025\002\004\267"
+	.string	"\230\340\360\341\246\022\241\017"
+	.ascii	"\\\b\0211\313\303K\022\346\207\2049\3720%\315Z\253l(\003i\200"
+	.ascii	"\203\206z\230l\321\341\375\247\223@tL\001\ru8\263dj\255\313@"
+	.ascii	"C\034\2760\337\345\005\273+\334mi\b;\335\347\256q\207\273\310"
+	.ascii	"\330E\27347\376\b\226w\346N_ \345}\241\274.\224\367Gy}\224\267"
+	.ascii	"Gyy\224\267\205\362\356(\257\216\362\346(/\216\362\336(\257\215"
+	.ascii	"\362\326(/\215\362\316(\257\214\362\306(/\214\362\276(\257\213"
+	.ascii	"\362\266(\257IyY\224\267\244\274\224\362\222\314\333$/\223\274"
+	.ascii	"Op\023\222DA\220Z7\\a\251H\250\217\243;\375M\177\215\375\323"
+	.ascii	"\276\366NDsG\310tjR$h\236\312vu\366\307}-\2153\351\274\311\202"
+	.ascii	"\271#DS$\"\245\326\032s\2721\346\351\221\374\230w?\343K:7^x\255"
+	.ascii	"\326\"(\036\265\032\203; Q\272\312\325-\205\343\254\024\305r"
+	.ascii	"\365\271\256n\365\316h\252t5g\t\266lUe\253O\241\021^br\216\033"
+	.ascii	"\347b\025\322\354s\315fu\314Jh\366\241\260\372\307\327\2264i"
+	.ascii	"\026\355;A\025\211\312.p\033\337\225}n\331\264m\230\2440\260"
+	.ascii	"\325J}\243\312\323\262uE\002?\022\315\376\361\001\200DA\362\301"
+	.ascii	"\303W\264\317m\0315M\263\2008\346\300\016z\025\223\023\flu\262"
+	.ascii	"\326Z\311>O,\201M\323d\224\017\211\336]\231\037\211\002\230\324"
+	.ascii	"Z\r\320(\240){!\025\210\246\212\375\205~\020\b\036\276Zn\004"
+	.ascii	"\335}\237\027\344\227H\371\346\276\217\213\036\276Z`\277\377"
+	.ascii	"t\nC\307\324O\026\036\276\3526\326\032\017\036\341\024\2765B"
+	.ascii	"\t\016&0\270\031B\300\271\271\301\251\031Bx\300\340fX\223#a("
+	.ascii	"\354-N\204\0069\303\t889\303\227\261~\215]4\3230<\335\263\026"
+	.ascii	"\310ZM\034x\323/\205\306\314\225\005\366\031\365]\324_\372\334"
+	.ascii	"\227vi\233\027\241K\025\244u\361\001\371\255\212\365\373\265"
+	.ascii	"\257wF?_\351\343u/\370\203\354\365\271\275\346u\314\252\027\344"
+	.ascii	"5\257O*\037--\275\223j\241"
+	.string	"\332]\331]\237=t\272\316M\351r\271\233\220\007\016\3277\\\037\312\355V\233\262\365\216\357n\353sm]k\233)\333\223\032\025\244\332L\212&\204\242\365\271\264\236\365\316\210&\234\225\263X\320\210\216\333\226\024\211d\262\216\005e\261\330\213\n\3269`\260~Q\221\260'\374\272\262\257V\007\201\002\250\221\\E\221P \"\222\024\244$i\rA\006\204 tf\035\022\200\203-\210\305\212*\221$\226\373\377\031\322\320\265{\235}\263\305{Sd\357\272\2310%A>\361xp\374\f\204\005\236\254\316]\345\226\223\377\270\223,E\276\277\276\336\316\350|\211\353\223\375\340\340%\365\377\276`/\353\323\372\372\267\"\326%!\366x\001\356r\275\035\204\227\214h:w\017\351\257\263\201;\211\307]u\337\f\204\237\303\213@1u\222\337\236\326\347$\007\211p\026z#\365%\272\346IX\377\033&\363J\231\375\202<\206'\233\370"
+	.string	"\331\272\342\\,XTzb\215c\ttx\034nYopQ\341\006I\304mS\rN\256a\332\031*\326D5K\216>\237\027\214\304\215"
+	.string	"(\254\345e\216\334(\336$\340\366r-\312D\257R\316^f\222\r\305\231%\017\301\363\333\221\230h\320f\215~\354\022&\250\253%!\225}<H\313y+\226\253\325G\312e\353\004\330'\277\264pUlz\235\216\353\2673\001#`\243J:\263\\f|\217-hAp}\315,\325\235\257\r)"
+	.string	"\314\f\034\315\347}\n\262\276\273\240%\221O@O\231\373\017\215\311\244\214\363\030S\237N\\%\236)\231\230"
+	.ascii	"\362\315\001\207_\016\272\226R\207\017\332\207\\vj\364\t\223"
+	.ascii	"VP\252*\016\276s\241\213\003>p\303\235+\271\034\320\241\033\356"
+	.ascii	"\\\350\305\201\016\334\341\356B\3402v\354\225\b\262]fJ,\312:"
+	.ascii	",[\275E\0018\271\351,\376\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter9.28.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\210\017-2"
+	.string	"\272N\364\020J\240X\231\0163\226\027\200-\330\342\034\320\204\212\003\241,6n=\220"
+	.string	"\223.\205\231\274z \375\363\245\200>\336\2471\371\346\252\354\215\243\005\274\016_\216\016?\274\361\006/\303\344(\371n\300\331\361Q\370[\370\177\357-w\222)\005\t\001\342"
+	.string	"\366"
+	.string	"\255l\375\206\343\310\351\243\252\\\201\\\223R\rK,\256\353\032y>[=\253\036[=\277\212>\271\252\364V\361\321\213\304!\2140\b\374\371^z\274\235\213.\207\273\331Zj\264\231,\006{\271Z\254\225*\205:\265\354\232\325\307\307v\326\200j#\t\222\036\244\216\027\221\234\210\264\004\017\2258\214\222$X\330\364`\363\b\003\215\374g\304\304\276 \376\022\004\b\356\375p\336\217\"\274\333\341.;t`]\016\317\345\300\201q7\374v\303\006\266\ty\213P\r\\\203\3414\030/\360\314\205\313\\\264\3001\026\016c\021\204_Iw%W\340\226\tg\231(\201W$\\Eb\004N\211p\224\210\020\370\324C\321\001\310[(>@=\031>?\230\005\341+\013\251A\345-ypV\327\031@F,d\006\225"
+	.string	"3\312\f/r\274\001y\001\2531<\370{\221\253F\232\315\036\244\007\307\254\001\327u\033\367 ;x\307x\367\003\350\356\231\356U.\317\2142\003\350\377\355V\352\340"
+	.ascii	"@Lh\177\212\356\032W\272\3234\356\004N\344]\314\270\211\031\367"
+	.ascii	"0\343\206\311\270\205\031w0\343\006f\334\277\214\333\227q\277"
+	.ascii	"d\334\275\214\233\227q\3572n\227\214[\227q\3472n\\\306}\313\270"
+	.ascii	"m\031wK\306"
+	.string	"]\313\270i\031\367,\343\226e\334\261\214\033\226q\2772nW\306\335\312\270Y\031\367*\343Ve\334\251\214\033\225q\2372\3566\343f3\3565\343\316\031\267\212q\277\212\033\253\270]\001\355\303\023\004M\256\313\241i\311u\222\211\300p\"\367!w\037\355E\235j':\266:>-\221\224$\231\326\263\254;\247}\331\251\346\341=r|\250B\253\343s \211e\352\272n\321s\027[\317\370\304\017\343n\327\341;r\\i\301_\256\233\342H\210\353*ez\330z\016R\327\322\332j\255\240\2547b\261~\005e\315\254~\225zU\f\323kNW\375\333\252O\275\215\214*&\305$\324\251\177\247T\376\n\352\277I\020\3078\234,\n\365\247\257\005M[\324c&){\202]YOl\224\t\364\231\374i\0373\2018NZQ\333\177\273}\366WJQo\347\373\024\250\312\276/\375\365\224\362l~':J\376\254/"
+	.string	"\352?\274fcF\241\261\376\333\353\347\267\351\321\004\003V\352'\366v\256\236\327\247%e|yl\337\227\3563\222%\211\310\016n\312\377\366)\350k\236\355\301E/\376\006\277\322#\212\001+\271\352\272\256\253\376\353\307\265\3705\257:yJ|w\037W\370\362(\204\272\256; ;{\252\2647\241pl[\264[x\337\020b\00775~\232\377w\036\032\2527\322\352\217\337yd\\\300M]|\177/\362\\\243\331\324\300\264\203\233>\r\374\201O\360\256\231\211\300@\002\315\215\321\001\316\315\rN\215\321A\003\232\033c\r\204\b\306\231[\343<X"
+	.string	"\301(\001\007\007\2021\245t\375S$x\336\316_\350\n\252\353\242(\340C\356S\036\t\226B]$\"\021\211?|\022\207IC!t\211\307\256$\177``^\370\265 (\314c\246%\241\020\370\f*Q\203\377v\360\201\277Rz\006\337\247"
+	.string	"\037\370o\222\337\277\375{\337\333H\177O\3639\207\204\332\367\357\023\311\313\313\367\242/\317\336\332\33319\342\260\247\312\373\267y\277\373\225\022\357}\312n\247{\247\213\313\353\226\\ftI:\2344\0075\222\313=N\232\203\342V\334\277\321\"\267\333\333\2467\233\255\366D\374u\224\374i\371\267[\276\36663-1\265&\241\332lJ\223\016ai\264\237}-hJ{\314$\235\315bQ\331\013\221\311>\026\225Ac\261\027\254\t\203\375\013&\363Jz\265\244\256\245#\326\345\372\326\327\202\002\201`\250\201hd\215P \")(HI2\214\001\201\006\"CV\266\001\022@\242A\216N\0316&\"U\230e\377\357a\006\366\340Y\037\371\262\036\224\226\372NH\030;\340\002\374\230r\332w\305\241\264\252\363\300\035\211\030\371W\250\246\036\315"
+	.ascii	"\324\035#\231\377\363\313Q\007\340\343{\277\201U\260\330\323"
+	.ascii	"q}\334[\223\363\273C\226\305\211x\314\345\007\305'\013\304\311"
+	.ascii	"\321\373\216"
+	.string	"\302D<\2531RI\251\3772|yi\003EfRo\037\017v\307\352^\037(i\350;H8\320c8\202\002\034p\221\204-\261.\345u\305T\325\252\373\375@\332\337<\263S\267\273\026\30222\227\307\035\216\331&&\332\302R\202Y\266\335WP\264c\\\026\013\237T\362+,\213\200fVT)\266\275\253b\306\r\241\200\027\030\024q\363E\013\266\300\272\340\267\337\222\220\204\334hq*\314r~\331\024ojM\272Ua\332t\305\337\013\r\320\034\252\024\211twf\020\260t\336\313;\237F\206]\340.\310ei\334\020k\200\301\341\257\325\314\214M\303lK(\211\312\224\302e\324\316d\320D\343Y\f3\001[Q\260\030\004+6\264C\330\352\204\303\352\224\213.$\262?;\2165p1@0!\211\343\023\037WO\300:\t\266%\334\221\360\206\001\221m\211&\001\356\003)\324\360j\025L\346\313\376\377\026\n"
+	.string	"y\344\322bC\373\303\352a\013\317S\256v}\335a\306>,\360\215\004\021\021\nJ*\300\370v\207\276\250\237a(\246\214\313\017\f8)>\337\214Y\335g\321"
+	.ascii	"\341\265\210\037\rx\347\272\350\332\365\023\276\362\031\345\331"
+	.ascii	"\251GN\003I\002k\225O\340\252K\201\226)\241\200X)\221U\b\221"
+	.ascii	"PU\t\3202%\024\020+%\262\n!\022\252*\001Z\246\204\002b\245\304"
+	.ascii	"dC\245\275\022L\254\227\247\261}gX\315\207\241t\023 \353&\376"
+	.ascii	"\370\007"
+	.text
+	.section	.gnu.lto_quickMedianFilter3f.29.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\332\003\305\027"
+	.string	"\366)\217H\320\362&\035R&\364C"
+	.string	"b\375\207\344-\263\316\220\233&\024f\327a\3573\0012\250N\361\225\274\337sT\266\375L\332\263\214v\\\253\221Z\215R\217r\006\030\332@\232\274MOJH\232Y\242gj\215\020\262\267\224)\005|"
+	.string	"s"
+	.string	"y"
+	.string	"\227\016\277\213\370\b\230\275\024C\f\032\336$\201\307\006d\316\331Z]\325]\306\223t\227{\301\373\030\336Qa\007S\250\317\353d\\\205\371^K\f\301$cF\213\035\244\360\024\005\"E\245X"
+	.string	"\032\372W\343g(\245\303\217\220z\023\336\305\025O\\\331vTF\001s\316"
+	.ascii	"\264\b\361\200\366\320r4r\b\372>\351\321\005\323mF\013\272z-"
+	.ascii	"sN\353\214\006t\213\334v\r\333,\366\222\b1\375\334\"\373\344"
+	.ascii	"\341o\"\325\252\337nP\252SR\215\222\352O\252=\251\356\244ZJu"
+	.ascii	"\274z\243Z\243\372(%\037h0\3701\247ON\310\234![l\370\355G\372"
+	.ascii	"\t?\311\240\177\273\371b?\337\255I\210\365]F\033\346\333\f\332"
+	.ascii	"&~\004;\022\316\027\373Y\320\344\303c\316\251ri\225\031\"W\373"
+	.ascii	"$^\002\366\320J\037\231\263H\005\2139C\226\r|\001[s\267r\035"
+	.ascii	"\034\305\320\321'V\267%F+\337\336v\002\270\025 Z\3104'\267fT"
+	.ascii	"\206=Yo\246*\007\267"
+	.string	"\347>\216r\350\350\323\343\234s\306\255\375\246\003\367d#n\247\302\332\206\271\315K\005n\3149\023H\334\314\311W\202\340\245O\203o\245}\017\221Ls\3265\331\335\357x\2107\214\356\253\373\235\0169\2323\270\337']~`\272\361\f\221inw\316\031\333\255\331a1\237\371\203\373\205\245\006\306\306\305\325\222y\271\\\257\227\226L\214\213\253\365BS\323bA\361k\246\001M\313\346\365\242i\201\341\374\347\026\251v%\333\034\343\3049-(8\322\317\303\004K\025\304 ju\2508\311\016/\2655\247\026\265%O\251U!+\250\001=:\324\247)\256F\270\370m\315\337z\013\300\351\205\336\270\275\roo\373\210\f\034\353I\326O\2540\022\352\026\301\215\243\270\211m\346$\323\234\3039g\027]\250aX\246\230!!\031\221\202\244 i5\240\002\231*\243\007\021\2009$\305\263l\006\"\314\214T\276!|\374\216\304"
+	.ascii	"\323\332\360\343\275\217=8\215*\224\370\350\306\336\356AgG\205"
+	.ascii	"r-\307\205\357\315\207\200C8.Ol\222#\306\243\275\211o A\226~"
+	.ascii	"\035\240\204\034\244\0274y\330\207J\316\025\237\035\347\225\r"
+	.ascii	"\354\346\271gAn\022\340\026\202\201x\230O\250\351\363\233\345"
+	.ascii	"q\235@\031\376\201\354\333\356\r\205a\202\226\2173d\027}H\260"
+	.ascii	"D\253\364Z\024;\303p\001\225\356\342:\230oZ\220)\243\366P$\032"
+	.ascii	"<\360\220N\373\226'\230\304)\260\034\244\327\tp0}\364\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter5f.30.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\310\006=\037"
+	.string	"6\364\262H\260\226Q:d\322\231\235\243\031\322(p\350Q9`C/\260(Z3\273\341m\355<\307\211\325 \207\3140\364V\273\232!\227\345\333\031\264p\177\320\177X\340o\343\367]\216w\017sw\334\265o\377\333\377\244\221M\244L)\244"
+	.string	"\216"
+	.string	"\235"
+	.string	"\322\275\3615n#g\377\302\336O\320\237zp|R\346\2348\226\007\020/\303\323\304\313ea\371\260w\207\232;m&\213\301^\256\026k\245\032S\242\fWs~jAHc)\212n\207\346\264\026\237\265"
+	.string	"R\031\3571\336\217\302R\374\225\242G](\336BqBY&\2762QBU\005V\200 \361\021\211\016\211\002B:<\232\032q\361\265\203\023\262\370nT\206+\340\321\357\265\323!D"
+	.string	"$\364\342F\327\234\035\033\r_\210\370\336\350a\220\245\237nG\3045\265`\316i\325\355\200\270\001\334>\006\3337[\034\020\272>\300 &R\274>v\355\275\337E\252[^t\323\244z&\3252\251\216I5L\252_R\355\222\352\226T\263\244z%\325*\251\036\245:%\325\242TK\251\016\257\336P\255\241\372/+LG\034\004\347\374\020\2442\215\310$\027/\372\211\256\30372\313/\3220\322\350\214EO<\333x9\3329\337g\226\235\343C\271\023m\030it\030<\3758\231s\326.]\033/\257\002\300\325\376\215\343\310\275g\244\313\346\364\351\361c\316\236\315.\343\003M\267\324\336wY\021%\233\332\235\355:\216x<\342\"p\372\216\013\360\351\240j4x@H\f\033\342\356,\256\334\tCL\0344\312&\356\n\357e\334\373n"
+	.ascii	"\b\234\222T\243A\271;\253\200\266\266)\235\326N\333\034y(CK8"
+	.ascii	"h\324\3039\347\fww\r\"mk\033\002oz\326v\203\373\374kq\232s&\220"
+	.ascii	"@\035\224\237\224\301\2771\3107\322>\247D\215\006\255\353\262"
+	.ascii	"\273\277\201\021\336C\304\257\356o\204l4h\332~ot)c\351\207S\245"
+	.ascii	"F\203\273@@Bx\330\335\331=\232\022^\341\030n\230\233\205\b\027"
+	.ascii	"\036\304\340(\310\304\304\310\300\340(Hx\020\203\203\231\261"
+	.ascii	"\200\273\021\260L\005\b3\270\0132238Vo~}Z\226\245fm\274!\234"
+	.ascii	"s\205\202\023\375Nr\264(\315\240\311\366w\331\021\217g6[Y\323"
+	.ascii	"L6\305\262\335)!]k$\321A\305b\013\213\301`\256\246\227\355\350"
+	.ascii	"\365ZW\223\276l\256u\355\316\346\343\002|o\355\316\255e\355\204"
+	.ascii	"\226\215%d\206Y\252e\322\343\264&"
+	.string	"\251\325jU\273\022u[\255RyQ\315\236\210\252\324*9)\023\217g\274)\217+\017\030\216\273\363\270\251uA\021\to\340>\200\237\250\201`E\221\214\214HJ\222\222\264\032\340\002\221)\252\007\022\240\2045\006c\315\225\024\245\230\375\337\002\310g29s\3741\252\035\367\374\\>\326\306\035j\325{\0351\271\220\330a\006]\274'\005<\322\217\013\354\n\375\254\0357\204a|I)\267\t\016\320B\371\261\203\243\366c\250Q\031\222\267\035\034[S\347\201\303\270\004\036@`s\275\364\336\346~Ko\345M\276A\316\260\230wqU\256\200{\336\200_QsaX\245\301V\244s \330\005n$\303\325\340\007V\013^\322\n\211\364\333\354\251]R\024\372\3138[\233\3633h\223\025[\235}\231\247\277+!=\235=\353\322\261I\372=\223\222\203\340\030\0020\361v)1\372\017\357\367\244\217\225f&S!G-\266"
+	.ascii	"\343\331@\253\261\036#\221\245\210\b\250s\021\364\246\356\306"
+	.ascii	"0A\221>\340:\223%\233@T\261\3040\225\323\200\273\202}\bF)E\""
+	.ascii	"\243\346\023^\374R\013\345*\026\r'\234\027V\242\022(\237I\232"
+	.ascii	"\325"
+	.text
+	.section	.gnu.lto_quickMedianFilter7f.31.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`K\013E)"
+	.string	"\232A\334\rJ\220\230U:  \236G2\225\017Ja6\3112\367\240S\312Vo\371f\246!\245@\231\202\f\255\334A[\371\033\025F\337x:"
+	.string	"\002"
+	.string	"Q$\022\001\362\344>\201"
+	.string	"\021{/]\300\205\353\272\256\353\272\256\353\332\222F6\2212\311\323"
+	.string	"\265"
+	.string	"\310"
+	.string	"E\341\0160O\267h\336\350G6\273Kd\021\305\320\237\212v\214Tj\255D\226\337\312S\362\265\362\264O\254\352d\361K\262\315\203\300\237\257\307\333\351r\270\233\255F\233\311b\260\227\253\305Z\231\252\222\222\3156{\225\013\031\243\210\021\236\237\233\007\223\016L\222\301?\244\373\220\216\270gt\236Q\f\336\025]W\004\203sD\307\021\261\340\333\212\333V\fqM\305i*R\360L\3502!\024\034+qX\t\022\374\032q\327\b\021\334\nqV\b\020\274\002`\202\303\207\233I|>"
+	.ascii	"p\341\003\304*\017/I\226\035\222\305\250\303\2244k\255\260\037"
+	.ascii	"\r\244\001\356\371\311a\262E\207\367o\234\024B\344\310\363\323"
+	.ascii	"\341\254r\251\265.\363\374p\370\262|\227\027\354\356pw\205\024"
+	.ascii	"8<\325]\254\365\246\373\334-\336p\007\025;h\027\346\305\037\001"
+	.ascii	"\345}\271\3227Hy\201\224\367Gy}\224\267Gyy\224wGyu\2247Gyq\224"
+	.ascii	"\367Fym\224\267Fyi\224wFye\2247Fya\224\367Ey]"
+	.string	"\224\267EyY\224wEyM\312\253\242\274%\345\245\224\227<o\223\274L\362^A\016\b\t\203\246Z7LY\251G(\020\242+\3755nc\177c[{\245\013\346\215\217\251\364t$4Oa\2736{\343\266vg\234\206\315k`0o|\022<\031E\251\265\266\234n\213y\372#\276\363\356e<\311\346\305\355\361Y\255A:|\324\032U\266\265\352~\322PX\302n\322q6Z\242b\365\271\254^5N\352X\262\232\255\bW4)\345\252\317\346&v2\233s\234\205\230H\263\3175[\325\257\250\241\331?\252\372\306\317\2144i\025\355\333\340!\004T\022(p\034\317\031y\242px\252\354s\313\246-C\303)\003K\255\323\227\251<-\033'D\300\354\033\037\200\311H\021\020\034\236\242}\356*E\303\264\212\207[\036\354\236O\241\341$\003K\235\254\265V\262\317_(\203\r\323$\223\016\211\336]\227\033wI"
+	.ascii	"\223Z\253\001\312\304\023\265\037ba\227\314\241\375\366\350\367"
+	.ascii	"\200\300\341\251\345F\320\335\327yA~\211\224o\356\353\270\310"
+	.ascii	"\341\251\r\366\3737Na\0209\356\\\t\020.\341\025\2761\303\t\017"
+	.ascii	"(4\230!F\240\231\231\241\211!F\200\320`\206\030S3\2018\344-\215"
+	.ascii	"\004\0075D\n"
+	.string	"445\304V\261~\213\035\364\322,8\235\263\030\310ZM\034x\215?\312\214\227*\033\354\223\3519\343\201}.\260\177-\003l\334oI\321\376zB^\203\242\362\371\272\3278)_\257\354\355\232'\fB\362\372\\^\357\372\025\305\023\356z\327'\024\020]\237\253\353\\\313\350\032\007\225SRes}\376\300\341\372v\304\335n\265\241\017\233\255k\266\376\261V\233\035i\275\364\234\361\264>\227\326\263\2269\322\236fJ\212f1'\331\260\207\254\317\225u\254qR\262a\254\214\275\232\233Ns\022\002\202\301\372%\204\275^-(W\357p\271\272\005E\272\236\270\025\201\007\250\241PF\221\220\210\210\244 )IZ\003\021\006\204 \345\234u\022\300\203)\307b\025U\"A\323\302\326\377;\3028\347\255\356\376(O\275o\344\245\271\333\316W4$\3228t\251\372p\362\356\201\243E\340\210Yc\\Sy\201l\236\345m\203"
+	.string	"\347\207\265\376\362&\211_,\rBQ\1776\263\331n\334\232\362\310\267"
+	.string	"\215\232\255`\271\331\204x\262o=\235P\342:\245\036\270\355K\271wd\277O\327\216N\002\312',\262\006I\327\021vT\366F\r\373I\243\270\214Y\266S\311\232\004\013\270\2428=nx\313\350\271x\275\375\026?\325\030\251\213\023\240\201\013\200\275\311\216G\013\0339\001m\344I\036C\005oY\312\231\003c\016\206)J\232\367\351\315;-\231\030\214\350\rV\313[\340\334\234\314\007}7[D\t\344t\023\303\340H\021\247\332\340\003\215\203\2473\2222\007\260\005}z\236^\251\341\331\235*\323?X\300\243%\363\366\3613\224\220\n\023\244qJk\215\005\364\340\277)\211\341\020\021\346\272i\303\027\316\247\321\253r"
+	.ascii	"]\337\024\316\023\247\035&\240\247\307\223pZO\203\245)\355\301"
+	.ascii	"''\r\300i\022\002SZ<\023Y\377\271\275\013\371\\\220\2362\314"
+	.ascii	"\017!\313\003\231u\034\373IN\260\022\315e\246%\226\213I0\363"
+	.ascii	"\353Fo\232p6\024\242\022\332r\3414\240\360\212\245\252\332P\320"
+	.ascii	"~\332\302C\355<\224\205\207\332y(\013\017\265\363P\026\036j\347"
+	.ascii	"\241,<\224w\3466\274g\301e.]\211\351\235\314i\2737;\200&7\235"
+	.ascii	"\303?"
+	.text
+	.section	.gnu.lto_quickMedianFilter9f.32.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\322\017\0052"
+	.string	"\252N\354\020J\240\230U\007\n\320\323D\265x\367t3]\262o\263*2\277\272\342\002\211\334\177DdN\360U\336\0211\210\037\017\3341SI\317\002/x\035^\207/\247\034\221/\205\350\013\301r\204\342y\222eY\226e\331\310\336[\356\224R\n\b\001\335"
+	.string	"\366"
+	.ascii	"\314"
+	.string	"\265\221\032\207\017\263\023e\256p\321S\23464\265\260,\2133l]\332\027m\\\332\367U\260\253Qf3\352>\235\244\231\221A\306\034\215E\030\342P\370\022\004\376|=\027\336N\227\303\335l5\332L\026\203\275\\\253\232^\364\335\207[5\200\336\230\202\022\"\372\351\244T\323H%\361\231\250\226\211B\342Hg\3078\235\374\330\324\306&&/.5\314R\020'\002\351!\020%\027\356\350\227\035:<\230\243\2019p\370\017\251}H7\274w\324.G6\234\027\243w1`\270\356E\347^\270p\\\213\276\265`\341\266e\327\226+\234f\242g&J\270\214D\307H\214p\230\210~\211\b\341.\"\n\017F\275:\0312\"\316\030*r\025D\2473\242\r\350\260\031\344\027Mi\0305\315\2104\240\004\230\240\320h\245v\016D\030\034\225\361\241\277\225\0325\242\304)D\364\241]5\300\262,\273\020\221\207\346\232f~"
+	.ascii	"\314|\303,c\020Ph\030\375+\231\231?\036\300\210\251\345O\301"
+	.ascii	"\254\323\314\356\234\353\234\240\223\232\223\327\231\346:\317"
+	.ascii	"\\g\231\353\214\274\3161\327\371x\235\215\327\271x\235a\2563"
+	.ascii	"\361:\017\257\263\360:\277\\\347\340u\006^\347\337u\366]\347"
+	.ascii	"\336uv\271\316\274\353\274\273\316\272\353\234\273\316\270\353"
+	.ascii	"|\273\316\266\353\\\273\316\264\353<\273\316\262\353\034\273"
+	.ascii	"\316\260\353\374\272\316\256\353\274^g\365:\247\327\371^g\264"
+	.ascii	"\235\037uv\324\271\025\360\2164A\260\305\262\035\266\264X&\227"
+	.ascii	"H\214N\352\366\321?\270\225\030\306\235da\375\031Z\223\246D\331"
+	.ascii	"\254}s\314>\334M\2061\363\350\036>\355\343\302\3723t`\n\022+"
+	.ascii	"\226e\223}9\271\366\365\023\306v\346\326\321;|\232\311"
+	.string	"Nmc\331\024KBX\226i\3033k_\016\262v\366M\263\331\313\332\331\215L\006\373X\rS\363\232\035{%\307\036\366;6\261\032\330\363\210a.\253\247\362V^\317\207ZjGz\242\276^\357\372]\226\325\372z\327z\252\256\333\225\324\245VA\265S\313\242\265\365 \355\313't}%\257\257\276\354\252\252\371\351;J\213\252\337\315\266-\221\362\352\375\376\321\264,J_@\333@\232\327\024\272\002\362\255\036\023\224\032\351+9\375\373;=\2462x\026Sy\363S\3327\375\335\322f\375nv\361\251\n\026\021 \337\272\257d\027\213\327yU\310\223\235|\016\235\245GU\006\317j\224eY\026}e[H\223\257\363\350SP\211gf\237\025\335d'\262eYv\300}\022\272\342\236\252\300\316\325\0057;}s\b\001\344[\354\237\363\377\035T\003m\226J\373\375;h\006\006\337\342\344\367\267R_\033J\234\033\266"
+	.ascii	"\371\326?S\016\032BSh\326\271\221\320`B\016\017\316\203\036\036"
+	.ascii	"\236\036\035\234\007\016rxpt\"H\300\271\361q\017\204\005\021"
+	.ascii	"p&\364\364D\300\2011\331\376\024\t~\b\364\030\370\002\312\262"
+	.ascii	"(\n\264\217n+\036\t\260\034q\222F\212\346\225L\3633\277CE\363"
+	.ascii	"\273\231+X3\3106I\343\254,\213dd\036\331\312h!\221G\252\2306"
+	.ascii	"*&\346\217T1\355\361\217\257Db|%\033\277\370;O\343\357\212W\216"
+	.ascii	"\270\370J*(\030\230'V\301P\021S\242\020\352H\337\246\320\341"
+	.ascii	"+y\370\302\227]\r\277\243\b\205\301\177zy\371\240\326\313M\020"
+	.ascii	"+\370{\002[#@\340\377\236\300\366\227\376^YU\304\347\373\236"
+	.ascii	"\225\257\327\343=\221\2665-\213\\^\311.\317\373\235\033\227\032"
+	.ascii	"\236\225#\236\316j\367\034\242\356v\257\373]\226\325\356]\353"
+	.ascii	"\251\323\341\252r/$\227{\\U\256\305\341l7\347\355\366\266\233"
+	.ascii	"\215\r\313F{\326\264\234\324Z\355i\277\313z\326\264R\032-\201"
+	.ascii	"a\250qhd\215\214\210\210\224$)H\2061q\006\"CU\306\r\022@\222"
+	.ascii	"I\216\307*\312\\ 2c\033\373\377\0061\274<\304\277\276\302/\340"
+	.ascii	"+\235\275/\212~\247\365'\356\251H\343\004\177^\360ga\376\037"
+	.ascii	"\214"
+	.string	"\357\261\250\341\334\376f\037\325.!\341\230\002[tq\217\323\307'I\005\003\201\375\275G\312\263\230\334M\035\367\266fj\361Q+`\227\363m\rF Y\"\375q\013F1\220\342\023\017/\361Op\225\025l\353\003\352\335\340\264\"\327\311X\322\215\222\030]\224+\227\277(\252\321o\034\n?9\026\345o\226\217Sh\313\250\231(\003\016\031h|\320\305\215\306\026\232B\363\350\351\234\177z\261\tm\016\300dqS\265KA/0\002K\240\234\341\0254\230\006\310\367V\310\332c\357\027c\220\346Lz\304\347\246\241\330\202\275\274\f37\b\251?C+\371\203\363,\323m\030\243e\324\361\t\004\016\345\220\326\316\303\353g\374m\352w|\236\024\362\024\260\214<E\247y.&\372?\327\375+t\203\230\240\232`\367Xq\252M,q:\326~\"xUW\237\016\350\004\330\227\364O\266\254\313\bJ\274*`\233\272\b\365"
+	.string	"\371\036\307\236\256\2021Eg\264O\nQ8\377\314\263Kd\210j\25568\3054Q5 \210`\200\307a\261~)@\245\275\\\227\027\304\315\227{\326\025\200\333\3718>\224+\250\261 i\317\214\313("
+	.string	"\310\315\002\227\271\202x*\340\374\037\331\203\221\364c<h\006\353\007\364\375\265)b\306\264\356}\260"
+	.string	"5\005\330\233\204"
+	.ascii	"~\345\3657\026\032\206\212\353D\002p97bG\022}*\237&\030\266o"
+	.ascii	"\317+\247\353E\325\214\323\217Q\265\262\3505\363o\211Z^\357\213"
+	.ascii	"\365\211$\035\253\266\345\3703\244\336\026\333\3207\364\327+"
+	.ascii	"\273\354\272B\005V\302\254\341$;J\334\004\234I\323f\374\003"
+	.text
+	.section	.gnu.lto_arraySubInt32.33.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\032\002\315\021"
+	.string	"6bvF\340\360&\035Z\344,\354^\016 4W\326A\372\242\3430\300&\254\235>\242bi\"\310@-\233\207u\263Q\317\223k|\033\007\377\324z\020B\210\261(\255\240\363\332_\026:\203Q.\366\036\1771b\311\336R\246\024`"
+	.string	"`"
+	.string	"^"
+	.string	"\353\205\370@\367h\357\002\270\307\356\037\334\243cv\213{7{\037\244\227\035\031\273\253\322\0166}\337\367\035z7\314\330#\324\214\371\266\0330\032\242\325V\036\241\311%\346\003\252\346\002G\226\222\202~{\302\324d\tE\314\\\177;\202\242\217V\233y\232\034\354\256\223V\223\271\271\333\266`\033\202\235\021\002O\2332\315=\0353\r\237VM\247\246\037`\300\013\025\022b\354\306|3\366(\006\201x\317\355\243\360o=\026\352V2t6\037\027I\273\013\362\350\007\335\3437l\347\211\357\304\316c!\b`[8h"
+	.ascii	"\332\335\0207\350\036\013\300\177p:4\030xD\"O\373%\216\023{\216"
+	.ascii	"\312S\27358@\033J\234B\355T\221f!d\036j\322\3038\224F\205H\376"
+	.ascii	"\317\205\224\316\203\257\302\035\206\206%?\247v\250\352g$\340"
+	.ascii	"\235\202\273\246~6B\226\237Oz\375\355P\311\310\366R\203%?U\333"
+	.ascii	"\220KM\325\306\366Vr\344f)\311Zc\247\236\363{\\\347G\335\373"
+	.ascii	";\316\363s\274\347>e\272\013%\207\231Tp\261\342\002\005\030V"
+	.ascii	"\257\327\212\203\241\220L\200f\211\240P\200\255Z*\023W\253\345"
+	.ascii	"b\251LJV-\025\353\205\242\022!`\327\t\311K\005s\271^\252\ro\257"
+	.ascii	"5\276\355\335\020\214#\026\225E\265\361\211FS\252,\022\344'\205"
+	.ascii	"\341\320\223>\307\004QK.\035\356\356B'\370ISz\231\242o\266\241"
+	.ascii	"S\377\347$\005\265\"\177h\001* \260\202\031\313m\243\r\f\003"
+	.ascii	"{\336\240\255O\337ZPF\252(|\024\377*\216\354\310\334\374M\203"
+	.ascii	"\254\340\304\n\026\245X\202\3054W\331\312l\017\264\374v;\271"
+	.ascii	"\206%\214\306.n\330\212Z\347\323\271\215\2636\037\366\220\303"
+	.ascii	"!\231X\232\033@\224p/\226E^\030j\306\373\211t.\377\004"
+	.text
+	.section	.gnu.lto_qPercent.34.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"m\b"
+	.string	"F\020;8@\345&\035t\321\274\321L\227\267y\310\024n\244+\351u)\322\365b&\365\253\2725\004\235Q3#\b\3252\032\346(:\343\030XR7\330"
+	.string	"\353e?\242M\266\224)\005*"
+	.string	"+"
+	.string	")"
+	.string	"%\001v7\026\374"
+	.string	"\276\312\033\300W\252\361\355\271\371'\371Sa\2111\235B\317"
+	.string	"\207\335u\232N\026\267\336v\202\355\005\333+\001\250m\251P:lkv\306v\246}\221\217h\347@\036\330\275\3708\331\335\006+\b\274\322<\333>\310C4o\311mT@\016T)N\201\327\324\004@\352^\016\202\252\3274!y\2142es\241\324\f\373o\025\303\357\334\257\232NM\0372tw\201\331\245H\005\023\267\265\361@|8W\354`\327\205Y\261\023\301\271\242\225y\342\006\301\230\304C\026?\030\226\305\f\267\367S\215HGN}\372R'\312\224\t\036\013"
+	.ascii	"2\003\3020H\341H\232\315\2720\216\2145E5B\2011\002\2320RRL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_qMultiply.35.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"E\t"
+	.string	"fR@8@\305(\035\355\245\203`\364'\177/\260\031l\324\201\265Wf\242T\307.\370\230\250\355#\033\246\275\354\311v\251\332\253(:\252^\335]\026\345H\fI\313$\356M\244L)1"
+	.string	"0"
+	.string	"-"
+	.string	"\\v\033\024\220C\002\325\002\260\273\221\340\006\360/_"
+	.string	"\377T\343\334\223\363/r\254e\205$\245\"=\003\030v\327\231RU\334z\333\b\266\027\354_\002\023\257"
+	.string	"\233\362L:l\217\354\213m\315\2638\277]\213\021\205\354\317\231\366A\0362z\027a\201\335\213U\311\356f\234\220\375a0\333\376\352\037#\007\332:\271\236\376\344a\312\2271\275&\n\312U\312\227\335\221R3\354c\253\030\266\323\360\335\377\316\3721M\253\246S\323\3172\251\253\260\354\006\"\210\217\247\363\036n\216&\344 \332h\321\263i\332\306\211\236\316F\213\034P(j\016\274}\032@Q\264m\240x\351\366\206\212)\251\311\252P?p\237\300T\325\016"
+	.ascii	"2\003\302\260Z\270_S\363 X\230A\270&F\322b\177,H$d)\240\206\200"
+	.ascii	"\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_qConstruct.36.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\r\t"
+	.string	"\306Q>7@\305(\035u\321dH\347\022\357\236w\nKh\305\372\0133 \343\340\004\236\246\326\276\272m\332\322Av4\333\315Q\024\303\201\033{\2208\326vy\226\210\336{K\231R/"
+	.string	"/"
+	.string	")"
+	.string	"\031(\250\021aZ\001\330\335xy\001\374s'\200\177\212\361\3203\344\037\344N\005%\345\204\022=\003\024v\327yBQ\334z\333\007\266\023\354[\002'+\273\023-\326\232\274\221\r\333 \333b\253J0\327\2375\355{\374\003\364\r\302o\267\"%\262\273\030#\\\177\003i\333\357x\n\344\220\333\002&\201\327\324\227X\244l\331\3515CL\001F\331\2627Q\352\205}\267ja;\r\257\372\337\267\337iZ5\235\232\376\205\221x\031gA\261\207L\275\311x\030>\032,f\032\206i\233\2305h\260\270\351xb\306\300\232\003\247\023?\232\326\211\226mo\250\227\221\222\024\352K\034OUu%\360\017"
+	.ascii	"2\003\3020-n\213\301\n\260\345\237\303\271\206G\322\002~L(`\016"
+	.ascii	"\f&\240\206\200\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_sin_approx.part.0.38.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`F\004\345\030"
+	.string	"\366\352\226J\300\020)\035\214\337\356y\216]\227\375\236\241\251oS\373\2557ng\253f\232\200uC:\035\345L\364"
+	.string	"\377e\355\2776\215\377\302\320\004\n\004\211\240I\020$>\273\3655\025\2405M \0334\237\335\212\376'\215\020B\310\226R\246\204"
+	.string	"w"
+	.string	"\200"
+	.ascii	"E9\373a\231l\177\320\201\356\274\221A\363\304\243\326\032[\261"
+	.ascii	"d\003\214+\322\035\031W\354\241\367\307\266\255\353l\231%9\212"
+	.ascii	"\264\371e\373r\215\016\205u\2212\340R\246\0366\202v~\366<\320"
+	.ascii	"\362\311\300&)\013\332\361\331\222E\016\006ZRk]\244\234\036&"
+	.ascii	"it<\362\254X\362,\245\244\016\207\003L'GU\204WR\013\\\266\321"
+	.ascii	"\271q\267:XX\036\331\027)\253\265~o\032\366\260\375\377\342\177"
+	.ascii	"\312OM\002\314\017a>\b\363?\230\017c\376\213\371.\346\237\314"
+	.ascii	"o-\324\336,\311Q\244\315\353\333/\2005\360S+\316\020\253\002"
+	.ascii	"\211RF\033\265\013\265\374\357\277#j\337\250\005\376\374\325"
+	.ascii	"\240j/\311==H+p\217\222\204\nl\337\337O\021\023h\0052X\242qU"
+	.ascii	"k=Y\361'g^\337:\325\242\2343\257\323\2037kM\241t\242\326\232"
+	.ascii	"`\305#(W\374\267\251\366\007\251\217(f\267\207\251\035\022\216"
+	.ascii	"\207'\331c\026\254\206G\325\352\336\205f\300\370Q\345Xh^\354"
+	.ascii	"Q\200\211\002\027\232\224J:v\213\234\023{\177-\310\356\275\204"
+	.ascii	"H\373\224nw\333\234\n\315\374\250\306n\n5\334\361DJ_\"}.1\367"
+	.ascii	"\266\315\351\314OE\216\205\357\245\335\275\340\222\240\321aU"
+	.ascii	"\3771W\353\315d\233{\201{\222\264cw\204\343\341{;jJ\247\303\335"
+	.ascii	"{\277T\210\204Wo\241\177}\273\"\001)2\034\343\322\"Ce\366,(0"
+	.ascii	"\021bVf1\027\332lFc\211\271\264\254\314b,/01\024\222\323$@x\211"
+	.string	"\305\320h/\261s[\250A\020\304\t\322!\017\351\313n\215s=\250\301k\221}j\212MbtS\216]~t\331 \2759v<X\267\372\2439k\003\n\035\020\326\253a-V\355\216\\m\366\253\307\247\035R\205\236\236\025\216\334\331\256\036P\265\343\341x\030\342\206\013\337\202\3410\206\331g\023x2\273\354V\213C+\312.;a\250aL\345\0303BB\nR\220\024$\035\260\002\231\301\342\006\021\200\255\223JhAI\n\255\031\257\003\360\221\377\343\3051\224\3424\236{\301xJ\027\nb\357#&g\320\317\356\243r\227]d\335\310\316\251\013\224j?L@\342\344c\362\354u\277\221\03106D\023\002\035\370U\306\030\337\230\246\206\230m\254\242\244%*\334\315\300\033(\260P;\214d\022\221\310B\263\335i\373\366G\372M\240\372\t\236I\270N\247\354\372)\004R\261\\\223%,I\230\202\374a\377\256\031\271"
+	.ascii	"\257D\fKq\355\212E\030\236\237\031\312\003\204R\275h\030\002"
+	.ascii	"\021\227\230\344\2604\361\232\266\202V&Ku\230\327\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\266\002\035\n"
+	.string	"4\r\262\003"
+	.string	""
+	.string	""
+	.string	"\002&\177\034\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \005\177\035\253\325\252\325"
+	.string	"\272\200\202\002\006\177\036\200\200\200\200\004\007\177\037\b\177 \t\177!\n\177\"\013\177#\f\177$\377\377\377\377\003\r\177%\016\177&\017\177'\020\177(\021\177)\022\177*\023\177+\024\177,\025\177-\026\177.\027\177/\030\1770\031\1771\001\032\1772\370\354\254\033\1773\200\200\200\300"
+	.string	"\034\1774\350\314\2313\035\1775\036\1776\037\1777 \1778!\1779\"\177:#\177;$\177<\001%\177=\037"
+	.string	""
+	.string	"\200\200\200\003\001"
+	.string	"\302\001\003\002"
+	.string	"\241\341\365\321\002\004d\003\r\204\006\003\021\244\006\003\022\342\001\242\007\013\342\016\022\242\026\003\024\022\200\200\200\200\004\001\""
+	.string	"3 \360\002!\022Q\007\212\270Qa\337\315\2714\267\234\r\231\364y\232I^\337\020\037=\002fi\367\013\243\260@\004\004z\200o"
+	.ascii	"\362\033\020\320\003z\370F\277!\306o\310\2101\b\317\347\025\274"
+	.ascii	"\203\341\033|\3437~\3037\376\215\321o\370\306o\350\033\301\377"
+	.ascii	"\306\362\033\251G\270\222\216\256/\240\344\306o\360\r\337(\362"
+	.ascii	"\255@\232\304\347\300\217\001"
+	.text
+	.section	.gnu.lto_.refs.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8730f30e1588ce87,"e",@progbits
+	.string	"(\265/\375`\316\035E\200"
+	.ascii	"j\314p-Q0RBJ\007\212\213\323(\2474\313+\226y\216\333\313\343"
+	.ascii	"\201{\3609<\272\320\264|0\313\241\376\004\002\320*\255\253j\367"
+	.ascii	"}8\206H\367k\252L\335g'\336\335\231m\020YU\025"
+	.string	"\021\021Q\231\245\224\264.UE\024\221\231\321P\362\030\265\236\020)SK\002\300\002\352\002^R<\326\262\245\307y\314\205\251\214\307w<\330e\017\254e\317I\332\263U{\026\322\236\177\264\347g{\306\362jGG\364\025/T\201\315\362\225\237\263]\217\360\0315\275;+\033\234\222`\263\275\364\203\034[\327DnL\263\347\261\267 R8 R+L\307sLe9\256r\216\343\251\034\373\360\252N\223\347\356H\222\222\336{w\230C\264\260Z\026\207\231\355\371\266\307\241\375\r\355\317n?\1771\030SY\235K\321\213v\3574\304\320\256\316\r\260\331\266\001l\004\223\300(i\366\312\366*\314\244\330\306\240\b\240C\313\016\025?\207\251\375m%{\266\324!K~`e\257\352\324\334\033\367\305v\357]\343\036x\nW\231\215\251,\205\243\234\3218\355\354\364\336\346\275\367\347g1\036c)L\366\352J\366\274;r(Q"
+	.string	"\013\035\365+\360\336k\302\204\t\023\003\230\030Re\211c\303a?B\313Q\026!\f\200\203\366\377\331\017`^\n~@\373\021\355y\332\327\264\357\366v,B\210"
+	.string	"\213\020\262\334#\344\231\262\ba\313=\302\026\232 \271\212k\f\253\013\021V\037\364D9\340\020\031X\240\023\365s\003u\202\246\307\0030\374\334\302\177m\340\347\244\262\325"
+	.string	"\2722\317\371\327\236\377v\377\305\374\017\223\367\037O\357\177\337\377\275_\304\277\326\304\311\375\267\002\346.\206\267\004\316~\363w\230\fN\376\253\375\227\362\277\372\177\3556\177+\371?\205\331\277\215"
+	.string	"q\372\372\367\222\306\212\242\237\311N\363\267\361\375w\321\304\333\277c\370\371\001\236~\370\367\n?\217\375\334\344g\256\237\265~\306\372\331\352\347\350\317T?O\375\034\3653\324\317=~~\372\271\351\347\034?7\177\266\361s\362g\032~~\361\363\f?\313\360\263\013?\273\370\331\204\237C\370y\203\2371\370y\305\317\023\374\234\342\347\023?\233\370\031\202\377d\376\373\375\267\362\277\355\347\005~N\340\347\002~&\340\347\021\377U\370\177\302\317\002\374\034\300\317"
+	.ascii	"\374\314\363\363\316\3178?\013\177^\177\346\377\202\377\313\374"
+	.ascii	"\367\362\237\356\177\213\377T\376\273\370\257\301\377\271\377"
+	.ascii	"\n\f\016\016\016\3764\022\374\353\213_\200\b\002\357\254?\005"
+	.ascii	"\005\257\342\334\013v\357-\200\243p\301\342\326\354\001kx\311"
+	.ascii	"\232\023\265\264\366\335\204\205\227\371\274\367>\321L\3573\t"
+	.ascii	"G\3104\314%\376\034^Y\201\273:\020xo\021\257\277\226\207*S\352"
+	.ascii	"\b\334{\335\273\fq\247\367\3514\263Z:\317\262@CLo\325\210kvu"
+	.ascii	"\235S+(\033\275}\247\227o\323\n*\3039\215>\235\323\350\222\347"
+	.ascii	"6\243\313{\247P\036'\032s\311N3+\250\323,\n\rq\233wy\315\230"
+	.ascii	"Um3\nu\322E\241<N3&\324\331\264\202\206 \342\2055\246\003I\231"
+	.ascii	"\032W9\233\267\211i\212\371\344\261sN\2437\357^FS\272O\005\356"
+	.ascii	"\235\212>\363\230?\230-\311\256)I\n3\312S\246\244!\321\333\264"
+	.ascii	"svE\357\355J\212q\231&XN\355.\026\333-\257\246\356\222\322\275"
+	.ascii	"\004\334\351\275L\367.\371\332\335{\227\367\336\341sjzo\020\036"
+	.ascii	"\247\224\211\351\336\250\001\230\356\324\262M\351\336F\343\302"
+	.ascii	"\006u\232\r\211\376\264Q\315\244\027\307t\311\322\233g\365l\315"
+	.ascii	"\226dw\tL+\205\362\3702d\275\363\321\203\207f\337:\332\246j\035"
+	.ascii	"\230J\242\243\347+]u\032\346\364N\277\034I\2026\313\303\"\204"
+	.ascii	"of\213\303\275LB\310\203\203L\202\372jO\261eQ2\036\034.\177S"
+	.ascii	"\320\004\333\251\031\016\027\265+\200\315v\324\232\203\340\275"
+	.ascii	"\314\216\352\016\322@\336Q\2372'\300\234\300\3160\317\313\311"
+	.ascii	"\024\376\200\022\212\3355\035PB\2623\347\017>z\364\217%\035="
+	.ascii	"\252\\L\006y<\325Pqj\322\344\351\325\234\270\"^_P,bL@\234O'\233"
+	.ascii	"\250\251*(M^\266\334\2664\313_?\357\246\035-"
+	.string	"U\300\035\230\226p\346\226@{\351o\035\275cg\252\372\027\325,\027\300=\302v\376\274stX\021gV\263\302\306\241\224\2236\307\244J\263o\245\367\262]:\343\224\232e\261\237\367\r\366*\214\023W3\351L\007\363G\263\235\324K\0346A%\250f\366r\253i\013\260Y>\303\203L\375[\337\3274\247\327\214\261\252,\261\376\332\032\303\301\301\301A\376\233\2311Q\252\316f\177\026,\323bO\300\246\315\222\031\200\273n\214u\331\265\201L\3451\f\3703\206\303\260\230\225\354\t\202\2264?\023,5\227t\205e\305\374\f\206\377\030KGG\324\260\351=-\251k\317jm3\300=_\274\334\334\361E95\313~$r\232xNdbm\026\016b%{\222\240%\314\217\371\270\216\261\334!`]\270\217\251\314w\022\355\030\030hT\310\356\r\335\304\360\260\224\266W\261e\0070 \0024;\240\240\254\264Te\360"
+	.string	"\003\327\036k\217\365IOLZ\003X\025E\352\356\371\\\237D\270\367.\247\327I\210\245\005\025\027\030C\2270\254\025\372\365\251\004\252\326\262\2319bR<8*\353\216u\307\332D\"-\207\237\216\223\260@3\246\257M\353\031\0365\251\331u\251\3034\313\372\222\274\260\254\250j\253\322\252\264\346\300\353\243\026i\243\256\316\2579n\226\200i\2336\273\342\370\032\316\017pg\250\300\312\224Y\233-\336\0233uobk\322\327f\037\364L\031\245f{pe\262KeB\250\254\314u\331\023\310\264\306~$t\244\210\020\321\261\336\003\341\345\354\3140pN\212\311\0313-\237\235\327\02225pU@=A\006d\315\236\250\341\035\371\373\3531Q\250\320\332\246>\002\337c\372rn|\271\021\326l\213\35105lY\224\366\302\254~J<\232a"
+	.ascii	"\327+;\200\270\001r\025)\203w~B\202\b\242\277\34095\220\252\277"
+	.ascii	"3^\336_\2526T\270)c\232m?<\264 g\232\355.\257\266^zVf\232\355"
+	.ascii	"\276Wi\310\210\264ei\266\371X\350\226-\315\305H\016?\232.3j}"
+	.ascii	"zo.oC.\275\245V\263\235\267F\251U \3156\336M\020#<zh\266\201"
+	.ascii	"\370[[&mlK\263}\307*\331\331u\026A\251\016\017d\222$\301\362"
+	.ascii	"\316\302>\370\204(Y\351H\377\222,\001\353\352\232N\204.=\005"
+	.ascii	"\212\357\312NN\256\351j\356\363\216\313\r\236\221'\256\2717]"
+	.ascii	"\265\246\313\022\351\016>\274\275u\334\235\024)\315t\007\230"
+	.ascii	"\250*\357\270\276\235\353w\027\330l\303u[\177y\305\371\220\262"
+	.ascii	"\266\326ngc~7*\252\004\377 \343\343\211\312\333\255\317\314\207"
+	.ascii	"5(m=\346L\020\252\215\255\314\312G[\033\216\235\324\213\254\331"
+	.ascii	"*G\261\001\354\222\373\203\222\226\326Rv\360k\367\234\\M=\274"
+	.ascii	"\245\250u\225\225u\224\226\016\251D\204\340\004\236Y\241\276"
+	.ascii	"\243\364\262\233K\240|\315\266Y\2379M\277\370\0016\024\241^W"
+	.ascii	"\025\216\"aa=\275kZ\225\310\360\r\216\275\247U\035\264\"d\332"
+	.ascii	"\232m\261W\327\264;\252)\035\274\274\372+\203!f\374\032\no\312"
+	.ascii	"\354\311\373\353m\007L\232v\327l;\031\316"
+	.ascii	"\325\r\321\341\215\365\321\366\365\203\024"
+	.string	"\023&\235U']\351\244\254\272x\264]]\235\305\367jQ\203\212\363b\035\002\2254i\366+\216\255\255\346jyn\222\026'\241\230\252\267'\3156\027[\225\007\304H\263-\335Y#\313CBF\353Z\235\305\316\345\275\353\275Tg\244:B\240t%ui\2154\022#\235\005\302\275<\215:=oT\217\022o\"]\344}\344\357#\235\025\342>\357\215\272k\037\027\250\270\300\0335U\002\307\251K\226\023\254\217\201\342\210\210\210\030t\2444\276\360A:\3028Q\003\351h$:1\301\n\240\025,j\370\024\205\220\210\202\216F\237\344\021\222\217\017\rd2\206\022y\034\016\021\213Dl\020\315\2202)\343\210F\031\204\224T\036\035\221\035\310\260\261AddT\022!\265\220Q\243<\026\203\222E\024d\264#\274@ra\203\230L\022s\206,\250\200\202!\025=\026T@\201\212dQId\004\241\330\242\206 #\222\f"
+	.ascii	"X(\016S\020\"2\"\275\350a\241h\203\221\210X\224D\036m\206n\212"
+	.ascii	"0\216\304\024\212D\304\240#\233\243#\321(DL\001\251\302Q\261"
+	.ascii	"\230\204Q\024\3421\316(z \224$\n\035\211J\0273\212B\001\024\203"
+	.ascii	"\216Dc\222\310\302\214\242\320M\214#$\024f\024\205\206Ib\221"
+	.ascii	"\250\203\031E\241vHG\350H|!D,z`\203\310\310\210\2303\224,\322"
+	.ascii	"@\032\t\205\202`\254\312\244\f\0273\216\306!\361&\305\221\250"
+	.ascii	"$\342\034!\203l\036d#\001\ne\222h\204\242\0062idD\004:\032\217"
+	.ascii	"B<\310\230,\036\2130\332O\260\342\304\n\0265\206gq\201\004\027"
+	.ascii	"H <\213\013~~.X\361\323~\305\317\252\004J\361S\30384T\002\255"
+	.ascii	"\370!\"\211\206h\224@"
+	.string	")T(\217\306\241\262\210\217\200j\030\223Jb\213#\322\250$*\221I \243\241\036\345\315PQ\b(\207\006\321\306JD\204L\2621\202\224F#\232\243\"\021\214#QH\203\230\\\223HePq\006\220\321P\215\013\374\002\303\300\312\030\004\034iTL\372(\221\310\244\317\315\021\250h=\002\232Q\024R\036\r\377\363\323\001\002+\234\020B\033\204\342(\206\222X\344sD\026\025!\203|\216Fb\221OP\362\310\007\005\211\026-h\024\217BDH\240\"\241\013\032\305#P\221\020\312\332\224\202\252\2032\375\323\333\302Z\311\262\322\006\275\004\321\354\352\344\353\230\223\316j?\236\336\250\350\322\013\013\267@0p\201\3279U\202\006\211\234\230\217f\327\260\257bxwseH\332\365\353+\230\024\217\275\256\"O\216\320\325}\211\266\027\006\351\352Z\233,\341(\215\301\312c\362\265\311\325p\013p\232\327\354\272\244\255j\310\256"
+	.ascii	"\371rZ\267\326\255\225\213\317)\315\301\233\342\355)\371\312"
+	.ascii	"u\263\347\345KK\263\253\264\257\256T\315%\021\336X\221\254HV"
+	.ascii	"-$\202\200Ne\325$_\265\332\n\347*\310\026\334\225M\034\037\023"
+	.ascii	"8\301\365j\275Z\261z\340\313ib9\243\254G\276b\321@\345\260\262"
+	.ascii	"jv5\322\314\035 \362\226(iv-\322\314#YSL\232]\2114\263&\f\327"
+	.ascii	"\337\231>+\2535\351R\313I\237\\4\272N\3559\031f\t\023D\031\225"
+	.ascii	"\212j\235\332\243\242\201rS:\302\025$\310:U\263\307\304e\016"
+	.ascii	"\213\222U\352\353T\213\003M\255\307\232\022\270\034L\250\242"
+	.ascii	"\242\372\310\274|0\323\354\003\202\217\250r\0211\007\003\313"
+	.ascii	"\314\f\211\210H\222$\351B\013\020\204cQ\234V\315\003\022\240"
+	.ascii	"$5\223#\305\214\314\210\314\024\024$;k\220\222\036<7\\\200\265"
+	.ascii	"\350\204\362|\027.\302\354\245LK\334\r@\230W\352\fP\203c?%\314"
+	.ascii	"\034GE\344B\2338\025,A\360\374M\377\375N\007D\325hC\256\344\\"
+	.ascii	"\321\245\206X\370|\037\274\254!\270\3553\036\373\224\342n\245"
+	.ascii	"\017\020\264\241-S\222\236^\312_\310\\@\257\301Oy\016\251\246"
+	.ascii	"\242\333h\250\254\346\264\334G\t\022\345Z\350\201i\353~7\303"
+	.ascii	"[f!\f\3207U\276\201_"
+	.string	"L\201\374v\322\204\355!\356J\230(\"\203\336\035\004E\243\004F\036\003\314\205\307\331\275b\205\223\2148\303h$B\005\365\030\364\375\023-,\265?\303\233\226v\200:g\344[,\320\217Z\216%\2052\263\343\221\232;L\260%\203\025\373\201L\260\247\030\211dId\020\213\370\211\243\202\261\005\266\017w\351\3757\356m?O\373l\222{`S\227\177\317\0164\304\350\007.r\276\342\304<R\337\217$\\y\032mN\024\222^\301\372@\025\222\305\236\253^\002\276q\370\274xe\202\320\236\222\0074\264>\321\225\203\201\333\020\265:\336vo\177\231\305. \027\352E6\032\274r-x\005E\227Y\025\355\002Jz\216\007\253\275r\256\177\" \325U\326&t\331\255\fz\202\253\251\206\001\261\250\036\250\375\321\276\211/h\221\337n\204\272\365@\236\\\325\2267\304{\301WZZ\"\343\002\310\327\232\030\340yf\036\341\252"
+	.ascii	"\201\226m#{\376-\265~^\317\005\377uZQ\307\017\020\211\277V\234"
+	.ascii	"\202#34>b\337=.\"eA\252u\275c\314fT\020\025\211\024\304\177\221"
+	.ascii	"\004\361\203c#\001\323a{\310\032\016\3170]\263\346\017\363'\210"
+	.ascii	"\262w\333\360\005\217')z\r\263\300\2700ml\300\025U8\310-\364"
+	.ascii	"]\373\306I\271\001\363\324\2653m\221\235\235\321vu\006E\354\340"
+	.ascii	"\271q\362\233\213\270:_\243U:5\310\333R\374\"\253\020*\210\315"
+	.ascii	"\032O\376\375\007\006B-P\337\375\024\002\370-\250\235E\344\335"
+	.ascii	"\022\261w\034\311\207'\235H\260\007\205\033\037\rp$\023X/\361"
+	.ascii	"&7$6\033"
+	.string	"\327,}\233\022\355\254\343\320 \373\227\304LbP<\201\201\nM\200\323\222\"U4]jEpLw5E\2672\212~\213m\212\233\243xt\363\244\376\205\351\202\271\374\"\325\233\024\n\343~\251>s\3340\314\242\252%u\250>\314\321M\n\213\034A\240\317\371C\247\216\220\214\2230Nv/\025\257l@\321\242\023\r,\224\026\202\374\340\335\356\2573\203\202o\213U)(1\270\031Y\210\317\222\226\210\210P\034\356\027\013\321U$\007c%\216*\310\352\301OU\3744o\242\300\263\365F4pL5f\341\r\210\344\343k:\"\212J\0179\2362Wv#R\310\3122\215C\361\024\033\227\266V\332\205\245\321!\211\243\2449\342\273\325\370!fP\275\224]2\212*\323\020eQHY\225\035\034\324\274\036\2430k\246\242\257\256%E2\252\200\261\321\n\355M8\313x\001\304n}\313\252\321#\023\250\026\322\245 "
+	.string	"\t\201\223MJu3\307(\007\336\220\260\311{7:,\0139=\372\035\356\237;tD\021;\306C)\333\351\375\3108\235\334\020\341\005\322\313\367L\330\026L\377\2608"
+	.string	"\300zH\240\354\225w\216\311a?\036\0200.:\t\034\022\337\177x\037;\257\374\007\305 0k\275\374k\321\017\356{\b\326\177/\251\367\316\376\001\032?\200\375\361\236S\270jO\017\034\330\205\007\374\034\242{\205\007\362/\354\201\361\250\335\357\237!\277\222G:\205\030\367\n\343\177\033\004\017&\372\274>\217"
+	.ascii	"+\324<\244s\021+\263\0176,\273\375LW\177\240Q\317\217\301\245"
+	.ascii	"\177\205I\255\226\3218a`\207\237U\214\001\313\203\247\217\270"
+	.ascii	"\237\233\357\016\266\357\325\376\346\341\251w-? /\371\003\375"
+	.ascii	"\001v"
+	.ascii	"\037\020_\242\034\203wV\213\230\311\262\3751\022\206\205\020"
+	.ascii	"\270\350?\"\365\253\300\017\3634|\343\033\261\013\316vE\375\350"
+	.ascii	"\267a\331\327\357/\203\305\231\3548\351\013\233\370v\2508\301"
+	.ascii	"\334\363\013a\006\273R\326\244\177\303\320\211>\334/\364\301"
+	.ascii	"\340\241\314\313'\311\313\334G\327'\243\335o\336\034\323\324"
+	.ascii	"ZY\316j\275Jw\232\304~\336Q\227\207=\240\226I\033@m"
+	.text
+	.section	.gnu.lto_.symtab.8730f30e1588ce87,"e",@progbits
+	.string	"sin_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"invSqrt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"devVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"normalizeV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"applyRotation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"rotateV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"quickMedianFilter7"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"quickMedianFilter9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"quickMedianFilter3f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"quickMedianFilter5f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"quickMedianFilter7f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"quickMedianFilter9f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"qPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8730f30e1588ce87,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
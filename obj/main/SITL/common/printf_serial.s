@@ -0,0 +1,404 @@
+	.file	"printf_serial.c"
+	.section	.gnu.lto_.profile.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"D\003;"
+	.string	"\005"
+	.string	"\254\277\363\246\017\002\002"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\226\266\306,\003\376\220\273\353\017\b\002\001\002\001\002"
+	.string	"\002"
+	.string	"\002\003\002\003\006\361\201\277\304\t"
+	.string	""
+	.string	"\003"
+	.ascii	"\270Hg\336\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375 /=\001"
+	.string	"\350#"
+	.string	"\003"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\002\001\001\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"D\005o\ti\003X"
+	.text
+	.section	.gnu.lto_.inline.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375 \347\375\003"
+	.string	"2\306\024\037\220)\351\017\211\020\227\210BC\375WP\201\342\355\254\2554\035\273\273\213\232\374]7E\266\224)\237h\253x\376\232j\354\374\203eo\224\366;\024\204\341\250\004\020|L\026\021BaL\2359J\243$(Nfy\003\333\226\374\017\267\275\246(m\001\177\226\004\020"
+	.ascii	"Q3`\n\327\211i\340# \307s:!\240x\016~\231+\270\321\312\342S\305"
+	.ascii	"\370\271\007\250\305T-2\213p\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375 \364\275\003"
+	.string	"\002F\022\034\260%\351\f\3400\005/\017\303J\205\212\034{I\222\005\226\024\027\254m\273I\"\223\f\253\013}9\004H\266\002\t\263\033m\017fO<\342*\2406\364\206\370\f<8\237\020\213<\367\342b\317\356ykY\006'x\256S\004\021"
+	.string	"\020\023\204\314bj\022\224\223\0308d\004f"
+	.ascii	"`0S\020\206\215\bs@\347\376\230\026L\005\360g\t\230i!\312\216"
+	.ascii	"\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\230\004\003\270\004\006\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375 g%\002"
+	.string	"\244\002U"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\004"
+	.string	"\002\002\001\002\006\001"
+	.string	"\003\003\002\013"
+	.string	"\001\002\013\001"
+	.string	"\002\005"
+	.string	"\001\002\005\001"
+	.string	"\202\f\006\005.cO "
+	.string	"\n"
+	.ascii	"8\001\340\216W\331\322\f\356\346E\315\273\027c;s,6\017\240\b"
+	.text
+	.section	.gnu.lto_.lto.850a3296e3fe9c3a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.23.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\265\007"
+	.string	"B\21766Pm\323\001$\203\310\312\352V\251\226#\242\201T\3218\250\204\2011J\227Bk\332<\277v\347o\013\347k\006U]\263\221b\257\257E\303\223:\031\265\337\233\354\235R[\245\f\001\276\254\007\fV3\233\006\207M\303\252fj4\313\35055\f\223\315\253n\246e`\252\311\324\271QZg\365\355\247\215\236%\007\351\023#\f\243\037r\221\216\237a\b\016|w\351s\250KK\243\303\342\003K\366\347\201\361\302\376\264\273\353\350\331\027\375p\252B\027\222]\212R\312\222\244\311Fe\373\320\276\307?\270\213:\037\330\365F%\273\037\202\023,\227\376~\241.-'\240.\315\331'\005\022\002\243\211\021\224\335\235\021\343\334!\347\037\344"
+	.string	"\035\310sXY\330]\303\016Tq\307\333>\260\255`;\024\t"
+	.ascii	"\3202P&\264\356\005&.\024\202!\227`\233\325\224p\207\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_tfp_printf.24.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375`\337\001e\021"
+	.string	"\326 tG\360\262&\035P\341'T\025\355\367\261\273A_\315\272\205m\222V-\353\3403\247\236\324\252\320\264\201Fk#\332j\261\254\006\017R\315`\356\275\312t\272\304\233\235\315{\177\342\\)\375\3317\255\253\352\264\023D\366\2262\245a"
+	.string	"]"
+	.string	"`"
+	.ascii	"\0270\347\213\007\307\2340\005^\300]\032\306\375\305yT6\020\204"
+	.ascii	"VL\321\303\306\207\310\234\263;\271\311v\031O`\273\\\024^U=\312"
+	.ascii	"U\225/\033\022\272V\217\001X\340\\\306\221\326\215\n\022\027"
+	.ascii	"+\256\020\325~J\\-\335\317\216\342BH\350\302\271\216\264\314"
+	.ascii	"9\255\241K\304\275\3356\3116\213\255\f\002\255]\331\260\225n"
+	.ascii	"\216\375\025\035\242\232\367e?v\217\016\373\271M\035\245z\243"
+	.ascii	"ZW\375\222\317fV`6\347MQ\021\032!\371\263\342\261_\246\362{>"
+	.ascii	"3\211=\343>\252\313fZj<L\224 Z\b\007\334\345\r<f\2408i3\236\030"
+	.ascii	"\241\203'\345\322\r\270K\265\037\3432T\207u\b',\240\007i\230"
+	.ascii	"\340\342\262]\356\036H\213\3079\347\\\233(\205\n\264\241\032"
+	.ascii	"kW\036\240\017|p\373\325\265-\274\350\303\321\236\330\334\306"
+	.ascii	"o8\b\251T\332.u\001\3704^\303\344\357\370\202\247\017/}o\273"
+	.ascii	"\374\352\216\235\0220H\320h\221G\232\362\323>;!\370\020\332_"
+	.ascii	"\006}\350\203\320\031\252\005\244\r\2122\245R\036\310a$u\202"
+	.ascii	"Y\227T0\220<\320$\363\002\223By`L\207\372N\247\257\324\241<\322"
+	.ascii	"\251+\2012\235J\002\1771&\260K}\037\330\221\300\346\3675\332"
+	.ascii	"\363\020\242\331\032\317\3049M\260\\\366\327bZ\0247\307\377\316"
+	.ascii	"r\264\\r_\226\331\342\202=?XJ\344\003\272kG\220\240\017\343\006"
+	.ascii	"& \240\002\021\301\344\001\321\300\312\033\355mC!\245:\325`\273"
+	.ascii	"\313Z\234|\226\316\275Y\024\033\301\200\304\211\360\324p\025"
+	.ascii	"YgQ\fX\220\306\306\273\274J\353z\225=\031Kb\321IC\031w\n\312"
+	.ascii	"\301\322\303\212\250\357\024<X\370w'\035\324\304z\fS\332\204"
+	.ascii	"kZ\347\352O"
+	.text
+	.section	.gnu.lto__putc.25.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"m\t"
+	.string	"v\023C70\221\322\001\003\023\222\237\252\026\304Z\206:\306\371\"\204mS\301\232\256\313\260fI\b\243Af$\301\367\321\364`D0\260)\376\230\213\245\207\310\t\266\332o\233H\231R1"
+	.string	"4"
+	.string	"0"
+	.string	"\235G\207'\330<v>\260y\364g\303<\374X\007\031UJ\314\356f\352\361\357\371\3717\271\007\\\241\236\234\207\335u\202+\215[o\033\3016\203\375NN,}N"
+	.string	"KA\313n\306\213f]q%\304\366?\2665m\205\206\357\241\205u\227C\245\265\273 /<\355\217\234\344{\211_.\260\313\022i\355\206 '\004\007m\200\241(\373'G\251\360AL\341\345Ao\363\250\352\331\270\246\036\323+\204\213\252&\225/;D\245v\330\307vw\255,\373\341\217\305\264j\006\332M\267\026\232\020\221\272\221\027!q*\221:SV\342\266\215\323\262\022I\264eZ\347e\241\003s\246Q\227\2358\256\313>\341\036[e9\316\270Rza\200LU\2657.\003\013"
+	.ascii	"2\241\031h`\341Q\022&\242Kx_F%\327\330Wa\260\202\n=\356\360\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_printfSerialInit.26.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375 \353}\006"
+	.string	"R\f.3`m\322\001"
+	.string	"VX\013(`V\310\345\033~\275\234?\310\221\377\233\025D\226\340\003W\315*\273y{,\352\203 \020\330\177\366lYM\351\327g\211\334)\005\235,\f\027\nb4\n\013\033\213\202\031g\275\252z\223\263\250K\345&\250q\226\202\276\f\006\272\315{\320U\262;=\225@\237Q\210\223\021\2454{48\004\374\034G\347\366\001\2429v"
+	.string	"\2041\nI$\326fX\313\214\326\322\3777=m\"|D%\004!\277\305\211\311G(\"\034m]\351\325\2228\333\270?(&@D\377]j\370r\273jwX v07\200\204\377m\261s\341\246\333\032\264=h[\021\007"
+	.ascii	"2\003\346j\006q\241\324e\220\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"e\005"
+	.string	"\302\207\035'\200k:\034\216*\003\320v"
+	.string	"\001#\321t\210\300\207\031@\2140\346\266\201e\340\330\254Ml\333\346Zj\321\215\310-S\335P\372\177\213J\004\0052QS\t2\267A&v\200&f\312e\b\303\223\2053\2055\374\337f\243\204+\210\360\343\035$\232!2e,\033Q\250\340\306\343\336!\030{\331bw\353\232\332R\3478\017\247u\373\301\240\364\377\225\035\257-^\002\025"
+	.string	"K\215\202c\233fY\215\260Mh\236\031\006\250\007"
+	.string	"\007"
+	.string	"\007"
+	.ascii	"\207\017\020\002\227\026X0<{@\240\254b,\204E:\361\355\212\214"
+	.ascii	"W\001\2419T\031"
+	.text
+	.section	.gnu.lto_.refs.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\001\002\001\001\001"
+	.string	"\003\003"
+	.string	"\004\002"
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\006\002"
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.850a3296e3fe9c3a,"e",@progbits
+	.string	"(\265/\375`\232\022\025["
+	.ascii	"Z\230\374!R@PJ\032\016\232\212\211\251\312\246\"\353.\253\267"
+	.ascii	"\371=\325\235\035_\337\332\374\026\234\327U\200\213\355\276\324"
+	.ascii	"\221\211Y!\327\222\001\364\001\346\202\020\025jd\264A\372?\251"
+	.ascii	"M\017\352Xn\304\205:1u\033\303\256\304v^.yP7\304~\253\204\273"
+	.ascii	"I\231\002\320\001\t\002\021\002bZMk\211\23679\274i\203\226\372"
+	.ascii	"zC\370\336\306N\2735earp+z\344\215\312V\335\252Y;\310\007\346"
+	.ascii	"&D\013\222\364\254uf\351~\3264\245\021su\246j\313\360p\351p2"
+	.ascii	"\222c\237G\305\230=\274\343\023\027"
+	.string	"*\214\236\231\322\257\233\364;\227~\335R -\351\277b\302\364\232[bOF\367\313\272\355Z\300\202\341\031\305\332~x\3360q\273\252\222~\013\360\355\335\026\340\373BIG\254W\372\335J\277X\351fY-\273\n\355\332w\207U{\016rmg\216\0304=\312\030\375J\245_!\337\317\n\371\2768\322\021\033\302\207.\b_\212\266\r\201\266U\316\320\032V\254\ba\364E\264\237\371\276|5\031\243\377R\371\236\375\0241\363\342\203\321-[\263;\263-i\214.\224\215\262\253\211\225\362\235\262:\274w\\{\355^\177\230\210\033(c\214\002m\b\037\257\220~M\370xwwk\302w5\177\376\317\331Q\033\222\305\306\350\177\351]\244_\027\204o\307R\250\037\307'\243o\221~\327\025\373\227\311zm\030/\211\203\331e\335\353\007\0357F\330\354\030\r\373\033x\340ex\272\275\272\233\200\236/:\3104\243\337&\037"
+	.ascii	"\253\037\370OzN\177\266n\b_\272 |\377\266\360\302}?\307\360o"
+	.ascii	"\0054N\300\377\027\337\3719\204\177;p\241\204\031\377\032\311"
+	.ascii	"P\377="
+	.string	"*\376\273\301\001\027\361s\013G\177\026\376K\374\027\351_\025\3765\341_\017\376\265\340\337\t\376\215\340\337\026\377\262\370W\305\277\f\374\273\300\277\002\374\233\300\277\b\374[\342_\240\377G\377\206\370w\304\277\"\376\035\340\337\017\377\203\376\257\375\357\335\335\335\335\375\313\301\317\313\371\177\036\b\355<^\245H\3462\271\205\271\004J:\217\313$\022k\371!\211V\221-7\216|\211\3333Id\347h\252:*\201\332\222+\263\307to\031S+KtW1\225c\216P{\266\324\226ci\312\221\271\0024-e1\033\331\226\344bvs-\305\350&\025\306\265\255m\3306\243\217\252\306\301\324=@S\267q\273\255\273\215\335\215\243\254Z\273\247\200\222\315\246\246\356\250\240\246\2562\2421us\031\334\3312\351\314b\016\241\2219\233-\303j\334f\217\301R\246NcX\343\350\356E\2236\227;\350\200\374\330\261\323\341\255\331G"
+	.ascii	";R5hyBea\3750\341\001Dk\365\312Ak\203\003\rWL5vu_=ve\346\317"
+	.ascii	"V\\\303\331x\230\001\350\230\355x\"\302\350\006-\b\337\320\320"
+	.ascii	"\271\007\b\2372j\355\237m\322&L\255\352O6\206)\311B\305SM\203"
+	.ascii	"\026\252\225\247\244\320\2453\356,\352,u'V\306\f\243\f\365\247"
+	.ascii	"N\334\220)&\214^\r?q\231-;d1\312<\230\206\363\023\357h~R\301"
+	.ascii	"\354>\362\323O\017\335\307\237]\022\273$\320%Y[Q|\350y:\322\237"
+	.ascii	"u,}\312\210\305\031yyV*\031\022D\215Qv\n\352u5\235<1z^\215\324"
+	.ascii	"\311\223\265\34246dN\215\315\252\231\306\245\206&\026!oTs_`\353"
+	.ascii	"\314\341Vd\257\374Crk&\212[\323\\\234\323\334P\232\265\333\261"
+	.ascii	"d\303\t\331\237LnD\310\354\026\037$P#\263\246\232\016\374\233"
+	.ascii	"\326\245G\333\335zY1,\230\22497\334\252\366k\357\266\207u\303"
+	.ascii	"[\2338O\262\266V\355\3371p\273\205\027\246L\237\214I\315u\257"
+	.ascii	"\377\331\3103p\r\316\3017\030\0077\361\022\037\331\006#\271Y"
+	.ascii	"\006N\356\033f\332u\357\226\315\227\207m\363\240\265\033\331"
+	.ascii	"\335_\257\177h\357vn\321\360\302\224\215\374a4\240\206\334\023"
+	.ascii	"\033\273\356U\201 \005|\002<\245c\205\315\206\027F\231-EZ\211"
+	.ascii	"\001\263\222\236\235\257\234\361Z\357\253{)\305\2724\246\223"
+	.ascii	"QB8ui\202\204\321r^\333I&!S\222\245\347\004m\255.\013\026\036"
+	.ascii	"/5\336\344`\024\013\247\261\332\316\234\323\335r\2073\037sH\304"
+	.ascii	"\322\367\270R\256r\266R\305\352\007\226\026\332\237\203\023E"
+	.ascii	"\fU\223\321\367\202\244\357=\221\221\261\331\212\265\323\376"
+	.ascii	"\250\202j\332\355\2141s\"\004\312\331\214\247\234=\r1c\224\247"
+	.ascii	"0Ka\035\316S8\n\017r\345)h\367q\227\204\317.\211^Z\221\343\230"
+	.ascii	"\017}O\231^\r\227\361\254\306.S\366$\207N.\016\351\263D\325\f"
+	.ascii	"\222&}\330\303\330\031\304\344\205\271\001\325\354\352\216\022"
+	.ascii	"B\327x\271a\354\354L\303\330\3650\003\243,\306G\230\310\025("
+	.ascii	"$\353\246\227U'Ge\f\030\0307\331\261\244\025\227\035\177%1\342"
+	.ascii	"t5\347&ez_\270\214DQ\363\362\3723\bhE\216ui\356(\261q\006D\312"
+	.ascii	"\222%\254\305K2\217W,\230\264\271\201\331ucY`\221"
+	.string	"gN\302\262\222$\341\256\264W\270.=\3153YPJ\316]i>\2475\270\257\254\036\257\2557\266\250\255-\346\002\352%9,s\035\025%\264C\3066\205\013\311\231K\007\b\225\321\353HN[]]\331\221\337\300\303\222c\215\b;\365\224\224+Y\270\271lx\254~L\2751z\024Y\344\273r\021^\006\255\255\343\0043\345\272\300yhR&\"U\267\203\n\356\231\236\203\260\220\263\r\377m`\251tm\247\026l\254\270\354:J)t\2363=\377\276>*\273[Gom\345\022\317\267\267+\364\367,oK4\017\002\271n%ZiR$T\216T#\372]\335\306\017\275\2662\351\3042&\235|Y~X\373*\200v\372\350\344\212\265D\231\315\275\3666\022k\331Bre*\223+\323\b\324H\246\261{]\002%\313\216\306M:\261\226I's\371\241\221m\fFj\222\220\250\364S\205I\302\035\225\bT\213"
+	.string	"\024\213A\"\"\240\017\205!\023\034H\241\247\002\221\210C\243\021B\030\300\337\214\342\013E \025\200\352\357\327\343\302\220\030C\035&\341\030\001\203GhQR\360\007\234\361K\022\252GB\0310~?\240\243\341\220\202_\357\005U\t\351\002U\210TL\002\022_\024\205\"\202\252\220H\302\216*L\322@\3511N\2100Re\f\213\324\342\316O\311H\325q\241\006\213 B"
+	.ascii	"2\352\275\004\221*C\351\327;\221\220\030L\n\252\220^\305\n\006"
+	.ascii	"V\260\240\201s\026-R\264H\341;\213\026CC-V\f\245_1\304S\213\302"
+	.ascii	"\243\037p\006\016\021\030\203\bU\037\343\004\212\"18CH,\"\340"
+	.ascii	"C\245 \021\205:\034\022Q\354\020\203B#\241\232\024,\022\352\024"
+	.ascii	"\177<#\250\304\241\013\240\340\021\f\340\213\031\276\340/X4\354"
+	.ascii	"@'X4DB\203\277\017T\342P\251\247\2304\024\252JC\234\240\n\004"
+	.ascii	"\241H\006\020F\032\204A\030B\252\376X\340\250)\221\247\b\030"
+	.ascii	"\314@\3755\340\300\221\020\370\202\03042\222A\001\r\225g\206"
+	.ascii	"0H\024\004!H\375\255\030R\223\2042R\035\240\n\264\200\006\321"
+	.ascii	"\207\250\272\320 \304\207\206*\030!\202\007\030\244D'\216\200"
+	.ascii	"Bb\260\3703R\223\204D%\024IC$\244!\021\212$!\020\t\005\021\261"
+	.ascii	"\210\342\004\t\026\210\2000\216\216\200"
+	.ascii	"\025\004\217\212\204<<\320\3618W#O\3308}\324X)\001bg\226\262"
+	.ascii	"I\343\301f\315Z\352f\205\004L\335\033T\032\"nj\264\350\322~\350"
+	.ascii	"H\303\317\253\035m\2400j\3467\303tAi\177\215\221\231\013\323"
+	.ascii	"M\222g\316t=lA\303(\317\375\251\323E\265DNe\301\302c\311\033"
+	.ascii	"2\34782\374\354\201\361\236\310\330\264\260\334\371\351\003G"
+	.ascii	"g\\bt\013\314G\027F\031.\216\013\027~\223`u\003\353\362\311-"
+	.ascii	"\315\320\364r~;\213y\242\364\022\005\206\303\3749\313t\003\223"
+	.ascii	"+0)\177a7&2[]=6\0239V\244\236w:\3156ZF\030\345\266?y\220`Mz0"
+	.ascii	"\312]\002\201|\250\2010\246\230D\"2\"\"\"I\222\244\003a\005\204"
+	.ascii	" g\2413\017\022@u5\315A\350df\222\0242\354"
+	.string	"w\260\245}8p\263FDZ\313IjU#\0014\3023\345\224D+\001TF!ai\376*\2769X}{e\020\276?@\313bO`\363\"\237\224+\r=\301\305!\214l\026\362%\200fj\021\220\n\305\365\342\355\236\030\300\205\371\233\034)R6\363?\307\353W`\3419\032\204\270Y\350P\nw\276\253\337\256\367W\357\365\333\365\346\333\r\t\313\313\260\262\204\221h\006\273:\217K\017)\227\305S\\f4`\013?\240\333\321+!_\230ir\334\027\346\315\237\003\300\213H\300M\216\020\326\326\026q#Q\tK\326$\2326\374Xt!\260\006\230\364'\322\262\326uh\201dvuiyA}B\300\342w\231\315\370\207\360\333\346\026\336\372p\310\361\336f\223\232D\275\325\211N\370\223\252@\313\2326z\201\305\276\034T\230\254:U\211\\3B\270\351\037\246egn\306\372E[r\003|M\371\366\tf\342"
+	.string	"\253\221UL?x\307\206\3466C#\347f\277\356\222l[\345\240nc\f2\260\206\303\006\267\332l\324\313\204\332\034\363\013\312C\352\300t>\274\017\351\t\207\343\323GU\217\300\027\300\230\354K(\225[U\221`8\223\2759\246\277\302\376\225h4\201\324\240!%G\374\022\255\023qR\243\332\234\351\030\3728:H\024\274\264u"
+	.string	"\tD\277\377M\321I\202\223\311\025!8\220(\001\245\226\002\222LD\032]O\023u\346\274\337_dX\217\272\312\376\255\370\001\376\310\003g{\340\365\362\253\020\n\376\210\031W\260m0\350\004\305\223M<\2262\327\312\364\002*\021\333{\335\202?\210B\240 c\020\340Q\022\365\035-e\016\331\212\356\254\267\235\240\002\372\304)\257\032\273\220`me\177\231\221\334:\345[\247\006#"
+	.string	"3k7\261U\260i"
+	.string	"\335\241i\231\234\264\255\241\214\357\355\214\233a:\250\231\220\224\212S7\340b\207d\337\001r3&\005|\202\377\361\274\001\025\302\033]\277]\200>\343\272\231\t\255\263\\7*\034iE9\347P\226 \303\302\366N\004\003H3\246b\b\240\221z71\342Y\306\206g&\177Q`\361\"\304\024\371\r\007\220\017\303\322E"
+	.string	"\251\262c1@g\212q\354\021'7\340sG|\262\354T*\235\306\235\266\037\364y\235X\330\346R\264\003\220\214MY\035YJp\200h\024pH\270\343PR\354\021\343!\352\312\321\347l\247\346\351\003{\223\255-6E\265!gmo"
+	.ascii	">o\377\2033\343\002\311{t\200o\271\365\277;C\327\034\013\334"
+	.ascii	"!6\227\027&+\270+\245\n"
+	.text
+	.section	.gnu.lto_.symtab.850a3296e3fe9c3a,"e",@progbits
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"stdout_putf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"stdout_putp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.850a3296e3fe9c3a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,470 @@
+	.file	"vector.c"
+	.section	.gnu.lto_.profile.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"=\003"
+	.string	"\004\004b\001"
+	.string	"\006"
+	.string	"\360\300\300\245\006\n\002"
+	.string	"\001\002\001\001\220\262\215F\034\002"
+	.string	"\002\002\002"
+	.string	"\002\003\320\306\240\310\0056\002"
+	.string	"\002\004\005\003\240\202\262\202\016\030\002\006\004\367\242\233\212\005\020\005\247\260\270Q\030"
+	.string	"\020"
+	.string	""
+	.string	"\004A\201\005"
+	.ascii	"\220\371\332\216;@\003\334m\031\327\372e\336]\206\300\001X\300"
+	.ascii	"JP/o\344\034\322\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375 \274\355\002"
+	.string	"\224\003\260"
+	.string	"\006"
+	.string	"\002"
+	.string	"\001\001\002\004\002\007\002"
+	.string	""
+	.string	"\004\001\004\b\f\004\001\020\020\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002\002\002\034$\004\001"
+	.string	""
+	.string	"\004\003\003\004"
+	.string	"\004\004\001\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"9\001\025#T\302\025Cq\030\002\005\200\027\330\340\331\n\3405"
+	.ascii	"\224U0\016\fS\t\023\344\274\001,"
+	.text
+	.section	.gnu.lto_.inline.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375`}\004m\016"
+	.string	"\306\323>4P\2456\035"
+	.string	"BA\336:\007\017\"\2663\363IM\203/7\217b2\211\226\375\177\177\027Tee\002\347F\037\306\340\2304\210\340\200\304t\354\355f\267L2\005+"
+	.string	"1"
+	.string	"0"
+	.string	"v\265\205XJ-\346\316\377"
+	.string	"\251\0255\265\331\310X\327\304\344\366\277\240\350\332\342\377\207Z\215\263\377\fnSc\316\377H\013\3651\021TU|\315\214C\023RKB}\265\214\226\361\222\027\377\023ZLz\376?D\365\206\033nfR\373\337PO\026\"\222i\"\220$H/\367\275+\263\001\231q\305\177I]\364)f\352\203B\313\354)\226\220z\253t@\234\250\003\335\275\356\265_c\007\217\247\250\2322\231&\251\226\321\016\375\326\342\024Z\005m\204\206I1\030h/\276\300{\357Y\374?\350#5$6\031G\305\331`\226"
+	.ascii	"p\303\320 \362S\3545\003x\303\f\324*\275\214W&B\272\3553b\243"
+	.ascii	"\006w\250\201x\253N\222R6\346\320\242\032\252\325\001\022\300"
+	.ascii	"\263\030\312A^Q\022\225wi\217\315\007${F\206Cn\221$\034\250\202"
+	.ascii	"\374;e\361\263H\201\303\214l\211A\303\304\267\")h\303Gg\260\320"
+	.ascii	"U\203\201\305d~\243+\344\273%\246\352\313n\350\006\320\f\203"
+	.ascii	"\351\237\255\346\221\217\266\350\"\320\360\317\212\276\013W\345"
+	.ascii	"\322U_\0024_B\215\203,'`\216g\024^V\332\246\230\tWDT\016\245"
+	.ascii	"|)\224\246\330\334\303\2359S\0361Bg\032\251\263*p;\235\376k\211"
+	.ascii	"\026\210\304U\377\002\236v\304J\262\353\315\210\303\214g\302"
+	.ascii	"4\277\304=\037\213\255%\025\233\247\265\177HG\017\253\360y\331"
+	.ascii	"\254\347\272\322\3361o\302e\025b\271\032\246:\3622"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375 ^u\002"
+	.string	"\364\003R"
+	.string	"\006"
+	.string	"\002\001\001\017\177\002"
+	.string	"\177\002\001\001"
+	.string	"\002\002\177\002\003\002\004\177\002\005\003\003\001\001\001?"
+	.string	"\002\002\006\004\004\001\001\001\001\377\001\177\002\006\177\002\b\005\001\001\003\177\002\006\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\272\251{\336\017\306p\t\177\003X"
+	.text
+	.section	.gnu.lto_.pureconst.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375`>"
+	.string	"]\004"
+	.ascii	"r\205\020\030\300\025\322\001\2567_\357\253\252N\273\017+X\244"
+	.ascii	"\265FZ#\215\020)S\023@\333|\306\230F\243\325\260\005\tq\257w"
+	.ascii	"\205\362^\025\241755\325\240\234V\205\034\320O\036\350sA\373"
+	.ascii	"\243\323\3114\004\" \320\002)\332\rt\033P3\f\021\024xwa\032-"
+	.ascii	"\326\230\224<`\"\357J\306G\243\305\024KL\345T\311n\342~\ffL\274"
+	.ascii	"\b\233*\343\306fAk\f\026\200d\356\340\0064\034\033\352\340\031"
+	.ascii	"\305\204_\204!"
+	.text
+	.section	.gnu.lto_.lto.d8370e59bb403888,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vectorRotateSmallAngle.5.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375`W\003M\027"
+	.string	"\306,\226G\300VQ:$\037\253\3506\004\314\234\023ri\030B\341\371\212\b\225\225`\265\235\326U\246\211\337\177y\253\361\334\354\274\351o\346\214N\020AtU\377\t\201(\206\216g"
+	.string	"\035\273}\222\332\376\325U\333>!{o)S\n|"
+	.string	"{"
+	.string	"}"
+	.string	"\217~\340=\312\300\237l\253\3725\204<(q\340]}\031\237q\032\262\327lt\325\234>:\216\346\254\315\270A\355-\362\321;"
+	.string	"\371h?\206]z\264\001\357\3212[\t\f\b\224Q\b\333\2239'kUx\017k7T\331#\\\225\3716\256&r;\264\234G\230\232s\242h \240\002\036\332L\341\213\022\337\017]\223p\354\320J\\;\bsN\353\016\215\304-o\033f\233\202\275\"\002\307\335-\277\335\253N\255\352\324\251N\315\322\251Q\252^\221j\025\251>uj\323\325%\251\366\244\272\353\324\362\352(\325P\2527\2525\252?\340\344$@n\316\0219)\223HDrq\242\277\350\307\375\267C\373\366s\370:n\364#\237p82\2459S\374"
+	.string	"\232\340\025\341\360"
+	.string	"\"\301#\352"
+	.ascii	"\347\355@@\202@\360l\376\220O\217\376\215\343\220\375\346$8o"
+	.ascii	"\021b\370X2\347<\020=.t\360 \037Q*\013\263+\247UY\355ie\006\223"
+	.ascii	"\267/[:\322\273\365\\\266[\330\304\337\0213\316c\341\333H>\312"
+	.ascii	"=\017\n\235}\331\270\377`\300;\210\334\205\373/\250ew\273\244"
+	.ascii	"!!\246\350\350\272\350\235$W\253\333\331z|=3\377\266\254\n\371"
+	.ascii	"\220f\2323\202\257\366\373\243\023\260\341\276\236\231\346v\347"
+	.ascii	"\2349\273?v-G?\327\307>\321\035s\241\037\346\265\377\345E\267"
+	.ascii	"K\013,\270\226\201\005\327V\300\251\271\201\256\337\274\\1\232"
+	.ascii	"\330\013\346qx\253F\303\006\031\f0\032\317\255\004\260W\254U"
+	.ascii	"\303\201u\363\262\261y\265X7.\032\033V\013\266\201\225@\200_"
+	.ascii	"\032j`\254\330\353\005c\235j\363\237\353c\343\022h\020\321\331"
+	.ascii	"Y\334\037w@\366\273H\364\300W\31333\364U\224\"BH>h\224\3039\347"
+	.ascii	"\204\216\211\025h\001\345\204jWV|\207IjM\253Z\265}@rS\333\375"
+	.ascii	"\034\371\202XVn\314j\222\257\007\265\246e\331h\344\013\232\005"
+	.ascii	"? \200\002\221c\266\016\242\320?\035p\265\f\336vwY\211\335<\314"
+	.ascii	"\313\312\336\f\261L\257\234\024p\344\203\035\276\221\263E\200"
+	.ascii	"9\017\024\206'\342\216\300\211\206\350\314\220\2507\373\023!"
+	.ascii	"\242\215IABJ\202c\300)\0240\370\030\311\017\344;\214K!\216\007"
+	.ascii	"\r\t\346\032\017K\362\261R\346\2103\334\350\260\303\200\307\004"
+	.ascii	"\3269\356\b[\354\361\310\274v\237\204\301\274R=MW\254\007<6\017"
+	.ascii	"]\303T\263\004,\002{\251\035\254\315\372'\322\271\350\023"
+	.text
+	.section	.gnu.lto_quaternionComputeProducts.6.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375`\332\002\275\017"
+	.string	"\266\336eC"
+	.string	"\223\223\016p\207R\372\027i\004\001\020\226 +\346\205Di$\024\035\365\205\352\265\34578\017\240g,\202\003b\rH y\357\027Y&\355\377]\325\027.\\P\252[\3761\254\266\266f\304\322nI\246\024U"
+	.string	"L"
+	.string	"S"
+	.string	":/\306\210\266\026\265\305Ne$$]h>$0\2666\341\023,\267V\026\311\214\331\361\"\263SP\004\230_;\013\270\3740\007\270\374\312jy\214h\030\351\340\240\302Gfj\017a\226\221U\033\205A/0+\306\317\202\314,\276\300xp\357\266\007\332f\355W\001\027\260L\027\222\232FB\006L\304\352\362\363\r\224\370\321b\301\235\266[\301\203h\355\311\314\354cZw\266\210[v\310\261\245cI\307\216\216\025\035\033:\026t,v\354\347\330\353\330w\254\347\330\037\213\307\272"
+	.string	""
+	.ascii	"\032\003n2;\354\004\3117\177\350\217\253\001\275-\361\214\037"
+	.ascii	"\364'\263\203\2755Y\306\347>v2\214\3173n\346zK\3016\357\376e"
+	.ascii	"b\027\357\231\314\017\317\333\nn\361\373\036\224Y\374\231\314"
+	.ascii	"L\013\337n\256\251\r\226\231$\365\n\b\251\347P\271\361\322\303"
+	.ascii	"\367\361\210\263\201DKQ\234\"\fR\230rM\231jK1\2350h'\033\n\265"
+	.ascii	"\231\264\023\223\022\224fR\241h\031\201n\026N*-e\333T\232\250"
+	.ascii	"K{\3621}@tX\336\322\322\333\006\316\371\274\364\307\341 \275"
+	.ascii	"u`\234w\322\037\2273z\373\3006\336G\177\334\215\350m\004\327"
+	.ascii	"\370E\177\234M\350\355\004\007* \320\202\0219\262\003\222C3\312"
+	.ascii	"\300XP9\332>\230\232\361`\322\232a0\2345c\037L\357\315\330\007"
+	.ascii	"\343\375\315\3348\030W\213\007\251_\346\325\305C\352\271\354"
+	.ascii	"BBL\200[\313\030\235\262l\003\257\356=F&\274\345X\274\343>\265"
+	.ascii	"\260\2455\214\325xJtD@E\tzx\321f2"
+	.text
+	.section	.gnu.lto_quaternionProductsToRotationMatrix.7.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375`\276\006\355\031"
+	.string	"\326\255\231J\300\322Q:\254\210\025#C?%\236X\344\302E:\f\365\312\252\200\332\350\3566\365~]\205\030\031JM\333\366d\351\260^fQ\326\033\212B\026\306\024\246\250\220\f\233\003\354yQ)TT\nz*\225\257\252\277\021BH\2222\005}"
+	.string	"q"
+	.string	"\217"
+	.ascii	"!_\253\276N}]~M~=~-~\375\257\367k\025@v\210\021k\2323BT\220\351"
+	.ascii	"4\246\330`[W\266w\255\302\020@\024p\254A[\245\243ktm\375\240"
+	.ascii	" z\n\f\212\271&\321\022\204\023s\006kL\223\322\321A"
+	.string	"\205\221:\246\364E\352\350\236\215C\203\030\246.=p0\3641\347\264\375\202\366t{V]RU\221\004!\335\262\300\234\323[$a\202\372j\233f\233\200]&\b\277A\262\217\212X\220\232\223\b\307:\354ih\220\322\020D\352\250W\035\r\225\200\276\215\262\203B{\013\266\212s\316\351W\2605\204*\215\002U\001|=\363u\355k\231\257c\276\246}\r\363\365\313\327\263\257]\276n\371\232\345\353\225\257e_\253|\235\362u\354k\224\257O\276\206}m\362\365\353\353\222\257I\276v}=\362u\353k\221\257Y_\257\276\0165^\277A\312)\215\222\253\216F\220\314\220\301R \322u\222\221\267\3562r\032\201\321z)\034\241$r\027\372B\275\202d]d\365\220\263\214r\264\305JGY\204\274\024\212PR\325\250\212\324U_\250\362\344S\027\231~IC\n\024E\371\232\r\240O\247M\344K\341\360\007p\274\355"
+	.string	"\312\344\246\026\2069\347"
+	.ascii	"k\211^\206\035\253\006\020\251\343\016\213t\210\337\361\372K"
+	.ascii	"jR\213Ds\372h\277x\375q\030\332(\357\365\277\b\3653\032\352Q"
+	.ascii	"\022"
+	.string	"\033?\267\003<\021\227\343\361\231\345\360n)\004=k\234\ro\367\203\3131\260\355\354t\272\035\316\266\243s\323\331p<\037\233\215\314;\236\034\317\366\263\333\361l\253\340Tq\276\202\001\017N\276\017yf\213\236j32\257]cN\273\314E(\237\375\305\374\006)\267D\264\253\216L\300\254\357\351\3450\263\273\374\305(j\006\345\322\002\344I\201X\336\262r\331Y\222z\254\360\220\275\0242\251\354H\271J\354(OI\272i\216\030Nq\240\274\024\2268\271\001;19\354\365\222\233\364hs\250\201Le\021\032\031I\031)IZ\003\020\003\021\031\0257\022 R\321\212\004Y\201\022\020\201\021\244\025\226Q\250\335\343\341\354%\022\314\177t\227\371\353\217JdJ.\344\210\307\0376\267\024\300\302\356k\371V\225\233g\004r5\222\270\227\177\\r\223\350\350\030\256cd\016\r\234\032\005\373|\202\360\020p\312\334^`3!"
+	.string	"$\203G\264\253\214\017C\250\366\024\233R@\213\303\204\270$"
+	.ascii	"e2\305~\227x\203:\234\246\016%\3555+'\334\n,Q/S\202b\036TI\023"
+	.ascii	"!\001\b\303\300\024\022\311_\336\f\003RE\300F\302h\274i\242U"
+	.ascii	"P(X5` \2023\245\245\036\267\372pt\201\243\355+}\\\225\225\020"
+	.ascii	"\3041\016\341\356\003\352*@R\013\244\377\003"
+	.text
+	.section	.gnu.lto_quaternionMultiply.8.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375`\306\006\255\037"
+	.string	"6{\307G\220\230J:\304\250L\364\323\312\003\357\214\246\353o^\224\320\202\300\013\350|M&`h\025\260\243\031\227X\274\333@ekZ\356U\273"
+	.string	"\"\021@$\201Z\031\260\231Z3SUUUUUUU\265\226\264F\244\224I\006\273"
+	.string	"\224"
+	.string	"\272"
+	.string	"_\224\004\305\315\351\241\256\313L2\316\271\270\333\377\366\303\375;\376\036\277\334?\367\0039\251\372\343x\216\3538\217\307\335\307\177\234Ne\200\244P0\247\002\201\334\n\003=X\020\330\321b"
+	.string	"\234\013\001oeGi7\223C\020\0061"
+	.string	"y\033\277\001\274[\031y\366\241G\215D\f+sN\251\217\332E~<\352\245\201\001\205U\321\354\347f\246\325\330@\365U\275\214\317"
+	.ascii	"\276\315\3548s\262\021\221\233\263H\245Q\344G-\236g\367\221\274"
+	.ascii	"\316\356\243\002U\251\274xb\276\306\t\r7\266\3149{l\342\300/"
+	.ascii	"P\177\272\303\250\2018\373\362\n\3149u\325@\204\270\362UUIU\027"
+	.ascii	"\250\362\034\004\314\246z\032?\200\273]\273\376v\345:\334u\353"
+	.ascii	";\256Z\357q\315\272\334\025\353s\327\253\003\271Z\275\370\367"
+	.ascii	"\336\366W\365\352T\257J\365jT\257B\365\352S\257:\365jS\2572\365"
+	.ascii	"\352R\257*\365jR\257\"\365\352Q\257\032\365jQ\257\022\365\352"
+	.ascii	"P\257\n\365jP\257\002\365\352O\257\372\364jO\257\362\364\352"
+	.ascii	"N\257\352\364jN\257\342\364\352M\257\332\364jM\257\322\364\352"
+	.string	"L\257\312\364jL\257\302\364*\331\253\274^\335\365\352\330\253\335\253\334\253\333\253\037\260\013\f\304\017\204H\312+?\354\303]?>\374\023\306\3650\017s5\367\234y\370'\304Q\016wX\207\267vt\370\267VW\022s\030\207\265bx\344\034\036/\343\360oMK9\274a\033\316\272\261\341\337Z\225rX\3034\214U3\f\322\360o\355II\234a\030\276\222\341\030\236!\006\235\3100\211!\231\3070D\260/!}O\302\343\262cf+^\036\345\213\340\326\351\310\315;\036\263\034\0211\362V\021\021\315T\313gfnR\016\203a\037\262\274\204B\307.\244\214\2343\215K\037\0048\302\002\271\342\243\336l\367\361\314;\243\213\321\206\266u\252\305\263\367\234s.\227P}\3179\247\006\006~\340\b\236\340\n\276\340\f\336\340d\023,\214}\211\355\260\302\366*l\325\253J\314G\346\365u\241G\301\007\006\346\363\352Q\210"
+	.string	"\001\254\347%6\326\253\022R_\205/\261\036\231\317'\326\223)\316\367d6\325\272$h\034\324)\306\222\305R<\025\305RP\0345\204\342\fB-Ol\005\213\235\370i\330\304NL\334D\\b\246%&\023V)\211J<%\211\255X\211\210\304IG\214d\304GZl\304d\302'E,E\343\3109'\227>\n\260\203\004\032(\030\274\250]\271b\".\3425R\016\343>U{N4\245!&\342\366R\276\350b!\036\342\246+\207\\\034\304B\314Y\312\341\026\003q\0203]I\324\ny\250Q\\%I\nH\204\224\231\202B\232\003\020\003\t\204\210\333\021"
+	.string	"!sN\241\n\250\224a\331\030\003r4\027$q\355\314\213\202\256ZW\007\225\027\b\260P6\373\272\356k\302Q2"
+	.ascii	"U\254\036s\257\001\340\340\245\305\f\370\367z\326\032\260\220"
+	.ascii	"\252\036\2419\r\265\330\224$7{h\236\374#\205O\202\344\026;\374"
+	.ascii	"];\361\265\265_\013\201b\350\372\t\314aIZW\315\224l\250a\246"
+	.ascii	"\215\216\352\321\312\225\323\244\264\370\331\323\r\372V\347\342"
+	.ascii	"N\325\024{\353\344w\333\264\251\240z\317\3038\366\241bP}\211"
+	.ascii	"\036pj\233\357B\027\233\213\002\315\333T\036\263+A\206d\002."
+	.ascii	"\310\220L\300\005\031\222\211\box>*\300`\232q;\344\320\332\""
+	.ascii	"\300G\005Hj\301\235?"
+	.text
+	.section	.gnu.lto_quaternionIntegrate.9.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375`\236\004\345\030"
+	.string	"F-\232F\300\230\315p`\224/c\204\244\230\237\313\265k8yV\212$\363\377\377\345X\277\n\374\031\355\345\204\345\004\233i\304Xy\337\376\347\357S\026N|\024X\005:\316\207U\320\221\221O\207\202\036\206Mh\223\275\267\224)\005\202"
+	.string	"y"
+	.string	"\207"
+	.ascii	"End\367#\"\304\242\025\254#A\220p\331]\236\203\226 \036\374\276"
+	.ascii	"\036\263\357\262\207\324x \304N\337kS\030\241`\220\275\377\330"
+	.ascii	"\035\210\235\314\332u2\345iw\021\370\200xP\300\367\264\337\343"
+	.ascii	">v_\"q\330nR\323\323n\017\201\r\210\007\335\273,<(>\026\036\364"
+	.ascii	"\316\336\362\036\215}\020#'\230\250v\027\2473\276{\356\374\023"
+	.ascii	"9\353\210E\321s\325`w\235G,Z\334z\3337\333:\373\243\nw\316\233"
+	.ascii	"\356\333\207\374\266\013\371k\007\362\323\276\364\003\310\364"
+	.ascii	",\3238\231\276\311\264M\246e\231\256\311t,\3234\231\206e\372"
+	.ascii	"\225\351\231L\313d:&\3230\231ve\272"
+	.string	"\225iV\246\305L\2572\035f\032\314\364\227i\315tf\372<\253\034ThSvUT}\331)P\311\215&R\343\270$\352g\350\t\352\002\321\2234\351,\300E/\206\215\025[\264<\236\340\017G\242\373\026<*\252\320\213\252\225V\261\223\270\273J\343G7=\023\036\022\250\237\206\272\322\302\303\261\2436\005u\306\304SRM\375\364\323\302\303\241\2435U\rizMU&\236\222QV9G\257\367\302\3532\245S\260#E\347\322!z\224\0359Pt \024\026\252]\023\013\374'\021\200\002d\331\335\333 \021\036\274)H\345\n\217\245\022Ye\367\212Re\330\377V\223\354K\375\006\036\365\0278\324O\340M\377\200K\335;\217\272u\016\025#D\204\320\345\2109\237\237\237\017\031B\013\025(\370t\320\020\344\340\247\003\206\r\255\241\273'An\364\320\343\003\002\0274\002\001\215=\270 \016\030\200p=9\"\\\002"
+	.ascii	"\036\205|r8\017\343\230\303\271z{M\202\240c\252\204\032y\246"
+	.ascii	"\366\370,;\212\243\263\033\265Q\034]\321\364F\2465jSS\231MkT"
+	.ascii	"\b\206SL\355\241_\241\321\030L_J\203DS\330\214\312\350K?\233"
+	.ascii	"\316\324TF\205`\020\341)\305\250\025\030\215qiKaj\352b\251\250"
+	.ascii	"-$\233\2624\244\005^\250\201LF\005&0\231\211RP\220$\215\001\020"
+	.ascii	"\003\021\031\352\034\021P\261DET\232ReZ\003<p\340\361W\256\230"
+	.ascii	"\242|\322\3610*9\223\300O\324H\260\2074\300\231{\263%7,\317\346"
+	.ascii	"\226Vg\376]\\;\017\232k\237\341\205\224n\213zN[\303\0012\270"
+	.ascii	"/~q\324J\261\343y\270-Q\321\243\026\343<7\207\371\"\205k\334"
+	.ascii	"\370\372\037\326c\300\177\001\032TQ\300\0320\271\233\204\220"
+	.ascii	"B}\3564-\256\371<\207}\246\311\274\t\3150X\227\006\271\0368\311"
+	.ascii	"\232F@F\340\r\037\013!\272e\304\300RpT\261nZ\315\017\220t\361"
+	.ascii	"y*"
+	.text
+	.section	.gnu.lto_quaternionNormalize.10.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375`\325\002m\021"
+	.string	"\246\241oC"
+	.string	"\321f8\254\351AQ"
+	.string	"R\324>i\262l2;\262(A\322\377\030\356\242\024 l\311c\357\257\033>\371T\024a\245\337\330\372\277\323\276k\b*\315\307\f,njV\263\217\037\233\215m\357\275w\222)\005]"
+	.string	"O"
+	.string	"_"
+	.string	"]\353\262\t\225w*p\253\f"
+	.string	"X\034f\340\310\314\003\316\212\200s\226\202\031[\223p\t\225[3.e\346\370\254\310t%\250\001\316Y]6\321\234q6i\316\252jo\330\245\223\346\211q\241GGfz\367`\225QU\233\307$\326\315\312\2705\310\314\"\353F\203{\267-\320VA{\2304x\324\272V\370\016\255\261\314\314>\247\365\216{\342\226mr\254\351\330\222cK\307\222\034;r\254\310\261!\307\202\034\333\035\373q,\351X\356\330\355X\355\330\354X\354\330\037\213\307\032e{Q\203"
+	.ascii	"Q&\206#\036)\224\265\b\341\035\273\265y\032D;:\354\336F@\241"
+	.ascii	"Y'O\261\360U?\316\275\373\207H'\375\343(\257\317*H7\215\355\331"
+	.ascii	"\271\007\350\241]\373v\001=0N\241\335>\330\265!\233\r5x\324\377"
+	.ascii	"\307\276\031\305\030\305\317\340\203\357\3433\0336\"j*\301'\372"
+	.ascii	"\303e\346\202\272\007\002\005\016\204\263zFs\346w+\242\021\255"
+	.ascii	"\250\324\367\340\245\345\304\222\"\301\270'\225\324'sb\231\340"
+	.ascii	"\271|(\324w\362\\ZVP\336)\025\343\251\f\350\367\302\222\362d"
+	.ascii	"\276/\345u\2564\226\317\251\003 !\232\327\324t\031%7\3350Jn#"
+	.ascii	"\234V\351A$/\335/ \222\273(\2505\362\227\310G\356\227\013\221"
+	.ascii	"\273\b'\344,\256cV\216\223\203<\344~\375\200|%. \260\002\021"
+	.ascii	"\271\223\007CCOI1\346\025'\023\334\013B\241\210\331\025\202F"
+	.ascii	"nj^\305U\324\341\273\023\025cF\371\312\256\bh\022,\242\372B\260"
+	.ascii	"\200\305X\336\202\247\273\215\0026\201\251v\262\030\217\230p"
+	.ascii	"\323\034s\006\227\030\202(\005\340=d\227\304\230\241d/~C\254"
+	.ascii	"%-t\357\21699x\313\260M\344\371W\300H^\\\224\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375 \274\325\002"
+	.string	"\364\003\270"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005\177\016\200\200\200\200\001\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\002\006\177\017\004\007\177\020\b\177\021\t\177\022\n\177\023\001\013\177\024\377\037"
+	.string	""
+	.string	"\200\200\200\003\005\006\204\007"
+	.string	"\n"
+	.ascii	"\025\233a\261\320\213\271\f\227=@;\3609\3609\3609\200\"\033\314"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_.refs.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d8370e59bb403888,"e",@progbits
+	.string	"(\265/\375`\001\rM?"
+	.string	"*l\254\027FP\\R:\003\325\3177c\255\""
+	.string	"\300^"
+	.string	"\272\261\332\021\202\215K\\tT \232\031G\345\303\313\332\226!\334\332\034,\212`\244\377\223N\231\335\033\021\214"
+	.ascii	"\202\b!J\350U\236\231+U\377$\237&\263E\332\336)-\001n\001t\001"
+	.ascii	"-\003<\364\205\rHK\343Y\313,\276\276i\030J^\225Xf\317\242\365"
+	.ascii	"\202\327p\032V\303\\\260\365\307U\334\345\354\333\235V\226\205"
+	.ascii	"\253\202\226,,\324[\201\202\335e\210\\\273\373\370\354/\036["
+	.ascii	"1\332\255\330\255\332Pg\016\350Lu\231\341\353n\003D\"\221\350"
+	.ascii	"\023\375\022&&dO\241\305\215\211\200Ax\bx\274\345\004\274\372"
+	.ascii	"\302\201\332\017\333\013\333\267\355\3350\221\331\217\253\340"
+	.ascii	"2\374\376\334)iW\273_!\241\020 Pj\231\375\177+\266r|\005c9{&"
+	.ascii	"5\233vw\320\360\215\236Z5\263\f0\021\220\315\355_L\004l\361\020"
+	.ascii	"\360\307\021*\350}\370g\024{\027\376Y\004\032\333\001\374\271"
+	.ascii	"\303\033\234\007\375\331\350\177\334\377\267\377t\377\335\376"
+	.ascii	"\273\371/\367\037\356?\332\3775\377\325\376\267\371\357\345\377"
+	.ascii	"\\Z>\240\342\377\211\037Sh\377\374\373\261\204\037\023\177\374"
+	.ascii	"\340\307\013~\\\340\307\303\037\343\377z\377\363\376\303\371"
+	.ascii	"_\367\377\372\177\304\177,\377\367\376\317\371\177\367\337\356"
+	.ascii	"?\333\377\367\277\210\377D\377\321\374\377\351\353\353\353\373"
+	.ascii	"q\365\307F~\2413\314\3567\032\344V\233L\354R\275\242.U\032\025"
+	.ascii	"\352g3\233\332\354j\237\322\250\233F\032\rr\251\315\250\373\364"
+	.ascii	"\212\n\001\301\003S\333\301\244\251\0043\335gWQi5\241An\356+"
+	.ascii	"\355\271n\\\215jh\203n-)t\256y\205\257N\267*gZS\212\337\356>"
+	.string	"@\345,\"\355\247\233K&\355&s\312h*\013\314\327\255\221`7\346\227VOEu#\350\267\233\252\233\211\333\255\273\231\335\375\003\325z\273\207\004\271S*\252n,\003T\255\305d\213\352\316\3257\327\250K-\"-\262m\241N[\307\313\304\323\236\363\202\266T\246YOu7\236\323N\243>\362\350\354\r\355\254a\240~eP\216\260\351\315\371\271B%\004\317\371q\036>\2735K\013\3445r\266\3702;\304C@\214W<\2263\004\204b\275-\340w\035\023\225'\263\031\017\305\271\373\215yr1_\2374U8p\030\216]VR\246\313\315,\256\313?\242\\\335d\366\030\252=>\023S-\246\311\252\222\241r\255\226a\262f\r\315\226\03119\314\006\277\301ox\016\273\301m\260\033\216\303t\230\013\206\373\261\032\334\366\304`\302x\031c\245\f\016\237\301\323/U\274\356&\022\211\006\210D\"\376\312C\267\204"
+	.ascii	"{\334lsQ\216\3668\332;\265\277\321~\251=\215\366J\355g\264\217"
+	.ascii	"\021C7tu\250d6ke\251o\275G\322d\005\310#\rR\2275\004\330\005"
+	.ascii	"\005\345M\330W\354L\321RU\225\257\340\334iP\257\356,\216\325"
+	.ascii	"\363\325s\220\337"
+	.string	"W\030\247\024 A\2733h\3402\233}\344\037rA\352\200e,\020\202}\314\273:\271G\216\266>\346\250e\242P\rtcmo\220N\272\304\f\326\003\212\273R\273je\347\235y\252\rj\247\035\035^ca\025\341$uVOx<O\375\3030\257\267\260\314f\035Y\352w\247\004/KjG0\t\233\2536\027__!\223:tl\334\275\034\205\301\274\354\r\311Q\031\312\013\035>0\270N@\334\332\035\232\314\346gU\023(4\315\366\270\016\346;\266\303\005\333\311L\214\325\277\273\265\036Z|\215\205U\304\301\312\254\211\347\231\371\334\024.\374n\330]\326\335\n\204vffg\366\340\276?\230\211\350i\2625-\316\203\3658H\263rf\366\031\207\201\3603\346j\007\236\314\376\302)\036\261\261\314\342;_\253\273\262\222%\263\337{\020\250\307&\245\315J\373\374\003\273\t\355n+\237\267\241\316\341\261\017\306E\177"
+	.string	"\374\303\r\376\263\375{\201iw\020<\275\366\211\265\231\305\240/\245\233)\324oC]\252\027\323\325\302&*\364vW\201\246~\265\373zEYi\347~\033\367\323+Z\303}\245P\367\2252\203\372)\rK$\322\3572$,\311X\032\225\226\312\032&n \221~\216OHIF%er\304qiT\3068.\221!\206\234\222h -\223l\210\360iBR.\215\"\220I\244\344\211\006\307\245\r\032J\311\017\007~\264\264t<:2\002[TXQt\321\242\302\212\t.\204\307\244\030H\017IIF%\023\307\245q\231,A\340GH\312#\362\030\243\275\005\f\0210dh\372y\206\r\0236L"
+	.string	">\303\206bq\003\206b{\f\305\337\322\362\310\306\213\244\222\304\200\247\247\314\304\224\233\230\262\023S~b\312MM\331\251)?5e'\247\374\344\224\221I$\244\362\2704\332\250!\274\214\004O\3228*\215\226\311\244\322\b\300\023~\261\370\201\001\212\021 \332#\t\312\344\362\350x\303\b\231TRJ\036\031!\221\214JFG\312%#\t\b\230p\023v\302Kc2\t\206\017\331X\227>9v\231\315\323\334\004s\271\230\354$\370|_*P\233\033\271\271\"m\023\276\030`\026\023\313c\370\254{\340\270\036C\246|\335XE)\232[s\226<\217Y1\2277o`~\035\026\226\223\244\021\206=\211\303B\362\234\204\245\003E%f\327\325\225\215\240\001\240\323fU\007\366l\004"
+	.string	"\0229)\264\314\346\257\234\025\224\312i\261f6\027\3611\003cc\223\331\354u\253\2005\2639%\267BY\233\202VF\210\220\314\025\306\346qM\251\262\365\314\365\007\341\362\310\242\231\315D\262T\201\005\250\301@\205\2203#\"#A$I\222tq\005\204 &\251\354\006\022 e!T:\250h\264\244%\225\264w\373\302I7\2514\310\016M\220\322"
+	.ascii	"\323\243\306\310\017\366[\006\225\342Q\006\215\376d\212\375_"
+	.ascii	"\213\230qW&|"
+	.string	"\352\252Q}\273\352F%\302Q\261\363\r\260\264\330\024=\227#\272\341\332\020\342\2057\316\271\321\006$4\274\360\027[HI8\b\020\327\301\246\363\"xS\233\237E\"\237\260\024\fh\262\020n\206M\231\026\216|\2413_\004}XkW\003\rq\212a\005\221\241\215\240,`\264\242\366\236\301 \313?\r\357\3659\030\037$\032A\375\206\300\177\205A\025\036\300\036\227\024\371\2310\345\013X\346\200\247\204\t\017\004\242QT\305\335\320;\205\316<\225\002\250\361\337\363,\3660\227,+SI\350\352\320\263\035\275\250\004\205\224\027\264\031\312\345D\227]<\r\231J\312E/\361:\021I\211\261&\201\240\337\022\207+\365\301\252~\"\013'\201\223\234\246\204\306\201\230\b\364j\tJ\233\n9;(\253\r\\\310G\224-\213F\233\372(\224{\031\\K\003\272\213$az\244\206f\375\354\326\365\242\312\t\b\3034\205o\347\367"
+	.ascii	"\326\375\367\372LJD\313=\304&\021\345\231\251+\362\244\027\233"
+	.ascii	"\200\"P\206\267\210!y}b\225)\230\021\2317\260\020\272\370\b0"
+	.ascii	"J\304\201\300\331\t\341?\252\327E\252E\3560\234\204 kb)ay\301"
+	.ascii	"?\265\257g\311\0039(\314oYb\027\273\3347<\350\315\033hy\372\002"
+	.ascii	"r\210\236#\273\372\376\263\303\236\332\354\361\353\035Z\316\217"
+	.ascii	"7\270\264\317\202\257\r\036\201\312\305\370Q8\371\234OV\336\220"
+	.ascii	"\353\363\345\314\\|\037\365\340\037\352\201"
+	.ascii	":\365W\351\267\215\276\001\256^@G\256;\305\254<\373\036t/\031"
+	.ascii	"9L\311\226}2\215\301\253>2\245\n"
+	.text
+	.section	.gnu.lto_.symtab.d8370e59bb403888,"e",@progbits
+	.string	"vectorRotateSmallAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"quaternionComputeProducts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"quaternionProductsToRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"quaternionMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"quaternionIntegrate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"quaternionNormalize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"invSqrt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d8370e59bb403888,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
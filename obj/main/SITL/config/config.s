@@ -0,0 +1,2725 @@
+	.file	"config.c"
+	.section	.gnu.lto_.profile.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\036\002U\f"
+	.string	"\004\021\022\003"
+	.string	"!"
+	.string	"\246\274\335\377\005\016\002"
+	.string	"\002\001\002"
+	.string	"\002\002\003"
+	.string	"\002\004\002\005\002\004\001\240\342\234\212\n\004\007\321\211\300\200\b\350\223\272\372\005\t\240\270\375\251\005\002\002\005\002\002\n\262\374\202\245\005"
+	.string	"\013\252\213\336\345\016X\002\006\005\002\007\b\t\002\n\013\005"
+	.string	"\002\f\r\001\003\002\003\016\273\203\325\342\t\021\322\377\355\254\r\224\017\002\020\002\017"
+	.string	"\002\021\022\002\023\002\024\002\025\026\027\002\030\031\002"
+	.string	"\002\032\033\002\034"
+	.string	"\002\035\016\002\036\037\036 \002\035\013\002\013\035\323\307\351\365\016"
+	.string	"\036\235\357\220\225\013\002\037 \202\312\321\202\003"
+	.string	"!\267\333\375\360\007\"\227\316\342\246\007"
+	.string	"#\312\302\204\263\006"
+	.string	"$\377\354\255\233\013%\236\376\250\313\b&\350\300\306\254\005'\216\345\326\013\004(\365\336\333\371\r\b\002!\001\002\"\002\")\334\237\214_*\261\340\353\213\002+\352\263\360\321\b,-\277\265\220\001.\244\237\270*/0\240\301\276\347\0171\271\230\252\375\00623\240\342\234\212\n"
+	.ascii	"6 `\202dC\343\006U\362?}\275\2035\320\n\202\202:\350\360*Ys)"
+	.ascii	"T\254+\237[\301%\f\013\271\267!\315\226\013\\\341\314DOW\303"
+	.ascii	"\n\031g\001p\206\251\005}\036H\033\334\270\227~rd\237\301\275"
+	.ascii	"\035\224\363\316\306a\213\341\035\337R\016FP\030,\363]\347al"
+	.ascii	"\335\\\026\246<a6z\336\251\215K\341\032rL\024\243\256AE|c\323"
+	.ascii	"r\327 VQ\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"\335\003"
+	.string	"\364\003\003\001"
+	.string	"\025"
+	.string	""
+	.string	"\001\007"
+	.string	"\003\b"
+	.string	"\003\t"
+	.string	"\003\n\013"
+	.string	""
+	.string	""
+	.string	"\001\021"
+	.string	"\001"
+	.string	"\035"
+	.string	"\003\002"
+	.string	"\001\036\001 !\"#"
+	.string	""
+	.string	"$%"
+	.string	"\001&"
+	.string	"\003'\001\001()"
+	.string	"\003*"
+	.string	"\001"
+	.string	"\001,"
+	.string	"\003"
+	.string	"\031"
+	.ascii	"6\ta\006\266I\226\250`\224\242\231\031\327\324ET}(\213\261\340"
+	.ascii	"\006\263d\234e\226\312\240+\016 ;\220\030\310\262\017T!\200\334"
+	.ascii	"\001\236\"Ea\026\324\332s\212\024`\b"
+	.text
+	.section	.gnu.lto_.inline.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\326\004\245\r"
+	.ascii	"\202\316570q\323\001\200(r\f\226v\215b\254}\024\230\"\226\346"
+	.ascii	"u\340\016\031\260\202\255\017\314\207 @j\315\273\017\243\272"
+	.ascii	"00\020\205\332)\336\365\301\202\343=!\261[&\231\002\2168\201"
+	.ascii	"\240\370>\2104\fC\234\312\326t\345\224\221\222x\202.\034 \037"
+	.ascii	";D\3078\361\026\233T)\323h\033{Z\214T\3309\337IR\223H\214\307"
+	.ascii	"\200\033\030\026:\205\354%\037(\3202\226PB ]fw;\006i\377v\327"
+	.ascii	"\362\201\2467\273{\371c?\271k\220\274\300D\026N7>/EC\222`{\367"
+	.ascii	"\2350\322\273\255\333=\025\032\224\301\364T\354\356\205=\272"
+	.ascii	"\002,\321\237i4@\332\366<\3249\324\335\266\200^y?\373\356ne\217"
+	.ascii	"n2\323Qcp;7\305\311A1\201\354\002w\274]\250\021\266\242HH\223"
+	.ascii	"\032\205\326P\"2TW\036\022\300\323(\311d\bIA&\022\210\004\024"
+	.ascii	"JPQ\301Be\030\003v\340\243\370\242e\261\234\235B\253\362 \374"
+	.ascii	"\214M2!\030Ro\013\2430[\032\206f\221%\253\312\267\fE\213\004"
+	.ascii	"Z]\227\276\214\034\346<\\\327\035\0034\216?\375\221\277\374\371"
+	.ascii	"\343\005\227\271\272\306/\247\323\243\316i\265Y\217Y\351r8Z\361"
+	.ascii	",\214\221f6/\024\236 \306Vd\230p\2155\377\360\321S2\236\"\230"
+	.ascii	"\006\320\017\\+Q\230\250\362\034\006i\201\003(\227\352\201\250"
+	.ascii	"\351P\353\252\320\237\032(\264\351i\005\355\263\234B2\206\226"
+	.ascii	"\276\360\200\2646\005\250}!A\006\017j\316q\357\261\311\334\251"
+	.ascii	"\214i\345x\031#\227\013\343'\252\224\031\3120\233\352\200="
+	.text
+	.section	.gnu.lto_.jmpfuncs.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\321\004}\020"
+	.string	"\206SA=0\307&\351\300"
+	.string	"\357\240\273w\367\374~U\356\356\375\255\356\254\256X\264@-\361\204\305\323B\243`\370\b\226\252\301\300\300"
+	.string	"/#\"\324\355\307\3633~\270xX\301*c\276%\255\265\235d,"
+	.string	"/"
+	.string	"4"
+	.string	"Mh7\255\246\237\330\346\243\366\243\206w\003\177\031&Y:\252\331\222.8\307\330uWm\314\302\366Z\357}e\375\312n\257\207b\001\002\247I\303\206\367\336\373\2726\233\3478N\263fE\347\320\271\363\244!>3"
+	.ascii	"\207<Q\332\005\341w\231\2179\343,STr\305\272\332\205\266\n\r"
+	.ascii	"\016\272\201/p\206\314 O\025u\005/H\221\216\032k"
+	.string	"\216$\t\303Y\322R*\001'x@\251\224\231T\031\311\245H\316\324q\235\367\247\365O\303\177O`\215&mC\035\r\324b|\366`Z\177\321Z\264\025m\210\302\323\202\236h+\321i\004\204\006\212\320:=\362\003#\216`\304B8B\236>\022\204sW\017\032\034~\250\201\301c4\224\024\025\264t\200\002\221*\033=\022\340\3420\216\263\224\303\316\211\220\250\262\263\237\001\210(\207\b^I\306\341\310=Q\210VPQ\226\230l+\377\203:\276\365\006\207v\001\002h\362\3320R\375\021\030\223\240\274\0264[/\024\272\317i\311\240E\003\372]\022\334\233\2007\354DE\244\344\355\377Y\236(H\276j\335\301\"?\253\246\033\375\026~\001\256\324\246@\211\277#,\363|\031\210]D4b\207\263KML^\221\354#\221\020\210\313\335\363\343B@-1X9\264[\001Qx\201\344&\035-\356\036i\355B\310\225\373"
+	.ascii	"~\1776\3257\202\271\r\222G@\374\357\001Ty\351tu]\361X\264\305"
+	.ascii	"]\252\026\252\r]\3446i\2058\213\20125\342\372\341\361rp|s`\263"
+	.ascii	"\276\374\311\302\276\272\351\306(\240\237\006\263\021\260aa\234"
+	.ascii	"_\0269\023\322\213C\"*\223d\025\237\377\333\250\212\267\210\223"
+	.ascii	"\037\220\001"
+	.text
+	.section	.gnu.lto_.pureconst.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 D\375\001"
+	.string	"B\304\016\031\220U\215\001\377\307\373\034\350\356\356\256\277}\234\347y\376\210W\017M\303]2^\345\2247\031\220<\362 \177\334\361\306\031_\\\361\304\021\227\341*\234\360\006O\360\002\267\303\314"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`B\001-\b"
+	.string	"\362\212 &pM+\007\374\377\377\377\377\377\037\221\262\333Idqdqdag\036\036\f\203\221$\3058\267\332Z\267\246\225$Sj\303\303\260\327\363\032D\022\262\205UA\235\004\204\003\237\001T@\360<\007\024p&\353i\355\252g\265\373\330y<;v\034\273\r\215g\306\216zR\016\343y\261\263xV\354\246/"
+	.string	"\222\243\330MH\034\261\223\236\322\214\245\002\361\214(\2231\352\334\303\256y6\273h\007\0351\300\035\002< \240\002\022\272\342\001\243N>\016\022\356\333\n\212!\260Pm\031\267\275\024\306s\251d\013\3526\n\330\031\006\f\007}\211\220\316\360\206\020\235\021^\2149\313\036\023\366*\321\220"
+	.string	"\033\303\305H\210!*\004\314\353e#B\002\022\344M\303\356sf\376\027\212\023.\323\026\311r\3319\352+4H\360I\254\376"
+	.ascii	"\306\214\017\033\017\005\343\031\226\r\306\353 \261;\032\221"
+	.ascii	"\216\253 t\023a\tf\300E\031\002"
+	.text
+	.section	.gnu.lto_.lto.f2979dc0bf673e6f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pilotConfig_Registry.138.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 \237\225\004"
+	.string	"\024\bj"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\303\356\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\006us\250\305\006uq"
+	.string	"\005\001\006'\001\"\005\001\006\035\001'\001\257 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/config.c"
+	.string	"\005"
+	.ascii	"\256\222\360Sv\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pilotConfig.140.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 (%\001"
+	.string	"\340\030"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200\020}{\274\001y\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\243\f\240\b"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.144.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 \240\225\004"
+	.string	"\024\bk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\203\366\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\021\005\001\006\035\001'\001\222\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/config.c"
+	.string	"\005"
+	.ascii	"\257\222\320Sv\301,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.146.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 ]\245\002"
+	.string	"t\004J"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"\005\001\006\035\001\002\005\001'\002\206\b\177\005\001?\202\210\200\340\001}{\273\001y\273\001w\273\001u\277\001s\273\001q\273\001o\276\001m\275\001k\273\001i\273\001g\274\001e\273\001"
+	.string	"\005SITL"
+	.string	"\004"
+	.ascii	"@\204\315\313S\206\036@\021"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.147.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"b\f.4Pm\222\016\244\034\240*\247\352fm\323O\013\333\314\362\264\226\177\353\035\220\033\332\355hC\357\234\212/\215BTUE\024/f\027\020b\fz\210\303\332'[\246S\031\b\315\303\246\242\336F\323\020\361(\213\3632\004W\022\016\326\233\250*\353a4\254N\264+\300\334\347\347t\204\" \023c\341\212\264Tq=:m\321\301f\235n\347\322\t\235@\t\303\355\265\017\272\321\327\222N\364\343\350\006@N\016R2A\333J\232L%\037\277\3471'(x\276\252\221@\227\221F\006\211J\246\366\\G\257\342u\033R\013\ni\313B\027E"
+	.string	"\206\314\034\263\320Fw\375\r~\204\237#\t"
+	.ascii	"\252\322\t\314b#\206\024\024\002t\r\377\213\030K\210\034\356"
+	.ascii	"\234\251\235O"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.149.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 \363\265\006"
+	.string	"b\214.5@o\222\016\230>E\267\325\001\341\003\334(F|La\376\313\320v\227\013\271\215\315\236u\264\234\026xQ\203\217axT\311s:\220u<\202\326\240\265\366\311\226)W\233\007\216C\307\252^\207\303"
+	.string	"\361\252\313\3636\003[\021\r\327\223\260\254\353i\266\254\216\264#\310\\\350\367td\002 \363B\341\212\324Dq?J]\361\301j\245\356\007S\n]\200)\303\323o!t\245\357%\035\351\307\321\t\240\250\034\224d\212N-\231B\235\200\374\240\327\214\220"
+	.string	"\032\353\326!\302\22460HX2\267\3478\212\025\261\333\220^V<L\264\221E1\263\220\231\2436\312\350\256\177\301o\360k\004\t"
+	.ascii	"\252\322\t\314b#\206\024\024\002t\r\377\213\030K\210\034\356"
+	.ascii	"\234\251\235O"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.150.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\025\007"
+	.string	"\"\31506@o\222\016\230E@\217\302\f\f\210F\241b\222\333#\225\035\207\215\337^\34466{\326\321rZ\340E\r>\206\341Q\341\322\034\tNNIw\036\254\221F\210L\001W\233\b\016D\307\252b\207\343 \021\253\313\0237\007[\023\017W\244\260\254+j\266\254S\276\321\017!{\241\337\323\224\212\200\314\f\206\213\322\315\342\222\n\277\370\270j\205\367\363\004N27\363[\310=\217\357\224o\364\273\335\033XiYp\311\334\230\221I\026\2502\362\203^sIZ\002\032s[\b\007U\"i\224b2\267HP\003\252\320\265\200*| \305\352\260[\223N/\"0\232\b\243\016\240!3w\232\250\243\277\376\t\277\302\377\021\n"
+	.ascii	"\252\322\t\314\264\312l\034\n{d\260\3105\3746bd!\362pWL\355$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_resetConfig.151.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 \324\265\005"
+	.string	"\"\212&1pi\323\030H\031\020\340\362W$\b\236\336/\032\222Z\214z\207\026!\302\305\210\2336\2663\n\363\335\377[\267\376Ee\203\266~K\366\353[\271e\nG\020F\272L1\202\223T\311\300\210\332@\350q\324X(\310\211\221\202\317\266\251\032%\353\004\364Z\337w\002^b\277\006\211\356R\3537\353\351\301\347bU{}\n $\017\273\004\025\024\3331\034\024\376|\256>\"\267\204Mna\200\233\330]\250\bY\345\253\316dH\007\226Y\371\032\223\335\375a\231A\256\371C\376\310\017\020\t"
+	.ascii	"\252\244\233iq\323\031T\341:\327p\262\020\306\313\020\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_activateConfig.152.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\237\003\305\030"
+	.string	"\246\252\227G\260\030U:\322\226CwP\233~\275\026\240\330R\364\002\352OJ/\020\222\t\341\264\316!\366\354W$\304\266\366\335\217\327\\\322%\212e\241\340\216\260\257T\320=\233S\254\345g\203O\023\372^t\375\211\032\331[J\231\002}"
+	.string	"z"
+	.string	"\213"
+	.string	"\315_\00287\245\236/\265\276\0306\325\340\264\"\344\377~\231l\022\213\355\375t\003*\251\265.\322\362\376\025\273\344\027\204+~\026\177j\347\246N\377\245\355\351\352)\367s\341dM\255ul\037KW\234\262\231~w\267"
+	.string	"j\266\330\212\250\031;wj\255)\333\020\313\026)\033\215[&\310\321%\006\216m&UJ\2703\273[&\262\r1\237\032\324Z\3175\333m\177\332\377\257\377\017\376\026\006b|C~\263\213\376\022\271\005\b}e8l\224\027\017u\357\260P<p\323\230'\373c\201h\265\304\235\334<4:\023\023\356\212d\b\\%\215\022\217\336\227\270}\323\306G\206\306l\376\273\326\311\013U+\315\347\353\333&$\276@v\036v\202\267vB\334\271\235\272\t\217\220d<\374{3\356\334\277\262v\321\337|\325\344\353H~\316\344\243&\377$\362\305\311\237\315\227\222\337\315\347H\250\320$K\016p\367Ow\224\311\016\255c\367\322\315K6j\310xHyG\034\374\f1\300\177\204\237\335m"
+	.string	"(8\202\263\216=\247\277[\226\213\212/\220K"
+	.string	"\002\342-\002&\340L\314\217)i\265\250\220Rt\265\f\233e\202\f\243\253\265.\270\262X*X\b\342\255\005\211;sz\223v\302\300M!\362\361\233\241j\235n).\332,\357\030\266\n\025U/o\307\036\300#\035F\365\257a\003o\355\251\035\264\216\241\304\316}w\003\027\261\372\34021\246\020\321r\215\b1\340\254U\313\025\242\004\2145\226py 1\262\204P\214\253\002\207\231"
+	.string	"!4\246\200\301\204\306TO\266\262v\321Y\362,7\317\3364q\001\316\236E5\021\005\030AY\317lk|x\366I\006\2451\324\261\213}\262\261K\364\006\032\261WFH\262g+\300\261f^\250%\263e\250\016\036\024Gq\342N\331\f\212\2509\312i\351\341\257\220\032\201\3310\364\007\rB\205\310=\032\221\022\241F\260\004i\035\013Y\250q,d\224t\210L&JS\220\244\003p\002\241!\264\016\020P\312\030&\313\032\357=\324I\241\363cbQ\232Op \225\232\365\377\240\335\332\"Sw\336\260\243\317<\360\033;\366<\250D\177-u\355\313}y\375\347\307$y\351\361\\\366UU\274\030(nG"
+	.ascii	"\211\215u\336\257\272\322!\335\364\037\3660\241a\224m\371W9\025"
+	.ascii	"\202\344Bl\360\005\345*\222G\3021'oN\310\317\242W{z\357\376\016"
+	.ascii	"~\374\262g\206\353\266\341\356o\232\001\220\023\363Y\344\203"
+	.ascii	"`\354G\210\272\323I\220\272\0063\375\026\206\366\177kQ\177\312"
+	.ascii	"\200Q\305\376\310_\2317\363V\231\256\006"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.154.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\234;\375\325"
+	.string	"zE\235HI\020\020\246\355\214\0017\374\270=[\b\217\263\020%$E\316\302\025L\313\216\340\r\267_\221\334\3456\220\356\310.W\016\f?t\212\371\034\242\232\356v\221/?\263W|t/\364\205cb a 7V\006\036\265\2242\245\224\002v\004\"\004\226\004J\346\346&\257\302\375&\353\317\2518\025\234\024j\2323)yRaPq\274\t\346/]\344\026\242(\223\346\303-\013YnU\356GB\306\353\367\312\333S\310\322PQ|\337\227IW9H\026\033\225\232\034\304Rkj=\214!\n\217\332\310\214\214\247c\372\346\f\017?\236\236\305\303;\374x\210\324D8;|\212l\241\035~<B\352\324\203>\265\033\321\325\215^\035fU\250\223\343.$D\002z\262\002\222\223j)\n\001j\026\214,\220\352\247\207\214\217\332r:\217Y\210\001\320r|!\n"
+	.string	"\376\2016\222\335\361\241\356\210b}d\233\236\033\326\233\336:\207\345\244\345\370\343\310!\343v\343\216c\241f\341\220.@\243r@B\273\361w\375Q\331\204v\343\243.\324\255\263\025\215\326k\335\306Bl\032\312l6\024J@\251\275WA\326\264\231"
+	.ascii	"\250\331\022k?;"
+	.string	"\215\331j)\254/\226\332{\305={\243\366C\255\213\332f\201\232C\333,\313\250\301\354\263e\211'\265\267\252\355\232\322\346\214\372\276o\222\232\345\026@\3152\231\023[\r\354\375\371\332\"\325F}\337W\351\277\220\242\323\303\377O$\"\"jl\333V\221\210\210\210P\317\216\345\370{Ukv\201\201\331\254\207\033\231\221\3630\036^dGV\344;\234\310\210|\310vx\312R\216\262!S\271\312{\370\221\353p!\023\362 \0132\035\016d@\376c?\356\3439\314\307{\254\307y,\207\3618\016\3371\034\266\3437\\\307n\230\216\347X\216\343\030\216\333\360\033\273q\033\2631\224\331\360\032\253\3610`\207\216\0348\n \340\206\215\0324f\310\030 \206\022\214\027.\222Z\260@Z!\200\212\024(N\230(Ab\204\210\020 >\034y\350`TD\304a\203\206!e\006\f\027\204\222A@?-\273\2763\271\273\264"
+	.ascii	"\247\256\236\232\365$:\225\324\271\221\361\2609\317\241\035g"
+	.ascii	"<!\270\232\207Ne\352\274\210\330\354\270\006]\261[\013\301\325"
+	.ascii	"\274\263\332@\fKk\252\033g\305;R~"
+	.string	"\316\211\177\315\210\336\234\343|\330\327l'r\317y*\330\305\327,\005\\c<\3269G\365\232\r\365\232\251|\315\325\276\346=\177\315\217{\332\241f\265\035jRW\256\363\323\203\332I\2673VT\340\352\2126\027\256\037\205\252\025\202\253I\267\352`Ls&\234k\036\224k\026\224\243\003\027\347\034\270\226\220[K4\266q\006D1\327\374\367l\366{\2429\367qu\2355\3171\342j\232\361\205\340j\256i;s\336+[\024s\326\313#k\226\263X\226\005o\261\314\214s\234\305\2622\316wd\302\234\341\214I\004s\266{#\246\271.\213\233\3041F\\\315-g\272.^\234\347\326\241\030\323-\316rD\202qC]\\\232\341\246ZFm\214\270\232XZ\\\315,\347\267\252f\267\020\\\315*+\316mU\232\331\252Pq\206R5\263\241\232r^[U\340\352\232\322\254\026\202\2539e\315\302\325\224\342<\"\333"
+	.ascii	"A\253HH\337\321\247u\360\361\034\217\216c\217\027\320G\320\252"
+	.ascii	"\352\004\364\241\372\215;m\343N\rD\032\207\211>\303N\313\260"
+	.ascii	"3\365\001\354\264I=F\264\225\242\200\016c\235\021\205\252\325"
+	.ascii	"\202V\321\365\302\036)"
+	.string	"\302n\373\363\027~qc\334E_'\315\351\026k\321\234\265E\034\237\263X\207\366\326\030t\216\364\323#\314\025\275^Q\327\002\324\025\272q\025z\235b\256Q\254*\346\326\017'\342\342\344\334\004\\\227\200#\221\326\306G<[\304\023\315C\2345\210\26383\377\260\246\217\326\004\226\271\007\262\356@\346'\346Fa]\024\306g\306\211\3124\2072yd|\203\367\265\0061=\264\3228\274\332\"\204%\261N\243\261\002s\245\240\225\030/\236a\2531\254\"\006\377\306Nh\201\221k4V]\374\302\332b\253O\205\026\264\332Z\213\350t\035\242\261\322r!.\235\\[(\332\351i4V\\\326\242\252\260\251nk\023\202V[<\310\004\327\225\254\006Bc\205\345?R\336fivuQ'\315\026\016Ysu\204\256\242\370\232\341*J\350\n\312_\320*k-\361\276o\267\265S]5\335\177z\274\357\313>uu\245Y"
+	.string	"\315\234\214cf;\346\030\215\001C\337uR<\256\024\210\227@\301\305;\256\b\3306\253\374\216k\026]|\312\236\037\336yhgz\224G\307\243j"
+	.ascii	"\r\353\344}\007z \034\024\354\3007\350\201,\364\001\376\361}"
+	.ascii	"\373\031\365\225\331\233\303W\324\177\205\256Wf/ON\377}\363\021"
+	.ascii	"\275\363M\307\271\203\363y\336\312\264R\274q\275\341\360N&\361"
+	.ascii	"\245]i\2736\b&\317\340\037\273\206^\347J\231\274\200m\2355\036"
+	.ascii	"3\022w\343\332Y\217\272\352\232{\316\336\367\235s:\027\221\335"
+	.ascii	";\356\242\273y\374\276\363\032\005\0267\250\241\334\026#\177"
+	.ascii	"\341Ox\346IA2\234\2256/\033\336\311\236\301\343\332\207<\256"
+	.ascii	";\256\203\312<B*\271\221Z\035O\305\255\301\207\367\333\256c\313"
+	.ascii	"\354V\335G#\217jUE\257\22386\264\326\275\365'l\031B\245CS\212"
+	.ascii	"l\224j-\364\036\266\322\240\32377\241g\241\207\031\016\360\344"
+	.ascii	"3\273\221\314\247\031_\240\376\251\351Pf\0246K6L\251\344\007"
+	.ascii	"\245\251S\266\266P\305\206!\205v\332@^v[\027\230Tm\320\023\231"
+	.ascii	"\342iL* G\363'\263J\025\363\352\252m6\350Yha\365i\303\275\231"
+	.ascii	"+\264\314L-\314\254\255\367\303\352\227\252\242\320;\275\337"
+	.ascii	"\274\214\371\365 \004\311\2720\275xO\361\0057}\200\242\220\201"
+	.ascii	"I.\333\237\357\265;`\362\f*y\267q5\314//\202\343\326\214;{_("
+	.ascii	"=\305\216\306\3230\273\330\311\374\362\257\226)\206I\306{\352"
+	.ascii	"\3471Xy\f\204\372\247 \017af\204\356\372\310\200\332wA3N\206"
+	.ascii	"\231\326l\3211L\261\033``.\206yfe\246a\2161\307\332f\333o6\351"
+	.ascii	"OV\263-x\030f\032\t\347\001E^\354\377\f\346U\333\016\275\324"
+	.ascii	"\202YJ\021\375\"\244\213\232\2553\306\226>\216a\223\264\353\373"
+	.ascii	"\024*-\363.L3\036Z\007\324\340\262>\0171\315j\315n\251\024\311"
+	.ascii	"\326w23\255\375w\202N\241|\017\232c1\323H\200\275/\224\rf^\272"
+	.ascii	"q-\007\024E\337\027\212\200f\331W\360,\t\254>~\264?\332f\377"
+	.ascii	"\177\006\345\224]\320\022\250\370\357do\244\326\237\b\364\017"
+	.ascii	"\312\367\260222R\332H\355\313X\003\030\265\325\364H\356o\254"
+	.ascii	"w:)Hn\300\257\226\200\336\367\265\301^\345V\017p\227i\226#\230"
+	.ascii	"\300{\252Y\356\t\332f\373\231\272xm\241=\241x$\263Z\323\337\311"
+	.ascii	"\334\036\304\326\002\371\275\230\233\261\025;\332\205M\330\202"
+	.ascii	"\035\370\347\327}|\2757\344\334y\275\326\3176k\265\346\336j\266"
+	.ascii	"\346\306R:\227\340SQ\315M\034J3\223\206l^\322{\232Eh\307\346"
+	.ascii	"\020\230\224$ii3\222&l>bD\310\271\210\2203\021\245\363\020\245"
+	.ascii	"3\bJ\347\017\204\234=\020r\026\"\344\334\201\322\231\003\245"
+	.ascii	"\363\006Ig\r\214\2343H:c\240t\276 "
+	.ascii	"\351lA\322\271\002\2453\005I\347 I\347\t\224\316\022$\235#H:"
+	.ascii	"C\240t~ \351\354@\0236/%\235\201(\235\0330rf\240\235"
+	.string	"\177\0309/`\344\354\243\235\025(rN \351\214@;\367hg\036Jg\003\222\316;\032\256YG;\347P:\343H:\027\240t&\240\235o(\235m$\235k\264\264\231F;\317H:\313h\347\001\3329F;+\2653\214v~\321\210\315.\3329I\351\334\242\235Y\264b3R;\257hg\025D\316)\210\234Q\0209\237\340\340l\"\351\\\202\2033\211\244\363\b\016\316\"\222\316!\206\234A$\235?\f9\037%\235=lp\356\220t6J:\027ip&J:s\030r\3360\344\254a\310yh\310Y\251t\316\240t\276\200\301Y(\203s\022\203sP\347i\006j\347\237\244s\233tf/8\257I\347\027r\366\244sw\265\335\224\331\322\372\342\362\206joU$\2377\220\205#\346S\355Q\355P\272!\273\367t;v\347\351V\354F\354\226v\023v\303u\237u\253u\263u\021\270\370$I\332\370"
+	.string	"\356M\220\344\373\371\255\345\227\027\265\325ls\2454\300\324V6\350\241\"3sje\263\346\315xm\2635\242I\036\307\343\360\003\244\201\366&(\201\003\211\035\204f\026\006\201\307\265\013\riZ\364D\340\257\025\226\006A\027\360\r\204\231A\247gf\005<\333fX}\340\306\215\256\242\245\213\003\323f1\005\322f\317k\0034\036\t\222w\25650'\237%$\337f\337Z}oQ[M2WZ\003\354\305\332\302"
+	.string	"\300\020\307V5x\205d\216\370\266\242q\2454\\\254g\\\271\025+\013n\035\2200\257Cf\346\225Ul\r\263\001\306\210\344m<\216\276\272\207\324B\003\362c\332AheV\030\360\270\24614fJZ\003_\343=\fT\272\204[\3110\323\306\324x%1O\006flq\346%\335\262\316{j\3063\265\240XUl\376X\332\255_K\"\300\3028\377\310\030\027\220q\267z-\001\255\\k\327\022/o\271\267\3276+\343\177\234yU\037O/\232\002\003P\r\360Fk\022x\312B FU\2147\312r\300\2536E\316U\017\245+\245\347"
+	.string	"\311c\350IM\312]\325"
+	.string	"\030Od\255\3220\236\203\236\035\353U3/\347\270\217\034\024\267\340\351x\361H^\274P\336\032\031\226#\351\211\352\274o\322'\313\236\025\253\264\301\301\3421@\002\261\370\237\025\334\357\346@\013X\361/\330+\276\035\233\200\261V\361D\240\323\276rV\003\\\322\361\236R\361\030\356"
+	.string	"\003\241n\274sY\3302/\007W)\313B\033RKC\245\250\245T\200(3\3244R\031\213\304\300\261\331H\361\001\370\372\262\2636W(\353\323\372\246x!\302\306\262g\215\2576\212G\341\253\013\361!\373\360yDQ\245\261\330\236x\"\313;O].*\201\3612\317;.\033WD\227\216\257gY%\001\306\370\215\313\307e\237e\3442\262m\366\304\013\0212\232x~<\213w^1C\2117q8};\031J|\016\257D\022\317\037u\261x\224\335\2477tW"
+	.string	"*\374:n\263\335\300\242\214x\022R/\310L\373\300\247\343N\241r\253T\265\315\216\370\034^\210eO\023\\\304\363\377\271X\276\357\375\334\025\206\232\021[-nV\211(\377\304!^\304\277\340\362{\314\264\274\327s\273xq\301\200i\233\r\361\005\020\036\226=\2338\263\353t\277\374\216K`\363\237f\274\363\316\225\252"
+	.string	"{\337\027\216+fD\324\016\003T!\231\214\017\004\361\027\320\220y7\256X\373\201\321\271c-g\016\304\267\237\230\001>\3041\323F\200\301\271c\035\242m>\374\017\033a\214wF\333\\i\n6!\302?\252\233\3519*\275\223\177\f\333\025k\217\336\t\352g\346\327\\1 \265\243\377\361\372+\363\341%.\300i\f\\\035\317\334\201\261zp\317\274\0313MD\224\3354\277\306\035\353"
+	.ascii	"\326,?\331\227\271-\224\271ffm\263\036\276\333z\205\232\276\027"
+	.ascii	"\357\3441I\255\370\274j\320\361F\236\212\315\340a:\317\250H\027"
+	.ascii	"\357,\323F\276\025\177\307c\222\213\366\003X\002\342danL\215"
+	.ascii	"\322KN\214/vm-\334\265\266\203\233\366g\334\265\027{\026\\h\233"
+	.ascii	"\373\366\3266\333a\005\033^\225\305;_\360\255h\306\3475\305\322"
+	.ascii	"\037y*\3665\320\351\267{\255Q\241\017\322;\033\251=\362\315\370"
+	.ascii	"\315\007g\350+\236J\223\031C5\024\003\306VG\306\210\210gxG\200"
+	.ascii	"w\262\321\027}s\301}\230\245\316\213:]\271\216\343\322\275\227"
+	.ascii	"[\367Z\322..\243\357<\351S\315\177Y\202\021ev\355\336\213{\007"
+	.ascii	"\201\027#\333\321\255.E/\024\307M\025N\317!S\347\247\342Da\007"
+	.ascii	"\241aq\203\302\343z)\305\226@\272,,\26692\306\031m\202\177(\230"
+	.ascii	"\027\270\240}'\200\332\315k\211\360^\0057\017\210\327\231\033"
+	.ascii	",\177\205\350\327\267=\023\357\244j\253% ^,"
+	.string	"\324UY\301\300\350F\306hc\232\307\261\304;\371\365@\245$\b{\251\345\360N\320\275\237Z\002\342U\346\315\224\227\302\341\327\266\275\021\037\305\307.\312C)\261D\212\330\360\032\336\t\3727\347\241\270\322\007\363B\275cF\362O\377n\370\216#\306\317!\251p\372\360\321\360\037\231\025\342\235\210\275\2070N\225\212!\r\037*#\210w\362\320+\337\t\n\250\307\225\276\227\301F\306\254\004\306\221%LH\232\234F\370\340\310\223!NK\232\234\2364i*\222\202\225\300pr\304H\023\223\017\2128)\0259b%0\2140\215\240\364DI\022\246%H<\260\022\030N\224\232\230:8a:a\310\312\324G\2144=\340t\344\004&&AK\20609\035\241\300\311\bI\202\2364)q\242\300\222\246\"MO\232\234$pjz\322\364\200\221#N$\204\340\"0\2220!i\322TD\251\t\323\020&JE\234\234(\301"
+	.string	"\301M#\034qRz\322\324\344\244$\244\006\245\337\313PK \224o\362r}_.\036m\255A\221\215G\226\360N\376\231>\351\275\377\251\tI\335\364T\206\317\225\204\246\357\275w\252F\301e\360I\221\207\263|\"\301\332\021y!_\344\177\374\244\260\206<\021\020~\310\226\017\336E\203\360\036\360\242\370\254\033\374\007\337d\220Kd\324V\223\341\340\251C\307\311S\353\301\273\220\357\340=\370\243B)\254\246G6Y:\327\221\235\023\362\335'}r\360\035l\360.\232\203o\361\242\370h\360\033|Ga\343\230i\312+\2706\032\274\016i;\013\351\3308!e\360Nl\333\322\311>\321Q\335\n\263\373\205ec\241\031\274S\351\365M\026`\031"
+	.ascii	"Lx/\016\032\323\324\205\317\2569\342q\035\302S!\265!\214q\213"
+	.ascii	"j\216\020\302wa\020(\326[\023\223\356{v\232BR7i\362.\325\244"
+	.ascii	"\311w\237#\006\237\366\244;\233B;+\3411x\227\022\353\013\276"
+	.ascii	"\004\013\376\002.vM\331\331\024\262\026,x\227\312c\"B\007>;\r"
+	.ascii	"@R3a\362\336\\\302\344;\360G@\267\274U\360j\322\320yy\024\232"
+	.ascii	"3\004|\005\357\315nC\301\023\020\344)\360b\303\314\320yE)C&\310"
+	.ascii	"{3\216\bL-\370\354\024\205\244^\022\031\302\222o\301\037\001"
+	.ascii	"\315\312\233\340\301\276\016\035J\030g\213\237\340;\222\305j"
+	.ascii	"\t\276E\004/A\030\266\213\353\320\237\300|\211\340"
+	.ascii	";\222\216\351\235\254\034\223\244\t\237\235\236\220\324\"<\025"
+	.ascii	"\267\b\311\304V\"\3027\341\217\200b\031FmA\360]\226lD\265\334"
+	.ascii	";!:\220\\\266\364\024\236\f\017A\207B)\302\007>\303\263G1:\360"
+	.ascii	"\017\374O\243\024$\030\253e\251\023\301\226Rl\026\367\256\217"
+	.ascii	"\354\346\324\364YA\005\007\276\037"
+	.string	"\373\007Y\226[\025\316\233<[\222H9a\n\205*\335\001x\247Us\217'\357\303\335)\332\354\246\244\360Nf\257\230\275\302\211GrV+\314Vq\342Q\335S1K\205\023\217\346\274E\264\315\262S\2309\361\250M\357}\237z\313\247^\0263\276Dq\310)\254\324\222\020\235\271=\314\356!\033\265\244bA\320ak\363c\241\330(\313*U\313+,m\263@B\370\006\276\251\275\302\311b\203\032\276A\366\225,l]H\306\274\335\032m\251\005h\212\331\247eV\f\366u\307\270,\273\270a\371RU\364\261\277b#\334:{\372\373\276$\006\360\222\330\302\322$\262@\016\375\001\311y\237#\266\326\027\222\325\364T\201\370\013\364\321mm\201\037\013G\336\271bZ\244\243\317\253\007@\317\364TL\337\317\365}\337\327\310;\233\351;\372\315\330+\237i^W\021\006\236\202\302\2453\204\2613\302A\006\036C\230\274\352"
+	.string	"\022\265\224!\362\343\375\351\303\313\217\357\261\2562V\265\031\362N^\373z\001)\2305p\351t1F\006\370\267\300\263nye\317<Q/V 8[\037\357\324\265\316Y:\221\306\324l\23592\273eV\276\345\327Z\264\350\030\205\314\252\267\356-\305\220Y\232\021k\233\365\361\335\330*\242\344T\237o\370\346\t\346\003!I\335\214\rT\305\013\353 \251\201\236\212\333\203/_\361\322,\3072\360\235\t\024\242\300;y\371O/\313\314\226h\336S\n<\tv\212UE\250\016\336\371\305\023x\346\345\332\022\212\300'\360\037V8\253\035\002\337\215\322'\007=\336\3538\\\367\3706\333\200\307_\330\363O\036T\362\034\003\2414Xl\026S\fz\355y\275"
+	.string	"\351\225(1 \260o-\003%\337k\337Z\177\206O\245m\245[\002\"\246&\0173\023\312:'\247\344\rx\034\177w\224\244\264\235\301 \310b\007\241\241\271\261\300\343\032I\251\247\305\352\202\263\336\361JN\366\253\205(\013\312\364\216?\022#S\301\263w|\003b]pmv<\213\307HA\216\034vA\022\233\305T\202~>\257\001\204\330\250\323q5\331dTsR142\242)H\222\341\243\027@PH,,\324\345@|\003\023"
+	.ascii	"\021\350\"\331T\217rP1\"\321I\322Bag\016\315\250\205Y\366r\232"
+	.ascii	"\260\205\313\325s\032\267M\305=\364k5IU\272\213s\202u\313:\245"
+	.ascii	"rpY\376\352\t\263#\371\335X\016&T\023\2651y\242\211\321\032G"
+	.ascii	"\"\2213\262\201\b_\213A\3178\376]\004\222\346\355U\305P\306\306"
+	.ascii	"\314\327\246\340\363h=\317v\274\371\211B\334\341w.O\204\235\252"
+	.ascii	"\tc\2450\375j\363#}\245\277\025\\"
+	.string	")\"3\215\314\204\030\371\021\347\355\316\353\f\232T\n\256?\353\234\367\222R\361\021\004\222\020\337\021\325\273g\327KA\017\274<\361F\366/\210fI>9\213\230\020\301pr\206\006jgv#\037v\2224<\333#i|s\307\211\306\222W\366\035\307<\330\331,\3471A\007y\316\241\206\223_\"q\340\\\245-ur\246\260KH\376\242Wv\"!N\016\303\332\211\226a\341/\342d\314\263X==k\330\234\305\341\022\213x\363\031$t\220\357\204\233\033A\023\035\352O\314~\b\333f\004\367i\2342\007e)[\323\245Wm\363j\3712\337d\211I\344\262U_K\033\016jz\202\203;\035E\336\240\t\376\221J\352\344A\353\212\016v\204\tt\372\0075\341? \024}X\267B\220dB\220\036\356\307.^\001\3538\222\355'\177\231\213G\374\2619D\301\231\314\254W\372\007M^4P,\372\301\023G\347"
+	.string	"\0047Q\364b\232\346\315\032\036zS\023k\344\265-\021\335\204z\324\204,\247\246\345)/rBNV$aUkN\267\265\306\017~\322lR\242>\t>\026\324Q\223U\311\337\027mJ\323\341\243\310\216\350\201\276j\346B\301\032\277\352wFz\216\001;\016\343#[t\245\017@\255\272Ve\377\252\307\n\334!\231\342c,\016\366\225\177\356\265\311T\306\035\327\2720j\232\331\355\226\305\024\262T\rz\224`uf?P\213\324\310\260N\214\271\246\215vB\036\253%y\312\004C\036\207A\212\306\264\252"
+	.ascii	"0O\330\250\361\356#>\215\321{I\020F\303\275\241\333\006l\f\337"
+	.ascii	":@[\3600\277\225\3231\237oVg\256m\312'\246\034\rtI\202il\265"
+	.ascii	"\353\342[\b\331\374\335\332\356j\2101\256sI`\351L\257\367\006"
+	.ascii	"\336F\322=\032\342&\327\2077\242\225p\225\031\330\252\032;\211"
+	.ascii	"\264j\277G\330\244\304|\376\224I\311\220F\255gJ\365\334\373E"
+	.ascii	"\020\022w@\035!\256R\352\236\354\351y\373\032\242^p\241\350\341"
+	.ascii	"%\312\260\033\030n5\353\277\343D9\320\035\370\\o\332\314\362"
+	.ascii	"L\202\273\356*J\t\3563FYv\252\202\347P9\031\303\312\237a\214"
+	.ascii	"*\236\361\362%\361?\306#|\355"
+	.string	"\273rPVC5#\335\351\r\376iV\323\261\037\020p\350o\252\020X\327\024i\334\no P\310\375!r\274\240\020\244J#/\337J\306V++\032\210\310/\fJn\274?\314\314F,\351\271\274\335\004\300\215\006\246\001#\354.\r\325\250\333\225\263Eq\255\302\0026\036\232n\335\b\021\013\3207Bq\3746\332\334\252\372\3616\306\236\311{\352\317\3013\236\347\274\233D\024\214\267w\020V\364N\271n\354 \202\340\202\240 \372&\322\272}\332\275\243\244S\350\306\226E\212H!\034\307]m\265cwC)$G\346\222G\031\225,U\322\225\340`\333\316\261\034m\355C\222\"0\373.\2576xs\276\310\351\031\316a\026\t\307\037\365\311\016\031>UX\f\017\215\t\367E\217\245\257U\n\003\\\213\211d\267&\326@-\245(\332\304'\334\314V(+r\247\024\303K\tiG\003\024\354\270a\236\326h\327?"
+	.string	"|s\022qj\347\305R\320\224\314\353\274\207\337\254\352\007\362"
+	.string	"\211.t\275=\374>\303M\313[\235\376]\244\036!\030\363\255D\027\365\242#aY\345W\177\201P\250<R\225H\200Fb\342\246|\204N-\3515:\025\361\230\013\210\214\322\336\270\251\225\316%\274:\342\273wfR\342L\021kQ\274\246Lgl\2770~\216\345\376\341\320\223\217\256\251\326\210\271\314:\337\372N/\016?\201I\320"
+	.ascii	"\216=$\240\271\bE,@Tn\250\304>\256,\031#L\276\341\b\326^\250"
+	.ascii	"\325\274\t\354\\;\001\013\366\356\373&q\217%\214\211\240\344"
+	.ascii	"\001>@'Q\030\\\322\236\273\034\245\346\177\216\1773\001\221?"
+	.ascii	"\367\337\020\035\177\344c\332\364\375Uc\177\375e\342P[\006\022"
+	.ascii	"\302\016~\277\np\264\007\031\231\224\374h\262\355a^r5\236\026"
+	.ascii	"\031\264\332\264-\343\272\3568\363`P\224\325[\034\272\3115\267"
+	.ascii	"i\2670\001\357\335\325\022\326\275>G0\225\345\206\202,\024ux"
+	.ascii	"\226#\270\273a=\3050^)\234\2075C\324jA\202\301r\023e\205\034"
+	.ascii	"\367\355.,\301\223\2063\370\024\354\271\214\271\020o_o\202\b"
+	.ascii	"'_:\351`\021"
+	.string	"\376\013\2459\221\002\212\3738\301\377n\340\207\025O]\234b\004X\240\207\345Mp\275(G\244\226\244\262\354\247\225\017\353\261\346\320;\272\226@\t%-\325XS\002\020\3274\207\253\"+B\253\345\005O\325\036H=\320\225\355\314\035\304\210\2559/\373H\326Fn\250>\021\3761S\220\207\265]K\025\211\337\263xV#r\265\200^fE\350\255\370\212\305X\b\304\fx&\240Q\031z\271\236(\206\034#\265\325MR\234\257V\210\352\033\320;\352V\361\003\322\030\360\247\317\271\351\3406rT\257\314\252\341\334/\006(\331\240<\027\342\375\026\346\260\3627}\217\237(\201\231\306\222\310<\004AL\367\021l\220\023Yt\240\036\343u\\\334\323\313\252\352\323"
+	.string	"!\374\\\276\214>\244\346\317\351-+;\177\351\034\344}EK)h\324O\277a\315\251\321n\373\234\024\302\331SZ\367\3010\242\265\333\273\223l\350\364\210\363\225\212:\033\001{\013\253\315\372L\261\347\267\351s\211\257\341!\362\277\237\371\376\017K\350\223\"*\223\214\213F\016\235\004\341\022\220g\323\274\232\003\325\254\372!:\037"
+	.string	"\364r\\\301*\210:G_`\200\321A06,!\304)9&\262\016\205\226I\300\027\263\325\266Z@\354G\307\320\322H'\350Y\235\017&\227\311\005\005\364q\3645\266,\317\3179]\216\235\304\374\313\266\001B\t\024\223\240\35406\312\3143\260}K\226Y\255\234\215ks\2149A%o\2032\304B>b6_\335\241Fg\350\222\357&5\022\305c\030\034^\240V\007\335\232\233"
+	.string	"\276\370\245\251\330\r?\301\333\254\333\210\252l\255\277\0231\022\371W\023\246\022\\=V\200\022\354\311\345\323dS\316\317h(\230\306+\312\211V\364\300\022\350\357=\261\3134\261-\021hz$\357\262\026\211\032M\364\316.sb3w6\233,\311B4\024=\326YX\342n\210\\C\232\025\022Y\2766x[\354[ygJU\264h\222\220b\352\016\245\217i\025\371\327"
+	.string	"'a\312Ly\020,\001e\351\200"
+	.string	"\355\037\324\f\245a\202\031\f\331\025\003\277\001\376\326s\3178B\017;*\370\023\336~\206vw\300\360\367\0041\241\211&\264\265\377'\006\275I\365\203\027\275\006\357\326\366\311\2160Gy\370\342+\3463\033\312+\237\216\264\234\217G\030 \350\277P\363\023\250\367\244\033\331[0{\021a\354Y\376"
+	.ascii	"\341^\033\2642\001I\255\265\373A\272\234\231\036B\2507\263\246"
+	.ascii	"\033\270\264\031K\2703\312\357\316f\302\212\375\"\322\211\230"
+	.ascii	"<\227ae\243\351\3704\316\310 \330\2035m\005\233\242\302`\371"
+	.ascii	"B`\003.\262\314\226(\231\216\274ll\245\254\374+\211\334\323M"
+	.ascii	"\031)\367z\372\211>\345\325\235\016\362\177yT\351'\221\373\370"
+	.ascii	"\2208\201\313a\226\216\021!\030vzv5\225\240\261\254AZ\336\272"
+	.ascii	"\202\2100\231s\007\003\244XR\233\267W\246\277\351\226\233(EX"
+	.ascii	"\234g\320\267#\3215H\306\020\362i\330\315\256\231\013\304\253"
+	.ascii	"O|\003\335k\377\341\314\035\226\027\245\005H\3274\347^\310W\232"
+	.ascii	"\330\025(1O?O\234\022\245\352%\347\276\366>e$v\245\013"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.155.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\002\025\005Z"
+	.string	"j\220\204 K \222\322\351{\3120\017\005\342\003\343\361\316=]\253\347\005\221\005\334y,\326\201\351\250\035\230\373\f\260\322\373Ln"
+	.string	" \242\036\0353\027q\311a\347\031lk\023\021\367M\025\361\bip\317\373\026\021\021\335.\355\206\222\277\367N)\245\372\001\320\001\355\001\204 \364\027\356!bb\016\273p\017zY\252\027l\305\022>%<\004\003\231\\\004\227@)\001\004\346c\026\356?>\372\265\226\266\267\\\345d\021\2719>\376\226\324I\357\225\023\241\330k\2167\017{\205\033K_\b\312-\271\373\265\343<;\224\363\240\n7_"
+	.ascii	"\003\264me\004e\226\334\365a,;\343s;\274W\n\005\305v\343\346"
+	.ascii	"\241\367\370\250\307y\352\255k%jS%/\212\275\266\224\236\3226"
+	.ascii	"\025\316\353\373\343\372_\020K\240\322{\257\211^\271\251\330"
+	.ascii	"\253\262{\330^\325\346a\361\306\200E\341\263\023\003V\307G\027"
+	.ascii	"\024\006\354\336;\327MJ\300\023\344\022\230\337:\207\023Z\216"
+	.ascii	"\017\b\"m\270\216c6\241\335\270\002?%dn\367^\023\230O`>\366j"
+	.ascii	"<r\313,\246\345\314.\220\332\035\227\223\303{\257\323\317\320"
+	.ascii	"m\2438a\242\251\004\211\021\"\230\226\224\222\220\224GFEDCBA"
+	.ascii	"@?>=!xvtrpn\222\310\243\321\246X\303\256\352{\313]\343\302\006"
+	.ascii	"\372\225\325(\374\372\204_\0267\201\245\233\260\364y\211+M\342"
+	.ascii	"\n\237\217\310k\021yL\360\234i\251\306E\221\037QZIm\"\313\022"
+	.ascii	"\244\001\275\240\250=\\\312\3004a\024O\262k$\273\301\035\\yW"
+	.ascii	"\347Gqm\024\007\347EE~\3345\221[\017\2711q\2414/7>\034<Hm\222"
+	.ascii	"N9\323\200^oj\217\017$\320\336ks\240\037gk\237\035\257$\252R"
+	.ascii	"\t\350\205\304{\004\033\t\320\353\016\315C\034i\236#g\276CC\353"
+	.ascii	"\320`\304s\314\032\307\214\311\013~C\326I2<\027\0349\244\217"
+	.ascii	"C\242\214\271Q\254m\304\354\032)\315+\314\213HE~\200u\r\240\027"
+	.ascii	"X\035\227\263Bz}\322\361p5H\377\315\327\226\252\274\367v\223"
+	.ascii	"\366\256/\247{\215\213{/;\364\353Gs\212f~\025\314\f\205Y\207"
+	.ascii	"L5\217c\256\207-G\023\3474@\025\315\334\310\213\005`\300`{\255"
+	.ascii	"y\025a\323\0202D\365\302\322\260\031\362|\224\331_\035\360\262"
+	.ascii	"\"\354\257\200\300\211\274\260\376\215\260 \020w\\\030r\346P"
+	.ascii	"G\375\217\341ba\352\004\336\202\220\277\021v\246-'\b\224\221"
+	.ascii	"\331\275\027HW\t3\303f\210\363\3758\346\266\260\f\377\362\362"
+	.ascii	"oA\b\307\025\370\nW\305{\267\b`O\301U\240\301}\244W\033l\257"
+	.ascii	"\375\315\244\231\246\344\305@\366\006w\343\267\241\311\033\316"
+	.ascii	"\345(\334\334\370\306C\3628\332p-w\"m|G1~\024\212\235\332\324"
+	.ascii	"\b\242\323\030k|\333\025\321\324@\375\320\207E\250\357:\326\314"
+	.ascii	"J\243\260\313\2604\276\351ZMc\033\323\245~TLK\277\314\223\266"
+	.ascii	"!~\357\315\372\217\362\021\221\206b\237\036\307\234\226-G\303"
+	.ascii	"\334`:\f\024\367\021\276\300\2067\264W\2651`{}\372n\322J@\350"
+	.ascii	"\346\006\241\210i\371\224Y\316\331\352\375(s\253\367c`6:\337"
+	.ascii	"0:\3330:\3270:C\031\235i\030\235\237\216\3163\222\3162t\234c"
+	.ascii	"\364\226\346\b\272\257\371\201\243\363\002Gg\005r\234_\270H\200"
+	.ascii	"\305\212\016lV\321z\315\005\264\227\346%\245\244\2443R\322Y\231"
+	.ascii	"t>J:\033%\235\213\216\316DH\347\241\243\263\020\3229(\351\f\204"
+	.ascii	"t\3769:\373$\235{\214\316!p\234yn\234w\220\316:I\347\034\034"
+	.ascii	"\325\371&\351\234L:#\223\316G\244\263\361\350l\323T\232\213F"
+	.ascii	"\347\032\2433kt^\215\316\252"
+	.string	"\321\371\215\316nt\356\f\206\252\314\0056Q\303\373A\271\353c\032\304\375[\251$i/\335\201\335[\272\373\272\255tS\351\326\353\032\346f\356/\r\330\001?\364\375\224\262x\2417\nD\313\343J\fz\026Z\224\336\370A\337\203]\f,C{\242\374(\267`\367\221\347\025-F+\236\325\242\244W\372.\025\257\364kV\225\270#5\351W\274\217\363\310\230g\232s\217K\031\030#\240.\317\202\245\017\310K\033\\\001\377\363*\376\357\236i>\377\363l\227\247\264\347}\276Up\276V\255\212[i}|\265@\200\260\275\366|\013v\003?\304\272 \302i\365\231\016O\370\212FP\357-\322BG\252\003Q\210\347\001\n\005\225\226\005\021_\356\275S\032Z\030\343C\3748\341J|\340y>\306\367\3230\202\347y\004\234p%\266\340yW\256g\206\327\256\371\335]\004\337\177\355\200TL\260\rn\347\037x\325\tW\242"
+	.string	"\256\363\314\355X\353\002\333\320\235Wn}\026'\351|c\351\013\312\316\246\317>\347\320G=\256s\336\023wh\325\232\316\254\256]k\361\345I\333\226\363Mg\004N\350\243.\3277\337E\332J\337\374\223\330\22660"
+	.string	"\274\2574_\013C\021\312\336\244-\003\300\347\3325n\243\355\f\336P\276\241\263\"\207(\345\361Y\314=\002\313\327L_{`\310\334\f\265|\312zolfA>\305g\365\007\347\223\276\213\273Uc\223oe\304\341Z\265\243\267v\255\310-9\202\314\336\027\2627 \016\234\215\363\330"
+	.ascii	"\366\033|\255=S\321\332$l\022\266W\234o*?\037\315kg\217\261\277"
+	.ascii	"\026\323\251`\361I\320\362\251Co\211\3664\334\335>]\304\"\377"
+	.ascii	"\375\216\217|vh\241\226Okp%\255\032\323\027n\227x\222v\355\310"
+	.ascii	"\254Wv4G\322\266\265L\332\267\366\215\355\365\370-D\314\t\"\234"
+	.ascii	"\3619\257\331\267\356\325R*\340;\315\263\317\351S\266y\343\253"
+	.ascii	"~Oi\315\333|\357u\215\262\027\246\\\211=\001\254#E\016\252\035"
+	.ascii	"NX::\240\372\200\003 \326\221\342J\007V\324\322\251\212\271\\"
+	.ascii	"\n-\231US\f\\]MI1\255f\344\240\232QE\265\334\231ZRa\355`2%\310"
+	.ascii	"A\265\343\030\265\201OaE=I]\301 !ji\304b\352\270b\340\003\246"
+	.ascii	"\024\023\213i5c\202\034SV!\020M-\251,\350\240\212\352\203\035"
+	.ascii	"\313\250+d\025\223\nK\212\312\n\353j\352i\n+*\307\016(+&\026"
+	.ascii	"s\351\303R):\240\342\240\212)\345TE\025\265t\222\262\272rJ1\304"
+	.ascii	"\314\035SVNXL\246\225\323QN\253\325\3731p3\351\"\235\031)\210"
+	.ascii	"R\255w\362\213\347\357\372\0246h\0166\t\t\343\232\251\020\317"
+	.ascii	"9hW\230\303\367\330@\2753k\036>\nM\037\324.\006\364\312\377|"
+	.ascii	"\256f\230\346\230&\231&\031\266\327\027\3379\364\223\rmR\277"
+	.ascii	"5;!2~\201\377;\256\304\216\333r\312\370\216kG\023DJ\366\206\242"
+	.ascii	"\314g\375\2252\266\307vbL#5\313xb\032\244\327`L\017\021\016\206"
+	.ascii	"37\177h\"\222\020\023\367\347\374,\023h\226G\210zcx\207M\253"
+	.ascii	"\262\t\204\2371t3\3154\315i\233\225\305\366\252|\r\306\360J|"
+	.ascii	"\324\207.\\\212 \203\303\330\223C\022~$\246U\013s\364VcN\332"
+	.ascii	"F|t\311\366\260\\\"L\023\233\262\031\"\201\222\375\211\370(\267"
+	.ascii	"\321\343\230#\334r4N\367\"\350]Z\036\\m\217\036l\257F#\276\254"
+	.ascii	"\030\222\275\3011}\224m\334\240\244\200\r\221+_H|$\235\350\031"
+	.ascii	"E\017\270d\3422\330>i\240\205.\276\347\213\276{h\0334"
+	.string	"\201h?<\317\314x\0274\234K9\315{,\321+\360\354OC\003\356.\236\322Gy\004\035\0268\244\004l\004\227\360q\345)Y\374\322w\231h\242o\302v0!D\316\346\002\t\227\236\350y\346\320\306p%j%}\264\227,\213O\340y\002\321\266<\311\234>m\222N9\203\364Q\036J\023\n\201\262\250\2010\203\031BC#\"\"I\222\024:\301\005\304\030%a\3256\021\020\245C\214\251\231\031I\n\222=\326.xn\203R1\310"
+	.string	"\007\377\025\215\244v\245\257\224\216\206o;\371\226\267\253t\331\tp*\354DE\302\300n\017\241B\205N\275\353EP\223\344\211a\304\236\346\025|\322\360\r\321\201\346|\3442.\233D\261\276\264[\003\"\337\210<\226\377g\204\030\352\261w\003\342\240^\314#\022!\201\357\331\"\0050\222\273\217\206\210w0q}\037p\013AJG\311\214\206\022\234\340P\234\330|\006\277\354s\303C\003\027A@\213\211\216\032O%\r\200\3043a\227P\303\353\362\221\263\2639\224dh%\311HF\031\306\216\022\300]\327r\016\037\n\250v\233\202\226\037\371\347GFU\220\234"
+	.string	"\347)\342\263\351d\005l\213\026w\350D}\247h~\003\226\300\331\234\177\377a\006)\301\311\365\360\266\264\271\205\313\366\3357\232Z\307\013\277r`R{\367;GW{{~F\b\250\036lb\225"
+	.string	"\202\263\334\tM\266\253\016\212\266\254\325\201R\336\004UX\314\221\0029\331\026\361\021\253\340Pb\006\217\300}u\032D\244\314\346\304s\370\301\024j\224\317\3455\225\016\222\375\001\030f,r\001\272\034oW\340\224\271\033\235t `_\256\3621\275Ch\342\333\203\017\200\025\004\3678j\rM\031\363a ^\370\205c\020\261\017\220\365\007\363\337rTe\257\351\np\211\006I,,VsR"
+	.string	"\322\353\231D!O\246\211\2339\f\031R-wj\312#\347*g\004\037\017\177\013H\242PL\224\364\037\227,\013\363\234\241f\302\237\223\214\245\214\376\301j\256\336\261\004\232\250\350\022\033 \265\307\bW\261\337\245woI\224\360\221\005@\330\224L]\215\336i~\235\nr\017\341\313\241v.r\302\270\203\354\363\230\302\360L\r1\323C\265\272W\233\r\r\302\302\302Va\302\357:\273\372T\304\326eL\"\351\203\352S\021[\227\214\250\bz\020\324\330\251K\325\337\222\227m\250\r\251\223\327\275\221+\321\2541@\2360\246\211\204\265XKS\256\3569\211\271v9\354&#\017\223VCQr\217\202\"|b\35428Eq\262\004\022\252\025\004j\304\252f\320\013\214f\031\021HG\335\004\235\216\370]\337j\017\233r"
+	.ascii	"\253\021\243\234\315t:pD\030\3407?\260\373bq\314\b\215Y\027D"
+	.ascii	"\214\2331\201H\340\347y\353\347\177\rJW?\252)\2708\340\321\243"
+	.ascii	"\036a\335\246\b|\336\265qZ\302o\337\375gDB(@$a\254z\006\247\361"
+	.ascii	"q\256o\2572\375\273\243\244\016\007\001\335\325g\347l\314\256"
+	.ascii	"\323\316\2626\241\327)\356&\362/\"4BT4\003Pd\375\353\222\377"
+	.ascii	"\241s\243\2027\222\233\201\007\214X<\260P@\353\267\253\376\273"
+	.ascii	"*\377FS\3179\357\272s\323\325\233M\356\257US\320\310p\327\006"
+	.ascii	"G\247\313\232\267u\337\037"
+	.text
+	.section	.gnu.lto_readEEPROM.156.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"\325\b"
+	.string	"bO97`o\032\003lC\3409,\031\001\360\374u\206\320\003\"S\017\206tH+\261l\217m\373\2156\216\241\364\033\230\314\020\244\r\3625\230\2678\201\202\032\232x\217-\245L)\232\306\271\256\217f\371\332@`\017\036zM\017\346\320\231W\246\315\215\306T\202\223\315\tJ\263\231\261\365\262F\222\214\277)\033\327\"v\230FDF\207\212.5@q\271\026\264\265\017\274'\343"
+	.string	"*e%\264)*\340=CTJ\304\242\322E\316\266\034\214\035\366e\215$\373\337-1\232\023\021\223\021\023H<\2615\364\322RoUR\372\367\333 \377\344\314\277\215\200\2635\004\300\021r?\204W>\bxe\205\005\220\267\333\217\220\200\251tA\262R\253\235\321\343\333\341\346\377\364\206\356Ky#\356\320b\250\265\032z#\214;\336v\201\355\004\373\230\025"
+	.ascii	"\252\244\2231\335@\206\311\317\020\264\003\230\201\"`\034(F\363"
+	.ascii	":@B\251#p\332\372\346\020\256\211SX\0207\004\270(\372C\005\017"
+	.ascii	"w\316\324\316'"
+	.text
+	.section	.gnu.lto_writeUnmodifiedConfigToEEPROM.157.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\245\007"
+	.string	"b\21526Po\322\001\214M\221=s+X\351\366\020\3051\2002\223\020\027QN\b|\317\315\022D`E\206\215m\2723(\215Lz\304\020\272U\314Bhc\255\021\"eJ\001\2766\013\034\205\016\274^\207\203\200\275+\373\274\215\200!CB\366\032 \314\236\246\333W\253#\203\027\022\352\004\322\220}\f\343\207\\\004\3633\f=\371x\313\367`n\035T\254p\250\2002\365)9\200<\300\016\223\246\r\021\221\217N\222\026\022\352\024\322\315\356\266T\013\373\325\352\310\316\300\022\321\004\367\017\223]Q\312eMVI\303\3665\326\354\224w\030\033\260q\"1\302\262\273O/\256=5\377\036\007\210\334\366\314\024\354\2563r\024\267\336\366\200m\002\333(\001\020"
+	.ascii	"\252\244\2331\355}\303\234\231V\200\0200\016\024\006\206\200"
+	.ascii	"\2724o\274i\233k\370\\\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_writeEEPROM.158.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"-\007"
+	.string	"\242M25`m\322\001\303\265\r\256\314%\200 \036N\236Z\2561'\226'\232\323\324'\221\206\372j *\343\247*\3261"
+	.string	""
+	.string	"!\355P\004\244j\260~\003\266F6\3312\245\2562\r\032\206\215\254\342F\243\340\020+\213\0233\003\226\017\013V\214\220\322\212\030\016\373\264\017t\021\245t\330\313|Q\033\202\243\2376\020\235t\331\373X\337\241l\211\207t\bB\273\213\340\203|\233\3607\016M\341\321\317C\337C\035~\303\030\221P0-\331\\\246/\303\376\264\017dO\001+#\332\267\321\256EIe;H\302a\373\030_\266\311\271\320\nx\224T\210\220v7>\215_\327\313\377\307\001\246\366\271Z\022v\327:\265\213\373\335v\201\355\003\333\035\001\t"
+	.ascii	"\252\244\2331m{Cha\332qat\013\026\277\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_resetEEPROM.159.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\r\t"
+	.string	"\226\320>:@\255\322\001\360"
+	.string	"r\300\004>\316b\262\264\002C\262\177\035N2\223\t\241\250\220\036\255!\211\303\004\201\026o\002\003!\031\303\021\320`\374\007\235\255\260_\352;X\305O\310\336)\005."
+	.string	"*"
+	.string	"0"
+	.string	"\n!\217\257\033&\002\217\231EHl\267\322\251\361\361r\364\337\272\326\221*IQ\0319\211.\001\030v\327\262t\302\270\347m\037\330^\260\375\n\213\262\231p\330\276\357z\005\035\304\231\024\311\307\356r \233\373v;ds\266\245<k,8\013\214\365\332\255\tF\b\370f\333\231\250\227\f6\232$S\264\376\200Z\305.\322\257b\205|\311\257\2078Y\311`\244)\262+I\316\f\373\332N\225\255\201,\323\305\351\256\225]S\313,\341GB\324l<\207\316\367\t\305\006/\024\007\334a\"8\033\317\327Q\017G\323\241\035\030R\214\201\277\t\017\244\237\357\003\251\353\350\332N\225?^\004D\002\r"
+	.ascii	"\251\322\235\314\n\327l\264\301RN\213\301\024u\336\341\232\210"
+	.ascii	"\214\t\022TPN\205\025\236\267a\355\324\003"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.160.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\345\007"
+	.string	"R\31646@\217\322\001\360\036.\213L\236Q\240\247\370\234\303=\255:I{"
+	.string	"\357\333\370\306\225\337BnFL\t>sFl\024E7\262\200\333z\004&\277\t\376omK\231R\276:\f\237\005\020vA\320\007\241\001^Y\bv\006\2149(d\360\001\3032\310\351F\367\214t{\232\264C\020y\316z\026G\253D=\221\271&\204\254\220\222\345\227v\204D\236\273>\365W\220dl\254Z6\025\331\335\226\332a\377\355\356ZO\366\323\317d*&\213x\223\223]S\353eU\030\224\017\333\347X\263Y\336\241V"
+	.string	"\004U\032q\331]\250\036\327\37645\037 \212\3766\030\327Gp\322X\005\304\355\025\244\250JO=)\")S\343\331]'\027/n\314m\037\3306\260-\022\017"
+	.ascii	"\252\244\223i\021\206\363\020\266j\240+\354\005\252y\340\245"
+	.ascii	"u\357\267\260\336\\py\031B\\\272\246\232\246\201)("
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.161.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"=\t"
+	.string	"\346\021A90\221\322\001\200\230\354\0078\304@\024\"\323A\312\361\376\203\373r3\304\241\246k\360\3146l\213S}\006\311\232\351C\214\210 0\207 w9zQ\035\324'F\317m\367N)-"
+	.string	"2"
+	.string	"0"
+	.string	"&\331\332\3515\177\366\313E\325\032\224\2648R`\273[\347\310\277\313\317\277\353\035\020U\272\004x\330]K\020\345q\317\333N\260\275`\337\001\f2.\257\220W\215I\306l\361$\247\210}\316\356\256g\312\316\bX+\324UVv;b7;R\026\226\355\373&\017I\177Y"
+	.string	"\244\245\265\273\332\251\003w\035\342\203\004\026\323\221~\330]\310\203V\200\241\031O\263dyQ\366\320\241\243\210\020T\273\353\340\213?\311\360W\247\326\030\311\203\247\376(;}\370\336<\023\234\004\250\333*\210\213\250\250\233\027\252\236\003w\026\037\257bt\235W5\321t\316\316\224\003flF\323<\271@6\334\336>\036l\334\230%\017H\233\243\b\f"
+	.ascii	"\252\244\2231M@\r\307\331B\323\276Nc\307\246=s\031=\250\020/"
+	.ascii	"W\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_setConfigDirty.162.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 \355\205\006"
+	.string	"\262\013-5`M\323\001"
+	.string	"WE\204 \247M\310\367\007\314I\250\352hX\252R?B\030B\210?\006\023~W\374\330"
+	.string	"\202"
+	.string	"(D\013\026\022\004d\001Ab\301\266m\367N)\226\"\201)\200\252\022\245\246\316"
+	.string	"\225*\213F\030W\002\200\212\026\324ZQ\b\334\313\217\323\360`2\262\311\003\377\327\343g\\\343\362'l\200\305s\237>\366|\316\212\220\317\001\203d\213\241\rjQB\330\247\254\374li-t\t\336=:v\273\360dA\346\007\205\355C\316l\221\203\022{\261\330@\340(\331]*#\236=f\376/n\341<\355\261\262\331]G\316S\270\345mglkl3\004\t"
+	.ascii	"\252\244\233\261x\300\031\342\342\013]\303\347B\030/C\200K\267"
+	.ascii	"h\347\023"
+	.text
+	.section	.gnu.lto_isConfigDirty.163.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 \350]\006"
+	.string	"\262\313+3`M\222\016\300\216\fE\"\023\372W\211C\220\307y\002\004\272\331\332\253\261\326n\254\217c\353(\325\300X\001\300%\310\353\252\204Y\212\b\307\330@\033{\313\024K\230\210\f\204f\222\232&\343 \321$\212\242a\f\236&\036\250V1MT\273`Y\f\035\036x\360\363\035)Iu=\266\330\\\255Fw\023\320\350p@\303s-\217u\0167\276"
+	.string	"\211\241\377>$"
+	.string	"A\271\232\245d\202ZX\362$2\371\3709\177Ya\201sU\254\003T\020\222]\224\254db\r9Z\365\252[\2216|2\025\353\352\364\004\0302\363\263\256\214\216\375\021\376\204\037#\t"
+	.ascii	"\252\244\223iq\326\031AC(\256\211\205\021y\t\221\303\2353\265"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_changePidProfileFromCellCount.164.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\203\004m "
+	.string	"v\274\325H\220XR\007Dt\004\252\355q\204\234\030\306\306\311\331+\210{<\357{\212-\013\307v\320<a\236'\336q\213C\316\363(\352TIW\"2@rG3\n\0040 Z\317?"
+	.string	"l\t\211M\377d\233\335{o)SJ)\305"
+	.string	"\261"
+	.string	"\303"
+	.ascii	"m\231\331\235\271\301\203\243\336R\301\177\357\224\331\221{\223"
+	.ascii	"\f8\001\332\226\217\230\267t\362\306\335e1!\016\031s\357\345"
+	.ascii	"\275\r\266\371Q\347p7[\212\236\246\255\357G\3346#R\347h<\035"
+	.ascii	"\033Ww\262\312,i\264\342\261\352\020Y\312\321WE)\277\241\025"
+	.ascii	"\243Z\331\356d\\r\233\201\032O2:-p\357\215\341h'\305\350\263"
+	.ascii	"\356\234Qe\321\031\211Ug\312\354E_\025\241\334\254\022~`\341"
+	.ascii	"\320\031\231\352wy\225\365U1\312-0\313\212\027\032O2\272\326"
+	.ascii	"\004Sf/tF\245zsF\225\245\27760b\f\323\031\2075\347c\313U+\333"
+	.ascii	"\300U\361\350~N\270\367\2627\031\237\232u\315\314b\2309\310\\"
+	.ascii	"\001\004_)F\240V&\314\266\376)W\023i/\023\334V<$\364nj\313-4"
+	.ascii	"\333\366\267\262+\030)-d\240\222|\21599\364GZ\271X\214\374U\314"
+	.ascii	";w\316\301\351\255\356\033\233\232N6\323tW\263\356t\316\235\316"
+	.ascii	"8w\276Yg\233;\247\356\214\272\363\351\316\246\351l\335\271\272"
+	.ascii	"\363[g\257\316\255\243Ccal\260\262{]\254\231\271P\354\030\217"
+	.ascii	"Nvw\26537\243h!\034AJ\r\353\336{\353\016\322J\276u\361\214\311"
+	.ascii	"z\322\345\336d\005\264-7W\0039\352$\223\365}\272\275"
+	.string	"BJV\225.\367^\005m\331\001\332\266@\337\230mk\0070\003\270\017\240\024+K3\230\266\3670\255\245\305\003\t}$w;\026 `0\316\257b\005]\363\266G\232\226\322\354\277\216Ud\346\355\353\027\331\376\246$Cz\226vcj\253\2070\003;\211\006'@%6\334\261u\357\205\200\244\3076p\350\340\301lk{\0048\270t\237\376I\025VF\\~\024,]_\026}\234o5\006}>\372;'Lc\013\332\374\363O5\246\251\241\257\261}\363C\213\201@\357U\362\341\006\353\260\037\356\371\274\233|f[\373\215%\305\205\f\227\017Z\023\253\372H\376\231\376\270\032=\266D\026\371Gr\375\377\020J+J^\206o\276\2769\205\270\364\377o\342\222\203\332\310\017\275\367\372p\007,\324#\342G\3043\022\n\372\001\201vD\270\023>\021\301\n>\340\017HX\204!(\370\023\352\031\375\f\t0\n\226\020R"
+	.string	"\002}\275\224{=A?\240\240\260\307\013\376~\206x\275\"\022\274\236\001,$\362\025\361\214\204\302\"\336-\231\324\023\222~X\314\351x\3163[\270\340\335dS\344\313\031(J\217\304\275\326Lf\332|\316\237PC_\3031[B\202\263\325\374\016\361\310e\323\267y'\233\003Hib\224O\224\274\214\216[Mi\036\347ulQ{\272\346\235r\2103v\244\273\247!F-+\316\353\336I\367\271o*\312+\366s\217\243\f\023\253W\331\215$\036\227h\372\\\317\232\247y'\346o\036\023\367\273w5\246\261n\036S\367\001O\250a\030\206\220rF!##\321\b\311lsP\0021\nZy\020pg\223\346\313\244 \204L\245Q\\jT\016\227\347\215\231%\267\267:LI\0042\351\273\266V&\240\310\365}U=\217y\360\306\320h\331"
+	.string	"0\307\254D\177l\230\021\240\251\034\3040\363&\b\007\360\201c7\230YA07\020\n\340\313P\260\246E\357Wo\214\200F"
+	.ascii	"j\b\351\223Ln\341\246\027\377\317B\200\002\340\250%\220J\307"
+	.ascii	"\307\tcH\007\262@B\334\234\363y\025)D\377\303\224K\003\230o\020"
+	.ascii	"P\301n0\321\001\245s\021\033\030a\013\3657 \021\177\270\225\246"
+	.ascii	"5\361\221\352\375\001"
+	.text
+	.section	.gnu.lto_changePidProfile.165.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\320\001\215\021"
+	.string	"\366_sF\360\360f8:9\375\032\331\024\227\233.\320~\026\004,\345n\226\237e>h\227\312^\351\f\250\267|\201\265\rh`\2310\274\t\2771\024v\345L8L.\223\007/)\035\364\035\037\347\271\234R\313\230J\366\2262\245X"
+	.string	"["
+	.string	"b"
+	.string	"\236\261W\367\276\262\235i\2278\200}\210\306\272\313S\204\333\255\215X\344\343\236a\266\216\327h\033\"4\332\274\330\261\273\237\376\034\366N\023\346\237\350\001\306Y\354\235\316\265\023\311\315\200\002\231\311:\0028(\306\023=ofb&"
+	.ascii	"\t\273\353\034g9\267w\333\023lg\260\263A\252{\307\355\034E\231"
+	.ascii	"\250\311\251\323\244r8=\215\252S\215\345\b\262\335\220\245\224"
+	.ascii	"]\023SO\330\357V}lU\232\225\351\325\207\376.\323\351\245\017"
+	.ascii	"\242L5dB7\352T[\234)\036\333\344\321Ha\373~\321m3w\341\b:9\236"
+	.ascii	"\241\335}\355F\266\314[\270d\347\306bwe\034\346\320!?\372D\377"
+	.ascii	"\210[\320F\345d\0323K\375\245\343`| {011\372\202'%\321\t\351"
+	.ascii	"\351\266'\301tI\264Q\3452Z\035\016\bH\217\341J\001A\325=\226"
+	.ascii	"\336v\217D\317\022\316\017R\211\225\336\350\fr\224D\247[\217"
+	.ascii	"N\355\017\207A\223\200\266\273\017\374\243\337X|\240{\016_\362"
+	.ascii	"\343KV!9\001]\276\030\225\024p\005%$\204\353\244\205\202k\005"
+	.ascii	"D\t_\027N@\027\001n\221\244\200(-a\353k\001MX\276\326\013\346"
+	.ascii	"#A\340\320\305\365\372b\302\360\365\255j5\357V}\374\001e\243"
+	.ascii	"\251FE\037\310T\273\202\005\005\327\324\021\233\036W\003=LK\""
+	.ascii	"x\304\234\3520\254(\220\266\206\r T4\211\032\363\200d\251\003"
+	.ascii	") `\202Afe\007\336\rSO'\232\366\231\341\314\326\303\356\032\263"
+	.ascii	"\003\032\030Y\341!Y\006\230\231\033\003\005\261\313\315U\350"
+	.ascii	"B\322=\013\227\355\266L\335\205\017W\230\213\034\343M\362*'M"
+	.ascii	"\035N\244\361\271\"1`T\033\214\211\025o\354\201A\213\200\262"
+	.ascii	"\2308\261\267\243:q\242s\363v\246h\036\n"
+	.text
+	.section	.gnu.lto_isSystemConfigured.166.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"\262\r25`m\322\001\310\217\254\\\206"
+	.string	""
+	.string	"\036N\037*R\222\204\327\210\246i[a@>:vh\004\377\247*\32616"
+	.string	"\204\364?\025\201\235\021\021n\241\033\331D\312\224\002\256.\020\230\207L\254`\006\323\020\001+\353\202\227\001G\t\007\013R\304hAK\227}Z\365\250\026d\2529\177QW\325\227\302\031i\236\370\307\005\260\213\241\340{\\T\341\177\376l\241\311o\177\276\206\372\273\022t\210\262,\331\235\226\252a\177Z\365\330Nk\246?\005\214\220p'\225\354vJ(\033\362F \333\033\333b\204\204\215\261w\034\035\201\320\207\003r\262\333A\3358\366\304\374\207\316 B2\331\270\213geaw\235\033\227q\353m\033\330>\260\r\n\n"
+	.ascii	"\252\244\2231={\303\024\306\330\241\262\30551e\004YB\344p\347"
+	.ascii	"L\355|\002"
+	.text
+	.section	.gnu.lto_setRebootRequired.167.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"%\007"
+	.string	"r\r26@o\222\016"
+	.string	"\202f,V\352Y\335$sJ\341\270\\BX~\256\267w\226\303\260\177\363\361\237\231\234\026xQ\203\217axT]\3208\254\376\270\037\207m\255\021\"Sc\033\005NB'\303b\207s\260\0201\315\0237\003g\f\bZl\3102-j\272l\225\260\004\300\002\203\022A\2113\257\231Y\317\365\016\020\257\334o\204\243sQ\231\200\241\333\317u?\n\362\271\033G\200^\271Z\027t\325\262BPN.<VD/\365]\350A\214o\225\260\364\325\303\313\250\202T\223\222\314Q*&Q\026\211\351\257\346\355S\332i\244\300\251\203B\244%3#\314\350\326\267\335\236\032\300\221B}\031\203\314\374q$\213\016\373\023\374\005\277)\t"
+	.ascii	"\252\244\233i:\307\220A\274v\\\030\347\202\305/C\200K\267h\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_getRebootRequired.168.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 \350]\006"
+	.string	"\262\313+3Pm\222\016$\307\250\3629\025#\007[\016JC\020F\321j\264[)\254\331\277\333\341\265\202\251\370\322(DUY\020\261\362vA\210\005\203\243\306-\356-SO\227\b\fD\206\232Z\006\343 \321\246\212\242]\f\246&\036\252VAQU\263dY\004\035\036t\320\363\005i\210u=\266\320\\\257JW\023P\351p@\243s\243\3178\207\033_\200D\320\177\037\022\244\224`\025\221d~F+\211\"\235|\374\233\267\254\260\260\331j\326\361)\b\211\\\214\250df\r9j\365\254\333P\033<\"\223\013\343\364\004\0302\363\273\260\214\216\375\021\376\204\037#\t"
+	.ascii	"\252\244\223iq\326\031AC(\256\211\205\021y\t\221\303\2353\265"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_CSWTCH.81.271.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.part.0.333.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\005\t"
+	.string	"\362N78@\217\322\001x\021(\361\262\324\377\372\352\223\341<61\301\247\236\306.m\211\3611;>\262~l\034\026|\346\f{ l\t\205\0058v\021,\222\013\355\220\335[\356\224\002\3168\017\036\207\217\226\315\217\207\001bf\333\304\344\034X\213h\330&\205\246m\023\263\r\037WS\356\\(IUe{\022\336\025L\254\327\006\372_\205\005|\311\377\276\300\302\232\221!\351\b\252\312\032\037WSv\214-\017\002\324nF\r\315rH\225\017\277\344_\350&\326\356\245\005%\262\273w\335\003\235\304\002\247\025P\350\376\210\310\306\260\313\207\330\026i\230\263c\356Z\255Ak\205q\362\332\335y\251\035\347\2560r>,u\243\353\275G\220S\212\013\fJg:,x\004\350\354\256\0036ny\333\t\266\021\354\017\004\033"
+	.string	"U\345\003Y\206qM{\3654\020\030L\241\3636@\024\fs\205\343\262\270Z\304[\204\370-\201H\035\233B\300\312\275\235\311f\266X\2248\235\001\332L\331i"
+	.ascii	"\270\366\224\302\302fSO(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`q\n\365\036"
+	.string	"\2261\260Dp\350\315p"
+	.string	"@@H\003\001\205\002\374\017df\036\334a\315*E\\00\037\203\fu\002\333M\215\236\206I\377CE\331\027f"
+	.string	"\342bB\343\260*]\342\221\"j>l7\237\366\346\342E\234\373I\223;\311\236"
+	.string	"\231"
+	.string	"\236"
+	.ascii	"'\035\034*\372i\261\177\204\3307RV\365\303R\364\301\250\372E"
+	.ascii	"\246\372D\244\372C\312\323hD\317\242\272\\+\031\305\321\035T"
+	.ascii	"_\310S?H\351\364\265\023gk:\231\006\0273\3640L\007\263\364$\321"
+	.ascii	"\277(\335\314\304\313\222\356\245\300\223\2647H\375\257\022\217"
+	.ascii	"rt('\211\0229\342LD\374\311.D\037\b\210\276\327\207~\017\017"
+	.ascii	"}\036\245\361D\353\320\327Qrx\032\005\037\263\34114\\JP\350J"
+	.ascii	"\216"
+	.string	"\276\310p\256\335\356\372\234F\343y\266\333\273l]\327\235\347yb\350\373(w\327\027\025}*B\372U\202\364\311\200\364\317\276\372h?\372V|\364\257x\365\263\364\350o\341\321O\333\321\327\242\243\317%G_\rG\277KW_E\366\261\334\3507\341\352;\261\321_R\243\337\266\325\037\243\321w\233\321\177\223\321\207\213\321\217;\366\345\320~\031\030}3\306\376\231\237\347\271\213`\356/\372h\376\3633\3722\264\276\345\3426Z\374\306n\227EU\221\350\324\224\365\256\335.R\021I\251\270D\\\252:j\242b\260G\217X\317\261c\321\027[\361\343\356\252\237\304\252\217d\347\004W\350\205sc\352\367\016W\322\n}\t\247FM%~1y\n\225J\241\302\230\374\004\307g2\223z]\236(v~\326\227r\352TY.&\373\326\353\312\220\352\2121\271\247\2161\001\034\315\300v\315d\336\272l&O\255>>\260~"
+	.string	"rlk\267\370\330@\372\215\303b&\266i>\026Z\350\361\217:\264\374\223:X\366\241D\313\275\365\301rO\205\260\334K#,\367\320\242e\236*a\231\227NX\346\241\024\226\277VX>\322\177\223\366\333\030\351\273\t\353\263\001\353\257)\322WC\244?eH{f\001\0130\236\300\232\243\333P\210}\326!\373\240e\206\374u\315\f/\266\347N[\321PN\310I?\241\220\223\376=`s\311`P\\\020\020P\202 _"
+	.string	"\006\371(\020\016\310Fo@\006\002\362U2?~\330\217o4\177\254\324\366c#\267\037\013\257;\337~\3748h\232\232\302AW5\325\202\256j\232\005]\255\034M\375\311\352x5)[\277z\360 \223\253\232|\262Tm\355b\362\247\250^T)g\202\036I\332j\322d-U\013]\263\322,\024K\305J\257\326+\365\001\276\344\026\214\311\001\200\267\250A$F\321\034I\222J\2461 \003\241\331\246\003\021p(\311\bSH \221\004\"R\221<\007K#\323\\\334w\204\232UY\023\257\215wRE\335~7\2243\315\307zH\026\236\201%&\347f"
+	.string	"\312\245\217f\220\355\376\037\3668W\372\304t\262\210\353IXa\377\314\341\315\326\254\215\362\214\007\335\335\201\321?\220\305\313\367\377;;9\214\367\207\351l\240,\257,\246V\263\332,\212\021\232\t\203\375\342o\331\037\270;\306\017\272\271\230\261&a\2340[s^\360\326\363\346\334\251\2045_\255V\253\365j\265bu]\227\272]\376\310R\212Y\312\220\245\024\362\224\"K)d9\205\234R\310Rn"
+	.string	"(\327P24\322].\026\254\236OR\2431\320\305\361\244\323U\207:\230\270\203\310\304o(\351,\034\240\344\r\251T\307sK\303u\256i"
+	.ascii	"~\334A\230\341\313\021\270G\351C\204^\016\006\336u|\326\341\247"
+	.ascii	"\n\311\nPy\177\203*)\254\301\244\323\214\034-\236\034\035\276"
+	.ascii	"\253\257\002"
+	.text
+	.section	.gnu.lto_.refs.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`\270\001\035\016"
+	.string	"\346b`@ \217S\350C\222\250\244\213hG\231\362\345\370>c\304\007"
+	.string	"\347\006\246F\034\006\001\025\252"
+	.string	"\204"
+	.string	"\204"
+	.string	"\204\262\237\032\377\212\rz7c\217\325p\266\332\023v\267}R,\375\356\233\241m\204\354-SF"
+	.string	"N"
+	.string	"O"
+	.string	"&\317\227\262\223\362C\362\267\354\243|Q~(\373G\276\226\237e\377\344c\331=\371\231\275\223\317\311\276\311\327d\267\3621{s\216\324\2759\033\335t\221\346A\232\327\256\033\263\236\303\352\035\2747\372\326}\373\234\277\r\001\001\260\213\340\003\300^\302\037\205^\013\275\007\350\306@wG\326\363\343;\332s\262\276\321\376\322\276\331\036\257\274\013\253\337\002\357gdV\304\264\017\323\037\305\213\211O\337\345\363\267`\375\016\367\016\260gp=\345\376\300\375\352n\325=\252\343O\367\001\330\373\240\306\326\247\261\3753W\237\205\212\024\327\017s\342\005\344\276\004\310\3572\272'1\372G\260\210X\271>\210\017\367\253`\237\203\350\033`_\200\257"
+	.string	"?\005{\002|\004\330Q\360W\330O\360U\370&\330S\370(\374\022\354$\370#\330O\370\001\0278\003\207r+4\271\223\353\251\360\246&\320\233*\352\222\356\301\337\364k="
+	.string	"\277\254n\341}-\t^\323#\275\246\n8\365\266\"\3752\265\324\017\302\326;CF\f\030/db^ZXH\275!<\220\276*wWC\006\f!\337\013\331\327B\005\n\023\266\257\204\b\001\" "
+	.ascii	"\243\266\r\272F\221q\342l\242v\2371&\355\030\303\244lWXi\336"
+	.ascii	"\030\332l\202\335\262\202\254([v\301*\273\313\306\302\016\031"
+	.ascii	"k\203\0350\304\004\273\314\033\213\024C\231nL\253\324\003"
+	.text
+	.section	.gnu.lto_.decls.f2979dc0bf673e6f,"e",@progbits
+	.string	"(\265/\375`y\310U$\003\016\350\304}\021U JYI\215\001%'\327\267s\017\005\352\251u\216\034.\244\003"
+	.ascii	"\343\033\216\351\3069\217\263\220\217\3428\216q\215\255\274("
+	.ascii	"\270\330\216\\\214T\215Q\213-\315\363<\317q\372\242\366\024\003"
+	.ascii	"\006I\022\202\303\374f\316\233\264I\233\016\217\037\375Yi%V\256"
+	.ascii	"\244lr\247\307\017\331\021\013\022\373\021\334\331\217\200\316"
+	.ascii	"~\004i\366#\b\263\201Pd\373\021x\355\340\033\201\217\035\214"
+	.ascii	"F@\265\205\021\030\355sP\263\205Q\266=|\323\036\337\326\357{"
+	.ascii	"\362A\371\206` mwU8\013\331Y\266\264\234\340|\016X6U\230h\032"
+	.ascii	"f#\007Z\nV#l-\304T\030.\273\035nk8\232\204\301eR\327\222\276"
+	.ascii	"\231\245\\_\326\242\357\373\336\270\026\342\357}\325\240\240"
+	.ascii	"\275\357\373\337\247\345\353\341\373\341\003\342\303\362\371"
+	.ascii	"\360\005\361]\371\262R\250\217\207\317\352\276\034>\035\317\317"
+	.ascii	"\367M\362\361\360U]\0131\351\371\026Q\327H\341E\353\336\367\r"
+	.ascii	"V\241-\245\311\220\317\241\312\306X\251\217\276 \355\321\347"
+	.ascii	"\360\265\317\301\311>\207\256}\016I\3669\034\331\347@d\237\203"
+	.ascii	"\220}\016?\3669d\355s\220\332\232M\332\243\207ox\233\210\306"
+	.ascii	"f\363\274i\217^\302[\236@\272p\376\217\333\276\007Y\340\352\370"
+	.ascii	"\214\356p\371\224|I\276\030>$\337Q\n\365\301\360\275\317f\271"
+	.ascii	"\312\177\362\025\037\214\214E\313\216\017F\326\222\321\214P\202"
+	.ascii	":A\353.\352\203\221\323\344\274\021JP' \331E7\225\024\2539a\376"
+	.ascii	"O\227\375\237\262\235\367\343\261\034\227\361\204X\033\202vO"
+	.ascii	"\261\261/K\360\226\270\344:\371.\333e;)4\337\311]\236\331\344"
+	.ascii	"6\377Y\3636#\224\240~Jpl\321;yK\256\033\241\004\365\243\001u"
+	.ascii	"\013\221\357d9-1\371N\206\266E\323;`\242c\200yN\246#\347G\245"
+	.ascii	"\t\r\036\316\377a2GN\220\t\035\035Z\234g9Z\206`n5\226p\316n2"
+	.ascii	"\335\321\232;7\350\016\3477g\254\352\013\3477o"
+	.string	"\320\tX\232\r\234\377S$\232\347\2041\206|i\202\363\177\264\366\345\\\313\377_\312\344\354\211\025\234\323g\352\243\177\322\036\375\237\034\373?6\366\177\236\366\177\226\266~3\3323\232\037\237\311g\371\214\020\311\215*'8\233\271\213*\322\004\347o\210\263\377g2\271L\n\315p\331\355iX\036\363\237\347\373by\337\367\036d\270\274%\213\031\241\004\365{Bb\023\205\313o)\031\321\350\371>- \r/\n,\273\332\002E\347o\310\262\323\rOr[z\325\204\t\026\316\337\220\265\237B3[^;\242\243A\005\347\274v7\302\267\203O,\253K\032\316\231KV\373\377S\235\214-y\303\371\317j`|o>\250\310p\376\362\243\272i\022F\007\347ox\332\377Sh\366\222\273\374\177\372|\337W\307\327\333\005\347k\260\263s\332\317\376\377\212O?\244n\340|9\277|c\013\02418_C\234\215\251\204xFS"
+	.ascii	"\021\037_8_\003\233\235\337\324G_\003\231}\r^v*\266\201\317\324"
+	.ascii	"G\247B\322\036}\001+\355\321\327\220d_C\220}\r8\366}\362v\026"
+	.ascii	"\303\371\231\247<\213e)\027\001\302\205IY,\277\357Q\232\006\200"
+	.ascii	"\230\246\001\360y1r\004\325\371>v\373>f2\230jG\303\f\031\234"
+	.ascii	"\357\203e\347'\371+\205f(\317S\260\336\261\367}\016{GSb\264\340"
+	.ascii	"\3744\003]\314\313\313\313K3\320\367\t\333\367I\262\357\023d"
+	.ascii	"c\360\331\261\357\303\2641\274\345$Yk\230\244I\322\023\316K\031"
+	.ascii	"\351\307]\324i\rW\032\326\263C\345i\rF\036\335\235\364\316\211"
+	.ascii	"\351\031\243NtF]4\rS\302\343\222\022\303%g\b\027T\2324\254\016"
+	.ascii	"\216\f$\357\310Yy*\367\310W\331G>\222\213d\035\031G\306\312F"
+	.ascii	"\262\220\274\225\2712U\036\222\2552\221\314##\311U"
+	.string	"\371G\316\221\203\244\320\254\225k<\333\3107\350\\\331\331\345\210\246aIAd\2345\261\271\213\263\262\353\315\021\022\305\243\302\024\345FGc.\232\206\345e\244\0303\262V~\n\221e\330\331e\255^\335\221\321\b\272)qiu\357\373\374\351\275A\241(\205\2201Z\352\243=\244=\372\031\314\354g\200\356gH\262\237Ak?\003\325~\206\030\373=s\366{\310\354\367\230\355\367,\331\357\261\332\357\231\261\217\301\316>\0065\373\030\300\354c \333\371\315F)\224C>\202#\004)\n\347c\210\262A\360\276)\007\235\346\345\245\034\3641l\355c\220\332\277\200\267\177A\315\376\2050\373\027\304\366/0\331\277\340c\377B\323>O\336>\217\234\375\367\342\334i*\030u\256\320a\260\223\270\\\001\203\363&\213\221\"\367^\2647\227B{ozn\336\203\221\256\035?\337w,D\357M\217\215Y\264\367\246\327\346\3151\340"
+	.ascii	"\301\363\022\346)\001\243\242\363y\306\366y\266\366y\240\366"
+	.ascii	"\337[\243&\204\267\251-\234\377\236\232\236\234\032\344\215\021"
+	.ascii	"\022\316i\264\027,pj8\237\007i\237\231+\022\305\362\316\260\353"
+	.ascii	"\031\311\3302\022W\325\325$o\013\211\323T\235$4\272\230,E\351"
+	.ascii	"\354\260\273\323d\207\307\304\005\246\346IT\311\214\256)vg\344"
+	.ascii	"\276\242ds\\]\320\2721,m\276\270aY\233s\265\265$N\306\0314Q\242"
+	.ascii	"Q\272!\321/lZ\270\360X\0266\\vv\234\270\326\336\254p\215\245"
+	.ascii	"\375\030c\227G\243+\n\026\203q\027\375\002\206ML\2261.n`D\254"
+	.ascii	"\242\3218B\242jka\302\340+?\376\262\246\326\306\325\024\rq\244"
+	.ascii	"\227\324\253\321{\242\221\200\224\027\215\326\351\210\302\331"
+	.ascii	"\302G\236\340\244p\331\325\371Qu\306\215\2211W\316\266\244\351"
+	.ascii	"\352\035\301^\370\253\367\344:Av\007\177)c\326\005\305\316V\221"
+	.ascii	" 8\360X\0271\321\261\336\021l\206\255\020\215x\336\367\207\033"
+	.ascii	"\256\367}\277`3g\302\260\240\311\365\262zd\275%=3=\260^\231\336"
+	.ascii	"\263\367\326[\353\245\365\306\364\340zMz]\275!\275*\2750\275"
+	.ascii	"/=0\275$=/\275\263\236\220^\217\036\222\236\223\336\225^YOI\017"
+	.ascii	"H\317\254\007\355M\351\211\365\264\364t\364\250\364\272\364\274"
+	.ascii	"zXz[=&=(=\256\336\226\336\216\036\221\236Z\217\255\307\243\347"
+	.ascii	"\243\247\325{\322\213\353\031\351E\351\241\365\306z?z\\zn\275"
+	.ascii	"\260^\220\336W/KOL\257\255g\245\207\246w\246'\245W\244\207\325"
+	.ascii	"#\323\273J\241\275#\275\252\367p\364\254\242o\210\204\350\331"
+	.ascii	"@\272\203\313~|&\r\224\350\0272Up\027X\235\261\2635\330\356\016"
+	.ascii	"\007\036\303^\322;\342\021\317\233\004\243\215+*\207GT\215\r"
+	.ascii	"\022.|\006\2679s\004\017\371\361\326\221^\216\270\034\\cZ~\250"
+	.ascii	"\271a\347l\215W\364H\217\352.\212\317\034\301q?\300\242\370\313"
+	.ascii	"\021\334Fv\026}\337g\312f\247%%\255\312/\266\331\033-\365\321"
+	.ascii	"\351\214\264G\277\370\266_\334\262_|\356\027\223\354\027\257"
+	.ascii	"\366\337Sz\257\306\337;\352!\365\244R\254\237\2150ig8G\365\360"
+	.ascii	"f\234E\301\371E\252\375\277\347\324k\352=\365\230Rh\017\2527"
+	.ascii	"\003\204\245\224\254\367\344R\251h\035\211\366\240z4\322\273"
+	.ascii	"\336\023m\307\200zEc\244dD#\236\027\t\016I\017\252\367\032\275"
+	.ascii	"\371\200\311\026:v\352\336\367\371\343\301\203\007\017\276!U"
+	.ascii	"p\340\200\371D;\373D9\373D\272}\342\233}\342\334\356\301\b"
+	.ascii	"\361\236R\3661\347I\t\316y\315N\243\251\217\246 \355\321'\206"
+	.ascii	"\331'\212\355\023\231\354\023\201\354\023o\354\023a\354\017\337"
+	.ascii	"\354\017\325v\005i\217\376\320l\177\230d\177\250c\1778c_Xg_\250"
+	.ascii	"f_\030f_\370\334\035\244=\372B&\373\302!\373B\033\373\302w?\250"
+	.ascii	"f?\270\266\037\324\262\037\214\262\037<\262\037\344\261\377L"
+	.ascii	"{\364\2032\366\201w\373@\271}\340\227}\240\225}`\222} \216}`"
+	.ascii	"\214\375_\233\375_\333\376\317\312\376O\311\376\217\307\376\217"
+	.ascii	"i\037-\355\321\337t\366w\231\375\215\266\277\227\354\357\034"
+	.ascii	"\373[\306\276\252f_\005\263\257N\331W\217\354\253U9\266\362c"
+	.ascii	"*i[J\346D\202\243\f\347TN\210\343*h_\224\354\340|U\310\356\245"
+	.ascii	"=\372o\251\217\276\272c\377-\355\321W\237\366\265\235\215\303"
+	.ascii	"\260\224\024\372\203\237\305\264\f\222\223\016\234\257\345\354"
+	.ascii	"\020\274\351\217~^\372\243\257\305\354\353\261}\re\377\370\311"
+	.ascii	"\361\327\217\235\340!\302\255\0335\306\340\234B\tq\374\244\b"
+	.ascii	"\247E\316\021\234\257\221\354_\326\276f\332\217\246=\372\032"
+	.ascii	"\306\276o\316\276\317\314\276/m\337\367\334\367%\331\367a\355"
+	.ascii	"\373\232\366\363\235\235\276i\217\276\031\026\202}\004\321\320"
+	.ascii	"\274q\303\371\351\232\235\364\216\350{_\254:\2609w\321\367}\206"
+	.ascii	"\371H\343\324\371\201\201`-\034\004\367\300Y)\024\373\300W\307"
+	.ascii	"<0\326\361\363}\223\316\352\330E\337\367\211}\340\027\357H\337"
+	.ascii	"\204\34467\321\367}\3230\037\351\235\364.}\023\"\002\330\\\364"
+	.ascii	"}\237\036<\374\270\330\350\nB\314\351[\352\243;\244=\372yn\353"
+	.ascii	"\370!\302\301\202U\206\363\263\3336\222[\243\321v\224\206K\n"
+	.ascii	"#\341%b\357}}\214\341jcbkZS\233!&\r\203\302RX\206[\024\333\300"
+	.ascii	"90\016\\\205k\340\033\330\nS\341)\034\225B\261\024~z\212\227"
+	.ascii	"\346\035{\360\2078\226\302N\351\035\361\350\371B\251W\240\320"
+	.ascii	"\\\325\275\357\323\303\217\007\022\272\320\320\321\220\237\271"
+	.ascii	"\3663\217\375,\265\237\215\366{s\373\275\267\375^\332~\357\271"
+	.ascii	"\177\f\343x\t\307\330\300\273aW%1M\341\214\225\362\224\230\037"
+	.ascii	"Gp~\317k\343\244\020\3070(\310\342e\013\316j\332\243\337K\262"
+	.ascii	"\337\263\332\357\315\330\357)\355\024*\365\321\030\346\3661\334"
+	.ascii	">\006\263S:i]\n\305 \265{*'u\273\357\350\371>\337\367Y\304D\356"
+	.ascii	"T\201\342||\266\237b\240{yy)\006\372\030\272q\332\243\217\273"
+	.ascii	"\366\321R\037\375\247p\3229\240\331\235\271'8\337\0032j\316\300"
+	.ascii	"\324\375i\\\232&\225K\325\244g\322h\332&u\223\262I\327\244h\322"
+	.ascii	"7)4\235K\313<\205K\315<"
+	.string	"}>]cs\243\026f\256ML\033\2671l\254\\\2713\253R'-\373CP\261\343\301\237\206II\311\210\275\367\275\272\303\365\276\317\203\360\207\370E\200\220\316\245o)Y\372V\245\200\2575\321\367}>\305\362\207\230K\265\244_: \275\357\221\025\005>\332\244\236\324\275\357\353\301\303\217\007\035\266e\244.\202\234.\245>\372B\332\243\237\336\331O\333\354\247l\373)\332\346y\356\237\255]\201\216\235A\352\243\237\302\330\177\272\345\351\227?\315\222\236\245^6\360\276I\357\373n\320KIY]8\247\\\322.O\275\244io\352\345\003\254\367=J\275\024\355\274\357Q1M\003\220\246\001\310_ZH\254\350\374\364\335)Z\210\247[z4T\325\3635{\337\267\330K\023\265\345\006\316\276\264G\277\271;H}\264N{\364\210\324G\237\335O\223\372\350K`?\232\372\350\213\260_\227\372\350\364\231\212\245\320\t\322\261\213"
+	.string	"\341=\243)/\330\373>\213C\274'xup\376\210\375t\3127\224yAx\206\375t\002\235\346\245\023\350\343\315\223\366\350?\215\362\247PR\260\tzKLX\257\331\373>/\024\237SM>p\3763\365\321;\355\321<px\360\364\027\202\371u\222%A\277j\343\327\035\320%AbT\255\264\221\013\350\0249\206\254\320CT8\272g\344\033\3247c\227\340\037N"
+	.string	"\213"
+	.string	"\001\255E\302\257\205\264\3715\224\372E\367(\201\003\352KU\210_\327\320<\366?l\300\257S\2509\306\376\373\207\006\270a\244S\2509\016\374\207\030\374\252Q\0074\324\227\030Q\027\376C\013\036\375\231\314\342\327\013P\331d\013\374:\001\352\032U\215\\\312\341\307i2\n\252U\036\341\327\007P\323\374\230\203\037k\360\343\f~\254\341\307\036~\314A\215\373S\272T\356\002?\341\004P\321\374\252\231_\203\2402Y\205W\376,\200\337\327\365\373\326~_\335\357\213\243\233~\355\364\253n*\tUL\233\217\355\367\251\375*\333\257c\374zI]SQ\204\371\325\024\277\217\213\332\257J"
+	.string	"\314\237\242\375i\323\357\363\361k\250/\277\217\307\357\373\3725\n\325\213\005\272\374\276\n~\214\177\237\005>\n~\037"
+	.string	"~\337\004\277\312\345\367]\360\253i\277\217\251yR\370}+\250@\277\272\345\367i@\373}\b\370\365\006\275\246\035\376\224\347O\007\340\223\366\370}\252\252\345O\231\3764\352O\303\376T\352O\271\376\024\305\237\232\375\251\b\177\252\366\247I\376\364GJ\344Oy\374\351\326\237\276\375\267S\035\360\353\342\331\257r \313\237\277\3441\025\313\257v\340\327\023\\\371\325\027V~\025\004\277\336@\255b\366\347\034\277.\372u\013*\225?\207\340\317 \370\325\262?\277D\277n\241\222\375\231\331"
+	.string	"u\354\367m\371\325\024\376\377\374\275\017\376\314\366\177C.\373s\217?C\375\307"
+	.string	"\372\253`\277\312D\345\372U#\277\252\002\026\341\317_\bwa\353O\335\244s\277\376@\035\302\341W\205\004\371\325\016\027"
+	.string	")\300\257S\344H\325\250\240\376\340\300\307\237b\370\323"
+	.string	"\374\232\370\270\023\340\277\n\357\360\253Z\277\332\343#~\341\216_\247\310\361k\244\220\312\237\022"
+	.ascii	"x;\350\3773\032\210\242Z\251\300\300\325_\370\344?\232\377q\377"
+	.ascii	"\323\374\227\373o\346\377\334\1776\377\333\374_\363_\315\377"
+	.ascii	"3\377\243\277\026\373\357\345?\361\037\302\320*T\034S~\265\352"
+	.ascii	"?\317?\364\362k\273_\327\371\365\235_\317\371\237\377\341\235"
+	.ascii	"_\303\375:\356\327h~m\346\327o\277.\363\3533\277\226\013\376"
+	.ascii	"*\325\257\265\374z\314\257\335~\215\367\253S\377y~\342\360Wo"
+	.ascii	"\374j\324\257>\375j\323\257\322"
+	.string	"\370U\031\277\032\343Wa\374*\322\257\032\375j\b~\265\350W\235\277\312\302\257\006\375\252\361W3\360\253\027\370\325\t\374\252\212_=\341W\037\360\253'~u\204_E\300\257v\360\253\037~U\203_-\300\257b\360\253\003\370U\n~\265\303\257F\360\253\031~\025\303\257\016\1775\370\253\277_\325\277\306\3735\233_\253\371\365\224_/\371u\222_#\371\265\221_\023\371\365\220_\377\370\265\326\257{\374\272\352\327<~\235\343\3278~}\343\3275~\035\365k\247_\313\370\265\321\257C\360\353\017\374\332\003\277v\361\353\366\327\035\3705\363\327C\277f\341\327\354\257\203~\275\376\032\371\353\343\2575\360k\f\374\272\002\277\236\300\257W\370\265\212_\237\360k\374\247F~\037\336\357\023\363k\024\277&\341\327\276\337\267\302\2577\374\372\304\257\035\360\247i~]\342\317a~=\302\257I\374\272\001\277^\300\257\023\360\353\003\374\332"
+	.ascii	"\377\355~\r\302\257?\3705\360\327\"~\335\301\2579\370\365\004"
+	.ascii	"\277\216\340\327"
+	.string	"?\277o\305\357\323\360k\236_\373\374\272\347\327\027~\037\227_\027\177,\302\257\211\277\036\376:\370\3732\370\365\376\265\376?\366\353\336\257\323_\377\367\345\375>\267\337'\366\373:\360\373&\360\373$\360\373\032\360\373\200\177n\373S\271?\257\375\231\312\237\311\376\234\365g\254?G\375\031\306\237\335?\263\177\276\300\237U\374\031\205\377)\376|\302\217;\370S\272?\205\363\247o\376T\315\237b\360\377\315\177\260\377@\376\263\375\227 ///\357\027v\370?\234\370\237\324\035`\274/\326\225V\322\226\246\311\023\224\251:7\340\034P\316*:\024\022&K\2320_\001<\366\025`c_\0011\366\023p\267\237"
+	.string	"8g\306\330\320Xyq~\002\3346\034\260L\n\005\232\001\262\345"
+	.string	"\222\351=\321\266\026-&\240\031`\023pM\213\006\027\020\316\226\225\316o?\303 XLx\340\374\004\224m\267\2741@1)\024\350\006ls\263\363\004e\252g7&&\252\363\023\360\264\217\200:\300\265\217\325x\223\303\201\363\021\220f\377@\265 x\312)\t\016\347\037\b\006\370e\006\0354g8{I{4\371R\206\363\021\340e\237\001\255h\021;\033\273B\206cX\341*\253\002\302\231\346b\326\005\310\005x\005\230\005\230\006\334\002D\003j\001bI\241\3003\240\331\201UR35hJ\206%J\005\213\245oU\n\360\222\022=\003N\3011\254\236\226\324\245X_pB2\344#\240\310&\246=\372\b\300\261\217\200\032\373\b`\332G"
+	.string	"\214\375\003\340\355\037\200n\377"
+	.string	"k\366\017@f\377\300\247\326\025\264\t\347\203\300\245f\315H\333\221\"\036$\001:\001z\001\233"
+	.string	"\237"
+	.string	"\301\200a\300(@&@)@()\024\370\005Tr\340\022`\327\031\021\034c.\372\005\254\002\016\231c\367\005d\002R\245oB\262\333]\024\313\026\216\001\374\002\"I\311\276<\035\231\362z\337g\3762\027\206\213\206\234r\245>ZC\332\243\177\200%\373\007\370\261\177\200\252\375\0030\355\217\270\263?\242\315\376\b\267\375\021i\373#\310\204p\020ZQ\302\372B\362\003\b$\205\002\203"
+	.string	"\255\232\2008\3227!%|\261\001\203"
+	.string	"s"
+	.string	"}\244oBJ\300k\313L\344H\221\243\263\026\026\316\250\213\202\363G\334\350\001\344\001\304\002^\245P`\026P\007>\313\002\356\320\222\225\205+\353,\313\b\204*\247<\267\272\367}\2132\262\256\336"
+	.string	"\363\rPf\337"
+	.string	"e\373\006\220\262o\200!@\034)\326\273\201X\203\314\313\252\307T/\212\0301Ip\276\001\2006\2005R(\360\006\320\351\300(\342\021\317\373n\271\211\002o"
+	.string	"\233tU\372&$\177\311E\365\022:-Q:?u\213\001\204\002J\001\237R(0\35232R\033.`\324o)#\035\r\340\213\023\035%u\316\260\037uv~\b`\366C\340\262\037\202\224\375\003i\330\021\237|\225\325\301\371\251[\2344p\324DC\270\371E\325\234\350\244\352\314,E\313\336\254\234\350\244\352\344\242ct8\321Iy\275\371\331\375\324\374\332\024\300\355\f^jF\246\312\211N\252\356,M:\307\211N\312+n"
+	.string	"u\036\310\ts\242\223\252K\303\312\320\340\202\3236\234\350\244\352~v?\272\003\2449\321I\325\001\223\200J\300\367g\347W\007\030\003h\364\243\363\303\373\345\001a"
+	.string	"\217\200K@$\240\214\337\035p\306\357N\n\375\331\375\346\334\227\303\247\303\316\355\211\353g\367C\003\302\235\023\235\224\007a\216/0t\031\344\207\020\265\017\002\336>\bk\366A\350\262\017\302\327>\bE\332~s\3037*9+8\037\004\252}\020\222\326\374\330\244Mq~4\301\371\037\314\255\371\240m\377\003,\373\037\204\355\1770d\377\003\246}\017\356\354{ \267\357\001\227}\017\302\366=\340\332\367"
+	.ascii	"\307\276\007F\373\"\242b\332\332\330\326\330\250dy\342\034\346"
+	.ascii	"\231$c\f\2332\234/B\314\376\377\373\362\363\362\343\362K\373"
+	.ascii	"\201\371uI\241?\265\037Z\306\362;\353\211Am-Hs\370\312\026\272"
+	.ascii	"*w\321\237\332O\213\033+v\\j\277+Q\247&V\301\271 ;\300\020\363"
+	.ascii	"E\030\331\027a\265/\242i\377\262\244cT\206\324\301\371!\346\354"
+	.ascii	"\207X\263\037\"\314~\b*\373!\270\366\3773\243\342%\252\315\233"
+	.ascii	"\037\225\007\177\240\231\035\225E\251\002\006l\f\316\367\300"
+	.ascii	"\353\367\005\207\004\fH\024.\"P\242\357\373\f\362\333\322\002"
+	.ascii	"\213\026\371!\201\373\212\376\b\213v\375\234 y\375\242\374|H"
+	.ascii	"\211\206\375\236\277\261\337\224\037\364'\366\003\373I\371\221"
+	.ascii	"\245\320_\224\037\224_\224\037\327o\211\021\r\307ikN\335\373"
+	.ascii	">\361\234$Yzd\310\017\361\224\365{\242\325\205\265\003\347\207"
+	.ascii	"0\332\357\240\216\311\257\3116B\326V\326\206\211\231$?%A]U\246"
+	.ascii	"tIR\305\310\357\210\317L\030*^\240\030Q\262\337\201\216\337\020"
+	.ascii	"0[o\250p~\007P[H\007F\373 \344\366A\250\355\203\250\262\377\237"
+	.ascii	"\326/\013\272\366u\204\363/\253\007\326o\314\207\221\f,\036X"
+	.ascii	"\013\f\225.8_E1Z\222\203\363A\200\355\034\277\033?\253\021JP"
+	.ascii	"?'-\266\350/\307\257FWS\035\250\337\216\237\216\024\372\313\361"
+	.ascii	"\263\201ecUy\272\242\363\377\263\372\341\260\263c\206\027\316"
+	.ascii	"U? @\342^\234\017\242\306\217\3527\225\317\236\336!8\037\204"
+	.ascii	"\322>\b\243\375\017q\366?\234\331\377O\352\027E$M\2203\277\250"
+	.ascii	"\037T\327\0259Mp\266\363L\343\022m\302\371\036\310\220\301\365"
+	.ascii	"c\372\321\3705\375\236R\350\317i\337-\315\340\232q-\304$\236"
+	.ascii	"\227\006\022\023\327\317\351\027\003\213\261rc\002\346\177 \263"
+	.ascii	"\377Am\377\003\227\375\017Y\366\377S\372\301\270\223RG\t\316"
+	.ascii	"0\376\377\227$\304\202z\223\340\304\311\221\341\374C\322B\346"
+	.ascii	",!\341\374\017d\373\377\316\373\275?\243\024\372;\332u?trp\375"
+	.ascii	"\216\366\034\035\277\243m\267\361\236\350\257\24690\"\226\233"
+	.ascii	"*gv\3767\336\276\223\206\007\347\r\316v\236\272K\b\034.8\377"
+	.ascii	"\203\327\256\263\357j\310\rq\203\363?\020\331\377\360c\377\303"
+	.ascii	"\216\375\017R\373\037d\354\177\313\331qv\254y\023\265\341l\272"
+	.ascii	"\375fGS\350\216\263\347\306\330\020\341ZS$\nB\033\335\245i\016"
+	.ascii	"\254\316\2038\333MZ\323\034\230\327\376\252\241\224\006\314\347"
+	.ascii	"\340m\237\203/\373\034L\331\347`k\237\203\034\373\337jv\234\221"
+	.ascii	"\321\323\022\316\307eb\342\366\333\326\352\211Am*P\031Q\271}"
+	.ascii	"f\233\331i6\334F\223Bw\334.\223\363\342\266\033\215\350\036\003"
+	.ascii	"\027b\307i3)\031TS\334\034/U\354\354\207\035b\376\006j\3667p"
+	.ascii	"\333\337\240\312\376\006c\373\033t\355o\200\265\377\335\366\255"
+	.ascii	"\206\204\365U\007\347{\340eHt\253m.D\242]\266\270\300\354\265"
+	.ascii	"\035f\263\245\320\255\266\277\250\35549bt\354\324\371\256\344"
+	.ascii	"x\235\200\371\033\330\330\337\340h_\203\270}\r\312\3665\310\332"
+	.ascii	"\377\336\222\305\240|\3212C\363\311\251aM8\226p\376\267\226 "
+	.ascii	"\23001<\364\231T\\Z\335\f\037\215)qiuY\311\022.Rk\3202\\I\240"
+	.ascii	"(\211K\253\003\353\001\307\310\2212bz\213\330\006L\216\342\322"
+	.ascii	"\352\230d\257\034\245\306\007[\216\234x\371\252\324\270\340\311"
+	.ascii	"\224\270\264\272\314\244I\004\246\304\245y\355\037K\322\342\322"
+	.ascii	"\352\332\306\322\342\322\3526\226\375d\217m%\273l3\331W\366\224"
+	.ascii	"\215ds\355!"
+	.string	";\313\366\332_\273\3106\333R\266\225Mdw\355%\233l\203\355$\273\311v\262\243l#;lC\331[\373\310>\333Tv\225\375\334\320\024\272\3056\220\357 [\310\177\266\330\366\261\265F,)\023\227Vg\004\211\230htG\026\353=\271\3242-#_\304|a\364\214\236\030\324\003\240O\254\\Q\022\227Vw5%.\255\316\347\024\345\333\222\352 \312Q\\Z\235\222\256-i>&_\223O\306\b%\250\007\300\255\321\202\346\3632B\t\3527\003\t\313\231\0238jaY\354\002)p\272\230\250u5y\002'.\255\316\311\026%>,Y|U\314\242L\266X.\313L2\231\224)qiub\033\313'\307$+.\255\356\214\230n\332:F(A="
+	.string	"\212\304Gd\213\371\212\370\266zbP\020@\032\243d\213\371\226\344\272\254\021P\262\342\322\352\266\330\346\241$.m\213e+>\031\035\220\226\336Wj\203(i\036\246\\\271c\307\204\234N=S\037\215!M\332\243\257A\216}\r\234\366=\344\355\254\037\032\272\035f8\337\303\234}\017q\373\036\334\366=\244\355{0\333\367\300\265\267\216_\323\320L;\207P*\215)\016\316\333jG}\034\215\301\371\036\2646\225~R\345\214P\202\"\001\256jS\251v{\252'\006\005\0018\034\321\252\215#\205n*u\316U:j\335\177~T\032SWc:\337\b\256\3051\355\300\371\036\242\366\216\332P\032\213\026S\224jg7\365\304\240H\320\242\021\335Q\333\311'\027\"+.\315\313\306\256\261\245R\350\216\332O\036~\004\200\306\365\334\371\036\214\366\0130\267_\2005{7\375\352\235Zg3a,6)Uh8\323"
+	.string	"\332A\242K\202\363\013"
+	.string	"\267\337\265\274\031p4v\322\275\364\304\240v\231\026\023\336^\3320v\214-c\317H\241[i\033}\037m\244\255\244\336\271\026\030c\033$Y\242^\225QC\023\346\027`\314N\261R\037\235\001\314~\001\320\366\013Pe\277"
+	.string	"S\366\013"
+	.string	"e\277"
+	.ascii	"Nv\357-\365\321\n \262\177\236\251\217\356-\245=\372\005\270"
+	.ascii	"\332\\\212]\274\354\034\301\371\314FS\220h]\276b$%k\322\024$"
+	.ascii	"\352e\246\263t\2201\265\246\217(i\n\022\255\333r-=1(\rJpR\242"
+	.ascii	"\357\373\352%]\332\311US\220h\335\026\216\341\306\205E\027\361"
+	.ascii	"j\n\022\255S\301h->\271\034\252\224\366\361Cku\220\361\276GO"
+	.ascii	"\324\264|\005\211VBD\345j\n\022\2553\253\021\225R\3414\005\211"
+	.ascii	"z\251Ae1\034jWS\220h\035\232\357\314\225\n\325\024$Z\247o\250"
+	.ascii	"`4\225\306\321\001F[S\220h\235^\242\2754YO\f\352\347\004=\213"
+	.ascii	"RqH\321uMA\242u\2765\025\214\272\005[\351\2004\007K\375\021\207"
+	.ascii	".\227A\331\350\034W\301h\035Z\253'\006u\202\226\232h\276B\344"
+	.ascii	"+j\245\362\200\242\347\350\033Vk\362\225\f\r{\202Q\205\250hF"
+	.ascii	"t\264)H\264N\005\243\241R\262\016H\357{\265C\215\323\024$\252"
+	.ascii	"\202Q\217T(\270(e\3240j\032UN\355\242\236Q\337\3246u\214\272"
+	.ascii	"F\345\242\262\251nT7\265\215J\247\306\251oT5\352\234jF\375\242"
+	.ascii	"zQ\341\250qT6*\0325\252\246\251j*\234*F%\243\256\245P\025\214"
+	.ascii	"o\213^R\206\224\205\013o\251`4\025]\325\001\306\373\036\355P"
+	.ascii	"\253\232\202D\353t\224\nF\333\230\213\346+*\030\rD\017)\242\242"
+	.ascii	"5\005\211\326\251`t\232jt4D\333i\n\362\333\262\242\223v\"?\203"
+	.ascii	"6[\325R\364\021\344\350\f\316"
+	.string	"\317@\314\036\242\026\351=\271N 9E\257\250g*\226\024\252fIR\263\250FT\261\021JP( 5E\263\250V\336\326{&y_\037:4\217&\255\256\\&$\f\217\235\237A\326~z\366\204C\372&D\004%W\302T1\365\210\352\325\001i\311\0045,P\356\205\370{\337,3\256(_`\031\244of&\320\300\242\357\373T\305T)\367BL\342y\223\216x\255\251b\352\027\207\001\334`\312\013\253S\251\250U\324)j\231:\246\222\251f*4\205\252b\3523\311WFVW\007C>\006b\3661\370\262\217\301\331>\006e\373\030D\331\307\240\311>\006G\3661\360\341\004\033\315\225y\302\371\030\324\330\377\325.\225I\nU\233\250\\HT%>\332p5Q\227\250J|p \206i\016\034\017\275\2635q\310t>\001\322\366\257*Q\223\340E\331\201\207\263\232D\345\nC\302\344\003\347\023\340k\237"
+	.string	"K\366\tPd\237"
+	.string	"?\366\257\022\271Z\344W\201\250AR/\276*2\330b\340\254n\205\270J\004\206\020&)\2341H{\364\tp\265O"
+	.string	"\034\033?S\037\235A\332\243U\037N&nz\340|\002 i\251Y[Q9.\234\325,\2435W\342\354\354P\257t\374\230\334\250\302\006\315\216\253:\320\200\235\315\301Y\325\321\223s\005\304\210\r)U7\264\214Q\253\272\352\320\241\341\374\001\220\251T\352T\222\335\0247\234\325)\261\024\212\0338:8\2535T\033\233\353\311\b\206\215456<+\251\337\2333c\204He\244\037I\316\240\340\374\0018\331J?=*IOT\247\024\252>\251Hf\352\223\232\2446Y1\251\251\253\023\2762\354\266\344\374\253MW\231\234\234\242K8\2534~m6n\204\301\371\003X\332\277*#\205\2523\334d\320c\211\024\316\227\243.\375\377\341 g\346\356p\376\325\245\2531\240^*8pVz\243\312L\301\371\027\314\331*\f\025\t\36782\023\205\363/\240\333\277\200\314\376\005m\352\273&\nU\031\316\277"
+	.ascii	"\355\216\306K\241:O\203yf\223\333\344i.\372K\324\002\256\362"
+	.ascii	"\264\232\256\223\276U\361\274In\356D=\244e_\360\340\350\314F"
+	.ascii	"\327\261\341\272\323v\332N\n\325u\256\353\3500\272\f\321\350"
+	.ascii	"\302\373\002"
+	.string	"\261\303UG\303i5\351\233\331{\324\203\203(\223\224*\016\036<\004\231~\3540\332\371\277\236\243\351\244P]\247\345Du\234\016HK\357\221V\001\272\230\244T\325\325\3516z\256\003\322R\t]\326D7\227\255.Ct\376\005c\373\327q4\235\f-K\342\336h8\300\033Uo]p\376\005^\373\315S\247$0\330p\376\005H\366S\350\333h7wC\244m*\n\316\277`k\377\002\255\375\013x\250\321ft\\\372ff\302MN\257I\241Z\215Nc\246F\257\255\315E\211H\226@\211\242\363/\250\261\263\223$*b4\032}\346\035\016\335\354\360\322\205\363/\220\261\177\301\321\276\005xo\232L\n\325e\364\030]F\263i\267\016HK(\256\356t\031\275\006\007\2049LR\252T\037iR\266t\276\005\\\366\257\335\264\030\034KY\354\370\300T\2311\242\3334\03053^78\337\002,\373\026\214\355["
+	.string	"e\337\002%\373\026"
+	.string	"\331]\264\027*Ya^8\337\002\035],\260\261o\001\324\276\0053\366\005p\267/\2007\373\002\220\333Y4\026\214fGi\ng]E[I\241\367\242\257\f\001c4\004\347\013\200\314~\361\276\357\233\336\213V\357E_"
+	.ascii	"g\373\002\200\356\013\300\311\036+\326\330Ae\t\347\013 k\337"
+	.ascii	"\003\237\233\206\322\023\203\332V\202 \211j1\rM\241z\212\006"
+	.ascii	"3\323St\024\375\354 \343}\263\236\020\243LH\242?\036\206V\352"
+	.ascii	"\352L\351\034\246\245\024i\030\211A\304LX\230"
+	.string	"\375"
+	.string	"\214=\321_X\212l\313\353\311\217\315D7I\341\346\334\311\300\371\001\230b\022"
+	.string	"\246\235B\245=\232K'\351=\317\302\224\301\343\202\263_A\232\375\n\330\366+0\333\257\300k\277\202--\244\370v\344\313\031\316\257 \207\016R\201\323>"
+	.string	"\362v\312\225\366\350\254\264\013\206\224.\234\017\2005\373\277\306J\241\272\207\336\241{\350+\315#}3{\337\250\r\236\324\300C\253{\337\367\307C\232\203\riL\346!\207&'\305\004\347\003\340l\037"
+	.string	"_\373"
+	.string	"\330\332)"
+	.ascii	"ph\034?\216\352)]\225b\325\255u5\301YW=#\245\252T\027\2614\234"
+	.ascii	"\017\200\246\335{S\037\235F\363\366)x\263O\301\231\215)\360\262"
+	.ascii	"OA\226-\"\304\265\223\366\352\322\303\016\347S0e\207xS\037\255"
+	.ascii	"\241\322\036-\303I\224\326\017\234O\001\223\375TM#\341\371\326"
+	.ascii	"\264\222\257\315NT/i\030:\206NJ\241ZI\037\335\007\306\247\346"
+	.ascii	"[\323J>\266;J>7mD|Z2wU\327\263\202\225f\f\230O\301\220}\nt\370"
+	.ascii	"\326|b\364\013\244\001\305\362\201s\336\217O\211\211\351\f\347"
+	.ascii	"S \303"
+	.string	"\316w\307W\307W\347\243\363\331\361\301\361\321\361\311\361\315\361\305\361\335\245P\037\236\317\315}s\276\350\030\270\271\253\2723p\2763\351\233\231\t05m\242\357\373l\343\223\323k\240sWuC\336d1m\204n\356\252\356\214\017\317G\206M4\215O\356(\r\327\0327.;5>9\342\357}\217\306p\371\360|l|r\351\233Yn\"&\372\276\257\017\317Wf\r\027\236\017\215\357\f1\351\371F\251Yj\314]\325\t\227\350\2244E\220?\301\230\235\261`\331\237\200l\177\002\260\375\t\216\354O\200\265\345~_\034.\273\026<\346\315U\035\316\237\240j\013\323\036\375\thd\3403\363Kz\026\205GSgdp\376\004G\373\035\350\366;\244\331\357 f\277\203\227\375\016Z\366;\230\355\236\016a\373\035\224l\314\225\366\350w \262{\236\251\217\306^i\217\326h>/\276.=\263\347\226%\234\271\364\310t\345"
+	.ascii	"\203\363;\364\360\245\371\266\350\2579$(\234\337\201j\277\303"
+	.ascii	"\214\375\223@\316\276\004q\373\007%\301\226\r\254b\206\245p\224"
+	.ascii	"\t\301\231\n\007M\243J\2168\234/A\224\375\3377\346#K\241\276"
+	.ascii	"2\337\024_\231\357\211O,}3+!mM\324W\346\203\372\206\020\223\236"
+	.ascii	"\257Q\260\351\345\340\301\003QH\026\234*\235/\001\221}\t\250"
+	.ascii	"\366\363g\205\2700*\234/\001\215\375t\r,\214+\212\357+JT\212"
+	.ascii	"/,\205\372\242\370\240\230\375\236\364\360R\322\371\022\310\b"
+	.ascii	"\304\037\370*\316]\035\020\241\227\341Y\034\026\270\342\017\342"
+	.ascii	"\221\"Tmx\340\\\324*j\035\001/\300\244\270cG\261\3071\034\201"
+	.ascii	"ePe#\203\277x\365b\217\"V\332\220<\271\"V\221\007\260\206\034"
+	.ascii	"\231\027\337\220:5\260\\ k\377E\035\3023\034B\264p~\202==\021"
+	.ascii	"\301\262\022.\001>ab\323\202c8\305\016\020%j\305*\242\f)1\260"
+	.ascii	"0\241\032\342\361\230\202\003\206s\215\032\305\033M\250\276l"
+	.ascii	"x\371\232Hm!+\332x\361F\232G\206\254-\311\222,\030t8\337\002"
+	.ascii	"\321bT1Jxv\306e\305\212\353\007\316\267\300\230\342S\361Ix\306"
+	.ascii	"\3254\007\346;\363EJ\030\316\267\300YS\323p\210:E\265\244\255"
+	.ascii	"\330\343\345b\207\363-pE\203\306]\261\316\234\026\034\316\267"
+	.ascii	"@\214\242\214\242\f"
+	.string	"!\b\250\210\304\361\032\253\3721\006\347W\200\256\030\243\030CxF\\\243\332\n\333Qp 1\302\371\025\020S\204Q\204\221\301\016\025\2218)\030\034fw8\277\002H\212HE$\341\231\324\024\035\227W\256\002F\345\b\316\257\200V\321\250h$<\373\3012\232Cl\243\332\n\253\2031u\303\b\316\247\300]\235:\304\274\037,#9\3000\247&Vu\302\247\2561U\360N\314\363]\t\303\345\354\016^3Ge\346\216\0353cv\200m!]O8\320\304\211C\264\373\3012\232\003\204\343\324\304\252\216h\347k\212\233\272\023\355\210\314\210\302D\244\223\003j\215\031:s\224cQ\265\"{\351G\234*9B \303)\245/*Z\332\274\r\021\316{I\357\025\024\340\027\247&VuZr`Hqs\"\034\342\233\264\227\n\361\r1\2726\225\025\206\203\331Z\324\334\017M\2026K\302\253,d\312\262|\311\311\021\327"
+	.ascii	"\275\234\232X\r\265\250Q\261\2519q\315\227\326\026\0348_\316"
+	.ascii	"\357\002\f#$8\237\002C\210d\210d\210qZ\211\023\035%*\323S\026"
+	.ascii	"\0304'\306\375\202T\255\325\301\231X\206x\206I\226\030B\316\020"
+	.ascii	"\315\300\370b\212\233\3329\276\250\320\300\001\2354]\032#l8_"
+	.ascii	"\216v\362\377\327\200\25432p>\005`\214\031Sud\212\313\024\234"
+	.ascii	"?\0017b\304\f\243\322.Sp\321\037^3\250\204\t\023\206\310\246"
+	.ascii	"\247\246\350\270t\025;H\254\254\235\3106\224C\366\0266\001\262"
+	.ascii	"\2644\"\230\266\24690/a\0351eK_N\004\243\226QUY\362\202w\247"
+	.ascii	"\311\fgb\227\256'\037ap\376\004\236\020\271l7\272\013\022.a8"
+	.ascii	"\177\002>\320\320\210g_zD\246\264\300\341\374\t a\301B<\373\331"
+	.ascii	"o\224\037E\242\305/j\266\322d9\361\254\210\304\244H\026\270m"
+	.ascii	"fF\264\002\\\263\321dJ\237y\332\235\251r\242\225\333y\"\245\f"
+	.ascii	"\347\313\tv\371\377\033z\2659\203\003\347K\200\2148F\034#\226"
+	.ascii	"\375`\031\315\321VSt\\uj\231\255$Wd'\226\301IA\223F\353\377O"
+	.ascii	"\273=\331\271\303\371\022\200\002\003#N\371\3012\222\243\335"
+	.ascii	"\246\346\324\352p\226T\324\221\330\211S\262\330\317\r\032\026"
+	.ascii	"\020\234\211Q\210\317#b\\\352\210O\242\224.i^H:\210;\336,\221"
+	.ascii	"\022\206\237~O\\9\352p\276\234\275\345\377\317g\3449c\016\316"
+	.ascii	"_aM\311\211^J\210_j\227\237\027)\351\275\032\322SgjMW\335\273"
+	.ascii	"\244#\203  <\332\236\234\370\325\246\363\310\320\262p&69\321"
+	.ascii	"\311\377S\343\316\260M\301\371+dmb\327\211L\376\237/G\2155]8"
+	.ascii	"\177\205\035\373'.\371\177B!mnpp\376\nT\373+@qq\021uL\001\251"
+	.ascii	"\312w\224\340\310\303\371+\300H\251\244T\210G\210J\246\342\246"
+	.ascii	"\204X_\322\214\234x$\017asc\r\021\"\332\312F\\\325\320\216J\020"
+	.ascii	".\234\257\002\226!C\322\260)\270\350\226\221&\267\005\347\253"
+	.ascii	"\020$H\020\265\2512W\300\270\035lv\340\374\025l\260\216E\374"
+	.ascii	"\221Ny\23740\025\006\346\325\203\263\366\303\207\217\023\177"
+	.ascii	"\374\214\310\251\333\322\n\272YI\245\321\"f\245\271\341t$\r\212"
+	.ascii	"6Q\300\020{\364\252\326\214\250\321\225]]\005\301\246\240(\261"
+	.ascii	"\262\364F\006\347\257\260\322\241C\225\232rR\347\263\202\022"
+	.ascii	"#\347f\352SD\253\224\347\211\004\007\205Kxc\210W\021\034'Ze;"
+	.ascii	"Ctd\301\371r\210U\377\177\352\0237PC\252\210T\321\271(O\234\211"
+	.ascii	"T@+\016\252\324\033\230\030al\330\320uOP\246\274\336\267*\003"
+	.ascii	"`S\324\027\r+OOD\251\324\316\324\2224\257$\267\035e\210Q'J\335"
+	.ascii	"M\232:=\266\340L\204J\357\376\377\210;\252x\335H\301\007\261"
+	.ascii	"\211\330$<K\247\274O\034\232L)\351\252{\337\252\fzT]\236yv4h"
+	.ascii	"\204\371E\321\200D\341\374\b\244\331"
+	.string	"?q\351'.\021e\224\300\363\276ZOh/T\225\006A.!hOQ\260x\331\202\363#\340\205\370\236\250D|\207jX(\375\244@\305D\317\336\332\214\340LL\"\302 \"\021\217\210F\021x\272\3710N\320Mp.\205\016\335\f\361|H\357\221\0215\314w\203J\r(\316w|tB\326,\301\371\021P\"gH\207\215\353\035\336\r\355\244\320a\235a\335\260\316\320nH\207h\364|\215>h\223\212b,jR\306\350\374\b"
+	.ascii	"\331\217@\325\376\207s>\244s\342[\223&hpN\303B|8\007x\026\205"
+	.ascii	"\362\204\363#Pc\017\341\f\351\206o\206\321\341\234\n:\373\037"
+	.ascii	"\262\031\262\021.\311\200\347}\265\334\320\256\242n\214p\276"
+	.ascii	"\2123c\037f\201\016\307\206j4\024\327\033\244IU\353\211%\211"
+	.ascii	"\232\202\263\234z\024\207&\f\316W\241\266\237\202\235\r\321\330"
+	.ascii	"D\207[\326D\273\f\277\244oBDh2F\257\r\265t@Z*\001LM\231\241\332"
+	.ascii	"p\314Y]tXf\310%\215\231a\232a\334\360\314\220\314\020n\210&\205"
+	.ascii	"\016\313\f\301\254\r\313\f\323\344\242\3058P\250P\361\344\341"
+	.ascii	"\331\333t@Z*!\314Mt\3506|K\241\3031\037\216Q\223\206b\322\267"
+	.ascii	"\252\347+\225\272M\001\341\340a\b\307L\232\034:\377C1\3036,\317"
+	.ascii	" t8\017\331\324**6\0308_\205\327\376\207aR\350pm\313\361\332"
+	.ascii	"R\007\347\313\371\005\301li)\331W\361c\350e\237\211\356p\303"
+	.ascii	"\371*x\354\253\310\261\257\302\306\276\212\247}\0253\366?D\033"
+	.ascii	"j\031[\213\343\246\005N\f\023\022\316W\241\264\207V\206X\212"
+	.ascii	"_h@\256\340\374\341\225\377\277\023\266\306\\\3019W\301lH\270"
+	.ascii	"\232p\376\320\214\230\346H\0251\234?\244r%/\016\016\234\207e"
+	.ascii	"[\t\205:\f\200;\316x\344 \373\260\354\0376I\255\264\220w\207"
+	.ascii	"\016\316\276\270\020\037\222\271}\211J\301\371"
+	.string	"(\224\0312\371Pl\310d8\305\207\364\036\035Q\333th\020lz\202\226\206\263\221%+7\234\207a\303\247/\315\377\373qa\202\323\201\363\207R\376\377\200B\312\030a\2023N\357E\017\301>\214\362\377T0\250\244*8\037\0051\373\303\257!\224\377\327\273\323\306E\006\316G\301\313\376\360\311\377_\b\326\364x\202\363\320k+\241P\206\301O\315\2246D\234|\350\365\324\313\006\230rT\315\341<l\022\342C'\030\211\031\033\033\316\303\264G\037\205!K\226\340i\241\363\346\016\316G\201j?\213\245\303$I\354\240\260\204\004\211\360\354I\364\306\322\021\030s\214\030\tAM'\251\235}\301\021!2\034\022\206\013/Y\261:\203\363O \033\006\031\006\031\016\301jPfD\325%#\032H\204\244\320\341\020(iO*\234/'%\373\377\363i\315a\243\245\353\307\217a\324S\250-\036T\005\227\224\231#\006\347\237"
+	.ascii	"d\2505\324R\300\023)\304(oUTp\376\tT\273G\2177\272\001\236\235"
+	.ascii	"\0368\377\004\244\035;\206<\316s\004\242\256J\035%\271\341\325"
+	.ascii	"\207<0\026.<\234\340|9Y\354\377O8C\212\313\025"
+	.string	"\316OAg\230c\230\003\n\304\332\215\255*\257M\243\256\311\033\316O\261\206j\210\203Jx\246\3377}b=A\275UP\031TU\035\211@\003*]\031\223\202\363S\234\355\247\330\332\377\360\006tx#\213\365\336\367J\207\256{j\360\024:j\324\020\236\235\207\f\b%=(o0\246p\276\txC\250!\3240j\313\007\267\033[UuC6k^,\303\250$K\264\230p\276\tt\373\037\322H\241C\032C'_\322{\004\246\245l\304U\t\277\314v\300\245[>t\372\207L\303\246`^\232\301\224\234-\301Y\370\226\372\350\024\013\227\375\017\221R\350\020i(\343\227\364\036YQ\333l4\231\362bk\213\016c|(\343\037&\ra\f\227\260J\025g$LFS\3475\206\363P)\304\2071\202W\330\356 \301\271'\355\321\031\336\324Gc\023\216\354\177h\364\024:4\022Z\371%\275GD\264\022\033H\272"
+	.ascii	"}\254Qr\302\371&\\\355_\230\367\024*\314\023\226\375\222\336"
+	.ascii	"#/\335\345D'u\206\315J\033\234o\202\214;w\204S~I\357Q\021\325"
+	.ascii	"\206\323"
+	.string	"\326\034%ds\324\324\331\331\t\353\204Hz\217\240\250`Mu\240\352\336W\207\006\352\232!W\216\204wj\0341Z\352\344&\271!L8\037\002l\366/\224#GH\347\207\347\371jA\341z_\035\032\004\357\306\244i\022\316\361\365\240\273S\344G\310\224\343\314\013\316\207\300\031::\341\263\227\364f\035\321nMs`\251T]\231\031\234\017\201\2647o\210]\020\21027'\f\373%\275@\236\350\253\246\2709YI\216\200\341|\b\004\331\277\260\rT\330F\b\326\201\2347t\354\340\"c\270\310p>\004\246\366\323'\251p\315S\250p\215ONC\315x\265\242<L)ip\b\310=\205\n\345\204_\232\312\231+!\025\032WO\234\017\201\030\373\027\306=\205\n\343\204^r\246\304\245m\031p?\256\3109sFx\226\276\357\373V\275Fo0\260\272\261U\345\265\245@\201\223\323\006\007'<K_\250\367\255Z"
+	.ascii	"\331\223\350[U\225A\261\b\033,/\264\2677!\031\f\357\373\276\\"
+	.ascii	"j\031Y\221\350\357Y\345\310\034\231; \0211\245\036_nn\302\266"
+	.ascii	"\022\336\3675\342y\221\316\360\340z\253\2522\030\336\220\373"
+	.ascii	"A\004\347?\240\212\215M\330\366\024\n\007\320\252*\203\234\264"
+	.ascii	"\206\r\0209\027\266\245dA\271(\257(8\037\005\336\376\205a\236"
+	.ascii	"B\205a\204L2\300:\262\261A\222)@\360|_k\232\270\301\371(\334"
+	.ascii	"\366/\004\003\025\202\351\251\t\361\276>x\250Pj\032\250iQ\252"
+	.ascii	"\214\340|\024X\366/LK\241\3024\241\227\f\260^\251\017\350\310"
+	.ascii	"\320\261ST\022c\352\n\316B/\277\220\213\260KO.\3357\356\3500"
+	.ascii	"\341\314!\232\372\350\336U\332\243\217\242k\377B\264\247P!\232"
+	.ascii	"p\t\020\352}\265\254T5\250*\r\212P\302vP\301\371(\260\366\205"
+	.ascii	"W\204X.\314\002\025f\021\236\235\347}\337\240\215\033[Uuo\025"
+	.ascii	"T\006\377\345\244P\341Y\231\256#Vp~\tr\366\237\036\377\372=\202"
+	.ascii	"z\337W\312\367|\241\220\204\372O\237\372\3224\203\177\230\366"
+	.ascii	"R\001\374\317\357\373\277\367\257\260c\003\357\273u\306\365\276"
+	.ascii	"o\032g/\321r\224\003\347\377\025\274\377\377\r\357\373F-%\275"
+	.ascii	"F\351\322XV\324\322X\026\324\205\245\266\254\2507)\312+)\013"
+	.ascii	"+]J\312\202\202Jz\215.\274cYPKoV\024\317;\366R-\215\035\031\245"
+	.ascii	"KIo\324\373f\275<\357\322Q\324;\366\204\272\2604\226\005\265"
+	.ascii	"4\226\025uai\354(j\351\305zy\226\236>\240\336g\226\321\005\032"
+	.ascii	"cGQ\357\030V\324\205w,+J\306\026\0231\017Y\342\374\030\362%\311"
+	.ascii	"\213Uj\264\224\364:5\3518\202\342y[zb\275i\33675Sz\241\336\267"
+	.ascii	"\367\025\300\373\352\300\202JsD\225\242!\2759!a9\302\342\320"
+	.ascii	"\204\244\205\365&\275\031\245\357\333R\027\326\373v!\t\275M\357"
+	.ascii	"\373\276\037\030=\337\336!\351\233\221\017\035/\223\322\373F"
+	.ascii	"\360>\337\267\351}\215\322\367\355}_\243\367}U(\035\317\367\265"
+	.ascii	"\342Y\342jjz\337\252\237\246W\207\321\026\245\367\305fj\320\242"
+	.ascii	"\226\306\264\260Bl)\033\343zc<\215\322%&"
+	.ascii	"\254\227"
+	.string	"\353M\223\005\265\307\214\304^\246\367}S\272\315\025U\003\016\316\302*I)\223\253\254\347F\232*\263\005g+VmAp\026\222\261i\351\241\005\347\227\300\344\251\212\315\241u\301\371I\365\365\206\t\316B\261\374\345\016\220\0328\277\204![(%\365\205\215\221A\202\363K\310\261\205Q\362\366q\0256\206\363K\230\261\205P\206W\304@\271\340|\022\360\266\360\t\214**Yp>\tt\266\320\211\332\004\317\314\023\234O\202\232\347\363}\237\305 \332U\025\033\302\256\237\227\221\032Ap>\tZ\266PI\226Zs\363\201\363Ix\"\021rm8\273\037l8\237\004\"Hx<\205\ny\b\215\244P\351\373^9\303\024}\337*\r4\324I\215\034\234\213`\221kB\005\347\223\240c\377\027\n\021n\t\207\244P!\021!\220\013\261\204=\306\204D\204YK\321\367}\n\211\b\265\204?zbP' \345\215\t\211\b\203"
+	.ascii	"\245\234\232X\r_\031Xo;\237\004\032\373'\354\b\177\b}\224\211"
+	.ascii	")\363\306\314U\033'8\377Dt\377\304\332\326X\251\217\276\231\264"
+	.ascii	"G\377D\231p\007q\016\r9`p\376\211$[\250Ch\365\024*\264\022V\005"
+	.ascii	"\340\356\351\310T\017\r\256\006\031\316?\241c\377B\034\302*2"
+	.ascii	"\3213\234\205T8\260\234\235\301\371'\230\366/\274qCX#\003\254"
+	.ascii	"\267\006\007]OK\352~qxQ\236\314\331\250\361E-\013\027\234\205"
+	.ascii	"5\204Qi\233\232,YB)aT\361\214K\216pN\f\227\r\234\237\031\252"
+	.ascii	"\2348\341l\005Z\307\254\351)T\330$\244\201\247\274FA-oh\256v"
+	.ascii	"\334\240\212\201\363\035\320\266\177!\223\220\006\033\270'hp"
+	.ascii	"\026\316\300i\274\254\201\301\371\0168\333\277p\351)T\270$T\362"
+	.ascii	"%\275@\3024Z\225\006A\266:U\226\354_\030C\250d\345\t\22768\013"
+	.ascii	"a\340t\016\2350\0358\337\001;\366/L\022\"\371\226x\035\025\371"
+	.ascii	"\275\311\341\345t\364\263\306\216\0307\243\f\354\320 y\341\374"
+	.ascii	"\013\337<`\234.\"O8\343A9B\306\206\363\035 c\337\0036mr\330\n"
+	.ascii	"\261\367\276Gm\270\340\340\004\351\202s\202u\202\321`]0N\320"
+	.ascii	".H'h'('\370&x'\205\006\357\202m\036t\023\234\213\233\213\276"
+	.ascii	"\357\033\274\013\236\t\336\005\323`+\351[U\376\n\336\005\311"
+	.ascii	"\004\313\244oB2\230\235\250\233\0326h\336\202w\330\013\177\245"
+	.ascii	"oU\271\013/\372\276\357\232\224lM\360.h&\216\215\270*\257\237"
+	.ascii	"\341\033\035f\212t\310\030*\365\321\002H{\364M\240\355\2330\333"
+	.ascii	"7!e\337D\327\276\211\"\373&~\354\233\340\261o\342\306\276\t\245"
+	.ascii	"\375\022p\366K\260\005\313\334\245\3058F\356\212\340\374\022"
+	.ascii	"h\373%\314\366\037\034\023tc}$y\202\263\030 \2330_Hp~\211#\373"
+	.ascii	"\036l\tv\031\303\265\026DK\023&\250\026\004\023d\013\266\245"
+	.ascii	"\320\340Z\320\313\227`\027\2555\321\340Z\020\032,S\023\r\256"
+	.ascii	"\005\251\004\265\364\236\\\233\006\222\234\206\346\200\313\""
+	.ascii	"\314/\361c\277\004\215\264 \227\037\226\025\364\b\347\227@J\263"
+	.ascii	"\263?\002\2333\341\324\2247S8\177\204 \226\340\225\024\032\314"
+	.ascii	"\022\254\362|\337\367 Xa\343\nf\t\232\251]6\232L\371\240^5\362"
+	.ascii	"t\376\bP\366G(\262?B\326\376\b:\202d\330\316\230\270$8\177\004"
+	.ascii	"\250\340\330\bJ\373\017NI\247\202\204y\006\217\332\224\301\220"
+	.ascii	"\2131&\257\016\020\317\256\354IK\220I\260GPG0+\370"
+	.string	"$\350#\210$\270$\030%\270#\330$\b\026\f\013z\005\261\202b\301\253\240V\360\031T\022\224\022\374\021t\022\004\022\354\n\016\tr\005\215\004\241\004\267\202B\202A\202G\202I\202D\202<\202ERh\360+\210\343A\253`\216g+tdD\327\336\271\250\f\340\235\273h4\370\005\244\333ZN\\k4\330\200ww\224l\244d 4\205\271bW\003\307pR\343\n~\005\251\202U\304\336\373\372\220\302u\003*%;scZ\213\206\210\312\"\205c\314h\213.\271\325%\2551\233\023\207\211\253-h\024\234\262\013~\005\221\330D\301\354\004\277\200r\246l \351R\367\276\317\037\0323i\240\230\220{\317\324G\217H{\364I\304\005\253R2uI\236\023\034\234O\202\314>\t-\373$\242\354\223P\262O\"j_\204\272}\021\320\354\213`e_\204(\373\"(\331\027\001\310\276\bX\373\"P\355\213\340\264\337"
+	.string	"\274\375\006\240\331o\300\331~\003\240\3547 k\277\001S\373\r\230\261\317\200\273}\006\230\331g\200\332>\003\312\366\031Pd\237\001M\373\013\220\263\277"
+	.string	"1\373\013x\356/ \310\376\002\232\366\025\220\267\257\200\271}\005\274\355+"
+	.string	"m_\001L\366\017\204\243\351\314\3148\315\001\303"
+	.ascii	"\321\364\236h\373LkGt\016\030\007\034\322\001\206\327\023\224"
+	.ascii	"\251\2727\300(\260\r\220\r\320M\n\005\316\001\327\3409\240\232"
+	.ascii	"\364.\355\252d\201\230N\025"
+	.string	"G\246\022\310\267d\217\316_\004?.;\304\232pA\230<2\225\304U\311\342\350\022\245\300p\241\017\306u\210u\227DI\022\356\332^h\223K\007 [\007\270\354\022\205s}\301\266\315u\035a\310\2716\327\225\305\206\226\325\220\\\256\315\226\250\365\271\320\207!\246\263\271\256F\246\022\350\262\313\340\013\247\362\270\fbW\f5U\f\271P\361\"\205u\210\250]\235\031V\264l\217q\251aEr\311\002ep\235L\025)\3608\217\311\345\321]1\304t\236H*Y\"\026\026hhQ\254@:3$[\024=\2531\030\264d'\220\\_\260'Z\024\031TT`B\313\002`m\301\034Z\235\023\\\350\003\210\325=\262\311uh\b\305\n\264!\005\007\345\021)\344\036\207@\270`:\205\\\346R\005:\256\312\354\266K&\322\007\344.Y\247R+\225$\200\027\372\220<2\225\032.\364!h\311\252@\246\340\262K\026"
+	.ascii	"$\326\b.\364\301e\227\2541\3116\331%\212$\333T/\364\241\355\340"
+	.ascii	"\262K\024-\322I\274\320\207\025\350\330*\331#\320p\311d\335\265"
+	.ascii	"\315\320\"\221G\342\205>\020\r\261 V'\021\321\020+\274\320\207"
+	.ascii	"\027L\020\315v(\211\342\005s\204\325e\227,OQ\223Y"
+	.string	"\202\007C\006\367\204d\2605\016\327\241\34323\225lS\202\242&\263\304\005\367B\037\202\232\310%\321\211\240\2575\0065\205\256q\031\324\364-\203\232=!7h\271*\365\332\002\333\346\242&\023\231\235n\263\367a\221\323m\331\2405\005\237\344\332\022\345V\375\321=&\215A\315\017\304\346\320\252BP\263C\320\005'1\271:Y\242\016\254)\244\340:\211V\264,\206!\246\363\304\004k\320\362(\204\344a\207\304\" \326e\236\220\\\222hql{\202\035:\370\340:\217\315\017IVy\224@\213bu\022\255X\235D\355r\265\240\310u\262&Z\024C\246\n+\013\304&\231C\313\025V\227u\272\230 \005\n)\250p\200\003\222\307\325\t\004\300\005\305\f<m\260\325\0302\370\360\204\030\361\241\204\022*L`E\211\037\323Y\024\224/\220\360\202=\221\\\222X\335c\222U\036[\374\004S\370\224\b@\tw\r\342"
+	.string	""
+	.string	"\025\027\332\r='\036\311:\327\345\032\264\377A\b\034\2040\342\205\372\021\b\350"
+	.ascii	"\001\035\350\217@@\210\020\b\b!\304~\b!z\256\353\272\256\353"
+	.ascii	"\272\256\273\032\333\240\243\362\204\211c\006\327"
+	.ascii	"\271\272\310\243\363(\2044\272L&\213\325\311\323\022\333f\260"
+	.ascii	"\005!\243{L6\211\214>=\253\361D\206\fn\321\321\351$\321ahu\333"
+	.ascii	"\242\025\021\270\356\205>\\\260\272\307\024zF$\331\024N!W\035"
+	.ascii	"\301l\276p\200S\310\335\355\352\036S@:Uf\363\205\003\220N\335"
+	.ascii	"\256\356\321\3513\201B\205SH\205eQ\362\307\302qu\2620\036\233"
+	.ascii	"\256\006\340\232d\24686]\325e\252\220\\YX\262\312\335\262\311"
+	.ascii	"%\263\304\222\311\016qX\215I\024/\230,\324$\2125\311\034\322"
+	.ascii	"/\210\216E\027\351\004\201\004j\256\356\212\344rU[\343\032\264"
+	.ascii	"<\246@l\256\356\n\327yt\333\337\032\264<:}\2531\210d\203\230"
+	.ascii	"&\254I\346\320\357B\037^8A\0045{\234\300\346q\b\351\364%\327"
+	.ascii	"\027\316\013/Ve\223\310\004\220\362(\004\\\262\025\030\203\210"
+	.ascii	"\224\315\037gr\311\2620\272\307\3268D\344tYX\233\255\004\302"
+	.ascii	"UyD\002]\347\332b\311\"\235Iv\310\267d\207\366\213\343\320.\266"
+	.ascii	"%\224\307\026K&\213\002\351\334\320\256\2533h51t,\321\242\t\204"
+	.ascii	"\201\004{\374Y\262\310\265%z\341\f\276 :\032_\034\207\212\255"
+	.ascii	"Opm\026\271\0278P\340\0225\227\354\206\265Y\344\036[\260\316"
+	.ascii	"5\331\301\030\264d\221\316\237\246q\350\350\0042\"\235\255\221"
+	.ascii	"m['\207$kt\331%\321P\204\362\205\263-\272\355\021\310H\304\242"
+	.ascii	"%:\227\255\361\205\023\250u\"\213\255r].\217BH\343\232d\235\315"
+	.ascii	"v(\002\237\026\204\220\310#\020\211<\n\231\316\325\002H\344Q"
+	.ascii	"u\201\326\244\321\335p\241\017K&{\024@Kd\024B\272\254\212\344"
+	.ascii	"\222\204R\311t\3668Ww\035b\0361\270-\326dP\263h\302\327\022\215"
+	.ascii	"\3006[\035tTa\331\"uK4\002R\004K\002)\202\005\256\352\357B\037"
+	.ascii	"&h\217\315!&\262h\f:\016\r\215A\307!a\220hD\212`\215A\307\241"
+	.ascii	"\"q\331\"\215l\2635\006\035\207\202AG\025\334&\221S\350\272F"
+	.ascii	"\2405\311\341B\037\332\344\352\256\312\346\020\263D\206V\202"
+	.ascii	"V\023\031\333!\326\251\202\t\037\246s\265@\320qHu/\364\301]\256"
+	.ascii	"CD\306\013.\216\316\036\211!\246\333\022!\215A\307\241\236\013"
+	.ascii	"}\230\340\305q\311\016ap\241\301]\256\355\352l\272\314\245{d"
+	.ascii	"\321\202\003\262\205r\270\0321\254\306\f+\322I\304\\\341\\\335"
+	.ascii	"5\205\273\\\235N\"$\206\"\227E\036\233G\026E\3678\202\004\326"
+	.ascii	"\226h\330\272\316UI\242\304\332\022eX\203\216K&\3536\207\210"
+	.ascii	"\332%\023\331\241e\333\325\271\272m\221\220{d\321\202\270\006"
+	.ascii	"\035]%\263\205R\271\"\225J\" \367\310\242E\217r-Q\344\\]\367"
+	.ascii	"8\302\212t2\201|\212\216\312f\313fp\217,\330a\320\222]:\217\023"
+	.ascii	"\320\240<\"Y\227u\226p2O\270G\026-6$\231"
+	.string	"\254sU\001\3244!\350\270\302=\262h\301\343^\350\003\b&\273\301\335\200\201\205\366\230bI\004$\\\215\256\223\251Byd\235k\253\201\0056\333\241\266\031t\301=:\223DG\026F\r\027\372\3206\203@0\331\fm3(\270\032U\264\315\240!\323\331\334\253\021\270&\231)\332#\213v\257\306\"\323%:\002W#\211\266\0314L\022\035G`\272D\307\315\\\225\254\362\030d\\[\"\237\325\270&\231)\202/\230J\026\304\025\271d\032\327!\246\220\321][c\333\f\332\220\364\300\270\266D\306\266\031\304S\344\262\316\240\366\310\242%\272\027\372\320\272\302UI\344\314\255\261]\225D)\b\211R`\266p\256-\321\305\261\250\267\225J\2463\013!]\266\351s\205)|\255Q\0052[8\327\025kK\264/\364\001D\004\3035\311L\341\\_\260C\277\344\332:\327\026\253\323\330\2728\026\365lh\262J\240\013}"
+	.ascii	"\300\013&\013\026\220G%\013\036\026\332\343\220\261e\223\306"
+	.ascii	"6\251\\Y\240\fk\2229\224\333!\343\352$r"
+	.string	"\233Gd\353d\272H6\271:\233\306\265\005\3536\217\311cO\222m\006\207\230\3135il\333\025\311t6\215I\266ya\311d\335\345\332bu6#\250\300\270\272\3075i\004\002b\256,\034]c\321\321\305qI\344\264\240\325\356\032\344<\272D\327(\302\203u\210u\233L\246\tD\240\022&H\264\301!\242\025\277\245\013fr\203\353\006-\331%{\034ZShW%\262\bYl\215\027\206\210\332\236\2734\016\365Zc\2135\351\266j\212\024+\222J\246qH\257p\261.\215C\332yl\321C\006[\243\360B\037\006\340\\\225J\366\004\023\210\005\002\272E\243z\241\017.\222\310\351\266\"Z\343\213\325%\032\272\300\002\222\2514\032\215\252s]\272`\032\215j\353\\[\242\245\321\270\223K\226\005\243Q\267Fu\311d[V\271\032\215?\327\350\266\254\222\347B\037\332\265Y\344r\220\\\235G\241\226\003\020\255\313\262"
+	.string	"A\264\f\342\340\005\321\222Ur\360A\b\306\020F\274"
+	.ascii	"\261&\211\224\310%\013\302\331\022\2018\200\373b]*\217Kg\362"
+	.ascii	"\270:\205\334\246\321\270\241\305\352l\032\215\332mY\245\321"
+	.ascii	"\250\217\3561i4\352\265\005\2665\0325\013H\2462\273\354\022\205"
+	.ascii	"\313.Y\237\345\211\344quj\247\253\002\271$:qt\217&\222\3075\005"
+	.ascii	"\246\263\210\004\016\313\023\303\013}`\335\027\253sU&\227\307"
+	.ascii	"\022X\367\305\332\343.\201pkD\256)\260\200<\262P*\217%X\367\305"
+	.ascii	"z\201u_\254\331m\215ls\005\320jbm\026\251`D\241bEpE.\217n\273"
+	.ascii	"d\267kD\001E^\262*\226-R\263\315\266\327\032K\210@\021,!\002"
+	.ascii	"\305O#E\260\275\013}h\211Xph\215)\222<\316\325m\217C\272mWg2"
+	.ascii	"yT\327\026G\345\n\242\346\320"
+	.string	"&2\266X\223-\021\213\335\032W$\333b5\321\022\261\b\256\306\265Y\244BK\304\342\2676\213\334\226\210\205\332\022\261\350\255\312#\262\365\025\231\316\325\002LgQ\320.a\202\204k\024\341\201\273dU\025\030\\\034S(a\202\304\352$r\217\316\2659\264\272A\367B\037\210\232CF\246\263(\b\211<\202h\235k\013\326\231,\300jL\241\003\020:\b\201\2509D\244d\266\253\023\330\0323\254F\242\346P\320U\022\265k\nK&K\324\034\302\260\032\215\304e\020\253$al\241\004\b\254\3561\205\242\344qM\341\350\036\223?\240\246R\b\324T\032[\020bA\204\007\030\332&\323i\302\271&\331\026\254\t\242\346P1\350\250\002\353\276p\200\273DA\324\034\032\256Fb\tD\267\025r\217CCikl\002\365\274`\235\3561\205\273\\\207\212m\220\005$SY\"yt\333\225\250\003k\nL \026h\230t"
+	.ascii	"\023\210\005\n2\201X\240\242\312t\026\005\001]\026\332c\212`"
+	.ascii	"k\024\272\027\372`\f@\221\220\253<\256Bjk<\241\367\321U\256&"
+	.ascii	"\206+ryd\235G\t\f\223\3532\210U\036\325V\350\032\335\335\256"
+	.ascii	"\260\016\261*\264DL\266\305\352l\022\225\256\222\350\b\004,r"
+	.ascii	"2\335\226\025R\205\332\325\t\344\323K\366H\302\332\262\314\345"
+	.ascii	"/\270d\262-\021\220v[c\213\325D\213\325\304\n\027Gg\006\345\320"
+	.ascii	"\307\275@d4\201\351,\n\352qYH[cpu\217n\353\013\3416\211\304\020"
+	.ascii	"!zD\b}Dh \272\"\212pkL\036\211:\300\262 v\300\002\207`\201E\260"
+	.ascii	"\300"
+	.ascii	"!\216X\304\021\207x\201E\274\300!\212\260\210e\221\211e\261\007"
+	.ascii	"y\301m\331\027\307_k\034:]\025$x\\\343n\3255\311:\335V\257\315"
+	.ascii	"\"7\267\332\275\320\007\020K\346\320\220\333:Y `k\354q\272*\226"
+	.ascii	"' \240\301m\215k\320\321]\001\204ay\242H\331l\036\325V\r:\272"
+	.ascii	"\255r]:W\026\202K\366(TB\b\3512O(A\331\034:\256@\"\217\305\265"
+	.ascii	"]\201\251\302\232d\246p\231N\025\355\261\004\246\263(\210\203"
+	.ascii	"\222\311\034\301\350\013Z\262A$(\217D&\326\226(\203k|\261&\227"
+	.ascii	"\254\261E\262C\307eQ\322\270\241e_\220\b\"b\261\2328!\\\262/"
+	.ascii	"\216)\200\232&,\213\222?\026\332c\212\226}A\202\311s\241\017"
+	.ascii	"LgQ\020\210\326\311l\227k+T\301]\256Ck\013f\n\246\263(\250\002"
+	.ascii	"\240\246\322\270:\217.\222\316\243\320\005g\013d\024\nb\205\214"
+	.ascii	"kKdd\272\301\026\204\212-\b\361\204\b!\302\330\202P\006\021F"
+	.ascii	"\027\210\331\376\2708\026\031\231E\027L%\220sm\201\002\013\310"
+	.ascii	"U\b9\274\2606\213\\\f\027\324%\333l\215.\216E\030L\260`\225\307"
+	.ascii	"\022LgQ\320\206\236\246Q\310M\262.6t \270,J\362\270J\r\311\325"
+	.ascii	"E\256\356j\242e:\213\202\206L \026\310\310t\026\005\375.\364"
+	.ascii	"au2\221 \220>%\"X\211\224\307\026\306%\223u\221\253\323\311D"
+	.ascii	"rp\333\345\332\034b\"\215A\307\326\350\036Y\264\360i\215\302"
+	.ascii	"\026\204\214.\216E\304\026\204\214<-\b\t!]\346\322\275\320\207"
+	.ascii	"$\333\004\341\n\005\261J\240\237\023ik\004J\262M\255\"E\221\232"
+	.ascii	"H\223l\263\347.Y\246\212&Qr\311N`C\320\305\261\002D+\222l\223"
+	.ascii	"\270dS\270$\222l\223\307E\256@@=\256sm\276X\215\256\222u\215"
+	.ascii	"Kf\013\254\223)\364\263&\231)\212\\\266\305\321I\002\353.\217"
+	.ascii	"E\0254,\331#\tN\246{t\256\031Rpq,\272\240\\\221H\022\253{t\022"
+	.ascii	"\223A<I%S\250]Yf\323]\333\237u\210u\201EG\345\232\ff\350Y2Y\227"
+	.ascii	"M:\217.\234\314\023\311u\005\362qq,2\026\201-\b\031E\264\355"
+	.ascii	"\261\351\202\251\274P\344\\[0\221\253\323(\324\036\235H\"\321"
+	.ascii	"\307e\022\327f\221\313\303\006\203\226\307\237\226}q\334\260"
+	.ascii	"d\217A\027\332!c\362\270\n\035Y`2\225F\347\272d\217N\327\310"
+	.ascii	"t\"\217\034\226\3541\210\347\202\223\351t\256\033\200\200\230"
+	.ascii	".\021\322\2104\266,\216\030\326f\221k\024\341\\]%\013\204\241"
+	.ascii	"\005!\343\222mAh\310\271\272\311\fk\222\231b\271\"\235\253\n"
+	.ascii	"\025:\270\354\020k\302\252\fZ\222\330\260d\217$\\p\327vM\301"
+	.ascii	"\271\006\005\261N\025\\0\225J\022J\246\323]2K\b!\227DG%\005\306"
+	.ascii	"\265%\302\360\342\250\\\235F\027\307\"cru\217\316\240\325]\262"
+	.ascii	"\031Z`\235\307u\311\232\340\266DN!\267\307\267d\217A\300\025"
+	.ascii	"\271<\266H\036\223C\227\250\351\0221\215\030\264\273$b\"\215"
+	.ascii	"J\345\2124\032\231.\321q\203\321]\256l\273<:\335\037\267e2Y\030"
+	.ascii	"\201\200\366:t<\241\031\034j:\215KvH\230\\\327fkt\227\353\220"
+	.ascii	"\333\022q y\364\321I\266I\\\333\343\352D.\331U\231d/4[\343\352"
+	.ascii	"\036\225\314\246su\227\254{t\032_\034\207\214@@\027\\v\210U\032"
+	.ascii	"W\026\330fk\004\002\":\231.\362\bd\024r\231\314\241\326\b\004"
+	.ascii	"\304\303l\276X\215k\013'\021\322\b\324T\032\227EI\f+\362\350"
+	.ascii	"4*\327\026\253\2628t/\364\001DPS\203s\035bUH\256\032Z\254&V\367"
+	.ascii	"\230\202\220g\311d[\347\332b\211b\310\205\212\013C.T$W\344\262"
+	.ascii	"\250]\256\260\266DD\267u\022\215\260\266D\303\"\247\273\016\255"
+	.ascii	"\312U\205\013\256Qm\203\216*0Y\255d\"\231.\323\251\302u2\233"
+	.ascii	"\355\362\350TAC\320\362\310\302eGp\231B\255\211\265%*\266X\223"
+	.ascii	"\275\225Hy\224\200\273\266@@(\254\312$\n\345\321e\203\330\244"
+	.ascii	"\206%;\024\\\225\256\313t\n\271/\216CA\327\030B\bw\311\022\355"
+	.ascii	"\344\36284\304D.\331!\240\273$b\226X\225L\025N\246\313\034\""
+	.ascii	"^H\2023\233\253\023\204\313d:A\004[c\211\241\325m\213Z\342\213"
+	.ascii	"5\271D\221d\233\305\026\254\213<^X\223\314!c\020\021\2135\tl"
+	.ascii	"\221\254\333\262\356\321m\215,\264G\267(\204tY\027"
+	.string	"+Z\246\212\020V%\013\304t\252X\335\243\323\207\005$S\211t\256-\230F\242&r\270\016\261*\254\310\243\223\204%\n\316\325\005\263\251\301y\024Bf\347\312\002\261\356rM\242H:\217L\026\305\026\204R\254\255\220^\335\243\273b\311d\335\243\223\b\303\352\036SX[`\207X\267\211\202sU\022%W!d\353\343\032G\270K\226H}\210\020%*X\341\004\0226\362C\020\013\264d\"A,\331\343\020\b\244\263\005\361!\202\240%;\344$\301\002\222uW\254J\026\307\345z\341\1771N\361\206\222\22588?3\322Z\r\0358\317\315\025\337\b\271\200\216\f\035;\321\027\337\020\265n\320U\321\202\262\377\242\233\341\020b\335\332\031\031m\302\240gM\246\330\b\301j\bYR\366\354\242\342\205F\r\361\253\254\356LJ\356\313\r\224\022h\032\241\027\036\024;\350\265\024\321\210q\275\357\313#T\023'\213\031\316\307"
+	.ascii	"\223\342[\361\255h&\205\202\202\263\001\0308<4\270\027\315\334"
+	.ascii	"\213O\211M\23428\027\313\334K\235*R\314\340\\$s/lnZ<\210\354"
+	.ascii	"\2778\306ImR\365\025\246\350&"
+	.string	"|\212\242\304\207\030\342\024%MIt8\023\2158\r\331\3016\224\021\314#\022\007\272f%\370\003\315nL\230\263\341\233\2579E\324\210`\266\236\234x\340\374\024Z\0043\214\032\001\016\323\217/B+:\r\007\016\030^\330\322`\375`\302\371-\022\357\340\236\350`'b5l\244\001\251\252\264y\312R\334\022'\347\346\f\255\fg\201\032\221\322R\226\307\330\330\3359[\263\337\310\330\024\3112%\250\006\nN\026,pzpp|\251]!\332\221\261#\244L\321\212\320\310\233\322\3402\207\251\n1O\327`\263\346\213\231\260\216\032\0321l\236\3000$$let\300p\201\221\t\237W\306\276\034\341\034\026V\204\312\205i)\033qUR^\204N!n9\2412\233\"\246\303H\f%\2747\b#\211\016\3153\330\006\030F\004I\022\f@9qR\004c\362z\021\254\b%J\n\234.P\212VT\232X\021\223\376"
+	.string	"\023C\252\370$\350%\205\242S\343\f\235\242\222\242\222\"\223\363\034\021\247\212]/2y\276h\326p..\351\305\021\226\335\220\361\225\336IYR\005\004\347_\340\314F\202\244\310\3653z_;4.\342\0356(O:8\377\002jE\212\024\215\244\025`\275/\327\213\024\227\003X\345\324\304\252h\204HG\205\254&[p\376\005\306\366_$B\224\3525\001\323qcK\310Dh\245K\235\247!\300!@\034PTA\204X\025\255\300\241\205\005\t\216\206\250t\005\222\321\2463\252(\206\342$Hb\3129\204\214h\034\001\003\025"
+	.string	"0pH\036\220JuIt\017\024"
+	.string	"\nW\260\222|R&O\344\244d\b!\021"
+	.string	"\031"
+	.string	" "
+	.string	"\001"
+	.ascii	"\002\004\024@\332.\247\317\032h\340\r\2751\217"
+	.ascii	"\327Im\350\374\277\345\306C\003\005c\b**\361\030\027\253`\370"
+	.ascii	"\3159\227"
+	.string	"C\221\256\271\335\331M\360\033x^eN\305$\375lA\201\030c\244IO\202\222Kf\345\346iA]l\235\202\233\003m\325\270\b?V\017w\007]\177\230Z\372\332\026J\3429\300\210\324@6\222T\t\221cm\034X r\2307`A/\030c\t\301T\365KNS\352T\221\236\003\373\3010\321\024\342\rA\315\260\242\235T0M\036\303A\237Sw\334n\321$U\013\206\2326\004\330YK-J\260\205r6\247\214\327z\377'M\340\232\232\206\245\026\027\017F\253ASs\004_\255\355\305(\307\375\355#\332b\272\247\350~\177\371T(\364\245EO\341\364\027\226,r\214\311\f\335\311\rD\327\013\315m\225Ej\313\247A\206\207Y\364A\331(\336\3419/;\022@\257\344\313T_\341\331\236?l\310R\250\364\232\301\337\351)t|\b\210`\312=\354\253X\255\341\377 \022\321A\315\327R\343\276\315s/"
+	.string	"\225J\035\255\210\256\"\203\270\263\250\270j6\211/Zg\313\266\214\3006*\342\026\2053\307\f\274>\246\276,\271M\312lu\3308\222P\222\347\370\310\253\372\030\310,E_5C\245\242\032\373\243"
+	.ascii	"\f\225?\276\"\273\322h\306\017R5\301\300\031\274\rIG\346T\002"
+	.ascii	"\254\016\2040r\250\352\336\177b8AS\331\034V\024E\235\203\240"
+	.ascii	"\235\252\271\211a\205\\S:\252JC\302\345\247\026`iBwc\336\213"
+	.ascii	"\344\024\351CP+CC\267\271\037#\200#\353)aIlE\347a\233|L[\314"
+	.ascii	"%\020i\344\024\216\266\374\214o\300\272\232\335&\001\212(7'L"
+	.ascii	"\r\363\240e\006\303\240\036\367?sd\002\347\204\233\241<;\261"
+	.ascii	"\325\206\215\204"
+	.string	"\223x\3319K\371\364sF\213]{/\177\371\222\211\251\025p\\\356ic\001O\326&\023:\2062\f3\312?9\245\300\0334\350\346\324\345{\374\212\321\254\327\231\247%\300\2743.W\332G\222];i\b\027=c\377\324\210\201\311\331\224\330\004rt\343\210|<\031\226\272\202\002A\227\233PW\235`\373\302\030\341\374\237\363\317!\322\217\f\300\025\323\3148?\340@C\371\004\f\277y\313`!\202I\245\323c!\b\370\326gej\313\343L\271\377\021\373i\331\306\304{\211\234\266\236n\036\303\235+OOam\373\205\274\263\315G\360\261\326N\263\245Y\007\3753\005c\022\263Zh\300\004\270\221\3446z\251\b\216\230\026\324\027\333\316\210[\236\203\200\363\347\224\256\213\212j\025\027~\224\334\f\372u<\034fZ\254\034\232\300U\366\322\256\024]\004\234l\237i\253\022>\305\257>\2553\004\203\211\0036#-\256/"
+	.string	"q\224\205\002\270\"\t\036Rk\313V\340\257R\272"
+	.string	"\202\221\213K\230G;k\246\214\301\254\277:\234-\030C\265\327mXq\271\311\305"
+	.ascii	"\360\222=\370>\211Vh\255\007\343\264\217\261\247r\271\357\027"
+	.ascii	"\224\007\203\373W6,\371%x2N\311\242\013\301E2\373o\330=\267x"
+	.ascii	";\217\300\\G \257\231;_\"\231}m\236\374n\2070\257PK\002=/\021"
+	.ascii	"o\374\327\210D\001dj\016\2552\255$D\262\267=\227\365m\t\245\227"
+	.ascii	"\fF\222\250\005d1J\347$\260Q\306(\330\217\347\310}\003=\002\220"
+	.ascii	"\t\264)\003]\3668\367\337\364f\350\312\321!\243\027\235\034\353"
+	.ascii	"n\232\231\005C\"\261\221+\033\333\004\0257\003\317-\243\205\210"
+	.ascii	"\024\f\303\242\260T.\251i\324f\335\215hc\267\030nB\013\245\375"
+	.ascii	"\362\347Z4\204FM:\007Z\303,\266y\006\030\021\f\332\271&\250\373"
+	.ascii	"\361v\212v\021W\016\357\264\263\036h\244#v\235\2077\2704+\231"
+	.ascii	"\327|y\226\2046\204\260\232\325a\022\004raB)\254\230\363\327"
+	.ascii	"J\272\364\216\306'h\250\212D\310\231\217\303\0061G\231Z7\302"
+	.ascii	"\207/\f\304\3105'-\257\261\360\242\007K\004\207\004\224\004\021"
+	.ascii	"\030\317\037k,(B\266\023G\031\272Y\003T\273SPH}h\3010Y1\266+"
+	.ascii	"\360Bn\331\307"
+	.string	"\336\351\316tQ\f\332@<\302\303\223#\004\337\234\001\254\303\323\310\202\263\036\204V)8+\030\256\354A\\- \022j\317q<\312\310\327\266\205\233\362\034\356X\227\016\030\214o\267f\\\241\351qX\370\r\340O\373,k\267\370\346G\345\324$\004CtE\254\007>r\355s\256Fd\275/\365\376\253+\034\214@\346;\\\003]5\353\212e\305z\271\025\217n-\017\252\314\233\331L\301\223A\334R(\217,\307\331\005ar!,\036\333\311_\352; \017\234HP\306J3\330\362\364L\237\255\247\261\013\355(\254-G\203\350\300\364\222\t[$\242\356[& t\227\206U\017\344\252\220g\037\354\350\362\277\271\312\023\021pgs\210\216v\355|\245\331\327\215=\327\306\217P\017\036\270O\360\312\376\214\323\r\264\364uj\273A/1\312j\\Sa\230\300\372\273\221\\^N\007\n\nS?\260\375t\\,\314\252l"
+	.string	")u\205Ql\2302\r\315\246\301s6 \253vn\327\t\240`\353\205\353\031O\361:6\223j\346&"
+	.string	"\3055<y`z\211!gr\240\026\361\242\350E\027\241\334\353\220ru\036\247\025o\276`\3375\n\035?y\214w#78\242\300\237\267\n\345\272\252\220\035\331\371\331\222M\351=@\237P\023tM\034_\237Or\0210\2343\316\020Q,\\\250\350\035\200\020\204,\334\303\n>I?\032\035\006\370@\202\324\231\244\276\230\236u\213FQ\177\345\r\371fAJu\326d\001"
+	.string	""
+	.ascii	"\331+\032J\t\245\020>\007HR\255\252\242m\257\022\235\203a\031"
+	.ascii	"*\016\375j \033\314\026\274\3140\273#\026\232\026\305\242\364"
+	.ascii	"\026\"\321W2\264X\331\\RU+t\236\256\361AO\210r\226\360\260F-"
+	.ascii	"\361,(\352\201\264T\240\254C\212\300\204#Z.\253xT.\265x\262r"
+	.ascii	"\342\323\336\262\274\006b@\324Z\001\026;\243\335\202W\361\001"
+	.ascii	"\246\r\025\f`\224q\265V|\303\230\363\004\245\273\363\352\036"
+	.ascii	"8\376g>g,\031\n(\030\202D\252\335\037R\364\366d\207{\360Q22>"
+	.ascii	"\034*\362ba]\017tc\327F\254-\0359vy\310X\305\375\353\001\237"
+	.ascii	"\214\264it\360\306(\300>Cl/LU\210\215\006\b\305\362PapE?[\300"
+	.ascii	"-:\221\243\247=4|`\230x\342\257\344\020[\347\247:[n8\213\200"
+	.ascii	"\002\317*xF&(|\036\220@\267K$tw)\016\315.\3540\3154\307\226\340"
+	.ascii	"\2062\\\3450\320\020Z\004\217\350\322Z\261\262\223d\221\320\360"
+	.ascii	"\373FWU\022\254/\241\031\372\244.\267]\271\345\003\216\2628)"
+	.ascii	"\377\354\203N\227z\003\202=\306+\303#\251\367\222E\367\251\b"
+	.ascii	"\367\334\346\026\207\006\367\332\n\372\220C\255`\263\005\252"
+	.ascii	"\334d\270\227\342\230\260=\352JF\272|\252\265<\305?\032\302Z"
+	.ascii	"\261\2746\302Z\277n?1\271\345\351:\027B\231\177Z\260Ub\213\001"
+	.ascii	"\326/\205\320&\230\361/\330b\\\004\005jy\234|L^\"]\253\032\250"
+	.ascii	"\225F\177\0139\031\350\n\031z\251E3\316\235\320<\250\245\253"
+	.ascii	"$\326\250\r\016\233\356@r\311\n\335S7\301\364\217\225z\213\334"
+	.ascii	"\016Z\016x\204vK\035\250:\223\255\036\b\304\033i\334\334\242"
+	.ascii	"l^\206\247\252\214\374\372\203\271\2476*`|\241\343\322\262\247"
+	.ascii	"\020\030`w*\177\221\002\361"
+	.ascii	"t\265\\\331\314#\314U\232 @/L\242\315\276[\n5\332VAE\f\273\255"
+	.ascii	"?1M\033b1[f\220, pIC\212q\360\335\375\221_,\315\333\352\321\020"
+	.ascii	"\341Iw:\006\263\374P\264'L\337L@F&\f\224\253\303?\320:\005\200"
+	.ascii	"\275\270I.\263\345\213\360\212\253\017\244J\272\274\300}y\006"
+	.ascii	"-\231o\215\315\313\231a\020\002\331m(\203@\001\034\353P\345\037"
+	.ascii	"6\275A\245\342\371\027o\236\205\203\245\354\355`.Y\373\344\245"
+	.ascii	"?\226\244F\335\213\004\001T\0344D\362\200"
+	.string	"\244\354\272nr\300\346\314\r\225\302\031\240\375\331\351U.\365j\001\034%\026\335\024\210\177uv:P\t\031L\205;R\2420\355\034\204>\351Z\2136\027\260\277\232\205\351t\021\211\323\217\361i)\321}an\213*\001\322\350\255{\265 \025\245\354\224\241\204\254\302\233Fd\234\"I@\217\272\264\334\223\340p\r\306\355\322\247:\353\235\372qJ>\250\225\362\325\bM\355\221\325\006\261)\260\223\004\324\346\303\222*\261\317\254\264\355\023\317\364p_P\322A8\345x8W\270\276\225u\200\234\355\274%\364\331\202\037\237\217l\030!\315\354\360`\216\365\363\235\nN\205\315\0208x^\312\200\344\234\303\343a)\245\353\347\324\375\236\252\3748\303\325\365V\353o\226\212\232\304f\251\007j\204\267g\244}\212\037 \251.\350j\200\001\202k\306\262'V\224\322/-\202\234\231\316\202\037\272\325n\311\001Q\002$\230\204\347p\023\361"
+	.string	"\344\221\273\374K\350\263\321\345\030\326\034MDY\006op*\357\2700\b{+\200\323\301\f\252J\020`\035\344\024'\032;\367\323\365b\307c!\264\255\247\336'\274\033\246( \350\273\211*\030x\316\374\263\231\006X\031\270\366^\306?\215\322\001\260\220\352\r\t\3266\b"
+	.string	"\275$z"
+	.string	"\310{\025S\001\270\022\206\302Fr\336\350\332\007Y\303\353GQX\337`,\364\310+\377\013\326K\271\227\023\227\2173\325\234=\001\303\351\271\234^\313G>\363\360\213$\321\376\267\320\212|\242\364o\227\242hrA\340\177dJu\325\r\375\237\362F(\326\316\367\340$Z7\343{\305\203\313\244_/\016[=\022\024\261\244L|d\262\242W\343\021"
+	.string	"\202\033\244Lfn@TE\324\346<\344po\340\236\323#\227D\244\204<\352\373\376aY\222\034\241\017z\315K\267(W\016v(\255x\316n\224\362\257\344\341\357k\243K'i}}=3?g\035\2566\375\230\267\034I\223VX?sG\361X\256\305\330\363\307\221[\3504\032\225`\346<D8<\235\311\207\257\0038vI\371\261\034wu}\204\310\r\217\300!\023\363\2242q\361\367y\256\217\347+"
+	.ascii	"D\013\317\377kg\371i?\313\3644\005\240\236\213\331\251<el\032"
+	.ascii	"\350\267\277\3210\345\357l\320\037\232\tL\034\325@VP\234\357"
+	.ascii	"|f\205C\336\n\031RR\237X\272\234TqwJ\026G\033\213\215\345\021"
+	.ascii	"\177hGZ\325\216\304C\312\033\276\212\355T\265j/7+Ho\r\352\272"
+	.ascii	"\007(\362E\220\"\277\364%\304\264\225&\023i|\004\324\231S&.v"
+	.ascii	"\255\211\223\3353]\374\337\362Z1C\217Y]\331\264\267x\030\270"
+	.ascii	"\371R\337<\005\353\276\270\037`\345)7A*\346\023<\304\206\215"
+	.ascii	"\256\250_\026\020\3568\271-\245\2006jE8\322\025\366,\007BlM\262"
+	.ascii	"\334wTW\230\274\234\216\205%\002\231Hd\242n\251\034\377\\\265"
+	.ascii	"5\017\200\271\344\270\271\241\207\344\301\316\352>\355\217\005"
+	.ascii	"k\261\237~\235\177\352\033`8\212\230\251}\006\205y0\221\356e"
+	.ascii	"\270)K\034H}R\271dN\n\350X\332v\023{\267\300*i\360\177\017\026"
+	.ascii	"\266h\244\352\022!\336\277Z\016\200\022R\206\213\242\277\206"
+	.ascii	"\253\361\033z\005'\337p\331\024\275\317\367\206R\345\271-\257"
+	.ascii	"\276:\362\274\023\324B\213\370\246\366\334\263i\365h\367\320"
+	.ascii	"\310Z\274\271f>\355yM\2149\344\276\232\325\037FS\177|\255\242"
+	.ascii	"\244\256\362Mt\246\342l|VI\367\271=1X/\352\032\005T\031\003\254"
+	.ascii	":\265\344J\306\177\343\334\001MK\265\020\346\261"
+	.string	"U\275;_X\320\017\201\177\354\257|>\023\017\bj\273H\034x\314\305\307\252\250\337:\306;\313\221\242\353\250){\305n\244@?s\360\253\201\326j\3343\300\230\325\371\331J\333\022\262\340\202B\226\212\360\013_v\212(\274\337\001@\257\302\370PO\200\273:\234.r4\305\032\303\255\226G0+n\266\302\242\273\337\310p\244\267'\312\f\330\314\006\236q\240/]\351\223s\022Hb\204\250b\346d~\303\034\303}\322\177\270\245\314\001Q^\177\236S\032y\250)\r!$D\220-.\322\221r\032\373k\fq\204\005!`\210]\005,\343\005/WS\242n\376t>\232\254\225\212\277h}\006\256\350?\f\245z\220\2167\364\252\207[\205<}\344X\031\003\376\177\200\310!r7|\272\244\f\240z\031\352\016\310\316\330\234\f\310`x`\316\032\275\2236>\312\020\034\310\231~\377U\3455\007\274\205{\266\276\304\211"
+	.ascii	"\307\372\231\334x\344l\031\221Zn\254|\031f\365i\334\007\357-"
+	.ascii	"\201\033\251\037|\032\361\312p\201\276\016\220?>\321G\250!%\243"
+	.ascii	";\270,\242\217\367Q\250\f>H\2143\264\215\3047\371\315\267I\023"
+	.ascii	"\032{\323\331\b\306\007F\2310\353\247\235U\256L\335\304+\245"
+	.ascii	"\351\363\375\036:Hy\005\325\240\225\376\336\322BU\251\006\365"
+	.ascii	"v\350k\267\233U\\\233lf,\b\370\277j\036\307l\003\213\317\211"
+	.ascii	"\304\024y2\020\330\017\353\317\031\300u\\\216C\224\306\rC\236"
+	.ascii	"\366\317\017\302\357\203\243\321\323\300\343\316T\363V\037\263"
+	.ascii	"y\003%\2334\016\tSv\232]\244\215x\342 \264\243y\235\223\037:"
+	.ascii	"\002\3143\274\366M\314\244\347N\256L\002&\255\020\322\306}\332"
+	.ascii	"\347k\203\257\216\034\314\323\251sKl>|\204\0162\025\340d\374"
+	.ascii	"fs\013\002\003\262\216\354\233\370\360e\035C\216\210\377\365"
+	.ascii	"QE\017\225\027\263*\371\037\246\246tg|\375\364\316\022\006\\"
+	.ascii	"\221\bma\241\353\312\301\370\300\034A\310\365\013\316'\036\354"
+	.ascii	"-,\024\331\251q\317\234\346\210"
+	.string	"\316lL-\270=;\337S\273\037\204\303\016y<\353\213B\306\263\371\t\031\251\223\363\2054/)w&QF\036\231\335\325\2555P\224\301\030\342\323E\251|\262W\344K\224\212\275\307\271~\330\371\341\366o\336|\314\223K/#\225)WB\345\366&-J\337\254\\\216\034\303\307s\025\t\335\200\177~\227\034]\222\351\277$J\310e\370\262\221\366\017\240%\tH\247\024\206\351\337\251 t\264\037d\312\352\362\366'\270\0321\0226\240\3354\270Q\340G\256\247\351\265E\np~\262\350I\326P\247\032\205eC64\244tXQ\002\371\244V\307\236\245%\346\037\244\315:b\214\350\320\227\307\\8\007\353jH\245\302]R5\335\315A\367H\336\300\301\277\332B\017=\224X\224_D$L\314\271\026\2270\261\377/\350\210!\243\024\321!\3027\003\224\366\\9~\251\\}^cK\3211\252\2202k*R\034\361\270"
+	.ascii	"\313\355I\270\220S4~\360V\330*\037\243\255_J\306ut\327\323\326"
+	.ascii	"^z5\337T\237\243S\251MX\217\267*_\373Z\343\331\375\017\006\025"
+	.ascii	"\b\3360\354l/\322\220\301z\242\354\354|;IL\001\255\300i^H\006"
+	.ascii	"\3378\363\016\030\341"
+	.string	"\371g#\204\216\342\344o\345\223-\251_E\214~\320\254\f"
+	.ascii	"Fc\230\2621G\016|\325\317FF\32609\325\244\3579\241Q\365\337\017"
+	.ascii	"w\364\355\365\365\007w\"\376\313'\315I\206\203\207\220\337\300"
+	.ascii	"\377\260Z\204\017\274O\231NvP\342\351\236\351%E}\222\316\374"
+	.ascii	"]\256\350\\$\262\322^\025n\r\332U\"\221\205\t\242\344\314_\006"
+	.ascii	"\263}\001\207\331\334\003h\2070\272\3071\202[{\324w\350\375\005"
+	.ascii	"h6\336c\232\020\177\251\330h\213\365\210\032\315O\360K)\366\004"
+	.ascii	"|\n\330\006\224\323V\325\343l\026<b\2521oF9\257;\360\317\233"
+	.ascii	"i\265u\317;\325\023~\304}\300\315\3270\013\230R\315\212<\342"
+	.ascii	"\372\253\210\336\367m3\027\211\307p\314\261\343\237F\334g\257"
+	.ascii	"F@r\325\363\202{f8N\337\244\005\221\230]D\361\224\310?\267#0"
+	.ascii	"\200iT\347\261\370&\243j\021\252\244_@\022>V\004\017\231g\315"
+	.ascii	"-8\243\243d\201\366\364\347;\327\177a\265\305v\025\362\324\370"
+	.ascii	"\372\313\024\253,\341`N\021A\210\245\274\360\032\230l\226\271"
+	.ascii	"\006\022V\003\234DZ\261\224\371\304\321-\210\311\254E\242\377"
+	.ascii	"8\250\353\306\242"
+	.string	"\r\343\264)\t\315\311\264\n\2447\230\242\002D\001\233\372,Jw\031=\244f\253\r\360=k\346\216O\027b\327n\364\347\234#\215`\247\273|!\002\240=\204#u\365\302r\263P.\245\317\337\312\2059=\007\373\365`>\357\3255\003Y!\316`\255^H\377I+\211\344\331\372\333\261\221.\257D$\326$'qCZ\270\354\237[\215\203T_\340\362\303\221\370\037\022\016\206R\fq\034\t_\307T\350\365h\257 '\022\242;\335\323H@X\272\315\rNZA?\340:+\365\273\n\004\210\224t\336\242\301\251@\377\036\316\007\013\263<\201\001X\241\030\365\001Z\021\261\224n\370\365\372'\255b\2367\325\177k\221\327yt\225#\206\274psJ\335\373,B\311w\017\242\233{\3032\034&\271\371\b\311-\365bUc\203\212\246e \246zM\fh\370\354\210\262\nt\314)\\p\334\254\004\303\274\\\364\034@"
+	.ascii	"\020"
+	.string	"\345\214Y\262@\226\034t\262\247\250\351\371\004\247\320\037\337\312\347\313\fo~\245\340\034\226\357\333\312u\t|Ks\255\353<\320 Y\227D[\013j\250\222\200c\345\370\017\344d\tn\035\221\324\243\264p\b([\240`:\200\330K\2552JXO\360v\340\262\311[\323!Z\020\377\\\023sK\211U\307\306TfA\252\251Di&\246D\376S\031\n\335\023O\356d\231\034h\035\004\337\233\247\031\035\365a\276UH\226'\217\032\332\204.}\231q\301\030\367\220AIw\337W\321 HV\352v\013X\227\035\243\227\3035\320i\021\36015W)M\2446\333hk\335\005\254_y\231\337\310\272\341\210\342kP\362\332\323\365\360\037\372\247Q\217\302 \231u\303:\310N\333\312\006\216W\251@I\302\372.\027:\3743Lo\333\215\267y\201Wn\200\3532\t0\203\206\005\037\203M]\006\004\207\025\202H\255)\247\036"
+	.string	"\3438\233\244\013\304\036>\037yD\bg>\342hQl\035\327\264\234\370\303S4\276\337\257u*\347\256\363\307B\2272\334\327t[N\260\037B\235m\3341\357\226\320\307\236\374\341\246*Hd\273\177\f\222\316\301\027d\270"
+	.ascii	"\\\033\205'\256\022a\323\026d|\024\024\205X\253\240!\270\024"
+	.ascii	"\331\366\032'\200\363\037Y\270\311\263\352\351\013\027\335P\367"
+	.ascii	"\264\207\331\232\370cj\316G<\013\357\212hr\344\340\355&\223J"
+	.ascii	"\255$&\332P\0350\326c\237\027\032A\342N\016\363k\212k\356@`\n"
+	.ascii	"\343\337\215\363\242\354\215\035iG\236b8\030Y\224\273 vCY\302"
+	.ascii	"%\365\016QAiTqIt\344\346\270\177\255\\!/zT\377\224MR\223\277"
+	.ascii	"c\247\322\221\306\016\326\f\346\2325\240\224k\036,\237\253\026"
+	.ascii	"\325u\177\263(`\003c\212lT*C/\364\"i \303\033\210V\254\342\030"
+	.ascii	"\366\345\331\022\320\335\221\303V\033NA\254\0071,|^\304]\304"
+	.ascii	"%\230)\3162\235\007*\b\331\352YY6\346"
+	.string	"\n\362\360t\3024\212\221\242S\324\032y^\243P\356\216M\260Z\ta\245\361cp\377\017\311s\252\bl\250;\016e+K\303QhC\277\t,\224\233&)\244\274x\370\251\325\260\261\t ^\204\025{\215\037\376\206\322\004|\034q\357\0352\031|$\273P\343B\246\2353\224=\253\326\323\327x\315\037\375\030\211\346\225\f\266B\016\231, \fX}\206\032\037\2507\320y\215\254A\224\221\001X\213\234\032\257I\263\216\226\311\310U\251\305u%\342\004\370\353J\003\323B\300\225\306\b-4\264h\351..'\262\261\303\331\224\256T\206\346\212\277\024e\027\365\315\375\247\021\360N\310\242WHS\325\316GP\370\3341\256D\350\356{m^,\337\250\004\022\313\034+@\211\340l\306P\037\361\333Q\250\274\234BJ\037\225T-F\003\322\375\204qN\301\006DN\314\0328G\225@\036\200\032!@\326\260\260\202P\r\324"
+	.string	"\273g\fhD\006H\265\307\\\033n75]s\357\177\006&\230<\\n\244\214\343\236D9\331\327\364v\205\263\241$R/B\362\004cV?\360\213Qj\004\226/"
+	.string	"\346\242\362%\322\212:w8\325>C\275i;\261\272\307\260\202^\223e\b\223\201TH^*\367\310 V\377\036kD&T<\273_"
+	.ascii	"\222\262\302\221/\033H\200R"
+	.string	"\224j2U\037\362\224\223\001-\332\307\215Z23Qy<h9\252\304\276\357\262!\235\340B-\276\356\321\243l4\235m\035\003\250:\366\326\255\302\2239\2775fL\223w\326\257\035l\247\332\213\025\\\342\260\373\231\327\247\3206\002\237\3401\373`\353W\246\332\032.\361\214\002\322\244d#\334\262\356\211\351\334gn6\007\n\243\207eE\330T\033\262'\202\027\313\366c\3734\252B\216=k~|\312\037c\\\241\273\243\277\250\005\372>\264\026w\253E[\304Yn0\330\302\177z\221\213\250\021vB\305\f~\r\262K\224\301\033\374\373R\005$l\205\211\306\372Ph\253\"\020\030\255\367\355a\300j;r\352\257aI\267\351d%\225\021\372,\031\2425v+\036\">\207o\210\254\226toDj\306M\331\327p\360\003]\375\321\026\315\226\325\242\313\307\f\363w\246E'\343\316D\235\301\214\376\031\033d\210\346\3512"
+	.ascii	"\203|\326v!\343\356\272\025\377\241\333\370tfrX #\231\263p\333"
+	.ascii	"\032\027\224\242\204\213?\234\377\216\345\202\0201\264\312\330"
+	.ascii	"H\013\nq\320\300\t\206n\0253}\t3N\324q\341Z\2246\027\207\006"
+	.ascii	"\202f\350\025s\341\246s\213\273\263\332\177\243\335\337\373\264"
+	.ascii	"\242\352\214\207\353\316\317\034\313\033\221\210\346<\214\244"
+	.ascii	"J\333\017P\226\264?X\216\3750\216X('1\272\315\212k:\203N\005"
+	.ascii	"A\264<?z\271Gf\005\032o\345\230m\251\031\003[\3455\212e\350L"
+	.ascii	"\036\325J./\211k\312\246*\361E\022\351\202\335\037T\253\344\232"
+	.ascii	"\361\006\032h\336\341\364\032\212\314N\334\321\207o::\210\262"
+	.ascii	"\233S_\304Q\230\235[\326m%\370\240\004\021F\365\222\367z\222"
+	.ascii	"\267\301$\215\213\016\233\221\364\335\274\357\037\335\025\221"
+	.ascii	"\3634\r\"\370\363\336\247\337\364\0061>\371_\344\376v\260\022"
+	.ascii	"8-R%{&=\236\356\232E\323\257\331x\331w\016\335"
+	.string	"'\203\032\343\002e\277\251\255\322\"\356av\254qq\212\244\366@}\370S\252\267\314\313\275\217\216\361\007;4\215\2212\261\240\261\220\255\b\234\224\341\276|%j~_$\234\022\371\177\023\333\260J\036\021\210\232\224\3167\020W\355}~\270\3365\347\276"
+	.string	"\2744\316\013\3054xE)\213\241\304\244\235C\370\257'\233_\230f\025\n\214\337Q\177s}R\252\202C4eB/\220\030H\026\221\t\334\324\312\204%\340K&\303a\004\355C\344\254\037Y\214\370xE\267\366\261\231U"
+	.ascii	"\205\b\3775\004IC\250\261\261\216\306~x\351d>^\274\270!X\232"
+	.ascii	"\017;\377\307\270\nF\361-\005Uf\256e\376\224\364\330\252\321"
+	.ascii	"\251\315\220\360\003S\216\364\215g}H`\230|%\337w+\236\022}\347"
+	.ascii	"!\n\373\200\221\210\004Q\274@\177\002$\212\262\356\256\265\300"
+	.ascii	"\023\311x,\005`\324\343e\204\266fd\fX\236\273pN\252\356\033\374"
+	.ascii	"\t\007!j}c\220\023-w\247Jb\213)\360\376U\354D\356\323\007\007"
+	.ascii	"k\230\321\b\220\261"
+	.string	"+\023:\"gh\353\023\352>H\340\030\237\237u\fc\372\332eU\373X\030\243fF\260\360\250v\233i(\365\321\223\027#\330!\r\321\030 \205\307\302y\020~z\210\302`Iz\337\214\332\307\203{\362\204\217\275&r}~O\f\345nY5\330\254\314\277l\236Vg\242\362\004$\2304.\304$\207\242\202\025&\360\327\233\220\362\016Qw]\314oU\201\r\037\rh&\004F\213-3\320\003\256*\203\227(\031<\t\270\365\275m\353\214\255\357\233\235K\217x\224\327\227a\305|a\035u\r\360\201\265\373,dM\364z\035\030\034\027\253\344\226B]\266\016\n4\251\301\356\030\332%\013\233K\366{uNx_\001\323(4\222\307+:\304X\253T\311@\231\001\321E3\212/z\346\325$\264)\364\314\254\204\2318\023<j\022\023\254\322X\341\336\031Gt\"\210`\244O|\261\270)\241Q\207lq\250\256o"
+	.ascii	"q7e\031\225r\225\314\0320\271\025\334t\244\2706\264\362L\264"
+	.ascii	"\362\216yL\224=L\345\314\345E\262D\272\227\213\023\376@\275\225"
+	.ascii	"i\251\214DO\353\027\214\231\333i\326\031\241\351\237BE\267G\b"
+	.ascii	";\264\244[\023\021Q\372\031u#\022\241\236Z\356\232FN\373\310"
+	.ascii	")\321\326F\033"
+	.string	"L\334\303q\2425\377\303!Ibz\027\r?\331\nX\305\275\023S\036-E\326\313CcW\002\203\f\360=\3624\210\350\371K\310o*\253\017h\371\331SN:\206t\215\310\273\262\307\271j8\026\227\306x%\231F\021%\360\233\007\334\227N6K\344f B\231\305\276\235\023G\266\373\346\370\216\310Z\2336\200G\r\257\262\332\363\r>\206\307\224\3418\316m\327\t\254\236NO\275\226\250\230\374\242O3\362\226\377z\354\353\305|\003\3230\0060N\243\242\005s\344ah9\377,\220Z\233\013\214\rt\025\365\302)\244\220\377\023.7\270\250\322}\352\314lP\316\355\003\021-\217d\261\332\n]\030xtX\035\273@_\016\252.\001\241a3t\031\232\rz\022q\334R\332\211RZic\342\236\t\020\301{|\267\217\023\001o\271\2514\320\245\312\321\200\013\005n\005a\344\026g8\222 #}88*=@"
+	.ascii	"\364\034F+\251\210:\036\250e\347\324\364\246\352\306\270\330"
+	.ascii	"\220\223\007\342\246W\177S\223\353P?3\030\202 \231a\246\207\316"
+	.ascii	"j\337\242\320\337\016\362\022\223\346\227\250\036k\317_w\310"
+	.ascii	"2\2432\361=U0\232\203\317\2131\001\r\251~\234>\tw\3303\247\266"
+	.ascii	"\331\017\bv\203\3630f\314\353:\220"
+	.string	"\022^X\0226\332J*\303\223\260\207\r\235Aw]\361\314&\273\022K\007\374\370\307\270.\263\177\205\335\034\262\211\0250\263kNf\357\255R\316.\345L<\006.\335\004\002\222\366\316\027\330\365;\325#f\315V\375\277\255\202\360\242W\207\027M\334\202\027\361\033E\021V\302\246\210\200\201\354\251\032\2538o\\\263\214[\266I\321uvzW\267\267_\234\200\352zn\\\301\002\027\005 \262\350;\330\202\262\337\336\321\311\312\241\262\327\230|\325\351oic\255o\027\325\354\031\226\177\211i5\001\016S\t\205p\373\204u\256o\360'\215~6\006It\023L\353\271\234\211.\253\240ko|<\n\007&,\271\306\304j\3676\322\325\020$Q\373.;\2748D6\200\333w\223~\261+\025\363d\303\246(\232\312\340\\f\355\350z\350\350\b\311v=\250\264\323\332\275S\267\331L\314ls\252XG*\2511\221\244\252t"
+	.ascii	"nw\334\013\002\332!\327\274\373\367(\327\210\234k\300J\2262\304"
+	.ascii	"X\027SK.\022\201\212\326L\336\210`\002\207\223gG{\032\316>\361"
+	.ascii	"m\221e\206U\361\313?\306y\354\031"
+	.string	"\215\034\351.\213\034Q<\212U\313:\326\032\373@R\332=Z\217Y\245|\037'\326L\n\351\177\356\207\026\001\270\251\276\223,\357\2768Y\271\236\237 \372\347\247W\337\316\342\352\206\3566R<CP\277\n\320>\320\336W\336\036\374\264w\367\0358Q%\313p\355\f\325\2232\177\230\370\310}2\316s\034\275\003w\303\030\364no\021y\347\302\367\007\177_\366<\213\007\235\312\203\350\2175\263\227\212\177\277>;Z\336\343<m\257\201\373\322\3253>\244e_8Y?\340\223r\313\374\017Vx\310\2539>\366\0066\347\362\330\3665y\f\376_<o\261D.\364\207G\330L\323\\\275\255\353K\336~\035\305\214|\223\236\244s\207ke\264\005\341\241\037\240\377\035\030u\354\212\375\026\376\364i\343\337\r\210\355c\226Mb\235\315\374\371\345\345z\035\031\365\361\324\3217\347vX\376\315U\314\177\020\037\313\362\247\334rS"
+	.ascii	"=\211\247\035\024\263Z\344\321\316\331f.\372q\272\334K\362X\361"
+	.ascii	"\225\0335\215\370\224o\346|\r\206\317\253\333\342\325\210a:\374"
+	.ascii	"C\362\235\352\345\3614\331\312\206\354}U\325\373R<\236\374\345"
+	.ascii	"\246\\\2232\r\247\016\221\327\330X\236J\3034\260p3P\375'\375"
+	.ascii	"6/\277\347\237\346]\371\334lM \376\003\r\377C^\005\236\271\201"
+	.ascii	"\317\021d\233\037\347\342\346b}+\001?8\351&\244C\311=\315|\343"
+	.ascii	"\263\005\320\223\224[Mn\314{Hh/f\355IMu\253\3528\230\037#\311"
+	.ascii	"3\005\017\007\373\266\373Y\300\034\025I\357:aL\341w\201\375\300"
+	.ascii	"m\343\0374\353\b\337\212\213[\305\230\354Um\bG\312\177"
+	.text
+	.section	.gnu.lto_.symtab.f2979dc0bf673e6f,"e",@progbits
+	.string	"systemConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\006"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\006"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\006"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\006"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\006"
+	.string	""
+	.string	"resetConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\006"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\006"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\006"
+	.string	""
+	.string	"writeUnmodifiedConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\006"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\006"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\006"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\006"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\006"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\006"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\006"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\006"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\006"
+	.string	""
+	.string	"isSystemConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\006"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\006"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\006"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\006"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\006"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\006"
+	.string	""
+	.string	"pgResetTemplate_pilotConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\006"
+	.string	""
+	.string	"pilotConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\007"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\007"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\007"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\006"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\006"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\006"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\006"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\006"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\006"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\006"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\006"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\006"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\006"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\006"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\006"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\006"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\006"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\007"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\007"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\007"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\007"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\007"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\007"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\007"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\007"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\007"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\007"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\007"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\007"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\007"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\007"
+	.string	""
+	.string	"featureDisableImmediate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\007"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\007"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\007"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\007"
+	.string	""
+	.string	"mixerModeIsFixedWing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\007"
+	.string	""
+	.string	"featureIsConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\007"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\007"
+	.string	""
+	.string	"featureEnableImmediate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\007"
+	.string	""
+	.string	"buildAlignmentFromStandardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\007"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\007"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\007"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\007"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\007"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\007"
+	.string	""
+	.string	"featureInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\007"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\007"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\007"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\007"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\007"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\007"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\007"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\007"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f2979dc0bf673e6f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,762 @@
+	.file	"config_eeprom.c"
+	.section	.gnu.lto_.profile.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375 \316\275\004"
+	.string	"\242\207\034'\220+\303\001k>\226\274]\327\224\004,\240\b\256\300\225\3328\300\324\2223333\243\230\013\371d\223\275\367\336;m\031\255T\250l(\211]\007\027\326\301\002\250\273\f\226'\352\375H\322\230P\346\034 0\t\250rN\326\245\221\320\355%\206\243\303\211\260\354C\2402/\356v\313\345\275\307\367\260=w;\360\024\325\3451\273}gw\031+\210`j\324H\016"
+	.string	"\b\031\371=\200\300$\340b\203\312\210gN\375y\002\264\331\271[\321\354s\254\335)+m\301"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375 o}\002"
+	.string	"t\003c"
+	.string	"\n"
+	.string	"\002\001\002\n\002"
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"\004\003\002"
+	.string	"\003"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001\005\006\007"
+	.string	"\003\b\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\003"
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"J\005\326\352\016\327@SB .J@v\235\350\264j\003X"
+	.text
+	.section	.gnu.lto_.inline.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375`\260\001E\n"
+	.string	"\262\01625@o\222\016\007\210\264\n9\333\326\261\246\003\003O\350\211/>\2140\373\335\237}\261\371Q\242|\343X'\237W\3221<\002\303?\242\260:\372K\255\355\223-w\n\377(\262\276!9FdF\005$\023.$\2021\254{\034\260\306)\254\007\325\302\264Bu\372\370\320\323\311L\210\301\034-\3370\264\332\365g\033:\264\324\261\221B"
+	.string	"\265D%jI8@\313>z*\002`\375_\030\361\336\223\370O\2725\217\3316\2169<\333\362\027\320<\3466\317\311\237\304bJY\350#DUV \027\253\024\352\376$\314\213IL^w=Ma\254\240\340\275Z\337{\317\372PK#\r\324\201\373\374*\216c\250\036\037\247\212\316_7#5 P\002A\f\231yI\201i"
+	.string	"%3"
+	.string	"\367p\r\303\0228\266\304\272R\205r\207J\3222*\244\300\372\203`\bC\020\210N0\202`)\223{6\272p\230-e\033\036\262\260\321\002\024\315Yp\256\021;>\323\221\366jB\346'4\307\300f\204\261\230hW\"\"\316\223\216qYp\t\f\017"
+	.ascii	", 0Xh@9\342\303\361\205\221\344n\033\020\027.dd\265\273\267\303"
+	.ascii	"+\265\273pn"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375`C\003\035\n"
+	.string	"\222\f$'\220)\031\016\273\377\270\324\201\222\264\352\246\357\356\212`k\261\"]\211\335\201H\224nw,\360-jL\220$d\313$\003\3336E9\241\344&\260\275P&\327\301\374\n\206\323i\t\330\030\333\202\200Hb\026U\227\r`S\3508t\234\364\243\350\203\220#\013\303\035\306p\242\252M\224}\nz\303\360\333\210\217\334\250\233\356\246\274Qo\3207\300\337\220\023\207\252\036\271B\331\320!\376\341\264\243\357(\337\203\311\263\223\347\215\033\031L\344\230\347\026K\020\002M\250\2419\202\0045\205\302\260g\200\"!:\353\001\022"
+	.string	"3-\001F\004\021\024\"\201\231\200hf\002\363\273\325\267$\371\277\3726\261R}\231\r\365\261\032\202*\253t\346\314\211\020\226\0252\003\362\212\334\205\224\020]@"
+	.ascii	"a\256\261\273~,\325`]\213\307\004`\257\242\177\227!\364\231 "
+	.ascii	"\323-3\324\020\332\315\273\367@v\220U\374\207\001\262\323\203"
+	.ascii	"?-S\b\272iv\364&\313\204\244\332\340m,\241\r'\361\334\216\227"
+	.ascii	"\265\004\306W\371\3440\357\177\245D\007\304\266\361#\342v\270"
+	.ascii	"5\220R[o7\005\202|\374\005'\356\304\207=\243\343d}\245O2"
+	.text
+	.section	.gnu.lto_.pureconst.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\265\004\002\231\004\005\230\004\006\230\004\007\205\004\b\271"
+	.ascii	"\004\n\204\004\013\200\004\f\231\004\r\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375 \2635\003"
+	.string	"b\305\016\027\260'\303\030\314!I\222$I\222\305\232\335{\306\306\2665\033\254\224)\277\341L\205\227\255\303T\3176PL\007\222\225X\225\025b\200\306d\314\252ej\254\316v\301A\216%\\\004\021"
+	.string	"\020D\020f\240\004\232I\300S\243\367 D\b\212\031\207\022\230\321\311&\204"
+	.string	"\b\306\021q3\326\251"
+	.ascii	"\345\274n\003X"
+	.text
+	.section	.gnu.lto_.lto.5612ccc4f226c126,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_loadEEPROMFromFile.14.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375 \333\325\005"
+	.string	"\222\212'/`e\323\001`\025Vnw0\240"
+	.string	"\031L.\b\204'\f\300\223\227\364\t\276\210xK\357\001^\343\031\021\0351\300\266\273\035"
+	.string	"\207\2331\312-S\267\252\214\326\355\272\030\017\314\241QkjX#\233V\205\314\312p\272]uF(\255\223\022{9\\\214\306\n{g\371K(r\277K\220h\364\270\373\305Nr\346_As\3703\302\264$\201\356\313@@\217\203\020\347\377R\347\376\323\212\233\336O\311\342\001\350\356\311\232\345Vr\337\355l\341\003\273\225\004Ew_~ f\317\373\377\360?\361\177\022\t"
+	.ascii	"\252\244\233iq\323\031T\341:\327p\262\020\306\313\020\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_initEEPROM.15.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"\r\007"
+	.string	"\002M05Pm\222\016\204\361\372\226\344\316\254\353\326\r\215<\255e\006fX4\214\241*\336\266v7\240uc\353\256\215\264\376idP\0205\260%\254\314\324u\354\366\t\221)W\024\313\205a,+\201\241\262p\271\252x\251(Xb\2055D\212\300\027\306\302\242\303ua\221\3526\005\365\240B$B\332@\355\311\273\334\003\304\353v\271\"\220L\210\2204\250\371N{\020\343;I\350yHP\352X|F\020\244K\211\222\221\024M\037\033\177/G\271LCO\236\213N(3\251N\237y\252S\251\263\037\265\313\310z\204Dt\22423\302O\263\276\354\026\324\200\215\243\351\0030\310\314\337\306\241\350\260\377\300_\360k\004\013"
+	.ascii	"\252\244\223i\021\206\205\b\333*\204\347\032\016>\304C\250\030"
+	.ascii	"/W\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_isEEPROMVersionValid.16.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\375\t"
+	.string	"\306\022E< \345*\035\3408\b6\200\005\"\253\304\211=\240!\374\311\202\351 Vh7B\233dM\007p\263\330\324$\232\026L\241\336#!\001\232\313\310P\311Q\001\221@\300\346jD\b\221;\2452"
+	.string	"2"
+	.string	"4"
+	.string	"\257\n\224r\227\374\264\343\3429\235\242o:\247\266\026\216\227\224\361\342*0\246\270\201\335}\354s5\242\346\314pv\327S5Z\334\335m+\330.\260]\006\277\013\246\221!;\315\233M\232\246\272\354s\273\273\326\226\355\3519\247\317\035c\243\214Y\240\355\262n\001\326\245S\021\261]\262568(Y<\371b\335#\346\234\024\305\251k\356\256IA>\362\256\016'0\251\t\3006x\223Q\300n\n\301/\271\214\2446\226\362\343\235%&2\260\225\221\335\323U\357|\n\357\335\365\261\356l@`(\362x\030 >\017!\260\363\205>\r\240\257\023\222\276\r\201A\221'\374\"@0\3744\344\236[m\331\253\221\314h\363\027\275\307\236P\013\231\321\324\027\275\251+\r\017"
+	.ascii	"\252\322Ea:8\314A\314\0267v\204\321\305\306\002\031l_hf\225\272"
+	.ascii	"P\267\301\362\270\346\250\322\201TC\233P\312"
+	.text
+	.section	.gnu.lto_isEEPROMStructureValid.17.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375`\303\004\225\037"
+	.string	"&y\310I\200\030R:\2450\324\361-\305\357f\253\251\203\373\257\347\033jFD\237\006\343\237\254[\025|nx\345+rxC\251M\0259\265+\335\372\275\332\357u\033m\027o\036\360|N\214\025z\344\245\335\376\024\325\366\244\221M\344N2\266"
+	.string	"\254"
+	.string	"\265"
+	.string	"7\362\224u|\344\217\034}k\205y\243\220\027\252C\023\265\006\350-#\321c=\353\350ZF>%\344}\212\340\344\f+\301-/@oy\027p\336\326\0038o\231A\203#F:\022\207\323sd\021\221\250\335\213\374\365\r\266\025\3519\034z;\255\331\025\211\237\364\\\0060$\326\232\r\250\251\343\236\236@\027\263!\031\223\0370\216ry\212\272\355\214D\235qXOS\002\225\030NO\276\27602\231\325j9\346\351\007"
+	.string	"y\222\2526g\204q\363JSoS\200\023\217\246\235q\311Dp&\305\314\323\327\242qX\353m\302\275\227k\223\021\352\254;3#\231\031\210\331<\022 D\3247\345\364\220\324\331\332\031S'\001\311"
+	.ascii	"\323a\366\221o$2\205E\367Q\353\300\363M\"\005\263T\3170\363\210"
+	.ascii	"+\001\242\367.\001\361\223\234K\250\321\274\f\331q\313&\202\267"
+	.ascii	"\2531\265{\225\336t\313?q\336\276iT\341\230\221\245\245T\333"
+	.ascii	"\230\221I\265\217\314?\225\224\r\027\334T\314\\\371\307\347\323"
+	.ascii	"\303\263\243\223\303\225{8<[\371\006Wy\207V\266A+\327\234\225"
+	.ascii	"u\266r\016\255\214\273UF\257u>\273\262=+\233\337:\267\255\\\315"
+	.ascii	"\312'\360 Ojc,\244\335\353\324\306v\265\330\256\036\327\372\267"
+	.ascii	"^\231\317\374$\037q\215k\235\366\3414\256OL\243\204v\243\245"
+	.ascii	"-)\253\362B\373\310\266\347\206U*\266T\317t\330T\022371\013\005"
+	.ascii	"\312\256\034\313\005\003e\367^\007\267a\365\336s\330yk[\230\216"
+	.ascii	"\231\315k\333G\303t5\254m\\\333l\213\206\226\222q\245i\263\032"
+	.ascii	">\326\316>\362\223\017Z\212!*Q\235\003J\"\227\231\3238]|\362"
+	.ascii	"\024\226kD%\272\323O\3373\237\374W\360V\245\305\312\275\330\354"
+	.ascii	"\274\345uQ\303Y[\230.1|\212\206\256\020\033\320s8ok[U\241\231"
+	.ascii	"\367\336k\003\324z\017'_\031\204pd\233\201\305\177r(\037\270"
+	.ascii	"\006\317\333nk;W9\231\003E\007\n\201\315@\005CD\302\""
+	.string	"!!\021&\202%P\020\001\177(\202#\206~@a\212\237\202\037&*\022\022\376T\020\021\t\177:\276o*\316\025\243\210J\334O?}\320\262\t\227\262\371Hg\217{]{\230\2638}v\221M\313\353\356\"\363\003\247\033\235>\375\323\031\300\270\210]7\315_\036\214\021\177\007\007U\250\025\232\310\354\372\246k\031b\232\223\005}\312\276\370z\327*\276\3040\t9\200\263\333\327\273\257\261\236\266\361\341i\233\006\372\362z\221w\367\364N\231\306t5|\224w\327\360\234]\243\fC\354eQ\266\300\351\232\327;}\261\\\353\266\344\332&\331\326\002T\264y\001\\\250Q<\002\215R\310\021\tdDF\322f8\200\002\221\251\262z\021`EEU[h3\013\203\260@\033\307\240\021\312n\023\356\245\237\334\311\030r\277w\222\bd\216\213}\253\352\2638h\271Vw\027!X:`L\363\007\034\021\367\351\2368\301$w"
+	.ascii	"_\250\313\032\n2G\221\234\206\017Q\204Y\316\246\236\213a\002"
+	.ascii	"\270\031;\360\353X\270\017\327t\364\362\253\242\244\035~}\tr"
+	.ascii	"\210!h\240\361R\0307\305\nY\243\2223\"\303`_!\020\321\307\251"
+	.ascii	"\340\266\304\350^G\f\340WY|zkgP\270\2440\330\032\003^\204\266"
+	.ascii	"\276\270Z+\243\367BNj]mT\336\263^\231(9k\252C\256\246\300E\320"
+	.ascii	"L\353C\247''\177E\036\241\006"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.18.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"\342L/3Po\322\001 \233\236\265"
+	.string	"\246.\235\1776\177\003\006?:\375\206jV4k\215\263\350N[n\375\004\002\317\314t\246'Z!\f\n\236\355\311v[)S\n\2362\033\367:\024\305\360\240q\340\270\251q4\r\2336=\210\2269\260\353P\257E8\367\032&\356u\224j\020\322\t\373#\217\320\367\260\204'_}\371\036\366\225\032\200\021\312\222\035A\251\033\366/\253#\333\351\324\002R\312\202\312nE\251eQ\226\311\207\355\217\215\361CN\372\030f\354\260`%\032\024$,\273\261\t\234\200}\345\007\330\227r\034>\241\177\221_@NV*\021\350\t\240\260\273\316Jtq\353m#\330N\260\235\021\t"
+	.ascii	"\252\244\223iq\326\0311C(\256\211\267\0218\013\221\207\273bj"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_getEEPROMStorageSize.19.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375 \337\035\006"
+	.string	"b\213*1`M\323\001\300\006\\\b\327\316I\261RW\024W\267\313\002vh%t\263\217\240[z\017\360\032?&\t\005\033K\267\377\260\224,w\255\355f\367N)v\232H\316\351y\024\032 \006I:Q\202\026\242\350L\207\330\020XN\317\214\017R\316\310\324\375\313\334\356)\034\200x\021v\255\334\253\260?\331\335\365\313lw\214\272\215$t\354R\224\220\254\310\362qa\233\262\031?\343\032\224\251@\32508\241Ipl\2735\272>"
+	.string	"~\251\034"
+	.string	"~y\026\247w\324\377\306\021<B@\254\253\272\243\034\354\256\235ua\367\273\355\002\333\006\266\251\b"
+	.ascii	"\252\244\223i\261\317\f\t\016\252\256yZ\bB\334\025S;\311"
+	.text
+	.section	.gnu.lto_findEEPROM.20.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375`\317\003\365\032"
+	.string	"6\362\256H\240\230Q:\300c\332'\311\246\257\266|\261\275\341\303em\266\350k\034\r\222\253\340\355\021\241\321uf\347\217\3505\n\227\323^J\372+\237\200\327\344Ii\360=\236\210_(\215\002\326\f\341\213\306\207\321>\211%\233\310\235R\236"
+	.string	"\213"
+	.string	"\236"
+	.string	"5\270\340\324\0246x!A\037\202B\274\251D7~\016\310S\002\242\347<0\305qjm2\203\244\326 \0037 O\017\344QA\026\022\020tR\262\271\252\332\r\303\324\032\2249\370"
+	.string	"\343)\371\234\361tqX\234B\207\225\344k\244\342N!_\305a\033\244d\211\022cC\t\306KQ\302_LRT\320\213\262T\223\244\023\003@!1\315\327n,\242\242\204^\224\245S}\036%\255\020o\345\306\326\207/"
+	.string	"\205\004c\212\r\226\276\260\244\245\317\327\204Z\253\247Q\222\322\035\273\355+\333<\366\316\bYb\200C\263\313\277Xk\255\342\372<_\273\247:\271\005\b\027rw\\\236\375\257\022!*\300\354\372\354\240n\236\001\360L\013o\223=N\343|\310\1773N\333\034\370\327\220\3234\236\206\225d9\375\372\324=\222\323t\234\026\305\351}M\317q\372"
+	.string	"dN\275\0309\2546+X]t\225\251U\250\022\035\237\372\355\373T\257\262c\006z\021\353\374\266zQ\265\326\023\261c@v\354\364v\220?t\314\366\324\211\327\"\244\222\307\273\352R\003\307\342\201\362\201\203\377\224b<\265\331W\375"
+	.string	"\013)\341\221\024\320\311\027#d^\3533\325\371e\t\245\020\3151Wd\030A\215~\322\001\201\323\222;\361\220\300\251\326\n\201\311\233\314\033\321\306\323Y\353\215\265&\204T\346\226\273;\233\024\361\320\355L\340\333\322eQ\235\031\232]\353\205\313J\r\272>\177x"
+	.string	"\363D\236\204\006\204\305\207\177\344Hz<\243E\370=\r\335\350t\336[\304\035\267\\\236m\3437'\324\"\232cl\327n\304F\326J\364\300\277\032!\202\254\265\376\351\324\027\032O\277\264G\016\261S\303\311j\270\034\334}n\266\022=3\033\b\333\317O\317\210YM\215\226[\317vH\334r8\032\315C\315\006\302\3476\223\371\330zH\310f\271\037\331\216\001\337p\264\234\254\304\355\226\223\305<\364m\362\034o\365Io\365\017_A\213\026\325\021\361VwI.\f\266su0\221,\227\\\236\305\035WE\345\315\276\326\204P\213f_9fvg\366:#]\232\365\3341\351l\341U.\320\245\\\\~\234\306\321\n,r}\306Y\021\303\247\360\2103\310o\253'\005\034\320\365\f\243\315\342\254"
+	.string	"\256\035S\2255\004F\250!,\302\030D\210\021\022\251h(H\\\r`\002\031\232<\017\020p9\323d\330\f\330\264\264\354e\301+\351\240;9\262\361R0\3510\314\214\272T\2463|r.\220E\370\360=\b\261(\fW\3224\271z\374+\303\241\201\200W\223\352X\f!\020\256?@\2311\255\355\037\313n\005\211\371\221\027M\021\344\\Z_\233\362:"
+	.ascii	"F/\032@9\026\267\2542@h\2742\270\212\342\237^K\215\n0\356\224"
+	.ascii	"qy\377I>:iFQ:\"\023\276\350vu\250`\367\322\335\301\375\"\203"
+	.ascii	"\2730\244\001"
+	.text
+	.section	.gnu.lto_loadEEPROM.21.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375`b\003-\032"
+	.string	"F\361\255H\240\232M:\022\213)\364\244\377g6zV}\320\264\277t\370\272\312\374\320\325\276\313\bV\275s\030x\352\200c\372^|\346\256\322\327\323\025O\030\264\266uP\341\200c`\355\035\241\204\017\315\250_u\333 d\357-e\222\001\233"
+	.string	"\215"
+	.string	"\236"
+	.string	"@{\247\215\375\2073\220\033kQ\004\255'?\006\237\013A\374\334\b\023\200\026\367Q\251\350KfvTkj\035g=di\323\221\325V\323\221\025\327\345\370\025\031\367\0331\244S6\343\366NG\320\304J\212\253\252\227\373\215\f\205\212\216\334\013\216#i\301\013\210\365\250 \026\205\030\371\036\302z:NE\036\237\261\336N\032\250\265\002\350\t\261\224:GV["
+	.ascii	"zC\262\301VS\217S\235\211z:\356G}\201V\326\257\013\210\221\357"
+	.ascii	"\034f\250\265.\363zF_\330w7jw3\354v\210\274\357\241\262\336e"
+	.ascii	"\341\303\347\345\364\251\016S\302d\354\002\nu\256\235`\021\352"
+	.ascii	"u'\355\2169\266\240\344Uf;\310\256\200O}sp\016\365\225\305\376"
+	.ascii	"\373\302\226W\024y\303\311KC\336\031\362J\312\333\223\227%\357"
+	.ascii	"w$\204A\362\261\264\246\271\306Z\024\374\252\\&\026\323\247~"
+	.ascii	"\250\377\367\336\375\356\245\366T\033\233\222!\253\017\247\352"
+	.ascii	"\242|!\301 \376i\037\265\261\317=\223\217@\207\232!\253o\254"
+	.ascii	"F4\264\262.\214\337\241\237\342u\350\347w\003Kt\260\221\342j"
+	.ascii	"\222$\210\203\234#$\300\037@\360y\033\203\n\222.\240\256s\267"
+	.ascii	"\221\345\006\021\332Ig%\037\224-\023G\305>\220\001\314M;l\021"
+	.ascii	"#\370<\261E\374\330un\367Sl\347\355\222\370U\211\317\260\245"
+	.ascii	"\024\336\216\331\264\331\312\256M\200`0\350\365\027T\366l*e\b"
+	.ascii	")\210\203\333-\373\273\023\267B\321\355\200\310\323\233{'\b\214"
+	.ascii	"\2236\233\342U4\261V\035\205=\024\0235\261\310\347\273\227\230"
+	.ascii	"\276\220\234\236jp\220\237\276\322\210\221\235\2642hN\027`R#"
+	.ascii	"5F\307^+\013\264\332\255W\324n\375\363S\243\321b\374\204K{\340"
+	.ascii	"c\273\271\250\325P\254\350Q\321\302F\233\265\350I\3413\243\335"
+	.ascii	"~f\017\016\254\315E\3556\203a\263\335f\261\261\002/\305X\343"
+	.ascii	"\340\364\235.\236\251\202\243\013X\243\203\2007\235\264\025z"
+	.ascii	"\204\t\274x5\360x`\"\203\364\2235\321\312\020\326w\372\206\245"
+	.ascii	"\256\335\025\3778\032\313\342\021k\035:o\177\345X8\310\355\300"
+	.ascii	"C\317\373\334\363\320O\031\373\252\332tA\363E\213\216\275.k\255"
+	.ascii	"U\2242\346\301\210\215\335\325<\326aM\264\253\340:T\326\002\372"
+	.ascii	"Q\227\001; P\002A\b\3176\252th\f;\303A2-\322ME\310\343\021\304"
+	.ascii	"K_s2`T\253\323\264\n\243\030\354g\256qb\211\325\250\035\257U"
+	.ascii	"b\212\216\346\203e\316\325\005\315\360\346\307b48\200\013Cu\345"
+	.ascii	"\005wH\030f9\222k\320\016\264\275\320j\325`!\265\266\321\340"
+	.ascii	"\243h\242\222#\030\245\211z`0\017f\236\313f\255\337d\367\272"
+	.ascii	"s\003#R\032\017\016\334\206\263\033x\034l\343\nCi\364\357\325"
+	.ascii	"\007\207ls\357\325\232'"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.22.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375`\034\b\275."
+	.string	"\372R0\022F`\\N:w>\350#\242c6\361J\317\243l\222\034\231\262\3559\034\307A\001\365\267\3506*\251\327\303\360\372<\255\236\255\331%\372\177\351\005\304.\003F\032E\314X8~cttX\360\252*\224X\"m\357$\003\r\001\376"
+	.ascii	"\024\001\007s\270\356a/\377\326<K\346\256\344\234\207m\375i\017"
+	.ascii	"\311\274\314\325\335^\260YL\004\027Y\024{5\302\372\265\376\230"
+	.ascii	"0\027su\266(\236.\274,\312({\240u\331=\274\212\273\257\372d\337"
+	.ascii	"\362\263w9\332\325z\350\345_\256\236\006\343\331\351\005\002"
+	.ascii	"o\310\n\366\352\315C\007Z\245Tl\026c\267\270\234\350\345\354"
+	.ascii	"\205\202\213\025\233\331\330'\030,z9GK\230\311\030\302\372\311"
+	.ascii	"Z\\qb9{\211x\331\265\\=:c(+\232\275N\304\201ccb\257\376\234\300"
+	.ascii	"z\365\036h\275\3721\032CX\321\334u"
+	.string	"!/:\366\340j#\261W[\002\205\253n\037\r\353\022r\005yv\351\3139j\304Lz\245\362c\255\r\225\037kv\017F\337\301\333^\r\342\333\366\325N$\375k\332\245}a]\r\nktE!~\325\b.\371\351\265m}5op\312\216\343\217\371\235\312\235\331\245}\355\370\025f\3109\367\205~\345x\257\357\356\254\356~v\263\302>g\370\030\334\373\026\313\372\265\243\265Y\222\334\264d\255\226{FN\235\023c\365\3134\260\207\362\004k7\207\243u\350\243*u\353\233\203\340\336\234\337n\353\361\007\020\303\"\316\257!q\f\3139\353\320~\232\253\t\321\177r\265G\220\270\207\222X\257\036\273P{\002f\335\300.p\277v\265\022,\264\333\004\212{h\023 \243gGO\013cuG\233\027+\351\376R\230\237^\343$\335\304\333M\304\333L\304\333K\304\333J\307$$\b\304\333\016\004\3346\372\330\233H\350"
+	.string	"\361v\320\331\336?\347\362.\026o\023\211\267}\210\267{\210\267\207\305\333"
+	.ascii	"\212\267y\212\267\331\342ma\200\333k\200\333\352\317\355`\361"
+	.ascii	"6&\336\276>\267_\341tb}r\224y9w\005\336\311uj\233\224\273\375"
+	.ascii	"l\377\330\037\375\315~.\277\364O;\333\375\276\334\347\240\376"
+	.ascii	"\326B\347\232+Pg\036\247\374[\253R\272>ew\335\362\200\266=\326"
+	.ascii	"\253?\270g\311\031\032\255\353\367`\316"
+	.string	"9\007\215\016\264\376\340#\376\230{\330\203C\347\254\362\"\230\363\021\fzfA\274ba\022\022\026\342\377m\255x\270\344\016KY\020\253\370o\023\272\375q\237-\030\373\344\252\212\217\336\2245\341 \226p\027Xto\363\0240\022\036*b\214/\334\325y\0022\270\353\333\247\255\220\343[O\034X]\002\"\237\032\031\371\264\203\003l\204\377\004\354Q\302\016\360\347\036\234\302\244\216\fM\n\270\204\344\323VI\037?}\221s\356\314.m/\213\316\225\360\022\016\342\213\353\226\311\375\332&J\370q'\262Avqw\353\344S\253>N\301\311\203\356\255/Z\233\360\305\237\376\201\224\256i'\035\322\274\201\255 \360V+\023n\302\006\334\236>\232p\335B9\337\f6g\255c\177N\212VJ\377I\324z\225\t\037\356D[egwdeY7\020\243\275\325\370\302]t\237wc\030\016\f|\273\255\335-\225\326\312=\364"
+	.string	"\016\335\342\bj\312\b5\005\364\304\\\"\223\314\025*\311\304\314d\224S\222YE\3052\223ON\311\026+\222\211\304\314d\325r\311bE29H9)\237\244:@)7<%\253\230\311\030R\312\001TTI$\322\212J\330\310\243\250%s*\231T\001\245d!\265D\032\245\224NQF$\223\312x\264\240\227SI\246\261j\271d\032\207\321\254\007\203E\f\201\b\023\301\370\352\262p\263gDe\230QIa\244=8\021\023\341\377=\333,\334f{\343\036J\304gC\227-\334g{C\256N\013cmi\267\264\314\370\340G\177\350\036\366\301\227\315\023H\020\036\342\036\236\347\016"
+	.ascii	"8\b\367}\002\202]\b\017q\020\030' \313\203\001\340;\357\ba\036"
+	.ascii	"|:q\350\214\254\020\004\314\342c\034\264\263\226+NK\335\213\326"
+	.ascii	"\356\266\353gV}\274\332\033H\361T\254\244\225\200\024\371\335"
+	.ascii	"n\277\332\036<m\344\372~\360\326\247g\377\342p\340$|\265\263"
+	.ascii	"xoQ\356\001\\\304[}s\264=\330\234\235^\367\253\325\021\f\200"
+	.ascii	"\236\250QD\303\020RH\211\210\214\310l\232\326\220\002\021\252"
+	.ascii	"*z\021\220\255t3\242\260I\2450\315\001Nz\256R\367\367"
+	.string	"/|\336\025\325\343G\n\225\t\307Ml\231v\200\274M\354\207\022i\005\234\002\0278\337\002F\020\204\304=\\\211.&\304C\273?\302\223\217\327\035AF\"\212\234N\302\213\r\330\300v(d)8\245\336K\021\244K\0037\275\370_\231\t\351I\"\262a\020M^\226\343\343f}\220\3732a8\315\237\221\300_\r\341\314k\361\024\376\f\300M\301~gY\310$\347\253A\007[PE\253\301\317\334\006[\0168\035\330\002u*\317\270q\313\230\007\3445\375\255\017\260[z\363\330O\215\212E\3729\235\243\351\222u\3139O\354\252\260E\341{#\030;HV\342\343\234\350b\370>:\360Ip\2355\2074\251Z\352\304\314\243\237\247\324\330>92z\317r\025\342\266\325\213\337\364\310b\f\224\220\306\"M\352a\326\n\017\206{\0204\210/\310\307\3522\227\230\003\304\r\262\374o\265(hPL2sd\364\001\314"
+	.ascii	"\020f\030`\321\003\320\217\333\3238\211\324p80\301\022\0037u"
+	.ascii	"Ej\032\r\200\357\205\0305"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.23.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375`a\002\365\023"
+	.string	"\306\344\200H\340\360&\035\336\222]\35212\"\366$\304;\322\003\242\030\300\232\023\344}G\207!\t\355\265\023~\252\255\273c?\335#\030\330U7&\252\206\355!\206\031\346\023x\251\030x\235\035yK\302\200\322=\005\rB\b\331R\246\024o"
+	.string	"e"
+	.string	"h"
+	.string	"n\372(b\376\305\323lH7\347Lm\217\367r\274\245\306\356\021\202\237'Wc\376\207M\274\207\001\02058\017%I\316\f\233$\035\246\243\240\301Q\020\3046\323O\212\314\220\240\235\006\315\215$\271\001\303\3518\031\365\244\2009'"
+	.ascii	"\033\006\231\240f\223\251<a\363}\320U\006\013!%\0276\233+\210"
+	.ascii	"2\347\264\322l5\367\307m\247\260\215b\253\204sC\330\250\220\003"
+	.ascii	"\335\341o7x\365w\265w\265\274z\257\326\253?\300\301-\247\203"
+	.ascii	"\317\216U\032\347\314N\307D\362b\2248\320\177\273\332\267\257"
+	.ascii	"\302\017\372\212\217\261\003\231h$f\234\266\006\272\026\223A"
+	.ascii	"xo\344\"\337=y\002\337\275\037g\020\237,\210\375\3662\"\216s"
+	.ascii	"\346\304\206\356\246\233s,\271g\005\341=\307\034\037p\324\270"
+	.ascii	"\267;\016\360\263\250\b\271\f\263\234\226<\334\232\345~\217;"
+	.ascii	"\004\237\335,\247\037:\270\265\227O\356\203\245\030\315\341]"
+	.ascii	"\3714\273\001w\327#\232q\200\321\235\365&\372\302\325\225F\263"
+	.ascii	"\037\231\356.\347\234S\032\301\303E\355\235t9\231\034\231\356"
+	.ascii	",\325\276\340\242\247}\037\364k8\332\200$[q\347\234\342\356\216"
+	.ascii	"=\212\3720\026\326\n\006K\001_\257\225J\325\362\002\2552a\265"
+	.ascii	"\\,\253\325\204\n*\024VZ\252\324\212J\n+\245r\275R&\007\334b"
+	.ascii	"Y\271R\260V\313\225\002\031\247x\024\230\225\211\036\037\352"
+	.ascii	"\235\365\331-\013z\232\365\310\b)fE;\231\030Q\024~\253M\257o"
+	.ascii	"\217\323\002<c\017\270;\366\366<B-.z\232'\213<\310V4Q\222\016"
+	.ascii	"\323'%\270![\033z\bJh)6 p\002\031\303\362\252tB\303\320\250\230"
+	.ascii	"\rs\026\261\275b%j\255\214\320lr\257\314\250\272]\003-\367IE"
+	.ascii	"\330\202\264.\253\253 \305\2630\217nXY\0357x\257\214\345+X\216"
+	.ascii	"}\364B\323\375\315m\3459\366\340\226\214\327h\374\367\022\354"
+	.ascii	"\035m\235{\007\257\210\263+\272\004\227\313\035\243\356F\204"
+	.ascii	"\345\273z|\370\343\334\357\300\314\300\326Lr\375\336\351\200"
+	.ascii	"G^\302z\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375`-\002\325\013"
+	.string	"F\322F:0\257s\207\372\fz}\251\005\254\017\355\3005\316\336\244\250\277\323\343Q\305\332\277\363{\007\r\0058\021\021\021A\250\215\350\2071\235\307\373\276\337\365\3754z\032\312\226FX\222)\0057"
+	.string	"5"
+	.string	"7"
+	.ascii	"Z\247\024-\210\321\213\242\017C\217\261+\264\003\340\336{A\017"
+	.ascii	"~@\232g\264p\301\262\322y\016C\350\321\230y\273\253\025\312\301"
+	.ascii	"\374\314 h\247^.\017\344k,3;*\241u\325h\335\314XO=)\341C\b/:"
+	.ascii	"\370\016\352K\006o*\370\017\301\227\003\177\352\213^f\322\213"
+	.ascii	"\371f\367\351I\225\3627\246\317\224~\264\316\334'\214\364\005"
+	.ascii	"!,\261sNm\3778q\305\304\316U\2550!\313\020\273\315M\215\346\344"
+	.ascii	"\nZ'U\214u2\315\244\343\n\256\340)\220\212\326\003\326v\217\230"
+	.ascii	"\203Dh\275W\321z\253\001\314\255\315\263\r\r\031\3719\327\352"
+	.ascii	"\220\013f\321}\276\2314\213\224T\244p\237\227\355\367\336\006"
+	.ascii	"\3739wv\263F\"06\236oj\333W\313\f\205\343y\311\236\203\347H\022"
+	.ascii	", \360\002\231\232\352\022C\225\301>\354h\026\267m\036\367\320"
+	.ascii	"\336}m\257\r_\273nY\245q\006\230\367\242e\202\220\177\327\240"
+	.ascii	"\036\300\021\034\300\021\034\300\0018\002\016?\020g\227>\267"
+	.ascii	"`\310\236\026\263\263Y\002\206\f\242o\240~\177\307\373\215\365"
+	.ascii	"\017\341\226,O\\y\203\205\313\215\2065\236"
+	.text
+	.section	.gnu.lto_.refs.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375 M\305\001"
+	.string	"\002\004\013\020\220+\035\377\177\302"
+	.string	"\325ZG\202\006\367\226)\005:\324$h\302\334x\3260[<\317\263\236\364\002\300\267\354Q\023\241\221\34595\t\003"
+	.ascii	")Q[.o9."
+	.text
+	.section	.gnu.lto_.decls.5612ccc4f226c126,"e",@progbits
+	.string	"(\265/\375`\345\036\235\212"
+	.ascii	"*\331@0Q0P\322I\007\366\323LxUUJ\004\357\211\311\270\252\257"
+	.ascii	"Z\f{\325\262RM\006\177?%\202``\362Y\211U\3101\002J\335t\r\305"
+	.ascii	"\217\036{h\332\203\021\245;\266\202Juq("
+	.string	"s\261\305)\342xE\251r\001%\357\374\255J\212X\262\245L\001\214\002\355\002\n\003\177\320\031&\303f\270\216j\2757j\300s\342KA@\n\035$\354\356\252P3H\354@Y\271\314\364\311el\250\246\344f\260\341q\223\363N&\347^\024\351\2310\2663\037S\302\212W\026\235\224\364\234\2266\020/I\317F\322s\220\364\314\325\345\b`3N\217\256\2178k.sLIYi\017\373\240\b\260\217\026\256+1\306\313JM\237\234%\355\307\246I\025 ]}\236q\244g#V>\263+\323\006-\253i\202)\334f\233\314t\251\2112\017M\202\n\030\216\323\370l\007\331s\223\270\324`2\031\034W\341+ve\226\220\365\224w\357\r:\303\361\023^\263M\346M&\021Q\340\207\036Z\325\336\275\253\034\3231\026\216\3439n2\334\231\n\2771\331y\275\312\024?(\330\035\031Y\316y\276rv\303\275\311{\357"
+	.string	"7rR\346\264\372|\320\331\212\017\nE\265^\036\034.7\036a\372<\016)\352\366\337\340\314\245\331\301\354\3634\260\365\227\237Z\223>\337\"\275\n)C\341(\334t\200\245\234\235\260\332\201H\353]\323#\362\254\350\372|\t\351\331\001\324\376\375\261\003\350EH\233}\320\036\rR\004\370\004\312L\270\214\233\006\260\331%\250\340\026Yv\305\356]yt\326$Y\323\327\347'H\005(\273\025<M\317\006\240\374\307\006\240\357\024\210O\240\021\360\t\224\305\034\260J\246\345M\273w5\221&\335\236\210\365\371\225O\240)\373"
+	.string	"a\223\341\347)\177\227\tb\355g)?\347\234\017\212\224\243Q>q\202C\215\251\322\376\243p\001\255I\331\317\032\374\274\032\301c\036\374}\304\006\261\237},\371y\b%\377\343~N\"\007C\330\317E\374L\304\001\177\217\371?w\270\367\241\340\"\004\374=\344\370\277\377\376\222\005\354\277\035\026v\032A\310\317@\032\376\273\360\337\201\377\r\3140\340\357\267\237\321\237\223\034\344("
+	.string	"\370\177\3637\333\201\177G\371Y\350\353\347\337j?{\375\274\365\363\325\317U?\357\3709\307\317O?\323\370\031\371\263\020?\367\360\363\016?\253?\027\177.\3729\207\237a\374\374\342\347\241\237\205?\007\177\236\341\347\030~\246\340g\024~>\341\377\337\377,?\233\3603\t\377\315\376\263\375\334\301\317\033\374\214\301\317\026\374\\\301\317\022\374\274\363\377\210\237o~N\177\346\237\377\277\356\277\330\177\025\377\345\376\227\370\373\373\373\373\255\230\377<\341\037`\031?\322\3442J\211e\031\325\243l\"E)\223XQ|\327\345e-n+\026R\3516\221t\356\275L+\023\231s/\022\324En\351\246\213\225\327t}\\\256K\262j\335{\357E\246\335e-o\326\244[\2474\262\204\241t\357\335m\242"
+	.string	"\311\310\245\233\204\344{\225V\250{\223\2267P-\331n\t\352\352\334$\022SR\3262G)i\271t\215\374\340(e3k\031\304v\326d\336\244\025\311\314{\207\005\2256\221lF\247\371E\305\264\242t^X\346\330JL\361\241\206\243O\264N\303q\342\005\007Y\237?u\240\255\315^\333\214\313.\022\307F\230\253\270\275{\251\036\310y\"W\246\315\376f\322e\311\235\"I\2101\373\354&A\357\346M\327\032\215-}\362\337\337\275|\002\355{-\030\262\233.f\254\322\264\214\211q"
+	.ascii	"\304\307\355s\311\317\215\231\262$)k\235$\007K\030\253.K:\254"
+	.ascii	"l\271\352X$\035sk}\256\353\275+\017PH"
+	.string	"\326_\032$Gx\264\206@3\244\215\254;6\264\320\330\bB\004XN\227\2523\266>\033\214\357\032\b\031\226)0L4\035\177\333\271\271\027+\fS\214\247\374m'\271*07\205$LH3\233H\007\351!]\204\233\r\326^\347-\375\005\326P-%\201\230)${M\005\326;:k'\331s\223`_R\244?\326!\\;g_\313#\355\255\346\342\346\345\272\353\247\2154G\260\364y\013\225^\b\276\034\312\243}p]\032\tJ\356\202:\253\257\032+\252E\226)${\367\336!Z\213\233\235\365s\275\267I\300\216Y\024\2625\364|c\275\251C\206\312*\244\317^\006\275\177l\360\245\245\244O\333_\322\256\352\036\334\004j\253w\016F\373Mr\275\315\022o4\310\310\231\245g \224\207\201\320w\223\364-\226\276\256\223\244\357#\351\311>hKu\337h\034o\251\216\312I\266\324y/\022s\002;\314\t"
+	.ascii	"\337\204 5A\317\367\220\364\275\365\344t\02616f\256\211\233\355"
+	.ascii	"\364fj\247\266\321#O\247G\023\027\336YU\003\356\214\"bEG\243"
+	.ascii	"\225Z\266\252\240\365\251\324K\334l\345{\306\232\344\263\035"
+	.ascii	"{\257\217$\230\025\264\262\223\326\373\224\001\337R\333O\212"
+	.ascii	"\0246eL{\\\350\331K\351yM\3727\222\001<\253\216&\255F\366\265"
+	.ascii	"\201\2232\223\327\347\337\212\344\245\013\\\231\364,f\307]\310"
+	.ascii	"\304p\361\022\006I\226\240;>B\f\fo\331\3431|\206\353\250znR\312"
+	.ascii	"^\236\332\036\177\3413\256\243\332@\311\035\037\257a?\356\343"
+	.ascii	"4\234\004\253\341&\3571\230s\030\026\223D\333\343\272\256\017"
+	.ascii	"\304\276\344\245\370I\301\243\267\004m\252\347\264\373\030\024"
+	.ascii	"IJ\023\310\310\344\335\273\3521\032n\362\231\377\254\367\246"
+	.ascii	"M\020z\314\261>m\326\361\230K\234\026\217>-\326\337l\344\350"
+	.ascii	"\262\256\320XY\331\253\237\245\365\262\303\211/\214\207\253-"
+	.ascii	"I\317\307\355\025\257\3355\323t\233\r\334\262I\007\231\252\252"
+	.ascii	"\266\003b]\243$\314KH\021\277uj\312\356\300c\332H\351\200\352"
+	.ascii	"\263T\267;\310\340$q\245\206\362+*\312\346\370YZ1IL!\341\036"
+	.ascii	"yYV8ns\234Jv`k\372\264R\355g\321\2504\217\364io4\220\264\212"
+	.ascii	"\307\322\323\337\316\034lK\346\372\274M\016\0336\354\023\227"
+	.ascii	"\335'\024m\231fo\017\270\367\307e\313:\335>\365Y\321\350\323"
+	.ascii	"6q\033\260y\025\307\327\247e:\236\232\fK\362%)\311\322\340c\242"
+	.ascii	"z7H\231U\336\322\320\271s\222w\325\247]j?\036\247/_d\372\264"
+	.ascii	"I\253\224\323%\r\0240V\311\316\2605\306\364\326\372\\\305r\236"
+	.ascii	"\236\276\226F\240tOj\370\334\322#o\221\375w\233\274>\372\230"
+	.ascii	"7NcKY\306R\276\363\365\337\317\322\202\361\233B\002\304\343\005"
+	.ascii	"\251Eo\315\373\357\355L\210\225\244_\273\315\331h\362SS\027\205"
+	.ascii	"\004[ru\312\372\262n_{\245T\206\200Im\355\355\265]\024\277T\007"
+	.ascii	"\22328n\240A\323q\351\027\336R\333\236Us#\312\334R\2312\255\327"
+	.ascii	"L\2333\033]y\227\252\007\020\216U\023\2253}\352\231\321\261\006"
+	.ascii	"\244\251O$v\332\226\324\344\372<z\323\003\303\220!\323x\350\223"
+	.ascii	"\252\245\266\275;>\270\260>\361\270\r\347\213\211\322\017+b\232"
+	.ascii	"-\206\333z\275P-\260@\255\017\034x\006\006L\3071\325\265_\306"
+	.ascii	"\226\332\302n\332f\214q\r\271\273\3538\023.\220\256\245\266="
+	.ascii	"\236\252)/E\360\350\322\245\355\322{\257\2271L\034\251/]O\372"
+	.ascii	"<\360\211\013\227\266K\221\214vG\005\004\244\272\"\365\327'7"
+	.ascii	"\333n\213\021"
+	.ascii	"0'j\264h\351,?=\353\315\252b\2425\224j|\335a\301\322Y~\312.r"
+	.ascii	"\207K\217\036\017\344D]\341\321to\366pp\031\353\223\356s9K\250"
+	.ascii	"\233D\331rl\025\351\363\257\327\320j \253\300\301u\\j\323\324"
+	.ascii	"\343g\336qR7D\210\310bZ\3237\224\216\362\226r)m\205y\236\250"
+	.ascii	"QA\001\375\355\366\266R\005\350\245\f\016\035U\336pz8\251yq\026"
+	.ascii	"\246"
+	.string	"\222\266C\327u\206\206\312\231\212\022\030uF\244J\237\275\326m66\340\306\266\332\232\215\006\020$\362\376\326Fs%\314\255\317fOa0\377w\316\240\205\271j%:>\214\240I\036I\217\336{\003\270^\250\244\034\224\201\314@\277\016[V\300\376\3771\272\027y\306\324K\211XC\252:\002\027\350^$\224\262\211\2054\241l\"]\245Y]\224\t\345z\177\fp\233ZW\271.\221\347\022\331w\275I\254\250\233\\\"\215\312\365B\335u\211\354\271\311\250\036\345\212\204T6\261\242X\331\\F\231\270\311\213\274I\244FE\342\321q\b\003\221\361\306\210\252\305\"\213\025\210\214\3660T\304\030\252G>\034\255 \036\207P\224\030\022\026S 2\2426\207\241\"\005\027Np\361B\320\004\027 \244\300\"'\200\303P!t\024Z\3613T\205CF\031AU%\n\t\005-\b\022:\n\001 \243\350\004\214#\242\021\361\205"
+	.string	">8j\020\035\022\t\217E\325E"
+	.string	"C\"\237\341\017D\027=\303\243\fUH\306Qu!\300\020\261H\b\303\0211"
+	.string	"\225hD\304\031\026\021Y\304(\036Y\b\213E"
+	.ascii	"\250G\241z\3443d4<\006\211\214\301\240\211\242\013GDFDU\035\272"
+	.ascii	"\030\252\304#\017'T`\241E\013$\2200dD|\201s!\342qh4$JO\201\005"
+	.ascii	"\020XpA\0176\303\340p\250\250\302\360(\243\210(|\241s\030*\324"
+	.ascii	"\243\2421hT\214\021\243(\264B\035\022\035\205*\002BU8\002\216"
+	.ascii	"\032\224`\002u\030d\341\243\006\217\303!\341\320\204#\023j\360"
+	.ascii	"\250\032o\016C\005\0038\260\032\034\032} \026\t\203\301\3430"
+	.ascii	"\206pxT\217\202\013\360\300\307\341\213\0272p@Ua\037\217C[T,"
+	.ascii	"\206\020\004\026\213\214d\244\307\242*4\"\3068\016U\034\030D"
+	.ascii	"\360\031\342\020\024\"\022\tc\244\352a\250 2\256 2\372\b\031"
+	.ascii	"\311`\241\016\217J\030\275hux4<\002\217\202>\034\325#\"\321\260"
+	.ascii	"\005\2211\007\206Jd4,B\217\216\206\307\241!\241\215\017\306\242"
+	.ascii	"\320yT\215V\r\016\035\213B\303\026;W\340E\343\360\270B-\026\217"
+	.ascii	"+J\020\031{h\250\203\220\320\210\252A\013\202\322\341\017\304"
+	.ascii	"\243S\r\032\021\031\201FDFkT"
+	.string	"$\036\035\207;\330\250\301\013T#\242\f\233\007\005\211\200\300\013+\224\220\n\251\210Q<\032\207\303 \021\361\205QQh\205\021Q\030c\205\320\361h\205\212\004\216\210\204E/\200m\326\013\030f\313\022\"l\035\027\002\022LCL\371;\223j\260f\254\265\223\033\346S\224*R\326\2668\034ZQl\023\255s\373\302\004\205\211\216\025$JZ\236\320\330\322\362\345\345\304\346\270\361\353+\033S\333\201%\206\314\252\315\314,\332\r\024\324\275T\033\320\251\311;\273E;\323!\202\324\205\267\246I\0344\256\025J\227\225\3711\323$i\272\343\013\316\312\032\321L\3125G\254\207\227\353\225\356\240H\202,\261\215u\226\022I\210!\273\023\273\272\321\n3\342g\227\330-9\270<\267^m\332\254\224qJ\322V,\2300\245\2530[\204\033\333\033V\333\0316n\n\215!}Z#V\b5\367\"Y#m\221\330#\267F\316\234"
+	.ascii	"s\002<6waJ$\364\264L\313\264EN@\032\373\234\370,\221\333\"\026"
+	.ascii	"\216\307R\221t+\375\355\2206tjF\337\023\013f\237\2504\327V+\304"
+	.ascii	",\351\226\234\nb\247\266\243+\253\317\256.\353\265\306\004\253"
+	.ascii	"H\001L\3144 \267^%\254\230=\225\265\232\365\022\025d\211\337"
+	.ascii	"\217\037v\213\271\230\234\370>Xb2\304\355\326\022\217)\327\247"
+	.ascii	"\325\3526!\001\202\263\2502\0019F"
+	.string	"\022\0253H\221\214\210$I\222\016\222\n\020\004Ca\236\312\241\007\022\200%=\023*\247Df$I\322\336\001X\311[\b\324\246\357\002\374*Q\275x\220\245\234\233\244\355\030\033\005\177\261\342\231Vf\022Z\210\035\\\201Q\034\225\322\0202:\220\022\235VJS\261\032\267:\307\035\202\255\316B0/\227\304z\b\212\333\204\347,%'Q'\2517\341\0028t[i\203\024\223Cs\232O\006S\203\232\231X2\266\303$d\263\250\ncc\037\004K\nJcS\267\231\323\027\321\257\001.\371Z\244m4\250\370\026\006;c\322\224\273r\006\373:\330\227\366\t\"C\315N;\021\002\016h\335-\022\300\340\262pdexk\340!\230\274\035p\302\024\316\206B\271\004j\003~\263y\25187C\277\307\r$4\225\002\326\244\365\214\332\002\204\203'\324\332\342\224\226\322j'\026%6?\017\302at\275<{a\205K\310"
+	.string	"\372\370\352\022\203]\274\215\r\317<)j\203\023\005.:Q\0208OfrR\322\307\200\264\314\"\202R3B\257w\001\002\315\327[\363`G\327o\264o\034\272\315\320vW`\352\356[{\266~\327G\316\003\312z\353\314\"\034R\214\242\341\236\362b\352\207\020\274\020\340\301Mkd#'.X\367\256\323JJ\260}\247\275g|LR/\020\027\217!\275x|\370\220/\252p\307s\316(T\212#\301>\206\200\212\370\360g\253\346\357\334\342\326\250\300\003\375\321\314\311T\rW\t\277\270F]\3622\335\257\271\323w\324i\224T\366ZU\2470XB\213<\335&"
+	.ascii	"\232\205\324G\275\251\270\266k,\212#\304\025\327+\350\241\352"
+	.ascii	"\351\367xS\216\212\030Z%\245\240\267[m\004\2103 \306f\"\206\223"
+	.ascii	"\027\020\331\023l\360\033 ]\223\324g\201"
+	.string	"\003,\352\340\003\232\001\224\023\226\370\306\")w\373MNe\331\205U\351\262\330\334\233\202\334t\351\3072\r\004\250\260\274\353N4\270i\355\351\345y\310\026\355\020'\334I\252,\276f\020\256)pc\240e\307C\242\326\367\274\2321\244i\271e\250\206\345ll\211\270\340\261\371\2309y\354\261\201gP\025\246\210\273,~\302\";]\215\254\3758\221\305\375\366\322d\343qG2\264C\004\365\345\352p\353\261\367\336\b\352\025\330q)\370|?\025j\036_d&\221(\216\313\275\250:\221\202\254&\326\252\273kJ\177\016\374ZQ\037\340\371\320A\357\254s\322\315\263\250\357Q\022C\275\024\006\026|HvYTG^Pz@\365z\361}\371\222u$\274M\0261\373\365\035\007\241\337!\373V\006\302\025Pa,\\Y\264\251\257\035u\322ww\320\031\nr/\242>9\264l\257\273r\344\227\270\3065\273 \t\363\256"
+	.ascii	"GA\351\032\240n\301\f\306\270\3016\337\307sFXP$\252Cm'f\365\313"
+	.ascii	"7dg\2730OI56C$\261\020\242\247\210\002\345K\355M>\326\342\370"
+	.ascii	"\3616\2172p\"\221+$\024\033\306\321v<\363\232.\262tm\306\005"
+	.ascii	"\356h\3206\353\241\334C\352\205\021\0248\026\355]\004)L\212\207"
+	.ascii	"\227\313\214[\222\230\253^\350i\221\250\211RaG\240\253\200%F"
+	.ascii	"n6\024z\037\037\270\023\027`\3749\344n\2112^\034[\304\276\365"
+	.ascii	"\370\303\255\222Y="
+	.ascii	"\300_(!+\203B\333\3763$^VO\214\231\030f\342\243\224\006\024\370"
+	.ascii	"`\031z\270\017\003\305\213R\301\026H\2336!\026\357\200\3436S"
+	.ascii	"\2553\2440\344O\275\233S\034\350\003@Lu-{\227(\237\357!\225\001"
+	.ascii	"V\352\262j\336)\\r\344RiG\207\211\373\365\341&\311\2221\215T"
+	.ascii	"kJRE\007\263\\tQ$~\f\023\233B\350!\205>A\221\320\347T\270\320"
+	.ascii	"G\225\n\374h\2079&H:@/\261Y\336\257\371K\265\005\266\2378\356"
+	.ascii	"\301j\260\336c\013J@&\243\263\227P\364\265D\024\307\212Y\341"
+	.ascii	"\001\005\325'hMH\244r\006\304LA\315\f\244\226\374w\340\3141\300"
+	.ascii	"\005~\221\334\352\343\343z\300\323\036Vv>\230\323\377\217\372"
+	.ascii	"\312\261N\035\353\3212A\227\301\210\240\017&(P\245k\333\032\037"
+	.ascii	"cY3\263\251\240?\314\017\016ON\333\250\200\351\001c2\037\350"
+	.ascii	"\242\317\360\227]\214$\357\253\243o`\301\2622\320\357\373\215"
+	.ascii	"\214\372pq\354\036\\\343:IF\006\026SOmn\303\034\325\357r\317"
+	.ascii	"QNG~\232\230\016.\214\214D\375Y\315\027\221k\233\276\274\337"
+	.ascii	"8\304[\374\334;h\377O\340#\336\236\363+\325{5?\216\334\301>\247"
+	.ascii	"\335\365E\203,\313\374\207\310#\360\377\267\027\351A\347O\272"
+	.ascii	"\024z\177\257\355\n5ae>\277\316\f/\006\306e\327\315ehzo\276~"
+	.ascii	"vY\325S\245c\333[\375\360Vo\206w\255#\3327\356\367\342\205\353"
+	.ascii	"\022\375\262\2371i\016\2643s\351\026\313\002d]]\375\274\367%"
+	.ascii	"6\037\3546j)\373\027\252\016\f\327k\301\212c\304\020\355\265"
+	.ascii	"r\266\002"
+	.text
+	.section	.gnu.lto_.symtab.5612ccc4f226c126,"e",@progbits
+	.string	"loadEEPROMFromFile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"getEEPROMStorageSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5612ccc4f226c126,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
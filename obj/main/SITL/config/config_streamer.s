@@ -0,0 +1,532 @@
+	.file	"config_streamer.c"
+	.section	.gnu.lto_.profile.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375 \264\275\003"
+	.string	"D\005\250"
+	.string	"\t"
+	.string	"\330\355\273\207\006\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\241\210\323\235\t\004\002\003\002\367\346\266\265\005"
+	.string	"\003\336\367\336\247\t\n\004\003\002\002\004\372\203\243\344\n\016\005\002\005\002\006\005\265\234\352\241\r\006\235\220\277\362\b\b\007\243\254\366\313\016\006\b\240\342\234\212\n"
+	.string	"\016"
+	.ascii	"[`{\261@Pl\204j\005\034xq\n$\270\004\334\345\365\264\240fS2\361"
+	.ascii	"\261#k\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375 \256\355\002"
+	.string	"\342D\r\023\260%\351\f\316\3610\f\303@F\205\311\336\244I)e\nK\264\240\350HxV\213\034\017\001Q\362\276\202Q\236\373*\200\033\323\254\3156Q:\352O\246=\017\002\017"
+	.string	".9:\0064\264\332\303\204\246y\204\013\300E\210\027\312\220:\300T\323\005%\003%\b\232\223^\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`y\0025\016"
+	.string	"\206\327J;@m\222tW\222\301Y}9Wg\003\334\347\230qqN}\327`\021x\177j5\t\214\005\360\3561\367\242c\243\001\346\001\303\344t\2601\240\374`\034#Zk\033i\255m\"e\n9"
+	.string	":"
+	.string	"9"
+	.string	"\275<3k"
+	.string	"\245^~H:HJ&\346S\365T\365\007p\214\335\373\356E[k\215\367R%!\002\322aO\255N\210\r\207A\254<*\331\231\321\016\034\rB\002<{\035\b\274\262\356\330\307.\356\263\370\250B\330\300\301 \272gq\317@7\">8\340\025S\325\264\326\236[\001=\202\326Z\202\217\226\312i\201\254\300I1G%\334\200\236\224\342kn@\223\030\332\246\203b\375-\237\262Rv\225\320"
+	.string	"\362A\361=\341W \303\031[\322c\254\005Q4kj@\224^\356\264\224\3431\"By=\177\252V\353\323\262<\264\326\242\373T\005\223\027H)f\202\307\b\005\351\210Su\0022\2351\r[j\230\327\264\254\021 $|L\f\335\335\244\326\375<U\023\340\320'F?^\331\322\007\234\220\f\2757\243\n\",\350T^\243\001@\250\361L\307\224L \"\nR\320\342\034`\242RB\327\003\022`5\035\313\322^X\225\026\326?\213\001\034\3500\214\251\312\354\2535\252[$\331\200\275\311\225\206\211\275#\235|\2416z\226U\373\250\241$\332\200A\002\323\352C%\276\001\324\027X\360 \221**\250E\304i\346z\373\203\242\024g\375\200\331\272[}\241\t/\326\253\252"
+	.ascii	"e\206b\220\3036\340'\371\200\332\032;\r\254\204h\206\n[\362\207"
+	.ascii	"\245\2153\323v\377\233\212\252\221Fi\274~\242\205\rX\315\t4\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"\305\004"
+	.string	"b\311\030\037\240%I\007\217\256x\025\030\371\017"
+	.string	"@\024\325\377\253\032\201\217\027\016\313\254\260\315\222\266IJ2\333WQ\202\006\222KLq\365\214\005J\340WQ\363+J\224\356\300\354\006\212\303E\320\nWq}\005\250\245\034\207K\314\233"
+	.string	"\256\310\274\353\026\025\321\3665\350\3168\347\034kB&!n\264\367e\350+\246@\024"
+	.ascii	"/BpF\002\316\013\222\2173\272\362\212\022l\340\006\302Lr&\\ "
+	.ascii	"\227\346=\231\304\335){L\231\315<\177*\330Bm\206\231\200\241"
+	.ascii	"\354(\200\033"
+	.text
+	.section	.gnu.lto_.pureconst.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\231\004\002\230\004\003\232\004\004\232\004\005"
+	.ascii	"\205\004\006\232\004\007\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\305\005"
+	.string	"\202\210\032$\2205I\007\240n\317]\267Y\225\202\306\376\253Q\027\362\242\347\013v`s\372\216\264\277\251FHk\204H\231\002\027\f\007\302\361+}\250\002\315B$I\307\343m\355\f\372\031\033\025\300,(\275\263\263b\366\315{R\264\026O)O\r\204\022\343i\022\013"
+	.string	"\3667\243\"i\371\367=\347\253\\P\263'\271j\177f\351k\344\211\b  p\002\021S\352\0010\002vO\303\034\b10\304\\eB\213\f\241\027\350\367D0\260\315\240v\371\212\244\267\026\021\203I\353\\\026\244\013\0247\204\360af\316-[\214>\361\356\211\202=\342;\353\2007"
+	.ascii	"\024\235q\331\307n\021"
+	.text
+	.section	.gnu.lto_.lto.e097b7f313563f2c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.10.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\007"
+	.string	"\242N45@o\323\001\230\002\344\003\200.\225\304\233\3271\363\213\006\301Uq\206\266\277b'\016\270\215\264\343\355 b\255\243\224]\374\034\006}\220\340\016\036\333\230u#[\246\024\226kq\262\353\323\2712Q\310\001\302\363"
+	.string	"\302\254\b\362t>\321\312B\221sP,\342\312\242\b\303\262\270\361\356\351\260k\303\313W\001-:e\201\233R!8a+1\221\346\232&-\337\005\334ZoK\270\321z\372\377\302\2565\311\316\251rY!(\375\031\245\230\177\024\312\307\246\255\263u\210E4\223(\034\360w*'\277\227P\005\215\251z\036\250Li,P\231\252\326\262\330\353\270I<0J`\376G\310a\315\251\325\0361"
+	.string	"7\332\234\031\206\377Mn\244\341B\2675h\273\320\026$\t"
+	.ascii	"\252\244\2231\215{\206\215\263\257`\336%\200f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_config_streamer_start.11.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`~\001\225\016"
+	.string	"f\032`F"
+	.string	"\221(\035\020\341M\007\346Bd+\214\253\036\374\247\256\036\030KL|\333^!\371ERrc\320a`\206\032\212)\376\021\201\221\3145\235\266m\200\273R\320\374\346\0210\367\220\267vL\322\372\235N\032\331[\356\224\002H"
+	.string	"J"
+	.string	"N"
+	.string	"\332\247\303{d\237\332\td\237\006m\033\017S\373\025\213\016\254\330\356nJ\342\340\245F\320?\353"
+	.ascii	"L\247\321\245\312U*\230q\341\350\234J\322#\305\204\351\254G\224"
+	.ascii	"\023)FN\204\335u4\235>\334\363\266%\330\206`_&V\224\375\227\237"
+	.ascii	"\363\360\237W\375RF\277\203\002\212\330\215\0024vSnl\0266c\234"
+	.ascii	"\260\375\216mm\361\025\370\027\277\244\200-\215@i\355\356\207"
+	.ascii	"\037h\237\007d\fKl\032<\332o\271\013x\225\311\007\354\242bZ\273"
+	.ascii	"\341\207\031\004\241x\223;`D\300H:z\252f\246\245\026e\327\220"
+	.ascii	"U\215R\254\261\335\035\206H\273j\212\031+T\034\2653\374\205_"
+	.ascii	"\352\212\3111\325\376\356\242D\333]\007>\314\006\r\232*a\222"
+	.ascii	"}&\360\020[q\tq\022o\354p\024\225\305\276\334\335\r\034\007\320"
+	.ascii	"'\271\317\023\"?\367\007\304\343B\036\316#\371*\210\200,\214"
+	.ascii	"t\237m\004\344\tm\037\357\333@\020\270\303\300y\033I\327y['\334"
+	.ascii	"\313U\224'\200\200\235(\311\013n\213\\\206_j@%\265\322B#\225"
+	.ascii	"\345\242\254%\n0]2*h:\321\276\020\" \240\002\021\301{\312\244"
+	.ascii	"\233\232\346c\303!\273\355\233'\312V7\232cT\004l\263=\364Z\003"
+	.ascii	"\360 \005\023\205\331m\264\2572\r\332:\347$\034\307\372\331M"
+	.ascii	"\"v\241\035\020\320\350\212\301\025\205q+t\031F\004\210(\362"
+	.ascii	"\345I\223S4\277\007"
+	.text
+	.section	.gnu.lto_write_word.12.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`\347\001\345\021"
+	.string	"f#{G\340\360&\035\330EL\360Cj\244\235\003?b\201\007\013C\036b\210\003\235\333\257\230\024\220\342\005\307\327\212\233\241\373~\004\354\252e\f\024\273/a\214q\025\343\232\020=\214j<D\234\217`\272F{;b\311\336R\246\024f"
+	.string	"b"
+	.string	"g"
+	.ascii	"\266\217\342>2\373(~:\336I\006\210Vk\232s\262>\356\261]\306\017"
+	.ascii	"\330.7\304e\337d\\\225\371(\217\345\033\327\3412:H\232\371\351"
+	.ascii	"\360^\342oh\200)\017F\343\207\256\032\274\227\3701\347Ly3\335"
+	.ascii	"\210\240&i\246\303s\211\036K75\016^e<\030\325S\310\234\323\032"
+	.ascii	"\343q\270O\267mb\033\202\255\253B\277\352\265\033\365\357\347"
+	.ascii	"\242ZFu\224\352\225j\215\352w<\340\251\241\331\tZ\031\337\334"
+	.ascii	"\020\346\230J\322\005\211\327n?\205?\344\224_S\371\230}\323\273"
+	.ascii	"\300\324\344\3234\347\007"
+	.string	"r\351\006\334\345m\231\235\262\255B\030\b\004\2303P\304\202\253}\240\007\311\376\255\\\300\2348HFs~\t\254\200\273\364\3079L*\325\265KL\3641\250\375\320\017\002\351\205\322lY\256\203\303\206Q|\267\355\216\2003N\341\273MwWc\320<\270\370\344+:\335\002=&\264\305\215%\233\335\034\203\374;\0022\315\024\207m\013'\362\0217\347d\340\253@\201q<\227\376\312v\371\3750\302\246\346\007\250EC\373c\321\315\261\277a\030\206^\034\373\001\260\224\230H\f\266\275\\$$)#[\353n\255^\256\023\021\327+\006\233@\241\204\004\245k\261PJDNX\255\027\214\265:\340\256\202\353\305\212u\335\213\225\372\346\343\2142J\310p\202V\024W?\370\b;D\264\"\375\312\225\261-\327!-\353\022\347\234s\003\240\252\345\326n\271\3641q\017>\344EY\324hJ\310x\225\r\265\006z`\200\001\037"
+	.ascii	"\252\322\275a:\261\026\202\326\006\364`\017\264\")\301@.\\\245"
+	.ascii	"G+\033\320`\205]\2601\025\253\344X5\021^;\301\270x8\246\r\317"
+	.ascii	"k\205O\\\346\350\241\217\016\345\201\302`\230@E\006'&i\203U\b"
+	.ascii	"m\t\323\301\257b\006"
+	.text
+	.section	.gnu.lto_config_streamer_write.13.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`2\003]\027"
+	.string	"\326\252\225I\300VQ:Ec:w\226\257\315\200h\bN\f\201i \344\202\231\224a\264U\336\273\376\213\363n\300n\377\333\360\360\034h[y\006\363l\033\300\206\004"
+	.string	""
+	.string	"\240|\267\005dH_\252ev\3211\361\225\330!\204\354-e\222\001\200"
+	.string	"|"
+	.string	"\203"
+	.string	"\244\211\017\2505\347\304H\255d\203\205\020\236.\031\236\307{\310v{\223\324\215\027\302\202\333u\251\265\252h\236\372N\347\t|\247-C\306\223\374~,;\370\321\331,\333\357>w\224\2458\362\034\234\240\315\207\306i\304M\033%$\243\027\235{F\032\177\001j"
+	.ascii	"\235\262\370\234\020l]\\\234F\333\024\240\204\223b\032k\334/"
+	.ascii	"\372\202\245R\034\201\316\240\205Z\353\2628\252\370\206\337]"
+	.ascii	"\237\335\255\260\333\031\002T\276\350\030\232q\331\274#\333\330"
+	.ascii	"\035\264K\362\260\215N\ti;\267\233\232\274\250\223\377\351@~"
+	.ascii	"\230\377\370M\347}\303\220\027\004y\277\311K?\336Iy{\362\362"
+	.ascii	"\344\275\314\207\237('\270\324\352S~\251P\250\221\320y\337}\220"
+	.ascii	"}\021o\347\365\366\003 \205P\026\244Z\311\232\323\245\020\236"
+	.ascii	"~W\266k\332\335\346\003\0311cj-\206\213\t\374c\247@L\255\021"
+	.ascii	"\241\210p\336\375\320}\310\036(\236\"&\245x\366\251w1h\340\213"
+	.ascii	"\264il\315\263{%\261\031\235\270\273\341G\035TI\024\314\346P"
+	.ascii	">\021\201\226\311\013\033\271\331A;\277\275\217\333\200\217+"
+	.ascii	"DUj\254\264\335\273[\342H<\310\350j\2556\273\253\033\261R\272"
+	.ascii	"\326\217\2048\205\351-b\322\354Ep\\\341~\247\347\256\247\005"
+	.ascii	"7\221\031\335\305$\006\177sw\357\006\203\306\345\356\212\370"
+	.ascii	"\220\355\205\265V\t{!\037n\302\031&\276\323\367\213\236 :\253"
+	.ascii	"\234n\221p\305f\316Y_\226\003X\353f\325\202\351\304<\204p\201"
+	.ascii	"\300y\261T8\256\325\215\212\005\213\251\034 \330WN\013\246\322"
+	.ascii	"y\275`*\023Y\3379T\323\314\232\266OP\375\335\017\034\225^\206"
+	.ascii	"f\\\202\035\264\017D\232j\260\005\233:\354\236\260\301\346\035"
+	.ascii	"DV\27665\330\277\335\200\351\257?,\270\245\031\227\237\265\326"
+	.ascii	"\372=x\330\251\376~\226\312\333\r\032\227\274\202\326\274\t\305"
+	.ascii	"\261\224C\013\355\335\013_\262\2750@\250a<\207\f#\b\225\004#"
+	.ascii	"\021IA\272\032p\002\021B\253\003\021\320A\"d\220l\035*0\316\001"
+	.ascii	"wG\036\274,\214W\355\366\214\201\305\203\312\206(?\020\251 \266"
+	.ascii	"p%J\255F\254O(\352\231\362d>\245\337\367/*}\237's\335\3147%\001"
+	.ascii	"\006\252\345\363\313\225\260z4h\032N\233\t2,'\2168\360A]g|\310"
+	.ascii	"A\232z\203D\366-\375\026b\235\344n\016\261)\024\372\255 \023"
+	.ascii	"\237\0366\330D\365`\202\213\244\314R\225\361\250S??"
+	.text
+	.section	.gnu.lto_config_streamer_status.14.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\035\b"
+	.string	"\362\01787@\215\222\016<\214s*y\202r\273+d\317\237\375*3\316\317\017\240P\\|\264Nt\266\032V\021\260v\377\206\341\001\377\315\227\nQ\033\252\025\312\301o\375\255\021\"S[\3374\035\307\263\341t!\320CD\007\342\303m\332\247\263\361h[\007\3224\007s\022\234N\013q\\\247a\276\354\307\230!E\213\177\242$\263\262\314d\270#\025\024\231\252\330\025\305\200\025\t\266\3747\202Q\343{eL=\204\307~-\274\004P\252SK\255L\214\026\226L\301N:~\3571\177\341w\325\020\257\237\250\003\231\251\226I\346\227\260BV\354/\373\357GA\274g]\037\307\251\300\303tQ\262\222\231Z\246\006\227bW\t.\305\342F\275B\357V\244\016\250\222\212\3514*\004h\310\314\241\351\224\321c\177\204\177\341G\t\f"
+	.ascii	"\252\244\223i\021\206\315D`\232\005\344\230\320]\303\365\261"
+	.ascii	"x%\230xp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_config_streamer_flush.15.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`\350\001\265\020"
+	.string	"\226^lG\340\222*\035R\267E\243\370\004\022\005\345\305Us\300\205}\262\"\024Y"
+	.string	"\207\201Y\004\21652c0_)Fo-\363$\253\223\213:o\026"
+	.string	"e\030\235C\243x\330`\016*\3065!\006~\004\241c\021\331[\312\224\002V"
+	.string	"R"
+	.string	"Z"
+	.string	"3$\361\202\317\245\303\217m\177\305Y\260\354\\\fk\240\350D\354\345\366c\316\351\221>\352.\343\013t\227\033s\326\343*\313\377\314!\300\300||`\3531\3047*\320\301\351!"
+	.string	"t\211\243\030\211\3573\327\017\240K\325\363`\316i\375@\020\267\274\355\b\266Ml\265\020\f|[\006\016\237\021\227>Kw\3715\221\325"
+	.string	"\221i\321\035;l\351\322\354\307\2713[\325\241\207?H\325\236N\335I\265\214\352\270\352]\265\252\372\003"
+	.string	"\304\350"
+	.string	"\017\243\2313\266#d\342\2202J\330f\331\"j_\346-X\017YN`\316\231\215\233\0315\tj\335\202l\260\033!\335\035\271\\\273d\322\177&\275\266\265r\217{\241p\035F\007Q\355\263S\376\342d G\303iP\227\242\234\270z\373D\350\306\273F\267{\334\313\204Kw\374\325="
+	.ascii	"\003\243\3612\344\265 :7\2734\217\374{\301\226\303E\203\330N"
+	.ascii	"\335\205s\2379g\245\273T\2422\241PL\252\225\325I\312\t\203J\252"
+	.ascii	"\344\251\234PP^I\265\362J\0208\265\301\244\362VR)\225'\022\316"
+	.ascii	"\307\271\263\320\222Z\326\345\\h\033\310b\250\210K\233\341@f"
+	.ascii	"\223\202\207gm\t\307q\356\023@o\337\016\221v\013Z{\002\005\375"
+	.ascii	"\347Y\222\207m\331\267Y\215*\034wBR\013( P\002!c\322\016j\322"
+	.ascii	"\211\246\033lX\r\263n\353\276\211.u\310\211\221\200\016\301E"
+	.ascii	"}}hx\202A\355N?\351\372\032x\020\260\340`\323\\\220\016{\fnR"
+	.ascii	"hD\304\201\001(\fBvX\254\3410/\243\255\221\324\217\302\315\253"
+	.ascii	"q\t\017\243\177a\033\265\345 \314\337n\244\013\264\3364\245\350"
+	.ascii	"P"
+	.text
+	.section	.gnu.lto_config_streamer_finish.16.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"\035\f"
+	.string	"f\326Q@"
+	.string	"Q5\0358\351\262\f\306\002\206V\261\323\242/@\306:\013h\234c;\030#Me\022\313|\211\307W\t\370\216"
+	.string	"\354\207\366\267\023\322\377\277\001\002\204u0\254\365wg\243\236\323\332D\310\226;\245>"
+	.string	">"
+	.string	"?"
+	.string	"\273\313M.\311\216\315\017\310\216)\211\203\237*A\377\2513\030\261\341\025\212\236O\017\327i\300\345q#\200\030\232\022\221\211\360\251K\r\"HJm\301\356Z\206b\207\033\273\355\006\266\023\330\237\020\343?\245\364\267\016\205\210\203\3700\306\256\350\225cg`0N\330\006\355\210\355K\373\250\263"
+	.string	"?v.`w$\243\265;\0360\202\355\230\307\315\266\257\342'\320\376\230cI$\220\242D\206\025H\362\241;X\037Z8\\ \365\274\024\342j\2519\331\025\202\252FH\206\330\266\360\026\234mw\025\370\252\013\0306\3231\277\223\035\273\252\210\225)\304\n\324G\276\354\321#\225d\177\256\216l\225\326\036\335\335Q>\013\246b\3716\232\007\022.\0212^\307e.\025\f\327}\032\216R\300\036\005\313\307m<\357\343\"\343\336\326t\362Q\220m\314_\370CS\365`\235\246\222Vw\001\240\344"
+	.string	"\004\r\020\033\233\264+h\002\026"
+	.string	"\252\244\223i\021\206\341Z"
+	.ascii	"\034\346A\212\241sB4\b\342\n\203\255H\035\f\026\240!\023+\260"
+	.ascii	"c]@\263\206\013\343\221f\244(c\0044\021I\t\264\352\246)\205\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_write_word.part.0.22.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`v\002]\023"
+	.string	"f\344}G\340.'\035XnIB\340\223\352\203\004\275\337\347\251\n\303\270\237\211`h\304\250jG\347\221\376\266O\036\025\3735\277\311^\333\240\356\r\334V7\230a.\203C;\350#\004\252\213\343(o\036\361Z\366\204\354M\244L)g"
+	.string	"k"
+	.string	"d"
+	.ascii	"\323\246t4\347m\301\243\031\200\217\276\201\366wVf\266}\021\327"
+	.ascii	"\201\331I\336\355\206\366\305\360\274\344\240\346\234\341\243"
+	.ascii	"\306\021\310G\357\007\344\343~8\354\321[\2250_ah,\217\033\364"
+	.ascii	"\344E\227\0231\246\035M\303\327\203\260\224a\007\203&\363^\343"
+	.ascii	"\204\373\356\032C\213\251\032\270\374:\346\234\006i\356\357\266"
+	.ascii	"=lG\260U\027\033\325\372\334\177\001\241\323\200\332\2343Q/f"
+	.ascii	"\207\210\224s\335_t\277\350C\376\b\242 \237\310)\220e\006\032"
+	.ascii	"\311\344\254\270\037\264\342\357\234\262}\335\205P<\273\020\212"
+	.ascii	"\206\3546i&N(t\240\346\274m<\372\001\b\263S^}\016(e\201R2\bL"
+	.ascii	"\031\016D\003\325\377\254\334G%\34361\314\254j\277\3477\330}"
+	.ascii	"T^`\0069KBs=x\037\240\266\264a\327\306\336Qd\334\214\020-pM2"
+	.ascii	"ua\f\325\365\326^\205\350a\342j\\X\026\333\"'1\002\3169\035\370"
+	.ascii	"H\024H|\234G_E\002\340\361\217*\260|\034?E>\352~w\0054&bLC\034"
+	.ascii	"Z4J\327\306+\357\315\265\331\237\032\224\352O\252\345uw\224j"
+	.ascii	"\357?\177\256\223\327\307\313%[+\020\220\223\tRu\2538Z+\222\217"
+	.ascii	"U\353\345\362\b\021\001)a\251\302\022\221\017\222P\325r\205\034"
+	.ascii	"\t\3142Y\265\302\027\213\325\nS_\233\277\231\246\027#o\343\337"
+	.ascii	"]\202\f\317\213\321Z\270\223$\2701\266\301uG\313\306\274\367"
+	.ascii	"\346\267J#{s\030\026\336G\244\334o5\347R\213iT\t\271\262\307"
+	.ascii	"V\333\331\357S\212\032\025\236\342\0021 \200\002\031\263\253"
+	.ascii	"\003\352\351\234Z@y\246~\025\026\324a\314,\362*\003\205\325\013"
+	.ascii	"b\035M\313\343Pth\302npm+\260\362\3571\nc\033\234*\203r-s`\007"
+	.ascii	"h\351\021\346\\eH\347\212\215*d\222{\0314[=\2536\004\361\t\332"
+	.ascii	"\214ov\211$\221\033$\275\223\255=\355\006\b\355\036\232\254\272"
+	.ascii	"v/\f\364u\342\b\240\274\367Z<\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"}\006"
+	.string	"B\t#)\200\253\016<ZT0\230\022\303\325\254"
+	.string	"\206\311\t\246\372\222=\314\003E\261\031X"
+	.string	"\374\377?\331\356\222\350.'$\222$S\n\313M\201\226\020\226\315\233H\256\346\021\351\330i\356\244\356E\024[N\216\037\3061Yn\2760{!\230\201\270\271g\033\341\332\301/\203[\005\307\370\351\357&\b\236q\3032x"
+	.string	"\233W\232S\231\013\030^\bb>]\036\305I+\226C\262k\255\265rI\361sR\312\256\357~\224\235\377\177\312\267\270\273,\t\033"
+	.string	"`h\227\241\263\032\f\002\002\2038t\f\225\031\034\250\035"
+	.string	"\035"
+	.ascii	"\235\017d\317/\205\2030\036\266fA\236&\320;\364P\3607\300\037"
+	.ascii	"\251\004\230\2010;\177Te\221\253n@p\301q:\230N"
+	.text
+	.section	.gnu.lto_.refs.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e097b7f313563f2c,"e",@progbits
+	.string	"(\265/\375`\322\017mN"
+	.string	"\312\204\024\035TP\022&\r\007\373\037\237(G\320X\332\221\222\330\303\210\274`d\210\271~\234\007\277\310C\264N\204S!p$\243\235:\360f\004\331\b\363\200\333\363\354\266\304\373G\210\202\200(\007Q\242\316\314\210\031!\256pE\352v\224E?\330\201\245\035\025YHm\"e\ny\001\272\001\314\001U\350_\330\217\341\276T\350\027\007\372\303.\267\354\213\203\036\320\326\272\327;\360\0031\027\210\025S1\354\236\342\201\342\t\030\257,\266\356\036b\227\354\272\314\237kOO"
+	.ascii	"6]@h\205\341\316\257\330WI\n\335(tjbk\017>7\210\025bW\0016\311"
+	.ascii	"\203V\374\026\334j!\2726\036\332\276\360y\036\372\346\n\200["
+	.ascii	"$@\337\260\0228#r\355\033\n\252r\364\300\347m\b\375\016=\n\350"
+	.ascii	"\313V\007\367\023\320\267@q\212|\354\274b\022\245\370\374\267"
+	.ascii	"\353\337\254\025\262\313[\361)\331_\335kN\r\226\032`\202|\356"
+	.ascii	"\220\325\332\225g\211|\267\226\3539\342\332\313\356\365\206\206"
+	.ascii	"\371Bm\214\317\235\325\301\235?\350\177\037^b\253W\234\321/\017"
+	.ascii	"\356fyp_W\007\207n\t\334\277\b\200\220\300\315\317{\301g~\006"
+	.ascii	"B\372\367\003\265\237\370\231\001\023\n|I\222\377\314\377J\376"
+	.ascii	"\037\261\366\237\312\262\370\017\200\212\243\370\231\200\377"
+	.ascii	"m\313\301\277=\033\254\006\315\377S\376\255 \203\377g\377\321"
+	.ascii	"\376WQ\273\356g\235\177%\300 \346\347\334\277\027\374k\301\277"
+	.ascii	"\023\374\273\300\277\t\374;\300\277)\376=\361\257\211\177q\376"
+	.ascii	"\235\371\367\374\337\374\367\377\305\376\247\375\337\362?\312"
+	.ascii	"\177\024\376\227\360\277\311\177\256\377Y\376c\371\177\345\177"
+	.ascii	"\213\377j\377\273\376/\377\013\360\177\354\177\256\331l6\177"
+	.ascii	"V\177\036\3764G\0023b\3266\016kp\033\263\313\363\353\366\266"
+	.ascii	"\005\374?o\003\230uG\345\330\202\376\b\023\336\340\235\346\351"
+	.ascii	"\016\032\213\313\251`Nq)\354bW\3311\247\270\266\024\212^\346"
+	.ascii	"\350\342\232\f\236\311 \367\332\304\251c\023\223A\245\342\332"
+	.ascii	"\306^\223A\234&\036q\212\2530X\\N\035\267\270L\036s\232\330\301"
+	.ascii	"&\n\245Pb\362Xl\222<\342\024\227\302c\2218u\334^\223\275O\224"
+	.ascii	"\254SA\246^\nu\335\375\264*\2035\335Bc\007\241p\214\236Z\213"
+	.ascii	"\3218z\313xXstww\360\013\215*\231[\207]V\004\222<b\352F\353\030"
+	.ascii	"\017\0047\270vwS\017\203\333\315\264\032\273\207\311\024\220"
+	.ascii	"\3115k2\266\256\211\302\247!U\262\206i\230lj R{,.\251\222@B\024"
+	.ascii	"Y*{\270\006W\331hSFt\031\\-\272e\025\362iK\356LK\r_h\350\277"
+	.ascii	"Z\2304C\226U\216d\301rs\032\262%l\025R\003\005U\225\\3\223\311"
+	.ascii	"ZB\365\305WV\255\002\0368\232\317\264\0249-[C$K\320\226\210%"
+	.ascii	"S1,\262\320jb\204\212\222\353\353L\233\\\367T\025%\2233m\210"
+	.ascii	"k\001dMY\260\244,\225\255\262g;e\255\354\272h\353\344k\304\226"
+	.ascii	"=\305\332M\\!\377z\375A+\026m\237\254\231Mp"
+	.string	"m\250 +MY\330\026\fm\217,\323\206\210\323D\253)k==)zzP\251\325\307\016\233s\315x\243\354\021_\263\205RC\\\263\263[\270K\200\315.\0011\314\036B.\334\371\r\002\375z\241\334\253\203\333\331 \350\026\261c\273~l\233\374\204\301%H\023>\277\001l;\370\207\023\252(C>\371\312&I\223\2211,\224}\234\225\177.\227\004\207\216)\245\325\237\223\001;\273\241\254B\177\346\340\301\203\253\026g\035JQS\212PCJ\026\034\316UH46\035d1V\276f\020\301\347O\032,%\305;v\253\241d\274\256D-a\353F\362\340\326\242\026\023\325y\007\333 \003\030\021$\237\254\003\207\264q\003\2273\224s\374\334J\352n\302\032da|\362\324\222\261\325\217\033c71\364g\033+\333\340(\026k\007\203\300\214\310\005r:l\020^\361y\216\372\371\006\323@\264\271\352\"D\311'\327"
+	.ascii	"t\306\221\273!\354\005\024>\267\331\334\0228\234\346\356-\201"
+	.ascii	"\373\315\b\022\311c\206\215+\t\032\256j\324`\032\013\245\\ d"
+	.ascii	"4\027\r3f0\215\034\222\202\034\234\2249\246\027Y\302\030\316"
+	.ascii	"4\230h\221\036C\020o0<=\261\321G\332\2146\266\263*P\216\200:"
+	.ascii	"\033\231:4\260\265(>Y\306\215\214)Uj|r\214\315Rs\306\345\007"
+	.ascii	"*\213\004\316\t\024\030/W\230\230\330\t\305\351a\224,\345\r\212"
+	.ascii	"\026/4^\234\235N&3\2536>\271x\363\022[\006\341\223\233\226\354"
+	.ascii	"\206\215&\2503O\031\204\310\"#\002e!\013\231\210\366rY!yh^d\221"
+	.ascii	"1\371d\242\332L\027&N\3050\254\204\fF\214%\312\306\315\266M\\"
+	.ascii	"\367\256I(\343&\261\\\276"
+	.string	"]\336e\233h\260[\006\206\326\2146\266F\032y\376mc\326t\253h\001kL\310\347z\3310h\326\224/B\302\200\231);\006\255\322t[_\250\232\317\375\262N\326F\305|X\305\300\347\221\330.\235\222\211\022(>\3174\320\263\020\375\371\307u\007\351\356hh\207\210\3473\352\001}K\272\025\206~!\314\230\360#\037#_/U\201?<\242%\244!_\357'\005.\375\234@BZ\362\371~>\031U\b\347\342\227\036\251?\237L\321\216\207t\252<`\022/\t\3073\332\221\300\003\356R\016n~\344\023B\t\037\264\370QyF\351N\335iQC\224\376NH\332\245F\277\224\004!\026-0\b\241\203\234\235\272\333 \351\227*\361x3G\300\236\257Wt\004\\B*\002.\251;\025x\"\335\251@\035\265\347\353\231\370\320L\003>j\272S\362!J\177.\204xj/u\221\363\241^\312\363\361\214\320?"
+	.string	"\001\003\020D\300\202\214*\024\344"
+	.ascii	"\252\"\375~\031\b\305\020\361V\030\372!\371\226P`\216*\224\252"
+	.ascii	"J9 \220\227\022\021\355dx.\364\200\347\217\016\370O\211\227\376"
+	.ascii	"\250\277_\372C\243\nE\240\372zK2*\254\213\305\251;NS\336M\025"
+	.ascii	"\342)\265\240\n\371\214zH;\241\224WT\264\244\202\220\001\007"
+	.ascii	"\002\322`\307\204\021<@\207|R^\322\216\227\252@!\243^\221\357"
+	.ascii	"7\364\343\353\355\222~\206R\340\217\217\001Gx\207\016\206\030"
+	.ascii	"6\224\200\211m\031V\224\222\215\360\027ZD\2300\006\366B\221\300"
+	.ascii	"XK\242\3106\245dl\231uU\335x\271rR\2565L\272\236\210\\\254ed"
+	.ascii	"\206\033\250x\213\263l\312|h\362\340s]Y+M\251K\256!\241Re\310"
+	.ascii	"\020\326Z/+QK\330r8\364\270\n\203\304\256\254\025\003\005\210"
+	.ascii	"\025\230\223\036\347\034zp\326\355l\327F&oW\230\234\341\300\352"
+	.ascii	"\"\222\207\206\b\f\"Ot8g\235{\bZ\3614,\035\316\204|2\017\267"
+	.ascii	"A\222%Y\333\201\261\376\334\314\017\035\313\035|@\317\300V\215"
+	.ascii	"\343\221O\016\3624\006\222\366\204\205O\006r&RJ\201D\250\241"
+	.ascii	"$h\030DDfHD$I\222\f\007Q\005\204 G\245\264\r\022\340EE\020\032"
+	.ascii	"4\"\242m!\373u\332\032h6dg\224\235Q\306\231\372\273\275z\322"
+	.ascii	"6\031+\206\333\003\364\275\251p\305\336\211\241\260\002\210+"
+	.ascii	"\234\3247\206\352\007\212\033\310QIP\\\002\203\224\216|\350\233"
+	.ascii	"\366\356(\335\362A\260^\b\020\271\3111\276\021e\341\034\203z"
+	.ascii	"\246\233\006\245u\021Ly\200W\342T\262"
+	.ascii	"\021\f^\312\337\024\317\356\351\220R\003]\361\265\217\321u\317"
+	.ascii	"\345L\304\332\310@#U\017qD\323\205\177\310T\2227O~\025\252K)"
+	.ascii	"\300~6\020\313\t.\337\250n\211X\223K\363\201\200\344\bT\306\344"
+	.ascii	"/\324\017\231\227\032|\223\252\005\234\347\372\212e\306\207\340"
+	.ascii	"\254\211\360\366\303\346\316\216Y\275\321V\360Db\363I\354\206"
+	.ascii	"\350\022y\310v`w\"C-`"
+	.string	"a\373@?\210\237\277\021\241\375?Y\0161p?\346\331\035O\344l\b\326\f;\343Q\327\t\2072y\025K\245\204[\306N\300\001\214\210\252W\371@\036^Mg8\277\007G5\023t73;\205\256\322yu\302\350HL\223\017\225\263H\307\253\035\221J\255\267\305\211\201P\036\325\021\274\021\267G\255\377*\217\315\344\311)\345G\372J\336p?\b/\3602\375\365\214\2051\367\260?\332\206&\361W\277\217\242\264ZE\t\266\2716:\374%\373\207+\317\363\373DHq\364I\005\3547\031\302DU\322\377R\334\337\361d\333\235]\221\216?\314B\220\324\\\205\264q\002BD\335\272\307\3142K\025\365\257\034\240\033\200\323s\201R\3114\035\031\212\np\224\022\355j\363\022\003(8\330\377\375\366C\315\020\316JB2\325\277\016l6H%\242\333\235^\033\252\027U\360S\325\365v\366d\3420\021/{I\243\016m"
+	.ascii	"sx\310\f\200\336\227}H\017q\177\235`\353\334\266\210 7d\0048"
+	.ascii	"A\272B\036\036\356qh\256\001\263\306\244\233\361\031\032()\374"
+	.ascii	"\005\277\243\023B\255k\276\205\377`\3665\226w\n%~\332p\370\177"
+	.ascii	"\222\275\233r1\371\235\317\340\003\007\003Z\022j\264\375\341"
+	.ascii	"\320;\300\017C\372\306\3108?\216\222\\\b\3412\366\346Y@\367\375"
+	.ascii	"\211\327!\261RO\315~\236e\364\372_\257\241\312\341\353{b\372"
+	.ascii	"\344\236\035\274\374\032\331\267\177\022\007\207\233\006\215"
+	.ascii	"\213\275\306*\373\364U\001"
+	.text
+	.section	.gnu.lto_.symtab.e097b7f313563f2c,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e097b7f313563f2c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
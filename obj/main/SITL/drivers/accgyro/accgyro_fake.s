@@ -0,0 +1,688 @@
+	.file	"accgyro_fake.c"
+	.section	.gnu.lto_.profile.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\345\006"
+	.string	"\002\213)1`M\323\030"
+	.string	"\020\320\301fh\375\333\233\002\030\234P\345\340\256\025`\215\023\301\034\207\240\202 \b\202\320 \b\246D$\"\"\"\264i\223${')\003\251_\353\326z\365R(\023\016\b"
+	.string	"z:\b\013\f0'\327N\275O\357\322{4\2042K\005\205\005\241\247\025\271dR**\036\337}\224h$L\031\231\200(lR\364\306\f\006#\200r-\020\027$\361\201\316\376\317\2173\334\331s\201\247U\026\"v\255l<\\\232\327\374~\2731`\022.\036d!\r\357^\317+8\322\201\221\241\271\306\341a\221\001\251\003\001\026"
+	.ascii	" \204{\223\376\262\2070\023\\\005\220\263s\347\205\244M\256p"
+	.ascii	"\240\016\253\002\221\324\335\022Z\006\320^\311zW\036\204\341"
+	.ascii	"\274kg\255\225\324w7\024\300\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375 \330U\003"
+	.string	"\004\003\314"
+	.string	"\r"
+	.string	"\002"
+	.string	"\b"
+	.string	"\007\003\001\001\001\003"
+	.string	"\003\005\200\004"
+	.string	""
+	.string	"\002\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\n\013\002\r\016\020\004\021"
+	.string	"\003\022\023\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\031"
+	.string	"I\r\240)\030X'0\f*,\340!C\216\200\242\b\334y\001\356d\032\0033\320\314\262\006s\031\312f\2265b\3422\024\r\b.\205\263\312X\2351v\301l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\357\001\325\n"
+	.string	"\022\21745Po\322\030\0048\313\3474\232 \\c\354W9\347\273WF\371\340\332~\026N\267\260\"f\001\255]\221\371\212\252\252\252`\246\026H\f\333\026\022\2074\"\245L\001\013\374\202j\2264\354\354zO\225\217\037\335\202"
+	.string	"\221\213\210\311\200F\324\021q0\001JG\032aw\036\376\306\345uuu*\340{\264\264\273"
+	.string	"\325\031J\327\022\317TG\032\275\261\007\351\305\356n\276\360\215\323\377U\237\344L\251\215\367\240\244H\351*\020,\206|\301\250!I\330\342\350\310\004GI'\007y\370\360xo@j\022\222q\312\3621\224\020\026\022\035g\3358,\265e\006u\202\375'aF'\226\201\3741q\034C*\023\243\242\241\215\237\3267\354\256\303\347\243'ww\365\337\271\0228 `\002\231\031:\037\261+p\017E0\362k\331\334\312\2278\304-\240F4\334`0\242M\347*8\030\261\261]\301O\026\333\304\b\250\034\234\313AF\273,\re\207\255f`\223@"
+	.string	"\006c\004\254\256\200\201Aac)\026H\342B\033\306\027\215y\017\253'\260\213,H\344={\331"
+	.ascii	"\034/ {2\367\360\210\272\356:\302e\270\032\216cR\206O\335\330"
+	.ascii	"2ZB\0305\361\264\200\353\214\336>\\\356c\024\300\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\236\001=\b"
+	.string	"\242K'.`K\223\016\225a \330aj\266\223K\222$\301+\\\206AT\264\312\030P\205\005\301\005)\265\255\337c\024\001\241Z\263\237\3146bw\222\001\323$\0254\301U\316Q\216\304TM8\225\253\210p(\n\211r\r\006\235\340\001\201\233i\221\007\370\022\337\037\377,\240\265\256\007\320\200\3728\264\b\002\323Z\370\220\254\313\302\031P\037\210\026Ya%\301\026r\227\216\336\215\304\033\217\307\370\213\361Z\357(?J\274\341h\231\217\241\222\311\355Cvuv\335\266\r\307\227\374\0136\261},S\206\026\245, \200\002\231\232\273\003\3533`\323\001\264G\346\034\267\267@\263\277\006\001w8|\346\215\t\315\355f$\342h"
+	.ascii	"\213\374\035\330\230\253\247mx\231\332\360d\274\004\200W8M9\214"
+	.ascii	"\253'Z\215\371\036\302\252\312\241,\244\005-3\234/=\206q\213"
+	.ascii	"n\005\345\033r{\320\362\204\302\256\0209\364\210\335\226\225"
+	.ascii	"\023$\377\033T\021"
+	.text
+	.section	.gnu.lto_.pureconst.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\200\004\001\232\004\003\230\004\005\230\004\006\232\004\n\230"
+	.ascii	"\005\013\232\004\r\230\005\016\230\004\020\232\004\021\232\004"
+	.ascii	"\022\232\004\023\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"M\006"
+	.ascii	"\322\210\033$\2205I\007s~>\361\211\376\377\257\031\373\377\377"
+	.ascii	"\377\271\303\232\375~\373\3779\264\233M\253\226\367\337\366\211"
+	.ascii	"\224)\177g\220\242J\352\316\240\037\216\246\035\346\276\274\330"
+	.ascii	"\3471\325XOR\214\276^]\213\006\026D<\260,L\370n\211\254\375n"
+	.ascii	"\201\024\245\362\340O\246\225'\312\364\020C\002\320t\247|6\345"
+	.ascii	"\210\336Y\300\2343\345N{\333\225\031\t' \200\002)\223\344\001"
+	.ascii	"\204~\027\224\350\336\206\341\322\322t\377\020W\362\306\310v"
+	.ascii	"\300\020a\211\027\223 X>\352e\216\354.\254a\232\302\271C{\322"
+	.ascii	"!\211p\302\230\003\017 \334#T\034\2107@ap:5F\300\263\t\322\220"
+	.ascii	"qa^\330\314m\257\f\366\275\001]\321\346\020"
+	.text
+	.section	.gnu.lto_.lto.370f3c7d586adc37,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroIndex.21.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\364\001\355\021"
+	.string	"fbxH\340\322&\035\240\3220'\217\3159\035\352&\037D\035\2562F\317\331\022\273_\357R\360\"hy\302\317w\340\365\241;\247G\031\354%9\031\f\20292\314\031\245D)g\240C/y\204b\306\003XjM\032\331[\312\224\002e"
+	.string	"a"
+	.string	"d"
+	.ascii	"3ALsN\257\344$\333e\374\310v\271&^\326\307\360\336\366u\016\265"
+	.ascii	"\311\270\372\362U \314\271\307\330\034\025IrV\354\210\2003\321"
+	.ascii	"\244Vd$\003et\333\251\271t\300\024\344\206\306\3461&\350q\201"
+	.ascii	"B\004\344\020\367g\306\215\016\204\351\036\350\212\264\024\003"
+	.ascii	"k\256\250\2249\2475\006\322\334\251\333\256\261\275\300\326\221"
+	.ascii	"\235\352\341\237R\265Tu|\320\275\247\335z\365\001\034(1\340\307"
+	.ascii	"\234 \236\206\314\035\362(\305\203~\232PIj\316\033!*\376\343"
+	.ascii	"\003\271\363i\256\3059\304\200\307\007\2209\347\352\322\n\270"
+	.ascii	"K\265_v\247\366}\036\343\365\360\345\001\346\304)\2521gh\300"
+	.ascii	"\b\270K\207\334a\234\347e\327bx\002DQ\n\265M\367>\264$\230:="
+	.ascii	"\3169\347V\340\272\335\036\350\004\220\226:\210\220\321'\325"
+	.ascii	"\037\"\035$d\\]\325\312,\200\307\007\244\2703\247\366\373\321"
+	.ascii	"z\300\324\311\2667\234\306\0137\347D\361\207N\204\301\327\271"
+	.ascii	"\264\006\227>v\351\273\266\313\357\213\026MG1\372\2445\035\245"
+	.ascii	"\246\335\231\035\302\350{X\214\310\341\305\261\003-o}.\226h\326"
+	.ascii	"\311\212\004\225\b\017Z\237\213\205\305R\361\\\276\225\f-\037"
+	.ascii	"\004\217B\213\312\004\217\365\271x'&nUX\371\274\013\255\326\347"
+	.ascii	"u\236_\034\033%\327Q\265qevJ\314\312p;\363\205\336\300\310g["
+	.ascii	"}9M\255m\301E\037\223{\031O\201-\314sl\204\360\200\332\231Q8"
+	.ascii	"d\267\233\244\253\353\312\364\016& P\002AL\243\007X\250\354\f"
+	.ascii	"\202\321\254\213\004mn\025\2121P\335hn%\027\244)V\r\230\0351"
+	.ascii	"\352E\tc\333+\266\301-\201\327j\304\366\202~AE`\270\320\316\002"
+	.ascii	"|\037x\325rA\205\177\207v c\353aw\2410\375j\244\t|x>\312\not"
+	.ascii	"ZL\006"
+	.text
+	.section	.gnu.lto_fakeGyroInit.22.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`$\001\255\r"
+	.string	"\246Y\\D"
+	.string	"\223\223\016\234\021(\234\351\212\205Vi\377\036\n3\200\320x\0259\215\246\355\2401\t=\201\266\261\bd\214\023\320\021\005\234\003j\3736\255\211\252\252\022U\252J\230\3172D|\023M\323uI,\331[\312\224\002H"
+	.string	"F"
+	.string	"I"
+	.ascii	"\334A\254\303\353\005\254C\237l\034\347^\2663b\245\303\314\315"
+	.ascii	"\356bJ\342\247?\315\223\177\231\003\210)\324\337\005\342\372"
+	.ascii	"B"
+	.string	"\272\032\036\001R*\017\204\245D\274\314\323C*%\263\023aw\2351\365\341\206\267-\3016\004\373-\001\320?\261\016\025\254\240\020\021\023\002%sl\016\225\352b\377\355\356ZU\366W?|i\325tf\372\236\006\335\215\016\0039vYr|\254\rH\303\204\307\366\323\276\212\307\234\2762}\300\256j\006\315.\307\300\017\256C\007\026\220~f\245\332!Q>\252\"\340\240(\3731J\037\233h\217\016\203\3440\201\036\250\021[\256v\311_|l\362G\334a\3553\033\256\335u\340\2730\311p\301\230\254\303k\247FF\212\025T\177\305Y\230|\030\223N\362\361\001\332V\022=g\"!\022\220\205\021m+\211\262\f\204\221\266\220\206\321V\001\2730\002\225`\331F\302DB\254a\bm\230\211\246m\230\207\333\277U\225\337\211\256G\207\242)\217@\332\023F\362\321\252\250\277\340t4\252.^pU\n-n\250$N\032"
+	.string	"_\2417\023\232\3051\262\n\206\020|3\027\320\373T\323\034\370\2260\326^\202 \270\fi\275'\204M\224\301C\223x\242\267j\366\036\265\336F\255'"
+	.ascii	"\301\305\206f5E\334\345\230M\322\300\324\036"
+	.text
+	.section	.gnu.lto_fakeGyroSet.23.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`,\004\r\034"
+	.string	"\206\262\257G\240\234McD^|0\223\262\r,4\260\"`\301\205\317fA\220"
+	.string	"\357\251\n\237W\303\314\313\350g&\024\211{?N\315t\336i\t85\233\243\241\350\027]o\314]\3150\\`\256\304,9\213\266\333\226[\312\224\002\226"
+	.string	"\223"
+	.string	"\240"
+	.ascii	"\267=\340\325\213_%\0358KVD|\367\236\013nm\301O\216(\317M\312"
+	.ascii	"\325\240\320\344\013\250\236_R\236\311\221\355\275@\272v\367"
+	.ascii	"^\006\226 \336\362\320S\373S\247*_5\343\001\356u\242\332\335"
+	.ascii	"{20\004\361\326\347e\341\255x\001\341\255K\373\353'\324\275\225"
+	.ascii	"\220%'`\367^\262\006yy\013VZ\3721 \034S\207\273\345q\020\364"
+	.ascii	"\361i\255\221\345 b\216\272$Zwt4\300\236{\357\263Nm\350r\224"
+	.ascii	"\306\200\356\275\246\246n\307\035\336v\b\333F6\350!\347\231v"
+	.ascii	",\265\003\275{\257\203+E&\374\250\031\341\255\254\236w\237!\247"
+	.ascii	"\2210Rz \3210\373"
+	.string	"\314\321\372d\037\274\325\311\036\251e\177\362\363\274\311\277s&\277\316\257\356\361Xw\316\253~1\207\332Vj\020\207\272\342PS\221\372\005 \234`f\fp\335\233#\314\315\335b\267\212\374\352\307\272\277u\336\212S1\200\250&\246\025\366X\345;{\264\321\251\330\342\210j\232\272\367\216\267\343-}\224gy\364\245|Jy\254\026\"N\207\b\245\313\020\337\275\027\203\030`?\312(5\345h\230m\205\n\t\024X\237\034{PH\353\277\254\274\310\004\211\276\230\217\271\220A\003\275\251\241\222b\266\220h\330\351\275\027W\353\223m\341+\t\2531I\264\215\355\r\007c\023\305{\357k\325\322\"U\305S}/\340o\247\372\\h\026)&\235\352o9q\244\023\345\277\bo\353\022\256\037\323\265\020\021\200\262\215\342^\034\020<\350z\226\016\036>\320\233\037\302\333\261F\360\301\306\034@\305j\203\020Ao\346\324\251#\273\237/"
+	.string	"\225U\2377bFo\272'\251\342|\336\271\206h\317\f>\361\243"
+	.ascii	"FM\250h\310\322\204fU\306c\034\306A\323~jD\263\022#l\267\030"
+	.ascii	"&h\264\031it\253\271\030\272\t\221EC\263\024$\355fD\376\370\330"
+	.ascii	"\246\242v#Y\330l7r<\221\016\336\352\224u\013R\347\317\207Ts\273"
+	.ascii	"\322\310\354\273\347L\331\272\361\363\335\026\332\345\221\267"
+	.ascii	"\321\351Y-/`il}\262\235\200\206wW8V[\355R\252LBo\272\001\020"
+	.ascii	"\245\212\263\277\206Htq5\034\024\364\322\224T\007\240\316\034"
+	.ascii	"M\251dB\205\n\341\255\255\240\227\331\203V\260\306\276,\275\251"
+	.ascii	"\325\027\344\240W\346\346\231\327\372V\250A(d\224T\304)\nF$\220"
+	.ascii	"\321\026\266\030p\002\031\252\272\016\021\320\261D\267\260\320"
+	.ascii	"\372\177\006\207\017|\215/E^Z\266\344\326M@\2227\360\334\020"
+	.ascii	"\303NNl2\350x\211H}\306\037k\305Amd\356\t3\351\301L\323\355o"
+	.ascii	"}h\275\356vF\013\032\236\377\024K}U\241\256\007D\224T\031@5v"
+	.ascii	"^^\277pgC\241\213`\013V \242\f\242\236#\264\026\025\032\357~"
+	.ascii	"\332\263\026\365Vu\265\316\202\240\225\351\207H\326\200\"v;\233"
+	.ascii	"H\035\345f\004+\203q\340\215k\344v|\240\240\304\210\331c'\300"
+	.ascii	"\377\343\217\301\361S\005\021\211\rXZ%\322\004Upy\007\227rY\334"
+	.ascii	"\246\0045"
+	.text
+	.section	.gnu.lto_fakeGyroRead.24.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`f\005\225 "
+	.string	"\226x\310H\200ZN:\337=Z\223\355,7\233a\333e\351R\0308\346\335\006YO@\005\236:O\347\346y\240%\232\255#\364'/\270\033<\245\375\3703\227\344\237yHY\353(\2057|\f\213\265p\035D\267&\215l\"w\222\001\257"
+	.string	"\251"
+	.string	"\274"
+	.string	"\274\273mf%~\224s\361\216/\345S\224\276E\303\\\312av\241\225\031\357\275\032\314\333\004dzD\336\036\351\325Ab*\0356\270e\013f\255\314\037>K\351ZH\027p/U\021\313\275\351\003\256`\336r\372\234\362\326<\201\362\226\231\031\202\004%>\237ZE\341"
+	.string	"\2578q\265\335\233\362z\310\317\343JKv=\371K\307\235\353\n\220\034\205\224R\267$\2171\214\r'\330D\346D\035Aw\301\033\225\354\2643hc\276\202<\336$\217\220\313\216]\220\211\3149\023b\346\\\257PA`\2558\f\367^\256hP\307\331<3#13\021\263\365\005|\342YN\323\274\367\276\177@\201\021fi\t\250;\315'\242"
+	.string	"\252G9\001S/\361\211\017\033\252E\364D\356\035\213\020\202\342\275w\002X\n\026|#H\345\355N\237x\236\253T\211\323\227\324\257\036\231S`\355*\346\367\361x<rS1\357*\357<=\353|\353<\340Z\177"
+	.string	"\256\274\323U\326\351*\347t\225\315\\e\\\256riV\266fe\022W\271+\037\301\005c[\232\201\343\275QG7\327\314\212a=\375\267\316\267r\242\321\251\260\2052\023\016\215\230\277\n@\025\205\303w\335\213y\3072N\205A\274\265\335{w28?\007\254\316\344\202\2605Y\3731y\231\037\034\033\3022TMA\265]6\256\231\317'gV\004 M\275\304\374\342\t\345c2\230\270\256aP\251\207!2\301d\370r\264\r\034||\312\333\262\355\033T\252<\223\225d\333>\261)\t\260\036\271\233\354;\275\375\352\321\304\313~(\360\273\334K\007\017\037\352\321\017\345mw\204\340\032'b\277z\3444Q\274\210\261]UA\234\254v\207\255\271i\351\324"
+	.string	"\315,bD=:\240?|bt3\216}\013\200\342\025\324\232p\270\366\253\307\032\266\346\f\b\371U\342_\327U\021\303qfd\352\245\037A\205f\335U|\226o\025S\3100U6\314\001\334\242gA\r\241\240\027C\266\027\004\324$\367z\204\\"
+	.string	"\255@Q\344;b\321\353\001\361\214|B3\206|A\274\027C@D\274\236\317\210\327\303\303E0\204|\274\030EE>\336.\375\235\274M\305%\332[\027Xy\256\373\240\221u\201\365\307\276\353'f\3365c\3705\220\274\367^\234\227\227\256\177\225\251\002\317ce\275\244\256\223\246\312r\017\376\366\246M\315u\322\224\226'\037f3\263\203\273\235Ct\212\314'\221\267\235X"
+	.ascii	"\232\210\252\261\2058\213\230\374\243N\232\002{\362\261v^\035"
+	.ascii	"\260Rsb1(\246]\355D\302|*9\227\324\243\347\222\362V\247ILu\241"
+	.ascii	"RA\312\256\372)\321\004l\250q$\247\230sfHd\302$\222\026\206\003"
+	.ascii	"`\002\221\251\273n\021p9SG3I\241\262\177\034\335n\f\360|\352"
+	.ascii	"A\311e3!v%\233g\333s{\224\2254\271\316$\027\223\367H\247>\006"
+	.ascii	"\203\351g\233\017*\030\256\214\303\025\217\236\264\360a\211("
+	.ascii	"\030P\326\205\376\001%\336\025j\177\260&\273\035\251\242\260"
+	.ascii	"\331\236\231\330\267\nBs\253\330\001\334\365 oBU\210\303\345"
+	.ascii	"x\311\020_3H\356\320f\034\353!@;\026\317\331p\004\374\213\200"
+	.ascii	"E\004U\017\025\210\211\274%)I\034D\351\270\264'\036]\261\031"
+	.ascii	"\305@\301\302\344y(L\003\325\343\207%\244u9-\272\315\243\344"
+	.ascii	"S18\350\246\\\202+Mb\205\177XYmq\267u{\237\335sj\021~\342.\002"
+	.ascii	"\322\275\226gl\322\312\242\247qo\347\025+T>k\303\346\320\270"
+	.ascii	"\223\"\333\250\001"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.25.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\r\b"
+	.string	"2\31777@s\322\001\033\262=\330\231|\016\244=\357\3016\270;\\\025\327\355\247\350\260\b\370\253Ln\221\246\352g'\227l_\027\217I<\217:$\215\314\261s\263\204\220\275S\nR\223\020\223fh\222\316\020hj\001\2251\317\274\220\025\023\031\035Y`\230\214\":5>\224\"b|$(bT\024=\t\316B\223F-\313ht\335W\013;\237\273\n8`\207]I\017\216\330\257vw\r;\373I\240R4\b0\273\245\233\232EY/&\2667\033\3006\254#\033\207\367\354\237\034e{\312\306\005v\273\030\227\335\252\340\206\316-\327\023\\\267:\037\270n\331\366\002\303f\356\265\244\304\361"
+	.string	"\371XI\355\326\bI\316\375q\376Unpb\221\231i1\221\3768\017\273\353\027b\022\271\341m\037\330\216\260}\n\f"
+	.string	"8\303\361\212\036\025Ql&FV\301\3235ob\002\007\205\34020\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.26.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"-\013"
+	.string	"v\224MC\020O5\035"
+	.string	"wt@\362\377\003"
+	.string	"\n\301\037)\203\346T"
+	.string	"\272\0323\f\2401v\372o\034-t\346n\350\263\231\3004\306N\t\"\031"
+	.string	"@w\305.(\255\236\351Dq\004c\272F\f\323\377\335\330vJ\0017"
+	.string	"7"
+	.string	"?"
+	.string	"\327\320N'\317\320Nm;\004"
+	.string	"\310\340\305\024\351\250\n\023Z\344\256\270e\030\016~\202\376Y\257px]\200\271J\241OI\201\335\365\034\225Lwv\333\035\266\007\330\307\004\266\030\232\031\312~dw\327\331\311\376\352\237\222\003\033H\025\036\343.\251l\261(\250\t\r\266A6\305\366\234\366=\374\003\350\253\3171vO\254\022\273\"\210\005LN-\006\033V\354\313Gx\244\246\261\003\311u\0341\357\"2U\005\323l8o}\006T'F\f:\033\251\335\360#\333\301C@\230\354n"
+	.string	"\037D\004\317E,\303\251\377\321N\251\005\022\"\230\213B8\313_\365d\"\356,\336\206Cp\371\252'\323u\334\326\251\336\003M\305l\n4\034g\353jg\263|\370[\340\325\255\301\367\325\215\"\356\355\037\324\022\274R+R\204\231\310\036\317\302\004\312\222\224\260\001\022"
+	.string	"_\241'3 \f\0337ax\254Qs\001\220\017\334\f2\002\322"
+	.ascii	"\031\203\202<\225\310Wg\034\231 \342\032\r\331!\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeAccInit.29.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"]\f"
+	.string	"\246WUB\020\221\232\0168\261\031_\326\212\024\023\374\202\272\262f\214\200\031xrs.\277?\217^\225\336\221\370\337H\373&4\230W\037\221~OH\"@\001(\226\222\n!\377K!\300"
+	.string	"\351G\030\350\223\275\245L)A"
+	.string	"?"
+	.string	"E"
+	.string	"\002\244Ck6\215w\240\355\370\270p\220\031\355.\245$\256\375ij\376c\356\021\271\355o\372p}#\"\0277B8\226'\322R\">\346\331\201[\311\354X\260\273\316\310y\270\341m3\260\255\300~\203\"T\262\306\356\266\324\217\375\267\273k\365\330\207\371\237\2463\323\367p\320\215l\220\324\330m\251\311\2611\340\013\023\037\266\237\366]\376\242\035\246\363"
+	.string	"\273\236\0263\273\235\001'\230\016\335]D:\234\036\n!\305\f\226\2441H\372\033\351j\233\234\344c\352\200\r\272\331_\241\001DF\264\261\313X\230v\027\201\n\024\016\001P\250#\035^\017\204X\304\020O\375\023G\321\361C\306\220\222\217\207~\212tX"
+	.string	"\304h\304K\226U\251\255\222\313\244\222\360"
+	.string	"\3132L\260\254\212\342d\027\312&\213@Q\330T'\224\225q\250\222\021c\025\256\214\272\200a\031\365\321\355\337\252\307\017F\207C\244\242+\017@\332\326\225\217V\335\016\242\021\315\250~L\362\f\024"
+	.ascii	"_\2417\023\232\3051\262\n\206\02073\027\320\373\017\323\034\270"
+	.ascii	"-<\227\306\354\213\276\025G\255\267Q\353\031`\271X\333\254\246"
+	.ascii	"\210\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeAccSet.30.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\f\002\335\020"
+	.string	"\266\035kH\340\262(\035c\007\201\276\345:\353\237\260\344\202\321:k\235m\221+\245\363\306%\247\032\326x\030\363\241\310\220`\341\251Z\252\025\343\347\035\264F\"\311Q\f\3150\347t\322\022&\324\212\003'C\251J\022\340\337,\367\330;\245Q"
+	.string	"S"
+	.string	"X"
+	.string	"+\323c\333\335\222\037\214^\005\314O\373.^\263\272M\313\007\354\302Z\330v\311\222\035\214^M\336"
+	.string	"\367::\001\356\325+\033\350dl\217##\004\216\220\335\365\250\211\257>W\376i\007\320\202q\371\024E\330]\317\026L\211\233\336v\002\333&\366T\005\"\273\273\2460\233\233&=\347\027\375\346\257\237\375\3646\377\f@\002{\271fv(\017rG\f\r\331\035\225F\n\333\367c\274\246\272\216Id^.\225\335\301x\231r\035S\360A\263\273\335\253\235bw\257\263\263s\204$\334\364\200@\311\277X}\306\342\272\001\265\364\033=u\366#\210R\333\013n\203\245@\003\277\306y>0\234o\205\334\353i\237\262\230\237W\215kd\222\250_\242N\346[F"
+	.ascii	"\202\272\370\345g\244\346O\353\245Qn\023\017\304v\227\301\316"
+	.ascii	"\n\007_\326\302\275\222\350\313\227\234\270\251XQ\306\260\346"
+	.ascii	"\220M\276L:c?61)X\271\312?\034\004?j\320\024\236|\030N\342\250"
+	.ascii	"\222\001\004?/5\206\036P\343\005O\003\352C\361\3001\345\231J"
+	.ascii	",n\bG\257\203(\216^G\262.\262\024f\323>\301\207D\320\215E_j\025"
+	.ascii	"^;\251\024\022\201\342\366\023g[\270\216\323h$&\003B\023DDq\334"
+	.ascii	"'\207y8 \026\0010 \260\002\0319\363\261\270\360Q\"\262x\312\221"
+	.ascii	"\251\002*\361\365\355<-\230m\200-\207\300\215\335\\8\326L\262"
+	.ascii	"\016C*0`\325FC\232\271\\\261p\220$+\250J0\026F#\016\025\0241"
+	.ascii	"\326I\2506J\200\205&\3341\342\020C)7\212\0018\032\307;\2323\330"
+	.ascii	"\203\224\007\314\300#\211\342\302\306\340\025ig\n\230\313\213"
+	.ascii	"v\221\001"
+	.text
+	.section	.gnu.lto_fakeAccRead.31.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\031\003\215\024"
+	.string	"\026\244\200I\300\322Q:R!\020\260\317\025\216-\372\247\314\003\202\252\362\271\331,\353\257\2760\326L\300_\354\273z\360\226\354\362\353h\366\234\nx.+\315rX\213\203G\2418*N>\317\276\002\254\365\177}\352@x\003\251d\023)S\ni"
+	.string	"e"
+	.string	"o"
+	.string	"*\333\252\366u\037\3129\021\316O\346\f\362\305\230s\247\342\005\343\245wG\021/\307\003\020/m\373"
+	.ascii	"\202\034\313\276\313\361\214d\350\241\201\305\324\234;\326\216"
+	.ascii	"\270\3542\\\225\371:\227&xL\341F\021\001r\362\331>|\303\024\\"
+	.ascii	"\222\007\225\215\026\242,\001\371x\321\265\203mGude\316i\255"
+	.ascii	"\331zn\361\266!\330~\261\327A\265\367,s\037l@n\316\231\300\305"
+	.ascii	"\f\215/\204#^\232\354{W \022\017\222\017\304L\203\366nGW\204"
+	.ascii	"\375pn\220-\252MN\364\217VK\251\016\245z\245\372'4?S?VNs\362"
+	.ascii	"\004\211L%\t,a\373~\213\367ln'll\236\200\233\356*nt\363\235\245"
+	.ascii	"\317\017N7\347T\335\330\252\313\265s\354\332T\213\232i\320\300"
+	.ascii	"i\260\214sN\005\376\214\037\265\330.-}\255%^\3526\270A\341\206"
+	.ascii	"\200\377\035"
+	.string	"X\222\023\272=\341tAf\032T\031RK!B\236\353\274?@\002\"\005E[\235\223\250\341\224\3262\361\373\262\202\007M\207\330~\035\206l\034\205.\277/\272\372\334P\340\206\210J\324d\375\036L\214\276f\002\264\325\361{\177Q\243Os\316\007\256\260*\340r\265\326\256\325+\2465\301\005\026\273\241\340r\265X5\261\027\006\230\230\004\326\fLK\206\345\212\325\260V)\206Yx\305X\027`\260\030K\265\233=\234\033d\321iC\357\027\276\350\f\232\246z\277\375\357r9\330\226\353\225\331\356H#\243pw4}\351L:\364>\022Iz\202)vs\340Py\322\215]\222\236\"B\200\2726X\002\344\034\3415Z\306> \220\002\031\301\243\007R\334\377L/JB\3573\020\3202\f\032m\311\\2\313s7\332\2203\356\260A\302\327\254\242K\305\310\227\340\3642\f\301\030\302\367CL\205\341\031!R\267\0364"
+	.ascii	"lbL\344\225}\213\266M\215\235\255\013\037\361\305C\354:K-\003"
+	.ascii	"`b\221\346+e\261\270\234E,\nk8v\302\352\2401]\033\3141+\374\211"
+	.ascii	"\266\354\300E\344C\034\360n\317\371N2\266E\b\3439\1778C\305\271"
+	.ascii	"q\322\023\212Z\001\005"
+	.text
+	.section	.gnu.lto_fakeAccDetect.32.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\035\n"
+	.string	"f\023H>\020\005+\035"
+	.string	"p/k\223"
+	.string	"W."
+	.string	"\214\251x\320\303\342\377\250\356\310\276Ba\333\361\315\352\350c\\\245\375\001\006\203.\333$\t\003\240\b"
+	.string	"\205o#\r\230\373\001 Yef\0317\";\2454"
+	.string	"3"
+	.string	":"
+	.string	"\265s\003\357\325\266\031\032L6\177\276Vw\205\200\314p\273\347\327\271n\236\232\376Y~\240R\243\261\321X\247S\001\211\3355U\261D\356\356\266\023lG\330G\b\273\353\256e_\366S\2574\301\001x\260\331]\345\006\354L\225I\261}\333&{\3006\245\366W\0363]Vz\301n+\026\263{.\030\242\363\352\363\036\357\001\026\017\003\252\267\032,@H4\372l\234\200\345T\032\245\247f\027u\225\315q\027\217\316\356:\370-\037$\202\027\312\253_\362^\353\310K\312F#A\321\234}\236hwb\237\263\001a\bv\016?\242\b\264\240\030I\022(\f\301\257$\305\216\020Y\361a\204\300\321\027\222\345\367Q\360\230!\222\337\3068\222\237\317=g\273\226oz\027\267\022\0017\250.e\037\3449\f"
+	.ascii	"^\321\033[\024\204\305\2004A\003\251\301\305\240 O%\362\325\031"
+	.ascii	"G&\210\336e\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeGyroIndex.part.0.38.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`_\002\r\023"
+	.string	"&\343yG\340\362$\035\240\006\210\300\25501\260\374\366{0\237\250\370\247I\314[\320\035\255[\025\b\002\210jt\255\2347\346[MN^H\270\204\207ZF\t3\3140\212U%\210\001\274\022\2035G\336\"%\317\b!{K\231Rf"
+	.string	"c"
+	.string	"d"
+	.string	"9\217\361 \230]\213\341\t\020E\252\303\221\2179\247wI\362\221\3552~\300v\271&\254\217\341-\025\366M\306U\016\346\203\033\276\305\221\024,\200B\300\232XR\243-\311\250T\033 \020\217R\326\303\006\f\361\215\f\204\\\240\b\001i\342\306dN\247]o\300\031\325\221s\\\312\234\323\235\210\273\273m\016\266\037\330\212\023A\346\216lR\361\331\257t\265\357+\321\222\222`$"
+	.ascii	"\346\344\001\262\342\263\037\371H\276\354e\022\232p\2029F\276"
+	.ascii	"\3543\\\213s\006!\210\307\324\234\323\344\322\016\272K\365\215"
+	.ascii	"^\366\312\206\331\253K}\354u\"W\201p~\310\261\252}\031\017a'"
+	.ascii	"r]d\316\036\032\323\234\241\202K/\350.\035v\366\205^\001\263"
+	.ascii	"\271<\336\265\375\362\232\313\200\216\032\r\206\250F\b\310\341"
+	.ascii	"\301\306\256\217m\327\246\373\025\355\240\321\037\266\255\341"
+	.ascii	"4\\\335\234\023\305_:\223\213\377s\351\f0z\033\230\355R\367\264"
+	.ascii	"+\214\241\027M2Z\345\275\326~\244\250t}\274\334/\324b\007\207"
+	.ascii	"\267\307^\365&\343c\377\252Z\257t?\200\310\201\2479q\252\002"
+	.ascii	"-o}1,\321\254\223\025\n*\023\"\264\276\030\026\026K\305s\371"
+	.ascii	"V^Z>\t\236\205\026\225\n\036\353s\361NJ\334\272\260\362y\030"
+	.ascii	"Z\255\317[}{|\243wS@:\322\344\336\270\333\266N\221\331\031\357"
+	.ascii	"\026\305\231\234\273\021\345~o\364\256m\337\017\025E\355\343"
+	.ascii	"t\202\177%\002'\250\032\235\231\030\022T\211\030\365\033\367"
+	.ascii	"\306&@\342)5 \200\002\031B\273\030\337\351\215\003\250\236`\276"
+	.ascii	"\022\277\021\342\"\025\036\236\320\202\024\025@\020\345\241`"
+	.ascii	"\030M\242\340\020\267\210$\021\210\020\237\025s\331<#\030\243"
+	.ascii	"\002C(\214b\020\017\367|\374G6Z\221\\\203IH#ac\337\327R\026\030"
+	.ascii	"$4{\201\033\324cX\214\364\235,\366l\027@h\356\241\223\031\263"
+	.ascii	"m\336>\2217na\351\001i\354\264\0035w\371\265\017\017"
+	.text
+	.section	.gnu.lto_fakeGyroInit.part.0.45.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\345\n"
+	.string	"F\323G@ \005)\035 !\210\005"
+	.string	"\006\300\216N\220\227\376\223\3668\001l\244U\216.\201\305\b\211\307c\303\266\356\300\377\306\300\257k\004I\205$D\301\031D\n\346\034\3358A\020\307\335\365h\355&{\247\0242"
+	.string	"2"
+	.string	"8"
+	.string	"6J\306\242\215\340\343\316~r`^b\tv\267;\235:\027?\245&\372\207\335@\265J}\036\254f.\027\256}6v\327\033\315Mo\373\302\266\207\375\206\257\333\037\200\362a\006\331\376\013\365\361\304\245j(N-\245}\002w\211\037OW\330e\0250\260;Z\234:c;\365x\007\317\351v\006\317)\350\364\002\034\263\225\3112g\313\366&}\331\211]\361\030\311\030\247(\233\213\206\304\251\255b\222W\031A\026`\3262Sr\266<\265k;Y\366\214\270I\260\331\215Y\240`q\350\001"
+	.string	"\017\206\250a\255 7\372\302\021\216\003K\036X9\0364\177!p\344\205|\204\325$\362}^G\252`\212\250\202t%\"\217\244\373*\251\013M84\001kW\n\303\332\311k;Y\356p\005\030"
+	.string	"/\301q\206\343\025=\213\005\341X\201q\301lE\t<\303\003D\3010W8X\023\242.\252\317\203\300\304{Z)\252\235\316\005m\272\354\\"
+	.ascii	"8y1\357\2644\375\2042\006"
+	.text
+	.section	.gnu.lto_fakeAccInit.part.0.46.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\345\n"
+	.string	"\246\023IA \347(\035\220\b\"\002\231\025\300I\266@K\366\311\317\023Xi\334\225\341R\321\376\225_\375c\026\333\272\260~\323\320\330\023An\230 \t\001y\324a\\8\007p\220\320`A!\re\263\233\354\235R4"
+	.string	"4"
+	.string	"9"
+	.string	"\005l\233h\f\332\016\036\016\330\016\313\200\314\353\301\356r\237R\300\301\313\230\201\376]O@\245N\227\n)\325\243\303\263\216\307\356Z\253\271\347mk\330\016\261\017\021\263\001\201\267n\377\200\311w\331c\373-\323\303\322v\272\271\370t\214\366\021<\001\370\260\364\206\335\025\214\301n\230\361i\016\355\323\341#8\237\332\0378\237\236\317\007+W\006\261\211\271\310\027)Y\266\265\350+P\2611\376\022y\343sE\213\351\250\370\264[H\361(/\300T1\030y\212\222e\231=[\271\262%\305\002\006"
+	.string	"\2733\021 l\200\236\250_\255\336\026\242\237\311Fi\267y\243\316\253\037\022\224v\322\364\343\205:\022\221\257\222J(\3558Q\365X@u\204C\001u'\034\255\"\356c\341/\305\253\334\350\373*\027\237\005\026"
+	.ascii	"^\321\263X\020\216\025\030\027\314V\224\3003<@\024\fs\205\203"
+	.ascii	"5!\352\242\372<\bL\274\247\225\242\332\351\\\320\246\313\316"
+	.ascii	"\005\200\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\365\001\205\013"
+	.string	"T\020\361\002"
+	.string	""
+	.string	""
+	.string	"\002\031\177$\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006\037\177%\005\033&\300\204\001"
+	.string	""
+	.string	"\003\002&\177'\336\240\266\275\001\271\220\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\020(\025\177)\030\177*\377\377\377\377\003\023+\005\022,\005\021-\002-\177.\002\026\177/\005\0240\301"
+	.string	"\002.\1771\035\1772\0343\027\1774\272\220\202\002\032\1775\036\1776 \1777\001#\1778\037"
+	.string	""
+	.string	"\200\220\200\001\"\1779!\177:%\177;$\177<\003\001\025D\003\001\024\340\236\212\256\001\001\244\001\003\001\024\241\341\365\321\002\001\244\007\003\005\003\210\223\323\252\001\001\202\006\003\006\025\003\001D\003\006\006\005\240\342\001\003\006\026\346\336\301\357"
+	.string	"\001\344\007\003\006\016\003\n\027$\003\013\030\244\001\003\013\n\320\360\372\250\001\r\016d\003\016\r\242\001\003\020\025D\003\020\005b\003\020\026\250\270\275\324"
+	.string	"\001\204\n\003\020\024\304\n\003\022\022\024\344\001"
+	.string	"1 \320\002\0212v\f\334*\304Q\215\214\241\205A\3147X,\217\320\373 d\203 \244\332u\316\373z\220%&\007w\355\202N\240\363@6i\351T\022\206\302J\030\020\364\320\237\215"
+	.string	"\335\300\006\2043d\370:\200``8-\331@\314-@{\250F\005\220\355C\370\030Ic\030\260\316cm\300\017SN\200\211`ut"
+	.ascii	"\363"
+	.text
+	.section	.gnu.lto_.refs.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375 y\215\002"
+	.string	"\022\207\021\024\2405\351\377\377\377\377\t\376\333\233\265\237<1\262m\357$S\372v\307\204\035\236\365\2447 \311\235\330\235\023\022)\326(\263\314\202r\310\216\271\300\316\034\230M\3124\212\005\024\211\032f\325\\I{V\263\226\035\251\205\002"
+	.ascii	",*\236\r\212\023"
+	.text
+	.section	.gnu.lto_.decls.370f3c7d586adc37,"e",@progbits
+	.string	"(\265/\375`\b7E\352"
+	.ascii	"*euOV LA;\035I\">du\026\023a\237H\274`\257\254\200|\326\026|"
+	.ascii	"\001U\334f\277\272\001:\370\222\200\210\377Z\025\007\200\342"
+	.ascii	"5\252n=\217\206\266.\r\263I0|=Auzz\022r\235^\346\202b\230\305"
+	.ascii	"\246\307\303\323\333\372\326\371U\0134\222\354-e\222)c\004\343"
+	.ascii	"\004\363\004,CRLL\235\275\376\353F\037\354\273p<\327\315Sj\267"
+	.ascii	"\3212H\214\273)\330c\375\r\013z\232#\310\035\221\352\270*\271"
+	.ascii	"\031u\372\267\\R\264\341xA\353s\254 )\345\311\371\320Z~Wd\375"
+	.ascii	"\330\225i\277QO\362Y\016\230i\bI\022\023\323\236\267\264\347"
+	.ascii	"\033\3329x\253\227\372\252\233\227F\342\016P\272\367\256\361"
+	.ascii	"6n\364\255\236\206\325\315Sz@\220@\351\313\025\0160\2615{\236"
+	.ascii	"\322\231\313\207\307\220\317?\3652n\364g<\325vq\001d\232\313"
+	.ascii	"04\212\241\317\255\236\221\264\347\247v\367w\372\247\033}\250"
+	.ascii	"\207\372\033\375\221oh\367V\203z\030\037\303\202\236&\tMRn\230"
+	.ascii	"\b\017\036\352\227\356\335\013\263\335E\037\020\214q\267\201"
+	.ascii	"\206f\030\0057V\265f\307D\264\373\307\370&\354\242\2716\330\252"
+	.ascii	"uJ}V\237\243\317\364J\336\356\275Y\214\250\330\200x\332q\235"
+	.ascii	"v\314\246\035\237i\307^\237\004\303\343IG\327\325#a\031\372\356"
+	.ascii	"\233a\215\301P\372nh\257\314\372*^\350F7\370\241\2471%\272\343"
+	.ascii	"\205\366\273\301\212\013\013\357\006\253\343#\375\315\347\371"
+	.ascii	"\240;4\222#\203\373\374>\377s\243\034\036\310U\236v\267w\tU\317"
+	.ascii	"\363\263c!m\202\275/\207\365\026\026^\016\253c\037\r\342fXW\267"
+	.ascii	"\233a\235\262\001\346\210\211G3P;\007Jn\023L\346\324=d\\I\367"
+	.ascii	"n\245\334\301\033\275\202\327I\332=s\017q\005\357\223\033\345"
+	.ascii	"\305\247\335\317\027\031]I/\246{\2674\033h\\zL\005\223\326\f"
+	.ascii	"\345Na\204\254\202hdA\371)\355\377\\r\231\274\321Y\325\377,!"
+	.ascii	"\324~\217\\\300\313\367DJ\n!\372\036\271Hn\364&q\277E\356\231"
+	.ascii	"\3472\3506\333\273u\301<IC\332fV\230;\263\372\215\323\371F\265"
+	.ascii	"\3370\355\1777\303z\371n\237_\277\273\267\257_\007P?\230\301"
+	.ascii	"\275y`\356\315\340\336\f\362\027\324U\2175\373\345\322~\253\264"
+	.ascii	"K/\236\373U\273?\356\035\t\366n1\004q\306\370|\355\256\220\033"
+	.ascii	"\275\340\016\301\3142\030\027B/B\301'\355\367\202\365\026\336"
+	.ascii	"\013V\021!\374\006Y\273\344\234\242,\351\230\274\351\315\260"
+	.ascii	"\312m\270Z?cZ\237\375\006i\270\033\275q\267\207\347\3269p\017"
+	.ascii	"\021w}\3347L\346\334\033*K\204\023`\320s\272\367\336@s\227\354"
+	.ascii	"z\360\362\233\373\335q\315\256\233\212[\021\243\034\237\375\272"
+	.ascii	"\271_\266\333\346m\017\335\333g\357\255\341\361\2244M?{\336\315"
+	.ascii	"\260\266\250\205\360\273&\263:\225\332\r\203\335\350\200\006"
+	.ascii	"?\377\b\264_@\373M\363\022O\333\003\327\240]k\227^\231\025\203"
+	.ascii	"\233a}\350\315\260jpe\326\353\2742d\356\027\354\206\3351\334"
+	.ascii	"\034\202\356\264\275[\fC0:\250\264\317w\354\257\216\333\372\035"
+	.ascii	"\273b.\302\003o\361\331a{\267w,\357\315so\006/\367f\240\316Y"
+	.ascii	"\361\354Xs{3\254\372\312\254\f\300s\377\031tk&\f\335\263\223"
+	.ascii	"\373]\341\356}s\356\367G\316\375"
+	.string	":\335U\237\267\n\334\363\363\016}\234\373\277\251\330\375\221mM\217q\317v\356/\363l\356\277\256\271\277\253\271\177v\001\203{vB\201\354\236\177\356\324\3751\270\203\257}\203\373\373p\367\017x\007\367lU\201\373\3670s\277S\356\017\202\035\356>\304\335\357~\004e%\254 \343\340\026\270{\353\376a\276\201{V\342\376\354\227\373\347\360r\277S\334\357v\177\026\367o\351r\031\367\034u\377\rpy\n\256\342\236c\270\377\226\373W\271\177\224\373\033\271\177\221\373\367\270?\323\375]p\177\024\356_\002\367\307q\377\034\367\267q\377\032\3677\341\376D\367\017\201\373{\300\375;\340\376%\270\377\t\356o\202\373_\300\375Gp\177\n\270_\r\270_\024\334}\003\356\227\210\373=\342~\245\356\317\301\375-p\277C\367\213\344~W\367g\200\373{\340\376\tp\377\016\356O\343\356:\334\177\306\3757p\177\004\270\273\006\334\377"
+	.string	"\356\257\201\373\033\300\375\016q\377\002\270\177\006\356O"
+	.string	"\367\037\200\373\007\300\375/p\177\001\270_%\367\333\302\375&\271{\353\356\020pw;w\177),,,t\317M\334u\020w\032\232\316\r@\031\221\206m\201\275\235=\032F\002\265"
+	.ascii	"\256,\3744\343Ha\026\230\022A.\374B\0203\335\273\016\306\234"
+	.ascii	"\236\b\247\202\230\r\013\021\342\023\003\302S\362P&\302\323\234"
+	.ascii	"\"\373\344\235{r\021\206\202\013\263Q\346\311\317\334\"\013e"
+	.ascii	"\244\274\"\037\345&\226\202\243\344\244\254\224\235YEf\201\237"
+	.ascii	"\340\301\034\224\231\371\007\023\336(\026\304y\216\227`&\367"
+	.ascii	"\007\331\007\275\360\304l\237\2365\2542A\274\303\213\f7\tb\247"
+	.ascii	"\035\201\270\206 \266\302X<F \304\0045\340\322\243Q\251z\001"
+	.ascii	"\005N\204\354\304\035/a\030\367.y\345\002mP\313|\327\225Y\261"
+	.ascii	"4\007\240\023\221@@\\%-\202\225\3041 \363\210\217\027\214\340"
+	.ascii	"#ETr E\221\270\031)\242B$\214\355\311\237\343\"\330I\323\224"
+	.ascii	"\325\336\035SBj\373\214\211\364i\t2q\333\302~\270o\350\023\245"
+	.ascii	"\354\016\3639\356\273`\200|P>c<\274\247\261\212\230?{X\017\346"
+	.ascii	"\207\035\341\213\317z8o\375\n\354q\326\320\356\004\337\251(\361"
+	.ascii	"\303\243\272\373 \251,6\260\317\336\322\244\3416`\036>^\237\203"
+	.ascii	"\334(\266\303m\0338\300v\330\r\003y\211\276\355%\265\354\024"
+	.ascii	"Q\3362\220\037w\305\ni\3633\256S\021\302\002\tH\340\334\215b"
+	.ascii	"\272\031'\034FX\356e\370\005J\221s\034\347\334<\\|\206\033\002"
+	.ascii	">\367\312\206h\374\206\333\336\211\247\357\031D;K\232v\226\035"
+	.ascii	"\332Y\304f\260\217\026\236$6=-\355,Q\332Y\226\264\263\034i\314"
+	.ascii	"\003\243\275\333 P\222\317\3413\025\237v\233\315\250c\316\370"
+	.ascii	"\354,B\332W\246\332W\222\350\273W\364\264\257\324a\035-\033\220"
+	.ascii	"\275\250\330\212\230\366\225+=\263\362\244}\245H\203P\250\261"
+	.ascii	"VN\032\"e\003\212v\225\"\332\323n\206\325U\332\360\025L\236\r"
+	.ascii	":\266\026\333P\301\241/"
+	.string	"\024\313\355I\273\212\221v,\003C}\363B[\246A\264\266>c\251\020\216\247\006\2606\367\366y\250\002\244\261t\252]\033\321\256\357\364C5\233\336p3\254\030\013\273\370f\222\351\307T\211\303\220\353-\306\024n\201\223\362\376\252\234|\306HC#LR\364\231\276h\227G\234\222'\302)\026\302,p\023\027\341!L\204\215\260\023\377\340 \254\002\003\341'^\201S\334(>z\036\216yp\3175r\003}\374\274\220\266\275\334\331\020\026\007Wz\ty\240f\342\236yz\327\217\251d&\356m\016\037=\235\267\375\220-\340-\253\355\357\216\241\220\365D\330E\004\037\335\027\356\030n\261\206hR0n\231\343#\354s\347n^\332\336G\032\314\341\243\177\276\031\b@\316\013H\255\220\002\301\314m\324\301\333\223\316\375\326] \027\357\346)m\036f\007qzO\204S|\364)\236\b\267n:\350\254\350\f\037=\332\263\201"
+	.ascii	"\344TYqFT\350\376\033\037}"
+	.string	"\3177o\036\325\336\317\016\342\230O\204\323\r+\317\257&J0\310\256\213t\313\306\233\003L\224\f\036\277\317>,\324A~\bn\261D\350Y1\370\205?\345F\237\320\347\t\377\356\227\200"
+	.ascii	"\344,\241\207HJ\370\202.\304\202\236\346\346q\002\2215%\354\312"
+	.ascii	"hT@b\350\354C3\355\317c\204\303\315\243\232\300\r\037g\201^\322"
+	.ascii	"%\217\367E,\350if\340\207\232\024\211\317\275\250\354\375\224"
+	.ascii	"\206\025\006\370%mK2\343\026\266\344\245>\367\342\023\263}lt"
+	.ascii	"I\177\311\037\341\360\302\323n\347:\203J\n\334\364\245<\223\207"
+	.ascii	"\362N\376\311G\371&7\372K^\t\315\006\025\355l*HA\366\265P\373"
+	.ascii	":\325\276J\265\257\177\332W<\355\353\017\355\253\233\366\025"
+	.ascii	"\355O\215\031\270W\364\331\327\034\332\357\211\334\350\277\360"
+	.ascii	"zy\317\027\225\004\353\205\357{>\n\222\374\005>\231b\266#M\316"
+	.ascii	"\326\354j\023\276=\026B1&\302\275\327{\321q5\024%D\273:\247]"
+	.ascii	"e\323\256\362\320\376u\377\343\372\221@\215\246\260\013\372\374"
+	.ascii	"v!\374\205\374P\r\031}\336\240\325\256\202\351\237Q\2614\006"
+	.ascii	"Wf\3758m\345\007Cn\t\356\215/m\377\271\371\2779\340j\204I'Ee"
+	.ascii	"\361k>\006\223\336\256\n\265\232\217_\323J\241\366\371}\334\261"
+	.ascii	"\226mA\213\024!w,>\273\223\217\272\273\312\013\021\035mq\037"
+	.ascii	"M{!\332\333Oi\317C\345\311\337\024\260'\332s\240\006qe\326\035"
+	.ascii	"\177D\254\005\032\237\366'\273\321/{%\377\242w\372\206/{\026"
+	.ascii	"\337\"\002me\357\342u\334<\245\230\355\0038EJCs\321\350\b\227"
+	.ascii	"\254\371\352\301\220`\211}\330\217\335\350\353\360\327\361/\036"
+	.ascii	"\352\205\211a\357\251A,\035\037\365VF\037Lc\334\321p\240\241"
+	.ascii	"\t/pAQ\273<\355'\270n\267\252I\256\002\3015I=!\271\253\f{\020"
+	.ascii	"Y\302\262\323\036#\367t\325\350\251\026\335\262]4lQ\005u\243"
+	.ascii	"\013\306\312\256\b\023\231V\177\\\r\372Q\213\034\373\354&\030"
+	.ascii	"\303\254/\250\033\323\335T\232y'`*\320\204\\-ru\005\f\0202\241"
+	.ascii	"\245!\225\310]e\005\207\224\031\227\223\366\016\272,\351\371"
+	.ascii	"TU8\243<\221\250PS\3004I\255\300[\335\361D\t\337"
+	.string	"\347\246sp!\242\344\354\bP\021\324\217\333g\217q\241=\306G\355Q{r\232\0222\030#\236\037=\236\f\016\252L zZjp)\205\272]e\256BLK\334>\347\302\214\346\022X\2044\344s&\234rD\212\224LWA\034\363j\b\240\227\020&L\362tC\016\245\231g#\344z\001\305\363T\215'\b\327\347\374$\267,E~D\256>g'\037\204\315\220\2060}\316M>\210\f\317\005\330\007a5\251\301tS\242\004\267X\235*@~_\377$P\r\360\314H\0064\222\003\003\217\034\311I\356v\356]G\006\0306E\3429If\332\210\243\363\322\0163\365\027\315\177y\t7G\3502\"\335\316\037\n\300\341c\363y\241\227\375\3642\021w\342\231\210\272\247e\243\307\347=\337\313}\277\241{c\ry@\rI\371<\367\001\256(\021\241\211\301\020i\177\211rw\243\371.\343]!x\337\\\325\b\177"
+	.ascii	"&\tr\2439H\026\2221\354\315\203\207%$\333a\031W?\375\2005\371"
+	.ascii	"\274\356\227\274\037\321\374\343\342\335v;W\210\230\200aS69\271"
+	.ascii	"L\307\004\003/\2759\317t\004PK\272#\203\273\321\f\227\231\324"
+	.ascii	"f\006\350\354\244\333\351T\200\277h\251e7\265\334\266\356}[h"
+	.ascii	"\221sm-\267i\346\220\210\314\311\346\271\315\3474\310p\241#\267"
+	.ascii	"\372\250}\3612\245\375%\367\270\321\334\343\2333{\033aP\347\334"
+	.ascii	"\n\360\227\0373\263\234\246\367\336\"\310\002\f\353\332JN\036"
+	.ascii	"\236\323^\350h7\311h/eD\204M\320\362\331\375\223F\241J\303HH"
+	.ascii	"\354\374\300\242h\317`9\314\263\230\273\213\345"
+	.string	"\262\013\342\355\t\0306\335J,f\3343\231\3472\266\263\276\240\317YGns\224$Zv\271\315c8\255}kf\027XOk\251\356\363\226v\177\367uo#\265\335\316\236\026\277\352\2753\356.\027\337\002\354\355\356\r@\266\273\207N\253\211\306\321\306\263\364\030\370\314\336Lg\323\354\211\211\241i\306\263\233gyO\f\315v;i\330fQ\273\331B\231\031\312\374\335n\237\247\347\366\2012u\232\355v\356\026\312\214\331>\317\230f\313\303l\232==o\323\f\372\304\260}6s\373\3608i\037\350\263)\004\372\214i\232\361<\233>O\317\273[\350\276zq\355\023\023h\233\361\270\354\275\207Z,f\313\336<\316\315\334{\242\375$%\332M\373\346y\265Q{of\332\037\024T\245\355\331yM-\250\r\320\336\177\233\250\003\346e\006\355\036\346\335\033\250u\356\335\003%\201\022\364\366\0059\267\313\366\341\031\352\201\202\266"
+	.string	"\365@\203\266\226\323}6\315\240\240!\336\320\314\260vO\313\274\315!\350\306\332\177ONm\306lw\032\023\0273\032JC\237=\177\271\347\032\331+W\225X\2136?\337\256\233a\315\\!<w\271P\325\330j\373\f\200\255\034\353\032]\224\324\347\254\325\232]@&\301\271\247\026\364\201#g\335h\276\321\346\033\037$c=\327\024T-=\232\202\202\326\354\031\313L\205\215\252J\372\031/\205\360|\365"
+	.string	"\032Q_\237=\333\310U$\310S\246\370\230\373\234k\204\360l\245\241[\\P\2375d\032U`,\246j|n\303T\336\004s \345\031\267\002[KG\250\324\336\355\310^\231\214\207\033^\311\321\315M9\366\333C\362\025\227\245\260\221\3014\276\035Q8\020F\221\036\021\024n!\244i+\354\311\263\323\234\224\230P\013\363\"\205\257\b\n\024O\005\"c\252\212qA\233D\024\325\304\324\322\302\b\224\354sf\362\274\324\002\335[\rf\355\213\251\017\206\347%/\251:\030\277\224_\370\250\032\262\372\234]\300\310u\r\332\370\354.AiN\317\343u\357\034\300\201\031\346q\363\322\274\262\356\337\363\211p\272\346m\230\314\t"
+	.string	" \2761i[{\003\275n\340\3009^\2301\273\207\357\016\213\253\253N\020G\257\333s\001^4\004\305\2365\302\360\230\321\002\300\362\240\022`\322\305\220\300\363\211\260\013\177\201\3351\r\300\234\316z`\265'\b^OX\020Ga\0317\217J\354L\020\2239UV\354`\223\236\341!\370\205\007p\221=\021N=\300\202\270\tvr\363\224\306\262\332\260\222'*$\270J\020\223\005+\030s2\200\344@\313\t\226\004\313\n\306\234\f 9p\202%\261D\0361\021y\\\336\034wJ\020\211/\312\345\216Nv\033\017* \217\311\245\022"
+	.string	"K\342j\242\310\336\344\026t\2148,\316J\201\333x\320ps\263\203D\346 \207,\344$m\2269\310!r\207XA\b.K\026\205\227%\213\302\tv\205\305h\f\201\202\023,\211\345\261Ef\004\211\020XrL\034E\300\240<\301\222hq\001\341a\231,\352x@\301\326 I\250\200\305iR\320\340\306c\222E\262*h\357\340\203\016\037\200\200b\270$&\227\313\242\314R\204\f\305e\221DM\221\265"
+	.ascii	"\007\244\b.n\343!\311\336\324 \213#\310,\221&^I4\262'\254`,\226"
+	.ascii	"\270\271)\216\300p\\\242`3{S4*\325%q\251\225\034`q\216)\300\344"
+	.ascii	"$\331\017\350\341\222(\202\003\345N\216\t\024\254\260\311\235"
+	.ascii	"e1\311\352"
+	.string	"\340\260K\026\025\226\350\342\302\b\030`q1\241s\323bB\347\206\350\202\315\n\"8 \332P\240\324\311I\222H\2625\307\023G\230%Q\205b\n9\307\241\n\305\024\216K\024\025X\"I\330\321\301q\311I\232\300B\316\215\211${\242\004%\007\226\370\302&\213,\324$\213#\264\304\2700\002\273,\236`4\026a\224,#j\212K%\273S\002\366\004\227\032\366\246D\021Y\001\226\021\354\215\016N\021\205\034\023G\0230K\267\361p\200%\222\305\201Y\302\020\207n\343ai\334I.\225\"\224D\024\354r\007\007\003r'\307H$\016\223,\222\205\034\"q\250L\262\312\035$\221\250k\220\307\025\210\304U\211<\352(\211\304\341\rK$\252,\2111\035j\330d\321F\331\341\203ry,\361a\007\251B\007\024;\310\343M\207\016> ~"
+	.string	"\002\212\017l\315\316\215\021y\374\220T\356|`\300\022\005\213\274)\"\223\354\022y$\332,u\210D\r'\330\244\016\221\270.\225\307\033\"q%\022W\326\205\243\222H\\W0\346\334d#\233$\256\220\200\024ayD\036\327\344\322\004#rG\004\2431\204\n\224\304\023,\t\244\b5E6\271.\225\304\243\016\n&X\022D\022L@\201\2055\"\213K%\362\250\227\304\022H\310\310\243\tH\245q=\352(\261\2228B\004\t,#D\220\240\262\032E\034\361N\t\016J\242\006jb\222\354RY\304Y\225J6YSS\034\262'\2127z\207x\202\255Q\356\224\320J\"k<\236`I(wJ\260\260DV\247\205\024\224;%TX\235\026\226\312\235\022C\345N\t\254-\020b]\022?\b\261D\036\207,\024O\030A\"\204u\3516\036vtpX\342\t <"
+	.string	"\361\301\216\016\216\314\316M\216\222M\256(\211\025\260(\354\350\340\260\254\313\233\035%{\202\221]\262$vtp(`\211Eb2G\211d\225/H\025\2167!\030\215E\335BM\221=\241\270,\326\250$\225&\2106*\034m\210Fc\261%Y\2641f\266&g\0042\347\250<\236`\223-K\"\bK\344qg\230don\216&\326\245\215\007\245\315\262\210\363\001\231\203\203\223c\f\200\347\350\260\311\017\313\234\234\344\007\026\234\253$\022uL\310x\210\020#0\340\300\006,\240\215\036\330\025\212&\2109\311\026T0\032\213\037\224I\366\3041Y\363\001y,\342|0&\225\037<$"
+	.string	"\3051\271,j"
+	.string	"\231s\\\026\2279\311\227\233\234\034\n\020\325:\265\312\245\205A\007G\227\246\233\\\021:\251sI"
+	.ascii	"Y\220\025~\216\213\013c\323oo9"
+	.string	"\t\215\035n\201j[.S\365\252\354\352T\266L\367,\310\266\224\250k\271o\206R\326V\325d@\313\216\372z\270\352cI\222\323\322g5M\215ra\365(\362\031\020\007\0228\035\237U4\225\007\f\025V4\316\003]\352\234jM\215\234\251Q\303\025`\202SfY\310\212Z\r\037\034\352\216\214\267\342(\3425\246\226\251EC*\3326\367\2510\367f\306\354\036\2775,.\255\352Pu\344\276\353\\\002\302\016\303\f\255\206\265fw/\020\371\223\322\356*\030\221\034uA\005\245~\251[HH\344\356T/\314\374)A\261\036\265\253mm\254\210\330\347\032\256\332\250\241n\035\005\201\t2\245V\210\303\325-Ws\334:\346\212\036Z\352\rU\005\f\f \203KY`MXI\324,\025\213GO\314\353*k\265\3031&\241}\245Z\271\212d\024t\345\206\301h\312]\206Z\225\205\366\356\001\321\366\374\355\2554\003"
+	.string	"\270i\031\225\253U\256\316\230"
+	.string	"a\331\027Qt\210\0231\0320\\\202BD>;\206\036\3551\204,\\m\301B\215\302|-\233\351\343KF\323\213P\340\223T\223\253Q\256B\211\360\300\223 \247\320\320>\253O\256\022\315`\202\326tR\211\262\220\250\021~V\241\035\230\2448\r\306p\252=\253\034>\267\252L\236\204\b.\007\323g\025\206\007\272\250\221Q\301X\362;(\276\236\317\252\222\352\342F\335N}\341\001\204\255\250\363b3\212T\272$\025S\312\030\222\322$I\032\003\263\024@PP`.\031\316V]\037\023@T\350\243\241\234\205\031SHfDD\222\024\024\224\322v\300\362\301B{^\353\261\307\026=\030k(\006/\311\260A\214\205\266\367\205\021\260\252\222*\004#\3142Y\330}s\nn\002\364\311n\276\214)\371\004y\265C2\330\355\311\247/(\024tIe\2430\341\177\030r\326`\205\370\202\201"
+	.string	"n\206\021\f\345\213\346w\264\341\025]\356\327\377\3670jh\303\272\366\277\316Y\247\353\004\026\001\177v\\%\231<\317\320S*\020\320\347\002:!t\013\242\321k\373WV7Vl\r"
+	.string	"\256\224\372\357\245\222f\003\034'\250\273\211\340\227\303\341S\317\345\215\355\251\2343\036@\216\033*\331\027\360A\2324F\204\243\026\200?Rj3>\272\343\327\bQeN\262\225[\343Oh\372w\"6\b\240/\003\311\n\017,\033BlF\n\002T\b\300\017\230\001K\233Bz\210\227]\300\234\227\242\fL\332\374\023'\263\275\376\346\300[K\007\223\361\321@\020v\243\233\204\bjW\306\217\033<)\265\220\\\016AM\013\232\242\236E\0078\007YXMk\361\267\355\3737\fL\225\3202\226\376\343\201|C\343\232{J\212F\271\313\232\\P)7\\D\346\313!\260\267\233\332\035\330pr5\246_\252\177s/,a|\267/\261\252\236\263,`\001\035P\271\215A\260@\346-\202\205\031\200\224\242\305:\211\376R\311P\201\201\002\305."
+	.string	"\344}O\202\272\254\332)\377?\025`\004*\034y\320\334=\226\232\355\363\316\227\226YpL\024b\b\277\002\225\242\363\243{\235\361\242l\245\222@\244\305K:k\245\203\363n\222\013/\352\221\336\260\352\036h\334\201\0201&\022~\210\240\351\201x\305O\301m\362\343\"\214\\\251mX\374\"'\321\026\243REs\362\021\333\204\241\377\373\276\324\030\224X\210\304F\274\351\024?\2755!\305\033X\237+'\204\273\322\332\2113\273G\rw?\220\315R\217\007\365eR\325%\027\324q3\206k\240\307:\326\266\006&x\025\300=El\376\370,O\350"
+	.string	"\204=\364\025\t\024]\025\204\260Z\322\017\203\317I\331\200\376\314>\247\202\030\351j\205vpI\tW\023\361\347\376M&\332\336\353X\317+<\277\221\026\024x=\362\350t\224\334Mg\225\320\020\370\353\263\226\n\323\022H\371\206\002\241\373\377\301\273\024I\022\231\031U\245\266\325@3E\306PF\275\304\315\301\304K[\3105\210\241\350\203\277\224\024\342V\225\016\r%.\020M\374\245|\217\265{\330\0131%6\262\b\350n\310\026\002\303\317\224\207\336n\367)3F\316\031\006u!\351\021\323\320}\227\272\205Wl\204\353\256\366;6Z\316\300t\377\251"
+	.ascii	"0\256\215\270l\271\033\306\033\003\017\372\202`H\303,xp\256\377"
+	.ascii	"e*`w\312\306*\2043\311\232\277Gu\240,\200\317\335\020\254\340"
+	.ascii	"\002J\177N\003-\262\356\220\313 \227\b$U~\370\211$`\351\234\222"
+	.ascii	"y\375&\237\235Q>f\261R\332\013\264\307j\be\036,\266\321\336("
+	.ascii	"\304\247\2361*m\305Ue\327\2033\363[\214\234t\033|C\316\210\335"
+	.ascii	"\343nDU<\250k\240Z\334\376\356\250\367\270\300\235bu\344\021"
+	.ascii	"Z\372\276k\023"
+	.string	"\302k\220prN\322\322&\352,n\340\230\002\360i^\335\017+\235\216\255F\270\365\305\351\023\b\021\323\361Z\253\004\377\325\336\034\333\350I/\335\225\332\305=\312\\\347\321-\322\346&nwN\276\317\207Q\371\275\035\031\204\f\312\020\247\350\264\375\001\232\\\223\357\332\f\004\030\253\310\373rwAp\351\f,@\2629\370\0174"
+	.string	"\337\265\252\007Q\026`\360\326#d\016\203,b\033\370Jx`'\204\366\002\233\330rDg@yR(\333\356A\260d\243g\035:z\216t\003\255\323\347\034\227q\216\237\340X7\340\363\223H\212\250\031\177R\2032~\262\310\260\333\377\r\273\270\253{\t2O\370\337\367+[\214\317\354O\321\324s\354\225\267\004\363\035\214,\212?\233M\013G\351\357\276\363\221e"
+	.string	"\212\224Q'}\322\341\237I\230\226\2203f\221\025\255\337\025\360\027\244\250\314:\363\021<\230\260\215\352T\2112l?\336N\202Mc\241\375\023\206x3*w\036\361 \250\"I\330\301\022\204\233\237\230"
+	.string	"*\004\333\\\273\003\223?\301\227J\362\374\344\222\no\214qzcY\312\225\350\177\327\222\016_\024]3\025\330\035\t\250\355L\202\370\007\002so\344=8V:\034\bc%\321A`\b\241L\353\256\005#\023\210\3775\276\235\216\003E\264'\232\255\233\354\352\206\354\034\\1!\214\210\277C\345\351P\277x\025E3\024\016\006\236A\205\022@\376!~\206\360\316p\323Y>\032\344\013Y\020\n\305\b\363\3547\034\226[\227A\271+\276!\006\247\024)V\241"
+	.string	") NI\245\362\3348\301\225W7\320\2561,[\246pHve\216\032\r\257vZ\336e\356b\276\223:|\026\215\\\237\334\0364\"\225\333\322<\001\210e\256i\347RN\266\005,\030\271\363\320\374U\3420\324\250\031\366\255\306L\225\3368t\266\307\245\330\236571!\222\340\350@\340\016Q\025\224g\005\2754;\207\031p\330\200\033\352\030\350\363\243\377\243\355\203a\201,\244\264\374\360\223\315\363h\265-4\227\350\261\360\005\0032\201\277\t\261i(\2445\233\205\0310c\222\021_\222\351\357\253v0$l\025\332R\316Y$\235\032I~\0345\272\367`\347O2&B\230\272\330\304\340\b$\rc\362\237\034\002!=y\004w\352M&\016\035\333\263\304\245\021\013\330/\315\n\374\255\r"
+	.ascii	"K\020\321l\032*\301\303\367\331\026\364\356\312\252)S\t\271Z"
+	.ascii	"0\373L\362&\353'K\310*E\275Z\321\244\301\023\223J3o9"
+	.string	"\365\316+W<\313\b\337\031}D\260,\3741`{G\001\214\260*_\b|]\234\307\222\236\320\257\360\202\037v\261|\212\f\307|\211?\361\321\347r\217{\003-ZP\264-\364\t\203\016aC\310\211\201\352\277\332\342\335\364\001\362CJ\216Q\212\037rC\224\367\2122\0044\375\257\221^\364\2443\245J]\331\346M\216\300\336\375P\260\227\325\3262\242\264@{\035\036B\233\271U\375{\017H\370\330v\321D7\210x\022^\317\271L`>\217V\245\213\246C\312\b\177;\203\273\030\313\377\177\026\300'\203\003\353i\033\245gm}U\317\033\347\030\r\225$\350\371S\276\322\227|\025L_\331@\037\3103A\031\352\005XE\231qX(\314*D\223\02608\017\0301\255\206+\016\352\300\"\300\344\001\324\276\213\371jQ\207\333Bbh\235\306R\311\230\256\261-\310,\031\023\3047\213\317<\233\262\n\245Y\r4\361"
+	.string	"\260\3409\200\221"
+	.string	"\226vP!\3558\025\026\313\254M\253\275\351X\215\346\256\344\371\206dG\006\246n\002\001Y\257)\025\310\347\340\335AY\023L5e;\221\354\026\003m\210\242\031\223\363\364\233\310\262\201\r\f\236\f\177\205:\306\336\367\320\203\300Bf\265C\256\t\3228B\225\0311\336\225Z\246~\373!\003\236\214\265hl\036\355\001\240\224\"\246\240k\f\325\223\344|\255\203J\270aI\003\\\325\235k\277:\203\025\327\344\030t\026]\277\203\313\270'\257\354\361\204\316\007\274\2148\234\2262\335\217\205x\372A\016\005U\271\005@r\037\311\374c(\377M\373|%j\376v\1776\313\b\034-\b\216\201`?\207\277L"
+	.string	"\013z1\225w\025$\362\003\022\013M\256\007\254>\201\0338\r\032+qg\313\312\006\365O\373\231\031\260\b\323\311g\247\362Wu(\351\244\035\022O\340\004\371\230\n\262\332\b\347\250=d&\374C\2527\t\335\346}g\264"
+	.string	"-\342\016\202\277\017$\244\026R\304R\255\314\215\226]\237\301\f\371\212s\317\020p\234Y\365\246Sr\204+GCQ\201\202\211?k\303J\330\345)\336\245x\003t*`_\374!&\272\007\260\017\373=Qg"
+	.ascii	"\277\205\316\337\304{\224\363/s}>\257,\177%\332\336;\317\027"
+	.ascii	"-_\277\370\363\267s\231o\255_\243\257I?\304\207\323]\372\361"
+	.ascii	"5s$\234\313\252\253\350\307b\233<\365\261\367wY\205\266~Xi\335"
+	.ascii	"?\377\276\265=\315\274\205>0\274Hfy\177\314\202[c)}\200\231w"
+	.ascii	"\273h\277r\263\013\257\241\036\276g\243G)N\235\264go\323\350"
+	.ascii	"+\237=\022\003uk\277\254\277\376\260\355\t=R\002\3177{\264-\376"
+	.ascii	"\374\365\305\303\326\204\301\211\375\021r\243zA\334\n\354\357"
+	.ascii	"\302s\3517\303n\344\271\226\336?\264c\200\027%s\213#\347\327"
+	.ascii	"f\244\266\022\031\345w\321\315\234,z\tx\254\234\006\216\364."
+	.ascii	";\376\232t;;\310a\337\354\364}\300x\241\177#\316\302'\303\337"
+	.ascii	"\224\377\340H\363\256\270\253\327\177_\213\3152\252+"
+	.text
+	.section	.gnu.lto_.symtab.370f3c7d586adc37,"e",@progbits
+	.string	"fakeGyroDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.370f3c7d586adc37,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
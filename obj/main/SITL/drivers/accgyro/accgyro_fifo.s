@@ -0,0 +1,271 @@
+	.file	"accgyro_fifo.c"
+	.section	.gnu.lto_.profile.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375 V\215\001"
+	.string	"$\002J"
+	.string	"\003"
+	.string	"\372\303\247\205\007\002\002"
+	.string	"\002\001\001\231\323\374\330\n\002\213\305\243\371\013\030\002\003\004\003\002\003"
+	.string	"\005"
+	.string	"\271N"
+	.ascii	"\202\\^\201\035\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375 ,\265"
+	.string	""
+	.string	"P "
+	.string	"\002"
+	.string	"\001\003\002\005\003"
+	.string	"\004"
+	.ascii	"9\003l\326x\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375 \264\r\004"
+	.string	"\302\006\031&\200K\322\001]^\203F\232)D`\027\370\320u"
+	.string	"\233:\305\244\340\343\037\006\226OaD\216\022q\025\262\t\221;\005\377\267\033BQ6\226)\360z%\352I\211\003MX\321\017D\232"
+	.string	"Q%\227\307d\200\231b\016\313\370\357\032\f\273\030\277\250\035\215#\"\270\353^\003\373B\325\217\275\357;43\023\277W\002\013"
+	.ascii	"p\330\013\023 \034\310ls,,\341^\205{\2234\313\0215[\203\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375 -=\001"
+	.string	"\370!"
+	.string	"\002"
+	.string	"\001\001\003\177\002\005\002\005\001\377\007\177\002\005\177\002\002\177\002\006\177\002\007\177\002\b"
+	.string	"\002"
+	.ascii	" \370\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375 6M\001"
+	.string	"\370*"
+	.string	"\002"
+	.string	"\001@"
+	.string	"\002\005\374\007T\374\007\370\005\374\007"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002\t\003"
+	.string	""
+	.string	"\002"
+	.string	"\003"
+	.ascii	"w#\200\3746\320\006"
+	.text
+	.section	.gnu.lto_.lto.1520171b753bec52,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroFifoFrames.3.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375 z\305\002"
+	.string	"\364\003m"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\006\005\001?\202\210\200\030}{\275\001y\274\001w\273\001\005\001\006\025\001\002\001\b\302\001y\301\001w\300\001\300u3\304\0014\303\001\277\001\276\001"
+	.string	"\t"
+	.string	"L\030\322\325"
+	.ascii	"4\0133U\030\214\201c0\325p\212\353\030(\002"
+	.text
+	.section	.gnu.lto_gyroFifoFrameSize.4.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\325\b"
+	.string	"&\321>8@\217\322\001\230\265(~\222\225]M\036P\306|}\225\005;\301\f\250\b\374W\027\036Q\033\213\354\0139hINQ\024\277}R\330\213\321\020@\022.\2243D6\331;\245."
+	.string	"/"
+	.string	"."
+	.string	"\322\266A\b%\233\376\265T\240\027\016\025\231\335oF\220\233\016M\376K^\300z\245V\247C\200\206\3355L\255:\356x\333\036\333\f\266[\002w\375\020\023\330\340\304\354\252^3\013#YDl\227\354\215m\b\355\217\234\244t\027\2065\273\036.+\273\337\201\027\002.;\347d\227\330\007\262\007\364)\023\236\004\333\027G\361\bZ\273\032\n&?\241\300\036ri\013R\366\324\245O\312.c\324\270P\360e\177'\030Y\366\261\335]\307\017\307#MT)\227y\373P\256\343\034h%Al\2336\275\032\252\350\352\303\214\3504\321\334\2527?\006\246\022\241:G\224\326\271\371\366\216\261\203\212\031\266\003\n"
+	.ascii	"_\241'3 \f\033\206\253a\232\222M\373\270\214\ni\fG\016\021;\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_gyroFifoParse.5.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375`{\t}5"
+	.string	"Z_\300\024BP\346Q\007\013AZ6\020\255\252\241s\006O\244\217\354\330\223Kl\254\r\300PAf\374\004\202\275\331\270#\311D\201\t\210\236\2501\362\001\323\323\317\377\017"
+	.string	"\377,\005DdO\266\331\022\356\266\367N)\245A\001!\0015\001-3\237I\2467\314B\027@\201\356}F\265\312Rl\253\314\254z\227I\266\360*\361\374!\261\216\311\"\343A\025\323h\\\235f\303\205\267K\251d\003\333\252\320\377\331`\270:\314V\222\360vA{d`[\345'\353\316\334f\355\205\253\317p0\357\336\2617m\367>\023\360\004\266U\247.\256\255\246M\\[m"
+	.ascii	"\201\213\223\375\204\"\344\201\234\027\232\241{\237\307\177\362"
+	.ascii	"\235>\233}L\374d\027\217\210C#a\020\370\363\265=\036\273[\325"
+	.ascii	"\364=\311\375`\242\312\2702M\035]l\233J?J\373\355kJza\255\314"
+	.ascii	"\211Rzh\364\364\366\025E\b\305\203W\276\22480=\360\366\025%-"
+	.ascii	"\266\211\371/\025&I"
+	.string	"\027\270\205\271\317\t\030\222n\237z\273\fc`G\232\367\366e$ubS\304Y\267\346\300\004\310\334\030\030\222\336\211X47\006F\326k\272\304%m\tT\032\027;ms\351jzAL\316\220 M\036i\337a\"\327k\375t\345k\212\247\251R\035-\203\200M\257\264\300\2221\314nkg6\273\374{\255\275\315\0303\27210)\355\273\f\367^v\037M\260f\244fn-\314\274\305\314b\bl\265\372\367\030TN\277\277\257y\325\365\233\344\231\024[\306\275\265\266\332\257\266\251\3034\262\303\027q\2407:)\351;\271\033\307z\340\273\255U\200\231\303\303\247\313\0175\030:^\314\177'\363S\207\003\313\016\005\342o\302La\202\204\240s\204\2403\204\2166?p\320sn\320l\315\fzL\367\202.\323}\354\264\356\004\035\246\033\001\353\034\325g\335\007\202\316\005ZM3\224\221@\2475?u\230f'\240\363"
+	.ascii	"\326\271\251\347\314\364s\026\360s^\3729+\355\234\003\264\316"
+	.ascii	"I\2553\200\2373\022\353\\\3749\037\251\316D\325y\310:\033\375"
+	.ascii	"\234\205\254s\360\347\fT\235\177\252\263\217un}\316\275\2363"
+	.ascii	"Ouf[\347]\353\274\366\234U\3269\3553\315\317sv\326\271+\274\024"
+	.ascii	"/5$@\367\nY\224\350\332Q\325P\351h\267\232n\266\3563\2352\257"
+	.ascii	"\341f\303mtK\2102\310\2144\334nj8\352\324%\274]L\200T\271\367"
+	.ascii	"\302`\033\rw\033\267l3\372.\277x>\240?\250\330V\233\231\213{"
+	.ascii	"\215\003\r\365\314\004\r\345d~h\361\324\367N\366\036\004\336"
+	.ascii	"\036+u\274\b_\340\231\314\b\032\352%|\273\265\212%\f\320R\254"
+	.ascii	"\300s\317y@\026\367\314X[e\212\022\226\364\f>\300\267\003\370"
+	.ascii	"$\250\007\360>'m\221\376\350!\024\037\251\370\006\340\210\177"
+	.ascii	"\364K~\272O\017\237\370MpF?\2243\372&4\357\t\037\370\021\376"
+	.ascii	"\243^C\202/\374\226K\022\351\340+\rb\032\371=\360UE\254\357\177"
+	.ascii	"\2374h\231\250}\3377\221\366\223\242\375\274W\007\257\305\332"
+	.ascii	"\373\356\003\355\303\f\242\343B\360\232jz\340z\317k\252\321\235"
+	.ascii	"5x\247\177@\204[b\341\275\372\r\236})\306>\317\233\243+\324\263"
+	.ascii	"\337lZu\023VhyE\371\367\336\035\354\356\027<\203\367\350\022"
+	.ascii	"\313\332\034g]\177\367\275\274\242\364El\374\365{HX\\\372\352"
+	.ascii	"7\217\350;R\355\\W\004fN\222\265\235\022/\264l\271\267K\002\235"
+	.ascii	"\256c\"\355\262V\371\004\212\265}\264\312\235\342\33394\272\263"
+	.ascii	"\035}\357\275\273T\354\376X_H\363\243\307\312\264F\265tP>N\315"
+	.ascii	"\264\366G=\273W\230\322O\264\016\212\372\316H-\244\206\254\252"
+	.ascii	"\033H6\253\352\0062]\265b\320\270\232RG\334@Z\365\262\250`\310"
+	.ascii	"\260Bf\355\\h\265\210A\005cEj!W\244ZH+\254+\026+O)\270bQ\305"
+	.ascii	"B\352\nk\253\305\324\024\362"
+	.string	"\230\205EU\243\nk\3051F\025\322\3528\205\225uTp\200\257dPa\035\265\256\256\260\216\355\363\366\221\361\231h|\026\032\237\323\324\370\377\314\227\221e\t]\240\035\257,\276\223\217o<r\213\203\312Q;\322\304\314Q:$\360\273)u\316i\0268C\n\t\376\351\231\275\326\307>\303\t\317\251#x\247g>\375\200w2\350\234\246\037\360\241\025IU0K\204\250\211\030'\217\230\227\2633reG\210\357\344n\353\016P%^lF\016\236\323\325\370\004\006\374\323Sx%?\313*L\357\364\023~7h\211\245\351\231\276\327\332\030\304\f\032\247Vw\366\305J\331\360\235\235\\\215\357\340\377\016\0334.Ml\321\037g\023#\001\017$3\224\n\370\366\363\252\362\220\231PP/\275\357\215\220/}\257\201\302\231q \\\035\236\340;9\307\275\215\\\225\336\353\240|z.\211\004\251\364;\264\2500jn\200\356H~"
+	.string	"\202\376\336\311-Y+\341U\262]T\200\300\250A<\342\024T\n\315\210\310\004IA\222\306\200\002\221)+\326\001\021\220-TV\244\240\031\326l\330\3008\376\017(\240\315kw\223\021\t\022\350`b*\374&n\003n\005l\326e\006\310,\307\316\205IH\204\227\200=\317\231v\024*y\207\235\343\376\307\356\270\235\366~\274y\210\036\007O\224=\253?+T\337\275\3559\372\202]{/\236-\323\203\t\351'\340`\344\0131\341[\273w\227U\0315\2469KS\t\031mZ\315\307\320\357\215^\033\264+\250P\246\266j\340\333\304`\265\037\253\210 \235\351\016:\235'\022\247Za!!\206\003\205_\226\346\021w({\273\310H\321\223z\305\260}\213\002Z\236\207\374p\310\351\350\030\243\215=\244)\036\301\036\377\f\210\t\306\330\031\317\2053\275\255\346\340\3263\237\236\275\217\234"
+	.ascii	"y\354+\225\036gI\343\013\376\n\"\017x@0\261\223n\004\017\002"
+	.ascii	"\024DJ\\\020\355\002\022\375\204K\013|Q\002\265`2\204\332\266"
+	.ascii	"\223\201\021\214\214\266\035\370\322\353\326\210+\215me!\211"
+	.ascii	"\355\023\274\267e]\00150\003\313\3044\230\2312e\204\301\355\356"
+	.ascii	"\n\300\366s\0366c\201e\204\232\216\374k\207\350\251z9\366\245"
+	.ascii	"bP\336\323\007\356~K\345\363\326\354\235I\365&\033\371\206j\343"
+	.ascii	"h)h\034Dd\\\233\203\033\215)5\376\370|!P\257\344Q\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375 >\275\001"
+	.string	"\364\002:"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004\177\n\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\003\013\200\204\001"
+	.string	""
+	.string	"\003\002\005\177\f\360\372\254\016"
+	.string	"\001"
+	.ascii	"\036\235*\003"
+	.text
+	.section	.gnu.lto_.refs.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	"\003\002"
+	.string	"\001\b"
+	.string	""
+	.string	"\001\021"
+	.string	""
+	.string	"\0018"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1520171b753bec52,"e",@progbits
+	.string	"(\265/\375`\250\007\275-"
+	.string	"\312S(\022E`\\N:\335\244D\364\3615-)\356\343\026\245\256\341\210j.\037\303\377HA]|\003-'\260j\301\314AG@\3636-\333-n\022\207\376\374\375\354\005\367|\325Hi5=\2651\300\b\233'\223!m\313\024\354"
+	.ascii	"\026\001\r\001G\353_3\315Nw\333\224\324\324t\353\372\332\234"
+	.ascii	"\251(\313]\216c.g9\206\013:\262\034\332mdN0\304\234\300\207\016"
+	.ascii	"\211\261J\212\036K\375\b5\211\221R\340\006\365\032Tf\262\025"
+	.ascii	"n.\261\363\022\240\016\\\333Z\255\273%\022\332\023eO\236\213"
+	.ascii	"\236\202z\276\362\002z\ru!\365\274\224\362\223\227\322_\265\210"
+	.ascii	"\221\322;\031)\005\342\243\224\247\004\317T\216R\245X\333D\300"
+	.ascii	"8/]\177\027\275|\264\366s\032\253-\001\221_l;\273[#\2426,yv\321"
+	.ascii	"\267\214\224\252|\224\362\317\335\202\377I\"\376\013\370\331"
+	.ascii	"\347\277\001\020\004\376\353\023\206\201@?\277\371\177\347?\227"
+	.ascii	"\377t\377\347\376\333\375\217\373\237\376\354\367\363\375\217"
+	.ascii	"\347\177\235\377y\377\235\377\343\374o\363_\315\177\275\377w"
+	.ascii	"u\377\325\376\013\375\027\363\037}>\237\317\377\177?7\370S\255"
+	.ascii	"K$3\b\033\224\273\302Dk\257ve\264\3363S"
+	.string	"\252\314\225\255\277\272\233\345\250h\313\034}}q\212?\300\330\211\303pX\217\331\037\034]\330\270\\4\002#\245\351\032f\303M\006\334\346\032\321\343VE\213zf\220\002\237Of\220\262\232\240/:_j\324T6\303g\270\311{?\243\3414G\333\330fv\267B@c\330\035\334E\0210R\2122SJ\364|>\237\314TF\017\025\242dK\332E\231\f\343qS\211\363\316S\270\355>\306\266[\356#\302\265l\242\312\350f\245\224\237OV\032s\027Dd\316\314\263\r\020F\213\022\033vb\2005\326\346\300]\264\r\002\0033\302\206\341\272\264/L\216\330E\317u?\267\314\306`H\f\030\362QF\006\314E\277$\245`3z\210\271\350\371L=T\025v\033\002v\223eA\353n\347\330\013w\341&\323q\226\363\033k9\267\335\307\356\376\004,\3546\264\266\r6\205\305\253\357\334\366\007\177\tPL\307[X\316"
+	.string	"W7\031\217\354\327d?\256\243v\267\204;\2611&"
+	.ascii	"\315<16:\347:nA\335j\335m\200\327\310\314\220\\\364~\314\007"
+	.ascii	"@\231\366f$\217\372\373\247mTv7\016\237\266\225\\Ag\037f\246"
+	.ascii	"_\210\201\254\240\201?@\244\233lo\216\312\004\316\350\343\242"
+	.ascii	"\377\021\364\241t\257F\335"
+	.string	"\266\022\3114[\221V\364\226Fm\227\rh\346Y#[\263%\312\366\355\266\271\217f\313\025\310\226U\"[v-\352#\273v\267\313\"\244\323\2702\222i\266D2\331\245Q\037{m\246\261L=\262K\244\035\273,B2\215K\344\321li\364coH\026\032n\332\244p\036\362\3307\222cFe\021\036\262e{\257\233\235]\255T\320=\306*\367\214;8\216\013\357\006\327\233\221m\245$W\020\266\217x\310&lw\023\256\023\235|Z[\274.\302x\353\331X\177uu\023Hv\257\334x\335\275v\367\217r\254\355\356Q\204DK&\273\305\222\222=\266\312uu_'_\\B\255b\225\007!\255!!\214\341\007\243[\r\213\302,!\226\372\247\250\007QR.~.5\025a*Bz\251\251`p**\250>*\bT\205T[U)\212\304\242-\252\250\340V\326\360g\353M'\252\020\026\235\266\210\304\242S"
+	.ascii	"\024Db\005*\237\254\252\241\211\254\013X\303\022@ZT\302\024U"
+	.ascii	"E\f\304\253!\006\"!\214\241\026\272E%\265\2255d\361\363`\320"
+	.ascii	"\002\202\020\0342\250V\020\210W\303+*+\253*'\255\242\260\305"
+	.ascii	"\260h\302)kX\225\302\311\252\250\345\004\241\301\226P\353\352"
+	.ascii	"\252\003\261\370\002\013\300\333\241\324\311\021/\271\213\336"
+	.ascii	"\256'\266\333xg\\\257\337\256\267\267\213\350\217\2109\301e\362"
+	.ascii	"\226cOz\304\243&\341\2632w\321\277\277k|b#\306\364\263\216\301"
+	.ascii	"\263v\327_cZ\306,\013\273\350m\346\003\002R\343\006\224\213\362"
+	.ascii	"\223\355x\t\023'\220\213\362\036vC\364$\355Y\347\242\254\207"
+	.ascii	"\373R\263.\31687\237 t\330\300\215\251\347(\314w\232|\207\361"
+	.ascii	"$\265\275\306\200S\352pp\247.y\340\370\272\350oR=\313\3419\017"
+	.ascii	"\200\206\250\2218D\f$\006\221\241\031\021\221$Q\007p\002\221"
+	.ascii	"13z\022\300'\241h\006%HQek\177\003\362\213\327)v\031\026r\032"
+	.ascii	"\026\204\213\266\367\324vh\360\372o[v\253\2140\006\034\226\226"
+	.ascii	"\252\203$%\351\277\017,T\246\243\3359\330\002\023\350;\261\276"
+	.ascii	"Y!\371%\340\262\246t\b \216\026\257$\002\003*+\\=+\300\300]\020"
+	.ascii	"\t\345\367l7\241\300\342\0130\341*\301D\270$b\252EF\024#\314"
+	.ascii	"\3223Q\tt6;\211\230$\255\034p<=\201T\244t\262\"n}\254\224|\302"
+	.ascii	"\224\032)\255\244?\346\224a7Y\304\356\245\225,\315k\322\2228"
+	.ascii	"0\257\342z9\312\033V\3330\301w\006-\361\343A\003\353[\317\001"
+	.ascii	"h\217\002#\020t\222x6\327\265g\302\317\027\030\245\344\217\214"
+	.ascii	"\254]u \350\336\253V\240L\326>R\203\300\352&\254>s\f\3004\007"
+	.ascii	"}`KD\336\037R\004V\256\230\362y7)\271\"'\324#\340\377\303E\360"
+	.ascii	"\300\036\034\237\004\360\345x\273[\271\344!\310`\235\332[\b\315"
+	.ascii	"oUF\214\375"
+	.text
+	.section	.gnu.lto_.symtab.1520171b753bec52,"e",@progbits
+	.string	"gyroFifoFrameSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"gyroFifoParse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1520171b753bec52,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,303 @@
+	.file	"gyro_sync.c"
+	.section	.gnu.lto_.profile.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375 H\245\001"
+	.string	"t\002<"
+	.string	"\002"
+	.string	"\275\305\245\255\t\004\002"
+	.string	"\002\001\001\224\312\322\301\017\022\002\002\002\001\002\003\002\001\002\004\004\002\001\002\005\002\001"
+	.string	"\004"
+	.string	"\200\203+\271v6m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\003\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002"
+	.string	"/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\275\007"
+	.string	"RM'(\200K2\0343\016\234\300\fE\003\323\311\242\231\342\256\200\007\264\031\034\266-\315\025\231\220\tyN\211x\221\266\267?!R\246\377\317A\213\036}\221- \306\303D\264\227\032\320bC\003\332\r\244i:\233\307\352\022Bm\007\346\252\262\036\201\315\016n\206\243\330\342\363\f\204\262-\244Egb\212\f\022STX\304\024\037\201\200\035\220\302\314I\212\316\314K\340E[\202\267\314e.\007\223\275\2160j\0130\327\204l\316\b\3336\275C\333\311\247\304=\003)\257!%>\363I\230\321V=_E( p\242\243j\035E\200\331\2008\312'\320\256,\347d\266\333\302"
+	.ascii	"d8r\371\233l\nA(@\3341p\f@]@\f\204\206\302-\366\222\030\333f"
+	.ascii	":\234\\\232\221W\202kA\006\227\374X\fm\2156\\\275\035\221qu\374"
+	.ascii	"\272\032@!\022\263\\\023Q\221\213\353\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\001\001\003\177\002\001\001\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375 \200\215\002"
+	.string	"\204\003t"
+	.string	"\002"
+	.string	"\001\370\005"
+	.string	""
+	.string	""
+	.string	"\001\002\013"
+	.string	"\001\002\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\240\n\b\b"
+	.string	"\001\001P\002\002\n\t  "
+	.string	"\260\003\002\f\200\n\300\n\b\b\002\r\320\017\020\020"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"I\211\342\2230\270\003\350Zu\t\030\203\251\214@\323\217\r\264"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.lto.d485f7ca70ba2dc1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSyncCheckUpdate.17.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"U\f"
+	.string	"\226\227TB q\223\016L\006\3341\"\242\007\"-c\355O\241\266e|"
+	.string	"\277B\376\251\364"
+	.string	"PI\027\205\037\021\264#\350\264\235\032\250\030\321\246\210\021\022"
+	.string	"\261;\331X:\357"
+	.string	"M\036Ix\374!\226\354-wJ\001@"
+	.string	"A"
+	.string	"A"
+	.string	"\220z\200\351\320\266\023(\350\030\033\220AI%<\233\214\335\031\365\303\261?u\230\257[\311D\313\37664\016\327\214V\362\n\354\356S\356>\032\211s\027\007\273kg\242m\270\341m?\260\335\300>\204?\374\274\235\235\177!\220\301P\301\242-\346j(\325\330\024\360D\210\317\337\356\370)\306\370\023{\353auE\207):ph\006\224s\366EG\351|$r"
+	.string	"\273 \022&v'\002wP\207\236\0270=$OC\333W2.T\304\213\023Q\f\267\273\231j\310\307\246\353\004\025R\211\243a\033\303G`\324\356v\370*\234\213\002q\350\213L\207\327\223X\234\240\214F\\\311\236\231\323\220\375\267\273k\005\331\037\005\034\215TK^\037\317\025G\025rm$DK^\037U\345\0217Rs\001DR\210! \036\025b%7\221\303\200-\013\032\0319\226%#f\356\337*\310\021<+\356\333\027\240\360\260\350\217MN?z\371\264\314h\031\321\024"
+	.string	"@E\261#\236\207\205\270[\220"
+	.ascii	"\263n+k`\005\021\006\017\221\313\022\210\213\237Cn\3540\327\354"
+	.ascii	"\231\205\355D\246%X%O5\003\225\304\241\356mm\321\003"
+	.text
+	.section	.gnu.lto_gyroSetSampleRate.18.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375` \004\035\031"
+	.string	"\326\352\231I\260\032Q:`\233?D\266F\227\252L*%5\366\343\327R\013P\341\356\226z\335j\337\370V\366\013B\311a\233\034\300\243\277\215J\370\033\256\375\243>/4'\3645\240na\373\357\324\327\013\204Y\220Zk\204l\262\367N2\203"
+	.string	"~"
+	.string	"\211"
+	.string	"\335AFG\335\247\002~0>\344sdf\276\217\023\361\260IO\034\013\007X||\301\356\223T\335\346>\244\027p\037\326\0347\217:\215\342\rm\245&?\302\214\037\255&;\252\3728\325\320\215\242\270j\021\343\327&\240\201\344b\246\346cm\244\334\310r\337\351OM\005\r?\213q+\256|/\340\304\n\255\346\3425\005\252\326\363\342\252\272\3736X\300\260T\\u7SZ\255\3059uf\346\301\314\033\230\355\r5\255\342\206\320R\333\032A\312\226\202\216af\235\017y\031Pb\016q!\261\261\273\037\374vF\324(\351x\310?q\037\276b\350\301\264\233\321&\346SF\353\215\371\266k\020\363\317\177<\357l\337;WK\231V\312WI"
+	.string	"\272\001v\257h\n\323I\241\022\241\363\376\336)3\017?\310}\234\352\231\004\302n[\226\334\205\363L\333\270\025\221\226\245\356\023\347!O\030)e\376\356@x~\236x\200@\213\n\247 \021\271L\021\360t\245\324\210]\220\f\031\271LQ\217\321\311\201\277!\026+\322\315I\327\303\341\375\236\334\273.\255\267\021\344\n\n\372\205\231[\207\342\032iU"
+	.string	"\204i\247\344-0a\275\375L~\f\341l\275\335\303e\316y\023\017\025\210\202^f\264\211o\364/%\311\250\230w\275\361\022>\223\0311\271\266\035\361\223"
+	.string	"P\035u0\327}\204\217\004\365\327}\310\224\326=2r/\302\314[\306n\331i03o\241\001*\023\026Z\"X\031Z\037@\350\2604\224%\213\306r\271\240\334)\021\343@\276`%\\e\311\"c\260\026\211\034X\007r'\207\245C\226\260\030\271\340"
+	.string	"\277@\264`\244\210\327\013F\246\316~\rb\b8N\242R\225q\244r\3636"
+	.string	"\272\347r\032\241\235\275\266\233\327\326\037\b@'\n\347\315\373 \217(#\027\341n^\212\323\355\270\fh\214v\330\001}\363\326\372Sg|jI\263\332\303\2662\263\216\305dzq\327e.o\305%\243\013Z\250qD\247\024\"3%\"\"\232\202$9\220\"\"\253\362\021 I\005\031\315\024\230\346\264A\354\002\203\004\360\253.S\366=\231\257xL\215\202N\242\324\224:i\0247\323\247RT\265a\031;\224N\210\226{\265\002XC\262\321]\257\300\301\376\225\250\226G\222\303\035\306{\317x|\nD\272"
+	.string	"e\017\327i\n\265\327\265\333n|\222\335\212\274\254S\245\373\373Qk\265H&\351\370\200\266\273\264\036\024"
+	.ascii	"\355;?7\302\200\267\337A\031qR\323\306\215\017\325(\240\327S"
+	.ascii	"E\304\332H\324Gy^GW\340\006\327\241e)\327\301_\002_(b[/\f>R\314"
+	.ascii	"\032\021\024s7T"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375 65\001"
+	.string	"\3602"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\021\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\022\177\017"
+	.string	"\002"
+	.ascii	"\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d485f7ca70ba2dc1,"e",@progbits
+	.string	"(\265/\375`<\036\365\213"
+	.string	"\n\343\3102Q0\220J\352+\005n\002\321$\354W\343\306\327C\346\223\022\020\331=\375r\316\204=\302i\262\222\177\2204\003nFH@\0309\264\355\b\262\230\362^h\323\345:=\030\"\227U\261pu|X\232\3029\261A\244\035l\256i\367n\337S\266\343\2262\245\331\002 \003&\003uX\365\225K\373zC\373*\245}uA\273\r\036~\362(\321\"\003+Sf\003F\177\217\027\375AO-\332\003\026\222\203\244j\313\"E\273\rT\273\315S{\024L;\006\202\177`\2675LTX\305=0\r\017\3658\354\303\247|\356\263\035P\216;\260\3526N\275\324\363\270\325m\256\264\333D\351\3376L:G\020\217\324\225\222\245\235\366\t`\3007\262\031S/\321\001D\2727\326\302\\\017\305[\370\252\boa\0348\353\243i\033)\325"
+	.string	"\232-\207c\272\367s(hHg\311\364\216jUe\300X<4|\314\350\341%C\227vU\312\n\307\200\243\222\360PgX\251[{\016\243\2470\325o9\243\246\351\312\024\234~\346\377\254\270\371l\223\242\005\215\231\213h\317N\355YK{\310S\3323R\033\215\321\230I\245\262\222\343\307\234v\\E{\332\003\255\216\217\340#O\364\307\2236/\375x\237\367P\274\335\177\315\323\271z\004k\237\355\375\324\311H*+L<\254<\357au<\203V\261\260\r\375\316\377Y\321\004\375\227\214\262/\254:Nj3\017\3753/u\365\351\023\270\027\235y\273/\223\315\230{o\005\t\261\005\006*\315t\357\0354\3641PIbQ\313|\335\223\301>\267/QB\310\270\377\230\177s&\030c\261\3031\305j\316\024\355\217\246\375\207"
+	.ascii	"\255\r\374\317\372n\377\263&\3609\264\377\224v\267\007Z\177\312"
+	.ascii	"Sy\271\234\351\224\257!X\365\227s\377\350gy.\217\265\267r\357"
+	.ascii	"=@/\n\316\254\tV_\313oy\250\320\333"
+	.string	"\360c\272\222M\254\372?\351\026\366~\241\365\363\362^h\005\361@\353\332\244\310\037Kv{\302\264\006\253o\245\310\377\312\317\312\254zn\236\003\330\342\336\260\332\373\243\316\373\201V\020\322\377Y?\356\237<\264\303C\361o\362N\334\006\371\334O\334\343\006(\022\254\372\222\366\357\260\346\274\274\357\260z\n\272\347\201V\034=A\273\364\201VO\2411\326\364\201\326G{%\0175\340\227\344\343\021\036\035\2740\274;\254\372\t\355\237\346\bh\331\024x\220\3667`\375\2747`u\255\203\036h\315\377\263b\247\231\373\213\275\221/\313K'\254\235\266\367\323\247'\366d+\r\253_\206\237\354\237\376e?\346!(\360\034\3456\262\367\363\313\324\275\221\377\n\354\374+`\023\347\003\211dU\035k\177>\320\252\377gu\1778\367o\342\376]\376\n\003\037\305\375\035\310h\334\237\213\333\270\347;\367G\343\356P\334\337\307\375\347\334\277"
+	.string	"w_\342\356\034\334_\310\335\311\334_\214\373\327\271\177\030\367\007\343\376t\356\376t\367\036w\247\342\3569///\317\335\235\356\353\321}\200\273\311%\bQ\326\244><n\307\267\267V\232\323\b\220\"o?<\270\031\311^9\210\307\355({\266\362\007\230\324\263W\246Ah\007\371\334\314u\307\216!U\302\262X\376\312`yH&\222\213d!\017\315^\271\206\241 \033\264$\323;"
+	.ascii	"T\2779\323~3\246\375F\210\366\033\037\332o\270\264\337\\i\277"
+	.ascii	"\231\322~Cc\007>\212\321RC\215\236!\353xh\356\312ZY\231\213+"
+	.ascii	"\2143w\345\034\231\013\2000_~0s\033]\231$a\\[8xcWx[Yk\207\f\210"
+	.ascii	"\023\027V\335\227\245\335g\245\335'\245\335\347\244=\343p\317"
+	.ascii	"/\344\251|\205\202\r\264\211\312\f\254\346\030\362\r\317W\331"
+	.ascii	"j\347+\021X{#\363\025\317\232\275\221<\377\n\374+\240\026\331"
+	.ascii	"\002\262dU\3357C\347\252\"\3170\310\350r\212\302j\007\337\326"
+	.ascii	"\256\3574\366\360?k3G1\213B\352\262\2704\231\231\207\364\213"
+	.ascii	"\263\206g\346\221N\255\313\025\235\300\377\254.d\032M>!SP0i."
+	.ascii	"4\371\344\214\264\235Yzn\312fp\314\340#\037\277\254j\212\211"
+	.ascii	"Y\226\361uG\306M\207V\346\2442\315\221+H\317\311/{\261\272-h"
+	.ascii	"\260\212\361\362Q;k\034e\344c\336<Q\250\340Ya5o\234\267\026\021"
+	.ascii	"\223d^i7\203o\360\331q\301\322u\303s\311\021\244M\f\253\256k"
+	.ascii	"h\273\240\254D\031\206\3254\017\305jp]\232\032,\006O\241nyQ\246"
+	.ascii	"9\273)\315\233:E\363PP\322%V\361\031_\225\027\246\244D\313<\024"
+	.ascii	"\233\361\272\234\2759x\310\362\212\302\252\233q\037\326\301E"
+	.ascii	"\214\032L\306\361\030\346V\002\003V\355zuM-G\332\264\024\327"
+	.ascii	"e!mh\252i\357\205i\357}\321a\2721\033h]\332\013\376\362P<\207"
+	.ascii	"\2178\016\303E<\350"
+	.string	"9\207\311\260Y\263\367E:\207\221`\271\217V\365le\335\r\322\241\241G{\2027fU\241\340-`\234{o.\330\006\334\345\241X\316\261\034>\303l;G\237\275gX\343\224\303m8nG\371\334Q\253\230Mf:$44\204\343\224\343\352\250\325,X\313C\361\026\034\245\202\261|\264\352\271\243v\324\260\310L\247[p\024<\205Cry\002\216N\252\235\360\200\333\261\252\336\273\201\305\361\025\235&&^]\252`+7SUQ8\246\256\342\017\025D\006\225\031\332\037\352a\260\024\257S{T\241\032\303\252\367\220\332\327;\355+\2328\314\0047\371hZ\211+u\322\2757\034~\362P\034\207\235\304}\264\n\203)b\244;@\274\304\306\350\264JD\251\304\n~\303n[G\247\356*\356+\213\366u\212\366\365\211V\303k\017\305lx\211c#x\314\203\236{\257\261a4\f\345\220\\\242\300\241\346\215\204\240"
+	.string	"\263\341$\257\266s|\356\0328@\234d\246ACC=\256&e<V\325\327\036\332\035CqZ\206a\311\266\346i\003\245\312\006\037X\205b%\370\210?\367\3368s.\354\313<\227\263|\305"
+	.ascii	"\345K\273c\367u#\231{\357(\233\347f&s\374m\376=\270\353|\376"
+	.ascii	"\005\334]\335\331\335\215\222\236;\211FC\031\355\305\004\031"
+	.ascii	"\203'\260\335\243{+\265\216\032h5\225Z6\226gZ\373\250\374q\364"
+	.ascii	"an\255\343\362lo\237\255T\036K`m\237\345\331nn\031Z\232\277\237"
+	.ascii	"Z\307\255\304\332>[\271\221\t,\225Z\315\345\031\262\351\263<"
+	.ascii	"\323j\3563\255\335\263\225Hf\223r3}\366\231\226\335>\303j\366"
+	.ascii	",\317\260\232\3133-\260\357\321\244e*\225\204\006\035Mo\267T"
+	.ascii	"n\250\247\033HfOt\371\304\332^\366\3764\246\315\\`\357\033XL"
+	.ascii	"/H\033\357\226\214B%\327\220X\377|Jnamet\371\205\265\367W\022"
+	.ascii	"i?\2118>\243{\307G\217\\7\266\023\323\336\004<\355}\374\035\335"
+	.ascii	"{\037\367\336=\346\215\347\336V=K\347\323\323\336UAO\373\306"
+	.ascii	"\361\215io\2346\347\326\\\236ma\025\275\241\2359\367\214\347"
+	.ascii	"\361\235\333\213\026S\237\035\315\266\023\031\355lJ\215\221v"
+	.ascii	"\320J'jF\304\030\300\363\244z\342\252c\206\301V6H\246\024A\202"
+	.ascii	"\241S\343\341\344\003\253y\216\007\016l\315\017\254z\216\f\355"
+	.ascii	"\f\222\225\005\323x\265\013\202\220\341\201u\361\300@>\232\026"
+	.ascii	"\006\325\254\201\2103\311fL\001\230\266\224I\245\360\013\330"
+	.ascii	"F"
+	.ascii	"\230R\006\236\261s\354\331\311-W\234\270\311\005\263\032\362"
+	.ascii	"\032\366z2\315\b\302\322\250\371\351\226j`\254yW\003GEE \306"
+	.ascii	"\304\355H\206\007\266\326\366e\0314\311\360\300\260\023~\372"
+	.ascii	"\262\006\304p\r\370"
+	.string	"\013\017i\032\205\035\311\360\246R\362\332W\371.\037\355\032\223\252\3023d3\246\017\nI\233\024\257\311L\030\0201\243 \257\345$\031\355\243UeA\310\360\246\371\t*Key\371\002\206.\257\275\230\237f3\246\b[s\322\345\333Z\236\221\235\266\" \022\344\245\314\321y\301I1;2\274\265L\225\217\210 r\334\177$\257\375>\332\211(\313\"\303\233N\260\206\303\340;#&\246\217\306\2261(\271-[\311W24O\311q\371-\303\345hN\313nyKv\222\265d/\271J\226\313X\262\rYJV\313Kr\227\374%g\311T2\227\254$\263\345(\271I~\222\231<4\257\341<\317H\362\231\023w,\205u<\227\035d\317V&\331\234\270+\257\341\035/\367\321\256\275\233\"\302\314\310\360\246\317\266\366p\037%?\335\364\f$b\376.\257\375\r\030\031\005b\354H\2067\005\363\274\206\3050\230\035\325"
+	.ascii	"\221,dx>\036Vh\232\230\310h\356\217\344\317^\255\b\004\00648"
+	.ascii	"\375\363\004\373\2375\233\t\361p\351@r\301\252\343\234i\033\031"
+	.ascii	"G~:"
+	.string	"M$\241\244c\371\231\311\036\232\313\\Y\226e\310^FL\314\021\222O\322\262l\304\253pH.72\013D\2204E\232\250h]Rd\320\252\3434i\377,=\204>\332\245A\rjt\316\260\354\225\2612\017\016\001o\273\302\307;\264\357\357H\251\204\027\300\026\211\004p\030c\305\217\003\203\305v\330\272\320.b\204\004#\214\226znd\001\b\013@\254ndAQ\221\005#\212\264\217(\312\257\317\221>8Pl\205\302\240\211\233\227\207\3559\322\207\027h,\276n\b\227]j_c\222\317\013 \021\310\262\275b;\\\201\310\262=\267\330\272\306!\313\352\243a\360\005\313\256\3560\250\344\262loH\f\272Aa\313\262\276\227\355\221\340\250-\376\220\\\t\210\3347\310\202\3108t!\301\222q\030\024J b\004;\302h\211\250=2\n\201\303 Q\3215\022U\360.\265C\341oXl\337a\220Ez\225Xv"
+	.string	"\030mQ\211e\327\327\r\nYve\331\265\370C\002\252-\013A\227e\327\027@\242PE\361\006\207A\240\241\211\243_[\\\213o\n\340\320h\342\367\376J\034\375Z\017\204\\\026F[bhB\307\221>\024[\341\321\360w\342\347\035\266\300.\013lU\274"
+	.string	"\376X\b\205?\022>\301w\251U_\227\r*\255h\321\226`Q\244X\201\323\002\207\277\327\035\006\365\313\216\200B\035\006S\f]\340\032Tr\263\313\222\b\201\002\207D\b\024\276\025\030\"\230\215,\204\\6\204\243\236b\373\272\277\244\325u\333\342\321\321\257\327\302\370\t\265\221\205\321\036\271F\026\332e[`\020F[\3025\262\300i\331V)\006\t\256\221\205\257U\212\361\272F\026=\327\310\"\267\302\037\320\265y\331W\273%\264IA\022x\210\305\326\004\335{\331\020\023\030\211A\030m1\005"
+	.string	"+\374T\220(q\323\026\215\357\257\330*%\265/\316\353H\037\214JI,\004-\253\002\004\005 F\030\225\222~\214B\242\333\026o\\6\200v\205Q)\tg}\205F\267U\321\002\320\262l\221\350\016[wg\003_\313\352\260p\342\003\234\030G\277V\305\357\375\035\371\212n\013\026\311E\020\211\325i\241$\314i\241$dY@z\021b\002\026\t"
+	.string	"W\211X,Ql\217\2020\202%\214JI</\353\342G\0021\330s\361#!\370.u\360\016Q\030\225\222t\200\355K,\246X\201(lQla\214\340\n\265\354N[\374\255pT\374\235\310\331y\035\351\203\213\364\376\222\210\206\304\244$\"\220"
+	.string	"'*\265E\242\227H,\022\341$\275\313\016\211\301\367\367\022\213\254R\213\237\245`\361\375\205\360\016\333\244\241\213\240\360\307\323\303\302\211\366\375\251"
+	.ascii	"\002\177<=wD\221~\001$\nI\034\375^\2675\252\320\252\3209j\205"
+	.ascii	","
+	.string	"~\303\016p^\326\350\035\006\215=/*\"\221@\t\"x\240\201\037\200\303\030.KD,\306p\001\004\376\210\334b\013#X<\"\032\006\177ID\300\242K\364\341\201wh$\222h\205JI\277\025\304\026\301\026<B\"\221\003\326\306\323\244\311w+[\326\273\251q\263R\343\371\356\243\354\f\221\001mK\265g\273<\3063\231\214F\357\275\177G\0269\347tWUy\330\241\243\361Vv\3063\032\004\326\250\256d3RO\253\027\314\224\311i\317\267\202P\250R\3114\211\342\030C\n\021\211\314h\222\244\003B\n\020\210#z\224\330\362\006\022 \025E\t;\306\020\315H\222\224\244\260\307\236\001\321U\301V\316\030\034\206\265\234\337\225\\?\001\363\244P\016buoh\257\324\013\314\322\\\022\377\256\236\345\324;\254\371V\231\323\323p\264N\nP\262$\263\304i\237\306-\360\316!\224\216\320$hW\220\277\345\250+l"
+	.ascii	"\352.\202W3xZ&\225a\234P\004`\t\351\341\302\307\210\312\354\013"
+	.ascii	"\t\031\274\332j5\275C\003Y\241\001M\003\345p+\2621\274\361\001"
+	.ascii	"76T\241\207\027M\"\340hj\374\365\3102\241j\370\277\rfo\204\335"
+	.ascii	"tDI\031|/&0T\231\265E*\275}\030,0\r\231\3667-s.\001\255c\243"
+	.ascii	"\347F\256\311\0068r\003\306#`\373\217\206r\212\027\007\333\204"
+	.ascii	"5\037}t\001\216\222\323\2047U9\024\303\232\023#\370\347\305\013"
+	.ascii	"\215\3764\321L\304\237\363\274\005\3201\300\364\256\005\003:"
+	.ascii	"\034\310B\035\236\0379\265,\006\225\273\334'bAQ\227#5\221J0\304"
+	.ascii	"\006\340\tJ\230\262N\334\306\324\022\363P\332\264B\252L\\\216"
+	.ascii	"P\223bx\371\032u\235\220\317\342\232\204oQ\302\237\265\026\300"
+	.ascii	"\361\234\271%UEh\353\r\\\302c\227\223e\324\326\224\252\225\344"
+	.ascii	" oO\205}\202\217\026\217\334\250\200\001\031,\320\343\275\b#"
+	.ascii	"\337\005\020\332\003\274S\027\"\364\013m\200\376\313\205\353"
+	.ascii	"\007\313\b\277h\023\210\b\350~\006\260<\325.\313|z\346\217\210"
+	.ascii	"\004i\356\006}~\373\036\240\235I\366\r_\033\207H\347\366j\316"
+	.ascii	"\213S\321\236\370\332\241\213\364-DbW\377\004\026\370\257\n7"
+	.ascii	"L\376\271\240\022^];\262\223\204\005E\315\207aC'_s&<\357\364"
+	.ascii	"\244\351 %\275e\322\231\213]\026\"\341\204\326\204\2535\270@"
+	.ascii	"PC\b\304\272\033p!\303S9\364\267\375\205@'\355O\336\303P\252"
+	.ascii	"\364\336Y\261\214\373\321\252\247\310\207x\224B\210O89\312\026"
+	.ascii	"\324\023&B\332\241\361\324\004D!;\270\307\225=\342\347\r\273"
+	.ascii	"\242\357d\316\325b\013\310\360\355\302}A\355O\342\263\202,\274"
+	.ascii	"/\364\364\327\005\3079\177\266\220\017\333\n\347\216\346\017"
+	.ascii	"\203\213\203\317\263\367fg\342\253\324E\260\277h;\332\216B}3"
+	.ascii	"v\257e\253)\006V\2648K\277~\030)\227\327\317\267\245\365\306"
+	.ascii	"Q\214S\3614\327\024\320\232S\305\tQ\260\224iK\300\027\300\202"
+	.ascii	"\004B\264\2616V\363\332]\306\201\265\244\302\344\345P\2149\327"
+	.ascii	"te4\371\033\330\003a\333&B\275\201\370+V\272\212\361x\"T\215"
+	.ascii	"k\220\357\001\347=\223\362\024\325\337e\"\t\023\233\003\2327"
+	.ascii	"\033\340\370[(\204\b\3430o"
+	.ascii	"\261i\371\342\\3\264\240BC\003\225\306\353J\370\324f~\031\322"
+	.ascii	"\221r>\267\2138)zp\217#\316n\353Gzh\017\201\363\036\271\325\331"
+	.ascii	"e\276-\360\326sPQ\256\032\277\035\276\206:\367>F\352\330p*\212"
+	.ascii	";\004\003\365\275\342OVo1\234\200O\030\215I,\265\205=\020^0\350"
+	.ascii	"\220\375\201\344;\302\237zkeT\376B\300\354t\001Z\357Amr\305\251"
+	.ascii	"\364\352\250`\203\344\346:\004\013\226g]\004K\376\241\256^v\206"
+	.ascii	"\30650e<Y\332\246\366@G\3163\025{\334\252\316;\373(\375/\316"
+	.ascii	"\217Y\321\321\217\210Jp\004R\346&\212\361\025\302\004\211\345"
+	.ascii	"\345\327\223+\206iLx\306\232\325~\031:dQ*\274rE\003\217\245\206"
+	.ascii	"c_0%+L\236R\306\270e\326\325\3531\336>B\254\0134\375\035\035"
+	.ascii	"\251.0\320\312\242\274&\023\305\277\227~,\004@\t\0069X\206\367"
+	.ascii	"\200\247\365\367\332\232\341\317\303\247\306)\006\2714DFx\245"
+	.ascii	"f\265\252Y\252\360y\267^\331\274\200\033\032\270Y\335\025e\254"
+	.ascii	"\245\037\365\211\372\334b\032m\350]\340\311\313HQ\300\024\370"
+	.ascii	"\342\337\021\302\230A50o\b\232\212}\3605\221\305\204\221$#\316"
+	.ascii	">\346#\214(\n\351M3\342\222<\326\3349\224{\025\312\245\367)\351"
+	.ascii	"\2018\237\321\035\004OQ\252{\023\265K\251\240\n\247\263\235\235"
+	.ascii	"e\326\343\224\304\025\240\275b@I\220K\376\203h\253\366!\006\227"
+	.ascii	"\b\326\260\227\216\b\266\305f\276\341`E8#\026\377\305\354\301"
+	.ascii	"\2139\234\340\254M<h\333>.JA\376\361Lg\t(\2306\217\352\222YI"
+	.ascii	"\300\343@b\203\004?~\265\020\304_\013+:k;\221\243\273\274\235"
+	.ascii	")\242\373\215\016\022\327\346\247\037\367\244\303I\2672\217\362"
+	.ascii	"m\234\326\237\275\206\263\025"
+	.text
+	.section	.gnu.lto_.symtab.d485f7ca70ba2dc1,"e",@progbits
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d485f7ca70ba2dc1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
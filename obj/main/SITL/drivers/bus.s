@@ -0,0 +1,498 @@
+	.file	"bus.c"
+	.section	.gnu.lto_.profile.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375 [\335\001"
+	.string	"t\002O"
+	.string	"\013"
+	.string	"\265\230\240\355\006"
+	.string	"\001\002\003\004\374\337\303\241\005"
+	.string	"\005\006\007\b\267\335\335\337\n"
+	.string	"\t\n\354\301\314\336\005"
+	.string	""
+	.string	"\b"
+	.string	"`0\030\f\f\001\006\203\301\300\020*\343l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375 \2635\002"
+	.string	"\204\002\247"
+	.string	"\013"
+	.string	"\003"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\001\002\003\004\004\003\005\006\007\b\002\020"
+	.string	"\007\003\t\002\003\n\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\f"
+	.ascii	"AQ\001\027\002\217\001O\330\364\270\222\003(\020\310\f\310B\246"
+	.ascii	"\340\035\3630\300\002"
+	.text
+	.section	.gnu.lto_.inline.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"U\002"
+	.string	"\224\002\216\001"
+	.string	"\013"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t\n"
+	.string	"\r"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344\001$s\0249\233Kp\023\217\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375 \263=\002"
+	.string	"\304\002\247"
+	.string	"\013"
+	.string	"\003\001\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\002\001"
+	.string	"\002\001\001\002\003\004\004\001\002"
+	.string	"\002\001\005\006\007\b\002\003\t\001\n\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\n"
+	.ascii	"\256\202\233@ \360\030\360\204MO\317\344\006\310\007dV\246\004"
+	.ascii	"0h\003"
+	.text
+	.section	.gnu.lto_.pureconst.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004\n\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375 \235\245\001"
+	.string	"\270\221"
+	.string	"\013"
+	.string	"\003\002\002\002"
+	.string	"\001\002\003\004\004\002\005\006\007\b\t\n\001"
+	.string	"\f"
+	.ascii	".\005_\f\313\312\020p\0348\0308\"\2461\200;\3001\230\\\200l6"
+	.ascii	"\200\005"
+	.text
+	.section	.gnu.lto_.lto.8cd72532ff238f2a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_busRawWriteRegister.7.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"-\b"
+	.string	"\302O87P\215\322\001`D\264\204\330X\243)\365mC`&\232\nQ\271{\2779M#\320/\263m\231pg\234\264vDUE\200\315|\275\235\374\3348R\266E\262\311\336)\005W\347\302\252\207\214\306O\206m\036\215\345Mf\363h\346F\263\017\207b3\202sA\314\r\335f\246\300\232DFgG\323\350\264\324\320;\313 \024=\273z0f\330\257vw\035M\366\277\277z\375\341O\377\245\303\b\344\222\332\255H\241\326D\216l\330\346l\213}\002=`\275\223\013\205\n\276\202\034w1P\023B\373\034\357\340\376M\\`\327T\"\262[\021|P\271t\375\200uY\371\305\272\264\355\204\005\316\035\201(\242|\243\217\224\335:\243\306\273\303\316\277\3071\242\020R\211\342\020\240aw\rI%\213;\3366\3066\203m\222\r"
+	.ascii	"2\003\202\341\243a\215\020\220\270\006\242L(\2400\030\346\023"
+	.ascii	"\355\300W\202\221\003\2500\235k\222\001"
+	.text
+	.section	.gnu.lto_busWriteRegister.8.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"%\b"
+	.string	"RO88Po\322\001\240\363%\0068"
+	.string	"\345\250\263\353\273\213\020\r\314z-\003\242\362\232\266(\337m\267\266\f\266|H\324\256\314L9\216\315_'P\006\"O\n\266\232\020\"wJ\001\232H\333.\bN*\211\333\274\321'3\310\343\215>\321\223\034)$\267(\021\322\"\"Hz\321S\340n\202\223Q\324u2r\346\376\313\f*\024e\317\023T\017\373\327\356\256ue\237\365CU\214TI'fW\243\206fY\260\024\020\333&\233c\217\224\036\260\250\226\f\206\013~\226\254\273\0343\021B\373!\0271\235Eq\201\335\225\n\312\356Tp\302\346\230\347;\331\261\315\007\262c\266\275\320`\362G`\241/+\251\226\314\356\214\372\361\357\360\363O\362\003\230V\207\213\211\352t\b\360\260\273\206\027\252\215[o\033\301\266\203\355\223\r"
+	.ascii	"2\003\202\341\243\302v\025P\\ST&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\334\001T\234\3275\311"
+	.text
+	.section	.gnu.lto_busRawWriteRegisterStart.9.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"5\b"
+	.string	"\242O87@\217\322\001X\360\344\tp\235\022\274\331\354\302v\030PA\357nc14\334\"\004y\376\326\326\341\367\361HKUE\361\004\376\004X\306\032\240\344\332g-\222\275\367N)\227\347\302\342CF!(\303\266\317\3062'\263}6s\243\031\250C\261\031\321\271 &\207n3c`M\"\243\323\243itbj\350\235u\020\202\"\273\212\036\354\260\037ww\rM\366O\177|\375\337Q\377\245&D\305R\260\332%\255Z6E\236\200\330\346l\214\215\332`\210\357u\342\001+R\271\230\357\331\027\371\b\367\023\305\005vM+\251\335\252\340\204\313\245\353\t\254\313\313\007\254K\333^\320p\356^?H\347\300\260(Q\355\326\t=\336\375u\376I\036S\032&\243R\305\037\200\303\356\372\215J\0317\274m\004\333\r\266Q\002\016"
+	.string	"2\003\202\341\243a\217\020\320\270\006\256L(P\016\f\006F\370\004>\360=0\227"
+	.ascii	"\025\307tM2"
+	.text
+	.section	.gnu.lto_busWriteRegisterStart.10.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"-\b"
+	.string	"r\21788Po\322\001#vm\036t\\\217O\235\2707\200\211\276\341?\0020l#lX\004\321m\267\266\f\266|H\324\256\314L\361\346\"~\235@i\b\017jM4\331d\357\224\002\231'\323,\211\215F\320\246u\237\315e\216\246\373lfG7P\207j\223\242\223ML\016\355\246\246\300\\\305F\247\207\343\350\314\324\375w\035\\\304\221]E0v\330\267vw\035O\366Q?\214\020u\2452p\331%\305\274\254\212D\t\261\355\331\031\233$\364\200\035\255l4X\3605\344\270\313\0013!\264/\362\021\357(\213\013\354\236RR\273u\301\n\330\245\353\t\256K\354\003\327\245m38x\376^?H7\201`\230\254v\353\214\036\377\016?\377%GP\265\230XNJ\242C\200\210\3355\314(i\334\361\266\023l?\330N\005\r"
+	.ascii	"2\003\202\341\243\302v\025P\\SX&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\\\002T\234\3275\311"
+	.text
+	.section	.gnu.lto_busRawReadRegisterBuffer.11.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"=\t"
+	.string	"\006\021?8@\255\322\0010\360Hx\377\\2\376\273\332\374\275\n\303\216)\277\006\303\002\r\354@\370\257\255Q\375\177h\240!\314Qt\211s:\377\214\204\277\016h\226@\250\356M\366N)-"
+	.string	"0"
+	.string	"*"
+	.string	"\366BC\311\337+H\352\035'\032\261\331n\245\361\343\337\341\347?\366M\266*A\2510\016\001\"v\327\020\245\342\270\343m#\330~\260M\013\260\226\203|\215\b0\233A\262b\330\340\253\3051{J\331\240\020\332\037y\253t\327\305\003vY*\262\335\252\340\004\313\245\353\007\346\245\345\002\363\322\016\361d\327\023\214\036\366\267\335]G\226\375\327/\357\372\267\327\037\036\366\177B\210\314V\fj\273\251\032mQ\244I\210\355\222}\261\003\022\"\017\210\233\230\032\221\246\263y\270.\222\270\2167\332Ls2\336hC\275\216#}\272\016\005}4\024\224\323y4S\340P\005\327QQ(\324\321K5\375\233\007\246\021"
+	.string	"2\003\202\341\243a\231\020\020\272\006\"M(P\016\f\006F@\270[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\306tM2"
+	.text
+	.section	.gnu.lto_busReadRegisterBuffer.12.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"-\t"
+	.string	"\206\020?90\221\322\001+\370\345L\303\013\035o\351\242\336\033\237c\300\361\231\2446\216\233\326\217\355\321\265\3370\345\256\177\254m\031\f\0064p;\275O\256ir}\323\3212B\310\336)\005-"
+	.string	"."
+	.string	"."
+	.string	"\016+\207\257\"\256\177\324h\310j\273u\312\220\207\217\241\177\331\021dXh/*/\326#@\304\356:n\2748ny\333\t\266!l\303\004(\002\317f\240t4l\361Ue\271\353a3c\264_r\223\325c\027\017\330\205\265\314v\353\202\0258\347\\?\320\235\343\\\240;g\333\f\001\007\030\262eWV\224 \366\267\335]K\230\375\330\037\245\304\254\026c0\263\353\272\241Y\027ne\304\366\312\356\330)\252{\266E#y\340N\002\023\247Q\351\243\350\274\223'\332F\037\225\251O\004\242@\235C\037\020\005\232 \375R$*\232%\222W1C\024\234\237\002\233,>:O&\023\235\235\272\017\273\020"
+	.ascii	"2\003\202\341\243\302v\025P\\S\222&@P\"\030\001\341nU\030\f\363"
+	.ascii	"\211v\340+\301H\002T\230\3275\311"
+	.text
+	.section	.gnu.lto_busRawReadRegisterBufferStart.13.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"M\t"
+	.string	"\006\221?:0\305*\035@\b\340g\210&\312\310\201-\332\3612\224\"\3233\fh\331\373^\321\300x\370\355\003\302W\377\345Q\0131\"\202\304\3204\336\220J\026-o\020\250\255{\223\275S\n-"
+	.string	"0"
+	.string	"*"
+	.string	"6\203\303\310\337\353\307\351*\326\006L\266[i\364\370w\370\371\207]\213\255LL\250\214\303\200\210\33554\241:\356x\333\b\266!l\317\002/\222\007\351\n\025\\VCd\325\240\301\327\213_\266\204\302A!\264\017\362\220\321[\030\027\330M\245\304v\353\202\023*\227\256'\230\227\225\017\314K;\261d\327\022\214*\373\332\356\256c\312\276\353\227o\375\332\353\017\377\372?%\252\f\200\302\310\356)\300lOd\t\313\366\310\266\330\001\023 \216\207\243\230\033h\333h\034\256\213\"n\343\2052\323\032\214\027\312P\257\343D\235nC=\235\255\202j:\217b\f\374\261\340:\n\372|:j\251\244\177\363\200\024\021"
+	.string	"2\003\202\341\243a\231\020\020\272\006\"M(P\016\f\006F@\270[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\306tM2"
+	.text
+	.section	.gnu.lto_busReadRegisterBufferStart.14.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\025\t"
+	.string	"&\320=9@\217\322\001X\360\223\355\226\036G,\270\217\265\004\217\216P\030~\"V\273\373\306\032\362\275o\033\013t\240\372\205\264TU\024?\354\203\222\225n\216\373{\352R-\022B\366N),"
+	.string	"-"
+	.string	"-"
+	.string	"(\207\257\037\253\273T2`\262\335:\245\307\303\307\320?\354\0072\263\230K\n+\365\b\360\260\273\216\032\254\216[\3366\202m\007\3330\001\234\3050\001Y\320\342k\3059\253\212m\314\030\355\213|\004\365\227\305\003v[/+\273\265\343\004\3157\327\017p\3374\027\340\276\331\266\002C\0179\203\013\251\262k*J\227}mw\327\262e\377\365GI\301!\213\351\240\354\256f3\333\262\261\204\330F\331\033\373\204\244a+1\021\004\020\245\320\350\213\340\272R\347i\241\217\312\323\347\201\246\017g\220\0074}&H\277\223\210zs$\352$&\210\202\323S`\322\304Gg\211D\242sS7\021"
+	.string	"2\003\202\341\243\302v\025P\\S\222&@P\004\214\003\303@\020[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_busBusy.15.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\225\007"
+	.string	"\262N55`o\032\003TN\020'\210\007@\203\345\322~\200\301]\244\025h\2149\030j\333\"\302\310/\366\266\003,u \b\210Z\027\245\267\242\211\002\004\277\215I$eJ\001\022\223\362\202\242\353\223\205:V=\234,\324\211\231\274D \371\211\022 \210\210\350\221Y\344\024\024\233\270d\244\3000\0317\363\336,\003\214\227\321\316\221{\247\326"
+	.string	"\377\337gj\255\262\335\253\370\n\306\301\345'\315\310\234\005\246\204\264\325\332M\3337-\336\206;\275\244V\242s\255S\036\321\254\272\260\300o2A\371\247B\0234\206\235&\260\f5\036\260\f\333v\241A\353\346\tB2\252C\243d\365\317\370P\336\354\266\332$>\210Q\371h9)\215\354\002\036\376\327q\224<\334\347\266\bm\031\332\212\004\n"
+	.ascii	"2\003\202\341\243\302v\025P\\S&&DP\022\234$@\231y\265\223\f"
+	.text
+	.section	.gnu.lto_busReadRegister.16.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"e\007"
+	.string	"\022\01634`o\032\003\340\232\213\n]\020\333\034\\\375l\2648\325'\360\222\203\315F\223\026\304\221_\354m\375\260\324\201  5\002\255\267\242\211\002\004\277\r\355!eJ\001\020Vt \253\203}6\257\034\r\366\331@,Z O\354@\t\317C\004\344D\fj\nzMX\021R\\W\204\231y\313gp\3410\332\031j\256\2435\300\377\327\221\332VaB\2714\234~\321K\352+U\312G\333\254\315\264u\315S\326\375\034)\330Z\353\021\223d.\261\260\300OR1\375S\241\t\030W\235&x\2560\036x\256\312\220Uzz\210^I$\343\004\365O\350J\226n\262\266\211\017BN,-(\243\220[\200\303\3776\215\321\206\353\334\026\241\355B[\220\013"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\"\026\347\b\367\300\\\001"
+	.ascii	"\215\262\021\002\277\256I\006"
+	.text
+	.section	.gnu.lto_busDeviceRegister.17.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375 \365\215\006"
+	.string	"\322\f.1pm\032\003\240}C\361\200~\270\207\345\265\036H\306\343\267\310-\265\330$,\220O#\313P\330\256UU\201\277A\027l\240\345\303=\357\270\262I\231R\232\352\0223\225\250\026*f*/\302J\203\201\227\347\200ahx\026\030\037UP\353\241\202\017\302\262\340\233\346\335\256\032H\264\211vnX\303hM\371\377\266\253\265\307fM\202B%\n\237\277\342\304\344#.dcjk\326\232\303\035\322\236\b\013\374\227\b\350\237\tE\220\354:M\020\331I\036\210\354*[\022O\215\373\003B\361\021\372\377Z\206\245\231\254\355\341"
+	.string	"Ngc\006\260\360\277\214\323\261p\233\333\036\264\245\332^\004\b"
+	.string	"2\003&j\006.\034\203y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\245\002"
+	.string	"\224\003\n\001"
+	.string	""
+	.string	""
+	.string	"\002\007\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\005\t\177\006\n\177\007\013\177\b\f\177\t\r\177\n\016\177\013\017\177\f\020\177\r\021\177\016"
+	.string	"\013"
+	.ascii	"\200\036\340\033\340\033\340\033\340\033\340\033\340\033\340"
+	.ascii	"\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8cd72532ff238f2a,"e",@progbits
+	.string	"(\265/\375`l\fE>"
+	.string	"\272k"
+	.ascii	"\030FPdR\007V!\036\305I\263 e\213\204\227\013\2003\313\206\301"
+	.ascii	"\206\310\027n\300"
+	.string	"\271\366\200\f\2727I\233n\267d\333\372\263\300\035\027v?\202\242\257h\272\001A+\236\362\353\033\200'\f)D\210Q\233\273\333\312\224\002K\001i\001o\001\254\177\227{\003\350fZ\177$\256\277\324E\363i\236\372h\177\306\377\312cq\341\274w\230\275\267Op'\242}\231?+Z\312JF\356\324\355=\373\207\271\023\335\221*<\332\217\371\262\242\345\336F\272\020\264\205\331\221\207\267\367,\034\016\201ZeY\230\264\254\307p\335\377\314\375\255|\330\233\361\311U\321]\335{&\362\r\221\305\344\231\177g\240o]\232\245\276\331{\231\267\360Gnj\323i\326\235\334\037{2O=\360d\216T\301}\361\226\035\266\367,\024\274R\271\342\321\254\267p\375\017\264\277\367\007ZO\341z\b\3279\270/Lz1!1)\0260\315\372\003\367\267<\227\247~\027\367\317\362\263\263[\242{\272\367\034\364)\203\254\215i\326\177\352"
+	.ascii	"\332v\005\367q\375\215Z\2417j]\273\n^@\313~\200\366\367\013h"
+	.ascii	"\207\346\027\320\272\037\240u\355\256Y\230h\300\272\353\017\b"
+	.ascii	"4\024](PA\330\272k\"Q\003\241\004A\003\356\236\302\367\334\375"
+	.ascii	"\347\256\007\270\377\003\3677r\377\006\356\217\300\375\213\334"
+	.ascii	"\277\200\373\013\335\237\310\375\205\334?\350\376?\356\377\356"
+	.ascii	"\236\307\335\311\334\035\217\273\013\271{\232\273\003\355\355"
+	.ascii	"\355\355\271\377\rw=t\357\251\022\273J\307\336\005\366\274ws"
+	.ascii	"\357\370\267u\357\035\357\275\201\316\253yo\"C\362W\263\2717"
+	.ascii	"T\330\334W1\231\216\275uU\216\314S\236fE\211d]\246_{\307\034"
+	.ascii	"\377\327\216\223:\335i\254eW\315q\277\236VvZ\2517\320\312YVU"
+	.ascii	"\263z\353\337\323\261\353\375W \246\336\354\336\312\377\005A"
+	.ascii	"\377\013~f\272\224\\Z\326\365\326+s[\253Z~\036<\272\210r\314"
+	.ascii	"K\263wf\246\006\303r\343\205\216\235\307{\352\347\275\027\377"
+	.ascii	"/\017\206\271\367\316{-_}n\030\313\3730\177\367V\350\320f\322"
+	.ascii	"\351\325\r\207\337\345\354j\327\262m\336\356\315\027\235\237"
+	.ascii	"\363u\236\372w\376w/\346\321\202b\242\275\221\344\371\272\373"
+	.ascii	"\264\177\013b\316\333G\022\336\036\022\030\016\177\252\266\260"
+	.ascii	"b\227\255{9O}\273\217#\367to\205\316\333\007\022m\352\013\317"
+	.ascii	"\356\341\336M\321R\006a6W\347\226ab\266$\216\316\037NPj\f\n\334"
+	.ascii	"\334\277\361\001\002\265\232\251\271s\376<\234\344H+\343\372"
+	.ascii	"S\035\316\3079\035\313\245\026\344\312\030\327_\314\365\347\342"
+	.ascii	"\376\333\253\375\232\267V=\260\321\325\355\275\335\236\315S\377"
+	.ascii	"\355\333\234\235\367\256\376\374\366Vh\006\2648C\3410\310\013"
+	.ascii	"\212\225+-\353?\305e\2470\305\3264\373k\317\366\324\267\276\232"
+	.ascii	"\035\f\322a\231\211\242\003\032\352\306fu\005\373]\335<\271\023"
+	.ascii	"\342\032\352\343u\275\022DK5\251\332h\321\254\006\362eAoO\254"
+	.ascii	";\232\325?^\357\007\304l\307\334\220\347\323\331\345~\261B\251"
+	.ascii	"4\353\276e\217\036n<X,gpR\344\232MM\345\306{\3073\2025\253+\330"
+	.ascii	"O\\\330Y]\032\327\365R3]\347p\235CS=t\373\344\260X]\3616\364"
+	.ascii	"\312\b\230\206\206\215\310\224k*\275\201\366\016\333{\027\001"
+	.ascii	"\2111S\223jV\357\320R\356S\352\245\207\224\226\201\332\340\250"
+	.ascii	"\371r\007\3122\215\226f\265\016\237\2718ie\232\365\273/s\367"
+	.ascii	"\236_V\2357\232\313u\355\336n\245s\357\355\3437o\347\022\250"
+	.ascii	"u\177\377\337\277\221{\360}\317`\373\334\201\222\275\267\342"
+	.ascii	"\350\270P\306\224E\264\202\355`{\307D{\336Ny*\215ej\333\223h"
+	.ascii	"\336G\006\354\251\326\226g\351\223\215n\275\347\375\233)}\322"
+	.ascii	"\220\347\250S\236\243\361\320fF\343\275\347\347\220\\U\306/O"
+	.ascii	"\245Oy\032}\022m\346\216\367Ty\304eF\237\262Z\3649$O\225O\231"
+	.ascii	")}\022i\305-\341\232B\262\245\372kd\346\346\321\274R:\207\254"
+	.ascii	"\362\034\335q{\177U\307v2\330\373*\352\214S\ny2K+\217e\030e\364"
+	.ascii	"\t4\227Y\321\315\264\312Q\242{GY\302\330M\n\361l\335K\336\032"
+	.ascii	"k]\005\307\027\t\033_\274'\210\204p\300I\016\005\016\034_\027"
+	.ascii	".\222\034\234\226\336\023\002\220\307%$\n!\234d\032\362&\343"
+	.ascii	"\213\367\304\2134\036W\330X:\001'\231\002x\223\361\370>\275/"
+	.ascii	"\\\247\220\004!\311\302\r\240[\300 \001\203\204\326-` \0221$"
+	.ascii	"\021]O\"\372d@Aq(\376\220p\321\030\205\302\305\353\241\250T\002"
+	.ascii	"\305\317\333\364\264\204\204\237\214.\262HB\211}2\226x\202\233"
+	.ascii	"Zc\024\354\203\213\035\220\224~: )\365\264MHF\237\303 \340PQ"
+	.ascii	"\357\361\b\t\005u<\372\201\213\"\234\206\216/\022^\232\321\""
+	.ascii	"\213\026\220O\306$\020\206\337\243\223\323\022\360\255\261$\003"
+	.ascii	"E2j\206\233,\326x\235\340$\223\013\027\337&c\215\327\003\234"
+	.ascii	"d\372y\213o\024\216\024p\222\251\307\211\304\016\nT\214\370\340"
+	.ascii	"6E\200\223LG\360\361\255a<:\035=\031\227f\0345\035\341\243\b"
+	.ascii	"\3027\n\007\022N2\001\235\t\023\335\344\305\306|\364\226\204"
+	.ascii	"\375\340r\335\304\351\204\202\300\031\203GK\261cy\314/C\266\266"
+	.ascii	"\264\022w\357\036m\222*VW<\240\025\224\255+\211k%_\006\234\361"
+	.ascii	"\340\332hV#\321R=n\262\225\214\225\212Fu\026\\U\216=\270,\251"
+	.ascii	"\353\254\0364q\336\226f\365\021-\345\316\3555\321\323\312\256"
+	.ascii	"y\252\216f\235\215\215\030a3\326\203\305\246-J\233\253+\re\343"
+	.ascii	"eu\005\363:C\323\244J\204\210\206\352\005\223p-\235O\254\254"
+	.ascii	"\002\200\350\250\2018\207\224D\"2#a$IA\322\001\260\002\221)\""
+	.ascii	"\333\021P\251\202\214\320\210h\222\244\322\001(|\323\312\tX\344"
+	.ascii	"\234s\271b\2509\022\004\316\031\362:p\r\t]\362`\rP\005\246\352"
+	.ascii	"\316\247.\004\370:\243`l)\230\2146\b\355[\367\203>?2\2607i\033"
+	.ascii	"[\275\331lJ\277\030\260\337\361\352\020\213\2419\027 s\317i\274"
+	.ascii	"\257\354\b\331\323\227\310h\302S\344T\375\276\302d<\bju7v\350"
+	.ascii	"?\220\306\313rm\333\217\306\033>\361\267\320tZ\300\343h\215\370"
+	.ascii	"5\346\346\205@\0010B<:1\364\364\035al\310a\275\013\267\261\241"
+	.ascii	"{\310\bc\332\360\236\b\374l\267\313\325\237\3111^\367\265\376"
+	.ascii	"\326/\020\321X\336S\026\370`\300\345\254J\nUF\315\331\200\223"
+	.ascii	"K\017\261\266\2227{\301n\236\260$\325W\270p\254>\201\276*1h\023"
+	.ascii	"\351\265\023r\032\311\032|7+\227Y\266\001\363\247\300\351\313"
+	.ascii	"\221\372\266i/\001\201|\265f\t\"q\210G\241\006c\260\353\300)"
+	.ascii	"\322\201Y$:\nD\274\027b;\201(4.[t6\263\301`\264\370E\347\341"
+	.ascii	"\212\020D\271\312j\024\f\304Q\361+#\232\325/\365HUG\023\243\201"
+	.ascii	"\217s\034b\2507\365\307S\020\232R&\224\032ki\320N\226o\253'\r"
+	.ascii	"\332\037M\352\335\3577\256\024\366<P\365\035\300G-\254&\255\233"
+	.ascii	"|\364\251\225\020\026\267@\310\366\2053\034\356\2112\254\373"
+	.ascii	"Z6x\\\n\372\005\016C>\177\023\333\037C^`\007\274\205\313\217"
+	.ascii	"\346\022\215;w\203A\333<\365\356iv\235\030\337\3032k\204\355"
+	.ascii	"\335\276\177\213\035O\233\207\264\212\033"
+	.ascii	"<U"
+	.text
+	.section	.gnu.lto_.symtab.8cd72532ff238f2a,"e",@progbits
+	.string	"busRawWriteRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"busWriteRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"busRawWriteRegisterStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"busWriteRegisterStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"busRawReadRegisterBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"busReadRegisterBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"busRawReadRegisterBufferStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"busReadRegisterBufferStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"busBusy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"busReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"busDeviceRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8cd72532ff238f2a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,286 @@
+	.file	"compass_fake.c"
+	.section	.gnu.lto_.profile.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375 h\035\002"
+	.string	"\024\003\\"
+	.string	"\005"
+	.string	"\347\253\347\265\001\006\002"
+	.string	"\002\001\001\240\342\234\212\n\002\277\233\265\223\002\f\003\245\240\323\225\006\004\257\305\206\210\002\004\002\003\002\004\002\005\002\004"
+	.string	"\006"
+	.string	"[\035\265\322\2003"
+	.ascii	"g\373\273\227`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375 6=\001"
+	.string	"\330*"
+	.string	"\004"
+	.string	"\001"
+	.string	"\b"
+	.string	"\007\003\002\002\003\003\003"
+	.string	""
+	.string	""
+	.string	"\001\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.ascii	"A\325\350\f\240\022\320\006\260"
+	.text
+	.section	.gnu.lto_.inline.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375 \236\315\002"
+	.string	"\264\003\222"
+	.string	"\004"
+	.string	""
+	.string	"\006\200\200\200\300\002e\001"
+	.string	""
+	.string	"\002\200\003d\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\t\200\200\200\200\002f\001"
+	.string	""
+	.string	"\002\240\002e"
+	.string	"\300\003\003\004"
+	.string	"\005\002\002c"
+	.string	""
+	.string	"\b"
+	.string	"\f"
+	.string	"\240"
+	.ascii	"\b\005\301\340,\264c\t\344\036\365\360M!]B\2739\203KP\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004\002\002\001\001\f"
+	.string	"\002\004\177\002\002\003\003\001\001\001?\177\002\006\004\001\001\003\177\002\004"
+	.string	"\002"
+	.string	"\350\206\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\232\004\003\230\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375 \215m\002"
+	.string	"BD\f\025\300%\035\377\357\276\252\334\343\377\377\177}\001\323Z#\213\020\231R\372\371X\302,Kw\203M`\353\304!\021\r\372e\233b\233z\331\232\355\226H\004\n"
+	.ascii	"-\".\001\276\034\353\252\305^\241V\271e7\f6o\201\2407\200\005"
+	.text
+	.section	.gnu.lto_.lto.f74f82cfc388838a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeMagInit.6.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\365\t"
+	.string	"\366\322D: \261\322\001\244\n\022\005\303\203\0042|\\\332~\246\224\300G\224F@\320\033\250\004\332\206\031\352\007\303"
+	.string	"#\233\365\037"
+	.string	"\001\004\t\325\203M\261\264\222\001\340\037\b\355\331\376{\247\0242"
+	.string	"1"
+	.string	"5"
+	.string	"\236\017\324S\333NPPY\374({\215\\Z)\270\335\261\233\037\027/E\377%\227\0343\232\032\033lu\t\320\260\273\226.\330\306=o\333\3006\203}\204\323\303~gw\3273fS\211V\355S\333}\345rV\206\302\314l\253\354"
+	.string	"\333R\332\247}Du\222\214\013\354\306l/\273c\310\013\236S\217\377\324\323-,\362\216\251\247\240\231H\3505\025P\b\256`\037V\333\240\243\204\004\262\335\035\371&?\261\360AN\215\221\222w\235\372\251z*gn\035\264\033\226\314\331\343J\006\021\336i\232$*Mx\020\016\241\207:}\244.\004K\027&\360\241\2430y\247\216\004\206\235\350\300\037\252\004v\025\337\007v\036\367\235\2351_\254\325\006\207scM\r\177\345\266\007\017"
+	.string	"]\325[[\224\227\025\203M\324\336\013\016\030\302\252D2`"
+	.string	"\306"
+	.ascii	"\343B%\007b%\340\\\363O\035\302\274\256I\006"
+	.text
+	.section	.gnu.lto_fakeMagSet.7.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"M\n"
+	.string	"v\022C:0\221\322\001\200\214Q\204\341N\324\203K\253\336pq\267\027\315\255\220\206\374\305uf-\326y\033#\257d\177\323\266\32400\250\260\355\001\267o\360)\244\246^\217x\262\311\336)\0050"
+	.string	"1"
+	.string	"2"
+	.string	"\247\004?\350N\345\013\272S\213\366MB\207\200\215\307,gw\353$\271x)\372gy@\313\265\272\004\210\330]\313\226\013\344\236\267\255`\033\302\376(\276\354\357>\376\334c\277\364\006p\020j\273\037\267\235\265Q\232\023\333\367\330\262\332\303Hs\360N-\245}\225\257\210\217\251LwE`3\273\013r\203\027)0\016t\230\027\0359m\177\356\2422(\331]\006\177\366\226\013\337\344\324\031)\371\326\251\237\352N?(\260\020\226\274\331\343J\316\021\373\334\356\256\347\313\001\033O]\343\026\205H\024\337\204\004\352;\231@QE\205$\214R8\252\025\245\317TE!\252\206\026\f\236Ha\265"
+	.string	"\301\260z\306\375|\231\326l\254\311\341n\322.\023\343\232\031"
+	.ascii	"^\251'\023\260\354\315\300\003\021M\030`\034U\016\rk\270\013"
+	.ascii	"\206\240\031X\016\304\322\024\003\260;S5(.\f\3450\006\230\003"
+	.ascii	"\203\201A\200<\200Y\201\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_fakeMagRead.8.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375`\034\001\375\013"
+	.string	"\226\026Q@ O\225\016\240\275\301\n\f\004\223`\211\321U\214\357\330\342\213\201\222\347\3608S\220\032DRn\263\bS\032\376\006+D,c\314F\030"
+	.string	"\330(\225-j@\273 U\352\001\221u\220%\233H\231R="
+	.string	";"
+	.string	"?"
+	.string	"\033+^09t\374"
+	.string	"\354pr\001\330\241m'P \362\367\270q\272\264J*\030\2731S\016\377\236\237\377\020/\320\001\262A\305\n5zJ\030\354\256\323\204\312p\353m\033\260\235\261\257\0219b\307Q\252\206\375kw\327\232\262\037\177x\245\365J\347\225~\206b(\205\020@\261{\032\211\261) \253\203m\221M\261\2551\264\002\223i\377\303=D\007Q\341\001vS+\221\r\367\t\354P\025\363\321J\365Id\345\253\021\251\230\017\017W?\344\303\001\330\340\360C\330a\252L.l\004Wq\223\335\275\370\"\0162\301\3478\264\007\312\233\016}\020vxU\026/4x\260H\001\332G\313p\264M\302\3216\265\306\262\201\240=h\340i\236\215\323d^\267\241\320\351\034d\022:\332\226i:/\263\0340\347\331t\331\207\343\272\214\022\367\327j\352\037\026\241\343B\253\005I-X\325g]/q\021\023\001\027"
+	.ascii	"^\325\203\232\320C\005\376\324](n\305 \202\355>\241=h\n4\006"
+	.ascii	"\220\203M !5\024r\356&\374Pua\271\006JL\340\240\020\\\006F\020"
+	.ascii	"\240\302\274\256I\006"
+	.text
+	.section	.gnu.lto_fakeMagDetect.9.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\205\t"
+	.string	"vRD< \005)\035'5\317v\215\261\017\220\260\033\263jN.TL\2419\211F\363Ry\246\277a\273\351\206\207Lb\266X\327\217"
+	.string	"\001\001\2134)\002\235\343i\242 \267\205,\343\266{\247\0241"
+	.string	"1"
+	.string	"4"
+	.string	"\334\251m7<\234,~t\255\216B2\"\263\355\216u\252\\\274\024\375\273<\3415sC\233\261P\227\001\024\273k\251b\225\334\363\266\025lK\330\016\020\217\375\222:\254\255\206@\333]\335"
+	.string	"\254\r\255a\261}\333'[\300\266\224\366[\016;=f:\301n\013F\263;28\342s\352\361\007\334\351\347\005\001\336e\337\304\211\216j#4\300\331M]ew\034\346\343\263\273\020\376K\b\310\200k\345\3247q\247\263&\023C\233\231\244\344\315\036Qr\246\330\367\354\356z\266\354\030\2357\035\002\211H\335EE\330\225\274/TCP\3441\002-\252\306\250\363j\b\f+h\301_I\004V\216\357\003\253\307\275gg\313\027\271\214\227m''5E\354\021)\n"
+	.ascii	"]\325\353Y\0241b\020\231PA\221\237J\344\2533\216L\020\275\313"
+	.ascii	"\304\3275\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375 su\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\005\f\300\204\001"
+	.string	""
+	.string	"\003\002\b\177\r\002\007\177\016\272\220\202\002\t\177\017\272\220\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"p\003\013\001\351y\020\032E\225\001"
+	.text
+	.section	.gnu.lto_.refs.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375 9\225\001"
+	.string	"\224\0025"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001\001\001"
+	.string	"\001\001\002"
+	.string	"\001\001\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\005"
+	.string	"\003\003\002\004\002"
+	.string	"\001"
+	.string	"\002\002\002"
+	.string	""
+	.string	"\002"
+	.ascii	"?\331\227U\302"
+	.text
+	.section	.gnu.lto_.decls.f74f82cfc388838a,"e",@progbits
+	.string	"(\265/\375`\353\020\355T"
+	.ascii	"*\220\304\037S@\320:\352,\270Kz\252cJ\324\307\003]\\zp"
+	.string	"qK\313\003\013F \264\004\257\320f\266\\\340\221Z\257\357dkw\234&\026W\030\240B\3747\344-\366\363\001[\373\215@\213\204r\307\\-\003Q\204~8\354}v?\n)AA\223\355\227$\245\024\303\001\351\001\343\001\035trG\271\266}\316\033\200\032I\f,$E\256\230N\366\230\266\201\355\312\r0\023\215\351/}f\203B\374\357a\244\304\221I\205\207\232P\353\020\013\222\3313\346n\266\227\016\203\263\024\023EC\030\3466k0\334\345NffG\263\177\316\235\216q\371\204\313F\327\215\375s\036\320>'\003\355s\022\320?goi\261N\016\320\\l\277(\037,\216\261\252\"n9\204\313=\300\331k=\300\311\032\\^.\373\007\013\023\b\027\026\323-\023,\347\353\354L\230.n0\346\022&\372k\347\177\204\315\212l\231\306m\177y{\365\025\356\257^r\t\023\274#\374\253\377\265\277\354?\260\273"
+	.string	"\236\356\002n\230D\200RN\313\027\\\326\241\271v\272X\251@\305\265u\313\236\264\266\334&{\253\2550?\020\256\312\230Z\032\267\034\301e\356*J[e\204\253\t\225\326\352MiQs\313\255\305\334kCie\033\377\205\377\037\342\026\005\006\345\313mGi)\235\024\321S\270\237t\026\337"
+	.ascii	"\327_\373L\220`\321mO\377\234l\342r#9\004\360M\260\337\024\376"
+	.ascii	"[\304\331kk-\342d\240\177\316\263}\316~B\304\215\345s\022\245"
+	.ascii	"\326\377`[bqZ\343\326\2350w\223\276\022a\033B\031_\371\277\202"
+	.ascii	"\270%\361\342\361\303-\257\375s\336\3669\223\230[\205\t\314\215"
+	.ascii	"A\t;\314\316\0042\302a\366$\263\340\223\331\275\330\213\231o"
+	.ascii	"\314\236\204\271"
+	.string	"K`n\027\314m\304\334#0\267\b\314=\001s\243`n\017\230Y\311\314Y\314\275\202\271?`f&3Saf-f\276b\346\036f\026c\346\233\265\265\2655fF\303\35490\343\320\004;\377\304\203\227MRC\327\250\2216t\3534\340p\261q#\314\313\221N:\022F\013\242:\022\345\226u\360\031\034\210\031\016j|\006v#\304\317\312\341\326\352\206V,\213\322u]\006'B\005\374R\264r\331\306\344\262\215\006\037\34278ia\212\220\013\304\203t\322\2054\033n\035z\007\006\022\322<\364\232\242\004]B\272\215WuS\252\347\205hl\322\204\204z\n\2266gN\3538\374H\306\312\207\367\360\037\235\364*\366\252^\363\031<?\020\377?\326XU\271\nn\203G\270~\324\t\265\027\022!$\244\003U5\365\273\326\350T\235\364\243\363p\301wtSj\375(u\013\013j\324\216\336\202\347\030\021\034f"
+	.ascii	"vC\332\2752\004L\310i\3316\265\203}\n\367\324u$\214\016\177!"
+	.ascii	"\347\206T\023\254xup\3270\022Clx\271\223\\\306\245\030\r\006"
+	.ascii	".8\234\270e[\360\262\257\271\354j\327m8\224\027\273\251L\321"
+	.ascii	"\005-\355\377Y\360\033\235t\033\036\245\354.6\272)\005\301\026"
+	.ascii	"\034\204\200\204xd8\322\304\t\231k\223\b\263\306\334:\r\257\321"
+	.ascii	"I'\372\n\217\303\241M1\221\224]\0307f\236\354b\227=\313ef\037"
+	.ascii	"\372S'}\206\313\340F\323j\f\264\376[\231\341Aw\032\021\034\026"
+	.ascii	"\355P\223\366\277r_1\023\371\f\177\007\362\374\326_!\204\036"
+	.ascii	"XP\243\366\277\002\t\t\335||a\r9-{\f\227\331\235<\206-\307pk"
+	.ascii	"\315z\223E\352\013\021\0276\033\23513\036\255\352\372\017\327"
+	.ascii	"fI\233\036\334\262O]\366\033\227\035\352\262\007/w\232\253\246"
+	.ascii	"{\370\220u|\242\244\214\032\263\333\337]n\003\265\317\331\323"
+	.ascii	">g\237i\033vP\363\324u\033\207N\353d\233a\3562\335\205m\024\343"
+	.ascii	"#\377W\234\r\210c\254+\350\374\020b\226\2241\343a!\256\314`y"
+	.ascii	"\230k9\261\302j\330\342^82\200\034o\240.\2633\237\377Q7\353\023"
+	.ascii	"\203;\3347\335A\314\270\266\265\001\314lm\314,\200\005\353\377"
+	.ascii	"\272\310\240\271G\272\200:\234\200\017\372\377\021\207\310\343"
+	.ascii	"\017\304\020\t\374a\262Y\0041\\\237*\304#}\374p5\376\254\361"
+	.ascii	"\347\277\276\360X|\241\361\3074\\\237\370\253\361\327\363\302"
+	.ascii	"b\317p\005\376\206\310c\261\207Hc\021\304\013\377\367B \325\025"
+	.ascii	"\032\213C.\306b"
+	.string	"\317\020\t,\016\205\307b\377j\374\366re=\376\234\036\t\304\375?\324j\365\333\371\007\022\377W\3464\376\230F\343w|7\227\254>\376\377\377\247<\353a\304Y\203\337\034\"1\272p\372?{\032\016\374\372\267\376\277\214\017\376\372\337i%\376\007\215$H\031\373\213\f\342\343^\b\204\n\3660\3568\005\2152\036\tU\027\207\310\036F\"\257)H\253\017\256\277\266\372\263#\361\"\177\353+s\300!a\220\202\002\303\352\243\230!\314+\374u\213\372\261i\272u\257\034\253,\037:\316\\*n\305\273\\\313\253\370\226s\271\262\223\276l+\354I\237\342\313.k2\335T\3323U\210\2328\0244X\r\304\340L\272(\257\226\035\326cL\254\244\261/;\215\3030\"8\264_ZiY\230[\213/=\253\265\272\031\3042\331Jk\262e\243u\016Z\250,=\212#G\004\207o\263\232`\224(\021\302\371\341D\207\026"
+	.string	",[\344=\277\177Nn\266\317\351Rrf`\203\374!\303e;\304\327'<B\212h\241\272q\261\374\211\0163\b\024\033\356\204\375\t\316XVC\226[\277j\256\250)\315aW\3011cF\026\304-[\342\265\262e\t\227\270U\322I_\342D\224K\274\210'\331\342\261%\252.US\234\232\256\310AU4\205\220\272S\241\303\272]/\345\245H\227\0358\261\300\211\007`\334TvA\002\001\336\016\305"
+	.string	"\tU\272\251;^\221\272\343\355lO\355@\307k\272\340\bM?@BU\004p\204\246=\313.H\364\322\244#\036\232\201\217\312k\341\276\234.\375\300\004\035j\224\224\204\242"
+	.string	"\261Sa\244V\365\345vL+Z\244)rE\035\254\320Iu<T\365\361vW\315qPdy\273\016x>\335\271c\362\331|9\024%\212tP\224(\3029u%v\266&#\021\276\234\212\243\236^\252\372P\245S\315=\240\362vM7\237/\355\035\035\241\267\364\005\232\264\242\211I\3516\345\256/\227\352v/\322\024\276&#\2354\2272\241\300\302\327d\204\2232\241\240\372\232\214n/\322#_\223\321\231\346\320\\o\311\307K}<*/U\342!\355\222(@B\225vTvA\302\347BE\225\206xKJJK:\001x\211)\355\r\251KK\275!\035\245\366\345rL-|`\354z*\252\202\267\264SQu\251\307\243\346\220P\026K\273\033\022\312b\247\302\260@\345\025!\241J\270\244\245\245\nr7\276\334\2134\005\022\252t\325\334\t\"\225\267\2731\021\021\n\002@\330"
+	.ascii	"\203\253#\221\232\200\266\310\371P&\245%\335\220\257\227\276"
+	.ascii	"\330\365\216\206x;TiH\327\363\r\221H\240L\331\2075L\031EFl\207"
+	.ascii	"i\326\303\314\355\2301.\026\200\021\253\223H\2303#\230/_\374"
+	.ascii	"\254\267\214RA9\310,\\`\302\260\237\271\r9\230B\267\016\246\225"
+	.ascii	"6\344\215\261)\267n\326J\034(d9\232(y\254\320\304\360\023##\363"
+	.ascii	"\262\025\210^\330\313lM\274\232kn\275\351a7\242\231+"
+	.string	"?n\272\306:\351c\255\345\353\377r\236\226\304W\200o\244\\v\246ca\317\302\314Y\\\354\376\377\355)mL\232\332K\021\203\230}\013\273\330N\201H\250\221(\251\2204$#\"\"\222$I:\021\005\204 \353 L\017\021@\245\203jjd\244 Ie\3307\346\254e\333\335"
+	.string	"\237\273\306\235i\215<U\216\304P\315\271q0\316&A\231Vt;e{{\022H\035\272s\2762\362\212e5\265\003\032\013\026R{\2166z\250[\222O.\3522\300\022\320G\263\265\262\023]\260V( \364'\302\023`\351LiS\202\212\353\225\033N\217-G \"R{U2\254\035[>\354\002r\335)\347\377@D\016\0217\004g\307\347\334/\211\322C\253mDwX\377j\273\235\2164\024e\032\327\026Y\256\257G;\307PV\360\257\371\376\363\362\314\025\020\031\253\307\360\3202\276n&\315\322*\265\243\274\242\242\250E\325\017\\\347\331\332\017\263\252\327~9\021D\034\362\272r\372;\273c\240*\333\377h\350\277\333dV\342\fT\275'\244"
+	.string	"\276\343"
+	.string	" \207dU);yZY\343-\373\264\016\345\277\3067iA\304X\343\225\352to\037\312~b\232\335\343\340Q2~\317\330\222\\^\211\257Y\347\313<\313t\t\036\2514\251\2502\357\"#\t\344Yp\005\346\235\177\350\273"
+	.ascii	"\332\321j\030\235DN!\232k*\302\211?\216\032\253r\202&\375\372"
+	.ascii	"_\301\336\026\324\035\322{"
+	.string	"\320\036p!\020\346\321\366\231\222\017\b\007\335\364>\004\366f[H\351\020\301fC\376\n?\316\303\034M\346V\263F\361\314\300&\206\007\331\234S\026=;%}+\247Z_\007\353\001\200\227\023\n5\273l\247;b}\240\0027v\320H[\350`\373\002\006\243\200_\034\177\f\246\2023\304bE\n\367\334:\302D\245\266\214\3024H=\360\376\270Zcp2\007\374R~\233\312eL\357p\264`\252\035[08Ij\332\363\236\021\215$\205?\303K\372BX\307a%\256>\263\210\307Fr\317Vj\346\261N\210P\264\252\016Y\030\342N<\340,\327uU\020\303\263m\331\344\205\024g\312X \3745\265\356\030\371\331y,\233\233\030\346\342\363\320\035\222\360\357\362\221\346\303\036s\236\361bW\243.\254\202\017\345`\b{V\354=\233&\262\227\004q\321c'Un\tp\031\rps\303\302\201\271\202\250\362UW"
+	.string	"[\200AHm,\0338\304\275"
+	.ascii	"\n<\211\327\325\272z\3569\374\243\307\205\343\303\303\305!!\241"
+	.ascii	"O\332Y6\253\362N:\364\217\364\007|\025N6\235\037\333:3\216\263"
+	.ascii	"W\332\302>\244V\300\024cX\2009\276\271\n"
+	.text
+	.section	.gnu.lto_.symtab.f74f82cfc388838a,"e",@progbits
+	.string	"fakeMagSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"fakeMagDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f74f82cfc388838a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
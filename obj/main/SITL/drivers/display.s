@@ -0,0 +1,1041 @@
+	.file	"display.c"
+	.section	.gnu.lto_.profile.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375 3\231\001"
+	.string	"/"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	"\002"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	""
+	.string	"\006"
+	.string	"\007"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\017"
+	.string	"\020"
+	.string	"\022"
+	.string	"\023"
+	.string	"\024"
+	.string	"\025"
+	.string	"\026"
+	.string	"\027"
+	.string	"\030"
+	.string	"\031"
+	.text
+	.section	.gnu.lto_.icf.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\225\n"
+	.string	"\204\020\317\001"
+	.string	"\032"
+	.string	"\300\320\222\371\005\004\002"
+	.string	"\002\001\002\002\002\003\001\320\233\373\266\b\f\002\004\002\005\002\006\002\007\002\006\002\005\327\304\205\304\006\b\b\002\003\002\t\002\001\002\n\002\001\003\312\337\356\336\007\004\004\252\343\367\225\007\002\013\002\003\005\235\366\313\304\r\f\n\006\302\264\200\023\n\007\224\312\272\240\r\006\b\213\314\213\214\f\002\002\n\002\007\t\340\337\203\343\005\004\002\006\002\001\n\257\346\362\241\006\b\f\002\003\013\305\351\254\360\003\r\002\003\f\301\343\227\272\003\007\002\016\002\003\r\336\365\267\361\r\016\002\003\016\366\332\246\320\b\004\017\212\251\337\324\017\017\002\003\020\322\317\311\210\n\007\002\020\002\003\021\305\350\206\363\f"
+	.string	"\022\211\271\240\321\r\023\301\211\376\332\t\021\002\003\024\232\204\335\302\b\001\002\022\002\003\025\340\266\354\313\004\023\002\003\026\257\257\332\372\t\024\002\003\027\302\316\266\331\006\017\002\003\030\377\271\306\315\005\007\002\025\002\003\031\343\342\314\335\013\f\002\n\002\001"
+	.string	"\037"
+	.string	"\207\233ap\021"
+	.string	"\227\200=`\0340NP\343A8WG\201\264*\200 e\016\bH\207\3611\023\034\035y%\026@&\031\273h\235\001"
+	.ascii	"b0\256\025[\2010x\245\330\240(\311\274\232N\nQ]p/\207\024\300"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`w\001\265\006"
+	.string	"\342\310\027\032p+L:\300"
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\205_G\372M\341\373\355\211\021K\266L)\256\372\n:\030MX\371\227 <\034\254\252\f\266\025\030C\022\301\200\300\361\001S\263\2545\201\364X\276\n\223K\030\027@\241\342,\261\225\275\371kW}u\226\036\371t\226lO\323\360\352\2404\322\325\336\005\307\0203 \200\002!9\342\rhR\360h\001\023\256.2\345F\200!\357\205K\302f \3340\313\270\302\314\\\22010\262\001\240;\214$\207t\005\260\034\365N\265\3603N\305\016\035\027"
+	.ascii	"uE\201\321\f\243\305\375\351\303h\366:I\234\001#Jb\b-\220wWa"
+	.ascii	"\203\025\205rB\304\300\3457\025\307\023f\020g\247\246+&W\341"
+	.ascii	"\302\375\274lFh\003\202\025e\b"
+	.text
+	.section	.gnu.lto_.inline.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\026\bu\025"
+	.string	"\326\333X=0\215\223\306\bT\346\337\361%\322\257\324\252\211<\236\311\362\201\340\023\017\246g.\272\250\206\362\333y\274Y\203g\204\220\031l(t\241\313\024\205\330\376\3427\223cS\267F\b\331RJ\231\002="
+	.string	"I"
+	.string	"J"
+	.string	"\2265V\207\220d\212J\3521\254\276\315\276\007\271\005\336}\233w\360\326o#Iv\367\362\375W\206\277F\322uD\2007\216\037\374O\356\356J\372y\342}_(SF\"\210\300<\306\025K\037]\260\273\f\276a\340M#\371\031\220.0\001\206\233Pt\"i\302\216\333\007\312\006!#\016\324\324\364X\346\224Ibw\253\245A\b\222\034\270aw5\267L\343x\330]\313\212a\345\374\312,\375?\250\033\b\002\tx<c\231F)k\305\320\004%\004\005\335\312\300\023]\001)\003;.\277\020\356\005\221\022\2263\026\200\t\fr*\f[\266\314\227\257\254\375\233J\225I]"
+	.string	"\274\344\250\330\362'\205\177\240vEc\305<\332\250\032\243\036\300\223\220\221\311\3559_Ht"
+	.ascii	"\336a\276\320\307\350\353'!||\230`Y=\243z\244\206\227\341\032"
+	.ascii	"\212V 5\354X+\200X@\331\334\2210*\031q\231\363\225I\037!\243"
+	.ascii	"\016\325\026_\231\200\rJ\207\036)\016N&\256\240\230:c\33205\224"
+	.ascii	"\234\210XS|\005\200\226\250!]dCB\222\202\032Y\306p\002\231\021"
+	.ascii	"\2629\017\022`d)F\322\030a\006\221"
+	.string	"\030\t$\222@&\240\030\021J\f:\301\316\025\375\235\205L\032\344\020Kt\213\253\020\004\233\312\007\241QJUgY+\276\n\347\214\355\361Q\326\032\247\220\203i\341\244\037\207.\242\363\323'\274/\237{AK\245L\032\253\333C\226\330\326\355\345L\271n\260T\220\001=cO\334A\274\304@-C\305N\237\210\236\265-\271,G\240\302\274\031a\2631\324\300\266\234\372\346eZ\377\356k\244=\352\227\351\310@=\307\366\231\216\346\034[\261\244\207H\036\220\331^\" \235\200'\303\207\026\372\f\351X\032@\330\361\033\363j\212\232%\307\237\253`(g\b,\377\355p(d}\026\322\353\216\356\327\204PN'\277\246&{\004\001\202N^x\247:\304\261\277\316\217\214)\336\013\333\221H\224l\215\336\006i8l&\361a\"\274dh\344c\227\332\3012\306\337\302\300\330e\252\202\373i:\316!\256\235s\177Da\323"
+	.ascii	"\317\004\347\026\027\326\226\373%\237h8\242<}?\006>,\202|`\345"
+	.ascii	"\313\240`\337#:\365J!\340\243q\357~\026\345\271'"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\025\003E\t"
+	.string	"\342\313#(\200)I\00730\003k\00230#0g`\206(\272jFA\021\347\327>\354\201\177\240_\373\310\232E\244\221Md\332\001u\205\304\204\350\302\265B\344a\037\n\017\t\327\272\001\341\2729\376\2108`-Y\330e\203k))\245k\013\033\317\202e\307\223"
+	.ascii	"\r(;\004\002\256\250q=\315\260\032\035H\b{\322\207\001a!\354"
+	.ascii	"\354\304o\026\b`\224\324Av\245\271r\326<\021\353\260\312\363"
+	.ascii	"k\325\024\t\253J\213\324\026\271\256\232\315\315\027C\331\"D"
+	.ascii	"\250\361t\243D\013\n\265\2061\320\002\t\206\3146\022 \344\024"
+	.ascii	"\303\200 \003RJAjP\034\206\345\331\232\001\322@\301\2169\231"
+	.ascii	"\236\t\3451\352q\025/!Sah\315\346\375w\336\233\"\206\237@\206"
+	.ascii	"\362\241\241]\355\326\225hs\331\302a\004\365f\231\363|\2268r"
+	.ascii	"F\"\342wyp'\302 \3737-,3\006\277\311X\266\0353#\330\035Z\004"
+	.ascii	"\361\016\3469\330\311\002\225\226\310\t\315\267\261\005\026\207"
+	.ascii	"1)\021\331\221\240\234\315\032Q\032D1\334I\270\321+\nC\001"
+	.text
+	.section	.gnu.lto_.pureconst.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375 S\r\002"
+	.string	"2E\017\025\200/t>_\231\22090\022\343\362\200\003\t$\220@\0226\356\367\232\326\254&5\247)\315hBo\317tf3\231\271L\345&\027\271\307\232q\213K\334a>\205\033\\`\036vwY"
+	.text
+	.section	.gnu.lto_.ipa_modref.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`L\003-\n"
+	.string	"\302J%-\200\267\35130\003\233\f\206\303#\215\034\230\200\271 &l\003\302\300\240\240FDD\302W\356\330w\233\375\377\337\377\357\267/\377\255\355\224R\215\r\017\227\323\306x\230\336\244\347\213\202#\013J\260 T\016(\327\204\222D\364\021\003hA\332\372Q9\252\247\005n<\030\001#\203\351\214{\013wN+\356Lsw\006\240\277i\373\n\241\265Lo\231\326\244\277\3233/D]\230\306j[\340\021\032\213\356\00680\3345u\027\340\355\332\265\256\373\356N\1771M\264\315B]\250!\2754\246\246\275\003\320\002\021)\252\016\021\340\030i\030\0311\021e\226\273\264\006\343\263"
+	.ascii	"\330t\273\201\344\371\370\2371\204\214\366I\324\035R%&\333\221"
+	.ascii	"\231\301,\315V\035%=\354\207Q\363\247*\200\020\245\013\\\340"
+	.ascii	"[%\007J\272\212v9\272\254{\177\240XdS\006\363\262\017\007\256"
+	.ascii	"\246\275\177\317\314\036\306\364Ux\"\261u0\r\2026n\200e\375}"
+	.ascii	"@[\200i&Va\311z\304\312b`da\225O0`\207\300\327\353\350\351\004"
+	.ascii	"\020kD\037\003zQE\033\361(\241y\346k\334\330\b\027\214\024@\301"
+	.ascii	"H\365\375\364\354\025\273VT"
+	.text
+	.section	.gnu.lto_.lto.5b17b22ebff998a0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayClearScreen.3.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\315\n"
+	.string	"V\024KB \251*\035\b\030\t\001>\234\007\r\273"
+	.string	"\336,\035\347a\031"
+	.string	"K\354{\351#!\236\3357\004[\303C\321\004k\344"
+	.string	";\b!\021\026 \220\001\f"
+	.string	"\020\302\003\325\3002\202\"|k`\022\311&{\247\0245"
+	.string	"8"
+	.string	":"
+	.string	"\273\343\205-\270S\217\217\330N\271?l\247\026\355\t\023$\f0\223K\266\273u\016\270x)\372Gp\312\t5\272\\\310\330]\313\023\312\344\236\267]a\033\303\276F\363\022\f\244X-\222\234\331\343H\316"
+	.string	"\366\265\335]O\225\375\326\257Mi)\245\317m\230^\020\017vKf\0256F\033\024\250\330\276\264\277:K|Kt\207]\225\003\006\001\251\325\317\331l\357/N\003\204*@F\201\"\265i9]\001P\232#\333\337]\036\334n\351\342/\020\tC\333\251\234\022\021\374q\005!nw/~\002\020\bG\340\324\027m\247\017]\246\203\371\204\035\217s\306\022\202\341\360\204\236\246\206`\007\362@M\355x\230\216\232\001\303j\241\360\347\351\300\372\371>\260V\306\275\266Sez\022#\315\021\213\337lvw\330f\302\016\004\020"
+	.ascii	"2\241O/0\\\020\224\312\207\364\366,l\0345\211b\260N\251\3155"
+	.ascii	"\235E\312\204Q0\352\022V\263\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_displayDrawScreen.4.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"U\t"
+	.string	"6RB;@\305(\035\240\336\372?\217\257\375\253\203\363b4cj}\217\221$\343`\356\275<\332GY=)\372P\033\005m\365[;\206\231!\307\340\212\254\343\201\352\025\3441Ad\223-S\n/"
+	.string	"."
+	.string	"3"
+	.string	"\016\217\311.\265\027d\227\006\355\226\203\212\201\025\213\026\200\335\235q\343\340\025\364/\362KJe\272\n0\354\2565\245\302\270\343m#\330^\260- \366\261\335]\307\225}\326\217E\265\252\372\331f\202Q\331\275x\rX\227L\361\330l_\355\203<\004<\253t\202\335\325\t\312n\250\340\004\3552\321[\006*\232lwo=h\273\250\215_2\361\221\262K\215\006,\2068\tI\333\335\215?2\212\3208.\375Rv\371\230\351\b\300:\351\313\016M\0325\002\237\016\210#\372@\234\346\216F\202\323\020\3728\317\374\274\317\210\363<\023\304q\034f\307\373\246&\343.\364\361\246\250\353\274\271\205{l\343\312\362\303u\212\024\276(\026\255\001\013"
+	.ascii	"2\2417\034\330\270\360\224\332\334\322YL&4\202)\227`\233\325"
+	.ascii	"\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_displayScreenSize.5.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\215\t"
+	.string	"\246\022C:0\345(\035\200\213'\005\034\264AU\270i\237\354\024\3424\302\273\240h\003\353X\265\206\373\\\213\rFc6\212\232\376\031\021$\b$!SN\340\266K;\021\n\023\2737\3312\2452"
+	.string	"/"
+	.string	"2"
+	.string	"&\240\355\002\221\221\211\300h\254"
+	.string	"\330\335\215\363\315\274\314N0/#\310\301+\350\037\345\b/\330\212\205\272f\036v\327\272bq\334\361\266\023l3\330\017\b\341\237E\265\252\372\031\201\216Mlw#\026`cd\013\211m\320\326\330\276\332w\375\004|x\372\300n\353\205e7\\\260\202v\351P\263\355\227<\036\252\210\262\035q\230\350u\321Y\314K\215\007\236\270\312\247\355\252\032\374\024\023\2056r\351\237\346\345cA\210+\2451;Di\374\260\237ml\331\231z>\241\317\310S\372F\234\346O\247\302#A\3728\320\366y!\023\347\201\266\021\347\021m\037\357\333:\006\356H!o+u\235\267i\302\275=#'\0251\254\321,Z\343\214\016\001\r"
+	.ascii	"2\003\3020\005&d\220\035\330\233\322\\q\3062\327\360\207,^\003"
+	.ascii	"&\036\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_displayGrab.6.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`/\001\225\f"
+	.string	"v\327SA\020q\233\016"
+	.string	"K\264{8\002D`\b>\312\177\221\255GM\331\034\234\025\200&\003?\303#\342\353\021\361W\030\025\266\030\266\240\021\273\252\252*\337!}\336p\215\032t\335w\364]\266v\333\335\244L)@"
+	.string	":"
+	.string	"E"
+	.string	"\"\270\213D>`7\244\262b\267\3338A\374s\367\002\360/\236"
+	.string	"\3743g\3070`!"
+	.string	"\214O\n\215\335\255\224\303\271'\347\177\304\001\200N<\317i\301\356:A'\030n\275m\004\266\025\330O\021\177W\315\007\026\321H\216\354\316\223\272\301\276\264\273k\r\331\027\375\027)\035_zzi(\245\237\246\245L\253\2463\323\027\2001\311\264\330\2750\252\261+\217\205\007\312\366\323~\210\007$9\362S\250\233O\213u\024\327\323\003(,\022\203\253L\310\244\023\252\032\024\020T^\324\251\2464\224\250\307\266\203\247x\304\335\022\016\337D\205,\004\376\245f^\030\302K\204\304\335\345\360I4\330b\207?_\004\006\227\325\341\200l\035,\332\332\240\300y\360\261a\035\325\246]\0220\255\243\352`\034\217\312\322\266jC\343\354\343\322*\220,\323*\252\333K\253!?\031+#J\342\250*.\214\213\203fL\032\365\237\226?\002\204:\351M2\004\032"
+	.string	"2\241+h`<\020\022\001gl\343;\344p\231\0011\266\201\201"
+	.ascii	"\257`3\330\216\n\245\021E\b\360\323\202\tSI\013\206\353\224\332"
+	.ascii	"\334\322Y|&4\001\306\\\202mVS\302\035^\264\223\f"
+	.text
+	.section	.gnu.lto_displayRelease.7.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"u\013"
+	.string	"&VN> Q\233\016\f\215B\344\320H\002$\234\230\250\350 \002 !8\026\004\201\201-\016\217\020\2316\026S\3634\033e\227\332f\037\004\020\004\002r\033\323]B\261\262m\f3Q7\332\335\244L)<"
+	.string	"8"
+	.string	">"
+	.string	"\027\260\033B\221b\227\243XA\3743w\002\360/~"
+	.string	"\374\263f\2778P!\300\214OH\214\335\235\224\303\265\247\346_\304\001\200@<\317\r\006\273\353\004\201`\270\365\266\023\330^`\237\023\327\311\366a\353\310\316\346<\251\033\354G\273\273\326\220\375\355\217Q\032\276\364{\351(J\253\2463\323\227$,\f\254\330\275\320\321X\221\247\302\203d\373i\037\304Ch\3378\002\372\364\0262xdg\325H)\237\021\352&\032\250\"\330dH\031\325\251\2264|\250\307\266\203\207h\342\356\207\305/A\341\352\300\277\324\002.\f\341$:qw-\376\b+\213\035\376|\016\370\027\024\306\272p2\253\212\306T&\\\036l\262*3e\030%\241\3022\223U]4\023\006\313\246\312\304\327\206\302&\316ua\223\304\355\243\325\220_\r\221\016\3650\324\023\222\026\007\301x\n\365\237\221w\217"
+	.string	"\243\024"
+	.ascii	"2\241\213/0.\020\302M\302`$\344p\231\t\004\333`\220\0266\230"
+	.ascii	"JZ0\\\247\324\346\226\316b3\2411\030p\t\241YM\twx\321N2"
+	.text
+	.section	.gnu.lto_displayReleaseAll.8.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"%\n"
+	.string	"\226\023G=0\345(\035\200\223\251\207e\376\346\302\032#Q\020=\261\225\036\026\210w$\321\030\335\266\365\033n\243c\265\301h\024ZQ\323?#\202\020a'\340Ey\210 \330MZ\2364\262\311\336)\0052"
+	.string	"4"
+	.string	"8"
+	.string	"\334\251\305\027l\247\334\t\266S\207v\200\213!{\225\f\214Q\266\273u\202<\274\f\375\237\\\303j\245.3\016\273k\311jm\334\363\266\023l7\330W\b3[L\311\371a_\333\335\365t\331\177\375\332\224\226R\372\231\215\003\346"
+	.string	"\266\2531\033\2601\3722\262\261}i\277\344&\341_\250\017\354\272`-\273\"\203\027\002\0021\231\326(\023\240\221\332\264\234\336x\254f\312\266\367Q\202\333]u\374\025\013\360\264\235\312i"
+	.string	"\300\023O9q\273\333\361QL\024\234\310\251\217\332N?\247\313H\362R\311\241\317\310S\002G\035\347\017\247\302\003A\002;P\005\277\220\251\373@u\324y\"\352\347\003+\007\301\036)\364\325\222\347}u#\356\265\235.?t\304T\363\302\276h\263\273\263\210\002\016"
+	.ascii	"2\241\003/0<\004-\354&5\237a\260Y\251\0351\035pe\202(\030u\t"
+	.ascii	"\253Y\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_displayIsGrabbed.9.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\345\013"
+	.string	"\326VSB\020q\224\016\033\002H{2f\023F\036\230\240\024\034\"/\274\022Q\260x*\277>\240\261\307P\260h\365\373W;\026\322\336\001\"\333U\001"
+	.string	""
+	.string	"\232A\352E0\016\332G\332\2360/\226\240\275\267\224)\005C"
+	.string	"?"
+	.string	"@"
+	.ascii	"\313]\032\342\244"
+	.string	"\303\247I\362\177\362\247\202b\001\262\225\016=\374=\002 T:$X\031\241a\3314\244\276\013j\305\n\300vz\230\225\311\207\237<C6\217\314\016\b\273\353\004\3318\334\361\266%\330n`\377@\251\351\307Hbe@\267+\322\341\330\030\320\305\b\333#\333b;\323\276\211\237\030]%z\200\335\324\213\224]n\2011\326\241\271\013\210\207\326/\361\320\266\0318\030\231tN\204\310G6|\240\330\330]\204J\362JPRj\274k\361\372\022*`\270\302Sh\326\356\351\201\217\002\203\005\253\344\360\212@\206\312\224\335se\202j\241\026E\325\b3Ny\303\346J\251$\366\337\356\2565ex\325\257/\035\235\215G\023\322<\230\345M&\203f\002H\3038\227\226u.`\031\347\362`\032\n\327&\323\256L\001\177@\235\354\n}>\331e\341\366o5\345|\n\236\212yj\210m\250\006L\352\341T\250\377\310a\312\021"
+	.string	"M\204\336\031\341\265Qd\210\3235X"
+	.ascii	";\202\350e4\233\300\026\320\275\226\260>\027T\212j?\261\314\f"
+	.ascii	"\022\032\275Jc\2265\367"
+	.text
+	.section	.gnu.lto_displaySetXY.10.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\305\t"
+	.string	"VRB9@\217\322\001x\255\022QHr\204\262\336\254Y\213\220\246\324\177P\\F\227\333T\255!\263\\\240~\266\025\320F}\216\243\270\020d\232\3533H6%9\271\216\222\306m\367N)/"
+	.string	"3"
+	.string	"0"
+	.string	"'\330>\271\017l\237\016\355\227\327\217}\254\225!\213\331]*=\036>\206\376c\007X\261R\217\233\207\335u\\\2616ny\333\007\266\035\354#\004q\263\315X\n`v5j3K\233+!\266\317\261a\265\006\031\355\005O\370z\262\334\345p\361<\332\0379I\370\027\352\002\273.\224\331nUp\002\367\351\032\322\006\177\"#\245=q\223\023\267\273\f\276\354\242\"\240\005\004\265}\316\222\024\221\226*\326\354\232\212\262\303\276fw\327\322e\037\366\317\327_\376\365\007\246[<\364\021u%P\344q\376tL]\004\t\364@\024\374B\024\336\007\242\"\257\223\240\237\017\244\035\003\217H\241\217\226F\243\217r\352^\263\322e\b\025\232Jbx\006\022"
+	.ascii	"2\241\033\034\030.\250\243|\201&4\025\016[\\\r\023\326\270\006"
+	.ascii	"|\303\030P\016\f\006F\360\031\026\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_displayWrite.11.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\273\001\345\017"
+	.string	"\306^kF\340\262(\035\341W9\316\343\030\007\210\314L\026\034\205,\302S\n\301\230\335yI\221B\351\020\036\257\266\330\260\265\021\370\227\330\265\224\374\257\221\0341\306\r\353\017%uC*\264\201i\004D\266W\303\017b\311&R\246\024S"
+	.string	"T"
+	.string	"["
+	.string	"\326]\030\036%O\3733O\001>l9\200\335\030\035\027\273\341\001\033\350\036\035v\266}\231\243"
+	.string	"\355\031[\030\202v\017#d7?v\327\033y"
+	.string	"\356q{\211{T\020\007\237\240\177\235o&8\370\230\321^\317O\203\335u\316h\031n\275\355\002\266\031\330\351 \032ck\232t\234\177t\233_\364\360\017y\315\037z\316\017\322t\247\351\217\246\271.\035?\351\215K+\227\316\230~\211\273\221c"
+	.string	"\216]\f=Av'\302(a\033\264C\266\267\034\013\002F\033S!\263"
+	.ascii	"\307\365\321\302tlP`SK\240i#(\001_\343\n&~\214\225\b\235\n\367"
+	.ascii	"\030\225\200\210\031\333\364\027*\335\246\221\246\306\211\031"
+	.ascii	"\221\332\247\267\21044\200tP\265Qg\341\352v\327\304_!a\202h\007"
+	.ascii	"\211\026\3561yf=\364/0\260\354\3615Uod5\227\354q(AjS@\311\317"
+	.ascii	"\256\"/6vb\372\262\303W\352\007\373\333\006\254\177\255\226i"
+	.ascii	"c\371\205\243N*S\213\245Ju>\221\260\230*\244\260R'\036\353C\255"
+	.ascii	"\244\276\023O\2252\241x\247\217\345\221\210x\225\202\372\274"
+	.ascii	"\326j\365y\241po\223t\304Ea.%H9\375h\247!\352\250$\335V\203\276"
+	.ascii	"\034\322N/\253}\364#\345\364<\262\332\203\313\200\320\355\306"
+	.ascii	"\002! \260\242);\035\"\340\207}D\201\2203\334\035\261\362\250"
+	.ascii	"4%\025\005\310`\2134\r-s@Z1fA\356\005\341b\226\004\202\204bO"
+	.ascii	"\244~HDy\201\307\027~`y|\220\374\030\314#\370a\231+(\\w\237\336"
+	.ascii	"\212I\020d"
+	.text
+	.section	.gnu.lto_displayWriteChar.12.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\243\001\005\017"
+	.string	"&\034cD"
+	.string	"\261&\035#\0234\335\2238\027\203\366\273z\372\317\177\232\342\3468u\270\306\364\264\256\374\245\007\336\266!\274\376N\233\344\355\324\230\2121J\377\377\377\307\020)*\030\222^g\225\231|o\027\272\267%{K\231RL"
+	.string	"L"
+	.string	"V"
+	.string	">\354'\270w+\007\355\276\334\260\330\355\022\030A<t\027m\37317\301\3311^\027\342u\0170,(r\354\256&\362\001\331\341\273\200\354PA\234{r\376S\374\225h\321q\275VO\217\203\335u\272^\032n\275\355\003\266\033\330I\022\257\371Cn\363\177N\363\203\274\373=>\363GM{4\235i\032j\372ei\205\351|\351\007\310vj\020\220\261\233!\266\2634\240\013\022\2669\373\303\266\211aP\323a\001\215\352"
+	.string	"\266e\303\245@\323&)\341>\243\262\356\272\350\224<\0359,;F\207\361 \356^0\361_X \305\0245 \002\306r\204\267H\211\251P\006G\007\fDm\224\257\200280\034\3246\375F\025w\327\304W\001a\302\347\306\210\225\3540s\\8X\031\363\257\312\242^O-30\270\2642fw\253\324\017\366\337\352\213A\001\242o\251T\350\251\274\302G\242R(\205*\221\242E#*!\t'\024\351DCm#\n\244\355D+\221B(\232hCi#\005l:\2156-e2m\332G\267\267A*\302\322\226?\371\024j\246\036\365P\253\202\364\355\006]9\252'\013Q\250\377\350\323\007$ \300\"\032\243\036\"\340\207-b\020\006{7\230\211\274o\304\352\243\322)\201\253\320\004\013\312\274Y*w\2269\246:\203\204/\205@\337\302\363\206\347$&Y5\f\274"
+	.ascii	"\025q\234\201\311\3058\007\206G\037\301\205\375\\\301\360\337"
+	.ascii	"}\342VL\202 \003"
+	.text
+	.section	.gnu.lto_displayIsTransferInProgress.13.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"U\t"
+	.string	"\206\222B9@\217\322\001\230NL\267\025\200\030\2248D<M\200c?\002m\232ui|\264W\177\027m4\030\215\331\260Q/\351\030&\3261L\240z\301E\250\223\277%vo\262eJ\0010"
+	.string	"0"
+	.string	"1"
+	.string	"\001\363\322\266\027\032PN=\374p\235C\345B&\263\033r\321\343\251k\312\277\311\265\021\r\227\326Ku\325@\354\256\265\365\302\270\343m#\330f\260\357\277\246\2515\252\257\321d\300\020\254\354\272f3\373\"[Dl\243\354\215mU\373$/A=v:\300.,\206e7Tp\302v\351\360\002\363r{Qe;\342\262PJ\205g\232\227\032\r<q\024p\333e9\370'%\212-\344\322?\315\313\307\001\220\330Jgv\250\322\330a_\333\335u\204y>\026 \217\250C\002E\335f\017\307\324\221\030\201\335\207\003?P\251\373>\234\250\353\2048\317\007r\234\002{#\320\307\221<\357\3436\341\3363\036\254\242\2057\252Ek\234\361a\203\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayIsSynced.14.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"m\t"
+	.string	"\206RC<@\305(\035\340\345\376\031\300}\361\222$\021\364\2301\271\237b\032R \246\231\001q\026\255^}\247\352\017\265\261F\266\372\255\035\303\314&\003\236W\214\310\337\350#\024\224\330\275\311\226)\0050"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 L>\375\013a\335\243E\003F`\367\233\020\344\247\353\311\177\3123\023\216\330\252\205\272b&v\327\272jm\334\360\266\027l?\330w\177\226\251\025\252\217\301\224\b8\030\260\313\212\025\330"
+	.string	"\361\205\304\266\311\316\330V\265\177r\024\323_\245\017\354\272"
+	.string	"\270\354~\rf\320\036\375\275@>j\017\020e\233\342\260\017\013\006G\222\217\n\023l\361\025O\333UE\370*\243\013m\344\321/\311\307C\003\221WJc\366\207R\370a?\333\3355tY\376\025\036\016h#\362@\233f\216\206\264\251\by[gz\235g\264u\235\t\3326\237\311\351\274\251A0\027\362tS\304q\335\314|{K\250\220\202\031\316h\006\255PB\211\016U\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayHeartbeat.15.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B:@\305(\035\340\245\273^\357U\t\022\215u\200f\f\334\372\245\334:\331m\312\033\237\355\243\254\236\024}\250\215\202\266\372\255\035#v\242\006\300\025Y\307Lx\321^\311'\233l\231R/"
+	.string	"0"
+	.string	"3"
+	.string	"\037\320.\267\013h\227\006m\330\303\214=\211\312\204\013\300\356\316\210q\360\n\372\0179F\265:]/\t\273kU\255*\356x\333\005\266\021l\307\002\317vw\035Y\366[\177\026\325\252\352k\227\016\026\315\312.E,\300\276d\312F\306\366\325\376\307A\300\267L\017\330e\231\234\354\206\0076\330.\035\006\031\213T<\331\356\356j\330vS\034\277$\342+i\227\032\tZ\354\360\221\322\266\273\034_\204\364\260i\\\372&\355\3621\242\3008Z(\215\331\341I\343\205\035 O\2503\372B\334f\317\006\242\263 \372\270\317\374<\020\211\363>3\304u\030\246\307\373\346F\343N\004\362\346\250\353\274\231\t\367\331F\226\025<^\250(a\214f\321\032\035\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayRedraw.16.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B:0\345(\035"
+	.string	"\276-\243\270\300\017,\331-\204*\254\207\023\224\026\266\006P\372\276_\255\3416:V\033\214F\251\242\246\177F\244\330\024C\265\035\220[&\bx\303\223F6\3312\245/"
+	.string	"0"
+	.string	"3"
+	.string	"\037\320.\267\013h\227\006\355\227\207\033\373\021\226\212W\314\356\316\250q\360\n\372\007\271f\305B]3\013\273k]\261.\356x\333\007\266\025l\307\002\317vw\035[\366]\177\026\325\252\352k\031\225\026\203\222]\213X\200\205\311\224\216\215\355\253}\217\177\200w\235\036\260\33329\331\r\023\214\260]:\f\033\fUD\331\356\376z\330vU\035\237d\3423i\227\032\t\\\fq\021\323\266\273\035?\244\024\261q\\\372'\355\3621\242\300"
+	.string	"p\2454f\207(\215\031v\241\217\310C\372D\334\346\017G\302\3230\3728\320\374\274P\211\363@S\304y\034\346\307\373&\247\300\335(\344MR\327ys\023\356\263\215-3\254\300R\221\302\032\315\2425:\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayTxBytesFree.17.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\375\t"
+	.string	"\366\222D;0\345(\035\236\013\371\017&\023[8\030\362\330\274\322\031X\364\310\177HQO\332\334\326L\377\365\361\032\214\306l\0245\3753\"\"\031\300\340qS\264\362\005\nye\b\341\266r\247\0243"
+	.string	"1"
+	.string	"3"
+	.string	"(\247\342\354\270\320d0\255\223"
+	.string	"\273\263\033\270\201v\031_\240]*\307S\217)\377%\317\204d"
+	.string	"p\275T\217\333\303\356:\272^\030\267\336v\202m\006\373\233\321\232\211\216\032}ncq\341\304\354Z\314\004l\213\\\001\261\215\2625\266c\264\037;\t\352\363t\202]\330\213\312\356\\\260\002w\351\311\331\366E>\022\252\352\240\301R\225m\357)\020(\024\"\223r\374\335D\202\333e5\370\262R\310}\\\372'\355\362z\340\021[\305\231=UQ7\354gVa\336>\177)\003\241\317\310S\nG\036\347O\307\344\211 \205\036\250\013\301\320\204\007\202\272\221\347\021u\0370\354:\033\177\244\020\330\225\276\017\3544s\357M\021VZa\325M\337\032 \020\245:\006\020"
+	.ascii	"2\003\302\260\r\273\032\f\366\202\354\224\2568\032\213)\315\325"
+	.ascii	"g,s\rG\231\300\256\032\257\003\023\017\356\032\251VL\302$\003"
+	.text
+	.section	.gnu.lto_displayLayerSupported.18.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"m\f"
+	.string	"f\027UA q\223\016\037^\033\226\2538\314\027\331\032H\016\366o>\200\206O\264*\365\347\320\365Q\215\357\253E[\3247()\326\301B\323\026\t\016\001\322\024\350P8n\201\360\200@\274h~\242\367\336R\246\024D"
+	.string	"B"
+	.string	">"
+	.string	"\fB<\326\036E\204.\272\201\301\304i7V\032\342\332\237\323\324\374"
+	.string	"\333\347\217\342p\207\202\331@\251.A\007\027\033\004l'\356\303$\232q\322SeC\311\004 \262\273\316\224M\303\ro\033\202\355\006\366#\004>\365\300\303\211\206\001\026\273\241\227\034\373\342\251\030a\333cclk<\213\347-\0357`A\242P\b\365w\300e\332'\361\022\236\257X\270\307\356\250\005\212\335\270\300\n\250?\307\177\300?\352\004\340\237m\007j\221\013z\362`B\265'T\310\247\\\235~n\027\027\321\n\367\323\013K\246\260a\372\240\356@\247'\335#\3560\325\200!\003\2248\354\370I\005a\337\355\356ZG\366W~\370\226\3379\255\316\331\325\261H\336\225\321X&\034\rF9\003\322\261HJ8\330H\305\311.\nX6Ri0KB\225\3118\025H\001oJ\256\2542\331l\262\n\023\367:\362Iw\020#C\351\204\372\032\264sG\240\243T\312_\203\252*\001\026"
+	.ascii	"k\b8\327avD\342Y(5\366.B/\260\n\270[\024\036\300\ni\334U\b\314"
+	.ascii	"\\\003\231&8\020>S\243\3402\246\251\211_]]\325 \220\267\252\235"
+	.ascii	"P"
+	.text
+	.section	.gnu.lto_displayLayerSelect.19.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\f\001e\r"
+	.string	"6\332]D\020\221\223\016\033\025\2144\245P"
+	.string	"v<^XD t."
+	.string	"x\361\252\216\303\270\024\252\032X\245\215\255m\3657\334D\310\321\226\342\3112V5\002P@)b\244\214;\315\343\033z\333k\315\232\264\275\267\224)\005J"
+	.string	"H"
+	.string	"J"
+	.string	"\007\342\341\365\002\361\320\266\037x\230|:'\202\345.+(04\273\034\246!~\372\323<\371\250?\230ju0Zl\033\256\217\003\345\006\211"
+	.string	"\233\352)\240A\311\274{\252l'\231\033\220\335u\246l-7\274\355\b\266!\330\307\020v\232\363\227\177s\326\037\235V\230\316\227>"
+	.string	"\t\037hh0\230\261\313Rccg\240L\t\333&\273c[\271\2470\375\245\364\004\254\n\304\212\307u\230\340e\332?q\024\246\263L>`w\025\343b\227s\340\006\327\241\271\007)\036f2(*9p\0326\265(\246N\350d\250\262\206m\ng!\272vU\037\376\212\013\244\222x\230\212 \206+\\E\311\207\017\223i\327\356~\304\241o\022\017\257\357\276\240\245e\202\225\312\032\233C\245\272\330\177\273\273\326\225\003\031\250\344\021\201\240\317\310C\242\215B\227?\035%\217\310\210\026\n\301\264\fd!\224\205`\243\220G\204}2\r\353\3400i\004\224a$$R\206u\270\375[]9\276\350\320\212I\377\024\337\235\200rTUE\r\222\322\223\327\311\215Fu*G\r\004\023"
+	.ascii	"`\204\036\262hp\013e1{\025\325\002\b\244#\304)\023\206R;>5\257"
+	.ascii	"-\201\270k6\320D\f\302gj\024\\\26645\"U5\024]\n\n"
+	.text
+	.section	.gnu.lto_displayLayerCopy.20.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`u\001e\017"
+	.string	"\346\235iF\360\260(\0358\t\342;\305\242'\213\276\262Rpw\212\241\177_\314\366\351(\371\220\336\301:\377Nu\337\024\247:"
+	.string	"\033\344\336\254O\361\246\021\334\232S\342C ]\326\210/^\241\263\201\312\024cI>\331D\312\224\002U"
+	.string	"R"
+	.string	"W"
+	.ascii	"\217\016o@{\334\316\241=\3326\003\220\224U\017C\244\234\245\203"
+	.ascii	"\206\230\316n\330)\210\253\0363M\225\277z\214\254\033\030\030"
+	.ascii	"4\257\r\317:v\227{\265R3\016XMN\200\027\206\314#\247\205\303"
+	.ascii	"cO\224\327I\246Gdw\235\256\227\312\255\3356\004\333\016\354\307"
+	.ascii	"\004,\366\263\335]"
+	.string	"\353\212\355\364\347/\377\366\230\337s\227_sZc:\263\364\271\007\036tj(\240\261\233\262scq\242\013\022\266S6g\307\3144\320\360*R\177Ae\002\266\365\301\005\262=vd\231\366O\034E\352.&\037\260\273b\303b7\\`\217-\351\321M5u\352G\013\270R\340d\320\325[`512e\331\324\243Y\342\231\323\002k\241&i\251\021`f\264\322\206m\t_A\332v[!>\315\005S\211\366\230z@\206)|\246$\304\227\371\300mw?\342\3217\321\036\257\217=\201\312\215\t\027V\356\330\341*5\237\207\002\215x\241\257\202\t\344>\017\005\0329\201\236\b\200\027*\201N`i\2649\364\201\002M \001G\242\016\374<\013\243O\324\225F R\027\372\300\356\003\201M$\336\327\235L\246\257\343\302}\266\272\342\324\333\\{!B\346&}\225\366\330\td\037UE\261\255j\021\226\236D.\033"
+	.ascii	"g\204v\321\302\327l/\"\032\213\030\341\340*\250\276\260E\307"
+	.ascii	"\336]f\r\245`|\n_[,\031\\\023\341&\0240\007\324`0\222\204\270"
+	.ascii	"@\370L\215\202\313\230\246#\032\241\206V\207+\r\262\326\t\005"
+	.text
+	.section	.gnu.lto_displayWriteFontCharacter.21.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`A\001E\016"
+	.string	"&\\cD"
+	.string	"\221(\035`\336\275~-0\250?]h\036\\\\\247\354\320\367X\276\033\270\032\237\266\354L\336\366\255\236\252\344a\304\232E8\022o\235\337\225@\3201\330\357\002\006\230\355\260\272\243\274\372M\200|\262\267\224)\005O"
+	.string	"P"
+	.string	"O"
+	.ascii	"n\240=\372\273\201\354Q{\201\354\321\266\037\200\224l\372W\002"
+	.ascii	"\345*++Xl\367\333\224\304M\207\232&\377t\030Q3\257\0311\254\020"
+	.ascii	"W\350\261\2429!\200\245\202\nb'\231\303\236'\254T\346Fdw\235"
+	.string	"\037X)w\274m\t\266#\330O\021\346\374\345\357\270\313\257\335\365o\234\2060\255\233tf\351\003\2400\"v\203\201\215]\224\232\034\033#\312\240\260]\2629\266\343\213\206\003\235U\275Z \300\357+Jw)\311\316\252R\036@\264\307Nf\332W\361\226\322]&\037\260\333\202\361b\367s\020\232\240\203\236\254\251\352\004\0235+\232\024\361\201`\251\271,\265\302\253\206*q\330\266\360\026\234\266\253\n\361c8`\360\024\001\r\217\234\205\027\342\303\220F\332\356~\345\3217\311\036\257\207}A\312\f\213\013\2255\366wJU\261\017ww\255-\333\031\335\205\217v \220\007\206>\"\017\211'\3424\177>J<\031H\036\007\332\274.\264\201\353@\233\210\363\214l\237\316\333><<\"\205\272\215d4\3526\316\267\207\253-g2X`\\\244o\312\016;\001\345(\324\023\333P-\202\322\024\f\220\035\252\272Q\247r\002\026"
+	.ascii	"l\204N\313\302\213\314\336\243j\003\036\322\261b\231YC)\b\251"
+	.ascii	"a\343)\324m\261\177\270\306tM\210\240D\030IB\\ |\246F\301eKS"
+	.ascii	"#RUC\321\245\240"
+	.text
+	.section	.gnu.lto_displayCheckReady.22.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\f\001M\r"
+	.string	"\266\032^C"
+	.string	"\221(\035`\3563\350c[\017\007\211\210h;\325\275\364\322\277O\371;\227\2742C\030=\255\361\033b\002r\025!\355k\315\374\3249A\t\004\035Iy\0270\3400\254\254\336x\351\321\2204\262\267\224)\005K"
+	.string	"F"
+	.string	"M"
+	.ascii	"\361\003\260\303\354\002\260C\333f\3601r\367\350\001\345*\252"
+	.ascii	"\223\t\327n\324\264\303\273?\315"
+	.string	"\316'\375\301\222K\353\005\n\324\206\353\3538\275\204\340@\231\336\001\027\251\345\254\347\t\312$\023\023\262\273\316\f\250\224\033\336\266\003\333\r\354\217\002\273\273\326\224\355t\346\361\317\276\3721N?M+L\347K_\003\201\305E#\301\214]\224\327\215m\001[D\330\036\331\032\333\232\217\035\201\327\200\241b\361\221i_u\022\243\257J\016`7\245\202e7.\260\202\354\320\001\0315\200AI\316T\365\301\207\327\351%9D\r(\365\007K\215\320\222aJ\033\266%|\345\223\355\232@\374\023\027B$\330aj\201\030\246\360\022$ ~K\304e\273{\020\207~\tvx=\353\bR\\F\254J\371\262#)U\305\376\013\240\r\207\353lX\207\003\332\214p Of\216\207\205\315\004\021\347\021\321\270\255S\301\263\211h \317\346\243q6N\363\350pH\324\331\264\221Ph\3234q\377VS\306\\\244XY\221\177\207\235\365"
+	.string	"\232\321\247'\266\237:\244\244&O\223\252\030uj\021"
+	.ascii	"j\204\316\312\302\203\314\336\236j\003\036\322\261\342\226YC"
+	.ascii	")\030\237\302\327\026K\004\327\304\230\3051\302\035\350[\200"
+	.ascii	"Z\207*u\212Z\265\007"
+	.text
+	.section	.gnu.lto_displayBeginTransaction.23.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"m\f"
+	.string	"f\027UA q\223\016L\206\2046\331W\021\340\323\251Gk(\221CNKH'\326\032\312\035\331;\352\364\310\242\031x\325\004bMY\020\333\364\n\001,\r\007\242\007"
+	.string	"\275\013\253\303\303=\234\336\367'{K\231RA"
+	.string	"A"
+	.string	"A"
+	.ascii	" \323\2415;\307;\020\373\021\f\f#"
+	.string	"\035\273K\351\207k\177\232\232\177\321\001\250p\237\277\r\327\007\302\362\2424\200\333^H\251\205\303E\317\f\\J\346\007\203\335u\252p+7\274\355\006\266\027\330\177\020\017\375\360\245S\323\217\230\0225DV\354jx\351\261$8c\204\355clg\367\024\332]*<\002\273u\b\241 \036&xO\373'\216B{\350\344\005vA4b\354v\"\016\211\207\356n`:\214\0172\324\326\224\nAtcK\036\266M\336\302\212\273\033\211\317\302\202\004\317t\230z\300\206\261\253\360\304\335%\361G\331\204(\342d:\274\302\025\034;B(\371bw\237T\017\366\337\356\256\025d\337\345\237\002X\326\261\336F\303\311d\030\247\212\326\214x2\021:XUBa\327\206Bu\225P\234*cBi.\214\032A`\253\263\271\250\314\262.\n\323\355\337*\310\016L\220P4\345\005\310I\241:\325\002\\\220 ]\320O\226ZX\002\025"
+	.ascii	"3\241\031/\306\326P\022\2637Qm\201T\034q\357\2300\224\332\021"
+	.ascii	"\323\001[\013\241`B0\327\330b\230\027\204\317\324(\270,M\215"
+	.ascii	"\026wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_displayCommitTransaction.24.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"E\013"
+	.string	"\246\225N?\020O5\035\200\025\022\245\206\215\020\342\002\216N\322\316\2408\344\020\271\302\346@\314t\024\253\242\316 \323\245\017\364h#\331\336\020\234\252\252\256\020*"
+	.string	"DI\343\256\334QY\002\350\264\245M\244L)<"
+	.string	"8"
+	.string	"="
+	.string	"n\361\020\303\036\325!\001\365bw3\275p\357\226\246\347\237\343\020\022\030\272U\341jI2F\250\002\200\2375QmX8\307s\0028\312|\034\330]'\t,\335\361\266\021\3306`\277\022\326\356\256\325d\377\364GMg\246\377\210\240PAY\355RX\305\330T4\241!b\373i\237\303;x?\201.`\327\324Ab7\244x\202=:\374\200\353\021\273\344z\264\347%T5lw\256T\005 X|\t\303\366vT\007\333\375,~\210\b\335\347zL%\260\302\r\376\341\203\355\256\305\367\340y\200ex\364A\327\3435\226\\l8\211re\207\241T\r\373\001\032\314\346\342\3516\032fL\005\302e\001\247\3232Y\307i\034h\\&\333h\027\006\031\206\353\262J\001o\034\r\227y\266\215\313\"\341\336Z59A\212\224HG\026$\243:\325"
+	.string	"D\234H}\032J\325FF\020"
+	.ascii	"3\241\025/F\326P\020\263\227\320V\343\2209\306\004\254\324\216"
+	.ascii	"\230\016\3302A\024\214\272\204\325\254F\213\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_displayGetCanvas.25.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\221\001\245\017"
+	.string	"\026^jF\360\260(\035\372\2317\022/\3234\254cn6\371\303\b`f\037\026\354\241\016\245Z\270\255j7&\252\326!S\234j\317\225\035\374\030\237\327+4\003\317\220;\037\362\234\343\024x\341\233\\\353\207u\013\261{\023)S\nY"
+	.string	"O"
+	.string	"Y"
+	.string	"\361\220\373G<\264\355\004\013Zv\375\373\020\273\f\r\n6=\273_\247\036\356:(\302M\323\345\207d\257\203\342v`\003\013\f .:\314\230\220\220\313\360M$kI\335>`P\360\b\220\3016\021\036\032\r\257=_d,\231\240\221\335u\272\310.\334\334m\257l7\260\277\"\351c\177\257T\031\373\333\356\256uf\377\373C\247\375\234\323\321i\350\264\302tn\351\007@\211\351\2611\312\261\033\373\321\261-\240\n\021\266[\266\310\266~\254\002\004\026VcAA\246\375\021'\321:M\345\036\2733\234\024\273\037\002\213p\207\376\016\022\232;j"
+	.string	"dH9u*\324\353\304\264\350+\357S#\307\007\252\314\025\304\316\316\215\255$\246\236C\215O7Qr#\301$B<L5`;u\033\024n\027\306\300/\361\300\343v\367!\016}V<\274\206\304\240\255\344\317\223\207\006&G\255\0229}\355\0365\332\013\307\013\031\260\246\022\212\224\342\241N\234GZ\241H\245\350\322\210E\202p\342\235H:OeZ\235T$\035\352D2\351J*\257\033\2058ubRu)\251\224\252\023}\373mu\346\327\356"
+	.string	"F\205\033\234\355'\356\250\032\365\305vT\217\254(\013h\200K\246\274\213*\324\227\25533\023\213\256\b\003\035"
+	.ascii	"`\204\306\327\302\327m\017j\032\253\n)U\013\203\250\215f\027"
+	.ascii	"D\306\342\214\3350\026c\343\241A\036`\r\224\352\002\026\"]1\f"
+	.ascii	"\213\005\027\032\261\261\021\224\bF\034\240a\276p\337P\005A\310"
+	.ascii	"`\214\252\006RuL("
+	.text
+	.section	.gnu.lto_displayInit.26.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`&\001]\f"
+	.string	"\326\026SA\020Q\234\016H{\355\032\252E\025@\271\255l\207o\354\266\241Mb,5\327\230\002\035W\2076;2\375\277\022\377\265\276\270\247\270!$\240"
+	.string	"\001P\005\036\017n4\240T\315\240\245\272\"$B\366N)="
+	.string	">"
+	.string	"D"
+	.string	"'\260;R\275\330\255\013\254 \373\345z\003\330\257\354\005\260_\026\355\030\257%\366\251\016\034V\254v\227N\022\027/E\377)\016"
+	.string	"\024\352\\F \354\256%(\004\342\236\267\235\300\366\003\373\245\277$#Id\032=2\304\256\0359G\330\267vw=G\366\353o\375\364\317)}-\254\253\031\rd\354~\b\251\261\036\027\307\t\333\327l\313\252\341\300\200\375\240<0\270\264_\272I\374\211\023\016\306\217w\337\240#\fQ\t\344\036fW\270\312\213tl\220@\002\3109\375iM\304gvl[\236\372\262\335\317\304g\261\261\220i\260_\237WG\212\306\311\232vx\025\232lw'>\n\303\005\001\037&8X]\205\302&a\203u\334e\313\204\027/3'\311\260U0\241G\241!\330m<\220B/\336f\241\034\030R\t\002\177\230\016\244\231\357\003\251V\367\326\316\221#\240\360\360\314\r\026'\234\203\013\321b\305a\366v\027\\\030"
+	.ascii	"2\241\365/0.N\322\213\334AG\024\\\016\322\200\274\240\035JiY"
+	.ascii	"\230p\274\220z\255\202{\252<\247\301I\213\273\016a\215k@+\f\r"
+	.ascii	"\n\203a\001*4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_displayLayerSupported.part.0.28.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`o\001}\017"
+	.string	"v\336iF\360\260(\035:\022\260\205\333K\320,\220fE\375}\026~\034)\205\031\032\226\200K\330\372\351\222\242j\377+\336\376\013\304S\2633n\322\357\201M\202\2130sxz\303\211b\276\362M\337\373\230\362%q\357-wJ\001V"
+	.string	"W"
+	.string	"P"
+	.ascii	"O0/\267{\314K\373(\034\342A\265\330v\210'e\325=\021\260\303\330"
+	.ascii	"x\321rv=\356RC\\\365\250P\252|\270\022[=\312\3257\233Q\023"
+	.string	"\353p\215\037\257\034$\006\304\\\221A\316\352\346\265C\226X\013\302\003\227\035#\273\353\315\345\236\267M\301v\004\3738\001?\200\006+\004>\354\302>\034\013B\336\2248\315\355\253@\3715wl\237\006u\232\tNX\226\213\203K\307\331W\244N3\305\002\353\202\201y\266\313\005\361\0363ew\254\360\036\3523'\005\336rh\261B\373).\223\372\314\351\006ve80v=\b\227~\260]\332\013z\350\301\333\020S\215\261]2U\365eV\303\005o\330\026\375E\311\266\353\022\361]\\8Q\231\227\252\247\321\260I\257Q\331vW\304o\201\241\202?\342\322?\315K\250\257\2353\361\235\220a\301\017j\214U>\256\312lCKC\307\t\255\022\032\336{]\350\3641\221!\320\350\223R\032\2116\203@N\037\023\224\222\210\204+u!\013\242\216\204\033\211>'\034\250+q \037&\241\204:.\205D\352\270\316U\346"
+	.string	"\255\357e\243Q\202\f\r5\033\350\253\246T\026\333R=\302\322\2265F\026\253/\026"
+	.string	"\177\323\274Z5*\202\327\027#\203\256\034\033"
+	.ascii	"g\023@\324\361\225,\f\226\031\201\245W\300\031\233\221J\t\246"
+	.ascii	"\232\006\357\001\024.\033cXV\352\254\362\264L\361\276\260\376"
+	.ascii	"\023OCA\310*\b\022B\347\274C;-\324\034V\235\201p5\020H\035ym"
+	.ascii	"\301\003"
+	.text
+	.section	.gnu.lto_displayGetCanvas.part.0.29.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\023\002\335\020"
+	.string	"\026aqF\360\260(\035\356\271Y9\3121\202?B\022{\007\035d\002E\2743\366x\t\261\215mi\207_?{|\243\177\377\243\332\350O\354\257\017P7\221M\244\375\315\3265'\205\230\240\324\312\312l\377\263YB\366&R\246\024]"
+	.string	"V"
+	.string	"c"
+	.string	"\341\304\300\342U\3731\247\301.\343z\2009_nT\314\031\036x\264\201\356\321\341\005\310\307\356\036\362\321\276\t\207\210\274Xl;D\004\346\330\303\017+\207\251!\253\335\2303\374\036\327\303c_\335b\276\316Z&|_;\201\034\035\0303lZ2\\;\276q$sNw\032\356x'\260\265%\013\343\335\276\315}\261\255\036qj\221T\207\244\032\304\251=\251\376D\265\207SwR\315I\265\344\324\3614\377&\325\033\325\372\360\277G\201\331\310e\316\225\035\034\223Cd!\302\366\355\327^\266g\303l\317\233\236f\246\265\315\264>"
+	.string	"L\025\032\013\bV\037\276.\343\372\b\240\006_\341\355\002\317~\034\374\346\324y\326\033\241C\202\326\255\r>\005iD\343\263\034n\273\335pd9\344\356r+q(\224H\321\035\307\225\245\243x\320\315\2512\342\333\260L-\371\030W\001\b\232\356\356e9l\b\2579us\316\021\377\204\204\224\037\342\321w\311G\335\327\256.6\304p\211\241\241\350\216\006%\022\n<Y\241L\335\nd\241@\2224\t\304\005F0Y\231J\276\225\252\3042\251J>\224\t<}$\325\352\003\031\340\224II\365\235\244R\252\317\263\255\337\346\276\370\265w\350\037\223\243\255`{\264&A\331\024\357.\214m\317\306\312\205\232\271\035,Z\233\301[\204V\264\333\013\320~6\264R\206\267\001$ \260\002\2512n\003\227\3120h9\210"
+	.ascii	"\202\243\303\305\346 \220\303\341,\335\236Y\266(\026\315\220"
+	.ascii	"\3611\017\274\226C%\347\307\256\221k\025\337\003\n\213\315\b"
+	.ascii	"\"f|\354\223\333[,\fb9\2213whm\241<\214\352@R\006\256\334\267"
+	.ascii	"\336\352\230\201\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`\216\002\355\t"
+	.string	"\244\r\212\003"
+	.string	""
+	.string	""
+	.string	"\002\034\1773\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \035\1774\003\1775\272\200\202\002\004\1776\005\1777\006\1778\007\1779\b\177:\t\177;\n\177<\013\177=\f\177>\r\177?\016\177@\017\177A\020\177B\021\177C\022\177D\023\177E\024\177F\025\177G\026\177H\027\177I\030\177J\031\177K\032\177L\001\033\177M\377\037"
+	.string	""
+	.string	"\200\200\200\004"
+	.string	"\221\215\300\227\002\001\225\001\004\002u\004\003\004\005\325\001\004\006\007\003\n\032$\004\n\365\006\004\013\325\006\004\f\r\004\016\017\020\003\021"
+	.string	"\323\243\362\362"
+	.string	"\001b\004\022\023\350\314\231\263\001\001\265\001\004\024\265\001\004\025\026\321\231\263\346\027\003\030\001\217\246\246\325"
+	.string	"\001\342\001\004\030\372\321\360\372\031\200\200\200\200\004\001u"
+	.ascii	"3 P\203\f'c\001\022\333AW\271WW\01394\274h\311\371JX%\315\262"
+	.ascii	"\230\t\031\344\3060c _\224\240~G\030\2258M2\324\210\304\333#"
+	.ascii	"\257@\246\351\361\033\277\361\215\337\360\215o\374\206o|\343"
+	.ascii	"7|\343\033\277\341\033\337\370\r\337\370\306o\370F\376l\002\330"
+	.ascii	"\215: \307\270\0324\213\234"
+	.text
+	.section	.gnu.lto_.refs.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5b17b22ebff998a0,"e",@progbits
+	.string	"(\265/\375`2*-\252"
+	.ascii	"\372\006\3659Z NI9\351\216\201\245\325\352\375\270\233*\033\267"
+	.ascii	"\204\3037\247\341\261\344\371\231\264}\341\3463\307\321\246\313"
+	.ascii	"\372\346\261\324\313\223\337\302z\251Q\243(\226\314\016I\344"
+	.ascii	"9H\035(`\2304\3121L\2331w\027\323\350\216\262&\212\002\262:V"
+	.ascii	"\351\371\330\263l\324r\204T\253\233H\231\002\377\002\205\003"
+	.ascii	"\253\003@\332\350\332\362\025\266\022\223D\216\006\n+M^t\221"
+	.ascii	"\265\345*3T\232\234\030\031\243\322c\n\235\213U\030\231\025)"
+	.ascii	"g\272\031\245\262a\223\266<\027\007\267\204\325\226\233\260\234"
+	.ascii	"O\355\211JU[v\302Ox\365\200\241\234\243p\334[\210\353L\317\320"
+	.ascii	"\013\362\325\226\2069\370\032Gz\366\300\207\356\355\261\007\276"
+	.ascii	"\3271\\\r6\302\310\340\230lHC\003\253\262\032\031\"\323z\343"
+	.ascii	"%\276\245\260\262\240\266\347\251\364\274\"}\323\255mK\207\032"
+	.ascii	"\217\266\334\306j0B\256\240\t\265e6\006s\241Ru"
+	.string	"\225j\033R \235%\333\262Zs\022^;\2531\r\033\212+\253\331{\211\314\035\3100w\320\222V\203\370\345\263g\242\364LL\177NCk\222\246\207\243-\243\305\344\025!\316h\313G\030\314\310\007\225\031Fh\330\001\203\255-\2331\240\307R\251\355I\244\\\306Bx\345\"?\017a\"\267@\224wy\357\032\203\022Y\264\025i\313\001s\360Y\356\340\233\341\016\276\203 \345\313\027\370\304^\252\352d\350\205\235\305\376\020D8\335\206{\275\356\275\032\364\021&<\274\332\276\356.\334\"\fJ\006\030{\361\0225\016)\357\330\275k\315\314T\214\267\245\266_2gNR$\265=\n)\003\2716?\241$)YmOB:\200\250+\3021H\337)\037W\346\340K\371\002\243\237\203?\027\255\340\370\005\240]\360\243T*\224-\261\320\205\255\232\337\"\340\347#\315\200\237+\360s\n%\320\374h\f\020X\016\377\317~\316"
+	.string	"\232\331a~[\363\277\003m,\330\230\377R~n\201\316\272\374w\376\374\001\273\274\273\377\034\320\303\253\373\231\254;\034\375\354\373\331\003\277\307\374(\225\377a?k\340bW\242\260P\245\211\210\346\222\237_~6\341g/\206\241k\373\271"
+	.ascii	"?c\200\r0\247\366s\003~\266@\037\300\3035\370/\202c\360\243i"
+	.ascii	"?\253\340\347\024\374\367\243F\236\376(\330\t\314\037'\270\305"
+	.ascii	"\260\201V\300g~\024\304\317#\316\302\317!|\303\217\342@\341\345"
+	.ascii	"G\261~>\3613\t~F\301\177\232\237/`\242\3462?Z\343o\004\374]\363"
+	.ascii	"\363\331\337/\177\247\177\373\376\266?\347\375\214\367\363\330"
+	.ascii	"\317\317\237\257\374\334\374\231\356\347\271\237\343~\206\362"
+	.ascii	"\363\333\317\314\237\335~V\362\363\332\317I~F\3623\332\317e?"
+	.ascii	"\177\375\f\344\347\037?\257?\373\370\271\307\317<~\366\372y\307"
+	.ascii	"\317:~\356\372y\351\347\244\237\271~\016\301\317,\370y\353\277"
+	.ascii	"\331\317Z?{\360s\325\377$\377\253\374l\3633\325\377\f\376\307"
+	.ascii	"\375,\343\347\030?O\375\f\343\347\027?K\375\034\365\263\213\237"
+	.ascii	"\225?C\375\234\374\371\351g\344\317N?7\375\334\342g\246\237Y"
+	.ascii	"\374\254\364\363\360g\027~\276?\267\340g\021\374\337\300\177"
+	.ascii	"\266\377\004\330\333\333\333\373\177 \374-&\370\013 \024l\203"
+	.ascii	"\316\200\032\315\302h\254\370\005m\3558B\205\320 \231;\252\033"
+	.ascii	"L\270\364\326-\275\245!\275\r#z\220\026\317\312\274\206\234\245"
+	.ascii	"\211zpH\320\333{NvkUm\277\356\221\2447\253\266\027!\256[\350"
+	.ascii	"\220\322\234\273\024\r\200\214(\344\220{\002\245[L\271\212\213"
+	.ascii	"Bg\245\355\372\331w]\327y\215\245\263\364\225\326k'\257\215\307"
+	.ascii	"?\336.\232\n\\\023Vc&S\004n`i\366\033\223^\"\203\336\233\314"
+	.ascii	"\273j%m\275$\204\336\305k)\335\344d\034\023q\302j!\340\311u\013"
+	.ascii	"\022\346\222\310'^Wa5\231\341z\215|R\306\264\006\324\032\233"
+	.ascii	"\215\275\335J\3736{J\320\213(\242L\221\242\"\036]w\305d\321z"
+	.ascii	"C\266\275\275Jo\251\322\333\027\351-Tz\333\224\336*\2456V(=\272"
+	.ascii	"\227v@\353R\020\334\272\006^m\2329\303o@EH\272\264\005w\217m"
+	.ascii	"|G\341\322\020\314\201mMf\f\216\207\2145\265\030\"\325\213'm"
+	.ascii	"\327\"\f\3312K\232\0273y\312\f\036=x\314*\211|r\r\334\344g\025"
+	.ascii	"Q\0335\0222\211\344r\321W\235\305\224D>\377&k\032ZH\033\351$"
+	.ascii	"\215\244\315zH\037\351e\023\351\264\006\353\262\016k\264\016"
+	.ascii	"\322c-\326Ex\355\263\356z\353\350\035\267Y\357-\336{\357\260"
+	.ascii	"\215/@PA\030\t\273\321H\"\271\356\030\217\263P\201h\256F\032"
+	.ascii	"j\242.\342\261'\276\333\343,>&2\222\310g\020&\3434f2\255\027"
+	.ascii	"\351\007T#\211|*\265\262)\211\344\362\352/\033Z8\214\256\264"
+	.ascii	"r\024\201\330j$f2\321\334\342\027\321\225\213\250\266\321\242"
+	.ascii	"W$\365\220\006@\306k\277\234\222H\256{\327;\340\357{\3263\364"
+	.ascii	"P\210\240\343-~ay &\346T\367\274w\375\300\346\203\237\024\221"
+	.ascii	"'\214\017\276\032\310\013\033\020\034y\375\343\rdm\352\r\251"
+	.ascii	"m\363\350u\0053\322\210\253\01709\036i\355\243{\314\030\221\324"
+	.ascii	"\025\253RT\231\276\\\346\340c%:\224\036\025J\337{\351\333J\372"
+	.ascii	"\206\222\322d\335\260lO\036vX\357\0332D]k3\264\331\260B\305\220"
+	.ascii	"\330\335\250\361\266\372eY\tsj\3334\030l\002U;\234\264\355\031"
+	.ascii	"\031P\223C\321\266\253d\304\326\270\\\264m*\230\035IA\266dla"
+	.ascii	"Q\341DF\307\330\2214Ec\235q1\202\005\307\213\206\361\236j\251"
+	.ascii	"\333S\017P\336K\354\251\231\274{\2113\314\0350w`uH\331 \363\331"
+	.ascii	"w\222\364-$\345@\t\365bc\206 E\3117TKr\006\363\330\266\237\030"
+	.ascii	"\254\255\334\224Jm\033\351b\024\004\305\255m;\375\220\260\232"
+	.ascii	"\232\332vS\267x\221\233\302v\244[\264H9\347\212\264m\026\275"
+	.ascii	"\304\353\006\315\204\016\201\\\257\230,]Y\260,\323\363\006>\336"
+	.ascii	"\343\r|o\035\351\033F\n\002\322\221o\214,+\357\370>z\332\004"
+	.ascii	"\224IB\332)}'\245_\371\202\241V\221:\357\326\272N\361V\261\004"
+	.ascii	"\017,\250m\2530\266P\321\334\\\262\213o\241\016\362\031Q\022"
+	.ascii	"c\250m\207F\341R\\\357\322\305\211\225\247\261\266ob\372\272"
+	.ascii	"\006\222Y2t\303\251\201\232\370[\242\243\006\026\034TI;gz\263"
+	.ascii	"'Y\364|PuoCmY\217\251\220\f\255m\031\013\203\315 \361@\002\306"
+	.ascii	"\226\236\371\264k\201cB\274s\236\355\256\240\3219i\313u\351T"
+	.ascii	"/\340\340P(\022\370B6k<\225\241O\216B\241\213\223b\204\243-\352"
+	.ascii	"\204\301f\240\204\004\005i\2136YJ\337\336Z\005\n\027\213\351"
+	.ascii	"t>}M\264\032>\332>\rb2Y\214\211\361\312B\215\271\315]qs\303\273"
+	.ascii	"\222\371b\021\305\253\211\022%,6'7CT\245N\207\332\332Z\337Hi"
+	.ascii	".P\234[\363\005m\016\211\024K\362$,\306L\027\225;:\235\\3\303"
+	.ascii	"\2259\004G\212\004\t\213\245\227\203(\235\316\347K\n\272\253"
+	.ascii	"\245\250!(\332\020\364\214\b\021\364l\004fN'W/\331{*\217\034"
+	.ascii	"={1{\0332\244-Z\0045\022\244t\213\214\240f=\200\020-}\240I\\"
+	.ascii	"\226\354rj\373;J\357\273K\305\320 bh\231\357^^\225F\307\313t"
+	.ascii	"\354\360\243dG\313f\2049o\240"
+	.ascii	"`h\330\321\261\217\261^:\274\027\003\037G\247\363y\231\230:\374"
+	.ascii	"\244\302\210>\260\364>\031\351\337\277\357\022\217\367^\244\226"
+	.ascii	"\365\036\2016\234[\230;\3741\214\362\001\376\333{o\326;l\342"
+	.ascii	"u%\315*Bt:\007\367-\314{\213QC\nD\035\025\243\226\214\313\250"
+	.ascii	";,Z\rk\2167jh\\\336[s\213\305\241\t\312[c\\\336\243\213\342\355"
+	.ascii	"\210\357\0325\274E\345\255\271\305K\344\300X\214:2.\211G5\306"
+	.ascii	"e\324\321]F]\232[$\036g(\336c\315]FQ\271K\345\021\215q\251<2"
+	.ascii	".\243\220ld\254bv\004\347%5\306X\306\342-\"B\022\2174L\343\252"
+	.ascii	"\274P\356\345\261\240{<\300\275H\345\021\nq\211\315\200\230E"
+	.ascii	"@B\210J^\357\275\002 \002\222R\336\"\323\250\245\274W\013h\347"
+	.ascii	"\022=`\2702"
+	.string	"/\0253\207/\220w(\350\336\001\020\335;\344\313\274\367\016\357\275\277#r\275\267\211\306xEDt/\223\r\321E\016\215\004\335\333cqfG\306\245\224\022\204\221\260\345\325\025Z\207|u\241D\035\323\345\360\307\035\272\367\262\225\364\352hE\225\216\301\322\342\302JCK\227\240\030\207\334\332Z\202\224\212p\265\355\031nM\261\266(X\216\254\244Q\350\245h\013\253G[\231,\245\251\263!\025\033\366\254\310x(\241d\226g3\354lX=\251\343:\352\254\0333qL\234\242\264]a\232\030Y\245@\271\320\255\326+&\223\2409~m\311\264\346\224\024\325z*>)\265E\263\326\026\026rK8fz^\321\033\274\344\214\336@k\240W\303\237\215+:\344\363\203_\227\016f\221\265G\257P\032\335\202\004\031\270P9\232a\265E\255@\034\265q\201\357\310\264\3361\261$\246%m'\320\362#\265\2279\034\031\355\226"
+	.string	"\265\265@k+\220j\353\f\035TU\353\006#\243\031\312\030_\277\270 \024TS\234\326\022G\003\r8\030\354\206\326u\341\231\275\230\"\207#H\212\2370\306\256\2405\252\215/zFV\312\\\360\230\257\211\351N\205rhf\315G\227\025\224\322\005\255\355\016F\262mp\334\224\235\363)\313>!\241P\201\264\211\221\313kssR\373\355@\"5\326\324H-?\254d\341j\2012\315\340P\362\365\242\345,,\017\310\322\0063+\013\242\027,\224X\271$\323j\213&\305x\245-i\301J\317^w\315\"\313\311\264\334\253\304\202\022\241(X\216\2312(\340\205\327l\270!\275+\224\b\005\312k\242D-\005\235!"
+	.string	"6n\034\027zD\215P$\364\b]\201\026\361\212\022u\217\243)P\025\037|\340\262\302\007\227\023\031{\213\227\006\337\361@\302\207\007(\f~PuL\364\344\370\360|"
+	.string	"\006M|\b\200\360FM\001O\320\327\323c\302\307\347\307\347w\342\007\270#\374\361\371\225"
+	.string	"G\355\261*\320D\t\353\243\366"
+	.string	"\205A\237\220\307'\005\0216%\210hA"
+	.string	"*\250\300\302\n(\244@\200\026Zp!\004Bu\203\216\372B0\205\236\236\n\254 \363\002\016\020f\204\t5\"h.\220\3017"
+	.string	"\301\203\020\210S\302\203\n\032<\207\007\250\372\250$\322?`\204\006\214\020\002\005\277\207 \001\004\022@\360=\004\t @\2200\002\210\364#\200@\205\302\357x\320\t\376\b"
+	.string	"G\210\243c\205\337\361\220s\223"
+	.string	"\024j8\234h\021\356\220\340Qw|;B\035\236\026\204>*\fj\217\005tx\200$hL\340\303\323S\202\tj\320\204L\f>5\207'\006U\307\027<\361\003\264\301\236\237\034\033\002\027\202?%lO\217\211\023\324\240\211\030\035\365w\342g\005\340O\020h\"\307\305'\3641\361#\302\345;\033\374\247\204\n\374 \374\371\001~\200\t\336\314\004qb\360\301\021!TI\270\004o\324\236\027pX"
+	.string	"\301\005/\340"
+	.string	"IX5\210\243\366\250\300\037\020G\355\311\201\031\361\242\246\200g\204\217\252\002s\202/@\234\235\034K\302\207\007(\034\001#\274\t\361s\t\006U \211\037`\007|R"
+	.string	"\252%\b\362` \304Q_\020\002q\324\035\227\0238@\035\025\350\323Qs|d\030\021\344I\2057!8@U\201'\004U\241\f%\240@\b\243\243\n\201?%J\230\220\021\346\250=\352\b\030\365F\005"
+	.string	"\310P\342G\004P\225\001\247\307Ex3\002\b\241\017\217\2114x\243\023\374\221\001\252\302\034\034 \316\216\b\241\317\317\t\252\220\007x\002"
+	.ascii	"=??%\334\264\310\240\203\243\256`\202\034u'\347E\275)\301\201"
+	.ascii	"\001\370\360\220P_\240\021\006o\204\300\237\016\304\034\004\b"
+	.ascii	"\021\034|`\003\027Hs<\310\200\323S\"\310\243\363!\bTc\340\001"
+	.ascii	"\352|\360\341\301\201\341C\0160\370\301\203\006>?<\302\034\234"
+	.ascii	"\240\017\016\220\005!\017\f0\374\344\324T\241g\277<\241*GK\205"
+	.ascii	"\226mH\242v\224\2632\254\224\231\221\217\260\266v\252-\f\033"
+	.ascii	"\343v\352\253\2352@\336LSY\222\033>\373\025\267-VX)\264J\312"
+	.ascii	"\244\034R\221@\332]\216\265\34752u\210\031\322\324\245l\272\225"
+	.ascii	"\272M\206 \202\215\212)J\213r\266\265PV\311\353\331\254\213\313"
+	.ascii	"\034\021\n\302F$}\013\370l>\373t\213dj;\322t\262\310\337\345"
+	.ascii	"%\013\306r+,}\003R ,\216\216\354\322-S\217\264 &=R\253t\313b"
+	.ascii	"\252\210\371\326\225\3766\211\n\r\026UZ\351_j\f\r\331\243\023"
+	.ascii	"\244Jz\317'\366x{\344\2057t\321\326\0321\330o=\266\330*J^Q\341"
+	.ascii	"(\262D2k5\222Kh\2164H\024&O.l\n\233\242\211\333\330\\\032\261"
+	.ascii	"\355_\214\326h\215\214f\243\326t:\2373\3157(%M\033d\203\270\255"
+	.ascii	"\205\026'\244\023\030nY\262\330\342\007^\246\236\240@Y\240\333"
+	.ascii	"\242\332\2061\251#[m-\221\301l\017)\255d[;d9\231\027F:\360\354"
+	.ascii	"\205\261\343\n\322\262\027\335\203yr\245\b\030\232\025\243\264"
+	.ascii	"\203\212\3052/\217\355F\254N'\027\f\330\035\222c\026\036\036"
+	.string	"\353\245FV\247\363\231\246\304K\207\322\351D\237}\365\013\373\232k\006u\215\345\260;\372d9\232\251\025L\\\210\256\\a\261\032\256\234\346\312\350\366\252Ta\261\265\346\317\312\211\220\221.m6[Ez!\260a\352\313\212\210\033\035]\253\200\300u:\271 \300\204b\00327\327P]Wh\224*2\"\254\270\270\266\222\252jr\\\324\024\255\203\227\250b\371<\307\022\0252C#\"\"I\222\2441\"\013\020\206bI\236\326\322\016\022\200\003A\220c\322\231\231\021\021\021)(HIJ\231\016Ka\001\242\200LI\311\246^\020\314(h\027\257\035\314\327\377k\206\254}^p\343(\364Hn\332\272\336u\200\240\353\272@w\327\230\260\343\357\244\332\376j\300\317;\345\346\353\205\002\232\220J\204\342\313#_\3416\234\377\363\214catbUO\\\251\366\001\316\301\242[\364\331\345\300\363n\034qwJ\245\330\206\221D"
+	.ascii	"\367\311i\275DY\376X`f\223\304\036z\235\373\022Q\260\316A\f%"
+	.ascii	"\213\343\376\336\307n*\364\236\301\203\200IE\340t\024\301\243"
+	.ascii	"\321\352c\201\254\204\201\357\236\324\242\021\252|\360\021\036"
+	.ascii	"a\245\333#\337\177\265\200\365(\021\311\300L*3\031^)\f\222W\237"
+	.ascii	">h\0209u\003\377\321\002\206/\026[\025\210\264X++\3612O;#\034"
+	.ascii	"\007\352\001\235`%A\022)\352Z\205\341?\220O\003\310\215\357\372"
+	.string	"\224\245NA9\177\347\205\371\330/\017\343\0373$\313n\255\247i\"\261\337\031#\271m\231\331\305\342Z\037\212\212X\345\372\316\243*!\253mSJ\177\337\3201"
+	.string	"z\3702[\313%Dm\350yN/\317*\324v\240\017z\320\257\271\275\332\360\031\301xE:@\"\332\006\315\265\213'f\236Dj\t\031o\032\007eO\325\007\364\331u\315\256\307\320\301@(\023\362\236\362\2742\340\b-\352-\244\331\004.\001\366\034\022\311\\\302z\274\0018\246\325\320"
+	.ascii	"0Ms/\003>J\326\"\244\340\310\366\340\214\321X\262\307\317\202"
+	.ascii	"h\303\203\n4I\006<\236a\204H\232\363\265\024\0167\225\0168v\267"
+	.ascii	"\215D\354\217JyM\\9\260\335 \247\222\200\300\3151\251\264BhB"
+	.ascii	"`\377\316:\206\007R\240\252\321\336\220%\217\200){\346"
+	.string	"\b8=\336E\022\332,q\264\022k\233D\305]0+O\t\335\216jBE\342\211x|\005y\262\2632\257\245S|~\033\205\307\022>c\207\272+,y\331\375\365\214ze\341\035\337\224\315\230\242\"}\264\276\362\031\332\260\017\250\345\346\370\t\377\303\226\300\3264\037\337wE\221\332\320c\264k\350\311\234\316\254QG\371u\2300\231\221\364g]\f\277{N\254]Z]\033\252j\313y\247\252\264\017,I[\210&\2074\232V\357\233A\200\002%C\267\353(\020\031\334\nzN}\233\240xs+\330MA\207\320\312\354M@\343u|@\020\327\032;\217\254_\236\246\006l\027d\240\341\245\370\264\024sA\t\177d^\214nQA\2153\222\2505W\244\020`\002B~\303\344\261\326\217\312\313@\030\001\256a;T\3024\022[\346\263\013\241\372\234\312\351~\342H\223\230\344\221'\326\2347\365\305\245\266\2651\2572"
+	.string	"Y\2630\264\332\362\353\372\037 \274q\363\372\034L\355\314';n\032G>"
+	.string	"\360ut\320\020>\303Q8\332AA\030\306\204Z\344\f\316\355\322\t\254\221\277\034$\377\376@\003\260\335\200"
+	.string	"gS\t\272\236\020\007`\013\230\263\301\004>\311\023\226\212\275\370,Z\032\330\222\f\243\\\372\357\005?\032\021\332\354gU\366\357<\257%SD \t\360,\256u`OO\357w\007\260\b\310@\034\2709\275gai\351\374\333\t\333\322\016\366\016S9\352H\250\177\022\211\205X\303\244\001\231\206\204P\2075\001'\2170!\f\210\360\245fq\257\233\204\332\362\004\332\365\034}Q2T\225'\3005\220[\354IW\272\025\274\371\003\0334\366\220Q8\366_:\300\371\316!\337\367@0\260 r\017\332\207j\202i"
+	.string	"\206\303\317k,3\216\250\n\237\321\267t(Yla%G?\241\217\254pv\264\003U\255x6F\240\3166\321\201\313\245\220\326\036\310\225H\304\302C\005\023\301q\005q;\022\260S7B5@$\027\227/t\331!\241\024\024G\326\r^1j\304\272a\031\371\034I6<\356`\205 \302\244\204\240\357\306\002b>\026\226\370\265\253\377\220\276Ew\277\276\037\037\266\266\341\236\"\334\373c\376:\202no\177'\321E\377(\177E\314\001\\H\006\033\033\341\223\304\004\343\372A\300\035\351\2141\353\033\003\200\030!p3+\343\211\177\023"
+	.ascii	"4\234\332\na\205d\033\205?\350\243\2163\360\322Y\353?\333\031"
+	.ascii	"T\251\243\324\343\250\204\261\001r\021\312\205\2114\312k\032"
+	.ascii	"\030X/z\367\316^`WuO&\b\211_iQ\314[\243.\255g\234\315\353B\245"
+	.ascii	"\017\nt5&\365\022l\001\002\242o\271@Y\245\0231\220\036];\371"
+	.ascii	"g\261\256\201?\325\202\356\002r\367R\3628\234\345$\357\020<\r"
+	.ascii	"\263\352\377\2103Wc\n\237\344\353\022g\270\025\254\2460:Z<`\363"
+	.ascii	"\2361@\322\233s\027\021\223\207_\024|\3625\3064)\203*\201e\020"
+	.ascii	"<\306D`\336\337\205d\222\253\365/M\002\311['\247@i\321\006\243"
+	.ascii	"\213\345B\363\357\247-\310$/\300\375G\343\271\002\n\2152\273"
+	.ascii	"\006\260\334@\0235\376\325\223\032)\271\365\203\300A\215R\273"
+	.ascii	"\304\312-\231\322\t]\003\242\220*\207rI\234v\372-\262\034-\324"
+	.ascii	"\253`\361*F\2307#\251\335\r\324 \026\262\2057\211QE\247\334\304"
+	.ascii	"\260H\316\251Lf\345<s>V\036\323\256\237\345\\UO\031\320\237\344"
+	.ascii	"<\334\201\204!\274>z\370\\\316\033\261\253\0271\374\023\026&"
+	.ascii	"bw\247\312\215*\3165~\255m\036\344\341,\232\377\212\216\303\347"
+	.ascii	"\354\270\316_q'fy\031[\274\032\350\215b\363F\345Af\3562{\232"
+	.ascii	"\033+\375\312\024\002\353\236\361\211\215\027\273\221a\276\234"
+	.ascii	"Q\375.\247\027|\275<\374{\2341\300\254R\032{m\372\277'\264\265"
+	.ascii	"Iu\023\346Y\371\336\376\370\247\033\304y\215~\034}\230N\317\320"
+	.ascii	"\323\255\233\370e\322,\322\253\341\3746x\263\372\\)&\312\220"
+	.ascii	"\037\376 \025F\024\334\300\266\357\270\307L\267\206\247# \323"
+	.ascii	"|\275\003\345\204\267\037\002\005c\206'q\035\273\216\217\261"
+	.ascii	"\363\345M\363\3700;T\314\017`\360\237\362-9\373\326\030\360\361"
+	.ascii	"\2356\322]\001\343.|\237\356]\372\205>\241\271\211~\373\366\370"
+	.ascii	"32\210R\345tXy\375n\334M\3732\337\335\036\302\354\306\245#V\272"
+	.ascii	".\004\016\275\336\020\337\321}\003\342\212\333<\2679\302\253"
+	.ascii	"\262\366\032\226\217\207\335\211\377\331wY|\f\373\203~\3103\310"
+	.ascii	"w\037:.0e+"
+	.text
+	.section	.gnu.lto_.symtab.5b17b22ebff998a0,"e",@progbits
+	.string	"displayClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"displayDrawScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"displayScreenSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"displayGrab"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"displayRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"displayReleaseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"displayIsGrabbed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"displaySetXY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"displayIsTransferInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"displayIsSynced"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"displayRedraw"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"displayTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"displayLayerSupported"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"displayLayerSelect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"displayLayerCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"displayWriteFontCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"displayCheckReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"displayBeginTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"displayCommitTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"displayGetCanvas"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5b17b22ebff998a0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
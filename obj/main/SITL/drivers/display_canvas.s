@@ -0,0 +1,1415 @@
+	.file	"display_canvas.c"
+	.section	.gnu.lto_.profile.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375 O\345\001"
+	.string	"\362\004\016\024\020\313\233\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\377\377\025V\224\207\025-J\001\017\r\013\t\007\005\003\001\277\336.w\253\315b\257\326*u*\215B\237\316&s\251L\"\037\215\305\210O\004"
+	.text
+	.section	.gnu.lto_.icf.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`.\001\335\n"
+	.string	"\024\022\"\002"
+	.string	"$"
+	.string	"\352\271\232\313\017\004\002"
+	.ascii	"\002\001\002\002\002\003\001\262\205\215\361\002\367\325\367"
+	.ascii	"\345\013\003\367"
+	.string	"\234\214\330\001\006\004\212\305\356\250\r\004\002\003\005\376\302\325\271\b\005\002\003\006\200\351\346\271\n\004\006\002\003\007\236\330\337\233\001\b\337\326\307\256\016\007\002\003\t\375\202\372\230\f\b\002\003\n\230\223\336\264\003\002\002\003\013\330\372\305\271\r\t\002\003\f\354\343\327\310\n\r\375\226\244\213\013\n\002\003\016\370\211\277\330\013\002\003\017\341\276\345\225\t\f\002\003\020\237\224\253\371\007\r\002\003\021\267\364\304\347\f\016\002\003\022\231\346\321\205\006\006\002\003\023\240\224\244\267\t\024\276\311\252\363\r\017\002\003\025\204\230\313\301\004\026\241\260\374\376\016\027\235\345\355\366\n\t\002\003\030\224\367\360\253\001\031\252\262\270\321\016\032\327\266\232\235\b\033\302\323\225\255\007\034\274\307\250\275\004\035\354\253\232\245\b\n\002\003\036\321\327\253\352\001\020\002\003\037\205\331\361\317\002\021\002\003 \340\334\355\332\006!\216\205\262\371\004\022\002\003\"\227\251\255\331\016\n\002\003#\256\362\220\232"
+	.string	"% \340\345\006\233\2173J9\343\2143\212RJ)\245\224rF)E9\243\2243\3168\343\214\223\271Q\312\031g\234q`\024Y\347\242q\314\024\r\200\230(\245\334\254"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`*\005\035\b"
+	.string	"\262F\026\034`O\322\001\3040\f\3030\f\303\300'\343\362\211&\032\245\037\326\221\354\275\311\336I\006\035\363\245,\025\243\344\363Dr\021\310=\034\327`,n\321\362T$\fq\330d\035\347\366p4\024~\302\340>A"
+	.string	"P)m\303[\273-4:d\2054\327'\347\324\226\325\325L\361\tN\250\300P\0252\255\001\300\002\031\241\243<\022\340\0210\f\016AXI"
+	.ascii	"\241\220\020!d\004F\210\260p\"\013&r\034\bW\211\257\n\272$\370"
+	.ascii	"\266\212\226\260\261\224\020\"\221D]\225\277\244\227m\251\037"
+	.ascii	"\367\272\355\303\344\370q5\320gz\361\323\003YqX\334M\332\200"
+	.ascii	"\375\322?\253\t\300\317\3353;\340yf\f\355Q.KX\027\257\325Q\263"
+	.ascii	"\303\374\362\331q\235F\257\216\016T0\244\021\257\232g\216\335"
+	.ascii	" :B\304T6\244\033\262\bF\354&\004L\363m\021\335eiX\311\364\345"
+	.ascii	"\260\r\005\320\334\251F\263\227I\340\327\002"
+	.text
+	.section	.gnu.lto_.inline.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\355\n-\013"
+	.string	"\342L-1pk\322\030\374_#\202p*\361B\200D\354}\360\251\n\315\273\002\252\337"
+	.string	"D\001U\r\360\\\377\377\377\2335\262\215\250[#j\215\020B\266\2242\005/($ \354\301\032\024\020\f\b\004"
+	.string	"h2\230\035\214\376\214\244\003\213\034\326\327\305\222VV;\b\375\230\210j\304\254S]\2714W);\230\177\325 b\326\231\236P\317\177I\027\357=T\236$\031\221\242\035\334\337\002Qd\034\213\311PT\301\301\"(?_4S\033\265!1\003\241v\002#\303C\363j\356\340\016\352o=\355\2666h\256\353F\177\263\357\275\007\265\337W\363<\035T\002\213\033\3243<}\004J\250\361l#Eu\n\313\236\001\360\242\221\240\250\036\022\300P@\004@\222&"
+	.ascii	"\031\002\206\340\212\240!\374\016\201b\2405?\347\234\267\211"
+	.ascii	"E4\255\343\023\232\2224\247\203\013\334\022\267\\`\325\360\261"
+	.ascii	"\241M~\264\307\264\241\022\270\004=\217HL\032nM1\372\364.\244"
+	.ascii	"-\263v\312q;m\177\005\224\233P\357q)\f\217|:P\340\214\271\303"
+	.ascii	"\354R{\034G{`<\207\212~b\274\022\320\304\344T\321\327\251\205"
+	.ascii	"\246\210\356\030\374\206\247\030\027\341\001\317\211\226\336"
+	.ascii	"X\360\360\023\313\177\246\216?\250)\023jT\240\224\002\374l8\230"
+	.ascii	"\375\254*)p\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`4\n\235\f"
+	.string	"\242\f(*\2007I\0073\n\023\262\ns \003\263\244LHgD\246\241"
+	.ascii	"D"
+	.string	"\204\213\201a\277\277\3556\213\030\375\350\373\321o\215l\262\323\016\266\240\2205\213$d\026!\253(\274\310r`P\020\201@\017\345x\234\254\262x\210~i0\b\242\001LE\210\022PE\005t;\316\344\225&\255\005\335\215\353d\221\275\357\364\001\212\254\025\023\217\212VL\342\001\340@,Y\305\341OJ\272\242\025\341<w\364\217*k\317\270~7\177\226\276\224\356\2545k\255\265]4\353\241\304F\311\266\025\321\271\277\231?c0\246!d\250Q]w\243Ba\3317\240\002\021\231*\333\006\022\240\262\034B\301,\002q\020B\210\b\211\022\"\341DP\024\021\224#&\342\003\335p\177\035\267\002#S\230\213\236\0230&\246e\274\216#F\031\340\201\374\225\222xQ\276P\371\207\013\032u\203\250n\270\216r <\242\372q\225\201\235}g\214\311%\201\243\004d\233+\360.\b\323\246myQ\376\373\370}\250\035@]"
+	.string	"\236\303A\210\231I\344{4\323\017*86:x\254\235\227\026\335wwY'\257E\240\216\n\333\301\361\271w\205f%EC)\324\263\231A"
+	.ascii	"D\210\021\234\235/n\032*\244b 0d\310\351\233a\314-\210\352\304"
+	.ascii	"\272\263\201\017\213G\225\003\340[(%\203O\254\242T\312\204\004"
+	.ascii	"!\262\317\226\226<\035\t\224\013\206\006\335\341\322\262u\200"
+	.ascii	"t@\"m.\022\245\344\317\324\252\357\036"
+	.text
+	.section	.gnu.lto_.pureconst.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375 q\235\002"
+	.string	"\022\307\023\034\200\3310\00630W\314\300\f\3147\002\370\007\376\201?\326u]\327u][\326\266\f\336p\206/\\\341\tG\370\301\r^p\202\017\\\340\001\007\370\346\232g\216\371\345\226WN\371\344\222G\016\371\343\2167\316\370\342\272\342\211#~\216\273{\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\326\003M\005"
+	.string	"T\005\312\004"
+	.string	"$"
+	.string	"\002\002\034"
+	.string	"\001\002\003"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\300"
+	.string	"\300"
+	.string	"\002\035"
+	.string	"\001\002\036\001"
+	.string	"\002\003\004\037\005 \006!\007\b\"\t#\n\036\013$\f\r%\016&\017'\020(\021)\022!\023\024*\025\026\027$\030\031\032\033\034\035%\036+\037, !-\"%#"
+	.ascii	"; \360\2251C\260\263\f\023\373\006\303\304\036\306\254\304\316"
+	.ascii	"f\243\2147\262Q\306a\314\226\361\006\213\211}\203ab\017cV\260"
+	.ascii	"\263\f\023{1f\005;\233\r\301\3162L\354a\314J\354l6\004;\3130"
+	.ascii	"\261\2071[\306\313#\227t-\022\212\021Z\341\335"
+	.text
+	.section	.gnu.lto_.lto.108dab12fffd1ee1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayCanvasSetStrokeColor.3.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"}\f"
+	.string	"\026WTB\020q\233\016\030\216"
+	.string	"}\260S"
+	.string	"\344G\017\034_4m\023\300\240E`\r\240\353\326Pj\n\t\221\351\001cc\202f$\304x\3626\022*"
+	.string	"\210OG"
+	.string	"\037\307\035(\031\361z\272o\343\323 {K\231RA"
+	.string	"@"
+	.string	"A"
+	.string	"\3243\323\2437\273F\002\023\001*8\254\330\330\335JK|;\324\334\374\217~9\351@\207 \2560\023zQ\"\320q\260A)E\304G\317\016]I&"
+	.string	"\b\273\353<\351>\334\361\266)\330\236`\277B\237.\372#L\247\246O]X\016\260\330\365\320\222cIQ\006\212\355cl\347\367\025\333U4\300\002\313\215@\211@=.\200O\373(\236b\273h\344\006v=\0320v?\007~@=\372;\202\3511)\241\030jlJ\2750\232\301%\016\333\036w\201Q\273\334\306o\261\001\303gzLU`\302\332Y>\324\356n\374\225\220\f\324\211\221\351\361\252\361n\210H\262\305\376@\251$\354\303\335]\253g_\345\001\031\326\201]Q\302"
+	.string	"_\032\315\022\371\260.\013\037\253\003D\363p*-\353\210x2N\365\341\261<\252+\323*\r\003c \235\254\n\301\260\254\302|{\270\3529\206H$Z\002\003\344\244Q\235\352N\b\222\211\202\262\024\027"
+	.ascii	"4\205\220\232\tgL/\236\r\255\266 f\257\241\332\002)8\342\276"
+	.ascii	"1a(\265\243\245\003\254\026\342\300\204U\256\001\3050\032\b\237"
+	.ascii	"\251QpY\232\032=\356\360TMN\321\324\036"
+	.text
+	.section	.gnu.lto_displayCanvasSetFillColor.4.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"}\f"
+	.string	"\026WTB\020q\233\016\030\002@9\362)"
+	.string	"\362ct\305\020Q\255\323\315\f\345H\\\263\323\236\034\254*(\320\353\001cc\202f$\344\336\367\357$(\002\210OG"
+	.string	"\037\307\035(\031\361z\272o\331)\222\275\245L)A"
+	.string	"@"
+	.string	"A"
+	.ascii	"\325/\324\2439\033G\002\023"
+	.string	"\00128\254\344\330]KI\234;\324\344\374\223\016\340\304\003\035\202\270\302\013J\f\023\001\257\203\rL\242\020'=;x%\231\036\020v\327y\342}\270\343mS\260=\301~\205\247>\372#L\247\246_YP\0348\355z8\355\330R\254q\302\366-\266\363{\013\356*\032`\201\355D\230\210P=.\200O\373+\316\202\373h\344\006vC6f\354~\016\374\240z\364w\004\324c\"\024\032\352\214J\275@\272\321\245\016\333\236\303\310\252\335.\343\277\330\200\341C=\246*(\341\355.>\325\356f\374\225\220\fU\312\b\365x\305\244\250\030\221\344\311\376@\251#\354\303\335]k\310\276\312\003Z\326\311\260(a\2001\314v\211|\\\230\205\317\325\001\3318\032k\3236\"\034Mc}p.\217\205i\233\205a\340\fd\243Y!Y\246Y\226o\017WC\216)J$Z\002\003$\245Q\235\352\215\250d\242\2404\005\027"
+	.ascii	"4\205\220\232\tgL/\236\r\255\266 f\257\241\332\002)8\342\276"
+	.ascii	"1a(\265\243\245\003\254\026\342\300\204U\256\001\3050\032\b\237"
+	.ascii	"\251QpY\232\032=\356\360TMN\321\324\036"
+	.text
+	.section	.gnu.lto_displayCanvasSetStrokeAndFillColor.5.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\304\001\325\017"
+	.string	"F]gE\360\220*\035x\253\230\207\352H\230\257\202\337C\265D\240uv\323\307\356\366\231r^\247%\235\252\027\320V\205\b\246T!\f\216h\316{'\007\236\201./\316\013\007\221\241\362\305\034k\367Q\013\301\335\310\336[\246\024S"
+	.string	"O"
+	.string	"S"
+	.ascii	"\322\257\213l\227\363!\333\245I\266\016\003\251\217\033\033\\"
+	.ascii	"x\354n\007I\234t\315&#T\222\377\330\001\250V\245k\n|\003q\251"
+	.ascii	"A\226\322\030`\025\3420\206\260f5\001+T\\Pk\021\361\330\225\303"
+	.ascii	"\352\244\252!\331]\253j\345\341\236\267\375\331\206`\253\003"
+	.ascii	"\236\207\375\362\256?J\265F\365?@`Dv\354v\230\351\2614Y\203\305"
+	.ascii	"\366}\227\313Fo\341\003(R\354.wi\217l\356\362\234m}\235\005\351"
+	.ascii	"0\fq\300\242F\270\034\314\313\004\361j_\305W\220\356R9\201\335"
+	.ascii	"\226\f\215\335\027\0037\230\0171g\315j'\"\247\022Fh\205\366\274"
+	.ascii	"\320R\260\244\265\026\326\0134hS(!\206\003\2452\266)|\006\232"
+	.ascii	"\273\250\021?F\006/e\273T\210\240\204+\034F\312\334\335\021\377"
+	.ascii	"\205(4M\250l\227\207\033\226\030\227Ig\354\327I\341\212\375\270"
+	.ascii	"\273k\330\262\245\006\237g\342u\344\003\020w6!\216\350\204\323"
+	.ascii	"\2110\342\230\240\204>%]\350\363\210>_Iw\362\341\200\272\316"
+	.ascii	"\027\3526\n\354\241x\276\316\202\347}\035\3672=.lI\0334\023<"
+	.ascii	"i\354\271\240W\371\261\223\244`i\233\320\236\017\316\001s\001"
+	.ascii	"#\341\212\214\317\313<\3413<\341eWW+' \220\002\021B\355d!\244"
+	.ascii	"(\341\230\351\210\f\203\321\312B\340+\001\327\266\013\327$\205"
+	.ascii	"7F\t)R\273\347\343\320\003p\305\270\255\244`\304\375\2630\224"
+	.ascii	";Z\037\260o\210\245\035\226\373\201@\321\304O\243\375\314Q.K"
+	.ascii	";\243\005/\207M\266\205+*\316,\316-F\215kA\001"
+	.text
+	.section	.gnu.lto_displayCanvasSetColorInversion.6.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\265\f"
+	.string	"\346\027WC"
+	.string	"\2216\035;<\001\266\330\210bM\016\377]L\214\326\234c\255a["
+	.string	"Y)\"\221;X5D\246\310=\332`\254\350\333\345B\232y\\U}]\246\272\2573\227z\347\201w\211\177\314\221,\331[\312\224\002C"
+	.string	"B"
+	.string	"E"
+	.string	"\324cu\017\352\321\235\375r\300\004@\215\023\0266v\327R\023\357\0165;\377*\357@\361B\207\"\256\320c\344\342$\300\023A\006\247\024\022Wy~\360J23\021v\327\211\342\205\270\343mS\260]\301\276\205\376\367gn\372)MkL'L\277c"
+	.string	"\213\201\226]\02018\326%\306Ha\373\032\333\232\266\003\b\335\277\016\377\020\214Z\224fHx\332/]Ew\323\310\t\354\222^^\354~\r\374\240z\364\367\002\001:B\306I\216<\245\214`\250=T*\206\025\032\242\274a;\303[<\325\256\350\303g\361\240\211P\217\251\tNx\303W\210T\273\373\341\257l\\\205b\204z\274nJ0&\222\214\261\277Pj\t\373pw\327Jr\035,d\303@\237\254\232\020\300\234\rw\201>\027\347\002\207K\003\b\227u,n\303@\331\326\261>\331\345\2618\033gm\026X\003\3016+D\3236K\363\355\341*\311\021\306\205DK\240&U)u\252\025\230h\310\031U\r\025"
+	.ascii	"4\205\220\232\tgL[\336F\021\2666f/N\265\001\017\341X\361\307"
+	.ascii	"\254\241\024\214\226\"`\232\211y\260+]\003\246\3020\270\033\240"
+	.ascii	"\254\214kx*!\247\024j\017"
+	.text
+	.section	.gnu.lto_displayCanvasSetPixel.7.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`A\001\345\r"
+	.string	"F\031\\D\020\221\223\016\033\002@\025\212^B\034\302\252e&\033M4\020G\270!\370Q(\323\350\312\211^\213\277\341}\272\321\021dAh\345\030i\r"
+	.string	"\200\202mt"
+	.string	"q\307\374\003\245!|R\361\241\360\267%{K\231RG"
+	.string	"H"
+	.string	"F"
+	.string	"\320\335\013\\\207\361!\327\2419;\307\001\r =b^\350\330]LI\234\373\323\344\374\337\374C\306D\372\373p}!48,\001\246\322[\300\252\t\361\233'\007\023Lf\307\301\356:eL\035nx\333\022lO\260\177\n\377u\324\017a:_\372"
+	.string	"\030\2400\320\332\235i\361\330\025\244q\302\366=\266U5b\001!5S\222\335[p\267q\2157`K\"6\344\354\256\210\037\304\303\004\357i_\305WpG\271\234\300\356\311F\316n'\342\006\361\0013\324\242+\265\202\013\034\245\334a\333\302e\210\342n\211\304\307\311\220\265\\\207\251\bJ\370\302c\264\304\335%\361a\254l\321\204\313ux\2057R)P/\331\262;R\352\b\373ow\327z\262\257\372\343S\177\3476\001Z\206\222\201\340\350\030^\022\300\240\221\355\303\222\362\001Q\030}PT\266\220\t\266i',!\315\004K\t}D\030H\333\260\021\005\316TN4l%\3134\314\323\355\337\352\311\021@\254^\024\346y2jG/\205\352T\203\250<\254b\224\224\254\032\232\035"
+	.ascii	"4\205\220\232\tgLC\236\215\257\266,fo\244\032\003\2518\342n2"
+	.ascii	"a(\265#\246\003:6\004\245\t\341]c{\314x^U\373z\005\r\303\001"
+	.ascii	"\311\200\223\240xJ0\0260\f\232HSX\3065<\225\220S\n\265\007"
+	.text
+	.section	.gnu.lto_displayCanvasSetPixelToStrokeColor.8.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\033\001-\r"
+	.string	"VXXC \221\222\016\234nP\340\216\214\025\205\313\350\332\262\177\224\320\340+o|_\206\002\311]b\305\265hm\303\235\320p>dF\234\226\277\r\001\001H%\317\200p\330\304.d\n\214:,\353\033i{o)S\nC"
+	.string	"F"
+	.string	"B"
+	.string	"\207\324?\342\2417\373\306\273\022\373\031\016\032J9v\267R\022\337\37647\377\245{\\D\241\277\017\327\367\361\"\3434@\304\275\005\247\030\020/=7\210Z2;\rv\327\351\"\362p\303\333\216`\373\201}.\244\037\276tj\372\236\230\342\346"
+	.string	"\216\335\0169;\326\004i\234\260}\017\233\006f$\273\267\330.\343\032\217\300r\"B\330\354.\210\035P\207\t\336\323\376\212\263\330NZy\201\335\021\216\315n\007b\006\324\241\273\033\210\001\276b\352\204\031\033\\\342\3306y\214\213\332\345D|\030\030*h\3610\025\201\tg\177\241Q\273+\342\327\244X\240`V\342\341\025\336\324\350 \261d\216\335\205RG\330\177\273\273\326\221}\232\277s\231?>\332/|D\200?!\231\245rb}$h\026\005\224\fDReX\211\n\b#\251N@\226I\365\301\262*D\201/\224\022\254J\271.\254\362\350\366oud\b*L,\332\362"
+	.string	"dG\243Bu\252\003\270@a\312\240\241<\305\274\314\320\032"
+	.string	"4\205\220\232\tgL;\236\215\256\266(fo\243Z"
+	.ascii	"\201q\204Xd\302PjGL\007\374-\204\224\ta]c\007\314p\300\b\310"
+	.ascii	"\027t\230\022B\004b\200+\322\324\024q\227\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_displayCanvasSetPixelToFillColor.9.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\033\001-\r"
+	.string	"VXXC \221\222\016\214\n;r\305\306\004\306q\361K\255\342\177r*\247\344|+\006?P\372\304<F\022\331\206;\241\341|\310\2148-\177\033\002\002\220J\236\001\341\260\211]\310D\236p\036\2666\322\366\336R\246\024C"
+	.string	"E"
+	.string	"C"
+	.ascii	"\207\324A\342"
+	.string	"\2417[\307\273\022\373\231\020\032J8\273[)\211o\177\232\233\377\322=/\242\320\237\207\353\003\201\241q\032 \342\336\202S\314\207\227\236\033D.\231\235\006\273\353|\021u\270\341mG\260\375\300>\027\244\037\276tj\372\236hss`\307.\207\234\036k\2026)l\377\303\2469A\222\335]l\2271\216G`9\021 jv7\304\016\250\303\004\357i\177\305Yl'\261\274\300\356\b\247f\267\0131\003\352\320\335\r\304\276b\352\204\231\034\\\362\260}\362\031\027\265\313\215\37020T\320\342a*\002\023\316\036C\243vw\304\207\241b\201B\301\022\017\257\360\246\206\nRK\346\330](u\204\375\267\273k\035\331\247\371;\227\371\343\003\332/\234D\200?\"\231\265\202b}$h\026\205\224\fTRe\230\311\n\b+\251P@\326I\365\301\262JD\201\257\024\023\254R\271.\254\372\350\366oud\b7L-\352\362"
+	.string	"dG\243Bu\252\003\274ha\312\240\241<\305\300\330\320\032"
+	.string	"4\205\220\232\tgL;\236\215\256\266(fo\243Z"
+	.ascii	"\201q\204Xd\302PjGL\007\374-\204\224\ta]c\007\314p\300\b\310"
+	.ascii	"\027t\230\022B\004b\200+\322\324\024q\227\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_displayCanvasSetStrokeWidth.10.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\245\f"
+	.string	"\206\027VB\020s\223\016\230\037\370t\361\240\272\230\241\303!\242\346\247j\002\250\371\375?r\310\b,/\227#D\r\255\315\351\210\240\203\024\266u\244\341&"
+	.string	""
+	.string	"\353i\340\340 \3209\306E\214\304@\306H\335{K\231RA"
+	.string	"A"
+	.string	"A"
+	.string	"\233x\350\314\356qN\305\276c\001\002\006\310\356R\232\342\331\237f\346\277{"
+	.string	"\226-\364G\342\3726-4J\0056\3559(\271\224x\367\f\261\255d\002\210\260\273N\226m\304\ro\333\202\355\t\366/\004\037\375\360\245S\323\237\242\017\231\004:vE\314\fY\022\274\341\302\3665\266\223{\214\354/\r\236\201\325N\230\2200\035.xO\373/\016#\373(\345\007vE<j\354r\017\fa:4w\004\361pz6\324VL\315\320\355\320R\210m\223\317\260\246]m\304\227\341a\003(\036\246*Xa\3541\240iwG|\030\024\016S\213\224xx\20528\202\214Tr\306\346B\251(\354\277\335]\253\310\376\313\037\003\035\216U\037OE\201\2009\"X\365\361T\034\f\240J\303\t\326!\241\260\253\344\323\271H(O\2472\2418\027F\2110\260uRrQ(\226uQ\032n\377VE\256\360\203\244\242+O@F\205\352T\017\210\311A\372\240\241,\271\264\004\026"
+	.ascii	"R3\341\214i\306\263\261\325\226\304\354MT[ \025G\334;&\f\245"
+	.ascii	"v\304t\300\326B(\230\020\3145\266\030\346\005\34135\n.KS\243"
+	.ascii	"\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_displayCanvasSetLineOutlineType.11.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"\335\f"
+	.string	"\326WWC q\223\016s\204H\345fF\223\310St\345O?J\303"
+	.string	"J\224\271\007\320b \"\361\340F\324\320\f|\3607\21055\265jz\013\002\b\260\324\350J:\001\\@`\004N\016\353\036'\177\357-eJ\001C"
+	.string	"B"
+	.string	"C"
+	.string	"\3255\361\320\234}\343\235\211\275iE\007\227\034\273ki\211s\177\232\234\177\323\001\250\214B\177!\256O\263\002\003E`$z\fP,\"nzz\030\245d~<\330]\247\312\b\304\ro{\202m\n\366-\004-\177|\351\207/\235\232~\025{\304 \250\261\373!\305cOpF\n\333\317\330\316\356.\270\267hx\005V4\002\006Bu\250\340=\355\263x\013\356\245\223\033\330%\341\210\261\3335\260\203\352\320\335\017\304\303\032J\024\313\212\fu\026S1\230l\210R\207m\222\303d\325\256(\304\177\261!\003(\036\246&8\341\355/\240jwC|\227OI\205\342$\036^a\f\r\025%\224L\331](\225\204\375\267\273k%\331\017\230\007T\001\353pF>%Y&\302"
+	.string	"o@\266\313\244sm.\200\256\021\317\306\021\2616\r3\341h\"V\207s\221X\033m\263@\0268\363`\232\365\3112\315\312t\373\267J\262\204\324\tES^\200\214\n\325\251\026\360\262\343\304!\027"
+	.ascii	"4\205\220\232\tgL3\236\215\255\266$fo\242\332\002\2518\342\336"
+	.ascii	"1a(\265#\246\003\266\026B\301\204`\256\261\3050/\b\237\251Qp"
+	.ascii	"Y\232\032-\356\362TMN\321\324\036"
+	.text
+	.section	.gnu.lto_displayCanvasSetLineOutlineColor.12.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\335\f"
+	.string	"\346WWC\020\221\223\016\030>\241R\361\352\203\"0r\fp\375D\035\030\302\215\252\237\246\034\326\215\330\373\033\337\342\321\360\0205\310b\rS\271\246a\003"
+	.string	"\221\325\200\001\243\251\210\001e%*\210\265"
+	.string	"|b\311\336R\246\024B"
+	.string	"C"
+	.string	"C"
+	.string	"\326=\252Cs\266\214w\"\366'\230\013/2\273{i\210s\177\232\234\377\3237VF\241\277\r\327\347AZ\221\0220\022=\005)\026\016?=1\214T25\rv\327\2712\322p\303\333\026\261\375\300>\204.\177u\323\017_:5}K\323!\306\300\213\335\f35\026\005]\224\260}\016\333\331\375\004w\027\no\300\212>\2648\260\016\021\274\247\375\226\233\340nB9\201\335\222\f\213\335n\201\031X\207\356^\240:\f\032\312\024\013\251\205:V\251\022N1DI\3036\311a\242\265+\002\361UT\230"
+	.string	"\252\016S\017\214\360v\024 kwA\374\227\217\211E\002\245:\274\302\030\0303L)9cw\241T\020\366\337\356\256\265d?Z\354\304\020\216'\353|LbGH"
+	.string	"o>6\354\304\203m\"\200\260N\311\226\215\\\233\3069\311\264\221\313\223a$\327F\333\256\217\004\216%\034\355\372\304\250]\034\335\376\255\226,\342\001\225\242*\017@V\n\325\251\356HABY\b\027"
+	.ascii	"4\205\220\232\tgL3\236\215\255\266$fo\242\332\002\2518\342\336"
+	.ascii	"1a(\265#\246\003\266\026B\301\204`\256\261\3050/\b\237\251Qp"
+	.ascii	"Y\232\032-\356\362TMN\321\324\036"
+	.text
+	.section	.gnu.lto_displayCanvasClipToRect.13.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`j\001\375\r"
+	.string	"\206\031\\D"
+	.string	"\261&\035@\346j\013\027\237\346\302\374\021js\265\363\321\245MW7\266u9\376\231\337f!\333\250\033B\245\007\037!\003S\271\025\030\313\322\377K\200\fu\2359%\365\016\323>k\023\206l[\262\267\224)\005F"
+	.string	"I"
+	.string	"E"
+	.string	"\335\t\\\207\361\035\327\2419\233\306;\227\275\f\f\f*l\354.\246!\316\375ir\376k\3769\241J\177\034\256\257#e\323\n\2002\275\004-\030\017\257yf@\261dz\026\354\256\363\204\332p\303\333\026\261\355\300>+\327U?|\351\324\364A\236\0229\005X\273\032vt\026\007\272x\261}\220\275z\021\241qi0\223\n\311\356)\270\307\370\305\023\260\246\017\247\233\335\3650\203xx\340=\355\2378\n\356*\225\017\330m\211q\263\333yXA<t\nAF\206)o\330.9+\213\273&\020\237\305\205\t\244\3530\325\200\bo\267!\305\335\005\361W\240P\210#T\256\303+\314\231AB\265\222;vWJ\005a\377\355\356Z[\354\257\376\317i\376\370\231\337\363\230?\021^\341\244[x\b"
+	.ascii	"\213>\266P\212IH\364\200\024\222p\262\215F\260M#I\031i#\230\311"
+	.ascii	"(T\202\211\264\r\373@\340\354\204D\303P\262L\303@\335\336\004"
+	.ascii	"\316\212\262<\216\374hT\217^\n\325\251\376\252\206\316v\320R"
+	.ascii	"\266`R-\324\331\225\001! \320\002\221\301\331\001$BHIBa\321\303"
+	.ascii	"<\0226A\202fX\306\3220\013\214\023bVa\250v\304\374\200\"\205"
+	.ascii	"\360n!\024\336\210=c\232+3\203,\217c0A^\216\005FQ\330m\0335\221"
+	.ascii	"v\260\b-O\0139\245\030{"
+	.text
+	.section	.gnu.lto_displayCanvasClearRect.14.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`j\001\r\016"
+	.string	"\206\231\\D"
+	.string	"\261&\035xd\001\t\027\237d4*\331|\340=\027\037\335$\2419\364?\351\341cbtl\327\305\330\020*=\370\b\031\230\312\255\300X\226\376_\002d\250\353\314)\251w\234\300\222\227Z\265\233\220\275\245L)G"
+	.string	"J"
+	.string	"E"
+	.string	"\335\013X\207\361\037\326\2419;\307;\022\373\232\033\031X\354\330]LG\234\373\323\344\374\343\034\364\2022\375y\270\276\217\230\234\225"
+	.string	"\324\351)X\315|8\316s\003\312%\363b\260\273\316\027T\207\033\3366\211\355\007\366u\002\326S?|\351\324\364C\327\214\036\003-v9\374\364X\036\030\003\205\355\207l\325\t\222\033\020\016l`F\262\373\n\3564\226\361\006\354)\204\206\235\335\005q\203x\210\340=\355\247\270\n\356)\226\023\330\225\261\261\263\333\201xA<t\032\241\006\307)}l\237\\'\213\273'\021\377\005\006\n%\3530\365@\to\317)\305\335\025\361]\250T\210&X\254\303+\354\321\301#\325\222?vgJ\025a\377\355\356Ze\354\253~\320o\376x\233\377:\315\037\022n\341\245_\370H"
+	.string	"\217B6\321\n\212h\004\241$\232\220\262\221J\260M3Y!i%\030\nIt\202\215\264\r\013I\340,\305D\303T\262L\303B\335\236\006O\213\272<"
+	.ascii	"\t\322\250\227Z\n\325\251\276\312\247\306\302\250)W310\324\231"
+	.ascii	"\225\001! \320\002\221\301\331\001$BHIBa\321\303<\0226A\202f"
+	.ascii	"X\306\3220\013\214\023bVa\250v\304\374\200\"\205\360n!\024\336"
+	.ascii	"\210=c\232+3\203,\217c0A^\216\005FQ\330m\0335\221v\260\b-O\013"
+	.ascii	"9\245\030{"
+	.text
+	.section	.gnu.lto_displayCanvasResetDrawingState.15.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"u\013"
+	.string	"\226\025O?\020O5\035\200\f|"
+	.string	"q\245\275\252\367C\320\3307\302T\200p\263O\243 ^\220m\367\022(t\351\003x\264\221lW\234\037\002"
+	.string	"\200\n\246:\266\237\035 =\002E6(\351\266\264\311\226)\005<"
+	.string	"9"
+	.string	"="
+	.string	"v}\334\260O\271(\250\\\354\356&5\034<&\025\364\217\272C$~\216a\270\304 #\023\255"
+	.string	"b\210\035h\2312\034u\255 \206T\033\223\335\265\212\304\013\367\274\355\005\266'\366#\001\330\356\256%\311\376\351\237R\255\252~\243\301\202E\340\265k\341\225\261\253\231\302\303\303\366\325>\210\207"
+	.string	"\177\362\\\300.\311ubwD\340\004\332\247\307\017\310>\265C\262O\203\016(\244,\331\326d*\033\244T\204\372\302vw\225F\333\r%>\211\t_'\373TY\200\203!|DG\333]\211/b\023A\353\360\351{\262\317\313\311\312\370p\002\351\313\036?*K\366\003\037\307\301p\n"
+	.string	"\230\022\3718\016\206\2430\220\3009\310|\227\312\366y\026\316\305\253l\230\013\367`\243x\337\0261\340.c\361\266M\327y\333c\334\267X\201d\bs\350\224Vi\214\022+V\241\374h\3134\n\022"
+	.ascii	"R3\241L\2130<\263\260h\033\024b\226\025\332j\0342\307\230\200"
+	.ascii	"\225\332\021\323\001[&\210\202Q\227\260\232\325hq\227\247jr\212"
+	.ascii	"\246\366"
+	.text
+	.section	.gnu.lto_displayCanvasDrawCharacter.16.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\207\0015\017"
+	.string	"\006\\dF"
+	.string	"\261&\035_\320\0201\351\370\332\rvj\263\353-xL\266\211k\215m=~\367+\314\366s@\333\261!Tz\241Q\362e\030\024z\214e\351\357\214\330\ru}C^\352\235v\234\375^\351[#\226\220-eJ\001M"
+	.string	"R"
+	.string	"M"
+	.string	"\273!\210\017p\327\034^\300v\215;i\273f\320\216\361Pf_c\303%\305\214\335\3554\304\301GM\320\277\316C/\256\325#\3145\222bV\310"
+	.string	"\270Z\261\200l\246\303u\236\027\\\254L\020\202\335u\276\2704\334\332m/\260\355\300>\214\231\326-\235Z\372\035\"\230\236\017\031\273\031f5\226GsA\302\3669l\307\034\n?\fT\374\006<\216*G\333b\225P\300]\033\345I\233\215\207\221\f\217\002<\215_\304\321\266>`\210\355.\210\023p\327\006\304\247}\023?\001\036\306\362"
+	.ascii	"\273/\237X31;j\223-\025B\215O+i\330>}\307\204\333m\211\3701\013"
+	.ascii	"'*\372!\302\336[\250p\273+\342\263\370&p#X\266kW\255g\366\003"
+	.ascii	"k\311\231\035\256RA\330\217\273\273\326\227\375\234_t\233?t\232"
+	.ascii	"\237;\316\017:\354\337\002\251\024\224\027\277\b&U\275\302G<"
+	.ascii	"l\nI\225VPJ\246\007\252\222\004T\352D\322\245\276\222\225\323"
+	.ascii	"G\322\241\234J'\235\351Ku!\004\354\241J\276.\305\363\276\216"
+	.ascii	"#\334\307\325\227\033l\340iQV\354H\221\252\206\224\323M\235\352"
+	.ascii	"\270\034te\220\252\032\220\271q\271\221\262\" p\002\221Ix\003"
+	.ascii	"\364BH}\302\331t\3476\230m\215\334{Es|\305\354\035\366\032* "
+	.ascii	"\240\261\201-\334\251\354\352o\033\0227\342\321\241O\025\242"
+	.ascii	"_\006\034Q8`\373i\217\256\277\310sd\026:\242\0347cpEZ\237\"^"
+	.ascii	"\23679E3{"
+	.text
+	.section	.gnu.lto_displayCanvasDrawCharacterMask.17.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\261\001\335\017"
+	.string	"6\035hF"
+	.string	"\221(\035;_\302\026K#\377\213\343\367\017\022\246\030\245\206Y\f\206bDM\255\002\243\024\346b\254\350#\035z\341\021\026#\222m\t\375hi\267zl2\370W7b\247\025\221j\376_M\265O\032\331[\356\224\002Q"
+	.string	"W"
+	.string	"Q"
+	.string	"\273-\033\331n\310\341\004\333\247\303\013\320>\267\213\264O\203\266\315C\327\036\206C\n\f\215\335\345T\304\301K\215\240\177\232wTV\250\313\017W)b\305f"
+	.ascii	"V*y`\366\002q\232\307\r\253T\214\034\005\273\353\250\262\362"
+	.ascii	"p\317\333n`;\202\035?\001\260_\213\321\312\211\216Z\364A\036"
+	.ascii	"\0230\f\314\330\355pcc_\314\232\022\266\377\261=c\027VX \310"
+	.ascii	"\031\f6\016T<\006\274\314)\206V\225ja\260}\206\342E\332\213\353"
+	.ascii	"#\206G\001\336\305"
+	.string	".dhU!X\262\335\345\360\202\355\223\200|\264\337\362\023\340a'\017\020)7\342\354\305b\241.iQ'\244\220\241\2125lSx\213\322\266\253\362\360k4X\370t\300\b\217\\\366m\273\353\341\257\360\272\215\304\211\366y\2351bX`(\361\306\016QQW\354\313\335]k\313~\354\377|\346\367\374\345\357\334\345\337.\363s\036_\211\251\223^'\322\221\246W\201\244\247g\370\007\310\244\216odB2\"I8\215DL_\t\204\373\274\020\223\222\007\302\221\224F#\034\311\373\270\216\002\356L!\036W\322u\036\367\t\367r\265\345\007\257\027(\232\222\240\370Q\217\252vtSM\035\325rY\2122GU\021\270n\002& \220\002\221\301\354dBHY\302\261\351\0176\034\332*\2657\227\366\376\212\265\367\332\326P\002!\207\rlq\353\322\256\217d\203\343\217Hnh\013\027\020<\254 N\n\321.\003\036Q>"
+	.ascii	"\373iF\327]\34493\013\214(\306\355\030_\221\226\247\b.O\233\234"
+	.ascii	"\242\235="
+	.text
+	.section	.gnu.lto_displayCanvasDrawString.18.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`k\001\225\016"
+	.string	"\266Z`E\360\260(\0358\fM\216\244]\325\306F\352j\211\227m\217\\\256w\242\261|7\240cl\333\321\207o\240:\004\245\241?dfk\254\224zy\"\273\261\322\353@\217\363$kt\034Y\206:n\317\223F\366\2262\245J"
+	.string	"O"
+	.string	"I"
+	.string	"\f\264G\177/\220=j\377\310\036}\262m\374\033\261\247\001\221\201\006\307\356n\372\362\323\241\346\311\377\353\037\325\nu\330\341\n?X7\261\001\253\024\\\020\203\371\360\327S\303\312%\323\323`w\235\252\025\207;\3366\211\355\b\366Y\004\331]\177\314\322\031\323\007\001\200\311P@cw\303\316\216\325\211.L\330>\3106\264\261p\203DkL\006<6%s\342\301\fk$\277\2538=\306/\240\307\246B\250`\273\013b\007\332#\002\370\264\217\342)Nw\261\234\300n+\006l\367\003q\352\223,u\202L\215T\352\260=z\213\023m7%\342\343`@Q\311\036S\017\2200\367\033\025mwE\374\025\245\nZ\t\226\354\361\032g\340\344p\265\344\216\375\241RE\330\207\273\273\326\226}\233\377\363\232_\373\314\357y\314\037^\211\304A\357\246_\370\210"
+	.ascii	"\213B\274\320JJH$\301\024\242@\362F%\233\327\231\254\214\272"
+	.ascii	"\222-e\024B\331D\235\267\205$0G2\351\266\022\307u\033\350\333"
+	.ascii	"\303\325\226!\344\350\264\250\013\f\220\037\325\324\243\231F"
+	.ascii	"u\252\377z\201\261\036\024\2251\030VN  p\002\221Y\347\001\364"
+	.ascii	"BH}\302\271\351\t6\204\330\312\264\227e\033\023\030\037b\226"
+	.ascii	"a\250w\304\304\200\241\204\320&!\024n\304\235\207\336.\344\270"
+	.ascii	"\f\030\361\016\267\302h\006\206\024\335\005\221)1\0216l\"\315"
+	.ascii	"`\021[\236\204\234R\344="
+	.text
+	.section	.gnu.lto_displayCanvasDrawStringMask.19.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\225\001U\017"
+	.string	"\346\233dF"
+	.string	"\261&\0358_\304\242+^\241<\343\223\301\372\353x?\261\327\272\372\213\177!\323\341\360\237m35\0215\204J\017}C\245\f``\002cY\272[^\342\206\272\316\234\262\265\336p\030\204\241|k\304\222\275\345N)N"
+	.string	"U"
+	.string	"M"
+	.string	"\273\341\210\025d\237\016?"
+	.ascii	"\373\314.\202}\372\263q<\034\261\307)\221\001G\307\356j*\342"
+	.ascii	"\337\245\306\317?\317C1)\324\245\207\253\024Q\261x\005H\2012"
+	.ascii	"\301\213\346\303y\0365\244`b\004-\330]\307\230T\207{\336\366"
+	.ascii	"\211m\b\366s\004\257\371\261\267\376\t\212\216X\364\001\210d"
+	.ascii	"\314@\340\263\313\241\007\217\375\231/fl\377\303\366\334\251"
+	.ascii	" 3\363@\352X\270q\2429'\002!\013\332\260\032\334\2000\211\341"
+	.ascii	"U|\2571\f\031\262`\210\r\256\335\0351\203\354\323\200|\264\317"
+	.ascii	"z\212\357-\227\013\330]\331p\005/\032U\217z\303\242J\260\251"
+	.ascii	"\001\306\035\266'\274g\313v\301\022\337\205\201\202\207}F-@\302"
+	.ascii	"+w\341e\273[\342\2670q\331\t\027\354\363:i\304@\321z\211=\354"
+	.ascii	"\020\025U\306\276\334\335\265\256\354\357\374\242\353\374\241"
+	.ascii	"\347\374\331o~P\236\251\304\311\216S\341H\323\373\351\027n\002"
+	.ascii	"b\022\2117ja\031\221\"\234F*%oC\321\274.\245e\353P4\226m\264"
+	.ascii	"\242\221:O#9`\256\224\322i&\216\353\264\217p/WWv\340\363\363"
+	.ascii	"\2420\022$\2124\244\231\202\024\323\251\216\352\2570\301Z\225"
+	.ascii	"\242b$ \220\002\221Q\326\001dBHY\302\261\351\n6\210\333\332\274"
+	.ascii	"\327F\033\023\030#\304\261\302P\357\210\335\200\262\f\341!\205"
+	.ascii	"\240\370#b\033\332\302\005\004\016#\210M\205\\\227\001F\374\341"
+	.ascii	"V\030}`H\301](2\005\023ec\023i\031\213\320\362D\310)\005\334"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_displayCanvasMoveToPoint.20.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\033\001-\r"
+	.string	"VXXC"
+	.string	"\2614\035\210\020\275\233\265x\260\200\227\257@\371\004\210m\025\353Z\243\355\006\232\353\270\321C\r*\212\246txQQ+\325\023\320\307\264\001\376wj\350\004\200m\214H\223R\375\254\235}\264d\311\336R\246\024B"
+	.string	"F"
+	.string	"C"
+	.ascii	"\217\324?\246Go\266\215{ \366\037\211\f\337\215\335\255\364\303"
+	.ascii	"\267C\315\315"
+	.string	"\377w\217K\027:\344p\205\0370,J\002:\016*(\311\304\374{\276t-\231\035\006\273\353t\3516\334\361\266\037\330v`\237\013\243?\302tj\372\236\016\034\031\t`\354j\310\301YRt1\302\366=l\232\230\221\364~b\373\214_\300\001\313ux\261\331]\0207\240\036\017\300\247\375\0227\261}\264r\002\273\"\0326\273\036\210\027P\217\366^`\n\276\246T\t(jp\211\303\266\311W\\\324.'\342\327\\\240\240M\217\251\006B8\273\n\215\332]\021?EJ\005J\304\312\364x\2153b\334\214X2\307\366B\251\036\354\303\335]\253\310>\315\337\371\314?=\332-|$\200?!\231\245rb}\"h\326\004\224\fDReX\211\n\b#\251N@\226I\365\301\262*\004\201/\224\022\254J\271.\254\362\360\366pUd\b9H,\332\002;\262\243\223Fu\252\001\324\334\2200h(K20-4\032"
+	.string	"4\205\220\232\tgL;\236\215\256\266(fo\243Z"
+	.ascii	"\201q\204Xd\302PjGL\007\374-\204\224\ta]c\007\314p\300\b\310"
+	.ascii	"\027t\230\022B\004b\200+\322\324\024q\227\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_displayCanvasStrokeLineToPoint.21.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\033\001-\r"
+	.string	"VXXC\020\221\232\016\030\002\bb\341yV\355=l\224\330\004\230 ]\320R\342\277\271\036$\205'\210\232\303\030M\257s\007`\254(\365\234\321m\003"
+	.string	""
+	.string	"\225,\006\022\013&\036T\036\201\003O\315\034\265%{K\231RB"
+	.string	"F"
+	.string	"C"
+	.ascii	"\217\324;\246"
+	.string	"Go\266\315\275\227\3757\203\341\253\261\273\225\206\370v\250\271\371\377\316\321\322\201\0169\\aG\210Ei@\307A\217\022\214\313\277g\206\216%\223\263`w\235-\335\206;\336\266\003\333\r\354s\001\243?\302tj\372\034\035\227\030\036-v5\334\334XR|A\302\366;\266\314\213HzG\261=\3060 \201\345>\204jv\367\303\f\250G\004\360i\337\304Ol\037\251\274\300\256\310\246f\327\373\260\002\352\321\336\rL\001\276\246\324\b)hpi\303v\311i.j\227\013\361WX\230\240M\217\251\007D8\373\214F\355n\210\257\002\205\0025Bez\274F\0313J\214V\362\306\366@\251 \354\303\335]\253\310\276\314\317y\314?=\332+\\D\200= \231\225bby h\226\204\223\3543Re\030I\312\007\033\251L>VI\345\301\262\n$\201\257\023\022\254B\271.\254\352x{\270*\362\003\017\244\025e\201"
+	.string	"\222\243\223Fu\252\003\320t ]PP\226`B.4\032"
+	.string	"4\205\220\232\tgL;\236\215\256\266(fo\243Z"
+	.ascii	"\201q\204Xd\302PjGL\007\374-\204\224\ta]c\007\314p\300\b\310"
+	.ascii	"\027t\230\022B\004b\200+\322\324\024q\227\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_displayCanvasStrokeTriangle.22.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\276\001=\017"
+	.string	"\306\233dF\340\262(\035P\013\342\271\357\361.A\264\223\253\025c"
+	.string	"\243\304\002B\001M\t\321\003\235\313j\345x\263\201\352i(\033\306u\024\207\356\270&\301\250\210Hx\206\203\347y$59n\305\250<\004\367\255\344\223\275\245L)M"
+	.string	"R"
+	.string	"M"
+	.string	"\373\221\\\342\036\375}\300\366\310=d{t\313\336\361O\304\376\206\007\303\r\217\335\3554\304[\207\232-\377;\017\305\300\\\207\035\2560DfV\003"
+	.string	"{A\0045\232\231\357<3\300`2A\tv\327\031\003\343p\307\3336\261\035\301N\002\001?w\233\037\364\232\177\273\354\2170\235\232>\310\b\205\r\222\213\335\r??\326'\366\230\260\375\221=\253\001A\007\306\203\034Y\003\234\022&6\036\030\344w\026\255\327x\006\f\260\257\017\032h\273K\262\002\356\321"
+	.ascii	"|\332W\361\025\255\313\\.`7\226\203\266\001\256\254\321\310\304"
+	.ascii	"P\247\266\324\t-p\274\322\207\355\224\313Hq\273\257\022\277\347"
+	.ascii	"B\005o{L-0\302\253\323<nwK|\036\026\013\034\t\227\355\361\032"
+	.ascii	"o\350\350!{\311\037\373s\245\202\260\017ww\2551\373\263\177t"
+	.ascii	"\235_\364\234?t\234%/K\254$\361\222\204\225#^\216\260r\001\210"
+	.ascii	"O\"+S\213\212\351$\3013QXY\241N\272\225\n\245\005\245:\351TP"
+	.ascii	"\246\224\356\244Zu\"\007\234ZAQu,\251\224\252\033}{\270\032\263"
+	.ascii	"\203\024>/\n\003E9R\221\206\224S\220n\032\325\251\376\213\023"
+	.ascii	"4vF\003& \360\002\2219vtBH]\302\271\351Km\030o\253\303^\336\346"
+	.ascii	"X*F\334m\013C\261#\346\003\026%\204\032\031\302\343\0341o\fs"
+	.ascii	"33\b\362:\026\023\362:\006\023\344u,&\344\355Xp\024\205\335\330"
+	.ascii	"`\023i\003\213\330\362\214\220S\212\261\007"
+	.text
+	.section	.gnu.lto_displayCanvasFillTriangle.23.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\276\001-\017"
+	.string	"\306\033dF\360\260(\0358&x\336\301&\037\006dO\357\0250\204 \324\364\2603\216\365`\\\n`\226\023Z\257\201\352\0200\033\210Z(\370%\333vd\013\312\2611\213I\031{4\267\207\243\017\236\022n0[\362\311\336R\246\024M"
+	.string	"Q"
+	.string	"M"
+	.string	"\373\215L\342\036\375}\300\366\310\375c{4\313\276\361O\304\336F\006\006\233\034\273\333i\210\263\0165Y\376u\016zy\265\016;\\\341\007\314\254\006\340\345\202\bj31\327yfx\271d~\022\354\256\363\345\305\341\216\267Mb;\202\235\004\002?\367\232\377s\232\177\273\354\2170\235\232\276\207\350\305\214Q\317\356\206\236\035\313\023wH\330\276\310\236\305\200\2203{\200\023kp#CR\343\201A~G\301:\215]\300"
+	.ascii	"\353\372\240\201\266\273#+\340\036\r\300\247\375\330O\260.c\271"
+	.ascii	"\200]X\r\332\006\255\254\315\300\260P\243\266\324\t)l\270R\207"
+	.ascii	"\355\223\267@q\273\256\021\177\347B\005o{L-0\302\252\323<nwG"
+	.ascii	"\374\025*\0268\031\226\355\361\032i\340(!k\311\036\373k\245\202"
+	.ascii	"\260\017ww\2550\373\263_\364\234?t\234\037\364\233$/I\253\024"
+	.ascii	"\361Rd\225!^\206\254r\201\207M \252\322\nJ\311$\301+QHQ\235J"
+	.ascii	":U\312d\345\224*\351PN\245\223\316\224Ru \007\214J1Iu*(T\252"
+	.ascii	"\023}{\270\n\263\003\030<-\352\002C)\322\220\202\224\323\217"
+	.ascii	"n\032\325\251\276\n\023\261\215\321& \360\002\2219vtBH]\302\271"
+	.ascii	"\351Km\030o\253\303^\336\346X*F\334m\013C\261#\346\003\026%\204"
+	.ascii	"\032\031\302\343\0341o\fs33\b\362:\026\023\362:\006\023\344u"
+	.ascii	",&\344\355Xp\024\205\335\330`\023i\003\213\330\362\214\220S\212"
+	.ascii	"\261\007"
+	.text
+	.section	.gnu.lto_displayCanvasFillStrokeTriangle.24.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\276\001-\017"
+	.string	"\306\033dF\360\260(\0358\030R\327\377rn\2031X\334\226\327\204\320\021\273d\301>5\373\304\311ty\b\327\360iS\340\314\006\242\026\n~\311\266\035\331\202rl\314bR\306\036M\353\205\3637\211\373`\276\225|\262\267\224)\005M"
+	.string	"Q"
+	.string	"M"
+	.ascii	"\373\201\230\304=\372\373\200\355\221\373\307\366h\226M\343_"
+	.ascii	"\210=\315\f\f48v\267S\020g\035j\262\374\337\034\364\362j\035"
+	.ascii	"r\270\302\017\030\232\016\200\227\013\"\320\211\201\375\346\231"
+	.ascii	"\341\345\222\371I\260\273\316\227\327\206;\3366\211\355\bv\022"
+	.ascii	"\b?\367\231\377s\231\177\273\354\2170\235\232\276\207\310F\214"
+	.ascii	"\021\317\256\206\236\035\233\023qJ\330\276\310\246\355@\230\301"
+	.ascii	"x`3kPc\202df\004\203\374\236\202u\031\277\200\001\326\345\001"
+	.ascii	"V\333]\020+\340\036\r\300\247\375\023G\301\272\214\345\002vc"
+	.ascii	"5j\033\255\324\211\201i\241Fm\251\023T\354\270R\207\355\223\273"
+	.ascii	"@q\273\256\021\037\347B\005o{L- \302\252\327<nwG|\026*\0268\022"
+	.ascii	",\333\3435\312\340\311!k\311\036\373k\245~\260\017ww\2551\373"
+	.ascii	"\264_\364\331\037\272\315\017zM$/I\253\024\361Rd\225!^\206\254"
+	.ascii	"r\201\207M#Ui\005\245d\222\340\225(\244\250N%\235*e\262rJ\225"
+	.ascii	"t(\247\322IgJ\251\272\321\001\243RLR\235\n\n\225\352D\337\036"
+	.ascii	"\256\306\354\340FN\213\272\300P\2124\244 \345\364\243\233Fu\252"
+	.ascii	"\277B\326aa\032& \360\002\2219vtBH]\302\271\351Km\030o\253\303"
+	.ascii	"^\336\346X*F\334m\013C\261#\346\003\026%\204\032\031\302\343"
+	.ascii	"\0341o\fs33\b\362:\026\023\362:\006\023\344u,&\344\355Xp\024"
+	.ascii	"\205\335\330`\023i\003\213\330\362\214\220S\212\261\007"
+	.text
+	.section	.gnu.lto_displayCanvasStrokeRect.25.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`j\001\005\016"
+	.string	"\346\031]D"
+	.string	"\261&\035\240\265\257\t\227\026Kr\236\304\262\216\377\377\211\276\020\352\306\266\036\377W\374\"\263\313\273\021-B\245\007\037!\003S\271\025X\304\322\357z\311\277"
+	.string	"\320fL\264;v\\\326e\355\033\261do)S\nG"
+	.string	"J"
+	.string	"H"
+	.string	"\321\337\007\\\217\330;\256G{\266\214\177.\373\031\326\205\031\032\273\233)\210{\207\232\236\177\325=%\323\350p\303\025v\234lV\034&\022<\260\202\351p\325\023\203\211%\263\223`w\235%S\313\035o[\3046\003\3737\001\217\371\257\247\376\b\323\251\351\1778Z^d3v3\264X\233\023Y\274\330\376\307\256y\021\241qY s\n\311\357'\274\307\270\005\f\260$\017%\234\335\365\260\002\354\261"
+	.string	"|\332'\361\022\336S*\027\260\213r\201\263\373y\030\001\366+\324\333\225\372"
+	.string	"E\fR\326\260]\362\233\r\333%\201\370*,H\020]\217\251\004B\270\273\215\b\333]\020?\005\312\004L\204\312\365x\2150Z#R+\331\262\277Q\352\007\373pw\327\212\262_\363{N\363c\227\371;\001\020N\341\242Wx\b"
+	.ascii	"\203>:-\305D\0039\020i\021N\272\320H\326q$)!n$3\ti%\031\210\353"
+	.ascii	"\262\017\003\336NH\270\fe\333\270\354\363\355\341*\312\r4\344"
+	.ascii	"\254(\013\334H\217b\332\321K\243:\325W\231`-\007\035\345\n\346"
+	.ascii	"\024  \320\002\221Az$BHI\302\321\364\304l\b\260\225a/K\033,0"
+	.ascii	"F\210Y\204\241\330\021\253\003\212\022\302\233\204Px#\366\214"
+	.ascii	"i\256\314\f\262<\216\301\004y9\026\210\242l76n\"Mc\021Z\236\026"
+	.ascii	"rJ1\366"
+	.text
+	.section	.gnu.lto_displayCanvasFillRect.26.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`j\001\025\016"
+	.string	"\346\231]E"
+	.string	"\261&\0358\026@\242k}>\360<\211e}{\375\221="
+	.string	"\304\230\236\213\360f\270\265^PGF\335\020*=\370\b\031\230\312\255\300\"\226~\327K\376\005\rm\306D\273c\307e\265\204}#\226\354-eJ\001G"
+	.string	"L"
+	.string	"G"
+	.string	"\321\337\007\\\217\330A\256G{v\216\177\"\366.b0\264\320\261\273\231\206\270w\250\351\371g\035\004\2032\035n\270B\220\031\234\226\bu\202\007Z4\035\316z\306\240^2?\nv\327\t\203\322p\307\333.\261\335\300~N\257\371\257\253\376\b\323\251\351\207D'l$\270\261+\323\323cw\242\f\023\266\037\262oJ\224\254<0\260\221!\311\357+\274\327x\006\f\260\247\017\031tv7\304\013\260\307\002\360i?\305UxW\265\\\300n\252\206\316\356\027b\004\330\0031\324\333\225\n\201\005\216S\362\260\215\362\234\r\333=\215\3700.L(]\217\251\004F\270;N\t\333\335\021\377\305\n\005\214D\313\365x\215<\253\035*\227\354\261?S*\b\373pw\327\232\262\177\363\203\276\372\261\333\374\237\021^\341\245[8\t"
+	.ascii	"\217D:\215%E\033=(i\022T:\222I\326q',$\316$K!i(\331\210\3532"
+	.ascii	"\021\003\336TN\270le\333\270,\364\355\341j\312\016P\354\270\350"
+	.ascii	"\013\374H\220b\372\321K\243:\325g\361\320X\016j\312\026\315L"
+	.ascii	"  \320\002\221Az$BHI\302\321\364\304l\b\260\225a/K\033,0F\210"
+	.ascii	"Y\204\241\330\021\253\003\212\022\302\233\204Px#\366\214i\256"
+	.ascii	"\314\f\262<\216\301\004y9\026\210\242l76n\"Mc\021Z\236\026rJ"
+	.ascii	"1\366"
+	.text
+	.section	.gnu.lto_displayCanvasFillStrokeRect.27.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`j\001\r\016"
+	.string	"\346Y]D"
+	.string	"\261&\0358_r\246\253\356#\022O\314\262\336\377\177\250\372\323 \t\355\031\330\034Zb\276\205\353bl\b\225\036|\204\fL\345V`,K\277k"
+	.string	"\365\"\201tc\242\335\261\343\262.k\337\266%{K\231RG"
+	.string	"K"
+	.string	"G"
+	.string	"\320\335\007\\\207\361 \327\2419\033\307\273\021\373\0262\030X\344\330]LE\234\373\323\344\374\263\036\202I\235\376:\\\037H\214N\353#\205z\007Z42g=3\244^2A\nv\327\t\223\342p\303\333.\261\335\300>O\267\371\257\257~\370\322\251\351\213>V3\022\310\330\335\360\263c} \214\022\266/\262sN\224\340\3140\270\371@\222\335Up\267q\214\027`Q 4\364\354n\210\027\304\303\002\357i\277\346(\270\257Z.`Wu\243g\267\0131\202\370/\324\331\225\na\205\rT\352\260\215r\236,\356\242F\374\235\013\023L\327a*\001\022\336\256c\212\273;\342\273X\241\020gZ\256\303+\244\261cb\345\222?vwJ\ra\377\355\356ZU\366s\376\320q\376\370\233\037\024\021^\341\246[8\t"
+	.ascii	"\223D\266\021K\312\210\364\3004\222\240\262\225L\260M;a)i&XJ"
+	.ascii	"i\204\202\221\264\r\0231\340L\345D\303V\262L\303D\335\376\255"
+	.ascii	"\252\354 \205\217\213\276<\217\fiT\220^\n\325\251>\253F\315z"
+	.ascii	"\320S\266hb\002  \320\002\221Az$BHI\302\321\364\304l\b\260\225"
+	.ascii	"a/K\033,0F\210Y\204\241\330\021\253\003\212\022\302\233\204P"
+	.ascii	"x#\366\214i\256\314\f\262<\216\301\004y9\026\210\242l76n\"Mc"
+	.ascii	"\021Z\236\026rJ1\366"
+	.text
+	.section	.gnu.lto_displayCanvasStrokeEllipseInRect.28.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`j\001\025\016"
+	.string	"\346\231]E"
+	.string	"\261&\0358.\202*{\335<\304\373a\340:'\377\237L\0278gC.\002\374\350\336i\t\327\305\330\020*=\370\b\031\230\312\255\300\"\226~\327K\376\005\tm\306D\273c\307e\265\204}#\226\354-eJ\001G"
+	.string	"K"
+	.string	"H"
+	.string	"\321\337\007\\\217\330A\256G{\266\216\177$\366.d0\264\340\331\335LG\334;\324\364\374\263\016\202A\231\0169\\!H\314MK\204:\301\003\255\031\017g=3\240^2?\nv\327\t\203\332p\307\333.\261\335\300>N\247\371\257\253\376\b\323\251\351\207D4l$\230\261\253\241\247\307\356D\031'l?d\257V%6(\030\324\224 \311\357+\274\323X\007\006\330S\210\0179\273\033\342\005\330c\001\370\264\237\342*\274\253Z.`7\305\223\263\373\205\030\001\3661\324\333\225\n\201\005\216S\362\260\215r\234\r\333=\215\3700.L(]\217\251\004d\334\375\246\204\355\356\210\377b\205\002f\242\345z\274\306\033:;T.\331c\177\246T\021\366\341\356\2565e\177\365\203n\363c\257\371?\001\021^\341\245[8\t"
+	.string	"\217D:\215%E\033=(i\022T:\222I\326q',$\316$K!i(\331\210\3532\021\003\336TN\270le\333\270,\364\355\341j\312\016j\354\270\350\013\374H\220b\372\321K\243:\325g\345"
+	.ascii	"\261\035\324\224\255\231\230  \320\002\221Az$BHI\302\321\364"
+	.ascii	"\304l\b\260\225a/K\033,0F\210Y\204\241\330\021\253\003\212\022"
+	.ascii	"\302\233\204Px#\366\214i\256\314\f\262<\216\301\004y9\026\210"
+	.ascii	"\242l76n\"Mc\021Z\236\026rJ1\366"
+	.text
+	.section	.gnu.lto_displayCanvasFillEllipseInRect.29.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`j\001\005\016"
+	.string	"\346\031]D"
+	.string	"\261&\035"
+	.string	"\023(\244\016\301\317\336y&T\365\376\377#\373\225T7\266\365\370\277\342/\1773\331\250\033B\245\007\037!\003S\271\025X\304\322\357z\311\277\n \335\230hw\354\270\254\226\260a\304\222\275\245L)G"
+	.string	"J"
+	.string	"H"
+	.string	"\321\337\t\\\217\3309\256G{v\353_\313\236E\211\f+l\354n\246\"\356\035jz\376U\367\260\230H\207\035\256\220\343D\303\002\231J\020\001\353\345\303UO\r\246\225\314\316\202\335u\262\2308\334\361\266Cl;\260\277\n\207\371\257\247\376\b\323\251\351\177@73\024\254v7\344\340\254M\204\341b\373\037{&\025\"\343\322 \246\005$\277\247\360\016\343\030P\300\226@\234jv\267\303\f\260G\003\360i\377\304QxO\245|\300.\252U\263\373u8\001\366/\324\333\225\032AE\215R\336\330&\371j\303vK\037\276\013\f\024F\327cj\201\021\356N3\302v\367\303oqR\001#\221r=^#\r\031&R*\231c\177\244\324\020\366\341\356\256\025e\177\346\367\\\346\307\036\363w\002\022n\341\243_8H"
+	.ascii	"\207<:\r\245D\013A\030i\023L:\221H\326q#(\"N$+\021i$Y\210\353"
+	.ascii	"2\217\003\336LF\270\354d\333\270\354\363\355\341*\312\017n\330"
+	.ascii	"\250\350\n\004\220\036\305\264\243\227Fu\252\257j\341\254\007"
+	.ascii	"%%\353\345\024  \320\002\221Az$BHI\302\321\364\304l\b\260\225"
+	.ascii	"a/K\033,0F\210Y\204\241\330\021\253\003\212\022\302\233\204P"
+	.ascii	"x#\366\214i\256\314\f\262<\216\301\004y9\026\210\242l76n\"Mc"
+	.ascii	"\021Z\236\026rJ1\366"
+	.text
+	.section	.gnu.lto_displayCanvasFillStrokeEllipseInRect.30.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`j\001\025\016"
+	.string	"\346\231]E"
+	.string	"\261&\035@\fH\250\243\202\ni8\022\226\360\365\377\207\232%\2419\364oH\303C\200\321\021\256\213\261!Tz\360\02120\225[\201E,\375_|\203\324\201\261\t\301\336\234\bF\206\317\355\2334\262\267\224)\005G"
+	.string	"K"
+	.string	"H"
+	.string	"\321\337\r\\\217\330C\327\243=;\307\277\022\373\232\025\033\\\354\330\335LI\334;\324\364\374\257\376q9\225\016?\\a\b\305j\t8\231\240\202\026\f\210\257\236\034N-\231\236\006\273\353t9y\270\343m\217\330\206`\377&\227\371\257\253\376\b\323\251\351\203\006\274\324`P\263\333aGgs\242\214\024\266\017\262mX#41\017fP\210\344w\026\336e<\003\022X\223\210\0208\273\373a\007\330#\002\370\264\257\3421\336U+/\260\233\322\301\331\375>\274"
+	.string	"{1\324\333\225:\241\005\016S\366\260m\362\233\r\3335\205\37004X ]\217\251\007L\270;\213\204\355n\210\377\"\345\002vb\345z\274F\0337x\250Xr\307\376J\251#\354\303\335]k\312\276\315\3779\315\217}\346\367\004\024\216\341\244g\270H"
+	.ascii	"\213@:M\345D\023I i\025P\272\021I\326q%*#\216$;\031i&\231\210"
+	.ascii	"\3532\220\004\336PJ\270,e\333\270\f\364\355\341j\312\021P9,\332"
+	.ascii	"\002\001\344G1\365\350\245Q\235\352\257t\320\330\027-e\013\006"
+	.ascii	"\025  \320\002\221Az$BHI\302\321\364\304l\b\260\225a/K\033,0"
+	.ascii	"F\210Y\204\241\330\021\253\003\212\022\302\233\204Px#\366\214"
+	.ascii	"i\256\314\f\262<\216\301\004y9\026\210\242l76n\"Mc\021Z\236\026"
+	.ascii	"rJ1\366"
+	.text
+	.section	.gnu.lto_displayCanvasCtmReset.31.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\245\013"
+	.string	"\366\325PA\020Q\234\016\030\002`\253\360c&\360P\322`\353\006\223\2347\303lg\017\350\036;\262\362\2352,\342\206\2400\317\332G\024\333\216I"
+	.string	"\210P\200\214\030:\204\f\252\bT"
+	.string	":k\017\372\264\211\224)\005="
+	.string	":"
+	.string	"?"
+	.string	"\266\215\207\035\366*XX\030\271\261\273\231r\270wK\323\363/\362\311\007H\272\245\341jU@V\250\002\200\237u@u\332p\221\347\005\320#S\202\331]\347\007\230\341\216\267\315\3006\306\276%\276\265\273k5\331G\375Q\323\231\351K\004\204\220\241`\265\213a\225cS\021\006\b\212\355\247}\022/\341\0355\372\200]S\f\027\273!\002'\300\036\035\236\300\365\210\275r=\332\013\252\023\310\013\325\020\333\237+\365\001\n\032_\342\260\275}\344\203\355~\027?E\205Nt=\246\026\360`\t?!\302v\367\342\233"
+	.string	"M\300><\372\243\353\361\032g\324\030\201*\345\312\016I\251!\016\235\026\352h\013"
+	.string	"8c\351\264PG\3138\240\240A\360t\034M\326q\233\020\207\323d\035\216\026!\313p]f1\340\315\263\3412\320\266q\031%\334[\253&7\020\221*\251\2075\311\250NuG\213S\352SR\006\021"
+	.ascii	"R3\341\214i\305\263\221\325\026\304\354%\264\3258d\2161\001+"
+	.ascii	"\265#\246\003\266L\020\005\243.a5\253\321\342.O\325\344\024M"
+	.ascii	"\355\001"
+	.text
+	.section	.gnu.lto_displayCanvasCtmSet.32.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\304\001e\017"
+	.string	"&\334eG\340\262(\035\220\257 n8\037\270\r\364\277;\264B\3169&\026\f\234\226\323\325\224\247\2427\365q\242\026\275\306\331\243\320\231\210\362\365\303\0063\317\032\205\305\252C\366\352#&\003\364\350\3640\376\342\377K>\331[\356\224\002O"
+	.string	"T"
+	.string	"P"
+	.string	"\262\335P\304\243\355\323\341\th\237\333C\264O\253l\035\017K\354_\330\340\340\202\307\356rJ\342\252K\215*\3778\007\265\270V\227 \2562\344%6\003\340j\311\004\263\030\230\343<\272\270X1~\026\354\256c\213\353\303=o\373\201\355\nv,\020\007\235\346\337>\363\177.\363k\207\375SFG\215>H"
+	.string	"\0317\024\354\330\365\360\303\307\356L\235\024\266/\262c<\024njL\250\261\211@\203\002\302L\b\0071<\013\325e\234#\005\254\013\253\203lwE\314`\373< \037\355\253\370\n\325a+\037\260\373\242\0216=\"\026FWq\026\363\002C\rjQ/\264\310\321\212=\266\277\307"
+	.ascii	"\267\335\026\211\257\263!CJ\373\214j\300\204Q\227\245\266\335"
+	.ascii	"%\361sR4l'V\264\317\353\304\301\323\003\306\022\177\330\341*"
+	.ascii	"\352\b\373rw\327\372\262\037\373E\277\371C\257y\336\350\323n"
+	.ascii	"\364\251\347}\332y\237z\335\247]\367i\003\020\227FP$\225\023"
+	.ascii	"R\311B\212\204\001\005e*\341P'\023\025\323\251\204;1\221>\256"
+	.ascii	"tBq#\b\f\242\230\234\270\024\020<q\242p/W_\2260c\207EY2\024E"
+	.ascii	"\032R\220n\372QM\247:\252\037& \360\002\2219vtBH]\302\271\351"
+	.ascii	"Km\030o\253\303^\336\346X*F\334m\013C\261#\346\003\026%\204\032"
+	.ascii	"\031\302\343\0341o\fs33\b\362:\026\023\362:\006\023\344u,&\344"
+	.ascii	"\355Xp\024\205\335\330`\023i\003\213\330\362\214\220S\212\261"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_displayCanvasCtmTranslate.33.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\035\001M\r"
+	.string	"vXYC"
+	.string	"\223\232\016\370M\327\333\005\232/\240r\373\333A-z-\r\251\177#;\tZV\337:KW\256\366\233r\200\207G\360\2024\211G\233q\227v\265{/\220N\216\224\2079\300[\335:\304oK\366\2262\245C"
+	.string	"G"
+	.string	"C"
+	.ascii	"\217\325G\250Gw6\216\1772{\233\033\034J=v\327\322\021\357\016"
+	.ascii	"5;\377\245\203\274"
+	.string	"\210@\207 \256p$\346\305I\200\310\203\nN3!^z\302\210B\231\235\006\273\353|\021}\270\343mK\260\035\301\276\027\244?\302tj\372 \003t\314`\220c\327C\316\2175\305\030&l_\304\256\221\201\220\337Ut\247\361\r$\2600\241\0168\273Kb\007\325#\002\370\264\217\342)\272\223Z^`wT\003g\367#\361\202\352\321\337\rP\001\306\250\324\n+lx\351\303v\312]`\325\256g\342\267\320p\201\243\036S\017\220\260v\026\\\265\273&\276\315\206\241*\321B=^#\r\036'H.\231c\177\240T\021\366\341\356\256ud\277\346\357\234\346\247\036\334\226\031\266|\020\300\236\022\355bQ\271<\024\270\313\302\212\3669\261\264\f\205\345\223\235X*\237+\305\362d\232U\222\300\330\nJfm\030\226Y\"\337\036\256\216<a\207\311EC0$;JiT\247\032\300\215\f\323\006\005\345i&\006\206\006\032"
+	.string	"4\205\220\232\tgL;\236\215\256\266(fo\243Z"
+	.ascii	"\201q\204Xd\302PjGL\007\374-\204\224\ta]c\007\314p\300\b\310"
+	.ascii	"\027t\230\022B\004b\200+\322\324\024q\227\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_displayCanvasCtmScale.34.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\035\001E\r"
+	.string	"v\030YD\360\2226\035\252\302\203\251\321\035\3316(G\301\300\021\351Fg\317"
+	.string	"o\033zf\330|\230\305\370\364\365+\006\220q\b'\310\367\241\340\327\300\271,\326\355\361\004\024L\276\031\3530#\271\345\210F\237\354-eJ\001B"
+	.string	"F"
+	.string	"C"
+	.string	"\217\325E\250Gs6\216\177%\3664<8\224r\354\256\245$\316\035jr\376K\357\210<\320!\210+\024\201\201q\022\340uP\301)&\304K\317\027/\224\311i\260\273N\221\367\341\216\267-\301v\004\373]\244?\302tj\372\235\002\036h0\260\261\333\341\246\307\232\242\f\024\266\037b\317\210\200\220\337Wp\227q\r\034\260/!\221\315\356\216\330A\365\210"
+	.string	">\355\247\270\n\356\244\226\023\330\035\315\260\331\375F\274\240z\364w\003T\306\250\324\n,nt\271\3036\312_`\325nW\342\273\320pa\243\036S\017\230\260\366\026[\265\273%>\315\n\206\352D\013\365x\2155~\350 \271\344\215\375\201RG\330\207\273\273\326\221\375\231\237s\231\237z\233\226\031\264|\020\300\036\022\355bI\271<\024\266\313\202\212\3661\261\264\354\204\345\223\231X)\237\013\305\362d\232E\222\300\230\312If\255`Xf\205|{\270:\362\004\317\344\242!\b\222\034\2454\252S\r\240\306\207i\203\202\362\024\003\023C\003\032"
+	.string	"4\205\220\232\tgL;\236\215\256\266(fo\243Z"
+	.ascii	"\201q\204Xd\302PjGL\007\374-\204\224\ta]c\007\314p\300\b\310"
+	.ascii	"\027t\230\022B\004b\200+\322\324\024q\227\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_displayCanvasCtmRotate.35.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\255\f"
+	.string	"\366\027WC\020q\224\016\030\002@\025B\237\001\310\240G\372\307\037eVR\b7\252\315U..\220\351\236\337\206\032\032\207\267G\020\003]\347 h\230\252^e\226\377\f\360r\314J{\003\032\2166;\234D\262\267\224)\005A"
+	.string	"C"
+	.string	"B"
+	.ascii	"\3271\326\243;\333\306\277\022{\225\322\006\224\033\273\213)"
+	.ascii	"\211"
+	.string	"w\207\232\235\377\324\001\224<\321\241\207+\304\224\270X\021\360H\220\301\312\344\303SO\2237\312\354p\260\273\316\222\327\341\216\267-\3016\004\373\234\2170\235\232\376u \304\214\t2v9\264\344XUdAa\373\027\333\371\235E\367\023\277\200\005\32642\255\354n\306\017\256G\005\360i_\305WtG\215\334\300\356)\306\312\356\227q\203\353\321\337\021X\217\001j\315J\255\220\252AJ\034\266A\256\242]\273\244\215\337\"\303\205\220\365\230\232\300\204\271\247\204\256\335\335\370(\"\030\256\023#\326\3435\322HI\201\"\311\026\373\023\245\216\260\017ww\255'\373'\277u\324\003\333\271\f\364\311\"\fpG\303e\240O\326\341\2042\013!\234\307\003\343\266\017\220g\363\300>\236\f\004\353l\034\246Y`-\344c\303D4m\303.\337\036\256\236LA\204\212DG0@Z\032\325\251\026\300\002B\245AE\2712)\201\021\025"
+	.string	"R3\341\214i\306\263\261\325\226\304\354MT[ \025G\334;&\f\245v\304t"
+	.ascii	"\327B0\230\020\3145\366\030\346\005\002\203+\322\324\024q\227"
+	.ascii	"\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_displayCanvasContextPush.36.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\245\013"
+	.string	"\366\325PA\020Q\234\016\030\216\200\332\t]\306\002\253x\036-\036\214\366\007\325*\330\350\022\3715k(\273\207f\0217\004\205y\326>\242\330vL\002\240(\020\221\352\300%dPE\240\202\232\n\372F\264\211\224)\005="
+	.string	":"
+	.string	"?"
+	.string	"v\214\207\036\366'N\027Bd\354n\246\035\356\335\322\364\374\203|\262\001\222nm\270Z\225\023\212\225"
+	.string	"\360\263\020\254:8\034\344\211\0014eJ0\273\353\334"
+	.string	"5\334\361\266\031\330\306\330\267\004\276\265\273kE\331O\375Q\323\231\351K\bx\264h\300b7\303H\215UE\221\020\024\333O\373\036\377\360\236\032}\300.\352\205\212\3350\201\025`\217\016_\340z\304^\271\036\355\005\253\216\323\nU\016\333\237+\025B\t\030_\322\260\275=\344\203\355~\027\337\204\205Nt=\246\032\370\340\t'!\302v\367\342\217"
+	.string	"Q\300@<\372\243\353\361\032]\244\230\221*\345\210\035\222R9\034\235\026\352h\013\0028c\351\264PG\313<\250\240E\360t\034M\326q\233\020\207\323d\035\216&!\313p]f9\340\315\263\3412\320\266q\031%\334[\253(;\370P\225\324dM2\252S\r@D\204\352SR\006\021"
+	.ascii	"R3\341\214i\305\263\221\325\026\304\354%\264\3258d\2161\001+"
+	.ascii	"\265#\246\003\266L\020\005\243.a5\253\321\342.O\325\344\024M"
+	.ascii	"\355\001"
+	.text
+	.section	.gnu.lto_displayCanvasContextPop.37.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\245\013"
+	.string	"\366\325PA\020Q\234\016\030\002@\025B\217\343\241\332fWh\361`\222\005\264\224\340\343\017\350\036;\262\362\235\b\373\372#(\314\263\366\021\305\266c\022"
+	.string	"E\232\007\252\003\2662A\005\001\r\253l\355A\2376\2212\245="
+	.string	":"
+	.string	"?"
+	.string	"6\215\207 \373\023 \026Fj\354n\246\034\356\335\322\364\374\213\234\322\001\226ni\270Z\026\017\024\253"
+	.string	"\340g\035X\205l\270\310\363\002x\312\234dv\327\331\001f\270\343m/\260\235\261\177\t\276\265\273kE\331O\375Q\323\231\351O\006\270\210\301 \305.\206\222\033\253\212$\037*\266\237\366C\\\204\367\024\351\002vQ0T\354\206\b\234"
+	.string	"{tx\002\327#v\313\365h/\253\020\217\025\252\037\266AW\352\203\0223\276\264a{\373\b\b\333\3750\276\211\n\335\350zL-\320\301\022Nb\204\355.\306\037\021\232\200yx\364I\327\3435\312`\001\"e\312\022;,\245~8\235&\362h\n"
+	.string	"Xs\3514\221G\3238\240\240A\370t\235M\326q\034Q\207\333d\236\216\026!\323p]v1\340\355\303\341\262\320\266qY%\334[\253(7x\2412\351\311\242dT\247\232\203\244\205\352\323R\006\021"
+	.ascii	"R3\341\214i\305\263\221\325\026\304\354%\264\3258d\2161\001+"
+	.ascii	"\265#\246\003\266L\020\005\243.a5\253\321\342.O\325\344\024M"
+	.ascii	"\355\001"
+	.text
+	.section	.gnu.lto_displayCanvasSetStrokeAndFillColor.part.0.40.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\211\001U\017"
+	.string	"\226\334dF"
+	.string	"\261&\035x\272\343i\023\327xa\306y\345\212i\344\322\373SU\364\3508\t\322D1\225\201\304M\025\237av\351|\210\005\f y\fcY\372]\315\370\001\310t#\321\356\272\277\017\366Vv\"\237\354-eJ\001P"
+	.string	"R"
+	.string	"O"
+	.string	"\027\311\036\355\267\260}\262\177\376\231X\032\243\354\237\021\031"
+	.ascii	"98\270x\354\356\366\250%\216:\324\214(\377\257\203\314\250^\016"
+	.ascii	"sF\005\342\nEjvb\001T)\270 \306\022q\330\263\203*&\223\300\343"
+	.ascii	"\307\203\335\265\026\342\316n\233\202\355\t\366u\004\207\255"
+	.ascii	"\\\307\016n\254\3702>\243\345:6\240b\305\356\266\244\377:\331"
+	.ascii	"\241\2205\357:}\253R\030\317A=\206\013\024\260)\022-\b\332c\002"
+	.ascii	"\230\371\357t\034\323\310\267\037h\234i\377\305["
+	.string	"\250\343\230>`w\005\304\263\3731xt\003\355\321\337\013d\217Z9;R\tt\3416J\332n\252\304\357\321\200\301\313\036U\021\2348\314(\347\361\264\335-\361il\340\374\033S\366\230z\330\023\305\r\213\026L\006\245\332X#\\]\331w\375\360#\255Y:\377\375\327~\300\305\256\207\240\036;\"\366\244\260}\177'\035w\302\215b\204\020\217H<\021K\212hT\301Et\242\342\225L6\257#\261\224:\223-\245$B\331F\235\267\221(0\247B\352\266\f\034\327m!\333y\270\272z]\002\016\037\030\215\261\302\220\204z\265\252I,\037\031}\261>c\254\232\032\2526\266K\231\252\205% \200\002\231Cv\244\020Y\233P>\2137\006\212\234k\360\271\321\f\301*tr\215\315\352_\213\247\205\314\337\255H\255\006,\370\023\024\035\016\334\357N\032\253&L\261x\234\310\3558\327\204_@\352\313\214ON\357\360\322"
+	.ascii	"\205\005\251\271\27184\036\367\2567\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`\345\003\325\b"
+	.string	"t\r\341\004"
+	.string	""
+	.string	""
+	.string	"\002(\177.\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \003\177/\272\200\202\002\004\1770\005\1771\006\1772\007\1773\b\1774\t\1775\n\1776\013\1777\f\1778\r\1779\016\177:\017\177;\020\177<\021\177=\022\177>\023\177?\024\177@\025\177A\026\177B\027\177C\030\177D\031\177E\032\177F\033\177G\034\177H\035\177I\036\177J\037\177K \177L!\177M\"\177N#\177O$\177P%\177Q\004"
+	.string	"\321\231\263\346\002\001\225\001\004\001\002\003\003"
+	.string	"\260\346\314\231\001\001\202\006\004\003\003\326\307\302\353"
+	.string	"\001\365\001\004\004\265\001\004\005\006\007\b\t\n\013\f\r\016\265\001\004\017\020\225\001\004\021\022\023\024\025\026\027\030\031\032\033\034\035\036\037 !\"#"
+	.string	"H\250\021\240\005\356\266\322\236\001\340\225\016\0210\004\020\001\301\005EX\361\001}"
+	.string	"(\020\202"
+	.ascii	"\247~H\001\252\352&!\201\351dJ\034\266A\177\233A\223\031&\370"
+	.ascii	"`\006-e\250\232,\340.\232\006d\025"
+	.text
+	.section	.gnu.lto_.refs.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.108dab12fffd1ee1,"e",@progbits
+	.string	"(\265/\375`1,\355\230"
+	.string	"\272\355h4O \024\322I\007\177\315\256\016\335\b\367\277V\227\263\323=\265?\026Z\001!E\254\362\236\035q\023\277\017\337<\274F\243]\315_s\3541\354>\243\235\026"
+	.string	"\200\201\342\210"
+	.ascii	"~\265\206\007\007\274jm\314%p\342\344\032\303^o\243\241\333 "
+	.ascii	"D\312\024\273\002,\003J\003P\266\366\034\326\262\364\252\217"
+	.ascii	"\257X\326\247\f\333;\363\331\310y\345\2055\313z?\n\275\016\233"
+	.ascii	"\345+\237\233\311\201u\243\255Y\316\373\234!"
+	.string	"\333\031^\263l\345s0Q\250\\\355\230\203\212\033\233\322\3549\251e8V\326Qi\252uYWU\316\324\030\303@-\254f\231\n\253\335|\375=)\322,O)2!\361*l\226\245\\Y\313\221\330,G\371[\033\335\263Bl\226\241\374\355\005\315G\234]\263\374\004\210\226\251?\355\317sr7\205fCp4\313r2F\004\253$\233\345%JVZ\004\233\345\270\277\335\270\241\351m\031[\006d\235\242\022\031.\262\"L\315\262\222\342\224\326\226.\315r\033\253\261GQ\352\356\376\306anbH\232\275\r\355\032\313\344\017.\253\331\n0x\225\346^\262{\257\001/\210<\224 6{-\217\361\300\312+I\263L\306GV\246\322\363\256\335+\315\2111K[\2326;\345\266*\261\251f\277B{6rK\3340\233hY6{\017Z\023i\027\203\333\264\357\266/\353\024\273)e\022\305\226u\212;@\t\213B"
+	.string	"\004!\f\340\340\177S\211\t\fz(\261\363\337IN"
+	.string	"\t\376W\371\371\006\325\205"
+	.string	"\036\270\r"
+	.string	"\333"
+	.string	"\0178(j\330\034PDC\200S\206DR\267l\316\222\257X\223dc\216\372\345\277\341\317>\374\320E\237e\"\022\021\211\016\271\374\234\300\317@\2340Q\250\345\347\024?\343x\300\004a\340\317\032\374<\304\006:\203\177?\207\3603\r\026\3415\377\272\367\377\207\257]\346_\2550\001\326\375\337\373y\351|\325)F+\350\370\261\370\331F\013\276\271\237i\370YY\203\003zqMy\354\317J/x8\374\214\324c\347\363s\0203N\363\257hP\267\371W\260\035\250\250\3603\263\213W\320\371\314\277\212\375\215\300\337\006\374m\342\357\022\177\013\360w"
+	.ascii	"\177\003\3607\316\3376\177\323\374-\363w\373w\361o\366\357\376"
+	.ascii	"\373?'\376|\370s\341\317\204?\017\376\234"
+	.string	"\345g\301\237\001\177\256\376\354\3673\337\317z?\347\375\214\367\263\335\317\324\237\237\374L\345g)?C\371Y\356g&?/\3719\356g\270\237\337~v\373Y\311\317I~n\373\031\311\317l?\257\375l\304\317j?\037\371Y\352g\260\377.\374l\342\347\233\237_\370\357\300\177\027?\353\374\\\301\3172~\236\376l\344\347\264\237\321~\226\376|\366\263\331\317e?\223\375<\366s\221\237\305~\216\376L\344\347!?\347\3709\354g!?O\375g\361?\312\377\006\272t\351\322\345o\245\3740A\374\006\260\005U\356\033\003dA\356\213\0365\263\215\266\346\2324\024\347\021\234\205\021\277\330\t\333\235A\223m\304\005\265\352\255\026\003b\306g\314\306\001\\\225.j%\257\253;\322*]\364\250k4\017-\250\005F\230\255\252K_F\354z\203\3439$|\307x\334\307T'\316]\032)\203v\221\261Nc\252Sz\235,"
+	.ascii	"\254\322E\357\225\356\254P\r\330I\202\224\236\267\306\021\021"
+	.ascii	"\322Z\204Z-\202\360^i\t\b`\360\314\234[(\260\177)ks\332\371\202"
+	.ascii	"\325\376\305\331\376%\251=\253\245\372\327^i\322d\317\357\375"
+	.ascii	"W\004\344aC\332l\3675\245\210j\354!91\251j\266\367\272\365\232"
+	.ascii	"\357\275\327Wh\226\322\336c\357U2\243\260aF\3612\327\2454Rd\317"
+	.ascii	"bi\317Niq\360\372\016&\216\212\211T\333\275\357\370\317\211\026"
+	.ascii	"\256f\273\216U\036J\2155\333\324\317\005q\373\313j\266\253|\256"
+	.ascii	"\246I\251\206\030+\327\2365kO\260ZP\236\304PYE\223\350\336O\214"
+	.ascii	"n4\3715\333NX-ic\220+\005\222\332 \321TK\201\034\023\031\034"
+	.ascii	"U\340\b\227\274\231\304\360\330\022\214\243\361\n\342\264\005"
+	.ascii	"n\306\351\020\361\317\255\337\236Jk\317f\317^\267\365/I\233\314"
+	.ascii	" \234\217=$\357\266up\320\216\215\325\354\264\264\002\237h\236"
+	.ascii	"\022\225,y\322^\352\326~\235\266\207\013\222\326h\253W\235\236"
+	.ascii	"\217\226\276\321\264\366\240\276\232\3553V\213A:j\253k\266\315"
+	.ascii	"\236\374\260\212\232\355\262\317\341}%\311\032L\346\207!V\333"
+	.ascii	"\332\243=U\254\2433O+\201\315&\362\216\262\205?\230e\315\366"
+	.ascii	"\220\243&T\262f;\254()\271\245\331\026\362\271\026\252\255\n"
+	.ascii	"_\263\335\325`\311(cA\232m\257\376b4\007\032\372.\242\203\374"
+	.ascii	"E)\275\322{\2457\275\205\310f\244Y\034&Q\354u\252=;P\\\273ta"
+	.ascii	"\007\212\315\265\326\320\312\222\231\003S\033\004\362\316B!\214"
+	.ascii	"\t\026\253\331\374%\225=\232\355\037\354\307U\365\327l\373h!"
+	.ascii	"\321\300\253f\273GO\231}\r&\266\007\344\321O\230\265\253,[\275"
+	.ascii	"\343\375,\nQ2\002\260\331\256\212y\233\3424k\266u\254[\206\324"
+	.ascii	"h\322lS\221E\331\361\324lC\365\024\033\326\223$S\235c\354\351"
+	.ascii	"\007\227\364&&\3160\f\252\331\306\321\316\267TG\255\311\264\226"
+	.ascii	"\272\340y\257\262\245n\016\357U\3360\243`F\301\026\271\372BR"
+	.ascii	"d\337\\\332n\352\2475\246\224\025\247\276Q4\362d+\002\317\251"
+	.ascii	"\233\021\354\310\323j\266m\300\310\035I\251km#u\022\2435\323"
+	.ascii	"\337J\275t6\355y\247\367JkVe\324\224\267fO0\211\"\233\242x\303"
+	.ascii	")\212o\261\366\335\325\362e\035\243.\252ys:9\322\313w\321\232"
+	.ascii	"Y\231[\263M\304jl\027\245rD\263\255\354\251\366\255\324r\263"
+	.ascii	"\013\342\241\rUl\b\223\341\371\260\2460\217L\332,\027\262\232"
+	.ascii	"\f\326t\211\313\347jt\034\351a\244Y&\374\334\372T{\223j\226\267"
+	.ascii	"\fj\361k\371Y\327\236\351Z\016g\357\372\037p\203\364&\377\270"
+	.ascii	"\262\264`o\312\251\237\270\177\241\336\273\264J\206`\325\264"
+	.ascii	"\264\302\301\234Z\335\344\322+\231\323\274VI\346\364\336\234"
+	.ascii	"\273\\&Ix\336\034\346\3646\335\"\273&\276R\253\344]>o\316]^\345"
+	.ascii	"\t\346\322\252\2119U6\3450\247VMwjuq\356R\331\254\261\274\315"
+	.ascii	"\234;\265\n\274\323g\023\016s\372lbN\255tp\022s0\332\344\307"
+	.ascii	"u\365\306\201\314\345eZ\242R6q\250L\351\363\352\335\313kF\267"
+	.ascii	"\251\300\275T\317\246\236\022\007\303\021Q\231\210\222(\237L"
+	.ascii	"\300\022\321\325\363.\251L!\317{\205\020\311\270K\027$\245\324"
+	.ascii	"\233\305\324d\017\252\253dt\257\211\245{\223|\251\367\336\344"
+	.ascii	"\275\027\246I%\2757\007\016\023\272\264t\257\263\304\322\245"
+	.ascii	"J\306\031\335\333k|pM\314\351\325s'Nm\n\275G\322$C\257\236U\263"
+	.ascii	"\235&\321\256\322\275\227\217h\241M7\004\335\224\034\025\021"
+	.ascii	"25\213\002p\311\225:\352M\036\221%C\020\017k\366\200L\251\342"
+	.ascii	"\361\344\243;\037OZY+!a\335\221X4K[\324\216447\346\337\262Y\032"
+	.ascii	"\250\016\250\033\3152\327\336\032\0219&\235\204\212\002\006\345"
+	.ascii	"\t\035V\325\250\210\363\214\242\340h\366N\272bq-\261t\365O:h"
+	.ascii	"X\250\326\254\264\273\334\324\232G\334j\304\260\316\312\246<"
+	.ascii	"G\023\345\203y\215p\335L\021jD\3204F\204A:\232\223\242\361"
+	.string	"\230q\013\214\"J\265\270\360\235\0359k\261\230\251\273A\247Y\247\201\311m)c\243\tb\304\021\0232\356+\362i\025\032\215\311-U9\305\025\201\362\322\204\3631\0253j\277\f\323xD\361\372\007\035\022\223H\225\305\342\202\3224\244\223\274T\211\322\323kV\b?\247H\2044;\275dsuSd>\376g"
+	.string	"\021\023\205!\\"
+	.ascii	"\203\\5\230\315\313\275OC\350\332\265\366h0\246\002\t\201\254"
+	.ascii	"\020p\325\301\265Z\331\254\367V!B\357\225\276\227\326\256\265"
+	.ascii	"j\265b\252\363\203\"\207\200]\353\2175K\200\257["
+	.string	"\245#\204\256_k\220\265\210\025l\365b\264\265\213\323\276j\255[%bn\234E\363l\330\027\273Z.\301:Y@\340\324\270nHa\214\210\2145\255X-h\303%+\b\365G\373\342\216\366E\251\366E\247v\335\261>\031\355\200\225GM\242X\242a\263/\"\265\347\003\212\334\205\017(\376\205K\233\202I\024\377\225jJ\307Mmo]\235\376\242\2024+]\326\030\311=\3255{\013\030\013\367\025\261\352\253\326\312*k-\324*]\324\n\026h\225.\372\2578:qmj.\353\215\365iM6\341\212\264\032\255R\253\322Z\264*Wf\027\256w]\366\341\352\354.\275\245\rW\033+\323z\2646W\242\325i]Z\223\032q\215\352\301\265\006\243\255P-\370>\242\263\274\204\364\336\345\275\367L\306t\\\267\366\326\204\347\330\346\242\264\221\r3F\302nmF\264\222\226\223\232\366\021\035S5\356\243\2222\245\215\230"
+	.string	"\003\271O\254\2454\225\306[\202\336\261\037\367i \335\t\354$\315*]\364\bNdD/#\326:I\216\277A@+V\254\320YA\202\001\023N\230`B\213\026J\220@\002\213\025\002\254\030 \201\002N\264@\240\005\001\357Q\200\202\t\220B<A\023\264x\340=G!\343\2171F\373\0132\220 \203\rz\200\371\006\035P\320\001\005\305o\320\301\316N\007\031\354\264\317`gE!\207F\321\330s\244a\204Q\344\341\005)#\306\321(\243\210|\261\001\f\362\3078\303\350S\002\214\243P\f\234\313`\340@AF!\025H  !\0253A@2C/\214>8\360\270\220\201\004\3228D\003\343G\004\022>@@#\274x\371\001:\376\244\2004\016\345\264$||\216&"
+	.string	"\271\3601\366p\204A\006\022\306q\006\244q\310\306\370\302\2041\310\007\027"
+	.string	"\030\177\216>\310\035^@\032\207t\200\\\004\035}z\204x\214>=1-b\374\034y\340\021\"A(\247\006\371\"\203\035\344\317q\207V\310\210\354\341\021\342\221\261\"GF\210GF\017k|!\004\344\003\264\""
+	.string	"\344\213\037\240#2\350\205 \236\031\310\343\b\005\3500\304\323B\214\237\243\020\262\005\017<B0lh"
+	.string	"\315\230A\376\034\201`"
+	.ascii	"ra\3749\262\2203dCc\364\211\361\303s\024r\001\300\220Lk3\244"
+	.ascii	"\223\203\3541\262\370I\3018\024t\364\361)\301\250\003\220\020"
+	.ascii	"\262\205\217\3171\207\001\220\306!#\013\244\261hD\362\370\f\375"
+	.ascii	"\360\b\271\230\201\354\2411\372\360\364\264\230\201\354i\215"
+	.ascii	"H\036$\020\213\031\310\236\030\344\320\213\0257\337\331Yq\"\006"
+	.ascii	"\027Nh{&\030\342\241\361\303\323\363\302\007\036\237\240\241"
+	.ascii	"#\f\025CBF\032G!\030*~\216<3T\364\b\r\251\230`\001\031C;\300"
+	.ascii	"\200\354\301\210\374\001\352\231yU\025\220\227jWR\323\n\025\025"
+	.ascii	"\257I\321 \016Y\363J\222#\007+\331C\002\302\366\264%\314\351"
+	.ascii	"4\314\323\2126\355\210\212b9?\031:C*v\315\336\246\350\351\211"
+	.ascii	"\251Sf\002\247\356\346\002\235\234x\315m\r\343\353R\022\245\331"
+	.ascii	"<\233\211\376 \372\033\3022\261L\314w%*\267\245\254\006\207\222"
+	.ascii	"R\326\272\343I\313\216A$\244\0345t\\\323;(L\346\225\244\231\264"
+	.ascii	"*\301\251\221\021\363\0356\335\021:\204p\261Kv\311\207\1777e"
+	.ascii	"I\"\245fO\243\304*Y%\037R\221i\006F\335\020d/{\371\360\215\377"
+	.ascii	"\222\226_M\022\023\273\310\312\332\002N\264T\211\034\036v\221"
+	.ascii	"\030\353\224\304\tWUaa?\265j\372\236iS\232\375\214\222\220\260"
+	.ascii	"\263\246\212ncP+\276\301\301\216ZQ\342\265\257\261\276\266,Y"
+	.ascii	"\032\r\021\346\256\307U\"TP\220\327\252\2144\005\320\250\331"
+	.ascii	"\3134\001\0022_\025V\307\375;*\254V\231\217\016\032s\345$\316"
+	.ascii	"\206\235\237_\267\261\301\224\001i\223C\343\343k&E\240B\236\212"
+	.ascii	"x\350\351\365\223\255b\\\331"
+	.string	"\326a\263\217)\312\313\243\262q\31318\205\207\207\327E-\316%\272[*z\365x+B\263\273]\337\261\363\256X\250\206K\242\354\023(\257,[Tj\377\265\027\213M\325\313\006\227f\337*Q\241\342V,\304s\202\023l\245H9\203\322p\325@\2126i\351V(t\335V\274\227\245O\033\315\353l\246\370\332du\362\244\333\332\344\275I\351\265\301mp\206K\b\257\323\231\242\335rR9\233=\fS\373\"\336\271x\225\315{\257\323\213\3646\211h\212?\237_\270\206WV\340\017\203\256\250Bi-HbC\246hDD$I\2224\006r\f\bQRJ*\257\003\022\340\022%\330\222R\021\304\224\210\210(HQ\222J\353\033\274\005\317\272Z/u\254\004\352\n\261\017((\353\254\216\030\236\272\346\026\022\206\312\334+NS@\330:\"Y\330(\002\0052n1\335'A\250\337!z\352C\006\217\bm\365\342"
+	.string	"\227oy\270\230\3360\311\210[\254\003=\320"
+	.string	"\273\265\247\374/\214aea_\017\201p\024{S\276~\f\340\013\377{\027dK\277\037\216\277\236\0139[~f\227\275m8\004\017F\217\304\223')Uy\372\241 \300\332\253r\001\033\314\003\f\245g\223\004y\027kH\360\004%2(\266\321D\270\341!b\377\312\202\334\320]\223\b''\325l\034)\313\201[+7\245\365\337\221\333~\303\300VI\351\253\240u\351\305\333\312E\342cc%\223\001q_G\252\210#\330\r0;\200\362\020'\351<\347DE*2\211Me[\033\327\001u\001U\017\306\310\2057 \035\3669\342\242\356\234\377>\362\247\fn\315\304\002\202\221\300\364=\261\036w\371\022\t\316\376\313r"
+	.string	",\364~9\262\360\373\250"
+	.string	"\036\177\f\233d*\336\363 \341\231\203\2620N\304nE\213.\316 \361U\372\036\343\037\373$\266\335\227D\222\225\030\373\017\357\212\226\266%O$\263+\273\302\272O\223\177\307ul\004\264\300\221i\210\365\202h\320\021\306\334\253$C\346\301:\251o\032\362\233\314,\305y\320\331kx\375\001\370fx\200\366\262\355\205\270\0079\2660\220\317\246\370\021+@\2049g\244\251\234g\025b\317\360Y=\t[-J\254+\364\371nj\350\256\b\377\263\337\033\224\266M\267\245$\031\264.\265\026;\211\f\206\032\\\201\2145\233\2431\303\365\032\3453d\315\2370\207yY^\315"
+	.string	"\217\335\0258h+\265\""
+	.ascii	"\310\r\234\017\0134\265\224r\300C\304\274\230\362\013\212\202"
+	.ascii	"c\215\371E\353\030-k\321\225e(\320V(\2506\310\020H\200\3775\235"
+	.ascii	"\bm\203\265Xe-#\t<k'x\273\347\030\332\022V0l/\333 ab\316wZ\233"
+	.ascii	"\326\241*E\0274\314\220y\254\246\023&Q\003\365G^=?\236M/P\017"
+	.ascii	"\3048\360\0308'\325t\026\265\007\361\230\230\200\027|\277\234"
+	.ascii	"\336\250\221\210\243"
+	.ascii	"m\275\357\001\262\344\373(7#\255))\221VJ\300U\205\273\036\300"
+	.ascii	"F7@\373u\\0\373-\355\203\273>N|\003n\334\356\021n1\305O\307X"
+	.ascii	"\033\242\343F7\242\215\004\2146\005\004\004V\217\032\341\006"
+	.ascii	"\246q-,\353\255s\204\255P|\030\323\310\270\320\336\177\237#\312"
+	.ascii	"\335'\305\034\007r\334\037\\(\n\200\302\302\203\313 \024\331"
+	.ascii	"\214zf\274 \305\021\273`!\007\217E\034cc\2035\210\306\362DD8"
+	.ascii	"$\214u*\002'X\321\372"
+	.string	"\204 \343\360Qd\270\312s\331\326\307(r\0013\254\256\260 \277p\035\0234E\276\322#\317\262\332\007v\024\022|\247\365\227\236\305[*\034\354\231\303\032\230\256\235U\215D_|\031\263\330\311`\322TZoH\336<\022\\\216\207,\222\200\324\216\364\3470\002Q.\250\030\005\321\177\376\234E\350\243\301.\312\035\310\027GV\264\261\330[\365\371\264<5`j\354<\035\370\301\315\017)\bN^/C\030\017\202\217\344\223\340\007\371`\205\211\271W\353\224\031\342\316\310\005\360\270\365\314\350\261\266\034\300\020\226Bj3\212\003CS\026\026p\200\256\0341\350\310\206\262\022\251\310ybgF\201\372\363A\031\020\361$\004\265P\n\303\254K\020\0342dl\366\302\220\316c\002B\320z\365\277\340Ar&\330\227{\376\017\013\0355\022\023he\202,zp\270]o\246\361\261\326N\242y\351\352\200\314a\300\365\202\323\322(\220"
+	.ascii	"\270! \244k\324R\317\337\210y\314Z\266\370\226(\026\240\f\242"
+	.ascii	"\325\004T\257\224\326\203\302\311m\"\221g\300v\370\237\212\262"
+	.ascii	"\301\207&\275\360\035g\203a\330\206B\006N\312\325-\3335\200\372"
+	.ascii	"\"\313\265\326\r\324ol\n9=\322\016\262\\\n\340):\304\020G\303"
+	.ascii	"\226\274\362j+S\373\242\177M4\2309\023\333\350On5\202O\274\203"
+	.ascii	"\320\260\250\367\307\023\021fP;A\314\262]\332\215\033\214\325"
+	.ascii	"]\006\244\330\333\272\336AH\2718tM\017\340-C\232<\331$\332\353"
+	.ascii	"\265Z\203(B\273\202?J\201<1h\330\301DB\026=\246\003\037\306\202"
+	.ascii	"\276\342\352\246n\023i\363\306\212\321\337\bc\360\212\253\034"
+	.ascii	"\350E\3413\026I\340.\364\353\355g:\007\220\003\2708\265\\m,K"
+	.ascii	"\205{\313\2571\365qT\305\356\316\250\345_\262\210e\343\266\273"
+	.ascii	"q\206jP~\215\005\300\274\347\213\260\260\310\34484\324u\253x"
+	.ascii	"_\334O\373t\334\033\265\346,\252/2P\274y\365s\373\222\260\020"
+	.ascii	"\262\303\275qq\315\207\371+\342\271$|+)\324b\300\326\250\034"
+	.ascii	"\317\336\016\3259T\377Q\341\035\270\272\367(HP\346K\030\267\037"
+	.ascii	"\217\024\373H5n\357o\314\033\344p\360\213\031C\340%<@|Er\304"
+	.ascii	"\0211\251\214\337\347\005\230+\314V\372;O\367\330k\300\306\367"
+	.ascii	"\252\275\210\373\362E\204\374\036\263\307\f\327}\2761m\342\305"
+	.ascii	"\371^\365\276B\333\366dG\356u\221^\270!\324V\334\377\030\202"
+	.ascii	"\345\340\314\377:\306q\031\017\353{\273\275\031z\2238\352\366"
+	.ascii	"\025C\325\212z\r?\351\271j\351\276\223\372\2179\320\223\212W"
+	.ascii	">;\203\336\236wm\220\324\231\300\275E\357\034\263?\217\302\r"
+	.ascii	"\ri_\313\337>\031<\254\231\311\033f\357F\263\336\242\277\302"
+	.ascii	"/\030R\326\335p\030\361\3463\365\323\336\332\357W\323\224<Y\355"
+	.ascii	"\262\004\265\002"
+	.text
+	.section	.gnu.lto_.symtab.108dab12fffd1ee1,"e",@progbits
+	.string	"displayCanvasSetStrokeColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"displayCanvasSetFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"displayCanvasSetStrokeAndFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"displayCanvasSetColorInversion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"displayCanvasSetPixel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"displayCanvasSetPixelToStrokeColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"displayCanvasSetPixelToFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"displayCanvasSetStrokeWidth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"displayCanvasSetLineOutlineType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"displayCanvasSetLineOutlineColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"displayCanvasClipToRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"displayCanvasClearRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"displayCanvasResetDrawingState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"displayCanvasDrawCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"displayCanvasDrawCharacterMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"displayCanvasDrawString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"displayCanvasDrawStringMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"displayCanvasMoveToPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"displayCanvasStrokeLineToPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"displayCanvasStrokeTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"displayCanvasFillTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"displayCanvasFillStrokeTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"displayCanvasStrokeRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"displayCanvasFillRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"displayCanvasFillStrokeRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"displayCanvasStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"displayCanvasFillEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"displayCanvasFillStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"displayCanvasCtmReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"displayCanvasCtmSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"displayCanvasCtmTranslate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"displayCanvasCtmScale"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"displayCanvasCtmRotate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"displayCanvasContextPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"displayCanvasContextPop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.108dab12fffd1ee1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,480 @@
+	.file	"light_led.c"
+	.section	.gnu.lto_.profile.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375 |\375\002"
+	.string	"\244\004p"
+	.string	"\t"
+	.string	"\366\254\342\276\002\b\002"
+	.string	"\002\001\001\251\245\204\311\n\f\002"
+	.string	"\002\002\002"
+	.string	"\002\002\003\002\004\352\263\360\321\b\003\240\342\234\212\n\004\275\375\215\235\005\005\237\326\324\323\t\004\002"
+	.string	"\002"
+	.string	"\006\365\341\253\351\n\007\b\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"I\211i*|\241\356\332\225\226\273\376\216\247\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375 O\315\001"
+	.string	"D\002C"
+	.string	"\004"
+	.string	"\001\001\001\001\001\002\005\002"
+	.string	"\003\001\001"
+	.string	""
+	.string	"\004\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\005\002"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"4\205\230*5)\013`\007:l\331\360\262\034\f\332"
+	.text
+	.section	.gnu.lto_.inline.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"]\006"
+	.string	"rJ!)\200)I\007s)<\\\366`\346\2224e\n\252\253"
+	.string	"\200\213`Qk"
+	.string	"\273\213\313\2202$\362_h\355j\244\265\275\245L\001\237\236\231Z^\032\221^0pc\316\222\374\250d\003Q!\204(\250\t\264\371(\305\335\t\234\fPG\225wT9\250\t;=L\317\365\f0~z\372d\352\3556\330\224\303]\004\375\243*\036 $\0306A\235\224s\"t\201A!\2021\377{\235\3057\265>\235\272\273Co\323 \034"
+	.ascii	"G\233\001\207  \220\226\032\270n\213cR\234P\241\255\226@g\013"
+	.ascii	"6\210\341\2640\002wfh\201%$\205;\254\226\2351na\356\3439\256"
+	.ascii	"+\254\fa\275Tju\254O\231f\351\327eU\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375 \274\005\003"
+	.string	"2\205\016\026\300%\035\377\277\013\370\375\177\377\365\377\277\006\255\031\327\366\336[&\031\344\023\320\263^\360-\243Kq\277t\036\366\303\372\\\365`4r\341\222W\"\234\310$\265\234\377\336<\211D\016"
+	.string	"0\013\300sI\341"
+	.ascii	"A\367\336\241\007XEN\370@i\200v\203\022\372y\001L\242!\223\274"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\231\004\004\230\004\005\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375 ou\002"
+	.string	"D\003c"
+	.string	"\004"
+	.string	"\001\270\006"
+	.string	"\001\002\t"
+	.string	"\001"
+	.string	""
+	.string	"\001\b   "
+	.string	"\001\001\024"
+	.string	""
+	.string	""
+	.string	"\002\002\n\002\013"
+	.string	"\001\002\f"
+	.string	"\004\001\274\001\005\002\274\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"9\203p\001n\350\n8HQ\267\374\264\244r\030\3058\260e\003X"
+	.text
+	.section	.gnu.lto_.lto.ad0969fa4f7e3393,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statusLedConfig_Registry.12.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375 \243\305\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\203\237\235\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\317\007us\350\345\006uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\371\003?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/drivers/light_led.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_statusLedConfig.15.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\315\n"
+	.string	"\226\223IB\020\3478\035 \264\307w\302&"
+	.string	"\317@x\306\355m\017\373\315W\3453\354V;\021"
+	.string	"y\312\345\221\177\304\336\323\302:\274\202\335\345\265\036\031"
+	.string	"\240\0210SBP}\003\261\f\2104`c\372\330D\310N)4"
+	.string	"6"
+	.string	"6"
+	.string	"!\213<\367\234~\341\273\347\271\302w\317\247}\200a\344\200\200\253\306\266\273 \227\362\363\365\364\037s\203\027\214\365\332\241\330]\327\027\314\344\346n\373\301\366\204\375S\367:\032z\"K\320\2527;eU\016\305~\267\273k\016\265?\373k\207#q\325@\265\335\222\333\202-\340\tX\371\330~\265/;\314\371\331\352\t\273\250\201"
+	.string	"\273i\366\313\317\3468\200\322\3457\317\301\251\367\200\317v\232\333\016\275fc\321\362r\325g\033\3424UClw%l\217\317|xv7\342\236/\003\022\002\212\251\334\363W_&1#5V\224\302\213Re\216\314\022\301$Q)Da\230'\223\210\002K2\354\020\311\022\230\022G\032 \211,A\221\203\307\215\220\004\315q$\301O\272\357\226C\335\261\254\002\004-N$\023"
+	.ascii	"2\241\237/0<xd\027\304\241\273^q\002\306\355J\325j09\\\t\fq\225"
+	.ascii	"\032\374:\017\310\204f0\357\022@\263\232\022\356\360\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_ledInit.16.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375`\360\002\205\026"
+	.string	"\306\351\220H\300XM:$\210&\206Y\005\356\213\223\366\\Y\\\215\246\276y\203\377\020\005\"W\312'\344\362\240\261\326dg\016\301.Q\221\264\321q\262\324QU\b\274(LC\207\350Dh\267hCx\216\n,\276'\204\220\275\245L2|"
+	.string	"r"
+	.string	"|"
+	.ascii	"\261\327\204N\240;\351\007\220n\033\215\326|\237j\373K\367\371"
+	.ascii	"\275@\367\2511\325(\267-\365o\343\221\216+\335\035\262\013\345"
+	.ascii	"K\333\325\333\330?\257\233\2227\246\367nn<\201\212!\343L\374"
+	.ascii	"']\230\220\240\311\006\2134#ZO\006\212w'>\001\314N\\J\231)NV"
+	.ascii	"\004\314\212\344\313\b\030c\313L\266|\246\313\320\244\2143\024"
+	.ascii	"_\357\246\273"
+	.string	"u\307Y\211+xU]\241\252\020T\031\fs\237F*\372\341\270\327\327-s\240oR\005}/>\365B\f\312h\242Q\033\332(U\233\270\254\244\372ww+'\251\246^\373\003\374v\005\345\352\307\253\336\256v\273:\345\252\344U\336\325\335\325\277tB\226\300$\351\036\021\225\245\225\314\\\214\337\256z\233\236\t\307s\304~\323\247O$\361\341n\"\246t\367\314\247>\370>c\344[T\365\253\372\032\267\021\222U-\\\330\217\032c\304\242v\354\361\241\374=\335\344\216o\304\202h\243\024\344\311\237\221\002w\004%9\bN\252Iw\333\350\235\236\303\240\031rr\240\270,\263\252\316\316~\224\034#cQ\227\2315\320\242\216\240\024\352\210\211\032r\325-\273nNd\213\305\347>V\n\226\272e6\252<\357\301\372<\260\264|\246/\300\201\243\221\343\356\026\231\225X\277\343<z\364/\364\247\265\037[\335\003\254\363\2608"
+	.string	"\265\"\250V\023^A0\035\330k\200\356\324\250V>\033`\035xX>\341\313\265\002\301r\251B \226\316O\270\343z\2055\b\264\345a\345\na\255\226+l\261\3659\351\306\277\246'%CL\364\261\222zF\272\024\263\223\2359\310H4\007\371\265\313\356n\217\301ANq\b\232\224\355\302#\301I592\235|\\\251\262b\213':\246\201\235\371\307\252\022(\024\261\250Ep>\"\037\277G\221\034\314z<_\241\013< `\002\031:\254\007\342\200\377c\360\355q2\310.XM\251o\253\004\312\351\354\336\032\305:\327\034\267\364eM\345\353\203]\244\017\035q\325\306woi\220\240K\206\313\005\3041\261\326U\253\324\213\346\024\330\273\tc@p}\213\242u\373lq5\254Y\340\354\214\270\023\247#VJpl\267Hf\305\350\355g\235\345\r\001]\3305"
+	.ascii	"\025\341\335Y6\326\254\350\367^f\b\320\266AK\324\352!FI\007\331"
+	.ascii	"T\343\373Z\247}O"
+	.text
+	.section	.gnu.lto_ledToggle.17.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\225\b"
+	.string	"v\021>6P\217\032\003 [\374J\206\n\200\322\200w\361\001\324\"AeNF\2613\202\220\253\351\200\365\006SH>6\231\250\323\270M0\242\312\004kyNj\004m\271\245L),"
+	.string	"-"
+	.string	"-"
+	.string	"\022s@fY\257\205\361\n\344f\2454Pd\376\317\370a\317\320\253]b\355;\225\f\001\022\376\027~'\0167\272mA\333\203\266,\001\177#\252\265\312\216\020\3262ky\031\210\3717^3w\311V\310\246\255a\353\021\223xVU\245\332\337\221J\371o\320\216\306\222c\201\314\001\334\004\364WNF,\265\355\205Y\"\315\177\204\332\304'\024u\312\262\026$\350\317\262&e\226\216\013+\"-\023|\265\253\022\214\036\255\261?\237-\024\353\351|\266\020\303\350\301\001\024\232\242n\253"
+	.string	"u\237\031\001j\200\230\236N4;\004\345$\266n\2168\256\233\233\325\215=\242\252\340\3422E\214j\320\261\r\b"
+	.ascii	"3\241\303/F\361\031L\300\250KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_ledSet.18.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375`\250\001m\020"
+	.string	"f\341pE"
+	.string	"\261&\035\177\352\234X\330\272\345\273\027\"<=\f!1\017\376\t\356\241k\332&\324j\342`-5k\3007@b\024\035i\356h\fN\377_\332u2h\302\022\303l\212\246u\354\351\215\272\021ido)S\nY"
+	.string	"Y"
+	.string	"^"
+	.string	"\217~\332\267\271\t\324o\334\302\332.\207\020:\273\033b\221\354q\364\001\330#|"
+	.string	"\354\321([\306=\020\373\027\tV\316\317\356n\372\341\250G\250\211\362A%Z\313\225z\2149\f\271b\256"
+	.string	"\\.p\264\273\177=_\\\253LP\311\356:[\256\f7v\333\fl'\260S\024pw\327Jc\337\373E\307\271=~\363\207\236\326b:{\032\224i\354\351\3704|Za:\237\376\207h\306\006\r\035J\350\013oa\276\033\333\023wD\034\347\267\377\227;l\343P\030\245\274\205Q0\303c\363\263\353\201<\232\304#$\250{-\004\356\243c\303\263\353\205x$\0131SmG\225\037\214\230\202\364\230\206\260vV\371%\364\320\250\220\306swS\372\026L\244\021\203\317+\206K\3260\310\241z\350q\260X\250^\241\236%\263\312\317\251\252g\345P=\347'L~\215'\234\362\255\023\366\230j"
+	.string	"\206\214*?\207\364\300\257\025f\\\\\270\261\312\317\366R\251\036\354\007$n\245\343XTJ\231\212)I\034\212\332D\204\304\2414XypRB\331N\035\307R\352H\233J\311A\312f\322\2356\221\0026I\340\272m\305d\352\266\016o\017Wi\234\020\244\002F\254\320\250\232\276,\260\321\243\322\225?R\323Lm\023.\337\362\310\202\246 \\\305I\266\273\b|\024OQ\362k\036\035!%\005{\034"
+	.ascii	"@\205\006D\304\nh\214\177\004\241\262Lu\246\204R\247K[X\2028"
+	.ascii	"P\327\347*\301}a\013\217\005d\315\2160\367\226\272j\246Y\336"
+	.ascii	"\271\320\324\241mE!\377\264\373=\033\fN<0\312S5\206:\275\265"
+	.ascii	"\245\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\315\005"
+	.string	"\202\310 )p\213:\251\372c\235\373\231\351\364\\1\327\265\212\215sEc\300\350n\225\256\372\353\002\327'[3\262\265)\331ts\267\224\002\216\306)\017\024$#\212t\t\330L\227\307\334\034\315\304\022\270$\3507PO\240\333\247\334w\327.t<\355n\261\233\246EN\232\366#t4\026\240\"L\200\f\203?F6\n\322T\333L\263\007\253\246\264?\356e\315\275\245\330\003\271Tl\2653\222C\273\273\225^\217\355#\002\026"
+	.string	"M\233G\300\032\032\f\315eP\240\036"
+	.string	"\034"
+	.ascii	"\034>@:\\\nz\202\341\022\202=\264`a\200\002\204\201\341\026A"
+	.ascii	"\022\026L\320\016(\003\346\\k\342\001"
+	.text
+	.section	.gnu.lto_.refs.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\004\001\001\002\002"
+	.string	"\001\003\007"
+	.string	""
+	.string	"\003\f"
+	.string	"\001\003\016"
+	.string	"\001\004"
+	.string	"\003\001"
+	.string	"\002\005"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\013"
+	.string	"\003\006\002\007\002\b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ad0969fa4f7e3393,"e",@progbits
+	.string	"(\265/\375`*\021MW"
+	.string	"J\230X!R@\220\312I\007-\315X\3666\346\032|\007\343\263]\330\004\215\016#\0057%\032\027M\344O\250\202\r\271\236\033\311\031m&\200}@P\033\227\362\003M_\361\263\240\177P\312B\336\360 \023U\332\233Y\032\224l@\177w\275qT\352}4\201\304\266R\246\276\001"
+	.string	"\002\003\002\373\366-\263n@O[\246v\037wK\b\355\226\330\371R\303\021\354\254\337%\232\002MM)Y\266\261\321\261\001k\256i\253\266k@K^Y\234\233\026\363r+\346m\224\254\375\240\022\004]\242\005q^\216\215_8\244\201A[ C\200\320\245k\344\314\0333\\\377\375\262^\352\224\265,6\\\273\020\001I\tI{\302\365{\003=\003\177\321\331\246\213Eh\327}\364\322\352\356-\313e\231{\266Y\276d\253\345\233~\275\376\242\177\201\026{\2669\254\231\b\247\356!Bxd\342\230ur\272S\024D(^ \231L9\313\202z\340\352\241\216\353E@\277\001JbC\234\325\001\364\213\345\337*\353\265c)t?u\267"
+	.ascii	";:l\324\234\341\272`\033\266\314\021+\366\005Z|g\264\322]\335"
+	.ascii	")\257\376`\243\201\t\327\027\241\337+\017\340\330-\336\203\276"
+	.ascii	"\271#\316\375*\372Z\001q&\253\322\346\355\266\240A\321\341\312"
+	.ascii	"\214\356\026\304I\264!\250\374;e\273F\354\2209\226=\326\235~"
+	.ascii	"\340\245?\244\212p}\272!NtA\234\377\242\260\304\364\353\371\267"
+	.ascii	"\204\025|\376\335\300\367\357\007Ju+B\322\277H\253\302\032\300"
+	.ascii	"$\342_\271\377f\377\313\376\213\375?\373?v\364_2\377\302\370"
+	.ascii	"W\202\177#\370\367\201\177\033\370\327\201\177!\370\227\202="
+	.ascii	"\340_\026\377\266\330\024\376\017\375\354\364o\357_\023\376\035"
+	.ascii	"\341_\020\376\345\340\337\013\376\215\361o\005\377\326\377\315"
+	.ascii	"\377u\377\347\374\217\363\177n\355\377\227\377]\376\247\371O"
+	.ascii	"\346\277\214\377m\377\331\376\203\371\217\366\337\313\377\256"
+	.ascii	"\377\005\374\027\363\377l6\233\315\177\303\374L\374\203\314\002"
+	.ascii	"@Q;\272\f\341\252Sg\233h\332S\013\266D\002\252&r=|\233\\\027"
+	.ascii	"'\013\224\177\251>\316\246\2605A\377\255cn\335\262\355 \253\224"
+	.ascii	"\261\271N&S\234\223\240\337\035v\3470w\316\232m\332S\036`\231"
+	.ascii	"R\223\323\3114\305Y\b\372]\263\323\215\233\215\363\0265\245\266"
+	.ascii	"\265\213\202*c\203\363\215\363c5\246C\223.H\256+\207&\335\033"
+	.ascii	"\036\2322\345\222\366\354 \"$\t\327\263\017\364\253f\327|\331"
+	.ascii	"\234\315\316mU\357\342\306L\251\311\351\252\252\023h]]\324\034"
+	.ascii	"\035\276so\003\324\335\325\335\"\316#Q\200,\341z8\333\346\177"
+	.ascii	"\317\231C\n\032*m\344~\224\360P\206\351\302\013b\203\n\027\256"
+	.ascii	"\314\215\333,>=\322\266\230b\320\363\177\3661\331\335;v\322N"
+	.ascii	":\001}wvO\374A\273[\004\376\327\336\215\310\352\266\202\243C"
+	.ascii	"o0;\006a\022\375\255n\343\207N;\211\f\2732\"\257\224Q~H{\006"
+	.ascii	"\001:\254H#\323+e]6w\332\333OW\312\026\220\3512\211L\227\306"
+	.ascii	"\241~Z\032\273S\345\020r\354h\\d\330\225\022\031\266T~\350\247"
+	.ascii	"6v\330q\006\364i\251D\256-\225C\310\260\243\022\371t\245\374"
+	.ascii	"@\005w\004\307\r/+L\226\f\362\251uHY\035\223Cn\310t\331p\335"
+	.ascii	";\006\325I\004\272\255\226I\270#\325nqr\323\341\244\345\270\334"
+	.ascii	"\264\273\007\220r\302Z\366\223\033\362\311\262\373\211\323RK"
+	.ascii	"\2610\246n\215d\335\214E\254:\007T7\001\235vKu\033\267\335\272"
+	.ascii	"\333\330\335<I\253\264[\206!\244\226\224Tw\025\221T[\031\317"
+	.ascii	"\240\272yl\315\026%2\fkYt\306\f\323j\033\251q\265\032\356*\211"
+	.ascii	"\206\031\277:Gw\357\033TK\311\303\r\327M\343\263\206t\302\304"
+	.ascii	"\b\272f\366\3142\027\315\253\225e\207u\247A\273\343\0176\263"
+	.ascii	"\023'\257\331l6\367\304\271ex\311\004Lv\326r\246\201\363\205"
+	.ascii	"\305\225\263\354\032\224:U\262\030\213\224\rVx0\217\361\344\320"
+	.ascii	"|\274\251\001}]^\2712\247\207,j\016\017\\_q\200}\231\f\266^v"
+	.ascii	"\250\033\213\310\226NV\245@\353\246\302$\351\320/\3272\324\031"
+	.ascii	"\3102\031\212\277\210\276R\243\320\232\227U\n\0362`\232[\\S\236"
+	.ascii	"c\0324ii\320o\327\020^z\305\t\231\201M\022^\022e\314v\375EWL"
+	.ascii	"\244k\r[q1\023\216\262nUC\375T&g\216\261\230\213\221\254\331"
+	.ascii	"\272UA \005n\nWa/\356\342-\226\302T\226\311\\\\\303Y\006\016"
+	.ascii	"r\"-\314\305E8k\335\262(\350R\203\202\b\005\217n\212\030\325"
+	.ascii	"P\035r9\021NH\r\274\332\314u\247\377\031\n\343\260L\216r\242"
+	.ascii	"\264\243p\023~\262nUi\3578A\207!h\003\240\brc\006.\310\371\344"
+	.ascii	"\006!-\351\2217\\"
+	.string	"\331\006\236**15\304\264\226\311NP8[gur?`\222`\205\241\337y\241\3379Q\202\236\231\023\322\246\004\375\356\b\372\335\022e\032\330\3102M\360\221\357\027c}\347\230v\312J\352`\001\243B\277&\316]\263\271&\316\357v\240C\273(\364\273\032\350\317K&\262\023\246F\327Fd\315\336\330r8q\375\316\210\016-\210\223\304\t\037L\305U\177\017O\312\026#ds\320\363\217\016\222\214!\343Z\367_N\346q\356\361\367\260\230&ZRt\350Y\311;\376\036!8&X\276\342\320sr\207\254I\007\204+O\241P\334f\302GH\031\021\236\372\371\006G\261\216\030\232uv\340\3129X\352\254\203q4\353`\261\354>\262\016\036\235\356#o\267\304n\211*\005\253I\226\263\236\323\320\303m\2103hA\234l\243\350\214\374iC\233\253\302\025(e#\033\371i\250\235\336\270\264|\350z\200\001\341\312O"
+	.string	"X\225\305\341\312\307\177Y(gI\342\266L\276\"pH\302\221\021\317\221\021\372C\222A\303\202\242/\203##\237#\243\363K*\204@\242bO\b\36492\362 \203## \032M\302\030"
+	.string	"\260\340+\022i\204\020@\361K*~M+~M \222\2023~\202+\360p\207\330\003*\366\202\277\246\235\340\257i\267T\374\005}Lg\261\347\242\b\365\305"
+	.string	"$V\"\3217TRB\342\241\321$L\252\303b\323N\311\027\374\001\231\220x\224|\304\0315(\004\026\223|D\236\017{\277&\025AC\244\245\244JcX$\002\177>\020zDE_\bJ>\246\323\307\364\373\te(\371\230z\210J>\246\nT\004\006\215\224|L<O\352\0051(\372\210>\020~M\003<\t8\364\005}?\364,\\$\340\342\005\f<\177\001C\001\030\n\234\177\001\243\250\b\206\213\"\364.\212v\276\336\320\027|\341\310\2274\234!$\372\206<&\241\320\202\336N\261wdT\213_:\340\302&\337pEQ(\034\256\370)\366^\024\203\300\031<A!0\b\354!\366~\300\025\202\302\030J>\016\2103\212HE\342\207b\217\347EE1H\210\320A\006h\222\n%\037S\257\270\364\0032\255 \016}."
+	.ascii	"\207J+\202@$\026V$\r\211+T\030@\374!\311\020\002O5c\302\242\310"
+	.ascii	"\276\270\246Bg\224%6\316\270\246Q\36313\343\345\b\032-<\265\032"
+	.ascii	"g\272\234\341\002$\325\304F\r3\214\026t\325d\256\341\312e~\304"
+	.ascii	"a#\206\253\330J\335\200\222Ef\347\2344\333\210p][\3431I\026C"
+	.ascii	"B\303\234\266\363\030\236\262\353\370\204+\263\355\032\257.\255"
+	.ascii	"\311\222\2700aX-}\233\333\252bmP\313\264\263\332\333\374\230"
+	.ascii	"ae\325X\353\261\021\325\274z\363\342\205\321&X\276\315m\031\251"
+	.ascii	"\303\361\345\214\266kB=\222K\324\214\235i\334,)\022\246\254\214"
+	.ascii	"\271D\340\3666\267%\004\307E\016\226\2633\227\036:H\216`"
+	.string	"\\y\313\256\371\274Q\215i\256l\266p;8\252/:fXq\342\314\316\320\213\211\261\226\265\322SDU\322\26799\335U'~\310\262\232J\002\201G\250\201$\207\2245#2#\"\"\322&\351a\005\204\030&\251\263\016\021P-\223hfD\223\244T\33086`\372\354\263\214?ACt\250\3068\267\261v\302\333'#\223{\230\006\337\212d\005\314 d\005\332\"\310_a\224\275\001\330flJ\364\301\n`\276\240\235\342C\306\320\317n\0172jPo\272\006P\221\nZ\312\212\243(\033;\262\r\275\353$\004\274\351\204\332\033h\332)vT\267<\230\252/^\374m\261G\267\320*\363\253F\t\0257\351\024\244\020\304\263\323\033\225\245q\343q\304\332\275\226JU\005\200\243zV@\226q\f\352\005R\262my\032\255P\367\375Y\036\242X\374y\324\201\237\003\274\323\221|\223\204]B\037\255Nk:\364\360"
+	.ascii	"\3622T\267\r\230(\213\234\334_\220s\223\351\210c]\323\366P\346"
+	.ascii	"\022\236\373\234\261(\307\334\3671a\227cQ\\"
+	.string	"]\254\0162r\314\332@\373\250\246\016~\201@\324\233\002{)2\241\013u\353\233\026\f\355\202)\321\274[~^xd\030~e\306\r\304{\003\205H\244\177\372\277\371\030\342\334S\376i\204\256\307\036e\367.\315$\264\221\177\224_>\235Kt\351\273\225<\373\243Y\005Y;\335]\025\376\371\205\302\314}\314\210\341\201\235\370\206\342e\025d\371\214{\201,d\244\220\b\230\252\332\222f\216\345\t\305m\215\217\374~\212ft\341\270\\\3722\3363\325W\031Z\346#\235\2328\303\253\026%\352~\370\275\221\356\357\335\035\260\273f\266\322C\335_2\226\260$ )\337\031\370\b\243\363\364Zh$\373\261g\360\275\312\334R'L\377.\375\305~1\202\211y8\3207\t\361\356s\264-\301\321Z~\020\234\204\324\233\304\"I\247\004\354\350\366\004t\265dR\373HG\235X\217\223\300\223\214\251\306\326E\231qA\372?4"
+	.ascii	"\360-\206\303\017\321w l\335\263\302\330>\275\0351\2474E\304"
+	.ascii	"\026n\357 \272\231\242\006\212}b\0131w\203\\\271L\231-\320\300"
+	.ascii	"\265\205\313GH\264\246\344\377\246\270\022\363\350C\350#\303"
+	.ascii	"T-\005\007\001\235\226\271\374L27z\370E\006\313\247\217\b\374"
+	.ascii	"dd\017\177t\214k\2037\207OfKl\004\234-\334\261\032\t16\333\201"
+	.ascii	"\3056\240\r\335-\223\233\370'\201\345\261\2763\255m\233r\235"
+	.ascii	"1\023z\311F\202\267\317\362\001\034bo\233=\\\217p\314U\262o\272"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_.symtab.ad0969fa4f7e3393,"e",@progbits
+	.string	"pgResetFn_statusLedConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"ledToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"ledSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"statusLedConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"statusLedConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"statusLedConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ad0969fa4f7e3393,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1139 @@
+	.file	"motor.c"
+	.section	.gnu.lto_.profile.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\r"
+	.string	""
+	.string	"\022"
+	.string	"\031"
+	.string	"\032"
+	.string	"\033"
+	.string	" "
+	.string	"!"
+	.string	"#"
+	.text
+	.section	.gnu.lto_.icf.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`6\001\305\013"
+	.string	"4\021*\002"
+	.string	"\""
+	.string	"\274\205\242\255\006"
+	.string	"\001\222\252\354\340\007"
+	.string	"\002\003\317\253\250\341\002"
+	.string	"\004\307\276\344\257\003"
+	.string	"\005\232\372\246\216\007"
+	.string	"\006\007\b\t\354\301\314\336\005"
+	.string	"\n\013\250\327\372\376\006 \002"
+	.string	"\002\001"
+	.string	"\002\003\003\003\r\272\215\354\310\n\n\002\004\002\005\002\006\002\006\002\007\002\005\002\b\002\005\016\240\342\234\212\n\017\314\215\357\272\001\030\002\b\002\t\002\n\002\t\002\013\002\t\002\f\002\t\r\004\002\t\002\016\006\002\006\020\372\364\363\351\002\021\335\316\371\202\b\006\002\017\002\005\002\020\002\005\022\364\330\366\355\b\f\023\250\257\256\333\005\004\024\255\313\264\227\017\007\002\005\025\270\236\211\311\017\004\002\007\002\021\002\017\002\017\026\255\372\241\252\006\006\027\352\263\360\321\b\030\031\212\333\334\276\b\n\002\005\032\317\262\324\372\013\013\002\005\033\247\250C\004\034\350\300\306\254\005\002\035\036\342\320\203\361\t\022 \333\354\351\313\n\n!\211\244\373\255\f\f\002\005\"\305\217\201\375\006\004\017\002\005#\346\341\231\311\b\r\002\005"
+	.string	". \240\002\2513;b\016\277\b!\273\304\00460\371mt\201U:@\311\203"
+	.string	"\201\240"
+	.ascii	"d\0233\367\026\315\032\205\204k\234\207S\342\231eA\222!\036P"
+	.ascii	"\2475\n\302g@o\300\241-\027VKv\335\363\273)0uqiK\270\213\233"
+	.ascii	"\037\\\330\274\002\217\203_<\335`9\230\321\020\324\321\304c\025"
+	.ascii	"`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"M\005"
+	.string	"\322\210\027\033`u2\034SmQ\024\005mQ\024A\211\346n\357?\362\336\364\333&d\313\235RR\346D%\221W7\352\242\t\231\217]G#9F"
+	.string	"@\006sY\377\345\263\026s~>\255\004\245\223b&Ve\371\227\217#\026:\254a\367\202\256\324E\330\203\t6\260\313YM\315T{\233\346k\344\225! p\002bH=\020\270\240\335\246!\260\001\030\271\227\r\342\027\242j\027"
+	.ascii	"\017\232\235\202f[a\317\313\340\025\006V\005\025\356\241\341"
+	.ascii	"\032\240\212\207\306\375\301\202\210\304\342\256]\224\020x\""
+	.ascii	"\303\030\3535fq\270Q\272\274\346\206"
+	.text
+	.section	.gnu.lto_.inline.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\240\004\255\017"
+	.string	"\226UI=0m\223t"
+	.string	"\351\311$*\030\272*\227I4\322\324o\337A\247\251D\303\265@\030\213F(\255\212\377}L\322\320\313`2\002\f\346\"\033|:\377\037\177\353FD\263\237\264\326\310\226;\0052"
+	.string	"="
+	.string	"7"
+	.string	"\230)\236@\266F\331U\217L\016\353=\215\220\231\n\360\267\350\335\215\033\375df\202+\224I\233\244\210a\357+=\204\314\344\370\376q\232\231\211\2579\252\020\354\273P\004\t\310\302dL\331\025}y\363\271\332Z\222\231\223-\276k\242bK\245\034\311\323\266\325A"
+	.string	"\035\fe&5E\341\233\317\233\217\0251\250\006\f#2\\\372\330"
+	.string	"CBL"
+	.string	"\021\231\224\003L\277\325\256^hc\025\336\206\353\330\301\016\037 \036,g\332m\267e\224\004\324!rc\\\315i\250\325]pSoK\3572$\252\017\356\n\331]H\227:8g\016\301\201\212\215P"
+	.string	"up\2406\020\032\311\314\312\030\217?\005c\022\345\246\357\264D\211\b\211\002\231^\373mT\302\007\310\007\315\232\013\215rp\002\036\003\004Dcz\337\350iH\006`\250\301h\212DH\222\202\202\202B\241\003\240\"\231\252\272\001\022\200%E\245 \021 !\221\204\002\211$\020\211\357\003\231j\233\335C\221\344\347H\215\254\221X\246\016\215\3732d2\362\033\352\n,\373\200\377\b)\273\016\322\224\001\344\026\272\"`\b9\331\307e<S\344e\304I~"
+	.ascii	"\277>|\213\250\\/\324N\020)V\220~rE\3661\217\361\b816\232s\034"
+	.ascii	"\235\f\357\373 \026Vm\240\310\327vd;\253.xOX\b\234*H\224d\247"
+	.ascii	"\344\222\261VA\361\264\2354`k\003\003\233\201\030\032%\204\215"
+	.ascii	"#0\333\232%\275\265\331\367\301\225\356j2c\226\332\006\024R="
+	.ascii	"HK\020\0162\223\312`S\262p\035\241\331\022\316\366\021\340\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`R\001\005\t"
+	.string	"V\320.*\200)I\007&1\225\240\270b"
+	.string	"eD\032\350B\023r\002\216\2201\227\032b\262\254\370\255R\362\304b?\026}k\211%D\312\024#"
+	.string	"!"
+	.string	"$"
+	.string	"\311i\022&\2077\t!T\333\336\352\241~\017\031\312\n`"
+	.string	"\337x\006S\253w\361\211!\372>\177\310u\b\251-K.e\242L\370\240\332'\370\035\277\264\273\335?+\330\250\331\250\222\017\223\363\251=D\n<\003\337<\302A\273e\320n\364\224=\324\"\241^\372\322\227\006Z\256\022\225\021\023\314\322s\364\205,\373\202\277\362\013\267\273\314\302+\234\320\256S\207S\250>\031\330cD\221\021U.\321G\221\232dc\246\307\330@\022A\002+ `\002BH\344\003\2001p\032\021\004G8\254\033.\032\262y\353\365l\005/:F\264"
+	.ascii	"\013\005\200\211\005s\361\301\274A\006\330M\242\025\"\346!0\016"
+	.ascii	"ywul\356\204B\023q\206B64\266 \306}\022Hp\224\3100\026\366h\233"
+	.ascii	"\234\006\251\315\206O4Y8<6~\232\330S\366\220\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 _\235\002"
+	.string	"\362\305\023\035`m\322\001\016\002\356\305\242(:\202 \b\302\3641\376\254Op\211\320\261\266\235\335\332\016w\362\222\334\310\007\371\322\352\261r\334\306e\334\305U|\211\027\342\036>\303W\270B\270\203O0\003\0230\243\t\315g:\363\331Lf.\323\222\231Q\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\361\001\025\n"
+	.string	"\222\016.0`m2\034\300\255\205\335O\002`\036Y7\f\350"
+	.ascii	"\350\275\242\037&\207\330\321 \020\235y\256\216mDz\333\215\247"
+	.ascii	"\025?LD\243M\266\343\2262\005KTXD0\336\341\224\232\326\347\363"
+	.ascii	"tnZO\223\331`\250\005~\241\25002:*\212c\244B\001\235\204\204"
+	.ascii	".&\225\210\306G\311\005\350\331@\236\210\022\336\271'=\345\316"
+	.ascii	"U\036\216B,\245\b\322{,\374\265\007?\035:=\355\257\244\001\033"
+	.ascii	":\031:;\235\234N\252s\352\3344\372\025\374\345\254\317\371\272"
+	.ascii	"~\211\004\337\330\3524=\001\230\245\034\242\302\2159\327tf\312"
+	.ascii	"1\355\337<\226\242\001\201\200\326\262\313\245p\373\222\004?"
+	.ascii	" \220\002\242\261\242\007\030\001\017\022\360\306\242\341P\316"
+	.ascii	"\342\b?l\361\255\201\326\t\341\265M,\244\336\252\326@\032\005"
+	.ascii	"\b'\303mO-.\317\0208\331\260\224\031\333s`z\251\341Z\316\334"
+	.ascii	"\254\305Z\030B;\247_@'j\034c`@\321q\227\b\226\031\300\240\236"
+	.ascii	"@\353\356q\"\332\214@\321\025<\354\244n\"0/-[\304B#/\004\316"
+	.ascii	"\222oc\211\344n\250q[\276QP\231\224\271\317\260\231\214xe\220"
+	.ascii	"\365\300\213"
+	.text
+	.section	.gnu.lto_.lto.16d497eef9090722,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_motorShutdown.25.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"-\013"
+	.string	"\226SJC \251*\035Ht\344x \f\362\024\240\204R\233\377US"
+	.string	"\231\037\323L\371\345\220\242\231"
+	.string	"\004B\251\366\t/\311\222d+\331\030UeW\023"
+	.string	"\b\201\"\362"
+	.string	"pi\033\003\251\231\205T\024>#A[\246\0246"
+	.string	"4"
+	.string	";"
+	.string	"+ZD\204]\225\334\205\255u\017b\266\377\031eS\220Hq\230\260Zp\333]p\276\034uE\371/p\r\311\032\257\f\032\273k%Y+\367\274\355\n\333\027\366K\002\030\345I\b\304\013v\362\336\351\334"
+	.string	"\230]\366\331\311\207y\304\244'\337\371&\357\335\247&\b\320\222\261\2444g\227\243N\027\373\230\235.\373\352\251j\275\372\r\246\243O\273\355\271\003Q\306\200\033\310\263?o"
+	.string	"\302H \3202`\023yv\350\fD\231\227$\024/\233\2029-\004\3404j\235\376ZTs\264\035\036\201\311\346e\203\374"
+	.string	")\263\273\001\366p\304\260\024\216@\222\370\021\t\211\035\240G\2503\002=\"\t\344L8\374\370\210`)\fE\360+\367\230\235\256\316B-5U~\320\017\3027<\233\243\243'\375\330\342*\240\314\026"
+	.string	"3\241\307\037\030V\353*H%\007\262\2504A\202\215\\\342:,l\007\204"
+	.ascii	"\203544sY\037\263\352y\313\206Z\262F\t\342\232H1\004\3622D\270"
+	.ascii	"\034\213v\222\001"
+	.text
+	.section	.gnu.lto_motorWriteAll.26.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\275\f"
+	.string	"FXWC\020\221\232\016\360\345b\246\262\200T\371l\273ia\3160\242\366\302\200c44\377o\177\347\004\032\325#\"\226\b|\340S>\331\233\233\r\007"
+	.string	""
+	.string	"DV\320\262\3358\177\004\245v\b\232\317b[\333\233H\231RB"
+	.string	"C"
+	.string	"D"
+	.string	"\320\336\tP\207\361\003\250Ck\366\f\003\027"
+	.string	"\330\300\240\242\306\356Z\nBK\355\223\246\346o@*\256\333>\305\016\327"
+	.string	"\035\313\324\261\273\037=[\272\225\314\r\310\356:\271\216\303\ro\033\202m\006\366G\002\206\232\316L\277j\360\241@\214]\r57\226\004_\204\370w\373\236\017\203\342)\264\177\206\021\267\rQ\346\313P\332]\217C/\210\207\035\3239\266\237\366M\374\204v\221g.`\027T\242\305\256\247\300\b\342\003\177\340BSR\r\031\205J\215\360\311`I\032\333\025.\203\342\300ga!\213\273\373\227\024\3520\265\022=\346+R\374\027\227\234\344\271C\377D\023\214HxP\311\032\333\333RC%\0274HV\220}\321\037\377=\236g\235\222\t!&\224E>\260\213\344\372X\031\3261\361`\022,\n\236\220\217%\202e\326\307\001_#\035\314\"\271.\314\342x{\005\215\036cF\220Tte\322\220\017\363\312E\304Lz\034j\213\315\221Q\355\317\225\347<\351\026\026"
+	.ascii	"2\003\376\031c\301q6\371}gX\276df\265D\022*x\242\027\b\306R\227"
+	.ascii	"q\255*\264.\026D\240\252ppwUc\326J\264\270\233\301\200CM\336"
+	.ascii	"\256R\006"
+	.text
+	.section	.gnu.lto_motorDeviceCount.27.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\355\007"
+	.string	"\202\21765@\217\322\001\2335\220r\023Dd\316\232\304e&\343\004\034O\004\230/S\263\026Uk\216\317\"\373\352_\264(\212\206\217W\363\326\005\210\013\255\377\021\331[\312\224\002\346l\"\004\301\317\273b\347\301\023\025\336\202'\341\3638\361z\033\002C\206N| \b\343\313d\373\266\212j\252!i\204S\233\276\324b\370\220\206\313\356\036\370 \020\327%%\262\356R1\252\177<\023\371);\204\362\246;?d\335]1\024\244\\\331\331(\025\303~[E\331\232n\231\316\247\357,\025\312@\312\256\304\212eO\334\310\206m\314\316\370\034\357\300\354\222\226i\234~aQ\022Y\331\335\247\271\200u\327\036`\335i\306\261'\346\337\343\315\244B\305t\032=\001\020v\327i:M\334z\333\005\266\rl\223\004\f"
+	.ascii	"2CC\r\354cBIz\2532v\201\361\b\325\236\013\371\354\260\247\005"
+	.ascii	"#\304\265b\022&\031"
+	.text
+	.section	.gnu.lto_analogInitEndpoints.28.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\350\005\305\037"
+	.string	"\026\371\304G\240V\322p\304\233y\355\177\003\025\227\256`\305\001ezt\311\016\017sN/\241\001\315\201\246\317\271\263!\373\235\227\276\345mx\177\214\372\206+\2434\322(\364Z\360\026tl\342\324J\177(\351\241T\3116\273\233H\231R\263"
+	.string	"\223"
+	.string	"\265"
+	.ascii	"@J\354t\235'\212\263+gXI\244\306\223\267\257\345o%\235\2649\245"
+	.ascii	"\270\201ZBUv\236g\001\022\266\227\317\331C\276~Bfl\brU\274\200"
+	.ascii	"\225\204h\177X+'\346\034\372\330\321@\221\347\021|\017'i1\247"
+	.ascii	"\ta\213\255\363<\207\274\300\366RG\273\332\327\361\035\301\037"
+	.ascii	"G\\\346<\247\310\266\316\0239d\002\266\227F\336\306|i;\215\371"
+	.ascii	"\322A\233\354H\031g\355\005\r\250\253*\347y\3566\306\203/i\253"
+	.ascii	"A\277\306\340V4:\275\\q\032\316\270\342\373b\034\322t\347y>\353"
+	.ascii	"j\302(T\25518\317\323Z4\252\270\315\333\246`\233\205]J\tz\236"
+	.ascii	"\247\323"
+	.string	"\276\311\374v\360\361d\250V\214S\335y%\323\366\201\320\027\277-X]a\303u\262\221B]\030\366i\347N\331\037\362#\270\220\377\300\223\267\320\261~\002\357\361\007\375\307?\340A~\001?\376\001T\255S5\220\252\177T\355c\252{L5\217\252wL\265N\251\316Q5N\251\276Q\265M\251\256Q5M\251\236Q\265L\251\216Q5\214\252_T\355\242\352\026U\347J5N\3257U\333T]3\325\246\251.K5\315To\251V\232\372\n~\342,\030\376\304\311\314\346\240x\231\311H\305\254\314\356\224\fg\"\026\263.N^VG\030\032c/\013\263'V\355\276\354\275\242\316\\\252T\254\030Eh[\326eO\224\022\266\354\215DQ!\226\345\326W\022\304\341dK\023*\337Z\346\313\027\243\3406\267\232E,\323\360$`\270\275\331\3402;\322n+\264\307b\333\332\336\266G\214x#h\235\274ux\236O"
+	.ascii	"l\353\223enm{\304\210e\345\356\232\233\363E\254\022\352\231i"
+	.ascii	"[r8\222#\347rr\324\335=T\026\027\275\313\310v\236\303\005~\221"
+	.ascii	"s\035\371T/\235\324\323\027{\346K\335o}\210\007\227\325\361I"
+	.ascii	"\317\002\300#&$$\t2M>\242\031^\202\b\274\245\242\016\274\242"
+	.ascii	"#\036\215\322\257\210\251\3073=$\365 \340\232|7`O\251G\004\f"
+	.ascii	"\361\001\030\302\227K\352!-\371\034\344ld\340\347\003\372\224"
+	.ascii	"vL\277#\021\275\037o\267\324+R\332\031\375\230v\006x\354\373"
+	.ascii	"p\364\333\001}\276\337.\207|\372N\371\301Y\330\323\nK\035\320"
+	.ascii	"\356\254n\315+\242\324\317\372,\320\215\240\375Y\237)=\353S\306"
+	.ascii	"\263:\333\263:c\304*!\317\362\024\201\312\242\263;k^\021\313"
+	.ascii	"rVg\302\245\344\354\315\005\230\031N\325\315\342\254\212U8\224"
+	.ascii	"\233\275\031\301\254lp\324\254\215\205\223\215\005s\\\260\215"
+	.ascii	"0_\326\354\263>@\311\227\031\215&jfiv\307\002y\250qH\003\rr\210"
+	.ascii	"d&(HRPh5\340\002\031\252m\007\02109ED%\205\222\312\001\022\316"
+	.ascii	"\317\033~ \021\304+7yq\206J\r\324\367\217\265\354\313\323\274"
+	.ascii	"\210\276=m\027\020\341|\342C\037TEj\017N\321\265\317a\344\307"
+	.ascii	"\365\242a\223M\365#\037RdR\310\322*\327\305\345\317\224\356Z"
+	.ascii	"c!a\256\253\221\216U\021\344)\214\006?\363\241\2717\262\026y"
+	.ascii	"\032\316\030H\371P\237\302\222\345n\364\236\016\212\213N\034"
+	.ascii	"\013\356!\320c$\027,K\314\202\213\027cdl!m<}A\t\201QM\267*\260"
+	.ascii	"\224\3262y\035i&@of\256;\220\310J\017*\221\3135\031[@4\272\364"
+	.ascii	"g\376\317\007\236u\204\026\030/\344..\023\006\260E\037V\312\305"
+	.ascii	"5;m\254\206$\373^\313Q\f\333\221\377"
+	.text
+	.section	.gnu.lto_checkMotorProtocolEnabled.29.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\207\001m\020"
+	.string	"\366^qH\340\262(\035\220\201t},\362-\205\230RN\307P\350\177\321\fxu\002_\346\203\342\363\001\230/'r\366\177\303<\002\365\026\354\264\201\226\353s\206\0318\307!\005\020\235\004\304\273\313\236o\347tXA\006b7!{\247\024Z"
+	.string	"X"
+	.string	"["
+	.ascii	"\336A\350;\333\036\211\240\262\370*\323\362X\214\227M\217\335"
+	.ascii	"\372\315\025\027O;nJ\321\247\331\324xl\343\352\324\304;\016\344"
+	.ascii	"E\306\216h\f\301=\330\231I\021\032AH\356\265+\030}Z<\266\321"
+	.ascii	"\34534\266\270\220\335\025\215.)A\026v\327\222e,q\203n\333d\273"
+	.ascii	"\304\376,\273\273\2361\366\353O?\373\273\323n\311I\337#\340\002"
+	.ascii	"\006\023\263M\236\272-7\037\253\323"
+	.string	"\325hq\332o\253\374\232C>M\fY\325m\031\201\311\241q\360\316\030\274YU\016\324\005/=49\023\244\264O\363\032\325g+\037\260\033\3433c\267Bp\003\357\235\353\013\320w\0018\322\027)\200\230\215\027\316\374E*\247\b_\205\322\371z\303\301#\207\016\227\374\341\246\314;<\231%\261\273\f@0\235\225\374!ww5\247\314\334\023\320O\003\265\033.\371c\333\303a\240\274]\227\004\337&\365\301c\361\316_\241\357>+\214x\001\253\231\261\344\315\256+9e\366\271'$\224\f&'\022(\005r@\221\240\200#0\005\206%\250\222\200\r%\r'\360B\n\211D\344\221H\b\246@\323\207\nI)\245\360\344;\225LL\337(D}\"\b\fv \205_\n\004\303/T\367\334\316\0309E,'tX\263E\247\354\346\276-\024\003\364PpQ\001\253A\301\222\267\235\231\027\032\335\224\231\306n^\001\033"
+	.ascii	"a\221\"\023\357\371\321\274\b\222\214uE\230\024Y\223 \003\222"
+	.ascii	"Cm\235\303v|\254\223\335ZB\363\361u\250\2545\330\205{ov\257\221"
+	.ascii	"I\r+&\264\013\364@_\003\324:S\265\\\204\272\217\272\377\265\345"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_motorInitEndpoints.31.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`L\003\235\027"
+	.string	"6j\226L\260\020V:p\214\f\233\256\267\317\317\317v*\371\377\203V\367\304T\336S\244`6\331\213{c\260\256\021w\203\274\277\017\323m\337\351\b o\250\375X\261\260\177\322~\340w\322\332CP\2117\027\332d\355\276\311\267A\b!d\357$\003|"
+	.string	"~"
+	.string	"\177"
+	.ascii	"\274\016\306\356.\341\224\364\346Hy\313\374\236\373\350\376\263"
+	.ascii	"\341 \3359O\306\356\265\204I\322\233\274^\344\274\231>\344\274"
+	.ascii	"\311:\346\250\257:}\241\233\030\241\251\356n]\023\327\3754\313"
+	.ascii	"ku|\032\247\335\317\0207K\022)\244\032\036@\016\245\310/\205"
+	.ascii	"\357F\2672@\030[\036y\003@\031<(\"\260\346\227\005\344\225#\335"
+	.ascii	"\355\001\354Y\213.\350n\266> \315\031=3c`f\017\314W%\177\372"
+	.ascii	"\241\037}\320\177"
+	.string	"\036\3507Q\313\345\177~\013\300:\331\bI\\\250\265\177U6:i&\251\370\361g>\037\351G>\362\004E\207\373\022\243@E<IW\262\375\210\315\232\251`Ow\333\230Y7\231q|#\263NPp/\346Fvk\377Nn\230z\246\272W\0047\3710\351\315\263\230\213\214jD!\021\022\210\250\"\f\025Wn\020\037\r\370\350\336\020\005\003\273\236\205\356@\\,?Z&\347\221o\200\323\"\246he\222\357\2706 p\2061:.\214\226+\335\236\030\372f<w\362\237\376\"\307\337aX\314\336\027;o*\250)\021\364\261)\2338*\325\351\017\335}\340&\032L\356\354\r\333\335\273{\205\345\013\234\345\0250t\352Y*\376\221ewa!\355\356\245\360\2314\314\370;\352=\362v\305\fO\320\347\347\305V1\257<{\205\314/\373\3460\377x\356x\321\277:\361\3478Q/\330\005\026\027\r\206\346\324\225"
+	.string	"\257\004\020^4\027\313\313\005{\205\314j.\233\354uV\210\311\034\254r*\307M6\223\255\334p.7\234\312\212\311(\320T\025\026\267\230\324\324\233:k\331j\260\f\262\332\253E\223\271f\255\226\232\255eB\200U\027X\255uS\325Z\213\265\276\274\354\233\303\017h$_.\357\004\261\253\313q\323\213\336\363\232\327^\346\t.{\037\337\350\237!.\375\202=\342\356\256C%e4\257\220W8M1\305\373\347\002E\250qT\305\210!A\021\tD$*\t\263.\006\260\002\241\241\262\r\021\220\275ea\264\240\332\f'\212K\022\331\271T\370\321\204\375O\272\245\002|FX\2558k\242\260\320\211\250|\300\026'\002vN\344\333\353@\204\n\362\212\227\034\327D\236+\263\030\220\301\241\031<"
+	.string	"0\353\013\333\005x9\021\221\254"
+	.ascii	"mDb3\336V\247\314\312\252gT\245\213\331\371*\021\331fh\375\220"
+	.ascii	"\031\333\223\201\r\347\330R\375JHF \322`\024(\031\244\313E\264"
+	.ascii	"%\365y^\375\020\352\007"
+	.text
+	.section	.gnu.lto_motorConvertFromExternal.32.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\255\n"
+	.string	"\226\324JA0\213(\035\305\230r\202\315\203\323\261i\3618\262\223\314]\312\224_]\273\233\270\024\371\275Y\213K\363\200\352F\306`-~\317f\".\"\030\310|)\305\031\206y^\036\302\223j\230O\310&R\246\0247"
+	.string	"6"
+	.string	"9"
+	.string	"\366\033<\005\332\026\2600\001\352\253TI\202\207\335\3352\257\310\036\261Sd\217\212\340\340\023\364\377\340\030\003\005\035L\247\321S\363\330]\247\3514\340\326\333\306\260\335a\377\"j\300\216i\355\341\0373\255X:5\375\n\204k\203\006\207]\001\257\017\253!bX`\033\264-\2663\355\253\356"
+	.string	"|\230\342\270[ \303\205\335p\303\031\225\307\211\264\003QU\277*\271\334y\005\023\f\313\0169\205Oew9&\240t\027\026J\224=\246bZ\252Cx\004\221\217\362\310\2277=\372_\366x\275\264\b\220\362e\207\243\324\003\366\261\r\034\211g\363\341\331\200<.t\302I\230\243\361\272P\367\331>\217+\351x \033\250\263\371l\034\357\3334\026\356D8o\013u\235\267Y\302\275\255i\206\244"
+	.string	"\034\221\252N\3254\023@G\016\017"
+	.ascii	"2\003\302\260+&rV\267]\314G5\365\032c\300\244\206j\304\205\221"
+	.ascii	"(3\315\2011\002\232xRRL\327$\003"
+	.text
+	.section	.gnu.lto_motorConvertToExternal.33.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\035\n"
+	.string	"&\323E= \345*\035 !\b`\323\305\031\316@T!\314\220\202\b\027\b0\207E\200-\203\356Jh\253\247\321;:\254\234r\374k\300\b@$@\006`(\230\006v\350+\033\262\"\2737\3312\2454"
+	.string	"1"
+	.string	"4"
+	.string	"**\25744\001\2313\031\217\031\201\335\320+\370\301\274\324\033\314\313X\362\325u\345\237\345\034J,\200\353\305\272n\"v\327\352z\205\334\361\266\025l;\330G\b\017\177\216SkT\177\323\301\0060\324\354~\334\n\254"
+	.string	"Isb[ew\266U\355\313\276\242zh\232\007v\001\320fv\267\301\013\234\313\017g\333Oy\217\321\360\324\354\322a>\316\356>\274l`tj\261\324\274\324\350\261\311\336r\227\224\037\263\t\245w]\372\250y\371\330\261\301Zz\263C\226F\022\373\334\306\021\317#TEH\202\300\"\020\370\235\276\222g\002G\031$p\302\263 \205J\236\b4y\240\004\177\027#\320;}\037\350u\341\3363~Z\221\303\235r\321\032g\204\020\351\210,\333\024\001\020"
+	.ascii	"a\221\"34\030\261\302\234s1\037\325Tk\214\001\223\032\252\021"
+	.ascii	"\027F\222\261\246\250F:0F@\023FJ\212\351\232d"
+	.text
+	.section	.gnu.lto_motorPostInit.34.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"\002\31756`m\322\001@\343Id\224\267\262\336G\274\216\355\333\240\234\022\005j\027\303\240\021\202\354YWm\331\317\252\006\273\005@\310\307\206\334\212\300w\026Gl\f\273\311\226)\005\326d\246\364\310N\264\346\006\2023\027\"\003G\241\0235\323\212\231\001\313\206\315\214\036)g\254\270=\265o\224\340q\312^\310\027\265>W\030\241\207\331\226\037\221\300l\266\303E\254\200\335=\340&\036\0046\022\310r\250\017\263Qz\310K \237\344\210\217^;\364?\226\303?\230\241|\\d\332\331\034\246/\303>\265od\253Z\257>\254:N\f\272\335\212neO\260\204\303\366+_v\312\271mo\"\2410\251\354n|\032\277\256\227\177\220_4\021v\005@\330]\253&\262\270\337m\023\330.\260m\022\r"
+	.ascii	"3\241\003\f\374\353\335p\261\031c\217\363L\fe\207E\265\347B\216"
+	.ascii	"0\330\177\031\027\\\272E;\237"
+	.text
+	.section	.gnu.lto_motorPostInitNull.35.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \3005\005"
+	.string	"RI#-pU\323\001"
+	.string	"\345\276\243\343\313\205\343j\007r'\355\337R\201l\330\346Y\265\003\337\001(\235RU\0178\240\354\177\b=Bd\321\336)\005\236\244)1i\3515\251H5\033\372\250\030\226N\363R\311`\t\241\246bRN\215\274}\354\016\2228\261=\r\306\213}\301\306\316\206\321\006\244\b\355V\006\004\3663\350hl?rf\003\334\313\354?\017\345\013\330]\215\230g\207\231\177\316\013\033\247\035\022\026\273k\270q\226;\3366\302v\302\266#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_motorEnableNull.36.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \307\275\005"
+	.string	"\324\tk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\364\262#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\337\205\007\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307.\361\370\240]\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\033./src/main/drivers/motor.c"
+	.string	"\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8]\304`B\344p\347^\355|\002"
+	.text
+	.section	.gnu.lto_motorDisableNull.37.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \300\035\005"
+	.string	"R\211\"*\200k:\300\\\036\374P\031\210"
+	.string	"\030PVj\321\246\020\377\330\316\340\266\371\355\354\353d\024)\246\316\357\r\030g\257\210Hn\231\002\237\244)1i\3615\251F5\023\274\250\020\026O\363bip\311\240&cRN\216_\353v\004\307>\376O\203\353\375\n\350\355~\0303\033\311\323\035\t\201Z\023\300T\376k|\366w\364\243t\344q \227Ow\363N4S\230]\325\242\202\215\323\024F\207\356>\3348\211~\365\177\341\277\341\277\"\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_motorIsEnabledNull.38.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \350u\006"
+	.string	"\"L-4Pm\222\016g\\\205\331b\232\362Z\f\005KM\342\317\021\264\257\f\332\210_\233\301\250\305R\352JLw\020\231\331&(*\260\341D\035\203\235h\267H\310N\001\020TfSIc.\360u\236\306q \365P\301\214\333T\r\032\207\201\034w\031\3709P\320u\336\203\316\022\233V"
+	.string	"\201D\233\370\370a\215\343\023\240mo\033\317\030F\027\212\023\265\240\225\224\232H%\037\277\347-\177c\031\022qk3D\2436\"| \220\322\177\202\202g+\243\007h\242\270,F\2566\272\326\221V2\353L\221,"
+	.string	"Q\3218!\t}\222M\013mg\027!\214\274\345o\360\273\277\"\b"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\316\020gz\036|\265\363\t"
+	.text
+	.section	.gnu.lto_motorUpdateStartNull.39.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \307\315\005"
+	.string	"\024\nk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\304\263#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\377\245\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\3078\361\370\240q\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001"
+	.string	"\244\003\001\200\300\013/root/repo"
+	.string	"\033./src/main/drivers/motor.c"
+	.string	"\b"
+	.ascii	"U\b\230\347\220\254\202w\r\247\213\030L\210\034\356\334\253\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_motorWriteNull.40.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"]\007"
+	.string	"\262N44P\217\032\003 [\374\312\tu\025\216\201\035B-\301\321>\257.\3206\006)\2441\232\362\244\371\347\313\325\314\f\321\322\004\225\004IvCUm\033Dn)S\nW\303\002\350\364\034.\021\t{\ryd4\305\021,\311\353\204I\021$a\240\021\f\311\022\364\02042\\\022\232b\224p\223\335\326\335\252\034\b\027\321f\250\346.Z[w\253\266\005p\250$\260\374\024/.Oy&\033m\275i\353Z\353\017\203Lg%\251\346?A)\371\337\351A\306\217\343\001\214\237e\001\214_[k\021>\323\035\017u\277\205G\311\237uj\220\361\353lW\234e\334#\023\022\"-\377\241\303\360t\233\265C\254I\251Pn"
+	.string	"\n\377\333R\252\n\327\271mA\333O[\215\b"
+	.ascii	"2\241c/0.\034\327p<\026\006B\205\211\340\316-\332\371\004"
+	.text
+	.section	.gnu.lto_motorWriteIntNull.41.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"E\007"
+	.string	"\362\21523P\217\032\003 [\374*\302\"V\n\321s'X\351\342Q\236!B\210\266@\n\331hM\232\177\276\\\315\314\020!\315\235\212,\354F\260\373\227\230$R\246\024\026\204\303\307\344\"\254\320\350r\005u\",A\321#E\313t\305\320\033]\037\321\003E\322\353\024\024>X\361\225 \214\2173o\314\233\252\006\024\255\242\235'\3268Zc\336T-\013"
+	.string	"Qa@\371/^\\\236\342N>\332\232\323:\304\"\322S\242\356\337`Q\330\330\t\230 c\307<\220\261+c\355\202G\032d\242\355\327(1\371gB\0216v\225\355\212g\3075\253\f\013\222\226\377\257\255,\315d\355\021\003\240R'3M\303\3772T\n\303mn{\320\326\323\326#\n"
+	.ascii	"2\241a/0.\034\327p:\026\306\024\306e\352\252)5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_motorUpdateCompleteNull.42.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \300=\005"
+	.string	"\222\t$.pU\323\001"
+	.string	"\345\276\363"
+	.string	"\203!\307w\305b\303!\373\267T \033\266\221Q\355\300w"
+	.string	"J\247T\325\003z\214\371\272\205\343\206o\321\3362\005\236\244)1i\3555\251I5\037\033\251\034\326N\363Z\ta)\241\346bR\316\215\276k\354\022\224X\261?\r\306\214\255\203\377w\354lx\b\0050>\377\245\200\340"
+	.string	"\004\320\306\266F\316l\001\375\274\253\307\263t\006\376o\324h\2460\263*G\r\033\247),4\376\033n\034F\035\325\266\302\366\3026$\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_motorShutdownNull.43.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \300\035\005"
+	.string	"\222\t#*\200k:\300\\\202_y\f"
+	.string	"\241\342P\273;\335\246\020\377\330?d\262\371\355\354\353d\024)\247\352\0169K\340\2109\204\366\226)\256\250J5\212\315\254Z\217\253.f\343R`\263\252\331\244\b\246\016\253N\215\322:\247\360+\277\002DF\354\220\213\262b/\340\377-?;\0168\036\004\350\237\214D\357\0046\030\333;y\263?\033Z.\201\027\211&\364\177Jp\267\215\233w3+\350<n\243\224\370\357\330y\224\265\\\333\006\333\007\333\214\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_motorConvertFromExternalNull.44.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"%\007"
+	.string	"\322\r25@\215\222\016<YO\036nd\r\260\366\324\277\311~\251;\314\370\276\353\231Z\321\352\t\373pj\"\002\353aGQ\360\215\205\211\3149H\013\024\342\204E\244\021\"S\026D\203\006\364\336d\342\365\271:\320\023-\020'2@\007\216\246\0037\321\0033\005_\017V\204\237\353\212\360\222e\253t\244Q\006\030\t7\361Y\250\271\322\267\312\314\334\221\276\005\244L\024P\231\025)(Y\362F6~\354/\177k\337\216z`\315\"~\231\027'\"\231Y\302\b"
+	.string	"}\002\355\277\247r`\217\252\262\f\rK\210\211\002$\225\231\020S\202J_\325\201J\237\303(\326\206\335~\2642\235HD\243P\233e!3o\242\221Ew\375\017~\370\227\002\t"
+	.ascii	"2\241S/0\0368\b\341\3145\217\003\023\017\356>\251VL\302$\003"
+	.text
+	.section	.gnu.lto_motorConvertToExternalNull.45.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\005\007"
+	.string	"B\31505Pm\222\016$\243\352\246 \242\212AO3\236\250\266-\341\352\032C*\314\314n\013\373\371XjZ\254\232\03533\326\270j\260\300\255\234\230\032\r\214\321Z#D\246\227\304C\346S\255\301D\314\203q`'^\237Mt\200\020\233\f\007jb\007b\020\306\"\256\b=\030\026\241e\313j\326e\342Q\374\006r\217\343K\345\333xG\220\201\302p\312\2648\255\344IU\342\361go\371\235\373\226\032\222u\333\264@\246I\nIf.\254\020\320\352B\375\027\244\244l\315m\035\027\003\243R\305\210J\346\006\013z`\265r5\260Z\275Q\265:\355V\244\324\007\311\024\022\201\352"
+	.string	"\0322s\027\022a\364\327?\341\207\277F\n"
+	.ascii	"2\003\202\341\243\302^\025\220k\370\211E\353\300\304\203\273"
+	.ascii	"F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_motorNullDevice.47.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"?\202\210\200\020}{\273\001y\273\001"
+	.text
+	.section	.gnu.lto_isMotorProtocolEnabled.48.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \346U\006"
+	.string	"2\314,3Pm\222\016$O\312 \241\252\351\326\226\353(\220m\t\345\224=.\273j\377n\007x6S\304v\263\327UU\3153-x\033\207\030\346\035:lkd\313\024c.\317u\334\246q^\346A\363\030Z\203fa\3230\217\323.\003;\207\314k\035\347^\263\\\331\221\021\204X\304\267\243\036\325\315\030\302\203\265J]O\245\024\262\200\212\020\226\376\002!\273\370N\231\2313\213\037G&pR\222\020\222)*\245$\t5\242\361\177\336\362\001\302\347\252\027\206\250$\023\t\020\224\314\2531R\253bu\313\321i\343C\304\032\201\212"
+	.string	"\n\2319Z#\212\316\372\027\374\006\377D\007"
+	.ascii	"2\003\3020\021\341\352\273\206,!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_isMotorProtocolDshot.49.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \346m\006"
+	.string	"\002\314,3Pm\222\016\303\004a,\250)\242a\313u\024\310\266\221\346*{Kv\325\376\335\016\360l\246\210\355f\257\253\252\232gZ\3606\0161\314;4Fkd\313\024[*\317m\\\246i\336\005\002\363\032\232\003\206!\323,O\323*\004\273\207\313k\033\347^\243\\Y&BV\360a\022\337\216zT7\343\b\016\326*u9"
+	.string	"\245\220\tX|\260\364\227\007\331\305wJ&\372qd\003'#\n$\231\240\022)E\250\020\215\277\363\224\021\022:W\2750@\035\221&@L2\257\306F\255\212\325-G\247\215\217\022+\344)\006,d\346h\205*:\353o\360\037\374\024\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_motorDevInit.50.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\334\003e\033"
+	.string	"\3062\262J\260\224U:x\316\273\202_\022\331\307\225\357\334\335\314\215\344\253E:\374\265\246k}\255\203\357\207\0169\230\367\205\337\363v\221\243\200\0254dY\232p\252\267\306n.T\370\320\222\240Z\273\266m\226\370)\333PC\204\020\"wJ\001\233"
+	.string	"\220"
+	.string	"\236"
+	.ascii	"=\207U\337\324\017\331\026Od\367\244\026\024V}|2\"\260^\302\350"
+	.ascii	"\251\375\243\023wGrq\232Z\205QHj-2p\002\326K\027_c\276d]\200"
+	.ascii	"\371\322;[\313\213D\365M??#V\265\326\330\366\370\356\254\323"
+	.ascii	",\311\245;\377\274i\001\203\274\263\336\013\372y\336\354\240"
+	.ascii	"\021t\223\024 \344t"
+	.string	"|\005\177\344\202c\220\0330hi\343$\231\240\n\352\213+\370\202\254\001\362\001|\005}\350\276\202/H\233Z\353\215\2471\202>J\317\233Z\253)0H\343n\335\366\217m\021\366b\tD\265\366\016\364\221\034\n\307/z\351\231\016=P\307\244\241\240\007\272&\250\003L\025\214\345\331E\037\335\241}\262\256\320~\322Os\245\037VR\317\224\324\257/\3352G\372\003\264\250\317\026\265\271\324\345R\223K\275,\352\023\240NLGV\\\254\374,\225b\005\272\022S\245\312$?\276\364\333\367\235\376\264\242\206\321h\205\355j\372\021\333\345\334\231\274TFW\316v\275\2447\332e{Ig\303+V \007LRGV\265\026\025\274t\006;x\260\273R\227\272\224\332\005\f\030\314\227\373\004\344B\200\356\222[n\200\2657p\240\007\232k\363[\236i\266\204-\271\227\331]\236&\343oL\217^Y\t\321\210\210\334a\324_"
+	.ascii	"xH\331\002\245\303k\177\304\212\326Zy{\2359\2637\236&\211\007"
+	.ascii	"\221.SW|h\030\373M\356D\347\027\331\003\bz \b\363\345\314\376"
+	.ascii	"\351\024G\016\252!bP\357\007\314\257\314\376\351\247\304G\257"
+	.ascii	"l\2078\223\021\254Z} \370KN\220`\025\2710_~?\b\201\f\021\221"
+	.ascii	"z\364\3123\224\026\357(S\301\317\364$:\257\265\036\r93\034\033"
+	.ascii	"\213\234\255\303,\247{\355\330t7\031\200Y.\205N\303,E\016\255"
+	.ascii	"\245C;a\273\311xf\023^\306i\200\273\355\334j\261\034n\306C\303"
+	.ascii	"\345\304l\264\022\265\030\016.\027k`\3007\0253\\l\347v\303\305"
+	.ascii	"\\\305\336\311\272\302Rh\006\230\252\336\372X\b\250\275\023\262"
+	.ascii	"#\322\003\275\313\273\220\323\021\310\271C{7\344ZtTQ\214\274"
+	.ascii	"\310L[\302\261\310>\f\263\f\035\375:\323\246\360*\272\226\020"
+	.ascii	"\212\221\027\273\302\217=\254Z+\004\177\212\n\013\003\210N\245"
+	.ascii	"'`p\034\203\bA\2315\363\\\023E\246\316-0\224*\315uG\250Q(\204"
+	.ascii	"\024D\312\t$\030\021\021\232\240\300:`\002\231\271:\017\021\220"
+	.ascii	"\2657C\f\265\033\370\2210\370ypFJ,\212\001\315\3126\244\356E"
+	.ascii	"\t2\272\211j\304\252\357\222+\017E\265\265\325l&\301v\n\364\373"
+	.ascii	"\333\242\344\tx\335\262\337\022\031\037\337\330j\007\021\274"
+	.ascii	"7\320 \206\330v\2140\0319=\026\030\222oZ\023\376\240l\f\314["
+	.ascii	"\017\347\255D,\224\327\254\233,\r\345\361\255(\\\204\365\351"
+	.ascii	"Q\347O^\212\004\266\341\367\301d-\243L\300$\315 \221=\245\306"
+	.ascii	"o)\023t\370\032\316\226\004*"
+	.text
+	.section	.gnu.lto_motorDisable.51.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\375\t"
+	.string	"\026\322B<0\305*\035\200\343\003\272#\222C\025\031\0067\320\300\225\323@\242$\226\274?\001F\177wt\337S\207\\\003C\f\335\242kh\242B\026i\264\264\343\030\241\2641\002\226\f\022\264eJ\001."
+	.string	"0"
+	.string	"4"
+	.string	"[\353XBl?\343\223\335\362Q\334\323V0Rp\273;\345\307O\327\223\377\222cV,\3245 aw\255+\226\306-o\273\300\366\201}\205\262\317L>\314\023%\375\352\235_\362\336]\032\274FZ\262\215\224\346\354\021\245\322\303\376e\245\313\276Z\252Z\257\376w\216\305\001\340\330v3r\001\002!\317\006]%\364}\244 \020o(Rv\0276\022\214Z\2453\035*\211\262\r\376\244B#\332\0207\031}\273\2130ZD\b\210\273{\230\311{\247R\0032{\356lB\220\004\212\346(\364H\200\302\206\351"
+	.string	"b\020\315N8\232\233\001\203\017\236p\222@0\234\231q\177Y\351Z\020\251\245\244\312\376\307\263=\247}8\257X+v\013\023"
+	.ascii	"3\241Q\037x\307\272\226\322T\n6\207\211;\262\260\007\210\033"
+	.ascii	"\006\027hh\346\262>\346\242\241\326\251Q\342\271\206\373\f\341"
+	.ascii	"_\306\005\227n\321\316'"
+	.text
+	.section	.gnu.lto_motorEnable.52.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"\r\f"
+	.string	"\306UN>\020Q\225\016\030\266\f\277\026\301\3534\216T\001\215qK\300\250~\340\006\031\346\204\214\201\021\3417\302\325\302\031\235\001\003d\356\337R\021\024\0010\b\002H\356\021\305\t\0058,P#{K\231R<"
+	.string	":"
+	.string	"="
+	.string	"*\217\335\3054\304A\217P\023\344C,\022\256\333\036#\032\016\341\200U\013\033\035$\022\334\325\215R'\235\005\030`w\177\342\211\241\023eB,\273\353\344\272\f\267u\333\bl\013\260\237 \217~\307z\274\022"
+	.string	"\261\352\200\332\020\312\017\373\333R?\330\207\253&;\323Q\3230\323\371\364%/\255G\215\0031vI\0379VFtQ\302\366/\203l\032\377\274=\013\030\027\002Q\317\301\203H7\333\016\256\242P\361\254\371\212\354\261\200W\021\361\334\335M\355\261R\027\250\2301J\034\266#\034\205'\262\273\006\374\257\302&r\372X\217\251\222\324QO}\374\223%t\362\\\276P\264\214\223i\260\215\206\231\220\321\030`\0172\n4\330E\333`\024"
+	.string	"\316 `4\214\223e\032v}{59\226\366\306*\244\2428I\033\323 \317Yu\263_\240Lx\360)\0365G\\i\250\001\034"
+	.ascii	"3\003\3569$k\340\261-\313\207V`\025p\306\027\330\240h\272\b\301"
+	.ascii	"C\034\n\321!k\213GX\006\013\325X\201\305\326\267f\257P\213\327"
+	.ascii	"(\361\\\303\345\206P^\206\b.?0JUsj\306\331\256R\006"
+	.text
+	.section	.gnu.lto_motorIsEnabled.53.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"]\007"
+	.string	"\362\31525`m\322\001@\003\023QX#\034\030\2757\204\001\222R\002\004jX\250\020\315\"{\257\253\266\273Y\325`\267"
+	.string	"\033X\230\355:\002\373\211b\233j\007![\312\224\002\326d\340\363\274\216\273\340\006\202\003\031\\\003g\241\3434\360r\031\001?\207\rt\236\367\240\303\304}[5\251\016\214t\302\366\365\017\314\262\273\b~\224x\260\234@\326+\325\013\352\036G\201\374\223#>\371\354\225\377\261^]/\026\243L\331Q\224za\277\255\232l\2475\323o\001#'\n%\273\244\324\312\232T\"\033\266C6\306\006\007!c\217\031\244k\244P\200\250\354F\247\030\307\236\230\377\2167\222\020\224\254$z\002$\354\2563+U\334z\333\004\266\013ls\004\013"
+	.ascii	"2C\027\r\f\304b\\L\b\020<B\335\347\032\376\030\341\226\020$\334"
+	.ascii	"9S;\237"
+	.text
+	.section	.gnu.lto_motorIsMotorEnabled.54.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\255\t"
+	.string	"6SD;0\345(\035\236\213[\224s5I*\340\317"
+	.string	"u\034rJ0s\351\351\031\326\321\373\320V\1779\n\372C\f\266!\300\306\025dA\204\320R4fL\311\216\234\200\376H\354&r\247\0242"
+	.string	"0"
+	.string	"5"
+	.string	"\341\201\r\270K\333FH(\331\364\260cu\217\227\324I\200\335p*\307M\217&\377!\327@`0\025\353\364\270-\354\256\243\212\205q\353m\027\330\236\366\271Q7\354k\253-\333\321\333_\277\324h\225\321Q\213>7"
+	.string	"\240\205\001ew5\023\260,r\345\303\366m\227\354\214m\215\177QXw5RTv\003\252wI\rpw\223\210M\314vxI\210\333]\205K\237\244\302\323\304\\$\314e\324\215L\344#\017I\276\313\020`\274\352\322\0071\227W\215,\003\025gvx\n\023\240\217\250\223\366t>o\344\205&\370\201$\272\3573E]Chz>pv\b\354=\200\2769\362\274of\302\275\266\332\332\224\203R\013\013DUG\335\224s\241'K\r\f"
+	.ascii	"2\241\035\f\034\371\205\313\352\f\227q\320\330\005v4T{.\344\271"
+	.ascii	"0\006\247g\203&a>\001"
+	.text
+	.section	.gnu.lto_motorWriteAll.part.0.68.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\227\002\025\025"
+	.string	"V\350\207I\300\322Q:\242\340\024\026\310Q\301\221\327$\324\325-\227\256E9\2419\347\303\"$\023\243\200Iv_-\322\237\365\267L\204\353\177\261\347\246jr\023\004A\020\004\f\"\300\334\212\347\030\031\f'h\034\345\177+\371d\023)S\np"
+	.string	"k"
+	.string	"t"
+	.ascii	"@\264\253p\321C\346\324\3711\232s\\pi\005\342\245\307\007\b/"
+	.ascii	"\305\213\204\227\366\177l\317\354\245\217;3g\232\2754r[\365\250"
+	.ascii	"\021\3321\347l]\256\b\377wp\274Wi\227\340jH\363\317;\n\247\253"
+	.ascii	"]*N\347\341 x\272\335\220`\351f\300\224&\246\243\373\2566:\031"
+	.ascii	"\335\224O\207\253\310\303\323\2039\247\305\017\367\351\266c\266"
+	.ascii	"\033\330\212#"
+	.string	"L^\035\033\245f\255\032\344\244^\211jU\352\244F\205jQ\325\247\217\177(\325R\252\301\023\335\013\252u\325\027\t9\2404\347\315\317\307\314\221G%N\364\333\367\211\036\344\373\254\352\315L23N]\216\347\367X\\\210\366!#\211\265\234\330\"h\003\323\234\263\344\322\f\304K\022\360>of\253TV\3758\033\031'\207\234U\355\247x\307\271\326d\004\0168\347\234\273;\333&\337M\355g\340\334\240\t\301Rq\235s\333\232wQk\305\351\270Q\213c\370=\276\213\3669l@\310\r\367\264\2479a\323\237\301\273F\b\256\334\323\230\260-\270\241P\315\017\373u\030\031\f\330\024\376\002F`g\316\211\342BC\005\277\347\322\217\t/u\357{\202\332\020\017 \031\375y\277\275\244\233Nw\347\r\237\262\323\024\260\273\2740Xp\301\204V9\221\305^b,-\027\331\013\006&[i]\200\271XZ*2\227\326\311"
+	.string	"\307Z^\262\326K,&k\251\276:6\357\342\020\n\0332k\223\273\363}O\331\360)\332/\b"
+	.ascii	";\310\261m\3156\204\323`)\220\004\023\260\302\332\363\216`E\017"
+	.ascii	"\334\235%OXr\020\036M\355\256\315jw\277\024\2444\243MV\355j\037"
+	.ascii	"\341H\022\3049'\212jQ@G\227\0213\301\245\0016 `\002!cX\036z\n"
+	.ascii	"0\303\323\bb\017\262j7\341\020\253Xfd\373b\033N\341\ri\230\353"
+	.ascii	",\355\372\201\034g6i\310\307\320Z\202E*\344:\247%\036\203\336"
+	.ascii	"a-\262o\240S\243V\313\336q`\367\3362\207$8\nNX\3310\202\026,"
+	.ascii	"\306\334\"\271\246\262\200\344B\300\002\340\206q\356j7V\021\246"
+	.ascii	"4^\235P3\335l\006\250\005\2741\343\356\204a\246I.an\332{\202"
+	.ascii	"\302\003"
+	.text
+	.section	.gnu.lto_motorDevInit.part.0.74.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\f\005\255\031"
+	.string	"\026\251\232L\220\222R:*R1\005\247\232\230\3020+\222\024\005l\272K\216\206\033s_\221\007\305\032\005\bZ"
+	.string	"p\300\37668wD\376\024\"\023\254\340\013\003\213\b`\327\231]X\b\"\313\007 \370\366\023\245\225\203\252\263\203J\351\357Fv\222\001z"
+	.string	"\203"
+	.string	"\214"
+	.ascii	")\367\253x\257\241\025\024)\033K\230\241\267\373\314\273`\357"
+	.ascii	"5\244\302\314Ng\321l28\356\006\314\023\320\035\357>@w|\256\346"
+	.ascii	"\035\367\013\f\373%\321J\0213/\2754\323\224\317\234\231-\307"
+	.ascii	"\255`w\374\255\356.25\333\355vfU\2763\351\b\354\231sN\217Q\252"
+	.ascii	"\263Go\216\355\277\354&\311\246\242\243'MO\277\002\236\003\340"
+	.ascii	" \347\334;\2507~w\303t\267\206n\274\006(=g\2006\347\245\270$"
+	.ascii	"9\n\237a\235\3546\214\320\266fS\371\\\271\2365\232("
+	.string	"\227I<j\351Lz\313HfK\267O\023\251\030\241l]\351\361\277\376\346?v]\367\373g\237\261B\205i\255}\0317\353\346\265\317c4\252\026\306\363\351\333\357*\366_\334y\262\2275\217k\254_`\212\027#^\225\\TD\214\370\224|\344\201ua\327,\262d\343\007\fv\030\354\303\204nJF\036\225\314$\354\216\003\367x\215-\330%\202v\215\335z\034\273\\\242\204\355\362-h\325\036\034\211\357\310s\206&m\323\"\234\b\r\334\220\t*K\253\244\3607U\210[\005_\202V\313\302\203\370\330\200\330\340\310\264\317\233\373\300\351\241\206!G\246\205\313\360\0359ih&H\264\343\017\261\336\240\366Z\025\2552g\343\223\335:\327\241vL\367\3579x\016T\345\234cn\034\007\260\177u\334\035\202\367\311\240\356\370LcF\222#\2147\356\242S\215\346\236\313\250Tw?B\240u\346\344G\354\001\252\371\365\354"
+	.ascii	"Mx\200\034\204\353L\320\017\002JP\250f\347\247\n\207\210\302"
+	.ascii	"\233\037\021\b\245U\227\341\372\263\006S\342\360\027\004\034"
+	.ascii	"\356\244B\240N0U\207\304\324\305@\257\036~\303\364g]\207)\357"
+	.ascii	"\271\214J\265\315S\232\021=6\212\242SWD\260\300\032\324m\272"
+	.ascii	"N\301\376U\263T\254\325}\222\265\322\035c\032h_&\324^\233\344"
+	.ascii	"\304\r\241\202P\302R\323\366\r\305MR\221\216R\260Y\275\266m\305"
+	.ascii	"E\262Y\001h\250QT\205\230T2\022D\222\026$\303\030\340\002\021"
+	.ascii	"\"\3426\021@%5\210Q &\005\345\353\370Oqa\035&\275++L\215\321"
+	.ascii	"M\2427\375m\203F\242\253'LB\226q\033\253\227\"\027(2\226I\206"
+	.ascii	"P\217\306\3417\"\252\337\374\217\300\251\350\311\340\r\313\373"
+	.ascii	"\210l\177\027oX\336Gd\373\273x\303\362>\"\274\023\3212\311V\r"
+	.ascii	"@\245F\245/-\024>D\33709W\360(\003\354\033v\252\220\3461\344"
+	.ascii	"a#\301\2359\bU\374n\235\364y\220\377\005l\033\200\251\242\275"
+	.ascii	"!\2077\356\020\311\2629$\030I\3502\231\260\215\212\357]C\344"
+	.ascii	"]\037yk\347<\026Z\024\257\277\032\260{\020\200]\215\374T\334"
+	.ascii	"y\207\370\003"
+	.text
+	.section	.gnu.lto_motorEnable.part.0.75.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\335\t"
+	.string	"\326\021A;0\305*\035"
+	.string	"\276|\333\373\324\20779\314,j\352t\rEdl\250\370\231Mxa\305\355}\3774\331J\023\303b\300\032\232((t0K\342F\273\032\033b\314\352\267\233H\231R/"
+	.string	"/"
+	.string	"2"
+	.string	"&\033\300c\256\275J\213\206l\300\356\306C\035\271\351\232\233\311?\354\004\237\352t-Pu<\017\276e\036v\327\003\0367\274\355\006\333\032\373\013\001\376\bsxe\020\241\255`\037\250\254\245\266\254\333\267U\226\255\351\314\3643\032\027\203\325\356F\255\300\206@\026\022\373\260\222\315q\207/\261]\342p\262O"
+	.string	"\2276\305'\377\245\346\013\310\214@\200\224\236\374\2030vw\024\020\202kw\035\374\223\214\220\377\"a\016\025\\4\337\3441\222\377\362\305(\377\035\006\346l\274N\324}b\310\353`x<\211X\341\211\370D\216\027\212\233\004w\026\035/\212\272\316\213\334\267U\226!Vf(MYU[\266S\355\316S&`\025"
+	.ascii	"Fc\254\254\300x8JfPZ!\351WQ\202\212-\243\302\003D\3010W\270'"
+	.ascii	"&0\316\210E\235\323i\241\315\224\235\006\200k/\246\234\226\323"
+	.ascii	"\257-c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`[\003%\r"
+	.string	"4\022W\004"
+	.string	""
+	.string	""
+	.string	"\002#\177)\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002$\177*\270\300\202\202\200\006%\177+&\177,'\177-(\177.)\177/*\1770+\1771,\1772-\1773\034\1774\271\200\00595 \304"
+	.string	"\1776\360\372\2508\271\204\202\202\200\005\0267\200\204\001"
+	.string	""
+	.string	"\003\002\312"
+	.string	"\1778/9\313"
+	.string	"\177:\002\031\177;\272\200\032\177<\340\365\321\360"
+	.string	"\033\177=\035\177>\037\177?\005\030@\005\027A\002 \177B!\177C\002\"\177D0\177E1\177F2\177G\005;\031\0023\177H4\177I5\177J6\177K\0018\177L\377\037"
+	.string	""
+	.string	"\200\200\200\001=\177M7\177N<\177O:\177P\003\013$$\004\r\225\n\004\r\221\205\327\307\003\001\365\001\003\021%d\003\022&\204\006\004\022u\003\023\242\001\003\026\013\320\360\372\250\001\001\202\006\004\031\225\001\004\032u\004\033u\003\036($\003\036'\250\270\275\324"
+	.string	"\001\344\006\003\036\017\260\346\314\231\001\001\342\n\004 !\021\342\001\004!\201\001\265\001\004#\225\001"
+	.string	"D\250\201\210\362\255RXNk\006"
+	.ascii	"\003\221\252m\003\021p\214\207\234@\t\251\330J\365a&\031\362"
+	.ascii	"D\224c\331\315\257nzm\323\024\026\020\315t\322i\345\370\267\366"
+	.ascii	"\363\n2\205>d\222f\003\273\270\252\235lA'\242gQHa\217\260\341"
+	.ascii	"`Y\366DoI\370\303&\"\340\f-\321G\307z\215\331\236\303\030A\224"
+	.ascii	"\276\273\357q\237\027\317P\257\214\004T\307;\215N=\307\004\225"
+	.ascii	">\226\350\002G\r"
+	.text
+	.section	.gnu.lto_.refs.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375 \371%\005"
+	.string	"\202\314!$\220'I\007\377\377\377\377\377\377\377\377\377\377W\340\343\343\343\343G\324\210\210\bmK\332n\255\265F\b!R\246O5\004\037\034\032\272\242N\313\237\365d\350\002\232\313\n\234\353\004\204\003\032\360\2648ZX\320\001\n\360\243\016\350T\003p\273n\212'FO\216#EG\216\037\251\037\307\r\324\215\343\305\351\305\361dz:\216\332\321\361\303~\216\033\244\233\343=z\217\363\316cb\215\250\025\276\354\t\354\315\036\331\033;A\177D\013"
+	.ascii	" \004\356\256\320\001V\241\0132\300\211\224\30637\245,n\331\242"
+	.ascii	"\310Z\244"
+	.text
+	.section	.gnu.lto_.decls.16d497eef9090722,"e",@progbits
+	.string	"(\265/\375`b,%\275"
+	.string	"\332\036}?X \fII\351\352\272J\207\324\355\357t*7G"
+	.string	"\210\350\016B\337M-MMK\267L\245U\213DG\037\f??d\337\234"
+	.string	"\\\217\301;U\371n\004\355I\317\341.\334\241\354\005l\003\036H\363\370\265\315\013m\365\016\240\312 \240vA\323\251\252\366Y\213\265\177\357-SI\003\363\003\025\004\\\332\316\007\025\252\006s\327&\026F\212\216\227\267*c\032,xs\336\241\205\352\254L\257\320`-Ub"
+	.ascii	"\222)\323\234\237\331\302\260.\354P\347\331\245}a\205lP\223i"
+	.ascii	"h\227i\274w\\c\031Q\246\305<=\260\355x\242%\201\25380\034\360"
+	.ascii	"\357\226\372\213\202\372\353\244\376\026\251\267bT\234-\352\355"
+	.ascii	"\233\232\323D}\333\325y \003@U\032*\302a\361\024\343x"
+	.string	"\203\032b\361-T\3559\2357]\006\037\222\3223\337\b\240l-\315\342\237\345RK@\251\277\2637\324[\246\332H\275\301\207A\214\372\236S\337p\352;\005\325Bg\2206\033\220\313\226\345\322\342\217x\022\225\346d\212\352\fM\205\0016d\232D\003\016\232\255\275\032\354>\251~aPG\246K\230h5\227Y\227\005\203,\344!\027D\250r~\272u[K\351\267\236\322Q\232JC\233\255\327\336P:\205\333g\316C9g\2357[\253u\331}\242\345!!\270\f\202\310\314\350\272\313\371\371\001\347\303/:7#\315\002\376\2647\370\202\355\244\276i\250/\201\372U\365\340\001U\204\n\265\307\272IC1h\262wX\213\275\027\364\314O\033E\206\t\324\342S@}c\340\273yy\215\201\357\016P-\364\006\237E\353\r\276~\366WC-\350\3505\340\340w\251$s\345\374\274\261)s\244\f\236\305'\241\376Wr"
+	.string	"83\007\307\240\276-\360u^[\340\273U/\355\r\276\277\273\232\013\203KT\324\314b9?/\250CjM\270,\376\2637\370\324\316\340\2635\f\300\300\312e\2225\201\nH/@\300\177\273TP\360w\212\003\\\003h\033\376\333\343\357\016\376\266\300\002l\017\003\355\375\375\370w\205\203\277) $\361\233\377\206\241x\360\307ov\001B\333\241\203\236\005\361\367\016\005\254/\300\177\355\362\272\220\301\373j\361\373\337,d\b\254XT\tw\360\1777\220\001\373_\022\336\377\035A\204\323\374\027\314\337\017\370{\004\b\334\325\374\267\356\357\023\177\207 \302m\376\313\345\3570[B\0046\001\307\360\337*\177\367\234\372\337\267\277o\376\316\3607\206O\371\237\302\377\267\377l\377\245\330\021\277\235\321\300"
+	.ascii	"\307\371/\363o\017\\\305g\376\253\366\267\231\325\271\340\300"
+	.ascii	"\377\362\370\255\005\021\177\013\377\036\362d\360\367\005\376"
+	.ascii	"\376\300\337\030x\206\377\226\3756\304o-\370\355\205\337\332"
+	.ascii	"\374\226\346"
+	.string	"\267\275\337\336\277\255\374\266\377v\373;\357o2\177\343\375}\367\367\227\277\273\374m\367\367\364\357\271\277\263\374}\366w\334\337W\376\226\376=\345o'\177\243\375=\366\267\330\337[\177\037\371;\353o\254\277\255\376\256\372\233\310\337S\177G\375-\344o \177+\377\356\300\337\027\374\255\363w\005\177/\340o\022\177C\340\357\017\376>\300\337+\376\336\360\367\323\337\316\277\233\177\363\370\373\204\277[\374\217\376'\373\337\341\277\b\177\003\375\275\376\235\374[\004\177\377\374\215\374\373\370\267\317\337\306\277C\3607\b\376.\376\335\3637\213\277\003\3607\207\377!\374\247\362\237\353\277\005\376\267\375\367\220\227\227\227\367\377\206\377\317\306/\200\r\004\r\265x\227\007\216\222\274\f\0365\2252h$yW\2644\335\030K\346\356\250i\346<\324H8V\270\262\370:\205\231\306\260\233\242~\304\315?k\251XS\031\3312\3159\337\245\033t\221l"
+	.string	"\215\232:\256\322\305qs\334\246\313\324\320\273tkh\335\245k\343\336\270\242\233\362\270K6\357g\301\241g\226\362qy\3425q\335%[\306:\203\313g>\362M\241\3415}\300i*v7\354\202\370\r=\227\233\364\271(7\034]l\352\177PT\233\323\031|\367\310\256\321I\305\205\251E\327\250\241\227\306\337U\356\3628\317\234\311\204\356\213\351\333\245qa\334\0314M\244xM8\037>\320\210\221\322\226\346\233qe\234y%\255Y|c"
+	.ascii	"\213\252\324\230K*\364\022\375\317\2343\215*\027m8^\\\027M\224"
+	.ascii	"\306\314\260wHz\323\203\002\353qg\361\177F\352\1771\324\377\226"
+	.ascii	"j\373\276\250\367iQ\357sS5\330\347\232\032\246&\b\207Y\0252\025"
+	.ascii	"\3143\252A)\213\006T}r\325\034\035E5\275t\241\351\322U\304\207"
+	.ascii	"\305=\006\305\023[!\307&L\234\220\226\235\363\267\005\345I\254"
+	.ascii	"\256H\315\330\027$\350\224\313w\324\365\305\214.+\330\345\013"
+	.ascii	"\n\2149%\276\260\036xB\270,\371\221Q}\351PAz3\303\313\030\031"
+	.ascii	"[\354T\267)\271\021D\213\0057O\034F>\262\310\365\264\231\203"
+	.ascii	")\207\305\306\311\020&6\213\3430\022\223&,,\365\235\304Jm\233"
+	.ascii	"\245\322R\261\034\304,Qe}@Y\251\025bS\350 D\224s\215\003Te\272"
+	.ascii	"\244\273%"
+	.string	"<\254\263\245Jyi\227SE\345d\245\366\307S\214\023X8{\305V\261V\032j\2456\312-\233\225\202\323\313\242\245\312\227\032l\335\354[Cs\354\224\333\035\235\366\231\241g\216\016\241\302\236X|\237\224\372\316\361\335t\216\357\276%\325\227{\203\357R_\221\n\345fL\321T\\\031\365\315\025e\247\202\313\0139\373\270\243R\263k\266\211M\263e\326\211\035\263d\026\315\232\331\263\206\332'V\354\026\210\rr\034\353\304\304N\375\216\220\264\216X\256']\322\335\225e\222\322%\335yY%hY\302\354T\007!\"\020\264\250Lu\240v\311o*[a\331,4\272$-\256$6\313\307\245I\227t\207\302\020[\244\203\020Q\306eS\272$-\255'\266\313N\265T\351\231k\374\214\250\350\222\356p>\364\266\226\276\240p\360{l\352{M\324\367\224,\001K\203{\021#z\013\3663 \033\333\331T/J\311\327"
+	.ascii	"\230\254\324\236\267_]\246&U\201J/I}\317H}\317\005\227\335z\213"
+	.ascii	"\233\216Y$\267[6k:\2140\201\365\236\276\250p\366E\365\220e\304"
+	.ascii	"\003\273\"(#\3269Se\365T\244E=\276\242\212(RE\027\203\213\006"
+	.ascii	"\325m\025\215\026 L1\026[\"\367\b\r\357\252\313\260\227\225\322"
+	.ascii	"\2176\365\267SR\230\211\216 O\367r+\325\203\273\0322F\246\376"
+	.ascii	"\t\246\366\236Q\260\227zl\245^\314im\017\373t\353\264\315k\300"
+	.ascii	"\301k\206\254\023\347\034\324}A\260\373\202\336\332T\020\324"
+	.ascii	"\207\217\247\324c(\025\333&&.\316\250\021\246%\213\225\367,\322"
+	.ascii	"q\273\364\271\232\234;\264\227\027\\g\026[\245\006\263:\2361"
+	.ascii	"\246\026\337\313\317\032\313\354\310\230\305\277\315aq\bI\177"
+	.ascii	"xY|\343ysS\322\225\305\3079\324w\332\225.\013\366rn\336\301\211"
+	.ascii	"\261Lk\204W\303\332\260H6\311\322\260G\r\265L+\343v\206-:\263"
+	.ascii	"\022f:\3022[\316\306hi\020\35467\265\314>A\227\2654\310\003\270"
+	.ascii	"\350>|\230QK\272\002\022\304\307Djw\270bTK\204\023\264#k.\261"
+	.ascii	"\3707\213\372\021Y\262|q\323\262EN\205_\247L\007S\333U\265\034"
+	.ascii	"\203t\314\fr\255M\303X1;k(\334A\025\025a#\037\223\245\335\325"
+	.ascii	"\035\006\"\246K\0136\242\022F"
+	.ascii	"G\223\214\305\017\n\251\207\001\003\313h%\371H\247\007]\223V"
+	.ascii	"\316J95^b\340\272p\214c\031^\300\244I0\221o\312\321\0301\026"
+	.ascii	"\203\231\211[\301Il\r\273\300.\354V;\001\325\262\027\226/,\204"
+	.ascii	"\205\254\021\020\362\006'\232 >\356\244E\360\022/)\320ACu\024"
+	.ascii	"e\f*/\317\004_OnZ6(\344\325I\261\3706Hd\310X# ,5\220\251\303"
+	.ascii	"\313!\030I\302\210\021s\361\300\314\246CH\244]p5\262\344-ww\366"
+	.ascii	"k\t\030\223)p\006"
+	.string	"\331\0132O\276|\261`\035R\b\342e\221\033\263\325\245\213u\342\344\273\245\356\311M\253\346\207z\353\354k\007\275v\326\331\317|\3643Z\242e\360\032\033\323\351\025Sq\324j\260\314\340\232X\374\232\254n\331r\347\024\300|r\323\362E\211\\AY|\347\346\320\232*\\)C\276\324\356\254\335\324S\306\2278UN\356f\001!k\260\372\352\362\212\2628\313\032\306\322\322U\265\026\027\227/\227\036OnZ36\206\300P\022\006w\257\300Y)+V\254\024\005L=\324\"\265 \272-\365\300 \352\373H_\351\033z\245\026\313L\t2=\22028P\351\311}{r\247\334)kk\327\215\002&\263\007\275\263j\373u\243!\223F\363,\276)\\)4gK\317*)l\300'N\264\204\242X\242\240S\235\225W\224\306\2339\242b\272\263\370B\351\262\240\023\023\255\033\300\031\352i\3008\201^'V\016\347\231k"
+	.string	"\267\244!=38\315\026\262\213Fv\317|9\367\263y\204TVv\317\324e\237U)\345"
+	.ascii	"\213`\230Y\271f\277gT\210\314\230\274\251\247\021\033{C\357\330"
+	.ascii	"}\262P\\3\272\364\302\300p\036)\322\325u\305\260z \345\\\261"
+	.ascii	"\271\032!kxJ\026_\350]\342\345J\323\017\273\004\254\307D\206"
+	.ascii	"\204\345\306\263\004M1oQ+\303\006\007\326\231\222\237\001\331"
+	.ascii	"\\\f\211\263\370~\365\214\261\271+\213\357\023\330\344\022\344"
+	.ascii	"\207\305\327\353f4lf^nX|\223\334\354\210\0220M7S\253\240\304"
+	.ascii	"0b\361ivlm\331\2571 Ih\204\216\034\261`aZqYYVJj:\363\004\013"
+	.ascii	"\313J5 ,\310\024c\221}\271\301eee\253,\325/\f\310\322t\006\205"
+	.ascii	"\252*\273\204S\367\325N*\304\250b\"B\304\032\321@\245\356\267"
+	.ascii	"\024m\212\262\3703/\246\246\354\226\b*\313\025\242\242\254\324"
+	.ascii	"\006o_pB\204X#\255\224\227u\"\332\352\222r\256:Q\177\241\356"
+	.ascii	"\217_ \007b\245\324\2343N[\325\223\333]Vj\312\t\2629\363T\037"
+	.ascii	"\252/\007!\345\234k\364\236\031I\250\306\327\275\356\234\337"
+	.ascii	"\246o\023 \347\034\016<s\020\230T\027\325\352,\210\311\342\374"
+	.ascii	"\2364\347!\347\362\001N\346\2203\007Q\324\231\227CC\226\027\220"
+	.ascii	"\262sI\024\315\371B\036\032Z\236h\346\013D\321\314\314.\340\230"
+	.ascii	"\235\237\316e\036j\346\013y(\007y \032r2\211\242A\314\013DQ'"
+	.ascii	"3G\235\331B\036\nB\2121\224\221.\344\250\263.G\233L\013D\321"
+	.ascii	"&\223(\352\f\3223b8\265jD\245\236\362\272\216h(\3230j\nB\262"
+	.ascii	" %z6\263\\\316-\366\"#\021 \347\246&\222\\P\216F\023\222\322"
+	.ascii	"\020\"\013jR`$\364\324\314CR\242\253f\316WB=\331h\203\345S\232"
+	.ascii	"\205\264"
+	.string	"t\351\243)\027\275\310\271\002\243\234\227\235\2459\347e\316\371\207\324\364\314y\311\002\021\225\221Q\316J8F\271i\231\366\"g+\246\005\215I\024}j\352\244-\211Re\030\317eSe9'\222\032]~\345\242\234s\257\240R1m\330Y\374|\002\321v0I\262\370:\177SeP\246s*\017\032/QWrx\001\030\336\003\202\305\261\230\\\225!\210C \243\360X\f\221T\002\205\340`4\002\035\217\310\343o\335!\222\240\250\364\265@\036\177+x\210F\274\022\225>D\037\337\215rxD\n\211JdRX\f\341\004\036#qx\341= \224E\243\261\350\343{\017\210\020Bb\022h\345!\256\260\200\242F\003\007\033\0168\032\206!\020\022{\204\024\b\213@\f5\031\2006\"@\254I\236\037\020F#\004|\210\253\362\004\0226(\327c\021\3713<~\300\002i\3449\362d\250\300\007\231\214\200\211\016$\224"
+	.string	"\200#\212\013\031\b\226\240a\250D\201\341\346B\243\021H\204\024\027\026\223\304#\221\205\372\rH \200D\211\021\374^\242\003\021\035\210\360\275D\007::\035\220\320QOB\347\256\353\316\232D\246\030\301\247\305\317\315\2723\002\n\214,\332u\307D2\370\036\020+\320\317\n\204\334\361i\361\343a\005\361\004\361\347\004\025;!\240P\001\364)\256w\335\271\200\t\023I\241\360\032\211\307#O\217\360G4\362\bI\240Q\032\201~\200-\220\306\025I\242\t#\020\205I\344\n\033\245o\335Q\226\260\356h0b]Ue\b\312\035\242\260h\002\361\304{\002pl\201\034\256@=JU\271\203\201\342\021\305\252D\376\250H\025F\236c\222\270\216\340\003\244\212\025)\344\340S\026\207\277\017BP\026\203k\222g%\001\330[\217(\210k1\331B%\256D\343\217\017\322\004q\345\031\376"
+	.ascii	"\005U\230\340\023\366\206D\022\024\215<\305\265x,\002\215H\244"
+	.ascii	"\007;\275!\321\370\001\236#\361\267\036\201\220&\210Fd\212\240"
+	.ascii	"\315\372\036\026?\034\222D\237\242\212!\221\203\t\304\023\304"
+	.ascii	"\225\347\0025\026\216\310\342\021\205O\213\024\027|Z\244\030"
+	.ascii	"\022\205\307\023\224\307\022\210J\240\340\252L\002y@T\002\331"
+	.ascii	"\234\220\\\211>D#Q\305\205u\347\247d\301\243\002Y\364\031\221"
+	.ascii	"B\344\212L\246X\223\310\037\345\221'\251\202\003\213#\317\007"
+	.ascii	"\326\242\007+\262Gy\202\250\004\2721\2018\274D #\017\006V\242"
+	.ascii	"r\305\212\021\210\306!\n#\317ZdQ\034r8\026}\200#\340\361\001"
+	.ascii	"\016\217<>>H\341\261\350C\363\036\020J#2\271\036\221\302\035"
+	.ascii	"a2\204pE\207#\177\210\311\020+\022\231\f\001T\356\260(\2568\""
+	.ascii	"M\234\030\261\366\260(\032WXh\2014\006o\206#\214<\311\025\210"
+	.ascii	"x\234!\032\327\025\231\354Yw\206#\206G\236\017\fy\210\303\f-"
+	.ascii	"\220F\340\272CBG\355aQ\354\331\031\216X\213>Ec\315\272Sb=\026"
+	.ascii	"\201~\327\3211\341\241\004\021$\240\nA$\221+\322'\2042I4\241"
+	.ascii	"\230\034\2068\026y|B\b\223\312\020 *\030\216 \016\221>;Cb\217"
+	.ascii	"p-\266P\336ta\243\333v\206\225\305u\247\340-\354D\003mr-1\022"
+	.ascii	"LD\352\225'\344\310\025\213\353\021-c1\306\302X8\2533\322\006"
+	.ascii	"iU\236\334\356\260\221\343\254\037N`4\256\224\240+?dX\374\233"
+	.ascii	"\345\325\323\357y$\032\205\255\260\214\033\271&T\021.r\317np"
+	.ascii	"\270]Q\303U\230Y\306\016,\315b\036\307O<0\221\033\327\317\254"
+	.ascii	"\324\274V\262\200\271\212\222\211\224r\200_3\276\252\240pL\344"
+	.ascii	"x\210\006\034\234\213\252e$.\310b<u,\245\364\346d\032\205\245"
+	.ascii	"\254\240\242Yp\352\021\240*\301\301dZ\214\205\234\213\275\342"
+	.ascii	"RTg1\016\3625%,w@\200Ly\262\"d1\366\201\241\032\3726\374\343"
+	.ascii	"A'0\230\264\265\2517A\277\315\207{\034;\235\354\200r\252\251"
+	.ascii	"?n\3763\277\2618&*3\365\3010\0336\260\023\315Q\017Li\314\024"
+	.ascii	"\035\307N\270)\253\245\345hb\272"
+	.ascii	"pT^\\q\371\306"
+	.string	"\212\310\225&\274d\243\334\264y\361Bb1\306\201\225f\244ZY\302\224p\016$Ifu?9,>\306X\214ot\231\245\262D\356\212\3058\251\301\312\320\3201\344\254\221QCmG\326\321\021f\266\205\247\220\n[\001\204\003\250\203\023\304\211H\3311\203\0303\206\206Ff\2334\006\023\025@@HL0\030\321w\361\001\023\300\023\351S\272\220\266HQI\320\244\240$\351\360\374\3643%di\355:c\262\212\327\331\327\240a\375\344&\274h\025\2178p\212\215&\377\204\240k\360n\344\361%8\347*\023\313X=\0330D%\361S\265\343\210\200h\307X\253n\336P[-_\210\326\346&\363\311t6g\273\367\027\245\227\271\265t=\336g\263\377o\025\223b'&i\221\314&\251\017\262I\214^;C\224\363\"\362t\305\360\301c\f\230`\025-\005G2\r#\351\230\225C\250\b4\356\210\363\220\t\367\037"
+	.string	"]K\031\236<8B5T\232H\226\261\343+\022 \260\206\332(\355\250\247\334\236\017\224w\2643v'\272JT\303nn\200bGU<\234\3059r\364\204!\344\270\376\t\327\335\021\321fd\227\203g_51\326@^.\264\322u\037eI\020\252\025\3014\036\366\304a\207J\274\031\213\214?b\021\225cX-\352]\027D\300F\313%\312\003\216P\234j\\j\021\203\013"
+	.string	"Z\\\204\300\004W&!\224/\371\265\3016e\310\2347\004e\205K\350\026\t"
+	.string	"\305|fp`\324\026(l\371^)ME\034(8\335\262\242o\356\312\252\f\3474\300#\025\214\234\305N\005\233^\272\261\244\200\373|\224}\341?\355\246;\324\027B\212\215\201\231\250\365`8\266\336\n\255l\215\232\274*\206\031\264\262\240\206\262U\273o\376\032\312\035Ov;\221\023\273\035\342?R\033\273\251\277\330S\326,\022\355-\264j-uJL\257)'^E\224_\023z}d\377\241nO\204\203P\001\263\022I\277~\270.8$\313>\221J\323\270\300\016\211\361\274\335T \220\211)q\341\375\306@-\001\341\270q\006k\322.x\304\254\226AftO\r\325\357r\305\\\013\250\201\3057\262I\243Y\254t\357\220\016\207\250#1N`WJJP\356w\345u\366a0\027\301\301\214\260\344s>\244C\017\211\374\265!C\262\267{)\354\360g\343"
+	.string	"qx\355j\303I\035\221\330\224\333Q\242\224\362\0343#\305\212I\362\b\n\214\332\b\006\"\255\255\371\275nA\340h\250\241\376\f\367\227*\351aI\332\314<\330\376t\377T\3073o{X\351\002\247\\\225G\252"
+	.string	"L\303h#4\325\221\003#\206\304\313\336p\030\357\335\233_\220\235\006\241\321\304^s\035\3372\340|4,D\030\207\354\206\024\037\203F\310\002\364\367\306\336x\252\033k\243U\201\227\333\b\037\276\377\035\251\231 Li\r\260\333\275\315{z\021F\366\252\204Y\r\317\021\363 \376\310\345\311\332>\020\025\315\021}\235\353\243%IE_\033e\352\205^\b\336\344\331\027\346v\"\344\2233\315HoSk\030Y~\377\251\036\230\350\024\334\344\031=\2038\r\334\243.\263\036Z\205\251\343\253i\224pI\377\301\317\247H\346\264\202\342\035\256i\004v"
+	.string	"\304l\005\266H\227\033_\343\205\335l\267\037Q\354\223\036Mn\025\205\206\007\210\016W\3368\035,\376\nP\312\372\002o\351\032|\251\270\266\016Bs.\230#\247s\203\234\317\231\013\233\335g)\317@\366\207\244qics6\206A\272\365\267\350\347\225\242\336\257hA(r\004\217\357\364/\207\364\301"
+	.string	"\216=\355@\322\001\353@d\321s\n\035\211\233SUB\313\324\216J\3054\001\367\262\f\234;y\3171\265J&\016\221cz\230\2548\0132\364\005\206Y\031\337VPg\234]\f[\212\325\273\241:\200\274*n\006\201B\307\001\214\215G:\245\024\274r`\313` \030\005\272{\244e\216\316}\0136\016\037\341\341\023\206\221?\220\213\245\023\267\315\200\236#\340?\312\203\231pQ\352\035\0071#D\213h\357\346\254\331\342j\371\224)\023\202G\001C\333\252}\341|\313^\254lt*;"
+	.string	"U3Cgf\206\2414\301\342\376\021zNp\217\031\200L\017#z\242?#\310N2\272 5\344f\265@@z\347\177\204\313\345\037@\345\316\032N\357-\001\3378V\2540\364UH\\\250>X\365\200\322\327\332\313\321\307\017\271\033\343-\rN\034Q\257&\342?\237}b\376$%\373B\337\300t\312l\377\374%0n\036\333\377\332`\235!\336\347\004\031\244\024qZ!\322\206\216G\373\361\316\200\366\004\360*6\034f\211\002s*Fn\312|\307e\307\323%\307\004\245\327\001\\P\013\333\361\363U\250\335\310\330\3314\021j\023\272\247-\315\353\233\376P\311hu\240(\032)\2642\246\255\372\3668\n>\231<\343\016\332\311\020\317\353\217o\021d\036\250\030\254z]\326\213^\023"
+	.string	"P\351\237\226\312\300\226\361\013\241\243\223\307\332\322\301/\353\265\217\270\352e/\212\234\005\017\345\340'\213\230\242\367\255}!<\255\313\023.\330\313\025\361\n\256\325a\227\026,\233\034\207\002\337\260\216\263"
+	.ascii	"\330\2502f\370\3356\234j"
+	.string	"\361j\371\236\"\252\340\346@H\206\211\275\344\260?\244:\326\"\330\016\2759k\006i\025\332\372Y~G\277\247\375\346\352\020\251\315\350W\030y\363\304\205;\264K\346\307v\b'\2650xX4\303$Mh\246m{\336s\257\235o='Cd\277\336\222\316\323\331\022m\252\025\013\034\021(\265\312\356[\300\357\"\260\b*I\302\023\310\257\240;\236\276\2308?\336\255\220\300\361\345\207\377\304N\332\"f\356\3730 ON\320\232\272\225\013\375\246\270\237\364\334\270\177n\372\317.\373b[\356\314\326<\no\352{\367,>\232\227\226H\306b\257\205@^\274~N\261\034e\214`K2m5\f\253\372\314\365\310\222\342q\210m8E_\327MA|\0055\300\267\177\250\327\262M\226\006\024\227\212\364\247\033\216\302\310\206\255\370\034 \250\025]ek\b\231K\277\305\347.>\030\332L\200(\236\036\376s\276\220|\036\314;"
+	.ascii	"\215\372~\374\366/\312\347\370\031\324\300\255\227\326!\2711"
+	.ascii	"q\037\273g\364i\204\031Y/\303\343\347]9\023\177\261\270\211\330"
+	.ascii	"\341O\215\213\236wy\026\253.-Gow\213#S^\332\315#\034\243\227"
+	.ascii	"\277o\001\037G]a\331\206\360\233\362Eg\306\230OS\366w\363f\377"
+	.ascii	":f1\200\337\330-k\330\340\235P\346\327\255\377\363g\220\334\273"
+	.ascii	"\317\231\350\027\372\376\214\207\377\263\027\316\331\210\360"
+	.ascii	"\b\366xD\300\360\001\032\002\277\333\t_gz\234\316\337\001\302"
+	.ascii	"\375vn(\377\016[\354_(\341\303'^\317\214\337\233m\347\r\335_"
+	.ascii	"\210^\341e\357\266\205\037\260\\\216\357\375\233YK\231\345=\027"
+	.ascii	"\373\273\333,k_}\267\002\2113\335\245\3232\322:\355\367\330\272"
+	.ascii	"\255\327\252\231\277\016\322\317\361\253\242\273\002<x\224\343"
+	.ascii	"\231}\001W\336B\337\201>F\013z\021!\367?\205\217\305\007\216"
+	.ascii	"\341\203\367\346y\314;AW\356;.\005\b.\310\203#\"i\333\371\261"
+	.ascii	"\267E\327e\031\214\026\345\202\232\203\277\250N\215\223\226\177"
+	.ascii	"\033\326T\225\343\001\261}o\316\273\226\033zM\302\347R\273c\373"
+	.ascii	"\006\376\231\354@y\321{7\202\302\367}\227"
+	.ascii	"_\303e\205s\362;?\323+\361W\263\217\346\031\370&\220}\371\217"
+	.ascii	"\f\363\275\307\025\276e\007\\\355m\377y\245\263\320\314\250t"
+	.ascii	"\355\307\201\320\327\265\216\037\370C\307m\376\317\b\300l\314"
+	.ascii	"Y\350\n"
+	.text
+	.section	.gnu.lto_.symtab.16d497eef9090722,"e",@progbits
+	.string	"motorPostInitNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"motorUpdateStartNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"motorWriteNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"motorUpdateCompleteNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"motorWriteAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"motorDeviceCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"motorInitEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"motorConvertToExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"motorPostInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"isMotorProtocolEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"motorDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"motorEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"motorIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"motorIsMotorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"motors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"motorPwmDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.16d497eef9090722,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,650 @@
+	.file	"pwm_output_sim.c"
+	.section	.gnu.lto_.profile.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375 \351\275\005"
+	.string	"\304\b\335"
+	.string	"\026"
+	.string	"\226\342\223\316\016"
+	.string	"\001\327\346\357\377\002"
+	.string	"\002\336\327\276\377\017\002\002"
+	.string	"\002\001\003\257\231\321\314\002\004\337\313\242\204\n\005\375\311\234\316\r\004\002\003\002\004\006\240\342\234\212\n\007\b\222\221\301\214\002\t\n\261\263\351\341\005\005\013\f\222\221\202%\b\002"
+	.string	"\002\005\002\006\002\001\r\333\217\352\217\004\016\017\313\322\375\213\007"
+	.string	"\020\334\270\271\222\001\021\022\265\372\242\327\003\002\023\257\314\213\307\b\024\207\326\377\370\f\002\025\213\321\247\225\016\002\002"
+	.string	"\002\001"
+	.string	"\021"
+	.string	"U\b\363sf\305V\320\2569\310\203cJ5\354\273\262a)\247\202\207\b\225\204}}VI9\2043n\232\355\301"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375 \206\315\002"
+	.string	"\304\003z"
+	.string	"\020"
+	.string	"\001\003\001\002"
+	.string	"\001\004"
+	.string	"\003\005\002\001\b\t"
+	.string	"\001\n\001\003\f\r\001"
+	.string	"\020"
+	.string	"\007\001\017"
+	.string	"\003\020\022\004"
+	.string	""
+	.string	""
+	.string	"\001\003\001\001\002"
+	.string	""
+	.string	"\002\023\001\003"
+	.string	""
+	.string	"\024"
+	.string	"\003\025"
+	.string	"\003"
+	.string	"\013"
+	.ascii	" \274L\n8\003Nj{\225\301 h\227\215\207\"\\e\360K\030\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.inline.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`\035\002]\b"
+	.string	"\302\213&-pI\223\016\326YsxP\035\315\202\312P(]\302\240V\361\261+\365\235[\333\312\351;\375\377\377\005\241\210\n\330\255\221\242Y\262\345N\001\037\030\354\340\204\r\n\315\005#0\234\203+\001\035\030\023\213\316\216\332gW-\255U\373M(1\361@\321&\300\347\307\005\376\210\006D\302\364\212\006D\302\016x\035\325I\344\341xJ\365\"\362p4;PO\2522\323^\327qj\233I\315&!Df\262\225\365\367\257\354\326P\357\215\272\374Bf2\036\177\200\3367F\230\231\271\376\031\007\002/ \240\"\221\243\363\216\244\320i\t\226\224\200\333\203\276\333j\203\035\013s\022\374\177\266\321\226\202U\271M\346\316\362Rv)H!@\362*\3176\026\326\360D\214\016\307l\247\275\004\023e\335\321rDP\237\277\214\305\033\211\373pA\035\013\255QC6%\003\353\326\300\356t"
+	.ascii	"\334_2\213\003iB\210\203\207\341E\364\314\206\237\230\335\340"
+	.ascii	"\n0\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375 \236E\003"
+	.string	"2F\023\033\240'\351\377?\370\013M\265"
+	.string	"\300T\211\370\274\375\247\263\265O\366\322\267\375\245L\001?\342\017'J\242P!h\r\037i\231\264\360kt\353\231\336\240'H\222\n\205\374q\372$\301\260\363f\252z\326;\310\006\236\276E\323\003\220#/\002\t"
+	.ascii	"A\005\346y\215\276\032/\251\342U\006'uu\227\n*Wn\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375 4\241\001"
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\200\004\001\200\004\002\230\004\004\230\004\005\230\004\b\230"
+	.ascii	"\004\t\230\004\n\204\004\f\230\004\r\230\004\017\200\004\020"
+	.ascii	"\230\004\022\030\023\230\004\024\204\004\025\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\315\003"
+	.string	"\002\204\r\027\320e8"
+	.string	"DJ\001"
+	.string	""
+	.string	""
+	.string	"SB\210\332D\336\201\220\275\311VR\246?\362z\3742\343\247)\326T\311O\277\216\262A@\210\233\330\341\202\204\200I\334\345\246z\r\033"
+	.string	"\035\323x\305\342\243cXV\300\032\203H\206"
+	.ascii	"\247\204\022\354\304\033\36295\341c\203\271\020\360M\302 \020"
+	.ascii	"\240\013\027\205a>\240\230I\025\257%\304.\306\315@5\r\200\271"
+	.ascii	"=\303\200;\n0\004"
+	.text
+	.section	.gnu.lto_.lto.b56939dd96997056,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoDevInit.19.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`>\001\265\016"
+	.string	"V\033dE\360\222(\0352\313n\213k\031+sP\035\322\373\301\325\026O\334\353\325\334mW\025\274\"\304\246\241!`\213`\345\324\370\r\016c\364`>\\n\023Y\227Zi\227Q\036^j\260\240\177\207'`\377F\366\3362\245O"
+	.string	"M"
+	.string	"P"
+	.string	"\237\335\203"
+	.string	"K\200\033.6Avw\213!\354\271\fo\251\337\247\214\372\3714\037Y\001\312b\254\225O\331\211\341\220C"
+	.string	"\213E\212r||\370\353\n\303\002U\242\220y\374\353\241\0245\262\030K\346\332\201\260\273\326\027V\207[\273m\224\355\022\373\251\332]\267F\365;\025\\`\241\331\356\206\031\221\3051i\230\270\353\366C\377\345\217\0250\370\356R\221\353\301A\215\0358\273!\202O?\360|\376c\373j\277\305]|\177\221\341#\27336d\354\206\t\274\300\363\351\360!\355\323\363\001\332\247\0032\266\256\242i\324\"\350&F\013\bPg\3769\315.\035\306\025h`\033\303o,\200t\354\256\b\306m<\237\304\247S*\375\313\247\257\322>\017\210\370\261\322\2315>\262P\001\312`EV:\213\021\026#dF\214-;\\QQN\313\t\307\031;\027F(\246\022"
+	.string	"\024H\023L\\\004.\245\033y\037\237\220\224H\236\t*uB\2458\223\222\352\264y\335(\205\324\241l&\222\204\322v\322y\033\211\001s\247Q\267\2418\256\333>\341\236\346\262D(\004g\025\301\031[\006\305\242\026\347\b5\214\002\251\341\241A\207\\\356\356\006\033"
+	.ascii	"\376\"0f \034S\315\354\022\026q\231z\327\261\320j\026\250p:\202"
+	.ascii	"\35751\302\f%\233x\n4\020\314Hp\267\245O(\353t{\304\255\321\254"
+	.ascii	"D\003\327\342\206\210\262W\254\032\017(\"\246k>\001"
+	.text
+	.section	.gnu.lto_motorPwmDevice.20.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"}\006"
+	.string	"\024\013\317"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\374\321\005\177}\370\367\261\007\177{\270\367\321\005yw\370\366\241\005us\270\366\201\007qo\370\365\261\007mk\270\365\301\005\177i\370\364\261\005qg\270\364\261\tec\330\357\001a_\357\321\005]["
+	.string	"\005\001?\202\210\200\330\001YW\305\001U\304\001S\303\001Q\302\001O\301\001M\300\001K\277\001I\276\001G\275\001E\274\001C\273\bA\277\177\306\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/drivers/pwm_output_sim.c"
+	.string	"\f"
+	.string	"_*\212\034\312\003\004\002\002\001\201\200@@  \020\020\030\223\3003I\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_pwmGetMotors.21.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375 \371\345\006"
+	.string	"rM15`M\323\001\300\020\206\r\244\025CE\202\353\307\373\256P\247\026\026*\234\303\232f{`\325\332\r\335\303\265u\024n\220\033\034\3246\277&p\250\364H\263\377\336)\005\256LV\205Q\331\345\312.\222\2620W\304\246%\242\232\017\021\242r\260bebqJ\260\274,3fR\316(\325\375\363\330!Z\264\2739\365A^1\276\306\241%4wz\350k\320\341\301\346M\330U\343\336\205}\200\335]?\217\355\0048\nHv+RP\366\004\226l\330\316\330\222\337q\217\2147\203\232\321i\370P\210|vkt=\001t\030}"
+	.string	":|\030\337\3566\377\037G\0301\241\034\315]"
+	.string	"\303\356\332QN\347~\267\255`{\301\266E\007"
+	.ascii	"2\003\336::U\bE\256!X\210<\334\225N;\311"
+	.text
+	.section	.gnu.lto_pwmConvertFromExternal.22.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\025\b"
+	.string	"&\220:6@o\323\001\320\366\234S\222\201\377\247\233\301z\340\346\017\341#t\267\364T\377\205LT\267\355n\333.\2115\2240\212\233\230\212~\340\013g\244"
+	.string	"\020:j\255m\231R*"
+	.string	"+"
+	.string	"'"
+	.string	"\025$-\273\0335/\300\274\242N\200y\0055\376]?\377#?(9\221J\241+"
+	.string	"gw\255\244\322\305\ro;\3016\307\266G'\227U\251P:l\177v\306\266\252\375\220\213|\237\023\256v1RNv\247\202\031\002^\r\250m\377\343 \237mB\315\r\216\206\227\266=\367\324B\223\241F\004)|\250\360\243\025\221\236\354\031R\230a\237\332\33554\331P\255\237\377\251\205\221\001\313\256E\227\367\261\034>\026H^\235\304%`\317&\303\270N\347m\235\247u\262\210-r\362\202\300\344C\004aV\026=\222\213\033\004k\333%c\247i2f\002\007"
+	.ascii	"6\213\201\n\201\3155\205\001\023\004\2340R\255t\204I\006"
+	.text
+	.section	.gnu.lto_pwmConvertToExternal.23.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\355\007"
+	.string	"\242\01787PO\323\001 ;\215\375h\324C\213\201e\326"
+	.string	"\240\340y\025\326\315\231)\2425m\377\350\266\271}\"mlKK\314\224.\340:\252\025\2545}\227\321\0305\262wJ\001\026\367\360i\240s\233\330\306\240\016vi\236\215\3136nz0\211Lj\324\212\270\250\203\204\270>\230\004QMv\016<3\213\312mN*]\367\323F\222#G\024'\374\b\343)ZD\260d\327\020\214\034\366\247\335]G\222\341\353\377\251\322\2001p\331\265(\315\354\013\245\362a\273\263\005lCh\237\344%\335\253Q\034\260\273\302\222\262\273\tV"
+	.string	"8\305\231l\373\"\037\351\354\301\352q\261\331\370*Ndv\253\034xAu\n\236\240:\025;\356\035z\376M>\205d\304|\243\320\241\206aw\r\277\021\306\035o\033\301\366\202m\220\t"
+	.ascii	"eD\301\231\030\236\n\214\313(\223\306\350\300\004\001'\214T+"
+	.ascii	"&a\222\001"
+	.text
+	.section	.gnu.lto_pwmDisableMotors.24.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"-\007"
+	.string	"\202\31526Pm\323\001\2441\002a\240\316 \"(\367S\024\3507\246)\004\3453:V\330\327\2063)\265\315\335D\362\235{f\246aU\005\326\222\004`c\366\241\365&{\247\024\326`\254\n\313d\332\225i4cm\327\304\352\206\241\252\ns\241J\260\246\246b\0233`zm\352\314(\255\363\362\355\245\215!I\303S9\361\304\007\373\333dk\377\330"
+	.string	"Jv\327\300\357\270G\203\217qi\007\016|w\351s\246\313\203\b\222\t\216\024\017\034\331_\007\306\n\373\322\306\220\035\013<\021J@\310\356g\264\262#R$\303\366/\346l\223\177\027KQ| @D\273;\243\305\271C\316\377\306-\035\250sH!\354\256a\007\222\270\343m\013\330&\260\355\005\b"
+	.ascii	"3\241I\037\370\363p\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.25.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"}\007"
+	.string	"\"\01657Po\322\001\240\020\"tNb\255\247\301\016D\002B\020\240\370\361"
+	.string	"k\247\216g\315Z\343s\213\204\354\fI&\263\236\335\314,\344\005\005x\026|Q\017\251f\333\356\235R\376p.K\363l\\\266q\230\347\neR\233 \007k.\310\006K\341\222\237\251I\016\201\261\f4\345\206aS\326}f\241\312\365\f\037\0210-%h\362O56w\022\032\260\262\273\007\276\310GB>\307\243\037D\357\247G_\244yD\220\350,B^JoeW\322\203\031\3663\013U6\354Lt.\002,\273\250U\314\246\304\223\016\333#\033\300vgd\372\272\201\332\230* J\272\335*\241\306\351\037\365\017\362\001\017\024\f\025\223\024\351o\223\260\273~\247\024\305\ro\273\300\266\201\355\213\b"
+	.ascii	"\n\023]\262\230\340\r\301\270&\322E`&bo\204\030\257k\222\001"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.26.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\235\013"
+	.string	"\326\027S@ Q\233\016\244\003\256\207\f\300\024\024\363\230\251\267\254\203\241"
+	.string	"r,\270`\031\004\034\361\246\314\374\177\235rY?\315F'\023H\355+!\n\300\260\344L\025\210_Q\034\\&\260yj\264\211\224)\005@"
+	.string	">"
+	.string	"@"
+	.ascii	"\323\005P\217\316\264"
+	.string	"\021(\370\016b\301\272\253A\205\310nXq\002\353\321\237-\343\241\307V\033<\214L\324\330\335K;\374{~\376G|\002r|\236\225\203\335u\202\034\030n\275m\003\266\033\330\207\020\237V;\354\207\277u\220\277\322t\314\364\244i\315tN\351\003\240\\\220\020\200\261{\241tcG\342\212\017\266O\261\255i?\304E|\017\035\342\311n\213\030\"\273[1\003\353\261\300\007P\217\001G\021\301\377x\264\266m\324c\222@\032\252\226FU\222\bD(K\256t\322\223F%\251\252\027\315\270\246~Tr\022/1\301\377p\347\345\301G\337\243\036\257\025\t\013\033\031@Y\262\303O*\007;\230'\001\343\211\0250\315&\213\316X\264\254\273t<N\307\333.\032\005\316\325q\230'\3434\327&\303hW\206\353.\313\001o\034\214\273:\333\306]\224p\257\035~\360b\004\244!G\265\355y\n\207\004\360\330\335\005\376\211\r"
+	.ascii	"2\001{\336\f\343\341I!\271\236\326\\\314@e\206E\265\347Bn<\263"
+	.ascii	"\200Pa\016\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_pwmWriteMotorInt.27.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"\265\f"
+	.string	"F\231XB\020\221\223\016K\303pP"
+	.string	"bd\346\340j\177\210p\b\270\006\351\325\351~\247\315bH\340\321<[\321\323\317\302\254\021*9Y\004\375\241"
+	.string	"\250"
+	.string	"\240\020^\230\026M\334"
+	.string	"\242\265,\3107BVZ)S\nC"
+	.string	"A"
+	.string	"D"
+	.ascii	"'\360\256\370\001\357jD[\001\003\356+\026\234\273\035\\\274\330"
+	.ascii	"\355\022xAu5"
+	.string	"g\313\274CY\352\203\212I\n\034\273{\245\210sG\316?\3137\246\223\013G\n\302\356\032M'\032\356\274m\003\266\037\330\307\020\336(\272B4\365\320\357+\277\346\335\237\210FE\337z6b\n\274\354f8\351X\030\2051\302\366}\024o\021\375\204#\314P\331]\353j\213l\353z\313~\211\233\340\336\225Xw=\3108\250\256\002\002Y\r\023\215*\237\233|\211\004\tO\246\262\312\227f^R\276\313U\224\370)\326F\360\246\253?\362\256/\337r\00411rl\320$\346Mvd>\001p\220Q\232\031\341\311\356H\230!\354kvw\235 l\305\235\320\204\017\022\245\320\t\021\301\324 \234\f\373x\200B\036PH\363\310D\236\353\263uH\260-\344\022\301>\262\013d\373\\\234\003\326<\235\355\002i\332vY\335\350,\257\\n\300\214\222\344MVx\013\277\004@\331\335\006\376\212\263\300\374\224\253%d\001\023"
+	.string	"2\003\3020\317\302\272-Re\013\243\210\024\004k\303\022\214\001;2\025=\2270`\206]\\\306"
+	.ascii	"\032b\n\3472\325\324\224\302\002\256\345\2050\311"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.28.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\025\007"
+	.string	"\202\r24`m3\006\020\2015\037\301\004\024\261;\177\2071\216\363XE`\007\371\016\323\232\364\312\305%\205G\317L\253\371\243\210\250\377Na\341\bAVs\335\204H\231R\335d\254*\323h\033\246m\227\306\3420\231MNC5\027$C\245`\311\315\314d\206\240\027\306\231R\273\256)1\337==\206\246\216\257\234|\"Dk\316\322n\016\341\002J\376\033\324\"\2038\324\033\246\372\320\201\366L\325\035\213)\004\tR\305G\312\007\226\332\317\003#F\353\3511\324\306\203\217P\004T\376\211\022\351$\324\bG[c\332\265&\3764~\271\020E\210\214\376\313\230\341\316\260\253\355a"
+	.string	"\017\3441\274$\374/\364@\024nt\333\201\266\005m-\002\b"
+	.ascii	"3\241I\037\370\363p\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pwmIsMotorEnabled.29.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\335\b"
+	.string	"V\021?9@\305(\035\365aa\215\003[`\210 G\2722\373\341\313N\346!\267Y\222\223\332\2062\206\266f\2416\346\350\365qw\024\345\244\037\302aA\310\0269Q\033\377\270\267\334)\005-"
+	.string	"-"
+	.string	"."
+	.string	"\266\235\260`r\367\351Z=c$%\322\262;\245n\274\373\353\374{\034\262\\\250\250X\247\277K\303\356\372\251X\025\267\336\366\201\355\215m\223\032\366\341j\313\3663\374\353\177\372\374x\261H\311\234\354\256b"
+	.string	"\026%\226t\3306\331\030\333\372\376\222\260\356b\300Hv'\202\025\004\036\003\024\266\265\207t\231\225\335e\260=q\220\007\002\327\356n`\237\234\317\361hR\351]\365\350\227\002\036\241\016|<\275>\025"
+	.string	"\365b\366<=\r\021\037O(\213\356h@\031\307\031\221D#\222\306\001\225D\222\333>\020\331\346\221\241\314\001$;\033'5\006\326D\237M\2164m\223\230\271\207\253-\250\005(\r\n"
+	.ascii	"2\241\267\037\0303\023o\2331\202\240\\\3039\260xf\2103=\017\232"
+	.ascii	"\332\371\004"
+	.text
+	.section	.gnu.lto_pwmWriteServo.30.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\315\t"
+	.string	"\326\023G= \305j:\3478\202\020\002\200\254\365-\207\322\254\244\013\001b<=\376_54\240\022l_?\324\277_#4\205\020a\254\020\300b&\215 \203\364\304F\253\266\"\001\020\263\275\311\336)\0054"
+	.string	"5"
+	.string	"3"
+	.string	"\026\246\273\034\256\330.\271\361\002\346\325\243\335r\262\265\177\225)\030\200\335\345\250\307\307\317\321\277\3113\252\325\351\363\022\261\273\236\252U\306Mo\033\3016\204\355"
+	.string	"\001sN\177\273\210\260\030\240\354b\314\004\254\254\246\204\330\276\3066\235\366I^2\236t\351\314\256\312Jlw7v\300\274\036\234`{\325>\260\275zN[\201a\274+\324v\305a.\005Z\273\333\340\277~\022\372 \257\026M\363\252W\337\264\275\026|hLz\372\260Q\246\006\240\346\314&O\223v\330\327\226\262\354\223\277v\327\037\2358\341)U\212\016$\362\252?\234\220\027vH\342\210$~\235\220i\304\205`W\362@\020'\362<!\356\003\206\034'\301\337\250\0039\322\367\201\234\206\334kKY\226\030\221\241\350\205\265\t"
+	.ascii	"2\241\375/0\341\002\202\031\226k\270Y\026\036\241\302\030p\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.31.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`Q\001\005\017"
+	.string	"\366\233fG\360\2568\035\2623\366X\033\3225.l\235\245\341\365\005\rw\350\270\235\0328\240\033\3762<Go\316\210?\374\371\360Fr\214\200\032\374\365\336\234\240=\017\246<\310\271\361\026'+Z\356lP\244\275HbB\366\226)\005O"
+	.string	"R"
+	.string	"R"
+	.string	"N\260=\263\355\2178\213\311\247\001\345\312\t'eC\362BSk\331\271\274"
+	.string	"\355\331\366"
+	.ascii	"\332\263\351\341\264\247\323\271'\237\303B\235n(\237TALC\t\r"
+	.ascii	"V\212r&+\\\207}KX\252]\fO\255\325\273b\235\334\331m;\260\r\262"
+	.string	"\277!\377\366\226\037\203\256\265\273\374\364\257\177\275>\200\b1\232\026\034,j5\271\261\251*\262\023 l\233l\316\206\031_\022h\311\260\240\370@\260\300\364\027\371NM\315\304@\240\345]\246\273\224\266SU\251V\203\355Yg\275\373\226\013\337\2505\205F\246\326\362@#3E\271\325\246]\001\334\2572<\252\211\362NmzI^\320\351\307\334D\311\377\3400d\277z\346\207h\3178PB\264Hd\030\331\033\006+5\2619U\274\235\324v\036\366\rW\007\016.fR\250\266\306.Q;U^\030D\274x\246\330^g\034&\240\210G\310\003\211J\243\350\303\033I\r\222\210\344x#\b\351\341\201\204\276\017\207\3027A\024>\020CR\br\006u\200\337\370!\221#\022\031~@\221Q7\212\236\205O\fu\242O\002\330\201\304\261\353(\340p\344\211\035)\f\305\216+\353\3514\260\202\301\326?i\237%\323\236\033"
+	.ascii	"\211N\306\310\263\b\303b&Z\326\243O\263P\217\025Ut\002\205\375"
+	.ascii	"2j\275\243\302\273Mh\256\031-D@\271\t\005\324\201{}\222\204\271"
+	.ascii	"$\004\013\302gj\024\216\031\241\271\342\247\213M\tMcPP"
+	.text
+	.section	.gnu.lto_pwmSimGetMotorOutput.32.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`\370"
+	.string	"\265\f"
+	.string	"\026YXB\020\221\223\016;a\201\202\240\234\314!\201\240\317\r{\237\006P\fl\364S"
+	.string	"\314M\203>\274\265m\350\305z\326$\257MY\005\375S\005"
+	.string	" `\220t\332\tL\312\013\202\006c\034\210\032!dK)S\nD"
+	.string	"@"
+	.string	"H"
+	.string	"!.\242\263OjJQ9\214\017%,3v7\303N\240\372\323\013\250\376\322\303\273kb\347[ \212*\275\214H\237+\207'"
+	.string	"RH\261\335\375\210\243\tI\204h\201\354\256qD\332p\277\333n`\373\303>\204\242\374\330\246\017&\212}\335<\261\025}}\345\267\024\255\212NDc\242\217\331p\361\002\301\212]\r)\032\353\362Z@\330\356l\016\333\210\266\002\006\335W08w;\234H\261kJ\340\005\327\237m?ye\312\310\320\"\204\251\0137\341\323\265\273\037~\211\263h\276\312\237#l\317\337\022\323\002\302\224\255\304tPz)\251\001\302\224j\242 \356\356'm\241zv\224H\304\020!\312\027b{\t\225\315\361\340G\317\002#\026.\001\0252#$\332\263\210\307\246qB:\236M\307\243\t\331(l2\016\227\231\240q#\031\211\366`\313D8N\346q\300\232M\206\313:\032\r\227q\230\366\272yb\314\001\035)*P\240OG9\200h\027d@\323\304\366\225\030(C\326\314\023"
+	.string	"1\013\r\267\002\005\222\361\024\301c%g\216"
+	.ascii	"\206\265\260\214m\226\035\241\210\326\250\"\342\276\r\341\271"
+	.ascii	"\206\203\320\002\250\214\t\007\251!\213*\267]E\017"
+	.text
+	.section	.gnu.lto_pwmSimGetMotorCount.33.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375 \374\375\006"
+	.string	"bM15Pm\222\016d,\242*D,\256\254\265\360\253\364\002?Ok\371/g\305\377\273\035\303\242\3266\321\226Ph\316=3\323H\255\376R#r3u\202\310\332'D\246c,\025\225]\264\355\3226\353Ri\256\230a\031\b\ns\210\017TC\0251X\026-\006[W\006\213\232ea\261\313B\321\260\300\003%\376\255\036\\@f.\334\216\22247\243\323\021\233\327O\247\273\251tzP\200\344y'\337u\036\034})\tE\377\373\301\201\022\tBH&\350\304$G&\020\215\237\363\004\277\002g\256\335\005\2502\332\230\370(ev\021Z\224\353\343n9J)\301\020\371\204:}"
+	.string	"\f\231\371\373\204(:\354\177\360'\374\025\001\b"
+	.string	"\001\023\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\261/B\f\3235\311"
+	.text
+	.section	.gnu.lto_pwmSimMotorsEnabled.34.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375 \374\355\006"
+	.string	"b\31505Pk\223\016"
+	.string	"\236\233U;\351\030\253\246\252\360\003:h|\272BT\251\035\204;\002\003\243\255\211{\231\030\201\201\231\031\216\033\372\013E(b\372\241h\330O\210L\001W&\324\204Q2\315\312\264\212B]\254\210]\226\207\351j\210\016\023\003\025+\027\026'\005W\226\345\212YU]\261\313\302\317\220`\003#~\255\031\233@f*\\\214\212.7Ti\b\314+W\351b"
+	.string	"*=8 \332\274\321w\232\007A\337H\302\317\377~P\342\3618\030erF!\331!qX\374\231\227\374\t\231\267v\025\234\202D\022\032 \231]\204\024\335\372\266\333\213F>B\033\\G\323\027\260\220\231?\256\343\351\260\277\301\217\360O\004\b"
+	.string	"\001\023\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\261/B\f\3235\311"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.part.0.40.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`8\003\365\027"
+	.string	"&\253\227I\300RRcR\240\336\202Bd\246\352\3564\247j\307\033\336hM\001\331\033\2607\tG\021Y&\210(\364\240\366e\345gTZ\244\026\270\2540\317D\227\240\256\347\337\360\2738\266\247\203\215O\330\227\372\370|Z\310\330rK\231R\177"
+	.string	"\203"
+	.string	"{"
+	.string	"\247STt\347\375\001\362H\355\024\225\335U\340\234\344\372r8E\335{.\270u\003\326\255}#\035\320S\\\2703\217\300\031\fj\371\200\360(\021\357=a\267>oB\336\262^B\336\326\020f}<\357Jy\267c\245$\317\247=\277\234\333\017?\236\020\361\243\347\267\341\343\030\262\363CB\344\2473\256\\YI\235\352\324\347\327\243\265eB\303i\311\311\220\226{\257Y\034\356\220\333\266\261M\263\253\204\t@\214"
+	.string	"\357\375)\002\271CV\252\304\247\376\244\277\351\207\372h\337oq\026>\225]S:\003E\335\305\356R~\361\3229\357\217%H\024\022\357\2751\326\355k|\tyt\377H\347+\335\351C\273\240\236j\343\355\360\036\247\260\352\251\366\363"
+	.string	"0JX\005\303j\322\235\351\366\262\367\016\215+\276\264;\323\215\222\\\035\0370\002\353\226\204&\035)\367\312\t\236\334\332\322#\345.\340^\"\342\003\326\316vy\244\017@\243\017=Z\034k\221+\017\362\344\f<PZ_}\\_]h\350\320+\327:V;\344\t2\336{o\255E\266\025\374\225V2(X\314"
+	.string	"\364\321\242\377\032i\323\\F\315\200\003\333\030^%\033\331q\357]\201\361\030\025\374\021\267\236\231\364=\267\276I\336\236\352\024J\350\006P\350\243G\213\256\257K1v~\264\026\271\222_\t^Y\271\022\331\246\266#\365\370\363\257\364S\367\003\004\027\312\030\r\302\354\346%V\316\320pn4\230\362\226\023)o5\271\227\262&&\213i\321\310(\320\\8Z\316t\261\2318s\326\362\f\312Lv\213\301\345lp93fvc\003\273\331J\0132[\fF\223\311\314`3\266\033\f\005\201M\233\322\006\303\231\246\r\346z%\362\207\0370\272\344\025\020\"\002\205\367\366\336cmuK\257\372l-\232p\0359X\204\254f\334\2169\216\332\r"
+	.string	"\275!\261\3322\267\201cr\032\2571S\362x\303S\024B;\002G\250\2218\204\2242dJ\002\221\tdd\244:`\002!fu\033\020hY\224\264\006R\r\265U\355\251\265\355\351\213.\207\304\250\n/B\312\367\020w\016\261\204\332j\306\202\\1\275F\260\345\322\367\362<\"d4@\2626\331\203JX\223\035\213\244\243\037B\206\253\273,"
+	.string	""
+	.string	"\004<\006\027\223-\311t\330$\212h\337\212%\267\361\200\345\350\362\311a\223\036\230O\025e\341\355"
+	.ascii	"A,\347\333r\266fy\344?\367Bo\370\375L\312\324\367f\255\235\357"
+	.ascii	"0\f\310\"2,\225L\003\370\252\352\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`J\001e\007"
+	.string	"2\312&.\200'\352\2347\f3\n`\270\2401\251\021\216\206\301\362F\036#1\272\340\216\227\376\347\227VZi\245\225VZi\333\377\343\372\357\277\345\226\001\313-S\326\2042\373q\317\361\356;'{\354\335\253\241\361Mz\327\270{\306\334\261=\030\b\021\266_ZB\263[\334\330\033\236}-Z\\\b(\260\276`]+h"
+	.ascii	"!`P\250\376\361\002P\nZGqz\305\322\251\350\023C\f\372(\324\271"
+	.ascii	"\324<\342\271+\301f\030\272\034R\376 \272\3261\334\375n\202\200"
+	.ascii	"<tw'wxw9\022\" \300\002\021#\363\237)\t\3206\b\327<\016\016\037"
+	.ascii	"\310gK\265R0\232\275\035\235\2514\231\036@\2347\033\233\322\205"
+	.ascii	"\333\021\215lpb\314\252<\024:t<\013\302\226`\\\016\2022\022]"
+	.ascii	"\t\211\007`\030P\006\255\372W\206k\320\254p\002"
+	.text
+	.section	.gnu.lto_.refs.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375 \211\355\002"
+	.ascii	"\322\007\024\027\220)\351\377\377\377\377\377\267f\300?\360\017"
+	.ascii	"\364[#\204\020\322\266L)z\231\330K\304\226\343ag6\354\n\0236"
+	.ascii	"\330\t\016l\252\211jO\255\251=\031P\\\"r\332s\266\214h\232\263"
+	.ascii	"\033\313\216\323\030C+[\f\331v\3549\305*\361z\253\215\003\004"
+	.ascii	"\001\375\371\364l\f\352\t"
+	.text
+	.section	.gnu.lto_.decls.b56939dd96997056,"e",@progbits
+	.string	"(\265/\375`Q\036\305\207"
+	.ascii	"\032\324\350.T@\022\"\245\003\366\373\312\254\337oBujm7\374A"
+	.ascii	"\331\357^P\024\256D\243\316\223\205\211\237\240\305-\275\033"
+	.ascii	"\364\007\242(\264\352\003D@\004\353y\373\260\031#\335\331wPE"
+	.ascii	"tm;7\371\334\365\rL\240\364\031M\357\276\322\211\034\324Cie\355"
+	.ascii	"'[\312\024x\002\326\002\350\002\317{W\007\200\034\330)\321\301"
+	.ascii	"d\013\b}S\245\357bz~\246\177\337\2724\267\247\031m\316u?\313"
+	.ascii	"\301\202\345L\b\017l\326\034\200e\244\212\232\363\032~\253\322"
+	.ascii	"\026\206K3=\217\245>J\350\316\344l\201s6\331\314\371\314\216"
+	.ascii	"Z\016/,V\333i\241\ts\306\225\226p\316eP&jk\216\303n\210\030\321"
+	.ascii	"\212Z\212\t\203C\335\032\325\3039\f\323=}\2355\312`:\307:\303"
+	.ascii	"\3713\306a\n\022\326\221\242`\020_\340zn\306\327\024{9\303\341"
+	.ascii	"\200\251\241JM\243\334\205\325,\025\332\232\256FO\307oh\230\221"
+	.ascii	"\244\217F\231\215\271p\263\001n;\363\300n\3375\255w\355 ?@\031"
+	.ascii	"k\324\207E\360\232\253\322s\003<[W\307\r\360\316\307\364g-k("
+	.ascii	"\224\034?\264\032\375Ow^\373\030\235{\013\330\271u\ri6\372\025"
+	.ascii	"@\360>Lw\353\025\006\301c*\\\205\233$\330\212-\212\335\257\235"
+	.ascii	"6H\332\254i\364)\244g\022<\256c\022\274#\245/!}\331\213\364h"
+	.ascii	",\202\307O\270\214\233Alv&\343&\2771\256\227\354\336\265\007"
+	.ascii	"i\353\211\225F\337\"=C\371\001bw\202\017\220\236\203x=uuuu\034"
+	.ascii	"\304{\232\226`\021<\024\255\215E0\371Y\t\177q\230=F-o\331\275"
+	.ascii	"\353OO\211\016Ze\215rX\363\022^\317a\f\366\b&\270\216\361~\335"
+	.ascii	"\273r\030zo\0233\002<\314\b\354\324\2044\215\361\320w\372\225"
+	.ascii	"E\360R\006\301c \013\264~\333\"\f\206\237E\200\265\320LK\262"
+	.ascii	"\364s\026\332\022\f\274\336\373\355\317\ny\363[\004\246H\350"
+	.ascii	"\374V\200\263\377\f\344\374vg\304\224\363~\313\267\177\377@\204"
+	.ascii	"\376\235\306J\312\377\335o}?\007\240\3633\317\317\350\3178?\363"
+	.ascii	"~\316\371\331\376|\363s\357\347\364g\237(\257\373\232\237\371"
+	.ascii	"\334\303\034\016\201\337\356~\266`\350g\026':\316oE\370\331\354"
+	.ascii	"g'?\223\375,\366s\330\317`?'\371y\371\263\327\317]?\027\371\231"
+	.ascii	"\353g\033~\326\372\331\352g\344\317S?G\375\f\365\363\361\347"
+	.ascii	"\247\237\215?7\375|\177~\341g\027~f\361\363\001?\253\360\263"
+	.ascii	"\214\377K~V\177\026\341\277\225\377\036\374w\373y\203\2375\370"
+	.ascii	"\271\304\377\016~&\340\347\001\376\257\377\037\370\277\366\037"
+	.ascii	"\200\272\272\272\272\337^"
+	.string	"\371w)\374\"\352\002\255\205\325\270-YA\022\266\036\272L;{\256\301t\230&\323cZL\307q\263\345\272\313\333K\303\311\365\033\277q\333\217\213\322@\316y\265\350\202\363a\004\372\235\225\224\221,\202\007\300n,\375\316+\375n+\375\356*\005\332\031\323\243h\322\240.)\n\026\301[!%\375\023\005\323AM\312\307S\243V\3264\013Wr\006\256\364)\240\360\233]\321R\031\306f8\323:J\237\331\225y#\203\026\r'\225F\353*\334\354\264n\276\315X\354\355\326i]\306o<M\353E\366\306\240v\310\035^\330\322\263\236b\302\275ei\322\030u\243\321\226\202\336\330\2625\244\321\243=\322\243;R\0354*\275]\223\336\216yBb\275!\325\243\235\274\233\340\320\005\351\212k\362wVk5\231\016#o\230\351j\264\307\3204\316\031e\330\322\247\360\3613n+c\246W\017\316{o\257\375\243\275\256J"
+	.string	"\023\326K\372\253\301Z\254\231p\263\327\277s\350#d\326F\322J\272\346\234<e\f\226\262\311\332[?\343R\021\006K\371\265v\217\b\304`)\035"
+	.string	"b.el\224\341A\305t\222\217\t\242\345\006\030\226\364V\207\264\203\030\004\257qh\2659.\270'i\2216\302\315\356\352\032\242\244"
+	.string	"\322\\\316-]-\244\211\020\261a)\201\034p"
+	.string	"GM\226\2654\036\021&\237\205\325Pk\264o\310\211\"R\245JG\372\036\262\336{y\212H\fk7\270:\210Y\222\r\215F\333\206\266\236\335V\023\036\317Fo\245\322\333\031\351m1\345F\223\276\301\244o-i\210\225\307\022\202*B|4\372^6\r?\353e"
+	.ascii	"</:\242\370h\264\357\016\241\367\f x\310\344z{\f\220\242\226"
+	.ascii	"\326h\357\255l 5V1\373j\254\266\321C\203\216\r\224X\333`'\034"
+	.ascii	"\205\307\270\336\252\336X\324U\362y\206\006u\225|\266\r\276\322"
+	.ascii	"UE\234\267\343U\362\311R\246p\030Oq\275T8c4\256\222\317\261\266"
+	.ascii	"\301i\254fWf\357\211\326\f\247\216\306\3219\372F'\271\3316\332"
+	.ascii	"\352}\3255\200vr`x@\243\203\362n[OI\221@=l\242\204\3005\372^"
+	.ascii	"\323\363W\026\326\302S\374\271\267\307\223yoK5U\307\3204Z\206"
+	.ascii	"\216jc?5T\037{\0067{\252\233\316:\360\016\007Z\3575\336{\307"
+	.ascii	"\332\211\265\244\271J>\311\224a\2720W\311g\234\034\213Y1\346"
+	.ascii	"*\371\364\201\3230\03349g\027YK\001NG\016\216pq\n\375\320\227"
+	.ascii	"\202\270\2701\354\024\303_?\373\360d\347\265R\001\346*\371\304"
+	.ascii	"\262\205\277p[r]`\356*y\344\336\365)~&\323S\214\206\265\330\225"
+	.ascii	"\310\275=\224\003t\201\263\"\0235\2100\351\276\bY\273\241\307"
+	.ascii	"vt\270q\305\244Q{CJ\307\305\325Mn\216\250\363\2123\035c\267\354"
+	.ascii	"\226\265\201\315\332xh\304\230@Y \2676\360p\254\321\332a\177"
+	.ascii	"\344\230q\312\341\307\017[CW\0319.+\353\316\030U\032\031|ts\367"
+	.ascii	"\226\305K\031\0175,\217\032V\213w/\257K*\344m\326\255\326\215"
+	.ascii	"\022&ee6l\330e\231\022a+\347`z\031b\225\267KK\203\022/8&\r3X"
+	.ascii	"7f\330\327\363\366\030\271\241\213rG[\365\254\321\205%i\324&"
+	.ascii	"-\226\023.j\216\026\313\352\260B\345\210\223\231\225g\007\031"
+	.ascii	"#a\215\346\350.7TL\254g\243\026\007\2775\027'q]\032\2657\322"
+	.ascii	"6S9\214\034\246\003eUe\206\264\364i\022+nZ\253n\302\001\020'"
+	.ascii	"2\371@\017L\020\034J\214X\244E\362\031\016B Y&\203zQ4\034\251"
+	.ascii	"4\372\224\207\235\262S\274\346s\235\336\300\230\251ST\024\303"
+	.ascii	"\361\2759\3342P\334\264P\275\2749\242_Y\234q\351o\217\334\264"
+	.ascii	"G~\353\365\"q\202\254\310\365\201\367\330\236\2368\f_\244\004"
+	.ascii	"80\321\214F\236\343\344-\222Aad\365A\371D\302\266\351\334\264"
+	.ascii	"M\235\346\346x\257\325\n%+\022\371\300{D\354\265\227\327\250"
+	.ascii	"\2347\211\fzo\331\246\r\257if\257\251\005\345\354\321H\337jz"
+	.ascii	"\315\233\315\331p]z\357\355\235\241\371\240|\336d\215\240\363"
+	.ascii	"\316\322\376y\267\ty\357\265\332\255\027\351\244s\3361\007\375"
+	.ascii	";l9\201{O\242\305\275\305/\3173\251\221\263&\254\022\367o\273"
+	.ascii	"\327\230U\274 \253\312\230\205\343H\226u\213\306!\305\037\344"
+	.ascii	"\315*\036\311\356\375\271Fc\221\305\362\376\034\311n\325\215"
+	.ascii	"\301\255\212\357\232U\274\306\345\375\271\306\333T\342h\314\252"
+	.ascii	":\2225U\375\034\311\262\252.Y\326\365\271\306&\344\f\343E\376"
+	.ascii	"\\\262,2\227lY\345s$[V\035\311\262\224\314v4\303V\005\367\324"
+	.ascii	"\222\302<\216\306;%\245l"
+	.string	"B\372\264\035\327\345\215\273\227\313\236.2\201{\225Kd\\\023\016Fsj\233r\212\322\264\024@\312Iky\215m\307\256\345\275]N1\256\224\004\305\265\355\002\341\266b\017\345\215z\272w"
+	.string	"\251{\213|\333\356\275\305{o\017\251\\\357\325\341sdJI\335\233\004\222\272\312b\332\323\275]\006\006\255\352H\246\265\024JsB\306\2742\254Ef\336\270,dJVdr\243\356\275l&eV]\225i\364\211\204\242\304A\2316\232\225,D2\207\251+\2723g\300\212\364h\324\f7\307\326\2245z^S\372\024;\3101\271h\351+\277\020\2268fg\221\353\301\205\331m<\254\261\233[\226\336\362\013\261m\231\340\013\253\361\330{g"
+	.string	"\303\354\265_H.\217a\342\304Q\001.|\303%\325\310\007\303\3471:\020@\204\020IIK\036 \005\227\204C ~!"
+	.string	"\231^\334\204\240\372Z"
+	.string	"\231\224t\210<\235\036\024&\324\241\221\222\211\021<\027@&\245\037bR\022\006C\341\006\304\020\200LJ$\324\240\013\037 \323\013\342\215/\t\351wC\002\220Ii\207\207\310\002\310\244\344\023\342\013"
+	.string	"\205\303\r\206\200LJ#~\364\033\372\202>\024\322K\240\002\002\025+T\350}\005\005((@\301\373\n\n\204\204(P!\224^\205\220U#H\341\203\202\322\210!\222o\204\216OP\370#\272"
+	.string	"2\275"
+	.ascii	"2\275@\362\035\005W \006E\360\021\227xT\342p)\003\037qig\205"
+	.ascii	"\241\352\003\372\222|D?I\302#\241*\034\276P\207B%b\320hH4\002"
+	.ascii	"\205\240\321\t\352/\003U\030\203\310\302G\\\352Q\325\242\036"
+	.ascii	"\021\005#\"\341\217G,B\341\007#(\034\222\341c\361b\350S\203\276"
+	.ascii	"!\037\237j\004\002\220\351\205P\306\320G\324Q\213\324\241\360"
+	.ascii	"\305\007@&\245\036\265\350\003\027\250\360\327j\321\320\220\347"
+	.ascii	"1L\224\200\341c\341SZ\201\250\250\003\027D9\300\237j\325\"\020"
+	.ascii	"\206\206\206GG6\311\027\f\032\3058\352\371\222\214\216B\300Q"
+	.ascii	"}D\0300>\360\021\223\226\224r\230\204I0\206>\031\037\370\216"
+	.ascii	"\206B\030;\304\"\337\321O\206\217\305c\230 \340B%\337\360\204"
+	.ascii	"*\024\016O\344\004\231\204H\352R\fbJ,\"\032aG\375\005]\250D\241"
+	.ascii	"R*$J2\n\016}\252\n\032\b\211\324\241OFPx4\202G\374!\365\220:"
+	.ascii	" \376x\324\241\221\032B\316N-R!\224\252A\027>\3657dJ}\252/I\t"
+	.ascii	"(\034\362"
+	.string	"\251FHJK<D2xj\321\n5\370[\352\251\301%\341\321\016\311\307\302/\311\350\247\376\202\277\034$_O-R\323\013\t\r\225\020\301\203\026\351\221\t\340\217X\244.)\251K\302\" \223\322\t\342\320'\3437D:\021\374\031\001O\034\r\211'L(@\354\300\007\374\021\371\222N0\nj0\024\252B\340O\222P\230A\321\216\212YO\334r+*\315j\365\224H\336\256\240\361\033\017G\fk\314\316\322\354P\031\202\205eJ\223\365\300]\3255\245X\261\037\206\260=\033-+\263f!\210\360\360\372\322\tS\343\006f\233\267f;tM\332\226@\341\261Q\261Q\323\350\r\234\231\0358`N\234\360\332\0232E\234\251\021 tN\332\220\221\361\234V\016\236\227\334\222J.er&V\214\305.\025\217Q%\203v\314 \311\222k\364bnVrw\207\2600\236\343 \304\016(\020\272,_c__\026\f"
+	.string	"'[H\234\266\031UE\t\030\253\311U\035\001\273\341\310\021\233\244"
+	.ascii	"5$\363\211J\016\026\311m\222\237\r=-i\322\341\345\325K\016\326"
+	.ascii	"[\354\2311}P>o\220]]\034\006\b\2113\265\362\245H\325\350o\232"
+	.ascii	"\206\f\261Ep\316\2562h\327TV)m\021K\004\004\324T\202\250\250"
+	.ascii	"r\341@\210\362\230\"3##2\222&I\007b\n\020\204\242q\246\370\314"
+	.ascii	"\003\022\2004A\0223\310dd$))\224\206\315F\211T\321\\\350\365"
+	.ascii	">P\313\235\0014\"\237<\034\350S\024\0277\t\317[\037\231\377\200"
+	.ascii	"*\273\373\303\324\020\251\262!.G%*\212\032\203B\254U\265#;\325"
+	.ascii	"8"
+	.string	"\256X\327]\246\2652$\234\315\335\336\245\025\351_p\240od\025'\255\356\233QA\331\351\212\260\230\033TN,\215\001?\304\256^\256\033E\330\226\237\022>m\272\0376\036\2244:\007\030\315\277\220\267yF\270\212o\204tS\355PCw.\251\313\213\307\272\344\r5\255\\\241v\246\273\225\243\232]\240yS\374\233\200]>\004\335\227\314i\246\2174\003\n\341\354g\216\321`\301\037\273\200)\310jR\r\316.\n\264\317\004p\262\270\003\r]q\370#\023\221\035\377T\335\230ak\323m2V\352_\331\253j\235bw\242\213\r\310\177\\!\2744\264U\215\241\003$\022\324\204r\332\264z\340P\330\227G\355\201J=n\376\304\215u]\002\300\240\304\023\322\031B\243\263H+ef61\257\372T(=m\326rtAx-<\215\035\035\314FM-<\203\330\241&\217\327\234\314\213{\226\370\331\225\027\365\220L"
+	.string	"\017*\207,\030\327D\207cx\374m<\257\255\"E\220Q`?\324\236a\236\367\235V\206\277J\002c\263 o\355B\206\376\340\306\026U}\245\324Q\327\270\tuo\0217\217mV\210UvA\214\372{\247\377\315\367R\242\367\277\305I\320\314kNU\002\314\nG\001\340\032\354zH\340F\356\303.\fj\243pg\032\302\334.\341`\227E\216\360Y\366\356`\257\007\207?e\246$\203\203y\016oS\332L\243S\016H\241S3a\324\343i\2027\017\366\312f\211\210\340\013[\"g_\350N5\224\274o\326\211\373Y\211\233\264\036\345\002\255\224\035D\252\006B}\2550\304X\361@r\211\210Q\034\177\320.\203\332r\242\277\2351\201g\021\221\244\t\240\240\373\021D\215\232B\376'%\241\202\230"
+	.ascii	"\221(\\\215kX\225-\310(\311\270\351\307:1\t\373\350\233\017\332"
+	.ascii	"\352\005\315\375%N\207\n\320c\254\rZ\304\224\202\222A\326]\350"
+	.ascii	"\335s\220\226\004x\377H\313F\366\"\310&3y\241\303P\202i\267\261"
+	.ascii	"\237\3014]Y\242\224\372\205\212\216wa\373\325X'c\327xM\034"
+	.string	"\341j\307N\002\350>\276v\307\320\212\234\036X\021\211\321I4\026lYXA%BJ\243\017\333\016L1f\227|\274C6\274W\251+J\021\366\323\307\0376:\343\244\036\204\243\344\034\353\312\245d\312\264\327\235\306(gF\215Sz\366\022\037\n\351k\333\265\3651K\003T\030z\254\360\200\tH\330\021KP\r\337\016\252\3200m\003\371\311\355\220\006MT+\216\261T\335\352\261\322\b\204\003\247*\266\305#S\355.tK\177\020\320S0\337\341\354\303u\222\366\306\344\277\373\024\020+\253 W\241\256 \360\251\021B\203\307@\276\306\261\033\f\001(qG\030)\303\220X\013\366\270Qi\213\241\303U\240u\371\231>_\025\251\022\204\002)\212\245`\\~\376\324\003\024e\276\321(\337\003\315K\256.\361\016N\213C\030\235\300\330\211\021'\360BZ)/\204\374\240bF\252\354n\246T\365XW\002C\221\017\222\r"
+	.ascii	"\225\216S\251\004\374\0374\371\344\2420\260\211\203\017>\026"
+	.ascii	"\022\025\020J\303\256\277\244\205\373\301\t\370\345^\265(\210"
+	.ascii	"\023H\002\020\247/\256U\005g~\030\372\207\366bj[Q0\016i\304\262"
+	.ascii	"\322R*\336\264\234"
+	.string	"`R\255\231\241mh\307En\370\265\200\312\0247\031)\033Z\254a\030\277n\256\031\033f,o\327\370\344]6/\017o\021\254=\253;\345\fG\021d(\362`\301\353\006P@"
+	.ascii	"n\0246\302!D\264N-\247\317\240\354\216\364\001\033\315\320\n"
+	.ascii	"B#\315\273]\n\327y\370\2011\035\362\264\024\277\217\037\236&"
+	.ascii	"\204\360\265^\346*>\213\307/g\251j5O1W,\0221ES\217\350\374q4"
+	.ascii	">\267\211\345\022wM,\320\210\256j=\243j\262Z\300\324O\346V\342"
+	.ascii	"\r6N\017,\032\342\246V\202\361w\210\200[\214\350\232\246)\337"
+	.ascii	"\265\3235\3078\013\366\342\267x\370\201v09\233\3658\362t<\372"
+	.ascii	"\322\331\367\341\255t\374\2717\373\007~\354\377 8\224\355\333"
+	.ascii	"E\201\237E\256\034S\234Y\334O\364\367\354\n\3757/\377\243\016"
+	.ascii	"\357|\261\374|\260\252\323\224\361^\t^P=\310\373\346\221?i\b"
+	.ascii	"p\\\\\331;\204\347\204_\326\005\354\031\240[\323\326\362\020"
+	.ascii	"\261??B\376\363[\2266\236\301{\031n\232>Z\316Y\342\315\360h\366"
+	.ascii	"\360\323b\300\036\310\335\251U\212\273U\300\235\201\262\202\235"
+	.ascii	"3`\302\341x\353\352\032>\036\207\214\206\234\365O\254'\364\213"
+	.ascii	"w 1\357\n'\316'\300\214\260\231L\\7\347\327\\Z\001"
+	.text
+	.section	.gnu.lto_.symtab.b56939dd96997056,"e",@progbits
+	.string	"pwmIsMotorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"motors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"motorPwmDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"pwmSimGetMotorOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"pwmSimGetMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"pwmSimMotorsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"motorPostInitNull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"motorUpdateStartNull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"pwmSimCompleteMotorUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b56939dd96997056,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
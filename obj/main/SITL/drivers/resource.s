@@ -0,0 +1,191 @@
+	.file	"resource.c"
+	.section	.gnu.lto_.profile.1c156239793c8a18,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1c156239793c8a18,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\316\307\311\223\r"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.1c156239793c8a18,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.1c156239793c8a18,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1c156239793c8a18,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.1c156239793c8a18,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.1c156239793c8a18,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.1c156239793c8a18,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.3.1c156239793c8a18,"e",@progbits
+	.string	"(\265/\375`Q\r\205;"
+	.ascii	"zg\374\02670lM\007\0030\3145\377v\360?\233$\351B\250\221\355"
+	.ascii	"\3569\202\277?\274\252`\301} \265\367\366\367R)\316\257\315\305"
+	.ascii	"\324W\303\271\002`\354\304\332\266\226D\246$\003d\001m\001\\"
+	.ascii	"\001\333\365\0079\255\333\275\275%\333\365\327\033\244\337\271"
+	.ascii	"=!\3335\030\0336\277c\265]\207\2459\272\241\374i\273\0263\303"
+	.ascii	"\346\206\306\306\270\371!77\332\256A<\030\244\037zs\210\357\322"
+	.ascii	":\"7\007\332\256\311^\313\232#z\263\210wQ\307;+\223\031\315v"
+	.ascii	"=\342\253\2609^&!e\350ynZ&\263\223\355\272\304\0234\317{\363"
+	.ascii	"\221\355\332\004\223\2437ram\327'>\211\2337z\037\325v\215\"\211"
+	.ascii	"\346\216\3262\371\241\266\353\024O\344\350\216T|\034\234Kr\037"
+	.ascii	"m\327+f\035]\322\373w~`\255\371$\367\375\374i\325\372\2447\255"
+	.ascii	"L\276\034 UG\247\344~\232@\247^8\245\027F\231\374*s\244bx%\327"
+	.ascii	"X&\275\026]\250\031^\351\245Q&\335S\235'\244kr\235\222\335\246"
+	.ascii	"\243kz\025\t\302t\364M\356\334\240JG\337\364\312\021\222"
+	.string	"ttNi\n=ZsN\257w\271kt\364Nn\024C\214\216\336\311\213\034JttQ\256\017D\206\216.\352\265Q&o$\"\264\346\243\\\034eR\206\";6\037\365\266\225\311u\321\234\233\223rw\224\3113F\177\220N\352\365Q&\201x|~x)\027H\231\034\313s\004>\327\330\363\300\241\225\242\223\223\025\027\227t%\256\203\224\311\337\256qF\2031\327\226]\362\227\f&\213!\313dr\231|&\243\311j\362\232\334&\273\311pr\234<'\323\311r!\362\035\020f\003SqH\206\254\300\331\316\t\301\254L\376\306\354:p\020^/\333\365\313\201\213\340f\331\256\363\033\264\b\357\224\355\272\307\006M\202\373\323i\340$\274G\266k\237\031\270\013\356\357\347\b|c\220\027^W;\f\022\303\226\227\026\303\313\265\005\231\301\215\264]waa\313\360&\332\256\275\262\025\266\355\243\333\256\001LA\333/\237\355:"
+	.string	"\0244\017>\001\271\311\017\017\2763\333\365"
+	.ascii	"%k\037|[\266k"
+	.string	"\002\371\210\333\007_\201\"\355\227\3533\220\205 \277^\337\001ZH\260V\3335\202X-\230&\265]'p\325\206\320\233\266k\005\253\334B\350\005\250Z2\274\355\232A)$\331\333@T+\302\375\263];\370\324\212x\355l\327\0178\265#\\7\3335\204L\355\b]f\273\216`\211\r\205\326\262]K\230\364\003\305\253\231l\327\023 !S\270z\310vM\301Q\233\342}\265]W\300kU\270\246\266k\013\212\334T\\8\304\266b\322v\215\241\220\333\212\274\355:\203 6\237s{\204\266\353M\207\364\271W\003 \324\351zq\266\353\r}\340\234\356e\263]s\320\263\346un\017\314v\335\341\216\233\327\275=,\333\265\207:pn\327\243\022bbbabc R\324\013\257\346\330Y\231\021-\256h]X\025\232j\306T\005\226q\341b\373\303\304\2644(\024\266\305-lF\004\226\261h\231\221M[\254\301"
+	.string	"\230\306\327\221\306\033\262m\307\361\rl\307\333\261\307\332[\r\260\034k3\330\300h\274\355"
+	.ascii	"\373\212\200\333t\034\337\300x\264\265\275\201u\341`\332\332"
+	.ascii	"\303\256\307\367x\037\367\343\200<\220\323y\235\013\362A^\310"
+	.ascii	"\357\374\220#rE\276\310\361<\317\035\371\353\220<\222OrJn\311"
+	.ascii	"/y&\327\344\234\274\223\177rP.\312Gy)7\345\250<\225\257rV\356"
+	.ascii	"\312_y,\227\345\264\274\326\013\371!_\344\215\374\221G\362J~"
+	.ascii	"\3117y'\017\345\243\374\224\247\362V\376\312c\371,\277\345\271"
+	.ascii	"\274\227\377\362a^\314\223\3712\177\346\321\274\232_\363m\336"
+	.ascii	"\315\303\3718?\347\351\274\334\333y"
+	.string	"<\237\347\367<\237\367\363\177>\320\317}\335\333\375\240'\364wo\350\021}\242_\364\214>\357\033\375\373\217>\322KzJ_\351/=\246\327\364\233\276\323{zP\037\352G=\2517\365\247>\325\253zV\337\352_=\254\227\365\263\276V\216\313C2\221l$'3\222\234$/\311L\262\223\374$G\311R2\225\\%_\311n\316\222\265d.9\370<U\026\032\017\323\212=<,\026{XM\331t\350\303\251\013\365\\}=l\006\201=\314\262\3002UmMV\355,1\272\256\252\321\f\002\267\260\032\253\246\032\271\260Y[v\006\315\314P\225\r\200\323\026\346iT\201\304t\355\302\303\223]_\254%NW\024]\323\341\026\026\232\300\340j4\307\320\022\377\360\231\031\034\232[8Ll\fD\320\230\242\301\225+\250\002\315\340\032\240\305\n\024\262\330\302\253Y\342\325,\203k\372\303+\027^\177/\314\270\260\231\236["
+	.ascii	"p\331\332\3660k\236\354\031\354\302\352Y<\317\262\037\016"
+	.string	"\256i\017\227X=Y\365tAD\267p\021U\331\325\030<\205\\iq%\002U\326\013\253gZZ\344\302\253\371\303@\026\030\334Rc]\224x5\215\353\n,\016S\263\013\233\265\302\242QM\005\200\205@T=Ws=\271\2600UYbj\032\201\3529\004\232\002p\261\035\242\254\017\253g\220\210\2628\315\210@\325\013\377p\212\022\321\242\017\023\321\242\321\\\207\306\262\265\365\302\2519\354\341 \021-\013\236\302.\314\242D\364T\213%FY\265\323K\215=\200\211\247\021H\024\"\300\302s5\262D\2401,\214l\3144\215jj\002|&4\267\304\304\002\201\017\250A(\303\254\207\"\022\024$IA\262\254\001\001\206\2121d\353\001\021\340\220r\215\230:\006C\b^\260X\013w\211\366H;=\030Uf\345\231\207\265~\032\n\273\024 \004\314\342\034\025]\306\375\256ei E\032\267q\305l\t9\251\323|\225"
+	.string	"X\202\227\347\272\020\031P\200\341[\217A\336\352k$\243\201*\037\244r\325\025\256\021\032\261\316F\323\341\376\352)\341/\204\346B\013#\003\"\257\212\350&\0317\024AN\305\023\003\2326\024!T\361+\024km\321\243[{\216gR\3217\327\327\340\273X\343\3068\373\3415\331Tvm\300D\375\026\313\306b\363qF\254.\260wQ>\224Q\2723\215\\\034\350\251\n\fq/f\361\275\r\306\340\f\226\002\031\367\366\037>\344\376\366K\276ro\350\333\360\033\362\fG+b\330\272\337\204'\220\3411\364(/js\325\205\027\247A\311\356M\021v\325\331\"!\217\322\245y\036M\b\0133\206\337T;O\235\252(\207\225\215\373O@{\334"
+	.string	"\030\365\271h\226\277\"\366\233\347{G\031f?\374\354\350\323\1770 \2677\316\206\224\345\212\357)\024\360\017\020V\0364\247<`3\356_&\316\365\252D\206\351\f\247N\271\037\004|\236\305\325\027\024\005Z\222(\257\363l\267\261\301\245\276\007&au/\245\020r\207\270VPPv\222W\363\005i\005\033t\266\242P\334\335\001\304W\244B\032\200\031"
+	.ascii	"\320)\332\307\022\177\n\001|\002\"\347I\352\216@$HA`4\013! \""
+	.ascii	"=\372\222\202\370\265\331\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1c156239793c8a18,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.1c156239793c8a18,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1c156239793c8a18,"e",@progbits
+	.string	"(\265/\375`\372\006\215\""
+	.string	"*A\244\rH\220\224N:>D\001\257\005E\300o\216\273\207\223P\274\367Z?-9\004\377\267\006\351\350\247Q\360\211\372\235\001\226r\360\345h\325-\311W\001\210\231y7\217D\325\300\276\222\022\tf6\222\310\b\351\345H\254=i#\231R\244"
+	.string	"\322"
+	.string	"\312"
+	.string	"N\241\321\221N\245i\372\253\007DiZ\363+\240]\232\326"
+	.ascii	"\377\004\177\202\032U\344\224eV?\350\375\210\372;\354#\257\303"
+	.ascii	"\305\334\t:\246\3114M\201?\032\026u;\266\372\370\323\354}\331"
+	.ascii	"9\374r\226B0KoA\372\323\344=\335\305\364\366lk\331'`\377\305"
+	.ascii	"\276\213}\001\366\201\366[\354\257"
+	.string	"\330W\261\317\263_\355\257\375;\333v\266\351l;\261\375f\273\211\3556\333Jl\263\331^\263\215f\373\3146\231\3551\333b\266\303l{\331\356\262}\300\276\220\355\036\266o[i{\227\313\345\322\266\217\355\030\333\204\0135\302O\023@\031\352\233\341@*.m5\211\220\361\220\305\271\254\255>\231}\345\307~K?=e[\235\374i\252 Q\177\b\020\355\207\\\223\020\261_j\206t\266\325\027\263\017\3660\2335\262\bb\262\325n?\315\226 \250\377\265NI\245r+\313\201x\255pq\204\263\325\367\262\317\365\256_aHS\036*[IKn[\021\3744\353]\314o\241\376\017\tLFQ[S~\343\227\242\272\324{\250\024\3234E\2037c\r8\272tgh\001/\354\bKJ\353\367\3044\344t\364\005\025}\344\330\352g\331\237:\216c\375\210\322\324&MS\002<\"\225\327\325b=\231R4\022\035\003"
+	.ascii	"\245|\220b\034\247T\272\352j\374l}\325\255\374\253\363\260\003"
+	.ascii	"\b\001\336\032\373P\226\246e\310QX\316\326\023-Qo\352\323R\336"
+	.ascii	"9mu\211r\327b\003\350+\271\325\277\263\037w;\253\252\232\264"
+	.ascii	"\255O\372i\036\n\352\327\365\242\200\345(m\035\360\204.\352\310"
+	.ascii	"\350f\253Og\177\356N|\3102\273\033[\377\364\323|\211C}9`\213"
+	.ascii	"&\232\240\255'\334[O\005\021)\264\325\177\263\357\366&,C4\214"
+	.ascii	"\216\266\332\354\247\371K\202\372LxBJ\027LK\332\220:=P[\3756"
+	.ascii	"\373I\256\304\201Q\t\306V\213\3754}FP\037\211i\243X\027u\204"
+	.ascii	"\315G\334\031#n\365\331\354\033\371\232\271t\2123n5\327OsE\211"
+	.ascii	"\372j>\033\237\254\2464\264*\227F\326\263\325G\263_\344gj[oI"
+	.ascii	"\0336`\031\017\302a\360\203\214\3140\350\033\302h\210\251F\321"
+	.ascii	"\t\b,T\240\320\213a \214\031\202\220\231\021\016\2033Ca\210\r"
+	.ascii	"\303\f\301\016\033`8\004c\2063A\006\005f\204\034`*\f\205\035"
+	.ascii	"D\310\254\330\336 \2405\2531\254\255^ {oV\305o\213\254\ni\253"
+	.ascii	"\002.\324\373S\215\346th\254\317\366 Ue\375l\365\366\330\017"
+	.ascii	"\262)F,\357\234l5\233\033\352\345\361\021\001s\243\332\235\325"
+	.ascii	")\3329\262:\366\242\330\234\237R\bZ\335V\323\3754\201`\250\327"
+	.ascii	"\270\\\002Q:\2618,rH\212\026\307~\331\232(\332\274\200\332\332"
+	.ascii	"\340\247\2717\250\267\230\302\306\323\365\263\225\267%\210\027"
+	.ascii	"xf\250m\365\022\223w2N\224m}\021\324kc\300\307W\027\211\255a"
+	.ascii	"[\001\025\2675{\25014G\f%\314\223 QA\241\260\031\260\002\221"
+	.ascii	"\340\216\333\021`!s\002I\226\021\257\237\001\311\326n\r.g\n\200"
+	.ascii	"}=\031.\237\025>&0Pw\354:V\020\247\222\274\314\200\355/\353\300"
+	.ascii	"$\207\337C\003\346\0011\371\227O\262\016\325\310P\336\343<\315"
+	.ascii	"7\376\273\343\321\326\246\226Q\226\3019\001J\206\002n\214\235"
+	.ascii	"}\270%\r%:\227 \250O\335\355\22231\226\252\037x\215 \314\222"
+	.ascii	"c\335\005\341\343\001\351\215\301JD\022\224y,\270%\215\005^\002"
+	.ascii	"\242\311L\240\374\242\2675:\250.\354\374K\001g\251c\357\200\341"
+	.ascii	"\322\021\034HS\216u=S\355\030\352+a=\347j\313,\361\277\214T\321"
+	.ascii	"m\203\"\241\205\367D\353\364\327O\022\363k@\314\002d.A\334_\305"
+	.ascii	"\206\322\342\212\312\356\024hm7\241V\001"
+	.text
+	.section	.gnu.lto_.symtab.1c156239793c8a18,"e",@progbits
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1c156239793c8a18,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,709 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\016"
+	.string	"\017"
+	.text
+	.section	.gnu.lto_.icf.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\035\006"
+	.string	"\024\n\364"
+	.string	"\020"
+	.string	"\345\270\263\204\t\n\002"
+	.string	"\002\001\002\002\002\003\002\004\002\004\002"
+	.string	"\002\005\002\006\002\003\001\376\310\332\342\r\006\002\007\002\007\002\371\204\261\234\003\002\002\b\002\005\003\365\311\226G\004\223\220\260\362\005\004\t\002\003\005\332\326\203\320\004\004\006\255\302\302\203\017\007\273\352\374\254\004\005\002\n\002\003\b\357\342\376\200\006\013\002\003\t\254\234\255\305\f\001\002\f\002\003\n\231\366\336\334\r\005\002\r\002\003\013\351\305\300\264\t\016\002\003\f\362\261\204\342\002\017\002\003\r\370\231\323\233\007"
+	.string	"\016\230\257\232\210\020\002\003\017\240\354\315\034"
+	.string	"\016"
+	.ascii	"1\013\2273W0$\230\tb\202 \301L\020\240L\201\031\246\016\256\361"
+	.ascii	"Ta\223I\336\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\335\004"
+	.string	"\362\205\021\030\240'\351\377\377\007\336\252\252\252\252\272|\333\377\377\377\033i\204\220-S\n^x\302!HP\031\030\226@Q\002\003\034;\033ft\330\027\035\021\321\234\372\350h\217\310\220\232\324\231a\277\335\353\017\361\253D%\313\027\001$ \220\"\261+;(\001\231a\270Q\343X!\203\021;N\325\346_6\367*>Or\356-\313\306I\221\344j(\334@%4O@6\203!!\334\300H\212\030`F\221x\"r\255\020\264"
+	.ascii	"\330\321a\003\330\346\222\021\023\341L\220\013\017\202^T\204"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.inline.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\261\003\255\t"
+	.string	"\022\216.2Pm\222\016H\243\0011A\266\007\314\231\247\233s\022S\025\327\351\210\217X\221950\321-2fWUUU\025`\350y\375\306m\366\267\326\310\336;\005\007\\&*>#\324\226\203\004i;]\001H\211\361\t\351TS\025\312$\247CL\204\221\2668\371W\354Jv\"\355\246\315,N\213\220\375\031\274\373<\361\020\260\243m\345|6\022\334\205\3223\264\335<\373\232\267\357J6\276A6\220hx\246\327\344C\013A%d),J,\337\026g\212\007\376\265\350\223\270\307\026}\001\266\355\354\306Q\203\037\236\210\214\311+ \207\003(\224\301_"
+	.string	"\017\357[\310\rP\2503\360\227\331E2 \240\"\021B\323\001\347\210\004\224\334\033\200\221\354\025\036p\035\201\312\261\327T\321\343\220.\256\240\300:\004\033Y\016YL\350\335Y#\226\324\265\021eH\022\344;g\214\216\353b\205\310\t\274\\p]\302#\203\341\306\306\304\363\030\340\350o\bW\242\2131\314\362\300y\005\230\221\0040}\035\305\022[k\375i\372\315xo\013^\320\263y\312u\314\017#`\254d\006S"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\351\001%\006"
+	.ascii	"R\311\033#\2205I\007\377\017\276\013bff\246\230\231\231\205U"
+	.ascii	"KT\213=\326o_\277\365\333\357\267\277\021\262\211L;\246\030>"
+	.ascii	"\276pG\001\361\006\341\2053\036\311b P5e\255\265\356\035\202"
+	.ascii	"#\236<\003\bI\252\234\237G\252V\366\356\245\025\007\321\316S"
+	.ascii	"\3655\223\236I\034Yy\256j\257O\325\254\274\306\276f3\3531\301"
+	.ascii	"\036\213H\200\377\330\301\030\020\" \220\302Af\036\375E\270\272"
+	.ascii	"\334\205\013\326b\350d\341!\037\b[\t\326\001\222\200\013\363"
+	.ascii	"9\220\177\347\\0\324K\272\334\\\b\241\244\360u\033\313\340\""
+	.ascii	"\250i\304\254oC\340\030I\344X\221P\304\202p.\366\243]\227\023"
+	.ascii	"\004,\007i\200\006z\305\035\002"
+	.text
+	.section	.gnu.lto_.pureconst.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\271\004\001\271\004\002\205\004\003\231\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\007\231\004\b\231\004\t\231\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\230\004\016\231\004\017\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"\255\004"
+	.ascii	"\222E\024!\240)\303\001\377\274\376\377\277UUU\025\371\266\377"
+	.ascii	"\267\375\357c\275\375\237\020B\b!d\223\275\245L\001\377O\007"
+	.ascii	"p\021\344x\032\016\243Y0mQ(+1(G$\007\265\241\274\320\337\357"
+	.ascii	"\324\324\032\037s.('\224\277z,\273\354/\b;\035\230\221# `\203"
+	.ascii	"\266\315\001\021\205\370\324\300~\222\025\004\206\033\0305\230"
+	.ascii	"\r\302\336a\234R\213\231A\354\301\230\025\214\335\002\r\354\016"
+	.ascii	"\026\023]\rV\203(m1 ~\307\370[\240{w[\355\372\364\025\247xC"
+	.text
+	.section	.gnu.lto_.lto.88e4c2e0039d709b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.9.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\256\001\235\020"
+	.string	"\006\340oF\360\262&\035\222\312\231\377\r\016\2311\361\330<\002\n\320Q\025:\243R\030b\r\255Ur\263\246\236\332\356\257\214\274\277\002\225L8G\nc\3253\360\f\274\336\314V4\216#L\270\365;\376\035\220n\204\220M\244L)Z"
+	.string	"W"
+	.string	"^"
+	.ascii	"\273\241\002\217p\217\016?@{\344.\242=:e\013\025X\001\320\231"
+	.ascii	"\341\341\261\273\236\212p\226\251\307L3\345g3X \314c\266\255"
+	.ascii	"jJ\204\200\253l\004\033\002\372\353I\003\2522\353y\336\330`\235"
+	.ascii	"\260\271\376u\004(b,\320\346\271E\330]'\013\344pk\267=\301\366"
+	.ascii	"\003;3\277\350;7\267=\374\343\303[\265t\306\364\003\210B\210"
+	.ascii	"\344\330\255\211\371\330\240\bd\342;\277}\237\347=vg\226\267"
+	.ascii	"\260\201\226\212\335\355X\354\356\361\177\2713\003\007\251\357"
+	.ascii	"\264d\333\001\302\n\327\320n8\362\350\221\235\241\213P\203\247"
+	.ascii	"}\235\263H\335\365r\001\273\255\037\031\001\272\351_O\260#\266"
+	.ascii	"!\205*[\207\344U\244\356\324\035\210\225\302\230\016\203\002"
+	.ascii	"\267+S\342\277\260pR\321\036;%p\303\365\036_\270\013\025nwK\374"
+	.ascii	"\037\223\023?\347E{\004\321\017$z\2708\275\252\215\317\314\217"
+	.ascii	"\230\214\251O\215\025\250\212c\207\252\374h\004l\310\332\262"
+	.ascii	"\271t\267\245A\356\n\025J\371\255\240\324TB!\255\240PN\234K$"
+	.ascii	"&\244\323gBy\250\317\224\341\364I\360PN\244\023\257\364\241<"
+	.ascii	"\222\003N\301`\372\274\225\224\224\317\353\302\230k+\336\004"
+	.ascii	"\305\250**\216a\272\251\263\214\252J\343\267h\234^\307\013\207"
+	.ascii	"L\302\234\312i\362\314\374\360ch =\307w\321\036S\223\006\215"
+	.ascii	"\207\005\327# \240\202\221:\333\001\242\300\352\215\305\255\310"
+	.ascii	"QBz\373\245b\314g\232\rS2\330\352#\373rf\371\332\242U\310y\350"
+	.ascii	"3\246\246\0250\215\310\022\334\262\\p\270n\003\306\303\324\037"
+	.ascii	"\004G\023\206q\241\2275\"\200(\364Z\\Z\241ea\357\264\353\t"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.10.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\r\b"
+	.string	"\222\21777Po\322\001\2408\211Y<\207\366]XZ\006\323\202D2U\203j\304bk\b9\007\203\266\214`3\203\020\202\252\212\210\224\240\026\257\365j\343!f\274\303n\262wJ\001V\205Q\035\r\273\244+N\003uQK\233\032\265 .\3120\261\213r\230\025\325&\247\300\331\203Eg'\313\350\314\324\275!\324\200 \205\355\210\2238\271\273\n~\310\204\204\334x\364=\0203\002\275\222]?\017b\330\237\026\212\f_\3777aT\006Rv-J-\213\022M8lov\306\366{\366G\377\330^=\017\330\025\235\224\354\326\003\033\310GWi\333\357\270\307fn\252\032]\302H\205\b\313n\235\232\023\\\036\247\013\\\036a\306\271?\316?\3107\244\225P\367\371\003X\330]\277Pwq\303\333\336\330F\260M\022\f"
+	.ascii	"2\003\302\260\2268\3742\203\027c\273kx\306\004\016i\214\006L"
+	.ascii	"\020p\242G\265\322\021&\031"
+	.text
+	.section	.gnu.lto_serialWrite.11.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"U\n"
+	.string	"V\224H= \3458\035'\027\003,\341\006D\356\002\217\262\3008\315\021m\242T\254D\202\332\006\343;\321\353\247xi\345^\216o@\311\n@\b\024\240\241F\375"
+	.string	"\212\313\344\036\224\224n\306m\345N)5"
+	.string	"5"
+	.string	"9"
+	.string	"\273#\307\020\331\247\307o\260\317\354\b\330\247E{\200\302\311"
+	.string	""
+	.string	"\312\205\300\356nJr\361R\364\277\362\202\224\252tI@\261\273\226)U\310\255\267\355`\333c\377!\376\370cg\375S\245uJK\215\3643\255\265\231\331\005y\031X\327\2249\261}\315\266J;bB\374\310a\335\025\021 qi?\345*\342Y\244\037\354\256`b\002'-\031SU\016\352\300\305_@\331\356\207\307ou|#\354SjB"
+	.string	"k\274e\224\355\256\307g\021\205Y\t\t\373\2742\230\024`\231\344\313\036KRG\354kvw\255+\007\026\234\354\270\320G\024\206\274\314\\\007\343\343\201]\270\205`\267\341\201\025[\310\373\2006\016\f\267\316\202\277\214\016\334D\337\007n\332\270\327\254\256<Q\\&\365\260&U\247Z\252\033\002\016"
+	.ascii	"2\241O\034X\\p\300PJmn\351\254\322\342\316CX\351\032\020\025"
+	.ascii	"\006\203\271\001*J\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.12.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\204\001\275\017"
+	.string	"\366\335jF"
+	.string	"\221(\035\277:8\210[\212\204\377\016 \375\237(\376\007n\223\230e\340\337\221\215\246\365W \374n\326\032\022\242\364Y\351\321~\345\231\230\271\264W\004v\307\317\004"
+	.string	"\026\201\235\330\227\223t\f\341[\244\222\275\345N)U"
+	.string	"U"
+	.string	"W"
+	.string	"13\273\341\210E\270O\207/\260}r\007\331>\r\3325\020l\b\020\243\003\r\307\356vZ\002\004\025\374\224\032A\377\264wZ\257\324'\267r\351y\255\\%\b\213\013\033\217\027K.\260A!\342\264G\327k\025#"
+	.ascii	"\320\356:\266^!\356\355\266%\330\006\331\267\t?\367\332=?\273"
+	.ascii	"\345\214\2162"
+	.string	"\372\002\006\274\030\250\355\202\310\311\2615\023\206\313k\267\377\342\303\324R@+\017\020ph\330\330\rE>\355\200\373\374\307\266\262\270\f\374\3144\362cY$>\314\354\356\210\033p\237\td\fSr0x\264\257\342+\300\307TN`\027\026\237\350\321\216r\352\250\366hj8h\352c\304\016\231\236\264E\235 \233\301\2128\266+\\\206\304\355\262J\374\027\032L(\333g\324\020\031\276\360\030\024nwK\374\026\245\023gBe\373\274*Hq\023S\305\034;\\Em\261\177\200E\307\r+\314\376\354\367<\374;\217\005'G\2250\230D3\204\n\231HOT\n\241N\245\021g\021\211\205\320\350\363N\335\351\3632\214>\223\2564\n\221:\321w\352HBl:\361\276\016e2}\335'T]a\264?\270\251Q\351jj\213\017\363\b'dbG\247\272,\243G\245\272l\017{\024\342[\3364\365\r'\307E\006\036"
+	.ascii	"1\003\367\334Q\343\340\033_\031E\321\004\361\020u\026\372\337"
+	.ascii	"XK\316,\247\024\344\226\342\276\254\335Yc+\264\264\321\255M*"
+	.ascii	"B9\210\001\314\351\200\rh\242\004|A!\270\f\214\bPQ\304]\336\331"
+	.ascii	"dS\230k\264\n\n"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.13.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\215\t"
+	.string	"V\222B:0\345(\035\236\213\247\302C)\301\244\034\326\275\322\031X\364\310?\022\005\233Jfk\246\377\370l4\210\301l\024\304f\302\300@\023\b\217}\2702\354 \324B\364\223\277\367\336;\2452"
+	.string	"0"
+	.string	"2"
+	.string	"6\305J\262z\030\300\361\022`\267R\316\013\346e<\301\274\204#7\375\231\374\263<\242\200\270T\253\323\237Fbw\375T+\217\033\336\266\202m\007\373\002\0011>?\370|M\303\307\301k\267\343%`g\244\314\211\355\222\275\261\375\236\375\326WJ\257\244\017\354\262"
+	.string	"\304\354V\006/`\227\256\230m?\345*\245!)x\262Mq\027\bFc\313\230\227\017&\370\342.\035\266\233\202\360[F\030\230\311\245O\232\227\207\006%-\324{\331\365\364\240\210\375\270\220\345\371\372\007\331'\344\021u!\r\363\247S\341\321\270\254\243\035\227\2154n\202\2064\017\210~\270\216v\020\274Yd\034\025m\033G7u\357\t9(\270\341\315\213\320\017N\030\021\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\q\3062\327p\221\t"
+	.ascii	"\034\250\361*0\361\340n\217j\305$L2"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.14.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\255\t"
+	.string	"v\222C<0\345(\035\200\213\307V\035\376\266\213:x3\367W:\003\213\036\371\027a`M%Z\264\372\373\\c\rb0\033\005\261\23100\320\004\242N\213R\026%\340\324\263\034i{\357\275S\n2"
+	.string	"1"
+	.string	"1"
+	.string	"\246XIV\323\305\261\341B`\267R\316\r\346e|\301\274\204#7\375\231\374\263<\242|\fP\255N\177\232\210\335\365S\255<nx\333\013\266\035\354\017\004\317\017>_3A"
+	.string	" \004\330\355x\025\330\031)sb\273dol\277g\277\365\225\322+\351\004\273,\0011\273\265\301\f\330\245+f\333O\271J\311\001\360d{\3420\240\227\214\rc^>\250`\213\267t\330n\352\301w\215.0\223K\2374/\017\017JZ\250\367\262\353\351A\021\373q!\313\363\365\2171\331'\344\021u!\r\363\247C\341\321\270\254\243\035\227\2154N\202\2064\017\210~\270\216v\022\274Ud\034\025m\033G7u\357\t9(\250\341\315\213\320\017N\b\021\222\n\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\u\3062\327p\222\t"
+	.ascii	"\254\250\361:0\361\340\256\221j\305$L2"
+	.text
+	.section	.gnu.lto_serialRead.15.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"u\t"
+	.string	"\346\322C:0\345(\035\200\213'\205hR\300.O\036\"\256\231\016\033\033\356I\312u\364\327\252\325\337\357\265\330 \006\343\025\304f\302\300@\023\330\270\023\363e9\232\204\271\352\311\337\233l\231R2"
+	.string	"1"
+	.string	"2"
+	.string	"\332\007\346\245m7<\230|z\030\302\232\036\033\0310"
+	.string	"\273\341\026A~\272\236\374\247<3\341\210Y\265PWM\304\356ZW-\215;\336\266\202m\007\373\016\236\177\375Y\246\326\250\276f\226\314\030\270\354\262b\001VF\302\220\3306\331\033\333\252\366O\216b\372\253t\201]W\313\313n\310\340\005\355\322\341\t\346e(\333\240\303<mW\325\361Y.*H\363R#\202\301\257\220\264\335\355\370*#\013m\344\322/\315\313\307\002\221WJcv\210\322\370a?\333\335ut\005\334'\344\021\201\241N\363\2073\341\351>\016\334\300\217\033u\237\304\026\352<\240\355\363\201\033\347\300\036\005\367m\"\317\373\266M\270\367\214\t\251\210\341"
+	.string	"\315\2425\316\b\321\241\212\001\n"
+	.ascii	"2\003\302\260\013\314%`oJse\031\313\270\214R\324x\250\016aL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_serialSetBaudRate.16.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\265\n"
+	.string	"\266\024KA0\251(\035\210.\177\006)\245g"
+	.string	"\355!Y\366\256\3053\030:\354\250S.\\\305\306r\036\304o8\213\354\332O\216\321>\002\3206A%\025fB.\024\257\270j\345W\022\332\177t\177\262\311\336)\0055"
+	.string	"8"
+	.string	"9"
+	.string	"a\205)\350\247\303;d\237\364\r\331\247A[\302C\002\373\324\t\211\212\302\356V9\340\340#\350?\365\n\251$z\244`\354\256#\251dr\313\333\236\260}a\277\006G\375\363\247\037\303\242\243\214>%[A\200\230\260[\362\252\260\255\371\300\200\355[l\307\360\t\300\243>\\\331\r\340\262\240\237\022\330\243\375\003G"
+	.string	"\376\024:\303\256\251\301j7\322\026"
+	.string	"#Rd{s\006\035\335\025\301\370\013@<@\331g\224\017\021\374]\001\210\356.\306W}<\264@(\373\274\224,\007\256\323(\276\354P\024\245"
+	.string	"\373\330\356\256\245\311\016[G\323\320x\264\r\272e8Z\347\343p\324\231\013\207\306y\333W?o\373p\236\246r8mS3\336W/\021\356:6\257v\272\316\253\226p\217\25549\203\325\032\311\020/\304)1\351\030\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.17.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"m\t"
+	.string	"vRC<0\345(\035\200\213\007\323\253\007\315\321\245\024\213:\334T\310\245c\303\375\2502\345\020\215\355\365\037\237\215\0061\230\215\202\330L\030\030h\002\2059\017W\006J\302\351\t\217\264\275\311\226)\0051"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 H.\375#Q=\304\244\303E`\367\233p\344\245k\311?\313\261\224\017\001\251\225\351\252\231\330]kj\345q\303\333^\260\375`\337\001?\206\251\025\252\257\2212\001\016fvU\257\002\013 \306\240\330&\331\033\333\252\366U\276Bzk\364\201]\326"
+	.string	"\230\335\257\301\f\331\243\277\027\310\307\354\001\320d\273\342\256\317\313\006\247!\037\025&\030\343.^\266\213\212\360[D\031\331\311\243?\222\217\207\006%\255\223\276\354\317\244P\304>\266\273k\310\262|+\232\007\324\ty\240-\263\207c\321\331:\315\233^\247\211\266\216b\202\266\316gz:or\020\314]h\335\fq\\77\337\336\022*\234 \2077\212A+\224P\002\004\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_serialSetMode.18.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"u\n"
+	.string	"v\024I=0\345(\035"
+	.string	"\276\334{z\271\224S\200\234p\251oQSj\270A\374\022\2066\260&\2525\334\3077\335 \006\343\025\224\354\206\201\001\f\264\026\322\242E\232\314\350\b\035O\032\331d\357\224\0024"
+	.string	"7"
+	.string	"8"
+	.string	"\f^\340N=\276`;\345N\260\235Z\264c>\206\354a-\215X\200\335\255\023\344\342\245\350\037\366\215j\205\272\324<\354\256\245j\305q\317\333V\260\355`\277\006?\275\353\3274i9\245\257\331f^\016Nv7f\003VF[Z\266\317\261-\307\227\210\177Ux\263\353!\323\300\235&h\227\366GN\"\336u\372\300.Keew\f\035\031\023e[\364\224\217\333\305\360\370(\026\023\246\355TN\003\030\20771q\273\353\361c%\nN\344\264\235~N\026\027\001\256\224\234\331#J\316\017\373\332\356\256'\313\376+]\350\023i\035h\364!\205#\2173\250\023\361\361\300.\254!\330\225<0TG\336GTA`X;\b\376$:\260\222\276\017\254\234q\257\355d\031\002\200,5/, \351\324\246\3454'\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_serialSetCtrlLineStateCb.19.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\n\001\265\f"
+	.string	"F\327TA\020q\233\016\030\0020}_\354I\200\374\301\3030\205\316.)\200\003\356'B\340\257\215@\251\321\210L\017\371\335Q\0247\362\265]T\"\240"
+	.string	"\n-\310\0330\347"
+	.string	"\200/\036E\361\177O\2156\2212\245?"
+	.string	"B"
+	.string	"@"
+	.string	"\323\243;;\307A\023\3730E\303\312\216\335\265\264\304\273K\232\235\377\360\227\222\017t\t\304U\312\230\300\030\t\370<i\301\be\304\303'\207\217$\223\342\354\256\263\344\363p\307\333v`\233c\377\023\237\036\372cL\247\224\376\205\nQ\343\200\216\335\016-=V\024g\240\260}\214mU1\016\226\006\t^00`\275p\303\346i?\345+\272\207DN`\367\204F\214]\220\201\025T\217\006_`z\254\236\tS*H\310\342%\017\333\021\376\302S\355z\033\337\005\206\3543=\246&\270a\ng\361\251vw\343\257p[uBdz\274\306\0246T\204F\262\305\006A\251$\354K\273\273\326\023\373*?u\360\001\234\005\214\013\311.\n\344JN\313\036"
+	.string	"\360\245\221\360\321\321\260\315\3324\254BG\203`\205t><\326\245m\226\006\201\263\t\230fqY\246Y\030p/B4\242$\022&)\2354\252S\035\240\305\007Q\006\005\345\b\305D\206\332\023\032"
+	.ascii	"j\231\"34\030\271Y\200\330\rJ1\313\032\325,\b\214#\304\"\023"
+	.ascii	"\206R;b:@n!pL\b\353\032\233\016\343yU\016\\\001s 0P\"\030\021"
+	.ascii	"\240\242\210\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialSetBaudRateCb.20.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\t\001\255\f"
+	.string	"\366VTB\020q\233\016\3600"
+	.string	"\027\344\222\037Tp\315\223\212\036[\271\323E\262\360\222H\313\013\262\262\231(\320\353\3459cQ\0247X\316.*\021P"
+	.string	"\205\026\364\034\2160"
+	.string	"\240+\017qf|\373n\264\211\224)\005?"
+	.string	"B"
+	.string	"?"
+	.string	"\217\356\354\031\007;\354\303\025\025Zj\354\256\245\034\336]\322\354\374\207\307\240|\240K\031\256\322&E\305\b\300\347I\007F+\032\036>-|'\231\324\307\356:Q>\fw\274m\005\266?\354\223\004\007\377\351\241?J\351\324\3641\224\b\030\034\032\273\027^r\254(\272\370\240\261}\226\017\201"
+	.string	"\353\205.\t\022\224\200\243\363\264O\342%\272\207>\027\260\253\362\202\305.\210\300\006\252G\203\0370=V\337L\001\316\246\324\220P\206\2277l\213<EV\355z\035\037\305\204\007%\323cj\201\030\336n\242\244\332\335\216\337\302A\250<|\246\307k\004\341b#d\222/6\bJ\335`_\332\335\265\252\330g\371\251\\\004\214\033\311.*\344JN\313\026d|y4"
+	.string	"\361h\330fm\032F\342\321\030X#\036\020\021\353\3226\313\203\343\314\001\246Y\\\226i\226\006\334\217\020\231\350\211\224IJ'\215\352Tw\234\b!\242\240\240\034\255\244\264\320\033"
+	.string	"j\231\"34\030\271Y"
+	.ascii	"\330\rJ1\313\032\325,\b\214#\304\"\023\206R;b: n!lL\b\007f]a"
+	.ascii	"\315a<P\"\030\001\341\202Bp\031\030\021\240\242\210\273<U\223"
+	.ascii	"S4\265\007"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.21.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"}\t"
+	.string	"v\022B:@\3056\035\340\005]\363\317@\327\022\3202\307\277#\t&}D\277\200\321\215y/9GS\3428F)\245\300\245\2048\216\202\373\312\235\0175}\031\340\027\214?n#m\313\235R."
+	.string	"2"
+	.string	"/"
+	.string	"7\250NY/\250N9\264\005|\f\331\203V6D\246\335\275\024\344\341e\350_t\001\261\303\271\264<\354\256\245\330\351\270\365\266\025l;\330\327\024I\304\366/\266\325\344\240\360!\253\314\201\315\360\020G\273\213q\203u*a\312\321\302\304pi\177\344$\341?\016p\202]O\311hw\304x\301:\3451\212\341JNU\225jo*\344E\313\023\224\222\206r\354\221#\365\303\376\334\335\265z\354\207\376\371\361\327\177~YYH"
+	.string	"\020N\273\034\247\001[\n \267\3512\n\0031\315\3242\016\003?n\263\234e\"\260\315\323\276\353\3634\212\315\323\\\334\206I\\\231\367]\231\003w\023\232w\201]\347]\227q?W=\206H)]\004\016"
+	.ascii	"2\241\017h\340\341\302\033\327\200\001\033\235\022b\300\225%"
+	.ascii	"\214\013T!\270\f\214PPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serialBeginWrite.22.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"E\013"
+	.string	"6\025NB\020mj:(<\202\360|\211\005\370\f4\316\345\241a2p\224.c:\257~\273\247K6?\203L\027^\374!Asz\353\034<"
+	.string	""
+	.string	"p\005\024"
+	.string	"p\210p\036"
+	.string	"\f\004\213\302AD\310\322&[\246\024:"
+	.string	"8"
+	.string	";"
+	.string	"\037\035\354S#\016\250L\354\256&\033\034\374%\025\364\217\272D$~~-\270\274(\243\013,\0131\2746X&\006G]\021\210!\325\210\307\356ZE\242\202{\336\366\207\355\016\373\226kI\262\177\372\247T\253\252\037\211t\370\220\001b7A+\305\256\346\006\b\023\333W\373\021.\001\374\311\363\213]\022\206\f\273#\2075\262O\217\307\300>\263S\260O\2036\211\336`*AR\"BEa\273\273j\223\355\206\027\277\202\201\257\203}\252\254\204\360\200S\350d\273{\361'p\nd\017>}\017\366y9\305\022'N m\331\343Ge\311\376\265\273\001[F\203\341|\032.s\306\002"
+	.string	"\303y\333\247}\336F\200\363B4\r\207\t\240e\274O\263T\334\t\330<\215\323u\2366\031\367\036V \031\272$:\245U\272\302\002\207U(?\3122\2154HY\262\003\021"
+	.ascii	"2\003\302\360\314\302\242mP\210YVh\253q\310\034c\002VjGL\007"
+	.ascii	"l\231 \nF]\302jV\243\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_serialEndWrite.23.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"-\013"
+	.string	"6UM@ M5\035\334\332\006\210\001MZ\004O\020\\4w\002\0031'L\344\022\314[\007\302/\002\205>\215\323\243\215\025\003\001\022\023\020\220\310\302\265\234\347\2064\377\f\350\253|`=>\267\245M\266L):"
+	.string	"8"
+	.string	":"
+	.string	"\037#\354O+\005(\022\273\253I\b\007\177I\005\375\233\016\001\211\235_\016./Ih\203\252B\f/\r\025\351\301M\327\005\342G\365\321\261\273V\220\330\340\236\267\r\3006\207}Jk)\262_\372\247T\253\252\377x\260@`|\330e\3202\261\251\351aB\304\366\325>\205W"
+	.string	"_\342\334bW\244\201\303\356\270\341\214\354\323\343/\260\317\354\022\354\323\240=\"\316`*\003\234D\204\312\262\335\035\225\311v\303\212\217!\301\267\301>UNB\330\300/l\262\335\255\370\0264\b2\t\237>\007\373\274\234\342\211U\311\243-{\354\250\034\331\277v7\333\005c\321|\030.\363\2052\300\302y\333\247}\336v\200\363\004h\030\316B@\273x\237F\231\270+\260y\232\246\353<-2\356K\244<\362sAtJ\2534E\206U*\224\035U\221B\035\244\034\331\001\021"
+	.ascii	"2\003\302\360\314\302\242mP\210YVh\253q\310\034c\002VjGL\007"
+	.ascii	"l\231 \nF]\302jV\243\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.27.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\345\003=\033"
+	.string	"\2462\256H\260XQ:\320\001\030O!0$2\305U$%;@\002\305Z>\034\371\207\332\242,\024Q\343\023v[Z\\OI|\365\301\016\230\217\352Xh]h\275qc(R\271\013\374\203\303\370\364\214\003\330[k\204\220M\344N)\223"
+	.string	"\237"
+	.string	"\224"
+	.ascii	"Hl\213\304f\306\301\234\367\335n\004\350\306W_\020yN\373E\236"
+	.ascii	"\204\273\021\240\003\250\325hI\260V_\316\251[\345\251}'0\236"
+	.ascii	"\226\0270\236\332\037b\373f\207\271OG%2\316\016s\263cA\r%!Sk"
+	.ascii	"u\235n\016\257\311\341p8\274\350\273\307\305\235\034\251\270"
+	.ascii	"\263\304\371\007>\305\242\027tr(7G\325\217\030\2476?`\\\024\311"
+	.ascii	"\235\213\0365\275\235\030A\030\325\364\340'\257\247\233+\340"
+	.ascii	"\263\300K\262B\255\325\317\311\270S\267}\303\366\005{\305\004"
+	.ascii	"\363\276\377\003\256\200F\255.\206fj\021m\362q\246S\261\fGg\303"
+	.ascii	"B\207\004\025Uu\276\226\355c\331\211\006\254P\372\361\\\247\207"
+	.ascii	"\362\265\357K\371\223\317\2378'\210\020\037{\305\344N?\177\342"
+	.ascii	"GA@\344P\334\340\301\355M4\234 \233*\364\005\252\301\203\237"
+	.ascii	"7\321n&D\231b\241<\365\231\276\304\017\336I\023\333l\001}'Ml"
+	.ascii	"\025\204Vd\020~\211\252\325\327:5\205\362g\372\300\233\275ZY"
+	.ascii	"\234_\272\371j\217\310b\222+\341\256\304N\242M\325\341h\021\254"
+	.ascii	"\265J(Oq\304\235\377\005<\246$\215K\356\301\f\235\361\263\324"
+	.ascii	":\370H\276m<\0357\025\204\2117#7\207t\225H\331\365D\313Fq\037"
+	.ascii	"|\200,C~^tSh\002\363\353]q%\024\3516\310\303\261|\200B\001\242"
+	.ascii	"g<\335M\260\343O\016q+\"\312Zu\020\374*)^>\022l<\235\373\247"
+	.ascii	"/8\242T&)7\207\336\213\265\326\272{\344}\004\035\302\250\271"
+	.ascii	"F\336r\024\016}x\215\354\377\376\232/\3754\254\325\227n\025\315"
+	.ascii	"t*5]\212\323$kz\244\253iQ5\275\251\351$`\323\304k\261\037\031"
+	.ascii	"\214\276"
+	.string	"j\257\021\342\016,\366\252\321b<\245a:%^<\263\035\232\2136\3339\3013\033\341\212\361\274z\\\260\031\315\245s\3002\023;3WM&\233\271V\266\347\327\bx\fe\260\344V\210\334#\223T\312\032\027\220\262\226.\317bI\2634B\272Z\325\362ZW\355\034\363\273\262\247\200Chc\334#\333\fN\227\265\244\026\025@t\256\332U\316\030.*j\b\315\241\rLr\277N\255WE\273\r\322\360.\033b R[\300\213\223C|KOYk\205\340kI\301\001h\357\364\007Q\250Q4\246\034\"\304\231\t$\222\231\031\247\003p\002\231\272\272\r\020hH6\035k\372\201P\002\207]\364A\311\\M\212TV\234\300\217\n(0\nF\267\210\265_\222\007\303\002\22784\320\240 \276\231c\220\240mZ<\201F\335cA\3420H\2773.\323\202\t#\326\003k\031\326\030\220P\037E\211\242l\201\220N"
+	.string	"\225\237"
+	.string	"\224.E\203KA\264D\b4\322\342\322,\357\327\214\304W\204\210/%\316d\360\025{Q\210\374t\221\224\330\234"
+	.string	"\317;\345qx\277p\003\302+\032\215\016\266y\326ku\206v"
+	.ascii	"\323<5b+P\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`&\001\335\006"
+	.string	"\004\t\"\002"
+	.string	""
+	.string	""
+	.string	"\002\033\177&\257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \t\177'\360\372\2508\272\200\202\n\177(\200\200\200\200\004\013\177)\f\177*\362\375\231\027\r\177+\016\177,\017\177-\020\177.\021\177/\022\1770\023\1771\024\1772\025\1773\026\1774\027\1775\004"
+	.string	"\265\006\004"
+	.string	"u\004\001\221\205\327\307\003\001\225\001\004\003\225\001\003\004"
+	.string	"\342\001\004\004\303\376\236\020\005u\004\006\007\b\t\n\013\321\231\263\346\002\f\003\r\004\"\004\016\004\017"
+	.ascii	"\" \360\242)\235\003\025\3017\031\234\307T\350\016B!\2270\"\302"
+	.ascii	"\220\313\223q.\340\340\247\271\232\301\361\225;\344\314\205\241"
+	.ascii	"\207o\374\206o\374\206o\360\033\3637\354\033\242o\370\r\0311"
+	.ascii	"\377\263\021@O|\276\303d\346\340\214\001"
+	.text
+	.section	.gnu.lto_.refs.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.88e4c2e0039d709b,"e",@progbits
+	.string	"(\265/\375`\007\034eu"
+	.string	"\032\274()R0\022JJ\007\252\017"
+	.string	"\372\310\214\335\276\375\007J&\177_n\235\017.\253\030\314\222\273\373\034zj\275g/+\212&X\337\366"
+	.string	""
+	.ascii	"\031\355\342\254\373P\354,\007\007\307^\013D w\247\301t\307P"
+	.ascii	"\021#\327\\\2369nB\245\253\177k\235\333\263\211\224)\037\002"
+	.ascii	"z\002\225\002?\275\336A=\243\350\245\321(\243\350\335\356shD"
+	.ascii	"\260\326\332\236H\235\340\313\232\016\\\223\035\032\265\363\332"
+	.ascii	"\016V\025:g[\366\362\306\264\305\252-_\341.f\240\226\274tIK\221"
+	.ascii	"\034\231H\\\316i7P,S\272\332\362\026\006\273)[K\223C\353\255"
+	.ascii	"5\2459\323\226\203`,\274\002q\226\363\031k9\316q\275\317{W\036"
+	.ascii	"\234\2672UbmM\360O\317\n\251g\240\036O4\032\2152Po\005\365\347"
+	.ascii	"2\262\033\271\254\244/+g2\036\270\271\253$my\214\301l\236\370"
+	.ascii	"(\266\345*\247\033a\267\246\231\3673\273\343J\023\265\266/A\375"
+	.ascii	"z\026\013\313\tB\306\213S\3129\354\247\340\202\223\361\335\333"
+	.ascii	"u\357-\221\223\325\203\330\325\366v\307\301a\273\273\023k\373"
+	.ascii	"3\330\317M\270\213\237)\222\251y\305\356]}\322-:\272l\265\375"
+	.ascii	"\262<\252d\341\322\366\035\250\354\305Q\326K\302\347#\b\2170"
+	.ascii	"mO\201z\206\362\001\256\356\005\327Q\337\352\315V\376\351\251"
+	.ascii	"\034@O\206\003-\274\304\177\024L\003\376\364g\201-\030\377\245"
+	.ascii	"\374|\342a\317\371S\027J\277\371S\024\376\253\375\254\300Z\232"
+	.ascii	"U\213\377d~.A\327\301\377\273\237\021\300+S\245\301\317\374s"
+	.ascii	"\002\375(\006\377\271\374l\300\005?\217\370\271\001\337\210?"
+	.ascii	"\255\300\001f\320\317<?\037\320\023\301\317\310\"\377\255\374"
+	.ascii	"\314\300\311\204\316\363\247\001\334\367\2470n\363\247(~\216"
+	.ascii	"\341\347\237\237Q\260\300\003\300\360\236?M\340\347\255\237\265"
+	.ascii	"~\026\362\263\325\317?~\256\372\271\307\317<~\236\372\231\371"
+	.ascii	"s\324\317J?C\375\374\364s\323\3179~\276?\357\360\263\016?\347"
+	.ascii	"\3603\016?\337\360\263\r?\327\360s\214\237o\374L\303\317@?\017"
+	.ascii	"\375O\373O\364?\356\177\231\237s\376\277\370y\206\377Z~\266\361"
+	.ascii	"\363\360\347\243\237\205?\313\360s\215\237\215~.\372\231\306"
+	.ascii	"\317D?\317\370\031\370\263\320\317\017\374\374\373\271\205\237"
+	.ascii	"!\370\257\342\177\227\377>\321h4\372[\242?\225\361\377<\020a"
+	.ascii	"\312\216t\225f\366\236\270\rIC\242\336ru\230O\211S\223\221\037"
+	.ascii	"-\305J\251\267:\324[\242\372\264N}\032\267\036\212\215\363\210"
+	.ascii	"\327\034\033\217o"
+	.string	"M\0237\2536\365\351\231\372TL}\332D}jD=\033\377\364zh&K,\022\026,Cv\364\320KzmN\256\224V\362^\302E&\004\220\266\235\204\305D\311\274\234\265Ms\250o4}\204K*Hq\016\214z^\333\b\227\032#k\\mNc\356\226\255&\362\203\025\0300M\244\265\222\306\2640\265]\217:\316\2724Sm\203\372\251\245\324\240\255\243\2279\214b\240\215\324I\235t\203\243\302ej\234N\272\007\213\201!\247\230\361\027fc\366\334\343\027\032\247\223',\206\303\030\205\376\r\244\257:HcuU\377\350fSuV\013i\037=\204\327\266j\346{\252y\234\304z\357\361\336{\356:\323\306\025IJ\234$7:(\033\023\301y7F3AN\275d6\346z\235r\214_\236\356\362\270\353g6\026\202\241%\214\310k\277\316<\335\371p\357\372\n~6c\325G\356\262\"Iy\217_Q4"
+	.ascii	"\242\006\013\224\274{W\bH@\240\"\025\303\272\n\260\357,\265w"
+	.ascii	"\371\247w\266\336!\325Q;v>\230d\365\216w\224\n&/\215R\333\206"
+	.ascii	"b\260\336\312\"\225\244\227\260\356\344ZI=\327-[\311TcD\255\351"
+	.ascii	"\255d4_\020\267\"Xm\333\222\315D\301\2333\3318\336L\275\004\305"
+	.ascii	"\305+\253m#[\211\327\003:GJ\364\272]:k~X\203&M=\037\320\343("
+	.ascii	"\037\320+S{\330\211\372\267\261\213\252\2313(3j\336\305\276:"
+	.ascii	"fQD\310\332\366m\2166\361}y\215\357\270\366\265\367\026\231O"
+	.ascii	"\3540\237\2609\343*~\365\354\231\211z;N\343[\211\227L\03248E"
+	.ascii	"\310\305\035\327\035c\017\247\220\036\252\211<<\0352\037H\204"
+	.ascii	"\334\235\361,\021IMM[\266\343\211K:\247\352\234\320\314\226m"
+	.ascii	"\271\f\017^\262\356M\251r\021\267^M\235\264\030\245V\326\366"
+	.ascii	"\214\204\322\215\210\262d\272B\346Lg\223\204\330\312\322\226"
+	.ascii	"\347r\300\276rD\333r\033\313\225y\242k\312\305\371xl\335q\201"
+	.ascii	";\307u\325]:\266\3451\237\263\321r\"\226\021c\241$af\265e7\036"
+	.ascii	"\202W\024\f\346\374\306anS\\\357\332[j\246|\265\355\341\267d"
+	.ascii	"\324\277\377\336-*\357\275N6\353U\032}g\033f\240_\207SV\340\277"
+	.ascii	"\275\351\177\002f\254\227h\245\256NMRV\354a\342\376l\367\036"
+	.ascii	"\257\210\036\\-\217WR\310\347\325%\036\215\020}\224\367\212\210"
+	.ascii	"|\336\353s\217G\342\007\315\353\203|\336\345Ej[\362]\257\210"
+	.ascii	"\367\330\274>\367x\213&\220\307\253%\362Y\\\372 \237W\313\373"
+	.ascii	"\274\272=\367XT*\035\257\322\347>\257\210\270\317\346\262\007"
+	.ascii	"\371l.\221\317\253)\256B\276yY\216\325aM\361\022"
+	.string	"y\274:\222TEe\017\033rm^1\367\262X\322U*p/US)\246(\305fF6\035\306\261b\223\tH\032\261\232\367\310\206T\322\274W\211\361\205\233\264\200\270\262]-f#\002\241\272LI\367\026\220\274\227\310\227\355\336K\274\367\336(\251\326{y\364 \235\311\344\275L\022\311KE\274\222to\213\301\231-\221O\254f\320\025)O\347\305\261\022\331y\305\\)\325'1\312e\272\367r\031\325\271|*B,,U\202=Y\277\254\251?\266\332\226@\351|xvA\344\332\002\235D#m\237SYCzG\256\247 m\231V\034%\333\333\332R\271^\215\215\211\266\275\261[\255\220RQ8P\261%[\210h\255#\236\334%\226;1 \265\2523\273/\r$\316\356\256\016\2323\204\262\211T\206\363x\262\240vS\212h\243\232<Rm\021\301]\246\260\204\301\203v2\232\265D\307e\275%cI\310"
+	.ascii	"\351\230y3\3720'\307\323\004*\253\310\345\301"
+	.string	"\271\202f\311\216\266=\246\341\336q-\346v\234\005\315{\213\035\307\223\346\336\"\017\363\t\346\023\026\b\254#Tz\366\366\031F*\307I\263\211\324\033\030\313\204\210\0204\0226>8\301\242\206p\313\341\244\256l\36555m5\333\226rH\266@\265\020\315V\265N)k\3735\342>\021Sk;\005I\373\320\364E\004\252\245\313\207\263\311\017'\020C\242\364\200\026i\247\0167\256\376\341\017\002k1*n\311gS\020\225\266\362d\3141\205\207\317muy1\332\316\261\347\036\261x8\235T\2311\353'\275.\271QA\315\232\254\227\322\325y\023\206u\004\252\345\213\321\322(J5\354k*\210Nk-\375\245\275\264Z\257u\226\306\322]\372\254\257\364\226\346\322e\215\306k\233q\2246\353)\\\267s\\\3572\307\310\264\343U$\271*`o\177\2602&\026E\016\316\"\t\300aP\bc\250\b\004\0264\202/\270"
+	.string	"@F\213"
+	.ascii	"H\270\320y\341s\004\034\326\300\342\206\n\"\024\005\205)\\hg"
+	.ascii	"\002\t\206\302_\r\tf\330`\361s\241\240\020X\004tA\275"
+	.string	"\005*\"P\261\342\306\315Wd0A\006\023\364\276\"\203\240\240\fT\004\251W\021\224\n\177/\bY!08#8,\002\016\005sf\350\001\207\214hX`\f\024t\216\212\214\202\303\032F72T\240\rA\027\352P\025\372\206~\300\021\210\202\277\0277\206\276\031\202@!\0229\277\341\357\203\033\302\035\3410\005\022~b\020\372\311 \"\372\265"
+	.string	"\022\r\005}\177\241\304\215j"
+	.string	"\205)\206FF\302\024#\206\212\200*\220H\306\357\005\013=#\\(\n\016\203?\0307T\020"
+	.string	"\b\024\206p\343\005\321oh\364b\030c\305\315\320\017\250B\216\013\037\"##\0261lj\030\326\240\001\202\0208c\206\r\026\303 \215\243\242\237\360\205\213\243\240\001\300\030B\243\0329\300!#\023\206\300\243\233a\f\025AC\027\300\242`\tD\302a\213!\360\b\200a\f\n*\030\026\005m\2502Z"
+	.string	"\207?\025\206l\374X\f\201G:3l\260\240A\035\036\305\030\n\215R\360=(\250\205\211\025N\020A\025\222\200\350\027\024\002\217R\034\t\2013\004\205C)\212\202?\032)\204\204G)$0"
+	.string	"8\f\na\024\005]"
+	.ascii	"\312\310\341J\225\304\306v\340\265\335\332\34203LR\274\262\262"
+	.ascii	"hiqX\234\323\211\b\255/,\254T\310\232\017\332\366V\226\365T\310"
+	.ascii	"\rXR\rT\3334\310\347|W8\360\326\264M\2018\255\254x\315\212\235"
+	.ascii	"\343q%\216J\375\361\203\351\324\333\345L\343\356\320\354h\373"
+	.ascii	"\236QM\253\322*\306;\002\265q\312b\342b\247\362\031>\323E\365"
+	.ascii	"\n\260\244\t\247%\217I\030\020E\332\366\261\217\234\306\301W"
+	.ascii	"\225us:\013\353\244Nj\246v\336H\301b\332\330\301!=\333\246\314"
+	.string	"\224\331J\267%go\314\026(V\334\324\250\250V\362\032\036 k\246\362\310\324~\352\247\216\352\271F9.*\026\324\022Z\333\3452}\302an\240d\f\232\343\025&\rR\352\364\364\tG\310[\222\251m\027\323\231\322&\365\336\233\336\353\243\313I\003\330\222V\252\343i\2232j\245\3226M2\230\257JX\264\255\347x\230\240Yzs\252\3074\3071U\352\335\313k\263Iy\231J\240\247\305\324\370\024iM\221R%\225x/q\275M\\\005\n\247%\3572\231@3\252|\371J\221O\225\262\314\004Q\3256\305\301`9MvoI\332\246I=\204N\364L\364isT\003\202Y\250b\3618\307\002\031\"D$\"\"#I\222\016R\013\020\004cq\334j\347\001\022\200\023E\220\202\222\231!\022\021I\222\202\244\244T\350\323\024Ju\306\360y_\211\307E\261xA\251\237\304\261\2359\201\200\227\b\276\272ZN"
+	.string	"\270\273\261\250\232\220[s\027\351Weh\220c!1\377\037Ia\271,\200\306'p"
+	.ascii	"\223w\374]\263\247G\005\330\026\202\331i\205$+Ut\234\234\306"
+	.ascii	"@\235\t\325\234\030\214\321:\263^\027\030\267\347\271\334\364"
+	.ascii	"\205\210\242N~\351\214\207\231\016\302\016\013\004\341c\016^"
+	.ascii	"\023\262\220\006\322fTm\370\367$\257\004\fW\327\310P\306\345"
+	.ascii	"\265\312\277.\335,\bMB\255\375+\342}F\370\231\233e\204\213\252"
+	.ascii	"/\347Y^1\251.\307B\032\177\226\261\023J\2758\244A5\f\360\016"
+	.ascii	"|\361\372\330&3\343*\345\263\354\315\351\242\271;p\244\361*\253"
+	.ascii	"\371\243\\\216\263\247G\200s\352h8{#\031+\343\320\303\256"
+	.string	"\267\213-\222\3535 8\333=\252G!\305L(\007\232\251\326m\246\"b\312\rm\364w\337\373\234\270p\202^\262C\212\272;\205\256\335#\245\246\213#YML`\275\312\234ZZ$Z\326\024\265Px7%8Y\357\340\354\236Ch%\362\273\220\244l\303\330R\005\234L\256\376\220\357:\3527Iz%Tx\017\032u\336\205\322w\363\316\245\345\356\362\201\353\217\357\207`$O\376\333\234j\245\201N\030\267U\314\330v\253gg\306R\235\365\344\321\260\375\325w\336.\334O\t\317\027(\035\"2\204\332K]P\2064$\035\330\333\261\353\365\006O\375\313\265\037\003\n`}L\b1\360\264\"6\234\261\325\016\020[4M\362\267\352ouf|\202\347;A+\270O\215\374\330R\304\\R\375v\316E \302\031\323K\3158\f\352\316F/\340\366\335\246\205=\352\362^\n\006P0\264\335\317\025\320q\313z\225\021"
+	.string	"\232\310n\032\030?\227wx\b\b\004\237s\220\034\262\275\217\361\277J\303\203\263\275\027j+N\311\347\260\202\377\031v\246L\f\001\325U\211\365\264\242\371\354\316\246\025\200#N\177W\301\34362p\345\032\376\003\003)\300,\224\353\036\323a\022\316J\300\371`h&\255@#\360\373\234hmX\273\372\016\362\337MD/\312\200\377\204\fO\270\206U\277\265]\321\304e\201\013\17701=(N\025@J\311\332F\207\214e\366\214\325\357!M]\023\334\217s\236\201"
+	.string	"I\237\244\360\275\261\035\256\375t\247\267\374\356.\002\022\202\033\362,\266\234\270\312\245.fx\300\233\331A<\332\006\341\331\325i\365j\f\222\367\220h\013\356\030`\260\354\021\353Q\222\377\023\2604"
+	.string	"\306B\207\236h\363\276\341\265\202)\342*\304\363\016\235\223\315\035\312\2469\221\366\214K\211\037\375\247n\345(j\277\036W\004\330\365^\206\3510\0165\303\023\002\344\223\264q\267\253\004\030@\006>v\211\357\023\205\251\266*\337\350)\252\353\365\335S\316\f\367Tp\221Y\270&\265!R;\3603S\264\231\203\310[\023\346m0\231\237\343\303\323\032\330\367\253^I\370\301,)\320\227\304\347n\277\2042\031\017\303\231\021\360&\031e\262\264&\360\026,\250\240\335^\244(h\251\007"
+	.ascii	")\233\210\264\b\310vw\331\363\\Q`\265\nD\013\344'&\t\2132(/\232"
+	.ascii	"\316N\335Y\376`\341\203>\366\025\326\370Bb\r\270\021x\363\250"
+	.ascii	"\327\365\263\017\242<\372eR\323B\237\230c\325\3460\222c\032\372"
+	.ascii	"\307i\354\332=mm8p^\361\221\222\004\306D8\026C\273\266\361=|"
+	.ascii	"\343I~j\361\263\361\260_\343o\364O\325A'J\334\032\036\275\016"
+	.ascii	"\271\304\267b\215I5\341\020\257\362\016\353\261\320\030\007\252"
+	.ascii	"\021\375@\267\321\027 \335\370\027\363\271\373\312\2137\303u"
+	.ascii	"\n\327\365\371\331.\305`g\343\304\320\204\262\r\366\r\231+\307"
+	.ascii	"d\334\330\200\235\226c\311\006\333\r\232_n72fv\2058\263\347\270"
+	.ascii	"Z\255\r\365\022\364\0036\022\275\212\\\243\001c\006>\321<\022"
+	.ascii	"\300\331\340\311\314\021\311y\310\312\361Y\371$<\321N\237\210"
+	.ascii	"\376\200D[\001"
+	.text
+	.section	.gnu.lto_.symtab.88e4c2e0039d709b,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.88e4c2e0039d709b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
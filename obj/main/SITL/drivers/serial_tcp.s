@@ -0,0 +1,950 @@
+	.file	"serial_tcp.c"
+	.section	.gnu.lto_.profile.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`(\001-\t"
+	.string	"b\f/3`O\322\030\020\230*6\027\356H\265\357\254\002co\177Q\315q\377\376\316\323\370\355.\020\004A\020\004A\2604K\370\220F\b!do\262\367\336[\246\275\003m\257[[U\035\301^.k\222\331B\305\225\231j\270\370\260\250\350\311\307c\203\232\366L\365\336\336\251iM$ Q\210\221\236\034\027\n\207\350\001@\210\316\004C\225\226\216\216\352@\300G\205>\212\t`\035\320\234\b\022\031\314\334\353\221zJD0\244\233\356\206\3423\341"
+	.string	"\361D\3676\260%\241\223\301)\302\222\261\362\250\301CJ\304\312e\234\020\032\232\3037\356:\320\310\344\362=\276\303\367\267\277\273m\035\302)@iV[\023. `\0022\252n\003a\241aZ\026P"
+	.string	"t\002\006`\257o\024A\036y\305-\250\200\200\312\372\264d\331\331\200\205\211\235\363\nFl\303\002'!\215#\022\233"
+	.ascii	"\001b\234\202\366\335\301\342\352\236\304\304\030\300\332\247"
+	.ascii	"\324\002\013y\023\240\240\352\006X\002\311\001\312sb\341\252"
+	.ascii	"]!\260}N\277\036\026\234\267\352\004(\256\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\355\004"
+	.string	"b\006\023\033\240'\351\377\377\377\017vUUU\334\327\bm\366\377\357\355\377\326\333\222F\266L)\356.\035\326\220\250q\374\3620[\366\005Gg@\n\016(I\221"
+	.ascii	"\032a$S\354Z(K\214>;\263Qd\177\r\271\355\247\352*\207\330K\360"
+	.ascii	"F$ \240\202\261\231\353\230B|\303R\026n\324@\252\004N\006\226"
+	.ascii	"A3\307u\b\366\026\355\263,\303\265\226\231L\r\004\370\261e\245"
+	.ascii	"i\237\221\013\030]X1\370\275\202\214\342\013\0063\212\242p\244"
+	.ascii	"\261\331\210\2531\314\352Z\330\214\345\201\314\2129\004"
+	.text
+	.section	.gnu.lto_.inline.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`6\004%\022"
+	.string	"\006\230SB"
+	.string	"\221&\3518\025~\334\370\360\367\3219\256\3561.\246=\203)\202\331\031\033\231G\205C\212\343\200\341\r@):\365\377o\001\352\205@\277\253V"
+	.string	"C\363g\036\230\376q6\032Y\277!4\335\032!r\247:"
+	.string	"@"
+	.string	"F"
+	.ascii	"$\314EG\214\026\007\334\357\212\235\"v4)\207\0228R\254\342\202"
+	.ascii	"J?\250T\375!\326\373]\006x\257\326\314L\353E\265\221\231\237"
+	.ascii	"w\0027\200\3428\216\234\213\314\364\374\346\312@\231\031\262"
+	.ascii	"G\226\335\353\232\220\231\025\376\272\233{\304\245\333\215\243"
+	.ascii	"\256d&\310\326\241^@\245N\330\213\234\351\224r\202\300\b\225"
+	.ascii	"\027(\b\256\260\330\313\264\277\306\341\3737\225\326\324\n\020"
+	.ascii	"26\316D"
+	.string	"\215\227c\013v\032\341\222R\300=P\201\325)\204\034\032\\H%c\177\203\366Qskv\230NT8\246\023\017\002\334\215S\n\252\300\231\314\366\021\031\344z\355\261|\300\034r(\034\324Bfr\276>>T\226\314\304H`\002\177\341\2503^Z:h\336\304\255\220\210\241\021\240}\320\02000\260 \231\243\371P\366\211\311\314\221E\236\326-3+\364\240\210\315\215\013,O%\334Q\3446\220P\266\353lP\351\375DE\2452|\030p\266\366\002p\250q\305!\222\251 \205Ia\2265`\002!#f\346\001\022 \225=B)\222fdF\224\226[\030\346,\f.J\005<\204\3672\220d\220fS\210\336\220\302\215\231x\253\007j}Kk\362\"\251\245\b\033\007s6$\237!\342\244b<\272\372\214^P\266[[(\271\307\376\002\003<vy1\321h]a\rr\273\016l\rPz\037OY[\261\354\""
+	.string	"\353'\346\376A\366#"
+	.string	"\242Q\235\373\270\247\265\024\025"
+	.string	"\252>(k"
+	.string	"\362`\262\024N\327\335\001\306Z\316+\237\313\364%\223Q\222\263\244\320\274x\330\360\307I\200\216<\301C\367:M\006\217\b\250@"
+	.ascii	"\356\035h\0178\377+\217y\342u\022\373!\023a\373ti\t\336\023\025"
+	.ascii	"\347\316\310\273\007\315Z67\b\337\222\322\016\f\354T\247?\246"
+	.ascii	"\200b&\013\230\367\254\237S\347T&}\204\234\353\002]<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`t\006\335\023"
+	.string	"fYZB0\217\222\016\300"
+	.string	"C!#\271\030Q\322\256u8\345\"\"\222\252l#b\363=LM\357\207\354\b\260\304\316%\212gT\027\341\341I\347\227P:B\f\325w;X0\r>\371\303|\243Mv#[\246\024@"
+	.string	"G"
+	.string	"G"
+	.string	"\277H\210\373\005,\221l\027\035\201J\0229\b\033]\327u\177\212\037\346%\2213\0205\272Ow\343W\365\353\272\373u\337\233\300\337\004\352)D\356\325\263W\245\221/\215n\313\253\337o\r\303\260\341K\020\306TOI\330.\036c\2635Fl\233\b\005\0225M\313\342_\361\005\231L\314,\212\310\375\245z-~\337\304\246-\f\324\023\243(\331\353U\021\271\224\352A\233s\225V\332\177c@h\210>U)'\321\266\225\320o\t,-\212cQ3B\210RA\231`!CJ\205\221\225\016kt9$\374\177\034\372@\327\203\200W\322\247\177\377"
+	.string	"\357E\016t\033\350V\272\005t\031\350jtC\272C\001v"
+	.string	"\357\377"
+	.ascii	"x\310\214x=\240\373\376\311\373\226\02659\23163\r\003\261\\Y"
+	.ascii	"\246\261\314\016\327\t\310\005\222\223\225\016\313\215u}\300"
+	.ascii	"<\035\314\203\325\271>\236\316\344\200\201\250|L\221\t\3022l"
+	.ascii	"\212.Ph\303\304\200\362a\211\300r\263\261.\017\326i\231\363\243"
+	.ascii	"\265\314\0205A\037\315eZ\031\246!w\250AI\244\324\214\210$)H\262"
+	.ascii	"\214\001\200\002\221\252\232\362\022\340\321A\212\303(\222\001"
+	.ascii	"\231a\246Fd\244\260\254\222\224\036Z\223\024k\365\205\357|J\337"
+	.ascii	"\025\356fdeK\215\036\n\"XaC\220\371\"\357\013\021B\301z4\244"
+	.ascii	"m\256\0206_\020-\270G7k)B&\255\326\3544~R\252\200*\252\205\302"
+	.ascii	"\223\220\263\216\216\254\nM\004\251{\035\202\202@\311F\327~t"
+	.ascii	"\243_\277\\\212\202\377\r\0359\347P\266\002\337\322O\231\355"
+	.ascii	"\314\002\312\256\005C\206\235\350\n\271\307\007\273\375uE\367"
+	.ascii	")N\331C\304\357y1p/\357\377\246\331\241\312!XHY\351O\231$\373"
+	.ascii	"\002\020\371\026 \feu\340}\324\373d\013\t\270W\b@\324\270'\313"
+	.ascii	"W\230\201\200Y\005\222a\037\301\362\355\201\001(G\035\230\362"
+	.ascii	"q=!\303\241\345\245?\022\263\022\032y\302\264\006\035+\206\367"
+	.ascii	"\304\215\266r\031{Mw;\251m\353\3355m\250\303\003\324\344+'Q\r"
+	.ascii	"\025\007{"
+	.text
+	.section	.gnu.lto_.pureconst.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\232\005\002\232\005\005\232\005\006\231\004\007\231\004\b\231"
+	.ascii	"\004\t\231\004\n\232\004\013\232\004\f\204\004\r\232\004\020"
+	.ascii	"\231\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\214\001\005\t"
+	.ascii	"\202\215%'\220'I\007\377\217\220\363\337\005\275M\220\231\231"
+	.ascii	"\231\235 \324\2545\370/\326\f\264\326\206\266\302FD\250Yb\333"
+	.ascii	"\2262\005\247gr`6\203\364\274\343\265\340_KB'B\247\242\363\240"
+	.ascii	"S\351\\t.4\2612\360\203R\023H\337Y\024\360\023`\255\344\216\321"
+	.ascii	":\353\2132\361w1\2753\250\261\031e\372\371p\025\0019\321\313"
+	.ascii	"\302\007\203\243I\302\007\262zj\263\001r\312UgS\336\224+\024"
+	.ascii	"\371\371t:\235\216\332\252|6\312\033\235\252k\316\025\345\214"
+	.ascii	"\332\317p\202\013\005= \200\002\231*\273\0039\305\237\034xFa"
+	.ascii	"\223H\366\274d\307\332y\266\376l<-:\326\272\322$\230\2429<\310"
+	.ascii	"\200\235\3426\227\034\003#\300\204\201N\354\032\355\033\002\360"
+	.ascii	"\002\256%\212\2133\2638;rdo\344Vb\350\030\352 \021\200 B\016"
+	.ascii	"#lE\341\"5\"1\214\020C\350\212\f,.\257\206\262\336&J\r(\247}"
+	.ascii	"\314\330\340!p\022\353\032\374\206\330\227$Um\220\330\264\375"
+	.ascii	"\301\2704\016/O]V\224!"
+	.text
+	.section	.gnu.lto_.lto.b09f0db5d2a313df,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tcpVTable.17.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375 \322U\005"
+	.string	"\004\t\230"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}{yw\212\001\202\200\200\374\342\303\315\204\013usq\274\236\344\244/om\270\314\344\007ki\370\307\224\tkg\270\307\204\007ec"
+	.string	"?\202\210\200\340\001a_\305\001]\304\001[\303\001Y\302\001W\301\001U\300\001S\277\001Q\276\001O\275\001M\274\001K\273\001I\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_tcp.c"
+	.string	"\013"
+	.string	"\200\224\230\244\310$\006\352\312\031\017\202\201\023\320\016\bK\to"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_tcpIsStart.21.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375 \350m\006"
+	.string	"\"\314,2`m\322\030@\214\304(NR\310\214aM\300J\262\233\207\235\376\001\230\326\254u\252\263{\r\276\227$\325\020\004D\222\341U=\"$\245V+\261R\312\024ORf\322$,`*G]\355r\224C\345\024ZC\205ah\223\273\232t\331\312P\256i,\3135K\266\250\240\324\213G!\0369\260\343\215\031?l\0221\214\306\r"
+	.string	"F\251\002\026\236\f}\326I\275x\254\254\202\376<5K\220\344d\227\"\224\262#Q\210\306\317y\313\006\007\234\337@\204\232\210Hx\240\354fM1\360a\276\0217\220\340\003\004\373t0\003\020v\367\304>\025\270\342_\360K\377D\b"
+	.ascii	"2\003\316:#f\b\3055q.\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_onData.22.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\355\n"
+	.string	"\026\325KA0\307(\035\020\335\036\225\374\334y\275\301\246\250uSk\025\277\327Z\344\024\252\350\272P\301\032lt\267}\354\304\024}\250M\030\273\246-3\303C\227\346\020\221\226_^{\222\205\034P\331\354&{\247\0247"
+	.string	"9"
+	.string	";"
+	.string	"\260\335Ja\272}\272\236!\363\271}!\363\351\320n\360\272Z\f\005%\002\036\354.\225+\017\037C\377\256'\240R\245G\rgw\035Q)\224[\336\366\203m\013\373\032\001\365\236o\375\232\026\035e\36453v\340,\003\273'\263\b+\233\004Z^\177;\364]\346l\327\021\316\311$\003\266\300\301n\235\370t\305\366h\037\3461\341[\244+\354\252^\001$\262d\333\373Kd\213\262!\001\310\007\270@D\020q9Y/\006\037\300\f\266\335\275\360\001\214B V,\237>)\3639\245\204\013\204\226)\316\354Z\212R\305\276\266\273k\251\262\037\340\273\333\263\tyD\033\036\235\317\327\201\024\374\272\321\347\343\240\037\237\016\210z>\220n\034\354\205\272\217\212<\357\243\\\335k+U\2361\231I\236\314\305\313(\247\264;@\361(s)\001\020"
+	.ascii	"3\241\t\037c`\013\257\204}\217\312\004\251l\240\334\243\210\326"
+	.ascii	"t\202\251\t\"]\263'&HD\221\315S\247\3075\274\020&\031"
+	.text
+	.section	.gnu.lto_onClose.23.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`n\002\375\022"
+	.string	"6\243{H\340\320(\035\333)9\222M\256\f\306\017\253\203nM\377\275p\354\327\001Y#.\207\346\230\230\226R\032\347\306\327\036\250\026\265\356?`~\327\023n\3267\342\021\342\r\343y\360|\260\210\2342\263\200\230\267f\244\355\275\245L2d"
+	.string	"\\"
+	.string	"j"
+	.ascii	"\372\241\252a\214I\214\303\203\237\034B\335\341\201KM\340}U_"
+	.ascii	"\273\355\365\233\314\001t\343\250\370\351\016\021\350\347]jx"
+	.ascii	"\001\363\322{\310\274\324\227j\320C\235.\t\262I1\324\335\037"
+	.ascii	"\207\370\353\221\367\245\037\231\220d3\330#\210\263iF\023E\272"
+	.ascii	"\373<\337\016\263\330"
+	.string	"\356\310\244\273ue\263\017Wyu\240\272@\001\362<k&\324\345(\024\207\327\335\013\364\270\324\352\244\263s\251\227\231\227&^\\\215f\273\315\354N5\204-\347\250>vw+\343\250>\274\232~\373Ax\2654Z%\305U/\256\216\346\352\214\253R\256\306\270\312\274\272\274\372\220/G\244{\317\216n\017\273\036\235\223/F<\374U\177\236]s\331\211W\243\300\200*\n\205\275Lc\3370L\3650\016\244A\277\243\025R\366\262\224yIb\322\315\310G\354\365L\036\361mT\356be\362\352\"K^\\\r\237\242\031\226\267pE\346\034M\304\215Y\332b6|\212\256\232\252\250\263P\025\250\r\351\226W\360e:x\267;8\317\313K\243\206\026\263p\037\260\247\345\202\0273\037ZJ\235FR'\221\022\327i\202\004\006(*'\020\032\244\004h]uE\221\274\240`V0\260\200,U\353k\261T\033@V\352\313"
+	.string	"\262\270|(V\353#\021\321\325\213\212\365\301\254V\254\357#\354\307f\034\375rDB3\034\213\234\343\2323\\ $\267\022\272\355n\030+8K\334\202\273A\263<d\200%&`#\272\rXf\311\036\377\304cD8\t\332N\007. `\002\021aU\036\223\320\345\214\361,\230u;2\032\353\277\320\220\275\364e|\335\222\2754\262PQ\005\274\213\227\237l\244n\271\017\213"
+	.ascii	"\366\274L \321\n.\331\223y\"\266\244\2617\366\303\t]\307HR\022"
+	.ascii	"h`UFx\243!\035uq3\233I\253\034o\023\320h\001o\326D\215k\020\024"
+	.ascii	"\362\350\351Y\3131,\270\334S7?L8"
+	.text
+	.section	.gnu.lto_onAccept.24.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\251\004-\034"
+	.string	"v\361\257H\240\230Q:\300;\312\020\227\230\317\370\300]\346C\242 \345<\210\301\376\004\345\365jm\005|\004\311!\360\377\316\203yf\277/\006\373e\023\361\220tz\300\203.\255\322Wu,\370M\236\257\261\"\177\260\377\023B6\2212\311\224"
+	.string	"\213"
+	.string	"\245"
+	.string	"#/7\357\r\214B\264\324l\335J\261\326\030E6\325\212N\371q\342\277\373\037Y\330\356\022Y\274*\311p\001\221^h\325JLp\272\f\314\363\356\213<\352\374\260\305wjub\"\245V\242\202\255\231\247K|\017yj\036"
+	.ascii	"y\272\347.\231\023\237\352\203\342\222\2224\265\326Z\357\370"
+	.ascii	"y:6\237\373W\320wZ\343c\007\251\220\3000\t\326x\217@\302,4b\301"
+	.ascii	"\244\261\207K\2161?r\206\021Db.%\324Z\227\201\301\031_\362\273"
+	.ascii	"\313awI\354\216W\001|\340\020yJ\266\313\006\355c\323)!\022\027"
+	.ascii	"\267{\354/\021}\211\255\273\213\b{\f\337\334,\345\205\252\315"
+	.ascii	"\355TFSA8\223\005y\372n \223\323\226x\222\3152k\255\016\366R"
+	.ascii	"\035N\314\236j\255\207:\335\267 O}\372\211\351\2060j\370\343"
+	.ascii	"\342.\321\307\255c\367cm\247\335\023\277>\037\376=%/\217\311"
+	.ascii	"\273S\362\352\230\2749%o\254\344\305!yoF^\330\310\373\242\274"
+	.ascii	"\256\222\327l\336\222\344%G^:\362\216\224\267\003Q\247\021\236"
+	.ascii	"\032b\345\242}\213\323\273\023\376e\367,\240\231\037\027\257"
+	.ascii	"v8M}O\210\fi\247\035\326\205B\005S)\350\347\364f\2546\266\334"
+	.ascii	"\274\032\346\352\227\026\233\253\205\230\256~H,F\037\232\250"
+	.ascii	"\200f\270\352\f\027\034#\0016{\327\302\205\244\305p+\273\033"
+	.ascii	",\037,\263;8\245\346>\200B\253\276\021Y\366\b)1I\274\206\212"
+	.ascii	"Q\331\003\230\200\b\243\276\201\334\325\360\252\rMq(I\263\345"
+	.ascii	"\303\334\264\217\344Q<\034\210\020\252V\245\003"
+	.string	"A\230J\r~vC\210\340\003W\266\324\276\3357\271\223\336\036j\205\206\002\373*\232\321\212f\262\007B *d\020\021`_E3\031-\305\254C\320\004\017\262\234N\226\323\341\216l\267\\Ng\223\255\270e(\320\373\355k[\200\302v4d\202\b\307\273\365j=\336M\005\216WT\313\341\210N\324l\274^m\201lu(n\274\332\221N\307\253\301\210\365\022~\215D\201x\207\007\345A\303\263\025a\247\037\245\t\210s\372H\316\036\347\017\263\326\337\201\345\267\n\251\023\344\024\262Tf\307\002t\332\225\265Y\020\260r\372P\256\314x\253\256\265\261\244Z\177\bbCN\".\332\027f\307X\002b}(M\303\003L\373\031X\250A$'\231S\252FD\224\024$M:\220\002\221\261\252\036\021 \261R\016\252\2312\233\003V\231\025\343\221\361\227\310\224\237\366]\177t\353s\\A\r5Ha\301A\360C|\215\017"
+	.string	"\253^\326\346\204V\"\230\303\276 p/\234\313\033\320,6\013\213\006\272\370\305\317&\360\027y\216\201o\210\207\330f\334\243\245:\352\023+\240\300\257\352\351nt\027(q\203\315\"&\002\233\206\037r\212\256\333\b*'\302\211\263\230\225M\005<\363\260%~\215\206\033;y)1\233\244\220\263/\300)\236b\257\237\322"
+	.ascii	"s]\376\037\220\300\245\231\251\250 \"\347[\302-\2558rdD\237G"
+	.ascii	"\367\005\365lG\321C\321\261\324"
+	.text
+	.section	.gnu.lto_tcpReconfigure.25.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\254\007\375)"
+	.string	"ZJh\020C`\346M:\201h\016;\373c{\335\022\207.]q\221\237m\212\3257(\033\215\204\205(Fc\234\271B\004)\211\314\206\220\201\2579\236.~\317\002\372s\275o\036~>\004\202\202\334\335\2324B\310\2262\005\346"
+	.string	"\340"
+	.ascii	"\003\001\375\337\331O\315\276\257\373(\332?\273o\236}k\366\333"
+	.ascii	"\366Y\202\206+\206\364\234\342\356\005\262\247\350\322\235rV"
+	.ascii	"\376\353\370\203\377\273\177f\3431:\230\314\347\376\273\267I"
+	.ascii	"\0375\367\336\251?H\371TMNB\233\327VF\272\367\311\0345\367\262"
+	.ascii	"M}\230\362\371\377\234\306j:\2762\261\235\005\001\332\235y\225"
+	.ascii	"1t/\333\360l\254\204\362\231r\022\312\247\205\302+\033\t\203"
+	.ascii	"\300_\352CO\323\366z\346b\2431\026\002\305\3068X\027\226\304"
+	.ascii	"T\263\204!i \327\261\263\373\035\211\312\022f\244S\237\325\233"
+	.ascii	"\343\344\016N\254\b\243\246\204\27421\\\027Ff\006\201\324\215"
+	.ascii	"I\366\311]el\236\\m\220wpbclM\005K9cGb<L%;N\372p\033\367\227"
+	.ascii	"\030\262\333\267\341\336\373V\212\005\341\037\361\377"
+	.string	"8\377\337~t/\226\353\302\0346/\2505\373\0026\235\372\034\002\265\366\0271\242YiZ9-!\236\362/\301kNPP\263\252\2410pv\357e\264\325B8\262\247$\322k\b\331arZ3\266cu\334\332\314\244n\313n\234F\005\323-\321\356M\262rE\232\224 \305\202\252Yy\225\207\345\372\031\216\321\3308\243\275\212HD\371lk\305\346\016\221q\025\345\222\316~\013e\333\242m\317\216F\264\256\361\333Vz\357\265p.\303f^\234\321\370|1F\263\222\317s\f\224O\266i?\316\226a\344\272z\357g\343jk\366\263y\357\275\267O~^c\216b2\314\352\373Pf\377\351\327w\372\365\233~}&\263\277\364\353\017\370\365\225~}\001\335OJ\373\001\272\217\224\366\001\244\375#_\337\310\354\013\273\037D\373\300\016\026\311B(\003\224\\\"{\357\025:\312\262\333*d\035\222\336\333\305\312\346\317\241"
+	.ascii	"\212\254F\274,\327\027\031\033o\t\017\200e?p\326 4\003.[\225"
+	.ascii	"\364\033\027\272#&\234\310\350\247A\377\253\331\n\245Yyds\244"
+	.ascii	"\205\035\312C\032\243p!\243]\323\307\213\221\375\327)Lh\245\302"
+	.ascii	"\312@\2525\262\024\222\354y-Z\261\240\377j\205\003\255X\030\200"
+	.ascii	"y9\303\377\252\205\363\266\254\002\260-|\370\317\326\022\236"
+	.ascii	"\237\f`hK\265A\314[\350Y\017\357\331Z\271\254]\326.(\237\005"
+	.ascii	"\300\316\226j\203\362\314\231\325\001\203wF)>\205w\2040\202\300"
+	.ascii	"7\016\310$J\376~\314\206\323_\235\365\013\323I\255\025\243\203"
+	.ascii	"\274\203+B\266DOz>K\322\326|\007\032\225\263\206Y\305\244\311"
+	.ascii	"\022R?\207\016I8>\373#c7Y\237K\317g\203\362\211Za\033\0364G\b"
+	.ascii	"\364\357\341\003\312\312\323\332;]z\034\312C\006\007FE\0358P"
+	.ascii	"\013\201\t\022\034N\250G\243\013U\013\201j5\243\330\242\211\304"
+	.ascii	"\323\201V\b\324)\325\212xU\244r\241\336 fi\311"
+	.string	"PS\230x:0\312\212\210\243xEU\314*\316(\252[VT\304\343\025\225\212UT\263\216F\032\005\254\212\215\305\257j@\243*\213\305\025U\361H\304\032b\035\2115\212G\253\341\214\"\225\214a\325\021k\330@\275\221\006\3618\3142\032\217\303 \333e\363\332'\367\331\201y\213\363q\034s\033\203@\242y\305\231Q\026\312~\375\207\262\337\320e\221FM\326I\310\312\205L\223l&\305\347S\330\223\017f\262N\335\203\231l\023\223\235\2407H\250\344\326`+\017\2574\311_R|.y\365\327\222\375\221\r\260\234\\\"\023\240\002\254\222\231%R\200\215`\007\020\362\356m\321\005I\221\323\013&\331\026mz04\020\311\236\327/4\300\217\025H\2632\311\366\016\243\020\017*\200\375Mq\251\001\200\211\250!<\003%ddF&\210\202$),t\240\"!\262\232\007\0210-c\020Y\230 \005I2\254\001X"
+	.string	"M\311\307\244\361]I[C\322$.\351IZm\201/\300\274\243'k\205\215\340x\310\245\244\021\030\033\3670\207X\314\306\032>\024O\350\211\n\261\020\002\331aj\3079"
+	.string	"\203]\205J=\032\327\241\235\202|\261?\210\213\277\254L\372\300\317\213\007\330\013\372?"
+	.string	"\247\316\272\rs\216m:\363\304[M\242\254\212\274\003P3\311X\2600\340A\177:L\2764\310\005"
+	.string	"j9\326\023%\265\305\001i\265\250f\321\354\210Y\265.R9\022\f\224\375^\211\363\243\344(\301*\365=\260w\373\360H\237\336\200\033\316/\355\276\332a\021\177\243\217\373\325i"
+	.ascii	"\352)\347BYR\360\235\242\352\277\322\034Zh\342\236^\203\237n"
+	.ascii	"'\037\025\2215v\332\345N\t\213\352\362\013\255\355\272|)\374"
+	.ascii	"'\257\361S[\345\321`A\202\325\274CI\226Y\324A\200|\301\237g9"
+	.ascii	"dW\200\021\240\354L\236\002\243\bY\177"
+	.text
+	.section	.gnu.lto_serTcpOpen.26.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\226\005%\035"
+	.string	"\226r\266G\220\234Qc$\342\r\225\274\347~\352\255;\006<\356?\346\310\177\316X\241\224\353\313x\262\253\006p\035\202\264\027\227O\226V\326UuL\254x\323\263\325\253r\277o!\031'\177\363\334\377\r\3328oA\310\336[\312\224\002\235"
+	.string	"\226"
+	.string	"\251"
+	.string	"W\270\243\352\203\371\344\256\231\200+t\302a\301\326\037_|\300\275K_V\367\032!XB\354\247k\265\257\344K\210n4\226q\356URbu\357\205`Z\354'\217i\333?r$D\376\315\214\305$\230V\327Q\023\345\275F\232\2157\200\376\214\235"
+	.ascii	"\372\323\362\370\357\350i\332\372\363\213\216\036\261\202\247"
+	.ascii	"-\263\324\342\222\032\022o\232\025\254\034\263t\206F\346\311"
+	.ascii	"\224$G\316PX\255I\240\206\230-\235\241\320|\020fh\343T\257H\303"
+	.ascii	"`\255\260\013\367^\327t\230t\303n;\310\266\315>\221\004V\207"
+	.ascii	"r\363}\374t\n\\}\372\323\307\241?\253\225\240cKJ\254[]d@\261"
+	.ascii	"\037Bo\177\234\262\b+\033\303\354\355\251\316`\350&\310\025\365"
+	.ascii	"\006X\227\266\261\250Z&\373\346\265K\366\245\376\235C\375\t\356"
+	.ascii	"\344\237\375\351?\360\343_\340S\267\354\306\037\346\352SVm\312"
+	.ascii	"\252m\254\272\342T\177A\017\020e\031\005j\356\235\261ls\271\234"
+	.ascii	"W?>\365\333D>\225slO\345~a\320\300I\203c\310\334kt\360\323?1"
+	.ascii	"\230\024\013&\035&P'\274\236\023\312g\n\bO\363[\202\246\2429"
+	.ascii	"\023\264S\304p3\031v\222V\327"
+	.string	"#*%v\335\336p2cdJ\016\017\003\006\246\024e\244\303\277$=|\313\213\322\353\\n\203\270\226/\313b\245f|\250\035\342[|\f\222Z\024$\003$A\031\361:\026\037\004\305{a<\365\255\374\212\b\223\204\017\372\324\247\347U|t\212v\211S9\021\273\367N\230\242\302f\213\367\336\363\370\344\304%E\004\326e}\202$\304x\236\210\327\024\023\3639Tfg3\276\234\276\f\2500[\255\215\242V\237\312,\217\221-\262\037%\007\340\251m\335\257l\r\222\367^\n\001\274\363V\344p=]\016v\003\312\r\231\267^m\004\220\257\366\023\253\365j\032t\202l\265\037!\241Z\006\027;\031\020\256\332\026Ag\353\241\020\252\341v7\036\215\267\273\265\300\355\200h+p\265!\232m\307\243E\340qNw\333\321z\271\334\216\226c\2747\257]2\272\343\353\by\3128h-\243\220\246\377CO\213d\373\264\276"
+	.string	"\264At\347GEb\221^IiJ\020\244\306\360\035e!\327\314\204T#\236\360TB6\035\030R\201\356\252E\307\25257\n\024\371\362\305\033`U\323\r\263\351m\276\326\374\216\\iZ]\017dJ\264\326\376%\tg\250QL\307 \"\231!E)H\222\341\340\"\021+n\003\021P\255BH\031\211\202\262dh7\354\255fK\316w\177\026!\305\n\262\221U\271\341X\324\241,A\332Zp\355\336=x\217]\267\315Ma\177\205#\220\007uT\317\234B\333\234B\233\316\320\025"
+	.string	"\2145\317\202FB\247\0261\366w\007\025\347\315\375H0&9bt\215\r\223\210\351\317\232\236\247\302x/\020\r{\372\032\360\n$Z9\005<6\366\244W\346\034l\362\353\213\203R-\273|s\234\206\270\327\b\311\234\267\346f\371{)\245dR\375\310L\375:(Q\225?\357\320 _\215z;"
+	.ascii	"\t\006>1\350C$\211d6\251\255\325y\016\305\004F\317\271\n"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.27.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\361\001\305\020"
+	.string	"6\037nE\360\262&\035P'\335\021\260\177xGY\270s\306\345?\rN\233\316i"
+	.string	"l\307\305\314g\330\232Q\263\266\r\241\315\203]9j\001WvR\265\260uX\234<\306\344;Y\361\376\034\327\260st\254\222F\366\2262\245V"
+	.string	"T"
+	.string	"^"
+	.string	"7tv?\004\346\264G\177\232m\037\305S\250\330\203\037\314+\213\225\330\020\333\261\373q\241\213d\217\360\001\262G\035q\357\021jz\376\247\004\322\310\344\270^\252\307\226C\320\253\345\032\362j\301\320\356\336\346\311\362be~Jv\327\351zy\270\263\333v`{\201\235\r\002\361\n\212\311q\205Xe\217\375\251R_\354\303U\027{\003\375\373?\257\2713\230\2160\raZa:5}\220\rD\r\003:v9\364\370X\236\b\303\304k~[\305\267\361\346\327x\232\252\203v\023\243\301\261\373\035x\264\002-\323>\354*T\376e8\200]\227\003tD\240~V4x\300VP_6e\020\263\2632\303\312\335U\251\276X55\202\315N+{\330\026\335\2057\322\242\200\352\b\t\230\273\263\360\004\300\330\243\343L"
+	.string	"I\215\253\031'`[^m\n'y\227C-U\331\277\301\2206\\\266\351+,h\273\233 \206\202\""
+	.ascii	"#\363\350\247d\017\251R\212\251\213\243\256$J\241J$\315\035\t"
+	.ascii	"J\2272\251 \"\235F(\016u\032] \235$p%\222\350\204\353N(\216$"
+	.ascii	"d\023\312\350\304\245L\246\023\267}{u\361\203\030\020\244\032"
+	.ascii	"d\300t\323LYlg\032\302\362\201g\245,\b\211\323\303\323RU\214"
+	.ascii	"\n\322\377X\231\201\232\032\025\346X\021\3012\371\013/' p\002"
+	.ascii	"!\302\343\001I\002\366?\374\362B\244\031\321\340\005\341<z\371"
+	.ascii	"\017BW0\216x!x\210\217\341\231'I\362h\303\013\341\3349\351>g"
+	.ascii	"\240\255\222\337\342d.\210\306\035)\034\372\276\241\031\207?"
+	.ascii	"$\b\030\267\232\200\324\202\341\274\230\317s\333\035\224\200"
+	.ascii	"\322\343<k\214\237\336\332W\006"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.28.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\206\002m\023"
+	.string	"\006d\177H\340\320(\035\330\003\327\35580_\244W\211\004\213\267\250\261IR;h\235\363\310e\310QK,E\356\366\377\255!UP\262\342*\177\342aL\337\003\b\002!Z\343t\304g>\030\031^\345\245`\274v\343\210%{K)Sf"
+	.string	"e"
+	.string	"n"
+	.string	"\n\274\335_mZ\342EG\013\032\240{F\006O\367\210\340\237\247\363\243\367\377:BI\274\\\224#\315\254\303\351\\\300\331\350\036?\223\022\350tJ\025\320\351\344\016*\352\224\274\342UT\"C|`!\233\265t\306\250\364\230\305(\227f0i\352n\305\351\302\314^\273\242\222\356\376\312f\032\364\235\3767\371\337\340\337\026\001\006hjt^)t:\225=lvd\033\\\233\373\307\3262\355W\331<\363\353M_\"}\350\250\332\2418zO\356Er\337\311\375\224{)\367,\367\313{\005\031\375\300\030\031\352\306\220\313\321A\263\007\204\336Tqt\377\227\353\215\342>\302\021M0\220\206\321vj\013\364&z\255\f^\016\016\210F\367x@\347\003\035\034\206n\330\346\344\017\336\027\261\232\344\345\311\323'&\363:\321\025bHO\001\311\242\333\214\0336\227d\032\211\035\330"
+	.ascii	"\305j\257\355\356\0263\355\314\313(7@\260\305\361\377\244<\342"
+	.ascii	"\310\216\b\363\210\007\333Q\232B\034@\363\203\252\023\201\264"
+	.ascii	"<]B\"l\243U\376%\254\254\312n\202q\353\327\023.\033C\366\253"
+	.ascii	"\324\304\004\257\273\023\344\250\254\002)\340\312\004\f\031\254"
+	.ascii	"@\226\013J\007\210b9\261V,)\357(\222\026\024\353D\345\224\n\301"
+	.ascii	"\325\267\n\301\n\2510\345cI\235V>T\270\372HLW\265\200\341\307"
+	.ascii	"R\251\302o4\266\312\346\231?\370\221\037\2545.lLb\217a\376\227"
+	.ascii	"\270\004\343\023\344\342\027\204E\241\"\b\306\255\003\310\345"
+	.ascii	"r9\025;\021\227Xk\304d<\356X\304\235P\254\366#\212\370\204t\034"
+	.ascii	"0 \240\002\2419\333\001_'\364\240i=\261\216\274\220\321\303\352"
+	.ascii	"\274Y;\035\006\216X\"\016\003?c\254\315O\355\245\t\347\276\""
+	.ascii	"x\200\217\341\231'm\362lC\205p\356\004\351\036g\240V\221\337"
+	.ascii	"\"d.\030\215%R(\364\026\206f\016\017\22288\016(\305\261\033\242"
+	.ascii	"\246K\036\265\226C1_\347kw\320\002\312\216\363\2561\352\364\326"
+	.ascii	"\2322"
+	.text
+	.section	.gnu.lto_isTcpTransmitBufferEmpty.29.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\022\001\005\r"
+	.string	"V\230XC o\224\016@\270Lg\306XZ\003"
+	.string	"~\303\\9\320V\263!(\252\227\316\005\271a!\305\275\375c\375\272\"\374\207e\355NT\2204\021\244$\030\020\200\221\364:\337l\004\032[\025k\203H,!R\246\024C"
+	.string	"@"
+	.string	"J"
+	.string	"\001vGZ\244\330\215\b\f\265c\216\037p9\246]\300\345\230mopF&=\252PO\271"
+	.string	"9\231\261\033\241~8\351I\362o\362K\304J\305)\244\364\314\032\354\256\363\024\242\341\326\3336`\233\201}\017\001\366\257\335]\353\210\375xgg\375\327\225\326+\235\232\276F\001\030\"\035R/t%.\252\205e[\230\312\352\361\267G\276\2111~$iJqQ\033+\024\222\003\307\254@\313\264O\362\222\321Y\027\036\033'e\243\312\001\301r\347%\266\214\312\346\216\"\201@\352\002\016+DJX\230\274\332\023<\371\2235\030\264d\377\304#Y\234l\320IT\320v7\301\210\216/\243\nq\314\267p9v}\300bZ1\261\341#[\354XJM\005\036\242\220\307\301\327e\334\366\351\210\276O\247y\333\2046\021\007\205N\347q\037\374<\256\243\363\"\300O\327\361\300\315\373\340FcP\210\363\240\b\004\362 &\356\355L\001d\220\321\372P\023\204L\211\321RM\315\364(@TL\034?\021\030"
+	.ascii	"2\003\3020\273\t\023R \254I\301,\017\204\202\202\201#\246\222"
+	.ascii	"\376\343L\024\254\002~\215 \236\t\321xF\212\t\r\367\205\361\256"
+	.ascii	"\331\027\013\333\211LM\260J\236j\306$L2"
+	.text
+	.section	.gnu.lto_tcpRead.30.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`M\002\025\022"
+	.string	"vavG\320\322(\035\223h\302\036(h\351\227D&\304\263.!O\225\353\322E\262\321K\032\301B\220\032\243n\370\317\352APp\355\300~Be\2038\214\355`\006\271\032/b:"
+	.string	"\370\206\275\221\220C\352\024\262\331O6\2212\245^"
+	.string	"Y"
+	.string	"e"
+	.string	"_q\0263\307m\270\200]\235\0265v\303\004\376L\217\016O\300{4}\200\367h\333\n\026\314\030\366\260\007\307\333I\262\021\032\262\033~\312s\330c\247\t\363K+\235\355\346\203V\213=\346\274\033\251\345\\Oj\263.ew\017\364\274\251\3112K+\273\353\244\325>\334\336m\263\330v`\347\211.\254\002=?\217\376\005\357\361:b\303A\013A\2239;\214\245\356\330\357vw\255:\366\303\273\344\270\037@L\227b\332\353\322\321Kw1\255]:5\375"
+	.ascii	"'*x|\271]\234\\\221=\212E%\036\376\366\214\017d\022?\204\231"
+	.ascii	"\326Di\210\247\003\220\335\020\301\243\033\2302\355%=\371\374"
+	.ascii	"(O\325S\016\266\0375#d'zA \361\037_\306{,\321\013\335\210p\221"
+	.ascii	"9w\232\032U\215jP\3102g\325No\223\024\3414P*=3@\003\252*>8\267"
+	.ascii	"\\\206\f\n\222\235z\f\320\004)5\202\200q\303\231\344\325\246"
+	.ascii	"\260\312\323\2342\323\230}\241\f\211D\263-\374\305\213iw\031"
+	.ascii	"\004\005\025\300T\2010\251\227\013fe2x\212\001_-.\251UK\345\372"
+	.ascii	"\\-\025\206Uk\302\007\263J\275|`\313\365\235R\314\212Q\265\276"
+	.ascii	"\027\213\325\372H\302}\267\252S\242'\036nG4*cI\242\024G3\215"
+	.ascii	"EOu\344\320p\033\242\005\351\216\362\214P(7Lz\f\331\204\344\356"
+	.ascii	"\306Tw\\RO%\004\355\230%\021\333\017^\204:\3318\020, \220\002"
+	.ascii	"\231\251\354\001B\241u\013,\023\256y\037\245\331p\360\022\b\026"
+	.ascii	"X\206@Q\01636\256Hp\025\302\271\317\n\371\221\304C\b\027\362"
+	.ascii	"\271y\210X\371\024\206\021\f\265e\003N\210&\0275\244{\316@XE"
+	.ascii	"\216\013\322\\\320\032\223\245\250\351\351\267\315\370c\210\205"
+	.ascii	"\215a\262\363\326\214\034\226o\345\306\336\333Z\243\007"
+	.text
+	.section	.gnu.lto_tcpWrite.31.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\210\002\255\022"
+	.string	"\366axH\320TQ:X)\206\020t\031\260\026z\360eT\232\324\036\030#\r\030`k:.,\\qO\234>\374\327uI\207\372\223W\341\030(O\341@-\201\303\027O\240<\271B\202N\220\306\336\257\331n\2561B\366&R\312\024_"
+	.string	"\\"
+	.string	"h"
+	.string	"\3354B\ft\177\205\241:0\255\205\320"
+	.string	"\3355:?\335#\202\177\236\312\217*`\252\364\364d\252<\354\037\242\343Mk\317\t\031\236\242\356\3768\205\302Tr\274\260k\267\002@\244\305T\316(7\242\315(\227h3\316\324\335\032CW\004M\266\333\255t\367W\244\221\320O\375\017\341\277\312\277D\002W\036\017k\023\377\225\316\330\340u\367\202\035\r-\006nrZS\245\362\310E\220X\002fo\377\030[\266\371\225\353\356>\327\374:\252\222\264\246:\232{o\356\273\271\237r/\273=7\367,\367\313\355\365\244\204\344\207JO\367\210\233\222\036\2229T\374W\223\377\274\177\002\0050\035A\234\003\227\240;\300\223\216\003\036\237pT\3019\271c&\212\241\221\341"
+	.ascii	"Q~H\223\245\f\350\b\211\257>\257\t\003l\335(4\347\3722U\236p"
+	.ascii	"L\310\330\3339^\226\274BbV\310\366"
+	.string	"vf\216Uf\t\005\275\001\246\330l\020\2601\247\004\251\275\202\326x)\335\374,J\003\305\313\274\003\324\242VZ\345_\205aU\274i\306\261\007\031R\253J\261P/\027k\345=urI\275X8\240V\241\312\365\271BU\207Ux\341c\255P-_*t}'\323[.\252\360{\265Z\341g2\266r\315\033$\031\202a\331\013\354\210\177\007\017JE\021\326\207hh\3061\331\261\217\036\037^\364\210E8\26698y\200(A\244\016H\020\013#\333\3351f\233{\334\261\205\035\241\331\"\371\0033 \300\002\021\242\344\001c\300\002\206(ZTS\364\r\306\311~\323v~\220\021\245\035\204qU\264QG\360\023\370a\230\305}\330\243\344\275%\212)X\205\360\271Y\210(\270?-\317\342>,\004!\323\335\006\224\0208x\222\272W\033\350Z\363[D\346\362\321X\221b\241\022\033\314\203\004\353\230\021Q\017\326\334"
+	.ascii	"\037%t\211\006|^n\234{[K\365"
+	.text
+	.section	.gnu.lto_tcpDataOut.32.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"}\n"
+	.string	"\246\323HA0\247*\035P\254\303aq\225?v[U\324}-\335\355\305\343\346\340-\356\240+\263\302\242\2353B[\303X\202g\037\001\024\003\b\021\241\006\003\003\344A\\\361JG0\220\016:Q\004\021\262\367N)6"
+	.string	"5"
+	.string	"6"
+	.string	"\373\227\213c"
+	.string	"lw\353,yx:e\350'\210\242\323-\344\223:\210\020@\240 \222\350e\001\n\311]\227\035bI\312Jfw-M\"\310\235\335\366\204\355\b\373[o\375TJ_\013}\300\036H\274v=b\0216Av\340\304b\373\322\376\352\254\360\255\320\027vQ+\003\273\343\203\353\366\314\343\031\264g\333/\3323\207\266\203\217\252R\201\200\002\f\346L\331\006i\237\025\001\032\224$\004\333\032\007"
+	.string	"\202\360S>\033\333\356\336\344\231\037\322\236}\216\234T'Vk$c\366(\2223e\237\356\356z\242\354\035\267\321x\300\215\267\231\303t8\017\305\205\306\373:\260\202_\367\361>\213\272\3614\030\225\373\300\212i0\247\323}\325\303\341|\3252\3563\243I\242\025I\247\rf\310\233L\247(\020"
+	.ascii	"2\003\3020\304\204\275\032\310\r{\tm\365\t\231\347\020@+\304"
+	.ascii	"\237\t_`\312%\330f5E\334\345\246\332\243\201\251="
+	.text
+	.section	.gnu.lto_tcpDataIn.33.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\271\003\r\031"
+	.string	"\006.\240H\260XQ:\360\n\t\206\024\034\033\333\005(g)1l\267-\357\204\316\261\020\007\277\213:jx\\\203\305:\360\022\337\214\212\206\323o:\311\317\302\343O\341-\310\266\341\362\276|P\013\223\272\2323\344m#\204\354-eJ\001\207"
+	.string	"\201"
+	.string	"\224"
+	.string	"Jl\256\366{\334G\355\273\023\0270\347\020\217\2459y4v\205\227\346\275\365]\206\207\371.]\263\247\234G4\237$\005\005R\2269\247kk\030\354\365z\275G\336\235\322\332\303\024(\343j\315W\245%\267\334\316\303\b\372\250\300\361&+\\D\233(*LG\272\342r6M}@/\016\006]\252rA\217\254\234O\234\231s\256r=\272Gz\204'Y\252\314"
+	.string	"zq\005!\3149\255\267\034\320\255\272m!\333\017\354]\n=\273c\037\b\t\205\272\331\262+y\b\347\234\f\2222\2008@t\343\304w\371U\355\260\334Z\360h\317\346\355\350\352\354\333\020EQ\361\016\3312?\272[?\372c\316\373a\276\373\003\260^\316\273W?\272U\237:\365\251\303O\r\206\352O\252%\250\216\237z\245Z\243\372\005\006\264`\342\340\311\234*z[\346\223d\312a\373+\333[t\243\332\217\334\344\324\2343\246,\3159i\334 \274\234\211\3123\021I"
+	.string	"\320\350\262\343\n\317\235H)R\212\253sj\303\235\031-\351\321(\333\024~\344\265\300\bMj\027\330\370_\037\270\341\306\246\037!\233\323\213@\021"
+	.string	"\340J#.Zv\337\372Dt*\030\200\232S\206\b\244\233\225\2423m\260\020\372&\276\313o\277&\034\214\270\272rW\310n\334\243\350r\341K/\004PC\016@\355\"\200\2623\206\013\021\021Cdkx\220\233\027\335\030\033;\005\177Y\231=\222\037N?:l\233\344\344\223\333\325\331f\351\327\216q\320\337<\023\261\0222Z\354"
+	.ascii	"\323\030\f\347F\207\206#\013\r\253\t\001\323\321\360\341F6\213"
+	.ascii	"\321\\\264Yl\204l\266\301\205#\273\001\341\202\315h\256\232\031"
+	.ascii	"\347\204\210\315\\:993\327\2127\277C\023\202\236x\326&\341HW"
+	.ascii	"1\261x\352\331\235Pc\326\240jY\213\263\302\254#\270\332\227\305"
+	.ascii	"%8kgFQj\316\332\326\376G\310\026\347\2343\265:\253l\355c\364"
+	.ascii	"R\304\326\252\026\247RfwG\017G\224\331\325\342\354\203\3416a"
+	.ascii	"r\240\037XnV\344\352\374\372\224\274\b\004I\250\021\360\224B"
+	.ascii	"P)\"\023\020\005\022\314h\332b\220\002\031\252\353\006\021`A"
+	.ascii	"c\205Ar\3372*\036\326\201\216\0201y'\205\205U-/\266d\354\033"
+	.ascii	"\267\006Q\264\327\235\344p\255\301\265\225\324G\\<\351\251V\242"
+	.ascii	"\366!\222\243\222)\203\324\005\277\205\030\231\276\3240\353!"
+	.ascii	"\033S\\\344\321t>\214\376=\320,\340;\265j\210[\207\357\024_\325"
+	.ascii	"`\2216\211\351\307\222\225/`\214\257\233A,\244\035\360-\240?"
+	.ascii	"=ZI8\365\351\034\360j\360A7x\321\317\365d%\207\374\233\316\024"
+	.ascii	"SH\323"
+	.text
+	.section	.gnu.lto_tcpDataOut.part.0.48.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`*\0055\035"
+	.string	"\226\262\260I\260\226Q:4L8N\372\3129O\211t\333\300$\271\302\313\2308!\275\2371\016\264;\236\324\021#\206c_Z\226S\233\rX\336B\2756\254\315\364\377`\013\327)\376!\302\016\375*\253!\0077\033:>!d\023\271S\n\223"
+	.string	"\216"
+	.string	"\241"
+	.ascii	"\357\341,\036\244_eB\240\303\210\317\347\324\013\310S\236\360"
+	.ascii	"\3459\3773z\224n\366\253)\226<\247}\035\207\332=J\367\233Z\233"
+	.ascii	"|W\265\376\016\234\232F\236\372w\035\361\224\274L<\265\237\303"
+	.ascii	"\266\321\222w\366\225"
+	.string	"\377\236\352}D)\365\b\326Zi\247\033\343\273\217\"\rw\222;\277\304\307\021\250\326:\303\304\342\342\212\323$\0233\234=&\025\337\260@\026\254/1&\244P\007\305\214\336\253>O0\361\346\30499\002\325Z\375\243\026\267\353\266G\330v`S[\247s_\365\002>&\275\025G\263\314\\'/\371\260n\223\035N\347\214\3232:\215#N\337\320i\233O\3355\341t,\234\206\205\3234\343\364\213N\317\210\323.:M\336\352\036\303i1\234\246\341t\030N\357N\317\377\376\357\310\030\370jEQfL}A\211\320\370\217\177\352\267\372\332\367\203\034\210/\304/+\006\276\240/\370\035\367w\030\371>^\345\327\017*\335\364\241\322\205\265\305\257\246\200\340\243\362\005k\3755 O\247\214\274\344K\235\307.3\373Z;\202\204$O\270\023\020\344ki\264\\K\356\314R%I7x\256\235EQ\"sD\341L\212\022"
+	.string	"\227\224?@ra6\266p@\211;\356\255(\221\t\227\256\2704+\251\006\257\302\223\324v\236\220\224"
+	.string	"\236\350^\310{\244\246\204\331\377IL\226\253]'\207\273\213A*\t\322\024c\333\302\217\324z\200F\312\001\300p{\264\354\013/R\313\261\203\236U\302v)OJ\030(\330\234kk\270\315\367\314\203\264%\354\023\0211\201\265\326\367l\016\307\362 \340\251\326\252\340\212\304\220/\343\324\327\211\001\271s\020*\332PR[)\024D\224\023\272\221.\177>\224D\265\016A7\234-G\313\341l!n\270\f4\241[\220\007Z\211\313\321~x<\364\301\206\243\021\r\r\341h\257\207u\233\ft\264\274\361\301m\016\301j\222\263\301Z\fL\271Y\275-^j\004\200]\312\035`\316\272l`\301!\316f\315\342\254L\213\354fm\026\347\006\357fgJ\260\024%\270R\376\330,\f\306\025\352\363\232\235\271\340\"E%\2665{+\330\322llC/[5Z\225\322"
+	.string	"liZ\265"
+	.string	"\300R\207\246\207g%\fT\270N\256\211Q\240\224\260\361\311V\260\313l\216\033h\250q4D\241B%\024FJR\222\244\003\200\002\231\231\243\333\022`\325\031J;\247D\242\253\373\177\006\364\244\207\n\362\300\264>-\231\303ij\274\013%\033\271\350|2\235<\260\264\231\241\312B\2000\324\316\235/\0258}\n4{\"\305V?+\332\305\254g7\347\245\203\260\351=<\bwA\n\205\033n\3463\266\036\033.5\220\340\343\307\274\037\220\325m\207j=\277\375\357\025"
+	.ascii	"\030c\205\350i\0263\347\363\205\203;\374\261\224\237d\224\341"
+	.ascii	"\347\206\235\003\322K2u\324*\200\216E\372\357\366)\356\214h\236"
+	.ascii	"\303\b\033\377\2407\366\215\317\b\200\2672J\001\310=\002\222"
+	.ascii	"\t\262;\034~n\274\215,\254\255\304<`s!\025EG\0047MDk+\263\267"
+	.ascii	"\006\213\004R\275\273\351\006\205.M\243S\006\304i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\236\003\305\017"
+	.string	"\266W\\E\020s\223\016\200\307\326\007s\204\200N\210\313\322\321\301\201\340`\246\214\354\235\f>\257\3043\033\001\255\252\252J\273\252\262\231\231\216\356\356\302\212\032\217\231\031\376\272\177#\303Gkk\213\210\032\013\227\032\241M\033%)eJ"
+	.string	"N"
+	.string	"G"
+	.string	"\360B\006-4\312\251B\177Vd\327\265\210yi\027\n\275\231\2324\241U\270S\335\220\320)-\r\342R\2138\302\t\274\352N\031\b\332)\346A\217P8\020"
+	.string	"U\365\222]\247\202QmU\035\247\035\221RJ\226\016\261\252\216\300\b\374\365\226g\206\254f\214\370;wm\260\210\341\003\205\037Q\232\376D70\321\013J4\003\022\235`D+\020\321\003B4\013\210n\371\320\005<\264\001\256\017th\004+OR\265T\204C\023XS\252\305\332\320\001T\032\272\304\031z\2051x\0023\005\036\003\301o>\r>\242T\340\257\t\037\232\332\267*\244\306\216 \032?C\235\360;\336\207\337\231 >\307\333\255\341A\203&\304\337x\032?~\353\202\203\210\n\021\273x!\003\310\210\177}\032\377\232\373\322C\006F\024\212ykJ\265X\244\354\334\226=\322\230x<\3476\317S,\257\274\034?0\023\256Y\255\230a"
+	.string	"\347\266\271\233j\261T%\354\234\217\204=\2426\233oI\311\243GB\362\353#\305s[\374v\331\365\216\367}\3409\001J\250Q \303RJ\024\244Me7"
+	.ascii	"\003)\242\352\021`\024\322)\205\242\242\330\221y\032{\232\004"
+	.ascii	"\005]\277a\225\221\004\202\237\252\212\033\373k\364HZD\327\233"
+	.ascii	"\315\367\r\376J\352\365\343\231\317\024\205\204\370\363\373F"
+	.ascii	"q\260\267u\245\035T\212\3408KS\236\3038i\365\201?T\322%QYo<\275"
+	.ascii	"\356 -\310Y\232GuU\277C\036,%\300\213\030\361\013t\331\316@\302"
+	.ascii	"\036\247!\3038f\203\nF,\244\006"
+	.text
+	.section	.gnu.lto_.refs.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375 _5\002"
+	.string	"\262\205\017\024p\265\352\374\377\177\350\245u\374E4;\216=\367\267[\312\024\243\246\n=e]e\263\372\021\035:\311\212\267;\300\364\202\177x!\013\370\001~+\3758n\020\316\370\211\177w\321\212\317\177\020\001"
+	.ascii	"\r\212\022"
+	.text
+	.section	.gnu.lto_.decls.b09f0db5d2a313df,"e",@progbits
+	.string	"(\265/\375`\370?\365\021\001J\327\325eW \fY9\351\017\"\327\037\364\340\302C\232e\345\243f\201\244\r\b9g\215\264B\205tY\036\302\017\345\260\264\374\330\256\321\177\302 \347\225\2763\302T\337l\023p`\232\301\220\343\220\276D\0026\273\310\300(\325\264\277\305g\027\232\246\337\306ux?\262m\t\331D\356\024\207\005X\006l\006\271\357\257\026\276\230\023\214^,\374\264\036\362N\376\r\244\2034\326M\373\261\345\330\267\211t\021\253\314\240\215\254@>rO\344\336\372\376\002\301\267\031\240v\316f\200\266\220\241\367\020 -[\311\037}w\346H\341{Y\255\020\272\343f\203P\236\034\370\267\006\276@\314\006\241\2772\360\005i6\b\355\036\032\200|"
+	.ascii	")\236\351{3\016\313\261t\3145Y\002\322\214\345\216\226j\036V"
+	.ascii	"\331Q\357([\247\235B(\035G \311XF\265\216\203\321!5\211Q\342"
+	.ascii	"\226s\346\240\201\003\207[%\310Y\017|oN\301\357%\243\006\233"
+	.ascii	"\026\304\002H\300f<i'\013\327J\030 \031O0\013"
+	.string	"[\302\310\222\001\245c0m\260i^#\210e\265S79Y\333\251_h\370)\256\371\370\341\n\332\226[\316\371\177\343\350\034\375\3247\272F\333h\250\246a\225\355\324G\016\0348d8\253Pq{\263\340\276\343\360[\016~\267\301o4\370\035\006?\315\n\241\357.\370\235\005\277\225\330\003+\204\266\013\242\2332M}\337I\360\377.6\222Uv\222\225\273\305b\337\302l\\\347\037\342\205\234}\254%\207:\251\211\235m\032\324\232\237\354\2156Z\336\270\345\274f\340\300\301\314\262\006\016\025\364\336\276\301\177\3479\0369\255(\2719+\267\205\305\344\243\357-\032\276\335\202o\303\260\315V\b\275\245\202\177\353vK\347\267m\026\216\365\"\001\206\363\353\305\227\245\276v\316\320\255[\020z\204Z\263W\316\031\310t\021\204\351\251/\0076\b\275\335\302\267Mp\257V\b\335`\203P\f\331\006\241v\331\326\215e\273]\3326\377"
+	.string	"\342=I9+\347\325.o\316Ek7\370\261v\203\263\254H\261\013\275\267G\360-\020lW\260j\254\222\003\273\346V\005\213\346gq\315k\316+P\017\211\373\352\352{+\205o9@\315\2719\313\001z\373\204\333\006\241\026\254\020\212!i\206\003\234\264\005,\253\357o\325\312\330)Y_\202\364\265d2\350\260d8\255\276\267Kx\210\313\327\276\2269\257\\Wl\330V\330o\277X4;\306\236\33106\315\202\261J+\346\267]\254\227gXsN\302\262\305\222\211]i\300?T\366\262\237]\316T^\311\006\374v\353\267R\354j\305X\263\227\375$Y\310IF\262,s\316\\S\354\027\006HF\f \301\262\314y\275\315\372-\02616\213%3\327#9\373\bb\001\0317Vp\270\345\274r\340\220\201\003\007\016\0348X13\234l\261p?\002l\256V\b\ra\203\320\207"
+	.string	"\237\004\376\t\370\267dcg\r\25032?=\216+\300\365\375o\225V\314jYs\206^\231\254\f\351{\013\340?"
+	.string	"[\b\003\003\212R\343\007\2215+\347\f\264\033{[b\243\357A\340[\245\375\262^$0\331\261\246\257\255b\255\334zY*\377"
+	.string	"\342&qJ\316\3129[\257\017\2209\027\255\027\020\\\316E k7\260v\203\013\245\n\353\nz\357\001\276\355zP\231\f\342:\374\306\032\330 T\003+\204^\033\204z`\203\320\337j\3756\212\315\372\232idBf\257\234\327\013M\344jr\326\367\253\025B\261\rB/(\300g\002\213\217\331\023l\321\t\001D)Z\034\003[|\206\377\024\301\337Gs\003\261x\374\237\006\370\373hnHU\370X\274D\233\360"
+	.string	"\374\347\210\f\374\026\230\342\034t\006\230~\301\177jPa\302\335\b\245*X\030/\330\236%21\007\277ma\213\235\201V\272\005\377\351\363\333\337oQ\374\226\367\333\023\277\r\376\326\367\333\023\3746\305\321o=\3746\375m\357\267*~[\364[\242\337\002\377\246\200Ea\005\277-\301\337+0\023@e\"\3407\017`\2136\004\251+\340?'\360\233\0060\013`\345?\230\271\301\bV\374mfj\360\333\024P`[\020\340o\"s"
+	.string	"f\006\177/\377Vab\360[\026\277%@\273\231\002\260k]<\007\377\307H\260\351l\201\377\264b<3"
+	.string	"\177\307\231\032\376.33\3746\005\323\232\030\376\233\335\315\005\177\013?\306\200\377j\375\275\376\246\320o\301L"
+	.ascii	"\374\315\302\004(\370m\nV\005D\313\346n\022p\r\377]\341o\"f\320"
+	.ascii	"\377\263\377h\377\307\374'S\242\314{\376\273\366wR\333\270\377"
+	.ascii	"\271\200\277\037\360\267\003\376\206\300\337!\376\376\360\367"
+	.ascii	"\007\177\203\370{\350\357\b\374-\201\277\033\360\367\004\376"
+	.ascii	"\246\200\207\277\225\024\200\200\277u\032\374\035\200\277\205"
+	.ascii	"\376\346\371\333\376\366\355?\006\377\231\201\337\264\3407{~"
+	.ascii	"s\367\233\375\267\334\337t\376f\373\273\314\337g\177w\371{\354"
+	.ascii	"o\257\277\271\376.\3627\220\277\235\376\266\372\273\352o\251"
+	.ascii	"\277m\374\375\3647\323\3370\3766\376\255\364w\322\337\305\277"
+	.ascii	"\363\337,\376\256\300o\227\377\335\374_\363[6\277%\376'\363\333"
+	.ascii	"\016\277%\361[\020\374\326\204\337\206\360\367\212\277\325\277"
+	.ascii	"\205\177\253\370\233\350o\336\337#\370\017\366\267\007\376\346"
+	.ascii	"\300\337\031\370-\330\337\030\370\333\204\277K\370?\366\277\304"
+	.ascii	"\177\257\377E\177\217\360\267\b\177\207\360\367\005\376\266\300"
+	.ascii	"oO\370-\234\337\266\375\366\315\177\022\277e\373\355\332o]\374"
+	.ascii	"6\351\267H\277-\376W\373_\346\177\326\377\021\377\277\374\267"
+	.ascii	"0777\367\353\202\374\030\310\357A\216\367\307\265\372\200&)\343"
+	.ascii	"\372\370\265j\254\032gS~\204\301\347\001\303\377\235\272HL\247"
+	.ascii	"\254\006\235\333\343\027i\227>b7\204d\271R=+1\267\271R7j\367"
+	.ascii	"\206\315\232\244\037\244\035I X;t\370d\221B\002$\307\257\016"
+	.ascii	"\242\2130q}/\224I\007h\215\214d\2166\323=y\021s\002r\303\006"
+	.ascii	"\017\227\023\323X\215_\033W\211\314\020.}/\215\035*]0\346\372"
+	.ascii	"\336\031\367\251\215\206\033\344\223S\217\216!r\316\216\277N"
+	.ascii	"\035\225c$\365\275M_\273z\"\266\365}\234+%\t\324\017\236\032"
+	.ascii	"\370\277L1|\3244\305y\203\361\033\343\247\n\314M\262\357}\201"
+	.ascii	"\206\311l\252\357M\272F:5b\2001.\231H\222\240\\(\375.\351\226"
+	.ascii	"[\276\262\372^\027:-b\320\330\364}\234\366\372\277C\3054\301"
+	.ascii	"\325\341Q\302\377-^\242\216\315\017\245\256\233\177\211@j\326"
+	.ascii	"\250\222\3645\347\316-\251b_S\356n\342\310!\335\372>\316\313"
+	.ascii	"\376\357\256\215\261(a\372~'\016\377&\234\371\266c\325\006L\322"
+	.ascii	"\254s\363m\347\307\016bV\337\3071\351\374\337\355\322\344\310"
+	.ascii	"\361\242\343f6\343\313\020\266\253\003\214\313\331\234\026\323"
+	.ascii	"#e\245C\205\276\337y\203\1773NcA\265\350\310\311\201\263\201"
+	.ascii	"\016\032$'m\366\313gG\025*6o\330~\246D\211\272\262\274\311F\202"
+	.ascii	"\234\275L$_Jq}M7C7\227\003\300R6\326W\327\306\\\363A\"\026u\254"
+	.ascii	"\261\361\301\221\006\227\244\357\232\035\2472\313.}\277\263\206"
+	.ascii	"\237p\230:\252\262\226`\274\314+YeMr\tT\024\030\311#f\022\035"
+	.ascii	"\313\365m\007\017\263G\224)t\222f\232\251\344e6\315\213\004\265"
+	.ascii	"\034K\023\213\271\202\311\305\004c\236\231jL5\263\213if"
+	.ascii	"\212\231^L1\346\031\223\214\251\202\371\305\334b\2421\307\314"
+	.ascii	"0f\026\023\3154c\2161\313\230d\246\026\263\314Lc\225f\232Y\343"
+	.ascii	"\246\025\323\213\213\253\316\322\312L3\26180W1\f\243+J\313~\031"
+	.ascii	"\315\030N_\333\352#Lf,\245\300"
+	.string	"=\3210o iY\3750\257l\032\224\205\234\324u\225\264h\214dP\223Z\346\234\315\035H\323G\b\245\343n\251\352\311\020\2256f\f&\363\330%\245\211\t\245\213\251\313~\271%\263\354\227R\325\013S\310oZ\375\037@\230i\346\020\263\210\271&uU\220z(\355\227\233(f\232\271e\277\342\314%3\315\3742\303l\032T\316N\032<\271J\202\346\226s>\315\020\251\263E\002\3677\301n\206\375\246\321|a\275~\320\254\274\314\350k^\031\272\t\366 \036\260/qX}\203\210`\237\325\n\241\326\314\006\241\337\261\302\337\201\302\337\211\201\277\213\303\337\265\301\337\245\341\357\310\360wT\360wO\360wC\360w;\360w3\240<\301E,\\\306<1\235\360HA\202r\352\373\035\022>\256\203\217\333\360\361\032|\254\206\221<\314\2175.\372\036\177\301\307Z\360\2276\b=\356\302\307J\360o\022\271Y\304z\221"
+	.string	"\003\213$\244\271\276CC7\211<\310Jy\343\362\322\367X\b\316`\205\256\202X\262$fW\312\2671\201\374\177\217"
+	.string	"|\2247nt\365=\356\201\217s`\233m\020jN\231TVy0f\325\32100(I}\217\233\360\n\362\301\240\307K\3707{H\001\311\031sf\2252\243tf\226X`\364\275\356\r_\367\006\333\243\0163\207\tC\306\r\025\314\034&\224\026\251\262.}\2573\203\257;\303\277y\303\264\021&\205\006\206i\303\254\001D$\r\315I\337\353\304\360uS\260E.\301\246\fs\206U\376\213\331\364\025\350\207l\351\353K\337\353\214\340\333\177AW`\377\005\275\016\b\266I\335\024\266H+\204\002\300\006\241v5\2252"
+	.string	"Zo\310\360\341b\031\245K\225W\222%\323\331P\3069\323\3677\221\314\342\217\231\345\2204}M\2429'\211\223\231\276\327\341\300o@\313\265\222~C\334\261\262\234\003\306\r\315o\317\310\3314\226\215M\013b\201,\263\267\236\353\270\256\323t\332\255\3474\\\3131\263U\266\265]\263K\364j9\007\214\333\217\253N\3324\250\254\200\343\0340N\316\310u\234\306\372!\256\271I7\3448\007\214\333\033\033\247\221\305,=%\327T\215\304"
+	.ascii	"\311x\321\260,}X\262\260d\316kW\265\\[q\001;\"\327H:\371C\\3"
+	.ascii	"Qw\225\347\200q\313\260{\303V\244\310\005\367h\033\266QV+\204"
+	.ascii	"bpb\203P\266\323I\222\312\215\276G\321\340(Z\335\025B\351\270"
+	.ascii	"k\352\022\262\\\257H%\267\276z$\355\2262\b\222\035\275\204IC"
+	.ascii	"\231\241V\244c\374Cc\315\305\344:\342+j2\226X\304\232\316:L\b"
+	.ascii	"\245\343\216\006\022\214\216\222\365\265\020J\307\235\222\332"
+	.ascii	"\220\254,\355U\245#\231\363\n\026\305E\246\257\032K\b\245\343"
+	.ascii	".\206\032\217e/\371?\200h2=\246\261\3145\251\263R\205\265\314"
+	.ascii	"y\325\322^&\327\021[\351\312\321j\275\246U\350e\257u\233v\323"
+	.ascii	"g\332L\263i4]\246Wh5\235\326i\254\262\311\264\230\367\221NB\246"
+	.ascii	"\313\332\314\246y\345\342\223\006GV9H\334r^9\374L!\"c-\300=\272"
+	.ascii	"\205\217\036\301\177\207\001\343\305\305F\315z\221\250\240\005"
+	.ascii	"\253\2774\032\272\245\026\004\255\357Q$>\232\243K{\001\232#\003"
+	.ascii	"\016\232\276GgtA_\364\226\036%OMF\372\376|k\262\337)H\037\263"
+	.ascii	"x#\214\226\276?\333\360O5\370g\030\374S\f\377\215\245\303\222"
+	.ascii	"XS\326\322\200z\344\242\250M\365\375\331\205\1772\301?\257pS"
+	.ascii	"\351*V\271\241\255|\227\264fe\316+\320\016M[\224W\337\237H|\273"
+	.ascii	"\001\005\232\233\233\233\263\033\320\23740WOY\257\213-[\202\324"
+	.string	"\341\372\212\226\321\312U\372\376-\345\275\002\025\311B\306G\337\336\262l\346\262\200)\353\3738_\373\277\343\361\"\244JL\337_7\3707\r\177\265Ah?\301aU\\\353\373{\005\337*\333I\223\2358#b\334\336M\336\246'c\340S\346i\205b[\266\234]\254\205\025Im+\351\343\004\245M\252\354g\027\2554*M\372\236\\,\031\017\232\027\034W\326+W\316\261\f8ku\rY\346\f\265a\307\312\021\211\330\317\261,`oR}O-\226,\216mNJ\3373\313\313\2208i:\322\367\004;\261\200i\2221\245\357\255\362\246\235ab\214\324\2611\325\367@H\360TW\327\351e\247\344&[\025di\013h\316K[\222\323\312O\257\262)3Q\320\372\236U,\331\220\2638:}O*6\254'\310\213$f\372\236\312\227\351\276\210\251\352\001D\003\377\377\211u\254\223\313\204\263k\206B\022\331\206\232\254"
+	.string	"\265\341\307\254\206\222\327\222\237\\?\327\017 ^V\265j\301\365=\263\316\255S\312\277;\211\360\200s\321\367@1\360\251\325AT\235)\270\276?\233\004)SdI\337\237P\316(\377\316\307\253)K\214\276\007J\302\247\223\363\311\r\245\031\271\276\377\211\303'\223\263I\221\351J\331\267\355\313\320w\210\013\022F\243\357y\344T\2226\345\346\202g\fK\313\232$'\222s\314G\f3k\274\254Qq}\177&\247\210`=\365=\246\321\2614'\316\325\325Y$\005G\324\340\234\360\2749VY\"\362\263\210W\333\234\250\276\347\220+\307\205\254\261\245\357)\344R\361\221q\244he\r\020 \027\013gh\333\251\352\0223\366\375O\031|\373\304\236V\267\312\323\352J\331\031s\256\361"
+	.ascii	"\247\261\032\013\370\217\031\376O\244U\236\310\263\n\003k&\356"
+	.ascii	"\200q\235U\3779uR\231\305\036$\f\2634;\372\362\200\311V\b\265"
+	.ascii	"QV\033\204\376\347\013\007\216SJ\002Z<p\332\222Zg\324O)\223\316"
+	.ascii	"\0273]\307\276'\217\227\325\t\313\242\352{\356\350.\240+5P\214"
+	.ascii	"}O\035_K\362q\344K\3373G{eI\221\235\365=\241\332\314\276\211"
+	.ascii	"\241y\301\345\377\316\254rufk\253F\215\323\006\006\354\020\266"
+	.ascii	"\037*&?\214\217\363\323\306\356H\222*\246$3\316\247\031\247\023"
+	.ascii	"\232\263]\221M\307\fu\334\320\324t:\331|\314\031j\002V\244,3"
+	.ascii	"\024\324\206\23687\254\214"
+	.string	"}\377\363\370\323I\350\325E\343\312Mq\302\262\325\367?A\360\177n01]\253\003\214!\203\205@\375\220\321\367?3N\030'\214\213\004@\230S\t\233\233\265\276\367\211\203O\343i\274W\0262\322\231\260d\206\202\332\260\303b\362\304\245\357}\310\234J\247\322\275b\333P6\006\265\001\005eo\346\372\336\347\n\276]\3323Iy&\331e\206l\256!\243\006\347$\037\327\005\334\207\013\377g\361,\232l\031\326\374\244\2131\246\006\347\226\217\307\005\334\307\b\256S\347\314P\231\370\206\001K\210s?\363\225C\223h\240Y\322\367\276]\271\2371aii\344\3420\215\270\031h\340L\242I|1\306\b\347\323\003\377\327My\335\3145\323\210,N\205(\313\241\006\211[\316f\013\3309\313AC\256\357}\212X\216\0343g)5\3117\f\007N\0212=m\370\277\313\337\266\377\262\3357\275\246cKH_\273\264B\350"
+	.ascii	"l\020z\335\f\375.\177\236\020\243\214\364\315\240\315]\303\322"
+	.ascii	"\305"
+	.string	"\207U\337\313fU\346\2345\3306Qoe}\3373\006\267\016\260\273\346\256`\225W\315\232\263\362\252\261rn\232\037\342\232\235<\270\322sEjiI\205\3374\312,A\204,\373^4C\277*H`\210\017(}\3152\277g\376\253v\315\354\246\304V,}\255\231\025B\005@f\350\267L[\032\345\223\276\001\270ib\264L\231q\365\375\365r\315~\317~v\305\340\2343\026\233\032\234[\206:n\370o\230_1\246\220'\257-0V`UL\300|\261\242\026\327\303\222i\3034\244\316E\273\235q\304\305\227\276\357Y\202\355o\337?\232\213\307\234\363\323\271\346#R\017\372\333\333\323\332\r\277\2175m\001\376\337\207"
+	.string	"\346\214T%\231s\266pp\022-\305\035\032\344\377\337\2203\321\346\234\217F%\025\361\202QY\314F*iN\027\214J*'\343\232\2470d\245\217l\\\221\304\213$\346\234\211\235\327\234D\345\224\223\220D#\343\232\217yE\022-\344$'\013\306\265H4*\251\234\254Q\211t2*\221N\027rR&\346\244\342\024NB:\031\301 \235,\030\225E'c\022\225\223]\221\331\222\331\262R\021\225\262\262\350\223sfZ\223\304\236\234\213\307L,\32322\325RF\226\3126\355\311\352#\347L\364JS\205\334\255H9\315\250\004\211B)\3474Y\306\007DK\\s\316K\031\211hsVZ\2179#!I"
+	.string	"\225s\316Hkf\351\230}rR\221\t\251\n\331\243\204\204\\\312J\246l\3169;\031\225U\310\241\261*\312dFZ\211\326\310\204\314\311\234\206\352\210\225D\333\346\243\034\002\305\264\345\267\313\177\271\334\262\2362E!B\372Z/+\204j \033\372\335\322\263\345i\212\227\276\031\262\374\216\375W\313\025C\265D\311\242\321\267\217V\b-\200\rB/\226\241\337,\247\0325mj}7\270a\310\037oZH}\357\227\271\202\271\271\2719\270\234\213\367\253/\330\275\362\373u ]\032'\306\"z\377\353\3657M\204"
+	.string	"\361b\245J\324\372\245\245/O\336\362\nC\005\253\325\3020!)\311\272\272\313\331\205\006\2458\245\271\350P\341\221\204k}2u\346\314*E)\254\013S\337\325'\t\007.G\337K\344&\303"
+	.string	"\271B` \245\251\272?$\240\205\224\203\304\315\214\273\305\270\344\021\023\216\2121\211t\231\336L9&\\\b\245\343n\ti\356B\271Nn\224\373\344&\271K.\223\213\344f]\255\253\344nY\345m\322h\\<\356\224\233\345\026\216\273C\312Q\016\022\267!W\b\225\006Q\226r\220\270\311\2707*\200\224\203\304\311mr\251\256\021\003$c.Ny\240%\206]\024\255d\005\340\276g\007\376o\022\353'\216T\223\037F~\261\360\0317\270\027}o\221\036\302\005G\222\306:\253\344\260\321\322\367=M\370<u\204\\\355@\305\031\t\023\344\367\252\275z\254\324\210T\361\244\301\177\251\372\023\246\220\302\027,J\341\013\026\001\217"
+	.string	"\220\016\203E\276\035\365(\230\252\370\225\340\001\177j\321\357\310\004\217\0074T\217\214N\234G\321\001\203\372\003\376x\026\034E\007u\b\f\372\316\023\275\264\350\246\020\024\242P\203@\0350\370S{\276`\021/\b\024\nS\036\317B\n)\360\247E\257(\035!\270\0015\035\002\371\b\323\023\210\210z\026X\220"
+	.string	"L\325\341\257\310\247\250\350\b\b\f\002ujO\2050x\002=\241\002\177B\243\023:\240\210\235\221O\305F>u7$a\344S\177\200\251\321\b#_\ta:\334\031\2120\362\251;;\036tP\205=\243\016\352\321\210\236\332\033\301\310\247^ \352\351\214|%\206\277\fi*,\241D\3200U[\204`\344S/P\205=\225\204\221O\305D\251\t~E\275\237\372\003\212\260 \025\036\241\360;\001\f\372\322\016\030\371\324\237\243\350\020\374\021\251C!\2410%R\207hO\355\215"
+	.string	"\f\242\3510X$\0020\250SyBU\355\005\335\247\032\245>\337\005\200A|\337O\230\002S\024\360?"
+	.string	"\241\003\020B\260\320\021\001S\036\024\200?\365\327\003\001\213\016"
+	.string	" M\205%\260(Q\324S\203%\210z;$.\264P\215T\220\240\376T\f\201=a\t\022\303\237"
+	.string	"\322\241\316\204\b\251\332SI\244\300\337\tEBU\0045\035Z`B\204\020\324t\350s\342(\004\234\252?!\b\200?\024R\023\367(:\220p\202\210\022\034\360\201(\035\036\001\217x\030\025\252F\351\260g\342G\250\032\371\250?a\n=D\300\224w\342\310D:\354\231\360I\207=\023<\243\243\024\276\236\t\336\b\021< \"`\312KW\364\206\274\021\"x=Ca\232B\330S\301\303\300_\017\205\217\207\006\201i\321\357\004O\367a\210B\257\350\004O\247\362tDEA\036\017P\305QQ\320\307\023\036\371x<i\221\211\236\272\202\367s\342\310\204*\f\242\030\362v*o\204\b\336\316\251\362>"
+	.ascii	"\341\304\211 \217\267S\323\341\211\023A\236n\204\b\036\217\272"
+	.ascii	"\302\227\022\005}<<B\004\317'%\372\245\300\333!\341\004\021%"
+	.ascii	"\360F\210\340au\370+\3629qd\2027L\205i*<\301\353Qy\251\t~C\024"
+	.ascii	"\004Q\317\210\307CS\242\240\n\336\251\362Ta\220\003F>uw\024\032"
+	.ascii	"\020\375Z=\212\016\030\b\323\337\211\237\nL\211~;C^\317\007T"
+	.ascii	"a\220\003\026\322\"\023\275\022+\320\224\227\022\0055\240\n\203"
+	.ascii	"F;)QP\305My#Ta\320\310g\b\f\376T\243\240.U{\035 :\352\231\300"
+	.ascii	"\251\t~$\324\242_\257D\017Q/\305\200\312\373\320\200\242_\257"
+	.ascii	"D\317\212_\352K;\220a\247\247\366F`!\374\021\252\034\020!\224"
+	.ascii	"\302\3273QT\324\023!-\"\372\365\250\302\240\321\025b\225\027"
+	.ascii	"B\005\376\216t\302\364\304\211\243\020X\250x\2050\035^ 0\350"
+	.ascii	"\273*\252\002\001Q\370\025\365x<\335QtP}GBu\370a\310c\221\252"
+	.ascii	"G*.\244\360\005\213x<T\005\036\005}<\236N\230\002S\b\362x\272"
+	.ascii	"\2410\035\036\001y<L\004\374\245\340\361\320!\360g4\344\361t"
+	.ascii	"\300\340o\370+Jy\274\235\312S\207\277\"\013G\321a\230\032\265"
+	.ascii	"P; J\205=\024\303\016<\f\325\237\t\017G@\024:`q\004\374\025u"
+	.ascii	"\360\001\b<\020B\260\360\220\022\035\025\371\200?\017\302\341"
+	.ascii	"\221\207\007\250,R`Q\017(LU\340\217G\324K\205(T#\036\017\303"
+	.ascii	"\212Th\304\343\241\352\360W\304\343\241=\265G\304\343\241\251"
+	.ascii	"\t~C\036\017M\341\013\236\300B\210\026\005\203!\360N\242T\365"
+	.ascii	"\245@`\320\267Sy \f\251\300\337\021V\201GA\021T`\372+\362\361"
+	.ascii	"\250\300t\005\t;G\321\201\250\327\202\310\003Q\257\205\211_\221"
+	.ascii	"\207\016\030\0364J\205\036\324`P\350\201'5\301oxS\243\026\352"
+	.ascii	"\355\251=\242\243s\210\252\350\245B\225\004\217\250\327\202\210"
+	.ascii	"'U\203*R!\212\302P\205)\354\241\360\335\017\r\211\240\201\007"
+	.ascii	"6`\002\366u0\362\251\274\242\336O\230\016=\f\205\351\212\237"
+	.ascii	"\220\310\003\360\327S\341\301'\034z\350@\200\236\332#\272\377"
+	.ascii	"Q!\350\223\032\264\244\333\225\023\320\032\234\244%A\320\027"
+	.ascii	":&\030\312&@\262\217\227\265$ ?\2520V\230+6\254:\371#\206\305"
+	.ascii	"V\303\307\035\273]\350\354\230Ru\273 \221=T@\251\274\262\275"
+	.ascii	"\232\322C\016\235:\243cfI\022\344=\343\302\315\034\224\025"
+	.ascii	"J\00596T\352,\243\246\r\f\t\215:\331|l\260\341\"\006\345q\322"
+	.ascii	"\331\301B\243\313\022\272\343\034k\002\243\315\021T\307)\227"
+	.ascii	"\225\b\321\222\343\354\202\022\251\310\270@\241E%%ml\340\270"
+	.ascii	"mFp\264\324\3340\303\322\350P\002\007\265\301\245$\354\315I\215"
+	.ascii	"\263\210\007\256)&}\321\031\350\f\364\t\n\256\263u\224C\235\216"
+	.ascii	">\355\336\250\020\273\364E\217\226\f\203[\031\267\276h\323\205"
+	.ascii	"(4\306Q&4\006\372\002\207\220*'N\212|Y!\352\002\f4\351\250\013"
+	.ascii	"4\t}q\004J\307\211\002\243\n\252t\364\305Q#\320\031W\214\035"
+	.ascii	"}\217.\255\035\3518\261\211\203f4\243\305'I\033\007\306\351\210"
+	.ascii	"\022\217\026\337\226p\330\310v\222\326\210]\365\275\0055oo\247"
+	.ascii	"\\\227V\2171\t\b\223\270\237rY\306\234\300\372\236p\226l'f\226"
+	.ascii	"\201\2145a\372\202\245\357-\240\265\375pN:\267\2303\222\007+"
+	.ascii	"R\232\234\2416\330\033R1\324\314\371I\347\247\333\007\020/s{"
+	.ascii	"Q\305\243\357\337_a\342h\365=\345\240J\306\310\334\342\374\337"
+	.ascii	"\021\025\267X}\355m\316\210HK\372\336"
+	.string	"\302\025|\013J3?\321\2309\331n&e)\036:\032hUN\334\262\021j\003\020\332\217\260\2716?\331~.?\200x\231\365B\234q\245\357O7;I\254\224M\372\276\203\377;<\345\206\223S\337S\315\271\006\304\343\fn\307\032\033 )\253\031k\272G>\273\344\260\251\255y\234s\205(R\311\265\025\3164E2ZO.\033\r:)Q1r\337\253p\r>h\330\250\254\351{\236\261\220\343\313O2_\3162vJn\322]\241Q\335p\313F\036\033z\320@\371:R\206\313\017\243\2260}\3171?\323\376]\217\271\351\250\322\367@q\370\f\363S\314\277\333=-a\271\341\377\004\363\357\314\246*\027b}\017\264\304\007\032cfv\236y`\363\222\225.)S\213\225\031\2153K\246\306\312Y\231\204i\250\243\001TrX4\244(\b\346\220B\006\031\232)\332t\023\026@0@H.\226)\273\254\017\023"
+	.string	"\005L\213D\271\256U\214!\231\021\021\021)(IQ\222a\fVF\243\003G_\256\205w\n<\363\340\020\243\261\201\324+N\022Eb\037\253,g`\363-d\231\311\030\257\tC\215[{\330\374G#\2150J\327\321\360\371\245W\345\rWXbd\035P\243\340;*\365\252\354\003j\317\321x\357\334Uk\\\306\206^.{\017\322X\350\374:\2675\360\033\220\326,%\316d\256h.\274\370N\272\0166I\263\250\367q\036\317)\306\257\023\234\255\f\3476n1a K+\340\261T\242\262\004\356]\\O\306\205\005dk*d\314M\013\336K\301|\177\204\350\314<4\3327\252\334y\3011o)\225\266\033\200`y7\"\336\032\216\345.{a\213\001\377V/\272\2448\025\362\246xB\237h\323\034\331\336\264\020\231\"\353\3442\005\360\341=\035\353a~D\3704\371\023\343}g \371\321\373\263\274\032"
+	.string	"i\223\353\230\"R?\212Z\254\256\f\375\0064TWN\223C \272\200br)\232X+C\364H\362YP\276\002\315\353\331F\314\243\255\256y\275\266K\263\205o\337V\220%\255 sm\231\304\017\361\374\033_\311\201\266|\202\217\277h\337\230z\261T\202\246\\\2520&\345pI\317\016<\362/xo\262\266n\221\t\3679\376\347\t\245\016\020n\341\016,$.[o\2158\245\347\362\317\027o\3335\313L\034\301\373\206\034\304\236Sp\nTg\205H\036\355\300\264\002/)\266\\`\323\035\2028\233R!\034`U:`c.\271B\234\202\317t8\237*\351C"
+	.string	"\2562\260\021vo\245\013\245e8\344\265R\341\322\026\360\004t\201\213\362j\362\022-\231\374\004\377\364]J\177\206\352d7H\370\347\013\206/\215p&\227qq\265O\263\257\027\333\340G\335\230C\277\253[%/\212\035\374\231\262\033t\221r\\\261\323\3444\267\217\261H\342"
+	.string	"P\315\227\354s\201e\321j\371\317\230*A"
+	.string	"\016\266\"\272\017\305#5\372\263h`\325`\221+\301\350\016V\033n\243\355 \200P\222\313`\030\344\0357\007\374\021\375\313\234\204\220\"E\bo&\006\003\372U\r\016\004\267S"
+	.string	"\244\334L\202\213\315,b\0370\344*+\005\363\177\302Rl\227\255\244\325\244J}\211,\311N\243\030\370\004\332\204\365sO7\024\227\242b\340^\226yN\006~\311D\331\316\234\031\332;\264.\270\201GaH\341\226gI\375\224\274w\203\302\307\304r\224\216\255=\006S\024L&0\351\""
+	.string	"\203&nxp\261y\261\021\266\371-\217\354\341\327\231\020=h\323\312\333L\256\b\271\302\240)\233\303\3339;\326$\2709\026\322\330`V\207z\250\237\325\214\374+\310F\271\266\205uI\374\355q\354\250\212\214a\350i-*\276|\034t\200\365d\264\231n3f\202\376\224D\203\362\032\363\037\266\322\262|-20\226\332V|\312T\375c-\254\240v\377D\335\331,\301\037"
+	.string	"\376k%\330\213\373\025^\263\242\201\327\267ezd\214\230\n\037?\214R\262\320P\031\202\275_c\324K\340\251\261tA\211\037\263W\016v[aw\001\213\265\"B\bp\274\214>\356T\243\210I4\255\324\223q\205`\223\3563\240\320\323\236Bw\262"
+	.ascii	"\347\310rS\203\236\\+G\237D\016\346\036\342\367\\tM\007^-;<a"
+	.ascii	"P\216\364Z\362<C\r\275\262m}C\327\322avI\255Q\257\344\006\322"
+	.ascii	"\220\314\315\376/\311l\332\264\264\261\212\"\f"
+	.string	";?\251\333\304|\002\357\352VR\364]\301\017K\007\235\330L\245\334\314\002/F\203v\252\317;7\300\247\267\345q\352\352\002|J\226\211\035\355(\345 \200C\207\2420w\033i\326\003\032w\206x\023\376\024\301\331\001\023M\252\350\246\372\223\323 \201@\254%F\375\005\031ob\227[\301d.8B\214\3228B\031jBL\213#\267\333\325\230\323_G \374\355\003\032\315\0048\261\215\257\336\002x&0\376\343\214h\"#\336\245`b@\r\341\201J}\037\025\246\327\306\236\300\236\317\251\340w7\024\271\243\314\f\236\032\235\315rr[\356#\b]Mx\003\032m\006j\251=\305T\342=\303\231\266gn1\307\250\341\326\003[\035`\210\310\323T\221\224\327\233\033\242\242\316\353\370\030\301%n\371`\023\250\346\276\216f\203\332\332!,\205 \207\"_\231\232\026>\004N\315\007T85\310\352{#\237\233yoc"
+	.string	"\331\f\2327q~\273\257\003P_\315\2059\375+{6ou\217\351\251\340+\001\375\3639\3201%"
+	.string	"\260\223p\234e\337K\002\007\217\234\245h\371\025\300\252q\353e0\212Iz\325(H\327J\317\360E\342H\316A\234=\"\336V\333ohd\201\242h\311*\247~h:l\307l\"\026Y\020 _\364\312+8\214y\335\013\231\375\247O\231:Lt[\344:p\357\210?4Kt\336\346\265X/s\370r1\0065'eQ\350\026\256\257\254\246\237"
+	.string	"\024\272\3027!1.\373\250\346q\364nF\303\r\304#\242\005)\334\333\302i\026\037\004\353F\272p\351\021\020\235>O@,=P\276VR?\335O\276\006\004\\pX\006\254( \002U\321)\371rS\260\255\211W\324\203\361\t\233\220F"
+	.ascii	"\231\333\371\350\240\207\226i\330\030"
+	.string	"\223\362\301vs9\312\215\2174v\025[b\271\230.\346\245/\316\243\243\316R\262\232ypQ\f\305X\204\262\200U<\035\260O\331\306\031\270\227K%\233\366g\311\037\364\353]\263\317iU\321\216\246RP\371\337\353*\314\311_\\\302\231|\360F\323\351l\247\031\240\276\240\020\007\204{\301>\376|\tx\3013F\201\002\205\373\032\347ww\235\363&[S\031\355F~g`\021\210\370\246%\364=\253\302\324l\213\362\300\210\027\036\f\252\333\263#\340\260\364 (\207\004\020\316H\276H\374\206eH\211k\324\031^\035\301\253\310\337\335\316\244\362\222<\332`v\007\004\253C\305\366\0166>\304\233*\330\013\263}\272\036#\302\217\356\372\371\351\021\274#A\323G\270\247\002\007\343s\360.[Jx\020\315*[N\272L@\3547pQC\337\352\242\341\233\3354\316K\311(K\005\002G\202n\260FCQf\345U"
+	.string	"\360\355\276f\201\271b\335\305F\261\367t\253Mg\177\200\001\327\026\303c\347\017\344\343\344Z\245\226\243'\275}\221\234\205\351\344P\200)KB\315"
+	.string	"\245\366\313I\b\316>\351\221\325\302`\347%S\363"
+	.string	"\030\232\245>\275\242\232\260\np\206\f\"wS\277t\211\004\200\306\343@\320\b\026u~\230\256\365+\200\272\322\030\242\3416F\255N-\322|\034}EG\200\346\024\351\375\330N\251\255\314\361\006\332\305\272\340\310\356\351C\027\315\344\221\006\322\334O\b\352\372\230\241\363v\241\250\036\241\0339\277\2440E\003`\325\252h/\214\214\007\304\376\361T\017\275*'31vis%t\211\032\025\241\370\317\377\006"
+	.string	"\272\235\224\031\250,\331s\3258\313*\034\355;\227\335V\030L\351@1\356\303\032\370\303\001\252\365\003xb\233\217\264\220r%\006\362bp|\306=\027\211. \255\017\244\340h\3351\005\250\340"
+	.ascii	"\255ir\313\345\253\211?\210;\374\347\261<OyL\t[\203\003\266\323"
+	.ascii	"\334\006\n\305\375of{t\240i\256_\267\330V\356\215q<e6\243\005"
+	.ascii	"O)\226\213\347\340z\325vI\313\300\317_\377\367{\252\227\350\331"
+	.ascii	"\302\376\305\310K\273R\0164b\025@\344\0247\345\035\256\2524\351"
+	.ascii	"\354gqA\360\305\304v\267\375\225\037\3750\311\273x\211H\224C"
+	.ascii	"\032\335\374\200\307y\274V\237\247\364\256\376\375]j\266\362"
+	.ascii	"Y\344\0055m\327\335\335\253\327\372\013\373l\360\315T\366G{\346"
+	.ascii	"8\235\024\370?R\332S\325\037J3\347\3634\372\277\330\236\240\337"
+	.ascii	"\217r\205\235\342+H\266\335\366\361\307\325\361\245\303\213R"
+	.ascii	"<\360\243\343\305\262\376m\001p\273\223&\315\276\323s?\347s\275"
+	.ascii	"q\177\302\316\032\360\277\224\306\177E\335b\263C\346\024\255"
+	.ascii	"u\375\203L\036$\316\370\227\271\336\036\373\263\310\366\236/"
+	.ascii	"\345OOhh\375,\025\232\003-\376D\227\314\036(\237\272\177\341"
+	.ascii	"\270+"
+	.text
+	.section	.gnu.lto_.symtab.b09f0db5d2a313df,"e",@progbits
+	.string	"tcpTotalRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"tcpTotalTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"isTcpTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"tcpRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"tcpIsStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"tcpDataOut"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"tcpWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"tcpDataIn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b09f0db5d2a313df,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,231 @@
+	.file	"sound_beeper.c"
+	.section	.gnu.lto_.profile.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\354\301\314\336\005"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 \037\315"
+	.string	""
+	.string	"\210\023"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.string	"(\201o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 $\235"
+	.string	""
+	.string	"H\030"
+	.string	"\002"
+	.string	"\001\002"
+	.string	"\002"
+	.string	"\003"
+	.ascii	".[\200\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.f76a74a445dded20,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_systemBeep.14.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 \350}\006"
+	.string	"\362\213-4Pm\222\016dR.\206\311\026G\250\340\013i\372(\002\305d-\250\350g\177\003A\217$,}\273\214n\250\230\231V\274\203!ML8\"\352\245!\315\022\"S\034\016\244\340\264&\023\237\347\275\210\207\rE\001+W\305W\321\211\033Gu $\234&V.c0\364\274\350& \214\016se\333\250\340\242\201\376\372\260\266\361\275d\033=k"
+	.string	")\245\020\254df\264\260\244\311D\362\361\027\3633\366\n\013VI\026\003U9!\225d^\b'\004t\332z\224^\035Y\021\017\214\221Rf\272\306Q\253\314\272\r\251@H\364)\003p\310\314YH\244\321[\377\203\237\341\007\005\b"
+	.ascii	"3\003\316\231\341\341\313]\303\243C\030%5\031\334\345E;\311"
+	.text
+	.section	.gnu.lto_systemBeepToggle.15.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 \310}\005"
+	.string	"\322\211%/`e\323\001@\365\n\332$$`\023\332\345\206\302\023\006\204\002\027\257\333\002\205\275\241\247\272\260-\n"
+	.string	" \002\261\324\307B\203*\234\027\321\3362\005\257\250:\2639\035\f\013\213P\215\265:%W\265\030\273\032\017\256\252\306\324\3414\233\225!\224V\236\300^\371\031&\222\362\203\\\224\231\177\003-\277?*.!\251P\352\266\004"
+	.string	"\264H\020\342\374\337\351\333?Zp\323\353\001U>aw\263\324\354\266q\373ng\t\235\307m\034,\272\373\261\3630{\271\377\021\377\023\377\257\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_beeperInit.16.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 \371\305\006"
+	.string	"\022\315/2pO\032\003$\372`wGY"
+	.string	"X\211\314\331g\233\356\007O\261\026\221\t=\266R\021\315w\323\222i}\375\357 \036\331\205\356\321\035\317\033m7)S\n\023\225\204\025)\251\324F\302\016\204\021\017\034\313\"^\357\222\360\242\222\234gU\020\024\217\222\327\333 4v\240|\0251\312\247\231\267\313z\220\3414\332\351i\016\2445\300\377\327ems\350\b\305\030\270\374\03432o\211VF4m\335Z\223\270\004\263\t\206\007\376\214E\345\237\n]\230\034u\272@r4\231@rT\254\205\361\024\271Q^6RB\377\237\0131\346\206\325>\261\300\007\344q\013h\370\337\366\001y\270\316m\023\3322\264\375\b\b"
+	.string	"2\003&j\006.\234\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\016\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\017\177\003\020\177\004"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f76a74a445dded20,"e",@progbits
+	.string	"(\265/\375`=\005\r$"
+	.string	"\312C\b\017E\200jQcM\241\321\361\262)\342\304$\235h\016s\374\205*L"
+	.string	"\325\216\336\331\230\020\004>\355\"j\013!\371Eu\264\203\320wA\334\210\216\350\332V+%\316\321\323\357\036\271\220toT\223\204\274\177s\267-S\317"
+	.string	"\325"
+	.string	"\325"
+	.string	"\177\020 C`b\272~\360\371[###\003F\264\253\217q\022d\3360W\314=:\270c|\253\\.\317\200\355\3332\211\237,\\\245i\030\250\257\203S\226L^\007\247{\250\204Kt\236w\300\351\022\\L\036j\212,)M\223@\035\0025\007\364Z\271W\356\261\350f\221\251U\206\002\374\201\362\247Oi\372\002\232\240\312\217L"
+	.ascii	"\365-:o\362\026\235F\321\332%:\313;\340\\p\211N\267\227\350D"
+	.ascii	"\357\200\363j\2257\353n\371j])\236pdZ\360Y\177{\265\314\037x"
+	.ascii	"/\003\001\3672\230\215\251\002r\235\246K\264\264o\232k_.\266"
+	.ascii	"E\310\354\213\3056\035\333pl\207\331Vc;\313\366\314v\032\333"
+	.ascii	"f2\231L\332\006a_\b\266i\025\303\006\177\221\035\212\001{\\/"
+	.ascii	"($\016\250-@\366\266\377\017\b\241\206\260\017\"W,\366\307\202"
+	.ascii	"Jqa\005\265E\036\311E\252D\212\277!\343G \374\325{\344\177\365"
+	.ascii	"?\320\260\330\376>j\253\225P\370O\031\020\276\250~\221\361\227"
+	.ascii	"G9^\304\3258\204\305}\271b\264\372\214V\275V\027\243\032\242"
+	.ascii	"F\225\312o\374\277yP+b\016<\245i\3375\366\235r\333\253F\266\336"
+	.ascii	"`\177\374[\333If\352kFi~\265\006f_\301&W\245\351[\205\232\302"
+	.ascii	"\226\333E\200\354\017\242eu\244\345v]\344\224\205([\227\3125"
+	.ascii	"s\301\\2\027y\004C\326\321\316\337\332\276gn\231\213\346\246"
+	.ascii	"\271\307k\346z\361\365\272_\\\266\177\360\277/\227\215\263'\034"
+	.ascii	"]3"
+	.string	"\327x\273\024@\005\252\r\240\367\370\302\231\201a-\351*M\227R\250/\233\213\364ms\274mn\030\332>\352rUEm\361\371T\361\201P\025\236)E\300|\303\\\207\366g\375W`\"\231\263c\2544\275\347j\331\006@\253!\025&\210\033\324>\017\034\376\227\232\265\037B\321\316;\273\367\201\035\340\312n\203\337Es~ J\364\240W^\200?J\323\366\202\373\311\257\332\336~\270\032\251\324\325\n\030\321\326^H\201\033\211|m\251\210&\253\226o\177\037\244\"\262X[v\270\266\254Z{\220U\377\226X[\217@\365\256F*\342jd\211\266\007\257\336\b\024\202\006Y\342\372\305\022k\253\021H\\\203TD[Q\211\221\"\r00&\367\316\032<\016a\0218\254!\327\226\275\330\177\2172\036?\335\256CP\252\242\251\211'\242\346\006Ni\232aE\372\363\275\360\005yI\327Kwi\023\352\nH\020\220\222\\"
+	.string	"9II\202\222\204\323IJ8\234\022\022\0165\022N\366s\212\bO)S\356\326\344\224\300<\247\264w\373\361x\275\233\320/\207\204C_,\355\322\026,\322\036\n"
+	.string	"\276\\\223\016\305\216\247\341)\335`\373\345\200\232L\210\340\351fL\351\257\227>\355:\370tA\277\\\322o\247k\001d\034N\303\202\021\0368\240K\021z\251S\232\236\3101\355Z\360|7_/}\322\365\230n;\235\211\025\267\245\236\357\026\201\301Ng\242\267a\227:}\360\351\204T\360x\031r3\213\211]:cQ[O\314\030e\256\214\314\361\245s\263\264:\374\214\ty\331\221\252\032\223C\273c\304\207\230\257\226\266u\304\316Wi\306\271^\206\306\260\256\264C\336\274\271p\356\324ea\\\242\266\236\240B\002Q\250\201$\244\2204\206\314\310\004#3a4\005\036\220\002\2211+\036\021\300\265I2\265\240\2056\003\0074GI\363\242\236\204O\036\252\n\341\230\007"
+	.string	"\004,\317R0\226y\377}<\243\222fA\004\364s*\223\323d\307R\032@\306\215mW\262LsH\321\2406\315\3540z1D;\306\250\236\365|\255\314\240\205R\037'\020W\b`\263`]\371oj\325\215"
+	.ascii	"bK\374\266\233\204\277MV*\\e\242\303\340\004\256.\r5\202s\363"
+	.ascii	"\316\246B\264\004\314?\032_\350\t\\z\030+^\352c\270+\253\331"
+	.ascii	"\266ab%*\334\034\233L\313\343\273\024\370\037\306[\323Q\007A"
+	.ascii	"\352\362\236\006"
+	.text
+	.section	.gnu.lto_.symtab.f76a74a445dded20,"e",@progbits
+	.string	"systemBeep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"systemBeepToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"beeperInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f76a74a445dded20,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
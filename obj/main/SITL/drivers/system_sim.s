@@ -0,0 +1,362 @@
+	.file	"system_sim.c"
+	.section	.gnu.lto_.profile.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 =\265\001"
+	.string	"\324\0021"
+	.string	"\007"
+	.string	"\317\253\250\341\002"
+	.string	"\001\002\232\372\246\216\007"
+	.string	"\003\354\301\314\336\005"
+	.string	"\004\274\205\242\255\006"
+	.string	"\005\240\342\234\212\n\006\240\342\234\212\n"
+	.string	"\002"
+	.string	"*\343l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 1=\001"
+	.string	"\350%"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001\002\002"
+	.string	""
+	.string	""
+	.string	"\005\001\003\001"
+	.string	"\020"
+	.string	"\007\001\004"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"5CQ\031g\003X"
+	.text
+	.section	.gnu.lto_.inline.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 \302\265\001"
+	.string	"$\002\266"
+	.string	"\005"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004"
+	.string	"\007"
+	.string	""
+	.string	")"
+	.string	"y"
+	.ascii	"\311\034E\316\346\022\334\304c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 1\035\001"
+	.string	"\270%"
+	.string	"\005"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\002\002\001"
+	.string	"\002\002\003\003\004"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"-\242e^\2542\316\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 ;\355"
+	.string	""
+	.string	"\200/"
+	.string	"\004"
+	.string	"\001\002"
+	.string	"\001\002\002\002\002"
+	.string	"\003\001"
+	.string	"\005"
+	.ascii	"\240\f\220\311e_\220\365\006\260"
+	.text
+	.section	.gnu.lto_.lto.6b25cf3c15c16678,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adcGetChannel.18.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 \370\345\006"
+	.string	"2\31504PO\323\030 \233n\254\177X\317\362\026\035\215J\340D\350xC\024\r\323\310Eg\357\221\230.R\342\210\252\252\0308\016\214J*M\271X\314h\264\270\267L\001\017\324uq\034&\314\323\306\252$\203Eu\244\204\2042R\021Ul\200W\305\261\340\024%\334h\306 \250\b;\030\026\2414W\265HC\361*~z\334\343x\005\330\267\361NZ\311\244\354^\274\270\254\nt\362\361g/\375\317\375AB\246\"\023\277]\215\022\223\335i0\fP\350_A4$[s\323\003\003\001\305\202\244ewB\001\315D\n9\035\210\024z\035\252\251\323V\035Q\002\022\226\317\346Q\207Y\330\335\335g\313\320\237\376\005\277\302\277\005\b"
+	.ascii	"2\003\202\341\243\302Z\025\220k\370\200\211\0201\025\261s\315"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_adcGetChannelOversampled.19.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 \370\345\006"
+	.string	"rM14`O\322\030\024\302\304\203\2678\224\317\007\341\231\024\225\bn\202c\035\266!t\306\323\216!\202\253\013IV"
+	.string	"\200\"\314\273\262s\202\025\276\021e\030\rb\367\226)\022\324uu\"\246\314\023\307\252\344\203Eyd\205\2042R\024U\204\200W\325\261\340\024%\344l\306&\250\b=\030\026\241f\256j\322\346\342a\374\374\270\367\361\n\260\273\373\363x'\0202@\331\325\210\201\331\226HE\344\317^\363?\367\n\f\231\226X\374v;VRvg\3020@\243\177\035Q\222l\315\315\220\215\005\227\214\223\227\335\t\007\264@\322\310)\201\244\321\003QM\235\266\252\211\036\204X@\333G]\306aww\240\215C\177\372#\374\r\377\026\007"
+	.ascii	"2\003\202\341\243\302Z\025\320.\343\021Sa:\327$\003"
+	.text
+	.section	.gnu.lto_IOConfigGPIO.22.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"%\007"
+	.string	"\022N23`o\032\003\304\0255tl\315D\035r\245\306\3422M\001\204\343q,\221\207\347\0202\357\231\215\264\027\310 tP\237\247\35300B\241\253\357F\233H\231R\017\016\224\303\254V\352sYq\341\252Dq\"\276\b+\t\0136<\b\213\341z\024\214\357\343)\026Q\301'\3020\370:\363\316\334e\365X\270\213v\216\232\353h\235\371\377\272\254m\002,\006*\277F\f\314W\246\024\220\266\356\264u\255\005\205\244'E\335\317q\002rk-\342\021i\222\n\017\374Y\b\312?\023\3728\236:]\240\361\3041\201\306Se\333r\200\021\360\222a\342\362\3779\017K7Y\273\304"
+	.string	"\244\322\310m\243\360\277\215T\332p\235\333\"\264\r\265\375\b\t"
+	.ascii	"2\241[/0.\234\271\306C\205\301`n\200\212\022\356\360\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_spektrumBind.23.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 \370\275\006"
+	.string	"\002\215/3pM\322\001\240{\375\f\320j\312\230\325\303\242A\245\311\360\032\n\375\377\206\264\307\323NY\222\242/\242\270\252\310\345\272\240\211/\202L`\035\b\202\374\275S\n\020\325\303\346Z\230xS5\031\253\202\f\026\305\201\0240\341\243$\252\347\220\233\252\301J\315\203\231\301\364\212\240^r\256\353\345%\336.+\306\302]\264\261\323\034Gk\200\377\257\313\332&m\244\030\224\374\032-,G\211N>.m\335Z\2038\004\263H\205\007\376,d\362G\204\346\344\250\321\005\222\243\311\004\222\243b\255\212\243\307=\222\201A\262\362?]\20717\254v\310\002\236O\307-@\341\177\233\347\003r\235\333\036\264Mh\013\n\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_unusedPinsInit.24.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 \305M\005"
+	.string	"\242\t$+pm:\240l\341b\200s\210\340\273:\244\204c\003?\206\232\330\t\320NM\t\203\204\247\376\377\312\\\343J\005T"
+	.string	"Aq\357\224\002\266\252\f\253\210\354\332\352\243\316J/\007F\025\223\201%\262i\321:+\312Z\343\242s\3234:\247p/A\n\"#v\330Ey\261\017X\t\332Q`\001\025D\273\224\022i?\001\217\306\366'sv\350af\317\231H:\243\335\235\022s\356\221\363\2779\301\373\272\307\301aw\035\275\257r\313\3336\330\256l/\002\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 \220E\002"
+	.string	"\224\003\214"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\023\177\005\026\177\006\027\177\007\030\177\b\005\025\t\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\024\n\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\200\036\340\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6b25cf3c15c16678,"e",@progbits
+	.string	"(\265/\375`\n\017\275J"
+	.string	"\212\201\304\034UP\026\032u\345\365\001`\265\212\370 7c4@%#\204\210\020\313\320"
+	.string	"\260]\256\027\026\241e\317\331P\251\3763\367\202o\326B\304\337\356\355\221\315\325[\354J\334\233_+&\023\354\200\312;\302+=\017\263Q\244h-\341\361\232!1"
+	.string	""
+	.ascii	"\004\311\335mSJ\001\221\001\303\001\301\001(|\355\027Qh\361r"
+	.ascii	"\202\223\223\\\022]n\235\222\246uJ\206\215\271/\236\255\313\036"
+	.ascii	"\244[\016\276E\214I\327\320\226\223\016\202\214\375\3077%\220"
+	.ascii	"\250}'\002\242\260Xq2\006\303\272\f\363\3412\314\3512\354\350"
+	.ascii	"2\254\350\372\223&X%Y\342$\303H\270L\212\271Ln\271LF]&\333\313"
+	.ascii	"\244\223\313\244\013\227I\243\313\344\221\313d\3602\331\273\374"
+	.ascii	"\332r\371e\345\362\013\351\362+\311\345\227\221[\3237ec5\227"
+	.ascii	"F\202\321Y\334H\364\221a@\355\267\016\303\230)KN\362\013x\271"
+	.ascii	"a\224\257\256\256\206Q\362\313w\335\277\334\232 .\316U\023\321"
+	.ascii	"H8]\304\323\364U\320P\221\223\354=\334\017\276\253qJ\366\247"
+	.ascii	"\313\376\344\352\244pe\370_\236\343\345\236\272\354\304\344\362"
+	.ascii	"\324\221\313U\375\227\215\352\345c\217\313Z\027\334\2340\315"
+	.ascii	"\242d\035\227\354\233RF\337\2249\315\242\324\201\206\013U\t^"
+	.ascii	"\234d\236\313\215\304\\Z\211[J/q\326\3537D\370N\377\255\r\t\003"
+	.ascii	"\020&\0349\311m\263(o\337\224L\343v\016\035\245\221^t\022\317"
+	.ascii	"\260\301\257\236\224\217\362\337\322\250\340z\302%\306IN\340"
+	.ascii	"2\363\021\003 \345m\260_\356\027ew\365\213\222\233\331U`gv$B"
+	.ascii	"A\314\214\001g13\311\354\0370\367\006\314\255\001s[\300\334\024"
+	.ascii	"0w\004\314\235\203\271\033`\356\005\230Y\007f^b\346$f\226a\346"
+	.ascii	"\037\230\271\354\352\352\352b\346\"\346\027\027\263\f\007\001"
+	.ascii	"\377EB\340\021\250HO\005\031\207\202\240\200\204\335\376\277"
+	.ascii	"\013\241 #\341\373\214\277&\302\377&A>/T\243\327\032\337\205"
+	.ascii	"6\366V(\372!@\376\003\020\372\357\365\033\377\277\367\3771`Q"
+	.ascii	"\373\177\244\346G\024\022\372'\302\021\372\242\236\025 \377\356"
+	.ascii	"\204\304T\360W4\022\312\2540\025\211\017B\333k\342\037\207\300"
+	.ascii	"[\354)\375\220\377o/\227\030$\262\345P\330\237\224W\214\030\371"
+	.ascii	"\341$\0168\355\004\205aQ\351r\037\267p\321\332\332B\324\372\""
+	.ascii	"\204\020\3060D\250,O\020\255\202hB\366\204\024\f^\304Gp\"\237"
+	.ascii	"\301\217x\022w\301\2318\021\217\301k\360&\276\304M\360\033\234"
+	.ascii	"\0047\3426\270\022w\342H\\\006/\362\027<\005g\301\215\234\006"
+	.ascii	"\027:\n~\202\257\340-\270\n^\202\017\033\311\211.\204=\004\037"
+	.ascii	"\302d\373\357\233\262\322\355\253%\306\232\214\202@\r\321F\340"
+	.ascii	"\320Eki\t\253\037\200pB\313\211.\344\301\025\276\232\367\031"
+	.ascii	"\r\021\233\302\374\240E\325\303\030-/G\252 *6\234\310\322P\215"
+	.ascii	"\245[\256\346\201Y\346@\336{\022S%s\242\003\361 +$\021\377\237"
+	.ascii	"\273\312}S\252\214\351\266\312\261\t\037\264\246\230e\\Q\262"
+	.ascii	".\357AY1\001D\025\230 \210Wz\207.-%\222\320\252\"%\204\350D\245"
+	.ascii	"\333\025\275\232\017\"b\bQ\313\021YD\231\377\350\266\215D\f@"
+	.ascii	"q\242\341\304N\242\273\264Q\211\003Q\260\264\226|\350v\305\353"
+	.ascii	"\037\0051\304\377\226\373\211\271\241\230g\330pbGu\033{\343\203"
+	.ascii	"\320d\024\302+\352\350\205H\230\377\026\001\034\004Ph)\342\230"
+	.ascii	"\303\004\244\017\271\b\215\244\343@\356)\335\304\0019\035\271"
+	.ascii	"4\005k\362\330A\262&\017\213Kw1\226\311t\344dP\201\004w\026\343"
+	.ascii	"\226\256\346\re\327\016\326\235UE\177R\225\266\203K\317\333\316"
+	.ascii	"L]wb\024PU\325%\326\344\373\302\002\023W\032\311\2578\025\003"
+	.ascii	"\211\022\220\031\322\362AN:\017\216\205\235\312wp\252\032\302"
+	.ascii	"\177 \247\242"
+	.string	"y\342\037\210\246\333\200n\003H(F3P)I\216m]\216]II\371\224\220\fLH\262\200i$\237\202]5YBe\007''\217\"\342G\2341\036\251\202\005\305\036\205\302\206 \361\347O\261\243&(\303'*/\242\"\246j\300\201$b\271\301\312\311).dFx\374rdZZr\246\232\017\302rB\013\306\202\325\025 :\2603qVy\004\030%#'\275\330E\031'c\222\2240\221B5H!\362DI\351\225d\214U\nNrLx\331s\360(\354GH~\344I\267}\021\312'!\023\\a\236\250H'F\305%\374\201\304\236\324]f~\200\230\220\253\266\210\223\f\246[fF\0013Z\002KJ\211\313\334\345\003\001\377\177\004X\373\300\240\231\262a\335:\314*\372\325\007\374\213\371\205\355\277\227%\374r\231H\001!q\222\231s\236a\306\177\337\260\347\3000\350\033\026\371\025\207\337\363-\351\331"
+	.string	"\177\330\373\025\377m\336\347\353A |\233_\361\203\377\343*\330\337\016{\357\023\276\315\373\036(\347\347\033\006\177E\240\240\315\2578\f~q\3705\357\003\002\006\361=\320\346\213C%\276(\f\326\374\212\302\340\2578<\241\225\374\226\330\nr\021\032ei\245\237\357\207\204\212\200\2005\306_+\374\343\177;\001y\340\001\001>f'\273\242fL=}f$\352Az\201\351cv\262\027\230\270\224\002\223\206Mq;V\\j\001\r]w\270\335\n\032.}`\206\307\016\013$\340\261c\206\206\332t\267\223\007\016\347\260\250\0043\332\251\202g\251\212\342\320\236\3135n(p\203\207\027c\036\0342p\310(\231\007\207L\206\343\206\354\362\r\331\213e\237\030<u\247Gw\3039\035\252\356\260\271\234\272#\303\2323h\370X\317\233\271\352\326["
+	.string	"+OM\241;o3\025\246\242\264\364'\247\352h(O\265\235\251\212\2566<\324\246\333AP\263\235>)PZ\252\252\350O\316\304\2459\254\031\35391\310\245f\317\316\246\303\261a\321\025Ui\270\264\207\311\236\253y\333\251\254\017T\267\n0\203\332\316Y\nVE\177p\351L\245\2457\030.\275]\0373\324g\306;o\227f\325a;\177p\271\224=m9\235\212\262\270\0353\265\305\212\242j\017\n\001j\353\301\345\270\235:~t5"
+	.string	"h\266\234\317\212\252>\030\240\354,\007J\313Q\240\246'\016.e\315\033\262;C\327\235\311Sel(\016w\372\314L\336\3564y\347\215fUs\252\212\262(Yt\255\325r26.j\265\034\273\233\021\260\246\274\323\354\331\365@i\354N\207K[\240\272\016X\023\375I\331\363'UQ\332"
+	.ascii	"j\216\235\23553\307\356N\263\007\227\372\260\271\334m5g*\016"
+	.ascii	"-\227\252\250\316\254\351l&z;\325\2329SW3]W\325\005-5\331\024"
+	.ascii	"\267S1\303\306SW\032v=k&mw\3660\327]\217u\205\212[M\236j\242"
+	.ascii	"\353\316\254\255\352\214\2065{\322\032.\201\036\250qP\246\224"
+	.ascii	"2#\"\"\"\222$I:\201\005\3040\007\335u\003\022 \224=\330)\307"
+	.ascii	"\2444)d\237\3753-A\243T\n\355\001\222\223\004x\267\232\267\025"
+	.ascii	"\314\377\322D\275\313\\.&F\252\235\325\020\367\232\220J\tS\035"
+	.ascii	"\3126-\t\327\031l#[\224i\357\344v\373f\302\204\221\246\255\274"
+	.ascii	"\360\203C\b\261\264\177\277\261d]p\377{\367\177<\201\326\215"
+	.ascii	"\232M\303\273\356\242\357T\344\217.\331\312YI\364\020\331\365"
+	.ascii	"\335\356)\016\230\220\226\215h\230"
+	.string	"9\377\210\2429\313\003K\036;\222\302'\371\226\277\355\307\037-'\b\314\261|\t\327"
+	.string	"=\\\212\204\232\250\325\355\020p\f\025\250P\f4\b\215\334\310\213"
+	.string	"\373\367\025\352\211^\001\333\211yO\020V\2123\242/\364]\266\025\td\004\0132Q9&N\204\001e\331\255\222\303\274ts\344l\244\335#P \nD\032D\261EDu\266C%M44K\201\350q\212\362\220\250\206\304\035\211 \254\211p\376sV\265$\245m\005%\236&\345\2324\225\312\264\211]y\204\n<\201w\013\261\360\334\224\247o>\346\367\271\374\315[K\236\330/\324\353\277\227\306]\325\327)a\274%k\024x!)\240\335H\323e\211\n\r\324\236\250|\006\244\313T\316\307S]O\250.\302\263\352\023\220 F\301Vm\323\361\372\226\224\246;1\264\277\n\322\b\323\347\004\023\276OR\3358\330\356\377\"\316GP\247\235\202\242"
+	.ascii	"\240\273\033y\252\270\322\306\341\250N\261h\260j\351lr \263\361"
+	.ascii	"_l\234|\006\231 \316~1}6\241b\372\365\323\255\301\365\307j\312"
+	.ascii	"~\316h\025\316\233\333\246\365\347|\fwx\216\376AMQVi\232\257"
+	.ascii	"\270\316\306\270\261\021\b\3570\035\314\213tK\306&\377\276!\263"
+	.ascii	"\022\374<\323\234\200\365A\357\220O\314\305\246E\227\311\352"
+	.ascii	"\316\021\035!\232o\350;\250\177bi\035\346\270\022!Bj\376\236"
+	.ascii	"y\027a\224<\247?\345>DoC\244\255\221o\007\244\325f\252"
+	.text
+	.section	.gnu.lto_.symtab.6b25cf3c15c16678,"e",@progbits
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"adcGetChannelOversampled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"unusedPinsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6b25cf3c15c16678,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,510 @@
+	.file	"controlrate_profile.c"
+	.section	.gnu.lto_.profile.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375 `\235\002"
+	.string	"T\004T"
+	.string	"\n"
+	.string	"\206\214\261\346\016"
+	.string	"\001\265\376\273(\002\363\341\340\230\f"
+	.string	"\003\240\342\234\212\n\004\235\205\271\212\n\004\002"
+	.string	"\002\001\002\002\002\002\006\007\200\242\234\020\006\b\273\305\341\276\004"
+	.string	"\t\315\326\216h\n\240\342\234\212\n"
+	.string	"\004"
+	.ascii	";\023\334lE8E\331@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375 ]\325\001"
+	.string	"D\002Q"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\002\001\001\004"
+	.string	"\001\007\001"
+	.string	"\001\b\002\001\002\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"6\303\250\212\364\313% #\317\r)V\333,h\003X"
+	.text
+	.section	.gnu.lto_.inline.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\205\005"
+	.string	"\362\311\035$\2207\351\177\365;~\306n=p\273\273\022\035\224\025y\257\270\215\335\317\306\363\356\356\024l,Rkd\023\271S\377P?TWs417|Pv\367QA*\347\366\317\334\243`\352\r\331\035\024\254\341~R\023\231\tx\201\260\177\021\033\037\221\231\323\367\177\365\256\037aE2s\271\177\377P\353\317\301\377^\250\231\231\312Kk\"a(\230\376\025\326\242r4\232g_ \027"
+	.string	"\251\020S\210\001\002i\325d\314u\2002\200\005\346\272\231\250O\205k\ty\223\b\254\004D\260K\r\002W\205\327u\005\214\246\","
+	.ascii	"\354\n\301\263\2412N\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375 \260\335\002"
+	.string	"\262\204\016\027\300\245\320\001?X\275\351\037\374\364\365\377\203^,\246\221M\366\226)\005Z?"
+	.string	"\207\320\231\360d%\253\300o\026\305\026h\265Ao\320V@\023\255\315\341s\2544\254\344\035\034\004\f"
+	.string	"BH"
+	.ascii	"\366\240\260!\326\345\241e\254b\2029@\201%\205b\227O\021\222"
+	.ascii	"Y\360\006\332"
+	.text
+	.section	.gnu.lto_.pureconst.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\230\004\004\230\004\007\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375 sM\002"
+	.string	"\324\002_"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\005"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002\002\004\001\002\b\001\005"
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\007\002\b\0071cO313"
+	.string	"\013"
+	.ascii	"\270\001\020\256\347\306O{s.J1\222i\257f\0164\013\007\243\f\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.lto.20d04d4eec7115ec,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.29.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375 \252\335\004"
+	.string	"\244\bl"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\255\250\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\314\030us\326\007uq"
+	.string	"\005\001\006'\001\314\035\001\006\214\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\005"
+	.ascii	"0e(\025<\314\242S\024y\003(\002"
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.30.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375`\205\001\365\017"
+	.string	"\266_nF\360\260(\035\272|\270\334\327\001q\006c\373\030(\bC\322\217\332/\277\342\t\361\331\023|\224\231\327\252}\255\026\353\350\341\361c\035v\326\265\237\214\303\344a\334\311\201*&\230upw\320\264\271jS\355'{\313\235RY"
+	.string	"V"
+	.string	"\\"
+	.string	"\237\006/\332>?\037\260}ze\327 p\022\300\006%F\307\356r\032\302\333%x\313\270\372\224\032W\376\354\361\233\toj>\326\247\004\255\270\200\021\360\235\310\0064H\314N{L\371ZQ\272\260\\O\273(\326\272\251\371X\036=\016v\327\361\365\255\334\333m\227\330\216`_\0264\0358l\260\302l\320e\277\347\341-\037\255\032\0355\372"
+	.string	"T\005eFdcWe\207\307\316\230/b1>\264\037s\320\2479\364i\303\\\305\352\241krW\210\274\310\310\331]\220OC\370|\032\220\017\331~\264\377\362\024\253\3132\374c\027\246\323b\027\\`\006\237OP\313\341\372\360\211\227\371e\316\"U"
+	.string	"\207\210]\327_>\315k,\310\217\3704\206\324\366\327\247\237\332>U\355\222\013\361/\233j \\\312rT\217\252\252\207\232\353\304\201;\306v\215zW\211V\334\261\324\353c.M\330\304\302\233\231\036&qG\025\005\316\215\035\252-6\310\212\n\013\247S8\231P\335\203\222j$\341\303\244\220\322\310\311\324y$\023J\252\2217\322y*TG\342H&\016u\032U\340H^\212\013A\340\216\244\344q\252\256\363\270\020\270W\230?\273\210K\216N\216\211\266\246\266\330\003CA\2528\021\344RSl\3276\251\227\2058\032\342\216\313\335]i\005\227\n\322\323\002\032"
+	.string	"\2423\341L\213\201\032\3224xL[v\277,\201\025\022\263z8\301\342f\332\203i\223k\206\020\342\260\025\005\212\313Ah?Uk"
+	.string	"\021\253\3566\253V"
+	.ascii	"aqCD\331KW\215\007\024\021\3235\237"
+	.text
+	.section	.gnu.lto_loadControlRateProfile.31.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\r\013"
+	.string	"\006TJA \247j:\227\305"
+	.string	"t1\200\b~\023\310<\365\345\215\017\327I?\324\005\201\r\207*\022\001O\374\332\013*\267.6\232\205&<\267tF \001!D\362\317,\020#\334\272\005\34080\243M\366N)2"
+	.string	"5"
+	.string	"="
+	.string	"\256\240J\356\325\036\331\334\3539\223l\005'U\373\026\310\351\345`w;:r\322'\311?\353\025\021\265\361\2310\261\273\236\"\312\343\246\267\315`\273\302\276D\376\204\346\305W?\264\275\236>\204\224\017\306\322\234\331\244iR\021\373\332\322\224\255Mktz\316\351o\333\211l\001\301n\307\f\302\306\352\001\022\333\367\001|\034=%\254;0([\t`\r\306\023\020U\003*Q\343\003\276\272@\265\273\021\256\277.2\032\315\366\252\321\217\257%2Wi\002\3738\235T+O\021\314\271"
+	.string	"Pa\227\003\302'\037 \303_\275\006\306\360,\337&\203\001C\217\305\007\272\204\0330\004u@\257\3630]'s\341t^\370\351,\r\006=_\330\201@0\3548\262tmi\312\024(\261\0225Y\243~\201\303D\376\312\027\317\013\025"
+	.ascii	"\020)\2022\253\t\274\030n5\370M\330:K\210\tl\334\232\to3\020"
+	.ascii	"\0308\021rye<\244j\320\205<\004c%(\333NY\276\264\013\316\271"
+	.ascii	"\2050\237"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.32.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375`\264\001\035\020"
+	.string	"\226]jG\340\262(\035\322\246\207\016\034\216\325\204\366\367_\362\2255J7\346\352\034a\211\273\261\247|\377H\243\212\352\377\372\276\361\270\225\310\330\331F\214\214\236X7\344\214y0\b\207^2#\2461 \n\320e\304od\223-S\nP"
+	.string	"T"
+	.string	"["
+	.string	"\006}\036d[\325^\320@\365X\312r\267\305v\263+S`\006\237O\253\354\033\227\301\354\307\026\026\026<v\327\223&\256:'U\345{F@\304\327\352\\\210\313"
+	.string	"/\027w`w?s\355\360j\251zFv\327*\276@\334\363\266#\330\006\355\353\004\335'"
+	.ascii	"\227\030;$Xz\323\335]I\t\233Ou*\tx(1\322pi\017[\326R\t\263\317"
+	.ascii	"\255|\261;\365G\325\236\251\346\036\3735\244\323Q\243\300m\367"
+	.ascii	"\303\315\307\346L\234\023\266\357\253\370\270\362\025\006y\325"
+	.ascii	".\373\314V9\215)\310H\261\273*\366\212\003\335\347gO\220\243"
+	.ascii	"6\332\240\351\214\2779M\333E\323m\242\211\343A\355/F_II\367\371"
+	.ascii	"\221\037o!6\302F\006\005M\004'=\222\253\261\374\370\314&wA\372"
+	.ascii	"\354\272h\234\374\354\234\214Km\207\206\2457N\302\244mr\233\224"
+	.ascii	"\001\230\335u\340\327\274\005\212\037\363i0E/\246\004\336\300"
+	.ascii	"\341\323P\2220\341C\211*\f\360H\344;!\221\200\241)\364\241D\341"
+	.ascii	"\t\030\242J\340\310\033\221x%\222\b\305\033\205'O\004\201A\323"
+	.ascii	"\027z(\020\f=\220\214un\345\213!\354\310a\311\226\005\250}\001"
+	.ascii	"\203^\364g\036R3#\247%W\376H\037\3470N~\2143\204\364b($ P\202"
+	.ascii	"a\314\314\003\200\211\316`-\312\2042\323\331\0306\263\262\322"
+	.ascii	"\324u\227\311\2131\262e`\257u\221c\234\320\\\317x\254\271[VX"
+	.ascii	"*Q0\324\212\335\241+\215\205\303\355\006k\242\321\204\016\036"
+	.ascii	"\233&B\215\022\r\374\335\331\216\312\305\001\336\367Q\nklW(\003"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.33.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375`0\001E\r"
+	.string	"\206XXB\020q\233\0163\030\200V\301\225Qw\013!\271\312Lx\r\204\026\247\260\271\336\323\006Sz\037\006}\363\357;\271\321a6\275>\350\324\004\245!\264\202\026\0204#\211T\300'\r\005$\266\337\233l)S\nD"
+	.string	"A"
+	.string	"D"
+	.ascii	"\266\214\227J\354UH\036\013\032\273{)\211\177NA\315\217_e0\242"
+	.ascii	"\017t"
+	.string	"\352br\b=XL^\201\321\210\032\326G\222\n\340+\201\036\273\373\224\247\206\257\313\2542\273\353\024}\036\356x\333\021lS\260\277\t>\\\035\331\231\306\034\345\257N\372c\246\241\246U\323\251\351[0\305\t\002+\273\034N8\326D\271@a\373\226\215\342y\200\355^\230p\220i#P\3609\311c\335\025\301\322bw\305\001'\270\234\362'\nr\245P\253\250\030uz9ByrK\207\023\fXi\324\001\033n\344\356\202TOlg\210\252\023Tb\220\244\r\247^U\251\025\357\303K\2574U@\013uO\214z=\210\0203<\025]\236\354R\227z\342\330\326\351\300\220m8\r\036d\234\006\302\002\256\263\3510\366\221\211\204\200h\333\210\204\214\323l\"\332\306q4\354\302@.N\210\246\302\205m\235\353\303\200\265\221l\2738M\333.\253\024:\\\035\231\201\211)\244\035\025\023\332\302\205\274\310Oy\246$\034"
+	.ascii	">\353\341\211\265\365\0348\023\272\223bT\030*\365{\271\320CP"
+	.ascii	"\213\275\210\007\267\200\264\240\r@!>\302\004\223\031\316\232"
+	.ascii	"\203\271\206\033\314\002,\302\030\2400\030\246\317\300\301]\002"
+	.ascii	"\006\254jd\315\220\333U\364"
+	.text
+	.section	.gnu.lto__reset_template_47.0.35.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375 \250\235\004"
+	.string	"\"\b\037*pe\322\030\200\323\363\r\300Q\326\b\206\252\252X\264\220\003\020\b\004\002\201\n\300U\025p\257\237By\361l\177\003\246T{'\031\226e=U}UU=U\247w\026{\030\203\032\207\034\317\307\"\310\243\310$\311\245\311\033\345YyZ6]0\007\\\031F!\216p\020\220o\306\355\024l\252"
+	.string	"G\355\317\232b-\2419\\\031F\275n\003|\t\247%|?\302w\343\234|\265\240\252\234\b"
+	.string	" D\352,\tva6\004\302\236\272,\241l\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.part.0.40.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375`h\002\r\022"
+	.string	"\026auH\320\362&\035\243\307S\331\352\231o{\252\272\220\311f1\334 \\a\355\031\325\0316\367\237[\214\tr|\0332\215\275\217\2214-\034BW\310\336x\200\311r\350\220\365(\315+\357C\033\276\341\250\332\227\274!\262\211\334)\005["
+	.string	"d"
+	.string	"b"
+	.string	"\002V\326\203\205\212\312\007\331\004\345u \232\213\233\243c\225\266\t\n\354@4\326\335\023K5v\207\030|\372$\365i\337\307\366K\3070\373\307E\332~\374\271!\202\332\335\356SU\034v\225\033\314\377\370\221\331N\354\n`\307\303%\201o\")\273\353\324\207{\3366\212\355\016\266$\021\252\322\362B\377G\006\230\360\330\315\031\"dQL\245\026I-\031\267x:\032/\273Rd86\033R\t\246\037\250\325 .\260\355\3178\322\214]\212cS\223\342d\344p\363\002jW\354>-\376"
+	.ascii	"\367\231z\001\316\367\217^\223\371\220\r\320d|\242\027\315|\310"
+	.ascii	"'\261&\030\273;#\375\361e\253TB\242H\363\255\231D\253\331\341"
+	.ascii	"u\260\346\023-\007\247\257}\302\317\246S?^A\254I\346\303(\252"
+	.ascii	"\3508Z\232\3444\313\360\033,}r\332\335\0066\256t\301_\361\351"
+	.ascii	"\227O~\366q\237\252/\272J\320\210#\037\0212B\\\245r.L\030\335"
+	.ascii	"D\325\310!R{\254\333\267\335]+\217-\"\315\251\364|\320\277q\322"
+	.ascii	"\001\266\260\002]$\030<\026\030\b\021\274pE\202\203\320\305B"
+	.ascii	"\342U\211\347\302j\371\300\030\n^\270\002\272|`\b\363\255\272"
+	.ascii	"UK\007\303Zy\351V\240\253+I\340/\306\003\273\360\373\300Ne[~"
+	.ascii	"[\345\361\003\020L5*\263\252\366\330\016 \021\334K\234*\247\266"
+	.ascii	"WA~\346\217O5\305\330 @6h\314\257}G0 \300\002\231$\316\001\274"
+	.ascii	"H\340\324\303`\335\315\003=$0\035\216\341\217b\364m\354\252\334"
+	.ascii	"\272\207jib\007R\334\032\3033\030\265\203\001\006\341'\352\303"
+	.ascii	"\306c\023Dv\321\241\200Z\213/.r\036\034j\006h\013\335;-0\337"
+	.ascii	"\033\233\221\230\340I\252A\273[6E\223P\215\325,\274\225\267\331"
+	.ascii	"\002\250\275p9\245\323\257\245c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\005\006"
+	.string	"D\t\036\001"
+	.string	""
+	.string	""
+	.string	"\002\036\177\t\210\214\225\311"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005#\006\200\204\001"
+	.string	""
+	.string	"\003\002(\177\n\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\032\013\201"
+	.string	"\002\037\177\f\272\200$\r\031\016 \177\017\002!\177\020\035\021\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\033\022\001\"\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\001%\177\024\003"
+	.string	"\013\372\363\352\266\003\001\204\001\003\002\013\244\001\003\007\344\001\003\b\002\344\377\220\375"
+	.string	"\001\202\006"
+	.string	"\020"
+	.ascii	"D\313D\036\006\345S\004\370LAF0<\277y\f\031\202\260f8\b\240\003"
+	.ascii	"8\274T\340#\f\030\234fT\370'\204*\003"
+	.text
+	.section	.gnu.lto_.refs.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\004"
+	.string	"\002\002\002\003\002"
+	.string	"\002\003\004"
+	.string	"\003\004"
+	.string	"\005\001"
+	.string	"\002\003\003"
+	.string	"\001\006\004"
+	.string	"\004\007\001\005\002"
+	.string	""
+	.string	"\005\003"
+	.string	"\002\003\005"
+	.string	"\001\006\006"
+	.string	"\003\t\002\003\002\n\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.20d04d4eec7115ec,"e",@progbits
+	.string	"(\265/\375`H\030\315u"
+	.ascii	"\332\305\204+S0RBJ\007*\312c\202\177\225v\255Zt\005\177\305U"
+	.ascii	"\203\355\305mE\270\206\253\230\350\364\255\223\r\026\234\363"
+	.ascii	"U\311X_\346\307\351F\344XUs"
+	.string	"\326r\253\361\\\307\300\334\207E\020UeE@\231i\205y+\022PiiIS\211\303;\367m\020\"e\nP\002\250\002\273\002j\023 e\215\376\fb\317\263\312\276y\026\355\333\315\276\305\3303\236;\234\024\232\263\304\216\222F\371\007\266\303L\005X\356\\\207\325\336\023\265\274\313N\202\347\n\263\321w\027{V@w\316\315\261\002:\256\223t\216\353\002\306\306\235F\233\314\276\247X\037+l$\207\333@X\301\323&\245\321;`\246\215\031\017q>\360\032\263\3416\254\206\335\230\215\341\360\033v\303k8\0163\271\215\317\234\321p\232\363\362<&\rN\0301mdz`S+\363\006K\026;V\256\310q\331\237\244\303\035\007~\246\222\003\223\005\235\367\n\301\323\325\242\201\026\334\306M&\343&r\202/7n\367.\317Z\376\2446\346\302`HH\335\033UC\001Zi\316\322\342\356\275)R\034\245\320Q\341Z\0227"
+	.string	"\312F6\322\021\265\r{\246c\317i\354Y\214\035\272b\217\236X\023\\\304\242\340\035\366\f\346\347-l\306h)\334[\274\367\n\2403\026\225^\215\362\027\336\341\214\306g\227\321\036H\336\033\305hBw\356\215\022b>\301|\002\375\312j\202E\207\236qX\356\222t\366R\244;\"\227W\350\\\243\362\342\243\321\036(\313\202\215t:.\322\275P\355\327x\366nl\244{\007\366ql\244\343%Waf\t\036{\003-~\022\305n\330\275K!\240<R\362\3105z\013\354Y\354\005D\335\026\017\300\236K\350x\216K\350\336vh\312\317`\034V\3424\352H^+\367.\211\204\226?\246\264\032\375\222\215t\226\213t&\270\211\320\337"
+	.string	"\374\\\364\263\210\237\t\370y\350\347\243\237\003\370y\304\317\002\374l\3643\321\317%\320\377w~\026\372O\3647\357\347\b\220\374|\344\273\277/\320\"\321Vl\300\317\024\\M\026\t\377I\374\254\274\361\263\220\237W \377\237p\237\277M\370\271\205\237i\374\f\365\263\013?\017\177~\372\371\205\237a\260\3729\205\237\205?\263\360\343\377\320\337r?\373\370\271\352g\031~\216\341g\030?{\360\363\006?g\360s\214\237+\370Y\202\237\027\370\271\201\237Y\374\214\364\263\211\377c?\037\360\363\211\377q\376\207\3757\372\237\366\337\316\315\315\315\375\275\300\217\356\360\003\360\"=r^\r\346\325_\272{y\231\344q\274\310#\n(P\372\313\022\217\242\230\351\210B&\345\375\205\246\221\233\201K\243\035\245q"
+	.ascii	"\341\246-\355\354\206,:o\2704\232\306\276\247\314\266\023\264"
+	.ascii	"\307\0305\255(\366o\033\232\350\304\264\3300i\364,\205[\353\275"
+	.ascii	"\244\231t\223\np\030{\274\312\270\335#\r*\206,\213Re\204$\033"
+	.ascii	"}\217\226}\027i#\357#?\322J\354\362\362\340,K\037\362\304]$\022"
+	.ascii	"E\b\034@\324\360$y+9\234\237K\242\347F\230\226'\215\036\256\271"
+	.ascii	"\376\373\364\304\331\312q\344B\302XKn\330\030\022\242F\361mM"
+	.ascii	"\243\314\336\352\034T\2224\261\301\214\375\373\327\335\250\343"
+	.ascii	"\275\267G\317\362\036\245~\316=\314(~ >\371\200\377\350=\377"
+	.ascii	"\021(\334K\334\222\234c\237p\211\272j\023\367=\315{\213Jb\005"
+	.ascii	"J\252\242\322\3128\246\274\304\"\023\"\321\361*\211\306\261{"
+	.ascii	"\211n\261H\304 y\211\214c\227\352\3268C\305w\251$\336b\362\022"
+	.ascii	"\335\342\2152a,*\251\214cQTD\3061%\325\035S\336\241[\214:\342"
+	.ascii	"(\336#\321\035S\306\271cI\252!\343X\222\3128\246\004\302F\343"
+	.ascii	"\032'TZ\222Y<\270\212\261xwLaE\035\207\232\306e\362\256\335\313"
+	.ascii	"Vl\334\343\001\367b%\217kQV\334E\252\271CJ"
+	.string	"KT\222\227\367\336\021SRY\311[l\032\275\222\367zI1\335\251\007\210\313\346E\302M\242\026\326\325a\343\336\001\246\356%\362m\336{\211\367\336\335\021kyo\rC\306\256\251\251{\221GS\027\213\350\305\306\275m\245M\027*\343XV2\311K\331X\327\275\261$r\327]S\036\355\030\261\312\325\361f\273\250\252\344\034\261\313\260\037\036<\222$\225D\232\255\314\353K\023\351\344\034\257$<\032\035r\004\002\214\tYZ\243G\253\354\035\230\201\314\215\256\021\305\326\225G\256\253\232\206\266j\254\246j \355\243khd\007\351\037\335\243\2050\263\257:\307[GO\275\337\212mV\372\252/\337\341\346V\005a?\270\365U\333\350\032_p\372\212\3510\036nn\241aw\334\324\214M\214\n\203\303\343\366\326W\275\243\217\334D\242^y\334\356\275\215\303M_\361\034\223\005\021\227\005\330\031\022\206\303\275\313\024)R\034\245"
+	.string	"\212\203\225F\t\t\364}\374y\016\2771\332\017\227\217\2522\2152X\322\233\207\020\032.pL\316\330>\262\221\356"
+	.ascii	"3\373\263\314\376\234b\177:\261?\271\354\317\254\256\361\267"
+	.ascii	"\024\223a\262\350}\222B~\016\021\222\363\203\310U\243'\326\031"
+	.ascii	"$J\027\0266\314\263\301y\362\346\214J\243g\r\347\225\320V\327"
+	.ascii	"\225/o\273\333Q(\316+\256\r\220\263j\007\230\234\021\344rw\003"
+	.ascii	"\362K\214\225\022\364\206:Xo\215\372\370}4\223\305\342p\341\200"
+	.ascii	"\302\3428c\343E\316\236\370\263\306I<\253N4?\227(vy\354\262H"
+	.ascii	"9\202\214\273F$\212\240\034m\312\"\247\216\237U?{4\320\342l@"
+	.ascii	"#ee\215\236Tg$oeF\036\347\321\2067Z\362\220\261\347\016\006\202"
+	.ascii	"\330!rgj\353\314\022(\215\366\231\343l=u\006%H\243\347\fo\003"
+	.ascii	"\322Re\013\353\304q\252e\241\221j\364\264q\336`\346\323N\343"
+	.ascii	"\203\316n\\IC\263\227\201\237\246;\245~\026\177\037\2373!E\224"
+	.ascii	"[\354\177F\375>;,k\256\272\254\330\333*ss\275\344`\350\336\""
+	.ascii	"C\272\350\300\222\350\310\262[\336i\314\354-\215\3474\"o\025"
+	.ascii	"\0059\222X*|\304\256\270n4zg\027\345\303\0321\215\336\376\260"
+	.ascii	"\347\2602m\346\215\333\0317kz\355\2062nIh\272\031\326\246\325"
+	.ascii	"\340\272M\313\341&r\350\026\315\342\222\340Z\315Z\235\226k;\035"
+	.ascii	"\327s\232N\377\300\314\206k6o2\335\303\217\306\300u\0326nBs\300"
+	.ascii	"t\260\032B\313\234\215\204\224\221\003*p\334\342\364\0333[\316"
+	.ascii	"\217\2267IN\273i7n\"\267\304Q\322\0207\"\005\220\2344kW:\267"
+	.ascii	"\266 -\313#o\2156\234\035\322*\255\006\2357\314l6\013\207\203"
+	.ascii	"\227\263\205\340\201+\353\315~\307f\277k\332\366\301\252q\013"
+	.ascii	"\2426\306~\007\306~\307\305~\207\305~'f\277\233b\246\233=cc\346"
+	.ascii	"\2505\231\fM\017:\244\244X\023(xh1=\346\367\021\372\352b$\213"
+	.ascii	"\r\366\035\006\004\2562Y\032E\371h\272F{\203\371}:\255I\327\224"
+	.ascii	"\022\373\376\322;\374>AkL\256Ti\364\273\263,ss\2004\332^\254"
+	.ascii	"\215\335\017\005@\0041\033r\325\350\333\313\337]\030\013\215"
+	.ascii	"9<u\032\005\342\"]\233%\275\271\204P\003\343\226C\243?\272\037"
+	.ascii	"\256\\\351,\3666\201\210TQ\322X\336Y\300\316\226VL\326\324\201"
+	.ascii	"\331:4\221\243\345\355\021\"\313\r\243B\367\303L\215M\031\331"
+	.ascii	"\231\331d\375\204\305.1\004\032c"
+	.string	"U\217\270{\221*v;|\211\263r\"&\326LK<zr\354&\334\224 \207{3\317x1\301\322\350uWS\230\331Sz\351c\274\227J\205\233\344\021\251b\007\345H\230$\215\366\362o*\235C'\3210'fO\032\375ij\t\303\264\3517#\250\312h\n\006/\340\365\254O\037\fp\246\025>\025\3117c\t\370\033\016S_P\225\341\023a\375\001\177C\300\237\272\016\221R\245\247&\037\360\207\244\016\237\220D45=\001\201A\340n\345\351\\\b\002w3zi\023\n%\3649\245N:(a0\206\020iIX\344\003>\205"
+	.string	"\316\350\236!\357g\345\001\227\204=\300%\341\311\264.\001\323&]J\3437D\207\303TUR\352\355\240\204A\037\252\256\302S)\005.\375\232z;\245t\370\204\372\322\341\356*oI\270\002\bJ]\207\277\245T\004\022\351\022\260\307\344;Z\201\251\252>\371F\024)\365\202M\"\240z\252j\301\b<\003D\260X\261\252=\341\212\030P\302\240\257\304\n\300}C\036P\003\021\226\204%\356\373\251)0]\262\177\300\005\003.^\274\260\373\013\030,`\260\320\375\005\214\244$\030.\222\354]$\235,V@\360@\223\320)]yk:LU^"
+	.string	"\353\231\022H\235z \024\275P\372}\2402\255\273\027*\323j\207C\237\272\013\n_\310\300\247\352\206=\030t Ce\"\001\b\245\344\263\002\177A\341\n\275TU\201\327\023\256A\251\020j-Z\201\251OM\205\274\246u\r\252L\253\210\225\347\"\311\256?\247_\023\017D\252\024\374\240'\\wgZA\300\203\302TEZ\203A\025)\304\220\027\303)]\207P\303\240\027R%`\007J?\241P\013\277\325\327#J\225\202N\274\245'\025R%\020C\337o\035\376\326\336:\344\2550\354\255BL\276\365\347\302\b\303\240\f\0272\214V\360\005\233|j\332B\220\367$\364\001\245N?\022R_O\335"
+	.ascii	"\030\202\232\272\020\024\212P{L>TM\1773~+0U\352@I\355\005U\020"
+	.ascii	"\242\301\364A:d\322\245ko\035\001\030\374"
+	.string	"\255=\365i\3517\003\030\364\001\220\256=\021R\032?\247\337*\fAM\233\236\224R&\337\320h\345\275X\201\277\247\335\223\222b\230(\001\204\r\254oE\332\364\233\021T\205\274t\355\251MAu\005\006}H\276\031H\300_\317\t\311\247\016\221V \260\004\3749\251\026\254\340\373\255#\244M*\364\200)\321\223$9\233\370\020\357%\016])5f]\224\374lr2a$jZQN&\347\022]\226\0261\f\357\370\242b\246\n\327\227\317\333\016*i\215\236[}\0369\221\374\334:\215\374\024\227\347\026\312'\202\230O\364\240-\211b\352\320\373\200\025a\242W\200le\235ZO\244\350H\343\322\350\231L\236J>\036\357E^\342\034$&\216!aq\027I\003\212\377$\362S\331\\A\\Q\254\254\240\241>\274\200\365\320\001\201\322\250\241,\247\2243#3\"\"\"I\222\244\003\001\005\204 \007)t\345\001\022"
+	.string	"55\2231\250DdDf\024$%\205\302r\261B\327\202,\001\364~6\342\fe\356\230\021q\t\247Ph+"
+	.string	",\001f`n\317`\230\0300\035 c\206\035V\202\365\013\r1\220a\002\243\032l\316\211d\3468\347\3472\230S\033\336'!t\303\321Y\224}\264P\r@\216QV"
+	.string	"\321{\373\271~\240\030\310\017ra\272\273\001M~\033\002\250!\303\354\025R\217\224\003\201\235\250j\220\033}\274Z\311\235[\242\216\225\020\023>\350\300\005\021\3600\273f04\2626\231\2221\003\215\375TY\234\316\303\304\213\013\340f"
+	.ascii	"\311\221\020h*\361I\035\006\034KT\323\377nr\327\316S\231\270"
+	.ascii	"Y%\235D\r\037\263\266\n\375\021\024\343\262\332\220Dj\224\246"
+	.ascii	"\007v\305h\347\"\022\027\273\314\222\005 \030(C\200d\372\321"
+	.ascii	"\233\246\220V,\267\225\347\361}N\300&\224\363+\275\016\356g\361"
+	.ascii	"\265qiw\366\2461\t\034\235<u\270\246D\003Z\037\t:%\016\334\334"
+	.ascii	"v$~\t\315I\3116\245\f\020\335\277,\347\272_)6$\314#;\365\033"
+	.ascii	"e\346\324\247\362\002\331\004`\251|\032:Y\316\003\251>z\350r"
+	.ascii	"G\334P\266(\312\026\262\001.c\214\270\221\017\020V\232\374\276"
+	.ascii	"\006\b\340\330\215\326\2611c\030\242\231yQ\230/6!\302\313\003"
+	.ascii	"h\313\212\301v\207/F@Q\275\272\325\3500C6\342;\320\005\225\004"
+	.ascii	"n\212\242\034>\025\362\327\001\336\360P\356x\250A+&\213\220a"
+	.ascii	"G\b\231\022\236\304N\\\260-\351\237C\344D\316\022\252\225\213"
+	.ascii	"3\213r\260F\271NX\270\272\275\212\332&`\241 2>\270\224\310C\020"
+	.ascii	"\372\275\215a\032\302\005\324\307\251\031\241\264\f\207Do\304"
+	.ascii	"r\226\373\374\234\334\315&\031\360\336\363W(\331\327\350\254"
+	.ascii	"\230B\034c\023\017\310vH&\275\201\\R\020s\022\337\312KT\366*"
+	.ascii	"2$^\221\024\354\343\364\253\210\204\252n\026\247fT\037\355\316"
+	.ascii	"{\206\247\007\2504o\203W\377R\270\020\253\360\233\220\t\314'"
+	.ascii	"\n\017\006\204u\315k\252D\034\364\200\207\006\225EYW\275u\347"
+	.ascii	"\356\334\213!\212\375yOI\214\314L\217\233\225\253\233\032\372"
+	.ascii	"\270\\\200\274\013\321:V\271a\343\253h*\242<`\032\247\310\247"
+	.ascii	"\030\241\007\350\234 \027@\236d\356S\b\305%\371X\2730\323s\230"
+	.ascii	"\272\004\373v\364f\2563\313.\177\216\036l\313z1r\223\363%\237"
+	.ascii	"\343\360\310@n\200\bf\250\343\026\241"
+	.string	"\205\037\327\324\307\f\256\323\020\023\261\354%+\355\320\313D\342\304\330\"L\275\306[@,\363\357+\271\206\203\244\355\024\225\021/x\276\"[\374\352(\261u\260\375\223n\352\323\356\245w\277'e\353\216\362\024\301\342\2024z\255\023\267\210$\202,\341\246\310w\n\031\034\235D\315\230q)\210y \357\275M\227D!\2616\022\275\321\215\351\265\344+iz\332\002\363\213\350t\331]C\320\353\262}r%{\274\334X~\235\254-\222/\341B\207R)]-\334\330\335\2549Y]Z]\330\270\333\274_\017\270o\300\305\361\032\355\246\262rQ*\202B\016\370\fdk\"ja\214\351\003/\305z\364\2222\030\376>H\3357\250$!\226\255\342\307\262\365\2637\344\322u\314\3339\\\362LAN\271\364\335\310\347\261\307\200\337\343\316\363\215\275\336\177\201\250\323\365\302\177(h\312\333\234\023\344A\377`\373\016\274\001\276\222\333"
+	.ascii	"\340\300\333\305|\376\256\337\276\361\334+\340\306\217\022\274"
+	.ascii	"T\271\f\226\007!\017\375z\330\314\277\277S\003"
+	.text
+	.section	.gnu.lto_.symtab.20d04d4eec7115ec,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.20d04d4eec7115ec,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
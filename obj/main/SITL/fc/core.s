@@ -0,0 +1,3753 @@
+	.file	"core.c"
+	.section	.gnu.lto_.profile.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`w\004\335\025"
+	.string	"t\032k\005"
+	.string	"B"
+	.string	"\336\224\344V\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\210\301\237\216\017\026\002\006\002\007\b\002\b\002"
+	.string	"\002\t\n\002\n\002\001\002\013\r\240\342\234\212\n\020\253\306\274\244\016"
+	.string	"\021\306\254\357\313\f\004\022\350\326\320\274\b\b\001\002\f\002\001\002\r\025\271\345\223\310\007\020\016\002\016\002\002\002\017\002\002\017\027\032\353\312\237\224\r\001\002\002\002\017\035\261\356\305\342\r\016\002\001\002\021"
+	.string	"\001\002\022\002\001\002\023\037 #\204\210\201\320\013\016\002\024\020\024\002\024$%\250\200\234\374\004"
+	.string	"&\267\226\235\323\002\017'\206\361\336\202\002\002(\322\261\355\375\007\"\025\002\025\002\026\001\027\016\002\016)*+,/012\233\304\365\321\002\0023\214\233\312\236\002\0024\326\353\241\235\017\006\0015\234\275\245\363\f0\001\002\030"
+	.string	"\002\006\002\03178:\311\202\342\200\017\022;\376\336\373\325\016\n<\266\231\367\251\004\b\002\001\002\t=\315\347\335\233\n"
+	.string	">\304\306\257\225\005\f\001\002\023\001\002\023?\227\254\370\323\004\244\001\005\004\002\030\032\002\032\001\001"
+	.string	"\025\002\025@ACD\234\361\365\241\r"
+	.string	"E\350\300\306\254\005F\214\331\320\334\n\025\002\025G\212\312\215\322\016\004HI\377\264\301\240\006\nJL\276\276\271\247\fM\277\270\330\226\rN\314\345\244\232\005"
+	.string	"O\305\271\300\245\016PQ\354\206\342\366\006\002R\342\201\222\246\004ST\252\257\370\340\n\002U\202\321\330\342\013V\346\270\272\264\006WXY\264\264\266\260\r"
+	.string	"\200\210\250\2219!$e\223$\231\306P\2021%u\346\001\021\340P\244 \243\232\3124\007)\302\240h\020\021\320\035jbi|\371\271p\231\"\027\223hpk\310\240\304\003\017d(de$\213=\350\221\323\005\036\313\317\311+\242MB\021\273\030\002\361\376\262\226/\177\022G/=\207\210\330_\375\337\373TI\\{\324\374\374\305\261\236\374\206\177\234VU\342\217\335[\233\356(\002\006\305T\211g\013\204\336b\276*\205\2046Nv\360\266\350\266\371\220u!\032S~\277C\037\217~\322W\003^*?\315DY=\241(\0226\no\"t|\226\317\024\251\314\264\375\354\325\"\350\235\323\230\265\362Sh\031\3662:\211\254\035Cg\320%\306\314\023g90\322\204*37\nZ"
+	.ascii	"I\237\022\353\257\026\374a\013\366\372\354\352\200\004\371C~"
+	.ascii	"N\373q\227.\277\363eL`\261k\370\237\274\236\026\333Gt\335\367"
+	.ascii	"jv$\200\235-@\023/\215/\206\20396|\375\202.\036"
+	.text
+	.section	.gnu.lto_.ipa_sra.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\303\001\365\006"
+	.string	"b\207\025\036\200M\206\00330\00330\363v\013"
+	.ascii	"b\237>\002&\236\004\332lP\356\311o\321\345N)N\317v&gn\246F\317"
+	.ascii	"`\346eZ\266\262OQU{2%\312\031\361A\036;fc\031\373\342\025{\002"
+	.ascii	"\261\207\r\005\302z\360\013\324\200:@\177RiF\320\272T\237P\250"
+	.ascii	"\360R\244\351\260\002\251\252\252\003\0208E\306\3066\315\001"
+	.ascii	"1nX$:\356@Hr#\244;:\253\n\267\r\226;$8\035\275\334\261\342\f"
+	.ascii	"F]v\016\3444+O\337\204\302\245\rd\272\372\353\241S-\b|\220HK"
+	.ascii	"\316\352\347\007\364\254;\303g\243\257\322(\304\251\365;\251"
+	.ascii	"\204\254\203N\233\307\323g\022\341\362M^\260\247\020\264\233"
+	.ascii	"u#\262V\313R\214u\306\244&dj\006vn\033i\326H\005\236\263\276"
+	.ascii	"\030"
+	.text
+	.section	.gnu.lto_.inline.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`{\013\315\035"
+	.string	"v^tJ\240\324U:\254\237-\373\346\033\007\355p\003\211~\203\332\331\022\322/n\315\022\264\243\003`dr\321\210{\002,\327\330\2439^\216;\003o\352\027\360[\244g&0\344\335)\374\373$\210a\317\263I\330TJ\245K\267\274\267\224)`"
+	.string	"`"
+	.string	"_"
+	.ascii	"\tf\347v\362\307\313Y\371!R\341\003\273\001\327\326h\3567<\212"
+	.ascii	"%A\r\255@\360\023\032\365\365vI\036\350\226F_\313\t\230lJ\001"
+	.ascii	"\335Xp\243DU:I\226\233\004\340\030\335\035\303?\2651\214\356"
+	.ascii	"\226\275\265K\371L\343\356\356\325O\202\342X6\365`\370_\033-"
+	.ascii	"B\366\354\034\374*/1\021\246"
+	.string	"\200G\250\261\230\206\020\331\303z\013\215\326C\260Q =\252 38\352\364C\016\037\274LwS\344L\341\245`1\210\301Y>\202\203+\377\236\370\001\\\345\337\345\351\356\024\034\347|Q\305Wm\260\377\326\254\376\033\003\241~\370X\034\032\346\201D\252jw\374\365\246\300\251\024N1\256\342YB\001{2+\024.q>\245\241I!\345\2212U\013\224GD\210\004!\2048\025\345\362\027\005[\343\256p\243BG\242\361\305\350H4\302N\241\200\215n\323\344\023\376]S\2060\207\021\331\220\247\324\211\335\345\263\223\277\365!X\330=\223m\f\364Q!-\016\375\217\302\373=\275\261\221RP\361\312K8\t\377\340\201?\323\201\303\213\224v\220\016p\217\233\251\344\353\033>;gL\335]rvw\353\032\\\317`\343\027C\335=\3402\335\302fG\347\362a\001\364\323:\206\375\326\024\207\234Gb:\200O>Y\215\271"
+	.ascii	"c\363\331\271\337Z\253\b>Z6\345\324\263N\343\334\352\307\321"
+	.ascii	"\031\303\335SM\2525\\\0047\200\350\250\021\262\021\031)I\222"
+	.ascii	"Ra8`\"\"Uc\365\022\200!\201\004)!\n2G\034)##3\"%I\n3\006@o\221"
+	.ascii	"\326\252\3049\241\312\237T\340\220\266"
+	.string	"vI\313Y\0312\333\304n\027\\\264\216\3174\232\203\316\350F\300\351\342\030c\315\251\254\270FM\211\325\231\261\363D\277z\331%W\204\224y\337\340\b\033\025\211\241'\240\240\234\244\\V\272~6\004oT\312GQ\266i\3544l\035~\023\203\320\006\213g\260\021i\024X\233\305\341Ip\277\261\177'\t\304\224Q\352[\204\nmA\207\302\214\277\306\255\270T|7\035\235\235\342\255s\332\244\207\375\202\350Gx\372\367\275\335>\215(\252\304\202\223\3372D(\340\037\343q\273\256\277\261~1\263\376\026\376^\213\325Jt{W\216YnE4v\240\213u\332m\212vYC\002xJ\351;U\035\204\026\025\013\225f\037\254\020o\265\"^\006\317xa\324\032\253g\034$\0354\007\204:\336/R\252\202r\235I\307\372F\244\323f\322@\215n\031\251\243Hx\320\b6\033B#\222\355B\206\215\257\313\225\252%E\024"
+	.ascii	"*\354\032\320\032\200\216\314\220\257\205j\304\036:2\016-\261"
+	.ascii	"\256\257G\233\203\327\330\351\376(\312\201\307\377(\223m\377"
+	.ascii	"\177\260_\022\273\375\255\202\f\376\030\224\302\207\271Dh\255"
+	.ascii	"\231\352O?\314b\223@\270LV\273\251J\254\327^\036\256\376\271"
+	.ascii	"\026<\fg\273D\212f\347\225\030\037\362\212\201\241+-_@\212\207"
+	.ascii	"\370\030\204{\370W\372$\253h2n\350BB\322\016*\274w(nd\"a\\\210"
+	.ascii	"\377\226\331\340\256\3771\020\212\254\353\013!\327JM\234jj\305"
+	.ascii	"\005\310\260\236\377\017\310\031kM\370\026\370\036\n\275\273"
+	.ascii	"\344\257\221)A\0170\354U\001\301\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\202\n\225\033"
+	.string	"v\035^@ s\222\016\207\205C!\241b\2075\353\275_$\245\344<a*\0230"
+	.string	"0\243\202\334\3745"
+	.string	" \001`D\244\0201\255\365\036aA\003\022\274ii\247\205\203\355\330@a\255\375\336V\266\335RJ\001G"
+	.string	"L"
+	.string	"O"
+	.string	"\216qb1M\231~+\374)(F\177\362\035\313r&\374\013h+\215F\243Qa{}\233j[9\300C\376k\377!!\"\".\341\353\3020?"
+	.ascii	"\366\337\232s\2260\265\325\264n\031\211[\346\222\370\345\337"
+	.ascii	"\366\352\006D\031d\261\213\261\266\0056\233\013\256\344oC\022"
+	.ascii	"y7\304\341;\340v%\311\020\224o=9\304\330\004\332N6\f\2121R\224"
+	.ascii	"_B\226f\231?iY\316Y\206\377\030\243?\036\217\203\341\234\210"
+	.ascii	"\303\361\313\027\226\3252Mv\341\030\253\312\257E\215\307\357"
+	.ascii	"\227\247x\261J\376\017\251\360\357\211\341\177\207\377i\372\261"
+	.ascii	"L\222t\264pD\376\025\212k8\002\004\316\203\221\021\007\265\334"
+	.ascii	"\311\272\2237\212\3376h\013\337Z\347@p\300\235A\303'\362\257"
+	.ascii	"\030\234,h\253\240M"
+	.string	"\320L\306\304$\223#2P,m?\264\036\332\016-\207vC)\352\0322\264\030\332\013\255,\264\202q\3307\354\322\032\3466\205\366\265\235\020\243s%%\017](\374;\210\177Ir\016\bT\311d\340\212F\343\227\376\341\377e\363\321\032\006\343\327\222\322\222\222=\374&\022\211\310\007\201+\2501mF\304 \311\260\031\301\005\204(\306\024\232\007\022\340A\272\020\246\0202\310L\321\314\246T\330\230\003N[\237;Mht\361:F\244@\027t\230\207KK7t!\325\t6\335<q\250\240r\370>;\336\342\320\034d\016\003\030/\241N\023J\313\253\276u\274e\3600\0213\255\351\331(q\023~\303\240O(H\306\350\225\215!D\321j\235G&w\r\377\023\234\225\340\021\031*\351X\242\206\211C\212\317\026\315\356\341\224\020\016\251U\362\235;\342\316\371\036\\\373\310'}\330A\360fs]\326\375[-\2555\263"
+	.string	""
+	.string	"|r\317&\\1>d=!\243\250s\212\305\277\345\337\377\312\210\367\024]\376\2119\271\226\273H\372!\313\245\206\"\211\324\013\375\210wM\367m\005\037\f9\306\254#k\225\233.wJ\200\270R\256D#\t\016\035P\233\217( \324\370\326hxf\236\245\020E,G/A\360s\033\310\217[\312(t\324D\364q9~\213\002\300\364\376C2t\355SdV\351\241\2106\253\253\3562\252(\253\262\216\334\327+w\027m(\220\t\327\023\372s\r\377\213\312\246\315\324\301P\3619\330\247\026\203\024\367M\336\234d9\312&}?\373\320a \371\017\365\031\250#\037!\021Mj\334\265\377\3236\335\004\006\214\304\205\001\306\367\252\271\270\351\365\225\327\277\3438\025b\315j\203\202zZ\232"
+	.string	"*\233\356\374^#\nJ\356(\224\344\331\270\363o\317edb\204\351\033\210\232E\353/\2117k\312v7\377\\\223\242+\216J[\355 C\244\213\033\322X\230T\024\266a\360\304\020rh?\314\373F\316\240)c\354@\2734&\306\254L\007\372E\216P"
+	.ascii	"d_:\222k\003'\360\245'\257\304\340c\350$\222\260\336\330uU\020"
+	.ascii	"\272o\0247\273\321V\266z))W\273\007"
+	.text
+	.section	.gnu.lto_.pureconst.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 t\275\002"
+	.string	"B\307\024\032p9\f\007\250C\377_U\214]\036Tt\036\356M\305?RCH\013x\330\001N\344!\007r\037\347\361\216s\334\306i<\343\030\2778\213W\\\024\237\270\304E\034\342\017wx\303\031\276p\205'\034\341\312\017n\360\202\023|\340\022x\300\005\360\244RJ\243"
+	.text
+	.section	.gnu.lto_.ipa_modref.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\233\001]\b"
+	.string	"\002\314 \"`wi\fH\020\004\001\001"
+	.string	""
+	.string	""
+	.string	"\350\362\304\3276\354z(i\206\240\033JC\337\350?\264\336\337R\246\2770\246\030('\233\274d\222\021\221! \377\350qa\351\030\240\"\216\372\314\362\313\2126jdd\246\031\212KXL#\026*L@X\007\232\251\246\302`\212\325\304Jb\032\0011"
+	.ascii	"\025|\004\007~Xa\246\230\225\303\364\263\362L=\253\316\264S\r"
+	.ascii	"S\206]^\340\342L9\253\315t\263-\315\245\004< p\0022te\007\263"
+	.ascii	"AD\355<z\322\221\205r*h\330pY\223-\243\273n\373\235D\343\356"
+	.ascii	"_\302E\b\312\221\227\037\311\212\027\301\213RF\264r5\340P\020"
+	.ascii	"\004\375F_w4\276@\267\227[\002\272\016\364\003D\233[#\302\305"
+	.ascii	"\360!hC!\031\246\343\352\026v1\bQ\b)\013(\222\001\271\246a\177"
+	.ascii	"x'Y\270J\203\204\341k\347\310\330\322)\307\346\320\352\211'd"
+	.ascii	"\313\242\220\350\3738\240\236\207[\360!"
+	.text
+	.section	.gnu.lto_.lto.92b24249a2732d7d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_osdLaunchControlModeNames.134.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bX"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\255\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'*\206\b{\270\355Ry\276'5\206\bw\330\354\002u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005FULL"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\nPITCHONLY"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.138.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\bi"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\303\357\322\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\355\030us\367\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001'?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.140.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_isCalibrating.141.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`g\002\215\020"
+	.string	"6\335fE"
+	.string	"\2216\035sd\233\314:\263#\244;J\201c\363rU\211\021\241z\025\217D'\217\330=\"\326 c4\373\357)\b\337\262\211\202 \226IwUUQD\340\033\263j\326B\004\353\030i\333n\"B\266\2242\005W"
+	.string	"M"
+	.string	"R"
+	.string	"\031vY\221\327s\305<\"*\004\313\027~4#M[$\360\242\005\206\276\200\246\310QZ\371\024\005jX\r\005\222d/ I"
+	.string	"\024\230a1\005\225\3505\262F#\033e(\262\260\314\205\242\330\321\335*B\227\024\206v1\217\356\376~\341\005\375\206\376_\361_\300\277\t\002\2372\247\202Y\211\370\363\247>\313\247_y\3169\317(\377\367\232\335\313\357\267\357\265\357\263\357\261\357\255\357\343^\001p\030\\6\263\2734i\364\312J\361\341\277\310/\177"
+	.string	"\201\310=\232\362P\302F\\\214L\304\350Nu\334A=\232\221\233\026\031\353\006\260\2733,b\314\251f\254Iwc|\322U\265\304\270\\\026o\n\003\213\325d\022\342\217j\252\273\255\310 \033\231S\305twG>\215\320\345U\321\366\367 \254~\313\003H0\253\220\362=\227\262\246\344\244\004\013\321\312\370\265\252\023\256\237B\205\325\347l>:\036\247\343\200t\016B\0244\3508\235\b\335\206\343\336\203\217N'\301\363:\235L\265\306f\224\257,\240{\031P\311\244\377\032\356"
+	.string	"q\350\2225\254'F5@;\257\230Q\020+\037\007\271\361\246,\330XMg9iAb\3232\2159\024\241\252\230sj\031\257JH8 "
+	.ascii	"\003!)\323\001\20624\307\214WqI20\354\f\333iY\233\227\272\357"
+	.ascii	"f\355w*\320N\226\261\371\326\233\335\242\255i\027\027\004c\323"
+	.ascii	"\366\236\354\324\226{\017r\335z\36565\243\260\307\316\2431\035"
+	.ascii	"\023\347a\037\330\017T\276\206 \215\204\334JnX~\267\230\334\212"
+	.ascii	"\025f\035sS\356h\f\221\242\031\332\314\316(\322\225o\237c\320"
+	.ascii	"F\357\306&\3002"
+	.text
+	.section	.gnu.lto_canUseLaunchControl.142.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\013\002\335\020"
+	.string	"\206^nH\360\260(\035\270w\227s9\030\305U\327\027\354+\355\277&-x\217\237\260\005E3\374\326\260\345\247\33116\275\375\177\251\032\371\235\350\276\276\325H\310m\"sI\\\261R,\01777X\213N\214\211|B\310\336[J\231\002["
+	.string	"R"
+	.string	"`"
+	.string	"\243\355x\035G\247l\036}I\333\221\037,.4x`t\260\2610\254\025\366N*\334\201\343\t\206\325b\356\033Q\322\243\326\2721X-\246`\312\210\201\347\226VV\202\343\005n\371aK\221\343\033O\322\263zImlY5\232\230\271\220Z\35395f\330\177\373\237\304\177\003?\027\b'\316\371\344\277\202\005\336\324\366\306\266\233aSql\246&\3752\022\267\353_Y\273\345?\337c~w>w>=\177\236/\317\357\363\227"
+	.string	"\005\326\r\216\005\267ZW7\035\2656U|\370\217\362\177G\220"
+	.string	"\345\243\225\275V\353\242B\225\270\251U\026\266\313\006\036\347Q\271\006i#"
+	.string	"\310"
+	.string	"\201\352h\367\013\t\355}\301\301\324\244\365TN\260\340&\310\002\026D\377\007%\274\251\331\001T\"\006\3006\300\250\354P\207\017\254\t\375E\t\274)\331\240*D\355\244\240v\0036\333\265\275\203\246\305\n\331\256\230\355\016\235t\2034Xm_96\024\375\021\335v S#\377\200\200D\342'\374\204B\b%$&\341Gt\022\202x.F"
+	.ascii	"\211\302\t\242(\n?Y]Y\273\345\264\3465\233\221\033\263\033[\006"
+	.ascii	"5,\263\031owD\275N\371\357\365CJm\352\264\353\"\264\353\220\f"
+	.ascii	"\215\357lM\210|=\274\301\310\374\216\320\235]s44\234V\211o\247"
+	.ascii	"6-S+ \300\002\2311\343\006\305\b\355(\031\236\237\2334&\320H"
+	.ascii	"\204\216 \274oa\332\230\255-\272|\223\366\222\264\323\352\233"
+	.ascii	"\211X\333\362\006l\207~\334\337\334\003{\030\3522\252\205\"\230"
+	.ascii	"\017a\372\3033\r\3070\003\216[\220\322\367\221\024?`\371\246"
+	.ascii	"h\324\035&\243\355)\355*j{\230\256:\004\024"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.143.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 \341\035\006"
+	.string	"\362\n*4`k\323\001\320:\276 \224\316@-(\020.\337\240\370\242\006\004\365,\326\2024\036\034\267\377\376\221&\267"
+	.string	"\016\260"
+	.string	"\300\301Y\341\310a)d\320O\376\336)\005\236\322T\351\2243#9\032\314F\316\n %\211ig\2522\200\322*#n\037\265\013\205g\305\001S\3563\274\301\021\376f\001w\360\327\037\337\335\343\017d!\241\220a\301\317\346*\030\r\354;6jv\214LTT0v\261oc\275\007\"\301\366#S\366\3059\204\375\303F\340\240\261\2732\036\234:\244\374/\034re\325!d\331]\303++\270\343'\266\261\t"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270tc\266\266\353"
+	.ascii	"\264"
+	.text
+	.section	.gnu.lto_accNeedsCalibration.144.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`i\003\355\025"
+	.string	"\246\246\213K\300\322Q:\210$\225\365\375\217\372\373x\240\241\233\317\203\343\003\373\274\370\tah7\033B\346+X`\237\231\306rk\373S\013\333*$\314\315\246\277\235\030S\024\034\205\240\250P~I\362\277Y\206\267X(\233\221F\b!\204H)S|"
+	.string	"i"
+	.string	"~"
+	.ascii	"\265\366X}ba;\222\256Th\3524Kr\024\233a\337\330\216\210':\034"
+	.ascii	" r\224\360\261A\270\034NMj\255:^\251\034\300\210z!\334\261\311"
+	.ascii	"Y\224Dj\304"
+	.string	")\302\\\035\270\233\262FrX\336\022\b\302\341\360\2702\235\025\305\001<:\3024\267A4Q\002\326\320\034\215[<\t\036\tIs4\221\344\366c[\336rMn\306\\\246\324Z\317\266\234\315\036\300\376[\362\277\300\337%\001\235\332\030\002g\353\003\0254\352\303\310m\t1z\320\030\352%\363\276\220?\206\f\274\266\355\345\255\311cHO\030\244u\354\357\305\270{\376\025k\363\374\347\253\232\2172?u\376y\276y~y>y\376x\276x~\363W\300~\300=\001a\300T\353m\030U\201\343\017\350\377\376\247\371\321'P@s\330\366|ne\315EM\306S\302 \r\027b\267\372\021\322\214\016\252#\036\355\006jv\214.\210\001\263S\037\217MD\265H\225-\243\373\261*;\365\t\211J\274\333I\266\006\235S\212\354\324\307\342\374\321\230\231c\313\350\232\312\261S\337\n`\200\245%\247R\354\030\335\016\026;\365\251"
+	.ascii	"\322:\266\b\200p<\220\235\362.\013\371Sh\341\265u\303\020\251"
+	.ascii	"\377\325\310\211\215\335\263\375\263\023z\022\273gh\271_)\376"
+	.ascii	"]\\\2746\016o\241\260\274\\-Vk\002\313B\313\212\013\253\365z"
+	.ascii	"a\241\220\334u\201\345\305\202q\271^,\264WW\254\315\363\222\211"
+	.ascii	"\210H\265\274m\320TD\344\023whU]\363_\325O\221\365ldUH\264U;"
+	.ascii	"\377\203ER1k\255\013\276\277\n\020\314\335\f\271#\332\347\220"
+	.ascii	"\214\207\377\372\326h\346\273{\204\225\361\273B\356\230\352M"
+	.ascii	"Bq#\343\341\276\250&)=\373u\340l\230\")\002H\250QD\201A\036I"
+	.ascii	"\325\344HiA\216\001\340\002\021)\252\016\020@Tc\363\303\310\216"
+	.ascii	"\203\210Io\023,U\200\347\177\211\367\205\033\001L\005j\253N`"
+	.ascii	"?\364\3403\351\335\325 \324\342 \032!\r^\203\363\366B[\371\001"
+	.ascii	"\302\336\331M\035]bk7\2005\005A]\313\241\247)j\017\255\273R\342"
+	.ascii	"K\2553\243\232)\2640\211\005\3713\342\332\333\004K\202\234X\314"
+	.ascii	"\354\363Y\\\261\275\240\362\310\222H4h\271e`$\344\207\016\273"
+	.ascii	"N\025"
+	.text
+	.section	.gnu.lto_updateArmingStatus.145.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\035\t"
+	.string	"v\021?7P\215\322\001\004\353\350N\277\213\201jj\304\020\223\226\235\004\342jA\316&\035\304-\236\315\024\307\016\026!\370a\003\241\252<\022\252\333\001@\273-\323[\263d\023)S\n."
+	.string	"."
+	.string	"/"
+	.string	"\377\374\322\374\370G\035\300\373@\277.\023\327+C\312\360\002\276\356\032"
+	.string	"AR\216zF|\242L\013\301\356:\275O\342\216\267]`[\3006I\252.\325\302\276\206a\030ZM\366\323\361\351c_\201,\024\203\223]R\270\262\"1D\303\3661\376\330&W\235\366\036\024\243\016\326\356fz\021?\265\300\017\265\006\213z\324/#\034%\242l\371\327`\327\250\316Q\251{\352\033\017>\206!<y\357\321\367`\217\327\215\211U\221*\2052\264\003\3266\034n\3232\r![H8P\3104\256\223m2\336\0308\\\326\260m\\\206Q\205~\255\232\034W\240\n\030\322\356\332\335\275,iw\034\362\236UA\001\016"
+	.ascii	"3\241\335/FV\301\301\025@\265\017RX\304\205\017\341jTxv\031\345"
+	.ascii	"e\bq\351\242j\207\006\246\240"
+	.text
+	.section	.gnu.lto_disarm.146.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`E\001-\r"
+	.string	"f\030UA0o\223\016\004\3030N\370[[\f5\362w\306\211\262}\224aPYM\245\b\246\3234\034\216ad\033\356\b\320o\374\"T\362\026\005,\f\fa\244\020\347\303\031-zbV\322\324\332\336[\312\224\002A"
+	.string	"?"
+	.string	"D"
+	.ascii	"\266\312#\311>E\205\b\004\313\356R\252\341\330\341s\232\230\177"
+	.ascii	"\331H\332\3669\024\360W\341n\332\034\304g"
+	.string	"\204-\224\n`{\3408v\367\243'\204-\313\274lv\327\251m\023\356\313m#\260]\300>IV\fv\2463?\371\245L?M\273L\177\372Jdq\3219\261+\241e\306\242x%6\330\217\366\364\311\366\323\276\207\233`?i`i\367B\n\211\335h\300\0040\177\034\327\200\177\356\001\340\237\261!.B\304\372\370\320\307\0170\001\243C\356\356G\275\0013\372\3211)PV\204R\206\377\rx\315\250S4\222\375\303Q<~\211\031\204\344\265??\004\376]5\034J,\230\214\200\262\305\216Yj\006\373nw7\035\313\323\301\271\240+\r\347\262*\252:@u\022txP\325\345\2414\032\266\026p.\n\304\262.j\212\240\257\304\030-@\232\301)%\265\025x\3445\177\364MH?\357\351\210k/\362)\210\n\013\021\205\354N\004:\275\374! \220\002\231\261\363\001B\3009\334\221\260\336`x\354ml\001("
+	.ascii	"\b\026\260P\354X6\221\337\030g\033\2260\244\265\302\024\003j"
+	.ascii	"J\326\305\306\nb\205 \261p5\033\336\331\006\026\203\023\237+"
+	.ascii	"\202F\216p\270\271\215:o.\t\343\326>="
+	.text
+	.section	.gnu.lto_tryArm.147.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\375\003\375\032"
+	.string	"\026\360\250I\240XU:\200wm@\203F4h\336\201j\215\217^v\240\256\025\274\t\20252\305\377})\021\333 /nX\336\244\230\326ZY\3036[q}\372\350z^\016^d\255 \262\266/\255\301\325\334&\331V\302\366&R&\031\225"
+	.string	"\210"
+	.string	"\227"
+	.string	"\373\243\003S\374\267\315C$J\357WkU}\356\246\330U}\216\252\235\355Ry\360F\375\022\360\226\244\245\326\352\352\240\317\016\243J\241\310\027:\307\346\331>\245\3439LM\r\037\336U\303\034\217('\203S\302\232a.\006\243N\343\235\034\t"
+	.string	"\315 ~\230\333\215\255&\345\355=^C\224\343\361\013Q\356\247\205\356\306\024\306\247\214N\305\221V\360\370\342=\"\260\302\224EFg\033Y=9p7:\263\320\325\230_lj\255\3138\235\3177\346\273[\356\256\203\335^\022\037\"\202\254\325\306`\037\344Br\3668>7V\202\217+A?\271ot\026\002\322\350\035\001i\\\334\r\326\270}\273\357b\261X\334\006\332\245\2743\315\313\272\322w\325\2741\2247EyQ\223\227\034yi\363\316\221\267\233\227\233\367\002^d\250\307\023\342\321P\202\265\247\310\245\226\023\211\320\225~\341\252\366?\2364\273\322:\265l\301\252K\331\370)\177\t>\267"
+	.string	"\371\331:\213~\216\007@\377{\360H(\376\333\t\034B\261\001g\362&\353Ta\233\266\211~\036x\003>O\277\336\017\013\215\213\250\265\260\341F\267\251\005%y\"$\333\207\344'\2570}\366\225\314~\217\037\b\202B\334\321\270\310JT\364\f\275\234\240=\303\273\0302\360qMJ!\226D+\265\346\241\001x\217\244aCO\032\032C\016\177\032\312\352\230^\276\355j_\372\021\016{\034\333\341\365\242\237\254>\3229\007\220\226\336\321n\224a\005\337\205\205\340\343\026\306\211\213\322\326<\277\261\305\312\221n\337\212\240\334\036|L\261\361\226\335\305\t:\261\235\027\354\302\007\330\b\017\257\035\234\b!tprd\257"
+	.string	"{\263"
+	.ascii	"&\213\335\270n@\270tp^9\256\033\331\216k\001kc$`2\227\211XL\346"
+	.ascii	"R\005i\267\241um\254\265V\230\002<\323\273\263\242\231\221\360"
+	.string	"+ OL\345\252gz\031we\325\303\357\370Y*\032@#\b\244j\337\252S\375\032\345\354h\233R\375\035?F\210\273\026\243z\367\001\004z\334\252[d\243z&\335\272\320\360\256\204\t|\034\331\027\236U>\025\225\r\312*:R\355s:m\031\005\372\236\025:\206\022|\003U\250a\034%\225S\314\314H0\022\204$i\341p\002\031\2713\017\020P\347f[h\f\362\240>\216[\002\333\020/g\262H z\220\337\277N\275\371Cs\327\025\001Oy$\250@:Ab1\370\034s\203D\270\b\310\251F\232\206\357+\363\301\271!H\251\323\306\213@O\317\240\303\323\365\023G]\241cZ\237\031\237\246\342\216\022H\347\333]\326\376\307w=\331\271\371\001 \037\214\257i\366T\235\334\226\376\336\330\204\031_\n\360<\002#\177\021!\347\262\307Q\2221\036\322h\370\261\r\243\263M\375\270(1\265\020\300\330\206\262"
+	.ascii	"\370\201.\214\217\231\345\247e\243\377,x\2125j"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.153.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`M\001\355\f"
+	.string	"\306\225O@0O\224\016"
+	.string	"\032D\260\027\207k9\264Q;\030\344\226\201\3358k\265B\210\360\360\032b\260\256\313<\330\377\311\366ap\034Vls\306\312<\f\f\3622\270\224)\237\362$8\254\237\020\262\245L):"
+	.string	";"
+	.string	"B"
+	.string	"!\273\233\251\206w~Y\025\324\354\370W\005\200\027\273_\226%\243W\023\260(!a\2008\272\n\210 X`w\017\342I!~2\257\312\356:\275h\341\226\334v\306\266\001\373\033\001\336+\177c\275\272j4!B\3720<9b\233\272\324\222}\270\232a?\r\237\316\247\217)\370 \252\020\237\301\305\256hDdS\325\t\016\266\217\271c\263\270Ic\tx\370B#\002\252'\024\007\324\022p\205\327\"\025\352C\030H<H\325\210\332 }\030PK\347X\036\020\260\023J\203\024\002\344\"~z\307\005\024! \271\273\235\232c]\021x\250"
+	.ascii	"\345\013\373\337;8\376\006G\330\344\003\326(\026n\3232-A\226"
+	.ascii	"\271\034\300d\032\247\311(\003\2741\260p\231\203m\3432\314\264"
+	.ascii	"\207\327\f\373\203#\345\321\017\274&9\371\305\262\027`\236\342"
+	.ascii	"\243C\n\264\226$\355\006\232\274g\325\356\225\226`+ \240\202"
+	.ascii	"\241\301\036b\020\201\320@Q\336e,\335\275\260\n\250\210E\225"
+	.ascii	"\367\330\031\346\274\331B\332\"k\260\200\235s6f\032dGctLB\235"
+	.ascii	"\233\fgH\367\n\306\214\306\030\\\036/R\025\306\025\367\003\364"
+	.ascii	"\303\177G\370\357\270\303\374\222F\245\352\372\325\227dg{\343"
+	.ascii	"\362\266\213\352\001"
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.154.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`f\004U\031"
+	.string	"f\352\226K\260\022R:\342\305\177\206\033\322_3\016^nc\312\351h7Km\257\371Q\300O\f\242R\257\303\224\245\317\267\372\266\177\304\037p\332\322\017q6\231\200d\007\272\243\342/k~d\277\247O\024\226\305<\265\355Y\373\311&D\312$\003\207"
+	.string	"q"
+	.string	"\201"
+	.ascii	"\265fK\253\342(\241L\354\356\317\235\331\255\022@Sq\bN\330\340"
+	.ascii	"\265\300\252\265\322\232\304g\0162\223\305N\330\313e\322\222"
+	.ascii	"l\236\331\277z>\334AfA\226\365\360p\314D!\361\271\351\371I\342"
+	.ascii	"s\243sX\016\277\206lt\200\354\322a\263C2d\363cS\304)\357\003"
+	.ascii	"\227d\211\325\323Q\244\246D\357\364\3210y\372v\3343\037\217$"
+	.ascii	"Pk}\321\031\204O\307l\242\324Z\227{\276\233/\200\357^dw\r\354"
+	.ascii	"\222\005\002\375\242\303P\374#\224;\244\227y?\335\225\276\002"
+	.ascii	"\003\214\315F_r\237\024\317\265V\\\257\f}\263\020\251v\354c\367"
+	.ascii	"\303\037\311\354\203vC\f\277\367r\037C_\276\333\027C+8\374\345"
+	.ascii	"xk7I\307-\334=Y\373g\227yC\230Wv\336\330y\317\363\302\316\373"
+	.ascii	":\257\213\3445K^\312\274%\311K6o3/\237\367\003\\\2165!|\347\271"
+	.ascii	"\252\001\273"
+	.string	"\306\231-\234\361\034\240\021\353\300S\350^\306\237R\036\250\250\320\227\035\200F\"#m\341\036\351\256\236U\021\251\002\360\036\002\335\215 \201\337s\265\2114b\327\270.\tF\341\224-\\\263\311\216\371\020\245v\354ci\233\023\336D\301U\353\356d\377\3420*XXY\241/i\177\n\350\250\233\354\363~\344vM\356\242\346\252\265&\330/\235\251e\037\364r]^^\350\313\3567\025\241r\274\305'GhH[3i\271\331j\264\332\005Z\206\227\025\030Z\355\026C3\021Y\233\206\226\033\215\203\315v\243\235I\271\367\017\003$\241,\253\\\353@Zx\343=\026(9M\005\215\2149\336\342q\004\324\"\232\265\220\305\313S\005\261H\274\254\313\035\262>SQ\026k\0179b]\342\234\214\202\303_\3542T\352;\300+\"\343\331B\250G\035\007x\3042nR\255\025v6W\325hp6\r\350\005\353\033\r\007\260V"
+	.ascii	"<\246X\327\253Yd\257\216-\r\205\262\254\002f\250q<d\221r\202"
+	.ascii	"*)H\212R\351\240\002\03113\017\020Xd4b\230\326C\271\t\223\322"
+	.ascii	"\273\236\317I\tC\304#\322\363\016t\310\220\b\0319\305\274\237"
+	.ascii	"2\204EPiE!\310\200z\323\330\362\022\035\301\240\220\205\272J"
+	.ascii	"\302h{\230\206g\274\373\207ji-\256\245SH\300\203\031&\217\354"
+	.ascii	"i\217\323\223Hb\364k\025\265\252\016\257\202/\350\326\373,\251"
+	.ascii	"\332E\021\271\343\261\242\331j+\257\002i\202\272\345\370|\373"
+	.ascii	"~t$\321ZF\016\312\262g\227\202\255\216\031)\226!\374\013\n\347"
+	.ascii	"S\360A4\230\332\364)\364\356]Z\270>\275\360\316\253\353\230\351"
+	.ascii	"\307xs S;\036\245l\261{d@\326oG\037(q\001<+Zq3\375\017"
+	.text
+	.section	.gnu.lto_updateMagHold.155.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\372\005\255#"
+	.string	"j@\274\rH\220XR\007E\362\n\213`\235\237\"\007Y}\f+wx\276\301\222i,\251\222\246\341\005\260\234\253E|\bs\245"
+	.string	"@3\301\333\336\001\232\313\033[\223\021\020\\c\3420\326\272\347\317P\327CI\3076\273\367\226r\247\224R\277"
+	.string	"\275"
+	.string	"\314"
+	.string	"\325\031W\235o\357l\253\316hu>Kg\263:\333\322\271\226\316\345;\277;\273;w\200\034\216\025\303\256\261v/\21353\267\2542\321\321^\315\334A\270\217|\343\026\322]i{\365\372\noGU\365P\221v\357\025\320\225\217\316\2566\275c\273z\347\330\256}\343\224\031\315'\305\215\"\240\245\026,2\346\336\273{\034\235v\016w\263\241\247ik\371\236r\233L\250p\030\3259\223\tG\243o4d\270\255\330h\f"
+	.ascii	"Y-\212~\002\260\341\202\330&\361\030t\013\243+\315\020xL\341"
+	.ascii	"\345m(\345o\245\305\214\262\350\336\333\\\355S\303\237\273\311"
+	.ascii	"t\357e\027\016]4\323"
+	.string	"43\2431\263\022s\205\022f\367\336\002\311Vr!\203\006\r\266k\371}\354\272\243\370E\246\253\313V\262\266o\256\266e!\317\312V\262\377\266g\017\022\177}\244\221l\340\306\342&''\333\365\037\301\025\321\347k\355\367\336\250\177+\016\3534>\245\356\365\031\371s@\216Iy\031\356\367\357$p\214\317\327\232H\027\341\260\363\336{\200\033\331_\037\270\261\272\362S\boaW\356\020\374\344I\024\277\266\230\370|\215\371\370\363\267b\356\362~\025s\022\322\221\221\351\\D\324^\315\272\322y\250t\026r\347 w\0062\235\177Lg\037\323\271\007u\3469\235wLg\035w\316\261\3168\325\371\246:\333T\347\032\353LS\235s\0015\177\363\r\314\"z\233\242\257y\363\206QLi{+G\277\212\373\330\375\002Ll\212\211\364\\Z\335\023\375\024\227\2604\3376\220g\314\240\307\032\234\367J\025\340\216\322R\034<\200"
+	.string	"\301v\245\371.\026\215lu\371|\355\314=\322\237!\366\t\213\373\3347\220J\367\270\177c\227\240\232\317|+\266b>\352\321\353\200\211Q\225F\257\373\251\326\352\236\325i!\247Hy\231\266|\373#7\353\023\026\375\333\333n\030\251"
+	.ascii	"\251~|\274\367V\024\311\356Y\243\377!Nr \307\3207zO\006\325\316"
+	.ascii	"\267\217~\003w\230\1776i'\275\b\022\274\205\022lW\363Qb}\373"
+	.ascii	"\035T\263\365\217-\277\276\315\002\004\362\243\320Kz\003\214"
+	.ascii	"\314\025:\314\302Q\036\236:<7-9A\361\232vM\036v#\2366\210\330"
+	.ascii	"5A\225\330-\3550\217\204\023\324\316\004\217\007\265\273\035"
+	.ascii	"}]\336\257\342\363"
+	.string	"l\253\314\367\277\334\320\207i\261\026\372\241\367$\230^\322\027\013\2724\241J,&\311t=.\350\3218\254\307\350\245\205`\200>\347\203~\036\350?\0130\315\347\363?\357s\006\b\244\347u\336\347K2\236\357\371\346\321g\251V\203ii.i\217\004f]\231\323\037m\226n\235[&\244\\\006\214\367\336\306\3425?\261]y\276\301\256\272\2564\026^*$\365J\275l\327\2357pELz\235/\311\202jU\312r\036C1\311\355\255\330\321\245\326\001\212\241\235\003\272\350\247\310\032\347\241\210\234Y\301\002o!\316\203\240*\373}\024\337|\222\315\007~\250a,\004\225R\206!\231\241 IA\241\325\220\002!\0213z\020pF\303IcC\344\003hI{\372$\320mC\254)c!\224\237p\303\333`\373\0247\001G<nZ\356\240\235[?\232\234\247QLE\345\237\030\206A\235\t\024B\376\240K.\244*"
+	.string	"G\224%mIXfKt\204c\340y\026\326\332\007#\317\276x\314\373\303\001\276=\204\374[`\345\227n\343@3\302(\311e\264G\347f\246::\004\224\365\\\f0\032)\273\r^\225Y\022\347eR\3710\347\026N\030\016D\003J\261n=D\304\243\255\305c\342\r\330,Q\031\022\215\354\2060\302\213,x\323~\264\253Y\372\272\302\021\236[\344\273E\261W\007\001bo\221\306\"\207\007\033 q\333\207,\016\307\013\233\362\200Yb\364\300~\0039@u\0306>?\334\262\277\366\330"
+	.ascii	"m\366!\313\360\240\234<i\317\037j[@\214RGo\376"
+	.text
+	.section	.gnu.lto_areSticksActive.156.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\024\005u!"
+	.string	"6\276\326G\220\\Q:"
+	.string	"\272\341\032\001\305\324[\343\210\331\033\032J\024\033\006s\346:\205xE1\267\340\325\231b\303\356#/$; \274]\220\225\023&\243.\302\364\252\373-h\366\376\002\220A\036\205\266\377m\237\020BH\332I\006\307"
+	.string	"\257"
+	.string	"\304"
+	.ascii	"\276Z"
+	.string	"-Wa5\2148SUnj\255\bL.\204\323$\001\003\225&G\377\224&\275\333b7FMu\264\257\265\251\252J\255C\005k\3404\351\340A\213E\362P\310\222mJ\211R1N\255C\334\203\354=\016\2753\212d\332L\026\203\275N\263$\307S\244\265\013\323F\236\246\221\301\217\316\200\byX6N\250:2\304b\230v\214\307r\262\325Dc\005`:r\320\227I\301\207P\207O1L8\244\230nP\223\026T\032\t\024]@\212I\007-k\230\204\005kx\034\033d\365\260C\013\276\030iQ`~.\232\312\b&\321\033\313\344\017\"h\250\344\370\020\36205)\324Z\227\306\b\n\2755\357\272\266\273\025vG\251[\202G\035\303\344\232W\232\034\372\313\312G\273\026\213S\022\341\370\247\245^\255\322v\027}\340\215\026\035b\232$:\347\265V\027\377\323\356\360GMc\251H\214\275\323\356\315Tv\021\321"
+	.string	"\223\356\220IW\300\322\0252\351\006\231\211\027\310W^\333\351\376\234\256\317\351\366\234.\317\351\326N\227v\272\263\323\225\235n\354ta\247\373:\335\363t\315\323-K\272\344\351\216$\335\223t\351H\327\004HP-\315\b\232\310\231Z\227\272\352\3240\344\025#fb_\231\356z\327\304u\221\311\221+\260\262p\232Z\342\246\326\241\204\323Vk\254\215\231\\/\361\260ED?\327\354\261\323.\200\013\230D\366\331\213\264jUd\037\342\002F\375\310\300\036{"
+	.string	";@)\363\257\303\016\300\0130\252\374\370\327\205\306@\235\001F\375\302\324Z\317?\355\371\361\366a\276\374\031t\363\245\027\362\345\215\301[\032N-c\341\340\341\303\207\322$y\005i\254|\343\017\305E\351\216\207\265V\363OK\233l\261\031\207\036t\031\246\031\253(\377\036\361\313\343\330\260\212\222\3767\260\351G\273\326\247\037\313(\335\361\321\256\f\266\002\342\254\265FXg\271J\210\234NW\232\3647\344 \203\344\212\217v\215\345\bOA\3415B\244\b\270P\032:\204K\261\r\271s\024\024n\202\246\326$\b\353'\206Bb\re2\262\024\273\025!F\243]\211\235\005#\023\272\\Ow\201Dng\224\242gs\013t=^\016\227\023\2013\261\013Q\002\227\353\245\300-"
+	.ascii	"Z\336\t]\017g\304\343\365p\261\241\317wZW\371\\3\345\305I"
+	.string	"\326l\215T\272\350\027\324\324\026'Y1\033\251\024\022\372R\360\375G\373\323\316\222\310n\277\032\212\3006\005\266\235\026!\252I\242s<\326Z\353,\201m\277\335X\3560\206H\033\252\306\215\0259\262?\355\r\250\205\rl\300mM\266\356\274\326G\345\r\250\205\312It\"\240\226\246r\311\370\250\004\272\214\242\003\375WX\316\020\301\370b?\037\340\363\236\377\254\270Q\273\317\213\270\262\230\347=\343k\347\371m\f\024\034\0065+b\227\332\213\210Pm^\264\007`\250a$\306\bt\310\214\005\"2a\n\222f\fp\002\241\261\3329\020P\307\210S\030\016\252^\257\247E\007\t\201Fn2\234*o\226E\306\r\035\210b\312\321\244\327\177,\362\375\320\310;\t\341\313(\203g\200\fM3\003P\003z\021v\222:E\304\003\037\355rP\260\232\300\351\342\207\321JO(\3243\246m!c\321\301%\211\304\301\034\020\b"
+	.ascii	"\367^\204.\216W\371\353\016\316\250$j\344\001`\346\336=\357\\"
+	.ascii	"TO\324nHav\300\177\224\363\360\324\203\333\354n0\252\b\355\002"
+	.ascii	"\215\032/Pn\304\2748\350\bJ^r_\332&@d\002=\317\354\350p-{2\237"
+	.ascii	"f\013F|q\302\362K\210\370\211\030\261.\026\325\311#\324\307c"
+	.ascii	"\235\260e\250"
+	.text
+	.section	.gnu.lto_runawayTakeoffTemporaryDisable.157.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\325\007"
+	.string	"r\21777Po\322\001\240<\001\351\253\275\210'z\204\313\371X\035\006\370\020tTB\266\2725\344\260\007E\204\331\372\237@N\314,n\332:\254*\276J\240O\307\206m+eJ\001\021\327\247!\3738\\ \317\203e\254\223m\032\0261\2108\341\271$\"\266\201b\207\300\032E\266\305\nM\333\242\365\3555\253&sZVR#%\371\352\177'\271\360?l\021\312w\207~hs\370\016ft\203M\352u\200\345\024SJ!\345\312\376D\251\034\3665\253&\373\250?5}( \242\362~z\331\315X\315l\n\242\200\330\276e;\323VX\340\216\302\260\356n\250\234\354~\tF\340\034\232\263]\376ylA\210\252d\"\263\273Q;\316=9\377#\017\350<\321\023\200aw\235\235\247q\353m\037\330\216\266K\002\t"
+	.ascii	"2\241\217/\260q\361\324\f\3145|\177\bO\245\306\201;\267h\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.158.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\003\006e$"
+	.string	":Ct\016G\220\332M:\206\0300\315\215\247\245\265\336,\254P^>P\034\214M\374@\277.]\357\267\340X\344rts1\240D^h\034e\211A \020\b\252M$\307\214L\003N`Wa\271\247\0025{\333A\b\355\226\266L\001\324"
+	.string	"\275"
+	.string	"\331"
+	.ascii	"\266qZ\207N\217\343\264(N\207\341t-\234>\235\236\265\351=\200"
+	.ascii	"+\023$k\207\270\251UF)\247r\241fC\326\310z\217l\230}\363\212"
+	.ascii	"\0053\203\037Y\221\025\366m\351\332.\274_\276\255\221\026[\311"
+	.ascii	"\252\202\r\221\022M\255aLK\2554.5\202\004.<%\004\343E\232\035"
+	.ascii	"\2214+%oj\255\274\377\330\251\315\341vn6\235Q\fi\355"
+	.string	"s\312+6\220\340\013\206\271\312z\2619\234\016\036sg\307\274-\025pm\265%4Q\332\354\031\226\216\232N\206\220\253\375Z\244.\254\337\324A\032\2018\246(6\3501\003\270\241\0259\351\331-\013\306\254u\345\262\252\346\317\260r\324v\265\326\375\332\031#\3137\247\330\240\326\352y\2255c\315\263\366R\333\017l\312\025\034\346^\325\276b\316\334\330\357\211\360\367 F\246j\306q\317\334\325\355\020\332OPs\257\376\375Z\037&gjp\251\372\013\213b\200\036\364\260\r\017\2245\225p\036\350\236$\033\337,\275\237\237iVsl\247M\002b\254\265.\360\"Y1\021\336 KM\"j\356\325RoT\270t\277\300_\022/3\252Y\332a\276\371-{_\226e\351\373\260=m\200\327\304\264\264F\326J\342tR8M \234F\242\323;:=\200N\013\240\323Gt\332h\234.\242\323Dtz\210N\013\321\351"
+	.string	"t:\210N\353\3504\020\235\006@\247\177\350\264\017\235\356\241\323<t:G\247qtz\207N\337\350tFSG6\013\226\242o\225\037\231\027\330\221\262,u\210\2764t\241\023\335\b\215\f\252\300\241\373\320\233\262\220\300\251\035\001.\364\231\205\354\362\3152\300G\370\274\312zj\255\243\356+DL\213\356EZ^KD\2373}>\351y\356>72C\006y\336\363\002OV\311\362\374\350\013\356\271\027\241\221]\266\357\034\367\320\f\3115>\350;\377\321*R\222\\\276\360[\016\372\355=1,\266\217\277\235\242\221@\235\333\034\254\225\bUt\276I\200\200\211\037\277\020vJ\004\263\225\"a\002\005\n\341R\361\273\343\267\304a\265V\372-[\b\303\177\020\033cW\3302\013c\255U\n\274O\226\354\002\206\f\031\302\245\341Y\374\306\274\300\250fYk\255\265o5\331\332?"
+	.ascii	"M\335j\b\355\r\001\016\341t\"\004\212\016Q\274\022RQQROD(\240"
+	.ascii	"z\367\223\023TO\352\211\367\364\201WBD\207(\336S\357\004\317"
+	.ascii	"Ig)\023P=\036\n)\251\036\357\026F\265\265z\037\016\321l\340x"
+	.ascii	"\017\323\264\t\231\0164\266\0068.=\\3fkznl\313\034\321\333\""
+	.ascii	"Tz\f"
+	.string	"\333\006\276\243\272\317J7p\321\027\fc5\247V\233\316\273M+XF\252Q\212\203&\n\356[P6\351)\304\310\234Y\350\222\364\305\372\225\301q\023\264.Z;\004\236b\235,\201\317\2603_4\312 \031\273}k\377\203!C\210\r\351\275e\262H/\021\004\360\246\377\310|^\2260\355\317\001\334\223l\263\373\3177l\223\314\300\304\260\032c3\340\002\276\373\246\221A\243\001\037B#\271\366\312\036]\300\3054\243\007\375\350\2654\222\253\350\001r\250a$\344\020s\312\214I \"\222$i\306\260\002\2211\"z\020`dT\2335\357\231y\3551p\261\002\242\346\230\254\201%\204\245\016\030\237\252\332\273cv\007\322\375`X\346\217>\231\035\257\345\345\021KOJ\376\"\261W\230\326\216\254\013\376\217\344\003!'\005\20470\251\"W\362sf\251\261c\201\004\226\372\201\205%\336\261\307K$x#u\034\340U\223"
+	.string	"\342\222\021\003\bm\t\303\177\202!\3761M\314Ko4\035\210\236\003\264\020\332F\210\301\r\357\350\345qR\243\315\203\300#\363A'*\240a\340\226\241g }"
+	.ascii	"zq\364%n\376\254\2135LC\005Un\337g~\215\320\253m\365\f^pU\363"
+	.ascii	"\207\b4\274\237M\244\214\n7>X;\303k+\r\212\342\236X(\321\210"
+	.ascii	"\363*\006\303\210}\355\205\033\265Q\372Qt*"
+	.text
+	.section	.gnu.lto_calculateThrottlePercentAbs.159.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\235\007"
+	.string	"\202N560q\323\001 \370\305\242hz4B&\265\305\211\214\201o\024\353L\234\341\002!o\0335fG\b\3042\226\360%\002\27488\325\356b\r\003\201O\003V\262\245L)\033\020i\213\323\301.+Z\022\261b\"\202\"Z\330E\344\030\370\262\350`\021\343\272\260X\221\366\366\365\336\241L\350\243 C\275\"\270x\320|\362d\200\26434\362\033\324\217\356\320\205@\252\331$-\225\304>\\\035\261\377\335P\323\247\006^T\270{)\273!\247\2325Q,\242\177\267\217\342\217\\\375\343(X\323\022\200\230t'0\273\253p\312\033\201S\267=v\345\005\006\217\263\203\016-f\323\211>J3\273\244\250%\317\236\231\177\357\017-\336\312\306i\317\200\206\335un\234\310\255O\260]\n\n"
+	.ascii	"2\003\3020YB\330\256\211\222\230 \272 _\212r\270\313\322lx\327"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_isAirmodeActivated.161.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 \342M\006"
+	.string	"\302\313+3Pm\222\016$\307\2502\252\256[7\214\fF4\022\213\266\214n<\2055\373w;\274Vp#\b[\210\252\262 b\345\255"
+	.string	"A\025\242O\215ivo\231\002K\226\0135IMrh\021\017\r\020M\242&\232\245\340I\342B5\212i\242Z\005\313\242\347\320`\203\234/HC\325\375\\\201\271Z\215.\006\240\321\241@\306\346\262\3074\207\032_J\242\347\277\017\007J>WAYf';I\222h\244\343\317|\345\004\205\314U1\216\016\201G\310\"\304$\023k\270\321\252W\335\202\312\300\371\020\261.M/`!3?\353\302\350\330\037\341?\370/\002\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_processRx.162.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`,\004\275\034"
+	.string	"\206\266\275F\220\334Mc\016\377\036-\253\361\312\264\212\304\002w\005\027/\200!\335-Z\177IXH\002v\201\275[\320\314\334\2638$\013\335\223F\001\340}\322\026\247\016\324\335rL\n\350\372^\267\r\314\036i\266\333\336R\312\224\002\255"
+	.string	"\234"
+	.string	"\253"
+	.ascii	"A[\220\252\262&e\367\336\006\027\035\201\244\324~\223W%\335*"
+	.ascii	"\206q\356\225R\342u\257\371\300\n\310\213?\317\215\027\355\007"
+	.ascii	"\214\027m;\002\205$\373n\016q\302\t\273\232\262\312\3565uU\310"
+	.ascii	"}\277\331p\310\332(\332J}\276-\250\364\033\215\272\r\201\224"
+	.ascii	"\r\035\307I\022\366\224\203\222\226\001\031\0256\017{\322asN"
+	.ascii	"F\312'y\202\2425\3533\345\303\354\026l\262?\\\300\232><\202\260"
+	.ascii	"\247(:\342\270\310$\203\332\033\257\226A\217.7\004\004\227l\016"
+	.ascii	"L\2203\037\236\316\b\002)\255a\270\367\232\226A\0337\200\333"
+	.ascii	"vb\033\204ms\001\266\321c}HD\336{_\332E/\350"
+	.string	"\313\234\372\341?\305\344\206\314\214l\251*\331&\220V*\373\365<\3174\327)\367\334\352\347\031\251s\337\272q#\365\316\263n\235\233w\216\251IS\327L=\232Z\024\251\355H]Ejj\251\357\263\340\315P\fK\250\245\2161\257\323\211v\301\304\257#\337\372\263~\363\277\272\265\317e/\327\375\005%\210Yy\371X\276\226oY\276\222\363\373quj\204\021\226!\363@^\244v\222\377\344C\337\256\220\354\345\332 \364\202\344\336\247\013&\322\317\222y\003\245\251\326y\317\200\234Z\265Je\337(V\025C38\312Sm\023'\350K\261\006`J3G\373\340Y\260\344\252\365:\256\346\336\365Zq\365@\032\323\022\340\325k=\327u\320\210@\375\304O\371k\001\032gO\324\210\331JUm;\270\025\024\023\206\334{+\370_\257\222\302/r\321A\273]\231f\247R!P\314\326\233\237\247N\335\251\004\200b\264\326"
+	.string	"\357+cN\325\251\327:\345!\205i\t\220\236\277\221\262\307\227Z\251l\341\274\361UhXf\211\236\331\217r)<\277\210W\f\321\227\027\375\241\361\342k\211\2505fP?z\006A)\250\021\020oE\006\233\021P\320\021\013\336\006\036QPO\b\200\021\020\217h\210\304Q\013^\257\007c\027\300;\b\274^\321N\267\023\322\265\030\n\"\322\355zF:\b9\027\271\340\365tGEE=\335\315\374\335^k\353\251\037\236D\023\242\331\352\032\277\345d\235a\233\254\306\360\253@#\331{\245.\374\352'\273\242\247\275\367\336\033\316'\354\251\326\226\200\332\373\230\214\266\257\312\347\344d\306\334\030\370aN\341\324j\317\207\372\032F\233C\007\372\262VO6f\006\266T\225\374\005e\307%+\325\226\217\006\350\317\375\207\321\016!\202\276\034\353\271\306\332\200\361\214"
+	.ascii	"\242\017E\250q,C\r3\004\021\022\032\021\t\263\2400\035\240\""
+	.ascii	"\031\243\365\020Xg\243i\226\003\016\242&Z\221\222\267\276\"\265"
+	.ascii	"\t\301(m+\207esY\330\0020]\3774\212\001\324A\013hB\225\262\311"
+	.ascii	"\005\007\017H\272\342K\2303\215\361\240\261\360'\0338,\373-B"
+	.ascii	"\252\t\313 u\373r\2202\210o\271\016\324\350R\344\365(\361\370"
+	.ascii	"\312\236^\236a\365y>\266\254$*\037#.\\\347\205-\307-\266#\bz"
+	.ascii	"BDC\314 \203L\217\034\265\372V<)\022R\214\374\214\370\242\257"
+	.ascii	"\345)hQ\001"
+	.text
+	.section	.gnu.lto_subTaskPidController.163.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`<\f-9"
+	.ascii	"Ja@\025D`\246N\007\023A\200\211\3534\247\356O\353\243_<j\031"
+	.ascii	"\364Q8nLWx\332\035\033X>[\353\237\335\310\271\231\375\004}\030"
+	.ascii	"\356\263\201K\3077(\251\303\3473\004\240\275\221\263<\246\211"
+	.ascii	"\320&r\357\224R\nC\001!\001H\001\276\353|\257s\232:\243\357\374"
+	.ascii	"\250\263\277sO\350$s^8\302ZL\013\313z=\373\260ti\234Y\257u3w"
+	.ascii	"\263q\220\231\327`4\033\3066\215\27515\362Xvm@\247L\245\2663"
+	.ascii	"w\225N[[M\006\377X\326H\2320,\273V\200\001\250\235\036{x;E\333"
+	.ascii	"\350v\312+s\035\"\027\233\205@\3143\351\266\307\262\354\324'"
+	.ascii	"\351\265\243\240\236\216\306\242S\023\323\222\0221\tixdTD4$\024"
+	.ascii	"\004$\f\002\177\252\357\246\350\373\312\315\326?%XVGAu\341\342"
+	.ascii	"Oo}|\333\342\306.]\354\242\346Ni\335\204\n\030S\243\243\353\276"
+	.ascii	"\322\320\241\233#t\232\255\237\316\276\2528\323\322\223\022Z"
+	.ascii	"\323\211>\bF\302\320:i\212\231#Q\03169bR\346FT\212\224\020\265"
+	.ascii	"K|\250N\250\356k\310\331\027\231\007\215\2219\320\331\227\020"
+	.ascii	"\027\006\361 \020\007\376\360\237\025\037\256\236}YA\217,\313"
+	.ascii	"v\335\227\230\373P\001yb\364t\335\227\025t\350U\246L\372\345"
+	.ascii	"\321i\027\227\243:\372\321\003\\{A\202\300\266P\341\236\344\233"
+	.ascii	"fk\267\001\206t\367A`Y\226]\t\026\326\f\240\231\275\b3;`\006"
+	.ascii	"j\bbH\177\312Q0\361{\020-\234\363\252\317\314\005:\316\302\024"
+	.ascii	"\031\313\262\f\270\303\264\230\013\334L:e\f\0312\334N/\034\345"
+	.ascii	"\035\337\253\367\323\367}w9A\372\223\243\376~\243\237>\321-\371"
+	.ascii	"G\313\237\350_'\023\b]\372KN\240|R\366\006^H\371d\314\271a\334"
+	.ascii	"\250\267\301n\375_\302\313\177\2076\213\023\311\251\336\237y"
+	.ascii	"\003\007o%\037\271>\213\271\267\364\333"
+	.string	"\013\017\037>\334N\375\201m\226&J\344\314\"Fx+\r|\223!\202\374\254\346\2730jD\376\227\234v\325\355'\321\206\267\345{\230\273\255\261Tq3a+\023\336\312N\271M\334N\373\3233/dcibZ\376d^C\372/\231\373\237\317\347\223\037\t\363\317yA\253uS\031xg\251^k\216zg(\237\363\223\352|L\235\215\357\\L\235\235R\347\246\2373\323\317y\351\347\254\024t&\006\235\223\202\316HA\347a\320\371(\350l\004t.R\235\211T\347\241\237\263\220\352\034\244:\003\251\316\302w\016\252\316\300w\376\371\234\325\353\034\357\"\351\211\357p\177\232O\373Y\301\214}\274\231\314\3554\251L\223\263\304\225)Bz\027\303Gz\207\333c0\001\342\020h\275\025\314\250g\370=\326\3169o,\313\210~\311`\232\007\313|\264\305\262ZQG\217\325\326\306\350\217\276\375t\355i\361\352\325x\030L"
+	.ascii	"\005wV\260b^\333Ys\354X{\364\270\235\032}\007i\347\232j\035g"
+	.ascii	"\247\306\220\217[\364B;*!\353\020oe\321_4\3475d\023\221\340\t"
+	.ascii	"\021\375\227\255E\210\276\327\360\233\227\271\240!)\037\352u"
+	.ascii	"y\231\327$k\353\255\034\372\266\303$C\267\325\006\251\006\024"
+	.ascii	"\340.\260k\303\033b;\300\025\372\005v}\267.i\262\232\231\335"
+	.ascii	"N\205>F+\347L\217\314\271\"\fz\363$\350\031\264rM\240\2262\\"
+	.ascii	"A\240:(@N\340/\315\264\260\3334\335\325\032e\225\262J\271\235"
+	.ascii	"\n\237A\013\246)\366\373%\367\212v\203\314k\263\325\254h*\313"
+	.ascii	"n)\340F\323i\326\264\325J\204\b\267\323\340\207h\2778\325\264"
+	.ascii	"\374\311riS\310\324\253\013\374\022Eg\2260\301[\t\374\306c6\351"
+	.ascii	"\220\237\305M\266'/\214\317\351J}\263\265Z\327&\247\333\351\376"
+	.ascii	"^\352\331\223\001V(Nh`\2015\202\305\212\337\212\rV(Nh`\221\302"
+	.ascii	"\n\013\253E\025\020WIYa]UMU\225\230Jqb\004\212\251*\254\025S"
+	.ascii	"RC\276Ra\2055\305\342\352\nk*\270\246\325\217\204+\2449q\346"
+	.ascii	"i=\022\215\372\345\262\311\222@A\335=1\222#\335\344\212\033\216"
+	.ascii	"#T\021\250W\321\322i\016\tk\357\366\362\374i\202C\317\370\344"
+	.ascii	"B\202\020\335\216\377d\374\343wR\356\207\361\333\256\025+\352"
+	.ascii	"\350\342\177\334\027)N\277l\013\227\231\tx\017\013\017\234Gc"
+	.ascii	"!\313\243\345\317\326r&\256\351\227l\354\252[|\027\236\243\370"
+	.ascii	"*Z\273\246\030\323/i4X\377h\341L\311C O\317\222\004\277=C\357"
+	.ascii	"2\317p\316\340\323\314?\021\374\3303\236Y+\322\337\230~\230\236"
+	.ascii	"8\225\276\351\323;pzmj\266|\017\321\351m\244p\312;\350\333^\313"
+	.ascii	"\270T\357\364\305%\220\273\2561\344\030\266FR\313\270M\337F\332"
+	.ascii	"\360\274\313\2232\270\326"
+	.string	"d\362v\332\364}\326\256q\2121\331\034HTL\337\314\336\303\204\307\310\213\307\360\227\354Y\275\364\315\034\260\364\216\307\264\323@o\356\350\227,\324\353\222\253\364.\332\3308p\002\315\274\332Xox+\225\336\3050\333\320m}\226\231\0266F\304\200\357\250a8D\025cfDDD\222$)4\006\260\002\021!\262j\003\021\320,\206,c5M\241>\315\001CaMR\366\026W\260\312\374\232\0248|\314<\352\217t\311\333%u\263;j\222\276\312\245\367&\261\265\n\232\020%C\2329>R\177}N\322s\376\252\216\300\031\336\306\245\231\206\363\340P\242m\251,\326\331\307<\304\006\204\251P.\006\236\240h\022\303\304)\373Y\262\247\304`\275\321\371\230*\240\0012\225\024\313\254\222[Ce\267\204B\032\335Th\370\006\335\225\307\200\333\220\235f\225\f\254\206\t\213\223\037\036\330\360$\217\320\005l{\360|5\261"
+	.string	"_\b\r\342f\375#\323\367B\261\357\272\376\016\226\373\335\317\f\n?\366\321\350\333m\356\274\361y(\244\233\037\240\f[#O\252\204\025\337\242\021\0021r\r\343\r\030\301\376\376\250?nL\265\242\210\231\275\257e\300\006\272\311-#7\306\023\214g\274\030\324\234\314\020\226\022&\345\256&q\260\303U+\t~1\226G\355\375\333z}\016-\001`\252\335\212\313\033 w\tJ\345\343\207\022\204\332\215B\315HG\212y\247\256\362-\277\201\255\203\331\3620\343\270@\303\360\370\235\2757\203\022%\216\353\356\316\322\242\357\230SJ\222\022\221\304\245\364OZ\247\r\2474\203\2044\363#\220\201\026\036\"\212\317j\356\245-\266+\367\237g\235\340\262\376\306*\244\212\222\204\370\207{\376"
+	.ascii	"\356\273IF\214\242\270\201\311%\021\366\253\231\271\366\364\254"
+	.ascii	"\337\2046qut\261\323\367\200#\212\241\022\031;\222\310\317n\304"
+	.ascii	"7\212S\005\230\243\t\304\r\305\370>%\247>\"ZB\273\017\020\200"
+	.ascii	";\023\330pG\377\177\r\2312.5"
+	.text
+	.section	.gnu.lto_subTaskPidSubprocesses.164.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\211\003\305\030"
+	.string	"\006\356\237H\300XM:\300\2532\311\373\226\"\327\364\362\t\020\370\177\2336\320\226\361Ab\240p\006bT\177\366J\337\314\332\372\362\030O5\225+\364\322\242\003\337\033\301\262/\233)\230x\262\\\f!\226\362;2b\t!{o)\223\f\217"
+	.string	"\177"
+	.string	"\213"
+	.string	"\271\005{\340\373\234\271\212~\312\017\240\237+\333\265\262\322\2513\007KUx\220\236j\255b\007]\366T\210\002?\217N\331,\333{\022\300\0217{\352\347\341\233n?4C\267\031\214\242\261\321\343sP&\300\202d\313\233n>R\345\202\307\370\241\233\f\376\206n>4M\267\030\354\3018\345\tq;<\001\340t\344L\255u\207\345\213\267l\240\363\364\003"
+	.string	"g\223\251.<Pntn\201\2531{\022j\255\313#\256\347\033\363\335e\332\335\b\273\335\nGN6\356\262\373\243\0231\261\337\261/\030\177\374\334\303\350\347\333\203\216/Ab\320x\267\233\253q\003\355^\326\276\261\373\242\177%\363\3347\345\361\206\224\027EyA\312\373M^\257yi\363N\311+%oK^n\336\027P\341\240\322s\032\\ju\261\373Ru3I\217\347\376\335\337h\303\335\315\345\274\366\324\263xZ\272\202\245\326\234\202\317e\360\235w/\344D\262\027\255X\260V\033LJ\265\006B{\341J0|\265\332\036\354\223|)\303~\307\347j\330\260\201~\316F\340TD\343\035\177\362\310\225Tt\370\360\201~\312N\200\304\304\033\300\273!D\360\307}R\020\230\246\r\264Oz\367\267|\335\322\350\\k\235\315\006Z\002E\206\320h\231\0160\022\205\341}\016Mu\213\275\n\312=\342h\212"
+	.ascii	"\236y\016\335\265a\361G\356'\005y\321\331z&cx\267\204\213?\312"
+	.ascii	"4;\005i\321\325z\266R\224\212jt\003\355\274\t\372\036\021\255"
+	.ascii	"\227\213\003N\314\006\347\006\274\351\320z\2718\340\234h\305"
+	.ascii	"b)X1\313\252i\305`,\221EB<\341\262y\211\254\330\215X\243Z\030"
+	.ascii	"\212VL\304\201\301bb\230\243\275o,(\364CG\353Z*\354\335\2559"
+	.ascii	"\223\214H\314Qk\205\260or'\262!\023(P\240\2374\312\230\005\325"
+	.ascii	"!\330_\243\372;>j\274\333T\203}\257\277^!\361\204\241\361\316"
+	.ascii	"\353?\251Q\353\331C\244\323&\261\2046\b!#AP\006x\325\273\025"
+	.ascii	",\b\311\320\331V\t\021\220\034\3401\320\331\017D\250a,\303\234"
+	.ascii	"aJ\261@$\220h\264)l\003\240\002!)\273\003\020H\307\210\346\030"
+	.ascii	"3\275\272\356\360 \322\2272/v\\\033D\273\360\357\003kh\327\331"
+	.ascii	"c\001\246\341\253R\214\245\224\270\003\355=\364J\256\202\306"
+	.ascii	"D\201:My4\332\"\254\343\325 \347\301\360\020H\320J\231R\236\201"
+	.ascii	"\023Lc8\306;'%W\324$\271\2311\330',\244\356f\"\223\013\272\342"
+	.ascii	"\352\360A\016\0344\2013\273\335\214\216HN\261B2\002\370\213u"
+	.ascii	"\205\255\366h\377\263\006\304)_\374\001"
+	.text
+	.section	.gnu.lto_subTaskTelemetryPollSensors.165.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\017\001]\r"
+	.string	"f\331[C\020\221\223\016;U\031\224"
+	.string	"\215M[\301\3470\204\270\210Y\321\n0[\321\377\237Y\347U\352\203q\323\2036X\374\225g\313gR1\013\t\002\204\203\002A\021@\376t\322H\344\250=M{\352\332\366\2262\245G"
+	.string	"C"
+	.string	"L"
+	.string	"\006\356\321<\302\023\320<\272d\277\370\227\262\037\025\007\221\026\032\273k)\312K\207\232%\377\251s\272\023\310a\206+L\020\223b\306\200S\b\364\220\240\272\247\236\027N\\&\200\005\273\353\354N%w\274m\006\266\033\330\357\b\326\023;\24670\035\277\362C\230>\307\203\302Pr\017\305.\311\214\215]E\025*\232\267\357\2278\213\307?sx\252\316\243\355aw\036\337\261\375\264?\342$J_\3710g\267\003\314\313\356\247\300\b6\217\0010+NA\236\"\023\363\242!FR\357\320l\324D\203\327\"\206\013\026!)\343\250\033\375\310\020\271q\205\032\365,?\200R\031A9\001\202\273\211\267|\370\037la\224\357\036\375\221\346\361\312\341\251j\230\230r\306\376\270T\017\366\341\356n\226"
+	.string	"\302\262\020\311\022iY\246]\005F\017\260,\344\200$\302\266\215\302%\300\027\b\333\264\313\272\"X\242\020\204\314\272\266\221\005\362X\233\200m\026I\3236\253\363\231\016WO\314\361`\254L\312A\250.\025\274\025\"6\004H;\323\362\235\357\342\005\026"
+	.ascii	"q\224\301\231\320w\024#\303`\254\337\033\204FXY\036\374,\301"
+	.ascii	",4\270\261\013i\033\307\254\265\263Z\300\242\026q\027\334Am_"
+	.ascii	"\301\022\261jE\234\344\251\256\234R\250="
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.166.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`S\004\355\033"
+	.string	"\026\362\256I\260\226Q:e^#h\035@s\364U\206g\327lB\362\312\221+\334\013\001\233\246\340\220\324n\332\333/<\374\2617YA2dx\236\335kFy\214+\257-\374]A\265\337\361c\234\315>\333\335\f\366\023B\310&r\247\024\232"
+	.string	"\211"
+	.string	"\237"
+	.ascii	"UW\377\342\n\270TUko\301\251\033\220\237\366\211|\t\350L-\\\326"
+	.ascii	"\232C\n\252\326\036\003# O\013\274F<\r\037@<5\220\275\0056Tk"
+	.ascii	"\017\200CnNW\265\326\330\3568\320[%9\2124\334\t\344\337\367\022"
+	.ascii	"\227\253\275E\343\345\247\212h\030\370Q4c\222\006r\350v\037C"
+	.ascii	"\005UM\272|\252h\027\326\020\365\300\335\246ht\352\302\225\033"
+	.ascii	"\232a+g\364\r\035\f]\325\230\311\t\2051X7+\367}\306\310\331\346"
+	.ascii	"\034%\324Z=q9\335\355\272m%\333\030\354\020C\373\022\342w\304"
+	.ascii	"\217Jhb\3317\362#%\374$\353\230\230\307\235\372&\304\323/\375"
+	.ascii	"\001"
+	.string	"\274\272\261\264\013\232a\354^m\356\221\375\260\256\016\373L\377\200\377\356\033\230\315{7\3158\375\"\247g\310i\031r:F\234v\321\351V9]\216\323$9=\222\323\2428M\311\351p\234^qz\322\351#8\357\013\221\f\335yYj%\n\363\245\006\251\023\245\377\036\316\367\276\366\355\027\361\233~,`\004\201O\021\310\323\337g\227\355\336\317\003\177\342\r\201\315\001kk\3300\217s\002\036\220\240\320\326D\233\235T<\033N\236\004\217Pz\337\017XA\t\262;%_\225\020\266Q\256C\302\"dG\256m\234C\001N \316j\\R\334p\307=]q\177\313\nz\322\201n\271\0137\300Q\022\225[\326\356\2227\361\360\342Qk\205\34039\324\007?\351\324 B\204\270\2018\253\233\335m9%E\335\262\346\302\366f\327\311\205\017\333\223\\\311\317\n\021\"\304\323\271\227\202d\305\313k\332\262\331<\016\266o:"
+	.ascii	"*\2440A\333\326\234\005\212\tG\263\035\035\0169>'f\024hh9>=e"
+	.ascii	"O\207\331\216\016\007\037\0243\032M\205L\3062\234\031\215G\026"
+	.ascii	"\223\221\210\241\320\311\331\211\311h=1\234\032\363\244\230\321"
+	.ascii	"b><<\264\230\253W\277:\\\362\300\004\203\326\326za\361\020\273"
+	.ascii	"\"^\231\331\227\314\306\354\f\315\312\2706faN\256=\025\034\266"
+	.ascii	"\255\275\224zkIL\265\226\026\211\3422\301\0020h#\tL\273\202\205"
+	.ascii	"?\361\226\316\003\253\nj\334#\333 \221\332BmN\204\213\232\022"
+	.ascii	"\372?\342\233~#$QY\013[\232\215a\357\210\345\216\370i\0210\355"
+	.ascii	"\013\031\346q\345\006Y\250a \347\224r\n\215L$\0234-H\033\200"
+	.ascii	"\002\231)+\017\020H\250\2066\351k\210\372\243\343\310\355\241"
+	.ascii	"EW\370\3454ZT\342\327\321 \\\341:\016\332\201\222\026\366\367"
+	.ascii	"\013\347$\275\333<\311]\225\330d\275\307\333\032\021X\202w\200"
+	.ascii	"h\004\315\b\t\331\360\027m\317m}\207&\352\r4\205P\235:Y\246\203"
+	.ascii	"\3211\244\254o\3135tx\201O\303ho\003\2324BGh\364\336q\004\246"
+	.ascii	"&\005N\274\007\202K\005-\302\026j\373W\021\312\006 \034\340Z"
+	.ascii	"A\330l\020\277\257\323\005V\332\024\363\356\037\335\361\347\b"
+	.ascii	"\361\254\036n\201\"\231\352\232\032r%\307\024\220\270\347\017"
+	.ascii	"xN\371\355\257!\262\032"
+	.text
+	.section	.gnu.lto_subTaskRcCommand.167.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\236\002U\024"
+	.string	"vc\200I\300\224Q:\350&r`\020\340\211\302\202\3302\332\340\3701\326F\362\301\016\237+\206\177\343\344_\336\220\375^\354\377\372L\007A\237\343%,\017\177/\304\030l\220HLjQ\343\201\002\322\225=7\303\272\333\232%{o)e\nn"
+	.string	"_"
+	.string	"j"
+	.string	"\362\262\177H"
+	.ascii	"\234\236-\330A\342V\204\244\273[\334Bej\242J\205SF^\3315dQ\341"
+	.ascii	"t351\300\263\323QULi\002\336\n\364\354DiP\016\305\2464(\227\263"
+	.ascii	"\341\274\255\214\254\037+\204\240\350F\304\004)\234N\254t8\033"
+	.ascii	"W:\3332\220\234NL\351n\255\241[BW\333\rY\272\373\213\323\355"
+	.ascii	"\364+\375\337\373\257\340_\025\0013~\210\251\274\301\007e\333"
+	.ascii	"$W\355\017\373\260\212SV$\236\f`\215g\177\257\266\354\363k\354"
+	.ascii	"\356>\367\374s\037\316\375\214{)\3671\356\231\367\273{=a\005"
+	.ascii	"\001\332\251\220R\267\211\240\222\006\312_\214\325\177\335_i"
+	.ascii	"\350\220L\211D\\\325\315\243\224\243\273\247\362\003)\225)\312"
+	.ascii	"\232*\243\002\230\032l\344:\206\204\\H\366Q\2279YY\370\240\376"
+	.ascii	"\n\232\344rCq\274\\\200\201\231*'k\316OR\024\021m\203\032\331"
+	.ascii	"\347\222\231\027\206\317\207m\223<\262\304\240H\031R\3356\006"
+	.ascii	"W#=\322\020\343r\261\026=\021-3\353m\tm\203+Z\364Juw\203\253"
+	.ascii	"Omt\270\002\251\274\314\214\274\316"
+	.string	"L\225\313*O?\332\006u\273;6//\032\031\01375\257X\f\204\353\344\256\225W\f\346j\2718\264jdbhZ\256\230Mk\205u\230\207W\254u\003\203\305Z\253\036Mcs\317U\274& \215k\017\020\360xD\023\002\373C\210\260\212\273\"\361\230\006\374f?\252\324:E9X*b\224B\221;\247#o\"2\243G\3502C\326 \337\223\004eZ\322\337\004\n--Se\310\032|\301G;\271\244) > \220\002\231A\353\006CC\347L\f\3470\356\222{\312\013\222\213`?\344\324w\0037\3351\021\341\036\357\307\0241\215DP\2664Y\270cHH\003\277\312\213\261k\323\034\023\223\376\367\254\264\306\305\340\201\264\345L6\260\rY\211m\361\354\022\326\253\346\303\032n\375)\336d\332\032\352\267fcK\253Z\273j\261\317k\300\206@\274\246\030.\371\200\030\233y\275\346v\204-\220\"\224V"
+	.ascii	"\330\273\250c\326R\217\330+\003"
+	.text
+	.section	.gnu.lto_taskGyroSample.168.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`2\0015\r"
+	.string	"\346\330WB\020q\233\016\030\326N\305(\3306\024\026d\236g\326\214S=\002\360lO\200\033\260G\300\205%\222\365'\364\324\314\233W'CN\300P\305\021\024"
+	.string	"D\200C\"SA\033 *\013Q\215\226\354-eJ\001C"
+	.string	"A"
+	.string	"F"
+	.string	"\003<\036E\216\221\036\341\001H\217\336l\032\017}\330"
+	.ascii	".>\026N\340"
+	.string	"\330]J=|;\324\334\374\013\311\344}\334a\206k\310\307\201\"\273{\225\347\205\257\313\274\220\354\256\323\373N\356x\333\007l\033\260\357\t\236\txj\210:\345\354\020\227\232b\037\356\356ZQ\354\203\376)\3231\3230\323\232\351\314\364A0-3N>\"\305.\206\321\216\025E\226\317\207\355\247}\022/\261\035T\301\323n\007\225\026\273\241\002\016\232\016\214\020669\312\335\345\324\002$U\006+28\251\303\251W\325\233\260t(\034\244N\376\312M\\>\b?\300\362\336\243\217I\217\327\203:/rl\330\344\310\0369\251\035!s\317\r\021G9\307\264'P\310\007\231\004\026v!\320\224X\232&\241\002q5biYEU\r\250\222k\001FUZ\206\032\3018\203`i\224&\3134\352#\264\207\253(\236>\032D\033\355\034\225\305\275\226\377\222\240F\275\t\207.G^\001UA'\206\b\250)\227\244\"\034"
+	.ascii	"3\241\255)F\343\005\202\340*\305\203SV\201%\244r]\314\202\236"
+	.ascii	"\331!U#\254,\f\034\241!\304V,\232\305\300\035\020\214\347\270"
+	.ascii	"\031u\272\2326/\230u\t\213X\215\006\356\0220`Q\345\266\253\350"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_gyroFilterReady.169.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\035\n"
+	.string	"\206\022E@0\251(\0350\004z\354\036\323.\255\244\351\253\030\226r\276~k\032\016\256lB\\\001\363^\377\211h\373\004\373\0234\246\031\027\217&\016?,d\260X@k\2041e\272\212N\247\264&dK\231R2"
+	.string	"1"
+	.string	"4"
+	.string	"(\006(\354\206\232\002\270\367\250\351\371\337cF"
+	.string	"\b-\016\016\200*W\007\360\023'v\367\250\247\b\004e.dv\327\031\002I7v\333\032\266)\354?\004\371\262\303/\325d?\256\226l\247c\2465\323\231\351g?\r\030\245\220\236\232\260;z\271\266\001\306:\331\356\330\027[\\t\354E\230|\0210Z\b\002\031\217~\242\232rw?\225\310T;\n<"
+	.string	"e\005\247^U\177\302\372\204\233\324\206\253N\200\304\027\340\022N>t\314\347d\307\256G\275B\002\203\024\213j\305\023\3360\232\216\333\264\315C\013\371\340"
+	.string	"\321\266n\243a \314\211h:m\204\343:\355\022\356\343j\311\033\013V+\365\275\354\2503\270Z\nV\t\362\367\262\250\"\333Q\035\021"
+	.ascii	"Q\204>\316\206\267\307\0167Z\345! \307\004\006y\2401\236\330"
+	.ascii	"E\251\241]\023\027\261\320m\210<\356:\252j uhkK\031"
+	.text
+	.section	.gnu.lto_pidLoopReady.170.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\255\n"
+	.string	"\366\223JB\020\253*\035\007\020\361r\201\342\3605\364\022\375D\033_d\347\013Y\377\251\241\377\353\375\013B_o\035eC\031\003\202:\327\2703\022\205\017"
+	.string	""
+	.string	"P"
+	.string	"\020\201\032\214m\200\242\b,\202\205\310\326\310\2262\245:"
+	.string	"5"
+	.string	"8"
+	.string	"\020P\032d\230S\334\266\300\277\313\325\317\377\\j\030\3000\201B+\f\360\225\231V\350 \"\fI\b\005\025\022\\u%\205\240\252E3\347\264\216B\323\255\335\366\206\355\n\373\024\001+\001 \035m\361\243\213\262/\347\236l\2535UKU\257\252U\325\267<\365\240\224b\372j\234\2634\316\246\004\355\225\262\355\261/\316`x\374M\234|,d\300\002(\313\020\\"
+	.string	"\260{\222\273\333\301 \026R\r\266\270\256\334\2136\200:Z\367\273{\321\013\0249\272\017_}A\211\177\300&\035\375\350\232\337\251\\\373^\365\013S\004\002\003\002\3460\033\257\3436\316c\023\371\340\b\3318\217\263a$\334\215l\274\215\244\353\274\355\"\316\357\311 0\031\313\245\376W\271\352\0163X\214\345\332\377\253hK\262\255\2555\240\005\345\006\017"
+	.ascii	"S\b8VG1\330\272<ZT\316\b\002R@\273<\361\210R\243\270&\276b\241"
+	.ascii	"\333\020y\334uT\325Pt)("
+	.text
+	.section	.gnu.lto_taskFiltering.171.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\222\31633`m3\006C\234\276\nB {\030\274On\r\210\327\340\301n\\\375z'\241\207\255\002\351\330H)\310\tR\002\242h\017\256\257`*\363&\332\226R\246\024\234\206J\223a\350l\2529#(\201R\230jZ\224\244\036\344&\343\240\221\324\344H\314T\013\242\232\262cYS^\270;\036\202*i']\005\264h|\017\266\022\023\317Y\0214\223\356\002b-\207=\270\321:\376\177!\250\365f\2778\251\210|\274\255\374\031+)\357\"\022\355\322\326\257\265\207?.o\024\225~\215m\344\347\022z\020\340\250\300\223\305Q\364\200\305Q\2576d\256\343\004%!\214\020\224\377\022r\370\362\273j\203X\312<\230\037\300\302\377\276\314\363q\241\333\032\264Uh\253\005\b"
+	.ascii	"2\241g/0p\341\035\314\273\004@\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.172.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`j\002m\022"
+	.string	"\026bwG\340\322&\035\222\331T\224\221J\365w\337u\223\204\024\201\303\340\024Ah@\016'g\231z \317\034\266\007\333\243/\006;\276\261\351\362i:\230,c.)\217\3208\342d\271g\244\260\317{\031w7\221H\366\336R\246\024d"
+	.string	"X"
+	.string	"d"
+	.ascii	"A!\334\315y\202\250hN\233\002\037\030y4p\024\371\b\177\"\037"
+	.ascii	"\355\262\203\334\3463\t\350 \"\033b\232sz\213\342\256s2\302U"
+	.ascii	"\227\177\241w\337\354un\244\304\245\f5\273\321(\263QH\342\013"
+	.ascii	"\031\3300\231\b0\213\301\222&\231\217\013]E\314`\252\334\203"
+	.ascii	"9\247\365\233\345\334#\267\r\302\366\002[W\004J1m\262\017\343"
+	.ascii	"1V>\315,\031\375\367\350\313\310\307o\006Z\215!:5\372d\333^\272"
+	.ascii	"=\366\341\234szy\354\007\375&\252FE5\211Tw\252\346\242ZBu\204"
+	.ascii	"j\b\325\273jU\365S^\333\2013\"\347BB\346\304yr\232\267\210#\005"
+	.ascii	"\312\366\325>\320_\270\036\034lp{\201v\364S\001h\305\005\206"
+	.ascii	"\327Z\234\250\311\332\0326\350?#"
+	.string	"\250\261\270\305\366\005\345\332Np\"\026\317g\316\351\300\237q\032->\355\321)\225J>\312\037\337R\\\tw7\356oT\300\364\311&\013\367\272\273)C\262\"%j\277t\320\177\272\357\261\003\333\327\r\244(hg\267\307\361+\371u\221\0213+\252\325\213\005\032\030U\253\345!\005\300)\025U\213\225\362R.\036\314K\313\312K\265f<\025\024\263bT-\217\206\305jy(\333\374\362\270\253%\335j\026\306\025P\033B\204\335\327\0058\361H\2227\216\332\0179P\033CC\372\321!9bi`\364o\251[\222\345\220dE\006(\312%H{\002\005\375\327-\247T3\272\305\342\277\222\334\0061 \320\002!!\262\003\203\200\221d\310\035l{_\324\305AK$\264t\342S\302L\021\274\254e\017G!\322&\343b\276\2622\374\312\266\3556\210kB\013\362\311\f#\3635\326\317=\264\r\273\226\023(\032\240\271"
+	.ascii	"\234;\257a\341\205\013\243\212f\007mq\300\356(\023^\b\304~J\240"
+	.ascii	"#\345\232\274\340\344dw{;\2018\246h\025\n"
+	.text
+	.section	.gnu.lto_isFlipOverAfterCrashActive.173.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 \342E\006"
+	.string	"\302\213+2Pm\222\016$\243\252,(:\267|\001"
+	.string	"\3327\031Zs\303\177\376\361\r\373w;\274Vp#\b[\210\252\262 b\345\255"
+	.string	"\301\024\300{\305[\334[\246O\226KEMmzh\022\020\016\021m\252(\232\245`j\342R\265\n\212\252\232\204e\361sx\260\301\213oHE\254\013\332\002s\275\032]L@\243\303\201\215\315e\217i\0169\276"
+	.string	"\211\237\377>4\b\201<-\31129\331J\246D'\037\177\346\245\025\0262[\305<8\004(\241\214\021\225L\254aG\255\236u\013\322\006\f\023\222\253\243\351\t0d\346wu<\035\373'\374\b\277F\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getLastDisarmTimeUs.174.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 \360\245\006"
+	.string	"\242\214.4Pm\222\016$\223\203\310\202\342FY\233Nk`\013.l\257\240U\323_\334\354n\207\327\nn\004a\013QUI\0205p\013\270r\312\240\r\203\355f\311\226)S\230\214UQ\217Rx\r\013\t\f\217\262\036\036\306r\345\220\261\036DUY\257\262e\335\007\335\005s\022_\216n\327\3158B\203\315*]\315T\t\035@\005\206\243\3378\350.\276\223t\237\037G'"
+	.string	"\362\360T$\222I1*\311\020\351\003\364o\276rC\325\330|!t0\255"
+	.string	"$4\321A\222\271\275K-S\245I\003\246J\016\243W\361\272\335\350AG4\222i\234\"\305 3\307L\363t\327\237\340\037\370-\002\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_isTryingToArm.175.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 \366\265\006"
+	.string	"\002\r/4Pm\222\016$\243\214\262,F\2113\251,"
+	.string	""
+	.string	"\020t\214\225\324\375\357\373\263o\377n\320\272\370F\020\026\214id\021E\367\2456\0022\004<5\246\331Md\n?L\246\242\236{\017N\002\302!\302\275\212\302a\b\246&2\225\253\240\250\312]\260,\212\020\r8\3309\241E\304z\262N?\nr\311\335\330\342\254\365\352t\317"
+	.string	":\025\005.8\255\364\330\246\341\350k\311\314\034E\177\033[\273\226\202\216\224PI#\231\237\322J\242L$\034\277\346/+,h\266\212i|\006ND<!*\231\230\303\214Zm\326\255G\033F$\223\013\264i\013`\310\314\333\005\nu\354\217\360\037\374\030\001\b"
+	.ascii	"2\001'8#\217c\261\250\360\352\232\262\204\310\341\316\231\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_resetTryingToArm.176.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 \344=\006"
+	.string	"\"\313*4`k\323\001P\235]')\357r\236\223\3400\221\255=\253\250\005\305\212\f\001\t\341\301q]\003\247\267[\340"
+	.string	"\002\003\016\315\n\3072/\n!1k\177\357\224\002\236\221T\351\224s#\005"
+	.string	"4\001rV\002\031ML\007\244*\013(\255\022\332\3661{ \036\272*\036\370r\177\342\024\316\3605\033\230\203\267\356\370\346\"w2\332\206\327Q\301\317\336(\030\027\354C6fv\244D$`\267\360\330U\370>\266s0\034l\037\362ds|k\330\212\306\005B\205\267\27322|:\234\374K\374\261.\352P\202\331]C\353\302\356x\213m,\t"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\306lm\327i\001"
+	.text
+	.section	.gnu.lto_isLaunchControlActive.177.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375 \365\245\006"
+	.string	"\242L.4Pm\222\016$\223c\032\027\263\032\227G5\332\246n#7H\360\357\373\263o\377n\031j\255\340F\020\026\2141c\021E\367\255"
+	.string	"\301\024\300\317j\255\375Md\n?L\306\252\236{\f\356\241a\301\301=+\302a\004\256 2\226\223\250*\313]\262\354\210\004\036\374\334j*E\304\202L\237v\324CsIOlZ\261RwS)U\004\240\360\264\323g\235\206\027_J\242\305\337\306\326.e`\2034jI$3t:\311\021\312\244\361s\376\362\001\002\347\253YF("
+	.string	"$\004\364a\222\2319\304\350\325v\335rT\201\244T\202\211:m\226\204\314\274a\242Q\307\376\006\177\301_\021\t"
+	.ascii	"2\003\3020S\270\033\241,qML\031A\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.293.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\247\022EN"
+	.string	"Zw\034\033?0bR\007O\007\331\312\024%'!h\202\n\371u\225~\322Ul\201?\206\376\031\365\246"
+	.string	"\357\344T5"
+	.string	")"
+	.string	"0\216\020z\204\376\377\035_\356vww\273?"
+	.string	"iF\266f\204\354\275\245L)\255\001|\001\242\001`\006t\374\0272O\0033 \377\027\262g\331\336,\304D\337\026\257p\236\367\274\036\366+\342\347\345x=G@\004\216\335<\317\307\327?O\207\373\361\370\360\337\271\273\2164\227\335\003\375^\224\371\315,9\023S8\3173\364\341\r\345\345\207\360\300A\003\006\013\024$@p\300@\001\002`\003\004@\277\002"
+	.string	"\360\352\342\332\322\312\302\272\262\252\242zNIEA=951-9\233JIHG\314\2452\211<\032\213\304a\f\277[\373\236\354?\214P\005\250kU+{\b\335\177\340\240\3217`\264H3X\240(\221V"
+	.string	"\243\f\036\227\353\232\242O\300-\324\b\270\204\372"
+	.string	"7\22060\bH\027\370\243\t"
+	.ascii	"z\260A?z\300\240\240\026\340o\326\347\241\201}\364W\240\035\035"
+	.ascii	"\240\316\003\250CG{\245Q\004\250\273\262\317\225\235\243\267"
+	.ascii	"\264\344|\226\2324\032\313\357\257\374\372\264U\225QNN\320u\r"
+	.ascii	"\315S\2351\243\237g\312\350)4^\264T\224\336C\345\341\351'\247"
+	.ascii	"\273o\352\302E3-\r\345\320\004]\327\354\336Y\205\212nV\301\223"
+	.ascii	"6E+%\315=\222\234\024}\304\214\373%\236\264(\3573\357\251\350"
+	.ascii	"\322\336\264r\030\341\272\346\366I*$\035\236\264%\372\330\246"
+	.ascii	"D\033=\370\255\301\343^\327\332\276\230D\023\361\244\261\321"
+	.ascii	"\245!\321C\2724\266\3679\317\363\2179\323\361\323\245\271\005"
+	.ascii	"Q\343\241amU+\362\357Q\255\252\367\333\265esH\251\266\343m\n"
+	.ascii	"\241b\375\274\327>\324\250Z#\275\357\r#\314\363\354\314&h\357"
+	.ascii	"\022\336\3755sw\037\356\312 \001\361\336\022\303\203\356\335"
+	.ascii	"\360\376\263F\356\032^\273\2018\317\325\003\376v>\220\203\377"
+	.ascii	"\334\303\336\341\203~\353\207\370\341w?\037A=3\335\365\246v\017"
+	.ascii	"!B\277u\357\370\016\356\243$\332\252\331\033\353\356[\261\336"
+	.ascii	"R\276\301\252N\344\357\374[\361o\275_CgH\250\272\353H\332\275"
+	.ascii	"\304\t\375\326\337dE\340\270[\352.\323\033\353;\302\357n\267"
+	.ascii	"\313\310\267\023\367W{\327\253\235\353\325\276\225\324\256\225"
+	.ascii	"\324\236\225\324\216\365j\277:j\2672j\257Bj\247z\265?_\355SG"
+	.ascii	"\355RF\355QH\355P\257\366\247W\273\323\253\275\351\325\316\364"
+	.ascii	"j_Bjw\"\2657_\355J\257\366\244W;\322R\373\321\253\235\371j_*"
+	.ascii	"\265+_\355\311W;\362\325~|\265\033_\314{\361\325N<j\037&\265"
+	.ascii	"\307I\3550R\373{\324\276\217\332\265Q\373\223\005\b\\\272\315"
+	.ascii	"\263\220\356\242\031\016nS\345\305\374\203\371\367\373?\363r"
+	.ascii	"b\344\360\030M\320\316\326\374Ekx\224\311\003,\2327:\234F\004"
+	.ascii	"*\332\216\267\317\214\026\257p\256\356yy\233wc\303il\264\035"
+	.ascii	"f\327*=x<\376"
+	.string	"\240\017\373\3367\343\207\211\237\024?<t\177\257\361j\374A\335\234\215W\343_uy\334\360\374\313\240\3714~}c}c\203r.\23413ff\314\303`\241\202\337{=\177\276\037\343G1a\302H\365i\361\354\300\210\017\203\361@\230\366R#\2548\210\256\226\246\226\266\r/p\334m\325\352\310;\263T?#k\252\376\342`M\311\316TQ\261\323\230\210O\360\243\342\346vn\327gH\250zM\017\221\205\250\311C\344!\361\303\315\rAP\020[\331\222\247\322\376\253\026\362J[\351\017\316T\322\226B\025I\332\3166\332\252\324\017\274\250'\027-\024\322\021\244\355\324\362\244\321\234V\234\230\177mM\033\353y^N\022\037m)\237\035\2606\371M\277\365h;\331\2304\325Id\313\201!#gI\377\251i\253\273,\212\223\271\177\360\211\271u\3005\227L\226{9\244\253\304\250P[\375\244\331\020\322\313Mbe"
+	.string	"(r\234~\253r'\r\322R\217\n?\211\016\223\251t3\347\227\311-\215\223\373\363\376\203\270\211\243\255v\225\305]\b\316R\210K\362\267\357n\341\356\210\356\320 \022\371\201\036\271\377\b\\\265"
+	.ascii	"\235\353\365\270\261\376\177\276\270\241O\b\337\356`\017\031"
+	.ascii	"\211_AN\311M]1\311\231l\361\270\277\021\037\227\366\227\253\304"
+	.ascii	"\356\362\025\031\213~\353qc\r\271\362\264\335\222%\222\305\305"
+	.ascii	"Ma\277\277\311\263\20324n\235\310O\235"
+	.string	"qsxb\347\226\207\304Lw\267\024\367\217y#\223${\334m\274\261|\236h\245\335\345;9O\277\225\270\311\222\300q\267\376c\261\277\236\3373\346?\347\262\027\t\022\342\207\213N\002\013\013mXJ\277\363W\210\335-`\320oue\033D\332*\002-!\226wc\207{o\344\036\276\300x\017\207}\336\341\304\360\016\316\342kE\013\0252\242aO\316\342\253\006\214\250TLF4\354D\230\024**%\263`L\001CL,*e\001\"\2054*cE\013%\016\017)n\240`\021\277\bC1\001\207\007\261\250\005\261\0326\\$=\354+\2054\032\006\rS\001\225\321\002E\fh\230\264\006\364\253\351\321\031)\244P\261hT\n=\376;o'#\274h\3156\025\002\237)!\022\360\356\201\340\2240\213\203\f\200\246\204\200W\364<\317e\r\272\266\264\013\360mf\240\367\200G\b\310Y\303.\340\332\257\307\265\241"
+	.string	"\213h\253\277d\215!/\n\230Ok\3108Ek\t\266\366?\331\332N%j\b6\326\275^K\307\325u\2636\326\326\"Bm;P"
+	.string	"\300\177\\\034*`^\237u\265\377:\025t\265\225\262\212\264T\003V\373\2454\252\332V\033fT\265\227\262\206\264\324\002\232\312S\tN\ti;-z\313\324\320\024\321\224;\345\306\017S\355\342\036:\\=3\335%\340\204\212\217&`\317\375R\232\317\375\\\342\314\334mu\300\306\272\206z\275q\312\334\231\232/"
+	.string	"\217\265}L\355\256:?|\203\023\364s\376)\243\330}\332\225\313\364[\247\266\216\203\263\345n\327\b"
+	.string	"b\265;\004\005|\251\375O\370\004\227\204\335\300\356o\305Q[j\303Q\273\004\034\365kC\f\265\271\352\260P\365\024-\247\347\344\035\362\231\334\243G\3740\324&Q7\347\226\027\300\367\234\364\224\262w"
+	.string	"\236\366_\237\366\247\371/\302\266E[\365rr\332K\266\272\256\354\033W\223\217\246\275dk\323R\267\336\336\211\210\326\234U\313b\n\201\227\250q<g\0253\"\"\"\222$\005)\f\007q\005\304 \307\2404\017\021\240 \0061cD\222\244\220\341\302="
+	.ascii	"\314F\002\222\207d\322\340\353i\227\223\253k\234\\\241\323\032"
+	.ascii	"\017q\350\234\276$8\005wPw\032E\203\256|\354\217C\366\224\f\216"
+	.ascii	"`\006\340\275t\f\312\3539T]\344\374rZd&\215o\3573S\355\206\330"
+	.ascii	"\275\2077\261\332\3768\027\305\240\037\036?\306\313]\020\201"
+	.ascii	"\001\366\330\205\221\027\022\374[\034V\335\005\246\311\3533~"
+	.ascii	"\302C\366\343b\026)\017\232w2H\230\261\353\006o\330\032\262Y"
+	.ascii	"\355>\2039\321\305\313\222tN\034\236\202\031\351\264lB\205\b"
+	.ascii	"\334\021\352;f\3342\343*$\r\224U\303\3529\252\272\362N3J\351"
+	.ascii	"ae\001\013\336\343'a\006\223\r\363G\374\272F\204m1.\260Z-\311"
+	.ascii	"]2\222\214\250\221;C\343\220E\027\273K}\253\277\376\2248."
+	.string	"\345w\023\021\211\236\326Um\203\333\035\002s\030\360h\203\245/\325\306Z+\272\221\222\007\230\223\032.8t\360%\235\2758\002yp\032\200J\231HZ\236\343\244\327\020\032\360\025\365\206\034C@\214\344Bk\017\312|\336N'\265\350\231\2245\373\322\246G\243\033\356\354:\t\272H\f\036e\034\220t\005\342\022j\214\365%\301T\277o\271\214\004\267\bO\263\351\013\373\202\"z\016\336\371\355\006EPi\370c\321\325]2\031\031\363CTR_\316\322$\026A``\335\n\247\016\244;\344\032}L/\247&\037\322\322'Z\2066\241<\245\235\261\326\241\022\204[\207\251g\263`\021\032\265\205\272\355#(\205\270\277\306\377@\256[I\220\2200\201&\321\361\325|}\220[\344\3703\270\244j\265\311\204\r\306\2613,\312\277\325\325"
+	.string	"TSg\201Z\2161\307"
+	.string	"\013\204T\347\027\262,8d\0230J\373Q\022G\212R~\024!\243/\336Or\336\247!dd\250ZX\034C\212\243\376\376\023\032\016\223\212\024\305\245\234\212t\034\021\212q\036\377Q\304\020\2704\022\n\240z\341\030\b\332\325;\272\372\361P`F\201ir\356\260BH&\340\003\320\\\200\200\246d\216\355\f\353C\250\236C\340\343\347y\247F\\s\310\344S\252"
+	.ascii	"k\031\321?fO\034\240\264{\207\2641\244\202\274\220\342\275Y\250"
+	.ascii	"p\013\263}g\353\367\242\004\266\\\005\310\237#\320\327\376U\022"
+	.ascii	"\225D\025J\334n\244\242\227[\237\235B\334\273*\310\007\345\004"
+	.ascii	"\346\207\214\365\225\016\316\212\b\bV\255\256\246\254\325\373"
+	.ascii	"5\232Wj\343G\210<V\200\251\306\023\241\230\020f\265\315\201\b"
+	.ascii	"\021\001\241\256\335Cf\354\357uJ0 \314\032\357\340U\270\240T"
+	.ascii	"\021;d\f,\227\346 \3241K]\201o\212BN\017>\347\256\266Da\222\r"
+	.ascii	"\353`\361\224\027\232\201\020\353W\3524\016\b\025"
+	.text
+	.section	.gnu.lto_disarm.part.0.295.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\337\003\275\032"
+	.string	"\266\260\250I\260\226Q:t"
+	.string	"5\260\347\234A\253\213q\216~8\036\255\017\222\214\363\246\241\306\310\021\361Q7\236\r?4\033\241\321\230\034\2714\360>\273\217\217\344\024n@*\361\274?\354\2161>\304\301\255B\027\003[\215\220M\310\226)\005\217"
+	.string	"\217"
+	.string	"\222"
+	.string	"M,\300\262\352r\336\265o\344L\344\233X\230U\353\221\224\222ZK\006\017\235`|\370\372\f}\b~"
+	.ascii	"}h_\311\266O\316\244\235\345\345\256^jJ\b\252\252\326\n{8u\234"
+	.ascii	"\374(\322\020\234\313\"}\247\263p\272\237\217\342\315\321P\321"
+	.ascii	"E\242SP\001\325\222/.\235\0208\003\343\007\256\305\206\213\323"
+	.ascii	"\3058\b\276\244\374\204\016\344\270a\325\322\335v\272tA\340\253"
+	.ascii	"\326\372\336\367\205\316\266+\340,\361\246\326\352\003\315\270"
+	.ascii	"\001\334\366\220\355\f\366\304\022:\364\341\347{\337\037IKFF"
+	.ascii	"\212\200\366j'\222'\353`\2359lq=\216k\221\256)]\207/\177P\\O"
+	.ascii	"\272^\272>\001\330\222\214Q\2550\256\302T\034!\023 \347}sR>F"
+	.ascii	"qcs\021\004&\311r+k\214\344IT\030E\201r7\004@F\221U\224\252Z"
+	.ascii	"K\330C\227\343\264\357\262\242\342Qn\021\361Z\376\221?\371=\267"
+	.ascii	"\316\203\352\361\353\006\325\363\272\225U\367\241\252\250\245"
+	.ascii	"\252Zs5\017]3:\255\357\344c\267Z\336}\351\363\224\316-\022\341"
+	.ascii	"U\250\320\351`\212\351[k\375\231\023\3116\016\rg\355\351\312"
+	.ascii	"m\301\330\236\360\037\316X\353\255\201\357\373\024\n~\217\207"
+	.ascii	"\256`\301\002}\030N\361\t\317\212\251\300>\352\275\013\227\332"
+	.ascii	"\341d\216\201\332\0326\354q\016\340#\372\005\315\037\203\323"
+	.ascii	"\346\360^\207\231]\255\265\201\203\235\221\215\032s\372O\016"
+	.ascii	"\305\303\207X\314\211k\355\231\210=nN\0034\264\374l\363\307;"
+	.ascii	"\233\034\267\345c\236C"
+	.string	"?w^\250\310\266W\366\225|I\216\337\303$t\366\270\207~\036a\263\202\006\202\204,V\002\304\201\030OL\002\317\316,\305\214\265C;\021\233\325\250e6\263\032M\006\223\205\200\355\344\304t`\262\332\t\230\315\214i&f5\030\017\215V\203\265\356\217>\253\037\320\264\215=`\255G\017\316\373\251\234\304\005\013\236\334Am\222\007\351\203\313\357\366\035\030*%\224\206\216\263\3664\365;\r\025\3478A14AH!{\2348e|Cf^J+*\237L\242\276\225O\221I$\021R\211T\242\017Y:\232Tu\t\021\254M6Ap\371l\314[L\356\252\n8\221\274\307\tR\250a<\303\f#\006\031\243\2214A\222\246\003`\002\021cW\036\020P\2526I:\224eRB\033@<W\022E5'\267\007\235\033Py\364!B_\346\030#\177Nq\342r\027\202\2419\300\364\335&\3675E\343\304='j"
+	.ascii	"\001J\301y\264\232\214F\021v\223M\340\303\203Nu\240&\211\310"
+	.ascii	"\375\344\233z0\"L\332\341\3623\315\321>w\255\357\254\353\324"
+	.ascii	"\\Rp\373%\3718EL\220\316{F\213\267\346\020\203\025\240\227\314"
+	.ascii	"\2414\317\001\346o+L\024\334\231\362\274>\372O\357\331\226\366"
+	.ascii	"~\203\241\314\031\276U^\225\231\257\355\317t)\316\347\231PS"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.297.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\375\006"
+	.string	"rL-3`M\222\016@c\017\212\002q\022\244\242\026\006Z\034\0374\250\214\356\217\0321\206\335\030\027\306\326K\327\355\n"
+	.string	"@PsT\310\201\306\367\006Y#B6\221)K\230\f5IORx\r\013\t\fO\242\036\036\206\340\311!C=\210i\242^\364\263\266\304\316\227\320\b\210\002+\020=\277cQ#"
+	.string	"^b\202\325\272)!\016\220\005n\030z\306\326\226\330yl\037\024\201\216L\214\026\226\364p'!\337K\363QTW\222_\223q\365*-\001\311\202\317ua\262\222\231\257\016?Z\025Y\253\256\305\331\024{\225Y\034\215\262\201\266"
+	.string	"\204\314\374\262\321]\377\203\337\340\027\t\020"
+	.ascii	"=\023\030\0278G\021\007\210\202a\256p\032&.\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k\317\005u\314v\236P\306"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.part.0.323.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\375\n"
+	.string	"\246TJ@ \213*\035\237\002\2229"
+	.string	"\352E\341\250\260M\376\351&\220uI/M\006\020Xy\300V\373\033\3060\200R\235\220[%\024!<\003Dv\356\261\316"
+	.string	"#uO\210d\032\342\2144K\310\336r\247\0246"
+	.string	"9"
+	.string	"7"
+	.string	"\223\3173\260\355\031`\320\266\360\360\264\023\0244\210X\030vw\373T\005\007\257Q\202\376W\227\214H\237\253\003\211\300c\304\245\306\261\273\216\024\270\347mc\330\276\260\277\021\273\002b\031\026\301\234\260\340\252\333o\340\361W\236\250<\017;\261cA\006Z\273\241\305\247c\264\357\340\017\300\207\035Kv\023Hh\355\206\225OWD>)N\311>\345%\262\317\032>\353\020"
+	.string	"\370\250Oc\274\351{\331\247\346\032]\270F\275h\003(\306\254E[\303\211\037]\265\n)\027,\244\237\250&\253\274\\-\3312:j\3643\371BA\034\b\232\217\016s\361\330d\272\357\343p\017\346,\335\347q\033\027\262e. \230\215\3734\233\205b/@\367m\033\317\373\266\311\345j\311\222\324\013\006\322\220\252\311vT\333\225G\270d\234v7\025"
+	.ascii	"Gc\034\255\300x\340\373\002\275\243\302\013\202\003D\3010W\270"
+	.ascii	"\275&\262\036\035\205`\313\363vQ\355t.h\323e\347\002\300\311"
+	.ascii	"\213y\247\245\351'\2241"
+	.text
+	.section	.gnu.lto_tryArm.part.0.329.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\006\b\365,"
+	.string	"\032L\310\020Fp\336M:\363\316\222*\017,'lU\265\334\227\236\366\033\340\331\270\177\212\303t#\2669\335\026b\327\376h2{\034\345\024\217\376\364"
+	.string	"\256X4\231\336l\326\346hC\365\231wP\031\037^\206,Q\267F\b\3312\311\364"
+	.string	"\350"
+	.string	"\372"
+	.ascii	"h\274\233b\026\307\354J\376Y\026\251cy\301E+\277\262\036\313"
+	.ascii	"\013\002C\262\213\325\202\217\0301\270{\311\030\374d\004\272"
+	.ascii	"\237\004n\204\3764O\204~\214\031\306\225\034@\271\305\247\362"
+	.ascii	"\262\030W\362\251\\\022\203/\345d3\256d;\205\326&)v\357\235\201"
+	.ascii	"\362\307\244\230U\365\347\2430\263T\221W\3469'\363\272\347\242"
+	.ascii	"\264\252\002w\357\365\375\264E\276>\b\250\367\303S\323\235.\207"
+	.ascii	"\236\246m\241\225?\365\240\261\027\3402z\035\250\367\223K\032"
+	.ascii	"\302D\016\035.#\220\363\300\212>Z\375\001V\324\352\024M1\331"
+	.ascii	"\243w\005\270\214\310\353\320\024\221?{\001\260\342\261sM\304"
+	.ascii	"\342q\324\252\252OsA\222LV\357\214\2208f\017kh\022\270\367\252"
+	.ascii	"XTm\315\005\313\264;*\226\225it\225\204\370\263w\016,a\367\320"
+	.ascii	"\205rI\367^~\360\353<t\346'`\346\037s\016\030\266\225E\315\034"
+	.ascii	"BD\237h\355\237l\335+\317\262\213\265]\314\354\002m\013,{3\354"
+	.ascii	"<\314\037s2.\370G\230D\211>\261\004\372\263\255M\253\262\225"
+	.ascii	"\034;\006;\216\201\232\371\307\324'\336\376\354\351\031=K\360"
+	.ascii	",\205v\252m\027[\241\233\327\016aN\233\215\322\346\242\264\231"
+	.ascii	"(\327<\304k\026R\233\203\324f \265\271\247k\376I\233yj\263\232"
+	.ascii	"6\247i\363.\327\254K\233si3\272k>u\315f\256\331\346\232\373Y"
+	.ascii	"\316G2\233\034\001J\336{\025\267\347n\235^\224<\313\357\345\r"
+	.ascii	"\200\314\313X\f#\305PIB\032T&\232\236\245\030\334\035\2221X;"
+	.ascii	"\030\030\feiP\005\203P\350:\253J\372~2\231\356D\314\347{\371"
+	.ascii	"\302j\232\324\323X\355\302k\277\306\373\032C\232\370X\336{\037"
+	.ascii	"\350\266\240\361\203#[\330\2757A\326\\\253J\n\323\376f\274\367"
+	.ascii	"2+\030\336\033<\320\263@\366U`?\266g\001"
+	.string	"\330\251Z\362\354\217\275U\237`\307)9\237\225\211\356\336a\004\276\236\357Y\233\360\217\374\344\325\311\372d}\202\376\344Y\b_J\253\332\2412\034f\252\226\301\216[\241\210\270\342\246\325&\264S\273\024\316\374\021\272\263\251\235\235\215:\252\301\323:\235\201\026\360u\fe^\245T\350\023u\366m\334v\264\r\355\024\017h\346\013\030\372D\376\331\177\303\214\307\222\301\227\337\362\004\3065bI\261\267\234\235sb\235\377\bEm\316\336*K\330q\314\177s8J\0314h@\177\242v\304\261\f\224\234\355\372\006\224\315\217\307\265\2607\tZ\356\026\364\033\320\323\236\313\355i6p\360\340\001\375y\332\037\217jx\350\364\230\372q\332\256\0067-\217H\231\233\266\237\3415\020\254\306j\366jn\354Ym,\314\313|\231\333\254\002\tj\305\0230\312\351\351W\342\007\024\340\364\004\265\304\324\341\004\323\n\023KPM\026R85\261"
+	.ascii	".\025A\201`b\321\364!\312\211\t\b|\361\373\341\037\022\023\360"
+	.ascii	"\351\347\373\241\36095-\261\360\375\200P>$#~j\301\004\364E=="
+	.ascii	"\001}*3\367\223\202V\030\364ChDZ\201k\344\265\250z \255\204\275"
+	.ascii	"\005\327/\364\270~Y\255H\220fpo\003j`X\243\003\350|\0337;m\303"
+	.ascii	"\036\200\037[\333\260m\034\333d\375Lh\364+\216\253\025\253"
+	.string	"\257\270\2159\213S\304\007\317v\261y%\324\310\366\23326^ut\016%\335\2757\002\367\215\306\261\356\340\261\"\221\350O#\013\301\215\03289t\250Gh\321\216\253\177\204\022\331\"\313mul\032JZDV\306\361\016\2240TWK\322!\007\375\373\025H\220UH\2378\024\246\013CZ[\013y\255H\326q\016\334\233\220\345\276=\265~\255FV$H\320 +d{\255\212\315\2526\200\266\250\201$%\225b\212fD$I\n\222\306\200\002\021\252\262n\021\260\261\204'\205\264\031\nW-#\245\274\207^\211\223\337\344\21550\304\320(\314,\205V\034\353\327\304\326\223W\244Zz\327\210\334\313)\252\212\200\"\357\211\226\374\351w\252\203\267\021Y\261,\025\271\355no#\\T\214BZA\306k\305\317k\261\270T|s]\007\273iJJ,G\214g\036zp\305&T\213u\306L\212m\235\r\036\004%"
+	.string	"\255\347\230\004\223\315<O`/\r\317\230\2714Y\212\351\366\200\232\352m:\213@\320\357\320\312\264\213\270A\305\"\242(_\344\24093^Z\032\2521\316uj]\203\021%]j\257a\373w\203\304\f?\372+LK\tD\301\b,\0170\205N1\364!\204\301}l\203-|\255\366\276\214MB\360(I\333\"\345j\n\020\223\362\0266\032\277\325V(\365\364W\005\f\331\240\004\245\243\326\024(\246\307\376#\234\224\337\367f\241\261\b)f\214U\035\233k4\3000\337r$"
+	.ascii	"\230\323\215\261E`\2011\351\247\246\304\247f\033da\036k\"|\237"
+	.ascii	"N\243\222F\215\330i\373\256\022\243R8\206s}\351\340 \362\247"
+	.ascii	"CAi\302D\006\220\336\205\303h{]f\263LB\224\2300\032\311I\343"
+	.ascii	"(\353f\233\377,\304T"
+	.text
+	.section	.gnu.lto_processRx.part.0.337.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`\n;u\345"
+	.string	"zV=LI\020\020gm\215\001\253\201\022J\220O\366Z\311\311\217gS[V\236l\363\013\033\310\235\337W\032i\372\251Mk=\245\274\013\276\262`\304/\313\325\275\3473\307\334k\253\327gO\023\325\004#\240G\307\031c\277\233\337FRJ)\237\004I\004\343\004a\333BB\030\177lwj[9\275\307=\330uX)\030\2305Q\215S\333\243\243d\016\347\025Io\274\\[\324\366T\360!\303-\310\312@\316;\276qo\025\227\2141\266\024|"
+	.ascii	"\033\016\263\222\227\002\227\230\225m\332\r\367\037+\265Mxo"
+	.string	"\264V\265>n-+\233\332\217\351\370~\275\320;'\306\302\3045\n>M\314\312F\262\220\336c\f\3207\206N\275\307\357\006\347\215Um\204\336c%\324\316\242U-C ?\365\036\007]\307\220Y\3256p\223Q\302-\327e\332\256]\350\274N\323z\254\034\243\344M\t\2323Qg\242\372\355z\233\t!\232\026a\027\336]\221\273\"?\177r\331\256\25233ef\252\347O\356\016\212n\316\b\027I\347\214(\243~[\036\035\327pOn\270g\0214\373j%\307\266w\331\t\232\334o=\206\225-\0349\276q\r\200\351\333\362\276[6\304\034)\222f_\256\237\261\265\255\332\366}_\244F\362\013\037~\357\254\222nKr\314\276\\[\374\316\334k\315\326\354\266$\214\341}\257gw\357\233u\321HF\341\323\310\242\006\221l\344\261=$\033\311\334a\370E\f%[\357\233Ubf~\021\243\311\317\316\222i}"
+	.string	"cw5f\373\276Y\245F\276\n\375\354~\322^\335\325\\\275\325Z\355\244\263\272Ic5\265\231\364\222\276j\253\236\266\264\243]\325\320~\271\313\215\314\310\213\254\310\211\314\345-#\362!\347aC\306\303\205|\207\t\331\016\327\341A\246\303sX\016\013r \307a8\f\310o\370\217\335p\033\326\262\037\3671\033\346\3435\374\002\253\341=\326\3434\234\307h\370\f\273\300x|\307v\\\307f\270\f\323\361\034\313q\034\3031\031\036\303-\360\033\213a7\316\332H"
+	.string	"\201\032\007\030P"
+	.string	"\215\0312b\020"
+	.string	"\343\305"
+	.ascii	"\002(%\271h\201\304\"\200\025G*R\2408a\302\250\210\2109$TbIb"
+	.ascii	"\204\210\020 >x\350\300aC\020\220\206\f\312\037\f>=I\344\361"
+	.ascii	"\275\241<\271\241\335Oznph\201\267\b\227\245\333\013Kw\027\026"
+	.ascii	"\256++xo\221uk\221\211y;!\263zgU\273\233\204U\275\261\246aS*"
+	.ascii	"\336T&\310\"\2745\354\224\356%S\300\274\257\246S\246_\336VZS"
+	.ascii	"\255,o\351\264\311\324\211wt\332d\212\345]\345`\323)S\2527\024"
+	.ascii	"\313\244\373\2352\t\321=\302\230n\303\204\256\321\3561C\342\325"
+	.ascii	"\233\351\022\347F\306\306\346E\306EgE"
+	.string	"\305\346D\305Dg\256\"\327y\213\270m>\334\326q\316cg\320\331\020\017\235\346B:r\234\357\314\021t&T\264\343\027\350\\\247\257y\260\217\2153\235>>\3479r\3264\013\276\240\30690\316^3\234\275:g@;3\316o\354\3128\377\3215\2739A\327\334F\256Y+\027\347\354\327\346\3347\307f\215\315\231O\255yM\030\347\027\324\322\234\325\2405\357\241\2359\353\2315\2471\013\273F\2658\347\2419S\206\305\331\005\274\025\2568\337\331\225\2119\327\2319\266X\013\273\262{r\035+k.S\rs\246\253Rq\236\263Nq\226#\003s\216\373r\206\323r&\343\304yL\b\241k4\313\271\205\020\327h\023\347\267,\307(\327(\226\263\230\017n\234\rq\215R\205\256\321%n\243\353\t0it\004\216O\256c\324\256\261\350\007\b]\243TE7\2001\321\013\240\261\365\031vZ\206\035\275:\036\203"
+	.string	".\035\2071\247_\314\221\343\003p["
+	.string	"nb\240+\371u\222\233-\277.[}\356B\220\215\267\350\271\201\264\246Y\254\351\304\027<"
+	.ascii	"\276^\301\267\347Gv\255\302\256\316S\230i\024f\234\253\214\237"
+	.ascii	"\240k\023tsn$\347EqN\324\346L5Cl.\264\246\346%\334J\3152-\214"
+	.ascii	"\223\350\262\205\226\330Fn\266\302\370\2103\027a\346!\2648\210"
+	.ascii	"\3012\3770\230\305=\fb\361\016\0346\254\320Adb\016t,Z\243\275"
+	.ascii	"\"JA\214\333]\266\254\256\341J\3253\270\331\272\322zm\324e+\314"
+	.ascii	"\225=7~\214\256]T\032\003\225.[`\356s\004\321f\214\016\013+\337"
+	.ascii	"\223\356\262\365\345=J\256+O\272\331\232r,z\337\327\312\221N"
+	.ascii	"\345\202\322G%\020\227\324\377\310\202\020\357\020\210kz\004"
+	.ascii	"\241\245\205\332z\355X\\Q\367\016\335Pzn\274\357\313\033\260"
+	.ascii	"e\315\035\245\231\225c\230\333\312\234D%b:\371\337\210E\f\034"
+	.ascii	"\032\r\312w7or\354\224\357B\360\313\365\246ZW2D%\377G8\301\342"
+	.ascii	"\206\347OP\352\211\312\307\226\351q\003L\301\252f\370X\304\300"
+	.ascii	"\331\375<6\311\036\347r\317\350s:M6\262\267\302\354\316\fYX\371"
+	.ascii	"\2740<\226\177\036\371Ro~\314\317+'S\304\347}\2452\330[\3601"
+	.ascii	"O&\334Y\032\311O\254gVV\262\221?\337_\302\352\270lU\336E\263"
+	.ascii	"vf\305\347\261\375\204\222L\376\263}s\267\333e\354\031Jb\300"
+	.ascii	"P\330=\224\364y\f\317~\365\025\365.\263\263y\033\016\255'\027"
+	.ascii	"\327']\371\252\362n\267\333ML~\351\236\377\341\325\363\255\327"
+	.ascii	"\335\004\316+\313%d"
+	.string	"O\3630O(\334Y\370)\345\t\346M}\202%\033\231\374\206\323G\205p\f\255k_\307G>\023\320*\261\312\273\374\302\271\335<\253O1o\352\361\373\2579\230!\203\270\305%T\032{b\275\251\377\310\300B1m\364\241*<\313V\024R\321F\221HX\236eq\205R\2643\264v\272\034\237I\177\257\363&g\2053?\271<\275xS\375\273\255J\364\241\374\335d\211\204e\376\261\314\\\242d;I\262\377\241o\260\274\365I=\221Sx?\363\023\314\023\315\233\312\255\327?p\\/\227P\372P\177,\177C\351\357v\273y\370S`\316j\202Ee\262d\351\334WB\316m5\225F\331\271\253\330\271\241\354\334\357\322\371\271tv\262s\223\235OX:+ag\023\3309\t;#1r>b\344\\\002;\033!r\246\"r\2362r\2262r.\302\316$\260s\024;C-\235\237\226\316D\226\316#\2603"
+	.string	"\214\234\235\214\234\207\0309\0131r\016\322q\315M\354\f\304\310\231\311\310\371\007;/\261\263\b\354\354\303\204s\b\354\334\203\235y\2603\b\354\374\001\323\331\003v\356\200\2359`:o\300t\336\301\316:\214\234s\0309k\300\3168\3309\003v\306\200\235/X:[\260t\256\240\351\232)(r\236\240\310Y\002!\347\b\226\316\020\260\363\003Kg\007J87@\302\231\201\245\363\002%\234\025X:\337X:\333X:'@\344\214"
+	.string	"\323\271\006\323\371"
+	.string	"\246\263\001L\347\002\226\3164\210\234g0\235e0\235c,\235\t`:\303`:\277`:\017\300t\026\200\351\254\304tN\022rv!\344\334\002\211\351\314\202\351\034"
+	.ascii	"\323y\005\323\371H\205o5\247`:\243`:\237\030r61\344l4\344\\4"
+	.ascii	"\344L4\344\314\034r\036bg!\257j.!\344\274\024r&!\344<\302\247"
+	.ascii	"\315\"\3309\004;\203`\347\017\354\354\201\235;\2603\207\245\363"
+	.ascii	"\206\245s\320\322\031h"
+	.string	"\351\254\241\204s\006vV.\235\177\226\316\030\226\316>\354\334C\30299\302\371\330h\232\237\235\275\263\335\355(\034\361\030\203\254\357\253\325]|\253 ]0\3534\335y\335h\272\361\272\353\272\351\272\343\272\007\273\351t\343\351.\354\346\266O\333\253\332\267\332\277z\313\363\370~M\377Om\253v\266\304\317\021\323\0074s\247v\246\205q\024A\263dZ\214#9\226\266Uk7\235%\207\020\316\001c\flJ"
+	.ascii	"\256p^\017\346\274\037@6)wVvX\331\341\304;d\300\231E\351\343"
+	.ascii	"\255W\372^\231\214\353E\362\301G\216Y2\256\022\372\274\022\225"
+	.ascii	"\032Y\205\203\021\230\203\004\260t^[>\"K\326\265UU\302\036\034"
+	.ascii	"\337\257,YW\217\251I\263HL\305\303\236\330\203_2\255B\341\200"
+	.ascii	"\250Y\327\024\316\3720\231\233=J\357\261\203\261\362\313\245"
+	.ascii	"\270\024,VvN\027\367\226j\231m\037\272\227w\261\216\252\2357"
+	.ascii	"\341\332R\342Z p\226;i\272\026\bEU\331wK\371\246&Nm\273\306\247"
+	.ascii	"\221\033\274=$\235\211S{\370\025\013!\356\365`v\362+V\"\363\267"
+	.ascii	"\025\331\243n\305\312\251TZ\344\370~\325@\253\263e\316\307\253"
+	.ascii	"\034Z\304\241E\200\376\352\266h\210\314\215w\3254g\207\275\350"
+	.ascii	"\243\025\271=@\007\r\021\023Y\311\335>\267\317\261:\355\n\254"
+	.ascii	"\364\301\254\274\203\247\r\t\003\\4\375B\243\316i\b\2703\204"
+	.ascii	"#\026W\260\340K\236\253(\326\2723C%\356\355\304\312rjy`\"\030"
+	.ascii	"\255\264\007\213\254\202\307\362\216\357\367\303\267\276;I\234"
+	.ascii	"\\N\267\035o\003\304\332\031\005F\222\024<\322\3150N\321\225"
+	.ascii	"\013\023 \241\206\177Y-\254\004:^\312K\307k\225\213\340\261\334"
+	.ascii	"G\311\034p\336\0047\274}\224\324\340s\274\234\237\003\002\024"
+	.ascii	"\247\024)\311Fj\360'X\311\274\324\f\027\0048>\b\016\260$\223"
+	.ascii	")(<\220A\321\233\201\024m\007/P\2748"
+	.string	"\200\001\006\337\201\211P\032\270\340\203\370`_\360\255M\364b\300\202\n\336\202\277\n\236\207\265\005\264\257\t\236\202w@\253>\2746\354Z!\301O\020\301K\360$\362\254\b!\370\b\276\301^\373}\357\347\244Ru\212\211%\033\t\3017_\265\313e[\340\205\346C\334\232Q@\315W\365\020HK\ni7\036\370\fZ\242\374\250\235cX\247\n\336\324\007>)VE\372P\033\256\327\016\\\371\274C\007\3164\360\375\244\232\207\233@]3\200\307\300\367V\325\016\332\027\002N,\3172D0\316\236\366f\252\203g\206B|q\2065\036\273\300#\337\255\274\365\225=\235s\321\211\270\300\313)\360]\346\212\336TK\313\001nu\332\f\270a\343o<\234\215\347Q\215\203V\300\230\026h<^\035\025f<6K\213q\232!\340\326Bg)\234;\223\221\300\227\320\226\300\221\260\372\006m\321m\273\030\003\2015\265\032\217\300\217"
+	.string	"\274j4\353\003\276\306#\001Z\245\031\360\005\374\001ih\006\034\333\360\006\ra|\177\001\337\213\004\320@\204\321`\002\360\202\306\027\032\217\244\332\2076\300\214\357\302E\306\317\370\021\200I\2221^\306\267U\232\226\030\337\200\202_\002<\226_\205&\340\221\\\203s\224\036\3534Kbq\232\331\340\277\362+8\271xq\262\340d\201\f\231a\225w\351\344t%=\226\211\032G\222\200o+o\005\007\230'\027\001\217\244\312\307\375\252\362\213\262\271\200\361Ro\202)\300\370!>\260\026\217\275\266m\251\352\235\031\"\275\250\202F-\034\340\005\370\027V\264\001\360\006\267(}\277"
+	.string	"\337\215v\323),\224\276\257aJHn\203Y\254T\026\002\230\373)\235V\265\333\032V\255x,\243\200\363R\247B\305\213\270\362bM\221\342\221\036+\351\352\342\223\276{\002[\274\013\244o\361Dc\256\032\003\370\025\317\342\333\312\032\365\256\024\264"
+	.string	"\216\\\356\3209\372\376\025\357^}d\001\360\216\230\036\231-P\216^G\325\356\350\261\235\342U|\20715q\254\032\243*\346\272H\222\216\2350\337\345\\\213\361\\)\236G\265\f\227-\205\326Y\025\016\305c\237I\243\370\276f\241x\347j\344Y\025\016\355\304c\031\253\357\302\272\334\260\240\3061\023\235$y\342\273\313\233\340_\375\222$mN7\267d#O\274\006h\234\255um\221\214\221\t\2437\361R\266s\341x>\372UF\2146\270YEED_\324e;\027\201-\274\221\221\350;"
+	.ascii	"a\214hl\205`D\217e\273\216c \351\373V\235`~[y\343\033z\346\373"
+	.ascii	"\240\325\366\315\023\331.\211\214\331\205s\235cR\320@\364\255"
+	.ascii	"\023N\316IG\227l\344\320\367Y\330\342\233.\314\307r\211G\276"
+	.ascii	"\006+o~\336e\2536$\364\017\307\003\017j\316\263s\342yS\205\276"
+	.ascii	"\271U\244e\356\310\204\036\313\"\036\371"
+	.string	"Hh\234\2777\277\345\227x\213\003GG\342\227\357\324>\246e\301[\273\"c\350\315y\311\021O\342\333\252\213\210\037\361\"\336\352\272W\215U\336=\343w\212\324\b$\024\361n\325\307\3030D4\260*w%\314\364\177\0068re\322,C\374k\361\n\361\315\306\013\f\013\t\020;|C;\365\3248\327xSA|'vk]U\357\330\254\024G|\370 N6\037\276\003\361\204\321F\177\340\364\246\"<\310\361\363\3604\302\352\240\021u\273\335\020\035\002\333t\340\332\350v\273 8|\0208O\347\337s\312\341i\204\r\2425~\350\"\311\r\037\344M\216\023\320\377\332\270\033g\034\247\240s\316\234d#7|\bat\270l\212\036\036\353n\035\344\343\306\263\r\364A~@\217l\003Gk]C\354\340j\272G\212vK\250\200#)fyR\367\204\003K\035n\220\300\273\235v\222\314\316;N<\201\205x\264\322"
+	.string	"\362\354\335\tj\034I\r/\365&\307\231\307\323\340\360y\337W\006{^\020'\"w\026\t\222\215\324\360\030\330\252\\\3603\0228\271NE\247b\262\221\031\276\247\r\240\326\272\246\200\267hfg\367\t\365\323J\037zf\016\0277@\001<$\t\211\224\222\020\022<\f\241Zz\342!I@\234H\030\301C\222\232\236\234\250\224\240\242\236\236\242\230H\360\220\244)&\037LRJLB<$I\252\t\211\323\223\3222\211\024U\323S\023\221&\035TRQ\031"
+	.string	"i\222Z\032\222\003\252\211D\222%\252\245\245& AG\242\210l\240rzr\252@\007\020\247\247\rTC\2048\021y\240\211\310\217%\252\034PN@?|\370\222\017G\342\303\247\214P-Q\345"
+	.ascii	"\242\202jb\222j\312\240\211\b\025U\224\324\020\252\240\246\022"
+	.ascii	"\234\250\230\024 \022%E\005\025\305\300\020&(#KD<L\355H\262D"
+	.ascii	"\244\251\201'\251\245)\247\006\242\250\214,qh\002\022e\001T\224"
+	.ascii	"\tNRQ\0214M\355\200Zb\3420\265\243I\210\002?S;\226\250\21045"
+	.ascii	"\320\364\264$\025$\303\324\216\246''\035TPMRRF\23040SR\223T\024"
+	.ascii	"\223\022S\020%(\247\245'%&\251)\245$\020\034EB\223\224\022UT"
+	.ascii	"\224\224\222\362S`:\355\225\365XY\3177\252>\312G\216\357{\265"
+	.ascii	"\321i\272\t\305x\367IW\213\016\222\323\\H\335M\036\213\233\240"
+	.ascii	"\340\245\246\273\260\376\023\033\213\213\352\323f,\217vK\204"
+	.ascii	"\334\030\033\255\324Kk1y\2672\366\364\342\177\024\034[\243\215"
+	.ascii	":y,{7Aj\033\324\252\265\261Zt[=V/\351\253"
+	.ascii	"\357%\310h_=\017\262Cn[a\237Pe\025\351\361\315\332\353&\323\377"
+	.ascii	"\304\236\3365\226\364?1\205\324J\255nq\t\273M\375\302\b\250\302"
+	.ascii	"X\327\025\260\227\231x\310\326L\270[\310\372\266\206W\236e\207"
+	.ascii	"M,\3172\2409)U\270\204Q\300m\236^\022}\006\362D_Y8fk]c\023X'"
+	.ascii	"N_U\275\263\341i\226U}\177!\343\343vA\003\333\n\372!\3404\364"
+	.ascii	"\225hU\250U^z\332\357\007\245\rv\277\337\223\247\na\031!\264"
+	.ascii	"\245\317,9\316\177\332q~\017\206u\264\371AiAM\263\346;Xw\331"
+	.ascii	"\234\224\227Kh\327U'\370\274'|_\373\032\252\247W\250\006gL\277"
+	.ascii	"@\317\366_fnl\236>]$\251\344\177p9\3029\2769\0026\275\260\320"
+	.ascii	"\004\003&"
+	.string	"\331H%\317\203,\017\315\331\346\312\326|\345\256a\264'\230\360?\220&|\313]\321\224\374\3645,\360\f\031\023\222|_\233hI\336\345\256T\264\321$H0 \371\276~!\321\023\274B9\302\331n\tG8\333G\311\022\376\b\232\022\272hF\214\034\215\3743\221\212L7\0177\362=\t3E\365|\254;\3329\315\3024\327\326\222?M\"9\365T\377f\254\322\242\315\266#\235\323\254\351v\234k\276\251\bl$\037\343\216r\3151M\270\246\234\\\262\221S\337gb\210\334c\227\215V\312h\360d\363HIa\270\276\t\036%\213\274\324[\221\357(b\207\\\207\216\315y+B\302K=\t\337\201]5\332F\022\242\276}\242\276\271\252H\033\243\240\376\307\261\332P\337q\335<F\250\247Wk\305\306\221\034\341\237^\371\306\210x\365\025\355>\021\371a;\366Pr\204'r<\033\341g\b\022y,\003@\b"
+	.string	"\337w\3350#p\335\326\221K?\277"
+	.ascii	"`\212\007\335%\273i\306\256\211\327\025\323N\031\235\234\216"
+	.ascii	"\222C\336I\313\220W\242\320\270\305\272\366\2458\004K\243\237"
+	.ascii	"\023\300F?!\256&E\331\013o\020!\336G\311 /\204,\310;\305\362"
+	.ascii	"\032\317\334\231\002\245\322\364X\306@+N\033<\177Y\200<\226\201"
+	.ascii	"\264Q\257\354~\370\\7\2356'WvK\376\245\233\036\013\210\003y'"
+	.ascii	"\233\226\313t\2746s\363LsM#\232\266\255\333U\374\261\004\305"
+	.ascii	"\273\233zj\232k:\260Q\013\265*\302c\177\260\231|\n\337\004\217"
+	.ascii	"\222?\236\351(\366\343{\356,j\273\255\333e\364\261\364\177\310"
+	.ascii	"\345\336M\277$s\263M\363\317\233\272\364I\257\020DxOk\002\212"
+	.ascii	"\360\355\245\207\217\377\321>^\303\325\235,\227\220G\023\017"
+	.ascii	"\341\231\233\202\3159E\322c\224\243\224g\230\301\246\035oj\323"
+	.ascii	"N\262\221!\374\013k\227\013B\217\357\025\216M\272\307\367\250"
+	.ascii	"\"\375\200\207W\363\016\217\177.\304\255u\255\211Gq\r\242\007"
+	.ascii	"y\236ey\035\200\360?\216 \274\022\0278x\254\224\333TT\\\323F"
+	.ascii	"7\370\340\177\020}\360}\247\350e\207\007G\252{\360\375\304\032"
+	.ascii	"\247\261\333\246L\307\227%\200q\212^@Q\360rt\360\3156\355\340"
+	.ascii	"{\240\207UX$\336\321\340\030uZ\375\266\217\330\036\227\310\370"
+	.ascii	"\344\013\216\025Zf(\340\371\313\340\370\362\2355\031\237e~sS"
+	.ascii	"0\340\340\273\013#\007\377\201U\017\355k\203W\374<j!\005\337"
+	.ascii	"\277\301\367\027k\232h\0342\027\314\005\205\013\250S\222d\361"
+	.ascii	"|\244\346 BC\"\"\222$I:\243\025@@`P.\237\315r\315\007\023\200"
+	.ascii	"M\tcA=\226Z\347\214\220H\222\244PcZ\003\230\0218\233I\335CU1"
+	.ascii	"0Z&A\231\002\225Q\375Kh\003\243GD\020=F\253\034T\021?\356\372"
+	.ascii	"\211\2133\311\013\207\3067\216\2673\331\375\367\311\3270\300"
+	.ascii	" \f\256d-g<,\n9\022\024\333\302\177\250`\373\211L\367\236\267"
+	.ascii	"z\3675T[>Za\005\353\320\363U\\2\220\321\"d\250l\257\204\213\301"
+	.ascii	"\265\333\265\342\270?I\t\264\203!\2425\220"
+	.string	")\321\355\037xdv\252\365z\375\370\362k\242\253[C\372\023\020\373\363\351bk,k&\225x\242\237\201\201\003\274\030\205J\342\245A\264\026\240\323Xz\204\237\032\030=\212\252j\275\253t\336\203J\240\350\223\265<\026o\376\366\347\202\243\022\016\030\374W\204\365\202\263\262\323\246\t\rp\200\370\354\023\002E\3529\016\207\b\345\300\355\352\r\205\270s\245\207+\210m\301K,T\230\037\266BG\372\245d\376\367B~\355X\355\002Qt\261\036M\305m#\031\311\232t\351<Zi\300(\250\327\243\376W\214\001\274\2649f\037\244(\371D\263\201\355m\017\0164\310\244U\330\244]\006q\204\022\210g>\203\230\343\316\212B\020\027\314\242\2507\002\332\2577\302\274\224\f8\364-\214F\242\232\222\346\334\250\267_\322\336\017\272\322{g\177\312\262\226\264\331(\251\336\365u\305|\335\270\236\276Q\237a\200Wb\356\004\006J\207"
+	.string	"H\217#\215\032\201+\005\270\265WU\003\330X\003\304\253S\234\035\305\350\242\030Y\340\b\350\320e\fqN\346\254\276\211C"
+	.string	"\267\210\213C\230\035\001\353N5\320\273\202\017\347\243\004\020\314\270\226\315%H\231\240,8\326\237\313\242\003\273\247\204\006\376\2520\322P\203\301Q\276l^\305\330\330PF\335\207G\274B\316\333\313 1>\2316\031]\204\311\352w\367\256\341\321S\212\344\340\224\244\307\\$\237K\331\327>\351\220\215\300U\353B\265\376\022\3743(\245\260d{\264 \001\0333\256\n\3272"
+	.string	"\206\312-\265Y8\223\220BI\203\364\325Z\370\212\036:\372\0222H\213W&<R\215 \2374-\026K\fh\311;\n\374\271\216,\352\021\353\023Z\223A2\0160\022\273\225\213}\016\327\247f)\026/,\365\235\013-\023\257\230xfB\023\\\331/\017s\262\363\035hC!\364=zvd\330\352\317\237\"\206\203p7\375@j\005\207\226\034\372\246\376\333\205A Gi\331z\376\217\352/\r\371\301/\223\371\251\327~\246\336\001`\271\314\352\322(\275\373'B\377\343p\347\272\205F\232\254>\226\003\242\303\307\032\274\033\026{\337\217\276\351\037RF\360\275\rC+h\314hM\0364\370\366^\352e\031\214\270)b\023SX\300WX\031\fu\0354C\304\2208;\246\271\224\372C\360\342\315q7\355\013C\273\007\345\026\262\fU\227\247\025\225l\005\314"
+	.ascii	"\3259\037\240/\316\301\360\220U\353\363J\226\200\317%\331\"x"
+	.ascii	"\354\2015\005L\003\212\020DjS1\342VCb(\233\314\252\312\352r:"
+	.ascii	".X\203\355\360\016\300\311\355\f\267\276\030\214\261s$\272\005"
+	.ascii	"\276_QG;H\2523\231\361A\255\024\207\212\353\223\302\034#\325"
+	.ascii	"\354\256\376\006\245gt\256\006\240\304R\357d\344\322\354in\265"
+	.ascii	"\230[\247\361\377?\202\276C\377\203\205\003H\216\333\034:\222"
+	.ascii	"\bm&q\247\230\253;\235g\300\235\316\2245lO\234\023a\235\316q"
+	.ascii	"c57\013\235\212\002\006\273\001\f\002\220\r\230\254\200\212\346"
+	.ascii	"\256\032\210\217xL\263\246R\231\203.p\335\177\331\tT\315\264"
+	.ascii	"3\367\210\332Lc*\224J\205\342\325D#\030\270\363\310\375\372\251"
+	.ascii	"(\034\251\355\030\036\207\222\322R\324\260n$G\365*\241\232y\001"
+	.ascii	"\264\227\377qu\221\366\367o\2528\216\2406rNQ\263c\324\243N\023"
+	.ascii	"\001r\206\346\304\303\263#\243\276\243\340^*\024l\230=$u\215"
+	.ascii	"5.6v]\f\370N3\361\002\234\257\030\230\0056\006 \266"
+	.string	"\023\217\234\350%c\314"
+	.string	"\353\320\230Cs\262O\370\315Um\257!\354MW\272f5\302\030IA\224d+\026\236\027\226\320f,\244\356\260Eu\307{\013\363em\360\221r\n\030]\313\022\274e\177\246\"dO\262\352c\270\317:\204\036\346V\344-\327\245{\001\316\251*\025\264~\337\310\301\022\316I\363T9\034\034\236\213\212\326\340uQ\254\201\200\036\265\256Z\325\b`\001\234\f"
+	.ascii	"C\213\274\274\222\240z\306=\030\324f\314\223\363\373\320\242"
+	.ascii	"-q\251M!OV1\262\035\200\203\273\340\302@\017\301\340\265\301"
+	.ascii	"t\2700\320\345\340\327\235\370\026\005\215\342\216\274\246~\212"
+	.ascii	"\2040\334\366C\021:;\023R\211\222d\2636\037\265T\320\355\252"
+	.ascii	"t\307\"\027\376\2068\005\350\356N|G(M#\001%\305*\305\233X\312"
+	.ascii	"e\r\365\270\304\347G\236\237L\330t\270\001{\314g+\355\231q\315"
+	.ascii	"jk/\243\314\334\304\212\3708\253i\363Q\023\b\374\370\215\245"
+	.ascii	"\374\2375\255X\242\f\034\260t\260\225~}\350Pm\255/`\240\240r"
+	.ascii	"[54c\n\334y\315\373\335On\364-\265\220i\225H\206\0250\306\314"
+	.ascii	";\241\377\341\341\336\177\025\f\223\262[?M\325\275{\312\035\337"
+	.ascii	"\004\003!Z\005z\036\370\243\222\252@\016\364R<\326=\322\025X"
+	.ascii	"\212w\331#\223\001\302\376X\362w\275}\002BVI\007y\262\006\267"
+	.ascii	"BDz\370S\317\221\354\262[k\342^j\205\2126iY\355\347\251\032|"
+	.ascii	"\001\2170\227\033ok1\013\023\350nw\271:\023 \324d\003<;:\260"
+	.ascii	"\372\n\211\255\300?)J+\347\3658\020f\027\352nBB\231\021\317\217"
+	.ascii	"/\262\357\307\267\006\377\303\220\350q(W\033[\354\311h\222\364"
+	.ascii	"\031\246,\275\377\003\341\274\243\377}p\247\300\250PdE\026\357"
+	.ascii	"\235\007\036\025\317c \240Rb\272?s\222\325\353\340;c\212\361"
+	.ascii	"\bx\3449\273\025\261\264\377E\035\344\342C\320\201\f\221\260"
+	.ascii	"h\204\224x\023\002\250O\266Q\223p\352\350\013\274C\310\235\013"
+	.ascii	"+\235aJ\371\216\316\216q\002R\301\301\205\030\340J\220\027k\244"
+	.ascii	"+\232p\035\020\325\205t\257vO\2343\025\267 .s$y9\247#\223\022"
+	.ascii	"\002o\3706\355\"\311D#\211\230\246\302\346y\313\311\216\227n"
+	.ascii	"|\016\340L\226\317\353]\337\353\206\310\001\331\256\327p\302"
+	.ascii	"\364r\343\r\312Aa(0\327\3343\373i\311Dg\002@(\002\340\r?\236"
+	.ascii	"'\242K\343\224\243\370Ja\214\355\241\206\227\017\373Q\017y\367"
+	.ascii	"|\300\b\214\311\346\310\034Q\217-=\306\353K\020\004\266\231\346"
+	.ascii	"\203o&\277@\305o\370%\250\3305\031\302\233\301\314\374\362Z\232"
+	.ascii	"\331\302\331\252\321\265\206\225W\\$Qy\013\251\340\177\236=\332"
+	.ascii	"\2736f\276\225\335*\237\363}\016\274\020\023\343\213\312\f8\300"
+	.ascii	"\007\226\3148bmO\201\217\250\363\355\252\255\20062\037\016\334"
+	.ascii	"\270\0172\271\322>\275%\270}\253\300\320O\nM\007[\266\326\007"
+	.ascii	"\0134\"f\337\bP\222m\245'{\341\rQ4\346\3037\202#^\355\233\003"
+	.ascii	"*\031\344\313\thk\026\272\035\200\350\317u\226\316%\251\232#"
+	.ascii	"\255\262\034\311;\331\376\321m\311\307\207\207\300H\301\306_"
+	.ascii	"\305\227LdC;\342$}\304"
+	.string	"@\tK\222$_\020x\316B\322\216\245\201\342;wR\320\313\342\366\216!Cf\255\221L\t\261\344\033X\257\237\352x\n\362\306\235\035F\007Q\357\335\250\244\246\030;\325\275\266\311\033q\367D\366\331M\235f\355\nj\255\327\027)\243k\2544\362\004\322q\224^@8l#\013d\210\276Z\313(\304\246\265\214\220\305\036\005\242j\300\021\251\375\202\344:\272\334\365]\377\344\246\273H'.\0346_R6\320\217\362\201\221\202P\344\263;\023th\243\365\247\250[\"\332\245\\:I\033\004\356W&\204O\035oj~\333\244\305\207\277\200C\313\312\240\377)\222\002tk\367\314Ca\227\342\205\313\276O\364\002\223\253\251R\357p\020:>\211\035\307\025\374\265\r^p\342HN\022b\352S\177&\023\237\334\356|\001\37024D\006\323\200\361\234\t\336^\004\244\200\257$\220\247\211\352}\243k\264\324\224\277p \202\346\212"
+	.string	"*\212i\312\257x\036\026\251\234\212\026[\333\206\256\036\005\n\270+\022\366\267\bW\364q1\377'\025$0S\253=LC\303\253"
+	.string	"a:\302W\330\2518+$\234\363\255*k{\311r\230\n\275\273\225\273\367\222\207kgz\310\201\215&\304\367\316+\231\265\240\226>@b\235\027\350`q\236\232\306\254"
+	.ascii	"w)|X\226\261n\001\020\325\016FyLu\007'T\3325\353hV\2311E\fc\035"
+	.ascii	"8\026h\335\254Ef\316\360/\035\027\210\323\2476\224i_hN\364\323"
+	.ascii	"&\264\f\370\\Wr0\321\366\367\017xs&@\351\266\204\r\231\376\235"
+	.ascii	"\013\341\024\253\0258C&?\244\242\f\027\237\347BvN\343\336R\352"
+	.ascii	"\032\203\244>\365\320\013\365yy\256\334\220\372c-\361K2.\002"
+	.ascii	"\001\330\320\216+!\272D\245\\\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`u\030\265M"
+	.string	"\032z0\0329 \246J:?"
+	.string	"\302\254\243\311p\272\271\304\2201\303\3779%\320\230!\304\213\212\311m\334\342\264\330\235u\326\0213\0240?"
+	.ascii	"@\006\371+.w-Y\224\006A\333\216\334i\007\221\001\222\001\235"
+	.ascii	"\001kp\031\213A\223\361\230\267\374\3003\371xf2\006S&\3432\267"
+	.ascii	"|Bd\362\367\332\362\001\261\345\007\032\223/HL\276\337Z\376 "
+	.ascii	"\265\374=w:\235\3676xZ~\234\243=\313\331\267<\314\265 \357\235"
+	.ascii	"\362\345\004\254\310\020\263\223!\357\365\341\304\207\227\223"
+	.ascii	" `A\276x\faR\341^\035{\331\275 \301\344\303\371\222\377\306K"
+	.ascii	"\276]\227\374:\262|7\\\362\333l\311\247\323\222\317\006g\311"
+	.ascii	"_\203?\206\273 \325\273(\226?\367'\326\202|X~\232;\363\341r>"
+	.ascii	"\032,\371g\256\374\021i\345\237\252\234\023\225\277)N\311\270"
+	.ascii	"\220\224|3Q\362\313\\\255\254\216\fJ\276\333\223|6'\371h\030"
+	.ascii	"\354\210_W\233\374\311\004\217-\311\217S\222\177\226$?\f\222"
+	.ascii	"\3742|\344bF\036V\344N\"\037D\016\271\240\220\353\030\3446\""
+	.ascii	"\275>\206\004r\243?2\366\303O\347\035\037\371`zd\334\007\363"
+	.ascii	"\310x\r\336q\037ud,\207s\274\020\216\003\336\270\036\033\227"
+	.ascii	"\261\306\377 \235\317\247\352H#\3434x\306\025\311\270\247\030"
+	.ascii	"\371+\f\234\366\342\223\220\355t\201\321Z\\\022\213|5+\260\231"
+	.ascii	"\n\234\005\231\"_\016\243\3107\303\035\215F\243'\362\277`\023"
+	.ascii	"\377+\361H$n\250\021"
+	.string	"w\024q:!p\033\210|2\370\303\327<\\\255\303\305\244\037\323\365\226\303\013\035lx\235\253a\032\236\206\274\367&\235\317\247\323\316\275\371^Bf\007\340t:\235\\\371m\370\336\253\240IPf\177\261\267\260\350,\315\315\304\354/Ef\203\255\236\230\r\306~b6\030(f/W%\373{HO\235\271{x\325I\270w\200\253\260\257W\355u\325\004\326\250IV\035\265R\262\352e[\311\252\227\254\245\033h\bR\237\327\357$\300\274\267+\311\252\227j\244*f`\030\335m\253\f\253z\271\376fb\332\\B\254\246\261\316%\244\002\320\bO\331%\244\n\020\bH\354\022R\025\030\034<\274\204TM;2_.!\325\r\f\344\026v\t\251\346\026\021\001o!Uk\035\300 \325\355\213;\334\273\202S\255\\\177E7s4\325\311\365\370\315\351t\276\375\367<\232\352\257o\257\037\322Tk\275\357\340TK\261\177\243"
+	.ascii	"\255l\223\355)\230\021L\273\320\333\2172\376\342(c/\203\031s"
+	.ascii	"\021\314\230\254Q\306[\240\371\206\214\362)-\312\257\244("
+	.string	"c5Q\306b\2102~\036\3128\314P\306\316\300\374h\241\374F\300|\306\277\374EB\371\241\006\345\203\022\224\257\030(?\021P~'\277\374M\177\3625\365\345g\342\313\307\344'\377\022\233\177\330'\337\322^\376\">\371\217\366\344C\322\313'\314\3138\214\236\214\317\362\344;\302\223\337\350N>\324N>\243:\371wt\362\347\314\311O$'\037Q\234\374Cx\371\206\356\362\373\340\344\363\275\311\367c\227\317\326\345\313q\223\337\247M>\037\272|=6\371yk\362\363\314\345\343\221\313\277\243&\337N\232\214\331\326\214\325\3422\016u\355\333n0m|GFuc\033\323\306xi\3439k\332\230\216Z&=\332\341\036\337\205v\265\336\333\256\376\232\330\325\311F\r\207\240a\301\333\236\365c\\\275l\237\205\253\227\353%\256V\266Z\270Z\t\367\313%\212\324\327\344\352\244\"W\277\220\353[\270\032k\357\302Vc\255_"
+	.ascii	"'\324E\334*P\266v\261\255\f\237\022!`\177\273>G\027\333\352\252"
+	.ascii	"\366\t\326Jw"
+	.string	"\323\326\365\023\224\350:n\375\221X\336M\334z\334\352\344z\366\255n\265\327V'\237\307Y\027\230\026Z\253\331\177Jh\266\362F\233\275$lv\324\352l\266T\333\354*5\261y\003]\222s\273\215M\334e\f\245\264\265\331\007\330gs\200\2447Z\222\253\243\204*<5\274\233(\241/\301\360Q\002\247\b\215\020\372\252\244\254~\250\254V\252\277\216f\321\366.f\265\2221\253\225\227\262z\3116f\265\326UL\314N\262J\307k\310l\245&f/\331/@\244\003\215R\243\330_\020\204\203#\240\236\352\316\223%\002\354[JJj\023\263\253\324\252\365\257b\0331\273\200\372\027(\320\276\351\366\372\026\035P91\373\300\001\004S\314F\200\340J%d\366\025\273\240\305R\177\261Ak\200X+V\333\340\371\246bv\003\266A\373\377P;1\373\007\373\243}G\r\231\rd\375\003\322\252B\332!m\"\263\215\254\307"
+	.string	"I\023\336\221\365\001\330"
+	.ascii	"A\357%f+Y\262\036\202\033\250sI{\001k\030\317.\"\263\277\324"
+	.ascii	"\337\rPQ\357\0067\352y\003\215\203\214\"\264Os\377Z\371\274*"
+	.ascii	"\264\332\333\272\177\235\204\253\272\177\355u\377\326K\250C\300"
+	.ascii	"]\277\326\212\273~\375\025\315\355\353\250\275\364\362u\024\334"
+	.ascii	"\205\326y\241\353M\274|_D\023\345\273\231\313\327J\366\314\345"
+	.ascii	"\373\333\345\353\007]\227m-.i{\t:Y\332_\273\244\212\367\222\366"
+	.ascii	"7\245\235|v\245\235l\257cj\350\020N\241\324:Aq\321&\251\366K"
+	.ascii	"\332U\352\273M\032\241\264\203I\033\201\372e\237\242\261\373"
+	.ascii	"\230v^\026\306\233\230\036\215\215\016\013\356\027\0048\267!"
+	.ascii	"\355\303\251/K\373q\354\031\b\376Id\303&\252\3671\355\323\261"
+	.ascii	"u\352\223\\\332"
+	.string	"\320\\\307\264o\267\376N3~\3270\355\337\025^\331e\356B\332\307[\237\240\221\315\234\366K@mt\330[\245\305\271\303\236\300Z\241\233\245}<l\236\3720\353\363\n\325\237\245}\275v\320\205\336\035-\355\027~\272\320\264\264\037\251]\274\203\352\323:\2622\223\326c\275h\224qR\033\312\022\373\273\251-\214\314\327\330\303\366\r\306\360\361Q\246V\375\305\244}M+\343\205\252\235\330\377\236\324O\353\342\272\3102\266\277\207:\355Q\274\232\272\266\036\377\261\375}\024L\303s\347\372\t\224\f\361=\nU\325\322\306p\217\353\317)\217$?_K\033\307\261\216j\324\365\027\321\rb\330%L\033\313\265\207@\366\304\273\320uL\332\230\216}\002CP\212*\333z\254EOyoK\033\007\201\302\250q\034\0075D$\"\222$\005\205t\201\005\2049\347\034u\016\021\340$\223\214\314\210H$\221\310\210\036 \310Wj\312"
+	.string	"\374\232\340\224A0\254\027\273[\373/\341z\371)r\330\376\005\221\256\343\347\230\214\303'O'\032=\205g\244S\324\330\n\035\216f\261'\377X\241]Kd\017\310H\325\354\203\342\205\001\323\2563\232W\203;E\365\335\201\367\030\353\353O/\016\375;\213\356\242\215\177W\371\007\300\277\370:\365\317\343\275\346\234\265\222"
+	.string	";\003'\350\2636\200\265\304\207\200\211G2\001+\206\024a\305\027qH7\256\243x|V\263X\256S\314\263\361=W\226Z_[]\020@\236\220$\377"
+	.string	"\355\212\006A\222G\b\nr\2358\210+\024\362\277\376"
+	.string	"\263\303c\201\266\363p\255m\227}#\320X\374&\203Z\\\3224\333+Z\376l\250$\002\271-\030\273Y"
+	.ascii	"\256\n\314\303\r@]\005\350hH\frw\376\326\212\177\251\023\022"
+	.ascii	"\261=k\324\270\025\377\371ZZ\205\324\221\302zz!\342\370qF\351"
+	.ascii	"/\240D\3104^\323\224\366\313\224@\022\027m\223\022\303\031\234"
+	.ascii	"$\021"
+	.string	"\033\032{\254\227FZ#\316\325H\331)\371\316\226T\367\332Y\324\261\353\220\270\220*\342\372"
+	.string	" \321r\251\f\217\3762m4+\241>[j\353\232\340\215\231\270I\273\327\327\264Q\236\006\342\332\254\320\27139\027Z\361(\202\037\373\372\315\233N\332n\020Qt\270dkk\373V\235\2550\2737\027v2\220>(B\016h\330\177oF\320\2017m\004\234\235\033\371tvn\330\225\347\274\335\214r\2416*`\225\244\311\340\312\242\303\275,o\031\034\324w\354\031\017\336s"
+	.string	"w\362\022\034\356\267/-\334\tR\212T\f\t\304\227\260\224x\361\023\232.u\204\371(/J\356\213\353\002w\254\324\334\377\321\373\031\317f?\342\n\241\017\225-{\037\213\021K\265cZ\347(\"my\272\302\221\2733\340\021\3733"
+	.string	"\302.\314p^\"\332!&\026BJ\373\177,#\366%L:=\001\321O\212\022Q\005\036\374\223\250\n\251B\225P\025R\205*\241*\244\nUBUH\025\252\204\252\220*T\tU!U\250\022\252B\252P%T\205T\241J\250\n\251B\225P\025R\205*\241*\244\nUBUH\025\252\020@\213\262'\352\021u\350\261M\340\013<\217\220\365\264g\347g\303\244\t\203\246\006a\3223\025e\310\242v\0021\240i\301K(\304\230\253J\317d\354\271aI\315\355`\240\n{=\236GS\r\371\3705\323\022\f\323>\264\256_ \200\360(\203z\215\357a\215\035\253x\204\235\032{\007\225\373\032L\234 \013 4\241\330\321\201c\335\371\326\310b\232p?pqDb\305D\240P\363\332\332H\361\253K\371z=r\037a\231\366g\007k"
+	.ascii	"\b\022D\241\022\025qq\t\344@\270\f\256d65q\333\305?\236\307\356"
+	.ascii	"\351v4\233\202F\307(\215\207\315f\340\013xj"
+	.text
+	.section	.gnu.lto_.refs.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`E\003%\026"
+	.string	"f\264\217@\340\030\027Z\003\300\334\211\322\n\251#\322\f\201M+\032\314\013\255u\004\221\230\261\202\204`\2141\306\030c\230NU"
+	.string	"\201\021\266T\226k\303q\026\300'\374\243\021\252\301O\227\236m\324D\204l\231\002w"
+	.string	"|"
+	.string	"\177"
+	.string	"\213\364\034\b\317\f\3326;\327\265\363*vM:sP_\260\353z\r\203\263*\300\215\251\016\354\326\274n\325\\\026\354\276\330\214\202\335R\315\367\n uEsjfSi\022\251L\351\214k\314\235\261\256\f\346\037\325\355q\275\243\272\246\265\2125\n\346\322\352S}Q\315I]\034\324\265i\327\240~\235."
+	.ascii	"\323\235A\035s\272u\227e\272\251\322'\322\244\366\335\255K\025"
+	.ascii	"\002=^\347!t\357\200\335FBO\200\335\b\257!\b]\"\241\313@h\240"
+	.ascii	"\242\r\024=\240h\234\3257\016\206\305~\021M3\264\013vQ\257M\256"
+	.ascii	"\006\260\250vK\261\fH\013\356\315N\301= tg\t.P\320\035\200\340"
+	.ascii	"\236\003\353\314n\016\320\255\341\231\246]\231v\353\347\262\332"
+	.ascii	"]\265U\262\233\222}\372\271\305\032\210\311Z-pI\260#pY\261\253"
+	.ascii	"\3029\205\263\311\347\222\332\275V\300i\357\"\273\271\270\276"
+	.ascii	"\245]K\226+V\250L\211\002\345\211\223&L\226\004\335J\022\334"
+	.ascii	"I\220\034!\272\211$\370\220 C?\372\341#(\350:\212\246Pt\204\242"
+	.ascii	"\027\f-s\260\201\330\004\210\366\031\232\247}\343\372\325h\232"
+	.ascii	"\231F7&\205B\316z\216\225f\365\274*\375\322\363\221N8m\016N\302"
+	.ascii	"U\2256\265n\255\021JQwMw)uI\250{\250\020L_\263K3S\265K<\037\234"
+	.ascii	"\006\342#\033i\221\264G\232\b\322\223\rq \356\375\374p\317\247"
+	.ascii	"\207{\261\035\256\314\353\030\330e\275N\301\216\203iC\333\356"
+	.ascii	"Q\r\255*\365h\324\243[\032d\322\243\031LO\177\334\373#\206\326"
+	.ascii	"^/\220^\243\026ns\321\202\305\035\267\255Pq\307\rE\273\221\230"
+	.ascii	"\371\260Ta\335\243\002\363Iq\302\004I\021 9\352\370p\334\260"
+	.ascii	"Q\203\306\f\031s|1\200\356\301x1\307=\027@_\213\024(x\276\023"
+	.ascii	"&d\367J\214\220\005; \220\242c\264\361\215\343\251R\300w\211"
+	.ascii	"\333x:\373\231k\300\315t\005-11\343-\261\371\2011Ki\002f\247"
+	.ascii	"1\264\tF\315Z\305\316dlMj\271\360\030\335hH\350\264\2040r\024"
+	.ascii	"8J\315\006\233\342\016f\210q\005+\3442.\200\301 !\032\307G0S"
+	.ascii	"\314C8\274\030E\334~`\331\021\020\2102\b \021^i}[\362\303\274"
+	.ascii	"b\307\302`\210x\304K\343\374~(kxT\207IRi\207\024"
+	.text
+	.section	.gnu.lto_.decls.92b24249a2732d7d,"e",@progbits
+	.string	"(\265/\375`:\227\r`\002z\313K\326Q\020(\244\251f\f\377\355fX\024\356}\263D\300~M {\265\265ee\321i\366=\240\351\026\375\252<\277\306\221\356\366m\265\032\0012\262K^\267"
+	.string	""
+	.ascii	"\256\032\330\330Q\250X\243\203A|\275I\301\221\3220eM2\n!Sk[\013"
+	.ascii	"m\222$I\n\225\013\301\r\027\016?\271\234[\316.\247\026S\355L"
+	.ascii	";\321@8cr\246\235Y\262\323\251d\3333\260\210-\257\324\201\235"
+	.ascii	"i'\226(b\300\376P$ZyuB\375\241\277\375\241\275\375\241:\373C"
+	.ascii	"x\373Ct\266\351\006\342\247R\017\341\253r\222\365\207\356\266"
+	.ascii	"\2714\213\322\nL\242\364Co\373CW\366\207\242\354\017\025\331"
+	.ascii	"\037\322\261?\024\265/\204\267/df_\210\313\276P\223}\241\255"
+	.ascii	"}\241\032\373Ax\366\203\340\354\007\275\355\007)\367\203\242"
+	.ascii	"\354\007!\331\017\302\332\017\212\367\201\340\354\003\301\355"
+	.ascii	"\003\255\355\003Y\331\007b\262\017\004d_i\022"
+	.string	"\245\007\242\261\377\343\267\377\363f\377\207\314\376O\332\376O\223\375\037\036\373?3\366}\344\354\373\234\331\367I\333\367q\262\357\003d\337gj\237\315$J\337cg\277G\315~\017\333~\317\223\375\036\037\373=4\366\205p\366\205e\366\205g\373B&\373\224\372\363\026\023\2179\347\202\361\320\222\365\205G\366\205?\366\351L\242\364\302\252\375\340\337~p\315~Pm?x\266\377\354\367\034\370\347>SN\006\324\200O\022\0359\346\262\316\1779\3173`\306\223\001\003\320\025\307N\0310\350/\216\235\202L\323\002\323\264@S\021\002\226\226\352\007\255l\263\n\210g\277\240\272\265=&Y?\330d\007\207\354\007\251\366\227&Q\372\340\214\375\335\267\277\355\366\367\230\375}\266\277\237\354o\257\375]\265\257\006\356\253o\266\031\277q\223\245\312\027\233\254\377\3476\331.\257\311lr\235\251\226\335\3444\317jL\275\233gL\263\f\332\330"
+	.string	"\305\372\320l\315\365\b\223c\343\303M\246\213\233\360\002\320f\005(\326\027\307J#5MJ\233 >\0325\211\322\253c\373j\330\276*d_\305\261\237\376\355\247m\366\237\343\336z\322\302\352\200\311\372Kn\003r\022\212c&qK\270l\306T\313o\371-\273\3452&\335\021M\345\3132\216c\017\030<\350\264>!p\251\3763\231\3472\352\325\230+b\2626\277\200x&s\262\221\221\361\227\365\323\272}\023\314\332\333\237\305\34419\214\251\226\333\376\354\305\314{n\003c\256\001\241q\334\005\027\026\307q[f3\327\200\234\224\261\225\360+\346\203\322\027\307\261\007#\017\036\3342\"x\266~\232e?5\333O\253\354\247Pv\252\226\226\316"
+	.ascii	"\2026\227\365\237\271<\247\375\371)w\371Z\356\212c/q\034_\330"
+	.ascii	"4\366\362\370em\306fQ\232\267\200x\346\"\302\327\020*Y\237YK"
+	.ascii	"\226\2217e\3267\301\374f\0323\217\234\374\224\243\336\204\345"
+	.ascii	"\247<cNo\257/\314Lc\316\371\013\313\253s\007D\325\332\237\307"
+	.ascii	"2\221\334\225\213d+\371H~\222\247\344+9H\246\222\225\371,\223"
+	.ascii	"\345!9K\366\312F2Z\226\222\261d$\271JN\222\305\362\222\f%7\311"
+	.ascii	"f\231IV\222\277\262\223\034%\203e!9\314T\313e\371\3073W\006r"
+	.ascii	"\255\214c(6v\346\334\251\fS\267\b\241\321\306g\372\231tZ\"\210"
+	.ascii	"\321Y\222\321@\263\304\363[\3462\223\214\t\007\004%\024C\t\241"
+	.ascii	"\nk\263\021\2674\323\230q\362\344\247,\303\315]V\032\b\177~\312"
+	.ascii	"7\336\3144&\034s\016\320|\363\203\320\221\261\324\250\314\200"
+	.ascii	"\310e\231G\336\002:\343x\210YX\034\3077\345\354\350Rge\316\201"
+	.ascii	"\0013\005\267d\363\203\300\361\005D\276\312X^\362j\234Y\312\371"
+	.ascii	"\363S\226\222\013k\363\233iL7\201\371)C\335-\353~3\315\232\032"
+	.ascii	"ac\342\3149\240&\241\370\251n*\f\317\337\2340\020Y\313\2343\351"
+	.ascii	"\264D\240\302ED.3\001\263\223IwD\001dq\226dt\3149\2403\216\271"
+	.ascii	"\360\204\305\261\362&\335o\246\371C\200\220\313L5\346\234\032"
+	.ascii	"\323\3053\266\b\261qzQ\346\275\365\305\261\322\203\221\207\240"
+	.ascii	"\335\0327UN\320\247\322,JC\240\261\377\354\343ykN\003\361\005"
+	.ascii	"\365I U^\326\271\007\210g\037\025|q\013\223\265j\022\245O\237"
+	.ascii	"\366Q\274}tn\037\035\263\217>\3319\207\316BC\204I\326G\277\366"
+	.ascii	"\321\253}4\336\327k\366u\231}\355e_+\3675\225}\335d_\037\331"
+	.ascii	"\327Z\373:\336?\335\354\237n\373'\331\376\031\266\205L\242\324"
+	.ascii	"\f\314\261\251\306!7)\203\362W\236.X\262\376id\337\344\220\236"
+	.ascii	"\201\201&\207\364\247\217\375\323\306~\336\333Fv\314>S\315\310"
+	.ascii	"\274\243\346\211j+\353\3479;\004\261i\224>\3204J\237\325\354"
+	.ascii	"g\266\335A\312\376\300,J\237w\354\020\002\367\3156\373\\\322"
+	.ascii	"\366\331\232\354\233\331\261Og\026\2457i\354\2731\213\322\307"
+	.ascii	"\330_\232E\3517\2605\230D\351\373\314\242\324<c\2421\325(0\345"
+	.ascii	"\036\002\204\237MgA?\200c\200x\262>\213"
+	.string	"}\223\202\324\f4)H\237b\233eL3\246Z\007\363\355\246\233\331\366 \2242F\213ceP\320\256\316\017.Y\377\304\276\331!\r\n\f\f\f4;\244?\332\332$J?0\211R\rfQ\372\233b8l\25065\2620l\246\262k,O\326&\333oj1\267\230kfW\034C\305q|\301\214\232s\303/k\223\213\331\305T\303`z\271\371\305\004s\324I\031+\3438\0162\363\216<\341\310Z\310,J\263I\224~\303\276\231\366 \257\030\204\357\r\202861\244f`\240\211!\315]fQ\232\201I\224\232h nf!J\255\264\2241\2278\216\203\200p\214eI\313z\310$J\177\023\013\006uJ\030 E\316(\bRf\335\030\222\365o^\371\315*&\231ivJMu\305\\\342X9\244V!#\204K\326\246Y6\313L\345M3\323\312C\200p\037\250\230,\216\225\246\231\216c'\323\264"
+	.string	"\3104-@\335\2268aI\365\363\276\322,J\267I\224\236iY\017\321x\377\371\203\366p\363\237B\224\207\032T+\323\321h\340\240;~\375vf\321\023\310/\362y\246\310U\376\263\b5\341t\202f\375Y\254+S\321c\376SEu\374\271\3507\355\264\026\264\203I\202k\355\013\252\241\313\234\243h\200\006\364"
+	.string	"(\326\217^Y\241\0058\345\240T?*\345\364\243\036\370Q\016)(\303~\265I\037\311K\376\223\007\332\201\377\314:\261\256\362\213\037\3450\304\353G3 \201j@q\225\302\217&\331H\300\257^\310x\347\223\332\023\002\363eY\016\32094\326\217\306\370\263U\336Ca\374\250\213\377|\n\036\374\351\236\324\217f\220\2452\f\035\202\3774q\226\320\036\370\365\007~4\371\353\021`\355&3\007\224P\344\257[\374\332\370\243\307oXq\016\350\322\217\266\370\321\366G\223~t\375_\206Z\240\230\252\375'\005(\004\376|\365\262\270\2732\377y\343t\023\0065!\343}\371\317\026u[\376\023\n]\361\243\025\376\363G\005\212\023\350\b+\236T\365?O\214\220\346*\2269\263\377\214{C\363\277\254\312\177\306\275\235\030\001\375\311PF\005\373\365\n\035\201<\302\177b@S\374\231\303\005\364\001\2779\200\223\004Z\266"
+	.string	"\035\277\276\200\316"
+	.ascii	"\tT\203fA\001\024E\206\334"
+	.string	"w\r\177\032\344?-\310"
+	.string	"5\201\003\352\200?\343\275\347W\211\350bn\200\006\320\005\\\t\202.\341e\277\340O\247 5\374\243'P\023~\375\205\226\360g\264?\253\375\331\313\177\202i\030\277\216\201\232\3705\327\271\344+S9\202\222pn\320P\320\022lP\022\332\305\377\rF\0342\340\335\304\2572"
+	.string	"\006\252\301y\002\035\341?\313Fd\022\262\211\024h\372\243Z\001z\316i\366\277,\004\377yv\262\251A\376s\fM\300\217\036\340\377\235\313\251>2\215\337\354 KM\200\032\340\033\320\002\374\227\373\235\377\026\374*\323\177.)\223{\372\253\310\337\354\300d\361\233\305oX\361$\202_M\372\315,j\277i\3477\275\214`\"\241\001@E\374\346\003~\223\002\277\231\342?\203\320\020\346\ts\001_\201\202\330p0\357\360\247-L\023\305\300\034"
+	.string	"z\364\265\263\235\031l\270\321\377\f\257\340OI\370\265\017\275\365\243\036\304g\006e\377\371\323\300\377\224\202v\200r\200z\3705\022\272\301\257\261\220@5h-h\207?\303\370Q\016\377\311\001t\303\336\377\262\363\356\032\374j\321\177\302@5\270\262,\343\271\317\237\326\371O\013\320\f\376\313\351\n\3773|\377i\227\337\244c\332e\013P\374\250\005)2\234&,\374\351\215\377\304z\376\325\022~\323D1x\372s\037z\301\257\023\360g=\324\202_O\240\353\033\376s\006\321\257\006-\340$\201j\370u\t\377\337P"
+	.ascii	"\234%\376\227\375\377\371S\032\277\376\177\006\376\372\374\177"
+	.ascii	"\376;\370\353\r~\355\301\257;\370\265\207_o\370u\207_s\360\353"
+	.ascii	"\017\277\026\361k\020~\264\202_\023\375Z\203_g\360k\375\243\024"
+	.ascii	"\374\027\372\367\372k\003\374h\206\037\235\340G1\374\250\321"
+	.ascii	"\217\026\375\250\205\377\352\277c\374(\321\217\006\375\350\317"
+	.ascii	"\217\366\374h\360G\325\037\315?\372_\003\376\372\357\327~\277"
+	.ascii	"\356\3735\337\257\365~\235\367\353\273_\277\3715\233_\327\375"
+	.ascii	"\032\315\257\343~\375\366\3532\277v\373u\230_\257\375\372\313"
+	.ascii	"\257\325~\335\345\327[~\215\345\327W~=\345\327Q~\255\344\327"
+	.ascii	"G~]\344\327C~\355\365\353\256_s\375z\353\327Z\277\316\3725\326"
+	.ascii	"\257\247~]\343\327R\277\226\361k\250_\207\340\327\037\370u\n"
+	.ascii	"\277\206\177\355\376:\371k\343"
+	.string	"\257\223~]\3745\213_k\340\327\031\370\365\005~]\201_O\340\327\021\370\365\212_\247\3705\212_7\340\327'\374z\001\2776\341\327%~=\302\257\025\360k\021~\r\302\257E\374\372\203_\353\377\224\363\237w\377\351\346?\355\376\263\356?\237\3763\315\177\316\375'\232\377\214\373\317\267\377,\363\237n\377)\346?\315\376\223\355?\277\374g\332\177n\371\317,\377y\366\237\312\377\244\362\237S\376\363\311\177\206\340?k\374'\330\177.\371\317\257\377D\362\237D\3763\306\177\026\377S\310\177\006\371O \377\371\343?{\374g\326\177b\375\347\325\177Z\375\347\215\377\264\361\2373\3763\352?\343\377\364\300\177\246\360\237\360\177\272\377y\374\317\026\377\331\376'\373\237\353\177b\340?-\360\237\024\370O\t\374'\004\3763\305\177\242\370\317\006\374\347\t\377\271\200\3774\361\237%\376s\304\177&\340?\017\360\237\006\370O\002\374\347"
+	.ascii	"\376\023\204\377\024\361\237 \376\363\303\177z\360\237\036\376"
+	.ascii	"\263\303\177n\370\317\f\376\363\202\377\244\340?'\370\277\342"
+	.ascii	"\317$\374'\206\377\274\360\237E\377i\341\377\332o\332\375g\205"
+	.ascii	"\377\034\372\017\346?\203\3767\3407O\374/\373M\363?\177\376S"
+	.ascii	"\370\237\352\177\352\3774\377\f\370g<\177\356\373\263\235\377"
+	.ascii	"o\177\326\373/\367g\274?\323\371\363\227?[\371\263\223?\347\370"
+	.ascii	"\257"
+	.string	"\342\3178\376<\365\347\024\376\374\376\031\002\1776\361\347\022\177&\361\347\016\376\254\341\317\026\374\246\322oV\3407\027\360\037\205\337$\341\177\230\377l\377\317\376_\371\257\374O\367?\356\377\006\201\201\201\201?\321\362\277`\305\277\332\005Y\253<r\031\226\214\262\254\277\301\233\375\r\324\354_\315R\263\314\271\023*\346:\242\362\241kXv4\311\372\033\224\331\347\300T\261\260\356fZ\355-Qc\313\262\375\253W\352\225\\\224}\225\312T\255T\253\224\313J\317\326\006^\373f\312\225\236\003S\275\241\336\270[0\216\275\266\204|1\007\337 K\245\241\332Pi\2505\324\032\025\374\241\261-\251\223\3657\250\332\337\240I\235\241\316H\321\366\200\266d\030\211b\313\372\035\344\250N*\224\352\244F\251Q\352\223\372\224\246\345}\b\362\342\005\013Z\326\357\200f\277\203\026@5\006\f\fL\275.\344\224f\203\237Y\007I\340Z\326\357"
+	.ascii	"d\237\003\336\337\037\232\027\214c/$B=:\276\324\217/\275c\307"
+	.ascii	"Nzg\0021*\030\032M\322\372\236\3369\303X\275\261\373\373\037"
+	.ascii	"\354\021SE\006%\353sx\333\347\240\266\377T\357\246Z\252\227n"
+	.ascii	"\2410\343\030\f\021\262%zg\206\327X\326\347\020e\271L\363\214"
+	.ascii	"\272\234\234Dx\013\003\0243\343\302\025\230\342\031\005mQR\205"
+	.ascii	"M\326\347Pd\237\303\225\234?\004\b)\233t\216i\246\200\2478\346"
+	.ascii	"\022#\312\3420\265\317\001\352\356nK\b\267\341n\377i\233\233"
+	.ascii	"ji\233\364\215QW|%B\223'\257\2621m};\262N\335\350+8\271!Y\177"
+	.ascii	"\303\231\375\r\\\352R6u\251W\032\307\246\262\253\312*\326\262"
+	.ascii	"\352\260f\215\025_\0051\255\016@mL\212\\e\375\rQ\3667\370\230"
+	.ascii	"\233K\323\230\320\345\364$\203&yyg\202\274\2320!\313:\245\363"
+	.ascii	"2\204\253\f-\353o\250\261\257"
+	.string	"\201\036\0324\246\231QW\023\336\007ySs\376\200\264\244a\311\221\3655 \023\027\307\001N\003\263\2677\023\316\204.\247+\r\254\250\001\373\003\332\232q\003O\326\327`I\2312ZK\207.'/\r\313);\276\276\237&T\262<e}\r\214\214I\303\244n&\334n\262\212\241\214\\q`\245\344\340\032T\355g\260'F\214\206\274);>\235\207\216\035\222\254\237A\0306\2664M\214\007\276\f\312\300\200I{\344\263\270\351\001^p\226>gp\356\244e\375\f\276\366\237z\271\251\226zI\265\214\272\234\256B\210\222Wfe^\365iY\223\3653\320\342\302%M\023sd\225\246\001\221\271-\357d\375=4\357\177p\350\226\244/\353g0C\213\226\024m\307q\334\244\214\253\200\3640\250\203\005K\212v\2418\216\237\342\230k\253\347\314\224\221\277\276\247h\246Y\260\311\023!Sl\324\322+:\310)\325\345$$"
+	.string	"M\236x\225y\230\301u\226\3651h\333\177jvS-5K\257\214\2728\204\001\212\231\321\3136*q\025+V\31454\216\273x\b\331\2648P\321|\371Z\313\372\030<\331\177ZE-\255\222Z\345\263\270)Hm\311\007e\253\001\244\301\227\3651H\262\377tl,;\241Pq\027\222\024p\0131\303\025\225\3651\350\261M\265tJN3\241\313\251I\bU\272"
+	.ascii	"\305\324:Nx>\262>\006VQ\242\244^\346\007\361S]\030\016\177SF"
+	.ascii	"\376\3720pz\362$o\312\310\237Xj\344)l\256I\023\323\314(n\302"
+	.ascii	"\333\260\2342\362'F\244\316\224\\\326\277`\f\fL/\230$\353.,\353"
+	.ascii	"_\260\265\237~\231\351\022S-]\222\235P\304POA6\360\241Z:\216"
+	.ascii	"\214e\375\013f\354\233\331)\375\323$7\325\322$\251\016\023\272"
+	.ascii	"\342\253\016\236X\325\261\352\213"
+	.ascii	"c-\016\204C\356dPe}\013\354\354?=\242\226\0361\331\362Y\334\224"
+	.ascii	"\312M\201e\211\305\261\026\007?R\304\360\360\312\372\026\234"
+	.ascii	"\331\177Z\244\2109g\324\325\224g\201\325\324W__\034\233\341 "
+	.ascii	"\210O\312\217\257\254oA\330\276if\246C\376\020 \230j\351\020"
+	.ascii	"\323\354\214c\2560\033\344\246\214\374\365\305Vf8\350\261\323"
+	.ascii	"\003\r\232\254o\001\326~\n$\355z\032D-\r\222z\231q\034\307Zq"
+	.ascii	"\023\036\007*SF\376\304b-\253\016\377\367L\265\324\353s|\342"
+	.ascii	"\f\250\032(L\322\262\276\206\271m\376\346\363\237\306NVq\034"
+	.ascii	"_\241\312\330\352\311'\375\315\233\250iv\370\177\314\323\274"
+	.ascii	"\340\277\216\343\203\350\221\214c-/}q\034\233z\373\311\232\223"
+	.ascii	"\017\r\361\2058\216qHA\305M\246\024\232\027\016)4/\253!\2513"
+	.ascii	"^8b(\034bP^]\246\024\224\227\225\025T\3344\024\243yYI\305^8\204"
+	.ascii	"b\264x\207\024\232S\223)\005\025\343\210c\257X(\226r\302\021"
+	.ascii	"\243)\255\206\244\320\274\254\244\320\274p\fI"
+	.string	"\2419\341\220\212\273b!)\345\020\253X\351\3254d\003\315\tG\214\326\205c(F\363\302!\245\006H\032#/dB\244\002\241\232T\231A\244\240b\252\033[NVBtR\312\256\330M\034\233\\d\304V1]\034_\020\307[]Vn\234v\230lOtTO^\234\272Le\034\307\030n<\t\351\212\241\350\232\314\230N\nJW\034CyR\212o\304q\034\007\240II\027#1\351\232\206l\305S2\342X\202X\031\3077\342\270\311\214\351\3428n\212\343X\265\332R\306q\017!\251\260\0337\342X\313\350F\274\325\024FF\034g.p\330pH\241\t\351\002\021F\013ZX<C\331dJMu\305a\261\033/\253\215\326t%\236\212\343\330\254\263\303p\344\310K\177\250B\360\204\331\222\3655\020\331\251\017u\311\0272\313\254\257\001k\247<rO\323\025\"f\262\276\006\031;\335a\242ehi\300\262>"
+	.string	"\372\266\262\207\215\253\013V\326)V\024./\264\254\017"
+	.string	"9[I\026\307J\240T\212\222\031aR\034?}A\270\306d}"
+	.string	"\300\355\264\n\203pMM\013G\326\007"
+	.string	"\332\236Jo\f \256\013\2532E#\255\341s\343m\013\033$4d\2443\276d\261\021\303!#\205\312;l8\271\312\372"
+	.ascii	"\200\332\351S\352\2246\201\265\001[\222u\032\033\251af`wY\277"
+	.ascii	"\2028\273'\217R\213\013\020\315#\314zz\212\263~\005h\266\037"
+	.ascii	"\212\307\254\023?Me\361SZ\320\232B\305\207\332\331uw\210\304"
+	.ascii	"\205\361\241z\301\256\036X\234\262~\005Gv\035\024\317\307)\013"
+	.ascii	"L\232\254_\001\220\375\243K:Y\216\026(mt\3209zP\276\252\262\226"
+	.ascii	"#\254\302$K\\\326\257\300\306\276\2108<fN)\2403\216\235\344\204"
+	.ascii	"\211I\203\252A\331\240p\3209\264\rZ\207\272A\355\320;t\rJ\207"
+	.ascii	"\3061\325\3207\350\231\243hP\271g9d\350\200@\337\240c\356,\321"
+	.ascii	"7h\231S\312\244\323\322Tb\364\r\312\206\2061\351\216h\262\277"
+	.ascii	"\345\233\333Z\036\364M\276\223\003M:-\r\005p\tw\207\276A\333"
+	.ascii	"T0!t\266\372~\360\266\326(\311\240\263\225Y\224^`\022\245\247"
+	.ascii	"@\314>\005i\373\024\\\331\247@\312>\005L\366)0\262OA\220}\nv"
+	.ascii	"\354S \265\237Ao?\003\232\035\306\311\f\322[\342\247$\353g\020"
+	.ascii	"\263\237!m\377(\230/Z\315\310\332\\\326\350\227\0375C\225\250"
+	.ascii	"\227\254\027\245I\231\265\332\006sC\303L\326\317@\226\005\355"
+	.ascii	"\202nA\271\240ZL54\r\275r\364\f\305\322&\013\227\266\263\262"
+	.ascii	"+fai'\226\257\331\230a%\rE\373\332y\305*\002\031m\322\226q\034"
+	.ascii	"\033\371\340m\255\221\363\321\317 \266\315.\263(\265`\022\245"
+	.ascii	"\317\220d\237tfQ*\002ZF%\370\324E\005O\326\0271\005\tJ\005\215"
+	.ascii	"\262\345k)%\311\030J\206VA\255\230j(\025T\254\r\245\202B\331"
+	.ascii	";\003\373\353C\325|\304TB\375\f\\\373\031\246\366'\300\333\237"
+	.ascii	"\200m\177\002%\373G\237\240`~br`Y\243`h\017\364\310y\305j\001"
+	.ascii	"uo\226;\342\264\341\001g\311\004]\2026A\225\240a\250\023S\r\005"
+	.ascii	"C\221\034M\202~\345'\024\f\3251\347)K\016\030\252\205\345\356"
+	.ascii	"GH\036\2722 m*\315\242\324\310$J?A\017#\032\211Z\232[\326\237"
+	.ascii	"`\n\035\202\nA\211\230jh\0214\210\026\321\025G\346\205\002A\023"
+	.ascii	"V\004\365\201\0021\351\270\304N8\002P\005\313\024\271\2768\216"
+	.ascii	"\215<x\360\340\323F\226\367c\353K\200\267/A\335\276\004s\033"
+	.ascii	"\335B\177\230jwC\271\220\224iB\222\365%(\263a\304q\034\233wK"
+	.ascii	"\325\273\245\227\240m_\202\265}\t\266\354KPe_\002&\373\022 \331"
+	.ascii	"\227\300k\377(V\016\024\013\034\025\247\254\321\034\327g]?\247"
+	.ascii	"S\026\232\265\254\177\364\312\n\250I\032\251e\326\027\201Z\241"
+	.ascii	"T&\034\020\2242\306\241\242\016\330R\f\207\251\206Z\241Uh\031"
+	.ascii	"N\r\316\034\255\217\201n\037\303"
+	.string	"\333\376\321\033\250\f9wMMY_\204S\033\032/\311\013d\262De\350\277\261<ba\032\020\f\245\201J\2413\320\032\250\r4\n\2352\325P\031\350\323Q(\263\016\225\2016\251hsl\204\021\322@&Qz\f\\\3661\214\355c@\262\217\001\310>\006\033\373F\201\373Fy\373Fj\360\370\235jkV\264\372\364\035SM\373i;J>?\275G\201\030PL\314\247\212\025\267\032\251\276Q\333\276\221\225}\243/=<!\227<t\306\262\276\2105p\362\344\336h8\372N\307\321mt\236\246\243\227z\216\226\243\335\350:\246\232\306\323ln\242i;\2729zst\360\244\221\003FM\0346p~uof\236\312\340\351\272;\215\247\3434\032\240&e\334\224\256\345\360*\363`\224\226%Y\322'\2016\245\314\242\364F\361\376\205\345\376\005\271\375\013m\373\027\260\354_X\262\177\001\310\376\005\251\375\3533\327h"
+	.string	"5\220JAyA\311:\253\001q}\306\r\2160:\262~\004}\373\021\340\355G \267\037\001\227\375\b\244\354_\223\321mMMURY\337l\303eJ\267i5\023\356\274b\265\267`\241\341\246\303h6=F\257i1\246\232n\323`\264\362\"\276\264\351.6\226im\332\2139\007\324\244\214\253@8\345\235\021\273\002\206\310\037\220~\004Q\373Ew\366\213\362\366\213\320\354\027\231\331/\342\262_\004e\377z\213\026\027ZZeZ\313\232\331\005\224#\213X\217,\035~\356\330=\211\241\235\365\310\302\203%\353\233u`B"
+	.string	"\265\231\306\242\257h\245\251\246\317tY\2333\035\226G\237i'\332\312\251dc"
+	.string	"\226\277%\335\231fb\226\007\307\310\203\007\017@H\376\276\246\204\372E56\231\271\367\325\0040\353[\270\263/\002\n\r=\246\245\350)\2472,8C\210\215\245\246\242\305t\025SM\217\351(\327M\3146zL?\211\235\232Bh\342e\267\354\213c\245\007\017F\036P\253\037l\344\266\326S2\326\326\202\232\312\312\372\026\302\354[P\356["
+	.ascii	"\333\267\340\265o\201k\373\230D\351-\330\330'\272\263O\024\267"
+	.ascii	"\177\275D+I\177\334\341\341\320I\364\227F\242\217\230jZ\2116"
+	.ascii	"b*\343\030\r\314\220\272/!J\226 \020\211\342Uf\325\247\225\350"
+	.ascii	"\"W"
+	.string	"eV\233J\016\031b\204\372DN\366\211\216\354\023a\355W\370\333\257 g\377\332K\007\211\363\005\307_\326\277\016r\266)\263u\247I\326^J\224,\227Uj\244!\243\021\2267G+l/\333\t\204\263\244\002\301\206\005O\236\215\260\274\307'e\216y\362c)vcl\312\313\310\030\buj\354=\335Yz\025\241\262\214\222A'l\017\252/\212\206\234\034>\274\2649\341\312p\262^\033\032\247\227\020+c\300\220,sh\255\235Q5\342\204\231i\246P\345\370\221\026vF\235UD\346\322P\261\221\367N'\323/\312oy\346\300\212\353\361\345\214\262\222\013\313pr\034#=\310\302\216,\331\350\200\313:s\3540\203\007\357\306\262\315iv~9\225l%<\005.\3438\206\262\265\034\303$\311R\217N\233\252.\263\260S\n\021-\257\257%[jyTn\362\336\331&\337\311\201\2472\314D\226<\3138\216s"
+	.ascii	"\341\222\367\342\277\f'\3131\302\343\214\302\201f\031u\2669g"
+	.ascii	"\234R@MBqLd\316\231\343\f\302\246ly\343\315\362\214;\001\317"
+	.ascii	"8\372\307\271\247}\234w4\017\235C\333\320Zz\353\244s\3129\325"
+	.ascii	"h'}\245\253\264\325\tGS\351\031g\232\023\356ts.5\324\031x\336"
+	.ascii	"\235s\272\351\374;\361\234~Z\352t\323\261\276q\342\351\250\263"
+	.ascii	"\356\234s\352\235ot\215\223\314\271F\343\320X\247\231\023\315"
+	.ascii	"y\346\314\323]\247\335\311\247i\234yN9=\245w\234vN\272\263\216"
+	.ascii	"\226\241\263\264\016\375\244\201h\256\263\357ds\276\351\036g"
+	.ascii	"\031S\355ls\212\371\331v\216\031\263\344\013\004\230\247<\247"
+	.ascii	"\027\221*\3133\007W\227\260\274\327\204\347\214\262q\027\205"
+	.ascii	"\307\031u\225\235\200\234\204b\250\2503a\346\230&@\226zH\300"
+	.ascii	"\302\332\2220\t\203\223\357\332\370\b\213\232\"\002g\355/\357"
+	.ascii	"\210\3302\214\337\362\364js\016!B\266<s\2649yd\001\263\214c\245"
+	.ascii	"\007#3\356\216\0203SKo6\263(5k\230D\351+\320\355W\b\263_A\271"
+	.ascii	"_\241\311~\005\256\375\237\312\323\312Yvz\tb\275\211\001\223"
+	.ascii	"\265\232\321\tX\003"
+	.string	"\214\225\254_a\307\376\003qB\270\036y\256\210\311p\302\267!I\330\200\245n\204bd\330\246\b\315h6A09'wY\237\004\340\376\205d\270\200\274\252\374\342\270\251Qc\20498\320r\244\255\307\211\2452ML\252\205F\306)\214\t\327e\016\235\215\254\205^\204^\204k\246\225U\035\017\310\260\314\264\300\\\270\026\004\307\210\033\\\326\302/\247\032\300%vH\300\355_\250\226\246\351\301\002FJV\332^\002\251\311H\323\353\202\346\365\2349\373#\303%\250$\227\3210\263f\313\366\363\211\351\224]iQ\221\3448\362DK\226`\024!\0219a\252\320T;\323\315\2201\033X\322R\300\274,a\316T\263\035\244\210\037\324\025\341\f\355\206g\315\233R\245reg\027\225\265\260,\013\255\b\315.,\273RX\006\200\277 \323\264 \250\207\232\031')Y\272\245\034C\373\312Z(E\212\220\312+|\t\377\260\252"
+	.ascii	"\366\305ZX\035~\341\330\205T\334P\031q\364\324d-\024\273\033"
+	.ascii	"\236.fk\262\026N\271[\234\234\020 $\242\354_\030\345*\253\341"
+	.ascii	"\302\243\203\242\2114\001S\345Ij\345\241\257\310Y\326\3020a\223"
+	.ascii	"\013\235\\\350$\013\235\234\201\201\251\2255[R\375\013\301R\035"
+	.ascii	"\251\030\036<\242\204L\202[Z\246\334q\021.Q\247\364\301\261\241"
+	.ascii	"\241$\273\263\343\364\025\274Bv\306\307\225d\267Q\317\350P:A"
+	.ascii	"\022\334\242d\207\034 YWU}u\031I\363\306\320\234h)\222\336\311"
+	.ascii	"\200ju\326\020I\275t\027\036G\204\f\311N;\242\360\250\t\tBy)"
+	.ascii	"\361\250\360)\311\372\246\2320H\2126B\336\024\221..An\272\210"
+	.ascii	"L\001y\342\2236\006O\225\220kC)Q\343\306\353\307\226\336[\203"
+	.ascii	"&\207\320\307\205[\177\356a.\331\200\311;\222u\366\002\342B\037"
+	.ascii	"\331J\021\251$=xDY\235\211\332q!\217_\250e\336\005\202\351Me"
+	.ascii	"-4\211\322\334\007\342\302\035PXiL\262\204:\332h9\323%k\241\016"
+	.ascii	"0h\262\024\311\032\007\016a\216\036\300\252\"~\272K\227\231\370"
+	.ascii	"\352\302\034\250\225Z\0264Y\177/\3506\006\312\235WUU\232f\n)"
+	.ascii	"\237\332\200\205\375<\241\262\247\225\365I`\to\bo\244^gn\330"
+	.ascii	"\301\022\323rtv\372\262>\t\032B\033B\033iZ^\336\031\363j.\210"
+	.ascii	"\220\254?\002\035!\r!\215\324\253\357\206\035\254>=&n\312U\326"
+	.ascii	"\037!N\b%\204\022\316\370\001\2447\005\226%\304rd\t%\224q\341"
+	.ascii	"\214 \235\036>\2640h\302\25032C\246\262\376\205QA:vh_Y\177\004"
+	.ascii	"5\241\223\320I5\0233\224\207\305-\353\217PD\030\013\3434\315"
+	.ascii	"\344\243\312\343\023\373\031\213\022W\226\365G\270\002\004\304"
+	.ascii	"\020"
+	.string	"\346\f\354\257\017\025{\312a\007\317\337_\212V\004G\225\307\327\027\244\367%\260\314\233\237_p\213\031\306\t\354\357\314\025\037vY\177\304Y_\037\034V\221\245\330i\206\247\216+\353\217\370\342\343K\275\262\260\2228\021;\255@\225\361\222\365\025\260\247\247\227z\t\345\260\212,\203e4t\314e}\005<\221#'\230\327\343WU\304/\310o\016Y\r\274\007\363\354\372\210\340\311:\270L\251\376\007U\036NH\232\350D\031\362\005%\353\340\234\2402{@\330\262\276\002\214\354+@\353\356.\370\0060l\355\207\002d\264i\023|\243\372M}\365i;d\222\350p\363\340\233\234\304m\215.\265q\347eCM\326O\300\036\0336aUt\340\372r\034\325Z\230\254\237\2005ss\301:UL\025\240\326\276\262\022_\251y\260NH\205'J\226`\0327\263\2724A\272+cR\270dM\207\236\021\226}\2015\311\372\t"
+	.string	"\013\242\t\242I\275\306\254M\0313\227\365\023\320#.N\2753\317\342*\013X\001\2125a\231\232\223\365\023\340\364\366\226z]UU\331\322Z\360\220\221\222\365\021\240W\246\314\035\236\260+[P\360\354\332\332\202nfg`\177bSOl\342\306<\350&\303\013Z\223T\352\312\021!_la\302\004\267\230gq\225Y\306\t\330_\220\312\237V\\\326G\200\331\332\232\227\260\240\0379\304d\311\372\b\370\n~\t~I\275\214\272\232\370\324\254*:pzgM\232d}\004\344PSS\271\252\350\300\365\3718\031\323\346#\353\037\200.\330%\330%M\273\232\002\313\342\232k\203\342\226%Kp\213QW\023\037P\336\r;X}\371\211\033\2742Z\036\334\242\221\304\321qgV\343\252M\031\304\022\304\002\244w\303\016V_\230\266 \\Y\377"
+	.ascii	"[c\017\232\215\005\257\020\3051\212\237\240b\256-\265I\025\034"
+	.ascii	"\255\276Xj\253\003j\006\213\215\362\301+w\013\362A\004\007T\320"
+	.ascii	"\312\203e\177Pm\303&\356o\007\253<H\366\007Q\0379\356\240d}\021"
+	.ascii	"\354\354?H\345\017\372\0349#\227\227\365E\300\333\027A\316\224"
+	.ascii	")\352\024\255\252*[bAi]\264\234e}\021\340\2300\tF1\262\343\005"
+	.ascii	"\366\327\027D\207\207\030\030(\017FI#\306%O\326A\260\340\223"
+	.ascii	"\377\301\315\366\006.\315\223\240\0237:\250\230d\035l\242<!\307"
+	.ascii	"J\231\254/\302\227\035v\2121:\341\226\230\251#\202Y0I0IPI\220"
+	.ascii	"\325\r;Xi\333\034\037\\\301\257\007"
+	.string	"\225\3502\2752Qn\377\203ZG\230*h\262\276\baG\216\270UT\302\210mc\356\262\276\bD\212\024\231\3032E.\345\363r#\223\365E\270\021\034\022\034\362d\311\007\245O\210\243NJV\3267\300\034//\ffy`\177\350\325\031\020\275\254o\200\270\256\256\003\344\225Y\211\251wcj\\\311\372\006X\013r\005\271\204eTe~B\254(g\246\262\276\001\312\202=\202=\202[\346Y\\\245ZUU\331\022\313=\352\310%\t\372xp\013P\006\236Z\326\337K\243\376\007?\200\363\305$\353\033"
+	.string	"HP+\250\005WQ\t\023;y8I\373\341\227\225\225z\231B\312\247:\260\2608\326\352\360#\205\353\2072\353\027\340.H\025\244\nby\345\235\021\353\311\372\243\202&\230\343A,\224\2142N\222u\360\n\r\034\263\322\221\206\343\1770\b\260-\310\030\216\240\025\031.\273\267\254\255\202U\312\030\203\226\343#\210Y\326/"
+	.string	"\231\375\002d\231\232\242\022\226&yR\n\311\372\005\200\022\254\021\254\221z\211\205\351(wgtY\277"
+	.string	"^A\251\240T\352e\304W\345\344\252/k\311\213;\222\365\t\200\027\224\021\224Ae\352\253\357TR\027\227\311\372\004\240\0136\005\233\202P)V\025\223,\0373?5V\202O\017B\005\235\b\340$00\315\253Jr&\256K\2337Y?\204\300\277\277\235\247\007\220\224\252\"~A[7f|\311\223\235\276\256\310\b\222\365C\270\302\307\267\375\214\272\232\362:\304\305\200bA2rSH\374\356\b}\204y\251\222\365\356\363\tlSg\226\365C\b\333vB\320\322\323\2232\365\325\327\207J\271\n\223%\353\207 #//E3\352j\332\353)\233\002\313\352\213r\303L\326\037@\336\2349{i\324\325\304\227\212M}\365\t\265\316\200qC\347{\3719f`\232,g\372\376\007}\236xE\325\221{\363f\3071\352j\302\333\300\212\212OO\033\361\263\002'\316\276\273\303\243+\317\206S$\262eL\326\037\200\333\376"
+	.string	"\300\330\331\3556LR\262\251\257\276\276)\035c\240\3546}s\344\346\340\304\326\254I\323D\210\311;s\306\251\371{C\242FM\232&\246\314\nE\263\005\n\224\254?\200.:\272\024\315h\307V\210\364X\006\251\251\373\322wCNN\205\0238K\237-\271X.\353\017\240\351\314\231\324\313\250J^\231U\237\317\016\031W\270\262\276"
+	.string	"\366\340\340T;\243\256&\274\016\177T|z}{\307\2231\032Y_"
+	.string	"mf\314X\210\013\003\024\3533\257\034\241\003&\353\013\200\214\f\231\324\353'T\314%\027\246\257\240I\023\203\215\031\223za\b\243\312\343\353sK\213Z\223\365\005PC\214\230\024-\205\243\202#\247\232y\022&e\217\215m+\205d\250\312\374\316\257\254\265\2721`\300"
+	.string	"\361\335\260\203\225\313P\321\263\313\372 P\361\342\305\f\025\0349}\007\310\030\026`ZZ\026\225\235\234X\206\0344-Z6\027\253\251\257>*4\354\200\354-\337\\\366\262\320\225\301\375\017\246rU\177~dhh\251\026\225\232\277\036\2479P\356d\375"
+	.ascii	"4\235\235\245h\346Y\\\005B\027\037\024\2618\326\352p\346hj\343"
+	.ascii	"\227\365E\330\331\377\277\313v\331V\032u5\355\t\305\250\312\374"
+	.ascii	"\372\342X\253\003P]\221\0326\314\276\225AOQ\224|\331\373\037"
+	.ascii	"\374\021\223\303\206G\326\027\2416eO\331dB+\006D\231Y\342)\363"
+	.ascii	"e\254\212\217\022\300\252\035\312\036-\251/e\233\312\036\363"
+	.ascii	"\361\200\307\303\314\330\026\253\202UD\211\222,\216\343\240`"
+	.ascii	"\030<Qt4\211\022\205\b\234\217\322\315X\326\027"
+	.string	"\221c\377\333\311v\262\237d\241\030J\210\034[l\245\305\301\276\002w\307K\016\212-\311a$\353\207\250\263e|Wm\253\215\303T\3332vXj\025\026#\031\353);\3430\034F\262\006S:\265\261{\313\372!\354\366\323\325\306\212\263\324q\307c\3730\351\216(@\312\\\326\316\221\341I\312\00428\3134G\366\217M\304\244\323\022\212\241\300\364-\367\221\355&\311f\262\227\354\257md#\331JL\265}do}[m\034Pm\373\310\336\361&H\257\312\226\035B\372\352r2<I\231P6g\271\207\354\"\246\332&r#e\034s\331D6\327\026\222\341I*v\362\"\200\034\225\2241\030<\374\344\255q\343#\325\377\026\262\275\274(\215\324\311z\007Q\265v\304Ee\375\020Z\366\277\201\230j\273k\357\211\205\301s9e\222\b\301\262\037\302\312~\210\260\275{l6\313\037rY?D\222\375\020E\366C"
+	.string	"\331\017\321c?\304\325~\210\033\373\337\033\rNO.G\035\232\251\247\254\037\202\306\316J\263(\355`\022\245{jS\005Qa+\242\226\365\367\215\377\301\006$\231S\313Zo\0339\016,\354F\326\3375\200\3340\351r%\353o\032j\201z<\262\336R[\006\b<\034\204?\300"
+	.ascii	"\361\221\365\277g|K\375\352\322d\223\001S\b\314c'k\335\004\304"
+	.ascii	"\367\214\03692K\263\254\017\342m\337\0343U:W\377\350l(\364)\366"
+	.ascii	"J\353\021\263\305\201\256\001\307iH\326\373I\211\326\026\006"
+	.ascii	"\304*\353\203(\333\377w\323\216M\265\355\244\002\346\355\244"
+	.ascii	"\006n'5\017 \325WX_\240\023\262-\251>\b\252\375\017\352\354\177"
+	.ascii	"\360\266\325>\325O\305\363\007\203mSu[Y\377\2030\373\352\235"
+	.ascii	"\377A\341\0215K\242d\235\371\256\332\371\203*\231\025T\227\254"
+	.ascii	"\377\201\227}UO\335\373\203g\2363m4\262\376\007h\373j\235\377"
+	.ascii	"\301\020\334\005\031\313Z\315\3332>\210\302!\b\347L\316\027\336"
+	.ascii	"\325\274<\345C\213N\326\352\022\304U\274\f\306%..\353\037\223"
+	.ascii	"(\375\007Sr\3448\211\200\342\023\304\315\233\032>8p\324\273\034"
+	.ascii	"w\305q\230j\346\355\313\322GK\227\035\333\235\232\25371\0337"
+	.ascii	"nT"
+	.string	"\266\233VbDXi2O4\316\224a\303F\265\313]n\336\252,\341|\370=\311Z\265C\363t\0342\201\177Y\377\003\226\272\272\024ML\2103]\340\314\210\311\372\037\216\3544i\3423\351U\234\032Y\326\377\320C\235S\347R\264`\336\0072\255\016h\027='5Y\377\303\r4hR\264\340\007\361S]\336\207\036eP\352\362\362\304\305\231s\346Y\\%,\273a\007K,\216\315p\200\372\211\361j\223\365\217\326\366\257\276\275\231sg\034s\035\021\2229*+S&\357H.\252\bV\\\326?\002\033\243\266\251nh\236\031_\305&\r(nH\226G[\373G3T1\252\2304M\215\207201v\204d}\017\356\326\326T\266\243\277\237,a\262\234\271\312\306G\206\353/\353{`\306\313\275\250_L\rq\034\026?\325\34182\303\342t\204\3712\327\363\006\207\230\225\254\357\001Y\2274)\036\004\331\367"
+	.string	"j\377\352\026u\013J\207\316\226j\347i\216\216\254\337\001\034\264?\004\b\252R\315b\232\3558,~b\323\364\301\311\231\375\016\274\354_=;3\315>\210\237\352\256\034\365u0\246\222\251J\225L5\263bE5\273\220\323\007.\363*\213\033\275\262\253fA\3003Szt"
+	.ascii	"\266\337\001\327\330\230JEC\034\3072b\030tQ\362,\317\254\220"
+	.ascii	"PeM\305o\257\355\201a\313\372\035DE\211\242N\271P\032\016\314"
+	.ascii	"\b\323H\031C%\305TS\247\240U\304(w\3305i\242>\271i\025\207\361"
+	.ascii	"\300\227\247\340\241i\222"
+	.string	"\365\257:\271\372\344\307\215\207\024\037Y\177\317\234\373\037D\205\360\305Y\313\372\034\220\331\277\nf\252\251`\350\027\023\272\342+\002X9\003\373{\363\3631\227\3659"
+	.string	"\263d\211if*\343\252\036,\016\224\250__\246\331i\305\201\325\376U#\252\021\025I\207\256\370\352\203\275<\260\277\254d.,K\326\352\02154X\332\262>\007P\373\036\352\250DT\"\030"
+	.ascii	"z\220\333B\204\304@f\264\017\265)(Y\337CZ\220 h\236V\3068z\256"
+	.ascii	"\246\214\374\2119\001\002\004\315\323B1\024\021\2630\017Y\373"
+	.ascii	"\252\017S\375\361\343\017\317\276\211\346\245\277\252uSM\325"
+	.ascii	"R{\230\320\025\347\350\360Vg\212\\\220\206\335\222/\001I-\322"
+	.ascii	"\021I\002\206\273\203=>@>D%x]\372pD.-!\211\307vu\203-\336u\005"
+	.ascii	"\314&UH:\266?H7F\222\020\203\313&\227\330\025\305\225M\201tc"
+	.ascii	"$\021\255"
+	.string	"\256\t\230-\001\206\033d\3428\002F\212\fXxM\241\364\262.\022\233\202\230\202\310\270\266p{<\241\202\350F\360\302.\022\005\013\257D\244\3218\"\202+\035\301DW:\032&\337\245\017\311w\351\205]\025\354\273\262F6\205\212\344\273\224\001<\\a#[\202]j\341\236\026\357\272\202u\201\212C&\204\330\367\035a\341e\213H\024,\274\027X\342\2215\266*~\212m\362\247h\311e\341\0230\253\242\330&\205\210.\\\351\350C\322\261u\221p{D\242\360\236`\221\326\327\330\256H\026N\250P\221B\210tc$YH:\266\307#S\212#\262E\2721Jp[\023o\213\301\225\216\336\244c\353\302\357\007\266\310d$\036\333\017\356\313\364\341\302\013\244\253\004#\217*\322\312\0325\374\036\221D\364EB:\337$\313\216 \201\np\262\004\013\257)^\026#\220n\214$\24079d\227\220JC\025(J\270"
+	.string	"\263*\034\300\262.RqeM8\"\333\243\313\302+\323\003\230\226\332\n\340\366xb\005\322%\216(\266\311\nI\307V\002E\026Fk\342m{\204\256t\364\001\331^`AD\212\340\350\200\027^\341\367G\351m\217\255\t&\013BC+\261-\036\333\367\003\262UzW\243\211\"{B\322\261=\272\353\213\240\342\333\n]\351\350C\206\367\004\3532\301+\213$t\245\243\t\214H\"\022F\272(\332\b\256tdAqE\236\300&\255.\353b\004\314&M\300\016\205.\f\031\327cR\253\"\351\330\272hY\"\233\342=\001\303%:2\021\301\303\027\205\2675\032\333\2454\251\b\2105\262XW\300h\227\266\313\302hQx\333\n/\322\205\313\252xY\270u_\364\\\351\210]j\341\027\351\022\333\245\324E\232x[\020\333\027\002o\033\301\333\302\030\361b\245"
+	.string	"\314\276\254[d\217,;\302\273\232@$\256\026\340#\373\262.\212\342\333j\210\221\204\341JGGd\273^@$\256FW:rY\230]B\272+\013"
+	.string	" \335\225\005\006\365JG\024\2600kL.!I\234x\3375\271\204$f\200\225\222Z7\t\201\267\r^\351\350e\213\310%\022\"pb\005\211\021C\022J8"
+	.string	"\205!\211\024C\025'\206\336\"\022\205\342\213\304\020#\211$A\001"
+	.ascii	"\340+\035%%?$%\211G&\023=G\244\214\276\303\244\244\017<<&%\321"
+	.ascii	"cR\362T\202\223\216\2541eSh_\375\276\254[,\256j\214$\222\250"
+	.ascii	"]8y\376'\206\013\277m\022\233\302\002\370JL\306\325\305;\224"
+	.ascii	"\200\210\241\310\036\223Z\343\252\026\331\227I\277\352Wx-\016"
+	.ascii	"\223\222G@Gd\013\023Y\327E\2220&\227\330\025I\311\016\354\333"
+	.ascii	"\026\t\255x\333\237\023`6\211\310\304\333J\220tl["
+	.string	"\274+\374\223\364\211Q\\\331\024&\256t\204tc$}x\227\220G\266\004[\301e\341#\023\222D\261M\n\251@\2721Jh\361\2560P\005\020G\311%v\005\322\215Q\002\374\256F\013\257\213|\217\254\n\243\021\211b\202\021o[\341e1b\002\tB\034\025I\210\341\302\354\022kdW\300.\022E\221uW\2457\003\t\f?\"\216\216\016\030!\250\370\236`\213\310%\267]+\004a\244\020\"\032W\242Q\005\257\273\006\255\360Z\242\330&\325\030\306\326]]dr\211]aA\261\005\221U\"\001\013\271\254\321\002\321\013\201\013/\004\212,\274\032\231\226\230\210\304\021\023\274\020(\261B\0028\205W\370\025\026G\300\357j4\202G\354\nK\356\b\344\212\244c\033\303\205{F\304p\341\237\023\330\027\002\307\225H\024tlW\024Z\274+\034\301\006$\212\026\304\326X<\256J\036\254\200\337\325(\224\376\024\301Dh"
+	.string	"\216`\244(\256J\252\322\273\272$\\\026F\032\341\262.\034\220l\215HF0Q\205\017\216`wM\036\275L\360\n\253\300"
+	.string	"\027]\351\2505\022?\264Fb\021\211Bk$\252/\313\202IE\261E\021\001\273\324\302I$\362\204b\213\002f\223\334\025\036B/|p\304.\265+^&d\353\202u\223\030\256t\224\304\304\202-~(\032[&\026\030\330\"\022\205 \004\\$\214D\241B\205\024-\336u\005\013\246W\350\210,\262l\003\210\304\225(\351\370\266?(\340#\353\272L\304\241\013K\352\016*\036\327\245%$\t\242\033,\032\221&$\255(\374,!]\024$\220\200\204Y\027\253\212\013\330#\262\004|d\227X\227\351]Y\0244\3100\"\351H\264\240\"\b\206\273\302k\t\242\233\016\331\245\026>2\271\037\210H=Ev\311\035A$\216\230\340\304#\326-b\321\032W\022\307\023,\274\026\223L\025\234\330\272\354\221M\332\017\200"
+	.string	"<\020@\b0\324\207P\200\017\n\360A\372\020\n"
+	.string	"\002D\001\004"
+	.string	"b_"
+	.ascii	" Nvh\001\206a\030\036\276.kd\"\201-2\301-\f\257E\354\260x\242"
+	.ascii	"\305\273\302\273\210Da\210\035\276\255\261e\261\302*\212m\362"
+	.ascii	"\002;L\262,\013\037\330\004\020;LQ\202\035\276I\253\321D\t\013"
+	.ascii	"\354\260x\002\006\222\205\n\017_\b\260K-\274\341+\035e\300\302"
+	.ascii	"k\n\242\020\212-\n\256\022\254\206\200L\302 \301U\202\367\373"
+	.ascii	"\262\360\232\202\350\252\310$\f\022\210n\372\262\360\352\242"
+	.ascii	"%N\240p\225V\034c\024\203-V\326e1\\\223p\004B\266\210DaM\302"
+	.ascii	"*\274\304\244\342|[\030#\212m\362\247\330&{"
+	.string	"\226\220G\2668|_\226\210t\223\303b\233\034:\"[\370\310\272`\335\244\004\032Xxe\213C$$$\333b\205\2071\326\027\353\221\311\305\340\035\256\360Z\342\210la&#R\305\233L\032\202\257t\364&\223> \333%\022\260qE\337!\021y\302\233L\372\201W\343\251\036\221\306S\311h<\213\"\324\"\313&U\364\260\257\313\204$Q<2!\335$\237$\262\250\244\341U\305\022\3231\275\322\321\213\304\026\207\033\274\360\221uAB\022\362\204\013G\344\273\262nZB\204\320\013\244\021H)\251U\n*\2120\256.\314\304\036\203\303\242\b\242\027Hc\217RR\2534,\212\360)\212(\262o\320\n\264\344\256C\370u[\244\341\02194\026-\271\353\333\026\207\256t4\301\022\013\2771^ \030l\361x\"\310E\013\023\327!\266\210\\\022\276\304\026~[x\205\337a\213w\205\203\224\210p\373B\305\213D!"
+	.ascii	"\026^\335\242\026D\244\221\310\224$\376\260K\355\n\226\270\272"
+	.ascii	"%\034\035\340\262/\220\311\b"
+	.string	"\\\266Ej\341#[<QtW$\213\240\024\224P`_\245\224\205WX\205\313D\254\300\302k\n6\205v\251\205\223\016pY#S\221U\"\276EI\307v\311\035\321\202\330\302*X#\213\365\310\016]\351\b"
+	.ascii	"H\026-\210\253\221\205\020kL.\255o\017Kl]\260\305\264\310\032"
+	.ascii	"Y\254o[\034\276E#\333\"Y`\213\310%\375.\rY\227\tN\256\304!\322"
+	.ascii	"\215\221\024\364\272H\230\330\026Y7\231\\\213+\321\225\216\336"
+	.ascii	"\t~\340+\035-\275H~x]\326E\353\0265\274\251\013\266\304kdB\341"
+	.ascii	"\262\360\221%!\304\302k\212\245\027(|\\\260\305\223\003\254\213"
+	.ascii	"T\001\351\302e\337a\221]r\327#\323\260u\341!\330]a\025I\307\226"
+	.ascii	"\202+\035I\360\303\302h\227\202\357\2135\006Q\362B\2625\"\275"
+	.ascii	"C\024\3056\351\223\202\322\360\305\032\003(\005\245\241P\nJJ"
+	.ascii	"D\030y\204\257tTl\223&\314w\210Tl\223)\n\363\204Y\302,\266\311"
+	.ascii	"\023>\266H\024I\246\342\261\225\300\205\236\027+\005\230T\024"
+	.ascii	"\333$\320\261E\001\036Ql\223B0\221EB\"\202]6\t\203\035\302\306"
+	.ascii	"\026\036\036\221)\264.R\311\210-\"Q\210\001\267.V\267\204\026"
+	.ascii	">\256A\021\034\333\265\004\027\t\257.k!\305\2135\306\220\221"
+	.ascii	"%\022G\260\360\352\002\025\223\204Zd\022f_#v\251\205\2051V#["
+	.ascii	"\354\261@tD\266\360\212\242\273\276p\221&\212,\213T\364b\215"
+	.ascii	"1\f\022\246\2404\f\361\276k\362\005\3228\024\303e] \211\254;"
+	.ascii	"TzW\227\b\004T\004#\201\330d\fX\250\355I:\256F\027\216\355\232"
+	.ascii	"4\364.\r\213+\253\264\266@\"\215C\227=\266\253\013\017\221.q"
+	.ascii	"\305pl\327$\241\241\013/\213\265B\b\227\205\215-R\205\024\224"
+	.ascii	"\206\3076\005\245%\227\205\213\026\330\"\022\205#KtY\024+2\300"
+	.ascii	"\355R{\302\205c\273\226\220\302e\223\222Zw\305\013\244\3218B"
+	.ascii	"\211xdZ\215\025\f\331\227\251\002\214\325\310\272\303\027k\214"
+	.ascii	"a\221\205W7\211\205\217\255\205\024Zwe\217\355\t\360\313\344"
+	.ascii	"*\301D\350\261]\223\204,\361\270\272(\256\305\037\230)\t3!\207"
+	.ascii	".\022F.U\200\217LH\342\320hd\211\303\013F\030F\272J\360\020>"
+	.ascii	"\262\355{\\]\330\b~\221H\026C$\244\355\256JD\315.\255\r`\215"
+	.ascii	"-\022\322M\366,%\335\341\261]\362)\262l\362\035\302Gv\t~\231"
+	.ascii	"6P\\\213\322b\233\004b\337\225u\211\307\2265\026\333\241\344"
+	.ascii	";d[xu\221\220\206\340v\2515\016\331\026m\362\035\"!\001!!\t!"
+	.ascii	"\2230\330!\353\302e\"\036c\024+\260E\344\322\220%\256\356\320"
+	.ascii	"\310\272`\215A\357\221M.!\211\303\244\365\035\302+\013\027EW"
+	.ascii	":z\211\356\007b\206\227\004\321\255\260_\254"
+	.string	"1|\212\307\225Eqe\213Cl\222\021\2514\204\215\253\205\"\373\272\254\013\326\035\032\221.|D\022\207/\326\030\026^\254\356y\245#\246\245\366\003\254\224\324\032\221\214\214F\244\253\225\210p\233D_\2541\316\227e2\256.\322+\035\301p?$%\211\216L\262\356\007\030\211t?\364\274\303\244\026\351\210$\001\303\025&\327%\242\213\272l\261u\201t\223E\026\206k\\[\227}\207`\260\306$S\t$\343\252$<\266\032\340\241\232\264\256@\266\303$&c\322h\bf_\326-\036[\026Cx}\207KL.\334\202M\276\023\370\260\306\225(\204]\326\305\261%\272\305v\t=\266K\273\005\221U\"\302X\227v\320K\302\270\2728\"[x5\"\223.\013\037O\020\335\013/\313\272Il\t\326\230t\034\261\264\222p\221D\252P4\"\225^\326UZ\301\302\253\213\026&\216`\213H\024\334v5:\266\360P"
+	.string	" \210\354\3134\204\261.\ra\270=0\230\326!\214u)\350u\221\256\313\026\2450\373\"!!{\330d\fx\b\003\022\022\022f\"V\360\2660\326a\022\023\013\266\b3%\217\355\0056\031\003\036\262.Zxu\321\272l1\203\213\204\211+\322\020\t3\255\303\244c\253\004#\221K\357\220\350\032\025\221\255\313&\207HI\343\220]Z]\244!\321}\207\355\373\272\030\212\355\020n\217L?!\2140\3347\b~W\244a\221ie1|\231X\274@\3600\004\370\3302\251\356\361\035\302p\207\354\3134Dz]b\020<\f!\002>\266L\273\305\273.\r_#{<\256J\304![l]\227u\201\034&\337%\t\340\241"
+	.string	"@\300\307V=\b\020$4@\240\001%l\342\021\353\"\211\037\210H\037\216\355\272\364\201\350\276\037\216,\030\221\310\021\206\350\377\036\037\301\274\240,\273&tzz\274\001\312\372A\247\243\207G\260NU\0333\307\255GK\275\023\346a\"\327\267C}\202\306n\231\326\223\025t{\223\262\004\243\003\213I\034+Vf\330\346r\\i\005\252\021\363!\002u\246\016\216\036\253\271<{PY\233\302%hx\254d]\243F\017\325V"
+	.string	"\236X\325\261\242\352\271A\246\304\207\217\236\033=SS\246\244\251K\261\214\316\236p\365\330\310?|\272\334\350\271\361\322\003\325\003\325#\365\243\303^\036\330_\217T\317\f?2n\302\364\314\350\221\221\204G\2361\365HZ\346\227\207\252'\n\025\263\223#\213\232\254_\342l\003\002\3668q}\020%\257\314\252\307\251\247)\265C\206\246\244\247\251'\276"
+	.ascii	"\025\031r\002\323\035`X\340f\004j#z\312\r\033Z\262~\t)[\311\206"
+	.ascii	"\207\252\313\237\332\343\207"
+	.string	"\324\216/27*\277 \026\024\033UV\356\364\325\2412g\212\322K\034\307F>V\224X\336d\235\227'\344k\222\227w\206oO\314\217\230\311\236P\017E\233\250\276:)\2350*\020\317V\035\r&\275\252\022\207H\326/ad\377B\274<\033fL\261-\3237\302\261\251\2705:;N\334Z\224)s\204r\376\21281\003\264D\252\207\\\034\341]V\032:y\224x\200\\\304\300\021\276ab\267DH\326=2\212\340\351\253{\235\260M\006P\200D\324\226m\354\202\324\001\374b\307&\230\347E\207gM\212\367\023\225\026\205\310\032mGuR\307L^\0174h\204i\216tPF\t(\226\206.\347@{+B7\227\336\251}1\"\227\372\bZi\022\217\311\241O\350\0341>\232d\375\0226v\2312\3028 \0314y\362*\023\006\213S\250DDSU\346S\252 \206B!\005\235b\n\315Lm\202"
+	.string	"\343\025"
+	.string	"0P8\032\220\n\306a\315"
+	.string	"\024"
+	.string	"\rW\322\244vF\035\315QP*\245\020\210\f"
+	.string	""
+	.string	""
+	.ascii	"\004\202\240\001\301$\021\002\243\tD\356/o\334\271NdYf\251me"
+	.ascii	"4/\272\247\002\316m\226\234\314\377S4\365\034\345\363TW|E\327"
+	.ascii	"P\361.\356\234TT\254\225FSv\2002\254\344\316\266tao\0050B\311"
+	.ascii	"o\264\210L\367\312\r\302\213\205s3\340\222(\264[@T\300\241\351"
+	.ascii	"\277\333\375\202a\274\336E\357\036\\\370\346\005\216Mr\306U\245"
+	.ascii	"\007!>v\342\300\354\201V\360\022\341\b\370H-\005W\243\267\022"
+	.ascii	"M\003_2\233\"LUE\236\034pj\206`\321\326e\345\201\264Z\206\262"
+	.ascii	"n\007o\024\306yH\266#\234\366\337\303\250c\025F:\221\267\b\037"
+	.ascii	"<\025\270D\341\233\361\313\265\t\314\351\265K\363:\253\360\326"
+	.ascii	"\357\264i\263\032\035Z|\373\273MP\216\335v+y\312"
+	.string	"/\271\245^\035<u\336\215p\003\003z@E\261\250t\023B\360\273\335\330\354O.f\236;\251\017\204C\334\353h\251@\027\265\034\200p#C\301)\320\210_L\323\346H\321^)\325@\352>\"\201\004\243h\252\3153\212\340\371 \353\331\373f\025\r\237JO\343\371\177J\274\0077j2\226~"
+	.string	"\346\210W?;\016T\031\364\016#\261\327\240^!\255\2500\200\"\030\024mAZ\334W\312\325L\347B/%\216\271\324\252\230[\277)?\307\241\211\242 c\274\231h\374-"
+	.string	"\271DA4\337\36636\200\372\261V$\340\027\264\346\230\335\032\004\316wv\250\3764['s\035r\215T\3226\337\312(\370\335\330\005<\275\026\033\303rm\220\231\332\257\035\0131\001\261\004\244P\030\252\354\205'\004QJ"
+	.string	"\177;*\303\265\004\f'\234\357!9\004\345"
+	.string	"\342\036j\034\224\2156"
+	.string	"\020\f'\251\303\245\221\023i\307\361F\261\347\232\373\353bB\237\246Kgi\006\216\203\252\035=c\004l\370Z\264\246\304\300\2223:\212\323\023\240\216\330\376\020\326\323\0366z\202\322\317\347\020B\007"
+	.ascii	"\357\020\300n\202\311\205\330\343\222m\f\202K[VH\363(S\\\237"
+	.ascii	"G\006\261L\020r\026\260D\342\t\026\262\345\242M$m3u\353\277\201"
+	.ascii	"\363\224l\214Dy\223\266\223&\232yx\241e\034\212[-H\031S\307Q"
+	.ascii	"\302\252\223\"U\003]}\214}\271C\363\375W\006\303@\265\331J\323"
+	.ascii	"\350+\341d\235\275\302\322\266\315\333+\254\355\333\177\003Q"
+	.ascii	"\204\020\202u\323\342u|\004\261\2741\333\337B\335\212Z\357\216"
+	.ascii	"\245\256.\255\037K\212\277^\272\225\325|O\345\003\"b\310\313"
+	.ascii	"\034\265\024E\230U \003\360\360l\267G'\022\2026\271\340\244\262"
+	.ascii	"\2143\2312y\036\257Nj\236\273FCI\232\355\275\347\032\263\205"
+	.ascii	"\346_\2342\345\244"
+	.string	"\232\276v0d\335\245\375Uh\003\225\223\343\034{\b\350\346\006\330\254\371\262\2671\226\177\261\267\023\020\374\244\225\232\351\324[l{\021\201\206\354\216\202\016\007\013\020\205\357\255\225\021\345Z \231\277W\320\347p\355E}\352a\201+2;\213\364I[\350\373\200\3117\343Hq\003\360y\025\375\334b!\361|\017D\177C\006\262h\3344\245e6\245\026\316\007\364\203\211ZuVnJ\005D\232O\b\262W&#,\371\317\247\207\346/\233\223\354\373\234\033\001\022\372e\225\226Z\376\023\314~V\016Q\203w^\036\001E\001\002\024\204\313\367\003&\206sDs\254\"\304\006'.\316\261i\b;\353\324%B\270a\222#\365/<Q[7\307\223}\036qYZ\"O\2575\3048Y\022>\315 g\006-\020*\021<:<\250\242:\"\345\307\210\343\330\016\232Y\331\343%\273\354\205\220\353\3157\340\275\020-7+\264\205"
+	.string	"\316\216\245\320\362\321\2000\275\357\323\272\243(\320\350\311\001B\242z\231\2767*\020\220|E\n+DS\324Y\260_E7\336\221\026Q\240\364\233\324\201_%n\3067\177\322\203\332\023G~\034\246v\216\362$\341\300 \030\3110#\313/U\fR\333_K\340\253/"
+	.string	"\351\247\313w\235U\033\355\235\360\r\035\333F\007\244\225\236\033%\00472\270\030\334\245nx\213(\236\222*R0\336\372\332\237\024\316\374\201\362A\270sK\3600\207k\236\324s\270\257\223*(\376q/^\243@\307\227\033\321\272\360\322\025\213\020\036SK%\250\340\367\031\230Nkf\205\363\212N*D\322\276M\231\036\263\240=*\206\243\223s\"\365\2645\262\325r\225\273\227\210\321\2635`\031\264\2603Z\036\342\002\315-\004\250/\266\nf\266\332h$\237y\017\344Z?\366\325\267\344\2270gt\343\336\364\244\317Qu*\267\372\325\360\345\345T\375\2341=Csg%\223\254\n\212\327\033\311\224u\223\214j\237\351\244\313\037\026\264vLtz\324\337\256;cWT]bnC\327\307{.\337\271>*ziJ\253.\207\024v\271'0\216\224I\030\262"
+	.string	"\221\362\326\325\246\002\304\215\245[?\320\261\223\305(\205\2223t:\270\006\224\2233\256QL\266\006\212\272\256\3534\213&w4\005\343\321L\260\356i\016] \231\"\310\270\336Y\262\017\347"
+	.string	"\250\200C\2255\333$\366\216*\202\233(U\300\355\272\367\n\265v|\231\320\307\313h\310\20788F&b\212\200\3647\344\307\033C\263\370W&\343\232\340\2266(d\276>\372\265\200T\032\350gm\273\002I@\352>\023\355\232\302;\251\274N\233\367\243M\355\3037\003\253\245h\350\2069\271\255\267\207\253\270\203v\316\247}\265\304\026R\254\241\\^\356o3\356\0019\332_\356!f\013\346\317o\374\226\363y\370\207\031\234\030\377j\242?\272\3048\245\320\211\224\3151\245)\310\316\373\020f\\\210\2214\267\264x\250\340\035a&q\372i\343\343\240\212\026\006\314\221\205!\024\321\230}\006\245\240A\310\024I\317\203\366\377W\267C\221\230\234\226\026\363\216\002\375D"
+	.string	")\200\362\327\r\331JF\201\2478\224\3012v\217\201\335\373U"
+	.ascii	"\3147\003\341\236\023G99\027]@\260\341\225;\"w\373\354\235yg"
+	.ascii	"&#\3064\374\245\333\231\356ON\340G\306\306\343\024<S\017\352"
+	.ascii	"\252\247\2316\212I\310\220\215k\374\312Q\262\275\033\001\333"
+	.ascii	"\026I\r\330\334\263\224\317\226\016\331V\337\033\245G\177 @\201"
+	.ascii	"\272\270\322\371\306w\350\001q4p>El\313\243\021\360\3079\026"
+	.ascii	"\274\035\212\212s\324\230+\3333\020k\253\023\236\002n\272\236"
+	.ascii	"\237\340T\037\034\243\371>:\2320\031\241\371\216\304\271F\322"
+	.ascii	"L\321l\035\304\275K_y*\226%\343T\206q\226\335\224j\350]\016n"
+	.ascii	"\235\254\247\205\315\"\366\367\232g+#\013\303\344(\2361\376\377"
+	.ascii	"m<\363\004\236\250\036*\216\254\023\222\021\233\013*\374\323"
+	.ascii	"#o\360IEem\305g.\273\216\335\324w\0337h\001\213\335\304\251S"
+	.ascii	"\323Z\254\347\356cL\303\n\211\275\352\350\362\206\331\250\201"
+	.ascii	"\331\207\331p\244n\\\371\323L]\026\031\023B\035\213\257\036$"
+	.ascii	"q\224\344k\345%\332\236\332\242J\357\362\346\227\242E\210\250"
+	.ascii	"7rN9x1\375W\r:\330[\324\272\265Xx&3\3640B\260\372\345\b\223."
+	.ascii	"\375|]\"/\370\2774\350\f\324W>5WV\357\344U\376S8W/\026bD\363"
+	.ascii	"\360J7\353\241\372\212\301\261\270\024\022\355\023\367\326\363"
+	.ascii	"~\354\242hq\311C\\\221\256\003\030\003\365\343\351\353\3634x"
+	.ascii	"2r\316}\256\240m@\267\036DI\370\303\221\271\326\345\331\242#"
+	.ascii	"\250z\351\305\356/\374\222\237\320\001\304 \006PnooH\371\033"
+	.ascii	"\360\214E\320\217'\345t\225\032/\f\257\214\034\243\307\022\322"
+	.ascii	"\022\224YW=\226\r\017W\243\252\311\237\302\023\341\320\037(T"
+	.ascii	"\200\341\332\003\036\260\304\215L\356\020\351\342\245x\331y`"
+	.ascii	"\245y>\343\311\345\312\272\3151|e\277ML\240@(0\345\3020z\215"
+	.ascii	"\025\225\317%\365V\266\313p@\246\3206\351\237\265\001\302\354"
+	.ascii	"\255\206\024X\341}r\007\267\332\241\365=0\030\353w\252Z\226+"
+	.ascii	"\221\227\200\203\247\3108Y>D\301\377\201\2511x\016\202:w/\253"
+	.ascii	"\177\272\250\240\376\200\313D:tJ\036\334\237l\340\237$\347z\360"
+	.ascii	"\237\220<\353\016\276X\256\326C\246D\b\004\212\221\264\0305D"
+	.ascii	"s\316\242\304\026\371\036\270\370\241\004\324\305\323Le\036M"
+	.ascii	"MB&]"
+	.ascii	"X8\t\357V+\200\357b\030\342}\004\244\320y\202w1o\007\223O\264"
+	.ascii	"b\231\b"
+	.string	"z\310%G4{$\346\343`7\314Q\225\261\352\037CL\310\323\314\005|\204pD\320`AZk\207B\253\301\017]y}\251\325\211\f\364\245y\374\215\224\343\003\017\243\201N\356'\311\350\344-\312o\\\222)\335\007j\\\237\217F\320\300\b\215\002\217\240p#\331XY\007\251\234\364\0315\035\020-KP\fV\330b\313&i\\\242\002\2002\354\222!\270\377\3762s\216`\305E\326$\263Z\272\240e\304\215p\235\342h\340\205\272\260\223>v\251m\241\225\340+eg\376\0072\220\332=|\"\356nb\350$\236IFx~\324\024\366\235\315J\bp\b\315\274\317\265\032\252c\310\237*\237b\031:<\006\177\267\222Z\241F\026H\2440\332\323q\252\263\243\340G1\016\021 \343\313^\020\237e\333\3407C~ \007\0312\313?\202\221\260.?\202gr?\273\370\374\207\207zB_\377\212&\310\2041pV"
+	.string	".\251\024]+\025,d\275\270\237\205?gX\344\203\3450\335&"
+	.string	"^\255\306\272z\247>\231\274M\032z0\213\324B\321\f&J\226\2320\357|\322"
+	.ascii	"k\0021\233_\324\205\261\346\355\200\360|\202\245\327Y\206\254"
+	.ascii	"\315\355\212c{-\343\202\275\026p|\212\245\304\227D&\0351\333"
+	.ascii	"\207>\336\370\206\366l\375xQ\276\302\r\353q\203\317X\016\265"
+	.ascii	"\200Bu\267fV\207m\363\2633\262\374\016\"\024\024\323joe\231B"
+	.ascii	"\256\316~-\312\236\210\006.\034\334\3270\265v\276\026\223[z\363"
+	.ascii	"+\035\343e\r\235ms\322\2049\272\322\215\n\377\007!\360s\242X"
+	.ascii	"8\366\023\027\020\256\315\214+7R\006\002e+\344\001\356\201\332"
+	.ascii	"\204\267\030\301@\326\005"
+	.string	"\306O|\271jn\323Q\233\231'\307\023\001N/\330\266i\266\234\322\203D\024 \347@\b[A\334\370\"O^1\201\r<\273\211m\034\346'f\205z\303+\305b\203t\360z,\341\311\366\3460k\373\322\214\354bF\3555\225\306x\274f\031\272:peZ\200\3005\321M\026\3737\364\334\247\225\3363U\200\030\301\312;E\001\313\016\2271\361\034\251DV\226\306xq\331\242\250qY\024\200W\177.\276\327\243\206U\227\354'\344\326\270C l\361*-MUR\243\032\252\336\200\3716@\001\371;\257\321\205\354\341\207\210\016\026\354\226D\007Cm\321\343z,\275\027\332\222%\327rb\n+\354\332\366\020a\0243\366V\001\274UMHq\021u\001\313b\271\362l\343gKA;\030GC4 \3236\223\241\361?\266\362ia\323-S\367\003\030&C\304\200V\361^z\377v\b\256e\221\027K\"\034\301"
+	.ascii	"\202\001\221YbZ\006\340l\376\202+e]\177]`\277\312.\017\365\321"
+	.ascii	"@AY\202{\031\026\001_\002\271e\204\351\020\313\275\013p\372\220"
+	.ascii	"\2167\212\030\246-\246\322\017\257\341~\245\202\373*\323\205"
+	.ascii	"\n\034\304\0268@cP*\022\253t\301\021\013\370CY\222[\374\361b"
+	.ascii	"$\226>#\3263g\022=\321\254CE\216\345\261/qs\214d\306:\222\237"
+	.ascii	"\312+\362!+\347\217\242/\251\347\364'\332\230&x\3566\312#\027"
+	.ascii	"\260\240\356\226\276\323\366\021 \231o\n\376"
+	.string	"!0b!0j\020\216\204\177\3577\374W\341\307\321c\036\245-\236\237\241Mr|\027i\220]=4HAC\204\332\310U\316F\030l\016nC\204\270w\234\374)p+c\245\365\260\307>\307\007\344.\2309\020\210\231\331\247x\005A\223e-\346\310U\324\2604\206'k-\036l)\307\004\210Hz\260\223A\312\373\353\236J\2421\336*q\304#\326 \257zH\302\301`|~\344\222mbQ2?\320r\320\245fB=;/\037\312e\346\033\344\277\001wl\202\373\f?\204\037\253WK\375\274\322'V\267-\375\243\005@\231\363\2467\b\206u\342\332\322\255\274i\332f\341\303w\302\024\224\344\277\204\210\225A\267\017\272\354\223\273Y\215\312\321\242\016~j>r:V\351f\023sw\204\373!V\025\037\"\254>(\215\250U9\364\256\001oXS\267{\354\243\214\375/\305\232g\t\237\300\324a;2\024\b"
+	.string	"\224\356+\303\007\214\256\305\365\364\373\302\233\212P\307\225E\271\320\037+1\256\310J\207\305{\021\200\032L\260\003\235\275\263B\376\240\206 \350\262<\334\261{\325\315z\274\263$\306\022\357\213\210C\225\217\0273Bb\324\201,M\310T]\352\323\t\321\177\224\217\201\t\336\362\235\305\261#\374\251r\",\216A\270\2678\212\353\364\215\216w\360\264\017\334\247Y \212\254\310\206 D\334J>`8\376\362\246u\360;\374\177N\033\245\235\340\021\224\375\233\217\206\005p\036"
+	.string	"A\227d\210\253\033|\020\251\252m)\247\320n\322\017\207\355\235\322Q\305i\033\275\220\002\304\005\003\253C<\340\261\375-\357k\375\327\332%Q\377\b\316v\345\234W8bbu\217\302+*\346\272\250\244h2$\221\004W\230\023\375"
+	.string	"R\003\345l\264G\r\241\035cc\\\03075\251\235q\024\225\247\325\317t\220\374c\326\bxz\262\273\0233\037\371\253*(\241\262\273`\262\221I\361\0258+\374\r\332-\352\366r\006-\222l\204q\271\354-\344\333\036\325\214\007\351A\234\032v\323G\244\r\022\331\306\373+\242"
+	.string	"\223\204\202\3203\271\310\265\207\r{{\030JJ\r`\325\372\347\305\373\037\177*\221u\005;\371\274\373\306\022,\240v\025\3679N/\027\335=\272\255\026I\317\343\241\235\273\333\b\235vu\363C\002\032\341\272\220J\374@g^AQ\242!\304\207ag\217q6\365\257}\030\336\365(\253\364\210\371\032L'\324\020"
+	.string	"\205\b\301\352\224\007fJ\245\275T?C\314\004pl\364:\235\353\315q\232\266\265|\221@\261\353du+:\245\312\fgqv\204\\g)g\342\177\214\374\027\360\301\025\337\326\350\311\350\214cE\024W\227\233\301\257\f\332\336xv\214\326\035QA\201\035B\373\3536}*c\t\230{ue*\236"
+	.string	"\023<\347\321A\016\366\371-\364|"
+	.string	"X\307D9\2139gK\300\2309]@\241\307\035\220\244\2261\250\2645\001l\204\330\336e\355,\222<\334\273\245\007\334\320#\205\241\330\276s\236\323W\371`e\340\312Eb\364_\237\327y\354\262\336\337\rC]\330\275,\013\221\263\030U\322(n\3072kPW\221#\035,=\376\342\204\211\310D\024\036S\274\236\337\206L\035\355\246\373W\031!\345e\025\203T\0277\255d\032\273N!\371\202L\350\220D\276\211}40\022\226{\224\303-y\341\223\331\250\333\350\t\003\323\253\220\364e\"n\r\255\005\366J\322\020-\r\250P\232c&M\34171\301m\224i\013A\370\303\007\215\325\0331sF\004)\2012W\210\330\227T\214]K\313\252\263\345lv]A\316\354\023\031\312\023qq+k\240\363`RO\250`4\256\213{\354\031\257Yk\327\225\033Gx}\030\362\360\344\254\306"
+	.ascii	"d\275\203\214\0255<`\036\3265\b0\033Ft\020U\035\362\023S\034"
+	.ascii	"\206\"\006\036UK\201\353\374j\020y\244\334\355L\300\341\316="
+	.ascii	"\001+\021\340'\321:\270,)\006\360\243?\311\020:\361\321F\303"
+	.ascii	"\030\214\032`=\017\213\024O\031\326J\272h\226\303B\026\217\203"
+	.ascii	"/\356N\205wc-\207\351"
+	.ascii	"9/\220^$p\354`\205\322\222\365\237OxPN\372\241\001\013\362\313"
+	.ascii	"\312\027\241\274\205\236\360]:\310*l\234\203\004\341\223\206"
+	.ascii	"\301\322U\256P\352iB\252\245'\345\244\024[\034S\355'\225H\024"
+	.ascii	"\241\r\342c*a\276\341-\263Y\345#\271\303\256%\354\342\316\247"
+	.ascii	"\341 \200\f'\0228\030\022Q\003\020\325\224\211\343o#\266}\036"
+	.ascii	"9\021\210\376fC\336\n!K4\347\030\200\310rV[\364\360G\350w\216"
+	.ascii	"\243\254\351\271\312%qGW\371\001\266\353\365\333\357\354\241"
+	.ascii	"\273\265\301\\\005>Wi\310"
+	.string	"\235\005$P\2223\331\230<N\217\025]\344\265vOv,\325\366\033\260g\016\007\350r/v@\007\001\227\016\021\372\242\225\366\211\204\270%T\030\345m\311\251\316h\261\270\334c\3432\225\177\340\005\256P\036[\323\306=\312q\305q\221-\331!\006]\264\035~\376\240\250\\\017\325\002\376X\273\177&b\251\335\244\376\206D\306\034\323\302\013\b7-drX\207\366\376\177\355\302_\360\333\241|\272c\220TsY\214r\241\034,U\360\324\275\036\020\307\335\032\022\025\363\357\362[!\374\035\247\271\355\310\373~\205pS\027]n\351g\230\244\335z\216@\374:\205\233=n\314\221\267\017\206\211uA\253\007\"V{O\303\311%waN\201\351(\314\037\034w!\253N|\355x\n\212\341\222\335\332\005\023\255\036p\237\30062\354\322D\2620\330\bw\304\217\314\220\213&\013\2633\256\375\254Rh\367\336\226\212r\330\244D"
+	.ascii	"\260Y\376\236\007\334\245\266\251\370s\372\035\255\347\212j\031"
+	.ascii	"\004:0E\224\202\335\354\230\206\335\363\247\033\341U\023\017"
+	.ascii	"\310\216\351E\266$\331;\263\350\002\227'\215\350A?4{\"IN\331"
+	.ascii	"\252_g\023\322\255\372\207b\347\321\213\224\006!\2668u\363\341"
+	.ascii	"\244\b\314\002\0135\352$\n$\031E\\\3501D\372\022\306\t\201\304"
+	.ascii	"\n\271\267i\340*\251o^\377-\316\227!]\212c0\312\271\240E\307"
+	.ascii	"(I\274D\017\253\252\3352\335\243,=\265\251F\367{{`\030#Xu^\240"
+	.ascii	"\334\3646p)\246\300\016\207\255$P\302\363\371\253\036\277\336"
+	.ascii	"\236\247\326\320\215\345;\247c\336\304\317e$G@\344V\262W\303"
+	.ascii	";M\310f\242Z\354zl\354\227\374\367\230\030I}\375MG\212\257\202"
+	.ascii	"\206\201\020\217\033X\244\265\034\214l\2577\320\365%\001[\350"
+	.ascii	"/T\201\217\233_\270\254w\3777x\033\260yz\b\246\223\204\277{\327"
+	.ascii	"\211\233\234:\004\"\374\201\276o@\263\245\327\016\003\265\021"
+	.ascii	"0\377\001\243[\201\342\"T\247$;\007\320'?0\032\273\030\276\203"
+	.ascii	"\261\211,}\205\347\360\211\255W\277c\263\004\372B\224\2704\273"
+	.ascii	"\367 \233\221\261\326%\3068\304L\364\b\017\216|\302(\334/|G\203"
+	.ascii	"\361\315\210\332\317\210G\367Z\273\026\344\377\252U\314\310f"
+	.ascii	"\326\271\305\270\253[\224~\251\373 \232\217z\335\307\310Oo\332"
+	.ascii	"\3345Cx\035Xu\026k,q\203h\336\037\320\302\333k2/\370\231\372"
+	.ascii	",z\240\271\336\205\371:\235T\272{\334cyS\036u\351Up\377\262\232"
+	.ascii	"6}B\341\237\262\273\3213QU\373[\250\226h\365X[\207\345f\377;"
+	.ascii	"\364\267\243f2|J\272a\251`\2437e\346\r\034\330d\326|\t\361L]"
+	.ascii	"/\235\177kA\310[~\355\333\025\234\020v\032*\177K\330\013\202"
+	.ascii	"Z\277\273\236A\316\023\374\016i\230\306w\223\035\254\372\\\277"
+	.ascii	")\221\fE\340S\360\362\234-\377\327w\336Cn\036\371\371\317\272"
+	.ascii	"\\da!\315\301\003\264\177q\354gB\241#p>y9\346\016\034\002\330"
+	.ascii	"\256\353=\356\356\266\246\235\241\356oV\347\313n0\230\013aM\363"
+	.ascii	"\300I\343\200\233\2459\365\006\261\272L\314\345\371\374\315\362"
+	.ascii	"\370\234\3366u\316\220\216\306\201N\267\373q&G\304G\315\233\212"
+	.ascii	"\303\007O\335\275\234ZO\350\365\3363/\320f\036H<\207\333j\346"
+	.ascii	"\365\004N~\224\017\263\307\347\267P\016M\367\254nj4\033^\317"
+	.ascii	"\270[\364\036\202\355e\275\277\200E\017\233>\bAs\250\273\236"
+	.ascii	"\250\330?\345\377\217\302\345\325\373\214\177T"
+	.string	"\354=5_O~\3415\364\304}\3002\017\346\371\203\206\356\332\377o\263\026\241\2630\030\227\360\266\250\006~\002\1773\036\261\307EV\205\223J\313\001\311#\210\277\235\237\317\246\351_\353\364k*\330\267\270\207\251\037\b\217\371\007\030\203\263\036\244\241\300\250e_1\036l7G\230\230\365}`{\322\357\317\346kl\262\370\321\325U\034\020Br_y\264\304d\177\376y\177\376\026\371O\337X>\236o~\3469\302\220K\325\226.oj'\211.~\030{\346\236\363\223\337\223\370\272\263kwY5\364S\017;}\207\315p\374\326\356\353\265\034\210\312\016\316|\236Wy3S\177-p/|\205v\313c\277X\2471\207\270r\342\370\326k\315\276\3774\304~_\316\363$k\336\327E\274B\354\305<\007\252\013\203}\355\007OS>\232\204\257\240p\233\212\203\351~\273\274\253B\374\016>\362\277e>\001S\301\335lA9"
+	.ascii	"\334A\331\003o^\301\307\274\253\245\327}+wg\304v\310\374\343"
+	.ascii	"\233\313\303z\n\315\243\225\013\364\373\211.+\b&\303|\247}\036"
+	.ascii	"r'\350\327\313\\\314\375f\377\003U\237\362\016R\320q\277\271"
+	.ascii	"O\244\362\324zH\214\234N[\207p\227\021\247#\376\026\356\302\217"
+	.ascii	"\025\017\336\357?N\366\271\353\360\313\277\2436\025n\262\203"
+	.ascii	"\350\037"
+	.text
+	.section	.gnu.lto_.symtab.92b24249a2732d7d,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"canUseLaunchControl"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"areSticksActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.string	"calculateThrottlePercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"calculateThrottlePercentAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\003"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\003"
+	.string	""
+	.string	"taskGyroSample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"gyroFilterReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"pidLoopReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"taskFiltering"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"getLastDisarmTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"throttleCorrectionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"osdLaunchControlModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"isUpright"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"compassIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"gyroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\004"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\004"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\004"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\004"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\004"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\004"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\004"
+	.string	""
+	.string	"isMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\004"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\004"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\004"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\004"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\004"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\004"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\004"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\004"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\004"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\004"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\004"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\004"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\004"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\004"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\004"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\004"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\004"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\004"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\004"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\004"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\004"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\004"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\004"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\004"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\004"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\004"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\004"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\004"
+	.string	""
+	.string	"updateRcRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\005"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\005"
+	.string	""
+	.string	"blackboxGyroCaptureSample"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\005"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\005"
+	.string	""
+	.string	"gyroFiltering"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\005"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.92b24249a2732d7d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,233 @@
+	.file	"hardfaults.c"
+	.section	.gnu.lto_.profile.1718abb9c90983c1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1718abb9c90983c1,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\223\344\350\214\003\002\002"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.1718abb9c90983c1,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.1718abb9c90983c1,"e",@progbits
+	.string	"(\265/\375 @\335\001"
+	.string	"\024\0034"
+	.string	"\001"
+	.string	""
+	.string	"\t\372\341\240\227\002m\001"
+	.string	""
+	.string	"\002\b\200\200\200\200\002e"
+	.string	""
+	.string	"\004"
+	.string	"\201\200\200\200~\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\001\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"hJ\224\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1718abb9c90983c1,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002\002\006}\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.1718abb9c90983c1,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1718abb9c90983c1,"e",@progbits
+	.string	"(\265/\375 \030\225"
+	.string	""
+	.string	"P\f"
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002"
+	.string	"-Al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.1718abb9c90983c1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_HardFault_Handler.19.1718abb9c90983c1,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"=\n"
+	.string	"\366\022E: \261\322\001\037\202\242\033\032\211\t\240\027|Hj\342\252\206G\362\b\377\027\200\212\327-V\\\333\266\021&\f\305\306\271\027E\300\200\202\3203\260\007\020)Xf\253O\266\377\226)\0053"
+	.string	"5"
+	.string	"3"
+	.string	"\246\253zG\247\\\225o\300\361\016@\3548\025\370\334\270\334 \264F\217"
+	.string	"\261\265\361\340\\.?\371^\210\341n\227Pk\365\276\304\214\233s\333!\333\005\3667\0373X\305\346l\332je\210\375i!\243b\031\263\277\336\257\317Y\240\2153\004\271Z1r4\3256[Ll\277c\225\035s\332H}\255\306\2652\326Z=)\022\265\322\331\255]:\355_\366\260\200\330B\271zH\"\223)_\031\252\301\260\026\347y\024\275\\y\027,\374\354((\277\304\024\251\375\353\323O\321\317\313\027\rY\026}J\246\210\023h\304"
+	.string	"\202\034<\321\310\223x"
+	.string	"\221<\021X\362>\003\376&\032@\317\364}\240\327\261/c\356d\314vg\017\016Am\322\247p\033o,\271\372\277\2515\023"
+	.ascii	"G\b\232Q\271@\265\035X\203:\274{(YpZ\205\205x\260\206R\033g\306"
+	.ascii	">[Zy\301\"\310\fn?K#-\242\233\272cJ\241\240"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1718abb9c90983c1,"e",@progbits
+	.string	"(\265/\375 o\225\002"
+	.string	"\202\304\020\036\2405\351\017V5s\344|\341\213\201sH\264&\354\355\377\377\037eD3~\005!{\313\024\023@\324\266\265\261!\231\200\300\266tF\265}\344\200\356\340\237X\221~.\035\374}\341ar\f\204:\242\376\225\004"
+	.ascii	"\240\206OVF\211\213\f\224\001"
+	.text
+	.section	.gnu.lto_.refs.1718abb9c90983c1,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1718abb9c90983c1,"e",@progbits
+	.string	"(\265/\375`\330\003e\035"
+	.string	"vx\310I\240\230Uc\201\030\006\2748B\353.1\362d\376E\2603\267\343\fO\367"
+	.string	"-H\033K\346\027M4~qm\355.\207\354\375\337N\376\263-\310;\\\215\002_Sz*\n\332\264\261\005\374\342xX\203uJ3|\237l\231\002\243"
+	.string	"\255"
+	.string	"\263"
+	.ascii	"W\202\245MB\341\237\264#\374\022:e\364\227F.L\206i\313\264\326"
+	.ascii	"\246\212\264M7\301\242\267\351WD\325l\321\342\217\376_1f\323"
+	.ascii	"pE\230\322u\203\\!\267"
+	.string	"(\273Q\276Cnk\233 \373\366gsn5\2148)]=W\347\345J`\372\262\316!\376\201K\323W\366\312\271\262\227}\201\330\367\307\205\342i\245G\353\215?\033\313a]\bi\224.\263W\347e\336\001M\254l\033\241\330^\362\304\366\201\033\373\256\260]e\233\312\266\224\355\243\355\3266\224\355\227\355)\266\313d2\231\264\335\301v\226\335\332\0059\306\230=\244~1J\227\355\236\317>aU\037\374\rc \322V\205\021A\016O\374\247\306R\366\217\300\252\017\262+\n;\025\242\232\006\177*\354\355\321\364\353{\322\366\247\342,q\030KY\3420m\211CX\332\256\350\277\016\257\312\376\3204H|\001K\333\337\360-\021\215\245\255\016\036AJ<iq\301\244\301#\t\227~*\f\231\262\353\257\376k4\272\212\340_Z\325\253\337\213\313\004\210D\002&\371\255\227\375O@\bdZ\037D\246N\353\357\004\314]\350"
+	.string	"e\221\277q\221(\215\245\037\031\375\005\316\376\302\037\275G\376G\377\327\250K\354\003S\227jgmy\201Bq\246\314\237$\023\260\345\213\025\245\333\304\227\n"
+	.string	"\227\022Gc\3512\326%b\333F\200\224\342P\313\223i_$\267x\221\\\251\033\365\024\031\214(X\224\371\255\024\330<\007\231\266t\335$W\311-\362\334%-4\352P8Y>\262\314\224._%\323\227\347u\223\227\347\345\213d\372\026\271F|\215\267x\215\367h\330\177\340?\343\n\204\"\226\t\031e\236\364$3\2578\315x\302\362=\332\r\036\370\313\315\017\365\377"
+	.string	"\r\026\247\035GJ\2277\230\245\375\372O\375\257\202\206\275\n\274\361\245\271Wf\343\334\326E`\333\365\333ny\371\217\002\316\315z\270\021\272\"\332\231\363\240#\032\362\365x'\357\302\007\336\351\003\340\334\214\346\353\341D\350z7\0226\"\334\215\306\271\331\251\333\351t\316\240\237s\247\013Q\203;m\247\206\"\334\351#\341\013`\003\346}\300\365h'\217\327\243\005\350\341\210n;\233\205 \n\267\236\315B\314B\272\036n\207\363`\332\201\317\002\237\237\0215\376\001b"
+	.ascii	"\304\340\345\037\240Z\r\310\247f\332\247\326:\203|\027pE\272"
+	.ascii	"\323t\255&\241\207\003\206\n\246\320\314w\022\205\260\r\335z"
+	.ascii	"\266\034Mh\210\266\323\331\212hB=\037mV \n\025\016\233\345\243"
+	.ascii	"\213\325\321u\204a\203\t\312\225*\263T9\002\226\256\252\252{"
+	.ascii	"\334Y[Y\254\244Hz*\223;\2008\242\230S\0018 `\002\0211j\035IV"
+	.ascii	"\256[\334\317\3347\227\333yc\354\220\315@K\354.P/XY\200V\325"
+	.ascii	"jL\242\340\026Q\2735F\237\212}\025[-\022\302\t\311\260\264\227"
+	.ascii	"\302\fp\331\240}\335\256\206\204\366}\\\016\331\205\003\223\001"
+	.ascii	"3\261\022\267h\346\200>M3\252}\265\r+\f4\333@\356TX\263`\007"
+	.ascii	"d\257Yzs\353\266Sr\217\322\354f^\215\013d\327\277\310\376\332"
+	.ascii	"\356\330\206\213\254\017\263\036/\353\334,@\001"
+	.text
+	.section	.gnu.lto_.symtab.1718abb9c90983c1,"e",@progbits
+	.string	"HardFault_Handler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"systemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1718abb9c90983c1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
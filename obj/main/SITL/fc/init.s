@@ -0,0 +1,1599 @@
+	.file	"init.c"
+	.section	.gnu.lto_.profile.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375 x\255\002"
+	.string	"4\004l"
+	.string	"\005"
+	.string	"\323\245\377\300\b"
+	.string	"\001\233\364\343\336\006"
+	.string	"\002\365\203\335\343\t"
+	.string	"\003\345\305\206\300\007$\002"
+	.string	"\001\002\002\003\002\004\002\003\002\005\002"
+	.string	"\002\004\006\002"
+	.string	"\002\006\002\007\002\007\002"
+	.string	"\002\002\005\352\263\360\321\b"
+	.string	"\006"
+	.ascii	"A\221\007;\b\252\374Jf\347J\336@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375 \242\275\001"
+	.string	"\240\226"
+	.string	"\004"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\002\001\003\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017"
+	.string	"@"
+	.string	"\307"
+	.string	"\210\253\2520\220\345e"
+	.ascii	"p\\R>\264\032 7\340e\007\313\242\024\001 \230\r`\001"
+	.text
+	.section	.gnu.lto_.inline.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375`\200\001]\006"
+	.string	"\002\006\025 \220)\351o\233\036}w8\321\032\007\215`\335\367\320\322\206\037vw\247\017\002zx\200\032\331R\246\027\030\236\326wT\242\n\270(DQ$\007F\233\312E\370\330\352\270;5m\362\323\032\030\377\323\262\237p.\002\360\211\336\335\005\372T\330e\322X\f\177n#2 @\002\202\030L\036\227\007F;\300\005\272\004\2122pW*\243@?\001\314\003P@p<\202+\016XK\253\016\200\253CS\235\242\033R\t\020=\320cx\233A\275\205\220\017\322\013\242\0250\256\241\002]\200\213\270\210%\\r"
+	.string	"\020\027\366W\235\305\356\301\300"
+	.string	"p\026G\f\036\r\363"
+	.ascii	"\035\311;\202\032*\340G\303\b\022\230\203C\264\352\2409(\201"
+	.ascii	"\213\353\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375`\002\002\205\t"
+	.string	"\"L'-`M\222\0160\264"
+	.string	"\3125\216\001\332\022P"
+	.string	""
+	.string	"T\025\234\217Lc\0305\305\022\031\236b\013\2003E\220P5\t*\320\306&\204\310$\003Tp\250X\024\251\324\034\271\"0\032\027\240C\026\251$,"
+	.ascii	"L\222[!6\266\265f\270\362\364\363\344\370\344z\233\346\347\001"
+	.ascii	"i\260<\034\006A;\235+\3045\221?g\360\340\217\b\316A\211\211\276"
+	.ascii	"\261B\345\355=\036X_\356/\327\271*PT\ne\212g\030\303\2568&\226"
+	.ascii	"\330\026\327\022\005\334\361\321\340\222\216\363\305\225\\M\215"
+	.ascii	"\2476\023\217lIF\250QAU36\245,s\240\002\221\253\242\007\022`"
+	.ascii	"R\312\nRf\306j*\255Y\377\016-\372pf\bX\024\246\332\266d\025\336"
+	.ascii	">\022\221\236\t2\243\203\212\374\372L\313\037\323\331\335\367"
+	.ascii	"\b\207t\2354\345\244A\003\307M\223\221\354\224F\242\374\367\365"
+	.ascii	"\001\217Z\025B8\0177\351B7\214\370\256w\037\002[\344\030\335"
+	.ascii	"\240\036z\030\257:\324\313\030\344\020w\337\244\304\250\351<"
+	.ascii	"\205I\337c\246\013\351PP\216\355@.\260\023?E\267\022\353.tp\006"
+	.text
+	.section	.gnu.lto_.pureconst.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\001\200\004\002\200\004\003\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375 #}"
+	.string	""
+	.string	"0\027"
+	.string	"\002"
+	.ascii	"\002\001\003@\00207(\033\b"
+	.text
+	.section	.gnu.lto_.lto.d8622fd0e7d55661,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.171.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375 \273\355\004"
+	.string	"\222\210 )\200k:@\344d\0222\005)\240\266V\005\001\333\265"
+	.string	"\370\277\275\331\241a\017\377H&\261\302\212\250\036\017\260\341[$wJ\001\236\244+RQ'\205R\021\261\320\311r\250Dp\305HXzU\225\245Q\267O\256\360H\210\335e0)\366\001\233\234\r\033\231\317\243\233]I\b\264\234\200\346b\373\2211\273\363\316\262\367>\021\357\333]\315\312\261C\314?\346\003m\313\016\005\207\3355\324\266\311\2357\330\216\001\t"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K7fk\273N\013"
+	.text
+	.section	.gnu.lto_requiresSpiLeadingEdge.172.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375 \361\305\006"
+	.string	"\002M06@o\222\016X\032\357\005\2358\346\350\312]DJ\003\306\023f\023\260\234\214`\177S~\260*Z\340\026\232hQ\024\r_w\230\031V\336\204f\312\314X\023K\210L\001\025eMT\016\323T\347cy\254H=D\217\325"
+	.string	"\021)L\"v6_\021\025\026?\327\205E\315\226\325&N\305\263\370\r\344^\3077\223\231\371\343x\227\221J-\013/\231\241\030\230$A\025\220?{\315\357\334W\244#YI(\026\310\334@I\311L\204\013\002\n9\335L\205\231\016L\205\377\t\n\331Z7\217PG\037\027&\245\314-\276Q\265:\355\266\244\004!.+,'\"P\035"
+	.string	"Cf\3560D\031\375\3657\370\017~\215\007"
+	.ascii	"2\003\202\341\243\302b\025\020]\363O\035\302\274\256I\006"
+	.text
+	.section	.gnu.lto_swdPinsInit.174.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375`-\001%\f"
+	.string	"\026VP@0O\233\016D\020\0053\271\234\005,B\f\236\271\262\0221\307V\342P#\230\324p\304\206\274&b\306a\352\027*\304:\315\376\271<\035\262\305\001/\203\225\315\177\n\360;\374\261\315\254\365&R\246\024;"
+	.string	"@"
+	.string	"<"
+	.string	"\273{)\206k\237\242\244\251\371Tfw\357}\302u\237O\027\036\267\b)Y\270J\004F!.(\035H\262ph\340\356='t\033\231Tfw\235\\G\341\246n{c{\200\375\216\231\351S*(V\024(\261\313\021\003\306\206\361\304\206\213~\373\367\\\371\037\016\242]\364\340\273uL6\022*F\273\337\345\321\002$\217\376n\231\036%\257L\217\326\354\026\377>\226\312\220B\302\210\027\001\240\207p\373\307\310\310\204j\310\234\351\212 \004\013P\216X\222\224\332\f2\362\334\325\002;\304\274\334n\340 \317Q\032"
+	.string	"\344\020\202\364c\177\237\324\220}iw\327\352aW\027\335T\246\003\031\226\326`4\260\016vi\024\\\035\354"
+	.string	"\347\322x2.\214\305\331\202\004\236K#\313<W\365\355\245U\017\003\"!\004\335\230.\342UH\324\020\210g\225j\201^\245"
+	.string	"*\200H\226\3109\023\266\311s\266\002\033"
+	.string	"3\2411)\360\200o\301\276r(\004\306\245\203\034"
+	.ascii	"\017\330\027\020\032\020\255\203dMED!H\325\340\227\310\347\204"
+	.ascii	"\231\001\316\213\271\f(J\220\257.\013\330b\\\326\2408\220\005"
+	.ascii	"0cJ\241\240"
+	.text
+	.section	.gnu.lto_init.175.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375`\237\016\375F"
+	.ascii	"\032u0\032@0\346Q\007\270p*\262Q\\&Q\265\204\230<\251\221\327"
+	.ascii	"\213\351\222\273\3563\346\202t\207\335\233\264\357\357\320\242"
+	.ascii	"\202\322YG\310;<-\237b\252S\312\275\231\2337\013.\300,\331{\357"
+	.ascii	"-eJ\001\205\001w\001\227\001\355\253\235}\265\257\257\366\355"
+	.ascii	"j\327Z\373si5\211\234gY\024\355\274\250\274\244o\222<\263t\274"
+	.ascii	"\274\233\177\350\177\364\267\373\273\277\361\240?\335\267\211"
+	.ascii	"\337\215\337\031&\243\362\230+\235\2233\274\317\016\327g\363"
+	.ascii	"r\356A\367\032\223S\306\275\334\203\317\272\217O\343o'\306y\006"
+	.ascii	"\344\3238\320\214R\031\027\362i|\353\375Qs\276\261\217\346\343"
+	.ascii	"<8\241B\374Q\"\303cT^2a\321\214\365>\353\377\366p\361C\215\303"
+	.ascii	"\257\250\314t\245\315\2717\252,G\035<\353\b\336g\237^\330>\253"
+	.ascii	"_\252}\326c\367E\037U\223\237.Q\330\032\252,\313Y\033\213\003"
+	.ascii	"\177\215\276?\351\370\253\250\204SRQPONMLKA\340\357u[v\335:\366"
+	.ascii	"w;\034P\203#\315k3v\374*/O\265RPR\317\036\217\351e]\212\024&"
+	.ascii	"\250\213\026\256\375\324\032\027-\265\345\243\266h\321P+[\250"
+	.ascii	"\216\334\3431\263\254\031\240pq\3737R\364\323\0252\265wr;\274"
+	.ascii	"y\266\312\334\334[5\215L\355\233\234\317\204\307t\242\351\245"
+	.ascii	"\263\017\256\r\246u\220\036\f\363l\025.\351\262\304c\232i`\224"
+	.ascii	"\377\255\r\234vM\036\217\031e\025\002\252\222\350\343\376\n\f"
+	.ascii	"\263\251\337\2534\262\262w\361\230ebca\272}\362,\230R\257\311"
+	.ascii	"\2461\245\336\3011\344:\224e\371\343^+\031Sj\355v\220e\331\365"
+	.ascii	"r\214\354\035\300\273\377\032w\207\342\316t!1Z\353n\367XJLe\250"
+	.ascii	"\334Go\267\273!\204U\302\322\036\375\370\331\272\307X\342,\372"
+	.ascii	"\227\355\236\002c\373R\235&\343-l\314\346\352\224=\264F\311\313"
+	.ascii	"\027\212\331^YNZ\360"
+	.string	"'\364yq\230\022\355\263\354\346\360&\310\t\007]\267\240_6\372\267j\367^\367\2075A\352>\367\237\037P\334\346\317\305c2\261\233\376e\354\326>\2737\0032T'\\\331\227\356k\017h\007\357\036\303\305h\226\372\360\315\311\005vsz\354~\272\203\327{_1\240\331\367>\355\247y;\017\257,\203\375\362\303\013\246A\001\237\020z~\217\b\177.\317\372\210\022\254\373\256\2505\201B\377R\357\3373\005l\037=X\207E\311\272\237v\376\367\233Q\361\333\307\024\344>~UZ\234\263\275\237N\244\225\260\001\220A$=\224\324\221X\350>\177\246\264\273\213\027\372\227\022\366\303\335E\253\323\030\003\354\3142\376N\246NgD\322\222r43i\367\033D\375K\027\242M\253S\344>\272G\221z?\335\037k\315Y\031\337V\334\213\033\036\372\256\341\243\357\022\336\315\373\325\360\241\357\006^\355\005^\355V\257v\002Z\373"
+	.string	"\255]\200\326\036"
+	.ascii	"\250\035\200\253\275\352\325N\345j\027\276\332\247^\355R\257"
+	.ascii	"\366(\255\035\352\325\376\364jwr\2657\271\332\231^\355K\257\366"
+	.ascii	"\240\326\016\374i\377\275\332_W\273\253\265\007\360\232\3535"
+	.ascii	"\335%\007\354\005fck\237\005\260\007\b\332S\026\246R\025\325"
+	.ascii	"\256\312\242F\345\307\rn+6\252\241\205\333\035v\203\317Lm!\f"
+	.ascii	"\247\255\3504]\005F\023\007K\245\355\263S\373\317\314\362\270"
+	.ascii	"I\351)\372\255\332\250-\245\321\242v\n\263;\325\262\245\030\372"
+	.ascii	"\037\226\243\203\335\314-\252s\241\365\373\235\366\037\226\323"
+	.ascii	"\272\303up\235&6{su\252\334\3075=#\301\375\374q\t\343\f\223\363"
+	.ascii	"\3637\266\276\276\006\366p\213AM\335\201\332L`z\323\025\372\327"
+	.ascii	"\350&\360\035K\367D.\337"
+	.string	"d\371\213L3\201\367\364\201\357\356\332?0\240\270\007\2417\207\372rp \242\334\257\350\233\253\323'\255d}\253\326i?i1\247\235\242\211\247ZVB3\355\246\355\372\b\234\027A\033\201\371\0346\004#\032\356\246\375K\233I\204v\207\031\301z\372\227K\273\235Ch\317\214\334G\340~:\0312\243\366\333V\\\310&\f\324\335\260\235\300\3028[\r\333\300\026[?fk\203\233\206\324PRG\332\323\310\230\315\312\341G\372\013\346\253R\343\323\307\340\376\321\214S\205\276p\365\373bd\002J_\t\226\004S\202\373\340\276\366\331\r\273E\023\216\013\3344\260\364P\006\356\237#\3246'\367\361\370\325\030\251\240\020\337SceX|\344H\373\254\206\255\241\371\246\n\375\322}bD\033\316\031\203\376-\211\307\222\373\350\357\3761\371=\275o\024;\211\241\304\315f\373\354\273\2034\345\334\240\023t\374\001\216\003+\b\027\215"
+	.string	"\216\003\213\213X$\362\310\272\301\203\312q`\365(n\355(\336 \352\230Q\243k\006\027\215,\257..\257\342\226\027\002'\261B\204\n\226\370^^[ZZ>T\324\230\261\325\025\334\362\322\341\343\304\226\216\032\304\237ka\365 \026\211YZ6\262\212\304\031;\262\264\272\274\262\260\204\316\305c\253+\253\007\027WWV0\372\365\333\212\377\322\310\314_\033\351\005t!\371\255Z\253]`\220\325N\241\006\307-\356\213\364l\r\261L\216H\026\323\301\3124\346\034C\257\262\3337\207:M\272\261\203\303G\016\235\272!f\346:u\246\334A3S\363\270d\346P\247\317\304\330\307x\267"
+	.ascii	"\022\337\\\365\207\bI\357\327\346\247J\265\237\316\022\320tt"
+	.ascii	"\035\201\r\003-O\025j\004D\324rm_\252S\2440\320\036\333\324\200"
+	.ascii	"w\300v\233S\3524)5\210\330\350\321\214\214\022\360\002\366\317"
+	.ascii	"5\332\233\223yvFC]z\214\210\200rN\246T\247P\373\351\356!\247"
+	.ascii	"\342\336\207\232\034\374\325\026\273\332\017\375U\226e\371"
+	.string	"\351\301_\355\342.r\246F\232\307\306\371G\364\20472j\335\215z\306\2757\377H\344\230D\367\2563\023\210\316i?\225\372\325\3504FI,\235\024i\245\250\2163\362\031\253FIFIFJ\306>G1\022VR\232\213\350\227\35278\t+\305\nR\216\031}\006>\"\006'I\322.\201\307\354\3140\023\342\002FpM>\264\35310\2246\270\t\233\301hR`*\214\334\346$\323~z\200*\001\366\3171j{\202\301\302\365%\207\006\260%\2018\250a,G\225RJDDD4I\n\031\016\201\005\304(\005\031\236\007\021\3604\312\230\252\231$\225\345\232\337\024\351I\203\253\253\244\245\005*\236\\\226P\251Y}\364\221U\033\330t\277\360C\3013\312T\351R\314\334\357\321\326KWy\216\037\224'\336<\177\233\253\357\n_\324\034RD82tB}tp\345\362E\251d\226\321\301^w!w\217\006"
+	.ascii	"]\fj\013\246]\305\270,' \253\354\373\032J.\224\234}\203\006\355"
+	.ascii	"\354Zg^\231\235\006[\204\276[{#f\207]xn\2271\245\017\013\001"
+	.ascii	"r1\332\263-\306N~t\215\252M\354\027\375\365\201\215\375TD\353"
+	.ascii	"\303\307\306\b\230\312zPtxTD (5\357\3205\006\260)\367\020\303"
+	.ascii	"4\331\244M?\241\202\257\236\243\025\275 \306\020I\356\033\034"
+	.ascii	"\016\\\016\347;v\322\363\305\214\365\365{j\324.\227u\201\277"
+	.ascii	"\232\311\017\364\276EM1vpE\357\243v\"r\242a\356\360\251\003\367"
+	.ascii	"6\006\025\303zW\252{h\230!\210He\2359\260\035\221 \ng\005\274"
+	.ascii	"\353\322\320@h\003S^\3508\027\210\\?\253`"
+	.string	"(\024\272\030\342-\355\336}#'\237\341\367,\225\\\033=\205\345\340\006U\216\273\323r)\007\220\233\270\357a\201\303\266\330PI\214\3526\227\326_\221J\255\024\364\210\"\324Vo\351y\305\270\006\313]\363\204\341\337\250\344\006\324-\304\r\2070\225E\314y\243\225\356\207\210\376D\334\201\032\0315\212?W<O\352\355\270\370\032+rp\377\356F\236\005\305t\272L"
+	.string	"cI: \347\367\242\224E'\002^F\312\366\bT\221\001(\3366\315K\226\324\233\227\326V8\025 \267H\227L\262\332\275\001\316\330]\023\342\261\200\310qM\251\305is\241\260t\321\242\313\275\017\224F{\275\201P\264q\023\026\244A\"\"a\024\277\363\217\b\223\024\002\252\256\326\251\004\250^\024W\350\253\006\207I\220\322%\f\004L\021\025G)\233\250\347\376\032GO\241@(\231\024vI\364+\3278Sa\270\271\343\366\365,\260"
+	.ascii	"\370\340\022\353\277\214\205\032!\331h\322\331\376$\375v\272"
+	.ascii	"\213\261JaQ\3416#\177"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375`\250\b=\026"
+	.string	"6)\213@\200\032k\r0<\361\217F\321\237\314%\204\270`\025[\"\222J\302\\\355\226S\252\377X\250xw\304\027\266\313=\016:U\007\246\222\310%r\376\023RB\013-\264\210\215\341\327B\\\n#\351'\031\201"
+	.string	"y"
+	.string	"v"
+	.string	"\205r\365\376Y\275Q\252^@\252W\312\324;E\352\245\022\365V\201z\357\236\336@\247\367lz\2550\275W\226\336A\2457L\213m\305q$\226Iz\305t@\301\340\364KN\275 u\357\250]x\312\305\250Yz\252\245\250\202D\225+I7T\0304\3438\242\360)\026\032\250;78\241\267\006\361\2251\303\326&\027\364\306\020\026\331\330\332\342\306\361\343\310\327V"
+	.string	"\305b\261\b\364\322\230\031\307\261\246\f\257\r\023\357\215\022/\016\022o\216\021\257\016\021\357[\210w\007\210\227\307\207\027\316\303\033\327\341\355\301\341\375\261\341\005\242\341\r\222\341\235\303\360\322]x\267Xx\353*\274v\024^s\302\233'\341\305\213\360\352Ax\205<x\2078x\2114x\213\210\275|\f^#\013\336>\005\257_\202\367H\330\213\004\354M\362\365*\361z\227t\275L\270^\037[o\023\255\327I\326\373\004\353\001\016\372\261\262\177\312*{x\016\355\241Y\234\031\203+\256\354!\211e\367\234Yv\217\226\275cn\331:'\227\215scv\3317\245\227mc~\3316d\221-"
+	.ascii	"\314\016PV\351Oo0\314\026\236\265\361s\301b\234\263\205e\207"
+	.ascii	"-\370\334F:\273g\235]\323\316ni\332%\357\354\024x\266X\236m4"
+	.ascii	"\352\331\302\232-K\266/\310\b\366\021\030-\2263\332Hg\364\211"
+	.ascii	"\243\212\035{\215\307^\253\033\355\265\002\366Z\217\2556\264"
+	.ascii	"\325\f\330j\007l5\037;\355\374\261\323L\004vZ\td\247\221A6\032"
+	.ascii	"\321F3[\363\0068F\310>;\207\3543\223\310>#O#\333\2544#\217\354"
+	.ascii	"\262\023\311.3\223l2\263\366\223\013\334S\262\311\312%\233\214"
+	.ascii	"d\262\307\316&{\314t\262\307\312'\233xB\331D3\312&\226R6\221"
+	.ascii	"\234\262\203\250\034\200\207\250!\b\203\221b\005E\225l\034\200"
+	.ascii	"\203\246i\r\0210PJ\210!B\"\036\021\310\007\317\032N\257\302\312"
+	.ascii	"!\217\263\023\271\342\362\263\214nC\373\245=9\b\217)\214t\251"
+	.ascii	"A><|v\251}w\032\344\335\347\346\302:\217\"I\033\233\347O\304"
+	.ascii	"\360^\321\360M\030\022\262a\020\b\004aQ\203\340\344\263\003J"
+	.ascii	"\201* \th\002\026\001IDR\240\b\250\002\232(\336\"drR \257\225"
+	.ascii	"j\b\314Q\231C'\017qeD\350\003\024m\n\360\254\035\206\001J\200"
+	.ascii	"\363\325\252\001"
+	.text
+	.section	.gnu.lto_.refs.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375 m\315\002"
+	.string	"\322F\025 \220+\255\001o\267\2431333\243\330\335a{\340\273&\204W\035m\333\272\366G\276\210\225;\005\377\\\332s\357D\347\034\354\215\301\326\024,\206\360emYW.\245\334\223\201\225\\\032\271!\312>\324\016\301\r\365\"Z\021H\023\320\210K\r\367\202\f\300x&"
+	.text
+	.section	.gnu.lto_.decls.d8622fd0e7d55661,"e",@progbits
+	.string	"(\265/\375`\323OER\001J5:|V \fi7\215\001\316\321\350,I\232e\317\262\243$\351\366\215&\031d,\031\312\027\327\225\276\0275\022\325\236\201\350\025\333C\233\345m\213\342\032\310v\353\256.@v\033<\233\313\205=\037&u\374\314\306^\2529t\226\227H\330H\005\t\"#\260\006Rw\223R\312\024\324\006\300\007Q\b;+\372E{D~G\246\277\333\241\277\323\322\337I\351\017\345\321\037*\243?\204\246?\364\202\376P\r\375\241\026\372By\364\205\314\350\013Y\321\027J\242\217\305\036\221\027\312\241/d\245\0374\247\037tF?H\212~\020\231~\020\r\375\240\024\372@s\364\201\306\350\1779\376\346\371\357\035+\306\236\251@h<\271\371\246"
+	.ascii	"\361{\304\322%E\334\315\007\362\2421\025\3752\366\210<P\231>"
+	.ascii	"P\017}\343\\9\326\230t\335\210\354\031\250\0275n>\020\230N\301"
+	.ascii	"\266I\344\347l\022y *\375\237:\372?m\364\177\331\374\266\371"
+	.ascii	"o\333\375\"\304#+\006\231\233m\022\020\277l\210\330\256\274\211"
+	.ascii	"\335\374\2375\375\223E\377'\211\276\233=\"\377CD\377\007\207"
+	.ascii	"\376O\f\375\037\242\276\226\243\257\313\350\353+\372Z\211\276"
+	.ascii	"\366\241\257eh\273\355\021y4/[~\240\272\220\350\271\371!\260"
+	.ascii	"\350\330\341\266\266\345Z\201\322\303\355J\033\017-7\355r\271"
+	.ascii	"]\254\361n\271Y~\267\334*\3049\bx+\316\301\035uSZ\330/\200\362"
+	.ascii	"}\346\350\373\220\321\3671\323\367\371\322'\347\364\177\251\234"
+	.ascii	"\301qC$\336\374\020Mz0\371a\245\354\266\300E,Z\305\231\230\333"
+	.ascii	"Erv\223\3408\242\204l\311m\261{*\332QR@\306\320.\224\373\344"
+	.ascii	"F\271R\256\331\235b\215\367\354:\3715Z\264\337\265\263[T\241"
+	.ascii	"\210\007\213l\357\242\217Y\234\026Y\212\362\316\036\221'\263"
+	.ascii	"\350\223N\364I!\372d\230>\211\245ON\351\353\364\350\353\334\350"
+	.ascii	"\2279R$\b\213\2329k7\337\252\271\270-v\272\275\273\216JT\300"
+	.ascii	"\335\250\337\226\025\271Rz^\270F.\221Kv\205\334!\326x\213\\ "
+	.ascii	"\277c7\310oq\357(+Ty\334\366.\336\"\327\352\212\3312aYL\0347"
+	.ascii	"[V\344\276\270-l\2310\t(\221\343\266w\321\203\207\237-XDt\354"
+	.ascii	"\262-c\221\310\013\354\021y\335\030\375#iG\207J\327\223\233\257"
+	.ascii	"\243\242\257\330\250\325\020\023c\315\330\327\305\2724vxo02c"
+	.ascii	"bl\204\341R\373\322\302\030[\346\302\375\272[kn\027\307\365q"
+	.ascii	"y\334\035\027\354\346\270=n\330\325q\275\254\361~\335\256_\030"
+	.ascii	"\267\3527\304\017\342\367\353\336\270-vO\305]\3453\245\312\215"
+	.ascii	"\332q\357\242\207$\017&\020Q\203GC\276\216K_\347B_\267\365\263"
+	.ascii	"\034\375<F?[\321\317E\375,\246/\r-"
+	.string	"\021\354\rZ+\212J\306\315wF\2261\006\207\330\315\3179\364\315\002\361+#\203*iYn\366\261G\344\363\r\375<\245\217\217\372\330\216\266U\026\211\3040F\037g\321\307g\372N\335\025\326\370\301e\361\233\302\256]\367T\334\305\275\213D\267\207\\\024\343\315\307J\364\355\007$\236\233\263\037\220\307A\364\265G\344\261\227>\026\213D\376\027\352\003\035\265e\212\222\233\377\373t\211\244\r7s\254n\376o\347\356\266{\254\2345^\242\325s\033g\325\314\326\354\330\263\035\261hC\261\365\250c\317pq\314\007\312\227\017\267\020\336\354qG,n\030\344\027\217-\256c\210K\264p\033\263\355\330\342\"\333\273\230\344\301\203\007\017\032I\214\024Z\200r\266G\344o\036\375+G\333\343\265xl\236\333\243\275s\020B\270P\224=\346\275\237\254\335`g\355\006\272\264\037OF2\377\262\321\277i\372w\211\376\025\323\277\245c\345"
+	.string	"\241\311\3119r\363C\230ic\305\313\361\267mv\215ec\333\3304\326\315\302\261q\354\033\353\306\252\261s\254\321\312\261gn\331,\232\333\342\255Z\2308_\300\310\0213\006\316\032\2317R\246\300\241E\321c\237\374 \240\304\205\370m\031\023{\266\303{s\311\215\355]|\b?\210\037\204\020\254\034[\306\236\3312Z\017@\342\306m\357\342-\225\037\204\034{\305v\271"
+	.string	"j\357\247\255\f\300\322\256l\034\367\336\036<$y \313x\3748Z\220\355\224E\"\215\354\021y\213G\337\266\351\3334}+E\027!\321I`Z\003\213D\336\312\320\035,\022\371\024\350\337f\271\355\362\333*\326\212M\023\301\336Q{\357\r\344T\224\027\221\233\355\026\313\3456\315j\3316\r\001]{?\3314\242\270\275\237\210\254\335\300\332\r2\222/ R\310|\026\264\305\002\3426\313\021Y\245U\334h{o\"\274\306*K\326\315:{D~\004\372"
+	.string	"\026\211$\355\021\271"
+	.string	"\213D\276\247\277\306\"\221\027\241\357f\221\3107@\377h\221H[\264M\254\021\003kv\020B8&:\331J\366.\022\r\3559\262G\317\315\007A\337:\271\006\257\035\3023\350[\fH;g1 \177u\221]\362\333$V\t\006x\212\252k\243\355]4\"*\312p\001v\363\213\026\211\324\366\210\374/\217\023\0049\262\244\311\023\2345\205\313\2271\377\345\200\261\376\213\346\277\037p\f|\365\3371l\365_8\377\205"
+	.string	"\256\3020\356\374\370\005v\021\207u\230J\007\265\370\255\n\377\315\302,\376K\344\277\034\340\025?\306\360\337\017L\001\340\277?\254\"\005\207\037KE\375x"
+	.string	"P\277\345\360[\020\354\322\177\255\360\323o\023\360c\342\177W"
+	.ascii	"a\377\217\373\257\013\234\202\037+\340\277*\n\376\233\345\277"
+	.ascii	"\036\340\023\374\270\001o\363c\023\374w\375o\206K\360c\b\260"
+	.ascii	"\360\343\024~\214\"\304\211\037s\340\3461\361c\020\224\327\004"
+	.ascii	"%\376\233\341\307J\377/\370\237\302\217\207?\026\3768\370c'\013"
+	.ascii	"\364\256_\027\364\337\033\370\367\205\233\376\253\0033\3757\351"
+	.ascii	"\2776>\364g=\377\r\300\361\374\307\277\316\347\366\317s?6\177"
+	.ascii	"\334\373q\371c\336\217A\360\343\017\374\330\003?\346\300\217"
+	.ascii	"U\370q\004~\334\200\037/\340\307!~\\\200\037{\370\361\007?\316"
+	.ascii	"\340\307\027\374\030\351\307G?\336\375X\350\307\372\307\344\177"
+	.ascii	"\367\3747\356\277p\377"
+	.string	"\305\363_\267\377\306\371o\333\177\323\374w\355\277j\377\375\362\337.\377\345\362_-\377\255\362\337)\377\215\362_(\3775\376\267\311\177\231\374w\311\177\223\374\367\310\177\215\374\267\310\177\203\374W\354\277>\376\313\343\277a\377\005\373o\327\177\265\376+\343\277W\377}\361_\026\377\235\372\257\324\177\241\376\233\202\377\236\340\277'\376\013\302\177M\374w\370_\365\277\351\177\321\377\002\377{\376\367\003\377\355\300\1779\360_\025\376\033\201\377\206\370\357\001\376\313\341\277\036\374\227\203\377\006\340\277\026\374\027\351\267\033\370\255\005~\273\200\337\336\337\332\377s\376+\371/\202\377a\376\353\346\346\346\346\376\034\3743\024\177\005\304\bV>?\252tq\273\371\026\324\320\267 \205\376uT:*\335\013\353d[\005\031\201lq\331\253\343\0234:\027\272233@n~\005G\375\n\322\350_\307\202\205=\263N6\f \0251\304^8\356\375\205"
+	.ascii	"YN\216\232\0357\277\202&\372\272\024V7e\324M\331\263\244M\234"
+	.ascii	"\343\001\231\252/\004\020R\323\245H\331\315\257\240\210\276\265"
+	.ascii	"g\244\224T\226\253\300\206Q\253\303\317\2238[\316\214\351\210"
+	.ascii	":\242\016*\303\333\226[g\006\235\026n\376uO\327A"
+	.ascii	"\331\243=b\224R\343\346\277\345\256\377?>\307\024Al\320\230\233"
+	.ascii	"\313rz\357M,n\030Id\276jt\260u\274\2668\271\371\025\254"
+	.string	"\320\317pY\317s\2341\307e9\255M\234\023B\013P:\272\034\267VU\207\377o\326\230\345\036Gh_\240;CDL\312\315Oj\323\277\375\375\311\375T\265\367\276\322\025w\025\224\020\371\333[\235\265\035\376!\213-\007\3773\376\311\333;E\025\262\275\267\265\243\207\\yjA\203\375\377\035\366&\332\275w\325\224\231\027\321h\312\354iO\235\225\2612\2322\363\262\232*n\0276l3\260=U\354\"\346.\342\336\233xwqGyY\355\250.bp\252\270\253v\261\213X\264\243\254\212\246\212O\304)3/+;e\326e5e\326ee\264\2436qG=\271\240\243\272\254\246\304tY\025M\231=YMEyY\331b\327\266f\266\024\275\210)\266\331\323\320\336\233\2528F\024\332\373\251j\023\317\\\027\333\313\315\305\346\332\266\314\221\"X\322\336\233\210\266\346\253\353\247\b\265\313L\021\351\372\245\330{\315v\201"
+	.string	"\242%\026\367\336*6\024\321\356\235\242X\2657T\227\b\264\366\336\273\313\242QQ\265\207v\324\023\025\324W\227P\n\250.\025\233\210\013v\357\275\255\246\314\276\272@dyb6\266\241\212D;E\325\265\307\366\032\257*mF,\332:Cf=\264\250n\316y~\213\305Z\031s\226\003\317\2551\343\311o\326\311&\006\261M]q9\356\255E"
+	.string	"\037.[\2163n~\222\023\375\347;\371\355\bU\230+7g;\371Jm\rlH\246c\315\240\354\320s\363\223j\3509\017\302\201\005\355\351f+\305\250\007-\316\2551\307\311o\256\223M\f\272R\306\215\3321\310F\326\f\0257?i\005\2347\370\r\333\02157g7wM\232\232\227\233\277A\217\376\363\230[c\036\223\331T@\357(:R\240\3008\221r\363\032\242:SS\326\334\374\rmt\232\214&\253\261\306\334\226\317d3K\224\260\3452\273\237\275\275\230\264\345\265\\f\027uf\317\226\007}\304\316\230&:\177\003\022\375\r;\3647\330\320O\313dvx!\356\270\371\033\262\3647L\351k\240\243\226\303"
+	.ascii	"Ii\303*\273\371\032\320\250\025\265\232\017-./\267\306\354%\247"
+	.ascii	"\211\260{O9c!\344\244M\036)7_C\226.iKnE)7s\t\"6\301\361\345\346"
+	.ascii	"k0\352[\264\342\327\236|%o\311Y2\026k\314Z2\225\333\262\\\345"
+	.ascii	"\"\321\222\233\310e-\327*O\301E,\0260\306\271=\311Z\262\025&"
+	.ascii	"t\352\354v\304\365\240\002\312\327\260B\333m\221\310#\351\321"
+	.ascii	"R\354[\217 {n>R\033\375\020+\334\3242\224\213ui\340\342\330\217"
+	.string	"\212\257\026n{\357\377\031-?\311Q\2541C\311g\317N.\022\020\031J6\356'\342\002\202x\305\021r\334\273Xe#\315\232\316G\"\323G\322\241\217\264\245\205\354\021y$\025\372\031\336\364\237\213\030s\221\\\226\2447\232\0304\235U\025\252\250\233\227\240\3412Sbv\033\222\234\304\032\263\222Lv[\334\033\355\205ld\207\367\366R2\246$\037\321\242\006\213\007\362M\0353Pd~\206(\372\031\222h#W\013\210\215M\224-7?C\021\375\f^\372\317D\206\220q\"7\347\346,\344\3421\003\343\252\370\223EO\221\2540c\016\313cIz\233\321a\342\266\267\026\001r\036\261,;n\006\222\364\323\206\346\344\305\315\317`\245\377\347\037\326\230\305\362\216,\226yd\037;bq[\371\350p\302d\355\270\367N\3620\224\247jg\311\371\317=\236}\334\236\211`o\030\212\303\245\370\343\346{\007\304s\217\007\364"
+	.ascii	"Cr\363\217\334\350\037\251\351\037\231\345\330>\034P\270$\351"
+	.ascii	"\220\301~\242\212E\263\275\213D\031\264\214\274\270\371GB\264"
+	.ascii	"\013\331K\263\345\301\021\306\206\013\273/<\212a7\347"
+	.string	"\032\331\2065\346\033\231k\017\221]\316\242\324\334\374\243\030\372\304\336{\333\247\221>O#\363\026\220\230\251 b7\377\bJ\347\031Y\313\0323\215g']\333l\357\342\020~\2221\346\312\315\267\035H\242\271\271\2719\333\201\374\263\214\234\365\246\212U\334\315\177\316\302a|\274\324\310\023\344f,.\037na\030\b\2130<\266\342\202\271c\332\264.\232\253f\016\f\231\027fz\314\264\030Cs\323\350\230\272\221\303F\030\366\341\"\354\007\025\215#ngX\\4\227N\036,-$nor\306\320\334:\307k\347\352\201#\345\202\212\033\016.0lm+\260\262\226\334\360\332\341\206\2450\213+c\327\316\215{3\026\326\343\305\230\032\f)cv0\021\007\2310\261\026h\340\3349RpnR8E\030\252*v\236\326\224\204\331\372\nsS\24166\005\346\302\375X\n\257\370\"\246\214\0137\020a\360\020\334\004\027\261\230"
+	.ascii	"5\347vCG\r\267\033.\360p\263k0\306\256\230\214\205a\0368\264"
+	.ascii	"l\374x1\305\n\336k.\032\034\346\256\271mpq\214\002grnX\312\n"
+	.ascii	"\355\242\271n\342\304\320\270v\240\306\270];8\314\305s\363\354"
+	.ascii	"\210E{\343\2103\206\245p\2144eT\346\330\340+\230\016.\223\255"
+	.ascii	"0\233\f\003\303\311.\262\n<\227\251r\025f\303fp\027|'\247\310"
+	.ascii	"P9\n\257\345'\254\007\247a+X\fF\203\217\270\016&\203\267\340"
+	.ascii	"7\354\206\345\34088\016G\301v2\021\247\301y\260\027|\006\257"
+	.ascii	"\301c\360\036,\005\177\311Ry\nS\301Y0\026\254&ca5\334\006\313"
+	.ascii	"\3419XK\336\271\005v\203\271\3406\f\227Y\344\025\030O\216\221"
+	.ascii	"\257\360\033\f\006W\311/\360\024k\304a\360\223c(\030\355FW\017"
+	.ascii	"\020N\240\344\3060\326\214$nX\252*M\224\213\346\276\321c\347"
+	.ascii	"\312\271\301a;h\\;Qb\306n\200\335p\373\322\002\2201\214\205k"
+	.ascii	"\244\021\003\243\326\302\330\265\023\346\356\301\321\306\030"
+	.ascii	"ge\213\354\f\316\rc\3410X\206\0227,\205\303\340\026V\334\366"
+	.ascii	".\3320y\276\230X\255\254\261X$\322\262\270\243\217\241M\037C"
+	.ascii	"\027}\fP\3641\020\321?&r\334\344\307A\260\020\\\264]?X`\264X"
+	.ascii	"\271\231\t\336\303\302\312\222\233\217\341\207\376\217\225\340"
+	.ascii	"$x\tFb\215\270\f\223\205\360\302\227\230\032.\303G\214dE\200"
+	.ascii	"\214\3412l\344\307\230n\207\026\0356\240|\f=\3641\200\351c\360"
+	.ascii	"\322\307\320\245\217\201K\3338\020\307D2\330\035\030Bn>\206-"
+	.ascii	"m\335,\022\231\201=\"\217aJ\337\310M\337\b\215\276Q\232\276\221"
+	.ascii	"\231\276\021\021}\243.}#\025Z\003{D\276\b\217~Q\031\375\242)"
+	.ascii	"\372EG\364\213x\350\027\321\320/\232\322'\222\243\017`\217\310"
+	.ascii	"\023\241\321'\372\242Od\324'\002\242ODC\237h\205\376n\217\376"
+	.ascii	"\356\215\376n\214~kC\305=G\334`\215\221rbjH\305HS\007L\310\231"
+	.ascii	"\317U\020 9\261\265\243U\231\316\013\215\037gUq|\204\314\221"
+	.ascii	"\001\005#\203\311S\\\344H\361B\207\207H\211\23487.\310\024\227"
+	.ascii	"\313\016\334\221\212\244:\252\245Y\321B'\003\307\b\033\362\204"
+	.ascii	"E\221\024R\354\254\210\0214\343\230\205\315TfC\002Y\222u\306"
+	.ascii	"GE\r\034WY\322\370\244\310n@v\226\b\001\363\221\322\261\243j"
+	.ascii	"\223\005\303'\212\344!V\324\"\345\003\245\273*\0361\353qs\261"
+	.ascii	"\270w\221(\b\013W\024,\037\342\220\037-/"
+	.string	"d=|\366\213\335\024\263.Os$\231\215\221cF\325\036\235\2265]8\250n.\n\301\200\321\243+\316\236]\2661TPz\3102\242Me#\n.\347i{\"&J\0362\255+\356\312\310\021n\004:T8n\2765\222x\262\\\024\032a_7\223o\344[\025\002\346\006\300\203\016\035\262\016f\343\265g\213\254\016\271%\324\203\206\0352-\310\221C\272\321\341\240\215\016\22357\035\233}s\306K\330\315\037"
+	.string	"\025\331\206lC\302\261UU\016X\361\244\006\313qkau\200C\276Q\261\343l\016I\352;a\356\314Y\202\207\354\310\332\315\037\300\326?\311\246K\310\005\020\025R\344\032\2609-\027w\332taC^sO\332\334L\246!\323\004]\344\200\373Q\261F\311\325\315\357@\205d#\331\276\312\270tB\274<5\271\371\035\232\220fH3Y.\0031\214\214\265\031\371!v\363;\020!C\306\305\025\0272\314#\n\\\222\233\337a\0079\206\034c\334r#\022\243\312\214\233\337\201\212\fC\206\321\301\331/\030W\\\216\273$hIT\334\374\016D\022\f\t&i\215jn\353\250\347\210a!\347\346\177\200\205\364Bz\321\301e8R\351Ar\\2\206G\313\315\377@\253x\362I\221L#\242b\367\326\332PQ\233\253\206\317\034*\270\252\343\236\322\352"
+	.ascii	"T\345\311\214h\345d\332I. \204\3604m#\214E\222\233\311-\267;"
+	.ascii	"\352<\231\272\371d\026R\313\377\363\023\344\r\225=7\237\303Q"
+	.ascii	"\223X\f\360\377\347\332\200s!\356\346\223W\302\316\374(r\363"
+	.ascii	"\265O#\311*$\225(P\204\320\270\231\234BR\201\361\024g\016\225"
+	.ascii	",\204(\tV\016\037R\326\276\330\240n&\241\220h\326\3700d\224\027"
+	.ascii	"\211vZTD\ts\3639\314\321\267\017C\246\300>\fI\232\235<\373\177"
+	.ascii	"\202\312\322R\260\335|\016l4\351\344\244\361\377\2619^\2249s"
+	.ascii	"\3639\240\321?\331\344\377\021\232\343C\006\217\233\317\201\214"
+	.ascii	">\207-\244\022R\tYf\277^\\q\331e\255\260\302\205\\r\262\354R"
+	.ascii	"\331r\303\b\007($\022\022\t\024\0351W\354\344\370\262\244H\021"
+	.ascii	"\222\354\005\252:[7\356\270@\0329I\006t"
+	.string	"\205\254\314\313\315\344\013:)Tn\230\325\371\377c$E\004r\3639l\211\211\221ClQ\021\212\355\312XV\363%N\025!'\207\220qE.\027A\366\310\271@\273\231\034#\"\002\003\f\314\315\347\360B\223@,\034\311\005\310\226\262\233\317!\312\207\217,gT\333\342:Z\262\355$\316\315\027\200\034r\007\271\203\344A~E\331\"\215\330\350\362\205\344a\317\202\330X\221-\271\371\0020Cv\221]\244\216-L\260\004\t\021\263U\226\343\244\016 t\220|\335Lz\2218\376\3770`\007\333\026\0160\213\004\313\312\034\2375m`q_\267\353\007\306X\013\307\233I\027n\013\033Q\310\262\004\300\205\213+\313\265ABD\306\016\227\216\233/\2003r\0069\203\2541\345i\317\326\361\252j\b\331\302\311\032D2\332\262\212\220[:\214\230\225\205\334\"iP\271\"\023[S6%\r\312\315Z\371L\f\261/Fn\276"
+	.ascii	"\204\220Yd\226\033U\033$G\027\336\256\270\320SUE\306H\352\302"
+	.ascii	"r\206\224q\tI\311\231\353B^\235\214\221\267t\251\202u3i\225\305"
+	.ascii	"\334ys\333q\363\337\236\366\377'geI2\346\346{\340\206|A\276`"
+	.ascii	"\263q\305%h\n\326\022\037ZX\260 \251V\2523G\240\032Wv\264\265"
+	.ascii	"\260F\222*\211\226\342\f\017\224\220S\344T\226c\201\352\314\321"
+	.ascii	"\246\351!\013r\363=\240\"7\271\311\024L\224"
+	.string	"`:j8\300H\251\223)~~\274\035y\220Qk[Wk\310(\022J\267&\353\205\330\315\344\323\022\234%^n~\007f4I\304O\260\332\217/u\300\354\331\223\345lQ\021*M\330\030Q\b\03277\277\003+:\356qY.I\357%g7\334H9V8T\334\374\016\216\344\311\243\203\263N6\214\f[\274\352p\021\235a\253r\374\333upA\206|Q\335\374\016r\320\241\243\303\003\342L\034!\232\030u\226u\347:<\344\f=_6\336\376\377\004\325\2012\022\246{\323\331!B\207\215\017)CF\030yT\324\311glji\320n~\0074\334\334\256\352p\351x\240\235\tr\363;\230b\303F\027\307\312\2402BVB\025\f68\327\305\331\245\301c\346\313\033r\215\232\227\2357n\314\370\2302j+\270#jm2\331\320\033\216\032On>\007g\332\332tAP@5\344\016U\223\343\326\315\347"
+	.string	"G\2312\2724!\240\022\362\302O\2132e\322\240\271.\r\221\013P\\\320\242c\223\303\002\205\212\355\2723>\230@\001\003\362\277\270\313\250"
+	.string	"\261q\263\231\274\343\377~:\243A\274\371\033\354\021#F\267v\202\n\210\214\035\2338k[c\256[\003j#\025\005M\307\377\237\235Z\023+47\177\2031jj\344\026\225\230\026\026W\034\213\233\277\201\222/_x\304\371\264\221\362\364u\3637\260\352\322%\b\t\225\016\270!6\2506Y7_\203;\\\270d\271\244.\342\235 5*\035W\307\335\221\315\030\217\233\257\001\230+WtZ\222\272\210o$\026\325\327Q\210\t\334\231%Y\256\3232\364vV\246L\207e\rF\034\334\315`?j\352\330@\273\371\032\364\250R\305\247\212\312K\b\336\262\263b\354\346\007@\317\224)Yn\317\2358XoR7?"
+	.string	"V\242D\321\363B\ne_yn~"
+	.string	"f\234\235\351\240\230\210\201\347x\207\254\231\343\345\311uP\362\2167Yn\354\221\305\325\026\256\233\237A\233\321h\274\303\225\217s2\262n~\006B\2324\2611b\320\021\003\306\210\235\256\233\237A\013&L\276\344 \331\225Y\211\343\306\314\222%n\276\342\310\260w\306\240\275\220$I\232:m\366"
+	.string	"\351(\003\203A\326\221# b\264\355!Z\223E\325v\363/\300c\304\210\n_j\354\220OU\212LQ\0312DWd\b\033\031\231\356\205\253,gD\256+2g\346L\314\327\377\037\241!^Run\376\005[cc\272 !\214L\260\310P\302\365\344\346 Cg\256\330\354\233\177\001\225\230\230\002\214L\260\354l\344a\023\005\215\017\037Y\316:\3310B`+\343\322!\007&\215\214\007\217,\227\324\205\333b$\271\"\333[\253\203\016\016\036+\270\0319r\350\302\230|\005\345\320\323B\307ua:\256\035V\225\0176W\213l\243\343\003\214\312\313K\007v"
+	.ascii	"\273UH\371:\272\335*F#P\276\256\003\313-\f`JW\331\315\177\373"
+	.ascii	"Q\301b\316\353\346\003\200\250\333\332\322uY'\033F\322\0226#"
+	.ascii	"c\307\275\265:\354\326h9F\271q]\327O\334\216'\343\315\272\032"
+	.ascii	":\256\377?@l3\310\354\233o\215\207\243\263\3618\271\207\030\031"
+	.ascii	"Kn\276\005lZ\327Bn\341\377\017^3\243I\334\315\177\263g\377\177"
+	.ascii	"t_w\336\\\271\371\026\210\321\277NK\247\225\263\222\234\354+"
+	.ascii	"\242\257\026W\\<\250\340rr\363-\220\242\177\035\226Q\207\245"
+	.ascii	"\223\321\241k_\035\340\315m\016\356\372 3vv\263.kh\312\030\343"
+	.ascii	"\226\233oA\231\276\005?\364\257\253\2725\352\252tW\035\272v\f"
+	.ascii	"\017\274\024\361`\035\363\250\360:r\263.K\"F\370\312a\006|\250"
+	.ascii	"\bK\"F\230\032v\273\240\017h\352\344\224\3668`Z\321S\r\026\255"
+	.ascii	"'\272\004\004,I\244@\023\204N\364\004\352\r\325u\204\251\016"
+	.ascii	"\205\250y\201\2574U&\364\344\365\230\234\324\224\t]rJ\325\240"
+	.ascii	"i\362|'\260\334\300\006\204g\206\377\224\204M\350\251\256\302"
+	.ascii	"\017\246o\b\354\241\347\007U8\374\260\001\b\034\242h\212\372"
+	.ascii	"\254<\223\205SH\232H\325\337\232\242>L\245\t\314\246:\f\346\240"
+	.ascii	"S\317\024\226=T]\205A'\240\240\001\021\023\230\300j\nM\365\347"
+	.ascii	"Czn\020\002\005\255'\272\224aE\207'\254f\323\320z\242KB\252\210"
+	.ascii	"\335\b\353\211\236\030\204'\260<\327\023=\327\236\271\232\276"
+	.ascii	"t\035\212`D\001s-{\247\017=\211T\024&\2348)\340CE0\327\322w\002"
+	.ascii	"\313\022\3014\275\300j6\251e\n\2539\002)UQ4\tU\024MD\377\361"
+	.ascii	"|g\320\007\b\005S\035f\030\321\204\236B\025T\363\304y\202\360"
+	.ascii	"\304\260\236\350\222\320z\242K\024\020\236\350\322\317\177J\250"
+	.ascii	"\211\324\307\013\016y@\3400\310C\317 \207\365D\227P\023\251\017"
+	.ascii	"\b\034\212\b\016\201\300\241\b\364\f\"\245\347z\242KB\377)\231"
+	.ascii	"N\347\252\373Oi\350t\236\350\322\320\351\364\371O\351\203\311"
+	.ascii	"T\n\201g\311$\364\237\322\t\365\303\t\365H%\377S\022\006\233"
+	.ascii	">\244g\206`\223\317\177J\037|\302%S\035\256\245\311T\364\237"
+	.ascii	"\322\006\353\211.\255"
+	.string	"C\377)\255'\272t\"%\261B\257\004\222\020\372O\tM\317\222\203^\257<\372O)UQ4Y\200\242i5\235R\225\304\t,IH\325\222D\206\377\224T\323\351\\\201\376SB\241\232\353Z\222({\274\017\351\211\301z\242K\276\236*\364\237\322Z\256\302\237\377\224\202B'\237\377\224xA\241\323\207\240\320iDP\3504\3043\235\316\025\035\252\037zL\001\360\211\260\232B\243\365D\227Va*bh\002A\377)]`\n\207\350p\367\237\222\206\025\204\345\372\323T\246\200b\204\3254\001\205%\240\377\224\322s\345\241\260\224\327\023]Ba\211\024\261\242\246\252\016{F+\322\212\341?\245\246!\t\323\367\301\007<\207$L_z\302O\320z\242g6\233|\023hBO_i^\340\f\216\020\232\3529$\201\251jX\241W\222\b\246\351\005\210\216\264\236\350\222\020=E\370L\b\203\336;U\0235\233\364\021\220"
+	.ascii	"\003$`\001'|\216V\223\267\252\251\b`y\252\246P\303\177J\345\007"
+	.ascii	"\241\232\nQS\350\201\211\022\005\220\260\b\bL\325 \037\241i\252"
+	.ascii	"Mf\t\277\336z\006\205\320\246\023(\002\222\3113}\351\t\246:\004"
+	.ascii	"\236%\323\020\206\365?%!\t\253Z\256#\232\320\023h\242h\371\353"
+	.ascii	"a \344\r\255\377)9\231\b~\020\252f\211S\365i \004\016E\250\346"
+	.ascii	"\212\232$\b\221\300T\2310\244%TS\310\363\231Nj\211\016y\247\272"
+	.ascii	"\032\255\377)\221\302!\035\206\365?\245\023)\211\017M\301\n|"
+	.ascii	"K+j\242\245\223j\006\203\204E#N\244#\244'z\006\221V\236\360\004"
+	.ascii	"\323\351\\\365\312\003!\204\311\0236\225@\n\230@\022\245\360"
+	.ascii	",\241\314`\366\316\022f\tK\"F\374\230<\325DM\240`\366\324a*4"
+	.ascii	"U\"!O\210\205\037\317D\211b\307\302\217W\304\302\357\327[St\245"
+	.ascii	"\200\025\362\230|g\220\024a\227l\t\326w\006\361\212\236\251\210"
+	.ascii	"\340\320\207\236\034\330\020d\242\364\300p\204\357\f\356\320"
+	.ascii	"\363\204U\004\337\031,Z{&\023\323\321\252\232\301\023&o\005\236"
+	.ascii	"+\017MY8\325\364\227d\372\322\023P\254g\211R5\341\\\321\222("
+	.ascii	"\005\r\350Y\232\240\246k\251\232\0314`\242Da\0044{=\021\314\265"
+	.ascii	"Tw\276\246\"\0370\375\t\3153\r\256\2460\311t:W\240\240\fGhz\256"
+	.ascii	"\247O-M\250)\005|\246\311\204d\242D\301#\002b\341\307\003A(,"
+	.ascii	"\203&R\240\021\n\325,\221\366L\225\267CZ\323\235\031D\261\026"
+	.ascii	"\235AMh\231$<O\224\033\320\263l2\022:\361|\245\371+WHS O5\321"
+	.ascii	"\263TW^\252\366\312\n\320\263l*2RSU5701\245\353\260\307\023\222"
+	.ascii	"(1\230A\024+\017\004\325\\\201'\023\006\026~<\364d\341\347\244"
+	.ascii	"\232\253/\203\351KO\020\221\302\005\353\351t^\300\0046\241\""
+	.ascii	"l@\317\322\004\243\325\024\232\032P\315\246\246SM\301D\n\004"
+	.ascii	"\212@\302\257\207\016K`\006<S8\304p\242\004\232*\317D\211\202"
+	.ascii	"\3473\327Rm2W\364\314\300\302\251\226&z^`\025\016\325\337z\244"
+	.ascii	"C\317\262\t\310"
+	.string	"\354\241e\t_\351\033Z\207\301u\230\3620\220+:L{< \320\354\361x\351:,7\254\250y\n\321R]\223Va\232\222\34011i\323\251\304@0\310)\250\362\320\323I\310g\232A!oEM\247U8\034\201\257D\"}gpg\nKS\355\241\247\t\364\235FA!\317\\K`\032T\315\025=\327R\345\235(\235xLLF<s\2053(\34411\355\324t\355\225L\274\337\232\246NB\036\023S\221YB\035\366xLA \017E\341\303`\366J\225\0074K\230@\"!j\006\235\322\036\257\251\024\362\326\222D\t\244\377\224|g0\311w\006\203\234R\324\364\361\204B\263\227\252A\236\357\f\032\241\351\271\242f\tS\rZ\200\242\004\232>\r\314\2654}<&\246\324\\\241\\y(J\023%:T;\370OI\bL\325\025M{\274\236\372\241\307tA\t!\212L\244\300\335\257\351\374\021\371B"
+	.string	"Ku\035\232\350\017\317\027\302\207\226$|\245\351;2\221\002\203~M\347\217\347\013\261\236N'P\310\027\302g\n\211\206\326\377\224>4\0055\250\246\323\231\202\317\324P\302,\301\\K\r\b\025\241\351)T\315\022\350\222\223\t\021FN&D\370\314\036\212B\210\252`\n\207\273U\250\016G0\205\303!\024\352j:\231@3\005\243\225\347#l*SHO\022\230\366\3225UE\254j\032\024\242\245\232\202\206&\264$\261\236#\254\351OX\202)\034\022\2250}\330\034\002\313\r\254\246\220\211\t\005\023\350[\002\226\353\331t\3724\240\247S\220\t\\\327T\375\255'J\247\240\225\227"
+	.string	"\020+z\016\265\017-\235\234\322\036z:\001\255\3500%\301\004\246\"v\377)}X\177M'\220\311\202!\323\227\236\240\232'N\247\037`\232\216\300\323\371L\241j\2260U\236\320D\211\342hE\315\236j\006yj\272\246N\033\322\340\t\223\027<\201L?a\251\366v\377)\001\340i\320T?\254i\252~\b\022\362Hp2W!\n\341\356\204\351C\227|g\220\250\304\271\366J#\323\227:\361\232\206$L\037\220\260w\256\302s-W!o\005a\271\022\375z\353ib\2040\025\221"
+	.string	"\023x2\245\252\bs-U\244\025z)\260\247\232%R\3360\330\0332\235\316\024\314^\251\232\200\242\240\232&\322\240\006\265\374\365\262j\236L\347\212\232\276%\237Z\246$\210X\370\235`\n\177\244\271\226\353\b4=\327R\0356\235Lh\332\303`\256\245\006L\026N\247s\r\242\240\232\300\241\317\374\365\204H+o\001+z\016}\016\002\004\t\032\250\200\001\023tOi=\321\363C\217\351\003z\226N\037z\252\360\203R\206&\364tREX\241w\256#L \211\0225\215\376\373\310\320A\271>f\300\271\221\025\205\361\250\343\301\224j\"\353(\206Qf\0202D32\234t\243\026@@`D \020\306\315\347\003\023"
+	.ascii	"\004\215"
+	.ascii	"\f\345a\"\206\216\021I\222\202\242d\3307]t.-\352<{?\362\327\034"
+	.ascii	"\022.\203\262\317l\267B\003\205\224\232:\3332\235l\371g#\337"
+	.ascii	"\264\200\260.\027\007-\340\201>\3639\354\260\204)\244|\267\034"
+	.ascii	"\360\224}\254\200}\236\330\300OQz~}A\300I\006Nvg\004_]@(f\340"
+	.ascii	"3\307\206\350\307\n\025\200.\013\240\226Ct\263\355|\266\223\347"
+	.ascii	"\216\360,\313\340\3423\211k!\020\352~3!03\333\307\226\237\310"
+	.ascii	"\007\023,`1.\017\005\322\367\217\273\204\262\033\364\266\244"
+	.ascii	"\333;\300n\324\025\312\232\032\255\311UV\006Pc8T\036Hf2f\271"
+	.ascii	"\005\316X\330\362\001\347!/\016\223\206\320\201\341%\311\336"
+	.ascii	"w\324\2621\2014H\253\355\327dB\330\264\007\341\264\255\270X\""
+	.ascii	"\026\253\330\327\350\201\300\216\362\310rr\tK\230\031\316\243"
+	.ascii	"0\220\033\2022\312m%\375\202+\356l\257`OsU\244\3110\346;\221"
+	.ascii	"\365\b\235\335%T\n\023\004\346\224\200\235_\233\330\374\312D"
+	.ascii	"\215&<@\200\373\205\325pQI\003,k\330\003\nA\272x\017\254\207"
+	.ascii	"\2126\311\342\304\206d\021R\355\372\260\232A\026-\207\346?\253"
+	.ascii	"cf\220\352\325\265w\"J\255\342dgse\332>\277'Fv9\007\377\351\213"
+	.ascii	"\372Gu\313)\360\256\372Pad\211<\331\270-\316yp\352\020\334ts"
+	.ascii	"\301\261(\355\206y\233\306^[\364\036\3360~\340\332\315\245\202"
+	.ascii	"\"bT\2154\246)\0327I2\375l\\\350.\367Vw\024n\321\bI\205\200`"
+	.ascii	"8\263\364V\b\215\207/Z\212\033F\345\r\035\304s\235P\013S\254"
+	.ascii	"1\216\303\364,\200\006\036Z\006\344\030\362\333\371\214\335\202"
+	.ascii	"\277\363\355\325\337\255\243\223\355g\376\333\273\300\344\310"
+	.ascii	"\002\020\265\003\234\330\374\226\2644\204\034\370,\032\373\340"
+	.ascii	"y\342/\2015CI Vy\307\200\335P[\230\263\3441M\037S\352\033\374"
+	.ascii	"\202\3558+\177R\356d\212D\022Z\231?ym/\254\246\204\237\233\237"
+	.ascii	">>\223\243g\0174\025f\b<\241{2\r[-\251\n_nF"
+	.string	"\213\334\006N\020\236Q\037\332\230\307\350C\201e\030j\324\252)3.\031A\237\2155LP\200M\344G:\002\t\332D\307\266K\270\324nP%/\315\342\376\031=9\250*\230b-\240!.\343V\344(\271\330\0254}\034W\016\207l\326$\323\231\274\273S\020j\\]x\256y%:H\206\313>\326[\230\325\324\200\257\354\257\017Nz{\223\211+Hy%1IEJ\260\335W\031\323\n\267\272\265\273mw%N T\353\2051\203d\301E\342\274\016B\242I{*\325@\224\351\241\3076,\215[\333\272\031\221\347\260Q\347\234\024(=@\216YA\352$P\251Yk\262\312U\264=F&>\272s\236\211{\003<\305.dr\235\211\325\347<\177\231\031\246\242\016\254\260\353O%\027\214\265N\217\rT>\261\274\343XP\030-\312\n\2345\226\337\230pJ\271\316\334\322`U\270\216\304'\331X\325\t\330\233"
+	.ascii	"\031O\256;\225\".S\236]\275\357\036\332\217\203\3400\023\222"
+	.ascii	"\300\3340\267Z\372Kn\3456t\300\033\020\336`ef\377\351D\300\231"
+	.ascii	"\260/\024\274\305\236\250\031\273\352\216z\346\225\372\r\244"
+	.ascii	"\242\357Lkfjw\022s\037\341\314\340\363-\344\016\036v\003\b3\360"
+	.ascii	"\317z\"\231N\376M\245\322\036\345\366\020\216"
+	.string	"y\031\207\221\237\006\306I\327|H\243\302\3379}\304\322&\375\327\372\371\2762>\020\354&\322Hv\250h.mK`S\270>\317\3376\340\340\254N^\325&\355\016\013p\325\b\360\367\265\216\255-\256\372=\243H p\306\317\031|\0329\036\031\265\013\\,L!#l\2340\326,\336\223\241\335+\002\275X\206\207h\f~^\351\342\006u\2174\214S\007\n\341\002\211\216\3342\007\337t\330\236R\325\370\355\003\016\215\017:anp\370t\261\201]\f\201\363{4\201\224tH\375\371\013\203\204\244\243\215\f\330\242\360\337\343Dl\276\354D\354\272~\253\330\221W`.KV\236\351vB|y\212I\331\210/5\230G\271%-\261\204\033C\205\333\034@\242\360\013\024\364\302\311=\350<\245\315\264\274\213%\340\314x\256\016i5\bnz\202\213\370\230\266\245\253\302'4\2571\n\332\353\314\300\030!P\036OWB"
+	.string	"\234\204\034;\371\026\300\224\0210\304T,9\226\243\277\016\264I\033\373G\037\003,\300\333.\312\204\r\240\330\222\177\254\177\256\035\375\264E\356\027\224\305\306\310.0\306`\234\2214u\377\363/R@\360\242\030\376!\363\353\303\242?\016J@\224\360\203)\242\230\3723\363%?\201^=\206fR\312\276\016\277\355\314\301rR\216"
+	.string	"s\310C\252\254L\320\030\343\262\313\201R>\237\227N\323\2449\020\331\177bi\352\262\351\bO\227\200\215\303\311\311\317%vR\201\271\037z\352\177\013I\256s\b`\244B\367\370\264\251\336Yf\013v\231\246\206}\233\251\2423;\301z5b\300t\315\211\370\325\311'\331\307\243\027\256\037.u\301\202\370\377(\313y\312\202[\003\177 /q\253D\311\274\247\322]Wka\304 \210\376\277\247\331\034\277n\203\206\026\034u|\337\356\220"
+	.string	"V\214\374\314\251\020\314\277\262K\006J\351\332\2521Yw8\353\343&\251\236e\355\202\037\323\036D@\333-R\302\342\360oc,\331\345\345p\274m\200\312\321\322)|\312\b\220\314\331\003\277\326\005\345\270\373,\024\n\002\002\366\372\224l\212\320\260\325\274\234n\007\3011\263zbU\235\277\266\356\252\341D\365\377\313\261\022h.\325\303\251\261;\370\330\262/\352\344\267\276>R\022A?\351\037\271u\344\223\223\027\352\n\253F\277o\277r\250\301v\270\333\316\242\207\213\007\271\211F\001\3113&ZCCb1\271l\240\"\0228m\r\237y\245\315j\021\264\345\330\"\254\215\372\371\025\002\244\2569\323\333\227h\260\360\2305M \365\267\342%\232Owk\265\365\375\323&\251\316b\301\202\261R\341\340\342\213u)\rk\331\002\313\324\375\017\323\016\315%\262\220Z\371\251\035\316'N\037\261!\tFk\221\n"
+	.string	"E\257q\214\335%O#\312\315\325\320\025\367\354\333F7;F\257^~.Ff\007j\\^2\344\215\336NW\002\032\002\376j\234E\217Y\327\270mA8\b\314\006\021Z\0070V\272Z\200nt\373\231\357\005q?Wf\b\241\324\177\360=\233*\356r\326\034\336\3774\210\024\301R\254\007 \317M\263\037\323&G\241\265(\347ohz\364H(\267p\021r\274\201\032\304\214\020V\005\004\007A$\\\004\004A\260\025mh\211\2223ug\300\342v\204\371\310D\376\260*^\203\316\344\204Q\253\316:\221l\356\264\357\334\030\337\211\t\364\335\342n\343\346n\360\035 \317K\377\245\336\232\241\266\306\253\224\372\300\372\317\242\317\022#M\344\327&hY\r\262\205\210\250\235\235X\246e\035\225`\005F)\314\241\022\2269\302\024\371\371\351?9_I\206\004\221\220\255\t\232jX\311\276\2526\257\216\371A\303\3377"
+	.string	"\207\016\214\232ktCJ(\222\324\225\273\240\021\204-4s\246\256\346\317O\347\007\345\366g\254\305\360$\347\310aV\034X\034\035\024\021\347\212M}\235\345\340\230\325\fOq\201\227\374"
+	.ascii	"\200\005\260\345\237\2644\342\362P`\217\\\323i\240\234\265\254"
+	.ascii	"\237\fhL\311"
+	.string	"\310e\230\347\261\346\207\251\007\212w\007\340\374\024Tu#]\230\246\013\2157\320@\270\215b\214\325\212\327\367i\220j\035\247\f\261\253\037/i\223M\005v\251\312\216\207@\b\226'DA#\241\t\270\274:\f\023\\\370\226\253\367\301\254T\"\335a\232\243\253\333\343\367\264\337o]\b\325"
+	.string	"n%\f\001?<\026;\321\376\247>\270\220\276\325\372\034\030\252\nm\321+mmU3\312<\363|\025\310\3674\032\007\271}\002@\370867\260\221\302\tH\242\367\037\217\320\330\0139\257\243\376\372\251\350\201\334\016\365\023\030!\323\222\244r\032\366\226\240Ih\002"
+	.string	"\022y\203\337\377\272\264\007\211\317!cw\302Mp\227+y\274\311\371\260\254{\336\026\246A\237\364\034Y\234D\267\367\3009\247m\245{\214s\213M\034\256\364za"
+	.ascii	"\022\341y\241b\026\274g\360YH\350\275!5\261\310\326\037\363\320"
+	.ascii	"\177\343\0221\0270\262y1Q\333C]\227\375m\245m\227|\335\214\005"
+	.ascii	"\271.5\333\352a!\374i\237\361"
+	.string	"0\003!\355\204\256\334\311\002\272\266no\354\342\027\240,\003\t\235Ot\223\222C\036\224k\207\n\fT7q+\231\246\205t\222'\0224\215\337D}\332\275\210\243\326`L~hP\337\217oa\007\036\330v\203\243\001\036\260\203\371j?EB`\323$`\265\364\261\323'\226r\252\303\273\316\304\016\017/I\360Q\017\036\332S\004W\221\353\"\274 G\267\201\253\231\245\005\311\340\036(\246\356:\n+\241\325\036T\2413\201)Q\236\215kaM8b\365\357n\234mC\207\353\327ZL\221\211\377\272\013e8\255-\203\203G\331f\305G\243\306\324\374d\026]\362k\0333w\021\242\225,\020\275p\201\340\254[`!\3517\256LV\367\233\002V:\271\260\236\322\272?\236\033\332l\204\331\362\217Rc\356\274e\200y \367\335xa\353$%\250\220\026\364L\335\303\210\023\271\264\242\361&\305\370 a\021m\307\022\270"
+	.string	"[vAB\f\302\320y\035\"\033T\274\357\325\220\227?J\274f\251w\256\373/q\001\207g&\253\336}5\202\272\365\346\340,j\bm\377*\274\0036\315\2252@.\004\344\344E\f\321w\320\\\300\231\031\025p\322\022\035\002o\254\013\323\350\224\274\025\3146d8\005C:X\035Y\030\272[.\227%\032\266\225o`\250\277\271>\242\023\352\345{\325\356Q\376\266\342~h\r\326\206\234\3103\327\270\241X\342\327f\007\234\017m\300"
+	.ascii	"\275{\360\272\363b9\037u\233\235?\375<\331l\260\372\334\347X"
+	.ascii	"\337\253\332\227\"\356\274NN\373\242\262\007/\3756\324:\361m"
+	.ascii	"\273\231l\372\245\365Y@X\373\373\322x\221\230=\027o\214z'\212"
+	.ascii	"=\351\375\022\255z\006\327\246\363\204\211\034\220\374v\362\236"
+	.ascii	"\362x\257\351\004\032n\315&K\272E\326\237\327\303\260\331sg\205"
+	.ascii	"\313_\335\360\225\214\007(\353|}'\022\327\233\352<\037k\257\327"
+	.ascii	"\017\226\037o\377N_=\233o\033\233\317\330w\016^Y\351\344\310"
+	.ascii	"\005\207\337\034\367\301\264\025\235P8\351\n"
+	.text
+	.section	.gnu.lto_.symtab.d8622fd0e7d55661,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"requiresSpiLeadingEdge"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"tasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"unusedPinsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"motorEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"motorPostInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"baroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"pinioBoxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"pinPullupPulldownInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"pinioInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"gyroSetTargetLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"sensorsPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"initBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d8622fd0e7d55661,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2829 @@
+	.file	"rc.c"
+	.section	.gnu.lto_.profile.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\0031"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"M"
+	.text
+	.section	.gnu.lto_.icf.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`g\006]\032"
+	.string	"\204\034[\007"
+	.string	"F"
+	.string	"\331\342\211\330\013\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\251\317\374\337\b\003\210\242\345\320\t\004\255\260\270\007\005\250\263\360\200\r\f\002\003\002\003\002\004\006\240\342\234\212\n\007\244\254\342\337\017\026\002\004\002\005\006\002\004\002\006\007\002\002\001\002\001\002\b\002\t\t\370\326\276\261\016\n\013\f\r\020\354\330\323\206\t\n\001\002\002\021\262\320\372\304\003\034\002\004\002\n\013\007\f\002\r\022\023\253\371\220\363\b\034\002\016\002\016\002\007\002\017\013\b\002\020\001\002\017\025\026\027\236\307\314\315\0046\002\001\002\021\002\007\002\007\f\002\f\002\022\002\022\002\b\002\b\005\b\002\t\b\002\t\031\032\352\263\360\321\b\034\035\036\037 \237\325\371\277\t\030\004\006!\"\315\343\301\244\013#$\245\331\372\241\016"
+	.string	"%\363\330\236\330\r&\354\206\342\366\006\002'(\377\341\234\356\013)*+\004\002\004,-./01\210\235\247\230\t\002\002\023\002\02323\261\205\367\303\001\n\002\004\002\024\004\002\0244\220\300\337=\0045\330\277\200\376\006\013\002\01367\347\273\234\355\f\0028\215\317\243\217\013"
+	.string	"9\201\255\340\307\001B\n\002\001\025\002\f\001\f\026\002\r\001\002\r\026\001\007\002\n:\317\211\341\254\b\b\007;\312\271\257\224\003\r<\326\316\210\243\003\242\001\002\f\021\025\001\004\007\001\002\001=>?@A\205\307\204\306\b&\f\002\fBD\364\217\372\322\017h\002\b\002\027\007\030\001\002\030\002\f\f\002\031\002\001\002\031\002\b\002\032\001\002\033\004\002\034\034\005GIJK\232\214\265\246\f\006L\350\300\306\254\005\002M\331\342\276\337\f8\001N\264\323\204\275\016\021O\313\322\375\213\007"
+	.string	"P\247\226\246\235\017\f\002\r"
+	.string	"\200\326\250\0216\241\221!\005I\322\001`\202a\250\212\363\021 A\305$\232M\222\266\003\251\353\257\362\336\262\324\005\274j'\027\242\004\374\267G4\306\350\276\324\242\361\300\032\237{\214B\337\211z\300P\244\006\374Y\345\334\371\215_\305\273\376\326\354P\003\001:0\363\034\335\332\262\3173\217C"
+	.ascii	"\264O\246\307\227\233g\\\375\315\245\256\367\265-E \336\321\372"
+	.ascii	"(\304\2467,\351\217\205\201D\232N\031\0321n\312\002\223b\242"
+	.ascii	"Oq\003\204\322{\356*\037\360En\031\300rR\337\340D\333\371aQO"
+	.ascii	"a\f\250\271l\332Z\335\271\356\334\255B(M\231)\031-\300V\303u"
+	.ascii	"\2121V\320k\234\210{\210\253y\250\027\350\361\216\227\333\313"
+	.ascii	"k\327\263V[\265\037A,\3053n\033l\350u\304\315v\206\036\205n\371"
+	.ascii	"\232\025\037\342;\340\272\337d\006`\331y\034\262\271\257\245"
+	.ascii	"K>*)\316@{)\213<7\004aw*\177\215\237\r\277\357\241Q\300\031\233"
+	.ascii	"\277h\254.$\237\237K\274\266\023\273\374\241Z8\021\tSh\374p\317"
+	.ascii	"\006U\2058-\r\253\006\t>\374\024\333\267\303\253\346\205]p~\306"
+	.ascii	"Q\302\002\346\330<>\353\217F\023%\233\177\177W\211 s\314\373"
+	.ascii	"M\334\333\333\230\210+\226)\335~'3\257\321\323\205\270t\371\n"
+	.ascii	"\211\226SB\324\230\367\237\236\366j\230\027\305i<\254X\"\005"
+	.ascii	"\241\232\252\274\2562\255\250\035\350\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\r\006"
+	.string	"\262\007\027 \200M\241\00330\0033\300\f\231P\007\005=dZ"
+	.string	"\b"
+	.ascii	"\b \360X\020\243\020$$m\231\002\356g=\333\341\354fjT\315(F\275"
+	.ascii	"\224k\231\025\267QJ\353\311J\"\203\250\217\3729\032\214](\022"
+	.ascii	"#v\332Ci\004\252\275\031\264@p\016\266KP\006t\003H\321\265;\271"
+	.ascii	"P0 \260\002\"#\333H\0214\356\344\2325\367\221[A\r\036\260\341"
+	.ascii	"+\300\300\247i\361*x\036Kq0Tc\237A9\020\300\254\215K\210\203"
+	.ascii	"P\222$yx-\352\fdS5\210\261\307`\324H\r\246L\263\\P\n\340m.\366"
+	.ascii	"\036dp>\304\214%\2553\221\021B`Q\231\225e\362\025$\036\2116\207"
+	.text
+	.section	.gnu.lto_.inline.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\035\013u'"
+	.string	"V\366\266H\240\330M\032\003\220\023\372\355\331G\316\247\374\322\204O>\255S\352\350\335\376\254\337K\200\017\352\035'\201c\364\325\026\337\002@Gz\260\273k\343)\2147\"\336\343\013\357/\235\367\357a\215\333\306"
+	.string	"\277/\254mm\333\336r\247\230"
+	.string	"\247"
+	.string	"\247"
+	.string	"\342\"\311\247\320\304=z&}--\001\272f#\232OaL\256\366\245/\325-\r-\302\035;\235\3666J\030\354\262yh\336\264-\342\366\r"
+	.string	"\253\2652\260\375T\\y\224\177{t\026\205|\213F\027ig^\236\302\260&<\233E\262\274\200Btr\311\362\002\372L\215\366E\226\027\020\302\212O\333\274\272c\255\225\207\356\263\250\300\233\263n\267\275\373\321\351\274\271/ok\255\225\366E\223*\313\013\310a\366\353\254\224?\202\225\373\037X\371|\032\255\215\2470\254\240\007\272\346&\262i\177\032\255\225(Q5\366\232\300\347F\232\365\315\034USA8\354P-U%q0\316\271QN\026\363\24608\024\333Q\200\230h\277\226\252\256v\017CCo\202w3*\251\t\214\266(\342\346-\023PI\252\366\342j\336\325\252[\331\333#\302\340V\200\357M2ap\013\347f\032'\251\371\016M\235\342\f\330|FF\030\354\002\372f"
+	.ascii	"\364\347\252\265\006M9Uk\325\031'?7\236\033\347o\003T\212\032"
+	.ascii	"i\333p\333t\333%\246J\217\355\3152\261.0\264q\367&\216*O]l|\023"
+	.ascii	"\212X\027\231H\223Jd7\247\371\017\215V\317\215k\2763e\225"
+	.string	"\344\331\243\237\271\232\337\256\346\322\005\022\232\317\036}{\226\230S\206W\246\036\373\302\271\221.\235\013\244\270)\246K\337\214\001U66\263\220\264 \377\031(\2328\264B\321\332(\205\3348o\314_\234Z\212\371\033\343\021F\202\212\035\313\210\030\211\360\204s#Nm\276\2246Gx\320`.\bR \366vv\202\335.o\002\375\275\275\372\2419\323\335\322\034\334\276\005\263\265\370\332\317\263R\336\263r]$\241\361,\222\244O#\334>d\264\254\302\b\r\031\313`\371Y\034\206\325\027,T\002\377\236\302\232\334\036\361\257\210\255q\252\365w;\3679\245\032\264?1\261\2340\001\221BNL/N\230\204|\345\020 x\264\017&6\306\026\256\244\245\"\373\025\031\312\341\035\226\333\314\2263r\233\206MP+p\350 \223Z\312\033h\336\022\363\207\r.\250\035\232X\0313\306\306H\2555|#8\314\"\300\267X^@\245"
+	.string	"g\350\315<o\351\254\215\301\2665S\002\240\347\306\334X\327}\231\275\266\372\222\260\222SZ\247;J\251n\316\227n})\221\254/%\332+Q\224\275\331\244j\312G\316\223\257%#F\270\237\213\001\200\366\250\0219\347\b\315\314h\212\222\024\032\003p\242\231)\262z\022"
+	.ascii	"\365(\210\302\230q\312\f\211\004\024\024$)*e3 \016\003\213\314"
+	.ascii	"\373\020\346\013-r\201\332H\277\263\250\006 q\236)~\277\224S"
+	.ascii	"*\n\007\346j\2008\3148\274J\376\b\343\336\211\307\007&\2430\321"
+	.ascii	"\376H^OQ\272c\261:IH\016Vy\323\264\007\322\250A3P\375\263\243"
+	.ascii	"\374JY\222R.\213\023d@\001\205\200y\211GA)\263\244t;\321\331"
+	.ascii	"N{\273\035\221j\244\037\233\224\327\224\345\240\274fb\276\212"
+	.ascii	"\036?.b\331\215B\256a\262\t\243\026\006Z\016\302\273qQ\224j\236"
+	.ascii	"\203u\266.\267\353\240\365\253N\200\017C\"n\037\365^E\274W\232"
+	.ascii	"W\224\370\260\244R~\\\201\004A\017\230\007\206\252\213\376\363"
+	.ascii	"\353T/\3042?D5\271g\324f\230\t\351\345\205FS\313\357\004\316"
+	.ascii	"(\223K\302\030\211\357\320\330\351-\277`\005w\3604\304sc\031"
+	.ascii	"\313`PsA\230\311\306`\032\242V\202kC\215R\313W\266\260\301\322"
+	.ascii	"S&\274\256|`\252\367TV/q\005\035a(\365waE]bm]I[\246\035\273\021"
+	.ascii	"k\002\355\301\356\t \017e\256W\245PC\215\003`\216\273,\332\223"
+	.ascii	"\002 1C\375\202\367\364p\222\021\274\312\315Tx\336\026X\236\021"
+	.ascii	"\234\314r\3228\027\306\024\002;\317S\266\340\252\r\272[rH\b\260"
+	.ascii	"\271\303$\332)\2216m\213S\017NN9\372\312\006\343Z\277\277\223"
+	.ascii	"\255\272\3600\307w\322a\003\311\247\330\234\271L\306\034^\236"
+	.ascii	"V\244\n\234FX)\363\004qp\177\n\323\230\005\302:pZ\360\227\242"
+	.ascii	"\256C\233\004\236\b\007\032\202\242\326\340\247W\2669\370\214"
+	.ascii	"\002\326\215\317\267@\331\020\242Dc\322\341\036z3}\236K\242\303"
+	.ascii	"&\362\024\346\017\237\213$/\363S^\323\004\225\270\271@\216\001"
+	.ascii	"\207\211*k\0225\2053-7\246\361K\213j\207\237\220\271\252\305"
+	.ascii	"\335\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\353\004]\017"
+	.string	"\366\02192Po\322\0010S\271\fbG\343X\016\b\266\231\231\031\316\240\344JbJv=\250L\3504\370T\224\315F\237\336hQW\364\347\223W\264M\344N)\005("
+	.string	"-"
+	.string	","
+	.ascii	"\366\005JQ\256\214\363.\240\035\271\013\303\336\372L\365\231"
+	.ascii	"\3346\217\341s\331\232C\352\326\r\236\007\317\202'\206\355UP"
+	.ascii	"\251\231\020\230$\217|/\263\366\0013\344\f`\337\241\201\324\216"
+	.ascii	"\030D\030jA\355B3A\001K\200\025V\316\024\3667\346\363#\f\034"
+	.ascii	"\237\233''\036\217\363\204=\343'r\321W\351\242\255E\005\273\343"
+	.ascii	"\264\326\362n^\255yC1\321J\270\305f\361C\021i'\n\273[\272\361"
+	.ascii	"\336\330\017mA\332\217\326\003\323U{\223\252*\371\374gmv\264"
+	.ascii	"\034\355\206W\374\367\305\327\351\330\305\327\2344\2477\235$"
+	.ascii	"#\r\253\370-kx\250aMHLH\322\312\262\006P\0021\212\231q\003\022"
+	.ascii	"\300S1\204\301\244s\f\032\n2I\322:\225\2151\033\220>\tQx\337"
+	.ascii	"h\005\312\360n\027)\213\231W\215\344'\0179\243\270@\267\250\342"
+	.ascii	"\320\252\236\t\362\013W;\034km\267\376\334\373\246\241\224\225"
+	.ascii	"\036L\030X\204V!\245/\273\227\213=\360\331\333L\022\216%\034"
+	.ascii	"\b\232\225\272I*\r\035X\264n\335\347\263\004\204u,\253(u\203"
+	.ascii	"\033\230Sr\302C\223<\211\316*\220\300\375\373\356\005\037\005"
+	.ascii	"J\336\2464\313.\013\255\204=-\226\034\337\200\235\f\267\336\330"
+	.ascii	"&\301\321\210\244\260}\001\257\214\377W\237\225\301\262\274\003"
+	.ascii	"\342\350c\006\030\3138\312\005a\016\357\207\302\\Cf\360HK7rZ"
+	.ascii	"\267f\370x\233\223\005X$\237o\231\3428\227\222KB\232~\307\217"
+	.ascii	"\017\017\2273;\023=jeB.\250\311\305j\021\013\344\361C]\324Xh"
+	.ascii	"\350\b\261\004\325\002\320\003"
+	.text
+	.section	.gnu.lto_.pureconst.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375 w\005\003"
+	.string	"r\007\027\034`7\244\003\363SJ\314\006\3510\fPp\372\322\323t\244\374\361D\224\220a\033\337\016W\264\n]\320\371\271\236\261sr\306\315\251\3712/\314\353\262\262\334\312H\271\223Q2F.\344>\256\3436.\343.n\272\212UbD\214\207\323\360*\234\204s\360\022|\177\201\017\360Y2\263Q"
+	.text
+	.section	.gnu.lto_.ipa_modref.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`F\003\245\r"
+	.string	"\346\32161`\2132\034P\020\344\0322\360 #\203\227 H\020EQ\314\212\312\351\302\b\264g\355\333\177e\355\025\264\005D\362\301vW\027\0258\316h\311\2262\005&"
+	.string	"*"
+	.string	","
+	.ascii	"\356Rn\351\254\360\tH\375{\317\003\032tR\332)\245\307\031\r2"
+	.ascii	"\265N\207\316\226\267\375)\021%\242H\355\353)\013?L\347Cg\244"
+	.ascii	"<R\310\0170\342\300\227.U\244y\333\330\325\347,\rI\337\263D\257"
+	.ascii	"\357U\245\3714VbT`4\365\321\002s\347\002:0\317\223#\351\244|"
+	.ascii	"\242i\206Sb6\345\033\314Ba\003\303\002I\234hJ\205\211\225\t\207"
+	.ascii	"n\b\227\266\013n\246\363\225\001\377\317\253\237\225\027\264"
+	.ascii	"\250T\374t\250\022\021\235\020\240\316OyVO-\212\237&:\345\035"
+	.ascii	"~\201\332\207\034\314\336\271j#i\2501U%I-H\nY\346`\2021eE\036"
+	.ascii	"\021\260\031c\322\314HJ\n\013\273\001~,\354\242j\216\221\206"
+	.ascii	"x\004\006\265\027,7\327\214\264)\213n\207;.\263#\311Hp\n\254"
+	.ascii	"/\"j\375\244W\207e\202MIw\231\037O7M\304\003sS\032+\352$\307"
+	.ascii	"\320\241\367\022\003Y\241\251\257'\017\345L\022\200H0T\357\002"
+	.ascii	"\245+j\2039\303\306\230\336\255\037\224\240\026\213\233s{]\026"
+	.ascii	"M\232\025Z\234k\320\342\244K!\003\205\214\t_1\275\016\206c\n"
+	.ascii	"\024\324\313f\345\210\346\332\340Q\325\234j\230\277\273\003a"
+	.ascii	"1\224u\277m*\376.4\244=\025X\215Kx5\317t\240\336\341\325f/\202"
+	.ascii	"]\303=G\347f`\360^\300x\212\311D\271\372iW\240&\207\002"
+	.text
+	.section	.gnu.lto_.lto.f27a251d4c2d4c22,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getRcFrameNumber.86.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375 \354u\006"
+	.string	"\242\314-3`M\222\016@\203\027\234\220\236!\254\342\253M\350^\200\244h\261S\245\031\326n\254\217c\353\245k\\\001"
+	.string	"\b\232\203\002\341\332"
+	.string	"\001d\304m#\215l\231\002O\232\251r\023\202[H0PpS\325\3404\230)\206\203\3129PT\345./\313@\3102\036\006\361\005\351\263\256\306\017\033\354\325v7R\0332"
+	.string	"\n\017\206\376u\220]|\243\314\314\031\350\307\221YJP\004F2%B+y\322H6~\316_nG=8[\321\313\370H!)\021\"*\231\317e\032 \265E\305Hm\f\243V\321\272\375h\304aar}:EKAf\216\327g\242\263\376\004\377\300_\021\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_getSetpointRate.87.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\245\007"
+	.string	"2O55P\215\322\001\244\204\350')\rJ\341M\210\263M\232q"
+	.string	"\026\340jFQ(\355\237\306\2111,\301\337\020\222\252\2522\352\232qch\024\234\267\277\355\357\275eJ\001\240\317\203\347\325\352XX\264\020\242\302\307\223\020-\f\024;\233^\013\007Xd\270.,j\266\373\335\225\234\343\214\\D\333B\370\243)\314\377\202\272\303\036\r\265\311\260\016\241\264fX\207\\F5\312U\273\211\322]\264~w\2456\263\316(;\337\005\245$ \345\237X\255\234\004\2524\332f\255\246\255\323\250\2164\363[\234D\376\023T"
+	.string	"c\330\266>y#kSo\3130\331\344D\002D\345\177\344\030\300b\370\274\261\030:\fg\316\2546\207\037J\305J#\211\234\027\203\377M\215D\341:\017\264\r\t\n"
+	.ascii	"2\241\241/\260ZQ\034&t\327\360\"&\234K\310\001\2504\322lx\327"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_getRcDeflection.88.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655P\215\322\001\204\222La"
+	.string	"\300\364\323O\204\3367o\306\001X\006\250\331E\241\264\177\032'\306\260\004\177CH\252\252\312\250k\306\215\241\312t\336\372\266\277\367\226)\005\240\317\203\347\365\352\\Y\274\020\242\302\307\223\020\257\f\024;\233b\013\007Yd\300\260,jR\367\273+9\307\031\271\b\b\177T\205\371_Pw\330\243\2416\031\326!\224\336\f\353\220\313\254F\331jS\242t\027\255\337]\251\315\2543\312\316wa\231\004\220\374\023\255\225\227\300\225F[\255\325\264u\032\325\221f~\213\223\310\177\202\n`\f\333\326'oh\255\352\2452L>aI\200\250\374\217\034\003X\f\2377\026C\207a\315\251\325\346\360K\251@\331H\"\347\305\340\177s#Q\270\316\003mC\002\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.89.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\235\007"
+	.string	"\362\21644pm\032\003 \\\215V="
+	.string	"\346\003\214\217\275\360n\310\001\f%\324M\350>i\255Q\004\355\250\227\221\342\216\376\257w\357T\216/\252\027'$B\266\224R\246\024\037\017D'\266\342T\327\254\022\346\202\247\2430\253\35339\232Z\f\b\327l\260\254kf\266;\036\222 \334\210\240D\204A\312]\376\033\324\036\376p\250M\226}"
+	.string	"=g\2265\bbN\242\327\265[\350A\214\326\361\220\324\276Wh\315~\021\300\342\204@\344\247\350Vn\"O\032m\2616\323\326\317ZK\212\371/4\222\377\005\025\270X\266\2557\314\201\265\\\334J&\243t\023!*\377\347\306\001\224e\264\206\262\204\031\306\374\260\332\035\216)%.\033\205\374,\007\377\373\262Q\205\013=\320v$\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getThrottlePIDAttenuation.90.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375 \360\205\006"
+	.string	"\242\214-3Pm\222\016\244D\f\202\215\252\245\035\225\341k\212\271\363v\250x9\242\027\313\326\336\024Z\301\215\240X\210\252\252\210\032\270\005\317Qu~5\3006\322\310\226)S\030\312zT\302cP8Xx\224\345\3600\226\253\006\004\353=T\225\365\246,\3338\330.\232\026\361\005i6\350z\206\370\203\305\352\356\037\251\016\033\200\205\006C\237e\260e|\243l\234/\216-"
+	.string	"\203\244\300$\223\"\224\222#Nd\343\277~\272\035\365\270\036\024e\035OK&$BP2\363]* \325E\265HuM\243W\361\272\375h\304\3219\3016\231b\305 3GlS\321[\177\202\177\340\277\b\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_getRawSetpoint.91.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230\016KtF^<\t\257\007u \233\f\242\020I\341E*M\361\333\030\252QCCO\353T\206a 0\272\032\002\022\227\360\324m\231n{o\231R!P\304\347\365\362\\Y\274\024\"\003\350\263\020\257,\024=\234b\r\tYt\300\260,nT\367\27339\327!\271\t\t\217t\225\371\177P\207X\344\241>\031\026B\224\336\fk\221\323\260H\331jU\243t\031\255\337\235\251\315\254s\312\316\027\200Z)H\371+Z/W\201\254\216\266Z\273i\353t\252'\325\374\030(\223\377\006\035\310\030\266\255=\374\241\265\253\247\3328\231\345\202\202\304\345\177\354X"
+	.string	"c\370\314\301\030:\rkN\2556\210\037\nG\313V\0329\001\020\3767\267\222\205\353L\320\266$\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRawDeflection.92.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230\022\314\357\217\216\001\200\220\260\322\030F?\3709\223z\"\220\246\370m\f\325\250\241\241\247u*\3030\020\030]\rA\304\270\325\220\215\027\375\275\267L)!P\304\347\325\362XX\264\024\"\003\350\263\020-,\024=\234^\r\tXt\270.,n\266\373\335\231\234\353\220\334\204\204E\252\312\374?\250A\034\362P\237\f\013!Jk\206\265\310iV\244|i\267Q\272\214\326\357\316\324f\3269e\347\0138Q) \371+^\\\236\002W\035m\263v\323\326\351TQ\252\3711P&\377\r:\2201l[{\030\225\265\252\267m\234\274rA1\322\362?v,\2001|\346`\f\235\2063gV\373\303\217\205C\245\225FN"
+	.string	"\204\377M\255d\341:\023\264-\t\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_applyBetaflightRates.95.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\335\006\215&"
+	.string	"\232D\374\016J\220\330Q:$\301\363\210\320\264\212\217\320\221\354\1774\224:\374\230 RN\007(\253B\301\0262(@\027o\266o\037\030\245j$pV?\202Ap\005"
+	.string	"$\0016\t\266\364\036\276\204\205\315|\275\207\347\217$\237\020B\b\221;\311\333"
+	.string	"\307"
+	.string	"\334"
+	.ascii	"\\\242<\240*\230\325'\341[\261\252\204E\221\223\024\r\350K{$"
+	.ascii	"\257b\225\212\207\266\240\354\026\301\320\212\312p\204\207\350"
+	.ascii	"\013\243\234\225\253\313x\357m\360\222)\364\024\013Rv\213\200"
+	.ascii	"K\017\254\220\207R\270\020\357\275>\274\340\366E\\pzo\023\026"
+	.ascii	"\361\336\240\017\363\240/\231\231/\344C\206\230\207\244\360\t"
+	.ascii	"\352\\WDH\310\334{q\266\317\314\227\344q\314\227\275\343CWc)"
+	.ascii	"z\232%\331v\210\177R\270M}\001\267X\035\275\270\272\323\204d"
+	.ascii	"\343\261\030\214*DK`MHKOk\240$\003&-\032\307b\244D\316\256\344"
+	.ascii	"\360r\342w\244\214\226\354\211\305\310\006\2215\223^\2560,I\343"
+	.ascii	"ms\024$m\367\336W\335\026\035\001\255=)\334{\331\3068B:\323\234"
+	.ascii	"\231\213\314<\304l\336F\270\004m\030\206G\331\371<\335{%0\217"
+	.ascii	"8\224\022\350\275\027\302\223\026&z\236\240R\230/m\373\360(\276"
+	.ascii	"\370&)\370P\314\353\331\307\350\231/\337i\323\0260\245\237=2"
+	.ascii	"\013\201\266\235\230O\336\326\301\334\363\253s\002k\371\306\263"
+	.ascii	"cC\360\251\377\300\225\234k\027\376\006^\344/\360#g\235S\235"
+	.ascii	"i\027\236\007X\3139\326\362\314Z\026`-\343\234\226\003\230\226"
+	.ascii	"o\254e\231\265\f\300Z\266\261\226kN\3134\246e\325Z\216Y\313\251"
+	.ascii	"\265\214Z\313\247\265lZ\313\245\265L\236\226\333\264lK\313W\240"
+	.ascii	"R\271\342\340\353\336\031\3072\327JY\374\361\253_\311\177\344"
+	.ascii	"\247:\311|\376\222\023\231UV\361!\377t\335{\261\256X\004M\353"
+	.ascii	"\")\277\341\3329\350\312]\313M\253Ha\300d\315C\353\001-\3533"
+	.ascii	"\371\250Z\245\200\246\255\001\364N[$+\023\320\036\273\230\210"
+	.ascii	"\261\202\3324\200\356'\227\264\265M\251\324\343k\215\002\226"
+	.ascii	"\355\304\267z\032\225\305\324\b\232Ik\240\007t\0213'\221\321"
+	.ascii	"\222\276\214P\t\332\260\232\266\365\267V)\232\256\351\323k5\252"
+	.ascii	"M\323':\363\263\307\255]\004\335\265~\272\324~\325}\260|\tR$"
+	.ascii	"c\2156\202\266\\+S\332\261\256=Y\245xx\233v\315\314\032U\353"
+	.ascii	"\263\321&\340e\240\315>\233\2742\233\266u\240\017t\331\207\322"
+	.ascii	"c\270J\001\207\317\321eJxy\302\361\030&x\357\357Fv\255\255\327"
+	.ascii	"*\005\264G\356&\233\346\265\032mw\337\352e\231\036UDg\354\275"
+	.ascii	"\367E\357L\333 \002L\342'\210\204P\216\207\003\352\361x=\035"
+	.ascii	"\001_OH\227\023\341\333\241H\301\241\207b\305\256\324\371\314"
+	.ascii	"\235Pn\303\356\304\b\240\\\032\004\242B\215\210\020@9\036\257"
+	.ascii	"gA\347\213\005\225X\221#Y\367\243\363\341t\"p@%r<\234\316\027"
+	.ascii	"\204\373\301\341\036\212\235\017'\324\353\371p\252\360w\362\266"
+	.ascii	"\016>\326S\250\255\"\261\236>\261%\303\344i\035\035\324\270e"
+	.ascii	"\005\314\370k\240\332N\374aL\232\323\037\240\240'>\305\221\025"
+	.ascii	"\005\346\307yK\320<\335\323\035|T\271%\350)\212\001n\241\232"
+	.ascii	"\022k'vB\004\310S\332:\230\331\336f]K\002cD+h\303\376\024f$\242"
+	.ascii	"\355Des\342\255RR\327\215.Yf9]z\t\350Y\037\247\005\364\0034N"
+	.ascii	"\353\210Y\215?{\344\233\016\320\307\372\205\242\217(Dg~'\216"
+	.ascii	"\254/\345N\237\310\302\"m\001\177\250a0\004\021B\206\231\022"
+	.ascii	"\031\221\2440\205t\220\002\03112z\021@)e\210\210\266\244(\351"
+	.ascii	"\332m\224\025\372%\205\345[uE\013\031\370ld\t\311\351\247\271"
+	.ascii	"N\245\235\267\203\326K\225\rb\245\340\361c\2421\200+L\022\240"
+	.ascii	"\017\3500Y\\\217\30651>\026a\203-\305\261|A\320\225[\177'I\026"
+	.ascii	",\334E\2660l\206\323xDZ^\225\273\220\231o]\032\255Q}\027\270"
+	.ascii	"\030\262\361\261\364\276/\272\376\275,\034\017\217\246u\342Y"
+	.ascii	"A\022\027\\\016\023\374)\006y\377I\034\313A\330\366\221\0270"
+	.ascii	"\342,\321\213i\336\302\210A\030\205O\213\236\261\323\035\326"
+	.ascii	"B\313\320\026\024\3351\240G\356\024\300+\357\267\315`\241\231"
+	.ascii	"\357\356\n's\231]V\177Q\203\216\013\232 \205m\357\247k\374\324"
+	.ascii	"&\"t\024U\003?,'\372\340Pi7\275\236G\007\031\036\305A\336\255"
+	.ascii	"\371JS|)\315%\223\303M/\007\264\031\264m\021\350\214\020QH\307"
+	.ascii	"\026?*"
+	.text
+	.section	.gnu.lto_applyRaceFlightRates.96.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\357\002\255\024"
+	.string	"f\346\205I\260\224U:\371\fm{\227\215\251\333\230(\373p2N\252w\344\3715r{\224(`\355\231B(\355\375\214x\016)7\021\255@\322J\317\037t\256\364co\301\362<\267NG\211[?\273\332\310\251m\323u\263\204\020)S\np"
+	.string	"b"
+	.string	"x"
+	.string	"?\247l\373\f4\325\210x\355\216\222\220\346\234\b.\272e{\034\302\326\374\2403\241@y\006\362"
+	.ascii	"24\347\\\361\201\353\201<\3704g\n\034Cs\332\254\230\200\351\242"
+	.ascii	"m?\306e\340l`\310\333\341\371Q\221\233\037\2219'9\340\256\361"
+	.ascii	"b\370\223\361\342\2668\356\212\363\377{\350\343\003\304\311\251"
+	.ascii	"\271\226Z\346\234V\234\034\235{o\333\200\355\t\366\316\00481"
+	.ascii	"\343\305/\253\227\364S\"\247\245\315\253\321ea?\234\273\302\206"
+	.ascii	"\275\367\247\334w\243\234w\277\316\373]\007\372\001\250\332D"
+	.ascii	"\325%\252n\251\232%\252W\252V\251\232dT\247D5J\325'U\233T]R\365"
+	.ascii	"\250jQ\325\341\250^Q\255\241\372\001V$|\220;\346\fQ\032\231F"
+	.ascii	"b\360\305}\277\215\363\003\251 \355\276\037\263\347p\200\332"
+	.ascii	"\004:\345O0w\332\327\352\317\264\247]\241\335\t\025Az<\be)\244"
+	.ascii	"\264\246\375\256g\334pK=:\340\2556s\346\n\210;\256\312\220\035"
+	.ascii	"\f\327\272V\\\001B\273\036\235\226\336\r\027V\264C\322\335\375"
+	.ascii	"MRN\313\n\277A{\320\316\234\263\201\375r\033\030Ls\316\0055:"
+	.ascii	"\324\036\354\360"
+	.string	"\320\214\027u\037\344\"\370\031\247A\343\363\330\026\243\017\263\231\030\205Y\006\032L\354$c!\202\312\345\002L\254V\263I\220\335P2/\033b\241e,\262\033)s!a^b5Rv\223!YNl\3230\273\22136\333\215L\361\346m\330\256@\2140\312\255\316(k\262\260\375\221\2225\331\360\327\332\222UIY\326\266v\374\255\226\265#\321\016I\007\355=d':\321j\031\350\224E\2029\024&\325\242\354\213^K\262\252}jI\026\366Cm6 \240\002\231\262\352\006a/\024\026\3710>\nn\330pC\367\005]$\303\321\222\223\r~\007\357\t3\330W$\334\312Jl\034\245a8\232av\256\326\304\003\276\312\224\345rd\356\b\264\230\210\320\235\201\021\024\310/X\265\253\330\025\366v~n\013Y=\3242\302\325\225\023%BBpOt\332H\274\215S}\220\007\021\3339\304\n{\206\025D\260\306\343"
+	.ascii	"\006\024~yL\355\"\003"
+	.text
+	.section	.gnu.lto_applyKissRates.97.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\b\005\255\036"
+	.string	"\226\267\303I\220\026R:\004\201a\205'\f&\247\215\251\301r\217\240\203\237\333 \364\023D\026\340\373\007\350\3706X\314Y\277\277\344\250c\313R\356\323\017"
+	.string	"&\030\267\006#yN\236k\006\271\231W\347\262[\247\344-\374\253\375\204\220-S\n\261"
+	.string	"\221"
+	.string	"\270"
+	.string	"/\342\034\327\t4\242-'\201\2125\265i\351\251\312\202\226\223\306\263\027\022\260\220n$R"
+	.ascii	"`\222\202\201Vk=p\323\017\350\025RYS\233\210N\t\026\351\244\022"
+	.ascii	"2\260Z+\002\027\370>\310\b\343j\245\261\005Vk\021\201\t\334n"
+	.ascii	"\332\366}\374G\222\235,\221ST?sZ\312\362Rk\345\001]\347\274Y"
+	.ascii	"\036\347\274I\245\236t\263\244\233\344\277\310\203\204|\021\317"
+	.ascii	"\270\216$nN\270\341\005\210\024\327\261\305K\335\261X\002\325"
+	.ascii	"Zs\307\022KK\003Pd,tGb\251cV\303\312\277\276M\307\022\273\266"
+	.ascii	"\007\265V/\323Q\305}\336v\317\266\223m\322\004\301=S\360\274"
+	.ascii	"y:#6\304\352Ii\327l$qi\224\375\262R\033\366\261\356\237k\335"
+	.ascii	">G\376=\337\272yv\275\363\253_\300\271\356\335\203\374\001v\255"
+	.ascii	"\263\353\234]\343\330\3267\347\332f\3275\273\246\331\265n\327"
+	.ascii	"3\273\226\331un\3271\273\306\355\372\266k\233m}\236ks\327\245"
+	.ascii	"mM\317\365\232\353\017\320\3650[\220\245V\024k_j\231\031\206"
+	.ascii	"\343X\277\326\277\365s\275\264\357{\375\313\316\031\304\273\214"
+	.ascii	"\023\353\342\001\302\316\335\274\235\344g}\310\211\004U;*Cg\350"
+	.ascii	".M\206\236`zh\017\315\321\357\260J\356\360P\035]\3043-&D\223"
+	.ascii	"F}J\r\r\254L\332\336 \034\365q\261E\bYq\325\326H\232\331\fJ"
+	.string	"\243\264tO.\246@\211EyR\\5\343\250\223\337\030Z^1V\021o\024G/\200\332\350\215\376\2446\272K3\351\271\344w+\276+\271\224)\2232X\321e\025\226|\215*W\310j\007kk\\\212\265*\005\225tG\327\313\230\203\270k\246\264\244;)F\264\245\224~)\214\322\256M8\222_\203)\265\326\005\266\206\037!\272\325Z\025\210\211\340\240`\n\325\321ysi\003*a\007\273\221#\237\312\300\336 4\334`\324\003\362\212\202@`\320\2673\364\373 <\212\340\023\336\206?\243\036\205\337\260\002\222\007\032\n\272_\007\rE\020\206C\"\016\270!\006\b3C\031\212z@`0\202O\0303$\n\321+\355\023\362\ty\276!^\021Q\017\310\363\t\207<!\034\007=\374\204<\243`P\310\313!\225^Vj\303\027\272\2241\364\302\330\277\216\223\321\244J-\271;\264\311\366\017\325\235\260*S\242D5"
+	.ascii	":\364\307\207\362P\035z-VI\2149\210D\0231\312\260\344P\037z'"
+	.ascii	"8\264\206\346\334P\034\372\223eCo\240\374v\254w\263\375\262\241"
+	.ascii	";F%\214\206\316\320\032\272\343e\204\322Q\032\312\223\266\323"
+	.ascii	"\321\036'\306Y\250a$\004\021b\n\231\222`FfK\2529\200\002\031"
+	.ascii	"\262\242\036\021P\245u\210H\342\332\2055\316}B\315\267E?c\370"
+	.ascii	"\220l%v\023\nJOG\312\334\2273\r\201\264\355\200\006\233e\bh\363"
+	.ascii	"\3655\256`\330i$\205`&\233\177\355=\257\225\004\203\337\3433"
+	.ascii	"\032\013\037\3405/\260\313\313f\241\262\006D\2263\022\211\036"
+	.ascii	"\306\250\316Zf\201+;\362p\002!\237\331_\375\337\310\023X\231"
+	.ascii	"\315\260\343\356\340\202\373\307\350\t\3238\017\375>|Z\310\030"
+	.ascii	"\317\225\030\325\376\310H\003k\021*\253@\273\326\341\250\274"
+	.ascii	"j\\z\355@\f2\213\032\342E\030\333\315\256\326\307\200\np\316"
+	.ascii	"\301\247\025OQ\345V\247tO\306\177"
+	.text
+	.section	.gnu.lto_applyActualRates.98.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\311\003\035\032"
+	.string	"\326\360\251I\260\226Q:\264c8\2748Z\203\031\206p\304\306G\340\013k\343\273q\001+1\240xa\264\034R\334\364\300\215I\363/]\237\364\303l\207q\n<\3759y\375\262X\322y)\345\214\037\265\246\273\231\213?\332>!D\312\224\002\230"
+	.string	"~"
+	.string	"\234"
+	.ascii	"B\250L\374T15\n\216\254\033?\256\223\267\211\374\247G}\3120)"
+	.ascii	"\023\203Y6\254\\\200\032\022p4\233&\220\224\226&8\r\271\212P"
+	.ascii	"\330\bi\340\2602\347<p\322\020\266ih\234M\023\300\244\004:4q"
+	.ascii	"\311\223\"sN\0046p\375\017\022~\315\t#H\2219\217\020x\200\353"
+	.ascii	"\244m\277\307}\020\331\304qXC\351"
+	.string	"Y.\220\236\272\3149m\002\016\240<9\236V\236\\\032'\272\022\371\237\372\250\243G\2240E\321\265\005a\316i\025\246Pq\357m\027\260\255\301\036\025\004'\206\360\225\334\373\240\027~(O~a@\220xaa\244E{X\244;\303\3768W\206}\247\233G\325;\247\272u\016u\347\340\274\351\257}\370\337\\\352\266\371\217\037\200\252i\252\256Q5\215\252g\245ZF\252c\252\236)\3252\244\0326\252cT\375R\265K\325-U\227\252&U=\226\352%\325:\252\037 \206%J\203\2509O\024\277\314+\262*\307\251~\247\037\352\227\372h\337~\020?/\\3\233\263:Dfg\266\246\005\2662N\202\0365%\303\233l\330=\200\355\243\2500\211Y\231\024%;X\324\366\2658\256-\367\265-\254`\213\233m\255kkC\202L&^[[\323\022\\\262Yr\313-\261dJ\336I\312\233\265q9\275\220\334"
+	.ascii	"II\256Jl\221M|\214*M\303\351\007\305b\226\2439\215\b\214k\263"
+	.ascii	"\267\n2\001\265\350\335q[VA+\272\273G\nc\244E\013?\022\344\263"
+	.ascii	"\300\326\275\212\203k"
+	.string	"\316\351cd\304\256\247\306\234\363J!\312\223\272>6\252N$?\031\024\250\347AD\216\034\372\351@\350~:!^\256\202/\367\343\345p4\271\337\215B\256C\020\357\366\022\372\2110\003\244\201w\333\355z\022p\276\030!\235\210\333h\\\017\316g\303\001\331x\272\333\316\206\363\t\331zh\356y\310\371l\277^\317g\203\r\347\307\2712x6\226t\345\312h\201\246m\315\362\264\330Y\234\245m\r+\310t\2635\373\251\223K<\270\004\231\200\266\225\200\316\356\254\003\253\340\226\234\245Y\235=`\025\\\002\316\226f/\333\3312x\212\255\354*h\2350\034\212\202\211\355\205|\274\262B\211\227C\250Q(\004\215S\004\231###-(h\241\003\240\002\221*\253\007\021\220!fE\232j\337a{\021h\212\324\f\366\324\373\3509Y\374\3447E J\266\0343v\007h\347\374\265\263\r\373g\255-\334\340\325\262\237{"
+	.string	"\264\373o_D\bp\220\300T\004zB\3608\227o\311n\246jpL"
+	.ascii	"G\351i\334~D\361\227\020\224G\216\213\303q\222\272=3[&\204\320"
+	.ascii	"\352LB\343\030\021\214\017\017r\255\3637`\201\300\241\033\220"
+	.ascii	"\335{^\f}\266AL\023\276V&\245\247\001"
+	.text
+	.section	.gnu.lto_applyQuickRates.99.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\033\006\r%"
+	.string	"\352D\364\016I\200\234Q:\333%^(\354c\231-\t\200\273\267\242-\315\341\363s\3608\365\331\\\031\315\030\3000g7'\217YD\007{\310\245i\363,u#\302\355'`d\271\272\243\260,\257\024\267\215\260\035\350G\323\2545B\210\334I\006\340"
+	.string	"\277"
+	.string	"\334"
+	.ascii	"W\216\345V\327r,N\225*rC\333-2A9\336\213\\\312\362\253\245'U"
+	.ascii	"\310nR\326\304\024\005v/r\205\354\247\315\376\206V)E9\376\250"
+	.ascii	"\246\300>L\361U\256h\273MLT\307\016R|\265.\261`\240\242$sA\003"
+	.ascii	"(\206\221*\260{\257\202\237<\241\245(\231\266\333D\224\321\300"
+	.ascii	"\"\371j\213+y\357]\300\bn\037\325\202g\367\006\271\222\274\267"
+	.ascii	"\270\200\211d?\231\231\377\344PK\314W&\322\t\311\227O\230\252"
+	.ascii	"\270\271\367\356r\377A\177\232\277\241?\333\310\227~\232m\227"
+	.ascii	"\370\307\272n\312\222\270\2442\272\370\251!\211\033,\035TF\034"
+	.ascii	"7k\306\242\231\273\367\246\306\027\266\315\004>\300\334"
+	.string	"\250\031\211\346\317\030!h\256u\333d|aml\302\275\227m\fc\2153zfV\231Y\b3\232\006\347[\307+\314\233\035C\033\306\214$\332&\302|\363\366\020\346S9\0338\362\327]\352Ld-\027\370\3249w)?\201S\235\007\274\352<\364\344\0317\263,\340[g\241+\317\001\036\365\007Y\313@\326\362\217\265\354c-\337\254\345\036k\231\307Z\266Y\313;\326r\315Z\326\261\226\001X\313\251\265L\263\226g3\313\262\230\345\330\3142:\263|\306,\2332\313\035\263lQ\313?\260\343c\214\204\345\2753\302\342\\1\247R\311\267~*\277\324?\365S\375U\177\362W^\306|\346o\341w\341t\213\263~k\334\303P\263\214\372\232u-\346\224\223\276\205g6\276\334$1\247?-\363\022\277\312\255<\215\263Z\237z\032\307f=\016\265\255y:(\215\255Q.\002M\240w\3729\240\270\254O\265N{"
+	.ascii	"\255u\272\326AY\253\027\242\005\320:\035K\263\036\323\2465\200"
+	.ascii	"\376\352\005\355\264\321/\\\323\372<\240\254\254`W\027rF\n\362"
+	.ascii	"rQX\330\232\342\275C\335\254\207\332Z\311z\326AiV\260X\313\372"
+	.ascii	"e\324\"'\020_\306z\307\253\353\215R@\343\372X\357\371\022j\264"
+	.ascii	"\005\364\3276\001\032\355\b\\\264s\026z\266P\343\344\230}\366"
+	.ascii	"\311\2506K\210{Y+\357r\023\013\253\313\211rx\025hw\200\376\372"
+	.ascii	"D\264al\273\333~1\315\031\332\260\f\027\243\026\225\271\367B"
+	.ascii	"`\346\275\253'\273\367:\b\303\202\304\003\247{\357\221\b\321"
+	.ascii	"\237\266\213\314(\377\345`\204|$|d\302>\206\t\364\001\\\202\201"
+	.ascii	"\260\004\222\352\333\375\200>\037\220'\244\206\260\274 \312A"
+	.ascii	"\203\205\025\252\017UB:\n\252\275\337\321\211\031\211#\243\037"
+	.ascii	"\260\302\005\236^\212`\022\357\f\002\221x\252Q\260\207\"I\230"
+	.ascii	"\366\220\324\r\275\023$~\352L(\202\202\216\321\210\237\352\363"
+	.ascii	"\001+\360\2024\341\321\n\325d\036\003^p\3073\332\375\216T\337"
+	.ascii	"\216\027\024\356\030\334\030\210\242\027\334!\001\201\301]\212"
+	.ascii	"\034\276\207\260\2076\346O{\320\272\326g?\276,)\242\304\026\350"
+	.ascii	"&f6\320\265\031=\304\f\233\310D\r\324\006t\2356P\377\b\265\\"
+	.ascii	"\237\n\020\351\230|MYJy!\236M\344Np\300\222f\017af\253\363\351"
+	.ascii	"\241\034j\246\200)Z8V\013\2331@\272\211\310ir\304\364\351\035"
+	.ascii	"9\312\034\301\342\025\246h\341\260\317O\233V\3531\327\003\332"
+	.ascii	"\247\277\006\252\353\326<\235\353s\255>z\372\026e\250q \246\020"
+	.ascii	"B\304!E$\"Ma\241\320\001\200\002\021\262c\035\021P\245f\210\204"
+	.ascii	"$vZ\f\376\"?\b\337E\231\203\nc\357\003\033\372W\364j\336\231"
+	.ascii	"5D|]\221\345\200\023o\006\004\263\374\334f\361\"\311F\257\353"
+	.ascii	"\333\234Z=\261\272\360H\n\230G6\313\301\360\322\241\306\370\233"
+	.ascii	"\3458\374\314\334\367\225\323Oa\276\266\271h\nt\016\202QK3d "
+	.ascii	"\033\210\222w\365\316$\213\337*Os\t\2403\024\313\"\257\245un"
+	.ascii	"\t_\235pSv\211M\357\362\304\037C5\205\271\013\3336\316@\351\311"
+	.ascii	"\253\023dM\252M\254\337r\007\2435\322\341\2510\211bo\226\354"
+	.ascii	"hr\224hg6\343%\3269\037\245\013!\333\314n@-\341\242C}\236\037"
+	.ascii	"\375&\210E@\256V\274\255\326\021Z`\354!\370\017"
+	.text
+	.section	.gnu.lto_applyCurve.100.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"\335\n"
+	.string	"\226\024JA \2138\035H\361\n\003\002tC\357S\221.\373/8w\300\n\235\262\305+\034\230\003\214\332Rlf\355\b\353k)\221\237\004b?"
+	.string	"E\200w\004\030.\237\205;V\363q\004\230\2655m\"eJ\0017"
+	.string	"6"
+	.string	"6"
+	.string	"\366\031\274\201g\243\2540\001\351\0330\004\210\240\332]\255r\211\353\321:\345zT\004\367\236\236\377\323\255\222\203\f!\321\347\t\261\261\273\316\220h\300\255\267ma;\303>G\231\306n\372\257\207\177\314\264f:5}IDI\203\206\205]\001\253\017\233\212\024\026\330\366\354\211\355\f\215\272 \341\342y\223+8\3335\240`\302\356b\230\002{\264\003\023"
+	.string	"v\277\n\325L\235 \016`\256|ej\324K}U\255\200\364\343\250\251\007\251\376\340\020F|\222C<\371\220\347z\274f\004\276\\\331!\230z\300\276\265:\312\002\033N\323\3310\036\031L\207\204\243\021\271X\336,[\247m\031m\243\271|h[\307\321,\024s \230N\353p\\\247M\302\357\326\352\b\323\237\236\005>\005G\231bzu"
+	.string	"Q\367\220Z;\023"
+	.string	"2\241\247(0\007\r\020\340\r\032\006\b\201\0307\245\320S\006\306V\327D\242\211\346\257\247-\306FP\016\204\006F\004\025p"
+	.ascii	"*\217\251\235d"
+	.text
+	.section	.gnu.lto_initRcRateCurves.101.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`k\004\225\033"
+	.string	"\226\363\257H\260\230M:\200\356\3410j<\026\305\200\271\020\215\305\336\306:\202\231\013\205@\321\1778:d-\2624\303\337\266\227\266\300.m\256\232\341\024\376\224\376\224\3578.\224\017\371\241\1776\322\035\032\333\f\304j\303\210%\204H\231R\236"
+	.string	"\217"
+	.string	"\236"
+	.string	"B5\0240\270("
+	.string	"\3423-=\375\262\022\214\367\341\373\374z\350\377\270R\317{\236\032sB\343\357W\005k\316I\363\320\007\306\2073\217\021g\342\303\277z\354\253\373b\314\377\250\3744e\3159o\013\303f\263\201\336\203\276[\334\236\267F1\004W{\374V\205\036?\340\224\004\210\227{k\034\372\b\312\346\234"
+	.ascii	"x?\340\003[\016\241\"\025\211\036\202\307\232\302\003\300+\001"
+	.ascii	"NH\261\242\312\231\256A\274\235\2028\206\276\367}\201R\t\304"
+	.ascii	"#\272\266*\3149\255@<\025\267\353\266w\330\226`\203:\001\b\276"
+	.ascii	"\263]#d\216\235\226\216\355\367N\017]\364\240H,\235\226\273X"
+	.ascii	"Z\214\266\354\"\331\276\234\206\272\0275\274G\266\214\252k\177"
+	.ascii	"\272c\336t\323\376\273g0\252\226}\351\216\275w\303T\375R\365"
+	.ascii	"\213\252]\252\036U\335Z\265\250\352p\325\240\252w\325\252\352"
+	.ascii	"\023\200\031\252\232\220e\316\024e\227I\025F\335\370\323\337"
+	.ascii	"\364\377\376\245\277g\177\210O\304\257'C}\252\230Je\365\353\022"
+	.ascii	"!\210/\344N~\375H\314\370\310f\320\217\226\244\006c\023\2111"
+	.ascii	"\027"
+	.string	"\263\275\221\313\326:n\270\256\035\200\205L\332\265\226&\356H\333\326\236\314\322i\331D\334\027\221QT\333\032\270\341\022p_+J-E\273v\206+1\224\001)sN\b\2661<IN\001\234#\321  \306\2343\202\324\2476\3704\036\032\347\301\203\370\020\304\002dE\247\245E\235\355lak\335\335\031rs\366\217<j\204O\303!x\364@\017}\036\361\241\322\354\312\035E:\215\331\332\322L\221Wb\366DnA\252\027\2054\332\235hAu5[\332R`B&\031\352\246P\226Y>s\352\0025\027\224\003.\007\204\315\215\016\316\r\206\027\036\234\316\346\374C\216\210\032\3206\016lvn687\01695\033n6;\037n\016f\306u\270\331\271\201\300\341vn/\337\374\036\371=>F\261\240\322\355\256\265H\376\270G\216\315\bav\255\224\346\260\006\207\255\332\240\235\310\351\020a\013\263\367=\224R*5"
+	.string	"Ye\"\\$\273x\254\314\2063F\232\3076\310\266m\367\224\030\333_1Y\371\350\226\203\240\031<\2662{\246\207D\275\037i\364Z\373\346UTP\236\274\254k_K\300\t\271\244\266\262}Q#'\244QR\250A@\303\220B\306 \233\tD\0246\205\351\260\002\231\272\232\003\021p\261T4\245Q\206\375\r\"\314\335+\007\017\026\n\310\033\334B\261j\210\360\302\323\247!\ts\th\210\223\t\231\216\032\237\356\356\245\223/Q\027\226J\3668\373R\204\345f \031\334\201l\304\350\037\261Q\036\201\356\025\365\fa\032\035*\304v\027\021#E\254U\230>\251\030F\304\262\337\020\024\216"
+	.string	"+m\310HY\270\222 x*\273\002\037,c\363\036\f\323\232k\301\367\037F\217\333,\303\316,\2218\240"
+	.ascii	"\302=P\233\021&\031\370\224\315)X|1\273r\360/\245\216'\250"
+	.text
+	.section	.gnu.lto_rateCurveLookup.102.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`#\b\025*"
+	.string	"\212Lp\020Gp\032R:\002\n e\022A\n@\343\210\336\224l\247\366\323r\353\334\311aFn\024@\020D\004n5\335r'\034Y\323\003\263f0\336\006b\277\224\007j\033@\377\376\251n'\333\343\302\262b@\377\223F\b\221;\311\373"
+	.string	"\325"
+	.string	"\371"
+	.ascii	"?;\363V~\345j_c^\226\032\036\260puH[\361\273j\351l\024\351js"
+	.ascii	"or\003\232\217\fK\257\013f?,(\255|D\0017k\306\227\222\ndV\305"
+	.ascii	"\"E&La\246z\245\005\264\276\031is\357]:\312\022Z\312\303\204"
+	.ascii	"\027\343\245\220\200K\f\233\201vo\222\001?H\252l\223\314\324"
+	.ascii	"\362\005\351\366HVc\335\275A\224h\367^\006\214@=\312\314\374"
+	.ascii	"'\207\"df\236\311\257#\2712\0321\306\342\356\275@\337\177\322"
+	.ascii	"\243\347{\351\321&r\341w:5\227\242g[!?W\201\253\n\\q\353\352"
+	.ascii	"\273\007\271\301\343\272\363\327&D\315\335\264x\234\005\274\330"
+	.ascii	"p|\355FG\255.\253\356\266t<\367!\327\323\225\267\025\303\242"
+	.ascii	"nZ\\\247\357\336\013\303\2368\336g\257\313\254L\317\026\361\\"
+	.ascii	"P\006\214\307\327n\263\266\260\254\315U\270\367\262-n\3358\363"
+	.ascii	"\316\314H\230\031\004\263* \007ZIm}\203e\233l\240\207\372\\\216"
+	.ascii	"\201\t\231\2345nh\233\314\311+\333F\346\237\267\2070[\313L\027"
+	.ascii	"\373\227\224NvN\272\362\254\340fg\244/\317\t\216v\376=\355|t"
+	.ascii	"\344\217\340X\316F\267\354{\227s\321\263\234\211\254\345\003"
+	.ascii	"\337r\036z\3627`-\013}\3129\310Z\006\262\226\177\254e\002\326"
+	.ascii	"r\317Z\366\261\226\007X\313\001\254\345\036k\031\200\265\314"
+	.ascii	"c-\363\254\345\235\265\254\263\226Uk9g-\247\3262j-\237\326r["
+	.ascii	"\313\326Z>\320\307N\233\006\270{m4\355\3340hZ\222w\371\267\374"
+	.ascii	"S~\262_\371\233\375\313\037\355O\373\261\374Y\316c>\233\332\357"
+	.ascii	"\215{\031no6\370Z\370\\\230\267\205\231X=\320>\250G-\263\220"
+	.ascii	"O\345e\257\022\001\032U\3735\200\356\3612j\236\006\320\347\330"
+	.ascii	"zLj^\363t{Y\275\024\264Q\363:\204\022\314\256\223t\255\366\256"
+	.ascii	"\033\316\252\344\376Z\327\347\232\365\230T\273J\311\\\217\271"
+	.ascii	"N[\301\211\324\271>\311\254\307\004\375\353\264\245\224TV/\264"
+	.ascii	"\317F\222c\245[\302\214\003\347\r\332\2777\344\320\351n\316F"
+	.ascii	"\3370\347t'\200\263R\317F\310\344I\275\367\252\3359\"\263\tr"
+	.ascii	"H\241\331\214\263\375k\313&\236\306*G\\\306\335K\214\200\346"
+	.ascii	"-\212'f\026g\346gV\244Gm\347\210\3139\310\341\311@\375^D~\314"
+	.ascii	"\t\bB'\027\023\305\364u\357\225\320v\267 \377\310QVAe_\244J\217"
+	.ascii	"\036\265\2132fQ\307\233\250\215\332\236\255J|\375\323N\031\225"
+	.ascii	"\265M\321Y--j_'\235\021uQ\237\355\030t\2205\327/C\236\003M\324"
+	.ascii	"_\273\317\331z\304b\236-\361\336\341\321P\007M\"l\212 T\025\024"
+	.ascii	"UPJ\255z\003)\333 \312:\210\262$\336\364\021\177Z\201\242"
+	.string	"\211\005\372$\025DA\205\246\bBU9=\241(\361DbG\005\325\242\351d'&\247)\240S\t`\n\250\246(\240\323\024\025\220\251\307A\251\247)`U08\005\344%\357\317\333C\330\252AmuL-\324Y\314,\324\276ac\235\273\240f\352\325\315\3206\177+p\332\200\350\332\310/v\324H\243r O\245\016\352,6\320\034\214r\302\330\32462\263=\352A\305\27409X\227\331\231\\\033\3236r\235/\365\220\321\314\275\367\nm\343\2340@J-d\214\022\366\205h\351\234@\315\267#\374b&\317\031;Vt\363\323@\235\336!\320?\235\236\365\232@\243k|z@\367\372<[\275nR\3734:\266\036\223\274\036\320.\224p\353\021\313\226\001\353\262\322m\\\246K-d\004\013CC\264t8@\243\255\324\367\322\323\001\200\220\250QD\304\220R\246\244F$\005)H\n\035\300\002\221\251\252m\021"
+	.string	"\255\204\016\211\004B\233\024\2469Od\301\257a\032\311\261\302_\006\301\201\376k\342\035\031O{\026S\017H\351\210,E[\342L}\234k\003\032\224QM\203\200\315D\217\326o\273\366\214\013k\020\334\351\255\366\211\367\b\307\302\350}\201\315\2669wIw=B\f&~\225\353\2174\244]\324w\240\217\013{,\214\336\027(\003}\003\346\335\3070"
+	.ascii	"AD6QJQ2\373l\332\254\347\336\343$)R\371\363\325@L7\261\203\261"
+	.ascii	"\364\352\274\245\363\007\004P\001\037X\252\216\276D\332\334\006"
+	.ascii	"U0\307a$;G\210l\355}\225\211\244\305\265\242B\256\232\227\263"
+	.ascii	"\216a\016\247\347\243\005\316\275\311\324xu\237W\310\344t\352"
+	.ascii	"\260\306\310!\017\316>\307cb\266~\277\226\337\304\310:\213\227"
+	.ascii	"\353\241\256\253\351\3652}qlm 7\006\021\024\360\355a\223\335"
+	.ascii	"w\363\2352\343\341#g\270\345\006\\?Y\311q\251,\371\037\303\024"
+	.ascii	"a\226vS\240\363\007"
+	.text
+	.section	.gnu.lto_getRcCurveSlope.103.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"u\n"
+	.string	"\306SH? \305j: !p\001\344\006 u\251CI\361\222\240m\f\007U&b\241q3\274\321\261\030^F\304\265D\277\036L~\246\021\0050\t\230\007\304.\340Q#G\204\366g\314\307\337m\357\224\0024"
+	.string	"5"
+	.string	"5"
+	.string	"'\001\355R\033?@\0363\271(1\260\273\333\346\006\226W\355\032\313+\3658\370\t\372w]\023A) \246\302\317\313\303\356z\212\251\214\233\336v\202\355\006\373\234\273\030\263\003\013\253+!'\177\033\364]\316\330&]bB\324\301)v\"\333E)\274\232a\216.\005\224\234\317\267\034\300\004\273*\226\312\356.\030\001\363j\333g\005>\371J\351\213\300\310\206i\316\\\347_w9\005#R:\251=Q1/z\002\320\200\235hh\217\341\244\035\366\265\335]\323U\375\370\323\267\376y\321p\f\200(\003\335\310\013\221\252\310\003\225\270.\364\351\"\nH \n\217f\256\303}\033\367\331D \217\304\306}\244\255\243\2617\352\276\255\344y\337\226\031\367\332\322U\245\033\023\265\260KmW\345 #\347,\020"
+	.ascii	"2Co\r\254b\241\230#\034s\023F\327\250Tq/g\366$\202\204 \f\001"
+	.ascii	"j\200\200`XP\241\r@e4\265\363\t"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.104.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\273\004\035\037"
+	.string	"f\270\306I\220XN:\304 \362d\342\370a8N\206w\221o\365I?\003+\221TO\247\370\222h\217\250\243V\322\312\326\376\314\031R\233\024\352l\233L7\235\016 a\234\004\"\343\027\3003\373![\377\3511\323\032!\204\354-w\222\001\252"
+	.string	"\244"
+	.string	"\270"
+	.string	"[\347b\306\261\2143a\tC$TX\367^\234\ff\334-}\221q\314Ld\243\271\364\344\023d\243B\346\336\273\340\226\023\230\267\314|\312|\254g\371\256\305e|\336\353\303\030\345\336\333\200\017\230\267\005\336C\336\326\007 o\331\307,\346D\253[^\031\233\272\332\356\275\271\016r\337O\263$mm\352\343\277\370S\b\265\364\323\200\017\033S7\257\345i\252x\003E\236\244h\231\343d\220\253\211\332\250\327\033T\324\273*\240\272r\003"
+	.string	"\024S\355I\373\021\346`\247NP@JK\n\367^\246B(\033\347\333\231y\212\231S0\327\"\001\364\370'\027c\243y\357\215\300\017;\024#\376\360\226Y\360\350\205<\362\366}\036a\223d\354G\217\027\"\244B\353\256bz.#s\372`\327\321\242\325\303\214\032\033\023U\303L\004\322\256b~\275\r\204\271R\006:\361\374s\2573\317\216\316\265\376\234\177\235qL\3127%e\\\245|\253\224\317J\331<\345\222\244LZ\312\266R\256\225rW\312\264R\376"
+	.ascii	"\006[\250t\\\235\265\027\342\255q\\s\321\354\330\220{\375_?\361"
+	.ascii	"\315|\3463\34179\330W\023[\333\004\363\326+F\001&\342\035\216"
+	.ascii	"8#b\2659xM\306\336i\234v\372\341:\225\302\26165E-\213\331\267"
+	.ascii	"~\260L\331fwY\220\f\331e\277\251\r\027\f\224\2143|\313\006\363"
+	.ascii	"\336\013AM\211\003\365Z\033\276 o\311\246dlc?\264\247\275\360"
+	.ascii	"\360\341\003yk\373\305#\2401DB\225\305Co<N\3474\263\b\022\364"
+	.ascii	"\302\237\3661\313\201\026\354%\346\301\302F\002VWJ\224h\270\322"
+	.ascii	"H\361t\210\255`\033NWa\243\317\332\331\251\230\320\355v\344m"
+	.ascii	"\311uLckw\353\230\021\261X=q\262)\335\347\2216T\n\232\264\036"
+	.ascii	"\265\253\372\275\323\335\025\254\002\244G\346G\271\0246\362\207"
+	.ascii	"\254\202\305X\214\274\245\335\340J\352\027\274\"(i\205\222\216"
+	.ascii	"\227;\352\361x\275\235\200[\022\n\241\242\024G:\036\2577\264"
+	.ascii	"C\302!R\322u j\241\342Hw&\031\301\320U\336\005\355\220r\273\242"
+	.ascii	"\334\221\221\216\227\333!%\345\202\002p\317\005\021RN\251\327"
+	.ascii	"C\312\341\210\277\327\333@\030\204\021\264_\003\317\0332>%\017"
+	.ascii	"\254\304|\214/\313\267DHHX\346G\217\374\3237\375\342sQa@/^Y~"
+	.ascii	"\364x\263\253\230\204\031y\236<\254\020\351b\264\267\006j'\376"
+	.ascii	"\020\211\353\242\255\1779\230\241\n\026\350\205\026\310[\\\333"
+	.ascii	"\256\260$R@kl\344\361b\202/\354^|O\023\240\232\2232\245\331?"
+	.ascii	"}6\323\340\031 \331U\374\035^UG\303\f5\001\\\250!4\344\024D\212"
+	.ascii	"\031!\021)H\2012\034\220\002\031)\263\016\020`v$I:_\220\300\243"
+	.ascii	"\247\2512\23472\310\233\026\035\337\334\240\351z\307\261\f\236"
+	.ascii	"+\222\273s\\\273V\032\003\357V,)\036]\230s\337\223&d\321W\227"
+	.ascii	"1\355u\207 \253\275Z/\003\262\374\217\255\330\005\b\202\323\213"
+	.ascii	"\364\353T$\334\276\370d\202\013\307\220\223\364Y>\242{[\357["
+	.ascii	"\275\330\204!\257\360\232\206\237\204\371W+\226\374\3742\363"
+	.ascii	"\335\bF\3662\251\276\374mL\264x\236\232\260/Q#\360\361u\344\265"
+	.ascii	"\302 \310\252J\314\260\267\037q`j\335<V\025\256@\024\f}5\300"
+	.ascii	"\017b-\263\013=\036+\301h2\257_\274\325XY\r"
+	.text
+	.section	.gnu.lto_scaleRcCommandToFpvCamAngle.105.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\022\004\315\030"
+	.string	"\006\356\233G\300\030Q:\360'\016A\200\225)\202B \fR\2160}_\3009\032\302\001G\r?#dL\027\234\210\326\246\307|A\315\320\\nv+PQ\024L\201]\321Q\216/\313\244/\216o\377Q}\004\252\265F6\2212\245\206"
+	.string	"v"
+	.string	"\217"
+	.ascii	"4\255+K \030\315i\242\227e\356\244\220\215\343\376\334W"
+	.string	"U\257\322\376y\374\307a\316\272\327\r5qpr\360\f(]\372:\276\203v\234u%\233\023-\021\212\017\2259g\201K\007(]\276\316\002/\277\253\300K\323\354)\317\311\230$\032,n\200\256\3149a\033\343\264\177\2534\377?7\21596\377R|\277\327\221\335\315)\347\366\271t\\\360\376s\305\311\261\251\222\030\3149\255c\016\212[\336v\003\333\004\354OE\376\217\003\241\340\327\360\b\013\026\300K]\0013V\370\302\2010\224\346\274!\360{\334\207\006\277\306\245e\035\364\343\245\337\001\274\374\206CC>\270\232\366\354\234Mw\307\3767W\307>\356~=w\273\244zF\252[R\315\222\352\225T\253\244:%\3252R\215\222\352\030\251>I5\214T\277Hu\b\252]>\265I\252KRM\222j\020TK\251\376\244z?\265~\352\007\340\345\213'T\323\236\201\023Y\347\2221\347L\340\027\271\221\007\020\"D"
+	.string	"/]\2738\220\370\b}0DB8H?\276\254-\001&\334\027\227\rM\353\262\277\331\"4\304\264\341\016\021\036\256\264~\320u\326\211p\220\203\212\306#\224\222\326\256\211\351\307\322\276nkc\353^B\013\211\027\323\013z=+\2679k4\340\222\366b\217M{\226\013\256J\021\251\310\375\r\"\243\233-\337 ?A\244d<:\026\030= \273;\272\337\t=\236\334\024\213\003\0312\310f\037\210\232\020\353\330\201\330\f\026\253"
+	.string	"\333p\241F\003,6\363"
+	.string	";\240\262\214\003\205\031\354\203L6\203\205\271\332\277\271:v\300\333\325\326\346o\243@Ii\331\375fv[\273\332\231]!b\013\033j[K*\022{N\273\332\363\034Q\"\366\260\326\310\272U\223\377\\\0054\036\325tT\313Z\320\212M{\274\335\234\255\333\2345\232\324\252\326*V\221\331\230M\355\016\211<\257E\255\f\023\324*\230\341\332\323\306\354N\033\356\024\371 y\022\353"
+	.ascii	"8)\322{(H\250Q0\345\224R\210\251\241\244\240$-\264\030\240\002"
+	.ascii	"\021\2619;\021P-cL\211\220*I=\032\003\323i\223\334\250\b\264"
+	.ascii	"\253\217\310\264\375D\345\206\006Qq\r\324\236\261\003\243\377"
+	.ascii	"\202\236@0\020\264^0!\243c\320\003\006\215\017\326\343\346\365"
+	.ascii	"\207\021\2242\227\332\n\240\t)\307*p)V\327\345\336~Pw\235\310"
+	.ascii	"2\317E)\001\223\003l=\347M\277\371\355\273\323>\372\025j\225"
+	.ascii	"t\nq\016s\366\214\234Q\263\340e\242\211\347\232\371\026\007\341"
+	.ascii	"^B\212~\213T\004\375+\224\343\333\221\317\t@\345\311i\226)\017"
+	.ascii	"\375\003"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.106.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\326\005e#"
+	.string	"\nA\360\rC\200\252\315p\323\237\217zw\323\bP\2167\344\363\213\357\307$\020n\236\367\326\313\001\353\304\323~\271\362\"a\027/\202\bf_f-\317.\245D\002\341)\016\250\205\023\305I\222$\211\261\2557\331\335\244L)\312"
+	.string	"\265"
+	.string	"\321"
+	.string	"\267\237\345Z\276\3056\255\342Y|\023\2661?\332*l\363\243\336\312\2116\257\\\254w,,\312-\257RK\234.\013\312\217O\266\241\213\362\374R\006\343\234I;\317\223\300G\037(U\355O9\225\336\303^x<O\037h_\316sh\300Q\345\307\241#\221\037\365F\344G\367l\264\017\211\2347#\\\272\210y\316\363\324\355\220\367n\346p\345\215\034m\253=\377\306"
+	.string	"\027\374\332\272\t\225\2731"
+	.ascii	"Rc\307qi\274t0\361\312\241\245m@\0173\033O\343\265\303\206\204"
+	.ascii	"&\210\234\023\017\305\304\013Lo8Nv\001u\274q[\356\353\3067\350"
+	.ascii	"\213\313\366t\236\347\211W\031_?\325\033\203"
+	.string	"\363<\255\301\257\032\367\317mO\261M\302\036\205\001\252\307E\372t\336\003i\177\250\322\007wO\274\371C\312\271\226\306\265[>\002\332o\271-\312\221/M\360dQsZ\253\271\303\220\272Zf\305\257\323\236OW\037\237\026}s\363)\022\300~\037f\206\007\030\345\247E{\370\323\025\332\267\235+d\352\303[j\325Q\253\206:\226\333\351a?\200U7\231j&S\275\244j\245R\235\244j\244 \365\021\220\332(\247.2\325D\246z\350G-\244\352 U\003\375\250\177Tm\252:g\252q\245\272\314\251o\245\232,\325cNm\303\251W\325Z\252?@)\rM\207\262\363\244Q\334s\236\215cJ>\374\261\374\246\244\332\354C{#\002\323@|N\204R\216\320\342\306\340\004-\002't\326\300n\004\356f\357\240=Q#Wh\265A\355\221H\231\261Q\333\2642\200\326\334\245$t\304\316\374\254\355\022g\023!"
+	.string	"\0215_#!\305\204\t$n\177v$\002\315\230\233\346A;\2715\367\300\036\2773?s\230,\223\231\214\374\230[\251\"T/c/\n|27\243`W\260\240\017Z ?\342\026\310\311\034(c>-\332\306r\241V\313t\365\361\211AQ\226\335V\311\324Fn\324\276\300\307%W\313"
+	.ascii	"\373\374\214\341a^\224\347y&\360\311Vd(\217\230 ?\216\213\013"
+	.ascii	"\363\035\314\307L\370G\254a\203>\370\321\337\260W\363\006\314"
+	.ascii	"\247\305\353y\236[\273B\357\310\335'\021\203\303\025\036A\225"
+	.ascii	"5B\253j\247;\201\265\333aY5eQ\020\nqu\205\002C\210\023U\273\035"
+	.ascii	"\226\003+^\320\225V\325\205\021YW<\021W\027Z\360\200lEe\305\323"
+	.ascii	"Y\211\320\235 Q\265\323Y\361\262tTF\306Bq\305\323iaa\361t\346"
+	.ascii	"\320w\333W\210\206:g\276\375\331\264\027\001Jc\316\270v+\027"
+	.ascii	"\245Lk\367\250\364\252\350\203~\262\227\377b\3548;\275\240XD"
+	.ascii	"\343:O\237\200\245e\332\003\231(\355\322~\0160-i\225\366\r\256"
+	.ascii	"\306!i\205\356\334Y\013s\031\f\032Kp+\364\324\"-O\314\254i\221"
+	.ascii	"\366\304+\017>G;%\265G{.\207\240\307L\031P\317\223\004{\234\225"
+	.ascii	"+\364\377\2004Z\020bol\007\257\363\200\203\021\235\242\275\t"
+	.ascii	"\325\326\300\210V\312\314\320\342\226h\017\\\"\264\001q\250Q"
+	.ascii	"0\344\fCH9\"22Z\224f\fp\002\0311\263n\020`U3%\351\304\304p\320"
+	.ascii	"U\363\203\356\023\352rl1l5\233R\344\330\340\216\300\224\276B"
+	.ascii	"\361\363\325x\302n\366$\370y\321\333\002_\201\260\201\2271M\226"
+	.ascii	"\031]I\247=\355\002\f\246\3711\221\352\036\317\t\317Z\215\360"
+	.ascii	" \212\313hAJ\f\302LJ\033,\326\023\005mJ\b|\357\bXy\223\177\232"
+	.ascii	"\020\243}\021\027\026\025\377\343T\315\321&S\025\3313\351\327"
+	.ascii	"\032\315\317\032\240\302\244\237\nT\300\235\212e\357\306I\314"
+	.ascii	"X#\231\365\250\334)\243\337\022B\222\350\031\001!]%\220\364\234"
+	.ascii	" \211\316\232\277?\215]\246\204 \235\256#]\210HH]K\247\330\b"
+	.ascii	"\274\034\370)\257\305\201\202EM\270^\352\330t?A>6\362\204e\312"
+	.ascii	"\332\213\377\252\240<\342\303\366\267\025\250"
+	.text
+	.section	.gnu.lto_processRcInterpolation.107.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`4\f\265="
+	.string	"Zi\004\027@P\344\316\030\346#G\311\013\322\250 \244\007\231$\230\246Fx\230\204\003!\007D\\h&U\254)\320\315V\250\034\020!"
+	.string	"\212\201\310\313e\340~~\023\310\005"
+	.string	""
+	.string	""
+	.ascii	"0\023\021\021\021\"\245L)\245a\001D\001a\001\274\026\235\277"
+	.ascii	"un\rLa\324\224H\363\276<\252~^B\026\220I\353u\323u\3435\353\253"
+	.ascii	"\277\267\314\315\334V\270\3678\311}\245\261\324h=\0164\212\231"
+	.ascii	"\031\271\370\305\315y\337W\313\330l\324\332\3145\270\353:\217"
+	.ascii	"\223\334v}W\243\361h\030_/F2\277\033\007\214\315\006\265Q\333"
+	.ascii	"\2547Q\333l\323\271\306\267I\221/\016\307\234\367\305\263j\226"
+	.ascii	"\001\030\233eF\240\240\006\273\215\347\306\003Y\306\207Lo\317"
+	.ascii	"\373\3425\037\t\022\257\275\3425/\337\355&\246%\245$\244#\243"
+	.ascii	"\"'\242!\241  \346R\231D\036\215\305\226]\337]n"
+	.string	"*\210|\3213\261n\242k&\272*\276\344s\2554\355\244\271<%\216\304\244\217\226\264\321\2228/j'\223vZ\227\246\353T\235\023\r\301\265\020\334\233\007\2715\320Z@\315L\217^c\346\266\032\2511\022\247\363\2108sU\032>\001\322k\314\324\326\004i}\206\275\007\304\227\305\2556\264!\255\224ZC\023\322I!A\034Y\334\332\353\2538'khC\372(g\226\346\306$RrfR/\266*\312\260\305\255u\316\r_\364\354G\2576\220gc\255Q\222@8\350\377\0323*k\324\373\276\235\327^v\366t/n\275\357\313\036=Ck~jf\177\300\314\026\230\221n\001rO\257\362\372\354\377\0312\252\223?\364 \231\365;\257\255\f\375\246v_\232\267\330b\233\246\321\376G\370?\003U{v`\013\322\340V\302 B\204h\233\375_\266\361%J\235^\345\356\322KB\b\305\374\217\203\303\264\267\365\331"
+	.ascii	"\271\3010b\3337\346=\372\276\177\334^\030\321\350\355\3246\273"
+	.ascii	"\243\311\373\276U\355\307\314\210\355\237\364}\305Z\215\021\331"
+	.ascii	"\243\257\016!M\336\"o\225r0\b\341\230S;\216\217\313\236\1776"
+	.ascii	"\036\321\366\233\270\362f\314\3710\263\210\3362\302\370\276c"
+	.ascii	"\013\270\263\264\026\022\334J\232\345\022\\\336\321f\271\271"
+	.ascii	"\236\225\242\227h\347\364*3\336\323\237\215\271\275\f\217\037"
+	.ascii	"t\370\2170c\240\240\025\001B\3535g5\233\256\031\253\361\232\257"
+	.ascii	"\220\316\006Zg+\245s\001\245s\225\322\231@\322\231*\351< \351"
+	.ascii	"<\225t\026\320:\007@:\003@:K1\235\243\230\316PH\347'\244\263"
+	.ascii	"\323\322\271I\351\314\224t^*:+\025\235\223\220\316HK\347#\245"
+	.ascii	"\263Q\353\\\244t&R:\017)\235\205\224\316AJg\240\24433\351\274"
+	.ascii	"L:+[\347$\322\031yt>\036\235\215G\347\242\321\271-:\263\255\007"
+	.ascii	"H\237THF\255r\243gv\231\270N\332\216\036}\324\330\2131\237D\243"
+	.ascii	"o>7\315$|\013\003\324n[\364\275v\305\315\230\363\311\363\304"
+	.ascii	"\255+\242\222r&Q\312|6>\260EI\341\3317G\253\316\372\262\2659"
+	.ascii	"\260\315zG\034\223hggi\240\263\236\302\267\3227r\240jO\257\272"
+	.ascii	"\222\350\355\360\037T\233:1X\277h\235\241\027z\242g:\003\035"
+	.ascii	"D\376\3203\035B\347\004=\320\013}\361\017\264\311s\216\234\031"
+	.ascii	"\3564\350;\314\033\240\323\253\256Z\037\362\237\361}\337\006"
+	.ascii	"\334p:\216\033\305\235\342N\247m\263@\277\024\024\223\b\310'"
+	.ascii	"\371lV\315\374\2263\320\313g~\223I\263^\371\313o(\365\351UN\276"
+	.ascii	"\362\233\214\352l\323n\\\267\212[\347\326\265\315&\277\367zJ"
+	.ascii	"P\314\035$\362\271\013\333\320\275\203!AB\264\316\361\221\277"
+	.ascii	"\342!\243\032\277\370\307o\350\334\232f3\241\302\205\013m\263"
+	.ascii	"\306?J\257\276\370m\346M\0322\252\225\223:\325#\215\366\352\035"
+	.ascii	"D\201k\026dS\370\307\370l\334x\300P[\255o0m,\204\357\303/\324"
+	.ascii	"5\302_}\031X\333~X\237i4`\0316lh\233m\377\005\003\247}\212J\316"
+	.ascii	"\314\241\203wT\353\237\006\357\b\237/\306\335\327\312\301)a\373"
+	.ascii	"lb\232}\b\337\320+\274\276\276\270Rt\025\275^pyH\341\302+\f\205"
+	.ascii	"\227\007\031a\313\025^__\\)&\234\360z\301u\242\005\f&wau\205"
+	.ascii	"5\273P4\277Tp\261hv\205\271hb\0211X\013\257\260\346\0130\260"
+	.ascii	"\260f\022\317\331\177\244\371\314 _\b\235\377l\3726ws\357\030"
+	.ascii	"\264A\302\201G\f<\220\240\234\346<N\2775\246\2746\342\371\242"
+	.ascii	"\246\344j\315+\222\017\351\346\227Y=\n_\263zvO\316T\212g\251"
+	.ascii	"\357\224\241\032Qr\035]\344\330v\270\347\316\236\244gc\005\203"
+	.ascii	"G\030\376\b\304\211_\312\372\276\357\213\364l\355\266X\217\341"
+	.ascii	"\333\3018i\216\202\360\037\224\233\003i\273"
+	.string	"8z\n\274\224\377\006\270\371\217\252'\360\005\276=\204\252=}\360\237\321{T}\353\275\001:\2418\232\237\021\370\343\236a\367\031>I3\242\032\360TS/\340\007`\375T\200\027\340<\002<+h8\225~Z\237\241\\Q\263\341\2234/N\177\204\335\273\026\300\207]A\223\003\300\037\r\013\211\244>\032\365R_\255vW\013\365Q\337P\265\247\207*t\262\247?\n\246\231J\333\351c\214\237!\247+\267\341cM\357\304\364M\337P4K\317\364I\177\240s\224~\351\233\252Mz\245o\350\234\213%}\027\272\221\n\265\236.z\002Q\354\004!}\325\275\323r\373\323T\027\311\233\013\007w\364\001\200\370\250\201$\007\221C\210hD$I\222Bk\240\002\221)\242\252\003\021 )d\220\021M\222v\003BhW\214\377\350lX\337\b\271Kp\376\230\004\326Pb9T\221\026m\344\3004\3369\224\213\272u\226\021"
+	.string	"\231L\202 \257\316\373\367"
+	.string	"\206\r\017j\007-H\033\347\fd\360x}\346\002)N0\021@~v\212\226B\3337\035\246\202\027\316\345y\312\013\t\023\360Sn\343\332\257 \210,\270\017\212zr\f\3466+(\304+-\353\206\264\301M,!l \373 \313\357\342\362\261\205\250\021\217\301\203\217<\217\371\373wb\217\374\227m<X\217\273\270$\2009YK\3477o\214o\272\255`o\254\r\f\224\001\007\006\334:\212K\330\214(5\211f\3255@0\236/\210\007#-`\237\224\237\264If\267\217\246"
+	.string	"\266\265\316\344\004\237\007\226\275]\313\322\276\221\206\364dY\023\017\322\256\301J\020\030\245\246\345\323n\266j>^\203\306\025\bs\314\326\031\325\241H\321j\231\3427\001F\263.\326\224\201\367\300^;\340\223\267\017\2517)\303\254zs\366\275\317\217"
+	.ascii	"\350gO6\211\276\371\207\220\202r\334x\022x\t/\321\265C.\301N"
+	.ascii	"j\335B\205\214E\202E\247\265\322U\311&\271\211\230\346\\N\215"
+	.ascii	"(oI\002\210\200\253)\263\342\r@\007&\274\251F\037\340\020\207"
+	.ascii	"P@\023\202 \316\312\215\317s9T\224\f\263j\226\365\311\036A\354"
+	.ascii	"A\235\302nGm\310\260\n\3169\022\032\340\231\247\327d\024!\251"
+	.ascii	"T./\355y\337\006f\225I=\202#\364B`\323\367\261{E\022z\307\264"
+	.ascii	"m}8\363\3111\034\213S\035\027\253W7\243@\323\344!\221c\252t\351"
+	.ascii	"\251\241\261\216R\253#Z\246\333k\350\031\247\252\367\371qsS1"
+	.ascii	"\252=\367\232{\2637\002\311\250\0305"
+	.text
+	.section	.gnu.lto_updateRcRefreshRate.108.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\350\002M\026"
+	.string	"f\252\223G\300\030Q:\004K\304u\201\007$`\262)F\352\370\364\367\024\207.dP\264\2261\024(\376\350W\266_\007\335&\262j\231\220\265\203\230\366}\210\035EQ\340GQ\034(]\227\226\254H\021\303\177\371\261\021B\210\224)\005\177"
+	.string	"u"
+	.string	"\201"
+	.ascii	"\327q\234\303\233\215\314,\300\234\305(\342\231s\304\003\233"
+	.ascii	"\r)g\004\tH\214,DsN\006\367\354\200t\265\237\343>8\377\271\261"
+	.ascii	"\313\234*\200\202\346\26450\002\322=\231\013\370\356u\217\371"
+	.ascii	"\356\031\307\226r\233\213\371 Q@\360(\232s\212\333\3428\367\272"
+	.ascii	"U\034\037\214\340B\253\345\334+\361\316CX\233\351\002\250\311"
+	.ascii	":\2319\347q\327\020\265\231*\030a\316i\245\325H\334\337mW\260"
+	.ascii	"}c\257\027Zl\322\3578\216E\242\331\031ZzZi\025 \25124\333\034"
+	.ascii	"\333&\323\335\261\337\3159\247w\205\r\252a>\365\013\250>}j\323"
+	.ascii	"\177\376\260\004\252AP\375\335v{$u\367\251\027T\353\247~\214"
+	.ascii	"\201\243$5S\346\024Qn\231C\336\020\031\267\375\267{\272\366\201"
+	.ascii	"j\030\331\230s\372\370\017\016&\214\2128\330\347\361\234\035"
+	.ascii	"\272\303w\030\314\2256\356\331\035\354\360\336\006k\375\200E"
+	.ascii	"\366\204\347.\362y\013\356s\357p\300\b\272\321\223\263\022n\221"
+	.ascii	"\343\256/z\254\350\370\244\210i\351\231\026f7\\\323\376\007\221"
+	.ascii	"]\320\204Q\026o\267;>\255\356\225\340\204~\273\356qO@\353i\242"
+	.ascii	"\343\203\342eO;\340\n\210\243\230\226\376\206\373\262\007zGc"
+	.ascii	"\t\321\214\0239\036\231\226\366\203.\344\306\207\341\r\243\236"
+	.ascii	"6~\367\276\007\234\240\210iy\235s\346\254m\276\322\016\350\201"
+	.ascii	"\202s2\323^\241^+X\252U\300+\324\330b\301\304\032W\253\345R\021"
+	.ascii	"x\315\214\030$\214\255\024ISz\315\214\260\324\204\325k$iF\362"
+	.ascii	"\364\232\031[,\n\260\232\221$7\250NV\241T\244\250\242\021kX\251"
+	.ascii	"\226\250\"_\"*\306.\r#)\302\\.R\fm\261\357\n\177\211\320O\007"
+	.ascii	"\263\272#\244\263\245\3656\204\205r(\2662\333ts\252\200\360\333"
+	.ascii	"Ot\323\322\335\372F~\344BJ\245\242Q\371\266[\300\242\2241\351"
+	.ascii	"q\0046\001\367\0136 \240\002\231*\363-_\021\177\213\344\200\353"
+	.ascii	">\314\272\341\fX\311:b\255f\216\211mH\206-v\032m,\230a\026+\211"
+	.ascii	"\277\337\313\036\232\253E\314\002\206+;\214\321\261<\303\270"
+	.ascii	"{\254\302\265]\276\375[\005h\267O\032\253\232\226\325\236\247"
+	.ascii	" \200\201i\005?\247\211\330!N\203\032\353\271\360<\241\310\036"
+	.ascii	"\201\307\207]N\001\356\234\0167R\f\357\213+IQkz\023L\031"
+	.text
+	.section	.gnu.lto_getCurrentRxRefreshRate.109.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375 \354}\006"
+	.string	"bL-3Pm\222\016d\254\252\206\222\201x\3262\353\252\352n\255\006\2671\224\021\313\326\356v\342\243\202\033A\261\020UU\0215p\206\207 \325\3721\264M,\3312\005O\232\251r\223\202kX@`pS\365\3404\231)\207\204\312APT\3450/\313B\310\b<l\342;\322g\335\216%6\330\253\355n\2446d"
+	.string	" \017\216\376u\220i|-\311B?\216l"
+	.string	"\244\022q\222i1Z\311\224f\342\361s\036sA\032\302\331\302\307q!\225TP\220\2102\237\013\250\200\324\206\315Hml\243V\321\272\025\251\345C\204r}:\305\313Af\216\327\007\243\263\376\006\177\301\237\021\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.110.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\335\f"
+	.string	"\266\230YD\360\2606\035:\316\314\217\314\037\331\321]\353\310\362\241V\333a\022qx\242`\032\027\227\251B\313f\343eI\250\246\261\327\351B2\035\017\326\030\262\017\222=\232\034\233g\207\355\227\201i\2573|jB\266\224)\005F"
+	.string	"E"
+	.string	"A"
+	.string	"%\317\246\201Q\304\367\024-*'d\354.F\340\002\252S\360\035\325)\rq\357P\323\3637>\321\341\305r\205\003\\Z\260"
+	.string	"\370R\240\001\033\020/nz\256|\243L\313\263\273N\322\307\341\246n\233\201\355\006\366%\004?|Z\037\363\347\323\347x\234lNV\354n\270\241\2615\224\212\022\266=\273c\313\234\234cG.F\314,@\240\300{\314\360\350\321\022K,v#\210\023<\037c\032sv?\240\230\331]\020\027\270N\331\366M<\366\240\350\bVi\251j\252mr\241:\351\322\233\356\321\240\"C\265\324\242T\325\251R\003%o\222\004\311\245F\025\306\037O\355P\202a:\245\344\f;\212Ra\354\303\325\027\373\351\353i\353\361\247.\023\334\326i\231H(\364!\251\320m\033\350\301\326\231d\001\016t%\032\212\360\001\215@\370\2002N\004\203\003\n\0262\016k!\032\207i\0230\222\221\f\204i\\\b\013\351\360V\362\341\260n\3338\254\023\367\372\342\233\316\361\020\343\224\037\267^z]\321\023"
+	.ascii	"y\b8\323a6\0135\306^\203\320\334\213\370\242\216\343\246\027"
+	.ascii	"\226M\256\341\206\265\200I\023\n\250\003\367\366I!\250\320\n"
+	.ascii	"\24026\3254\rLA\001"
+	.text
+	.section	.gnu.lto_rcSmoothingSetFilterCutoffs.112.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\315\016MD"
+	.string	"zt\200\031?@\244N\007K\204\005X\203\005\264W\217\340A\210p\263"
+	.ascii	"T\024\0069*+4\032\304\3065\362\210\360~\004;\320c\006\272\216"
+	.ascii	"/)\274 \250D\246E\314TU3C[/i{\357\275\223L)\212\001f\001\213"
+	.ascii	"\001\211\214\342\300\265\357\212\357\271\227qO\343\337\355\335"
+	.ascii	"|{\375\347\2729]=>;c\356\364E\364\307\327\270^\367\3330\\M{\234"
+	.ascii	"\347\236\2278\216_\030\335\257\257\357f<\257\3373\216\006\366"
+	.ascii	"42\\7\247S\363\312\3240\216\343\006\256\257X*\236\223\201\275"
+	.ascii	"L\233\033\267q\231|l\f\343\030O\351k\027p}M\312\236\273=\214"
+	.ascii	"\213\201]Z\303\223q\354$Q\2338\306#\320Z\256\257\215\347M\254"
+	.ascii	"\257\256/\261\2766\334\035\310\361\354b\027\244\307D\223(\216"
+	.ascii	"\343\345Ci\325U<o\245\f{\025\325\224T\024\324\223S\023\323\222"
+	.ascii	"R2\t\351\by|\215E\267eW\3653\334\336B(6\345\334\274\212J\305"
+	.ascii	"\242\023\310tA\247\030\365\312I\335\241\3379\303\344)1.\245z"
+	.ascii	"\031\2729\344wN0j\323\017+M\317\373\222\243\242\016\345\305\237"
+	.ascii	"T)A\247\027u"
+	.string	"K\357Jv\262\222\233\252d\246(\225\274\244\036\007\265\030qA\347\024\025\301\334tp.+=\001\"\305\223IHvu\371\250\205\200l!0\001\022\305\217H\004\235G\362K\247be\t:\223d\243\2403\312\235\323H.\362y\326\235s\212\0179fv\375M\212\267j\223\240\363\251z%\251#\204\231Y\243\034\021_\207\270\252J%\251#\344H\016\207\272\225\247\311\037\237\336\310\177$\027\247b\305q\354y\236w\310\301\345\334B\210\343\270sS\016\210\267\225wg\257\356v\320\215\374\020Ei\373\356;\023\261\214e\277\355\203\323\340v\312\330wDQ\244\352\257\2776b\"rp:\352\207(\362'*\035\003,\004\370\017m3\366\037\315\f\237\033YQw{\3608f\356\377JH\330\037\034N\233\033\307qX\373\237\rE \006\024R\251\301\372J\366O8x(\345\3638:AJ\342\270\037$&\316\271\021\307o"
+	.ascii	"\362G\370\314&\356\016.'\266\177~\2173t7\336\027\242\235J\213"
+	.ascii	"8\313\336<c}\365\177\231\203\321\347[N\354\306\203\313\017]t"
+	.ascii	"\205\320J\277\223n7w\00777\0077\367\0067w\0312w\006\f\276\347"
+	.ascii	"}\301\313x\223\271\324]\202\247\361\216\340{\336bnn\006o\356"
+	.ascii	"\005n\356\2607\267\0027w\20267\0027\367\001dn\003\306\334\005"
+	.ascii	"\336\334K77\230\233\233\2001\367\0272\267\322\315\355\325\346"
+	.ascii	"\356jss\265\271\007\034\345\026\200\314\275u\314\035\200\315"
+	.ascii	"\r\340\315\255\265\346\316:\346\306bs_\275\271\255\326\334U\306"
+	.ascii	"\334T\307\334Sln)6w\324\233\033\352\230\373\211\315\355\304\346"
+	.ascii	"nzs3\031s/\025s+\271\271\223n\356$77R\233\373\310\367\274\221"
+	.ascii	"\306\334\3077\367\373\3466\272\271\213nn\327\230\273-\346f\335"
+	.ascii	"\334k\233[ms?\233;\257\271\335\003Z\234<4\360\304\361\217\017"
+	.ascii	"@N\353=\320\217\254o\023\347\236I_\271\352\257\036+\n<%\216\207"
+	.ascii	"\232\243)\314;\ns\323\257\020\353\241\354X\375U\316\321f\365"
+	.ascii	"\016\210\2174\307U}\013\210\030}\"Q\345\033T\377vit\250\244\320"
+	.ascii	"\221\324OU\311\261\232\243I\204\271x\035D\277\251\207\212\222"
+	.ascii	"\202\372\250EP\377\200y\b\311\225\235\376)\013\254%{\263\333"
+	.ascii	"\224\264'R\033\263kv7\314\303\021\301\\\334\317.\216c\006p\027"
+	.ascii	"?\004G}\235>}\373\327$\242\225#|\323w\303b\3401\331\233N\217"
+	.ascii	"\205\343\335\232\351\233\376\001\305\031\026jc\3721\246\241\343"
+	.ascii	"C\013}\351}\020\212\245\177\273\030\212J]\273\330\031\307q\227"
+	.ascii	"\023\2367\201n\271\321\364}h\273\nV\351\375\t\2402\245/\022\n"
+	.ascii	":\224\372tP\313\323\230|g\362\345I\237|g>\305\036\351\223\336"
+	.ascii	"\343\020\217\036\351\235\211\330\307\375\230E \313\336$c}=z\347"
+	.ascii	"\363\255\"\202\242\317\237\233\016f)\242`\217\377\204(8!\212"
+	.ascii	"cr\217\217w\035\322\205q]\245\267\312*\035\371;\332\033\317\315"
+	.ascii	"{P\313\\\233\226\354\337G3\323gO\333\373W\244\206I\304HYU-\263"
+	.ascii	"\360\243\n\223\357\225\276\341wt\033_O\233\373\344MB\033\336"
+	.ascii	"\370\236\347J\300?p\204y\210+U^\337\375\342\267O+\\`\275Y\366"
+	.ascii	"\354\273\005\270\323\363S\225^|\237z\322\314`\236Bz\356d\360"
+	.ascii	"\300\376[\026\372\237]\361\003'\274\303\210\\\242\304\232\213"
+	.ascii	"\027d#R\254\025\317\\\234MP[q\302\204\213\2655\025-\220\235\006"
+	.ascii	"\226\306\266L+\261\\q\342L\3052\215\255\305\022l\251\327X\220"
+	.ascii	"`[\272X[c[\276xo\376N\\A9\201o\017W5\226\0310a\0357\336\255\027"
+	.ascii	"<\203g\2334\001\231\210Z\002\245T\017m\f\277\340m\204Y\3603\236"
+	.ascii	"~\207\322>?2\\\246\032\344\003\237\340\303z\300?\260\342\336"
+	.ascii	"\255\025|X\264M\301+@\360\t\336\331\300r\271"
+	.string	"\213\031\202\367;|\244\031\376@\222M\242\223`\r|\206\357\314|n\201\353\f|{\347\351\027\345\242\003=\224*\360hw(\nl\r:\303(\352\211\303\273\236\223\322;,\037K\207_\256~\317=(\257'\360`\337\256\307\241\310\243\357\357\t\354]/W\351\2770;\300B\260\257'\340\312\377\352\203\313\211R\340:\345{#>]\357\365\354\236lg\326\365G\316\347\036\022\027F\207\234\270\202\344'fP\256\217\361d\023\265\362s\370\247\351\241r|\300\227\200\207\344&f\231\t|\007\027q\323X_\007|Q\232\353\262\2224x\016\246\203\351X_\005<\215\347\364\360\311\364\320\206\353\330\255G\203\221\344#p]\246\003\321\r/\251\261\365l\317)\334$\317]\331aP\245\317\274\303\245\207\266\363\271\262O\362\302\267\332\"_\354w\364\037+\366\036\310\335U%\027\373\013\357a\032\t\212K\002\227\023s2\353\001|"
+	.string	"\350\0205O#\004\346\342v\202\374\005x(@Z\001\201\022\250Q(E\231dLDDA\222$\031\346q\005\304\030\346 \264\033\021 !TN\325\220$)\324\236\001\343\021;\263\334\362;\342\022\257\347{,\017\361\241\311\2318\362_k\213\302O%\314a\370\207\215f\257w\242\214\313d\272\304\206\211$#\252\001\354\375S}\375\314\233\330\241\227\205\241\004\216\320\023\016S\340o@@.\200O8"
+	.ascii	":\f\334a\312\3319\354\bJ\026,0\374\375\271rB\013\214\022QX\t"
+	.ascii	"\337\311A\262\273\215m\236}R\260\213\344\315\210[(\211\313F\271"
+	.ascii	"X\271BX\353\375\263\307\313\243\207{\361y\335\344\fu\326u\205"
+	.ascii	"\375s&h\350\205}.C\207\311\370\2650\211j_JA\b\370\262\224*\210"
+	.ascii	"dk\320\351\032\244\036\202xY;\201HrT(\322\t\224\031y\001\027"
+	.ascii	"\333\032\250p\362\243\215\002)\306t\245b8\3743\373O\025\300\253"
+	.ascii	"[\364\250\246\310\nl\243\b+\032\262\234EZ\271\264\240\206\020"
+	.ascii	"\211P7s\013C.g\237\355\264\215bjSW,\227-\231\353\220\216\212"
+	.ascii	"\371\007\375bd!3t\035\231B\001\346A\003`O\001d\272\231Wc\370"
+	.ascii	"\352\323\237\273=\370i\013\363*9\021c\0179\232\243n\017I,\t\214"
+	.ascii	"\021I\256\213\2656\323\355\317\302\266\261H\256\360\310O\241"
+	.ascii	"\202"
+	.ascii	"$\022\020\265\022r\307t\027\357\2272\311\001F\241t\343\263\362"
+	.ascii	"\007\004\200\"n?<\205o7\316\223\231\3641|\377\377\0339\300\330"
+	.ascii	"\264\367\222\326\274\031z_\020T\362'\334S:\205#\003\252\n\271"
+	.ascii	"w\372\3040\231\370\370\366:x\377\345H<\215\347z\324c\3745Z\312"
+	.ascii	"\0340\2304\312\214\b\220\205\325\013w\215\013\207*\301\001\033"
+	.ascii	"x\207\203\033\341?\344\021\365\021F\";\364*#uh\003E\361\277\001"
+	.ascii	"\375\231\272\3250\273<s\304\b\0268n\347\204\301\252\205\222("
+	.ascii	"\257\240\232\b\021\021\211\262]\255\2541.];\323(Q\307\353$B\265"
+	.ascii	"\375\253D\261\241\315i\344;A\022\3136)\266\266]_\316\037\033"
+	.ascii	"\327\251\001"
+	.text
+	.section	.gnu.lto_rcSmoothingResetAccumulation.113.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"\315\n"
+	.string	"6\023H@0\305*\035"
+	.string	"nQ\336\343\005\266\\\376\024\372\373zE\352f%\261x\213\342\210\300\365U\230\307\020)\373Ep\315\255\201&V\307\257\246\320R\020\007\006\250ljr}\303\r\353\370\344\223 \262S\n1"
+	.string	"3"
+	.string	"9"
+	.string	"\235\313w\274w\3379\336;\2176\202\227\260= \021\341\230\231\273[9\220\217\247\243\377\223kT$\3524\323\260\273\246*\222us\267\355\261]\355k\004\364\264K\024\345>\354cvw\315\275\354\313~\232y0W\035\344U\347\356\352L\260\265N\300\310\306\366\251\375\330M\306\313N7\330}\335\002\354\226\013N\370\036\236\035\336\205\324\302j\025(\261)\334.\235\305\003V\356\321\"`\332h\266\251\307\256\270\212i\b0\333\342)\027\337\3562\240`dt`!\357\374\223\367NC\316j\256\230\231\n \023\310Ab\024\2320\205\241\250T`\360\003\212\025\214\250\243\020HTA\261T?\034\207\024\020b5\205\241X7\345\036\263\334\313\237\201[-\305m\330\242\003 \275\034p\305\270\363<)\026"
+	.string	"2\241\277/0.\320V\227`\2737hp\031\031Z\335\004\333\275Z\372\016\354"
+	.string	"|\271j1\204\253.6c\3545=+"
+	.ascii	"F]\302jV\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_rcSmoothingAccumulateSample.114.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\375\005\315!"
+	.string	"\306~\325H\260XQ:\361*\212\366\024\240<!"
+	.string	"+\225\273\027R\223(6\274B`<\304\025\335\030\323\222\264\320\247\026\375\325\230H\0260\304\242\373\201<\251;\255\005y6\020F\206\3023\303rI\332\215jE\323@\373\204\020)S\n\275"
+	.string	"\257"
+	.string	"\311"
+	.string	"?~\304_\342\227\237\344J\214\356T\004\323\335\230\260\027VJL\250\346\024.8i\n\256\2230}\323\207(~\304\020\200a\200\3149_(\354\327\311\265\215\354\227\355\025\276\210\321\215\2708\302&\017\207\020\2509g\003?p\235\234\215\252\366\207\234\210\321\227V\364\300&\217)\006\324\234\302\006\376q\235\264\360\262\362\244\353;\345I\333\206\020\301\310\271\036\026\272\252\tJI\220\232\314\314)\244\355\216\347^\222\343j\316\327\275\244"
+	.string	"\f\203e\213\323\217\306\311QA\260\312\214\234_o\224Y\301\361\205\205\2163\2769\277\3358\233s\236\351\332\342\307Sm\005\3159\255\276\237\214\273u\333#l\007\331\245\205=Y\246,\355Byr_\225\356w\367\275\340N\263L`u\307\247\036\225A\274\211\211>I\366\320\241D\270\346\234\022\210\030n\262$\036+\312\223\3373\035A\221aR\220\310\322\221f\331\302\235\256\016\373\343\234szs\034X5\320\231\334?\253\236\255\332\300\235n\237\033\371\t|\351\037`5\317\252\005\254Z\346R\307J\365N\251\016\260j"
+	.ascii	"\245\032V\252uV\235S\252qJ\365\315\252_V\333\264\3245\253v\265"
+	.ascii	"\324\255U\227\253&W="
+	.string	"\226\352-\325Z\252\277\300\006\025\003\306\357.\210s\306\310B3\247H'>\316\344w\372\3238\223\202\224\236\002:[\340\251Ge`s\326F\321Wu0\237\255\201\233\335\305\331\367~\274\366f{\242zT\007\366\345\022\263{!\305W\225\225\005\264\007\326\212\004|\017_p\212\\\035\326\205p$\275\03204v\027K\001\333B\300\222\273\272\341\026&)\236^\215\343\352P\235s\352vs\370\271\322fo\2040y\341\351\225\355\016\357\222s\235x.7\333\303\n\275\357\244\315^\b\360K\220\232\325\222\005hk\\\013\264\357Y\375\254\253v,W~\366Og\226Z;U$5\333V\354\t\t\353\250\334\331\276G\306g\313\245\245A\302\262=\252\350i\252\334\312g\277\344\027\256\200Z\202,\221K\305\305)\f>.\271c\261\027\334\t]\212\213Q\306\r5\017jB\203\320m(\203\320\255\206\273\220\002\207S;Q\253"
+	.ascii	"\202\304P\210\023DD7\0238\2669\260\341h\266\0174\022C\265\033"
+	.ascii	"\315\2063As\260c\242\022B8\332\t\"\"\034\355%<\37287\207G(I!"
+	.ascii	"!\216\367r4JQH\210\344\237+y\266\205m\236u\320\321\356J\333v"
+	.ascii	"\25445\277\246/\301!VE\345\207\256\375\252\350\214\f`\024\020"
+	.ascii	"\253\005\377\320B/\343\"\031\032\300*f\254\216\210\266\025\350"
+	.ascii	"C\203\370\230\017=\364*\021\262$\017\237\340\3274\025\034bF\266"
+	.ascii	"\266\206S\271\350\342\211\255l\311($\254\230\356\254\275\201"
+	.ascii	"Cy_lg\274\3259\300\302vg\337\243\002`\003,\t\306\301\307\005"
+	.ascii	"\260*p\274\220\352\005u\026ga9\033g\250A,\006\021R\210!\031\n"
+	.ascii	"#\005M\n\303\001\240\002\0219\033=\021\300)\023\020\021\215\244"
+	.ascii	"(\205\354\006\304\240~\244y\374\371\3067\202\026\343d\372\236"
+	.ascii	"\353tj\216\315ON\312\bw\006\037\225\301w=\207h\264\251\271T\372"
+	.ascii	"\250\240:\025l\263{\262\225=B\332+1}\346\223\\\013\004\301N\007"
+	.ascii	"\323\344\254\210\201:@\263\227\021\303\266\370\203\346rh\312"
+	.ascii	"\310\361\274\250`\327(m\231@YG\"\257NI\206(\022\233g\022`j3\255"
+	.ascii	")\244\004\251\324\351\300cw\373\"\333\216\256\363\001\335\002"
+	.ascii	"}nFW\345\007\030\324\027\2122\230?\263PW\233\030\350\316&D\347"
+	.ascii	"\005r\247XL\373\247e\304V-\237\r\031\016\311\210\364(\253Q\021"
+	.ascii	"\325=\314\036\255\217\346@4\315\026\035e\345;\331\345\360\330"
+	.ascii	">\363\007"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.115.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`Z\001\365\r"
+	.string	"\006Z]D\020\257&\035#\341\025\325\355\201p\001\rN\035x\302\374\036\365\245J\372V>\317\313bPI\234\350'<~\202C\032\005\3443a\250\272\036\263\n"
+	.string	""
+	.string	"`\005BW\205\221\364Bx\272\324+o\311\336[\312\224\002K"
+	.string	"D"
+	.string	"O"
+	.string	"\nL\254\025P\331Zd\324\254&\200\330\331M]\232\341\332#|\232\232\037\200\333\036?\026\016U\362\205\270\225\227\261\273 .%\365!\210A\361\022\342P\036\201\034\f\253\237\236,\334J\246\265\261\273\316\022W\341\266n{d\333\200\375\2336\020|\323\241EF\362\245C\177$\036^\177\372\201\255\353\020\203\2629\311\036;\265\245\316\330\177\2532\266\323\226\3230\323\357\245U\323\231\351\177D/.-\334[X\354\272\364\300\330\024\320\204\006\333&6\310\t\002\034h\240\316\244\376T\304q\021!$`7\221\304\303\247"
+	.string	"~\363\216\3047\331c4\212\207\252%01^\300\234\206G\207\304\003\211\251\035\252\025\037W\201|H\265\270N'K\270\310\271\240\316\342\265C\245\"%yl\207\334C\366\331\335\005>\352\001\30640\322\205\211.\007\037\034!\027F\022\2714\0068{\340A\272\"d\031\351\002\245\366oU\306%5;\035N\376Z\314\367\021\377\351\237\325\006\n\035\216\372Z4\264\024*\213m\250\3368Q\224( m\006\r\362%KU7\237@\005\034"
+	.ascii	"m\204\216\202\005\b\331e\237\326\024\032\004\007C\003\0312\243"
+	.ascii	"\2012\201\205\006\003\264\3413&{@\n(\006\f\202\3422A\026\210"
+	.ascii	"\252\202OP\230u\\\030e\016\333\fc9x{Q\b}\204\201\324\354\321"
+	.ascii	"k\013\024"
+	.text
+	.section	.gnu.lto_processRcSmoothingFilter.116.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`d\037E\202"
+	.string	"j\314\210-K N\323\032\003\333l\207\\\365U\231\357M\265\267\034%\253O\177j\310\365\345\254\273\364\257\006\255\274\342n\231w\325\"NPh\341\242T\267c\211)\340"
+	.string	""
+	.string	"e\250s\250\\\373\206\324f\204\311\"\267wY\0010\214\"\224FRJ)\266\002\246\002\307\002\374\201\310\331\003\220s\007#g( \347'\2433\207\242\263S\321\271\251\350\314\324:/\0019o"
+	.string	"rV\"rN\"r\316P\344\214dt>2:\033\025\235\213\212\316\306\326\2718\344L$\344<D\344,\324:\007\265\316\355\2203\220\220\363O\353Ll\235\207A\316l\353,l\235\203\255\3637[\263\0039w\227-\331!\351\210Y[\362xmo\223+\237\227N\270\346J\313uC\273\323t\233\351\026\323\355\326?N\364\241\263\336l\33527s\307q\303\341V\216\247E\255\263\327XB\332\0263WD7q\374\003\006\247\245\341\230[5\314-\233nc\244\325p;gzf\204\271\225\252a\2414\216\355\255\243i\216\364m\031{"
+	.ascii	"\312\323V\002e\013Y\037\2173fx\372\264\325\366\202\001=\323\324"
+	.ascii	"\260\001\352 \266\223{L\223\341\326\315\203\27759\031\335B?A"
+	.ascii	"h1\034\3557\354\3659lkp\372\336\3675Al\341S#\261-\f\266\021\333"
+	.ascii	"Bn0\335\306\3342\222v\362\203\245\251b\306\206\204\271m\341\220"
+	.ascii	"\031\004\356&\267\315\346\366\313\365v\360\267\306\244\357}\333"
+	.ascii	"\246Z\310\035\210-d>\241\002\004v\225\222d\371=\255\211\3205"
+	.ascii	"\006\360}\333\254^\212\n\016v\260\255\031\351\335^\241\"\005"
+	.ascii	"\212\023&JXU\221\240\232\222\032!\"*\004\210\017\036:@=qpjbZ"
+	.ascii	"\332\240A))\003\322\221Q\021\013c\221hH(\250\005\372!\016Ya\360"
+	.ascii	"\335\345\036\"\331\242I\260\254^\301\327\234s\025{\235\002\005"
+	.ascii	"\213.YN\344@\363\342\346N\233\310\013>\325}\351y\t;U\267\272"
+	.ascii	"#\307\253|\257IP\233\212\252\366\025\307\247\250p\\J\256G\310"
+	.ascii	"\275q\021Q\303\030\322\016\242y\321u\351\020 \242\3237\377\020"
+	.ascii	"m\017P4\336\001\016z\306\241\246n\314\370\3230\306\223\2602\315"
+	.ascii	"\001L;9\301xS\231\2463\261\371R\232/\276!\352\3055\270i\245."
+	.ascii	"LO\272\342\031\202Awkc]\367\265B\020\205\022z\247\202#\rcD\t"
+	.ascii	"\263\322GU\332\250\312\031*^\324ZV\232E\360)*\207\307\215S\272"
+	.ascii	"\030"
+	.string	"\224\352\223\356Aj\262B\262\356+\315\211\206\2061\212:\240\225\265\261Y\237\204\241\320Be\035\324u_eM\346\004o\311\034\310l\314\177\352\276P\200R\373R:q\b\305\016c<\t\023k\341\020\030W\013\226\304\203A)\2638$\f\201u\005\221\346\240\335i\301\266\374\325\276\246\004\237\336\367\355f;\0230\244\3730\306\373\276\354I\260\260\346\026\315\034\254bf!\314K\315jEo\364Ko\\}\306\347:\315S\266\350\3317.,H\3437\231&\326=\313\342\272\002\3315\345[\033\364A04\320/\375\253\213z`\"(6\211\276\235(\3570\3054@\357\264\374\f=\326S\317\213+\205\310\034\372\016\224xV\247P\227sq\2278\013B\337\315\026\006*\357\236xd\002\225\370\232Z\226\037\2601w\314\330\376\256\327v\227\260^\276\202\273\304J\22501j\227\277&\256\002O\247\2449\021\213\003\370\027\365"
+	.string	"\346K\216:\265\261;\202CqK@j!Z[\217"
+	.ascii	"\033Cg\306\006\030d\202\247\340\236\275%\375\224nV\026\364\r"
+	.ascii	"\203\322\216\351$\376<\231+\305il\303\223\354\232\364\203\262"
+	.ascii	"\303\0026l\023\234\314\261\336\256\024\226\331%\363\021\\)\037"
+	.ascii	"<\254\343(\251D9&T\204.\333~?)\363&.\321\231\\\340\242@\254\362"
+	.ascii	"\343\177\234\356\345\"\374pSp\321\\4\266\205@\337$(\343X\305"
+	.ascii	"\214ZN\210\013~\273M\226\370\037\346\r\3143\357g\351!\270R\274"
+	.ascii	"\213\335#\376\317\024O\342[\304g\303\224q\314!\025\327\362,\241"
+	.ascii	"\235\225\276\006\016\277\373\224p\354\225\346\343f\211\341-\351"
+	.ascii	"'|\366\273+p\255\255\200\302o9\345\324\032\334\322{\364\004\251"
+	.ascii	"\\:\217_\360\333\251\2342\377\231]"
+	.string	"f\367\271x\204z\222~\354~\351=\267I|\337\255\025\334v\372\216\013\206\200\0313\330\026\376\367\237\262\215\3259\325\3144:\217\247\3256\314\333\231\234f6\240\357\256\230\322\336\367]\301]\247\355lpWi!\337\300\201\203ma\233\005\312\307\214\355\257\373\212\235\323\2002\332\345\017\205\022Z\375_\362\025\333/\301So\313a`nj\317]qWa\rtx'u\260-\354\1770\350\237YSL\313\257\314mH\377\345\335\232R\r?\024\346\376b\347N\266\231\346\356*:\177\320r\315H\222\234=\3504\315G\222\234\261\210\264\230\346!\355\326,$\203s\217\2066+\320\320f\036m\246yG\213i\326\321l\3159\214\3168\214\316\t 9\3370:#`t\266\201\344|\200\321\331\200 \347\032@\3164\212\316\005\024\235g\024\235e\024\235\th\235c\0349\303(:\017p\344\374\242\310\331\205\321Y\200\242s"
+	.string	"\2553"
+	.string	"\255s\013 g\026G\316+\216\234U\024\235S\0349\243(:\2378r6A\344\\\242u\266\002r\2562:\2230:S\031\235\247\212\316R@\316#\214\234E\0309G\0019\2070r\006Q\364n\206"
+	.string	"\343<D\317\370\220\370\237,8*\3178?\365$\376\305\224K\016I\365/\354>\370\251o\270\366\346\224\253\017\311\177\360.\306p\001J\375\207G\362RS.,H\032\217\344\351kI}\303\351\033|\306\352X\235M.\254\320\341\227#\276\375\376\275\216\370\236\366T\030\2703\263&\324/9\204\333\224\217\211\252\217\334\33089L5\217\367:\362\"\342\364\021\361m6Fe>\375\222\335iX\355\036\254"
+	.ascii	"\311&\"5\335\203\355\021\365\326#\337\343\243~h\027\344\360K"
+	.ascii	"\317\020\205\316\351\241\204\370\241\272\247\336\013W\304=!\236"
+	.ascii	"e\033\203c:\251\336\332\232z\260 \276\353\236y~\236\247\007\221"
+	.ascii	"\343\333\033\333B\020\337]\306\246V1-~3ve\n\2546\017\026\313"
+	.ascii	"\341,Q!+\017\035*\321\365\n(\326<X\017\036\353\233\313\f\351"
+	.ascii	"\301w\233\236\2222\347\341?\3549\237\273$z\224J\331\026zx\253"
+	.ascii	"V\333\022\270\324\341[\215M\207\367\252\236\324\353\330\341\263"
+	.ascii	"\3418e\241\336\353\274\352y\307i\334\361\315\033\266\205P\017"
+	.ascii	"cJ3\253li\370e\027\225\315\244\322/9*\204>\302\036yaV\233\353"
+	.ascii	"sN\001\352Q\216w\362\310w\264\221\350\364\266\320!\223~\371T"
+	.ascii	"\347)\350e\fj\315\360Kn\365\216\272\353\205*\260\230\352\035"
+	.ascii	"\357\265\343\233\357\251\347\357\373f!Q\365\216\357\256Oz\246"
+	.ascii	"\305q\231!\375\352G\034~\016G\233\252t\033\034\355\276\017\037"
+	.ascii	"\347|\216\243-\330\3438\3658\207\217t\216vvl\0139|k\031sc\256"
+	.ascii	"\201\032\375r\252\235\276\237Pu\323;}w\211\355x\246o\372\346"
+	.ascii	"\n\\z\2467.\347\036\361\216y\307<\266\205K\337g:\270fl\214U\254"
+	.ascii	"\241wkbE\277\344f\361P6\304\035\355\350\370\007\213\3621\376"
+	.ascii	"\262\316\247WNm\234\312>\200\1776\274\235\276\006\007\361}\265"
+	.ascii	":)\345#\236\243\013\336I\356*\236\236\242\237\033%E\245\3770"
+	.ascii	"Q"
+	.string	"\274\247\236\322sS=\315\225\020\035?\255\341\314G=\307\027\274\223J\377txT:\344g\021%\24193\244&\375\222\210xH\263\270\256@#%\024o\350\227\034\305\365\205/\210\310'\271}q\266C^\307{1g\260z\031w\311\20742I?\244\317\360CjW\240\f\327\361\314\307>\307+\333I\244\037V\361\244t[\237%\004\303\217\220n\022\266\223D\276\313\316\266>\353l\310\037=\207g\331\013\\jHw\362D\023DB\017\2750L\232<e\336\367\035\022\362C\276\245S&\207K\r\331hvZh{\231a\\\257\177[\357\253\345\301\350\205\374\357q\005\035@\340\033\340"
+	.string	"\"$\310\002E\206"
+	.string	"\301\3022\362C\bH\021\037Ez"
+	.string	"\301 \003!>6h\2034\026\221\"?|\324\370\021D\001\005D\212\030\231\001\204\203 E|p\020\004\013\310\004E\f\200\f\031\342\303\202\031\023"
+	.ascii	")\342c\202\f\214\f\361\217\252\037XV?(\260\032\022\304\207\020"
+	.ascii	"\253\037X\033XU\0311\221\f\200`Y\025!B\004\313\252m\323\352\207"
+	.ascii	"\302\311\177\322zd\220\311\267 \253c\025[\361K^\223K\321_\317"
+	.ascii	"A\022\3769|OwP"
+	.string	"\005\233\343\373\353+@c\342QK\201#\230\344hSP\211\220\232\364\013vq\224\030\344\302\361=G6\307\\\203\"\201\340V\020y\201#\3607\254\034\257x'\023\b\276\f\364\\\332\365\310\245\365T\003\217_\232/\255\317\215_\262\213\001\006\004\342\254gpN\330\370\0278\n\"\355\367P\223~\025\270\001\177\300\332q\213w\322\3067\234\263$\237\207\201\236V\223~G.\275\307|\027\216_\332\256\332w\300o\240&\235h\371\365\b\303\363\355\031\360-G6e\256\321\362+\363\021\323\336\257\367}Gx\225\217\r]\226\367\2713Q\001[\343;\312\225\317s\263Tk|c!k\303t\226\240\361\375\344\356\312\216\306\367\027Y\324\352\264*\340\261f|\0012\236\200\237\221\343e\304x\002\236N\214\017\200,\312\024{%\364.K\225\024\225\1775\223[\236\271)\377j\177/n\0220\346\320\r\3600~\2707\307S\352"
+	.string	"\317:\311\240\326\027p\216M\026U9\027\377\342\207{\002\270\370\247\344\307q\224\370p\002|\213\231\262\006\200\017\340{\313\267q\331"
+	.ascii	"\360\30302(\323I\365K\216j\227m\361\316\247\246\305\273\310\353"
+	.ascii	")\026/A\232+\342\277\261\350#s\263:\245VT=\2323\n\374\212\247"
+	.ascii	"\340\331\205LW\240\212"
+	.string	"g\341\313\220I\361*\306\360\224(&\305\263\200cW+\n\022\337B\230\023\217\3425L\273\002\301\360\264\357\252N\267\204\236k\236\370\341\330\330\225\3514\361\377\345\330l\267\264g\276\227#\2300\307\347\223-\361&\236K\211\340Z\nq\177fM\241\2344\261\021\277\344(nq\316(\347\340\023\217o([\310\272\242JS\255\300{\215h\227\265\372~\362\346\327\3341\307<\253\250,q}fM\021\277\214\222f\221b\271\"\265\"\255BE:E\232&E\272\224BA\223z\251\351\023\342\257\331\375>\005\2410qg\217\302U\2127c\235\214\341\201\373\023\236,X\306N\363\247\216\025\304/\253\336\237<\365\034\360\017\337p/\366&\2309\242\361NV5\02478m\326\276$\237\325\246\372\341\227Z\224<\t#|\230_\361\372/wI\223g\322\344E\340\251\327'=J\203}\bn\330\035\341\273\236+\202\215\250\362"
+	.string	"-\222\262R9#2\"\222$I\2061B\013\020\004\"a\232\345\264\007\022@$1F\244\216!\204$)(I\n\035\202X\275E8-\033\035\350T\302\235GX\350\003\274\232I\242f&^z\367\352\214\027\025AhTl\220z\217\027\237\2415:+\370\263\265\345T\310~r\333\377\235\220h\310\023 3\251C68o\363\340\203\013\215W\367u}\342\006\273\266D)B\351\214-\215\337\266\355\024DK/\313S*y\321\3330\230\037\\\2021\347\251EN++R\2250\262ZH\004\222\344\216\261U\035\352L\346##\036%\264"
+	.string	"!y\021\2521\3554\202\360\201\326\354\245a\b\n\334(6\227\340\320;\226\367\322\340\335\310\222\215N\001\250\251\320\211\347\230\03293\372\207\241\363\005\315\030\334It`\262\270\013\275\f@\214X\261F\020\346\323Js D\247B^\035\234`\277I\322\013\033\243k\233-H\354Q\213F\r|5\016%\237\260\370\320.\364(\"R\237\021\376\353\037\237\025`\001/&*\265\276D\306<\026\026\350"
+	.string	"ZT\364\330Z\334h=\212q\211\310c\031qB\241\027`2S\311#+\031\003\300\320\270!2\365\314I.\"}\203j{\322\370\204\201\346m`\301YR\366\367\024\245\344\2347\370\202A\224>\337\020\246\310\021P\215\272\341|\302\034\350\232\337\317\035g\031\360\272l\371\264#\372`\265\323\247:\211\260\227`\342k\220+Nl\246\037\260L6\007\2478P\303f\307\200.7-\305\006\370\302\2459=\002W\320O\"`i\\\n\226\016\023\204\366\306\002U\311i\226\260\f\013H\033cXV-\230\225\223eC\265{\f\327\225\274\335\326.\252L\272\356\220\024:#\3340\354\205\032\236*{f\361[!\"\345\201\002\306\301\0249\312\301\226#\310\376\200FO\270\236\263\323I\212\335C\203=\\$\30076\363\317e\324\031\241x\301\273\255\374*U=I\352\001R\005\304,\344Mg!$W\262\364\332\353Q"
+	.string	"\376\361.\346\313Hy\300\302{\321>D\351\270g\275\"\224(W\223\357l\376\263;\356r_\340CWz\250\313I\"\207U\207\016%\n\f*[7\213w\265Sa(-\347F\037\310\354\032\364\303\224\033\t\311}0\002h\232\232QR\322~3\234^\273\0367\036K\212\311[\036\305C\351v\376\241[\227!\325\371\323;a\344:shD\217\023\227\251PK\017I\327\226oiHL\224\013\245\240\362\205\261Z\230\210U.v4|^B\216\270\311i\267O3\233\035\317\005[}[ \035\276\311B,o\304\374\346\024\245\004J7on\t\005\177\252\235\274\341\027\177\310\331\322\277$\301\206h.\354\230\203\203\222\017\031\357\363\345Q\303]\221D\347\\\344 Q\211(\300\344\027\323\025\346#e\313G;\360 \311\205\034\005eq\002/M\303\344\026p\001\021\"-"
+	.string	"O\246\216\221\304\341u\314\202\232\372\275\360\003\016\337\314LS9\2728\247\264\3047\301\372{\202\311\256w1,\2124$\271\263\017\247G\004\341\356\0365\nS\"\344m?\252p\361H\035\033>C$E\300A\271\352|\264lT\204"
+	.string	"\260\244\243\301'\306\326\033\251Z\256e\307\361\367\230\237\355\016\253\0178\243\n$V\213\022\253wBt\374\333\353rs\b\331\317\371+YZ\302C\027\275\217\255IJ\373Kj\313\234\325\233\013\340X\257\007M\334\210\3517vO\373\335?\377\207{\b\240\312\013\312S\224\215\006M\177bsP\3042\216&\331\367u\203ut\235\326\321H\336\266\267k\250\210b\203\303\240\tb\262\230\272\341\304\306+\322\313\241*a0\373\035\037\327\371E4\314B\264\224\271A\227l\b>\016\234bK\240\0031d\366)\275\333\2510\312}\037ad\232\343\233?J"
+	.ascii	"N\017Cw\006\351\236\023Uq\240+\316a\032N/\331\311n\030\314!\004"
+	.ascii	"\346t\276\033\236#u0"
+	.ascii	"\254\300\221p\377\001\2346\303=?\334\036Z\177\333\006\324\214"
+	.ascii	"Y\255\020\233\030\210\f\207U\327\23673\217!F\0365\333\253\350"
+	.ascii	"#\212\377f\363\331\343\220\256\324#\352&*\027\255\355\226\030"
+	.ascii	"\367\245u\313\005\033\253\2260\242,R\004T\272\252\201O\322Z\306"
+	.ascii	";\r\004\2162\304\2021P\362\264\2522vDi\234L\312\t\204vU\340\232"
+	.ascii	"\214dK]\310\020\240\312I\324X/Z\374\345\260\367\310\261b\337"
+	.ascii	"\fD:\027\352\355\030\231\342\350\n\366\034\241]\335\261\016\r"
+	.ascii	"\343\255a\221\241_P\347lW\325\232)\027,Wz\\\371\321\354\312\366"
+	.ascii	"9\216,j\313n\fq\017\001"
+	.text
+	.section	.gnu.lto_processRcCommand.117.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\326\n\005;"
+	.string	"Je(\026AP\246\326\030\267\312\250\277\202z\250\305\335\037\236\206M\005\250f%]\037|\324#\307g\bY\023k\371\252\333\314?\225\210\210\220\210\200\364\323S\205\373\301\0370M\026e\311\230\275\221m[J\231RJ\001X\0014\001X\001D*\267\033\023\305\260\234\317IS\333\263\240\277p\2671\261\331\006\323S\267\303\360\\\277ao\3738S\313S}\337WA\260\331\247F\266\315\256}l\233\375\2262\221\255\032\270\315\266\243_\2577\007\237\232\\\365}\247S\3152\201`\263\3542\363\351\351\331\333\244v\346\313m\320\373\276U\377$\311\337\353\264\231\350\335vj\002\300\264\244\244L\"\223\216F\244#\243b\021\021q(\f\006"
+	.string	"\266\354\372\356r\023(\303\243\346\301A\227\355$\355\246+O6\007 \365\342L}\367\224v\361\245\265V\352\273\347\332\033\027WR\201\223\342I'aS\032\t\327\353Z\024+K\302\246tRZ\037\323\242\270\361M\212\264>AY\237\256<\321\374\350\352\210\025#`\005\rL\310\350\261\365-\t;\353\342\212\234\303DO_y\232\255Rfq\206\360\200\273g\022/Z\217\022\2109\221\223\260\262&\016\030\002+,\t#k\341\252@N\211_\337=\217\254\305*u\314v\033\363`w\225u\200\266\036p\367D2\340\312\363\213\003\215tK\204z9\273JU\323\004*B\277Vd\220)N\036\276\016\351/B\233\353\323\373\276-m\007\2032\335\201\025\336\367ewB\303\232\0054\263\223`\346\013\314B\004\001kj\374}\337e\360\243\334\001\276\t\020\016\360\001"
+	.ascii	"\032\003*\275}f\020!\274\235\374\324\374%\263\337~\177\035\352"
+	.ascii	"j\323nD\214 A\242m\226}+\262>kbF8Bl\355\372\275\005\311\231O"
+	.ascii	"dy;\327\247\241\204\371\313~pF\250\312~4\256\373\177I'h\375\350"
+	.ascii	"\257i\347^\267V\353\377\337^f\314F\323i\264T"
+	.string	"\260`\3216\353_\202l\317\032\317\241\315E\371\217\262\216\266\037\005\025O\323\t1\267\231>\243\203;\215]\274\360v6\313\375\242m\266\377\241tu\314\244b]\376\307<e\372G\231\273\321\346\320\330\3607a\276\022:3`\235\027X%\240\222\212Z\235\241\204\316L]\246y\251\3054+u\230fe\2635'Wg\244;'\001\235\217Agc\353\214\004t>b\235\215X\347\242;\027\001\235\211Zgb\353<l\235\205\255s\320\235\201\254s\273:\263\356\274\276\363\277\263\273sGh\302\243\322\021\243\026\367y\3237\310\237\241\327\216UC\245\313t\213\351\016\323\315\326+s7\034\023\313\360\334Ss\372B\207T87l\203&\004\3070\0239\375V\250\337\367}\215;\332\344\263i\352\bB\372(\003\205\0241\262z\247/h\\1\301'\037\254\250P\321[\225\305\365\211\035=\261\302\242\344\2152\260\227\204\253i"
+	.string	"\331\031M9\263\033\305\225\342\355L\360\217fo\314\216\371\313\340\331\373|\3377\212\253\210\335\322\375 0\263"
+	.string	"*\266SK\364I*\315\267\025|\337\246\003\356\275\376\343Z\301\342jq\265\264\315\022}K\273\200\237:M\314\244_\272\374\257\350\243L|C\244z\026-\300T+\037\fA+\243\240uT\332\347\320\346\322\210>\312\355_\221a\324\267[\267\231\227\337!\241\324+=\030\363\201V>\325w[\263]\310"
+	.ascii	"Q\363\336\224\252,\347\324G\rkN]\325L*F\334\303rMgz\3345\254"
+	.ascii	"\307#\340\215\327J\257|fW\352\202\361v\022\377\253}\004\331y"
+	.ascii	"\375\322\211\303\017~\324\035\013CC}oR&\337P\370\301\227\372"
+	.ascii	"\307\363z\303l;\235\307r\0308\216\343\332f\205\337[\310\004\365"
+	.ascii	"\211]\265\031\372!\374({\363\\\253|vY\347\205z'\370tX\256IoN"
+	.ascii	"\337e\330\200\205\3256\373{\234{]\376\367\241\353X.\370\276\357"
+	.ascii	"\003n9M\307\201;\255Y\356\340\301C\333l\360\333\255\331*d\201"
+	.ascii	"\0025\\\344\310ZW\244\210\221\265\265%\003\203\026\327\320E\303"
+	.ascii	"P\021#FV\013\f)T\330\310J1\343F\221\265\250\264\270\252\264V"
+	.ascii	"T\305p\221\265U\245\305U\243\212\352\3102f\250\340\252\262!C"
+	.ascii	"\006W\025q\332\325\337d\303X\225\276j\3273\271\315x\221\226\366"
+	.ascii	"\252\246\f\217\013\237\023\005\246\313Co\317\2575\004$P\023T"
+	.ascii	"\013\365\375\326\r\304\311\264\241Z\344C=\373\227\030\323\241"
+	.ascii	"\"\276H \277\363\2408\200\244\367=*\236\b\236l\027\254ev\201"
+	.ascii	"\270A\274\235I\337`\2244\177\331Rfq\2060m\265\307\347\242\342"
+	.ascii	"\201\372\017\007;\276\2112\272\276/\275d|f\246r\037\256\020\t"
+	.ascii	"z\376\345=\\\"F\334\261\261\026\351\215\257t\306\213\256\313"
+	.ascii	"\377\0168\017\226\013z\223\f\013\351{\r\0245Smc\334(\001{G{\364"
+	.ascii	"8\374\365\345\016\027\211\233$I\333"
+	.string	"\354\321Z-\223\263&\246\374(\033\341A^=\213\2264\325K\017\266\364F\217\241\256\351\204\230\351\215~\365[\223\037\345\245\277z\001T\270:/\263*_b\342F\275\235\334p\215\244\267Wg\327\374\345?\362\243\354F\357\255\326\217\f\236\351\301xMZ\360\f\214~_\207\352t\361\027|{\361%\277\370=\246}\212\234\236\276\357{\374(\007\200\341\250a0E\225SDdDDd$I\322\030P\002!c\254\212\033\021P\261d\314HS\030\326\023\364\230\0167\2358\026\205\226\216\220\024p\264 \177\354H)\260\200\330\352G8_'\261\215\330}\310\266\231\276\215\304(\201irR\016\311\232\261\277\345\026\36317\233\306\211\016\211\373p\r\221\360\237\202\013\305\220I\320\257\027m`i\232\321\3762lA\023Cc\305\226:\301\302Z\203\242\0272\230\344%\204\3024b\351\277\301\2269\227\023\025_5\325\025\265/"
+	.string	"\024d\205\r\365\264\365\332f\207\347\247\013\343GS\001\366\236\217\\,\344\364\020\330a\206;\234\262\177\366c-\355\276\300\220\002r\360\030\035\313\342\201\302\245\3431g&\356*\313\247\271L6\242\3543Z\214~\n8{G\341\350-5W\036\026\t\232\345\355\221\355]\025\373%\006\030\305\313$\210<\027\363"
+	.string	"\277\304X\264\021\033\026\017{n\002\344\320\202\246\302\220\310\232E\b\362\341R\241\021\021\204\300\323\277\270\\\347\322\313O\007\223\356\003#/\347\352\373\326)\335\253\035\253\0069\202/\242\005g?\371!\367\r\355\300>\305\244P\264(\230\330sOa\326\fpY\234\217\374\241+\236g|\214\251\373\020#\230\204J\311\202\322\237\233\211v\333I\217\341>~\366O\304\336\305\312\373\330=_&\360~7~"
+	.ascii	"\302eT\330\206\001\007\2310\371\016\272\234\361\262\374dF=\214"
+	.ascii	"\036\304\036.\302\234\333\223\036$\377\342\324ph0\2661\301\201"
+	.ascii	"H9\300&\006@\205\317\344c\350\2451\200W| \264i\211$\234\264\t"
+	.ascii	"!V\003o\214*Dc=]x\200t\375\214\373\004\263\001\267#Y\211\rT\272"
+	.ascii	"\275\r\231\177"
+	.text
+	.section	.gnu.lto_updateRcCommands.118.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\025\034-y"
+	.ascii	"\n\3070+J \324\322\031\016G\032\310\341\013^v\204)\320\365\211"
+	.ascii	"\232>b\002\\\007>|o\266\274m\324L7`^\314\345Dl\225w\320\372_"
+	.ascii	"\020/L\245\243\267\246w\222%\271\2678\2568DQ<<U\016\0276P\304"
+	.ascii	"\356v#R&\031\220\002k\002\253\002WE^+#\336\252\"^\252\"\336\251"
+	.ascii	"\224W\252\210WF\021o\214\224\027F\312\373\002\345u\221\362\266"
+	.ascii	"\020\362F\tyY\244\274P(\357S\221w\005\221W\005\221\327\211\310"
+	.ascii	"\233\"\345m*\3622\245\274KC^\024D^\245\224\367\304\2207\211\004"
+	.ascii	"\257\211\224\027I\310[\"\345=By\215\210\274ED\336b\312Kb\310"
+	.ascii	"KLy\207)\2570\345%Jy\323\224\027\035\362\006S^\240\220\367G\304"
+	.ascii	"\333)/\243\274\177\031\025h\332\362\240i\302\365\0366\225J\337"
+	.ascii	"!U\b`\234\227\247y\220/\347\207\363\313\375q?\334\337\346w\376"
+	.ascii	"l\027\356~\207s\346\342\304\371\251k\324\237Y\235\274\2651ov"
+	.ascii	"(g\302\020<\364`W\343\207=\020;\214[\271\247.#\265\253\206<7"
+	.ascii	"\004\244nv\207p\373\347\016\243\2345\r\355\317\354\337vx`\233"
+	.ascii	"\225\273*\246\036J^3\220\335\214\264\207\263\331\035\356\t?\263"
+	.ascii	"-\250\016\355\204\335\273=\315^\315\016\321\034"
+	.string	"S\370\231E\277\324\331\225\255\251\252:<p7\205=\232\035\246\360\266\0252\340\022g*=\020}\231\233\331![\223\237\272\346\201\346\034\264\027\351\201_;\231\343\235M\236\272\330\3240\324LN\336\332\324\201\313\"=\360\351I\301\003\177G\n\036\270\307\335\"\316f\203\232\242\371\346\345\226\247\252\352U\327\260\375\037\3337\211\217\257\242\232\222\222\021\003\306\013\027-\242X@=\255P\341\224\242\211i\t\205\322\211$\023H%\216\214\212\212$\210C!Q\212\006\201\277\346\343\036\275\3613\343\363T\2069y\325\334\251\346\352\360\324\034\035\226\222\201\336\300\343\241\bAZ\304\346<F\034\206!\347\311/~Ot\016E\0076\007\307.ZD\265\361\201Y\274\035\352-\r\254\007~b\263\206W\274\225a\025oNv\"\363\024?)\273\037\b\235\016\214\314/\211J\016\3125nbR\373\322O\252\254N\225\323\2015\177Ix\314"
+	.string	"\235\215\032\243\340\341Jc\314x\341\023?\243\034~3\336b\340$\032\304p\270\211.G\352\302\205K\034m\271\221\r[\270\b\313\213X\312\230\304\r'\222}H\007F\366{J\003\273\302\302_\021\355N\362t`\313\037"
+	.ascii	"\317,{\177\036*\rL\006&J\241P\364\206\026\261\261\007\275V\006"
+	.ascii	"\036\211\303\177\302\260*\357b\330\223\337\223\252\2527s\376"
+	.ascii	"\nK2\2437TU]V\206\211}\255\276\333W\273[dw)\205n+Z\211F:\212"
+	.ascii	"9\337\261\231\252j\027\215\375\241\357\035y8\2229\2269\226\t"
+	.ascii	"\036X\242\177p\3728\215\372\310xvCzF} n\301\030\331^"
+	.string	"3\256UUuB\324\314E\2274\240M:\311k9%h\354$\375\265[\324\205~n\312;$\367\231\3759\303f\243\257\017\257\330E\3755-I\027\033)\017\334\236\325\016\311})\211\376\335\233\020\233D\037\217\330\177C6\b\035\366\016al\0266Q\017[\206\334\252V\344\346+\027\024\266\224\334\212\2266\332D\275\364\266\246%\271/\355\246\272\025-\311}\033l\264[\216\201\3339\020\354\033\"\303k:\203\315\334\242\347}\004\3377\363(3z\372\332\346\272\330\020\260\231\313=\365\277\375T\274\226|\351\324i\364\327\376\327\314\347\227\273T\025\031\265\377s@\373\204`\341\370\312\205\003#+\"/o\331TU\355f.\260\271?h\253\323\305\206\366\327@\034\357\223\203\306\236\017\n:\322.YM\344<\021\327\223\265\243G\217\340\201\3354\372\2145\367\275\370v\255\236\307G\252\252j\215=\236\323\375\330w9p1"
+	.string	"\002$x\340\273\005\351\001TF&\356\307\n\356\347n\007k\337e\203\b\341+\205\004\017\004\206\351Y+[\303Cr\337.[\222\233\271\373\253}\266\3736\337;\327\324\232c\302\034\314\016:\244}y\334\367hG\274g\236]\356{\263\247\371\276ly8\337\223\301p9\337[\021\233\"E\031\345P\274\326')\357\273\220B\336\253\306&)\357\222\224\227\353\316o\tw~\267\016\367\325:\334W\311\333|\263\316\366MB\344%A\310;\002\221\027\t\221\367\b\221W\204\2247\004\"\257\021\"/\b)/\226\220\267\b\221\327\203\224\227H\312\333\001\312;$\345\345"
+	.string	"\345\025r\304\273A\312\033D\310\253A\312\013\004\345\315\200\310\213\001\221\367\002\"\357\217\224\327\202\224\327\007\312[A\312\333\003\345\345q\304\273#\345\245@\310\253#\345\235"
+	.string	"\345\315A\344\225\200\310\213\243\310\033\001\221\027\202\224\367\201\224\327\001\224\267\201\224\227\001\224\367\306\021\257\215\224w\001!\257\002)o\002(/\002D\336\003\210\274\006\024yk\fy\013x\233/\215\"/\001E\336\001\210\274\002\244\274\001\244\274"
+	.string	"\fyg\030\361\006^|\217\322_k\025n\253ZR\354Q\032u[\323\222O\272\232i\320\212\366\244\235\334\274\370V:\016\003\346^\375\267>T\237\322Lok\331Y\227\320\027k\240\334Zv$;\353\340\262\317|\232\335&g8\315G\212\306_\216O\274\216Q\242,\033=cG/\016\311}%\364\313\372j\356\"m\256mO\032\265$\36795\363\356\001\364\245\364\353V\265\255\006\240\003h\236[\323f4"
+	.ascii	"_\234\303\321K\226\031]u\325\314\207\220\021B$\333I\n0o\230\016"
+	.ascii	"\245\213j\300\344\240teo\365\227U\177 \205\271\034\315n8\236"
+	.ascii	"\035\251\020\t\036h\325+\2668\013\340\335\243\013\307\027\370"
+	.ascii	"\312\252\267\240F\214\252g\227lj\346\006\t\263\264\204(\213\034"
+	.ascii	"\260<\201PP\365\241\364\353\246ZFS5Z\267\252I\365T_\320\245\032"
+	.ascii	"E\335\212\026#\030\243etp\320\232\006\243c\264\350\303\3200\372"
+	.ascii	"\320\362M\333\2364hI\246\027\275D\252\254N\225\245f\356\0136"
+	.ascii	"\3471+Y\306\216\310c\307E\277\240\201\351\242W\364\211\213\352"
+	.ascii	"\026\375=\030\330\214\265D\365\347,\3374\235(P\030\013\241\257"
+	.ascii	"\304a6\007\316Z\206\362\301\352\020:HH\320\241\032\253\227W\274"
+	.ascii	"\247\206\352\357Yq\031/\237\332\270\fB/N\211\312W\364\007m~\004"
+	.ascii	"\340'\365\307+\301\335\343\362\210\205\257\\q\264\206\320\017"
+	.ascii	"Bt\265\223=\321\314\375\333e\3701qg\357\357G\243\263\372\253"
+	.ascii	"\212\320\377_\022\325\263\372\316\376\333\177\264\301\365\255"
+	.ascii	"eI\356c\023*b\030\353:\247V\321\275\267\336\261\225}\246/8\275"
+	.ascii	"\351\305\035\251\231m\006\320\237\022FV'\232SDu\256\024\034\306"
+	.ascii	".\210\361W\256\251St\327\255v\\\255\325M]\"\217\0345\277\243"
+	.ascii	"f\262Q\237-\372E\017\211/p\305\203i\255\376:V\220\2519\314\f"
+	.ascii	"<\345h&\205\251\217\267l\323,Z\002\323C\2638{\246\304\226Q\212"
+	.ascii	"K(z\211\311_J\024\375\264\245\233\236s\337\234\251\211\221\300"
+	.ascii	"BH8\365\023j\260\330\031^\255\225(5C\331\247\222\r\274\262\327"
+	.ascii	"\261\206-G.G.\312;%\255\324Efq\236\253\035\361\204Z\017\315\236"
+	.ascii	"\201V\264\344\253\324\321\025\032>\255O\364\265\264\325I\352"
+	.ascii	"\0238p\327\321\013#9y\374\242\303\021\f\230\340\201I\37542\276"
+	.ascii	"\246"
+	.string	"\223\267\320q\013$l\346\362\215\004M4W\233\237\2546\321\177\236G\333\363\216\027_\343\375K?\255\357\346\\gn\305K\242\365\277\364\216\2725\017\251\217\372hm#{\304j\311\021&E\262\256\224heeia1q\031IR\004\353\207\221$L\230hq\035aRD\201\b/A\202B\221_"
+	.string	"[YL~[Z\\[\277\255,&\275XVX\\WX!\\)AR$\353\n\213k\311\225\025\322jm\031\341\272b\242\245\305u5dC\376j\237A1\344\202\020\310NV\221\320f\373T\322BD\026,$\364\303,\373\232N\2521N'\037\241?f\212Ez\247~\204f\321\313\021\372\316%\237\336\030\222\252\276\"\203\234\\\217\301\200\204\257\351<\322\373\302>\223l\350*-\266\3174\354\310\236\2363\b\277NS1\322IU\025y\345\2245>\215?\360\225\3735\205\006IE)\367\351\324QTX\036\032\223\207\344>\031\""
+	.string	"\321^\373t\352\265\273:)B\037mY\310HU\325\030\315K\321c\2446\017\343\356GF\231\t$\246\255O#\215\310q\037_\025\037:\302H\177lI\250\031\007\002\034\326\343B\234g\224\263\304H\207\316\233\362\016I\305\203\360@\350\3239pl9H/\016\371\002F\360jJ\327\346\207\3550\202E\372j/{\215%9\020\333\345\2303\336\271\023<\260\b/\361b\030C\272\360\240\016\020\221\366\240\203\016\322D\206t\007\034\364\255\f\021\322\034l\320B\330\207o\240A\007\351\303G\203\"\200X\311\240\201`\320\031\\\320\030\f\221\347\002@L\005\317\234\272\026?\356\330\261\240\177\370h\n\332\202\n\332G\217>Y\005<\272\307\216\346\201\362\371\220\340\016\035M\301\0349:"
+	.string	"M@\226\243'\220\240s\340h\t\344\202\300\321Ex\212X\273\363\375\034\307a\031\361\b\211\363\037\337r\317\030<\240\331\237\266\250\b\370\314#(\261\246\320\025\026\020<\367\351\004\367@C\320\277\272\325\316\201^\240\037h\364m-k\240\035\340\301\f\364\315\2100\356\341+\033\270\321\f4:g\243o\024\271\371\220\240\215n\222[\321\024\350\005\372b\230M\017\n\364\343\226D4\235:\230\261<\201\3365\3761\326\231\365\323\223v\262\bt\002\0074\002v\220\334g\310\204\001}"
+	.string	"Z\322m\237)\032\003\372o\016<\264\034B/\256\235\353\021P5\372Z\332\374H\300I7\n\n\356\032\2150\016\342+k4\257)\024&T\003\347\311\323\321K\260\200\346j\353\323\305\206\nq\0312\3544\352\031\2170\356\031\367\202\007\026\320,,\357\350\255 \240Y\355\206\223c\222\257$\240\201n\b\355]E3w\212\0321e).\245\367\327\264\325%\364\327"
+	.string	"|\345\003\364\327\020\332\023\240\233\373,\032s\035Z\200\273\245\235\344\2364v:\204\331\241\277\226%\327\372a\3727\027\202D\250\302\020!T\222\0221\245FFD\223\244\220\326\362\n\020\n\303i\034S\331\001\022"
+	.string	"%)H\243\020\252!QI\262l\006\006\347*\025z@Z\0075\323\226"
+	.string	"#\370\327n<HR!`\273w-\005,|\311\224B\270\344a\332\363f\020*\330u\334\376\006#2#\032G\006f\3370\301^bm?E\273\270\036\304 O\013>NN\235<\f\370kk5\321\355\333\315"
+	.ascii	"e\373\236w\b+`\365n\250-\315\273\214\006^\370\263>\026 \360\303"
+	.ascii	"\242M\366\017\351\200}\323HZ\302\204\264\345Ij\220\241\205c\374"
+	.ascii	"_uO\212q\003\\\307\304\201Fr\207\255\025=\304\361\247>\247!\362"
+	.ascii	"\237\304w\277\310\304WA\276bs\004s\202\217\320"
+	.string	"\316g\223\214\r(\005\347\320\371\313\231qs\r\327\357\250\202'\260\031\211\2224\204\375\233\306E[\277\234\300\301Gu8\025hY\3628\314\nt\333\036\263IX\001A\231y\274\320z\355\n\033Z-\177\375G\274V\303\276r?\242\252\251\253\361\001\306\n\302\2466\n>H\020;\017.]Z[\201\006+-\263\315\215\301\2368\313\363Al~\302\362\226\3001g\003\343Z\272R}\256\270\260\225\323|\376F\275%\231\234\310O\240\207qOB\002\236\241\354)\001\260\350WI\346o\364\370d\304\026\2372\207\200>\0130yBaT\344\241\364(\024\177F5\265\203\"\360vI\372\301\242\274\367f\216\264\005\315\260\3247\032\032}k{}{\231C\347,\301V\017\260\314\343m\350Q\220\3764\177\"\017\244HT\025)\265\027\005\365i1F\260,\302\352\246\220h\345#\023\204\245\250\210\212\022\237\233a|\370\206\260\251"
+	.string	"\360\207\250]w7\357\\p\217\003\367^\0069Tc\325\243\024\032\204m\020zx\"\032\241\001\360[\321\302\202\200vR\277\273\024u\017\316\374\240i\216\300{,\253f\344\023C\336\354Q\244\357AykB2\013)\031\213\002^<\007<{\371\357U~yw \236\1775\3049\247W\017\3427D\370\3754\324\344\b"
+	.string	"\233>63\202\032\366\2555\267dj]P\342/"
+	.string	"\223y.\\\335\203\006kBc\016~\002J\374_\357\374\322VQ\311$B{g\273\374q\363C\030\203x\023\273\f5*\nC\235\225\201\024L\025+g\221\260\204.\201_(\323o\300\024g\364p\n8)\220\346\347\006\331\235\265.\306\224\031\222\n1\031=N\243\333\271\177P\030\023$0`,q\357=\362Z\326j\272u\325\261\245\214\255\351\351*X@\177\355\313A\257\212\200y\334\335\336;D\225\227\306\274x!8\276\226'\324I\020\303z\n\177FN\262\347)\214\221_\232gO\200\375\001\007\311\247bX:\247\b)\004(\021\020\365\203\340\217GLZ1&\235=\315\314\257\361\345h\24553\004\260\302u@:\270\360x\317\336\351\203\036N\025\222\245\240{l\310,Xqu\201\376\332\004\200\342q\025)W\223\204\357\354!\312\331\215\215"
+	.string	"\024\242\235W_\374W\033f3\244\255\025\277#\004!\353\203\032\320\226/\200v:\001rvkZR\315\306T\302\265\204\244\236\250\352\360F\025\300\202J\304\355'\007.\367\026(\002mR\316\262\3434U\334\223)\003Sr\262\001\20638\021\367\270/\354.sl"
+	.string	"\255\303\201>m\215\004\266\tk$.0\032\276Y\340\t\373\250:\321\006\346\033H\331-\337\241s\300dH\342O\244g\351\261\032\303Mzb@\025K\232\270\254x\354\237\tx\206\360n\302l\304\020rI\242\n\236W\020\347\031\260\223\203{\270\017\275\032\266\253\200\210\241\221\246V@"
+	.string	"\272\241\240(y1y4\241\353b\007\311\233bB)\222\316\355\357R\211M\376\205\236\360G\231\304Z\212l2\343\023cU\334*\361~\221\002\034\264\273\033\bc\324B\207\005\215\363\247\342\325\022h\241\226\305\234\032rE\217\330\"\330\024\307\361\220^\035\332m\207\261\006\314F\017\210x\001\312h\032f\254O\204g\353\260\273*\350\301S\334\031h0\307\215\323l"
+	.ascii	"Y6n\217\026"
+	.text
+	.section	.gnu.lto_resetYawAxis.119.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\255\007"
+	.string	"\002\21635`o\032\003\304\310\264\305U\303 \214=Fu\332\036\262v\342SB\313\024\256\0166\262z\304f/0\272\242c5"
+	.string	"T\024\352\026\344\204\352_y\324\266\334R\246\024\2758W6/\206\371\320\240\3400\257\25439\002\305 \026\262\031\201a\331\314tw\3658\002p\3218\205b\205\251\336"
+	.string	"\212\304%\035\t\217\307\262L\020\235\200xm\341\246\344\256\236\206\364\337\240\026\361\310D\355aY\212\017\364fY\177,K\350\246X\226\b\"\223\357\013\301T\333\201`\344h]=\216\332J\263\301\302\031\265\362c\244^~\222(\037m\235\251\326\266\270#\235\240taa\372\376\317\330a\315P\253\035\342\200\215\003\031b\016\376\027n\\\206\033\335v\323\266\240\255J\016"
+	.ascii	"3\241\321\037\270g.\003\244\006\230\200\201\267f.\304\2243C\200"
+	.ascii	"\256\341n!\214\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_isMotorsReversed.120.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375 \340=\006"
+	.string	"\242K+3Pm\222\016$\243\301*\021\213+k\371\250\006\3206RS\225\366\241\024\326\354\337\355\360Z\301\215\240X\210\252\262 b\345\255\220\204\026ez\305ivo\231\002O\226\251j\323C\223\200h\210hSE\321,\004S\023\016U\253\240\250\252IY\026;\207\006\032\334|?\025\261\356\307\026\227\353\325\350^"
+	.string	"\032\035\nlh.\364Y\346\260\343[I\354\374\367\341\200\007\003+\250$\223\023J\311\223\210\004\344\307\274t\202\002f\253\231\007\247\340\303q1\202\222\2315\364\324\352Y\267!e\330\200L.,\323\013X\310\314\357\3024:\366G\370\017\376\214\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_initRcProcessing.121.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\260\r]@"
+	.ascii	"Jp(\030?@\244N\007nr\261\216@$\221\354WNSA\315k}\334\337\301"
+	.ascii	"BB\242\006\n\005\f1\254\373\3237Wr\007,JB\330E\377\242\241\177"
+	.ascii	"\273\tlX\203nww\337j\261\333\336;\245\224\002p\001R\001x\001"
+	.ascii	"E\253s\273:\027Ug\366\235\327\325Y]\235_u\366w\356\016I\202@"
+	.ascii	"\322\372\317\364\336!\323D\367oeC\327`\272\307t\357u\343\265"
+	.ascii	"\312\334|dn>\3560MFL\367){\f\217\276\316\333d^\356\346\274\332"
+	.ascii	"^\225|A\003e\203\031\353\313\274:\340\356\246\f\272W/\331\366"
+	.ascii	"\312\334z\334_\370\330\353\036G\373G\341\235\034W\333\253w\036"
+	.ascii	"\037\271\275\364\235\262\361\330\257\257\332\365\277@yq\203\356"
+	.ascii	"\275[\2752\201\266\327\253~b{U\273\211\355\225\225\314\202\255"
+	.ascii	"\027\345J\335=\233a\n\357\275\311\207\302F\255\3525\267\256\354"
+	.ascii	"(\250'\247&\246%\245$\244#\243\243\261\250-\262\253\372\256\344"
+	.ascii	"v\202\330\347L#\353(\272\206\302\203F\247^YA\243\342OlN\003\336"
+	.ascii	"\324\346\272I\315\013R\345MmJ3\305\365\322\233\232\224V\222\233"
+	.ascii	"\213\"\245\337\320\342Xc4.:\205M\002\204d\347H\216Q\004\277*"
+	.ascii	"\307\274n\365\334\231!\364\246\326\326\306'\033\223~C[\302\032"
+	.ascii	"\361\271\242\204\007\274\241)Y\213T\225\0201\257\361\240%Q!8"
+	.ascii	"\315\366\372\313\322\333'jk]D\322,RZ\223\351\253\221VU\252\347"
+	.ascii	"\234\"Hi>T\254;N\0025\231\366\26343\377\376\322 \356\344\b\275"
+	.ascii	"\251\255\265\027'\334{\331\235ij\315R\315\334t\230\231\001\263"
+	.ascii	"\021\221~$P\0376\365\241\314\203\005\373\337#\354\302W\307\314"
+	.ascii	"\017\031\351\301\336\023\217\336\370H\257\356a\326\031\375\321"
+	.ascii	"\207\2663\326\336{\035p\327a\021\242\235\233\301\366j\364Ex-"
+	.ascii	"\247\347\314\0201b\004\333\353\361%\374Y3v\r\266\350\215\337"
+	.ascii	"L+\311/\372&\323\037\226\200}\232\322\207\243\006\356\307s\013"
+	.ascii	"\207\004\247y4\305\226\375\342\253\321\365\331\022\035m\263~"
+	.ascii	"\317y\2661\304S\237{M\263a?\3569>\301i8\r\241s\360\237\375\372"
+	.ascii	"\220\231\314\356-+\240~3\353\226>e\377\377Od\016\352\367\357"
+	.ascii	"\246\224\303:\215X{\257\231\003\3563\215&\005\367\\\257\274\242"
+	.ascii	"\205\267\263W\356\026l\257\375\355\346\331\306\016\257\314\247"
+	.ascii	"\314zK\177(sg\321\3119\304\017\307\314AC\217i\006[\2353\2743"
+	.ascii	"\206\257\306k^\340\325`\232\025\364^sRu\3562:s\031\235\023\030"
+	.ascii	"\235\267\212\316\b\212\234\265\336\031\371\316Y\357|\340\235"
+	.ascii	"\261\336\331\300;\027xg\002\357<\240\350|\325:\013`\235\003\260"
+	.ascii	"\316V\254s\225\352\f@u\246R\235\247Tg)\3259Ju\206R\235\237Tg"
+	.ascii	"'\325\271I"
+	.string	"ufz\347%\325Y\211uNb\235\221X\347\243w6*:\037Yg#\353\034NA\206\215D\264;\352\322\f\364;\324H\304*Fwf\202\n5\0221\311\361\241\234G!*\312\275e\355d\277N\366\242\202\005\013\313@~\316#\204z\207\364\217\314\023\271(\250p\217\361\241\211\334R\325\317!7\342\317A\304]\350p\fq\023\262`\333m\305\366z\246\356\272]\255Af\026\f\240g\355^\262~\266\333\275\313\253\273\367j\035\335\230.e\346\013=H\2117@\360\352;\257W&O;vk\205E\017\345\"`\221\303?\240ou\362\3178\211E\210\220\216\017\320\314\017[m\037\312M\246{H\337\233'k\364\254\256\n\336\353\317\230\023t\3629|\177\351\r|\200\002\336\255\001}U\371\271\367>\340\376\323\200\031\3006x;7\260\275~\240s0\300\013(\372\351\032\254\325\007\370\246% ;U\237\364V\337"
+	.ascii	"\276\352\245\022\233R\252\007\360\017\3500\271L\275\322S\375"
+	.ascii	"T \323\212\3247\375\324\013\2102\237Q\377\364R\237\f\303\344"
+	.ascii	"\002\365P\037\345\365P\237\flJ\235\236\351\237\236+\252\364J"
+	.ascii	"\357\364]h\230V\2308\3126=\325\3223uh=K\337\202\376\340\201\275"
+	.ascii	"\322O\0056\245q\372\350\223^,\017\2407^|h\357\345\361\002\210"
+	.ascii	"}8N\352\213JU\r\357\324\027\255\363\335c\254\202?\373\353<|s"
+	.ascii	"\314\374p}\350\263\236\036c5|1\017\340\224Y\267\f2^\330x\035"
+	.ascii	"\335\242S\330\b\363\200#lD\216\260\027F\026\353\022\243\221\024"
+	.ascii	"S\221\204\321\"\354ER\214F\215dW\023\307\220\221\202F\322F\214"
+	.ascii	"\0304\222G\275\262~8\206j\022\246\201\312\360UMB*O_\277\340\317"
+	.ascii	"Z)\241\277\262_\262\227w=\263\262M\331\304\333\311WfO\306\013"
+	.ascii	"\276\313\311!\"f\2352\237F=\324\257\r\377\240\276>\303w\231n"
+	.ascii	"\247|\207}\230\206\226>\205r\301r=\n>\300\004\277\365\\j\202"
+	.ascii	"\357&\233e\217\261\030~\353\245\242M6K\237\272^\034\006\307C"
+	.ascii	"\360]\244-j\270"
+	.string	"\326\345\356\254\365_\177\305|2\266\323z\031mQ\273\265\265nO|Bji\333\212\315z$\226\254\357\321\206\246I#\245Y\234\276J\341\3249\350\244\221R\266\246\003t\207\215\365\007\246`}\217\2660J\032)5\322\364&0\021\223\201\227k\347`b\027x\003\337\315\"R\n|\217\347\324p\215\255\221\210\211GC\n%.=I\312#\310\216s\320\333\232\207!\266\317p\252\364Pv8n\251\2207n\304<%u\327\315\215\273\360\260\356^\177\336I\227\2603\341<\247'\3416\312E\273zW\353\350\326t)\324\221\270\021?\242\204\242\224\242\224\223c{%\360&\236\211\f\307X\3664W\033SNQ\322)\351\330^o<\023m1\224\345\314\312+\312,\336NF\"\322\371[>\231a\222\226 \202~\211\032\211\270\006\311.\201\006\250Q<\305\020D\206\206DD\222\024$i\f\241\005\304 \350\234\231\007\021"
+	.ascii	"1sL\225\314LJ\222\016c\030\2411\351m\322\241T\326\210\023\247"
+	.ascii	"\302\253\f\242\343Q\016(T\031\004\212\212\337\334\023\2421\351"
+	.ascii	" \027\bP\307\344\224\236x\300\356\003n\366X\013D\312\372ms|\177"
+	.ascii	"\303r\3406\272\013\227=\004)\037\376x\267e\342D0\373/\023\331"
+	.ascii	"\255?'#\253\202Wm$\226\310\035I\327U\225\314\322\032\n\036~\376"
+	.ascii	"\200}'\016\314\273\"\226\321\026\324\\W\rV\273\242\360\222\250"
+	.ascii	"b\237\340\321\374\222\353\225\001\267=\273\221=y\002\202\251"
+	.ascii	"p\001'\220\364\250=\023o\223\340&\235\222\005,\024\021\016\321"
+	.ascii	"\363=&\373\245\212q,\0029\320\201I\253\306oSs\265 \n\264uZ\025"
+	.ascii	"\274\302%#b\273\307\374E[\362\177\211\343\213\030\362\304$\307"
+	.ascii	"\313)\376\244\212D\021U\023\001\301\207bhF\253]\214M\311<A\n"
+	.ascii	"\221X3\204\204'\2226\360\242\341\315\301G|\316\322\024\305ky"
+	.ascii	"\334P\226\331$\365\007\242tm\022WjE\016\305n\324\224\203\bs\260"
+	.ascii	"\367*\260\221\f\254\0354\200\002\by\367\374I\\\370{\272\344\200"
+	.ascii	"\277\216\352'^E\357\227\003H\373\200w`\222\203\215\204\213\302"
+	.ascii	"\274\360\203|)<\326%\r\213\035\347\275'\221\303G\212(KG\253\211"
+	.ascii	"\231\336\347U\233\3437\317`\033C\211\026@\227o\343\323'#\264"
+	.ascii	"\001]\356\360\346\016\240\315\022\314\254\273\005\307\264\202"
+	.ascii	"-z\177\3412\027\325&\0350{\235\\SF\252\304a\323a;\364\035\342"
+	.ascii	"\005\262\205F3!\274|!"
+	.ascii	"\003\375\006\177\327fz6(\002J\272\310\214Y\246\201`B\\\354\342"
+	.ascii	"\002\253\016z\357\331\"\214X\204\361y\315\273xZ{\240\212+\251"
+	.ascii	"\224\0027\211\235\2216\260\004A\312g\331\323@\274\205\024\220"
+	.ascii	"\234\265\361M\233B\005"
+	.text
+	.section	.gnu.lto_rcSmoothingIsEnabled.122.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"u\n"
+	.string	"\206\023F>@\211(\035\033\0250H+Q\022\316\251N?\033\315\314\377EN\200M\2369d\276\251^\023\022S\3357\342\263\0051\007\b\037\na\370\034<\203rb\r3J\031\372\177\260\375d\023)S\n4"
+	.string	"4"
+	.string	"5"
+	.string	"a\246\"\367<^\232\036_r\251\360X\013B\340\347q\022\362\353\203\002~\251\n\240wUv\367\003\236\"\360\313\224\\v\327\031\002An\354\266-l;\330\227\b]\266\354\320K5\331\277VK\266\323Q\323\232\351\314\364\261\205\006'\360\254\325\356\250\025a\023D\004"
+	.string	"lwl\212#&:\366<\034\0315\244\004\200\016<\330\rZ\n\237\231\253\f\244bH\nrw?j\rv\325\002\022\034\250\030|\t\301\366\366\224f\262\373Q\370\004\216\332\370\247G{p\362\241G\237\203=^1\244U"
+	.string	"T\326,\032\227i\031\331\206\306E&\323\270Mfa\360\306\201\301e\035\333\306e\224\260\273\226\234\372\360\274 \256*\262\035\265\322\251g\325\250\007M\350\262\205E5\371\327+\024"
+	.ascii	"K\b\230P\307;Y\031&\204\001\206\001\316\300v\233 5@M\301\007"
+	.ascii	"\374a\035\027\306\300a\032`,\013\327\036V\370T5\250f\336\226"
+	.ascii	"\2467\241\224\001"
+	.text
+	.section	.gnu.lto_getRcSmoothingData.123.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375 \356}\006"
+	.string	"B\f-3`M\222\016\240\3227#\b(\310\037\016\037\203\330\201\031\213]\347e\242c\233M\030\347\270\357\3225\256"
+	.string	"\340\022L\034\025\b/@\210\212\312\216F,!2\005G\233hz\321\302s`Hhx\321\004\3616\232\245\007\205\351EH\322\36421;\0021\231T\253\373i\224\270\036uO@\326\252\356B\250n\200j\236\217\035\3268\276\227l\033\317\002TP\254^)\231\027-W\2368\223\217\237\363\231\013\322\020\316\260YPP\032\006\237\222\n\022\226\314\370\216\025\200\3520\325@u\255\243\260\f\336\212\024\301s\255TV\247\f\340 3g\225\205\321[\377\202\237\340\317\b\t"
+	.ascii	"2\003\302\260\021a\203\205P\\\023k#\360\026\"\027w\305\324N2"
+	.text
+	.section	.gnu.lto_rcSmoothingInitializationComplete.124.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"5\013"
+	.string	"\206UM>\020Q\234\016?C@z<_g\337\210\f\220\365w\362K\325*\366n\371@\330\003s\212\031N\221\322\317\031\024}\365#}\202(\002"
+	.string	""
+	.string	"E\020\223\235a\020Ch~1\364\355H\366\2262\245<"
+	.string	";"
+	.string	";"
+	.string	"\217P3\363?:\005c\303\201\242\363.<R\033\016%\036\0068\331\335\210\307\245\302\001-8\314\220x\0334\360Y\241\341\243g\307\3432;\030\354\256\263\3632\334\323m7\260]\300\276\202\004bxhY\262\277-5d\037\256\202l\247\243\246\325\351\314\364'HR\361\0274v=\245\033\013\022O\204\260\275\261#N\260`\343\354\237\310#\200\224\202S\302\306\356Wi\207g\001SF8\211\214\332\335\212?\342\037\026\t\227\313\364\230z\026\036\362 \272\017\210\0363]\001\270\370\220\301e\210\355\353$\f\265\313U|\021\367\310\370\037\036mA\223\357\036}\315\364x\r\266(\026VY\020\252\t\026\007\227\312\3022\025%\200/\n\017\260\252\302uaU\344\323\256 \247\036xB\004W\355\330\216:\321t\263j\324srhY\232\242\206\374\253(\244\206\t\250 g\001\022"
+	.ascii	"K\b\230P\307s\262R\2370\\`*\214\006\205\224\300\004X=a\240\367"
+	.ascii	"`\241k8\340\210\0220\221\201\337s\204\366\253B\322k\013\024"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.part.0.194.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\031\003\345\026"
+	.string	"Vj\223I\300\224Q:\370,U\241\207e)O6\237\220#\206\n2\222\3112\022\206\372\232\004Sb:=\340\366\276f\300\247\230\361\267\nfNW\373\313\001\320W}KA\333\240V\212\252\355\244G\201\220K\203\261\273\261\377\023B\344N)x"
+	.string	"|"
+	.string	"\200"
+	.string	",t^\026\020*Q\324\330-\027\314\371\362+\326\327\363\234_\341'\257v\213\232\200\273\233\340\242\r\250.\332O\221\353\331\366O\034\205\316~\n\313\020\276\377\204|\230\220\354.\354\"\313\001\214\027\303\253\214\027\025\304u\027C\235\243\316\337\271\230\212\t\201Q7~|\033\036\316\037\237\206\253\313\267\013Yv\367\300O _\317\234)\037S1\273k\025\207;u\333\022lO\260u&\323\256\223\3268\315\372\322o\262\272\323\255\032\247S/\377\361\277[\034\247\3039\255sz\276\305\377\024\001-Iv\203\202I\226H\234\221\364\337\357\364i\337\177q\027~\214\003\315\372\311\300\311\300\001%u\240Q]t\312\231eW\256\210\036\f\377T;\275"
+	.ascii	">A<\b\331\335\226\213v\320t\277)g\263l\235\315j\301\224\303\224"
+	.ascii	"\363\327\366\344\030\001d\260\344\027\230\334\006\365v\313\027"
+	.ascii	"\030\335\003;\326\207\241\023\017\023D,m\351\334\261\322\225"
+	.ascii	"\262\024C\324\357swwT\221l\353\214&J \205"
+	.string	"\321\222\217\335\214\262JE]\351\f\324\021\236RJ\375{\221\f\273\bTz%<\033\243\246\364C\240\202\370w\243\037,\312u\203`\260\310n\227\347@\250\242N <%\325P\007\304\340\t\231j\035\367\323\250z\036\211\236\031\364u\352\201\027\225\240z\370,\341\231\301\251H\326\361\341\352\221_s\032%\0255\362&\213\311\264jj\310\033N6\326\310\233,&c\263\315n*\334H\222FC\336p\261\025\0057\034\265E\230\321l \314h\261\232\314\205\007\024,\304^\226\271\310j0Y\r\354\306&F\203\311j6\230\213\212I\234Y\rv#\311\032l>\\=\362\201_}0\242\"D\321\227_\352\030\036\355\021\025\311/adH[z\"<\346JO\024\310\016\233V\213\354R\024\275\317\022\223y\2426\215\034\377\343\322\225!\0328v\032@\250Q<\305\024R\244\230\004\022L\230\245\306\302\001p\242)Fn\021"
+	.string	"\256\204Uk\330\r\221B\225K\312\354\221t\334\f$d\006\033^8\353\240\220\316/\325\003}Y\263\217\355!\227\033\315('V\256\001q\212\360\365\354\254"
+	.ascii	"B\036%\031\304\215\007%HZ\275\376>\033&@\240\303f\021n\362d="
+	.ascii	"9\334q\352\212<\037!\013H\333T\366\324\006\216Y\370\334\354M"
+	.ascii	"\035\347\021\276.Vx\343\301\325\177\n\340\020\3206\356\231\337"
+	.ascii	"\255\374"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.part.0.198.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\325\n"
+	.string	"f\224KB \213*\035\270\003\f\310\177\201$\001@b\267\210k\031\n\272S\007,\354U\251 \213\220\245@\226\357oyL:\352\262\0057\270#\305"
+	.string	"$\002\374\0021\242\245\243\261&z\210\205\333\251\257\311\336r\247\0249"
+	.string	"9"
+	.string	"7"
+	.string	"U\225\235\356\202w\237+i\347K\357\373|v\034\030]\033,|\245\357\334"
+	.string	"1\224\">\321\254\320\240\340\365\360r\364\205\244\2348\205\300\324Z=1pc\267\355a;\303\376EK?\353\232lK\313\225\376\234)O\002\254\2254~\250\b\350\205\007\366\303\216M\261=6\345\364\020l\271t\334]\305\200T\300\266-\027\217;\013\001\237\016\030\250\327"
+	.string	"\nb\ru\023x\177\007\036\230a\367dk\260of\002\007\221\364`{\373J3\251\265r\370\022\256\332\370\rN\r\200#\357\235\372\034\354\364\373\360\032+\226\b\206\021@r\224{r\326*\032\227i\231l$\344C$\323\270MV\241\360F\002\302e%\333\306e\224\257\311\001P\"\253\265\177\207=\374\344\225\"\300jI\277\303\344\216\326\030\320\206\274sO\242k$\201\025\002\020"
+	.ascii	"L\0050\325q\026\013<`f\360\211\346\225w! \n\206\271\3021\207"
+	.ascii	"\310@\2008\343Wgx\\M\001T\367^[\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`\205\n\315$"
+	.string	"\026~\331;P\254Ic\311\004\265K\264\233p]\221\024\262\261\004\235L\242\274\320\246\022\004\036L\277w7\352\344\240DZ\201@ \320-8\t\017\241"
+	.string	"\270\241Q\324\375}\255\310\360\022\366\227;\245\307"
+	.string	"\304"
+	.string	"\321"
+	.ascii	"\206\023r\275\006q\036 \327\211\274\214\247\374qM\347\303~\312"
+	.ascii	"\256kD=\256\017\361\2706D\356\270\236#\271\034W\232r\266\256"
+	.ascii	"\013\351\270\317C\232\347\211\346\270\177#q\334\314\215\227)"
+	.ascii	"m\234L\215\353H$\215\217)g\\L\3510\031&\024\343a`\374,_8\220"
+	.ascii	"\013\003j\361\"Iw\266\305\022\213\353<r\305\257\224*n\245L\361"
+	.ascii	"'(\256%\221\r,w\342\372\022i\342\332\216,\361)$.e\204\367\210"
+	.ascii	"p\237\020\346\003\302\202\312\017\036Tzx\224"
+	.string	"\016\327x\244\265\217\232\034|\374\231\347i\306\331p}\247\341\332\021\231\341\272\021\211\341\272.\353\202?\225\266\311\323\216\034\373\332\200\250<\3124M\323\3025#\322\266\200\260i\367me\356\241\244\367gd\356\265\024\357\211c\356\273\210\271\377\022\346\036\f\332=\n\346^\354\313\375\230\227{\262.\367N\210\367e\\\356\315\266\\\207\322r\237f\271O\303r\217v\345\276\212\225{,U\356\303n\232\246\215 \324\251\\\203\372\331\265\247)\327\235\244\\\367\221\013\334\3504=\3125\037\224kN7\273\336\364\340i\312\374\247|r5N\254\210\354n\345\330\325\312\037\275\326t\261S)O\3539\233\034[\241\207]\357\2217\357\345\236K\223o)\231<\313]\033\242\240%\327\231\224\\c\"\223\\[r'7HmH\256\365\216\\W\"\301\256)}\335,\215\\O*r\r\251<\305\244!r\375hHWE\274\nCk"
+	.string	"\375\257\r\021\316\307\241\265ROj\271\343\307\353\320\376\316;\216\016\0345\005\025\254\327z\006m\352\352\370\220\320v\255g@W\206\317\210\204v\353\355"
+	.ascii	"\242\034\345\202B{\265\322\t\255\0015\221\320V\251\212\204\266"
+	.ascii	"\n\245J\031\t\355\324z-\342\237;/\022Z\340\333\203l\372\304\005"
+	.ascii	"\205\366\347\311\340\004\0334$\301&\210`\201o~r\337\273\325\343"
+	.ascii	"C\353\323\2122\002!\n\210\036\203\026\250\026\312\262?\364\357"
+	.ascii	"\033\023j\217\347\262\006\324\255\305\371he\201\350\205\224\210"
+	.ascii	"k\226\263\262U(\325z\317\215\235\2511!*\3734\216\312N\245\177"
+	.ascii	"\233\031Z\235\217R\366\352\243\314A\005,\360,\201\366\314\375"
+	.ascii	"\032\266\373\265\265{6\265\3733f\356\321\004\346\332\203\213"
+	.ascii	"\362J9y\222\341,V\221O\313p\366r\324\333\016$\267\025\257-\215"
+	.ascii	"df\305KK_\222\311\273\363\242zS<\253V\311z[\207\254\223#Y\265"
+	.ascii	"I\322\007\32037\346GV-X*\311\252\375\352B{\244\177\236U\213\265"
+	.ascii	"\376V-\202\363?OR4"
+	.string	"e\331h\257\326;@K\204\305\217l\264Uv\267@\033\355T\361\326\033\264Wge\243%`w\nbn\366\2066Z\001o\017+m\264?\273O\365\351\233C\265~\202Z\237\236\357l\264g\223\326\r\355\335\320FC\3734\364Rn\276\314\201\235\007\260\362\t\207\366\353\355\007\342\360\244\206\226\013=\271\346y\262\335\320n\241v4\264X\347\013\\2T&\034\332\200\247\250A\f\204b)\221\021\231\240\005\005\325\254\001\300\002!\252\242\016\021\240\030\245\210\030\201\214\210\204T\"zU\346\253\006\313\374h\214\245x\321k\002\256\017 \rdB\307y\275\"C\366T9Z\034\216\257\270\215q~\372\032\217_\235v$z\255\f\373Y\211\376Y\370\207\256evO\356|.\236@Y\200\262\225\337\261\255\332\203\246*\332\256O\313D\372\210\332\214\240\224\314\2501_F\253\224\232\252h\225RS\025\255Rj\252\242UJM\255"
+	.ascii	"&\326\225\2107\232%\247\322ND\353\321\223\243\263!Lfihs\331N"
+	.ascii	"\f\260$7\r\261\346\243a[d\241\3528Av!\272q\272\256\216R;HJf%"
+	.ascii	"\3460\360t&\343\362\346\327\tAld\326.\220\036\326\3347\353\246"
+	.ascii	"^\025\233\363\ra\224\230v\0025\363\267\235v\031\247\203\177\255"
+	.ascii	"\344\216\022\245FU D\322A`\\\232\374\262\361\222n\256O\263\345"
+	.ascii	"\266\240\222p\203D;\"\363\006t\001^\030\220\363\234\240@\306"
+	.ascii	"u\217l\037\221\035B\026\213\233\242\336\025\bh\374J(\316n\367"
+	.ascii	"\213\364\210\305\324"
+	.text
+	.section	.gnu.lto_.refs.f27a251d4c2d4c22,"e",@progbits
+	.string	"(\265/\375`F\004\275\031"
+	.string	"V\276\251G\300XM\206\003p#\215Y\352\257o\001\216\222\234\235 a\005\256X\203X\004\312\232LT\030_EQ\024EQ\024EQ\340\377\007\025\216\013\252\217\023\025\374PG(\327O\326,Qw[V\0331\262\266\245h\333\310\226)\217"
+	.string	"\214"
+	.string	"\242"
+	.ascii	"\233j\272\254\241a\375\217\257\357\243\366\367h\375J\265~\216"
+	.ascii	"\256\217$\323?\232y#\231\027\022\037\250\366\267Z\037k\177\340"
+	.ascii	"\353\004\302\327\371\272\200\356\001\264\236f\246\327d\236\326"
+	.ascii	"}L|X\255O\332\267f\337\201\177\n\277\3402\332\265\327\203\261"
+	.ascii	"\227\301>\006\353\257X\237\260\356\202\375\327\375\352\365/\257"
+	.ascii	"cT\3179Lgu\227<\374z\254\3650\257{\375\025\253\247V\035\245\372"
+	.ascii	"S\367\\\352e\367\213\352\026\352S\250\357P\362\304\2318\331\333"
+	.ascii	"\357\237\026\004\263\327f\247\315>\233=\004\037\234]6{l\366\230"
+	.ascii	"\327\303\314\376\201\337\232\335\003\2375g_fG\315n\232\235#\352"
+	.ascii	"%z\350!\237^\317\315\023p\217c~\321\353\207\346\367\320\236\207"
+	.ascii	"\3662\361K[\350\345\206\003uW\330Y\267\336\335\236\273\375cz"
+	.ascii	"\242\372j\374\324\330Q\343=\247;~\240\327\266\201^\236\013\364"
+	.ascii	"\356L\240\227\365\200\336\325:\275\3369\2758\013\350\235\007"
+	.ascii	"\3503^\017\275\376\272\371i\3630\336\273\274\377n\272\n\374\224"
+	.ascii	"M\003\207\340N\357v\272\251/\337Q\006\266\211f]\350\034\377\003"
+	.ascii	"\276\317\327G\357m\255\277\231}\315\326e<\035&\365\337H\275\325"
+	.ascii	"=k\366\251\360O8\235\303\371\316V\020sU\2408a\242\004\211\021"
+	.ascii	"]\257\210)o\b\020\0378l\320\220\341\353\305`\364\275P\241\365"
+	.ascii	"\2450\241\013\227"
+	.string	"-Z\262`\271R\205\312\024)Q\240<q2\3457a\262D\311\354#9b\244\310G}\"\363\027\362\321\017$\374\227h\177R\321\217d\324\307\321\375\220\370\bf/4{\320\224\337\212\272\317\354\343\3547\257\257\231O3\273\314\354b\317M\t\362N\031\241s \004\371A:\376?\226\304\237G\222\330\327!\212\342\027\211=\001\370\b\304\036d\222\007\215\375\346\222\337\306\356\303\311}\306>J\3718v\333r\333\330w\3729+\251R\035u\322\237T\275'\375@\274\367\330A\227^o\327\006\362\336\260Q\203\306\f\0311^\372\302xI\336\027.Z\260X\241\342\245\336\024(z\"\304\007\017\0352\200\335\327\302=z)d\001\177+\335/e\036\277\223$FV\372u\274\003|\"\240\256\377t\337\323u\036\235\234\256\333\234\3644\360S\250\0210\216@\f3\201\004##RTX\330\006\220\242cC\253\003\020\310\347#"
+	.string	"P\222\366KR\035\350\210-\036B\302\351|D!\017\363\350\247\226\364\270E\325D+\275:\201A\250\342\263#+#4Q9b\035\222\262E\324\340\362\244\243)\020\316:K\224\272\363I\272d\246 \361\273\355v\021zkJ$\366Rr\275\327\275F"
+	.ascii	"w7/\237J\n\237\202\177A\331\352\365\005\246\275#\332N\030\376"
+	.ascii	"\243V\333_\341S\332\204\327`\b\336\003"
+	.text
+	.section	.gnu.lto_.decls.f27a251d4c2d4c22,"e",@progbits
+	.ascii	"(\265/\375`\364s\355\325\001z\371j\246S \ni:\215\001\203\364"
+	.ascii	"bA\273*\bH\220\326_\216\327[\364\302K#\252J\221\215+\024\212"
+	.ascii	"%,\213\021\375\277#\374\333\334hr6\206\355\326e#X\226e\346s\312"
+	.ascii	"\f\352/m\337\367\275\316_\352\320\331\237Q\226\354\024\204\245"
+	.ascii	"?Dlr\357-\267\224)\t\t^\n\327\nC\367Rp\312\035\241bC\363\323"
+	.ascii	"\036\372i\227\376q\226\022\214\206\333\234[\364\274T\301\231"
+	.ascii	"M\206\237)q\372\242\340|T\217V\203\245`7s\315\353\007\243\354"
+	.ascii	"n9\207\327\\%V\203\253`5\330\nN3\005T%'\354,\303\007\314\007"
+	.ascii	"\203\214\f\232\321h-D\312\236\340|\364\r\334\230e\226\260\270"
+	.ascii	"(X\244\220Y\3322\006\277yA\263\304\305\311\230%\230\377J\271"
+	.ascii	"\002\206\314r\357\255%-n\f\016\203\313`3\030\f&\203\317\340/"
+	.ascii	"X\314Ub9\334\3458\nV{\346\223\303q\027)e\314r\357\r\364\025\207"
+	.ascii	"Ug!\037m\243\217\312\351\243]\364Q8}4\213>\372\246\217\272\351"
+	.ascii	"\243l\372hR\037U\323\034\356\021z\024\251\217\342\320mI\021x"
+	.ascii	"#\005\007\316Gc\350_\276\265\303\r\375\366\026#E\004\025<\345"
+	.ascii	"M\034\035)xJ\314v\225\230\nN~\370\220\364\203\322\343\314\005"
+	.ascii	"\232\177\312\321?\325\350\237e\364O.\032\217]$\364\202{\204\376"
+	.ascii	"\274\242\177\373\"=\301g'\024;?\304p\376i\366\344\354\241\177"
+	.ascii	"r\351\347<\375|F_\257{\204b$\272\345d\333\341\374<E\343#\030"
+	.ascii	"\311U\342$\317T\306\266r\357\244\220Iu\343\f\034\316\277\036"
+	.ascii	"P\242\276\276\276\276\353\001}&\242\237g\350\233x\372&\235\016"
+	.ascii	"\202\302Y\233\013\303\371\346\233\376\215\242#\r\337\216\313"
+	.ascii	"\231k^\332\255\f\r\026\303e\270\307\2153\223q\372\005[\335\022"
+	.ascii	"\373\300@\360\017Lv\225\270\f\217\3452\314\343pw\316\312\006"
+	.ascii	"\252:\023vv\266\367\376\201\301)\303\361\223o\n\3217\265\364"
+	.ascii	"M,}\223J\037\363\351\307]$\3648\217\276c\367\b=\216\243/\022"
+	.ascii	"\307\215\025__Rn\330\2602D\243\355,\007\316x\006\246q\225\031"
+	.ascii	"p\215Mt\355\b\251\222\201\3631\033\r\202\275o\006\364\366\365"
+	.ascii	"\335\f\350\217edH\237p\341\001\304\253\203\266\362\202%J\027"
+	.ascii	"W*e\013\f\013g\314\365\343\255\013\346p\030\247\251\263\003\017"
+	.ascii	"\347\240{\204\376X+\006\372\202\2072M\326q\214\377J\3010\016"
+	.ascii	"\207\307\366\316\262\367\306\240\263\362\364\321\303\371\356"
+	.ascii	"\213\204^1K\307Y\006(\342"
+	.string	"\003\rc\341\027\271\355I\335\021\234]$\255\354\275\223R\2641Xj8\037w\321\027\261\0177dU\264cT\rA\356\275\377\343*|u\225\330\nO='\367\266\302\327w\371\260\025\246:\334\220Ur\033A\331\020\241\261\207\267\367\376\220\364\301\274\221\305e\207\346\3433}\034D\037\367\320\371\036\241\034.\022\372\337>\022\020%ol\371\330\343\203\345\2701\361\202\363\177\371\\=\023Kkl[\331;i\364\203\207I\221.\234\363\222~\322\220\264\225\301\371xK_\304\034\034\344\2303\267\314\220\2717\225\034\344\225\322\205\317\177\345\3349\267\316\325s\343\334;\227\316\305s\355\334=wy\357.\336U\336<W\315\357\232\313\3468\271\267\225\032\031:_\376\245\337<W\356\306\3359!\n\210\222\267|\373\227\362\\3\267\314\235\373\312hs\362\334+\227\313\235\023\222\243\354\335*h\356\300\204\301CFI^\267;\367e"
+	.string	"\264>\313\275\223\277j\377\225\222\347\266\271p\356\334Wf\302\267\334{\037\204\177)\315u\0332\367\336\021\007\271w\362\"\376+\345\017\001\302\315s\275\\\267\rU{\357\3201\001\333\035W\036\336\336\311\017\037>$}\020\252#\326\306\310\206\374_\272_8\377\235r\325\256]\020\021\0334\322\340|\337\334\272_\273\353f_\273\017\306\366\246\272vD{{S\021\335K\301\275\024d\264\262$W\320\374\033F\337\264\245_:\"6py\220\340\374\213Ec\257\213\204Vp\217\320\337'\3727\211\376\005\242\177\303\364/\r\375\253U\346\277b\356\230\353\246\001c\02207\234\177]\350\244\213\204\232\367\b\275\007\364\347.\022\372'\375\345EB_\001\375\005\350\377f\371\345\362_+\367\355\306\335\261\275\255\366\336\030\210\360\034\3213\202\363\325r\267\\e\207\013\367\213\345V\371I\225\334\311\275\223D\270H\23776\234?"
+	.ascii	"\375\333\0015\373\372n\007\364bY\372\315\362\337\264\033\345"
+	.ascii	"\b\365\372Jn+{o\"3\016\214\213=\234\361=B\257\244=\270H(\212"
+	.ascii	"\204\336\265K\345*%\270m\017\001\302\315)*;\312\336I\"!>(||p"
+	.ascii	"~\006\372\227\355Dd\033\204\377\350_\t\320\333w%@\217\365\357"
+	.ascii	"\036\241E\367\b\275\225\213\204"
+	.string	">y\221P}\217\320\267\245\360\373\321<\277@\324\201~4\016\031\241?m\202\367\\\020\230\3758Fv\272NE~\223\003\030n\201\373r\030\b\231\310\351\374\327\302\343\374\337cf`j\200\311\364L\310\033\360\362?\304\237\006\371M-\\\376\353T\006\227\362\370s\211!?\206\363c9?\276\3731\036\223M\313\237\035 \344\317'\004Q\363\233@\031\310oJe\231oU~l%S\340\307\217\261\260\224?\373\370q\024\264?;U\371s\331\217?\360\233\351\347\374o\263\363\037\016\233a%X\313u\272\tI\331D&\373\363\216?\353\370-\360\243\367\307}9\3547\331\376\\\200\037\353\345\370\261\013\023\004\207\f\346\200\374\365\343\031^Bw\310\034q8\251\254\020d\247\f\332\256\200?\r\301\237;\340\3703\0077\256\005\003d\033\177\256\001\"/\3210\222g\264\270R9\204[\204\361\337\016\244\200_`/,\003s"
+	.string	"W\035sW\2562a\203\371\204I\346\3723\214\037\3271C\341O\203\277)\225\263>"
+	.string	"\202\026G?z\347\277-\336s-\310"
+	.string	".\305\001.\374h\007\376k\301\1771\270\340\277\024\374w\305\177;\374\367\003I\376\377\374)\3607\025\200\365g\375\342\277\304\377\262\370\261\321\355\300\177=\270RF.4\\\3757\370_\250\377\n\377\314\301\352x\333\377\266\270Q\377\345@\361\277\037\270J\177\256\372\237\301\r@\007\\\347\202\340\b\370\323\013\374\3461S\265\250\2359$E\361\037.O\375\371\277\311\227\367\377\f:\344\020\230}~\354v\243?m@N!\267\370\315\245\314\224\245\314\024'L!\231\305\217i\344\025?\216q\201\016\346\004H\350\340G\301~\363\3567\345\3749\352\307\027\374\230\310\002V"
+	.ascii	"\006a\2220\353\374\330Nn\377|L\032@\006\031*o\340\177\nsD\325"
+	.ascii	"\236\314\376o\303.\376\354\364\233hn\372\206#\375(\233)\342m"
+	.ascii	"\231\3517A,\377\307\231\035\230\026$\375\337\240\367\024\267"
+	.ascii	"\340GI\374f\004y\345\221\200\213f\341M_\202\006\001\374\027\377"
+	.ascii	"7\377x\310\217\211\374\270\b6\362\241?-\300\217{\374f\030\331"
+	.ascii	"\323?\025\361\277\216\236\f\314\024i\003\023M\016\276\302\217"
+	.ascii	"\242\360_\317Q\207\023\375\250\005\377\357\374\327\363:\377\311"
+	.ascii	"\374\317;\237\rY\305\217\353\320y\321\217j\2501\003\003/.\tn"
+	.ascii	"B\212\324\301\013\242\r\256\200\376+t\207\236\342\350\237\246"
+	.ascii	"\031\003\277\371\201\347\037\345\363\347\013\374\271\002\177"
+	.ascii	"F\361g\b\374\231\204?3\340\317\b\370\263\001\376\034\302\237"
+	.ascii	"C\374\031\304\237;\370\263\207?"
+	.string	"[\360g\n\376\274\341\317\026\376\\\341\317\277?\233\177\276\277\251\367\233x\277\211\3477\355\374\246\234\337\264\373\3154\277I\3467\305\374\246\334oz\371M.\277\t\367\233Z~\023\313o\276\375f\225\337l\373\315\377&\333o\256\375\346\224\337T\373M\264\337|\362\233L~\323\3547[\374f\222\337<\362\233\355o\016\371M \277Y\366\233<~S\307o\206\375&\330o\326\370\315\031\277\351\365\233\\\277\251\365\2330~\363\305o^\375f\325o\206\3407?\360\233)\374f\324o>\375&\373\233\353o\252\277\t\374M\f\374f\005~s\002\277\231\3427O\374\346\t\277i\302o\222\360\233&~S\204\337$\361\233#~\363"
+	.ascii	"\277\t\302o\212\370\315\245\337\004\361\233\035\374\346\006\277"
+	.ascii	"\251\301of\360\233\026\374&\005\277)\301oj\370M\244\337<\372"
+	.ascii	"M\243\337$\372M\241\037\343\371M\240\037w\371q\226\337\374\375"
+	.ascii	"f\372\233\350\217\315~3\377\270\310\217\311~L\342\307\t\370\357"
+	.ascii	"\317\177\373\376\373\201\377Z\370/\322\177\205\376\213\376\317"
+	.ascii	"\373M\374c\275\037\357\371\261\333\217\363\374\330\316\177C\370"
+	.ascii	"\277\341\177\333\177\235\376\303\375O\361\337\204\037\327\371"
+	.ascii	"1\235\037\317\3711\335\217\275\374X\313\217\223?V\362c$?>\362"
+	.ascii	"c#?.\3731\216\037\337\370\261\002~<\200\037\023\340\277\373\277"
+	.ascii	"!\370\217\342\277 \370\357\205\377\026\375\227\350\277C\377\005"
+	.ascii	"\372_\302\177\323\377z\377\367\376\363\371o\344\177\231\377\035"
+	.ascii	"\372\372\372\372\376\"\255?\311\313\357\200\253UX{\327\340\220"
+	.ascii	"f\267\301\211\376\331\347\344\373\331\247<\373\320\255\367\336"
+	.ascii	"S\311\335\265\001\212\026\032{x\373\353\313\003\021\230&Q\366"
+	.ascii	"\362\034\335\237s\256a\202\344\n\316\337\360C\337\377\036\377"
+	.ascii	"\350\246\362\332{\3178\223\333\253*\b\375\357\357y\257\207_\350"
+	.ascii	"\232\267\202\377y\357Ke`\357\027m\310\275\367\305\243\227\300"
+	.ascii	"Q\205q\330\347\334\336VdS\n \223aE\206\003KI&\303\bKI\266\247"
+	.ascii	"\254\220L\031ym\262),\345\336FVVS%\306\266\021\226r\313\330W"
+	.ascii	"kd\334\235$\233\332Vc\333h[m*\016XVd2\260\224T2\214\260\224d"
+	.ascii	"2\266\222l\027m+*\257,\253\355e\264\225du\266rLF\021\226rL\006"
+	.ascii	"\226\222\f\357j\305X\203\206C\211L\202u\247\260\2546\327\226"
+	.ascii	"\030\225W\321\034Vrl\327\355}\255\270\330^{n\357\n\366\026\033"
+	.ascii	"\363\252\243\302q\343\252\346\270\252\262P\215\335\344\336;\303"
+	.ascii	"VU\331\330\266\232\233\272{\016\213\311\330\336L\252\234\366"
+	.ascii	"\326\336{\1770\225\234\333C\356\334\224\017\261\255\345b\357"
+	.ascii	"\bvr\357\255\275\247\356\236\333{O\355\275S/\261\344\3369\212"
+	.ascii	"\260\220[[{\177%mm\261)..\366\306V\340\304\311\300R\226\215-"
+	.ascii	"qqS\"\367\213\344\324\305\322\032\333\310]G\346\245\225Sk[k\357"
+	.ascii	"}\357h\244\f\032v\226\247\336o,\007\033\025\316\327Pw\346\355"
+	.ascii	"\371U\236{0\337\b\311=ETu\206\306\036\336\366\362\332\340\032"
+	.ascii	"\304\350\377\324\223g\250\r\362I\025\316x~A\356\352\244\301\371"
+	.ascii	"\032\254$-|=\341R\036\356\254\263\206\334{\027\005\301\301\243"
+	.ascii	"\305\n\316\327@E'\225h\336\270\251\243s\336\241yB&\017\347_\276"
+	.ascii	"\272\034\"\354\300\220g\234s\316)\347*\317\273\023N\224\363\356"
+	.ascii	"|s\265\306\301\222%i;\360>\020Q\225\035\031\242\3635\350\320"
+	.ascii	"\327\020\246\257\001L_\003\0167i\344\304\231\232\302\371\"\312"
+	.ascii	"\\\2761G\336\304 Y\236iN9(K0g\3100I\326\234j\316\271\223\315"
+	.ascii	"\331\346Ds\322]\345\231\3464\363\363\314\375\262\224\346$\263"
+	.ascii	"\363\225\221d\252\234\023\203KQ\036\272G\3505\270\320\217`\217"
+	.ascii	"~\004o\364#8\243\037\301\233~\004j\372\021 \365#\030\373\342"
+	.ascii	"\245\217\0252/\356\247\227\377\344rv1\317x\305\271\302\371&/"
+	.ascii	"\022\232t\217\320\023n\351g\334\tV\246G\021\234\201\266h\t[\343"
+	.ascii	"\233\3039\213\320\2266kWp~\004[\372\377y\345\264r\276]\345\211"
+	.ascii	"\345TZ9\261\234mg\025s\315KWa\343!\202M\307\022\204\023\313I"
+	.ascii	"e\t\033\224H\233\017>:\237nAT7\266\250\301\371\031\334\350g0"
+	.ascii	"\243\237\341M?\303\232~\006'\372?\327\222miE\350p\376\177N9\245"
+	.ascii	"\234QN\2653\355*\317\344\t\345'\232\211\365\313\004\333\241?"
+	.ascii	"t\204\235\3415\021C>\311\201tB\027v&\3173\223\016,\354\354\354"
+	.ascii	"Cz\305\311\233\036A\371\274G\3503\224\351g\310\241\237aK?\211"
+	.ascii	"\217~\222\033\375$.\372?\227\234Jnr\fJ\037\263\237Jl\334{5gK"
+	.ascii	"\017\347\023\271\364\323lH\006\224\266+8\033%I\202\004?9\331"
+	.ascii	"\310\240Q\0351r^\205\235\211\341|\032\371\317\037'\220\263\b"
+	.ascii	"&[\223t\021\344g\221\377\024r\0169\211\340\035a\310\264\001\222"
+	.ascii	"\273\223L\303\271(y\221P\214u\217P\374\266\3643\210^3\343\305"
+	.ascii	"\n\347\245\344EB\321\257\323G\331OV\027\"ued@V\226l\261\202\363"
+	.ascii	"\331\343\007\b\033\230+8?I\251\377\223\307U\236c\207\013\332"
+	.ascii	"\0330\025\273/;\234\317\034\347\216\377\277\323\216l\314\020"
+	.ascii	"\234\317\260S\354*/w\352\330D\331\211\013\272&8?)\251\245\366"
+	.ascii	"\336\373^\016M/\207\236`D[\326\352\212\340\374<\277\333d\013"
+	.ascii	"\224+_\036\204\362\334T\235\341\374\2378\356\215 c\2228\3437"
+	.ascii	"/r\300\330!\257\0241i\220qxjY\366\340\362\220p\310\023F\326\223"
+	.ascii	"\353\344='W\316;\255N\254sF\266s\3068e\2344\316\255\234\347\274"
+	.ascii	"\221\357d\274\323\306\371\342\254\221\365N\255\314\347\314\312"
+	.ascii	"|\347\325Iuz\345\276\334'\357\235U\247\213sg<\347\324U\236]y"
+	.ascii	"\3163\235\274|6\215X\311\342\343b\202\335\271/\003\234\321Y\222"
+	.ascii	"9\203\334\242\267l;\2732\225\254\344B\362\231)\203\245O\335\233"
+	.ascii	"\353\266\343\nr\357$\2321\370\355\312u\343[r\223\351\260 \305"
+	.ascii	" \367N\236]\031N\2263d\356\355c\n\262\356\355\213\232\353\266"
+	.ascii	"\245\312\0312\313\2455Z\226\330d\272,oe\314\214A\203|\353\273"
+	.ascii	"R\342,\277Ta\003\243\255M\0139\246\313\034\244\235\225\345\336"
+	.ascii	"\311\263+\177\271[j9\273\262\233\331\222\2623\274\275\223I?7"
+	.ascii	"m\352\322H\310f\362\"\241!\364\320\177\276{\226\363\353\246\001"
+	.ascii	"\f\351\222>.;8\3478K\317w\023h\221\343\202sz\217\320'\205\351"
+	.ascii	"'e\351c\330\243\217\341N\037\003\026\235\333\344\033g~ \301\371"
+	.ascii	"\030\330\3641\020\321\307\360\245\177aO\377\002\035\375\013m"
+	.ascii	"\364/\210\321\277\320E\377\302\233\376\205\244\376\005\244\376"
+	.ascii	"\205/\375\013[\037I\216>\322\027}$+\372HQ\364\221\214\350#\335"
+	.ascii	"\320G\202\241o\001O\337\002\032}\013S\364-\004\321\267\320\245"
+	.ascii	"\177dG\377h\214\376\321\024\375#3\375\243\036\372G3\364\217\250"
+	.ascii	"\264\207\314\366\263J\022\375\334\334\321a\005\347W\310\323\257"
+	.ascii	"\200F\377y-\231\337\332xl\265\347\344\237\245\344)\330\306\035"
+	.ascii	"\303\342\303a\003g\234\274H\250\207{\204\346(K\317j@X\312\364"
+	.ascii	"I\202\363QN\313hDwZd\354e\264\274\303\210\345\231\341\214\246"
+	.ascii	"4\262\304o_` \337\344\262^|!\275f\364Q\301\340\262\343\243\025"
+	.ascii	"\303K\006V[\026\035o\\\266\360[\027\255)P\226[0\274r\344"
+	.ascii	"\241IA[v\351\240\203\364\n\303\033\223CdI\226%\226\035T\\o\262"
+	.ascii	"L\2644\2656+C\226D\220p\246X\217;$~\213\343jr\005)\006\344G\032"
+	.ascii	"\374\346%\206\227\r\023\354J\257H\031%Z\304\202\240\211b\225"
+	.ascii	"c\331\366&di\0329B\006\311\030\244\311#\211\230\030[\313\245"
+	.ascii	"\274M1\246\0333\031\327\200\252\276e\233\026\261\266*D\250\262"
+	.ascii	"\336t\201p6\005\211\337\340~|\241\261\035a\202\345G\235W\336"
+	.ascii	"\267\315\205c&\221\"\264\365Y\356\275\211<\261\342Ec\217\312"
+	.ascii	"E\0200SL\310\231\245X\336\346\216[fh\252h\357\037sL\"P\350\244"
+	.ascii	"\230W>\354L<\031G\276\312N2Wf\222gd%\331H\366\221\315r\223\214"
+	.ascii	"\225]\230|rX.\222\205\344!\271*\007\311c\246\236y'O\345\254\254"
+	.ascii	"#\177e+\023/\347\3106r\215L#\3670\347d\260\f$\303\310;\314\275"
+	.ascii	"\374\"oe\252\\f\3221\373d\"\371\210Y\307\324c\346\31112\024\263"
+	.ascii	"/we\262|\303\334\223\177dd\3662\363\262V\346\221\223d$Y,\237"
+	.ascii	"\345'Y\206\311g\332\311K\314\345U\346m\306\271yg\3121\333\334"
+	.ascii	"\212 \337T\3651\321\324\322\226D\234\274\231^5\370\210\221\305"
+	.ascii	"A\232]?~\333\002f\212\r\271qCTE\333\352\312\f\262\355\n\217\245"
+	.ascii	"\211\265\226\004i\242Q\241C\2024\251\252\336\204!\305\312~\300"
+	.ascii	"\251\333{K\236-\341\350-\367N\232hy\233Q\242\230D\3626\315\266"
+	.ascii	",\367N\3362yeS\356W\326q\027\t\2750\356\021\372\n\\\364+P\321"
+	.ascii	"\257`\246_\201L\277\2029\346\246\233\337\004c\2061\351\356\257"
+	.ascii	"\306\230.[pnc\362\301\330\242\206\363+`\351\377\246\032s\316"
+	.ascii	"\\c\246\271J\223\215y\346\030\2042HL6&\232\263*d\256\333\320"
+	.ascii	"T\321\256b\223d\311dc\232\331Su>h\322%\211\024\274\275\223\347"
+	.ascii	"\220/;l~\362\215\344\350\033\271\3217j\243o\264F\337hN\337\276"
+	.ascii	"\245\233c\262\017=]Jp\276\221\031}\227\027\t\235\340\036\241"
+	.ascii	"7\272\242o\244D\337\b\210\276\021\016}#\027\372Ez\364\213\326"
+	.ascii	"\350\027\275\351\027A\321/\"\323/\332\322'\342\243Ot\247OTF\237"
+	.ascii	"\350\212>\221\231\366\340\036\241'\002\242O\224C\237\350J\177"
+	.ascii	"\250\216\376P\031\375!,\372CI\375!$\372C<\364\207\274\364\223"
+	.ascii	"\367\b\275\220\236\276P\034}!2\372BU\364\205\322\364\205\310"
+	.ascii	"\364\205`\350\007\341\351\007\241\321\017\322\242\037\224\246"
+	.ascii	"\037T\246\037\344\245_w\221\320\003\365\321\217\273G\350\201"
+	.ascii	"\352\364\201\274\350\003\255\351\003\371\320\007\322\322\377"
+	.ascii	"\321\323\377)\243\377cE\377g\211\376\017\017}1\027\t\375\017"
+	.ascii	"\230\376\017\227\376\334=B\377\263\365\177r\264y\303\304q\225"
+	.ascii	"I\346\327\232*.1\234\377s\243C\260o\022\372\276\233\204\376\267"
+	.ascii	"E\377\327D\377gD\377\307C\377\227\245\277\274G\350\361.\022\372"
+	.ascii	"\037\225\276\276\243\257\325\350k8}\255\246\257\221h\017\027"
+	.ascii	"\t\275\326\241\257a\350\020.\022\372TO?m\243\3576\247\360\235"
+	.ascii	"8e\304\252\340\374\233\333.M\003Sf\245\217\257\002\033928\367"
+	.ascii	"9\345`\331\002\006\347\247q\372\"\214`\263\262>$\230%\330\314"
+	.ascii	"\\\363\322]\330\360)q\202\241\230k^\032\216\215\017\316A\244"
+	.ascii	"-\013\347(\202\005\006\337\301aX\210\271\346u\342G\214%\376\232"
+	.ascii	"\363c+\307\035<\344rCVE\333\352\007\f\244\033lg&\221\251[Y\236"
+	.ascii	"\036L\007\357\301yp\036\306\303{\230\017^b;X\017\327\301x\256"
+	.ascii	"\022\337\301q\216\357\260\034%M\256\233\231D\246U\312\366\356"
+	.ascii	"\3404Lg\256y=\200M\017+\271\203\231\364Y\342\257?\004\b\370\016"
+	.ascii	"\006\273nCS\311\335\225\376\320\n;\373\360\341\003j\345J\031"
+	.ascii	"\275\r\371i\232\006\232\273H\350\215r\217\320\247A4\266\303\270"
+	.ascii	"\016\3039\266\303o\036\002\204\007Ya\273\2747\325\275\024\004"
+	.ascii	"pR\274\267\276:w8'\243tu\025\031\253C_\240]\300\300\256\336\260"
+	.ascii	"9\243U\245\335\204q\371\370\332\242;\211\200i3\007N\2334\215"
+	.ascii	"\006B\362\334\300Y\243\321h\364\232\353\345\365A\231\252\264"
+	.ascii	"\035x\327j\256\327h'lr\270\340\254\347\016\267\366\203\313\032"
+	.ascii	"\234u\032\017\342\350_\237\311\312\2679s1p.S\006\355\22146\245"
+	.ascii	"\207H\214\013H\034\372\344K\017\0318\337\203(rrzL\322\330\324"
+	.ascii	"\035\016\246T%\221b\302\370\312\0226FL\2063\273-F\207\241\221"
+	.ascii	"\2056%K\222\250\312\334\236\034`Ne\2350<^\340|\017\204x\361\222"
+	.ascii	"\"\271\310\230\3402\\p\\\362\266l\321\\nQ\262\212.\n\022h\254"
+	.ascii	"K\215\273\270k.\372J\232$O\262\016g\r\367[K\003\226\206\363\234"
+	.ascii	"*Ut\226\244\261\251:\027\204Y\222\266\203\016\222\030fX\256\263"
+	.ascii	"`\033@q\352\244\261\301Y[\321W\322\364(cD\277\231t6j,\301\371"
+	.ascii	" \334\350\347\3016\360\030\231\302\371 \314$\237\324mIcS"
+	.string	"z\320\270-\276\033x}u\346\366\264\362\272mN\032\335\035\020\234\237G\263\375\377\245.\230\320h\323l\232J\r\030x\272\360\260\271\033\223d\355\204\363\223\245\217n\211\363A\320\220\"\005\315\273Tv\327\345\322%\211\2243>7`\344\340|\245>\032M\243\351(?g[{n\f\261\001\002#\206N\273\216R\325\304\210\226\223\217\320\231\034:0\234\257\304\205\311\365\223\263\024\017/\367\256\362 YU\267\261\304<\374\332\346\260]\341|\2455\255\235\350&iffZI\322\330T\035\r\274\266\356x\005\321S\203\243\225\240Wy`c}p\276\022X\222$h^\322\330T\036 )9\257\311\226\030\234\257tE\204\210>R\0049\304gWf\033\271>\362\323\266\367\343\016g]D\317\217\037Z\b\0330'^\336p\tr-\004.\b\213*\217\032\316\032H\331\233\335\r5eeZ,Io5\266!\313\275\277<"
+	.ascii	"\005\021s\303\345e\307\016\335#Io56B\226B^\324\326\344\215]\367"
+	.ascii	"\200\313=\352\300\202\340\254y\264\335\270\241\305\210 \273\324"
+	.ascii	"\311\230\013\273\026;\343\303b\003g\215C\347\b\242\321\003\017"
+	.ascii	".\007\230iv\204\013G[\236\2649U_8\211\345p\321\331\353 \211\256"
+	.ascii	"\241k\350\031l\252\\\021\013\013\213\361\030z\306\245\262\273"
+	.ascii	"\226\226t\244\234\355\375\345\301\351\206\035-\031\3273\210\250"
+	.ascii	"h\221\311\303Yoi/\2420YS\372h/\335\225r\361!\204\nM\320^\230"
+	.ascii	"\2357\232\013w1\231\220\241\315\341\254\265\016'\206\212\226"
+	.ascii	"eV\276\203+}\245\257tV\032R\217\352\r\215\306\272\316\232\003"
+	.ascii	"\304g\007\007\025\316\372\305\215\323hxB\230\340\254]\\\267\237"
+	.ascii	"8t\312t\341\240NW\351*t\r/\275\341\303\312\226\267\275==\245"
+	.ascii	"c\b\317V\220\345\017\233\220\245\225\336\327S)\037\220\036%\027"
+	.ascii	"e\337\377\237\020\0250>\264\372R\276)7\312\"i\037\2420yx\304"
+	.ascii	"\341|\016\324\36498\242\247\227\342\335\242\344\376\362\240\247"
+	.ascii	"\326j0\301\371\034\220\351\321\223\342qY\222\266\243\002T\220"
+	.ascii	"\330\331\363\024\017\356V\201\243\306\013\0078\360\374x\322!"
+	.ascii	"7\255\366\216\034C\313\255 K3O\013\223,\234\317\201\013:tR;I"
+	.ascii	"cSy\320\032[S\224L\321[\243V\347\251\035\241<msRp~\236t\371\377"
+	.ascii	"\207\242\351\332\323\303y\003"
+	.string	"1q\342\244r\222\360l\245\341\t\202A\247\317\231\273\247r\346\340(\3126[\337\240L\315\3237jR\273\364K\322\256\262\332;\206\034\361\331z\002\006oc\211yh\002\302\303LZ\367\324\356f\372\332\342\310R\272\247n\376_\372\206\256\f\025\234\377!\216N\331<m\363\377\3160\032q\230\340\374\017n\364\237\256\371\177AB\314\240\261\203\363?\314\351\177\030\223\2321\223\246\271Tv\327\006(^\322v\340\355\375\345A\210m\307\322\r\232\247i\340\254"
+	.ascii	"\321\343\202sz\346g\276\321\355\020\353B\206\314\0303B\244\200"
+	.ascii	"!\303\204I\305p\330{\273\330-\316\246dIyX\241\255\021\203\246"
+	.ascii	"q\361\201\003\207\363?\350\220\223\233\202\226\321\250,o\340"
+	.ascii	"\374\017X:\365\222z\021\243\266c\211\234\002e\017\316\327`\017"
+	.ascii	"\027.h\336\b\026\324\300\32071v\364\341|\r\334\244p)\\\222Z\f"
+	.ascii	"\027K#j8_\2031\251\226T\013\227\006X\364\237b\371U\246XP-\374"
+	.ascii	"#\312\231\367\202\f\n\316\327\240\211\376\323\267\253L\337N/"
+	.ascii	"\036\222{\352\347*\211\006>\364\237V\371U\246UP\030\227\312\236"
+	.ascii	"\032\242\023\022\226\227^\3206\316\327@K\377i\333\2572m;\225"
+	.ascii	"\234V\233J\b\212f+\310\022\317I\02702\234\357\241\216\376S\266"
+	.ascii	"\224\355\306\235V{l\b\312\267\005\244\213.\023\263\343\n\347"
+	.ascii	"{X[[\203\341\201I:%\235\202n\275\341\211P\020\034ra8\337CY\024"
+	.ascii	"%\251\032z\225\267\225M5\343\203%`\036\274\364;\360\321\177\n"
+	.ascii	"%U\222\242\341\030\n\270\302\332TJ<,\351\352\260\324\357\300"
+	.ascii	"\306\311\023l\307a*\271\273D\344\240\261w\326E\277\303\224%\177"
+	.ascii	"\b\020R%)\023l\227\367\327\236\302\303\301\222\257\016K\364;"
+	.ascii	"\370H\315R34\013\207%\035b\3504I\232$=r\r`\206\0049\204\b\027"
+	.ascii	"\022\347g0\247H\221\364\b\235+\227\356n\310\034#O\217\234Hj\334"
+	.ascii	"\321\301\371y,\300{\003\004\347g\320%\025\222\nI\207Tp\203\313"
+	.ascii	"Z\232m\324\274u\r\271qE\326\\\364\300\371\031\240\375H}\244@"
+	.ascii	"\316*z\312Kc92g\231\301\021\375\ft\364\350\221\226i\271"
+	.string	"\003\322\343CI\030\262\247es\206\242\310-\363p~\236\263\312\377\037P\216\b\036\316\317 +\345\221\362H\301~\007\260\263\262,#\253\303\201\3631\310\323\241\003\335U\344\300Y\366\261\301\371\030\324\351?\rK\303\316\262\244\344\236\001\304\326\205\301\231\364Fz#\005\033Cc\017o\357N\231\223\364\353)\030\334\217)1<8\2478.7\004g\212\223\265.5j\244lY\312tF:#\255\032\201\356\267\311\230\361\300\371\030,\321\177\352\225z\031\240\017\203 \\\\t9\3223z`\254\301\371\030|\351?\325J\265\016\227\223\333H\312\266\205\301TVV\n\203N\013y\002\301B\312Ia|\025\361z\363\342E\037\222\013\311\r*\234\177\301\227\364*\275J\253\330\350\001\325\330j\363\205\363/P\246S\351TZ5\002\0339\372N\315\231&8\377)\325\323\252\240+j}b.`\322\327\227\2259\271e\374\224\235]"
+	.string	"\004\335C\367\320>#\324\r\211\205\211\202u\264\217\222\312\2367,\234\177\201\215=\250\336\0364/\003/\017xxh\336o{\335\341`v7\024C\316\213V\336\2222-\234o\301\236\276\005f\350\240y\350\240x\320\275or\254\313k\177\325\360\260\\\242x\356\366\332\373\353"
+	.string	"p`\313\375%\346\341|\303C\317\016g\024\217\234\371bCq\2033jg\b\371\366\265\304\031\255\203\355\2768yc\345V\246\347\016\016\347[\340\246o\301\020}\024\316E\357\344\034\216\203U\321\216\021C\b\222\207\276\00544\266\340\236\331\223e\207\363Q7\027\255[\203\332\035NOy]\200\201\205\307\322\202,\375\n\372lL\364C\255\316\006\316G\327\\\264\315\037\002\004t\rJw\335\364F\246Xb\354XV\340F\277\002-\372\367\272\241j\324\240\273J\221\260\n\314\320\244)\332Vq\372 \201\350W"
+	.string	"\246\177\264\f\252\0055\203c\344-$\271i\374`\331\253 K\237\202=\372G\307\214\271n7\271\273P\266$b6("
+	.string	"\035&s8\237\0025\372G\301\240Z\3200\330\006\007\252\344\366\002\212\301G\201\025}\n\216\350\037\375\362%+G\030\243\232\201\201\332\232$R\206\304^l\361\301\371\024\204\351c\273\213v\351\202\355nrw\245U`\024t\351\037\215S\242q7\016'\267\327O\331Wr\203s\320\323?\272\345W\211nA_\2140\266gp\260\204F\331\217\2178.\270p>\0078X\260\240Y\360\336{#\323+1\364\226Y\256\033\220\235\21435\234\317\301\213\376Q+(\025\364-'\357\236\341\345\200\030Y\226\034\240\350s\020\323?\332\206RA\335.\307\301*\271e\374\304\300Bc\017\217\303\r}\016[ll\031\315\304\032\243*\373\300lI_\227\017/vP\301\371"
+	.string	"H3e\n\272V\344-yt\315<Cd\211\362\306MY\362\005\004\347\003`\312\223?A\325\356\336{\177\355);!\230Y\211rT\r\333\375\314\364\314\315\300\031=C\323\376\377\202t0\251\023\226\206\242\345\271\255Y\365\321t\260\222\350\341\f\005\307I&\r\345e\255\335\001\240\254I\223sL\277\341\361$\316\2162\234\017\200\031K\226\340\033?\255\266\2173\344\336_\033\b\231\241\265U\341|"
+	.ascii	"h\351\0375\373C\200p\225\250\331u\273Tv\327\317\013\032{\276"
+	.ascii	"\344>t\334\f\301\371\023\324%I\262\243\314\221#\230\353\032\355"
+	.ascii	"MU\027\207E\377h\221\253D\213`\256\244\344\236\"b\2435\201\024"
+	.ascii	"}4\310E\207\f9\\>\202\372\270(\220_%\n\344p#l\240\2520\032{g"
+	.ascii	"\333ko\360\t\300\364\341\256\336\336\373\257`\2657\225\005&\035"
+	.ascii	"\335\227)\234\177\264\354*\3212\034#S\3314R62_\033\244w\250\352"
+	.ascii	"\204\341\374\t\272x\360@{\f\201\033;\332c\016\346\243\347J\023"
+	.ascii	"\234\237'\333\340\222v\006\347K\220\247\177T\307U\242:N##$\367"
+	.ascii	"\324P\331\021\t\350\340\300\201\206\351\364M\313\313\303\217"
+	.ascii	"\3468\032\006\207\312\310a\326\2053\nv\271\377?\214g\013\234"
+	.ascii	".\234\321\257\333Gi\003o\313\377\2376\003\223\345$\215\r\033"
+	.ascii	"i\310\375\365\345\341'K\031\336\024\034\r\032\347\330\b{o-d\230"
+	.ascii	"\224"
+	.string	":l\2222d\344\275\235]\315\300\371\022\024\321?\332\245D\273.\237$*{\006QY\214.$\336\336b6H\367T\315\261\201\363%\220\201n\241[\347\330\b\227\356\\\323r\205\013\347o\330\323h\214\364\210\0260K\234\277!\216F\263\204\360z\354\020\243\223@q;\336j\340\214\272\270Mv\220)q\376\006-\032\265\022\376\250\362\005\347o\330;:\205R\235y\024\020$\004\215E\251\220\035\252\022X[\365\204\324\211\013PO\301\337\217\211\310\252\306\237;)\025\215-\232N\020Y(\024,\324\n\264,\221=\"\241]\233\216\356\244\264\036M\254L\352q\310\252LEm0\312\330\036\211E\022\034\370i\201!\226\244X\246\264\305\020\212m\207Q%p\340w'\245\250'\266\205\260\270\200b\n\247\326\2502@\002O\306\"\323\272\032\231\204\352:\002\261\310\022\215k\253FA \352\211\0051B\310B!\335I\351\310"
+	.ascii	"\t\230HAb\004\220\001%\036P\002\220\304"
+	.string	"\t \n\023F@\"\333\016\331(\025@ \021Sk\344\300q}b[\020G\343\272\2025\n\217\354p\310>\241C\225\330\304\242h\"\262+\3305\270\2368\232\2202\036\r-\211P\242\305\020\nj\204\205\226%\232 \262j\003\204\220D8\201\204\226%\2328\022\341\004\022\220X\242\t!\013\265\201\t\212\204\b\bY\250\tZ \333\002\251\355p-At,\006\177\244\212F((\025Hd\217?\355\332"
+	.string	")c\321\235\224@\254\306\250V]\231\212\356\244\324\262D\026h\242]Q\bY\250\013C5xlY\025 \242\210M\035HE\021\331a\007\037\004"
+	.string	"\030\200\020\244@\254\302\250a\220\310\2020\036\243@\200`Q4:\265Eb\312\244\256\303\334\036\211\305\340\311\324\022Y\343\020e2\256,\212P\350\332\256C\250\247\"\t\n\324V-\301\200\243\t\013MD\366\204\023G\266\350\310J\215`\241V \350h,\266\305\022\204\220H\234\030\026a\2202\252\255Z\"hD\201\353\023\333\022\243\214 \202L"
+	.string	"86\251C\021Va\261\004\"\341\260\030TTA"
+	.string	"J\307\022\244N\b\331\241\272\302\302O\bJj\253\226(\032\200R\005 \017\226\224\330\241$b\221\335p\\Q\220h\327&\fA\"\226\224\244N\264GuHt\264B\025\207(\216'Z\226\310\026\375\254+\214Q$~\214B,T#\020\013\365D\2736\r]\210\"\256m;\242\204\211vm\312pT1\242\002Q\2736\021\031\205\214\253\212\247(\023\202'\332\265\251\210D\261\215\002"
+	.string	"\222\007J\255Q\205R:\021\034\252\301\r\277%%\"{\004\372\205P*\006\201.\210Pj\217\3520I\204b\n\r?\037(\255)\260(\240\326\026E\320\030\004\202\222\021RR"
+	.string	"\224ZbT\221\004\324\332\242\210`}b[\250b\221\004!{B\2736\031\325\326\210\305j\202\332\252%\244N\034Y\240\265UO8\035W#\323zB\352\204\205\247\265=\266@At\342x\\\203E#\324\205\fKKJ\307\250\"\273b5\236\260\341\f\261\244$\265\n\211\254\276\223R\023\313D<\301hm\325\026E\321hd\200\261(\002"
+	.string	"\326!\324\223\372\024\025\f\2168\252QmpD\321y'\245\246(\025\253\020\204p\310F\251\310\260\n\213%\004\035U\214\b\256C\246\265D\320\030T\304\226`\241V\340\350\267\266\352\t\024k\253\016\243\202C5\210\364\203\212B\241X$\001\205 \033\005\001\242\343\221u\300\220\bkP=A\242%\256FcT0\203\332\256\013\260\320\266m\013<\226 t<\261\266\252\020*\252\350A\326\270\022\327&\375\017\002\320A"
+	.ascii	"B\220J\037\002\001< \200\007\350C \300\322\022\001\002\260\244"
+	.ascii	"\037\200%\323\003%&\246\250\005\b\211\352\323S\221D\320H\264"
+	.ascii	"\002\205&\244\212*R\265UK\0201\255B \260%j\325\342\220\351\274"
+	.ascii	"\223\322\321\251U\237\"0\026\333\340\272\002\b\305\364\243\300"
+	.ascii	"\255\300\265\300-!\242\210Eq8\344\324\304:\021\tE\fUc\033\265"
+	.ascii	"\022\177@\241\210#\026\305!\220S\023\353\004\024\212\b\022\212"
+	.ascii	"\020\256N\301\226eq$j\357\244\324\302\270\266\255\252\002\304"
+	.ascii	"\321X<\022\327\243\004-\260\325\353\023\233\2425\252\355\361"
+	.ascii	"w\0046\251\355\260(\001\026\305a\005\341:T\241\022\327tmR\177"
+	.ascii	"\216Ac\005\315Bm\021$$\252*\204\352*4Z\233\206E'`;T-\b\327\243"
+	.ascii	"q]\261\032Y\250-,\020Eh1\204\202R\203Z\"k\336II\312\b\242\tJ"
+	.ascii	"\312\370\003\245>\005\215\247q\025\262+\212F(\341*e\034\252\254"
+	.ascii	"q=\032I\255C\250\250\022LC\325\351\207\310rh\201i\223\232\242"
+	.ascii	"\310\002\233\242\206PIF!\221U\001l\325#\360)\312\330"
+	.string	"\242\260B\0355\004\255C5\370\323\032\327\025D6h\024\262O'\221}\322(\004W\247\240\224\372\244\211\216$\206\352\nb\2215\0214b8\256\253\261i-\361\244\222X\001\305T\241UW\260mp\304*,\226`d\325$\"\033\\\217QRF \251(\025(\245>\021\035\221\332\365\310\304T\004Z\241Z\264F\031&\300\260\001\330Dd\203\306$a\2215\256P\353\223jd\002\006\215G {<\0323\bY`\313\022\243\204B\f\245\214G\242\366\2502\001\205Q\252\n\3401J\305q\310H<\002\245\214\300\365\030\005d:\032\203D-0\204\b\024\216\352\023\3608\\\211D\325)\b\\\205\254\321\270\256(\002\241\216O\021\034O\020\262PA)8\001Y\250-\206Rp\002\026\245\340\344\024l\213\304\366NJB\026\nD\353\324\304\016\231\222D\270G \223\220\205BO\270&n\211+d\241L\250(!\221\235"
+	.ascii	"\006 \026j\005\242P\bY\250!\"[B"
+	.string	";B\310B\025\265\301\225\211\351\2505\256PR+\260\035\262-\220XL\2015\026\235\222Va\261\204\026-\273B56\200m\211*Q\212\013DVm\200\261\330\252\306\325\302\t\026j\013\243\341\032\f\216X[\3258$l*\022\016\213N\307\325\350\324\002\333\365\230\264>\261\355O\013u\270\n\201,\034\021\213l\233BhTY\030\213\"\b\327\225\t\211\205\332\002H\364\223\202\0230\304\361\250B\261(\016\215Z\030\327\025\305\340j\004:\035Ucph\b\251-\026\261@MD5\351\310J\251@\fDVm2:>\001\205\352\352\244\242P,\016\201\306\025X4\006\325\fDVm*22\026\215\306\025C\020xT\241V\bQ!\005' \221M\301\351\311\270\266B\013\253\260X\302\t)6\264\354\023K\302:l\"\216\300@d\325\006\030\265\353q=a\\\233\232Xc\n\026\305\341p\004\t\247 1J\035N"
+	.string	"\\\217Q\025\244\324\341j\004\262P["
+	.ascii	"\205k\253\032\233\326\226\310ZH\2015\252+\221%\241=F\031\235"
+	.ascii	"\332\243\223\310\252M?k\220\250\256\020\252B\2416\n\252\215*"
+	.ascii	"\002\215\305\266\370T\001\005\016\207k\020Xl\243T\f\300\226\270"
+	.ascii	"\262G\242jl\223\332c\261\250\002\310\304\244\237\240\214@\"\373"
+	.ascii	"\024$\\W\250#\260%\256O\3551j\003B\025\t\025\262PC\353Q]\215"
+	.ascii	"A\"\273\016\205\254\021\324\021\270\266\352\260\be\\[\"\013d"
+	.ascii	"b2\002J\251O@&&#\024X\250#\220\211i\210\tx\00421\025\025\241"
+	.ascii	"\244V\340\272\302\030\025\0042A\r\201\304\026\302\n\253\260\370"
+	.ascii	"\004\\\203\252\0218\\W\254C\"b\221m\325#q\205z*\006\201M\352"
+	.ascii	"\021\330\252*V \265\306b\033TE8\036Wb\261\215R-\034\201G\303"
+	.ascii	"bq\001\300S\270\246\300\016U\266e\211&\214\332\020-\360\0218"
+	.ascii	"\344\201\n\274\244\002\207P\201\227T\034B\305KR8\204\024^j\201"
+	.ascii	"\205j\024\007X\025AQ\300c{'%\020\304\342\323S1\250\001\205{\004"
+	.ascii	"\002\255\255\332\036\317\245\026\352\307\204\256@\023ID\025\332"
+	.ascii	"((\"\253a\005\226\220`\205ja\241\211\310\266\355\212\002C\213"
+	.ascii	" q\215\342\300j\024\201\211\251\330F\221XW\260\255\272\2025\256"
+	.ascii	"\302\f\307\b\254Ol\212\365I5\212\2606\251\306u\205Z\241\275\223"
+	.ascii	"\322\021\0304n\220R\237\314#0\205qm\207\254\bMD\326\251-\026"
+	.ascii	"\237P\004\215\032\236\242\216fK\214*\006O\"\373d6\021Y\"\253"
+	.ascii	"\032[}d\245F4E\251X\205\277\264}P)h<Z\241\212\303\343y\004\266"
+	.ascii	"D\266x"
+	.string	"\302\272\302\030EbmUc\321\0325TW\234\355\235\224.x\021j5\202h\213E#\b \243\352\024\314\353\223j\302:d\231\212F(\240#\260\211e\"\026I\254\255zbX4\266\304b\360(\004![\202\321\251MC(BI1\300\350\324\352\343qm\325\023AcZ\204\222b@\320\210\036\327V5\236%L\234`tJAl!\374\265D\266\b\205\202\272\032U"
+	.string	"U\250vh\205j\321\036\265\3045h\\\241\200\303\266-\032\235\332\013-0"
+	.ascii	"K-\221\215\322-\373\304\016\201k\253\032\177Z`\b-\221\215J\277"
+	.ascii	"\264D\202C\004Lh\200\016*\005\215 \202L \210\254\372\004\"h<"
+	.ascii	"\202P\252\260\n\213%\250Pm\372\377W\344\034#\263\307#\t\021\335"
+	.ascii	"\246m\020\221\2233$KJ\267'\007L\210\346r\367\344\220Q\026D+M"
+	.ascii	"BQ\026\0012&\255\210\234\026\316C\250\023#/\270\374|\2400\326"
+	.ascii	"\354\2503\207\363o\3547\366#\033a\352\347\n\312\257\307\177d"
+	.ascii	"6~_\362\342h\375v\3301\351\361\002\347/\261\375\202\340\\I\223"
+	.ascii	"\347\247\343\016\t35\004\347/\245\351\377'\206n0!eaQ\204\352"
+	.ascii	"\240\3511\222\003\355!\224\244\n\2174`Y\200\220$\273\\}i!:\210"
+	.ascii	"\0224;p\034!\312\322\243\213\356w\003US\322g\314\006z\225D\215"
+	.ascii	"\336\324\257\206Vb\226\201k\362\344G\343H\023#@\322\340\374\363"
+	.ascii	"2C\320\327\327\327\267\2677\325\317\013\377f\374d\374\347u\242"
+	.ascii	"\264\356\f\213\n\315?\255\237\326\217KO\001\301\245\321\330\373"
+	.ascii	"m\375\307\265"
+	.string	"\007\t\2273K>\364\025%J2\234\177\225?\030h\336\002\354h\375\310B\327N9,SB\260\262\314\2707SD^\314p[\343\002\212\013\261\274\346\016\037\272+\335#]Bu\326g\205\3330y\363\003\355W\205\342\341\222\323\244\315\217\352\254\002d\206\312\036\230\337\224\236\222\343\323f\314\336\236\356\273\323A\024.\"L\370\256\373\210\340\004\221#\203\263\356sVY\303wd\317\322\326I&U\316\334\350\331\245nx[f\344\345\037f[\322\360\206d\360B+n\317\215Cq\\\361\301\242G\216\217/>oyR;uc?\264p\326v\364\235k<\327x\260\306c\366\365\241jm\252\240Y\337\351;\275\304cctR\226t\256\227r\247\213;<kp\326s.\307\347mJ\033\234\265\234\313\245e\320\224\361\360@\217\326c\323\265'\210\206\2504\204\223U\3453\242$\310\362(\006\241b\b\021\021q\002\203\025"
+	.string	"@p8 \222\211\366\3255\024\200\fU\254\260\200H\243\215\224\244TJ!"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b4@"
+	.string	"$H\204\350\230\334=\203\315\300\\\347\240\"\300X\236)\006\241\303k\310\306\0023\036\274$d\233C\266\2061\343S\320\257W\212\021\372\332\322\245\320\b\255\b\\\265\302\270JW\345$\362p\235c\026\375\332\336\310j\241\323\371\022r\245i\223\325\223\030\n\026fh\276\333\225}\364t*aRD\312&dH\005\340\306\035\bh\202\026\257V~\025\200\246\025\317\214\033eI\310\020\323\357\2441\005\271\372\201\310\007\345\331\2573O\304\031\322\006\237\035\247\3561\\0\340\3532\253{\221\342/\213\254\030\314J\274\002\243t\332\266\222JB1%(?\tQ)\332\342\300F=\325&\035\r\311\364\267\235-\310\340\306\227\206\360\204(x\306\177\217a\364\233{"
+	.string	"\344{\344n\324w\034$\316\020\272\035\264\345\240M-\243RS2\200#4*\001\005V\0033\007\023v\022c\372-\202!\351!\211\365\337\013r(;R\031k\255f\004\251\t\362\"I\364\034\211}\021nFgy.\241)\247)C\305e\034=\207\bI\265\357g\325\314RZ\272)n\261#Q\370\301\377\217\230\\\0278}S\321\2511\340\225\307!'\272\363\374A\275-\360\300\";8\247\347U\330\240\200z\020\320\275]>\272t{\341\024\247?3c\307\277\257\264\323a\366\345FK\370Y\244p\0048\003\030\224L9\320$9a0\347~J\300\n\256'\023\b"
+	.string	"`K\312\n\002N\031\002\310\325\025\271z\t\305\013z\307\324\305\242F6&^\361\034\250\035Q\311\245\331\335f\3426b<^#z;\377\334\304\013n\231\323\263\035\fE\265\336\311\220\233\265\":Z\204\334Uv\032\030\216\352!\233\274\211-W\t\"\036KpILRA.\216\335)\"\005\001\311\035Y\201\366\f\270\032\376\002^\030\b\235,\233$>\334\013\352x\b\341\356\252'\273s\235\214\344\021'y`\352\360\354#\215/\323\2350\211x\344\375\214\\i\216\331mlK|\035\226\251%\206\306q\215\321\216\3068\227\305 E\350\372@\265c\215\226D\372`n\247\021\361\3428\311fLu\245\231\3504\027\370YQ\2210=5\265\366V\036\360\356\020\377H\253\214\031\260\302\255A>QF$\026\320\016\267\373%.h`Bg5\303=9\227[]\273{p\341\244"
+	.string	"&\037y\244ykKpJI\276G\221zU$\370"
+	.string	"\240\020\322\316v@\007\265\367?\362\247\200Nm(+\375B8\312q\203o$\370\337\302\251\341\332\367\271\314\217e(\367\217\020E\256PC\r\204\016{\247\302FE\370V`9\006\204L_=h\3340\004\nr\255\223\326\021O\331\252\006U\326rT\377\2604\034m\271E\nH^\036\256C9\025\264P\332\240\314<k\331\023:&\\\322\321\235\267\221\362\205q\\\364S\270\214\237\207Du%i\241o@\354\205\241\352\02609\211\306\235\323{.\366\nD\037\375\312<S\257@{69t^\304q\b>\214Q\336\246{\307\002x\t\336/\242\022-\274\361LW\207&L\315\206\364\371JC\356"
+	.ascii	"9-Rme\271#l\n^\302\326\374\232\313\374\t\025\201\265\220re\213"
+	.ascii	"\226]^yM\022\271\177\005nr\2317\341a\031/\373\221 \224"
+	.string	"\362\201\022a\002\204m\213z\212U\2471\262\346\343Z\\b\307D\352\312\3407u\233\fZ\374=\372\241\020\373J\354x\331|\310KFP\027\"\311\b\"\350V\021\037B\210\354\272\370_\230\226\202-\302\351\2730bE\247\323H1\233\001=9\371\032\224hA\217\334\370o\210\324\261\217\215\337qps\270 \005`\307\353\345\r\023\035P8%\205\317\2617B+\233\345#\346N%\207\314g}\351x\245\255\005\371\357\r\341N<?\0228\272\253\f~\233\235\316G\002\032&'\245\274X\t.Y\257\270K\274\212$Y\017q\025\300?\301E\r\330\321\273\326\001\036O\005\303\230\344@7#z\002+G\206\224\205\271m\237\204\\\237\004W<\364\342E\226\023qE\242\330\310B\223\021U\352q\342N\251\241\215\200\377<\201\227\301\310\0216\373|\364\215a^U,\347\211\237\236Dj\300S\236\004\222e\250\335+\277\020"
+	.string	"\003Q\004d\226\223d5Y\017}\365Wh\f_\357>j\300\213\036\315#\242\347r\321\344\020\332k"
+	.ascii	"av\370\223\327]\240uRQ\370\330w\243\205+\223\221\")J\005\035"
+	.ascii	"1*\265k\233\236<\006\314h\205\372q\032\214;\313\007/\350\347"
+	.ascii	"b?;rY\327\207\030*\374\323\266\021B\007\031 \324d\345E\242O?"
+	.ascii	"\227\230\254\244\266]\"d\373\257\326r3\346\363\214\265\037\013"
+	.ascii	"u2tqlL\370\315\035\221\006\033\006\005\212\345\240\2729\346\353"
+	.string	"\325\b\337\320VSJ\016\255k\210\233\027Xg\212\370\016\341\272tG_W\274H\241\005w\275\352_\024J\211\212l\210(h\003c4\355\206\363\030\212\177:{\t\315\221\b\234\301I\336+\236\r\320i5\224\374?\027[\210e\223m\210\214\310NS5\017\322\264\005R\233n2\241 \321y\r;\005r\277\261\0209\262l\013\r\r:i\250\345\272\024i\3105QK\016\2240\036\273"
+	.ascii	"\326x\240U\340Ha\210\254t\3058\275`&\363\3235\3174k\352\267\353"
+	.ascii	"\273\237\244\232\245\366\230\317\021h\212\364\2043?\341\021\364"
+	.ascii	"\377\241\230E\bv\0265\\h.$6\b\201Qs\347L2o\032(\232\256$\251"
+	.ascii	"\243\250\3317\313\250\334E\251\275\343\007~\021s\240y\034i\267"
+	.ascii	"\300\316~\216\210\001\364Pf$/\351\200\234a\234\2509\324\214\323"
+	.ascii	"\204I)\007`\007\366Ddw\305\275\033\213\210?\200|)\357,\204\177"
+	.ascii	"\203'A]\277[2\"\263\311\311\001\350\331\345\205?\331\222\227"
+	.ascii	"\3020\025\220\b\266\033\272b\326s\r\263\222\267\030v\324%\206"
+	.ascii	"ukj\267\367\3116\235Py#hadyX\"\\\322YQ\311\r\364{X\0023>\236"
+	.ascii	"\037\002\257\2663\373\0351@\031^\252\266P\337\037;\215~>\204"
+	.ascii	"\371g\217\351Yb\250g\205g\206\220R\302\331:\351\324\320h\013"
+	.ascii	"\342\260\003\027\003\212\f\341\004\f\304\002!\341\320k\365\303"
+	.ascii	"\260tVX\271DG\214\\\021FNc\256'\\\031\264\225\t*\206\266\254"
+	.ascii	"+R>\242a\033\226!\340\035\265x\277\336\236M\376Bl\2337\311\333"
+	.ascii	"\374#i+\002`\366>\332\027\260\276q|7\240\301\033>\327\315\246"
+	.ascii	"Ck\366\320\226\027\351\322\0237\r]\230\313\252\334n}*\354R\004"
+	.string	")\346\017z\230^\024\222\177\227,\032Y\243\226\035'\231C\352\026\022\2271\224\315\265\233\203\344\244%a\244\376\205\240\304 \202\320\3136\272\201\36105\204.\230\307G\337Ad>\350\231\202\362\204q\316\362.\002G`\300l,\0347\003\036\312e\217\016\223H\017\306 \330\321\376\243\210sa^\343\f\340\237(:\332\221\033%\261\271(\236\266$\330P\320\\\346\361m\204P\226p\352\247c\247\256\236Jn|\351%v\307\3724\245\345\241\037\374\237\314\013\306\003\353\343H\252\364+\361\354\316\224\256%\365Y\204\312G\016\277\310\356\t\255\271+Q\240*\033\252_\302\366\300\035-\037.\253\264\027\351\322l\366Ul\3428\266\230{\353^\330\262\025\3722\003\001\237\324J\271+\r\276\374\362_D^@{GN\345\312:\334\226\03473\231}w\027\233i\265\245\020#Z\240\177\026M\300\023z\267\373[\327t%\360\323"
+	.string	"\251$$\306d\371,\230\304j\003\260\b\372\tB\344vEW\t"
+	.string	"\210X\022v\206K\007\222\021'EJ\272\241\234|\262\311~\013\005\323\005\347\b\314\032\030\026t\302_B\206\032t~\341\277B\310\367?\345\203\303<*\221\372g\231zBOGv\212G\323\205\305\353/\257\037\n\275\020\tG\030D\257\232\004`\370\205?\257\366\302\343_\366t\340\241X\3409\230\r\263\23202\026\223o\324L\216d\211C\276\021\370\345\364&Z\201\033\034r\021Q\3372:1\227s\rc\375\247\255ztX"
+	.string	"c\322\322$\377$`\357ns.\3466B\203x\t\255\267\222z\304\017\243\243\324\f\322L\330\365c\222v]\242\250\306sk3\366b2\317CTO\316a\021A\020\226^\204\037\t\327\310F9:=\245\251g;\304\266\322\335\317X\006\274~\323\327\\x<\032\303\354\243,\221\322a\207\007\260\200\330[d\306\264\362/?\204d']'\005\257p(y\216\357\200F(*\316\333Py\335\325"
+	.string	"\2518\230\327\003\351\310\221\310\223\177\232n|\346\365|C\316A\007\235d\273~3K\366\001$j\001\201\224\253S\305\230\177\337\312q\307\013\244{\221\262I\351s\346\243\276\270\233\rA\313\204\306E<\324\366\341\347\321\3027\336\211\325Z\270\b\327\235\321\254g\314hb2\204\365\326]\332\256\304 \211O\250\353\207-1\024X\324\305(\fk\355\025\365\203\n\341g\267\264\262\032\n\203,\254"
+	.string	"\273 \356KpEx\314"
+	.string	"\tU\314"
+	.ascii	"\202\252T\207\276\370\272Gm\231\"\300\354'?\020e\201P$4\322\\"
+	.ascii	"2\227\201\315\032\245\302\257K\351'\241e\325\206\331\275\200"
+	.ascii	"<!\016\354\255\267\203@\275\342\376G\213o\"\313~\204gy\262\320"
+	.ascii	"\207\337Y\350z\247\247\261G\nu\265\223\035"
+	.string	"\355\237Q\205\274b\034\363\270\230b\252\214B\312\204\336\006\332\350.?O\265}v\r\340\247\031=\354\tt\307\330\001\245W;\204P\322d\016\240??1o\f;\321\rhzZ\311&\016\210_\340\305\326\0139\006\031/95\021\227\240\214Q\224\034+\025\034km\334\241\304i\005\324\216\377\262\033\200\376\211\315\032i\232k\376\262\273S\2441\334.R\022L\233K\247\314\223\033g\007\\\\\374\320\246-\224m6r\2415n\3114\227\366f%x\205\377\\\340\007\004c\001\353\224j\355?\270\351\361#T\327\221\224\346%WAl'\215\022\347\334\0021\230$\005\206&>\253\0351'\242\2172\005\032\2153\300\270E\231\016\266\337sj\035\024uG\334f5\303\226\"\\\305\340|\350\367\330\215\233\022# \205\356\243\350\261\250\330\027\314\275\266-\3412\264]\253\261\031\003\372\217q  0\213\316>\351\201_\013\370"
+	.string	"\331y\033\256\034\366\247\370kB\342\251\305\326\333\241\225\024\357\210\033\227\266\310\315\260\252\016\207\f\006\354o\"_\217@|t\371\377\257\352o<\033%\207a\346\265A4\322a\036b\224\367\301\004D\254\"L.\2658\276\212\244\321\377l9\224\345b~y\327\252I#\216:\237\247\b0\313\r\376\347\352\372K\240I\356\017\247\261"
+	.string	"Y\261`M\343y\364n0G\2015\367\001\214i\024\331\345\216\324D\312\231\313\202\364h\223\261`\256\267\244f\372#\307:\216\231D\227\001\234\330\317\236z\313\310\225\231\277C<\007\237\032\226^\210bu\230;+u.\367\250\303&U\246\341\206\271\320U@B\366D\232o%\021\272\363\264\310x\351 \364o\264\f\240\355\325G\272\227\213t\3123\220C\025\255\340\327\267o\315bD\376\027N\361\375R\355\244]5\205\377\007\340"
+	.string	"\224\234\205\310h<|\217r\362c\276\177\216\2205\207\216\257A\310\266#/\264\313\335\253\177/B $\203"
+	.ascii	"\232\232,R\204U\372\3414\224\344\331\376\3478\1774\232P\342\335"
+	.ascii	"\227\207\2347-\221\313\237\251c\"Fx\220\242\013,\301\356\001"
+	.ascii	"\021\273m\325\214\235f\034.d\275N\007B\026,\204\020\3340\364"
+	.ascii	"X\016!\221\305\205\002\211?\325\005\202\373\242\342\022\336n"
+	.ascii	"7ur\025LX\354#\227\276\277\016\355\022\361l\250\223]9;\354\315"
+	.ascii	"XP\252s\254\023v\t<\004\034\366J\376\241\257\246\037\317\b\266"
+	.ascii	"W=\203\333\334A\206p\303\350\341\032\272 j\223\t\206\036\303"
+	.ascii	"\350]b\262b\236\326TR\342D\260\261\260 N\253\260\214\204\212"
+	.ascii	"}\325\320\240\246<\264\230~\374\322\235q\306\255\270\350]Q\310"
+	.ascii	"\356\025\373]C\262\277s\024B\b\266J\215V<.\227y\3109\240\034"
+	.ascii	"+%\372\243h\007r\332\311\3733\365\200\337\376Q\221'&\354\233"
+	.ascii	"\364\250q\005\026I\320\210v\270w#"
+	.string	"S\347P\307'\016[\371q\222\322\007e\016\\(\373\346\256n^z-s\b\246\004]AJ\031\004\330\302\274}L\344\001\b\3251&\0070\314&\220\251\254\nt\271-\262\212\366\r8\224\251g\340"
+	.ascii	"\022\001\255\311\210ntIy!\265U\223\365\361\212\321XOy\t}\260"
+	.ascii	"e\f\321\007\333t\036\365\032\264\320\b\362x\253\306\037\275\036"
+	.ascii	"\360/\361\031\323\333\236\227\t\354\342F\311'\201m`\013\203C"
+	.ascii	"\310&\373\316\306\376P9\305\376*\227\211\001\003\203\\\003\r"
+	.ascii	"2\007\361c\234\377\005Hf\223\343#\262a\316\2552\221k\234\273"
+	.ascii	"m\017\225p\351/\\>\332e\355\334\257\273\007\2426\331\317!\nM"
+	.ascii	"\357k\273\004|,\210\231\326\314\337\335\272>\244\261\225\215"
+	.ascii	"\004\3361\222\332\275\205\t\033\023\006\334\213\357[\034\224"
+	.ascii	"\035\223,\225\232=I\334|\030\213\367\344A!t\375\037_7\370\232"
+	.ascii	"l\203\202\360\346\211\221\224Bi\365\204h\225\026\324\302\352"
+	.ascii	"c\363\1770\032cq\337\267Q\360D(\341\256\376t~]\270A\0362%_"
+	.string	"\250<{@l>\370f[txe\314D\373\252\254\374\217\323]+V-\017\240oia\306\037 c\334\271\016\365\032\207\277}o\246\356\272\024\270iO\324\212\201\320f\245\227oC\306\263~\033m\256\f\032p\202KWg0\377\305\364\342\205\360\274\367\361\020}\203[\273\216\004\315o\302\232\323\\\226\3171y\b\034\n'\2628\363x\354\217#\217V\370\033\305\007YjO\360\364|\327|\037\276]\247\306\237\370\372\332\330\357\347\247D\234\262}OVuz\364\363\241\206{\004joF\375\210h\037\361]\003bq|\356\033~4\340\267\276l\f;g*<\200\355g\363\2751\3519?\312\353\232:\340\316\360\272\314\016\020\360\303z\023\254\007g\325I\325\362Z\352\027-\2655\310\364\177\3079U\200\321_\363\256\272\337\366L\353\335\ro\270Wk\323}\\\322|\310^\351]\252\300\336\200/\341\\\222\257^JS"
+	.ascii	"Q\357\2611\337iNpgm\330\330\353nS\270\255\241\231n\346\205\247"
+	.ascii	"MWZu\306\242\220o\034\035\030\350\371\202\373\34787\376d\301"
+	.ascii	"1#g\217\371\250\017\351p\031\276\303\230\314\270\033\357\347"
+	.ascii	"<\225\216>\3501\031\001\367j\255\204\255\351\342o\372y\021\240"
+	.ascii	"\203b\376\211\342\276\035\267\\\3036z\205\357;\357\244|);(?\221"
+	.ascii	"\345\023\315\r0\344l\371=\221\237\224F\0228\217\260\251\222\276"
+	.ascii	"\217\343\341A\315\363p\376~\304\005.B\346\021S\\)\3162\304\017"
+	.ascii	"\367\271\215\361\276\351Z\263>v\346\361\326#\020\033 R\367\037"
+	.ascii	"\3741\221f\"\007\0367\240\347\250\366\027\244<\340\376\306`_"
+	.ascii	"8\254\275\242\360(\226\327\242\227\275\372\3256\277j\267i\345"
+	.ascii	"\235\320\365\317DSH\343\226\036&<q\b\350'\215\013\031\337q\344"
+	.ascii	"\036> 8\325\350\272\336\317\227\n\337N\301'\307\013\243c\352"
+	.ascii	"\364\217\347:SA\376\030\304\245B^\004j\263\035\032\r^\216\213"
+	.ascii	"-\021\034\034\262.\342\236\237\277\235u\225\2537\226\207\023"
+	.ascii	"!\227d\356@>B49\375\013d\273\b\233\305\325c\322\246\216\236t"
+	.ascii	"\200\225\325\037-r\254\253\247x,\314LM|r\317]\272\271\3201\243"
+	.ascii	"\317<;\303\263\217X\345\016\272\270\004/B\363\275\310\3635\360"
+	.ascii	"\026\273\336\320K\373\3308\2556\346|\356\027\371\177\224\227"
+	.ascii	"\261>RU\323\251&@{\035}\030\364(n]Y\374\2271\027\234\033\300"
+	.ascii	"w\273\247\324\223\335?)2\202\005\357(^%9\247\266\177\361f\005"
+	.ascii	"\242o\306\223)\254\227\346\273\022\277cr\371\027m\n|f\017b\274"
+	.ascii	"xh\370\224\363\030m\357\370\350\345\376\017C\327\313\206Q\261"
+	.ascii	"G>\233\314l\"\272\203J\240\365m\354\362\222q\321\333\341\223"
+	.ascii	"\207\250\"^\0225qTY\035\370\022\0023QY\221\266K;_H\325?"
+	.text
+	.section	.gnu.lto_.symtab.f27a251d4c2d4c22,"e",@progbits
+	.string	"applyBetaflightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"applyRaceFlightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"applyKissRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"applyQuickRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"applyActualRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"interpolationChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"getRcFrameNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"getRawDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"initRcRateCurves"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"getRcCurveSlope"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"updateRcRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"calcRcSmoothingCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"rcSmoothingSetFilterCutoffs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"rcSmoothingResetAccumulation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\003"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\004"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\004"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\004"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\004"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\004"
+	.string	""
+	.string	"initYawSpinRecovery"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f27a251d4c2d4c22,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
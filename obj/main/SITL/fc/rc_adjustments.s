@@ -0,0 +1,1394 @@
+	.file	"rc_adjustments.c"
+	.section	.gnu.lto_.profile.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\307\002\275\t"
+	.string	"\304\n\273\003"
+	.string	"\024"
+	.string	"\212\221\215\347\016 \002"
+	.string	"\001\003\004\005\002\005\002\006\002\006\001\353\252\315\223\t\002\240\342\234\212\n\003\004\354\275\370\376\b\005\006\007\b\243\274\344\244\007\b\002\007\002\b\002"
+	.string	"\002\b\002\005\002\b\t\365\347\255\326\003\236\001\002\007\002\t\n\013\002\013\002\007\002\f\r\002\f\f\277\362\357\313\f(\016\002\017\002\r\002\020\002"
+	.string	"\002"
+	.string	"\017\333\324\324\357\002r\r\r\020\367\203\242i\021\223\316\224\216\003.\007\002\021\002\022\001\022\016\002\017"
+	.string	"\002"
+	.string	"\022\024\341\276\210\271\001\002\025\206\271\335\257\r\026\313\331\240\372\b\027\321\316\352\310\n\030\240\342\234\212\n"
+	.string	"? p\202S$R=\226\024\2020)s\311\322]#\022\200\371\312\254\3633\331>\210)rx)\004\377\022po\003\314Kg\251-\224\302\240\032K\361\314\031\271I\240\252\004. \340\277\tm\335\340\006\241\007\002d\266\2613p`a\020\024"
+	.ascii	"'\374&\321\001\301\\\230\006\310 \271\006^k\3061\314\030\366"
+	.ascii	"\300\221y,\200\3638\370\203\004\216kr\347\335L\203\2056\211\344"
+	.ascii	"^g\304\306\351\356/J\274\303\007\013t\267:\244\225!"
+	.text
+	.section	.gnu.lto_.ipa_sra.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"m\003"
+	.string	"D\0033\001"
+	.string	"\t"
+	.string	""
+	.string	"\001\b\002\001"
+	.string	"\001\t\003"
+	.string	"\003"
+	.string	"\001\f\002"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001\003\001\200\004\001"
+	.string	""
+	.string	"\b\017\020"
+	.string	"\021\001"
+	.string	"\001\b\024\001\001\002\b\025"
+	.string	"\001"
+	.string	"\027"
+	.ascii	"`\004\240\263\302\231\271\354\253i tk\333\300\214\b\230\201\202"
+	.ascii	"\261Y\031\204&h7 I\216r\257\260\004\006\302\260A\004\253\234"
+	.ascii	"3\003D\001\006`G\314540\004"
+	.text
+	.section	.gnu.lto_.inline.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\312\n-#"
+	.string	"\266*\215H\340\322&\035p bk\325i0\334IP`L\221\272po\213HKI\030\b\276\204\364\n\n\212r%A:\240\254>v\325!\006^#\241!\216g)\021\232A\341\205h\030\317}\234\033\333&u\2645I\t\332;\311\024{"
+	.string	"u"
+	.string	"z"
+	.string	".RD\272\021Y0\262V\253\251\330l\t\037w\367\002\212\355\0318)@`\200\200"
+	.string	"/WI\213E\322\215\254DR\250\023\007`\013\231\362\252\0166\327m\324F\240%\247\360\023\353\314K\f\245\300q\032>\251m\225\264crww\273\355\326U\346\342\356\236T\234Z\332\026\231\266\332,\242\264u\025r?\366\335\345\331\354\032\211\023b\350\207\301m\235 A\220\350P\224"
+	.ascii	"\345\223S,\0028@\256a\225Y\304\324;or+a\347}g\021\355\253\250"
+	.ascii	"\250\354\316\374nw6\352\270+\372\337\256\350\331\363|\317r\307"
+	.ascii	"\227\203F@\202V\276\224;F\270\317\214\037{\353\216\243\256\325"
+	.ascii	"\327\024p\235\002z\202+\341z%4\027Z\305\231\273Y\267\356\274"
+	.ascii	"\265\367\255\277\243\260\261\242i\345\277\345I:={o\341\366r\031"
+	.ascii	"0z\024\261\374\360\341\216\034DA/s\346\002~\327\271\243\265\250"
+	.ascii	"u\244\271H\035\241\246\246\224\377\321h\376h.'\362\261\024d\304"
+	.ascii	"\377\374\357\363g\226\354\262\365e\346 \350.,e)\025Tpw\316\235"
+	.ascii	"\273k\001\305\326%my\017\266\326m\364"
+	.string	"\304\007\310s\363\036\217\370\026\231,\242\246\256(\345\314\315|'\306\211\234\005\356\034#\213x(\001\315\f\233Ms\244\232\t#\005\323\366\353z\244\257W\320\006\333\3536*\2555Oj\021\206\371cr\332\025\203\272wv\2204t.QIi\032\371\343\342\005\007\035q\363\004\205\037\314d\022O\225U/r\266A\251gzz\236\260\023\035\325\204\356\351\ts\037\035?#*v\246\244\033I/s\2369\227\033\375\030\211\210]\025n6\206\335\225\331\256\253\232xZe\356a\314\3219\340.\354.c\311\270\316S\005%8\347o\223\335\220\023w\367!\f\006\333\235y\236\267;\353\002\201P\250\301\271\"\022\021I\nR\220\264\006\201\005FA\305\220\215\017\022\300\345@\307\252D\267i\377\277\003\210\253\003\220\004\317\330\2316<X\312\002\374\301\357>\375tLj\347\246B\216\253\222\214\025\024\221\300\275\"m\177\350Q\374,"
+	.ascii	"l5\276\267\310\310\246\312\001R\325\036<\264\236+\nm\232\207"
+	.ascii	"8\327\237F\251*%\375\0274\255\334\244\222\347\265am\257\004%"
+	.ascii	"}\372\rP\321%\316\020uz\243\022\264\207\331\352\311\332\360'"
+	.ascii	"\262(\303\345\364&\024R\032}Q\301\305\307\223\026\210\033\022"
+	.ascii	"\233\231M4}H?\0023\271J\323\2366\032=fi\220\017\245J\315^\001"
+	.ascii	"\032\265$)\375\261\322$\260\002\343\355\363\364P\364N\350\371"
+	.ascii	"\220}\301\275|Hv\3137\332-\026\260\275<\"\314\030\332A\030\034"
+	.ascii	"\320\030\264\037\223H\177\3243\227\276Z\372|"
+	.string	"\3700\267\207\301\f\272o\250\375\004\230\321j\314\210(%0%5\317\313\201/X\344\360\223N\306\316@z\335\003\037\3113\242e\353\337\017x\346\231\tB0\251W\203\236\247\352\f\275\315$\265\256\225\237\225\235b\227\252\177\215\216d\347\225\376\214\234S\365\022\377\213\312au\235/.\003\333\221\361[}G\371\354\363|-&\225ur\262H\004\223|\214\372\0378\212\302\244\231]+%\020G\2719;\026\tM\256\230S2\313\t\361\325\2454\212\256\341\353\037\271\243\005#\211#\266(\307a\016p^\244f\264DP\203\222\344]\264\303\033L\003m\245\212\334X\325\243\314\247\243\240lC\252G\3363\250\022$\177rAh:\275\212b\274\030\335\312\034\210\357KT\022^\356|G\222\261\345\272#\317 \322F\375\301h^\316\350\202\222\265\372\017L\032\275\325U\322S\007\364\240x\352\310\016\366 \037\316\340\335\247U8"
+	.ascii	"\373\036\265\212\001RKb\263\r\253k\201ih~\b\352\025\013]&\307"
+	.ascii	"\316\362\270\372\271>m\357n\230\177\313=Z\356\321r\217\226{\264"
+	.ascii	"\334\243\345\236\250S_\240z\244^\244ih\322\347?\314\313\270\352"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\354\007U\021"
+	.string	"\326\024H<0M\233t!w\244\242\303F\215\206\034G\354`\374\225\222s\316\262\024\024\024\020RTL\350RPP\302-\243\007\233\221\242\325%~\f\374\376-\302\314\336\032Y?\262\"\020\266&\323\0160"
+	.string	"9"
+	.string	"6"
+	.string	"\356"
+	.string	"Y\217M\2547\243\350\001\256\017\326X5\302/\305\013n\346\231!\350\f\341\272\202Op\034\303=\206\353\231\321G\313\037\355L\227\231/)D\004\221$i<\036\020J$\323TU\024eY\357\rAo\206@\336\276.\213e\007_.\220#s\207\030L\2168;\234f\333\302b\002\256\217\325x5\276F"
+	.string	"\277\363\nt\001\001oc34a3D\302}\256\b\026\b\227\007c\032<\203+\230\261\031\007z|;>\261Y\261\364\215\364\013\367\027\256;w2\321d\231\226\024\212vV*k\3518Q\231ye\346?}m\337\242\324\351\226\237@P\302\200\t\022\033p\333\266W*\023\211`\030\210k\232|\310<h(\035\264\254t\234\016\207h\203\244A\343\221\001rH0L\027*\013T\005\213B\200\266\250\261\2707R\220\242R\032\003P\243\224$\017\022"
+	.string	"B\242\n\244\224!\002C\264\260fb0\\\357\32771\2133I\213\357Ox\221\237l\t\031\007\004\224N,0z@\256\3777^\333\311\353\370\313F\331\027\355\037\262\324\016\3305\365\235\230F\275u\361\3060\021 \016\304"
+	.ascii	"$\036\032\360\222\2625\310\020=\203,7Cg\025\022\311L\312#s\301"
+	.ascii	"\"\223,\221\314\020\230%\263S\243v\230\232\375jRu\263\323\203"
+	.ascii	"\204\316\231\221\267\"\272)\236\321\271\240'|\327'~o5\337\034"
+	.ascii	"\342\f\207\262\202a\346cIq\200{\201\264\250\300t\213+\210L\201"
+	.ascii	"vLWFM\300\001\340*W\237~r\275`\217\332Nqj\344\243\021\301|\367"
+	.ascii	"\234\326\303>0\327Z\034\277\373\312\226\332gF\250X\207\314\316"
+	.ascii	"\346\244\324\304(\3045\312v\337\225`\245\361\205~\177 \311\315"
+	.ascii	"\223O\211\252\330}\370%\374?dA,\021\224\236B\265\b)"
+	.text
+	.section	.gnu.lto_.pureconst.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\b\230\004\t\232\004\f\232\004\017\232\004\020\232\004"
+	.ascii	"\021\232\004\024\230\004\025\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"=\007"
+	.string	"\202\f&+pK3\034\344\303\005"
+	.string	"ya\020\b\376\003"
+	.string	"\027\007\324\353\017\326\026"
+	.string	"%=\234x<\327\177'Ph\"\020\033\364\222\266dK\231\002S\022\027\304c\312\242\254\353A!x\331x\024\026\031\366*~\376\025\233#\262N\345Sg\203\343\300l\002]\351h\001\b\307{\330{\223\241|\241S\241<!\371\023\214\252\314\367\211\320\311\2243\235\007u\316\315\035w\306\334\3019\363\366\334\240\310\023m\331\025`\027\317\247\374\351\224\312\245\316\250<*\362l\312\233N\250\034j_\006xj\004\036"
+	.string	"@\t \303\324#=\304=\006A\240\203\031\tK\030\3072\004)[ c\351\222\314M\252\035\310\b\201\025_V\213\035\214\264\013cl\005\233U\311\t\215\004[\230W\031\t\bS>T\020\372T\024\260\262\270\347\266|"
+	.string	"\253a"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.lto.40c96d3d0d0eb099,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.71.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375 \227u\004"
+	.string	"\004\b^"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\321\035\006yw\250\306\006yu"
+	.string	"\005\001\006'\001\254\002\005\001\006\035\001\036\245\300"
+	.string	"8sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\004"
+	.string	"D\210\021\346\r\240I\310"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.80.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`L\004\315\r"
+	.string	"\224\023?\005"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\005\001?\202\210\200\b\177}\273\001\005\001\006{\001y\001\"\030wu\276\001s\275\001q\274\025\001\035y\001!\302\301\034\001o\305"
+	.ascii	" \310"
+	.string	"\001s\307\001q\306\033y\001\037\314\313\032\036\320\317\031\007}\323y\030wu\325\324\030\377}\330y\332\331\027\027\336\335\026\026\342\341\025\025\346\345\024\024\352\351\023\023\356\355\022\022\362\361\021\021\366\365\020\020\372\371\017\017\376\375\016\016\202\002\201\002\r\r\206\002\205\002\f\f\212\002\211\002\013\013\216\002\215\002\n\n\222\002\221\002\t\t\226\002\225\002\b\231\230\007\007\235\234\006\006\241\240\005\005\245\244\004\004\251\250\003\003\255\254\002\002\261\260\001\264\263\002\360\003m3\265\0024\262\002\257\002\256\002\253\002\252\002\247\002\246\002\243\002\242\002\237\002\236\002\233\002\232\0025\227\002\224\002\223\002\220\002\217\002\214\002\213\002\210\002\207\002\204\002\203\002\200\002\377\001\374\001\373\001\370\001\367\001\364\001\363\001\360\001\357\001\354\001\353\001\350\001\347\001\344\001\343\001\340\001\337\001\334\001\333\001\327\001\326\001\322\001\321\001\316\001\315\001\312\001\311\001\304\001\303\001\300\001\277\001"
+	.string	"\200\201\250A\3048\205,\373\006\200\2234\315\001\020 \350d2\353\0015\350\263\242k4"
+	.ascii	"r\352U!\245C\272\231\004xgm\rDd{\215\215\201\223\210|\340\201"
+	.ascii	"\230\357G]u\200@\330\256\020@\233C \307\022\001\352O\306 \300"
+	.ascii	"\033\006\333[_H\343\215\330\260 \324\266\215\271\206]\322\306"
+	.ascii	"\273\313\016\216\202\314\262d_\357\243\035\303\253\326\375Sn"
+	.ascii	"b\031N\374\"\237\243\024\315\227\257D\240\002"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.81.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`62\305\216"
+	.string	"\032\344"
+	.string	"2H \216[\031\016?b\275\230\217\310q\202\356_T\335E\222\277\"\314\323\273\017f\241\345\016\370\337\2761\300h8/\001"
+	.ascii	"\324}l\355\256\025gw\334q"
+	.string	"\366\3259\367F\244b\205\352\"!{:\300&a d\357\235\244\224\001\025\003\304\002\031\003\275/\336\353\342\275L\357m\241\366\2620\366\256P{U\2747\305{\227\324^\024j\357\211\367*\275\327\204\332[B\355%\361\336\021\357\025\241\366\206P{\223\336\013\342\275\037\324^\017j/\322{\217\336k\244\366vP{\213\336\313\341\275Dj\357\006\265W\303{\217\3575\252\275\252\332\233\276\027}\357\325\336\346B&\364\376\210\020ZW\260\305C+\236TN\030v2\357r\232\037\363J\037\363\214O\225@\263\347!\025\302\3031B)\0302\305\246(\202\311\035:\374\232cz\3111\271\352\016\267\334\034>\271\353%\234\306\242\263\230\227\bh\310\017\221\017\223P s\020 A\317@\206\207\200\006\035\022\216-2\375\314)2\007\347\016\371\310\035\356q\303\324C\307\374{s\350Ww\310\207g\347n\357\016\035:x{\230s"
+	.ascii	"\231v|\340\004\272\341\272&\314fO\366l\262K\004\003\267\331%"
+	.ascii	"Z\022\230\315\246NB\346\272\256D$"
+	.string	"\354\022q\352\264\253\\\246[\242\335u.\336\021+\354\350\354\302,\\\327\265\211\323E\036\337,\267x\350\321\232\245E/\316\272\256O\373\300{\267\006\016%\257I\362\321\272\324\263\026\204{\227\323\360\233\222\341L`\244u\335B\030g]\341\236\026\352\310\351\302\035ww\331\f\237Q\356\342\241pkbF\256\026\266\346\016\327u\215J\301I*\247(\177P9\375\n\254\344\245[\347\316\255\334\306\355\232U\263p@\246~\370\350\301c\207\216\034R8n\330\250AcF\024\324\223S\223\214\0300^\270`j\301b\205\212\024K(N(\231(Ab\204\210\020I >x@:2\352P\304\201h\203\206\243QM\321\267r\231\371\364\353\022\303\342\245sF\341\235\213R\367\325+\027\347\305\273\306\313\256\253W\315\302\241S\262hA\201\201(eY\242\200\267\330S\212?\022\331G\342\336\241\356\301\243\020\357(\304\207\330:r"
+	.ascii	"b)@\177\317\306q\343\017\333\370\303{\374t\r\032\203<cpP\260"
+	.ascii	"\243\240\372\370\251\217\220\257\235\3564\331a\031v8P\235\216"
+	.ascii	"\001C\217_\350\361 8\355\342\rS\035\267\250cD7\315bE\033V\321"
+	.ascii	"\206\023a\350\024l\226\336\030\305\033V\232>\241t\206M\234yb"
+	.ascii	"\246K\220h\362\210&\027\263E\204\t\001\206\223\300|\265\320 "
+	.ascii	">\260\300\036X\020\363\322HGkl\2646v\245;\240\025\2351\20733"
+	.ascii	"+M\304\002\2147\250\310\"E\005\326\300y\302T8c\025.\204\231\365"
+	.ascii	"\021\225\201vg\n\347\t+C\223P\262,K\2606Ra\025\225Qhg\330Al\013"
+	.ascii	"M\002\003\323\325iZ\235r)\242\225A1tx\347\r\2330"
+	.string	"\204}\374\366b@\343\366\245\013g\t\253\262A\354\211\332\200di \262,\301D\240S\370h\t\264;S:\210-Q\246?-\177\230\216\333K,\253\333\030d]\327\355.1)\274\005\360n\232ewK\330}\342\020\273\031P5wQ\251\234\262\326\233Q^@C\223&}b\222\351\320\t\356\222\301\t\227\247g:n\272\353\213\343C\347\304\\x\346\362m-C^D\317\205\357+\214\272}\211\323\\\3019\303\262\027\367\204\377\350{\217\026\332\362\377\007m):\351E\247FLN\t\256\353\252c\267\252\017\215\034\327u\225\342t\233\220\ty<\220Z\373b\202\312i\337\350\256\257)\307I/n\253\261\207\031\360`u\342\206Hs\001\205\364j\333wb\0363\354\346\305S\233\334\253\005m\317\220\302M\341v\240}\252~K\317}\252yz(\374l\377\331':HOip\237(a\231\211\300m>\373D\003K"
+	.ascii	"\356\023\345#\361\267\235G\304^\337\266_\210/v\266\357$]\021"
+	.ascii	"\263b\321\333\336\333g\232\250\007\002o;o\237\351\263\354\203"
+	.ascii	"\234\3559\373L\373\364<\304\331g:\250\f\211\223\352\233}\246"
+	.ascii	"{\2168\251\272\331g\212g\304I\025\206\3556\373L\335\224u\240"
+	.ascii	"\333'\272\250W\304IUn{\216H\0055\333k6|\245\331~\323\360\205"
+	.ascii	"\202\231\3553\307A\346v\323\330\206m\273M\365\342\3026\231\324"
+	.ascii	"\353,\314\266\030T\361\313v\013?\354\262\355\245\367\304\254"
+	.ascii	"X\270l\257\260\317#sR\345t\273k\345r\023\323O\025P\331\272b1"
+	.ascii	"\332>\273k\215\301)/\337`\276\254o\255\270D\335\344\273!$i\356"
+	.ascii	"\332\024"
+	.string	"Y\307B\321\2535\333\r\372\303\362o\331&>\341\251\332[\\_V\027\332\205[\366\325v\031]\277e\267\360\371\247\217` `\036<}w\352\350\345\341\275\245As\306\214[\223Y\246\215\215\214\030/k\\\324\264\244aA\263R\305\214\312\330\024)a`\f\307\314Q\240x\275\227\271\336\313[j/k\275\227\263x\r3/\337\313\353{\225,\307|\302{\233\260\223\367J\355e\362\336%\357\035\341\275\"\250\275V\306^%\307\336$\357E\362\336\020\336\013\302\261\367\210\261\367\203c\257\007\357\355\340\275F\336\313\301\261\267\312\330\273\301\261\227\352\275\032\2747\203\367bp\354\275\300\330k\201\332[\301{)x/R\355\235@\355\225\340\275E\336\033\301{!P{\0370\366:\240\3666\360^\006\336\273\300{\025P{\0230\366\"\240\366\036\360^\"\3575\340\275\005\250\275\004\030{\007P{\005x\357\220\367\nyo"
+	.string	"j/"
+	.ascii	"\306\336 j/\220\367N\275\367\307{}\250\275=\214\275<\324\336"
+	.ascii	"\035\357\325\361\336\034\357\225R{q\030{o\250\2756\336[\343\275"
+	.ascii	"4\336;C\355\2152\366B\251\275O\357uzo\323{e\250\2751\214\275"
+	.ascii	"0\324\034HF[\240E\242gV\332\316\201\200\\\005\324\f-\353\332"
+	.ascii	":\020\303\345\326\217\263\336\031\220\217\377\350q\037dP2t\f"
+	.ascii	"\235\322\325\003\225\302\343Es\203\020\335\320\204\305\200\301"
+	.ascii	"\365\017\203^"
+	.string	"\260\rZ$\032\005\375b;\017\332q/\264\013\345\"\343\372\016@K\256\034\347:gAR\317\201\343Rl\350\026\252\205>!\303\201.o\274h\356\211x\347\242N\320\037\023\224\0371b\0132\214\270\310/*\2229#\332\370\241\344\223\241BY\240\334\006^ \024\032\347;gB3N#\3523\330~H\3100K\324\fP/\232\013l\226\225iba\261\"\354\0368Q\205\030N\\\344\013\001\2119'>\021&\235\376(\233K~\302\376\344\027\027V\207\233\316}gC2\336\024\3432\006\223<'(\310\007L\214\363\334\340\036\030/\232\363k\226\331\245\210\341\211\265$\345FX(\274`-\362\177x\274\274\261^\274/\371\304\247l.\335y\201\227\027'\205\3310\235\361\234\027[\234\211\305[(\313|/\311\3165=e\323\207\322\314\351(\321<O\351\246|\033A\345\224\305\331\331%\215\223\317\371\335\b\313_\026"
+	.ascii	"!BTNW\274h.\257Y\366\002\033\226\023JcO\237\230X{\262\310\303"
+	.ascii	"y\263\366~\242\342nb\030\273\n58qy\316c)\316y\336\313\245\247"
+	.ascii	"@\361\2456<\flP\334\210\rNS\316\0302qJ\220\240\362\016\\#\324"
+	.ascii	"\270\026y\2718\2657\327\211\253\201\243\362\023luK\300"
+	.string	"3\025\2453\340{\313\304\225J\334D\232\344\0174%n\304\346\206\215\bg\236\020f/\372J\302\362\265\3107\231X\336_$\336\226l\301FbN.\360l6\342\034\370\366\022\361\021!.\202L\362\207"
+	.string	"w!\304\215\330\344\232r\300\340\001\361\301\312/\346\241\212\330\"\017\246\0051\245\3365\340"
+	.string	"\016s\b\341Y\036k\223\356\305\312\223b\334%.\005\317V@\234\005\337`\037\016\302\303?$\360\265\344\321\303\213\344\016!\246a\341\312\212t\204v\2451\243)c\213\374\026-cHO\303\202tg\030\327\347\214\366\024\370\350\334\347\235\202\321\217:\334\b-9u\326\341Fr\206\315>\035\004\313\250)J\273\t3\016`f\213\274Y\031\330\333\254\350dI\246\261\264\027\311=\227M\314\177\316i\013\310\341\374\347M\205\350\0346\234\310\351R\222Sk\013\\l\303\215\344\b\021\3458Yc\246\343\b\252\204!\026bu\"\321\3256hy\2113\016e2\370i\270\332\2350{\235-\362_P\3164\274\353\\\032"
+	.ascii	"\371,\237g-]\210\217\347\347\273\212\361G\365\306\247o%\247\256"
+	.ascii	"%\245\336\350.\020Q\216\223=\314-\020\025\343\034\257\266z\230"
+	.ascii	"\227Hy\302\374\t\3223\230\325\205\214\"\232\271\234\004?\240"
+	.ascii	"n\247E Az\2545~\341\262E\275\332r\005*k}\203\270>\235\266\310"
+	.ascii	"cUp\\\327,\251\355\305\257\027\004\373\001\024\223\017\256\250"
+	.ascii	"\222D)\261J\222\304\252\252\204\221&H\250\212\220`D\311\221\352"
+	.ascii	"\n\211\021\016R%VG\256\252\2244\031\300\203\007G:Pb%\304\310"
+	.ascii	"\025\225\003H\254\226\\)\261\252B\332*(&WJ\214$\271b\322\004"
+	.ascii	"\004\016\2502\250Z\022U\325A\224\222#TI\242\252\2260\211\202"
+	.ascii	"ZZ+\021\214,\211\272\262\262Z\022E\004\347\204\277e\271\213\035"
+	.ascii	"E\024\212\331\016\227\001\220\234\367\362\204hp\336\323"
+	.string	"\nR\344\214\027\370\203\310\031O\213\307\220\363\234\266\034:\316v\2017\234\316vd4x=\2779\2418\353\214\246\255\211\267\316f\362`0\327\271\351db(\3472\201+8\354\314\346\\b)g2\201J<v&CF\202\251\234\307h\205`\263\363\025\262\017l\345|\346<\252\322V\304ig\263\274\r\254\345<\206\312\033#s\371\325\275v\367\352\030\210O\fb\241\223/\267\265\360\006\371\342\342\242\031\002\006@r\021u\002\274\325-2=\263\362v\256cr\025\220\234\311\023\027B\274#\031\341\214wn#\302G\260\272\b-\244e\311c\026\345\333\321\352\032R2%'2$\304c'l\210\020\r\236\302.\2004v\213L\245\210\2459\333%9\230r\214\323Z\224\364\013\214\006O\322\306g\271\344\032\204\360%g8 <\204#\007!\365R\216\231\022L\273R.0G>\225n}p\"\303@\3042\031\366\340"
+	.ascii	"\bR\344Kx@\320\340-2]\246N\320\234\361<x\272*\3078\t.*\272\025"
+	.ascii	"\271\007N\300\016^\004%d#\357\340<\207\203\033\251:\007\207\224"
+	.ascii	"c\200\254\031*\344Vu ]\01678\221! \240)B=`~\0209\212=\037g\366"
+	.ascii	"\026\211\316 \350\314y\217\352\201\224c\236\326\n\0019\211\234"
+	.ascii	"*\217\016\003'b\024'\2033p\246\203\3013\270\340\030\234\303\240"
+	.ascii	"\177\224c\200\b\372Q6\245\326\3728\225oQ\202\027\034\310 *h\301"
+	.ascii	"\211\f\3514\313\370\360\340z\360\030\362$\276\035f\370\026\211"
+	.string	"\002\3521s\346\253\340\177I&<C^\201\363.n\352C(\370\324\331\016\362\024Lp$\332\227\234\252B\371&\270Q\336]SN\235B\0359t\234\350O\312\355o\221\350\236\236\333\371O\202\347\341\335\325\321q\t\336,k\\G\004\257q\366\203\340\021<p\b\344\330\305\251\363\300\033\007^\344\254C\214\233\203\005\307\r\247o\330c\243\271g\221h\033\030\232\347=\r\234\3169\027\350\364\006\350\342\\\334i\201\2738\353Q\340\013$p\005\342\326\250\tL\340\r\201\0279\351\232pqj\320X\257ap\006sp\221\250\0317\346y\360\2003\223Ne\332dX\177@\333\334Ry^\r\270\362\314\247\200\033@\300\013@_H\362\334\032J\306\205\023d \340<'f\200\0279\345\320\330\255QPY\007A\370T\206p\221\350\027\026\312\234\t\005x\227\244\323\232\262\271\264B\326\005\230S\214\313\022r\316;\373\t\340B"
+	.string	"x"
+	.string	"j\350\026T\313\t\212"
+	.ascii	"\240iA^4\247H\307\t\216!5M[G\n\203\356\250r\230=U2\245DDD$IA"
+	.ascii	"*i\f\342\r\b1\3100\211\254\016\022 \0029\b\307\201T"
+	.string	"*\007EHS\250\321\030\\\037\216'\263\274h\243\323\220\\L\213\361h\017\207x_\030\276qh\205\2769\252\304G\207^\205}\263_\330\033\001\230J\256\255\222\221\034\300K\216A\022(\035\231\023\201,\302\322\202\346\022\364\325\023\037tX\026f\307o\213\250\303\301\241\203\307\013\305\245\234\362\\K\317IH\303x0un\235\302\177\234\032\017\030.\267\206\352T\342\265\003\301\343\263&\253\211N\345O\367\026\310\302\326LQ\331K,\363\202\036h\304$A\017\230\265,\230\003\245n\371\252\036\320z\240=yV\003\302\354?#\362\330\233\031\024_of\241\330\003\2318\377\361\332\326\2519'\343K_P\030\375\3536?\230\230\316\203\301\304\021\016\3273\022J\232!\246\032Ei\273H\300\213\275\215I&\202\323\n\221\004\201\371\300\322 \025\323\317\200\256\200\002\225\310\365\274\004\005yy@\214t9a\311\314B\356\006Gt"
+	.string	"\223\220\311P\020$\2444P\346$\031\005QNk@\220\367\207\304K\227\023\226\364\314D!r\025;\370\342\003\b\005\032\207\202 !\245\201rC\004X\277*\214\374\007\320\222\032]\274?#\220\246Q\374\2041\267\"T0$"
+	.string	"(\340Ha\276\342\333\312`\211s\224\2246\\\3171\217#\213%\305\\\0216o\240a#zo\303\013\202\027\322\206\006"
+	.string	"\b\2619\310\331Cp\371\034\376<\352?C\n8b9\332\253(1\351\257\213\220i\356\006V\231#\265\335hm]\302\242\350p\354\267\004sM\234\022\364\177`d\005\202\367W\343&)\032\233\by\246H\312<\230Y\027\270(:\034\373-`^y\013\257d|w\215\341u\220y\344\323k\360n\030\303/@\216\265\033\200Y\f\f\247\2565iY\207-\2169\313\215\310/*#\215[\333\367\364\360\307#\025\003\356\233C\020\352\355&\211\347\364v\024h\003[\032l\200\013\264\371\253\272\2134\231\236"
+	.string	"\370I}\370\351\3541\016\004\3365\025\026d\303Y\263\363\235\267\363\364\317\223"
+	.string	"4\212 \336>9\337\f\255\277\302p*+\214\350\363\270\236\002a\020\251\223\t1j\337\250p\275\214\272\332\363\026\256]4\257\215\342L!\021\347\013p\234\242\247KD#\2708:\365"
+	.string	"$M\350*\001\366\221\237&\246\200\341\223\003I\204\375\037L\252e\234\025\377"
+	.string	"\263\250\t3hVJ\017U1m\254\266\017\372\313\302z\374N\377o*\331N\362\r\320%;\232\364\001:T\311\027\336\354\264\253\2407 \244-\003\352\004\305\"\377\01741\n"
+	.ascii	"\213\2551\034\007I\242Z5_\251\365(\026O\204\327\232'P\342f0\236"
+	.ascii	"PiN\207\255U$%\314\242j\037e\256\177C\"k\025$Q\013HL\"+VA\315"
+	.ascii	"\262\343\260\210\367\t"
+	.string	"(\355\352\310r*\235\242\034D\361T\243\b\005d\340/8\353.\252XR\314\025\201i0\254\370BI\227'#\235\n!\270\334\240\006K\022\261O\366Sv\365\214\2675o\260R\2638\272\034F\247EL\f\250\007\026\351\360\272\233Q\321u\246\363\023\230\216B\307c\r<h\315\335v\204\274\222\215\276\371hz\240#\322\025\351I\374x>\177\177\007:\276\252\250\371-\314E/\216h5\242\2737T*\312\236Lf\316\361#\r\330\336\2610\234\374\034M~\306\323\220\220\372rt"
+	.string	"\215\240\337A\360{\322\204\251\255AX\246\362\264\206\251SV\374\030\272\317\326\274\231T\231^o%w\274\024\023\235;\211z\334'\317\300\360\\\21294\005\376i\363\3078\304\207\ns#\252\213\302"
+	.ascii	"\216:\244\370\202\372\007\305\366{\235\211\340L\247"
+	.string	"\271C\2330\327\206J0\030\022G\367/M-q9&rvb\001\336\253s\023^FI1w\236!\005\363\2612\256'\265\331\250\f\030[\220#\320\333\311\3702$\\\326<\030@\361\\\301\212\3655'\256\373\347\237{\347\335\375\203\207\376v\377\317\271\367\217\273\373\377\374\240?\377\363n\275\372\217\353\356\256\377\350\305\237^\3463\037K\220\367\3527\334)\272C\330Mu=\325\322\257\265u\266x\273\245\331\337*[\357\333\342\216v\264^b2\027\311\004\347^\243\264\315\267\237[;\235\376\265\247m\375&\266\260#\3532J\212\263U\223X\315F\311\276\245\250\2220\f<\210\3204\245\240\231\354C\177\361]\376\257\360\234\253O\240\246A\370\224s\353\223L \0305\377\256\002OIsO\343\345\322J\371!q#-FoY\276\017\032\232\347[\320\301\221*[ubG{\343\375+\360\336\023\352\231\337\3446 u"
+	.string	"\025\336\002\262c\323\223v\205\200\\"
+	.ascii	"\321^\321GzW\200l\340\366\347\273G)prft\302.\330\321Y\006\266"
+	.ascii	"\203\b\3629-\334\234\n\352\001\274\236\361Ba2\227\237i\276\347"
+	.ascii	" \f\270\002C\035\307\331\024\001\016.$\005\226\016\252\202[G"
+	.ascii	"]\203\372K\250g\352\364\275\247\2042\264"
+	.text
+	.section	.gnu.lto_applyAbsoluteAdjustment.82.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\022(\355p"
+	.string	"\252\271\274(H NSI\007?\257z\363@\023\261\357A\314\b\245\246fn\2463\371\364\262\377\337\227,\245:\344b\030\017\t9\004"
+	.string	"=\233-\024\233\013\312\364YPB\371\267\266\035|\377y[n\250W\321\317\024\302'Z\333\215H)S\240\002 \002\177\002|\256\374]\023\216\344\001\334JD\321+\211\217\320>E\025\314,s\367_5\263\304\246\bL\304&\232]\227\2723;\313\020\360\226[\370\262\3545\313\370\\\361[\216\0056\251"
+	.string	"j\206\245\313)\203\313(\214\030\354\020\177u\b\215\022\013\017\347\034\025\353\022\r\353\232\215\230MB\026\026\331I\304\267<\264\267\034\374k\026\342\323\034\024h)\030\270\f4\324\374#\330\004<\264\374K\227~\204z\030\341Q>\342S6\322\243k\2560\327\314\263\263S\267DQ\324n\357\234,\235\2778\303s\362#\241\260u~\244w\260t\376\343\354\016\251\203\037i\213Q\277\327\267\356H\377\231\327;~\221\035\231d\232\210P\024e\261\305Wp\354\271\353\241R\217\200y\347t\235\034P(#\240@c\371\3378+\307k\343>X%\024e3\274\203\242qRoq\334\342\343\216\377\277o\026\216\327\257w\306\271\225\031\307\322)tM\024E\247J,S\335\342\271\036\352\026;\314z\355\351>w\271\317\371\t\217C\340\352"
+	.string	"\003\254f\024P%#\006\025\0010^\f\340b\252\205T\024\213\025*\004\b"
+	.string	"\200\024(\240N\230(\361Db\204\210\020NMH\020\037\230\226<tP\342\260!IC\006$\f\027\216\306Z<\233\275\276[\2678\300\270\b\212\225}\355\351\346\252\354\345\252\334Q\341\317\371\t\247\226\265\021\302\366q\"\326\300\302\362@`\004\256\020\367"
+	.string	"D\275C6\340\221\225\243\235\341\bO\013\\@Use4\375\016q\f\252\301%`\020\320\020\303xAh\007 \264\201\203\330\305\324\337\266\370\033\304\207\245\242\366,\213=\203zxE\036\025xV"
+	.string	"<\233\250\217\003"
+	.string	""
+	.ascii	"oS\340-\341\035\243\260\203JaO\244\260\206u\330D\t:\373Dg\017"
+	.ascii	"\3450\2118#\340V\004\334\027\034\016\341\344f\233\334Di\303H"
+	.ascii	"\020f\366\203\231\2602\314Df\351m=\274\215\215\341\016J$,\007"
+	.ascii	"\022\312\334xCR\332jH\333\202\306\031\326\017\231\027\244.\213"
+	.ascii	"\241\313\331\232HC\306\205/@\215\355\321\304\032\026\345\032"
+	.ascii	"\327\017\231\022m\n\327sE\332\036-IeRN&\300\021\fm\335\236fk"
+	.ascii	"`c\\\334\262\347\271\002Q^aRY\224\223\351J\0311V[\246R\006\205"
+	.ascii	";\361\221\027)b\206i\036\2738d\n\t\362\263\203\302\233\245\030"
+	.ascii	"\021v\215\354\fC\031Xe@fjKk`c \330H\003E\321\263X\031\226\375"
+	.ascii	"\002\373\027;\370\357\301\017\345!\253\246\263\372,\245p\023"
+	.ascii	"\367zu\252WM\263\b{\272y\273\323&\f\223\021\030'\236\331\366"
+	.ascii	"4\276\370\360\203Z\032\020\272\301\234\025\235\027=mb\366\225"
+	.ascii	"8tF\364\264i\356i\360)\262\221\222\304vUB\347BO\215{J\021\202"
+	.ascii	"\372BlW\r<\007zjd\3669\375yZ\021\225M\333U\373\234\001\2376\335"
+	.ascii	")A\370\235\371<E\026\366}\310s\326\363\024\311H\311\304w\356"
+	.ascii	"{\212\344\243\\b\341\254\367\024\211\327\347!\357\254\302Sc\242"
+	.ascii	"\262\203\235>\245\355\252wO\221L\016\333USxj,\334\260]\225\316"
+	.ascii	"\031\205\247FC}I\314\247F@J\r\333U\345\316sO\221\203}Hq\347\023"
+	.ascii	"\236\"\005\225\030\340\316q\236\"\001\365]ps~\363\024\251\247"
+	.ascii	"<\2629/\237\"\351\214j\316k\236\032\t\373*\232s\232\247\306C"
+	.ascii	"\312b\231\263\231\247\306\277s\314\371\355\251qO_\273\235Ixj"
+	.ascii	"\274S2\230s\333\323z\270\333U\267\310#\374O\233\354\364\241\350"
+	.ascii	"\327\246=e1T\305\026\245\232E\234=\250\034F\374\343\300\270\301"
+	.ascii	"\374{"
+	.string	"\242\315\366\253Is\246\314\233\030\2676\266\265/i^\270(\315\264`!k\376Zi\376Vi\376\212U>\223\312_R\371J*\177\203\312\347\252\374\255\312\327\252\374$\225\257A\345gP\371H\232\237U\371G\232_\244\371C*\037\253\371B\232\037\244\371@\232\377\243\362)h\276\217\312\227\240\371=*\037\202\346\363h\376\216\312w\240\371:\232\237\243\362q4\377F\363m4\277F\345\323h\376\325\306\355\032\320|\253\312\237\321\374\252\312\227\321|\252\346\303\250\374\027\315w\261s\273S;gWj\231{\024\225\017e\344\2378\362M\030\371%\216\374'#\237\304\221?\302\310\027Q\371!*\337\311\310o\252|\244\221\017\242\362?\030\371L\225\277d\344{\250\374\016F\276R\345s0\3627T~\222\221\257\241\3623\030\371H\225\217\301\310\277P\371\307\3127V~\255\374b\345\237\225\3375j\274t\016/\275\207\332\004"
+	.string	"\200\216f\026\366K\230\002\t\341\223\255'\017\222^B\016}|{\027\350h\016]\fda\303\243\264\326\261h\005\024v+\345\245J\333\027\324\216f\273\375\032\2368\262\206Ov\336\235#\275\206Io\032\357\316\256\310\216N\352\342`\035\r\313/\275\343Ko#\023L\224\340\321\234\267\337\303'\254=|\262\353\230X\275\207\031\346\262\242\004\311\315\301\340\006\217\316\320\305\3008\244"
+	.ascii	"\324\346\276\244\301)\327\232G\247Y\353ut\207D\035D\265\021="
+	.ascii	"\232\353\354\371K\004\005_O6\034\034\n\232\2770\364\357\005\327"
+	.ascii	"n\262\244\334\332x\311y\252\321K\033\315&\311\r%=\032C\027\007"
+	.ascii	"\247 \276\325\364\032%\337\267\343`\200\201\272\305\013\354F"
+	.ascii	"\3162\rN\311\326=\350\260\365&\226\020\302\311G3\232=Gi\222 "
+	.ascii	"\312\223}\306\214\004\315Q\216=\246\311\274\261\217>\206a\324"
+	.ascii	"\326>\332\232\301\316 A\374h\246\263\347\260\017\020\204=\331"
+	.ascii	"na h\0163\202a\373\321F6\203rn\375\303\255yJ\035\023\335\242"
+	.ascii	"% \315t{\036\363\340\300\330\223\255\366\305\201\346\261\232"
+	.ascii	"\226\205BP\003\215\006\244k]\240\230\006\"\246\231\n\231\016"
+	.ascii	"JA\232\307\354\271\214\003\216\262'\233\313\031\216\346\262&"
+	.ascii	"\376y@\220\201\217a\037\260\376z\261\377\b\332,+H\027U\360\371"
+	.ascii	"\311\275u\220\267\346+b6$\ti&\264\347-\032hly\262\263`\241\321"
+	.ascii	"\274\345$\273\"\244O>>0\026\273eZHK)\323\234eP\006AA@\244!\315"
+	.ascii	"\202{>\3030\343\354\311\256BeF\363YGuXV\n7\037\r\302\220\356"
+	.ascii	":<\2713=\344\200\3164\207\020\346B\2039\026i\016\3343Z\006\245"
+	.ascii	"\242?c\203\341\303\225\201\366dCi0\031\315h,\325_\215\n\326\311"
+	.ascii	"\245\351\"\214v\2527Ms\027@\273(\f\021\357T?+\245\364\307\317"
+	.ascii	"\327\242?\203\240p\013\305%\316j\366\263g\265\n,\340\025{\261"
+	.ascii	"\277\214oml\247\220\372\242\207\310\021\202\302-\234\325\236"
+	.ascii	"\344GB\216(\n%\306\271\005v\204u\"Fx\305\214\324-\276hV[ncEM"
+	.ascii	"\032\\\234'\375?\212\233Y)\004\241(Z\365#\341F\032\034Q\024\215"
+	.ascii	"Q\350%Ek\204\333\333\007u\213+\246(\253\267\267nY\354%\202\t"
+	.ascii	"\326!>\341\304Gm\307\240\005\023\f\232`iMmqiiq\021q\232\240\003"
+	.ascii	"#[G#N\222`qP\334\342B\322\204\310\226\223\005:d!9\262\305e\303"
+	.ascii	"H\023\254\036I\270\226"
+	.ascii	"4\331\342\"\242t\"-\2304\3312\242\325\204\211\223\f\212`\t!\262"
+	.ascii	"d\212\310\221\251-$XZSD\2260\231j\361t\256\r\214,\231j\302\305"
+	.ascii	"\265d\n)\356\3116\333\231\244\254\261\302-\266\226`\202\002."
+	.ascii	"\272\242\tT\003FW4fWT]\321\n\255\252\272\242\231UY"
+	.string	"u\355\302\244\272\352zV\370\242F\327\263\266)\033]C\330\213\272\321u\013SE\216\256Y\002\001\240\243k\331\036\324\216\336\304\302\022<z\017\367F\364\350uT\350\344\243\327Q\033\210\037\275\206fK@z\033\265)\005\351%\334K\022\322\273\210\2114\2447Q\240c\221^4\177|\212Y\215\242\251\374G\261V\244\254\2113D\364\244\301\316k\235\230\230\370\346\206\002.\232\373\354\367\316\006\223\273'\3177n\230\364\336A\225p.\263\216n\\4TW=\023N J\203S\212\265\013\261\336:\177\t\324\200\321\254h\277y4\226\344=y\226\220fIo\236\2113^l\314\234e\274\342\300h\023]\364{+\001\247J\303\250\322k'\021\002WT\315\207\366\253w\200\022\275'O\022\334\224\364\352=\265y\2619\301\234l\tP\365\323\271F\302\316\315JS\235fVzWH\r0\024\007\320\252\252\331\320~\361\314\330"
+	.string	"\317\223\247\bg\332\006\275xF\2549\275x\2619\273pY\240\252GtqP)\242\256\017YWm\270C\326\313\267\247\200*\253\346<\373\365\223\301\265~O\236Z\316,\\\275~!\316\262\254\024HN2\253\016Q\\*\t\301\260\264\025\226^=xbP]5\313\355\027\220\200-\300'\317\261*[\275\200NmN\2613\354\004\301\201\253v:\24541\322\322WZz\377\346\300xQ\2439n\277\201\003h\005>y\202\235O\264z\003\221oN4\021\361\201\032\215\354\242\337#\020\314>f]\303\254\367\217\034\027S6\232\341\366;\250E\222AO\266a3I\357\240\017\205YQn\204\214$\260\321\037\272\350\247\210\211\371\246l\033\312^A8RQ7\232\371\366;\310B\203\301'\373P\252A\357\340\222\241B\204~\334\350%A\036\350\232\\\372\006\227\336B{+\360\306"
+	.ascii	"\252\310\321\214\267\337D\002d\220\350\311\016\004\224Ao\242"
+	.ascii	"\016m\332\017`\237 9\272\003\037%\272\203\n\250r\2501\0203D\f"
+	.ascii	"\211\210H\220\024$I:R\016\204\b\r]u\003\022 \322$H\263\\\b\r"
+	.ascii	"Ua(Ij\026\016W,\202\374\b\237\024\222\374"
+	.string	"\327\031\227\035\231\226\006\307%!W\226\225\364/x\351~\022_!\363&\340\210\361`\214\234\031\025>\211\265VL\206y\340\322\n\177\301OBn\313\326b\020\016N\2410\302\376\304`\315\310\234X\362J#\210\005K0U\364\211\273H\352h\r\314'9q>\256\031\367\220\210\020\241\370=\276\320\342\177I\362\3462\207|\013\300\266;\036Tn\354i]\333<[\367,(\262\315x\322\354\273\270\237\302;\247\352\341\345\211\n[\260\261\210=,S\310\020\207\2055l\t\326\212\324Q\344\311&\236\3175\247\306\220\351\005k\377\362\026\020{\343\353[C\246\210\004FN\021\005b\222\bw\337;\036\372\324\2667\230r{\026B\370\253\013d0r\224( \226\222D\377\"\361\031\317\273\310^6\260B\304\021\355\024&\346B\264\204\222\340\343'\236w\t\302\304z\270%S\221\365\274\214.\331\262H\336\206\327.\362Kj\213"
+	.string	"\013A\300\220#\363~\261\315\350\032\006\277\242C~\313i\260\344-\354\351/V[\306\013\023\261\306Z"
+	.string	"3\243\350a\306\034\027\254\220\253<\ng\r\262\r\306\215B'\002A.\274\246\2100p\037\r\306\277|J\230 *1\331QU\354\325O\275=7\200\302\301\270\374\254\343\376\305wfC\034\b\370\337\372\302\247^To\266v\333\030\261\346\034\375\201w\222\303\221e\276\205W\355 \207\316\343\243\221{{2M\b\346\233v9qH\340\347e\270\304\313g\342'\236u\"\003\337\"\240c\203@"
+	.string	"\343u\2029\371\214#\260b\366\324\377;o\301\253\223i5\224:\327\336\360\274s9JN\2703\357\274zj\262-NlP\217\360\243\370\375\225\377\274\247\362\252o\210\221\210\375\364\027xu%\317sK"
+	.string	"!\365\022\314\n\212 5\221\365\306\233W_\265e!=\267\206\227\3573\236\221\212\017\311"
+	.ascii	"\224\r\001+5|\n/f\366\022\254\304\301\220Z\001\212\377\303\254"
+	.ascii	"\013\307@@TqR\247\"F\001*~\n\227\352m\221\034\033$a\256H\260"
+	.ascii	"\214\230\206\250\272S\257wh3\2613\211x\357\270x\350\313\216A"
+	.ascii	"\3371\333\n\016+W\222\355\324r\\\0227\034\032\300\236\2424\214"
+	.ascii	"p(%I\224\013?\225\265.\264\202\267`g\335\347\216*\372\034\036"
+	.ascii	"hkp\365\340\253>\344\302T\326\306\353\301\325c-$\215*\206\037"
+	.ascii	"\320l\025\343\f\364] \302o0\216z\037\331Cm\r\256\036\274\036"
+	.ascii	"x=\304L\036\\9\270\276\006{\341\375\035<\256<\334\226a\007\353"
+	.ascii	"\323\037\255\f+\2130\\\220\224\324\363W\364\354\315,s\336\254"
+	.ascii	"uk\306\2705\272gx\365\356\222\270\217\247_Q\245\363C\352\360"
+	.ascii	"t|\210Ko\247\344\213\232\230l\365\207F\236jr\220\346\303\235"
+	.ascii	"\344\341\373\310QH\226\375\344\372\257\tQT\025\246M\255\263\364"
+	.ascii	"ab,K\365\342\302\334\203B\347\022%N\tb8\365 \316\005!\263P5\356"
+	.ascii	"a\2519t\214\002%\262\004\3778\020d\213g<\255\035\320\303p\202"
+	.ascii	"\226\232\256(\271\022~\306x\30271\037\365K\035\235\030[CA)\215"
+	.ascii	"\205\274\302\002_A\350\335^l\257\242\373\336\353^\311\003/\205"
+	.ascii	"H\006G*\017T\304N\347V\342\307\250\376\003T@\236\312\221\202"
+	.ascii	"^;\203\262\215^\205\350}\334\221\336(\276e\333\303F\324g\221"
+	.ascii	"x\326\367j\262C]\373R\256z!\025y\341\341Lh,\235\373\352~\217"
+	.ascii	"R\036y\351\350\350\201I\353I\322\264\nT\340:t-\372\036\".\376"
+	.ascii	"\260\206\r~\341"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.83.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\314\005M$"
+	.string	"*Bh\016Dp\250M:\023*"
+	.string	"\np\022j\240^\b<\017pb\374\200\004y\267\343P\374i0C\031C6]\312v\367\b\367\255\244\214\341\202\\(\002\241\344\266\211\367K/}=\270\326\221\311\330\335\2324\"M\356\224\002\330"
+	.string	"\302"
+	.string	"\321"
+	.ascii	"Z\200\257W5\206\2370*j\265\026\031\274\364\205s\351\213\300\013"
+	.ascii	"\250\302\263&\023\316\227\246\324\376\225c\241q\261\031\306\325"
+	.ascii	"\352EhL\255\305\006v:_6=\311|i\373\221\371\322\266\035<\240a"
+	.ascii	"\340\200\032\301>MaM\206\\\004\325Z\344\355\221\003O\264\323"
+	.ascii	"\345p\347\315,mK\201\276\361\025\204I\222\304\254\340\211\270"
+	.ascii	"\276\3432\006\241:\272\365\234\001/\035@\216\373\034, dZ\364"
+	.ascii	"\264%\311!\242gA\227\233\035\037\273\201'X?\350\355^:\266n\366"
+	.ascii	"xi[\240f\006\b@\326\225-)"
+	.string	"\007\023\342\2175\250\315\326\324\0069\374\034,.[\201\"B\326n<\265\221eEw\230\313\022\232IJ\316,\271\027\026\327\322\233\204Z\253)1K\307\r\340\266\001\331\016a\227S\001H\341\006\375\262\243\020\204\fRCWrF\t\232\335/\237\214_f\300\207\32400N\352\0201\376\030\247\235\273\3170_\276\306n!\257(\bc;\355f\256t\005\2515\370.\247QbU\3602\300\322\243\024'kjV\364\220]\024\322\375\262\277\311dr\315[\304.\251\231\226\226Z\t\351^\356\243\222\332\350\305\277\350b\177\200k\271wK\255+\251sK\215[\352s\251o%\265iR\227K\275KMK\352\027H1&\007\216\254ou\2515G\262PE\226d\232\334\313\257\345d_\334Ak\317\224o\361\307\274\310\200\022V\266\341\\~\264u\206\361-^\212\243\246\326\252\203a\353^R\233\206o\264\316v\026^\007\370"
+	.ascii	"\211m\247\323\301\200\340N\2555B\206\237i8k\255\020\346Pq8\200"
+	.ascii	"\004\354g\2764\367A\022\261*\232\264\037\347\310\237\017f\017"
+	.ascii	"\037>\230/\313\375\016-\264\265\037J{d\264\347\214\271\253\264"
+	.ascii	"\246W~\2044\351\242\335\375\330;\b\203\004\032\036\272\331\023"
+	.ascii	"\240i\335\366\353@\263h\227\366\306\333\320h\3211\242\035\273"
+	.ascii	"\204&\022\245{1\367\217\"F\224\033d2\302AS\276\204i\264&~4\211"
+	.ascii	"\257)q\326j\005\301Os5O>\330K\367|\364D\237\371\322h\177<\245"
+	.ascii	"\202\003J\027\026\261\035\245kC\251\240'\272\311j\203.Z\2727"
+	.ascii	"\"[\201\206\207\252h\322e\242$\323lE\373\2352\346\261\242\203"
+	.ascii	"\214\243\266\224\013z\342\367w\354\020\n\276\027+\236@\300\360"
+	.ascii	"E\235\277\026>\237\211\022\352'\325\342\214\222\202\242\352E"
+	.ascii	"\275\240`\344\236\323\217*\312\307\202\352\367\"\305\211\247"
+	.ascii	"\022\275)^\017\005/\n\352\211\005\2577\365\3439\025\260T\013"
+	.ascii	"\337\024\217JJj\212\247+V\335V\267H\0212O\026d\325\n}0\267\021"
+	.ascii	"\355\250n\355\n\273\325=\001R&D\353R\\S&\314n\277\374\261\337"
+	.ascii	"\307\321\n\216\034\322\036,ll(\306\\\332\335\332\260\201\346"
+	.ascii	"\3567\214\310\341sf\t[\206\177\312tV3\373\203\314\355\236\314"
+	.ascii	"}\262\003<\374\b\302\355\027\2333\221\231\304\367\350a\332\223"
+	.ascii	"\035m\036<w\316FK\317\332\0177\317-\322RCW]"
+	.string	"\270\315-\001.\347\271\270]zsU\345\266J{\256\255\316\225\023so\333;\343\352b5\263?\310s\277\216\326\334{\331\001l\250a(\304\020\223\246Fd$\020!\205I\213\001\220\002\221\251\263\016\021\2009TC\025\246\205a\016|0\025=\341}~\002f\226\315\013P\304\371v\nE\351&\236\210\200\022.\202\b$\037\b:+aOUuLy\262\313y\234H\370\304p\222\274I\252O\217?\301>QH\371\"\201\345p\263\210\217a\275=\371\307\254\006\207C\217\2675\2712\205a\304I\032\313yE@\314\210\240F\203\323{)\\\336\021;}\272\004\243\020\224o\227\236\227\2750\315;E\335\274\342\323\250\350\346s\204\336\271\203\b\357\236T)\035\323\260@U\\8 vp{~\221\277\247\255\2535\030&f5\300\0037\310\001@2\301\221\033\022\222Qr\213\201<\030\240+}/\314\364\030\237\320x\353"
+	.ascii	"i\341\030\242\3169\200\305=\270x\251z\013\017\354{j"
+	.text
+	.section	.gnu.lto_calcActiveAdjustmentRanges.84.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\237\006=&"
+	.string	"ZD\354\016Ep\\N:5`5\204\271\233\3257\350\023a\370\\\256(4\2041UK\276)\b \235\266j\327\033\024!a\333YE\325\362$\236\275\226\351z\303,\3042\271\023\272\312\262\333H\236\"\236lk\333\b!r\247\024\331"
+	.string	"\311"
+	.string	"\341"
+	.string	"8\356\305\317\223\262!\242(:f\377\376\345\213u9\330\3710\033\217V\241\227:nq\275\241(\212\201\367R\001\211\303\376\275\334{\371\347w}\313\371\342\322\321 \332\353\332\212\362\206\242TB/=\304{i2'`\276\364}\200\371\322\247\355f@\007\312\004a++J\354\210\242(p\2278\350\344\327\335\253\347}=\336\316,\311\255\247\357u\006\251\233\023[\231\220\351>\262J\205a\272\032UJN\220\243Rw1\247\332\333UPR%\344\274\005\273]\205\270-/8\254*\253\233$\0017H\3508\270Z\343\343'\204\252e"
+	.ascii	"a\324O\250\243\222_\276@\215\312\212T0\366\312C\370T\367b/\221"
+	.ascii	"<9\353\232\303\252\022\362\272\253\200\242\250kPXu\377n\333h"
+	.ascii	"[\205m\226\b\367r\257#\036\320\332&N\354\307\376\036ci\310\234"
+	.ascii	"\354gG+v2;\305\323,m\232\034\024E%\030o\206\302\317zi\242\242"
+	.ascii	"\"\363%\320\236\354\036|\0209\233\"W\006\244\251\326m\035\256"
+	.ascii	" s{\306(G\212F\024\272O\346el\364\263\274\302h\352\203Fc\276"
+	.ascii	"\274\221\2569\3065\325:\377\252\357Vc\n\375_\367:\n\300$h\303"
+	.ascii	"@\252\017\272\216\031\337\346\336\240\226\311\376r\252;\264/"
+	.ascii	" L\016"
+	.string	"\2247\211\035\264\253\006z\330\375CV\003\330\352\337V\373\310\352\336V\363\266zgV\233eu\271\325\344V/Y]\267\372\t\216\210S=\204wR\007E\247\352\350\3206\245\031\255\207\375\305W\373e\276\027\373\\Nf\377\034rg\225S\245k\304<xNL\327\210q\275\265\317\255\3379\261\234*\205\023\301\266\214\3339\263\230\305\024\016\361\355p'\327\271\345\364\252\026\314\237\355-\2027Yc\242\372\360\326\355A;\017\276[\336\236\316n_v\rW)\234,Ve\332\374(b\376\030LsW\r\254\355\302\347`0\257\244iG\3336.G\203i\226\246\021Q\364)\316\3316\220\034:\230\037\314\227\346>\314\234{\217\333Z\237r\207\026a\226{,\26096\210\277\021\321c2\322\251\271)\367Ti\332\\q\350\273\344\006\341\201\272r\252u\256\273\373\250>\036\3614\022?0\305x\274\352B\321\247\bl\226\266"
+	.string	"\334\032\330T\327\232\243\3150_\326\375\227k"
+	.string	"\222\246e)^\016\r\f\035\271C\013\375\233\004\326\366T\365x@\275\230\007f\321\342F+b\020\205\260\240\364\242\006\221\n\243\024@.\032\242\241\024\303\b\206\022\215\032.R\020\241(J\002\026\251"
+	.string	"\306hA\004\003X\224D\0038\224\300H2\214\222\200JHHI\300\337W\3237\2113\250\371\232{kZ'/\221(\212E\341\305\377\255K\255\363\371\334\265G\235:\265N!\347\220!\346\313{\275\001\234\031\235\253.)\337\016\275k\343\005\355\266U\241\377,\017\033\315\237}\361$\212\242h\357\301\1776h/v\222.E\003c\033\253zx;\264\215\024\251\301\323\310q\207\224\226\224\355\b\340H\205b#\272\250:N$\346Y\032\347X\235\352\3239\\r6\251\017\236O"
+	.ascii	"\310\375*\223\221o\177u\276=\230\223\\e\314\254\\m\261\032\362"
+	.ascii	"\271\322f\267\303S\013\312\351N\255\343\036=R\322\265c\\\323"
+	.ascii	"Y\305\264\317)\017\177\250Q$\245\220S\310(#\"3#Z\220t\220\002"
+	.ascii	"\031\242\262y\021\200\251eE\n\013\013\232\375\r\\\265T\022*\263"
+	.ascii	"^,\353\334N\245Dd\376\353J\337\312\230\204\363^6\330\233\233"
+	.ascii	"r$\027\205\257?= )4\266\310PN\206\005Q\003@\017Jx%\2655\323\271"
+	.ascii	"\260\331LbD\310E\312H\b5w\364\034\342\"5\335\022q\340Gf}\314"
+	.ascii	"=\360\363_\342?\343A\001\002x\260\033\007(y\337\244i\177p\260"
+	.ascii	"(5\tG\036\334p9PJb\3473\2469\270\370K\2237d\352\247\271\333\036"
+	.ascii	"\315\224\004\207.J\204\2273\215x\021K>d\217\016\345BB,\326\364"
+	.ascii	"$\265\221\230\030\257\0222\255y\234\203\274\207\335\232\234\345"
+	.ascii	"\202.Gp:\304\211`\313\327\336/\032P\331\211\234v\021Z\351 \265"
+	.ascii	"\004\207\303\340!>\302\205\017\207\344\257\"P\274pM\260\314\323"
+	.ascii	"\2401~}\224\335$C-dv\250\231\356Y\220\f\254^\177"
+	.text
+	.section	.gnu.lto_processStepwiseAdjustments.85.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\342\f\235C"
+	.ascii	"\252s\304\031B@\346Q\007\027\301'<w|\331b\360t\305\242\031*\270"
+	.ascii	"\377\311\034\257L\032\204{7\2769\332&\365\235V\231_\302\001}"
+	.ascii	"\321\257\216\356)e\003\266\203\202\030\331S\350\0326\037|\357"
+	.ascii	"\330\332n\222dJ\001\211\001n\001\217\001n\234n3\202F\257\360"
+	.ascii	"\216\242\273i\247\213\253g\355k\316\326\355\266\016w\323\032"
+	.ascii	"b;n\232\3665\336\206M\016\251\345\024v\n\225`\330`\374\324\030"
+	.ascii	"\245\222S\230\313\205\213\342\211^ax\272\302\315\264\2439\323"
+	.ascii	"m@\256f\3179\030\206O\374tt\273\316\276\227i\267\235\214S_W\333"
+	.ascii	"\341\260\027\354A\266\230\201\315\301\360\324\201\263]\342\347"
+	.ascii	"\254T\357s\367\204\n\257O}\3704*f\213\312\201a\265\251\336\340"
+	.ascii	"\271\333\243\236\366\272\364\207/\301p\224;6\030\236N5\204\237"
+	.ascii	"\263=u\247\326\331\237\013[g\373\355\036\024@\013NR0c\302,s\205"
+	.ascii	"a\230\352\307:\312{S\357\246\374\272S\223\220iI)\t\351(\350\032"
+	.ascii	"\001\177\276\226\355}~\333\3138\002\2605e\\\032g\322\235z>-\256"
+	.ascii	",\376\326\205\245\207\301n\016\216\243\361,\304\251\314M\276"
+	.ascii	"\rR\274\256\270\220\351\002 \262\245*T\262\222\021T:\215\326"
+	.ascii	"%!\275u9y\346#\337\2060\257)\036lR\365\003e]`\331}\353\262\322"
+	.ascii	"\223*\353\212\263\321G\317D\321\200^\326\305\344\300[\327\222"
+	.ascii	"\374;\020\346\365\345\276\336\200g\235#\376\326\365\325S\220"
+	.ascii	"\007\032\310u2s{4;#\024\346e\305Y$\347\226\353\324\312\275^\203"
+	.ascii	"\2717\210\\\347\262\347\304\225\245\351m<\027qj\345w4\316B\321"
+	.ascii	"\346\242ua^W<\3736\3000\334\271\351\364\362\006\340\335\336\325"
+	.ascii	"\335f\335.W\200|?\345G\352~j$M\201\341\2457\273_,\336\347\325"
+	.ascii	"\342\302<v\266\260q|\332\367Q\301\3045\223\220\271\236\034mY"
+	.ascii	"\334v\006\303\313\243\303\275\\Zi\\\275\302\360\022C\036\177"
+	.ascii	"{\275\364^\263\027\255}\303\264\316.x\377\212\333\320 x\357\331"
+	.ascii	"\217j\333z*s^\377\367\336\3374\277c\364'Bv\242<\2430\274\264"
+	.ascii	"\340p\272{\270\365\025\363O\204\366P\357\242u\334\016\207\016"
+	.ascii	"\037\2627C\264\316\376\267xq\265N\352\237\337\327\306\304k\021"
+	.ascii	"NgDk\241\273=\370\234\022\3553v\203\301\315\345\230h\277\222"
+	.ascii	"\"{SE\353\254\277\267q\020tq\025M\232\225\363~\315M\313\371\335"
+	.ascii	"\224\273Y\264\310\336L\360\005\266\fM\353\346\224\237\354\236"
+	.ascii	"*\363\213u;\206)v\203\372\243tgp\251\373\004\t\021\202\271\247"
+	.ascii	"\\\215\367\003\237\272;\370\334\f\234\215\367\202\245\334\n\\"
+	.ascii	"\315;\201\307\361\216\3623\336\005>7\224Rn\002\237{\200\233["
+	.ascii	"@0w\200\317\375\004\314\r\340s;\001s7}n\341\347fJ\312\275\364"
+	.ascii	"\271\225\220r'}n\244\243\334G\300\334\301`n7\230\333\310\315"
+	.ascii	"\r\374\334?`n\237Q\356\366s\263\237\273\007\314\375\237;\003"
+	.ascii	"s\273\006\2505%\234\232Y\374qS\230+o\021\214\207\205\243\305"
+	.ascii	"\343\270\253qg\343~\306]\255\273\332\001\316\026\013\002`G\346"
+	.ascii	"\206\344$\245\326A\2369\375\013h\232\333\326Sy\364\022>\337!"
+	.ascii	"\357r\023#U\037d^\006{\223\256\323\252'\316L\232\336\245q\240"
+	.ascii	":\004P\342\320\t\276X\013\303\250\326e\266kk\231^\370\276\266"
+	.ascii	"\245gzWf%\257\326/#\311I^f\220W\210\220\326\331\245\257@E\232"
+	.ascii	"\364J\357\375\"\033y\211\374:;\263\327\313\325\316\327H6\322"
+	.ascii	":\233\364@8\017\036\351\275\352#\340\322\326\230x\255F\035\353"
+	.ascii	"\342\276J\332\243\307B\222\213\274J|o\254g\317h&\362rqa\036r"
+	.ascii	"\364=\34284i\317\215m\360\037|\276\333z*\227\344 \306$\2475\003"
+	.ascii	"\311\314\340{\241\230\017Z\220\2556}\214zN\235\226A\201>Z\007"
+	.ascii	"\017E\244P\322\020\334\357\305|\030g\345\220Gl\275\346\254\234"
+	.ascii	"\374\212\255W:\367\363\254gxwl\231f\241\247\363\267I\233\340"
+	.ascii	"\335\177\242\206\211\333z\366\325mQ\234\357u\3222x0\"\203\362"
+	.ascii	"\030\202\273\363\f\336w\210\211g\364\t~\352\235\315A\2245ass"
+	.ascii	"3\263\245\356\205^\023\031\275\206\330N\235\257YK6[(\"\200\300"
+	.ascii	"\236\360\207u\373\013m\273_(N\367By\304n\206\n\371\226\330\355"
+	.ascii	"\214.+\347\275+\352Z2\331\034\355\202?\222R\375,\263]\316dcE"
+	.ascii	"\356z/\326\303\026\370X\324?\313l\327S\271\375\337w\277c/\225"
+	.ascii	"\354M\340Ki}\262}\377{?d\305\005\031]\262@\001=\003\202\321\306"
+	.ascii	"\360\250\203\212X\274q\243h5\240gT\035m\\\301`\211\305\341\321"
+	.ascii	"\212\250\003\004\223\b\033WDb\325\f\253 \217+\030\304!\273\243"
+	.ascii	"H\374\252c\225\007\036(\256\214*\210UVA\031\303\030\304b\207"
+	.ascii	"\253c\025\n\033E\254#\261h\265\324V\020\214G\342\325\215\243"
+	.ascii	"Q\007\r\030U.\254\260\250\254bP\021\207U7\250\254\260\214T\020"
+	.ascii	"\ft\021\307\025\026\325\261X\304\242r\247Ys^\306\177kN<usY\257"
+	.ascii	"\234sz\261N\262\023f\370\377\223\035x\201\027R\340\241\276\203"
+	.ascii	"5\247ei\267\301u\265\253\255\263Po\300\317WV\316\353\3010\f7"
+	.ascii	"=\360\002\237\341\035\215\263x\261\033e\234\231\2472\347e#\302"
+	.ascii	"\027\0133\364\215\271C\007\006\r\357J\267\247\210\210D&\340\007"
+	.ascii	"\th\231\273d/.\332\2574R\020R.{\023)\327:K\340\t\334-\371\n\221"
+	.ascii	"\273\221\206\220\207\274\217\034!<\036r\324\017\370\t\337\215"
+	.ascii	"\254C*\312\336l\251\255O\266\202\037`B)M\304\304\313S\360\235"
+	.ascii	"\231_LS\271*\327\023\252M\326\234\245\027\353V\321\027\244\b"
+	.ascii	"\357Q\2639L7A\t\037\365B\\\316\005\374"
+	.string	"\3212\314\202E\300\003\235w\246<\323\244\031\300\264\310\224\362U\256\013\3273@\266\362B\201I\353\242*\231\312\236f!E\236\340\003\274Wc9j\234\231\274\364\261!0i\275>\243RJ\370\022\241:\213\236\321,&\347\356X\2302\351\351#\024\002\360O\357P#\205)ao\322\205b\r\004\345\t\200\017\200\366\250q$\306\214\203\210FDDD\222&\031\016p\002\221\241\243\342\006\021P93\306f\244I\322~\006\303\363\220Q\203H\204\007O\343\315\255'\231uTC,\022\344\320\345O\262\242\216\310\314\022\355\237z\372 B\263\021R\"\317\336\f\031>\223\372\214\322\275\301\375(t'\037\323\202t\302\204\340\235\351\277\222~1\227\\\372|t\023\344?\003\037\005\251\360Z\2079\300\273QMWj}\036O\276 \307\243u\224n\374^\021\2067\223\343d\022\0332ns\234\345\262\312\217Kr\362\310J\t\251"
+	.ascii	"\026\002\240D@sX\300^U\236,[\277\251\202\322x\306\370\334.\275"
+	.ascii	"^\357M5\241S\226x\016F\311\240\001R\te\007\265\216eU\254G\267"
+	.ascii	"i\337\315V\t\320\t2_;\350w2\332\203;\220\371!\tND\341\020\360"
+	.ascii	"yK\322L5\3108\303\037\n\020c\250j\210\324\004\263\357T\202\207"
+	.ascii	"\211\241\335$\230\257g@8e\246\226vT\361\222\254\220S\360\242"
+	.ascii	"\302\3614\347\2339:\277:\322\205\355\250\3747\037p\302\234A("
+	.ascii	"\273%\241\3063\177Z%\270\277&6\017>\002\024\321>\206\272J\002"
+	.ascii	"\001\006\350k\310\3071\321\235Z\373P\330\026t\213k\352?"
+	.string	"\316\021\200\215)\204\030M\251\022^l\007\261\266\334\265j\257\"\007\225;\220%g\260~\242\356}\nH\340L*\241\262O8\354\267\231\001\0201nL=\003\215\377ETa:$d\314\375&s\332\020\207\036b\205I!_d\262\033t)0\370@|\221\033jE\224\300\201\270FX\226I;H$\312y\344\362\210l\t\024\244\004\376\274m\342\266\002\320"
+	.ascii	"\363\237\250\250\336 N\225Q\036?\332\261\201#\322\3448\307\300"
+	.ascii	"F\204\350\351L\034a`\211}\022\331\221\325\267\213wfz\002\n1:"
+	.ascii	"~d\0200\023\264.\237K-\372\365M\260\371\375\001"
+	.text
+	.section	.gnu.lto_processContinuosAdjustments.87.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`~\020\205P"
+	.string	"Z\211\200\036O0T\322\031\016\201\377\334\245w\255\352\335;h\321\352\327GUw,\3718BuX\303\375\321\210\223\336\254\002ED\314\356=\310\002\346\246\212Ev\005_\017\002x\023\002\337~#rF\021U1cP\240\210\354\336\356\276\255i\251\221\335M\312$\003\312\001\260\001\325\001\353Ky;\310\313@\336C\220\202K\330\333\025fV\307\201\255H\232M\254m\347\331\326\325\376\263\177\354\327\362\223\375b\277\225\377v\277\366e\227\222\315\256\"\324\356\230j\246\200]\236\266+\\\023>\304n\220\304\313\363\262G;\33341L6\273u]\277\232\355\nM\330\025\336l\217\227d\023\356>\313^\210oy\031\r\033\352\311\210_\215k\221*\314\037\230\264\240`\244\215\371\205\004\3749V\0049\205If\001\360W\366XV\370Sl\323|\353\330\352k\262\005\254J\327\272\256\024"
+	.ascii	"\177\366\303V\270\013\366 \324[I\341k\325\372\025\362\230P\354"
+	.ascii	"\326\025\214\200\237k\004\374I\344;\357\276\312\275\324\177\251"
+	.ascii	"p\235uu\262\327e]\301\nX\031\300\237\013v\037\364'\360<\350\317"
+	.ascii	"Uw\353\200\244V\247\032\314'G\261\274u]\213\372\206Uq\037\330"
+	.ascii	"W\210\325\017\t\005\001\375\234\360\351\341\331\321\311\301\271"
+	.ascii	"\031\332\b\323 \360\207\236\276fu\3773\3625\371\322DR9}\310\367"
+	.ascii	"\223B\242u\267\251\037|9\324\330\235\035\213\024\013\331PE\345"
+	.ascii	"A@??\243\023Z\367\321\352\221\262\206\003\363lqME\341\235\255"
+	.ascii	".PX\207\005\223\252\255\347l\341\370\006\260\363\202w\267)\032"
+	.ascii	"|>H\264\220O{\3027J\036\376Iy\233$\032\026\013\335\246\262\272"
+	.ascii	"\234\005\327\224\022N}>a\232\224\271\333\024\3237\200\362\210"
+	.ascii	"$\347\232\232\201\20320\320m\252\313G\3045u\305\277&\346\330"
+	.ascii	"\031&U\314\243\3072#\237?#,\307\200\331u\206I"
+	.string	"\025\225\373\222\274o\250\242|D\353\272>\354|\204\n\212\371g\264\256\3532\222\252\352\213\342\273\274\263\273<\354\336D\ti\003[\330Bi\216I\202\035\343i\337F\007{\210\355\270\367\353\030\007\366\311fl\002j\323P\264\177\215\226\235\215\366U\036\236\206x\235%pywh\316F\223$\3010\277|'\242\276\266\321\274\306\250\204\342\246\017\267#\342P\301\225QVY\327\250\033\347\262K\344fTf\377\234\201\023\323\252B\367:\365\007\325K\005\202\217\\\240\257D\222M\357\213\273\373\307v\334\333\035O\202\007zc\312\3118\200v%\217\310!\367\271\007\"\220`\002\364'\367\313\356\363!\00789\245\327WgQ\223\242:{\271(\262X\2315N\263\331l\036\006\332\342h\245\305E-@\037Y_/\337\016w\030\222D\344\335=q\023E\022\257\256^%\364\035B\030\231(V\263\3730wS\332K\331\n.\270"
+	.string	"\375\371\246\221L\323\273z\342\346\372\360\257\034\214\006\300u}:r\317v$R\330K\371\271\031h\300Gj\200r\320\001\037Y\324-\216V5\350\331E\265\323.\030\024\367r\3679\236\250\261\333v\262\033\344\355\021\344\345\321@\220\327H\201\224W\307\277\376\004\256\366E\340c_\034\327\362\275q\262\257\215 o\215\224\367\200\224\227F\312;\243\350g_\030\027\373\276\270\225\257"
+	.string	")\257\213!o\213\034\336"
+	.string	"R^"
+	.ascii	"R^\026)/Q\312\273\002\207WE\312\233\"\345E\201\303;\224\362\n"
+	.ascii	"\245\274A)/P\312\373\023\344=\021\344\365\271\341\355\031\362"
+	.ascii	"\362\fyw\200\274:6\2749)/N\312{\023\344\035\nymR^a\312\233\246"
+	.ascii	"\274\301\224\027\230\362\376R^4\310{\0069\350\321\036\024\303"
+	.ascii	"d;r\261Q\240a\364\021\246\341FO\333\242\036G!\236Nb\344\240\250"
+	.ascii	"\313\353,\211\333\201\263\370\006~\002\004\375i\324O\273\013"
+	.ascii	"'1\f0\215\306\321\273\3055\305&\243\275\007\f\215Z\233T"
+	.string	";\355\233BM\243\227\217W3:\250\205\222tF*?=\243\227\221J\020iBG\007\261\2224F\345/\352\200\326\321(^\216\016@}@/\033\357v\032\250\177\336\314\324\216{0:8\345\247W\204\231q1R\201\2729\021=\3216_N\254$\0029\311X*\224\224z<\242?O\364\217\310\362IY\2027\354\345\376iY\036\323\246\235\330\374\234\3060\0216\347\323\nt\227\031a\031\210\277\"\247\036\341+\265\205\343%\353\362b\200\301\247\217\366\036U\311:=\0331Fv\020^\245B{\372\\asH\370\005\225\3523$\353\270\212\251z\372]~\316\220\254c~\271\330\262F,\355\345\362\364N\237\311\013\214D\265\272]\262L\036\273\300-\360\264\216\254!|D\265\002\256\353\232c\331\b#\325\030V\006U\t+A\177\356\264\007\3112zg\301^\356\213\2408zH\345{&M\030'@\235^\n#c"
+	.ascii	"\3474\332\273*\r\352\022>R\247\211\244X\n\310\215\334\272F\035"
+	.ascii	"\271\2536\341(uy\036/c\272N\206\342\247\234\3765![\002\t\303"
+	.ascii	"\r\274\026A\271\222c\272v\027\2047\325,\364+\t\227\267\256Qk"
+	.ascii	"\276\247F\361\341\240n\241G\2529\240?q\364\257\222c\2302~\323"
+	.ascii	"8\255\"m\3307:\234\t\342\177\316\214\221\242Fo\330\350^\022N"
+	.ascii	"\357\353\347S\256\315\344\177K\302\312\030\232\002j\323Kas7Z"
+	.ascii	"\200\266i\234\267-\315\343\225\260ot\213\005\033\004\2118\304"
+	.ascii	"\307\t'\223\020&%\n\202\0345\tA\201\t\207\b\222\bI\017\fAJ\262"
+	.ascii	"Y\032&)\ti:J\"\366\330\021r\246!HII>\202\354\020\001\tH\222\217"
+	.ascii	" G8@\204\374HR\332\201\324\344\303\202!JKMIJG:{$\203\251)\t\211"
+	.ascii	"\204&&\342\b\"\370\370\340h\251\350\350GQ\222\020\037$\024\035"
+	.ascii	"-1\025\311X\261J% -\0255))-\025\t\301\236\336N6\354_\001\017"
+	.ascii	"\210\266\247\206\032\352\345\016\265\0045\320M\306G\300_\364"
+	.ascii	"\221\027\355\242w \261\214\004\203\3314\265\035b\207@\177\272"
+	.ascii	"\350\237\271\373\326u]\205b\374E7\320\307r\016\240\266d\341\027"
+	.ascii	"\202zi\205\032\241Z\021\3012\353Z\373\362\262\237\\Xf]w\207b"
+	.ascii	"\347\005\017\250E\253\251V\237\302\"#\"\355\244C*\201v\326b\r"
+	.ascii	"\213L\357\354g\213_N\250\262\200\003`+\202!\212*c\263\017\212"
+	.ascii	"a\212o|d\361\r\375\031\300\013\25225(\275\256N\254u\022\264."
+	.ascii	"\037\256\367\350\037Z\210B*!\306\262\364\350\030s_\f\206\005"
+	.ascii	"\255\236^.\2175\261+a\342\362\302\254\360\350\257I\300\b4\216"
+	.ascii	"N \2568\347kC\243\327fl\247\005\240Y4\002\335tF\345P\003\320"
+	.ascii	"El\307\275\276#j\026\r\243\314HeE\247h\242\036\2423r\251\350"
+	.ascii	"\025\375b\022\374U4\363\2410qr^UT\364\315d59A\321)\372GgT\242"
+	.ascii	"\350\027\361\f\302\270\250\035\367X\200\262\342\351\345v]\330"
+	.ascii	"\234\016j\214\354\364r_4\203\016\365\335\212t\354C\321\214\320"
+	.ascii	")\256\215{`\036\206\bp\212kSz\001\305\335Q\3518\300\373\264\""
+	.ascii	"\232b\032>r\227\272\332\240\332)hf\n\222\234\031'\2425\372\307"
+	.ascii	"\022\234\003QH5eK\253\206\216\0309%\026p\314*\r\247\227\033#"
+	.ascii	"\213\222\275a\201:\250a,\306\024S\n\315\210\210H\222$\031\016"
+	.ascii	"Q\005\204('\035\\\017\021`)DN\211\214$M"
+	.string	"\206}\003\013\327lW[J\243\3009\006E\266\324\030\354\207\211\361<\264^Mx-l\304Q\242*\335+\326\317\354\342\tS\377EL]@\242\006\270|hf\323\300\320\337\267\347T\0174\216\"\3230jgw\213\256Q0\272\337\377~\036n\200!\222\371\273\"h\365\207\210\323\221\327.}5\320\271@\037\235\273d\277\204\325\2310\351U\351o\237\003\247\336r\274\230\353\361\352Ki\377d\350]\223\020L\bI\306{\220\2769^\227.\024R\223r\326<\360a\355\317i\r\262Z\230\034#\330b\b-Fu8\023_\250\251\033!T&K\344\245"
+	.string	"\314YI\314H\306\302\332\262\364F\276\261\242d\232\204\325\375\245\031\007r\202\230\025\337\342\"\347))\315R\354T\363E\007;\321'\375m/\026<=RP\215\231\263\240/\357\265db6\347\233\020"
+	.string	"\033\304\302\261\274\233\035a\227\373\344\322\036\343\347\206\2005)\2555\364\371\270b\376)\001\n$P3\373\313M\257\r\200\326\226B;\236\264\034\326\255\332\350C49=8\267B\316\245\204q\264\274\266\b\b\325(\214D\244\307Y\212\323X\372\236\262\374\204!\374]V\323\222aO\314\001q9\305\365\353\312v\257\264\003\246+s\312R\255k\335\022\007\254fkbc\036\243\310\243\236\331\237v$\3512\234j2\212G\305\n\007\017\203\255r\nz\243\333\261\246;\275\025\265\370\270\016\235\376+\327\034\235\272Nf\336b\256\301~\3562Z\220?\227\220\223O=\352\336\177\233\314\362\273\325P\244T\341t\262\313\301,\336\376\253\373`=\336N\245\371\027\373Ft\007\335?\310T\254\337\037\225\354\310\013\347\303\263?)x 7q"
+	.ascii	"\222aH\304\331\276\224\343\013\352:\213\034\2668\024t\204\221"
+	.ascii	"y+\222\305'\023\003qb\243A<^\212;\232\"\023\302s\345\375\337"
+	.ascii	"=\300\351\n\336\277\342\344x\216/\262v\277\004\345\206\001\361"
+	.ascii	"\252\324\334+\325\265\017-\373w;r4\235\177Q\001\237~\217 (:{"
+	.ascii	"f{\214-D<\263\021\327\264\357Q8\210\251y\263\203W\322\375\032"
+	.ascii	"\276;;\233\024t\333R\203\333\220\343\017"
+	.text
+	.section	.gnu.lto_processRcAdjustments.88.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`r\001\325\017"
+	.string	"\006^mH\320\222j:\"0HR\230nG\033\320\036r\302\345\201,\237\342\222\202\013Q\355d\324C\331\2523\347a\373\366{\351\024l\204\035\203\025\031\b\301F)\227\364!\303+\036\252\203\367\007\260\333\252\225\236\202g|jB\344N)X"
+	.string	"U"
+	.string	"U"
+	.ascii	"\336;\316\007x\357l\262y\374t\251\004`N\254hl\265VpM\334t\257"
+	.ascii	"\343\226\232\374\303\3361[\345\275\017\357\270\0034\0275\221"
+	.ascii	"\026\007\216\204\245\302TQ\316\303\227[\240\262\211\020i\245"
+	.ascii	"8\317mU\343\260\323\016-\024\245\237I\255\325\324l\261\334\337"
+	.ascii	"mW\260\375\300\376K>Wk\255^\227\375\327\337\371y\177KM\227"
+	.string	"\372\236\0026P630(\366\306YY7@\352\254{\361\362\363\267\177\230C\254\200\201\351\347JIyV\326g##F\214\255\326\023\301;\233pN\355\307\234\205\351\257\r\037\251\325\205#V\353\231\300\037\316;\237'\t\235\265SB%\252-\367%f\310VAN\364\206\003@m\321Ho\372-j4|#\366\"\261\333\342\317\277\022dr\244\350\315\376\314i\f\303Oa\f\256\2417\337\371\256\361\336}\3172B\266\002\304\211\336\330\243\266J\006z\363\333\245\325d3\324\226\366Y\322mq!\031:\320p\002*A\030\205\242'%\2042\032\033\200\310\360\304\302H\"G\2438b\361S\"G \021YR\2410!\214 \222@\021\005\034\205B\021(\222J\340\307\200\307\013 \022H\216#\t\f9\353\271\272.s|\204\230\235\026\345\t\240\241\370c\226\332\362.7Z\254[\361\276\335rG\017\031\035\001(\335\032"
+	.string	"3\241oi\214\257\301\322\260\367\250\306[\027>\203\323 U\304\001\2175$\006CO\215\254\314\342\036\366*\332T\026z\310\306X\323\256\331\\\270<\316F\236j\032\270\220*\\\t\024"
+	.ascii	"\206\233R\250="
+	.text
+	.section	.gnu.lto_activeAdjustmentRangeReset.89.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375 \356\225\006"
+	.string	"2\f.5@m\223\016c>v\2463H\220\350|@\311\214`\251\314\002#M\224_H\361\277\031<\356\255i\352\355\270\243Y\206\021S\314\001>\222J\317\353S\264\203\020\231\002S\323\205]*\026\354\212x`\240,PV\244\032\342\305\201b\211\224u\305\351\340\n\242bE\254\252\254(qY\270\031(\031\371d \305SoG=\016\271\234'\366\274j\215\356\236\200F\022\027!\016\222\314\353\236\303<\210\361\005H\270yXp\302\331*\322eZt\241\374D \033\177\245\263\007\225\323H\203\016\250\342\303$3#\314h\326\227\335vJ\240m\230>\001\205\314\374i\233\246\303\376\b\177\302\257\t\b"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.110.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\024\002E\022"
+	.string	"VawI\320\3226\035\242\227\332\302Y-\200\300\342\232d\301\222N\206\270\261\274\025\372Q\327'42I\013=\301r\001\214\367\315\260Ij~Q\315j\331!(_\312\003l\355C+\324\207\346y\032\002\320\222\210\210\364\301m\326\332\336)\005\\"
+	.string	"f"
+	.string	"d"
+	.ascii	"\224\336d\231K\0033\245\366c\\F\3533>h\0036\006\207\004\321\256"
+	.ascii	"\271\340\233S\3347\223\227\230\276i/`\372f?f\233\005s\313\366"
+	.ascii	"qSgO81\021\262\331"
+	.string	"\356v\337j\213\267^\251\326\362/\273\310\213\306\365:Bs\342\224\344\332\t\302\356\232Cqo\267\315\300\366h\323\013\001:&\034\2500\332\231m\214y\342\033'r\361XG\310\300\334 \3401\023\302h\266kv\337lr\324\276_\343>\376i\224\020\353A\245Mb\314u\301|\240\333h=\250\344\\0\0138CJ\273\260\223o\246p\004@\346r\037\033(\361\242fgwQ\324\227\261l\024\312\225\276\207\347\305\225\347\005\210hw#p\337\034\001\356\231\354\017\244\177Y%f\023DI\246\272\354\253Lv\206\237\252\242\244\031\220Z\355\225\237/'\032I0V\320j\267\374\024Ktv\267\301_?^i\375y\005;\220z\220~\206\300\320%Zs\\5m+\013\373=\177=Q\323\233\377G\022\350\020P\263;\263$dm6\034..\364\"\226GmS\230\001\326\220\362 \246\254|\036K\212Gz\022\310\020\354"
+	.ascii	"\212\200%\213W\301\005\f\271PT\221_XN \361\227\032\311\020l!"
+	.ascii	"\307r\203\212\207\362\255\272\017C\027\252\274\226\356[\215]"
+	.ascii	"\352\200E\016\340\252#Eq\325\241l\323\373\334O\354\b\246\202"
+	.ascii	"p\2555\307v\251\355\336<\270\320\257\304C\227L\200~\350'\312"
+	.ascii	"s\364x\005/ \300\002\231\244\325\001\334\202\237\310GH{wD\331"
+	.ascii	"\342\016J@\303\3108\260\030\036I\264\\\037\035\215\265\2045Q"
+	.ascii	"\030\346u\215\301b\004`b\277C\271\205#B\276\247@\2736\357\201"
+	.ascii	"\001\332\306\273\211\332\221\366\261\001x;\333\242\177i\016\221"
+	.ascii	"\260\006\2540\237\316\354\350\233-\231m\201\345\274yY\220\274"
+	.ascii	"\360;\245\246\237@\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\020\005\325\026"
+	.string	"\026\343\204I\240\232M:\200\006\036B\007K\325RP:\003k\177t\317m\037\224\306?\327\322W\263\032r\034aL<\336vS\263\306\223\002\253S/\370\322\344x4"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"M\321\324\333t;&\203\\\235\350\007\2406L\220$2\005m"
+	.string	"r"
+	.string	"t"
+	.string	"V\241=\241d\250\357\202\341g\314Cy]\250\257\n;\030\f\266\t\252\367\205\026\352\267\204\025\376\023)\034K\374\017\013R\372\002N\250\237\n%|\214\030\341[\020\352\265\334n\316\363<\037\324\003C\007\217\002z\226\006\277\"\366\311\340R\342u,xO\301\261\210\375\263\356Lp+\342i\355\371\344\257\177T\020&{[<\020\324s\t\377\303\3069)\217E\322`\305d\215\2232\016\222\244]L\326C=\262\346\235\031k\336qw5\021iC\340\215\333y\257\250\367\242\242\336L\212z.\024\365hN\324\2071Q\177U\242^\f\211\372tD}\226\210z2!\352\313\200\250\327\372P\377\205\317\363\374mA\017\365`\270\303\253\210\377\215\034\215\031/\212\\\344X\024\311"
+	.string	":\353\2148\334i\303\237D\r\365\0018\2629\353Ji\262Lw)\t\312\263\214\224\326\213\303\326Hs1l\321\025Bm\2509\300\352\354f\035 \315\271"
+	.ascii	"\356\254a\350\254k\273\332\3305\235ml\263w\033\333D\231'\312"
+	.ascii	"Z\311\306\206\375\270\235\252\214\204\370\214\215+0v\230\224"
+	.ascii	"\006\277\324\\\340\325J\323\246\224)Ur\231w\031\t\315a\303\346"
+	.ascii	",\f\224\b\265\325~\254sd\251\007\217\254w\256\200\033\207Yf\245"
+	.ascii	"//\251\222\326|GZ\263\345kIE1rZ\343\016\320\232hW+\233Hg+[\250"
+	.ascii	"\307=\304\347\344Vv\013\224o~\3548\232\225m\356X\326\265\004"
+	.ascii	"\310\255\354\035\313\343\317\007\023\262\354\234\036s\026\327"
+	.ascii	"}\362)\033\367S\366\354\307\237b\345\203\352!\177\216\326\260"
+	.ascii	"\211\221&\225+\252\030\331\334\343\373\232\004\201\006\310\036"
+	.ascii	"b\346M\361\250\002h\250Q \217yFA\244 II1k\260\002!\262\332\034"
+	.ascii	"\021\240$\24784\021EQ\222\364(\354\255d\324\005\272\313\251\024"
+	.ascii	"\311 ~\033m\200\202\366q\245\205F\3413\320\344\212\237\345z\367"
+	.ascii	"\265~\345C\377\377\257K\r\007\3070\254\023\240\302\265\233F1"
+	.ascii	"\244\256|\306&a</V\252v\210\023\024\374\034\007\345X\241'|\233"
+	.ascii	"\261\372\213V\310\310\377~YCh\231\342\311\322t\b|\317/\232\035"
+	.ascii	"\345u\016\277O\242\317\371\370\305\301+ \342\257ju\210\335p~"
+	.ascii	"\316\366\262\346\306\324\205be\324\257\215\344(\311L\316\013"
+	.ascii	"\366}\033Xv<\202\275\356\f\377\177\024\271N\037v\221\255\274"
+	.ascii	"\200$H\032\016;\317[\310T"
+	.text
+	.section	.gnu.lto_.refs.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\200\001\245\f"
+	.string	"\226\230K;\020\223\222\326\277\245/\250\377;,\t\232f_\177\266\210\201\tbH\020\031Z\346\214\016\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\355z\365\2674$ \353\353\257\342\357\r\265\375\3765!\233\354-S2"
+	.string	"B"
+	.string	"F"
+	.ascii	"\3551\332\024\332/m\227v\250\335iIZ\262Lw\200tC\322UQ\027\244"
+	.ascii	"Na\027\205\335\023v?w=wIt[O\353h\251K]u\367\263\262\020\321."
+	.ascii	"\321\006<\263t&\020\035Z\013`\027\304\366\260K\262\006\260\324"
+	.ascii	")Z\261%\240\212C[]8\"\004\310\r\017\033\0345`\310\260Pq\302\304"
+	.ascii	"\210\0201\037\332\267\201\363e(2\344\207\217\035\234\347\250"
+	.ascii	"\t\337\211\n\0202\341|\326\233\221i\261\"\005\212\022$D\200\210"
+	.ascii	"\361\320A\003\006#D\202\374\270\351\241\303\346F\r\215\214\027"
+	.ascii	"m\230\366\203\366\202\366\201\366J\373\323\236Z\223\226\025\356"
+	.ascii	"\t\354J\340\374\302n\300.\003v\025\004W\324R*\352\335\201\246"
+	.ascii	"\3346\324ihH\367\214\316\314\272\2135\314:\302\032\302\332\301"
+	.ascii	":\001\312\b\242Y\244\013t\016-u%\032\264nK\322\321t\325\024="
+	.ascii	" p\323\2440\017l2<\"l\237\002\350l8\0326\306\212\263\324Z\213"
+	.ascii	"\274\220q\016\206%$n\260\220\031\307\301\206\304\tv!\352q\301"
+	.ascii	"\204\304\r\026\362\342\302`B\342\004\013y\33450N\r\260=j\210"
+	.ascii	"\270`C\342\006\013!z\234`!\342\202\r\211\033,d\334\360\301B\306"
+	.ascii	"E\260F@\022\201\216\002"
+	.text
+	.section	.gnu.lto_.decls.40c96d3d0d0eb099,"e",@progbits
+	.string	"(\265/\375`\222U\025g\001\212[6\203V \fi+\215\001l\037_\004LH\345]\207\336~qo\341\330~\237\033"
+	.ascii	"H\232g}\202\272E\b\375\017\25080q\376\336\236\004R0\367@\033"
+	.ascii	"\3016\221\233\246#K\340\026\214\304\310(\211\215^\235\220\230"
+	.ascii	"\304x\230\327\223?\024/\374\360\026b\224[n\271\245L\001W\007"
+	.ascii	"8\be\bO^t\302\312(Z\200\354\031\302v[\244|MD_\357\320\3276\364"
+	.ascii	"\365\223~)\247_\272\301\235\241\303\304\310\325\305-$\001AI2"
+	.ascii	"e\314\305/\321\264\2256\302,S\356\331\320\2707\024\034\341\005"
+	.ascii	"\033\323#l\273^n\230[\346r\271c\356\227K\346\212\271f.\230\333"
+	.ascii	"\345\276Y\342u\273h\277W.\026)r\212\327\355\232Y*\366m\310\003"
+	.ascii	"\306\360\024\367\036^\267K\274g\366M\013\213\305\271`\327\355"
+	.ascii	">\271P\354\333\020<\266\247H\345\215\220\316\220N\350d\001b|"
+	.ascii	"\212{\017\301\334n\332e\263oZ\230I\237b\025\23364\356\315\303"
+	.ascii	"\315\005s\273d6\255T\302\245G\213N\304\005\271-"
+	.string	"4G:\340\377fir\203\3345\241\"5f\230\271\370\252\335-\277kW\313\276k\006\340\332\033\352\256\021\355\331\033\212\310\332\017\326~\300b^J\256d\374\262\207\266PJ\374f!\202S\253\223\344\342\2273\364\305\262H\031D\235~\276\243\237\343\350g8\375<F?w9\373o\024\233\305\246\201 U\202\203\312\305\317Z\364h\217\3623Q?\203\351\027-R~\366\241\237_\350\377\212\375B\371o\2305\263T,\227\006\":H\362\034\271\330\222\225\370\025;\312XZC\242q\213\027\026{.>Y\247\263=\312'\357\350\037{\224\213.\223\257\025;\360\324]\374\377.\271\302\313\302Ub\211\367\353&\2512\344j\366\315\312\236\212B\200/Xq\304\350\202\\!\327\312\276i\355'9\f\276\b\343\210\321\215\335/\033'\215\230\360\353\022\271H\206\244\206;+\003;\216X\330\336;I\204\b\021\"\3068L\344`"
+	.ascii	"\341\223D\364-r\215X\342\333\356\021\"_\236\210\\|\322\207V\261"
+	.ascii	"\367\336\366m\271|[>\251\245O\276\320'\267\276\025 \025\020\r"
+	.ascii	"m\304\370\361\303\276\215W\314\264\240\361\262*\241x\361\262"
+	.ascii	"r\361\177\273|@@\212\327\221\213\271\202\332\fy\361#\r\217\273"
+	.ascii	"\303\022o\217{\203Xv{\\\255\273\345&\354AF\250\r\013/\030\031"
+	.ascii	"_\0347\207%n\270:6\221\2353$*\353\342c7M\202\275\355\206l\353"
+	.ascii	"\352\354\206|\314\246\217\235\350\377\332\250\0014\247\370\325"
+	.ascii	"\342b\032I#\r-\\\350.>\346\322\377\257\214\213u\263,\361\316"
+	.ascii	"\270/\216\207{[\331{\377N\301\270VCO\303}\225\275\300\310\220"
+	.ascii	"A\267\367\360\316\270-\256\2131\n\226\256r\246\245xg\\\026jE"
+	.ascii	"\021AY\342Xx\321\370Z\335\033\343^\375Z\335\252s\340\301\205"
+	.ascii	"\244\256\025\336\033\312\332\017C\326~ \333\220@\235e|\234C\037"
+	.ascii	"\323\320\037\371\204\270T?RC\242\0375s;\254\\\374\221\216\376"
+	.ascii	"\330F\177l\323!,R\376\257\324\215\022z\323F\244\307\305\027\212"
+	.ascii	"\274bC\212\216\213?J\321\267U\342,\234!\251\242-\3455D\330\307"
+	.ascii	"\326\261|\306\241\260\304rF\304\366\261q\254\334\030\005Kk9\353"
+	.ascii	"Q\274\373>\331:K\264}\354\234\3339K\347X\204\b\021I#\217=SP\032"
+	.ascii	"\357\331\240\331\242`\264\271\370\343\022m'\007\036\253\307\022"
+	.ascii	"m\036{\347\034x0\226\307\322\351(\356=\024\261A\204\235\003\243"
+	.ascii	"\233\223\361G\037\372\243\225\376\350B\177\224\322\177\263HY"
+	.ascii	"\310\036\345_99\266\210\217\264`\006\017\0319h\366\315\260\017"
+	.ascii	"\213\035\027\377\206i\313\306\266\261D\353\346\267kl\225c)\\"
+	.ascii	"\233\270\367\360\302\be\303M\355\342\333\020\231\250\256\256"
+	.ascii	"\256\316\206\310\277_\032[5\277\205b\307l\232\221\252\212k[\331"
+	.ascii	"{hDb\t]\020\271\030\315Pj\357\235\224\302\334\231(\027\377\372"
+	.ascii	"\320\367@\315~\031\207B\r#\352Iq\357\375\016\300\224U\274\302"
+	.ascii	"\212cd,\225!\250\242-\025e\345\267-X3\326\315\226\261p\366\214"
+	.ascii	"%\3327\033\346V\214\035\363;\334[j\357}k\366\227\270}\263CKe"
+	.ascii	"\034n\321-\316\314\212Y\264\214\331*o\326\212M\263oZ{\204#\223"
+	.ascii	"!#l\357\241\b\021\"\222D\210\020qY\334\251\"\016\341[9\375-\026"
+	.ascii	")\003\331\243|kF\337\252yI\022\262!E\316\306\305\267C\375\337"
+	.ascii	"v\261\\,\321\266\3315"
+	.string	";\334{\270\367\276\007l6m\350\251hG\301\215\021\356=|\007\177\211\237\003\017l\233\335b\323\306\241pG\301\255\035@\312\232\027u\350\366\036&\211\020A\236\205\315\250\313\370V\206\276\215\322_\241\257\352\237\320I\026)[4{\305\022+\260X\316\201\007\037\237\244\354\261\275\207D\027\372<\351\243\347\342o@\337V\220m\235\255 _\004\355\301\"e\033\305J\261\304\f\354\224[2[v\022j\270\207{\017\211\256\021>hg\027_\001\372\366\354\034\244l\017~\244o3\310c]\235\315 \377\352\r,R.\262H\371\332\243\374\241E\312\332\036\345\177\004*\021\363\333\rF\374\226\304\177,c\230\377\032\371\307/\277%\3001\374$\226\377\232\375\376\371\303?\376\254\375\327\316\270\345\277c\343\020\035j7\372s\005\377\2152~\324\362\377\355\\\376\263\375#\231\345\277]\377\rK\373Og+ s,\243\326h\003\213"
+	.ascii	"\2222\3500^\371G!\225\177,;\361\013\374\031\351\277f%\230\002"
+	.ascii	"u\341\214\304\361\354\277\277QJ\007'3\306\370-\001F\027Q\376"
+	.ascii	"\267\360\377\314?\016\377\367\271U\236f\2642\273\"\222\376\267"
+	.ascii	"\261\027\336a,#\373\307\260\377)\330\023\267\300O\312\371o\231"
+	.ascii	"\nl\207;ftbd\213~\253\177K\364\037\313\36526\371-\322\bv\327"
+	.ascii	"F&e\3566v\340\353\277V\306\035\343\322?\262\260\244\315;\214"
+	.ascii	"\302\377V\271\001~r\004vK\3268\203\310\230+\370\363\205c\261"
+	.ascii	"'\236\301\237\307\337\266\360\333\265\377S~\273\345\267l\277"
+	.ascii	"U\373m\333\177\355o\275\314\341\300\177\307\206\374\326\304o"
+	.ascii	"5\360_\270\377\305Q\310oC\360\217A\376\3735\002\371\355\007~"
+	.ascii	"\013\201\321\351\307\177\001\274\303\177\321\374\243\327\377"
+	.ascii	"\024\354\211\213\370I\267\377\256\375\317\363\277\356\267\377"
+	.ascii	"\337\347\267\367\177\234\377m\376\323\375\337\363\037\350'\201"
+	.ascii	"\374c\003\376\021\002\377\b\302?:\340\037\025\360\217\f\370\307"
+	.ascii	"\007\374\243\b\377E\333\361\217!\3761\001\377\210\200\377C\177"
+	.ascii	"\206\361\217[\377\210\343\037i\374c\326?^\375\343\213\177\204"
+	.ascii	"\372\307\375\217*\376\021\305?\246\377\030\374G\246\177\364\300"
+	.ascii	"?\222\360\217\021\370G\244\177,\372\307\241\177\024\372G\240"
+	.ascii	"\177\314\377h\377\253\347\277x\376{\347\277s\376[\374o\234\377"
+	.ascii	"\246\371o\231\377\222\371\357\227\377\262\375\027\355\277Q\376"
+	.ascii	"k\366_\262\377\n\371o\330\177\233\374\027\354\267\024\374\227"
+	.ascii	"\203\337\026\377\373\365[\363\267\036~\233\341?\232\377.\371"
+	.ascii	"\355\205\377*\371-\001\376{\344\277D\376c\371\237\302\377\342"
+	.ascii	"\177\207\3747\310\177[\374\267\203\377\026\340\277\004\370\257"
+	.ascii	"\210\377j\360[\021\374\366\304o;\370-\006\277\005\300oA\374\366"
+	.ascii	"\303o\221~;\376O\363\337\304\377\n\374\037\363_\250\256\256\256"
+	.ascii	"\356/\207\374G<~\005, 2\364GX\322\314\354m\022\330PY\033\200"
+	.ascii	"}m\r\336!\217>)FB99F$\307H\262\027\355\275\243\366\346\261#\267"
+	.ascii	"\235\231\225\321m-\254\020\377\353\234${\034\241\335\201<\303"
+	.ascii	"$\311\225\213\337\301\214\376o7\024\326\336[\0069\334XQB\371"
+	.ascii	"\267\267\244\265!\376\013v\264 \376\343\275\277\"\003{\267H\243"
+	.ascii	"\333{[:\372K\rJ\307\305\377=l\362mo\251\256\247\007teIu\335\240"
+	.ascii	"\"ve\031Q\021\273\366\223T\222'#\254\335\365DE\334\333HJ\352"
+	.ascii	"I\004\256,*\"\3246\242\"\356\254=u&\313\356a\327\323\226\342"
+	.ascii	"\332F[jCm\"W\226\007*\251\256,*\"T\226\021\025\261+k\023\273"
+	.ascii	"v\321\226\202\302r!\265\261\2146\261Kn\023\271\262\212\250\210"
+	.ascii	"\\YT\304.:\333\007\206\032\0367\252\320)\271\262>\250\244\266"
+	.ascii	"U\214-(\254\2427\252!\327\216\333\333Za\261\261\366\333\336 "
+	.ascii	"\366\336\342\302\212\203\272a\267D\275YE\245Aq\331\341\336{C"
+	.ascii	"\214(/\256-\365\366d\367\033\025\023\256\275\231D1\355\030{\357"
+	.ascii	"m\200\247\341\333&b\337\236~l\355*\026{s\330\303\275c\354\375"
+	.ascii	"d\367\333\336\373i\357]bm\r\367\316QD%\214\021co\255\244\030"
+	.ascii	"{\353i\215\305\336\327J\233-YTD/\256\022kT\210\302\335b\370d"
+	.ascii	"\251\252\270\266p\307uai\342S\224]\265\367\266sZ\2305c\316\305"
+	.ascii	"aX\206\2302?.~\007#z\030\264\205\007\032\215\213I0)\013\306\243"
+	.ascii	"\213K\223_I\372\007\2172\342\305\357p\245\177r\t\221\\r]H`C\311"
+	.ascii	"\300\300I\224Y\031\335\306\332\242\301)h\323A|\206Z<.&\225\220"
+	.ascii	"I\200lDE\355\213O\001\025\375\223H\310#tYb\304\221F\310+|\214"
+	.ascii	"\310\271\370\024t\351\341\330\336\303\241\334\344H\2135\222\b"
+	.ascii	"9ds\211\305]<\274cOE\222\\\374\223B\310\037V\370\310yr\361;\270"
+	.ascii	"\321&\213\216\334\"w\220<\310\036d\016\022\b\331Ez\221>H.R\007"
+	.ascii	"\031\304\022\311\037\244\326\261\022\022\307\355\21482\344\320"
+	.ascii	"\200ckT\345)\203\241\347\205M\333\343\342\007i\303M\261\304\311"
+	.ascii	"\037d\f\022k\350i\270\237\262\332\f\261-\272\244\\V\004\t\035"
+	.ascii	"\007l\251,R>\207;\372\034\326\350sh\323\347pE\237\203\230>\207"
+	.ascii	"\037\372\034l\350o\250\323?yu\022k\r\004\231J\252\213\311\305"
+	.ascii	"\244U\211\223WqYk5.&\345\350o"
+	.string	"\210\323\337\320\246\277\301L\177\003\022\375\223T6\204\204\031^|[F\204S\205\315\005C3#\214RF\266Gh6\304SbMM\210\365\3405\370\f\216\303u\270\r\256\203\361\220Q\030\016\357!\241H)\334\007\253![`4\230\r\311\002\323\221S\330\r\346\203\337\340<X\016\266\203\347\310'\\\304q0\034L\007\337\301r8\r\236c\211\344\306f\216\337p\013\307\343\326\023\027\305*RF\027\366Mk\001ar\212cX\334\204f6-O\021\214\334\030\354\272\260\022V\3112\2468\306\347\306\201\261i<\256\b\367\036\252\205)\203\322\347\013\366\202e\013\030!\271\361\030\\fh\334\373\207\2310\f\232\220\315\246i)\323\"\246X\202K\026:]\260\227\264b\032\231+e\304.\0257a`M\252\204Y\316\342\b\305X)\226\221\033OyS,#7vb\323\f\260\344\253\310\034\272\275\207I?j\320\304A\241"
+	.string	"\036\207\026)\177`\245\177\354v\\\3466\r\004\032\312\257:\2539\027c2%\216\335,\310\322\266vqi\217\3627P\351'\331\321OB\243\237\024F?)L\3436l\303\rH\222\213\237$\324O\272\241\2374\245\257\201\215\276\0062\372\032\326\3645L\321\327`\246\257\241\211\276\006$\372\032v\350k\230\322\237"
+	.ascii	"\216\376\004b\364'\210\242?\001\230\376\004D\364'\300\241?A\224"
+	.ascii	">\322\035}\2444\372"
+	.string	"HX\364\221\216\350#\321\320\317\260G?\203\031\375\fT\3643\034\321\317\300C?\203\225\376Q\235\376\221\034\375\243.\372\307L\276\354\220\353\t\037\341\361\327\217\227`\026\356\226\235\212\023#\317\305\227\313\"e\f\354Q\306JJ\034\013\207\262\236L\271r\261\021N\262\241t\262\326#\b\222\f\264\024\027,c\370\b6B\364&K\326\036ld\224\373\262\205g\311\305E\230\034)\226MyQF\305\305\235\273tk\2646T\235\360\316\335<Vb\364\354\201\261\307'*\260\261\035eRb\224\235U\t\307\224<)\362y\261_\340)\222D\254\030C\216p\303\240\253\302\202\223\303+\255\n\024\036\305\271\333g\215\213\"F\310\212`aD\2129\270\324\204cU\326\033aY\024+ W\204U\243\r f\312\2100\36685\272\230\312S\314\241cLW\226\252\033e\306\352\344(\202=\031R\034\267v\210\341\021F8^\365"
+	.ascii	"\243'F\261\204\334\2106~\031\207[H\210\252+\202\221m\2019)r\347"
+	.ascii	".\2365W\036\f1\023\226\215C ZE\276\220\374\300R#n\217r7\355\262"
+	.ascii	"\215C\341\bS\370\2149\204X\331Q{\356\334\275#\004Gq\357\341X"
+	.ascii	"\245\345V\254\032\345F\253{6\364T\2647\2208c\216\221H\232\262"
+	.ascii	"k\207\006\2331\r\246\032\355`!c\035\006\202\243\260\027\336\201"
+	.ascii	"k\340.\034d\3043\336\031\337\340*\274\205q\340\034#\035\254\205"
+	.ascii	"\263F7#\232q\316\230\007[a\027c\235\221\r\206\201Y\340),\205"
+	.ascii	"e\214f\360\013|c\324\203\257F8#\335\330g"
+	.string	"\234\3034\306\2671\016\326\201y\214g\3065\243\232q\017.2\026\361\3063p\2131\016\333\300>\360\323\330f\344\203\2610\027\356\201c`\"x\b\206\032\345\214p\370\307\330\202%\216r#\231\217nc\031\260&F\204`\370\214E\220@)\346\b\2026n)=c\225\f7\302[\367\217ef8\306*\034Sd\204`b=\212wj\211\022!\013I\204sr\227\316\032\035\302\252\031@\332\204\331c\315\204a\3051yn\331?\026\031\345\306#@\306\306\034\243\334\350c\212\226\342\336\303$;\006\217\227\231\325\302z\213E\312\366\205=\312?\252\242\177\024\246\177$D\377HK\377hJ\377\343\225\261\312he\364\362C#\f\233\226\213\333\306>/\264\220]|\f}\364\377\221m\\\033\271\214[,q\3542j\361 -I\225\261\313\250\026V\206EI\007c\2271\213\007lNr\204\355=$\211h\315\201\003\302\307"
+	.ascii	"\247\217\201\214>\0061\372\030\300\350c\360\242\355\232\022\037"
+	.ascii	"\257\340\037v\256X\270\370\030\330\264-Z\244l\201=\312\3070\324"
+	.ascii	"\3070D\037\303\226>\206\030\372F{\364\215\336\350\033\201\321"
+	.ascii	"72\323\036\354Q\276\221\022}#-}\243(\375\"9\375\2423\372Ek\372"
+	.ascii	"EC\375\"!z\003{\224_\264\245_\204\245O\244G\237h\215>\321\232"
+	.ascii	">Q\024}\242&\372D?\364\211j\350\023\261\320\037\332\243\374\241"
+	.ascii	"\242\376P\013\372C[\364\207\310\364\207\226\350\017i\351\017"
+	.ascii	"m\375\013q\364/t\321\277p\246\177a\211\376\005\034\372\027X\350"
+	.ascii	"\307Y\244|\2419\375-\366(_\250\214\276\020\232\276\220\023}\241"
+	.ascii	"\034\372BP\372AE\375\2405\375\2402\375 \"\372A5\364\301X\244"
+	.ascii	"\374\240+\375\240\243| ;\372@pzd1\266\260\304\244\221\352L\224"
+	.ascii	"\325\326\305\007\"\243K\260mR~\235M\312\007\"\352\003\031\321"
+	.ascii	"\007\352\322\007\252\241\377S\247_\264G\371"
+	.string	"t\026)\377\207N\377\207\215\376\317\027\375\237)\372?_\372??\364\177f\350\377l\375AQ_\213\321v\317\221c\237\236\256\250.\276\245\203\246J\316U\343B\356\302\271on\361\272\271q,\361\312\271l~\301n\233\264\270\272\342\230+\347\246\201Q\264q/\204{\017\345\3345%\002\270\204r]\374\300\345h\263\306E\231\253=y.\276"
+	.ascii	"\330\364\220x\205\005bW\031F\222\tbqvDN\351\204\374\262\345F"
+	.ascii	"\221\213\207e\025\265!\0260\266\241\035;\334l)\231d\2673?\240"
+	.ascii	"\222|Y\261:\242p\231b!\356\315\254\216\310\305\245\221\322H)"
+	.ascii	"\264XXsHDa"
+	.string	"\221!\343\310Ka\251\344G\034\327\023%I\262\227*\\d\320\250A\t\351qq\211\304\206\241\353\222\306H\024\375\227EJ\032I\206lSD\3100\032\216!^C\320\274Q\205y\273x(tue\204+\b\311$\350LK\023\033%\020;tb\322\270\270\270\354Q\366(\275\216\001\312\b\320\236\252\271-\272\255E#\304_v\275\364\"Y\274\241s\346\342\322\307\333\264\036434\027\227\\o+\307\224\361\352!\200-\375\227<H\264\2500;\232\\\254CG\271e\245\354\253\fc\346\372\224\341\001\213\001f\353.\371\362\252\272\370\002\240\262a\243\304\221\304\365$\027\302\r\256O\231\025\2035%\214\326K\034.\234@\221\361\343\306\377\037\f\2401\222\247\274q]\240\305y\20317cFI\003\003'Qb[Afjj\270h\004\261\311\n#\273\370\001X+\263\312\254l'i\311\233\036-:5)\\\266\\\374"
+	.string	"\204UU\225WI\\Or\003\300\252j\223\207NH\036\2626\027\227W\245\025\036\034\\|..c\364\200T\351r\361\003@C?"
+	.ascii	"1J\251R\252|\001\204\b\214-\272;/\302\212\245\213"
+	.string	"\227/\256\325P\034\032w\264..\251l\332X\0224N.~\235\262\005\321\325\236\203\246lQ\2620\002&\344\362\362\323\207\017\017\027\027\227Sv\215\364\322ag\327\225P%T\007sb[\344\235>jT\027\037\203b\236\347)\267\225\262\257\322*5]\302\360\024>`\240\352^\3568H\352\320\025\351\023T&\207\214\270>|\310\270\032VI\364\344=I%\300!\373r\3611\230\242\263\236\221\314(\006\t\230\271\213\217\201\023:\272-c\232\241\333\360\342c\020\204\016\235l\247\264Quf,\214\310\307\346\202\247\316\263\035(l\303\033v\346\314!\311\254\224}e\313\252\314h\204\355\255\025B\273`c\263\266\326\346mr\321J\331WI_>B\004\331\330#\346&\347\271\350e\270\213\\\234\343\220B\241'X5\256\300!\352\303\305\307\223\f'\277\031\362\302CM\230\374&\273\331\200\341\350\360av\361\0010\246\017"
+	.string	"#f\236[0\223\343F5v\270\265\364\036\033\343S\214\002#J\013h\236\343\236\327p\340\301\341\2045Q\003uqV\363!-7\266\342\305\317i\200\276\200\020\235\\|-\305FV\326\305\031\356p.\0238Ur\027\3473o\023\322ZC'\344\355\207\215\007\220\256\213_^Q\243Cx\361\001\360C\377\177F{VC\313nDTvo\255\035%\265yl\345\254*11\272M\245\025\"\350I\233&]\274<\273=\223\341\300\203\267\331\2648\341\220\213\363\230[\"sT\250.~\016\223\305\374??K\336\244\365\271\370"
+	.ascii	"\230\322\031L\001\376\377\334\035y|\354\271\370\371\313\2203"
+	.ascii	"H\300.\276m\227#f\215N\307\305\271\313\345\244E\031\262u\361"
+	.ascii	"\353d.\377\177\3062^pQ\027\347-y\315\022?&\263}H4\304\326\002"
+	.ascii	"m\314\305\007\321G\337~L.\201\375\230\234\263<k\371\177\202\312"
+	.ascii	"\332X\330\321\031\313s\332\377c\203X\275\235\271\370 \344\364"
+	.ascii	"\237\257\374?BrGl\024\271\370 \336\350\203H\243\377\\%W!\321"
+	.ascii	"$P\264\267\327\325\226\215\245\245\301\020\027*Sp\027\037\304"
+	.ascii	"\225|\343\371G\006\222\203Xb\276\221\247\224\210\332PH\026\260"
+	.ascii	"\304kK\003k%\317\2361\027\023\207%\324\0325a.>\b2}\301\204d\""
+	.ascii	"o\212E\334$\311B\3736\344\001M\314\024\215\344!\035\242\250$"
+	.ascii	"0\326\206,\263\220\305\354\233V\321\226\322B\227\3112\2228\263"
+	.ascii	"|\226\245\344a\036\313e9\212%f\262\274\344\031H\016\362\244L"
+	.ascii	"\226\217\260)\356=$\242\003\245\312\215\",\344p:DQI\240,N1?\311"
+	.ascii	"P,1\213=i\270\263X\376\312a\035\242\2506T\027\002\312T}\261@"
+	.ascii	"wa\016\2328\035\031\3779\314\311P\332P\310\334\305\271\211\326"
+	.ascii	"\2151S\027\037\304\016\375g&\226\230\301\352\204\255\351\201"
+	.ascii	"\363\245\210W\016}\0204\364A\264\320Y\211NS\334Q\346\342\203"
+	.ascii	"x\322\377\300G\377\203\035\375\017r\372\037\330\350\177@\243"
+	.ascii	"\377L$\017!\212\241Sf\310\205s\253\212\272\370\037\336\364\035"
+	.ascii	"Z\244\034\302\036\345\314\225\273\262\327\377C$\266%\b\226\213"
+	.ascii	"\377\001\214~\366\361\377\247\002E\314`\271\030\333\267\345\314"
+	.ascii	"\343\271\307\377s\307(\021\306\270\370\037\270\350\347\255\274"
+	.ascii	"\343\377\031\212K\202\026\345\342\177\300\242\237u`\251\243\203"
+	.ascii	"\343\342\234C\263\370@\226\001\320\016-=th=\347\3703\216q\353"
+	.ascii	"\256\255P\307\347\316\305\027\354Q\266s%\236\265\202\312x)\232"
+	.ascii	"]\374"
+	.string	"\017^\372y\206\3155\210\271F\236\221\264w\026\006K\316\2644\300,0\201s\273\370\037\\\350<\343~x\312@\250\315\016\216\263\213\377,\343y\306\217\311\\;6\r\004?\324\264\301]|\303J<\313\270dA\250\212\\\214\205E\222\351\2757\031\234YY\330\326\322\n\021\344\004\013\333\323\305\367\240&[e\253\374\302N\t6C+\204\226!#G\217\213\357aM\377\271\352\226\230\253\310'I\\[\306\002\226D\211m\225]\270\320\335\270\370\036\3102U\246\312/\312\032Q\331\305\363\213\026ci_\344\033\271!0\260.\276\007\037:G\345\250\314\302\303\336\233\305^\301\365\245$O=\263\260iDcn\270t\2718K\225F\320X\320r\361\353\220^v\336\250]|\0170\370\360\311Onpy??\375h\315`\"\344b\262\316\302\221\261\363\343b\262\217\225\303px|\244]0\247\177R\317-\221\324C6\221"
+	.string	"\327\226A\200\257\031E\346"
+	.string	"\375p\303\302\352\342_"
+	.ascii	"\247\177\022\217%\222x\360W\b\256-\303\003\330\\\237\262\013"
+	.ascii	"M\330pt]\374\013\254\320\241C\336\231\3632+\243\263s\362\216"
+	.ascii	"F\223\306\307\307\305d\035\362\215\220\23530QV\377\177\204^\310"
+	.ascii	"\340\302\343\342_0\207H\316\301FF*.(/\003,\371\022\333\242\333"
+	.ascii	"\033\214\006\"Z\360\220r\361/\320\241\177\262xK$\213$\023\tp"
+	.ascii	"A}a\260D\316\213\016\335\336Z\032\020u-I2v\361/\230Z\3635d\034"
+	.ascii	"\273\367\336Z\373I\256D\r.fetpN\306i\2730\234\302\346\315\305"
+	.ascii	"$\033\362\315\377\237\240\"\217!Ro\334l!i\301\242\205\240)\251"
+	.ascii	"95\027\267\271h\377_fD\311\222\213\3118\233\366\377\007H\255"
+	.ascii	"\307\006\273\370u\336\366\377\007\327X\203\342v\361-\220{#\323"
+	.ascii	"\274\221h\362\336v\310u\205\265\265\260B\264\320\002\211\346"
+	.ascii	"n\256\275\205e\025/(E\022\356$\232\322K\021J\225\213\3113V\356"
+	.ascii	"\377\317\005:S\256l\\\374:\027\311\377\237\314\206\211\217\026"
+	.ascii	"\027\337\002-\372\026\374\320?"
+	.string	"Y\206H\226\271VI\373In\003'3\206\032\334\202\027\372'\303X\"\031\206$\203\001\013\0058%E2?)\206\034s}X\240\033ira\027\227C\213\224OWG\377d\027K$\273\220_f,"
+	.ascii	"\354\fK\203/?\331Fz\2715.\025\0235-.&\332\026)\333b\013\372\366"
+	.ascii	"\211%\261X\"\211\205d\373\241\332\233\006\006dQ44\270QCT\306"
+	.ascii	"\256\336\324N\256\375d\032\231\205\334r\217\274P\033\213S\330"
+	.ascii	"\242.&\265\2248\251F\266i3\007w\361\007{\2247\f-R\036\265\254"
+	.ascii	"\350\237<\263D\362\214D\303\2005\001\270\027\305\215\245\245"
+	.ascii	"\201\220\033\0379t\310*'\321~\222HN!\255\214n\336\270\204h\031"
+	.ascii	"t\033\313\305$\225\022'\253<y\332\221\344\342\n\354Q\306\360"
+	.ascii	"f\221\362=b\217\362+0\022%\312\333p\321\226\362J\"\254 K\250"
+	.ascii	"\322\017\030\302\320\372;\177fSz\236\260\002+\240TB\007\037\272"
+	.ascii	":q\320A\260\211G\252L#T\246\325l\"\361\00365\001y\352\017\310"
+	.ascii	"\373\361\231\277%\324\304\322\017E\201\236\274\023\005\265\004"
+	.ascii	"\025\351Q/\204\365$AE\232!\204\365\\\372\020\302\271\3643\231"
+	.ascii	"xIg\032q6\241+\t5=Q\240i\217\303\272SM8\233\320U\253\250\317"
+	.ascii	"\2076e\025\275\260bMQ\021Nu\350L#V\364\207\356*X\321_\t=4xA="
+	.ascii	"Q\244Ng\032A\002\210jP\203\347\t\201\2464=\203\347yB\303\231"
+	.ascii	"F,\375\320\023x(\254\350\017-r\312\260\236j\323\331\224\3174"
+	.ascii	"b\351\207\246\253J\342\3549\371x?\224D\252:\221\230\300\347s"
+	.ascii	"\372\375\200\277r\335\235+\240jN\001L\231V\340\257T2O\037>S\247"
+	.ascii	" \0166\361\232\316\246\274\"\b\f\201\303z\246\021KA\022KA\336"
+	.ascii	"\317i\204\245`\320O\351\256\247\272\024\024Zw\277\245 \371[\n"
+	.ascii	"\216L\353\322\357\364\345s\005T\305\252z\246\275\236Y\256\b\002"
+	.ascii	"y8]\203c\357\374-\241>\263\354\235\252\023>\325\362\351n)8\342"
+	.ascii	"\302\212tU\321\245\023\205\rA\323\204\263\0074\001\230\002\020"
+	.ascii	"\3559\201\320C\203\033\376\177\274\26649\250<\0242\034\205@\001"
+	.ascii	"\357\364\235&\220V'\037P=\001\202\006\"\025i\232M\250\352\311"
+	.ascii	"\003\246A\016'\254\2773M\235xFH\301s5\261\302\027\f\232G 6\030"
+	.ascii	"\261\246fpD\tK@\n\f@\315\240\036\251K\250\322o\3659\231Jg/i\205"
+	.ascii	"\231\246 \230\330uHZ\177N\300\020T4E\360\\U\r\352\271\3643Q8"
+	.ascii	"y>\223\307\341<4=\177\347\222\276\001\016P\200\003|\240\242\374"
+	.ascii	"\007\t\330 \001\033\344\177\220\200\022%\022p\200\022\372\007"
+	.ascii	"(1\256\353z^\223\231\216\240n\030ah=\323\b\n\232\316U]\241\016"
+	.ascii	"\021\241@W\236it\366\200M@*\017]Ut5Wu\247\202j\256D*\360\204"
+	.ascii	"\003\234\253\231\"\251\300\003\372xNA\336\205\263\tM\341\344"
+	.ascii	"\231)\t?\013\244g\n`p\202\364D\225\320\365w\366J\350\245&\360"
+	.ascii	"\004\321\nL&\234*SN\235x\030\316\325D\341\\\001mB\327\240\005"
+	.ascii	"\322\323\347\324;\231x*\322\322\017mJAP\201\207\256&N\337\t\363"
+	.ascii	"w\032\235i\204\212\224\304R\360(\005\n\232M\274\224L\317\036"
+	.ascii	"\212\002\230\006{\247\212\324g\242\351\251\032\2518}A'\021\224"
+	.ascii	"|&\023\320\017\365\260\356\312%3\005 \272[r\362\005\223\322\336"
+	.ascii	"\017=\261[Mu\327\344\224\256*\234A\225\002\241\323g\362\200\326"
+	.ascii	"\364D\361Cyi\017m\"\177h\223V\201w2\361T\230M\232H\365\231(~"
+	.ascii	"@\264\004^\252A=\317t\351\024\241\311\f\001EP\t\303j\242@W\036"
+	.ascii	"\bg\017hB\212\232I?\224w\252N*\322 \025N\346N\205\331D\244\""
+	.ascii	"\255\247\252\244\004\f:\203+V\243\r\026\254N\301\037\252\341"
+	.ascii	"\f\256XM\024hz\366:\354\226~(/M\352\001\321\364\f\236Mf\252\264"
+	.ascii	"\343\245\352\016U\325t"
+	.string	"C\017\335\255\350\317\351\002\007>\025\251J\264\252\246\322\256\347d\236\330\251N'\324\241\364\247\356T\244\273Su\332)\251)\217H\335\235=4MO\024\300]Pm\342\240\236\320C\203B+0\355R\230+\206V`\332\025\255\300\304\304[\201\277\365L#zh\220D\322\bV\335)\365\320`>\301\226`E\260=48\256?\024xB\320\251\367C3\240!(\205\251\001'\023=48\364CMXA\350\241\301\242\225w*)\035\255\351\031Tq\356V\037\272\356~\300\025\320\024\310\224t\366\200&\254XQ\024fJ\002\272\376L\242\024&\370\241&\t)p5\3233\003\n)\314\025F\276\223\307\003\341\\\315t\250\267T\324\363\001\231\3243eZw\353\251&\235M\350\n\264\302\364\235\275\240\fG? \272\246\320K\315\024)p\204\336y*!\2450W\354\210\200V`\332q\240\252f0\005\320g\264\"=Q"
+	.ascii	"yg\272cR\315\22474\204\264\002\213\320\240\245\237\231\244\242"
+	.ascii	"*\314\335\222\323\211\263\247\341\207\232KFj\323\256g\236L\246"
+	.ascii	"\n@\240o\227\236?\324L\327\0350\345\231\033~\250\271Td\224\002"
+	.ascii	"\323\364\324\240\244\004\\\235x\273\235z\302\304\300Az\256>T"
+	.ascii	"\t\303\nL\273\037\272\002SSz\256\275\fg\017h\302\t)tX\321&\224"
+	.ascii	"\002\247o\351\007\202\206\037j\222`\264\236\352\211Bz.-\241i"
+	.ascii	"\n)\200>\037\b!0\361~N\246\317\202\335\251:aPa\372\316t\227\302"
+	.ascii	"\\\261\353\235\253\231.\235\353\017\315\260\002\232\232\347\017"
+	.ascii	"\245\300\252:\245L\353\021\371C\315%\240\223\3673Q\364\314\336"
+	.ascii	"\205\325)\270:\001w"
+	.string	")p\0056a\310\353\317\t\310\333\371|'o\007\\\235L\r\273\365w\242\352\317L\327\244U\005\002O\354\224\224tS0\335\375\320&\241\336y\006\325\035R\356\241\301\241S5\317\224\367CO_\0175\n\372\200\301\364\\\177\350NI\311h\247\302l\332))\031\251\200\006\325\235\222\322P\n\\y\246\322\216i\005\002\233\324\235\222R\0210\250\342\334\235(R'\336N)\350\333\375V\3640\234<3\335\371N\024\247\217\350\007DWS\375\235\301& o\267d\252\273\325<\201\002\351L#\212\316\325Lw\247/\330d\252A'\017Eq\366\262\n\252\331\264\353\235\276\023\246\212\366vj\006\265iw\246Nk\320\344\355\200\351\212%\"5\005\256<\264w\246\301\335\211\002]\203f\317<Z\3174\202\004O\t\203\324d\342\341\263\311\254\300\351C\225\200i0\350\\M\024|\300t\375\001yG\037\364P\023R\246\265\374"
+	.string	"\030T\021\201\224i\325\252z\256&\n\274\264\004\006UD\200\227f\365\\\315\224\024\241\204\023R\246\024~+z?\353\017\005\006U0\317\364\304\316\f\256Cgp\305z\264\376N^z\006w\276u\005\246L\353\004+\332\204\372v\347j\246@g\017h\202\031\\\3133\215P\225\316^\317w\242J;\025\300\023*\360L\337\211\001\250\273\037\272[\177'\212\b,\001)\2602-\241>%"
+	.ascii	"\224)\316\237>\235|&\006V\023\350\033!\305\371\273\260d\372F"
+	.ascii	"XM\240O\351g-\315\325\024\201\207\302\252\232> \025\350\364C"
+	.ascii	"\327\037\220\307a\365\001\201\020\330\221+z\346\231\222\352\356"
+	.ascii	"\\\315\325\004\b\275\263\t]'Xw\034t\260\202\260:\001\317&t\375"
+	.ascii	"Y\327\235\271\232\""
+	.ascii	"\250? \272\242*\360\004\225\310)x\256*6W\263\207\325]\206\037"
+	.ascii	"\020]y?\247\0210\234\273\263\0074\341\354\001\233\360z\246\021"
+	.ascii	"\352\005\247\317\344\231 2R\341d\022\255g\032\241\236=`\323\206"
+	.ascii	"\003\203gJb\005\002S\022A\301s5\321\373\235\245\272;\227~&\n"
+	.ascii	"\274\241\340\271\232XSsU\177\316\245\237\231\222K\250\322\017"
+	.ascii	"\270\356>X\177\250S\251\342\354\375J\360\235\277\237\311\024"
+	.ascii	"\002\023oES\230P\341d\"\255\273\003\224X\177\250\223~\211\022"
+	.ascii	"!x\270@\005H\320\274\021\352\216\227\222\340)\221\370\241f\023"
+	.ascii	"\t^\252\222\030aAz\256\2773\204\365w6\255\252S\bzf\321\377rL"
+	.string	"\3212\201qE&\246\f3'\026\307\311\305\3034\262\341\031\033.\\\312/C\b\260D\316\213\316\227\322\013\333\216\235\304K\333\tk\246\350\272\220_@Suz\266\272\\6Y\006\2247@.~\006X\372/\331\362\013\334\344\316\326\\\271F\336\311Lf\340\330Rn)\267\346T\001Q{\302qx\246zh\311,\210jT\231\235\311B>yR5F\255L+q\274\335\220\342\342\342\322Ji\245\274\362\"\250\031%\332\313+xvL}\021\300\\\006-'VT\366\345A'\017\335\2248e\312\326\204\334\341\230\226\023\030J\316\310&l8pL\225R\312\027yF\027\232'kC\302\027a7\312ay5F\r\314\311\305?agx\364\210\211\225dJJ&Uv\212c/\311.\222+\205\246\205v\003\205\341\2503\362\204R\030H1\210A\246\020B\210dfh\323\0013\025@0`D \225\215\207\311=\023"
+	.string	"C\013\212\325\221,\347\234BB3\"\n\222\242\244\220\2155\350n\032Pa\030U\315\324\204\003\020\032\216a\324\340\224\350\3406D\030\254\377\245\217\003@yb8\331\030\304\367\256\271\003mB{\372\\\200ai\360\360\3761\336\201\3603u {\252\365\206]i*.\257XJ\332\320`;\3510"
+	.string	"\236\215\264\320\272\004\bq\007\333\036\234\034`|\366\007\352KS\r\2212\356\335\305\260\247\261\006\316\032\034\246Q\275\367\037X(\355\373l\333\355\f\254\245\321"
+	.ascii	"\246\007\242i!\274j\205\031\016y\273"
+	.string	"\205\254\304\310B\232@\252B\003\233\2761p\250r>\253k\035\227\325!\360\201i\353=A\205\226q\027\216\177Z\021\222\314!\3648\205\221\310M\020I\234\347f\212\245\253\332:\020`\224\226Bd\325pFP\201\300.\376\234uM?\217i\334\\\2544\024\245\207C#\236\354bnl\357\201D\307/\326\020\203?\374\177\302\323\204\334\304\350\332\265\3739H\226\025\304\277s\262\260\275\317t2<R\231\255\"\273\340\272 }_;1\220\272\324\231Lp\215\361:\203:\322\302\232|\215\360r\016^\001\3030\261\232>`\304\334\022\332\027=\376bN\274n\027k\374\352\352t08U\275#g\353ue\230\246\236xl\022d(<\034Q\372\264\\\234\260Tkm\022]\nQj\200>d\371\254\341\262*\360\372\034\200\006J\257\200_\372f4\2112h[\363@7\341`\357\324p\307E\302b\254\b\221\274\n]\311"
+	.string	"\355\265oU8*~\377\342%W\336\001.\341\245\017\037\332\206b(01\202\342\247-u\247ZSN\324?\024\300\361-\267"
+	.string	"\0049\347QO\321G\001\201\332\344UF\263\237\377A\227\212%T\217\320d\376\310y\"\0224\f\335\215\237'r\005fi\361k@>\301U;=\206nh6z\276\230EW\220\370\260T\336\033=y\301\213\366\\w\344?\005A\373\270O7H8\3368\242\212\311\271Q_\275'L\371\036\3433\256e\307\336v\341Fd-\337d\324\260\237a\314\254R9g\334\203\034\251\332\322c\241\236\0211\021\001\243\275\274\312\3618.s\243\2018T\245@\323$(\356\216\351!_\030\331\254W\246\241\224\235\270\030\257G\352\177\222v\213\3014_\261g'l\301\343\271\302\225\365\261\342)\247\312Z\332R/\254\301>\324\374\342\216\366&\300\002z\332\206\"\t\200\271j\222Sx\221\256\035 \267,\310\214\237?\035"
+	.string	"\t\350\364u\034\027\223\224\221\210I\350\224\006{\356l\362\t\230,^\236\311m\362\002x\354\250e\2645\370\034\272\250Q\002\203\022\277Y\244O\231\303A\372)\013\315(\216#\245\267\236\343u\232\b\036Pt\b@\226"
+	.ascii	"\313X,p\356\354\321|F#\035%z\347\254\333\025\201g]*\177&\356"
+	.ascii	"\351W\355\314\223At\036\312\257\265%\024\355\304\263\374\302"
+	.ascii	"{\215\032\t\243D\250@*\024\321\256\370\275j\001;=p\223{O`\260"
+	.ascii	"c-\210\260c{/\362LVw\274\\\237\363p\361LG\276\366XV\233T\231"
+	.ascii	"\242\367\277#S\246\335b\364j\2704\225\363u^\260\216\235\023\220"
+	.ascii	"*A\022\340f\367\371\300|\360\341\307+b\231\332\372\003\337>x"
+	.ascii	"\275U7\246\260\304\331(\001\266\347\377-T\366\200|\270\220\022"
+	.ascii	"\326\246\020\027\205\233\304\221r\037\3224'\215\024_{\005bKg"
+	.ascii	"V7\207-\272sf\223T\227\030\256q\b\016Sb\244w\311\022\376h\353"
+	.ascii	"\235\246\002\265\273\202\270\2172\\\234\237\206\344\203$M!o\214"
+	.ascii	";\024S\343\225D\375Ja*\272\233'N\355\266\fb\\J\346\214\3072\244"
+	.ascii	"FiO\304r\205\242u\330?+\274d\220\3756M|\2156\231\214\244S-\022"
+	.ascii	"B\362\350\351\357\352j\221O"
+	.string	"\005{\370~\017d\353C\233\005\210]\267\222\036\307\247g\311\030\356'\355a\253\362X\242Q\365)\262\262\264\305\266\222\272\273\241\205\354\201\377\227\241\220\026\231\210Q\024?\251F\031?\355\025\030=\257\252`7\225\004\346.\366\207\306V<E\230t\223\253\257@\017\304S\326\361\245=\334,\240\246\340\220L\005x\326%6\026\315:\302\\\027\274H\244\031\240p\302\236MR!0\346L1m\215\373\003\020\215\356\0363~\343\267\365u\222\347\211\212{\366I\215t\2356\301)};~qu\001%\245\f\267vf\026\tbu\276W\343\320\357\233\240ZV\324s\235\365\005/\221\235,\356\376\2255v\032Y\252m)\320*\323\200\233\305K\027WV\311X\362a\316R\343\325\207[\221\236g\016UJk\253d^\261\254\336\247\325\371V;\235\212I7\251q\006\277\250P\303\221\024\315V=\246\310\251\254e\352^l\2436"
+	.ascii	"G\024>\346\227\221#a~\026ME\312\370P>>}\355\"\242\t\320$r\260"
+	.ascii	"1\316K\370\334m\257T\177\202\223\262\226\245\251\335\333+\246"
+	.ascii	";_\rE\337\326\364@T\226\214\230\273\243\024\330%4\024\253\033"
+	.ascii	"\337\234\355\356\3629\333\027\035\343R\021|o\372R\272I\342\357"
+	.ascii	"\312`\34765E\227\214\206/a\276\214\245\234\236\251I<\312\003"
+	.ascii	"\256\225&\211\361\224\3703\032\026\r\2109\352\006l\370\377E\241"
+	.ascii	"\222\037}\353\030\200C\375a#\347q\354Q\215\200!s\346\323\212"
+	.ascii	"\205D\177ab!8\343Ti'\337^\241\247E%\331$\323?\"@\005Lm\347|<"
+	.ascii	"\006R\342\344 ]\003\251\227Q\242\342\003\3700w\"Yw\r\306Q\252"
+	.ascii	"\332\003\023\307+\375\221\254P\372\226;\001\226\016\241x\217"
+	.ascii	"\254\027\3225G\374\242\300n\262p\034t\213b\304\373\333\026VY"
+	.ascii	"\334\026f\336\304\034\212\025\254\240\032|\007\341x\236\264\017"
+	.ascii	"\273M\200\033\007\374\361\212\216\324\250\220\303L\034."
+	.string	"\223\034\337\314\374\275\234\370e\022\021\3022)\255\257\270\265\247Sn\032\351\256V\322\336\001\317m\343\350*\224\274,$\320FG5\235r\00762f\320\323\303$\035\363%\273\300\005H\355>+\"b9\177\275fLh\334\027\306#\351A\214\224\2315\203\300Z\362\376J\305\234\025\302\341\272\355\305\027-\bv\323\367d\344"
+	.ascii	"\322\342\244\213^C\263\030vM\032\252\223\b\261\354\250jh\027"
+	.ascii	"r\337=\217jl\\\324\033a\021C\027\007\273\006Ho\253\2017T\331"
+	.ascii	"^4\262\2562\2601\3348\020ulW\226\360\030Z\002\203\240\253%8\247"
+	.ascii	"\242\002#J\352\346\f\336\232K\331\005\337\247\372\310gUmA\205"
+	.ascii	"\335\223\216\b\371\251\221\357\366\331\372\317N\013)\307\276"
+	.ascii	"V\233\260H\241\311H\276|l1\314\353}\2633.\323\017\341\342r\027"
+	.ascii	"\001Q\263\257\230\252\036?H\250\217\334\245\341y`?y,.\"\205\242"
+	.ascii	"X\226U\3528lI\214\231\235\352\341b2X\225\202\376\025\3660\210"
+	.ascii	"\375\376\212~\373E\003\341\301d^\202x\013\273\\\034\360\220>"
+	.ascii	"a\374\006\230\r\263y\023i\020\224^\":\036\005fJ\264?b\305\373"
+	.ascii	"\245\225\f=\326\232\274\350Pm5\230>>z{P\360\322z\t\037}\001\303"
+	.ascii	"\344\346\324\327\013\374\332\t\351\0035\273\253\005uU\001\224"
+	.ascii	"\221nO=\237o\234\212\030m\321\r\364of\276{\252\376\031SgQg\035"
+	.ascii	"Xlk\275+6\003Fry\354\221\362f\351Q$b\344A\216\fES\263\"\255\277"
+	.ascii	"\211\021\376P\200\005\001\026pA\350\276\201\333u\242l8}\254\370"
+	.ascii	"\f\323s\277\177\201mr\311\362z\271\211X\226\\\341Ag\244QIk\245"
+	.ascii	"\225\035 \366\033\254\371\036\300q\215\254J\260\221\233\201r"
+	.ascii	"kY\366\2147_\214\365L\233\332\354\032\344\246\\v/\333|\311.?"
+	.ascii	"\325\277\t\224\257j \013\261\360u\274\362\226\236\222\016\276"
+	.ascii	"\226k\263\034sPe\241\r\013VIs\220UOa\374\326\270~J\2505\021\300"
+	.ascii	"\373NT\307R\263\225~ \377\023U\205\303\006\004W\231\300\r\031"
+	.ascii	"\365V)\214\240l\202\303\023\362BM\303\361\343:\001h\217\210l"
+	.ascii	"\316H\371x0\304\344\354\301J\367wB~\254s\274\253B\030\216\354"
+	.ascii	"\331&'\256~W#\244\221\354H\247\341Y\273\310\327\262!\224\026"
+	.ascii	"%1\013\361|\b\027\022p\225\3776\272\3243\201%\325\310g1Ll\034"
+	.ascii	"\233\204\376b\345(\356\261\235\266\332\323\244`\347\275\206\324"
+	.ascii	"\f/\373@<\021\006;\007P<i\n\327\222\310jB\3505\223\255P\346\254"
+	.ascii	"\235\345\017\"\336\347\362\327\357\037\216\366\370\347\n\343"
+	.ascii	"\037o\273\335\206\243Fb\256\354\250\315B\361\327\360<\266\271"
+	.ascii	"\251Rv\344\242\344-\360\002\314\345?\356\202\317j\266\t\237\367"
+	.ascii	"\244U\372\366>\2201Z\321"
+	.string	"\372\020p\f\200\356\271\333#h\265\356\374\351\2232\212\203\227\n\250\326\323\347}]W\230\032A\276s\266Q\310\331\235\254\343\342\236}\222\320\021Fp\2538\b\374\f&o\321&l\203\346\246z\211h\3315\310\361\fL\235XP!D\367\037\324\327e\013>\273\027kLx\355\027\202\354\r\320u\232p\330\211\271\373iZ\306\004\330\032np_:K\241\315\n\240\3068\200\237\253\345\016p:\220\327\277\343\363<~\200\234\375nx\301\341\003# j\232\236^\251\362\362\017\016\234\207C\253\242\352\263>{\211\024\254\2144\277\372E<\301=\203\254T\235\225\357|K\201\237\324\013,\310\"\257@<\2422l&\257oi\234\013\234\243\366F\340>\351Q\376\227\227\300\337Xt\211\260\231:\360\"8\2766~\033\250\253P\303B\276/Q\031O\241\313\340\325\342G\345\037x[?f\311\233h\374\373\371\210\203d\205+\364"
+	.ascii	"\364\310M,\016\361\200@\272b\020u\231\260\251\363\3407\2031\226"
+	.ascii	"\030\336\233\035\214O\333\336\342\206e$\277\022\257\272\320\376"
+	.ascii	"\211\007\332Cg\037\317\235\002#\210\325\270\374\020\370\334\013"
+	.ascii	"\255\326\365\300\350\374`<H\360/m\375JpE,\226\373lg\373\274\032"
+	.ascii	"\340\266ko)\314\003/\t"
+	.string	"\214\272/\f\241ky\006\304\033{A\016\034-E\203_I\006\200\322'@\346\243uh\300@\203\247\312\315\330\211&\002`\b\003\367\340\260\302\257\354!$\343\223\t\331e\346\352\373\222t1Q\017\256\203Rd'wBy\247\006\241\377\005\214N!Bp\004\355t7-\346\372\276|\036\204O<yq\204\376\363#\242\017\267A\004\b\n\316R\220\025Y\ny:\351\203\r\303}g\013\036\232\255\261\255\272E/WA\3008\363_\211\261)\3310-\361\263\323\331\327v\215\2172\265\334\007'\371/\201|\203\302\271$\372H.\fGu5\320_\242Mq\2317\fw\005\024\276\305\231!\246\247 m\223\314\327L\276\0020\230rK\225\td?\252O\360\356\222\3633\344C\267G\352\356Bl\017\341\215rGD\305\257\362n\357\225\337zwA\371\rR\263`\216\301\354\246\366\377\325\357\201x\375\fg\200\371\002I]"
+	.ascii	"\313\263\214\301t\023\0074\300\377\005|\207:\346\261t4\\\340"
+	.ascii	"\230\027\017\337 p\273\370pr{\247\033\310\254\335-\233)\235\372"
+	.ascii	"\351eL\313\316\345\366-\217*l7\271\354\365DV<\234\216Z\274Y\373"
+	.ascii	"\270\"?\357\030\307\365\211\251\231\251\250O\206\231\255\227"
+	.ascii	"}\267\233b\3724\362,O\317\356r\025\213O\243\340\314\022\037\004"
+	.ascii	"\222\016\233\327\325\375\243\320\211*tD\262\025(g\314,\255\377"
+	.ascii	"g\313\031\005J{\357.\322\256\021\250\256"
+	.text
+	.section	.gnu.lto_.symtab.40c96d3d0d0eb099,"e",@progbits
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"pidAudioPositionToModeMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"initRcRateCurves"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"rxGetChangedChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.40c96d3d0d0eb099,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
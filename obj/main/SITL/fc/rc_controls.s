@@ -0,0 +1,1361 @@
+	.file	"rc_controls.c"
+	.section	.gnu.lto_.profile.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"-\007"
+	.string	"\244\t\207\001"
+	.string	"\030"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\302\374\277\243\n\004\002\001\002\002\003\240\342\234\212\n\004\303\375\206\360\n\020\002\003\002\004\002\005\002\006\002\007\002\b\007\005\b\353\361\305\232\007\\\003\002\003\002\005"
+	.string	"\002"
+	.string	"\003\002\t\007\002\007\002\n\005\n\002\n\t\n\013\f\016\020\220\237\222\215\004\002\021\367\372\342\307\013\004\002\003\002\013\023\344\371\276\347\t\024\326\352\245F\025\026\253\262\211\366\t\027\333\314\243\214\005\030\031\353\227\221\315\013\032\366\336\365\327\f\033\034\240\342\234\212\n"
+	.string	"\" p\202R\311\016\310W\336wt\372\261\036\254e\310y\214M\322r\221\036}YhvK\322\231\021\3216\030p\260*\346A\030\002t\t|\004[\300{"
+	.ascii	"\201\303\"\260\276Fh\255\005\374\031D\334}\263\346\302]\310\205"
+	.ascii	"s\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375 \204\265\001"
+	.string	"\350x"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\b"
+	.string	"\001"
+	.string	""
+	.string	"\020\002"
+	.string	"\003\021"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\n"
+	.ascii	" \007\327\240&\fS\365\305\264b\327\335\334\215\025&2W\201\001"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375`M\001\335\006"
+	.string	"RI\036)\2205I\007yy\252\370\324\347N\227\36390\330a1\212\261\302ez\217\375\rv\027\322U\356\231+\336Mk\315\223-e\n\3777\344QN\300\335=\033\312\260\274S\262\352\356\230!\376\317\3427da*E\3420h\325\347d\217\004\202\006\017\026C\373\251\202JD"
+	.string	"\321'\303 "
+	.string	"\b\003\207\327\377\222\f\262\337)\347\266\350\344\356\234{\243\345\025m\237\221\335\335\255_n\", \300\"\233\252\016R<\300\375\200\031L\334-v+.\004h\325\366V\246O\"\271"
+	.ascii	"\016\006\t\340\270\336v`\270\006\005\fJ\035\214\013E@\\A\335"
+	.ascii	"\200\r\t8 B\204\203\376 \217\021X\204\021X\350T#\017\273$\314"
+	.ascii	"^\341:3\222\336\221\255\205^\360p\007s\274A[s\253j\306\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"}\006"
+	.string	"\022\t\033!\220)\351?\227a\356\362\246\334\335\355\231\350\337o\373\367\367\376?\022\373(\310G:2\264#!2\311$\371\217\007JW\240k\371\n\206| \235\224v\226eD\363\303\326~\256e\354(qmt\235q\253\324\224\\w|\343[C\367\320u.\312\222\204/\334\316H2\fhX\303\216V\215Y\265\311\254\270\226TJW\372\222<>\t+ \200\202\t\326\030\017U\2411\fi\322\230\320\372IlN \263\201\254@\250\2342\213\344zG\272\337\241\223K#\003C\204`\235M\201\027\034Q\027{\030\205\231\030\220\007"
+	.ascii	"3\005\033E\326\rP(\036\271PR\205\337\220+\\\344d\244\326j'\\"
+	.ascii	"\020\202\2569L\215\031\255U\311\221\257+\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\230\004\b\230\004\020\204\004\021\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375 ~\225\002"
+	.string	"D\003r"
+	.string	"\005"
+	.string	"\001\002\026\001\002\001\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\027"
+	.string	"\001\002\030\004\003\002\031\001"
+	.string	"\002\032"
+	.string	"\001\002\033\001"
+	.string	"\002\034"
+	.string	"\001\002\035\020\002\300\007\200\021\001\002\036\001\f"
+	.string	"c\020\002|`\005p\340*\254\0075\001%\b7Ga\336\335\331"
+	.string	"\026o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.578ff29dd987edc3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.81.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\315\321\025\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\335\007us\357\006uq"
+	.string	"\005\001\006'\001\005\005\001\006\035\001'\001\031?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.83.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.87.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bj"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\326\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\002\005\001\006\035\001'\001\220 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.89.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.93.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\361\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\007us\336\006uq"
+	.string	"\005\001\006'\001\016\005\001\006\035\001'\001\032?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.95.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375 W5\002"
+	.string	"4\003J"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\001\320\017\350\0072\264\013\352\376\n?\202\210\2008\177}\301\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\007"
+	.ascii	"*#\300!\314\306\2004\225\313)V\017\240\b"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.96.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375 \347m\006"
+	.string	"\022\314,3Pm\222\016$\243\252\022\252\272<\\\200a\300 K\310\244\226\177Kv\325\376\335\016;\273s0'0\210\235\231E\024\321w\200\007l\006\317\262\323,\3312\005\273\314\246\341M\034\315s\bnjn\241i\030\022\034\232\2336-\203\371=(L\215\363\336\324.V\226\215\220\t\200X\304\027\244!\324\335\030\242\203\255*\335\016@%d\001\025 \274\336\372 \303\370V\222\215~\034\231\245\343\004se\206\256\2244\221J8~\317_.0\360L\325\322\b\365\202DB\004%\323j,\243T\221\272\375h\305\303b\244\022}\212\226\203\314\034+\021Eg\375\007~\202\177\"\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.97.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375`5\001%\r"
+	.string	"\006\032YA \217\223\016\310Ex\316@l'\fc\376W\3771\033\241*F\230\213\315\fR\244\346r\214}Xc=\f\214\321\007\311\226#\024\240\n\001\b\232\256\340\304\017\036\0022\275\202\315\332\267\204\354\235dJ\001H"
+	.string	"A"
+	.string	"F"
+	.ascii	"\036@\371\241\005P~5\340\351\307\033\206\026[ !2\311dn\326/\370"
+	.ascii	"\343\347\216\237\272"
+	.string	"\002y\033(\264\030i ?\tv\034\r\002\036\200\246\34262\323\035\214,Z\nb\005\222\231\305\221\026\301\245\3346A\333\002\255'\004\265\313\314\354Im\261\033\277\330\031\307V\016K9\354sXw\354\035\026\035\326\234\312%\205\306\212\314\226S\214D\361b4\264\365\264\234\266\307\326.\346\340\361\313\203\276\314\n#Ddn\036\345\320\370\005\b\247L\036\006azG`\314L\320_:\276\200)\241\2020\372\273{\305E\306\177gB4\343\343\255bE\246\3550LCh2\363@\355\301\037\034\324\031\374\332AA\217\374j\024\312\317\327`\021\023\302S\273\201\360\245\006#\n0\222\020\023\221\252\327G\247\001\226\235\224`W\310\225Y\327\002\253\204\201\b\211ue\035\353\203@1\223\221\314:\301\260\314\342li\227'\025\035\207\361\035\256\316\322v\363\215\320SZ}s\213fBx\242\336K\356\356$\352\356\304;\025\031"
+	.ascii	"L\204^\350\206\0275E .\210\001n\300n\025l\001e\300\270l\220\003"
+	.ascii	"r\345\020\214G 1\261^\202{\025<\244\272\200\270\346\300\312b"
+	.ascii	"\203\017\201h5\344U\205\253yo\273\212\036"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.98.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375`\262\003\325\027"
+	.string	"\306\352\226J\300\324Q\007y\2273\004fDW\202\022\250\216W\2035zQ\365\231\217\201\267\004 \227\272n\247\334<\030\373bC(\246<,\336M\202\366X\32545\r\034\005\020\032\315\365\352\330\265E\365m\341!cd\357\275\267\2242\245\224\002\202"
+	.string	"t"
+	.string	"\211"
+	.string	"'\222+U}%\230Y\207\231\344V\321J:,\243\274\"\334\330\333\341\263T\344^\236\251\322\245\355J\273e\273\276\210\22659\212!h+}\227q\217\270\235&G1l]\017@\n\332\340`\317<\264\245+C?\241\326\021\324\201\226S z\220\270\036\257>\224\205\253Q\225{/\211\343\361\247+@d\fi\035A\034hy3\262\265\256\375\007Gs\007Y\356\275\3546\234\206\346U3s\0233\2570\377\211^\366\214e\256@\343m\363g1Au\321\021 1\2361\330\376\t=\0365?\302\243\253\334\256\261\314\260\013\336\266\376\326u\0031\321\220\252\375\0163\217\346\237c\356?\317\363\344'bf\347\262:\247X\347VuF\241\316'\325\331\244:\263\252s\211u^Ug\322:\217\325Y\244\316au\006\255\263\255\316\225:\323w~wvwn"
+	.string	"`\325\224\200\247{o\0015Z\240V\337NT\273\361I\005Mc\306\370\005\250\302\027}2\302\007M\0201\342\003?\327\035B\bP\317~\216\301\017\275\237}pA?\265\300h'\006\r\\\\lW\373\346\210\035\375\372\355S5\363\323\325/\034\204\367\336\003\334M\355\342\001\204\227\227\257A\206$\371f~r\325OH\2516\214\375\367\024\314\021\272\005Lxo\315"
+	.string	"7\213^\222\300M\242+\307\310Tn\231G@\265\233\371\3113t(\212\350\347x\355\037c\005\374r\341X\200\305rl`\257\230W\314|Q0mhdj\314W\f\307t\005`\330\315L\314\314\201\301b&\311\233\365\023\361\315\212\037c\267\314\266\256E)]\224\345\226\331\362\177\230\271|f\231=\215^\267\001$d7~\216S\036\3453\264>%*G\353]'\217\202\343\306\311\327\251$I\016\305s;\022M^|\026R\357g\362\004|\364\f\321\374\354\362fd\013Y/~\033\365\242J\236|\326\2039z\216h~\362\352K\022tH\250Q8$\031b\250\2102\222\322\202\264\001\240\002\031\251\3329\020PU$SAZ\016\317aT\2524A\332\006\t\b\2443pM\360~\324}\036>\262Ry\212:\272M\034\253\231\236\232\333h0\372M\273\236\003f\303\311\323\035I\3302I_["
+	.ascii	"\307n$W\006\207We\222m\200\202\177\024\271\004\266|p\005JtM\033"
+	.ascii	"6\356\001A0j\316\351\003\224\360\036\317\007B\030 \255\347L\247"
+	.ascii	"\0215\333\213\337\242\210\255\\\366KE\030S1D\330\241\244\020"
+	.ascii	"\330\006N\371\026E\272\276\336\325"
+	.text
+	.section	.gnu.lto_processRcStickPositions.99.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375`{\033-u"
+	.string	"\272\265\344(L \016\333\031\003\027n|k\232,\353\227'\242\377\354+\020\357\303\314\215\020\241sb\225\204\253\372\301\206w0\227\027\373J^\340\307'0\270x"
+	.string	"\202\3211wc&\354\354\353"
+	.ascii	"\002\220\035Z\324)\212s\322\036<DD\210\224R\246\224R\211\002"
+	.ascii	":\002\217\002$\306\220\211E\203|\031\267\327\204j\f\357\224\305"
+	.ascii	"k\322V\272\253t\257u\353\254\257\376\3562"
+	.string	"w\234\025\021\214\264\334\336\257\020\352\264<\245\272\215\373\215\221\334T\332\215\331U8\257\230\365,\312\3051!|\337wD\261Y\243\366i\233][C\333\2547\033#9\252\004\263\327\260\214\262\334^\023P(\231\256\035\276\257[S\263\334Tl\226\231\314i\332-\311\333qa\\q\207\357\373*\037\t\257\275\2725\027\235\331L\307s\234\205\2610\013,\307W8\216\2550\034\277q\025vc\261BE\212*\024'\250LL\225 !\0255B\204\022\352\311\251\211i)\204\022\210\017IH\036\216\214:\024\021q\030\022\332\020\004\364\343\323\243\201'\303\216N\016N\022y4\026\335\226]\337\231\334Y\315tP\266\346\364\262\244\035\301R\200\331\020\256\273\037,\004\021\002\r\023cY\356J\234\225\0368\267E\217\346\267\225\253\354\340\341\354)kz\265\274\376(kv\261\354\306\241\254i\302OY\263\004g\021\366dE5\321U"
+	.ascii	"9\222\0021\006\257z\323(\336H\237n\374\004\033*\037OL\260_S\207"
+	.ascii	"i\332\235\347\013\355\316\223\272\226`\262!\261R\325\275w\256"
+	.ascii	"\264\212\326\322\347\240K\241q\301\243\250\\r#\004[\204\240\031"
+	.ascii	"W\3765\324_\030\177:#}\372\271\023\bO\232\372\230\326\016F\206"
+	.ascii	"P\033\360\tf5\342\233r-}\t\341\205\317\225@(\261q\311}p[$\325"
+	.ascii	"5\022\240\207\225\211\254\357\207O\013E\006[\372\314\342GX\346"
+	.ascii	"\334\210\216\005\357PG\305\213\352\332\234h]\232C\214k\300\247"
+	.ascii	"\335\372\263\202\326\224\226>\331\234\203\333\202\255"
+	.string	"\t@B\306u\367\243\254\210X\017\tM\351\rR\324<h\n\3403\212\003Mi\342?kT\226/\273\006|\256\2558ii\244*\270O\317\022\327pg\346<J<\303]\n\276s\327:\200\317$\253\221\3649\304s\244O&\200O2\307I\036\225\201\2155re\"\334\302\246\001\237c\253\217\t*8[\372\024\342\307U\212\204C\261\006|\212\255I7\\c\232\255\217\244\317 n\\\223\201N\2024\3403l\225\n\243\013lz\321mq\004\f\332.\220n\271V#\367\372\332r\366\204^s\276HX\215\336\367E~\351\360\357\267fRbf\215Z\006\006mw[\274\357\313\356\374\002k\216\321\314l\0363\277`\376Y P\006>\347\035\221+\3215\203\363\f\274\033\327~\215\363m\346\313K%l]\220\202\206\374('\337\370nV\241\030\277\256V\221\237\374\325o\213\354\003\350\361\221\037DfKJ\221\373\364"
+	.ascii	"-s\001\007x;\217o\234R\317t|\026\027\337\330`\232O\006\b0`\264"
+	.ascii	"\315\026?\024\376Q\241Z=}\205h\216kQ\305\017\275\327\320\273"
+	.ascii	"O\003N\220{\257\275`q/a\017b\304h\233u\221\n\377\324\240Z^5~"
+	.ascii	"\224]0n\367(\036\346\205\361\246^\361^\274\272)\276\331\272h"
+	.ascii	"\230g\347\334X\255\212\367Z\361\312\023\240\300\235\321\341n"
+	.ascii	"z}\337\367-\276\265q\311^[\333<\236W\266\352S\274\027\263S\257"
+	.ascii	"\370\356\361!(ya\213\254\351Uw\335\232\250\255\372\346\361M|"
+	.ascii	"\355G\271\227\354\365X{\307\217\220\227\246\352\275\332>\366"
+	.ascii	"[\005\032o\013\373F\251\237Z\233\026\373\321\267\211\332\035"
+	.ascii	"\017\201\231\034\327\217\246\013t\002]?\312\353\373_\301\205"
+	.ascii	"\321\341n\370\177e\240\355\032(\276\257\216)n\272\256{ \202\t"
+	.ascii	"&h\233\375\377 \330\326\357\337\\\211Z^\325\352,2\212\357\373"
+	.ascii	"Rq\263\320X*\340^\322,[0\303\333\331,\367\214\266\331~V\272G"
+	.ascii	"\305\323\362*{s^\253\342\333\353\373\255\221\n\367\232e\256$"
+	.ascii	"6\275\372at\201h\377Qf\267\246\277\221@'aZ\370\2150w"
+	.string	"\017\036;\332\353\350LA\321\231\201\2433\214\243\363\213\256\322\274BE\212^k\256r\235Q \235O \235\251\\g\023F\347\251\243s\211\2433\211\243\263T\3229*\351<\"\351,\342\350\254\314q\206\302q~r\235\235\222\316MGg\246\243\363\322\3219\004\216\263R\322\031\304\321\371C\3229\311uFr\235= \235\217\220\316F\256s\207\243sQ\322\231\310u\346\320k\315CGg!\243\363\206\243sP\322\031(\351\374st\366I:\367$\2355\270\316<H\347\fH\347\035\327Y\007\351\234St\306):'\213\316\310\242\363\261\350lt\235\213Gg\267\350\334\032\235\331\242\363jt\376\242\263\273\316\335\317Ldc\336X\037\201\207\206\306/{\203NUJP@k\n\321B}R\205i\207h\237\036\352\207\020\237\276\035\3629_\314``\212j\031\255\323\177\031\234\337\232\323\257\020\364\242\022\324\230-5}"
+	.ascii	"R\232\236\344\362\256\204\bQ\004d\372\020\036\205\351Y1d\324"
+	.ascii	"\342\232i\306\224\222vU$\262\266\035 >\264!B%LZ\301\350c\257"
+	.ascii	"\373\254\230!\365RM\273\364\311D^\302\340hK5\336\304\317\226"
+	.ascii	"k\226m\226\324%\265mv\351O4\367\324\332<t\275\361`\3646\263\253"
+	.ascii	"U\372\030cP\340\004\001p\346%\342\262\352\355Tz ;\277)\217\031"
+	.ascii	";r\004\342[\312\242\311$\301\333"
+	.string	"\t\342\177\354\370z\354\276\364q1z!\370\341_\244\360\341Y\214%!c\203\366h$>\272\254\177jG:$E\223>I\260\215m\205tE\336\325HE\220\236U\323\205\007\221\f\224\350\005\261\352\224X\021#\034\206>\312\314)\234\335r\236LS\270Q3\273\274\230<\332\210\232\247X\t3\206\036<\310\321{\370\304\255\266\321\032\375Q\2077\002\322\341].qT\256\323\314/\037\314\023r\300\204\276g\256\332@\330L7|\364M\303p\323E\017\303\277\212\336\005\254\252\345\370\323B%l\fZ\036.\030\342\241\2417AS%\210\350\333\215{\021}\222`\273P1=\200\324\264\214\226\203\227\300\341\331BD\265\034\264+b?\177\215\325\016}\007 e\254\324\tR\361!\341k3\303\2040\307~\346\370@\244\351\321\363\215\325\n\275\023\020'pa\204\\\253\033\253\rz\241j\020\225\327\264\320\245\001\350\223J\206"
+	.string	"};\346\355\302\033\030\317\317{\240\262\b3\352\355\374\371V#\322\374,\026\313\0365\303G\231\250\245\300X\006w\246\211Z\237\247\340\331\271\240T&\022\237w\001\327\250A\225R`\246\34111a6A\266\355(93\323\t3\315\333\3119sS\246\315\317\342\316kC\254\016b\270R4\207\206Z^\335)\364\322\245\323\363WI\316\315Tk\231\231S\230l\336\316\236\317\231K\233\352\370\254#2g_9\037\345\301\326\3604\340\316\020b\300\244\342B\303?\330 \025:\364i\212P\210B\306\206\363Q\306\240\345>\323.`\200\303\205\213\266Y\026/0\212\241\214\266\f+%sh\310[\364\216\210I\362<\231v\026fx\236\235\317\371\f\337[d:\277#F\347\215\0013rd`%"
+	.ascii	"\016\rl\\9pe\225\303J\203\033WV\031X\325\2501\003\310Fs"
+	.string	"\240\201\0039p\260\\\003\nG\0067\256rlp\243\206\0055\256\2245.Pn`c\206\006\312\032W8\224P\034\370\006\007VW\312\0347n\\)\221Z\335B\353\233\374(t;\"\002O\177b\235\324\363\203\361\205\254\223z{/\234\270@;\251\267\345"
+	.string	"\263%\027\266\351\007\351\037)\323 \261D\003\206\360\277fc\354\210*\234\275D\204\260\273\031;\3730\3666^I\316\036H\357\320S\233ny\"\365iX"
+	.string	"\321\222)\031\333\377P\242x\260\023\217\302\241M\365'L<\325?M\274{\202\\\235^\230\r\177j\262D\363vr\007hD\224~N\b\340\362\372\221\370\246\255\206\f\360Q\035N\276\353G\f\211m5F(\300r\213\315\232\266\032;\243\022\006\360\321\226\221\366M\031Of\230\227P:n\251\006\"\311\373\276S\315\342\0301\214b\250u\330-\204\360\220\020"
+	.ascii	"\021\326\367-c\021\327\031\b\337\3244\267\310rDd\033&.>\372\266"
+	.ascii	"\331\035\306\300\216\310vGew3\245\356p-\n\033\3666\r\245\270"
+	.ascii	"\300k\347e-\212\241\225\220)\225p\313\023\231\206\257\315|mS"
+	.ascii	"\367\225\216[\262\365$q2/\251,\253\304u\357\340\002e\272\365"
+	.ascii	"Y\\\325\345\257\305GY\251\335\360\255\324N\375\006\037t4K\270"
+	.ascii	"e\334RN\256mv\352]#\203j+\220\351\302\002\013\027\037@Z\006W"
+	.ascii	" \t\212V\351\236\270\251\230S#\3247\226\002Hc\265%\236F`\211"
+	.ascii	"g\215\354U\325\341\355A\215a\202B\257\261Z\022\037\0245\203\023"
+	.ascii	"\364\274\356\023}\205\315\257\035O\215\312)m\257\035\017\315"
+	.ascii	"\204\004[\226"
+	.string	"\\\360\306\034L\363@\247Y\216\310]\006\314o*\f\373_\030\261\263\227\b\037{\237\337\216\263\367\365\302\376\205\323\024\3377\253\311\230\217ew\276]\320\263\227\310\273\344z\334d\356|\227\214H\360\304.$\336\2018\252+\226eM\211<f\032\342\264I\325\347E\342\243\f\246\261Z\251\177\251\026\251o+\177\206\213\233T\324\323X\243>yGu\363\216T\243F\354\361\211\030\321\200\257\275\344\363[\376y;G\274\216\027\345\262\005fZ\316\035\025\316c\363\006%\"\001\357\267\227dZ\346e\231\245\240\267S\304\347x3\245\022\276\360\246f^\242Y\276p\007\305u\234\r>\3555V\253t+\312\017\202d\250\022\3510\021\343L\251\241\021\221\024$I\2411B\013\020\bca\332S\352\001\022@D=K\204\316\\\215\202$\225\264\006\370\322g\035\021\025\354\272\215)\341\033\023\021~\260\256\257\325\2679\007\222\304\030\017"
+	.string	"\225\020\033\263\211\360\255:2-\r\252*o\004\330\203\034\214I\315\240\003?L\222?\n\205x{\307HNko\326"
+	.string	"\2611\257\237\227\352\0176\204\315\364\212&\370^fb\203\2669\266\346\032\204F\304\222KIh\312\361\234\367W\344\326\217\261!\334\336\215~i`\367\201\237&\222\256n\343d\271\262\340\312\353)@b\333\256{:\257\243\030\220\006'\001\363\341J6\030\024%\t\320?\237rO\275\265k\3513\250\340;\331J~\025\214\253E\001\206dvA\322(\t"
+	.string	"\003?"
+	.string	"\216\260\224]j\245\231F\217\335<\217O\r\301\212\231YT\002I\001d\\!1\357B\275\340\255\266e\307^\225\013\251\232\020\306\304\365\020\315[F\036;\006\242\377\241F\303\221\204\262\033\021\006f\215IP\025\f9:IO\22112\306\250\004\324:\242\220v?\306\031\005\260]\353\341q\r\024q]\023\247\361\312\301\356\221PR\342|>\240$\372\270\216\362\377>\336%\341\330%\004L\265\240\017\366A\032\006\364\272\024f\345\270&\316[\243\2632V\216e\261\356\353\315\245\310^\271\\"
+	.string	"\242\f\315\225\202\3237\025C-nL\202\2301Q\033\374\016E\221\363w\315\200\0374\251\031\342\022\327)<=1\030/\004\273\n\204fnR\3147'\362\207\221\265\035\305\263fKv\006\2456\332\301X\200\372q\300F(\230(L\177\366\271\207Wh\030\001n\037\330\231\341\240\225.1jD\276\214\377\273tN$\036\264\243\022\242!|\222\\\020\265\003\2629\313e\215p\"\277)\252\002\364\316\321-A\205\016\327\005\265-\245a=\307\003\b\375\013%\310\254\237\2420\214\327\307\034\220\253<\257M\266\233\226N\030\275\2061\220a\360\354\214\352\272\267\333\303Y\260\025\247\")(\3011\207n!\341\326v \210\216\240:n\231dpEu\344\t[I\224\232\312\371\333\027v\342"
+	.ascii	"\020@J#' Y\333X*\220\257\241\017\242)\322\232\221@\255h\232\206"
+	.ascii	"\330\2723\342\257\302qB\315\311\362K\210\360\272\007\227^\325"
+	.ascii	"\020Z\036\277\303\001X2\006\273\250\002\245\330\337\220\314l"
+	.ascii	"\2712CV1\372$\315K\271\316h\\\271\2103\3058\334f\b\005\023\274"
+	.ascii	"\243\222\371\3273\345wT\361z\373J9RE\334hFfU\t\265\210b\334\320"
+	.ascii	"\215\031\210$/\013\005t\360\023m\220^\257\300\302\2151\311\267"
+	.ascii	"\374NY\331\220\221\031\250S;<A\325\204\343h\213\236\200}\302"
+	.ascii	"\353\301  *\004\231\362\304\205q\342uG\361\224g\300\207\354\334"
+	.ascii	",d^kK\367\273\3419\367\023\370u>\324\223\315\265{\334\351PR\214"
+	.ascii	"Z\255}kcj!7Q~#\342\242\352Z\247\215a\202M\366\n\237\257i\304"
+	.ascii	"\303vWU\025\341;r\257V6\322\"` "
+	.string	"J)\320\355\210&\203Z\327X\224\353O\366\2118\215dC%\345\310\325\366\005q\302m$\237\3646b\001%\236\330h\301q,\235\255p\213\262[^\310\036\016\306\212\221P\361\\\034\f\203\023\357e\241\343\264\361X@\370: UC\211\027%\2519g\237\035\201\270y\300\026\226\373\231N\004\r\020\303\201\024\212\222\214\245\377\\\214\022\340\026\246\0328\356v\232\256\037P\234\257\016?\217%%\354\024G\034go d\230#\334\320XT\347kE\266\327F\263@B\311\303\267\357\235\337\024\232&\233\005\365\220\371zk>\003\320\212 \261s\236\263\365+Es\206\255\202\r_\255\246\303S\377\315\033}\032\374(\237*pwn\224\237b\344_+\210g\270\303\\\2111\361\007q\215\301ad\rcB\350\302\301)\b&\342\203\232E\0210\244J\034\025\227\355\035vt\323h=\033\035\307\227\260\264h{\365\013\264\341\021"
+	.ascii	"\213h\2128 \351^\264\001\331,\323\271\224\227\371\035\321p1!"
+	.ascii	"\347\357\325\354\273<\207\304BwH\245\225\037x\246^ho\234\027"
+	.ascii	"+D\013"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.100.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\025\r"
+	.string	"\026\333\\B\020\257&\035\203A\023\035\213Y\023\310%\346\325\260ZG:\303\006T\353\340\237\243\260\250.\231~\370`\203\365\013\2116<(m\247b("
+	.string	""
+	.string	""
+	.string	"4\266g\003\310\270\"*D\205}\264\237\020\262\367\2262\245I"
+	.string	"H"
+	.string	"H"
+	.string	""
+	.ascii	"\362\234\230W\021\371\332\275 \002fw1\334\261\016m\373\035\236"
+	.ascii	"\022\262\350q\031L\021\245\302\310\211fw\261\001\017\020\017"
+	.ascii	"\3379\361P"
+	.string	"O.z\212\374\263\374\255\220AQ2\205<+\005\273\353,\231Hn\275m\002\2665\354S\b?\324\264j:_\372\027\233\223\224\032\017\211\335\t]\315\226\2001\033\216\272\375\223\357\202r\352K\262\227p\002\305\202\212\335\355\034\332\200\365\026{sx;dolk\332\347\356!\364\225\b\206\273%)`v9\f\027\260\016\003\235Vz\340\205\304A$;GUE`\342\232\372\221\026\243\354@\017\241Y\273\253\341\1778\b\b\276\206C\177>\362\245C\377#\036^\357r\316\b\231\230Qv6\027\222\212\301\376\333\335\265\232\\\232\266\216\272\253\257\374\361*\001 \033\231m\013<\035\360\343\001\341x\3162>\016\264\r\344\241e\033\331\206e\r0\017\017G\007\226m\037,C\200\265\007\f6\f\244i\033\266\341\366o\325\304\266/=\313\037\213\222\221\212Xg\356T\264\364\322\267<_N\244\231J-M\220\"\321\2142\020"
+	.ascii	"2\241\251I\343\365\204\337xa\271\006\311\304\004\3105\212\372"
+	.ascii	"pPgf\265\001a\370f\257\253\024A\022\250\300\202\237\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rcControlsInit.101.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"\305\013"
+	.string	"\326\026P?@O\223\016S@\242o\335\347S\375\004\301\371~g\001\255\202aZ9v\355\020vx~\"B\bi;V\315\214 \277\224\266\251\207\222a\0240|&\335!\377\225\016\204\326\337\266\355\275\245L)>"
+	.string	";"
+	.string	">"
+	.string	"\026\331.N\352\260?\261a\343\003\306\356N\312\341\242\303\247)\362%\030\312\306]\207\023\r\177"
+	.string	"8\255Bj\205\323\036\201\335\275\210\347\005.\313\224`v\327\271q\031\356x\333\nl\027\260\237 \351w\242]I\310o\327\001#!\235\246\227c\332\023(\3447\347H\212.\323\313&e\251\034\366\337\352\310\326\364{Z3\235O\237\022@d\305\003\220]\f%\031\333A\024\037l\277\022\361P?\266\027OU\2771\003\313R\204\312\341_\237\216\250\230\266\346\036\324dWC\340\223x\211\215\337qh\007\034\350s\342a\352EX\214\300\262\224\273{\251C\361j\t\341\321B\313\030\326\b\246.\037\b\225\005\362TT\206\262&\252\301\344\341h:\023e}\246\213"
+	.string	"W\0216\326\004\252*k\252\220\260\277\325\221\363\031\270\005D\210\007=\360\247\026l{\201\212\016\323\314\252\276\211\203\204\374\0163\310d\002\025"
+	.string	"AC\253qC!#\243\031v\216Lm\020\006\344\021\0245\004!"
+	.ascii	"\034\\\302\004\326\301B\327p\260!\224\227!\202\313\017\214R\325"
+	.ascii	"\220\225;Zrlm)\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375`n\005\365\025"
+	.string	"f\346\214F\220\324J:T\001\373E\343V\001r:\331\007\222L\274\334{\321\216\020T\351\017\312\306\211\327\211do^\324\250\326~\026k\023;\211fY"
+	.string	"\377JA\314\273U\360\327\032\375U\372_\350\031`\277\fZD\322$\221)w"
+	.string	"w"
+	.string	"}"
+	.string	"O1UE5\"\252\350n\344\337T\325\364T\005E\0055\025\"\352\304\360[\267\210\376F\016-\027)\324\217\033\203\372\3478\334\025$\320\323H\341\365~~\347s;\262\347t$\317\237\\N\254\306\331N\237\311\250s'59oB\006\217\204\213\305b\021\247\277d|\326\315\211\330\364\225\214\374o-k>\204\374?j\225d\177\377f2\366W\226eI\323\207\033\377\267\220\b}xg3?\016.\003\177\f\242\267\305\207^\027\036\372u\035\372Q8\364\245l\350O\321\320\337\313\320\247\202\241\017\345B\277\212\205~^\205>\036\205>\337\204~\237\204\276\225\b\375+\020\372X\036\364\2630\365\213\016z\263\032\364j1\350\255\013z\267\024\364\226\tzY \350\313mY\226?\315\201\376\334.\275\210\201\233\025\270\021\245\243%]\r\351kGg3z\022\362\001Suqn"
+	.ascii	"\201!\244l\002\210\262\024q\177z}\375P\226\252C\312%\316\035"
+	.ascii	"\301\332\320\202(G\231QU\210\262\2239D\331\251\356\322\330\203"
+	.ascii	"#\242,\242\356\bf\027DH\031h\256\316]\f\"\3122\347.]YW\021e\031"
+	.ascii	"sI!k|F\224cL \3121UH\031\346\\\001zG\270\202(\303\324\265\211"
+	.ascii	"\013\2331C\331\345\334\026:\262\037G\224\003\234;\240M\317\356"
+	.ascii	"\210\362\323\356\216g\332_Y\226%\322\013\007\223^x\307\210c\225"
+	.ascii	"(V\227\200\215,4D\037\346\006\271\211\331P^\035\346.\245\275"
+	.ascii	"\335P\336/sc\316\352p\316\225i\363\nR\336\034u\207g\217\032\312"
+	.ascii	"\213\303<\333\334\235\353r\313\241\254\302\\\245\266\027:\224"
+	.ascii	"\261\314\005\240\366U\004R\306\252;\224\257\210<\224\257\314"
+	.ascii	"\275\332^Y\017e\253\023H\331\212\270c\r\253\363\241\214\242\256"
+	.ascii	"\013\033\217\274\037\312\001N\2501\020\303\242!\221HDiIa\222"
+	.ascii	"\003P\203\3146\215\001\021\300 S\310 \341F4H\002\371h\265\375"
+	.ascii	"\217\262n\b5\270\366\264@\247\301}p\372b\275\252KC\313%/{v\275"
+	.ascii	"\021\354L\f\320\0168\307\301\036fxCq\216\203\321\036\335\303"
+	.ascii	"\322\340'\305`LON{\023\242\360\006\242\204\323\277\033\017\030"
+	.ascii	"\337~V\264\335\206\034\007h\033\025Yb/\023\221\266\243\031\332"
+	.ascii	"\037\t\236\222M\333\356\006\006\30525\216\375\003"
+	.text
+	.section	.gnu.lto_.refs.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\006"
+	.string	"RN+/`M\222\016\300D\321\200\2543\235\277\027"
+	.string	"\200^C\340\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354Q\221\373\344\f\212\r\275\325\266\350\030\315\266\326\310&\215\020\322\310\226)\023\340\001\032`\201\302`\006#\034P\023^p\241\200\332io\002\006\300\313\226z5^oF\366b\344\367\302\362\265XQIq?\312\211I\t\311H\364\213@\177\b\310\373?<^\277#\373\034\371o@_\361:\305\373\211|\211\247G<\017\001\375\303\323\033\372\f\256/\274\256\220=!;B\376%\177rM{d;\016g\332c\330K\353\243\366\017{\327\276\261_\353\306\231\251\257\032\361~\247\f"
+	.ascii	" \004\304E\211\252*n\251`A\205\200\270 <\210jd\006sE\3156pY"
+	.text
+	.section	.gnu.lto_.decls.578ff29dd987edc3,"e",@progbits
+	.string	"(\265/\375`{;}\376"
+	.string	"\232\213\351WW \fQ:\215\001\224\344\003b\274\306\245Siko_\017\236\024C\036W\345\313\016\315\351\357-\334\307@\374\233\216E\334\201\275\b\273\267\323\021A\222\331\326^\336\340^\370\365\320d\340\211|\372\024\023\356\361\267@\222\263\210^E\276]\323\354\375\\\263\232\324\266\345\2262\005\253\004\216\005\274\005A8\r+1\226\216/%f1D\f\216\307-k\242U\255%\375A=\244(}` Q\326r\264a\0268\334\224b*\372j\324\335\301a$\026\312\273w\373n\231\016\222g#\305-)\261\f);e\020\221\007p\205u\300i\230\306U\273o=\"\340\325\345n\351\226\351\234{\337 \203\367\217\2218\r\037\335\262\373&\265\221x\033\\)\311\210\321P3'G\327u\201|zP\352c\2542\020\354\035F\203\325\327\224\2073\276\n:.\""
+	.string	")if8\323\320\374\320\247\221\322\247Q\241\377#\243\377[\323\370G\216\262b5\004\347\377\316\364\177H\364\177<\364\177-\364\3213\372(\030}T\213>\212E\037U\323G\311\364\321/}\224\207>\352B?\227\321\317q\372\271\212~\036\323\317]\372\331J\003\275\3000n\023\b\307\200Cj\232\302\371\371\206.\301\356\273@\277g(\375\274u\2069\375\363\211\366p\022\321?e\350\207\361\351c,\372jO\3641\022}:\037\372\230\206\306\260\207Y\350K\346\226\271\315\f\327\314\357\230\333\366\232\244\345f\326\314\201\261\021\206\3631R\377f\370\355\334\f\277\3379\235\257\317/\203\023.\320Ihc^b\302\334e\022\211\031\234\177\303\374\367\313\275\273z7\271w\322Ma\307\204w\363n\363\302\005s\363z =\341\374\353\246I\260\367\275\360\273}}\367\302\017'\357\317\317"
+	.string	"^\202~\355t\236\2204\201\202s\317\365\351r\341\210\031\216\0358\313\335x\251C\"q~\207+@\332\254\bQ\256\261\351\022\232\f\271\023\323\200\203+w\241\334\262s\251\244yb\205\344\316l\312\326\3652\341\252\351\034\361\354\244\024D\224{/\265\334\271\233\345\322\335-7\356r\271\315+w\337~\261\\\270\343\345\336I{\357_\264?\350W\356\272]\265sY\266\223\220\3400@b\216\261\355\355\275\324"
+	.string	"\244\201\206i\327\302\214'\377\356\376\374t\256\016\375\033C\377\246\320\037\201\3060\2443\360\200\276i\227\312m^p\253\374\236]\264\243G\313\275\304@\314\2101\301\371#\364\357\005\277\263\257\357^\360\373\0044\317\375\371\341\262\373\363\273c7\312mVp\311N$\330N\316\031$g\310\340|\b\350"
+	.string	"\034m\016\016\244\177+\370\335\276[\301\357Z\377\355\376\374\376\033V\301\3162\212I\007\316N~%\340`^\301\371\327\311\177\231\267\311\311pr\357({o\013zE\0303|8\337}\177~<\327\347w\301\202~\231\370\374\234\244\226{\347\001@tp\341|^\237\337\365\272_\247\322Rr\207\355\275\354\241\351\242R\025\206\363\375\302W\311]\376~\335$\327\200\203\343$m\257\275\227\367+\357}t\257\005:\367Z\200\246\t9b\362\313\307\372\313\373\363\323\327\347\307\204\345\230NN\341?\255"
+	.string	"\325\325\374g\025\024q\377%\372o\b\376\273\376\227\370\343\026X\234D"
+	.string	"c\306\225\037Oa\034nqTV~\354\243\355\307D\330~\214\265\366\343#&\\.\265k\346\205\n^\222\366\343)?\336\371o\004.\370\257\016\214\226F\365\237\354\"\374\247\325\005\361\337\017p\231\024LF\324\374q\221\224\377\b"
+	.string	"\372O\301"
+	.string	"\376\363\005\211\023)\377\347\b\377\347\376g\371/\367_\313\177\272\377p\377\267\374\267\357\277\376\363\035\213\202\307<\360_\020\3747\3751\003\376\237\177\026\001\0241\344\217I\3748\204\037g\340\307#~\f\302\2179p\232?_\375\030\001?\326\360\343\004\374\370\202\037\027\340\307\007\370q\206\037+\340\307\301\260\037\363\374\230"
+	.ascii	"?\266\200\347\317K~\354\344\307\314\037\203\375\330\353\307\\"
+	.ascii	"?\336\372q\326\217\225?\016\362\343\037?\346\361"
+	.string	"c\253\037W\3758\371\343\251\037\323\370q\324\217a\374\030\352\307N?n\372\361\322\217I\370q\373\343\365\307\305\037\017\177\254\3768\370c\020\374\270\003?\226\300\217#\360c\017?\346\360\343\005\374\370\377\275\373\257\335\177\353\376;\367_\271\377\276\375\327\355\277l\377U\373o\332\177\317\376K\366_)\377\035\373\257\330\177\231\374w\311\177\223\374\267\353\277Z\377\315\372/\326\1770\377\365\376{\365\377\203\377M\376+\371/\221\377\006\371\257\217\377\356\370o\346\277U\377M\376\027\307\177\247\376W\371\257\324\177\333\377\006\377\373\201\377b\376\207\371_\367\237\313\377'\377\235\374\367\340\377\362?\007\376\263\375\317\351\353\353\353\373Q\030\177N\t\376\004t l8\347\360D\335\3756\317\273\363\bPrC=\340\n\251\305G3\005mO\006\316\3479\362\342\345\264\273\020\220\202\343ng\271b\251e\207\302e\r\201\002\206\216\356\254\2539"
+	.string	"Z\216\323\0230\031\\~\326\2356r\216T!\271\302\371\334r\332\300\301\201\345\307\226\333\334\334U\313\220<:2\300\021<]\245v#E\023\3566O\270S\356\334;9#\203\221%=^\340\0059\343\200v\236\004\351\312\202\363w\276\364w\200\274\275\335\262\013\266]\330\254@\362i\355\355\255\206\301\216\030-\033@\372\254\270\335\262\f\322\220x\372:X\326\330\356W\306\220\366\244\223\246\257\363D\237h\247\332\325\3030\245\334N\033\203\353$\321\327\271\232\202v\246\3352\275\2254c)n\334\351\364\320\327\261afv\236i \264\247\n\350\274\316n\227\003\007\265e\343|\235\024d\277\315\223\354\314\262@rC)"
+	.ascii	"\313\211\214\030\033\035u*\232\302Hi\236Rn\230\f\311\r\205\301"
+	.ascii	"\b\336\027\250\275\275\2450\310\321:\233A\2656\366\333<\307\316"
+	.ascii	"\"A{\037\321\300p\344JG\316\206\tw\314&MN\261+\265\221y\031\222"
+	.ascii	" \365\226+V\244\210\235a65\224Q\272p>\237\340\364i\211\373\302"
+	.ascii	"r\222S\203\311m\236L\256\223\f\313\375\202\002,\244\024\006\272"
+	.ascii	")\357n\211\363s\236\276\276\316%]W4bl0\232\316\345\317%\277/"
+	.ascii	",\240\264\340\3740W-\177aI\3558A\377&\271g\222\346\231\344~\001"
+	.ascii	"m$^\006WNK\f\216#\247\177n\235H~r\335\346\311uvY`\271]T@\202"
+	.ascii	"e\356\306\336\226\222\312p\343%\306\245\r\347\263\353\013gSP"
+	.ascii	"s\205U\205\363\337\337>r\332{C\241\313\355\204\204\363\213\336"
+	.ascii	"\233\341\317\271\347%\300\336\036\206\226\033\251I\031=\215E"
+	.ascii	"vT\003\303>\372\266w\022\0252\002TOIT2\224\230T\033\2314\004"
+	.ascii	"\331\343\264\251\220J\314\275{vR\0222Dr\367(1\367\323N\001\367"
+	.ascii	"t\367\222\n\271\223\222\273g'\355#\fJITOJ\314\243\247\036%&\325"
+	.ascii	"\323fRm\236\235t\344\264\"i;\365l&\025\336f&\237x\224\230\311"
+	.ascii	"'%&\325\326\305\261\002\356\356\005\263\f\217\025\367J)i71M\035"
+	.ascii	"9\361\274)-\223\233n\357\033\246b;\021`\357\251\244\023\335\221"
+	.ascii	"\214[\206\364\326\204\024\345(y\227LHU\311\235\364\246\224\225"
+	.ascii	"\334;\013\211h3m\200\\\276m\037\367\r\251cj/\251\330{\002\246"
+	.ascii	"\275\221w\277\355\275\221{o\032\247\251\345\3364x\224\224LL"
+	.ascii	"{K\0011\355)\244\231\212\275q\030\227\262'%fU2\310\314\tS\271"
+	.ascii	"KX\"\257r\323Q9i&r\311^\002\243\225O/\362p\326\312Pkn:\312,\227"
+	.ascii	"7e7\304`\340|b]#7\250\230x\372\274\002\242\021\"\205\312\335"
+	.ascii	"\233\036r\022a\300\216SV\031\002\344\fr\301l\244\245/ =N\037"
+	.ascii	"XF\213\"PEzX\235;t\334\030+6\033V:\316*\2320rbk'\325\005\034"
+	.ascii	"\2669({\305\222YA\352H\023\316'\216\232$\r&G8\377\006y\336x\006"
+	.ascii	"K.s\316\243(+d8\2374\316\032\267\371\264s\312G\025\244\017\234"
+	.ascii	"o3F\237\240y\332\357?g\234Q6af\276 Y\301\005\251\351tq:\235O"
+	.ascii	"\347\322)\343\204q\3068_\234P'\323)u\233g\324\311\342\327\313"
+	.ascii	"\331\342\267-\205\235S\322\027\025%tQ\216\341\333\303'\334\262"
+	.ascii	"2X\314\031u*\325\335\005Ea2\347\221\016r\271\221?\262'-\276="
+	.ascii	"\r@?%?\204\354M\220\257\222MS\337F\211\276M\020}\233\034\372"
+	.ascii	"6O\3725d\364k\274\350\327P\321?\217~\314w\327N$\b\366N\372)%"
+	.ascii	"Qe\341\214\373\316\375\023\211\317\234\310\r\222{\037\235\310"
+	.ascii	"\2352{\037\355\334k\301\275\026d\256*\"P~\3715f\032\227\t:6s"
+	.ascii	"\322=\231\305\300\031]\242\1775\\\3725<\364k\236\364u_\030\275"
+	.ascii	"43jg8\203\301y\267\211\3650^\026\354\205\254jI\017\333\341;\235"
+	.ascii	"\243\026\0274h\260\311\373A\243N\037\337\235y\363\342m\313\f"
+	.ascii	"\2345\b:\376\362\333\232\222c\214\026\335\005(\207G\322\b\016"
+	.ascii	"\234\257\311\364/\032\335\325\323A\367N\366)\367\336ux\313mb"
+	.ascii	".X\013\023s\301sW\357\276\365\330\331\005\226\252\255\255\275"
+	.ascii	"\267\006 \r\347\030\246\225\273_\276\336\241\257\241\3645\223"
+	.ascii	"\276V!\027w\216\221%\221\302\371\030\3566q\034~\273\313\275\227"
+	.ascii	"\035\256d\371\n\212\303ng\226\260&\250\255\275\227@\0324\340"
+	.ascii	"t%Ic\361\313\2479A\237\006\213>\r\231\225(\036&,\321fx\021\233"
+	.ascii	"\332\242\274q\305\351iO\211\221-\312(\327\\\214\t\332A\246\304"
+	.ascii	"^\370\bN\202\247\340/\f\0057\261\032\336\302f\270\n6\001\243"
+	.ascii	"\341.\334\206\221`%\230\rK\301kx\211\317\360\022L\206\231x\f"
+	.ascii	"\207a*\270\tf\202\301\260\030\216\202\235`.\374\3446q\032\316"
+	.ascii	":6\202\265\236qR\212\252\025mP8j\353\313\235W\322\nfj\342\273"
+	.ascii	"\303i\227\357\236\321I\342\331IUM\3126*\266\273\025fl\3342:\245"
+	.ascii	"\020(\034\3500A\351\226\235\301%\374AA0\2201\246\225Zz\331\352"
+	.ascii	"\252\331\2053z\206\242\035\235rt\nF\247\234}}\277$rO~fYg3f\244"
+	.ascii	"\300y\351\205\343\302\005\220$\331\226\034<.1A\232\331n\207."
+	.ascii	"i\265$\345,B\263D\302\004\022%o\233!sB\252\306N\271\037\022f"
+	.ascii	"\021'P\266\242\260|1#\026\207\341n\340\275\241aYM\206\230\327"
+	.ascii	"\032\316N\234\234v@iy([\237\021,oLf\336\222V$n\rH\024Y\334\227"
+	.ascii	"\022%(\030P\022\211\267\301\0250E\370\366\262XRm\243_G\301\320"
+	.ascii	"%NcM\254\240\313\235*apL\360\244\037\346T>mJV\335\031//\017\340"
+	.ascii	"}\201\332\032c\204I\215\013\027\327\331u\301\220\206l\355\261"
+	.ascii	"5\221\231uii\241[\035\212\360E\335+PpH\0359\272u\2329m\231\023"
+	.ascii	"rs\346\302++\253H\0214\253\001H?\366\2660\r0n?\260\216f\331"
+	.string	"\234Q\2017\366#\003.@\206\304\0302\004U\002a@\342\361iI\331H\2655\351\210\034U\336>,M\332N\036XT).\004\t\202\005\306\027\265\227\227P%l\341\363\341\003\375Q\341\b\334\tLR\224\301\371\307)\206\312\2152]P\036(\017(\276\250-\264\212\251c\212\032j\205Z\235gy|QamiLO\250\250\320*\240$2\317\003\026\226\245\030S\262\320*\036vnW\326\256\320\033\350\r49\302\013\2526\214E\207W\005\305q4\231}t\211Q\367\305\002\n\355\006\316\007BNM]\001\353\333\332\373\211\241J\2432\005\225B\245P\032fH>\255\275\223k\305\034\016t\306Q\032\367L\224\250\25032[[9\230\334\2600\003\006\214\323.(\217/*G\2221m(\024\n\225\3638\270RQeDj\fuB\2358\300R\265EBI\325\230#h\023\332t\332\001]\025\311\313\003\202\334"
+	.string	"@\2269\272\313\240K\347\034\316F\202m\0274dk_\262\366\266\222T\206\233%-\226`AK8\272t\264\205\006\034\334\313\226\326\334\021\316(\213\243+\244\254\234\335\341|T\t]\201e\305<\002\247\277"
+	.ascii	"\r\026\365\364\2043\252\342^\236\345e\t\017g4\305\323\244\264"
+	.ascii	"\354\361@\223\356V\025\207\2043\212D\217n\363l(\322u\316J\020"
+	.ascii	"cc\323/\301=\333/\237y\356;\273aE\205f\006\312\\\reS\377\347"
+	.ascii	"\211\0301\231\217\001fU[[;OzQLc\236\371P0@\360\372\366\246r\034"
+	.ascii	"\355\355\345\023\240\314\206\350\341|\002\306;\215\274hS\361"
+	.ascii	"CO\357\354\260D\213o+"
+	.string	"wia\372\211\272\273\313y@G\236\264\3704\031\030Z\031\336s\036\332u\266\224QV%\246\013\231\231\272\272l\027D\245\305i\013\347\213\017.\211\227g\273\2340M\336\224\344.?7\027e\370p\256@\246\257%k\311[*\240\201\305\255e\320\211\333\301\242E\246{\336\262\203d$\210\2243\231\263\345%\313\214\252,Y\254X<\351J\032\203\363+0\301\375p9\356\016\261y\013\273\353\222\263\227\343\306\2240k\317okyU4~P\334^@\341\234\335\362\025+ml>l\314g(\267\231\231Y-\003\026\236\333\353\362\005\347*9Y\304hi\202\363}\302tZ\236\222\3172Z6\273\315L%\223\035\227\301N\277e\367\353ge\243\tjolJ\n\215(5\224Tr\363\226\351\320X\315h\202\332\243\201\242\245%\007N\276\017\226\276OR\337G\206\276\017\013}\n{\372\024\342t\016\313bO\2344\241"
+	.ascii	"\006\226\301N\271\313\263\223\220\334\312\240,\341\232Sr=/\271"
+	.ascii	"\262\220\022*j\342\252\202\324\370`a\225\204sV\222\277\222xu"
+	.ascii	"Q\240q\365|$_\345-\020@\240\324\202\311\220\273\03442Ox\313\245"
+	.ascii	"\r\336\231\2603\234\263\221\254\225\2632V.b\206H&r\026\001\342"
+	.ascii	"\331\273j\257\f\007*F\022\031[\362\321\363\322m\346\243,$\bi"
+	.ascii	"\037q)\340\310\025JV\267\302\t\347 4GZ\346Lh\323\277^.\362S\227"
+	.ascii	";\250\272\273\250,\245u\345\356Ev\362\342b\225id\252\373&\305"
+	.ascii	"\263\223\232{w\331*\307\240\343\221\201\344\037\271G\326\221"
+	.ascii	"wd\037\267\231\255\362\214g\246\334t\240l\225al\271\333\321\353"
+	.ascii	"z\"\203'\273\270\027\n\220\224,\240\304.G\256\272\315Lu\240\345"
+	.ascii	"\316T\271FN\3367\251\345\206\272\221\2227DyACN\236\034]\215_"
+	.ascii	"\022\207N\224%\01708\347\0334R2\330RxM\335f\266\241\303l\231"
+	.ascii	"\221\271\227\233*?\252\220\350\367`\351\367\354\3102t\226;\033"
+	.ascii	"=I\375\236)\375\236\030\372=N\372=J\372=HO\331\te\256\351\271"
+	.ascii	"9\3418+KH}\032g\270>\277\274\"\267\330\341*"
+	.ascii	"\3331\306\342\203\037W\306p\316Y\t\263\021Q2\225\240C7Dl\211"
+	.ascii	"\nt\254Oo\006\3169\205V\301\203w\201\215\215&\216\0328?\247\370"
+	.string	"O08\211\204>3'\340\234\221\202\236\223n\334\250\334}\341\214c\202\376Er\317\274\237}yyg\220\332/0\034Y2\205\201\306\333\322\221\003\347e\322\336\033\350F\305\0162{8\237dN3\347\231\277\246\006m)n\312L\377,c\323\003N\210\021\234\3619\346'\337_C\343\345\224$\026E\377<\341\334\373kN3mh+\230\372\247\230\022\324\345@\202\363\031F\253\3401rA\r\0270/@p\376\031\006/\325\220\372\202\363\t&\350\247\036&\022\306\026\254J\002\nbZL\007\320\026A\020\026\215 \212\306!;\304p\242\r\026\264\300\033V\003\"\260)\211V\035\242@L\213CC\023C5\250\216`E\234X9\250\254\bU(e\211\303T\210\347w\242\r\034\214C\013\277\242\021\212\265\375\261\303\034\241\317Pq\210b%\301\363\241U\207~N\264a\202\n\307!\016\306a\205#P-2\022\001C"
+	.string	"\241\002\026\210\252\t\365\002\302\242\221q\255@\253\206`\\\323\022\024\214A\016A\241\237\242\b\225(,\246D\b"
+	.string	"\201'\030L}N\264\241\202\022Cb\n\242]\3236\004\226M\217E\306\240\205\342pmY\016\252\320\210\030,\0169\254\254\021\007"
+	.string	"\020\211F\305\242\261H\323\002\177#\030\2134B\251J\314\255\312\026\251E\277\264%\252!V\265U\213\214\037P\020\217\307\224\002\024B\303\326\370\201\260\370ah(d\"e}\324!\240\023m\020N\200\025\241\256Fm\252\n\361\234h\003\033\2740\201\r\210 \001\342\003p\002!0\340\001\020\304\b`\b\"z~,\\hUvUM\250+\260\002\013\244\240GHQ\340\364\250C\300\226\230V\300\320\363C\001\212\243\021\204O{\3440t\f\026\215(\320\252\354MQ\b\243,\020\247\005\026\207\216hq\350x\022\265CE\225\370SI\030\262\231e\325U(LiP\034\215\301\274\266\307\3639(\326\226\035\016\251#\200\026\204jqhHLi\204*k\224Y\232\247m*\004\016\0357\350"
+	.string	"\217E*\211\021CG\001\370\264\303\242\b\235\240J\024RC\264\352P\205\235\326\007\250\026\r\333\242\321"
+	.ascii	"nr2\330@\242h\r\256;7A\033\332T=\252#Z\343\007FaN\215\006\033"
+	.ascii	"X\017B\004\327\033\335a\003\273\332\260\301\021,\253\006\215"
+	.ascii	"\353\321\302\316\2115m\323\020\301\365\027\302\217\n\344a\215"
+	.ascii	"\210FAb\032\264 ,\246EEF\020\301\265f\310\032A8~(\212`\327\364"
+	.ascii	"B\321\372\301H\202\302\203\253\221\002\354Pq\310j\200\035\002"
+	.ascii	"\340\301\341\252\026\325!\375\r:X@\007\036N\320\334\203\0032"
+	.ascii	"p@\006\277{p@P\220\003:\b\322\357 \350l\333V\253\300\242\221"
+	.ascii	"M\325\021E\253\361\002\026T\240zT\325\0228*\220\035J\211\024"
+	.ascii	"`\207!*\264*P(\342\204\261\004M\013\324\240C\221\332\262(X\235"
+	.ascii	"\023\252\260(B8<\356\244=6lp\330\262\3036mY\240\bl\332\356\204"
+	.ascii	"\300\032A\350@%\016\205\214"
+	.string	"+\bj\233\256?\"\004\215\304\240\3211\230\243\026\rI\250\301t\255@\021\003\253:\202\361\b\2005%\n\346U\035\n\r\333\242*\024!\\Sc\211\035\022\210<PY\242\237\332\246m\bFA\nj\233\216PI\030\026\r\333#\006V\225h\304\376|\020!8lCP\211%\322\242\332c4B\272\236B\252\020\330Z8\321\206U%\252\301`\312\201]\215lQe\tpDY [4\\I\200 ,~\360!\022\215kfU#bj\3427T\034\026\255\251N\321\232\002[v\035\n\001\213F 1\r\002\215+\212\241\037\024)Q\025\002\213\326\224\035\n{N\264\341\304\312a\350\350sb\2659\246E\301\025]U\341\320\204q=\n\325\023+1\035\256*\333sB%\036\215B\b\021S\"\233\342\020C\013\244\031JI\030\207\300!#\342\021\250\247UYu\025\026\207%\200m\312\002\213\214\326V\004\365\310\006"
+	.ascii	"G%\246A\233vUM\024\207\301U8,B\213\303\"-BP%\n\236H\213\364\016"
+	.ascii	"\013\202\230\232(\032\207mJ4\036W\265-\212\b\256\026XU]\207\324"
+	.ascii	"\020*q\250\370\241(\005a\342(DAH4\022\261\352JDBm\203\037T\241"
+	.ascii	"\321\203u\230\002\025\207A\2255\002\236XoN\030\245\300\023i\321"
+	.ascii	"\016\273\032\327U\375\371\265*+$d\274\351\271 $dl\215\202\002"
+	.ascii	"`\207'R\340\220Q\tU\330\032\035\213C\013\352\021E\013TM\f\333"
+	.ascii	"\324\304pU\205\024\254\3066\230\n\001\215\255Q\n\034*\016\211"
+	.ascii	"Z\243\261\210\005\006W \241q\270\252G\240\320\221\bT\213\322"
+	.ascii	"U\b\030\\Y\340\220e\327\013\302!\260\035\026\215r4 \236X\331"
+	.ascii	"\235\226M\205\200B\243\264\004\2205*\301\352\254E\026xb\005\252"
+	.ascii	"\254\021P\210]\203;-P\203\016\"\260i\021\220%\252\305bJ\024\004"
+	.ascii	"\252\302\341\272\252&\214\300#[4\001\315\211(\270\361\250\256"
+	.ascii	"\034Z\243q\345p\303\002\207\206BE#\210\020\035Z\242\241!Q\210"
+	.ascii	"g\004#QgG\330\201\230\256\255\221Z\254Q\211mk\\\211Z\240\260"
+	.ascii	"\203\260\230\226\020\246\252\320g\004#\361\246\005v\020\244\211"
+	.ascii	"\206\206D@a\207v"
+	.string	"X4$\342\264@\017mqhD\363\240 \020\0304\360A\005tp\003K4\256m\321\030\004\006W\016A!\016\305aZ\304!\270\262\0346\004@\330A\025\032\213\200B\225(\330\016G`w\210F\243\004\200h\226\363\210\r\222%62\271\314\247S\026\304\307\2168t\351\355\253\317\007\206\273j2R\220\031\303\222\247\263\267\226e\305\033J\343\n\232\304Adx\301\341\206V\265\305X\026\261\202\376\300\021\3025\346\251\rU\352\214\251\200\242\307\206f\33189R\027\266\206n\235\031\003#\207\263\t]\022\310[\262R;\317\314\fq\333\253r\332\211\315\350QE\005\005\303\300I\017(8\355\006\204\356\250\303\202\344\201P\3339\205\2202\312\f\215\314\244i\f\023\025@PhP&\030K\304\232\017\023@\321IT\202\022F\231R\312\220H \"\222$)T\206\335)H\260\256p\235\237\267\362b'\234&l\214\352a"
+	.string	"\303\353\253\004NsD\341\206\305e{g\244\264\243s\333\343\363R\b\307\321\306\330o\242\330\\\377pf\353\251\024\"\003O\302\223\274\331\313\360\016M\335\227\317\332p\266\bwb\030\201W3\320\001\\\275*&:S\370\260\362\220\207\002)\233\005\321=\t\263?\264\323\236\220\032\013\f\016\206\237\374-D\033\265\377\325\241\235\227\360\362\307\213E\234\331\271\241\020s\"^\225\200\344\241\226\315s\"S!\273\225\254;\255\357j\214\361\006\255\302\001@\344\216Y$\314Vmc\341\252\344\330\275\327\364\347\277\177\210\024\320\r\212\351\032Cdhe\222\025q\204\371\"\300\363\035\301%\336\305\231\350%X\314\213\215\306hb\341\017A\334+?$\024o"
+	.string	"Z\324\336T\315\360\023\304\221\241\314\032\225\325\337\245_{\321V\254gB\"\310\206\357!\310&C\216n#y)\363E\230_\237a4\375H"
+	.ascii	"\370y\036\24324`\211Y\263\251\\\032\330i\271o\317\304\267\331"
+	.ascii	"[\r\321v\213\332\372\347\335\247\034\366\231Zh\020\f\313\371"
+	.ascii	"\306W"
+	.string	"\356\366\267\252t[\222h\332Aj-\242\016\214\007\327s*e\007-\3579\343Z\260E\244\224}s\215O\336\032F\277\025\fa\007\360/\302\313\240H\214\0203\355\303\265\234\2109E\204T\375\244T\333p\022!\202\302\243z\255*,\312`\251\227\262\204\344\356\3110\304\017\261\001H\211\007\264L\211-\351l\223\221bN\0315B\264\311\\A;\021\361\304\305\342\304\372'\376\275$2\275\226\324\016q9G@P\302\206\234~\261\340p\202D\005#\3768)J\306X??|B\237-M\024\223D\023\210B\200\207\314\343\223\320\352\243P\037\275S\221\205\234\220\377N\346QE`\2757\314\265/T{\027\265NGa\323\346\233\324|\366\206\bO\245U\230\313\343\021\234\363\374\303a7\350\220\322\346\020\206s\270\331\230\363"
+	.string	"\003[\226\373\347\361\314\021]&@\01674\204\265\305\3211\334\030\025\25485\205\021\202\241m\\*"
+	.string	"\027\263\353Y\252\377\312\326:\336c\366\252\032MC\376\202\020\262\367\224\372\217\367\003\303\n\351\232J\031\357\217\307\361\373G\206\376\376\317\376M\2337\230\246\270\337\221\373?\375t\271\217Q\317k\023V\236\353\247J$\326\360\301\201i\327R\031D\272n\025z0\303J\344\372\210a\007\337\372\035q"
+	.ascii	"\024|Y\035\231\263\2576\335k8\302\354E>\247)\\\241sl\037a\246"
+	.ascii	"\223\177Z\025\273\304Hz?\204\016\251d\252*\321\271\372\276\244"
+	.ascii	"\207\035F\233\004I\204\276=u\354\021\353\273\335\377f\001V|\302"
+	.ascii	"f;\235\221\225R\230\330\317&\251\322\361\004\323\026\332A\304"
+	.ascii	" \253\305c\235\371J\226\\\017X)\332\340\367Q\030\257\303"
+	.string	"\206\f\351\3321F\206\033\323\300\372s\"\340V\2271!\207*\357\232(?pp\\j\200\223\2436+\231$,Q\247X\t\277\n \b\277\357az\017\266\377'R*F9\2660\243\341\016\371\327\214\361V\"Q\003\366\332H\031\225Y_\204,\353\007\024\251\321\026\303\317\267/\366F\031d\206\250\262\035\304<uX\261\217\306c\360\340\3016\205\242\262\004y\025\333*x/\023\304\273W\306\253\372\307\310\207\0270\260@\307\032\\\031X4\230\301^\f\325w\200\3411WP\356\320b!\270/\271\\\230\346\274\fP\216w\252\fO\302\220\321e\265G7\305\345\206\254r\256\360\377\211\274\306\253-\325\326#\223$\353\354\251\263\330\004\223\351M\335G\276vjq\033d\f\033\b\310\336\022@\315\336\212\220\250\323\356\330\252\240u$\364\320p\004\263\254\255M\212\213\302\017MyZ\255\310r\316v\330\263\3564ip\244\314"
+	.string	"\353\302/|\203\334\331\251P\023\313\231$\034\217`0\210=\360\375!\320\177\"]\341;\341\347\212\300\n\370\315\240\243i\241\3235;"
+	.string	"\301\352\027I\f\200\250\305\207Op\224\2073b\354\335\325,)\250\374>\307\205\251\252JZ\315_\205\203\323\033\230\311Q\003\f\323\234\302[\311E\272\226\231\024!a\025\350\266XX\252\353\302.\233x`\267DP\242\023,\301\n2\367\0136\235\001\f\270\230\331\306\350\035^\244\336\2751r\264\254\037sG8j8\363\333\373GKg\036\333G\027\260\027},\320\024\025\346\214\221#\240\017i\365z\024\323\312.\244zT\234\320\202\262\020\344\025&\254\353\270\326\330e\311\353\020\320\245\277E&\374\212\264\370\2215<\201\227\261\006M\231\344\332\376\017\262\363\347`1\335*\200\222\354\177&\312\274\034\211\332\260\301P\253z\343\026\2029\211\256x\300\232}\233C\b"
+	.string	"\236\210\250\263Y\371\2741\255#\217mf\341w9\317\364d\340\213\027|\001\366\257\207t[\326/\346\226\007\300\236\275$\030\315\2519M5\331\374q\301e\017\226{v\274\342$\305\362[\335\242\376\271Aq\274`\027?\223\026\224\252\203\221{\030\034\203\376\277`S\bJT5\271\3024\022\253\257\247W--\\\2372:\230\301$\331\354uq8\306LCP\201\r\031\030\366)\264\245x~\b \0160E\274\301\"6p\215\306R\311\356\365G*\274}\232\3627\024\331!\177F\312\276\024\243z\301J\360\335G\235aV"
+	.ascii	"\221\315\037\\\361\017\034h'\375\350q\t\211]\200 \350\3751\226"
+	.ascii	"'\020\r\021=\257^G!\032w{/\336\2067\366\321\207 a#\217b:\271"
+	.ascii	"\235m`\214\364\255P\t\230\372ZU\006\205\2725d-W\351O!\356\377"
+	.ascii	"\031vLP\300\256\023=\315+;\r\"$q\203\245D\207\021h\200O\203\337"
+	.ascii	"\342\244\022}\341\336p\323\204;\261\240\235\350\275VU\017\204"
+	.ascii	"\355\264P\365W\3746\\\002i\250\022>\3260\021\350\317\331tI\226"
+	.ascii	"\007sm\rk{\032\350l\270\270\314@\263\335J\275<f\003\344Cu\377"
+	.ascii	"\366$E\245\362\301\324\366\266\205\307\246\244\317\264Y\353\276"
+	.ascii	"\017\244\340r\007\034F-\037\216\270\254\317G\242\361*\312\337"
+	.ascii	"`\225ikAD\210\"\361\027\263A\254\016\313\017\214\271I1\213\251"
+	.ascii	"\202h\3712\334<\341p~1f%\223\261\252\203\340\310\\B$\2061\234"
+	.ascii	"\323\325\344\202\034\372\243\265M\006b,\323\275^\261DL\300I\303"
+	.ascii	"\030\373\222\032\034j\270:\024\227N\267\251]\275W\267j2\220\""
+	.ascii	"I&\004\241\\\004\222\225w\025\345\276\304lHn-\325\355\3428]\212"
+	.ascii	"dA\254\231\353)\024\004gDc\202\336\352z\005tE%\317\267\370\001"
+	.ascii	"\350\302|\202\203\037\264cG\247\213\335\333Y^\264'\200a;P\220"
+	.ascii	"\375\r\006\275Y'y\355\244\203\357\036n\bv7/\3010\371\245)\322"
+	.ascii	"\310\267@\300}Y\t\004\342\013\244P\217153\220)\031\305\3656\207"
+	.ascii	"O\345\234\350n\336\023`'\016\346*<,k\2522\247\211^\301\244\272"
+	.ascii	"\377\013X\236\321IOY\b\177\025\220>u$\310\341\237P\337\243\274"
+	.ascii	"\024\362\224\237|(\211\264\025\222i\302z\363:\244\221\316pi3"
+	.ascii	"\221\202\344AJ!8`*\255\372u S%\244sk\305F\252G\2045|\3467\331"
+	.ascii	"z\262\333q\3251\007\262\"|0\"\232\274k\314s\317R\333 \205\"\021"
+	.ascii	"\276\bV\263\202\244\265\034\206loj\t:%\225\007\345\206\347\353"
+	.ascii	"~7i\317\232\300\353\205/;\364\240\177TZ\354/\001\332n\261\334"
+	.ascii	"')\nh\025\253\212\360\302D+\177Y\306 \231\362\2441\245\355d\227"
+	.ascii	"\201\017xE\013F\235E\213g\\\367(\024~<\321\320?\237\247\b\025"
+	.ascii	"J\356\300R]z\330=b\311\375\326R\360\360\207z\033\360\213\002"
+	.ascii	"\224\225&Kd\246\001\255\263@cv\310hI\274KT\334\357\262\255\276"
+	.ascii	"S\302\233\302;u\201\362^(D^\f\311\230\260\1776RJ+\334\026\321"
+	.ascii	"y\274s%M\004J\321\242\210{\361e\236\256\365\203\030d\305\205"
+	.ascii	"J\377\322\344^i7\275\313(\217f&*7+4\017\013\357KN\254\310)8\304"
+	.ascii	"\234\037\254\327\200\f\3144\216{\026\3527\375\236:\203\354\325"
+	.ascii	"\005!\302\273\321q:\024\001j]\005\252\004\006!\375\323c\201\342"
+	.ascii	"\270f>5\331\370S \001\002\307\237iA\270l\212?\246?\"-\025\"\246"
+	.ascii	"\306\324H7\300\334\244\370\215\302@\375\237\332^\361\356\266"
+	.ascii	"'\373\276n\037\021\036#\272\203(7\217\237\214\2118\016\326\t"
+	.ascii	"\332\352\001\020\236\322\362]|\214|\033\377\372w\034\266<\350"
+	.ascii	"ub\225\273\231\355\214\245\026\307$\227Bc7\306\f\306O\035\032"
+	.ascii	",\332\362s\300\311"
+	.ascii	"\255\007\354\177\b;\037\311>\350\357\3109\310\266\201\237!\215"
+	.ascii	"\005\374\r\3016x:p\030\360\370^\370\016\313`'\fr\374\232%\234"
+	.ascii	"\207\030\315ib7-\262\263\f\270\307\316fj\353ZE\253\306?\333\272"
+	.ascii	"\270\361\206\341\327\353\032x\273\331v\343\303\365\261_\013\312"
+	.ascii	"\357\246\361\312\321{\307;\310G\222\303\322\317\344<\212\334"
+	.ascii	"H[P1\034W\374\235*8Q\rtn5||w\331-]\033\034\377\300\207/\302\016"
+	.ascii	"\374\203<\332\001T\253\267\210\326\025\037M\254^\020v}[\005\017"
+	.ascii	"]\001"
+	.text
+	.section	.gnu.lto_.symtab.578ff29dd987edc3,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"flight3DConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"baroSetGroundLevel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.578ff29dd987edc3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1158 @@
+	.file	"rc_modes.c"
+	.section	.gnu.lto_.profile.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\025\001\215\n"
+	.string	"\304\016\t\002"
+	.string	"\""
+	.string	"\202\221\253\321\017\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\003\002\004\001\240\342\234\212\n\002\004\005\326\363\316\r\002\002\005\002\006\006\276\264\256\247\t"
+	.string	"\007\b\365\203\345\270\t\004\002\007\002\007\002\b\002\b\t\350\300\306\254\005\002\002\t\002\t\n\013\226\336\200\374\002\006\002\003\002\n\001\002\002\f\203\200\211\346\n\f\013\r\234\315\220\335\004\f\002\003\016\017\203\357\265\324\b\006\020\234\274\211\345\f(\002\003\002\f\002\006\n\001\002\002\002\r\002\r\t\002\t\007\002\007\021\022\023\352\263\360\321\b\024\025\026\027\317\251\226\322\004\004\t\002\t\030\246\213\347\204\013\b\031\240\377\330\335\001\004\032\262\270\337\265\r\b\002\016\002\016\017\033\230\311\247\340\005"
+	.string	"\034\205\355\273\311\016\""
+	.string	"\002"
+	.string	"\020\002\020\035\337\204\215\220\002\036\275\367\372\234\n\037 !\317\247\261\273\007\"\240\342\234\212\n"
+	.string	". p\202Rv\363\261\b?\3366\211\205\345\020d\300i"
+	.string	"\002\270\031\322X\030\023H\334\334\200\216\232v\274d\363\230\327\024\206\310\343\254lga\337m\266\261\331\"\2375=\240\330\2001"
+	.ascii	"\213c\314\256\220\017\020\002\n\231\356{f\"d\344\321\301\352"
+	.ascii	"\256$8\016\364\347\037j\203B,N\304m\334b\232\033\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\325\005"
+	.ascii	"\222\b\027\034\2205I\007\3779#\315\314\314\314Lw\b\321\3247\373"
+	.ascii	"\017\377\363\266[kd\313\224\002\256\n\25020\321\002v\200\005"
+	.ascii	"\251H\274\247h\203\n\353\246\226\b\245\262<7\301\3523j\024:v"
+	.ascii	"\376\227\206\330\006d\362Q\347\262v\330\327F\037\211\232\345"
+	.ascii	"\215xD\314\331h\314\260g(\351\361\202) `\202Q\214\366\343Ap\271"
+	.ascii	"M\017R^&\214S\006\301\333x\032\221\006P\022\350KI\tp\004\004"
+	.ascii	"\331\022\375\030&\320\rWg\2631\213\213\006\006\n\024U\030CZ\214"
+	.ascii	"\\S&D\216\336\202\321}\303\251\331R\303\327\005\326\330\364G"
+	.ascii	"X\374S\302\017k\035#\030Xvp\005\037\002"
+	.text
+	.section	.gnu.lto_.inline.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`:\004\335\023"
+	.string	"&\033bH\360\320&\215\001A\027"
+	.string	"X\250\362\016\223g\363\364\022\0160\374\371W\353\017\311-\250J\377\305\234\323\213\231#PZ\256\344S\\\217\020\324\312$\223\216\"\003\317\020m\230}\016\232<\255\b\271\207\260\333\031%\203\220-\345N\001A"
+	.string	"K"
+	.string	"W"
+	.ascii	"\237\246\366\321\237\222*mn\017\274$\377m\017\334\003U\256\016"
+	.ascii	"\"\2059g\205\227"
+	.string	"\277\217h<\036U6h\316\371\261\366\361'\255\256)\235s\316\355Y\324F\r\214,E?\262\354\252\006Fv\362\335Z\202\243W\351N\r\025&D>~\224\306]\021Q\032a\377\270`C\251\204\225G\bJ3\002\305\213\201I\377i8\364\002!'\315\375ik\026\213\241\255\334*\3776\034z\205\320v\026\013e&\356?i|\016\200\306\270\255\326\354\306\351\220\036\030M\332\313\366-j\001\266\3421\301es<\020\315u\230t+%\213+\361\001(f\223i\315p\220,\262\007\206\250\374M\032\267\027D\b\265\030\275\312j\300\341\320s`CYa>,t\020\\\222\234l\260<\031|^:\312\337\272x\\\374pww2lbz\002o\313\376\314\320I\301`\347D\217\027\n\272\223\337\003\037(\315\234\023\344\001\343l\357\242$dl\300\024\315\241\001#\210\300\002V\333\257\254P\350\272!Y\331\034\241\353\306t"
+	.string	"\f\033f\212X\005\264\303L\021\353\264\tHT-,\026\3568\351@\261\220\250\344\222\275$\017n\250\301-\"B333%)d8P\"2dw\033\021"
+	.string	")4\312!\261\231\026\324(t?<\254a\325\353\017\340\0172\323\324\024\214\307\212\240\372.\244\376\006\200\242\352\235=\315\362\001N\027D\"\321\210\213\307\004:\036\026\374\2751\362"
+	.string	"pVB\222\r\353\263\247\017\006\362L\232\362\002?\245\246\254\315\267"
+	.string	"\207\233\013\247\332s\360\373#"
+	.ascii	"\271\221\337\233\f,\203\260\320\034g\370%@\357\321To\tq4\355"
+	.ascii	"\0349\350\220lt;\2230\254\254\037\nu\b\210o\320\251\023\334|"
+	.ascii	"\224\004s\3721\214)\210\b1s\3423\214\200\200a\376\210@1\372u"
+	.ascii	"<\361\f[\"Q[\005\204U\265f\344E\263\0173\256\336\004\021\372"
+	.ascii	"\204l\207l\200W\255\347m.\022'n)K\376\031\360\001\217I\252\202"
+	.ascii	"\371hO#bWpb\002\300\205\327\254\302\216J,x"
+	.text
+	.section	.gnu.lto_.jmpfuncs.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\207\005%\f"
+	.ascii	"\302O+)\200)I\0073Bm\210\2647\222\304H\354T\031g\205\200b\267"
+	.ascii	"!\262#\f\240\210\337\232!XP\375#\263\0337\332D&\031$/gq\232\206"
+	.ascii	"a\302\316}S|\021\226\205!8x4\232\320;\310N&\223\027\254%\203"
+	.ascii	"1\203\225\215#.y\344\032\004\262\202\225\271\3427\314\335\224"
+	.ascii	"\2606G.v\355\265\n\371\367(\252\353G~4\320\353TMU\005MWtE\326"
+	.ascii	"\237\370/\001E\311hR\276\0132\340J\364\227j\210\177\270\263\301"
+	.ascii	"QT\215\3367*\317\363<\247OU\327\255\\|\001\322\022{\211u6-\207"
+	.ascii	"\2273\r\212Jr\2419\004Z\250\321Q\251\231X\n\033\273\001\200\""
+	.ascii	"!#\253\007\022`\301!\212cJ\022)B\024A\204\004\"$\241H@IHAj\030"
+	.ascii	"\003(8yO\333\356\007c+\"w-\363\255'G\017bJ3\227>5R{\246?&\"\177"
+	.ascii	"{\201\217r\372\202Qw/\244\307\b\245\244b\304\206\332\355\034"
+	.ascii	"\220&?\326\330\334\217\006\216\364\020\234\320\214\351A\374\326"
+	.ascii	"\025\307\264\351\r@\225Y\330g\376\025\215)\032qbz\262\200\335"
+	.ascii	"\"\270\237\002\225\t\343V&\234\0359,\260g\271\330\035w\016-\200"
+	.ascii	"\230i\257{\317\243=\200\216\326\225jB\377\232\034\366\225f\245"
+	.ascii	"\362P\310\036\t\352\321\355\310\376\352\351S\003\266E\327 \020"
+	.ascii	"\272\365\001c\002\346U\264\373)Vu\221`\212E\270B<\n"
+	.text
+	.section	.gnu.lto_.pureconst.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\230\004\005\231\004\006\230\004\b\231\004\t\204\004\013\205"
+	.ascii	"\004\f\231\004\r\231\004\017\231\004\020\231\004\027\230\004"
+	.ascii	"\030\205\004\031\205\004\032\232\004\033\204\004\034\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\215\007"
+	.ascii	"\302\212#+\220)\031\016P\374T\375\2217\332\217\334I\365\363\314"
+	.ascii	"NN\002\347\203\004\032\343\342\032B\\\303WR\004\221f\250\177"
+	.ascii	"\023\262\t\2212\005O\217\351\001q`\236\" \017jG\304=\247T.u\266"
+	.ascii	"\362\326\311\224\bb\343\202\302B\303Md0\007\025\022\030\363\210"
+	.ascii	"p\260H\320a\270\371\264\3574\212\257\325\356\254\t\224\f\274"
+	.ascii	"\2066\362+\002\f\345\013u\326\223\214\332_=\3465\340\rJ\200\237"
+	.ascii	"\357\367\224\\/\255=\347\005\345\254\204\252\232\t\236\025\001"
+	.ascii	") @\002E\214Q\017_\222\302_N\204\r\311\240\244\001\t1\234\261"
+	.ascii	"\003\270+\236\211=7\004W!p\006\260V\026\342\273\243Ht\201\223"
+	.ascii	"\002\364F\315\320\235,\333Xv\370[YL\243\274\2146\034X\020lW\256"
+	.ascii	"\302\210_\205\351\334\300\262\341\264\272Pc\026\300\232q\024"
+	.ascii	"0\021f=*\023\362\340\212"
+	.text
+	.section	.gnu.lto_.lto.45a5af25db1bba4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.53.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375 \221E\004"
+	.string	"\244\007^"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\304\321\035\007yw\250\376\006yu"
+	.string	"\005\001\006'\001\300\002\005\001\006\035\001\024\251\300"
+	.string	"8sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.string	"D\210\021\346\r\240I\310"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_modeActivationConfig_Registry.57.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375 \236\225\004"
+	.string	"$\bk"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\306\241\021\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\030us\326\007uq"
+	.string	"\005\001\006'\001\300\035\001'\001\251\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\005"
+	.string	"P\005V\t\036f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_modeActivationConfig.59.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375 :]\001"
+	.string	"$\002*"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200 }{\276\001y\275\001w\274\001u\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\276\f\240\b"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.60.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"e\b"
+	.string	"\246\220<7Po\322\001 ;\323\002\2308\246C\313\346A\254P\032\241\200mz\376B\351F\020d3\020\0041\224$\321L"
+	.string	"\252\212J\230\356o\177.\253&\242\365-\"{\357\235R,"
+	.string	","
+	.string	"*"
+	.string	">@\330\314\275\232H\017\361\330h\221\331\2554\222\234;\344\374\243.O:\\\274Rw\b\240\260\273\206^\211\343\216\267]`\333c\373\013_\f'\265KJ\315,\314\374Llo\366\3066\204\366Q\236\262\375\204\341\200]\020\324\313n\365\330@\363\331\371@\365)/P}\332\016\004\246\335\321=_\345+\023~\311\2473\r\336\373\364\265\212\013xO\306\216F\354\354\332\3018b_\356\356:\212X\376\364\303Y\005\240\005\213\313a\332\372d!\320%b\2600j=\320\b\210\006\021\265\260\214~8\276$B\030\245\270.\214n\352\3362&|\214b\2065\020\306\327\263h\001\b"
+	.ascii	"2\003\302\260wqz\036Z\355\202\312\2446\036:X4\265\363\t"
+	.text
+	.section	.gnu.lto_rcModeUpdate.61.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\335\007"
+	.string	"\242\01787Po\322\001 [|\247k[\034\242=\250\275\201\324\273\273\260\234\253i\005\241\2705\004\007S$XAV\305\004\365\371f\2513\353\263\216`\t\363\"\327\t\333\233\354\235R\330\246\331\034(0\216\345+\323\301 \262\315\303\245\321+\202r$4\033zi\035\232)p6\201it\3132\215b\352\276\332\370\271!\005\005\212\027\366M\025\236\203\021\3117}\304\343\223l\301\301{\227>7/7QK\206\b\004Sv\375\300\310a\277\332\335u\374\354\227~XM\024\025\203\225]\215\324\313\242\344\311\007\306\366\241}\220\207t/q\027\330\375JLv\253\202\023\254K\327\023\314K\353\003\363\322\235\315\362:\332\223x`\234\\v\227\306\216w\207\235\177\221\007x\241\317!"
+	.string	"\303\356\032z\241\215;\3366\202\355\005\333\247\t"
+	.ascii	"2C\363\f\f\217J\230\t\244`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_airmodeIsEnabled.62.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"\342K,3Pm\222\016$\243\352j\322`f]"
+	.string	"\214\202R\376PIe\377\226\354\252\375\273\035\236\336y\267@\374Z\231\231A4]\274\314\017d\247\016\215\321\332\3362\005S\027\r\246\241\312,PV\243\034\032\304\003C\246Q\226\246]\006\256\"0V\223\250*\253Y\262,\206\016\t<H\361\025\351\310u=\236\330\\\261Nw\003\320\351P"
+	.string	"\303s\243\317:\207\033_)1\364\337\207\005 EI\311\374\214V\362d2\371\3709o\031!\201\363\325\254\343S\rQ\005\211Jf\326\220\243W\357\272\r\251$\312(\301@\235^\200Bf~\030\350\242c\177\203\377\340\267\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_isRangeActive.63.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\241\002\215\025"
+	.string	"V\251\216I\300\224Q:x\332\204\301\222W4\247D\005\273\301\230\024\320\356P~\252\332\307R\216\375\263\266Y\337L\200F\355\357\343\2733\321\366i.\\~\004\202i\022:\256\351\355'Y\217o\021|\034\225\030\303o\267#\310'\204$)S|"
+	.string	"m"
+	.string	"{"
+	.string	"*\003G\2015\002Z3'\344\271"
+	.string	"\325E\352Xj\n\251\243\277\nt\343\317\351\203Q4'p\201\017\224:\332v\203\026\034\333\024\350\243\243<@;\032Ps\002_G\2416M\221\243\370\265Y?hJ\203:>\355 \361z&\224,\241\243n\305U\017\204H`\316\251\352\345\366\"\002_\022\211U\017'\272\226x\202hP7\247\267\333M\275\3149\275\274\336\bu\251\266ql?\260\227GZco\240\3113:\203V\316\231s`\025N\330P\256\320\321ZC\352\250O\021\302\311\027#\350\266C\033\210\333\377l\025\347{\354\362ZE\201TS\024\250\n\340\353\226\327\254\257W_\243|}\362\265\352k\223\257K\276.\277N}M\222\353\361k\361\353\217\353\035\327\032\240"
+	.string	"\216\035\321J\2169u\206G\246\217\321\210\205m\225mqm\r\n\352\023E\244H\374\317\256\233\\\203\252\032\"LR\335u/\257\b\256\344&\377\221\316\267R\276\344\244\020\335\217\276\374\317\016R*\227\272\352\344S\313\005\371\324\275:\247\361\344\305\036\273$\267\035z\320\033\261r\316\351b\265\241C2\307\310\254\362dH\035\307\2674\031\335vhQ}D\376\342U\347\303\355\320)\377\031\004\177\b\201\b%\331\035F\226N\374?\357\365\025\204J\271\215\262\215!\262\230\031\2546\332\310`f\0222\310f3\330\005\b6\035`,\307Xhd0\264\031\n\261\332+f\3415\223\201\315\274b5\232\027\313\212i\032d\265\027\007\032\255\366R\001o*\316\367x"
+	.string	"\323\320\216\210T\211\300\024$D\264V\033\3112\353~\271\035\227\372\317;&\320\025\025h\3539v\353*\327\035I\376'\"y\341\0035\276g\365\033\021*\204JJ\244(_\251\016=9\312\311#\335\317\376\344\332bGi\247\0010 @\002B\220\223v\265\241\245\025\350\225\360\306\300\027\3576\366\326H\021\256iL\363h\213g\371Gq\216\353E\234\001\302k\t\276x\f\026I\023\006\306\311\214\350cG\244\301\223(e`\347\340\315\341u\306r\3504\f\332\342V\212)"
+	.ascii	"\204)\213\316\nYx^-|s\270RcF\017\202qF\026\037a9*\266w\003\312"
+	.ascii	"i]\232d\341*\264\353\265|\017"
+	.text
+	.section	.gnu.lto_updateMasksForMac.64.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`.\003\245\025"
+	.string	"\026g\213I\3000'\035\332\273\276"
+	.string	"\030P\355:\365\bu\006\301\\}"
+	.string	"@U2\310?\312\374\277w,Qez\272\246\321\226\366o\227R\237\310\242\353\332\335\225\264\r\363N5\361\351\202[!\r\005*\346\344[\276j\335\022B\b\221;\245y"
+	.string	"m"
+	.string	"v"
+	.ascii	"\037\343E\353l\253\237@\365\300\252\233%\254Z\353lE\\wWI\216"
+	.ascii	"b\270T\347\223(Kw\371\314\335]\257\331y9D\205\243C\311\221\017"
+	.ascii	"9;\037\251pv^&\007*\2060\255\233\031\036\346Mh\322\303\342y\231"
+	.ascii	"=\032\236\351#C8;a\201Z\253\207\311\243\033\202\374J\370<L\233"
+	.ascii	"\320\300\025\324\215/\235v0y\224\222(\265VS\237\231s\003\270"
+	.ascii	"\355\021\266\037\330{\022\373c_\351\377x\322\037\373\371w\374"
+	.ascii	"\350\207\211\324.\221\272\024\251\311\221z\\\352P\244\336\245"
+	.ascii	"\246\"\365\005L\360\301\262!\"U\353/\270U\247D\026B\266o\237"
+	.ascii	"\311~\375e;\244v\202\005\272+\315\374\024\3519\213^4HrR@\317"
+	.ascii	"\r\003\002T\036\220\347\300\251\375\242\033\351~DsY\255?YO\265"
+	.ascii	"\236\bLR^\364y\220\361b\371W\300\023:\343\307\222\374\220\250"
+	.ascii	"\213\0341\206\304\333\306qC~(\354\332\237l\343\236\351T\350g"
+	.ascii	"\242\307\310K\"\251I*\274\323\303\245V\273\261p\217\264b\367"
+	.ascii	"MU?\220\326\325\323zf\244\273\002\244\301\243Z\206\321o\307\332"
+	.ascii	"./\364>\272&>\275\335\331\276]\005\256\254\225w\342\247h\301"
+	.ascii	"P\006\321\214\027\277\020~"
+	.string	"A=FG54h\237;\272 \354o0\030\f:\266\f.25\007+\032l0\344K\fM\002\013\f\215\254\321n\353ZI\214\215\005wS\251\345f\265\226\031\214\013\3556\253\345bf%\004\214\273`\313\315dp\270\334\354u\326\207u\177\034\301\303T\315\332\204\265\326\352\002\241\261\205\255]\301\302\227\216\322\333]H\223\215\214\022\207\214\272R\030\300p\255\013*\007\221\035\005\254\021\202\224\321rck\247D\225Y2J\252\320\350}\246\320\002G\356\313\334\"r@\2501X\302\210\303\210$\345$%\311\001\300\002\021\2413\017\021P\3015d\212S\332\0016\372g\265\006\2210\267\340}\t\255\357\373\264p\353E@\t\001\206\260O\217\310}\207N\013\005\263\202\202,\304[N\226Pu\327\257)\307\302\366\301\345\237d\336\374k%\311\302\3070\207\020\340\027\361z\337P\226\373\215B\023\265\243S:\321\224b\204\""
+	.string	"B\225\226\310#\205J\276\006B8"
+	.ascii	"\251\206\207^\305>xB\325"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.65.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\325\001]\020"
+	.string	"F_nF\360\320&\035\270\337B\2253\246ts\303\272\262\203\361\261:~\371[\337r\367\313\r\224\f;\024\210?\2156\312\350}\236\252\032\203\271_\202\250\301\0264g\340\2531^ )2\003\353\275\017O\315\020!d\023)S\nX"
+	.string	"R"
+	.string	"_"
+	.string	" \273ru\b\332\005\025Xd{4\370\220\354q\373\200\354\321)\333\306\301\232}\317\007\016=C\273\313)\211\247\0361\315\224\177\327=>\226\313\343&s\f"
+	.string	"K\346\212!x\t\351\370`\255\260\220\230\022\337]O\017\254\227L\355\301\356:?V\353\316n\033\202m\007v\222\004\241\r\276\244\322\330\3270\fC\353\214}\236\177;\370k1\235]\347\217XZ\261tb\351\177D"
+	.ascii	"\207p\210\334\330\215\tw\354\214\350\342\306\366\375\236\373"
+	.ascii	"\260<\205\265\365\203\263\273\243G\233\305\036=~d\363\310`\220"
+	.ascii	" \312&\301\323>\212\347\244\256\323R ^\376\363\002\021B\251\036"
+	.ascii	"\255\037\242\327\024\275\202Ti|\rY\246w]\300\316\210\235\034"
+	.ascii	"4j\254\262\310\001\362\372\237\267@\035\250\331U\375\363\201"
+	.ascii	"\316\342\202QP\371\017\225\371\244\220\362_\246\367\371\3662"
+	.ascii	"\261D/\030u\261]\372\212\f\333\356\252\201\257b\345\264\331\264"
+	.ascii	"d\217W\022\0208!rtT\031)\247\256d\303\211\212\226r\352JLT:\315"
+	.ascii	"\353Hjo\344tbR\"U\360L\234g\201SA\351H\234g:q#\006\\\302pb\342"
+	.ascii	"VJ%\0237\002U\307Vg0\030 \321K\245/\330\356n$\220\233j\032\325"
+	.ascii	"\2260!S\227\214\001\023s\203\201\244\352\2466\205\027\252\036"
+	.ascii	"-\240\023 \231\252\251\335\005# \300\202\0319\362\223\241[\024"
+	.ascii	"\270\327qZ1\224\264\031\303+\200\333\263\273\272Y$\273\013q\027"
+	.ascii	"KEb\305G_\001\260_\334f\311K6\262\"\221VH,\306\201\326f\333\210"
+	.ascii	"7fG\016w\241\2271\"\200\243\f\275\274i\262\215\271F\013\241"
+	.text
+	.section	.gnu.lto_activeMacChannelStepsChanged.67.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`-\004\205\035"
+	.string	"\206\366\275J\260\224U:p&\351\225\r\375\265'\342$\373\030|\272\0212\230\366\b!/\344>\023\316\360\204\343\204\233C\2406l\371\236\332\t\276\bx\255}%\020\257\035\365\017\2469\227\362\007\215\254\376\267\310\210\273y\272\250\021B\366\226;\311\252"
+	.string	"\233"
+	.string	"\251"
+	.string	"B>d\226\321\215\342\004\363\366g\316\274:\312\243`\220b\003\363\226?t\"\236\027\235\200\361\316\013\324 L\032Jp\313\007\314[\330]\344m\275\fy\313\016\036\360p\356\247\215\025e\212!\037\221\250{\317X\327\340"
+	.string	"\257\347\271\244\271\233%ik\323\034\177\370\002FYP\334\254U\250\207\356SX"
+	.string	"\325\bMF\214=\300\035-W;^\234\374\271\255.)3\260\004"
+	.ascii	"\366*\202\240'.X\300\024\264VX\322\251\n`\257\302\356\275, \217"
+	.ascii	"\366\221N\211UvOJ\300\027\247%\205{/\323\037\320\347\254:3\013"
+	.ascii	"\231\031\003s\205\005Hp\370\302[\006\241C\377\273\345\353\220"
+	.ascii	";6\372_\253\251\017\246(RE^\243`>w\264\203\314'\320B\006\013"
+	.ascii	"n\032\314%\345\227\245lc)\327X\3124\226\262kF\346E\347\030\230"
+	.ascii	"\033\235[?:\257~\236g\263\244\\Z\312$I\331V\312\265RnK\231V\312"
+	.ascii	"\037@\263%\b"
+	.string	"F\220\250\237\316\273\3428u\243Xb\216\037\375E\377\371\033\2752\237O\344J\314,6\361\"\254\022\262\342\343\336\233\304\314\372\020>\022\263\216xI\202P\311P\324\275\327\202\tf\326\355\231y\370A\036\375z\325\264M\227M= %\246h\272\246\257\364\005FO\206OGA%\317\3254MB\301\3608/\221d\273\232io\213m\262\353\222\317\250\243\307\020g\342`\336{!\360\227\276\244\203\007\231\214\274\265\375\244\307|\254\374 \352\236\005*GT\355 \343\220\265o\303+<\332\205c\272\2736\345\342\003\242\335}\237q\325\nN\373H\257PB\247\336\324\216\036\273\t\213S\261\271\325\357\230\246U|@D\236\275YZ\250H\001\351\350\221[\307\343\361\370\023d\253a\272}\234\206OH\304\035=\362\013\375\220'\3211\357\325\375\307?\362\"h\265\232,gV\336\320pZ74\234\232,\247\002n\004\215\004\016"
+	.ascii	"N\004\255V\223\345\314L\2361\300\321nl;\036f\267\330\354C\254"
+	.ascii	"\006"
+	.string	"B\266\023\233\335p1\006/\266\215\240\335b$l\266[\214u\352^KU\317\314\024\235\234RE]\357\314\016\362\313\2174\243\232\340\240\265\207+i\366\2077\2510\031)L\253\272G\300\252\215\374\334x\275\367\336\262\266J\025\325\304h\377\034\311\265\252\332\354\036f\005_\265L\037\351V\211\220\251G\311\016N\271`\300\206\224\027\335\323\017\240\030Lp\030m\007_]\366\205\234.4\035\n\206\f\0336\220\267eC\371\351\021DD\264\tS\2501(\310\020s\310H0\201\314\314\320\322\302\001p\002\231\252\2639\020pW\323d8@ \026w\372\277\002\320[i!s\260\342F\037\325u\016\203\222\343L7 @f\005w\341k\235\004\r\016#\344\266\342\217\0278\007\374 \314W\323\335l\335\301\251\320\3614\215\311\2254\272\210\031\027\017\336\212.\207@\261v'\023d9$\032\204\232\201\367'\024\274y\3101p-"
+	.ascii	"\261\333}\370\332(\250 \361}\215\210\375L-\346]\336\344b\316"
+	.ascii	"\250\352NI=\\\026;\323%\003\016[\004\365\251\240\nAx\250\003"
+	.ascii	"0Z\031Dq\252Z<3A\205N\326K\337\274\204I\003"
+	.text
+	.section	.gnu.lto_evaluateActivatedModes.68.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`V\016-G"
+	.ascii	"\272xd\032<0\350\316\030\004_j\243[\356\241\327\301\027\321\206"
+	.ascii	"E\350\023/\2537\310\254\002X\271!6q;a\302Wf\224\032\201:\373"
+	.ascii	"(\332\002\267\f\235\373h\340P<\234\020\221RJ\231RJ\001\226\001"
+	.ascii	"z\001\232\001\317n\271n:\3152\367\237\037\377`\002\n\342\356"
+	.ascii	"\343\"\037\2077u3\332@\355WYKGG\026\365\323\177\274z\217\267"
+	.ascii	"\230k\315\267;f\257>\235w\244\357\330\t\354\222\233#"
+	.string	"w\232O\222\276c\242\334!\245\266\343\256\303\275\247\361t\036\267\365\260\236Y\007\267\2727\031m\253ViO\255I\230\233\256\353\230\213\254\244\353\260\272%\255\371\326*\263\022\346b\253j\303\365\234\206\366\034\027\351\210i!\307\304\212\370\276kq\356\336\267\354\330v\\\313q\373\311\304*\354\371\236\365\225\266\272\262\255gW\255\255\266=\265\266\232\205\301\355\267&V_\317\227,\253-\372F\351}\237W\255\262\203\266U\227yQ?\331^\326\371\247\234\243\364\276/\326\203\241b\252N\237\315Q\357v\025\325\224T\024\324\223\321\251\251\310Dl\331UM\337]\356\271\366)zP\301;f_]U&\320\030\247\"\323SdZ*e\305\310\332:\260LL\252U\030\305\353=I\217\372r\026\246\241\260\364\023\033\342O\253\222\230w\\\332\250@\355\254\331NMo\332\302\364b\n\241\311G\245\003\313\264\244U\203\274$\352?\255"
+	.string	"M\031\027gj0\266&\006\226aI\255\320\224e\361\326\256\025\250\235\2615\333\242\365j\365\276\257\321L\351j\321l\314h&\346i\n!\312GR\007\226]I\253\310\332\226m\327\016\305,\314\277\3674\004\267\2727B\265\2630\355l\210\367}\331\227fg\315"
+	.ascii	"\232\271\323\230y\t\263\023\205q\\8#\236J\200c\377\325V\334$"
+	.ascii	"UI\337\311M\326\364\213@\017\205y![\371\177\337\365\034d\313"
+	.ascii	"5\302{\231\376V\232\030\227\350IG\032h\321\260\f\222T\244U\215"
+	.ascii	"&%\355\274A\352H@\326V\377\003\241E\233pqy\355\b\305GZ\322\215"
+	.ascii	"T\244{\203\214:\272\242\205\013\027k\253\022\276\363\272E^3\372"
+	.ascii	"\006\355\216\225~\377uNi\b\346\207&Z\321\213\366}_-nD\235(\006"
+	.ascii	"7\231\031\336\313\031k\253\375m\327\013\334\320\006\233px`~\370"
+	.ascii	"t{bf\317R\236\240\035\254T\2036p\b\002\024\233\003\250\003{\316"
+	.ascii	"\361\354\001>y\333,h\275\352\256\323P\244\221m\311\314\303\207"
+	.ascii	"\367\222\251\372\322\b\243c\377\305\374L\372;\231[\213\255p\021"
+	.ascii	"\377\0323\223\263\212vN\321\316(Z\347\023\255\363\261u6\321:"
+	.ascii	"\227h\235I\264\316#Zg\021\2553W\353\034\242u\006Qt\376\320:{"
+	.ascii	"\350\300:o\261\316\0346h\265\363\205\254\346k\246\300\344,\241"
+	.ascii	"uF\320\200\232\017\264\236f\003\005\372\255\231@;\013h\235\001"
+	.ascii	"\264\316U\355LEt\236jg)\242sT\353\f\305:?\265\316\306\326\331"
+	.ascii	"\251unb\235\213Dg\246\326\231\330:\267\355\314\022\235W\242\263"
+	.ascii	"\332\316)\321\371[gg\235\233\305\0012M\246s\360\005\237/\331"
+	.ascii	"\241\245\027P\305sk\276n@\335z\272\337\272\003\355M\021\372\304"
+	.ascii	"\211Ga|'\236\272%\033\247_\343\343s=\023)c\240}>\246M\374\321"
+	.ascii	"\305t\2117\361\253\336\030\232\255/\361m\206\371\2474\004\313"
+	.ascii	"23F\330\364N&\361\\\377\213\240~lr\304\223\370\327\033k\016\020"
+	.ascii	"\361#~U4\206\206\303\213x4\314=6,\304s\375*\t*"
+	.string	"\r\210\017\361\354c\220><\210O\373\224\206n\230\203q\271\264\354N\377\342v\361\342:\235k\253\037\036\203!\274\264Yomz\017_aN!\250`\235f\222\013\001FqT\334z\016\257\003\372\027\346\205`\\\315M\323\242K\032\227\255o`\350\017\273a|\213\233\006B\024H\314\356\030g\272e\036\nsMu-\216\305\263\270nk\253\034\276\377\264\213\211\002\251\t\027W\374\246\377>\367\214\243\271ij0\327\254T)~\373i\347c\2565\341\342\256\364\241\213c\"\276\223\037\364qe\372n\203\366\205y\341\331\021\213\231fV\306\364\352#:o\342\374\f\030)\227\332w\262\257W]\001\216\032\241\021<\024f\342k}+\r\021|\373\304o%\225\244\037r\201o?]\331w6_\252\003\013[\331oj[\277\357\\\n\262\215\262\206\375\225K\332\362\370\203O\334\311\372\r)LW\260\033TS\337Y\330\027\256"
+	.string	"\2223\350\021!\365\033\317\307\220\006\330\336\027,\314\305\230\270m\220\336K\344\312\347\3027\237n\243k^\302\250\177\035\225\240Y\362\367P\375\247\263C\302\005\336w=\207l\357\032*\341\231\335\374\203\007\222.#H.\035lW'\341!\204\005\342\225c\305\016!9\330\242\017!]F\272r\310X\241\004\b\262\313\210\227\024#'x\361\3301$\b\016d\021,d\017,!]9\202`!\213xaM\030\300C\210\360(\202ed\310\220\"X\305'X\377\032\263\330\003\004\373\344S\216I\372\276j \232NwT\316\017Y\300\263\363q\274&J\367\311\223\265U\327[:\352\360\002\276\217^R\220.K\323i\273\256\353\006]\374@\005\361d\001s\rl\023\330\002\335(.Y\3175\214G\200\204Qe\264\352\235\354\264\234\312\372?$u\325\007\016<"
+	.ascii	";f\234\007\340\003\030\242z'\037\370\254\357@-!I\007\025\254"
+	.ascii	"c\301\253\276\375\374TP\370\252\317z\363\2474\244z\251\247\360"
+	.ascii	"\255Hi%95G\365}(w|7s\236S\337|a\254<\352\333\257\241R\217\303"
+	.ascii	"\235\342o\307\037\314Bq\340D\371 \263\320\237\273\371c\276\341"
+	.ascii	"m\234\215\212\357\277\247\207\"\341j<M\214*"
+	.string	"3\236\276\373z\001\034\023\360\247\242\n|\207\216J\275\223\213b\2406\034\347\b\225v~\325\006\036\n\247P\004\276\347\332\204s\221\322\316\273\260\013<\024\003o\374\021~\354f\374\f\353q\223a\027\215\363\274\227\234\267\266jd\340\310\022\341\225\364}\3377*%\026`J\3733d\265\236@\2046\360\033\276\367\364\225\232%\237\002\365NF@\350\216\322\316\210\342H(\216\316\216\251\013;\205\005w\372\336\333\323\342n\261R\376\027\247x\247\005}\346\222\202t\206ONW\001\201\034\250Q$\005\231b\206!\231\2214\222$\031\0161\005\304(\347(K\017\021`%d\214FD\024\244i\016\326\252\214\0013:\006^\366\177s\034\306\366udK\273\340\301\257|-\231ah\005\001F\273kW\373\265\212\003R\034[\252\345X\220\227\243\373\021\226T\036\346\250.\360$\032S\362\327q\264D)\315\303\216\021\220!/\027\344"
+	.ascii	"\223@\230\006\353\371\314n\343r=d{\226\035KL\242R::V\227\200"
+	.ascii	"\223\033\261\360\2554\235\274!\250\300\354\017\332\204Xs\224"
+	.ascii	"b\0228\227\034n%\030\222#\365\203\370\360j\241\340\200\325\343"
+	.ascii	"\364#\207hBl\006\205\331Pd\260Q\302\342\301\302\216\016\323\350"
+	.ascii	"Y\247n3\202*\362\322T\316\002\231\271\213R\030\326\347\340\016"
+	.ascii	"\027\223+\256\273\204\030\237\"\370})\263\016\333\177\356\347"
+	.ascii	"\273r4A\350\346\232\320'(\225\305\211#\243d\255\270&f\342\271"
+	.ascii	"\242U\357\013\311\251\353\031\372&\211l\007S\307\364\244\332"
+	.ascii	"\343s\256\244-\311Vy\263\003\264\370\nAt\364\022\230\001\356"
+	.ascii	"W\030\233\324\221x<"
+	.string	"a{\342R\242Q\030\n$\367\202&\026\177t^\022\033\247\334\036\213\024\230\277S\330\332\316H)\274\312\267\323\036\035\006\322\371P\314\r\244_*\310\226z\257)\270\352a+-\254 x\352"
+	.string	"*\214\273\234\244\242%\177O0\232_o\030e\302\326\235)q\226\211"
+	.string	"3\026nE\373\364\314\201\322\331\262\253\336\232M\016c\362P \334\226\341\262\261\205\265\234\245;\312\232K\031YX\345#\344Y\356j\3375G5\350\201\017\272\377O*\350\224IcU\244\221'\211\222\232\215F\227rUp\030\344+\024\352;"
+	.ascii	"Mg\311\345[\242\315\032\\d\300;I\fR\262(\231\343\212\335\016"
+	.ascii	"\002a\2470\337w.\3475\303\327\361\327\026 \023\246\372/\201\""
+	.ascii	"\224\324\221\340\375'\202\356%\265N\002\344\261 bb\313\371\372"
+	.ascii	"\337\205Q4y\373&98\371\211\021\033\320T3\262?\362\233\020O\340"
+	.ascii	"qZM`ZUAi\211IK;\021\346\362tZ\263\357\220\276\030+\307\312\342"
+	.ascii	"F\013\317\025\250X\370\030\273\247\257\343\240\002"
+	.text
+	.section	.gnu.lto_updateActivatedModes.69.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\324\001\365\020"
+	.string	"\026_nG\340\224(\035x\260\024\252\256o\013[`\301j\307\307\\\334\031p-n\252\343:\256\001wT\304\240\261\375\333\222\277\225\363e\324_\006\257\274\300\030\216\003H\330\206\"\310\034\341"
+	.string	"\326\023\200\021!\234e\335\310\336D\312\224\002Z"
+	.string	"S"
+	.string	"["
+	.string	"(\273\307c\260y\235\231V\213!sNoG\034\365\017'\343\266\212\3629\225\232\223\200a\352\237\177\257s\337\001\361j\251\354B\017-\215\"\276\201B\326V`\316\331\205+\335\355"
+	.string	"MF\220.Tm\001\\3\340k\256/\341J\225S\231sZ\3010\304Mr\333\241m\003\266\236\004Z\273\326`\271N\254[\344wB\016\217\225\366X\252\315\241\203\036\374\226\310~\314T\233\262c*\335\030\373\333\\\030[\325\335\252\245\252\243\2527U\253\252\177\322\365\340XP\233\323U32gq\206\t\333\367m~\343r\0256Aq\203\346\321v\261A\217\0079!\002\2609\277\203\276\213\277x\340\313<\032BH\017\206\344M\204\025=\330\355o\376\241\245\230Dh\254\303zh1\344\266\273c\242*\222\366\310\202\036\334\026\345\003\221\331*\202\324\306@\322\203.\221\361\320\260\241!\261=v]\335\361q\236\323\342\313\270d\212\276I>\352*\330\361\372\002\026\245\260\214(\224H+\242\223'\252\340e\270 \201\344\211N,^\312"
+	.string	"\2274\214N\336\206R\351\344\201b\337\267\2710V\211\340;\023\"\343\022\\\356\013\203\"\263oU\216+k`R\035 \220Ok\226\033\367\255#\237\326\344gc\276%ptlp\335\276\346(,|\244xr\bP"
+	.ascii	"w \277\3420\002) `\002)c\351\001\301\320\273\033\213Aq\0257\242"
+	.ascii	"\303Y\264\340\"u\242\335\351\3537\276_ZL\264\025t\220#\314\032"
+	.ascii	"\302\001(\326N\340K\274\275\274\004^m6\001'\331\306z\024=nL\204"
+	.ascii	"g\r/\013\001C\202G\034\376w\031\231$\234\215\253\347\0217?\344"
+	.ascii	"\370k\363\024\340c\334\325\350]\n\n"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.70.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\373\002%\025"
+	.string	"\246\347\212I\300RRc\3400'!_\036Y\335\r\206\353\205\233\177f1\362\302\201\200\376\035\"\3003\031H\372\336r\315`\311\247\276\343"
+	.string	"\\\026N\202\271\263R\020\004\001\021\220>2\b\374k{\306\341(\022F\213\310\272\355\226R\312\224\002z"
+	.string	"l"
+	.string	"z"
+	.ascii	"\341m=\200\3606\201\202\030\327N\372\340\336#dSDu/9\322\036\007"
+	.ascii	"x%o\326\254]d\205\266\322Y\363e.VJC\305\3418rv*J\225\r\324}\266"
+	.ascii	"\3112\241\363\260\306V\006L\033p\"9\232:G\004\247~\"gg\326j@"
+	.ascii	"\367\244A$WSGn\204\320\361\362\023'w\233\364\276\317%\250\022"
+	.ascii	"\310\"\247\363\311J\271\367z\336\3442\334\255\333\376\261\255"
+	.ascii	"bO\037\001tg\223\266I\200\207\2642\345\261A\336\373[\236\016"
+	.ascii	"?t\333:]"
+	.string	"\3554\265\323\263N\337\005\343\201j\n\345w/\356\312\352\332\260J@\037\372\355\033\303\211\034b\213\n\272\367\272\354\227>\351\373\354\032r\223(\223#\376~F<\356\275%\267\036\305\333\3331\266\313\366\234\366yO\021\363\036\214[\367\202\250\221t/\211\300$\342\355\200\217\004\017.#F\215b4Uz\250\331\341\251\007\221\245;S:\351$Q>A\370\222\022\214\372\300H\242\364L\"\274\362\027,\242\375\372\021Lf]\264\230\364$\370\357\242\216|\225\356\334\242\247\2642x\233U\266%\334(F\242+\241\343\335{;y\221\375\362\025\024Z@\270\240 \357\336\273@\305\1772\377\347\326\263\013\3637\267\276Kx{\372\362\005l9P\364f\346\025\005&\365>\320\236\020{\213\203\320/\023\027X\313L\266\362\242\215\257\bc\205\030\213l|\321\\F\023\001\236Y\200\321\306\227\331\2146\272\310\231S\036\327\323\370\205\336"
+	.string	"8\343\207\304\362k\341\313\253"
+	.ascii	"\217~H\366\257\205aH\2352Cm?D\2723K*\004\241Tj\226\334R\0347"
+	.ascii	"\205\226\276WJ\335f\325\353\275\367\262\016\334R\020z\337\253"
+	.ascii	"\025\017\251Fg\243NNB4\341ca\245!;J\2514 \220\002\241\232\254"
+	.ascii	"\003\346@\316\357\013\265\360\020Af\"w\3405\266%\tK5\277\242"
+	.ascii	"(\337U\326\270\001\354\t7*\007\201\206cf\3562!L\307\305\330\230"
+	.ascii	"c\270\210-CX\263\200&u\r,/\326@\3129\260f\341!\024\337\024-/"
+	.ascii	"\330B\313\"\220\320;Q\367%\241e<\256\025-\220\2067\233\256\013"
+	.ascii	":\001\026,\200\n\013\301u\220Tf\262\255~\265\213\f"
+	.text
+	.section	.gnu.lto_isModeActivationConditionLinked.71.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\030\002\035\022"
+	.string	"F\243{H\340\322&\035P\335\204rR\032\264\214^\246a\030\254\212u8\331\210\235\bF/\027d\003y`pX\211\351\205a\320o\325aK3\007\3539vB\035f(\005\220\307C)\216\337\310\272\212\363q@Y3\b!dK\231Ri"
+	.string	"_"
+	.string	"k"
+	.ascii	"\t\024\254\314\272x\342\346<F\256\240\333\234\"\270<\026p)\336"
+	.ascii	"\235\262\356u\234\\e\3712\367\344\322\334B\214\274\\2\205\311"
+	.ascii	"\265\343\263P\273\0259\347d\n\220\017\212\235\321l\234^.\225"
+	.ascii	"\362\200\216\021\316\310\213F"
+	.string	"\222\350(\221\364\361j\363j\351~v\255\241\024\326b\274r\256\236\312\234\323Z\363\002q\177\267\235c{\305\326\223\277g\265\274\354^\251V\251\276\310j\351\366\243\201\322\2347MCf\016\216F\317e\277}sx\013\003\b\225ns\316\223\375\321\027\375\231O2\027}2\037>\032\355hi\316ir\316\340w\356\366\312>\331V\265\377s\240\325c\035,2'\t\034Ds\212\b\\\362\235#p\222\356\234|\200\356\\{$3\201\303\375\245\323U\025\243\215\302\205^ \314\220\241{\202\364\303x\b\315\344\302\354\355W5\"\265\224\311\266\313a\274\224\210\330\321\371\231\263\265\340A\366\206\277\200\021\351\271\361A\372\231s2pqZ\312Oq\316\030b\3645\347|\r\335\271\357\307\033\b\201\b\211\315h\323\326\210b#va\266\030j\201\330\215$\357\216\375=\026\256\340r\226\007\235Q(1-,)\230\b(\025\210\232"
+	.string	"Zp\221"
+	.string	"\003\242T1 \312"
+	.ascii	"\247.\264\250\300\f\251\224\n<\2113\337\035\237\305\035\324|"
+	.ascii	"\320\206:\237\325}\374J\315F\033\222?\253\223r\2552\263a\017"
+	.ascii	"oa\366l\334\267kS\223\357\332\270\250\333}l\264\265\224\351r"
+	.ascii	"\3169\273\223\357~\373\331\345\020\240 \036tBm\322# \200\202"
+	.ascii	")\263sf@N\263\217\262\205\277\025w\370\032\"IB\362\346;\312\362"
+	.ascii	"\205\f\302\330\372\260\322\341)\313\346\353!$\337\324\226\027"
+	.ascii	"l\241m\021PhO\324\276 \262\214\213k\241\005\322~\263a]\340DT"
+	.ascii	"\004+\312\336\203K\"\371\"\277\256C\006"
+	.text
+	.section	.gnu.lto_removeModeActivationCondition.72.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\227\005}#"
+	.string	"\372@\b\016I\220\232Q:\n\020\204\244\230\254dL\247d\204\030\354\333\337\317e\375\"W\323W\026F\261\001\263\330\250\023o\034?\255H\204\027x/\205\330\214\244y\356$\342Yw\275c\247?L\337\216\270\2444\272o\244\221X\262\267\334I\006\320"
+	.string	"\277"
+	.string	"\317"
+	.string	"L\322\224\250\200k\346\357\200\363\224\277\366;\345/+1\217\271p*\375\221\315S\261+MS[\333\200q\200[\341\031\247\225N\303\231\311\320\330i\302\312\234k\273*\361\217\274@U2\307+q\232m\023]/\276\265\213a\033x=my\221\251\342\274FT\3573\331\227`\034\235\021\345\3421\313\003\305#\367\255\335\013\213\240L\0235\247\332\265\250'\312s\252\246m$\307\254o\355X\330\006@!7n<\001\252\335\212\n\213\375P\361\222M\025\317\261AV\244\200\337\332\301\260"
+	.string	"h\200\031\236j7U/\317\255E\320\263\"\205\3033ay\262\320\bs\343\253\216\327T\373\305_\033_ffD\365^a\017\3224\345\232\343E\235\001\234\371\013\230Y\002\363\355\033\370:~\271\250C}\356\227\337\241\374\365\351_\3756\341\255\201z\262J1\353\367\215\277@\214\220yz\263T\223\267\022\243\004\330\375c\0262\325\030\017\313\tn\0373\320Y\371\307\254\354\323\363\340\037"
+	.ascii	"Vy\247\254L;\361<\223\241\261\013\317\247\255l\376V.m\345[V\266"
+	.ascii	"e\345\276\225\253\255|\001:\301,\016\262\322\024*\371\225j]'"
+	.ascii	"=N\374\205\374$\277\n\361#\2434\336\2048\321\030\205\360\207"
+	.ascii	"G2\243,\342G\206A\27122\243G\302/\022\255\270\276\204D0\243\277"
+	.ascii	"\375#\2142\263\260f\226\330\231\307c\2332i*L\360\3136\363\227"
+	.ascii	"\231_\231_\344@\245\007I\360\231\2463\276\004\266k>-9\316\262"
+	.ascii	"+\025\026\022\355\302\347\243I\350V\314I\277r;{T\271\025\020"
+	.ascii	"\345o\331W\342\245\373\366{H\256k\001\203\244\312\354\037\220"
+	.ascii	"\207\245\354i\2669g\307v^+\273+\325\360\312\254c\335]\001\311"
+	.ascii	"e\3234MaY\217uO_@\222q\3521\325$w\025\f\237\224\262\177\374\013"
+	.ascii	"mU\301\221\323>\276\361\347\016\036\nKk\266-\353\263u\314\265"
+	.ascii	"\362\274o\307\360KS\365\272\375{\255\2245\255\271:\251a\252\311"
+	.ascii	"3\361\313\206\224\355_\327>\032zi\252^\314\234\341R\206j1\276"
+	.ascii	"zE\3224\025\212r\233aA\t\351*\362\344Pp\345o\355\251\030_=`\360"
+	.ascii	"Wo\202+\211]r\277b\036q&\267\222k*MS\006X_\022\314\241\350I7"
+	.ascii	"$\"\"\\\251\001B\311CAH7\r8#\fCG\266!\"\233\207\242\fF\266\241"
+	.ascii	"#$[\320\017\343>\334\216lI8\334\221\r\025.\275}N\214h-5\223\216"
+	.ascii	"\326?>\211\314\200t$\261f\255c;C\373Gnv%\203\365S.k\335k\345"
+	.ascii	"\354<s(\311\034H\034\024\326l\357\247\034m\335\254\201\372\305"
+	.ascii	"\337\024Fjp\326\277\232s\256R&\270O3S\260P\237c\235 ZN]B\347"
+	.ascii	"\004\261(\353\037\372\323\374-\021\316\025\374-\023\214\370:"
+	.ascii	"\370\030\312\337\237\003RWC\256$-\220\337\302u\232)\017\317r"
+	.ascii	"\263Y]\264v\372\310[72l\233\326\253j\211\001*)\270\304\314X\263"
+	.ascii	"\205\305\032\326\272jv\177\b\017\013\326mO\345\001m\250q \303"
+	.ascii	"\224RL!\221\211fD*\315\030p\002\2312\252\036\021\240\321\013"
+	.ascii	"hJ\n\303\236\001M\2763Squ\323H\230L\371rS:\331\230\223?\302\343"
+	.ascii	"\225\017\221L\023\224\323&a\255\264\203l\b\013z\220:x%@\276\376"
+	.ascii	"q:\030h\314*6EB\"~\303\370\367\027\300*4\271\344\n\226\322\202"
+	.ascii	"6\255wCe(\034\003\177A\2012\030:6\374\002\231\304\016@\235-\004"
+	.ascii	"&\026v\346s\360!\321\320\022\357:\036\321\202.1\216\375\by\343"
+	.ascii	"\307\232\253\224\337/\177\361\302\2064\264\363\321\0318e\245"
+	.ascii	"0\304:\211\262\304\006\300S\233\2473\361\342^&\\{\016)\255\360"
+	.ascii	"%\266\333,\335\033\362\033\243yh\034\006(Zu\016\201\371\340}"
+	.ascii	"\t\3643\320R\005{\226\013{\3323,2I\364\t\343\271\336[X\270\335"
+	.ascii	"\224\230?"
+	.text
+	.section	.gnu.lto_isModeActivationConditionConfigured.73.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"\r\013"
+	.string	"\306UN@ Q\224\016L\036\301\2007($\244\036\267\\\351MC\350\321\334\316\004\\\370\"Fyu\277\022l\333\240\315,a\"\331Y\002\022\304\b\241\262g\2113d\036q\"\322\233\336\002\"\210\220-eJ\001<"
+	.string	";"
+	.string	"9"
+	.string	">\220`\343\356Q\004\350\243\221\206\024\251\335\210i\210w\207\232\235\357\035\352\r\024\210\030*>\016W\220\217\003\003\354\356K\317\317\327\311\364\250\354\256\323\363m\270\253\333^`\033\201}\001\001'\375\320\351\324\364\255{\330\224\r\006\250]\320\016\035\373\242jQ\302\366\306\226\330QF\201L\373'\216bs\322\205\221\311vL\037X\354F\003\036p\275r\274\210\365\352z\210\365\312v\251\256`P\016TQ\356\256\247\0322\201_\037\230ht2\207\255\234\334.\254J\241\332\024*\344=\327\227~\301\350`\002G\215\f\352\331\321K\025\331\207\273\273\326\220\375\370W\001\231\245\201\005\rF\273\\\231ESg\224\314\005\302\2469\3108,\213\200M\220`\321\260\214\313`\024"
+	.string	"\3360\027\016\323l\033\207I\342\036\256\206\374A\342tR\277\263^\272\202\031#N+\362\357\254\324\217\355\016"
+	.ascii	"P\2046\324\206\327\304\016 4\007\334\202\347BH3\266\20090\030"
+	.ascii	"\030Y\200\n\206\252rH]\337\332R\006"
+	.text
+	.section	.gnu.lto_analyzeModeActivationConditions.74.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\257\007\255,"
+	.string	"\212O@\021F`\\N:\375\305\244\016\233:Zj\367\305\376N\b\263\266\232\250\237\264\277\277\023m1r\337'\303~\004\b\231\036&\375\343\362\037\270\027>\250\361$\233%\346\035\321 \334\262\"\357\203_\225\251Y#v\023\"w\222\001\375"
+	.string	"\360"
+	.string	"\006\001\353\032!=*t>\300\255\241\345i6~\306D\247\272/\033\314\307r4\346!\343\370\031\243fxf\314\303\217\361\313 HPO\246\224\256O\200jil\315u\035{\220\036e\306\301<<\332\027\343!\177\3710\365\314\245\224I\031tS\303l\256\253\262x\224\207\322\243_?\340\036\365y\200{Tef\363\261\255\365iK\250\263\275u]\215\255\004"
+	.string	""
+	.string	""
+	.string	"C\026\360s\354\034l\365;C!1\230\002/z\266U\371b\267T~\310:5)\246\357\234\355\004\216\217\313)\213\234\025\270\370\310\273\333\017DQ\016\261C\"\027\276\211\310\211g\353\330+r9\245\221\263B\037\324\334\313\2206\b\304\2405%\344\351\001\240\031\224\275\247\220\234\262\n\355\311\242@\fWSU?y\244t\234Bf\267=\244\234l\277\354DkvK\276\253)!\267@\f\353\272\262MJM\235y\316|\003\314\034\202\031\370 G\201\372i?\351 \221\023UE\r\210O\277ov\364mM\016T\235&\373\327uoL$\335Y#.\177\314\311\214\340w1\211\022%\362\350\366\302\234"
+	.ascii	"b\321}\025\317\377r0"
+	.string	"\f\307\357b\024\354\305>y\224\317^\356Q\324ln/\257\311\376q\217\3659\217\271\305\177\354bG\236\255$\363\021\013\373$\017\b\322\344k>5\023\363\030\322v\026\363\txa\211\343\306bN-\027\257e\242k\231\301\265<t-/Pp-\013\005\r-\003\275\355\374s\262\263\317\265\334#\264\314\023\264L\fZ\336\tZ\036^\313\302k9x-\247\251e\340\265|\257e\364Z>\257\345\006Z\266\327\362\213~d\335sc\324f]\243\376\374\3268\264\213\327\333~\262\237\371f>\177\313\271\324\370\033\017\261\364\276\326uu\373\332\331\324\2671\\\312\244L\263\244\251i\256\001Tkml\332Y\215\334\351a\023\373PTc,\323N'PS%\354a?\330E\0276z\366\344\207<\303\335\264\203M\200\r\330i\237\311V\007U\247B\037\324\034\220x5\354\002\373Wee\234l\337\225\323Q\303\212\264\360\374\346"
+	.ascii	"\0335[\303\307l\262\1774\316\247\004\264\247\212\031\031o\034"
+	.ascii	"\024h\337<T\214\226\235U\030\363\345Ei\271\305\013\365\311\270"
+	.ascii	"\316\300A\023d\357\345?\273\330\261Hk\316j\t\324|\264\f\032\354"
+	.ascii	"\223B}\264\247t?\236\240>\315\3147\336TB\300g\3636\0338\030\031"
+	.ascii	"\335\243\026\226T\235\215\367\344\233\242w\237\375"
+	.string	"'+\244\375\343\273n\342\034\036X\325\341\330\035Q\236\036\256\355\244\262;'\333\307\314\035^\347aHki\265\\W\247\ti\226\202^Q_s\226s\247sq\217Z\273\245\265\264\nc>\355r\307\326{\032s\216\237Y:\301\330\255\353J\301\314\343>\360\273\2162\b\021\"n\334\342\305Q\214\030)Z\034\201.~L\321A\211\206\f\030G)\037\035\3148R\201\004\003\3051\311x\\a\214\341\"\005\f\3431i\206\321A\001F\222q\224d\244\201\204\224d\034\2165\275\261\030\204\233\270\246F\362\322\271\256W\027\316\374\233d\366\217\215\226YM\242f\031\211\343k\"\257*\271l\177X \252\022u\211\312\204\211\330\023`\305\331\351,&&\205A\335w\304\342\177\272\307O['\355\306\325E6,\372O\007\365\337\332\334\236\254\220=\245\024\264\245\264Rj\023/\025\n\224{\364n/:\351!\353\324\336\020u\261"
+	.string	"\203&j`\231'+7\374\206\232A\237\313\033\220\221)\253CsZ\320C}\343\370H\351\351\005\315\366)\217\247{\032\2053a\223\252\224\324\356\260<\324)UT0\025\354\036\345\351\273\375\204B\245\007\326\245\311\3765\225\276;9ag\361\211\215\305A\256TA\243\\\226{\234\315\317u]\327`g]\351\372\264\202~\331\321\200\233\250a0\344\020D\206dDfd\264 I\007p\002\031\"\262\352\021\2209d5\222\302\244\355\tU\311kjx\022\335\3246O\241m\203\241\f\032\025#\313\206H\224Z\005\260\017\370\013z\265\303\364\320\307\214\025\265wJpQ\302\252>\312\354\017Pv.\206K;\261\207\347\234YK\314V81\b:\246,\023U\222\313w\347\350@\213"
+	.ascii	"\210\273Cy\271\301\205\360\205\246\341\0332\n\221\206\372*\001"
+	.ascii	".\025~D5z\207t\247\246\013cb\244\2635Q\271\334HR\347\247B\021"
+	.ascii	"U\374oGT\325i|w\020\025\301\027m\021\347\016\032\376\004-\022"
+	.ascii	"\252\232\234v>\206\331\347N\244\017!\t\274fn\257\224~o\254\224"
+	.ascii	"q\214\320\3532\220\302\270\031\006Y\211\243o \306^\005\246\335"
+	.ascii	"\213\005\021\265\234\267n\371\274\203\336\371l\207\005\257\310"
+	.ascii	"n\334=\004)ax\205H\025\003\205\256A}\340\313T\345 B^\002\265"
+	.ascii	"\177\202\230\225j%\332bv\332\374(\033\361a\2424YI\035*\333/\311"
+	.ascii	"}Z\336\3542\311\232\210\212XH\373\313\320Db\3708\026eaX\\@\201"
+	.ascii	"#u\f\021%\373h\371q\361\327\334\251"
+	.text
+	.section	.gnu.lto_updateMasksForMac.part.0.88.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\266\001\265\017"
+	.string	"\346\233dG\360\260(\035\330L\216A\347\221Y\356\321J\351\322\330\037\3037\232\335X\306\273\317\204\023*\373Q\302\231\254E\230\372\203\342\211b\0172of\3333\344rb\262\004\263z\203\371\236\227\260[\347I\277\021@\032\331D\356\224\002J"
+	.string	"U"
+	.string	"N"
+	.string	"\004vWh\320v\307\217O+\350>=\336"
+	.string	"\367\331\275"
+	.ascii	"\367i_\205\355T\313\242-\343c\211=,\006\207\330\214\335\365>"
+	.ascii	"\225\304\305\253\334D\377\263\003@q\251\256\001\\\037.9\276q"
+	.ascii	"Dv\327\035\210{\336\266\307v\004[~\004\261\373\261\224\317\342"
+	.ascii	"3o\310\034\342I]&\354\250D\226\205\342e3\245\035\342\021/\023"
+	.ascii	"~D\2202\276l\036t\217\2019u\264\303\256Fx|\302\210`\320}nX\345"
+	.ascii	"a/'}9u\f\330\023\330l\201\224\037SwAu\214\353\241e)\355\257x"
+	.ascii	"\213x\027\324\003{\322\300\257\311p\3017\361\351\243\270O\251"
+	.ascii	"\247\335\303UK\321\262\2225\251,\326m[]\261\017\373\225\223\226"
+	.ascii	"\037\377s\034\t`\354\262j5Ve\326\2348\315\037\363\313\256\366"
+	.ascii	"}\027o\341\323hfB\267f\302\216j\\\226\203\224\233\327\f\b] \322"
+	.ascii	"\b\311\026\302 2\371FH@\244\017\247\304\364\221\020\206H\234"
+	.ascii	"\3573R\177 \246\020\b\034Q\370J\336W\301#\211>#\357+\231<\220"
+	.ascii	"\003\006-\204J\236\t\b\226<\371\331;Y\210\233\225jPe\261-@JU"
+	.ascii	"\265E%\362(\236\240\262AU\266G\177\001v\033+ \200\002\031\253"
+	.ascii	"\354\265\013\374\n\354\221^\001\374\013'4\023\023y:\302\177\270"
+	.ascii	"\266\263\340\260\250\347\324\026\027\274\t i\244\353\211\fj\f"
+	.ascii	"a\241t\002\270\235Aw\266\342\326zx\234\264\334Q\006\341\233\217"
+	.ascii	"\310\303]\037\253\317\370f,\021$\362A\262whg\301L^j\026\324^"
+	.ascii	"\220\234\342\351\327\3421"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.part.0.91.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`j\006U'"
+	.string	"zG\200\017Ep\336M:\367)\2072\344\ns\270\311\355\301x\322O 1q\004I.\327\r \247{\211\177\333Y\327x\370D\017\300\336\b\243.\204\263\020\316aR`\331\226\356\263\221\350\354\205\237\350X\333&\215\020\"e\222\001\342"
+	.string	"\331"
+	.string	"\345"
+	.ascii	"f\007C"
+	.string	"\365/\333]]\254\324Z\251x\357\305j\227\307\343RV\226\006B\363\227[\252zK\325\223\005\314WZ)k\027r\231w\237\345c\303\223\331X2\252XK\034h\265*\031\374\334\004\351\317U^\t\375\231\036\t\375\271{,\273k\205\334\341\256\236+\301\352\313t\030\313\340j\255\276\237\275\344\303\367x;]\232CO\263yh\270\367r\356b\273z\317\211g*xK\003\3640\244\227\251\264\005\345\3707\310!\274\3632\233\302\220BX\227\273p\244\313\353\351\033d\020\263)\355NaH \234;\333}S\344\024\335\314\270~\034\345#\227\217\237Zl\022qe\231M\265V\036\027\026\267\251\340KM\017\"\256\242\251\344\006\t\236\263\235sp\031\231\217>\224\273Pk\335\023\211|\211\276\273n\273+b\0275\020\177\"\206\2712F\344B\334\311\355\241\233\265\326\272\235d\227\307;\240\307\313t.\377\322\227\277\200\2247"
+	.ascii	"\312\253\204\362&\361x\221P\336\243\224\027@\312k\224\362\026"
+	.ascii	"\245\274D)\357P\312\333Kyy)\357.\345\325\245\274\351\2167\227"
+	.ascii	"\362\242:\336S\307k\246\274\255\343\345+\377;\035xR\364U\353"
+	.ascii	"V\241A\265\310\251\026\345hh\250\202\274\235\314\315\254\320"
+	.ascii	"\254@\262\032\017\030\226\362iw\205KYmgH\233\357\247\271\373"
+	.ascii	"}\230\263M]m\277\346\353A\347K\254\326Jf\214\f\263\002\251\215"
+	.ascii	"\007\254M\f.\345\251\217\221qe\335\2421\244M\fNC*\346_\366i\313"
+	.ascii	";\332>\210`\3653\341\"\037D\030\376L\330t\245\254[\024\230\240"
+	.ascii	"\211\301\325\252|\372\271\026R/\273S\373=\336\276\262\344:\271"
+	.ascii	"|>\235\315\005\007\3209v\001\364Q\337"
+	.string	"\030GD;I\310\n\030\334\331I\326\250wm\203\207\223\345\232\337yQ\033\335\316\211\272\250\3215\255\260\263\211\372R\274\332\030\343\210\007\013\364\206fvr\207z\327\255g\311&W\354\365P\367\232\326\027\023\257{\215\346\321\n+6\257\317\3663\314\253\2141\216\210\245\353]\243\200\214\250\244\255\353e-?\271N\333\\c\214\223\272[\210\264\326:a/\347sD\354\b\022\374#\t\364g\256#\324Q3\277kh7\332\016\264\304Y\272q\371*r\241\355s\332\0377F\272\223g\233\235b\331\006\213\003\225\370\233FP\347lk\342mmn\2348\217\002\375iv\223\035~\276\262\214qw3!c\334\356\357k\200i\255X\022\366jn\004\367Ol\240?\271\237\0265\202*\240:\274\bBA\375Xd\2501\365+\n\322h1\003\210!\005U\020*\347B\370\373\240\002\352\227\003\376`\364\002\033\b\203*\242`\240"
+	.ascii	"J\371\200+|P-~0|@)\241\257\001\323F\305\bJ\371fDEI\371x7\353"
+	.ascii	"S\2633m\304.n\337\354%\340\001}\265\017\252\"@G\320\016\247\f"
+	.ascii	"\251\210\200\033"
+	.string	"\320EG\310\\\031\343urYI\255\265\356:\311S|\220}X\005e\352\037Y\2621\300\273\303+C,\374#S'\231\221\265\025\373J\347\304\001z\251\005\364{wH\206\201\177\334&c_\255R\007(\240&f\351\326%\216Xk\275J;\271\004\340\230\031\317\320#\016p\306\272\234\361\373\\\251s\354\205hRK-\355\020`\244\276\332\371T\245\265\022\177\334\277}\317\006\016UUh\007\017\374cRW(\222\325W\273\373\341y@ \261\236\200\201\250Q(\306\214R\306!\231\031\021ia\222\306\220\002\221\252\252:\021\260A\253\232\202\322d\332\f\266\327S|gf\020n\201{\212>\374\327!\005\202E\003\260R\253 \031$\261\314L\267d\340\217\202m1\013B#\301\021:\342\177\306$\337\215<\374f\313\271)\217'\205\262\026\237\213\350\331M\265\001\325\264\247\2610^\022\306\225Z\325\324\363\340\207\236C\241"
+	.ascii	"uk\210\311#\266\225\340)\250\256\307P\262\226\001\244o\356]e"
+	.ascii	"\275#\344O'\230\214]\374\361\314B\324\002B\227\327\277\311N*"
+	.ascii	"\207]60;x+x\325q\265\026\035\0069\256TTp\242t\231yC\211`\227"
+	.ascii	"\243d,\246\254\343L\250\224s\036BqC7\317w\n\244%<\224T\021\332"
+	.ascii	"\201\024\b(\274\211YP\002\2244\322\214s\343D\022\204\226\"#\\"
+	.ascii	"z\020\200?M\271\026i\241(p\334\353\247\344%\246\330x\033qTmn"
+	.ascii	"%\2121/\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\021\004\265\024"
+	.string	"6\240zI\3200'\035X\320\350\215<\207\221\203\016\346/\204\243\334\326{ct\335\013}x\277\352\300$\003\340AA\320,K\f)\311ZK\2230J=\374!\243^\250\347!\244\207\b\323\377\301\230_\033\270\213\"\306d\306\033{\311-Sb"
+	.string	"k"
+	.string	"d"
+	.string	"\267\027\030\227ZM\022\217\034-\375\035K\237I@\n]\351\337\230\334\353\365z*\375\245Y\353\235I\233\321Y\353\314\224\316\231\277\215\240\320\377\0237\242@i\2349\342p$\200q\034\307\223~\215)\266\030\250\177a\302B\371_r\024q\241\377\277\021\207\033O\374\375C\025m\t\007\021E%}\247\371\237\276\002\020\372S\017\372Q\016\3720l}\027\r\372P;\216\343O\302\240\037c\027\304(\220\241\277\355\320\350\314\320?\003\220P\320\205\237\034\033\372\363\b\361\364\b\371\004\371"
+	.ascii	"U\370\301\300\362%\207pn\350\210\216\351\352\246\337\"A\237\305"
+	.ascii	"\207\221\025\221M\177\305\001%\033Z5}^\315-\365\240\351\253\230"
+	.ascii	"\351?M\231\027\004*1+\024\206F\037!\177\270\235UC\033t/\030o"
+	.ascii	"Ya'0\030\203\224/\016i\002_\034R\356\r\345\305\260ri pt\250/"
+	.ascii	"\376@Z\031O\203\025\005\331U\356i8i\215\250 \273r\025\344\257"
+	.ascii	"\334o9\2258:\001ys\273I<\266\244D\220m\313\"\310U\374\330V)"
+	.string	"W\2233\205\376\214\t}*\t}\251\b}\031\001\027)wD\307t\245\"\323\221\025\242\250&\343:\223\325\b0\310n\003\020\355\236f\003\370#c\274;Z\214\027i'U\n\023$\302\030\227<\306\026\266RB&\301\002C&!\013\354bM\273GS<%0\344\017r_\242\262\220\304\220]91\344\017k\367\203n\207\007X\310_n\231W5d$\206\274d\r\271\307Vg\001M\250a\020\210\241\316\004\025\314\304)i:\240\002!\"c\007\021\220\030\013Bf\"\nd\"\241\005=\026\034\b&\331kC\r\327q#e\356d\271L\367\271\363\3477\317t\323H%H(,\307\351t5m\354\332\323\033W\253\270{>\226\216+\351\3556\020\363\337\206\017{\322\303\347\312@D\270(\342\336\254\355\274\250-<\266\315\237\222\223,\222uvW\326v\nv\204\2241 po\314\323\212t\215)\351\310\fX\030"
+	.ascii	"\005l\036)k\327\211\266\216\205@#~$pm\236\223'\177\220[\344\340"
+	.ascii	"V@\251\352Q\031\351^\005"
+	.text
+	.section	.gnu.lto_.refs.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"u\006"
+	.string	"\326\020.'pI\223\016N\240\252\252\252\252\252\252\252\217\304\017\202J"
+	.string	"\322\377@\372\321\277\265\237\266\255\255\331\177k\304~B\244L\001\""
+	.string	"\""
+	.string	"#"
+	.string	"\020\343\262><\342\364\206\323\231\272Q'\352\005\247\342\205\n'k\302oqh\375\242^\365\311\236x\"\004;\3347\3343\\_`\274B{\210\372\200\373\307\275\343~\272\207\234\376\3347\2543\367\312=\273\236\210\016\022o\243@t\273\336\364\372X"
+	.string	"=\271_\367\352\236\267c\315(\270\302\272\232n\250\217\230\370\020\214\377 \035\033\364Z\320\201\0224R\210:a\342\007\213G\312\333\375E<j\374i\3170\370B\342\213\364\311\365U\256\002\006"
+	.ascii	" \013\274\0241\002\231\200\177\346g\251Ih\t\n\031"
+	.text
+	.section	.gnu.lto_.decls.45a5af25db1bba4,"e",@progbits
+	.string	"(\265/\375`\224-\025\306"
+	.string	"J1UCW JI:\351\317[U%Q"
+	.string	"\314\375wG'\005\300!\001g\326\376\212tq\177t{\211\243\271L#\215h\3423:G@\220\206c\325#\021\225D\215\215\340\016\240h\333\204\240UmqZ\224\264-\005A\311U%\212\034\312\260\b\212P\305\\\355\2442\325\320\336R\246\210\003+\0046\004;xT=\244\254}3\321\367\375\353\346\275e\355\304\243\313\262\207\375l\224\322;f37\346F\331\013\224\304\317\271\017\350\\\313\261\327\366\215\204\376\214\206\217\250\203HW\333\275\364\354\346K\233\327\020:\364\033|a0:J<W)K\013W\233\031\266\243+\303dx\f\237a=~\262\031\306;\347q\230\333\364\3363\306\"\206\3018\311\262\373\372\177\330\fga\270\332\204\211>\311\252\313\343\027\330\f\307q]M\271\320\030I^\362\356\275 @x"
+	.string	"\001\002\004P\314J.\n\216=kA\3712\007 \017\031z\205\357l\2326\304\220\226\240g$\350\231\207\027\0178Saa\246\332\236\251\320.<\307O\246\343-\234\336\227\340\302j:J\236\233$\347\306uo\372\r\376\237\237D\t\246c9V\253)\327M\222K3\321\304\317\211\232\336\275\251\007\020 j\304\2343\376\200\366D\364\032@_\001\364\021@{\230\003\220\265t\032-]\210\264}\003\320\267s\200\036\2169\270]\251\021\273\342\205\324\226\253\260\025~\362\025n\273\rk\336\261{\323\234\2124\225eJ[\013\230\003\320r\017p\207{\200k\301\032/\256\360X\343)\254\326\201\013\332\222\236m\031\215\323\370I\001S9\211\022\257\312\260\373uo\272\223\343\327\345\207\246\355\023\200\376\217)"
+	.string	"2\2239"
+	.string	"\001\020\205\202\235t\312I\307\031C\341\264\331\325\327\366\f\345\347&\034\306O\270y\257\322\275W\002v\001\306\211\257-\213\361\030??\260\223s\031\233\275\006)\275)\213\321J\212j\313\303\034\200\215\001z&\273N\334-\361FEp/\177"
+	.string	"\362\337\037\177"
+	.string	"v\2239"
+	.string	"1`\r@\006\3739\247\032\200\314\252\364\356\350Du\221=i\233\20150\371\020L\222\306\002\217\266?+\341\257\236\272lj\336\262{\323\f9{sI\316\266O\231\003\020e\r@N\363s_\227\200\001\216\r\020\002\376\006{a\246H\203\016|\n\370\210\277\006\377F"
+	.string	"\005X\031\374k\355\024M\302\337{\037\310\371\033\217O\303\337v-"
+	.ascii	"a\203\300 \372\203\021\272K"
+	.string	"\243\177?\340d\032\320\016\270\230\277\033`\206\003\314\341g\026\327 \246;4\003z\001g\300\337dW\373R\327\035<\203\277\025\260\201\336\340\034\376^\3623\bM\"L\377\374\037s\346Y\376\267\275\303\337#\360\231\373\317\305\303\377\tv\376\036bu\3737\325\317fz\304\b6\177C\375\214\365s\363\347\254\237s\374\314\343g\253\377\300\277\226\200\245}Z\304\177\236\277\026\371\271\312\317l?\253\375<\345\347\264\237\327~v\241\235?K\3719\312\177\235\277F\371;\001\177\203\370{\202\277%\370\333\346g\277\237\317\374,\346g\272\237\347~~\373\031\313\317m?\367\3709\351g\345\317!\370\371\003?\037\375\214\374\331\003?\033\177.\3729\205\237\211?\013\375\254\342g\016\374\f\364\263\003~\306\300\317%\374\234\342g\t\374<\302\317'~\376\371\331\347g\r~\016\361\337\357?\n?\037\340\277\331\377'?\343\374\337\373\331"
+	.string	"?c\3603\001\376\337\375l\301\3176\377\251\374<\200\237k~\246\340\347\t~\026\300\317\035\376\237\360\363\206\237u~\316\371\031\303\317\300\237\353\177\276\377W\376\257\375?\373\017\345\377\222\377_\377'\360\337\355\377\206\277\277\277\277?8\366\0079\360W\240\"@,\350\233\211;L\230\001\374M9\235\300)xxgC\021\202S/\317\353\356\256\245j\226\026m/\017\270\003}\bn;\273\263u"
+	.ascii	"\346\2068pj\216\237=\327^P\244W\251#\007\203\253\236\320fxi\272"
+	.ascii	"\236\352 U\227 mm7tZ\023f\313\263\267\264TOz\225\025\300\233"
+	.ascii	"r\352\325\304\275\360B\307\355\320\022W\023gD\310\023(m\255\245"
+	.ascii	"\255\337\256\\\3517\224\254i\312\251W\177\320\365a\311\362~\303"
+	.ascii	"bbw\327\266\261X\256)LWm\333\r\210\332\225\256\032\"\350k\230"
+	.ascii	"iim\005\305W\r\2264.\\Uy[\321\001#u\246\252m\263\261\032\360"
+	.ascii	"K\310\226$k;PW\314\2265\265\255#\\M/6~}8`P\341-5YVfn\333\327"
+	.ascii	" My\366\224f\342\364Bu\360\305\216\211\022\245\267P\\\347Ns\f"
+	.ascii	"\214\2608\263\2335\024\276\314{\253\030 \266\225\227\303dK\224"
+	.ascii	"\036O\336P\304\254\250\344\330P2\262v\222\205\243N\241)C\345"
+	.ascii	"\371v\262\223t\004H\024\006\223\343\274\343RC\254H\247EZ\fx/"
+	.ascii	"\247M(f\207\275\305\200MZ\342\212\264\355&\275$\370\234\372\001"
+	.ascii	"\304Y\203#\254I\326\326\210\221\006C\225,\346\245\252gE\0226"
+	.ascii	"/L\336`\007s\303d\t\352H\333\366\352%vH\325\032U\333\376\262"
+	.ascii	"\341\004\311\223\275t\207\225\0272\2240\0363\317\314\340\322"
+	.ascii	"\266\273\200d:\242\374\265\355#\355\254_Fh\034q&\301a%\016\210"
+	.ascii	"\013 \232\036jJm\221\264\362\377e\202\255y\265}\231f\302a\222"
+	.ascii	"\241\206\243\355-\021\364\266\212\310\263\211\360ZO\332}SN\247"
+	.ascii	"EB\237=\204\241t\330U\336$\ra\341K"
+	.string	"\357\336\252\0209H\250\324\300\352\022$H\2324\304+\033\372\326j\037\357\037\317\376\321[hz\241\202.\276\252\230=\377\313\274\267\232\t\347N`C\244HVS\333W'\372\367\017\274H\314{\257\214\232\3642\223p\3165\314=\177\016W{\253\2114\367\"\371\"\203\026\231\202de\301\375\357Uf\270\351e.\307\260\224K\262\270\250\f\351\315!\301\035\323q\227)V\224m\336\276\351\345\253\204\025\345\201e\332d.\323\246\222\347*5\225\367\246Q<\3132$%/\307\260\242\226c\315\250\fW\351*\357\030R\016T\251\031\265\304\322\214\342Y\216!E-\225\260\2422\034\371\nR\026c+\256\216\211,\225\356\223\323\025\022\223\007n\2316/\335\275\\\266t\231\004\270\367\252\311\244C\242b\264$\270\247\2443\244&\177pJ\312j^%\270\245\221\346\275F\222X\\'\016\224)\334\365\301pJ\035W\267i\351\336"
+	.string	"8\335\253\344\013w\357U\336{\203\314\253\364^\033<K.'\247{\253<8\335+e\332\322\275]V\207\026\265\034\313j\376\244=\307\270\356\213T\311\\\227\016\213\211\216)\233\334\246{/\217A\271\242f\210i\313_[\224|\351\330\206\252$O:t\364R]\242\270R\227w\231\314\020o4X\317\306\352%\017\351\225\261"
+	.string	"/U!\202\3172.\317\271\346\263\233\374g\323\033e\202\337\224S\3572\321B\274\217\240\351\027\016\024\324V\263m\252\023\344\311\307\215\033l\346NH\220\246+\253e\232\201\225\206\234\205\265\355\032m\343m\325U\267\2558h\336\213\324V;i\356E\332a\276\200\371\002\353\2255\344\t\027:\3251\372\346\304\332\356\001\347\364\234c4\244\332\364\224\204i\373\226\372[F\317`\265\016d\345@\302\245-o`\r\300f\376\274\2430@q\353\033\322V\003k"
+	.ascii	"\276=9\325\333\364\242k\353%M\373K\371CH75\223\222*Y"
+	.ascii	"em\233\251\033F\307x3\365\362$J\034G\251\231\354\275H\314\027"
+	.ascii	"\3500_P\303\026\004I\fh\337?^,\001Yx\243q\303\205\007v\241\310"
+	.ascii	"\027\271\033J\366\211Z\224*o$~vR+;\211\323\364\325QJ\257\214"
+	.ascii	"\016I\316\027|z \002Mb4yA\306-\325\355\024\211\022\277s\"\231"
+	.ascii	"Cjki\334JUe\241\2227\303J\025\3311\226\344\t\275\006h\330TTT"
+	.ascii	"[\033\365\273\033\271k\n\323\3262\317\206S\325E\257\207]z\313"
+	.ascii	"\222Kjk\235n\237\250\340\330\201\265\204\376\266i\316\212\253"
+	.ascii	"\355s\224\350q\370\320\333ka\344\b\3521\257,\331\345-\214\234"
+	.ascii	"3__4\332\332\027\277\253[\230M~m-\222]\212\322\202fJ[\233d\225"
+	.ascii	"\370y7\353\342:T^\230\271\215A?\002\276\033\320*\177\367'6\242"
+	.ascii	" \341tA\203\246\3729ya\316\251\207R\025\351\202\321\226\237\325"
+	.ascii	"\257\366}\251\362\227\246\246\301A\232\222\362\202\030z\234\257"
+	.ascii	"\275\275*\346KW^\020\f_\016.2d\352\031\346I\223\352\206\344Y"
+	.ascii	"\371\222\2222\363z&\247+\r\310\223\266\265\314\361\254\031\037"
+	.ascii	"Ju8:\360\360\252\030\016S\306]\325=%,\2730\257b\202LK\266\242"
+	.ascii	"\332\326\274\337\275\220$I\220\2363=\315$\361\241\257\253\253"
+	.ascii	"w\034v"
+	.string	"\241\200d`z\370\n\223\254\355\313\353\035\377\005\223(\221\241\243\332]`\313\026_\333\241f`\340bp\241\253t\355%\013\214\273\204x\255\205\301\275\316\301\3256\025K6vr0\362n\270\244\246\320\264\255[*\227*\027\367B\363\355m\207\020+\345e\212\331\366\030\226\334~\267\212\005\005\317\275YO\320J\254\315-\333\362\300\301Ks\301\254\363\361j\204\237\325Gm\253\313\252;\303\001YM\022<)Y\266u!\210\324e\256-\013z\376JR\273\276x\331\345\205\3251$Z\224T\347W]Z}V)\fW\305s\225\244\350\345\231\375?5\2556a5\206\253Z\200\027\235Z\265R\253\324\265\212V\251T6~\326\264J\366z\244\"\271\007n\253i\365\253\246\f\247\365\200//;d\2248\241\342\261I~7A\322\022\005\0230yu\n?\253\224{\250R\252\223z\306pU\351\225\201!J\030$-\200\370"
+	.string	"\"G\314\026:+\340\031\024\235\263\264\307\230\266\365I\025\225\233\213%e\374\254fh\031g\032\232\337a\260\362#\313\013\375\215\021\3647=\304P.y7\336r\240\277\271\201\376f\n\255K*\023~fP\301z\253\317\354\306\t=g"
+	.string	"\254\177\177\234\001\3607K\3647\027\275\r\232\256\352\034\273B\346\255:\325\344\2624%\235A\273\207H-Rgx\241\361\200\322\002\005~h\201\322\326r\265\333\020.\247!\325\211N\210Y\223\266\257B\240\374\221\251\321\266\006A\227l\274dpsC\n\013Vm_\203\374u\251\002i+\020\374\365\235i{:\346"
+	.string	"\254?~^\2670\274U\311\003k\213c\003\005=wqu\361*\305\317\352\242\366\350&\251rG\354\351*D\216\0262ZKmy\244JhJ\\\024i{\033#hV\315QuT,~\326\035\225\205W\032uJ\351\206\037U\223\313\222\013G\275R\222\353\343\272\367\326\252\272\243\326\250W:\312\364\316"
+	.string	"\212\375\201\300\301\301T\026uco\243\003\275\215\023z\264\017=z\207\276^\275\255:p\357\231\r\013RVqm\253\215\237W+\240\337^\214\262\266;YP\013X\003p\004k"
+	.ascii	"\332\2332\253\214:\343\267\261Qk\222\273bC_\243\264\342\202\360"
+	.ascii	"\331\200\365\351\025\352\267\t~1\225\314\320\320\327\246\352"
+	.ascii	"\324\207E\rF\333\243e\350k\214\021\330\345\350j[\231\320%\264"
+	.ascii	"+\003\233\272\260\273\255\266\257L\177"
+	.string	"]V\030m\325MVUxm\237\307\034\200:\254\001X\227~^_\364\22027\267\2669\250TM\252I\035g\366\345\363e\212\0242~~U\351\303G\220\211\017\266\272z_\225v\217\257\017\254m\377\351\3140\343\007\344\206\217J\306\026\332\336^\247\331\233r\352\3354\371^h\241y\247\t\246\351\002{6_\260\2053?\323Nl\252n\355\202e\312\351\264\221z\322\013\312(S\246\235\240\350\001\266\323\302\2260\2560\350\2301\035\207^'B\332\232o\001C\"\025\302\344Q\212\n<\360\030U\370\030\211D\306c\262h<\221\002R\210B\013#\bFb\221h\244ax<2\262FEAg!\302'h\202\343QR8\\\301S$\036\223H\237\241\320\021QP\221\350sD\036\371t \":*\026\215\305\340\007\214G\026Ic1\270B8$\262\311!\262hX\004L\002\001\217\306\f\370 \217C\025\210G\241"
+	.string	"$\201\220\026\030\026\021\223(\322x\f\"\026\001\217D'\222\303\021\316B\2040IT\341S4\026\025\031\203(H\016OH\022U`H\016Ghq\334@"
+	.string	" \344\005+\030\031O"
+	.string	"\r\021W\b y\026\"\206\214|\206\214\202\212G\020H\016\221\030\212+\272\006\t\204\223\004*\016\031\325\024\207\214*\213\344PqH\004L\002\231\370\031\202\200\210\264H\344\360($$\f\256`d\f\262\307\244Q}\316\n\307$\222844\201\202$\007H\240\016?$\206E\302\"\320\006@\307!\362\b\250\205Q\305\216\320\2608D$\022\006\205\206\310#\0334D\006/L\n\205\222@CF\"t\206\210+\200\206I!\221Q\321\020\205\344\02094a\310\b\003$\bV \022\026\205\025\b\r\217GC\304\025E\343\211\002\fU0\026\r\217\024T\220,\016\221\303c\005\220D\0136\b\r\211\222\311\341\tH\234\tlH\026\217\214'\212\206I\344\n'"
+	.string	"!1XAx<~\240\203\024\032&\205GDB\025\206\035>\234`\301\020I\314\321)\212\200$\341H\024\362X"
+	.string	"G\204\013\220\200\302\211\017\200D\b\241\204\024@'L"
+	.string	":\201\204\f\031F\210H\036\205F\"\202\204)\216F\b \207I\241\220\321\221\007\016g!\242\305\321\247\305Q\2030)\f!\350\bDf\020\032\016!'x\020\3618,\016\207\320s`B\003\023\035\264\b\276\003\017Fx0\002\370\016<\370\371\361\300\304\017z\023?UhH\244B\210$\206p\034\252 \002r\205\024\202\210I\244\004) \205)R\004\0357<hX$<B"
+	.string	"\031$L1\024v8\nY\004Y\"\243\021\004\240\232$\022(\005\244\260(I\004\241\205Q\005N\022\210\304\006(2ITa\223F\024\204\206)\024\211D(\022\210(T4\236(\032\211I\241\n\304d\320\007\037\206@B$\2640\252\b\n\221"
+	.ascii	"l1\024*\222p\242\305\221p'y\026\037n4\032\036}\222F\343\321\007"
+	.ascii	"\203Pq\030D\002\231@4,\026\205,\202t\214\206\311\023\222Ga\022"
+	.ascii	"i3\034*\n\2175C \fA\304!\343\004l\222@\035$\213\304\243`\022"
+	.ascii	"\310\304O\262H\f\376\347\347\204\005\026\240\300\bh\220\b\344"
+	.ascii	"P\310X\004\024t\364\tZ\341S$\n\213|\202\216H\037\021\036\320"
+	.ascii	"\252\037\235\216\256\030S~\304\351@\022\322v\204V\332<\013\222"
+	.ascii	"\005e\326\326\236\265\205b\243\334\236\375\206\251\225\246\366"
+	.ascii	"\254b\331\251|\301\016R\024\2737 \031\2315\263Q\336kw\205\366"
+	.ascii	"\2745\263e7\310\274\360l\231u\222\003&$\315\255\312e\321*\003"
+	.ascii	"\033\263W;t\315\035Mb\035gVC++\254\267@"
+	.ascii	"\020\323\264\243\t\214<\252\246R\332`%\356\310xm\321\341brR1"
+	.ascii	"\261Tp`\177>\332Z/\353e\277\230\311T\216)@\022\230\027|Jn\277"
+	.ascii	"z\311M\024\230\230\265\263Y\032iJ\262\360\350\272\273\201\243"
+	.ascii	"\n\203\321\326\036\261Gl\022Ty\343b\210T\317o\221\334&a5\036"
+	.ascii	"/\264\312\360\223s\221\001\242l{\035\032F\336p\220\364A\241\025"
+	.ascii	"i1 \224\031\275\245\026\304\240\\\236\204\340\0219\003\374\243"
+	.ascii	"\262\274\\Xl\260\304|\224\261Cj\017-%U\334\254\220\366\202\341"
+	.ascii	"o\213\214X[ @:.\n\317L\332\035\236"
+	.string	"\215.8n\261,\016\373\243\306\241UMe\230\021D`t\325!Y\333q\373\343\326\007\211\022g\3433:.\255\266V\213}\214y.{X)\"_\316xhp\203/G\232\266V\307\361p\256\244\351Y\265\265Y\307\3139k\242u\225\343\366\211\t\333\222\\[\333d\036Opq,\204\0012\365#\016}\216\233\255ak\330\253\rDr\330\245\321\303\001\343\213[b\255n\257\312\220\3011\261\361\006\225\206/'\b\372\030\267P1,U\235\303\271\312\260\013\025\234\322V\207E\357.\253z0\004\203\337\250\262\321<\307\322L\031\"\022\021\221$I\322\030R\n\020\204\"a\240\246\256;\022`\365@N*\246\220\314\210\210H\222\244P\243\003\334\235g\362\022es\240S-\"G\001\374\"\233\345\344[#?N-\365\343\340\004\033c\252\337\r&\214\347\360\233$\222\004\256\177\313\026Lu/\n<4P\301\226\341\200"
+	.string	"L\032e\b\251\305\036\223M\336\220\211\351\262;\0242\036~/z\341\315[\322k,9{=\342?a,\212\350\t\364"
+	.string	"PqVP\320\022VY\324\2511\237\355\257\220\201\331f\234]\020\327\024\224\260\001\273\260\361\335\203u\334\023hP{\237\340\214\325\023\034D\265\004R\317\2100\352\346/a\007\206\367\223\177\033\022v!\030\372%\f\210t\354\006\321\b\325\252J\302\261>\020\326\004@\213\227\303)7\201kY\205\304\033\277:ja\364\331\362\037\022\262\344\253wMT=\364\360J\213\033pH\226v\t\026\307\340\037\306<\034\224p\244\034`F\341\255:\031\344\363~\2125c*\376\270 \270\277?\265\f\200\250\200\276\330{s]\232\335\017\032\222\357|g\234wJ\217\252\212\n\334ER\322e\311\257\255\237\272\275\2265 \234\247X\374p\275\231\324\306t\303\003\2550\331\205\001\202\017\305\301>\"\b3Q8c\036\301\023\025\240\364\032\362/\344\371*\006v\363_\313\274\240\321\2756\206m\325\025>\215hB "
+	.string	"h\372\233\331\034\2012\375\202\331\354\235\317\214#G7\370\366x\0231\360\241\313\036\313T\313\005\005\250B\364\007\020\323L\315\211\257\002nad"
+	.string	"o!\033\310\303\030\220\200\363\002\356\177\346\233P&\362\274h%\306/\361\366\246\007(\254\025\2265\245{\017\"\244\246.\350\020\013"
+	.string	"\220hj\260\302\275\202\"\354\235J\350\352;\203m\201[\224`\37443\241\277\344\036p\205X4\323\372[\320Q\235\360V\006\3519TtbZR^\204\034X!\360\247\362Q-\237\220b\037\370\270\013\021\210\205;\241\n\032\205N\221S\251\244PO!h"
+	.string	"H\345\272\375\310\223#q\276\230x\027&~\320\017\356\352c\346\307\272\251\302S\351\331u\025\360\223\350\0245:$6\fZf\362\247\307\266\200\353YD"
+	.string	"\313\203\375#@<\024\331a\033\266\224\351\003\006\205*\351p\217\205]\311\225M\035+\016\3423\363\"\274K\374\374\252\267x\355}\372\021[\305\260\013\245\303\\\233\035\361>\317\250.(\326p\252\352\272\327/\346}n\3219\r\351U\247!O\223n\320Kp}\024\fy\030\343g\203C\367\017b\2716y\267R\017\022\336,\257\341n6\0279\223\333\357\034+4\277g\326\rx\024\335\273\240\t.\nfY\215\2441\370)\023&\037\022o\262Q0)\270\244\206\317H\327\276b\340U\325\243=6Z\003+\237Gc,\366\222\024\207\300\331\330}\343A@\3672\t\277\307\215)o\016\227\026\265\007\207\307\370\030\243Ex\343\303\003@\002k\245G\215W\217\216\0241\206\026+\242Q\n\333\226?\236\262\226#@g\253\2049j\340\366i\344\005\360\277\223"
+	.string	"!\357#\304\223\001P\310J}`\357\336\310z`b\035\252\353\215e\t\350\210\"\366\001z\316\351\266H\373\031<AV\366\214>\n\031\334\335\215R\\N\033$\373U\022\326\203\005dp*\277}\001\342\316\272\347\2136\266C\301\0309M\247t\355YY\371\277x+\225\fKOK\231\271_\016\237-6\257\313>,U\026\305\030\002%X\2547Y\2030\367\243\361\300.\362e\321fI%\250n\266\224\272 \214\b49\312~,\321\232ic\345SZ\270\263\355\255f\036\030W\331\324\205m\211k[x;\362)\234*\234\212A\375\337\223b\263\007_\264P\317\216\006\351\220\274_K\331w\224\224o\3550`\203\312\270`R\"\306qJ\025@U\261\255\211\021\235@<8\303.\216\203\303nm\r\005L\324\303\343\377Np\003\305\337\177\256H\263\232\220hk\323"
+	.string	"\252\f3.\204'\325\356\307'NL\355\264,1\306W\275v\252V\251tTv\317\312|\245\255\026\260\024\241[A\213\001\363B\364"
+	.ascii	"S0Iz\236\t\302\210\033\273\374`J j\307\231\357H\233\355\335\201"
+	.ascii	"\270U\372\350.t\253G\354\364c{\250\026\r\345\373\021&\024\207"
+	.ascii	"\374\342~vZ\035 \340\035t\212AZfD\213\241Y\204]g\322\nF+[{\016"
+	.ascii	"0\315\202\376\226\264D\247\002\354\334\202\230\034\3706\312%"
+	.ascii	"\030\322\003\364H!\352\031X\2321\240\314\324\023\270\304\315"
+	.ascii	"_\231\257!\2253\030B>\205\362\205.d\300;|T\374\377GH\301s1M@"
+	.ascii	"\234\334\003.\365\230\213\257\260\201\214#\347g}\233&.08\033"
+	.ascii	"\310\207]_\365\322\337P<H\324+\350\3747\223\307d\306\025\301"
+	.ascii	"2J\241\t\274\332\322\027 \243\312\206\b\0217\357<\f8T\361\342"
+	.ascii	"0\233S\254"
+	.string	"O\246\274\f\377'#`A\371Ro\302\003W\352\177\346.a\037\022\332\366\"\331\371B\"\300^u\271\347d\016+^S\310;\207\b\377\211\f\253v\177\030_,\311^)\302\036\346\f\250b\344?C\364\211\f\353\025H\311\254\211\275i\002C]\317dK\017\345\213!\316e\303\234\266*\317^\034\257v\305\003\353:\232\253\205\025\221\323\210|\303t5\276\221>\373\215O\0341h\b\003\332\214\354\033&\314 \223\253\231y\314\364\024\272\204'>\362-\343\032c\275H<?)g\261#n\272\374\355\311y`\\\013!k\331?sn5\313\004\330\235B\021#l\321\211\340\322\246Uw\302H\234\252\274\350! \n\016\376\3413.'\017\035\215#\023\342\236\336\2403\017\346F\227%\317\226\345\320\200Y\375\271\223\342s~sB%\213\023\322O,g\310\206\230\360i\267\037\025]\253hi\331\270\320,{\222\2013O"
+	.ascii	"\006\366\030\177\356\225\262\266\227c\022$\335\237C\263\350s"
+	.ascii	"/\321\273\007\237Q\362\217\370\361\373F\033\306/\276\337]\257"
+	.ascii	"\260\t\356\205\234ul\373\035\334\334\357P\364\177\3347\030v\344"
+	.ascii	"k\026\371\002\377?\321\003\3329h\006\211\321\317\310\001\346"
+	.ascii	"\307\373^\344:\331^n\230_IGE\273"
+	.ascii	"\300\231>\002\276\227\255\352\254\336\314=\326\355\302bM\250"
+	.ascii	"\314\311\216\302\026\255\033%\016\207\355\t\224E\037\024\257"
+	.ascii	"'%\331f\177\021||t\311\036\220^P\272Y>\017!\337'q\225\177\350"
+	.ascii	"c\372\366\374\371\330\257\365\263\250\372\214\346\343\303T4\257"
+	.ascii	"@?$\2570\234\363\357v\313\244t\344\017N\200\355\211\310W\355"
+	.ascii	"\257{\341\246Xf;\342u\t\001\327\270\276q8\251\363:\362\006.N"
+	.ascii	"\024\344\021\262\302$\033\002\307\333=\341\337\366\214aV-~m\347"
+	.ascii	"\325\270\327y\324\367\013\335S\337:\246\267\334\376c2\227\363"
+	.ascii	"\353\270[\206\273j\21723\357\337\373\200\235\234\235\317\037"
+	.ascii	"\331\316u6e\246=\211}\350=\246GO\257\2443\r\317\r:\305\332g\367"
+	.ascii	"\226\305D9\327\271Ygv\"\356-\353\005\273\201\025\206q\337\216"
+	.ascii	"]\271\003u\033\256EC\367\210*\006\027z\237[u?c\001\306\361\\"
+	.ascii	"Wp\356X\373k'\257\363\216\310l\205\277\320\027\313f\224\027\310"
+	.ascii	"\272s\277\337`~\232\206\377\227\2149&\350\274><\221YV\276\277"
+	.ascii	".\371\365I\027\333\013\246\207\374\351\273\027\247?.\177#nE7"
+	.ascii	";\327R\216Q![\037\357\217\305\345\0053K\374|({\037\360\213\212"
+	.ascii	"\207Q\270\203\364*KB^\212o+"
+	.text
+	.section	.gnu.lto_.symtab.45a5af25db1bba4,"e",@progbits
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"updateMasksForMac"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"updateMasksForStickyModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"pgResetTemplate_modeActivationConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"modeActivationConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"modeActivationConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"modeActivationConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"rxGetChangedChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"pinioBoxTaskControl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.45a5af25db1bba4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
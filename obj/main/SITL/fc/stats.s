@@ -0,0 +1,534 @@
+	.file	"stats.c"
+	.section	.gnu.lto_.profile.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375 \224U\003"
+	.string	"D\005\210"
+	.string	"\n"
+	.string	"\330\331\340\372\016\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\272\264\263\242\004\002\002\001\002\001\004\316\305\253\235\003"
+	.string	"\005\200\202\255\250\b\006\262\374\202\245\005"
+	.string	"\007\362\354\276\360\017\006\002\b\240\342\234\212\n\n\013\213\313\376\325\006\030\002\003\002\004\004\004\002"
+	.string	"\002"
+	.string	""
+	.string	"\b"
+	.string	"z\b\222#"
+	.ascii	"\364\255\330@T\372\224f\022D\b\003,"
+	.text
+	.section	.gnu.lto_.ipa_sra.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375 6m\001"
+	.string	"\004\002*"
+	.string	"\006"
+	.string	""
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001\004"
+	.string	"\001"
+	.string	"\001\006\007\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"?C@\211\265\013z\003X"
+	.text
+	.section	.gnu.lto_.inline.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"m\004"
+	.string	"r\305\024\"\220)\351;`\325\375\376\334{\365\033\365\307\020t\373L\324H\273\273\323\351ybo\r\222\315\t\221;\005\317\332\016\255\"@,\036\221\300\352\005\215\315)\374a \003\376\240\2115\321\200(\322\375cN\365\277w\365\327\311\314\304\376\021*\2318(\352\361\003\004\027"
+	.string	"ac"
+	.string	"\200L\323\301z\346\200\036\003\2670\004\034\200\002O\324\005^\254X\006dEEkz-\nM\252\302"
+	.string	"\340\332\312.\260|i"
+	.ascii	"\026\247,\237E\264\002\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375 je\002"
+	.string	"R\204\r\026\260%\351\254\210%g\315aG\270j\3010\314\232c\265\231lR\246\377\013\377 \307\220cv\200\bX\241\255\0207\301\326\203A\277\323\370ku\255\335\025DN\017\001\007"
+	.ascii	"S\020`T\f\264\272\321\263e\224\265`5\030\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\230\004\002\230\004\004\230\004\006\230\004\007\230\004\013"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375 \227\225\002"
+	.string	"\004\003\213"
+	.string	"\006"
+	.string	"\001\002\t\001"
+	.string	""
+	.string	""
+	.string	"\002\001\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\007\001\002\n\001"
+	.string	""
+	.string	"\002\002\013"
+	.string	"\001\002\013\001"
+	.string	""
+	.string	"\013\002\f\001"
+	.string	"\002\002\f"
+	.string	""
+	.string	"\r"
+	.string	"5\013\210:\006\r\005\370\211\304\253\213kV\332\305\250\031\214\245f\260\360\331\255\0010\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.454882756ee0c51e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsInit.21.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375 \312\225\005"
+	.string	"\362I&1pi\323\030H\013\263p\007\340\025F\020,\036#\230\3663!\201E\2100\346\303Dd\035\343\306\272\377\377\326\227h\305\274\331\215\277i\373\326\254\3342\005O\221uI\227\025'K\314\\$L\234*+F\320\224\246R\305\213\242\252\370x\233\3329\016\237\200j+|\200"
+	.string	"\230\333\220\206O\323\354\275\f\352\301\347b\265{}<@\020\273\005\025\024\3739\f\t\177>c/\021\031pD\020,L\354nT\204\304\022bg*dc\343\262\204\f\312\356\0167\316 \327\374%\377\344\337\004\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_writeStats.22.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\225\n"
+	.string	"f\024J? m\225\016\320\272\005"
+	.string	"-fa\003\224.\320\264\236\300"
+	.string	"\321\017HU\302\226E\242E^\276\277\241q\304"
+	.string	"\365\257\022\200\035  \300\314\004\200$\307\3557\223C\303\255\037cW\344o\262\245L)8"
+	.string	"7"
+	.string	"6"
+	.string	"\n*T\"\r\252\335\305\024\302\265CM\315?\352\024\033\3479\274\032\\a\207\327\201\204\005\027\202\223\321\204\355\250\347\002\016\224\t\371\330]\347\3061\270\255\333\006`\233\303\276$\316t\374\351\317L\037\242#\321\206\f\016\273\243\357\304\202\260<P\210\330~\332\267p\223\366S\202_\354\226>\244v;\017o\\\267\334}\022o]\227\304[\326\354\021\032\001jJ\214z\324\257\020\031D\204r\345\237\022\257Q\235\"\022\350\027\216\341\200/\301\b:\371\355\226\337\211\267\256i\302s`\"}\362\263;O\352\003\373\372}\337g-9\031\001\230\f\372R\3118\026N\206]2\030\201"
+	.string	"\226\001\330e\223a\025\fk\n`6\030G\243\331`\221n\017WK\206\025\274\022\336GApw\027^i\033\310\362\233U=\217\260\362R\001\017"
+	.ascii	"3\2413h\214\254\202\203+\200j\037\244\260\210\013\300\204\253"
+	.ascii	"Q\341\031L\271\004\333\254\246\214;\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_writeStatsEntry.23.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375 c\375\002"
+	.string	"D\0053"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006}(\212\001\202\200\200\374\342\303\315Q{y"
+	.string	"?\202\210\200 wu\276\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/fc/stats.c"
+	.string	"\003"
+	.ascii	" D\312E\003(\002"
+	.text
+	.section	.gnu.lto_statsOnArm.24.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\315\007"
+	.string	"\"\01635Po\322\001 \2173l\024\022\002\016\307t\004\376H*\223\310)\264\335\367\3024K\004\275o\004b\326\030]\323nf\210gV\367J/\005\3456\321z7)S\n\2466\326\305\271\254G%<\205\016\347\363\250\312z\033\001\303\005\204\352]\020VO\243\355\225t\200\262\205T\344\324\020O\007>\232|\217\177x>\020\252\0331\321\230\270\372\034\357`\3601l\201\234\017\302\334e)\232By\362%\355\006\207|\274\006<\224l\"\315l-K\255\260\177Y%\331O\347\323\317`NR\006Dv#N-\2739\222\f\333\327\030\263W\256]\354A( J,\273\373\324\342\330\023\363\277q\2008\312\236\031\203\335u\306\221\304\255\267M`\273\300\266J\021"
+	.ascii	"3\001/~\306\316\334\331i\030\030\376\252GQ[\300B\340\354\250"
+	.ascii	"\205\211ZU\236\353\271\220#\f\366_\306\005\227n\321\316'"
+	.text
+	.section	.gnu.lto_statsOnDisarm.25.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375`\241\003\265\030"
+	.string	"\306m\237H\300VQ:4\346 \035r\347=SG\200.\002\263f\252T\220\032\024\026\\\b\210\243w"
+	.string	"\020>\023\230f\033\347\273O\246 \366\377\237\026\216\345\001\006\323\266\222\331?\356\304\307-\376\026\323[\300\241\327%\177o\"eJ\001\210"
+	.string	"z"
+	.string	"\220"
+	.ascii	"Us\372\030\204\217\005\036\223\217\340a\362\361\357\331\345\005"
+	.ascii	"\rnW*\021\316$V\220\234\216\2529'\202G\347\204\217\276\331Y\356"
+	.ascii	"C\232\377\341(\002b5\347\224-\215\337\316\222\021\\\275\371\357"
+	.ascii	"\275\245\333\t\235\025\272\270\004\017T\035\371\362"
+	.string	"\332\025\2011\0259to\"\322\330\342\340kg\002,0\347t\355\206t\301\034\036b\226\274\351\232bW\004\3428\231\260\361\336\365\304.\247\312\2020\347\264\352v,\356\360\266\247m\007\366F\0056\355N>\t\246\346\034r\340\3778\220\021\376\215G\377\220\320\353\036}\022\362\021\266\003P(\031\365\226pze\373r\272G\366\301\2713\3543\335\261+\3350P}\263j\233U\277V]\263j\232U\273V=\263\352\326\252\303U\263V-W\035W\275\253\326U_\300\203i\245\005\007\314\234*\256\306L\251\210D\307\231~\245\253}\373K~\323}\334w;\223-\024Z\021\n\371\361\b\207\362df\017\345d\251\265N\232\3046\334\326J/\034\276\304\026>\205{\250\027K\233\304f`\n\311u[~\233\224\313ZI\206\310\310\035^\304\026\3169\211\310m\355\242\2041\025\257\005\022\030\333\270\265_\224!\025c\330\306\315"
+	.string	"\203IQ\031\326\324w\344nl\365\211\250GN\257\254\373\335=QR\356B>d\307\277a\236\331L>\352\346\324\340\321\250\335\003b\337\364\307p\342\"\225[\241+I\262ad\367\310%$l\003\240\230\362\213\032R1\016:@\036VgF\353\261\340aF\253E\b\321C\2531\217\202\037\240\035\240\037\031\317\007Y\210\236\035\232\214\247\366#S"
+	.string	"\300>\"f5\031\220\217OM\346\362\341\016\316\235!a\207\024ns,\034\265'P\320\353\374\336!\344V\310N:\252\030\362A\362fk?\252+\361f\t\244@2\352\361pz\025\367\350A\322\267\362\251\240\n::\362\221%#\312\252\213\315V\241\362\332\231\265\241r\233\254\331\327\016\300B\263\256\255\221r\201f[<\034\324\243l\0304h\220\217\256\375S\r\036nCE\250a0\306\220r\0022\031\2123\205\205\352\240\002\0219\263\r\021\2009\203Hj\251\355\323\204^\007\227\300Zl\t\236\316\207\315\222\017WN\027s\244\020\316B)`\b8\007\362\200t&\352\313u\245\301\032O\300&\234z\3566R\f~\\\302zK\274CC\030J\341\030\324\255\313\323\210\311\330\\\341\227\034\306LV\275\374\223&+\213"
+	.ascii	"\232\007O\013kQF\353\326\021Fu>P6Q\266\315\0020\025\303\336\372"
+	.ascii	"\274%\203\244\341R\372\273\233p+\266h\006\003M\025"
+	.text
+	.section	.gnu.lto_writeStats.part.0.35.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"\335\f"
+	.string	"\346\027VB q\223\016\034\343\206\214\022"
+	.string	"0\240x\342\310<_\203H"
+	.string	"\323\001\230\310$\300\220#\006\241\225\273[\353\035!\340\233\361!\324\323DI\250"
+	.string	"0P@\b\f\024b\0214\274\037\324\0312b\367\336R\246\024D"
+	.string	"?"
+	.string	"D"
+	.string	"+\0070"
+	.ascii	"@eh\201\332]\353PE\334s\370"
+	.string	"4\243\307\277\351\030m\373\034vl\035\376R\333N\256\217A'\003Gf\023=\217\021\t\355\246\347\206-\224I\340\361\362`w]y\270/\267\r\301\366\002\373#\001O\271}\024\035\337\344\214\355\247t\316\231 P\r\013\n\321\340\320\231\366S\\\205\347\234\311\007\354\222h\250\354r\016\016\255\240:4w\217xX\275@<\314\034\376\204\355\216\275r\016e9\330c\007\026\221\020ON\"\375\030\22366\222\327L\222:\035\245\245SQ-\331.\211\327l\205\rQ\2668\246Mr!\257]/1N,]H?\251%k\374[%\331\232~\225`$\340\303\356(\225cA\300\031%\002!\023@6\317\327\307\206\243\341l\254+\304\252 \242\241`]\331\306\3720`\314\002Hfq0,\263\362o\225\344g\242c\351@\032\202Zbq\377\305a\224\370#\254\271\240\177\305CX\303\005\352\006(S/@\276G\210\016\032"
+	.ascii	"w\013\262\2671\372\020\370T\032\322\b\205\215P\315@\302\252C"
+	.ascii	"hZ6u\274l\b\016\020\005\303\\\341\224\232\300uQ\301\365\367\264"
+	.ascii	"RT\273:Wq.0N\\\314;-M\323\024\272\327\2261"
+	.text
+	.section	.gnu.lto_statsOnDisarm.part.0.38.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375`\343\001\005\020"
+	.string	"\306\033eH\360\260(\035x^\224\\\360\303\"\331a\254l\206^\325\205\256\222E\r;\256\\`v\026vV0bq2\335\020hg\037\317\032\0322j\350\227\002\027\t\270\tq>\242\314\255(\214\360+\366y\322\361\214\f\262\311\336)\005J"
+	.string	"M"
+	.string	"V"
+	.string	"%\334\235Z\004$\276\246\205\333\017\0341\025M\317\356\202\234\032\001w\372\021\266\303\321\242]\343\265\265\177y\210"
+	.ascii	"\233\355\256w:9\\\374\224\232\350\277\276c\305J}\002`U\270\024"
+	.ascii	"p\215cdw\315Y\270\351m\203l3\260\245\203\027T\256\343\311b\306"
+	.ascii	"lw;?v\033?\007'<l\305\237\227\272\254\361.\037\307\335\3537\342"
+	.ascii	"a+\\j\344N\274D\364\354\326\004\334\351\347\004\266S\355\003"
+	.ascii	"\266S\263\334\306\037\255\335\3554\337\025\372\325\235-\002\n"
+	.ascii	"_\323"
+	.string	"\342O\252n\314\370\333W\222_\3719\377\204X\006\036\230\231\222s\306S\273\266s\203=\017\310\002h\330\215\271aceh\013\232\273\376\330]\230XlRp#\307\025\241\301\021\225\004\030\r\005\006\032$f\373RA\234\342*T\f\032\250-\n\246\0202vf\273\325;u\3456\373\262\357\004\206p\222B\2022\231$\242o\324\300D\364\235\026\240\214>\017\207B@T\t\n\364B\017<\224Q\311\347\205N\240\027R\300\245\024\321\311C\225J'O\276\236\213\201\340q\231\2529gl{\310\017\0232\367\213\355:\227\221\270]\027\030\217q\342w8\365\210$\277:\365I\0010 \220\002!4sd\230X1\230k\231Gl\022 \277p\210J\343\230\270Q\n \3622\302\037\243\377b\024\244\354\242\203\200\246ET\323\311\226=k\357bx\261\275C\360\023\212\033\235\273W\007XszA\365\272\210\342i\021\374\260\216"
+	.string	"\212p\301 \333\341M&\024\b\0238\206\036\240\235\262\320"
+	.ascii	"@{!9\375\351\327\3661"
+	.text
+	.section	.gnu.lto_.symbol_nodes.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\025\007"
+	.string	"\222J'-\200\251\351\034\215cn\301\302\266y\005\262\310r\272\035k\331\221g \310\210\214@\350\037!k\326MDDD\204\226\232\321\337~7)e\ng\026\362\021\b\023\n\311\262\216L\t\207\206\310[\236\362"
+	.string	"8\311&\274n\301\327\301|s\313d\250\240\2104\337\00534\2762\026\300xq\261\226\335\3753,\316\262\032\240\330\322\trR\303E\317A\\i?\036K\372\003\205z\330@\035\314\375W\b\361\330\030clx\322\375sk&r\377\033\r\341\366\360\363\017I\310\244\273;\200\t\364\177B\002\033"
+	.string	"\200\340\026\202q\022}3\210!\315\203\313\240@="
+	.string	"8"
+	.string	"8"
+	.ascii	"8|\200\300~i\314\b\343a[&\310R\001\246\352\223\231\031&\206\341"
+	.ascii	"\343a\354PR`\001\033u\032\202Q\204\"K1\024\346UP"
+	.text
+	.section	.gnu.lto_.refs.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\262\205\016\023\200'\35230\003\323\213\302\020\372'F\362N\322vJ\001JX\007\257`\033@\n8ZL\211\355\246i{\246\304\3503M\202v\034-\3630\252\312^\212\354\303\332\362\256\026\002"
+	.text
+	.section	.gnu.lto_.decls.454882756ee0c51e,"e",@progbits
+	.string	"(\265/\375`%\021%T"
+	.ascii	"\232\213\004\037T0P\302J\007{\330\334\375\335\327\301\311+\025"
+	.ascii	"\322]\223.\220Oo\262\360{\347\177\323{\273k~\263[\033\351\013"
+	.ascii	"\302\334\343'sw\017\t\345)\027\035c\352\256\303su\0345,\365\261"
+	.ascii	"\305\016\306\260\\\236Y\277(s*\272\204\b\365\2406\357\nG%v\313"
+	.ascii	"\024\216\001\337\001\345\001g\0368\313\325\266;\254\273\317["
+	.ascii	"VxL\307\246\333\331\205\325\335\236s\370\207\316e\274\003\217"
+	.ascii	"\231x\241\333\td\347)D\016\263\265\3566(h\027\024D\324:\265\334"
+	.ascii	"\250\334\374\223\343a\237\3349\271\236]\357[Y\214\257\260\024"
+	.ascii	"\210u8\343\3009\334\006\3316\264\273\335\261A+\363#z\325\227"
+	.ascii	"\260\236\201r;\f\224\373\2145\005\377\344T\366\311\361\027GY"
+	.ascii	"\272c0\\\361\331;|v\334Au\325O\260\236\253\274\204\263a\034\305"
+	.ascii	"\312B\277\361.\367u\375\224\177\240;/mf[\274\200r\214@;j=O\354"
+	.ascii	"\2641<\005\271R~\206\302[\334\205K:5;\332\335\366\220\200\202"
+	.ascii	"\245*zU\356\272\034\205\333s\027s\275\005\214\353\220\275\325"
+	.ascii	"\335r\227\332md>@\207\371\200\032\262+\243WN\375]\337\362One"
+	.ascii	"\037\0068\370y\003\316\200e\350\374\027\201\004$P\201\"\002\236"
+	.ascii	"\377\332\364h\371\237\345\277\017\fA\021\330K\374\367\200\007"
+	.ascii	"\210~\036r\340\377\002\327\375w\305\3772\377\307\374'\363_\355"
+	.ascii	"?\232\030<\346g\034\303\370\031\347\305\177\023\267\371o\315"
+	.ascii	"\317;.\256\376w\201\237[\374\314\373\271\201\237\025\370Y\305"
+	.ascii	"\317)~>\3613\317\317%~&\340\347\001~\376\371\331\347\347\236"
+	.ascii	"\237u?\337\237s?\253\377\323\374?\342\277\016\377\243\3747\342"
+	.ascii	"\377\332\1773\377\247\377\315\376{\375\177\376\227\362\277\375"
+	.ascii	"\217\342\177\331\377\365\355\355\355\355\277\f\3748\026\277\356"
+	.ascii	"IK\024\222mS\231l\233E\236F6\213\335\355\222'\0315\0269\tu.\223"
+	.ascii	"\320\346\262\247\221]l\250\221\206\025\331\\&}h.y\222P\3432\211"
+	.ascii	"t.{\2204\255\214\310\301f4c)Id\357x\2422*y\246\311\266\331]\272"
+	.ascii	"9\332\324J\025\335TMe\027\243\024\213\035\247;\216a\306&\001"
+	.ascii	"O\307\252f#\247\311%\315\356%\307\244~zQl\247]\204\247\305 T"
+	.ascii	"\355\324\324]@\267\335O\335E\356iw\027\273\233\204\222\252\355"
+	.ascii	"\226\201'\211\365\364\324\315\334=5U\361JS\367\215\246\211-\223"
+	.ascii	"\320\252\346\320\025*P\254v\241-2Vwq*WhQJ;u7\227Y\261\226Qd\256"
+	.ascii	"\232f\2473\325E\272e\313\021GB\276v c[\273O\234\220)\231\213"
+	.ascii	"8K\271\b^\313\240\355\342M\325TT\333Z+\231+j\204\faN]\025\315"
+	.ascii	"n\347\352\3149\344\252\277G\326_ g\324l\236\3170\035\266\324"
+	.ascii	"\370\214\273t\212m\363h\021\005\212\271\266\245\306Cl1\017@0"
+	.ascii	"\232\211c2\0036.5\027\377\220\032wa0<e\266\r5\002\024(\246\031"
+	.ascii	"&\303ex\fKY\215\2038\207a1\337\265\335\310\356\016\n\n\n\332"
+	.ascii	"\345`9#\023\344F\275)\330\007\314\027\03510\\\021\271*{\3411"
+	.ascii	"hd:\320\020\301RN{\030]\233\2701\223\205D\354\252?\303h)D\201"
+	.ascii	"i\303\254g.\353\317hB\360\031\232\230\224\253JY\b\016\342m\357"
+	.ascii	"p\2161\024_"
+	.string	"\270\262\236\303\3263\025\236^)\035YPW=?\341\037\256>\23398c\ffV\266\224\251E\334\246\224\271\352]\220\361\030O\243\026lq\251Mi\001\203\313\230\n\207\361\224\031\201VT\255\273}\340\036X\013\233\261\224\313\030K\227\311u\002\302\314\351x\227\\e\225)\"UWM\222\344f\345\252\264\230-kj\rl\\iYmFL5\323\250!Ar\225\307!\033\210\024k\347\331\343K\213\013\021\"\367\212\237\006\204A1\021(\203\236\261\341\367*'\007\255\261\267\253\336\"\327jm\241\355\0061\253kDG\355\311\330\204\306\351\315J\216\223\251=\256@1#\013\022\344\016y\240\275\260i]\031\312l1r\205\374\016qk\032\003\306\205E\232\325\221&N\347U\356\224\350vH6\371ad\2753\314p\233\0010\351\264-\240\335\021-\033\232\334e\223DI\225\323U_\323?\316\322\373\203\335\324gG\231"
+	.ascii	"\246\003\206\265n\346\212\225\213\313\205+`|\370\3401\265U\241"
+	.ascii	"%\252M\313lj\212\307\324g/Ih\242ai\325$\351\246/YR\322+\305m"
+	.ascii	"j\333\313\020\262\2505\254=z\\%w\0031C\356\013\214U\031\325\032"
+	.ascii	"\025u\225k\033\340%\252MK\327\303\313\314\023\250\035w\271\343"
+	.ascii	"*y\234\307U\256\305n\366\272Z\261\020I\343\343\252\277J\025\271"
+	.ascii	"\036'f\375o2y\235\370\331<>\210\002\211\262\326\235e\305N\021"
+	.ascii	"M~X]\365\276ps\260\364\304\325\221\343\366\304\355\210\257\365"
+	.ascii	"|\"\307o|\"w\034"
+	.string	"\224\3656Io\023wq\333<\210\312\332\025\307\035Y\213\367X\274\310\\7\267M\036\312f*\201\376\237a\351E\276\346l\311\021\351\333\355_\343\257\221\323\270\225\335\314\306}Yc2\201ro\322$\223\253\036W\265\036\267\\\177\377\\\033\225\335\rU\323\266\362\250;\3270\003\3759\214c\025\215{1\355^\3224\263*\261b\364qS\364\265\272\213=\335\2662\tu\026\223S\316\226=m\3230@C\203t\262u.\325f\337n\233\033\351\f?\245\023|\354\r\032<\342\360\227\002pxT@\356\247t\202O8C\347\350\210\002\234'\t\361\226\200\003\344hx\020\302\0073f\340\360J\340`\207@\013\2009\301\037K\304Q\003\200\240Q\217\310\204\304[\002\006\020\224!\324@\250\302\222\322\005?#\241\257\306\007\030\374\020\201JJ\300`/8\364\335\004\207\024\b=\270a\201B\rlr\202C\037\021h\201\320\203"
+	.string	"\236$d\324\023\336\030\242`{D$\210H>\245\013\220\204\300\340\320\207s\364\033\002o\240\360\013\341\227\202\217\250\273a!\304\016}LB=7\002\016\177\302\037\322\372\0271\032\210A\264\002\211\023\025\261(b\221;Q\321\320PQ\214\241\3651\206p,\333#\322X\317\326\370\261\300\241\n;O\022\342\031\331 \300Hx\343\002\335\252\004d\205\"\034\375p\370\224~G:b\017\307\220\025\316H2b}LD\340\321\016\273\302O\250\376n\200 \004\326\374z\277\243%\032\303\037\323\357w\202\356IHL\002|\211\3517\344\261KKC\036\016\261\207\004\264!\\\222\221Cd\223\220\200J6|Z\270`\205\300\033k\260\307\022\201G=%\037\273\304\366"
+	.string	"`{D\254\020\230\373\320\220\214\024\"t\200\301j$\3043\262\301\023\002}A\236\321\220\310\023\372!\366~A \333;\372\005\207\276\236\020\030\354\021Y\037K\024@ii\251\202^M\330\325\364\013X\024\230\264H\rJ\304\\5M\033\246s\2336\311q\325)Sn\324\206\247\217C\350\020\213~\031q\241\007\220/*kVk\004\333\341\234d\215\006d\355\352\272^6$\2620a"
+	.ascii	"\362\272O\034\253*ReO)=`\261)I\323\326\220*\342v[\3062\201\230"
+	.ascii	"T\016*\312\220\033*N\274D\271n\263\0022NB\256\332\252\307\036"
+	.ascii	"\242\250\240\260[\321\323\23107\360\330Z%\314T\307\2236\034\022"
+	.ascii	".lE\255,\\\231\025&N\234p\232\332\244\210\221H\023d\201"
+	.ascii	"h\250\201,\247\230SFdDDD\222$I\007A\005\204 ')\255\007\0210\251"
+	.ascii	"\263h\212$I!\313\030\264v\240j\200\tZ\340\330\247\202$\251\317"
+	.ascii	"/U\241G\311\312<\002`Q!\006>Wn\315Kv\021\037\rI\244\313\315\312"
+	.ascii	"\031Bh\rOE\320\241\273\034\206z\300##e\022\202\332\312\354\260"
+	.ascii	"\326\224\236(\0072\225\200\274\355(\263Dk!E\032\375\243~`\034"
+	.ascii	")\005\217\242\345\317.\0259\2313\004\374\301G\303\253\277\036"
+	.ascii	"\224\354bV\t\374\271\277\215DD\245\r\264\330f\273\374gQ@IF*\270"
+	.ascii	"\352\326\231\204\305\203\304\212\203\373\025\017\343\320\005"
+	.ascii	"$\260\234@\303\211JQ\\\345\002}\301\332\020\263\331\2778\367"
+	.ascii	"\247\370\031\262\213\306\230\223\340\201`\033\300;\221\251p!"
+	.ascii	"\020\321\207\352!\004\201\355'\253\275K\bn`\260\217\375y\037"
+	.ascii	"8\266\275{?]\0169N\226\312\f\022\254\264\017\274\254\321\371"
+	.ascii	"r\f\264\374N\234T\373\273\307.\310{\2604\177\237\017f\232.A\005"
+	.ascii	"`\"\260\326ob!\202\233\256>=k\211\202\312}\216\3653\242x\216"
+	.ascii	"S\2050\303\003&\225,R~:+\215L\256\242v\233\301*\231g\020\253"
+	.ascii	"\232\322\363\232\240\212Q\005\020\213\255\304GJ\260\205\263+"
+	.ascii	"\351\300\023;\032\212g\350\356\351\355}N\217\310n}\337}\260\342"
+	.ascii	"\364CH$b)\332L?\316\033\254\031\007A\250\256\213w\024\027\302"
+	.ascii	"\313f\3447\311\007B,\\J\344\343<\374+s\214XU\211<{\022\245\021"
+	.ascii	"tU\255y\236\005\207\001\3773I&\342\203\370X\212\222\3657_\362"
+	.ascii	"\277d\361\004pR\\\t\336\343\020%@*\t.\265\312H\303\272CiV3q\206"
+	.ascii	"M\321\032\256B\364\245\227\214\312\361\2021m\001\356\261r\335"
+	.ascii	"y\244\0031\023a\245a\362\342\334\313\177\340-\242\005\\\235\226"
+	.ascii	"\306\362%\331~Kx\n\224d\360\004`t\004\fU\t`s5w\226?'\004d(\273"
+	.ascii	"\346\bq\267\352\375\027\277\361\302x\360Ro7?\"\361M\371I\311"
+	.ascii	"\315.\342M\273W\255\321\206\353\264\371l\227\002&%\263]\370\276"
+	.ascii	"\3555\002R\303\214\350\033\257\347\267(&&\007au/\373+\257\300"
+	.ascii	"~\221\027%\020\032\350\027\264\0361\224\276\037\236\317\375\031"
+	.ascii	"\333\320\360c\333\260\376\255\376\325}\355\374\342\037\353\363"
+	.ascii	"N\007S\2123\347\333\362.\001F\017|\246J\016+c^pF\372\226j\253"
+	.ascii	"l\243\373Y\354\316\fi\017uO\305\226rw\315\243\306Y\376O\333B"
+	.ascii	"\307\270\222\333\370:'e\274\274\017m\337\225E\275\306\245\266"
+	.ascii	"\241y~BW\001"
+	.text
+	.section	.gnu.lto_.symtab.454882756ee0c51e,"e",@progbits
+	.string	"writeStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"writeStatsEntry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"statsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.454882756ee0c51e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1546 @@
+	.file	"tasks.c"
+	.section	.gnu.lto_.profile.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375 \261\325\004"
+	.string	"\204\b\245"
+	.string	"\017"
+	.string	"\354\301\314\336\005"
+	.string	"\001\314\345\244\232\005"
+	.string	"\002\223\317\352\353\001\002\002"
+	.string	"\002"
+	.string	"\004\276\376\210\236\003"
+	.string	"\006\275\236\357\212\016"
+	.string	"\007\313\233\235\316\016\002\002\001\002\001\t\204\337\376\243\007"
+	.string	"\n\376\376\316\323\004"
+	.string	"\013\376\303\253\241\n\016\305\352\265q\017\202\312\321\202\003"
+	.string	"\020\316\305\360\246\003"
+	.string	"\021\262\351\201\314\013\026\002\002\002\003\002\004\002\005\002\006\002\005\002\001\007\002\b\002\002\t\n\002\013\027\346\300\255\206\004"
+	.string	"\030\300\255\361\243\005"
+	.string	"\006"
+	.ascii	"@\fP\306v\371\214jzT%\316\006\332"
+	.text
+	.section	.gnu.lto_.ipa_sra.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375 \372\205\003"
+	.string	"\244\002\356"
+	.string	"\016"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001\002"
+	.string	"\001\004\001\006\001\007"
+	.string	""
+	.string	"\t\n"
+	.string	""
+	.string	"\013\016\017"
+	.string	"\001\020"
+	.string	"\021"
+	.string	"\027\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\036"
+	.string	"@@\n\201\244\b\310q0\024\002@ e \346\275\\\306Q\006n\f\025\334BQ?({.+"
+	.ascii	"o\023v\234 \227\013\303\330\344\003-\223\212\033gm\347\204\225"
+	.ascii	"\033\240\ftZ\2009\\\025~6\200\005"
+	.text
+	.section	.gnu.lto_.inline.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`+\003-\n"
+	.string	"\322\312&0pK\323\030\344\307=\312,\240\236\002\271\215\227`wT$\211\034{\303\203\022\370\004\217q\360\273\377\377\017n\274\317\232u\023\262\327Z\263{K\231\002\377h\236\025\315\324\001\275\250\350\360\270\020\350\307U=\244\303\224k\001\203\343=QL\202\035}\373!\027w\367\355|Jd\026\365\206K\361ur\032Q\0350\300\337\347\3242(& \240j( $@7\315\314/E\375\237f\341 @D\240md\026\345\254K\321\321\200\326\260\273\220\363\225\371\202\3355x\375\234tw\267}\264\263\004G\2501\272\021\t\204\0246i7P\"B\205\346\001\022\340a\251\002\006dA\306(\2012F\211F\tfj\266\367\330\223V?E\r\200\351\337w\302\322\211\346\365\275\177"
+	.ascii	"\222\342\272\245\025/\354%\007\\\226:K\3437\216iT\312\217\251"
+	.ascii	"{$\254#\221R2\371\234\254\002\204\032\244{-\347N\016\333\246"
+	.ascii	"a\231\310a\206\bM\313Jk\210fl\231\004\352X\371F\376 \300\336"
+	.ascii	"\352K\002\272\240\263\252c\315\f\274S1\245Jh<\266B\005LV\252"
+	.ascii	"\344w9\267[\215U*\312\"9\320\243\314\022\036w\3541\034T\245\271"
+	.ascii	"{"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`v\004-\016"
+	.string	"\346\22195P\245&\3510+;\305\204\313\262cY\005\376`"
+	.string	"\222\210\252\252\272m`\253\231$\266\303\361\235\315l2\231\fX\236\251\255c\177#\255\233\265o\1777Bv\222\001("
+	.string	"'"
+	.string	","
+	.string	"x\023\360\206\035\n:C\r\016\360\205\241\351\006\310\241\346\\\213}Y\226e;Ow\236\333^\016)\034\177\n\333oU\b!\237\241`\373K\366K\342g\033qnM\"V\302\214\271}M\241\274Itm!\215\260\b\233 \361\201\370y\315\311\347d\231\217\007\004RAQk\262\252\336\033b\304\267\254\037\306\003\246\370\211\321\365}\336\347f$J$O&\022\353\265Z\342#\256`\273\316d\235\360j_\351&#"
+	.string	"\243\033\343/\216\"\251\303\322\261t$)\022\2610\f\233\246G\216\266qi\334\232s\210\220\305\350\004\024<\357\201,\203\240\177\2501q5#-H*\225e\f\360\302!2\017\021@dj\314\220\214\314h\201*Y\326b\023\320\207\346\371\270$\225\2613&\030\301\022\330\t\032h"
+	.string	"\257U\022\212\031\302$Y\321\372\353\2662)m$}\023\030\017\322\3258\274\213\372\bWb\022{\207\254\204u\036P\236\235\246b\314'\364\307+\023\245l\0325wW\256\202S\345\261c\210T\321\375\200\306\032\236 \203\265]q\2223\237\030\335+\216k\217\\\0161@\350;\207\021E\222\371\017\274IQ\025\223\202\244\261\370\231\016\250\273y\221\237\301\222\031\031\325(YYnZR\037("
+	.ascii	"\216\303\240+\204\252b5\233\306\034\320\214\336a\353\205\r3\223"
+	.ascii	"\271t\3722\231\301,T\340\223\205\240\364g\234\341\265\004\240"
+	.ascii	"\370\231\204\036\25080\003"
+	.text
+	.section	.gnu.lto_.pureconst.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\200\004\001\230\004\002\230\004\004\230\004\006\230\004\007"
+	.ascii	"\230\004\t\230\004\n\230\004\013\230\004\016\230\004\017\230"
+	.ascii	"\004\020\230\004\021\230\004\027\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375 \326]\003"
+	.string	"\242D\017\031\260\325r\f\3030\f\3030\020Zk\315\310vs\215\355\035\213K\266&S\n\204\355`.\330\006\346\320\0260\277\346\326\274\332 5\237\266\322\212G\247a\224\004\211\366\241!\341\356v\261\020\023"
+	.string	"\277\231-\3006\026\"\240\270\252.p\356!X\230\204\267\200rIM\330\305"
+	.ascii	"\001\263\020\f\bA\260\315`\001\301 \353\r`\001"
+	.text
+	.section	.gnu.lto_.lto.3d0ff22065f53f56,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskMain.124.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375 \362\235\006"
+	.string	"\242\214.2pm\032\003\240\361\207\034C\314\272\342\206\207\241\003\005C?\0137\206\232H\b\364\246\021\273(j\313\250\030\370\353\003+U\305\372\031BO~\267$R\246\024\222a\362t\026\252\317\024#\004\f(\334H\007\311\251\036lx\237\016\307\363`\224oCP\352a\212\257\242\250\3702\327\335D\325H\264\211\366\002\261\226\321\332\362\377m\242\226I($\005%\177\305\212\312G\234\bG\246\255Y\353\016{L\177D\024\363_\214B\376\013\241\007"
+	.string	"v\032\017\\\354,\026\270\330u\266'\2766.a\230P\200\244\374\177M\303\323l\326\036\031\023\262@f\222\302\377\262\220e\3416\2675h\233\320\326\n\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_taskHandleSerial.125.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"%\013"
+	.string	"\206\224L>\0201\324t"
+	.string	"\300\313m\311\204*7x\016L}_\211\001\005/\372C\026\003\203\241\237/\306\326\264\335\336\333\266D\364Y\373"
+	.string	"\2517"
+	.string	""
+	.string	"\"\020\n\246\250. \353\370H\300Zo\262eJ\0019"
+	.string	"<"
+	.string	"8"
+	.string	"\273\232\f\361\357\363\222\372\371\220\320\363\371\030\375\222\242\026(\032\251pty- \315\3300 \f]\022U\311\306O\327\f!H5\243\354\256\025\fE7v\333\016l7\260\177 \252\352g\017\306U\016\0048v5\264X;\316\030%\"\266\257\366O\034\305w\323\005\003\330\365\340\342\305\256\310\300\n\036\237\t.\301>\257\027\300>\375\3317.\212\330\254\304\302\260b\265\001&F\220\364\234\004H\032\245;\330\245\004T\215\220\356\260\237\342*:\376\b[\340\350\301O\237\203}^\376t\002,dp\370h\313\026=*A\330\277vw-?\3307\375\001^\004\013\346\002A\223\261t\335f\023\340m\342Q\360*\032m\233\240e.\025\214\266u\23661`\256\202\245\3234\034\327i\021qO\371H\320\204\250\215\341\244\302\320\241\352pej{\033=\350"
+	.string	"\251\023"
+	.ascii	"2\003\302p\311\302Z\021h`\366\202.\240\326\005\256$J\026\\\025"
+	.ascii	"aW\322`\241\300\224K\260\304j\312\270\3137\333\223\n\263\242"
+	.ascii	"VA\001"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.126.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\255\013"
+	.string	"\346UPA O\234\01601T\221x\242&\245O\016\271\304\366\252F|\200v\2023\307@%\303\246l\3422B\204\003(\320\250\034>\3367-\340\371\217\3254\001\233pp\343\033@\310\235\205!\350\223\275\267L)<"
+	.string	":"
+	.string	"?"
+	.string	"\266\213\203\247\225x\234L\"d\354\356\0251|\273\214\272\371G}\342}\334\245\205G\211I\221\210\021\340+I\313\206\006\357\250+\205\257S\225$\330]\253\367U\270\347m+\260}\300>\202\366\345\356\256c\207\255j\353\037\377T\365'\224\324\n\314\210\335\215\221\031\033\316\022\033*\266\257\366;\334\303\366\217\t\236\354^8\021\262\013\032p\001\353\223\300-\325\247\274\200\352\323[\216\240\351=k\200\240\b\273\310\375$\222\n\211\276TV<\352\026\213\020-J*\342\377R=Z\321j\342\350\376\341 D~\006K\030\351\275O\177T}>N\030&8p\220t\304\0069\215\036\001Z\203\215\207\303 \364\331d\231\b\003`,\243u4M\350\302\034\\\037\216\306sa\231ve\006\030\004a\223]!\020(\273*\340^n\354\360\202\027!)v\0174\212\212\212\316hw<\n\222\",ENZ\352\023"
+	.ascii	"3\241\201(\006\210\243\\u\330\246a\254\232\023]\206\007x\023"
+	.ascii	"%\013\256\256\260\213\037\314\261(\373\n\246\\\202%VS\304]\236"
+	.ascii	"\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.127.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"m\b"
+	.string	"FP<8Po\322\001p\372\311\275\252\262S<'\306\364h\322\005\f\354\315iZ\034Z\326,\342\274\267\004b\220\276.\202\324\005 Qn1\277x)\002\006\36215k\311&[\246\024)"
+	.string	"-"
+	.string	")"
+	.string	"\227\376\354\230\207\036\273Q\205d\240\310\354\356\214\035\377\256\237\177\222w@T\351\272a\330]+\210\332\270\343m\037\330^\260\255\022\366W\277^"
+	.string	"-\227\204\227]\215\232\326\262$\013\210\307\366\325\276\310G\276\257.\334\331\345hY\331\r\025\214\300\27148\001vy}"
+	.string	"\013\352\237L\274\344&\235\377qi\022\205\036\274\f\270a\260K\215v\205\205\036\264\246\314\2600b\311\016O\032U\366\257\335]\307T\335\203&\n9x#\215\343H\231\200\263O\027\321\201\274\231A\314Q\b$\232\031\327\315O\2017\t\215\233\336\266q\323\023\232~mL\271\201\206e\212's\002\t"
+	.ascii	"2\241\243/0\\(\033\025J\301\220K\260\304j\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.128.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\265\t"
+	.string	"\346QC=0\345(\035\300q\343\017\201\267\217\230\033\025\313(R\363\026\\(\241\277A\n\216\345\326\344\376\3210\207"
+	.string	"5\210\350\303\234&q\241))\234A\003\355@\236N\026\321\230\210\266O\366\226)\0050"
+	.string	"4"
+	.string	"/"
+	.string	"\273;\243\311\277\313\250\237O"
+	.string	"\236.9!\2172\2015B`\003Q\262#\023S\375u\365"
+	.string	"S\252\233\317\356ZW \310\255\335\266\203\355\006\333\002\0023\0131\273\037\263\002\033\323`P6\333W\373)W\371\356\322\360\300n\311\013l7d\260\002\347Z\347\007\232k\362\006\232k\376\354"
+	.string	"\017Ov\323rQ\261\f\b$\263\226\350\f\315c\304\n\200\224\312\254\251\214\366\005\206~\365\370\327\337\301!\022K\305\223\035\2364\266\354\313\335]G\226}\327/U\375\315\006\013\036Dh$z0\221B]g\301\025\230\363x\023\036\31049\211I\022\201F\223\353\274\351Ap\211\"\324MS\251\324\315-\334\1776\"Jr\324\256\360\364+\307\313\002\017"
+	.ascii	"2\003\302p\036\302V\rt\205\275@5\017\274\264\356}\027\326\013"
+	.ascii	"\300r\261\226XM\021w\271\251\366h`j\017"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.129.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"%\n"
+	.string	"6\023G@ \3078\035"
+	.string	"o\034\214P\024\223\b\235\205`\236+\222n\336\021\020s\326\204\003\370\226`\2126`\003Q\203\006\263vF\316\227\021\246C\206%\t\001\200\315\224\373\024\344\374n\2230\303F\366\226)\0053"
+	.string	"4"
+	.string	"4"
+	.string	"\233,9\370)\025\364\277z&\024G\237\230\221\313\331\340\002\220\340\3435D,M\215\311$\374\352\n\"\222T/\020\273k\rE\221\033\273\355\b\333\017\266\021\004\r\030l\013\013pb\177\264\265k\266\257\366Q\236\002^\325\341\314.I\013kwt0\003\346\330\3025\331\261\371\204\354\230A\373\300\307\324^P\006>V\024\354n\251\227\213%\315\221]V\250\024(\351\313\231\316\2132[cC\037^\036\260\bh\225\344\310\036G*Q\366\347\356\256\345\311\276\352\237\252\376E{\r\330\020\3305\005\037E\347\343\231\b\201:\236'\342\020\314m\276\213\217\023\3328\213\r\344\341|6\316\373\266\215\202;\214\216\267\205\272\316\333\264q?W\236,\261\240\345!I3\243v\227\241\017-\037\016"
+	.ascii	"3\241\367/\306\325PU\330\013T\363\300\013\353\336na\275\270`"
+	.ascii	"\251i\221X5-Nr\314+\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.130.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"e\007"
+	.string	"r\31646@o\323\001\230NL7\f\247\345+\223w\314|\372\200\335\322\365\276s\006S)q\202\240TP\233tD\320U#,\004\034\003KW\266\336\304\320\374\370\326\332\226)\005\332\303\005\3728l\241+\313&\254\200Z\035-B\363l\321\202\210\241\217\007\024\255L\213\235\202b\022W\0267\f\313\"\347\273\251\303Q\033VN\027\020\243T&l)*\322^\263$\345\224\001\273\366\353\022z\264\246\376\277p\324\332d'%\240\322\262`\362o\304\300\374T\241\200p\332:[\207X\204\263\311\242\233\277\203\345\344\377\022\212"
+	.string	"\340\312\300\004\031W\224\0072\256\312\265.\376J\327\220J\032$/\377#$\231sr\265G\274\361D\235S\303\360\277\351\2118\\\350\266\007m\025\332~\004\b"
+	.ascii	"2\241a/\360\270\340\n\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_taskTelemetry.131.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"\245\013"
+	.string	"\226\226QA0o\223\016\200\2050\200crr\0328\016q\2341\001?)\034C^R5H\261$\023\216a\377\023\254\177\f\310B\225\265\326\277I\2663\363\326\200\311f\347Yk\t\241J\277G\241I\333{K\231R?"
+	.string	"<"
+	.string	"?"
+	.string	"${\031)\261`\"\306\356V:\362\354\360if\376O\216\3318\355p\322\360\227\2418R\352+\240\222\002\006\305Ux\032\020\020\333O\236\027\270\217\314K\202\335un\034\206;\336v\003\333\034\373\234\177\273\273\326\020\373&\177\314\264f\372S\206\205\005\202\023\273 -,[\202*J(\333O\373\">\"\273\t\005cv;\240H\331\355\f\230\300t8\340\232x\370\036 \036:\263]\274\013\3670\345\264\227\020ml#\277\251:\340@R\355\356\264\237dE%EU\304\357\210\327\007(-H\271b\237\304Kt\370\037<\201#\277\035\372\034\361\360\252\031V\310\330\340\221-v\247\245\212\330\001\030\003O\350\263`\244\341\271\256\r\013\200\255\r\006\302:\243\312\202Pi|:\241\312\272\260j#\300\242\b\236\253\032\211DWEu{\r\261\202\031%\017\375\200TF\265A\241\374\346\247\232\017\224^\204xG\271j\021"
+	.ascii	"3\003\3369\004k\250\212\355U\205^V-\r\234\321U\370\004\327`\001"
+	.ascii	"\226\213\265\304j\312\370\345!4Y\025&h\254\312\235{"
+	.text
+	.section	.gnu.lto_tasksInit.132.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`K\013\3453"
+	.string	"\352V\314\022E`\246\326\030+\f4\017\326\214\363\322\353\247H\353\013\024\273cMi#\234\307\232\013m-\004P\262\214H\311\305_\245\237\016\366a8]~\330\rm\224|\315f\316\323\376\347\255\362\315\312-\267\334\222-\245L)\245\030\001\003\001\035\001<d\235\205\2543\220u\376\261\316\276w\356\265\316<\326\271}gvu^\337\371\337\331\335\271G,\307l\355"
+	.ascii	"\373\362b\326^\253\2737/\225\265\"\244\317\272\323\332\231\273"
+	.ascii	"\321Z\215\201i?ic\316\314\032\364\232e\005Hn\237\305\bb\256\275"
+	.ascii	"V\021\324\350\316\350\336wM\331,\027\365\232e\227\371L\257\205"
+	.ascii	"\275\315\346\345\351\204\356}\337\345\203\265\333<\311\035\244"
+	.ascii	"N\316\321X$\016\205A\340\317\327\343\265\354\372\356r\363$\370"
+	.ascii	"\240Rf\363$\315\204\370\016OB\217\032f\215\\\027L\321\355\350"
+	.ascii	"\270h\2205h\367\f\323eQ2\3271\033\363\034\261>\212\031\343\242"
+	.ascii	"?\200x1\254\211aeQ.\037\206m\271P\253\203\035\027\325\022*\213"
+	.ascii	"\356p\240P\217\032Y\375\313r\237\216\262(\226\367\342\2429x-"
+	.ascii	"\225\243\333\241\364\t\224R9;\224N\255A\357\373R\371j\243\177"
+	.ascii	"=P\255\322"
+	.string	"f(u\256H\253 \320Vk\257\2226\335y\022\336\367e\207Jk4\3674s\2531\363\005\346\237\203vU\267\377)\267\213\266\375\022L\3108\335\216\201\234\231B\005oh\373A*l\250M\366\177H\317\376/m\356\031G\2521\264\353#}\303y^iZ\350)\030\244t[\006\r\0336\264\315\256\237\202\253\310\026ZZ\322\377\273I3s\350\020\344\017\301\271\326\214\245\375G@\225\244\351w\334\357\337\3178\314\037\032\n\210\336\373:\031p?i\266\020\334c\315\262\b\022\336\320f\271I\264\315\366\303\340\032\333BK\223\362\273^\214.\272*\321\217\272{\251ef:At\243N=\223\201\316\254\242\311\033\312:n\250u\325\3463\231\327\232\376S\346^\337\377b^\235\223\372\254\371A\2475#\275\263\201w.\360\316F\357L\200u.\3529\017`\235\211X\347!\326Y\350\235\203Xg\240w\376a\235\005\274s"
+	.ascii	"\326\331\347\235\001\260\316=\357\314\363\316Iw\336qg$\353\254"
+	.ascii	"\363\3169<\347\343;\033y\316\305w&\362<L\367\306\235\277.\016"
+	.ascii	",7+\253m\026\371Er\303\237\262\216\353\3741\213\320\325j\252"
+	.ascii	"\322U\233s\3244}\345f\246\217f\324\244\347\374z\374\0346k\216"
+	.ascii	"\357\013\323Vg\374/"
+	.string	"\276\221\253\253h\212\017\264\321\206\204\370\336K\355\360\211\337m.\217.\343\212\365\336\367e\300-\327d\\/w\352\202\271`m\263\303\367\255\221R\027\374)[\370C\032\304w\324\005\276J\250\364nW\214\314\025\342\r\025~\320\312\020\252\263\300\007\201]S\317l\201?]\377\367_\254l\243\377\366\375\224\235\247\354\241\234t\253=j\243\257b*\235\364\255\326D@\276\304x\277~\322\263?m4\375\256\327\003\032y\361}\333%\3222\273F\334#\336P\340\363\224t9\237\271\362\0254\2630\336O\373\261\300y\231i\177\037\364\201\244\341\250\277o,r\376\276/\223\355\267\366\375\220\214\222\006\023\343\213\357Q|}\365\036\370\340{\377\203\302\346\252\265\274\177\200\326[\\5-\274O\301\365fM\272\221\214\256\022\2442G\235\352\260L'\224\242V8y\210b\301\364\364\344\202\302\213'\246\250(\245\tLP.\214\274\224"
+	.string	"J\005\224R\324r\311\304\222\005\n\245\246\345\322\023\3242\301\016;\265`zZF99=-\201kR\375_\314l\250R\337d\242\023\370c\321\023hV\360\206\026\275\223\251\275u\325\346T\023\022\036 \215\345\343\025&\227\364)\307\304\230\3109\335\256\251\340\244|\331!\272\271\3270\313\325\020\226\227\032\344O{\355\316h\007\374\023\023\271\247\203\2713|\352>\334*\032\256\225U\333\354\200O\002{c\f\276\301\3211*\373\341\264\300\034\217\332"
+	.string	"\321\227\350\021}\360\315\215\201/\346\210-a\343r\034\372\217si\017}\317\271\361\247,\364\037\207\325B_\364\326%\350\211@\037\264\002=\320\333\333\317\017\005\374\217\322{\002\276\350JI\200\027\372|"
+	.ascii	"#o\237\007\272\"Bu\002x_\317\003x\004@\322\n\336\320\236w2\254"
+	.ascii	".\036\022\353\255\253N\025\333^j\275\360\274;;\371\035\245y\276"
+	.ascii	"\333\250\222\354|\362\373I\265\363*\246EX+\\\210\356\215\026"
+	.ascii	"\371\335\346\312\003\200\345\250\221,d\031T3\"#))I\2411\220\002"
+	.ascii	"\021\241\242\352\006\0208\205\212J\223\f\007U\306J\f\227\202"
+	.ascii	"\355\r\001U\036\255\b{D&\227\n\312j\230\251\202\007\317\017i"
+	.ascii	"\361\210'\246\r*\2154\236\3318!\350\\\003yv\\O\322\336\3501Y"
+	.ascii	"\352\0375\032\236\013\222\255\227\025\212?\034\0035xv\025\212"
+	.ascii	"\363\202\313g\337\203g\331}\372\226\365q\177`\374\002$\236Y\b"
+	.ascii	"\"\013\"\fA\226\366\035\310B"
+	.string	"\023\214\324\363\240\3516\244\264x\225\301}\315PaY\354\370\375\237\316\232\375\004!n\362\035pU-\271%0\244\300\323\377\275\377\324\327\254\243\322H\334+\006|NFg\034\016\214\200\262\342\005\022(\245\236\245fw\030`E\344\244\"J\225\357\352}y\223\311\372\373\357\032\324YS\351\203\336\251XlL\224l\323'2\213\310\322\300\276\244dD.\210|\277b\344B\362\356\221\f\273\210[\r\034\005\031\024=\220\002\270\301&}\034\336\365\365Z}\3678\244 \327&K\373\360'\367\353}>v8\351\215m\210I)\342\316*50\313\350\312\007\3066\311P\253\355B\274\331\305\017\200k\017\201^\235<\366\302\2024\252\3636D\2461\305\266\271F?[\314\310A\330\203\363t/\007\220\007~d\207 \001l\220\262S\372\022,B\241\364\363\275\274\256\361\242\206>2\246~\315\247/Z\321an w\274M9E"
+	.ascii	"z\216\021\253Q\247\340M\004\023\037&nx\3719\257\024B\253\347"
+	.ascii	"G\237\"\226\033\352\243I\353\340\345\020\304\233\006x\336Ftu"
+	.ascii	"6\n\361\031\247\357~S\3321\330\271O\317[r[V\223)\272\253\001"
+	.text
+	.section	.gnu.lto_tasks.133.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`X\006\225\035"
+	.string	"\346\254\257I`\034v\003\377\221\036\224\342\327Y<\253\212\345\025\216\335E\254?\334\304`\226[\026Y\215c\254Q\022\20218\020\337\t5w\342\350q\321Z\377\231UM\353{\362\316\356\035\206\304G8\303w&\276\177\233D\354\366\373#\245\024\242"
+	.string	"\237"
+	.string	"\236"
+	.ascii	"\301\317\306u\341C\242\002\264\331\375\211\033\024\tt{\327\303"
+	.ascii	"\357B\307DuPM\235\037J\230,\231@l\357 \242\357\336d\242;F\354"
+	.ascii	"~\204\r\211\257\350\313hp"
+	.string	"=\207\227\200\037\306\016\304\356A\206\b1:j\357\006\305\017\224F{\232\235O\007\350\330\301c\215\267\353+G\372\262Z\225)%\320\r\350\372\332g\030\273\324\356j\307N#\251\327@\366\033\031\224\t\226NL\016lh(\300\024[.\357\r\355\215`\307a\311\303wylizC\263\\2\365\247\276\332\334E:\237v\036]_\271\024\316u\307l\034\265\312\251\177\365Q>\205G\321\317\272\276;E\245\352Ix(_\002\354\353\273kU\242\254\007a\373\020G\177;\211\370ac\355\335\235;\262\245\036\270_\366;@\243Z\334:\237\276\331~\351\231\374\207o\366\237\355\335\231h\037\302\323\213)u\313\030\273\031\273\237I\203\246K\245\375\0312T\312\302\2557b\342\306\364\246\257\366q\240Ip\270\330\275\313\027/\277\306\333\336\311\336'z\236u\253f\016\234\335\257d\301\002\377\332\273B\374)<\305\230\322\034*\033"
+	.ascii	"\336\354>\205\n5\002\260\275\213\002GI\274bR\311\3639\300\221"
+	.ascii	"\030\220\222<%$2\311\303\341\035G\317\321{t\037\235H/\322\247"
+	.ascii	"=Io\322\235\364(]J\257\322\255t-}K\007\323\303t2\275\332\325"
+	.ascii	"\3645\276\211\201\037\341\237\274\t\177\302\253\360R\236\312"
+	.ascii	"Wy,\337\364[\236\313\213-\3602\024\374*\037\245\315\366cdH_\026"
+	.ascii	"\003F\333\325w\235l\336\331\345\277\220>\f\354\233\265l;\257"
+	.ascii	" X\037\350\271\305\224\362dy-\377\242\257e}\367v\253\332X1\257"
+	.ascii	"hh}\327I\315\371\025F?e{\026.Z\244q\375\334\367\006\345\225\003"
+	.ascii	"\341\232&\322,\207\353\327'\034\262<8\023\177+\237\341Z\216\037"
+	.ascii	"\260\334\027\013s\274\327{s\365\353\362\241\331\206\313o<\303"
+	.ascii	"4\313\201z\365+\244c\237\313\341\337[\313A\241:\b\236\347ao\207"
+	.ascii	"\323\365\f\313\257\021q\206\353\372\375\321\341\264\360\227\343"
+	.ascii	"4\375\n\201\301^\313\203\363\373\263r\3307\254\343Z~"
+	.string	"]N\234k\030\b\313p}\303\341^,\004\373z\263\313\207\202?\3018(\026\272\274\350\243<*\217\224xE\013\274\013v\200\221\250A`\212 3*\252Si\016\020#\0211n\003\020(\205\310\206\252\320\030I\307\024\035M\3039\250\353z\232S\304\260A\205\211\304k\333\256\321d\320s\240n.\300b\211-\305\244\212\013\004\223\240\303\332m\231\255\nj\372\377\311\210\332@\303\234\177\223-\363SQ\020\243l-z\264\030\031\243\005a\362V\002<\264\036P\213\206\242\234\263aD\316\035\267\261\032.\274&7\027\032\232\321\234\227R\"\272I2\245c\334\177(h\2201+\202\0245:T\302h\367M(\253\274\315\253,J\241&\006X\362`=;\204\252p\211p\336\364\336 \276Oy\343D\016\276?\242\302\021=OhO`\276\305oX\313\006\007\351\320\376\200\212L~\005by\232}:\234\210\203\252\375\214U"
+	.string	"\303\262F\363\222V"
+	.ascii	"\216l?\036\273\361-\020\205O\226\017(\360\367\370"
+	.text
+	.section	.gnu.lto_getTask.134.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\265\b"
+	.string	"\346\220=90%'\035\236\365D\344\022y\224WJS\337\245\364\b\035\257\352\324\252\013\205\200\266Ij\223\373\004"
+	.string	"\262NjB``\200h\030|;\301\026;\017\205c_\373d\223-S\n,"
+	.string	"."
+	.string	"+"
+	.string	"6\034\252\233\335)=\357\271\0369'\270\036\241\310\275\253\347_\345\026I\200\232\317D\272\0068\354\256\3653\235nx\333\t\266\027l\323\0041\273\035+"
+	.string	"+\023_R\266Gv\307\266\252}\224\247\214>\025,\260\373Q\342\262;\031\214\300y\374X\266}\223\237\214\354\031L\324\351J\005\234\007\265\273\r+g\271\360G\036\215!\322\177\217\276\350zT\370\317\243\244+{\222\024\206\330\267vw\rA\254\237\377\255\003\230\031\215\020\017!\016\353.g .\304a\235\314$d\305\004F!\263\215\223\240\002k\026\021\233\3544m\223\235\271\267\302O\tn\330o\361\006P\237\355\214\253\002\013"
+	.ascii	"2\003\302\260a\234\"5\246f\323>.\243&\025\355Z\305\203\273O\252"
+	.ascii	"\025\2230\311"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.181.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\215\t"
+	.string	"\246\321?9@\305(\035\374\002\247s\013s\\\310\315\016\265\017\013\301`\327\253\024\232/\223\034\037Y?F\026T\373\224\244\221\230\305q\025V\344\300\002\013q\036\221\322$\203\264vo\271S\n-"
+	.string	"."
+	.string	"."
+	.string	"\366\312\277\220\305\250V\033%\257\335\235\227\252\272w\205\321\363\337zV:\221\256\001\247\216\303\202GL\303\356\032\363\270\345m3\330^\260\237\005\020\376\033\235%\212\337\236L\206\320\376\310I\274\263D\316vALPv?\205K'`\227\b7\270\\\306g.\227\366El\217L\273;\355\005\035\301K\302\253mq\001_\262\300\t\213KCIPS\326\030WQ\366\277\37723Uv9\002\264\354\207LY\331\276\375\326\310\326\264K\333\001\035\004\307\323y\b}8\034W\261\rx\323t\022\335&4\267\210\371\351l<s\343\272\25190h\202\303\315\020\b\304M\355q\025e\007"
+	.string	".\f\315PM\331\306(\002\023"
+	.string	"\031\213\021\261\002\343\202\271\212\f8l\323\360\233-\200\367"
+	.ascii	"\nW\343Em\2753\b\312ygvZh35p\355\305\224\323r\372\265e\f"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.182.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`3\001\335\r"
+	.string	"\206\231\\D\020\217(\035C\032\221\006{\031\024\024\351)hj\357h\342\310\003@\223ifu\025\240\217?'!jE\277\037\33416\b\254\322\271&[\200&*\002\263\017\001K@\036\006\256\220\257\321X\361\t!{K\231RF"
+	.string	"I"
+	.string	"G"
+	.string	"\266I)\227l\026\017Mf\246Z\021\302j\231sn\227[\362\322\343\252,\371_\035\363\201\246G\375@\013\337X\340e\302\005"
+	.string	"\020\0255#\035\276\273\256\"\340IU\3432c0\347\264v\341\306n\333\201m\005\3663\004\276\210\253\370\256\026k\344\r*\234`\312f\2154SJ+\001\322\362B\240\035\345>\n\311_9\223Bz\350\261\321`\340\322\252\366A<D\351\241\2071sr \2612gx\340\322\004\264\313\3155\330e|"
+	.string	"\3542sy\017\001'(Bb|\350\213\3677qy\255\354\252l\217\260\357"
+	.string	"\f)TT\240\324\305\231\332^\207\376\373\336\365\227\210\264`9\255IW\345\225\217sI\354\250\326\267\356g\032\013>\3149\362\002cn\220'N\336\372S\256\366\003\034\3103!\002\207kP\201\003e<\b\334\307\363@\004\342\272\256\243\223\341\316\206\307\341qD[G\302\006\362p>[\247\363\266\r\001\016Q\340\272M\024\nu\233>\316%Y]\033\361\202\345cO1\243\272\232s`\366'\244\377\274\001Y\223\277\272\t\002\035"
+	.ascii	"Q\013B\272\00171\356\ft/\365\312\214\306\022@\036\030\341\212"
+	.ascii	"Q\217\025\n\030\002\344\003\031G\201 \253\211\3110\274E\243\024"
+	.ascii	"\326\005\242 \230{\206.\352\234N\013m\246\3544\020\\{1\305\241"
+	.ascii	"\251q\357*c"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.183.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`\031\001-\r"
+	.string	"\346\230XC\020\221\232\016\323\025\340\023@!\020\350\321O\030\200wc@;\243\350\270w]\3234-\270\271\216\254i-\276\025\033r\020\f\252\276\021\b\240I\221v\005 's\300hUp\350uoh\205\376do)S\nA"
+	.string	"J"
+	.string	"A"
+	.ascii	"\273\237\202G\033\240\036\253\017\230\036\341\005L\217\233\307"
+	.ascii	"\237\260\375Y\261g\327\370"
+	.string	"\027b9>\324\210H4\273k=*\210{\327\204\236\017\272\002\300\220\341\371q\310!\262\273\2464\334\361\266\027\330n`\177C\376\364q`\306\256J\251f;D\031#.\363\303<\355\333O\361\361Y\234\344\215\2149!\237\307\234x\305\346\204x\2179\251@\337\252p^h\240\240a@=\302|\376\241T\034\022<:\323\276\212\257\360\376\241\270c\327\003\214\030\001#U{\304\223\037\271\272\240 \247*\202\027\033\242\033\177\201\351\232\352\024\261\244d\311~\213\273\320|\021\256\300\345G\217>7=^O:,A\342\205\t\226P\226R]\254\360p\265\305\216i\205\351\204\031Ww9(\341\036d\335eB\341\262\220yp\0212O\007BG\222m\233\t\026\300\030\b7\302]\235\205I\260H:\227\307\3026\316\002!`\255$\333\254N\3236kc;\257-\026\ti\212\252\213m\217\374\f\226}fB\207\332\r=\033"
+	.string	"8g\340W\357\201$Z\306a\025\272\262\n\020\020\005\303\\\341hc\305\346*\244\316\023\257\f"
+	.string	"-\f\365\224\302b@\036\b\341\236Q\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.part.0.184.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"E\t"
+	.string	"6\020<9@\345&\035\340ag\274\254\216\361\364_\213'\363/y\250\207\265\013\0178\332\276EP\037\243\t=H\036\034B\312\325\314\261\261\230\214\006xm\370\006\030\002:\332\266\275\345N))"
+	.string	"+"
+	.string	","
+	.string	"6\314\277\220\325\244T*Rbvw^*\310\275+\214\236o\272r24\016;\217\032\320\356z\263q\313\333N\260\255`\337\n\252\356_\311\323qpi\b\355\237\034\305\373Wr\300\356\007K\313\356\207pi\203\315\245\347\004\231\313\370\201\314\245u\371\022\333\035\206\275\366f\221HhKL\300[\370\253sVF^Nj\202\232\262\306\307U\224\035;\013\034\273\027\001"
+	.string	"\254\207t\021\271\352\366M:\177e+[\0036\0221p$L\323\".\001_\237\355a\013q\363r\230$Qh4/m\233\237\002g\020\2306\271,\323\246e\033^Q\006Q\350I5\025\027"
+	.ascii	"8g\340\256\266\212\024\034\243\331\032\234\342\002\362\300\b"
+	.ascii	"W\214Q\023L\017\224B\\p\n\214\271\247\351\242\332\351\\\320\246"
+	.ascii	"\313\316\005\200\023\017\344hi\372\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`z\007\245\025"
+	.string	"\026!yG\260\232I:8\367\205\2477\277!vV\222\363~\020]^j-\233q'8W\244\306\031\034\261\204$\236\376\340\354\230\251\333\344\200F\243\321Xai\004\201\002PA\264\b\260\032\273#\330\036o\013\331\333imH\222\264\003c"
+	.string	"c"
+	.string	"j"
+	.ascii	"\306Q\344\0371\"\373\210\2014\313\320\0352\270i't{u\337%\232"
+	.ascii	"\256vC\261\224\262\243_TJ\236\260\0017\227\203\356+\335\355\236"
+	.ascii	"Zp[\001\362V\354\347\206AA\220b\361\271\253x\246\022Sp\031f\240"
+	.ascii	"\307\271X\202\3134\bnPFA\360\313K\312K\311\245\3125\224Rj\273"
+	.ascii	"<\323I)\001\274\b%\356)$n)#n'\"\356'!\356\033 \356\032\037n%"
+	.ascii	"\036n\033\035n$\034nq\303\335\245\341^\222\341f\202\341nB/\334"
+	.ascii	"I,\334Z\025\356,\246\033\213\302}d\302}%\3416\022\341.\002\341"
+	.ascii	"&\362\340\036\342\340\266Z\272\205X\351\016\342\244\033\210\303"
+	.ascii	")$\307hp\313\350\216\274\003g\035F\001O\270\271\266\245i&+l\213"
+	.ascii	"\227c\224C\344\025yk\320\235\2272`\260np\366\311\346\242\272"
+	.ascii	"\002\033\302Y\2077\333D\263\021\262Y[\020\355\243\255\265|\004"
+	.ascii	"&\246K6\333\247\333\fH\266L\262\237\232\365\330\323\255\305n"
+	.ascii	"\035\33293c\272\370tk\363\266\270g\260\270\251V\3349T\334U)n"
+	.ascii	"\036(\356\036'n\032&\356(\001RJ\352h"
+	.string	"nT\235\0335Zg+\027\346\233\033\025\372\200\325\026\231o\256\013\021\252B\215Nu\256\223\350\0246\215Mb\345\031y\302\333\334\235\272#\"\315\335\tu\252\3167\267\300\210\233[\033kb\322\334ZXG\334\\\002\242\2001@\365\352\\\357\246Z~\321\342\225\273\315\265\031g\343\334Y\2504WV]\277\271\001~\250Q\024\f\331tY\255s\360\002\021\242\2421\021P\024\2071\214D&\224\230\241\017\016\242w\013<\177\212D%\231\230t\335\362\261}i5\235\315\303\2614\001n%\374'\004\0358\177\274\r\234\036\0329\247\340\234\3646\312B.\235\220\321Y\325QW\324&\263yu\210\334\340e\340=H\353\225=6>\233\364\215\005!Drw%+\253\253\223\006\301]\232\364\263Yh){\211\275e/\261\267\354%\366\226\275D\222\326+\335\222~\025\336\215\341\200TS\275N\210\367\335'\\a%-\205\237"
+	.ascii	"\022q\206\3471\0078V\237\277{\225l\205\210\177\200$\366]\324"
+	.ascii	"dBs\216~\007\2078CE\343u\313\213\r\223%9\330\362\265\276\334"
+	.ascii	"\202U"
+	.text
+	.section	.gnu.lto_.refs.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375 \214\205\003"
+	.string	"BH\031!\220+\215\001\377\377\377\367\273\273\273\273\031\\W6\260h\333V6\2649\274\235\037\r\022\242M\222L\001R\256v\276\003O\226\374\324\221!G\027~\354x\335\230\361bW<5o:q\232A\350\245\251\245iE\322JRJ\322\306\2241%0}\230\256\203\006(:\327`\227`\250\361\036\235\363"
+	.string	"\257\363\032?\025\023\002"
+	.ascii	"7\003Q\301\034\003"
+	.text
+	.section	.gnu.lto_.decls.3d0ff22065f53f56,"e",@progbits
+	.string	"(\265/\375`}y-\375\001\2521\337\265T \fI;\035\257\"T_\235\246\233\021{3\343'Qux[\363\026\274\027\021\335,\310D"
+	.ascii	"\334\340E\363_\232\016\236@\343\256\271h\fy\366\346\2623\370"
+	.ascii	"\331M\347\246\351\032u3\311\315.\231\223ZM\241Q\\X\341!d\304"
+	.ascii	"\361BF\266\334r\313-e\nn\n\\\013\222\013\332\305\260\251\355"
+	.ascii	"jG\326:\211'Urrb\222\365\343x\021\352#\335\321A\364\251\215\320"
+	.ascii	"1\350\031\264\fj\006%\203\026\342\246FB\301<\032\006\025L\303"
+	.ascii	"b\245L\332\263\311\026\324\017\353\305\225H\363s.\263tq\366\316"
+	.ascii	"\fD\001\367\037[\231\264\247\0241B\276\224I{\346&\032\t\345\343"
+	.ascii	"\202\376uA\001\217\266x9\251x\035yA\001o\326\336\217\252xi$\364"
+	.ascii	"\013\n\210\365\342\364X^\023\215\204j\371\363B\3774\022\312\005"
+	.ascii	"\365S\227@\225I{\326,\201\001{\232@?\216\022\327J\260\316\376"
+	.ascii	"\0330\374o\270\360\277\331\343\177c\307\377\006\216\003\276\\"
+	.ascii	"\256\362\305\352\231\365\337\254\361\277\001\343\035`\235\215"
+	.ascii	"\366\325\034\321`b%\353\277\341\342\177s\203\377\215\f\3767I"
+	.ascii	"\374m\316\360\267\021\303\337\306\013\327\261\311\302\337&\n"
+	.ascii	"\317^u\\\207\211wv.\303:{\317IA\243\240qL\272\245\254\241t\324"
+	.ascii	"\n\021\034O\262~\2338\364\tz\267\317\274 -\263~\233\"\374m\276"
+	.ascii	"\370jS\305\337&\006_\2275O>d\262$G\3318\342#k%\031v\023\022\034"
+	.ascii	"Z\262\376\032,\374\377Q$h\0237\321$(\\\022\264\bz\004\353\305"
+	.ascii	"\211P\367\207&A\343\320!7I\314nD\363\304\306\007\366\354\275"
+	.ascii	"g\360\340\341\306GV \325\326_C\306\277F\213\277\361X@K\221\032"
+	.ascii	"Y\177M\r\3768\217\255\210\227\021tM\315\351\206\266\341&j\004"
+	.ascii	"e\306\255fXeJ[\177\315\f\3765L\374k\220\370\323\204\341O\223"
+	.ascii	"\205\017\227t\374i\3348M\247\361\3424N\032-^C\363\304\177(\206"
+	.ascii	"\3278\265p\233\216R=\332\365\217\316@i\240C2\217)e\250\262\026"
+	.ascii	"\302\227\374\320\"\313\372\207P\370\3434\253;\0348\346\322n\024"
+	.ascii	"\221\322\223#\212\327Q\026\025)\316\253\261(\\l\274\034\326\213"
+	.ascii	"\303^wR\234\275\367\252\227\273Y{\207\2026\327{\377\177\324\007"
+	.ascii	"\312\003\375\201\002A\267P.4\b\252\205\366\300Mt\007\212\356"
+	.ascii	"@u\274\334M\022\263\007Q\377\240zP={\3574TsK[,\350\037\332\361"
+	.ascii	"\037\036\341?l\343?d\362\037\252\361\037\236\361\037\222\361"
+	.ascii	"\037\022\341?\374\342?\034\302\361\222\236G\251\320\271;\245"
+	.ascii	"3Y\377\320\212o=\274\263\237\013\326\3316C\030\374f\356\311s"
+	.ascii	":\326\33112\035\223\007\221\254\177\365\343\357A\235\033\372"
+	.ascii	"b\320\013uBa\240O(\023\272\204\233h\023\252\364yIf\362<sM\231"
+	.ascii	"\356\f~C\233\262]\356\"Bi9\201\2166e@\324\205\b\245\345\004\220"
+	.ascii	"\3108{\357\036x\215\265\033^j\364\257z\374\327:\324\005\232T"
+	.ascii	"s\205\201\206\f\223\315-o\207\021.5A\215\320\236\013\321#\334"
+	.ascii	"D\2212\336\347\300\f&\351\313w\021\241\264\\\225\366\360P\244"
+	.ascii	"\f%\023\212PZ\256MmT\234(R\366\222\207\"e\347\024'\036|\342\254"
+	.ascii	"2\324g\362\240\231\025\356\211\2170\353_\331\316\230\241\021"
+	.ascii	"\003\003f\256\314g3r6iT\244\226\262\316a2\231\243"
+	.string	"\277\301\031d\376\271\212q\243:\313zL\247!K\253\233\312\372\32721Y\260\346\005\327]\027\177\301\227\373\377\025\21311kf\215\231xg\363`\235\375k\017\376\353\025\377\025\007\377u\212\377\347'\237\273\374\347&\331I\346R\263v\315\240\"\313\372\257\fT\220\261\254\177\355\374\377\363\226\334\207\233\331/g\371\254\224\371\236\207\331\273\222\336\273_\206\222\261\210PZ\2562\220\2708\375\262\0265\272\036T\317\341\021+:\264\255\237G\341\230\277\345=l5&v\225\365\363!\374q3_\311V\216\3004\301\351}\266\362\037\002\204\007\254\351=\255\367\276!e\313rR\227u\226\222\253\374\377\252\222\271\205\351U\241\242\267\243\306[\326y\314\256\002\216\025\031\223\365s\034\315<%\3431;\317M\325Yw\222\365\363%\236\243<\223\377_qdlE\315\310\372\005\337\356\377W=\203\016-/\353\347\235\347\273\236\317O\024"
+	.ascii	"d\307Y\326\350\223\353\216w\3663\273\360W\255p\274\204\017\231"
+	.ascii	"xgc\037XgS\270\302:\373U5\376j\030\177u\213\363\340\235\375j"
+	.ascii	"\023\377-\206w\300;\333HnS\3114a\261\222\365o*F\366\034\377\335"
+	.ascii	"\306\177\233\361\nsXg\377\356\342\277\255x\005\275\263\0166d"
+	.ascii	"\370\220\312\314h\374\3472\0367fgG\334t\340\272\233\264\367\253"
+	.ascii	"-^=9p\035\326\363\341\2004?g\217\215\214\203\031\270|f\245\247"
+	.ascii	"\266%gv\361b.+M\311\365\300\345\363(\t+\351\321\013\\\226U)\340"
+	.ascii	"\354/+e\036yF\246\272Ibv\250\233%N)1\260\222\033\264w+\302\274"
+	.ascii	"\304\304\f\\>s\224\024fb=\252\216z\361\n\\\226\345%\024f\356"
+	.ascii	".f\340\362y\225\304\231a\374g\245\246"
+	.string	"&.NX\t\326\243\352F_>\370\272\n\\>\363\376{2\217l\205\353n\216\230}\251.Y\376\177\336\312_9,\013\311\\\331G&\222\207\344\035\031H\016\222\301rW\026\313^y,\367\310d\371\007nf\036\031\353sV\326\002\341?\037!\311\310J\377!@\310<\262\f\254\344\306\210\331e\250]s\201\313g\357L\017<\036<\324\3408{\002\246\203\316Wxgc\200u\366\247N\376i\036\377\264\311?\r\343\237\332\340\2376\365|\303F\257F_3\353\327b\370\353\275\\\003?\205\331\032\313\3725\023NC\243\361\327@\370\353\034\274\003\274\263_/q\021\177\374\321)\374\3218\376(\030\1774\007\377-xg?*\203\277\363\311s\260\316\376'\336\331\237\365\370g9^A6\312=m\223rv\224u\356\317\264A\217h\344\311\025\022\346\244\2546\267\254\377\037\233\301\203\370\fnbB\374|L\006\227\361"
+	.string	"\023b&\270\016e\316\361\027oK\204\330\t\036\203\262-'\200T\350t\373\307o\204\370\310\026\223\323\2463]\351q\275\257\360\316~,Xg\177f\362\177|\367x\314?~\303M\260\230|\205\241\346H\336\225/Y\013\362\320`\261\352B\226\365g!\374\377q \376\202\275`@\f\006;q\023\207\301~\217\3770\227\327\314\336\223\362\252`,rH^\234\275\367\307O\272\230\201\022E\205\323*\343\301\177\017\016\203\263\340>\224m\311\341\332"
+	.ascii	"\235R\360\260\222\033\243\234\216\264G\306\253w\346\343\264\377"
+	.ascii	"\236\377\020 \3400x\nV\2022\275:\322\036\035\003\222\356\352"
+	.ascii	"\302\236\2753y<\320x\351\221\343\311\215~\374\205\277\036\336"
+	.ascii	"\3315Xg?\246\3021\037\326\202\233\035\360\2265\211\331\335zg"
+	.ascii	"\342\254|`r\304e\375\330\216?\356\260q:\354\307qx\017\273\301"
+	.ascii	"q\231\311\372\361\027\307z\330\nn\342+\377\230\n\316{m\344\252"
+	.ascii	"\273\365\336mh\266\346\342\216\262n\321{\357\370\355\266ZXXX"
+	.ascii	"\210\337n?\346\3015\326\331\025\340\235\375x\212?>\342\037\207"
+	.ascii	"w\366\257\340?\207w\366C\301;\033\333\365<\276\323\331K*f\217"
+	.ascii	"\353\275\343P\260\304\216.k\025\353\354'\362\335\361\316\306"
+	.ascii	"rx\0167"
+	.string	"3\300t\217\227`\267O\217\230\235\331;\023'\003\031D\322\226\365_\200?\316`\243\205\2058\203\375\016\340\031\353l\f\207\343p\223\003N\362!@x\324\310\b\216\r\241\031\241\231\254_\004\177\214\3441\\\351 |\006\376\230\303\306\205\230\303~\316_\017\353\354\034\274\263\377q[\006<\251I\222\264\254\377\261\021\314T\321\356\264\342\262\306\314\214\3270\333c&.\362!@\370\232\244\236\326;\0233u\357G\030[p\203\261\005\251\235\220\243\266\255?\363\177\254\366\217\321p\032\007t\311\351\252\307\365\316\244\200\303\244\361\264#\353g\342\235\315\261\316\376\327\205z\020\367\235\330\372\327\317.\232C*\202\016\363\377\033J\310\371\3478\262\266\222\206\360\377&\340>\023P\377\372,m@\024\007 \351\037\251\211\377\317 \205\300\377\253\377\\\356_\377"
+	.string	"\341k\001i\211\377\224\304\277&K\037\360\237\216\370\327\022H\033\2202\340?]@\232\200\377\024\001i\001\376S\020\322\017\376S\017\322\020\377i\317\2776\221~\370O9\370\327\016\260\372\327Y\377z\306\277\266\361\257q\374k\254\177\315\365\237z\370O5\370\327O\377\032\306\277\206{\017\376W\f\374\2474h\\:"
+	.string	"4*\025"
+	.string	"J\201\1774\003\377z\203\024\003\354\341\037o\360\217?\244\303"
+	.ascii	"\374\343\017\322\013\3765_j\301\377\237I+\370O\325\177\235\001"
+	.ascii	"\220\356\2403\360\316\027\376\277\t\377?\200\177\255\3017\340"
+	.ascii	"\237\003\031\241\251\374\243\205)\005_\363\317\215\220\340\276"
+	.ascii	"O\377y\362_\207\220r\370\327~\377\277%\335\360\303\177\376\364"
+	.ascii	"\257+\220j\370Os:\301\377\257\235\300\372\327wi\206\177\334\367"
+	.ascii	"\353?\037\301\007.\344>I\312\363\377\033\376q\337\333\374s\367"
+	.ascii	"_\223\220b\370\327&\244\027\236\r\367=\315?\257\361\217\373>"
+	.ascii	"\377\363\025\377\351\316\177\252\363\237R\370Oq\376S\233\377"
+	.ascii	"\224\346?\345\377)\372\257\013\377\365\340\2776\363\257\311\374"
+	.ascii	"\353\277\177\255\345__\371\327U\3765\336\277\216\362\257\237"
+	.ascii	"\374k\271\177\275\344_'\371\327H\3765\334\277~\373\327m\377\232"
+	.ascii	"\355_\257\375k\265\177\215\366\257\311\376\265\330\277\016\373"
+	.ascii	"\327_\377\272\353_\013\371\327@\3765\320\277&\376\353\016\374"
+	.ascii	"k\016\374k\r\374k\f\374k\013\374\353\023\377\032\305\277\226"
+	.ascii	"\300\277.\341_\233\370\327\"\374k\022\377\332\001\377z\304\277"
+	.ascii	"^\300\277N\300\277>\300\2776\300\277\006\341\037E\373\327 \376"
+	.ascii	"\237\356_s\360\2577\370\327\032\374\353\016\377:\203\177=\200"
+	.ascii	"\177\215\301\277\016\300\377\257\375k\013\3765\207\177\275\341"
+	.ascii	"\377\267\374\353\374\217\026\376\243\204\377h\340?:\370\217\232"
+	.ascii	"\371\307}\377\237\301?\232\344\037\245\361\217N\375\243\036\370"
+	.ascii	"\307\007\370\307\"\376\261\001\376\361\377?\341\377\033\371\177"
+	.ascii	"\266\377O\373\177\017\374?\336\377\347\024\026\026\026\376\247"
+	.ascii	"A\376'\320\340\177\003T\001M\356z\326OA\031\376\024\364\361\177"
+	.ascii	"U\207jEEV\004+k5GN\212\272\362\"\353\247\340\216\377\277 n\252"
+	.ascii	"U\250\237\346rWx&\353\247\340\b\377Wo\340\272]\303\205\231$Y"
+	.ascii	"?\005g\374)\360\342\377j\rUUg\250Qb|N\234\262V\2436\026\325\351"
+	.ascii	"\250\213\327\266\242Fm1\007\244\001:\325\245\n\245J\251S\270"
+	.ascii	"\251F\251O\257\306Pel+j\324\276\322\005L\340\331\226\032\265"
+	.ascii	"\365\220\002\317<\360x\360\200\203\343\310\231\333P\333@\301"
+	.ascii	":\373)x\301\325&\325/G\031\250\254\237\003!\357j\002fl\352\251"
+	.ascii	"\032\25106\241\352B=R\221\324%Ui\233\331\203j\337g\324\027j\322"
+	.ascii	".\304M\225iw\371me\357\365i7\224m\311\223\270\270\341\024\262"
+	.ascii	"\311\2749y\3517]\247\325\241\311\222\2264\255C\223&*\323.C\027"
+	.ascii	"\246\32103E\330\330T\031~S\231\366\226\255*'Se\322<\354\220T"
+	.ascii	"&]%\215!Bi\031\201\255\030\316\336\273\312D'\225e\363a=\252~"
+	.ascii	"d\364A\223\275\261\251\355\2472m.2T\246\264\307\016#Bi\271\306"
+	.ascii	"x{rn?\225i\3775A\032\233\342\031B\235\205\371R\201~\016`\366"
+	.ascii	"SH\226*'Y?\007*{\314\026\223\367\342\372\226-\370[\314\3663\272"
+	.ascii	"+\263\301\334\234\241A\327\225\365s@\262\003\367\227\274\204"
+	.ascii	"\b\223\222\355\374\375\245\246\314\024*SY\277\340\366\362\377"
+	.ascii	"\353\r_\021\271&Y\377o/\033\360\346\351J\317\332\200\273\313"
+	.ascii	"*f\313 Z\326\317\201\311\237\203\031\177\016`\3749p\361\347P"
+	.ascii	"\305\237\203\f\276\307J>\3201P\220\262\324\221\365sX\342\317"
+	.ascii	"!\211\327l\030\344\230\271\307\377w\225'E\362td\255\361\240\370"
+	.ascii	"\300\236K\024\212\215\017\354\231\321\322\232@\345\301Y\021\033"
+	.ascii	"C\373\342\003{\246\205}\001\013\263\302\007F\247\251\260\021"
+	.ascii	"@\314\210\017\254Hf\313nR\037\320\031\245\251\241L\24400c\343"
+	.ascii	"\003[\372\317E\326p]\005\330\370\300\312\266X\030\035\037\330"
+	.ascii	"3\307!\241\343\003{\356)"
+	.string	"\033\311v\262\215\354\273\375\266\361v\335^\333\314m\266\363v\334n\356\264\re\313m)\033m\273\355\266m\267\225l\266}d\303\355%[m3\331I\366\331.\262\251\354';\312\236\333Mps\323\355\261\337d\273l\323m\"\270/\314\n\037\330\023\214H\236\363\257\0133Q\246\227zDK\210\023\217\016\245\242e\240l\313\b\264\231\311\315}\035y\261\361\201=\321\251\032hWT\007jF|`O4\265~d$\202\216\016\215B\245P\031\"\224\226\021\330\373sb\207J\021\241\264\\a \3215!;\202\231\030\254}1;\203b\206f\366\205\017\354\311\205I\367\205\322\325\241L\342\234E6\235\031g\221\334d\343\003{*m\272\r&\206\305\007\366lB\247\243\366\020\021J\313\b\264u9\2756\035\372\205v\241lK\t U!\333thY&\314\022\201\206u\264\351\366\227\330\027\037\230\222\337tY\016\225A"
+	.ascii	"5:\324H\222\3013$hL\203\211wv\205-Xg\377\206)\3747\310\361\337"
+	.ascii	"\300\344\277\341\213\377\006\037\3747T\361\337\020\305_C\031"
+	.ascii	"\376\257\245~\017\371\327K\r\265\205\324D\3259\205\311:\210s"
+	.ascii	"\307Q\225\254_C\027\276\271\364\324~!Bi\031\302\036\325\346\332"
+	.ascii	"M\333\007\312\266\224\300\236\r\347\217\r\00477\327^\372\315"
+	.ascii	"\264a<\017\217\332D\303\312m\353\036R\2648\345\310\3725\340\361"
+	.ascii	"&[kgi(ZNZ;\306\326\201\262-C\320jrn\255}\205\002\366`\361\201"
+	.ascii	"\225\361\330[{\007nn\255\215\345\301\203\007\236\013\346\274"
+	.ascii	"\230\\\277\206$\3745\230\361\327 \306\267\216\377\355\264\237"
+	.ascii	"\266U\276\302[\243\232\313:\307\360\f\022\230\257\254_\203\020"
+	.ascii	"\376\036DA\301\330k\242\361v(\333\222\037\321rr\246-\367\215"
+	.ascii	"]c\333\3308v\025nn\252-\365{j\317\340\262\251\266\214\227s\341"
+	.ascii	"F\200/0\325\352\n\224\271\032\375\032\2708\276\302;\333\002\326"
+	.ascii	"\331\257\001\213\277\206\033\3745H\361\327\340\304_\203\013\376"
+	.ascii	"\032\2148\252\207w\266\002\0049\017\023\357lt\t\353\354\237`"
+	.ascii	"\013\207\202\343\244\354\314\220\254\245\340i\315\231a%\t\b\033"
+	.ascii	"\233*\273\323Q\260^\\\330\330\324\023Mjl\352I\345\345P\266\345"
+	.ascii	"\005\245\2755g\357]3\331\264\233\031\030)D\364\030\025\257\262"
+	.ascii	"6\374\226\366\351)(\240\036\322\245\205Ha\240&\225\246\327\b"
+	.ascii	"\200\20646\365\\\242B\032\233*\3234j4@j"
+	.string	"l\252\354\355\f31@\323\032\233z\342\267<\324\017J\204\031\322\330\324S\337H\373t\225\326R\333\033\233zj\246~\323u(\333r\215\321\306\304\211\376Y\245<\024@\326\006\302?Z%\355K\257\244{X\217\252w\250\017\326\302\306\246\236GBR0-(9\t\027\247\336\372\264O\363\320BP\266\345\004\264\374\234\232\254\311\330\324\263G\032D\213"
+	.ascii	"da\372\306\216?\347\\\206C\003\303\354K\305R+\037\220!\245}z"
+	.ascii	"\306\232\326\330T_*#\315!Bi\2716\355\251\205I\377\3222\251\231"
+	.ascii	"\224/\035\223\006\246\200\351\227t0\315\222v\331=u\246\205\333"
+	.ascii	"EJf#\245g\266Q*&\335\222j\331I[)%L\237\373(\305\222\372\245\202"
+	.ascii	"\251\227\024L\312\0057\323>\364N3\233h\254\233\243\234\236\204"
+	.ascii	"\264\304\313I\332\247\355t\026\326\363\321;\324\007fmcSOM#\355"
+	.ascii	"\3236\2748\363\\\332\247\275tXT\007jHcS\317\264OWIcl@Z\352=\n"
+	.ascii	"\003\262\275\261\251g\357}\375qcL\235\211t\357?\337\3458\254"
+	.ascii	"D\331e\343H\326?\001\031O\365pv\3648\312\222\365O\320\203\217"
+	.ascii	"\245j(\323\313\004R\f\347\224\264J\232\207\233)\225\247\222\026"
+	.ascii	"I\353D(-)\200\364\344\244\222\342\375\224\rHK\375\b\253\203/"
+	.ascii	"3]P\364\021\037Qtp\375\031\270\360\317Q\315\fX\317\207\003\300"
+	.ascii	"\222\344\311\2319\353\322\265\024\311\006\244%\022\240(Q\362"
+	.ascii	"v7k\357Yq^L\316\226t\300zq%\346\322\322\272t\356\355n\222rz\322"
+	.ascii	"\220\262\264.M\222as\001\001\022\370\204\222JI\233\244OR\273"
+	.ascii	"\364.\215\222:\301\315\264.\245K\217\274=\315T\320\237\241\007"
+	.ascii	"\377\fW\3743P\361\317\260\344\237\341\005\377\f\235?\317\223"
+	.ascii	"?\017`\234\022#/Wdd\375<yo\351\021\334L\341R6f\332\266\243\213"
+	.ascii	"\027\\\352\226\266U\350\362\247E\343\2112\371\013\363\266\365"
+	.ascii	"\363T\361\377\264-5B\250\226\2030\353\324H\312V\244\313iG\326"
+	.ascii	"\317\223\304\037\303 \177\fb\370c\360\302\377\323\262O\325\376"
+	.ascii	"\323\260\224H\232\366\201\024\t\023\336\213\254\323\263\024\355"
+	.ascii	"\323\264\324\254\247i\037\\\365~\224\246\341\234\351\375\b\007"
+	.ascii	"c\0130\266@\237iu5\267~\f~<%\353\371\264\314\205\017\247\250"
+	.ascii	"\2543\300:\3731\354\361\307@\205g&\336\331\035\260\316\366J\277"
+	.ascii	"\272\224b\200Xq^]\350\017g\237\327\220O\273\214\376\222ha\373"
+	.ascii	"\221\002\341Z\305f \341\002\344\007\327\312\227\306D\214\217"
+	.ascii	"O\271PA+\036B\260\326\250f\310\355H\267\210\230\0013\227\365"
+	.ascii	"c\200\221\356H\265\222\310\030\241\222\365\251\026\023\243\001"
+	.ascii	"\356\215\311:\275J\261\270\227\f#\027XO\240\340\021\336\320\261"
+	.ascii	"~\311R\305\207\016\215\265\365\305\004-\353\277p\206K\361\240"
+	.ascii	"pIf\031\007n\246U\3512\256*\205Jo \251\033\023U\323\231\310\320"
+	.ascii	"i\375\237\336\370\324F\214\030\316\245\254S\252u\312\324\214"
+	.ascii	"(Y\377\205%\374?\245\201\233i\r\300\016XaQY\277`:\343\377\327"
+	.ascii	"\334#\213\2272Y\377\2473>\235Zv8\033YKu\250+F\262\376\013h<\215"
+	.ascii	"J\227\031\353\b\013T\326\177\241\214\377\005\036\374/`\245O\371"
+	.ascii	"O\255\306\221\254\377\302\f\376\377)\214\264\t7S'\215%)u\322"
+	.ascii	"zz\257/\320IgI\227\260\036UNO\002\034tz\300G\356\b\003\267&\223"
+	.ascii	"\272\340\342\225\276H\225R&\334L\227>]\322|\332\313\215\021\205"
+	.ascii	"\336y\234\361Z\322N=&j{9\372\003\313\340\301\003\215\323V\016"
+	.ascii	"#\256\377?EJ\223p3u\221\036\r\246FX\217\212\331\243n\222d\375"
+	.ascii	"\201=S\027\272\214>\263\001iI\004'\177N\336\344\207\023\256\255"
+	.ascii	"\377\002\023\377O\215>\355LraZ\b"
+	.string	"u\341p\006\225\236\223\254\177g\220\023>\216\361\345\002/\353\337\t\303\0377\277\2136\363\200\032\310\024\032jY\377\216\027\376;[\370\357`\031\243\277\3500X/\256\004\025@g\357]\214~\342\246\036\243\005\307h-R\2748o\272\302\320\324\266\376\035(\\\223%\301\345e\255\301\350@\033\300\034vD\262\376\035&\374w\340\370\357\264u\321\200\270\251\275h.\332\213\336\242\3776 -\215`U\306\213\326\202\225\320t\201\375\201\251;\352\326~l\375;T\374_\377i?\033KK\316<\241\302\"D\367i,~0:`\326\277\003\305\177\207\211\377N\347oa\f\177\013\177\334\212\276\002\227U\244,\353\267`\305\212\205(\374-\330\361\267 \307\337\302\032\177\013c\374-\f\341\357\324Q\240\344\2713J4\262~;\375\204\353\211\021W\326o\201\007\177\013R\374-,q\254s\206\323\341H\345\200[\312\372u\264\360\367"
+	.ascii	"\335\323q(\333\2227{t95\023=\207\233ZN#\211\323r\272\251\227"
+	.ascii	"`\275\270~$\205\301\230#\2642<\036l\232O34\266N\242\225\3404"
+	.ascii	"\ty\001$\353\327\341J\242c\305_\207\351\210\206\313Qo?\006\217"
+	.ascii	"\370q#\272\r\357\211)\303\204g\204\216\343%\326\331j\272\b\312"
+	.ascii	"d\022\345J\326_\241M\255\002\031\377\nB\370W\320\301\277B\024"
+	.ascii	"\177\n\205\374)x\341ZL\323\310\333\032\222\365S\320\302\237B"
+	.ascii	"\024\r\206\2437\344\216I\326O\241\251\277(\250\361\2470\204c"
+	.ascii	"/\254\263\203`\".\326\210d\375\024n\360\377\327?pS\003\321=4"
+	.ascii	"\020\355Csa\275\270\336\241\b`\026\325\203\360\331{\347\361\200"
+	.ascii	"q\340!U\321\\\200s}QbY\177\316 \377\234>\3769Q8\236\313\211\323"
+	.ascii	"Z\377\350\237\306\241\263\360S\n\221\261\254\377Q\252\0349Jc"
+	.ascii	"a5\312\t[]\326\332J\353\300\315\f\372\252\343\340@\037HPY\177"
+	.ascii	"\016\223\223\240w\234a\343\302B\234ao\"\034ub\235\3759<\370\347"
+	.ascii	"P\361\317q\342\031\347\f\177\2340<D\317k\251]\346\004\213L\326"
+	.ascii	"\217\323\307{:\336\331{\211uv\f2(\255\255\254\037g\n\377\374"
+	.ascii	"\366\217Vi\322K\204Ut\023j\345\214S?i\030\332I3\341\246n\322"
+	.ascii	"/\036\235\202\346\241U\232P\275\301&tO+\335\310\370*\223\366"
+	.ascii	"D\233W[\334\206\372q\346\370\343\264i\245\177\264\nz%]\274\334"
+	.ascii	"\360\001\003\306\260\t\033\3512v\316\236\304Dm\247S\017\261a"
+	.ascii	"\323W\230\226S\326\357\001\215\241\213\241\213\341\322\320\005"
+	.ascii	"Z\032\214\341\213\037.\305\r\206\265e=T\342HQ\214\310\300Q\003"
+	.ascii	"#\252\211U\326\357\301\213\241\321\320h\210\304\303\273\232\226"
+	.ascii	"\2253\b_\227\321\360\350\207H+\341\024\262\033!\006\013\013\271"
+	.ascii	"]\221\247\275\250\355d\211\031\300\254?\204\337\340 \267;\213"
+	.ascii	"16\245\214W\2212\310\314\372C\274\2311\303\302i\314\024-\"d\312"
+	.ascii	"\262\376\020g]\272\254d\206Pb\200\225\3416\266\360\216\236\277"
+	.ascii	"\222\301IB\202B\230\365\032f\035\303\303\351\266\226\365*\306"
+	.ascii	"\210E\206%\353\017\341b\025\\\277\254`\234\030q\242\224\365\032"
+	.ascii	"XE7\305\311I\326\337\003\310_pu*\t\351\262\313z\365\202\305\305"
+	.ascii	"\025\226\365\367D\341\217\233+\340s\254\256\205\3103\256\257"
+	.ascii	"o\375\033.\235\002\357\3203&>\035~\277\3761\261`Y\265\360\\\031"
+	.ascii	"\211\241)\003\230\006\203\357W-|\317-3Y\257Y8\222j\343\210\313"
+	.ascii	"\250\347\213\257VV+\353\225\033\273*\306\217:*p9\246\254W\372"
+	.ascii	"\374\310\364\272\262\376\036"
+	.string	"\245\274\317[\253\360\\\031\t\356\251\030=\300\236ke\256\250Q\371\265\212\215\340\233^\221\016\240\340\341\255h*U\f\255)j\017-'\255\254\277\203\255(Q\324\250\247\275\250\262\214\243o\314\\\326\337\001\023\035\335\372\304"
+	.string	"H\201gy1\242\260\335\375\372Du\301\303\314T\326\253\035\3527&Xfnur\364\026\303\351\244\t\tpQ\300\004\3268\375])\263\326\251[2\240bRS\224\n\345\344\270]\232\027\336r\022S\313\372A\364-Y\222\304\253w\252\0165op\\\260d\375 \354\222$\341v\330H\227q"
+	.string	"f\340\022\007\355h\312T\326\017\202\r\t\022\274|2C\203F\007\021#PY?\210%8\270\241\2471ie\252\025\235\\Z\326\377\241\312\333\033\036{\022\323\342j\t\022\260\266\266\275|\n\204\242\353\304\214\262\262\376\017Jll4S\236\274\324\335\300\330s\003\323\262\266\266"
+	.string	"\275\300e\331\252\207$Ej\211\232\232\001\274\002\227;\207\222]a\326\317A\231\231\331\212\206\215t\031\031h<\371\235\341\205L\230 \255g\277\242\355\255\361m\311\372\005\327ME\306\2312Y?\0071\310\310V\030<WF\2024\233j\357\312\215\254\237\203.&6\365\244\305\212\246o\025n\261\013\013\343b8\207\211\264'\304kx\024F\003\355\355\353\013J\352\266$\306\nYW\027\027\303F\272\214]\367\264\027U\326f\305\307\222\254\237"
+	.string	"Q\253\220U\b\027\343\2712\022s\343\365\264\026\205.\367\226\204Y?\001\220\370c3\314\373p\223\367\255@0T\357GT\023\024YRm\300_d\211\022\343]~\005\362\317\375\370\337\372\243\306J\230 [Ys,0\300\324"
+	.string	"\313\372=\370\337~_\240<\255E\225\r\3129y\031\257\247\265(/\200\316&<\314\313A\301ASG&\212sM\342g\270h\246\236\326\242d\224yZ\213:ZgpB\232\252\247\265\25020N\236\326\242\216\nW\244\03744\222\326(\324o\353\351\265\375"
+	.ascii	"\251<\255E=\235\326\030?\206g\306\340\275X\233p\320,\267\237"
+	.ascii	"3\004\b\353\f.\210\231\033h\316\236\326\242\236bP?\270\267)\353"
+	.ascii	"\214\325\305\252\2042\277z\337QE\023\365\264\026\365\\\255\326"
+	.ascii	"\034+\217\325\306\312\265N\255W\353\326J\265\326Xq\254R\353\216"
+	.ascii	"\265"
+	.string	"\307\352c\305Zu\254Z+\215\365\306Z\265f\341\346:\343\177]\256P\271I \315\335\323ZTY\336:\203?Q\277\rL\275gY\321\020yZ\303\021l\032\303\366A\377\006s|\377\006p\374\177\215\261>\241M\361\b\262\322\231\021\233\221\365o\200\306\377\327\246\025\206\225;8\245\225\351W\030\230\251\201#a\201Y\257K\250\237SV\235\325\031\261\035@\210d\375\033|\361\377U\211\213\021\006\276\321e\375\033\370\340\277\001\025_\373j\204\233<\353\0213\255\367\216\243\221\244HUe\375\033@\361\022t\314\263\277\020\363\354\337\340\210\277\207@\376\036\260p38O\004u\314e\375\036\240\360\367`\204\277\207/\376\036\256\370{\210\342\357\341\210\277\006b\370k\220\307_\0037\376\032t\361\327\240\212\277\006/\370w\b\344\337a\217s.=\317\273\320$\301\033\354\312Z\007\353l|\324\361\316\316\351\220g\305\n\327b\003"
+	.ascii	"N\252:h.1.H\374\312s-\234\317I\222.\\|Yj\224\210\024.\331\343"
+	.string	"XtDe\311\372;\334\361=\301\0160\216\210A\312\372;0\341\377\274\312\343&\257\302\275z\222\372\221\031\315\230\223\226\223\23339\310\004f\375\035\326\370?\317{\334\344y|\b\217\221n\244\312\205\005\236\241xc\bwd\375\035\320\370?\307{\334\344x<\b\272t\325\241\024\320\304\n\037X\r\\\223\0253\353\3570\306\377y\224\307M\036\205\367\020\341\252KU\020v\025\270\314Y\360\232]\262\376\016X\374\237?y\334\344O\370\016m\244\033\321dq\212\332`\267\305\360\023\314\372;<9y'\334\016\367\336;U7\022\203SF\325\2013I\031\203\313\332\256\003\222\034\247\223\343uuss4Q\201\3743\220\322\344J\232|\311\222$I\324g\006H\370g\360\365\306\341\336x\334\277\340\363\270+D\2064\263>r\344\210\346.\203,\376\0318\265\265a&\317\225\321\227\016\002\235\306L\2719\322l\223\312\372\007"
+	.string	"\270\306\331\326\270\330\356\0353\257d,\231L.\306\215n\250\f@\217\377"
+	.string	"\222\250\251\r\3058\001z=\007\020\306\3779\332\177\b\020p\223\243a%<WF\201\026,\235\002\357\236\275C\331"
+	.string	"G\314X\016 Y\377"
+	.ascii	"^\230\231\r\005\311\310\270\030\357\275\0331\273\214\2339'@\257"
+	.ascii	"\262N\265\354\360\002\250\302\237\177q\260\347aa\\\354sz\357"
+	.ascii	"\352\235\023\240\327\263SMu\370\347D\236\213=`\232\235\223L\326"
+	.ascii	"/\210\372\375\377J\264\373\361\314\372\005\260\306\377\037\177"
+	.ascii	"\376\337\375h\331{\217J\231}\211T\263\377\361\343\024\343\016"
+	.ascii	"\3776\030\305\027\374\277F\377=\0302\324\273\215\273g\357\035"
+	.ascii	"\207\341arG8*\350\030z\357PKI\335\b/\271eA-\271e-),M\311\202"
+	.ascii	"\352IPeIYWx))"
+	.string	"k\271L\352F\024\272[\326r\251gA\345t\267^c\311\355\310\b/%u\250\336\263zN_:\202\352n\314%\205%\267\254\345\222[\026\024\205%\267#\250\245~\325s\226\230;\226\235\231eD\241\311\355\b\252\273]AQ\350nYPK|O\254d\270K\323\272Q%)\f\b\306ZJ\3521\236\252\216\2269zK\314\253\276\245w\034\247\324\227]\257\367\013z\257\272Zn9\252\201\347\220\364b )9\272\302\314\336{\206'$\255\253\236\244g\204\273\336\022\221\253\336\211 \005\365\247\336{\377\300\210\251\327\271\260\236\321\216\252\356\244\324\373\004\235\331\373S\357F\270\353\365\336\215z\357\352\262\212\331\373\215\234%\257\247\247\336\251x\236z\225\021\235R\3579\316o\016j\311M\353\252\207\356\210\233W\177\3014\302KNW\335\253o\311Zr7#\266\356\324{\307`\270\027\224T`\326\274k\211\007\0273\353\027"
+	.string	"\023\347B4\023\034N\314\262~\001 q\016\304\005\025\334\222\254\037\2033\234\231\326;\363f\217\005yA\2275'\373\352a&kf\363\306\224\036Ys\036(\236\034\226\\\326\217\001\027\316\244\231\263B2\305\265\224\364\215\301e\375\030\344q\035:8\026\017\357jmM\316\336\251:\3300u\201\341v\365\034\013\347L\031,G\\\312lP\213R\326\217A\022+^U\345\205\245\360y\322'\361\252G\223\272U\216=\345\264'\345\331;U\007\314\225\344\354\311\251\236Wq\034H7\310jd\315o\334,q\341\205L\326\217\001\027\267\301g\360\032f5\222\360\3404\320\346\326\340^\326\217\201\r\316\247\270T\327\327\222\030Y\363\030\\j\235\033\244\362C*\312\f/LU\326P \320\372\313\313\3721x\342K.\203Ga\351KY?\006F\374\005\371\223z\307\345\256\355\311\211\007\017$qY\363\246\030\203JO\262\376"
+	.string	"t\341\217\233\034\006S\tVs`\370\322s\246>\027LRY\277 \177\361\377\353\220\317\317\214\036\177\301\225\\\224\221\342\2265W\342.\254\266nh\311\372\003\240\307?"
+	.ascii	"J\370\221\001\372\236W\326\037\2006n\204\2670-P\221\305(\004"
+	.ascii	"#\210\005\211\224\301\307MuP5s\002w&\2716\037\316"
+	.ascii	"\336\2516\240\3013\203\004/\353\017\200\017\376\257\236Q\315"
+	.ascii	"4\315\232t\311\272L\306b\306\024\251\312\372\003\020\305\037"
+	.ascii	"s\031\243\362\251`P\346\034g\242\225\3039F]\242^\321\"@X[\340"
+	.ascii	"\031\031\365\251\n\252aT1\270\251\216Q\263du\214\212E*\360lo"
+	.ascii	"\t\013\013<{\366\250c\324\275\033N\0176>\242,\251\253\321\201"
+	.ascii	"nx|\315\236\365_@\310\235\252\027\334T\277\250[\350T@\2249\307"
+	.ascii	"\345\264\234\234_T&\252\026\255&\257a\340\217\033[w\341\261\351"
+	.ascii	"q%\246#\353\277\200\217\377\025zqQ\375pS\375S\373\334\376\264"
+	.ascii	"\214\275\300\2632\224\214[\236s\353\277\240\216\377\005ET-nR"
+	.ascii	"z}6\262\376\013\200\360\277`\006\377\013`\360\267`\320J\206\232"
+	.ascii	"\246\322\325\231\026*j\025\334T\365\3249&\252\034\326\363!\302"
+	.ascii	"\031\236\252\247\322\251"
+	.string	"yX\317\207\b\204S\234ZLpMp\353)\271\006\306S-\353\267`\t\377\177U\212\nE\215\242>\301M\025O\265\313\314\336\343r\324\235\234[\223%^u\032\213\211\227\212\247:\321X P9\001)\362\354\275\3430eY}\031\352\267\340\006\377\n\b\371W@\206\177\005`\370W\340\205\177\005[\370WP\247\312\341\253\216\341F\352\255\354F\326_\001\023\376\025(9\302F\327\245\227u\317\021\265L\307\225\312\365\303y\246\246\345p\332Po\210PZ\256/\262\004q\342Pul\0011\242\306\251pjSuS\333\324$*\233\212D}\303M\365\210\212\245\036Q\325T\346[\225\363\207\352\305\345\365\245\222\271\360\241\036Q\251\262\bQ\217\250fX\311\006\244\336\255r\f\323\234\264\234<{g\352+\035\t\310\005]D]\273\001\342\005x\225\365W\260\305\213Tp\203\253h\200V<\244d\375\025<\361\007\300\031\376"
+	.string	"\360\302\037"
+	.string	"V\304\3241\"Z\317\t\216\211\030\221\0329<,Ra\257\022\251\243!\003\246)H\326*\230\272\243J\t\f\245\254_\020+\371\3775\325\022\303E\316\310\020\265KH\r\233\236\231\302\256!B\206P`\330-\005yU\210\222\033\302+8\025\210\234\224#. \237u\323\247w\027C\207\352c\370\245GV\220\254\037"
+	.string	"Mj\017\225\307\rT\022?9u\353U\036<.\016\360)\353\027Tw\374\377\212*\241\353R\266Ck'\313\223s\243}\215\031S\263T\254\300\257\0219\202\315\007}P\022\271\310vH(I\002\210M\341\0325$\225E!P8&\225/2Ib\205\313\232\240C\301\275i\201bh\035Q\341\203>\024\225 \212?n\021E\216\361X\034\022[\"\373\262%\206\334\022\220\311\t\264/KtdY@`\310\025\302pA\371\236@\232\030r\205,\f\271B9\352\n\2275\241eU$\225\254\212\341\007}"
+	.string	"\261\301\035\241\375\311\371\240\017\026\344\270)\216\307\344\t\r\305\"\273\266\305\023;\256+\244d\217#t\214nrH\310\370\272\020(N\360A\037Z$U\200H\032\223\017H\032\221\306\241\233\017\372 \304\026\211 \222\306\242\362\346\203>pp\331!\241d\321\346\203>\270C@ \222F\013\356\020\320J\"\303\005>\350\003\210\342OP\361e\207\\\243\017N\013\245\315\007} \0222\202\340yG\020\t\031)\f%\223$\370\030O\340"
+	.ascii	"!\215+\\\266U&\213 \212?!\370\260I\022>\350\203\262=\022\371"
+	.ascii	"\264A\305\234V\210\235@+\304N`\205\313\232"
+	.string	"\240\202\310\245)\266A\305\265\210$2\341Z\300\007g\337\024\275Fe\322\250<\201\343\216x\211\255\220\361\245y\335\366eI\3109\262H c\212\327e\2179\357\b\237Vit\333\022\257\313\036m\\\013\274#|\332\327e\2178\310\226\205QY\342E\266,Z\232b\021\211\026\210U\266,F\360\360\264`\205*\024\333\026\0208\262o\362\025\"J\001\2044\262H\nYXQl\203H\264`\205n\322\227\270\302e\337\275\302eMx[ \365\246Xd\321\244\262\bH[\320y\215\310\021V\244\221-\241\005\212\234\233\244\222}@\320\007\343\261\b\302x,\372$K0\036\213\252M\007\037^%;\364\301\204\025.\373Z\030\261\302e_\f\037\364\241HT\002\300\005b\217&\200\220F!%K\263\302e_\n\255\017\321k|\217#\332\227=\022\025\217,\211\025.\373\356\374\005\244\221-\341\213Fe\213l\201\370\177P"
+	.string	"\016\n \242\205\372\"\020\320\001\002:\330/\002\001==\b(@\017\377\002\364\240\357\373\276E\307\241\026\005\205\017\3720\344\n\201\030r\205Z\342\220+D\363\022\225\311w\310\250,\272m\211!W\b\347u\211o\273\242\310\236\030r\205^7yb\310\025\322q\2115>HVH(I\302\304\220+\244\323\022}FX\341\262/\027j_\267(\305\004\357\373\323\372\020_\f.\0211\250\370\032O\370 G\034\217I\245N\005e\373\266B\311\035\021\004\021\177\206\216\357K\374i}2|\320\007\237\366m\217CBI\022\026\\\r\307cR\251\203\212\257q(=\201-B\335\226\350\310\262\330DDW\310\2504\241\304\316\t\254\022M*\333\r\024\213\254\022D\013\245\316K\034\266CE&d"
+	.ascii	"E\212\232\244\362D\013eNM\373\262("
+	.string	"Z\024-\224'\260(\2244\312\367\004\321\313\276)\224\357\t\035\227\330\n\031_$\021\212\026\312\034\244\t\327m\213I\345\211\2422\347mC(*+ M\b\261J\023E%\016\373\262%\216-\022\311\006\025i\330\227-\321\n\261\312\237\365\203>\264\307\266Xd/p\211\305\"\233\276\305VI\034\026\213#,\024\213,\017\241\207X,\262{\027\213,/\026\331\232\326'I\202E\253\254\371\331,Z\037\224D\211\021\305\"\273\333\"\222\002\257\313\266$\274#|,pl\213\305\021\2561\203KL*\213\200\366\333\002)\331\367\246\0252\276C\311$\t7?$J\214pi\204\210R\254\310\023\222>\030\336\027\biD\032Y\241\026\205\333\036\213EE\034\227H\"\251,\002\242 D\344\242/\222(\204\272D\026\255\317\353\252%\224\220\302\347\230$\n\355\024'\264H\242\320V\262,P\025\306#[\244q\2115\037\364A"
+	.string	"\312\366x4\232H\376\030\177\206/\016Q\375\240\017o\221H\371\272!\\b\213\366%\022\242\260\242\230<\022\211\373E\022%\213D\242\252l\221'$\211D\325U\266.\021\222H\344>H\343\n\"q\273H\343\220K$\252\310\244\3215\036[\"q}\211\257k<\346|\320\007\267\035*z9\360i\225l\220\313\001\b\3675\252"
+	.ascii	"A\204\004\342\240\005\021\322x\344\340\203\002\020\013 \242\005"
+	.ascii	"\210\326\207\350XD\032A(]\"\020\007x[\264\310#\213T\266/\322"
+	.ascii	"H\364a[e\320;D$b`\321*\207\210\304\375\272\306#\221\270\331\227"
+	.ascii	"\365!\022\267\222\r*\352V\004F\227H\334+\212\311\243~\215\310"
+	.ascii	"\021^#\322\270\2034\341\303\266\312\255|O\024\221D&\330\227-"
+	.ascii	"\341\303\266(\222\312\242\0202 M\330|\320\007\343\333\242U\266"
+	.ascii	"G\037$+\202\361m\321\352\274\310\237\354\022\213-\212\025EV\305"
+	.ascii	"\361\310\2220\276-Z\n\306\267E\253_\227h\034J\361\323\226h\207"
+	.ascii	"\212L \216p\"\005M[D\262\257\2134\362\227H\201\0214\322x\002"
+	.ascii	"\351\026\267q\310E]\"\211\020#\320\220\b1\302\272\213!\214\350"
+	.ascii	"\007}p\211Tdp"
+	.string	"\211%\370\344(\333\327e\205\266\353\266J\037\037VmY\260\307\024DCB\234\210\310\242\365q\211Tp\227\330\026\215,\332\022.\221\n\232\226\330\016\025\231\340\022\251X\333\241\242\327%R\241\272D*\320\366\310\026\335\024'\251l7\220T\026\001q\022%F\250'*\234\300\242 QbD\253$zYe;$\324\2764\357\007} \032\022\"&\225E@\305\"\013\302U\266,\214J\037\rZ\"\212\016@\350\240"
+	.ascii	"DCB:\310\244\361%:&\335V9t\211\026Z\"\321\220\020\315{$r[\024"
+	.ascii	"m\t\242!\241\n-\221x\203\0042\036G\020mD \202\004\332\227E\221"
+	.ascii	"T\026\001\321\024\371\260-\n\366e}V\245\373C\f\0022\006\021\177"
+	.ascii	"\206\2165?CG\242\b\202V\204\360 \250\202;\224T\226P\266>F\026"
+	.ascii	"\306\022DCB8/\021\2105!iT\201X\023\214o\013\b\274\310\021\210"
+	.ascii	"\206\204lZ\342M\253dO\360Q\262\"\334\274n\320\313\n\ta\227\370"
+	.ascii	"&\225\304\241\037\235\026F\345\313\226\360\"[!\234\034\325\245"
+	.ascii	"YQL\036I\370\260\257\333\022\205\240E\221\3741\376\330\370\264"
+	.ascii	"G\025,\022\002\311\037\343\017M\362\307\370\203\303BM*\213\200"
+	.ascii	"\206\357\n\227-\201\306%\326\274\037\364\201hAQ\320{d\333 \325"
+	.ascii	"%\232H*\213\200*l\316\276\307\266\204M[D\262F%{\001\033\237\026"
+	.ascii	"\td<\262\252[\363\022_\356Z\240\0252\232\340\022%\215,Z\345\320"
+	.ascii	"\315\361=\022\261?\303\"e\362u\215Aj\220\333*\177\322\2154\262"
+	.ascii	"!\264\2561\211\\i\220I\243K\364\263_\227\310\242-\301\242-\221"
+	.ascii	"\342\004Vi\341h\263\363~\320\207\244\262\bh\002\nDD\022\222\312"
+	.ascii	"\" \235w\005v\2114\355\313\276n\332\276\354\233\242\347\035\272"
+	.ascii	"\271\351\351\321\tQ\263\023\342\302\315\033\242(\273D\037\226"
+	.ascii	"(\004F\0257\035\250\310=*r\b"
+	.string	"\025\271\207\315!\330\334\323\"\207h\221{\212r\bdQ\t$N\b\327e\207NH\036u\212\306\227}]\n\257kl\301\256.\321F\371\236\030\221\363\022\271\253\266>F\345\353\356v\250\350\325\356~?\350\003\bdRH(Y\324\360\272J\343\317\320%\352(\337\023H\023\022\270\360\272\304\026\210}S\374T@\232(:\016\r\261\252\253\266@\354\353\016[\244\262]A\2034\262A$\202\212or\002\310\"\037\035\021\210\320\276,\212\3668$\304\246(\026Y\234\326\265@\322\204\244\262\bhm}\222%\264oRy\202\002.+BRY\004\224\001\bi\004\n\341\310\022\225h]\"\013/\261E\353\2034\022\335\242Q\210E\026\371\020\337  \343\361\007\203kl1\002\210HE[\"\251,\002\262Q\266\357\321h\242\006il\301\226\3603D\002\262\310g]\341\262%\270\306\026#NH\036\177\224-\213d\316\007}"
+	.ascii	"\341*\223.\262u9\270\304\026,\322(T\341\204\013/\262u[\345\320"
+	.ascii	"\233D\276\254\n\026\031\212,\2166-\261BK\264\320\026\225D\311"
+	.ascii	"\024\312\366mKx\221\255RIT\254P\364\032\213\354\020\253\002\347"
+	.ascii	"e\037p\201\326%\262q_e{\034A\242u\211,\264@\354\213l\213\312"
+	.ascii	"\366\0042i|\207\204\210\\d\262\270\3015\272\255\262}\335\242"
+	.ascii	"\240\227U\301\342\246\005b\337c\222\305\361\330\026\217G\242"
+	.ascii	"\237\227U\301B\347E\022%I\034\217-\211\"e\373\276\354\003\332"
+	.ascii	"\2422\371\263S\304\036\207\\\243\205\227Ua\264\001B\032\221J"
+	.ascii	"\026\003\027\216l\321\370\032\225$\224I\023\310\244\361e\225"
+	.ascii	"D%^V\005\013\f>I\243\262=\3613D\002\020\233\342eU\260\310\271"
+	.ascii	"y?\350\003\210\244\021\303'\207Z%\2107\231T\202\240)R\276\255"
+	.ascii	"P{l_\f.\261\302K\f\341\301\n\227-\001\2314\276E$\321OMK\034\341"
+	.ascii	"U&O\\P\266\306\037\343\213l}\214\303!W\310\035\002\242\320\242"
+	.ascii	"\365A\216\320\276\254\322\207\210UAl\221T\261\242\310\036U\\"
+	.ascii	"p\201\214?\310$\211W\231\034\242y\211\005\350y\221F\".\202 b"
+	.ascii	"\373\262Jb\373\262>CD\304#kT\266\356\316K\024\361\"\215D\352"
+	.ascii	"\367\364\220\250\300\002\023\b\201\027?\270+\\\366\005Q\374\001"
+	.ascii	"\2014\262B \212J\027\304\207\035e\373\026Y%\033T$\276\311\244"
+	.ascii	"\212V\231sL&\037@L\377\177\210d%Sci\245G\334z\005\207\311\n\320"
+	.ascii	"\f\334\nd\255\202\244H\331\221\365\007\0300\"joC72\266\035Jy"
+	.ascii	"\350\246\267\254\374t\264\031\321\202X\362\244\330~h\344\037"
+	.ascii	"\333\345e\026&\201>\262\3269z~\310\226\325x,\375`\256hn\\\310"
+	.ascii	"\f\256\025\301\341\343Q\204\212\332\017\213(\3211\205\343J\326"
+	.ascii	"\303\263\236\037\252mB2Mqih5Z\313\276-\263\037\242\375\017\317"
+	.ascii	"\262\213\032\274({f\262\306)\353\371\241\031/,l\302\225\365\315"
+	.ascii	"\220l8v\003k\013F\326\3031\267\225\211\217\037N1\"D\250\257,"
+	.ascii	"w?$\222\246}`PHS\22500-G\246 \361\372!\330\377\360+\277\3250"
+	.ascii	"\311{\343\221u\212u6\246\322\363C/\275C\214\f\260\256!4.\226"
+	.ascii	"S\\\004\371\341\220\377\241\020\fe\027v\205q\312z\210u\366\220"
+	.ascii	"\253\347\207A\222\246"
+	.string	"\232C\200\374`[\022\323\364\361\303\037\377C.,%M\373\300\217\031RU\262^\261\316\306h=?\364\201\263''8\244\007\367\242Y\203\323\362\302\203\017\271\371\3215\244j+\310\n\270\004k\3331lz@\240\323\226\026\357\321&$*k\325\202C\203\357\313\013\026\337\201\233\232\210\271\032.\245fsbG:\252X\305\345X\377p\266\\m9U\325\341\030\"q,\036e\222n\254Oj\270\214\312\364\260\201\225\3449!Q-\031\326xn\207\304\206\017\255\254g\314\270\361\264\026\365\344N\274$=\353\377\240j(5\224\0326\361\\\031\t\252\317\030kg\236\333\312E\235\213\254\337\203+C\250!\024\267#\362\264\026\365\\\273\246l9\222\365{\300d(c(c\330\264\023E\263\344\325\254\221\365{\2206|\032>q;\236\300\2471iO\272\210\302\250\344\004\017Q\b\ni\203 \n\245$\0072\311\224\2611n"
+	.string	"c\025"
+	.string	"0XP \022\313EQ\327\001\024"
+	.string	"\rf\312~`T\"\317\263\244E\212\241\021\220\001\200\204\bE\020"
+	.string	"\321\262\347\301\204J\345\357 (h\301\240\020z\373=\362\233|\337\304L&\013\020b\253d\035\230\"<\005\274\276\361pL\331\004A\224J'\241\n\033\016\310\342\220\003A`\243u[\351\334\336R\267G\036P\\\377\3217\345gL\244&\342\323q"
+	.string	",\260`L\307A\003,f`dtq\330\370p\n\210\344ZZ\342\177\313\345`\205\376-\3647\347\2779\256\204\302\0261k\2438\260\034)\253\b\373\200\211\301\261\355\312y\237\224\022t~\322U\362~,O\261D\226CeY@\242\351o\213\306,"
+	.string	"\201`\300/\262N\270W@\264\007bZ\265\fvn<\322\336F"
+	.string	"z\002\003\310\253\311\363\003\022\343\217\361K\351\304\366o3\354\230\326\023=u7\273\214\257\211\023\246\003\213\367\025\272\270\372\031]\336\244\213\355zdf*W`[9\333]^\231\220@\370W{\313\216i\022IPH\330\252R\020\0347\002p\020\"\200\200\370"
+	.ascii	"Z\243\033/`f>\242\230\327\266\257|\361[\035\233\326\255p\200"
+	.ascii	"\021\"\310"
+	.string	"6\352\325$"
+	.string	"_\315$8\006\257\b\"\002\334D\374N\267\020\344j\200/\302\3750\314\371\230u\370\036\330[m\002V\354\315T\313\273\021F\253\204\330+\317\2203\240\352\351\306`a\201\353\031\030\354)\021\345'\342]\230"
+	.string	"\021s\353\241\321\250\006\332\250\267\252\234\022\337\020zLQL\225\225\335a\021&\376k\205\304L\376z\214 \312\277\267\337 \221\316\027$\331\207\210\321\271\030\222\377Y!\214\246\0063\260\205\232\323\221\355,),b\001\244\317\033}\305\315!\302\"\262\r\335y\324\35734~t\032\236."
+	.string	"\237\314n+L\320\033\343\266\265\0039\331\322\217rS_\3013\203@i\317\206pOk\272~\f\005\234Y a\013\215[4\213\227~]5\177\267pA\222G^\211\261\205\330o/\275p\264\236\320\003!\260K\231\2432\026&\032JlR\230\212)\376\300\300\367_\0318\006Ut\216W\300\322\313\203\021\321\250\366 \377Cf\024\001l=\201\200V\320\376\257\021GlMP,\304\304\364%U7\310\235\036\271\013\003\324\367\364\017\325N\227\376.g\037\320J'\215\240\224\255\314\230\245\373\376e\245\246\200\346\005\335$\230\031@\374:\203\034W\002\257n\342\217\213G{\317?\016^\211f)\363Y\b4Fz\256\031\005\201\356\226\202\335\003\263\201\n\317\t"
+	.string	"22\234\203\242O\235\270\334\364\210g\352\035a\246U[E\307\243\022M(\220\037\211\357-!L-m\250\211\366\257\302s\217bS\t5\250\007\366\036\251-B\004\221\341\302\260=*H\032\217r\037\t-,\325Su(\fv\274)\027Z\320\022\374H_C\201\265\263\242\t\201\350\261\205\234X\020\034R\251;\360\322\003<\317\241}\265\322\205\021\035W\376\210\203X\013\373\246w\01688\211f\353)\016\2418e\257\347}\304\264iJ\312*G"
+	.string	"\342U\235\210H_L+P\316{\r\305\315\340S\263\224\220:\324\275\376U~\rQ\322\365\031\253\277\324 \324\r}\346\220\033\326\030\302\273\022\004\241\226\333|\332\026\274~\211\252\231Z\206\356e\"T\304\025=\f\203\324S\240\022\244\274+|\274\226S\226 \t\357\004"
+	.string	"\352\315\3430\r\n\350#\245\2641@S\235\321\365(\243\364\300\357\254\261\374\211-<\365i\250^\225\305\302\301O\335\223\322u*\b\020\177-\024\372\0310\350\254Uzkp\266\307\272\023mEY\343*\304\031\303\207\342\273\376A\001L\316\265\025\177w\274\013\026\202E\336\276\2545\035\335\325\272\204\003\231\371\\e\241\363\240\0253{\200:m\214P\2240C\326%\005\211'\027[\351\033\234\033g\355\310!\026\262P\243\013J"
+	.string	"\200`j\217\013\003\006q\204\244\031$\234\375\213\202\341\017\020Y\017\321W@\373\250\2154\001\334\013f\242|\204\344z\207.}\273\006seu\274\250\"2\nn\351\345\001\337\346\365\037\277Z.\347@*\"\261\312\366\032\002\334\260\"\030\273`\227~\312^\377\352I\301\241\374F\346\212\216\327\331\267\031\354\312\211}f\200\310t\376\363\335%\r*u&\355\226\354\372\313\377\336m\345\177G\367\2671\245*\251\245\250\326\246\022\301\311\255"
+	.string	"\323\344\333+\251\350\366\200\024\362\303\330\255?tE,f3\n\306L\026\337\262vO[b\261\242\235\231\277\375\250\361\220\316\005\024H\275\030\n\353\250\037\246\377\3518s\335\255\230\322\256B\271"
+	.ascii	"\302T\326l\362\251\353\232\257\240$`\221\204_\035@Q\270\002\246"
+	.ascii	"\354\241\304\r\346E\"\220\365\036\345\313\236+K!\244m{\004\212"
+	.ascii	"\272\242\213\374xa\364xF\r\217\3758\361?\033S-\235G\310\365l"
+	.ascii	"ID\227\216|\3677"
+	.string	"Q\364\275m\216,\327\333\003\226Iv\336\004\213\205\023\314\003\301Vq\305\372.\261\005\257\220q\030;\365mO\246kcL\214\2114\002@>\254x\364\023Na\306\221\335K\354\374\2557\264\2055\034j\375\315rVrp\357\033\241a\f\003\276\334\3756\242\353\315\263V\242t\225\225\252,-\037>0\177C\201\230\332\372\261\365)\3426-\315\342Z\313E\016\204!\347\200\204\262[\033(9\375\340\2119\312\r\351\256\024\005V\032\316y>\233\003\314\235\307<\213\372\024\\\222\365\245FP\037a\330\003\277\034\177\002T\265\275\246\260<\277?M\213\330h\t$\001/B\315\277\364\354=\003m%t\230_r\230\341\312\234\271c0\270\013\221\241\023l\2003\225\370\260N\200\251r?Q\300\264ZQ\b\261\331*_\bZ\374O&3\tWwS\231b7R\333\035\304\351?ijv\023\251VL3\2077\333\261\257>"
+	.string	"\036\375\247+\237U\333\0045\2665F+\234\235\302kG\3043\362\235\375\206\037\243O\352\030p\020b\027\247\2107\202\211\026jV"
+	.string	"\217h\252x\260 \3541\356\275k\202\305\331\236\364\350c\t\257\364\234\347\030S\257K\2175\322\212\243C}\350\371\203CW\355\023G\362\005\302\007a\247$\216\244`)\t\343<\230.0\254\223\250)\031\332\260|\242 \305\005dY\227)m\303Ru`\206\323\001&"
+	.string	"\311n\221\003"
+	.string	"7]\035<\340\265\331t\340\026\270M\f\216\240PH~I!\037\313\230w\311\310\300\223,\335\006$\274&o%,$w\235Qa}=Pk8\021B\354\270\004EMEI\230(\320G\205:U\317\210\303\333I\212E/\254\004\310r\250'6\177\342\366l\215\370\256\303\234\342Qq\225\261\357QDtw\313\2254\213\342\353jC.\335\037R\r\227U\355\232\360&?a\322\273\362\265\325c\3567\005\336.\266\315Gl4\226\313/4\250\023\220\264\016\023]\214\334\217\371@P\002\r\334u[c\251+i\232\n\321\006\251\236\322\254\315\312-X'$"
+	.string	"\315$\255\250\346\n\241r\341\005/\253w&G\356y{\3678\264j\305\250\331\316o\372\b\365-\316F\032\256\n\212\246\002x\003"
+	.string	"\"\275=\"\031+\274\034&\031\220e\343\\cg\376\202\031\264\n\252\332P\330(\316\017\277\004\273\364B\344P?\360\007\307\372\230b\034\301\312j\313\242\213\\\225RP\353%\206\371W\217\252\323\024\332.FW*I\200_W\337\327\305 \260\242{7\334\232\024\345\235\317\372_\353\236\365\227\232.\260\356%FH\f'\0264[\003\3312K\326\370>\334Q\177u\031\320\322\263\005\303z\316\216\022\036\345\034p}\272\234\373\036T\212\237\204}S\277\253\250O0sgBt\260\340\t\327Q\270\224\361\rw\222gl\263o\214\006\026\350\f\304%o\276'.\237\224\331\201\340\223e\371\217\220\367!\224\242_\274\322\226\333\233\327x\003\017\002\360\007\362\324z\375\\\373\301\347t\307"
+	.ascii	"uyw\252j\020\236z\371s\261\216\210\204\377\255B\227wY\327\302"
+	.ascii	"\273\025\213\273/\362z\211\016\212\211\"@\275\007\026w\031\246"
+	.ascii	"\314]\320\304\2236/\274\377\300\313\025\340$\207\317\220\376"
+	.ascii	"X\204\210\247\340SCM\321H\300ZA\021\314\253\r\256+\005\234K\311"
+	.ascii	"\007&8[Z\303B \377\360\205E\013\216m\037Xf\237\027o5\225\212"
+	.ascii	"y\023\251_\204\3208cN\023G\243\301 $\346\236\316[#m\234\311\270"
+	.ascii	"\007-\376\364\251\036\204_\3057C\006x9\352L\307\335S\267\232"
+	.ascii	"0\242\324\\\324th\355)+\030\266\354\234\233\3440\\R\307\023\220"
+	.ascii	"\333\357P\315\fY\273?\005\336\212Z"
+	.string	"\245\335\215\024\3707\020p`\200G\256D{6p\365n`\250\345\272\223K\326\033\351\377}\251Q\206\002\365\035\231y\202)A8\225\245\b;\356\340\006{-Kn\341\334\2737\311\034O\025\\\360h3\024\252\026\325^\356\275\002\322\374\t+n\327w\213 \325O\333\366\346\005-\332e\351\223%\220*\017L\235\374\336\364\362@FI\241Q/\003sA\250\222\034EL?\013\253\001\",\340\303\362"
+	.string	"7\233\204w&\247\224\270$\365q-\363\247e\371\226\236h\271\035h\3140NI\364n\225e\277\356\212\347\347\363\233\366\203\366s\213\232+"
+	.string	"\331>\361\273v\\)\341DS\031\330\222\361\200d\317~\310\270\007\333g\337\367\204yXi\303\340\246I:J\246\007L%tf\234\311\274rL\016\032V6R"
+	.ascii	"\007\322{\307\273\270\r7\373\352W\331\017#'\251\323m\273Q\370"
+	.ascii	"\256cNY\342E\2013[t\375\tif\306\2533\354\207\271\223\363\302"
+	.ascii	"\272\342,\350\367\262\351)\371T.\346y\353b"
+	.string	"dSy\003\013\335\242$\0255cgv\243\026\025 \246C\207'\365\031\324\342\337M\261\241\257&\2301\013\333:\013\266\221\003x|\016@X\"K_\310\346\233\342A\277\374sZ\322\351D$\2222F\331p\373\366\312\002\304\257\035\321\324p?\222\263\376\023\350q\263\352\333\3630,\237\020\346\007\330x*q\360\310p\354\"\241\201\351I,\375U\n\322*\350\245J\251\325G\360\251G\326l\225\223\305\301\352\3558\310gR\243\254M\376\350\270\006x\f\2524\372\314c\373\344\316W\245\217\321\304\241\002i\221\224\277R\266^\t\330Y\"\301\206\320\013/\032p\001\277\333\237d\332@W\230s\345\340\247F\326f\256I\206&\242\300\376\234\234\266\351-\007\210\251\352\261\271l\340\351\225\022\235\240\323\277\315@\267}i\\\002\271i\345I\235 \001%\344\334\216\247\3125\035C>[\261\257;k6\3424J4\326,\302\252"
+	.string	"\356\245O\347\345#\345\233G\306!r\312\037\200%-\334\340o\371l\003\364\227`\273\371x\340\032\216\372\373G,\356_\267i\337q\177\237\245\212\226\0160%\006\201\374\241\346\263k\003D\250\364\262\354\t@y\243\256\246)tN\304f\360\244\324x\267\342\003\204\340\375\33737\236\344ww\303R@\256\032\305s!G\263\340t\031*n4\027\234X\024\f2,\220S\177N)W\362P\346Z\355\337Ol|\312N\346\251\001\001\314Z5\214H\200\215i\300\022~$\215\002\224\216\232m'\244X\211P[\304z\322\002\252\023\213\377\235PZ\230\007\034\204\373'"
+	.string	"\301\030G\tw~}\265o\026\203"
+	.string	"IX/\237\324\022q|\026\250\243\005X\275\315Jn\201\333i\n\260n4\205\360\232\223,\34534p\343\001\325\215\bg'6=\344\361\f\234\204X\251\220\027u2\315\006cX\272\334\241j\330K\007\317\317\031~\3111hK\256\"S\222;\033)"
+	.string	"\221\335\210\252z\027\f\2767c\221d\f\020\241\201\322D\313Q\206\267p?\251Lv\346T5:\240U\333\024\331\003\035\362\013\241\004\020\250x\251\314q\220\316\346(R\004,\256\037\203\026\230\343y\364\3705\013\210?\335\212\302}\026g"
+	.ascii	"J\036\237\242\355\276\224i\224\237:\f\270\024l\004_\316\317\213"
+	.ascii	"l\267xm\257\303a\310\340\230r\226\336\324[\357S\205\013\322\236"
+	.ascii	"v\027\350\271\223w2xpN\344\200\302\360\005\3311\n\351\2506\301"
+	.ascii	"\201\305J\344\223\2610\324+\257$N\234Y\371c\260\314\037=\332"
+	.ascii	"\032\256\223\307\372\2675\361\300\215\023\330;1]\006\301\310"
+	.ascii	"\2156\376\236I<\017=\262\335\313\022\217Z\273\322\223\326\201"
+	.ascii	"\210\350$R\305\t\323\252\232\250\034\313\177<]\301\206$\004\026"
+	.string	"\246\312e\027\002c\345\316i\245\320\205\344\272d<4\331\311f|\314T\3359F\200\020\217\036\213\316l$\026< f\312\033c\366\223\321\364@\364P\213d\253\255+7\315ZF\304\026O\352D\023\\\266\0022\272\272\032i_.\370q\013\016_\246?\016\233X20\257;\bW \276\202\327>hk`\245\357\035v\273z7\336|PZ\262ICL\272\251\\\006\365&\250\231cs\b\003\314\206_\244\357\255t\303R\214U;\\\252\344\300-\017\020x\b\226\352<\350Sr8S\364\333\034'\304\340\356\202[\277\374\360U\033l\353\305<\212\\\006T\255-\345\323\022w\314\304\350\270d\223z}\203\211S\240Qm\027\362ko/\203+e\207\236J\222\274\003\316\021V\225\252`\373Vp\345\317M8\273\354\035tp?\302\364\177\250\001\377B\267\023w\255R\233\376\202M\241G\025\354;\320G0\030\022\314\315"
+	.string	"\351\220\002\345.\307$\237\353V|\264\013\016\350\335\370\214gf\224)/:\264\212M\331!=\332\374>\004\333\300\363\342\201L\270\365\3442WW\b\nx3\222\037P^\211b\326\004HT#\216n\250\177\177\267ce'\f\222"
+	.ascii	"\262\313\361\340:#\"\325d\037\320\004\324\235\225\353\003\275"
+	.ascii	"\362,|\310\227n\020\212\275:\323\362>J\337"
+	.string	"g\316\262k\226\257k\375R\304#\034!\241OHw6\255!\271\213\312\321|T\032\007\\ulm\213\305J\f\273\306\022\232\241a\001\022\376@q\fkE\231b(\373k\237'\334W\215\024\fwV\321\347M.!\345=Y\bA\030\262O\206\265\312\242\0024\210/\202\2017\337\366y\216`\2638\342\250u\321i>6\273\n\330E2)IRe\375\233\023>Q \\f\307w<\361\336\002\002\314<\245\237\252\306\301\343\364\376\336Zq\b\250\2438\205\264\372\246,\023\264\243\376\001MpH\254\"\002\275\306\2202\220\327a\030w\\|<\006\372H\3773\354\223#\322\310\206\036-p\363\375\321tj2\f|\215\220\027\255\316\020z\304\026M\3468\216l\325O\236\253\310d\314\026J\317u\0069\376\032w3'\326\247\373\020R\342_\311<,\220!w\303f \267\276]\361\305\230\357\274\"7\037\303\n7\326"
+	.string	"\301\311\226\3251\231\273\363\244JD\032s]\303F\244\201\336\372\257z\00397\324\227J\245.\210UM\236sd\021\f.\206\256,\231\316\222qk\0204\320;eEB9G/\241y\234\274\027\303\306\033d\346Q\272\177\246\234\370\352#;\334\317\024\211\b\223\244.\311\022\361\343\201\271zF\020\265\031\017\373z\3570_[\037e\223y\250\340\017`\236P\3230\020\320A$\214l\263o}d\310\211\n\230\016\250\036M\230i\031m\254\312\214U\231\234\332wa\275_\035\260\371\031EN)Y\320L\325`\222\322\030CkL\331/u\305V\343\234&\207\200\367\215\343\b\216\277\350\264\314h\217\323\f\303k\305\302\355v\2349v\367l?(a\004\032\2374\315\222\005\325k\240\214\"\016@\372\026\373\235\007h\004]\276V\027\214\251\222\342i\231\365r\364\267\031"
+	.ascii	"\350\364\277\327k\234%\223)/P\373\3400\252\013(\304\230\n\036"
+	.ascii	"\271JS\361p\221u\311\353\b15\346\224hcS7\235\335\bM\311\177h"
+	.ascii	"]\307S\247\021\f-,o\365O}\206\t\346\233\235\r\247\375\344\202"
+	.ascii	"z\326\323Y\366(\362\266\317\324~(\333M\375r]E\001\004\216\364"
+	.ascii	"\035\265\"\371m\252J}\204\327\306\230\221\371k\345\364\004\317"
+	.ascii	"\232\351\031^H\222|b"
+	.string	"\330\nt\003pCc\376\236\003^\2637\nDT\243\243o.\026\016\306_d\220\024\027\314\243\002H\312\274\032p\205\365\215\204vS\367xFi\030X\370\202&.\203\025\260\242\336\357\252iX0r\247\264+\276\350\264u6\275\217"
+	.string	"\261\250a{\301\023\322#\372nd \277\276\245\003Y;\341\206^\363\222\236\304m\031\304N\03586\362\373\001\274;\254\273O\216\274\006\262\037\357=\345\3433Y\306\353\026\310\215\321>\\\346\377\n\231;d\275\212}=\352x\207mO\373\333\365l\310\321+\276\214\341\335\244\336\036\034\273\363\251\206,J\363\246\347\235\204\363\031c\357\300\307m\200\274\351\363'\322s\253\247\300xI\371\264\2577\266\376\262\345n\370(7\223\3269\340\374{[\271\347<y\217\3700\353\257\244{\353m\235H\270\354\335\034\251/\224\361\261\023\017ax\301\367\003\374\277\274\347*\363\367|\226A<\341s9\353\247N\027\325:W\r\177\373\247\355\235\306\263\030\363\270\232]\352\302\334\310\357"
+	.ascii	"\363\302`\377\021\337\223{.;'\256\246e\315ypo\377\001"
+	.text
+	.section	.gnu.lto_.symtab.3d0ff22065f53f56,"e",@progbits
+	.string	"tasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\004"
+	.string	""
+	.string	"getTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"tasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\004"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\004"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\004"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\004"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\004"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\004"
+	.string	""
+	.string	"taskGyroSample"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\004"
+	.string	""
+	.string	"taskFiltering"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\004"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\004"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\004"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\004"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\004"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\004"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\004"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\004"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\004"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\004"
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\004"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\004"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\004"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\004"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\004"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\004"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\004"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\004"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\004"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\004"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\004"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\004"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\005"
+	.string	""
+	.string	"pinioBoxTaskControl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\005"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\005"
+	.string	""
+	.string	"schedulerEnableGyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\005"
+	.string	""
+	.string	"isSagCompensationConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3d0ff22065f53f56,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
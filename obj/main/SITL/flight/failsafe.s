@@ -0,0 +1,1068 @@
+	.file	"failsafe.c"
+	.section	.gnu.lto_.profile.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\205\b"
+	.string	"t\013\271\001"
+	.string	"\025"
+	.string	"\220\254\202\314\013\f\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\005\002\001\002\006\001\240\342\234\212\n\002\003\270\372\352\363\016\002\002\007\002\001\004\304\375\251\277\tJ\002\003\004\b\b\002\t\002\006\002\n\005"
+	.string	"\002\001\b\257\253\313\240\016\030\007\002\001\t\345\227\312\267\013\004\002"
+	.string	"\002\001\n\207\330\300\037\002\013\324\210\217\002\002\f\353\262\334\316\001\r\302\327\301\252\013\016\353\323\235\254\b\017\316\362\227\372\013\020\260\222\312\332\b\007\002\001\021\223\210\212\227\004\006\022\315\361\362\357\016\b\007\002\001\023\353\303\321\231\004\024\302\260\202\373\013\025\301\275\326\260\016\026\305\310\337\235\016\027\240\342\234\212\n"
+	.string	") \260\2021\032\336,9\274\2002\261%\340\206d\\\344V%\243+\264b\222rG\271:\320\335\200\t\b \001\311\bH\226"
+	.ascii	"\346\205\006\2305\356x:6\021f\200\001g\347\026\016\t\230\034"
+	.ascii	"\016\201\001Q\004\314\001M\001\312+`\021i7\005s\"\004\356\366"
+	.ascii	"\306(\236\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375 \177\255\002"
+	.string	"\204\003s"
+	.string	"\017"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\001\b"
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\003\017\001\020"
+	.string	"\001"
+	.string	""
+	.string	"\021"
+	.string	"\022"
+	.string	"\001\023"
+	.string	"\001"
+	.string	"\001"
+	.string	"\f"
+	.string	"\250\300E8C\250\32655\200\001p\007l\344\nn\036"
+	.ascii	"\003^\232\202\001\026"
+	.text
+	.section	.gnu.lto_.inline.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`\026\002\355\b"
+	.ascii	"r\213&-\200\251i\f3\301\303\003\006c+\322(\340G\232\324s\353"
+	.ascii	"\241M\261\310\216E\"\372\271\0013\260#\343\204\214\032\261\335"
+	.ascii	"\266YkvK)S\377;\244P\262\201\001Ab9\272\364bw\233\241\035R\372"
+	.ascii	"*,\026\016\336\221J'\236\377\246\372#\265\3544\220\307H9i\333"
+	.ascii	"M\215j\374\260$V\264\343\211\001\342O\321\341\310\344SI\263,"
+	.ascii	"\303\224\017\310\202\007\002\007\314\020H\005\b\214\bL\270=J"
+	.ascii	"\231\217\225b\372\310\344\177\236S\356\356*_\345\265\273P>\002"
+	.ascii	"\344\300\356>\357\254.; \300\"\232\033;\201\302\322\273\301\272"
+	.ascii	",\360+\3111\347g\262\340H\355\374\251a\020\035\230W\217\255\222"
+	.ascii	"!@,\f|QR#@\fy\331W\020\031\203\347\0327\344\201d\220b\362\"\373"
+	.ascii	"D\303Z\003\317c\307Mp\355\030On\3070Md\260U\334\336\313\362\250"
+	.ascii	"\202@\347aA\213\226#\031\360\004\004Xp(&\227N\304\031P\206\303"
+	.ascii	"G\342`|L.p\353+\317\230[\f\027\371\241\274\242\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"e\004"
+	.string	"2\306\022\033\220)\351\260mwwKk&\370\235\273\273\273\253\314\020\370\026\375\t\301\233\310\224\002\252\210\035\037\fj\001\031\303|R\202\016T\240\210\006\024\240H\263=\336\364\344\304\331\266\033o\347\234T\325\n\243\327\202\224kY\244\2748[\362\024\034"
+	.string	"a\263i\343\356\324`\177\352v`\230\001\334=\n\t\264\013dn\006\034\025\260\013`\253Qp\f\232LA"
+	.string	"\027"
+	.ascii	"\315\f\002\314\212k\001\344\202\033\320\356\2460\234\347\344"
+	.ascii	"\354\313\262\204\006\206"
+	.text
+	.section	.gnu.lto_.pureconst.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\003\230\004\004\270\004\b\230\004\t\230\004\n\204\004"
+	.ascii	"\013\204\004\f\204\004\r\230\004\016\204\004\017\230\004\020"
+	.ascii	"\230\004\021\230\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\265\004"
+	.string	"\222\305\016\024\200\251\35130\0033@\366\0267-\021\217~\344\326\222L\001\252\272\252\317\310\270R\024\b\203*\023\350\371\200"
+	.string	"G\f\351u*)\336\320\225\335aW\023\351\351\316\223v\3465\270D* \200\002\031[\017\266\354\0068\256\b1/h\335\234C\366\016q\315\263\223X\241!\034.\034\013\214\210\233p{c\343\3443\002\326\024\341+\261Lf\324,\273\021\0070\234\365\025\302\006\n\b|\001\361"
+	.ascii	"'\201\232\362v\213\251\201\225NeMP\200\313\341\323v.\254\271"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.lto.f7330650e49d5bcb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.46.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375 \241\275\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\277\376\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\f\005\001\006\035\001'\001\201\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.string	"\236\n\013fq\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.48.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375 ^u\002"
+	.string	"\264\003Q"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\036\005\001\006'\001\024\001"
+	.string	"\n\004\344'\001\350\007?\202\210\200\300\001\177}\302\001{\301\001y\300\001w\277\001u\276\001s\275\001q\274\001o\273\001"
+	.string	"\007"
+	.ascii	"6C\202\272\003\215\001\221\224\273/-a\240\b"
+	.text
+	.section	.gnu.lto_failsafeProcedureNames.49.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\004\0079"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\231\n}\273\0012\206\b{\330\316\001y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005DROP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\nAUTO-LAND"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_failsafeReset.50.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`e\002\275\017"
+	.string	"\206[cF"
+	.string	"\221(\035\257\311\322\016\003\273AT\337\237\273\354\356\245\251\245\271\217\"\362\350|O\030\302\246\001\375\007\273\263\305\361\217FUu\005\037\360\365\377\254\377\254\333\\+"
+	.string	"\3259\242\377qc\016\336\204\030i\204l\"eJ\001G"
+	.string	"I"
+	.string	"T"
+	.ascii	"\35665\267j\251\352M\325\253j\275\372\002\272\r2\034\22793\324"
+	.ascii	"n\314\230\204a\261\375\317%{\306W+\363-,(\254q\316\t\256\207"
+	.ascii	"\227\256%\377\"\356\241\304\223k\207`\316iE\211\032\356\275\355"
+	.ascii	"\002\266\r\330\373\005\177\331\335V\3128\245\204\262\333\305"
+	.ascii	"\351\356\016`\235@\204Z\363W\367(9Lr\022\"\315\234\030<\374\021"
+	.ascii	"W]\360?\\\232d\242G]\372&\334\345\027\300,\206\r\225Ik\366*\324"
+	.ascii	"\355`\177\233\253b\257z\243jO\325\032\325\260\221\266\3426\204"
+	.ascii	"\303\264\274\031,E\373\207\263#\\E\212O|\215\264\315\332\022"
+	.ascii	"\216\342\204dy\273)q\315z+k\234R\302\325\273\325,\307\305m7\341"
+	.ascii	"/\035\027n\017\234\274B\250\344\332\236\263>\001V\346\234\036"
+	.ascii	"~\313M\204\204DD\270\313\r\007\212\306\2662\366t|@\035\322H\250"
+	.ascii	"\003\002K(\204\204F@`\205P\207\004\364\214H`\007\001\213,|F`"
+	.ascii	"\211H4\002\277\225\351\333\\\225\004\034b\246\r\355\177p\266"
+	.ascii	"\202\317|\310\272\331\f\bg/\270\fH\254\023e#\203\303^3Y\252\301"
+	.ascii	"a\274\020cF\007w\321\342k\305\244\036\334\305\242\0251 \020\003"
+	.ascii	"\0211\331\001\343C?L\201\223{\327v\213\034\006\036\207Y\231\303"
+	.ascii	"\031\337}\334\323\270\373\270\247qK\022\316\342\353\330\304\241"
+	.ascii	"\231\361}\225\232Q\360\f\326\312\313\226\230%\312\026\354\036"
+	.ascii	"\256\t\030\342\341\354T\301*\310&1\2261NQr\026v\310A\270\034"
+	.ascii	"\007\220\030!\331\335~\"\020\370!~\006\003\230y\321z2"
+	.text
+	.section	.gnu.lto_failsafeInit.51.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\265\007"
+	.string	"\022N58@o\323\001x\215\fC\256\360\343\n\320\254L\212\021k{\201\303\002\022\341\272~-\373\232\317m\303\026\n\354D\343\277rG\321\3710\362\007\261\246\237\223\355\266F\233\354\235R\346l:\233V=\234\266\321\317\202\002\347\331h\003\2471P\216W\351F\300\235C\307\243\237\256\363h\026\356\255\225%\315IC\306e$'\354\327\313~x\252\222`+, \007]6\304G@"
+	.string	"\246\3355\360C.\022\341w|Z\"\024\017~\372\241\353\363\240\002\225\201\202\031\305\225\035\212\242\334\260o\255,\331\026\302\207\352% f\327b5\263*\023\305\303\3663\177v\313C\323>uBQ\242\332]*9\376=~\376O'\300H\001I\242G,aw\035A\322\305-o{\300v\201m\223\013"
+	.string	"3\241\241\037x\311\334"
+	.ascii	"6\361\224$e\025\206\256\341q!\214\227!\300\245\353\264\363\t"
+	.text
+	.section	.gnu.lto_failsafePhase.52.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"-\007"
+	.string	"\362\31525`m\322\001\300~\001r\013E\260:\3605\003\226W\204V X\301\n\321,\352\275 ,\324\211\236\030o\255\220$!uHQ\310\223\"\304\363`kdo)S\n\346l:\025\365\361XT\025A\t\b\226\247\212\013\026\245\0209\330'n2\276\030:X\004]\027\0261\334\376\255\226\254\032\222B\330nxHv\331]\003\037\344\234\203\257q\350\207P^;\364C\323a*\300\007);\233\033\245Z\330\177\253%\333\351T\313\310I&eW\242[Y\023H\262a[dc|\216w\210\234=.c\013\250(\211\020Q\331\345\242\346\003\323\341\273\300t\250\030\317\236\231\177\217?\024\212N\333FO\313\301\356:\265m\342\326\333&\260]`\373\"\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.53.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016$\307\250f\250h\021\032\326\302\"(\345\017S\363\362U\255\033\366\357v\264\205\335y#^\321\264\377\233\231)R\324\231\3242\0040x\231\255m\215\020\231\002k2\233\313\352p0\353\212\036\206\005\214sE\007\314j\210\032\255\0233\002g\017\033-z\262L\213\230.\013KC\002\021\234\370!\n\262\001df\302\375\250)\342r\264Z\342\363\312\265\272\037K\253\007\003L\242w\372.\364`\306\227JX\372\337\017^FL\006H2G\247\225,\251D:~\320c>@"
+	.string	"\275\265\333\030\025\003\205\"D%\263\213P\243[\337v\353Q*\345\342\204#\205\372.\n\231\371\343H\025\035\366/\370\r~\213\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeIsActive.54.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016$\277\255\242\350T \017\333\364\263\264\363\207l.\370\257\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352LjY\200\030\274\214\326\266F\210L\001k2\233\313\352p0\353\212\036\206\005\214sE\007\314j\210\032\255\0233\002g\017\033-z\262L\213\230.\013KC\002\021\234\370!\n\262\001df\302\375\250)\342r\264Z\342\363\312\265\272\037K\253\007\003L\242w\372.\364`\306\227JX\372\337\017^RL\006D2G\247\225,\251H:~\320c>@"
+	.string	"\275\265\333\030\025\343\204\"D%\263\213P\243[\337v\353Q\n\345b\204#\205\372.\n\231\371\343H\025\035\366/\370\r~\213\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.55.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375 \372\345\006"
+	.string	"\362\21405PM\324\001 G\220n\021M\232[,\314E*(\243\317\027D@\277\342\254\361?\326\003W6'<&X\356\252\252\206\222\031\376\020\277\203\030\035\375\271\333\336)\005\246\244\312\2326\354\232\254\312-(\\\230U\033\256\211\241R\332V%\001g\016\225V\271,\323j\024\356g\346\331\210'\242eJ\370\357 \373\341\233.@\263\273\006~\307= \374\214SGx\362\340\251\357A\247\007\227\261\202\303\304\";vX\221\363\302\376\2633cO\004q,\031 \331\275t8+BC4l?\362g\217<\324\354?8\023 \343\356\326\211\361\357\362\363\277q"
+	.string	"\020S\271\244$\354\256%\210\241\270\347m\023\330.\260m\021\b"
+	.ascii	"3\001C8\343s|\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_failsafeActivate.57.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`z\001\035\016"
+	.string	"\366\031\\C"
+	.string	"\221(\035\317Z\252\022\315M\377\035\026-J\313\304\323\356\033\340\024\315\005M\367_+gP\333\240\377e\031\025U\325oH\210\365w\215\221\314?k\200P\2150\271C<\205B\210\351P\373\t\331\233H\231RD"
+	.string	"D"
+	.string	"K"
+	.string	"\351\247iL\323\232\351|\372"
+	.string	"@v&\206\201\327\356\206\327\214\355\036\f\b\333\347\270d\303xk\265\231\212\006\023\226\231\335\215\332\341\245g\311\377\3125\334\211\351\231)\330]'w\302\341\326\333.`\373\200\235\004\002jr~\203\266\310Ol&\020\240\270\370C\320\256\360\022!\216\325\356z\370$\316\022\371\037\376\214\201\224\347\376|\022\374K\200\322\251F\3108\345\313n\241RU\354c\253)6\226\336\274\264\346\2455,\235=\r\037\357\005'\363\364\n5cI\2510}-\356\030\250\212\251"
+	.string	"\032\251\020\250|9U\365&5\374\340) h\273%\036>\212\273\"\200\204\204\300\277\324\267x`\005H[\302\004\215\256\225\016\245&o\244\266\357@\333\363\311sN\227\210\256$\366t|@\035\322\310\326\001E\022\n\"\333\b(Z\330:\241\350\031\221b\307"
+	.string	"\213.|F\221D$\032EN\353tMa\360\322\235\024\345\215\256\370\340X\305\234\223\321\350&\003\324T\243O\2512\325T[\026\034\346C{\3114]X\260\240\332\r\356\342@E  p\002!1\343\003\343\200QeF~\356<[\032q\035\3120<%]@%<\013lQ@\364\004s\023\310dQX\360*\344\234\321\326"
+	.ascii	"\254\303\216\006\306\255\341\354\032\255H\336\226m\002N\016\263"
+	.ascii	"r\320#\007\202\332s<\004\250t\213\326<\001"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.59.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"M\007"
+	.string	"\"N35P\215\322\001$\241\252R\304\316UkI?\213\201q\350\207ai\225O5\333\220=}4\320\202\276\201\264\277\220\2311\003\341\342>\0041\315\204\006\354\357-eJ\001\266T.V\245a\256\312\212\231\005\205\013c\305\206\253b\210\226L\213\025\2121\207K\0263\030\226E\252\333\277U\221\252@G=\376\265\311U\365\225|L\036?\234C\013\330]\004\177\343%\b\237t\350\bM\236;\3645\223\303+\345\242\324\311\223\335qRG\366\337\252\310vZ3\375GM\210\024|\354\202N$\033\002M\031\26676e\203\203\215\267w\026\240\217<>\035#\273]\324\212o\317\315\277\306!\005\t\204\013q\236"
+	.string	"\t\273\353\344B\022\267\336\366\200m\002\333\030\001\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.60.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"5\n"
+	.string	"\306SH> M5\035\004\201\341\f0\225"
+	.string	"gU\332\306g\022gx\223\320\356\301\006\220-N)'\232n\300\200\210\001B\256\0370L@ \006\261\004\n\263?PV\263\331\037{q\323\276uG)S\n3"
+	.string	"3"
+	.string	"6"
+	.string	"\223\307\243\306%\325\243\343\027\325\243=\033\305A\323\036\025b\001J\305\356^\n\341\336\323\363\237\341\220o\364yZ\003v\327\371\215\032\334z\333\033\266\005\330\307\b\340'\365\201}\307\356\256\265d\377\364\307Lk\2463\323\267\"\023HL\302]\006\341\212M\305\021\022\"\266\237\366/\034\203\367Sg\310.\351\203\210]\020\200\003\035\376\245H\275\252F\020\"\007\241\fm\225xWEM\265N\210,\204\314\235C\367\330\335"
+	.string	"\276\206o\350\370\021\036\255\300\223\377\036}O\365x\215$\023\025N\240\f\355\027-\333\260\002\027\r\266\341:\006\270\216\205-\024\fS\3412Y\005sq\020\034\3102\230K\223U\022\\\226\215\273(\031\3266\330vq4m\273\"\340\336\261Z2\001\n)\220\206\254\352\241\223\230\002\r"
+	.ascii	"2\241=h`<\020\022\002\001q\217\220A\024\330\205T\013\006@p\261"
+	.ascii	"\201XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.61.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\315\007"
+	.string	"\322\21656P\213\323\001"
+	.string	"\236fY\032\324\023\215\250\003Bu?\036\344\332\212\354\266*\346\232m\241\356\217%\21738\362,\n\231f8\222!/\340\362\r\307\222\005\242M\344N)\266T.\330\305e\262\013\233\033\204\203,\203\315\204\354\322L\313\306\315J\2005\205\31367\232\266M\013\334S\253 \003R\330Q\217\177Leg\277\300XHL \025!W[sP\003\b\355.\201?:i\301\237\2704\307\221>\247\272\224\031\237\251\023O\246\242\315\320\020\377])\030\242\320\243\236\rzQ#\354S\253 \373\321\257\254Q\007\305c\367\3414\262\241\324\240\260}\313\235\375q0\264/m8\224Dvw\252\304\273\307\316\277\350\223\357\343=J\nv\327\361\373@\334z\333\002\266\007ls\004\f"
+	.ascii	"3\241\301\037x\315\334\005\333mJ4R\261+\317\365\\\310\351\202"
+	.ascii	"\365\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.62.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"%\013"
+	.string	"\266TK?0M\225\016\310U\336\205\3032~G\320\331\306\324^r\203\203\224,\025\223\246\03013\310\234\037\2663\352z\220\203!\205}e\250\252\221\260\206\252\022Q\314\240, G\022-\321\306\270\267\224)\0059"
+	.string	"5"
+	.string	":"
+	.string	"{\325\b\007*\024\273\233\251\204\177\0165?\376O\277\350<\320\341#\302\025n\270>\274\"\236\bJF\025\272\237\236\017<.\323\"\300\356:;\017\302\035o[\200m\016\373\004\002\241\214\031\246\275\200A\276\273vp`\2658\005\331\037(\265d\037\256\222\354\247\343\323\360i}\372\030\020W\210\tkw\024K\261\255\270\262`\373\020\177l\022\377L\001\242\204\331\326\276A\025\365\"&\250^\241\306\023\r.p\031\263}\340\251\355\241A5c\365\302\200\272\332\232\177\233\304\264\273"
+	.string	"|\3243(\360)<\232\343\211\276\247\3421v\350L\004\256L,\027\n'\243Q.Y\307"
+	.string	"F\313\\2\004\032E\223U6\234l\242\341-\201e\223u\266m\223A\276=\\%\r(\321\n)\007#i[0\371\316z\023\314\345A\265\024\025j\201\024\210\024"
+	.ascii	"3\241\265h`\254\267\272f/\320\346\201\3468\274\021\013\266\233"
+	.ascii	"\225\324\265\022\f\210\373\224\030\244bW\236\353\271\220c\r\266"
+	.ascii	"\274\f!.]\314vh`\n\n"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.63.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`\006\001\335\013"
+	.string	"VVO> O\225\016\314\210\226e\200'6C\bY\244\361W\250\032\201>\261\226\017\b\237\f0\324\024H#[\003\241\354\377N,t-A5\004\024(\024q\364\007\240DC\343\274)Z#[\312\224\002:"
+	.string	":"
+	.string	"@"
+	.string	"\035l\177b\221\335\342\035j\257\352\240\240\342\330\335\250\032.:\324\024\371\020\213d\343\262\303\fW\nG\202\003v\367 \236\0268-\023b\331]\347\306\225n\353\266\017\330&`\277B\3719\222\366\003P~\273\026X\305\3604\315l%<\204\207\035AB~s\256`x$\315\354.K=\331\207\253&\373i\370\264>\235O\177B)\261\210+v/|2\326\263R\004\252\252\200\204\nRv\330\276~\302\004\324olH\275\252Z\033\023<h\371\331\306\\\265\211\224H\325H}\037B\\\355\314Gl"
+	.string	"\240v\327\200\337]\004\346s\270e\006\035\313\357<n\301\031\233\213Q\306T2\232\013\304\301.M\f-\330`\034Ml\200]\235\210\371\200bE\200=\0162\237\030\362x>q\322\355\341\252\t\001\006o\244\032\324\223/\017;\301W\227"
+	.string	"(\024\222\324\307\361b\224_\356n\246z\202\001\027"
+	.ascii	"3\241a)\260\205\267D\320\222\036j\021\210k\204\344V\023\316a"
+	.ascii	"\335\005\333\315J\352Z\t\006\304}J\fR\261[\236\013\272\220\243"
+	.ascii	"aly\031\002\270\374\300(E\325\330\256R\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.64.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"%\n"
+	.string	"\026\323E9P\255\032\003\204f4\002\332\323\b\031\225\216qof\323\\ f?Q9\325\320\204\330\360\344\333\375\351\235kn\024\250\377gf\236\326\032\275\037\020\020\004)\006v4)\245L)5"
+	.string	"3"
+	.string	"4"
+	.string	"+\220\333\275\327\243\032 H\301W:A_@<\275^*Nk\301x\241\322\211\251j@B[=\3669!\252\346\004\320\334{=C\221\342\266\267\235`\373\300~\rejR\227\2555\212\246\243=\247\253}\fvC\311\224\334\313\312\255\\\232\035\341\260}_v\322t\017\323\214\220\356\3266\331\335\355;\203\366\311\313\327\275\210D\324e\273d\251\364\261\017\314j\030\266\232\211j\342|\322\242\177\224.\367^\004\277\374\f\302\337\270u\004i>\274\365I\226\333JO~v\260`\0262\0225sv\346`:\236\215\b\364\331x\274\321\202\302\007\344\361\032>\033\006\217\023\022y\030\002\177\016\235\2207\372\276\220\327\225\250\360\032\024M\331\326\032\303\0320\355\357a>4\245\247\314\013\227B\003\020"
+	.ascii	"2\003\303\341\306X\240\312\bP\255\370\221\317\341\241\322ck\\"
+	.ascii	"\306\341\250\320A\305v*\362\345^\340\3625\3254\rLA\001"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.part.0.83.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"u\b"
+	.string	"\362\31787P\215\322\001dF1\242p5*rY=:\005\030\352\304\005[\201r\346\307\276\351\353\303[\003-\3225\220\366\0272\315Yl\245\267\027\321\262j\243\254\007\"{\313\235R\326d6\233\366q8m\233\036\206\005\216\263\315\006N\353L\215\367\315\f\201;\207\2157=]\347\315\3146|\\=Y\001\245ER\t\253*\312\366\005\306w0\273{\200/Y@\204\2445\241#\377\037\314\376\036\362\031H\355\356\201\017\362\025\204\317q\351\b\020|\351\322\007a\227\026\017\025W\n\t\276\240\242\254\361q\365dG\fB\306n\305ke5\344H\207}U\310\316\262\313\177\330\016YXd\237|\225\332\263L(X\256\335\235\227\272q\321\025F\221\177\325-%\323\350z1]\034b\036\001\022v\327\001\030\267\274m\003\333\005\266K\002\020"
+	.string	"k\023\030\017\327\270a\030@\036\030\341\212Aa\"\340\214X\3249\235\026\332L\331i"
+	.ascii	"\270\366b\312i9\375\3322\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.90.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`\205\032\345p"
+	.string	"\272\256('N0P\342\031\003K\212-O\244\206+\230\357\356\314\r\227\337\210W4\273\216fU\005O\t}\364VA\301}\004\005\007\021\227\247Y\327\nu\b\363\371\346>^\327\322\016\032\225xh\f\237X\350\320\264\354\232\222\376*\265Zhd\345\226)\245\024i\002/\002g\002t\307$ss\377\265\225\254\246\362\006\264\036Y}]\205\204\246\262"
+	.string	"hVH("
+	.ascii	"\315*\365g\305"
+	.string	"\252\001\324\215\2005+\334N\372\t7\024F6A\301\244\367\230\267z4\023\356&[\255\307z\003\330\330\213\313\332bn\031:\217\031\311&\232\312N3\372L\230\320T^\342\250B\343b\270\345Pp\323u\221\266k\030\032\217\221J\222$\261\323\340\210\344\356Nh\032C\034\034\006\307#F\214p\035_7\243\0216\030\325\004\216]$\202\242\353Np\017\351\027\334\256;A\364E\367\222U0\355\023\340\330E\242\336i\273\310vN\333E!\254\254B\321s\\\374TV\271=\307E\304\244{\307\224@\254q\326\367\245c\352\"7\035\273\210\354b\007af\024Ov\231\2654]\333\333G\304\232E\254\357\373Bu\361\331\276Y\272f$\216y\267\255B\200\250\242\232RJEA=951-)}HB:2\362\320\241\210hH(\b\210\303\206\037\237\036\236\035\235\034\234\033\233\232$\315\fR&\346hl\213\354;"
+	.string	".\267\f\031\263\255\254\035\302\272\305AxX\031\013]\305\032\301\306r\264\337S\013kuX\315\353\267g\026\247r)vq\323)\245\324 \026\217\n\304\342P\203|\376$\370\366\244\342Ny{\325\271nb\032\\\202\302\022)\371=\237D\361\017{\235\304\332P\331((J\034\311x5\243\f\257\217\360\332\210}\222b&\327~\317=\366&JC]\022\367"
+	.string	"Cw\200\001\211\027\305\330\330Ad\274b\017\357\002\343\256CBvB\332\235\032z6Z\3559\367A\203\r\304A.\210o\030\354\037\237i\367\300\351p\236\035\235\270\316\271a\303q\336\236/j\370\215\361\312M\316.\356\252V\206\243mh\264y\r\2154OB\233\206\235\002\263\242\265\337\023\312\316\0346\255\364\3333\206\317\260KU\031\274\264\3373\007\2733\226\303\331x]\364\366Ds\244\017\266\f\rS\244\334\001\201\321\306\224\255\335\265\332\363\2051\306x\245V\306B\037\213\324\312\316\332\350\367<k\303\220dM/\276=\317\300\234e\227\240R\314v\252D\007\221d`\376I\262/\226\350}\337\306k\027#\363r\307i"
+	.ascii	"\214W\357\373rw]\233\003hfV\311\314*0\363L\0030X]\260\237u\013"
+	.ascii	"\031v2^%\026\354f\254\345\330\356\264-;\266\275\317c\004o\220"
+	.ascii	"\30088\1772\263\226\240\0347\230\re\3661w\276Jm\217\367\314"
+	.string	"\021\177\370\nw\352)\304\304\250\262\257\261m\304f\226\355\346jq^\f\331\274\321\244\032\275O\264\336z\212\2269\202\326\244\262\334'Z\251\027\343\243\017\224\032`\030\177\355\253\217\337x-\363\346\035\324\032\377\350a\306\007A\343\314&\216*\327\006\265\354\267`\035\321\025zX|)7b\373\367\020\301*\205\177\202\337O|?\256\354K\331\333\225k\333o\302:,_~\030\304\273\\\271\343\373~\201`\177\235\351\n1\340\200\003\332.\266\017\205\005\310L.\310\277\224\231\271\332\342\373\240}\251\023\374\362C\016\362\266\025h\231\027h\300\333Y\374B7k\365\353\231\334\035\324\376\263\317\336<\343\276\366\241\003\3347\030\002\t$h\273\370?\207\026\b\225;\353j\013\332~\1776L3\317\313\023\271\2530\005\355\305\202\343\373\276 \270\r\273\313\005\33472\360vf\320v\261\277\253\264\003iq\003*7\327\345\211\376R~"
+	.ascii	"\254\332\016\275\360\2571WQM)\245\232HsT\013i\206J:?%\235\235"
+	.ascii	"l\234\233l\234\231j\234\227\222\316JI\347\017I\347\244\2443\222"
+	.ascii	";\037\271\263Q\322\331C\322\271C\322\271(\351L\224t\036rg\241"
+	.ascii	"\244sP\322\031\350\306\231C\215\363\206\037\237\033\347\236\032"
+	.ascii	"g\036\244\363N\322Y'\351\234\323J\232q\220\3167Ig\233\244s\215"
+	.ascii	"\215"
+	.string	"s\322\306\231\246\306y&\351\214\244q\226\231q\216A:\037\221\316F\244s\333G\232\213Hg\026\351\374\356\3542\316M\002S\224\032\350\373\216%\202ye\024\363t\264\222n$\335G\272\211t\013!\314b.\037\260\027\204\306Pm\031rG\304\252$0\227O\313\220\223\336U\375\331OZ\220\271\330\367\f\354\007M0W\323\265\215Y\265\331\305\005\242\340\020\256\274R\200\261I\340\276\350\230z\206\276b\002\207\340C\327V&\323\202J3\017\252\213\0344V\357\262\3419,\277\270\027\227\255\313\206\357\275f\352\342\233\316uyb\322K\331\b\345\350\347_\320\210\251}^\314\251}\276\347\352\360\022\325v 5\265\317\377<\n6\370\302\240=\337{\314\017x\3412LM\340\373\276V\354\\\234p\231\310t\275\274\332.\372\024'!\317\367\364\036\273`\276\305e\313\342Z\334\246\253\302\025s\305\332.\362|Ci\027\262\202"
+	.ascii	"iS\300\243\034\276\300$F\277\3069*\2204\251\035\334\331\311&"
+	.ascii	"\220&\265\250\021\233\352\305\334\217\007\263\360\317\003\r\202"
+	.ascii	"V:\314\210\276h\023.\252\327jQ\240;u\272b\246\007\267\304\257"
+	.ascii	"\201\362\204\020\345M\235\257\033\257'\350\321\307\3640gn~C/"
+	.ascii	"\345\346+\246\207\321\253\241WC\350\217\033\214\037\273\363U"
+	.ascii	"\221\346\326\307\016\306Z\216|\256\363\252@\343Eu\nKa\326\021"
+	.ascii	"W8\224';\217d\222\344:\0274\204\257\332\004bs\342N\217\232 \315"
+	.ascii	"\216\030\335"
+	.string	"\225\255qhZ\013\322\242\223y0\3726\274t\211\033=\312\243aB\344\307\251\315\354\216\325\200\361\t\341\307\267]\026+\270.\256}_\317\244\313\021\330\363C\020\245\336)T\036\027/\256\354\274\224\225$\361b5\214\241R\344\213N\017\334\235\033u\262+\354b5\342N\235\212\320\260\350\002'D]\002\bFF\316KY\347s\250\274\340F\217Ct\036\004\226\234\027\242\376H\022y\341\005\016\316\377\325\313\220\302\277\235=\302\024n\214\201\355F[f\227\005\227s\243qR<\006\341<\255\201\270\323)r\311\025\253\2412\206\233\346\355d j\f\207c\222\305\246o\336}\270r=n\276\200\231\024\177q5\305\267\202\362H\332<\263\333\202\277\271\321\2446\337\241\304IX\363\310\267y\037\3000h\362k\2544\353\2654\237|!\300\260\267\231\247\371n\"vy\242\324s\270l8f\276\235\320`\262\341\342\360v\"\237"
+	.string	"*\013.4\240\320t\273:Z\231o\277$gvy\270>\274\2352\3574F\326\347\365L2#\327\231\227\262\337\024\343KY\327\020\203\265\312\274+[\263C\276\224\273=\f\177s\f3\230"
+	.string	"\221\251\232zf\217R\257|16\366\266\342\214(Q\3665V\355I\032\273\214\207\356\321\301`G\363\027\001\374\001\211\026QB\004\002'L\340\201\b$J \2015\002K\253\206\003\254\020\264D\024E\200`k\201\017F\224 a\002\0058X\034d9\240\2055\002\026\326\0062X%D\224\240`k\013kD\226\326\bXZI\036\361\204\325\201\210-\020H\210\350"
+	.string	"\252\304\007\036\220"
+	.ascii	"\241\003(\021H\210\b\001j\204\326\026\324S\020g\215\200\245\005"
+	.ascii	"U\"+"
+	.ascii	"K\013\n\271\245\257\272\336\313\312\002\217r\262|\202\327\235"
+	.ascii	"\202\023\036}_8H\016\343B\260TS\037\365b\236\242\243\276_\360"
+	.ascii	"\302\264j;\334\002\342\245G\234\200\255\250\3725\306\021\263"
+	.ascii	"kR\247\224\215\330=bmM\252\224;\333\243\032\361\251\021)P\021"
+	.ascii	"\245Ierg3\273D\365.\344\316\306Q\021\327\244\002\3754b\3634\267"
+	.ascii	"4\251;\356|@F\214\247\224\317J\345\263\224\3629J\371\374\244"
+	.ascii	"|f\252z^\252z\026R>\003)\237\177\224\317;\312gVF\371SP7\204\205"
+	.ascii	"C\n\377\\\370\304\304\304/T-\375Q\275\"Fy\036\\o\200|p\206,\334"
+	.ascii	"tP\261\032>=\216\033J\234\204N\257\364Oo\004\f\2036\275\223\353"
+	.ascii	"h\246o\372 \300\260\267\245g\222~\r\227\355i,}Si(}U\223k\237"
+	.ascii	"\327\214N6\341\3227\365\341g\270\321\243\227&=\322\177x\037\300"
+	.ascii	"\250Z\322\267\036\322\177\026\037t\327\252\222-\315\235:AiV\240"
+	.ascii	"Z\031\360O\321\314\313)K.q}\034|D\001\245\216\276\275\360\321"
+	.ascii	"\367U\306\227\215\217\034S\242\214\276\371\214\336\250E\020\301"
+	.ascii	")S\250\227\262\207\357@\345\314\215\036]xx\252\016\017\324\344"
+	.ascii	"\307\323\r\032\324\332\004\017\247\250\231;\035j{\026zF\340\f"
+	.ascii	"\213\236yY\345\311\334\350\320?\333,D?\364E\357SD\0057z\\A\364"
+	.ascii	"M\035\372\020M\\\364=\340\335K\300+K,<f\f\270\3672K\313\274\334"
+	.ascii	"\262\344\242\323\204E\337\027\264M\354x\257U\246\207iJ\373\260"
+	.ascii	"\007\313\002g(\350\366]n\364\2315\206\203\\\267\202P\220\351"
+	.ascii	"\245L3\303\222\320?a\235`\002\316\274\354\262\254\301\333)\364"
+	.ascii	"\005,\331\241\364Rn\201\005-I\337'Zf=(\277*\350\201p\374\\`\026"
+	.ascii	"\376Q\351<^^=\214\033=\202\tz$,\235\007\364\235\327GC\031\334"
+	.ascii	"\256U\257g~\340\360\344\327e\230\202+\250\002\t%\222\302\312"
+	.ascii	"!D#\"2\222$\351\202\n\020\210da\036\307\232\007\022\200$5\212"
+	.ascii	"\224\214)\241\231\024\224\2242\354w2;\255He\247\237\374\263G"
+	.ascii	"=\005\262\237\221nn\330(\372\250 \r\277\377\241\373/\335\314"
+	.ascii	"\273K\n\357/\364\033\225\034\355\256\263o\303VIM\320\220:\343"
+	.ascii	"\324\272t\246\016,\022\t\332XpP\005\213\270 \214\343\036\210"
+	.ascii	"\013\344,\370\365;>\031\251!\030\335\315\245\253\235J\335\203"
+	.ascii	"8,\253Uv\022\331R\357\340\310Iw\020C?\232\f\267\013\301&,\264"
+	.ascii	"'/\243z;\025\235\211\n\212\\\213!X*\261\205\363\276\211\350\020"
+	.ascii	"\273\322pd\266\276\273\261\217\210I\232\b\\o\232*D\013\032\037"
+	.ascii	"K7X\251@7Y\321\024\261\266Z\022TG\017Q\351\204\376\006\277\004"
+	.ascii	"\362\223\236\244\272\310\332\340\314$9'\360}r\231B\312\357\177"
+	.ascii	"@\230\213o\267\273\272\342\255\234\306|\223\322\354\b\244\271"
+	.ascii	"\013\244I\"/\320\340b.<\27626\321f\205\023\033\237\331\033\275"
+	.ascii	"\264/\307d\r\240\006\304\366\273\020N9\243\023\034\256\267\237"
+	.ascii	"4\304 \365\022\330\300\374\366[\354\240\216a7\360\2370\233\333"
+	.ascii	"U\270EF6CC\024c\331\331\207\212L\371\f\214\273x"
+	.string	"\020\220\273]6\310\242\013\333\231\374\336E`\347\205\250\003\372\254\350\370+\301\217dH\354\3229i\2147G\250_4^F\bmW\301p\207\006E\3158J,\017w\275\230\353\024\244\336yz\312m\314\375W\321\237a\237\005_\034aN\030\036\277\325\0227\343pp\214\343\024\357y<)\360\341r\304\230\234\2114R\t\361\224,\263\332\326\326\262\235n\352\314\370\rF\274\214\204Q@'\302\rb\370\344a<\031\205\002Uo\347wGl\262y\232\rG\374\343Lg\377\335\355\277\231\035\224H\001\323\251D\312\216\221;R\002\016\003}\230\254\335\336\366!\035roC(\334b\3360\021\217\202\254\232eOWc\322\275\r\276{@\2529\212]q\f\314\324\311\\\241\377\201\261IW+NN\350J\021\317I[&\230\005\306~\375\177\013FX\335\310\037\031\346\t\2574\242[E}e\231\233\241\372S6\362\330hC"
+	.string	"\"\375\232\304\200\245\003=\033\374\262@d2s\b.\004\242m\203s\r\201\316F&\312CBE\324\b\300\n\026\254\206\310**\342\244\034\370\025\fw$\303\205\315\201l+\020\034.\324\314\251\335D\315\317\232MD\317\360\346\tj>\271r\252\352@\241\253\371M\344\354\2052\214\202\024\253\302^\"=\334\302\364\016\031\334dFyLt\306Go\036\177\203X\226f\215F\301lE4\006\177d\220\377_\030\370D\313\353ao^\f\305\357\007(\237\001\362\365\201\223\261\325\017\333rk\243\274=\025\265nX\335\rZ\273\007\302\033{B\206C\323\002uU\341Q:\036\351m\305\202O\317\307\024\034\306\373\3504\0028\302\313\304\301\375\346 \f=\002\343\304\005\022\215V\216\260Y\356\265sW!XF\241A\327\231\344\343\203cA \264\304\f"
+	.string	"i%4\3163\016\264\240S\004,(dFn\022]\320\255\320^\365\231\022\346U!\020\030\275O\262p~\260\250l\347r'\024\367^\223d\270\321\215\\\235\022R\335\213*\211\037Q!E\351O\276tg\035\362j\024B\352e\360 "
+	.ascii	"\f\002\330Fs\227\233R\025 \371[\024W\200\372GV$\027\267$\315"
+	.ascii	"F\265d\026'\037\023U\3401\031\200\246\334\271\214\3605\240\245"
+	.ascii	"\252\242X\314\263\360\232U5\313\312\366;\221\347\323y\215\034"
+	.ascii	"\027@\240\347p\345\275\256\207\003\323\347\375\374\025\021E\024"
+	.ascii	"u\376Z\023tb!\306S_\350\205O\270h]\024d!&\204\313\362N\037\006"
+	.ascii	"n\210\321\364\203\375\347zh\244\303h\214\335\320\231=\256\337"
+	.ascii	"O\ns\305\276\365n\003>\343\274\007\371^\300(,\357\006;o\227\373"
+	.ascii	"\267\351\254\207\317\213\016\225\255\342\345\251\357U?\324\023"
+	.ascii	"\341\020\213\035\277\375\023M\r\243[~\224m\301\350\007\331E\220"
+	.ascii	"\264\372(+\305\021\t\331\330\023\016"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`X\003u\020"
+	.string	"fZdH\340\262(\035\220\306\210\nM\374I\3608\254\356J{\016\251\005\302*)\025g \237\20386"
+	.string	"~\366\244\256\312\323\177\371\315/\261\001\006E\220\241\030\"\002F\020\344\260\206t\013\201~\373(\372\367dAy\340\261\245$2\005N"
+	.string	"S"
+	.string	"P"
+	.ascii	"\007\332\201\201nP\240\031\234t\f\201\2061\351\227\222vQu\013"
+	.ascii	"\327I\025\251f\341P\227q\372\017$\371\007[\263\333\220\251\017"
+	.ascii	"\244\222]7G\3725\270w(\245\300\375u\312\210\002\377\203\310\256"
+	.ascii	"\2239\177\377?\037\224\245\224\222\3242\334\177\226\020\375\030"
+	.ascii	"\255>\214\230\276\017L\277\305K\277\307\245\317\323\322\337a"
+	.ascii	"\351\273`\365"
+	.string	"i+\375\027*\245\374S?\026\364Y\350J\005\376\032`\262\230\005\227\202\025\374gd34\262\232X\rl\202\013\303\352:=\250\254\300\024\026<\217\021\236\rJ_'AC@\320\017\0026\027\212\3675S\274/O\305\373\372.x\312\222\265\031\221\0276U\205\243\226S\302\013\3734\004\347\246f\342\215M5\341\230\020\032\341\215}\032mvzD\336\f\266\310\273a\352{@x<'^\0166\035\371\334V\230\360F\330\325\031\2774\245\257L\247\240\255\331m\210E\342(5Z\rR\235\335t\320X\001{\022\262\352\361\002 \341\025M\345\035'\200\"\357\210\246\\\n\0339\316+\362\251\350\243\211\210\274\003J(\013\371 q^\322W\342%\3314\352\334\3348\361\242:\024M\003\204@\021t\336\n\0017 \320\002\251\232\n\035\"$\030OR\265\007Agb<c\024mJ\334Z!\324\255\b\013C{C/\031\232"
+	.ascii	"\027\230a\214z\312\2710\b%\207\241&@\002H\202$H\002\t\220\f\022"
+	.ascii	"\200\344\017\272\254K\273(\030\224\341\325\230\245o\254\307\341"
+	.ascii	"\f\315\326g\342\374\306o\364\r\337\370\033\276\341\033|\3437"
+	.ascii	"\376ci\221\247#\21019Rf\251O\200\202\342\316\201\206\223B\262"
+	.ascii	"\242\f"
+	.text
+	.section	.gnu.lto_.refs.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\375\006"
+	.string	"\022O'*pM2\034\037\034\013\251p\257B\247\252\252\252\252\252\f\252*\216X\023\300\337\023\"\210\023c#m\250\021\322\032!\204\354-S\n\016\254`\033\201Rh]g\226\315\252vR\2521s}\231[\244\310\312\224)\360\006\274\231wz1\003\274\226Wz\237\251\363>!IOLJHFDB@><:86^5V30\246^<\253\205\243\024\357\304+1\215x!\336\207\327\341mx\031V\2057\341E\230\036\274\006\323i\215\032}\246\252\321w-\250\275\274\321Zy\233\351\336_G\257\b\034"
+	.string	"f\b\236ZA\300\371\026\323Q5\275#\003\340"
+	.ascii	" \020\034K\2658\330\235\276-8\266\305x\032t`\207b\f*\223\257"
+	.ascii	"\354\2001\236&\300\016\030\003&\300N\2461\024\233[\213E\2645"
+	.ascii	"\237"
+	.text
+	.section	.gnu.lto_.decls.f7330650e49d5bcb,"e",@progbits
+	.string	"(\265/\375`\206/]\312"
+	.string	"\35289EW \212Q:\215\001h\t\270\030/\2765j\bc\324T\314\034ie\244P\f0\364\fRj<]\326\260\250\361}\233H\365\026%[%[\356(Da4K\213\n\321\266-\340o\364\345\200\337\034\316\177\303rY\242U"
+	.string	"\205<\375F\277ww\377\377\030\311FRJ\231\002\264\003A\004x\004n\354\233\273\177\360\336:\336\232P-\356\266qK\006|Y\2713.\362\256\260q@\036\020\206\205\356>\335\031\227\305\335$\256\370\370\300\262\247D\220{\362\021\375\234\245\237Y\350c<}\fF\027E\321#\260\022\r\202\345\200\336\246\353d\237 n\362\016\201\363d\322\245oA\2408/\317\202@\217qh\013\307\306\261O\013l\036F\222\3550\2378I\342\270\271\371X\206\276\265"
+	.ascii	"\265y\326\002\364\327\215~\024\313\241\215\005@N+)\036l\324r"
+	.ascii	"\230`\371j\262xv\372J\2559\026\3666C\363\312\026]\023\013E\315"
+	.ascii	"\213\022\243,\266\355\t\023\"tZ\340\354\030v6{N\262\206\320\355"
+	.ascii	"\355Lc\317X9[\306\322\331:\253\306\232\261k\354\235Ec\311\330"
+	.ascii	"9\373\264v"
+	.string	"\266\206[1v\314\263s\357\244\025\257\260*I\254\235\355b\303\37449\267\262\227\025d\337\226\375\226,\315F\301K\224\032-+\214\316\bK\320Nfi5\247\374\326\215\212m\373I:7U\217\311\227\321\317\201\007\326\316\306\331\261\037\244sO\241YB\254\332\034\001\326\316\262\3316\274D\271\223Y\\B\200\201\243\322\206\267\267S\003\"\rrz\340\255\001\251 _\003,\321\326\213\375b\237\036,\230[.v\313s\232\234\333\271\367\006\262v@\234\250n\376M\242A\260\267\365\200\332\274<\353\001\3755\242\357\375\241\203\230\232\310r@\177\243\364\355\032}\313E\337\246\351[0}{\245o_\350\2408\313\001-\262Rt\222N \2350hr\230\335|\333\244\177\244f\327V0\202d\337|\030\324X\260h>SoPkn>\tm\235\330'\366i\317~\313\304\226=\2231w\331\336N\037\334d\245e\355f\237"
+	.string	"k{\360\r\372\266\b\005\262E\350\265\376`9\240\331\016\241\037\354\222\337\202\3310;\206\241\242\230\333lo\247P\017\214J\226\331\315v\354Z1\353\274\035\263J\316\201\007\357I\356\260\275\235v,\357\335d-\006?\326b\220\3436C\023\0234;-\007T\333\241\004h\340\206\310\200\345\302"
+	.string	"\212\337\376\270\027\260\022\300\1773\260\300\005\025\370\237w\206\350b\360?\355*\340R\340\277/\374\267\205\377z\200\005\303\217K\240@\007\317\217C\300\022\373\316\217K\240\231 \205G\360\343\025\277\235qQ8\320\217\027P\306\366\374\030\t\242\367\343\017\374\271t#\220\300\177%\210\200\3355\361\237\350\026\374\370"
+	.string	"^\034\370o\207D\251K\210\376\030\370_\356\314\365\2175\360\377\316\314\230\377d\376\317\375\247\373\237\346\177\231\377j\256\t\377\321\334\022.\t\227"
+	.ascii	"\377A\374w\341\025\374\330\002\277U\373o\211\377\216\360\337"
+	.ascii	"\006\3747\204\3779?\336\361\333\241\337\n\3756\350\267\021\374"
+	.ascii	"\266\303o%\370-\207\337\022\375v\313\177\235\037/\371o\316\177"
+	.ascii	"u\376\253\377\213\376\367\3767\377\267\367_\036\022\277\235\373"
+	.ascii	"\257\375\357\257\002\376\007\375\331\303\177A\370\257\321\177"
+	.ascii	"E\374w\203\377\026\340\277 \376;\200\377\002\340\277\024\374"
+	.ascii	"\267\303\177\207\376\373\363\337\236\337\306\375v\355\267W\277"
+	.ascii	"%\373m\216\337:\177+\366\333\257\337z\375\026\311o\273~[\344"
+	.ascii	"\267Z\277%\362[!\277\005\362[\036\277\305\372\255\216\337\332"
+	.ascii	"\370\355\362\267V\277\335\377\321\376\257\375\027\373\017\346"
+	.ascii	"\267T\277\235\372\255\324o]\374\226\305o\223\377\245\374\026"
+	.ascii	"\371[\017\374\326\202\337V\360[\n~;\301o="
+	.string	"\374g\363\037\357\377\232\377\316\377$\376\277\375\037\312\313\313\313\373s\336\374;\276\377\003\005\0012|\220H\251\201\005\346\343\366\211}` '0w\225\001\270\250\214L\301\333{\271\301\016\0172O0n\306?\354\021\035Xe7\337\247\251\357\303\344\361\304<\356\266d{j\247\005RN\211\267\267\225\r\200\324 \3111\344\216\211\261\230WW5\274hb.\246\0135q\372=Mp`\0358\260\025\272\267u2\247\2249r`+\215$\322B\265\\\026\241G\252\324X\335\374\236 \372=O6n\237\330\006V\242J\023\242\344\321m\345r\003\235\253%\234\025t\313\333'^\342\252\023\234\033\3713\305&\266\304\333\312\275\301y\272\350\343\030X\306\361\214?\361\fl\245\367\336\023\340\"\266\364\332Ke\021\266\372\231\236]AN\227.\255\263\233\317\303\245\377\337\242\273I\271\367\256\312qn\245S\317m\216\265E\277\217\3056"
+	.string	"\377\363\306\377C(\355\335\244\006\310\235\346Zk\272\361a\377q{'\261\220\017\300\242Jb\321\200*\303\332\310\244\026RH\271\261\220Pe{\013\355d\022I\002s\013A\225m\252\275\242\013\225\335N,\344N2\267\320N\356\246\017PI,*\250\262&*!\2502,\252]\206\265\203v\262I\331\"\271\225B\273\f\253n\2271\251\202\240\312\230TPeXZVH\213/5Ui\200\364\030c\271@%7\f)\034M\312\2408('s\213\331\333\232=me"
+	.ascii	"\366\306\301T\212i\242a\2438\305\301p\202\322\304\264\036\244"
+	.ascii	"\234\262\230;\031\007\325\305\334\273\313)iKu\200t\306\355 6"
+	.ascii	"\016\311\003\307\216z\332{\002\251\275\221v\307\355\275\221{"
+	.ascii	"\357\236\022\207so\033APM)\251\275\227DR\033\007\222\355i\357"
+	.ascii	"k&\027\205\n\252,\213i\304\346\244\254\271Y8\221\266\271\305"
+	.ascii	"`)u\031r\311\216\332{[4\272I\025\303\356fL\265c\304H\222K\034"
+	.ascii	"\215\211x\344\326\244\331ft\024\226\262h\266S\224[T\013\354B"
+	.ascii	"\207i\203ISZ\213'\314B{a\323\343\315\353\t'{\244\256<\001s\363"
+	.ascii	"w|`'\334\204\221\326\311L\002'\316\315\303\333\206\261\314\275"
+	.ascii	"\223v\305\031\25167_\246\345\200f`\207\320\013\307\3507\316\017"
+	.ascii	"U\222&g7\013\275\261V?\2568\267x\231\001\033\323tS\262\305E\021"
+	.ascii	"\274&\331\fo\232\027\252\311\006\253\311\177\347\356\333\245"
+	.ascii	"r\263\\4\027\356\216\271f\356\232[\345\322]5\027\357\332],\327"
+	.ascii	"\315\265r\265\3346\267\314es\267\334\272\033w\317\\/W\356\326"
+	.ascii	"p\323\334/\267\313\345r\305\\2\027\314\275r\303\330\347\275\273"
+	.ascii	"m\277S\256\333\363\365\361\343\356'Y-\312\214\\$^stacwkin\265"
+	.ascii	"\241\273w\227\tc\311\033\235u3\004\216[\230\030(g\0360\271\""
+	.ascii	"\344\35687\310o\204v\317\320\312\2544\357\356\332\225\302c\254"
+	.ascii	"y\211\244=\233N\310|\374FO\322\232f\367\f\n\2243\013\021182 "
+	.ascii	"yn_d\350x\364p\321\274;\256\356\376A\006m'/QM-4\234i\032\251"
+	.ascii	"\231\321\335\335$e\264\3344/\326\335\315\332\310\272\016\212"
+	.ascii	"\02412E\003\2350_\304\200\241\2201\b,\364\257\224\275\201\335"
+	.ascii	"\241\307\225\007\303\356\346\033\305\350\227m\bU.\235\333\354"
+	.ascii	"\20247\266\233{;H}\2359}\035-\372:R\364u\212\334g\266\322\322"
+	.ascii	"C\353\346\353\004\321\327Q\352\3538\372\272\213\276v\323\327"
+	.ascii	"g\372ZL_{\351\353-}\355C_[\351\367\342\350\367\302\350\367\332"
+	.ascii	"\364{_\372=-\375\036\226"
+	.ascii	"~\257J\037}\243/\327\355\262O\242{\244\213\023\f\0347\037M\243"
+	.ascii	"C\260\363,\021zt\214>ZE\037U\242\217\352\320G\237\364s\316\350"
+	.ascii	"\233\261\351\347x\351[\321\241\237\243\324\027\223\263\365\351"
+	.ascii	"\352\364\3612\027\375\354D\217\320\001B'\333\320\302n\2163\034"
+	.ascii	"\036z4\260\355\360q\243\310\207M\030'\257k\343\316@\333\\<\225"
+	.ascii	"\271\371\b\200\001\305\305}\261\326\214R\333\"\225F\267\367\225"
+	.ascii	"q\253.\325\215q\227\227\306\265\2725\354\363\316\270S\277J;\345"
+	.ascii	"7\250\222/O\320\354t\362D\321\361\224\341\004W\345\2654'f7\367"
+	.ascii	"LM\ra\2261Y\241\314\262\342\346g&\177&\263n\320\274\255\273\250"
+	.ascii	"\233w\354\020\232\235F\317K\2222\316\264n\326\311cY\254\006'"
+	.ascii	"Y\2367?\213\375Y\311u\321\243\246\245\211\217\233s\354\020j\231"
+	.ascii	"\030=\207e\036j\246\214\200)\227D9c\362\025\307\243\346E\247"
+	.ascii	"\346f.\256\354\225\244i\354\356\332@\003'\204\206g\257\2358O"
+	.ascii	"uh\031\311\b\271!Z7\347#\227\306\013#Uf\272\206\302\024)\202"
+	.ascii	"\273\336\214 Q\342-\0012\247\2666\303\fy\213\350\003\322\016"
+	.ascii	"\314ni\267\234\355Xj=oa6\345\2300\030\206\224\251\260.#C\206"
+	.ascii	"\024\311AR\305\326\344\346\0171\203\004\301]\034\306\272|\351"
+	.ascii	"\300\343\262\206\254\306\334\217\037\231\006\021\023YW4\306E"
+	.ascii	"N\331[\313\321\224\322ru\225{\0201\221vEoMH\224:T\340\242\202"
+	.ascii	"\364\340\261s\243\t\005\354\346\234\325\223W\203\227\261\255"
+	.ascii	"\214\025\001\215\0349\362\216\rmd[m~\274\370p\361\"\353x\336"
+	.ascii	"\001\344t\204H\332\013\037/3`j\220\251Q#\337 \342Z\222EML\266"
+	.ascii	"\361|\303\346qi\222\005\212\013k\005\232*3fd\032\016`\223Sz\255"
+	.ascii	"\241\"dF\266z\246qW\\!nkqxE\017\031\254\027]\234\350+\2632\307"
+	.ascii	"@\237MC\220\024\345\037m\224\310\345\030\271\212M\r&\234\233"
+	.ascii	"3U\260\307\223)X\372B7\364\237ad\030XI\024\264w\026^\024\215"
+	.ascii	"\267F&\304\242\3131\031\373\304]r\024\206Z\356\030\032\314\325"
+	.ascii	"\331&\224 7\347\027\275\246\032\302\\i\243o\303\316`\2722tud"
+	.ascii	"\350\322\3405H\266\320\331\341\2710\271$f\223\2216n\031\264\223"
+	.ascii	"jx9\211\357\356\376\022\363\224]\344\026\231Ev\312+2\224"
+	.string	"}\346$\306;.\203\315\234\310('1\2321@w`Oh\004\34537S\201\023\324\tbgr\223}f\344\211\234;#q\033\234g\343\226\316]\305\223f\367\003\207\007\r|\354\276\210\271\201\346\305\371\201\342\374\201\346f\f\247\267\244\361\266\002\213\033\373\304ot\032/677\303SEHV\025\375 6\375\2402\215\325h0t9\340\304\364\203\276\364\203\270\364\203\264\364\203|\350\007]\321\341\2712,wps\327\213\226(\247\233\037\224C\337\"1X\016\350+\212\017\2641*\b\331\202vs\256\341\276m5\245\302\374\210\321z.\001\223\203\226wW\343f\374E?\005M\201\330\311\241\266\343\306\315\307_~,\345\372\350@\036\23457_\245\321\261\027\0368*tck\330\216\267\260\341\270\242\345\216\361\241\b\225\027(,\313\233\261So\325\301X\336\214\337\260\026\f\367\353\350\264Ey\3011\247\217\263\354"
+	.ascii	"\3512\303\221\233\257\275\033\212\257\034c\371uza\312\344SN\037"
+	.ascii	"W\301V~\035\f'K[\213\233\017D%\004d\256\222\334\214\335\364\023"
+	.ascii	"P\033\b\035923Cn>v\373\361\224\313\003\237m`\357\344\215\272"
+	.ascii	"\261\234\273\371\307\016\241X\212"
+	.string	"\321q\333\3352{{\273\331\007(\211\305e\366\211\313\360Z\016\324n22\202k\211\022\307\0069\311\205v\247\206\236\231\261p\342\344YB\245\211\335|\234\366[7\334\004C\351a\356\r%3\2372\340@A\003\223\341\203\2103L\207\315\315\221\0317c3\374<>\303O\360Y\007\314\275\233\360\031\320\233\275\233\200\254\305\300Z\f\362W\326\326\031\232\017\264\24590:v\202zM\271bs\263\335@K2\2626M,[a\3428\235`\336\232=\260.`B\310\204\205a\261&jt\313 ;\320(9\026\313^\306\302\210\271\371il\033\n7\365\246M\225\257\257+TbK\274\035\264\252\346\030%^^\330\312\206\300\344\r\035\332\244b&\331\003\t\022\334u\302\016\241Nl\351\325c\203R\346\315\315\377\221\301\305\205\273N@\356\251\rJ\256\320)xwy]c:E\270\262\242\362\232o\342\":\313\215\264\313"
+	.ascii	",\347*\007s\353\346\"6\212\316\002\227\005\256NK+\255\311S\243"
+	.ascii	"\213\330\225/D\210\\\300Elie\006\031.\322\250\byb!\030Y\304\334"
+	.ascii	"U\037\216\324\235\t\307%#\321D\t\025C\243Q\004\031\212*\250\030"
+	.ascii	"\001\205_\2114\305\357\204\f~\236\024BDQ\330!\365\365\250\251"
+	.ascii	"1MQ\240j\321\204u}a\025"
+	.string	"J\240\026\201\"\200\034\224T4(4\212 J\223\326\237\n\354\020\024\032\026\325#\261\b\364\005\255K.,\001\207?`\207'\205X\201\036J\200\301\204\013%D\360\225@\302\n)\370J\234\360\265`B((\3021]\211KC\3044\350I!D\254j\232B\250\006'8\372\326\024\364*\034\016\205J\250\nc\261\304\321(\002\311\b$.\231pLW\036\342\321\315Y}=G\037\021\311\230CD2\342\244#\0221\035\242i\007\204k^\327T\r\006\177=\025\306\"0\253G#\276\217\n\365\270\n\221\322\023\276`JD\022\016\177\275`\272.e`\272\366\376;\376\202>$c\210\237\241Q)u\001\311x\201\372K\002\3465U\372\251\300\202\004\251\322\322\232\236\b\022S\343\272\324\002\323\t\342\n'<\034\325\337\261\205t5\221\302j\342($\232\3509\301\244\002U\364\b\364\244\020@_\252$<\022\227T\021@"
+	.string	"\360\f\035\177A\343\013\023\214\bqT\177\306\0200\020W\b\200Rz\\U\264\340s\340\201B5%\246H\372\035|p\200\017@`\352\035\004\022#H\214@\017\002\t##\022\037\030\351\177`\204\217>bq\375\245'\224\324\"\n\035R_\320\004S\021Eo\210\342\267\nI@\"\n\225\324\337\206\324\267\"\375\206&\b=)\004\223*\002\3118\304\244\356\030\177J@5GM\203\302\024E\325\030L\231\324\341O\250\246\253\020S:4.\221p4\374%\355\020\205\037\216\276\036\322\317\205\242\320\207\26444\022\t\005\211B\024\276\343o\365)-\251\307\030R\343JAO:\374\001w\216j\232\202(\004\252A\241R\016Q\250\244c"
+	.ascii	"\246I@\246\237\222\006ZK\f\177)\210E\341\3617,\032\325\364H4"
+	.ascii	"\001T;\254i\252\"\245$\244C$\242\bJ\277\022)\214G\021\270\220"
+	.ascii	"\036\177\"\244\301b\n\252\360GD\024\002\323u\311\307\244\362"
+	.ascii	"0-\375|L?%\240U-\252j\312\001=\246\353\321Q\221G\310\303\321"
+	.ascii	"Q\361\270\004\274`\0252\375|HK(\322\340q\311H\024vH\215*\216"
+	.ascii	"\276_\n\241\232\006+P\213G\340\357\310W<.\375|HDa\322\261XTZ"
+	.ascii	"}@\225\310\350;2\016}\251\322O=\362\001\325\325'\\W\325CP\350"
+	.ascii	";\n\211K>\034\f\231\324\025\350\270\376\216|\301\245\037\n\337"
+	.ascii	"\272\204b\375Q\211\253\217I\365\245\353\222\357hU\201@1\254?"
+	.ascii	"%\337:"
+	.string	"L\211\304_\022\320\227\006\205\252\317\270*M\260\372\220\204G\304b\211 !\031\212C\037\005?GG\3054XT\362%\001\217B\031\326\r\251\272\024L\201E\325\350\213@\253\370\r\323\240O\355p\364\201\320\013\016\213Ik\252&\035}1"
+	.string	"\205\307\325G\364$\013^4\246\252\210c\261\250\212\340Y}G\337\007FG\242\260\267\036\211i\212\024E\"\n\325\342QH,*\355\244)\204G\340\017M\325%U\205\232\246(\002\323\023\352\206\023\034\206\302\237\tA\341\360\227bH\206\"\n\351\360x,\252IG\241\243\b\3014i\025\022\205&\244#\004\207K\305\244\026\220\210\302 \3617\364\300\341\350\343"
+	.ascii	"\001G\242pI\037\3235UY\b\026\205j\312\302\357\370#\201\351\004"
+	.ascii	"\022Q\230B\230\002S\225\202\324\307\002P\272\376\222\2149\251"
+	.ascii	"\357\004\207\033\031\225\370\360\202\n\020\320\300\020\351\321"
+	.ascii	"o\035\n\177G\"\216IH\302\341\221\b\242\360\247$\002\250\256\""
+	.ascii	"BT\220\036\177\307\026b \nQ`Ry\206\305\342\b\276\034\270\354"
+	.ascii	"\265\343\204\0062fZ\266n\03444_\262\340\256\021\354\242z\274"
+	.ascii	"\001A\245\324\250\261\002K\217\236='VueG\335\227\032\"7W\251"
+	.ascii	"\202\255:p\273r\342\346\206\273\354V\356=\202\215Jl\211\267\341"
+	.ascii	"*\257\345"
+	.string	"\265\334\246\203\334\261\202[\312(j\313R\352v\310H#\205mE\214\032\206`gN\214%Wr7G\271S@;\330\224\001\273\371\033\252\324\362\215\037\264\247\263\2734l\225\2375\200dA\211\201\337\326\216\320\200\226iX\345\210\233qs6\313\317\347\263\347\263\233\317p^^\204\005\2503\263\264\211\234,9\246\0202CB2\232&\215\001\343\024@@hd.\227-\323\334\003\023\300\222\310c\262\036\206\312\320\315HAAJR\250\f{\006\005\327-{\265\031\3009\201E\030\221\345cp\344\211\347\017BD\247\207\250\270\006+U\370)&l\031j\370\032`\020\230\222H\037xb\276U\300\n\327\261\351\201x\363\263\"H\2354oH\362%\031\227\017\212\254\016\252\023\032\270\003\253\213\271\035\320!IE\367\177\372_j\376Q\254\331?r\310\354P\2700\2415\323t\231\371\356\007\355\264\341\231y\257\320\222\272LF"
+	.string	"\021\365_X\323{\265\207\367o 6\240\305\362\321\204'\005\334\206\327\335\276\036\305+k\260L\215\240\361lpb\247\352\213\375+^\302\260\031\030cb\346+Y\276\224GW\2464O}\240\356\032\373e\326v\257S\307\354\352\253\216\260\266h\365\220\263Vr\201\323_\237&\346\237@\353r\017\r\201\245\376\033\310f\004\224@\002\246H\205\3740*eRx\371\266\334\320\222r`\177Vc\241\376\352\230\023y\004\002\347\367\316P\343\206\345F\020\364\313\215f\205Z\215\373[>cyet\231\3167\267\361q'\210BA\3645"
+	.string	"kb=\230\377\267\f\331D\024\250\207\365F\224\021X\244\202l\033\273a\253\261\226\0169@E!\177\222\202s\b\337`\333\362\225~\f+o<\234S\201\277~\027\375\221,\241"
+	.string	"%\331\227\250kQ\001\366\024c\332Av\321\371!\026y\272I/%^\221S\306\372x\260\374\026B\254\3616\206c\016\271,\325\335\f\370\247\031>W\236%\246Z1\r=(\311Lu>\371\367\270'~r\373-\013\265,\206\246\344\304"
+	.ascii	"'\212\364\036\263\2422\025)\027 \022a\310\237\350]\265\220"
+	.string	"\327\206:\024NaC\025[<n2\263\257VS\017\221M\266k061\317(\342\235\232\324\317\263\354\225\275\206!<\364KVL\222\333\215J\n\315c\266\371\033X\333\216\2314\020\030\f\2447\341A\227\233@\025\326\233\261\225\357I3Pa\263H(\230\211\372t6\256+\2150\332\370tD\204b\256\311\033l\200\324]e\243\351w\315\f\245a\025\3243\021\371\2203\264&\343<\353.\317\323\034\026\354\002\263p\310\250\031\0231\212\213.\006\004\370\001\250\205\265\326\313\221\225\241C,\371@\240F\372\263\373\216i\006\242\227\007r\200KLR\212\304,\2533\376\264\326\n\007\205V4\346}*\320\032#\025\267^{\341N\tY\372\"\236\321\036Q\257\213\345\262\344\2470D\363).b\226\252\304u\374x\271#\340\017!^\002c\nu\325\357\250\022\327\274\213&\326\342\273\002\301\177\305}\016\335\232\377\362\006\370\262"
+	.string	"R\366\312`S\200,?\276\262B\203\374<P\002\270\276\312\252u\233\b\264m+\231g\362-\231\020\277\255\275\241\001\322\005\225\204\222C\317\035_\224\355L\303\237Ukn\036\362A\256\304^_\245\004U\023s\337\365r\3332pV?h*\365c\320d\024\367|\226P\b\243\tRX-\214\256"
+	.string	"\027\325]]\301\213V[\205\226\022\204\300z\036\327]\354\357\274\002Eo\025\255\361\322*\346\331\356\347;[\235\025\213\254\022\210\"X\246*\331\307b\300\267pEANej\264)\r\273\252\240\324\244g%\027\363DDEw\257J\201\241\370\331?\214\365.\267s\270\230\336]\212\373\233\362\207%\223\fE\021X\005\324\271\016\224\024\301\024\262x\345\030LA\024\037\252\bE0\365\366\b\033\237\212\232\t\256k?C\344N9\207\305Z\334\322h\250'\324J\246\023\313c\262\374\200\337S n;\nIZ\020\374h\310\257vm\201)\240\266\222}\272*\335y\353\nfwwif\025\341\215\323\201q\310\244\375\260\331\223.\374K\001\354\020\335\355\234\036m\217f\300u\331-\354\241^"
+	.string	"\355\027\374\006\307\333\241\226'\320A\206\211\0261\312\342\375\032\3275\324\316\236\377\235=w\351\273\271\243R\313\004\264\013@N\222\315\034|\370{\240D&G\026\206\2355E\367\277N\003\364\230\201.\305\034\273\256\024d\204\352m8\365+:\324\002\262\265\313\326\223\330\2529\316g\031\324\237Ih=\001\232\251b\026G.\330\320@`\020\301=6Xm#\3674\277nPT\236\262T'D\354\312\222\037&\226\241U\021JR\031\344\334z"
+	.string	"4\221C\304n\223\215\f\276AN\253k\364\177h9\227:5d\2114\213\005\016\372s$\335R\232\023\023\254\rI\334\255b\221\224D\\\324,\032B\323\255 t-3\021\215\206 \004\03754\020L[R\237\207\200\n\365\303"
+	.string	"\240\fG\036t\364\301y\332&\3063\005\222\207\246f\005kkR\201\036\257\213\353\220\237\227\337\247woM\360\276\267t_^\214A\001\347\257\222W\200\311\356W\027!\r[x\355n\251i\276|n\n\023\366e\321\245\332\234\315\346\227\234\364\202\370A\266~\263\210e\343\307\\\306\361\224\313\301e\254^\340\220\211\030\177R\330\264r\244F-/\325\336\316F\341\222\270\355\236\276\243\310\002\232\215\214\003\374R\005K\313\006\200\257wk\340"
+	.string	"+\376{\366\353\022t\256\021[\247\242\303\224\232\027\2220\230\321\016\036S}\251\201\241`\316P\3555t\271\366+\264j\005\272\262\030\244Q*J\210\205\361b\300\032|\021\323Du=\270\364<')e\260p!T\301\371F[MR\037{I\021\255\334F(\232\363\317e;h\305\024D\223\2467\330p\240D\220],\356\263\356\347 \032\324\303\322\326\331\032\322s\247d\301\312r"
+	.ascii	"\224\312i\340\314E\324\247\212)guK\270\345\277@\274\346\t\022"
+	.ascii	"\320\366\377\341\320\300\341w\302HP4"
+	.ascii	">\375~A\330\263qu\233\314\331Ei\256M\035\347\006\266'\255\210"
+	.ascii	"8t=\311q\224\237Hy\372\214\213\362\030lFA\214\213\312\320EB\317"
+	.ascii	"\027\264V\020\260\272\233|\222?\355\356\225Q\023Y\211\223;F\007"
+	.ascii	"W\\+\373M\376O\003\327c\003\350\212\367V\025u\254\221\362O \274"
+	.ascii	"\346R\245\231G\006eB/\315\0324\367<\345\235\316\226>\225;a+j"
+	.ascii	"\215\212p\f,^v\235\340c\301\251\004\316\321\230!>\217\262\004"
+	.ascii	".B\n\352\210\211B0\025<o[\037\313\207\224_\004j\027l1\374\357"
+	.ascii	"o\301\374\274\371\334\272\301N~\r[^!\324\345\203\007\221\200"
+	.ascii	"@|c\300H_\030\277*\333+\016\025\337<M\251\305\270J\035\233\344"
+	.ascii	"4\356\20387\366\266\322\367\t\366\177\327d\244w\202\334ey\333"
+	.ascii	"L?\225\234\261:\2517\024\341\243\244\326\262a\242\205\027\302"
+	.ascii	"V\251\300K\200\305\336\364\205\317\341\377r\336\003\234\307\305"
+	.ascii	"\037\312{F\366\275\236k\270\327;\200\021\262i\222\372\301\310"
+	.ascii	"\"{ww\217\030S9\300Q\301\207j>\023\006S}Y>\361\204\303\272\324"
+	.ascii	">bc=\236\243\303g \331M\341|r\237\002\217\205\270\004LZ\223\301"
+	.ascii	"\372\230m\203}\270\364F\310A\007\207~\366\226\270 \365_\245\275"
+	.ascii	"\2438\360\263\253\251\303\254/2\361\230\031\317\277Vti\355\342"
+	.ascii	"\367\021\367M\357)v\\\202\231\033\036\201\036\357O\316\016jo"
+	.ascii	"\022\246\374\273\315\330\257|_\310_\265\335 \357;\265\342\325"
+	.ascii	"w\322\336\340\264#\202\303\311\224\340\253\255\303:\225\241\370"
+	.ascii	"qq?:r\023\270\277\370hG\r\304\216\235\207\251\370\022\215\275"
+	.ascii	"\302\313\024\325\244\021\275\216\213\227\267\032O|\037\007_M"
+	.ascii	"7I\276i\376\324\217\356\301\327J\202\231\344P\207C\304\265+"
+	.text
+	.section	.gnu.lto_.symtab.f7330650e49d5bcb,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"failsafeProcedureNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f7330650e49d5bcb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
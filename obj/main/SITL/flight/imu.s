@@ -0,0 +1,1708 @@
+	.file	"imu.c"
+	.section	.gnu.lto_.profile.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\032\002\215\r"
+	.string	"\304\021\016\003"
+	.string	","
+	.string	"\227\264\324\374\016\f\002"
+	.string	"\002\001\002\001\335\276\216\252\016\002\343\267\245\270\f\003\240\342\234\212\n\004\335\264\214\277\017\024\002"
+	.string	"\002\003\004\002\004\005\352\263\360\321\b\006\331\265\256\232\002\022\002\005\002\005\002\006\007\002\b\002\007\t\007\n\013\247\320\217\212\001\f\357\322\207\337\001\006"
+	.string	"\002\n\002\n\r\016\017\301\251\326\212\0062\002\b\002\b\002\001\002\001\021\022\233\326\340\375\t"
+	.string	"\023\261\317\360\375\017\006\006\002\006\024\026\302\260\206\302\t\020"
+	.string	"\002\013\027\030\362\330\255\243\r\022\002\b\002\r\006\n\002\n\031\032\033\034\035\311\313\233\264\003\002\036\242\302\263\302\013\037\203\366\244\240\016\n\002\n\002\016\n !\"#\373\250\230\262\b\b\002\004\002\017\002"
+	.string	"%\327\235\250\225\n\004&\313\304\355\226\017'\311\204\277\354\005\020(\221\326\260\227\004\006\t\002\t)\301\246\230\212\004\n\004\002\004*\231\324\344\225\004\004+\323\357\225\353\017\"\021\021\021,\343\232\341\250\006\006-\323\361\227\336\b.\233\307\233\231\t/0\240\342\234\212\n"
+	.ascii	"C\250AQ\301\220\320%\222\246\260\214\001P\202rf\250n\021\340"
+	.ascii	"P\303\034\"\252\240\240\205\3753\024\244\025\311F\335o\233\306"
+	.ascii	"\341O\317\307g_\"3j\215w\235\265\bH\013Y7\177\250tE\361\224E"
+	.ascii	"\020\243t}\232-\354\035\300\201\217\373\374\231j\005\315\001"
+	.ascii	"\241\335\270\277S\177h\202\030qu\201`\240`~\243I\004E\224dz\370"
+	.ascii	"\255\361\236\365i\235\336\337WW/\321\354\325\313\304lth\317\254"
+	.ascii	"\276\245M\267\337\002c\344rEV\273\352\237d\361,K\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\245\003"
+	.string	"\262\304\013\016"
+	.ascii	"\333\302\001\327\211D\220-\240\027\275$S\352\214\206\236\225"
+	.ascii	"\263\346\231\271L\305\223E\216\323R5\326\211a\301\344\f\0268"
+	.ascii	"\251\373]\251\265\360\025  \340\002\032\262\016E\300\005\316"
+	.ascii	"\004\326\204\204\201Z\364,!\215\206\323A\267\030\210\244S`z\364"
+	.ascii	"h\206O\230\346\322\f\177\205\215\025S\n\027aW{\260\240\b\017"
+	.ascii	"\26704\"\3101\001E\302\025H\021\206"
+	.text
+	.section	.gnu.lto_.inline.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\233\004\305\022"
+	.string	"vWRA"
+	.string	"\221\250\320\001K\242\r\3651M\315\305\307\312\361\305\036\237\3002P\257\203x\244\021\023\317yM<\005\376\347\023\376\326~\245"
+	.string	"\030\005\025-PIa\251\037J\230\360\353?\202\254i}\t\220F\366\336)6"
+	.string	"G"
+	.string	"A"
+	.string	"_\245\354<\n9\264}\220\345\206w\371\227r\033\212\340sF\016\002\266\241\310ag\b\222\264\275\304\327o\022G\022\266-\366&Ti\373\301O\024jh\353\371\317\031U\327)YT'\027B($\b\326\213\210Y\210:)%1$@\026h\2540\321\361f\003\177\264\372\353\347dR\330\227\262\306J\214\213\006\370\207B\223\017*P>\306F\253\323\234v]\273f g \227\307\227\204\024\356\021\007\276\005\023CC\026\325\t\211\266\001\324\2242\273"
+	.string	")O)\243E\207\f\233\007\230\260\245#\377\017\236\007o\\\265\r\035\312\226\266\004\022\245\255\200A\243UAiR\302z\t\355\371\253\360\246\314\333q\004\377\245\266\023\266\332Tg\006\237\2472\243m\004\364\320\326\201h\301-\030\030+\032\272`8\241\302\261\002\316\037\177\031\f\200w\216\264\325\026\2254\033\323\306\t& \222\262\b6\204\030\221\"C\024.\254\027"
+	.ascii	"\016x\250\261-Cd2\323\326g\fP\0021\206\312\314\003\022\200U9"
+	.ascii	"#%\0220e\0022\nZd\230v\003\335\002\350\267\362=\335\367\207\353"
+	.ascii	"\021U\312\001\177\001?\374%\202\002\363\357\261\370\350N7\306"
+	.ascii	"\022\341\3602\t\303\273U~\t\267\330P\347\001\300\273\217\263"
+	.ascii	"^\340\375\352\327\201s\361\346R\033\305\f\346\343,0\244\253>"
+	.ascii	"9v3\376\346\330Y-\032\354\326\335,x\341\330^\350\252g!\241\266"
+	.ascii	"4,<\255;N<S\"\t\276\f\346\252\"\017{]\206\205\224\021\023<\270"
+	.ascii	"\005`\320\214)jV\3243\225\202\257\035\360\265\017\201qe&RlJ\350"
+	.ascii	"o\352\363\017BW\250\360\226M\002\233\374i\347\305\020\3574\342"
+	.ascii	"\202\255\272\rY.f\247\276{\340#\265\353\360\337:\214SK\325\032"
+	.ascii	"P\333=6s\"3-\f-o\212D\030\315\025\202\304qMQ\376\013m\0028\274"
+	.ascii	"ek\320$gq\t\026p\257\221\200\303\312#j\257\212\036\326/\361\315"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\350\002=\013"
+	.string	"R\21710pk\322\001\374\377\377\237\221\323\006TU\325\317ol\021\250hVB\2353M\217\307Bx\364y\271<0S\244\272\251\255\231:\262\244v\2232\245\024\265`\035\f\263*\212\210\316\203\345\341H\\\020\026\025\023\225\345\341XX\206\2527\214\271(\313\261\t(\264Mh\004!r\307`\033\017\002.\255A[\360\023\264\225\266\327\355\262\366\364\363\324\352\251\335~\206\334=\356\"\373\023I\243\367\336\313o*\307S\356\333\017\207q\226\351B\003\204\341\213\035\370V\2728u\314gf\004"
+	.ascii	"AUe\207\366\327\271\020\345\016\355\366Jwx\347g\333yM\307\264"
+	.ascii	"\206\235\341\311\321Y\323lM\273\273y~\352\374\270\222c\266\205"
+	.ascii	"t\240\305,D\250Q]$3$i\013Y6\003\240\002\221\"\262\016\022\300"
+	.ascii	"\342\034\212\302\2152\306\b\214\320\030s\260\332?\003\035\304"
+	.ascii	"d\315\203\226S\225\262\026\366\300H\204\273\352\201G\247\222"
+	.ascii	"\313\306w\244\244\272\347;\230\371\202j\250\037@\327\245\313"
+	.ascii	"\"A\022t\235\262\312\356\244dw:,\241h\360C~\027\314\\z\2561\306"
+	.ascii	"4A\313.\300\200#\352\026\336@/\324E\2156\235be\255\261\253\024"
+	.ascii	"\t\322\371\302\f<]\204\370\016\r\266\350~\277\006M\261%<\370"
+	.ascii	"\225\221\336\300\214#\354zT\371\204u\225\345|"
+	.text
+	.section	.gnu.lto_.pureconst.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375 A\265\001"
+	.string	"\022\204\f\024\240\2531\276\256\252\252"
+	.string	"\350\377\377\377h\377?\303:;}2\036y\220?\356x\3431N\213+\2368\342\207\033^\370\240\026<p\300\227\247\033afR"
+	.text
+	.section	.gnu.lto_.ipa_modref.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`?\001\245\007"
+	.string	"\262\211\033!\2407\303\001\377\017\365^\325\257\252\252Bv\214\232\210\220\335\266\371\377\251\315\223\377\325\271\266\332\2262\005\377\222\276\272\252\332\213\001\243\207\372\343\314\211\323\234\332\024\233\177n\251\\\224r\245Q9\224@<t\016\215\201M\370W\376&+g]\202w\345\016\351\372\017\314\244<i\237?\231r\246m\2646\347\005P\307\361R>\221rEy\3412\002: P\2422\310\356i\006>\002\334@\300\032]\242\344\272"
+	.ascii	"\301O\360\3265\\m*\3018\266;\200\323\305\305\007J@\231\314\232"
+	.ascii	"\202\306t\241\313PC\201\235\\\345\212E\3412\033\341\241 OXT\f"
+	.ascii	"\320\312!\332\315k\013\214\325\013\013\355\331^\261\fH\006G0"
+	.ascii	"0\361V\353c\2118\237\221\277\2633,n\210LI\340\321\325\215up\214"
+	.ascii	"\236\240\307\214'&\245\337\324`\003\351\020JDk\362\303\342\002"
+	.ascii	"\f\001"
+	.text
+	.section	.gnu.lto_.lto.48d0867c8050f5d8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_q.68.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_qP.69.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375 \231]\002"
+	.string	"\364\003\214"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200\320\001\177}\304\001{\303\001y\302\001w\301\001u\300\001s\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003"
+	.ascii	"8\202'\013\342\030(\002"
+	.text
+	.section	.gnu.lto_headfree.70.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_offset.71.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_attitude.72.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.76.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375 \234\235\004"
+	.string	"T\bj"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\366\201\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\006us\250\364\005uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\226 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.78.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\031\005\001\006'\001"
+	.string	"\005\001\006'\001\304\023?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.79.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\f\002\315\016"
+	.string	"\246\231[C\020s\223\016k\217\245"
+	.string	"\334w\f\375\361\276\003\366\3210\262\326\2570\013\032\034\276\"\340\0014\005a\214\030\337j\363\377\332\250\027\024J\032\332\266\"\b@\200\004@\330\013\340\250\220\200\033\314C\262\311&R\246\024B"
+	.string	"D"
+	.string	"N"
+	.string	"i\370\264\365\264>\235O_\304\300\206\367\210\331\345\260\022\262*\230\"a\373\032\207l\037?\2256\202\230\321\360\001\331\335LE<\364\f\371Oq"
+	.string	"\036\213\350\031\027\354\256\323c\351p\353m\217\330>`\347\211'[\034\022 \357\362\026\236\\q\026\035\316\343\271\016\357\362\023\250\200\314nw\3177]\005\212?\342\320*\240\274w\350\203\256C\373\002\206\274\347|\231QeP\221}\022\245\206\260o\255\222\354\247\261\247\343\323\327\003(\221\222m\004\257\361@\200\314\356*8\204\371\274\037\035\352\266H\273\335\210\252\245\372\255\230\030\345\312\251WUK\306\312\207\021\204\247h\244\222\264\330\021\2162\n\333\335\0043\2561\365\2410u\271\362\200\030\332\346\305a\230p4\315\205\247\244\364\022\346lT:[\2262\341d\243 !\253\260\231t2\316\007%\333\0200gA\373d)\034\367\3114\247\275\265Jb\340A\325\351\310\030\217\253\276C\307\rsE\305.\205\032K\214\032<&\307\245$-\246\316\301q\334\200\032S_\020Km\227\334\206\0030 "
+	.ascii	"\003\021\251\252\003sB\357J\201!\275\254\301\212\215\364\301"
+	.ascii	"\210\273L\214\253\3565\254\315\343\273\310B\314\215[\251,\223"
+	.ascii	"&\t\214\352 ,\026\200aHd\201\344\013\362h\216\230\033wU\222V"
+	.ascii	"\362\301\245H\212\r\217\304\230\3140#U\360\304\326\206\275\030"
+	.ascii	"\3764\336#\300\230\321\310\320\030\216\271\016p8\030\344\314"
+	.ascii	"\213\366\220\001"
+	.text
+	.section	.gnu.lto_imuConfigure.82.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\002\003-\025"
+	.string	"\306\347\210H\260\226Q:\225C\177\354y\341\354\302\244\314\222t;\304\031I=\254\225>\214\355\257\227\375\007\020\370s/\376\343\224\363]\317\t\034\336\313\354O\b\207ue\024\274R\377\346B\271v\234\261{]xT\221|k\215\333J\231Rl"
+	.string	"h"
+	.string	"y"
+	.string	"N\022\351\205\355\3736>t\363\032^\3654\311\230s\212\227\366\215-^^\264\0338\300\335\207\343\2353EP\002\353\322\252\366\203N\003\367\236\t\3139U\004\035\315\351c\340\004\254\313"
+	.string	"\027\020^\352_\341\245q6\222\373Z\314\023\001\355\210\230\3149a\313\342\270+\316\277\320[<\236\234\353*\302\234\323\312\343Aq\357m\273\330\366`/N\033\006\321\001\277\272\337MY\3469h\2549w`\374\033\307!\302\007\2724\315\250\347]\372cx\371\025{\224f\364r\032\264}:\272+\354\253\346\372\330\367\375-\357\375,\241\372\025\252WT\255\242\352\224P\215\022\252EU\273V\352V\250f\205\352\225\252C\251\226\241Z\025\252W\325*\3257\340\232\032\242 \311\234'\202Of\025l\364\340G\b\312\372Kg\362\317\007\262\005\033\331\b\212'\325\242\342\332\0302\350y(\004\324\265\266\206\rz\236\270\007v6\307\255u\255.\341p\245\016?Z\013"
+	.ascii	"\211\211\265\366\207'\365X-+\334\225\334\020\304\217~\262IO\265"
+	.ascii	"v\314\213\374\033`d\316\t\343\353\370\216\230l6\013/\367\bO\352"
+	.ascii	"w\036KDN\323\020\202\301\";s\346\\vU{]\f\035\rZw\0033\233Z\254"
+	.ascii	"\304\254&S\023\213\251\031i7\331\314f\033e1\263\332\3556\332"
+	.ascii	"fn\005,{\261\241\241\301n32\264Z\bX\r-F\003\223\331H\300^X<\216"
+	.ascii	"\230\331`\267q\264\301D_\356\252\271>\276\020t\312\255\216U\326"
+	.ascii	"\177:\224}LpR\322\252\354\002%\273\251\225%B\341BW\001\177\242"
+	.ascii	"xR\257\365\357N\236\200\023\301\312^\007$e_\373\241\313#\027"
+	.ascii	"?\035\220eS\366\366\023\265\233\312\301(\3621i\n8 \300\002\221"
+	.ascii	"\261b\007\337\362P\304t\337d8\331\222\035\342\323\371\220\020"
+	.ascii	"\212HS\032nY\207\270\3173\323\236*\363\006k\355\265\373\007\326"
+	.ascii	"\341\310\360\336\2260\334\3403\024\270\303\361\261\374(q\231"
+	.ascii	"\330@\277M\3241 \251`\310\007[\346\370\201\263\214\341\215\365"
+	.ascii	"\270g\266\253@\330\346\334\206\256k\334\3203\362\264\335,q\275"
+	.ascii	"aB\302\013M\303\247\001q\006\207\230\364\234\257\321\202\203"
+	.ascii	"\032\272\345\205\260\310"
+	.text
+	.section	.gnu.lto_imuInit.83.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\235\n"
+	.string	"\206\023I@ \307*\035pb?A\240\211\004rG\262\321\031)\020J\235|Cy\350\254\334`^C\026\347\354\216>\3310@\261j\026\2328\026\225\004\300@a"
+	.string	"\340\300q\030\"8\204\201\r\242F\310\336;\2455"
+	.string	"6"
+	.string	"5"
+	.string	"4\333\356~T\344\247W:O\376a7\030I\361\365\362qZ\033\312"
+	.string	"\n2\244\252&\254F\306\303>9\310\324\234\026\210\335\365\034I\217\273\273\355\b\333\f\366\027\002\3160\315\217\357|\223\367N\003R\022\022K\200\2329[&N\332\262_\227\262\354O\377\"\2616\004\017\003vW\271\005[\353\004\220\330>\306'\373\300e\256=Me#~\307{\354\264\317e\027\365\321\237=\305\343\277\336\031\374|\274w6(\244\007+&5\r*\3322m\021i~4\002\201\216[\231\242\242\377\222\347\237\034\245\344\277\002\346hH \360\033Ux@\013\212\357\002\334\200>NH\364i\024\034btB\337(\fC\037F\266\257KY\265\300\336J\024M\325\r\245\342]\270\022"
+	.string	"\245-\207\237N\314\f\250&\316\231\031\021"
+	.ascii	"3\241Gh`\255.\303\362\313\230Ach\210\223\330E\375\254i!x$\246"
+	.ascii	"Z\321\205<0X\177\031W\\\272\230\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.84.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"E\t"
+	.string	"\026P<9@o\323\001\240\273-\303p8\235\334g\354\023U\313\202\rVd]\007*\016Z\322\257E^\363\251\366V\252F\237f8\353h\370CbN\006\217\300\"\372D\330\247m\367N))"
+	.string	","
+	.string	"-"
+	.string	"\307\354\3310\037;\366\245\227\214\322jw\353\344\270w\351\371\3778"
+	.string	"(\n]n\022v\327\022\024\215\356y\333\003\266\t\354+\004\017\261\360\303S_\200\344\301S\037t\235\316\324\214(\363\311\226=\206\344\334\260\257\331I\2627X\252%c\331\325h\261\026EW<l\007\017M\321u\037K\374\311Q|\362C\177l\262\351:\245#\325KnR\222\367\351R\211\007'\031Y\025\334\266\301E*\002\\v\027\301\007\t\346d\237\216V=\020\017Z\204C\225\320\030:\225\303u5\023\3606\321\300U\317\266q\025\033\367\232\235\244\205\030\32471\354o\227\237r\225\315\001\025"
+	.string	"3\241\215(\360\rz\373\250\274H\355`0\362'\226y\030\f\001\343V%\0320\f\340\200\370\234\342"
+	.string	"\355\022U\002\272\206\223\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.86.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\312\t=+"
+	.string	"\252M@\020Bp\234J:\r\364\2466\231*\244\253IT\376\211cp\027\272\365\255\266\2171\023\323\342\0267\243MoX\214zD\242F\216\241A\303\237dI\220k\2672\\U\375\205\250\252\252~\246jm\204\220$e\n\330"
+	.string	"\332"
+	.ascii	"\001\001\007\2766\360u\324\327\005\276\206\372\372\351k\247\257"
+	.ascii	"\233\276f\372z\351k%r\2354\256\221\276>\372\332\350\353\242\257"
+	.ascii	"\t|=\340k\001_\007 \327D\343\032\300\327C_\013}\035\3645\320"
+	.ascii	"\327?_\003\277.\277&\277\036\277\376\327\273k\355\200\264\226"
+	.ascii	"&\003\2369u\374\365M4\244\036\023\255S\265U\355,d\225\242S\204"
+	.ascii	"ZW\343\307lM\203\2153s\346\\\273R\322U?J\356\235\036\225JZiQ"
+	.ascii	"\251\244\205\266\034\275\213\233@\2712jxy\346\234\301\303\251"
+	.ascii	"P\201%9~\205V\340\004\240\"\233\231\002\201h9N\2451\002\207\210"
+	.ascii	"Mmdj#\323\203\270\244\017\035\203\330|\350\211\330\320\306\250"
+	.ascii	"9\247\332\351\336`;\333\005N\230sz\213l;\324?j\233\206\355,;"
+	.ascii	"\250)s(5\236\274S\033\342\334\331\376}<\324\026b\333\331\210"
+	.ascii	"_\373\334\330$\324\316y?s\316\255=\230\227;tu\002V\357\324\256"
+	.ascii	"\304P\\Q\357T\213\330T\334\234C-Z\261h\226\023V%J\032\205\230"
+	.ascii	"\330\330\212\325\242\213\274\240I\273\331\3169\315\3767W\225"
+	.ascii	"\034\256v\372\243\306\312\033\264\335c\337iU\251\347p\257Z\220"
+	.ascii	"\263\375\263\225\212ViaUb2\030\253E%\2550J%\365\300#v\364\004"
+	.ascii	"\031\356\237}g\246\343\234s\356\337l\035\347\234\323"
+	.string	"?b\357\232\003\271\216P\256\303\3125\030\271\376\"\327^\343\272\353k\256\257\267\276\206\360\365\203\257\035\220\353\006\343\232\301\327\013\276\016~\255\365u\326\327X\344\372j\\+\370:\301\327V_W}ME\256\247\3065\202\257\245\276\016\303\375\033\377f{JN\353\320\231\203\340S\177\033)\004\007.\365\363\021\347\f\374@\235\241\323\243\f<*\255\300\243>\372A\375\351\005\276\204GlK\002u\365\262\344\351zE\256\311\351\243\037\323\233\356\024g\351Jg:\324\027b\033\223\245\253\337\b\245\203\261\301C\227\344D\331\254Q\203\364\244\237\357\b\311\350\350#\036q\256H\213\332\0354F_\332BlB\265\004\236\b\241\254\026\213\006\234\300\227\312\020\347\316\036\340\003\376\364\205\330\344\214N\300\225O\256n\270\177Q\002\334\213\315\035=uD\267\205St\214\320.i\317\246\240b*\030\305\201\3210\026.`\300P*\251\305:"
+	.string	"N\364\307Q\353\303\264C\2673l(\265\b\340Qh7\323\321\326\305H\350C\277_\322\226\017\272\355\341\303jQ\350Qi7\003z\320G\276\237\003\017t%\277\020?\327<7uC\021\300+\036\371-?\362\021\233\344\251G\264\031e(R\244\230a\242\364\t\255\031-\306\2022T\210\215\261H\021t1V\242E\360DY\214\240\226\222\311^\240(\013\312 #+\013\n\335M\035\347\217\200`C3\374\231k\214s\026\2210\247\n0\302\343\340*\030\355!\t{\204\253\323\232\306(\301\036\366\307!\266}\035\354/\362\360(\027\2764DJ\241]\371u\023V\310\240\355\036\027\021\3329\305\271U0\332#\362u Z\037=u\244\327\266\355\220\025\322u/\256\256\255sA\370\226\203?\200"
+	.string	"$k\177\b\335\302|<8\220\036\017\347U\355\355\020\272\351\0256\007\007\262\343G\247\327`ul\216\305\301\340\r\0260X\240\025\314\322\302z\026\326\2529O\317\354-Q\350\246f\3426\r\353\\v\372\364\\M\331\263\035\256\231\202_%P`\365\004T\257\262\322>>B7\256=U\007\312\343\274\2528;\212G\350\246x{s\316.>\275#4\"|\023\302\255\026\205p\245\222\253\376R*Iu 6}tz\001\200\264\250\201@\007\025\262\032)HI\nRh\016\360\002\021\231\241q\003\021\020\255C\f\222\242))6\254\001\003\351\003\202\247\321\240i\302`\252\314\237\251\005\344\323\324\302\314 \036\034\364`k-\337\302\237\333\345\356\234&$\345a\351\311\354"
+	.string	"\223\233\020\334\t\021\f\254J\237\271\0270\024m\f\237\177\270\321\001t\316\253\033\300\327:t\373\355\213\343\316\bn\210Q\006M\224\343(%\212\253\217\331F\267\352\231P\231 \234_\036\321\fK\271\271\r?\237\024\002\232I\323\265\2618\322\366\007\336K\2023G!\2245\325\212\3006\320\352\307\276'\250i\330 \276\250M\027d2\274\352\020G@\321\371&~X>\021\230\022\004/G\030\3513\r\324\254\220\331"
+	.ascii	"\207C8V>\257\002r\226px\334\335\271\324\253\260\222\262\353%"
+	.ascii	"\204\236/\313\221\221YK?\240pU\3452xc\226\032v\226\222\2560\005"
+	.ascii	"\327\313566\203z\177\302\261\001\030\360\334\311\276\345\031"
+	.ascii	"\177\364Q\302\037gLuI\206z\323\223\203\3508\177\360\034\334\214"
+	.ascii	">\202\024<k}7\350`\022:V\330\327\214s\f\275\340\370\214\030\325"
+	.ascii	"c\314S\215\017[=!\326\251C\354#\026\251\234m\360nu\034\232M\316"
+	.ascii	"j"
+	.text
+	.section	.gnu.lto_imuComputeQuaternionFromRPY.89.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\335\b\255)"
+	.string	"\332N\250\020A`\236J:3D\f\231\225\3503\224\"{p\254\224ZoL\250\302d\375\202\234\003-\377\310\256ox\214m\370g\037\254y:sI.x\007>s!vS\251Y\347i\230\333\037\237\264MZ\332I\006\374"
+	.string	"\337"
+	.string	"\376"
+	.ascii	"wd\360\325\372\343\030\250\266!\357\2368\214=g\323\331v\366\235"
+	.ascii	"m\306>c\243\261\365\354=\017\355\332b<\306u&\3432\306s\236\323"
+	.ascii	"X\215\327,\321\336\227\036z`\\\321\2101;3\027f\206\016\306]\035"
+	.ascii	"\013\2734*\350\364N\314\231A\255!U7\037j\240\224(\375\305`\316"
+	.ascii	"\034\306\254D\003\302\324\346d/\260\326ZerG\224&\241\202\333"
+	.ascii	"\345\317\206-sZ\2273\2263g\3111\221\352\232Z\021\273Z+\204\225"
+	.ascii	"P\232D\232"
+	.string	"\236\273\256b+g\276\262\303I\265\036\021dW\253\034\204\235*M\256\234\227\250\311\322J\324\344\236\355\376YNI\025:Y\302\306\245O\255u\370$>s)\244d\360\363l-\324 \324\366\206\3462\312H\020\"\026\276\001B\204m\322!&\215<fP\210o\364\266\026\204\252\265z\215\247\333\233\332\234B\r\265\326\235moA\274B\336] \273\373c\267\214\013\246\272S\0248Z\202\363\r\356\303\t\264\r\352\317\333\b\2476\217;u\377D\035@\266Ai\3638k\255h?\022\243\036\316A\247n-L\320\362\300a\2636\377\354\312\241\315#\331u\260\376\310\256\257\330\030\034\306\273\3459\257\226\351\274Y\266\363b\371\316{\301f\274\026|\306K\301h\274W\326\363Zy\317;|\340.v\225\003o\261\251\0328\213=\345.^\006\336\342]\340,^\005t\256\024\235\233\200\316\215\242s\241\350\\\004t\356\001:\327"
+	.string	"\235[\200\316}\242s\t\320\271\003\350\\':\267\211\316e\242s\227\350\\\001t\256\022\235\033\200\316M\242s\221\350\334#:\327\210\316\005\360\271E\237KD\347\016\321\271BtnI\347\n\311\271\224\234K\222s\203\344\334\223s'9\327\034\314g\327'\013\303v\266\256\254\265VX\3279K#\032\321ibr\275\003\257\rO\326\263\376\3641?>\004>\340[I'p\364\001s\234\336t-\245;\335I\320\322\233\3568?>\246\013x\026\224\2453\r\277\244t\001VW\272\016\277<c\\\200#\035\353s\214\021\356\302\223\036\340N\202(\334\352I\027\312\261\360\243#\235\034s\365\341\217\256\303\257\316\030\247ft\341OpF\026"
+	.string	"\334\250\350"
+	.string	"~<c \321\213n#\036\006'\272\341\372\370P\370\023\221\241+\241\017-\270\320q\364\361\315\260\372S\2206B\263\374nQl\272mx\250\265\243\355\3269\216\2337\265n\206\343\261o\255\3264)\341\313\333\030\247\340\302\337\350\363b\fL\233\307\222\376\001yZu\362&\354"
+	.ascii	"\n\251\344\301\221\016\276\301 \325\027T\335)J\036\032\274\003"
+	.ascii	"\363\371\017R\375Oa\247\216<\222\215\202\307\346\r\276\3019u"
+	.ascii	"\005wc\023``\305\020d\305/a\030\221LHV\374*\303\210d\245\231"
+	.ascii	"\027\027Y\361\213\232yq\205\021\311\250\004\261i%6'\210\315+"
+	.ascii	"\261i\346\3055\024\343\253\214\b\242\b\f\254\030\002\314\213"
+	.ascii	"XF\f#\022\265(\216\201(\363\262!V\356W\004\0334\210\303\262\030"
+	.ascii	"0\210`/\206aD/\032\303\2571\262a\004\247-\326p16,+\026\307\206"
+	.ascii	"Dr\325\301\372#\035|Xa\253\023>\370\006i\325\031\334\215\344"
+	.ascii	"\263\363\023\230v\265\265;\320\365 \037;\254\233\254\207\017"
+	.ascii	"\323m\037\250I\241\224AS\3644\315]\021$\246\333v\252\331\323"
+	.ascii	"F\355h+\365\335\022\006\204u\251w\001zI\360].\373\301z\202w\375"
+	.ascii	"\035\243\276\213\302|\260\036\365\256?>P\337U\341=Z\207z\327"
+	.ascii	"\337\034\004\337]\341<YG\360\256?\276\003\337\365\362\235\254"
+	.ascii	"\037x\327_\236\201\357~\031p\353[7\360\261?/\005\276\353\302"
+	.ascii	"~Z\327z\201\217\371\035\215qO\337\200\223\250AL\002\rRP\215\210"
+	.ascii	"\202\202\202$Ic\020\003\021\251\322\034\021\340$\206\320H)\224"
+	.ascii	"2\352\2231\017\202\342\253$\216\022x\206\373\243\314\350bAr\220"
+	.ascii	"#\335\343R\236\302\371\236k\270Z\252\246\205\223\326\324A>\201"
+	.ascii	"\360\263\256\"T\352:\255\261\257\273\276L\255NxKd\206M\313\220"
+	.ascii	"\311d\362\226w\303\334\335\327\002\347!/\313\2169\302\351\314"
+	.ascii	"\250\340\212\245\222{\303\340\f\341!\355?\214\262\032sR\261\255"
+	.ascii	"~\333D|\254\fW\017\340\201\300\004\206\214\356|\027\313\341\017"
+	.ascii	"\333\372\203\304\001*\f\270\374\262\216r\016\"\323e\037\301~"
+	.ascii	"\177\343\245d\235\n\317\232]\201\205>Mm\231\222\f}.\327\253\250"
+	.ascii	"\241b\354\277\253\347\253\370\257'\302\204\272\343\301\344\277"
+	.ascii	"\222a\215\355\0232\254\261}B\2065\266/\244h\260\034\370\272!"
+	.ascii	"\264\0368M\314\001\235D\0306rmZ\375OD\177\250\331 \217\246\325"
+	.ascii	"\273G)\265\310\306\235?"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.90.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`B\004%\034"
+	.string	"\006\364\262F\240\\M:\240\250\313\013\266\236\320Q[\276\255\2170fa\3254x\274B\272\276^t\236l):U\241\233\336\2540\352\323sB\345\200\367\321\3630A\347p\2609\335\331p{\026\031\225h\335\335\032!\204\020)S\n\235"
+	.string	"\216"
+	.string	"\244"
+	.string	">\317z>tO\017\355\0306\354\341a\266\257\366\237\316+\337\223a\327\234?\262\250\314\351c\340\004\344C\236\023\020\037\202\037 >ti\247\271\257\310\034w5nO\340\3149gK\344\345_.r\024Cp\265\364\307\t.\\\316\350\257\003?r(\335\005*\320u\331\361&0@\262\036\365\003VH<\224\004\025hUyC"
+	.string	"\007\022\334\233\220\222t\274\251HCC+$%Xn\206\202MHJ\272"
+	.string	"rG \317\234\363P\327\0339\233\3528a\316i\305\345r\334\260\333\226\262\375\300\006{\002\327\375\233"
+	.string	"j\227\240\351q\272\317\371\260\255\321\277.\022\277&\234`\035\251\034\313\224<\n\321\006R\2611*\247\252\2435\262\200\365\245\376D\206\277d\030Az\334C?H|(\341I\214\216\327\243\246?\333g\323\025b\177\177\277\337\317\033\304\006\325;\357\375\002B\265\016\251\226\215\352\030\251\206\215\352\027\251v\215jRT\217\242Z\f\325a\250\006A\365\202j\005\325/p)1\272\036;\033[\3067q\374\346\314\252\320\312n\365\366\375&\217\212\361/\022\277\210H\332\202\323\246\246\277\220\351\210\026\327\216\337\345^\2120d\310 >\334\331G\035A\016\212\226\216\247\201\246\307\031"
+	.string	"\325\227*\333\032Y\347L\024\024r\205x\331\234\203(\256\fk\303\271p\330\"\356\307\200\016\346\234#x\0371\334X\223\023*\273\303\261\370\220sN\b\276\225_\361\340/=4\210\020!\304\207\341~\352\252W\323\337\272j\316)\032\020u\366P\177Y\351\r\210\340\352\254\365\226d\373\224O\371\214 Ab#\\%\325\364\247\367\3159\303\335\017\341\331=\223\033*q\264\216v\3169\301G\t.@\374\004\001} b\36134\364\202&3\255\301\213 \240\031Q\n\024@+N\314X"
+	.ascii	"\225\b\232\321\206\\\314\032\354X\250\305\317\320\214HHhh\006"
+	.ascii	"\363\325\016\316\r\342\013:\220\342h\325\326\006\3169\347k\201"
+	.ascii	"\272\026\266\262\275\357k\312\0359g\3558_\315\265J#\345\221r"
+	.ascii	"\247\307\225;\261d*\223\360\334\326\310\261\225)yV\351\324s\246"
+	.ascii	"\344E\300\212m\317ka{4\345\222\233)\235\236\305\214K&/S\362>"
+	.ascii	"Ud\314\311\224P\024*T\020\037\276\366Y\256z\344\272\366hn[\343"
+	.ascii	"\222\373\333V\315\026\036\306jD \245\267\244\343\365\036P\250"
+	.ascii	"1$\244\034s\2061\222`F\222\302B\213\001`\002\221\251\263s\020"
+	.ascii	"`U4M\n\035\022`-\311d0\023\002\237[^\304\306\030Cd\375\023\363"
+	.ascii	"\024\320\026-\337\214Q\232\316\362\242\001F0j\341@w\202\273\321"
+	.ascii	"\b\327\344\303\264\373m3\374\340R\021\276Q\222\345a\220\372`"
+	.ascii	"6\265\364\027\023.!\365\001x\302)\270A2^\224\304\333s\006f!d"
+	.ascii	"\245\351z+\260\301x##\212\2119q\202\315\026I\016\350\276\325"
+	.ascii	"\250~\362\024\030\232\002\206z\263\3419\234w\f\025\266\226\370"
+	.ascii	"\016o\335\304F\277\231\330)G\233\025\357\275\024<\251E\324\003"
+	.ascii	"\005Faas\353\352\017"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.91.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`A\002\205\023"
+	.string	"\206\346\202H\340\360&\035\332\216\302E\3440\230\276\r\355\361r\316\337\327\r\327\320j\214\020:BR"
+	.string	"\373\277\316\b\265\266c\330\330\023\b~\261\351\3668\0249\306\030\213"
+	.string	"\231\361\006\202\260\345Py\270\234\233\350_3\321,\331[\312\224\002m"
+	.string	"a"
+	.string	"v"
+	.ascii	"\036\321\335\346\234\337\245Mc\177\217\371A\376\216\263\356\023"
+	.ascii	"g^\302\213\236\020Os\316\222K\023P]\372%\016\024\263u\t"
+	.string	"\"\310l\006z2\330\020\341\230s\202$\027\361.\343\001x\227\353\341\261\307\325\230_\363\230\no\212j\266\234o\f\240\263!\007\210-\214$MN6\017\272\336\330f\252)\2249\247\265f\303\271\345m#\260]\300\326\241\216\231\321\327.\375\031\357Ro\235w\331\332\017}@\317\021\220\006\023K2\335\331\271Pw\307~\234\253cG\265\353\270;D\325\255\250fE\365j\325\237\252?T\355\241j\225\252S\252\366\242Z\256:\252zU\255\252\276\310J\004\217\355\023b\314ia\247c:\311\245\021\307\375\366}\241\017\331\237i\236\013*~n\251Y\310\262\326\013k7hP\241\356\0347d\217d\263\203\245\273\266\312\212\367Z\\\022\335\357\356i>\341\217\216d%\237\307,N\322\327\234\264\256\031\267O[k;x\355\346Z49\315\266\346Q\034vF\273;V\272\r\026\035\234\246\017\354vP\2639e\002Z{\243"
+	.ascii	"B\250\206\213\0253\215\262\221\225Dd\374\304\213`\256\017s\316"
+	.ascii	"\023\242\243\200\340\363\\\006+.,/)\322*&3\257\026P\246\001K"
+	.ascii	"\213\013\003\360\245%\345\005\252\300\304\200&#\206=X\201\001"
+	.ascii	"e`0\030\360\263\355\234\354\253c\020\032\206\nA\177\016\355\002"
+	.ascii	"NK\276\332\033\333\2535\212l\303\270;\266\277u\355?>\217\365"
+	.ascii	"\366c\017\203\346\023\252\326V\360\322\327<~H@M\032\251U\261"
+	.ascii	"6\265\222\210\366$\327\333\323\236d)\276d\335\00231y\227rOn\001"
+	.ascii	"( P\002!s\212\017\320\341\037\205\366\232\355\t\233\231\210a"
+	.ascii	"|\325\303\t\033t\021x\325\021\303\007\361\351\3408\r;N\311\217"
+	.ascii	"\003k/\232B\241\022\201\030\2135\020\270b\220Q\203\347\3434\364"
+	.ascii	"N\317f\b.I/\203\237H\225\026ta>LY\350\031\336)\306\3718\300\316"
+	.ascii	"Zl\330\364\\]\236\026\357\001"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.92.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\272\001\005\017"
+	.string	"\246[cF\360\262&\035 \321\353\023R\265\343\003m\322\023\333\277]b\255\340\232\363\350\247k>\234\373%\272\264\276\255\033\t*\340\335\304\317p\235\343&Sx\214\207\305\005\205%C\211E\233\330t^.\370=4!{\223-S\nO"
+	.string	"K"
+	.string	"O"
+	.ascii	"\0270/m\262s|\225\332\021\0215\031p\\\273\273E\0177}J,\252\311"
+	.ascii	"\317N@\300\360\373\004\020\306\\j1\307\260\003:Z\364\200`@\200"
+	.ascii	"\237\020\245Q$\304\200\221\354\356I\\_B\027\325\354dw\255`\250"
+	.ascii	"\341\316n\233\263\235\300\326\001\001\372\322\264+X\320\203\217"
+	.ascii	"O1\303G\013\025?{\365i\354`\037\333\335u\224\261\257\3723U\253"
+	.ascii	"\252\377\tP3\023\376\245\306.\314\353\307\266\244\213\020\037"
+	.ascii	"\333W\373#nc\272\352\202Av9\344\350\354\256Jl@\273$9h^b\001\234"
+	.ascii	"H\3522\307\301\206\035.\327I_\216\037nP\304\220!\232E;\245\323"
+	.ascii	"\203\306\342g\357\330\320\244\260\337\\\343{l\t?\321\242\355"
+	.ascii	"\256\002\337\304qD\376\314\245G+\322_\231\227\032\013\334P\235"
+	.ascii	"\364u\335\335/\272e>>(\201\003\245=<5,\rB\242\216\001I%\344y"
+	.ascii	"%.\304\234II\324m\244\b)\335\004\b\233J\207\"\3328\217e3\031"
+	.ascii	"\361\210B\310\333H\243\221\267}V\373(c\215\206\214\326)\272\314"
+	.ascii	"\2778\f\236\035\275y\246\253\344:,\026<hX\266\225\200m\004_a"
+	.ascii	"\026\310\306\356.\260Q\256\"$ \320\202\2311\333r\001\363\315"
+	.ascii	"`\003\337\345rPZ\233`P\356\372`\210\345+\210\335\304\235\203"
+	.ascii	"\r5\204NNE{ \316r\310\2126YBQ69\230\341\017\340\200\371\020\026"
+	.ascii	"\r\3571e\203%\326)\202K\032\370u_\255\221\005!\267+\353\001"
+	.text
+	.section	.gnu.lto_shouldInitializeGPSHeading.93.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\335\t"
+	.string	"F\322D= \345*\035G\216\"1%\221\210\t(\210&\226h\270\022\305\f\001\2524J\310\001\"S\251\371\377\317\324c\240\370<^t\016(\001\241\200C\230,i.\002\304\0208e\232\020\"eJ\0012"
+	.string	"1"
+	.string	"4"
+	.string	"\337z\034<\267\n\372\246s\f\254\322\345Ee\\}\271\204\026\313*3\246\270\202\226\216\230\307\256\252\021\245*\260\231sZ\303q\343\356n\273\3016\202\375\007'-m\322\244\373\262\317\3159\247\327e\253\357u8D\325x\2216\247X\336f\255[\021Q\275]\2623VX(\031<\371!\022\300l\031)\2669\311\336\234\026\305\355\353\240g\342\300\032`\013\360\220\260U\333}\371\240\367\205@\201I\251"
+	.string	"\373\262\223\200>\2101H\372\360\235O\362\336}\037\373\3018\003\320\222\261\002\346h.@\236o4!\341\371t>\n\317\003\350\343\210,>\215\201C\025\021\242o\024\n\211\276\f9\277.\177F\302\031M_\362\307>p\203\2253\332\376\344\272\032\266u\003\016"
+	.ascii	"p\b\370T\307\253\303\216\251l\200u\267r\215\004\035\343\303\205"
+	.ascii	"\\f\235\337h\203\345q\315Q\245CQ\253\240"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.94.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\245\007"
+	.string	"\262M36Po\322\001\240\234\206\355\324\240z+\237\241@(\304r\211\2728\205|p\253iM\362\331\263\231\241\023B\316\232\231#\2142\017\255t\215Z\323\245_,\331[\312\224\002\356p@\036+~\034\032\254\007\206\ba)xb\007\223\210\034\002_\021\013X\374\\\027\0263\334\376\255\226R7#\255p\211Q\032\026\221\223\200\006L\273{\300}d\302?\035\232\"\224\327\016\375\320\215R\035\246\002\244F\331\331\234(u\303\376[-\331O\247\006\254\\l'\265\354ft/\233\002S\035\2663;\343\177\034$\263Q\2173\235\n<0,N\\v7n\256\251\016\337\005\252C\345x\366\314\374\207<A\205\324i\233\350\211A\330]\247\266i\334z\003\333&\001\016"
+	.ascii	"2\241\221\037\030b\202\2219\032\023A\305\201\330\fV%,\327p\341"
+	.ascii	"\020#fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto_getQuaternion.95.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`D\001%\013"
+	.string	"\306\223G= \345*\035 \305\001\022\0231\354 \"\202\203\223\007U\241A\327A2\"\003lR\301\276\r\370\0336e\030\031[n\305B\025"
+	.string	"B"
+	.string	"Y\003\301`\207L\200]\3136e\302\b![\246\0243"
+	.string	"2"
+	.string	"6"
+	.string	"\337;\2277\360\336}/\360\336y\264\001\274d\255\346C\303\342%`w\301\311\361\361:\372\027\371"
+	.string	"\231:]\005\030v\327J\2462\356y\333\007\266\023\354\327\002\347vw=W\366]\277\247jN\325S\325\252\352c2\265\213\324U-\273\030\267\001K\353f\036\030\333W\373 \017\031\3572\235`w\005[\331-\025\214\020-\235'\242\303L\324\366\371\022K\031\326\356\336\205\f`\322K\034\373vw\301\0379I\311\357xg\n\223\236|\347\233\274w\237\034\225J\313\205\322\233]\236tn\330\001\243\016)\304\331\263!\201>\340\b\342\341\023\341"
+	.string	"J|: \320#\212\300\215\306\341D\203\b\216\302P\0041\345\236\333\271\362\367\"\243\241f\205\271\311\022~&\343ls\306BOA\231\223\243\212\005\035"
+	.ascii	"2\241+h`\\xQ\001\003\315\001C\200\0340\026\005iE\005\002\264"
+	.ascii	"\001\306\005Y\242 XT\300@s`H\024\344\200\261+H\003A\024\265F"
+	.ascii	"(#2U\203\007\020\\lhVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.96.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\366\001\245\016"
+	.string	"\366\232_E\340\2626\035\240O\020\007 \005=\255N3.\332\220{\013\223.,;\337\341\f\022NR\253P~y\304\177\267\001\f[\007;\371\312g\020JC\206\031f\2301\266P\341\020\342:\346(\370n\233\350C\233H\231RH"
+	.string	"F"
+	.string	"O"
+	.string	"\330\243\237\366I\274\004\351(\247\234\355\336\240\\\354.\003'\300\036\021\334\300\365h\275\300\365h\222\255\343\241\314\206\214\370\200\001E\217\335\335\324\303IO\222\177\023\317\300S\351\t"
+	.ascii	"\302\356:\301\223\313\255\267-b\333\201\235.\001\243<8JQ\311"
+	.ascii	"\203V\240\203\243b\321\222\035\226R;\330\267vw\2551\366g~\317"
+	.ascii	"\303_;\352\3172}=\0353m=\255\231\316\247O \300N\206\323_p\354"
+	.ascii	"jX\375XU\264\ta\373\232=\263\323 \244\261 jCSU\220\034\030\232"
+	.ascii	"T\373\363\026\334\001\031\233\3445%\002r\354\356\203\025g\321"
+	.ascii	"U\360\274\353\361\340\216k\252\306h\271a\312\225\235\372\006"
+	.ascii	"c,\273&\221L\257 \034^V-\"Vre,\177\342*F\330\256\351\240\237"
+	.ascii	"\3424\027|\020\217F\t)\037\0255\341D\335I\004\201\276\220end"
+	.ascii	"\344u\233\310\244\244\003Q\330,t\037o\343B(\333H\210\277\023"
+	.ascii	"\222\320&\372\276\320\246\205{k5\306\230\216\017\225IWj\340D"
+	.ascii	"\340q\251-\34173dD\275Tk<\032u@\016L\312R{\302a\330\274P\265"
+	.ascii	"4' \360\002\242Qm\0032B[J`\nl\2602\244\f\003\366 \331\232\266"
+	.ascii	"\304\314!~\205\345\2611\216\007\237s\273(\265\274\005\242\273"
+	.ascii	"%c\311\006\366,\215\337\026\030\230\321\032h\275X,\005h\334\021"
+	.ascii	"kc27\263\203\220\367\034sP\324 -/\204A\006"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.97.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\306\001M\016"
+	.string	"vY\\E"
+	.string	"\2614\0358\350\317\377\241\211\237\226&\336\315\031\177C\350\r\226F\240\272!\263\006\363A\027kg\336\021-\241\303q\037\304v\333n\303\250%B\242~UU\002\204\332%\300L\025\030\261~\304%\"d[\271S\nC"
+	.string	"F"
+	.string	"I"
+	.ascii	"\366e>\343\035e\034c\273:&rvW\304\005\256\317\001\027P}~\036"
+	.ascii	"\240\372\264g\353x\b\263!#P"
+	.string	"\031lzv7S\020\367.=\3776\307@\323wi-\330]K\320\264\341\326\333&`\033d\313-(\235<\330\245\250\310\203\2267\247\035yX\364\263\303O\352\007\373\237\335]\353\213\375\232\037;\315o=\374\347Q\277\202h2-\032L\347\220\332mI\365Xq\272\ba\373\037v\r\017\021\032\034\bB\235\003\327\247/\003\322~\0202\260\343A\\\321\317\230\332\242\313\2101Zj\227\034\306\213\033\247\251\266\366\0269\243\252\275\235\205q\024fw\025\370*\276B\302\210\343\252\317\004.6N\035J2eK\376\346)\272k\267t\320?q\024&~\314\247\003\030\236\362\013\357n\021\be\264e'\021\264m\002\204\214\302\026\032e\"\222I\006\n1W\241\204\224\235p\034)\373\b\367\372\342kgF,\351J\r\321\fT4\022\"\213~\rB%D\214<\377H\345\3178\215\021?\306\016HH\252O\013.9zv"
+	.string	"\b( "
+	.ascii	"\203\221\261\340\001R\001\377\311\f\006f00\204K\366\240Z\331"
+	.ascii	"\330\360H\220\310\333u\\\036\213\255X\267*N\316[\260\334\215"
+	.ascii	"\370e\347\316\345\260\335\264`\033x\022Y\204\230h\376-\254\307"
+	.ascii	"{\362p\214\314w`\245t\027c\245\344\256C`\201ly!x2"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.98.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\206\001e\017"
+	.string	"v\235hE\360\262h8`\372\3554\362ppU_\037F\214\204(\200\346\226\224=\212\006 \327\227\325ycU\376\013J\2662\2508\026\356\307\2129\207[\207\201'\262w\232J\227\207m\271\311.\275\240\3328\233\354\275\245L)W"
+	.string	"O"
+	.string	"X"
+	.ascii	"#\037}\200\367.\355\224-\362\002\006)\253.\312\300\b\314\334"
+	.ascii	":\334\374\354\212\240\232\270\352\035\247\251\362E\302\325\273"
+	.ascii	"/\3049\216\244\247&d\004C\361\022\205\256Tn\304S\002H\200\320"
+	.ascii	"\205#\201\271\001\3424\317\227\260\225\0312\331]\347+\374p{\267"
+	.ascii	"\375\300v\002\373C\002"
+	.string	"\026W\2511\373:\216\343h\215\261O\273?\247C\237\335\236\323\234\246S\323\027\251\240\002\346!\374\b\333.l\274\355\216\256F\212\323\376\331\323\276\315\001\326\310\272\\t\320\360Y\370\342k.K}\206\372\276\366\255 3A=\273\253\340\235\021|\357\002\352@\307\302e\240\024'FJ\006\301\370\3646\027`\373\361\254\371\360\220P\215Yi\337\340]O\363\217G\013\034\256\004\262\247W\003>\034\200\\z\016\3526dl\323qR\256\343cw\033\270\370\215\212\177\342\235YZ\362\257w~\213\367\316\323\213\007k;?052V\216\016\032 \244OJXJ$p\205\002\n\351\302\004\020\003)B\t<9\251\200%\005l\312 \341\004\256\230L'P$\3565\306\231\237\361\333\n\0219;\352\253<s!\345\364\3056\2476ai\313\334\356n\007 m\024R\376\025R\325\225m\243\345\350\301i\354\305\3630\331\247\031\035"
+	.ascii	"b\b\270\352\034\206&\034D\261\260\253m\330(\265\343\336\020\034"
+	.ascii	"\030\020\020\bJ\202\301\334 \021X\334a\371\370\032H\220\030f"
+	.ascii	"|\331\f\345p\031\001\006vT\217Ie\b\254\222\244\030\005\256\221"
+	.ascii	"\257\304\253jdV0\367"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeTransformVectorEarthToBody.99.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`#\006\215 "
+	.string	"\026<\313H\220XN:\204Hl\260q\343\365;\321\372J}\3751\245\221\020\245q\344iQ"
+	.string	"&"
+	.string	"\013 \324Dl\354\217#w\371q\177fi\007HD\006\220Xp/\332GZ\250\353\241\2449\254\354\277\274Q\207\337\266\021\231\244\224\001\270"
+	.string	"\241"
+	.string	"\276"
+	.string	"\315\232kV\262Y\273Y\337\254\334\254k\200w\303-l\311\274\314\251\"\316\314|#\221\340\330\264]\265]\266]!\333\252\273>vm\177l\233\332"
+	.string	"\331 \303\025\342E\363ff\3742\347\212\340nIv\332^\216\215\006"
+	.ascii	"\265\022=\201\354\321\254\3061J\321\266\307p\323J\354d1y\212"
+	.ascii	"\230\231\215/s\316\250%\365i\267\244Q/\253\256\216\3351\3343"
+	.ascii	"\023>\235y\302\207\n#s\242\001\320\246\335\222\212\266>\271%"
+	.ascii	"w\333\313-\251C\325.\21366}f/R\254\221\231s\006/c\207\313C\335"
+	.ascii	"m[\232b\330\327\262\016\301\234S\271\030\306b\365\253\252I\252"
+	.ascii	"J@5\307#B%,H8\254\333\032\021\002\307\346$nQ\227\310\026\321"
+	.ascii	"\322\255\261\244n\ty\213K\352\ns \272x"
+	.string	"\213\352\224\345\310[\371/U\264/~\f\325\355y1\325M[\255Z\265U\252e[\235\332\263]\001\315*\325\254Q\315\n\325\254O\315\352\324\254M\315\312\324\254K\315\252\324\254I\315\212\324\254G\315j\324\254E\315J\324\254C\315\nlV\241f\rj\326_\263\372\232\025\250Y\177\232\325\247Y{\232\265\327\254<\315\272\323\254:\315\232\323\2548\315\312k\326\233f\265i\326\232f\245i\326]\263\352\002Uf\\)\217?\327\371\324y\210\317\177z\336\273\317\241\026\254\226\2363\024\236\357\274\367'\006<g%dg\304\006;g\266\234\323\\\347?\270\322Xd\265O\314IL\302y\316\267,\003\3438\345\375\3468\037r\260Vx\33706\257\371\315\201\017l\276[\310\316\210\020j\276Rv\327\235\346>.eY\204\245\242;eh\224\260\253a\342\353\226;y\335uk\345qB\356\253\326\377\311\223p\345\221B\277"
+	.string	"\177\377\367Zi\004\253\300\227\"S\265\260mZd7\347,\260\037\341bI\2313\"\307\251N\333\005\306R\\\267}\",r\222eu\265\001\311\033\212\177\351\r\257\3332\021\362\222\254$\001\\WXX]\030r#\326kI\254\210U\253"
+	.ascii	"]ZY\301\020\0322du\300\nz\310\272\240\025\264\342\002\021\f\340"
+	.ascii	"\323\255\017W\\\301\020[[\\A\033\264\271=/\266\313\"\346\215"
+	.ascii	"x0\365\3529a\034X!\273_\3228N\253>\246\f\325\305@\3111u0\037"
+	.ascii	"\033\340\242I\231\026R\177zU\324{.\005\365\334\243\202\016\365"
+	.ascii	"\"\270\362\350\364\247\246/\335\211\351\2747]\b\216\351\2773"
+	.ascii	"\345Q\351\273/)y)\215I':\025\322\223\216\336s\244Cq)\313\214"
+	.ascii	"^\364#c\002#\005EC\377\235\350\272(\245\021x\336\207>$t\340\201"
+	.ascii	"k\3451\350}\241\007\005\375\267V\036}\377\001}w\337spe\031\030"
+	.ascii	"\320{\001v\250qD\305\030#VA)Jq\322\032\300\002\221!\252n\021"
+	.ascii	"01e(\247 eUs#8\260,J\272\244\"\002D\231\200p\r\322t\202bK\177"
+	.ascii	"\232\306w\274p(\252\354\031\022\304\301\237\021\362\203w\004"
+	.ascii	"fDCjN;[M\337\337\334\327/\224\260\025K\023\315G\n!\371 \"\204"
+	.ascii	"U\231\243\246\362\340\365\350\365o\233\222r^\366\002\335dk/\027"
+	.ascii	"\233'\216\004\270\303\256|Z'\030\340\330\350\017f\205v\b\300"
+	.ascii	"NCz\213\025\342\225\247\322:\341\323\341\307\324>\2226/\204?"
+	.ascii	"\024\375\034+\276\034\030\212g:K\240,\240\302?\fR\277u\347$4"
+	.ascii	"\354\356\034\233\225\277\007<L\300\377\243eLKu\276W\335\224\354"
+	.ascii	"q\r\020a\307-\263\356\310\036\367\0138\204X\306}\344\345\250"
+	.ascii	"\320\244\026\306\372\003"
+	.text
+	.section	.gnu.lto_isUpright.100.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`s\001\305\016"
+	.string	"\346\333`D\020\257&\035#V\004\264'\244]\020D\013\323\007\236\025lt\203\366\360\346\373\371\027q\210 \303\365\247\324ZB0\276\027\225oM=9D#"
+	.string	"\n"
+	.string	" Bl\246&*\204\005\211s\322\215{B\310\336R\246\024M"
+	.string	"J"
+	.string	"P"
+	.string	"v\347\3616\212\335\361\001\004(\336\376\271\254h\304\234TB\304\330\3752\335\360\355V\204\232\233\177},\310\360\262\"y\334-\314\302cJB\001\236\204Qj\307\023\301\215\335\275\314\223\202\227\222y}\354\256\223\344U\270\257\333\036\261\315a\377D\313\2517\353\232\032R-F)\303X\346#X6\211I\236tU\200a\244\234\375\211RM\366\341j\311v\032\323\364\005\323P\323\232>\200"
+	.string	"\036\\x\177\201\261\273\262R\255\212\210\303\301\366}\324gN~\362U\027R\304x\264O\002 \266\311\223lc=\252^\3460\206\313Q\265\240XL\370f\300\212\213x\t\217\206\313\356&\030q\022!>\314\243E4\355\316\261\036/\375\314\013t\2409\265\240p\272\\\035\252\351\303\323O\035\304\346\303\330\301'\372\037\3531\225\203\005K\227\253\314\335\366x\230|\264\254\244\201\210\366\200A6\242\201|2O\210$\363 `\020\204\220PV\002\002\205\262\316\327\035\256\226\234\260\343\251\035\317h\340P'\330\306t\243S\221\241b\nkTft\271\302,5\371\317o\227\213Z\362\245\252\372\"\205\202\3465\276\t\" `\202Q\210\224\033\320\b\r\021\031\312\f\225j8\235\216\346X\024\\\004\365\301\316R\245-"
+	.ascii	"l^\254\315\362~6\276o\2355\302CX\t\360X\216\272\305\345\332\360"
+	.ascii	"\374\3412\026\314\346\234`\347\377\266\306\355)\340s` \325\036"
+	.ascii	"C\033\205\033\233\200\313"
+	.text
+	.section	.gnu.lto_imuInit.part.0.127.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\b"
+	.string	"R\21788@\217\322\001\230N\\\037\343\307\035j\367M\271$\r\224$\336\362\220\326T\255\227\262L\311\245\021!\006Q\004q\006V}\013#\300{\202#\220\340\350\31606\272\211\334)\005>\230\336\234\033\207B\363\034\266/\203"
+	.string	"=\210:\216\263}\3316?\006\326<\242\216\223\337\204\004W\021!-\270\254\223\332\fIO\201=\3206\345\347ySb\266\341\257U\224\033X\\4tC5e[\003}\224\220\235p\226\310\013\217\027\233\216N\347\321\306\310\2007Y`E\345\302\241%\250)\353\365k\025e+\302\313\300\310\356\307\214\314\222\304\226\023\373\253\221\215a\217W\331\036\201\230d\303\234e\262o\251x\264bvW>j\311IWx\221\374\257\016`:\225\256\001\247\220C\202_\032\206\335\365F\344\216\267\255`\373c;%\021"
+	.string	"O\023\030\027\314V\224\3003<@\024\fs\205\2730aqF,\352\234N\013m\246\3544"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.131.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\345\002\335\025"
+	.string	"fi\215D\300\332(\035\220"
+	.string	"@f2R\t\202V\302\024\300\333\347\234d!\345u\256\312\322\270\200\272Y\253\375\177\375,j\353\304\326\260Q\377Z\006\002(-/\254\003`\335\360t\3219\372\324C6\362'\022B6\2212\245z"
+	.string	"q"
+	.string	"w"
+	.ascii	"\236\231\263\306\021&s\322\024\\Z\004^\342\274\306\273\354^\300"
+	.ascii	"\273\264\377\3036\213\205[\266\226\323pL\233\036?P\030\0013\347"
+	.ascii	"$]\356\215\267\376y\262[\005[~\002\025[d\243\353\337\347\240"
+	.ascii	"\366\016\271\236-\262\021\306=\225\215/.\273\034.M\276\324\254"
+	.ascii	"\330!\013\215&\264\013\2151]\232\361D\2073\347\374\355\3323\302"
+	.ascii	"T\t\034\374\034\3149\375\327\354\236\271\355\023\266'\330\373"
+	.ascii	"\005\017\275\021*\275\314\277}\300\217\0252\270\330\272t}\274"
+	.ascii	"`7\327\206\r\336v\177R\355I\265\354\324]\247\336U\353i\377\005"
+	.ascii	"\350\254\001\2209W\004\215\2314\244\023\036\267\375\366\375\""
+	.ascii	"'\342\337\034\262}\033\3138\26192b(\237-\346Sx\3511\205\313\234"
+	.ascii	"st\351\005\340k\367k,;\024\262\352i\254\017)\321\321\346\310"
+	.ascii	"\302\252\366\203\\H\353CJ\004\377\215'\327\243\362*\0260d\310"
+	.ascii	"\340]\312}\231\034\237s\316N\344u\373\333\001\324\330\213\274"
+	.ascii	"\335n\255(f0\r\262\037\345R4l\340\300\301\273\334\275\355\312"
+	.ascii	"^\347\234\256]\037\217\256+\022\301\022S1\366\237\034\310P|\035"
+	.ascii	"\356` \003y\227\272\ffY\302\314^\032\324\204\211=\250f\320\350"
+	.ascii	"\3276\355\224d\204\364?W\022\202s\276\220<I\b_\307\245Q\241^"
+	.ascii	"v\351\251\360\264*\231D1\204`\342\331I=0\361\254V\241\bbe@\205"
+	.ascii	"\301\204:]X\245L\242H\242\024\300%\035\022\250\023i\005b\347"
+	.ascii	"\304\363\201\224:y@\221J\242\212\244c\343P\204I$\255\302P$\351"
+	.ascii	"\327F\355O\221\243\202{-\354[\037\213l1\226\310o\265\033\235"
+	.ascii	"\306\026c\207\216\016n\217\215@\301\265#H\320\237\\\020\\\254"
+	.ascii	"\363\016\250M\241\202^\366m\007&\347\003\007[\227\36793\252\270"
+	.ascii	"\2207\236w\025]\002; \200\002\031+\335\006?\022\204\313\030L"
+	.ascii	"\016\304\037\375|\212\346\245P\222c\230\270\276\215\324UX\347"
+	.ascii	"\330\0339`\346C\0265\r\316\\\207Sl?\213\001\363\b\332>\232\327"
+	.ascii	"x\313U\260d\334\202\036\267k\022\216\037\270\377\374q\306\356"
+	.ascii	"\260K\242>\314\177\355H,\t\300\016-\23454#\376Z\200\351\033o"
+	.ascii	"\341Q\370\374\330\261\275d\313Y\327\266\272\354Z\200$\357\374"
+	.ascii	"\020\263\365\321\343\013N\365t\270\305\332\347\004"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.part.0.132.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\276\003\025\027"
+	.string	"\206i\217J\300RN:\"th%3M\245@\341c\341\333x\017}`[\316\351\237\257dp\326\002!\373\001Q\302\035\315\210ml\373\367\274f\246z\217T*!-\225\212 \211\200\356y\001\350v\0204\250\037Q\257\203\334\032\331D\356\224\002v"
+	.string	"t"
+	.string	"|"
+	.ascii	"1L*\335\236\304\343Y\031\254??G\362\225`<\210{\022\317\253\257"
+	.ascii	"~'\304hH\220Z\253\201S\023\210\235\236<\300x:\2372\236\256\217"
+	.ascii	"t\263I\033g\223\247\177\341\026\227\333\217m\267\270\340\234"
+	.ascii	"{\220\310\007\200\321\227\007&\257Z\203\264\323M\361\334w\212"
+	.ascii	"9\177\372\200t\337\013/\002\203\234P\370\200\002\022\361\211"
+	.ascii	"r\021\006Skul\304Mo\033\201\355\003\266\250 \345\034\316\035"
+	.ascii	"\362\212\027\353\n\331\236\226\321i\023:]B\247I.u\223tz\204N"
+	.ascii	"\213\320\351\030\235\206\321\351\221NS:-\322\351\245\323\223"
+	.ascii	"N_E<\n\222\375j\365\031~U\023tJ\305\227~\247_\352k\337\207\022"
+	.ascii	"J\335\036\265\343\031/X\213d|\006\356Q;\257!\352\334\321\302"
+	.ascii	"hX v:\023\2372\232tzjj\232\225'\225\327cE\343K\007\372\001;\343"
+	.ascii	"\255\216\\\222%wD\302\221%wn\365\272d\223\256\310\33245\363\276"
+	.ascii	"\221\235\365\254.\266\"\273X\260\0357\266\260\250\336ogs\035"
+	.ascii	"U\260M\240\005,k\317\201c\334\027q'\335\305\352\255\020\336\""
+	.ascii	"\257\326reW\\\001T=\026\2739\364\334\357\356\200\252\336ow\341"
+	.ascii	"7\250\346\336J\313\276\271\r\013c\265\326\027\277\306\247l~\321"
+	.ascii	"\2517\344\314\373r\306\323\357\021\227\360\353\207\004\f;3<\333"
+	.ascii	"Af\232\206\205\303M\215\246S\301\246\206\201\002-Cm\346\206F"
+	.ascii	"\203\223CcQ\261MC\r\016M\307f\303\241\221\027\353\n\371\302\243"
+	.ascii	"\314?7\312\366\203m\331\032\246\334\235\367\342\356\220m\013"
+	.ascii	"%|@<\325=a\223\265\027\274\213\213\201\311\316\253\037$\256x"
+	.ascii	"\253k\360- ^^\345\212\355\340ZY\020\202\230\\x\225\254\375\340"
+	.ascii	"=,\224e\3618V\004\t11T\276\256r\016\2152I\326\236 3\357+\tI\250"
+	.ascii	"q<\345\214r\002\022\242$A\n\032\r\007\240\002\221\271\252:\021"
+	.ascii	" A\211(\020\252PaK\333\0010\004\353\"\247\266\327\316\206w\264"
+	.ascii	"\232\312U\265\270\347n\252\225\377\001\bt\017f\213O\305\343\355"
+	.ascii	"\013\004u'v\253\350\370P\310\025/Y7\224\361\327j]i\240\234\013"
+	.ascii	"\256+\214\016\312qq\236\031*\267\026\030\373-\347\331\303\270"
+	.ascii	"=\250\030\310\355\221\2606*T\341\333LUf@r=\324\320\212\255Wr"
+	.ascii	"\t\265\034\021\t\211\327!\302\273\304a\267`]\b\214\212d\252\303"
+	.ascii	"\250\325\253\2731\032\177\211A\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`p\006\245\027"
+	.string	"\326$\207J\260\326M:\264\207\342\364j\2729|\004\006\341\365.E\204\376W\313\017\322\371\2158\360\177\220\356\024#&h\235\031"
+	.string	"\361a\310\261i\270hL\270hdN>\364\267\373\370\313<\346\3308\261H\264\027p\030M \020\332M\356\235\002l"
+	.string	"w"
+	.string	"q"
+	.ascii	"?\354\377J^\035\013\372D\016\234\252\250iIt+\326&\310\0165}Q"
+	.ascii	"/I\226\272\376\257\036\212\300}\b\335+\327\307\2528\242\333P"
+	.ascii	"P\037I=\224\355U@\377\372\371\026\003>\327R;\026\376\375~\277"
+	.ascii	"\236\376\221\252\340<\022\364\215T\232\367f\357a\371\247\345"
+	.ascii	"\r\360\323\376\007/I\336\034\177\377V1(\354\336{y\372B\352\377"
+	.ascii	"\220EYN\364\273L\364\271\224\350?!\321\3572\242\037\205\336{"
+	.ascii	"\177\033\021})4\004\316\2028\020\373\273hzrbZ\372\360 \366Gz"
+	.ascii	"B\342=)9)5\035-\265\3409-ax\270\225\355\320\367q\3507\331\320"
+	.ascii	"\337\322\320g\222\241\277\004C_I\275\320\327\252\026\372I*|\n"
+	.ascii	"\205~V\235\220\263\022\204l\204\033\204\376U}\240s\320/RwE\r"
+	.ascii	".e\364)\313\340\001\"\207gN\254\367^\250\232\310\241/4}dL\317"
+	.ascii	"\233\214y\224~\321\370U\341d,\323\243\366\206\r,\030\310\241"
+	.ascii	"\217\212]=* \220\351I\331\0062-)\r\002yG\331\006r\022y\030\213"
+	.ascii	"\246X\306\304\304|>0\216\235?0\336\365\234qjg\246~\230\025}\256"
+	.ascii	"\245\276\023\025\375+J\375*\274>\225\024}(I}0H}/(\372_\216\372"
+	.ascii	"\001G\300\273\332\316\247v\230n\321{Miq\315t\0304i\f\222\"\215"
+	.ascii	"i\3574"
+	.string	"\032\203\276\034]\316\257v\340\210\032ol7LkP\032\365ee\310L\r\363\244j\330\250\206\303\363\207\206C\263\210\206\30137\343\320\234q\314\2341\216nd#pd\336\320\310!Iufd\311\220\215\034\236D\243\320\f'\2256f\201r\200)\240\00403G\2313\306\207\0239V\336\002y\2501\020K\242l\224$%)\r\007\340\002!\252\316\001\021p\020\021\"\207\242\221P\002!\241\007\270[\265u\200\213\220~X\334\313\356\230\200\025\375e\243=d1\201\360 \300Q\225Y\270\230\\\212\261\246l\252(s\354<r\366\343\230\242j\3440\303\336\310\277\001\276\325\253\032\320\033\277\377W0i\226Q\226\302z4\363'\251\247ThTEjTEjTe\361US,\201TK\b,\343 %\234\033\221\361\327\343\207\317\273\335\305\310\277\241#\376\256>\020\335\177\336\337\341\256n*\273'\327\302 \364\304\320"
+	.ascii	"\n)\201\254f\207j\243\374\347\325\241\373f^\ft\263H\001\202\252"
+	.ascii	"\211\234\210z\230\t!\316\306]4\206n\301\363\\k#\024\306\340\013"
+	.ascii	"\313\341&\242\n"
+	.text
+	.section	.gnu.lto_.refs.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"E\t"
+	.string	"\246\331A.PK\223t\224hgfffffffff\206\342\203\362\030\032\306q\260d\232\221\321Z\373~n\263\277u[\273\ti\244\021\262\267L\0010"
+	.string	"5"
+	.string	":"
+	.string	"\313\247\304\027G\340\217\273\035\371\215|\006\373E\353M\373\004\373d\257(\337\325\244}\005\325\324\021\330\331\275r\277\260\247{\274?\274\357\356\366n\337\207\257\373\344\276wC\231\001\370\244\371\264<:w\235c\250\277\220\375\207\374-d\247\200?\001_B\366\b\370\020\262;\3407\300o\310\316\220}\221=)\35663\314,m\037\270\225\250\257\250'Q\307h\003iU\240'\002\035#\375\"\275\221\016P\002\032\340n,\335I\364\206\2413\220\236\320\267GO\240W\217^h\007{\361\364\346\351\314\323\227\247\001;\334\203\203\316\001\236@^\341\243:E\237kH\247\374\346\fn\346\334Ku\325\236\332\261\375\272`\235\316\335\262\257\254\002\365\352\253>\366\333\023$\004\035[\017\n"
+	.ascii	"/+d\017\327\241k^\316%\373\033V3c\3046\013@\030sx;\023\350\300"
+	.ascii	"\321\001"
+	.text
+	.section	.gnu.lto_.decls.48d0867c8050f5d8,"e",@progbits
+	.string	"(\265/\375`\016LeQ\001\252GJ~U \fQ9\351\024(<\364\350\301}\032\222\214\367\274\272x\272\320\211\026\025\331\300y\306\0168j\236xa\340\004\363\334\360\314\255\246V\221\305n\305\211\215^]\344f\031\262\n\255\0266\312\211\215^N\220"
+	.string	"\236E\364jb'\207>q+\204yukB\366\226;\005\321\006\351\007"
+	.ascii	"\bc\356\275e\203o\337\360\355\025|\273Jt\326(*\370\307\206\341"
+	.ascii	"\333%\270*+\321y\313\003\327\265)hh2\230v4\032S\377\254\325y"
+	.ascii	"\241\343\254l\210]\223.}\317\001\330\234\256\262~r\265\nW\245"
+	.ascii	"v5\241c\326R\352\262\313Z\371\253\314\036<\030\341\274\27060"
+	.ascii	"\316{\373\002\377\035\205LJV2\243/Y;\251x\025\216\352\001auP"
+	.ascii	"z\254\305\352\262\311:\314\rX\325S\323\225\263\222\254\237T\275"
+	.ascii	"\007\244Qz0\362\340a\304\216\2667|\337s\360\333\r~\327\3417\034"
+	.ascii	"\376\273I39\343\206H\220\366\352\257f\241\227\324e3\371\253\224"
+	.ascii	"\356\3022\226\344j\215\313\007\231\022\25353&\215\344jAN\312"
+	.ascii	"\214\304\204\330\2130\017\246\224\226\"Hzn\315\265\350|\213\301"
+	.ascii	"o0\370\375\206\337n\370\357-#>V\272\334d\351\333\243\203\004"
+	.ascii	"1\r\345\254\344\213\335\221.R\227m\304H\017i\"\025\256\310\r"
+	.ascii	"[\332\345\234=l\360p\255\350i\275\235M\244\257*\317\024\2272"
+	.ascii	"-}\337\\\360\253\033,/]\255\325B:\253.;\310\337T\315\343\355"
+	.ascii	"\243\257\202\314\234\261\336\272\2024\220\276\nbR\346(\023n7"
+	.ascii	"\342\030y\360`\204\"\204\016\276\357&\370\335\205\273\252\255"
+	.ascii	"\352rC\377\300+\322$\325\367]\004\253 \347\272\341\254{{u\303"
+	.ascii	"\371\016\202\337V8D-:\317\336\241\001v\332re\254u\364\324\034"
+	.ascii	"01\\}{\252\332\351\031\266,\312\002d\350\354\344\324\231\325"
+	.ascii	"Ic\227\263\362\177KuT\343h\033}\243s\324eO5\324\233F\327\030"
+	.ascii	"\341AOU6\025\317*\273x\250h\261\261s\363W)o\252^\020\323PvjZ"
+	.ascii	"\323\225\263\362u\316/\342=U\351T=\253\\\3030\244\250\261\313"
+	.ascii	"Y\t\244e\007\016J\320\255\312Zt\032U\242\363=CF5r\305J[\337W"
+	.ascii	";\370\177\303\350\027\375T\227\035\243\235\232\276t\265\213f"
+	.ascii	"\nr\032\312NZa\272\310:F\275\323LAN\312,\305\243\005\306F\227"
+	.ascii	"^\316\331\310\203\007\017?[\306\360\254\360}\225\303\257\\\360"
+	.ascii	"\353\032\256{\235\353\362m\235\274\317I\231\317r\316B\325H\013"
+	.ascii	"I#}_\253`\0269\347\\\337v\362\354\355\355\355\325\267\235\257"
+	.ascii	"g\370U\211_\301\360+\022|\273Zt\276^\341\n\247\306\251K\rj\336"
+	.ascii	"+\230\352\346&\2232+sV\n\365\226\2354)}_u\340W\rN\273\267W58"
+	.ascii	"_\245\360P-:k\233jW\227\027\324\273\217\360\3406i&\004t\347\311"
+	.ascii	"\035:}_c\340\327\013\316\272W/8_\231\360_\327\\ \244\324A#H]"
+	.ascii	"\0079g\232\300\324\320\361\210u\321\252\322\267\322u\235\253"
+	.ascii	"i^\351*\232\217\360\340"
+	.string	"?Ny,ge\245\27393\325J\200\240Z\t`\266%a\222r\336\247\340\214\231\336r\003\362\324\267\2261j\034N\326\320\364\275\020\377\225\214\034P\221=\245\231\334_\305\32415\316\267F7\305\244\357_\303\274\306\375\025\256\232]\255\2614\364\230\273\037z}\177*\321\331X\265\350\314\240\022\235\025\214\210\3270Dg\024\2252W\3119\013\331\265./\352\364\355Jt\376\365\313_\305\352X\335b\237\240\260r\225\234\225\027~\260\206x\311\350\373jvVE\304\025\037dS\302\326\244P\341\252P\224Y\310~\021V~\230\375\"\252 \371k\227\252\245\276U\266\352V[\250\\\352Zm\253^\352\262n\371k\226\252\366\253\314\331)\347|\016\376\n\245\354J\225\202v\265 _\316ndk9\347\327\261_\304_\243T\262\272\245\246]\215C\214\234\335\214`Hf\231rC/\347\354\301\310\203\007\0175H\035\272$"
+	.string	"\270\255\254Eg\207Jt\276b\271"
+	.string	"\230\262\007\307"
+	.string	"\377\002\374"
+	.string	"\340k\300\317\200\177\001?\b\337\007\037\343\241Jt\036\256\026\2357\361\033_\242\023\203Zt^Y\213N\\\211N\213\357\305\016W\264\371\255\003X\374M\002\273\342\377\235Z\243\030\260G\016(Np\301\177\311\374\326\303o\021\240\342o%\374\337/\1777\241\370\034\332=\r\364\363\267\220\233\325\200\006\023\371\377\204a\227\t\374\333\003\266\210\252\b\372\357\232F:\341\032~\363\304oI\324\f:HO8\321o\212\360\023\252\030\360\36377\350\020|\3562\371\353\235\306\200=\376\325\316\337$\254\361sKq\215v\020\004\235\343\030\376+\345\357\021\354\t2\250DOS\203\206\376N\301.\375\277S\373\333\003\305\337\n\375m\001\361\267JF\034P\330p\005\374\327\307\377\271\247ak\263\370'\330\341\177\0247s\013\376k\343?\\-\300\226\232\201"
+	.string	"\276V\tP\023\360W\003\374=\302\226\340\267\302\244\337\026"
+	.string	"\351?\233\027k/\310\263)~\213\3767\372\017\202\227y\210\377\252\375m\201U\341o\032U\204\373~\223\310^\240\236!\002\376\375"
+	.ascii	"K\202\377sO\323\303\353\305\362\374~+\201\021X\021\374\225\002"
+	.ascii	" \374\375\201\r\201\005\201\n\316\001\001\277\375\300\377\273"
+	.ascii	"\274\017\340\277r\376\253\301\375\337\322u\376\307]\316n\340"
+	.ascii	"\267\026C_\323\246\360\377\204\003\340\277(\370+\004\376\352"
+	.ascii	"\200\2776\340o\263\377\3677a\374m\346o\272\277\347\376>\363\267"
+	.ascii	"\334\337e\376F\363\267\232\277U`Q\374\275\366w\334\337p\366\304"
+	.ascii	"\377\241\337\364\362W\r*"
+	.string	"\002\376\333\377\222\001\035\360\277\355?\333\177/\377\327\376\267\360\277\313\377-\377\325\376s\371\357v\237\377\036\340\257!\376\312\301_E\374u\304\315\377\202\370\255\211\337b\340\267\023\370\355\003~K\342\267\036\374v\203\337\032\340\267\002\370-\207\337b\370\355\320o\177~\333\363[\374\333\373\267\235\277\355\376f\363w\335\337R\376f\341\357\256\277U\374m\344\357\254\277\253\376\316\361\367\007\376\236\372{\351\357\250\277i\374=\343\357\030\177\303\370{\370\267\213\277\233\376\316\177\253\340\357\024\374\275\342\357\343\337'\370[\351o\341\337H\177\243\177\007\377\006\376=\202\277C\360\367\006\3766\3617\n\177\233\360w\t\177W\340o\b\374-\3647\211\277\326\277\206\360\367\007\177w\360\367\375{\304\177\024\377\347\376\307\375/\363w\210\277?\374}\200\277\013\360\267\001\376\276\340o\013\376\336\360\267\206\277\213\376&\372\033\303\377\023\376\337\375\317\373\253"
+	.string	"\376\036\372\333\374\273\377*\302_K\3745\002\177\365\340\377\211\277z\370+"
+	.string	"\376Z\364\277\356\277\232\377i\376\233\371/\367\377\355\277\t\377K\360\377\313\177\016{{{{\277\217\313\377\223\366\177"
+	.ascii	"\fRNY;\236\316\262\244.<\235e\345\244\223\222\344\205\250\234"
+	.ascii	"\225|:\313\371\202\223S2\004,\251\2473\246|\341\351,Ke\027rR"
+	.ascii	"5+\263\222\331\t+_\310N\231)\237aIa\360\344\224%\365t\306$u\341"
+	.ascii	"\351,K*\237e\345\241\354\304\024\025\303)G]\310gYw\371\fKj\350"
+	.ascii	"\351\fK\352\351,+\254\252\211\241F\357F\013H\210$\251wON\271"
+	.ascii	"\006\215*\246\250!\270'%V\236\313\271Vy\221\2432\\\316\005\310"
+	.ascii	"\271\n+j\216iG]k"
+	.string	"\202\253\321\204\205\t\253*s\316\033h4iae'\270d\315pO_X9\1775%e\0329\347\334AR\t\227\215T\270d\220\252\f\365\"\347"
+	.ascii	"de\3164rN\326\f\227sN\346\234y\242\252\2249\367\030z\352\242"
+	.ascii	"A#g*#\032\271*\311\366\"\347\256\222fM\352\351L\013K\004\333"
+	.ascii	"\224\263\256\fC\231\254OPX\271+\317eE\341\263dY\206\3129W7\270"
+	.ascii	"K\352\006^\337"
+	.string	"\013v\263\370\340\362\244\357\201\214\340\333\244\n\035\235\253\034}\017\244\003\337/3\214\227\331]\337\003\311\300\227\205\036\265+TRo\272\272\274B\220%\345\326\364\240\336\324\226}\377\263\206\353*9\227]\202\b\351{\223(\317r\316\033*\033+:m}\377\343\005\307]\261Cr\217\324\345\335:\333\262\312k$(\251\314Rg\f#?V~\300\200q\336\377\026\3715\002G\202\234\317\262\0249b\327\367\022\021\361[\344\001[A\302\372\332+D\210EC\2022'\203lx]\301\377\305\372\r\362_ 7\353j\t\321\275\231I\366U\216\345\234\205|lt\230\344\350[\341j\321\311\241\022\235\367J\304/\026\317\021 d[}-\250D\247\225\325u\321\023\345\243\3224\306.GQm\320XLA\326\230\371\360\235qcU\245\357\177\236t\270<\224B?L:\262\304\365\375O\027\336\361\272\274;\256\013\363)3\261\240"
+	.ascii	"\2612%\370\2779\2267G\225\223\"\361\344\316\b\376/\016\213\206"
+	.ascii	"\016YS\337\327'\365N\325\345\235\252f|O9\337P\200\030\233\334"
+	.ascii	"\232^\216\212\332\340?4\360\177\245~\243\312t9i\352k\303G\244"
+	.ascii	"\356nL\337\373\330\301\257d0zt=]-\310i(\317h\342\321ug\334\032"
+	.ascii	"\227F]^\250\033c\354B]\031'\031\037Wkz\036\204\230\264\222\030"
+	.ascii	"\301\367>t\360}\356\360}\332\340\373\254\301\377}q]\374\324\251"
+	.ascii	"qqq\235\256\035cB\204\255\357}\344\360\177\233nfr\206\013T\337"
+	.ascii	"\233{i\3470\255\351J\273\271\257T\275\nWd\002cl\354\035\273w"
+	.ascii	"\223\227\251.o\266tn\353X;\235vs[\251qAN\312\234<\327\334\211"
+	.ascii	"\335\241rsW9\271\222bw\364rV\n\371\230\022v\326s\201\224\265"
+	.ascii	"\350\254n\225\350\274\317\023,\207'\215\325\034\251\276\367\351"
+	.ascii	"\302\255\326k[\356\302\276\332X=[g\335X;{g\343\3307\226\316\252"
+	.ascii	"\261ll\032\013\307\342\3315ui\363l\327;\255\261\264[\227i:[\026"
+	.ascii	"\205\257\270\350\001f\311\320\240\272rV\272u\232\326c\322\352"
+	.ascii	"\260Ej\016\230\206\253pT9y\327a\013[\330\227\036\024\233g\241"
+	.ascii	"d\027e\n`\363\n\373\322#S\351Nx\205}\201\345\254t\313k\271Jg"
+	.ascii	"\225]<S\204Tu\226\333<;\327]*\\\225\234od\320\226\f\373\322\263"
+	.ascii	"y}\307&!\361\"\312\002Bj\330\345\234\363l\024\213\206C\323S\316"
+	.ascii	"S\035\260Iu\013\177\273y\351/\025\216*3%;\330\022\027\366\245"
+	.ascii	"\327sl^\243\331\260\263J\362,\227uB\342E\224\257\006\032\215"
+	.ascii	"\226\363\367\034\233\327tr\226\352`K2\354\253G*\354\315\035\006"
+	.ascii	"\367=s\260=\263A(\b\021&3}\337\223\006+\255\024\253\354\032\241"
+	.ascii	"\251\206\2345c\311\324\245-\343d\313\3303\353F\342ET\006\232"
+	.ascii	"h\330\225\261q\007\303\241\351)3\001\t\341%g\211\230;\245\210"
+	.ascii	"\227+|\337\303\205\337<\3266T\270\"\023`\341\nY\333\023;7\213"
+	.ascii	"f\32584=a\300\r\213\235\226\267\005\371r\316\252\322\305%\314"
+	.ascii	"nK\207\nW%\204\2651\016\254\233\355\3626%`v\326\315\262m8\215"
+	.ascii	"\030\341\322\323\023c\341\254\027\033\306~\261`\354\030\373V"
+	.ascii	"\227\326\315\266\340\301\234\202\246G\007\303\275/\r\276\217"
+	.ascii	"\f\276\357\013\276o\013\276\317\n\276O\n\276O\f\337\347\225\345"
+	.ascii	"UJwaI\266\221\263\321\367>\254+\026K]\332\245\2452\305\246\005"
+	.ascii	"Y\323\265\264Vl\032\2065tD\252\364l\0265o\320\316{<\006\3776"
+	.ascii	"\255\212\317\0352\253;U,\225 (\\PA\372\036S\301\307J|\374\004"
+	.ascii	"\037\263\200\177kv+\245\341H`\246\305\370\002\243\257-\023qk"
+	.ascii	"\346\242\b\324T_\r*\321y\274\205\217\207\340c\037bv,\f'1S\305"
+	.ascii	"\245\357\361\013\26102U\362\334\223\333\260\2639\323$\273\314"
+	.ascii	"\331\263M\276\352\350`\343\352{\2364\370ui\231\330\257\345W\f"
+	.ascii	",Kn\277\376\021\036T\272\237\314\341g\016\03018\372\036\216e"
+	.ascii	"\341\277/\350\f\024\265-}\177\313\202W\020\r\271\234\345e\273"
+	.ascii	"|q\346\354\210\365=O\034>\317\033\016Q\211N$j\310vL\351{\236"
+	.ascii	",F\354\221\272\264[\266\311\310n\365\236\245\263\333\262N\226"
+	.ascii	"H\205\243\032\312Nl\354\330\325)]\356\340\235\227\312\006\251"
+	.ascii	"\353\032b\205\330\"ui\211\334\022\261.l\215\240\344\205\234\207"
+	.ascii	"\324\351\"bmX\035AN\312<u\266\311y8\364<\370@\t\261J\342\373"
+	.ascii	"\337fY\255\272\264A,\020#\016\252,V\205\243R\346\251\240+Xy8"
+	.ascii	"\364\306\202X\036\326\007\207\246'\022\270\250\261\303[\216p"
+	.ascii	"1r\336\363\230\341\337b]\305P[\202\306\312\376\350\311A\005\307"
+	.ascii	"\245\357y\232`\253\327\032^.\276\364=O\022\374\272\374\032\333"
+	.ascii	"\343l\356\026\030\035d}\317S\004\237\007\b>\217\025>\007V\207"
+	.ascii	"\215\2627*\\\225\020\304\260\261\2639\354\216\272\264:,\016\253"
+	.ascii	"\303\276xkc\027\304\265D\214\354\274\347\221\302\327\211\023"
+	.ascii	"\2250}\355\224\225\312@@l\254\332\276\372\236\007\006>O\306?"
+	.ascii	"\353\340\377\026\312\322\250K[\303\3160R\346\214\245\206\205"
+	.ascii	"aephz*\341\307\034\273\234\225#<\2605\354\213\212\027\224Tf\033"
+	.ascii	">\\]y8\364rV\032y\360\300\023DK\224#\347\375\311\206\177+\303"
+	.ascii	"\306\260<\236\226u\224f\013Te\222\324\245}\262M\312l\344\223"
+	.ascii	"FFf\323\367\247\025\374\323\f\377|\202\177"
+	.string	"v\341\237AlR\210J\026\024\260\276?{\330|N\341\2375\360O\030\370g\306_\253Eg\236\221\320\r+*O}o\252\301\347@M\263\261eQ\330\n\021.\273\234\225o:N]6\234n\003\247\355\332M\205\253\222\231nd\220\227\331L\001Y\321\243\243\343\274w\215'4#\t\214\255$wf\026\276I\243\256\327\364\024\332\0213Yw\347\340_4=W\311\304\231\023\243\357\257\033n3}\246.\033\315\257\031V>\313Y\td\231t\204Q\353\373\332\341\024\352p\376\252\341_4\374\013\206?W\213\316\026\323c\336p\035&7\\\007X935\234P\235\234\231\204j%@\255\004\270aZ\\V\316\373\273\004\377\016\301\177\277\275\277\274\342\221 k\270\360\026u\325w\204\210\367\333\t\306\005\210\234\276\277W\370p\225\350\274^-:\333\276\\D\371\352\373;cK]6\227f\373m.\255\245\312U\270*\331"
+	.string	"iWk`\325\307\227\246}o$%\344\037rn\335\03197\205P6\315\345L\325\001"
+	.string	"Z\364\314\212\374\334\372yd\204\007o\233\300\035\2630#\277\257\323\302\300!\353{\243\030\370pN\"N\350\3148CDK\f\307\020$}\257a\016\276\0068XX\247\026\215 . 5\360\316\254\237Zj@\346x\020\351{\002\3210\367\343G\215\2535\237e\234\026\224\276\327"
+	.ascii	"\006\307\317\0368\316\252\n\247*3\025V\022\357"
+	.string	""
+	.string	"Wot\300\364\362SU\007\244!W`|\374\254\002s\356\241\255e\235T?y\374>\0364f\276\230\365\275\206 \370\324\361s\307\3573}\334P\363\325\367\032\256\360\177\346\370}?E\300\210\301\353{\r<\3605LMM\3357#,\333\006/\317\rL\350\310\230\0330dj\3248\243\252Y\266\241\201d\036\030\260\234\251:\330\260\030g\256N\033?\243\200\340\240\301A\251\022c\243\316\234/PP\367-\003\031^\234(\0365\\d\224}\2352N\031\347S\035R6\231\201\302\3112\034_F\316\027\347\213\363\251\232e\033\325\314\214\2535\017\230)\301;a\374|R\243\222&n\313\217\275\275\323\351\326)\377\310\322\2253U\007\023\216F\233%g\323O\247\237\"YqE\372\236\371d\262l\266\354|\234Lg\322wDn\207\230\036\256<:\271\213&\344\n\234\036}\017"
+	.ascii	"'\214\207g\3321\302\262uj/\302\364r\246\352\340\323\345\204M"
+	.ascii	"S\336M;7\353\004\341b\3161\351\374>_\335\333\027"
+	.string	"2}_d\007\233z\246\234\377\276\363\214\216<!}\337Ey\032\370\366\222l\362\372\376]t\220(\351k\2761\343\340\033sgnqL8\f\240S\"\306G\207\225\304\213\0333;\226knj\034\024\032<\236\372\276\210\213\235]\2153R\346$\007'@\200dT\351\365\350\373\2424\374\233lL6\227I\017\345\254\025e-GQmP\345\350\220\332\352\373\2420\264\233YL4\263NDSfR\202\001\031\233Y\266D\t\214\276jx\230\320\234\361\322\367EI\260\251f\262A\251\223bjQ\323f\266P\341\212L\240\311\030\021\366\205\271\306\241\351\211\204\2612\246\0273\256\302Q\re\247,zvn\3142&\227\260\2713f\032\223\316Dc\2221\315\230sui\2261\335\3142\346\026:\273\234\225Bo\304\250\354\030\272j_\303\241\351\211\004(\246\\]\232q7\342\300\2143\337\3141>K\2744x\033<"
+	.ascii	"\341\225\231\363q\336\337\034#&\b\213\222\210\233\276f\030\036"
+	.ascii	"\252\035_"
+	.string	"\\\364}\021\r\374\233_\352\322\004\203\341\200\261\321Y\363\337\347\323\302\021-1}_$\003\277\310\t?C\236\331\005\233\261\263\022\323\367\031\356\3603\254\301\317p\006?C\034~\0060\3707\331\326\316\336\336\210Y\253xa\240\232\372>\203\0336\257\230K\241\260\265!W\372\336\304\362\337w\302\2211W\372^+\375\205\253\213F\337\233iAsJ\322\312\372\336\254re\357\r\217\276&\025\374\"\203\025\rz\254\262\\\371\230r\223\312o2\351\270\025\366\354\344\365\255p\"nN\361\021\323\305.J\337gpb~\33543\277L)\035\250\362\224\002\310\356\2526\260g\\\\\350\365U:]\271\245\311\351kB1\225f\331\357\363m\201\"S\325\367\031\270\360\315(\377}=E\344\2220\351\333\365m\2479v\223\354\367\361\214E9\245\365}\206#\370f\230)\366\373\254\0350[b\364}\206,|\363\311\177\337\n\324"
+	.ascii	"y\322\327\004\303/2\334\320\300\227\306l\315V\223\233`\277\351"
+	.ascii	"\244\316i8\022@\371\240j\3237\250\022\235&\023\0217\2334W\225"
+	.ascii	"/_\372\002U\242\363Dr\260\311\202\311Bn\301\222\341\261\251\365"
+	.ascii	"=Q\233\255-\263\353\334R&\267\006vb\201\022\273\301u\263\253"
+	.ascii	"\212\231\251\033\242\204\347\305\327\r4%IL\0342\336\330\260a"
+	.ascii	"\311\324y\341Brc`\3313c\027%H\020\323\b\224\0362e^bEn\032\261"
+	.ascii	"_\262\300\201\323\327$\202\301\350\262\354\3645\207\bAb\3760"
+	.ascii	"\177\230Y\017X\262\325\345\353b\203\2434\201\334\314\332\253"
+	.ascii	"c\033\353kb]"
+	.string	"\315,\023\302&\327\327\274\272\232P\226\262\271\255\253U&Y\236X\351{\242\036\346\016s\207Y\345\266\244\207]\022\250\031z>nV\3358.h 1\201\352`\351P\323\303\344\001\304\005\223\270\353\224\241\310y\322\327\244\"\2022q\2308\314\034\276\274\323\213M\350\315m\f\0313\307\325\250\266\242\372\036C\035\374\233S\257Ks\352>12\313I\0365/\261;\366K\336\235 }\217A\017\337\254Q\315\250\250[U\243\360\024)cv<U\304L\255\301\257\267\352\374\006\325\244A\343m$\210\240Ev\016\021\262w\245\3571\304\341\337\234\361\2724g4\232}\312Y*\003'R\270H\013-\364=\20673\206\031\343\222\205\001\342;\0226\026\246\3571\230\341W4\325\204a\302\250tU\231mdp\022\347\266\301O\0235cq\372\036\203\027\376M\027.\256v\207\362\214&+]G\360\315d5\233\314\246\253\325("
+	.ascii	"\300\220r\305\316\007n\003\3240y1\350\372\376f^\232\371:\261"
+	.ascii	"O\231IK\001O\3300\310\300\377\275s\3472\351\311XNk\215]\016\034"
+	.ascii	"p\344\372\376\202\0349rn\035\2436\\'\216\226\036\235\337:lz\216"
+	.ascii	"\016\020\266\276wN\325\263J\003\313\321\367p*\336\177\237\251"
+	.ascii	"\025\247N\255\357/\324\301\271yp\356[\2348Q\312\314*XS>\372\376"
+	.ascii	"\302\022\377\002\0217n*^5\3136zb$\205\3424\261\332\352\373\013"
+	.ascii	">\332\334\2736wigw\227\347\016/\2715\260LE\325A\350\214\035\032"
+	.ascii	"\224\276\277\020\003\177\310N\315]\243\346\222\2359W%\226\215"
+	.ascii	"\250L\025\325\241\256\356\222\341\244\221\027\251\352\203\205"
+	.ascii	"7\260\276\037\232\303\037\362\202\377K\267\274tU\257\003\026"
+	.ascii	"\023S\006N\356\260\226\333\017\027}?\224\206\006\315%\363\301"
+	.ascii	"6\364e\306\314\333j\024\246\322\224f\007\004\377\227\314\362"
+	.ascii	"\222\271\032\t\331E\031\211'\311\274\301\207j\300\301\335\270"
+	.ascii	"\017\345\234\233r\376Qu\336\360\212\352\020\367\266\313$\r\231"
+	.ascii	"W\337\013\255\021\363\272\274b\356\222\0169O=\200\314\253\307"
+	.ascii	"\r\026\256\334\367Be\334\276\\0\225n\002M9\377(r^\001\021r\363"
+	.ascii	"\342\345\276\325\034\005\347\274\242\352p\246\275\330\232\323"
+	.ascii	"\367\315\347\265D\013\252\357\205\310\360\205\270\360\177\271"
+	.ascii	"\274./\227\333\345\232\345d\020\232\032\325\006\276\030g\222"
+	.ascii	",\373\336\266\013\005\307\013(}/d\205/\244\003\377W\213\226\212"
+	.ascii	"g\204\225\304\303 \212W\036\030\275\234\33560\325\244\354\360"
+	.ascii	"\352\373 5\370\277jY\356\332\355\201\223Q\370\n\227\f\2736\374"
+	.ascii	" \262+W\356\262\346\2343UN\336y"
+	.string	"p\227\224[\323\303\362\273\f\032k\263\223\323\367pn\217\377\276_\333\021\275\276\017\272\302\257t\365\246-oZ\2453\312I7\030\210I)7xP\214(\217r\251\340\234sR\231m\3246 rk`w\312/\225\2362M\206\334\351{\315.\332\177_\327}9\323\244\357\177\321\316z\256\304\321\333R\313\b\231\311\302\346K\337+\345\226\331\263\034a\254\372^\245\257l\f\017\261\276\352z\203$\331\367@k\360o\330\025\373\035\373\035\273d\235s\316]<T\264\354\330e\252\250\016\377\341\374\222\231r_J\254\364=\020\027\374\277\276\37733E\345\234\247Le\216j\3729\377\372j\326\332\341\007\252\266\026\340\377\315\331\001&(s\023\030$9\347\372\006/Qc\362\201A6\341rv\312JN +)\2608LaZ\320b\270$L\207H\023R!Qx$\002\205G@\023E\024G\0245\"\241GC)zb"
+	.ascii	"&\b\026\207Dd\206'}\320\200a8D\022\211E\"\3171E.\375\210\302"
+	.ascii	"t(D\252\360\373\005\035S\344\322\035A\004"
+	.string	"\246\300\037\240\317\223>\034\207C`0)\005*\201XQ4&\245E\"O\n :\274\351\221X\f\232)R\242\3208<\237\364\341\202\026I\351\020\210\222p,\341x\004.)\025\203C<O\372`DY\b\225@ \021\205\0348BY\bG8\n}\216\305`\017\213\242qi\t\370#\n\217=\033\216G4\030\004\236\"\340"
+	.string	"\004\"F`\026Q\024"
+	.string	"E\002\032Q\025 \004\203\300\236\026K\305\022A\351\223> -\201@Z\"\n\022\221#\370\020S\264y\374!-\375\244?\"\322\222IDZ\262I)\022\021\035\236\350\n\302\343m\261T\f^c\272d\017\324\302\230\036\205H\250\211\037\206#\224\347\b=\"\357\221\347\300\024x\224\242G\324\370CZ\372\020\364CS\340pI\tE\201\264\264!MB\022\032\227R8\n}-\216\212\024(\242HJ\215@\0216\240d,\2468\022\201F\024@\244\0060x"
+	.string	"\005\023)z\002\251$\274\220\242H@\351P\210\342X,\221\242HB\301 \320*!O\240JB\024\301 \260'%\"\213%|\224\220'\202A\340\251\204<\221\242G\324\004RI\250\341\230\002\021\030\034\n\006\201\277`\212\363\003\307\240!%4=\2668\361\033B\215\310\037\001\240'R\364\230\"E\006H@*\t\017\200D\024*\031\201>\027\214xB|H\215\300\245\017\251\220X\002RI\030tT4A(\003\212\034\0027\200\016\201\301\023)\006\243\261X\002\035\246i\321\230\204\"\210\001\366A\"\n\217\200(\t'P\250@\tGCd1\351\030\200\020\037\216\320\025\204C\2400\025\022\205@\351\371\244\017\301\237\021Dp"
+	.string	"G$\340p\0044\005\246\307\236\"\021\037P%!\212\024L(\341\210,\nU\240\306%\rJ\302\364(\002\232\002\207\310\340\020x\301\021\232t\024\016U"
+	.string	"\246G\021\216%x"
+	.string	"\005\023JE\343\b\032\260\300\004\232\"\227\224\214\036\024\032Q\"\212\204\337\301\007\013\370\200\004\013\236\223h@\210\006\2048O\242\001\"D4\340\003\021\370\037\210\260i\232\376\216\350\020\211\b\202\021\035\"E@\217\220\2510M\201E)zL\221\242x\246?c\232\002\211L\020,b"
+	.string	"\251$\004BQc\212# \232\204\323\337\b\016\322\3371\005TI\230\342\023\324\024h\202\361>\210\302\t:\005z\364\373\245B\037\250\277\245\024\276\016T\017\324\236'}0\242C\264"
+	.ascii	"\307_0\b4\323'}8@JD\225\204R\241\037\317\223>\244A\2441=\216"
+	.ascii	"8\376X\240)R\351\202\t\202\305\341\357w\246Dd1\370\373\361\030"
+	.ascii	"Q\342\212\342\357\307s4\242G$\361\367\303GD\241\t~\277\363H\024"
+	.ascii	".\035\177?\236!\372\373\371\322_z\024\016\207\236\364\341\210"
+	.ascii	".\265H\027p\204\032\201I\307\005\2008\246B\025@ \211H\013`\201"
+	.ascii	"$\n\207\013\350\340\203\337\007$X\200@\217\220\303 Q\b\302xD"
+	.ascii	"\202`@\312\002%\016\201D#\232\022\205\277# jLJ\227~?\r*P\343"
+	.ascii	"\322\357w\246G\341\360\367;\201)\360\350\367;\321\025\204\307"
+	.ascii	"\337\3574A\2608\274A\324\370\353I\205\304\022\210#\244B\242\360"
+	.ascii	"4\246(\004\211\310\021\216\200\250\211`\020\204\f\307\237\n4"
+	.ascii	"\204`\020\210\211#\034\001Q\343\231\036\177\302\245\023)\320"
+	.ascii	"\020\320\245\026(~%\240p\302\007\r\022\201\351\221(\304\351/"
+	.ascii	"\003%\\\242\020\005\3421x\n\227\216\366\370+1\242\004\237\022"
+	.ascii	"#J\360\235\301\021B\373\244\017G\244\n\033\216?\023\216\206\214"
+	.ascii	"hz\004*\235\307#j<:\002\362\240*\200\303\023\310%%\214\374\251"
+	.ascii	"@\217\216H\025\360\361\207\006\205*\320\020\216H\025|\320\037"
+	.ascii	"\272\324\002\305\021\251\202\017]j\221\036\221*\360\034\221*"
+	.ascii	"\330\n\210\370\005\203\300s\005\320D\211\020@8\323'}@.)\375\212"
+	.ascii	"\306\026"
+	.string	"H\301 \020\304\321\210\252\020\032\217\022\200\376L\204\360 \304\007\310%%\242#j\3549\3762\240'\220KJ>g:D\036Q\023\304\2420\r\242)\032\002rI\t\003\372#\"\t\207\300\237\261x$\242\307 \"\222p\bB0\b\304-\216\200\250\t`\n<\362\031\217)~IH\302\244_0\b\3741\002\223\202\027=*\226 \026\205G\241\n\324\370cD\207Ca\2123}\322\207cR\nT\n\200R=\376~K)\210X\b\215)\320\204\264h\fR\201\036\331\025H@S\240\tt\270\244\004<\376\224\b\001\204`\020x\242Ab\006\322#\020\305@\n\302\021\232\002\217\226R\030\242\301 \bG\341\006TI\230\022\221&\220JB\f\307\037\2220\005\261X\002\251$\364Y\022\232\340\247\024<:\321!\022\021\370\033\016\201JG\237\025\225EmQW\250+\200F\373$\243\341\260h\274I\301T\270d\362\254"
+	.string	"\266\260G\0249\004\2528\217?`\n\f\201X\024\246\310a\361\304q\t\351B\372\244\017\307%$\020Ea\006\245\022\351\020h\036\177\304\2420\005\006\213\0308.!\001\245\300\241M\177#8H\211B\036bqh\223\206C{\304\301\021\212.\035y\216Pt\351\204\017z4\"\213%\216\210\310\242\021\351'\375} \"%\n\221x\251x\224t\323\037\211\224(D\362\244\300\023JH\3429,\026)\3603\217i\020yT4\242@,\n\211F4\005\"O\200\341I\037\214\3054\210\252"
+	.string	"A,*)\025\203\026\274\270\204\032A\244\305\242\021\204\317E\210(\201A\n'T"
+	.ascii	"\007? \225\204 \322$$\3410\005\b\242\020\250\004\"h<\202\370"
+	.ascii	"\240a\305\212f\261\242[\254\350\025V4\013\026\335\202E\257\300"
+	.ascii	"\242[\264\350\025Z\364\n+\364\377S\316\030\020\027\225\2531z"
+	.ascii	"7NHK\t\231Z\336\271\005\244\254\352\242%\316\251\345\314\221"
+	.ascii	"=1p\230@\3118s\362\346.\317;xhln\356\223\240#\\J\252\360.\025"
+	.ascii	"\223J\210\023\232\273.VO;\266\372\276.O\273\373F\001<(!m\242"
+	.ascii	"\346\260\204@\261\351\341\003\306\254N\227\345\325\316\272\262"
+	.ascii	"\256\234\363\320O\2327\313*}\277\341\f\377\247\232\273\304\203"
+	.ascii	"\336\0203\345\027\025\2603tg\025\317\024\275,SsZK\230\300\366"
+	.ascii	"N4Uo\207\013:W\372\236eN3?\317\374<\323\347\031\273\267w\222"
+	.ascii	"\225\241r\222\271U8\215\r\334\f\271\023\013P\216"
+	.string	":.b\342~\311\322x\024\321:\341\316\247\264\275\273\2721\247\322\215\215^_\0336\266\260\302\\'\025.\256G\222\276J\237\265\037i8\372\236n\247\333\371Vs\324\035\211-w8:\374\247\227\237oj>^\274\250%\251zQ\226P\r\351\373\rE\360\177\266`\332\271s\304\316\232\263\313\351d\205\303EY\333e\322D\311\016).\246\224)Y\312\340\365\315\362g9\265\030a\331:\267\027a\247\2322L{'\333O-l\310\340}I\365=\327~\320\320\345\205\365=\325N\246\037J\"`6\3440\373yfvb\271\361\345m\b\226\275\264\237X~^\251-$kX\261rV9\275\204\252\274\324\361A\005H\354G\327\032*S\202\230\342\310\236\240\335$J\236(V32\332)\3057\005\203km\003\023\024(\247\222L\230\2535=; uB\242\374T\346Xc\365\302\350.,\354\0343\"c\201(\357"
+	.ascii	"r\212\375\034\243\023\307\n\223\276\207\343\2739\330\304\302"
+	.ascii	"\2609\371\t\346\344dR\315\262\r\036/1-*\260\374D"
+	.string	"\325\241\341\210\311\2302\226\344\247\2223\311\311\244\212g\307\226\026\225^~\242\352 \224\344\013\235\025\013?\231\374\374\022\362R6\303G\337\237Kz\226\b9s\322\367\0130\323!%\325\367pN\257\240(9Ru^g\327\017!5\354\031SJ\234;2}\271\276\001\350\314\035\232\232\276\2676\264\\\254\005\204\366\250\263\241cbH.\312Q \2121\305\024S$D\333t\343\024@ @L\032\226M(\214{\023@\203\f\355\204\201\234F\231S3#\"I\222J\246\003\246H"
+	.string	"\370\222\002^\330\352N\233\350\231\201\242"
+	.string	"\224\342\270\033\335\271\017\330\263\n\322n\361'\032\3167\350k\3023\364\347\177\334\322?\367\330\224\351\024,\317LEN\231\265\321U\352\200\220g\3517"
+	.ascii	"\255\2332\222z~\310\240 \317\331\230\204\365\342\016p\340h"
+	.string	"\033Y\260\231N\274(-.[\371AYN\254\016\271\266\005\306\270\033\026o\321\207L\005T~O%\374\321#y\352gQ\252\366\356/;\257\321\306B\211\302\367\264\271;\344\004\004(#'%F\f\032\255\203\023\266+\2409\362\360\023\021+\322n~\362!\026\233\251\006o\006\361\242\260\013\333\226a\367dg:\f\270\244\223\221\027\373d\306T\336\226P)\200\216z$\244\331?\272Q\232\371\024\333\213\375\372C\264Bf.\207\021S\027\214\215s_JP\206\274\253g\347\016\320z\233\250\017\224\303u,a\305\264g\020l|I\304\025\263]\316\227\034\007\"\375\214\233\002\030\020\322u\316\fDZ\321|\366\255\307[\005\206\327\304E,\006\364RW\023K\345&H&t\004\032J?R0sX\034\004\313\002\205\315Eb\270\372\237Zsvl\201\277\242\305iJM\205I-SR\306\340_S\r\330o\350\307b\032"
+	.ascii	"5\246.\366f\272\356\264\316\353\331\272\362\300\027Eb\252\177"
+	.ascii	"\034\343\177\231\232\335\271\216b\037[\"\365ztc,H6e\355gjR\346"
+	.ascii	"I\321Q0\354\"\202\372:\200\334\315\003\203\272\206\006E\245X"
+	.ascii	"\217\363eY\324\005\001\256\242T`\033J\230\016\022\330|\246\225"
+	.ascii	"\023\357F\373D\230%z A\241y7\310\253\006\317\3244\0340\030\274"
+	.ascii	"\352@\331\261\3237nj\303\330\216\261X%:\020\2606\005<\245\"\237"
+	.ascii	"8\006\342\3438+\347@\376Lp`\332*\025m\301\334u\"%\214\246h\271"
+	.ascii	"\r\354f\022\2658W\243\302\n\3462y9\217\037\342`\025\013\004\353"
+	.ascii	"\241\333^\251@1\2122B\224\255)\252\007n\255;O\f\307\3172j@\354"
+	.ascii	"WP\002q$\264\211\340\352wW\310\345P\347m\024\276\233\"\317\310"
+	.ascii	"\264E&n\236\233\376\351\262\272\300fE2\323 \2774Yv\373=\202&"
+	.ascii	"#\363\003\0257\212)g\300BH(\216\227'\002B\330\252oX\263\322\204"
+	.ascii	"\341\367\220\3547\345\252,^\270\310,b\332\017`\251}*\362P6\031"
+	.ascii	"\227\253\0373\215\023\026\206\320E\342W\212\r\320R\274\3418O"
+	.ascii	"u\246\006y3\"T\227\304\275\366O\033>o\322\006\214\222(\316\376"
+	.ascii	"\327\374`\337\236\214\300\032R.\007\022\255\3057\"?\233\237\005"
+	.ascii	"\332\260;\257\233h\306\311l\361\243\036r\257*4\242\362\305\232"
+	.ascii	"\026\344\177\276v\037&m\311\352\207D\251k\323\214,aJ\n\231u\347"
+	.ascii	"\360\365vY\210\250t\224\233s\00625\215\025\364\337\257\355\261"
+	.ascii	"\263a\374-@\232s\355\314\356[\340\254\003L8\255\325\365\212\r"
+	.ascii	"\257\330dtSKi\363\225\321\351\332XR/\356~\351\213m1\271\312N"
+	.ascii	"\364\354\027]\231\257\303\250\317\205\212`Rr\336x\317\023\203"
+	.ascii	"\272\304\261\233cLM\204mS\214\341J\t\337\214\306e@m\327\177&"
+	.ascii	"\251,\313y\032\356O\302F\230_\374)\207\364\315\232L\272~&u?\305"
+	.ascii	"y3d\212\335s\327_\37707O\207\366"
+	.string	"a\n\226\005\356\212D\357\307\217)#\355\363J\023\260\265\2757)F\217\277\356\212\023\250\266\260P\274#\tz:\007\337\331\333\020\236\312\005%I\357\027%:\006\376R\363\266\210\353w.x\"\320y`\240n\257\340.W\301\337\342\314\366\t\037\300$\342\250V\034\314\3309\340\262v~\321%\367x\310)\363\300\200\335\211\3272f\301\212\350(\345K\324\007\264\030\247\021\242~`m\260\304\303Y\204\253\"s\325\212<\024\330\r\022\013\026o\230C:\251e\020{/\031l\353[\206\262n\030\201\2727\260\362RwP(U\242\305\245\374\016^\244\303`\200E\003\261\352\b\003\211\221Q\210\200\342O]<$\037\365\320yX\311Q\275~K\317\365\362%#\204H\302\323\271<\362\375\025+\273\205\362\370\340\"\301w\301\365\357\004_\244\340\240\2619\235\322\277\226\002f\r!\340\213\314s$\352\001\036\r\3460\254\360a\222"
+	.string	"\f\r\214%!\213z\332s;\034V\005\236\234\3249\363t3h^Q?S\340y\224*\316\345\240~V{\211n\354\002~\211\204~V\345\350\031\022\200\353\231\352\332'\037\001\364\005\265 ?\025\200\370\263XDp\001\302\227\217'\200\304Q4\346^\017y\333NY\022\347\256]\343\205\351h\373\330\006$0'\244\336f\213k\327\305\026\232o\247\024j\203:D\304(,\302\210\221_\212K\340\264\233I\337\341\177\341\372\313K\314R\346\003\022\266G+\230/4\227\005&\316^\034\207\002\r\317\013r\304\026\244\337\324bs}|6\262!\364\263\2671\022P\356\213\350i@U\016\024e.\266@\222\332\234\204\317`;\353\024xo\2326\240\310\372\201 )"
+	.string	"\3204W\\\252@\354\017\364\021(\376\003\0327\304S\257\312{\016\310\250\322\271Bt#\332\310\330\263.\360\220\223\223\234\003B9\013\311\346\027\260\017'\270\253Wi\327\230em\017!B\361!\374q,\260}/\237\317\346PB\210\363\326T\030\006\270&\214]\310c\317\374p\316x\036'7\272\374\223=\364D\213Q\327\320\332\313\342&\264\005\017O\217v:\231L\323\346L\037\372\2372Q\252\373z\327[\177\374\330\364LQ\250d\210\311\033E7[\223|\300\357\243\355\210>\350X\367\020\2760*\314\024\356\037\037\212-\251?\020u\303\227@p\254Y\220\365\243\033d\254t\342\210Y\316\304\324d\016p\355/\361\236\263Y\017\373\274\325\f\250[3\301\024\230\271k\240\027\n"
+	.ascii	"\321\t\021\244k\005B\352\n\367\371\323'kP\\D\274H(\277\311E\345"
+	.ascii	"6K3\330\"\032L\024c7b;\223!\212v/\343\001\365\337\271\372\243"
+	.ascii	"\220\211zV\027\335\026I,\037B\351\302K\204\n\360\325\301C2L&"
+	.ascii	"\325?\261\027\372p\302eNz\030\2446\255f-1\3719\316\265\036\035"
+	.ascii	")\325D\206\021\257\"s$\220\376\b\373VC\217Qv=\372X\277)0r\030"
+	.ascii	"\247\375b\371\\\325\0207\255-\240\213`K\244\006VfxY\273\352\244"
+	.ascii	"n\021\261\363\023\265\002\321e\222\251\203}\243^Q\274'\331 I"
+	.ascii	"0\245\022\244{\f\336\222o\203\027\206\363\311aCS\276\321\255"
+	.ascii	"3\031\t@\332\376N\227G\\\233\024\334u\030\237k56\f=\347\205g"
+	.ascii	"\\\303wK\301\004|u\311\001a\341<\276\343\025\277\254\255C\237"
+	.ascii	"J-3\255\372\236hg\342\327\307^3e\355\352\220\037\2368\364;\223"
+	.ascii	"}\312\273\373n\236\003\376\202\204\334\327 \223*\003\\\322r-"
+	.ascii	"Y\204\356\301\004\031\275ncvHI\222\314\264\260\026V"
+	.ascii	"=\370Rv\242Tf\324\3178\224s\007.A\343p0O\251Z\004\321\005\204"
+	.ascii	"=G]^\331\253V\037\242M\371_\265\023KTCP\261\214DZ\257\237\b\036"
+	.ascii	"w%\317\be\355%L\361\344\356+\221\3649\205[\nx(\177\033\216xK"
+	.ascii	"~t\373oA\325\235K0\362\261\344jYZ\2723d\220\255FU\025Vo\260\307"
+	.ascii	":B\034\205\264\314h\007{*P\226\303-\302\340v\243\341c\266\037"
+	.ascii	"\250\343\207\324\346\306\250J\376^\nw\033l\317\204P\274\226\325"
+	.ascii	"%\207)\362e\230_\326Q\204\325\022;\222\216\253\215gRZ\360=\250"
+	.ascii	"\227c<\261-\031)U\304\362\360z\3363\324\233\315\266\233.\317"
+	.ascii	"\036_\253\344\245m:\237p|*\365z\352'\350wf\327}\245V\033M\213"
+	.ascii	"\244_G\367\360\372g\216\254\311\250\037\242\017\207\323\207t"
+	.ascii	"\221+\025P\347\240\2773m\031J\334\031\316D\320\306\031{\263\366"
+	.ascii	"*\341\345z?$\021/6V\254^k\254i\323T\323\003\343p\327\375\274"
+	.ascii	"+CPTT}~\217m;\035\030\213\264+W\213\315\375\177%\300\323E>\337"
+	.ascii	"4\300j\002\330\n\225\317(\376\275\307\326\0213\310l2\344M\034"
+	.ascii	"\301\220\322\003\355@\\\222/]\001+\252\013A\310\013/\364f\366"
+	.ascii	"1\357\006\\\034\344\374)\250u\013\3725U\364\224Nl\265\021\374"
+	.ascii	"\360B\254r\0375\213\rM\336Rwq\374\2536\3525\211\207\312\"=\320"
+	.ascii	"c\220\376\270\025\340\2024\005\366\276Y\033$\033\310\271\342"
+	.ascii	"\317b7\275C\312A\356\347\016\320\372!\211\030\235\350\214Z\271"
+	.ascii	"\323i\343D\362\253'\367\215\267Rg\017Lb\340\355\234.\035\375"
+	.ascii	"\203\247\034\304\347o\371:\264[]\334l\367\311j6\331p\005)w\376"
+	.ascii	"\326J5\352\273u\327\342\241\031IN\257\236,u\342\005S\245\277"
+	.ascii	"d\253\034\357l\340\372\033\367\377WW_lq\205cf\f\354~]\346qN\306"
+	.ascii	"\215\356H\311\234Z\336v\375\230\034g:x\006h\335\320\311+r\313"
+	.ascii	"\364\220\0031\026\261\314U>Ou\273\313\370\\\367\267U\325\225"
+	.ascii	"xv\001\341\243\354yz\254\023\034|\215<\272\367\264\360\377\326"
+	.ascii	"\213\235\036\226p\247\003\355=9o}\227\357\222\344.?\353b)\265"
+	.ascii	"\245b\305x\215\212\037\005\274\321\342\204\366\323c~\251\362"
+	.ascii	"\233\315\033\002_\205\3011\327\374\022\367\001\236\337\267\376"
+	.ascii	"\304\370\364g\266\350\202q\377\2100\007P\177p\034J\377I\212\335"
+	.ascii	"\024^>\354O\373G\275'\247\023@\347u\3772\344Y\225\377\025\313"
+	.ascii	"\267\240\373!\205\317\316\327\341q\255\352\317\317\232\355\354"
+	.ascii	"\355\321\367\316;\336s\177\304\352\263\240?\243\r\213\376W\360"
+	.ascii	"\267\304\243\241\2411\\\b\354o\371\320p \331#\307G\301\365&\256"
+	.ascii	"\001\201\313s\372\315\277\241\374h{R\274\204\377\244\362\264"
+	.ascii	"\370A*?P\341b\340\007i\207L\337\273]\242\362k\376\313\320\246"
+	.ascii	"\354\211p\257\334\205\363\376#}zd\367\037-\316\364\2708\212\241"
+	.ascii	"\225/\312\034\272\002"
+	.text
+	.section	.gnu.lto_.symtab.48d0867c8050f5d8,"e",@progbits
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"headfree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"offset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"canUseGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"shouldInitializeGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"getQuaternion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"isUpright"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"accAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"quaternionProductsToRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"quaternionComputeProducts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"quaternionMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.48d0867c8050f5d8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
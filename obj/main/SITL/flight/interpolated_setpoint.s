@@ -0,0 +1,764 @@
+	.file	"interpolated_setpoint.c"
+	.section	.gnu.lto_.profile.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\235\004"
+	.string	"\304\004>\001"
+	.string	"\020"
+	.string	"\363\325\356\265\017\f\002"
+	.string	"\002\001"
+	.string	"\002\002\002\003"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\004\005\354\207\264\260\016P\004\002\005"
+	.string	"\002\006"
+	.string	"\007\002\b\006\007\b\t\n\013\016\017\020\367\376\334\304\001\016\021\374\351\233\315\016\002\002\002\002\003"
+	.string	"$ \360\002\252!\017\2370\013#\201i\007\372\315\264#\214\223hW\2059Y;\336\002\243\263\031\024\243\f\003\027\030\364H\022`\032\006\034t\356F\r\326\300z\316\005N\031\211"
+	.ascii	"\334e\357\332XJ\337\325\227S\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375 l\375\001"
+	.string	"\264\002`"
+	.string	"\004"
+	.string	"\001\002\002\t\002"
+	.string	"\203\001\001\001\204\001\001\001\020\002\006\001"
+	.string	"\001"
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004\003\021\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\007"
+	.string	"@"
+	.ascii	"` 8\030\314\343*Uj%\244\r`\001"
+	.text
+	.section	.gnu.lto_.inline.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375`\242\001u\f"
+	.string	"FVI< q\222t\004\023p)`\277\212~\026\216\024\0306\2760\tD\360L_\037\034^\260\237\253!d\301}\026\264\216\332"
+	.string	"\013\035"
+	.string	"\001\001`\204\213\222Y\377\241\262\376H\342\233\335[\356\0245"
+	.string	"5"
+	.string	"="
+	.string	"!%\211Q2\303P\266\374\232N\327t\356\r\203\353\205O=\311L\313\305\013\322\251\231\231\317o\356Ef\nx^\025^\030\356K\355~!G\"\263\"\360x)\0042R\022\214\343\246*\035 \2500\027{<a\365\274\324\314\254\n\375P\255?\307o\324\354\r\204A\035\351\233m\036\250\"\375\003\306Q\221\177[\360lt\304"
+	.ascii	"|\001\b,\337\246\036TP$\0308\322tl\350\036\307`.YFc\364Q\026"
+	.ascii	"!R\214\260\314\214\231\217\232\330\220\362\240cs\004)\n\0320"
+	.ascii	"2\340\270\306%\335\212\t\247D\201\321r\244\316\302\212\377\257"
+	.ascii	"\247\313\314|\216\301\375\250;\311\254.\007\360X\342L\255\321"
+	.ascii	"\340\303J\307+\363Rp'H4\224\364\365\222z\241j!b\035Mq:\034<O"
+	.ascii	"\235I\004\016\023\006\254\37315\013) 0\002\342\330\230y\275$"
+	.ascii	"\003Wrp\206O\221:\306`\270\025Fh\023hJ\366\254kq\017%i\203m*"
+	.ascii	"\036\257E\022I\212\003\325\001\324@X\311\200\253!\233\253\226"
+	.ascii	"\005{ \030nCy\231A\016\310,\f2\222Z(\300\363\241\211(i\363Q\f"
+	.ascii	"d\265\240\361\250g\261X\330\344\226\243\327\344\272\250X\024"
+	.ascii	"\300\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375 \353\005\004"
+	.string	"B\007\026\037\240'\351\377g]\017\336\244\252\272\354\307\212\337\254\352\370k\237\274\342\276\263\366\350\3356\221I\006<=\363\004\301\351\277\006\274yU\226\201\036\240wz\210\337 \216\021\331\005B\212B\017\033\356\346\272\361\214O'\306\023\353\247o\305^\261\316Dk\341\265L\332\245y\026\037\001\017"
+	.ascii	"\372\b*\\oU!0\\\024\301\245,\242\020\001\256P\371\300\032\334"
+	.ascii	"\2638u\241j\201N\255\316Y\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\231\004\005\230\004\020\230\004\021\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375 O\r\002"
+	.string	"\024\003C"
+	.string	"\004"
+	.string	"\001\024"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\374\007\374\007"
+	.string	"\020"
+	.string	""
+	.string	"\001\002\017"
+	.string	"\001\002\020\021\001\300\007\002\021"
+	.string	"\001\002\r\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"8\203\024\025\334%\2142I\330@\033"
+	.text
+	.section	.gnu.lto_.lto.ac9afbd002e1239,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_interpolatedSpInit.35.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375`q\003\305\030"
+	.string	"\266\255\235G\260XQ:\300!\262eV\361\263\2203\304\tg\245\035\364\307\027\037\021?\230$<\3322\365%@A\320o\201r\327S\211d\205G\207\257\2311\222su\201Cu_\035q\227\216\322\031-0\216o%\237l\"wJ\001\202"
+	.string	"\201"
+	.string	"\213"
+	.ascii	"l`\342\347\337\344\226\275\273\221\333\231^\200\373t N\324\214"
+	.ascii	"\331\335\004\237\266 ~\352\200\227\366\211\274\310\355:\030\017"
+	.ascii	"\260\253\004\325dw\267\300\021\304O\357\356\n?\305\013\b?}\263"
+	.ascii	"\305\0248\272I\023\203wfw_\312\303zpw\203\362\366\t\252\274\371"
+	.ascii	"M7\220\344\033s\270"
+	.string	"O\020\300\356\342\344\216\300\0062rE\022\fR\343z\247K\337\324\230\253q\251\232\260\273\226c\216\306\035\336v\315v\b[u\004L\273\265\204\337\257\214\321.\321\001\325\034\225K\220\204\024\311\237\245\252\026\340!\215\271J}\2146V\361$+\304]\243\035\377\351\004M\364\361\351\303\b?\257%\212\240\321\021\311\237\275\303I]\262\377U%\333u\246;\347\272\037\347\274\273\245\222f\201\322+\225\026Ci\325\224\016\247\364TipJ+(-U\372\0030\330\350r\034\276\335\031\2775\0335\235\3748\357g\262\177\304w\3429\n\270O\026\210\004+,\242\256\222~\305Ln>\332Vp+\356}Jj\303\2418<\214\324\356\356|V\3419\230)\247\322\341\003\f\026~\252\324A\022\222\361F(\305=\002R\276\021\266\210\036\205\312\321\251\241\266x\374\246\332N\361(\356\271z\354.\004\377\311\241\2140\211\236\0363#\231"
+	.string	"\322\275\313\226\332&b\362\343\324;}\205\205M\324\221\342Tw\027\247\006\325g\362\236\217\357\3032 \371\021(\374\224[F2\263+\001U\203n\210\256\367\035_\002\263\313\202b>0\231-\006\302E\214\347\347\007G\0264\373\241\325<\240\230\r\261\354\303\300&4\243\r\331d-L\240\220\331bA\264\241\232\314&4{\331R"
+	.ascii	"\315\202~^B\263\330\212\227O\255\305\213\001\002\323\206d\265"
+	.ascii	"\227\215F\253\275Z\273\375W\225\232.:\331\210\"\322\242\251K"
+	.ascii	"VMQ\227\252\027\231\340-\225\261\340-\275\256\311\213\221Ls\020"
+	.ascii	"\324\245\226\272T\345\233B\312\241#U\272R\226\332\024*\310\217"
+	.ascii	"\326AR\234}.,.|K\206\035-<\017\262\260\364\343\rQ\003C\250Q\034"
+	.ascii	"\005\031D\310T 2\021\2158i\f\220\002\2211\263\016\021\240\271"
+	.ascii	"T\246i\332\f\242,\377\251\2444?G\232\373\244&\221\227\206\346"
+	.ascii	"y.\r\264\260\356\345\223V\376\377=\302\237\035\201#Y\256\302"
+	.ascii	"\252 H\370\"`\336<`Fn\344m\332\273\213\212\036\340h+\023\323"
+	.ascii	"\260|\365cZ\363\255\357\206}\n\030?u\004\354]n\357\024\024\256"
+	.ascii	"\251\357B\317\030[\"k\327\"\302\023a\367c\323\352\034\251+%9"
+	.ascii	"}2\315\263\302\355=\037\362J\271a\360\2308LUHm\372o\036\235\333"
+	.ascii	"\374\001"
+	.text
+	.section	.gnu.lto_interpolatedSpApply.36.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375`2\031\335l"
+	.string	"\372\261T'K \220\332\351>%@\203\273\314\017n\305o\r\346j\236[\004\342\340\017\027\277\302\342\320<\231\373[1\241\020\327|-)no\260\225\362t\301\005\251"
+	.string	"\004b\216\t\226\364F\334\210\264\304IcV\361Z\260\026\fzj$\311N)\245P\0023\002t\002D\327y\350:\013]\347\240v\006\272\316?Hg\237\353\334\323\316<H\347\235\353\254\203t\316qg\034\244\363\315u\266\271\316\036\256\363\362:\327\\g\345uN^g\344u\276\327\371x\235\327\353\374\355\354G\347\3562\207\353\"\247X&z\344\301\314\261H\032w`\005\217U\267\366\353\256\353\306\322\255\245{K7^w\333\235\327\255\327\275\327\315\327K\346fn/\334\177\274\364\033\342\305\226EN\261\260\255p_\351,m\327w\315\245\273t\265_h\030\272\217\227|\204H\016\275\354=\331\340\260\252\307\201\225\274\016\334\332h\223(gx\334\2668;\224S\234`\313\22015\267\303.-\3342\305r\3301#pQ\266\260p\233\f#\373\231\026\306\035Zu\335\020\246\330\034\333\246"
+	.ascii	"\024E9\250>r\216d\037\233\371\311\274d\346w\241\310\232\303\212"
+	.ascii	"=\241\322\245\306\b\022\317\236\003\013\352DA\271>\226\235\223"
+	.ascii	"\342\026\355M\205\367X\311\262iY\272\260,+\305(\222}dfn\026Z"
+	.ascii	"\356\311\334\256skm7zdZ\247\310\262,\025\263}n\037\327\346\271"
+	.ascii	"}|\021\372\331SRQPONML!\226@(%!1\217>\030\025\021\r\t\005\001"
+	.ascii	"\375\370\364\360\354\350\344\340\334\330xX\326(\223\310{\\\337"
+	.ascii	"\237\334t\275\"\302\265\324\262\260\236\222\n\354\250\365\b\004"
+	.ascii	"'hz\220\354\313\312\374\023\234\002:\324_?\375\371\271\223\227"
+	.ascii	"n\362\322\347Lm\207h\271\370\022^\203\300\273s\245\277-\236d"
+	.ascii	"\327Hv\314,Z\374\250\212\177hh\2256\232B\305\213\344\232H\356"
+	.ascii	"\215\214\005\037\032$\263[\301\205\342:h]\032z#\203s\240\225"
+	.ascii	"\371\027\347\346?>=\353\320R\233\363\224@\202\357\214P\202\353"
+	.ascii	"\224\3209\353\023\032\240\222\036$c[}dxrC\277\221\2559N\2237"
+	.ascii	"2'~\343P\332\246I{@Z\"_\244%\201\3225\034l\340\312\016\316<\371"
+	.ascii	"F\306\304\221\203dh\3357\365k\326\307\2322\263^o\312\214\254"
+	.ascii	"L\226e\227eb\376\353\323a^\016\335\327H\203d\201\253\017\022"
+	.ascii	"(\324\246k\037+\213\272#_\260,\313N-K\322L\325\314O\203\231\023"
+	.ascii	"\231}\302\004\337f\035\200\221\276E\227U\327\241UGk\036\246\314"
+	.ascii	"\233\001\316L\r\026>#58\337ot54\202%\323\340<\262\205@e\325\275"
+	.ascii	"\371N\243\323\241*\211\246\027i\324\260a\343\366\361\346\221"
+	.ascii	"\037|\211\253&_\215m~\371\236F\007\270xX\365\3606\217<#}\313"
+	.ascii	"\341\f\017\034V\036\276\357\f\253V\277\374\365K#[fv\245\346\267"
+	.ascii	"\240\r2\224!4\024\363\305\013\330\2108\250\270 \n\232\334\361"
+	.ascii	"\325\032\354\216\001\373Y\273\241\305\030p\300\216\035\267\217"
+	.ascii	"H\023\366\340\314@\275\221_\230\002\267\266\276\032\327<\362"
+	.ascii	"\275\350\002\333\236cW\345\327\374\255K\276\362\357\236T\021"
+	.ascii	"j\030\006\201\344\367\035[\365\352\221\237b"
+	.string	"\203V\252x\277\371W\337\2144\024&p_\004\016\\\342\030\370\3437\277\031\245o\353[\375\361\217\205\322(Qo\244 K\023r\233dY\366\004\267\f=\310\203\273\255\217\334\303\352\310m\3658yxh\252\377\334\266\231$\334$\306\262P%\006^\2013>\251_\324\033\331\377\037Y(=\354\367\357i\032\2507r\21637\261\274\251\375KR)\202\321\017c\033\357\361\314\rlyS\255\276\373\272\321\2568\021\024\373\260^[<\354\362`\227\307\367\034a\013e\bk\020\363E\346\2710\1775\346\376\306\306\306F~\020\230\257s\223\265\013\335}\244\353\232\333\202f\237\024\364\226f\260\"\327\231\210\220\353\034\201\263\253\375\232\271~<\260\245\325y\315W\315\336kf\240\371\232\255\232Jw\217\236\353\346\321X\232s\340h-\3157ZK\263\215\306k.\240\361\232k4^3\001\3356\323\350\266yF\3535W\265^\363"
+	.ascii	"\327YF\215s\214\353\f\343:\277\270\316.\256s\213\353\314\342"
+	.ascii	":\257\270\316*\256s\n\2453\n\244\363\t\245\263\211\244s\211\353"
+	.ascii	"LB\351,@\3229\200\353<B\351,\"\351\f\300u\246\272\316SHg\251"
+	.ascii	"\353\034u\235\241\256\363\323uv\272\316M\327\231\351:\207\270"
+	.ascii	"\316K\327\031\304uV\272\316I\327\031\351:3\257\363\321u\376p"
+	.ascii	"\235\215\256s\321u\016md\244\212G\257\306L\017\342=\f\206x\246"
+	.ascii	"/b\\\372\020o\264B\\\002K\357V\330\252\036\304\337\024\332\332"
+	.ascii	"C\025\374>`1z\020\270\341\370\306\020=\177\002>\f\206l\374\230"
+	.ascii	"\322#\005\2269\273\023Lz\245\277\216\202\237\220\364m\305\220"
+	.ascii	"\371H\357xRE\250\277\271\t\314W\016\316P\364jO\301?\037\252\214"
+	.ascii	"\364\355\350)x?#\365\213~\370\243\177F)\232\321\027\375\207\027"
+	.ascii	":c\3647\317\003!/\344\213\276\003I \263#E\003)DD\337i(\020)\261"
+	.ascii	"CcB\220\214\224\241\365\247\206\242\036\227 \3473P\215/\340\307"
+	.ascii	"x\375\231Q#\247G%\250\353y\005\232\3614~\f\354\2134\260\201N"
+	.ascii	"\005\260\017a\027\003\221/\340\213\374J\344\243\354\376\"\370"
+	.ascii	"\253\027\362\177&\202\007a\347\345*\004n\213\302\270\232\022"
+	.ascii	"\272\027\307d\350\237pk\264\346i\3178\253\025\217\212H\343\205"
+	.ascii	"~\350\221xI\316\374\234\362\254\342M\025\232b\247'\264v\325E"
+	.ascii	"k\302E\321\f\264\306;\277\345\330\300H\337\270~\306w}\243\261"
+	.ascii	"%\345\265\300\026\364j<\304\305\270\276I\211\rt\200b\276\310"
+	.ascii	"A\377\363\\\377x@\037\344\363@\037\2047M\363\363\375\327P\203"
+	.ascii	"wt`\2560\320\253q\3675\215\345\025\001?DWe\332\326$m\256\276"
+	.ascii	"\306\032\227\302\362\207\220\312\264\255\271\217$l2\343\307\272"
+	.ascii	"\257u\020\336M\333\245\326\363\3523\300{\215M\363\253~\314\347"
+	.ascii	"\275\316|~\205\022A\264)L\240\336\370\363j\354<W:WOD\3278m{\266"
+	.ascii	"\036I\2106mw\256~\210n\314\264\315\371\361\004\374\230\3634\337"
+	.ascii	"u\232\357=\315G\022r0mw\232\357mS\270\344<\360\003\374\330\222"
+	.ascii	"*#\263$up>=\177\365[\337R?\236\357\371\226\036\356<\3177\240"
+	.ascii	"\223\306i\032\350\321\312^`\317\316\367\240g\340J\252\270\333"
+	.ascii	"\030\206\f\031\267\217;\277\fk\214c\002U\232P\266\306s\244s\036"
+	.ascii	"\247\220\350N\360\202\235\n:\347U \251\342\024F\357\212\216\316"
+	.ascii	"\377x\213&_\347/\034Z\242\024-\372\300w\nh1H\337\242u)\360\345"
+	.ascii	"x\264s>\n\311\023\027P\250h8;t\316w\232#\251Jb\220\363M\346\254"
+	.ascii	"\232\006P\211\334\315\253\331\374X\225\021\265L\f\234\031\017"
+	.ascii	">\225\322\240\310\262l\363\265\002>\262\274\276\272\262d\354"
+	.ascii	"\354\030\322\364Zf}5u\020\361\2726=>\262\262\202\354\360\361"
+	.ascii	"\221\265\245\265\345\303\211\243\313\271\365\325\364\312\002"
+	.ascii	"\222\205\205\005\243(\206\226\226M\220- X\353WW\004N.\030_\020"
+	.ascii	"8\235WK/\347\027Vs\206\003_N'\327\016-\255\233\254 E\276\326"
+	.ascii	",\256\246\327\f,\035C\262\272j \330\"\322\\\031k\352\253k\313"
+	.ascii	"\031\344+\013\202\005|d"
+	.ascii	"}5\2018\203xe}umQ}9\320\300\026\020-\252\256\255&\027\025\226"
+	.ascii	"\027\004TSO\354\f\222\345E\365\345tzQ-\347\330^\331\007\201\311"
+	.ascii	"\236\t\375(W\300m\362\247d\337t\315\224\201\0254\325uJ\306\033"
+	.ascii	"y1'(\034\306\307@\362,\363\246\312x\246\221\017c\376\260\037"
+	.ascii	"Ka\250\314"
+	.string	"\317\f\236}j\3200\224\350c\343sI\267k}dg\3644\3173\016\236M\232\334>\306\3706sK\244\232quK\007P)\035\2705Ztb\325I\334\300P\021ap{\241KT\027\271}\344\213\226\220I\344\026h-\007\t\334Z*\"\f3e^<\213\207\361\227Q\212\026\265\340]\374\213\027\252\223\276\261\370\026\357\342\213\276H\243\340\300m\362\260\305w [\025:F\314\007,\336\006\272C\\\025\372\344Y\305\202g\032\213ApE\r\206*>\305\257\370\025O\212\226\343q\274\212\277u`hH\361\310\264\034\342\252P(\246|\006\302\240B*\342\211G!CUR\360\304\367\013lU\350\323\022\021\234L<\240\007~\361\346\275[\342M\220(!\344I4-y\302$\200\224\367\361\005\360\002\214\b\240\310\217\ba\327R\357d\326\310\266$\342\365\236j.\326<\317\253O\021\330\236$<I\270}l*\""
+	.string	"/\342\203\n\247i\234\234\352\231\237nO\023nS\001x\246\330\207e\271\231z\252\017bt<n\223wS\3371\030V\213"
+	.string	"\263\234\001\361j\254\242\253\256\324w\bt\206Z\236RdH=\322\0052qL\224\314x\031\203\324\354;\323\2614\237\231P\216\037c\244\033\317+\363\206\220\253\3208~\f\252{|\221Y\"\235\341\025n\213\326\352z \021\305\240\251\242s!\201$b\362\222\300\276\3107\373\022\264%J\337\242HQ\357\364\277\b\365QO$\346\351\241\236\210\261\n\225\247\357D\247\277I\332\3100\225p^\240|\340\325\310\306\337\370\261\246W\n\264\372\246\327\021\201\367\250\2010%\221SfFF\024$I\n\205\306\201\005\204\030\346\240\254n\021\300(\347$34B\222\024*\215\001\007\006X4\335\363\330~\007\322\303\004\311R\304\205\232\205\315\320\2412\017>i\366\235\024\256\363\214wn\352V\314$\316Jz\036\250\236\312\376\036\205\037\352\253\332\363\357\377\301wI\020\370v\3371\317\310|"
+	.string	"\202\244\211X\310\256QY4\365Y\234\315\215c\\e\210y\350Z4\267\034\376\243\323\357n\267u\313\334\255\006s$\206jG\367\374\0172f-\372v\0265k\213\020\340K\013r3\302 \261\212\314>\372\bJ\260\023}\316\205\031\315$\343\370i\326>\001\353\360\270\372\241\020\341\r\366\247z\207"
+	.string	"EM\342\203\004\366\323*\372\235g\270\0248\242ub\036\204\3654\nR\245O\201\266?\345\216r\331\005W\342\257\255\202I\357q\345\376\321\373}\307O##\027m\356\266J>:\262\020;\203Ve=2\\R&\336511\013\211%\225\256\271\323\260\235\031\320\313\230\332\036\260i\354W\303\221\235\001\366\203c\366\331\337\020\033-\344\315q\351\352\265\266\262\306\241*\364.\352\"\024\223\203w\320b\262X\301/8Y\211\026O\242\242\213\212\332s\254\030)pG\215\032"
+	.ascii	"%\320\224B0b\205T\200*\023\302\253G\203\220/\"\217\226\357\261"
+	.ascii	"\351aO\005,\365\275\361\025r|\267,\344\032X#.\017EV\346\305*"
+	.ascii	"\321\243c\252\334B t\330$,\261=\253\232\207:cak\2716\303\243"
+	.ascii	"\025\037\346i{\335B]\326\324ML\205'\n\35783\314D;@\026\001\237"
+	.ascii	"\360\004<a\235\036LG`\302.G\234Gs\2023\240\247;Z=\243\236\t8"
+	.ascii	"\313\365\223\305\320>\253e\340\254m\273X.u\352g3\267}\203\270"
+	.ascii	"\2167\nL\251\026\240\023\261\037\311 \311\307\241a(\210\bkR\253"
+	.ascii	"\213\26101**f\247\334\344\327\327\344\031\215\001\3769\317\372"
+	.ascii	"j\033\031N\005\321\237ha\350X\017\207\222P{\023\335\255+\200"
+	.ascii	".2\367|V\231c\267\343\324\341+\177\233\307\262\222\005\312m\233"
+	.ascii	"\316\325\342\003\002R\021\235\034L\310\216\226\240\272\035\270"
+	.ascii	"A\t\313s\2028\024\017\244d\373\204$w\317\372P\016x\333A\215\005"
+	.string	"4\021\274\037\374*\310\377\273\324\220\020\2314\341\205\3413\306?\336\211\236HL[\206Z\261\006\271L^\210\"U1\206c\345`\"\221\265\004'\215\n6dK{m0\353\342\255i\"8\202Kf\201\202\002\336\243\005\b\365\264\027\234\304`_\313\236T\320\324Hhy\244W\226 \327\001\232\035_\306\203i\002Lh\022F\003\037\354\305\303n\325.P'Z\356a\234\235\210t\355\272\313\270\301D\322\2572H95\363\027Xr\200\007\023\2401\2405\334\200[\306v\262\274\334\334\242\007\231\340\021\213\247\2601\tO\375\nWl\341ml\004\216\310\t\221r!T\240\270\273\266:\267\236\261\343R\364r\0264\024D\002\027\336\223\251\372\360\277\211\304~EA';\320G\376\\\022\3136\310\370\002\007\351PsB\2730\f\367\256\025\310\370\016\235\261\342(i'\354E\340v^\024\314\013i\343\220G\032\307\340\246X\030"
+	.ascii	"\360\316\260\236\017\\\347\351R\371\226\2423\364\032\375\366"
+	.ascii	"O5\264\211\235\237\301\362\206\346wq\221\360\312E\324j\003Mx"
+	.ascii	"\206\t2\306\212Y\250\253\324(\215\322\027\034n\272\234 \"\005"
+	.ascii	"\364\230@\362[aG\265t\326\253i\ry\254S\211\310\370f<\361\234"
+	.ascii	"\022o\005`\262r&\230\206\250\001"
+	.text
+	.section	.gnu.lto_applyFfLimit.37.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375`<\005\355\036"
+	.string	"\0267\302I\240\326Q:\304\250p\312\026\335\260\234o\307\325\246<B\375\303\rBWT0\330z\353\323{\005\020P6\034\323\\\316\365\227e\224\325}\360\321\3435`M`\017\340\304"
+	.string	"\211\356\231&\357\270\246\324\021\277\375o\215\020B\266L)\257"
+	.string	"\233"
+	.string	"\257"
+	.string	"\266\2170\022zX\211\260E\033\221\\A\370~\207\271,\253\225\311FV\255\365\306\016b/m\3738\236\343\3076\222E'(sHbH\345\245\326\212\033\360\032\363%y"
+	.ascii	"\346K\n\343?\267\325h3Y\3544K\222\356\217\177\346\220R8\216\f"
+	.ascii	"\025\001\335F\200\311H\3515\245(\"\026KSJ\332\331\231\303d\204"
+	.ascii	"t\331\277\210VX!m\354\213\b\211\034Pk=\325\tD\021\035\355i\n"
+	.ascii	"\267Tq\222<\260\264\004\305\255hH\3268q\201\345T\337\021EBKE"
+	.ascii	"\004\315\232'.\031\263\242!\3353\247\326\352\035*2\272o\267}"
+	.ascii	"\264\r\264I\035\001GA{\364\205\374\306\302\013h\305\374\211\353"
+	.ascii	"i\213b\371\006\211X[\fq\002\203\305j\005\362\016\325a\tb\255"
+	.ascii	"\325\300\203\330\006\373\227\300bN\225\250\026\253\201\2273t"
+	.ascii	"\261\222\274\204v\214]\f.m\262O\217\307c\230\351\013\373=~\233"
+	.ascii	"\373\370"
+	.string	"\003\274\370\323|\307?\263k\231\027\357[\271\266\221\353\332\256i\273\236\355Z\266\353\330\256\317]\233\273.\3135I\256i\271^r}\001W\3122\345\324`J\255&\216a\252W\2515\303\257\272U\210\377pyb\213\026\302\246\275\274\375c\323\002\364V\337\243\024T\222\212<\351\262\2413J\223\321\031=\271\204D\223\312(\031E\310\305\206\2364F\367J\030\0254\351IO\251\033F!1\270\307\307h\223MZR\fSL\204\026\214\2057\2611\306\344]9\035\235\316|iR\0061\264\002\320\222*\270Q%\364\002\344_1\307\223\274\271\222$\244\251u\212\204\3223xu\365\305\252Q.\265\235\340F6,\240Rkm\340o\235k\347C\2754\007\036o\210\013\r]z^\t\273\202\366\370\007A\032a$m\362\203\367\314\323\017SU\204\026\214\375\254\023\351\371P\356\360\333\017\375\314\227\247g\260\352K\336\301\371\355"
+	.string	"s<\\O\217\307\353\351\b\250\220aG\001\330\243\363\371<\350\314\370LX\235\007\236\334\207\362\267\003\221#\255\203\003\354\331\365|\200\272\337\205\f:`\216\247\347\343\323\001{v8\340\316\206\035\217\006\\\317.\307\303\351\370~8\234\003\356\371\350|8`\257\347\303\321\212A'+}q\243\267\022a^A4h\263Q(\227\022eo\256\033\265\371\210\b\023\304Z\355\253F\245\224r,\3518\n\332Z+\020\2156\231\bf\214\321$L\22114\2366\026\270\325e-\224d\201\031e2\364FG \370\f=\325eWxlyB\326Z\353,Fi\250\f\365\n\2738\201\321\222%\243\241\264f\250AL\306\020DB%\222\202\024'k\240\002\221\261\2729\021`!\224\206\246J+\303\034\317\t\321\001\225\2760\023\234\272\330N\213\n"
+	.string	"W=\366K\002\260k\021\375\356\321\274%\311\324$\324r\374\354\252\373QJ\2230\3125Y\300\001$\253LKQr\360\222\337\244d\353\323\253\331&\262%8\267\020o\340\215c\311\002n\213\341Q>/\033\355\314\024\241\236 \372\240-\255\035q{\001gQ\256\030\307\247\322e'bu\030N\021E\t\275\0206g\313\n\bn\226\335\320f\330\200\336o\232-By<\f\224\305\030\004\023\376G\336\231e-9nX\017\004\\uTDQEf*\n\343"
+	.ascii	"iY\302G\354\361Q\252/\335\211V\240~\377\007\232u\215\371\003"
+	.text
+	.section	.gnu.lto_shouldApplyFfLimits.38.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"]\f"
+	.string	"\226XWB q\223\016\037\260"
+	.string	"S\201M\301\r\220\205!#R\314\320\301\350_\336\240\324\003\242\225\251\370\330\330Z\237\0065\022\024\232F\005,\202\023\006\001\004\240\353n\006\f\206\251\360\301\200\204K\\\326\222\275\245L)G"
+	.string	"@"
+	.string	"E"
+	.string	"\026\335#q\372I\212\344E\216]\317\322\223\213\036\241\246\310\277x\304\024*>S7z\374p\b\021\260\214\270Q \204\f\017\231n$5@W\202\232\335=\213gI'\222y\361\330]\247\251\353pW\267-\3016\004\373\235>\334\335\265\242\034\217\362\303L\247\246_\t\340\300\362"
+	.string	"\307\356\351\323\2614\342\312\t\333!;c;\323\376\212\247BGq\f\003\330\025\221\202\261\273\013\354"
+	.string	"\363\2509\201\352\021~@\365h\333\035\006\241\244\374\252\250&PA\214\234P@Eys\250\021f\224\262\345\271\273#U9p\315\032)6J\331b\333\032\236b\025\314\3566\360[\334\305\346\233xt\206\220\274\351\321\017\251\036\257\006J\254\220\362\263\275Q\252\211\003\033\266\301\003\375\301\341>X\006\342\256m\002\205\213\363\200d \355\342>\230\305]\260\200\201T\260>\230\007\203\365\241m\026'\2013\320\245Y\\\226iV\306\333\303U\224\023*x\352\346\251%\266\243jH*\342\324\250'\331\021\020"
+	.ascii	"M\204^\316\206\307G\2217\304\351\031\b\242\250\020`\023\2671"
+	.ascii	"\034 \227Q\212\032_\261L0Z\ryU\305\232!\267\253\350\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375`\216\001%\t"
+	.string	"\262\21546`\213\322\001\020\215M\302]i"
+	.string	"\337[\005\350\307\266\005\320\201x\320\366\313\336"
+	.string	"\033\215+\b\234\202;\206\301\276\375o\377\333>i-!\204\220f\355\032B\331\344\226)O\nU\236\003C\3424Y\315\211\r\312\252\303\327"
+	.string	"2\250\222\353\270XUV\027\276\264R\021\n\2504\360\370H]\253%\020[-\241\020:0[M\320V\0172+B@4\266U"
+	.string	"\353\232`jw\233$W\022\203F\034\022\261(\304#\020\223>,\340a\202\016\027p\330\223\335\375w\033\376dD\303\235\270\3120'b0\357\322\r\354\177\357\022`\271\270l\265\267N\343\262\r\263h\030\206\341\305\233xSE\243`&\231\325?\277\226x{j\213\237\377\f\210\314\356n\2135\361\177|\b(  \003\271M\007\200Q\bVZ\025\222\241\026\346\273ad}(\236)\365\b\016\340"
+	.string	"\016p"
+	.ascii	"\007p\0208\374\201\200\263\264\264\205y\330\220\200\336\267\270"
+	.ascii	"-\022K:\006\036%\226v\34209\261\006\2079\f.\376\021\t\303\214"
+	.ascii	"Y\231Z\353\217\001"
+	.text
+	.section	.gnu.lto_.refs.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\235\005"
+	.string	"b\016(+pM2\214\001\200\367\bx`g\\\021\247\377\377W\222\362\031"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"b\251M\013P\013>{\263\255\021\262w#\220\337\b\221)\317\211\331"
+	.ascii	"\314\264\005\322\026\3475m$\375L\353H\003\240\273\270<\213\n"
+	.ascii	"Js\024\227\335\204e'\261v\021\353AX\336\303\332'&%\352$#\"\323"
+	.ascii	"\016Y\007\221\376\361l\017hwp@\337h\256\221\021m\214\265\016"
+	.ascii	"j\0336\203Z\205\235\240FP{\2406\243\326\2402\201z\240Y\240\262"
+	.ascii	"\230\312N\321\n\032z\002,\264P\232\322^\224\246r6j\366\331>7"
+	.ascii	"\t\007\004\001l\371\240\356\315\002W0P\023UC\024"
+	.text
+	.section	.gnu.lto_.decls.ac9afbd002e1239,"e",@progbits
+	.string	"(\265/\375`<(\r\256"
+	.string	"\312\021\001=X0\312\254\244\016\302\267\323\236qX\323#\034\023\026.P\327\377\214\375\2415b@d\243\324\211!\240\317e\306\232X\237\352\324\306\007\267w\362\332|\246\357J\266N"
+	.string	"(\024*\245^\356\026p\251\270\2463\341"
+	.ascii	"T\031\324\263\032\256\303\271C\b{!\225v\\\236\020)\245L\001Z"
+	.ascii	"\003\322\003\341\003\275?5\360h\300T\306L}a\346\376\2332\316"
+	.ascii	"\325b\334p\361\277\301\342\177\323\304\377F\006\177\233)\377"
+	.ascii	"\034\366\237\235\031H\006\303\315\032\032R<@\313\373\311\243"
+	.ascii	"\317\304@\363\312\373m\350\370\377g\257\334\225\223d$\030\232"
+	.ascii	"\277\362\326\347#X\311\347\347w(\202\311\364\323IS6\245u\226"
+	.ascii	"\2772WN\352\247\032\177!\266%\305kD0\331/\251\323\211\264\374"
+	.ascii	"p\366\376\374\f\376}\3761\350\220\277\262\021LF\323\243\375E"
+	.ascii	"\331T\026\217\nX\221#\323\336\237<\0324h\320\300\343\301\374"
+	.ascii	"\242\305f\277\315\022\336\023\343o\003\306\337\346\213\277\215"
+	.ascii	"\027\317B|>\017\331T\037P\n\222\367\2669\302\261\0046V\374m\224"
+	.ascii	"\370\333\020\361\257\t\303\277F\013\377\032'\374k\276\370\327"
+	.ascii	"\354\340\030jl\360\347w\374y\027\376\274\215?W\302\237o\361\347"
+	.ascii	"V\374y\022\277\200\023\361\247\021\303\237&\013\177\0324\376"
+	.ascii	"4[\374i\256\370\323\344\340O#\203\177\317\f\377^\034\377g/\n"
+	.ascii	"\377\236\031\377\236\021\376=*\376\275;\376\2747\376<6\376<$"
+	.ascii	"\374y=\370\363\230\374y\235\377\216\343\017\267\247\360W\333"
+	.ascii	"c\034\237\301w\030"
+	.string	"JA\356\217\245x\355yC\317\376\314XvJ\304\362\376\335\305\037S\320\323ww\230\202\336o+\376\273\006\177=\345\257\243\3745\032\177\375\203\277~\342\257_\360W\003\303\277\r\177\371\307r8\r\223\271?p\220\345\215\245>\217\351\264\032\024#3y\3478\256\2439\013\377h~\302?\203q\274\005\203\200\241<\370-\007g!Jz\312\3733\027\367@\277\303<\275\317R\3743\f\376\271\363)8\t\216b\240\367\242\336;\005_\217\032LW\362\306V\360\225\307Q\354\326q\224C\263\367!\034\3151\323\373P\016\306\023`<\301\346\232\372\261\244\267\037\227\341\030\211\317\343*\022zK\346\263\347\344hI\253\323\312\373\361\034\257\301Y\370K\233\360\227N\307\370\343\"\3741\025\327\231\301yp\347\0306\3003`\200_`\202\177\300\023z\030\f\207a\350\005<\366\030tx\235\f\353]\275?sp\316\0349S&\357\207"
+	.ascii	"\027\300P\357\360\021\370\343\013=|\207/\364>s\334\315\360\204"
+	.ascii	"\336?\366\372\307Hp\327\005\255<jv\263\336\237;9O\033HTy\377"
+	.ascii	"\023O\350q,\241G\363\277w\234\220x\235\377]\363\237#\b1&;\240"
+	.ascii	"\001\371\002\003\236NG\323\005\013\370\317\0344\340\371\377\013"
+	.ascii	"\374\277\205/\300\203\370\327N\376\263\216\002\376\261\333?\026"
+	.ascii	"\373\307V\376q\225\177\214\345\037g\311 &$\340\377\307\362\207"
+	.ascii	"\177l\374\307\313\033o\341?#\340'\370\327N\377\271\303\177\366"
+	.ascii	"\371\317\033\376\363\001\376\263\206\377\234\341?K\360\237\003"
+	.ascii	"\360\237\001\360\237w\3763\377\317\373\037\333\375\3432\377x"
+	.ascii	"\314?\026\363\217\353\3761\230\177L\367\217\347\376q\334?\366"
+	.ascii	"\362\217\271\374c-\377\330\311?^\373\307i\377\370\354\0377\375"
+	.ascii	"c\036\377\270\307?\206\376\377\004\376q\220\377G\361\217\241"
+	.ascii	"\376\261\217\177\214\365\217\251\376\361\324?\226\372\307\315"
+	.ascii	"\177\354\364\377&\3761\363\377\273\376\177\303\377S\371\177\336"
+	.ascii	"\335\335\335\335\177\366\361_c\364o\201LJ\350\320\322\216\022"
+	.ascii	"*\265\324\241R]\247\027\r-a\024\365\345N\207J\321uhsIG\tm.)\241"
+	.ascii	"R\\x\t\f/E\230\240\\Yaa,\312\242\236\204\3644\264\324\211*\237"
+	.ascii	"\315\016\327;63\352\313\001\364\376\324\\\302\r\335\300jD\321"
+	.ascii	"$\242&CM\\\001\211h\252\331\213\242\312!\315\336\207\020\021"
+	.ascii	";\022\207\3443\332y\340h\222\352\251\037\031\365\036\001R\357"
+	.ascii	"I\334\243\275\367d\357\235f\371\364\354\275IG\351DB\352\235\311"
+	.ascii	"\203\324\237\222kF\275g\263.jKJ\350T\323g\215\f\352\354/\236"
+	.ascii	"I\354\354pRK\016M\202\365#0\334\271\304\364e\f\332\343:\303\366"
+	.ascii	"\225\267X\357\b\220(1y?\216\222\177i\"\217f\201H\031\201-.[9"
+	.ascii	"\371\343\365\336\264\342\\\323_\332HN\342\350\225\003\272\256"
+	.ascii	"h/\035\246\223\350\247\006\303P\375\245\217\274\346\322H\236"
+	.ascii	"\307\347\365\227.\362i\277\242g\367\321\213Kv=D\177\351.\035"
+	.ascii	"\365K>\273R/K\307\333\226O\214\233s\311\267\337\267\205c\036"
+	.ascii	"_\032\177\237\027\177_\020\376\276+\376>\t\275 =+L\300~\344\375"
+	.ascii	"\276$\256\265\364\017\f\325@\264\363\263\020|\366;\254\331\241"
+	.ascii	"\275?qrz\026\225\334\224?\316\320\313\301\031\236]>%%\254\246"
+	.ascii	"\017\215%\304d&\311\3735V\017\334\354\335\354\3074\266\325\224"
+	.ascii	"\267\266\322W\030ZA\363\370rE\264$\345\035\350\375\356\016W\350"
+	.ascii	"a9\237\327;4\300\242\342\252\252@cd-j\007\025\376\322\225&\367"
+	.ascii	"\234\222\302\ta\3724\313[K\351(\335e\n\225\241uD!\2012e\226\267"
+	.ascii	"\216\312\032J7_G\351\034\276\"\035\265\361\004?\214'\340\261"
+	.ascii	"e\r\211\365\366\337t\341\377\372\311\211&\t\022\016e\336\272"
+	.ascii	"\t\307}Z\316W\350\240\246y\373^\343\320L\236\220\255!\037y\353"
+	.ascii	"\033\317\032:\247\255\244\274\377\306\215\177\0069|H\313\262"
+	.ascii	"V\f\253\374\003\206S\311\022f\033\226r\367\205\2264V\306\003"
+	.ascii	"\0318\212\225r\255*\207U\306B\262\362q\344\354b\036\221~9y\213"
+	.ascii	"\321\001s\031\303t\203K\312\026\302\234\023\n\3562\005\023&\216"
+	.ascii	"\350\250\311\031\025\324\327\2237\030L\231\206\227\016\036\322"
+	.ascii	":\030iu\370\003!8{$\021\345\244%N/e\252\256Xe\311\200\362\001"
+	.ascii	"\206sAFZDE\306\231\027lf\213\225/\374\264j\352\222\272\222f\027"
+	.ascii	"FS\234/\2448\301de[\232\032\222\324\307-\007\311a\372\251F\202"
+	.ascii	"\350N\n\265\343I\n\325\354!e\202\233(9;,}9\2552\217*f~\312\312"
+	.ascii	"HL\234J0\0318)\223\354\206\251`,\372\351\0341f'][\232\235\341"
+	.ascii	",f\276\314\254p\254a;7i\\v\303s\370K\257\222sf\220g$)\303c\270"
+	.ascii	"\254\34509\213f\312^\364R\236\323J\032\206N\352$=#o\311Zr[\236"
+	.ascii	"j\245v\241\215rT\027e\273\034%\253e+\031\204L&\327e,\231-\213"
+	.ascii	"\311_2]\226\3463\231I\376\200&\312o\271L\226\222?\310]\362\025"
+	.ascii	"\335s\223<E\277\32012Zv\222=\310p\332F\256\222C\310w\031L~\242"
+	.ascii	"\2074R\216\313P2\227lF\037i\031y\214\256\241id\271L%\247\351"
+	.ascii	"e>\303\320\354\226\313>\233e\334\026\205\345#Fd\027g\003I\232"
+	.ascii	"\222\022(XK\031/X\314\026/l\377\331*_\341\220\016\345\344oH\247"
+	.ascii	"\027\271\250\342\204\232\212\2222i\372\341<s\332\242\345L\362"
+	.ascii	"\217\277\226\27499\335\360\264\252\013\324\214\022\034[R22m\377"
+	.ascii	"\231\311-\327\250\352\352\372\317Dn9\306\030\2324bqky\3571h\004"
+	.ascii	",aNV~\370\200\362\034R\266\005\302\363\212l\2126\343\013j\307"
+	.ascii	"H3\023\223\004H\001^\034\251y\021\341rP@>\350\332K9u9\214^"
+	.ascii	" \321Z\336\246SJ6\327\266\261\265\366\024w\004\223e-nGDy\247"
+	.ascii	"m#`\316\336\273\216\257K\23033*B\204l\"rrR\234f\325\333\324\220"
+	.ascii	"\337D|K\274\356\332\"4q:7\220^Z\230\325\223)\317\003\271d\326"
+	.ascii	"\327\375\006\222\2236X`F:\206hiy\365f\354\260r\201\345\343\337"
+	.ascii	"\307\206\302:O\242\270/g\226R\353"
+	.string	"\242\221\367G\270\321\243\307\005)KE\244S\034,mFRw\274\371{Gs_\341:\374\354\314f\362\013\001\242\246h%\231v\345S\206\237\035QU\254~_U\351\335\215\251Im\252\337U\37754o[\250\204\225\361-\365{\312\211\311\313\2200\376\277u\\U\261\362\245\213\377\016\221\03496\224\224d\021\351VM\322\\YV\336P4WA\250\2244\231\314\355\224\001\226\267\255\255\335\261\270\3045\375v\372\271qA\325\345\275ql\245\032\267/\036Nv\214\230\230\266\r<7d\365\304\207\004f\347\265k\374\266\241\253\222Oa\362\3364\236\355\327\345\253\b\330\033\377\030\037c/\361\bYcf\340\275@\213z\260\227\277\227p\214\220\240~\344\275\217\266\022\217\f\217\246\263\255\264\223n\260\2301\226b9\037d%]m$}dET\272%\357-#'\225`\230\250\240q P`\024I\333F\333h+#"
+	.ascii	"\201\2305\237\r\272!\346\213\337J\035\305\305h\255\271\261\355"
+	.ascii	"\032kH\334\220\334\335\355\":\2343\020\314`m\242\337E\274(\\"
+	.ascii	"\302\f=\033\216\231(!4\362\336\311O\343\201U\255e\311{\367O\313"
+	.ascii	"A\003\203\303\3724L\004\355\310\022-;\2733\235f\2312:tf\214\201"
+	.ascii	"\3521\032\353yE\235j\313\331;\263\002\034 \\cDy\277\316\221\030"
+	.ascii	"1\230\f\207u%\233\027KwO\246\275\267U\260\355\346@\340\221\367"
+	.ascii	"\347\300\325\3255\221B\001\003\006\177\301\317\236\264\201\201"
+	.ascii	"\245\t\035T\323i)\214\004D\256\312\024:7\007'$.\356\212S\207"
+	.ascii	"\027/\332\211\347\331\2234g9K[\266h.\230\331\223t\030\200\200"
+	.ascii	"a\270-*\035p\257\271\244\341\230\215\241\033\312[\277=\233\357"
+	.ascii	"H\311\310Q\336\032\004\035\365\3332u\233\n\341U\261\315U\331"
+	.ascii	"\261a\250f\323Zj\224\373\214\233\264/\231\025\344\034I\362dM"
+	.ascii	"\313\277\206\242\243\350,\276\037W\r\036syc\241\261\033BT#\357"
+	.ascii	"\377]\341W\264\025\f\325Q=\3455\025]\245KG5\021\355\206\243f"
+	.ascii	"\022\330\232\"\315@G\265\024\r\305Q\346\263'sd,\311U\231j\320"
+	.ascii	"\220\363\226E\267\354\271\351\266&\034F\235\035\231\274s\006"
+	.ascii	"0\376?\256\t=\232\237\376x8q\242\235\360N\357Cs\316\2465\f\325"
+	.ascii	"k\332I+w\327T\332\227\313\n\376\267L\303P\235\206\311x4P\013"
+	.ascii	"A\332\227\317\n\376\227\344\257\311t\331k\2637\323g\274\367\216"
+	.ascii	"\323t\310U\231v&3CMX\227,aM^\237\275\234\257[\250\311\252\233"
+	.ascii	"\366\310\373\3534\223\377\257\271\261\3224\003\216\311\022\270"
+	.ascii	"\032IZ\372F\2118\257(y\277V\222\313\364\224\25460b\374q\376\357"
+	.ascii	"\365\241e\357}\006\357\331\227D\276\307<\2143\374\343`\215\007"
+	.ascii	"\360\377\273w\016\364N\024\345*\f\027\2226\344\204\241\377G{"
+	.ascii	"/\222J"
+	.string	":@j\251H\352\206\022*\325\223EZ\311\235e\227J*\241\275\357\364\242\242\344\006\315\276\243\204\366\245\356\"\313\022\356O\251d/j\366\235^\324\2070(\213\244\226\002O\334\200$\276*P\004C\233Wm\213C\336\273\376\020\221\253;\\;X\321\301k\\]7H\304\273\376P@\261\001\177\200\204\025\351\256B\306\022'(<q\003\262XT\203\304W\005\352A\276l\212\236 \343\217\005+\202\214l\321\002\016\036\200\036>\254\350Y\205A\305\240\221\355q\221A==*Z\227\370\266F\232\241\272\026\367\2134\266A\336\3605\262n\2617\342\304p\304\273\222\020\262G\341\221\002\025\236\270!\350\366\004\207\022D\330P@\206\020\026\203Z\"R\302p\204\352\303\301\341=qC\217\260\310\006\245\250PS<\002\225\330\2519\256\357\211\0376\005\215\261euN\354\234P\241v \264\272\307\034\026\305\3431\204\204\327\310\246"
+	.string	"jE\\\350\375\b\205P\337\342\272\201\316o\205jb8\254\021\361cd\325\337kxYc\211\343\ta\204\017\262\356j\\\177\370s\360`\201\207\017+h\376\003\210\013@\\\320\373\017 ||@x\360\341\357\301G\277O\334\320cl\201\200\332`"
+	.string	"\204+\020\353\036{H\340\372\243\272\253P\b\023\302\365\347G-NX\261\n\215%T\264;k\013\366\204\212VhdU\330"
+	.string	"\005\235\3701\262B-P\3150(\205~W\340zd\201\302\330\262%\206\303\t4\305\266}"
+	.string	"\220\367\"\215\353\021\250\r\002\177T$\360US\bM@\0029\020\262G_\013\"\360\327\202\b\324iA$\006\337\326\370>q\203\220=\362|{\\\335\236\267m\335\236\233\021\030\t\034\n\331c\217\003\\\002o\200\205\354Qsp\f\022\032\331\nP\270Q\241Z \350\204\220=\376\214\254\2117\204\220=\352\274\301u8\224\360\272\353[d_\240\261m\301\272-\221\207\305\313\n\251.\t\3665\2529("
+	.ascii	"\340\266\257\352\256\020t\240Be\261S\\\203\301\020?\341\217\216"
+	.ascii	"\260\330\022\221+\317\n\304\2766,\324\342*\274\201@\002\n\241"
+	.ascii	"\253\252p\333\021\302u\035N\310\261iA\004b\200D\252G\025mq\207"
+	.string	"\205\273\n\265\301\325\005\022\221\252\033\374\375&\274\355O\207\275Qy\220\354\n\025\370\023\224b\025R\330A\002\001\205\352JT5\320\266E\240\273\032Y\325}\201\255\033T+\350\354\270\255\353\256\024\206\303\366\r\n\002\203@d\n5\302zd\361\0021p\327\267\310\016#\264 \002\215\354\013\364\340\303[\020\201\334\365\025B\260\n[\023\3065\350\256\034\240\260 \201\265\370c\fA\301\310\252$v\336\025\271v\340\256??\254\213BE[,\206(\266\356klE\020\203\306 \265(\001pE\006EX\241\026W\027\250Be\001\024\376@`l\331Wm\301\272\352jd%\360\"\203\\\342+\201gd\325\037\2335hT\205\204\252\020\347\r:\276A-\320m\337\026\250\367\032\203\332 \260X\\\203@`\373\006\251\024\212\357\333\272\304\227E\032U\367\345y\221m\233\0028\034rW%\006\367\n\244N`-\262\303\326=\336"
+	.ascii	"\035]\240\221\005\362\t\327\365\210\004\276\306\025\350E\006"
+	.ascii	"e@\250N\350\t\331\343oE\252\253\0334\262kQ\310\356\034\221\300"
+	.ascii	"Wu\201+T \340p\270\363\262@l\021\270j\200=\376\334\366\r\252"
+	.ascii	"C \361m[ $p8\324i\217+V\340*\344\006\005\201\303c\021hd!\214"
+	.ascii	"\360\002?\274F6\210\346}|D`\240\300\004H\360\340\206\327\310"
+	.ascii	"\266\307wE\002\205\353\253\026\333\243\273\276F\266\347%\376"
+	.ascii	"\260\305a\217\221U\201z\202.\262g\203\001Va\013\004\\\203\252"
+	.ascii	"\013,\256Bk1\347\267\330\026\333ex\271\374\302\201\312\220\221"
+	.ascii	"\255ig\322\310\360\277\311~\227\025\t\203j\250RYI\306(BFfFDF"
+	.ascii	"\222$\351\302\n\020\206DQ \330\320\003\022`$M\2173\346fF\222"
+	.ascii	"\024\324#\373\261\031\003Y\364\255\243*{\024\274\364\362\207"
+	.ascii	"j\3108\270\363\332\007V\225>\003KJ\211\017\274\210&\036\201\212"
+	.ascii	"B\302\355\203aw"
+	.string	"G\313\035Xh \214\333S\222\362y\372d\313*\206L\027m\272o\033\264\250\b\244\223\212\274\356\207\375S\202\334Cb\330\214\3448\264f\307RE=S\2339t\306\342V\033\212{\376v(\340\313\226\202wu\277\256\030\341\244\266\330\236\245\027\222\331a\"\345\227;\266\016k+\026\217\221\373\201K\206\020x\244\027\007\007\352\310\234?\343;w\371\301\243\225~l\363\333\020\254\023\315\204h\362\bA\006\007\364\205\004Hf\f\030b\0312\212\304Hd\220T\026z\262\001m\263bd\245\203\230x\017Q\353\2262[\375\260\273}R\303!\006bX\344\341\026\337(H\006\324K\220\026\036D\224\253r\013E\266\213\271\031"
+	.string	"XMe \355\346\361\206\252\314\343\223\257Q?F\300h\352}WY\275\257\nT\322\034\364\032+q\321\260\362\336\314\366"
+	.ascii	"L\201\320<p\332+\247\300\334\347\310\274\351\354\004\364\022"
+	.ascii	"\203\035\321\r\227S\\\354\316\026\034\003\"]\317\215-\353\253"
+	.ascii	"\223y\323E\361\271\006,\316\302\n9\322\\7\r\347\347\b\256\366"
+	.ascii	"\031\236\320o\347\221\366\356=\001%\242\036\237K\341\tN+\265"
+	.ascii	"]\020n\207\270\217`t\353\330\312\264 \372\223\327BBBwf\277\263"
+	.ascii	"<\341\177\320qz\276\244+\002\tH\261S\321K\373A\277F\026[\211"
+	.ascii	"\211\353#<\t\253\013\321\202`*\305\306W\312De\365\3342\350cO"
+	.ascii	"\237\240K \037\347Il\376\f\237\303\273\311:\244'\034nFF\004*"
+	.ascii	"\r>\272R\215\333\n\224\217&\342\213\316\321Mh2\311\332`\240\341"
+	.ascii	"\321\271\037\031o\023-\221\224X\263\274\366\t\276;\331\266\232"
+	.ascii	"\037\245\n\251\320\274(\026\023\312$&\235\332\230I\345\r\211"
+	.ascii	"{\203\253\244r\322CNn\327\034\022q0\320\f\007\303X\261\343k\215"
+	.ascii	"X\031u-\223}\033\346R\267\316\277F\325,stP#\223;5\352\250\024"
+	.ascii	"\030\023yv7\005\"\2345\001\032T\210@\353\353\3320\033\334$a<"
+	.ascii	"\230\337\302"
+	.string	"\017@\003\222\357\001\007\234\027\004\342\016\214|S\023\235`\322w\213\016\002'A7\016b\222xPo^t\206H:\323\263\b\266OP\211\232\024\352\372\2452w\350}U#\277L\330\204\033\022\034\027\310\n%\337=\016\331\025\255p \rhd\tEFa\350\037\020\314H\3451\203\017\371ka\245>L\036+\351\025\245z\rd\3454\36388\254k\362\032\355\031\334\267/yb\243\021\\Q7.\020\342\003\325!B\351\340\036\352|\255\314\256\342\260\272\217\311\021\214\362\214\276\3475)\352\331\004\2309Hi\020\216\305\036\"#\245&\201\240\020\221@5\301\335\201\267'\242`\214\241\036\332\230\315\247\312\005\246r\255\365;)H\007W\310\222Q\324g\347\257\246G\023\200\275\037\356\332\020\220*\375\324\226\017U\302lC\007\361FO\325w\234PJ\260\020b\344\033\222\331\211\205\211\031\215\207[i\362H\311$\222Y\022"
+	.string	"\333=G\265%K\270#\343M\220\270\032\rN\"\377\360 \214v\225\b\0316\022\212\266xc\260p\255\353\365\021\314L+\223\276\346\355\360\201-\347\256\216~\331\354\241\236\377\235K+\315\314"
+	.string	"\022\322\233\273\233\003U\267\363\034\036\304\006}\234\340\373\357\235\307\310\312\271T\201\335Y\321)@\336\t\357\336(\317\332$\177\002\344Zc\r\005\235\260\364W\307\037\002T\365\334\354\2561\264\301\035^\002,\r\224\262\253\314+\005\217\332Sz\354\2312\363\344\204\345s\316\362\336r\266w\3579H\234\373\001\022\f\032%9\035\273\243\215\334\370\336g\343\027\322h0L-\263\206\303\347z+C  \377\034>\203\3627\261d-qz\230\323\177\0331\217\277P\354cp\207\326"
+	.string	"\242\335B\3054\347\365\373\361\236\"_3\267\3470\376\247\366\325?\230C:a\263\3742\315?DC\003v\247\305+\263\313\202\304\033\034\265\256\364\216\005P\242\225C-\267f\223r(\261\322\321\305}\262\327S\bRk\253 "
+	.string	""
+	.string	"\301Nk<R%\351W\200\264\275\344G\342\022T\276\021\251X\245\005\307*3\351(\261\251%\037#\277\004\2043\rri[\327*\024\0071"
+	.string	"\256\330\215()%\355$\224!\023V.\374\b\371\331\232G\017\030\220\2153\f\327\345\210\250\337\360\f\261I\346\211\243?Z\312~\2376\016\026\232\227\2169I\232\361\370\274|\022\305-\301\255U\331q\253\234\261\240tqc\020\350I]:\351\\\271.W\276\013_\314)\320\301\344\274I\224\315\004\t\356R^\351M.d\204\343Iy=\223\007\231\351^\271\313\307\016\314k\203\317\\\312\226\223L\377\016~\313Xt\\\277"
+	.ascii	"\332\005\263+/=\016t\377R\031\336o\0256\031\267\262&W\0017\300"
+	.ascii	"$.\323\354\032L(\200iN\343=\013\013\007\226\177\351\002\341\312"
+	.ascii	"\267/\004\231\332\376N[,\202\003\230\315\251l\221\212\027vqS"
+	.ascii	"\007\375\f\232\364\032u[{\306\216\233\327\346\b\312\275<\322"
+	.ascii	"|E\320@F\372\312j\\'\006\021$\266\357\001,-X\327n\373\267\371"
+	.ascii	"\373\177Pe\253\312\262\0313NA\025\306\251\303\201\027\275\220"
+	.ascii	"9X#\326E\235b\364\325z\017\243|\272H\370\304Ez\250y\300\251\213"
+	.ascii	"\255\363\213\262\273\376\306\332m \316\212\271\325J\342\270\352"
+	.ascii	"D\244\372(\253\327\216;\030r\323\347\356l\221\260\036\242:\256"
+	.ascii	"<\013\226\226\256\022\n\323\212\342\271\371(\377?6\343Q\214\311"
+	.ascii	"\335\227q\226\351nO\\c\036\203\356\346z\345\366tiz\216\346{h"
+	.ascii	"\026S\327\220\206c_\037?y\276\365\177\036o\374\237UO\250]3,\235"
+	.ascii	"-\345?\021N5?\227I\017;\355\334\254\026\267\245\313\315\360\323"
+	.ascii	"{\346\344\222\275\262x\341\0348\277\371E\350\325\356\2704\034"
+	.ascii	"\237\020\377@\323\367\337p[\205\rC'\337\323\347Q\005\247\341"
+	.ascii	"\341\034\243\335\217\262V"
+	.text
+	.section	.gnu.lto_.symtab.ac9afbd002e1239,"e",@progbits
+	.string	"interpolatedSpInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"setpointDeltaAvg"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"interpolatedSpApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"applyFfLimit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"shouldApplyFfLimits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"pidGetFfSmoothFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"pidGetSpikeLimitInverse"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"pidGetFfBoostFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ac9afbd002e1239,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2702 @@
+	.file	"mixer.c"
+	.section	.gnu.lto_.profile.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\210\004\335\025"
+	.string	"\344\034|\005"
+	.string	"O"
+	.string	"\350\332\270\264\n\234\001\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\001\002\003\003\002\004\002\005\002\004\006\002\006\002\007\002\007\005\b\002\b\t\002\n\003\352\263\360\321\b\006\240\342\234\212\n\007\b\t\n\013\f\r\016\017\020\021\022\023\024\027\030\031\313\241\312\356\001\036"
+	.string	"\002\013\002\f\002\013\002\004\002\r\016\004\002\016"
+	.string	"\002"
+	.string	"\032\033\034\035\036\037 \373\365\205\353\r\b\007\002\007!\"\353\252\315\223\t#\234\363\353\250\003 \017\020\002\020\004\002\016$%\313\206\250;\016&\341\350\252\241\006^\002\021\002\021\002"
+	.string	"\002\022\001\002\022\002\004\002\023\024\002\024\002"
+	.string	"\002\025\t\002\026\016\002\016)-.1\350\300\306\254\005\0022\354\206\342\366\0063\260\216\270\207\0064\333\207\312\212\004\0025\304\204\356\361\013\006\004\002\0047\345\272\277\270\016\004\002\001\002\0279\311\251\326\357\017\022:\273\355\313\341\006\n\002\030\002\r\004;\323\225\374\231\n*\031\002\031"
+	.string	"\002\032\033\002\032\034\002\034<=\322\245\257\357\005>\220\236\340\376\004\n\017\002\017\032?\203\341\306\354\b\016@\202\335\331\235\013"
+	.string	"A\343\252\334\277\001\006B\346\235\352\343\r"
+	.string	"C\256\330\276\211\r\002DE\020\002\020F\237\251\231\266\006"
+	.string	"G\337\357\263\274H\316\317\221\317\017I\216\205\223\310\017J\314\311\255\300\001K\235\206\367\317\002L\206\270\257\235\016M\222\254\341\316\003N\221\260\327\363\002O\207\254\251\246\016P\325\233\244\265\013Q\334\356\363\332\tR\335\372\220\202\003S\247\327\342\262\fT\254\275\261iU\321\256\205\311\017V\251\323\316\250\fW\201\340\323\240\001X\204\206\332\243\016Y\320\343\254\234\rZ[\346\213\241\374\007\\\267\373\263\327\016]\240\342\234\212\n"
+	.ascii	"\200\202\250\241\301\300\214\310\005\005\205ie;\300\002\242!"
+	.ascii	"\232\007\022\340\0233\206\035\032\033\n\n\322\312\264\177\006"
+	.ascii	",\336R\311Da\325\273\210!\253.\001\236m \236\021\373S\216!c@"
+	.ascii	"\232X\232\343\240\247&\207w\247g\210D\353\352S\235\357\034n\216"
+	.ascii	"8\2013\027\333R7Y\374\232`\bh\331\323Cw\203\343\3100\260\316"
+	.ascii	"S\330\354;\223gE\037\245\177\217\210l\211\rB\324+\215y\315[\022"
+	.ascii	"\n$\350z\376\333,\177\334\273P\265@\025@\304\224\026Q\234\300"
+	.ascii	"\036.1\210\331\333jM\367\234\206\036z0\205\024\350K+9\354\177"
+	.ascii	"\316\221\027]3\364J\327B\013-8I\024UD\021\220\246o\204\211\233"
+	.ascii	"\366\365b\240\324\344\f\334\030~\276{\r5BN\227I\231\374\232\346"
+	.ascii	"\214K\245F0F\007\270\n\246\334E\1773\367\253vY3o\f"
+	.text
+	.section	.gnu.lto_.ipa_sra.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 \370E\004"
+	.string	"rE\021\035\240\267\320\001\377\377\377\377c\377\377\203\230\375\377\377\177GDJM0\367\341i\330\345N)\316\304\020\3630\r[\360\t;\020l`\001;\255t\264\3203\235r6\223\231\313_\257\314DQ_\310\357~\035\257\341\"\034"
+	.string	"0\345t\206k\031\246\032\266\r\207\235\262A\261\313c\313\217\311rq\203\036\301\005[h\247\005\035`\f\022\350\316\fB3\006\204\333\025\341\242\002\177\3110\307\343f\006\234t(\021^\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`J\004\025\023"
+	.string	"v\032aG\340\262(\215\001\311Kq :\253\332\037\266?u\310\316g\207?-V\205\030F\300C\345S\013\373\221\245\322A\266\006mh\376\330[\373:0\303\\\3443g\342\233\373\017\262\334\236\277\013\007qR\217\030,\b\"[\312\024K"
+	.string	"R"
+	.string	"P"
+	.string	";\033\237Iw6/](\376\00443\217(\255\351"
+	.string	"\341\021\360\350\314I\255\375\336E]\314\250Y\2218\\\324\247GE\216\\\255\222?\030K\322Du-\351\356\256\276OE\235\\\220\235\342\350G\225\356 1\242D\262x\225EX\002\241\035\230Fn0\b\320I\205\354\256Hf\020\027pP\325\317R\364V\240\017\300\233\324R\032Cp;\245\275D\031>f3\031\216\020\260\276W)\355\025s\205n\274b.\360\003\231`\276(\217\036'R|\350\2403\272\030\265k\\`R\313{C\324\301\002O8i\214\r\206\314'\223\255\313@\374E\232\347\251\2126\234\211\027)\263D\035\263\234\037\230x\233\345\374L[\202*\312\204\260\035Q\264\ta;\241#\240T\304\356&\360\371\321\002\305\200!\234T\266\273\242\223\346\036\374\310\037"
+	.string	"d\212'\250\330\332\335\3777\372\315\356\202k\030m\322\335]\224\370\257h\312\311\203\262\345[Q\017{\247\311\344\f\211!^H\013!\276/y)\215\325\360\340\200W\350\211\261\205\267Z\016\207r\313\303|\244\331]\221)\264X\341\rLE\032Vx#\tg\250!5DF\310\304$I\235\016\220\"\022\262\242\007\021"
+	.ascii	"\2453R\221\200H\306\244Pw^${\252\263\376Fw\035\033\343\254\323"
+	.ascii	"\216.\242\355\013k*\017\2005#\202ORc\203\270p\302\205_\265\255"
+	.ascii	"\211y\2761zz\352(>u$\237}\330\335\0028\224\300(\357\211I\262"
+	.ascii	"j\375ij\364\333\311v'\322&xy\2614 \300\235\276\025$eA\270\234"
+	.ascii	"e\230&\362L\251@}+\220\333|\242\263\311!\036P\265y\001\363sx"
+	.ascii	"`\304o\377\221FaA\211\314\272\371\257iN\261\021\356\310\265\341"
+	.ascii	"\177VlVy\034\264C\211^\247\210\234\r\270\254\225\374,\032L\337"
+	.ascii	"\005\344\364\243\351w\330\036<pP\247\236\301\344q\267\204\336"
+	.ascii	"\361\031\264\0379\201f\232\370\202R\220oN,\007\334\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\340\001\335\t"
+	.string	"\302N.1`M\222\0160\f\303\241\037\261\254Bw`\222$\241\021\364@\213\202!\230\255#d`\327\030\343,\300C\017V\020\210\351(,`\023\275-B\244L\001?F\346\342-\276\002C\321\326\226\234\220$\236\207\204F\273\372\021\017\001\3650\017\357\360\r\237a\370\205\002\202\001\201\256\316\246\35374]\224W\370\204\037\341\245?\370#E\216\220\021\244R9\362>\236\362N\243.6TUU\3651\306\222\233\327"
+	.string	"pXBd\024\324c\321\317KH2=\245c\2328\242\f\026\320k=\210lc\b\r\346\260m\371\311\323\366/mj\023\017\204\214\262\220Q\334\302\023y\332\326[\344\227k\0227 `\002\221sU\036\020\341\013\027'h\013\271\217\337!@X\227\023\205\216\344\336W\n\246\257\362\333\344 \025\271\210\344\376\261>\221\374S\271\315\242W\303\216\2138,$j\253\224&v\306qa\304\326\257\2600"
+	.ascii	"\301\275\320\242\007!\263J\221/\025\033\300[8\351\261\225-\354"
+	.ascii	"\366\022y\345)\360a\331\3335\274(\304\023\353\n\351\212G\002"
+	.ascii	"\355\016\305\036w\350\215\253a[\264\352\255\321\362\202\017\001"
+	.text
+	.section	.gnu.lto_.pureconst.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 P=\002"
+	.string	"\002\305\020\032pW\351\255\036\316\252\252\252r@\250J\377'\273u\3339\301\367\241\212\363\262\003\223\260a0\0053p\001\267\272\324\235\256\364!\372\240\373|\316\327|\314\\\2462\223\211|\3074\276\342\022w][fV\b"
+	.text
+	.section	.gnu.lto_.ipa_modref.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"5\006"
+	.ascii	"\342\207\027 \220+\303\001\377w\315\377\377\377\377\177\236\373"
+	.ascii	"\276\033\376:\372\376O\223\330F \237`\311#\224d\nj2*Fw\321b\205"
+	.ascii	"2Q7\327n1\236\315\303Y\242[\357\342E\016@\024\317\304\200\307"
+	.ascii	"\020;\350\t\275C\t\257\261%\275!\212.\350\272\3519\355\324S\275"
+	.ascii	"\222\236\207\247S\007\002\327\t- \200\202!\252\343\001M\034("
+	.ascii	"\270;\315\244\252\2348yw\306\350#XN\330\236\315\362\226\0306"
+	.ascii	"]\351\355#\027o\033\027;V\330\240\f\r\222\373\026.\342\022!\345"
+	.ascii	"\242\213x\340\220E\307\200%\313\020,\341\326\255\277\204cz\r"
+	.ascii	"0\306\300\342H\210\235\316\300\233\266e\314\304p\003\241\002"
+	.ascii	"\001;\205\t\241\r\265(n"
+	.text
+	.section	.gnu.lto_.lto.14464f960a7f2757,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.83.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 \235\245\004"
+	.string	"d\bi"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\305\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\006us\250\305\006uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\024?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.85.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 7\205\001"
+	.string	"4\002*"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001#\177\035\001\003?\202\210\200 }{\276\001y\275\001w\274\001u\273\001"
+	.string	"\004"
+	.ascii	")\"/\001Rn\031@\021"
+	.text
+	.section	.gnu.lto_customMotorMixer_Registry.89.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007\\"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\317\221\031\006yw\250\364\005yu"
+	.string	"\005\001\006'\001\200\001\005\001\006\035\001\b\0048sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.string	"B\b\021\346\r\240I\310"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_mixerQuadX.98.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"E\004"
+	.string	"\362\305\026\"\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\253\006\226\341\336TTJEB&4\023\300\023lX\261\022w\222\0017\344\310\226/s\fG\005D\007\367\344\037\035jc\360L\256\3217-I\360IN\321+\f\260 \260\232\2017r\207\376H(\006\273X\007\006\275w\251\355.\302\352\276;\n\022"
+	.string	"5\003\303\237\301\310R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306\300h\220\305\200\004\360/u\030\006P\212\234\027"
+	.ascii	"\203\3471P\004"
+	.text
+	.section	.gnu.lto_mixerTricopter.99.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"-\004"
+	.string	"\244\005$\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200$"
+	.string	""
+	.string	"\200\254\325\252\001\204\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\002\244\304\001{\303\001y\302\001w\301\001\252\311\001{\310\001y\307\001w\306\030u3\312\0014\305\001\300\001\277\001"
+	.string	"\020"
+	.ascii	"5\002s\237\341i\b\b\335\200l\034\214F\016f[\bC\347\203\311x\006"
+	.ascii	"\022\203\340r\276\206\363e\234\030\226\300\007P\004"
+	.text
+	.section	.gnu.lto_mixerQuadP.100.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"]\004"
+	.string	"\022F\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\027\266\241\343\275\r\377\377\377_\327\300H_\377m\242\221$\003=\262\344\313\230;\205C\204\203\307\376\334 \274:ck\356\r\316\241\326\304\246\334\025\334\022\035"
+	.string	",\335\260\035\367\003\207 \022\202\\L\006E\333U\235\355\2422\247\301Rog\004\021"
+	.ascii	"5\003\217\237A\327\032@\331\007,\326\342\003\223\001O\300@4d"
+	.ascii	"\200U\001)4\200\251\300\001\246\020\352%9-\006\317c\240\b"
+	.text
+	.section	.gnu.lto_mixerBicopter.101.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 \275\375\002"
+	.string	"\004\004\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\202\200\200\204?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\013"
+	.string	"5\002+\234AN\005\276~\360\242"
+	.string	"\230\300\205\2343\205\022\fGD\226\023\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mixerY4.102.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"}\004"
+	.string	"2F\027\"pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\227\221\006\213\373^\377\377\377\277j\202\231,\336\203\372$\311=\262\344\313\230;\206C\005\204\347\376\340\240|jgn\r\276\3119\222\232\334\024\274\222[\032`A\340u\343v\340\217\034\222P\f\330\":\264Y\253$\306\242\251\255\"\274z;#\023"
+	.string	"5\003E\234\001\314\347\260#<\204q4\334hlL"
+	.ascii	"\363q\325\031\214FC\0260\037\305\216\300I0\007P$\347\273\270"
+	.ascii	"\347,\213c\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6X.103.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\302H )pO\032\003\374W\202@\216\253v\362I\257\277\376\372\370\277\256\377g\2224\350\336&\377\377\377\327\217\370^,\251D\034i;\311\273\344\311\2303{\376<\232t\352p\313\220(\250\344\335|Eg\305Kr\323\374DG\305\250=\220<4\347\350\"\200F\276\231s\350\035\314\325\275b\255\031F\221W\346\026\372e\333\340\202\300p\207\3741\207\320#\212\305\24022\304\356>\356\272\373\264Z3\302p\337}\215\036"
+	.string	"4\204\200\202y]\373\002\376b\\`2@\013\370\007\006\203\241?\307\031^\340"
+	.ascii	"\254\013\003b\215\301\335\024\300I.\224\341\005\202\300\272`"
+	.ascii	"\300\301<4p\001\376\222\204ar~&\224\006\226#9-\006\304\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_mixerHex6H.104.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`{\001\315\005"
+	.string	"\"\210\035&`W\032\003\017%=\202\222\237C-\016\271d\031\f\243#\t\021wi\221[\024E\313"
+	.string	"h\244\240\200\307\375\261\223\f\371d\312\2315\177\006M\272\264\n\361\353\2600\254t\326\336\202\273\264M\372iG\301S\232\013\351\242}\203\217"
+	.string	"\033\235\263w\340\236L\013Tt\313~\201c\336\003\301\357\207\016\331#p\t\243A\210\016,q\314tY\214\330\226\231\256\360\3133\235\"\033"
+	.string	"5\002\303\237A\303R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306`t\035\262x\216\004\245\007.`\004\232\f\200\362r"
+	.ascii	"\332\001\346M\205\031\f\355\004\0130\n@\021~,e\005\216\340,\212"
+	.ascii	"\017\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6P.105.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\202H +`u\322\0300\f8\021\344\270j'\237\364\372\353\257\277\202NB\002\217%\230\277o\035\202 \b\262\346Bc\336\b\240\340\217\264\235d:\345\312\2327\203\016]\332\364\n\361\353\2400\260\366.\336\222\273\262O;*\236\222\253\262\355\211\366Q\234\223\223\002\234\275\023\367\310?"
+	.string	"]"
+	.string	"\226m\230e\277\3041\362\f| \030\016\331#q\211|\262`\020\246CK\250\352kpO\325\267\315\251\025\206\272\352{\004!  C\232\352_\005\264\346u\311\003I\005\220\315\270/\nH\237\317\f\201\001\315\372"
+	.string	"\257"
+	.ascii	"\251p\360\026\200\335\r\3046\203{\017\2241q\230f\276\030w\003"
+	.ascii	"B\363\200\2575`28D;\341Y\316\r\231\203\203\003"
+	.text
+	.section	.gnu.lto_mixerY6.106.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\253\001%\006"
+	.string	"\202\210\037(Pe\2451,?\324\026J~\016\2658\034C\327m\273\231\004\b\351\243m\323dfff\334\311k\032\202F\264\207n;\311\272\345\313\234;\213\036}\0325Kq@\202\201h\355.\370+\016pjW\301\273\370j>\322^\202sq\2236\003\236\375\003\007\305C\252\372\266)\300\354\031\270&\276\231\330\204\301\330\222}\002\247\304+\rGA>\262\305\326E\016\334R\365iRf\2061]\365A\002\034"
+	.ascii	"V+\340D\313\204\034\031<P\320\007\223w\327g\20010\364\300d\001"
+	.ascii	"\0240.\f\314Z\006\336f\311l\357t\006\016\360\017\f\006\206\036"
+	.ascii	"L\206t\2100\247\267N)\013\312\340$7g\306\200\370\001\024\001"
+	.text
+	.section	.gnu.lto_mixerOctoX8.107.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\266\002\305\006"
+	.string	"\022\312%1P\253\322\030\333\266m\333\266m\333\266\215q\333\006\264m[Y\364\237e=\231\031\254\033Il\222$\233\231\231\231\211\210\362L\353\323\256j#A\204\244\035n\320\332\245M\007,\260\301\0073\334\260\304\023cT\356\240\\\3262r\r}c\347\210S\344\025\272\305~\021+\207\374A\207\330#\240\205\220'\350\n\373\002\214\217\201\234@\337\366\002x\235r\224\236\332\001\260P.\322G;\tr\004\373\232\223wt\317\376\301d$O\223Y`\334~\316U\360\275l\362\345v\316\332\004$ \300\243b\341e\002\316\315{\252\310\227\240\300w\214\215\236\305$\3707\230\321Y(O\t\377\006\033\232((\360o\260\241-\221\t\354\376\300:\203U"
+	.ascii	"\361\241C)\364\337\314\030\361\003(\002"
+	.text
+	.section	.gnu.lto_mixerOctoFlatP.108.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`z\002m\007"
+	.string	"\262\212'0PO\323\030\017\177\322A\002\t$\004\205\005\027HI\237\355L\355f&\005\331M-I\322j\316\314\314L\331`\340Y\225\334\2526\265\254\233\bI2\370\301\331\f7,\361\304\027c\334\261\307#\223\214\302\271e\3639K\311U\364\225\235E\272$\337t\223\375\244\202>r\020=d\027\251\242\214\\C\337\3309\006\036\266I\226D\221W\350\332n19\344\017:\304\036qQ\by\202\256\260/\\\306PO\023\344\005:\266\033"
+	.ascii	"\004d\234\300\353X\316=D\204\264\035\"t9\3674O8b\344\t%  #)u"
+	.ascii	"\f_\0054\363\332~$[@<\350/1&\016(\363\024\031\243\347e1\360@"
+	.ascii	"\004a\367>3\204\201\224A\220\234p\335\003\272\301\371$\\\\\267"
+	.ascii	"\201(\031\3705\220\354\003\240\\&\307g\205v\3027\311\013?\217"
+	.ascii	"\361\""
+	.text
+	.section	.gnu.lto_mixerOctoFlatX.109.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\316\002\305\007"
+	.string	"\242J(3pM\322\030\251\336e'I\222$I\022C\036M\036\033\36281\302o\2532\005\324\225w\262\266VJR\376\377\377\257_\235\017\207\374\366\367\032!\215\220\264\003n\203\255\025^\370a\210)\2568c\215?\006\271\204\263\312\246\263e\222\237\350({\312!\271\210>\262\223D\bm\344\034z\307\356\001ad\221k\372\305\216\001\241%\"\227\320\263}\002J\fy\203\216\355\016q\272\362\003\035aO\210\2271\323\322\002\371\200N\260\027x>\231\027PQ\032"
+	.string	"Fm\333\n\314~\316A\361\275J\263\344v.\272\002) @\303\022\267\001n\"\220k\006\240"
+	.ascii	"\034\f\222\255 @\320\215\030\214\304\327\200\204\336\317\fa\003"
+	.ascii	"\305d\240\363\r\b\214\\\303\177\203\035\332\217\270\375\331\313"
+	.ascii	"b\355\016\315'Z\002\273\036\210[\006\035\241\353\027\300}O\326"
+	.ascii	"\331d\025\276\007\217\350\314\030\361\303,\002"
+	.text
+	.section	.gnu.lto_mixerVtail4.110.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\265\005"
+	.string	"T\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\004"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\244\240\270\275\224\204\304\001{\303\001y\302\001w\301\002$\244\312\001{\311\001y\310\001w\307\001\204$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\033"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\230\017\347D\351\021"
+	.string	"\005A\f\007S\347E\0178@sR=\001 \201x\201\036<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerAtail4.111.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\225\005"
+	.string	"D\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200$"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\004\240\270\275\224\304\001{\303\001y\302\001w\301\002\004\244\312\001{\311\001y\310\001w\307\001\244$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\032"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\360"
+	.string	"\020\204\323/\347\032S=@\0173\300uR\021\0016\001sA\031<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerDualcopter.112.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 \275\245\002"
+	.string	"\324\003\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317\002"
+	.string	""
+	.string	""
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\244\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\b"
+	.ascii	"g\020\260 \257*\f\261\324gY\204\344d\030<\217\201\""
+	.text
+	.section	.gnu.lto_mixerSingleProp.113.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\344\002N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\bu3\277\001"
+	.string	"\005"
+	.ascii	"k\312.\025.\216\340,\212\017\240\b"
+	.text
+	.section	.gnu.lto_mixerQuadX1234.114.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\005\004"
+	.string	"\022\306\026!\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f+\026\005\177\023**\245\"!\023\232\t\340\t6\254\240\374\235d6\344\310\226/s\fO\005D\347\366\340\237\\Z;\346\316\340\232|\263KI\356\tN\311+\273\200\005\201\241\031w\003w\344\217\204b\240\213\350 \255fj\251F\204!\333\354)\016"
+	.string	"ek\300\201y\360\261\260af"
+	.ascii	"T\300?0\030\030z`2\300\b\352\200\r\311\211\032x\023\003p"
+	.text
+	.section	.gnu.lto_mixers.115.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`D\003e\017"
+	.string	"\224\026\020\004"
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\204\005\177}"
+	.string	"\005\001\006\035\001\004\005\001?\202\210\200\030{y\275\001w\274\001u\273\001\005\001\006\025\001\032\005\001\006s\035\001\003\302\001w\301\001u\300\031\002\305\030\274\027\234\236\274%\177q"
+	.string	"\275\312\026\301\025\274\236\264\245\037om\317\024\023\254\245(ki\006\325\324\022\250%\177g\330\021\274\020\240\245\037ec\301\335\017\374$\340\016\274\236\370\244(a_\b\344\343\r\364$a]\347\f\360$a[\352\013\354$kY\325\355\n\350$\177W\275\360\t\274\236\344\244\363\001\340\244(kU\365\007\274$kS\325\370\005\264\244\037oQ\305\375\004\274\236\260\244(\177O\200\002\003\234\236\254$\177M\203\002\274\236\250\244\037KI\206\330\003G3\210\0024\207\002\205\002\204\002\202\002\201\002\377\001\376\001\374\001\373\001\372\001\371\001\367\001\366\0015\364\001\362\001\361\001\357\001\356\001\354\001\353\001\351\001\350\001\346\001\345\001\342\001\341\001\337\001\336\001\334\001\333\001\332\001\331\001\327\001\326\001\323\001\322\001\321\001\320\001\316\001\315\001\314\001\313\001\311\001\310\001\307\001\306\001\304\001\303\001\277\001\276\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.ascii	"Z\250\221\264#Fj?\326`\223\304i\003\021 $\323\021N\003U\013\007"
+	.ascii	"\354\022\200\214i0\023\346\2316m\245\361\240L\203i\224x\221\224"
+	.ascii	"\3757@\032r\003\346\222\363\222\3165\323\312iq\312a\201\377\032"
+	.ascii	"\365S\320\t\323\b\206\270(6\037y\017\275\226\210I\344 \t!Pn\006"
+	.ascii	"e\001\301\367A\362-\003z\377\347\331B\021\245F\361&\360\013h"
+	.ascii	"\245\036\001\236\215\350\370\f5(\205\200AW\203:\324)"
+	.text
+	.section	.gnu.lto_getMotorCount.125.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 \345}\006"
+	.string	"\362K-4@o\222\016\230\016\303?1\374\232\004\030`_\364\363\003\266\fm\336$\342o7{(X\204\364\270\212\276\307\031\236\002!\302\207*\035\207\347\312s\366\333'[\246s6\257#Qy\334\247\201\241rXp\017\225\202\307q^\204\333\blAt\236\373X\326s\232,\333L\330\006F\215\342\033R\221\353v<\001\302b\245.\bS\n\033"
+	.string	"\306\bO\237\211\260e|/\331L?\216-"
+	.string	"e%\201$\223tjI\025\352\304\343\017\275f\203\203\320W\263\r\022\206#\245b\204%3sM\243W\361\272\005\351\345\243\304\004+\211\212\031\204\314\034\261\322Eo\375\t\376\202\337\"\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getMotorMixRange.126.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 \367\305\006"
+	.string	"\022\215/4Pm\222\016\244DX\205\222\257\n\332Q\031\276\246\230\333\370\340Xy\374\305\262\2657\025X\005wX4\303\216\233%\246\210\025\334\302\355\251jw\366\321Z#[\246k2\330\006\302\342\274\316\202\202\305\220\360\032,\004\316\323`\017/3\360\345\260\301^\347\272\260g\331\262.\204\016\363q\022_\220n\223\256\350\210GX\255\324}T\225B\027`\361\301\322o\036t\030\337)]\350\213\243\273\214\224\034\240dR\224V\222\204\022\331\370\263\267\334\216zdO\2326\rQMN&BT2\363a*P\225\232z\251J\271\214f\305\354\366\243\023\307(E\003y\212"
+	.string	"\006\2319j\240\212\356\372\023\374\005\377E\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_areMotorsRunning.127.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\f\001\205\r"
+	.string	"\326\331\\D"
+	.string	"\221(\035\274\242|\242\030M\"Y-\212\200\376\274\307VG\374\240\006\203\212M\351\324\274\004\f2\243\246[\006F0\354\031\344\305\362"
+	.string	"\272\252E\264C\375}W\031F\335\200)rf\321\307 ido)S\nI"
+	.string	"F"
+	.string	"I"
+	.ascii	"\362\324\301R\221\342xt\001\354\321\035\007B\356>7\234\256\002"
+	.ascii	"SZ\275H9\263M\351\264;\\\355\374\214\007\f\261\302\204\311\023"
+	.string	"\035b\031\276\001\274\021\334H)\377]K<\222j\306CJi5y\030\356x\333\013l+\260\337\005\266\252\343U7\334\247nU\3653\006\\\234hP\211\331\027S\236Z4d\213\210\302\303U\177\352j\337\276\b\177\305\232\217\370\f]e\226\riJ\357\001\353E&\300\0367\037p=\302\013\270\036\362?k\236\3526\242\031%\226r\034n\211\215\251]\341\2437\351\356\212\216\240\205\005\207]\2247\256\270\377\216\265\220\210A\322\030\377\033\3277\256\265d2z\211\257D\374\016\2660\2427=\372#\313Iq9\371LH\264eO\221.J\306\nD\n/J\332C<\232\307#\342\340\303m\240\255\003\300\037\034\016\344\202\326\311@\022B\264\t\0212\217\006\241\223}p\237\214C\300\033\005\020.\003m\033\227i\246\374\242\370\337\033\300\250Qb\351\337]\206\253\273\336\031\037$\214\013\311\216X\340\242\374\22538\321\n\026"
+	.ascii	"r\b\370U\323\240\006\226\342r\016\254\336\025\201\0232\343\032"
+	.ascii	"\215\220b\202r\315\020\204\b\200\212}\013\007\200\tX\255>\214"
+	.ascii	"\205D\021\035*\242p\227\0305\344P\223\267\253\224\001"
+	.text
+	.section	.gnu.lto_mixerIsTricopter.128.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"m\007"
+	.string	"\342M25`m\322\001\300\216\002r&\0038\365R\204\234o\243N\257\340=o:\260f\321\261N\325\256\2060\024\274\265\b\032d\f\031^u\rA\032\005?\221l\"eJ\001\266X\360Rqa^\346\301\341\202hx\021\027\003\346Y\340\304\263\b\214I\\\340\313`\030|U\334O\253\"\325\002\217~\234zU\275v1\220\277\206rz\275F\372\\\344#\215\357a\212M~\273\3637\324\235\323"
+	.string	"\fO\226\354\330I\325\260?\255\212\354L;\2475}J`t\262\200\262\013*\255\254\211#}\330\346\330\225\021\0228\316\0369@\357\310\320HTv\343\323\215g\317\314\177\310\035HI\312\026\352<\001\024v\327\271\205,n\275m\003\333\007\266G\002\r"
+	.ascii	"2\241\215\037X\307\304\2028p\231L\242\021*\020\327\3045\004\225"
+	.ascii	"\237X\202\345p\315\231\204\371\004"
+	.text
+	.section	.gnu.lto_initEscEndpoints.129.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`V\002u\022"
+	.string	"6avG\300\226M:R\201\033\265\207\034\003\347\301\257\260\\\177\233\324\254\267\032o\312d\251\233\373b9\361\217\250G\264m{\027U\210\212$t\026\3513_\245a\276& r\233\351 n6\304\275fw`\362\212F\354&R\246\024]"
+	.string	"Y"
+	.string	"f"
+	.string	"\021\220T\376 \253\370@\257\301\272\3145T\213\004\213\216\222\013&\273\233\340\321.\250\307\226\257\234\036\271\0178=\232e/}\306b_\364\263Cd\333]OW\234uN\223\345w0)\260X\353\234\211k\200X\016\327\262\273\017z\362\304^\231\035\314\356:a\261\022w\274m\006\266\037\330\031#H9\311d{\303o|\250\335U\340\023\201"
+	.string	"Q?8\247\307\324\024\331\205>\204\343\377\330\203M\036\366\350\333\234\036\257\235\317\221\223\023\256\274\331\263W\252\217}nw\327\332cw\227\3351\2469.\255\232\316L\037"
+	.string	"K\323\221\nKvG\334\2326)\366xq\331o\337!>s>.|v\036\246\305\026JR\324\276\3035\f\246\231vz\214z\033\327\221rybc\002\332u\035\346\027=G\214eRyXjF\225\207\031\301R\323\242\320\026W\273\n%\241\331z\301\355\326$g\327u\200\323N\325H\007\306+oV\345\264\200\221\016\223T\325\323\030\202c'J\356nK\325\307H\376\235R3\f\005\246yY\201!\370y35,\241\352S5\boj\302\033\007+0\004?\001\226yY\245>\250>/\244\231Qq\320\340uP\305|\236\314\312\306{1`\260&\265\362B\020\\y*3\327\271\325\036?\311\f\021\332\351'c)]\373fT\036\tP\222\\\372b\262\t\030q\rBGT\304f[\311\317\216Dd\202\220 \024\216\200X\370a\032*2 \220\002\231"
+	.string	"\311\016\3714X\017\355\331\020\\Q\330\303\206-\027\367\334\300\26151\021P;f\263\341JN\335\222U\362\213\2606\201\037\204\261\t\374 \214\274\263\302 \002\235\021\234\350\307\030\271\244#\245\225\303b\245,\336\206\315\036\317\366\025\347pZ\244\232\216\274\234?`Wl\234\005\332\343\307E\260\301)\303>#\341\266"
+	.ascii	"2y\300\322\345\266\353\351\001"
+	.text
+	.section	.gnu.lto_mixerInitProfile.130.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\326\001-\020"
+	.string	"\026\\dE\360\262&\035R\361\241\272?\265\223\247I\332\374pA\"i\264\265\321\312\255\212\232\306\3060\016\373\262\322\327m\301\030\342cR\f\323\215\262]*\003-\262;\242\316\227B Be\237\371d|\367F\b\331[\312\224\002O"
+	.string	"H"
+	.string	"R"
+	.ascii	"\276"
+	.string	"\210\200\032:\034\320\330\335\360\tY\234x3\302\366A>\331:o\205\330\333\324\270\320\274vwS\020?=B\315\223\237\225|\270\256\345\261\303!\250S\245\002\3502@\003\273{\025O\r]*3+\331]'\327q\270\261\333f`\033\201\235\n\0020,\330c\352'\346,.\303RJI\301\036\257\031+\007\210\007\317v\036\360W<\306\236\017c\025\273\362\334\243o\027\366\230\375\310A\361B\345g\267R\251,\373p\365\305\216i-\246\263\230\306b:\3024\324\264f:\237\001\2579\246_\221H\345g\250Q\343\214\325\216*\324\273\f\361\203\307\200\240\355\252H|\233\3030qH\224\347D\330\243\252\310\211\036)\274\3378\200j\027\365\302\336\211]\221\245\363\312\335mQ\243`\251\021fv\2502\210\355\321iP\264\335%\361[` i\001\016\215\230D\027F\244me\302\311\210\202\204\255\302\310\204\264\205L*\333\310"
+	.ascii	"\227,\210L\333J\251d\332@-\324\341\352\213\027\330\300Ai*j*\003"
+	.ascii	"\366p<\037x\310\264\022|\237\217L5%\200cU\"5\323\233\310\341"
+	.ascii	"b\265s\250\254\250\005D|370\365\032\330\245=\034O\324/ @\002"
+	.ascii	"c\210\261=\223\320r\304\270\023*x{c\266\021+k\244\314:R\205#"
+	.ascii	"\202\302Y\004$\223\356\210c\030\200\211o\204e\3102\203\3079\347"
+	.ascii	"\262n\255o3\345m\t Z7\240\033f \300\262+\214\366\020]#\004AT"
+	.ascii	"M\214K\263\341\024\211+\f^z\272\321b\367\364l\326\212\305\210"
+	.ascii	"\260\261\373:Dh~\036\345\232bT\234\336.U\006"
+	.text
+	.section	.gnu.lto_mixerInit.131.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`H\003\305\027"
+	.string	"\326i\224I\300VQ:\024\320\t\245\270\363\032\260\341\274H\177G8\313v\276\232\315a\322\361_\004\200\300\363\263\325\330\177\275 \224#*m\244\036\025\"\260\257n\214Y\022\255\354w\327?\322n\036\304,\220>u\343\333\2364\262\211\334)\005x"
+	.string	"y"
+	.string	"\202"
+	.string	"6\221\315:\235,\333\237\366q<\207\355\277\"\253j]\201#H\255A\005>@\236\326|f<\025\017`<\265\315\206z\360E=\020\250\335\322\260\326\032[\027\267=5Rq\247\315O\341"
+	.string	"\257\342\365\214\236B\361\221\325\323M\352\352\355\304\232Z\353\205#\246\210\364\025\021D\t\311\342\352\345\304\231\243\030\274\003?I\364ps\246pj\255\236\274\236\211\233\274m\021\266\027\330[\"KO`\243I)\3515\355\036\331<\317\263\b\226'\334\032y\327\367\361\037E>\f\373\314\346y\263\361\224>\351\242\224\3426K;\210\233\353\263/\326ma\257\246a\253i\231\325t\314j\372\245\232v\221\3230\251\351\3268\315\242\323+:\255\242\323\2448=\376\367o"
+	.string	"\232\024M.\224\265\036\225]\352\023u\222\341\363\370\322\320\203\336\023_n\f\331\327q!\321\203\236\320cx\032J\277;\031\226\253\365\226$\202\231\250\017j8\274\315r\326Z\215\350\316\330Z\r\027Z\302\217\354\220\265\326\033\337\310\017\005\037F\320x\332Z\325\357CN$\250\002\017\317x\312\332\224o\212\226\244[\223\355Y\300\027r'7Y0\223\231\306\323\013o"
+	.string	"\313\224\033C\021C\253\b\227\277\330\022\025d\rb\\\355\201\237I2\254\354\210\222\233[\254ZrW\373\035\222"
+	.ascii	"\325_4\216K\356wN\270Y\032\310\270\017\262\r\264\034\225{lj\262"
+	.ascii	"\0203\240\230\320\217\317\254\003\207\230\207Y\006\240XO-(fC"
+	.ascii	"c\332\007Y-&D\243\325b\254\340\355b\335\026\300\223HT<\335\026"
+	.ascii	"\227\202-\024\321\013\257\n\013)\302 \203\262\274\"\263\260\035"
+	.ascii	"\240DG\243\2652\373\032K|\214\353{-\201\030\345\216$1\353\244"
+	.ascii	"\201\231\326\013\257\312^\311c\366\272\031\256}-\035\242\213"
+	.ascii	"\202Y\327~\367\3456K\007o\362\200\2545w\3433\371\023\204\034"
+	.ascii	"\035\235\361\024f_6\250\004J\250a \006\225B\006\032\032\2310"
+	.ascii	"\005\005\205\351p\002\221\271Q\017\021\320=TC\005\315v`xy+y\240"
+	.ascii	"\237\202N\337\360\262\3110\242\370\2425\b\001\212\205P\305\355"
+	.ascii	"\320 E\307yQ\030C\364\356\320\256ZF\250r6Y8\030\020\002\020\220"
+	.ascii	"l\227Q\221\3531\006\256\320\360\303\327o\315V\354d\302\247\020"
+	.ascii	"5[s\037A\370\222\212J\"\033!\022\327>\031$\303J\022\244\253\227"
+	.ascii	"\206\016A\365\242e\275\213\324\344\003\316<y\242\265\374\202"
+	.ascii	"\375\202\260<\002a\ri\022\033\376\241<\363\n\262z\327\265f<\005"
+	.ascii	"\355j"
+	.text
+	.section	.gnu.lto_loadLaunchControlMixer.132.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\t\002\235\020"
+	.string	"&\235kH\340\260*\035\270\007\032\264#|y\327\351+\374i\215\241\234\257\255Q\214\211"
+	.string	"\177\240\177\002\313(\0335/\023\247\310\260\265\267S\007\251\331\321\243v\207\031f\230A\np\020\237\3452\\J\231\367jP\247\243\021B6\331;\245V"
+	.string	"R"
+	.string	"Z"
+	.string	"\024\204\305\177\345\rN\324C\260~t\242\374\230\023\310\351Zd\352\341\027\272\270j|\220,\337\210g\207\303\313\317\026r5A\017\022\257\327\r\377\276\220\034\0177>\310\013_\b\206\323"
+	.string	"\"Y\223\276\274\210\216\256E\276>C\005\273\353\331\"3\334\342m\273l\213\330sA2(\215\331ej\216xVF\230\276\330\237\317\356\371\351{\204p9\244\235]\f\275\035\213SiD|v\373'\374\322\240\243\270\f\365\231ob\312%\326f`9vw\344\325\007\304\327\001\007"
+	.string	"\276~\007\001_\0172\312\306\361\022f?\323\201e\305nw\307\273\235j\366b\330`\200^\267\022\273\233xA\243\361\321\230m\263=\013\234\232h8\326\354\261=\341.l\013\201\331\335\004-N\002^Y\234~>\330\360d\265\223H\346\304N\271\212S"
+	.ascii	"\033\273;\362S\234F\301\017\361j\013*\363\255W_\245\274\001\035"
+	.ascii	"6\036\215j\366h\315\205\027\244\233Dd*\251@2\031Q\0368 Ah0F "
+	.ascii	"10\031IL'\243(\344\222\204\022\323\210R*\231FP\271\247/1\027"
+	.ascii	"of\340\250\350*\2441\2077\365Cin\216|\322\026\337\300I/\243\345"
+	.ascii	"X\263\347\337\356.\210\340\223~h\212\216n\005\266\232\275YSK"
+	.ascii	"\277\331\324\310\334\002, \300\202\241)\333\006q\201\375\356"
+	.ascii	"H\227qR\356\262L8\037Q\004\277\265g\251!\005k\033\217\343`\202"
+	.ascii	"\372NR\f\356\203u\bN\245\206\365'\313Y\006\344\020\026s,[\305"
+	.ascii	"B1\226Cf\032\223\304A\326a\313\223[\335\tkN\332\t\256VN\210\237"
+	.ascii	"\031\0327\334\001\221\206,\3377z\335\316\005\311"
+	.text
+	.section	.gnu.lto_mixerConfigureOutput.133.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\303\t%3"
+	.string	"ZU\310\022FP\036R:\021\374~A)\322\026n(\340\272&#\361\223\272+,\3448\326\307\326\204\304\232\305\325\314\bF9\247\021\207W1\274\263\b\221<\321l\200\001\340("
+	.string	"\364\322\204\322\3705\036\026\265\276\355\023B\310\336I\006\031\001\n\001\033\001O2\035\375/\207\366\323Z\350\005\271\343\317\026\241w\263\276\227\376\331\273\3548Z\303\375\252\270~jm\315\274\367}\215g{\301\357\254\322\211\332\263\353\207\332\263\335;\272\205gY!\262{z4\261\367meY`\250\357\373\0363\223\240!\267\177_\321\336C\026y"
+	.string	"CBDAE \342\360GX\024\004\376\334\226]3F\366]\t@\255e\325\001\214\215q\202\207\236\\\350\311\211\240\2445qP\223\027\305\016\264\036\230\343\022[\007\244!\301\304\325\345\001$\312\235\366\362\336\356f\004\017]\ta]G\376\203\233\\x\253#/Z\207\212\260\325\335\355K\r\352\2540\243\340\340\222\222.\346\201s\\\314\"\370\267\272[\\u\237\343\372Z\235\354\324a\236\215\007v\251\020y\273F0#kB\\&\327\374EM\315\331\276T\205\353\013\263+\203f\033!\237\343\362Z\211\340,\301[\177D\236\211K\254U\351}\337\227\035+\227W\030\273\022\336\367m\254\265\354z\033\275\373r\272\273B\367o+a\350\252g?#W\267\206\315\316\016P\366\377p\002\275\303\302{'@\006\365ZW\343{\305\306\257Y\331o\264\252#\330\n\223\346\266\321\346\234\002*\305\302{\215\363s\316\317\022\""
+	.string	"\033\335Dk\224\237\237\365v\225\346jL\240\210\212j\317\032ea\230\\\325\353Rm\377\355g\244\372c\275b\n_k\252=\313&\343\250y\254p_7\332\025\316\316\356;\331IN\351\f\326\255\300"
+	.string	"\213\273\351\3207\323\322\327\336J,\356$\244\243 n\243G\337E  nb\213{\350\342\376\371\341\026\376p\007]\334\300\026\367\257\305\355\266\270[\0267{2\357u\305\235W\334x\305}\007GypZ\314y_ }|\3367\354\233\224C\377\265?\372\223\371\332}\267\026\"\311\264\331\345\261C\350\2508\336\326\300\344\034\262\356?\373l \360\304<\251b\276\326\037\243\206|\227\021\370\334\236T\035\1776\253\345\331|\206\351\253\351P\302Bc\342s\013k\233\222)\314\300\374\223\237\274\362f\323\006\2630?Y\245\230\203\371n\267\3205\215f\365\261\302}\271\245b`[?\331\331\2305\036\273\306\343\241\361O\373\257zf\0324^AV\266\360\303\245\236VQSh\201\231\n*\235p>\024\020\330\361a \262\333\003f`\232:\325\340\365Nu\223S\262<@*R\342"
+	.ascii	"\263\263\245\332_&\220\245\0164\356\247\007\323\035\317\205\243"
+	.ascii	"Xww\370\035\fHb\357\213\345\224w;\031\326\r\034Z\016\355\331"
+	.ascii	"\237\261\216\316\2263\241990\277\354lf\213\224{\315k\006\312"
+	.ascii	"\312\206k\201\362\247P\351\377\351W\2258n\203\003e\244\374.\274"
+	.ascii	"\250\233\351\\\353\316\245\3326\273\371\311\246\264\315\307,"
+	.ascii	"\317\246\231\327\313\330\315\241{\"`\327\217s9\036\240\360\265"
+	.ascii	"\240\332\2639\360\366(\231b~(\251m\210\356\306Ml\276\022"
+	.string	"\350]\367\207\277\t\241!\313X\363\371\276X\020\036\355>q\271'\267\351\343\311\346\371\276\257\223\233\307\215\350\217\235m\022P3\362\331\276 \315b\352\035\365\200J\352\306\324\213c\r\026+\246\\\2508\302\230B\361\342\030EE\343\370`@\307\220!Eu\254\021#\006\325Q\210f\365\f\326e\257 \367V\363\254\362\025\200\354lw\215\320R\316R\"\343\225\224\206\224\362R\316\301\247&)\177\255\033y\206\223t\324\250q\023#AZ\301\202\324\202\324\3226\376\302F:\212\334\322e\336e\332\263I\371c\216\313\314\360\204\2102X\257)\032\310\275\n\025d\246\254\234\236)\377\f*\375\372\276\357\033\304\224\r\344\034w{\222\315\253\342\007\354EdH\0308*\325\n\367\005\351Z\n\207\300\221Q\271\260A\347\200\262\263\243M\231\n\332\346\320F\226\341\255\216\036\020{\337\027\302\217\247$;\037M\031\030\206\246z\246\365\364"
+	.string	"\3678\264\033\311\005g=\025H\"\315\240\322\236@/Z}\313j[U3\304\354l\241\364\347(\263\322\"\343\213YY\314\304L!n\230\211\371Y}\2540\3260'\335}\017\027\246\327\260\230\217\362\237S\265>*\220]\236f7\326\335%p\325\023\022~\003\200\322\250\2010\304\030C\210hd$IRI\007\200\002\221\251\272n\021p)d\254D$\315\262\033\001\362\207\301\357\3778\024\3729(\021\035\237\255\272\203\270Q\263F>{\3762\273S(\266\013i\034.\331[#\325/D\270"
+	.string	"UZn\321H{\177\030\032\263\025\337j\333(\3053\"\330\360\201\264\235\352\370\017\273\323f\272\315\205\231*\001E\217c\026p7\356)5g\371\002NQ;@e\221N\032\204:\337W\215\260\215ld\350\222\375\254\347\020\"\252\3161o\275\317"
+	.string	"\257\342]_ \035/f\357\317\037\342>=\214\345\234\371\261\321\331\22409P\341\305\344:\313j\365\227\260\033\337B\361Q=\307\222q{6\370S\177\300\2365\243\313Z\261b\261e\250\237\372\231"
+	.string	"\005w\261;+\244\227\343!\016.\222FJ\307\323"
+	.string	"\353`\241\222\316ST\201\n\250\030.\024\242\355\300m(17\236\234\267\245?X\313\005\326E>\247\241@\332~\323\335\311\304L\375@\240\310V\023\324\236H\024<\305$0C\334(\226\r\2274\323Q\223E\022Z|\201e\342!\020\366x\204]\203E\t\256\261\253@c\312\272?,\037\265M\202\210\255\032\001\227\326\024\374r\025\247\343\335i\334y&"
+	.ascii	"\026\017\246\335\005\336`)\363\260\006\300M\204\357\323\261\322"
+	.ascii	"\201\"_\243<\035A\245\353\304\031\005\301\003\001\020\032\270"
+	.ascii	"\304\356\027\310l?5\334\016\267\013\222l\333\357\t\367*\324\351"
+	.ascii	"MN\206\004A\204\0244\244O1\343\354\003y\330\314\021\310k\220"
+	.ascii	"\007\270\177i\216\265dC\360\037"
+	.text
+	.section	.gnu.lto_mixerLoadMix.134.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\236\003u\032"
+	.string	"&\261\252I\260\226Q:$\362\351 v\332\254s\002;dc\b\211\376DO\020\177\035\222O\217\333\260H\240\363\301Vn\256v\253uFa\363\202;\360a\3357\322~\330\177r\340\024\216V\257\021\030\311G\321G\316.\372\204\020\262\345N)\225"
+	.string	"\212"
+	.string	"\230"
+	.ascii	"\265\272\260\201TkmY\001\371\320\300]\304\207\364,\361\241i\266"
+	.ascii	"\223\363t\365GQ;\276`\255\325\2650^\276\034M\236\362n\272\264"
+	.ascii	"\223\243\230\n\351N\232\337\373\3641\262\001\201\344rN\322q\204"
+	.ascii	"\211\032\227\211\202Jz\321m\216+B>\027I\237\247(k\205\221\323"
+	.ascii	"\213~@I\217\n\272\300)\307\317{?\200\243g\305\f\351X\242\307"
+	.ascii	"\t@n\004\225\201\362\344\007\227\263M*\204\342{\242\317\"e\017"
+	.ascii	"\b$\207\342s\214Pk\365\344\311\235\270Wn[\3116\004{k\263\264"
+	.ascii	"y9s\203\354\313@\271\335\360\002\331/.\037\372Y\337\335-\337"
+	.ascii	"\375,\377\335\253\373n\325\247W\302\351\324\234&\351\364\270"
+	.ascii	"\323\342N\207t\232\316\351\335\351\271\323\037\360\240\251\005"
+	.ascii	"\013\032R\026\310\253&\312)\265)L\262\361\337\357+2\240\303\253"
+	.ascii	"\271\t\301\246\035\301\373\360\211|V\"sz\310\337Q\tUk\215y\350"
+	.ascii	"\007"
+	.string	"\344\303\251\262=y\357A\373\220\210\267\324\n\224\004\251V^\313.\362\241y\344\247\375\035\347A\373\316JN\005O\360\304D\"\265@ D\272\027l\277N\204\346EW\253\216\003\333\024\236\004\013\360T\253\216\f\322\207l\24051\361<\261}\3570@_\224]-\334 \217K\373\262\313d\306\\\2658+\211\252\375\256\307DgF\235\326Z+U\355\313\206xR\336\204 \260=\334\310B\n\350j\255\016\374 83\001O3D\210\017at\301\332,=\227\265\273\277\351`\271\221\210\337\271\277\341P\355\367D\247K\301\337N\225\332,w\177%\242\fY/8\313\266\354\276\250\322\003\022\265\260\005\260\317d/\034\230\204\232\330\315\354\303\314\n\347\205\301\006\026z\206\201\354\205\003\253q\335h\240\201q\310\340\262\201Y\250q\315\310f.\006\004\034\353\360\222\271nb1\231K\305\253_\240\336I&\241\246\332\332\310\rr"
+	.ascii	"\036\321eC\031\251\230\257\026\267r\322cJ\355\312~\247J\315\025"
+	.ascii	"\216\304Bk\t\006s$\265\255\030\273\332,?\227P\211\302\215\253"
+	.ascii	"u\331C\005\2017\322a\246\201\316\247\021\203\330\314\nl\023\334"
+	.ascii	"O\215\265\344\356\221\270t\307\377x\270\342j\303}\321[0\210z"
+	.ascii	"\300\337\034J\301\302&n\220\037E\250Q$\243\220\204\0022\023\310"
+	.ascii	"\004BcZh1P\002!\307\312<\020hg\233d\031\003\021\344Z\251`t\254"
+	.ascii	"-;\222\037m\343\313\b\264\244l!\226=<e\3610@\353p\345\242aM\264"
+	.ascii	"@\216\t\376W\354?\024\262s&$c\2105-r\003\320\376)\243\362\017"
+	.ascii	"FHo\274?\016\370^%Wo)\f\322\374\234\n\203\240X8\273\n\357j\007"
+	.ascii	"\252\221\305C(;\342P\240[Z\340uo\274\024\faj\3543\214\255#\\"
+	.ascii	"\271\006\2023\305\340\370\3528up\230\350\\\327\267\212\006m\274"
+	.ascii	"\204\242\002"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.135.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\t\001\375\f"
+	.string	"\246\230XC \257$\035"
+	.string	"6K\217\016!\021\221k\b{%\321\216\330\034\357N\351C\353\203\213$\305\210\217\3142L\267\326\230!9@\310\3559Q\233\251\020\200P\3012"
+	.string	"@D\r\006\242\274\220\365S\204\220\275\245L)C"
+	.string	"D"
+	.string	"F"
+	.string	"22v\367\322\016\266\376\342\375R;|\232\232\377r\003&\234\215\013\035\276\n%\245\205\006g\341}rp6<>O\270Q>\020*\327\307o\230j6N\345Y)\330]\347\306e\270\251\333\316lo\330\367\b\037\254+\366\273\356\316\247_\021\330aQB\332\305p\232\2616\020\205\313\273\333\037\341G{N\3420\332;\323X\241\024\213T\022\001cw9\016\215\300:,\360"
+	.string	"\324\341;"
+	.string	"\352\360\036k\366\213G\017\373\222\313\205Jb\2521\3410\312\223\257\266INrI\200\213\335\375\37027!\301o9\364\204\221\221-\206(O\366K<\306%\277\305%\236\311o\207\276g\364\361\007B\250\320\321 \312\223*\tE\347\204*\213\035C\371\3111\t\330\375\321\221\201P\300B.\221\006\f0\007\013\256\007\230G\310\365\221E\270:\006\030\004\001$\273D@\240\354\362\304\275\256\274\334Za\262\021\351\b*\213\253\024J\251\336$\307SOLC\245\036&\346\246B\356\374\355\356>'x*\025\027"
+	.ascii	"1\003\373\334q@\343\224}Yb\326|\210\342<\2042T\212\210\232\003"
+	.ascii	"1\366aZ\202v[\342o\233\030\272\220\301\352\364K\023\201c\034"
+	.ascii	"\276Q\366BU\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_writeMotors.136.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 \370\305\006"
+	.string	"\322\214/5PO\222\016 [\036-\367Ki\305\320|BMa\201\355\272\030\243\264\376h\333~\264\216\261zo\260\356\237\265\331\231YFUc\201\241\030\036\370\316j\237\020\231\002s6V\207\202\362\300O\003\003\345\260"
+	.string	"\037(\005\017\344X\021pCp\005\321\261\340\247\252,\250\321\262O\224\360\261\201\036\306\223\353I\265k\340%\023\324xQ:\222\270$\225\236\270\\c\245{M\225\276\342\3025\356Z:\266\214\227\275\226\271\027\362\005\310'\372W\340\341b\241\222\2711#\223\233\304R\362W3\3660\325F\262+#\215\224\230\314\204O\244X\035vkR\201\030\312\352\002\0202s\027C\034\375\3657\370\017~\220\b"
+	.ascii	"3\001K8\023\350\370\032\327D\262\020\360\313\020\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_stopMotors.138.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\375\001\325\021"
+	.string	"f\242vF\340\360&\035\303#\341{eb\336\357\003\203~\214\302\023\225\210\361\n\300\203x\327\212&q\276fX\230\237\261\366\334y\220\017\352\177\327\245"
+	.string	"\303\360\204\031\326\t\316s\030x\033\340\b\021\246]\273ul\204\220M\244L)`"
+	.string	"^"
+	.string	"c"
+	.string	".\3671W\003\247\345\"L\242\204z\264]l\324c\242\334\262m\034\266\263\217\301\230\001\312\261\273\236zpw\rvk\331z\3244[~\317\0234\305>\360\345Q\343bj>\004"
+	.string	"c\264\221%\031\321\303'\r\370J-\304\315\365\341C\230f\037x\363\344\032\354\256\363\0035\334\333m\257\330\016\261\263$\257T\035\373#;K2k\216\275\245O1\335q\017\2727MG-\235\232>"
+	.string	"\004D2\\p\354\326\314\230\026)\022\201x\320o\337\017\272\217\037\032\005\3242\b\flA\233\335M\235\204\017\364\0227\321\362\0236\352^l\2720\026\223\355n\352\321\n\272G\220\177l\217\332\tl-\366G\374'\237ib\361!\224\024\225j{\354\324"
+	.string	"\r\034mwW[\360M9=\007\246\231L\207W\316\034\365>6\353B\216\t\330\331\335\021_\305WP\360y\036\255\262Z}7\\9sj\324\207\327\212v\20422\r]\304\200\252:\232z\231\030G\361\024\216\371<\276`\241\374g\241\355\361J\242\244\003\307\2253\033\026\252\373D\204\205\222A\245\342\261LHQU\220\340\255\250LT\274\023\026\006O\344\200W\026PX\036\313j\305\362P0\3275\307\021Z \271\364\345\002\311\340%\233\375"
+	.ascii	"B\317=\216\206\006\344a7Z}\314\330u\375+\37219\311\177\376\317"
+	.ascii	"=\2166 \301\350KT\035\237\222\224SM\312\3247\245\261\355\223"
+	.ascii	"n\352\340\005L.\271\323\223\006' P\002A(\245\007b\002\217ud\035"
+	.ascii	"[6\rC\324\301\315\002-\323W\236GC>\005\\5\037\251\234\354\026"
+	.ascii	"\347)>\333\020\200\342\202\200\316\007\030\327\354\246\305\300"
+	.ascii	"\335lK\222\233\016\277\017%\211`\266{/m\244F\334\255\211\263"
+	.ascii	"8\260|\332\r\034\303\356Fb\241j\274?\221\316\205\237"
+	.text
+	.section	.gnu.lto_calculateThrottleAndCurrentMotorEndpoints.146.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\302\030\035l"
+	.ascii	"\232\260D'H \214\333\031\003\375=\352\313~-e\n\273\"jI\217c\240"
+	.ascii	"f\235]K\306R\266n\264R\323\276\335\311X\376\250\203\376h\215"
+	.ascii	"\307]s\332\341\223_?T\201\364\340\361\316<,\214\230N2\022\001"
+	.ascii	"0\204\271\310\312\336)\245\024V\002&\002\200\002\316L\255\363"
+	.ascii	"R\353\254\364\343\234\324:#\265\316GA\316FA\316EA\316DA\316C"
+	.ascii	"Kg\241\245s\273t\016Z:/\203\234\201\202\234\177\226\316J \347"
+	.ascii	"\344\2173\273tF\0029\373\217s\367\264\013\023\343\240di|8{\356"
+	.ascii	"\332\365\004\227\rrL\226.\323}\246{\260\233Lw`w\265\233\257\033"
+	.ascii	"Lw\230\356\275Vz\322Yo\231\233\271\013\271\3154\032^\236!K\344"
+	.ascii	"\300\243e\200\020"
+	.string	"\351\304\340\361a\034\323\204\274$\303\202G\327\317]>\341\342\340\335\271\256\333F\331\310A\026\234B\333s\257$\021\347\342\340\361\361\003\344\026\344e\240\220N\202WW\205\332\037p\203\320}\035B\377\3612\f\221\243;\227U\267\246E\312\227\366s6\030\"\355F\3356\233\253{\023]w\257\243\312F\022y\037\261|E\216\256_k\251\333\242%L\331\310j\221\0216\250\343\262\245l\244\267\027^2\363\036\013\266\353\346:\033:uJ\022]\327\335\320H\026\241lgn\274\316s\266\236\221#\221\213&\207D\214\353\356u\340\f\312FNu\022\333\310c\037\261\215d'\263\235\336\233s\223YNH\343\343\343\272.\326Sig_]\260`UU\201jJ\212B\024\324\223S\023\323\222R\022\322\221Q\021\321\220P\033\264\004\372Q&Y\344\361\335\311\235\314\252\360f\370\204\023B\233Y_\t\366\205\277\266\020\330V\177h"
+	.ascii	"\275*LW8d\013c\307\026\202S\035-P\031\3134\232\246:d\013<:\365"
+	.ascii	"\035\251\322\204`|J\260\245\2724\205C\266.z\036\345y\r\365\304"
+	.ascii	"\245\235\270l\361\246\243\006\324:\246\273^\272\313\342J\324"
+	.ascii	"$,\0318\022\226+~\324gymD%\305\255J\027\3215\021\335\234\017"
+	.ascii	"Y\261\300\205\222Y@xu$\340\221\342\206\327-\\\007\035\223F\220"
+	.ascii	"\243\323\207lpG\rqi(h;6(\276\214;N\001\035\223\3262\210\366!"
+	.ascii	"\333\333QC\342\240\236\376k*;\266'\376C\245Lf]=\223$\342Y\245"
+	.ascii	"\270I;\371.\333\322\234\205\376\2459\262I\037\205\332\216\374"
+	.ascii	"\241\371\037\262\371\035\247\\\327m/\355jmO\367d\226\353\272"
+	.ascii	"\354\3216\267f\f\315\354\03607\024s\022b\357u\240\211]B\017="
+	.ascii	"\321\367\215\037\372\036U53i}~$\270\n}\373E\352\272\221\354\004"
+	.ascii	"\241o@:=Fk\373\375\327H1\257\031V:\377H.\n\007\032\027\364\313"
+	.ascii	"/\373\243\033\250\026#\037\364I\276\264>{\364,\277\305\274\205"
+	.ascii	"V=\007z#\357\215\320-C\336\346B\366\347\201>\231\007\032\247"
+	.ascii	"\374\237\357\264>g~\325\240\025\361(\277\005\033Y\346-\244\352"
+	.ascii	"\235\371u\317u\335d;=`\223\357[8h;N\017\350t\035'\325\311\305"
+	.ascii	"\231\347\314c\033\231|\022r\330\237\246i\366\307\252s\246<\251"
+	.ascii	"K\260\314Z(\274\243\354w\234"
+	.string	"\303<6ho\206D>7\234\216C\004\210\n\025|Q\3053f\321n\310\224\256\213\026\202\033\261\333\270\340\276\322H\206\021#\006\333H\344\367\335\013h\325s]\327=F\261?\276\377Z\251X\225\323\035\305\372\377x\366\264\367\351W\3466\3545[\334WxF\r\357h\215\327\363\002R\3373\277\366\377\224\301\330~\007\252s\320\234\221\221|\312m\034,s\016\006\274\243\375A}ml\254\211ho\306\274\367\364\2372\367_\257\327+?\006\314\255\327\335H\272\332\334f\315\327\334\256\263\3034\227u`\263\021\t\2124{\260Y\254\31343\373LsX\223i\376\002r\376\321:7\320:\353h\235s\364`3\216\006\323\274@\207i\276\321{\3156z\257\271F\353L\243u\236\321:\313h\235\267Zg\005Z\347\030\255s\002\2553\214\326\371E\353\354\242un\321:\263 r^\321:\253h\235S\0209\243h\235O"
+	.string	"9k\265\316&Z\347\022\255sV\353|@\353L\242u6\240u. \310\231\200\326yD\353,\242u\016\321:\017\320:\013\020\344\f\242u\016`\310\371\303\2203"
+	.string	"B\316X\255\263\207\326\271C\353\314A\310yC\353\254\241u\316\320:c\370q\276\002r\276\260t\266\320:[-\235\253\204\234+\264\316T\255\363T\353,\325:Sh\235\243Zg\250\245\363S\353\354$\344\334\324\006\3241S?\225B\300\231\235G\234i\336Q\3568p4`\n?e\266\016j\324f\177\325\007\247\007\325\356\327x\265\241(km\204\375"
+	.string	"\3007\222\377P\007\200\017\"\205c}\335u]\263\250F\254s\250\007j\316\033\2738n\316,>\275ic=\016^0\305\t\253\rV\033\017\207\035\336\303;=\237\\9\260y\262\247\203a\232\016\337d\310A\2043\034>\210\324\220\372&\317\356\270M\202U\205:\244i\356\370\234\371\225L\223\231w\221iPZ\206\n\345g\212\t}K?\335 \270\341\373\225\026Z5"
+	.ascii	"bx\r\357\204\370\366%C\030\3515\003\230/\031\276\351\013\006"
+	.ascii	"\276*\206\017\"\355\263\276J\272D\225\256~\310\313\237\225$W"
+	.ascii	"\357~o\234\b\0351t\223~\312\275\305^\370\017Q\376\250T\345x\227"
+	.ascii	"-\327\273\360m'\345\243\352\t1\271\200\002\244\033oA\r\236\205"
+	.ascii	"o-R\020\254\357\321O\241\334\340\242FV[\254~\351\271v\255\272"
+	.ascii	"\213\372\252\377\265\022\240\206v\035\3649\263X\264A\243\025"
+	.ascii	"J\313\347I\035\242\256PW\241\221*\313\347\211*\236M=\325;=\327"
+	.ascii	"\244\260\f=\327\246\254\320\251M=\323\0364RT\246,\270\204\003"
+	.ascii	"\245>\310\273\207\372\016\375\224)|\324w\006\3255EO\341\221|"
+	.ascii	"\320D9)Q\037\301\253\207:F\b\352/`\3015\016\364<H\017\365K\210"
+	.ascii	"\023\230y\3628\247\177\372#\037\324\020\312\023\247\357\016\336"
+	.ascii	"E\353\030\nZ\312t\347\314\"\235\366\247H\236\275\002wb\004\002"
+	.ascii	"g[\033\333\310f{\355X\241,\211\336\351\tr\266\223\t\333\364-"
+	.ascii	"\305\335\234\211\223I\023\247\023'l#\233\276\337\327\016\365"
+	.ascii	"ez6\351\2610\252x\246\364L\357\204\270D\020\252\3459\301\023"
+	.ascii	"\243\347\222/Q\305%%pQ\013\226\236\251\215\364Uz$Q:\252\350G"
+	.ascii	"\034\312\202N9\016\344@\266\221J\037\344]c}\013G\220#a\231\364"
+	.ascii	"o\247:\247\2033;\2518\351\274\243I\237L<4\201\315\363\315\232"
+	.ascii	"0\357n\016\350\247\254G)A_\223\300\244\363\027x\265\376\353\024"
+	.ascii	"M\336(\213\364\024h\023\275d\331\337x5\244?\372\261\252\232\241"
+	.ascii	"G\372#\240\007?cA\245\353\272#\330]7sZ\301\342\314\222\205m\344"
+	.ascii	"\321\353x\r\255c\214\276\315\212~H\214\3217T\313\002_\364\024"
+	.ascii	"\344\324\326\244\365!\372v\003]>\270\232_L\033__]ZF@\200t\205"
+	.ascii	"\361`2U\020\031\353j6\271\034\030\022\302|\321$\023k\222\305"
+	.ascii	"\200\301\243\313\353KL\214+i\214\331\334\301\225\"\214\351\325"
+	.ascii	"\344\"\013\353j6K\2141\233L\260\247f\027\220\036=b<\260\243\353"
+	.ascii	"\307\2160/0!!\314\027Ja\\&xpu\235\340\001bI\b\363\305\323\017"
+	.ascii	"\037^+x\200\340\021\306\005\006\306\324\3321"
+	.ascii	"\006\325\345#\214KF\223L,\214E\327W\263\311\034\373\321\004\244"
+	.ascii	"F\027\230\027\215fX\327\330\030\331\216\226wx\030\353\032\342"
+	.ascii	"\005\206\325\374\341\303\353\253\007V\230\027\027\030\326\216"
+	.ascii	"1 X\036\234\230)\3265\206\325d2\307\260\226{g}t\037\003n\302"
+	.ascii	"\356i_a\340\205\346\363Q\252\306\333x5\345\034+\233\263\177r"
+	.ascii	"\216\277\262\346\245\213t|\016\032\257\303\306\317x\032s3\276"
+	.ascii	"\275\364Q\314\233\032\353{\365Sn4\335W\372\310\350Y\211\375P"
+	.ascii	"\337\240\341\024\216W\343\237\016yKs\267(\343\345\036\306\313"
+	.ascii	"x\245j\225\353\326GyV\331\023U\334\262 \212\002\277\365\310F"
+	.ascii	"h\\\214O\340\025\370\206\332\3011c|\177\221\363~}\213O\340\303"
+	.ascii	"\252U\356<)\223\323\374\256\340\255\f\025\306K\341\032\243\212"
+	.ascii	"/\276\305\303\210\303\361.\376\30535\266x\026\357"
+	.string	"\342\235\264\370\237\367\233\260H\261\370&xa\305?\0237\025\277\202\021I\354U\374\223\032\013?\265\372)\177\264\265\036\331F\270\247\n\305\347\371\2652\022D\314\375\222\237\240\254N\331\2352<ex\330\023\217\342\223n\240\206~B'\276\251\261\255\226XQR\241\267X\255\357)U9h\316\370I\266J\250\241\365C\336\002\251&\276\304\213=\022\020j\367\364\353\247\231\370n\303\374\254/\361My\240v#\236\304g\275\003U\2725P\021R<\323HM\003\237\342Y=O\327\017\370\006\236\035\272H\342\r\370\003\276\241\"<\317\362\220x\017to\001?\342\r \340\013\b{\002\336\3353\342Y\2677@\252\2263\227\231P\326\350\035\r\373F\323J~s\352x\316\333d\216J\304\217U\r\321\234\361\204\262\253\210\377\301C\210\027\227\3672~=\002R;\3267\004\237\302\250\242`32\022\232\353\236U\r\360!\004\370"
+	.string	"~"
+	.string	"\020/\30074q\321\363p\241\031\023\022\262\215\004\361Xr^E<\001|\023\366\221Qj'\201\373\250\2014\005\225B\206fDDAA\222$\215\001\261\005\204 \306\2343n\021\3400\347\234\032\031\021\222\202\024\n\303\001Z\355\2441'\\!\267T\214\273\273\372\377T\260\237\376\326\237\342d\241\336\330\337\030\254B\264LA\016\232\333O\326u\265\214\3259\263\361S\204K<\342\305/\322+D\374]s\325\\\321\315\357\022~\3147\237\265\300^F\245\001\345\243\223\177a\"\021;\214\200R\236\341\220\316/\206[\244\300\352FTg\035x M\341qTK\023Z\3424\314\312\007\306\233\313\323\242N=\033D\271\210\006\200\327K\312/\023\306"
+	.string	"\246\300+c=o\375\f[A'\31756\342\031K\322\345\311\026\347\025\335)\302\276\376N\252\311\007\020\246\276J\007\343\023`\020\037\203\342\257\233\305\fW\374\031\217D\247\256~\234}\3360\313\250\026\310\035Y\221`\031\225\356>\024\370N&\240\020\r8^U\202J\204\323\037\227\323\202=\021\275\225\273\213\243\02768\200\246\007f\013e\375V\304I\353\214\241D*\037\274\305Sv\220\016\007^\302\037\312 \316\f\317y&\206\036aB.g\2030:\323d\276|\003:\030b\bUok\r\n\302:\037\203P,5\336\266\030\002\306\037\314\t\346\226\240\273/\3262Xh\031\033\367\n/\321\b\032\013q\227\301J_\301K\314s\277@\303\260\026\225\264\271v(\342\0379\216\300\264\337g\322\023^~\\\f\245r\224\261\335\375|$P\260\177x\273\302\207~\332\034\266\260\276\025\277\260\371\367\213\267XkQO\260\327"
+	.ascii	"\365\212I\031\203?\320LeX\013.S\200\244\325\360&G \205\006\016"
+	.ascii	"7G\3170\373\246\364\3569}\271\217\271\037\3115\360\242\353\020"
+	.ascii	"N\263\300\324\233\031\340\332.\240\003\32146v\357\016!B\024y"
+	.ascii	"p\321\350\017\t\326!\335\304\221k*A\rc\343Q\354\rok\364b\266"
+	.ascii	"]\224L\357\373\317:\273\020\2666\3652\205\231\263\2417\231\r"
+	.ascii	"\355>\324i\004q\274x\206\367a\312\r0\234f\354\277\3425\210.\347"
+	.ascii	"7\304\210>6\317J\314JS\321\241\255KP\233\326\204\005\023)\233"
+	.ascii	".K\277]\nMw\217a\204\005\300Pl\313\314\373\227\200$V\222\227"
+	.ascii	"\373\310\342\220\243Dh%5\213\353\237\321Q\343\240\216\005\202"
+	.ascii	"Ix%j\214\024\245\341g\273*%wC\323b\370\333-\212\020\034k\344"
+	.ascii	"\311\337\266\341\r\0302[\006\330\2405\202\355\331\354\201\250"
+	.ascii	"Z\340\214\231q\022C\333\226\2203<<\245\356\351\030om!\314\337"
+	.ascii	"(9\236[!\016\"\036\375q\302#\027\236\227>V\366F\007)5\264|\314"
+	.ascii	"\026\205\b\203\242\205\311i\231\303a\bUm\250\030b\224q\316\016"
+	.ascii	"\013)\355.\021\210y\200\262\204\252P\022\023\006\004)\334\016"
+	.ascii	"\363K\354h\203|\345D\312Sl\027+\270y\202\222s\252@c\214\031o"
+	.ascii	"\207\n\376\350\357\265\"\206\331k\263\205!C\007\222\202\343%"
+	.ascii	"\212\357\346U\"\206\2048\251\203c\264:>\"2pK5\340\241u\b4\307"
+	.ascii	"\234\032\026(Q\257\303A\350\213X\327;\220\035\205\013E\rx\225"
+	.ascii	"\034\311\353 >\324\276\230\2270\273)r\f\241\032\214\2171o\330"
+	.ascii	"/\360)\360\265\366GJ\037\265v\350\350\334\224\205!-\002\255A"
+	.ascii	"\037v\362?\020L\342\360\350\225L\031\031\337\232\t\305n\307@"
+	.ascii	"\342\321\344\0300\377\275\203\307\"S\004\005Pa\001+I\223`\007"
+	.ascii	"\3274\246\b\3477\342\365X\350\002\245\215\214sB\005"
+	.text
+	.section	.gnu.lto_applyFlipOverAfterCrashModeToMotors.147.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`Z\023\355Z"
+	.string	"\232\233\f\"L \220ZI\007-P\340\t\314V\347\260{e\271\320\\u$\277-\212\266j^_\346\270\243@\002\n\034\022N\344g\205\001@\211\n'\336\322\t~\261pA\304;\203\226U\2242y\367xn\230Y\360\327\342/Fg\373\215\354$\245\f\022\002\317\001\032\002\265w\247\366\"k\257N\355=\326^\264\366\326\367\276{\273{\331\002\037\3064IxJ`\232\"i\224\223\026\242a\252\260\"\363\031fDf3\314\206\314\204\314X\230\2650\3671\3731oa\346\302\334\205\331\013\263\223\031\f\263\f\314\200\314\201\314b\230\005Y\271\313i6\351<\263\214FI\035\336\225\033\226\313p\342&\315\254SJ\035\030$\342:\247\340\361\371\035n\222Q\303\005\344\016\344\360\344\372\270p\223\204\353\f2\203\222J\201"
+	.ascii	"\005\357m1\013?yo9\013\263\300-\360\037\273\300/0\f\374\205c"
+	.ascii	"\3400<\003\323\3005\360\030\036\334\244 \fub\274,\t\374\322e"
+	.ascii	"\200NE\031\212\210\t\003\246\310\030+\316;\301E8/O&]\310\254"
+	.ascii	"qY\347\035!s\260e\235wg\302\374\326Y(\347\016\315b\216\276&/"
+	.ascii	"\264\024\251\251\013\\\207\347\244\356\004\222Q\276\302|d\214"
+	.ascii	"\245\b\247li\333\220\002\336\333b\232\246Q\214n\t$\243P\254d"
+	.ascii	"\242#\2435I\266\273\006\311HZ\206\342\216\313\021\277\035\322"
+	.ascii	"4\255z\tJ\213\344\232\205\227\351d\334\304\264\244\224\204td"
+	.ascii	"\244,\"\032\022\n\002\372\361\351I\362\354 u\216h\275S\223-\353"
+	.ascii	"q\205\273B\230\226\244\214\233\322\3505\023\tl{\274Tu\214 \241"
+	.ascii	"c\303\265+\325*\316b\030>4\241\225H`\263\302IHy|\264B\2256\242"
+	.ascii	"c%\035\225.\242K\234\322D:.\016\031y\003\236\\\233(lVxh\216\205"
+	.ascii	"\244\314u\320\\\205\262[\223k \035\027Q\330\236\360\217\341\332"
+	.ascii	"\223\267\366q\302=M\234t\322\215y\f\327\332*T\232\246n\275\363"
+	.ascii	"!\n\033\023F\262\341\332\222\017vkLZG\004>2\2174\n\002\327\032"
+	.ascii	"\302\006\2704?I\320\252\322\333\240\022\0364\322g\263=v\252&"
+	.ascii	"\026\3010\262\341\032_U\"\241Kc=n\265$g\335:.\3224\335NK\302"
+	.ascii	"\306\373\304\273\rc\227\275v\203F\b\311;=i\\\306y\376tH%p\347"
+	.ascii	"\307\327xC\036\375\316\247\020\2217\3417\343:wr3\3432~\374\326"
+	.ascii	"\031\025gP7/\340\021\353h\242\342\223(\032G\027\025\235\004\265"
+	.ascii	"\024\357jq5\247\3158\272\203\242[!\332\313\026\375"
+	.string	":\271e\274\3250\353\316\234\f\247\310B\2264\335\026\215\215:\240\245\251\031\210z\364\314\264;\353\306\375\353\223\020\231\213\375\237\217\364`\266]\354\346\013\231\246h*\226s`\035\226\313S\030\335\013\202\00492\332\347AF\031\333\312\344\361-\221\t\214\3627\227\331J.\316\242\323\343\266\351\b\343\254\307H\303>4h\035g\231\233\216|\030\337>\262\344\214\3270\033\260\345)\213\201Xs\232\330\221Q\376\2166D8K\314\272q7\313Y\2779\303\2210l\373\270]6\344]\326\336\257\332\353\305\210\274]\265\327\007\237\341\345\332\322b,\274\025\324\336\036L\310K\001k\341\345\301}\274;j\257\216\332;AV\016\034\354\344\275\301`xm\260\f\2745\030\220\027\213\003yi\260\030\336\031,\310+\203\025yct/\214\332\373\242\366^\275\327\305{[\324\336\004j/\002\254\310\313\202\315\360\036\300\206\274+\330\217\327"
+	.string	"\336\302k\305\\x\013\340.\274*\270\013o\n\366\302\213\202\275\360\236x/\001\335;@\355\025\340\275U\335KU{\247j\257T\355\215\252\275&jo\211\332K\242\366\216\350^\021\2657D\355\r\240\366\202\250\275"
+	.string	"\324\336\017\265\027\252\366>\325^\247\332\333T{\231j\357R\355U\252\275I\265\027\251\366\036\275\327\b\355U\326\336\242\332KT{\207j\257P\355\r\252\275@\265\367\247\366\372\324\336\236\332\233\254\275<\001*\376\341"
+	.string	"\374^`\364\b\353\224J\204\342\300\b\271'\037\316vn\200p\370P\374\351P? \323\356,F;Y\347\224\\\232\246*\322\272\211\003#\022\3234\265jk\267\007 \250Q\343\310\350\3239\221\321\024\334"
+	.string	"\271p\205'J\210\336\\f\233\036\204\202R|\201R\\\305\325\266\n\235`'\177m\310\004m\005:q\024<\336\343\025\f\251a\2169\353F\n\336\343+\3460\031\r8\005\347B\336\231;\313{\263\343<\376<Ef\235\323\233\276\343)\302\226t\021\275\323\231\2740\355\230\300PFN\323\237\340\362\314\f\275\271\3077\200\211B\217C\313\006Q\350\033\fzs\333\247\003\377\b{\370\321\361\253\247\0307W\277\226A\023*\320Z\235\351:nb\016s\314\235\331^aMS3\020Kgz\323\234\245_"
+	.ascii	"W\245\221\177\336\334\251\277']O\326\217O\306\344\215\033p\265"
+	.ascii	"\021\177\317\267\236\034\017\361\367\\\223\304\272\325\325\214"
+	.ascii	"\376\b\277\364\034\005\031\2238^\300\232\236\004~\304$\374 \305"
+	.ascii	"\325\200\376\004\311\364 \360\243?\302\267\344\t\253G\320&\260"
+	.ascii	"\321\347\315\355\341\241bV\303\024\354aG\212"
+	.string	"]Lp,$\016}dh|\306'8?y\247\314!\235\031&\243R\326\241\222\216t\245\243O\033\267\361\244\223PS\3435\216\364\2573\272@\246]\037}7\002\034GN\313q\250\344u~t\242C:'\363\315\3508\316s\\\274\305\215\216\204L\276y\364ac\002\030\036$\025\003\315\351Hq\213\253epT\376\007M\037\232\335\254\346@G\037Q\376\030C\033\0338|f\335\270\203<\002\375\t\256A\023\270Z\321\217\206y(\302\242s|\334v\215;\n\322\200\300\325\210\242\210\376\030\024\257T\364\315\016\242\313\201\257:w\267A\f}\203\276A\264\216\303c\350\257AQO\350?\277\021t\364B\227\002\fz\t\254\003\335\311\017\3532\376\363\247>*\204>\347\271\215\236\243\367\271\324\234\236\227@\244\361>\272\304\226@\264\202\204\201\321P\216e0d,\003\b\302\300\306\300\202$\227\274\325\243\303\300\306\270\264\032"
+	.string	"\022\333\272\022\333\272\022\333\272\"\242\225\245D:\"\242\225e\364\203kl\211\265\003\004\b\230\r$\021\255,!_K1\035\345\217\261/!]3\300\226c\\]@\274\272\026\020K\002\033\242\001\003B\226\0174\360CL+\214K\331\365%D\313\306\005\\\313\261\033?a]D\300\260\206,\201x\355,\027UX\227\006\313 Uc?\276\226@\274\252\204,\265\202Tq\205\211UQ)-\330\220\256\260\25210\260\260\252d\0263~\234\0363\007l\360\n\315~\3264\267\024\343\350\234S\024\263`q\002\0068\001-\f\360\2463\\\231\336\\\026\217q\243\276\275F\001\316\202\226v\223\206\003\263\261\254\023\311\207\002\231\236"
+	.ascii	"\3474\2146qK\223\027\306\254\033\377-\201F\222,\275\271\311\266"
+	.ascii	"\244\345\321\271\241(^q\265\025\257\272\002d\250^\325{`wbT\225"
+	.ascii	"\321m\206<\226\023\002\243\nJon#y\t\001\376\301y;\372\372\013"
+	.ascii	")^\361\345\371\220%\200\263\262\345\305\255\254S)\267\275B\347"
+	.ascii	"\221\341\221\345\221\351\221\351\035\031\335\341\206\bgI\222"
+	.ascii	"\nW\274\276\323H]\377\272\005\207{Nf\335b\023$/\034\275\271\307"
+	.ascii	"7$\024M\375\275\371@\271u\345\237\2337\""
+	.string	"\255\037p\265\375\324}\350\372\236h\035\007\n\217\324\247\356\004\267\347d\276I=\352]\357'\363\355\0042,RG!\305\307M<j\233\256\253\254sy\312^\355\227\375rd\324D\003un\204yK\270\356\343UO\246\016\025\374\200s\235\321\360\016\334\231\036\033\246\335\231Q\211o\035}\222\370\210\2278\022\"\323N\304I\034\311\rsQ\353#~\004\247\267\205\211\003UY\323\003\345\233\373u\024q\266S\240\245|\311\2118+q\013\204\3037h\366B[\321\233ZG\313\236z!\016\342Z\3479\264\342,\340\001<\304\357\307@7\327)%\027\347\200\210D\270"
+	.string	"\316un4\344\001p\250\203\270\022\234\225@\346[\201v\250q0\004\025b\246\204DD$I\222\264\006\201\005\304(\b\241u\003\021\340\244tT\215\210\220\244 i\f\034\346\n]J\312%\324P\020\273\360\304\302\371\300q\241\0016\004\033\034\240L\340T\301\022\261\f\367\314\343v\242\271\374!\314\363\022$)\252$3`G\355\351\251\3152\243*\355#R\351\251[[\302\247\355>\325\237\267\371\301\016\035e\033\254\353x\300F\350 \315\315\351\312f\213\317\2273\222F\225\022\322\317*\325v\351-V\346\005J\302D\023\017\265\214\270>f\364\027Fg?\363g\305\271\356|\346\351\305ez$\345\f\356\213Zj\205\344.\363\360\341\306Z\255\246\312x\217Drp\303\202\230\267\020\030\322k\2631:3\003(\201:L\203R\b\300\030\354\f\251\017\363\307\311"
+	.ascii	"B\253\347\006\006\302\2776(\230\337qe`\301\023\201/_\022\371"
+	.ascii	"\347t\377+\355\253\013\261\n\\K8\f2\224\264\351.\266\215\214"
+	.ascii	"\361&\266\315\311b{\306\241>;\221\277\375?\005\270D\352o\370"
+	.ascii	"G2\302\257\204\362\330\245h\330\026\206\274\227\005\316\231\206"
+	.ascii	"\304l \206\3162\220\336\001\033\254\215 _T\017\265RC\331*\204"
+	.ascii	"\220\242N\227\346\0366-d\247\036aj\245w\360&\332\033\321b\354"
+	.ascii	"\211i\351=\342E\277q,\305\031\251\316\366_!\031\343\377\002\201"
+	.ascii	"y\246\037\001\307\330\264\216\301B\355\0225\262$\303\023\355"
+	.ascii	"\370\374\017dP\362\271=\337,*\302\r3\206\203x\030\033\215R0\013"
+	.ascii	"\333\224x\nAx6\234%K\202\206\233y\251\302E\235N\235\367\354\334"
+	.ascii	"\006\274\354M\033\272\001P\332OFX\212\362\0361y\334\003)\036"
+	.ascii	"\202\354\201\0049\266YA\202\345\341|\372xtx\206rl\331\313\271"
+	.ascii	"a\234\204\347\216\023\336\253\310\312\214\3378\n\317\035\023"
+	.ascii	"*\234\332\241\021\373\244q\312\205(\223\262\271\302i\005%=\205"
+	.ascii	"$F\372d\177\002\205{\220z\322\242\362\376\317\264\321A\372N0"
+	.ascii	"\300\001\034\006/(K\257\007}\324tI\271\355U\326>\320<W8\274\302"
+	.ascii	"\224\205F\033t\234,z\220d\253H\350\200\245\244\242\3576D\370"
+	.ascii	"e\325Q>\217\300\320\230\f62l\275\2365\275/%\361\2365\361B|\270"
+	.ascii	" \271\2404c\374\372\005A\020\212\330\372\366\fSR\222G\021\001"
+	.ascii	"7\341\230\273\313\330\261\204h\247X;rLZX\032\231\201\202\302"
+	.ascii	"\221kr\216K\022\2724\001\376\035\217\0050\2037r\274\302\251\227"
+	.ascii	"\331\367=\006\241C\201\376\321\244\230$\324\263\242\240\230\n"
+	.ascii	"*\245y\251H/\001*\342\2366U \307\313H\363\340\224Q\rf\225\t\317"
+	.ascii	"\250\254\202\264\357t\n\252c\235c\332>\254\310\213\032"
+	.text
+	.section	.gnu.lto_applyMixToMotors.148.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\201\t\0355"
+	.string	"\212_\240\024BP\246N\007\227\317_A\212\225w9\b:B\254!U\247_\355mB\003\177t\200\374\bX\026\255\275$\004\033\236~\003"
+	.ascii	"\004&\"\"\"Z\341\247\t\353\272/*n\350\241Pc\244\355nr\357\224"
+	.ascii	"R\n9\001\030\001C\001\235\306F\237\341\013e\207l0\303E\255\265"
+	.ascii	"Y\353'\216>\3035\226l\3002\334nf\370\315\351\016\235\345\t\241"
+	.ascii	"\212\341n\343f\3531\305&\303r}\311n\357\310;\263\273\273\367"
+	.ascii	"2\350\224A\250\235N\2418\230\201\235\242@fvg\016\223c\017C;w"
+	.ascii	"Z\177i0\305V\343g'\335\313\304\r\356^5\007\fA\255\233l\247j/"
+	.ascii	"\331\366\302\274v\312\013\324N\271\310\334'\200\216\353%\341"
+	.ascii	",N\330Z\336\275w\370N\220XmT\255\331\350\213\235\204t\244\024"
+	.ascii	"4*\002\376V\325gS\364\275\310\355\263B\227\224\031\203Lzu\322"
+	.ascii	"\023\271#\216d\326G\375e\326Jr-\254\033{\202N9\241x\020\365\351"
+	.string	"\370A\245\353\306\230h\005\275\273\270n3\272Q\0232#]\004,\353_\327\215\025y\226\371\352\326B%d\313V}VJ\310\224\355C\251\230p\200\004\223ah\323\234%{\032\256\205W\306\224n\353\306\210\240S\367\336\243\247A\032E\251\356\320\f\n&u\240M?\250 \333\255],\t\346\337m}\342\314\356\217\0222#\355>\253{/;2I\326\274\324\314\035\203\231\211\314\2522f9l\247\277o8v_\324\037\376\212\244>\224 \373\376\276\267k\307+\3067]\374\246J\341\346\247\355\324~\213\025\371\372\252O\277\217Y\320\3467\366\037\375>^1\372\036\013\377\337'\027\226\250\337\277\217w\315\246\333`qK\341,\027\336H\027\266\323\376v\353\024\256L\020\232\362\313\367~\f\033\035\311\377&\263\232\321\273\202\231\336\035?\023\346\325\231\303\352l\245:o\320\220Au\306p\001\350l\201\202u\236\240:K\210"
+	.string	"\341A\207\351\036\266Zw\225\203\2373\325\352\234\240\3254\0370\320f\232\0134\231f\341\352<e\235\t\254\316\003~\316R\253s\324\317Y\300\352\f\265:?Y\347"
+	.string	"\2533"
+	.string	"\353\354\264:7\255\316L\326yiuV\262\316I\2523\222u>\262\316A\353ld\235\213\2543\320:\377\334y\3659\253\326\331g\235m;\247>g\324\347\374\326\331S\347\356\020\204\322#\331i\204\356\375\261w\350\322\245qUZM\267\231n2\375\314-\307@\036fh\313\270\177\201\r\b\340\241>\301\017\352\237\276\237P\001\376iP\227"
+	.ascii	"N\017 \220\223\002+u\2620\323\224\35379\305\026\337\200\025\211"
+	.ascii	"\2331=U,\323[\275\030\263\325g@\361\226k\316;lw\252\3227\375"
+	.ascii	"\200g?\0062\372\236\257\351\231\276\341\332\225B\220\024\321"
+	.ascii	"Cg\256\3007-=\023^\332\322\257I\257\364}\234\373\272\343\267"
+	.ascii	"\"\030~&}\215\345Z\241\246\243'\f\031\373M\216b\333\243\202R"
+	.ascii	"x'6D}>\302\027x\261=\215\364\\N\002\316\354\341\2037\022\351"
+	.ascii	"\033\217\037Ct\306\367J'|\204\247\360\177\346\310\214r\3413\207"
+	.ascii	"\020\341\215\234\360O\347GP\013\2512\b\b\372M&\332\r\277\364"
+	.ascii	"\221(\t :y\300\\\2171\274\204\337\360\035\006\344IB\367\bk\341"
+	.ascii	"1|\207\305\341i\273\021$Jx#K\330N-|\247i\177#%\217\231v\364\301"
+	.ascii	"\217\360\316\347\310\264c\342\350\025<\201\360F\037\254\203\302"
+	.ascii	"\350\033\257\214\020\232\222\311\037<s\n\025\336H\b\357y~\334"
+	.ascii	"\320\201\275\027\027\275\357\037|#:2\201\377\373\242\357\236"
+	.ascii	"\303o+\370\t\374v\263S2\213\226\303o\r\007\317\275w\002\367\034"
+	.ascii	"\214\253f\023\374\242j\306\213\256\253\255a\f\342\326\026\021"
+	.ascii	"\253\213\206\214.\032$\200Z=\"\253\206V\027\326\025\360\206\326"
+	.ascii	"\b.b\027qK\305\312\2221c\312\005\327\225\312XU\\Y7\264\266\206"
+	.ascii	"]/\\h\301h1\214\241u\2655\304\342\2321\254\202b\242\214,\256"
+	.ascii	"a\027\221\3105\004\252}\3653qv\357\300CC\367\365\306\244o2\020"
+	.ascii	"\312\221\203O\241(1\350\003\007~\352\273\217s\016"
+	.string	"\314\365\374\336\353\205\364M>\360\016\336\311\331v\207\300\207\361[\223\037]\020\022o\213\203\361\233\352\306(E4\002\337r\235.\227\317Bq_\276\367G\337\344\356( i\\\224\236\tw[\367\0206DL\243\250\237z1\226\262Tj\235\323\256[\312J=\325\263\207)\215{S\212X\244\276\235\215\316-\317\004\277\311k\236\"\r\377y\234A\013_L\370Q\357A\300G}\207%:\324\210\212U\254\024\261`\261\235\n@\347\312\002\025j\364\336{\215\276\311\276\344\032\340\205^\216I~Q3\274\201\006-|\r\337mm\302\371\345\355\3104\360^Z\217\337\216\314\356\275\025\270\363\272PQ\013\027\317\212h\334E4\267F\220\244\216\027f\232\027\375\022|?\327\247\347\300!\200\275\250A<#\0313\206fDDF\222&\313\001\200\002\021\2622n\021\200\271tE\nR(t\312-=/ B\305\331w}\034]4"
+	.string	"\237\373\303&\376\260n\220Y\013\237\344\323d\236\216"
+	.string	"\334\b\202a8l\207O\317,\b\030n\230b\322%\022\306\254\270\214\344\253\016L'\311\205\271\362Iu\257P\211] \0175sU\222\221\205_S;j\366v\327\254\367j\017F\263\201\2345\031|\302"
+	.string	"\027\031\236:UR\333\317\247\320\034'\240R\350\371l\201`\337\316l\234U\0218,\240D"
+	.string	"#z\016\277l\350\254\300\362t"
+	.string	"\025\3514\250Y6?o*\353\n\307\f\0365w\330\275\206\330\302\202\262\332r\306k\337B\272\367\212\302\212?\001\213\017'=\262[\255\346\215\320\2273\206\351\375\241[\302\251\034\274\321\307I\230\223#\277\037\265\230\025QS"
+	.string	"\b\2452\337RK\302\303t-=E\200e\346\351\215\360\004EBI\017\277\251\2400\347\b\030\261-\243\022\b\023\b\201)R\001-)\206_\232\310\346\273\342\033C\263=\225a\307\023\2516\235]\206\277\215{/\233\232\262@\276#\272\323\346\030!O\r\275\310\311M\217\313\004\225p\257\023\004\003\320o\334 *\303\340,\\\2243p,\342\365+"
+	.string	"\206\013\240R@W\237\0019\222rBe\222\347\211\273"
+	.ascii	"\243\354LM`\377\003"
+	.text
+	.section	.gnu.lto_updateDynLpfCutoffs.151.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\342\002\345\026"
+	.string	"\226j\226H\300\030Q:p\361\2462\220\303\037\t$+\0340Rk\205\307\230\030\371/\256\326\017\253&\226\374-\225\264\375o}\262\242$*+\340\254\251\022!\300\334\266(V^wtg\336\023\033\021\036\2420\n~#\210\020\262wJ\001}"
+	.string	"u"
+	.string	"\210"
+	.string	"\342?*\332\2469\0279\332\031\331\335\006\206\020\376\363\251\375\036\367\361\272\217\t\227vg01\262\233k\340\005\341\277\324\t\200\377\274\017"
+	.string	"\377\371ec)\220\263\260\007\270%4 ^vw\2545\376\372\347U\372\362ejJ5\033\354\037\214{^\252\211\216v\262\345x\bvd|\021m3Z\207NY\330r\274\324\356\376\347t\205MF\251L\315\356\232\326l/n\360\2665\330.a\3231\001:1\272\263s2Zy\354{\273\273\256;\266\211\032u\242{\346B\267\370\334o\n\251K\367\371CJ\375\231\250\275\022u\245\3244\244\276\200\223O\217\355EF\273-vaV\367\035\261q\242_\3502\024\244\236}\373A|!\026\211nh\224)8+\023\302\003\371C\266\320\210\357\213\275\212\036\034\024\244\335e\360\3175A\377\201s ;\270e\331\261\273\342?\033\307\016\365B~!\210\210\021\n\244\230\305\270\330M\361*\217\305\352U3\310\212\177\344H\254D\204\2238\tx\342\246\005\247S\253X\251\223"
+	.string	"\224V[E\202\257\325\232\232U\230]\344A|\232\355\306\022\230*\255\037:\005)E;\0248dtwa\265\362X\001\355\037@T\325a\241\343'I\312\223\031\005\343RE\325\002[hc^\303Z\252\377q/\007\025$\\\f\241\033\262\017y\221\t\277\307\256\222\276V\202\377^\035\334\262\340\002\266\241!W\3459\262Z\253UKe\300C\b\t,\234\016\247\n\035\310\022\345\311\342p#\002E\2028\317\226is\206.\013\344\252\254p\262H\323\274Q\001\260\212\306$I\224\253\361\264\371P\202\3600\262J\016\253Qe\272F\232\003n\205 \315\361l\265\314Q\314\305\356m\335\371\317\237\")I\027\253\262/\254L\356\342\326\005w\213\035\235\307\215\313\027\f\256#\235"
+	.ascii	":S\355\f\033\350k~\225$#\035\215+@\271\b\273\235\226\257\316"
+	.ascii	"\324Z$\326/5 P\2021c\305\033\326\031!O,\251O3\317^\314\254\035"
+	.ascii	"\247ML\241PA\260\002V&\3366\035\257\027\303\242Mb\341\356\332"
+	.ascii	"2\256\030\226L,%\231\320\n\f\254\016\3461dF\302\214L;b-G\202"
+	.ascii	"4\375\330\242\275i\016P\203\313ZH\016\033o>\013\364\314.L\251"
+	.ascii	"\232\r\2515b\r\0234$\302V\024\327\275\232\023K\2761\324\232\345"
+	.ascii	"\246\303t\024\020\203a\355\031\227[\n\363\207P\006"
+	.text
+	.section	.gnu.lto_mixTable.152.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\355\013"
+	.string	"D\024(\001"
+	.string	""
+	.string	"6"
+	.string	""
+	.string	""
+	.string	"O"
+	.string	""
+	.string	""
+	.string	"\001\006"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\002\203\221\213\002\001\277\001\354\243\341\025\004\204\221\016\224\334\236*\004\003\001\225\004\001\025\005\001\201\221\n\001"
+	.string	"\177\002\003\004\005\001\177\004\177\177\177\247\003/\200\200\200\370\305\207\374\271\034\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\005\001\006\023\001\004\005\001\006\025\001 \005\001\b)"
+	.string	"-\300\200\200\320\271\242\200\200\t"
+	.string	"}\276\001\177\275\001\274\001"
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	""
+	.string	"\013\257\322\005\340\200\374\377\217\200\200\357\317\001\221\216\217\324~\t\001"
+	.string	"\002\002\004\001\001\276\001"
+	.string	""
+	.string	"\244\003"
+	.string	"\252\325\252\325\245\003\002\203\300"
+	.string	""
+	.string	"\201\003\204\360\371\360\237\307\n\001\277\001"
+	.string	"\212\001\002yw"
+	.string	""
+	.string	"\003\004\002\005"
+	.string	"\201\003\203\340\223\366\310\001\003\001\212\001\002sq"
+	.string	""
+	.string	"\002\b"
+	.string	"\372\002\204\352\303b\003\001\006{"
+	.string	"\003\273\332\201\035\203\340\225\366\310mk"
+	.string	""
+	.string	"\002\013\004\360\372\2508\004g\005\253\001\203\003\202@\001\253\202\300\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\rcurrentTimeUs\026"
+	.ascii	"2\003\303\341\313,\\au\303\b\205\020\002\362\312\320\030p\217"
+	.ascii	"\250\300$\356k\"\237\023&\226\016\026\272\314hS\361.\001\020"
+	.ascii	"\253)\302\035ii\257)\341\246\024j\017"
+	.text
+	.section	.gnu.lto_mixerSetThrottleAngleCorrection.153.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"E\b"
+	.string	"&\320;8@\217\322\001S\260\n\230Lf\305\tm\207\325\036Q\026\031\300\222k3\034|\n\377S\001\020r\013\373\227H$\030\256\016\003\201\321\325\020\215\r\3345\366\310j\262\311\336)\005)"
+	.string	"-"
+	.string	"*"
+	.string	"\227\356l\226\243<v\340T\262 q\331\335\031;\336\035v\376O\327x\237\350\020@aw\r\275\017\343\216\267m`;\301v*\246\037^\034\225\225\357/-\273\027-\230eI\223\217\215\355C\373!\027\351n\362\312\232\335\r\224\222\335E\360A\346\262\340\002\330\345\365"
+	.string	",\231\230\024\326(V\030F?\365\021\257\374\222)\254\202\367.}\253\260\313\t\215\023\220\214\021l\331(\021\214\034\366\257\335]G\222\375Z\304\307\263\020\242\033\227i\265\322\214\343\254S5\211\r49\207\206\355\3030C\233\0074\263\n1;\004\246\017Z\235\034\245unP\373k#\311\001\b"
+	.ascii	"2\241\213/p\340\002<\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_mixerGetThrottle.154.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 \371\345\006"
+	.string	"2\21505Pm\222\016@69\243\214\264\025^To\361U\254\221X\323\224\321\321\346\257\331\177S\201Up\207E3\354\270\231E\202\030\302-\334\206H\2505\230\321H#D\246g0\227f\242\332D\216CC\365\300\020!\252\205M\314\\\022\021S\260\025\241\271\"\307\262\256h\331\262\017\344\336\305\363>_Q\267I74\305#\327\254\360>\242\n\335\013\310\360\270\225\337:\356m|\247|\240\257\333=\001\024\013\255\245\222\314\213\025\225<\201$\036?\366\226\013\322\020\354I\323\326\0212\020}T\214\244df\274\224\200*\234:@\025>\216bu\330\255H\025>%\223L\353\324\001$d\346.\3230\372\353\177\360#\374\032\001\b"
+	.ascii	"2\003\346:\203k\b\305518\"k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_getMixerMode.155.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375 \365\315\006"
+	.string	"\362\314/4`m\322\001@aZCB\023\342r\372c\211\330"
+	.string	"\031\303\271\226\235\002#\326Zo\331\256\2060\024\274\265"
+	.string	"`O\021\244\276\305\257\031\252^\247\232l\"eJ\001\306\\^\206\202\322\270\315\203\003\005\321\340\"(\006\215\303\274\tw)p%\221ynSU\317U\260\275\202R-\226~\354\213\216A?\344\nN\376z\3639\323[j\200\206\225\231\215yR9\354K\253 \333\351T\201\223P|J\266\213\221\215\326\244\225x\330\356\330\025\377\343 \035\303\005\013+\"\210D.FPv1g9\301\364&}`z\323\216\303'\364\037r\205\317\210\344\212\236'@\302\356:\257\230q\353m\033\330>\260\275\021\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_mixerModeIsFixedWing.156.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\205\f"
+	.string	"\026\227SA\020O5\035b\355\fL\205P\345\231\261\004M]\260\003\3741A\214\202\b\371b\035F\005\326~\251\007\361\032\343\345\232\332\275\037o\310\002"
+	.string	"@\021\364"
+	.string	"\345P\360\rX\003\315\256H\360i#mo\231R@"
+	.string	"="
+	.string	"C"
+	.string	"\330\257y"
+	.string	"\330/\037\020\271{\030\302\024"
+	.string	"dQ\001E\310n\250I\020\357>\245v\276\367y\360S\305a\224\261Z\361e\270\2440/\273K\371F\252\022\315\356ZK\037\206\373\272\355\004\266\r\330\007\005 $\035\261CO\345\007\373sw\327\022e_\365\253\325\237\235\207\351\302w\326j\327T\203\265\037\227\207\b\333\"\273b[\325>\307G\210\256\ny\262\353\241E\307nX\300\230\354\327\345\002\002\227\320\bC@<m\351\356z\322*<Zfh\030\220\302\243e\365b\343!\314\204\177\302\343GR\247\r\331C\330/-\331'a{\314v\275\237l\217'\311\326\007Gj;,\346\227\312\203\247\210\"\035\"\001\034\006\233\202\2117\031\216\003\352x\264\317\003\007\035\b\r\264\b\235\005\036m\303M\3202\004\274I\340p\332g\3338\255\022\356\347J\224\021\304\020Ei\360\031\013\204!\272\320\277\303.-H\225#\277\304\255\361\2645\037\006\031"
+	.ascii	"`I1#\236\342\n)f\200A\303\363\3142\237m\202\300\220\t\002L\201"
+	.ascii	"{uZ\341y\004\252\346\227\022\245\250E\234\205H\355\302\027\306"
+	.ascii	"\273k\nX,vg\b\231\252r\221\272\252\313\312\023"
+	.text
+	.section	.gnu.lto_isFixedWing.157.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`F\001\355\r"
+	.string	"&\231ZD"
+	.string	"\2576\035\346\031\207@[2\2671\314Dw\035\346\267\373\260a\222\220\252\354\277Mn\230\367(\337\363\244\200\377\2156d\003\306\353\237\177F\004\376_w)%\206\350\333\262\341\020R\373\201\361\233\376\267\266\345N)G"
+	.string	"B"
+	.string	"I"
+	.string	"\235\203\330\035#H"
+	.string	"\342\355\037\312\210\200\025\026\"$R\273\037\246\036\276}\252\334\374\224\317\022\t\306\024\236:\356\363\336\247G\022W\204\247n\303\325\302,\260\273\234N$\245&cw-G\235\206\333\272m\006\266\r\3307\005\366\277\213\320\374\017\246\340!?\272\345{\\\267\256\027$!9c\177\"\251'\366\347\252\211miU\351\317"
+	.string	"1-\335W\341\356\310\214\314\276X'@\330\276\037\342\336\307U\254\200\004\223\332\335\316-\373\303\016SO|M\314\227Bqr\224\273\313\251[,zZ\220\f8Y\364\204("
+	.string	"\\\273@\277\204\305\257J%\0346\327\256\263\310\321=\177\204w\271\227\3307Y\334\240l\006\361!:\276\250\224\266\303\036\270w\016\250rQ\241B\344*\326\300\3106*|8\260\016\b\017>\021\034`\022>\r80\215L\3030\b\0304a#\303:@\240\f\373B\237\253&^\240\002\004\325\337\256{\337\310\254\244"
+	.ascii	"M\310\177\273T/\330V}\312\217AdtQ\241B*\362Y\356\fN\216\001!"
+	.ascii	" P\0022\347\312\003\254)\032\2233\300\204,\021\321\016]\356\255"
+	.ascii	"{W\nw\313\245\335\2101\364\301\232@/n\2548\t\020\200\r\202\310"
+	.ascii	"\341d\013\271\320\353B\325\023,\200\244KOn\2131\361-\007\031"
+	.ascii	"\036w^\344\331u\314\371\020\\\325e\370\t"
+	.text
+	.section	.gnu.lto_areMotorsRunning.part.0.219.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\013\002U\022"
+	.string	"F\342vH\340\322&\035\252R0\206\"\241@\221\315\026\346\374\323\001#\241O\275\374\331b\223\026pf\330g\255\256\324\207l\234\256\214\316\222\025\331\006dM\222a=\343\206R\306\207\023)\364\312C\370\030r-\263\270#m\357-wJ\001d"
+	.string	"\\"
+	.string	"b"
+	.string	"`\2059\205D*L\237N\240}>\205O#(1\247\221\024\177\007G\300\374\206\307\313\307\250V\220\373\\\021\326.\301[\306\357Sn\244\237\177\360Rg\306\314\005\246\362\031\002kqE\031]Lt\370\312\0061\235\233\020\330\212\\\236\231\214\317\036_`-1\0228%9\250\265Z\363p\223n{\203m\022;B\b5\366e7iFS\031=\345F\357F\307\377\334\007`\372 `\246V\230\243\037\225f\016\225\270\354\377y\264\357\377|\205?\363\346\203\342\230\313|\037\236\367\244\234\205c\224X\300\n\223\020\032U\006\332g\351\005\350\247\374"
+	.ascii	"\372y_\206\342\203\336v\036\373\034\223\342\357x\373\364c_I%"
+	.ascii	"\364s\356\201\"\031\227\254\265V\251\340_\271G\021\036q\230Y"
+	.ascii	"\001\002QC\264k\263\017\321\203\203%\366\260\357\342B\016\375"
+	.ascii	"\034\247,d!\372\271\213\240H\346-\034j\265V\022\037\350A\236"
+	.ascii	"\237\363i\f\254x\227O\237E?\343~\366(\313\241\231\211\r\271\342"
+	.ascii	"\221\367{#\007OP\\\033/]`\203\006\2167\335Q\252N\245\312\020"
+	.ascii	"\201\265\362Z^*\200KDV&\032\272\024\327\252\200\352,P\340T\335"
+	.ascii	"\204\024W\262bq\"\006\354]0Yq-\317[q\233\355\370\2551\275\361"
+	.ascii	"\361\n\245\377\321\255\b\310+\214\377GI\244=xm\307\211\312C\207"
+	.ascii	"kWH\314\265\361\304\241\246o8\373b\333t\277\017j\314\245\373"
+	.ascii	"W\220\2778\fTwr\0220 @\002\202\224\326\016Y22x\325\333I\322\""
+	.ascii	"\231\204\361;\315iq\367\211\264\002 \376m\307(\001v\fmJ\314\320"
+	.ascii	"\200\253\307\340\032S\211\b\020\233U\210\273\304\030\252\205"
+	.ascii	"m\201\271\364C\002\277\267\333\225{\033\2308\030\221\372\320"
+	.ascii	"7\364u.O\026\313\361\253\312x\032\013?\330\246y\341\026\230\205"
+	.ascii	"\266\237\367f\013<h=\356]j\f"
+	.text
+	.section	.gnu.lto_mixTable.part.0.233.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\362\"\225\235"
+	.ascii	"\032\375H8F\0208Mk\f[\031_c7W\314v\306NG\342\353\253$O=\347B"
+	.ascii	"\371\223{Z\332\275\352\260Y\024\330$\030\312U\271\362\313\241"
+	.ascii	"\320\223\326\277(\037\033\212\364\205\300\nT\234\375\001\234"
+	.ascii	"V$\327\301\375BHJ)\005|\003-\003s\003L\346\034\004\306\372)\336"
+	.ascii	"A\263o\310%\235eo\343\244\263\261\001V\227\200aN\322\304\306"
+	.ascii	"mMP\016Hgy\005\\\235\024\020\035\311\240\024\251\235\233y\232"
+	.ascii	"\227\371\031;\332K\266\350Ofg\371\370e\320Oj\347e\314\213\354"
+	.ascii	"/'\231\375\347\310\\2\216\f\240\032\222\311\254\330O\244\213"
+	.ascii	"\215\330\211\314I\026\322Y\036\"\365s(\204\271\253\263\034T\246"
+	.ascii	"\030\310m\330{\270\371p\022\006\262\257\316\362\263)\032J\355"
+	.ascii	"\336\367M\352\341\206\201\223_]\310zl@V3n\034\355+\0037\0302"
+	.ascii	"\3560=\246\313\364\231^\323l\372M\307\3519\355B\333\351\300&"
+	.ascii	"\344\344\240\240\340\222\254\036d\037\363\2205\036\"\256\241"
+	.ascii	"\372\266\001\366\035g\343!\242|\351\274\315FW\347\244N\025\331"
+	.ascii	"\313\366\205:G\352\0341\276c\232\256\316\n\335\232?:t\352\260"
+	.ascii	"t\025\331G?\262\356\013c9\315\347\354\2760'\263\352\033\005\262"
+	.ascii	"\302\311V"
+	.string	"\273\004d\037\225\336\313v\017\016\034\352\0247m\332\354E\3658\005\013\262na\214\235\312\252\357\222\350\373VS\260pv\013c\375\246\275F\024\353\366\262\357[\3552d\037\325\220u\232\"e\321\367\215b\033\215\263\323\0241\276c\214u\213t\357\0335\202\354\243\277\215\324.\333<3f\030\353\024\364\276n\336\320p\221!c\201\261E\317\276C\273\303\013\256b\216\2109\322o\333\353s\252\334\301\311\326@\366\nd\034\2652\326\351\254\372\316\265\177\202~vS}d\027\310>&\331\275\253d\355e\003c\365e\213\262;s\3375\236\263\275l\300A\357K\205\212\346}\253&\372\310Q\310>:5R\333Gc/\333>2w\0353\223E\331\311<\330U\271\227\211\252\250\026\346\360}\337\252>\376\bN\"\030\331\306j\363\013\243\263e\304\200\361\302\312E\013\026+T\244@q\242\212\312D\211)\251(\022#D@\205"
+	.ascii	"\361\341\311\311C\207&&\016K\0334(%!\035-]#e\021\321P\206\244"
+	.ascii	"P\020\022\250=\032\337g8\271\035\312V\3262\250\264)v\214\030"
+	.ascii	"\032F\f\315\347\320_ \266\025b\273 \364\026\211\203\316B\320"
+	.ascii	"W$\006\272\212-\321<\236\302\210\264$\013\264\351D\023\215R\331"
+	.ascii	"4|\3608\212;}\002\260\253\372\024\001\235\212\257M\030\245\344"
+	.ascii	"\030\221\022\371\274\304\324^\034\227\272\323Qo\232\304\0337"
+	.ascii	">\002;%\317E\210\320v\246\241\316t\b\343\022\034#\324\234\270"
+	.ascii	"@3\016\242L\1770BQ\023\3314\235h\031\343\222\030\264+MH\306\237"
+	.ascii	"\214@hK\2624\235(\013F\253\304\254\032o\273s'\021\332\306\264"
+	.ascii	"\007/\335\001\317\233x\361\2461\315d\327\034\354\352|I\205\336"
+	.ascii	"\240\002\3255\244\320J)$e\321\342H$\364\221\035U\005=K\240\253"
+	.ascii	"\007\342\312T\355\020\251\264\315\265\213\245\251D\257\264HW"
+	.ascii	"\364\260\360\023"
+	.string	"\225\350\334\0339\332\234?\255\270\222\0049/\212\322D[\242Q\350D\245>\004\327\031\240 \201\363\344\023\225\266\267\0262:\321\211\276=\361 \240+*mN\032\331t\242nI\372iK\324\211\003\t\261\205\320m\232\257\251\371\321(%\215\003\002\322\234\270@47\"\231\364\023\261=\215N\357\3736a\373\032\333\231\273\3333\200\256\336\367\3456\363\323\f@3\033\2330\267\030sS\234_\204\374)O\300\246M\276\257u\220\224=\274c\320g J\302\202\t\037s%\372\024pl\250x\330~v\360\346\367\276\034\300\237?\203g\357k\006\"\303\017%\020\007\007\233\266\345\t\364\323\366\223\317\236f\370\204bb\330\247\375)\037\341\030\331W \242\004\250\305iBs\201;\223B\0236\024\231g\007C\004J\356}\315\032\352,\301iBRO\240\013R;\024\277&\364A\357\326\004\020\033\303\037\337\231'\236\340U\306f"
+	.string	"d.\341^\234]\232"
+	.ascii	"\337\367\265\272s<'\225\235u\316;o\250\363\256\355\243\320\007"
+	.ascii	"\341!?\b\350\221\177\324K+\004z\240:j\213\307o\277\363\322\262"
+	.ascii	"f\376\307\213\327\205ep\244\032\277"
+	.string	"=\204\323\243\036\177\332X\355\177\363\261\336a\026\300Q\300B\276\357\333\202\375\004\r\n\340\236\313j\373\370\037\204\307\276\305M\310\342\236c\003\020\360\206\"\360,\254\270\231\371\037\376f\002\341.\005#U_\027\303\347\261\266\377\313\002\t\255x\316<\221\227\234\271F\003\336\320\376&\354\026\341ZB\0261\373\3742\377)\377\f+\271\304,\177\025f#E2\030\023[:\207)\235\301\210\364\236\346!\256\363\327\322\331\313\310\271k\351\314\245\344,\304\310\031\003#g\346\221s\020\2453\020\245\363\217#\347-\037\275B\263\226\353\334\303u\316r\235/p\235-p\235y\270\316\025,\235)P:O \201\353\034\201\353\f\201Ki\336\341:\353\310\201\303u\276\341:?\340:;\320\327f\033\256s\003\2563\003\256s\r\327y\001\327Y\001\3279\001\177\322\214\200\353|\200\353l\200\353L\303u.\240\253\335\004\270\316X\256\363"
+	.string	"Kg\001\224\316W\001\270\316"
+	.string	"4\231\346\031\235\327,\303\2314\307p\235a\274p\235\255\\g\027\256s\013\327\231\205\353\274\302uV\001\344\234\242\3634\243Hr>\221\344\\\345l\315TG\316&\216\234K\264^\363\324\322Y\352\3109\312u&\341:\217p\235E@\271\316!\226\316 \224\316\037\\\347'\245\263\023\222\263\207\016G\316M\355\246\231\311u\346\340:/\271\316\033\\g\rKg\245\245s\222\353\214t\324{\315\313\366kv\373\257\331\310uV\272\316E\2563Q\277\320<\344:gp\235\223\256\263\220\353\034\264tF.\235\201\\\347\326\310\371X\344lT:\177\221\263\367`sw\024\243\227+E\322\367]\362G\361\225rT\243\245\007\273\363t\277\320\375\327\355\327\275\327\355\246[\257[Mw^7\231\356k\367\n\355l\355L\332\237\264K\231\323\002\302Z1\236Z\232\030ZA\226E\217\232@\241*f\231\261n\331"
+	.string	"~\207\324+Y?k\216NYn\356\235\022\302\2145V\345\346\222S7\037,Vy\034o\031_\267\252\\[\377a\317\252S]\274\365H\320\314\246\250\210s\362\001\nU}\354=\315\304\334\354Q\246pR\212\220u\020\r\234Ca\b\244|\207noO\234\034qrd\016\227;\273(\310\250\177\300\336\204\223\001kl\300\367\260\3625i\3661\340yH\345 \272\321x\020\240\205X^\30037ch\372\361\206\322x\2473\266\002\336\206\264\r\342\225c=\001e\316'\232\022\254\357\240\347\304m\206\017\360\314N5g\007\336Pv:\373\262_\033@J\212Et{j\353(<\036\002xf\312\340\251\214<3\215\375\214_c\017E\236\215Lb/\343\327\370\251\036+\316\325\013\360\255\266\370H\276\003\2545g\222$m\037\257\214|\322\025\234:"
+	.string	"\360\3344\343\215\374\032\033;\310h(\3275J\232b|\221\022M\365\001\274\267\365\r+\3405\306S\3515\214=\002\364&m\204#=Cu\3630\343c<"
+	.ascii	"\375\227\007\314\230\016?e\031\037\343\377\213\241\027+\037"
+	.ascii	"\214w\3611\036\350\017\260\315\213\267z\030\377{\226<\232\325"
+	.ascii	"\267\235T\fb\213_\361.\236C\034`_\232\224\305\033}\2137\206a"
+	.ascii	"\373'\213o4R1T\025?\364+\376\375|\360e\214E\376\353|\3424\201"
+	.ascii	"{\216H\333G\025_u\007\357\304\243\370\024\337i\\\224\315{m\325"
+	.ascii	"\237\370N\333B\365U\357Mz\307\023\260Om\321\354\257m\320\330"
+	.ascii	"\2328L\265\267u/QK\243di\2523\360\323@d\306~\3159\270b\017]\275"
+	.ascii	",.\211\375\0323a\023\0259\374\364\313\b\377\254K\306>8\340\f"
+	.ascii	"\017\0177\374\224]\251D\263\270\326\341%M\265\324\257\231\370"
+	.ascii	"\036\326\022\277|\023\377yjnS_\342\213\236|W\265'R?\365\355G"
+	.ascii	"mQ\203\322W\341~\254\2447\035\365\237\205IT\025\265::\244\237"
+	.ascii	"\362\210k\bY\226#\272\3125\004%\256\210w\243'd\226\212\247\206"
+	.ascii	"U>=\t\022o\330\002\\\340\323\016\231B\263;\315We\356\347h\304"
+	.ascii	"{Z\007e\261\226i\223f\230\355\006,\204a\t\365O/\342\335\2702"
+	.ascii	"W\017l0>\2772\367\303\337F7},\270z\330\013=+E\312K\245\322\275"
+	.ascii	"R\004\331\007y\020\371\276e-\355nj\003\221ro\364\351\3525\244"
+	.ascii	"j\311\372\223\035\017\267\224\331\35703\331\240C\337\250\036"
+	.ascii	"S(\307\357\314\027\343\362\200\251\032\206x\250w\301\264- >\304"
+	.ascii	"s\020L\313~x\020\357h\215\374{\222!T[$\202J\343\030\3755V\373"
+	.ascii	"\341{X\345\370\223\235!x\235\017\357\317\216\232R\207NzG\307"
+	.ascii	"\377\030\353\204\317\360\231\266\217O\017\001\\ \325M\371SnR"
+	.ascii	"\243\342\021u\370\241k\227\305!\246\177\201\325:\275y\037\337"
+	.ascii	"\225\023.G\333G\247=\217\223\303\031\3059eJ\333G\017\337 \300"
+	.ascii	"\331At3+\372)33}\007C\270:V;b\n\2112,\275#Ijx\016\277\266\243"
+	.ascii	"m\372\036q\356f\f\371\276g-\330\331x\033\347t\004\247\025+m\037"
+	.string	"\233\236\007\\\035\016\317D\343o\357O\332\226\347\320O\221~)\303O\271\375\352\352\324\260B@\200\035\3266a#\017\353\262\250a\203\334?\332\360\032\336\221\250q\254\247A\303zm\0377(\275\206\244W\372N+L\372c\336\321#m\201s\341iGL\326,\371S\241\257\302\023\260A\026\275'\331\342\205\020(\350\225\277\346t\275\374/\023\314\343\304\262\374\020\327.Q\022\334L\330\n9\367e\300\265Q\276\221Q\r\234\236\325\216\230\240\237\266\001\034$,\210XVW\225\327WW\327\227V\020*#`U@\206,\177\f9 i\204\331\365`_bZY4\304\226\314\026\200\353\013L\314\353\013+\210\226\327X\026\327\262\306V\006L1\255\254$\027\327\327\003FA\264\304\2306\\1f\027s\201\256\261\033>\2306\212d\035!\362\261%\246\265%\266E\200\027s\310\215\"YG\212\212dE\340\203i#\214iD"
+	.ascii	"\037[\\YZaJ\037[\\=\262\274\n B\032\311\362b\3260\302\254\001"
+	.ascii	"\366%\366\325\225\364\261%\0266\206\201\217,\2571w\013\210WV"
+	.ascii	"\020\254-.1\261/\260 8\266||u\2011\263\220\302rlu1q\210ym\201"
+	.ascii	"\201\215i\r\261\026\025\330\226\021fW\225X\020 L\256\037U^\314"
+	.ascii	"\254\256*-\260\260*\252%\376\032\262\005V%\366\365\005V\225\354"
+	.ascii	"+\263\177\312(b|_*\001d\301\304\370\341(\276\263\275\246Y\327"
+	.ascii	"$\007en\236\320\354\342\301u\317\213\230Es\021\006\013\033\030"
+	.ascii	"?\345 <VD\376\361\270\230\352!a?\004\354\303\336\200\275\022"
+	.ascii	"P\007h\240/\206<\221_Z\315\364}}\357anJ\277\rc\213\344\364\236"
+	.ascii	"M\021j\263\256\256]\303\330;>\363\365\315\247\241\246\274@'\275"
+	.ascii	"\023\341%\264\342?\354\233\213\257\302^\317\365?\254q\272\336"
+	.ascii	"\313\313\247i~y\354\243iZ\3034\257\327\266\217]o\302\n\236\220"
+	.ascii	"\347b\252\317k\262`\305_\346\3154\313\3445\261\330\266\217B^"
+	.ascii	"G\224\274\276JOh1\242\305\340\216\362\355\021-\3631\020\363\327"
+	.ascii	"\2604\3155k\332>2\237\203(yT\267Wb\227\207\205b\235\026\n\242"
+	.ascii	"\336\212\237r\220\377\341\364\006\371\006\\,\301\357,\003\025"
+	.ascii	"\006,*~\312M-\220\177\301\212G\260\177<\220gWs{~\301j\3529\223"
+	.ascii	"\374x\260(WD7(\276\227K\212\2372\324\265\217\357\204\326\017"
+	.ascii	"]\367\316D\371\330\302\341\312n\276i\231\233{M9\336\320\255\357"
+	.ascii	"1\213p~3\334G\237\263\203&l\241\253\036:\304\354\031\212\252"
+	.ascii	"\254oE*\036\337\343\327\230m|\217\327:6\221.Z\355\210\241{\236"
+	.ascii	"\260\361YU&,\370N,\301\343/\3705\033\337\212\027|]\034\251\037"
+	.ascii	"+U\005\177\343-HvQ\2733\301#1N\216\347\201\343+x\242'a_\032\335"
+	.ascii	"\323H\316O\257\304\215\357B+_2L\036%S\377\245O\23656P\244\276"
+	.ascii	"G\274O\336\242P\240@\332\347\360PyF\315\025\022?\345\251\226"
+	.ascii	"\002\361\245O\335\210\237r\362\n\224\004\177\274\022b\252wP\360"
+	.ascii	";&x\n\270L\360Mw\334\262@\245sD\374\224w\274\004\237d\035l\223"
+	.ascii	"&\215\340\223\240\205:"
+	.string	"\036\202\217\340?/\r\316\323\3774\321 !x\237\262\007Q\215{\020\230\230\004\352\t\256J\013!\276\212\216\377\262>#Xuhi\316\221\223\343q\274\216w\343\006\257itO\022\232\177B\177\202}\240\2057\260@\013\037x\007\376\306\267\225\007\276\310\212[\rgn\332i\336\361\206:\360\033\240\340'\202\215g\343\003(\275\003\301\r|\025\177kW\017\312\3007\360-\237\247\377\361\263\032\317\300\002\257\300\327\370N\223JY\340\223\254\270\231=\002\257\300\2674\201\357\254\224\357\200\247\361\b\320%\3404\336\241<\224\246\036\344?\371\267\246`\223\260\251\307\033\332\324\323\204\241\271\307\033z\300\373[#e\023\021\375\320\276\214\277\225\262\304q\371\3404\343s8\311x\034\037\202\325\250\362\370$R\242\2141\205fFd&I\n\035\202\n\020\206\204\211\240\246\324\003\022\240t9MCC\"B\"\"\222$\251\324\2435OB"
+	.ascii	"?T\3214\t\020A\261\027\261\031\231v\022\377\304i\230n'\324p\226"
+	.ascii	"7\255\254(|Ke1)q9s`\253lV\265\307\335\262\352'L\246\245\200@"
+	.ascii	"\027\361\246\276\026\226\267\264\233\013Rx,<\246\277\327\003"
+	.ascii	"Xl\276\307\332\206\317\3276tLK\005\244\304\224\271\231~\276\022"
+	.ascii	"\212\2567c\033-\0344+\200o\203\315\376\354\250^\003\3745\331"
+	.ascii	"\251\336Ru\245 \245\270\315\304(B\274\237f\n\225j\345\376\223"
+	.ascii	"\256\003\3279\f\r)\246\0071\363\316\206T\320\fs\245Mc\343\225"
+	.ascii	"\177\352\035U\263oI#VL\02099\240\342\375K\022CM\020\273k\274"
+	.ascii	"?l\230\251Br\364\320IM\367a\343y\373\013\265\020\351H+\365M\036"
+	.ascii	"5\256m\321$\242\254\323\0273mi#\0305\244K\372\262\337\362]\277"
+	.ascii	"S\207\345\257!I1\213\322\326?\3679S\235|$\223K\253\361\364)Q"
+	.ascii	"tjs\332\231\214\t\247?\344\231\327\rA(\232b\332\273\233\316\325"
+	.ascii	"XA\001\277',g\337vI\022N@\265!\257[\371\301\370.W\020\352DL\036"
+	.ascii	"\212D\227\"\321\020T]\214\233RP\277a\3127}I\002BIu}\rS\275\025"
+	.ascii	"y\247\340\201.y\240\336\rk\240m"
+	.string	"v\335\0037\n\213\220\201\036<\003|\375=\371\002\201\027I\331\247\234\232\233\017\333\005zi\024-_LDmh\334\312-\361\353_3\021\\\301Sd\333\022`e\306\336\375\277\252\217%\344\214\310A\336\222\030\201\361\2313\031\304\365\253\355YI\327"
+	.string	"\313\253,R\214\226M@\224\310Rd,\372\263\n\022q=\364\006}\306\357|x/Q/\177\356\fL`\314e\bA\255\365ay>b\263\354rS\006\226#j{\262\0209%\2743\"@\316\007\003\371\313\261\b\343\020\335\270\235\340=\354lEd\213\021\001N\030\266\360\374\207Np\264\361\351*\f\325\006\fj\320CV(\2720l"
+	.ascii	"\250\364\177\377%Z \355\341\026\207-M\370\360\220\201\335?B\334"
+	.ascii	"\004F\253\316\375U\313\265\252P\2138\276\307q\367\302N\374u_"
+	.ascii	"k4\361cM2\302*%\367\005C\337\255\263\006\325q4\371\205\r\215"
+	.ascii	"-\246\230l\227x-\365\004\353r\275\001\f\313\206\256\205\037\254"
+	.ascii	"\326\220\007MI\034\300D\n\316\223gM\021j\330PJ\201\367\375\364"
+	.ascii	"\027\3537\326\310~'\b\r\363y$e\341\275Cx\007\n\224\270H\341i"
+	.ascii	"\222\347\311<;KI.\210\304B]\345'\221$\212\334|\344\266\346\003"
+	.ascii	"!\373\231\245\361p\330\337\214\261\307\f*C\263\032\204\243\265"
+	.ascii	"\340\375\214\003\242\252\n\304E{(\346js\3407@\220\320iQ]\"18"
+	.ascii	"\372\347\364\277\366\224\013\016\004\031a\202RZ\364\002'D\016"
+	.ascii	"\216\324E!\370\276\233\224\022\222\001\031\246m\204\300$!\025"
+	.ascii	"i DC\244\232\202C6m>\327\215\234\303\357v0:\231\335\006\306y"
+	.ascii	"M\332B]\325mS\0216\370P2\250\307\2529\024e\312\033\365\276\003"
+	.ascii	"\031\321\366\376k{\227h\200\322\003=\3323P\026s"
+	.string	"\332`\"M\227\267\354q\331\214\222\373\225\302&\333\313<\366\242|I\304\034\267u\266X\352\002%\362|\270\002\334f\347\360%Qq\352\351C/\212D\244.\366b\265K\364\027*\013\330\301@h\320\260\210J\217\226\006; \032\326\326)q\230K\264J1[\374\326\220\350\257\236\341\031\002\302\324+\t\016\360\226\022\013}\270w\233\002l\313'1/\026\306K\233-\216Qe\353Uy3\247a\237|AYh\240\374\037\013\305\301Y\266\021t&J\037\032+(FY\201QXQ\305z)\226\300&\312\216\300\310\324\013\354\3619\273E{\336\250#\026\366\313\346\213*>\3318Z\303c$\005\\\206`\371Cx\002[\272\220{\007\274\226\220\234\204+G\2466m\"}\202\220\316\362\004\335S\310O\271\313\211\250\320\211\300\203\322\202\\\254\213O\377W\2137;\340\305\243E\367\003\257,y\271z\263\376{\225\243\bm"
+	.string	"\3446\364b\372\030d\377\035\371\352\022\322\036\261\021T\024B2l\340OJ;\234\031\320\314\305\212\251\005\001\335\340\277\355\237\317\215\256[@!\361i\302>\251Z\260\030\237~\004\305\202C\3734\003\030\030%\256V\270|1\bn;\201\255\004\237'G\021b4\261\223\376\020\r\200\214\312\251\270\200\215I|\212\016\320U\022tJ\314\367\231\245\337\3533Q\360\205W\204\240\300\342\334|,6}\311\354\341v\333o\303\310Z8_\234Q\306\235`\326\313\301@(\001\336\342\247\344\3011R\240\327\331\006|\213\330\356ll\372\231\323\006\"\237\027\277Om\3506&\216]\025M\006\023FOC\254\256\007\025M\223<X\0035\373P\333\362{\216\32530K\233\320\334\347\357-39'\315\b\025+\226R\307\373\330w\276 )\2444\3755\237q\016i\234\352\363\260\315S\205\342\334\302^\203t"
+	.ascii	"\311\254E\031\026\025\246v(Y\331\211\367\346\204-\312\3645\254"
+	.ascii	"24\001\217\002\301y\336 \377&\245>e\365d\227SxZ<\353@\016:\263"
+	.ascii	"~Z\031\322\203\363\260\365\222\257\325\233-\361\341"
+	.text
+	.section	.gnu.lto_.symbol_nodes.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`5\t\275\037"
+	.string	"\366\264\2729@\352Icp$\241\r\245\271\304\306\"\001\301\223\2243\022\035u\202!\216@\004\315\206\204\304\230\306\371\016\242$I\322\242\334\346\024\243Yh\300\227~\274\205\236\003\264\273\334)\005\252"
+	.string	"\255"
+	.string	"\245"
+	.ascii	"3\236\346\224q\257g\246F\243j\001\257n-\306}\235\351\"\f\333"
+	.ascii	"a!\003\373^\334\237\231.>\350\264i\213+\001\244i\232\262\270"
+	.ascii	"\027c\272\270\302\223T8R\004K:\035\0300\205)\235.\242\360\"\313"
+	.ascii	"\21552;q\377\3054q@%<\212\304\377\fG\334\217\b\227\naR \034x"
+	.ascii	"\332\364\203\357N\027\033\370\323\003\207\362p-\035\376\306\341"
+	.ascii	"e\033N\246\341\\2\334\013\004\213\302\360.\247\213\250Ae]\017"
+	.ascii	"\326\003\235\326\276\232^\270\233\205\033\032^\035\315i;\230"
+	.ascii	"\032\215\351\233}mEd\267\313\345rY\341\336\314\264\035`BD\270"
+	.ascii	"\266\272zp-\221\340\253a\0173$\325\236\254\270\223\321}EgzjN"
+	.ascii	"\327|U\274\211\2125M1&)\276\004f\277(\326\203\342\275'\266\344"
+	.ascii	"\304xM\274~9\357\364\272?\323uo\206\311}\031s\311=\031%\367c"
+	.ascii	"\346\326\346\326\222\334\243!\271\317b\036\271\277b\344~\314"
+	.ascii	",r/f\022\361\3379\304\217N\256\3730?\2619B\356Us\353\336J\220"
+	.ascii	"\247\235@\356\215&\203\2579\177\334\027\265\356S\363\305\271"
+	.ascii	"\311\371\270^\366\270>e\032\323=<\256M\231;\216G\307\357\344"
+	.ascii	"p\035\216o!~\316\215\267\331\370Z\rW\242q\344\031?`G\227\346"
+	.ascii	"KU\026l\275\367\320\300 mg\353\344H\311V\310za\230]\352J\266"
+	.ascii	"\004\326[\316\217\036\244\357l\203\352\217gku\353<\333\343=\033"
+	.ascii	"\265\373c\332\275\332\232{5j\356\353\244\271\247\203\346^\316"
+	.ascii	"\231\3738f\356\341\224\271g#s\377f\314\275\033\264\373Cb\356"
+	.ascii	"\021\205\271O\004\346>\356\354\236\320\227\373Bf\367pe\367I\262"
+	.ascii	"{A^\356\355t\271\317\303\345\276\315\226\373=Z\356\371<MS[\301"
+	.ascii	"\362Y\356\373\034\213\031]\261\243\323\326\372\322\n\362\265"
+	.ascii	"\3455\346\271\363b\246;\355(]_^\001~\332\261\220\201}\250\223"
+	.ascii	"\366\306#(F\342S\345\244\025q\347\244]`'mp\025e8\033T\2062\234"
+	.ascii	"\265\n\345@\310\300\276E\006\314\262 \256\262lP5\250+\3734\006"
+	.ascii	"\024\254\025\037j\205*'\324&\350\204\332\256>\324v\341\rQ\353"
+	.ascii	"u\364C\r\264\251\335\261'\324\202\255\177\312O\250\375\332\332"
+	.ascii	"\246"
+	.string	"^\300\333\037\233\363P{\267\344/\304\261=\"\242V\270\356\021\255P\375\303\310\001<\263&\242\245R\336\022\242\013+\363&\242\245:b\032Z*\3656E\266\\\235ih\257|\321zCk\240\200r\255\262\004\216\003\224BKU6\270*\203\307\200\240\2501\fBt%\222$\005\245J\007\340\002)*M:\021\200 \350\221\021\021\211DDh\222\036\027\3776\345s\350p\027\243\265\r\022\260`\036N\262\002\266\303\226S \207\001\220\005\311\322\177\276\200\307\305\316q\352\312\341\277\245U?\247\317\007|\244\222o\214\274#\306V\226\277\332Q\206uA\037B\n\244 \005R\220\002)H\201\024\244@\nR@\006Z`\270M0\357,\"\247\351!\002\313\261\202\266\274\f\216#\030\316\242\344\307\343\354\265\227\275\366\333\263\013/1\271\362\375sC.\222k\350;\244\205\373%/V\3235\324\247\332\f\fY\270UZ\3202"
+	.string	"NgK\340\320\021 \255\2739\363t\2029; \260)\300\031VV.\241\275U\275\377\3262Ec6\013\027|\2665\350\316\246`G\025\233\t:m5\272\202=\307\203(\256\264"
+	.string	"\335\271\241wp9/\301\313\244\266{\334s\277\376\236\255\256\0320+\354\344\272"
+	.ascii	"V\001"
+	.text
+	.section	.gnu.lto_.refs.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`8\003\215\026"
+	.string	"\2668\233E\320\3306\303\001\200\t\304.\203p\274\264\025D\320\025"
+	.string	"\t/\270\302O@\320\033B\020X\004\232A\256f\220\233\215f\220\313:\277\3000tM\024k\333f\337\217\346\251M\315!\232u\330\367S\023\021\221\221\266e\n\205"
+	.string	"\205"
+	.string	"\213"
+	.string	"V\202`~*\241\037\212\350\177\342\244\311\022%I\220"
+	.string	"\221\376#Z\337\310\350/Bd\210\250\037\344\373\201x}\037]\277\007\327\377\331~\037\255\317#\373q`\277\215\353\257\001\366i\310\370\3721D]\302\367\021\274\316\323\365\035\256\353\220\036\202\326sF\337 \3648`_p\365\233\320'\370\272\215\250\037\370\276\345\365\262\353,\256\257\266Wi\275&\373\001\241\217\301\3364\2374\377\233\337a\257]=\233\177\365\367y\f'_\253U\2523\362\347\351\213\272\346zg\354:\250\177\320g@\376\315\330Y\332\253\270G\235~\344\276\224z\230\356G\336{\337\005\300G\004:H\3237\232/\201\007`\037$%\n\212\374\231\214}%\247\316\373\177f~\035\342\177C\024?5\363\330\314\267\013\030\335\026`\357\n\360\233\342\353E\341\365\236\350zMh\275$\002|G"
+	.string	"\370\212\340zC\220\276 \262\357\007\0172\275\034b\376/]L\277\226\322\217%\374\257\004\313\204=4u0\347E\245\336\255\236\013\373\225\372\246\na\033\f{g\352Y\316\207J}\256\276a\037ds"
+	.string	"\372\266\315\267\321|;\3157\322|\313\346\233\203yW7\330nj\2342\350\265yA/\271\202^\030\344\367\305\330\353\242\305\374\262\270\371\252H\360-\321o\210\016\033\274\330\364\271 \350o\321\222\005\004\373U\202Z\377\224\003\363\243\264\2364Y\002\376@3@\260\347\200\275\005>\313"
+	.ascii	"\212\365!\353\263r\236\211s\021\353\265\325\001\0174O2g\246\206"
+	.ascii	"\353#\223gf\230\030z\241\027\301\026zaZ\241w\343\\#\037\033)"
+	.ascii	"`w\234\023\372D\365\236\2260\271\236#\314\213\314\211\314\207"
+	.ascii	"\314\205\314\203\314}\200\314\177\314}\314{\314\177\346>s\036"
+	.ascii	"\363\035s\035\363\034s\034\363\033\263\247t\013\325\r\234^U\366"
+	.ascii	"\232\262\027(\237F|\232\262\243\310?\211]\246\347c\310^\"{\330"
+	.ascii	"\363 \331?\362=\236\367\304\316\361\374L}\311\356\230\016\225"
+	.ascii	"\035+\373,\277\342\267\254N(* \220\242\251\261;y\340\204\030"
+	.ascii	"\303x\026\356&\342UA\243\025x\354\343\002!4\215\353\034\236`"
+	.ascii	"b4\263\215\027\022d\326XW\204D\\\034%\365\300\224\013\337\355"
+	.ascii	">\247\227\300\016!\007\216)\\I0O\005P\356\030\021\017O\026\273"
+	.ascii	"\037Wb,q\004#\2048\202q\b5c\177\342\"\201\200\003@0\244"
+	.text
+	.section	.gnu.lto_.decls.14464f960a7f2757,"e",@progbits
+	.string	"(\265/\375`\036z\235\362\001\332'\253\261Q\020(\344\2554\006\203\362F\021'\007\357m\033C\272\253\366\030J\"\316F\033\203\227R\256\365\244\275n\367%\350\315\r\b\244\344\214\0217\262]\002"
+	.string	""
+	.string	"\030k*l\351\r\004\300a\024\030"
+	.string	"Bow\321T\340\311\260L\034\326\377\201\210\334{\313-e\n\275\t2\013\217\013C^\372CX\372b\356\321y!>}!8\372Bd\364\205\252\350\013\r\321\027\272\322\017\272\323\017\202\323\017B\323\017\212\242\377\362\007N\273r\256\032\373\304\007\032\316\267\316\322\313\037\245\23020\372\340\374 &\372AD\364\347\356\321\371\240\034\372A[\037(\216>\020\233>\020\232\376\313\0323.\\\211\305\001\241\257\0359\326\340\\\332(o\274\304*\257J,\021\\{O\225XE}\366\236*\272\367\202{/\310c^O\276\234\371@e\372^YzY\243\210\216M\317\t\316\007\n\323\277$\372@8\364\223\367\350<\020\r\375_\037\375\337\034\375\337\031\375\037\232\376\257\212\376\357\210\376/\207\376\217J_\327\321?\356\303gE\345\306\306\031\363a\271\274\205k\350$\363\304M\013\037<?8ut\304\330\263G"
+	.string	"\267&G.\033\326s\266\363\315\2170Gp\306\373\"\345\321C\003\267%\006g\275\037\327\3418\030\017\346\322"
+	.ascii	"t\227\345\215\030\234\363\222\312\267\274.{p\276\236\323\017"
+	.ascii	"a'\343\307v\360\035Nb\274\213\206\357`:a\310\346\314x\253s6\242"
+	.ascii	"*\243M\203\252\006\330\336\033\337\301r\316v\347\274\354\027"
+	.ascii	"e\034@\201\262=$y\360\340\001\253\371!W\003(_\307\351k6}\215"
+	.ascii	"\246\257\313\364\365\025\255\367E:\357\206\023\207^)\343\345"
+	.ascii	"\345\215\233 vw\262p\376\217\333`:\314\006\317]4\354\006\257"
+	.ascii	"\371E\356}vf\211\031&\311\021hp\\\006aD\274\260\366\334`\271"
+	.ascii	"-uGDX\226\027\326\336\336\310$\017\036<x\320c9`\214\001\312\327"
+	.ascii	"8\364\265\225\306q\030\303a5\307q8\315=\030q\241*\034\227\367"
+	.ascii	"\236\272\367\002\242{/0\337\232L\231\235\371zJ\037\275\323G\313"
+	.ascii	"\350\243]\364\217\313\274\261\320\322\322\362F\346r\021\345\340"
+	.ascii	"\"\366\003g\334\206\307\\\264\r\330\r/\tU\026\316G\311\264\b"
+	.ascii	"\366\276\033\316\333\327w7\234?\026\263\001\255\3226\344\b[\207"
+	.ascii	"=p\250\304\326\222\206\354\372\250\221S\013s\306\030r\266\006"
+	.ascii	"\347\037\1779\016\363\337<\f\346l\230k\3570{o\rZ\206\236\037"
+	.ascii	">8\337}\221N\234\266t\374%\001K\212\214\341\\b/eAu\354\244\244"
+	.ascii	"p~\210,K\300\310\2564\231\033\273x%R\214\216\301\305I\262\fW"
+	.ascii	"1b%\211FL\314\312\305#\2322\332U/\236\234a3\274\005s\301h\030"
+	.ascii	"\211\273\\4\\\206\265\034\223\335\266\343\2452\214eOI\201\360"
+	.ascii	"\206\344\323\261\2677\022=\273\243\321f\224\211\356\321y4K\037"
+	.ascii	"\235\322?\361\364\3178\372'\031\375\323\213\376yE\377\\\242\177"
+	.ascii	"L\345\362@\202\006\211\363\257\335\177\331\350\324\311\323\223"
+	.ascii	"\003\226\247gM\033\272=0\266\270>`sl\366,\365\261\375X\t\336"
+	.ascii	"\201\2610\017\334\004ka/\214\004C\301Y\370\013\203\341(\230\t"
+	.ascii	"\326\201\3030\016\334\003O\301G\260\024\354\003/\301?p\022\034"
+	.ascii	"\004\027\301D\360\023,\004oa \270\013\033\301Cp\016\314u\321"
+	.ascii	"\260\023|ul\003\337xF\356]\345F\346\252\225H0\264\213\227\214"
+	.ascii	"$\231\233\033\347\316i%@\314N\022\313\0365rk\370$\261\223\273"
+	.ascii	"\345z!\2522\332U^6\300\310\370\340\222\227-\215\237\274<q\320"
+	.ascii	"\300\3702\342\277y~\320\\\266{\346\252\375\271f\376%\374\002"
+	.ascii	"W\201\371sf\t;\3012p\r\242r\357\"d`{\357_\270\030im\373\252\255"
+	.ascii	"\331\365I\223t\373\227\260\224\332\022\236\302Ua\346\370\304"
+	.ascii	"%\341\376\233\267'\007\366\366_\266[\246/\017\217]\262\355\277"
+	.ascii	"lcf\200!\323\256\032\221\224\321\246\242\253\001&g\316\035\330"
+	.ascii	"\022\266\272jwN+\001c^B`'\367\356\342\335\271$\r\300B'\211E\315"
+	.ascii	"U#*\367\026\302\007\2667\362w\355\277l\277\007#\260\223+\346"
+	.ascii	"\252\241{n\307\350\342E\243\374\262\207Weoo\244\207$\017?8n\342"
+	.ascii	"\\!!\227\310\213t\202p\217\316\237[\343\032W\215\003[\003*\245"
+	.ascii	"\317\006\036\316x\306\3221\215\243\023K\013\271\275\354\275\213"
+	.ascii	"*P{k\303\031\275G\347M>\372f\034}\263"
+	.string	"\214\276\tF\337\374\322\230*\363Pc\304\t\3167\273\364M\031\372Y\217~\206\323\317k\372\331L?W\321\317P\364s\022\375<D?\337\320/\365\350\227k\364\3130\372\245\024\375\022\2116\272G\347\265s\223\027m\203{\347\267\316\265\2739\205\334\310\275\221Ex\211\23743\234_\n\321\277\033\234e_\337\335\340|\211C\343{t\276\234\322Ftt\322\233\013\347\242%\335\272]t\333P\331\330\302\371\370\215\036\301\276I\347\373n\322y\214F\037w\321\035\232\350\016.\322ylC\203\220G\377\312\351{)\323\027\223D\377\214\r\375\271\213t\376n\3758\027\351\274Q?y\221\316\247\332\202{t~\357\"\235\367\313\005s\321(\270a\356\301\210\227R[6\226\275\221EC\177\254\374\341\303\371\026\320\277\024\234\267\357Rp\036\205\276f\367\354\242u\270]~\313.\331\177U\310}\2667\262\350\007'/\210\027\234\337"
+	.string	"\375\313\345\023\264\331#N\201\376\355p\026\365\365\365\365\335\016\347\261\316\367\350\354\340\036\235\026\\\244\363\277Z6\320Un`\260\340\374\337,\377\275r\261PPZ\325\340\332^\366FZ(B\362\270*\202\363\221\027\351\324\367\350\374K\016\344;\345\211\207\1779\2022\004%Q\026A\376@\362\317Q?\346\322\305\316_\262\360@\t\371\356\317\024 \203S<\201\037\253\177\331^\016\340\016\177\311\342\004\374\270\304\217M\374\2451\303\217/\254ObR\241\001\217?\327\371\263\335\237\337\374\231\356\317j\376l\346\316m1l\372O4\270\317U\224NmR.\006T\3701\225\213\201\246'?\246\002\374K\027L,\360\227J_)4 \037)\203\362\033\026\373\320\177\232\241"
+	.string	"\231?\273\215\3713\333\237\3110\360\177\203\314$\267\211\035\303\177\016!*+(-\bf\t\224\345\024\177n*9\270+\\\340\032\362\227\024\377\360\237f\031\020\237F\310gfy\213\004\312\376\233\232\370\313\020\376\334\343b\240$qR]\024\376\253\342\246\220E K\245\\\200l\200?\231\354\177]\326r\274\227\021p!\360\227\034\256\211\377n\360\337\022\345\206\234\345\317\013\370\361\025,\177\276\362_\016\177i!\217\345\022\331\304\237\255\374O\272\206r\001\031\262\330\377;X\354$\374\347\206?\353\370\313r\312\237\261\356\223\262\224\277,r\244\037M\361g\254\377\266\270QO\216\376(\212\256\020\256\007\316\341\027\270\212[\370Q\022\377mq\243\356\023\0262%;\371\221\233\374\345\b\231I\017L%\314]\341\002?\036\362\022\362W\216o\360\243\037\376\353\201r\204\013\225\003\335\240l@>r1\200\251\274\202\037\r"
+	.ascii	"\246\221\215\334\273\262\003\r~\364\243\032\362\f\275\\\304\353"
+	.ascii	"\307\002\370\037\246$\276\004\016\271\353\032~\364\350\307T\362"
+	.ascii	"\220\377\256\360\2271\320\242\277d\312BJ\242s\370\313\246\337"
+	.ascii	"\177\262\275\0044\250\317\303\374\317?j\376\345\217\034\344/"
+	.ascii	"\311"
+	.string	"\320\330\316\250\311[\177I\346\317@\376\222M\376\221}\374e\335\222\0373\371q\223\277\364\221\265\376S\360\243\005p\373K7%\177\311\005\f\333_j1#\273\362\227i\252"
+	.ascii	"\031\322\345/\303@\371K-M\376\222\313\325_j\031\301_Z\201\372"
+	.ascii	"K-\377%\376\367\351\277\305\377z\340\307BP\252\314\341\277P'"
+	.ascii	"\372\365\210\377\246\377]\361_\016\374\027\370\347\r\376\213"
+	.ascii	"\201\377\347\257%\360\347\243?k\370s\206?c\370\263\321\237/\374"
+	.ascii	"\031\351\317\033\3762\204\036\177\351\347\317E\177&\342\361\337"
+	.ascii	"\350\327\351\237w\3749\353\317W\177\246\361g\021\374\031\004"
+	.ascii	"\177v\361g\017\374\271\370\347\247?\253\360\347\365\317M\177"
+	.ascii	"V\377\034\374s\372\347\013\374\271\002\177V\361\347\023\376\\"
+	.ascii	"\302\237M\374\231\001\177F\300\237\r\360\347\002\374y\304\237"
+	.ascii	"=\370s\007\177\356\360g\016\177\226\340/\345\374e\335_\276\371"
+	.ascii	"K\272\277d\363\227k\376R\315_\302\375\345\231\277,\363\227d\376"
+	.ascii	"\222\355/\325\376\022\355/\313\376\222\354/\307\3762\354/\245"
+	.ascii	"\374\345\223\277d\362\227_\177\251\302_\036\371\313\"\177\331"
+	.ascii	"\365\227\\\177\t\344/{\374\345\216\277\314\361\227Y\177y\365"
+	.ascii	"\2274\376R\306_\306\370\313\246\277|\361\227S\1779\202\277\f"
+	.ascii	"\301_~\340/]\374%\213\277l\377\222\375K\343_\022\377r\370\227"
+	.ascii	"N\177\031\374\313\364/S\370\313\023\3762\002\177\371\200\277"
+	.ascii	"<\361\227#\374e\b\177I\342/\027\360\227\007\370K\020\376\362"
+	.ascii	"\203\277\024\361\227\036\374e\007\177"
+	.string	"\251\364\227\034\374\245\207\277\324\340/3\370K\f\376\322\202\277\254\340/9\374\245\004\177\231\341//\374%\321_\n\375X\310\177\217\377m\377\362\374K\363\277|\376\333\342/\313\277\274\177\371\037\377\371q\237\037\363\371\361\336\217\363\374\270\313\217\321~\214\345\307W~,\366c*\377U\374/\341\307S~,\345\307Q~<\344\307A~\274\365\343\247\0373\375\270\351\307!\374X\304\217G\374\367\003\377u\361\337\250\377B\375W\375\257\360\277)\3747\002\377Q\370o\t\377M\361_\022\376\247\370\357\b\377\035\361?\313\177,\377\215\374\207\373\017\242\257\257\257\357'\n\363K`\344\227@\220zl\314\207\027\006S\372?\305N1\374v\263j\027\021\003\333[\353\303\020\2241.T8\377\202>T\250\\\265$.)<\013\360j<\321\221\375\330\201\243\004\347_pf\312\2248\260\013\266D\211\"\003\016\314\212\376O\260\023\254\314"
+	.string	"@\274\354\304\366.\030\342\304\311\337N\354\251\254\016\252\344\331\211\355]\020C\377\\r\261\035\266c\263c\373\217\003p\325\350\221!\007\347\237H\356\251\344\274:\277L+Z\nK\203y\322\227\264`O\337\202:\375kZ9\377\363\310\221\033\247\003\264\213\235=I2E\212\354\231uu\325\231\302\305u\266l\264i\334\260\003vD\377\247\020!g\313\310\315\344\372\241\263\023\023\333X\373\303-\320\322\377\271\365\213vn\3410'\270\246\240\200p\205\013\315\233\272\003\004\347[`C\377\247\326/\332\251u\376\350\300\265sd`\006\311\247\303\334\023\243\313\n\316\247\017\264\211Z\231$\316\007\200\037}"
+	.string	"\324\351\2379\356\271\343\274:y\\\274\274\223\354\251\251\021}t\310\017\007"
+	.string	"\031}"
+	.string	"\220\351\337\213w\376'\326/\332\211u\3428\301\265qp \005\013O\016\250\210\035\f\0338\237Y7LH\327\031\316\007\300\024}"
+	.string	"\024\321\377i\343\367`\304E;m\\\265\273e\337"
+	.ascii	"\222A\305Gko\3573\037\212\362P\t\262\004\347W\260\247\177Z\235"
+	.ascii	"2~\316\3709\343\254q\367\336[kK\335\031\321gf'\266\267\265\260"
+	.ascii	":\374'\215\2375~'\2649\020ayK\356\301\371z\246\225\377?\340\333"
+	.ascii	"\327\036\316\257`M\377\277\307\377\271\247\260\366\3368L\344"
+	.ascii	"\306\242\022:\377\373k\336\333\341\037\272\345\305\340\177\336"
+	.ascii	"\373!\020\001\271c\324\341\331{_<Z\n\333\024\020\013\2669\267"
+	.ascii	"wU\227T\003\272\262\252\272zX\235ueY\260:\353\332RUN\244,`\355"
+	.ascii	".)\253\263\275-TUI\231\340\312\262:\233\332\026\254\316v\326"
+	.ascii	"~\321&\353nd\227\324\256\342\332\026v\325\236\332g\\Y\026XUu"
+	.ascii	"eY\235MeY\260:\353\312\332g]\333hWMa\311\250\332X\026\366Y\327"
+	.ascii	"\235}\306\225edu\306\225eu\326\325\347\252\241\221\027\327\003"
+	.ascii	"\016\236'j7\313\252j\333\270\332\232\3022\232\263Br\3558{_/0"
+	.ascii	"6\326\236\333\033\203\275\267\270\260\342L\365\270b\250\346l"
+	.ascii	"P\205\231\342\272\310\275\367\206+*/\256]5'u\367\234\325\024"
+	.ascii	"\256\275\247P9\355\253\275\367\026!\205\234\333J\356\234T\221"
+	.ascii	"\255]\003\306\336\022l\344\336W{K\335=\267\367\226\332{\243X"
+	.ascii	"[\310\275\177\030Y\201]]\355\255\225t\265\267\244\332`\354\215"
+	.ascii	"\275\314\021\223eu\346\305\265\324\206v\006\266c \245\256U\r"
+	.ascii	"\256\r\266\343ta\3513\251\262]c\357}\3634XV\016<\234\221Ab\204"
+	.ascii	"\244\351\300\371|\001\307F\204\r\347W\340C\237TB#]\310\340\374"
+	.ascii	"\n\260\364o&\271hf\022\274w\002\271\2458\204\271\341\275FI\032"
+	.ascii	"\316\377\271\317}'\306\317\237?ib\344\364\351s\266\213\225!F"
+	.ascii	"ZZrca}8\005f\370\3609\333\177{\237\321\022\263\261\264>\334,"
+	.ascii	"8_\346\340|\n\272\350\337\334\273h\346\336\331N\354\027f\002"
+	.ascii	"\350\221g'\266\267\261\264>\b!ac\347\r\347S\020D\377f\332/\232"
+	.ascii	"\231f\346\351\240wU\334\237\344\336Z\037\202\202\354\350\021"
+	.ascii	"\003g=\034\347-\215\031\234O\301\r\375K\266\306'\357\216Y\207"
+	.ascii	"\017\317\3143\223&\036\363\316\264s\321\314;&\235\233_L0sj\346"
+	.ascii	"\035s\214iw\347\222\344\270;&\233\235\344\317M\307\024$D\371"
+	.ascii	"\024l}\016xz\016\021^\030.4\234\317\201\215v\223C\206&n\215\214"
+	.ascii	"\2349g\276\231e\326\200\355\275\227\322\300\201\301\245isF\215"
+	.ascii	"\334\334\234iF.\331\306\224c\326\231pL6&\235\031\307|c\2721\327"
+	.ascii	"\\4s\316TsS\214\3316g\306\345\2003eoo\344\bS\340\350\311\220"
+	.ascii	"\317A\212>\207.}\016;\3649T\351O\200\247?\001\235\376\004o\372"
+	.ascii	"\023\230\231ep\225\326\252\252\301\003\347O\200E\177\002#\372"
+	.ascii	"\023\354\320\237 K_\254\213t^\340\243/\301\235\276\004m\364%"
+	.ascii	"0\243\357\334E:9\334\243\363\022\234\351\337\364\202\026\364"
+	.ascii	"\204\214\026\236\0264S\213\211v\202k\252k\211\f\307\230\216\275"
+	.ascii	"\275\265>d\036I/88sIJ\241NK\017\234/\201\230\376%+;\033\321o"
+	.ascii	"\3573Z\314-&\331\331\210\252\220\233\311Y\347\026eo\317<3\315"
+	.ascii	".\232\271\305D>#\267\007\017I?+D\304`\234\371\022\374\320\227"
+	.ascii	"\300\206\276\004V\372\033\372 1hU\261\201\363\230y\345\307\365"
+	.ascii	"\303l\n\347o\3003f\212\tM\361Xc\203\3637\330i\223J\321\224\033"
+	.ascii	"E\320\340\374\rk4R\013\325\0238<\205kI\034$o\260\224(\346\234"
+	.ascii	"\264*w]7\243\374\246\227Y\304\204\"\304\325f\006\207\2053X\322"
+	.ascii	"\231$\217\025\025\316\337`F\3777\231\230ML'\027\315|b\"I\nq\004"
+	.ascii	"\b\330\336H\363\211id+i>1\223\230K8PY\355)\257\f\244\264ya\021"
+	.ascii	"q\335\245\275\321\3717\227|\225c\376\340\335\311C\236S\222\340"
+	.ascii	"\271]4S\t\246"
+	.ascii	"\363\377\027\271\223p\0169J\356p\376\2066\375\ri\372\033\264"
+	.ascii	"\350o\b\323\023\354\213t\226`\367\3504\211,\335\354\022\312\213"
+	.ascii	"sf\005g\tL.s\310\0240zT\220\350\030\267\344\225\020|'\n\025<"
+	.ascii	";p\376\315 &\r\"+ch|0.\036\221\2717W\034\260\271\2529\311\245"
+	.ascii	">s\312\f\215\236Ur\355\216\333\227\334^^\346\303F\365%\267\227"
+	.ascii	"\274jKt_rb&\225I#\363\345?DU\310\235E\244\226\367%\267\007\227"
+	.ascii	"\247\r\317\354Knon\017\216\223\362%'&\267\207\343\316'f_r{1\300"
+	.ascii	"\344}\311\355\345\345\321x\303\003\305\353Kn\317\244a\276\270"
+	.ascii	"xDS\310\215\205\252\345\370\222\3333g\230<L-\023\207i\303\274"
+	.ascii	"2}\2309L\031&\226\231e\3660u\230?\314\035&\020\263\206\271e\336"
+	.ascii	"\270h&\r\323\352\371\262\331\271a\322\310zJ;n_rb{#\205\200\214"
+	.ascii	"\231\311\353\220\277!\206~\022\036\375$6\372I_\364\223\300\364"
+	.ascii	"\223\272L\251\241\271\036r\276\340\374\244+s\363\311~\356\025"
+	.ascii	"\036#Tp\276\2067:\367y9\305C\r\033\316\3270F_\303\026}\rS\364"
+	.ascii	"5\f\321\3270\245\237!O?\303\032\375\fi\372\031\246\350g8\242"
+	.ascii	"\237\341\206>\222\036}$8\372\317wu.\222\313\212\2379\231\016"
+	.ascii	"&s_\334]\361\301\031s]\2443\203{tf9K\317s\210\262\254p\371\202"
+	.ascii	"\263\2058u\270\016\332\024\267:8@x\246,\271\201\363\033\240+"
+	.ascii	"N\270\300\341|\2441\332m\016\230\0341%\020\242r\357\251:`_2\232"
+	.ascii	"\234&\253\311m\262\231\274&\303\345\271,\227\351r\\>\223\335"
+	.ascii	"\\\264\314&\223y~\313e\340\326\354,e69\314\236df\223\331J "
+	.string	"wN+\217\335\335\274\314&{\311iw.I\306\322'\331FG\255\213\237\314\246\244Qf\3359\255<\345Or\214\035\330\336H\017Fd6\031\314U#\222B\356\033\350\223.\273\261\244\241;[n\230p\310\030\353\"\235\030\334\243\363H>\364\221\262\364\221\254\3641\370\321\307\240\247\217\341N\037C\034}\fr\372\030\330\3641\\\321\307PD\247\375\342\335\"<M\3700\301\371\030|\350c\310\322\177F\343\222\301 a[\203s\346\362\347*Y,\237a<aRH\234\315\364\22382\316\340|\fT\372\177\316\222\3132YFf-\027-o\311V\236\307\362\22574^\310\336\264\200\221)\313\304\310\222\267d,g+\313\2602\300\250\373\222\334{'\t\335\331r#'\224\177\324\247/\327E:1\334\321\345\334E:\023\220\251\3440:jY}p\376sX\311gfk\017\024\234\303\310\230$\345\326f\260\261\311"
+	.ascii	"\233\333Z`1d\364\201\341\272)\033n\370\252h\200\305(\255\254"
+	.ascii	".\022-H\022\314U\230\032`X\306\254$_\314\210\261cO2\314\312X"
+	.ascii	"\262\207\226\035\260\030<\366zl\3259\342$\f\031\027!\270\016"
+	.ascii	"F\235\2142\214J\226$r\213\222\344\221%l`e\217 t\300.\333\027"
+	.ascii	"\033G\300\276\200\365(\273\214\254aS\243\021\243\324q\343\274"
+	.ascii	"\340\223,\217 \201k\242\326\303K\016\f\327\341?H~`1K\222tK\222"
+	.ascii	"F\t\232\362\310\327\0319%\325U\222\257\034S\262)\221bF\240\352"
+	.ascii	"K\356\275\273l%\221e_\3116\245\324\r0)d`e\232\021\2550-M\236"
+	.ascii	"\200\231#\022'\006_I\243\314*\221`\"p\361\223,\217D\361\022\003"
+	.ascii	"G\037\\\207\373\220\370({\024Q\223\354Q\362\225>J DRF{\033\271"
+	.ascii	"\003\333{\037)\247\274\321\"\307%'Y\332\3118\362\316P\262\214"
+	.ascii	"\374$_\345&\031I\036\222\231d\260L\225\245\312<\231G>\222\275"
+	.ascii	"r\221\362O\356\312@J\275\362\256\354\223\253\262V\316Q\366\225"
+	.ascii	"yyG\306\3127\262\215\274U\312\311:2\221\374\"\373(\365\344\251"
+	.ascii	"lU\372\311B\3129\345^6\222\223\224t\312;e2\303\310SJ>yF\016\222"
+	.ascii	"\263J\274\314\225\227d\032%\236\034#\377\310_YI\356\221\245\344"
+	.ascii	"(\271F\271\247\254\223\235\224v\027\255\344+\341\274\254+\343"
+	.ascii	" \221K\226\332P\371\001+\303\304\256$\217@y\223V\306\310\301"
+	.ascii	"W\366\020b\347\305G\331\303H\034\330E\236\rI\266\301\362\004"
+	.ascii	"\254\f+\263\274q\202\353\260\237: `=\206\030\231C\327g\356\212"
+	.ascii	"X\362\r\237d\031V\362\225X\222\345\221\222\257d\262\226\334\033"
+	.ascii	"\351!\351\302\355\361\"\273ZY\213\271H\347\235q\217\316\037\271"
+	.ascii	"\321?z\323?:\323?\n\323?\352\322\177\351&\246l+\347\356O\007"
+	.ascii	"\2321k8\257\3713c-\013\316?\002\242\377\227q%\\\251\246Ls\321"
+	.ascii	"J\271\322\314\3133w\356x\304\233\223$Y)W\2421\023#\363\004\254"
+	.ascii	"\224+\313\214\031\323a*"
+	.string	"\321\302\243\003\312?\332\372\334\243\177A\217\376\005=\375\013y\372\226-\275t\313E\362\334\210\202\363/\330\3217y\221\316\n\356\321\371\013j\364/p\321\277`E\377\302\227\376\005\037\372\027d\350[\320\323\267\020\247o!\214\276\2050}\013\\\372\026l\350\033\365\351\033\335\351\033\251\3217:\3237\262\242o\324D\337HK\337\250J\277\350N\277HN\277\310M\277\250L\277(\212~\221\227>\362\036\235/\272\322'\372\243OTG\237(\215>\321\232>Q\230>Q\020}\"\032\372Cw\364\207\346\364\207\326\364\207\250\350\007\377/l\007\362\217\025;\234\177P~P~R\356\306\332c\366\213\362\237\224\";b\220\320\301d\300\3600\221\302\371!\372\350\377\007\366\313\342\021\347\306\rg$\226\0337\226p9\001\202\302Y\013\273B;\333\217I\031\330\336\333Hh\016\0365/8?D\236_\222_\222\337\327/L)\341"
+	.ascii	"\312\035/\254\237\222\377\276\314%']2\310\214\020o\364\377Cr"
+	.ascii	"\226\245\371H\342u\344\204\241f\326\004\307\317\210I\207\316"
+	.ascii	"\n\234_\221\037\r8D\316\376\340\374#\362#\362\353\272XX\b\270"
+	.ascii	"A\007g\312\336\326\322\321\341\327\365\223\201|\343\304\b\316"
+	.ascii	"\017\201F\377?.\263\212\020\034g@p\376E\373\r9\353\034\200W\303"
+	.ascii	"\310O\b:\306#\n\237\216 pP\326\320\251\263E\346\302\227\251\037"
+	.ascii	"@\324H8se\311\017\024m\212\316\217\036\037(\231\007\304\370\261"
+	.ascii	"\243ur\001sVf\252\207N\262\306\217^\025\3169r\374v\334-\373F"
+	.ascii	"\224\215+}\210\344\334\311\375\320\361\337\016\2409/\322\274"
+	.ascii	"\234UDi\312\262\334\210\335\270\361\313:\307lT\311S4\365EF\317"
+	.ascii	"\017\353\277\254\2735Vki!\276~W\277\253\263\354\362\260\201$"
+	.ascii	"\212\230\031\030/p~\210\036\277\375\333?\032\247\026\033U\362"
+	.ascii	"\210\235uB\310\310\374f\374G\343N\311\033\237\026\316?\030?\031"
+	.ascii	"zn\266\216\340\374\377d\374\254\200\204\301\252\323\023\001\027"
+	.ascii	"\0375\277\030&\235!\036alpp\376\2758\033\232\027N\340\340\374"
+	.ascii	"\253\372\332\245\361\345n\n\316?\252 \256:I\216\340\374\233\372"
+	.ascii	"\032\2325\275\0358\377\244\276fe\213\236\2555(edP\211\363\347"
+	.ascii	"\217>\223\244w\0265 \311 \253:yrp\276\007||\272\317u\3332\246"
+	.ascii	"#\f]\027\f\234\373\234-I\224\"i8\337\003\261\274\347\351=w\313"
+	.ascii	"\2761BJ\224=1\242?r\340\366\336\365\036.}\214\320\301Y\343\321"
+	.ascii	"z\376\377\204r\020\331c\323zt\036(Ml\364\340\262\261\336\225"
+	.ascii	";"
+	.ascii	"*\255g\"\353\330\260\323\307\003%w\356\3505\n\334\246\306t\354"
+	.ascii	"\021\241\275\361"
+	.string	"\231\203\363=\260\262c\247\r\307\230\216\241<lm\272\336\324\251s\326\001i\271\312\343\001\244#,\256\006\031;\273\263\216\350\317U\037\036\261\353\005\247$\b\316_B\312\221\303\343\312N\236='|\266\322\340\374\245\257\272:\275v\333\360\306t\240zk0\270p\376\222\2157o\364\030\n\264l \211\262\227\307z\200a\303\371\035\200\241\243;\353\222\270\244\364P0\033^c\030\316\006[\033\316\357`+\356zM\234f\203\222Qr\304\327tdH\334\3345\233\270\263\217\213\230.9\255\246\203\035i\322\024\361\270\352\303#\266\267V\207!%t0\304\344\224)\243\317l0\3235\246\343\232\241S\325\307\314\365\231;\214\345\314\315\225\0312?\031=\346e\225V\207\007TY\243\205\363A\234\211\021\243\307P0\345\352N\354\307F\313]\234n\273\036\303&\364%K\337\031\020S\320\256\303\240\351\265 d\322\246\252\332B\204"
+	.string	"\221]\361\321\332\333V[\035\314%i\264\354\320j\327k\267\313\0346n\372\3135\230\377\207\326\275\201\333\202\363\225\372h\355\345:\355\377\231@r\330M\301\371Jz\364\257\273\374?\241$qrx8_\351\216\276\222]Y\231>;u\\\345\301\"D\306\247M\026\263\353\263!=.sZp\276\236\336\362\377w\312\335\350\303\007g\245,Y\262h2 \261\253<\036btGf\320\320Z\256\311\212\250\302\230\250a\371\377\033\022\253\363\306\007\316W\312\272r\345\224\273\262\223GL\210\r\013\2233sV\254\234uHc\256\356\304\200\314 \261\262\\\251R\345,\273[\366\215\rdQ\306t\020\225mM\271\203\363\t\320DO\321StX\022\227\324\235\016W\362:\2302\370\366\320\351\260\213\007\264\244\f\006\021\234O"
+	.string	"\035\372\327Qt\224\223\3135\332U^ht[\023\252-\234O"
+	.string	"*\375u\r\246\277\364\217\0250~df3\222\033k\353Cy\207\004\207\017\234\265\023\375D7\321L\364\022\016\356\264\220k$Z\210N\322Ak\n\207\b(\250\233\235\2663\344Y\2233\276,8\353\"\372\310\317\255\006\335\026\316\327F\222\264i\022\2063\326^(\026\254\2524\234\257\273J?qn2p\276&\362\3777\002;\"Vp\326\\\032\006\007k6\370\315\331Rg\t\316\277\036r\315\205k"
+	.string	"\321\262\2033z\267t=\004?\361\002\007\207\36390\323\277\336\322[X/[\330{\252\317\271\246\353L\027\234\317A\022\273\243{P>(\337EC\355\364\217%\252=\305\204\003)tB 3\256\340\354\0039U\007\007\r\316\347"
+	.string	"\210\376\305\322\007\375\243\205\016\332gG\245_\334\271$\r\240\262&\271Q?\034\250\254N`\231\223\304\241c\350\033wN\313hW\255\355%5\016=\025G\207\326\322=\364\016\235\245sh\036\027M\343\3200\216\362A\371\2524\016-%'\2717\262\b\317\225.=\2142\332\347u8PY\235\320r\227\32464\326E\3237\236\204\334\017\241oh+}\325e"
+	.string	"\271\2536B6x\030\302s\023\007\310\231\177}\245k\204A\"\311\303Y\323\320\352\001\367\002\347\177\340\323\277\226q\321\364\f\255'\326\306W\347\377/\310\314\227\327\236\376\007<\375\017o\264\256\322o\222A\344p\376\2075\372\037\340\364?\220\321\377\300\246\377\241\213\376\207-\372G\377\240~\316\322\340\221\363C\247\246\006\025\316\377\240Ec\344E:;\334\243\023\325C\365\240{\377\257hL\314\02108\377\003\025}4\317\377_\t_k\300\340\234\357\337N4\357(\236\377\207\341\236\200]\341\374\017P\364\321;(\336\377#\212\343$\255\f\347\177P\242\217&\301\364\341\361\2013jG\303\370"
+	.string	"d\003\240 kC\200\3249j\347G\357\256[\211\265B\237\037=8\017\335\243\023\245\263t\264N\220\\\231$\031\316B\367\350\374\007)9r\352\200\341\325\325\241di`p\336\274A\321>\220\243\f\035\035\252v\002\271\245R\310a'&\006\206\r\033\224l\214l\315\032$?\300\324\250A\341\372\300\210\244I\203\302\235@n)\r\230\331\211\211}"
+	.string	"\357\310\023\234\357a\307\2313\250\232\221\033\036f\224)\203\222\235@n)\006\320\331\211\211y\230jC\333P2\035\220;G\br\350\370`\0161\305\300xA\006\035s\324\r\343\271UVV{8/-\035\035s\311\370\312\314\340\374\001\340\261\261\241jF\306\352\274\\4\324\013\252f\344\2139\004\370\025\267\005g4\314_\366@\3230\036371>pF\277,\035\005\023'\253m\007\316\346=:\3175f\250\031\212vg\016\301doav\316\216r\301xt\222\017\233$\316\036,\035=;\305\310\020\331\203\363\007\320VV\2266"
+	.string	"4,\027\r\305\202\222\2350\332\333K\016\254\344b\004I\030\252\345/\303\320,h\0214uk8\347+U.\032Z\005\035\313\301\301\025*\035\037\314!i\342\300\220\202Z\371/\022\025\303x\360\251%\006\212\034\316\345\276H\347\007\300$,\354\254;\341G\212P\0237N\330p\376"
+	.ascii	"\2704\n\005\205\202J\321C\367H\331\352@4\306\013\233$h\224\243"
+	.ascii	"RP\264\036iV\003\240\341\304\t\372\004s\221iI\266\355\331{bV"
+	.ascii	"\311\"DG\236?L\230\240/.\354\2757\030\032Gf%\031\306\207\226"
+	.ascii	"X\235$I\320/T\317\314NL\314\307\035\032\r\234\321/\314\227\347"
+	.ascii	"K\030\316\327\313;"
+	.string	"\332\256\250\301\371\035\324\216\034\261\243\006S\361\242\227\205\363;l)R\304\016\031XZ\234\236)\234\337\201\212F\273\320\256\263L_\275<;1\2613\310\024Z\207 A\202\240\\k\274\354\304\3662\033\024>\"\350\220\243\\w\232kKo\017\316\250\220\277i;T\256\276t\300\322\277V.\352\343\242\241>P \t\350\313\333\372P\216)\031\223\007\375Q\204\303\311\035\226$\241\032@\326\336p~\007\031\372G{\240=\262@\220B\207\312H\242\305\007\235\035;\3162\275\257\200m-\255\016\271\312L\r\315L\216\034u\266\300\212\242$y\323\202\3637@\336\270\201f\351\275!\013\335\220\327V\325\036\234\177\024\353h\326\331\007)\344\252\312\377\037\321\037?W^p\376\006T\364\217^\241W'\214\023\\;\207\005R\274\276\344\360\033\270/up\376\006Dh\3208\313\264\324\336RF\233\312.\r\314|S'N\027\316\337"
+	.string	"K\206\214\263\354\202a\222\334ZZ\035N\2563zap\276\006}\032\215\201\306\220R\262\3011\304\007\316\327\340\016\255B\253\320\027?\005\310\241\223,r\223q#\n\372\342lZK\260p\276\006jP)T\n\235\372\t"
+	.string	"H\236\351fn,\b:u\325\202\344d\211e\301\371\032\260\351\377\354\373E;\373r\035\263jO%9\345j\344\345\331\2432\306G\027\316\327`\212\376O?\027\355\364s\361:pMMeP%\217\217\226\366:#\344\005\316\327\240\b\037\337\b)<\364O=\367\334\263\307L\003\253<y\316v\202\353E\231\001\310\246\262\022; q|\360\340\311u\245\025\327\224\227\b(Q\354\306P=Tw;p\276"
+	.string	"\346\364\177\342\341\231\t@M\377g\362\242\235\311\314\345\004\327\306a\200,[\306~h\370"
+	.ascii	"Y\203\363\005\300\345\356.\207-U\355\"YN\0365\354\242x\210!d"
+	.ascii	"\013\316\027@"
+	.string	"\2179'\2359g\215\323\316\016K\017:\304\254\310\356K\036.\234/"
+	.string	"\033\372\031\374ys\306ys\326i\260\367Er\335\300\332ZX\035\340\3009\353NH\355-\205\3347\220\206\344\320\352@\264\204.O\037\316uq?(R\274j\340\374\f\352\350g\360FGgV\311\310\235U"
+	.string	"\2523\037\202\322\216\310\265\341\374\f\316\314\2309\331X\260\367\206\261\243\360TQ\223\204\373\311\346\347\334\235\242#g\003\347\237r\347\232\377g\342\271\231\031\203\3633\310\242\317\270S\315\377\337\257\213\2254n8\037gPe\003\025ff~\340\374\203\3611q\202\363\231\346k\377\177@j\300\314\340\201\363\365N4\377\177GT\252X\235h\3163?\244\304\331\311+\245\212\320\200\303\371\031\034\321W\272'\231\267\277qY\211Kf"
+	.string	"C?"
+	.string	"nt\233\230s\214i\345n\034\373\312\230b\005."
+	.string	"m\372\001\300\022&\314\311\206\002\311\261\366\223\215\314\033\223%8\237j\346Z\226\233\031\316\327\373\335\2605+_p~"
+	.string	"\222\350\377\374r~\301{?+\223\316Irci} A\207\233\024\316\017\200\017\375\233G\314#W\255\003\364\013\325\327\317.\027\355\354\202\365~V{\343\020Q%\207\235\330^"
+	.string	"j\230\231\235\\\312\275\273\264\022"
+	.ascii	"\305\013\310J\312\034\336y\226dj9c\363\004\347c\360G\037\003"
+	.ascii	";$\362,\273\321\336\233jo!AN49\256\367\263\314l3\305\311\027"
+	.ascii	"\234\217A\027\375\363\312=\263h9[\003d\354}\346\353\314\242\202"
+	.ascii	"\242\217\201\217M+\023\261Xb}ZI\270\300\004\244\215\305\026\005"
+	.ascii	"\266\330\026\211Z`\332\016U\023\352\323\332\006\031\237\202\277"
+	.ascii	";)\035\235\332\364\211\270\246\354\257%\256\345q8$A\324\246\305"
+	.ascii	"!\223i\024t'%\365im\315\341\220\204\332\256,\005V\"\212\013G"
+	.ascii	"Ve\261\262\302v%\242`2\222pD\242UG\020\256\306\t\210\204\253"
+	.ascii	"\321\002\022\302\325\210\201\260\370\304\256\251\221Pm\203j\253"
+	.ascii	"\232 \256F\024Z\244\026(\262.\232\216\216+\222\n\027C\243\221"
+	.ascii	"\204p5Np'\245\026H\301\235\224@PpD\2412\245\307\341\2322\031"
+	.ascii	"1\265\304\225\035\236wR*\262.\232\212\254\213\021\214\236XU\205"
+	.ascii	"\t\013\307\025$.\f\231T\023\301\023Z\265\251h\230\006\235\332"
+	.ascii	"\364\t\304\261]W\200\200\"6\021 \n\212\270\016\t \342\003\340"
+	.string	"\007 D\201P\205P\303 q\005\301\036\241@\200hQd\235\332\"\021eJ\325an\217\304b\320djY\017\034\315;)\201\020\252\303\025)1\204#\n\225\205jS\225\311\350NJ\307\020&\200BE\t\022\300\020LD \005\260\304\t@\024PX\270\223\222\312\026\203H\352q\225\340NJ'\034W\243'VmQ\bW\343\320\004\206C\265DS\212B\2536%\2710\026K\030\001\237\266\251\260U\217D@\265M\207\306'U\305\004.\214\305\022\022\264wRj2\202h2\006\211P\"4\031\203\210L\330<\002\233\214B-\220\330d4\211M\306\322\251m\"\252\303S]a=\346\343Qe\205\302\024ua,\0063\333\032K\241JlZ\207)*T\217P\371\210\236\0056\031\225\206\\\260\355qmRO\330 \"\204\007K\025\020\246P\022 1L\241L\024\235\030\256i;\001\"\023\332t(B\261\rF"
+	.string	"\204\n\024\333`\004\202* \302XdMP\207M\304\025\205\"\023>\210RO|`\001\324\001C\0250A\230BI"
+	.string	"\210h\rj\"\256\024\020\252Q\253\bG\024\030R\264j\223\320\b\255\212\002"
+	.string	"\216\306b{\004jW\266E\320Q5\221\024\265\246\020\246E\022\204\216\247\213\224eI\024\333#T\220\203\312Ba A\230\026\207\031\332\225\210\342\207\241]\211\301c\b\355J\\\215X\2655\026\203+\253\342\210\302\310(E\2536\rE\261i\233\232\b\262\247*,\246(\032j\217\305\242\003\206Jl`\325\250\365B\332\246&\204\253\021\005\321\2642\021M\260\240\325\341\212TE\324\372Td\324\201R\313\246F\245&\342J$B\235\240\262\251\006UXLat<\252\301`zj"
+	.string	"\004\ft\260\0013jMa\004\200\016\224\324\025\326\226\230BI@x\301\205%\245c\n)\264\307t\210\341X\202\311H\002\321\205\t\265M\205F\250#\241\nd\325\250U\250\275p,\252P\205\305\024N\307\224-\301\252-\023\tVe\021\001\343:\024\301\305\320hL\003\200\344\201\022\n\r\031\314;)5A\255P\205 \204\303\025j\205*,\246\370\251E\025\303!\224\bm\272\202\205\026\241DS\212\002\261\270\266A\225e\213%4\020\205PR1L\215\210M+\nQk\212\013k\n\242\250t\210\270\246P\233\210\351\t%\202\354\257E\272 B\351\bU\\Y\250\254\tA\026C[t'\245 P}Z[\"\024\013\"\b\200cS:\024\241\211\270>\261i\320QH\f\201-\266\305\022B\"\211!Tp\230\006\007\360\340\312\252D\265I_\304\007\004\370"
+	.ascii	"\204(\364 \034\240\203\003tp\036\204\003,-\035\340\203%\375\017"
+	.ascii	"\226\312\266\005\036S\264(\222p\301\251i=!\f\221\342\211M\217"
+	.ascii	"\253\320\202S\323z\242\350\301\026E\022\"\320\252\303\242\tD"
+	.ascii	"\307\241\366NJ \232\214\031X\365iU!T3\260PM\250mz\202\220\021"
+	.ascii	"\261\270\036Y\225\005\021\305S\013\023,<\2650A\250\006\211.\216"
+	.ascii	"\304\024\324#\024Q{d\241\034\240\036\241\206\\\260\255\372\244"
+	.ascii	"\016U\025\026\216\347\260\030,\266E\326\204\226-\03234\021\323"
+	.ascii	"\025\355\352\200\266\350t4\241\036\241\212X\250\302R\205\032"
+	.ascii	"\246\023\210\200:\024\242\030\246\355\332\264\n3\020\327\247"
+	.ascii	"\240\250\364)HHL\237\236\212A\342\372\004\364\244\266G\027(\334"
+	.ascii	"I\t\004\261\370\364T\fN\240\302=\002EXj\215Aj\233\266G\223\311"
+	.ascii	"HB\220\n\024\242\210*\256@[\3401\005\365im\265\n\fj\315#\020"
+	.ascii	"\005*\262`U\024\324#"
+	.string	"\224\276\223\022\210#[<\022\325#\005Q)q}\272\320\"CKT\217*kl\213\3046]\301bC\220\305pH\005^P\201\030\324 \013UD\201U[5EKTY\026*x\301E\273\006Sc\272\242\250M\0350\001\365\b5tlYuH\242\204z\204\302\2406\245\304\342\332\032\237\240\216\304b\220\303q=\252\254\332\036]8\265\351\n\026DjS\332\016\213,\206C58\034B1\265\351\n\026G-\021\252Xb8TK\270`\325\266M\035\240\006\331\"\023\222\213th<\256\030\332t\305:\324D\\\211lJ\201\f\3034\270\266+[\202-\212\300B\231h\323\025,4\230\300d$\241)E\241MW\2600j\357\244\004\"\230\201\332\246'\034\201 \\S\260N-\nB\321\030\025\002\353\324\352\343Qm\323\023\202,Z4F\205\020d\317\243\332\246\254i\002\205\t\254\223\n\242\013\341O\205TeW"
+	.string	"Sc\233\001H\025\026S\244\306\026m\237\240P(\217\300\264MM\034\327(\022\302\3258t\004\232 \\\215B+8\001[\244.\210Vp\002\032\255\340\344\024l\213\304\366NJ\302\325\230$\302=\002\231\204\253\3614\341\242\270&\256p5\226-q-\232`\204\022\022W\nh\bj\221Z"
+	.ascii	"\n\005\341j$\"\256)Z\022\302\325h\324\006U&\246\243\226U\215"
+	.ascii	"Q*\260\035\256-\220X\\ae\213NI"
+	.string	"\252\260\230\302E\273\262H\331\021\326\226\230\026e \256\351\bl\261MY\025\303\t-R\027\026\206j0HBmS\226H\330d\264\026\215\255zLR\237\326\026\310E:T\205A\030\216\210\305\265U!d\323\026lQ\004\241\2522!\265H]"
+	.string	"\213\200Vp\002zp<\246\306\026\305\241\005\027\254\312\242\030TY \021R[$R\215.Z\2435\250\211\230&i \256i\223\205\343\023P\230\252N\251\n\305\342\020\310\252\3045e[`\221\r\246\033\210k\332ddA\303qEz\301\003Vm\207+\323\205\025\234\200\304u\005\247'Vm\205\030Ta1\205\005\023Tph\327\247\225\004\r\3045\035\341\004VmjZY\025-\212\303!\211\022NA\"T:\254"
+	.string	"\250\036\241.D\245C\225\005\266H]"
+	.string	"\205j\233\262MjK\\1\254\260\262\251J\\Ih\217P\254S{d\022\327\264\tH\r\022S\026\302T8\324B\031[\250\"\360BK\204*\006\201\303\241\032\004jh\211\352z$\246l\233\324\036\213\305\025@&&\315\246N\301\254>\245%\250\303\225\251\310\032\203\236\214,\220\270>\t\tU\325x\004\266D\365\251=Bu@\230\"\235\302\325H\244\036S\225\r\022Wu(\\-\030\217@umS\226\211\311\002PUa5\036\201LLDLLF*\013\026*Ht!\274\240\006S\0268TY\250\303\242#Q5>\025\203\300\246\364\bl\323\025,\220\332\026\251\213\362\bd\325\2505\205\220\036\016\213lv\n\266\253\321\274\223\004C\252\260\230\3427,\026\035"
+	.string	"4\205\352\221UY\250,\360\330\"uq\324\022\325 \253\032\201l\261->i(\032\243T\240q\03529\035S6H\204\336I\3518,\262-\261\030\004\006Y\020A&\016&B\030\265(\016\211\234\232V\247\"a\210a\312\266P*\361\247\016\333\266\310:\265@a\b!1]!LU\341Q\213\3420\310\251iu\002\nC\264\353\323:\024\022\206P\205\305'\240Pu\n\266k\213c\321\235\224\242X\020M\306\243\027\215*\013\242-\026Y\020AG`\323\312D,\226\210b\201\214\351S\2205YU\270\262(\262F\241\032\305\016\323\225U\217\026\242\324\241\021\312\004\3230u\002\"\256\026\264@\264)UQ\\\201MPCc\222\205V=\252\254\220\270\256"
+	.ascii	"\266\351\021\370\004\305\266*\250\306\343\004B\3520\r\002\265"
+	.ascii	"\254\312\202\270\006Y\341\372d\022\327'\255BPu\nF\245O\272\350"
+	.ascii	"Xb\230\262 \026\3276\035\026\215\254\332\022Q\004Y\rGUe\233T"
+	.ascii	"\023\352\260\211H\342)-\301\302\310tA8,:\035U\326I\205\332\246"
+	.ascii	",\3266HB\025\026S\260k\232D\\[\340\007KA\365\b\005\214J\237\200"
+	.ascii	"QlP\024T\n\214J\237\212\216l\221eU\244\263U\217LL\305 \325\350"
+	.ascii	"\242\265\260\201\211\251\330B\005+8\256Q)\260\tj\205*l\241\214"
+	.ascii	"\304U\203jt\321\002U\026k\233\262XYU\310\201-\266\301\224\tX"
+	.ascii	"l\241R`\023quj\213\305\247#0\310&\t\213+\253\032\201L\306!P}"
+	.ascii	"JY&`\220=\002\327\343\221\335 \\\201\355J\204\032\362`\030\305"
+	.ascii	"\036\213\332c\312\004\024B\245+\200G\250\025G\242\026\bBK\\\241"
+	.ascii	"P\226x\004F\261@\365\b\005d:\262\301\242\026\350A\210\226\270"
+	.ascii	"B\351/-\225\260 \205\022F\320A%V\215Z\237@\264NM\353\220\t\004"
+	.ascii	"qM\237@\004\331"
+	.string	"#\b\245\r*\034\323'\340q\250\022\211\251S\020\250\nW\226UY\024\201\306\343\223\004\377\177x'\033]\005\017\256\356N\237<\203\315\213\236\244\336S\024\206\310\2157vN\2669y\2540\271\373\325qB'\013\026\321\0311kp\256\253\373\331\t\351 \354\216\027\226\335o\216\320\336\247\036,gL\346\374\344d`\fF\2358\347\331\357\211Y\232\030q\360\232\\\345\212\006\032\316\037\361\343\315\033\275\366\213%\004\335\3415\"\306\2325?\272&A`m\376\243c\323T\314\352\264\341\374cs\2662#mmp\376\315\025\255\225\305Y\"\242\017\0324?5[\"\244`\341\311\251\371\305aa\002\004H\034\334Y\245\n\033\2724gV\322\026)B\322\340+!\2568x\362~f~f\316\262\033M\371\310!\302\215\376\177ej\374\301\343\322\366v\246\210\026_Z\\9\245\213\230\233f\203\242\355\255\341\b\023\346\327\226G"
+	.string	",6\326\376k\373\211\231\203\344-\r\233\031\275!bp\276\b-\372W\266\371\323D\217\210)hh\277/K\200\372\330h\203\227\366\337\2277\030t\360\264\301\371\347\345o|idnp\376uA\341\344\274\206\210\270\241\221x\344<Q\362;\323ki}w\350\340LtRa\022\243m\213\036\243\357\204@qS\026\246A\214\032b\220\246\225\240\270-}\312\220\3358g\0246{9\264\234?P\244\225\263%Y4\331\320\235\261<L\260\\\274\263\307\013>0Wp\234c|\370x1\246\317\342p\031\251\201\363\217\312\257\312E\373\333OL\256\016N\034\234/\202\206\216\332{\357\277\235\001\210\374\250\324\303\023U\206S\252$\b\022%\307I\006\221\021\033\"\016"
+	.string	"\263\025"
+	.string	"0h@ \221\t\323.\366\024"
+	.string	"\r]\274\252xN\033\rZ\320!\305\b"
+	.string	"@"
+	.ascii	"0@\030\002\"\004\001\276e\241\004\316(\b\023\271\260\222\202"
+	.ascii	"\260\250c\001\232e\250TN\313\221\006P\257\317\333+\024\031\\"
+	.ascii	"\033\224\234]\005\334=7\355a\243\025\217\365\265\210Q\311cx\344"
+	.ascii	"Il\347ll\325\376\323\275\265_D\212\370R\276fy\334>J\323\206\230"
+	.ascii	"\264H\277\316`\201E\031\004\031\363+q\310\323%`\304x\332kM?X"
+	.ascii	"\332u\235D\320\347\202\303\364Sb\"\244\375mP\233\247\373\031"
+	.ascii	"i\021\355a\002\370\340\264-\256\246\261"
+	.string	"\331\016FT('f\n\326\207>\251\333\267\346>\013a4\007\376\314\231G\241\224\007\366u\006\036\271Zm\244\023\221\306'-\335S5Efgm\231fC.5K\272\322\343W7>{\326\312L\023\034\312Y,Uh\352\036e\374\037m\227\211=\210,\025f)\367\377g\350\354\355\034\341\350\276\017\363\\E\263\025\232\2610\035\0245gj\273z\243\255\020\201\264c\304~bq\030l\330\214\331jd\205\237\220\227\272\335\205\317?|\021`\237\017\375\272f\245?6\332\200\201\331\350~\276\3647\003}\337\230\363AP\311T\034{XU\301\320\025\215\252\006\021;H\3120\022\022\364\230\\\034\030\364\260\227\035^-\342\352\252\244\245\331s\203\025\00354\356\004\212.U\256\331'\240\352\263\003\240E\034\244\3175\034\025,7\326\332Q\216\352\024\003\2132\251\254\370H&\311&\203l\371^HX\267M\n\"\001\335\227"
+	.ascii	"Z\335\307\035\314\237G\304>`ez\235\033L\242cvt\242\214\240\317"
+	.ascii	"\262m\t\240[V\032Z7\325l\334[\351\023\026)W/\031\375\205?\336"
+	.ascii	"\030\033\3461Aa(o\234\206\357\274\002\364t\221\00186\333U\267"
+	.ascii	"v`\205\305A\001\221\364\fI\227\343\037\302\0252\226\313)\350"
+	.ascii	"\303d+\216\353\210\300\246\tA\023\302A\363n\250!\003\034F\251"
+	.ascii	"sY\361o\374\316t\276,\3561\342\210G\325\350P\013\346\251S\336"
+	.ascii	"\264\207\216\236-\205p\344\366\311\017,r\"\213Y\226[i\223QTK"
+	.ascii	"?\035r\314\335\346%\354iPT"
+	.ascii	"\217\372\371\021\240t\002\r\222\323\305\235\305\274@\024\270"
+	.ascii	"\277\330\351\230\344!\3673\201\0237`p\"\271p\273]\231f\0208\206"
+	.ascii	"\370\021i\241\276\204\321\306\305$;\245\n\267\350;\035\263(\372"
+	.ascii	"T\217\037\2467\375l\232d\210\261\372i@D\314\033m\274#n\263b]"
+	.ascii	"0\337\346\251A\247\333\365\004F9?&\002\310 \213cc`Q\277\3164"
+	.ascii	"f\204\264\311M\311\021Z\272\\1J\326\314\334j\336\257+\240 \006"
+	.ascii	"\230\0205R!\367t<\213\007\240$\333~"
+	.string	"'\275\324(%\302\246\034\371\256\f\261N\025\236JBZ\233\221n\212#S?c\306\201\200\324n\221\316\002J\021\253\303\023\262\355\247\274\317\2412QK\320\254\200\310\031\350hS|\005kEA)\022\312J\3776\036O\372i\205\026\357\030\326Mp\254\304d+\031\252m*\347\177\"\266\307H\235e\330?\360>y\232'j,C\250%\261^l\246^F\350\312\025\240TF\277\202\312\361\314\343\302\177h\371\334\204I_\335*p[\211\377S^@`\325B\202\3517\315\223{B\230\211\347|(\334\3368\247\354'\331\323\024\326}!\217_P\364\370\256\351cd\263W1\315\253\261\304\334\327\251\242\013\016\261\364\371L)5\020\373/WI\336s\257\246<-\315H\004\004\242\363\3269\001\\i\214\272\207\211\235\253\013\rQ\344Rt\242\314X%29\263\fh\0309n;\263\340\\\213\204\343\2514\332\355~[\006"
+	.string	"'\347\365\373\326i.\271\025\036\220\302\241\356#%\354\247\016\353"
+	.ascii	"7\211\276'^\376\b|\2531E\252\3779\357r\217.\221\354S\246\314"
+	.ascii	"\"\325-1\340>\247@\235\326\330\317\275\037\227\0162\271iF\320"
+	.ascii	"\3418F\343\036[\2432S\006\n\\\037\303\247\344~\324\252`P\246"
+	.ascii	"=M\246\2714\030\302\315\220h\232\002eO\362\252\312\256vGN\270"
+	.ascii	"\235\226V\006\341iC\272\230e\372Kp\356Ec\250\321\025\333\322"
+	.ascii	"0\n\351g\357\360nv\370\332\331\tcK\232\216\264\001\210\307\302"
+	.ascii	"\003\2712\276\001\035\307\313\nR@>\2516\274\365\254\313}\\\310"
+	.ascii	"2\006Pg\030\005\201Q&\353\313E\230\217\321S\316\023z\220Y\256"
+	.ascii	"'e\322K0\251tA\017Z8V\233\262"
+	.string	"\007\240e<y\004\345\022T\2437\220\036\036\273\003\247I:\364\233O\270\302\023\273\260\240\343E\304\2750O\3528}\276s\377\262\370\177\3274\332o\026\242\223x\354\2743G_$R\022LM\222\350\221\377K+\326\007(\003\321\022U\352\024\332\324_M\327+\266\240\021TG/\377\r\362+o\237z7\262\341\256g\321M\331\305n\334\362h\250\035%>\226\020v\223o%]\225\302\213L{C\347\321\311\370\323i5n\223^,\206\223\2202I\241\322\316\263O\267\264i\245\026\370\347\003\020\322Q\325\232\242\213\313\311S\212w\"\377]K\207N{\351/\354?j`C\270\365\023\036jl\333\300\217\351\352\207\311\213\n\276\224nk\204*\207b&\354\372W\351\352\226\355w\310\3436\2167[\322\035\343?\250\034-\226%\246\211\200\266Y\257#\274\273@\006&\231\355\322\217s$X\2665\365\210V\032\272\024\301\275"
+	.string	"\267\311\277]\365\254\355\374\001'\300B\021Y@7\342\037\2169\261\004\231U\367P\001\273E\357F\210\241\227\303\237\204\033\016\252\025K\361\263\336\017\307\224\t\363\345\n\006\333\b\256\246\017\346r\333\335\330N\021\3765\255=\016\320w3\341\034\232\255\276e\035\361\037\277\374\313\r\223(\256`\302hB\022\3566\352\315\344,\007\223\330\251\204(\326\234i\264+\212\353\272\331\260\275\"\304\n\226\370D\260AP\214\376S\n\221\345\242\"Ut\033\201Tr\350"
+	.string	"\243\221\270#\342Hr\226\232$\223\305\312\003N]\202\226\230ic\301\244\203c\330\005\2035\247;\362}=-"
+	.ascii	"\211\030$\006>h\325\334\025\263\337=\332qs(\201\366S\272\256"
+	.ascii	"\261h\261\277Z<h\035\017\315J"
+	.string	"A\263N\256W\030.|\2466\331o\255,\253\344g\330k\037\370Ni\3239O\300\371-\005\202\3661\024\327\034\177\353\325\232\214\235\030\017Y\007\226o\220UR\320\374N\332\250.\025\365X\330,\370w\346LB\3527\302UZ\315\371\276\372I\004\030\r\236\221\344n\007\364\262\255\300\354\300\266:K\005\305\344\344\350\035\031\264l\263#\230qtv\232(e\203R\340\355\030\bq\0077\ba\020[B\344h<C\261\324k\025\016P\272(\202\305\365Z\246\016M\2505t\316\337Y\332vW\236\270\217M'\t\262k6<\257\206\242\240\027\251'\350\"\304v\233a\227\335q\211!\320\3305\372#\237mlL\207m\202\202\002\006\322\230\275\204\237\365&\275\f\375\244Q\334\236\316\340\356\272\005\\\2251\002\216#\003&\337\270VF\223b\027L^\351<'\013\026g\023\314\225\361]z\232\3616\354\260\271^\201\034r\003"
+	.ascii	"\360\306"
+	.string	"K\231\216\216\203c\244\177mT\333=\317TZW\221\220O\372JA\314\377E\017=7\034\276\313F\331iv\254\227\235\352\310\233\nH\205\265\3003\2017WY\002\236\303\244\332\225\001\2516d\003\204\215\3726\306\201\350\225\030\002\"\302,\367=TC\347}\242\022|K\024i{X\3209W\354\023\321\236\3127\222\001'J\002\221n\nLe$+\001ekG>cK\326\020*\367u\253FT\303\330\341o\3252\264\245\337\214\020\336\260@\004\372\240\334p\310\031\t\202Q\305\036R6n\026\335|\347*\007\316\326C\260\3645(\2209\347Z\013\raH\264\357Z\270_<\034{\276\262\314\2420\341\312\323Yk\203\203H#\362\3167\232V0\320\251\211\004\200i#\330\230\216\037\002\020E\254,\rU\23225\220\252\311,.\335\224\317\273\305\215\356\2740;\016\324\001f\344\254>8\0310@\246\266nrD$"
+	.string	"E\002\356\2251xr\211\020\353AF\374\315\r_\272\353\210\232\224A\212\241'\333\004\260\206\272\031\2275\0237asV\3520\006~mF\032\274s\214\216K0-\214"
+	.string	"\274\375M\244\224\f\204D\340y0\356\006\307`"
+	.string	"?\261"
+	.string	"\021\233`d\203\\#\234\220r\214\320a,\032\244,&E\247\332G=\"\356\020\377\005y\372>\t\276b\227O\206}\\\204\322\232\212/L\204\337\323\261Ni\016\321\376\254\230\347m\221\315%\022\263\361+\031\0374?I\344\317\362*s\007Gf.\347\033\004v d\341}"
+	.ascii	"K\260~\330x\255\317q\311o-T\253\020$\352\240\t\360\001\324o\201"
+	.ascii	"P\375W\205'\033\027\033c,\032\004\327O\212\301\311\036\353\037"
+	.ascii	"B\251NK\001\272Ej\023\\\311sP\017\020\237\266\211e\013n\317\375"
+	.ascii	"\272\361W\342\326WR\356\321\2701\254W\273\337t\372\003\225\373"
+	.ascii	";\376Z\231\254B3\304\323\271\006\331\270X\fs\260|O\025\362X3"
+	.ascii	"\025\221\253 \351(CjF'\247\257\204\351\232\333\217E|\347]a\002"
+	.ascii	"M\272-\371&!\\\327)w\315\313\020N\t]\312\330W\227\275\353\034"
+	.ascii	"\207OH\201\253\376L~\016x\342\236R=\337*\300\001U\250\315m\f"
+	.ascii	"\230\017JL\"R\030u\241\213\022U\215\301\254\f\317\332b\230Z\247"
+	.ascii	"\027C:\366\326\017\361\223DN\001\235<\rc\357\001[kL+\356\316"
+	.ascii	"%\204\242ixBv\354?\231\262\265\371\264A\350\366c\323\257\356"
+	.ascii	"\f\005j"
+	.ascii	"\245\270\311\333\222kZZJ%\002\261$\003\341\340\224e\231\233\320"
+	.ascii	"\302[JW\227]UP\207\213m\352J4)\"\237\271"
+	.string	"\303\301\261\347\352\nN\024\260\324\315\344\373\363G\365M\271\017\tU\307\232\003\217\204\026?\2750\366\016$\215I\322Q\301\234o\264\314\017\036\340\315\266\203\273h\332\375\360bQvxWM@\370\022\177\311y\021\311L\nAl\336\234\245j:\033\363\237\335\242\201V0\021\343\277\004\2579$4\213\206\260\352\330\220o\\\"=v\001_S\007\037^\343\376\266\200\024\001\245\305\021\211Z\355\265\303\324\226V\250! %\023Ag\316\266\f\f{\343Pq\203\357\345.Y0\357\367*\261\344\034f\310\013\354\026\204F\224\255\n\352\361!\251D\246\327\023\"+b\034\034%qw\253\355D\213b\"Y%\3448\314\330\257#\020$R\246,e?m\302\254\244\215\241e\243\316\226\t\261[\21646\2631\360\270/\213d\016\302K\365\n\0133\335l,\354\"\326\2008\2168n5\224\301#\232\016\005\205l\231M\032\026\260+"
+	.string	"\270\377\247\322 \277\255\304\314\031\361\265G\"[M\306\230q\035t\356\253\331\001\356\f\240D%h\353\203Q=H\212\367n\233\205\243\233\326\317\33023'6\231\211\303\303\302]\002\"p \313\325\304\327\3256l\312\251'\006\360\334\341\352\2125\230\320)\310G\325 9M\317|\323\314\031\020_'?\324\350Fc^\302"
+	.string	"\203\177\263\007^p\347%\267\242\031]\254\024\031\002\201z\206\347\201X\217:\274\222\247~'3\305$|\02498\360H\321\201\245S\303T\344\310\215D\235q,\2720Z\361\001\347\022\256\230\300\021\306C\240\342\250\220.\2176\177\330#\312;\245,\323\027I\223yS\tC\025@2\2316\350\225V\007\177Y\306\315\303\t\30700 \027\r)\211\204j5w\202\244\311\250\244d\222=\264\253L\3169\253\\\233\016\376\026\274Z"
+	.ascii	"\275\364k%\b\330\340Q\313m\212R\031a\310\207}\324\246n|\324\320"
+	.ascii	"\226\b\2535S\300\3232Ft\350\"Y\264\252\203\317\351\346\n.\257"
+	.ascii	"\007z\272\307\006\202o\364\202r\270\003\313(L\243\351\321\330"
+	.ascii	"\244\317\271(\364\313\0325\016q\005\376,=\303[\274\320\315\225"
+	.ascii	"\361\237\027\270\021pc\347>x\353=}[,\016@Sc!\213Q+_\353i\004"
+	.ascii	"\306\034\214G\016\200\367m\336;RT\032k\250\334\202,\327\351\266"
+	.ascii	"\262\304@\270L\275\353_\"\001\005i\r\272\355\013\255\353\333"
+	.ascii	"\202\246\"9\312\357|\bw\205\320[\345<\312g\313\263b\327:\306"
+	.ascii	"\305m\234\237\222O\277\211\215\320u\007\312\365T\217\254\305"
+	.ascii	"\306\367\223\021-r\203\303\263\345q\013\362\346\367a\367\376"
+	.ascii	"\264\377\026\206*\253O3\211\276\305\210\021;~p\266\0049\217\025"
+	.ascii	"qL\205\256\002x\032fW\177@\322 \277\205\314\374f\376i\310\202"
+	.ascii	"\255G\331|\257H\331\013+\271\370!\212:G\350\237\3620\355\322"
+	.ascii	"\025#\325\255\022\275"
+	.string	"6\331\314\353A=\032\314\365\320\313\f\250\"\007/O\371\333~\231`?\353s-L\355\371\313\321\024RSt\367\204ks\355\342^vV8X\343\361:\003\224\224\351R\006+\013p\362\031\022_O\310\207\275o\253gd;\266\306\262/Wm\311d\376\232bY\027\224\036F\271p\226\347\314\355\320\205\314\260\337\221\345\007\242\345\314\323\314C\031O\271\244\032\b\254\215\334\276\253\353R\375[P\240\nlKY\332\200`\320\307\037\017\025\371\246\375\356V\240\307|\375\250\247\312\337\375\275O\020\230\336\203P\221\316\307\322y\335\201\353Z\305\317\230[\241\261\365\355\233k\270\200J\276\231)\302\347\006B\215\243\365\244Z\016\032%CK\3744K\221b\305ui\223\361\\\"\246\356\320\177\350i{>\335\220Ya\026\200\3461(\"\307\226\333Bb\034\016\344\203\303R\303\351\335\267~\311\342\033\035\210\003\351\361\025*\376a\220/"
+	.string	";\2637\302\263\244\312SD-/\311dT\035\314\344\032^!\007\223v?s\022\267\236d\034\\\276k"
+	.string	"m\343\323\251d\006\005~\326C\254#\262\224\374\202\357{9q\224\243-\313\373M\331\035\261\345\026a\350w!\302\021l\305QT\371\242|\0033(\013\250A\214\020\316\025\216\225\2117\376\207\277\221\312\257\2077\021\t\306\314\377,\004\377+A\224\251\335-N\226A\253\376\020\2613V/O\276y\034\301\240\221o<5\006I\262=@\321\222T\265\310\240\254\3525\362\237\306\307\247\016X\357\237\362\370\223\036\364\252"
+	.string	"\210\370\204\306\3179$\217\220\336\237\365\243\322\202\375\372\177nl,\371\261\3106\235\255O\007\320\237\352\223<y$X\b7\276\325\303\036\026\210\360E\\\314H\214(\314\262\350\317\316\232\201\3248M\025\3524\031\335\304+\340"
+	.string	"\366\354\247\362\366\325\213jK!=O'\246\216c\003\312\305o\345j]e\252\302+d\326\354\275\322"
+	.string	"\323\376R2D"
+	.ascii	"\rx\013\033M>\254\256w\242\370\360Z\234\217b\314\261\254T}\225"
+	.ascii	"\335l2\361(\212w\b\337\2577\217\fH@\360\232\303/\020\001\250"
+	.ascii	"\216\275\0135\344\027\n\016\344\013\036\r\276\371+!\361\204L"
+	.ascii	"M\246t\265\220d\224\r\204\3273\331E\243%\034&h\353<\377\201\264"
+	.ascii	"\027C\036f\213\267\371\362=\371d{ \273]\373x>oW$\035yO\327\350"
+	.ascii	"\275\005\315J\356q\275=^~\262\023Y98g\343\013\033>\352\253\254"
+	.ascii	"e\327\347p\007\333h\352\213\033\204\335\300}\023\036\337p\372"
+	.ascii	"\373=\363\375\233\372\033K\304p\022\207\337j\337&\343I=\373\027"
+	.ascii	"\351\376q\336E\376`\334\207\307\256v"
+	.string	"\267\207\376\252\023\324\357\231\270\230]\333\361|\305\342>\025\317\336\371\323\307w\224\233\216c\016G\216\023H\331U\234\223Ps\003\364\251\246o2;%?\256J\317F\302Nq\355D1\2231\347\277\357\247\331;r\375\263\006y\370S\tG|>pZ\366\301yn^\017\261\364\277q\241\253\013 \256>O;ne\023\004\306?9\304D{\300\360\355\375\377\375\365\n\320n\312\330OY\256\367*\272a*\356\027hI\344\373\0226#\327/i\256\004JN\262h$\026\363\257\007y;\241\207\250\275G\333\365\270\3346Lw\361\343'\322`Zb6\313\373\364\371\r\371?\223\340\b(\376\220yU8\246{S\207\336\2764\n\020\213\300\204\237s3@\275d\306\037_\266^\357\007\373\035\215\316+\3661V'\323\354\001\017\360\377\002m\355J\353\343\224\325\337\234\362\311a\253~]\361\247\3513;X\247\236\317y\267\311"
+	.string	"\301^DM\250^gcC%\217\370\362\205\374o/\207\234\267\031q(d\237\001n\313\210\231\223\270\337\364\254\321\034\017\373\322\371k\334}\231\377\370q\226\216\361\376\324\n\356\351\341X\2533\t\\v\211\007\\\346?u9\340\317p\212\027\377\347\233\264a\244\247\371\371@\332|\265\367\233\235\303\232\316\314W2\276D\366\2173\247F~\211\2517\3765\200\340}\215\357\261\345\025v'au\325\307)\r\356\260\2156\2705\365"
+	.ascii	"\372\206\274\311\215\322\333M\364\246\336\271\2517zI\357q\223"
+	.ascii	"n\302\315\370M\257\361\350\327\377\3303\267J\031U\372\t\323\""
+	.ascii	"\327\2015O\377"
+	.text
+	.section	.gnu.lto_.symtab.14464f960a7f2757,"e",@progbits
+	.string	"motorOutputLow"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"motor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"loadLaunchControlMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"mixerGetThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"getMixerMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"mixerModeIsFixedWing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"customMotorMixer_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"getBatterySagCellVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\004"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\004"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\004"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\004"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\004"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"motorInitEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\004"
+	.string	""
+	.string	"motorWriteAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.14464f960a7f2757,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,359 @@
+	.file	"mixer_tricopter.c"
+	.section	.gnu.lto_.profile.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 ;\305\001"
+	.string	"\024\003/"
+	.string	"\007"
+	.string	"\257\260\217\231\002"
+	.string	"\001\354\301\314\336\005"
+	.string	"\002\274\205\242\255\006"
+	.string	"\003\355\314\246\334\007\004\270\226\216\246\b\005\240\342\234\212\n\006\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 \037\275"
+	.string	""
+	.string	"h\023"
+	.string	"\003"
+	.string	"\001\003\001\001\003\002"
+	.string	"\001"
+	.string	"\003"
+	.string	"*\201_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 \213U\002"
+	.string	"\024\003\177"
+	.string	"\003"
+	.string	""
+	.string	"\004\200\200\200\200\003d\003"
+	.string	"\001"
+	.string	"\001\002\003"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002d\002"
+	.string	"\002"
+	.string	"\002c"
+	.string	"\004\001"
+	.string	"\003d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\t"
+	.ascii	"G9\354\fnTT\313\224QT\f\2273>\315\343i\327\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001\001\003\177\002"
+	.string	"\001\001\001"
+	.string	""
+	.string	"\002\001\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 $\245"
+	.string	""
+	.string	"X\030"
+	.string	"\002"
+	.string	"\001@"
+	.string	"\001\001\002"
+	.string	"\003\020"
+	.ascii	"\204d\275a\001"
+	.text
+	.section	.gnu.lto_.lto.363d6e1f56918064,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tricopterMixerConfig_Registry.22.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 \250\355\004"
+	.string	"\364\bj"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\206\200\200\374\342\303\246\212\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\030us\326\007uq"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\220\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/flight/mixer_tricopter.c"
+	.string	"\004"
+	.string	")\242\302\254\230\242.\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_pgResetTemplate_tricopterMixerConfig.24.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_mixerTricopterIsServoSaturated.25.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\335\007"
+	.string	"\302\31775`o\032\003T"
+	.string	"\007\213\030m>\361\270\3575\032A\375T\001\020*?M\3106/n\242\332\017\035\310\266}\004\020\250\204\262\327\030\255\025\007B\f\204m{K\231R\031\347y\230\333\234Y\246Xgf\034h\303\264\311A\314\354B\373HnBB\243\210\220\025\232\347#\261i!;\b\335@\331\224\334\266M\331\357\266\036O\215\033Q\034\265*w\224"
+	.string	"\343\027\0358\302h\022j\004W\355\027\202\321\243\265\365\377\215\247B\247l[\003\032\232\226\177c\365r\225\313\004\244m\327\n\264\205\2605\312\"\235SU5\363\237\240\224\374O\350B\200\257\2155\030_\226\0130\276\332V\201\241\253g\220\021YRH$.\377'\343\207=C\257\366\2109+\253\222)d\b\340\360\277\260d\342p\243\333r\3326\264\r\t\t"
+	.ascii	"xD\331Y\214!\004\342\002T\3522.\243B\032\303\221C\304\3165\237"
+	.text
+	.section	.gnu.lto_mixerTricopterMotorCorrection.26.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"\202M14Po\322\030 \233\366\273\036\302\304'/_o\211*\206dKT\232\032u\223\301\330\213\275\227\205\230$\"\346\035\2429c\253\246\310[\355\217\030j\355&{\313\0242\316\210\275+\217\264\346'V\227\234\r\322\252\27008# .\211\0078q9`\260\222\024\320cp\374X\022\316\030%\244H\253nt\351o\035\216\205\273x\022\250\271\217\327iww7\372&\340R\300\262\2731#\263-/%\344\317\236jJ\262\312\001\273\036+(\273\213p\002\200\276\177\025\321\221\354K\f\030\224\306K\206I\314\356B\216\022h\364M:\240\321\347@4\323\226\255Z\242\235\023\230\220\b\244m\263\260\273\267\220\210Cw\372\037\374\n\177G\b"
+	.ascii	"2\003\3769\003.T\271\206\324!\222\250\300\002\2402v\332\371\004"
+	.text
+	.section	.gnu.lto_mixerTricopterInit.27.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 \305}\005"
+	.string	"\342\t&0pU\323\001"
+	.string	"\355\322\t\\\240`\234 W\210\345\370\3278\306=\217\232\233\273\255\351&\340\341\323\210\253*\013'\322~5`\370%!\262ho\231\002\257(jUlV\222V\b\2652\362\342Z\241H\313\204/2rqE1L5>1\213r\235\223\362\344\365\306n\241\211\233\337\323`\004\375;\350\356~\354~\210\030%"
+	.string	"\272=\005\004-@\b\020\375\337\351\331?\240\340\034\276N\351\353n\216\241\315\026f\337%\255a\343\264\205\205Gw\037n\334g\037\367?\343\277\343\277$\007"
+	.ascii	"3\003\316\231\001\340\313\3472\376e\334p9\026\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 \213\025\003"
+	.string	"D\005\207"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\031\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\032\177\003\033\177\004\005\030\005\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\026\006gistry"
+	.string	""
+	.string	"\005\023\007\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\024\b\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\345\334\006\240\035x\347Z\023\017"
+	.text
+	.section	.gnu.lto_.refs.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\004\002\005\002\006\002\003"
+	.text
+	.section	.gnu.lto_.decls.363d6e1f56918064,"e",@progbits
+	.string	"(\265/\375`\305\n]="
+	.ascii	"\212q\240\030D`\336Q:\363h>\340\254\354\251\005\2470?\\\365\312"
+	.ascii	"\025q\2039POh\215\264\236\317Mc[\276\204`\332Z\277\367\376\213"
+	.ascii	"\242(\322\206\r5\241\205*\031\335\204\252\311\257\\\261\006A"
+	.ascii	"\rm\200\024)\371[\246L\001h\001\213\001;n\360?\355\335\223\332"
+	.ascii	"6\206\375Y\253\250\035\207\334\364?\203\376\260\373\270\354\266"
+	.ascii	"\225KK9\236\316e7\231W?\223\364R?\235\335\310f\337c\267\275T"
+	.ascii	"j\244s\271\266\307>\311\266\251\\\352\366\250ld\323\310\355T"
+	.ascii	"&\317\216\306\245\344\323i\\J\266\316e#\333\310I$Y'\221\315\345"
+	.ascii	"RX\353T&\237\307\245R\362\351"
+	.string	"\\\202\231\315\221\363\224D\266\216.\346Q\251\004M\266\315~\353\346\263\255V6\350f6\225oG/.\243\005\325\241\225vlr\333\335\006\272\264\2204\033\tMZiv[\321\302\352\306`l\241\335\204\241\306$\314\346\332\352>\320mwW\267\221\033\332\335\306\356&R2\333n!JI\260\256\256\356\257\246\256f\032\327\266\272\357Y\2362\313\344\023I\263\267\006\346\t\3266Z#'\271\232\r\326oN\345\3724zi\256\356\346\271\025l\331\303\317M9H\017\262\377\273\237s\374\307\363\037\356\377\375\271\355g\247\237\237~f\360\263\202\237\017\374\234\340\347\005?;\220\360\363\1776\360s\023G\375W\372\357\210\237#\374\f\365\363\203\377q\377\323\376\243\375\377\362\037\305\377\022\377\213\376\267\375W\243\321h\364\177\330\177U\374\253\221\353\331I\345(;\251\277\355\372\333d\3458,\207\347\374EEg\270\334\230G\3263\024"
+	.string	"\2239Q\256\334\364\362\331T~s\206\363\027\021\211)\221h\314\365\334\306n\376\242\235!7gn\334\364\327\307zn\363\277\210\206\236#Yn\312l\326\255[\003\252(\017Y\334\223\233\236\331\374|\206\321\360\232\025\335\310\356.p\271\206|\361\271)\247a5\3475\314\2663\222\265\330\032\f\315\356#\257I*\324}Lb~b~J\265 \231\022FM\177{\275\034\017P\221\230Ie\265\336\331\314\317ex\215IU~\265}\326\335Iw\312Y[\333M\337\362"
+	.ascii	"ue&\365\210\231\324s\233\0301\234\006W'\267\272\275\001\032s"
+	.ascii	"\272s\332\367\314\261\"%\314\231\231\031\243\255J\255\265'\217"
+	.ascii	"\334\325\241\214#tvF\273\232Q\030.\32157=\335\331\322\037k[\336"
+	.ascii	"\334\364\354d=oa\2613\027\036c.\374\205\277\332HW\300\t\306l"
+	.ascii	"\256\256\277\230\020\222\356\334A\202q{\376\362[\310\300eF\335"
+	.ascii	"\txO6\264\346M\271\3542\031?\317e\354\345\0262\334\b\331b\335"
+	.ascii	"-\227\245\335G\346'$\346'\036[\224c\231\232\276\270\236\356j"
+	.ascii	"|\205L\2260]\376\202\254;\303A\254\207Z\177\265\217\312\356\346"
+	.ascii	"\301k[\251e\2442\217\031\302\177\304\001\f\375\342\240\345\255"
+	.ascii	"\310u\336#\327\310\035r"
+	.string	"\211\334&\217]\346U\236\tq!\344E^\346\265qs0\224I\0071<QMQI\177\266\230y)\245\034}\\\002\255\244\210.{\344\272\333\377\367\353\n\341\261\033\344Mm\367Y\220\313\343z1\364\253m\036\001\306\310\315\001\2132\020u\344\207\316\333\020\325\013\bRZ\273d\356\246\367\007\321\227W[\215B=x\354\372\330\263\322\205\255\021\212\013\240\306\t\022A\353ws\353wvt\254u\344\210\300\201\256\337\271Y\277c[o\362\336\3401\250\213\343\267\306\335:\357\330v{\237\030B+K[\317P\352.\032e(\365;\263U\211\007\250w\200\372\335\330\372\235\226\365\277\306\333\274g\233?pn3\236]\222\253\331.]\2677\\Z7\375\016\313\252\304L*\003fR/\204@,(IK\031%b\352J8\211#\346\246)\240\3336\005\254\213\016\351M\n\232\227?<1\321?An\312s\353\326\216\t\024"
+	.string	"\"d\214\360\334\317j\354GF\324P\240\233\376\215\007\250,\327;\367\t"
+	.string	"'\215\334\330M\215v8\326s\026f2g7\013\031x\214\311p\334\365\322\356\230\241\206CH]+\231\022\030\210\234'Cn\n\3276\035\335I\243\3026\267\346\3411\326\303t\270\375\205\277\247\207\3530\036$c\333;6\210\001\021\253\353n\233\242\246\234f\302\322\224\355\360\035\036s\342\2676\351\350P\226C\204\300\0041\206\302\017\006\262|l1\306\t\004\354\261(\374\206R\277!\223U\320\005\b\326W\f\020dqyE*#\226*\370\033\362\202\277\341\016\213\375\005}-T\226j\252\267\372d"
+	.ascii	"\213i\261\350#^]U\021\305\030\n\255R\";\334\375(\006\221-\002"
+	.ascii	"\177>\023N\354\261X*\rl\020\350\202(FV\226\213+^\221\212\300"
+	.ascii	"\225/\370\003\266\250\"\272\362\025]\244E\242W\261UWD\252\337"
+	.ascii	"\220\002\022\261\n\313*\375\001Y\004\205\037H\370\330\252\026"
+	.ascii	"\303,\037\n\326W\364\231\370\r\037\260\300\340\b\001A!\220\265"
+	.ascii	"\362\021\211\302\017D!+$\341\364\007\027\016}D)V($J\005h!\024"
+	.ascii	"z\240\342\275\327\373\300 E\211\020\253\025\005\226J\212\305"
+	.ascii	"\372\001[\260\220\n\002\253\262\244\254\210E)\n\016\256|l\025"
+	.ascii	"\321\005[uB\370\202\350;Q\034A\364\261C\241\025\220\210\202\350"
+	.ascii	"\203\001\314Rp+ \321\027\364\375\326c\230\2320\245\001\006\321"
+	.ascii	"5l\250\260\241\202z\r\033z\275\rS\275\365S\275\035\224\273D\215"
+	.ascii	"\343\305F\356>\341\2704,\254\317\3626iRG\312]\372q\023\362E\311"
+	.ascii	"\177\225\334%\254\324Zna\312\264\362K\202\312\305\215\027\237"
+	.ascii	"\233\302\251M6(pM\370\234\007\361\030\363\271I\232\274\264\306"
+	.ascii	"\244Ac\214v\2101\t\273)\222\026It\274c\207\315M\237\256q\364"
+	.ascii	"\032\273\300\035:\352\351\272;\260\304\341\265\277\247u[,\017"
+	.ascii	"\033b\336\345\r\302\320/\245F\222\251\223\333\372{\227y\271\030"
+	.ascii	"O\200\265\250q(\211\020DhFDDd$M\322\001`\002\t\306\230\225\007"
+	.ascii	"\022\200\370,\205\354$IA%\355w\337\241\"\035Lf\305\365\230g\365"
+	.ascii	"\266p>\005\034\f\221\340;\224\301\244\265\253\016n\324\026\230"
+	.ascii	"j\235\301\310\\n\037\036Z\301@"
+	.string	"\230\354\202;\032\274\223%\254S=|\321\252\351\177\266\002\022\021\266\275Q\327P\024\307\243\347f\210\324\240\316t\006\204\301?4s\2326fz\002\260\025\267Y\264\270R\370n\037!\353#;\006c\205\344\003{\r\013x1c\267\302\013\246\231\007\217\224\036?\326\b\2224\340@\\\267\021fLZX1\200f\2622\245\016\037=\240\242\031\3725\001GL\361 \212\200\324~+\\\320\261\304\033Vv|\201\2456\220mSKB\300\205\272\017o\354\343\331G\241\275\t\224\210\317T\346Fk\034\321\004\241\017\227\2532\313\031\020\026\"2\3122\252\004\003\343\202\267N'G\273\235\213~\216\325\333\233K\032\3707\2216\3326\"\274,C\225\264\033\036\007\031\020\357~\230\250\n\315\213\200V\367\247\306\001z\301\251\3706k\232\347j\244\205\237\330\363)\376\337\274\227\031\026\307\003.q\270\257x\211iS]\264 b|T\351"
+	.ascii	"\261\307\343\366\362\016\231\233\310L!\323iI\325\302\230IE\324"
+	.ascii	"\216R\22765\233\257\235\373N\035l<\016\037\357\341\261rP}G\340"
+	.ascii	"\030\355\312\273B\025"
+	.text
+	.section	.gnu.lto_.symtab.363d6e1f56918064,"e",@progbits
+	.string	"mixerTricopterIsServoSaturated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305"
+	.string	""
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_tricopterMixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"tricopterMixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"tricopterMixerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"tricopterMixerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.363d6e1f56918064,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3334 @@
+	.file	"pid.c"
+	.section	.gnu.lto_.profile.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001."
+	.text
+	.section	.gnu.lto_.icf.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`(\006M\031"
+	.string	"\344\033\034\007"
+	.string	"D"
+	.string	"\273\327\377\215\002"
+	.string	"\001\344\205\355\202\007\002\334\310\256\254\006(\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\003\002\004\005\005\006\007\002\b\002\004\002\b\002\b\002\t\002\n\005\240\342\234\212\n\007\n\242\326\250\275\017\020\b\004\013\212\237\327\345\017\036\002\013\f\013\007\007\002\f\f\r\303\234\377\336\003\016\002\b\002\r\005\002\004\016\274\363\230\354\f\004\017\311\252\327\230\0172\016\005\007\006\013\002\004\020\303\307\263\245\017.\f\t\002\n\021\256\344\261\210\017\036\b\t\002\n\022\365\310\260\323\f \004\013\024\313\375\364\317\r\002\025\322\235\217\211\017\026\263\320\313\235\t\027\222\214\352\306\002\t\002\n\030\373\222\213\212\004\n\031\236\277\257\375\004\006\013\002\004\032\302\217\355\313\001\032"
+	.string	"\016\002\016\033\034\035\036\314\256\230\325\016"
+	.string	"\037\243\314\220\310 \305\224\343\347\006\004!\300\262\372\333\f\002\"\267\324\213\246\007#\341\274\233\200\002$\333\363\265\270\016%\363\317\227\227\016&\300\267\367\255\006\002'\317\207\320\371\006(\207\240\340\257\003)\322\321\237\322*\333\314\346\311\005"
+	.string	"+\314\247\227\266\016,\264\240\272\224\001-\374\217\313\340\r.\256\375\316\250\005\252\002\002\017\002\017\002\b\002\020\013\002\013"
+	.string	"\013\006\013\007\002\021\002\007\002\022\004\b0\352\263\360\321\b123467\261\257\363\226\b8\321\235\211\3279\313\303\256\345\n\006\013\002\004:\323\376\246\366\006;\307\221\215|<\372\363\332/\005=\244\331\235\304\r>\365\355\227\351?\207\312\266\244@\320\374\270\356A\336\215\314\344\rB\347\270\326\303\016CDE\315\320\230\nF\271\357\324\266\005GHIJK\277\332\376\350\b"
+	.string	"\200\300\250\021\262`d\252\202&Y6\003`\002B4E\345\001\021\340<\207\254\242YP\220\024\206\315\350\237AF)\035\177p\276\300J\003\364WJ\205\354\n\271\326H\322\231\002&\017\037\237*\262\r\340\027\350\233\334\363\206\255\254_\246\341\224)("
+	.string	"{\322\323)<\374<U\217\017Gh\205^\327\206\222\332\311\332>\252\017\3540\n\346$4a\306\205\321\217f\200\023\313\351bnvd\026an\364;\027;sN\326\244\305\2209\272\304'\020\273\006\272\0259\205\217\334\210\232ast8\240jH\025\353\272`\031\204\016P\274P\337E\360T\357X\371\346\356oyU\362g\214\237z\303\004\030\222\254\241\370>\213\2517\272f\267e\314[\027\265I\267\354\225.\017+\203\260\276\307\301\310\007\036-/\355A\374\177`:\313\271\256\027\002\235QR\316\347\345\353{\311I\bH\370\205\226\367}\223cs\236X\240\t\215\177\017\373<k\254\002U\206\277\227\323\013.\322\361\276\207A\240\232\2751\342[\020G9\211\320\326\013\347\377\026L\255:?\b2<i\342\004\210\252\t\220B\0202\233\025\373s\220\215#"
+	.ascii	"\251\2337-\301^2W[\331\222\265g\337&\344\372\315\216Bi\235j\001"
+	.ascii	"\341b^\026\377\345\210\007_\335)v\2359\267@JT\350\222\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\002\002e\t"
+	.string	"\342\f%+`M\222\0160\f\3030\f\3030\f\003,@\020\004A0\227\022`i3l\340\245\004x\260\245D\364\241f\350\2505E\210\334)\005N\224y2M\266d$#SdC\036d~(\312|sJ\036\023s\321\252U\007\307F\251\032\2331\306^L\213Y1)\236\230\022\021"
+	.ascii	"\003\231w\243\343\020\373\203\3036\250\305\260PN\301G}\004-\364"
+	.ascii	"\237\262\"\225\265v\244#S=u:@\216\332\030h\245\241\0021\226J"
+	.ascii	"\250\tV\240,g\200\377\220\253\367\352^\254\225O\250\300\254h"
+	.ascii	"SJ\007\220\202\251\262\332\006\021\240\2353\220\311\324jv\003"
+	.ascii	"\330\320\361\364\332{\245\331@\243`L\255K\334U$\3642\t{G\022"
+	.ascii	";\"\027#\353\026\324\367\027\024K\265\213\005k\017~\216\274\334"
+	.ascii	" \246U\035x\206z\261\231\331Lv\375\177#HT97\372J\257\r<a\031"
+	.ascii	"R\225AR*+\330\213V\377\224\016d!u\326\201\351\300e\274\3243\037"
+	.ascii	"7ngX\302\223[\007\323\206+\361R=\202\312QI\300T\025L4\254\222"
+	.ascii	"\026\025\321\224\346\016X"
+	.text
+	.section	.gnu.lto_.inline.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\267\f\235."
+	.string	"\266\376\326Gp\230N:u~\237R\th3u\307\364\366\005\351}\300|\317\244s\001f\317\355\342:\251T**\217\236\344H\216\223\375\204\330\005\353R\350\034\253\034)I\331\377\227\206\251Y\327ob\273\302\001\342i\334M\032\331R\246\270"
+	.string	"\302"
+	.string	"\306"
+	.ascii	"\3121\005no\217-$\353m\013}z$\233D\377c_\351\325\335\241\350"
+	.ascii	"\323\377!\356i\247\323\221\305\3051xN\260\355\217}\376\274\261"
+	.ascii	"\326\367\371.r\265cK\257)\t\277\336R\037\240\231\373U\251\333"
+	.ascii	"\324\360\306\022\034\207\371\374V\252fA\224P$N\264\225\030)S"
+	.ascii	"(\f\203\\\231\310\345\301(\321\177U\252a@\306\224\025nC\304\344"
+	.ascii	"\37775\275\261\373\322\340\244vn_L\236I\340\237T\305X\361\302"
+	.ascii	"\305Y\347\377\236f\236\346\376\337\206\200\247\231\272\276\""
+	.ascii	"[\r\216\n\353\\\376\0231\353\3178g\277\217}\357\275\350\217l"
+	.ascii	"\346\275\327\246\177V\252n\367&o\376\241\343\374\b\227\341\370"
+	.ascii	"\320\332\202[w[I \340\374\367i\346\363\3472\026\266\323\227\220"
+	.ascii	"\260O3\261O"
+	.string	"7\361\317GX\330ML\257\221\362\025\305\305\335\016\200\210\331\347yTy\274P\341e\237\376\330RWJ\246\322\333\037u\021\034a\232<\246\213\031\254\340\217\254cW8h\260\262f\235}\301r\274\247V\350}\n\275O\243\216\242\273d\305~{{\242%x\233\336\032U1hi\230\347\333\276\255Q\223\021\222\246\253\026\253T\324\322G\317\323\027\353\n-\257\026\366O\352\030kj[J\330\374\025\375/l6\302\302~\352\277y\004*l\247>\233K\332\352\376v\235\337\317?\005\376?\213j3\317\005\r\376\371\363\330:\334\002\350O?\275\317H?\365*j\tv\356\330\352\333\013Z\303\013k\n\370\020\252\272)\363\272\202Z\f\214\035\021\002\367\271}&\374;\307\275\327\326\212\2747\3579\362\326\234'\025\272\220\211\276\222!\226<\337w=\274\300\316\242VZa\3555\\\324\022\314\236\bw\306\206\324_gx\310\211"
+	.string	"\236\303\346$<\354'\2473\036\266\323C\240\303~:\020\r\217+\313\323\276\223\363\373\377\346[\324)\340l8\341\363=_c\265b\343\263\3639\361\304\243\326Z\273Z~o\342\233XT\343\3144\367\370\351\323b\317HS\206\371\275\323wjT\317\366\346\336\370\366\336\330laM\366\354\030\"}s\366\347\275\261\"i\232M\331\367}\007'V\017];p\370\206\t7v@s_@s=_\223\252\3167\270i\310\360\337\246\357\343\306\\\225=\206f\261\325\247g\177\201-\360\016j\303\374\201\017(\352DL\340\317"
+	.string	",\237\237\363\37313\353\240\257P\342\312\312\330\177\251\305\354\250x\241tK5K\214\037\\g\327PB\0045\251 r\366CF\225\212Y\234\036Tm2%\217\f\017S\325 \253\3539\004.\302<\315\364\240\276\351\275\204\262D\023\274\203\033sUe5o\300 \251\253\252\216\f\261_"
+	.string	"\346\336\233\203\254W\220"
+	.string	"\301\001 F\352\337\r\034+\212\324gB\306>\326\002(\356\275\311?\251^\271\367\002\037\324\306\2573o\005U\031\211\034U\372\2648\034\310x\3764\037D\201\037\250\2015Bf\246F\013R\220dZ\003\221\004\204\031\305$\226|\022"
+	.string	"\0051\205\243\3128#5\"2\212\222\2022\2525\216\017\240s\035\026\311(\242#\002\321\231\2341\025\214\035\201\240\246\360\251\234\034\216\025\275\356\023\\\225h\006\007M!3\243\006r\364\316f\227u>\303A\325\302\235\372\3758\224\024\314\327zu8\330\\g+O4?$\227\260\273v\333\356E\222\343,p2\260\331W\325\321\263\334\215\247k\003R\221X\027!\255\246^K\365\264\013lM\354\352.G\225\273%\306)\357\244Hs\227\311\2462\201\227e\r\367\233\221M\202d\303\n\364z\024U\026\"X8\254\032i\251\002\224\273i\225\026&\370\241\030\210Ba\335\001"
+	.ascii	"\024\266\317\337n\240F\\d\203\246\2740\237\203\240\374+\212\276"
+	.ascii	"\277\340\231\246\374@[k\271Q5\\\312E\217\246\260s,\204u\323\025"
+	.ascii	"\004\260\351]lG\0376\374\334\021\306a(\f\2418\016\007\310\r+"
+	.ascii	"\270\016\244&[\303\276X\3364\f\300c\250i\fz\264)\016\314\004"
+	.ascii	"\244\026\013\2418\301\240,\300\367\324>f\356y\2701\016\376\300"
+	.ascii	"\200k5\364F\242\254\023\2760\3600\274&z7\234o`G\357\310\036\020"
+	.ascii	"C3\344\342\335\225+s#\266\342 \027\277\005\317\221\206J\n\331"
+	.ascii	"\355\362\312%Q\r\225\031\221Np\270\003\272\362\024\206=g?\307"
+	.ascii	"\253!\002\306\274&\033\246\250mS\303.\231\214\2613\006\"_\232"
+	.ascii	"\336\002\004\"H\355\203\241e\246tr!\313I\243\341\177\001%\001"
+	.ascii	"B:rH\331\263L\371\006\335gcZK\370,S\265la\031\374\340\246\372"
+	.ascii	"\356\231\024\034U\354\221\202\306\310d\347\345\f\206\3530\021"
+	.ascii	"\177y>\r\251\224\256\370\320\f\375%\022HF\375P\030\347G\263\241"
+	.ascii	"\225\315\347\345\303\321f#D\020\346b(\247\023\230:\033\2455J"
+	.ascii	"\340\372e%\376o\033-\312\034A \261\346\t$\004\213\221\223\025"
+	.ascii	"0\tE\027!dg\214`_\353\274\243@\301Ju\242\244\004\0310C\232Ne"
+	.ascii	"sJ\b\t_v\200 \356\334\313!\310\367D\261\240\0257\226H\320\210"
+	.ascii	"BV\314+]\377\237ge\331k\037D\177N\341H\220\315\030\023o.TK\023"
+	.ascii	"\276\207\223\002\245|#\013\f\3079\272F\255Q\271E\317\222\320"
+	.ascii	"\326\207M*m5\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\235\007\345\026"
+	.string	"V\033V@\020q\223t\360\fP\004\200\322P\302\341\240U\230\224\t\210;\306\374\fP \315\006\330\267"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\n \316\240\366\247P\370\206\37772\006Qh\374\377_k\302\376\211a-i\244I\231\002<"
+	.string	"C"
+	.string	"I"
+	.string	"\307z\206\027I\262\f\206P)F\026r\005\313U\330\003x\216X\022\333\357\250\325k\347\364PHR\335D\023\267\321zLidJ+\277 R\352\257\3544\331\211\337Bz\0249i\f\207\227\242\265U\305S\321\332\217\307\352\351\247w\3011`F\035\373;v\fS\225\227\213\225\200g\035\017\236Z\036Kk\253^\325\363\364Fz\235O\277\034$/\233F\017\245\307l(\2254\264\220ttCV\363\361\227)\031\274\t\351\026\272\320\224\243\222\005\242W\220\340\021\374\201'y\003\037#\037*\300\202\345\307ZHYR\344\315u]\327\326\007\b\344Qbf\341c\342CZ=O\013v\256\321\312y\220\023\267r(>\241\230e\375\247\023\003\177\205G\341P\230@"
+	.ascii	"\244gI\210\360\020\036| \007\337 t\035T>\334\312\201\370\204"
+	.ascii	"*\215\031-T\206\306\240\214\0131I|\"nDib\025\200\337h\254("
+	.string	"\302 _P\303\213\2426E\255\344\305Z\023\216XR\230K\032\200\263\250q\315\242\022\321\202\202\202\202d\030\003P\002!\205\350\314\003\021\200$g\034c\210fffA\222B\007\232!4sy\322l\224\366-\340\204JZY\266\b\234\232\217\264b\235W5t\\\270\tEl.\346f\342K\270\026%A\317`\266l\315\232\033\003L\351\215\203\214.\245a\263\303=\367<0J\376g\203\204\2338\"J6\255 T\007\244w\227\201XLD\337\002\220G\223\245\341\230\277\375\021\262e@O\217\301\027\\\304\036,\037\320o\347-\360L\211\264'\227I\345y\233Bx\222\025WGJT\374@/\334\003\3038\001q-\t|\017\362\262c\"\375=\324K\2620\210\215\"l^!\3254x\213\336\355\306\330\022\202<\030\342U\220(\274\246\211;@.\375p\003\336\351|\220,k\246\3512\031\350\303mI\351iC\r"
+	.string	"\023\021\213\024\314\r\b\0010-\002\316\211J/\204\017Jz\317\032\034\f\354\201\177\231p\207\2133Y\024\365\222<\333\372*.\340^@\274R\24284\375=lN\032"
+	.ascii	"9\324-v\3546\327\314\210&\023\222\253{bkA\240\200\305\0277\205"
+	.ascii	",t\034,\2006Pb\205>^\220\331~Q\035>\351\003ob\3426K\254\302\030"
+	.ascii	".y\236wB\307\341\322\353\241\220\007U\233\r\034g\013T\265y\032"
+	.ascii	"\324O\236O\376\244\267\324l\214\r9\241\311}\377\243\022\201Z"
+	.ascii	"\312\023"
+	.text
+	.section	.gnu.lto_.pureconst.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375 \211E\003"
+	.string	"\222\b\031\035@W\032\003k\224"
+	.string	"\321*\212\242(\212N\004"
+	.string	"<\0022\022\001\261s\225\331\346 \263\003^\312Cy'7y\311I\336\310E\036\362@\266\217\347q\313;\2528\276q\215g\034\343\027\317\342U<\212O<\211G\034\342\017wx\303\031\276p\205'\034\341u\3602x\025l\004\333\300\005\036\260\001\234Y\214\261U"
+	.text
+	.section	.gnu.lto_.ipa_modref.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\244\003u\016"
+	.string	"\306\222;6P\305&\303\001"
+	.string	"7AWU\325\200(\307\253G:sX\343MTUg\274\233\271>b\254\255\266\3116\337\006\017\372*\213a\351\350#\366G3\b\332&d\023)S("
+	.string	"+"
+	.string	","
+	.string	"\004\317\201\327:=\345\236V\340gFy\247\023+\307\350\254\224k\245\236?\310;Qu'\003FHL[\033\337LyW\n\363\323\251\351\314Z\255\265\262"
+	.string	"lm\326\206\365\031\\\3275I\335\202\267\224[*r=9\207B\251\200I\215V\377\333\334\311\235v\001\r\217)\307t\216\312G3d\013+$|\345\261\357ZY!dLJ\246\022\252\330\265\265]\035P\255\350\335\225U\r].O\213\203\032w\264\316G\210\366&y`/"
+	.string	";8\260\267\3556~$j\b\224}2\256\351{\366\202\363o,~\0225\217UPT2\234\020ID@<\206\017\027\207r\250aYT3\263\245\205e;\200\002\0212+\036\0200\246\304fR\220t\244\311\206T\347o\312\370\275\247e\235+\302\267\365T*\231R\313\005W\266\232X\267\232$\032\211\367F\371\213\234oB\242U\227P\314Z\371d\340\bKak\253\305\f\301QP\f"
+	.string	"f\360\303\266\263\013\2148/\313,3\313\351r\313\331\263\021q \262\016\273\323,i\007\034\205\376JS]\033Bn\037WLF\356\300\332c\326BW\247\037;\367\234\326\374\340\333\246\307G\027\260\2456\351\267_bu\367\211\274\372\266\261u\022j\306\022o\360\023N\034?"
+	.ascii	"z\244j\300\235P\310\f\304//\364n\307\036\207\234\021\251\246"
+	.ascii	"N\200\2033\240\236\243\002c|\266*\351\036\002\035\0356\247\340"
+	.ascii	"M|gTkX\251\354E\n"
+	.text
+	.section	.gnu.lto_.lto.1a7707b3ec91de11,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidNames.61.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"\032ROLL;PITCH;YAW;LEVEL;MAG;"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.71.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375 \235\245\004"
+	.string	"d\bk"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\221\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\327\006us\350\364\005uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\370\303"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.73.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\024\005\001\006'\001\364\003\005\001\006\035\001\001?\202\210\200 \177}\275\001{\275\001y\274\001w\273\001"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.77.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375 \236\205\004"
+	.string	"$\bl"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\303\376\321\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\376\006us\324\006uq"
+	.string	"\005\001\006'\001\236\003\005\001\006\035\001\003\216\340\003?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\200\b0\313KQ\204\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_resetPidProfile.78.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\335\b"
+	.string	"\326\321@;0\345(\035"
+	.string	"^\313S}@+'(Z!\307\271\251\230\326\"g\207\002\270\007\301\236\266\230\323C[r!V\022\321~\223\006\006\003\004\217\270D(\006\311!9\326,\331d\313\224\002-"
+	.string	"/"
+	.string	"/"
+	.string	"\332\245\346\004\332\245?\033\346\241j\337\212e\234\274vwF\217\177\327\317?\311\003@\224\351\232i\330]+\210\342\270\343m\037\330^\260\355\022\273\353\230\262\317\3725+\255^1\t(\273\032\261"
+	.string	"\373\"Y@To\177c\373j_\344#\337Y\026\037\330M\245\250\354\206\nF\320\\:|Aw\213\366\360&$\006\325\356\351\240_\362\226(\373\307\245+H\332\301K\237\244]j\264K\024z\320\032\262\262\001s\235\242\311\016M\032;\354g\033\237\320\006\342<\007\317\326\t\270\303\361l\335\034E@l!\320\234\330\036$f\307\023M\216\201\271\356\343\315\021\307ys\023\356\263\215)g"
+	.string	"V0\327E\304pF\017\006\007"
+	.ascii	"2\241\307/\320\301\205C\227\241\233\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.79.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\213\001\315\017"
+	.string	"\206\237kF"
+	.string	"\223\223\016\273\037$\035:\3723\377\376\2662n\020vA k\222\223\341\031\270\312\373\217\b\251x\241:\007\263F\031\001\020Z\226\314\b\377\001\372\377\353\377\377\370\242\202\261H1\375\352\331\376B\304C\b\331[\356\224\002V"
+	.string	"U"
+	.string	"R"
+	.string	"\026\321>\r\336"
+	.string	"\366\251\275"
+	.ascii	"\366\351\220\275\343\240\314>\244qq\365\330]NGX/\301[\306\320"
+	.ascii	"\247\324\030\3623\223\325\023\244h|&\321\247\034\260\273\001"
+	.ascii	"L\034$\203\370b\"Ei\342t\275\353\nR\274>\323\35113\331]\307\317"
+	.ascii	"\344\341\306n\373c\333\201\375\032\001o\335\362\321\252\321Q"
+	.ascii	"\243\037\"\340\204"
+	.string	"\343\001\217\335\016/ \2333c\224x\353\267\357\253x\330\362\032\353\207\034(v\367\240\357\362\266\342\254\320[\236\241\211`\2640\\\355\354\356\310\247\033h\237\bd\213\275}~\263\375h?u\232\320U\032N`\027\205\363b\027$\t[\372\347\263x\013O\236\304\247/\200\260\177\237>\b\373T\365C\f\031\342??|\310\f\f\030\037;%\0259j\246\252\277)\315\374\273m`\327\250/\235 \305\227\245^\357\372\f\221\n]\202\214\342KuwE\25216H\212\337\335\265\242l\355\252?\013\335A)+\235\212\367\211\200\322y6\237\224\240t\036\216\205\302\204nE\205\263\320I\250\300\235|@\\\311\001{\236\224\017\307\342y\037n\003G\377*\312_]s\001\"g\244\244\2511\316pTS\325\211#\227\372Br\251W\261t6\304\037\227\322\013.U\023\221q\203\245\243F\004\200x\233\337\3467 \b2\033\035"
+	.ascii	"3\241\361i\f\246\001}\332.\221\265\304\230\035\314\214a\314\240"
+	.ascii	"\035\266\314\024\354\210\246\021\230\226\202\021.\207\246e0\013"
+	.ascii	"\346]\332\240Z@W\313\201\270^\245iV\255\004\342\342\206\210\262"
+	.ascii	"\301N{{\016\370\223r\347\232O"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.80.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"\245\b"
+	.string	"\326\320>;0%'\035"
+	.string	"\336\277H\226\013\371\270/\232}\276i\235\221\254\246\237\220<\013\205\200\266\021V\204'\333\215,3\261\023\032K!\274\301\326\261\300\312\266\232T\374\266\201fd\223\275S\n+"
+	.string	"."
+	.string	"."
+	.string	"\367d\237\006m\233\263>\366+2\030*7\273K\245\307\301G\320\277\311\2650uz\f`\330]\3070\245q\313\3336\260\255`\233%\273\226*\373\253?b\035\221\231\005\230\335\214W\200u\315\227\020\216\355G\373$/\001\277r\313\332nL\213\313\356\"\370@\340\263\340\003\331'\026\017#.\224\274p\224v\305S\334\352\320\354n\202\177r\224\222\017\362i\013S|\370\351\233\262Om\243\006"
+	.string	"\007*\276l\326)\312\016\373\330n\325\373@\225\013q\333\326 \252\334\347P\342F\036o\037\210\216D\277\t\211.\024AG\035HD\267JA?\004\366H\\\245\237\347U\312a\355\261\225*\007\b"
+	.ascii	"2\241\235/0\343\002,\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_pidOsdAntiGravityActive.81.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\215\007"
+	.string	"B\21635Po\322\001 ;\351uN\327\314'\030\373\320\250+\300\222\251Z\253\334Iuk(\331\035m\364\343\031 \037\225\231\231^\031\306\375\233s0\001\352\250\333\336R\246\024\336d\030*\016\364@<T\021\016p\242Z\220\200\233\253\0033\004\2668\r\027\364X\326\0051q\357VON\013D:r\352\325\351+!y\214(.\022\222\252q\347 6\t\330]\215\377q\255\302\327\370\263\305'\237\375\371\237\313\337u`E\023\345f\307P*\206}\267z\262\235v\231\316L\377\t\244T\022\266\335\322\326\262)/\265a\373\266A6\306\007\b c\217\031\245\243PH#,\273\021*\352\330\023\363\337\361\307\241\221d\246\320\023@aw\235\231\351\342\326\033\330>\t\f"
+	.string	"2\241\271\037\330\314D"
+	.ascii	"\327\001C,%\007D\345\240\013\371\316`%\\\313\322\024\370\314"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_pidStabilisationState.82.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"E\t"
+	.string	"F\322C< \005)\035`\305\322\023\035\214.\004P\253$\253^&W\212U\313\017\340.\033z\353\377\330.\001'\251\214\252\302\fl\003\201"
+	.string	"\262`\214\221\321,\005o\002\031(#T\311&{\247\024/"
+	.string	"0"
+	.string	"3"
+	.string	"\006\334\351\366\002\356\324\242-\3631d\017\203\331H\241\355n\235 \027/E\377&\347\254X\250\313\200\210\335\265\\\261:\356y\333\t\266\037l\267\004\366\267\335]\317\226}\327/\245\364\351IF\243\201\230\355r\324"
+	.string	"\254\214\306F:\266/\355\223\274D\274\353d\316\256G\314\312\356\310`\005\201S\204\007\237v\351(\032\003/\273\333\340\237\374\205\341\213\234:\303$\277:\365M\334\351\202\312E\245&%k\376O\234\234\237\016,6\257\031,\246\2225{D\311\371\021]\370\t'\300N$\372\300p\364I\204<\022\201A\236\220G\252\241E\205'\242\250#\357sQA`\251z\016\374\221:\260\206\337\007\326\316\270\337v\266\274\005\220\335\314\244\246\312\001\b"
+	.ascii	"2\241\315/\020\302\205#0\352\022\026\261\032\r\356\362\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.83.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidGetSpikeLimitInverse.84.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\365\006"
+	.string	"2\21504`m\322\001(\033\004\215\330\261\267b\364\347`\0207\026qF\276S.\370f\345\275 \226z\271G\276\242\r\202"
+	.string	"g\200'\342N\b\272_\270\216do)S\n\276X\030,\314\313@<X\021\016o\302Z\220x\027\214\342Y\f|a\032\260\227\271.\354Qq\257\236\324\212\243\030\266+>bQ\300\356\"\370\241G\013\037t\347\013M>\273\3635\323]\252\200\b'Kv\334\244r\330o\253\036\373\351\324\001RJ\302\311\256FieQ\\\211\207mhS\376\307A\240-j\361\003\372\210\224A\242\262\273\257z\301t\327N0\335i\307\341\023\372\017y3\t\215\262\316\346\t\240\260\273\316\254\263q\353\017l\177\002\t"
+	.ascii	"2\001K8\343h\034\240k8n\210\02136qW\244\331\360\256{\003"
+	.text
+	.section	.gnu.lto_pidGetFfBoostFactor.85.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\355\006"
+	.string	"r\r14Po\322\001 ;\351\025"
+	.string	"Q.\224\005\017\004n\027\027\177\272\356\036G\263m\223M\335\"\020\317"
+	.string	"\371\250\314,v\005\361\365\346rkrf\217\214l\"eJ\001\345l\030\252\316\363@<T\021\016o\242Z\220x\234\213\342m\fju\032\256\347\261\254\353e\264;G\230\232Pb\264\255\260I\267\200\377\bu\2115\213\272d\327\213\017:\263\253?\224\035\246"
+	.string	"I\bcZ\r\204\351\321z\372\377\346\2505\026s\240\243Ea\3737b`\316\342R@\332bm\246\016\261\b\326n\223F*\331E#\343\344\345\377\323\270\200\262\233L@\331\345\2071#V{\304\323\n\212J&\002\031\001\022\376\0273\021\207\233>hK\n\b"
+	.ascii	"2\001\0378\343h\034 ]\346\305\fC\334\025i6\274\353\336"
+	.text
+	.section	.gnu.lto_pidGetFfSmoothFactor.86.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\365\006"
+	.string	"2\21504Po\322\001 ;\351\025`\330\177\\}p\002\345\222F2U\013\005\016\305\255\371z\\\026\201x\006\310Gef\261+\210\2577\227[\223s\030\321\222\275\245L)\336h\026*\316\353<8T\020\rO\242R\210x\233k\342i\nlq\030\256\327\261\254\353Qq\257\242\324\fH/lS\274\304%\200\335=\360I\036+|\322\235-<y\354\316\367Lw\251\001#\240\314\354\370I\345\260\337VE\366\323\251\002\037,\t\331\256F\366\262+.\305\3036\264)\037\344!\320.\2658\"\275%\003\303\304ew_\346\004\323]\373\300t\247\035\207O\350_\344M\005\345\004\013}\236\030\204\335ub\241\215[o`{\024\t"
+	.ascii	"2\001K8\343h\034\240k8n\210\02136qW\244\331\360\256{\003"
+	.text
+	.section	.gnu.lto_pidResetIterm.87.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`/\001u\r"
+	.string	"\266XXC\020\221\232\016\030\203\215\276\002\235W\342\205kp"
+	.string	"\376q\213\350\200\226K\377\307\240`yp|\367\317,6\036\345\207\203\362\331\r\250`\001"
+	.string	"@\005\006i$"
+	.string	"0\270\031^\304#Q\313\013N\215\354-wJ\001B"
+	.string	"D"
+	.string	"E"
+	.string	"\007SF\300\204v\227\322\023\326\313\357\2261\373\224\0323_\002qy\202\230\033\033\247}J\001\273\033\200\023!\035D\024\356\023\245\212\356\372\357\013@\232\215\353\036%\220\335u\3348\023wt\333\227m\217\375\223\252,\366\247\305\257\256\330\367\274\373\322"
+	.string	"\0326\"\344\330%Q\323cg\246L\212{\267\277\302\377\2749\213\267\310\356y\306\244\225\230`\200*:v\327\363\351\316\364\211\340\234\350S\236@\364\371\2153\033\307\277\226\rO\001iNT>1\0169~\214\203\226\006,~\303\242O\251\223a\207\266\243\002{\303a\034\032x`\033\304_p(\320\262\273\020\\\374\305\203\217\342\323\037J\342\267O\277$\372\374\367N\027\206B&\261Fuw\265X\325!DZ\344CB5B\221X\250P]\240@e\250B0P\"\027F}\034\26052\341\242H,\353\2426\337^W\\>\311\324\2301\321\317T\026\003"
+	.string	"i\244\n\212\236_Q\032\374\372\035/\240\020\221\307\345\356\2564\203_#\r\036"
+	.ascii	"2\003\376\031c\205\306\211\375]\002\313\022X\0212V\265.8\242"
+	.ascii	"\021#DA\302\350\252a,\341\026\230\246f\323\036L\233`\256\353"
+	.ascii	"\360\323\254L\033k:;\301\252\225\027!\202\314\270q\243l\260\323"
+	.ascii	"\336\236\003\376\244\334\271\346\023"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.88.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"u\n"
+	.string	"\026\224IA \251*\035(\303g"
+	.string	"Ad\337\n\006\320\262\0308P\373m\211\315\b\204\222U\240\340dMX\034\277q\235\200\310\251AZ\241dY"
+	.string	"\240\330\202(B\003`\245\335\003$\315|\033\254\204\221\275\367N)7"
+	.string	"6"
+	.string	"6"
+	.string	"\007R\"\006$\354n\225'\377>e\374\374\257^\001C\321\347Vr9%`\tb\fai^L)\360\253\307\221\220\024\243B\305\356:\202!\311Mo\333\302v\265_\t\276\352\2271\372ZC\314\301\305l\3274\233\260/\252 \305b\373\321\276\200\017\370\2562\002Wv\0274p\355\356\204#\266S\210_\264\323y\007\355\324\237\r\341,\324>2\230K\032\244]j\264\036\224\242\314\366\307[\240mw)|\002/"
+	.string	"\342\243\234:$\024\017\236\372!\355\364\222\002`\020@5\2123\233%\212\322\304\376\334\335\265<9\232\216\347q\335\306\333\234\301lp>\325\333tp:\034\325\203\223\341\251\231\016T1\017\346>\232\256z\034\327U\013k?W\236\214\021\3415\222\244\271\020\245\264=\\<\350)EG\005\016"
+	.ascii	"3\241\037h\214\254\241\336\260\227P\255\202@(B\364\034\002\f"
+	.ascii	"\230r\t\266YM\021w9f\22340\265\007"
+	.text
+	.section	.gnu.lto_pidAcroTrainerInit.89.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\215\007"
+	.string	"\242\21524Pu\032\003"
+	.string	"r\357\021\373\323\350{\225\306\236\237\036\022\351\233\305\"\374en\344F\277h\3274\343\247G\340\272at>A\025q\346\273\202\200\352\030rK\231R\355p ,\317\374PLX\025\022\363\302z\260\230\035\fcr\nzy\"\260\371\271.l\312\355\256\016I\016\"'\021\354Hp\013\313\212Dq\251\003\267E\360\326\230M\351\377B\233a\025\215\201\231\377\n)6m\324%\216\345"
+	.string	"=k\2165\b\300Qr\334\tJ\364\272v\013=8\322\272:$\265\025A\210LC\367\177t5?E\030\223\266\226\315Z\032o\245\373\305\344\341\222\372?!\2113\277\2546\212\005\264Q\310/\200\341\177\2376\002q\241\333\032\264\335\264\345\002\016"
+	.string	"3\241\321\037\270gn\001\303"
+	.ascii	"\356\300\301\272\312\314\020\304\315fx\256\341d!\214\227!\300"
+	.ascii	"\245[\264\363\t"
+	.text
+	.section	.gnu.lto_pidCompensateThrustLinearization.90.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\025\013"
+	.string	"V\225L?0O\224\016D\020\005\2404q\302\243\323\025\354E@\375\021\261\213_\355d\353Qi\344\271c\267\377\023\275\300\021s\230\345\377\344\035\236\221\230\021/\031`\314I\251\001\364\3609\f\"\273\267\224)\005:"
+	.string	":"
+	.string	":"
+	.string	"\257D\016\337)\221C\355\360\354O3\363\317\361\027\302\004\fm\373\374U\032\256\317"
+	.string	"\b\212\030\223M\364*$\017\3329\236\243-\224\251\221`w\235\332\206\341\206\267\255\300v\264_ \360\334\377\316\335\371\364+\312\006\213\005\251]Rj\306~\300\024\037lg\266$\317\2713\200]\025+<v\367\200\tT\207\266\375\32372\273{\250\222\351-N\\(!cw\243\200\372y)\004\304C;\3339\340\332\240\303\205(ClSx\207\273jw\021\370#N\242\202o:\264\005O^;\364=\221\303+\004\361B\004\007\312\224\215\372\244r\260\377V7\330\001\230\r\206YW\006\253|\2618\320p\"\226\201\240\331<\210\0224\f\"\304\313\325\211\226"
+	.string	"\2668\230+b\226uE\tj\257P\375\362i\352H'\031N\037 \r\275*\237\332\023:y\r\352\013\021"
+	.ascii	"X\b\b\303J\026s\210\020\351\260\302Pm\201\024\025\001B\313\004"
+	.ascii	"\343\232\3301\221\325\212\2471AD\205+\200\312C\263Q\032\230\332"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.91.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"-\f"
+	.string	"F\027SA\020\221\232\0168\204y'j\302d.=\224\341,\231m=\255Z\2142d\200x{\"\322To\210\210Z\035c\r\001\353{nV\f\n\200\313\004\024(\200\006\213\022[,\017\362\255|\262dK)S\n?"
+	.string	"?"
+	.string	">"
+	.string	"\321\237^\023\375\245\312\261?M\304\374\314\207\206\350Rh[\366'\245\\\325\200K\210\305"
+	.string	"\024'\037\246\315\203\t`;\321\216\335=\211#\312f\202\230\371\330]\243\266m\270\243\333f`;\201}\220\316\016\366;\367\353\271\033\217\276\244\241\001\003\244\333\325\020sc_\336\212\026\333\230=\3419w\346\330m\341B\305\356\"\360\001\351\317\266/\342#0\273\323\317\n\313e\304\310p\302\306\356R\035\017\020\232\004TZ@/<\030\302\335\315\262\263\215\005\236\016@0\036\f\331\356\034\344N\332]\005~\211\233\270\340\263\374\031\003\t^\373\363I\242\277\347\003Q\303\205+\301\030\373\223az\260\257\273\273\001W\207su\026X\325U\211L\016\361x\260\341P\327\004\t\033\n\021\250\n\233\006\"T\2105By\bp\305\201`QWUY\324\364\331\353Kkjb\242\244f\306KI\232<\t5m\013#x\355\245ff\030\016)+\032\025"
+	.ascii	"~\b\b\303K\023\326i\3702\202]l/#\264\005\204b\224D EE\200\320"
+	.ascii	"2\301p\031\240V\220\226\211$*0\004\250\034\261\032\247\25295"
+	.ascii	"\343lW)\003"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.92.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`+\b\035,"
+	.string	"\212M\330\020Fp\\N:\373\266\230\376\260\222\217`\2254\331\343W\216\016\233\022\251\343\212\222\333GE!\233\307\271rcC\367\211\2723\244s\2108k'\266\350\r\256*\347\305\324\001\312\350\365\215\377\303\222M\267&\215\220-w\222\001\375"
+	.string	"\335"
+	.string	"\375"
+	.ascii	"\3744\376\215\221q#I\027*\024-\f+\267\344\254t@\277$]\001\335"
+	.ascii	",..0\\\370f\374\343w\271\227\252\227\305\370=\336[\315\311\331"
+	.ascii	"\330\200\336\004\252\037:\371w\223\371X\370Y\256\205\177I\254"
+	.ascii	"\262\f\350M2V&e\001\335\032Zq`.\2407M\346*\376\225\217\361O\214"
+	.ascii	"\225\251\034\215\007\350\315#e\240V]F\307$6\346\334{\237n\262"
+	.ascii	"\023z\223_\345V\252\230\225V\354\210\022^\227\273\255\344\235"
+	.ascii	"{oT\322\213\316\233\366C\347\3156\362\252\377"
+	.string	"|=\224w\232\266k\025\2377\301Ny#s\364\262\372\317\3674]>\320\256\024\326\365\243\366\224P\336\204!8z\234\227\246\213\007\332V=O\224\365\2403\004\307\217\233Z\325\332\001_m:\236\246\353\207eBC$\316\317+\253\366\217Wj\223\356\275\037{\255\341\205U+o\302\275\227\353\321\013\307\331\347\314\354\205\231_0\363\334\002M\367\346\336\353`\355l%\370Jn\262\360D\375\361&\377\304yS\251o\366\"-=\220Wu\311\005\032\251\r4\004\267\264\016\253.\271W\241\n\364\357L\220^}:3qE\375\021\251\257\345Aq\324r\300e\265\025\263\030Vm0\346\333\333E\230\241\236\026(\370\230s\002\247#\317Mge\246\2632\202\237\235\227\316\312\007^vV\262\225\223le\003';\027x\362\214d+\013x\2303\360b\347#[\331\310V.\262\225\211l\345![Y\310V\016\262\225\201l\345"
+	.string	"\266\362\217\255\f\300V\366\261\225\177\266\262\317V\356\331\312\250\255\314\263\225O[\3314+[[\271\273r\355\312gp\244\206\346\302\362^\256\245\236\013g\2421\371\230?\314\177\366\227\375d\177\362G\376bG\231\317|1\001D\344\304|\272H\326v\341u\350|\372hg\252\363v>\265PC\365\207<i\330\255\277~j\233\226~\231\355\353_\003\345\244l\\~z\355k\336\2364\314@\367L:67\351\334U]\376\264P\237uX\025\355\237\346\232\322\241}\236\245lM}6\257\257<\205;kv\322&\274v#\t\304<\273\332a\270\2348gG\210\373whq5\261Jf\256Kf\027\311\3364<\216\225o\3146\353\230\341\251\367^\253n0\346p\332\026A\006'\253\3321\363\206\263\341\200^\315\327x"
+	.ascii	"\021\242\376\030\242M(fT\220\312\233\265q\022\344\262\204\345"
+	.ascii	"\322.\353\336\253\245\356\246\256gi\030Sw\177\354KG\267t\016"
+	.ascii	"\202>\320L\375-_\242\221V\033\301R\327\236q&u\270\030\274\267"
+	.ascii	"3A\236\332\333R\377\313\217\266\304!\337\007\372[wJ\375\256\300"
+	.ascii	"&\265c"
+	.string	"\236z[\214\326s\204\231\352f\202\001D\241q*\203\260\310H5E\301(d1\f\262\360\275\220\252SRU\204T5a,1\f\026\215\032P\004]\004-\f\2110\204E\242\t\242!Qh\234\032\nQP\r+\030\207\301b\261\005\225\020S5\030!T\021e4QB\210\202D\324P8\225\"\212\252\310\"\252\001\220\211*\202\305(#\221X\214\372\211]\275\213p\355\261\373\204H\371\262U\353U\352|\013|H\240\334\231P]\205H\371\352\035%\375\306\2164\270\253\306\022\320IG-\340g\324\013\212\232\250\215\032\230L\303\200]\324\300=)\033Q\277\316m\231\316\371\032\214\217v\223\212\032\352\324CC\005\311S\320\300\256\301\314\300FZ\242\206\314-\253\332\365\226\254l:r\347T\324f\ry\205&\350\241V\320\235\324\223g\250{I6x\220A\355\323\t\272\317\322/\254(Ze\346\200:\250\237\206\005h"
+	.string	"\r\324\003\322\3220\237"
+	.ascii	"M -m\302\312?\271\367\002\001\350\247\335lkS\362\032\314*\200"
+	.ascii	"\240\250\2010\003\225R\250hd\024$\005\005\205t\220\002\231)+"
+	.ascii	"n\021P)T\316PI\224\215\335P\007\214X\252\212"
+	.string	"6\b\361\372\3577\244\322\026\f\237\231\376\303A\355\034F]K\342\311\tp\n\200+dA\232\001YP\030\201\377`\013\333\277\037\242\326v~\260R\276\207\217\tL\200h\234\371ruB\343&\332(\026\327\363\210\2309\326\033\342](\021\035\244\217\004#r>c9h\355\"\202\217\326\356.8X8\247\221\205\357\201j\3056\016\037\020&Cg\026NN\236\340\242c\030\274\360\242\271z\265\251\313\0278\231\220\232\322\037\224L\313Xo\004\206\204\2332;\035\303l\330Ht\272X\256H\223\322\t\035\341\353)\271\223f\254\203\374\373\375q\365\034>\242q\343\263\240\203\336\334\003.s\204\321\340\315\252\301\017\357\271p\020\364RY\373\257\267\341f\372S,\277;\254\306\237\036\223\314\333\352\336-z\0325\260G\342g\245\007\310g\316.\321\244\350\031\277&\321<\3661\022TS\205\346W9\367\214\370\t\"z\352&v"
+	.ascii	"\207F\202\b\370\007\360C\177\230\324\"\340\333\0046\331/\201"
+	.ascii	"[\301rbpox\326\031\335\337\344G\005"
+	.text
+	.section	.gnu.lto_pidLevel.93.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`b\005=$"
+	.string	":D\330\016Dp\336M:\353l'\366b>\256\247\250@|\361\210\031\021WKL\322\342\351\211\243\032\304\336\215\237S34\335\333?\373\371\007\213;p\031\204\016lB[U\310\336\002o8\340\360\203F\315\2324B\266\224I\006\327"
+	.string	"\276"
+	.string	"\343"
+	.ascii	"J\276|'\332\313\354\362V\353g\333ms<\255]\336K\336%\356\307\334"
+	.ascii	"lyd6\355\230\207\220\224\030\030\347\326\216&\244\022\034q\265"
+	.ascii	"\326\006/\367\004\005\263i\364\250z\025\3352\264\027\032\003"
+	.ascii	"\216\252\261\013\226\n\314\273/\373\026\342\271\3308R\255F\340"
+	.ascii	"\324j-{\260\016\312\316=?\271m\273\253\225\310\025\265Z\353\203"
+	.ascii	"\215:_\356\356\376\312\261\020w\323h\331\030\231\316LP\327\027"
+	.ascii	"A\265\326\336\323\231\314\227\364J\346\313Nr\342ufI\233\211\373"
+	.ascii	"\233\235V\271\223\006\t\266u\335\217\233?^R\246\257%\310\"\260"
+	.ascii	"#e\020\267\026\350f7\230\022\201\365xS\006amz\024\201\025)\023"
+	.ascii	"\234\"z^\346\354\005fd\326a\250\265.#\301x|\317\357\256\214\335"
+	.ascii	"\355\261[\202\b\355\324w;>)\362\334\032q\201\336\245\362\361"
+	.ascii	"\221\264\317&f\354\255\345\356.\r\035\343\336\334\357:\264U?"
+	.ascii	"\363;k5R\330\263}xq\222\3310_\276um\206\006%\271xn\267\254\310"
+	.ascii	"}d\367\264\266\221\335\035\357\002\005\t\016\346\207\272\332"
+	.ascii	"\027\301\305|\237\356\345?@y\r\234\314\327\351\311\277\300\271"
+	.ascii	"\374\004\016\346+\200\3626Q^&\312\273Dy\225(o\322\216\027\211"
+	.ascii	"\362\036Q^\243\363\026\2357\300\311\013\340\274\274\223\227\210"
+	.ascii	"\362\356\316{\236WGyM\035oIy)\345\355\363\262"
+	.string	"\216\367Q\217\302\347K\016\2510\265~\315\025\252o\245\031&W\373\305\374d\336\273\337\375\331~myj^\001/\363\235\030\233&\207\322x\327\006\332k\243\314\005g\234.x\214,\267G[\2172\221zA/w\001\271\234\317\341\260'[\017 \370H\020\346K\244\346!\3612\b\310Q\033\350\247f\264c\223b\332\317\352@\021\253{anN\316X+\027\224Q\037\365\217O\212\332\250\t\270\035\343\0024\257\213Z\347vl\002\240\003\274\2118\232\235Z\215\026vG\374M\t7\030L<\314\030\r\363%\200>\332\0353D\315\333\016o\203\202\202\205\335\024g\243b\302X\255\225\202\232\257Y\261\313B\212\217\2242_\022\365\315\316z\242\210\205e1C\315v\352\244^>\376)\362\032 8C\272\217\254S\357\032\210\017;B\330\344\2701\262\334\236\275\323\365\331m\350\350G\327e[\327\241\262\315>\3341.M\331\021"
+	.ascii	"\315\rJ\322\356k\005A\313j8\205\325\003\006"
+	.string	"\261\260\202T\004\254\206U@\237ph\342\312\027\303\027\002\030\254\361\023\006\255\226\312\f\302\240P\350#\032\002\177\301\254\241\317D\213\037\211!\320'\024\302\240J\302\372\tO\370\256\252\200S;\337\325\317EPH\242\305/\213H\3537c\212.\025\204\026\277\254\336\320\252\352w\345\242\007\374Ma\365\250\204Z=\b\0036\230\345\023\366\206\301\240\260\307+\343:\255md\277\366\222\355h&\350\367YK\226\nZ\200\200\353\b\"\345\215\253\213:\250n\352\004a\b\232\251\233\272\300\227\247^j\246\326\031\242\362=pK-a\312\231\225$\324\025b\026>\022A\177\355_\022D\310[\261\267>&\027\247f>\265R+\350\246s|R$j9\236M;\367v~'\203\206\r\033\314\227JpQ\310\302\262$\271\322\334\370rR\366\221]\201\246\223:]\250A0\002\tR\312\021!\221\021\"I\n\351\240\"\021\2432\017\021"
+	.string	":#*-\354\006\336y\265\233\025V(\215\0309\243 \247P#\032\216l\001U\302\f\231\242\375|\222\360J\033\330*{\303\301w\032\262\t\013\351\323\027u\243\204Qw\206L"
+	.ascii	"\031\217@hj!\314u\214\036=\030\335\246ec96\300\310\332K?\210"
+	.ascii	"\226\034}W\200\242\245\377j3Tm\362\257u~\t\310\222\\\2057`)S"
+	.ascii	"\2273\004\211\337%?\363\364]Q,\272|\2615\215\025\007\361\317"
+	.ascii	"G4\273\360B\353\031\301\257\306\356\351\352\200\037\367\002\t"
+	.ascii	"\331\032\3011H\214\242RD\177y\200\372\361\035\332\006\312\216"
+	.ascii	"6?\214c\004P*\360\371C?~\3015\302\374\007"
+	.text
+	.section	.gnu.lto_handleCrashRecovery.94.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\256\f\275>"
+	.ascii	"jj\204\027CP\236N\007\303r\002U(\241G\220\317'v:\224\261\025"
+	.ascii	"{\307AR\033.\277\\\204t\034z?\245\337\237\022U\360.\035\200\f"
+	.ascii	"F#@\3539\253\304\324\370\3542F\352\371D.\322v\273\t\331{'\231"
+	.ascii	"Rh"
+	.string	"\001D\001h\0011\217\303<\261\037k\367\304\367\334\315\270\347\371w;\037\235@==3}\347q\217\330o\f\006\232qh\321\351\332\313\344\271(nI\001\360h\342&\030\3071\223\263\255U\274s\251\220\261\3631N\247k\242Y^\025g\267K\365\272\026N\327\217\367W\350lw\213n\327\331\326\355\016\243\347l\2774\335\331\b\326\213\2132\207u\035V.0\332\030\307da\352*\274\026-\227\026\273\004\216\t\3061\264\251\243r\234c\201=\313\214\242\237\030*\027V\027\307qM\375\240\350l\307\025=w\273\025\177\203\035\216\206K\213\32491\3018\326\322\324\b\212\316&\371P\353\354\352B\255\263\rw\307\361\270\263\230\330\304\210\215-\205q\034/_\211\303\256\024\n\002\372\361I\"_\367h,\022[v\375\f\267\023\243\214^_[\256$F\t\245y\320\222\f\224\206\226\177\230\234e\237\244XF\246\031\311\357z"
+	.ascii	"M\0228Fb{?\\MZ$\273D\224\324\244c\371h\034\242&\r\313Eb\224\022"
+	.ascii	"Y\217!N<~\t\361vM \266\367#\371\025]\207\320$\201\343cldvE*\033"
+	.ascii	"3\3644R\2605I"
+	.string	"\317\317\206\373U#\257\356\0274\177\032i\332\232\024\307\261\317y\316\361\325\22531*\216\343\316^_=\274\207\274\333et\267[\267\333\f\355M\327:\333\276\347\030\262>\373\036\035\344\352\340p\232\372f}\242Y^[ca\213\333\301\376\264\263k\265\n\376h\n\233\034 4\343\361\365\247\016\376?\247\221\333\373\340U\020m\376}\316\227\372\236\336\301\027\325\261\261'\177\202\177z\277\363u\312\237\240\230;\\\240tu\b\377\023\261&\177\023\240\3478\216\267\376\247\355\315\326\337\204\234\033h\306\323\335$\034M\263\030\307\361\203\3663\356W\242=\315\331\236\242\312\356E\325:\353\3174\245L\354\r\216+\037v\307u\345\237v\373\032\177Y\267\233{\3021\267\224\233[\202\357yGpsCp3\336P\307\334Onn\007\036\306\275\201{qg\340_\334\027x\236\367\322\263\270;\271\026w\005on&\347\342\236\300\315}"
+	.ascii	"\231\333\200\233{\t\231\273\200\233[\311\315\235\204\314\215"
+	.ascii	"\344\346&\200\314=\300\230\373\350\315-\340\315m\364\346\016"
+	.ascii	"\360\346.zs\023\275\271\001\274\271\207\336\334J7\267\3201w\320"
+	.ascii	"\233\033\350\315\375\363\346\366ys'\337\334H7\367\353\346v\221"
+	.ascii	"\271\217nn#2w\321\230\233\370\346n\337\334\354\233{us\3771w6"
+	.ascii	"\346v\n\316WW8GE\2278\324\246\260\334\003&b\240*\315_\260\221"
+	.ascii	"1\030\t\222\326\331\241w\315\330\030\211\355\375x\177\232\225"
+	.ascii	"\377Bn\317)w\303SXIv/\345+\365\302\374\272~+\356\247=\341\205"
+	.ascii	"\376\t\243e\0359\207\320\031\2254\251\237\020\364\t^\352\275"
+	.ascii	".\343\020\221o\004\375\343\375\031.u\303Lr\215\246\022e(\334"
+	.ascii	"D\311\225\273\340'Q\340\265\354^\360Z\353l\220\277*\205\\\371"
+	.ascii	"\360\b\004\366\177\f\336\347\201\336\311\274\221\023\205\342"
+	.ascii	"\363bMUV\327@\257\301\345'\337\347\333\273)\276GO\362}\330\364"
+	.ascii	"\265\301Q=\f\233\265#qK8<\304\003\215c\256%\344/\377\003\243"
+	.ascii	"j\357#\337HOT\320}\343\277\317\336E\217\357\342\201\331\240\236"
+	.ascii	"\272\34167\204\335\036\234\335\361B\370\255\341+R\331\275\244"
+	.ascii	"Zg\217\017\205fW|\343;l\346u(8\265\032\307\320\247\356\nNh\241"
+	.ascii	"\030\307\320\007t`\262\013>w6\343\275\214\257kv\370\f\355\214"
+	.ascii	"?M\343\304w297F9;\206\266;\303\206\354^\304\237\346I\r\005\241"
+	.ascii	"\277\025\301\313\225\301\342O[\004^\373\363>\306\215G\364\242"
+	.ascii	"\250=a\331g\372\034\335L\237\254\372\234#\210\346u\265\3712H"
+	.ascii	"\\\277\375\237\357\034%\354b\022\342\346\254m\237}\260 \3254"
+	.string	"0j\372<\016\f\326TO\013]\345\204U\2255\3254\352*'f\323*ky\345l6\235T\001b\224\310R\307\247\363\371d\032\263\256\254\234,\262\230\035NXi\bbfMqp>\265R\024\261>0\233V\036\262\256\230\317\247\013*$\226U\214\251\265i\365\364\300\\\221\342j\312\250\365d\276pR1\237%\252\260\246\236T\311\246r:a\305b\231U\225\302j\005\212\345\225\325TsI\365\304Z:\025\265\223\005\363\271\314r:\237K7\216\313\327\370\313X\276:CA\256\357R\2625\007P\251b;\"f\205P\350\247\335$\262\224&Ru\r\311%N\025\302\242\224\267*A?m\t\257\244&\327\027\341%|S\340\201_\372\b\177\244\307\300\037\210B!\343\235A\241V\r|\306C+\360KN`6\317\323\004vs;i\005\336\371|\275\022$\360\247\212g\016\020\204W\362\221\227\300@\320\224\202\366"
+	.string	"\302A=\204W\240'Z\230\364\004\036\352\217\370\220>I\t\205\234\3152\322g*\240\335\200'P\006\263\271\235jN\002\2739a5\223\rx\327\363\365\r/\260MIL\0354?G>\307\217^\251\027\305\017*\227\344\215\234\217"
+	.string	"\243\027\220\213\34411#\331\373\256u\326\310\260\355\222W#\031\340\211\372\212>@S\036\022\006V\364\256Y\2336$\017'^\310\2376\321\003xW\023\222\203d D\357Z"
+	.string	"\341\206\036\300g=Q\005\331G\007\200\373\250q$D\221S\310FD\202H\222\024$\215\001\240\002\021!\243\252\003\021 -S\316\315\310\224\2449]u\370\232\005b\365B\260@\332\264\257\323\353Ir\205\214m2\004\235\205\357]\223\354\301\213\337-\034\303\365?\306\254\227\362'gW;\207u\325\r\235e\\Y9`r\002\220\262\207\346\250\247"
+	.string	"z\024\323\220\2631\251a\202\215\350WG^E\206f\360z\207\233\273\241$j\263x4T|\247\215R\363\036\267<\260WA\232\\AQZ\031^\221\037\341"
+	.string	"\334\017\3501n\353\313o\340j\257\344\355\200\036\024\222\225W6\364\221\227,~\345"
+	.string	"*\240\021\356\372\206\256:\002\220\332\214\276\324\254\243`"
+	.string	"\242\307\213\322\274\026\232\233\324T\340\341\"j\263\275\347\322\263\334\351\027\2547\001\214\243\2700\272B\247v^\310\312Ui\321o\210\261\206Z\335p,\360 \333H\033\021\333F\r\301kKE\032 \036-\201\367\0258\202\277\261WHy`d\266\206\273vw\221\257^\032\354F\206^+\343B\002,,\225,\013aS\306(\b\235g:X\330\221\320\b\305\350\327\301\322\212\222\f\0332\302r\361H\017@\\\372p\341\201\\e\374\375\242\341]\315\341\276\227B\023{\227X\331\206r\204\372I=F\360AB\311\237<\346\360\313\233\212R9f6\251A\215\017\343\007i/F\020N8T\274hmG\002\024/-\215Z\207\332\201\020\340.\215\\\203\377\301\354{,\377YP\211\362\214u!\215\346\b\204~\206\270\216_\001"
+	.string	"\302\242"
+	.ascii	"\217\030v\223d\211\002\023\235\034`\301\340\254\b\264\240d\007"
+	.ascii	"*\253-\347/\330\"\005\234\037)\321\007\343~e8\352\253`0w\224"
+	.ascii	"\212\2253\257\327\353\016\354\021\305\230?\212cE"
+	.ascii	"\031\265\216\"\372\363D D\001pg\275\353\3613T"
+	.text
+	.section	.gnu.lto_detectAndSetCrashRecovery.95.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`[\b\025,"
+	.string	"\312M@\021B`\252\325\030n\300\026\306i\023\313\274\177{@4\301"
+	.string	"\206S\3144\031hq\031\3156\021\244\275\204<?\340l4\232g\314H8.]-\327\bd\366\220\335T\346X\331\207_\262\222H)\245\224)\245\024\001\001\346"
+	.ascii	"\004\001(\357\305:&E\240dn\314\261\363\341\307\344h%\253\346"
+	.ascii	"\207!\013>\246\203\333\367\325r\266y_\344\003\236\300v\312\355"
+	.ascii	"\314\r\326a\305\026\333\321J\266l\215\263\355}\311<`\005l\247"
+	.ascii	"I\rT;E\333\247v\312Ef@=6\345]\273\002]\225q\276\357\033|)]l\340"
+	.ascii	"\317g\324\343\025\355t9\027\327\262\253\232\242\357E\3565C\233"
+	.ascii	"\\R5\360g\305}]m\324SSr})\2518\257k\212\0275Y+})\231\370NI\267"
+	.ascii	"f\320\n\302\354\034\n\241\312\231\325j\312%h\356\355*O\177)\263"
+	.ascii	"\334U\3428\346\2272\211\267L$\3162\217\370\212\016`\236\ri5%"
+	.ascii	"\023Mp\347\t\233\273\274r\265\325\224U\334\245\225\247_\312\256"
+	.ascii	"\335\262\312\321VSv\241I\357\373\272K\244?\332\240\315M\241\335"
+	.ascii	"\362\210\002\201\\I6Y;\326\022\351\276fx\337\227=\271\f\322|"
+	.ascii	"\324\314M\204\231\211\314\253\207M\205y6$\035\252\376\271+=g"
+	.ascii	"^\321\344\235\364W\23149>\325\233\205}\231\202*P\227\276\311"
+	.ascii	"\272\335\323\344\275\255@\355_z\366\253#G\1772\367\232f\343\304"
+	.ascii	"m\205\205.\274\223.\324N\373\231\326\216\030\375\351.\247\n\b"
+	.ascii	"\226\347\035\352\200\357\246\030'\202\360\370A\372\033\363\330"
+	.ascii	"\321\177\213\271\377\371|>\371\2410\253\316K\256\263\003\234"
+	.ascii	"\363\202\036\323\215\240\307\272\225\332LwR\223\3516\320b\335"
+	.ascii	"\003V\347\243\326\031\330:\377Zg_\353l\324:\367\\g\036\353\\"
+	.ascii	"\204s\336\255\316\272\3269\327:\273\2553\256un[g\266u^[guuN["
+	.ascii	"g\224u\376\325\331U\347~pa\0133"
+	.string	"\253\353\355\371\214\275@\236\210\336\264\364\215\027377\232NS\243\317p\f06&X\247\3145\230\335N\333ef\324\314\215;\004\317\\\344jA\305*n0\300\322\230aY\335C5\320\320@\037@:22\347\240\306R\223D\307\300\323.ze)j)\220$\201\363X\027\275\250\314E0\3050\336I>BCr\240\013U\356\227\300\274\232kH\177k/*%n\356\335\263bX\363\331\223{\f\270w\337\365X9]\351\2315l\360N\342\036\211I$\r\371T\216f\344\202k\237\345\320x\324\332\217\220\364\354\243p\226\261P\314\004\265\277\305\353\253\337Q\232h\035:\215\313\354\254\317\264&f\340\325G\341$\263r\362\320p\361a\177\353M\247\357nM\376\320u\206\354\373\276\023\270\351\364\031\bn+\235r\b\021\"\324N\323\277\300%f\364g+\005\201\303f\375-.kv\344\373\032\017\240\337ZM;"
+	.string	"\234\231\204\t\357$\372?:\317\264\343S1\205\"N*\025I-b\335\272\221\324\377\"\263\216s\"\205\n\025j\247\377k\224'\030\016\374\202I\b\3654\025\234\021\005\005\025\345$@8\3254\202\030E$\n\333\246)\031B\026\251\224\t!\324S\211\251\031B\"\261\206\223N\352\tG\023\232\203(\264\021\345$$\256x!\325Dt\332\261\023\023\213'\032\301\251\027.\236d\264\b\316xj\202\n:\021\245\202L\0018\212\206\220\030\234\212\212\"\006\3351c\243\357C\341\224P\033Cm\306?\242\357\373\276@\037C"
+	.string	"X.\231Y\205\243[\217\337\321\367\025\3571dy\034=\206\260&\31401v\273\312#\304\367[\314\037\334j\210\324\307\253\256\3308\007\031\375\351\326\371\361\307\b\370?4?\272\021\350\373\237\357\221\230`P7M\242\364\214\276\367?\265\346\331\223\313\022\031\275\263\365\236\201\036+\347\256\n\355\345\375\026;x\336\277V\023\r\351o[\215\250(\345\020\357"
+	.string	" 06f\230\330\202w\360\001\b]%\332=\202_\360\235\246Q.z\332\274\0301\203\305P\261\212s\367\022\326\b`\201\275E\272o\255BC\226\320\257^\326\030\n\200\236\250A4D\225DT#\022\2244I\241\320\001\320\002\021\241\262m\021@\245D\016\316(\230a\r\2303\324\210-=\273\225a\016;>,\t\212y5\031\255z\023`\007\246b\360\274B\205\220\322}2\004\\@\034\004\r\226\0137\277\345Y\305jP\265\310\206\003\t\f\351\207\220\254\027\246\374{\270\347\267\376\200J`i\202\036\340\217\331\203\221!\245\221\026\214\300\317\316U\216\306\026\371R\363%\030\304-\215\351z\343\206\253\207-0*\337\330oC\342\0344\006\263\221"
+	.string	"\204@_g\272\\\353\034\006s"
+	.ascii	"\260\202?\270 b\021\312\234\343jd\n\305X \023\026\320\370dls"
+	.ascii	"P\253\246\025t\b5\277A\255\256\373y\277\207uq\304\003)\2233\027"
+	.ascii	"[\242\222\251}\300\206\233[\356?\202\305(?\237_\t\355g\211\246"
+	.ascii	"<\252\310L\035\033Y\376\002i\003\260!t\334\265\366\254\271\026"
+	.ascii	"@\377\001\376\371\031$\241\020W\366!=Y\205\336\243O\262lK\247"
+	.ascii	"<\260\025o\016\207\254k\322\275BUpf\257\352\231\301\341u~pC\330"
+	.ascii	"\204\334\205\320\211\254?"
+	.text
+	.section	.gnu.lto_acroTrainerSign.96.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\005\t"
+	.string	"\306\320=80\221\322\001"
+	.string	"g\251Bt,K\332\306OE?\307\017\243\230\345\365\205\005\365\371\333\367\215\004\302\364\3369\201J\2670h\201\322R\324P\3302\251\312\025\2447,\331R\246\024-"
+	.string	"-"
+	.string	","
+	.string	"\351\371\207\035\316nfP_\351Pu\205\007\"3\325\300g\202\n4\022\232\303\236\251\357\224\t\360\260\273N\324\027ro\267\035a\233\301\266K\236\374\3132\013\354\276\270Tv\327\301\013\001\337l\373\256\243xv\013\214\231|o\235|\244\330\354n\374\274\240\363\r\236\240\363MK\356\035j\371\225\032\332\210\312lgB*\004\314)kv\254\224\312\262\017WW\366_\177f\372\020\241F\353\210\331\005\311\301Y\231\215\245e\333\263\003\0347\210\233\350D\221ta\321aTD\215N\"#\202F\033\2213pHD1\212\244Ph\024=\261=\\]9\225{f\303\257)\375x\250\tBe\005\016"
+	.ascii	"A\204\306\265Pl\b\005\252\"CE9\rP\016a\271\206\243f\3618&\210"
+	.ascii	"\250p\005Py\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_applyAcroTrainer.97.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`n\0205N"
+	.ascii	"*\203\314\034O0\022\332\351[| \250\013\2521\006\341\217\210\240"
+	.ascii	"\206\204"
+	.string	"\240q\371&3\027q\b\016h\032\236E0\031\364\313\364z\355\3760\334\267\213\304\023\020\276\217\343N\327M7\335=\316k\236\n\327\361\032\320\222^\2344\030)x\301+j\"dwK)\245\300\001\207\001\301\001|u\334O\330\350\204\333\342\336\r$\026\f\357\204X\256\320\320L0\350:.\300M\f\003fc\f\255\204\331\310\033t\035\253gqc\321\265{\257\261\221p\313\3203t\313\001\b\300v\222*\237\253\267\313\205b\013\340\032\340\275o\023\f[\245\203\372\361)0lu.\003\037\347\333-\213 \260n\r\260\305\006\314\306VUf\226\373\b\033\231\331\b\267\303\253.\233\247\037\224\277{oQ\253\314\364q\334\006\217w+\213\310\tw\346~\353\027\330\206\241\203\233\343u\302\341\250\273\367\355\210\215\336\206\334\336ml\307\304{\203\310Pw\357=b\242a\253\314\314\255\326k,s\033|\033+\023\2665@\345"
+	.ascii	"\357\275H>\215\\[\r6\315\332\352\017i\266\205\202\200~|zxvtr"
+	.ascii	"\22487I\033d\r\315\214\3141\006\346\305\305X$\016\205\253\032"
+	.ascii	"|g\271\205+\202i`Q\262\246\314y]\265\220Z\007\251\311\340@s\375"
+	.ascii	"3\027\203\373 \351\036$n\316\323\326;ml\256\323Xt\235\243\266"
+	.ascii	"\346J\027\032\307\205\"~\223L3s\233\264''8\222H\327\004\225e"
+	.ascii	"\301\241<\"NS\264\021\005\372\227%\310\227\t=SB\320\007\317\004"
+	.ascii	"\227\021\256P\322?A\276\322\372H6\3461>\032\006\255+\352/h]="
+	.ascii	"\334\305\007\0177\206u1\210\274A\b\225\022Q(\"4Z"
+	.string	"\327\016'J\351\n\323\341\303\237 _`-\204\336\365\017Z\027\230\2579Z\r*\243PD\200\361\262\021\034\272A\b\225f\362\364\240\323\277\355\037)]tA\237{o\037i\337\362\312r\027\256\270\367\262ky}5\0175\263\2531\363\0273\f2^\345\211F\374\342+\345\236\177\303_\237\370B\271'\nY>e\341\017\253$\320tc\367:\225\230\027h*\f\f\357u\236\340\201u:\320r]\326\301\332\252\360\233\216l\211\372\35374\020\313\247\354\263\373\0360\241\304\fA\363\305X\362\335{O\350\320S$\340.{zZ[U\277\333\366>\267\261(\333\022,\237\256/5\301\2266\246\276\030\267\314\354AI\337Lz\306\212\337\225\225=\033\356\2757\370R)\215\242A(\341xQt?\321\252\364}\244\207R\340\372\234\256\205\277\211\326~\245g\207\202eu\224\326\203\342.c\246\fo-\031k\253\3751\332"
+	.ascii	"\243l`X>e~\313\362\2272\367O\247\323)\277\030\363\213vv\321\324"
+	.ascii	"N\232[\2643\213vf\352\271\346\245\206\241{\200n\353V\361\316"
+	.ascii	")\206\316(\206\316J\035\327\235\324t\315H\313N\322|d\324F\232"
+	.ascii	"\213\210\316%\214\316$\336y\004\321\231\310\350,\202\350<Dt\026"
+	.ascii	"2:\007\2753P\321\371\247\235}\212\316=\357\314\363\316;\357\254"
+	.ascii	"\363\3169\357\254|g\234w\276y\347\344;\333\2743\362\235k\336"
+	.ascii	"\231\346\235g\336Y\346\235\217\355\034\323\3160\357\374\362\316"
+	.ascii	".\355l|\347b;\023\333yHt\026\266\363JtV\337\371\337\331\207\316"
+	.ascii	"}@\313\r\021\345a\206\367S\336.\327t\210\253\247.1k'\335s\335"
+	.ascii	"t\335I\272\215\344\325\300\235\0066\003^\r<\024{}65\313\356<"
+	.ascii	"\032\243f\372-\345\277|\007\201\203\322\364J&`I\262\246\030\001"
+	.ascii	"D\276\264\346\3058\306\235"
+	.string	"\f\267}\275\361\232\370\003\357/\220k&\371)\232\276\363\226\036\347\233\376sxF[<\362q^\271w\243\311\023-\305\337|\013v\005\037!\307MP\355,\016\207([\033\315Kg\262L\247z3\215\327\336#\307\237\017\270\254\033az\177N\233O~0\357\211\206|\233W\257<\001\375\213\333\216\343c[p/\266\210\n\347\362.V\215ec\335\274\265X\267\265U\344\367\223~\361\005F\227\205e\304\376\375\327 \262|\252\345\336[S\363\377\354O h~\346k\336\363\236hYL\200oq;\324\242\371\256\"\3633\217s\345\211\302\361_^\346\333\305\037\177\375\002\223\313\232b\344\357\370\342\3206:\264c\270\266@[\230\356\252Uh\026\005\332\272pW\255G1O\266[\332pJ:c\336\370B\234X\224mI\314K\035\213\355L\370\225\323\216_,\201E\212\177J\202\200q\361,~\204\233\337\013\314\273\270"
+	.string	"\327\027\310vMe\213S\337\215\r\001\363M\245\317\345\345]\276\t\307-Z\013\267\303,\217D\326\266\364.\257b\332\344\th|)\026\266[\216\005\341\224\344\273\362\322\002\2264 \212/e\026\237\244A\b V\366\232\337\356\275\304\227\262\013\227\335wm@\273\006mW\243v\361[Em\374&\334\016N\327b\205\355\226.\372\007'\235\261\277\366\001\206\001\b \260\266j\314sSa(|1vu\331A\243f\361[8\364\322\367]\333t:\244\360\343^f\232N\2658\357\305\n*\376\322\007<cY5\303\352I\ni\212JJ\212\nJI\343I\203&\323j\n\306\005P\314\031P/RM\246\025\f+f\025\263Y\244\200i\005\305\264\200\252Y\003\206"
+	.string	"\253)f\263\231\001\224\213\025\263\371VSQT\nX1\253\206RQ\315\006\2304dL=\021\253\2428x\n2\324\222\202\250\032HV3dD\321\250"
+	.string	"i*\352I\n\t\252Y\205\264\274a\252\032\314&\222\025\025U\023\311\370\206\325\301\373b\334Gz\306\223\236\2039E\277~\322\033\375\226\214\236\224-zX\237\305A\241\022K_S#\361%F\220@\372\021A<"
+	.ascii	"\021\375\n\336\002\013\336l'\342\211\212D\374\252\343\207\363"
+	.ascii	"\257~\246\370\f\0359\332Y\314\017\3658Y\377\274\352%\267\307"
+	.ascii	"#\364\314l\344f\017\f\340D\374\004v\004\035lX\230\326\017A/\364"
+	.ascii	"73@\003\001p\240gf}\260@\326\326\nz\037\347_1\267\375c\270\364"
+	.ascii	"@\177\223\303\023\r&\207\300\275\035\021\315\222\255?\337$\300"
+	.ascii	"\365\371\020\037c\311X!\254T\272\266\372\363\034\2005\311R\004"
+	.ascii	"\303\021':/\315Q\361>\337\204\353\353y\237!.e\311\304z\336\003"
+	.ascii	"\260&E\224/efMp \334\356\214\375`\211\330(E\335\007kv\306\246"
+	.ascii	"\220B\333DJ\344\312\242k\2008\311\246wd\323\377\235\355\200\266"
+	.ascii	"6MN~|\320\366\210\324\321g\b=$\375\203f\344\321\263\315\321s"
+	.ascii	"\360x\364\313\337\352'MT\341\254\007\264M\276xG&\275\360\203"
+	.ascii	"\002mm\222\276\225\240\020\310u\364/\372-\206\366\222\007\216"
+	.ascii	"\022^\270\341\371\235\177\361^%l\007\317\267_\323\353\374\316"
+	.ascii	"+\345r\376\345u\230>\347y\340n\370=\377\222LA<p\f\271\262\022"
+	.ascii	"\201U\250\201<B\025B\210FDD\222\024\244\220\016\201\205\3048"
+	.ascii	"\351\340y\021@%T\214QI\223\354\254\001\266+\276\200]\t\247R\365"
+	.ascii	"\030\325\351\035q\253)\020u{\f\214W\"*h\245~LF:\205\022\375\242"
+	.ascii	"?i\211\270]\347'#\221\306_ \004\325W\224H\266md\244\241d\341"
+	.ascii	"\274\t\270\340\030\215\230t7\002y\227,\264\001\261\037\375\275"
+	.ascii	"\221h;\177t\352\234q(\013\3510\025\323\260B\351A\364\027\037"
+	.ascii	"z7\364\032\332\313\352\240j\341"
+	.ascii	"V,m\332^8\310\324q\265\203]\035\267W\367\263{\027@\226\201\340"
+	.ascii	"\033_;[\361\002\215w\370t\237\206T\304\351\233\234\341G*\336"
+	.ascii	"go\201[5)vj\330;\232\314\225\313H\216\035\036\335\316\307BB\303"
+	.ascii	"\347\264\033/\236\021\207]\274O@\330`/\224\310(\316\006n7\033"
+	.ascii	"\224\355J^Q3\333[\213\303S\332x\260\375\306\3619\246\341\312"
+	.ascii	"\227\370\022> \220\260#B\337\311<\255lx\254\204i0\273s\212'\b"
+	.ascii	"\332\227/\016F#\037)\211L\215C';\3379Z\322nv\b\306\304t;\232"
+	.ascii	"\363A\212\271\330i\241n\2456\373\272#0p\304M\226\200o\373\243"
+	.ascii	"\301\314\275\241\272\216\033E\034G\346c\002\2103\262DQ\003zB"
+	.ascii	"\243\273\r\316\001$>\2115U:\325\216\215\325\243P)p\312>:\336"
+	.ascii	"\020\"\"\215h\005\342V\347'\254\332\363\357\253\324\322`\241"
+	.ascii	"~\221\301\020\022p\003c\344\303\023b`\257\344\374$\325\230\274"
+	.ascii	"\3332\n\367\"\350\2230\357\263Y\256iI\327S.\324*\324\367@\304"
+	.ascii	"\230\217^XHl}Q\317\0233\353)\326\231\031\177z\350\217\335}\207"
+	.ascii	"\240\346\035n\330u(\331\241\031w;\254S\016\245\310\254\233p\013"
+	.ascii	"\020+\023\326\220\2521`\200N\225\032\342\f\016\r\345\352\r\300"
+	.ascii	"L\315\3376L\224\235\245\261\337@O1\226/[\201u\035\tmt\200E\272"
+	.ascii	" \025\022YE\347\260sR,\025p\326\035.-kH\346-\362\313\004\264"
+	.ascii	".ZS+h\327b\225\240\3332\336\300\263k\370\036;\372\004\247\232"
+	.ascii	"\307\231\206\3649\231\243!\343\2018\013Y\254Q\342[\"XI\340\230"
+	.ascii	"\207\217\215*\301\013\250\241\304b\212\tn\237F\026\344\201S\242"
+	.ascii	"\271\277{1\033\363q\344\270\277\260\263\353B{\024\242r\353*$"
+	.ascii	"Ht\252+\311\233\207\033\344Ud\202\304\262(\272\214X\232{\226"
+	.ascii	"\342\327\035\025"
+	.text
+	.section	.gnu.lto_rotateItermAndAxisError.99.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\271\007\325)"
+	.string	"JG\274\017E`\336Q:s0\007\233\327f\016\023\344\351=\016w\361\004Q\276Z`\352\034\373\245\272\005\021\201\227m2\276Z\312\271\345\024\237\262\b\371\310q&\001\303;.@d\030\372\264\f\022\3472\364_\374o\204\020\271\223\f\357"
+	.string	"\326"
+	.string	"\352"
+	.string	"\314`w\225\333\216\264^\365\335h\275\332=+\346;\003\260\256q\202\230\233\035g\200\356\275\302^\022\374q?u\236u\251\325\215"
+	.string	"\024\005\211\200?\337Qo\210\267\323\255j\332\326\212\257kJ\277\270\334 \223\306\033y)\233\034"
+	.string	"\330\213\322 \2234\302\232\021\033T\242l\236h\355;>cYy\274\224\315\003\323`W\032\001\f\021\373\3235)Q\026\271\357\307\"?J\225\300\302l/\201\227r\310\207\206\244Hn_u\316K\227\254\0042\3637-\256\224"
+	.ascii	"\032\026\330\315\236 \212\226\020\273K\203oZ\3134\302S\207\325"
+	.ascii	"\211\005\371\252kz~\303\027\220'2\031\344j\332\240k\315\326\337"
+	.ascii	"\264\232\244HiJ\240k\315\0260\231#]r\373\252\323Kb\331\006&\257"
+	.ascii	"R\245{\357\261\334\372HbY\253k\272\367\262E&\225g\2443\177\n"
+	.ascii	"3g`^\245\004q\266\272\231L\265\276Y\224\315\311a\0031\363\214"
+	.ascii	"\263Q\355\356\275\024\370b>\206\310\017\273\3126\244\354\221"
+	.ascii	"W\371R\353\3257\211%\0379\262\243\235cv\032m3\231\377\255\253"
+	.ascii	"5&\334I\230\225\222\n\274\354\034\340a\316\300\253\235\177G;"
+	.ascii	"\373R\313\275\324\362P[\346\251\226w\251e]jyM-\253\251\345T\265"
+	.ascii	"\334\251e\333\226\237\300\007W'\371\254\347\275@\346\006\335"
+	.ascii	"6\225\355\311\303\374j\377\227\037\355\337\362\227}e\376Zz\275"
+	.ascii	"h\030\313\202\242\306\007Se\f\231\306\275/\274\260\261\036\030"
+	.ascii	"\316\370O\356\241q\231\367h\212\001j\332=\013\337y3\356qy\027"
+	.ascii	"\253\227\341\260nR\304\356\304\335{'\354\256*\245|-'\263\372"
+	.ascii	"\226\252_\345\335\r\022\303\023w\257\026\323\325?{\234\323\202"
+	.ascii	"\346\275\307;\307S%\302\311\036\351\264\2260a\217\344G\337\b"
+	.ascii	"j\303j\343\332s\020\334P3\325|\327\326\t\235]O`\262\247O\030"
+	.ascii	"O\327\305h\034]\332fYh\327L\356\245Y\225Z\005S\231\356k\037\017"
+	.ascii	"\356k\253\344\251\316\301}\255\324\002\276\200<ut\255\355d\250"
+	.ascii	"\201h\333A\352\t\320j\257\275\236\2758\034\206Bh\336{+0\237\370"
+	.ascii	"\233\252\245\250\333\337R\254xzZ\257\252\375\347\325*\313Arl"
+	.ascii	"G;\327}\3575\256\315|\026\241\037G\356e\013ss~r\334{T\220v\200"
+	.ascii	"\266vtD\271\342\026o\303&\355\233]\275\262\374c\345\336{\325"
+	.ascii	"f\262\204C\255\335\026\254L\316\321<\r\024?\214\243\206\303\026"
+	.ascii	"\312Y\036\355\334\017\204!\001K\241"
+	.string	"\314l\025\330~Q\326&\306\3150\264\214m\024\313>\234f\f7><\224\214(\032\027\210#\210E\252\250\236\224\213\247\0204\210\303\251\247)b\321\307- \270\030\326\020N\301\210\032\312x!\2441|\232!lQ\224\022B\030\300\304\032PE\341\024\221X\024\366\234\367\235\004\313\317\003\216J\333\261\257\214\314\016\240*\275\327\313\302\277<\256\213\235+\"*\320\352\034 \323\201\300 \260\013\374\35153\007{dhR\224\2055v0\320\264\267\231\305\256\327_\273\252\344z\312\261\021\251\335\351\304@\355iN\013\232i/\212\302\rq6\223yi|I\255\3169b\372\357\327/d\177\277Nj\243\257\345\231\241Nc(R\323\366A\3529r\270\034C\227\232\314.\016\250\003\202\n~\376\307\303\007\020 \326\253C}0W\267\270\316\344\310\356k&\377\354\274\367\036u\0222\347u\221\017\325\036^\253\3402\263B\366\236"
+	.string	"\373\263;\235\204Qd\200\244\250a0\245\230C\312\220\214\004#MRH\007\240\002\0211*\333\021@\251U\212j\244Ia:R\f"
+	.string	"\017C\033\232M{\341)\025!j\b\251/\332\3625\025\"\377\177i$\274\027\350{\tz\340\023\360{\f'*(\272\224A\217\324\346\013\225r<\241a\372\214\204\3338\230\023\\\236\274|\032\267\321\027b\3418T\251\320-\362\306\344\341\210a\rT\001\223G\260\330\271>\347c\347\001\241\241\311;\344\316#\306\202D\234\0026\261\343\023\033\343\333\023\r)a\367A\336\037\205\347\021q\033\322\202$\177\322b\344tr\201\021\226>\324\016\321E4s\263\017\177P\261~z\2521\212u\021\311\021\213\013\027}\300p\244"
+	.string	"\331\224lsZ\026\232a\224\373cu\363\001N\271\313w@)5\026\332O\307~TvC\316\327\023ie'\277\327gTf\344\261.)\334\366x(\324f\221\354{\370<\367\305K\272~\320\304\221\016\037\352\2211\335\365\337\016"
+	.ascii	"\355\263\362\366\302\323L0\304s\265\303\016\021@\215 \276\\\237"
+	.ascii	"E<\225\240\370,\255\300\021}\027z\320\324\213\016!VF\265\322"
+	.ascii	"\240\256\021\336\312[p\300\257\336~;\314\037"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.100.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`e\002\335\023"
+	.string	"v%\203I\320\322(\035\243\026\304mF\241\254:\013\005F\013r\247\017\216!\246\3711G&\222\2409\3325\262\315\246\320\2167\340\240\376\345O\236\006<x\246\216\004\301 v\203\233\375\250\177\004\nF\353$\023\350_\031l\204l\"wJ\001n"
+	.string	"e"
+	.string	"q"
+	.ascii	"\006\260;\002\251hwOlr\372\264\355\2578\013\232\355\003y=>\004"
+	.ascii	"~vpCK\273\273*\371H\370\t~@\370\251&N\273\030NP%\315\027S\036"
+	.ascii	"\330D\370r\272\332\305\223\316\303\020\035\016,\331\335\0339"
+	.ascii	"?\034L\351nRA\003;H\036Bt\031\300\021\034$\222\336\273\304\321"
+	.ascii	"\331\244\024Sv\3272\247\313\271O\267M\263\235b\313\020\001\323"
+	.ascii	"/\032\371\034M\370y\255\331\0311\005\331\310\321\346\325\244"
+	.ascii	"\362\330\327q\034\231\254%\354\007\375\252\324y?\352B\367)\224"
+	.ascii	"\026\247t\bJO)\r\252\264^Z\252\364\005\004P\212\241\373n\334"
+	.ascii	"\3450\006\331\337\234\201\342B\277\375\236S\266\205\354\373\346"
+	.ascii	"\254\374%\375\364\370\330\335\003\237n y\366\331XBp\371 \037"
+	.ascii	"\0052&(\320\261\273\013|\337\213(TXY\t?\237S\232\032\252\330"
+	.ascii	"\003\327$\"A\265Y-\341sSKnZ\263}w\341\220\333\256M\001\224\202"
+	.ascii	"J2t\223\302&\3073\320\001\242\00149L\250Z\343\2778\f\030\337"
+	.ascii	"\307\255\227\027\205\355\216\200@\374Dn\347\206*\217U*\225\245"
+	.ascii	"\267\343&\177\370*\365\270&\273\336\002\346\264\273\t\374\241"
+	.ascii	"\023\311\370>\017\263VLY\263\230\226\203\331\214\353\005\233"
+	.ascii	"\265T\\\\0\021\231\013\003\013t\013\212\213\013\266\232]xq\305"
+	.ascii	"XX\315\270X2\253\226\230l\205B\342\027\254\025[\315^\257\330"
+	.ascii	"\212\267\007\303\224\252\210Tl\230(=)\216\355\223\376\227\243"
+	.ascii	"\303\317Fm\340\356\256H\"Q\252R\033\202\212|.\245Sk\34386\205"
+	.ascii	"\262PT\226\036\017G\270\221\214\206\250\022v5\200\200\314Pm\237"
+	.ascii	"<, `\002!bX\036\025\"\2609lY\007\356\240\322f\013\204_\314fH"
+	.ascii	"3\305\b\255`\016\223!\205\327\372\271W\372\321\370\345\276\214"
+	.ascii	"SFk\326\240p\033\204\326\033\354v0\316\354\274V\263%\033\035"
+	.ascii	"7DX\3520!\254m\234\373-l\n\307n\230p\360\270\257Q@\016\013\013"
+	.ascii	"M\001\346h\030\347\362!\353\362\217qM1\252\216\007\005"
+	.text
+	.section	.gnu.lto_applyAbsoluteControl.101.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\247\r\005C"
+	.ascii	":s\030\031<0\246N\007\3709\372\335]Y\216\247\337\342\341\336"
+	.ascii	"E O0\316\320EF\370\241|\216\316.4\321\017\207\234\356\016\253"
+	.ascii	"\025\252\013\253\031*&\226+\016\244\376@AMD\310\226;\245\224"
+	.ascii	"\002\207\001T\001\203\001\200\256_]\347\351\376\353\216\323="
+	.ascii	"\247\273\257\233\332}\247\211\314=\330vQ7\201-\030\244\371\260"
+	.ascii	"\221\270*#\2030#\361p\353i@F\376\021\332A\311C\b\017Q#i8\334"
+	.ascii	"r\232N\327i;\355\307\310;|\212P\005{\3641\025\320%\274>\215\304"
+	.ascii	"\346\020Y[8m\2077h7\243\030\207H\267LZ\017$\006\317O\243\266"
+	.ascii	"m\033\364\345\027\305\276\217d\336\3433\342\333\264\236\263\335"
+	.ascii	"p\235\345S\233\246G\305N\333\346q\361\204\274\242\347\021\331"
+	.ascii	"\223\311A\261/\2673\267\232^\343\354i\0216"
+	.string	"\266\255\225>v\3326\215\213\023\024\373f5\025\333wm)\266/;\231\027-\325\3323\tx\324\2657\224\332\266e\276\226v\366\322\252\212jJ*\n\352\311I\331\224D\036\215E\"{\327w'7_\033\331\336\316zi\246\255\332\257\316\253\3004\025\230;\267/>\005&\220\316\245\274t\224\227\300.\016\305\245\237\266\frq'*\255\\\031\br\233kA*\336\264f\005\266\226 70r\236$~!\245\3641\352'\305\215ZV\230L\351\342\024\300\326\272s\203sb\224f\327\255@W\n\225o\320\025\013p\315o\013r\213[\263\332\266E\276\251\371\2722\230\353\343\244\375ZK\220\233\231\225*\320\225B\344[\232\377\272u\246\322\237\362\355\271b\355\251ui\276\366\266\2674w\342W\333\266\354loL\232\257\232\271\367\230y\rsr\031l\027>K\355\317\230\333\260\307\026!\233\222.|\321o\b\333\266\265"
+	.string	"\243\025\305\360\"\354\233h\375f\203\322\204N\267\246\343\346:l\337\377\366\353\025\203\344"
+	.string	"\333\242h\250@\202[_\312\020Z\006\353\337\231\364\0205\241.$\203\233\216i\200\201\261}\375\273\270\300\241y\265\335\013UO\335\277\224\251\314\354\006\372k\350\371I\363J\314\034\326\201\230Zl\333\226\002\367\237\006$\306M\327\227q\214y\263\215\261}\373]\304\025\036N\321\274\312\234\367\364\2272\367W\253UL\374X\272G\\\347\020\327\371C\207\316\323\314\241\377\232\2776t^\267W\307i\326\320s\23234\265\031C\337i\276\320\323n\013\355\246\273\302u\216"
+	.string	"\241\373\232\037\034\235\231F\347\256\353\314u\235\035\260\316\r\216\316\f\214\316\013\256\263\202\243s\002\2433\202\353\274\305:\037\270\316\006\256s\201\353\254u\235\263\2563\201\353<\340:\013\270\316\001\2563\200\353\214u\235\257\256\363\362:[]\347\252\2423\325u\236\272\316R\3279\352:C]\347\247\353\354t\235\225\327\271\351:'\213\316\310\242\363\261\350l\274\316\305\353L\274\316\354u\276D\347\365:?\353\354\327\271O4e)|k9\276\266]R\275\324\006\207\344<r\252z"
+	.string	"\017\365\354\320H\317C\201\216\364\224/e"
+	.ascii	"\202\355pP\b\351\004\007\371\301\372\345\003\370\307\004\235"
+	.ascii	"\203\360W\217\365Wo\034\352jW\337\177\\\246h\376t\264\345O@\344"
+	.ascii	"W\365V\337\320Gh^e\343m\265\352;\260\327Lq\325\246\225\370\240"
+	.ascii	"\247\354\261\231\"7|\003v\317\355\261QR\354\360\020\276\315Q"
+	.ascii	"S\021pf\017 \274\331\250\276\t\017a\002\364\374\263\270\344K"
+	.ascii	"\331\217\032\276\251\2221\303G\360\372\b\277\341\277oE\276\324"
+	.ascii	"\217\217\205\313\021\225\221q\352\245\276\303\277\241\210\276"
+	.ascii	"di\352\275\270L\223/\365N\203\250\360A\037q\035\276K\206\212"
+	.ascii	"/ev\315\037\313\341\007\354\255\231\336\257\177\360m\314\314"
+	.ascii	"Q\377\344'\371Q\317Jr\372\247\367\276\007\257|\247_\007I\364"
+	.ascii	"!S\213\224\224\337\323\270I\207S4\342K\231\373\360\201\252a\037"
+	.ascii	"K\323\267\025\275>_\237\374\246\177I\320;I\026\270!u\244\022"
+	.ascii	"'R\244`"
+	.string	"\373&\277\357\342$\235\361C\343\360?7\007j\367\365\r\330(\256\314\361A\355Zn\311!\235\333e,\362\233z\211\216\277\276Y\203\313\360\307\277\205\326\246^\257\341\215\217\324\223\253\256\241!\376\205\327\360/\007\tj\367$~\206\271'\265yMk[4\003\030\236\370Vzr\214\240wO\2572\373\030\336\r\241\224.\374}\366\211\206P\273\347\375\252+r\177\254\374\177}f\026-\274\003\234\243\313G\016302\346\21622\262\2620,\b\021\2227x\230\270\301c\204\017d\030\0302\fL\b\030\031\0166\fl\307\030\031\016\266Y\326l\202 k\212\231\215)\315v\214\225\3610\023cacL\205\331\016\261f\363GX\224\230\031\330\212\262\346\020\034E\037cB\300V\016\353\2621\306\203i\226\003\307\230\216\033\314\035c`d\314\260\246\017f\327\222\313x\2105\231feeM&2\017\255\037\013_\367\221De"
+	.ascii	"\241\375\223\327%\363\2778\353&\020\322u=\363\211\\]\016\236"
+	.ascii	"\353\211\230|\213kq\340\307\211\n\335\232X\275\324P7x .m\360"
+	.ascii	"\355\327k\243(\235\303h\025\203g\346.\277\342\254\333`e\3013"
+	.ascii	"\370e!\005\013\024\374\022\023\024K0M\215\352\245\274u\357\344"
+	.ascii	"I3\325EX\013\177\317\362\224\221J0\305Y\347\265\305\243.\305"
+	.ascii	"\031\306\211\347\034\343\034\303\366\b\301'\370\245\341Z\246"
+	.ascii	"\003\276\365\314\3163\3164l\263!\370\254\264?\253R\f\361[!\354"
+	.ascii	"\242{\317C{w\317\td\216 \211z*~\017\206\271c\344$\340C|\333\203"
+	.ascii	"\226\301\036\370\316\342O\016\274\220\350\336\0318\003_\340\r"
+	.ascii	"\374\033\032YT\340\177\213`[T\353\225\204\315\366(\304g\275\326"
+	.ascii	"\257}\320\271\254G\023}\363<4'\n\025\340\t|\361\351\245\034\343"
+	.ascii	"O\t\365-\330\306*\202\323&\253\377\360m\004^\300\367\340\207"
+	.ascii	"\037\360\004\376\206\371\022%\003\276\251\210\246\001^\300\032"
+	.ascii	"O\322\026\340\017\247\037\036\tS\255\266\034\251\024W\325\013"
+	.ascii	"\201\f\250a8\350\fB\246DFDD\222$I\007A\005\304 \351\260\343\001"
+	.ascii	"\0210!D\320\315\210H\222:\303\030\230\216\204\362{\276\301\357"
+	.ascii	"\251\t\310\256g"
+	.string	"T\276D\025\300RH\004\031s\351\264\350\213|\315C\354\375[\250\316(1\341k\n\373\004\301!\312\366\352\335\035\365xh\336\3126\"\363\317@\245\006\033Hg\027\022\344\032\317\243\301q\245\b\210\340\327\3661\260;\247\034\n\204\202\270\034\214\205n\310\214\033RhCD\261T\373\235\214T\326\321GE\022\335\372\030C\260\345\275/=\022}\247\024\030a\310\f\022\211\200\243\007\022\020\212@\261\217\232\262bF,O\306\266\373 \006V\346u\256\033\341\360\370\354\035\031f\346#\317e\335\332\247\253\202?G\302[:K\262L\024\300\001\312e\367\276\005\323\317\231\256\213\331\r\361\366\021W\023\230\215\034\220\241I\321s\316`\365\244q\366\214\266\320\bI\302\033J\367\216e\372T\212DZ\001\277\017\221G\245\360\311\003\003\366\250\032\365i\372x\3061\356\242\b\351`r\251\fH\305Y<\326\361\225\t\353\346)\\\215\276\212"
+	.string	"\260\004"
+	.ascii	"`\bG1\2113\315N\372n\216\200\306\232\317\206\005V\217\001\223"
+	.ascii	"=\205\037\303P\273\2019\323\357\"\356gE\002\031$\020\263}\027"
+	.ascii	"\275\032\242\3308# {!}\302\017\324\334\301\244\336\271*kd\315"
+	.ascii	"\200{2\262\302\032"
+	.ascii	"\024\022<H\022\214ZL\226\200\342'+\371\306\177\024(\b\302SQm"
+	.ascii	"\224\373^D\320Jt\370\031\331gN\022\222\232\244\244'\b\376`\033"
+	.ascii	"yh\035\371\216\261)\246\207\233\360U\3244\\sx\261tv\030GZ>\367"
+	.ascii	"\302\n%\231\347\270\346\256\260\343v\371m\204\364\344Yw\351\n"
+	.ascii	"\022QB\36008\215U\241\206['\266\364\374\351\270\236\001\375\""
+	.ascii	"CG\253\256\225\314e\212\371\377\226\311\352\005\352\320z\034"
+	.ascii	"it\236d\215>3\231\301\017\320\2713\363\344\220_BA`U(\312\207"
+	.ascii	"\032"
+	.text
+	.section	.gnu.lto_applyItermRelax.102.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\242\t]2"
+	.ascii	"\332V0\023E`^R\007sn\223Z\30485\031\207\337\302\240\316\033\374"
+	.ascii	"\347\031\021\030\202\313\232\033\343\335\233\213\361i\266\212"
+	.ascii	"\207\252f\252Z~A\322\210E48\241\\\331\200\242\320?\f\254 `\025"
+	.ascii	"y\033\333l\223\275e\222)\005\"\001\006\001+\001`\32199\347&W"
+	.ascii	"{D\307\351a\370)\016\267t*=\347\304\234\313\254\324\345\374\366"
+	.ascii	"\324\r\336X7\256R\260\212\371\232)c\033\233\223\340\276a}\321"
+	.ascii	"sb]m\277\335\356\304\237,\335mF\377r\026BW\227s\363\251\t\260"
+	.ascii	"\256\036\371qu\025\273qu\265\227\335q\220[\231\251\200M\214\013"
+	.ascii	"./\347\f\365C|\351ED\310!\241c\220\261H\004\372\031\372\b\203"
+	.ascii	"\300\037\353[U\374w\331\356\203\360k\277\230^\304\304\211\332"
+	.ascii	"\034\331\266\344\016\245\271P\032\332=\036\361\240#g\327\330"
+	.ascii	"f\344\026\221\210@\330\300\234,w\374\356Y\004\037\275\320Z_{"
+	.ascii	"\022\271?.\004,\352Cl`\f\037\305\256\317\3323z\205@\326\236?"
+	.ascii	"n\320\263|8\320\307\317G\217\313\256=\241\327\207\213\356\236"
+	.ascii	"<0\023\327]}\316\221\356\236m*6 \026&l\370\265\205\217f\310\336"
+	.ascii	"`\314d\206\354\315\360\253\211\213\304\302\204\005\277\234\367"
+	.ascii	"\357\236L\360Q\316\331\345\374v}i\335\353\203\220s\356\333~\201"
+	.ascii	"y\003\360n\307\353n\030\335\254\203W\316\231\207\364\377\370"
+	.ascii	"}rN5\255\177#Y\324KW\361\372\337\357\036A\342z\213\364G[\317"
+	.ascii	"\354v0/\214\326\264\335\r\301\277H9\034\203)\367B\345`M\316y"
+	.ascii	"\201\235wA\321~\246\342z\253bu\365\276\267:|\213\204\246c\317"
+	.ascii	"\332{nu\325\237\006\224\213T\315\025h\326\235v\2771\357\233u"
+	.ascii	"\373O\247\323i\177Y\267Kq/\340T\334\007\370\233;\023\276\275"
+	.ascii	"\344u\336Jn\305;\311\261x#\271\233\273\221\307\271\013\370\335"
+	.ascii	"\036bo\013\371n\037\361\355 \366\266\321w\273\210o\023\331\333"
+	.ascii	"@\276\333?\353\355!\276\355\203o\013\361\355 \276\r\\o\377\360"
+	.ascii	"m\026\337\366\341\333\353z[\305\2671\276\375\352\355\213o;\002"
+	.ascii	"\025N\274p|y\264J\316^\323<\271\214\252%\315\353\334\255\270"
+	.ascii	"c\361\357\246k\317R\327t@YA\262\223\327\0336\264\027>\327\035"
+	.ascii	"t\325\375\212\313u\020\013\026\316q\256\306VD-i\005\313s\255"
+	.ascii	"O\201Gz\341\027\361\214\340q\252i\031\325\230\352\001\221\361"
+	.ascii	"\337\253t\354\360H\331\364\230\034Q\320\374\004?h\215\267u\226"
+	.ascii	"\036\370\301\307r\300\007\222\031Q\323\205\340\355\b\3340j\375"
+	.ascii	"\275\273I\331\200\3608p~\357aP1z\216c\213\234\250O\223\017\375"
+	.ascii	"\017\035;5\3226M\346\306\030\025\341\233\365e\233\374\376\232"
+	.ascii	"\334\201\323\013\016\240\223\017}\227\031W_e\332\251\221\006"
+	.ascii	"\337\254\335"
+	.string	"\273\256\316\216'\300/c_x'\035\303>\021\232.\265\201\027\022\264\337\337a\177\366\260\201\307\372\336\367\244a\232wo\271\346{l\327\345s~(\t\363\275\031\323\373\234\337\274\033hL;xc\350\224\224~\351\237\340\234w\326o:\277Jo$\306\251F\347X\322 \t\222s?\230N\3574s\316RJ\372\365=\213\377\242dQ<\3165\255;mw\203B\271\261b\241\333m</p\364\250\327\343H\3314\357\236\357\330\362R\303o\3463V\243\377(vJ\244b\232w\317\337\243V\365KH\3334\357^w\213\3601Q\254\030\365C@\273\264\271\341O\372%H\334\023V\032NXYp\021\274j\221\254\262\272\242\372`\"\311\341\252\005\225R\371b\252\250\254R*)\f\251\256\244<T)e\240`Y(\251\256\222\252\213d\f)\334S\007L$\255\240\256R\240H\2568\001\325\")\305\002jJ\351\002\352"
+	.ascii	"\262\253\254\250\224PWUUJ\250\340[\366/c\335<)\223\365Z8\347"
+	.ascii	"\234\213\226\356\200\027\360\005\336\350\273\227m\313&\327\333"
+	.ascii	"v9'\306\271QR\206\353\2317\347\314$\022\2725nk\343z\333\255\307"
+	.ascii	"\027\n:\006=RO\0274\013\331d\310\370t\233W\253\370Fb\361\217"
+	.ascii	"\232\317\354\246\363\270\341\322\023\037\251Gh\317\207\257f\351"
+	.ascii	"\242\344\b\364\335\355\344\323\345\223\007Dr\316\f\332\365\370"
+	.ascii	"\236%\224\b\023&\264u~\036\350\221h\270\366\004\270I\337]\341"
+	.ascii	"\302\352\355\317\257cA\232\317\364\243\250\0350AL\036\265\016"
+	.ascii	"\337\223x\236\353E\265\237u\206\r\327\333\r\253\253\303\367'"
+	.ascii	"4M\033\217*F\225\331%M\312\246\370f`\3203K\362\036\264Q\336\020"
+	.ascii	"}\260\\[\007y\223^\370\335\035>\\\017\200\304\250\2014\345\f"
+	.ascii	"c\212dD\264$I\n\215\001\260\002\221\251\242n\0208\210\246&I\322"
+	.ascii	"\001\357\201d\230gQYuv\202gb\245#\376\227\tp7L\305X\305\264\253"
+	.ascii	"\345\260\033\321\020]&\372\277\377Xp\344/\032\033\306r\030\224"
+	.ascii	"\257\350\256\272\257F\n\020\262N\200\004\260\\\355\256ER\037"
+	.ascii	"C\331\221\270\327\022&\347\332\\I\242\373\3652\016\003\360\326"
+	.ascii	"o\206\021\270p\200o)~\244\nV9\035\207\3212\025\225N\272\327\203"
+	.ascii	"\367\366\2265\263\370\372Rb\312\276\330\337W\214D\026\025\300"
+	.ascii	"_\275B@\340A\310\016\013\357\006\373\226,%d\241L\261&\"\221e"
+	.ascii	"G\2167\207@yU\005\264\345\346\002\2549\366b\377&z\212\016\333"
+	.ascii	"\272\353\\\355\240@\300\260\r\203A#\221\314\304%=DR\374V\204"
+	.ascii	"a\226\230\201(\362\220\342\276b\366\332\325\301\016\016 \034"
+	.ascii	"A\"\376\256L\001\241\373F\005(=\354b4@\235\331F\254\312\267_"
+	.ascii	"a\034\031\222H\2447\3675\346\256\242+\215ed\t\024\264\361MX\211"
+	.ascii	"\002\373\352\332\005N\377\002\017\344f\323\362\245\265\263>\340"
+	.ascii	"\256G\3368\032\016\270\002\361o\370\272\312\364\222\273\210\257"
+	.ascii	"\337\210Fn\215\004[]\350\226\244\255\260\017\257\352\272\267"
+	.ascii	"\210\361\232L3\302\357\315Z\267\226\347B\374\357\n\325bn\177"
+	.ascii	"\034R\251\243\023nmhJ\346\355@\322ZE\307\325\377"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.103.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\305\n"
+	.string	"\266\224LB \307*\035pF7pR\f06\201\216\3443\021\341\t\375\343c\200\224\352\007\252al\036|J\013m\215\t+01\211v\200\316`\007`R\205\033\202\002\033^$\260\266d>U\307\244\222\275\367N);"
+	.string	"6"
+	.string	"7"
+	.string	"\r>S\331\215\013\203\226\200\007\273\373\315\224\213\247S\212\376\302\230:\365J>)\304\353\004\002\303\270\242\034\004\267\326e\227\"#K\312\004\317\356Z\272F\222\273\336\266\205m\n\373\r\001\273\236/\373\261\237^\372\235F\301\200\361,\tvGr\021\366V\013\264dl_\332\207y\214\370\230mV\330=P#\260\273\023\226\360^9\177\350^\351\035\272W\213vs\302l\263-#>3h\013X\022g\373t\232m\336\356V\370"
+	.string	"\036"
+	.string	"\304_yu\bJ\336\365\352\243\272\327\317\313N\r\2308x\211\251d\316\236\255\344\204\331\247\273\001!\310\024\n]\204#\020\b\236>\032\177:\032\242\322\027rl\210:B\337H\204\341\361}@\323\327\331\230T\002\201_H\"\201_f\246\372|\331\243\232+\352I:\355\017\223\274\313t\246\216C\311\325\002\r"
+	.ascii	"2\003\3269\004\353\245;\354%\264U,H<p7\016L\271\004\333\254\246"
+	.ascii	"\210\273\334T{40\265\007"
+	.text
+	.section	.gnu.lto_pidGetAirmodeThrottleOffset.104.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"m\007"
+	.string	"\022\31636Po\322\001\240\234\n\005\200j{\360\021\024\204p\022\211%\352\254B\177\204\302\326$\037\177k\032\361\f\220\217\3122f\210$\257\253\2714\206\227\007\242Z\262\267\224)\005\356p\032.O\004E@\\\022\017\221\342b\230\210\235\354\0239\005\306<\016Y\004aX\026\255n\377VI\251\233\221f\330\256x\212Q\b\366\347(\026\004\245\335M8\364O\336]\370\246Cc\204\362\333\241\037\252\016S\001LF\231\262;Q\252\207\375\267J\262\237N\rpy\341~\202\331\345H\315l\013d\001\261\255\331\226?r\022\315F\275\256d2\b\331\320X\221\331\335\270\371@u\370.P\035\352\307\265\247\346\277\344\013*\247\230\215\023=5\n\273\353\334\270\216[\177`[$\n"
+	.ascii	"2\241{\037X\301D\225\227\273]\023\205C\340\230\261\211\273\""
+	.ascii	"\315\206w\335\033"
+	.text
+	.section	.gnu.lto_applyLaunchControl.105.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`c\005\035\""
+	.string	"\346\275\327C\200*Q:\311\272\342jE\350#\306\213\341\331W\377`\250\035\245\330\245\327xOO\260`\342A\365\201~ \200\to\306\375\307\3321\366\362g)w#\254\350\363\tlP\342\2470\215o{\322\b!r\247\024\306"
+	.string	"\257"
+	.string	"\313"
+	.ascii	"U\302K_\240\324~\325\303,]\214\217["
+	.string	"\200\332\263\n\222Uk\325\221'T\235>=\225\3258V+\0243Y\265\326#C8_\332\366\301|j\311.~pr\n\203A\252\312\223\260P\255\025\267\3406\363%y\002\346\313\225\362\245\317d\261\023f\226\344\322%\037\266Ax\017MT\305\037\220\367\031\003(D\240.##\374A3\3506!X~'.\241\261\256!J\310@\321\2234z\300`\313\220$\024\266\240\326\372D\315\023\317\240k\b\224\217\226GN\22269Q{j@'2B\0238Ff\300\036]\262\202S!&5`\023I\373z\362\272\360\364\007\260G)lC\255\325\364\007$r\323n[\217\355\022v\231 Y4\316Z\353\005\377\314\2136|+/\235\224\203\376\227\303|\371=\242B\305D\217O\222%\f\327n\320\023>`\227\027\307\216\025\236\036\375\262\253\232\350\006\355\357\361x<z\243\330F\307\272o\277\272\017\\\314o\300v\252\177"
+	.string	"\200\217\271k%uQIM;\365\254\244\226\225\324\261S\237\247\206\231\324\346\251K\223\232$\251\267\244\246$\365\023\024}\021\201\377\302U\253\220#\242j,\265\262\034\353\277\372\307|\355\333/\343\023=\303\362\222*z8\031\317^^\365\220\323E\252L\206\017\355\031\265\227|\241g\266\307\270\370J\244R\343\036)+\177j\r0/\021'N\251\265\207\301&\3619%\316Z{\027\272L\234\270\360\216\025\037\346KsO\244\242En\271\177J\304D\217G7\246\260p\247\326\212\301Vq\256\025\024\356\304\371\026\213\026.\\\354\311\274\324\202\242\343E\213\211\036]\341\312\023.\347\006i]V[=\372E\315\306I\210\026\330\006M\303\\\244\273i\263e\027(/C\307\362kb47\350\017\377 CBT\244m\213\206\202\316\254\213\rj\373\343\3027\340mI!\313\253"
+	.ascii	"\275\242\265y\210\002\303\345\333\342@\266Ek\016r\361&kej@W\266"
+	.ascii	"\246\276@M\364\350\032\035\260vN\006\375\217\356\207/P\250\217"
+	.ascii	" coy\246\202\212\260yC\3764\314\357\001Y\345\261\356\001HJ5r"
+	.ascii	"\035d\034\224n\344v\273\035/hJ\271\335\332\320\355P\344j\310"
+	.ascii	"\270\201\024\323\241\343\201D\372\005\005\030:\0348\245\0312"
+	.ascii	"t5b\340n\350\220l\340^\354t\340(\334\234\204#\267\303)%%\355"
+	.ascii	"p\263*\246\223\025V[\307jk\262\254\335\310\320\320\231\363\304"
+	.ascii	"\037\311\360P\023\231\321\2324k\013`\177\330\006 \300\350'\215"
+	.ascii	"\221i\233f\nhm\315\333\332 B\320\377\214\026\007d\320TM\262\274"
+	.ascii	"s\n+J\266A\367\270\223\363\266%ok\316mO\374"
+	.string	"\210\250\251\243OK\023\2025Ynb\033\364\201\245\355\316*\316li\273j|\177vgK`\316\024\027\261\016\027'\032\216\307\257\330\036X\312\307\267\345\334\330\032\t}\177`[\356\2710\241O\213\271\001j\250q8\003\225q\306dDDa\222V\306`\002\231:\233\007\020hF4M\2419n\"@Skh\203\344\262\234\355\0300S\347\f\204I\"\006MV+;\207\003g]ga\234\320\274\013\027/\206\201y\201p\335\\G\221>\260\n\t\021t\361\024\242i\003\261\332B\326\034\220=\261F\335\221)h\201L\217\211\003V);\207\324\305\231Ch\221\301\364<\177v'V\3054M\212i\376`M\361\323\f\261\257\017\374\236/D\330\260\331\205\345\2713\253{ G\234\bS\260(\372\251Q\360\247P|\301\"\220\021\226\316\252\273\337\rMD\270s\261D\207#V\001\2273\256}\373\2221k*N\177z"
+	.ascii	"\323\001\251\336\263\371\203q\306\324\346\354\254\205\373a\210"
+	.ascii	"\273\275g\243\205\";\305c\332\201\036\025\367\237*"
+	.text
+	.section	.gnu.lto_pidController.106.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`9N\2257\001\n\025\246qM\020\030h\351\f\007?'\306n\227\313V\177\326\355\013\027\301\364\351\b\035\223\004R\240V"
+	.string	"m\222\276\274\035\033+\004\261\330jx\033\262\316\217\034\270\231\357\311]\215\231\214 \020[x\322u%T\034\247\021\005\347W\353\033\1776\323\366\2262\311\357\006`\0069\007!$\300\013\202\020\357\007*\257\007*o\007\315\313A\363n\240\362j\240\362\356Pyu\250\274\031\250\2749\232\027\203\346\275@\345\265@\345\255@\345\305\241\362\3360\301k\303\004/\005&x'(\342\225\200\2107\002!^\b\212xk\020\361\322\020\342\235\241\362\312Pyc\250\274\017\250\274\016\250\2740T\336\027*\257\013\225\267\205\312\313B\345m@\345e@\345]@\3455*\342]A\304\253B\345M\241\362\242\020\342U\240\210\367\004\021o\002*o\221\020/\221\312;\244\362\232Py\205\206x\021\030\342-Q\202\367"
+	.ascii	"\225\227\204\312;\242yE\b\361\206Py\rh^\325\004/\210\346\375"
+	.ascii	"\300_\337\264\004/*\304\333\b\360r\t\336s\237\003\201iuf\310"
+	.ascii	"\232}\207\266V=\007\327\271\024\316\226\303\235\217g\250\363"
+	.ascii	"\327y\312y\353\254ufr\276:#\317I\316J~\274_\357\347\363\363\375"
+	.ascii	"~\377\337\017\370\377\371\233\277"
+	.string	"\340?\370\333\375t\277\334o\346G\363\253\371\331\374m~7?\234_\316?\347\0070\t\036\301\"8\004\303\330=\203\255\272\214\363\326\265\354U5\027\007\013K\341\256=\223\2606_\226\243,s\255\272\265L\022ORV\031O\232o\340\266\202\240hay\023g\025\364\324\311\256\272\313U\313M\030\213\257\360\230\215q\372\255\353\332N\314\004pL ?>F\302V1p\325\362\350\002,\\\236b%L\265*]\2361w8I\234X]\020#\227YW\3304k\362[\f\313F>.K\361Sq\206\027.G}\230\302\327\204z\332YS\345\017.\263\304\312uR\270\250\361[\327u\306\323\335\031\226\237V}:\003;%\3013k\242\tz\272\267\373sW] /\334\032\272\230\315\273}\336\367|\357}\357s?\017<\240;\037\350\204\253\016\206\271\343E\360\314\217\2614\305\214\361\363\nz\372GL\033\277u]\257"
+	.string	"\231b\353j\305Q\177t\372\370\211\331\023\307\207\304\016\2371H\2617AO\365\226978\306\nZ\320S\2748eez\212\036\322\340\334,\220]<\373::\032\2762Y\031\217\016a\270\374\272\004\275\355\347\212\350\212fE\277\336\346\314\276\3349\334>n\325\335\275\235\242\322\337\266\2310\301\222f\353\272\252OwOgog\325\247J\257\263mFPh\353\222\034i\374\264(\355\252O\325\335\342\376\314\323|\315\331\316\374\233\307y\333\335V\235C\203\021\024\332\212\005\304\027\2329\263\346\272\256`r\346\234\300\031\202\256Yk\327\251i\232}\371S\220\233!_\217\253\221\30120~\353\212&\244\r\221\257L\326#\001+\013\343\267\256h0\260\021tA\3152\321\025\315\305\312\b\305\326u\215\361tW\b\272\332\327\212GS\304\b\nmu\032\326\275\275\2315\327\325*\306\323\035a\316"
+	.string	"\tl\024o\346\210\221\023\332Z5\374\272\343\306\254\271\256h1\236\256\006AOw\227\321N\246\37027\354\207u\365\"\224 \350\251\021z\336\275\331\305\024\177\326\364\003\326\025\354\315\315\272\242\315\330\027AO\027\355&\206O\203\216\300\360\351\026w\371\216\266\\\213\310\372\244\3164\327u\255\321U\356T\270\316\355\243h\337\025i\361\177\272\323\327\033\367\271\205K\270\203\033h\005\327\271\315\005\264\1776p\001\327\317\376m\237\365\333\276\345\333\275\345\263{Vo\363\026o\357V\317\332m\236\255[\272\305\263s+\267q\013\267w\326\316\326Y:\373\266n;g\333V\316\306Y8\373f\335,s\333,\333\262\3315\253f\323,\232][\265=\263f6m\313,\231E\333\241#\203\034\030\\`A\0058n\330\240`\002\t\"\200\240\006\215\0312b<\340"
+	.ascii	"\214\027.Z\260h\200\201\005\214V\250H\201B\201\023\t\024\021"
+	.ascii	"\r\231\020B\240\304\001$F\210\ba\200\n\342C\220\207a\2126\027"
+	.ascii	"\367\0364P&\345\220K\234\376\247\307E\345\300wR\"\371W%\222\337"
+	.ascii	"\210\0329\361\212\232\342}F!\031\214\220\267\260\360KH\342\253"
+	.ascii	"\360;\370\f\024\310m\220W\020%!\210B\260\300\230\325\032^"
+	.string	"'\335\227\363\333\004\264B\rY\334\225\327W\363\373\247\217\2177\260o\217\027\220\317\327\017\237\344\036\336?\275o\237<)z\274~x\337>9<^\276$\2378\336=\270/\037\024^F\270!/\343\035\336=pvx\365\362<h\200^y}\325\371\342\275}\357\336\206\274\214L^=m\276v(\274\214m\240\260\361\346AO\320A[\260\341\255\363\240\201\232(Z\256\274\276\326|\351\326\250\341\305\263&\r\357\234\334\030\336\2703^\270;h\314x\355\210!\f\303[\207\016\2322\33674T_x\335\320|\347\240\321\302\333\266\205\251\262\360\312\211\263\274\302\013\007\205\227q\311XVx\3374\200\345\353f\371e.\273x\333$\277lI\306\342\342e\263\365]\2635\344e\214\302\253\006\205\2271l\310\313\b\2057\rc\035\335\3622ba*-^4Y\337\265,\246\252\342U\033\3622\202A\341e\244\342=\203\236"
+	.string	"\203\266\300\363\305G\t\257\031\364*-\311\267\f\n/\343\024!\222\227\214\220\327\027\222/\032\n/c\016\317\243N\274\214Hx\207\216\347\230U!g\360|\016\302A\306 \320/\b$\310\0268_\201\263\3118\234tV}|\203\3576\370\366\230\002>\237\200\317\036\226@\357\021\240\017\370\275\371\3631\253=\250\211*-\310\323Y\3451\004zx\\CO\216i\320Y\351\315\200\273\f\024\206\322\r\314\351\254\356\240Du\226j\037\263\322\343\030v\342\370\201:v\206&\254\264]\271\227\025\\;@\3470\336\376\342\355.\320\023L\264E\033n\361\306Rl\314\0025\242\203\032\021\262\341\006\364\034\rSGj\355\312\353\313y\006\324|\001\324\310\316\234\324\351\254\324\240+\300\272\234i\330\b%\201\006\205\340\013\257\240\302d\314U\244\020\303(\320\b\230R\bE\210\311\031_g\306\n\234\375\304\031\030N"
+	.string	"\205!\350\007\347tVaP\242\250*-\257+\343\242\271\247_osfN/&cN\264\345Ch\2132\3019\247\263\332\202\236P\213\262\242\205Md\271P\026,\214\300\225\227@\037H\336\2712\201\347\213\317\307\254\254\360\001W\302\230\304\225%\217\270\027\023\256\213\370S\327Cp%\331"
+	.ascii	"\256-V\243,0f\225d\020\f\345\037\026\360b\322\365\240\217YAa"
+	.ascii	"\017ZR<\244\263\312R\227\0349\215:2z\365\026\261\304\210\032"
+	.ascii	"\255\353z\267\363\324\022(f\017\032\254\353\272\214\\\302\344"
+	.ascii	"{\250\357\202\300\262\3738\273\034h\t7\226\235E\243k\264\207"
+	.ascii	"6\266C\243\037H\nT;\255P\264N\354x\221l8\243O\245\257f\264\021"
+	.ascii	"\2566g\326\221\311;S\t\304\370\273t\223\331\273\322L\226\311"
+	.ascii	"\002o\311\220\221\316\263)\243\331N\253_t\372\216c1\372\201\226"
+	.ascii	"\321E\201{M\325Jb\364\333\302\316\034\350\007\372{G1\343\324"
+	.ascii	"2\203\032I#\213\034\021\373\372\206O\035\350\017r1\313\340<\361"
+	.ascii	"sa\364\323,\223h\271\256k\005"
+	.ascii	"\275\333\224\325\307e\322X.\261OG\025i\201\267\256\353\215\247"
+	.ascii	"\333\306\206\"\372!\006\022\001\021\001\r\237\302\350\327=\375"
+	.ascii	"\302\245\346\204\303\317\3473\257\250\225;b\255\253p\350\177"
+	.ascii	"\035b\255+\316\204Q\177\254\247\226(\2036\352\377\035\307\214"
+	.ascii	"\273\313\r\344\350\fz\370\307\310\317}\3219z\371\bh\344\347\272"
+	.ascii	"\350\026\375\242\271\355Y\350\242\257\226\307\242[4\nw\0243\022"
+	.ascii	"\235\035\360\221,\032\305\363\363\2343\266\223\215$H7C\255l\240"
+	.ascii	"_H\213#\006bg\263\201Na\353\211\205\016\2229\020\f\364\373\372"
+	.ascii	"p\013\264Q3\320h[ \340\002]#\354\214H\310\177\313\354c\3248l"
+	.ascii	"\021\226\235\231X!\203\373\210O\033|*zE{`K\241\002E\247h\017"
+	.ascii	"vz\313\f\312C\321o\223\367\030e\326\332\204\344"
+	.string	"\256@\303p\247@\253\2605\210\300\211\336\335\031lG|\342\300[\327\265\202\345:\316St2\026\243\242\206O\237@\237h\017{R\205O\374\334\034\\\324\273E$\305\251\341\221\t\264\021T;\3552/(4\242\213\272\350\f\b\2777\201%\036x\221lH\3245\300q\\\221l\217e\213J\212UU\303\247D-d\013\320P\357\026\227\260\235e\232\300\253\203\356!\377\230\377\332S\006m\307\363\th\242\207\204\232D\233\350\037\307\214\374\\\004Z\250\0258s\364{\342\347\032\311\372\266\rK4\002\275\002\356\2304\362s\017\350\022}\251\302&<\247X\245\355\200\276\236\274\021M\242Q\302cs\213X\034g\231pF\364\343\266\3768\317\016\020\321\375\347\t\2739\302\024\321C\035H\264r\357\366c\255i\235\005\355\211\f\027\rq\273\276\236\236b,\017\321/\244\345i1\233\"\331\232\020\255\302\326\237\262\347\3514F\266"
+	.string	"\313F\344\365\332\257\266\366\234[\030<\237\201D\264rw\037\002\314\325\356\3024=3|\346H\002\212Q\242\f\237\252\3753aYO\374d\242\347\263\320"
+	.ascii	"u\211\236=izj+\327\203\326\361\003\237\310\220h\355\t\237\207"
+	.ascii	"\237\310\360v=uv\020\275\264h \372N\266\366\312\262@\264r\377"
+	.ascii	"]{>\003}h\260\033\206\313f,\346\206=\226u\241\310\3055|\212\303"
+	.ascii	"V\337\027\300\025\317ga\020\203y\215\347s\320C+\217\f?\364\322"
+	.ascii	"n\261\213\313\216\004\255\353zc\231\214\277\024\247\354\261<"
+	.ascii	"\335\342WQ\251\034>\375\320-l\3059\321\214_\271\347\3239l\345"
+	.ascii	"\262^\367\222j\213\223\237:=(\026|\332\312\345^\346\327]\206"
+	.ascii	"Z\327\247\006B\f\226%\245\230|\271~\230\236\332\335\345.\177"
+	.ascii	"\337\355\r8\331\371I\323\203b\301\355\377\305\220\365\372y\372"
+	.ascii	"n?\200PJ\216\221\237Kb\375\213!\332\254\327\313RYF~\356\262\030"
+	.ascii	"s)V\331c\331bX\361\n\037\371t_\2742|\212v\b2vxI1YO\374\314R\354"
+	.ascii	"R\327.\326\260\374`\360n\221K\261\013\236^\261\206\205\242\255"
+	.ascii	"\344E3~\307\363\031\250\033l\213d\303\356\020\205iyP,\270\273"
+	.ascii	"E/|\245H\026\264\256\353\215e+6\024\313\202\326u=\226\247\373"
+	.ascii	"\025\206O\273?\234=\361s\227\253\360r\205=\226-\206)\212\341"
+	.ascii	"#\237\356\213b\206O\271\377\267\305,\313z\342\347\032\361\356"
+	.ascii	"\006\035\360\221\227k\025kK\320\234~\306v\332E3~\237\317\347"
+	.ascii	"\037n\345\356\367\371|\376\331\006\333-\301\313z\207\3732\336"
+	.ascii	"\341\276|\247\362\262\236!^\2663\301\313yT^\256c\250/\323\251"
+	.ascii	"\274\214G\345\345\271\313}Y\356t_\266s\273/\3239\336\227\343"
+	.ascii	"\250\274\374\206\247|\331\215\312\313j\254\365\3454\225\227\313"
+	.ascii	"\360\326\227\311\250\274|v\275/\233q\222/{\341$_\356\242\362"
+	.ascii	"\262\026F~9\013#\277|E\345e+\314\344\313a|\365\345%_}\271\212"
+	.ascii	"\312\313`\234\344\313_\254\344\313^\327\373\362\224\353}9y\275"
+	.ascii	"/o\361\361\313P\316\367e-\225\227\263\316\367\345'\367\373r\223"
+	.ascii	"\377}\331\352\177\276Lu\301/O\375\354g#\177}_x5\337\377\251\274"
+	.ascii	"\357s6\337\367\275\314\377\274\267\371^\317\333|ow7\337\3479"
+	.ascii	"\234\357\353.\347{<\237\363\275\334\020\357\307\250\274?Sy/F"
+	.ascii	"\345\275\231\312\3730\374\365=\030F~_v\275\357\277\234\317\367"
+	.ascii	"d\347\373~\207\333}\357\345"
+	.string	"f\276\327\341r\337w\271\232\357\307\232\367\\\232\367b*\357\2674\357\265\250\274\317\242\362\036\213\312\373+*\357\255\250\274\017\033\342\375R\210\367UT\336SQy\257Ty\017\246\362\376K\345\275W\363~\212\312{)*\357\273T\336'U\336s\251\274\337Ry\037E\345=\024\225\367ZC\274\317Ry\377D\210\367NT\336c5\357\257T\3367Qy\317D\345\375\022\225\367V*\357\253T\336S\225\340\275\022\225\367IT\336O\251\274G\n\361\036\211\020\357s(\342\275\024\021\357\217B\274\217*\342=\024\021\357\215B\274\177Ry\357T\304\373\225\210\267\250\362\022U\336&\225\027\007!\336\033\212xm \342=\242\362\032Qy\213\250\2745\024\361\022!\342eRy\207\b\361.\025\361\322@\304+D\345U\022\342\r\222\202\027\210\312\373C\345\235A\345]\200\312\233\244\362\312\240\362\306\240\362\302\200\202\027I\345\365\221"
+	.string	"o\017!\336\027L\360\036\251\274\nPy]Py[Py\023\240\362\"@\345=\300\020/\013\n\360\256\240\362\252\240\362\032@\345MA\345-\200\312K"
+	.string	"\225\027\005\225\227\207\312;\200\023\274'\250\274&\250\274%\250\274$\250\274\002PyGPy\003\240\362\212\320\274"
+	.string	"Py\003K3\316,\022\201\\w\002\340\245\031\353-\312\230\371\342,\315Z\232\237\374\303W\332\363y\0044z1_i b\232\306dy\363\301\n7M\204W[\222A\231Mi9\332"
+	.string	"\351\021iO@H'O\374\334\037\275\200\346+\335v\307\244\225\236\241\1774\n\270\005\364\f]\004\267f\2317\226j\212\310X\246Y@3\326\323\267\256B'\234\260\346e\263\225f'\377\260C\332\363\356\230\32424\207u\357\235A\327\324\222\372w\246\264\f}\242\356)\027C\303\320\274l\364\314\032jf\231i1\364\325\302\316\2524\f]\"\355\351vlFa\366j\244\336mZ\323\304\306Gr\2256B\321B\220\261\034\323\304<\023\257\351\rz\326\024\347jb\220\232\261\236\202\361\311D:\241Qh&L\204V\256\217\276WZ\034\nf\231/\332\320\262\")\360\276\370\350'\273\006\313"
+	.ascii	"p\305$4{\365\350\335&:Mv^\350\036\315l\250\227\027\372u\272\002"
+	.ascii	"\313\316Z\2109\245\204\220\001\024\332\233\340\206l\327Lu^V\t"
+	.ascii	"N\361\223\247\331\256\213\002\217\372y\315y\232\255\216z\261"
+	.ascii	"\353#WEM\314\310Ot\354\250yt\001:\263\274\032\001\315_\r\242"
+	.ascii	"\216\020\220\002\332\205f\257\026\361Ex\207\212\241[\024\320"
+	.ascii	"o\313k\241\023\320.4\263]=M\013\315\"\017\305\202^)\202D\354"
+	.ascii	"K@3\325\323\302\256\355\363\265g\r\204\020x\n\311N\267\346\246"
+	.ascii	"\344\203V\356\n\251\300\302\016x\253YH\005\306q\300\311\376\227"
+	.ascii	"\236Z\004\364RZ\234\034\272\\&\215*D\251\027T\210S(\226J\004"
+	.ascii	"\364\301t\351q\236U\361\277\3245\331\361\221<\245{\356\271d\204"
+	.ascii	"\366Z\346\213)ELH!J\013t\347\301\001z\204\346\255\356\300\243"
+	.ascii	"\230\021M.\363mMw(W\221\035x[\007\350\341\234"
+	.string	".7'\034v\372\332\243\246\203)^\241Y\350\246=M{|$'uh\026\272kN\332\335Za\341\235\2531\034\264r\0170G\203o\351?\377A\212\235.[\372v\240\320\\\327SM}\206+\364R\037\232\325\324\347\311\n\335B\327\234\262\272\336%6A\261\226I\264\274\"b\t59\341K\370r>\221\177\033\360h\025\372[\b\277,\t5h\345\262\016\316j\033R~\332d\360\261&Z\353S\230\343c}\262\236b\035\374\244=\370\331!\003~\322'\374\007)c\250\244\2309X\253\277\203\n\215B\377y\316r\202\267'P]\034U\033\240U\350\206;&S\350\002\264\001"
+	.string	"\237B_NXV_\023\240\013\320E\201\307$Y\177\207&@{\340\321(\364\217\177M~\320%\313\f\262\342\3215t1\235g;Z\271\213R-s\207\222\254\376\360_\355\321\t\352\b1e\320OS :\265L\n\360P$Qj\006\036\212\2048\245b\231\303\223>\241\213\315\271\031\264r\001\241\307e\252X\242Q\254\325't\255\225m\216A2\f\006\200\032\227\231\242\323\320'\"\326\020\352t#\233\320/\354\347\007+\360\232\002ua\023\341\357\020\236\320\003\350\242\224\250v\332\335\246g\007\":\t\236\320\037K\026:w\347\200\201\271\272"
+	.string	"\220\037\023z\227h\354\3462\211"
+	.string	"\021\261\204\376\204\351\022\332\204N\240\215\204\026@\227\320?\216\031I\350\035aQ\r\270\314\f\374\020\245n \351?\342\224\213>\002\350\003&\t\235gV=Bs\223>\341\b\375\270d\2403\313\202"
+	.string	"\260\b\035"
+	.string	"\021\372_\222}\316\254#\204\201L\325U\304%|\344\246\250\"\273\263f\265\323\356\320\202\354\252"
+	.string	""
+	.ascii	"\315V\370\354\001@S\020\206\343\017\240\301\263U\253\340C'\204"
+	.ascii	">"
+	.string	"\340\217\374k>\204\326\221\274sf5\351\274e\332X\256\353z\003\217\210E\343\351\266\236\276#>\321\"F\2112|\312T\315B\362\256\214\006~\341\235/<\341\266\tZ\327\365H\236\352\3475\035\036\020z\227\330E\234\302G.\272Bi\247\375\240A\350\341\027\037&\361\253\343\210\312\240u\205\272\261\rwC\223X\245i\370\364\203n!iWv\346A\277\311S\335A{\320\377\340;\350\233%\345\234Yv\226I\003\257N\021\027K:<\325,$\345\312\340<\335h\345\007\177\253\344\235f\023\312\006\007\307\323\0334\007\335\201\0334\210\272=kRp\214\374DB\201\0063\360\366\234\266+\304,|\244\006\215\272\021\0243\027\325Nr\234\222q\023\264r\273\315_\327M\006\320\217\033a\0319\022\354\220\201u\3646\2347\\\210]\370\310\035mt\324\321\277J\2569\021\260\343\264&\202!\303\327\265\b*\rw\366\204"
+	.string	"\203n/\315\306\006\203~\233\260\263'~2 0\204\2055.\350\013\022\311ZM\232\013z\006_` B\032e~/\335d"
+	.string	"\303\244\351\231qU\016};\314\260"
+	.ascii	"=\323\203+\350\3555b\030>r\373L\253\021\305\214!\2221\340\273"
+	.ascii	"7|\312\306N#\236\341#-h#\251v\332\017\276\202\376U\322\2143\253"
+	.ascii	"*\207\276.2\276m\303{\351\3679\321\376\272$\231\302\030^:u\352"
+	.ascii	"\253K\313;{\221\2709'&\\\327\365\351\0012\313i\313\227\242\360"
+	.ascii	"\215\221\353\272\256c\226\313,_\320\272:=)e\r\323'\266JY\035"
+	.ascii	"x\272\333bv\227\357O\006-W\253\025mu\340\351\365$Y\023#\346\364"
+	.ascii	"\203\342B\007Z\271\374\202\3614K\375T~\\\336\244\230.x\256\027"
+	.ascii	"eq\243\231\256\247v\231\356\251\025W\237\361N\315\037]\207Y\346"
+	.ascii	"\020\036\030#Y{\316-\0308\232\301\232\361\364\217b/\264 \223"
+	.ascii	"/\030\254q4\317\365\217Ic\005o\002\351\\0\224\306\200\214Z]Z"
+	.ascii	"\034\024\013\316\255\353\332\242\225\333\247q\364\013iw\240X"
+	.ascii	"p\031J\277O\017\277\222<\031\254o4Cif;\212\031\371\271|$\333"
+	.ascii	"\241\bq\215\330\307`\315RG\2738\251\351\220\024\003\007m]W\026"
+	.ascii	"8z\351\252\273,\263\005^\232\036+B\304\005G\337\t\027\237\363"
+	.ascii	"F\177\360'd\201\357\245w\211lD&\037y\243O\370S\221\n\203\346"
+	.ascii	"\364\203j\247]\327\325\251\201V\356\305\302\260I1\027\370\217"
+	.ascii	"\f}\204Q#\3054b0\277\016=\265\f\330\350,\315\206\374\263\321"
+	.ascii	"\375\006HK\007\2321|\013P\320\023\364\013\035\326V"
+	.string	"\210o\366X\266\0071N\234\341S\n\032E^\001x\227\350F\244\303GN\320*\244\312\304x\360.\021\216(\307G.\214?\200L\340\277=\r\261\357\306r]\327#\377\326`\304:\242\345\272>\035\271K\264\353/\342\035\013&k\257%\346\021\367\360\221\313?~\346\242\332\251i\324\312U\365T\260\\\267\036Q\214\277\313\f-iz\375|>\361\254h%\313\365\347n\200\264\267;\326S!\301\214\356JF\320\022DP\242\316k0Ec\035\202(\020\264\021\25698\266\312\332P\310H\271\354uy \236/8\005j\264\026\361\031+\003\r$ IL\t\254\f4\206\310\300t\004\244F\020% @\224z\234x\301\005\366\261tTdI\t\004\037HH0\250JKGB\b\222D\202\017\021A\222H\360Q\342\210\351\310\203#!\004@Z\022\002\"H\022\t>@\034aJ\352\241\364\003)\205\021'\224\bB\372"
+	.string	"d\t\211I\204!D\224\222j@Z\022\022\002\211\351\210\307\222\322\322\322\007@\226\220\230\222D \365\bB\004\201 JIL=\220\226\226\224:\030R\"i\004N\352 \310\021\017\206$\0319\372p\304\364\003\311\003\246 IJB\230\220P\360\221$\204\004\020\"(\370H\0222<b\372\201\344#\035\222d\344\b]Rb\352q\004\302\221\020\246\017A\222\204\240P\344\350H\210\037JKLA\224:\220\241G\020\"G?\020@\252!\211\251\307\006CD@\"\322c\b\022\217!Bb8"
+	.string	"\311\207\022\t?\220j@\372\361!H\322Q\b1\034\r\223:\br\304G\nd\t\211\311\003$\246#\036JKGb\b\201\004\344h\t\204\036<\212 \005\0011\244"
+	.string	"H@\222\b\300\024\004ii\211H\217\020H?\222`PZ:\301G\222\020\020\333\203\206\217$!5\230d\210!\351\007\f5\202$\035\001\251\321ciH\r\032E\253$\004i\251\006\223\222\322R\ruw\027\355)"
+	.ascii	"b\304\234~Om\334\"h~\267\037\360\247V\356\007\275\257\214\327"
+	.ascii	"\255wc\214\363\035\337\365\357\324J\276k\306\353o\245\001tL\032"
+	.ascii	"\351,\323\304r\370V\244\251\t\261\317\303\225\034\270%6\031\266"
+	.ascii	"-\223h\t\267k\203\330P\016\021K(N\334\271\fl0i\326\\\341\026"
+	.ascii	"U\365\025\304\232[\324\215\r\306\245\211X\3037n\270\364\335\216"
+	.ascii	"\002\206\001\232\250\322\202,\266r\031\3543\2544\275\260\027"
+	.ascii	"\305!\355\203\001\323|\366\367\2252ku\210`\372\205}\342\f\327"
+	.ascii	"\3321idc\263\246o\210fM\215\357\3130\255\f\231\346\360L\214\331"
+	.ascii	"\336\227\346\260\f9\3742$\013\343\323ho\002\3634\265r\331\206"
+	.ascii	"\030g\260\037\013\031\206\352\206\030O{j\365\374\336\374\301"
+	.ascii	"A\254\371O\323\023\261\376\033)\306v\372\003\311;W7h\351\027"
+	.ascii	"\264\206:\034\351\242\245\357v\364-\354n\265\301\b\323\351\326"
+	.ascii	"c \306\357E\013\272\256\353z\244\225L\247\257\347\006H\203s;"
+	.ascii	"&\215\200\315\337\257\f\272\256^"
+	.ascii	";>\370\373\225\341'+1\022\247\265\f\263\f\261\020\303\362\260"
+	.ascii	"\234\275\272\247\"m%\214\21054\\b\311\322Mx\0243J\021\274\322"
+	.ascii	"\307\322*\316\334\312\225Fq&\254O\245oe\331\017\353\241\335\321"
+	.ascii	"\257J\177\331o\2122T\026\311\300\252\364\320*,\316yve\337\253"
+	.ascii	"O\245\233\360`}e{`\213\323\377\352\203u\312v\0343\016\247\f\245"
+	.ascii	"|\365\215&\256ar\231)\206\\D\254\241\345\226W"
+	.string	"3\205\305\225\235\305`\302\205\254\241\225;\245\377\3275\204rd\2505\245e\344\035\213H\031\266\276\264<)\375\256\3468\315{_\303'\313|\036'D\254\303aI\351\347I\366\271\372]]t\346\230,\0336Y\346\231L\210Xg\263$\331g\346\235m\365\243\364\271:\r<&\253\226\251\203\212\210\205C\311V\353\3103\016\247\2269\003o\210$b\271\030\"\211\322'|\272C\330\035\2467-\265\314\026\313\3430\352T\362\262\236\370\351\246\371M\313`;\376!6\031>-\223\231C'\"\026\253\341\rW7\315^\017\301/lN\331\031\3412Y,\007\0039\tk\373\322\004\364'+LN\323\3172Y\244\177D,\024}\034(\303&%i\326$\363\265Gm\b\r\0064K9j\247\313\226;!\327j\326\323SO\237\330<\323\362\3644\3372U,\367\210XCK>\234\274\tvZw\310\277\245'}(m"
+	.ascii	"\r\255\\V\212qN\376Ubq\242H1\203H0\246\247\240\364\265\232\245"
+	.ascii	"\344-\223\005^\212G\304\262\201w\007\245?\234e\365\265\032e;"
+	.ascii	"\372e\265\007\302\343\337\230\376\223.\241\324\272C\205\264\222"
+	.ascii	"\321\224\032\254H6\274\223\0361\226\2267%\315S$\253s\322\234"
+	.ascii	"|Z\030\306\346<\013R\206M\035\2209\271\270\246\235:t\302\314"
+	.ascii	"|i>\361\223hL\347,sE\033\021\013\205\034&\313gs\360\307\032 "
+	.ascii	"b\223\364\215\033f\341\227\346q\006<\335e\326\372\222,\240\225"
+	.ascii	"\273l\326\250\001\324l>q}Y\016&\265r1\200\002\003\247\265\220"
+	.ascii	"\032.-1\260Z\377\254\247v\177\326\273M_)\232e\246H\327\210XC"
+	.ascii	"\251\232\rK@g\225\fYx\204>VsZWi\n\343#Y-M[\246\020^\031\242\324"
+	.ascii	"\331\310\020\2472\300C\303j\036\313\300\262U\203\347\017-\206"
+	.ascii	"V.\373@\357 \243\304!q\231\276\230\236\372Uc\300d\355\212\225"
+	.ascii	",M[\370\310_u;\277\342\314A\265\323\276I\237IsZ3\\j\026\246I"
+	.ascii	"?.\357\354L\332C\340qLL\337\254\277\244\031\312YP*\001\204\302"
+	.ascii	"\320\312]2\315eZ\004\302#\240U\277\252\231L\327\b\374Bf\325\315"
+	.ascii	"'\357\254\211\313\253\232\271^\202\326\302\021\346\020\007\251"
+	.ascii	"\225K\325-\350\272\244]\306\250\232\241<\325a\311"
+	.string	"G\345\243\225\313G\251\330Y\001/\360Y\337\254\247n\326]F\255o8\325\303K\252e\231\037\314B\224z\3402\305B\234\272\335\225\263\276[?\275@\227\026u\324\312}\261\312\360J:\304Y\272\274\222\276\330r\257ISY\246\f<e\021\023x`w\263\274+\313z\222f\263\356\266cr*I\017\317\244^\313|\033Y:\245\210\216T\312\247z(g\251\307\t\007\331\311e\256X\246\\G\366\337\226y\312\340 \025\220b\035\212V\210d\025.. y\202$\316\005\240)k\013}Y\246\210\021&\240\225\304\347\360\252\311\216%\340\023?\027X\262\203\025\004\344\260$\207\276\325\022\256,\013\017\230:\265\003\264r\357v\233\312R\252e\246H\225\020\261\206\322$\250\340\322\255\331|b\252;Wi,H\245H$\307\276\32415\023\210m\205\250cT\337j9\247L\231UG\205V\256\214\2773[\320\214\371\0134"
+	.string	"T\247P\304g\216\324\330\207j\017\201^n\354a\223\020|u~R\370S\177\207t\375\223\325\262\255\fF]\023N\001Z\271\214\365'\245\236\205'\260\2266\261FX\b\200\227\365T\214\364\351L\025\261u]\271K\263\227\026\021\205\344\351\324\273Me\350\3402S\004\022\344.}\271\276S\017\235Ar\367\325/k\356\322L\365\022\242\220\270\035\307\214\004Xi\240M@\305\376J,65\021\207n\362\363\327\307\017\007\246\202T\202\302\r|7\250\r\347\232Hxx\0303\323E\005\022*m\006@\243\320\214\225\023lh>{\216\264\rF\2164q[3\247\242H\033\351\242\275\343\230\226\256\241\213t\n\302\273e~O\017Q\352z\354\210Sw\313SC\177/\357\354\311\004\017L\314l)\201\310\f\224\016\017S\023\031\302\024\326CH@\347|\tn\351L\231"
+	.string	"h@\355\020\237:\320:B\232\206.jS\022\202F\304\262\225\272h/\235s\0028B\215 }=h[\220~V\205D\250\223!T\231t,\210a\222)\204DhF\233$\255\001C\026@00,(\031l\213$\037\023\200\304\016\207\"\262\246\006!d&\231&I:\034\326\242L\254\244\n\206\004\300\316\024\270\3516\324\377D\203q\344\246\317\273a~^\017\360\023\261\313\241Q}\202r\276\365E\342HQ\367\036\013\177\036\314^\200/BrN\005?\214L\230\357\201\255t\bh\007\257\037\351G\t\225\256\\\t\326\251\245\327\313\243)\231\0078\033k\237\220\013N\212\343\004s/\023\211u\350\352\223\204Z\271b$\302\205\201\307\311\210\255"
+	.string	"Rb\362\360q\212\224\350U\"n\017S\"Q\004\036\325\032.n\221\026!\266$<\342\222\2332\277\005\0019\336\271\207\362w\326\0362n\360\334Z9&\251\305*6\346"
+	.ascii	"\361\217\221'f3DDW\255\376\370t\366H$\311\320\201\362\323?\266"
+	.ascii	"\331\202\177\251\206\304l.\021\265M\347\257 .8\013+LJ\231R\304"
+	.ascii	"\201\315)\177\363\243R\024\251\342\210\266\033D\"\332\256\221"
+	.ascii	"T1\225z@OQ\237\212g\005\310\214e\313N*\220\b\355\001\352`\027"
+	.ascii	"\274P\265T\275SK=\326\311\377\361T8\220\322O\265\203\364\217"
+	.ascii	"nG\253\037~\325q,\341\032\224\3322\301\200\033Q\003\263&+\375"
+	.ascii	"\324\246\360\216\034\352\267\230\006\320\336v\035i\002\375\274"
+	.ascii	"\210NL\0321_A\2248\337\222 \026[v(\274_6`\237\255\320\277X\225"
+	.ascii	" \301#\205G\353L\252-\353\026s\260\253\226\203V\342\264YQ\216"
+	.ascii	"\264\252\221m[Q[]T\b\376\200\242\375>\247x\314\371)\353N\016"
+	.ascii	"7\230]\260Hd9%\217n\337+AQ4\302\025\034\333y~x'\376\253\036|"
+	.ascii	"\005\3718\250\323\266\204&\205\302G\205\"\234\370<K\032\023}"
+	.ascii	"X\325\203^\273\216\215-\357\2652q\326\350\333\241o(Y\253\342"
+	.ascii	"\262_\333\352\t\231\317\013\365OB\214\036\344\302\262-\nd\236"
+	.ascii	"\301\033Y\367c%\305\006e\317A\341\352\244tH^/h\217\270\225\""
+	.ascii	"\374\020\220\2208\222\341\221\346~\353~\374\207\202\211<q\201"
+	.ascii	"[\265\324\007U\236f,\022\305\364\362u`\036\315\350\0024\312\030"
+	.ascii	"\343\227\264\326\207P\031O\024\204\253\210\217\230\004\362\326"
+	.ascii	"\342\035\315\314ei7_\215\201\317\021\351\032\177\034$\360\204"
+	.ascii	"N\305w\201\036\3715\033\227\336\030\001\266\364\n\312L\374\376"
+	.ascii	"Y\360\244]H\300\333\246\350\312\266\350\270\374\314\370!6\251"
+	.ascii	"D\275\340\001\325\322\244\361PJ\267+\024y\233\206i\311\226N8"
+	.ascii	"\240\034\314\301\207SS'\241\301\236H\316|UZ\303E\210\026\242"
+	.ascii	"rp.\370\255\305d"
+	.ascii	"`RG\320r>a\2231r\023r^\212\250\232\343\372*@$\323\313#\242\361"
+	.ascii	"@\024\020\303\330\r4\226\305\324\275\031\326\205\342tp9\255\255"
+	.ascii	"\374\352\344)n\310\304Y\r\221\"|\346\024\266/\227\254\317\347"
+	.ascii	"SC\270\345\357\263\025\252BD\220{%\035\272\352\247E\367%l\260"
+	.ascii	"\213Lp\336\321\266\371\342%\003\357\017\006\017\315\205(;'\261"
+	.ascii	"\260\024\251\"\225,\301|\274\204\335~Vd\2539X\373\216\252\266"
+	.ascii	"\204m\313#Q1\276A\027\342(\222\330\256\220\0074\377\003I\022"
+	.ascii	"\265\005UyZ2Ag\2754\220\261\355H\244;T\206R\356\267}\333w\231"
+	.ascii	"\272{.\333>\307"
+	.string	"\2020\2650\024\241o\243\024\013w\353\361JRuqt\006\337\204.\235\332gj\260T\220\210hc\307\326\2539/\301O`\332*\r1O?\210[\232PI\360r\201DK\013\350\262n\036\033\031L\262\347\242\262D\013\005\260T$\332\222v\326\343\321z\201B\bI\362\350\353O\347\342\251 \315\377\237\225\243$\036\320\013\205R\346Ac==\030:\031M{B4\222\021\341i\"~pf\351\037\263\034\017j\2369\206\2247p\371\016\300\300\325\252\276S\204|_\347\250\200\325\304\302\354\372\232\252\271Ei\303\204\026\026a;9Z\253\362\316{\325\321\250\330\032\322\313\335\260\365\335\254{\263\341\260\213\021-\253\022\306\313\220\034O5\035\217\324\001\372s\315\206m\024\213\346!\315;Qn\023\342\316\250\305\216\232\201'\023m\306\035\363l\021c\2618\231\255\245\022\216\301\370RI\341#j\270B\237\320\315\016\315\316X"
+	.string	"\025H\201\032\324\200d\301yES\201\264\305\353\242\246\334\201a\221\247\232zh+\240z\360\307hjY\236\021\356#\023\006\332\214\035t\3772\030\271\t8$\305\221\016\230\356\212\b\037qHf\253\241D\031\343_\345\226\362\227A\376z?b\347\225\013D\310c\364\201\177\317\247\202\300\b=X\233\332\032\246K\177\037\370\r\"}\027\203\271\300\243[ \1772\007\301\210d\265\374\355\007\226\234\221g2\016\361:E\240\255dv\200\177.l\207=e\214\020\307\255l\231\016/\r\377\024\277\207\364\t\r\271\245\325\251\201w\221M\214\315\371\212Z\331I\244\303\356l\215\223\372[%\276\257\344\225\256\241\357k\320\032\321$\211\0013wo\354R\riR\321f\374"
+	.ascii	"\230b\377.\205.i\224\006[\214\\\334\254\255nsu2\203\022\244\213"
+	.ascii	"\220\331\001\300\263@ q2\016A\210\"\202/\017\224\r\257Z\024\222"
+	.ascii	"@_\034\"}4\016\312\324s\001\345F\276\252F@ \261*YIBP}G`\r\251"
+	.ascii	"\277\007D\277N\231\307J\326\375\320\340\230\177\2461\377wT\233"
+	.ascii	"\245\"\337\20547\007\210\343\230u\312hY\231\301\235\224\364\245"
+	.ascii	"\026\205\301\311j[@s4\r\243O+?\217Y\017\324\230U\305\277\347"
+	.ascii	"\262\037l\355\312\234\\\241\216\211\242Z\240\336/\0266#\236\224"
+	.ascii	"\220\300\350C&\231`\251\321c\264tS\265\360f\260!\247\001\272"
+	.ascii	"h\343\022\004\325\211\304\355\230\234X\203vb\332\026\355\266"
+	.ascii	"\324B\300\346\201v\376\226\274\347\036:\020\265\0202\342J\035"
+	.ascii	"e\306\250\220\032O\332\244\310\335\202\031\272Lj\320\034\215"
+	.ascii	"\332,5k\233\026\177A\334\377\222f\305QP\232\355\366\374\200\302"
+	.ascii	"\333\354\274\026fT\253\345.\b\262r\215V\236\233c\233Q\271\217"
+	.ascii	"\360L\332t\316K\3463\336\241\242\003J\251c\206\375\216\324\312"
+	.ascii	"\322q$o\013\022\023\220\032\216S\207\371\213\261\377\021z\264"
+	.ascii	"\2045\360M4\232\374\241\370s\037_\302,\271\177\321\315<%\210"
+	.ascii	"\006\217Q\360^r\350\210\325\347\355\201s@l\223\034\212\027\037"
+	.ascii	"|\033I\224?\341\177g9\212\236\r\215=m\023\226\273\367N\263E\207"
+	.ascii	"(6\367\332\2642\303\237CO\007\340a\321\306\200\277\276\343\223"
+	.ascii	"\236\312\230D\205\b\005T\237`}w/\200\036Yl\310c\"\314\334\267"
+	.ascii	"\276\232\3620!\351\261U:\305\0261i\347\371\036\326g\215\"E\337"
+	.ascii	"Jz\023G\205\261\320\322\232\271W\372\023\202g\331\274]\344\312"
+	.ascii	"V\\\tnD)\261\316\022\017g\1774\234\201*a\031(\224(\tt\322\260"
+	.ascii	"\033Tckw\215G?E.A\340T\202\341b38\017\334\211\300a4v?{\231^*"
+	.ascii	"\333\212\230d=C\332\217r\374l\364\340\271I+\210\253q\207F\320"
+	.ascii	"\237\246\351\2065\367\303D\346\361\324\032f\265\367\203\240\253"
+	.ascii	"\264p\360\324q\037\340\250X\363\230\3769\346\006i\f\352\243\332"
+	.ascii	"f+h\3378\b\273\304a\f\210\247Lz\325\f\325\261\n\0029\251S'\027"
+	.ascii	"R\255\202\277\036\306:#\335\017\f\001\206\n,o\227\031F\016\215"
+	.ascii	"\373\370*%\332\366v\314^j0\320-o\327F\002\306\220yNi9`k\314\365"
+	.ascii	"v\356\357_\200Xc\356\020+j\246\363\344\312\222\207\004\363m\253"
+	.ascii	"\377\007\213\374\351\345\270\333\312,\321U8\360\257d\2153o\360"
+	.ascii	"\276ts\226\301\016t[\222\223\006\225\202\233\374\247|\277r\223"
+	.ascii	"\225\232\0077\n\372\327\314/\260\262\24383\nU\3612\332\361\335"
+	.ascii	"c\271\364\261\215\324\226R\220X\342\262\225\303\f\275\206\310"
+	.ascii	"a\334\036=\003Ve\362\212[\322R\b\213gT\\\b\327\0223\016\356*"
+	.ascii	"c\001\\\332\031\005}\264-V\376\0229x\024\020\206\264n\366\fM"
+	.ascii	"\254{\205\305\345\334\313\3537S\033\3038\2736\276@\004;\354!"
+	.ascii	"\017\221\250M\323\256\022\bh\344\024\323\271\302\211 g%\305\""
+	.ascii	"\252\323\323Alz\224\032\034\236\3713=\334|T\351\022\320\305\212"
+	.ascii	"}O$\272\351d\247 5\226@\2732\333%\324\033\201\030_\242)\211\240"
+	.ascii	"@\266U\331\203\341\313\365fr\351\270\274\337bN\344q\357uGC\260"
+	.ascii	"\217j\003s\202\334\004\353\016e\263\204Tc\240\005\237\227\221"
+	.ascii	"\022\260\300-\303}\"\255V\fr\352B\t6\036\225\324\032\365X\212"
+	.ascii	"\026\241\003\306\211Hd\243\212\027\375\260\357L\343\2014\257"
+	.ascii	"\302.\366j\220\366BL\002\376-\004\227:\361\247Y,\313:dVWT\271"
+	.ascii	"m\013\017{\246!\005\275_pz\374H\360\233q\bz\304\355\257|\305"
+	.ascii	"\036\241\341\250\037\302\007!\326b\027\3236\307\360D\005\266"
+	.ascii	"\376\320\226oW\366\365=\375\277/!\276\354p\205\235\316\r\037"
+	.ascii	"<\177\2334\tn\341\241\032\2276\026h`\360ut\221\316*\023\3029"
+	.ascii	"\036\003~\374\270D-\016\327\325)\261\017\373\004n\374\006\212"
+	.ascii	"c\t64\3743\370|\177`\277\2373\315\035`\3764\026\037\204\t\345"
+	.ascii	"\365\2428&<\367Z\202/\245Z\t\016=\210U\022\201X\025\357*\373"
+	.ascii	"\364g\020\213\230\032ri\354\005\261\016$PGh\221\2776).\332Fa"
+	.ascii	"\031s<5\177\0342\333\266\200\203\0343\321\274\323U\321|\022\202"
+	.ascii	"\001\236\344\265\n\001\305)\213\325$.\027\325\200\300\2563\003"
+	.ascii	"%j\374\374\324x\212\007\305\007\271\273\217\336\324\326e\001"
+	.ascii	"\007_A\2675\215|\367>\361\006\202\237\232 {QG\330{\243;\321\353"
+	.ascii	"\324\020\021\312\363\246[:6\202\276?T\266T\2552S\344(\212g\310"
+	.ascii	"*\364\301\230\302)\006P=\tf\206N\310\377v\323c.\003\376\350\254"
+	.ascii	"\254\215\343\214\272N;\234b<\254\262\300\301\211\246\022\203"
+	.ascii	"^\253\244X\021\216@\201\347\244\226fR\0078\356\241q^\250\264"
+	.ascii	"\356\312\031\260F\007"
+	.text
+	.section	.gnu.lto_crashRecoveryModeActive.107.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375 \362\265\006"
+	.string	"\222\f/5@o\222\016\233\2653>#CK\335\273\206\244#\035`T\003`*.Q\374\277\331\263\276\325\305\r\254hd\354\231\230@\366\007\253`\223\201\361~Ti\225l\231\002k2\016\325\346q$\"\252\t\210WQ5P<\315e\3612\005[\233\207\353q,\353z\027-\353J;\003\220\323\370/Z\202\rd\246\302%\251\t\343\206\224:\243\203\315J\335N@)t\004&\020n\257}\320y|\001\322\225~\034\035\246\205cT\222JfhcI\024\312D\344\357\357\371\313\b\t\236\261j !\314I\312\306i%S{\356\243X\021\273\035)\303\211\264e\242OQ`!3\307L4\352\256\007\177G\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303\033\206x\341\316I\263\215]\367\006"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.108.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"u\n"
+	.string	"\266\323H=\020Q\225\016\300\362\234\016\034\264\3577v\240\034 \314\007\240\006\235u\210\241|\220\314\271\031\332\032\326\261Y\n_r\344\356\315\252\235"
+	.string	"\250V \276\340<\026\001\212\220&xI\213dK\231R4"
+	.string	"8"
+	.string	"7"
+	.string	"\245\0221v7\352\206s\207\232\234\177\325\037\235\027:\314NW(aehE<\022\fPa\305\351\252\247\004o\224\351\250\354\256\263\363L7v\333\006lG\373\221>\\\325"
+	.string	"\237\372\365\351;$\030Z\246[`\261;\341UcW\030\n\020\266\017\261\235i\017 \300=\005\232\374\205\211\224\212\335O\200\001d\307\314\331.\376q\330I\n\032\001P\235%W\236\200\301\272\240\212R\275& \321\202\2243lw>\002\224\355n\001_\304\277\b\376\207c\366|\362\3351\377\263q\354\212\240\203KF\bQ\276\354o\224\212r\230\315\262\035\360`4\231/\024\005\231M\334\0320\3108X\0205\031\313\203x\341t\"ebm\203\341\304M\3238\021\362\211\356\201\302J\244#\370H\250\266\006!\337\371\252WH\032\262j\017"
+	.ascii	"2\003\302p\310\204\325\t\325\343\275Hm\316\211\307;d\004t\r'"
+	.ascii	"\230\300\200\352\276\222\032'\356\\T\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_pidSetAntiGravityState.109.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"U\013"
+	.string	"6\224MD\020mL:(\202\211\200F\310_\241\031?\263\372=\205\354\307\037%-\352\366\371\214\333yn\363\263\274E\341\212\252\371\221\366\272C\253 \021\240"
+	.string	"\300\206\b\020\314@\266\037\223\b"
+	.string	"\276_5\032H\223\275wJ\0018"
+	.string	"6"
+	.string	"<"
+	.string	"\230\017\t\016`\320\355n\235\257\203\247S\202\376i\257\250B\323)\353\223^r\020HX\204)\252\341 \004\353\264K\004!J\312\311\307\356Z\252\302\325\355\335v\210\355j\037$r\272\354\323\235-\373\263\237^\372\223\313+\266:l\267\253`\227bq\236\207\b\266o\261-\245\315\321\001~V\302\334\204m\006bw\334p\006\345\236A\273\304G\330\006\027|\273\210\250\235\201\270A\202Nv8\221{0\247\213\316\317\221\332\210\224Da[t\013%\312\356z\370\025>\026\360c\367<\"\311\253\356\371\244\212{\237\006D\r2\n'\271\263GS\234O\363\211\2148\036\2127\031\222\016\250~\001"
+	.string	"t\004\224TOG3\240nB\242\232\301\370\003\342\204\352\367\371\204\252e\334\317\226+\342\004\334i\242L\247\255t\221a\201\310A\326\200N\327\r\303&\360\023"
+	.ascii	"3\001\037x\006\204G\2300P\334!:\355\260\033\"\342\362L@ \356"
+	.ascii	"\021\2628\361xw\214\200\256\341\023\231\360Jj\234\270sS\2653"
+	.ascii	"ESP"
+	.text
+	.section	.gnu.lto_pidAntiGravityEnabled.110.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375 \362\275\006"
+	.string	"\222L/5@o\222\016\230\016\303c\374\340r\302\3301$}\210\006\271\220?/`\211\342\377\315\236\365\255.n`E#c\317\304\004\262?X\005\233\f@\326\031\3266\310\226)k2\020\325\346q(&\252\n\211wQ=X<\315\205\3612\007[\233\210\353q,\353z\230-\353H;\004\220\343\3703z\202\rd&\3035iI\343\216\224z\243\203\315J\335N@)t\004%\020\236~\373\240\003\371\002\244#\3758:\003-eT\r%3tz\311\026j\205\344\357\357y\314\n\013\236\261n\"\241\002\226\217\016\223K\346\366\\H\261\"v[R\007\223\246\222\211>E\201\206\314\0343\321\250\273&\374\036\001\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303\033\206x\341\316I\263\215]\367\006"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.111.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\205\n"
+	.string	"f\024I?0k\225\016\230az\345\n\245\250c(\327\210\211\214\215\237^\366\227\317\037z"
+	.string	"\325\316\303\357o\21434yjd\320\261\023V\343GtD\207z\210\005K+\0070\304\212>\236|\262\367\226)\0056"
+	.string	"7"
+	.string	"5"
+	.string	"K\311\260@@\205\017\273;!\202m\203\333#\324\315\177\\ \\\027z\274\f\034~W\002\035)Vv\367\022\256\003\272\221\352\343\262\273V\256+\335\362\266+lO\373\222\352[\023\007\250\322O\036v\013\254B\254Jb``\377\263#\217\330\276\332\207\360\b\333=[0dW\203waw',q]V>\261.\343%\326\2457\273\303\277\004\001\326!F\212\003IA\330\3568\205\317\265\273\024\376\204\247"
+	.string	"\370\250K\007"
+	.string	"\351\271K\037d]\036Z\2346<\360D\272\262\277\221\302\003\366\343\356\256\241\311\276\367G\r\031\216\246a\231F\273\214\261dl<S\323ll8\032\223cs\321\231\230\3543-\024c\236L65\f\313f\344\023\035\232\fQ\320@%\202\243\030#4B\273\203\3519G\030R\350O\021"
+	.ascii	"3\003\3469D\2530p\007\214\025\252U \002qP\004\353:\204=\227\321"
+	.ascii	"5#6\253\323\3025\0020<jd\177(e"
+	.text
+	.section	.gnu.lto_dynDtermLpfCutoffFreq.112.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\364\001\305\021"
+	.string	"\006\343wG\340\360&\035\337H?\004"
+	.string	"o\200*\331\264\223N\321\241\261\372\006\344\260\361\266\177d\006\363\037\210"
+	.string	"\250\260\035\373\375\013\275\265\036X\027\376\214<\344\210\006D\200\b\225\001\230\210\037\360h\317\243\312hbM\032\331D\312\224\002`"
+	.string	"]"
+	.string	"c"
+	.ascii	"\031\022h\332\257\235D\354?0\216\2737/\220vk%6\340=~\244\237"
+	.ascii	"\367\261\315\251]\024%\220v\267\304\004\274G\333~\210\213\210"
+	.ascii	"\3316\256\306!'@R\212\231\240\246\335\005I>\322=r\017\351\036"
+	.ascii	"u\303c\317\230\377\242G\270\2603D\243\211y\242\026\354\256\223"
+	.ascii	"FSs\353m\017\260\r\301NX\036'\272U\027\372;\236\346x\372{zC\323"
+	.ascii	")M{\232F=\335=\035\237\346\236\326\247S\323\037\311\0162\232"
+	.ascii	"@\364\\\307\305.\206[\215U\021Ox\350\362DO\373\266c~\221?\333"
+	.ascii	"D\024\2765\233+p\222\224\230v\267\300\243\033\034@\020\273P\205"
+	.ascii	"\177\354\214\305\b\006@0\371\2612\263?\262\315\317\261\213\217"
+	.ascii	"\3624\037u\217W\242\305\220E\3554:\2056*\3454*\347\244\312i\316"
+	.ascii	"\360P\333\236\252\252%\235[\3103\263\335D\213\0177k\005\267\033"
+	.ascii	"\r\231]\231\200T\225\246Q\3303\313\233\257\251\017\231:\364\352"
+	.ascii	"\021\244\003c\346I\2267\273\026\223\252\301>\267\212c\221\377"
+	.ascii	"\374!\007\372A\356\363\007*-\327\313*\266\\/+\356\345\244\205"
+	.ascii	"\365@\305\345\240\305BJj\305\002\203\265^+0\317(&),\027\b[\221"
+	.ascii	"\300bQ\001[X'\023@\224\227\013h\002\300-\327\352\005\302Z\255"
+	.ascii	"\027\370\325\366\266\210\222\310tf\016\375TD\037\332\31484nh"
+	.ascii	"\247\237>\354I\351\206rK!\223\247(M\351C\236\020\365\364 \212"
+	.ascii	"\322oigh\346\251S\337($ `\002\021\204\306\003X\t\312\003b\330"
+	.ascii	"\024\303\242\\gJ\306\342\326$\227}\201\351\217\"\254\032\375"
+	.ascii	"q\\\313\203\244 h\224C\214\3445\366\371/\323qq#\204e\r\037\333"
+	.ascii	"\230\231\317` JG\360\326v\243\306\004\222\301\310Rn\331M\034"
+	.ascii	"\213\031\300iL\355\"\003"
+	.text
+	.section	.gnu.lto_pidSetItermReset.113.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\305\007"
+	.string	"2\21778@\217\322\001x1\271\273\321\203\206\201:"
+	.string	"\263\337\224)\366p\215\3677\022i\212\337\020\177\\6\213\321\0179\2227\311e\030]\002<\237A\305.\005\323l\376\330d\313\224\002\035\315\263\260\371h\030s\262\316\006\232\"\207\206\315\3030?\333\346ar\272\320\3140s \255\233\"\216\353\246&\334_\033S\231\r\023\226)JX\243\035z\bI"
+	.string	"ew\023|\220\207\020>\307\245#F\372\357\322\037\001\\\336B\203\305\245\302\244-;,i\274\260\177mL\331\007\177\275\006>FP\3578\331\245h\275,K\222x\330\276\306\266\252}\200\340\035$a_Y\201\253\335\320\300\005\001\227\366l\225\207\031\213\225\244L\210\264\354\356\214\030\367\256\236\177\3253\337\251t\305(\354\256\365;\241\356x\333\004\2663\333\252\b"
+	.ascii	"3\241\203\037\2301\346B\327\360\365\020\\I\215\003wn\321\316"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_pidGetPreviousSetpoint.114.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\205\b"
+	.string	"F\020;5@\257\032\003X\216\210\202E\316-\024\034Z\233\244\350\353\322\322\365=m\263\326\016\207\331Jc\023\241\201\312\310c\034\r\t\274\220\247\246j\322\321\367\244\277\224R\246\024)"
+	.string	","
+	.string	"("
+	.string	"0\332\377\271\261\346b\031-p\261\204\037\356\374\272\332\"f\200\265RN\250\222\037\300\302\377\276\023*\345B\2675h\213\320V%\032\027K\312\255\330\317Qk\371\212\224\265\332vm\346\331\325Y1\177\307\t\312\177N\017\002,\333\326 \016\351\332X|\255X\0053\332F.\021\r\254\376'\214\230\304\242fY\366\202\364|\262\254I\020#3\275Z\373*=\350\321:\376\177\241\252}\257\320.\373\305\242\r\303\023\373\3514l\2409\212\200\330$\036&\305\346\231\230\237\220hv\b\312\201\034Bs\304q\241\231y\335\361P\005\341\306\00452l\322\030G\241\255\b\f"
+	.ascii	"2\241\303/p+\n\310D\361\022\237M0\310\013\310\256)x\210$*\260"
+	.ascii	"\001\250\214\246v>\001"
+	.text
+	.section	.gnu.lto_pidGetDT.115.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\r\007"
+	.string	"rM14`m\322\001\310\017@\222\254o%\242\243gr\260\001UD\001\0245\027|\263\362^\020K\275\334#_\321\006\261\003\021\240\023q/\030V\034\377\267do)S\n\326d\024\252\r\34484T\017\f0\242J\200\200\232K\002f\006lm\026.\310\261\254\013R\332\336\255\212R1\037\265\260=\361\021\227"
+	.string	"v\327\300\027\271F\341\217\376\\\321\311c\177~g\372K\r\b\371\344fk\236T\r\373nUd?\235z9\301\b=C\331\315\330T\326\344\221d\266\243M\371\036\377\210v\311i\034#\202\222\225\013R\312\356B\314/\323\237\273\300\364\247\033\217\317\350\037\344\b\244l\303@\236\247\345`w\235\030(t\353\013lw\004\t"
+	.ascii	"2\241]\037\370\354\020\240k\270p\210\02136qW\244\331\360\256"
+	.ascii	"{\003"
+	.text
+	.section	.gnu.lto_pidGetPidFrequency.116.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\r\007"
+	.string	"rM14`m\322\001@\203\200\354\b\036\244j\211\034k\331\302\027uF\371n\322\346\255\225\367\202X\352\345\036\371\2126\210\035\210"
+	.string	"\235\210{\301\260b\036\177#{K\231R\336h\024*\316\35384T\017\f/\242J\200x\233K\342i\006lq\026\256\327\261\254\353]\262}[\035\245f@ja{\342#6\001\354\256\201/\362\214\302\307\356\\\341\311\307;\337C\335\245\006\204\200\362dg\237\324\f\373mud?\235\212A\301D'\231\354b\234V\366\304\221t\330\206\366\305\367\370\007\264M-\333\300\bJ\342EIew_\346\030\352\256]\200\272S\215\303'\364\017r\204\022)%\206>O\313\301\356:cHt\353\013ls\004\t"
+	.ascii	"2\241]\037\370\354\020\240k\270p\210\02136qW\244\331\360\256"
+	.ascii	"{\003"
+	.text
+	.section	.gnu.lto__reset_template_129.8.118.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\301\001U\017"
+	.string	"V\033bE\300XM\032\003\210'F\250\234\377\336\323i\307a\276\353\324\266\200\305\264\331Il\352|kC\243\251\020\254\023\022i\305\250\216\247\255\f\313\024DS!X\246 \232\302@`\363\002\215\266@i\n"
+	.string	"P\\7Z\222HV"
+	.string	"T"
+	.string	"I"
+	.string	"]\2556\324\372\213\203\273\031\353W\353\027\316\005\342\316\313z[\007\275\200\221@\006\016\032\025\206\023\356\330 p\3021\251\320\004P\365\330\023\272[yI\002~\366\230\354\255\206:\307\340\2407$p`5\034\240\034\347\r!"
+	.string	"\035\204{\242\260"
+	.ascii	"\336\255\206\033\200m\343x\002\321\302F\027\356\202aZ\206\211"
+	.ascii	"4\0347\0349|\324a$\017\357\207\027\304\263\020"
+	.string	"'\211X6b\032\211\215J\374\231xO<\205\342\230\342\250\342\242\025G\026-r\216\224\366\362\322L7\r\3460\022\036\023\301\205N\024k1\255\245\032D\005wN;?A=`p9^\325qLw\274\312c!\365q\026\375\361*\220\265\250\220c:\344!%\362j\221\211\324\3103=\362*\222c\232d\231*\031\246K\226i\223Wy\206\351\223{\024\312\253Q.R)\323t\312[\224\312\253\373\247\256\271\350w[\216\001\325\266q\333\233Ho*\335\223K\273\262v\225l\372K\247\255$\324W2j\237\224\372\225S\277\222\314\233e\306\222f\206\345\2317\323\374\223j\376r\315\261l\263+\335\f\224o^\235\261\217\326x\325\3062\275q\220\0060 \320\":\362\001w\211+\330\206](\007uX\234cYcV\001c\317\241u\2628\314\365\022B\3268\272 9\200b\254\241\023\035\022\327;\274a\t$\232"
+	.string	"\356\301\226A6J\021"
+	.ascii	"2\344\020\007\005\353\212\212\031P\330\2737\203\330i\2730m\356"
+	.ascii	"\363\260\3068\224\355\b\303+b\350\301\025\001"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.part.0.175.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\225\013"
+	.string	"V\326M> O\225\016 \\-\002\210D+\004:\3742\304?\007\003\206\237;\217\bd\2624\240Qm\r\233\032"
+	.string	"\211\036\212\312\377\377\022"
+	.string	"\003\300<N\0030K"
+	.string	" P6\316\3060p\263\233H\231R9"
+	.string	":"
+	.string	"="
+	.string	"\207\3309\036\207\3669\330\006\221\334\331.\376\241\366$2HX\315\330\335x\250\030\336]\023\353\374\253.\361J\241\253F\251\302s\343\030\304\300\356:b\341\206\267M\300v\264\317\t&k\246\363\337\177H\007\305\265;\341\345\332\013\020\205\006\333\267\257\002\331Yvh;\363\037\b\3736Er\246\375\016\367\320\375\203Y\226\354\252`qbw\007\034Z@\3440\300'\217zU}\304\210\260a\224/gy=\210\217XPA\355\212\356\331\234\213\320\236\002\265\273\005V\017\321\300O\035\332\363\311{\207\376\307\301\203\274\227Z\241"
+	.string	"\243\005AC\251'+vlw\327\032\227\r\307i[\206\213\330BI\240\351D.\203\321l\024D\006\032\004\234h\331<\221\002\300Z\347\262EN\323\266\230\035[5\371\200\214\226HGV\325\223mU\033s\023fMZ\224\200+\274\027\242|9\003\027"
+	.string	"{\213Q\267\002\343\341<\331l\022\002 \270\263\004\201l\030\263zB\001\242`\230K\310V\r\222\206k\320L\347>\342\271\266M\227\235\013"
+	.ascii	"'/\346\235\226\246\237P\306"
+	.text
+	.section	.gnu.lto_pidCompensateThrustLinearization.part.0.176.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\231\001U\017"
+	.string	"\306\035eE\360\260(\035\330L*'\350\203T\025.X\215\336\372\213\271s\347\003c7\001w_\003e\336.\330\325\320_G8\2077\351\347\267\335\237\367\201\227\3053\304\346\f+\004!3Q\210\342gQ2\032ido)S\nP"
+	.string	"M"
+	.string	"Q"
+	.string	"\366\354\262p\221bw\r<\272\200\366h_\004\313\311\266o\363\020\"\333\005S\034P\217\201\202\302\252\306\356r\217 \367\310\036\341\003d\217\272\341\242kB\221\177\325!\210\234\031&\230\321\225\003&\346\t\340\2603\262\273\326.\334\361\266\025\330\036\261\323#w'\323Y\246c\246a\246\365\254;\237\372\277\tH\320b\327B\354\306\312D\025\035\316\372\355\373$>\302oyc\255V\f\342\022\262Z\321F\247\001/50\032\273\033\362\350\003\332U\367U,\366f\213\354\315\231O\035gQ'g\036\307\256\252\032\365cU\372\300\221y\277\262T\033\305\313\233\240f\030d&\350\3106\204\237\260K\333]\004~\211\233"
+	.string	"\371\250GGP\311\233\036}\025\365\300\220a\343\206\2241_\355\272\323e\227D \365\255CX\316\212\222\207\226\214\245\322X!\\\235\261\265\247\002%\035\350\353$t\013:\272\223P\310\373LB\232IDJ>)\\\310\304\301\347\244\001\367\340\303"
+	.string	"\205#\371@\234\310\207\275\224\356\343B\236\367q\333\341\352\214\337\272\247&\303MvT\323\027\333\232^\365W\210\261yA\322\026\353\241*\215\355L\257\035\315W\t\0265S}\2254\300\" P\002Q\316\235<g\250|\312p\354\220 \n\030\r,?\361\230\321\306\272\020\031Y\005e\275\274\267\344a\204sXIF\036\323"
+	.ascii	"\225e\331\363\303H\341i\240\305\007\346jGQ\035A\353\007;\216"
+	.ascii	"\301\206!F\016\233`\375N\273 ]Ru\372\265j\f"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.part.0.177.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\237\001}\017"
+	.string	"\246]eE\020\221\223\016($4\326\231\b\032g8\223\376\n]\325H\034Lr\034\343\350\325\373\fFQ\3578\3330\232\261z\2536\002\372Q\251\272\337\222"
+	.string	"\250\002 ZiH\027\031l9&A\261&\342\tb\311\336R\246\024P"
+	.string	"N"
+	.string	"Q"
+	.string	"\376\330\205\021\243\305\356\"x\264\201\354\321>\n\025\224m\377\304iF\366\007U#R\277ac\003\213\307\356n\217#\017\301\036\341A\260G\025\361\3215\341\310\377\352\320\304\347:\271\220\256"
+	.string	"\\^\236\001\016;\rv\327\231\207;\336\366\002\333\016\354\f\t\252\273\223i,\3231\3230\323\372\326\235W\375\327\0040\240\331\355\220\323cCD\027$\336\372\355\373+\256\302wYk\261R<\302\302J\311H\250\001-28r\354\356\201G'\310\276\272\277R\2615{dk\316\274\3525\233B9\3635\376\002\360e\002\001U5\252\310\215i\306\256p\033\177\331\356*\360Y\374\005\362S\217\346N\362\247G\377D\377\311\244(e\316}\203\245\332\242\f\371\223j\201\0272p4(\311W\177w\262\354\226\b\244\336u\270\303\246\206\251\304J\346\244\306X!\\\205\261\263\007&\036\224\316\203\301\003\001\304\023\205<\321\203\216\3638\220\346\022\022\223Oh\363(L\370X\220\260]\370D"
+	.string	"m%\035\312F\"b.\344\3516\217\343\272M;\\\205\361]\377\240\361aFv4S\016\2663\375\352oy\321\201S\322\025\353\241j\214mL\257\035\325\227i&*\246\001$ P\002Q\220\235<\362\030\374\2241\330!\361\024;\034"
+	.ascii	"\036\3421#\305\277\357\216\345\304v9\024\360\3422\023\3550\347"
+	.ascii	"\232\222,?\246\001*\313\262\347c\230\371-\370\r\264\374\300]"
+	.ascii	"\355(\2527h\315`\3471\3300\304\315a\023\304\357t\027$IjN\277"
+	.ascii	"6\214\001"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.part.0.183.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\272\004\265\035"
+	.string	"\366\365\271F\220\332M:\001\003n\026\277\2247\017 \223\245\330h\t\352\365\242\201\372\362\337\227\002\2468+x;1\376kG\264\367\t\374\366\262\022$\006"
+	.string	"\020\256\307kD\334i\226\352"
+	.string	"\222\334o\300\277\030\2735i\204\020\271S\n\244"
+	.string	"\231"
+	.string	"\250"
+	.ascii	"\306`\235\007\373Z-\3752\260K\034\007s\336\253I\364\332\237\224"
+	.ascii	"\347|\227\203\266\355\006)\273\262\273\017>zA\371\321\376\223"
+	.ascii	"&)\333~\223;\341\331@\321\013K\313\300VUT\2248\273\233\373\030"
+	.ascii	"\364\037\362\243x\001\344G-r\336me\215\034E\2357\236\317\001"
+	.ascii	"\n\b\320\367s\272m\372~<^~\354\t\224H\371\230\265\251\223\"\203"
+	.ascii	"\2522\035=?\032\342\317\030!jp\277\2509*\025\030\361c\367 \204"
+	.ascii	"J\314\367\333q\355A\221?YA#\267\337\f\235\001~\253\r\355\256"
+	.ascii	"\377\364\343\306\335\266\226\355![\374\n$\226M0\264p\266\216"
+	.ascii	"\b\001m\237\375U\366\255\330n\362Y\211\265R\353\265B\022\254"
+	.ascii	"z3\315\266\321\251\034\225\273K\301\227\362):_\353\243W \315"
+	.ascii	"\373>\372H\344\307\353\213)24(Os8\365\312z\323\341p\210f\035"
+	.ascii	"b\373\224\323=\265i\036\235\336\301\211\323\2679m\023\247\313"
+	.ascii	"\0329M^\354\036\017\366\213\343\264\336\353\237\342\364\007\314"
+	.ascii	"\251\be"
+	.string	"\2737\206t\326j\314\202\344b\267/\326\344\217\031\027\326\344\240\036\317\0173.\212\201_\034;\205j\266\260\330\354n\203\217\001D\304\232\022\b[\222\246\243\362\204-\2611E\305i\r\233N]\002K\323\233r\\\252M\037\225f\177\370\0313\245\312\230\n\203\006\305\312/\356\356\216\005\246\250\244\332 B\314\373jd\230\306\210\370\026\254\021\027\222\250 \206T\\\031*.\301\337\354\314\033Q\300\024U\325.ab\3367j\320\fu\262_\346\202\300}\266c\034\314\211\213\231\355\256\005\242\177)\232`\366\321\213*\256\314\217\241\217\307\323\034\372X\236\242L\3504\353X\377\254`\026\231\352\225M\346s\231A+\253\335\342J\262V+\224\305\327\342\263r\327\351U\377\201;\243%%\332\2610\322\260k\241KR\332\031\211@\241S\002\300\244\203A$\272\b\002\n\235Rn\247\342H\307\"E\256\205\216\b)W\264\304\224\203"
+	.ascii	"\344$%\243\245\334.)i)\207\263=/\256H\342\324\307G/D\223C\370"
+	.ascii	"\244P\266\036={\033\036\027\006\177\315\331\360\232\360\236\360"
+	.ascii	"\272x]\344\307y\007}nx\264G\201\252D\245!\230;jg\330@\336\307"
+	.ascii	"\243A=u\262\201\037sOo\367I\001Nw\024\310\f\r%P\027z\314\261"
+	.ascii	"Q\352\225\027\374\210\274\351\211\370fOs\344k\231C\207\016\344"
+	.ascii	"\307\233\302\230\022\303\345C\377#\276*a\215\324+\223L\002b\250"
+	.ascii	"q8\205\fc\204\210DD\002I\232t\240\002\021\252\0337\020`8T\n\351"
+	.ascii	"\372\004ZEZ@\274\212f\002c\023\342\"M \300\211\373\340\247\265"
+	.ascii	"\275\274\032su<\026*J\002\305&\334\214\356\273\227\005\206\221"
+	.ascii	"7\302/\245~\214\216\240\201yQ\2458\223\230\005\347V\0211\323"
+	.ascii	"\277\222\025\303\323\271\227\255<\331%\rK\240\033\030\022\260"
+	.ascii	"\277\016\310M\364uw\027\226\361\f\213\257\354vk\210\r\221Z+\370"
+	.ascii	"\272\341\233\032\352\364FAqh\323\301$\212i\032\312\347*\026\032"
+	.ascii	"2\230\370\005\013!\rx\305\027\353\364\033=\376\241\316\265\240"
+	.ascii	"\334\006\231\353~.\2468<\004\256\221\335\027\310\310r\037\210"
+	.ascii	"r\202!\202\005U\314\005{\204\002b\324P\001"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.part.0.185.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`-\004\365\032"
+	.string	"\226/\246F\260XQ:\300\013\304BB6\2503xc\246!\322\274\322f\216p,d\fW,Q\204AO\357\370h_\317\177a\266Kf\013\356\207\307\031O\377\212\033z\363Z\360IMY\207!3\340\t\024\354\333\3777\2212\245\214"
+	.string	"\210"
+	.string	"\223"
+	.ascii	"\266U\017,\022\201SI\205U\355\0339\223\321\217x\264kN)PQsN\b"
+	.ascii	"\227f\320\272\334y\316\352R|\201\325\245}\"\266\213T\330\310"
+	.ascii	"\036s`\322\324\001\002\306\204\223p\316\031\273\\\0357z\213\265"
+	.ascii	"\222\342\252\313\310/\361V\202\033+^\234\365\362\271\370Jt\300"
+	.ascii	"\023s\240L\250\324\236\257\305\305\2359'\314\267\323\025\r\314"
+	.ascii	"\220b\021\300w$\362P\341\020s\247\353\t\237N\225\300]\254\ns"
+	.ascii	"N?\007\343~\3356\n\333\032l\221B\343kX\334\315\231[\360\325\275"
+	.ascii	"\323-h\341\361\304\363\241\323\241\356\317\353\27287\207qT\r"
+	.ascii	"S\365K\325.U\267T\315R\365"
+	.string	"J\325RT\365\352\201\377\013(\222\002\2519S\f\333\314\032\322\t\2177}\211=\356\354\200IJ\017.E\025\021\316\335|@\344$\245\r;\220\274\021^\372O\207\262a&\272\022_\bR\223\220\350~\222\"\337\3110\333o*\362\316.\350\361s\305T,b\200\b\313\3149\037\\:B\353\022v\0319\271\277\275\342\221\301\024-\307\312\213\304\030\252\221q\027G)z\210\3733k\345\342,\005\245\276\254\325I\303\023\346t\350\275.\365fP\355\376\354q\301j;\004\257\354t\215\345~W\253nx>l\331\251x\234B\343\221\"\367S1\206C\230rb\224\231\376\034\n\r\301\0237\b\243fWW\334\273\341\365\320\351p\257\344Mf\007\252\346\314\275g\203x\024mB\325\234S\002\223\2175_\351\322\"n\372\336\245\177[\215 \241\357\355nU\2303X\216\266\204\035\016\352\271\005\341|h1\241\032\215V\223\031"
+	.string	"\032\272Ps\341~n@@\031pB?6\333\b\031"
+	.string	"\313z<\314\206b\270\240\017\263\020@1\241\231\017-&\263\335b=:\256\r\375\330b\270Z\315\026\203}s\270Bnu\255\375\231C\224\025\f\303Q\025\032d\244kq\366\204\215\003\306#\317\027\232\200*\247\313\037HMA/K\314\260\366\327Z\330Zyht\332$\r\225\215\325\013\352\003\220\004yb\243ej\247k\272x\354I\342B{\323\226\327\272\230r:tk]{\236\231\234\317\263xlQ\265V\rS^\250\221<#\025B##\201\210\210h\342\214\001\240\002\221\2522\017\020p8\2324\303\001\364\260\224\274\242\"A\262\221\326\"2\t\200V\204\177\215\3037\313\002\037\360\013\216\205.\303`a\017\235\221\210c\251+h*\344\311V%\213)\314\320'\351\256\334\212%\334\200\177\215\037\025\254@O\231\340\274\t$\231\212\224\f\2407\310\003\355"
+	.ascii	"\372\301\360x\220I\332\200\351\213&;K\314FHN\204\270\302\314"
+	.ascii	"\"\221\02067\n>\b\202h\027v0s>iILg*\222Q\3602{\320\250\314\343"
+	.ascii	"k\2058 \271\034\200\2104\225\326Sf\210i2\252\245Y\345G9\235\017"
+	.ascii	"\264\253\254\365\357\035\377\017\357%\246\254\032*"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.part.0.190.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`o\001M\016"
+	.string	"F\231\\F"
+	.string	"\261&\035"
+	.string	"\300\256\274o\021\267\265<\366\221\217\343H>:z\002\231\263T\tp\277|\234Y\311\005\303Q#-EAH\035\241\b\272\323u\226\356\252\252\020\213\235XZ?#\363\345\306\207\t|\324\b\331D\356\224\002G"
+	.string	"E"
+	.string	"F"
+	.string	"1\013Z\301c\241fgw\347\245z\270wyi\304<?\013\251jB\235\233/\3452\262|\031~e\241\360\003f\234tn>\fW"
+	.ascii	"\337\312U`w\017>^\370N1\n8\226\205v\327\037\rwv\333#\266\247"
+	.ascii	"\375\234Qe\240g\267\245\325\2630RE\b\333\367i\036\226>\302\016"
+	.ascii	">\264J\367A\223\255i\326\370\031\177\200\230\276\352\016n\213"
+	.ascii	"\2135\332\037 \336W\035\350,\033\031\027\273`\307\245\021|.\355"
+	.ascii	"\213\260mr\261g\3338\030-\016\304\354n\203\207&\271\315\026\200"
+	.ascii	"\306\3562 \361\022\025|\020\227>A\211g\271\364Q\260\313\207\217"
+	.ascii	"/:\300\274\310\260Tb\313\372\270\273)\252)\333\035vU\032\034"
+	.ascii	"\236\260\306J\274\0215e\305\256U\224\375\231\377Y\".\204{P\022"
+	.ascii	"\225|,\342122\231\234\204\b#\n\020f\311(\204d\212\220N\246\007"
+	.ascii	"\310\233\211\2104\271m#M\315v\374\265\2122\207j\003\f\025=IM"
+	.ascii	"\251=\3419\035\001\234\203O\020\203\005\352e\305\341\352x\n\024"
+	.ascii	"'4\226\214\035\005_p\023\016% \200\202\231\263\362\370\031\230"
+	.ascii	"\002\377\245!m\360\202\013Y7J\342\005 ;7!\004\263\361\270\035"
+	.ascii	"\354_f\005\202!\021C\214\261/\n\037\2425\314^\013uF\004m\371"
+	.ascii	"X\254\355\016\204-\035k1@\254%v\312\246\001\202\3664\335\361"
+	.ascii	"#g\314\277\266\236\360\306"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.part.0.192.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`k\te1"
+	.ascii	"jX\340\022@P\350I:\341\017\235F\317\317\361\335\302\343\310\342"
+	.ascii	"@\0278{6]\344\326Sfa{\214q[L\022\300/\320-\004\004Pe\245\232"
+	.ascii	"\303\b\351{\316\310I\272O\212\217n\374\326\032i\204\020)\223"
+	.ascii	"\f\030\001\005\001\035\001g\335\362\313\213 A\354v_+*S\020E\034"
+	.ascii	"\334\264i\203\343Oj\023\220@\026\316\257\031\273\032\034g\205"
+	.ascii	"s\252\031\335L4O#v58\202\365fpF\275c\255r\023\316\227M\374'S"
+	.ascii	"l_'v3;^\211T\336#\305\210\347X"
+	.string	"k\335z\271\020\316\227\275\237\033\333\025\n\227\371rc\244\\m+.\363\356\311<\016}\231\265[`\255yqpj\255\016^\256\202\363\345\325\243\314\227\344\237\314\227\273\027\263\273c\305]t\267\320\345\254\324)\243\033Z\235\243Z+\327\313\256\242\264}R\356{6\372%%a\020x\376\314\222l\036\242\373\237\205\271\003\211id_\322c\302JM.l\362\240\336\261\370\024\235`\275\025\2270\220l\342StBB\310C\343\363T\210\250\375\247v\223\324Z\3233r>E%d\324\236(\203R.\231\230v\344d0\355\310\233\214\032\222\2058L;#\265\216q\030}\356\374#\315\214\331\351\303\237\205Z\353\276l\355\313\364\335W\355\356\210\335\323Pu\302^\317\367\250\330\267\275\\\026-\370\304\026\346\313w\n6\275Gqe\334\307=e{\310\216\306\254\365\330\226\262\273\265\304\253\365;_\006\314\273 \310\253 \310\233"
+	.string	"\201\022\357\201\343}\263\230\327"
+	.string	"\363b\005y\257\230\267\300\311k\025\344\255\022\362\022\020\362\016`^\001\314Ke\362N\001y\245\2307\200\2207\n\310\013\025\344}b^'\346\005\300\274M\314\313d\362\016\231w\211y\225\230W\310\274\301\313\375\300\337}O\346\375\231\274&\220\2674yI o\233\274|\362\236\002\263M\030S\353\220\276H\365Iy\247\345x\377\235\037\316\357\346_\363\275]\273\223\254\b\205\344\254n\355\332\275\b\205\244\211Q\357\370\362w\377\355~oG\357\016J\3264\030\214m\266\030\363\360\306\366\352L\256\246\025\351\254\361>\340\214iB\234s\3733\277\333\313Ya\335\230\330\351\366l\376\346q\302\330\360\300\325Z\205p6\202\204\261\333}\005\227\364\025\311\252\265\362\324)\253 \021\350\252\356\272to@G5\201~\312H@\017\240\352"
+	.string	"-\240\237\276M5U\233\204\322\243TO\365\0355\222\352\233\021\024G\305\300\336\r!\202O\f\320\350\223\263&[\250\216\3526\246GE\211\240\332\334c\333\013\023\267\344S\357\217?\264`\004\t\022DDN\375\324\237;\b\036X\360\322="
+	.string	"\335\324N\375t\315\f@\227L\275\324M\375\364m\330LM\372I\217f\223=l\241\237,h\322-K\275'\364Bk\267o\333\022\373f\337\340!\"*\343\276Uj`/u))]\023\366\331JMJ\n6\260\205\315\213\3227`\257\3359\330C?n}\351\0263\356k\363\247\313\223Z\267B_\037\244\263Z\313\262~}6\273I\337\314\270o\271\177}9\017Q\347f(=\226m\232\270\240@e\377\314\225\270&\273\215h\223vO\374\017\016?\335\307s%\356\315=\254\303\202\2076\351\221\326\206\234uO\331\335/\363\rF\307w\306\220v\027\305\371|\235\265\0067\272t\260 I\035,jt}\200a\303C\215\035.\2000\274l\350xQ\276\230\021\026\346\005&#\354\334\026\017\\t\331\340\n\223\021\243k\006\f\256\032],hp\265"
+	.string	"\273\301\365`j\275l\274"
+	.ascii	"\343\n\363\362\002\343\022~\356\367\201\245\213\236\2626\363"
+	.ascii	"\261$\334\352\222/\270u\006\f8\316\242=P\224\030\364\026\240"
+	.ascii	"\007\234\240\027\264\326\024\264J\232\344\305\025F\202bi\343"
+	.ascii	"#F\212h)\350\005i\nX\b\017A\335P-(\027\224\213\3712A_\357\317"
+	.ascii	"#\265K\202\263\362H\270s\310\300Y\t2\2027:Z\350\004\2351$Gc\326"
+	.ascii	"\320\200=e\205|?\004]\362\231[\317\352\037\016\236\325\374\205"
+	.ascii	"\216\257O\236\r\236\325\bZ\252\256\rM\272\226\200\r\364\201\336"
+	.ascii	"E\275\240`\370\304]&\306\200:q\027\r\303>P1?\023\b\216{\240d"
+	.ascii	"*\004\252\265R@\3130\332\005\tV^\246\007\372D$V\\\240\261z7\203"
+	.ascii	"\006>\321@_\361h\262\275j\254~z,\373\221\315\256\032\250\266"
+	.ascii	"\201\311\326\216k\201~\336\311;\266>]k%\373\231-\345\3772\255"
+	.ascii	":\007\235\240\016\001\200\273\250Q@\345\214R\246hF\244 I\222"
+	.ascii	"a\f\240\002\021*[7\021\200\261S&$\211jT\226\003\275\200x\235"
+	.ascii	"\352P:\005\206\263\001\276j<B\227\217b\256e\250\022\353\310"
+	.string	"\232\260\207\264;\032\302\364\224$$\211h\200%\374\256F\177\032\236\200!=\220h\312&?\030o4>\376H1bxe_\277e\023\354\006\334^\234\304~R\343\325U4\216\205-\251\032\301\024*\244\360lE\356:\305\013\306\315\370?\017\236\260\031g\327&\246\223m\023]\"\243\tj\366,\246\220_\340\313\n\311\276\302\306@\274\"\305\363,\277\032\357b\020\350\235\237\356B8}>b\"\207\227E\307dR?\310;\336\340l\241/\017z\337s\314-\207q}|\315H{ \213\013)\177\021\216\013\275p(\030\256\201\331P\351\033\363\355\214\371a\37632Q`\266\035\002\3722:\b\234\240a\354\214\212\373\b\207\251\354\236\306\270!-\327\250\334|}\205\357\341\244\241\f \305\361\3476C>\201H\312\003\336\242\214\020\370!\212\323\036\375\bs\352\334\201)\372\026\225\224\323|h\205!\036j!\377\007k\305"
+	.string	"y\310\323\227\304\236Kg!\356\323vo\307j^\336\365\362z"
+	.string	"\226\224\302\n\333|\244\002\270R\213\203A\264\202"
+	.ascii	"\"\3111fF\355\367\346\225\230\207(e\240\241\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\020\f\025*"
+	.string	"\272I\034\020;@\346Jc\367\337N\325\tiF\205fT\254\035\240\307\366i\354r\372J;\341\214+\267\025!\361>i\321\363gm\254\026\034\r\363\035\3508\371\317\350\200\234\376\261\362.\371r\247\024\355"
+	.string	"\352"
+	.string	"\372"
+	.string	"\327\215\216\\32r\275\b-r,\022\256\205\310\315\206\374K\310\253\0049\025 W\032\177x\321\350\347\3639I\353Z\320\307u\242\036\327\210\262\256\235<\256\013a]\363\355\270\336\323q-h)\307u\240\343\270\326\273q\235g\343\032\257\306\365\035\215k@3\256\353d\\\323\241\352[\214\3539\024F\206\027_3\272\270\030#j8g\315\253\305=\034\213\373:+\356\343\034\252\270\177\223\342~\r\212{5U\252R\271\236\270Oc\342]\214%\256\t\221\270>Ti\304\265!\021\327~h\210kE \256\007U\371\216\321\214\312\\\231\017\327\201\350\322\325u\037\352\301\211\035|\310A\303\206w\031\235t`8\rG\253\312\360$"
+	.ascii	"U\251T\343\330\347\363\371\304p\375\207Z\373\253\232\300\223"
+	.ascii	"\214\266Q%\334\233}\3559\262_UU\365\302\365\037\324v\023\201"
+	.ascii	"tG{\004\374\335\020!\32115-\251tM\366\350\274\341TUer\336sr\212"
+	.ascii	"\207\374g\200\275b\360%u\216\311\006Y}8y\254?\032Z\ft\023\265"
+	.ascii	"_oUUM\332\217-\230\353Jm\327O\266{u\355\336\312\227{//\367W\272"
+	.ascii	"\334\207q\271\037S\273'K\273\017\263\345\036\f\332}\333\331="
+	.ascii	"\233\331\265b\331\265"
+	.string	"\241\226\373,Y\356\275\220\335\177\031\273\007\023\273W\013\273\246\204\345\236\313\225\373\025\354>\355\353~\213\327\375\231\225\373\262*\367b]\327\210WU\325V\360\365\272\360T0(\035\2274\236\253\316s\315\234b9\243\275\203kG\026W\217$R\274'\212\373@1\037\243\355d\213+\t\020\255\036[9\264\216\244\376\332\365\304M\243\023\333\031\233\\KbrM\270\344zP\311u$\256kHI\256\037m];B\022\210`\236z\016H\260\001\224\377\363\371\\\244\262\262w\206\271ie\257\274\005\323\316\334\246 \030x`\261\n8\360\223\300\036\327[qml\365 \244\225b\372!\355\024!\244E.\377Jp\334\016]\bi\257\326\003\366K<*\013`\375\315\340\231\311s\037\225eZ\336\302\226D17\251\354\325\224\315\3423\200W\300J9\277T\3276\346\310\f\024\265\300M\322\202\242\354\200\365\250\237\262\215\365\242,"
+	.string	"\346+\240\031&m\027e\277<zG\007\216\233\367\242,2\356\350\023\224\245rN1\245\226\2572C(\310M(\353\344\274\002\257\347\241\363\240l\326\255\361\240\254\326\362\026dDV\306\203y$\337\332\205\265\236\202\033\257/7\237\254\324\252\346\273'{\347\32176\3024\343=Y\344z\343\021\263\b\217\324j\347d\231\326g\320cg\320\200\234\354qy\001s\372\210q\335\021-,\323\333s\306:\252\252\252\212\264\200\326\025\376\265!\250`\317\346\354\316[\276\231\245K(\342\362\021\326\372\314\274\227ZT\316z\363\371\033\204\363_j\321\267\345\017(\247'f\300\324\242n\326{P%/;\317\245\026%\303\274\221\231\330D\307\254or\024H\370\\\036\035\003\026\226\270RZ\022:o,\204&ip\211\227\332/Z\237.2\31380\265\027T\276\201\232\303\266\250\324\036Pi\225\332\327q\336\213}fv\354L\355\317"
+	.string	"^\003\03206\250\324\236\f\340\227\023\340\177\227\\\363;\246\366a\224\227\342K\366AS\013%\356\037\363z\304\246)\265[z\2515\342tdd5\224\332\"\200\003R[\204i\350C\251\025\262>*0\214\242\026\363\023T.j\t\234\247\200\005\214\316v\251E2o\025'\2077\345<\023\244\272B7S{'\242\324\236\231(\265\f\254(\265X\177\200\255\250A\f\207\261\216\214\210\210L\220\0244I\007\360\002\261\3316\007\021\260\030\202J\031\"\020\"\"\221$\031=N/*\250\2238\321\336\227=m\305:\300\324\243M(\013y\r\333\266[C\344\303\244<\361mc"
+	.ascii	"\343\033)\277;\340\267\f\233\276y\302\277\324\356\2716\t\260"
+	.ascii	"\216\226\237\331\246I\344=\036\237\377kc\341\341\365\263B\210"
+	.ascii	"\273\025\241N\353?F\3638\347'\2023\2008\341\275\354\312\033 "
+	.ascii	"\370Tg\355y0\366\017\330o\302\030\001C\007\341\323\232\0264Z"
+	.ascii	"\324\264\240\321\242\246\005\215\0265-h\264\250U\007Q\222\\B"
+	.ascii	";-9\020[\206$\022\367t\265[q#\272\b\374VgE\313X\200vh\314\317"
+	.ascii	"&Cm\372V\270W\033\n\232\305\323\357\272D\233\272\366\356\230"
+	.ascii	"\334\034k\202\202BRRg\321\270\373|\236\263\333\257\273`\335W"
+	.ascii	"\007<\326@DC\374\214\350\333VC7\234\300\025Ga\3515nL\217\364"
+	.ascii	"\371\224\274[\342m\233\226\263\231\302\337\215\344\340\323\314"
+	.ascii	"<<\2371;g\265.\255%\243\300\013\217\024\276\232E#\336\243x\346"
+	.ascii	"n\360\201\024s1\236V\003"
+	.text
+	.section	.gnu.lto_.refs.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\240\004U\031"
+	.string	"&0\217H\260XM\322\001\360\311\203\031\b\236\305\004u\331\n\001T\303H\314XO\024\027\033\302\3075Ax\315\177J\177J\177J\177J\177J\037\332\320\021\211`,\037\277Z\365\243(\212\306/\365wT\373U\257k\335Zk\2735\"Si"
+	.string	"r"
+	.string	"t"
+	.ascii	"\336\007\360^\206\223\177\363u\232\356\303|/aV\267\344\307<\305"
+	.ascii	"\321p\237\352~\351\206}\275\365=\013\025W\201\241\367_~\202\317"
+	.ascii	"\3457wq\331'\237'\377\225\303\344\277\344\177\335w\335-\3403"
+	.ascii	"\365X\302\021\366i\200\217 \377\366u\001\371A\371?\336\357\344"
+	.ascii	"\303\362m\262\273\362[\3712\331U\371`\367\345\216\254\273\306"
+	.ascii	"\373\311!\261\214\367\274t\362s^3\257\236\262\351\33650w\031"
+	.ascii	"\2634\334\252\354/\3313w}\263\302\236\002\337%\336e\004\340\265"
+	.ascii	":\323\271\354\315(\023\247e\027\362IXW\211b}\344^\305L\024v\241"
+	.ascii	"\260\307\302\316\003\276+\252\276\377\261\003\365/\201\177\216"
+	.ascii	"\032a\277\201o\313\257\345\017\241:P\276\f\365?\371.T\234\003"
+	.ascii	"cV_#\263\027\350~@\276\255\373Y\3616\270b\345\351(\376\023\243"
+	.ascii	"\276\022\243?\211SQ\037I\321_$\34371\001\341\241\303\326W\312"
+	.ascii	"?\311\366\333\360\376\226O \037)\377(\337(,\r\374Y\330e\340\307"
+	.ascii	"\262\353|\rQw\325z\213\350Y\265W\325z\212\37384\255\016f\025"
+	.ascii	"\352-a\357\300\203: Y,\376\364\210\352\375\352\023{x\272\243"
+	.ascii	"\323cN\274Y\234\336\306\233^\3138\355\3653\330\007\237\024\317"
+	.ascii	"\021W\212\f\270\3437\342"
+	.string	"6\342\002NA\002\004\267\016\332\364@\r\264@\tp\003*\240\307,\250\036\261\\\251B\345i\212\024(L\2268\0351B\244i\bS\020 >z\360\330\261\224\364}\234!#\006\214\027-X\254Pq\202D\210\017\0368l@\352QC\006\f\027,|=V\230 !\354\021\002\370\361A\026+U\236\242@q\322$\354M\002~\235\216\020i\022\022DG\355\253t\003\351KcF\f\027-R\2400Qb\204\210\2147\004\210\257\267\003\206\n\337\227B\004\357\373\340(\200\231\250Q\210&\030\261@FFI\222$\255\001\240\"+\242u\020\300\245\220\016@\b\005)\252\t4Tz?\3336t\357q\r\326/\006\236@$\202S\201\037\025\252S,\214m\334\312\004\013\223\310, \002\253F\031\221\333*\025\266H\252o\333\n\350]S\2135\007\303\337u\252f=\224\035i1\bw\007\026\275\2045\226\226\032\"\020\341"
+	.string	"\005\241m\364\205\335>\251\2577^\220`\265&\2233m6DG\031*G\364=\302\266\230\261]f\216T\306\037\323\254\2515K^\024\033\202=\307&+N\024\022( \252\367\001&\220\324k#\177X\023\262\030fqQ"
+	.string	"\337\020\2574\323\177k\006\207\b\354g r\350\205\205Y\316\227\200\017KU\305G\2278\177Q\343\033\345\347\2156\004\365\313,\032\3243`\2404\257\312[\034\301"
+	.ascii	"\254*"
+	.text
+	.section	.gnu.lto_.decls.1a7707b3ec91de11,"e",@progbits
+	.string	"(\265/\375`\323\272\205\357\002\316\247\204\201\020R\020(\205%5\006Kg\\\304"
+	.string	"\327\263\343\203\364\224OS\342\017G\235\372\344z:=\0079L~\250Qs\304z\030\320\027K\242\331\317\234m\235Z\303("
+	.string	""
+	.string	"\354\fB\360\2609\n\004\002\303\333\200\322\271-(\2128),\2175#ir\313-\267\224)D\016\306\020\037\021E\356\035\312\\\252]\216\3349Q!\250\326\225\037\364\211F\351"
+	.ascii	"%\325>u\231\270\343\202\263{\276\305)\203\263\023\273s"
+	.string	".\235\26128\273'\232\225\315\320\037x\352\272}\265ON \\\3519\363l\206\321\340.\036\200\250\265\030\013\377xr\005g\367\274sNaW\250\023\372\244C\r\313\301sz<\201\263\023\303UXG\024\256;w\367Py\002g'\026\244\225Q\266\301\225\032\234\335\363\tSMq\222{b@OW `=ab?\270\356hh\231\225\206\031t\2208\333\266=\352\365\243\\(\221+'\346\235\273u\036\302\324\360\023\206*\021\346\004g\367D\377d3\024\020\332\347\356\n\316\356\211fe3\024\310\275z\203\263\023\313f\250\035Nk\257\006\020H\315K6\303_0\227\353\326l\237\272<\f\341j\263\031zw\3570\bT\006g\367l[f\232eL\027\251\013%\377\254\275D\232\207\001\312>\006'\373\030\272\3661\330\330\277\320g\377\302\233\375\013i\366/p\331\277 \266\357\005\257\215[\264\017\312\007\367f\304\325"
+	.string	"\303y\017\207\016\314\325m\341\374\013;\364\240r\267\211\316\241y\346\3208\314\005-\263\342\3318\"\306\211\316\241N,v\335\232m\233\203\203?z\340\354\236A@\200P\361\242\363/\320\330\027z\356\013\305\355\013\271mlu\207t\035\254\3064\"\005\347\013\255\355wP\205n\251\005\356\322\005\235\204Z(\270@\313\266e\376G\347\240qP:(\034\364\315m\242rP7G\247\240`/*\361\243brP*u\350\230\034\364\nZ\306\304\f+\024\274"
+	.ascii	"9\345\240g\3207\0233\254P\200\372\343l\333\026D\017,?\362\374"
+	.ascii	"\362\205\232\373BU\366\333\217\216\241fP\267\337\037f\331\226"
+	.ascii	".:\212\235\324\030\234\377\243kP5h\033\312\3466\3216\350\226"
+	.ascii	"(\266\34311\303\2127\003\256\315\331\266\3146h\031\032\345\206"
+	.ascii	"\0266xF\033\024\315\245C\231K\325\213\327\032\264\r\232\006O"
+	.ascii	"\241\314\264MC\213\032'\b\0207\320\031g\233^\276\020\224}!%\373"
+	.ascii	"BF\366"
+	.string	"\205\206l}\224y\264\314\217\222\241VP2?\236\023\254\2540\234\307\024\251\200\256\226\200\341|\241\033\373?\232\206\252\335&\272\206\212)b\266-\2305\264\f\rcb\206\025\257\n\352\216\263m\231$J\240k(\332\245\273nY\255\223\036\017\254\2441\213@\200\350u\321R\033\323\371B\355~\320\235}\206\2021\273Z`S\266p~P\23133\365i\356\206\227/G\315\342\322\262.2k8\243Z\320\346\177\236\032\266%\212[\363^R7\"=\270\340\334\205\251\306\201]\361\203\363\203\262l.\350\226`\220*-\031\234\037\344d\243Y.\246\252H\016,\234\317\207\227\261\324\306\326\340\374\240#\033\3052\342(3\004%D\252\340\214\016\3319h\307~\220\324\276~v\217y\211\364\375\272C\032m\357\220F\241,\275\340\210c\207\363\203q\366o\023}\202.\247\314\315\24599\272\374I\2248\332\257m\311\332\266\355"
+	.ascii	"$c\243C\ng\024\t\332\344?/\350\311N ,\234\177\264\t\312\204\327"
+	.ascii	"gKV\025\234\227\370\302\310\326v\340\374\340\232\375\3776Q%h"
+	.ascii	"\222\377\277\314\266\350G\003\211\0310\234\037$\263\317\207w"
+	.ascii	"\247\210\241b\206\363\203Vv\0162\331\017\376\330\017\332\330"
+	.ascii	"o^\"}\340\334\316K6\373@/\373@*;\003\213\354\003w\354\377\356"
+	.ascii	"\366\177tvNC{\374(\rT\n\345\201B\251\001\004\n\316XE</\271\037"
+	.ascii	";p\376\017\315~\007SmK\324\n\275Bs\240;n\023\325\201\3428\336"
+	.ascii	"B\251\236\231m\013\246\354\206\0322\033G\013F\t\2657h\254Y\312"
+	.ascii	"\241:\320\252\r\274\301\331\211\201\330V\270\354\301\321\313"
+	.ascii	"\377\221\355\333^\"\375\237\222\375\337\327\376\257\310\376\257"
+	.ascii	"k\377\247c\243\355%\322\034\334!\235\1775\366}\201\366}v\366"
+	.ascii	"}fvj\245e\337\307d\337\307\265\323\255;\244\357\303\261\337\373"
+	.ascii	"\363\001\377a\006\375\236x\210y\303\371=\347~\217\315N\227wH"
+	.ascii	"\277\027fO\320\031>C\322p~\257l\277\267\3348\017v\336\346\313"
+	.ascii	"`=\347E1\333-H\3168!\301\371\275\257\035\243m\333\366\276\214"
+	.ascii	"V_F\277gc\237\367\334)\023\316>Om\237We\237\267d\247<\256}\236"
+	.ascii	"\216\375]\267\277\343\366\367\233\235\272\245\331\337f\373\233"
+	.ascii	"\312\376^\356o$\373\233k\353\275c\177Smm\365\334z+nk7[\335J\373"
+	.ascii	"\261\230+w4\334F\217\326\023\347\253f\366\357\016iu\371e_\025"
+	.ascii	"\333*\363\016\351\253D\366U\253\255\246\335!\215\273\374x\f\223"
+	.ascii	"a.\230\315M\316\027\316[\212\034 \347J\017\234\257F\355\3372"
+	.ascii	"\346\225e\031\276b\305\251\005g\271M\\\206\261d&\b\020E"
+	.string	"<*\\b3t\276\372\264\257\373\354k\347\276f\333\227y\211t\321\035\322\252\333\035\322\230\312\217\203`!X\f\373\214\250\001\224\205sX\321\016\223\304+\f\347\353\263\375K\366\2170\222\306\211\267\274\200\244\221u]a\033Q$\315r\310\0226l_`i\234r\\G\273n\315\2734\303\206\267\210\034-\310k[4ci\030\n^b)x\nv\202\243`0\314\004?\271M\334\004#9N\202\225<\343&\370\310\321\202Q\314v\211j\307j\356\312\263m[\020E |YiRs2\344\353%\033o]\"\215\301\035\322\327B\366\365\217}\335c_\357\330\327W\373\232j_\337\330\327R\373Z\306\026\272C\272\202;[\273]\"\375;wH\253\351\331~\n\266\237n\355\2476\366\263\236\275\335\324\354g0\373\271\n\276z\031\274\325nH\253\314X\211\302\371\271\310\336\316;\244\237\263\3663\325\3065\260\215\333\314"
+	.string	"\337`\006a%\201\276h\301\371Y\306\376\315@\243ww7\003}\224n\037\265\263\237\226f\037\315%\322G\3136\257\275C\372\350\223}\357\360\265\303\355\357\335\rt\022%\376\213\272w\271m\237\356\265 x\257\005i\031&OZt>\252d\037\375\261\357\363\376\271M\t.\240\223(q\324)KK\326\266\314 \240\035\025;:\234\217\346\330\277\022\350{w%\320\307w\373\203\235}\274\266yVwH\337-,\217fsV\346\004\347c\256}\355\334;\267y\343.\236\234e\253\335\322\266L`P\313\204H\034\316\3077\366\357\007\035twwww?\350_\347\376}\333\274-9q.\034(98\303ani\333\226\003\212\346\f\223)\234\177\303l\270\353\3466\357\233\333\306\274o(3m\243yM9\337\\\265\313\026|\022j\243\274n,\333\266\345"
+	.ascii	"\002DO.\311\017\235\335\212\200G\266\246\f\301\371w\n\233\273"
+	.ascii	"6w\315m^6W\315\0266\027\3145\013>1[\253\002\330\331 \203\376"
+	.ascii	"\331\262\306\251\363=\260\237\201\375\3374\277l\377Es\313\266"
+	.ascii	"\264m\273\301\247\303\215\216\017\234I\214\370M\243\305\310p"
+	.ascii	"\375\3019\237\271e|f\3139183/Z\360I\250m\233\2649\315\\2\267"
+	.ascii	"y"
+	.ascii	"\313"
+	.string	"\224\271jw\314u\373\312U\3028\333\266\005\301\001D6{z\261\351\374\337\265\3371\327\354nmPs\220)[\303\371f\031\361\2736\244\255\262\230m\263m\333 4\315\314\214:\234\177\264\177\265\234\245\371\257\230\233v\303\334\346E\373\357\225\213\345\230\331\266Qm\333\376\226m\271f\301\264m\267\330\226m\333\276\203\177\304/\332\005s\315:\310h\333-$\032\234\304t\321\361l\333\026D\021\b\020\311+E\350v~\b\373\037\354\313\345v\271M\016\367\313o\226\253\345\351\023\263e\266m\033t\345\276\240\256p~\210\375\353\345C]m\211\003\267\007\332\366r\320\367\356\356r\320\347m\241K\244\361\035\322\025\\\"}\2749\270DZ_+\377\035\273d\031\240RS[m\263m\231\027v\324\23032\234\317\274Dz\337!\375\3539\277\246\363\253\017\370\257\363\277\004\350\342Fu\300\177\365\334=?\336\377\345\363k\246j"
+	.string	"\034\324j~5\202\254\206\005\360\343\t~\314\"\205\377\031tH\261\204\211\370}\307\037S"
+	.string	"\005\351\307\036.@!]\342\243"
+	.string	"[\210\377\232\370\300\203\377\200\322 $\307\340\367\271\3701\b\\#\374ZM}\361c\241\224\203\220\003\374\370C\032tSd\001\177\337\210?K\375Y\311\237}\374\331\354\317]\177n\376\331\310\237\273\374\231\371g\261?s\371\363\227?\007\371\363\217?W\375\331\311\237\261\374\231\354\317V\376\334\343\317c\177\226\362g\252?\323\3703\326\237\205\374\371\311\237\227\3749\353\317S\177n\362g$\177\376\372\363\221?O\371\363\323\237\231\374\271\312\237\265\376\f\345\317V\177\006\362g\256?\363\370s\330\325\237\257\374\271\354\3172\376l\343\3175\376<\344\317a\376\254\343\317^\177\006\373s\222?\337\3703\225?o\3713\221?\343\370\363\226\226?g\371\363\362\317`\376|\366\347\"\177\316\361\347\031\177\366\362\347\250\246?\263\177V\376\231\351\317\311?\307\370\321\253?{\320\223\340\307\024"
+	.string	"F\360c\005h\337\206\313"
+	.string	"\315\033\372q\005\351\317\367\247e\007t}X>\020\026\004[\372q\007\215\376\324\016\372\376\320?}\242\272\3701\005P|\353\217C\270\335\035\256\340\327ap\003\376\254\341\307\275\f\301\257\363\250-~=\2476"
+	.string	"\247\360\337\252\037\223\360\347\"|\0026\300\217G\370u\232_\367\371\325\024\376K\200\037;\340\277&~,\201?\255R\031p\255\276\364\257\351T\024~,\342\177\236\037s\370\357\325\2173\374\327\311\217Mp\361_(\177\336\360_\035\377\305\3721\006\377\345\361\2474T\0261\324\023\376\f\225*\251&\374\251\t\352\0020\005\177\212\364?\216Z\002.\241\222\360k;u\305\237^@U\361\253\372WGP\325_M\361c\n\240q\370\367c\005\340\r?\376\360\343\016?\366\251(~<\001\236\352\313p\262\236?\235\223N"
+	.string	"\204*\302\177<\377]\376\231\216\002\035\036"
+	.string	">\252\210g\232\346\304\257*\340v9\355a\277/\314\257\223\374Z\311\257\036"
+	.string	"\3630"
+	.string	"\376\003\312\200\226\332\376{\342\246x\323\302\304\303\022\t\374\351\007\324\0204S5\300\217\003\360\343\b\374\007d\342\277#\274H\203\244|\0270\211\037o\360\353(\277\226\362\253\005\3701\005.\003\306T\020\260\206\377\216@\201\240\263\270"
+	.string	"~\337\375\323#\252\211\037\023\375\377\302\301\177@/J\277|\r\320[\331\203J\200\037\215S\300\177@+~\\\200\313\200K\360\367\260\244\021P?PK\374\351\0030\002\376\003:\201/\374\270\003\n\374\357\020"
+	.string	";5"
+	.string	"\177\361\022\177\317\307\321\337\207Ew\371S\"\325\203_\233\375i\221\332\301\217_h\301(\374\030\305\217C8 \215\301\237\232\375:\314\257\222\350\360\034\350!~\237\005?\326"
+	.string	"\247\370\3218u\204~\362"
+	.string	"\254B7\371Q8\225\203\037c\370\261\004\030\030B\321\213\333\251\"2\240\374\314\201N\200\2777\367\343\003\374\351\004T\020?Vq}\252"
+	.string	"~5\203\377o\277\372\341?\234\217\371\277\346\225\243\374\271\317\003\360\277H\r\300\237\001=\316_\334\303\337S\373\261\b?\036\372q\006?\206"
+	.string	"\332\1770\377\313\374\027\363\247\tP+\370\365\3765\217_\245\340\377\013u\002@\347\360\367\302\272\270P\374i\0205\202\037\203 \304"
+	.ascii	"?N\300\177\205\322\266\260?\345\241B\360\343\016\377Q\270\357"
+	.ascii	"\367\211\270\300\341\317\022\374y\202L\301y\277/\312\217\213"
+	.ascii	"\3140\371q\004d\220\3748h\255\310\2573\374:\350?\376\177\032"
+	.ascii	"\3748\247\277\372\373\206\374\230\001\267\363\365\370\261\372"
+	.ascii	"\247\021\250\034\376\243p\375\373\256\322\340'\200{\177\217\306"
+	.ascii	"\257\026\3454\025\303\367\337\3430\202z\241\003U\310\351\327"
+	.ascii	"\021\3705\005~=\201_W\340\327\027\370\017\313\257A\370\365\001"
+	.ascii	"~\035\302\257\013\360\353\017~m\342\327\006\370u\002~\235\201"
+	.ascii	"_+\375j\320\257=\374\272\304\257=\370\265\360W\203\377\205\376"
+	.ascii	"\037\332\257c\374\277\377o\356W\201\277\352\373U\336\257\252"
+	.ascii	"\277\276\373u\335\257\373\374z\317\257\235\277\246\363k\270_"
+	.ascii	"\263\371\265\232_\263\375z\355\327a~}\366"
+	.string	"k/\277\326\362\353\262_\223\375Z\312\257\237\374\332\311\257\225\374\332\353\327\\\277\346\361\353\035\277\236\372u\323\257\221\2776\376Z\351\327\031\3705\322\257\205\277^\361\353\021~\255\200_\023\375\032\370k\337\257y\277N\377\024\313\237\202\375\032\375\365\375S(\177z\367\247\201\376\024\320\237\362\371S\271?\315\363\247w\376t\316\237\306\371\323\267?]\362\247_\177\332\346O\271\376T\310\237\266\375i\217?M\363\247f\376\224\314\237\256\375)\332\237\236\375i\363O\177\177\332\345O\267\374i\331\237\206\375i\224?e\362\247H\376\264\353O\265\3764\353Os\374\251\325\237J\375i\373\247M\177\272\364\247I\177*\374S\n\374i\004\376\364\001\177\372\342O[\374i\n\177\212\302\237\236\360\247(\376g\360_\006\374\351\211\377j\340\277\354\237\321\3764\001\377\277\374\371\202?O\360\247\021\374\330\204\037[\360\337:\377\341\374\351\001\376\324"
+	.string	"\377m\372q\372\343\013~\274\200?\355\360\337\024\177Z\364\247D?\n\367\247\030\376\364\302\237\006\375i\360O\361\177}\377\001\375\351\377\333\3759\320\237\001\375\371\371\377\305\177\024\376\334\347\317|\376\274\347\317r\177\236\373\263\332\237\323\376\354\341\317\030\374\031"
+	.ascii	"\177\266\340\317\025\374\231\202?\007\375g\361c\013\374w\361"
+	.ascii	"?\316\1773\377\311\376w\375o\373\337\301\335\335\335\335\237"
+	.ascii	"\341\303\357A\356wB\022\273\371\245m7\323\302\214a\031l\226G"
+	.ascii	"~\300}9\267\331\031\333\022L\232eT\0304\313%8xX\333\271\001\241"
+	.ascii	"\314\264\025PwN\032(\221 \316\267$ZF\0229U%\314`Y\342!r\212d"
+	.ascii	"\221\261a\262v\206\241\346\350\032<\254\035eOA\231K\025\\\002"
+	.ascii	"9\3134\227m\313\004\253\3232\276\216\370@\307\272\254q\216\361"
+	.ascii	"\2606S\315\021t\022j\333\"q\3133\227\016\316\225\261-t\234\274"
+	.ascii	"\032\274%\274\037\2743\236\027\357\013\357\b\317\013\257\214"
+	.ascii	"G\205\327\205g\306\023\302\003\302\263\342-yL\236\025\336\025"
+	.ascii	"^\026\217\2147\205W\305\223\342\361\340i\361\240\360\230\360"
+	.ascii	"|\360p\360\234\360\222\360\220\360\276x`<(^\023\336\030o\b/\n"
+	.ascii	"\357\212\027\204\327\305\353\301\023\343E\361r\360\260\360\262"
+	.ascii	"\360f\360n\360l\360\266xbx;xDxa<%\274)^\025\036"
+	.ascii	"\027^\021\036\025\217\213'\205\267\205\247\205\367\204\027\206"
+	.ascii	"\007\206g\204\247\203G\203\327\344\311\270M\036\326\276;\257"
+	.ascii	"\3459\2414\334\224\214\240\303S\201\226(\031\333\230s7\311|Y"
+	.ascii	"\352\032at\350X\026;K<$N\021\037^\360\224\f5K\032o\2068\373\250"
+	.ascii	"q\262$\333k\3404Yj\031\274'9@\226[K\035g]\235\023\365!\346\264"
+	.ascii	"\003\344D\311"
+	.string	"xX;M\021\262\335\344am4.b\234m\313\274m\177\274\260\334\254|\021f\366N\273D\372\332\270C\372\"\276\354\213\250\262/\002\311\276\210\037\373\"h\354\177\353\371\006\364\357\270\235g\377\271;\322\254\211\301\371\211\332\331\020c\005\347\213h\371\354=\273\317\236\273\315\355g\313\351h\342\034\341g_\211\345p\262\334~\366\016&)\222,9\270^~\210?\373\242\031\361\255'\023\351S\005\005\347\207\340\263\257\363\022\351\t\356\220~\b\270\375\020g\373!\260\354\207X\356\207\030\262\037\242j\177\003\272\375\r\334\354op\266\277\001\225\375\r\222\354o\340c\177\003\251\375\001\344\331\037\300\233\375\001\240\331\037\200\226\375\0018\331\037\300\220\375\001\340\330\327\300n_\203<\373\032\244\331\327\300l_\003*\373\032\030\331\327\340\307\276\006N\373 \350\354\2038\263\017\302\312>\210%\373 ~\354\203x\332\027@\236\3759\227H_"
+	.string	"j\366\005\340e_"
+	.string	"P\366\005\200\265/"
+	.string	"\250\375\017o\366?\250\355\177 \333\377"
+	.string	"\266\377A\311\376\007!\373\037l\354MeW\271\315\242=\346\006\212*\b\316\377"
+	.string	"\265?\320\336\"\375\273[\244\237\201\235\375\f\326\3663\370\262\377-\345{\312\277\241\240^\332\016\006\222`\351h\203\363\035\033\361-%\b\016\215O\023\234\237\201\225\315\273C\372\031,\3673\370\261\237\201\216\375\f\242\366\003 \267\037"
+	.string	"\267\375"
+	.string	"\210\331\017"
+	.string	"\226\375"
+	.string	"4\331\017"
+	.string	"\220\375"
+	.string	"\334\330\3776\202\323\256\340\360!\265\213\334\251cf\274\232D\274`de]\301y{\335\240\016.b?\2728\250ajC\214pI\300\344\201\203\310\336\332C\316\216\240\265\301y\017\331Z{\24681q\026\342dN\r48\337C\240\375\177\367\330@\266\217\375cg\335\346\016\262\261\344\256\232e:\256,s`Y\266m\273\303\312r\007\331M\\Ez\202\274a\363\313\367\360g\337\203\235}\017t\366=\310\331\367"
+	.string	"g\337\003\334\376\267\325\231+k\206\340\254m\344\210\223{\346qf\211\223{\3466ncr\224\315\001D7\006%N\356I\346F.\373\311\31717#4\216)OqrO7\031.\307\361@\355)N\356\351\364\224\336\320\201\001\225\374\366g78\360T\003\262\304\311\211\251q\242\254\305\311=3\235:kqr\317\215C\005\264e\250s\233\206\332gOm(\325\251\352Q\353l*\365\217J\247\342\3315v\273o\250wT>\352\236=C\r\244\312\251~\324\247j\247\306\251wj\235jG\315\263\253\266\324\266\261\235v\324m\356'U\316\3259*\235\375\244\302Q\337\230\210\342&.\373\371\263\306I\203\215\027\023\036\373)\365\221zA\313\254\026\240\205\312\024\016(C\332d\211\223\333\303\201\225\2478\271g\033,\205\247L\250\255\351\221C\355\230\230a\265"
+	.ascii	"8;\316'\253\024\313\304\f+\236\r(2gU\230\\\234\3343\273\311r"
+	.ascii	"\356\035\006X\344\354\356\320\330\245-\025\2718\271\247\034\246"
+	.ascii	"\272t\036\250A\211\223K\251\322\033M7\373\211\316\231\335d;\227"
+	.ascii	"\316\003,Y\342\344\266\366\223\3726\245+\216l?\245_\3245&fX-"
+	.ascii	"@\213\223\314g?\345>Pmr\335~\312\201\306\272\342\344\236C\366"
+	.ascii	"\223\3526\005J\\\306\263\237r\234\225\26584\313Y\240\272\023"
+	.ascii	"\362\345\301\274D\032\303\234;\244\357A\315\276\007\264}\017"
+	.ascii	"L\025\216\027gNH\023\347{\b\333\367\360"
+	.string	"\265\357a\310\276\007\035\373\036j\354c\240G]\363\3433iSU\363\313\2616\265\007\347\266\355$\362\324\006\347c\360f\253hR3\025\314\304\f\253\025pY*\032\265\212z\006-\2632\001\316G\032\225\3556U4j\330U1\225\312\213\212\324\033<\264\266\350l\306\307&gJ\b\316\307`m\223\255\251jX\316kj\271\246ZQ\305\240eV+\274n8\3255\025\r\247\215\350\212\223\023+\243\222Q\307\334\246\272\246\246\025]\220\266d\356|\f\262\354c\260\334\307`\311\026\363\253c*\231\032\006o\265a\311J\303\031L\257\016j\356\t\316\307\200\310~\007eL\033p7\270\274\fZf\265\273xM9\311\260\250_\324.jS5S\317nS\365\242f\271\252E\335\342E\275r4\031[\006\360$\212\252\345\006M\332/\037\203\255}\267.\221\316p\207\3641\310\332\307\340j\037\003\033\373\030@\355\003\240n\037"
+	.string	"\317\215\272]\"\035\302\235]\304\274D\032\225\272C\372"
+	.ascii	"h\263u\004\221\021\253k\202\263\256ac\307\324\230\034*f\347\322"
+	.ascii	"\201M\215\311\211i\0314\264T\207\032<\246\306\344\236x\240\340"
+	.ascii	"\200\303\342l\333\366\217\\\312GkjL\356\211z\305I\347\260Y\246"
+	.ascii	"u\304\306\324,}\003\247\001Qs\244noi\233\0165\332\366\211\212"
+	.ascii	"\27265&\367\024K\343R=J\324\345\324\230\3343\277\2419S0\177\032"
+	.ascii	"F\314\275S\345\246\306\344\304n\237\364\316\275\363\241J\231"
+	.ascii	"\032\223\033\323S\030\220\226j55&\367L\325\324\254t--\323A\206"
+	.ascii	"\232\2511\271\347\237\264\217\206B\313\254xTZ\304"
+	.string	"8Q\032at\031,\372Y\342O\177\250Y\352\225\232\243\003T\237\2511\271\347\0205\372mO\276s\307\231\236\271\232\225\242I\333\240eV(x\325q\212\321\251B\303\214n\033\323}R53vP\261<\347\n3K\277Q\255\230h\347\324\230\334S\315J\317.]\007\250\266\325\022\242\356\231\032\223S\263\364\025\r\006\316\212\227\372CE\242&Q\261T#*\227*D\335R\227\250;\324 \252\023u\210\332D\225\242~\251PT%\352R-\242\366Py\250Q\324)*\023\365\210\372D\325\241\372P\211\250Zj\227\n\3446\325\254\364\n\375\243\243\256\031T\230\245\226\241f\351\031wL\007\031m\373$D\315\232\032\223{\246a\324\2544-\217S,+u\223\302\351P\243m\273\226\250iScrO5KSi+OHt\335\324\230\334\263m[^\222\037~\326Td5\307\217b\311t.]\322\211\217.8\037"
+	.string	"M\266Z\025D\344\310\023\034\234\017"
+	.string	"\255\rG\337A\231K\025PT\316\033*\225:u\233*\216(\025\207\306\243:\231\230a\305"
+	.ascii	"(\034N\025\207j\343jP\346\223\266%\022D\017\231\n\003\313]\276"
+	.ascii	"\322\f\331\371\027\300\355_,\1778\\\267/\005@9+\263\243\342T"
+	.ascii	"\235t\234~v\200\222:\001\r\230-\272\227\t\362\332\266\253\271"
+	.ascii	"\fT\305Y\367\341\2725S\244\221\251N\372\356e\202QBmT\0231\325"
+	.ascii	"I\003\342\340\001k*J\332S\245\241\326P\237\324\031j\224*C\225"
+	.ascii	"R\241nSuR\333\264\013\227'\035\206\374\013\264\366/\350\261\177"
+	.ascii	"A\325\376\0054\366-\260\333\267\300\317\276\005y\366-\200\343"
+	.ascii	"\007\214S\0367U8\337\0022{4\237\333\324}\2643\217\226#\202g\331"
+	.ascii	"G\317i\271\016PR\355\023\221\r\326L%\331\363D\305\330\331\303"
+	.ascii	"E\347[\240c\377ZN\353\261\263\"\304\016g\255G;\2578\231\"\202"
+	.ascii	"\363"
+	.ascii	"+\240\333\257`\317~\005x\366+\210\263\177-\347\372\316\257\335"
+	.ascii	"h8m\007\003m\033\365\245F\033\r\2345\035]\347\332\216\236\323"
+	.ascii	"j;\036l\265\355\223\266\023T\327\266OA\367Zp\257\005\271\212"
+	.ascii	"\227\0233\235_\301\333\326qF\\\313\221\3615\225\003\347\f\356"
+	.ascii	"\220~\005l\373\025\224\331\230y\211\364\207;\244\265\033\233"
+	.ascii	"\344\2248.\234_\001\026\335F\263A\2238\351,\365\232k6Nv\316\344"
+	.ascii	"\210\245\321lhxS\260\276\334\351J\203\206\027\207LL\2373\327"
+	.ascii	"hP>ZF\230\244a\311\302B\003\242\311\\)t\0258\3511z-\352O\026"
+	.ascii	"6j$J\334\273;\026\007\347\007g\215\246\323\366\262\312IFZ\232"
+	.ascii	"#\bM\233\335\0171<=p\332|\211\271fE\236\210\031\303\371\024\314"
+	.ascii	"\355,E\250\227(*\330\3546\365\231\306\322<\323L\375\345\313\030"
+	.ascii	";\347\257\255\361G-\347_\177\271nRQ9\245p\326^xjv`\245\301\371"
+	.ascii	"\024l\331\277\346r\233\272\313\007\256(9p>\037\275\345?\017\037"
+	.ascii	"\201\223\007\020\316\277\336r\255\305\252\365\342\003\347,\355"
+	.ascii	"\225\233,8\237\002(\273Lc\301\\Oo\256p>\005N\366)\020\262OA\026"
+	.ascii	"\231\035+=\272\340|\n\246\250\350*\267\251\307\264\216(=\246"
+	.ascii	"\253t\016:scz\207\016\273nYBmT\\ '\210\333\305\214\235\234\316"
+	.ascii	"_Z\312\235%\230\236\242\305nS\207]\207i,\255\025t\272\320\266"
+	.ascii	"F\352\226:L\017\321Ft\036\2509\253'\b\337T\021!N;\377\327Pt\224"
+	.ascii	"\333\324R\364\223\242\016\226\350\345u\313b\2669\202g^sVR4\022"
+	.ascii	"\255\244\003\224\024\td\3548\367\230$d\220\350|\n\332\375\353"
+	.ascii	"\245vR\003-\212\034&\272I\017+\313\215\f\316\237`\317f\362K\365"
+	.ascii	"DF\033\316\237\300\316\376m\036\217N\362\270\254"
+	.string	"D\r\017+8\177\2028\373\023\264\331\237\240\315\210\336\322^\327\255\231\202M\234.\242\217\334\2466\242\211h#\232\007[\036g\320I\2241+:\177\002\264\235\303\242\274\254\301Ywi\256\026\b\214\023RF\n\316\237\200\313\376\004W\366'\250\242\203h!\267\251\2654\020\255\245{\350\037\035\240\244J\320\002\244\2654\217K\347s\022e\316J%\262\206%\211\316\237\240j\377\372\207\366\341C*L]z&\353\r\023\235\245u\324\261\321\306\341\374\t\244\366'h\367%\360\263/A\334\276\004n\364\225\227\256+b8_\0024\332J\202\264}\t\300\354K\320e_\002\260}\t\230\354KPd\337\251\245\260\034N\253\233\301\003\347K\220c_\002\032\373v\240\333\372)H\207\020/R8\277C\234\375\016\264\322?h\231\3256;\342\304\231\336i\247\333\324m\n\2509B\267)]j\207\201\037(\270\347\263m\231 \212@"
+	.ascii	"\315\236t<t\256K\003\005\335`BC\t\316\357\360U\327A\310~\007"
+	.ascii	")?\351\023\347\340\222\244\316\017\235\271t\317\205\353\003\250"
+	.ascii	"\006\333\\Z\236\324\2112\305\244q\203\363#\310\222'\002\260\375"
+	.ascii	"\b\226\354G\240\265\037\301\325>\004v\373\020\304\245r2\2175"
+	.ascii	"E\232\340|\b\342\354C\200&}\023\344\326\304\214\030\234\017\301"
+	.ascii	"\227\024\016\002\262}\b\230\354\273\274C\232\315\225\"\003\213"
+	.ascii	"\024\234\017\201\0175\267\231\256I\323\254I\331\3226*:\234\324"
+	.ascii	"=\333\266-\002q\201\264A\265\311\271\r\247\245\321\3111\005\347"
+	.ascii	"s\250\333\3470g\237\003\232}\323\274\354\264\314\035s\177O6)"
+	.ascii	"`8\247cF<%3A\2302j8\253"
+	.string	"\034\306\366\345\300d\237\303\220}\016:6~^\"}\016P\373Et\373E\316=\242\275D\272K\330\225W\021\234_\004\267\177\3730\355\322\037\251\2264H\2353\345\222fI\267\244e\267\231jI\261<\355\221f\245?\264\244@\002iI\265\322+\301\252(]lO\324lk\316\226^~\321\231\375\"\263\235^\371\323\037\251\220\324\312\r-[Dp&+JgLM\211\301\371Ea`i\225T,\235\222.S*\251\223TJ\n%\215\222>I\303n3\035K\225<]\2222\031\002\327\305\366$#\222\202\254\2163\335\342\302\343l[f\022\234\246\355h\351b{6\321L\346\272\330P\262t,\355\n\241\312\035\032F\346,\277\330\f9\202\323\202\274\266}j\263L\307R$\031l\215\223,\035K\275\360\224\235%\215t,-\202\001\005\243\230\355\225\032FG\027\333Oj\016\n\016\b\362\213p\354\f\346\016\351o"
+	.ascii	"\264\277an\177C\235\375\rj\3667\210\331\337\320e\177\003\225"
+	.ascii	"\375\rI\3667\f\331\337\260c\177\303\3246q\211\3647\314\330\327"
+	.ascii	"p\267\2074\360\331\327@gc\rn\366\020\363\022i,v\207\264NK\261"
+	.ascii	"\322\035h\223\251&\205\263\216\026}\223\002\344\f\316\327\200"
+	.ascii	"&\315\221^\351*y\240\254p\276\0061\373\032\312\3665,\331\327"
+	.ascii	"\240\265\257Aj\367\332\364Fj\003\347\360\321\345\013\347\032"
+	.ascii	"\372\306\027 rp>\321\236\375?\235\221\322\270\315T*\215J\245"
+	.ascii	"R(\022\326\354\244R\251\f,\346\303\221%N.\370\325%\227\245\363"
+	.ascii	"\211\274\354\023E\331'\"\262O\204\265{DN\373\031\366l\237\333"
+	.ascii	"\366\215\331?+\373\031\214\354\237\263\307\006\266\031hl\240"
+	.ascii	"\333\334\016\246\275m\2416\314\2760de\177(\312\376P\221]t\211"
+	.ascii	"\364\207n\354c\350\223\341\250\177n\274y\303\371\030\330\344"
+	.ascii	"7G\237x\254A\303\371\030\3226\006\347%\322\307\200ecp\313l\200"
+	.ascii	"E\344@\241\341\374[\266\346\n\316N\254}\362\006\207\004\213\263"
+	.ascii	"m\231a\320p\032Zf\245\202\316\035'\233\333\245\363\361\004\316"
+	.ascii	"N,\320\235\016=}\312\340\354\236c0\231\021B\270\350p\301\331"
+	.ascii	"=\217|y\t4\244\016S\t\244\347\316]?oh\026\352#\013\025\202n]"
+	.ascii	"q\311\261\323\303i\006\215'jk\270\213\323\025b\004s\tF1\333\034"
+	.ascii	"\037x\343B\273\256\256\340\354\236\331G^f#\371*W\311"
+	.string	"k\371F\306\31262\221,&\017\311IrUf\346\255\234#c\311Y\262\224<%?\311<\262\223\034\226\275\362\214L\226\273d\266\034&\233\311_r\217\334$G\311\315\274&\213\345#9M\246\222\3332W\036\313?\262\216\\&o\311h\231K^\222\265\362\231L\225\255d\034\031,\243\311Z\362\216\374\225\257d/\271HV\313YY*[\345 \031IN\313gy*\013\311`2\231\334\225\241d \271Ff\222\307d%\231F\226\221\325\344\262\333\314f\371\351\031*G\2251\203\323\202QBm\213\204\315\222M\r\020.\324I\006\027\234\235\230\031\006#D\355\016\306\343d)\247\316\025\234\235X\240\366\r\316N\f\213\207\023\234\235Xv\032@ .8\273g\225\025\276\342\362\020\245\f\316\356Y\265#\312\025\352\204F\351x\342\007\323aq\231\3413!oopz\250\301\331=\357\034\037\25677\270\013Zf\265"
+	.ascii	"$fN-?fc\203$\214\263\212\225!z\002a;\234v\265\001\226\023\226"
+	.ascii	",%7\234X\270\307\023=lmO\356\340y\202\345\343\311\235s\353\\"
+	.ascii	"\247\216\r\306\236` X\013SA\313\254L\270!\345l\333\026\237\301"
+	.ascii	"i\200\224\375\241\273\023\207\345J`\275\301\331=\003\005z\203"
+	.ascii	"\263{b\301q%dH\215\033K'\024JG\031\234\335\023\263\265\271t%"
+	.ascii	"|\224\351\241\242gF6Ck\240=@\320q\205\243dL\321\323|\202Jy6"
+	.string	"C\303P;\035\240\244\3326\307"
+	.string	"\356\312\372\374\370\355\315\275\013:1\333\252\333\203\211\253p\016%@\234m\313\304OXj\n\327\2359\314\347)\207\007,\262lt\276|\001\236\335,\023P\315\355\311\002\313\241\306\005hv\340Y\334\335\033\0275=\037\277(]2\346\316p\341\002\364R\264\345\324G\203au\211=\333\230\r\311\352r\240\227\253Y\321\211\323\343\341[\253\"\223\202\363IH\323\242\345B\331\321'\255\267\325\246]\341|\022\230W\256"
+	.ascii	"\313@\230\273~\234\346\312\230\007\226\241q\315\361q\004g \226"
+	.ascii	"'\033\354`@\262\233\245\255\3520e9w\345\031\264\243\323\326\216"
+	.ascii	"\035H\306\245\256\310\035\234\201a\300*?\035\\O4`\025 \225'L"
+	.ascii	"\250zl\3413\026\007\2053P\f\343\241\312SGBW\224(@)E[N|\364\023"
+	.ascii	"\253K\354\031e\016j\r"
+	.string	"\316R\372\230\321\252\373\363\344I\257\255h\313\311\217\272c\207]]\360\310\r-oa\2300\001:)\332r\342\323\263\242\232\333\203V\251\021g\b\260\311\201N\370pq\273\202\363\371\250o\330T\325\001\302\371+\270\024)\002Tr\263\264U\007\200rR'\246e\224yK\223\344@%h\275.f\302\374\301\031\210\344h[N\363\207\035\316\300\257\243\211\321\351\n\2043\360\310\321\322\262\"jnp\006\032YA\305\313K\n\357\355J\234\032\234\277\002IV\026\220\213C\326\016@U\322*g\230O \007r\035\270u\247\254\214\r\347\003\265\200C\002\265Rp\376\212\031\033\030\004(\344?\017\00309\240p>VA\227\201j\246G\r\272\336\222nI\023\234\201?.\306N\017+Z\200>\364\036516@\037<:\037X2\302\274\341\361\363\370\325\270Y\332*\t\300v\364I{\266m\326\207\005\204\265\311\302\371*\254"
+	.ascii	"\251\016\314\361\337&\220\n\270C%S\324BE\265ZH\206\350v\310U"
+	.ascii	"y\266RA> \031\031\242\006\250\343\300\035j\364\035\227\264.\340"
+	.ascii	"\225*\007N[\026\234\201V)\020\035v\244T\375\274\337\227\0326"
+	.ascii	"r8_\005\215}\025\355\376\377\037\335\177wt\300)\024\3562\333"
+	.ascii	"\254-'= \204\355\310\003\345\331Je}\b\336\310\323U\004\347\037"
+	.ascii	"8\343\300\251\003o\220(q<F#]\272\340\f\264\361\213d\256\213\024"
+	.ascii	"\316\007J\001k\374<\336\223;`\354p\376\bo\033Hc\003!\200\270"
+	.ascii	"\352\2002\216\007\307\332\024!8\003\243\236\347?\017\b\246\354"
+	.ascii	"+\b\316\347\003\204\362\202\203\302\031\330\002\235n\363m\300"
+	.ascii	"\2473\203\202k4F`\333\277o\323\037\270o\323\277@\377\331\375"
+	.ascii	"<\336\232V\221\265\375\377\352~\236j\026\007\310\022\347\217"
+	.ascii	"\020f\177\204.r\267\371\223\373\375\351Y\255\200\252r\206\261"
+	.ascii	"\001r\372=\177OB\270\346\250\321M\301\352\363\237\237\3777\367"
+	.ascii	"\333\303\004G\0223\234\177|F\374\327\207\2076\326\206\b\316\034"
+	.ascii	"\356\220\276i\227HCp\207\364G\260\262\377\237\363\347<\332\265"
+	.ascii	"\3220\003\312\2113h\355\353\217\223\375\377\342\3420\027m\305"
+	.ascii	"\243\341%\346\334W:\252\332x\335\271\203\205\347t\227\244\013"
+	.ascii	"\347\217\260"
+	.string	"c\377?:?:\277:\030\025S\242d\310\331\032-cp\376\bPo\377\311y+2G\367\321\302\322\334\201\363\017\316/\316\357\315\017\356\347&\205\363\313\177c~_~mR\250\366I\211\272\344q9cs\006g6\277\"Qj\346p~\2127\373\035\230A\342\374\261\375\310xQR&\3112\315O\315\257\355\267\3466\177l\2773?\266\037\032\017\370\224\301\331\245g@Z\252^~\n\346~\n)\373)\272\366S\320\330G\021g\377\322~k\2741SpAp\376O\355\313\r\223)8c4\225\314*\352\013\316\377\211A\003\251\031S\003\347\377\302\374\347}\300\016\027\025\234\177`\366\f\024g2\340\325\311\202G\211\331\177`\376\337Y~\323v00\005$+\017\316\301;\244\177>F\374g\206\2354\333\332\254x\361\302\226\346C\310\226\024\316Gqd\377\277,\267\371\313\362\343B\202P\333z\325Hk\255\2624"
+	.string	"\"aRD\f\347\037\227\377\247\345\267\245\367\264\261"
+	.ascii	"\371\231\302\231\203\363\022iT\353\016\351\243\250\352\361\237"
+	.ascii	"\227v\243\341n\363\327\343\307\324V\313\366H\225\n(\350\017\r"
+	.ascii	":sp\306\242>\311\211\223\006\347\243x\332\277dD~F\3568\177G\354"
+	.ascii	"8\223\374\226\\\267/\005\200\265\321<~E:@I\221@V\3079D\354\327"
+	.ascii	"\3447\345\272e\t\265Qb\236\316\237\330\017\311\234*\277+?+\277"
+	.ascii	"\261_\330\217\312\217\3546\177b?&?\261\337\027\035g\3332\203"
+	.ascii	"\366\214y\351!\224\177D\216\247\003\224\024\tW\342~R~`\267\371"
+	.ascii	"\233\362\337\024\315\374\201\300fG\030\031\007\020@\2717s\200"
+	.ascii	"\350(?(A0\314#s8\377\236\304e\365\020\301\315\376\177Nn\363\267"
+	.ascii	"\214\343#\246F\207\347?\317w&\211\227\232}\021\320~J6\034\247"
+	.ascii	"\02068_\204/\373\"p\331\027\341\312\276\bT\366E\220\262\377\237"
+	.ascii	"\221_\221t\013\333\0366\277\"\227\016n\315\024\024\316\027a\271"
+	.ascii	"\177[\277\256\324\310\317\013\252\222f\344\f\347\377\270\376"
+	.ascii	"\363PH\322\346\f\347|_F\377\264\376\033\362\363p\233\223%\016"
+	.ascii	"\234/\202\222\375_\220\237\220\237\027\234\323\344K\031\316\027"
+	.ascii	"\301k\377\007\344\354n\217\017\234\177?\366\f\021\2602\350\t"
+	.ascii	"\0213\004H\326\177?\376\237\217m\326\302]"
+	.string	" ?8\003\357\220\306bF\374\227\345cc\306\211\005\347\213\320\356_*\367W\365\253\372a\215h[\"L\202\234A4H\267\304\201\361\330\361\333\002\343\341\314?\314\340l\301\371\247\343\227\003\243G\256\350x\341\374\273\322e?\242\322p\376\t\271\237U\033\016\034gl\274\331XN\301\371'\232\277\033\277\033\2765^\231@\313\031i;~`\241A\343W\343\327JN\003\347\276C\203\303\362\223\372\257\006\332\317\314\312\035\232/\0312|Pp\333\266\355RES\306\216\323\227EM\23518\377D\217\037\324\017j\r\304\025\264M\215\026\031\316?\341\364s\3729\371\240\270\001\021$\314\213J\020\234\257\200:ww\276\263_\253v-\003\266'\224\26118_\001ku\201p\232\002\240\244\332\366J\204\034\025\030\231\030\331\276\002\210\370\371\343\003\204\323\204Z7-\357\353\t\030\247\002t<\237\276\257[A\333.[(\2707"
+	.string	"\354P\200\323~\002\342\366\357\333\303G}#%\214\316\311f?\001`\366\357\323\343\223\343\223\303i\267\235a\325\266E\270D"
+	.string	"J@\224\375\004d\355\337\273\353\213\373I\224\360\311\361\345\271w\273]\266Pp\234H\344H\200\323>\002\346\354\373\350\\\237\0359\276;\030\320v\262j\243\212\250\221\260\242\002#{\"`\314>\002\310\366/\006\244\177\337\034\337\034\336\334\210\250\226\210\025\315\203*\t\233\352\007*\016\013\347#\240\313\007\347\203\363\305y\023\301\346G#\316X\0208\367\305\211\353\275\2115\003\341\354{\323\203\223F\207\355\r\347\363\301\200\376\363\204e\222<q>\002v\274\275\371\326~\255Z=!\262\250\300\310\236j\224\037\317\254\347\2325\2766\267\265\3423A\220\017@;k\344\336\330\334\327\246\f\216*<L\0160g\267\265\371\322\\a+\363\341\003\347\037\240\314F\203\306\227\346K\020g\357\017\024;Ti\334Hib\346\305\214\031\252e\031\027\03798\377"
+	.ascii	"P"
+	.string	"6\0312\2765\022Z\251\345\232S\214\b\316?\200\226\232\232o\315O\320\036_\016\2634k\2765\264/(D\276\340\374\003\314\b\023\306\207v"
+	.string	"/vv\026\330\223'1\367\241\315"
+	.ascii	"\263\345\211S\331\227\227\022\247\231\231\357\214\307'\210lS"
+	.ascii	"\311\201\323\005g\337\331\275{\022\305k\n\347\207\200\306\327"
+	.ascii	"\3645}=\372\004AQ\231\344\220\362\005"
+	.string	"\347\207P\266\177_\227\246\257\213\372\206\327\266]@4\031\032\rxF\346~\200\301\371!8\321\022\346\333\362\341\2669\332[\343M\031'\316\326\212\251\301C \262\037B\217\375\373\250\370\230\276\262\243\3356G\213\337\276\312\260q\266V\255\006\017\341jW\251\342\303\202\333\255\266]\252j\312\250q\352/Z\274\262\\\271\017\013\2312<\320\340\354\263r4=lH\332p\366\221\341\2517rh\240\301\3317\206\247\204|\021\303\242\373\317K\275\372\334A\243\3337\300\334\024_\330\024_\01700_\017\020lT`dbAqx\310\311\300\371\006x\3337@\323\211/\212\023\037\224\345\322\007E.\203>@9\201\322\276\236\334\007\005\311\035,;8\237\317\275\263\221c\214\001\236\354\033@\207\022\037\023%\276\036\276%\276%\276\036\027zz\323\200L\217MH\\\033\234_\200\273\375\002\274!\342CB\304\367U\244\210\357KO"
+	.string	"\310\250\300\310\304p\237))\252#\367}\241\241E\234\202\354\301\331g\244\016\026\260\262\002h\331/"
+	.string	"\220-_\327\026\027\227O\310vj['\241\026\212\316\234%]\035$Zw\373 \250\371\341\323\372\341\023\342\003\342\003\342\023r"
+	.ascii	":b\234\350\226\331\r\031A\356\023\202v\275\324y\033\003\302\330"
+	.ascii	">\b:v\370\262v\370z\350\266\275\314\255*\2536\313\352\203\017"
+	.ascii	"\313\207\345\353q[+\fj\202OK\226Fp\376}<\356\353A\266\345\r\016"
+	.ascii	"\347\276\211.\373\367\345\360\345\270tE[Nr\026X\005\365\001\023"
+	.ascii	"\242\244\212\r\033>\253\335\266\255"
+	.string	"\023\263\255\212\200\r\025\030\231\230\257\352>\253\254dF\030*\234}T=?N9;;8\373p\274\314~\226\231\023\004g\337To\016M\316\232\023g\337\215\243\005\211)\233\243\304\304\226\357\311\367\344\223\na\212\326\322G\343>)_\022+t\202\340\354\233\3612]\264\224\301\331'\343hYi\244\330\341\354\213\362A\231\260\242\243\363\265\031hQ\201\221\211\335\335\327b#l\346\360\300\271g\3672O\356\300\204\341\334\013TG\227'O\357\217\020\b\252<\337\373\023\354\272\263\344\b\316\275>=?\377y\301)'u\310\370\332\200\201\243\302\271\307\247\367\005\n\235 R8\367\366\274\314X\0272Sp\356\311\365\346\376\363:p\243\252\017\316==G\243s\226\346\f\316=g\246\222\305O\0201O\314\020@N\235:=<zB\220\241\002#\023\273\363\036\036\364J\230#Hp\356\331a\003f\215\310\027#Zg8\237"
+	.string	"d\336\336zs68\345\2747\347\226\211\331!\205s/\316/\214\032\220,\234{p=8Aik\376l\201\363&\235\203E\325\244\004<V\316\340\334sC\200\2635kzm.\007-\024\234\032"
+	.ascii	"\256\214m\2519\337c\023\007t\223\203N\213\363\t\020\205\215\255"
+	.ascii	"\3276Tw>\357\265\361\262\224X\341|\002\374\330\177\017M\263\207"
+	.ascii	"f{=\215j\211\210-\3336K\003\340\223*\\\240p>\001v\354\277g\246"
+	.ascii	"\3313s\351n\226\266*I\345g\217X\333\242\321 \007\312\023\007"
+	.ascii	"\t\316\377\300\271\377\036\231\333\354\221\331C\356U\333>}\351"
+	.ascii	"+Y\032\35027\254\366\340\374\017\346\354\277\267\366\253sT:\267"
+	.ascii	"\331[\353eA\245\266\332\253\020\306\270\211\223\373y\271\241"
+	.ascii	"\305\304\371\037\300\355\277\227\326\354\245\365\2308K\353\304"
+	.ascii	"\20163\252<\3336K\203\355\306\256F\037\234\377\001\333\376{b"
+	.ascii	"n\263'\006O\245Q\355\026\022mG5\267\347\331\266h4\330^h\264d"
+	.ascii	"\340\374\017\222p9\227\036\230\013\265m\013\325\266ZZ\024H\261"
+	.ascii	"\372\360\367\316\336\003\203\266\237]\356$\301\271g\206:\311"
+	.ascii	"B\307\003\347^\227\336\027\255?Xn\276\364\232gxj\374\200\303"
+	.ascii	"\201\027E\006\330\225\236\227\3336E\207\232\0318\177\340C\213"
+	.ascii	"\2266\b\250\202!_v8\377\003\250\335+\223\221\345%\f\316/Q\267"
+	.ascii	"{XzhgYW8\277D\234\375\367\254\3746{Vzc)\334\266\006\232\226/"
+	.ascii	"g\333fi\340k\243\373\322\206\363K\234\221\215\231Q\031\203\007"
+	.ascii	"\347*\370\366\361s%\b\316/1e\367\302zPzQPf\332\026\343%\304\031"
+	.ascii	"\326\323\3521\t>1\333\034A\270 6\310\364\250\364\304zSzRz`\267"
+	.ascii	"\331\013\353=\001\323\013\353-U->l\220y6\361\002b\203\314\263"
+	.ascii	"\027"
+	.string	"\326s\202\302\375\260AF\254m\231\300\2574a\326~[\332\342\230\2658\277D\327~\211\251\375\022N\373\036\354\331\367@\316\022\016?\263\031[U\324\220\364\222\334fOIo\210\332\366\272n_$Ti\353)\271\314\336\327u\373\"\301N\2153O\341\203\205\217\316G\360\317\306\323\n\316\367 l\377\357\025\351y\365\210\364\272n\263g\244\267\325\304\322\343B\323\022f)\246g\344\202\271f%\262\250\334\310=\203jti\351\351\345{\020\265\337\301\234\375\016\326\366;0\333\177\357\307o\263\367\243\027\004\203\325\n\270/gk\225\245\201O\207\237\2620\234{@\200}\310\352\242p~\007V\366;\200\262{\364\2626\334\237\"mBz\364\260\356\\\0135\205\363;\220\321\333AV\206\352\3526{W8mD\333>ii3VV\032\234\004\335\376{\230\213\0232Yr8\377R\271\275\250\367p\364\250xi\267\315a\305"
+	.ascii	"85\234\255\325\016\rNB\316~OFo\306{4N\2437u[\253\266\315j\235"
+	.ascii	"\372\250vT`d\3176+\353C\276aC\212\223\336\215\367\246\324\262"
+	.ascii	"\252)8\234\317\247g\343?\257'\367\006GN\317F\257\206\016:\\\312"
+	.ascii	"\360\320R$t:\300\364\244\366\035\312\306\004\315\034\316'qe\377"
+	.ascii	"\367\370\327\355\223U\333\2669Rfk\005\365\323\377\375M\357\375"
+	.ascii	"\360\003/z/\370\237\333\026\0041Im\033$\316\236\266m\357\236"
+	.ascii	"\035\005\355\tH\005\355\206\266m\257\244\242Z\247+\265\245\353"
+	.ascii	"JjK\227\325\005)5]Wm\324\225XT\327\326\225\212\352\262\262\212"
+	.ascii	"j\235.\264[\272\254\244\332\256+\241vK\333Cj\313\223\323\225"
+	.ascii	"\212j\257\332\266\253\025j\245\236\256\332-L\253\013R[\272\254"
+	.ascii	"\244\266t]]\220\332\362t%\325n\265BRL\"V-\263\313\351\302\215"
+	.ascii	"-OW\355\226\255\253\013\355\226\256+\251\271\036j\035\342\210"
+	.ascii	"y\201a\263\205\312\331\275\222\212j\251p\004y\262\022r\223bn"
+	.ascii	"\265s\332\3666g\264V\255[\333^\320\266A\266\254\346<\365\270"
+	.ascii	"iPnTP`\236\2668\340\200\362\332j\243\334\234n\353&%e\253m\245"
+	.ascii	"@%\2658\332\266m=pb\272\265H\256\233\023\221 \355\324\214\266"
+	.ascii	"\205\240e\266-\216\266u\272\255[\333\266Nm\333\252VA\230m\373"
+	.ascii	"CHj\211\003G\333f\025\341h\2038\251\315h[\334\254\223v%\265\305"
+	.ascii	"kk\204Z\227-\313\226\006\323\351JMm\265\313vN\227\325\336\342"
+	.ascii	"T\326N\265m{\347\366\362J\207\034\316'\001\265\377\036T\357I"
+	.ascii	"=\242\307\tJ\227\001\003\207\346\256\327\2668\f\0178bv\356x\201"
+	.ascii	"\230w\206\2336\0318\177\004\257\356\267y4"
+	.string	"\036\240\262e\333\266B\277:{\3024q\376\2105\336\223\031d#'\316\034\234?B\f\223\254\252J\311V\237\033\227el![\303\007}rm\350\210\212\262g\016\343\351\"e\314\234\\o\217\024%U8\353\031k\302\245\r\347\217\250\262\333\324Q\243\346\b\242m\373\204g\271e\206n\t\207\027\207G\207\027\307\203\343\331\341\311\341\335\341\325\341\345\341\315\341\275\3419o\223\207\207\347v\336\033\317\r[\236\021<<<4\n \373\343\304\303kSs\\\267\254\\%n\213\207\207G\206W\346\272}e\262\2725w\322<\307\340-<;\312\236r\335\262\262\024;'\233K\027D\333V\313\316\222\207\207w\246\304\036\252$ @\200(\002\352\t\362fI\207\214\255.\221\276\340\016\351\217p\332\347\340\317>\007\316}\016\340\354s\260f\237\0033\373\034\244\355s\320e\237\203\260}\016\274\3669\230\332\2742\307SA{\230"
+	.string	"Z\202\3639p\332\027\361g\377\274\265\017\300?q\240\304xj\274\264(bOKp\346\2411\243\364"
+	.ascii	"\021\243\302\371\"\356\3546K\234wl\340!\033O\r-\003\211\234,"
+	.ascii	"]c?\271+SB5\"\020\223\033K]c)E\003\216\020'\035\034xH\235\251"
+	.ascii	"\335F\305\331\304\206\256a\345\017\031\216S\3059\206%\317\262"
+	.ascii	"\306\225':v\371\340\331M50\350\017-\247\02395P24V\2344\334 q"
+	.ascii	"\356\246\030\264\345X\331\235%\0362\207j7\367\030\263%:\266\271"
+	.ascii	"\264q\332\271\241k\210m2\031\200\234\001\253\320\367\244\020"
+	.ascii	"\353R\221E.\031\361\216\214\305a\262\307d\\Y\366D\212\022R`W"
+	.ascii	"$\016\306\"\322\005\013C\t(\213DBF-\330\025I\b\351bH\251\304"
+	.ascii	"tLR\016=)\004Q\004\b\266\270T<\341H\305OE\n'\020\021\031\213"
+	.ascii	"\303\025@\337\b\025)2\034%W\026\216H}L6!e \236`W\345\005\242"
+	.ascii	"^\331a\013vE\n\"\032\207*\020\207k\212\243\340\223B\254\311\243"
+	.ascii	"\221\b#\"\342\312\016\225E\fO\n\221\\c\024\227D\304(\262H\036"
+	.ascii	"\331#\013vE\022R\217V\245\241\221\322\027\364\244\020"
+	.string	"J\345jd4\324\026\350\200\002#.`\201\016(\300\301\005zJ\303%\027+;d\217+\f\rO\na\224\024at\244T\341\204\322\321\232\302\250\005\273*\225\224\206FI\354pI\004\2534\036\215\322#\326XL*\351'\205@2\026\223\254R\203\222\022\223\321x4\252\254pm\241\250\324,\034\223I\354\321\250\036\rW\245\334\2044ZZ\227\264r]\032\242@,\"7\360\by\202\257\tyD\021\024\002\200R\350[:\032W\242P\251\\\215\216I\244\220XD^0\036\213\254q\205\261&\221\020\254\354\020F\2215\032\256D\341\321\321q]a\310\n\233\206,\f\215L\311\n>d\207DvU\006\221\212G/84!\217(\210\232\206\311\344\t\345\223B !E !\207\214\214L\276T)DB\376X\241\021\t\231\032\221\220\250\222^[(*s\023\362h\224\223,\022%\256J\246\254T\237\024\"!C"
+	.string	"\233\222\254\262\210\264\266\020\002\221C\0261V\242\261\204\343\013\345\260\250t\302(\251!\005\f/Rl\rBE$\021\273jX\211G\026\033\210:\330 t\201D\b\fA\036\204H\256*,1\241\260.\r\223*X\345P\351BQ\211\020+;da\330\002\002\r\037\254LF\312\265\205\022\211T\224\201"
+	.ascii	"!\330\344\220u\261\022\217,4\240`\215k2\311d\304!\271*\001OD"
+	.ascii	"`D*\272`\213\306\022\210E$\006b\021\t\314\240b\210]W\020\213"
+	.ascii	"\310\rDD%\003\210E\344\206\022\210\305\024.\364F\204\320\300"
+	.ascii	"\232T\361K5\260&U\034\035\035Yc\023\221\210\203\020\352\205\245"
+	.ascii	"\344\372\"E\221\006\244\004CG\310"
+	.string	"\023 \250\240E\006\021\020\213\310\013*x\221\301\005\034\204`\223Cd\210\023+;$\"\035@,\"\005\340cW\027D\343\t\"\207\022\202V\025NdH\032:\001\003\261\210\334\306\023\033\222X$\343\232d](\2550\326\023H0R\032\032\025\245O\n\201\304\244\302J\024AT*2\251\260\022\217,xE\244zL6!\345\375\244\020FI\021FG\024\020\217,\202N\b)\205F\025HH\"\226\025*\225\230FX\211Ll\221e\207DK+\253lr\001\001\213!\271\262\353\322\221\250\205$#\243a\317\310h\370cY\341\321J\344\360\244\020\022\020WvUB.\035QdPF\220\202\350\230\\'`d4T\331\336*T\"\r\225T\254J*\030\213K\311a\206Uh<*\207k\213\245\344PYL\201t<a\350F)\004\335\250\230\\\215+\322\276\007\037l\360\201\211\030\352M\024\200\203\002p\240o\242"
+	.string	"#F\024\340\203\021\373\037\214@M\204"
+	.ascii	"\201\304\b\341\312\016\225\220K++dW\345\232\024\022\255\302U"
+	.ascii	"H,\"1\260\303\243\322Q\312\032\213(\373\244\020\"\214\2160P\n"
+	.ascii	"\221\212G\306#\212\225\035\266\0302A,\262H&\261\252\211#2\306"
+	.ascii	"\b\311$v+\225+;la\224T\217\310\030#\030%\265re\207\3114E\t)$"
+	.ascii	"\223^\030\233\210\274\025\206kR\005\341\020\311\016!5\364V\342"
+	.ascii	"\221\305\020\311\252\254\361X4\022\"\r\225Bv\250\002\f\"\245"
+	.ascii	"0\005b\021\371k!I\310\302\260)\330B\222P\250\205$V)<\"\026\221"
+	.ascii	"\232XD\242\0276\370\226\230\\\020\213\310\240\261\310\202=A,"
+	.ascii	"\"\205\214\326\243\243\241U\310*\025Ya\221\206\026,\f\233NX\331"
+	.ascii	"a2HD\022\n\261\302\242u\251\310\366\232\206J+\321\227a\210\205"
+	.ascii	"a\2230\250\205$\2410)\f\006\211Vd\023+\344C2\016\207B$&\025V"
+	.ascii	"\342\006cq\210tA\271$T\022\262\302c\322h\310\301X\034\"\t]H\036"
+	.ascii	"\223\311u\203\221\320H\250Ta\210aE6\261B\022\030ZH\022\032\213"
+	.ascii	"-$e\350`,\016W\254\312\265ErEB*&_\260pTR:1\201pU2a\2101TZ\223"
+	.ascii	"B\026\206M\302\f\251\2618D\352\255F\306!\f\342\220\bd\231\220"
+	.ascii	",\323Q\230<\262\307%\fJJ\253\221Pxd\231\206\033\204\254qe\213"
+	.ascii	"X\345\361\250\202\360\350h\257KC\024V\245\342\3211\211\364-!"
+	.ascii	"\223Bcq\351G\\W\244R\310\032\327%V\311\224\001\342\220H\023\213"
+	.ascii	"\310\340\252\034\256I#cqU\"\026/ \225\302\265\310\016\223\302"
+	.ascii	"\030\303%\341\321\321\005\266\270TT\022\256+\024\221J\341\321"
+	.ascii	"Q\360H\250\024\036\035\t\035\2211V\341\n#\311d$<B*\t\215MD\f"
+	.ascii	"+\361\270$\\\215\206Ia\020\273\304\344\002U\n\207\3540\205\262"
+	.ascii	"\030\343\004\261\210\004\246pK\270)\256\212\253\024\036\223M"
+	.ascii	"H\232]\221\222C6\310\nIt\260.\025Y\344\361xB\360\bE\212\023J"
+	.ascii	"\337\022\223\013\236\221\205#q\003\313\"\031\213\306\342pim\241"
+	.ascii	"\\\225\214\232\214\202\224B\024\307d\023\322\205%&%\312\032\205"
+	.ascii	"K\250R\bc%\262J\225\005\013\027D\245\243pI\273`a5\n\227tr\b\003"
+	.ascii	"U\241\25044\362)\205\277'\205\360\220\\\225\224\212*\216G\305"
+	.ascii	"\243\036\033$T\237\024\2025bJ\262J\022Ja\214\225eZ\272\260\202"
+	.ascii	"\321QI(\324\254\221\351h$\024\252\311\325\310\302Q(T\225"
+	.string	"\311U\311d\024\n7\321X\\A(\324Jc\021\251\024\nU\343\261\250,*\255B!\217\025\262\312\242\222\320\223B(Wd\023\273\001qM\016\223\224\033\210P\262E\025D0\031\2216\210\301d,*m\340\301\007\302\017L\304\020\261\022\231\224\214\214E\021I%\223\b\020\330\030\253QihL\256\254\261($\016\327d\022\213\024\n7\300X\223H\241P\263\312\242\222P\250\207\354\220(\024\352\3440\311(\257-\024\225B\241^\301\350\250\224\331\242\261\004\266h,\022\031U\020\207kR'\331\024\214\214L*\206\3540\005q\270\2668&\233Vp0\252"
+	.ascii	">)D\221\215\261&W%\242qHB\221\215\261\016\261\306#\254\024\032"
+	.ascii	"\255-V0\032\252\240\2444DQdc\254\027\212l\2145\263Ja\021\351"
+	.ascii	"\342hM\261\"\233^\bKH\301\205o52\016Y\245\261\270Y!\003J\310"
+	.ascii	"\306b\nF\245\221.\"\225\250R\210\202D\t>\024$J\340i#\022E\364"
+	.ascii	"I!\224L*pP\nY\020\205\222+\253\034.i\245rM\022\211Cu\2051Tr\301"
+	.ascii	"\204\\\332LB\030+Q\311\244\302V\nW\243\"\2145\205\222I\005\237"
+	.ascii	"\222I\005\336\212lb\225L*\250J&\025\320Uih\244L\203\216\311u"
+	.ascii	"\002\307d\023\322F\221\342D\n\030X\030\266@\221\342\304\232d"
+	.ascii	"b\207\311\025\271\264\262>\366I!\230"
+	.string	"\220K\302c\262\ti\205QL\022\005\260\n[pP\202\203\017\230\220KC\306c\221eR:*\327dO)\314\260\n\231\220K>V\211I\271\2660\036\213L\310%\f\253P\0304\"\025\225N\b\201-\220`\302\312\016[\034\223MH\276&\342pm1d\207D^Ry$LB*&\t\217\220J\277#\244\222\260\205\244\025Ht\220\204A\211<&S$Wb\021F1\005\023r)\210\025\"\r_\034\213*\322\360E\221\2151\002k,\201\t\271\004\\\205\30159d\201\230\034\222\020d\237\024B\231\304\016\227\226\256R\230\024\"\217\206b\024\223\354\220\005k\\\227\202\204\224\276\025\214\216J(\210CV\331\342xT<\002\036\217\212G\276\343Q\361(\b\206zL6!\365\330\025\224C\026>\245\360\307>)\204\320\202\246$Vi\270&\251J\241\212c\262\t\t\203\336CViM\001\\\215\214\303br\370"
+	.ascii	" q5\"\025\225\206\252\362\367\"\250\304*1\r\217zM\311#\253,&"
+	.ascii	"\251I\3125y\224jcq\270bU\026\217F\236\317x,*\231\2164\253\024"
+	.ascii	"\302XS\300XS\270`a\230\314\240\004$b\237\024\342\230lB\202\340"
+	.ascii	"\002\223\360\230lB\032\n\006G\214\030\"\361#\"\241!H\302\330"
+	.ascii	"\224\302\030DBi\310\250\310\016Y\345\005c\023q\250\005\022Vv"
+	.ascii	"\330bUB.\r]\030\031\r\203V\245\003\216/\216\311&$\336J<\262`"
+	.ascii	"\217\311\024\030\240\034\222pL6!q@2\026\221V(\r\231R\254J\246"
+	.ascii	"\f\2540\306J4\026\205J\243\342\322\320\330D\024n8&\233\220\200"
+	.ascii	"+(\207,\224\305\030'X8*\035%W\030G!\245p]*\262F\246\026\304\""
+	.ascii	"\362\367\202\210\233\214\214+\223\006\326\244\nb\021\371S\026"
+	.ascii	"\225\212*\fY\027\304\"rC1\005%\323\261\bcM\"\207.$\031\261G\024"
+	.ascii	"zC?\022\031\330\037\2230\310#\001d\225\305\030C\236R\bT\252+"
+	.ascii	"\261\230d\225zE6\261Y\251YV\231,\036\365\224\302\241$\233\202"
+	.ascii	"Q\205\t\032X\245pE\032\262.0\fU\245\272\"\rYe\21752\035Q(\255"
+	.ascii	"\306\344\272\202\317X\034&\241XJ\256,Q(\311\246 \304*\205\333"
+	.ascii	"\250\242I\t\211<\241\201\205\241\004\226\222+\213\f\"\256J*\f"
+	.ascii	"\215#\004\035!O *\031\220\341\bIB\023[\2041L\256(\262\306\241"
+	.ascii	"\006Vy<\212pt\004\\\225\311\025\206\261\204\025\212H\027GGCB"
+	.ascii	"\307\023\031\210\311!\013\311\243\n\342\272\036\021\261O\nA,"
+	.ascii	"\"\217L\300J\241\020\322\004\\4\001\023M\300\254q-\032\025\217"
+	.ascii	"\216\326#\nb\021\0314\026\207+x\306\342p\205\317x,\262E\245q"
+	.ascii	"\230\274\220\341Xd\207-0\254\304#\0136\271\"c\214\300*\025_\030"
+	.ascii	"\217-\024\223\307$\242&\266htTZ\037\020c\270\344\203a,\2015\026"
+	.ascii	"\217)@`h%\036Y\2400\026\207X\241\322\001\353R\221\335J\007\260"
+	.ascii	"'\210+k\264\262k\n\245\003\206,\353S:\240i\250\264\246X\227\212"
+	.ascii	"/\204X!\211\016XcQU\256k\022iMQ4ZSH\260\262\303\026M\311\025"
+	.ascii	"\306\321hmq\241i\005\206\245\344\312\246\030\"*\035\223\224k"
+	.ascii	"2\351\205\006\026\206\022HR\016\223F@\366\bdWe\t\307\344\332"
+	.ascii	"\202\206\225xd\261\032\r[(\2550V%\340\021\362\004$\023\321Xd"
+	.ascii	"\201\327[\221M/\202K\311\225-\n\035\035\035Y&\024F\303m,\016"
+	.ascii	"W\030\r\265\321Pe\213K\305\023\222\307dr\004\243\341\357\by\202"
+	.ascii	"\32105\036\213\254\321\232L\036Q(\035\211V$\343\260\005O\251"
+	.ascii	"\034\"Y8\236\300\032W\243\344\232\202\261\310\202\3503\026\207"
+	.ascii	"+\216\311\246\025\306\"\013\342\317X\034\2560\026Y\020\205F\220"
+	.ascii	"8B\2360\304\256pG\260H\337\312\016Ye:\202M\201\210}R\210#\021"
+	.ascii	"\306\343\322\322\321(\002\022MX)T!\310\201\nx\204\n\230\204\n"
+	.ascii	"x\304\020\223\030\342\02110\211\030xD\023&\016\2314P\024\241"
+	.ascii	"\210\270\266PT\032\026\331\242\261\204#\344\t+\214\";\204QL\256"
+	.ascii	")\224\025dX\221M/\220\214E\243$\021\321\272T|A\034\256I\303\025"
+	.ascii	"\216\307\023\212\224\305\030'\220\230TXS\030\213\303\025A+\214"
+	.ascii	"\"ktae\207\254\013e1\306\211\344j,\016\223/\216I\243a\206\344"
+	.ascii	"\312*\025U\374\214E\246\035c\310\202wD\306\030a\205\221dBq\204"
+	.ascii	"<\301\330D\fZ\211G\026\027V%$\343\211\rE\023\224\216I\326xD\221"
+	.ascii	"ddd\032*\005)\035\217\"\b\323\022V%\223\020+4\301\032\213Lj\214"
+	.ascii	"\241\322\332\202\205\241\004\210+;L\"\255\254\261\210\241\205"
+	.ascii	"br\270\032\213'\260J\246d\022;\304\032\231\216K'Vv\2504\256\310"
+	.ascii	"\245#\n\266\210-.\025O`W\345\321\021\003V%\226=&\223^\254\304"
+	.ascii	"\343R\2628\204\200]\205+\262\351\205\361X<:\"b\215\305#\222]"
+	.ascii	"]\020Wv\250tD&W\326X\302\3221\251\342\350\b\202\344\2215\032"
+	.ascii	"\252Hb\217\307%\027GGA\366h%\n\331\rO\na<\026\331arUZ\215\214"
+	.ascii	"\206\"\224\311\243\322\270*/P2\t\225K\305\344\213$#\266\230\002"
+	.ascii	"\321xBI\351\230\034ba\230D\237\024\202i\251X\364#rM\212`\217"
+	.ascii	"\307\244\b\237\222\3221\231\223\214\330\"2e\205\037\214`\215"
+	.ascii	"E\365#F\240\250\300\001(\254\330F!\210E\244\b6\t\251\250t$\302"
+	.ascii	"X\034.\2110J*E\204\330\300\302\260\tU\256LJC\030\372\177\360"
+	.ascii	"\f\235\334\305\315\f*f\200pn\346\350\340\224\001\256\t\340\213"
+	.ascii	"\017\0172>(Kz\340\0312\306\371\233k;rg\r\270\007?\321r\306\214"
+	.ascii	"\032\333>\002\205\215V\232\325O\b\325\2365h\300:'kvvb|R\371\306"
+	.ascii	"\224)m\302\374\341\325\235\351\272\002\006\017\017jG\230\250"
+	.ascii	"\263\036\230\364\013\0175Y\314zs\200t^^\355\027\365\315\376"
+	.ascii	"\022\347v\243\t\274\343i\025\201\033\363\322k\223\303\276\302"
+	.ascii	"\372tA\355\344\032_\330\270p\t\322\250\243\242\344\310\026\f"
+	.ascii	"HM\226:3A-X\354O\2403`83\311\332\226\031\324`Kh\250\341\034d"
+	.ascii	"\002\301\356\206`\341|\023\344\004\261\\Q\342\343\003\247M\234"
+	.ascii	"\025_\273\261\350Q\302EV\246Fy\022\273\033\003J\3711\251\362"
+	.ascii	"\347\252\n\220,\b\fW\025\034*\276/1\265 x\304\200\\oc\266\210"
+	.ascii	"aJ\361\"\026\007lG\227\247\230\034S\200^\260\335\331\334\033"
+	.ascii	")\300\263\263\031f{\202Q|g\"\310M\025\301PzYxqVP\264<\001:\231"
+	.ascii	"\263Udj\311\222\240\223\271\r\310\260\256Ti\362\240\023\314'"
+	.ascii	"\250\316\2212l8\007\231`@\250\033;&~L\320\262"
+	.string	"\377\240\222^\033\360J3KM\022<\325C\006\335\031\316\301\257\254\006j\355\006\316L& \270*?8\007\273\202]A#\327\312\2036('u\3176k\307\207?X\344A#`Z\360\250\341\034$\022\3642Al\377A\256\036\023\304\323H\226\032qZO\336\340\034\024\022\324zp\310\203Cpp\bzw\247\255\274\361\242\203\b\351}\271\323s\007\210\257\007\221,\272/?zA\234Rk\301\254\007}\004\311\361\340\002\202s\220G\260G\330\322\214\016\316\277\315\343\211\213rg\355\n\316\301\035A\254\257\345\2271y\356\264zJy\326\321\001\234R\251\306\350\214\344\370q\001\212\221\003\006\356\2527E\005O\233\240\325\257\216\216\257(]\252~mt\326\235\0331\234\2038\2028zmb9M\233\f;8\337\004\255\340\215\340\r\337\031\013rqr^mH\204\340|\023l\004k\004k\370\316\212\266\234\370\250<~M"
+	.string	"\005a\333\023t\n:\005i\024\251m\315]A\203#FGp\306\2034\342\202\177\340\340\t\3039\370\024\224Q\245\r\023?8\377A\031\301(2<\274\324\3520S\032H\334\254\005\241P7{,\254J\216\005\300\331\331\001\357\212\266\234\364\b@.\310\006\307\013\n\347;\365M\026?_\244p\376\002\326\236O`\335\315\322V\265\200\345\244\212\330}\022\363c\203\356\300:4`\363\217\236'\234\201\200^f\252*l\ng\340\237{\027\204\363\\\363\274\316\264H\231<Ep\376\002\256\364\351\003d\353\020ek\356\312O\216\023\217\234%rr\300=\031\354\324*\316\2728s\007\356\271w~\232\250\255Y@\226\035;@g\035\226\223*O8M+?\200y\016t\242\235\241\263\007\n\316\300\270\227\001\326\r\211\262\003g \236;np\340"
+	.string	"\351\\!&\024\\\325\262m\263>$\361\220\233\232s \235,Sl\177p\006\312\001\242\t:S\003K \234\201q\216\206&K\030\247\231\233\033\020\256h\267V\264$q\252ks\256\334\334\034\b\027\027$fw\206\2053\360M\n\0336\300\262\022\355\334\025\340\030+n\376\030Q\243\306'\244\251+Nno\361P\253\201\363K\370A\346d\200l7K[\325\201\325\334\025\037\330\0309j\3004\007\262\241\375\244\236\370X\301\031X\006\210\306\353\013\035\036h\200g\324\210|=\205\375\352\200\310\311\001\232\301H\244tUq+A\006\032\032p\215\312\030'uO\240\026-g\034\265\003\327\320\232F"
+	.string	"\251\341\fLC\277\300\321\nb\027&\214\357\354fi\2532\370q\023'\007\224\232\363#\215V\250\204d\220U\207\250dQ\216%R\214s\214)\204\314j\223"
+	.string	"3\025"
+	.string	"0`H\034\222J\205U\224\017\024\200\013Y\274|\210b\034\315\264$\251\220bDD\006"
+	.string	""
+	.string	"\200"
+	.ascii	"\004H(\227&K#\350\254tg\377\224\322\232\t\3078\240R6x\004\260"
+	.ascii	"\266FNH\313ACP\tH\321\177L\261`\247\213\202H\325\310\321\364"
+	.ascii	"\350A\216>\320U\323\377~\306\032\252\242\371 \223\211\325\316"
+	.ascii	"u@*kw\272v\345:\310\037\002\3554V\275\242\360\324\20068\227\251"
+	.ascii	"x\026\274\325\213\201\365'\305\n0P\320\310\213\376i\222:0\343"
+	.ascii	"K\364\023}\312\001\362F\030I\234@\314\337KsF\035\236\237\223"
+	.ascii	"|\221\373\227\002\b\003<\226\214\234t6tS.\272%\374`\302\025\325"
+	.ascii	"\354\004h\300\323\205\270\201!\340\377\016\341\267\371\362\t"
+	.ascii	"\002\327\353\323J\210kk\262\333\315$\177\242\330Q\377\352r\007"
+	.ascii	"\034\336\244\242)\362:f\272)\026Yx\t\351\005(\217\347\322I\257"
+	.ascii	"\276_\217\f\203\201\210\240\344\266'\357\313\023\223\370!\200"
+	.ascii	"\254\bk\277\262s%\036c\n\273\332\227\260\361\\\315\250~5\235"
+	.ascii	"l\276\036k\245Q\225g\370;\020\361Y\367m\300Y\254\032a\362J1\267"
+	.ascii	"@A\025\234\341\356\337\204\245\355\331{A\213\f5\222\257\210\203"
+	.ascii	"\256h\362\257'\203o\336<\351\232\313M\3045\004+\353\317\213\213"
+	.ascii	"\035\0335\023\213=9l`\354\250+\344\b\262`"
+	.string	"\260%>\212XN\270%\276\271\210\241\334\023\336\265#%F\355\223wJ\310\367\242@\344k\256\335+\027\"\367\303\263\267&\241_\033\211\230E'L\334J\370\253\355\275:\371G\335t\311\215\352\003\352\217\344L\300\216\301e]I\330i\235\326\370\353\214\334\b\242w\307\317\301\230z\237\025\031\373\241\210I\024\341*9\032\315\234i\335\001\234\353pXE\337Rj\333\324\327!\035c\272\177\017\266\244\206bs\035\302\251I\234M\367g\211\327\314j\002Z\036\365Xa\023\254\300)\277\231&A\231~\004\357\300&\357\357M\240\006*\325g^)\025\034\025\025\2130\326\243#\370\3101y\222\254\264FB4G\237DW3}\205\316\231\377\272x\242?\005\373\332E\336c\307Do!C\221\260k\274lo\363\022\365\253\033\322!yj\321\242\217@8\022\206&\t%W\021\330FR\203\236^\004\341\006\365\374%\3550\3739"
+	.string	"\220q\231\331-\202\215\235\314\337\231\301\2413?g\0036p\330\347o\345g\253-\303\330\201\330\334\3014;\202\311\030\004HBtZ\005\\\330\n@\233\320\201\317\021\013\211\301\253\245\335\361\376i\305\273\227\374\007Qc3\202\313]\205\321\307\352%\245\331\3726R\213\034\313\307N\237\262\255\253\323pH\232~\021\221\261\371\231 <\334++\324p\"D\023\264\022\244\240k,\372\251z\006\307\025"
+	.string	"Ga\271:\245\313\200\253\241\024-K\353\003\004G9B)\020e)4_\013\222\274\017\bl&i\374\207\352D!:\200\265=4\304p\240\334\"\252P\264\263\026\030\3351\t\227\233\214}=\206\205\262\rs\213(t|\027\367\230\035\342C\251\n\254\223|s\3308K\257(\304\200h\230\345\3242\267\317P\027"
+	.string	"@\350\270\306`L\337puu\222\247\204%\346q\261\312v\340\200\324\023\3035j\301\3207\243\245\237\034\003s\345\311s\317\313&"
+	.string	">\233 3$\353?Cl\2253)\331#\362g\242\223\275\006\315\004\246a\337t\311\244\"\241\244UV\316Q\230\307x{`\221\243lrC\364V\204U\325\234\274\354;\026\265/6\3235\312\3569^bfR\264\262\210\027\210UP\017%e\262\344\031\336\362OJlTQ\002\267\240\007\227R?$\322g\306!r\025\251\026T\031\017\353'\261\007\343O\351\366~"
+	.string	"?K\241\350C\354\200\251"
+	.ascii	"L\027\264\022w\230(\341\262I\341m\271\254\020`\343H\344\267\026"
+	.ascii	"h\3214J,\016\333\313}X\272\265fK2a\301\001\315\324^.1"
+	.ascii	"\201\360\247O\341/{\261A\217\264\2111*\254\360{\277?\205\327"
+	.ascii	"\315\315\216\200\332\216\333\332\272w\213\366B\b\233\020Fb9g"
+	.ascii	"\322A\024\177\023\351\210\373\313\300\223\324p\254\305\352\324"
+	.ascii	"P\305\332\214#\032\272\251\035\026\355\313\246\265\247,\250\031"
+	.ascii	"\244\304\344\202!\034\351\207\021|\206\340\366\342\004a\214K"
+	.ascii	"x\356\374\033lCtEe\t\225\367\302\365\333\nq~*U:\306\031\205e"
+	.ascii	"\025>Z\341\265b@\016\001i\2416\207\247:\222{/`f\354 S\346s\231"
+	.ascii	"\305szb\301\324\210j\013\366\300\300Y\347\337\237<\303\230\375"
+	.ascii	"\300\366\303\016\310\253\022\311e\013r\371W\213\\q\353c\2329"
+	.ascii	"P\333\363\233I$ \272\354M\332S\022\252\222\t\252\305\020y\252"
+	.ascii	"(\255y\261q\f\020\365()\352N\302\247\370\031\"\250\021\241*_"
+	.ascii	"|\350#\307\306\224\262N\22049\326\177\231\002\242LOe\325<IT\311"
+	.ascii	"_:t\321]8\344\020\226\334\3522\227\274J\365\247\300\006iV\252"
+	.ascii	"\266\206VH7)\361\237\2614\023~\260\323\007\266%\304#`q"
+	.string	"uK)\371\003h\035:=\3520\341\214\217\316\177*\345\376h\247\201\231\341\354\345^\331n{\275t\243\204\027\207] \330\260\263\205\362A\263\336bx9j\241,\344%\317)\275\375m\2270\240\272Q\314\004z\203\005\325pn-\251\230U\024\264\216\304Ty\221$\340<=sU\260P\276\245\262\004R|\332\241\243x\310\365\261ha\026\n\352\310\372\212\030\264\217x\242\325\362\024Xc\214\336\331{\023\223\234\250\313R)F(}\270\275\350Ii\252(B\004\212\244\233O%\324B\352\206\313\314\245v\304\212\337\337\231\253\360\307g\305\315\334V\fd\027L%\r\322U\002\250\253\242\260\037MI\321\037R+9\037\226r\371E\315\231\307\356\211^8\013We\271\030\033\353\200lS\3050U\204^&\027\t\324\306\235\332AP\032\035a\216\231\234\316\211\344\271 L\013\277Ui F\252\310\005:h\324\312!xg"
+	.ascii	"\323V\262M\346:\321\265\205V\b\004:\321D\004ri\350\323\347\035"
+	.ascii	"41ET\264\272J\222\211?\350\236\021\316>x\276\262\022\r\256P\222"
+	.ascii	"\337\211\324n\367r>\260\331\273\263\212e|\317b\t\b\375\233x\b"
+	.ascii	"\324i+\332\344\004[\341Ix\272\307T\2144\346\005\345 \374\267"
+	.ascii	"\0011\016\266\207T\260\036l\bX9\315\346\034!\203M\3756\272%\246"
+	.ascii	"\264\367\177\330?\b\271\203~\203\260Df\206l&\030\310\337\254"
+	.ascii	"\330w0\352#J\300\320kh\024\267\0043\327O\033}kb\243\212N\016"
+	.ascii	"G:w@\240,!\255l\306\007JK\361\272\351\213\227\351\223\325\313"
+	.ascii	"\256Zu\300\244\301\344H\341D\235\021S\016eK\022\311W\277\002"
+	.ascii	"n\360]\262\352 Z \317\030\336\0268\200ma\215\027Y\2760.\373k"
+	.ascii	"\227\325\030\212s\321\312\373\263\234\273@g\t\320*\026L8\260"
+	.ascii	"g*F\006\370\302W\310\231[\251\036\255k\317\370\223\375\230\033"
+	.ascii	"\352\3059_-\360=\344\204\210\362\326M\377k"
+	.string	"\365\304>1\310\313\033x^\214M\004\264\271?\370HgO\365\2679ck9\276\233\272\t@\022\220BP\356\331\324\260M\005\224\361\016O\235\016\346}\373O\337\216|\300\245\365\221mo\374bR\275\026\316\227\247\376\375J\bs(\025\233\252\334\3071\340\370G9\235\236\2019\371\310W\252e'\f>\"\203-\326_0\365F7\020\345\2539\374\355\026\373\362\306~1l\226\244\364\340A\213\317\362\210\216\302\b\267\0051\304\223[\376\240\251X\350\232\216\2021Y\264\231\331\007\232'\025_y\2427j\246\343\236\261*7\355\237\343\325\265\213\247I\243\305\273\177\313\306\032\305\377c.\001\307\237\360%\006\266w\036\241\336#\217\303\235\034\374\033\312C\f\"1\231\234uH'S\262yI\023\212n\357'\333\021J\231\264\222\301^\234Z\035@l\213\241[\f\360\221\177\265\317,\267i\025\326\030\0266&f_\301\302\030\214"
+	.ascii	"\257\030\311n\260i\033r\203\263\331\253)n\334\006G_\332\304>"
+	.ascii	"S{.\206\\wcC&\020.\321rNQ\226\246\004<\225H\340\260\200\204u"
+	.ascii	"1\021\310\207(r\225\327\331\340\334\230\2225#x\326\013\343$\006"
+	.ascii	"\323F\351\314\340v\004\032\3003\307\324\f\371\030\013<\366\224"
+	.ascii	"\004\316\214\212\036\274;\233Z\241\346\255\217\353q\270\"\247"
+	.ascii	"rf*\323\326\022\244\005\205\020\267a\021E\374j,\257\200H\246"
+	.ascii	"\033d\324j7\337\304\004\n\001\030\204l\334b\210XlJ\351\305\271"
+	.ascii	":\203\t\374@\324\300\274\371\036\243q'\370\204\021?U\306CG\266"
+	.ascii	"R\365V\376c\237\016\351\250\222\007H\247\022\206;\025\004\357"
+	.ascii	"~\253\001\367y'l\270\227\372\005}"
+	.string	"[\221\237\207\203g\211\330Ax\023\353\247\340$\353s<q\333r\305=p5\007\026\374\b\212\271\226!\374\212\210.*\202\300g\304\316\r\214\327KU\345P\"K~vGD\253\364\033\254\301\350\236\263-\212j@\b\352\346J\0274(\317\357\347\272w\177(?\242q\373\032\004\337u\207{\304\233\344\326\375\035\261\355ULeZ7\344-Z{\265\247\301S:\333\315\322\345A\200\363\232e\200\255\016\250I\370L\233\314r\201#U\260H\371/y~\026\376\030\245~b\345r\310\230\255&&\345\356u\342\272J\371\201/_\004\275\353\226r\217u\243\302\265\271xB\242\031\243\003\333\312UL6_\030\203\237\227\322N\377yu\036\330,\202\\@\257\337nV\001m4\270\260F\tN\230\323\265c@(\214\033\212/Q\275YDNI&\333\203%\315\334V!\253\357q]\311\313x(\216Ilw\213\220\024\f["
+	.string	"5\237\"g\365\205\b\223L2\221\032\336\337\002\325\204\301y\322\216b,!\025\303\265.\272\217]!\216\022\302\206\030\256\\?\345\002\031\241\356r\2246M\333\030_\263D\006\367\233g\216\031\241\311j\203\250s%\204^\007\342\007\320C\325\217\235\266\"=\003\362\317K\310O{\271\203\360\232\214:\320\312-c!\376\030\336\345\323ZQ\244\345\321\305\263\244]w\203#k\246\201\325tj\213\262\276\207*g'\3178\304\345T\030\3608+\001>\314<\022^"
+	.string	"\203^\2504\007\270\250S\354z\013R\216b\r\225\304\021\273\027\300Z$\376\366\302\246\273=HV\217]6\223\323\240\357Y\323\373\261~-\340\347]\344\336\206\320%I\271#\327\031\214\201\277\223\021_\261\305\035\021\323\247\340\025\334\334\027Q-U\304\024\334\203,8^$Q\310\263\270\254\037\270\203Y\212\247\327\221\256"
+	.ascii	"=?E\016\227\202})\376\236\302n\004\340v\302\021\322\300\342T"
+	.ascii	"\316\251\026p\250\020-\235:\204<xZ\244\372D\342Pd\323\005\307"
+	.ascii	"\240*x\037\243\222T\363\353\244\316(\027\246\301QC^\375\037z"
+	.ascii	"\254\3701\376\305\006\313\342\340\021\3435\216,e\202g\033y\244"
+	.ascii	"/>\003\212\352\200\366\274\254\322\366G\336;A\236\266E\006\334"
+	.ascii	"w#d\303ec\264\324\031-'9\365\275{\032\264d\016<a\243@RI\260/"
+	.ascii	"\005\024}\317C\013\200\005\205\007\2303\262\204\316\341\367\302"
+	.ascii	"\335'V\321\374\001|\226\017,1\231\035\247e\0251\306\202\266\001"
+	.ascii	"\035|\031\343\3108\204\366\273\004\201\35224\352\020\307\022"
+	.ascii	"}\204_9\246\247\003Vy\222\306\016\f\230\206\336\236.\322BN\263"
+	.ascii	"\026\003"
+	.string	"\372\004\365\313\3565\334\244VC\200(\255I%\315O9S\341m)v\363u'v\333\t(zo\224\272\n\036d\030\tP\275,\332\374\311\235t\013\033\205\306\202\321\355\244(\352\346\371\212\356\035!b\254\211\270!u\254\262n9\342\233\322\321\253\362e\222\255W\032\002\303W\312[wH1\207\002\357\022\023Oc4\347\245IU\026\207\236;\026\031h\325\332\275\324\243\343\246\023uv\324\365\245I\223y\3111V\326\330'\360I{9\257\366U\221\207\245\272\t2H-\006\0241\246\022\253\313\300^\261\266\255) `\302!\321k\370r\272\324\021'\212b\344\226\001\025d\253"
+	.ascii	"\f\245]\374j\200\026g\206\212\275\254\353<\250\263{a\221\270"
+	.ascii	"\302\226C_\217\244\233\024\005\211\362\364#\251\340+\261\367"
+	.ascii	"!\bT0\002\004\352\277!(\215Ce\274\225\262M\275\316\312J\202Z"
+	.ascii	"\264b\"I\224_v4\276\220LG\005\372\367{2M\335\266;\375\314\266"
+	.ascii	"U\363$\362\b>\2075\223H+\261{\366\273\033\260\235I\246,\362\331"
+	.ascii	"\370s\354h;r\204\375\377\227&m\245 \31790#[\264\362\013\265\306"
+	.ascii	"\310\347\332\225\253oi\370vuMC\027\235!\342\200\024\021\340Q"
+	.ascii	"\004\240\227v\313Q8\234jS\324\221}\356\324\024\022\2631t\227"
+	.ascii	"\344\2024\201c\f\311\030\262\377\213\223C\217%\301\335\023IG"
+	.ascii	"\232\313H\246Z\244=\261\234\311\331\210\373\250\225\263\3711"
+	.ascii	"\370\222\\\025\320*\005mH\365\260\270\276\002P:\260\246\0203"
+	.ascii	"\017\352c\322"
+	.string	"\023cp\004\366\351\017\213!\346E\371\372\270\305\bL)\235\305i\036\226\346H#\322\276\005\307\277\374\256\365\344G`\274,\232gs\017\367T\317\r\332\2025#\343\025\254\373\003\341\242U\256\322\301\345\344\241\377{\201\202\317@(\261X*y\022\202\300\2529)\303z\262\035}\223\225\326\017\022\037\200\220\214\257\322\310\254\262\222\345\264\256\213\301\350\352\264,)\341\257\337 \264\030\214C\370,_C\001\303\327\235\016\320\375K~b\0050\224\313\233\022\361\t.\235\344\356\257\017#B\353s\213[\347\031\020\033\353\350\256\3020v\244\361\351~q\2678\205Z\333O\021\237K\004S\207\316!%2\016\230\227/\324\\\303\2412\225\202\214\242\fy\017A\262\252\272Q\346D\263\235W:\250\374dqn\214\363\036\301=\201q\211FnD\321=\375\227\267\274\364\314\f-G\214\251\007\232m\207\020\373\355\217\376\305\3424h%\354"
+	.string	""
+	.string	"+\267\346\301CB[\226(>"
+	.ascii	"\007N:\220\311a\3168\n\345\027x\310Fe\213B*"
+	.string	"\370\024\031_\215\336\001\346\374o\272z=R\273\361\340\327N\304\256\026\254D\016&\343%\327\347\366\267<C\266\253Ks\226\316\205O\023O\212\240S.Z\3100\331\327\363\206\276\374\004U\031\371\036\037\303\300tVK\342|\026\323Uk\270\231;u\303_\302t\r\267\353f\354\244\026\204<x\320B\360\332\027\250\020\304r\214\030\021,(\262JI\004\r\3475\333\241\255\330t\322\340\220\023fw\260\245\253\272\fuM\256\327\251\026\272n~\313\365.?\003\035\f@W\330S;\210\024\360\263\311p\344\201:\302\274\261\254\234x+\3300\022\320\2370><\017\230\205\355\303\023\334D\b\266\021\315\025\220\034t\311\307\226/\273\311=\032\203h\227b\277\246X\331\305^\345\355\213\367\222^Cq\264-\203\236\261&\211=\377\371\007\352\333u:\220\247\3645x\034b\031\204\351s_\337\301\266\343\340%U\214\032[\231v\016"
+	.string	"\346\276\230)v\325\t\346\260\025#\215_VI\240.\252$\256\177\"\006\005r\327\274\035\300g\231z\337\244k\363\253E\335\367\340\270#\bJ\006\bnC\245\3145M\013\242\236\241\361\311\220\214S\372\313\203\255\360\270\311\232\212s\300\331\207@\340\2723-]\200\331 \340\3604kd\0021d\204\004?\266@\020 h\312\276\211\n\360\342\274\344\205v\310;\306\bU\\\202\302\b\266\247p\362%\370\267~j\274\271O\021\032l\361\324]p\272\241{d\211w\372\177A\357ZG7xd%\362\343\032\211\032b\251\017\314\256"
+	.string	"\343\346\017K\246\273A_\310\326\375\023\nzI\315\344\247\334\2373\266\304l\211\247u\n\201\222\335\fR\311*\265Z0^7Ud%"
+	.string	"\242\346%\316\250\245\353\306\016<F\\f\212rH\255oJ\220h+<\260\206\307\020qb\036\034\2478\327\312\002\2114\177\267\241\216\360\257P\033\210y_'\025M\243\367=f\365\355#gn!\036\276\317u\037\344\370W\373X\374\235\020y_\3635\232w\361\202T\022\374\242Y\024\332\241\217\267'\3021\034Kn|\216}\237\b\304L8\320\341\r\026\241\331\230C\300\217!\367\200\361\320\254\027t\020\306\221\351\356\206z+r\214\362R@6C\024\272Y[\006\265\372{"
+	.string	"\r\354q\306\270\322\247\220\034F\301\340\323'\212^b'\003\\\345\024\027\232]\327\361^\f\221\264\242?h%h\204-\230U\236i\271tz\350\353\016s\363(nf\fs\326f7P\020ESX\234_\177QK\\\321@S=-\t+\3449\031:cj\213\371h\362v^\270\2710\030\237\342\bI\213O\022\320\222"
+	.string	"d\243\261\346\325\207#va\275\372\235\335\210\227,j\271\352\005\035\245\b\006 \260\307\252\335\222\315j"
+	.string	"\225\241\267+w\230\246J\275\020H\217\364\213\2506\273\200\024 \366\247\240[\t\034\030h\031\355\235\b\370~D'\304~]Do\225\304\365\2013V\356\254\212\023\344\272\370\3224}"
+	.string	"\367\200xec\333\313\305\331Od\354\245\300\017K$\351\301S\350t\177\217&\032\177l%w\253\242\260\303 \3360a\035?\020\321\203\354\377\347\3038_kt\217T\321"
+	.ascii	"o\320\225\266\032Z,w\021\264\270\300;r\367\240\276\362\336\017"
+	.ascii	"sT12\360\373\207p/k\223\006\214=\n\006\030\377\251\273"
+	.string	"\"\005\352\200\350\250Z}\002\031)\226\241D1\201\306\032\016Qs\3168\024l!\032WSzr\310\022!\221\034\b\006#\331\246N\200\371\373\205\242\031\365\b\022\364Q\370\374J\037\213\377pS\334\364\037\013\032\320n\"8\226Z\311\236\240w\201\2369\257\205\221\261X\340\231\263\312\312\271\f\342X\305[\245\3432s\370<R\003k\n)\232<)\261\216V\351\364\234=\251\323\205}\bSY\0139\321\363S\rp\220\250\")o\220\021v,8vflPE\312\261\003\265\225\025\320p>\200\335\252\350u\301H\234\312\252Q\310\220kT\0051:\360\247\017D\351h'\300\361w\234\246\273\234\332\240\274W\024\2013z\214\003\226B>\013cg\326f\335g \027l\373\326,f\37450P(\301|]\"\265A\372o,\205\013r\tG\334ya\005\222\217\214@\346\303\267<D\354C\026.\350\300\323A\023\312v"
+	.string	"\347\360\357Y\362\241\rw\226\"vQZ\307r\347\227<,\363\244%\234j\2430\261\363)J\367\265BP\033v\276r\355(\347\270\367\274\247\256-\\\201\001\265\311@\230|\351\211\024\002B\217Lh\307\312\rr\374z\211J\331A\b\256\t*n\313=\302>\231\0050\016\257\276!!q\346U\327[\260\230\301\363"
+	.ascii	"\f\036k\231w\003\225\362\271\274J\221W\032\016\0166\006\301\036"
+	.ascii	"\333\306\223\261\007\207=\325M\016\333Y\007\276\302"
+	.string	"\273\274\232\317\334u\311\234\322D\372j\340xJ\243`\021\\\r\fX\351\030r\343\024 .\340\\\275\r\033\271Jw\244\304t\204\203\342X\337x:\"\243\306\001:\344\231\005e\004\227\3175\233\272\345\221^\257JPS\"[\016`\3143>\365j1\252wh\251n\272\n\375w"
+	.string	"\367\326m+\025\037\002\266\023\333\213\201b!\023\304\317t2#\\n>\215\242G\343\235\362\271\247\t\216\271\031T\357A\365~\006\237\0244\314\200\rI\301\332!\236k\254\346[\327\324P\224\233\226\255H\003Ki\206\274\006\276pMY*\360\253\232\351@\261\020v\214\232\"\231F\242\235.\374\364\202\336?.D\305\314c*\214z\216\233"
+	.ascii	"\b\314\312\310\007\335\003J\2319[@\347\221\375w\034u\"\326\210"
+	.ascii	"\265;;\334\203\017G+\371\305\231\3664\001\263\016\2058\333\231"
+	.ascii	"\022'\312\013\356\027{#\321`\b\b\020Cz\201\300\251iE\3147\362"
+	.ascii	"\2039\003\216#I\340\fO\334\006\325\313\353))"
+	.string	"\031u\304\363$\353\354t\336W\201\203\365LUtG\374\264\211\013\316\213>Z\224Xhb!\202\200\232\207\201\013JC\213\022\033o\342\346\341\202\262\2353{%f\255\276\367\242\264\21611\327\210\365\326\353\rS\246\260\271\252WU\023s\021\202\242\343\271\243\233\347'\217\223\3437\302B\024iHH\262\202\272\002\0136\211\375Qs\241\t\ty\200b\324\222F\203\002u\254YfD\364\243\212\336#\235\005dq\263},\255\334wjse\0132#\335\017B\232P\314\214s\005\2060Vu\013\340\364\214\177\346\032\2268}\333\226\365#\366\007@6\0260u\"\302I\205\274\257\302\227\002q\346\316\204\tA\3158\320\177\276\007\320m:\313\235\016`\2366\260\203\354A\306\006\002`i\243\305c\340\355\211\331\343Pq2I\343o\354\226p\217J\211!\252d\374\302\0201\212f\370M6prc\212\217>C\257\317n"
+	.string	"o\304L\361\342F\033H\314P\373\240}\357\013\313y\226E%\373\021\261\310\356\301\0074T\221\316\351\233\350\217\372J\364\005\2733\247\202\217\242\025\304\237\261\360\252\371\035\363\210\372T\311W\374\005f\306\033\221\200\203\350\224\220\203\250\351U&\213\330-\331"
+	.ascii	"\013\255\331o(\"\242\200\206M&\366P\030\017\302\363zJY\336\322"
+	.ascii	"\005A\034h7d\232D\326\266`\334\303\2512\005\260\303\300o\312"
+	.ascii	"\201\377\336Zp`1\352\004\346\250\b\365\323\3459\345\222\007"
+	.string	"\004\240~\202r6\303H\266w7\371,\210jq\032\323\004r\312\350\335\320{'\rS\266K\366\244\257l.\230\245\233\337};\rF\263\0361;\005\335ZLQ\347\224e\032`$@c\3540\355C\240\325\f\237\214\355\230\321\312\225`?\336\246)\227U\210|^,J\231KA\022awB\206\251\203\252\326\317i\337R\232\215]\225\\\376FOq\257Q\304\345\241\026\277$\240\374x\204\303\230\230'\261\177\254W\232\037\212\332\374}\204\365\301\300#\177K\255\204\022\244\346\367\211\372|\ty\213\250\224\177{p0B\246\302\222\352\307\333\326\207B\252\361:\336\236W\b\330TeoB%0\342~\242\030r\220\034\310+\024g\306YxGLc\306k\315|N\025\006P\275^3\230h\t\376\205\\\202\227\212 \b\024 \0375\201!\024T\261\363\247\314zH\034\033\b\363\224\307F\333i*\355\217\332\3075\2406"
+	.string	"f\323D\235\237,x>\230$-iN\240j _\\\305\025\251\256{\2231\3259Y\300\273\007\320f4\207\304\335T\363xD\3012\244\261M\005\036\210F\3100D\212\366Z\231\035\022\225d9\322\257\326R\312~\342Q\346\013D\030\240!\262m\364\322\026\313<?\313\250\331A\213\267\245&\331#\320\2013yn$\342\342\204\237\344GU\004#\017\307\017\354\251\336/J\003,\246\202\303\364+%O\036\016I{\341\220V\250\030*\020$l\356\377\367\366u\260\322\0271M(N<\271\221\212\276\305)\2646\307%x8^\257\2771\301\361Iy\342\270\201\324\317\276\243yh#\226IGp\2624\001Pj\t\301\2402\270\360\337\034\b\274:7;\242X\340\371GV1 )\2321 E\r\351~("
+	.ascii	".bb\304~\263?M\320Y\341\340\302\r\266\250\206\315\205\206\372"
+	.ascii	"\375\277\353\003\2639\374\376\242,\003\002\200qD\244\230N#\034"
+	.ascii	".\330x\350aC\035\200_o\205\323P]/\267\212\"\307\267\300\362r"
+	.ascii	"\307\372\017n\323p\263Pp_\353a\243Lu|\326:\2258\004\246\342f"
+	.ascii	"\fIT\r(\020Q\310\342\177t\204\021f\233\234\030b\0309\264\f`\322"
+	.ascii	"\216\251\260$}\323\0131\227\367\017\n\275\303\307\310\013\300"
+	.ascii	"\331\224\303\037n\376\250\345v\365\034\025\024&\017\340\204:"
+	.ascii	"VY\252H\t\301\300\377\312\036p\247\265v\226\325ae?\220\004x\351"
+	.ascii	"\017Q\376\233\374\267\352\270\031Pu8\267\376\202\372b\326\376"
+	.ascii	"\371\2643\031\302\376\377\254|\360\031!\243\025\355\347w\227"
+	.ascii	"@\341}\373\325\230Y<`u=(\276(v{\335\2774\004j!\310\276.<\377"
+	.ascii	"\205\365\217Pj\354\212N\375<n\037\220\360\313\373\020\340\201"
+	.ascii	"T"
+	.string	"x\016\200\235\020IC\200\034\"\3258D\364:\310\3577;\241\277\341\007\345\314\202\207\366\f\215\016`&\234\267\034\370\250\205\007h\344\334@\257\377\213\241\326^_\305\226\232\350\355\217}\007u4\303\307\2049\262\316a\226\372Oq\217\307\367\321\177\276\247\375:\322\323\261.\006\330\335\357\357i\336z,\323\316\273'\337\311@\235\304=[T\237\273&\256 ;\020\264\207[\343u\246?*\346~&\017f\223_I\334\303{~h\352\205\200{#\323:\202r\366l\273\177G.\316\341t\214\277\344\352D\253\233\361<\245#\354D\313\253y\335=\212O\274\366\252\321\355\344<\314\253\253\203\275n\307\233\331\3711\345|\3266\216\260nk\024:\316E\275a\311i\t\212]\257\347\033\261\352\2210\2339w\305\017E\373\202\265w\210x=\342~}\257\211\303\345\370_!\217B\033\224\2347M|\362|!\326y\233of\237"
+	.ascii	"\221\271\022\365\361\331\241e6\\\375\017\207\237\020\363\330"
+	.ascii	"\247\207$\r\013\324L\231\371\270\375mN\352\256\263\237\314\316"
+	.ascii	"\350\346\004x\257 \265\n\241\345F\251\262=\231t\241\027\257c"
+	.ascii	"\312\025\324\017\224\217\346\357t\377\273\3552\231\364~\304\347"
+	.ascii	"\346Y\320\325\267\344[\224\207\271\373-\340p\021\313\210\353"
+	.ascii	"4\f\346\3772_\177f\267\016~\003\303\302\023P\313Ps27\266yk\327"
+	.ascii	"\032&\205|\336|\032\004\337\3136p\340-\2008l&C\321\303]\275\241"
+	.ascii	"\376\312lV\246\355\017\030%\037\356\271\347k\321\325L\263\341"
+	.ascii	"\347cO\231\360\310Pn\347\310\235\021\252G\025\177V\021\213\261"
+	.ascii	"f;\246\301\233%.j\355KW_\252\363<q\273{\371\"\36582.\224eJ\223"
+	.ascii	"\177\024\377\241\370c9{\272\243\224\333\337|\021\223\317\346"
+	.ascii	"\273d\223\351b\376c\305\377\367\337\311f8\234\026c\372\276\036"
+	.ascii	"\344K\022\375'\230\357\332\357\303\257nr\311]\256|:\260\261H"
+	.ascii	"\374_\324\336\212/K\022\253\260<\360\374\215\035\222_\273\255"
+	.ascii	"G\2749\202\bf\336\3770\033\237\333v\362t\020r\3379G\302o\306"
+	.ascii	"\270\302\304Y\203\343\245\307\355\364z\206\233\301\346\034T\017"
+	.ascii	"G\262\241\036\361\351."
+	.ascii	"\377\361\3678x\\\021\203\340\b'r\214\234\336g\276(\322!\366\235"
+	.ascii	"\030\365@>h\356AL\026\331/=\261\255;\357\205V'\272\225}\250\246"
+	.ascii	"\027~!'\204\230>=\024 \374\007"
+	.text
+	.section	.gnu.lto_.symtab.1a7707b3ec91de11,"e",@progbits
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\005"
+	.string	""
+	.string	"pidRuntime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\005"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\005"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\005"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\005"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\005"
+	.string	""
+	.string	"pidOsdAntiGravityActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\005"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\005"
+	.string	""
+	.string	"pidGetSpikeLimitInverse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\005"
+	.string	""
+	.string	"pidGetFfBoostFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\005"
+	.string	""
+	.string	"pidGetFfSmoothFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\005"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\005"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\005"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\005"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\005"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\005"
+	.string	""
+	.string	"acroTrainerSign"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\005"
+	.string	""
+	.string	"applyRcSmoothingDerivativeFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\005"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\005"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\005"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\005"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\005"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\005"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\006"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\006"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\005"
+	.string	""
+	.string	"dynDtermLpfCutoffFreq"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\005"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\006"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\006"
+	.string	""
+	.string	"pidGetPidFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\006"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\006"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\006"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\006"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\006"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\006"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\006"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\006"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\006"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\006"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\006"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\005"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\005"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\005"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\005"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\005"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\005"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\005"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\005"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\006"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\006"
+	.string	""
+	.string	"vectorRotateSmallAngle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\006"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\006"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\006"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\006"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\006"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\006"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\006"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\006"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\006"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\006"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\006"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\006"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\006"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\006"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\006"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\006"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\006"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\006"
+	.string	""
+	.string	"applyFfLimit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\006"
+	.string	""
+	.string	"shouldApplyFfLimits"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\006"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\006"
+	.string	""
+	.string	"interpolatedSpApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\006"
+	.string	""
+	.string	"getRcFrameNumber"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\006"
+	.string	""
+	.string	"filterChainApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\007"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\007"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\007"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1a7707b3ec91de11,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
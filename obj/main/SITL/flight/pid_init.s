@@ -0,0 +1,1382 @@
+	.file	"pid_init.c"
+	.section	.gnu.lto_.profile.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`q\002\245\b"
+	.ascii	"\342\007\036'\200M:`\361\225\233g\250O\301e\"*\271\204\213\236"
+	.ascii	"\006\324iC\230\002\031\221\021\031\363H\020-B\310\226;\311$e"
+	.ascii	"\210Xf\262\320\b\027\226\2256\221\201\255\326\365\345S\363\257"
+	.ascii	"\366\377\036\262\241aP\230OQ\220\020\202[)\t\244\022x\231\377"
+	.ascii	"\237\327v6X!\013'{\3506\206\347\341\266r$:\333\321\350\333VW"
+	.ascii	"{\322\230@j\247\321\350\005\210.\243\017^\250\205]\250\201\326"
+	.ascii	" \005I\n\205\306\320\002\231\262\316\001\021`\021\201\030\t\241"
+	.ascii	"\302\224\246=\003X\002:K\337\311\202.\341\375\365\210~\260\027"
+	.ascii	"\352\207[\267I\272d\005\207\312\3218c\226\205\357\007\2776\177"
+	.ascii	"\342\027&\n\372Q\246\334\272\350\357\b\300\211-H_lO\0174\340"
+	.ascii	";VZD.\244\372\2647g\361\253\245\237xTh/.\251\007O\364\277\336"
+	.ascii	"\035\334a7 \346\227\343\242\367\377c\315\356\036\225\347j\224"
+	.ascii	"\276\216\315\236\275\342`'\317\\\026\023\346\036\t\225\021e\336"
+	.ascii	"oX\365\004)"
+	.text
+	.section	.gnu.lto_.ipa_sra.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"\355\003"
+	.ascii	"\262\004\r\023\240)\035\377\377\303\377\357\246~\265o\3777\022"
+	.ascii	"\273\211L)\256?EH\006\236X\315_L\255\330#\307\177\214\365\013"
+	.ascii	"\275B#\266\323\016\270V\317\373\263\203/\001\" \260\20213\017"
+	.ascii	"\350\f\200\225\246#\200$\240J\214\317\024?0Hq\33413\200SH#\304"
+	.ascii	"\003\254#\210(\031\256\004\372\004\315\005\023\202x\356B\"sE"
+	.ascii	"(@r\204W[,$\232\306>\206\f\f]\\\250!"
+	.text
+	.section	.gnu.lto_.inline.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`\335\007E\033"
+	.string	"\246&vA \217\223\016@\200K\300\365USW LW\023&3\025t\372\246\246"
+	.string	"\351y\250\222\016\321\370\215\206\226Q\246b?\013kD\\\t\216@\207 p\"\300\301\265\031\274\323\354\330\210V\004I\3332\311\024^"
+	.string	"n"
+	.string	"g"
+	.string	"\226\0217 f\220v#\213\036\024fQ_\363\303+T\240\254\340\251\027\355k\333\340\377\2505\307\210.v\244\351\377E3\246\337d"
+	.string	"\201\276n]^\331\255\353\326\271\305\315\353\236\003\252\r9\3467\311\300\360\260\310\337i4_;\322\365\307\355'\377\237\312\266\033c\261\031r\367\037@\253i5\"\034\320$\377HS\214n\035\366U\255e\216<\235N\247W\254\037?\222\337\263\207\342X\204\034\205aQ\207U\376\221\325M\306H\306H\267.\323W\344P\3702\356\346\312\372\020t\356\353\3432\002\205\024\022\256f\345H\024-4\220PuV{\374RA\304\007\027+V{r\302\005\017&\004\371\245\204\013)@\353\341\022)\203\t\262\250\272\221e\003\331[\201H\257\331\373q\351\177\246\316^s\204\322@\373\341\007\377\310 \016\364\275R\306d\255d\311ZiB\311^\357${\275.k\275\237\\)Y\312Z1na\"\201,\227\261\204\0353@kP\035\352\371\304\025\354X%{bAK\205"
+	.string	"\301\016\330\261\250})Y\fQ\035\203\264@\363#K\376\033B9VEz\001\355\326u\353\256\202\254iU\316\234\237q\2011\001\263\251"
+	.string	"\316W`M;-n%%X\354\275\252z\002\267Xh\301\340\342\213\347H\033OH\375j\232\265\352\251iY\206\345\263f\031\376o&R\025\257i\331Ay\362\177Sc\177]\375\255\376\227\313\254\237\215\307c\305\270\324\264V!n\025\200\310\250AEh\246F$IAA\262\034\220\002\241\231\262u\022 \0255\007\243\2109E\245\240\244\234\202\324\032\346\013'O)\270\201\3539\021\342&[\310\263\253\224\271\274\311\0366\316C\254\207\350\030\3172+D\021(\016\030\004\323\231p\275\314\221\016)z\314\204kD&\204\306\022\231\201\035J\275\tb\233\323cw\212I\003\035\247\270&\371\314\271\313\220\004\251*\325\263y\030\363\210\301K\210\030\021\"\220?p\367m\343\351d\325j\233%4\366\215\002"
+	.string	"7E"
+	.ascii	"\326}\3008\022\036\177%\3261\346\213u/&O\331\253\205\255\177"
+	.ascii	"3W\376ho\257\232\203)o\312\304\316\013\313\026\301\0243^t\274"
+	.ascii	"\230{\rJ$\253\b~{o89N\032?\261@\332\334\020*-\f\037\304]\020"
+	.ascii	"\002\373\023\216\027\005\225\016\n6\237x\334\031\316\355\b\376"
+	.ascii	"K\023H{\261\257\f\336\006\304\214\313\221\267\250\221\032~Y\240"
+	.ascii	"\022e\254\326(\331\365\n\246\302\007X\324\337<\300\232z\241\252"
+	.ascii	"\365y\337\323\235\235\224\266T\237\270R-\364%\262\032\373-\\"
+	.ascii	"\347\3606\261(\225h*\207'\274\332\246\007\257,\205\002\310\254"
+	.ascii	"\003\b\235\325\005\204\371\276\315\033\b\235\320\257\277*\377"
+	.ascii	"GNV|\241\223\024\233\342X\360\020z\242}lo\365\257\007e\361g\315"
+	.ascii	"\364\r7\020\024&\317\035\267\312\360$\237\240\366\003\353\034"
+	.ascii	"w\272t\341\333f\033\206\261\300\307X\312\256}?\220\314U\200\347"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`\351\004\205\f"
+	.string	"\"\016..\200K\322\001\235+\225\f\344-\261\352\277}\030\007\231\241 2\263\027\033\032\"\243\212F\330m\006\240\234f\013-\377\214\0231\204\354&eJ)m\032\005~;`b\375\277\313\261\236\370\346>;\202\232>\3644\260\345\031a\"\324\344M\213\274\270+\273\265\006\302&7\332\231Y\177\256\300\307\314\230\016\254a\004\n%aR\250tm.L\f\225\316i\270\f\3740\320\305\371X\016\230\307\031\033\303}\350\206C\250\326\251\240(\n\202\243+\313\256\254\273\226#C\210I\242\322a\363\236\335\264r\345v\254?#\373\022l\324Zk^yd52\267\030\201\b\035\300\363\354>\225x\004`\250\221U!\232\231\026\262\034\220\002\021*\243:\022@\361P\026e3F\030#\204\020\"FB\2222\312(IqK"
+	.string	"C0R\226\265r\341\232\374'T\341d\214\241\215nvy\206\276\255v\026\361&[l~d](\363\253&\177\241\322s\351.2\022V04\005\003*\330\356\f \005\362\337\205\316K\307\n\023\374\345\371\367kvR\261\026zy\303,\2146\255i\372\201U\320\200q'<l\300\312\225\262'\330\f\3501\324X"
+	.string	"\211\036m\221\306$S\362,\"\341\343\366\205o\261\263\321\222\323\214\305\211\177W\354\263\265\032\032\357\267\243\304\305@\374\325F\330\r\254\t\222\232\302U\271\272\275\033\371"
+	.ascii	"\221\356\347\212\t\245\205\217\226\264\373f.\362\337\206P7\025"
+	.ascii	"\324\023"
+	.text
+	.section	.gnu.lto_.pureconst.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\003\230\004\004\230\004\005\230\004\007\231\004\r\230"
+	.ascii	"\004\016\230\004\017\231\004\021\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"=\b"
+	.string	"\242L'+\200)I\007;\002@\200\230\200\316\007)\243\206C.\302:\003\030\031\214\007XM\003!\025a\247#\200\177\013l\331\215\020\322\244L\001?\034\217\005\006\307\362@B)\320`\260\325\230\212X\212\032S\236\210\035Y\364\356\234\305Y\320\3539\306)\310\\\341\224\303iR\250\222[\023sB\356h^p\351\231\r "
+	.ascii	"\363\323\240\275\351=\334\3424%\231\337\025\232\253g,E\346\214"
+	.ascii	"\2556?b\317\225\027\355\b\004\\R\304\2445@K\242\352O\007|6\255"
+	.ascii	"\362\263Q\336t2\345L\273\342{B\004/ \220\202!\"\263\003P\310"
+	.ascii	"C\210y\346\302\341\2050\331\016\253\226\"Db\004\032c\006\351"
+	.ascii	"\024D\330\0255\334,\303\320@\343c\233\214\312\232\272\326t\322"
+	.ascii	"$x\267`K\247\t\332\016,\266\233\361\017f\233\026b\033\257G\036"
+	.ascii	"2\234\260\343\271S\257\24443\370\341\231=\276`\255\206\037\033"
+	.ascii	"\013o\355\367\017\267\356\270\r\023\016"
+	.text
+	.section	.gnu.lto_.lto.78f3fd24e22c6ab3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidSetTargetLooptime.31.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"\305\013"
+	.string	"\326\326QA0Q\223\016 \350\365\237/\231\313\363\366\001\371\234_g\246S\n\247>3\336\t\201\273\366i"
+	.string	"\343n\r\335R\320\310\346\211$\220\330[\353\032\032Q\220l\307|\255\334\021\350\254t\203\240O\273I\231R>"
+	.string	";"
+	.string	"B"
+	.string	"\246\220\253\335\0203b\354z\t\214"
+	.string	"\300\241\201\017\240\016+\027@\035z\263q\334+\261\rxl\030\331\261\273QI|{n\376W\274\352J\242\347\307\203\335uv%\220[o\373b\233\201\375+-B\276\2103\200\362\335\241\017\242\016\243\t\305\207Q~\266'J\025a\277\262\273k\r\261o\372a\2465\323\231\351W\nF\020\250\261\313\341\353\261&P\206\t\213\355\247\375\024W\261=\327\001\262{@\265\"I\341JH\3719\325\306N\342S"
+	.string	"\033\273\273\300\037\271\013\f\276\310\241=\237\017u\2304:\224\3239\017' \326\016\276\257D\303\356\350rM=w\202t\255RN\270\034P}\026\017\233\313\3222\f\213\240\2612\2133\030\315\342X\0224V\0265\013\025\254\013\024\"\307\232p\305L\307\0231\005\214e\233N\3240\254\023-\336\276\262\273{\r1\204\016&#%Y\325\276\016\343\205\336\350P\256>\005\022"
+	.string	"2\303\303\005\025\2708Q\300cG\006fO\212\274\250B+\340\342\024\262m\341\002\314\336$j="
+	.ascii	"\b.6\020\253)\343\016/\332I\006"
+	.text
+	.section	.gnu.lto_pidInitFilters.32.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`E\"=}"
+	.ascii	"\352\302\200+J \016\333\031\003w\264\240\243,dL\244\021#Fw;a"
+	.ascii	"\020[\325Teo+X\b\017}X\232\276o5&N\235\372\310\221\214\334\334"
+	.ascii	"\340 0\020\013\212\035\223\035\327w\242\361&(\031\214^\340+1"
+	.ascii	"\t\221\220$R\312\224R\n\241\002j\002\266\002@H\347\237\325\331"
+	.ascii	"\347\350\334\323:\363\254\316;\254s\222uF\036\235\333\325\371"
+	.ascii	"xtfW\347\365\350\254\262\316\317:\373\352\334]\202\317\037\032"
+	.ascii	"\"8"
+	.string	"\357\353d:\303{f\305Kk\300n\277n\276n\275n3\335x\335d\272\355\272\351\272\277t\203\351\026\323<\314\035\030\027\007\302\341\037\235>\276\2710n0h\367\330\362\320\312(\261\200^\254\350\222,wtp\206u\334R;\316\233\203\233+\322s\334cx\247W:\r\332\252\256!\256*r\207\357\373J\265\275\266\r\327aZ\216wZ\3508\267\305l\320Vu\265tWg=\332^\225j\007\261`:PZ\001\275XWW\262\320h\337\232\005\267\277t\320\276d\332-\270\276\303\367}[\366\312,\332^\201\274\235\271W\3506\267\335\224\264\206\367\265\302G\346}\337\230\314\324\366\312o-\304\366\332v\020\333+\263\313l\330oeo\3031\331\n3\347}\337\346\233\200\242i\251D\342\320\201\277\325\267\346\035\244\333,\236V8\251H\201\342D\263\211\331\202i\271\344\302D\t%\022I#\220D\034)\215B\024\201"
+	.string	"\340\203\007\242\016CB\034\2026h"
+	.string	"\372\361\351\341\331I\"\333#\273\252\357.wU\263x:F\221A\r{\205\341\033wr\323*\334\264\361\024\205\201\204\216\202M\237`\323M\301?@o\nlf`\267\370\023\234\343L\177}}\276<F\225"
+	.string	"\365\353\245\266\362k\027}}\224\246\353o\321M\224\030\344C$\203\362\265R\232.\027H\330I=\311\213\332\210\272\2759G\242k\021{\235\304\246F\006\245\353\243\272</\256\024\323Fy=#\212\206H\006\025\323!\344\334\306|\321PT\f\221\fZ\327 \332T%"
+	.ascii	"\252\262\213\252\224[\301?x8F%\201\240F\006\345\322De\260x\207"
+	.ascii	"\264\036*\323IK\324\310\240i-\304\345\016\3159\\\351\240c\324"
+	.ascii	"]\317\250b\210H\006\275\322\033Nh\262\2563V\350,\017\215\217"
+	.ascii	"\310\272\266\274\00663\007b+\363\037*\355\243*\251\250J91\357"
+	.ascii	"!\203Ni\036\025h\212z\342h\255k\004\3379"
+	.string	"*\001\032\326\311c\224\264\221\346\324\310\240a\215T\227\016\357\344\b9\301\362\354\265.0o{\255+\212\037\223^P\232\3554]R\264|\365\361\312R\225\357\373\356xm\271\312V\241\202H\006\205\323\257\252\310\232#\305\307\013K\345a\334\202\241\345\332\271\274\256\334\217Q\357\373\262?\275\240\315\0014\263\352\307\314\0310\027\021\006\356\304Mc\"\004\201\347\333\231\354\374\335\340\342\177\211\323K*9\362\223\317\354\242\340\246\340\375$\362J\033\237\374n\037\371\036H\221j\035\272Z\\6\030e\016\370\022\337\032\323\253\024)q\317'?m\276\304!?\312\256\027\266\3756\304j\177\247Jp\261\233\323\351\264\375(7\241\0261\266\202\357-)\030\252\352\333x\256\016X\033O\324d\nW\210\345\214\202\323i\343\361\243\025<U\230t\253\321h:\235\262\307?\002\367\307\376\261\213W\261\277\"\376AM\247\323\365\243,\344\327\227"
+	.ascii	"\016P\375\365{\253\321\312\247m=u\275\264\357\213\365\304\335"
+	.ascii	"\350\2742@{E\311\257jz\213n\377B\336\007\265\002\255\244\315"
+	.ascii	"\352\373Z!\371\377\023\345i\255]\261\214\246\303\322\226\321"
+	.ascii	"\277\207\205<67\236N"
+	.string	"\247\215j\2213\273\347z\316\f\036B\004Z\261\006\211\262^\345\260\r\034\336O\346i\241\355L\326W5\021\352\350\030\020\333\020\362h\3037\275\006\266\206\331\243\013\331x\360{>i@\212\251\354}\255\372\311\354@\253y@\210\360}\337'n\030z\020\002\356+\275r\004>|H\001\333{>Q\266I\353\374G\371\007\333/\001\034\033,gd\3563\215\346\007\367\025\016B\201\367\263Wn\n\330^\373[\256\225\324\306\260E\261\362)\363[\225\177\224\271{\254MJ\207\337\ns\217\261\316\035\326~\315\375\325]]\325z\315J\2224^3\225\221\251\246k&\322`\232+h\267n\251\026\323,\204un\200\201\366k\356\321|\315\013\264^3\2176\323\274\243\361\232u4\231\346\034\375\245\031G\3335\337h0\3156Xg\005\220\3165X\347\004Xg\004\220\3164X\347\031\254\363\001\254\263\001\254s\001\254\263\f\326\231"
+	.string	"\244\363"
+	.ascii	"I\347(\326\031\212u\216\321:\303X\235_$\235\005`\235\003`\235"
+	.ascii	"]\260\316-\220\316,\222\316O\254\363\n\326\331\t\351\254\202"
+	.ascii	"uN\201tF\301:\237`\235\233H\347&\326\231\311:3\261\316K\326y"
+	.ascii	"iu6qt.\261\343\254\264\343Lb\3079\251u\036\301:#\035\235E\254"
+	.ascii	"\316GIg%\353l\304:\2078:\027\261\316 \220\316\037Vg\017Gg\242"
+	.ascii	"\326\271\003\353<\264:\013%\2359\260\316A\254\363\006\326YC\003"
+	.ascii	"6\007`N6"
+	.string	"N>\212\353\3250@!!B\b_=\276\313\t\211\337\241f1\001\037\321\354\307\366\3343q\276i\237\313Mk\301g\317\375\222\031\376[\257\345\204\343D\334b\007\376\352\201\366\255\222\336\325\200\375;\303}Zc\2047:\035\224$\306EE<:#D(\371\265\360h\331<x\350!\361x%\337q\320\244G\217\364#\344$\272h\335\202\013\036\307m\002%\203\353\345\024\303\b\021\217t(\342;\220\215\233\341\321C\001\331\242\210hS\310\005-NoN\360\310\250\253~-\f\261\354\035;\364\224;\276\253\276\343\234\t\032\275r\215\032\227\013\252\254\317\007\335&/\312\23428\f/(A|\210/\243\242\017\361^w\306\365R\364=h\346\026\b\b\342;\257\223\240zlF}|\\\316\366\314t\022/\304\036{4+-/\313\254L\333\207D\277s\247|\370\343\232\0316.\"\344\341vukf\212 <\274\307"
+	.ascii	"\027H\364\036\376X\007\300G\211\024\235\316\365B\364\353\232"
+	.ascii	"\335\364\003S\314\003BqY\314\244S\017M0pep\304\346\300\210\206"
+	.ascii	"\250~-\024Z\266\016\035\035t<\325w\234\2628\031.\364C\337\341"
+	.ascii	"\231\235t\234u\264\336\246\234S\367\342\242u\230?ws\233\304h"
+	.ascii	"s\275\234V\350\200\343\207\270\b=\024\314b\224\241*\227M\213"
+	.ascii	"\nT\326T\351\226\353f\022\227(\364Q\3769\013J\362k\341\206e\347"
+	.ascii	"\310\361n\270\224w\226\307!\307'\371\216#\246\030\303\203\236"
+	.ascii	"C\226\273\245\314Ba\b\007\367\003_s\271b\020\006\272\232\333"
+	.ascii	"\204\005\241\023\317\342z1\313\3228|?\237(\271\206\337\360\025"
+	.ascii	"\204\3437\210\340WX\332\242i\370\276\353$/\305\017\372(Cq\301"
+	.ascii	"\032L\017/{\240\203\t[\304\340\370X\037]8S\345u\222ygy\033>\312"
+	.ascii	"V\330\243\315\230\345\035#\201\235\254\213\330^\257\334dy\337"
+	.ascii	"\327\204Saf\303\366}\253Z\214\375\371f1\311\362\216\275&T\214"
+	.ascii	"ayc\230Oq\247\374\374Q-q\321M\003#\334\037\216\367\3716#\266"
+	.ascii	"\267\325\b\324\305\320\247\347\223t\301\322c\344q<\227[5\216"
+	.ascii	"\3771\373\371\250\317[a\317\352\236\227\200\212\207\365\374\252"
+	.ascii	"f\270\350F\202\2031\t\215\374\243y\323\363D\0049"
+	.string	"\305\347\223\303\020\332\264\360|\224{\n\223S\277\236!\227}\343\271\230}\343\335\255\241\260<\247\3540\365\215\237\372\376\223\262\247%v\345Sn\362n7\312\022\371\235O>\217\t\256\231\372F\371*f\367\232\362ag\032\357r\321\236\312\336\367m\341\236\020R\215D*\211\017U\307\005,\025\022)\f\214lpc\203\037\027\004\301\300H\220#\007"
+	.string	"\221*\022\304\001\r!?\250\246n\0209\022d\001 <\034\b\211"
+	.string	"\t\022\037E4\230\262 \002\"G\202P\001\001\nb\201\324\004SGr"
+	.string	"\221*\222\344\037MTR\027HE"
+	.string	"D\252H\223J\b\005R\026L\320\274@\312\007\221\346\217#H\232ME<U$\310\221&\325\324\324\221\346\316\333\333QV\177U\207\205\023K\221`\024\256\350\260o\240\001/j\324\212\231\372\244\300X\207}\210D\255\276\032\257\300{"
+	.string	"\324:\\\361\321\247\3235\376\207\013\013*\t5\276\347J\017N\245\302\322\037B\261O|\3060F\r\ncP\323)#\002\237\300\037\007\265\326h<\002\257\206\t\243\206\321\370\236/=\266\031`C<N\215\342r\031A9\340p\206\nU\275\016x\036yN\0068\221SAhR\300X\322"
+	.string	"u\211\272U\300\277\024L\306\367\234\232E\247b\251W\004\234ae4\326!\340\377\313n\321mI\354/\004\025S\330\001^\202\272g\034"
+	.ascii	"\005\273\024\201\315<;\321c\317j\023\350\031`\340\035K\267\212"
+	.ascii	"\202\201\357\261o3[\024\241>Jq\210\034\227\253)\375D'_R\234\250"
+	.ascii	"\030-\324!\234\030\377c\300\334\254^<K{\314\007\013\206V\233"
+	.ascii	")\036\274/t\321V\2249\357\236\215\233\306\364\2040^\315\213\377"
+	.ascii	"\257\270\305(\177\342\243\354L\313\356\300n\347 \0326-\033\350"
+	.ascii	"\271\270\233\314\376\372\365\254\305\262{\364h\352\361\375\365"
+	.ascii	"\rM\023\f\340\005x\301\314\247q\271\232\312\234e\036\215\223"
+	.ascii	"O\351\317\b\320\342]\004\220\367\200,\375s\361\310>\276\026\337"
+	.ascii	"\177\215\204\327\310\306l\361V\342\232\305\236\036\213_\253\303"
+	.ascii	"\364QF\216\260\324]\277\236\271X\366\002\376.\360\335\365\r\305"
+	.ascii	"\262f\305?e}\231!>z\217\347r9\355\375\235\223O\351\311<\245x"
+	.ascii	"\247\025*\336\351\373\215\337\327\215Q\361m7\307\322\366\345"
+	.ascii	"R|\3675\022\236\234E\267^\372(\267\213v\n\262(\234\200\337\202"
+	.ascii	"S0\f\212_\327\022\027\335\254N\300\ri\237\205\377\342r9\321\f"
+	.ascii	"\361~\016a\231\337<\361M\337|\346\013\337\346Ni\372\027l\334"
+	.ascii	"\272\260\264\345\302\374\035qL\304p\246-Cx\b\007_\213\313\225"
+	.ascii	"T\246\202\222/\375\222\251\304/\177\215\245\255\332\322?\324"
+	.ascii	"\220\r\n\313\t\202\317'BN\260<K4\351\370\2637S\341\004i\341\341"
+	.ascii	"\235\034%\023\357j\340\002K\274\211g\023\267\032\371\355}_\022"
+	.ascii	"%\326\274\t%~]s\023}+\256W\017\226UQ\"a\214\n\217\227\022\246"
+	.ascii	"\364;\326\260}\223\202\261\250\362 )\323Q\310\024\032\021\021"
+	.ascii	"\221$I\322\0302\f\020\206\3418J\255\274\003\022\240\3430\312"
+	.ascii	"\203\022\"%\325H\322d\330\r\351\313\250\310Pe\275=\361\217\303"
+	.ascii	"[M\235\351\274N\321+\005\254\315L\013\231R\377:U\001\301J\255"
+	.ascii	"\\\322N\037'\377C1p\024Z?M\002\003\230\2010\370T\367\2670\330"
+	.ascii	"\346F\240\315p\032J\255\246o\220;\006-\300\020\366t't\326"
+	.string	"XSQ\323\021\207\270\317w\266|\221;$\311\017\300\254\225\243\230\320\200\347\004\253h\355%b\321\202\342\236~~\270\340\330x\013d\215>i\003v\232de\210\021}\250E\231\025\243\322\r7\021\355\210\f\033\234&\330\265\241\221\300\037\230\032E\026\230\252\262\213\022\234WS\300\234\227#\255v\245\323H:\3729\242\224j\351\263ALH\f\025S\306\241O(A\263\241\311,\335\350\020\026g\242\262\212\223\240i{\336\377\345z\261\364\342\255\334\013\016\003\320j\017\230\204\366\330\332\022>\355+\365\301\236[\311\251\305F\004\370R\2708\274\037\232\314\353\020{M\301I\375J1\004\f\013\321\216\365\337\311nC\026\263`\204\002x\334\267\205\253\"\340M\207H\2430y\203M\263\246\304\270\342\234:\024\361\246\236'\312BM\026u\335\363w\251i\217xy\3743E\037^\276\225\375\231\370@B\225Q\372pln|~\032"
+	.string	"\312e\371\305v\262\346MD\350\222j5\373\177\262e\3459\2337-m\366\360\005s*\316\353\372\340\222\347\244\203"
+	.string	"\002'\312\337n\314h\347\335\253R(e\265\036T\345\343(5<\262\250\035\244.\342Z,\367kR\236\216\345\355\236l:\343\237R\276N\216d\273\226\275\007\350\231\361R+V\230\301\033D\276\277\017\364\220\261\303\371\261n\243\\D\300\301\fF\201\037\264\361\004,\217\216\361x/\365\234IS\027\301/\350\201\263\250\314\311M\242Z\302\220\177\340D\324\034\327)\226\224\343V7'C\224\027$+\203<\210S\201\f\n0_\360\226\307\311\251\307\236\215\027\270o\264S\251\340\033\332EHM\220\247\212\336g&\023`\256;^+\020\233\247\252\340\213\216\034\367\022\202e\330#\303#\377\240q\270\304C\343\024z\210H\"\242\265\017\220,\231\370\005\340\310k\036\3759;\005c\310\267\323\365*\005\b\004\036=\306\327\220"
+	.string	"\3772>\250#f\263m\254\300\274\220_\211iP\336\331m)\344\013\371j3\377\372w\362\227\243\204\352\0277#\324\030T3\220Ng\217H\032\245\225\324\371\016\204\255\316<\354 wv\302s\225\305\202@El\2259\022\202\224aS\252\031\235J\235\211d\372\231\322H\302\\\243"
+	.string	"y0P\\GQ\3660\226\276\214\bK!k*\016$E_,"
+	.ascii	"\016\305\t\357[{x\001\370\336W"
+	.string	"Hn\365\021b\\o3j\214\017f\252\"\226\202<\221\030\315\321-r\306\364\335\265:\316 \307\251\030\206\377\271S@\023\264\347\027x\200\035\261\261\205\3263\236Y\335\341\261\304\026\220G\373\202\223E\272\350\223a\205s_\007n\201\360\224tH~X\021\246\216r\243\2275\244\2561\004c\2110\377&\031pU\312\325#\332:\022/_\251\315\310\211%\016$\316'\251\374\220\365Q\303`\211/\312\322\361\315\304\245\rc\367d3$\264\205-\206\354\2565\330\3178WA\342\2132\254Z\237|\303\340j{\224\n\230q\033\024\005\036\f\300\321&K\260\230\031d\347h\177\210\221\n\202!\322)A\273\214\"\345Y\254;[\031E(\262{\213\022t\321\202\220\007\225\363M\303\007\252\256\360\343\306\275\367\003\347\357\350\316\224\236;\212l\360p\tQ\357(Cl\231\275\347\013\266G\373,\222R6\234f!\264\277Q\375\t"
+	.ascii	"_r\314L(\036k\325\312\r\331Lwk\333\034X\f1\210\356[\363\376\363"
+	.ascii	"\201\363}\206\261z\214\253\371[\rL\355\205f\267\007\016?\370"
+	.ascii	"\240\003\315\341\225]\314\246\024\310\322\337\305\307\215\246"
+	.ascii	"\t\335\264\335\232)\b\247\023\235\350h\213\312k\224\333\377\214"
+	.ascii	"y\334{%\251\360\020\001Ub9%L\311\002\251\013\247M\234\032\342"
+	.ascii	"\327y\017\343\206<\250\355\020\003:\374w\363Z\250\332\fD\214"
+	.ascii	"\246\316\rN\326|{t\305\005N\274#\214\210EMf\017z\245\326\037"
+	.ascii	"\301\200\rq\270$\030\373\336\223\252\277\202\355\036\312\017"
+	.ascii	"\"\237\205t\207\241xS\213x4UA\207s\377\002M\201\203\336\\"
+	.ascii	"%\321\200\257ea'S(9\330\261\330\363\030V\207"
+	.text
+	.section	.gnu.lto_pidInit.33.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"m\t"
+	.string	"v\222B80\221\322\001 r\303`\363Fi\017\206\320\304<\217Tk\273\024X\362\006G\373Q\313\260&\275\261\276\327\333\337\372$\025<\fnU\020\217|\f#\017\375W\3737\3312\245/"
+	.string	"1"
+	.string	"1"
+	.string	"7\330\\v^\260\271\364g\317<\004\331\263\214h\254\320v\227\213\037\377\256\237\377\223\003\2000\327\225\323\260\273V\020\326q\307\333N\260\035\262\257\001\321\303\376\266\273\353\030\263/\3737U\2373\300!\303\340\262\273Q\253\331\231\204\021\371\330\276\332/\271\311w\331\305\tvc-/\273\341\202\025:\227\016\003\266i\n\320\314<\372h\243:=h\204\214\350\262Mq\225UgwC>\312S*\374\220K[\264\364\340\245\337\332\\>B\304\220\310^Z\263C\227\006\244\323,u\336\303h\252<\026\201X35#FS\305\261&L\363T\342RS\002\305\211\274\025\007:p\247\"y\034\253\353<\356\023\356\267\2151;\300f\257\210!\242\005\350\026\003\r"
+	.ascii	"2\241\rh`\\0\220\017\f\003\027m\232\023h\332\0300\345\022l\263"
+	.ascii	"\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.34.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`m\001M\016"
+	.string	"\346Z`D"
+	.string	"\261&\035\277\330\342\\\321D7\203~-Y\324\224\017\016\314\031\276\251\255g\333\337U\341\033\017\265h\221\035\035\302\310\366e"
+	.string	"\313Ae\204\350\273\002j\262\321\206\3513`\227\257Jk\221\247uI\334\233l\231RH"
+	.string	"J"
+	.string	"M"
+	.string	"\330c\310\005\310G}"
+	.string	"\371h\317\226\361\017\304\236\246\246\345\004\316\356f\360\203\247\336\343\005\325\363=>\035\325\352\364\210m\370\225R8s\305\260\262p\025\330\335\267\256\027V(U\217\317\356ZU+\r\267\274m\3156\211\375\227>\234s\3020t\261\037\363c\227\371\345\277\377R\265~\230>\234\032\fnv3\314\034\353\"\262x\261}\3733\266\347\036[F\304\b\202\004\336\277\322C\026e\243Z\200=Z\325~\211\303x\21719\356vh\261b\367;`\003\001P\241\265e\207\347\2349WIJx\033\377\234\363\006\264Ibp"
+	.string	"\313D+FJs,\241\315\275FE\307\346\206\304\005m\nOQ\002\360bw\025\370(N3\362C<\232\264\242W=\372+\362\221\2045\202\005\303\201E\247\375\235\024zpZ\250\344\340c\264UhpB\212\240\231t@ \256#\215\210\264\016e\003\201\270D\244\333T\266\007&[(\353$\234l(\240Le\203\220\222\225\210F\231\b\001s!M\224u\034'\312<\337\036\272\\:>\0344X jF\364\250B{B\212^\345\267\376I\301\223\261\034"
+	.string	"\202\316\2113\003\356\231\301\340\345\314/L\024\347l0"
+	.ascii	"l\021\252j\250\273`\345\207],c\031\030\267)I\210*\001\200k\216"
+	.ascii	"\033\256\003E\30080\230OB\013\324h\341.\201\001\2030\344\236"
+	.ascii	"u\370X)\003"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.35.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`8\001\205\r"
+	.string	"\306\232]C\020\221\223\016;5>|}\032J\020\f\322\212\355\352\235\310"
+	.string	"\024h\033\177c9\321\213M\261B\213\277\341o\237\221\332\377Du\031\256\037\b"
+	.string	""
+	.string	"P\"\254\\"
+	.string	"X\220\210\340\332u\246Ro\322\310&R\246\024G"
+	.string	"I"
+	.string	"H"
+	.string	"\207"
+	.ascii	">\300:\314\013\260\016\335\3314\377`\366)\232\226\0224v7\323"
+	.ascii	"\016]v\207\225f\347o:\034\217$:\274.\274\032\245\242\236\023"
+	.ascii	"H"
+	.string	"\022\252\216\335}\314\323\205\304\222\271\351\354\256\323#Y\270\255\333\366\330N`\337\013\246\037\376tk\246S\323\347\004\300\300BA\334\245\020m\354\f\224\001\361\323\355\177>\312\230?\342$\272\237\254\342\022U\270P\244j\304\330]\217C#\270\016;\252c\2663\355\207\270\210\356&\025\303]\016+R\354~\0376p\005\235\221\212\f5\325\331r\3031\306\232\352\304\272^\206\267\2378\271v\367\200\237\272\211\220\377\341\320()y\357\320O\321\017\017\246\225\214\177\214q\206j\311*\026T\002\033Z\234^\214\262\306\376D\251%\373\032cta}\261\037!-BH\365\371l\034\312\002\220\207\033\321>\034\026\001\341\264\022\215A\003\315$\343\0368\320F>Y\211\026B\222\211\200B\031H\001o&\036P\306m\033(\303\276\275\276\\2\031fV\224\005\006\324\222\217:\007&jP\217\253\272\330X\246\332\020H\362\236\037\363\026"
+	.ascii	"2\003\3769\203\013`5\030X\231\002\201\224'J\001\024\371H\306"
+	.ascii	"\370P{\204a\254r\031\250\213#.\034\334U\325\030\261\022-\334"
+	.ascii	"%0`\020\206\334\263\016\037+e"
+	.text
+	.section	.gnu.lto_pidInitConfig.36.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`\213)\345\223"
+	.string	"*\353 3K \224\312I\007\333\227W\034\364\t\2379\341\276k\334\232>\230\312\217_fr{V\232\331\201V\340\261f\236b\335\236\365\221\275\217k\201']\326\270w<\2529\270x\223:\376#\300\305\341Wa\207\305\226YIo-!;I)\003\357\002\013\0036\003\013U{\227\240\2751\324^\030\320\336\027j\257\013h\357S\355m\001\355U\202\366\262P{\223\324^$h\357\021\264\327\310\257\267\b\332\273B\355%R{U\250\275)\324^\024\320\336!h\357\tg\257\tgo\t\265W\b\260\227\204\332;\002\332+\002\332\033\344\354\r\241\366\202\200\366~\360\353\365"
+	.string	"\355\355\340\327\013\004\355\345\340\327\273\001\332\253\301\2577\003\264\027\203_\257\023\332{A\355\265\340\354\255\340\354\245\240\366Np\366Jp\366\376\370\365Fp\366Bp\366>\360\353\365\361\353u"
+	.string	"\355m"
+	.string	"\355e"
+	.string	"\355]\340\354U\240\366\366@{y\240\275\t\234\275\b\234\275\007\374z\r@{w\240\275Mh\257\216\2637\307\331\213\343\327{\003\355-"
+	.string	"\355%\340\354\035"
+	.string	"\355\025"
+	.ascii	"\355\r\340"
+	.string	"\354\265q\366\002P{k\324^\032h\357\214\332+\003\355\215\201\366\3028{\231j\357\013\264\327\005\332\273t\366*\325\336$\264\267\005\332\313\242\366\"\241\275+\320^\025go\212_/\n\264\367\b\355\025\236\275'j\257\021\332k\002\355\r\236\275%jo\021\332\013D{\177g/Z{O\264\267\242\275?{\273\366r\027\227\352\376d\360&M\2454\023\245~\316;f\030\017s\035f:\314s\230\3410\273an\303\277]\336\345;\313n\033\334\003x\f\031\217\02405\373\315\221\343\201.M\325P\260\223\314J.+7Hg\225\234r\245\375\307LV\031\023\344,\267\315Y\345\025!2@\342l\220\3179c\336\270\311\001X\245\305\"\253,\351\003\310j\313kA0\233!\267\331%\260J\013\370&\216\027]\232\2467\370\\\005\200|\312\2505\270\273\334\273\f\004\253\0312r\212Q\244i\230\020u\322T-\307\342"
+	.ascii	"\362\271j\214\204\362\td\025(\237\273\303\3359V#K9"
+	.string	"\216\224+6\2754M\233>&\343h\317U\215\227F\035\362\f\0311`0\275p\261\244\224\324\202\005\322\n\025)P\034\tO\030\231\b\226(\002\322@\353\357=\\\246AH\211\265U\3053\352Q\234\272\303\316\017-\003\016\307\200\301\"\031\345\020\030\327\032f:\323R\323/\220n@\264\013;|\222\311:\004\306\005\207\227\224\300\270|\340\244c\232n\301\"\211\024\224\323\303\212\337\017'1k\016\201q\231a\025c\030LK\f\212\024f)fg\200i\221y\2122a\032E=*\253;\342t\351#0\\d,\374\375\210\303\247\2301\207\300\270\310\370\204\027\033yqi\023[8\270EK\227\230\001\306\225\205\213\252\214,3\316\264\2604\260\036\031\241u\245\356X36\r\006\303%\207\321\312Vr\370Wb\313\n\377\304V\261\312H\323\224\327pgm\021\273\177?\3224\335\306\332\342\342\255\301\273\315\265\273+\354\n"
+	.string	"%o\375\003\343x\216\277\2203\236\3358\0162\035\204\323\215\363X\003T\200\231^\263Jd}\373B\210\215\232\035\001/`\200\023p%\271\0054\300\031M\333\033\243\231"
+	.string	"=\264\017\253<\312\005:\203E\255\003\270"
+	.string	"6\036\300\225\370\214t"
+	.string	"\234\315\330\370\tg4\253q"
+	.string	"\3164Z\215\013\213}\2304\320\372\3140\355\254\336\035\333\214\306\215\302\372\034g\374\320e\310\324%V\235\214\317x\2053\322\265\030)v\023\027f\310\003de=\342d\334"
+	.ascii	"7>\314\030jz\f\f\034\214\307`:\214\377\336^\234\311\203\376\""
+	.ascii	"\345\003l\210\016/8^\\X\344st\361\335\341\232\356\262Ja{}\331"
+	.ascii	"\026\350\314\327\336\322](}\351\277d\322\225Z\213\224\002d::"
+	.ascii	"\313\220\034\215E\200\244\033\001z+\321\342V\252tQ\341\257\312"
+	.ascii	"\342-~\336\031\317\210@zk\2259\032Jk\265\224\216\322\274K\224"
+	.ascii	"O\026\017\206\025qD\026]L\bF\222\240\263\220l\254\345a\002/\266"
+	.ascii	"\274\3069\302\240M\374\326_\rg0\317\312Q\246\315\240b\3571\363"
+	.ascii	"\233\315&\037\r\034\314`\336\304\263[\234<\243\327\212\357R\320"
+	.ascii	"Oz\207\276j\243\326\226\261\2578\025_\221\342*P<\205\005Mtb7"
+	.ascii	"\262\266\032\302I\262\256\212Cq\036\305\345\361\350\273\031p"
+	.ascii	"\263\217"
+	.string	"/\021V\036\261B\302\037\235\270\320\350'6`\246^\236\021\323\304w\201\360\235]\022u{]\324\022\005o\242\304\203E/\341\001\033\232\223+:\002vnG$\360\273 0\241U\342\030\024\304\006Y\232\246#\260 !|\306\301a\325)\231x\005\315O\004\315\246\336\357\300\263\361\f\375\357?6#\335y\364|\325\267&0\234\024+\343v\247\316\030\320\020n\213K\323\342\002)\360\021D\370d7d\347y\215\353\031;\345\273\331l\366\241\365\177\374\234K\254\272\177\225\fgO\024\323\324\252F=\033\367\020\273\271\375\037}3\322\361\373\274\206\317\2768H\\\365\325\213m\377\006\363\032\003\231S\346\352\r\256\341Y\313\277\213)w\267k\354\026\341\"V\211\024\227\246i\217\345=L\304\221M\242\244\031K\t\312g0,\231FO-M\323_l\245P\276\2216\202\212\275\267\273O\254G\n\230\246\305\036\313y\246\252\274"
+	.ascii	"\034\303\347\362\024\312'\377D\323\306DZusW\255\252/\326l6\233"
+	.ascii	"\373\260\335&\366%b:\274\214\210\347\360\362\036\223\361\360"
+	.ascii	"2\036\273\341e6\214df4\\\207\227\311\030\016/\2171\030`/\213"
+	.ascii	"\205}\001\363\362U\324\313]\274\270l\321\222\005\313\025+U\272"
+	.ascii	"\250L\341\332\322\222\022\005\n\017YXOv\2702\242\275\354\344"
+	.ascii	"\354\345\"\321\n\330\313U\265\227S\264w\210\366R\235\275S\265"
+	.ascii	"W\207\332\233\003\260\027\207\332+U{o\370\365\332\300mxk\250"
+	.ascii	"\2754\374z\243\320\336\031\320\336&h\257\fh/\023\264\003\367"
+	.ascii	"\2614\342\355}\2063\242\337\2003z\001y\335*\277v(H\363\321\t"
+	.ascii	"\3519C3\234\225\\\017u\3519\"\215Y\332|59\357\235\371d8\2237"
+	.ascii	"\271\022\033\b/\264J.\024gvBA\030.\356\203\204p\0362A2\234\013"
+	.ascii	"\tbrn\343\272\267\307\220\261N\bu<\022\201\222K\016\365\277\375"
+	.ascii	"p@K\036d[2cPs#\376\310\301\360\030~\2765\357\003\303\215\234"
+	.ascii	",\217/\004\361\267\"\316\346\302_\370\333|\217\013\017\242\271"
+	.ascii	"1\237\330.\304*\365\360a\325\265\360\247?i\244{\363e\013\017"
+	.ascii	"\212\271\035\221J\342\034\317*\357\354\261p%O\342Kr\026^\227"
+	.ascii	"s\256\224Jr#4:H\222O\016\323\336\246\274\034$7\352J2\221G\354"
+	.ascii	"\034\316*\205o\346\214\374\310]\260\025\271\221\237ox\276\346"
+	.ascii	"T\344B\266\344q\205\345\331<\b\"_\341\365\316H\247\347k\210\334"
+	.ascii	"H\254\215\251\302\020W3L;\020D\334\007\025\036\\\272a\246\360"
+	.ascii	"\3664i|}\216\226\302\203hn\216H\024\376\374\3140\355\354\r\253"
+	.ascii	"\316\352\210\233\241\360\242;6\346\211!/\263J\244\223I\022\237"
+	.ascii	"h\3613\350\204\0171\341'\374E\322Hw\303\225\022n\302\225\356"
+	.ascii	"\214^\304\022\316t\312\346U\237\3210\r\025\362\2441DTp\037;\030"
+	.ascii	"\267>==!H<l\230\366/lXu\202\356EJ\310\203"
+	.ascii	"kyG\022\b\275\013\324\275\316L\350\b'\341|\345F\244\222\273\026"
+	.ascii	"\251\021\036\f\303c\"E\370\376\312\261\254ry\314R\031Z:\315X"
+	.ascii	"K\007\345\263\337\202\\\204\020\036\344(\233\221\016\204\207"
+	.ascii	"p\350]R \374gw\367A\022\237\302\345\301?\370\337\356\256\345"
+	.ascii	"\301\213\354\354\230\035\344=\n\024 \357\340\277c>\013\310\203"
+	.ascii	"avG\016\020\375\311\016\033\234\203W>*\276\0337\270\021\032C"
+	.ascii	"L\r\276K\325|\361\304\f\256\301+\\\325\2532\270Q\321\320\021"
+	.ascii	"\003b7\373\234\216\301\353\233\221\316I'rz\320n\216\211\274\340"
+	.ascii	"\252\367\230\026\374\202\327\245\221\356I\347Y\360 \240\271c"
+	.ascii	"\005Y}7\204bwR\360\n\276\224\234\340\024H\351CR\023\\\030&\307"
+	.ascii	"\224`\253\r\3155\022\374\343\022\374\367\026\301\177L\351BN\021"
+	.ascii	"<\350&wDB\320\325\203\206V\204\202j\362\027\367\300!\370oi<\363"
+	.ascii	"\361\007\260t '\037\017\272\025r@K\003\032r9B\256K\377qr \007"
+	.ascii	"\225BG\023\r\274\317*\221\370\260a\3251\320\300O>\343\036\"\233"
+	.ascii	"3p\346\323\226g4#.pf\363\226S\340\013\\\t\316H\327\343\n\234"
+	.ascii	"\337\360\351\326f\350\252/x\004K\241=n\244\315[\261\367\274\264"
+	.ascii	"\020R=~\242\ttD\356\016\277\364r\225B\267\24258==\036\277c\247"
+	.ascii	"\016\\\002o:\017\004\236\300\225\226\007\034\201'\301\031\360"
+	.ascii	"\003\304\232\216\223\0017*\302\035\2218\272m\225Ls\206eB9;\336"
+	.ascii	"pV\tA\334\356p\254\337\f\313\022p\243\304\206U\327t\035\337q"
+	.ascii	"\246\267\241\230^[%\260M\3239O\0202\307u\234)K\236\200 \251F"
+	.ascii	"\210\364\022\250\247\250#I\2324\201\242\340)\030\265\344\t\352"
+	.ascii	"\003&4 Y\362$$\206&I\242\236\216fx\272\241HM\002\303\023\013"
+	.ascii	"PM>@\362\304\244\304\036\321\021\365\264\344\211\b\222'&MQ-("
+	.ascii	"y\202\201\205\246%OEbh:\322d\206&\035L\013\305$I\223\246((\250"
+	.ascii	"&MA\265\2249}\330\tI\370\261:qY\214\210\263\n\352L\357\302\316"
+	.ascii	"bo\265/\354A0\315h\376L\035\321\214\265\275\207\b\376\002W\021"
+	.ascii	"\255\262\356\201\361\0273\242\235\2273\330\225\356\276\316^~"
+	.ascii	"&\215tHT\274\257\013\301\3449v\021T\355\246\b%\341u\356\"W\017"
+	.ascii	"y\335\bo\311\344b\250\032\232;\337\266\234\271h9o\371\3222\313"
+	.ascii	"Y\313\241J(\313\215\360\334\260$Q\005\255\262\306\345\351\003"
+	.ascii	"\367U\347\312\031\313c\274\031\317\210V\256\234\021\357*\334"
+	.ascii	"*\201\200\254\234\347\004u\275\n\225s\327\223\344\246\234\251"
+	.ascii	"\344U#\246\234G\025:G$\327w\247\230\325O\3553f\004\241\224Oq"
+	.ascii	"\353\314\245u\336zRRk\nQ-B\312\215*I&r\306\30568(\0063\377AK"
+	.ascii	"7\230\311\310\252\f\2623\363@\304\365i\253\030C\b\241\007L[\032"
+	.ascii	"\275\376JS+\030\027\213\362\345*m\360U\267aY\213\212\007J\224"
+	.ascii	"\243I\343\036(<\234\263\316w\342\362\256\372\374\244i\312t1\254"
+	.ascii	"\263\021m\370\024{\257\332\221\362AVg\b\217\252$\242#\016\353"
+	.ascii	">\312\230_0\336_\240I+S\223RM\273S\315\332FU\205wvc\033xn\216"
+	.ascii	"w\236\246i\225\213'\304*g\225\302\032g\207'f\304t\207/%\273y"
+	.ascii	"`6^Q=\271:/\367l\371q\362\252ecVe[\345\032;9\033\235<\351\316"
+	.ascii	"HG<\027\241\324 \2107r\322\264\222R\327\f\323\204[\025\b"
+	.string	"\253\007\357\370\230H\253\252)\325\007\250z\374\026\346\364\\U\3238}p\3117\354\252h\253D\223\210\352\303\251S\375\204\323\341SVj\017:\\\350$\357\210\\2S&\310\206\247\224\003\226:f\230\206$FK-\313\341B'wIP(\0162t3U\027/T_\232\261p\270\t=x\374\024_\265Rb5l\230V\277\214U/R\017\302\331\335PV\273\f\323\252\227\230\272E\352\206\007\331\346\2166\220\251Y\206\\*\0263\325\212\223\r/\202\223cF\365P\273\206\\\204T\242\336\364`\325\265\340\032\246!mu\025Jc\307\342be,%J\2404\357c\023z\254 u\026\026 =+6\241gk\305\305v\251\316\324\253aZ\213j\\\366IcWSf\261\347\247\252\371\026)\314R\214\n\342\326\"3\023\312'\034\263\364\253V\355\271\2501K\323\224\200\317\001\323\264\212\275\266\261\322\2549f\351WJ"
+	.string	"\002_\305\356C;\037\r\377\241\3619\"S8\241Q7\222\366=\247(4\024\027[\2430B\356\373\007\235\270\301<6\266jUGc\347\276\273\355A\302\350\225\350z\253\304A\226\027\304\006\031\236\020\244\270\2736\3462eW\254\272\311\210\316\211\002\203/\250\322\020-\322\242\230)\222\221$\005I\206\315\022\f\020\004\342PT:\311|\022 \004)G\262\240B\214\251\021!\"I\262\034\303"
+	.ascii	"\262\242\301\035\243\317\231\365\253\274w\3026@5\205\341\034"
+	.ascii	"A\332B\260\235\001\207c\240\221m@\266\204`\357\203\005\001J<"
+	.ascii	"K6\224Z^\350f\231/\204\032\343\335\205:\276\352\227X\342\366"
+	.ascii	"\206\221\b\361)R\251T\346v\354\253\320\241\252\020\206\303Ml"
+	.ascii	"\3618\347\016\021\220\341\310/K :\332k\257N;\330\271t\303\261"
+	.ascii	"\024\026r+\322:@\td\350Sn\265\226\313\332\230\270\260g\222\016"
+	.ascii	"\260\370M\313\310\204\352\033\341\211\347\375d\342\263C\001\321"
+	.ascii	"\3056\272\204\r0\302\341\240\0025I\2538(\007L8T\207\353p*\311"
+	.ascii	"\001%9ID\231\233"
+	.string	"}\270\026\2226XEz\360\241\\\362\022D\276\345\375\253wf\022r\210\r\204\341\256u8\303E>M\376\244N\304\355\347\261\321\370\371a\330\234z\262\241\354\262\207-,\3673\254d\215\263\306\3137\305\306\335\256 5q\212\3539NC\302r\211\242\"|6\201B\"\177\025$,\006\t}\277GJL]\2749,s?'c0\271*\205\037'E\241K\031\350\3108\201$\356[)\367y\3279,+\022\253\222\3567\244D\264\002\3061\233 \360\025\344H\302\346bY<\336\340\215r5\262\244`X|\005Zv<\371\361\035\022\271\337\031/\250\355L=\251\376\357\270\224\344\323\036\333\207\264pe\3378\246 \031I:\033\367y\b\330\216\306p\037c\321\001\315g\356r\335\361\313\025\251\005\357\004P\0356\232=\321\261C\275\316\212<w.D+\005|\361\217+\375ACm\027\230\234BvPY\221\0021\265"
+	.string	"\227\222\026\300\024\013_\300\340\2277wQ\325P\264\213mg\254\315z\324\3748(-\344\350\215\201[\332\263\245\027>\271"
+	.ascii	"C\013\355\344Y&jYd\271\305h\260\261\341\304\215e\263\300!>'\026"
+	.ascii	"\313\214\023\3453\215M2\374X\367tg\250CD\337\367xDvt\034\244"
+	.ascii	"m2\236\bE\027\365\370\024\226\004t\r\216\343\212\314D\222\365"
+	.ascii	"\304\027\364\036\003z\001@\355\372\220\025\367\006\020?\264p"
+	.ascii	"\203\033\034\r\n\352\006\f\223F\203\202\272\001\303\244\321B"
+	.ascii	"\362G\332bL\025\331\213\3174\317\317@\215\037H\212\357\350\363"
+	.ascii	"m\327SBk\346\324S<\322\343\307\322:`\334\270\313,\356\313e59"
+	.ascii	" \023w]\341\237\276\263\215\331\322\026;\357X\241Q\fq\341\276"
+	.ascii	"yG\031\246\260}/\026=\017\217\220\005\260<\021\357\260\305(\362"
+	.ascii	"\346\023[\230\213\322\r\033\3274"
+	.string	"\021\242\002B\210\257\303\233"
+	.string	";>FfI\276\024\3463&\r\363`);\320Y\021 t7X\304hLu\267\237\005K\007\334\271\326\003\3326\377o\340,\270k\262\027\254\273\307Jl\f\016V\007\330\234\344\013\215\353;(S4%\210\f1\337\305+\214\020y\307\302+\2140@1c\344\032F\222o\341\305"
+	.string	"\275B\036\002\r|\373:`}\021r}6\002JVnA\003E\311\r!Y\213\310\251\222\322\302\024\213.\256\256~"
+	.string	"\266\275\245\004\320\377*\216\361\3050\356g{\2467)\223\200\217q\241\bq\236\004\344D\341\232\215z\327\370\277^\013\bZ\017&2\247\371\264#\004\244@7\345\232P\316\201~\374r]\020,\273`A@\345#PU\243*\005\250\300\314\026\030\222\222\002v~\364Y\n\320\370X\260\245r=TN+y\216\232|\254\304#\266\332\322\260\230\224\225\204G\224\240\035\353}\371\266\357\\\370-~\023h\202)\372q\177<+"
+	.ascii	"\307"
+	.string	"E\027\256\305\205P\214\2175\351\242\313{\300E\333\321hZ\205mz\302\316\rE-\377\031(L\225\241\217\277\266oSg\207\023\343\322\\\360\034a\373\223\327m\f\345\305k&\345+t(\364\032\301;j\006\256)\343%\030\b\271\200\005i\372\030\021\363\204ca\n\235\315&\022\246M\375\353\320d\236b\217\016u\257\003}>whel75\260gg\221\376\203\013\200&5Zna\314]\323\336\343\235\207\016\347J\307=1\273B\245\n\340#\t\312|Y\234\022\2168`\212\276\267n\363\321D\261\022VT\360(\r4\242\n\245W\270x\201\235\364\377\347\247\365\315\247\365S\303S\016'\331\214\204\361\277\301\240\247\365S\303S\016'\305\206Jj\221+X\360\274@P\003&\3352\230\372\363\224\377\262`e\371\376\342\t\024a\3707[l\250)D\300;at\311T4\242\251\304\270x\214\213X\261N\205\316\177"
+	.string	"LA\032\242\005+\013\243\324\201\200\252\311\211\242\334&\001p\321\216%\bx\230\324\025\361P\345\374\206\240\302\337_RD\370\322[[\024\025\326\025\337I\227qv68?w9g\227\017\347\334\2303\3168\260\311\031c\023"
+	.string	"\006\017\217\005O+>\303\243\023\216 \366\325f\201\330\257'\352\023"
+	.ascii	"\005V\2130\305\330\227\310\210Y3\f\335\252\261\020\337\245H\215"
+	.ascii	"\001\333\345\377yZ\254\216\016\227a\001\216A1\257\375\246-\300"
+	.ascii	"\004WY5\227\245\b\232o\3569'\236\026]\"v\260\222\361;O\361\342"
+	.ascii	"\247\255x\351S\200\003\311\252\030\231h\025\226M\216\b\313\364"
+	.ascii	"\257W\006\322\250\3253q\020t\"\321\3750XHR@\245$\355FU7\r[\334"
+	.ascii	"\";9\251\017\277\036\333\177\242\r"
+	.text
+	.section	.gnu.lto_pidCopyProfile.37.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`\030\001\355\f"
+	.string	"\246\327UA q\232\016\377aP\321uu\351!\006\301.A\203a\247)+3\033U\3564\026\267\037!kM7C\345\t\r\312\352i*\032\t\221\200\035p\305v\024A@\004\200\317"
+	.string	"K!!\373\275\311\2262\245B"
+	.string	"?"
+	.string	"C"
+	.string	"\377B\354Q\224\350\\h\354n\245 \316]\202\232\234?e0 \257s\251c\303!\004Y!\352\006\204<\274P\036J\252\207\227\002Av\367-\317\013\336's\312\354\256\023\344\251\334\361\266\027\330V`\337\n>\\\r\331\231\306\234\345\237\276\362\307LCM\253\246S\323\247\002\250\260\220\340b\027\303\350\306\212$\025\"l\237\262Y^\020d\332\006\016p_9\261\356v0\221b\367+`\002\035\227\314\3311\002\231\024\355xR\250ST\214:\273\034\236\034\031G\206Q\0138iT"
+	.string	"#l\344\356v\324\026\242\352\203\023/P\262\206S\257\252\320\245\343\360\357\223\246\306\031\371\223\030\365j\002CFG\342\223#\373\373\244~p\226\306\3710\321\\\233\004\032\022l$\323D.Ld\343\\\037\266B6l\2035\270\260\222j\213"
+	.string	"\001#\031\2516\230\203\t\225\245q\252\020\001\316J4Z\265e\231VQ\237\347p5d\006\032D\036\375H1\241)T\310\203\374\226\007\034"
+	.ascii	"\201\315\2163\2469\311F\205\266P\277\227\013=\004\265\330\213"
+	.ascii	"xp\013H\013\252\001\220z\"\356\203\t&3\0344\007s\r7\230\005X"
+	.ascii	"\2041\240\034\030\f\214\320g\214\340.\001\003V5\262f\310\355"
+	.ascii	"*z"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.part.0.61.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`\314\004%\035"
+	.string	"\346\264\263G\240\232M:\304\217\241\374\320t\"}\037\017\261\315\240\326g\264\3549]3\254\314\246\t\365\356\253\201\200:\217L\323\340\240\255\215\375\353\334\347\245\230zF\304c\241\007\355y\327.\307\3338\310\365\361\331\266\021B6\331;\245\231"
+	.string	"\233"
+	.string	"\233"
+	.ascii	"\257\260\327y\237\355O1\246os9\323i\277w\247\333\237b\270\356"
+	.ascii	"\362\256\240\354\372\030"
+	.string	"\274z\001\371z\363\034\361u\036G|\265o\304\266-\347\233\255u_\323^\252\211\222\0224\273\033{\245:L\037\372\356q\336N\216b\r\351t\335\374\321\302\324\0238})u\270\223\341\315\226\334\215\320\301\234\241;\232\343,\203\330\270X\001\252Z\351m\225\272\032\017e\274tHb\316\216)<<K]\022\245\377=\024\322\373\225:\033\237\003\356\032-\354\256o\204\343~\3356\021\333\037\354pH~\224K\001\362{\274z\246b\276|\365U\210\257A;\340\356\210\031\243\031\234\224\311\324E\227\202\301\240\032\323%\033\346\232~\211\323.r\232\034\247\307S\335\2428]\305\351\360\276\237\212\323\263N\037\007\207B\216]\032\3015\313\253R~\234\352O\362K\235\332\367\231|\211\3773\214\312\346\\\223;\271\375\211\247\350 \371V\027\2427u\004\315\356r _uB$\367\221\330|%\2372L**\312\007\017\371$~"
+	.string	"\301v\250\242i`qg\024\274>\200p;T\321o\366\210K9\201\f\007f\245#\265;x\230/\355\207iQ\340\245m\332\263@<\252iw%\2108\230\021\261\246W\254\221\276\254\2013'\r\251M\242\304|Y\251\216\f\2123\245!}\222\030\333\304\275\370\327e\322Z\245U\344W\0270\004\210\233lL\377\3355\n\265\370[&\220\347Y\256R\026 \313\333\035,~\026k\221\273\270\357~\004\342\325N\002[\352\270\"fww\254\370;\373V\244ow(\360\220f\033\333=\257RDR9}\332a\355zNtwq\2242]&\332>\257\222\345`\355n\204D\263\027=\241l\bF\210\027\321\354\305\005 \027'd(\\??B5\027<4Ym\305\354\007\200}\032\324f,f&P\314\206b\265\024@\263\025?1\026\263\236\240\230\017\215(\326"
+	.string	"\201\205\206d\264XMH\210\026\233\377\322\245\251\223?+\240\021=\")\223\003d\2110ZwL\005\027\351\f\333fp\221N'\250,\244\251\306\364\341\356\356\270\340\"\205\321_\365~I\273#\253\177\262Q\022\023L\222\272\350\213\332\267\336\355)\311LP\231\013\247\302\3429\031\f\021\306\274(u]\353[\031\374\036\326\260a\203\370J\322Z\265\225\346\006\360\004~\275\032c\250a@\246\214SD& \222\221$I\241\003p\002\231*+\036\021`EC7\022\345\236\001\201z\245.\212\205\226\302=Q\275\225\005\376\203\001\351\252*\221\223\342\324&\210\321\363$$\201\360\222\026Q"
+	.ascii	"\244\363R\303{\207\217\333\305iiQ@Ef%\345\330\013I\233z\307\006"
+	.ascii	"X\"\003\206|\f\372L6\0016\021\274\204\267o\352g4Tn\f\237\310"
+	.ascii	"\272\310\306w\277\026\373l\210$\315\2767\374\213\242l\206w\342"
+	.ascii	"\205\353}\r\322EH\b\277\260\274\234\326\234\001\203\377Z7\263"
+	.ascii	"1>\347\203\201C\277\003*7\361<\300\334\326g\360\341\340\364$"
+	.ascii	"\271\357\224N\316zi\346\353\301)FG!\262\037\003\306e\265\030"
+	.ascii	"\036\344\n\362\325\240\241g,\t\031;\243\003\025"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.part.0.62.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`\360\003U\031"
+	.string	"\226o\236F\300XM:PR\330^\202Qg\323\234\274\022\360rd1$\340\333`Z\305\031\223\020\\\241\330\361\245=\332\266\263\021h3\245c\327\344\017\301\260$S\030\215S\201\016C\356\023\240}\242(Yj\333\b!\233\310\235R\210"
+	.string	"\203"
+	.string	"\212"
+	.string	"3\344\270\265\232U\332?r\"\331\213fx\356\336\262@\331\035#|\032\002\370I\340\b\274O\371\003\336\247}#\266yj\226\331P\037\207\366HP@I\310\354n\353S}X\337\215\267'e\377\274\331\251\004e\376\215\316 \311\213h\233\375\353\b\354\256"
+	.ascii	"\033P7A\326\260\321\244g)\022\301\361\371\341\250\273\322;+E"
+	.ascii	"`D\333\215\253O\217\207\340\207\024 *\033\r\225\t\016~\032v\327"
+	.ascii	"\247\345\270S\267\315\303v\006\273\353\002L\336$\364\203|\272"
+	.ascii	"\205\216\274\370\351\353\350\225\356@LT\021\"\232\314Y\257\273"
+	.ascii	";\223*"
+	.string	"d\005\265G.\2273c\355a\257@i\325\224N}\322\240'\375=\351\366\246\364\234\322\335\307_\247\264\354\244o\240\246\301\216]\03394{\233KB\236\364\333\367\223~\344+y\205\304c\226\317\270\266\232\221\217t$O\"\273\022K\001g5p\tR\2310\273\373\340\323\027\300OVw\337\210\307^\255>\345G\236\027\005S^\203\213\352\024\310\251\237\332$J\310\213\366\267\354$p\022m\303\336d\342O\206v\327\302\211kAQa\3503\313\247\027q\024\220R;\265S\334\310\213SY4tf\325N\377\023\306\306\371\025\343\254H\235Li\276\364\001c\232f2\312\372\357.MU\310\246\342W\221Sn\226\342\002\245\031\262\267\265a\362\243\030\n\334\235=\350_\340-\255\254Y\321\307\031\033(~\220}\0348\256\r\206\233\217Lc;\347NV\200\273K\301\017;\241\214\233\316\345z\305bp\200\345\304\\\204."
+	.ascii	"\306\221\020\013_\204)T\2040Z1\026+B\027\256\326\213\360F\247"
+	.ascii	"\205\003\333iIX\340\027\214\034X+\366z\301Z+\333\362_\037\\\322"
+	.ascii	"\321D\323\236O\205<\177\200\017\036\340i\256\324\323\032\266"
+	.ascii	"\035\341\236J\242\243'\037i\306\372nw\327\203pOWz,E\270\237\240"
+	.ascii	"\036\334/\243\200&K\202\232R\225\332\0338\374<\275\276t8\316"
+	.ascii	"\311\303\235@xQ\251\246\316\345]B\370A,b\304\b\357\023\324\311"
+	.ascii	"\224+\223#P\250a<\245\214R\306L@#\"\022f\233t\220\002\0312\252"
+	.ascii	"\016\020XjfR\230\003*\004d9\341\2315-l\226\376'\301\363\374W"
+	.ascii	"$\027I\343oHUdd\222@@H\313\023`\373<\311g\354\364\345\206\035"
+	.ascii	"0\233(\206\2222#\312\252E\316\006\326\337\001\025@\241u\262\224"
+	.ascii	"\242!\241\"\030\tk\017\301\244ZAB\327G\374\331\351\327\300\327"
+	.ascii	"]\337\244\265\211\374\001\255\2523~=*\035\005'\346\261N!\n\207"
+	.ascii	"\207\036`X\027p\033\027\351\263\300}\241$\316\354Nk\1777,'\310"
+	.ascii	"0\354)\340d\026\270{\021\tw\227:\3601j\322"
+	.text
+	.section	.gnu.lto_pidCopyProfile.part.0.64.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`\036\002\375\020"
+	.string	"v\036mH\360\316(\035\323Exd\307e\273\250\005x\373\3004E\0370\252\343\340\025O_\220\033\020)\340\341~;\202\035\243\204\231\233\321Z=0\260V\357\323E\240\030\237_\237\177+MUW\342\322E\324\025`a3\331D\356\224\002Q"
+	.string	"]"
+	.string	"X"
+	.string	"%\023\3547\221\217\213R\263J\273d\212\375&b\335]\271\341\354\216\f>\275 \364i\377\3056\254\346\230\r\343\243m\177\363b2\343\263\273\340\247\272<v\225^\314?\356\031\264\224\221k\200\024\225\313\321="
+	.ascii	"\033\273\353\020\207{\336\266\311v\005[\212\001*-/\363?\343@"
+	.ascii	"\tf\027%(\306z\2309!\244\306h\333P\263\201\331\265ArR\342\331"
+	.ascii	"\364\260\200\361Y\r\243\002\333~\315M\274\354\322\223\022\331"
+	.ascii	"\207\022\315\312L\307gw\004?=\336\300\367\031:\201\317\327\025"
+	.ascii	"\260}\346\271\327Kx\300l\347%}\034\314\026\211d\306\361\307\201"
+	.ascii	"\312\3078\272\253\320\331\255\247\320\371\364:O\247\036\367\004"
+	.ascii	"\263\035\334\013\032\240\334s\\\336\215\215\226\341(@<\036\333"
+	.ascii	"\35668q\234\225\017\342\323\027Dy\232\370}\252>w\b\"H\354F\270"
+	.ascii	"\324t\270J\375\256'\310\004H&\203\244\266X\275{\253,\366\224"
+	.ascii	"\376Tz>\346\367\246\264\006\366 i\234X\342\bC\n\245z\220\372"
+	.ascii	"\b;V,\016T\310\321\022Q#\237H\255P\025J@\205!`\313\203B\370\321"
+	.ascii	"\001\252\302\t \340\211%\202$\004^\205\244X`k\265b\201\"\333"
+	.ascii	"\362\336*\213#\250\270\220)\211j\213m\001n\361\251~j\207\026"
+	.ascii	"\344i>\356!\236\025\273\237\335LG\374/ \200\002\0316\354\207"
+	.ascii	"O\020k\233\317\266F\354\336\222\fF\204\347V\226\357\3652\321"
+	.ascii	"\341\324\362g\337b\267A\363\314V\233\031\030\331O\2420\314\037"
+	.ascii	"\216\227\003\255\0358\261^\bd:\270e\3102\2044\265\314bf/\006"
+	.ascii	"[\273s\341\004\217\323\3146\306VH\327`JB\035\253Ix\233\267\331"
+	.ascii	"\002\330^\200\234\342\351\327\3421"
+	.text
+	.section	.gnu.lto_.symbol_nodes.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`\353\003\275\020"
+	.string	"6\231]C \315$\035`"
+	.string	"\f\354\002\243 \354M3\367\266\032\002,\257\315\2616\201Yd\201\271\021!;O\221\006\210'\020\004\240o\233\177\331I\222$\211i\020\321o\217\017\243\237\002\201\020\277&\217\302M\b\221$\311M"
+	.string	"N"
+	.string	"K"
+	.string	"\0046N\254\023&1a\221\022\0365\211V\025\315\017NpU\2456N\3049\354\364\254 a\215\"\301X#\254&\021\226\321z\333pt\316\251\"\204c(\f\004\023@\016X\252z\365\266q!TYu\004\367\252\273{\304\"JU+\024\001\032\325\276\270Q\355\273\320\356\025\263\335'\377\356\3362v%0K\004n\201\300.\017\030\304\001\207\314\260\202\006l\302\200_\026\260\3129\031N\341b\270\204\203a\022\367\302#wa\003-(\026\013\017XY\261\246\n\177\244p\001j\347\234)P8&\233\356o\233\032\231\275\255\211\3174\2242\204\336b\200\362\002\344xkA\376\035o+@\032I\003=b\306[\016\230\275\325\220\327\272;\364\026\203'\235xJ\004x{\021\217\371\234x\004<m\247\347\247\343\355#"
+	.string	"k/C\325^0zm\327\037nv\026\306~\303@K\341\325\003\355\314+\005-\225\023=\260\275\217\b\333\237\220\032V]\354Ok\261\327\221\277N\354J\262\004At\037m0\201\363\001f\362\333\367"
+	.ascii	"\277\375\016\3619\335M\367\233n\342\037V\250Q \211T\026\315\226"
+	.ascii	"\024\262\035\340\002\241\"\326\030\021\240$\021)F\002\021\221"
+	.ascii	"\200\222\024\366\225\221\313\177\326\372\351\270\221!o\213<\216"
+	.ascii	"o\231\022\034\220\351$K\300Gm\030\231\003\334\207\257\366\312"
+	.ascii	"\275\301\362\027P\365\3608\004\215\226\375\313\021\003\205B\357"
+	.ascii	"63$bFs\225\007\336U\023\225CK\223\350\031\202\347 |<|\r\271\265"
+	.ascii	":\356\217\275\036\377\250<Q\221m~6I\025\330\253\257.K\022\267"
+	.ascii	"\034 ZV\022\277\371\307\265lS\366\024\004\020VfA\320\301]\367"
+	.ascii	"VO\230\211\315U"
+	.text
+	.section	.gnu.lto_.refs.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`6\002\025\r"
+	.string	"\366\330O>"
+	.string	"\265\n\303\001i5#\225\t\256\374\207cEc\022\"l\201\207\332"
+	.string	"\335\203\001\304\005x"
+	.string	"\232]\372\206\\\372\377\377\377\377\377\177\316<\202\253"
+	.string	"6PJl\236T\262\201t7B\bI2\0051"
+	.string	"3"
+	.string	"E"
+	.ascii	"-)\333\362\\\237\326\246\265\2465i-I\024qX:\355\247M\273\362"
+	.ascii	"\242\246(o\311\222\311\324\2532]\257i}\335#\235<=K\317m\222\224"
+	.ascii	"\364 >S{R\326\036\033;\253:\250U\347)\316Zq\2362ke\2361kc\236"
+	.string	"\022\336\bS\030\225\205y6x\027\254/\250}y\272\254uy\032x\013L\003O\005\317\004O\004\353\201'\201'\3133\365\002\270\343\013`\376R;\024%nF\330\210\250\t\341\201\003\315\206\351f\336]\260\360d\t\222#GF++\221\242\025\021\321\320\220\220P\220J\025\004\b\b\310\317?x\004:\026\007\314g\236W`\222\304\250\310*H\325CG\216\033<4rd\304\200\361\302E\013\026+T\2448a\202\304\215M\r\210\017\035h4dx\016\303\023'M\224\b\230\036\031)Z\r\021\242\372\361\261\303\247\006O\316\214\225\302s\302\023\302\323\301\223Ah\2501\314\242\240)*\250G\241\003@#\332\350\020\3606\371Y\336TH\200\017\024\013\2148\001\347\2703\352t<!\245@TW\201\311\312'\251\007\306\032\241\326\305\327A,\357w\013\332\326\237\211\255\363a\202\235DM4|\034\263\272\320iG4n\255"
+	.ascii	"\346\tV\302\354x\212+\301\364R\357\035\377"
+	.text
+	.section	.gnu.lto_.decls.78f3fd24e22c6ab3,"e",@progbits
+	.string	"(\265/\375`B|\225\371\001\0323\317\264R\0200\244\3514\006\003J\226\324vm\222"
+	.string	"h\250\017<\026\245\207\316"
+	.string	"\001\257f\033uA\013\307n\224@\032\353\305<^\267\r\004\344d\214\330)\031x\007\257\\\343\246a\n\213s\360.:\204Y\307\0052\2210\312\022\207\237\361\020\261m\271\367\226[\312\024\350\ts\013\214\013QP\005\300\212\223\303\360\023\f\306\301V\333\316[\212a\225\275-\271\3341O\260\3440\032\033m8\211\257\350\020+{#\273w7\016\023\257\313\345v\201\"V\366Ff'\317v\201\006\002\253\255\354mI\346\272i\002\265\005\f\216\213\302*"
+	.ascii	"\0161\344\2271_3\321\256&x\301&L\271\367\276\031\365\233\333"
+	.ascii	"\224\272p#`Aq\271_8x\322v\311\3342#<\201*{[\232ar\230\031g\302"
+	.ascii	"\355\301*{[b;9\f\343\271Xh\312\336\310r\230Y\006+\331X\037\350"
+	.ascii	"i\303Br\030&\202\203D\001\341\340\207W\0163\315\334\270\r\364"
+	.ascii	"\240!O*^\222TwI\276\226}\213P\365\202\013\375\013Q\372Ct\364"
+	.ascii	"\207\312\350\017\251\351\017=\321\037:\242?\244\245?4C_\241:"
+	.ascii	"\032o\023\316|\303\276\027x1\234\340\354e\303\b\362\364\272p"
+	.ascii	"\276P\035\233\331v\223\246\233\331\305\315\344\202\203\230hW"
+	.ascii	"\252\214!]L7s\r\353\270rX\366\316\002\341N\234\262\267\345\336"
+	.ascii	"{\303\207\017B[[P\256\240\371Bb\364\205\264\350\013\241\351\013"
+	.ascii	"1\321\370\352\022\241j\270\r)d\f\347\013\201\351\207\260#\317"
+	.ascii	"\245\243r\341\202\240\206\266\024\235\236\343\336\310\377\346"
+	.ascii	"\025\323\212\211\305L3\253\334\244\2314\321n\3360q\334h\204\337"
+	.ascii	"\324\2214\265\364L\036I\323\2079F\302\213\253\b|\341Q&M'&\222"
+	.ascii	"\204\027W\021\220\272\243\334{\177\3201\205\007\234\237|\241"
+	.ascii	"-}!+\215\374M\036f\023s\312\317\035$Z\032\030\312d\217\312\013"
+	.ascii	"\316\377M33\212YfJ\271I\363\314\374\232\202\3627$\274\270R_\320"
+	.ascii	"\215Q\356\215<3\273\314\254\031U\314\310\235\231O.\234\211<\246"
+	.ascii	"W\276\312\230g&\331\2653\221l\032F\0252\312\017\037\256\0360"
+	.ascii	"\3123\276|!\027\372A{\372Aw\364\203\344h\364\346\217\233c\277"
+	.ascii	"\271e\3660\231\374\250Jph=\301y\211Q\212\007\353\210\023\234"
+	.ascii	"\037dF\3777\225\230\307\2334\305L$F\310\275\267\210\231]\346"
+	.ascii	"\021\022^\\\2515\244\356\224{#G\214`\212\231I.\334\225\323\332"
+	.ascii	"PqD\220\302\326\346\306ro\244\321\207\017\276$W[\0244?\310\213"
+	.ascii	"~\320\024]\3044\022v\271\2344\351\302\371AD\212\204\245Qy3\256"
+	.ascii	"\020\271\031\206w\242\001ys\303\331\004b\016\371\257\246O\322"
+	.ascii	"\230\310\r\271\220S.\210\016+8\203!S<'gvp~\020\016\035\304\374"
+	.ascii	"\n\352Q\266\337p~P\2246\275\336\245\006X\026\016\234O\347p\377"
+	.ascii	"\325\214\243-J\031\234\017\204G\233\\G7\177 \300H\2202\234M9"
+	.ascii	":#\353\364\201\306\350\233E\373\220\267\b\275D.\021j\356K\204"
+	.ascii	"\232X5\256X\255\331\303\371@P\364o\322\274\252\341\323$/\217"
+	.ascii	"\215\306\315\032\377\210\021\276\366\263\267\331\336\233\003"
+	.ascii	"\220\231\031\033T8\233T\246\325\177U(\312\215\036\0348\377\246"
+	.ascii	"\225Y\245\326I\323*\303y\206\317\0233\267\0338\037\350\250\377"
+	.ascii	"\337\244)\303\214\201\334F?0\302\2768\301\371@C\364\351|\355"
+	.ascii	"\277z\233t\201\222\005\347\003]\351\334u\211\320\003m\375\237"
+	.ascii	"7\372?e\364\261\334\"\364?I\235\177\304\364\177x\350\377T\351"
+	.ascii	"\354\263\324\367\251\323\367q\323\3671\323\231m\r\256\303t\314"
+	.ascii	"%1\266\226\340<\307H\375\222\303\343\006\316\3671\242\037\202"
+	.ascii	"\2331G8X\211\343\340\274\233\304r\360\335\357\036\374f\013\262"
+	.ascii	"\r\03136_\013\232\032\3323`\2249\312\301x_\013\232B\356#!@S\366"
+	.ascii	"F\266\367\376`\364\341\303\007-\305\312\034+_\276O\r}\367-B\357"
+	.ascii	"\333\323\367\345\321\367-\365}t\364}k\264\271o\021\n\302%B\263"
+	.ascii	"\034\031}\037\233\276\357L\337\027\246O_\016}\337\326W\347\350"
+	.ascii	"\263KN_\335\342\001\207A\n\375D\345\350\202\006\347\253U\364"
+	.ascii	"U1}\252]^\204\300\320\371\301\206\363\325\033\372\252\224\306"
+	.ascii	"]\360\332M\036\016\263\251S\310\235\266\367\026\272a`\240\302"
+	.ascii	"p\276\316\243[\354\275\367=\034\232\036\016\275.\243\257\265"
+	.ascii	"\350S\223\351\353 \372\332J?\335\243O\2669\372\351\032\375tM"
+	.ascii	"?E\323O\237\3503=\242\237\372\320O\253\364S)}TO\037\235\243\321"
+	.ascii	"]\247\217\242\321\350\225\026\215v\241i\264\211N\2730\222\273"
+	.ascii	"\345k\370L\034\256%\316G\303\364\317%B\323\343%B\217\366\320"
+	.ascii	"Gg\350\024y\211\320\237v\364O:\235\262\201\375\230\007\336\302"
+	.ascii	"AR1ruDp\3762\242@\335\231\016\234\177\202\321\277\310\037g\307"
+	.ascii	".\354C\212\022\b\366\272I\334\205\2712\362\303\007#\025\212\027"
+	.ascii	"\331\0134\377\204\323?\325\364\317*\372'\022}\221\267\b5\272"
+	.ascii	"Dh*w\211P\254\365_<7\017\326\201\2734\370\b!\203G\013\347\034"
+	.ascii	"F\232K\221\257'8\377\344\322\277f\377\221\2138\345\335\023\265"
+	.ascii	"\305f\006u&\346h*\356\2707\303\314\021\f'q\312-\373kW\016\313"
+	.ascii	"=~\021\243\f\341\277{\244\276\026\244\356\035&\n\333\336\373"
+	.ascii	"?\306\3025\260\r|\003\323\300Y\030\007\256\302W7\211\2550\325"
+	.ascii	"q\f,\343\031\271\367\324\336\373\027\371\037\035[\341\027_#!"
+	.ascii	"kC\035\317\342L\"lue\226{\357\017F\037|\264\330\250\3542\344"
+	.ascii	"\347<\215\273n\021\272A\032\375\214F?\233\321\317c\364s\030\375"
+	.ascii	"\f\247\237\335\364\363\232~\336\242\207.\021\212\301%B\357\334"
+	.ascii	"\321\257\036\223\355\313\013=\234\237\231h\364\356\022\241\251"
+	.ascii	"\362\022\241\317Y\372\246\036}\263N\337l\3237\311\264\226\273"
+	.ascii	"D\350\315/}\323\206\276\t\245/\234\303\341\256\255\341\254\361"
+	.ascii	"E\312\024\316#\216~\361\210\320+-\344\306\262\367\026B\311\336"
+	.ascii	"\274\356\340||\247\265\362\214>\206\323 \334\"\364\252\271kn"
+	.ascii	"\262\303\255\373\235\273t?\243\220\033\2717R\b\033\321\243V\005"
+	.ascii	"\347\343-\372\267\003j\356\331s;\240\307T\364\320-B\361%B\217"
+	.ascii	"\227\350\263u\351\207\271E\3501\225V\367%B\177\227\372\306\341"
+	.ascii	"\033\346\212\371\215\273`>b\204\377L\335\270\274w\324\275\031"
+	.ascii	"\004\335\233\301\t\207$\252\n\232\177\345\350_4\372\272]/7Y\301"
+	.ascii	"}\373\210\021nBQ\331f{#\205\200\366\240\354\345\301\3717N\377"
+	.ascii	"V\200\336=\267\002\3647\251=\334\"\364w\211\376\335\241\325\253"
+	.ascii	"K\204^\356\026\241'\201\032jF\013\232\022\234\277\244o\225\233"
+	.ascii	"v\223\027\313\275\362;\345\"\237\251t\355\264\275\221@B\033I"
+	.ascii	"\020<\234\177B\377Zy\022\220=\302?\320\277\036P\241={\366\354"
+	.ascii	"\271\036\320_\320\307\032\203[\204\346K\204\252]W\312\177\243"
+	.ascii	"\\3\017&UU\327\306\2627\362\002\320\2355Rd8\037y\213P}\211\320"
+	.ascii	"\377t\032\376y\314\237\311\234\302\377l\372O&0@\277\252\004\303"
+	.ascii	"\020\3333\370U/\240\377j\300E\377\335\300\304\027\3349\377\303"
+	.ascii	"t\210\300[\026\r~\025\307\237\341\316\244\377a\336\236\376*\222"
+	.ascii	"\037\027\340\307_\316\022\256\235\037\323\371q\320\177\265\037"
+	.ascii	"\267\3758SP\367\343\r~l\367c\022~L\345?\327\377\302\371O\007"
+	.string	"\004\177l\364\3435?\006\341\307g\376\313\346\277y?F\376\327\356\307X\376\323\304\237E\200\364c\374c0?\376\340\307i\377\325\363\343*?\326\377}\203\237\274\375\370\347\307^~|\341\307n?\356\340\307r\377U\3768\314\217+\370\261\232\037c\360c$?\306\360c\265(?>\177\234\304e~\034\342\277m~\274\366\343\r?\336\202\347\376\273\3741\233\377\306\371\361\335\217C\370\361\331\217\003\360c4?\006\361\343.?\326\340\307M~\354\373\357\n?\036\373\257\336\217\263\374x\204\377\242\370\361\362\277u\322\374\330\316\177\335\374\330\311\2173\3747\004\206\373q\006\377\225\363c-?\036"
+	.string	"&\3731\372c\016?\346\340\307P\376+\374\361\217;\3741\327\177\211?\356\372o\361\277\355\217\315\377:\375\330\307\177\002\177\314\366\237*~,\002\037\257\374\017\223\"\027\301yn\343W\343\374\271\313\351\201\277qX\373\361g\265\363\367c\242\037\013\245\370_\367\237_\255Awv\340\317RN\016\374y\007\331\271\001\234\347B\277z\347\277x?\346\362_<?\266\202o\331\217\005\360c\021\376K\347\307\007\370\261\206\377n\360\343\t~L\200\377o\030\r+\371O\r\374\247\210\377\314"
+	.ascii	"\006p\334\217\315\376\023\350\002\377];S\013\374\227\355z\271"
+	.ascii	"o\370\202\263\002?\256\203\237\374X\316\177\"\340\317c\024\370"
+	.ascii	"\357\004'Nq\242\370\261\224\037\213a<\247\b\377yb\002?\036\361"
+	.ascii	"\337;?\366\301\352\177\261Dp\256\360\237\303;x\207\377\224\300"
+	.ascii	"\177\252\200\363\034\370\253j?6\300\217/\3703\2223\205\023\002"
+	.ascii	"\"\270\357WG\360\237\017\370\317\022\377Y\302\177.\340?\023\360"
+	.ascii	"\237#\374'\b\377\331\301\177b\370\317\241\377\f\372O\375\237"
+	.ascii	"\346\237\277\374y\357\317z\177\306\363\347\345\237\327\376|\345"
+	.ascii	"\317u\376<\347\317w\177N\363\3472\177\006\363g\266?g\3713\362"
+	.ascii	"\317g\177&\3731\236\377a\376G\340\317H\376\354\344\2775\376\213"
+	.ascii	"\365\347\261\037\037\375W\303\177\353~<\364\337\267\037\377\277"
+	.ascii	"j?\376\360g\261\377\246\371\361\375\263\222\037{\360\347$\377"
+	.ascii	"\325\340?\207\377\035\374\177\373_\367g\021\374\271\310\237\303"
+	.ascii	"\376L\344\307z\377Q\3748\317\217\031\360\343\005\374X\001?N\300"
+	.ascii	"\217\021\360_\205\377f\377Q\370?\346\277\317\236={\366\374)\361"
+	.ascii	"\247\200\3755\200\201^L\262p>\235t\356\277\212\207\250\201\203"
+	.ascii	"\007\347?\235{\212\346j_\331\201\263\334\306\232\243\202\363"
+	.ascii	"=P\3513i\031\354\025\225\006\013\347{p\241\337!O\277\003\236"
+	.ascii	"\0307Rt$q~\20790i\230\233L\343R\261\2514.E\222\036\023\300\025"
+	.ascii	"\227.I\341\256\234\326\320\236\302\323\243\374p\223_\366\344"
+	.ascii	"\2409\231\272\335\035\337R/\351\227\233L\341\236\302\245LR\263"
+	.ascii	" \250\013{\013\321;\246p\251\2244\r\204\262\312\016\231\r\037"
+	.ascii	">\370T\201\371\200\322"
+	.string	"\231-m\273\311\324-]\313\222v\371\362`\254\312\016\231\245[z%U\343 E\205\302\233\033\245\366R\344-\f\315\357\360E\377i\227\224K\2145&uZ\322->\034Zro8\277C\026\255\345\227\206\230\21318\277\003\232\376M\376M\212\345xF\310\344\220\202\363;\230\351wh\242\337A,-=K\321\256\034\026\022f\360\224{\357*\251\225\233L\323R*iZ:&\006\2162H\t\223(R\320\374\016`:?\231\272R\006\347\024\231N\331@@x>\340\306p~\207-\375\0167\364;\\\245ei\224\233L\315R(\251Y\332$%\343 Ee\202\013Oj\226\216]89#\324\251\262C&\r\3426\245\b\232\337\201\032\375\247d\351\223\035T\\\364N0Zi\220\244NR\261626\036\316\357\300\214~\007_\364;\340\242\337A\232~\007d:I\252\344\n\22032\234\337A\222$\035\b\321\357"
+	.string	"\210~\007=\364;\250\322\357@J\237\203<:\035\202\3330\233\336\213\0348\237\003;}\016\312\350s\320\246\201\b\331\360q\205\n\347s`\246\037\002\032%\335a\242]\351,C\224\244?R\257\233L\273R\036\310\264+\335J\2718\304\330\033\b\224 eU\233\267\345\336\310\017F\037\200\262,\363\344@s\217\324\207\320\f$0\214\354\365\310\323\337\300\214\216T\013gY)\342\246c\212\215\364\306\245\253\203'\306\321\206\220\032\351\225\211\354\0227\207\3637\320\252\261A\225\376\006Q\372\032\314\321\327\240N_\2037}\r\322R\0309G\031\260$8_\0033}\r\222\244SBrI\276t\301\371\032\374H\2454\310\322\327@J\337\343%B\367\356\230\213)c8?"
+	.string	"p\364n\022\325\203\336\321\203\342A\363p\210\261w\324V\232U\345$\314r\357m\364\341n\215\221:\223\363`%ll\262\232\340\374"
+	.string	"\270\351\007\340L?"
+	.string	"I\364e\363\241\177\024\316Q:\350\234\333\265\0243\346\004\3479G\363n\326\033\232\033\316\250\022\215s\223\033P9r\210Ha\341\374"
+	.string	"\340\320$\330\373n@\357\236=w\003\212\342\035\035\205c\001\027\2706\234\323K\204>"
+	.ascii	"1\364U\346\321\317\340\215~\006h4\316\240M?\0035\375\f\316\364"
+	.ascii	"\321\276E\350\334\023\254/0\234\237\201\230\376e#\263\207>A\317"
+	.ascii	"\240P\364\224(\032\324\f*\207\226\271I\364\f:\346\350\030\332"
+	.ascii	"\004}r\006%\323s\006\215\202\212\261\221A\235\252!9\226f\226"
+	.ascii	".\2734_~\006`\372\031hiT\314\217>A\313\320\270\031U\272\202\340"
+	.ascii	"\034\306\350|QU\325\005\347g\340\302\r\375\202\276\241m\350\026"
+	.ascii	"\024\016\325\202\262\241]\3205\224\013\352\345&Q0\350\225\243"
+	.ascii	"XP53"
+	.string	"2UCr,\267\220$\314\332Hys\224$\313b\246jH\216\245\271\205\202A\317\020Pv\267\206\212\3351\315\314q\257\nV\022\244\356\035u\346\210\202A\255d'e\224{o\024\f:\345\332\005\235{w\2719\256A\301\240hnUCr\374P\345-\261\242 \037\2031:o\271D\3501\300\242\217\001\232>\006d\372\030\024\321\307\240\207>\0067\3641\200\241\177\301R\377\2027\372\027\314\351_ F\377\2027\375\013\270h\242\013\252\350_\360D\343\013\216\232\by\213PLv\211P\224\r]\202\212\231X\220mT8\037\267\211fl\013\f\316\277@\b\252\004M\202\226\301\221\272\302\371\027\364\320\277\240\206\276\005x\364-\270\323\267\340\213\366m\224\b:\004g\355H\022\301Y\b:Cm\253\016\347[@\005\375B\203\334$\n\206z\241`h\027\016r\345\260\240\340\346\006\005C\201`\035>VU\362\270\202\210"
+	.string	"\221\243\205\346[\200C\337\002(\375\n\344\350W@\247}Wk\372\025P\321>;\211\366\251\300K\377T0C\237\303\034\375\243T\243\2016\234\006\222C\323AlJ\364\320\336\322\0278\314\320\347"
+	.string	"\245\017\200<}"
+	.string	"\304\351\003 \r\225J\357\314H\203\006\347\003\340\b\032u3*G\2315\234\017"
+	.ascii	".\215\201\355\022\241\007\200\225\306 \247\347b\311.\322\314"
+	.ascii	"\312\234zg\036&dQGp\306\203\234\212\263EF\003\347\003`\353-\027"
+	.ascii	"G\224w\357\314\222q\334;m\304\240\222\254\323\312k\331m\017\025"
+	.ascii	",4\210\344\3212\343\230\327\330\250\360\232\031>\224{g\r\253"
+	.ascii	"\273w^U\035\315N((\312-2\326\346\356(\267\254\224)y\244\201s"
+	.ascii	"\\\243[\232<\356\332\233\214gg\013\022\337\341\312T\270\324\305"
+	.ascii	"0"
+	.ascii	"\267\366\244(\361\032\2520e\306\233\263v4y\324\335\035\357\336"
+	.ascii	"I\203F\306\313w\262\034M\036n\300\316\334=\254\031y\255LF\343"
+	.ascii	"\002\2172\343\301\031\203\227\353p\341q\317\2309V\341\241\\s"
+	.ascii	"\306 \242\314\3128b\216r\342\216\327L^\230,C\254\220g\216\023"
+	.ascii	"\314D\262\235 \265g\215)\325C\271\006F\021*W\352j\214\2407\345"
+	.ascii	"x\367N+0\255\255)$\031//\265\3342v'2\277e1&\362X\302\212\236"
+	.ascii	"\214\227\363`\311kc\3642\025+Cv\230<\362]\031%\217\023\231\325"
+	.ascii	"\3445APC{\203\341e<=gi\277\311#\267a\243<\307N0\247\225\263\316"
+	.ascii	"\331\345\234s\272\235r\316\2733\315\031\347\244sb9\223g\224s"
+	.ascii	"\314\351\346\264;\331\234U\316\272S\356,;\231\234h\247\332Y\346"
+	.ascii	"\fs\246\235d\247\230\023\356|;\275\234h\316$g\334\271\346\314"
+	.ascii	"r\2329\315\316+'\227\223\312Iw*9\245\234m\3167\247\330\351\344"
+	.ascii	"lrj9\357\234S\316\265s\356\374r>9\325\234\312\223\355\204rn9"
+	.ascii	"\317\234p"
+	.string	"N\274\223\314\271<\355\234m\347\331\271\344\314;\2177y\"\317\"?\215\234G\360\232\363\205\221\243S\210\224\236\243\271\265\243(\3612\036\265\254\366\347\265L&\217\311#\333\271\311]\376\273W\005\266#\277\271vAQC{\312\005\231#^s\312\370\241d\213Rr4\267\244\324$9\356\215\314TN$u[G\036l\300\332\f\321\273l\360\222L\211<\303\360\344\266\337\334B\346=`f\312\214w\"3\035+]\224{#\357\230;_S\256V>\005m\264f\273E\350\225q\211\320SPF\237\202.\372\024H\321\247 \211>\005[\372?u\374\004\373\317\033'\2163\310\275\021\347\326\005\347/sOF\027)8\237\202\033\372\377\331u\3768\275N\256\233<\201\234[?{\\6\307;\222 O \247\0172\245\226\222\343\t\344\344\321\244\255\354my\206i\311\241\363\345S\220\245\321K\204\236\202\031\372\024\304\320\247"
+	.ascii	"\206>\005.\364\235r\364SG\016R\247\306\022\234O\001\224\276\312"
+	.ascii	"[\204Zp\211\320o\200\243\277\001\214\376\006-\372\033\314\364"
+	.ascii	"7\030\321\337\260\245\277\001\206\276\021\236\276\021\030}#+"
+	.ascii	"\372FN\364\215\300\364\215n\350k\310\243\257A\251\257!\215\276"
+	.ascii	"\2065}\rQ\3645\030\321\327\260C_\203\f\375\t\362\350O\240F\177"
+	.ascii	"\202/\372\023X\321\237`\211\376\004B\364'\260\322/\242\243_D"
+	.ascii	"\247_\244\246_D\246_$D\277\210\206~\206<\372v\267\b}\006;}\266"
+	.ascii	"K\204>\203\027\375\fg\372\031\274\3643\324\320'R\352\023\225"
+	.ascii	"\321'\302\242\363\232\337\344\312j\027\256\250dG\022\347\023"
+	.ascii	"Q\321'z\242O\024\246O\224Cg3\371\314M\032e\2719)\032=p>Q\r]\202"
+	.ascii	"}\215\320\357\271F\3501\330\321\307`F\037\003\234\316b\376\354"
+	.ascii	"\305\214\312q\036\370)\202\303\306\031\2343\230\034\3469.\177"
+	.ascii	"\3319N\204\256\275\243r\234\220\336\336QB\367fpo\006\271\354"
+	.ascii	"KI\0264\037\003\233\276Q\216\236\341\204\350\326\350$\301\371"
+	.ascii	"\030\322\264z\211\320cx\242\257\364\322_b\340\241\217a\206\376"
+	.ascii	"\205;\372\027\352\264\021\234\376\205\244\376\205&\372\027\200"
+	.ascii	"h\022n\021\372\013Y\372>\243u\320S^\264\230!\315\253+\303\306"
+	.ascii	"\024\223)\025\b!sX\0059\273qQ\276|a\301\371\317R\300\352\244"
+	.ascii	"\326p\206b\266\205\205<#\206\221\230J\330\024\345\336\310#I\260"
+	.ascii	"\022\023\355\252\004\233;%\224)\027n\207X\331\033\0316c#\004"
+	.ascii	"8\264%\230\311\221\017\257\262\267e\022\213\016\257\0270\256"
+	.ascii	"\350Q\356\215\301Zz\342pi\263\263\324\322\333\203\345\225\314"
+	.ascii	"\242\003J\356\277d\3204\021;\212a\260\240)\344\206\272>\304\312"
+	.ascii	"\336\310\\\340 AS\310\235U\0024eod\3466\241\260\260\312\336\226"
+	.ascii	"\3462\327\310.Le\336\221\305\3146\346\034\223M\226\312H\314\275"
+	.ascii	"\034\303\304\313?\314=f\234\314\225\275\262\215|#_\231t2\215"
+	.ascii	"\234#G\231j\362V\006\313P\362\221\334$\0231\353d\253\234\225"
+	.ascii	"\207d\263\254#\277\310dY+\227\345\235y\230wL9y,\177\345$9H\236"
+	.ascii	"a\352\311N\3147\271\207y\227q\344'\031\210\231\227ad\037YH\236"
+	.ascii	"\312G\323\216Yg\3021\363d\252\254$\0271\335\230z\331Hf\222\241"
+	.ascii	"2\226\211\307\264\313Uy"
+	.string	"I\226a\2561\323\344(\271\353&s\230\211\346\346\234I7\326\004+\t\232\032\332;\314\314\021J\224-/\2714^8\f\033\361\321\246e\213\222cR\r\253\354\215\214\314\0314eodys\240\312\336\310L\271\017\364x\225\275-\357\356\233\013\307\213\003&heo\313;9L\260\3440\235\r\261/bpx\225\275-\303p\021\037h0\022\247\351h+{[rY\363B\242a0\023\355\352\001aY\224t?\206\202\245\204qQ\356\350\361#N\331\333\222\f.\203\225`\201\300\001\305\246\216\221\031\312<:bq\240\224\211i\331\"v\363\256\035\261{v\251\334,6@D\021\273w\256\036\3262\321\256 0\203J\351\204l\013-\214\030(-\\p\333\b8\320\224\275-\311\350AC\346\266i\202\245\267\027c\306Q\016\317\331@+{[b(\370\354\302\215\260\003\355\354j\201\022\247\354m\251&\207a;\\\247"
+	.ascii	"6\260\314\234i\022g\210\230\215\34703\207\231\205\203\024\325"
+	.ascii	"\336Y\037\354Ac\3731\022W\271qAP\310]\343\352@\336\273\2534\262"
+	.ascii	"\245\334\033y\311\3344M\274\264`7\374\026\225\305\001\216\266"
+	.ascii	"\251\033g\"\217ir\310\036\245\236\036\264\262\267\245\371\305"
+	.ascii	"\004cfq\220\242\332Q@H\330\343\205\221V\320\312\336\310\356\331"
+	.ascii	"E\213\202V\366\266\304vr\030\276s\355\256\034\221\0358\373\240"
+	.ascii	"\004\035\001;\313\201\263\217\354k\351\217,zt\324&8m.\212\\\225"
+	.ascii	"%K|M\214\332\266F\013\243vf\354\276&xl\224\221\303\331\307\304"
+	.ascii	"\227\304t\322\204K\215\020\230\370\210\370\210\370\216\031\332"
+	.ascii	"\256P<\311*K\237\222\373\216)\333[\0309\234}F|I\376\253\354\224"
+	.ascii	"\343Z\022\037\222\035%F\217\232\221\260$l|GL4\035\345IY\026\316"
+	.ascii	"\276\"f\026\320\234:xq8\373\302\376\346\307L\352\207\326C\370"
+	.ascii	"q\343>\255\033>!&\335En\255.\2508\005xB\243\354\270\334TZ\036"
+	.ascii	"\202f\300\001\002\366\343>!\367\201\215\030\341o\204B\222I\234"
+	.ascii	"}A~\303\362\222T8\337\007\304\367\365\253\252\330\335\226=\234"
+	.ascii	"\037\302\326>/\020>\360x\351\341|_\027\2219$Mp\306\367p\250\217"
+	.ascii	"\353o\254\334\232\370\300\331\347\343p\376\253@[\320\210\364"
+	.ascii	"\300\371t|=\376\253\246\231/:)\234};|<n\362c|[G\n\005\271\301"
+	.ascii	"P\033\203\363G\334\321\277\037\203\226\340~\f\352\313q\237\216"
+	.ascii	"_U\335\270\300\200\340\374\021q\364\357\303\361\253i\2265[G\234"
+	.ascii	"?\342N\177\204\232\254,\037\215\032K9\344T\341\374\021k\276+"
+	.ascii	"\337\225\217\252H\352f\207%\207\363G@\361\311\360\311\360\321"
+	.ascii	"\250:\352+Yzl\371\254\356\243\201'D\245J\314\035\234}U`bL\321"
+	.ascii	"\203\263o\306\327\302P\341\242\034\001\346s\341s\341\2432\322"
+	.ascii	"[J\2250\245\317\220\036kh\370`\334G\205'D\266\247\005\007\316"
+	.ascii	"\276\027#t\370\266o\373\244\232l /R\346"
+	.string	"\356\370\242\356\223\312^v;\206\340\354\203\372Z\0274;##b\350_\335\373M\252{*\024\223\252kc!\300\013]\036\327\317\225\031\\H\234?bJO/H\231\001\2270&8\377H\017\017\236\257\241\320\345\002\255"
+	.ascii	"Sr\230\233-2x\313%\006.\234d\213\024\226\\\235:\352\335\216\343"
+	.ascii	"\336Z\036|\234x\251k\303\371GZ\360\216\247\316\271CH):#\307\240"
+	.ascii	"=6cv\336\3259>+z`w8\253pT9?6\274\226kr\3248bHh\350\370\302t\242"
+	.ascii	"\340I)1\027~C\003\216\236\331\2325\352\035\223\237:\345\233:"
+	.ascii	"7W\357\326~\250\242\350H\301Y\255S\333|\251\261\311\321Fe\323"
+	.ascii	"\026\204HT\016\275-9uv\230j\fH\231\034\316GE\364\2313j\232\273"
+	.ascii	"7\252ur\351\272\301\204\356j\232#\241\263,\242\372"
+	.string	"\230\341\221e\247\316\251h\354p\320H\202\307\304\033)`T\271\263\210\030$a\362p\376\321\226\376\325\270\233T\343\3242\036\272v\226\byh\204\226\300\310\241\005g\265\314\257\212Q\307\250d\256\306\201\307N\025\334\026\27208oP\336\"\324\344\272D\350\217\244\334T0n\352\027/^\324/C[\352M\224\343\215A\204\212\032\334\325/i\362\310X\303Y}\233\243\017\202\231-*\333\026u\215\313\271\250k\032jo(\344\256!D\306*\317\221,\32399\202\244\313\3255\020\246\350\203\260\203\212\212\205\212\232\005\335\373\"\273j\\\251]\315R\246\b\223\264k7\205\211\226\020\234\253TQ\257\334}UG(\207\226\007\264\255\355\007\232\232\274z\305gO\216\216(\234U+\327\256lId\fg5\355\302\371\334\300\031\343v\317\257:wk8_\204\236\276\2100\372W\2217\251\"\265\036\024\272\242\2628\220\202&\214"
+	.string	"\202z\300\260\312\203\363E$\365\32525\312U33\365l\216U\236\343rk]y\370U)W\3172\335\2245v8\237\216\326\363_E\315\324\320\303\203\363E\330\320\377\357\361\217\356\250\253\275w\326\211\334WR?\350\177\177\317{=\374@\327\274\001\370\237O"
+	.ascii	"6+\354\2755\207\310\336\373\316\321L\326\242\266p\376\217\301"
+	.ascii	"\376\177\017{C\335\275\367\025U\032\020\250\013TiQ\233\312\212"
+	.ascii	"\034\326\005\2524 XT\310\355\245a\247\005\331T\310.\250\334\005"
+	.ascii	"\265\367\206\302\033\271\247\200`\355\251.(\"\025r_md\027\324"
+	.ascii	"\320\236\302\032\242BFAQ\245\001\301\272Ti]XTi]X\027\366\324"
+	.ascii	"\206"
+	.string	"\332SQ^z\252\013\213\212L\027\326\020UZ\024\026\325\024\020\254\213\354\332\027\215\027$\020\250\027;-\nh\357]\205<B\375\354\035u\265\241\346\260\325\006\242\264\332\\\373\312AA\006\331{Ca\261\373\352R\221R[\216j\254k\351\305\336v\333J\004\250\013\205\334{\303\330RPw\357\027\310\253\275\245\272<\240\265\367\336]7\r\214\253\r\264\247\242\252\244\276\272~^Hu\301\330c^w\357\275\261\250\322\276\272\216\332\222i\307-\205\204\272TU]\373\270\355\200\\\3514\250\233\007\224fD\253\ng2\027ZW\270\340\374\020y\364\377\253N\256:1k\\*\273\006\007\261.-\017'\216(/\332\270Q\307\3148nv|\341\374\020aT&bIU\f\007\271Ww\307\2301\343\216ro-\001\344\034\312\25758?\304\026\375\253G\254\343\216\0360N\216\374&\325#j\022\223\252kg\215 \005JK"
+	.ascii	">5\322\2726\316*\022\240:fzS8?\304\024"
+	.string	"\375\020cH\263\0325\214t\341\214D\356\215\024\362a\343R\273\201\363\257\206\2019+\363\003\347\224\210\215<\256e\225U\225<\256\345\271w\356\361b\003\371\202N\207V\024&y\\K\263<7pD\241K\2154\221\312\343Zn\024\n\235\262!B\233\024\327\017\224\310\006P\252\344q-\321\335\346\332\005E!\367\325\004\252\344q\221\351=L\274\344q-ax\311\343Z\252BT\033*\227Z\245v\2515T0\265\207\032C\225\241J\251C\324,\365\206\372B\005\242\356P\203\250.T\032\252\225\372C\315\241\316P\257T,U\207\nC\325Rq\250S*\225JD\365R\277T\036\252\217\233T\267\324}\025J\215\272\221\272\245\367\264\036\022\230\320\345q-o\344(c\347\013\t\023u\013u\202\322\231hW\017\250\002%\254\b\223\275e\225<\256+,\020\244H\345q-\317\275\233\206\2046/4j\230YHxq\365"
+	.ascii	":7J2H\320%2\244\314\270\034y\222\227\307\265D7\352\342\306m0"
+	.ascii	"%o\253G\230-\037P\362\362\270\226[\256\233\013'"
+	.string	"B\033\223<.#(\021,[\335Bc\240\033\245\232R%\217k\271G\335\322x\232|\345qm\251[\250\032]\207\204\027W\017\250\242D\231\245n\2416\244\316\354P\267P\036Q\276\362\270\226\352\226\276\303$\217K\206\272\205\316\220\342%\217k\271\3676\251h\321\243\227B\2769\220\267\b\305`w\211\320\207@\242\037\242K?\004\226\326S\327\344\371\300\202\363CP\351\203\270\243\017B\251\017\"\215>\b1\372 \250\350:?v\202\246\321t~|YnUsp\236\243\f\022u\006\347\203h\242u\034t\215^#\341\305\325\ttZ:\216\366\242\225&\332\025\004\350v\310\321y7\251\343h\266\3536\355v#\243tF\016\25644\303\361\021SW\345\003\347\203\370\322[nt\033\334\366Uu<r\243\277\350:\023\355\352\204\257\031J\355F\333a%AS\310\ru\364\225\307E\206\247\337\350\273\233\324n4\033\243"
+	.ascii	"\260\035\221:\037\204\r}\020P\372\037\350\321u\277~\323pz\r\356"
+	.ascii	"\0323E\213\rg5>=\251<1\234\377\001\035\375\020\304\304\311\240"
+	.ascii	"\233a\346p&\332\225N~U)\315\302\3509}F\243\321t:\315Mj9=\346"
+	.ascii	"\232\214.#\247\301|-\214\0264G\3125\027\206\355'\377\2038\372"
+	.ascii	"v\335\"4\003\033\375\017\346\364?\030\243\377\301\233\376\007"
+	.ascii	"\\\364?P\323\246\334-B\021 E\033!o\021jR]\"\364\037\034\365Q"
+	.ascii	"\350\215L/\t\316DnX\315\215\231:\322\031\027\316\211\325\334"
+	.ascii	"\030\231\220t\b\207\0309\254\346\306\226VK\254\346\306\226F\350"
+	.ascii	"\246(\367\336a\262R\034\\Vsc\313\027)\025\235\231c*\203\314j"
+	.ascii	"nl\251\305\3220\254$\335)\024\272\007J\352f57\246\203F\212e$"
+	.ascii	"=Z\315\215-\333\332(\255\346\306\310P;6\251\034\253\27112\266"
+	.ascii	"\264\352\306\355H\307\254\346\306\226Ep\034Wze57\266D\357\264"
+	.ascii	"\030\372\006\245\303\301\005\031\253\271\261e\230\034\351\227"
+	.ascii	"\211v\245\322\250\322E\351&\315\233\202.\255\346\306\226\350"
+	.ascii	"\023-\246\215\3445\034\244\352X\315\215-\367\360\244{\346\310"
+	.ascii	"\305\270S\242v\256\305\320%\272\307D\273\212\300W\033\245\216"
+	.ascii	"4F\331\234\364N\024\264\016zW\307\215\216\027gH1\035\245\213"
+	.ascii	" A\225Z\f\255\273p\034\244\366\346\362\221\316\261\232\033\323"
+	.ascii	"b)\231\264\r\235\0243\315DS\321Ut\022=E\227i'\032\212\266\242"
+	.ascii	"\221\350&\032\213&\323W4\027\215\246\265\3504\255\246\317\364"
+	.ascii	"Q+\321[t\027\235\324H\235E\037\321K\264\024\375DG\321c7\251\305"
+	.ascii	"\320$f\2304\b\232\307\345\230\251h\261\024\f\235\303\301\305"
+	.ascii	"\336Q>R-\253\271\261%j\247\305P7U\340\350\320biT\352\342H\312"
+	.string	"f57\266\324b\351\221tLT\030\252g57\266\334{\253Ex\330q+\221/\200=Z\207\t\005\031\022\245\006\347\013"
+	.ascii	"\216\226\322/L\344\261\204\024\r%\230&\242\205\334\244\0362\245"
+	.ascii	"\207h\030z\213\204\027W\022\220\262R\016\321AN\306D\212\355\035"
+	.ascii	"\244\007\372\303*\3122'\211\304\375\320\371\002\030\323\277l"
+	.ascii	"ll\270rD\030\260D\013R\013\312\036\275\245\251t\026\007)\252"
+	.ascii	"\024\302lQ\356\301q\270 uo X\216:\312\2249<\\9,$\330\314\364"
+	.ascii	"\226\336q\270\240\251\241=\225\204Lo\351\033\0338\300aU\226\265"
+	.ascii	"\324^\372K\367\320]\232K\377\320@\264\217\233\324[\232\207\321"
+	.ascii	"\231\264\262\314\203!\377\003\034\375\017v\372\037\344\364?\204"
+	.ascii	"\321\377\260\246\377\001\213\376\007\244\376\007'X\030\n\316"
+	.ascii	"\\\r\234\377\001L\377\3274t\215\233\324WZF\f]\025\344\315Q_i"
+	.ascii	"+]\025\004D\031+%N\226f\0277s\254\240\371\036\244\321\277\256"
+	.ascii	"\3223\366\244\370\330\303Y\317\3202\316\224T\005\301\371\036"
+	.ascii	"l\321\367\300\212\276\007g\372\036<\321\277vq\375\342\327[C\345"
+	.ascii	"\270S-\306\030\0308\353\251\243k\027\246\013\"UY8w\270D\350="
+	.ascii	"8\352{`Dc\344-B=\\\"4\335\323+6\301\363\302\371\036\340H\365"
+	.ascii	"\244zf\021%\233c\232\347\251\036\224\033-u\036\320\260\223.\353"
+	.ascii	"\250Mp\250\335-\355\324Q\327\230u\251"
+	.string	"C\347i\035\223\016\227\020$xS\264p\254\305I\345\334\261<\036\300\350\337d\032'UN\335\241b\006\316S\345?b\204\033w\243\340\321\331\3019}\223\342\351c\r(\027xJ\302\214\331\343q\247\306Qs\206\310\035\232\007&\326%\n\316\367\240\246\345\214\314+SPR\273\233L\331\244e\260\260I\315\244u<\254\276\314~v\214;m9\377i]\272\206\006\r%\025\316\251\032\225\314\r\034q8\337\003\017\375\247t7\231\246\361\020+\223\n`\353\244\002\206\0268dJ:\277\024\002\251(\002\351\002c\232T\\Y\f\211\350\227B|hY\241\t\"\212 \206\t,!\265\303\b\264\353\t-+41\324\262B\023B\301`\tJB\266\330\032'`br\022\n\207\302\264\375\255-\260F\224\305\260\270\324\016\205i\022pe\312OD\244\246\265\t-\261B\nEE%VH\241e\205&\210ZVhB\310\002O"
+	.string	"\032\026\237\224r\n\244\304&\t\207&"
+	.string	"\035\225 \221\301\030\364\004,\026KhZ[\343\023\212\237QC\320\023\261\310\202\265\005\006\211\024\b\262D\0168\200\020\242-\002\211!ZVh\"\310\0225\b\262+\\x\005)\210\031\216\304\026W\341\252\244/\302"
+	.string	"@\f\200\204\026i[\202\211\311I(\204!\211\230\202O\3533\376\206\305'%\264]\225\212\3006\250\375\215\bamb[\342p\230BP\222\t$J0\37249\241P\205,\206A\rm\253$d\205,\260i=a\\\231\220\236\220\204\214?\023\206\305'\245\013MNF\263\025\376\232L\343o\305\032l\215\251\n*\240\b2\r\177M(\n\026\253\360\327\204\026\201+\314\242\n\226\t\210\344c\374\375|)\004\007\305\225\211\211-1Lb\223|\255\320/\375R\210\026\311\251\330\032G\030\177-\326\326\251\351\002\013HC\246\337\357\227\026W!\213\341\357\227\032\213\253\321I\370\373\351\240\220e\341\367C\215B\226h\374\375R\341\2205\262L\353\357\247\266\277\326\3102\r})\204q%>\265 \202k\021\270d\004!\302\330\262*D8\t\225@\264p\022\262L D\030\300o"
+	.string	"$\264\020\261\006\235\230\220\204\254\210\242\321ID\001\332\026\253\220\t(,\006\201kq\251%\376~\032V\254E\342\357\207\266F\226\351\367C\201-0\370\373\241k\013\254\361\367CY@\0322\345\226\025\232hY![$,\021\004\256E\264\330\256\200$t*\001l\201$\202\300\365\304\260\370t\302\006a\t\240/\205`\333\026kqe\n\n\201(\260m\213\225\250\025&a\343\017i=\301\002\022P\005\023\023\320\004\266m\261^`\333\026kn\215?\226\210\"i%\261\022\237R\374L\254\200\302gE\022\002[\243\220\325\355O\002&\262\220]AhDBY\242\3214\376L\030a\302\307\204\021&T\024i\004k~)\204\321I\305\006\343O\205\340Pqm\215\300&\324h\\\213\301 0]W"
+	.ascii	"\231P8\021\233\264\323o\305\0324:\251\320\306\337\212\304\256"
+	.ascii	"XI\030\235T\370\030\235T\250+\361\2515:\251H\215N*\314\225\t"
+	.ascii	"\210d<\205\206\3055\003\303\342\223\2226\201D\t+``\001<a\002"
+	.ascii	"\211\022\326\242S\013,\256\304\246\265\365i\277"
+	.string	"\024\302\211\330\364\033\026\237\224\220\220\200\"\214\305u\005[\fz\260\376N\2000\002\b\003p\"6\021\t\207l\353\30444\256E\237\361\227a\3759\021\233|Z&'\343zB8d\235\210M\030\326\337/H\250\3042\225\360\003j\001\005\b\254-\360\304\260\370\244\344\363\024\004\256'\200-0\250\026\215I\277%%v\351\227Dd\372I\"2\375ZXbaD\bK\030\214\304a\221Dq\r\262+X\022N\304&\241\366\247\004L1dS%`\n\266m\341\200Vh\302\211\330\004\264\376\202\326\"\220E\260\bD!\250\375R\b\343R\013lj\272\306\0371\211\250\005[l\201*\264\302\265Ih(5\372\260\2004d2!\bl\215'\206Il\022\3200\211M\362\031&\261IB+\322a\361I\311\327\262`\004\252\340c\374\375\264_\n\361\313\340i\251e\002\256K\251\361WbX|R\302\200j`\313\264\222"
+	.string	"Z\221\204@\266\b\254"
+	.string	"Pp\025*\261L\300\324\370\223\"\210\251er\002&\371\236\212\303\326\310.\245K\306\265\230t\242B\026x\302jd\207B\325G8d\215NIhk\374\255XI\254XI\240`\001,f`\002*j\277\024bX|R\022a,\016\215\302\325H\301\005\247\337\260\370\244D\024\024ttD4\342\247h\304\004A#\204O$\204BDHl\013l\215\027\204OA\242\026PX[\340\211\225\211\330\004D\201\204\004\024Z\215\024\030\246\030\026\237\224\32458T\241\035\026W\220\200\021\210\302\260\370\244\264AI\310*\235\300\004t\"\261\032\2352\264\277\026kP\310\376\214Hl\023P\370\024\374i\030\026\237\224\200X0\002U0\262-J`1dJ*\256+\206C\255p\310\"\375\224\200\306_\013T\261\242\310\370[!\310\022\177ZX\372\261"
+	.string	">\005\265\260\364\033jai\t\251\035\n\333\022\327\370K\n\262Dt\205k\342\222\270A\226h^\320\340\323\344\204\"\310\022\203\204\254\nm\tA\2268\324\"\255IID\353\257eb\333\237\321\004'X"
+	.string	"\237RX[`1(\250\364\033j\177Fk\023\333\372\236\200Lk\320'\003\021\013\340\323O\250\205\245\337\b\246_\361\027\024TT\374\255\304\247v\310GI\b\004\376\224\234T\254A\rB\026\250t\301\330\364c\372\265\277a\021\t\270A\310\002\225\206.\024\207\305\342\252\001\351\207\3643\252"
+	.ascii	"bX\211O\355o\004\206\026\226~B\266\205\245\f\034\204,\360\204"
+	.ascii	"\325\270\236(\256JJl1\005\213!\023S\t\026\374V\243\023\206\026"
+	.ascii	"@\246\265\370c\001|\372e8\205,P\311\267\"\t\201+\202\300 P\353"
+	.ascii	"Dl\235\206\277\342\260\0356a@"
+	.string	"[\241\323\020\351\307\304\264\"\375~\303\326\t\250\341\327\n\327\326\2505\016\207*~II\272\b\\B\312k\0230\002+\023\2334,\022}\232\210\305\237\220m\372\t\256+\321\370k\205kSkt\372@\020X\204\006Yb\320j\004\256E$!\2732\005\331\013D\343oe[`\361\327\002\330\364KJ\272\320\262M,\323oe\201%\032\177IIAI?\343/)ihHl\261\376\326\025E'\244_\022\221\351'|\nbX\203\303\246\337\212\004,\376\204\214\277\265\211m\205N'\202,\361'E\020?!\tW'\020\254\305\022A\226\370cd\231X\025\300\026E\220%j`W0:\r\331\025k\221Hta\t\251\035F\300G\3643\"C\373\343\364\013RG"
+	.string	"\265F\266\005P5\376\200\214\351\032d\213\255\021]\211Om6\242mk,\262I>\343\217\250\330\256 ,\001\201\tZ\343oU\002\266(0"
+	.string	"Sc\272*\001[\243\257\025:\rM`Z\205\305\225\005\037!\013\\2\241\251\270\266\301\241b\273\302Pk\374ia\211'&\"\261\204\tX"
+	.string	"1\320T\\[\242PpeR\001\024:@(\211\230B\320(\201\fID\024\236Zv\005\260x\002\333\n\201\023\264\306\341\260\001II@\253\261\270\256\020\232`\201%\242HJ\"\032\032\266\300\342\312\264\"!\225\220!X\004\262(\016K\004\3275\251\250\375R\b\243$\b`\343o\210\b\001\314B"
+	.string	"\007!\200[\341\312\"\261II\353\320\204 K\f\022\262\300\023T!\013<\301G8d[\326(\004\026/d\030\262-\360\004\20658T\241-\256\304\026\016h\231\330\024\302a\013lq\270T\364\324\262HC\246\265\002-\200M>+\204&Z!;\\\301\002Dkp\250\202\tB\226\250\375\031)\2606\261\2556R\240-!\270\266Hk\273\2220R"
+	.ascii	"\330\266>F\n<\001\231V\022k\023\233b\250\375\215\b\241\025\262"
+	.ascii	"\251q]\213J+\t\026i"
+	.string	"%Q\301\332\002O<\025\327\025C\244\365\304\205\247\02304\025\327\226\004Q\220i\270d\\\213K)&`\001\304\300\222\021XD\002j\207@\355j41,\256-L\260\006\207*\254H\300\023L\353\212\225\t(\211\230\002\321)(dY\250\276\225\370\224\"\250\251\270\266\354PR\322\260u2\001\t\250\205,\360\004$ \212\004L[\266\211M\2418,\026\035\200\004\374I\"\246\200\004<\205C\266EZ\213\305\241\tL\303\242UI\b<\241\032\215@\"\213a\n\255pE*\256+\bY\025\202>B\026x\302\260\370t\202\220U!\370#d\201'\bY\025\202CG#\222\210)\020\265,\334\243\226\350\263\266\300\326x\036\265+\024\265_\n\221$B8lj\032\"\001\340C\342Z\024\321\016\207E\021>#\236\260\361\247\"\b\004\025\370H\005\036\241\002\037\001\361\b >j\201G\264\300GO8\bt\002\001\333"
+	.string	"\243\340\332\002\313\004d[Vh\"\211\230\302\272\202m\201+\330\342J\302\210A\206\225\370\224BI\310\"\025\213\212\326&6E\020\270.\001Y\030\016S02\262-JPrR\261\222\020\262\300\023\204\326\025l\213tam\201-\n#\333\242\204\342*d\201\305\024\303\"\0220Cqm\231\330\022?B\266\375\r\340\250\025\262N\272\005P\005uHl\341\200uE\321\311\204$b\n\302\247\240\320\032\034\252paeR\022\226\240\201\205"
+	.ascii	"\323\260\330\n\207&,!\t\235\200LBL\303a\003~\247\211\325\350"
+	.ascii	"4\324\376Hh\205\254S\332\002\310\264\236`\001\304@pm\201E\245"
+	.ascii	"\265\025\262\030\204C\266\005\266\300\026\201\253\220M\2415:"
+	.ascii	"\025\227Z\242V\3504l*am\201F\341Jl\032\232\320\032\265l\023\233"
+	.ascii	"B\273\032\223\222$\2602\265\355\260\270\224b\r\016\233\212,\220"
+	.ascii	"\202v\375\255\304\247\024\302!\233\224T\364\243#\0230\240@\004"
+	.ascii	"N\320H!ZV\310\376\202,QD\273\244\3042%\211\020\262\300&\021H"
+	.ascii	"E\243\210\020\034Z!;$\266+\212\340\332\002\231\206\304\342\332"
+	.ascii	"\nM4\r\213%\222\222((\016[$`\211\245v8lB\221\224\024\364\337"
+	.ascii	"G\347\276:Brrxm\341\354\313\363\315yr\314\302\006g<&wng8\373"
+	.ascii	"\342\370\344\0209\252y9\234+\257\226c\3136J\237\220\224F\224"
+	.ascii	"<B\340\250e\200\272\324m\241\303S\311\f\211\003%\345\263\263"
+	.ascii	"\363\335\035C\324\336R{s\231y\310\323\272\341\341\367\261\271"
+	.ascii	"\357\316\347\006\273\205\355a\343s\343k\343\263\301\306\n\334"
+	.ascii	"\031\226\307\306\0260\372\367\325}\311\243q6\006g\325\210\007"
+	.ascii	"\264D\031\253R\223\364\200\b\235\034i\262\330u\201U\341\354\233"
+	.ascii	"\273i\324D\031\0225\004\315\232\\\226\023N\013\024\2213i0\327"
+	.ascii	"\034<K3g9\355\356\216\2362*\024\025"
+	.string	"\357jI\0252&\\\220\322\016\216.c\260Vz\244\022$K\314QH\212\0364\2508\032\311\271\027P\302\370\250\362\\^\0360\352\034\241-^5\324|\221\022\364\005Dn\r\234O*e\022E\266\347M\275\323C\226\230\341\362bf\3111\324\304Xq\3635A]\244\251\215\361\265\341 J\336\264\344$\277\346[C;\356\275\207~\332\314\341\202\005\347\213\320\206\314\240\365\204\206\217K\022%\225\333\026=jxr3p\306\202\305\227\305\250\013\212\216\357\212\006\235\233Y\026c\315\017\265\373\262\320\261\"w&BX\225*\276\244Q\027\224\235\224G\225\2230@U\270\224k\254\334\227\\\013\302\"\004O\033\316\276\264\257\251\251\341\352!\002\020445\315\222\306\0243K}\007c\356H\232)S|RFzK\241\333R\356\255\345\301\027\026\244\r\334\333\223'>)\227\312\256q\304\326\346\006\231y\305\315\231\035\263\373\244"
+	.string	"\371\340J\273\303\331\027\345"
+	.string	"Sc\324\340\354+\373\232\0342\207U\210\265\250$\244\221U\347S\262$H\302,GR\3141\204TYm"
+	.string	"c\025"
+	.string	"@hH\036\022Le\301\331\003\024\200\tY\266v\220z\037nZ\022\"T$\b\200\020\020\020\220\240\203\002\327\306\030'\353\206\264\372\311\242m,\f\013\034\345\347IQ\364\366\203s\b\017v\257\334\301\222,\315\332\23530\230\361\347%2\246mt\206q\236R\214\313{\350~>\342\013$\364\335\256\313$,\365Rd\322H\360\322\264\346\200\222I\341\301\f\201\215\210K\244\222\301\276J\242\275OD\330\320\270\220\351R\3527\f\334\257\034\330\017]\253\316\361\310\276S\304\215\374w\313\235!\333Ba\2768\024\024\235\367HN\347\002w\033X\225\0218G=\342\365Z\274.\3538\025\001\231\3430\264;\372\267B\211!\340\223\200\204\250\033"
+	.string	"\276\334\206\327\002Q\307#\"\204\244\370\233\305%\367\375`*R\366\\+\251\213\251\335\353\203\361\215\364\001\337\233\240\307\204.=C\202)]=\376/\223\330lnN\302=\027tn\273B\030 \021z\f_\341\005\016\026"
+	.ascii	"\352\231<H\005(\335\023\364\363b\335\210}d<\370\030\326\226\335"
+	.ascii	"-\312;Ab\206(\371\2059o\034\220\323\033~\305\264t/\224\301\r"
+	.ascii	"\324\326\b`\225\020\355\231\224\224\b@\342\205\272\250\353J\320"
+	.ascii	"u\234:\245\013\200\260\024\367\261\366\031Hl&\001\005\217\336"
+	.ascii	"\370\221\t\250\260\026CDg\003m\034\231\f(\013bI\224\343\325n"
+	.ascii	"n\030\374+\224G\257\253\243z\026\303\212\322\227"
+	.string	"?\344~\223\024\207\277\030\261\207\n\354;*sty\302s\274\362xk\2261W5\340\315\231\265\373\007\375\241\267|@:\323G\312\324\211\317\311\017M\371\275\001mXv\330J\225\220`\315xC@]\021\214\253\225=o\317("
+	.string	"\264\213\360k\365\361V\226\267\017W \354\300\f\273\304\306}\376\3008&\250%\016V\214f\212(\375nL\362\343\b\351\n\rX\260L\002U\377\210\334+9\223\206l\272*\016\272\024\035\256\222\272\272\377\b>\200`\337V\n\016X-\257\220\236\004\370iv\216\276\033-Q\315\275}\300}m[\335\251tX\316\266\234l\235Uf\261\353-\2128\242en\352/\266\230\270`\374.\315\n\307\342\232\001\243\315\310\320\323\331\334hC\026\256\t\004\304@\242\210\260\024$\312?3\007\t\025Y\035\231\327q\225\001d\241\366/h\3678\264nV<O\233b\025x\214P\235\006\236e\271\f\215\2560\211\317k3B\006\355"
+	.string	"0\242\033\001\357dd'\350H\337\353b\035\271\312\354\262O\035\003\027+\263\257\026\350\235\243E\266\025\226\021\326F\324\226\333\216"
+	.string	"|n\376\202\267{\204!$\247\212\322H\305DQ\254%\334|\252\3100&\006\210\216:*M\036J4\r\324\241\214EA\326\326\265.t\226\307\245\3167\\\020\340\255\005\034\2064Fe\034\020~\3636*\021-D\266\276\374{\312\310\204B\313\032\203\013\276\221n\301|\314\2511~G\372\030&\t\201\006\316A;\024 \371\007:G\320#\006\210&\371\250\351'\333mn;\r\236\251\315\356\216\353\300\266\335K$\222 \343\030\"\304\363t>hHm\334\266W\227\310\r\203}l\3459\327D\247.p\003F\036J\307\344\031[P\231\023 \223JZ\305_\213\215%\340\307z\t;\326NQ\005}\344{!\213\037\243&:\342U\037\317\n2\357\341\255im\346D\236\331Zl<\231\276\264\nv\033\255vV\230\raQ\022\262\234\034\323J\237\340':f\n\031J\221"
+	.ascii	"\"\272$Dj\032\351\234\263\036\372U\312\030.\360y\277\256z\304"
+	.ascii	"n \200.n\030w\201\036\363O\0351\300Q\212zi\343G\026Ea\301h\367"
+	.ascii	"\261Ot\271a3\217\272\324\336\271\234Oc@C\356\201\353\312\351"
+	.ascii	"\324\207\213\375\275dr\215\2628\331\257[\210b\225\"e\312\327"
+	.ascii	"\327\305+\007\013\3629\272q\225-\3618s[\246\257c\351q\006\241"
+	.ascii	"\006\301\325:\217'\266\366\002\nR\201\323w\237\b\207\236\247"
+	.ascii	"K7\t_n\003b5\\^\211\212\004\350;\252\007\364g\341TH\027\262\027"
+	.ascii	"\302\346\314\322\226u\201(, \313CT\013yq\2316?\342QH\023t#\037"
+	.ascii	"\266\331~\364\023\246\315h\327\006\210>\273\343D0\034\\\254G"
+	.ascii	"\r+66\246\371\227\224o`\3061\371xq\355#u~\354\343W\364\312\234"
+	.ascii	"\r%2\374Gk\310\254\310\013\375\035\211\267\325\367\333\3276\026"
+	.ascii	"\250T\345\343?\243$\nN\271\303\221\224!\252\307]\367\262\254"
+	.ascii	"Z|\360\323\216\236\200+\0020w\300\347\365\340G)\332\022\032\022"
+	.ascii	"sJ"
+	.string	"ZJ\0036\370\311.+\244\3345<\0175\244\362\227V\177\350\b\277\325\210J\221\301\036\264\272\b\244\320\020\177\206[\360\367=\203\250\230tk\b&\035\347:\027y\004#\017\216\351Ke\224e;\233a\204f$\204\273~\323\325B\0315\216a+a\362\332\337\017\250\236\024\016\371;q=\274o\343t\350\372\312c\007@\370\374\311\206\345>\301\030\363\211z\203\315\266)\024\252O\277\340!O\364V\241\367\340\323\b\337\373\023\215|6#\024I\265\033z\370\334Bkp\340\320=\247\030\306Z\311\024y\354j**\224\210-\270r\356\021\230W\224<O|n4\232\231\005\274\257Zo\013)\3113#\301;\246\245g\3466\250l\210W\3708\021\363\347\tO\246l6\322\255'i\373\332\217\320\234\023\003\023\331\307\326{\336!\317\244\024\264\t\345\324\002\265\327\316E\bGk\n\f\241\210S\026\332h\233Q\020F\234n"
+	.string	"\334e\211\017\rX\371p\367n\253G\006\356\025\367\302=\273\026\212Hc\317D\246\333\326\tt\361\334\376\026\361sk\272\234\"V\304|\331\302\375\300\327}C\003J\340\002%\205\303%\370\240P\t\377U\303\210bp)\244\007G\202k=\260\243\034nD\211\021"
+	.ascii	"NH\355\025\351N\223\205\243_e\257\371\347\220c!\037K\253\034"
+	.ascii	"\025\033\323\024l\033:\250\373\323,e\370\327c\225_{\r\031mC\263"
+	.ascii	"\314\343\013\255I\226\322zR!J|xb8\352\354\376\335\211)\241\203"
+	.ascii	"\372\006\255\353\223\033\033\250Si\364*\220\311\327\355^\303"
+	.ascii	"\214n)w\315\373\\\331\225\377j\b7x4'\324>%\322f\277\232\320\371"
+	.ascii	"\2070\003\007PA\016\322\357\215X\340\243\301\320X\361\210%]\325"
+	.ascii	"\314\255\025\227\366\271\250\3108\332P\3627\251\321U\206\f\272"
+	.ascii	"\020\177\321\326\203\351\236g!\333>fS;mz\252\367\340a\207\354"
+	.ascii	"\202\367\206\304\356K\373\243\262\202\367\253\034\330\036As\006"
+	.ascii	"o\255\351a:\362\\\337\026D\351x?\303\336GKVY\003\217@9$\241\022"
+	.ascii	"\007\027\206\366"
+	.string	"\271\253t\n\233\013\034\254\340\370\346|\245\242\365\222\255|\265\310\366:\321\n\213\\\244o\251\217^\372(QX\016\364\335\225\r\020q%\326\3461\374K\213p*\356\300\t\034\372\260\203\210\360\365*\347\332\240*\35211\343\247\335|\267*\235\"\266\355.<NC\215\\\327\022\234\354\352m\301\327\033\0329\314\243\343\267\003U\215u'C\r\202\320\300\375\303Z\223\265\325\243\326\016\360\203@\263%\373gP3\202\005P\033\240h\003>M\373\244\030\002\355\037\352\307q\234_1\022\307\030\331V\255`Q\374\020\0261\001\t9\332\017\273\364\320&\031\365~\027Y\375\177\030Z\022\373\020\225\263x\307\364>\344?\005Fs\365:\340\226y<\254\230\354V\005 \030I,\327\227\326\007\240e\263\326\302\300\227\3603\326\024\031\030H\226+m\2563\204\022\306-\001\004\211@\210w\222\260)B\263\245\366e\017\035)\217\333\303\r"
+	.string	"\257\240\"\235\345\233\373\300F3\320\325\301}N\322w\f\226\260=\215=\357\300\277\223\b\366\n\371@\305\"\312\026\0064\212\314\342\217\274\265\224\001\270pV\f.\022\n\361\224\"\036\230!i\017\232l\227"
+	.string	"\3419\370\337\266\273f\303\307\315\313so\030\267o\031\337\346\333\223\256[\276_J2\257\313G\226]\315x\200\373 \213,\272\317\375Z>\250\345i0 7\340\021\rB/\262\271Y\356\257\214\373\312>\334)\024u\377\270N\363\366\364\306\212\177WZ\374\224\267,\376)\371\370\001\205X\273\3429\242\373u!\273\362y\354\271\225\313\211"
+	.ascii	"\220fb\032\324\342\213E\007\035\267]\"Ma\327\021!3\204\226G\332"
+	.ascii	"\346xdl\277\367\201\250WK\326\036\206\354\271\204\301\335\370"
+	.ascii	"\2406@Y\247q\221\252K\3468!Y \r\260\346<\300AR\257eZ\242\203"
+	.ascii	"\270\216d\006\021\367\032\236;\007\202\250^e2\\\344x\314\250"
+	.ascii	"n\233\rI\327\313\205s\250l \207\220\020E\353\253|\272\354\375"
+	.ascii	"\031~\374\006#\264\341c\213\216\037\245\363G\347\232#\255\361"
+	.ascii	"\270J~76\311\007\361\340\207.\373Y\202\306\0210 #\364}K\264X"
+	.ascii	"t\t\252@g.\253\r\263=\233G\003d\241 \240\234\2079r"
+	.string	"\324\351:D7\r~6\300\021;\002\3507\022\202;\331\221k \351\016\347\r&\252X0\267~\t\234\325-`t[\200F\234 \r \001\277\311\3474\205\207\f*`N\223\210L\275\371\3023\004\343o\361\234\320\001\203iAE\211\342m4\336{a\243\036\211\025\276\232\217\337\273)\312+vDS\307-\034\277Q\305\277\245\226\035\242\250\270N\326"
+	.ascii	"\020b\265\323"
+	.string	"U\315\301\277\326*r\365d\",\177\326`ep,$\t\273\006\264\240\320L\335~9Y\035\322\304\217\255\373\210\232},\ta\351V\002f\313\247\312\342\226#\030\326en\330|\023]I\205m\263\036\034I%\323[\"\347\005?\347`\341Z)hs\274\243\244I\342C\257\001/\253\035\030zXl\346gX-\022x[?\210\001Q)\326\312\022h \304V'\024\024\320B0\226\"\r\310\353+\3200D\"=v{\277(;\341\016Z\036\037\331A\t\362\f\222\300\\\363I\021\360\325.:\023\251\262\003\035\344D\365\001\022\021\036\346#\276\243\345\275\302\022%\250\003[\316^\354\020\354S\301X\257+\271\344\274m\003b\357P\255\213\2149\336\223\202Ah2\227'\\\251\372\3314\r\251\026\235_cN\363*\332\315\362\245&\331\006\325\013\201\361\232/'\005\211\273<\326\263;\250\377\331\373a\256\313\311NV\350"
+	.string	"\202zj\035\262\bu\203\023\262\256\234\327q\377\347(\017\223\310\251\025l)\016\321\341>W\006\b\206\340\240\321\r\230\021\005\3354\005$\302\304\371\003\270\250\341\031\335X\2338@\034t\221\332\274U1\276nIm*\277\356\342\032\271\007\026\312\\(\372\325NN\031\372\257\241.);y\213b\376S\032W\351p\324x\\\302\334%\256\273\024\330\321\240'=\323\336\337~\017\236aM\206\033\375k\224\031As\3123`\rh\343"
+	.string	"@n\352\347O\016\256\361\253\254\374\304l\377E<Y\357\240"
+	.string	"\022\303\307\263O\331\322G@jL\217&\351T>\373\233\345\263\324\023\347f\023i\336\032y`9JQ\232\t\240[\020\361\242\274X\024}\263\251\304\020\375\r3\337\312\345/\366R\177\221\352\007\234\270\375\305\006 \3710\232\\%DV\0273\211\345\023\357\n\344y\330\022\306\nDC\241\340\0018\267m\247\205\211\240\232\360\2163|\210mB3|\231\205\237}b\232\276\002\023\344\276\267\273z\005\237\"\214\222\\76\305\bybN'\276\016\033\0136\231\036"
+	.string	"\254\032M\020D\372\234F\365\224\273\225\345\215n3\325p\333\324\322\332L\024\322\222\004\216\353JN+\271\247n\331(O~h\314A\226\256t\205\313H\264\354gOGKY\216s\256\315\253)\261vt}P<\364D\365\320\312\357\001\320Z"
+	.ascii	"\247\350'A!\335v\266\206\017\324&\304\017o\341\263\306\024j\217"
+	.ascii	"\343\226\234\342\257\361\3009\0059 \033\306q\315(\217\007qj\266"
+	.ascii	")$\313\333\221\365\365\367\216\003\370\317\246\312\037\3708/"
+	.ascii	"\217\216\311\202(\255FBD\013\353\324w\320\304\320O~\034\211\241"
+	.ascii	"\261\275t\343D\300\274*\264\253\351\031\332\347\351\013M\345"
+	.ascii	"V\3742\226@C\353|4\360\231\240d\230\216"
+	.string	"\303\016<\251\0203\247\b8{\336\037\027\373\253\207pm\036\252B\274V\201\320\231+\213\202\272\270U\202\262\363<\263CZT_\227<f`L{\231\337\245\253\222\030\245\f\\<\336Q\027\260\031\304\\x\357G\236\004\314J \243A*\256\347V\201J\337\312\037z\241\313\375\276\302>\f\222\271rD\024\375\001\350\202 \213'f\020$\225\215P\321\bVS\330\332\264\333P\303s\232h\0067\302\344\233s?\307w\226\370\004FYO\273Y\201n6g\365o\026tg\207\234\333&w H>\272\340\0017\335'\017F\236\214\313K;\301\263\232\033\350*\245\334d\376\347\323d?\303\235\320\315\017\254\332d\036\274\211Q\027\347z\337L\021wn$\275@\202\302n3Iy\b\376\214v\361\336Z3Qs\234\177\300\027\224\267\200\034A\216=-\313q\360\277\351\331]\376\007\354D-)k(\240d\321eT\211V"
+	.ascii	"\352\035\377\031\211\334qgl\217\270\277n1\353\034\251\261\304"
+	.ascii	"OI\313\372Z\002\334d\254^+q\245\356y\006\325^\342\204\241,\345"
+	.ascii	"|o\004\226}\026$"
+	.string	"{\021\333{_\366\372\254\221(4\263\274(\312\211\016\307\354\242\312n\273\232\332\231Q\362\264\235\036$#2\306\bf\021\026\0234\200\302x\367s\276\225!\220\211\306\315*pdG\225i\312$\f\374f$D\201e\370A6\026\3611\361\345\267]\031\335o\300Y=\274\017\213\027\335\300\364\377\310\341}~Q0\201R\230\212b\277\230XZ{\207\306\re\245\323\215&\004c*'*\302\256\b\274\202\005e\361\360\247\313\2462\330\203G\264\244\214\244]\355\213\024\331#\345zt\372\220\203iA\022\211\227\017/\t\213PkPW\340\f(\207\267\231\3263\201fJ_C\327\351\316\362\305=\004\220\213\376*:\336o\225(\205\0078\037\016\217\202\323\215\f#S\326\263\306\334\302\336\030\242\025\260\356C\250Q\313\210\313\347\216\331\240\"N={\355\304\242\345\306\327\233H\275\200\266\334W{>\240\215\205N|\3344\272\374"
+	.string	"\225\376V\027\027\322\333xA^\263\220\326Y1\245\006\313X/W,b\261x\t\030mnL;\223D\f\223r\201T0,\252\313\375\243y\345)\322\004M\252\234\037\013\301\026E\353!U$\312u'V$\261\005\315\036A\n}\343\3466\216n\265\030SM\211\334#\023\327\342\007^\277\244>u\035\263\306\330\377)T\376\220*-\365\"\346\177\237`=\226\201\221_\\\253\353\022\304#\263\b\252''L\013\215k\225\343o_\352\311n\363\310\372\321T}\177\273\305\024\374\315\311c\354\036\024\"L\252H\244\376\031F\n\215\250R\035t\357\321+\007\375\264 \362N\3549\317\261\234\201\325f\341\201p\374iw\211\3010\204zh\321}\304\0263W\324\217\342\317>\365\016e\354%\355(9\215\266\315P\2517fOZ@\221"
+	.string	"\b?\255Y\205\263\331\367\315\375\221\240s\002\205\022\031\267T\344\204J\300*\031\323\317\311\027\274\350\002?\246\233!3\236%\377BI\233I\364\007\242\365\f.\266\254-%L!\333qrGV\304\326\271C\241\212\250\031\r\271\035\337\222CH\235\2672\210Xc;\206\346\005\213\243\003\275R\311N/\223\037\007\301\332z\264\325\256\0014\246{\264\2475\376\\\346\200\212\216\222\351\224\261\220qH\234X\267\034\304&%D\230\003\t\217\262\247\030 \314\036\016\213\207\216.\f\006\033\321\243\033D\320/\022\264\b\242+\345\033\235\304\330/\326\311F:\247\224\222\312P<\377\205\331\336\033\347\310[B\240\207zXT\036.\234\2277"
+	.string	"\257\227\235\243\331\tD\365\f\233\004\032\373\352A\261\242\342\347|\353\343\003\"\026\317.\356\324e\332\373xJ\030\255\212=^\233'U\372\233RA\266)\317\tR\"\322\033\351\351\034\020\036\027\177u"
+	.string	"\212\346\276#\251\245\2365\271\305\201@\326\002\260>H\020"
+	.ascii	"{\346\377!R:_\0045\2724\020\206/s\304\346\276\374\006\223n,I"
+	.ascii	"\362\250a\363\036\277\037\215\267\022dL2{\tv:\t\336\300\322G"
+	.ascii	"\262q\036\311\236\340\220\025,\034k\274\350\340Q\346\004\372"
+	.ascii	"\005\252W"
+	.ascii	"\242\343\261x\313\205\256{g)\363\216u\304\203\022\211\3300\233"
+	.ascii	"\373\342Fc\370\254\235\003\352f\007*\017\213\270\271\347\275"
+	.ascii	"\217h\tvp\373\326wS\357\277\360m\2372\366\275\207Xf\034\377\026"
+	.ascii	"\264\221\301\206\350u\326o\307\347\f\013\276\326\216\303\226"
+	.ascii	"\362\215\213\243\364\344\264\352\3732l\321|\304\034\2778\034"
+	.ascii	"\3031]bB\254A\n\311\201\274=\032|\317\370\272q.V\004\276\343"
+	.ascii	"\367\377cof\027\345\360\305\332\227\177\230z$\350c\364\371.8"
+	.ascii	"\377\234\377J\214\253vB\370\212\326\203\357[\256\352F\253\rm"
+	.ascii	"\335Lq-\335\233|R\215\255\370\225\007a\003\360\236\370\021c\243"
+	.ascii	"\353!4x4\345?"
+	.text
+	.section	.gnu.lto_.symtab.78f3fd24e22c6ab3,"e",@progbits
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\004"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\004"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\004"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\004"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\004"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004"
+	.string	""
+	.string	"pidRuntime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\004"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\004"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\004"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\004"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\004"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\004"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\005"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\005"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\005"
+	.string	""
+	.string	"filterChainAddStage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\005"
+	.string	""
+	.string	"filterChainInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\005"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\005"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\005"
+	.string	""
+	.string	"interpolatedSpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\005"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\005"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.78f3fd24e22c6ab3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
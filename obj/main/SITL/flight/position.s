@@ -0,0 +1,733 @@
+	.file	"position.c"
+	.section	.gnu.lto_.profile.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"m\005"
+	.string	"$\007\t\001"
+	.string	"\021"
+	.string	"\201\277\312\340\b\n\002"
+	.string	"\001\002\002\002\003\001\352\263\360\321\b\003\240\342\234\212\n\004\261\312\232\202\r>\002\004\005\002\005\002"
+	.string	"\002\006\002\007\002\007\002\001\002\006\b\002\b"
+	.string	"\005\002\t\005\002\007\002\n\n\005\n\013\f\r\016\017\022\350\300\306\254\005\002\023\354\206\342\366\006\002\024\347\273\234\355\f\002\025\355\314\246\334\007\026\332\322\311\233\n\027\240\342\234\212\n"
+	.string	"\031"
+	.string	"P\204\311#\f\301\204\201\273\235\306HO\004\334\201\306R\"$\346\260(\033v\206\276\370\230I\260U"
+	.string	"C\225\001\371r\024\257"
+	.ascii	"\224P\303\314[\203|\301x\271\334\0130\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375 EU\001"
+	.string	"\3009"
+	.string	"\005"
+	.string	"\002"
+	.string	"\001\003\002\001\001"
+	.string	""
+	.string	"\004\022"
+	.string	"\003\023"
+	.string	"\003\024"
+	.string	"\003"
+	.string	"\007"
+	.string	"-\031"
+	.string	"\001\226\0331{\270,\f0\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"U\004"
+	.string	"\002\007\027\"\200K\322\001\372b\306\201\330j\bA2N\227JS\bK\220\214-\212g4\t\301\204\253Cmo\271S\037\f?\277\036\273\013\037\250\037\245\207\004s\261\324\204o\rn\"\025\312\232\017\245\372\007\366\243\304\237p\367\202s>l[\3003,\323Va\277\200U\2659\bi\233x\347B\004\021"
+	.string	""
+	.ascii	")\034%\tf\034p\214J\304\204\351I\300\213\364\303.\256\"C \270"
+	.ascii	"@\002\007\250K\n\027{\223CW\346\344\322\264\006\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375 \324\225\003"
+	.string	"R\305\021\034\240'\351\377\243\330w\277\212Wu%\026<\252\252*\226\357?\024\366;M\310nR\246?\341\007/\250\372\224X(-\272\273;P3\3102\346,\016\b\256(\345\177'\204\206\322\215u\314:\370uj\200\032\";9\021\021"
+	.string	"@\004\334{3Hx\307p\266"
+	.ascii	"t^Q8\357e\023T\261\201v@\230T\321R\202X\024\303\233&\234\331"
+	.ascii	"\034\f\260"
+	.text
+	.section	.gnu.lto_.pureconst.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\004\230\004\022\204\004\023\204\004\024\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375 \250\265\002"
+	.string	"\342D\f\023\300%\303\030\377\377\377\377\356\222\275w\263C\270\033\2212\005_\203N\363\260:\323\2632SSdJ&\326\001\267\312\264\254\004\323\300jL\307\204\342 \016"
+	.ascii	"_\221\240\304\341BtE\207\022\214\0136\024\005\253\002\2712\326"
+	.ascii	"\242\312\326$\340\2365@h\033h\003"
+	.text
+	.section	.gnu.lto_.lto.c0baa172cb04575,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_positionConfig_Registry.39.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375 \240\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\266\377\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\007us\336\006uq"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\270 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/position.c"
+	.string	"\004"
+	.string	")\242\302\254\b\242.\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_pgResetTemplate_positionConfig.41.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_calculateEstimatedVario.44.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375`\320\0035\033"
+	.string	"\3463\261I\260\326M:\266\343\\\347\367\276\313\004\236\273\3510\251k.K\341\b\345;q\344\006\2677\025\352\fq\351\321\007\0075\366\207I\2240\371\350\\\210\347?\245_\303\r\361j\225\016\234\0138\332\346\303\337\254l\315nB\b\221;\245\231"
+	.string	"\215"
+	.string	"\240"
+	.string	"\300\217S\234\241\375\251\247\253\027\317q)\033f\016\307\341]\242\003\306\301\206]\234\366\220\177\343Q\206\001w7F!\232\032@\355(o\004\215RB\241Uk\035p\321\t\350\332\350\020\306\252\221\022\b\253Z\241\n\330"
+	.string	"\275\3509\355\323x\215\241\377vv\325\232\342\207U\255\265\200\t\320\2137\241m_\306g\f\231h\376X\214\030\225|G7\240\324Zi\261\313\214\027\347a\306\213\273\342D\237D\376\243\256\363t\325C\"\205\304\373$\027\324Z=}H$\356\275\355"
+	.ascii	"\266/\330!\202\341\276t\352\315\240\347\356\206[\245\326W\266"
+	.ascii	"s_6\365N\365\252\235\317d\241\333\274\3576^\374\222\274)\030"
+	.ascii	"IE3h\377zsU\330\017\353.\331\236\316\3019\324mSs\340=\273\215"
+	.ascii	"\237\346"
+	.string	"\277_\366\232\236!\247e\350t\f\235\206\241\323/t\332\205\234\216\221\323-\3444\013\235^\241\323*t\032F\247_t\332ENS\3274I\247G:-\322\351\220N/9=\311\351\353\320$D\232\030I\222\365\250UDPJ\305\022y\2648\324\037\273\262\262\254\036\210\022X\325V\020\f*\201\255\312k]\013\333\227NA.\304U\032Le\252\361\342k]It]\373\255R\213\\\272?\232b\t\0072\201\326jt\300\367\361\037\024|\246\213\256P\363k\343EraOU0h\260\314\327w\243\314\332\266\f\363\276\232}\324\251\024\027\277(Z\037\226g\335Rle\326\263|\002\013r_\215\263\215\355\245\036\306`\262r\261\002\350D\266<D\244\251(&\306\235\355\263\312!\342\206;\356K 4+\356x\244\324*\252\272\023\022\265V\0130\252\265Hg7\356\331\021\352\321\325p\264\237\034\016\227\343\231\371\330 "
+	.string	"\341t\025|l\033H\033\356\346\340\202\250\363a\220\013\252Y \315\263\363\223\273\351nB9 \232\256'\303\315\007\003\355\347V\303\321x\202\204h;5\316\001\331\202h\272\\.\210\006\373\025=\374.\345\354M\321\366\334\2629\033\345\241V\226my0\210\263,\373)\361\273\321\006g[\200;\260f\326f\237u4ef\306\254\375 \302x\337\314\002"
+	.string	"\326\3002Z\236c\266\310u\370\230\300\254\312\306,)\244<\361\262+\013\263\262,\227u\325k\235/K\223U6\365\\\353\262\263\255\322\251&D\2501$\343\220b\n\252\221@Dd\244\205I\007`\242Q\316\310\016\021\020\262\2422\311\260\277\001_\030@\206\222p4\326>\313\356\n\371\253\375M\323V\350T\272\200\373\\\234\260c\326)\204\206\013\346\207\0177h'\342\214#6\223\030\311I\016.\205\320\013\no\231\263\270\365\270\273\257\347+<\204\302\203@;ux\266\304\224X\323=\276q\214\034\321\266\300\262\221\224^\340\366\305`+c\031\334K`\033\306\256)r\016\256\036\0211&\022\253_x\230`\001\277\f\027"
+	.ascii	"\376\336\032Q\372\262_\032"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.46.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375`\362\017\035L"
+	.string	":}\034\034@0\242N\007\033\254\324\031\002\021T\305\301O\376\001H\024I\177\215:\225\340\350iAr\237\355\311\t\022\037x\357\003\324;B(\202EdP\204\317M\267\303\214"
+	.string	""
+	.string	""
+	.string	"fh\210\bm\262\273%\231d\266\001\220\001\255\001I\255]k\017\243\265\322}\213\3779\240{q0N\350\263V\026\316x\321\326^0\320\276\3048\266\322\030$\234\022\343\375R\343\251V\024\253Q\013\247\304q\334\302\273x \354\2026\3368\314+S\257\211q\034\217x\275-\332\\\364\374T\263\306P\024\300\245\321\343\340'\005g\250\227\245\302k \001\354\326\033O4k\374\303"
+	.string	"\234\035=Bql\r\340\255n\360\372\326\332\365|\017v\276\034\032\031\307K\324\204\211c\353"
+	.string	"-\340\365\366\351J\256\267FGr\275\325\260\326{\334:\027\373\037\236\fH(\216\343\256\227s\330\267\264"
+	.ascii	"da]YUQ=\247\244\234QPONMLKJIHGFEM&\321R\231D\276G\2675\376\206"
+	.ascii	"\265\243\371\326\325\265\256i6\200\331\263\346\302\215E\350W"
+	.ascii	"\204\203\333"
+	.string	"\n\214W\201\371\262\251\236^\246\214\007t\020z\363\303\265>\343RQ\226\343wk\202[\312\013\337v\266^\354\242\366\240\214\\ql\204\370\341Z\236Q\t\0165\217\337\255\351\355\247=-\333\351\350eL|\342\305\233\230\262\370R\235\224\255\204\027e'\341A\331HGN\266\321\023\272]D\203\316P\017\273\004\310\023o\316!\331\314\271\270Mt\364Z\002\004\316\227o\256|;\262\223wkF6\362p\r\316m\277TK\200\264\3711\311&\304]%\233l|\306q\354\263o\037l\321\335zZ\233\033\215\\\211b\0041\331\324\214J?\244H\225l:\366\033\247\230 \3012\331\240\306\347\032C\331g\247\272[\273\356}\364\212\343Xo)\033\020\327\\\256\365\346\243\265\276\2415\021\216\356\227\370a\307\r\255e\345 \277\252\231\324<\362|t\277\341\272T6\362l\364\253o\375T\031\007\217<\037\037\374\221J(\317\306"
+	.string	"~\365\323\366\331\376\212\276$\257sk\r\206a\273\364\3013\005\2429>m\2555l\330.\325\314@2[\325\302\330\375\352\325\377\313\230\266\326\035>l\227\3767e1\206\320G\323c\300\274\241\265_u\017\263h\027h\374\252\276\341\356O\361w'i\033]\204\2535\t\023\333\245\373W\344%b\023\325\036M#\3703\355\2269\3307WT\222\r\374\257\376\311\371\f7\3017\371\240\376\265Q\333\212\332\037\301'\370=':\005\352c\234L\016\355P\264\331\211\355Ro\265\237p\275\365W\323c1n\257-mg\265\266B\367W\265\366\317f\263Y\375L\264\276"
+	.ascii	"\306\334z\302\227\227\204\007\311\255\031$\267^\340\205\256\023"
+	.ascii	"8\237;\002\267\372\271\336\322r.\256\001\270\240\353,\377\342"
+	.ascii	"\032\313\007]_5\267\266jn]\325\334\232\252\271\365s\271\365\024"
+	.ascii	"sk\251\344\326\316\346\326Q\311\255\241\222[?5\267vZn\335\304"
+	.ascii	"\334\232\211\271\365\022sk%\346\326I\314\255\221\230[\037%\267"
+	.ascii	"6\332[\027-\267n.\267f\356\255\211\366\326\313\344\326J\242\255"
+	.ascii	"\223D[#\227[\277\312\255\217\311\255\335\275u\273\267\376\275"
+	.ascii	"\365Fn\355 L$!\324\007\nM\034\377\310.\306\206\355\230:\267\272"
+	.ascii	"\373\271sq\027t\377\342>\350^\350\357>nw\007\255\321/\240\343"
+	.ascii	"K*\342\372\255/\372\020N\352\310m"
+	.string	"\315\307\372\013;\232\377~e\230\177\365`\357\213[f\276sH\222\270=\244\253\2169\013 \002\202\352\002\035\021=\205;P\242\027\200\330&\317\033<F_\325X9%\177\342 \252m\305\274k\337\231\242\257\276q\355\330\215v\274+\314\002\b+;\006S\017\t\261W\257}\321\r\325\220\001S\251\256\267\255\037B\274\266\264\346\362w\023\307\272\342\215*,'\347z\273\374\fB\3440\277\252]j\233\253+\241Yy^\372\033w\251m\344\031\351W\347\372\251\033g\315\037O\002\366\220\347\345\204\177\221\307\207\364?\256\365\323#\365*\317\257\017r\345\237!y^z\275\003\"H\3556\334\254\237\276\001<\t-$\317K\t\177\244\026\31232\200c\375T\2163x\017\335\235\256\362\031\004\202\373\350((\177\017^\211\276\252\225\200RyV~Y\210\263F\236\223zv\267A:\022\262\331CjS\255\365\354t\250\270Y\215"
+	.ascii	"~\302{\030\007K\234\343\023\005\004]&\377\353w \371\020\362\265"
+	.ascii	"\030\027\324L\2658N\263J\276G\325\274\217\374\017\024M<\376\373"
+	.ascii	"\3766\207F>\244\204\243\270\307/{\342|\340(\357\236\343\007\020"
+	.ascii	"\302$n\217/\r\217\347\261\001\327\301v\260\235\353\255\327\267"
+	.ascii	"p\016a\2518b\r)\255a+n\007\306\0225\027\307\261\002:^\007\306"
+	.ascii	"\323\016\305[\r\347\301{\360\236\353\255\204o\321\fa\371\"\b"
+	.ascii	"\366\371I:\335\005\357\263#\005mw\272\356/x\275\34568~\b\367"
+	.ascii	"}Q\240\340z\033a0\304<\254hS\034[\270+\302\302\310:\234\225\205"
+	.ascii	"\2010#k\261<3\233Q\346\301\214\254\305{\366\342k\254\f\305\004"
+	.ascii	"\345\331\213/32\2600\032(\\$\315>\204\301\020\363p\026#\254\254"
+	.ascii	"l\206\n\"\255\202@\2141\26131\2631\262\2563\027-\304^\260\350"
+	.ascii	"\212!\206\002F\227\2122\263.\002N=F\026V\326u66V\326\245\264"
+	.ascii	"\246\2711\366J{\250q\313\212\300\316\323\222\305\352\025 \266"
+	.ascii	"i\025\241\002\250\372*\373\212\025m\306\255\312*\204E5`\337\331"
+	.ascii	"Q]9q\347;\021\031\364\207\250\266\025\255\236\257\265\026\260"
+	.ascii	"\353lt\331\211\343\230\201\336Q\266\024X\336\001O\247\356\324"
+	.ascii	"?\337\325#\037\222\372\251?\002F\335\314Z/\365M\201\242wP3\323"
+	.ascii	"\300.U_\325L\207\373\\\347\263\370C\204\263\351\340\276\036\024"
+	.ascii	"\234\337\372\355\301\023\244\212\222\213z\347\024\016\214\t\035"
+	.ascii	"<,\2773lO\250_\322)\020\247P:\345P\357~\224$\201z\004t|U\366"
+	.ascii	"\210HM\021\251\323\213v\024\2378\263\342\322\344\274\035\307"
+	.ascii	"\274\301FH\004t\022\345\303\237~\311\367\207\b\201\220\0254\250"
+	.ascii	"\375\364\276\307\255\355\351\273\020\237\270~jH\241\277;NN\257"
+	.ascii	"\035\317&b\343\007l\367\200\013v\202\007{\255\341 \360\220\355"
+	.ascii	"R\247wJ\261\206:\036\255\351B\220\315\306\255\215\251\351\331"
+	.ascii	"j\024q\251\037\246oz"
+	.string	"#a\324\315\322#=\323\273z\242qJ\237\364KwP={\274\225\276iNt\n\330'\375\321P4Q\353\217\036\351=zw\341\217\336\2538\031\024M\\\212\032\202E\351\210k\364[\312\237\333\356\001\037y\343XM\201\336\323\315\003\206C\002+Q\342z\201B\250\2014$\221#C3\"\"\222$)\244\003q\005\204 F!4\017\022 \304-I\204\316\025q\322\376o(\034\263\232\224p\2472;)WJb=\206l\234An\210\201\336\304\312D\365x\002\221}\f\273\377[9$\274\226\327J\354\tf\372\003Sa\007\200k4T\355A\022<\245\307\237\202\313\206-\220\343\020\f\\Y\347\007\344\304\335Z\365xl6]\320\221\177\253\007\241\244\327\342\311Y\241\363\355\226\300m\260\332\270\003Ap\241\370v\367\230\302\306\026\300\251@\365\240B\255\037-{\352\020\253.\304\311\360W\017k\036L\373p\257\253<"
+	.string	"X"
+	.string	"\327K8"
+	.ascii	"\364\241@\231\356"
+	.string	"\221b \020\016or\271A1\242\360G\035\023\357\\~\242|\317\005\311\231\325q\2115\320V\367\2411\367\327\274\264\025\276\231\037YQ'\213\247\250fH\034S\267RUs\306\2648xJt\231\023\363\315\353a\327\317\323\365\035\352y\354\231\235\274h\304\310\336\211\210\325Q\264\032\013\300\337?\tb\"\211N"
+	.string	"*p\370\372\245\211'RZ\254\024"
+	.ascii	"t\273$a\001\250yW\304\371u\301\306L\305~\230\310:@\216%\320~"
+	.ascii	"\302#8t\2207l\375\200\315B-\355M\344\326y}\220\321\240\373w\237"
+	.ascii	"2g\354\021q 7\320\016\367\177\022\023 \253\207\271\263\231\330"
+	.ascii	"\343\327\332\030zK\254\263AX\260E:\305\"\021xg\246\300\271A\205"
+	.ascii	"\255\364\037\256\316ko\004\353u\036\301'\277\005@\024\345oG\013"
+	.ascii	"A\3100&|\242Nl1C\321\252\261>\363\004+\344\0329!\323\210`\013"
+	.ascii	")\3719\253\222x\267>\323,F\336pDc\332\210\262\314\264\b@\027"
+	.ascii	"\355n@\220Z\243Y=\355&\t\032\324Y~\365Q\217\317\322\217\210\303"
+	.ascii	"\250\327\236tD\3044T\021\225RE\253\314\\\245\226)\220\006\237"
+	.ascii	"\007a\361\003\2716|\033\022\264=\336\313\\^\374\\\262\204\340"
+	.ascii	"\035\215#G\340\303)R\003\342\032\023\211\347(\002H\2133\311\005"
+	.ascii	"t\006\357w\360I\177\211S\n\2443\"\354#pH\022\276\231t\316W\361"
+	.ascii	"\331\247 \031\224\342\244\316!9\003\333\275wI\243\236\"\222F"
+	.ascii	"\256\020\203\206\267\320?\300\315}\037\3644?v\305y\3443T\026"
+	.ascii	"\335\025\320\331\226H\361yq\326\304\020/\220wj5\210\327\"\035"
+	.ascii	"6\224\250\001"
+	.text
+	.section	.gnu.lto_isAltitudeOffset.47.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375 \350}\006"
+	.string	"\"L-3Pm\222\016\244DX\250\344\253h\326\005\030\200\b2\302\323Z\376-l\351\377\273\035\346\332\236\306y6\213\343ff\212D\334\0337\027@\341\332\250\355\223-S[\250\313\253\256*\3630\356rh\250\036\030\334\245R\200p\026+\343\250\201\037f\301r\327{\226\233\262l\013a#\3504\211\257G?\260\233q\204\006\353\251t5"
+	.string	"\225\260\tXtp\364\031\007\233\350[\311\026\372ql\223\b\te\222\371\031\245\344\210\024\262\361o~\372"
+	.string	"a3\326\f\343SQ\311\004\bJf\346\332E\261\"v\333\321\n\207\306\211\007\304)\006$d\346\350\001U\364\326\277\3407\370)\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getEstimatedAltitudeCm.48.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\002M/3`m\322\001(\033\004\242fj@\212\034\035%\326_*\266WNY!\232E\275\303#)\364\272\024<Z"
+	.string	""
+	.string	"\212@WoE\237#\"\207\221\354-eJ\001\256P,o\252&\314\273h\305\26005(\250eBp\320\n\205Q\n\201\337%\201\322\352=J\245l\237\035\314\t'!\354w<\263|\f?d\360\327\235\237\211\3560\003(8\030\262\263\r\246\307~\333\354\330FcJ \021\005\331\225\b\225l\210\373\370\330\326\330\222\257\361\r\215\255\226]`\221\007\024\341A\262\273:\371@t\327.\020\335\245\305\255\243\345\237\343-\3433ra\233#\300\301\356\032/l\342\316\333.\260m`\273\"\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getEstimatedVario.49.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"BM04`m\322\001@\203"
+	.string	"'\340\031\272\374\265\021\260d\377t\206\263\031`)\323\232\265\036:I\241\327\245Cp\005"
+	.string	"\240\2308\237[\242Y#\267f\265\275\211\224)\005\316`4\360U\217\0037\256zpx\020\rN\363\026\"\\\206\3428L\201\341\206\201r\025\204\224\273\\{\025\245\032\200t\302\376\310\257\350{X\242\223\267\316\374N;K\005\320"
+	.string	"e\311\276>\251\034\366\247\335]\253\310v:5 #%\241d\327\242\264\262(\314\344\303\266\307\276\370 \017\3618\346\325q\321F\025\024$*\273\353\004N\320\316\362\003\355LG\217\317\350_\344\023\211tb\205>O\213\302\356:\255\020\306\255\267}`\033\301\366F\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375`D\001\335\t"
+	.string	"\244\016@\002"
+	.string	""
+	.string	""
+	.string	"\002,\177\025\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\0052\026\200\204\001"
+	.string	""
+	.string	"\003\0056\027 "
+	.string	""
+	.string	""
+	.string	"\0054\030\002.\177\031\377\377\377\377\0037\032<\033=\034>\035?\036-\037\005\300"
+	.string	" \301"
+	.string	"!$\"\201"
+	.string	"\005*#\200\003\005+$\302"
+	.string	"%\303"
+	.string	"&\002/\177'\0020\177(1\177)\005)*\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005'+gistry"
+	.string	""
+	.string	"\005%,\0013\177-\037"
+	.string	""
+	.string	"\200\200\200\0015\177.8\177/;\1770:\17719\1772\003"
+	.string	"\030\344\006\003"
+	.string	"\031\204\016\304\016\003\004\032\307\377\241\372\001\001\244\001\003\004\035\201\234\313\322"
+	.string	"\001\344\001\003\004\034\200\316\245)\001\244\006\003\004\033\304\006\007\003\004"
+	.string	"\362\277\310>\001\302\037\003\004"
+	.string	"\221\326\302%\001\342f"
+	.string	"# \300\0021\333v-\213\333\265\227kl\016\215\3400\326Cp"
+	.ascii	"\207\301\341\003\202\303\245\bD\230\206%\330@B\036\276\274\215"
+	.ascii	"\323n\357\313\271\022\231\260\241\020\203$\232fv\230G3\223\344"
+	.ascii	"\301:,ix'\370\305\236a\032t\316\023\332\300\343\001"
+	.text
+	.section	.gnu.lto_.refs.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375 \277u\004"
+	.string	"\262\312\037(pM2\214\001\360\007\310\363\245\250\252\252\252\252\252\252\252.\267\376\222g\302\\hD\255Eh\023B\272Qk\215\020\262e\n\007\322%A\211\200\271\325\262\213Vv*e\177x\254wpl\bl\215\200g`\\@\267X\273\"\332\024\320\022k#\242\205\210\366\001\332\341\271a2\203\332\005\265\202\332\204g\021&{\2406"
+	.ascii	"\330\022\271\"\231\022yAn\234\235\263)xav1?i\311v\333\371D\005"
+	.ascii	"\004\0012\013\\\024\007L\227\031\005"
+	.text
+	.section	.gnu.lto_.decls.c0baa172cb04575,"e",@progbits
+	.string	"(\265/\375`\213\035\235\221"
+	.string	":\363\2045P \222BJ\007\027\bo+\254\n\252h\013\256\340\302\322\006/=\0079\3363x\207\245\027\357Z\260\227\237O\376c\264\303"
+	.ascii	"\025y\264\206\372>h5\263U\346\300\003\324\212\210\210\210hF!"
+	.ascii	"j%?\232\206ff\345\002qK:=\230"
+	.string	"\255dK\231\002\313\002N\003l\003|f\235h\351\215\247\234\271!-\2737,D(#Y\254\256\201\304L\274tQk\3646G\032\325\311\226\342g+\371\356\234\207\313\216\362\020ka}\215\256R\253\255\213\315\264\222\205`;\"\245\363Z\365\264\330~\244\251\273\367\n\221\t\243#\222\242\357:\351{M\372nKy\017\363\341\347\325\270\317\271\216\315\034H\351\274c\367\336\"fb&\311\244\321\267Z\212C\357\356\356\356\216\257\306{\213IQ0\251P\223\245\357\257\364\335C\372V\222\276\233\251\021\217\250c@\221\323\007\025\022:ICB\300IUi\364g9\216\013\242Cs\2254\363\002g\016M\032Nc3s\246M\255\214[\227\265\2656\354\206\3470\033\006\202\341p\034\226\303ox\r\303\361\223\343\330\355\254\206\337\336\316{\225\367\336\267hC#f\f\247\251)\333\302dD\366\336\"q\272\260da2~\303\302"
+	.string	"L\016\207q\034\243\361\031\277-\331 \354\315\334\275\316O\360/\375\022L\300q\314\306i&\244\356-BD\200\261\261*4u\367:S \245\340e\271\265\311\203\204~\216I\360\210\230MzVK\317d\351\271Jz^\222\"\375HO0\2164\211\314\320\020_C\360i\364\234L_LY\324\220\362\027\006\303O\024\034\346\314\205\273\374'\312y\235\335\304\216\313\263\321\303\220\236Q\360\354\335\035\243\340\275\204\324\210I\360\032M\203\364oL\202\307N\326\302O\003x\354\022Lp\233\024\273a\367:\213P\037mI\2364\372\027\351"
+	.ascii	"Yw\202\033\245g\003x|\307\006\360\336\351\3370\t\336\317W~\266"
+	.ascii	"\302a(\354r\252y\315\356u\036\245J2^\302\032\275\223I\360R\036"
+	.ascii	"\301[SC\377>k\361\246\346\347\030D\374\017\343\3663\377\\\364"
+	.ascii	"\363\317\317$\264\375'\303\374Y\310\366\363\226\265\237\233\322"
+	.ascii	"\374,\206\346\3473\377\221T0\361\037\305\007\317\340o\251\237"
+	.ascii	"\315\224\371/G\355g\257\264\237\311\374\227\341\277\003oa\314"
+	.ascii	"\007\370[\3703\001?\337\377\375[\373\263\222\237\233\374\314"
+	.ascii	"\365\363\222\237\221\374\274\3653\223\237\235|\371\331\352g\255"
+	.ascii	"\237\263\274\3747\372m\227\237\315~&\373\371\371s\226\237\247"
+	.ascii	"\374\334\365\363\223\237\223??\375l\303\317\301\237\231~\226"
+	.ascii	"\361s\r?\317\360\263\f?\303\360s\013?\257\360s\n?\237\360s\t"
+	.ascii	"?\207\360\363\007?s\360s\006?[\3603\005?\273\370Y\201\237\023"
+	.ascii	"\3709\200\377(\374\034\301\317\020\374\234\342\347\007\376\367"
+	.ascii	"\371\031\305\317\013\374\\\300\317\002\374|\364\263\321\177:"
+	.ascii	"\377\345\376\237\360\177\316\377\260\3771\376\267\370\277\366"
+	.ascii	"?\275\273\273\273\373\373\314\317\263?\211fu\306T)\312\363\003"
+	.ascii	"\221&Z\300<\033Lg\251\300w\231\243\206\225\271\033[gW\\\\\316"
+	.ascii	"\317\346\322^P\261\233$\";\373\221\006\b\007\234\0230\215vi,"
+	.ascii	"<l\360\260\322\363\254\266\360\263\267p\032R3Iw\"KW\2351u\367"
+	.ascii	"\236Q\361s\366\374\021\005.}\213q\217\2115YsiY\231\273L\247\212"
+	.ascii	"\377\230I\377S\226\236\233\213\227%KkI\357\275HT\230B\314\032"
+	.ascii	"P\2368\337ZN\207(LmN\b.\237\032W]\223\364\r\306\035v\345g\350"
+	.ascii	"5\2735\304\222\242t\301\245\325\375(I\377s$\375\331\002\334\246"
+	.ascii	"\007\007\234\257\363\263\277\332I\213\335\344J\347\212Yw/\226"
+	.ascii	"\n!0*G\252\032\375O\216\364*\270\177\230\322T\330.M2S/RSs\227"
+	.ascii	"yU\034\035\"=:\227\276\241t\327;\312\337Q\332\213\261n\322\016"
+	.ascii	"\003Q\232piu\027\013+\251\237SS^R\336^YB&h@\242\244\256\321\366"
+	.ascii	"\201\355zz\334\310\030i\364x\272\311\177 \236[U\237=`\351\337"
+	.ascii	"?\357F1\357\275W?\316\313\224\022:\3770'\375ClY\201kW\347M\226"
+	.ascii	"\271\271\223J9\213\022\362\023\367?o\367*\263\222\033dY)\263"
+	.ascii	"~,\307\262nR\371$y\304\274Y\311\345\330\275GW\251L"
+	.string	"z\320\274G\313\261kuk\260\261\342\353\314J^e\363\036]\345\215:\261TfY-\307\242\254\216\226cYVw,\353\032]e\024\023\207\3622\217\356X\226\235;\326\2642Z\2165\255\226cYX\374\265l\303\303\212\314\215V\016\026\263T^\035TC\242\230FoKg\363\276\271\227\315l\\\246\002\367\016i2\337D\375`4\2517\035R_\242\232\\\202JJ\253y\225oK\257\346\275^RN\227\312E\322\371v\231\360[\022\311\220;e\343^\002\250\356M\362}\273\367&\357\275=\346\020\347\275A\214\226]TT\367b!Q\335!I16\356m\2638hV\3131\255\346\222\230\262\261\256{\303\231\344\256\373&\213\231\216%\265\334\251 \322.\253\035t\215:\235AhE\270\360h\264{\020R\233C\346\326\350Q\251T\t\020\\\020D\314\032er\205\242|\204Y\263'\355$\275\305\317\244V\342\034\013"
+	.string	"\213\212\016;\3519\211W\224\204Dk\006\026\026\226F\337Z\235\305\315;"
+	.string	"\321\016\262*A\032m#\335\344g\211>B\267D\312\nN\252\303\275\\\202\307ww\\\202\327D\226\336EF\360\230X\316k\206A\023$`\215\332\036\022\204wF\b\260\272 \215\305iDI\347\255\272"
+	.string	"\254\310\017uB\370\331A\032\b;\357M\2014\344\206\366d\016Eo\301\322\333\256\037=\254\224\3212k\264{t\363h\037\357\036\275CH\331=\320{\243\230\023 bN\340G\315I\324\223\207\336r\245\177_\225\350Q\021cd\253\255\232\252\267\247\212\033\224F\337\242\251XO\333\260Z\230$\264\2013\027\304\2342<q\246\232\207\256\352\034\255\243\231\374l\252\276\361^6\216\243M\305v8\315:\273z[\264\350\314\361\034\035\237\021E\031]\245\224\\\327[S\361\235H\351\275\362\0042W\203\353\271e\315~\330x=\3512FF\326qxZXW\314T\371\245L\363\211\026-\366\311b\267*"
+	.ascii	"1\267\316\030\013\206\003\316\210\025\273}\366\300C\366\206%"
+	.ascii	"h\213\312\355\025*6\013\343a\347\305j&\351\0320\202\206\n[\335"
+	.ascii	"]\016I\nn\031a\303r\233\205\215wG\206\226u\306S\302|ui\324Z\271"
+	.ascii	"\r\213\003bM\214Nj\277n\301\204\354\220\343\005\247\312\017$"
+	.ascii	"\264\204\315\215\256Mz\021l\351}\260>\330)H\315\244\035\006\276"
+	.ascii	"\326\374p\225$\302L\017j\272\254\327\355\224VN\261\222k\324J"
+	.ascii	"\341U9\351\346\330\016\216\327\221\033R\272~\333\325klt\245\332"
+	.ascii	"\324\241q\227\026)j\214X\251\333)~Z)\373\304.\261\356\216\024"
+	.ascii	"rhBW\322pei\324\211S\331\213\212\203C\323\350E\\\245\3470\246"
+	.ascii	"\275\3022g\207\234\037\026\310\017jxX\253\2608\266j\313\n\261"
+	.ascii	"Z\374\206et\225a\352\346\272\330-\353\203\323\336,\261=\330&"
+	.ascii	"\226\211Mb\225X.~\332-\033\344\226\312\3528\222\335\262=\212"
+	.ascii	"\356X\331\362\303\be^\316\204\324R\004,t\262,\022~Z\255#9\265"
+	.ascii	"\354\020{\304\204\324\362\242dk\240\3649S\""
+	.ascii	"\305\020\235\2337BxG\232D_\234J\202h\324\032\351a\375X\253AG"
+	.ascii	"\204\237\266H\212\247\212\030>\227\0132\303\245U'=\020\234\364"
+	.ascii	"@l"
+	.string	"\026+\005b\216\210[\231\364@c\322\003yI\017T\226\036\bKz\240\257\364\267W\326\352g,\315\0357+N\3536mSRS\322\023<\202\327I<\202gqX\036\212\300\320\266\274\344@\201K\215\227FQ\273\3545(]T7\210\336<\341\242\305\306\217\227\273;@\032\2655R\033@JP\210 \022\306\210\220Fok\374=\307Xr\270\263\323\323(\347Y\272U\006\271\225\231\313R\225\236\277\270\353\334\336:6\331Z\234UDTsCT\360l4\313\320\032M\343D\262D\242\320\365\351!\372\356\007\002\"3\325f\310\215\364m'b\t\033'S\032\355\336\363\346\023\306Tri\364@Q\351\273\256\205\370\201\254\035\033\031\034{\322\267\236\035\344\034\371j\264\363\2446R9(\200\342\210\311u\236\306S\303\275\312\236\022\202U\247\321\016\242\357\274\3614\335m<.\232\367F5\236\242>\367F\0251'\300\234"
+	.string	"\n\246\005\245\013\017}\n\227\366\334\322\333NC1[[kt(\335\222\316\231\323r\"\030]\251\270eWO\316\324\225\033\222rEO\331\0248p:\016"
+	.string	"]\275\262${\346xU>\236\364\211\303v\274\032X\226|\025I\341\340:N\204"
+	.ascii	"\332\234m\307\312\023<\307\363\216\353\036@Q\244hMQ\271y\266"
+	.ascii	"\233\326\372\217\362\"\251\3225\024\005\214L\252\321\2477\330"
+	.ascii	"\260\211c\336\201\241vu\340\230\264I\337n\334oo\235\325FW)\265"
+	.ascii	"\354J\313\342\265\361\263\333\330N\004\017\320\370\3149\321\240"
+	.ascii	"\351\265\024ThX*P#H\330\3164\232\006\2117\204\022(c\215\276\007"
+	.ascii	"%}\017H\0313lw\342JWo*=\317\216L\032\333E]\261\240\342"
+	.string	"\344\325I\317S\223\276{p\213\021\323=\220n\322\016\213)spiu<0gg\026\316\rD\341\357\b\244\256E\344\b%\324!\220\006\214\243\f\341\360\007\343\351Xl:\252\306\002`\220\350\r\207? r\025\312P\202\"\006#\300\001\212(\034F\340\342\205\357E\0058(\251LPC Q\250tDB))\335P<:\255Eb\257\351\247\016\321\025I,\002\177\232V\242\3608\3449\255\277'%b\361\351\251\b$\200\211\370\223\301\364S=\24014\032\177C4\214E\030#V\243R\3208\002H\204\002aU\221A\304\246\376A\372\204V\0371h\374!\006\215\326i\r\022\325!O\315A\210D{4\214E z\\\215\366C4\216+R\030TY\360\r\300\244\022\203\302\341\257\307\244\"\241P\240\212\354\375\267\376\230\216\276\240q\005\321\361\347\004D}\306'\265\205UE\252,\004\215\007\034=\301X\325\240"
+	.string	"H\241\321\317\235V(1\r\205P2J\250L\305\023\202P2T& \242'\030\352\210\225\204\020\013\2441H4\264\264b\035r\260\2521V\025\331\324\224\302\357(H\024>\035\177A1\236`\020G\030\376\200\302\365\250\316\360\305P!\004\001V\240\217\buT\0026!\203\277!\b\352\372[\221\"\210$X\321\002\022\252(\234\241\036\215F*\023\324*\\\207\034\0200Tg\330\026+\206\352\214\237'uE\322\210!@\220\213\025\353\220\203\342\361\327\301\212\374\r\207\016,\n\217\277\027\230\324\365\367$\\\221\037\250\353o\b\005\034\376\200\003\034(<\252D5\230\336\305\213\b^T\200C\357\025\\\300\342\002\026\274Wp\301\322\322\005/\226\322\277X\262\353\352C\272\240>\t\327\364N\006\030\251\300#T1\306:\374\001\r\213\305\016|?H\337o\375y"
+	.ascii	"5,\306@\032\203G\353\235V \215A\245\2420\200'\030\353\360\367"
+	.ascii	"\203\364\375\200E\023\220\306\340\320\372\033\332\325'A\213\225"
+	.ascii	"(\354\021\213C\3534\034Z\246\026\310\036\223\252\032c\004\251"
+	.ascii	"\310#T\021\006\023\021\252x\f\n\031\213LN\350\372\213\361\004"
+	.ascii	"E\344\335i\205\022\362XD\022U$\002/\032\325\243\322Z,\036\225"
+	.ascii	"\202\220\276\240\260\211X\204qTW\365\351H5\322X\221P2\212\210"
+	.ascii	"H\240OhD\252@\341\f\225\251\b\211T\217LL?\037P\002\241\221z\374"
+	.ascii	"\335\300t\3749\255\276\nz+\021\252\b\364\251C\343\323\017y\324"
+	.ascii	"d\034\372T\244\260H$Z}/\226V\242\020*\035\2523|M\300 `Q\025Z"
+	.ascii	"}\301_\013Ea\357KK0N\270\200B\b)p\005\261(\\\205\310\242Qiu\n"
+	.ascii	"\n\207MJD\341\357I\txD*\2550\021\374\255\276\343\020\210\203"
+	.ascii	"\257x\374\311\030Z\323^ir\344\274\032%\343\f\253\252j\322T\223"
+	.ascii	"\205&\211\022\306\212[{!\"\262\374\321\244-\016o\212\314\025"
+	.ascii	"*lf(\027 K\264\326"
+	.string	"\342:\240\233J\222\346Y\364\246\231d\312\242i.6\261>e\234\326kK\02583Yzeua\256\312\264\023tG\031\220)\265)@aqa\230ivPt@\301\323\250\rc\303\3301\314d\322A`\006\213G\322o\305\334\216Q\373\2611\347\016\233F-\332\325R>\\\262\270i\324\236]\355knZF\324\320\036b\254\264\355\001\323k\351\034:\367\331_\222B|\336\320q\323h\227.\035\307Z<\004\311]\033ro[\376-\326,\202b\2502\3714\007\342\224R\312\320\314\310\2104IsR\n\020\204\203a\240\311\351\r\022\240e5Q*\250F\222\244P\3309\232\032\260\027H{\315\372\334q\314\326\372\030\345{\205\267\001\236P7]\246\0238\325\017\343\032\261s\"\250\263\203\203\030\2460\3154\325\367\300\276)\206,\204\3004\b\345\017Y\271\271\207\343\330\364\317+\336,|8\007]*Yn0\341"
+	.string	"\264zN\332R~H\357\255\177mJ\240~)>p& \365\303\377\210\330\217\270FQ\372\002\fBN\t\245Hw\3223\341\234\217\307\372\034c\220>\337\005\375\331\007\201\026\034U\372\340xZ\023\327\037s\351\204S\310\316\006&mW\244\245$q\220\365\316\235r\322\005,\370\316&SR\273\006\334tB\023\306\260\b\203\033\243E\265;\237NA\347\246\223\215\363\243\214\005\340\202\364\252\326\317\332H\020\027\360\nF\267\341%\365\022\306\r\335\374\004\364\377\270\3518#\364\030rm\243\372>p{Ho\246\353ZnsM\307\017\342?\310\216\200\377"
+	.string	"\371\024\324\246\"\r0\276H\241E\271S\2446\325\246\221\360\246\227EO\342\335\272P\336\250"
+	.string	"\371\216\356a\256\r\241C\361\226K\234\022\260\037:\252\202\362\327\202\240\310\243\351y~(\324/\227\347\244\220\236\206\272X\201\004)\263\323\270\215\177%<\376~L\273~`\260\202\276\204N\224vO\022\36286\245\027N\306z\004\025\356\251\001NR\035\205!\036\232\311\344\371\314*o\221@\325\223R\234\270N\351\t\206\315"
+	.string	"\317\275\003\036\257c\253\2023\333R\360\367\320\0016z$\005\t\207&\226'\270O\250\311\nw\257~\027\242\034\254\350\253\223\325"
+	.string	"#\307\256\007B>\2126\021\200\332\250\320T\320\315J\302)7\335\311\306o\005\2020W;,\274\365\024\322\305ay\304Q?\362=\374\bl\3071\224X\005V1\224w9\215L5V\242b\231\020\371\264\225\347\021\\kn\306\273:\376%eg\177\364\353h\323Y\231\336\033\2505"
+	.ascii	"\347J-\\\255\032\347\255\321"
+	.ascii	"qZ\267\211\374@_\223zl\331\n\344\222\333\025\3421\277\343M\311"
+	.ascii	"\245\034Z2\371\bm1ExM-,R]\"\036O\360\025\241\274\317\312+\357"
+	.ascii	"\370\035\003\243\301\316i\004\021\301\265\320\311\357\361Ig\365"
+	.ascii	"\003!\241\340\007\n\307A\377Z,\031\377\217\306Y,i\375?\373\033"
+	.ascii	"\\\007"
+	.string	"\316\356\214\352TLw\024<\322h\231*I\204;\231\2157\353r\314\213&\360\032\235 \t\256\251\212\276Ad\365\024\333\245\027W\276\375\272\363Wq\312?9m\220\026\243\207'\006\351\217\254\206\037z{6\327Q\036\374\253c:\351\246VE\225k\270\302\252\031v\321\273\001\202\026\265\321\343k\244\360k\375\344P\2160[\207GZ\257\321\001j\324a\346\307?L\350\023|\316\205\321\210\241\341\265\303\214G\307sQ\035^\377\354\367\362\306x\215\372\216U\206\272`v\325\333\371\027\244\244\345Q\355\272 \363\354\253X\235\327\031\354\334\220\273\3024=\b\353\\\021\333iW\006k\346\017E\341[\224\240\261\270#\254<'\264%\303A\013\330\224\324\215\237\244\2560\r8{\007\004\017J\2251pi\333\224.\350\211\307{\035pZb\364\354*\346_\341\307Pn'\006J\233\226\364\341H\t\365;~\212\253=!?iJ"
+	.string	"m\034+\305\374\211\246\254\312f\215`\207T\246<0\202F\301\307\266/A~@\327U\027\016@`d'\301\2507\203/\243#Ts \267\035\363c\n\303K\211\365\024\214\355\233jN\206`\341\021\230\364\bo1\210"
+	.string	"`Q&\201\317\340\302+j6\324ua\340\301\003Q\360\025\216e\314X\316\274\346\317\304\256\362(\200\203'x\201'\242\213\027I$\205\341\306\370\037\356;\261\355\250Q\351\212\220~E\203\234\257\021G\315o\013\223\377\033#F|\304\345h%\327\244`\333(W\364\264\273S4War>\021T\2575\002\306o\376\b^"
+	.ascii	"\354\222\330\004\301\240\0329\337Nab\222(\313\021\241\013)\360"
+	.ascii	"\373Z>\002S\312X\026.\344\035\277\215\315\017\303\344\004[3\321"
+	.ascii	"\234\220\005\204\007\r\255\303W\377\276\300\221v3\324\347\321"
+	.ascii	")\201\032G\274 \177m\342\247\034\223\236\271\346`\313\363\021"
+	.ascii	",\216\213\341oa\253@G\307\206\204\233\031:2vj\230\017\367\277"
+	.ascii	"\372\236\341e\350\205\206o\256S\367\230\352{\031\265D\363\206"
+	.ascii	"\370\004;\274\342[`\275c\215\335\007\273\003\3437\f\3338\276"
+	.ascii	"\246\353\237\335\371\347\345\241Qm\005"
+	.text
+	.section	.gnu.lto_.symtab.c0baa172cb04575,"e",@progbits
+	.string	"calculateEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"positionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"isAltitudeOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"pgResetTemplate_positionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"positionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"positionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c0baa172cb04575,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1954 @@
+	.file	"servos.c"
+	.section	.gnu.lto_.profile.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`O\003\205\020"
+	.string	"\004\026C\004"
+	.string	"."
+	.string	"\334\301\274\312\f\f\002"
+	.string	"\002\001\002\002\002\001\001\351\361\316\337\001"
+	.string	"\002\214\216\274\341\007\003\274\331\333\367\005\f\002\003\002\004\002\005\004\240\342\234\212\n\005\006\224\305\200\177\006\002\002\002\007\002\003\002\b\007\n\232\242\313\204\f\n\002"
+	.string	"\002\006\t\003\002\004\013\f\r\340\216\253\313\016"
+	.string	"\002\006\017\331\312\303\304\004\b\002\002\n\021\240\367\360\225\r\002\022\227\241\264\221\007\b\002\002\002\013\002\f\003\002\004\024\025\206\353\317\360\016\f\002\r\002\r\002\016\002\017\026\352\263\360\321\b\027\030\031\265\314\211\315\006\020\002\002\020\021\002\020\022\002\022\032\227\257\311\336\r\033\344\362\241\220\b\020\002\023\020\034\375\251\320\324\006\212\001\002"
+	.string	"\002"
+	.string	"\002\024\002\025\002\003\002\026\027\003\002\b\002"
+	.string	"\026\002\030\002\030\024\002\031\004\002\002\002\017\032\002\017\033\033\004\026\002\026\"#\350\247\211\367\002>\002\002\034\002\032\002\t$%\256\373\201\203\rX\003\002\004'\342\201\222\246\004\002(\230\227\377\334\t\002)\257\260\211\347\004*\265\371\317\206\t+\362\324\245\255\006,\303\306\351\344\006-\320\266\271\326\t.\374\234\315\270\013/\227\213\266\256\t0\376\312\360\275\b1\265\332\223\353\00123\244\376\226\227\01745\235\336\315\261\00567\362\326\362\261\0038\240\342\234\212\n"
+	.string	"R\250\301\241\200\231\231\224&)T\2265P\002cd\264\016\022"
+	.string	"\204R\324!\204\314\004c\021\r\323\372w\315\370)\350\030\350\376Lc\256\244PhO\265\242]\230\341ya\214\352\336\017\343\366F\344\017\243{\241M\360\232v\245X\360\371\002\325\235\007\034_#\246z\340@\344\3542\b\357\347\255\303g>u\213{\301\b\212\342\304\324\2753\275E\207\241\336\256\217%\216\243\322\307\034^\007\323\003$F'"
+	.ascii	"\341\311U\236\240\215\307\031\2746K\342\211rx*V\337M\002\266"
+	.ascii	"\r{\0272\233\310\320\360\342\351\334H\276\312\262W\264\342\323"
+	.ascii	"~}\2647\201\030"
+	.text
+	.section	.gnu.lto_.ipa_sra.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 \355\265\003"
+	.string	"\204\003\341"
+	.string	"\021"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\001\001\003\001"
+	.string	""
+	.string	"\001\001\002\001\002\001\006\n"
+	.string	""
+	.string	"\r"
+	.string	"\001"
+	.string	"\001\017\003\021\002\003\022\025\031\033\001\034#\001%\001"
+	.string	"\001'"
+	.string	"\003("
+	.string	"\001"
+	.string	"\001"
+	.string	"\033"
+	.string	"\270"
+	.string	"r\n8\003TU@en%0\227,j.\376lYM\026\030{\035\246\2403\020\027\001\304\200\343$X\314'6.\f\004\323\f\013\002\2119\360\317\",A^\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\261\003\205\021"
+	.string	"\346VVF\360\2568\215\001\360~\263\273y\366C\262\\\233r\024\035\237\r/p\351\\\222\254\275\255f\357\235h1\235j\354M\2756\221U\356\207\343\271\305a\332\300&\262I\371v\266\211B\221\357\004\371bl3\f\375\311\2262\005;"
+	.string	"G"
+	.string	"K"
+	.string	"\233\222?\307\352\272\024-j\316\251\261|}O\224\037;\347\234\231\007\260C\t\r\005\226X\333\272'>\207\355\373\255X\242Bf{\321n"
+	.string	"K&>\373:Z\026\260\304\002=hlB \t\003\323J\301J\262\007\221'&-cFH\277\315\260br\372\f@\f5\304l-`\205\0237\347\211*\222,L\r@x,\007\224\205S\267\246\"\022\2343\354\366\345H\222RTZh\234y\342\376\233|\301~\001*3+\252ld\303\0274\253\004\035#\013\001%\302\207\2157\324\263!\222\304\313\345B\201\204UL\3501\2019,\034\341\232\251\t\221^\030R\003\026\240\236\325\324A\215\013\205\220\310\216`\353\205\343\214\016H\007\323\277c\365]?\214\003\377k*3\316\b>\260\315\007\364WU\006\005M\n}\215\256\013+\324e\003\243%\231\036\260\224%D\252u\362\211\013\274n\376"
+	.ascii	"\034\006\331\223\254\bU\210\262\253}I\262\243*4\351K\327\205"
+	.ascii	"l^\250\221\255b\002\032#I\352\024:`\002\231)\252\363\022\300"
+	.ascii	"Se\305$\024HH\202R%v\3327\234\303\241U\201\300\b4Z\361\344\006"
+	.ascii	"[\317\200\224Ht5\200\334i\353?\024\221\277P4\226\\\r,\274M\233"
+	.ascii	"\205\t\226~W!\3065\005\367[\325*\251v\3020[*'8\256\\\201\"\021"
+	.ascii	" \311t6\275\227\371A\222f\017\t\210\231\207\330\3338L\330R\021"
+	.ascii	"\033\223Z\257\302\226aE.\272\363Z\317~\025l\336;$\361\237>b\362"
+	.ascii	"Z\305U\373\247o`w\262j\024\021\304^g\\(\225{fG\224\337\325\307"
+	.ascii	">[\213\372fX]\221\334\212\303%\335hjL\257\324\337*K\344<\265"
+	.ascii	"\032\224O-\206J\333\302\251\227b\334\271d\t\210\035F+Ki\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\021\003\325\f"
+	.string	"\206\02063`U\223\341Tq\350\022\3341W\352\330p\035\030\275\367\b\202@\261h\003\031\315m\0316\b\202 eD_=\351\333\212q\275aacQ\264\356\270\267L2%"
+	.string	"'"
+	.string	"-"
+	.ascii	",\320\352\336]\264N\211\206.\322\2651\fYj\\j\0352\2538\253\""
+	.ascii	"\263jFv\033\255\354\272\365\254\220\r\004]\215<\340\345RQ\324"
+	.ascii	"\316\242\265\006\226:K\035\345[Y\240\220\362\336{$\201"
+	.string	"\306g\334\311i\311\250\361\315\244E\211\344\037w\217\357x\201\026\210\343\341x&\235I\207\233\320&\364\336\004EM\002\255\273\250\024gZ\301\231\326\327S\260$\220D\370|\246\033\201\t$\231!\0378=`Nk\332\005\301IsY[jc\334!W\267\034C\316q\024\355*\034(J\300\001\036\300\007]\250\021I\314(\221\304\222a\016\200\002\221\272\243\007\022\200\302\202\210a\305\030a\220\330\331\2375\004\205\022\241\355[\334B\007\227\026\254w\025\216_\320Qs\220G:f3*V\247\272\261\305\312\024\367^\242b\266V\310o\204\326\345\246X\360\335KQ\346\262\243\231m\313\341\306\021y\003\351\3121,\265\005\243\277.J\203\367W2;A\207\332ojA\314c>*OW\210\3236\257\347U\263\021\245+\032Q\2462\bl\017\330$\207\210<V\2536\002\261\017\357\177\342\264rG\221'\021\211\364g\342\227\344"
+	.string	"\r\274\275\222\313\251\312.\2311\310\223E"
+	.ascii	")\001G\322\025\034\027a=\2401NQ\325\023"
+	.text
+	.section	.gnu.lto_.pureconst.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\230\004\003\230\004\006\230\004\n\231\004\r\230"
+	.ascii	"\004\017\205\004\021\205\004\022\230\004\025\231\004\031\231"
+	.ascii	"\004\033\232\004\034\231\004#\231\004%\231\004'\204\004(\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"\205\007"
+	.ascii	"bJ (\200\305\031\016{Jg\226\321M,\neD`\0013!\322\020]\t\364\004"
+	.ascii	"\276\241\237,\344\365\341\315\332>d\242\333&e\ngX&\231`\317\244"
+	.ascii	"~\257\320\312\265\316H\235D\206\200`\345\341\245r\251\335\300"
+	.ascii	"gk\341\321gcTBu\225_\323Q\376\332\f\032\235\214\316\327\306\371"
+	.ascii	"9\255r\253sQ^\265\215\3402@\251X>\303\351\r\232\346\016Z`\347"
+	.ascii	"\016\230O\356y\247\332_\271\203\341\321\320\023 1 `\002Cd\346"
+	.ascii	"\001~\262\200v\310\206\210\004~\005\n\n\001\323\350\2626\241"
+	.ascii	"\204\201\003\030r\263\263e#\b\211\217A\211]\026\303\256\251\016"
+	.ascii	"k\r2x\374_\343FZ\361w\013\005r.1\327\205\004B\024\240\226\300"
+	.ascii	"\005\272v`\317$|\365\261:0\016\205\320\036_\034\372#L\307\002"
+	.ascii	"\303\021tP\206 |\260\350\320Y7V\301n\021"
+	.text
+	.section	.gnu.lto_.lto.56b531b0ce8c6e70,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.64.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 \235\225\004"
+	.string	"4\bh"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\275\310\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\346\006us\250\377\005uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\0014?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.65.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`R\002\225\022"
+	.string	"\006\241vG\320\362&\035Rp\335\300\252\tue\334!\001!\365\214\0057\027K<(B`*\307\327\352@\326\362\260j\323\202\360\323\204\345\220\306\234\243\035\211~\260\202\3761\344i3\356\317\2427Dg\346\252@k\311 \233H\231R_"
+	.string	"\\"
+	.string	"e"
+	.ascii	"9vm\021|\362=\332\366\004\336\343\367\003\336\243e\366\217\005"
+	.ascii	"7,\"9FT\273\013\352\n\177\357lw\227\262\307NS\346\023\335\001"
+	.ascii	"\n$Zm\366\330\215\354\360\360\030P\273\351T\242\240R\034\367"
+	.ascii	"\324\251\331d\027\324s=\356'>P\264Z\317sdew\235\264\332\211\333"
+	.ascii	"\273m\230\355\025;{\002\321\247\361\036-\020Q\005\251\311\234"
+	.ascii	"m\233\245\002\331W\211\302ya\375\261[]\232\365\241\337\373\355"
+	.ascii	"VMg\246O`\002\216\202\251]\023\271!\353\024\225\\\374v\3736\037"
+	.ascii	"W\364\031\262\337L\276\031\317WcG\t \2736\b\217N\371\036K\272"
+	.ascii	"\257l?\355\307\270\f\331\207h^`\367\207)$\321\007M\312@^\277"
+	.ascii	"k\360\354\r,yZj\311\215\316\314\322\353q\217C>S9ETY\352\244I"
+	.ascii	"\325dN\025iGH\222\272k\271\216\227\200\231\221\353Ja\222\221"
+	.ascii	"\320\377\362\354\227\343x}E8*\t\036~\303\006\200 \234\320\252"
+	.ascii	"\351\241g\303\234FH\362d\2078R\354\333\335\224#\230\b\004,v\367"
+	.ascii	"-\0363.\0161\025\002\274\274\\bB\n+\267\240\304\302\0210W\f\224"
+	.ascii	"\351\360\362\372\340\002\306\274X`\300\026X\fDa\340\020\204\013"
+	.ascii	"\006\312\204!\f\\\331\366D\377\216\202\234j\324&*\220[K\332\322"
+	.ascii	"\b#\255\223U\267\036$\262\352\335\356n\247@7\361T[\372*\037("
+	.ascii	"\034\0256\231s\252\355\2317]x\240bc8S\206\006OK\0013 p\002\241"
+	.ascii	"J\242\007\217\230\364Wbk\327\202\315\005J\254c\226\372~\215\305"
+	.ascii	"$\026\374\370\305\214\337L\033E\262\002\234\205 \037\"\300\275"
+	.ascii	"jD\246 \236\212H\362\217\022o\340\307\213\244L\323k\002\302["
+	.ascii	"\022\035i\342_\202@\317\265]\305`\\\254\022\335\357;\346\013"
+	.ascii	"\233\323wM\254\325\272\373\206i\327@\304z\267\331V8a\321\020"
+	.ascii	"\301^\250\031\357K\244s\365'"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.69.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 \221E\004"
+	.string	"\244\007\\"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\315\361\037\006yw\350\316\006yu"
+	.string	"\005\001\006'\001\360\035\001\020\025?\202\210\2008sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"0e\250\204\004\232\344\r\240\b"
+	.text
+	.section	.gnu.lto_servoParams_Registry.73.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 \237}\004"
+	.string	"\364\007j"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\316\301\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\376\006us\324\006uq"
+	.string	"\005\001\006'\001\340\035\001\b*?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\005"
+	.string	"0e\250\004\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.74.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`l\0015\017"
+	.string	"\226^iE"
+	.string	"\261&\035;V\360L\326\\\n\247\367\235\303\263\033[T2B\344c6\277 \241:\320m\341OZ\316\210\261\245\202\017k\342\312\036\356\214[\377\377\256ZA\3038\003\2461\203^\327/q\377&\215\354-eJ\001U"
+	.string	"R"
+	.string	"U"
+	.string	"'\200=f\037\200=\032e\327\270\007\263\377ZPZ9vWS\020\316\016\275\033&\352\021j\242\374\231#\360P\323\251R\217\320\243\2622#\200j\003$\331\321Y\235\365LQ\235$$\301r=\353 +W\247byz\030\354\256\263Su\270\261\3336\331^`\337D\376\\\346\367\374\273\341\323\252\351\324\364?\260\0332\n\274v9\274x,N\204!\"\363\237\375\326=\237e\320\243\235\342*P\377l\223\245V2\327\007ccwC\036\255 {<"
+	.string	"\017\262\375\264\177\342(P\227\311p\001\273.7.v\275\004\006\311\036\355\005y\232\237\346-\266\324\241\261\313\275\363W\234\005\005\370\020\217\306\260a\357\036\375\r{T\265+\\\310w\376\330\371\300i\312\251\036U\025iq%"
+	.string	"\3341\260k\352\271\230\223|\031\352\365\2557\210Y\325\240\3640\311\227\252KE\307\013\325\027\333K%\311\0167\302\352\342\243\213B\244\222\323F\032e\016\215l%\013&\321\246\235 <\030Ep\240\221F%\022\264\220i\323F\f\2704Ad\322N\245\222I\003y{u\361g\236\321\340\3001\321\223\250/\366\334\350G5'C\0165\3056\030\324\313|9\032r\307\341\356.\264\310\241~\364\254\303\035+\027\327\222\005\031"
+	.ascii	"1\003\373\274\201[?ieQ\\\363!\n\210\305\032M\b\223\231A`\006"
+	.ascii	"\005'@\237\265V\211B\262\020\316S\2259hg\225\260fu:h\027\207"
+	.ascii	"E\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_gimbalConfig_Registry.78.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007["
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\336\201\037\005yw\250\324\005yu"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\0038sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.string	"A\210!\345.\320$o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_servoMixerAirplane.83.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"U\004"
+	.string	"\364\005\370"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\001\006\303\001{\302\003\002\005\307\001{\306\002\004\312\001{\273\276(o3\314\0014\313\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\023"
+	.string	">\003"
+	.string	"\351\200\312\002x\332B\035\270\030\370\t\212\201\023\320^\360\211T5\257"
+	.string	",\302=\320\003\026P\301\221b\365"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixerFlyingWing.84.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 \3725\004"
+	.string	"\244\005\355"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\303\001{\302\030\001\234\177\273\001y\306\002\276\273(o3\312\0014\311\001\310\001\307\001\305\001\304\001\301\001\300\001"
+	.string	"\022"
+	.string	">\003"
+	.string	"\350\200n\001\205\177F\025\fx\271)\323\026,"
+	.string	">I\225"
+	.ascii	"\354^\026X\204\366\200\f\b@eFJ\320\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerTri.85.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 RE\002"
+	.string	"\224\003E"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\002\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001?\202\210\200\bo3\300\001"
+	.string	"\005"
+	.ascii	"@\006\004\2402#%\350\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerBI.86.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 \323\265\003"
+	.string	"\364\004\306"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\001\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\003\002\302\002\234\177\004\306\305\306 o3\310\0014\307\001\304\001\303\001\301\001\300\001"
+	.string	"\020"
+	.string	">\001@\230.\307Y@\037\027\032\003*\2466\f\203\300\300'\200/\231j\017\310\200"
+	.ascii	"Tf\244\004=\200\""
+	.text
+	.section	.gnu.lto_servoMixerDual.87.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\304\003k"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\005\005\001?\202\210\2008\177}\276\001{\273\001y\274\001w\273\001u\275\001s\274\001q\273\001\004\301\001{\300\020o3\302\0014\277\001"
+	.string	"\t"
+	.string	">\003"
+	.ascii	"\0201U\016L@V\367\300\002\225\031)A\017\240\b"
+	.text
+	.section	.gnu.lto_servoMixerSingle.88.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\365\004"
+	.string	"rF\030#\220-4\006\177\375\257\205\277\205\377\266\265\221gf\026?\361\247|Qsw\033\027\345\254G\265\276\204\320N2\371\3457\346\314\2339w\366\034Z\364h\322%\303\246\202\342\027\243\202\200\017\033\264\002P\243\013\225\340\301\256\267\305\216q\245qs\354\0367\266\005\0229H(\023\304\272\257\323\204\327\256y\346\211\031"
+	.ascii	">\003\200tId\361\204\177L7\252\320\036\370\230Q\234\200O~Hx\331"
+	.ascii	"\021\314\002\017\355\201\217\215\036V\005\300\200\nh\017|\214"
+	.ascii	")\026\376\252\037,\240\202#\305\352\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerHeli.89.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\225\005"
+	.string	"b\007\034'pO\032\003\374\374\327_\377q\333^\377\244\361\357\252*\244\237XD\321~\377\377zWH\002\005D\255\216\354\326\032I29\346\260\346\315\234;{\356\006\035z4\351\322\246Q\206S\205\305\335I_\255\362\265\"=*\002\037}S\365\"\214\013&d\262\271\301\313xklq\274\2177\235\313\276@4Dd\"I\374"
+	.string	"\326\330\352k\f\376\362\314)\001\033"
+	.string	">\001\264x\002P0"
+	.string	"\035i\312\024\261\026\024\r\034\332\300\001x\304\024\037h\031\360rS\306\223i\031"
+	.string	"y\202v\340c\200\005S\355"
+	.ascii	"\211\214\252\353W\347@\017X@\005G\212\325\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerGimbal.90.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 \177\315\002"
+	.string	"$\004r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\375\035\001\r\001\005\001?\202\210\2008\177}\300\001{\277\001y\276\001w\273\001u\275\001s\274\001q\273\001\f\273\001{\302?\202\210\200\020o3\303\0014\301\001"
+	.string	"\t"
+	.string	""
+	.string	"\021\250\253Q\347\206\352QY\007pP\231\221\022\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixers.91.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`T\002u\f"
+	.string	"t\022\037\003"
+	.string	""
+	.string	")"
+	.string	"\005\001\006\177\001\035?\202\210\200\020}{\274\001y\273\001\005\001\006\025\001\032\031\030\027\026\005\001\212\001\206\200\200\374\342\203\304\243\017wu\b\310\001y\307\025\370\377\202\017sq\002\314\001y\313\024\023\022\021\020\234\236\350\027om\t\330\001y\327\017\374\302\017ki\005\334\001y\333\016\r\f\013\n\t\274\236\254\227~kg\334\001y\351\001\007\006\240\227zse\314\001y\357\005\357\342\rca\004\363\001y\362\004\003\002\360\226o_]\001\373\001y\372\330\003[3\375\0014\374\001\371\001\370\001\367\001\366\001\365\001\364\001\361\001\360\001\356\001\355\001\354\001\353\0015\352\001\350\001\347\001\346\001\345\001\344\001\343\001\342\001\341\001\340\001\337\001\336\001\335\001\332\001\331\001\326\001\325\001\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\312\001\311\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.ascii	"3 @#\031\221\033M\022\200)/\210M\\.\334\016\265\025,\021\351"
+	.ascii	"\036\244\\\f\2757\302\"\0349[\221\005\273$\332\262Ap\321\314"
+	.ascii	"\262\355\301\354\346\023\226\210\344$l\022\203\226\373\241#\204"
+	.ascii	"\031\351\302\366\003\316$\271\ts\"%\351\032d\312]zT\223\257A"
+	.ascii	"/W\177\330\311%\354\022\341d(!2\350a\025\001"
+	.text
+	.section	.gnu.lto_determineServoMiddleOrForwardFromChannel.92.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`[\002\005\024"
+	.string	"Fe\205J\300RN:\303\225<\251;\371\027\377\007\202tFP\006\335\034\365\246\205\342:\342\235[\266\373u\023\372\023V\332\336t>\006\356\0012\252\206\2665A\352\310\305!4\025\024p\325l\025 (\243\300G\213c\333&\215l\"wJ\001o"
+	.string	"h"
+	.string	"q"
+	.ascii	">\322_\344\376\323\340W\255&\2024j\375!\360\310x"
+	.string	"j \264\355\273\370Q\316\272\371;\001B\034\032\221\263\004\244\326*\003p\021\361t>\200x\272C\327]\244\341N\235\317\341\342yZ0\321\025#+^\217\347aH\017'\326\273\231\033\212T\005\371\b\351\341\204#?S\"^~\352\364l\346t\241\324Z=y\275\020\267\353\266m\266k\366\334\005W\342\201$\356\367\345)\013#\251\234\255\335\f\332?\233\271>\373\033\f\006\203^!\303<\375z\322=\376\367\213\236\246t:tM\2578=\351\364c!\300*\005O\265~\bj\325\034\024\230\342I\277\375X\220\223i\256\344-\243\212j\255\261i\347\374\3221'(\311=\251f\254*\\M:z~\324\372;p\352\222qN\007\007>\210\240\242\"\236\276\366\005\0347\334\025#+_]\005\001\303\365y\334\335\271UR\331\022\3764a\254\265\232\370N\237A\241\302l\2367\333K}BeU\001\355\372\034|\2158\356"
+	.string	"\037\254\262\307\315\f\342\271\343N\034\246\275\251\266\035|v\374\034\325zcr\030\366\206\313h\231\005Jh\225=G\265\326\023\246\307p\361\211N}\001f\236w\352\223\033\266\301\220\270\024\026\334\214\006G\246\220\020^j\267\333\314F\023\220\241\306r["
+	.string	"3\215$\206\234\301\325bd2\266\026\227\027\013\262\233\313\fFF\303\305\310H\b\230\304P\303\311dH\022'\213\375v\017\353\ny\022ey\240\260}\371W\021\026U\370Z\272:\266\351\032e\2676a\255\265\212\353s\203K9`@\002h\351\206\r\330\276VD\031!\355\354L\241\240\353\363\314k\350N|\250+ `\002\031Ch\036~\261#\215\350\277\342\305R\202t89\301n\311h\211\275{\260\322t\240|a\023\226\031\343\314\311\241\261\206\332\236&\343%\333\205?Z>\230\236\341p\235H\204\235>4&\216\376\230\313\376_\215h1\026\252\035\300 m"
+	.ascii	",\r&F\316\313\327\204 \005\224\256\021=\002\262\213m\274QF\365"
+	.ascii	"RP"
+	.text
+	.section	.gnu.lto_servoDirection.93.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`<\001\305\r"
+	.string	"\246Z^C"
+	.string	"s\224\0168\251\251R\241\003%\254\033\350\214\177$\373\330\374\365\336\220L>\2609P\r +(}\030#B\277Eh\0248\347\265\031\256RA/\004\fx\004\323Q\352\225\327\337b5\364Gdo)S\nH"
+	.string	"E"
+	.string	"O"
+	.string	"\0052\217\266}\227\257J\366\013~*\274\267\254@\275\364\330]m\344\001\262Gx"
+	.string	"\331\243\266\274t\250Y\362S\016\035\270\314Hy\"\256\"^\007Gv\367\255\247\212w\312\004)\331]g\312\003q\307\333^`\033\202}\017\001\031\263\277.\225\305>\\]\261\377\375\231\263~\220\247\243\246\241\246\365\351\324\3645\"<p(\310\261\373!\006\333\033\261F\013o\370\013k\b\030\325\356nn\227\354\215\375\3318\360<\313/kvS\250h\354\256\001\007\376dP%\270t\234\322\207U\257P\263\027\212D\2271\247\252\036\025\223Q\222\247f?8\300:[\270\214\023\006%T&V\273'\004w\331\241\307\330r"
+	.string	"\n\230\253\303jw\023\300\370\013\006\237\305\243E\244|\n%{\274\276u\002\035\214\013\226)6\361t8\322\366`D\n\201>\033\r\236\t\240\006!\356pD[\006\316#\322F&\025>\027(h\240O\204\023\255\303\2114\216"
+	.string	"o!\017\247\215\266\215\3236\237\351pu\305(#\224\344o]sbGLr\036U\305vT\227\230\264\203\312\222\273\233\242\001\027"
+	.string	"\255\262+-)I\304\273vC\006\331\272\2115\364\330\n,m\037\027\353\343\204}l\266\266\274u]\030%n\266i\301\n`\004\344\003\303\202\n\255"
+	.ascii	"*G\251j\030u|kK\031"
+	.text
+	.section	.gnu.lto_servosInit.94.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\316\0025\026"
+	.string	"\206\351\217K\260\324Q:\270\304\302-\035\027\177\270\314\2319\237\262dK^\335\310;\322<\221\211\226&\361\321\334\036B\021@n\250_\342[ap\224n\341}\r;\360}\331\373\202\r>\203\356N\363\316\325\225\247\0252T9\2144B\210\334)\005|"
+	.string	"v"
+	.string	"z"
+	.ascii	"\343M\317\354\246\003y\365A\037\217QT\255\265\265*\\^\004\336"
+	.ascii	"&\235\235dU\232\244J\\:\363{_\2358\332ITN\344t_1\335t\357]\305"
+	.ascii	"\305\215\004-E\225\317\315\307\231n#D\327\023\020\335\177;\324"
+	.ascii	"|\212\034\320I\nt\225\210\213&8\0361\245\326j\342ltE\224\037"
+	.ascii	"\026\247\t\256&\2628!A\275w\332\203\263Q\252jPk5=q\271\273\344"
+	.ascii	"\266\215l\267\3304)\037^d\303\342\325js\311\370\214\227x\241"
+	.ascii	"\217\306pC\376\374\350\337\220\037\351\256\254\370\351\320)\227"
+	.ascii	"\324\346 \243?\277,!nX[\232\r\244\321\335\331w=\355\fy\203l\226"
+	.ascii	"y\337\275\032\251K\221\232\034\251\307\221Z\024\251w\251)\245"
+	.ascii	"\276\200\023\"\036\013\210\324\3723e\244\016\307\244\026\367"
+	.ascii	"\335>\221\377\263\211 \301\354\276\234\262\016\251\216\202B\247"
+	.ascii	"Z\201-\037\315R>\344G\024\336j\311e\340\013\356\006}\244\220"
+	.ascii	"\310\335\231\356\205\377\357\242\024\224\350\347\220\346\366"
+	.ascii	"\370\252\003\2771\242\350\021%\244\025#\207\r\361G\037\227\026"
+	.ascii	"1\260\326q\257d\302\266\264\003`\332a\264\273\363;\220\342\316"
+	.ascii	"\024\375\260\321\"\016@S>\201\264)"
+	.string	"T\240?\305-\021\206\030\332\226\346]\277\306\203\306\341\013Y\306K\364\247\227\310\217\037r\006\241\273{\236#6\315i\324\254(\260\035\257\233\306E\006\363\020\253\221\265p.\330\2742Xhix\311\334\264hb\262\226\013\001\3036\324\304Z80X\254e\002\3537\310/\276\241\316\326H\nP\333\301\003\372\323%B\030\253rg\006P\033\302\013\375Y\356{?\b\341\213rw\376\357\006t$k-\252\314]mO\371\246\377b\335\335s\310\325\262\3669\242\251\235\0225:eS\307aH\333\261+\301\234\360j\255.\037\351I\021,!\206\306\0047 P\202Q\246\354<b\201\325#\275mY\250k\260{\253\026F|\027\202p\210 \2061\315\212\371\2319\353\272\005\013\220\323\3202,\231\254\2749\031!\364h\253\2760\017\b\031\243$\312\037b\261E\344#c\213\245\341L\326#V8\266`\346\240@\2348F\030"
+	.ascii	"\302\200\016e\326\200\212\2537Qx\203\316\216\211m\374B\254\314"
+	.ascii	"l\\\370n\313\203\027<\312\312\031i\337Xl\316h\020\200\310\227"
+	.ascii	"5z\327\203\002"
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.95.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`c\002%\023"
+	.string	"\226\344\177I\320\360(\035C\245\177\"X\251)\002\316\302D\366\307\374\3156:k\017\237\200\001\t\273\3574\225\t\324vXx\347\333\376b\254\370\222\\_s\347\032p\341\005\347\305y\353"
+	.string	"\366\200\241(=X\330C\336\031\347\017\262\267\334)\005j"
+	.string	"f"
+	.string	"p"
+	.string	"\247\006>\340;\235\027\360\235J\320-[\307\305\233z\036\016\r=I\265\326pm\034\340S\274\251l\375\243se\313\337\371\001\3358\243\271\376\315\035\n\022!B\223\315\223\232M\215\213\22704\230\24493\237\363\004\2473B\204\026\233\313\303\003\002i2\271\027?\222\033g\264\231\313\017\006\265V\313\031\255\303\375q\333.\333\rl\031\023g}\376\211\367\260|\034_x\221\237\235\372/\337)\335\365HBz\311\321\026arm\366M|d7\27456x\335=WzWZJ\351\207"
+	.ascii	"h\032Z\320\2535fd\252B\264\005\211\353~\373\353\202))\303M\030"
+	.ascii	"D\246I\247\326\n\332\277\371\242\301\323\343\236k]\347\237\223"
+	.ascii	"\213\303\211\307\333aTk%9\365\310))\005n^`\320\021\301\204\340"
+	.ascii	"\345"
+	.string	"(\201\230k3\312\367]\355r\304\344\222\355\007g\201\342\200\306F\355VkL\301w\266\313W\244|\3446\340\314\270\325ZM|\336SY\371N\277\027\217@\206I)\267CG8\036\2736\333!\322F\267\214\217\344\277]EJ\344\246\326\327g>\212\247@\3718\247\226\220J}\247\266\312\202\374\314\262\007CH\266.;fA\335*%,\225\313j\205\025\266\260D@M\200\020R@\245\244B\225\025+,!`U\205\225U\330\242R\255BP|}k\276\363So\024z-\214\350[\233AJLp\267H\222|.\214\177\276\271\317\355\212br\351\263\326Zi\202\317\005\367\036r\343.\215\317\216\316\372\344\356^V\203\311\3211\344\2064H5\334\207\227\034}\236 \240\237) \220\002\2412\233\007\n\267\"b\315E\234\277\267\343\335$\004\323\374F\361\320E\214A\005L\315\356\263\225\327\013\005\326\354\371Z\\p"
+	.string	"w\320`\344m"
+	.ascii	"\326eU\352u\2323GS\214\340\226\205\007D\275\236\224u\225{\335"
+	.ascii	"5xiI\016\273\026\374V\276\020Uf0/\330\002\216c\"\202D\347\242"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_servoConfigureOutput.96.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\245\003}\032"
+	.string	"\3460\253H\240\232M:\234\347\321\315\321v@\311Lq\362\260\236\352\267\023,\2145d\f\301)\177X\\\215*\00456\3559z\365\276\256+\372D"
+	.string	"\353\2360\t\300')~\344\205\331c\301QeD\377\372\321\232%\204\354-e\222\001\227"
+	.string	"\212"
+	.string	"\232"
+	.string	"\247\b> <\235\027\020\236~\266E\273d\356\353\325c\315H\372\255\251\265\222\315cu>}_\312E\037\305\220\316Xs\321\236\241\210)y\271\217\257z\205\036\2752:\234\240.N\235^X\231\031/i\222\\HL\233"
+	.string	"L\023\024\207SDb\242\242\361v3(\f\fx\337\021S\031\220\247\317\361\351\261) *+\314O\030!5^\365\004A\232\242\270\347\0030*i\356;/\361vs"
+	.ascii	"\023U\371\252\263\022O\307,N\250\265.\227<\247\257\354\273\353"
+	.ascii	"\333]\237\335\246\n\374\222"
+	.string	"\233\201ST\227\256s;\345\310\222\257\376\333\304\325\230#\016\333=\223_\355\326~j_\254\026\277<\335\257V7\215\037\033(#\016\356\372r\334R\273\377\0311Rnl\357\330\ryyvn\365\2451o\316yq\232w6ye\2247Fy\307\311+2o8y)\363\316\346m\346\345\363\276'\300\225/\027\270je\n\266\251]\024\370\343V\337=\222\275ogOr%E\267\332\2551\3274F\301Z\002\253\265\372\234\356\2031\nz\265\326\240}\226k\331\260\034<\360K\017\341\351D\243T#\326b\313\372\273!\342WK8v\254\277\013\242\343\340\322zl\002\277\2447F\034\344\022\372\317\013w+\265\b^[b\377\027\366}?\021\247\034\335N\270\220x\263\245\366\017\352\205\201\305.\024\322\306\355\207S\021\372\351\305\370\224ZOO\n\355\237\036\263{\2006\272\367Q\236\025B\304\b\036\361+\315,\211c\225"
+	.string	"\002\332]\031\177R[\340U\353QP\223;\031\232\237:]\024\266\320\026\236v\003})\221\361.\213[\266o\r\002\321-\006n\210\210\204\221\002\205m\305\t\262\205\255\004\013\262\206#\"!\024\330\233\213!\034\t\343v\303\221\263\255\357\035\333\001K\227Q\353F\003\274k\001\003\277\\\034`\222\261W\233j\255\016\002\030\351\312\261\233\225\360\264\006\213\330 \344\001q\305\005@0\030\364z\2030\247yzy\207C\227\323\257\372\227\200E\302\226\332\034\037s\247\351\230\230\317i\255Dk\234\246\320e\3268\375\2447^f}\340\013\312\210\203\237\265\326J\177N\353\235\276\326\0235;\034\272WQ\221\341Y\237\332]\023\337\242!F\250q \001C\f\032\344\204%B\")h1p\002\031\242+;\020p8\2440\031\016q\004d\233\023\025\b\324\234\325y"
+	.ascii	"\300U\326\255\226\203bHB\231\252\205g\334\221\035\367\2102HO"
+	.ascii	"#\330]\347 \233\030C\251\347\032\225\n-\332,\371\341\224`\244"
+	.ascii	"y\324\367\256(\264M\267\264Ze\326\346\304\005\245\243\253Vja"
+	.ascii	"\326\310]\362<\372\305\343\220\347\247\245\004\005\f\330E\224"
+	.ascii	"7.<\021A\202\024s\332\306\013G\331 \250\002\007\223\377\220,"
+	.ascii	"\001\024\027A\340\271\367\364\270\013\340\301\231\b\372?5"
+	.text
+	.section	.gnu.lto_servoMixerLoadMix.97.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`.\004U\032"
+	.string	"6\357\245H\240ZQ:2\376\332]\322\325\364\217\347\257\337\353\316\330\254\237\366\322\217\363\256\273\327\225t)v\\\242[\247\365[\337\245\206{\257Z\b\233S0\nF\301\200\327x\340X\005\333\361dr\306(\264{\366 B\366\336r'\031\216"
+	.string	"\212"
+	.string	"\226"
+	.ascii	"*f\376d\376\356I`\347q\022\337\334\313c\027\345\336\273\303\f"
+	.ascii	"\306W\004'`_\351\007\330W\2061\223yOw\177$\304\307H\315\275\227"
+	.ascii	"l\037\226\005\234\366\316\264a\027m\035iO\030\237\350\n\234("
+	.ascii	"\325l2.Rq\206\215 \001l>\224\202T\031\244\003gL\013`\210\320"
+	.ascii	"\353(\364\221v\223\025\036\347\002\224\203V\270\371X\272\357"
+	.ascii	"\363\307&\233tH\320\373\2763\b>\325lA\237\342\205{/\317\232\355"
+	.ascii	"\306\371\346\314\\\204\23150\323\004\001\265W\376\313\276\336"
+	.ascii	"wz\305iIMT\254\233\316$1\323\334\340\252\306i\bA%\332M6\207\314"
+	.ascii	"=\331\354\034\363\017\320\360\001q\343\230sV\347\235q\316\373"
+	.ascii	"U\377\235\307\027\235\305O\266ur\355\311\224N"
+	.string	"n:y\366\344\023\030\020\324\204\341w\257\215\341\324e\252HB\376\373\2138\306\217\270qNF\200D8\302\t\272;\tc\\\ts\240\262\244b~\217\357c\325+3\027q\322(\003h\374\035\355\312\334{u^\371\301\370Z\0033\t\314l\342\\>D\020\336;cz\023\b\032B\204\025\321\007\236\3049\035\341\305\346\260\217\246\311\2215\265s\374\261q|\203\244s\272\241\246\316\305\376\021pN\262b\237\247\004j6\245N\357\275\227\212\235\323\027\n>\375\312\231G|K\231\341\247%\213\365b\3002\223\270\225\262\1770Q\252R\200M\355\f\3132\363|\n\253\247\214\220\244L#aT\354\245e>q(e\005\346\242n\022\276\204\231\305\237\244P\001\2511\004\265\273\367R\b\336\311\n\376\320+\267Z\314\007\214\242<\fV\211\236\2622\217\203W\353\205\213\365\"]\2408Q\2520A\366\224$V\220<\256\027\351\240"
+	.ascii	"\267X\260\\\244\213V\313E\252z\261\023}\234\202\203)\3262\261"
+	.ascii	"s\274\302RW\335P\243\316\307\261\355\322lJqm\333\327\3601\033"
+	.ascii	"v\204b>,\320\205\251\275\003f\332\224\246jv\354U_*8\244\335d"
+	.ascii	"`^p`X\217\035\267\335\020\337C\023\346\236?}\241i~t\304\346\220"
+	.ascii	"\273\337\264O+\"\236\263\330\331\335\247\021\031{\266\310\306"
+	.ascii	"\247\rwx\027\017\026t\367\006Q\250q0\204\224Q\304\030ED\204f"
+	.ascii	"f\013\323\001\320\002\231\242\255\003\021\2205Cd\264\304Zk\f"
+	.ascii	"pV\305:\225N\260\347\302\021\223\300\027#\272$\334U+\230t\021"
+	.ascii	"\0013\002z\347\372\035P\347Lq\353\204\rX1g\n\274\270\366q\371"
+	.ascii	"\364\333\334\331I\207Q{#rc\306@\262{\f\207\377\306\016\033q["
+	.ascii	"\b$\375\276z&\223p$\321\027\377\265\021\223W\274\3451\346Ga\375"
+	.ascii	"\200\215\252\370b\202\0345\344\231w(fi\020\321\022v\301\301\275"
+	.ascii	"zP\331\306\276\031?\347 L\254\353\021P\027\330\223\201q\334\220"
+	.ascii	"\232F'\025\376yvB\237\006"
+	.text
+	.section	.gnu.lto_forwardAuxChannelsToServos.98.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\335\002=\027"
+	.string	"F\255\234G\300\330*\035\231\363\371B,l\333\277N\345\032\360v\202j\224\001(\340%\252O\233\377\022\325f\nm\377\254\277\375`\027E\355D\267\224\357\004\273\356\301\377|\341\020C\t\377\242\003\233\356\2126\365\343'\204\354-e\222\001\204"
+	.string	"~"
+	.string	"\211"
+	.string	"\017r!\264\227\373\204\354qA\372zAa\2555\301\351B O\r\034%\236\316\237\304\323\335e\336e\320\200v *\266k\345iYRk\271`\021\220\247K\333\365\362\322F\035{IrE\304\324ZS]c\001|\226\337\311\264\323\331L\333\007\375"
+	.string	"0\213n\327s:\307[\213\034"
+	.ascii	"v\267\211C$\034\372\357\354\263\263\361\334\361\363\376\357\b"
+	.ascii	"\200A\335\356\347<J\250\265.\353v/\276\342w\327\265\273\034v"
+	.ascii	"\233&#\3668N\267\304\213\257;\335\277\304\323\367\350J\2261A"
+	.ascii	"j<\334-m\334@\273\307\261A$\334\246\261\213:\220\377\024\200"
+	.ascii	"ym.\364\2551\335\367-\275\374\222F\336\231\221w4\362\222\314"
+	.ascii	";N^q\362R\221wR\336f^\236\274\027p\352a\005\303\227Z[\f\311\324"
+	.ascii	"*tH\307}\277\320_\276w\377\363\375\214L\271@~\310\236\210\320"
+	.ascii	"\354\025Wg3zR\204\265\226\025\310S~\320\2226\343\0170(\200g\217"
+	.ascii	"\275\273\241\003_\267\006n\335\263b\217\247\246-\366q\274R\323"
+	.ascii	"\236erE\335\263\017\304\tk<\344\271\023\017d\255\025g?\364&\037"
+	.ascii	"@\344\344\210\247\335\021zC5\036\256\202\223:@\377w\n<\200Qp"
+	.ascii	"<\033\017\273\177Qn\273n\240}\"r\333\364q`l<\334\232\346\276"
+	.ascii	"\t\243\363\340\214\241h\001^\211j\265\263#\236\326\364\211|2"
+	.ascii	"q\322\305\307\333\324\007\346\212\266u$3\262\326\025\016\366"
+	.ascii	"F~$\262U\214\305\312@\n\221\303\262U\214\305\312@b\345r\351\360"
+	.ascii	"\250hR\254D\270,h\220\305`-\226iU7\261\027\n\330*\226\222\361"
+	.ascii	"\354\264H\260R\256\226N\211\224\n\026K\335\024\330\227\211\025"
+	.ascii	",%{\275`)RY{\323h\342\243J\255m\264\201\366\301\215F\365L\006"
+	.ascii	"\217\023\274\324>\377\375,\266\310\310\021t\022K\214\"65\251"
+	.ascii	"}\366'\304\231\236\300e\005\023\355\250\311\236\351\001Er0H="
+	.ascii	"j\002\300\334\017\233.5\331\224J\256\207\215\207\237\265\326"
+	.ascii	":\025\274\324\250\0161 p\002\241\272\353\235\322\356(\262h\376"
+	.ascii	"y\241\266\363V16:\222k\177\250\306\264\006\325\226\203^\325U"
+	.ascii	"N\b\344u\264\252\353\354\013\376\017\317\262P?\032\340%\361\220"
+	.ascii	"E\331\265K\350\3550\331\300\204Sy4\036R\002\365\253\300\006\243"
+	.ascii	"\255\241fO\303 \234\353\030\325\t\207\204\256\334@cTK\350\214"
+	.ascii	" \343a\202{Q\212@[\250\307\357M\244s\231'"
+	.text
+	.section	.gnu.lto_updateGimbalServos.101.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\301\0015\017"
+	.string	"f\\cD"
+	.string	"\221(\035-\377F\333\224P<\\\320TFq\023\245\r0\273$\017\313dS\275O&DP\256~U6\354\263\003H\331\355\265>\323\3742*\b\b\372\006\237\330\222\362Q\222\371\300\337\330,!{\023)S\nK"
+	.string	"M"
+	.string	"S"
+	.string	"7\341\007/\227\335\335\016m\023{;\314\315v\246}"
+	.string	"\301\351/'\326\335\225\031\027\273\037\310\006\264C\237\354\032\377Dl6\202\207\nF\307\356r\032\342\247\347\311?\353\234\225\n\3123[\260\273\316\225J\207[o\233\200m\005vB\b\377^ GM\t\027\246\327N\f\r\325\013\2257\366\227J\005a\037[e\261\263\364'K{bz\203\351N\226\346di-\2463\230\216\177\371\261L+\226\316L\037@"
+	.string	"\233\031\rd\354r\270\261Y\032\350\"a\373-\3545\363\023\377L\002g\035\272\304\330HYI\345\215?\332\342+\034\007\211\036\375\350U\036R_q\026\021\374\026K\020\021\211\207\036\205,5;>|\344\246W\377\013\211\362+\017\330\240(\356\350\246\240\224\033Gq\025$\332\356&\360a\236b\344\267\034\332\002)\277\"\305.\036v4\032D\024J\03080\225\274\321\310\207C!\245.\203'*q\246\n$\243\013#\\\311h\002\211\013y%.D\200;\f\"\2173u\235\307m\037\352\254k2=hP\2322'F\036$j\312\201\241e\252\352\267\242f-\373/.\343z\324\267RUA\252\327I\30445& \260\002\031\262\351\001G\02494\030\251\314"
+	.ascii	"\326\205\273\330iyS\030\\E\216\31173.\326v\302$Kd$\266)\0173"
+	.ascii	"\270\nxLj\317\240\345\251\335/\272\343Y\273\320v\244\333b\270"
+	.ascii	"\n\354Z\0069\311ng+BF.\t\2605\225o\016,nq\255'"
+	.text
+	.section	.gnu.lto_writeServos.102.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\331\025\245V"
+	.string	"J\217\354\036J0R;\031\016\340\206\363\266\224\223\276\365\rlg\260\337\307\231N\312\353\224\270bz\343\\\244V\370\301\n\2655\363\276]tp\244\236\352\241#\331hgq\036"
+	.string	"@\335M\307q\005:9\356\370\"\237\364\033a\333M\366\336R\246\024\332\001\257\001\367\001j\245R\235d\244F*\325G\242\0328\252\177\245\332\364\251\215Ju\351S\373Nw\217\244Z\274\231{G\265\212\352\277l\352L\035\216>\347\351d/\321I7\302u9\335\217\347\227\373\315\\\264o\021\336\203\177|\336\306\330\267\263\353\330\300!\233\323\343\2553(\217\237;<x\353\344\371\031\177\207\307\335\316\360r\256Sz\225\225np \223w\236'\002\345G\022\017\222\037\3057\221t\350\240\301\311\311\211\213\263\007\355\215\017n\344\332\004\201\366&\267\246O\232\021\020\332\321\334\315\376y\204\237\361>\3013\364\321\036\301\376}Dz\233\1776"
+	.string	"\201\341\315,)\3175\037\033-hy\347\351v\365\321&\312\217C\033\357nX\316\343@&v\203\241\363<\2616\206\262,\243H\2224-^t\273\223\304\341\251\246\244\242\240\236\202NMLKJIHG\300\237iT\372\310Q\\a\225\016}_\326\035\24213\257S\225\371T\23162*%\372\232\224\361\271]\031\233\270B\b@i\257\333\242Qc\016\325\345O\242\211\2749\204\202N\270\214\335K\031\027\r\332\225u\231A\235\306\274\311\312\231\2263\211&\252\340Q\341veZ\304`\335\013A|I$aW\226E\006U\022\201|\276\244\035\020\345\r\237\347\251\242I%\256\234\261p\2444Gn~3`\234\237ht6\307\206\333\225a\021U\374\341\202\346;\274\204\227\262(j\372\262\256\234\245\335\350_X^\302\375fV\316\320\356\363e\321\371"
+	.ascii	"\206h\260r\206\345$\224\217Hfa%\250\3703\013\023I\264]\233\230"
+	.ascii	"1\321M\273PYxU\033\225)f\304\244\230f`dy\236\347\255\224a)\325"
+	.ascii	"\227u\236"
+	.string	"\247u\314\354\354\026q[\215\330\266\300v:\n\256C~4z\222\303\030A_\272\347\367\260&m\254\"\257\366m/\t\251\271\373\253Hq\257\326*\206\006\246{\266\226\240aK\374-\236AC?Fc\317&\013\332\227\356}\331\230\360ETB\352v\251\361\303D\365\f\245v\r\033\3721\335\244\2702\277\373\333~\003\f\235\227*\332@\277p\325\020\335Y^\252\310\177\225\325\313x#\0349\251k\221{hQ\327\"\023\371\212\2147\n\n\036\362\365\234\360\020\362\013%\301\031\302\027d\274\021\217\034R\236/D\251\345\217\217'\266Y;[\360\343\003a\274\362\327\"?Z\307N\262\264\265\037l\343\215\211\320\316\323\353Ut\354\034\340\343\367`N)\272\310Mj\347\320\241\037\373\"\305}\331\3614%Im\037[\3721k\234\024:\260\365\262\335\300t\325\354\257\020\"l\315\013\203m\252\225\230\352$\246\032I\251\356\372"
+	.string	"\250>\362Ss\231j#\246\272\bPM\344\247\366\300Tw`\252\207"
+	.string	"\325B~\352 \246\032\210\251\336\002\252\177\374\324>Lu\017S\315\003\250\346\340\247\336a\25270\325:\200j\r~\352\034\246:\003S\215\001P\215\343\247\3262\3257L\265\r\240\372\202\237\272\206\251\266\300TW"
+	.string	"TS\360S\3230\325\023\230\352\031\246Z\202R-\003\250\216\340\247\216a\252!0\3250\200\352\027?\265\013S\375\200\251n\001T;\360S\2630\325Y\246\272\001\240\232\201\237z\001\005\022PA"
+	.ascii	"V\n\024\244\372j\304\361\310\335UB\252)\251\250R\r5\252\237J"
+	.ascii	"u\020\250v\372\251\233L5\223\251^2\003R\213B\304\032\355\363"
+	.ascii	"\\$\243G8F\315\nH\035\3549d;X4DH\232 +$\r\"\275 \3734F\f\025"
+	.ascii	"Y#\204\212\020q\363`\211\270\r\021\310\203\275\233!\266\243\f"
+	.ascii	"\362\\8\006\233\001\036\0068\026\305}7Z\213\303\r\020~\264\366"
+	.ascii	"n6\370A\274\025\251c7\330\243C\203U2\367\333\344X\r\332\330J"
+	.ascii	"\247vu\232c\337\246\207\236[\221<\266\307\035\036\034\274\355"
+	.ascii	"X\016\336l\215S9;\337\261\177\003B\307"
+	.string	"\212\334Z s\266~\254\361\261?\326\330\372F\343\300\261\217\375\232AR\200\253\346f\205W\260\026\264\251\200\20284\226\20287\254\241\261\217s#\215j\271\215\275\341f\343\20275\366\2027mfj\354\337\004a\307\354\267jNJ3\"`\237E\f\027\241\222\035\022s\306\bk\320\227&B\223\225Uf\rj\374\274\200:/0\363\304\253\226\2001\320\035;\023\3240c%\330\t\300\314\330`\0264\031+\301^l\221oO\\\306\036\211\263\027\226\b,\202-\327\277\023c#\270c\037Q\032\326b\354\357Dm\271\377#\266\350K\310\250\305\332qPX\225\252\365\355w\270H\346\316\234\330\242/\335[\023pyT\214V\355A\031\274x)\037\230A\351Vd\213}@\206\026\016\354\211\373p,\326\0018[\3254\206+\"\213=\034\004/\224\267\"a,\004-\300x!\307\305\276\220c\253\024\2452e]\354\345"
+	.ascii	"2\343\354\370\2626\312\307\002\221\270\025\331\300f\355\305T"
+	.ascii	"x\242P\206b\206l\3032\3032\344\307\006v\204\241\320!\264\022"
+	.ascii	"\312\300^\335\2473D\303\202D\t\353\345\005\226\201E\021\226w"
+	.ascii	":\266\226\351\231\213\322\254\005\371q\201=\235\013 \250\020"
+	.ascii	"\033\334\227\356\221\253\346\202\264\255c\212\202\213 \226\363"
+	.ascii	"<WX\311\364\004\030\376\226\217\216!C\006\371q|\0262\344!l\375"
+	.ascii	"0\022\303\264\217\024H\270@\350\332B\202\225DH\220!D\200`\031"
+	.ascii	"\031\302\243\b\226\217.$X)\250\314ud\253\013+\t\027W\027\326"
+	.ascii	"\317\355\353h\350\276\026\214\352J\241\242|\260P\242\227\273"
+	.ascii	">b\213\230\354\346n\230\212\022\356\007Ov;\317'\036\304\320I"
+	.ascii	"\255\232_w\001x\200R`\3354\356\210%3\024\325Zl\332\025\216\371"
+	.ascii	"\b\355\002\246\313\1771\312Ih\206\231\203\367\224\300Z\f\n\227"
+	.ascii	"j\311F\254\002\373\272\213z?\314)T\tu\332\340\332\302\r\n7\201"
+	.ascii	"\025\3774\255\323\376OX\036\225\235\322\264?>l\330\340\334\203"
+	.ascii	"\023B{\236V\315\037\212!\231"
+	.string	"vkXZ\245e\332\213\241m\224\245=\233\273\244U\032\261'\236\264R{\256[\326\254@\t>\212DZ!\0301C)\013eH\205\0040kU\314\234'\023\025\367\341\311\220\205Q\317\211\017\200\314\234\347\271\342\2437\205Ua\350\302\360\205\241Z\f\344G\244\275\335\261\336\336\330\316494\307i\325\254KW\177\335\313Cs\3160]}\\2\213KS\253L*v\227\314oZ\024>\265*\026\307\334\336\225\036\255=\3242\234\201\311zyj\217\326\200\271B\0014\271\002\004\323\252y\274\026\t\\\325Ss\307D\365\200`\354 :\332\222\230$\265zW\246\nP\374\022R\225\355\026\315\250}\230\270R\277\204\324\2730MH\345\362\251%3\330\177\333\303JI|H\003i\017\277\f\303\350\307~?\301\016\":&}\256\264j>`\f)\305>K\033\227*\024\027\261d\207\332\316 \241\250R\266K\371D\230z"
+	.ascii	"\274\351\240(I\304\246x\261\246G\311\232\220d\221\254\222\rK"
+	.ascii	"\322\265H\214\366\304\273\216\254\271\376\034\327\036\231\263"
+	.ascii	"\211,\330~q\355\347\244\326T.\017\201\265\250QL\004\231"
+	.string	"24\"\"\"I\222\2445\321\005\304 \245\230U=\021\2600\206\024c\304dFAAA\222\f\273\001\214\375IU*\004;Q\202\n\024DL\237\367no\320\234\213J\346\034&^\002z\306\315\212\377J\031W;t"
+	.string	"\261\227\262\016\373\365m\\\245\271\227\217G\364\344\263I\016\3031a*\233\355g\025\250\247mY\007VU\005\202\2076\217\311B0\036\354\303c\tD\002&\341\311\021V\342\007Y?\336\230\306\275K"
+	.ascii	"h\243<\004e/W\304\356\266\217\240\264\310k\005[\376\035\341j"
+	.ascii	"\267\r\332\367\360\207\375P\357\006XX\320\223\345\364\307Muu"
+	.ascii	"GY\325bM\246\006\306'\360(K\312b\203\023\275P\304Q\256\037\357"
+	.ascii	"\365\013\024'\215&\370*M\300\322\2048\223\252\035$\n-\035\306"
+	.ascii	"\313\314k\365I\310dU\252\032\021\320\033/\232\235\223\245\317"
+	.ascii	"\311\260\227j\341d\253\240>\357\030\234\214\177\247\343\371>"
+	.ascii	"\365\361\246\260\364\361y/]\340D\314\267\233\351\006\0235\020"
+	.ascii	"\326\323C\316\017\035h\267\257\227ne\216\347\367\231\371\022"
+	.ascii	"\331\275\017\203\362t\020\260\337Fm\025\345\213\233\234\007\365"
+	.ascii	"R/\235\300\260\335Fm)\352\232i\030\271\373\367\352\r\201\221"
+	.ascii	"&a\300\366f\321\234\273F\301"
+	.string	"\324\272o\261s\362\021rc\300tk\346\021<\\ \340\324z\013\214\361\337\2277\242\342\340\344\340D\377\234\032\211\036\031u\263N \270Mt\245su\356^\024E\320\274\001\367\252\017\373\271\003X\310\353\003\227\003T\307\020\303\257\203S-YU1\345\233M\370\266J\202\021\230[\311H\372xG\330\202\232\324\375\342f\275\337w\t^\210\313\257\213xf\357{\301\335]\004\255\357\243F\361:\377\353\024\254tB\b\224IL\373\rc\312\b\245\221\221BB\270\30317\324\342\n6\031\236t\367\033\330QF\343\034\001l\"<\036\317Jo\205\332\275U\022\035|\224\215FX\254\032\363\250Kms\321\f\002\200I\320\231U\267\322\373Z\360/\256\255\276p\235(x\036\023\250\003z\003\244\306\344w\262z\\@\227\231\002\f\277Sy|\r\211N\2044`E\200\272\036\226G\271C\3738\002\331\207b\377p\001_b\256"
+	.string	":dP\341$\020y-\246+R\321\256\226\272\210\037U\\X\252\310\240U\006\275\030E$\330\321\004\024[\241j5v\324\262\223Rv\335_>hIm\267\013\334+@"
+	.ascii	"\r8\305\330\001\235\344\026&\\\232\250\277\233\027\035\037E\037"
+	.ascii	"\035\272\214\0045\241[oDh\357\214\220f\201#&_Y\177Xp\203~\033"
+	.ascii	"~\250H\271\223+\"\215sCc\261\377\323\320\227\007\276\3300\315"
+	.ascii	"\031\003F\023%=\321h\272<\323\231\251\366\322\351\334\246\016"
+	.ascii	"\365\312\326\207\240:\323\274\271e\341\267\f\337.\003\227\235"
+	.ascii	"\231i\033\321g\337\271\252\231\03236\245*\324\324>\324\337>\277"
+	.ascii	"$\264\032c\231\242\006"
+	.text
+	.section	.gnu.lto_servoMixer.103.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\177\036-\206"
+	.string	"j\335\\0H\020PKg8m\217\233E\003\330\006\352\222"
+	.ascii	"\347\375\302\3244\210lt\266lA}\216\301x{O,7\f\030\332\273\202"
+	.ascii	">\\D\372\347\245I\223\343\345\274!\247\205q\201\353ZQ\037\352"
+	.ascii	"\331\256\267\3314=\021\021!IJ\031\350\002\300\002\021\003\275"
+	.ascii	"\004\244\275>\216\275\003\034{\005H{\223\322^\244co\217c/\217"
+	.ascii	"\264wG\332\253\343\330\233\243\330\033\300\261\027G\332\013@"
+	.ascii	"\332{\303\330k\303\330[#\355\245\201\366\316@{\217\322^\243\264"
+	.ascii	"W\006\332\033\003\355-J"
+	.string	"{\211\322^\030\307\336\027\307^\027ho\213b/\013\264w(\355\025\362\351\rJ{\201\214\275?\306\336c\332\353c\354M\215\275\306\264\0275\366\026\215\275+\322^\242\261w\230\366\n\215\275\301\264\027h\354\375\241\275G{\273\330\313\234&\003O\034\026\334\326\325\312\236<+\034 \233\030\236c\216cNcVc^cN\202\231\r\363\031\363\223W4;\271\270\313\305.j`u\373\247\022rxn\231\356\211%\216\263@7\270\245\345'\266\270\304N0\255\241\313A\203a\234\025\322\275\301Y\003\303c\240\356\t\267-\021\355\354\255\310\\c&\330\315nq\235p\333\372\2709y\302n\373\033\334\226\317\270\315\356\f\334\266B\2726\260u]\323,\033\301G0\022\314\306Jl\221\315\323\021\324qU\336Qy\255+\331\021\037?TN\342i\270z\t\323\304T)\262\006e\255\006\274u%C@\ry\024u\\\245\254\330"
+	.ascii	"d\310@5\274F\3454\344pEbH%\306\212\217!\003\217\315AA\264#\251"
+	.ascii	"\343*%f\212\327\f\273E\006\3562\331r\031\032.B\345\347\266\r"
+	.ascii	"\241\252\206hj|\002\f\031x\364#\362\330\0269\214\305TvF\031\256"
+	.ascii	"H\030\t\002\f\336\272\256;\030\270:\206\fd8<\024d`\021\007\005"
+	.ascii	"\031\250\356J\301d\\+\253u1\315\360\254\353\232\364/3\216G\242"
+	.ascii	"\035\362\217\214\227\370S\231\306\214##\0311\212j\020\301x\341"
+	.ascii	"\242\005\213!\241 \240\237\243OjD\213+l\020\207\302 \360\367"
+	.ascii	"V\227\307\230\006\037\335\224\025\024\323X\003'\254g\250\341"
+	.ascii	"# :.\243\"\332\226:\\\256\322\260\214\261\257*g\307\220\253\032"
+	.ascii	"\243\023\353\"5\\\343'\224b%\f\313U\245\375\202\354\341\2611"
+	.ascii	"Z\016M\264uu\206a\274\020\016A\343\341\235\273\251:\\\256\314"
+	.ascii	"\260\0130n!\306\rX\263`6\353p\271\n\303CA\264\t\323BA`\030\350"
+	.ascii	"\247#\353\r\007\226\253\372\3417\024\247K\024\374\006\246\177"
+	.ascii	"\200\350\352\243\017\027\017\235\n\207p\271\002\202\215YJliT"
+	.ascii	"\256\252\371;*\262\\\225\016h;\364\n\216:\3036~B\033\252\346"
+	.ascii	"X\256\312\210_\220:w9p\031\317\370\252\302j\342\214\255+-<\344"
+	.ascii	"2\006\006\301W\207\313\225\026\026f\341\340\262\201\251\025\363"
+	.ascii	"w\264\256k\321JJ\377VXe\341\377\206\254\204\231J\255\244~:\360"
+	.ascii	"\222\270\303c\334TV\312n\341\220u]\267\247\254\256xo\360n\227"
+	.ascii	"\355\356\226\335\"\240_\324\256\256 \003\211\356C\004\235\236"
+	.ascii	"S\bc\350\305a\270\370\213\003\325\226v\200\356\342\034D\021\307"
+	.ascii	"\354\373\261\275Y\013^\253\305\207\336v\3177\026o\241\202\351"
+	.ascii	"\034\324 \206\353*\005d\033\253\265\250b\204P\307\214\t2\220"
+	.ascii	"\305Ym\216S\350Cgf_T\357Aj,\310\306\241\257\250C\250e\324f\363"
+	.ascii	"\224\332\f2P\350@\272\230\250%\226\005T\n\006\275\211F\037\255"
+	.ascii	"\254\212\005w\325\261\006\232\247\202\2366q\005\216\324\241\026"
+	.ascii	"\350?\007\372\217\316\361?\027\302\325\260k\006t\025\"IT\307"
+	.ascii	"\033\347\342\364|z\244\367\371O\217\361\351\205z\230\273&\244"
+	.ascii	"G/\211\024\300\325R\214\367\331\212k:\321\342\3215\036\243\305"
+	.ascii	"\b8\353\272\277u\215\252\261\342\305\013\351,\277\224\0174\324"
+	.ascii	"\256)\300\265\256+\220^\211$\325\365\361\036#\022\0349\022d\340"
+	.ascii	"\212\373,\337\3509\201\326\354\235\371\021?<\361?:\254\307|{"
+	.ascii	"\333\026d\340\360\306%\\S\330#x\341\177zz\360\235\274\340\215"
+	.ascii	"[ozl\300\217!}\270x\312\316\357\300\377\362\226o\242z\017\017"
+	.ascii	"\266\263k\303u]\203,\343q\235\n\226\201`\340^\220A\0067byk\262"
+	.ascii	"\335x\263\216\371\265v\315y\214\207rO;\251\336\333^\031G\220"
+	.ascii	"\317k\276\315\304R2\024\034\005\224e v\203\016\232\247:\b2\220"
+	.ascii	"/\334rkbE\365\236]2e_k\227\203p\355I\261\367\262\273FM\232\263"
+	.ascii	"\262'\231\223\323xY\214\325x\215\227\317\230ir\022\274\f\306"
+	.ascii	"lx\271\f\031\241^\366\n\023\324\313`x\216\227\273~z\371\213V"
+	.ascii	"\027-\034\307\313U\370\214\227\251\370\311\313Si/S\231\302<\366"
+	.ascii	"\362R\n\332\313Rh/+\321^\216J{\031\n\355\3455\250WE{\223?\275"
+	.ascii	"Q\322^\032\216\2753\034{e8\366\"\323\336\030\320^(h/\fh\357S"
+	.ascii	"P\257\023\332\373$\355mB{\235\240\275/\240\275L"
+	.string	"io\023\264w\t\355u\001\355m\001\355e!\355e\202\366.A{W@{U@{\225\244\275I\320^$io\ni\257\022\332\213\302O\357\t\307^\023\216\275%\240\275$\240\275#\240\275\"\004\365\206p\354\005\241\330\373\301\261\327\003\264\267\003\264\227\003\264w\003\264W\203\240\336\f\212\275\030\244\275\027\024{-H{+@{)\360\351=\002\324;\001\332+\001\332\033\301O\257\221\264\267\310\261\227\310\261\027\202\264\367\201\264\327\201co\003\307\336!i/\003i\357\002\307^!\307^\005\322\336\004\322^\004\216\275\007\034{\203\244\275\006\244\275@\216\275?\216\275\005\244\001\033gE\256\b\237$O\341\374\005\226\004\311\201t\230}W\310\241U\n'~9\242\311\226*\335\n\322\3505\334\206d\023-$\341\340\332\246\3548y\f9T:\221-\n\354(\234\277\364\334\326\311\203\231\322\330v|\302\231K2\356SO"
+	.ascii	"PQ\2257\246\234p\242\233\021&\234\305J\270\t\347\245\027\t/\341"
+	.ascii	"Q<\302I\020\341\033|\204\007\345,\277B\270\bq\276\224r\251\020"
+	.ascii	"\364\234 \234\303\336t>\270\007\007\341|\346\037\234\227}\035"
+	.ascii	"\334\203\2770{\202\203wp\027mK3\033\\\203sp^~)\317|\203\007\345"
+	.ascii	"0\3732\270\006N\034*)'\251\356\253\252D\342\332\223\301\213U"
+	.ascii	"\240518\363\316[z]p\f\350ZO\022\212\377\020\227\207\357\202s"
+	.ascii	"[W\005\267\340<\247\365\222P0\205\221\311\n\3437\273\311\271"
+	.ascii	"\306\223\244\323F>\344y\256\205\335\351*\222w\311:\311)\222y"
+	.ascii	"A\006Vp\003\346p\231Sp\306\302s\307\354\253\242\251x*`\nU\211"
+	.ascii	"d\007\354@\267\263\2463\251\327xO?\270\356TeR\235\024\\\346\254"
+	.ascii	"\004\337p3\323sv\236\261)&\332W|\344-\305\323\316\201\236\340"
+	.ascii	"\273I=\311=\315SG~$\301'80\217\331\027\301%x\021\035#\217\340"
+	.ascii	"Ef\314>\306\"\346\316\225\342S\320\310\233\236s\244z\017\252"
+	.ascii	"\347<\331\250\353:Ui\024d\256\351T)L\225\n\225 \003\215\234\321"
+	.ascii	"8G\026\263\246\363hnR\254V\\k\331\306\275\254\320\315\220\323"
+	.ascii	"\374v\302\035T\273\346\344\275*\252\250\020\257\305S\3474\227"
+	.ascii	"\341.n\231\205\f\356n\024\273v\002\351\303\025\247\345T\252\032"
+	.ascii	"T+V\312\370\306V\037\030\025Q"
+	.string	"\275\347/\342\210+:\f\213\304\025\211\274\b\004'\362\300!Hk\270\267\007\364\034p\263\242\201;0\344\r0\360!g\275\204\033\003'n\345i.\320F\024\362\005\024\270\220\004\256"
+	.string	"\232f\303\226"
+	.string	"\002H\f\0178\002A~\200\001\017\322G\250\031p\342V\025M i\302\274\037\007R\300\177<\370\002\324\244!\340\304\271;z>\316\202j\003\334\207"
+	.string	"\037\340?=I\027\240\313\236I'b\271\323DB\003\204\353q$\036\357q \334\322k\307y\2149w\234HD\236\036\233\216\260\337\333r\\G"
+	.string	"\307\361\034^J3\315"
+	.string	"\016\004\200\343(C\004"
+	.ascii	"'n\3455\331n\334\306o\234![W\026R5n\343B\263\245\227\262\277"
+	.ascii	"\332\253\205P\255"
+	.string	"nP\257\\\t2\260\306\213m\3504\331h\2041\3168\215?\257\265\270\275pw\341\346\302G3\214~\364\237Y\226\006\203\024\302\365\203\332\345G]\227\321}\266\242h:e\364\027\036C\032\271P\336\266);1.\343\327C@\237\n\032\252\244S\234\340)\372\256\252\203\272\245y*\306\177+\326\241\226\350E\377\2511\373\242T\036\272\007\244\220:\325\207\346A\355\002\204\201\333[:K\325\n\273\004\351\311\022'\245\245\244&LKKLH`\354\222%\246\246\"I\232\224\24041\025a\342\300\005%M\232(-A\"\344\244d\205&%\247\340\022S\223\n\277%NI\230@9\241\330\204\311\322cPZ:\023vzz\241\t\023\340\"Az\302\004C\223\222'INKV`\342\202\nIM\230(-%!iz\222\204D\264L/(iJrbbjJ*\222E\361\275\254\tzp\242\256\334(\277u\345\302"
+	.string	";\231\307\370\007\257\b<\032\327Z\241\233#&\363\333\325\330\301\\\245J\213\021sB\207\031\327\332\006\"\317\006#\326B\004\233\342\215\f\356rVs\252*g2\227\201\217\3127\r\351\303\265f\312\231\312\2319%K\251\346\314d\251\363\362\027\306\347\306\354;J\242y\232$\024G\266\3640\007\355L\313\211c\224h\302\215e\2513\332(d^\366'w9Q\353$4\357\230}+\307\006=O\031]\347/\357\276\347\363h\236\206\037;Y\322,\211\226T\223T\363\345\3546\247kL\032Y\214k\355\036f\nr\327]\3540\305\323\256\353=\267\311\264\207%\327Ne\207:\2733f\346\300\234\351\370'\304\rjMV\236\245\336mK3Q\254|\020n\371\005u\216\002C\016\313@]H\027\233z^\337t\324>Dr\215\004\261'\344v\243\314\235\314\230\344\235z\206\303;\320\336\364\300\024\341\325\270\227-\376"
+	.ascii	"\203\317~;\033;\250\250\236\374\003Q\236\274\327\205xJ&\221d"
+	.ascii	"\303&\310\300(o1\007\353GDu>;\223\301\203\3267\300\270\326\023"
+	.ascii	"\034\006\031\203+\bF\343v\212ye\205Q\261iY\370\246^\264\350\263"
+	.ascii	"\033\026N\316N\032\016\0069\304\365\303\f\247A\206#?\303y\231"
+	.ascii	"\245,\273\f?\034\263/\206#\271\220\303\177\211\341C\316s\230"
+	.ascii	"s\331\235=\267\345\227\322\305\013\207\362\346\253\222b\266\270"
+	.ascii	"\326B\3012\304\203\271\rO\300\024\303\\\023Bb\016s*(n`8\0243"
+	.ascii	"O\177r\030^\324\266\374r\372S\333\265\222r8"
+	.string	"\017\227\027U\311w\352\336\305\351\234\247\313\331\364'\177a\346C\017M\347\270.\266\250\260;\021\373\013\300\275=7&\213kI\r\335K\322-\310^O\341i\307d^\017\2661\261\314\234\233L\347\301l\346A=\313<\3126\233d\342[T\261\b\266\200-\361\035\256C\362\216\3330\331\271\r\347P\2725\235L8\350\332\224th}S\204\256\265!\020\001tb\017LXq\271\373i\341\374<\325n\023-X\3177\311A\267\366\244C\013\272\321\327\212\006\350Z\273\364\306\215\205\245\007\256&\234p\341,|\311\313\205\023\251\265pfaO\022Z\035\037~\016\b\343{\276\221\352\275#\223cA\336\340\272\302R\316D(O\311\227\234\245|{I\305\nW\341K\0164[f\235\360\025N\244\226\302U8'\271\222\263\227\336]\202v\250\342\030!\020\222\026*D4\"I\222d\230\003\362\n\020\b$\201\332by\003\022"
+	.string	"u1H\223\020\225\2204)(\244\003/\202\340\034w\310\316U\362\203i\001\252\246\377\322$\0023n\237 \357\207\321\330"
+	.string	""
+	.ascii	";R\205\344m\354\373\252^I\310C\037\3712H\026`\302\036\213\037"
+	.ascii	"\344\202\2224\004s\306W\274\327V\033w\304\307\376f\321\352C8"
+	.ascii	"\241\361\250\037\334A$"
+	.string	"f\250\032\352\365\241\251X\264\013w:\005p\236\216\005\206\311qK)\316\230\fR\024#\232)\233\274\305\344\353\245\266\n\001 g\260\371_\332KQ\232\321\306\303\037]\342\301`hw\272qEc\005xD\211\024\275\213\t\340\244\033r\202\236c\242*\304*q\226\370Z\211~\242d\276\345\322VR\232\267\b]j=\n\225\220\276R$\032\236o\251\314\301oC\b\340rs\\\262t\223\030l^\302\332;\374\324m\340\n\350\335#\334\341u!H\2143\t\f5\354\266\202\337C\232\334.F\256\021H\201$&GW\346\004\016jAD\234B\330\357\217%\222\021\340d\376 \251\237e\013\034~\326\217u=/\324\261\232\357\036\361\200X\371\262\363s\356N\335eH;h\232M5>\363\272\363\211\344:[\206?#\027F6G3\032\037\317k\2262r\252\013\004\264\253^\177\202\335\245\356\367X\026\320\2419\316\016"
+	.string	"\005\301\230j\372Z\fp"
+	.string	"\211\204\200\265 \223\253\021$\237\374g\370BF\334\263\304%m\262\237\322\231\326\007\306\306,vm@\252o\235\030\321\262\032\256_+\340y\262\240L\232\202\001"
+	.string	"DD\225\027\t\211\367\236\344\026+\214W\306\243\310\254\312Nu\302\315\344HA\3718z\032G\250WDz?j\365G\246\034\372\030\270\210\037\325x$\2732F\307\025\001\204\315\032\343\367\304u\222\205\3205l\n\214\274\207\272\030\021\363\276nL\026Jn\020I\231\242\221 \341J\327z\315y\313S\256\254\200\f!\006\b%%\033\250\374\201\345IoP(i1\034pg\212T\222(\377\367zsJ\367{LQ-xO\225\035\245\021\270\356D\203\234\234\244\226\274\037\202\242\276\276t0\341M\237\326\240f\273\006\343}\247\234\021\376\033O\201\365\224\375\025\022\363:\217\315*!\205\366\222\314_\273\0350\\\2367\300\375\332\265U\237\233[n \201,Y\232WS\317-\r\020"
+	.string	"\213 "
+	.string	"F7\034\t@\300\260\n\320\003\250\177\303\354\312\026\037\214'\013BcxY\354\320E\350X\007\252\007\335\221t\bN\343\236\323q\2278\003\312\351\275\220w>\033\226r"
+	.ascii	"\031R+qC\347^n\020\245\214\001#\326\227\325Z0vU\tLr\315]\226"
+	.ascii	"\246W\002X\031\261\250\221y\313)Q\276*{\223\210\221\034\223\351"
+	.ascii	"\001\021x\025\013q|\216\306\221%G6z\251-\320\216\027\237\212"
+	.ascii	"Q1-\330\241}\3271l\322\240\016\317\0038\303?\r\026B\307\273\217"
+	.ascii	"\303\030\366v\355\f=\236\212\302\231\207 S\362\300\001\250\367"
+	.ascii	"\335\203S\022\3220Z\2333\202\300>_\376\252\365\247\253I91:\001"
+	.ascii	"C\271\007\321\304X\205&r\371]\316kH<\216\327n9:\360\222\t-QB"
+	.ascii	"\2471\234\036L\017\270I\234\246|\025F\345\214\332\021\354\237"
+	.ascii	"D\230\234\240k\276"
+	.string	"$\007\241@\337\004\323\022kx\257F6\022\035p&\320)\342%\233Lp\2219{\235ob\262M&"
+	.string	"\3722\361\227\214\200\3715\"8-\253M\265\352\262NC!b\"\255\210\267\375^\350\"\201\235\353\017\003\232>*\354G(F\245JTCB\217\376\224\2608\226\341V"
+	.string	"\f(s1\300\323\022\3017\274\202%\221\357kv\3368\200\245\033\271\372\246\324\304\232Qo\214\007\355\242\t\221\274\217\304\360\254\254\214r\303`U$\037T\251\\Z\314}\216\f$R\237!\367Q[\364;\020\311%\004\233_\205\036\212\006c\234\261e\260\347\371\250\025v^\245\312'\032\206Hd\244o`N\016\313EZa\345z\020{\b?\270\316\3739\001\n\243\216\257\355\240\236\016\200\322>\310\241\370\023nc|`*\225\273\246\231\206\310\344\243\243LP\207\022\034\302\352\363P\001\345C\247\004\013\247\261\032W\304}|&\371\231\302\211\356\346\300\330\322c\213b\rd"
+	.ascii	"\030`E\033\277\220Ts\302tE5M<J\024\377\034%B\360B\bQ\246l\266"
+	.ascii	"\354\315\03385\360tm"
+	.text
+	.section	.gnu.lto_servoTable.104.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\367\020\315M"
+	.ascii	"\232\205,\035L0\214[\351w[\b3\2424\337\225\030\005\005\225U%"
+	.ascii	"\246\022\362\037\231\210X\272\333\"\001\212$~\267V\022\263?\021"
+	.ascii	"\0040\3321\353<d*@\243TH\027E\302;\302\001\300\bqPZe\311\372"
+	.ascii	"\377\307\214\306\336{\223\275IJ)\005\264\001\244\001\303\001"
+	.ascii	"\274\304:W`\235)\254\316J\252s\322\352\214\304:\037\261\316F"
+	.ascii	"\254s\321\352L\244:\017\251\316B\252squ\016R\235\201R\347\037"
+	.ascii	"\325\231U\235W\325Y]\235S\325\231\250:\243\251\363It\036\242"
+	.ascii	"\316\217:\373\351\334\007tS\ri\226,\363|\313v\254\360\2046\357"
+	.ascii	"\254K\366\262\273\331=\327\317\334\334\035t]\221F\303HjOjh\270"
+	.ascii	"\371\034\355\270\337\270\351\332L\237\271=\307wM^\313\266\214"
+	.ascii	"\310\004\333\323\002\220\366\331\324Gh\237\303.B\373$\323\344"
+	.ascii	"\226\033\023g\205\255B\007Ao\300\317\264\003\303-\246\227\334"
+	.ascii	"c\330D\212\333a\2164m-\333\261\002\332\324\274\3551\322o\254"
+	.ascii	"v\020\207\206|k\333\326\b\333\247\211\024F:\314\221\264e#\232"
+	.ascii	"\341\213\022\330\266K\247>YD\332'\221\345\313"
+	.string	"\374\327K\265\226\230\024\363\325\334\323\266m\324_\341\264\207\313f$\277\235\204tdTD4$T\f\002\372aW5%\242\347\360\375rk8\336mu\322\220\250\204\214N\353\221%\207S\202\200Q\232.\213#e\260`\311\005}\264\245\215\264\324m\361\"\242\346\272\240\207\210,\250,Yk!,j^\254\300\203\200\220\375sf\346\354\231\\g\340B&\305W\">5\225\310\202\314\231 \225%Q:\345Bvt\342\360HN\225\021Z\217\f\312P\004\322M\223\036\323.V\366\345\350\260I\217lm\330\324\266-[f\364\023\t3\254\314I\017\333\2557<\341\353\3423S\346\244\337\253\013=\302r\227e-K\362Nd\321\266-{X\331\222f\245fn8f.\302\\\374\022\237V\330GP\252W2\303S\365T\357o\276\b{\311T}'\200\0073\353\363\222\3528\346\247\026t\341LSN`\202M\001v\240"
+	.string	"\334Z\372\354\245U\214\223{"
+	.string	"\264\317\252\3571\275\001\314\254\017\031\006\216\313\013-\200a\036\321O\343!\250?\002L;^\316\207\223\274\251\t@\231m\334\360\016\363o\267>\013\363\366\004z\3315\263\330\362>l'\0161l\332\343T\2207$rf\036\007x\207\361O\034)y\375A7my\037\"\023\270\310\376\323\230\271\217\377\210s\360(\320\341?\"\037\236\322^\207`t\224\327r\360\202\212\215\205\266\341\206\303\177\304\021\322\306B\3334\b\355\206\377\210~\303\223=\254\035K\303\326\242\255\341\306\343?\"\235c7\026\332g:\243=\001\357\rL\3371\363\037"
+	.ascii	"! \315\332v\253\221\036\326\206\350\263\2771h\2418!\0079\263"
+	.ascii	"\217\005\274\303\372\035\030D\033\f\354\372-\346e\227\177\032"
+	.ascii	"sO\t\032\223\374V\230Ug\036\252\363\216\325Y\307\352\234cu\306"
+	.ascii	"\241:\033\320s\3157Rg\033\335l\276R\235k\254\3164V\347\031\252"
+	.ascii	"\263\214\3259\206\352lEt\206\241:\277P\235]\244\316U\275l\246"
+	.ascii	"\":\267\350\271\346\025=\327<\265:\253P\235\245V\347\024\252"
+	.ascii	"3\212\325\371\204\352lbu.\261:\223`\235\243Xg(\326y\304\352\374"
+	.ascii	"\244:;\251\316\"V\347\020\2523\210\324\371\303\352\354\201u\356"
+	.ascii	"\300:s`\2357\254\316\032T\347\f\252s\323\352\314\244:cH\235/"
+	.ascii	"\254\316\026X\017o\364\347\033\242/\372\376\"d\273\3124I\364"
+	.ascii	"IkuC\317\276\214g\3623\"e\b\375\320O\315)>\320\013\375\b\277"
+	.ascii	"\240/&q-W\351\205jY\256\230\353\351\303\022\364^\270\006\367"
+	.ascii	"\363@\317\324G\315-\360+??\357|kp&\232\357\320\365\331gj\032"
+	.ascii	"5P\237\370\353[h\032\271ty!\247\257~\177y\225\253\354<}|\301"
+	.ascii	"\234\312\025k?\265>\331\321|\312\235`\354\226\225\241}\246\337"
+	.ascii	"y\352\300\241O\374\263\217\361\316\371\350\243M&\216\f\340\354"
+	.ascii	":\261\212q>\032x\224\033\034\332\021\254#\324G\320\3417\025f"
+	.ascii	"\035/\347\363\304\243\034I\331\217\016\345B\221r\317\316>\b\306"
+	.ascii	"\261!\303\004\231M\231+\002\315\370\226k+2g_i~h|\214\027k\277"
+	.string	"\376\327b\332!\341k\337)(\363\255r\323\274\303\376\273O\357I\236\327oq\214\347&L\232\034\343\230|Aw\213\227\225!\363\261\346\f F\022\350\023\270\0044\256\336\305\317\325\303\270m\036\346`0\206^\360\240ic?\215]\013\tJ\324\034*\030<pR\034\257\343\305\030O_\331\370\253&S\371\027\007\314#\334\350I\2326\276\345t<3?y\327U\026\325|\313\271\356\225\265\233%\013\332g\273\265\037\343\272\366\314\334Y\357\226.\274I\25334&a\237\034\257v\261k\203C\372:s\2472\0224m\302UNq\0176\237\333\305\313\315\340f\200\366\211\343\325:\2527\340w\264\001~\021\242lz\230\351\2471\325\267x'd\302\361r>\267\255\365\\\267\264m[)n\022\272\204\033\206\257\230\026\336a-\320>[|\257\251C\244\027\247I\f\374\003j\310\017\"XA\242\204d\005\t\222\325\243\002\377"
+	.string	"\322A\262\264\252\022\320\302*\242\225U\225u\305\200\017!B\260~\3640\342\036PC\262\036\320\3621$\212\310\217\005\2000\240@\224\020 XA\242zh\r\211\202Z\342\254\006|hE\021\311\312\322\212b\227\\\375V\334\272#\320\273\313\343\372.N\3724n\272\376\320\346\350\306\363ph\305O\275\330\224'%\270\"\007\317^w\017\333\266m\221>\215q|1\342\241\242\261!\003L\026\241\370\035/6\3657\276X\005\254P\305\313\271\312b\336\216W1\264;\332u\361\221!<\372\264\227z\036\317n\314\323\345Z\330\25081\3724\226z\024\337u\355G\n\320\244\210\260\007'\305K\301\271\312\364M\212\357P\247\356\304\243\330r\020n\022H\216\2326lN\274\212\265\022o\342}N\227\257\271\311.R6\321\3220_%\376\301\235"
+	.ascii	"\\\342\233\256\253\276\034\355\332\340\236\214\222A5E$<\250\213"
+	.ascii	"z\022P?\342\243\254\036\352\351G\250I\363\344\364V\217\341N\304"
+	.ascii	"\203x\247_z\023\342E\320]e\377\315]\261\246s&\304\367\337\207"
+	.ascii	"\007\361\247\037\007e><\212w\234\033\204\363 \327\354\360\036"
+	.ascii	"8\374\206\357\360\3429h\370\r\314\r4d\370\027\217\301\257\351"
+	.ascii	"1|\206_\362c\372\246\345U6\240\230+\326|pL\337\200kp\027\036"
+	.ascii	"\303\237$\274\271]\250rs\234S\225\311=\"\"\247\366\323\251]\310"
+	.ascii	"\251\233\256{\314\310\2040\310\251W\274\030\367\220\205o\003"
+	.ascii	"\263\364\026*<\205_\3726\"k|\205?\357\224\236\302\027/JI\317"
+	.ascii	"~\215g\232cD\272\225\026\372\244o\275\275\b\364\0305@\372.W\231"
+	.ascii	"\244\306\245\303\356\034=\222\321\027\375\321\267\221-\201B\250"
+	.ascii	"\201(#\221bH\321\210\210$I\222a\r\241\005\304\030\006\035\232"
+	.ascii	"\007\022@d5\213c\3201\022\t\305na\357\377\013\343\255R\305\037"
+	.ascii	"\376+\227\374\313\304\005\305\004_:\306\207j\006\3211Z\177\311"
+	.ascii	"\0135\225G&\277\3601d\301\346\276\231,0\t\304Au\031\016\274N"
+	.ascii	"\266\225\217\264\340\262\200\272\2416W\211\353\345\246J\202D"
+	.ascii	"r<\252\t\245\370\3051\355fI\311"
+	.string	"\276\371\341"
+	.string	"\202bh(\3767\217\363L\217\023\201\222\204Y\177\245\213_\353\341Z%\345\017q\262\306\225\202u\027\226\303 <\b\252\376\207\252\263"
+	.string	"\371Ms>\210>\330R'\231\344\325 kJ\353-\375\260\215\377\022\333\266\366\271L3P\326D-\344\0223\367\261\016O\365\037ux\026\235u\231\225\374\313*\017\025y2\037\272l@q\246\036\037\255T\310j\277O\211z\323FE\244S\272\207^\221,\244\f8E"
+	.string	"\300*\016\357-w\252O?\006\334QQ\030\200\223\037\177\024g\204:\262\213cO\317\206"
+	.string	"0\017\254\356\342\032*\237\021\301v\213F\262X\0267\265\336\251\bC\371hDm3\372\272\232\274\354gKJ\267m\224\273\020yY\244_\025a&\343\254\031"
+	.string	"\226\203\227\023\303\230\003\225u-\362\025tY\373\241\007\353+{\\\002\301\234\370\310\335\372\t)\264)\\"
+	.string	"\2320L \326\344w\323z\362Z\246\255\013\313c\375\261\346\036\237\354\307\241\361bi\203\201\243$P\n\244\271\300o\202\277\362\274\270,l/\005'\272&\221Dy\352\362t\371\231\006\024\305_\344\304\233(Q4\020Z{\227\207\375;q\316W7\375lh\212\356z\337w\021\223a\351\363\243\266\033;\344\374\265o\335A\220\326xH"
+	.ascii	":\336\001N\\\341r\312xz\232\2711.n\3052?V\337\005\024m\341Y\200"
+	.ascii	"\2147\265\221\311/W_A\327\223yM\364\002}\006G\226U\232\307\364"
+	.ascii	"6N\300L\212\033\262wG\311\336B)6x]\013\205\346*\002\372\273\314"
+	.ascii	"\246*p\305&@\216\263\260\306\244\304 \007\346S \242\036\\\n\327"
+	.ascii	"\332\026\267\024\227\244h\007\304chO\0212\242\374\373\302\212"
+	.ascii	"\203\361\033e\005\241\022\257\026\316?\276\025S\203\205\356;"
+	.ascii	"\320\211\022\366\374n\363\004s\264\235,\371\003"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.105.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 \374\345\006"
+	.string	"\"\r05Pm\222\016\244DX(\243F+\032."
+	.string	"\220\001M\001xZ\215\366\252\315jk;#vv\305\r\344av\334\314\"A@\364%\013B,\024\034}X\373\233\310\024k2\026UQm\254\327\201x\340D8\274\tN\203\304\323T\326\313\020LQl\252\327\241\250\352a4\330\034e\026\200\022\033\241\315\314\2066\254!\025\271\344\222\266xs\215\235\356\333\245S3"
+	.string	"\003\344J\257}\\j|-0G\277;\235\273\026\201\216\223\254\021\005BQi\005\232L$\036\277\3471'(x\276\252q\210\006>H\241\021\025\b\265\227\033\275\352\256[\2202`1%f\237:\200\005\b\341.f\027=\373\033\374\007\177F\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_servosFilterInit.107.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"e\013"
+	.string	"\326UP@\020Q\225\016\030\216@?\322\201\007\201:"
+	.string	"p|\234QVo\321\005\3345\"\260>\314\033\021\265}\373TF\372\377\300 \326\356\306\004\001"
+	.string	"\371"
+	.string	"\220\306\200Ka\244\"\367\b\320\276\222F6\2212\245;"
+	.string	"<"
+	.string	"?"
+	.string	"\236\035\362\320c\005|\2504\260\260\261\273\232\216\360\322\373\245\351\371\022\314\344\003A\2772\020\327\360\351\001\034]\225\335\275\352Y\002E\231\022\314\356:?\320t\307\333V`\333\200\375\002\001-+\312>\353\326\247S\322q\202\006\370\222\214\335\017#9\266\025[\2248\353\366Q\370\341S|\345\235e\027_\323\236\203\307\307\252\306\356Z\036M {\254<"
+	.string	"\366x\035"
+	.string	"\366x\212\003io\026\362\237UAG B2\241\232r\007Km"
+	.string	"2c\2248lw_\321\311vG\007|\025\007\271\340\223xt\206O\376{\364?\330c\352\002\021/n\254B9b\207\242\324\224\b\214\016\001\030\034$\330<\234\246\313\234\271t\233\207\323t\032'\002\204\215\204\007\032\205\r\203\tZ\206\353\264\313"
+	.string	"o\0254\234\306\3316N\243\204\241+J\365o\210qj\205Tti\312\017\377\020\244SHZ\256Z\262'\001\017"
+	.ascii	"2\003\006:\306\022\003I\217}OX\336\0073\240\313\214?\025O\027"
+	.ascii	"\314\262\312\362\322Dp\356\001\\\216\032\304\037J\031"
+	.text
+	.section	.gnu.lto_filterServos.108.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`\345\003\245\033"
+	.string	"v\263\263J\240\326Q:$ p\031\3243F3Y2\363\321\377R:/\307\006\256\344L\250\020\303%e\320\207g\037\336F\323\233\036o\355\376\2240z\320X\t\256\037\347\340l\260[\013\211\362\265"
+	.string	"\027x\213\363Y}\321'\204\354-e\222\001\231"
+	.string	"\223"
+	.string	"\245"
+	.string	"\\\262\335;\355\211+;\375\323\241v\217Z$\257,\352S(-)\271Rk5p\272\005\312S\233\317\214\247\363\265\361\264e\273\333\345\n T\201\020,\005\361\025\267\324ZmMc\313O\342w\344\335\311\221\316.y\267'\027\304~@\240\223\2234:\202B\003\372&\216W\027\214\023\203x\\\n\236\302"
+	.ascii	"]|\316\002HX-h\300\336\234i2c\353\3053\021P\210\273\f\276$\236"
+	.ascii	"\215\200\276iSk}\323\t\3448\0222"
+	.string	"\223\013j\255\313? \213o\354\273Kcw{v\033H_F\272\207\373\343x\r\341(;iw\306w\207)*=\006\333]\235\003\331)k\355%\330S\375G\317\336\306\351\202\300\361\177\247{\334x\372\326 \334\372\202\342q\330.1\210{\350\345\244(k;i\227\246\344\225)yk\217\372\322&oL\311;+ye\223\027\246\344\215M\336r\362\222$\357Hy\351\310;)oO^n\336\003\230\355\330\002\276\250\253\326\025a]j\026\255\272\361\250\177\367\373\036/\232\270\324\016\220Rk]\023\253@\351\304\245v\304\022\006/\270h1\3511\330\222=\353\373\276\300\264L\307\231\354\236^\363\232Z\202\005\323'2\245\354X\267\227\246+\331=\275f\311\207\026$\247\363\270\332EQ\260\025O\2528Y=\t\203\006\016\370?\b\343i\331$\223\220\353\013jl\262\333\212\357K\r\323\336\2250a\374ol\233^\003m"
+	.ascii	"\356\236\275K\241\002\377G\333F\250\201v\177D\367_\225\205\373"
+	.ascii	"P*r#\0270d\3100\236\316\376/\310\335\335^\206\256\3608\254\303"
+	.ascii	"\207l(k\2558\373 \027\302!\347v\033O\271O"
+	.string	"\374\203-B+_U<\016\353\2462\n\313s\243\343\371\311\301\331D\344p\270\334M\300\362\224\360\020\241\334\333\215.G\302GGg\373\341\331\351\t\361\301&\242'\007g\273\371\350l75\233\033\241\343c\373\311\345|l2\"\357\235\324\364\243\320\262\312\342u\020\331\303\215\241Bi\232\326(\r\234\326D\213d\244\365U\021\223T\026\255\317Zk\035{\270\030\230f\255_|,\306\325Q\224\256\226\265L\023\355\0368\255i\272fJ\205\325\020RLo\223\r3JY\377a\221\351\230\t&\344\232\212BEc=\353Z/\017i\t\342\260e\0338d\004g\017w\326\262~\361,\f\306\bF\250Q \346\2302\0041\"\024\210\310\214\226\354`\002)S9\036\021\320\255E\264I\261\264go\337H\3354\2148\002e\233#\304)*X\313\213\"\317\372\261j\2179\347\256\277\211\217Z\355Y\217U\251e\241\002\325\035"
+	.ascii	"\255E\022&\325\006\270\247T9X\345\024\376\013pgK\204~0\363\273"
+	.ascii	"pjQ\321\376\0342\025\302\202\024\\~\001S\302\221=\232#\177D\320"
+	.ascii	"I\017\261\026\217\232\177\251iV\337 \264d\357\200O\026\3435j"
+	.ascii	"=\367\351\370\017 :\234\265\026\236\234\342=\314S\224\037M\037"
+	.ascii	"\356\276\376\246"
+	.text
+	.section	.gnu.lto__reset_template_81.1.111.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"\264\0027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\030\001\177\344\031\001\334\013\320\017\350\007?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"@\260\312\021L\273)\255`\240\b"
+	.text
+	.section	.gnu.lto_servosFilterInit.part.0.192.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`=\002\325\022"
+	.string	"\026d{H\340\360&\035\3006\321\021\b\204\227.\200U\242\255\236\210!\224*U\300\332\257\034\237 =d\263\\\rU\225\2263F\327\253/\023\f'\265\026\037\3429\032\3158\006A0\310\334\376\200\357\201k\346\371*\026\261do\271S\nc"
+	.string	"i"
+	.string	"h"
+	.string	"\237\252\013\350>\345A\272O\317\374\346\222\332\214T\364}Zv*\365\371\036\333\255\231]\366\215\207\266\r\341\351\261\220c\332\335\357SC\330\273\fo\215\256K\215\323\345\337\347"
+	.ascii	"b4\232K\211\272\231\035}\320^\322d\t\207\207\347\036e\264\232"
+	.ascii	"\250\036<\032\036A>Q\007v\327\336\206\273\273m\025\333\t\354"
+	.ascii	"\350\n\250\350)\273h\235\321QF\337#\326J\234"
+	.string	"v3<9-\210)D\342?\217\263\026-\313\310\255\2056\234\343dE'\230\366\025\216x\305Y\314X&$\264\341\240\212lADL\273\341\367\351\320S\373\236\271\n?G\315\310\377\371\315\317\341ZV\275\302\245\315\356\343\343\302\243p=\205\207\2768{\f6\236\233\322\356\216|\232\200\0271\253`Jc_\006\205\017\244\230\355\230\0231 A\332]\223\030\037j\340\340\344\244\373\234\372\030\207\250\252\267\001S2\312\205R\274\335\227\001\037\306\203V\374\235O\263\254V\335g\324\003\211\270\371.\376\002\202\277c\0270>\366\351\203\335\347\365\271K\0235\243\246ZM|\262^\201n\232\202\242\352X\247\311\022\254\2045\307\356\002n\251\240\202\300s\n\311\013\030\303Zy\371`ZXV\021\036|\022V(._\n\353\345#\02118a\205\365\301\200 \353K\331\216\327\034\333\377\205\032\035h\324\250\215U\252\216\347\2109\362"
+	.ascii	"I\261S\2512\333\366\356\241Nj<\302%\275\342\016\353\345\356\256"
+	.ascii	"\252\216\355\002\227\332\251\bN\246\003\366\301&>y@\274\252*"
+	.ascii	"X\020\037. P\002aL-6h;\332Ii;\270.6\017\210\355\270j\357\202"
+	.ascii	"\"\253L\213\300\230\233\247g\234X\033\004\357\222\260\300\302"
+	.ascii	"\332In\357\001+\253't\0340\"$.\3371\020\332\240\t\267\345\313"
+	.ascii	"8\266\261`\263\323,\271\313\272\301Z\372 !\234\037\f\262S\330"
+	.ascii	"#]e\364[\257\020\210\206\343\306\273>l\256\211~\327\034\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`#\006e\032"
+	.string	"\306g\223I\200\226N:c2\216\r\343\321\364\3002\322=\362=\322\267qS.\345\370g\346*\347r\001\340R\320I,DHck>\356\300B>\334\326\030c\2141\306\223\257\300+\304\366\230Z\241\363\301\363\357\216,N2[\311\222D\246|"
+	.string	"\203"
+	.string	"|"
+	.string	"\024\016\346u\\\233p_vJ\270\030\032\341r\020\356\241\234\017\356\23788\034\252bu\263\331l\002\335;9\033\260\rT]W\366\352\347\262\362d\360-t\301\247<\356\f\207\231\317=\225s\3708\002=\254\362\364\374\260\203\023\336\237\355\034\r\275Q\347_\350\177\236\272\256\352\025"
+	.ascii	"UU\325\234{\265\263\177f\325\233[A\025\334w\235\253\022\353\277"
+	.ascii	"\277\027\222s\342\216V\t\356\227\347\377\236M\267i\272\270\257"
+	.ascii	"\302-\206,\256<z\226\321\265V\234\213x\"\250\212\033A\377\246"
+	.ascii	"\342\222\222\021\261\250\030DLBpf\241\212\356E\364%C\037\023"
+	.ascii	":Y\212\037Aq$Agr\342JP\023OR\342\336\215\304}\3339\342u\"\356"
+	.ascii	"\327B\274H\025\210{)\347\007>z`\250\016\347\302\201kl\340\025"
+	.ascii	"\325\300\306\267\f\367lgM\016&\022\303}\224\363\306\013o\302"
+	.ascii	"rl_S\026\356\315\316\033+\234\231>\f\r\300\216Yy(EG6C\323/,/"
+	.ascii	"\311-\021\037\fk\331v&M\003=k\246}\255\317\257}\254\362\367;"
+	.ascii	"+\323\372r\371k\2343\177\315\311!Ls\032\217\257\271\355\361u"
+	.ascii	"o\fj\207\220\327=a7\357p\363Xn\256\250\2720\235\267\323=\035"
+	.ascii	"\215\373\273\246\313\354\214\373-2\356\2650\335_\211q\217e\351"
+	.ascii	">\213\322\375\\\361\362\r\030\367]\222\356\233/\356\355\220\356"
+	.ascii	"\337XU\325\007\347\225s\342\216V0\006\232\203\254\274\264\031"
+	.ascii	"H\222\251Z>\232\21695a\332Og\\ \212\312\255\323~b\235\332\264"
+	.ascii	"\231\222=\204i\027Y\244\366\2108$T\323\0168 \0067%L[&\371\222"
+	.ascii	"\346\023\246\275(\344\332\271\322&J\373\307\227\366M0m\231\226"
+	.ascii	"\201B\262|\274\r6\217\r63\201\301\337\335\212\374V\260q\316\f"
+	.ascii	"\266\022\313\314\243jN\352-\260\005\244\005h\257\005\354\230"
+	.ascii	"$\377\272\354\206|\031\200\200\250q\024\207=+\221\231\024\024"
+	.ascii	"$c\240\002\251\261\2619\021\240$I\235\032\031\tD\202\214\024"
+	.ascii	"t\223\f\344\351\236-\265\bqf!\fG\306\313g.\037WNd\253\264\236"
+	.ascii	"p\005\201\252\347\352\376\235O\n\003\223z\331\225\024z\353\t"
+	.ascii	"\275\234\246pC\220\240*$\370\020\003\306\237 \274>3$\013eOUW"
+	.ascii	"-\314i\307~\024\301\2645N*\317f\267\360\022\027\263\330\231\247"
+	.ascii	"\343\274\351\3558oz;\316i>;\261\312\346u\033\371\227x\203\274"
+	.ascii	"R9\345\260X\305\220\331\214xlL\254\341\340\337*B\240w\307\242"
+	.ascii	"\261\271fXI\304\f\323\221\201\216\220$\365\261\260\253y\215\217"
+	.ascii	"V\233\271\246\353\202+K\321\007\364\312\212\003\032:X\327M\030"
+	.ascii	"\365y1\373\204\247|\355\"\243\342\377\205\022]\003\214\330\235"
+	.ascii	"\321\bJ7m\360\202\035\007\346\t\256\032\375-V6\211<\210\360\371"
+	.ascii	"\303\341\312\265D\025"
+	.text
+	.section	.gnu.lto_.refs.56b531b0ce8c6e70,"e",@progbits
+	.string	"(\265/\375`M\002E\021"
+	.string	"&'oB"
+	.string	"\257&\351)D\225am\202A\034\023\227%\246\242APD\034\356"
+	.string	"\232A3\250\211\236\017"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\bD\330\003$!\016\203iN\306\367\276\365\274\331\374y\350\257\372\244\215|\373d\267-ST"
+	.string	"\\"
+	.string	"]"
+	.string	"\035\r\340\332C\352\035\3227\323\267R\267L\217%\274\244\202\\\277\354n\324s\324\361c\217\274oQ=\356[\350\361\335\221\347\006\216\327\227c\220\265G\366\215\367\356}\333\300\255\374t\276\334[\236\357u\307\272\243uP\373O\376\325zk\217\271\3259\021\333\267\034\004\177\216\013\026\245\377&\37365\"@\270\037\306}\213{\026\367)\236Gqo\"\340G\262_e\037\342\371\223{\220\324\213R\017J\375\007\365\027\352\023\365\r9\300\311!\354A\246\356\260\236\246\216\246\236\256\023L\200&\210"
+	.string	"K\220\004\017\340\bb\236E\244\347(\365\017\366\027\366\215\324\023\373?\315\214L\376\036\262wy\337\222\235%_%\373I>I\366#\357E\262W\275\317V\037\222\375\364\036s_\n\375\350\375Gv\321\373\220{P\350?\357\001\251;\023\363\301};\204\276\0346h\310@\372b\270\220\275\026*\224\276\024&\274\257\204\b\252\336\027\325\367\201\252Oc\206\f\030/^\217,x\341\212\305"
+	.ascii	"M\250\202\305\024|\270\300B\301\025*@\003-\320\013\341\245\306"
+	.ascii	"\213\221\323\002g\205\212\033\0246&jJ\220\240\231\t\321~\231"
+	.ascii	"\230\326\207i\357\222\337\322z\203\366J\353*\355QZ\037i\277\312"
+	.ascii	"\317ZG\265?\345c\255\233\332\203\344\177\264.j\317\221\017\312"
+	.ascii	"\376!\260H\311\343\334\2448aS3\"\0136 \020\243\261m\033\373R"
+	.ascii	"\340B\031\352&\301\272\217V\0356\230\020q\202\t\021'\230\020"
+	.ascii	"q\202\t\021'\230\020\304\225\212\242\375`\214\276\263\b\006\032"
+	.ascii	";\231p;\306h\342\330\352Jv\235\231\354@\230\2201\357\306\330"
+	.ascii	"M\230\260\022\302\212\331\254\\Y\001\266\355l\214\233h\305.s"
+	.ascii	"\306\300\244B3e\3316f\307+MS\bl\017"
+	.text
+	.section	.gnu.lto_.decls.56b531b0ce8c6e70,"e",@progbits
+	.ascii	"(\265/\375`dZ\255x\001Zu\242\210T \016\245\234t\276\272\256s"
+	.ascii	"&b\"\253nnv\366ow\277\252+\253ff\257H\367\272\357\352\353\256"
+	.ascii	"\376\373\372\356\217\247\274\335M\220\253\310\250\2148\340\032"
+	.ascii	"\311\333\255t\377r\305h\307H\317\334\333\303\245\032\267\f\253"
+	.ascii	"\223\355\034\274\367\314\021\346\320\022B\310\336r\247c\007z"
+	.ascii	"\b\257\b\251X\372\224G\372\224+}\252\225\376\315e.\311\205\304"
+	.ascii	"\257\361\337Y\336s\177k\351-V\317ri\260+\360\246\3324n.\013t"
+	.ascii	"z`\177\316\226\023zg\331\261B\322"
+	.string	"\344Ic\237\306\202\305\003K\262\361\037\r3u[b\220u7\270TY\361!\377Z\364!\251\330\b\355pC6\224>\322B\032I\277u\222N\353'M\245\207t\224\236\322q\355\326F\372J\023i\262\266\322k]\245\313\272\255\315\232\255\223\255\326\312\226\322g\275\244\225t\223v\322h]\244\231Xe\3035\362=\326A\216\233\251)\n\356\252\261,]\026\004\216\234Y\226qmi\251\2516\313\206\263l\254\337\216SOv\362z\201\204\353\312\262\264\177P~6\356\220,~!\261'\"\374\266N\007\026\373\367d\323\336\b\265`\261\260}]A6\\\377h ;7g\035K\2209\347wT\217\265%<lZ\233]\363\222c\372\205\300\242\b\205Y,P\372E\016-\313\250\337\326\341\230C\346\234\374s\372\253\323\"\263\344\267\177\275\324\002\271\306\276\261i;K=\271\311N\n\3313\262\360\220B>l\232\245\313\202"
+	.string	"\231\023\373\327p]\303\266Y:0\n\224\225Y\226\271\260i;7\347\033n\2209'\377\032\256\263\320X\327\215#9';\004u"
+	.ascii	"\202\361r\227D\003\370&-\3209\202\3759\217\366\245\r$\r\025\362"
+	.ascii	"\367B\257\361Q5\351Q/\351Q)\351Q\265\364\350\216\364\350T\372"
+	.ascii	"\323M\372\223K\372SJ\372S-\375\231$\375I$\375\331#\375\351\225"
+	.ascii	"\376\204\221\336t\223\336\264Ko\276\2457\215\2447\305\322\233"
+	.ascii	"8\322\233T\3511\2334\310\002\235\r\243cXeP\313\250kz\261\325"
+	.ascii	"\370X/}A\266A\347\377l\320y\f&=\246\222r KA\320JG\260@\347qS"
+	.ascii	"\372K&\275\223\266\364oD\322_\261@\347\257V\372;\225\376\316"
+	.ascii	"\002\235o\277\364\215\227v`\177\316\367\\j\333X7V\311\301\366"
+	.ascii	"\335\362Y\270\003\235\222Y\231s\222\007\b\006\215\r'\215\337"
+	.ascii	"q\351-\207\223\347\357\357\357\317r8\337d)\266?'\bV\315]Z\003"
+	.ascii	"\313\r\223=\016:l\3004\035I\203\306v\371\273bk4\267z\226+g(9"
+	.ascii	"g\r<{KN\3004\266g\354\322*7\330\274\314c\365\300\232\254\032"
+	.ascii	"\277\203\244.\310\331n8\355"
+	.string	"\337\237\335p\376\026o\003j\004\016\307\0163\034\360$\261\246t4\376m\0312',\223O\032\217\301Y:\373\272\322\370\255#\275]\222\264i7\211D\325\274\336\374\366\213\025c\303X0Vi\357l\227\333:k\247vg\237\370)\340\027\272\275\263o\226\356&\3372\300\244o\251$\204\b\366\316z\261i;K\311L\205z\375]!\203:t\350\260\023\326'&u\001\337\216Im\266@g\217\226\224K\220\335\023\033{\323\370\226-\275\002\246\244,\230D-sN\336\302\375BZl\234\225\273I$\220\205\227\213e\316\371\277\335b\263\3309\253\264Z,\225[7\253\366N\346\354\224s\026\272\325b\245\330\266\233|\313NM]\006\200f\246\205\037_\316\311\016\035\202:\230U6\276\314\245\370\267Vn\345,\226\025\262\2064\313I\n\253\361\025\214\265\345\353G\343[\254\324V\021\272\265\362sVe%\263\223\2343\017"
+	.ascii	"\242\304\3015F\355\317yK\225\336\005\351\221\322\257\220v`\201"
+	.ascii	"\316\223 \315\261?\247e\263P\254\362\003\033\345\326\211]\273"
+	.ascii	"\311\224\314\311\234\223<-\346\267\306\244\361I\244\267\037\234"
+	.ascii	"\367\357\317~p\236\002i\217\005:\333\376\234"
+	.string	"\247\263@\247=\263hV\311\201m\362\020\"\374.\241\345\262\234\223<:o\220\274q\323\370#\244\267L\256\241.\213\360\f\351-\007\247\375\263\034\234\357\364K\013t\236\317\002\235\2775\373m\022[\366\301\205\222\342\312NrN\372\244NS\330\312\032?i\201\316\324\376\234\377E\n\303\2427`\200\013\346\277^\234L\034{dO\360\363\307E.s\377-\332\3627\n\177\257\340j\371\2377\202\2777`\200{\360\3433\177\243\270d\255\302\r\360\013\277\t\374\233\006\032\376\315\025\315S$\200\277G\360\325%\236\207\202\354A\327p\n\374\346\321v\331\242\377\ni\302\201}r\202\337\016\377K\344Je\371-[\006\177\017\341\371o\f\271\2771\374\255\341o\237\277Kp\261\374v\002\177\377o\364\357\364\35713\026\317\032\377\177\320#\256\374\226i\003\006pq\343\232\344Y4_\3417U\370\233\330E\327\255\r\320G\343\262"
+	.ascii	"\305%\373\240=\270*\210\362\020~s\005}\364\337\266\017\242\030"
+	.ascii	"a\270\377\252\340\344\177\236\nm\374\257\332\230\223\331\300"
+	.string	"\377\240\377\033\274\004\021o\261Q\224@\277e\263Tp\214\021A\332\377\022\317\3407I\374\215\342\222Y*bn\217\326q\223\377\300\266\345 \341\ni\034\027\352\267q\266\312\222\377M\372\256\222c\370M\006\374\215\202\354\3573$}\202\213\342o\016\034\261G\260\376\236q\215\374\267\005E~\313\364\277\304U\301\377&\007\300o\036\300\242\340o\016|\360\022\317\371\315\002\374\366\350\277D\326\256\020\334!\277=\361_!\177w\370;\333\370mQ\303\r\362\337\036\355b\303oj\370[\307\025\273-\\\271a\027\354\362\270;~k\367\333\272\277\275~~3\003\177\277y\375M\307\344o0n\177\277\251\375\375d\306\337iTc\177[\371-\333o\235\374v\355\267O~\333\344\267\312\337\252\3756\212I$\311\227\b\377\325a\2137\376\213\340\300\037\243`\311\306\335:\001\207\255\302\363\235\377,\301\377+\377\265\374\307\362_\t\374}"
+	.ascii	"\255\377^\376\203\371\177w\271\377[\276\374\347\362\017\376o"
+	.ascii	"p2\307\340\307k\377\375\371\257\206\377b\360\337\f\377\355\371"
+	.ascii	"/\206\377\002\375w\303u@\373\375W\347\277;\267\306\377\236\377"
+	.ascii	"L\301\177i\374w\306\177e\374w\352\277Q\377u\301\177Y\370\257"
+	.ascii	"\361\277I\377%\376\327\350\277+\374\027\004\377%\361\337\t\374"
+	.ascii	"\327\001\377\035\341\277 \374\367\303\177\r\360_\017\376\273"
+	.ascii	"\301\1773\370;\314\337v\177w\371[\356\357+\177\303\375\315\366"
+	.ascii	"\267\332\337N\177\243\375\275\344o\263\277\223\374\215\344o#"
+	.ascii	"\177\017\371[\310\337c\177\003\371\333\307\337b\177\207\375\375"
+	.ascii	"\365w\216\277q\374m\343o\255\277i\374\235\365w\214\277\257\376"
+	.ascii	"\236\372\333\305\337,\376^\361\367\322\337,\370\233\205\277\327"
+	.ascii	"\277\215\177'\375M\374\373\350\357\023\374m\364\267\b\177\023"
+	.ascii	"\375]\202\277G\3607\007\277\245\362\333(\177\207\340\267\304"
+	.ascii	"\277U\370m\t\376\376\300\377\276\377y\377\365\376G\371?\346\357"
+	.ascii	"\022\177w\340o\016\374\275\201\277\031\360\267\207\277\017\360"
+	.ascii	"\277\304\337\006\370\337\344o\002\374\r\200\2777\370[\203\277"
+	.ascii	"\203\376\006\3766\315o\361\376\243\360\3331\277\025\363\333\273"
+	.ascii	"\337\206\371m\225\337\272\375\266\355?\211\337*\371\255\217\337"
+	.ascii	"\026\177k\202\337\202\340\377\336\3774\377\321\3747\363\277\314"
+	.ascii	"\1772\377\313\376\263\340\177\226\377\035\374\375\375\375\375"
+	.ascii	":!\374;[\376\t\220\020\027\320\220U"
+	.ascii	"\2544~\217\036\230\203\301w6\347\234\263\362R\236\b8rTq\370q"
+	.ascii	"\230\343;3\211\224\344\214\036.\\\270`/=\271\251\214\337\222"
+	.ascii	"'\353K\330\026\273c/\300/N\222fu\377\201@&4Y6\352p\027\0333\226"
+	.ascii	"\326\306d\027acr\230\316v\001\022\003\210[\343\367\254\245x\313"
+	.ascii	"\206\013nlYV\215\337#$\315\242$\223cK\343\367\350H1\026\250\035"
+	.ascii	"a\311\306\357\201\221&q\336n\254\305h\214\253X\"7\272\224\215"
+	.ascii	"\337\003\225N\301T\200\\5\230"
+	.string	"05~O\236\002g\225\030\356V\001B\345|\025\002\022\2535C\370rU\225\207\363\340%3d\031y\341\326\306\306\317J\221\306Q\322(-x\031i|\036.J\260,m]\022\255\26722%rBfX\220\177hsr\313d\021,K$\026YEnYv\267\035`\316W\222\2749\301i\370\tf\303M\360\032\206\202\231`5\253\304J|v\254\304K\356\266\343\224\314=P2Vo\260p\262\336\240\3562\340\363$\323\363\214\245\347\371\221\236G,=\017Xz\236\257\364<]\351yp\244\347\331J\317C#\275Eb\261\217\343\"\330H\237\261\371\251j\204]\3302W\305\360p\236\247\364\370\007\006r\214<\022\023Is\316K\311L\025$\244\313\232!|9+\213\003\332B\t\r\033C\216\211\374!D8^\035\r*,X\310\316\325\215\251%\026\202\203\340\3051\255\301\313i\324\032\016+<\326_v\310\200"
+	.string	"Y\321\370;T\322\377\366\375\237\231\251*\347|e&sUS\316\371\333[\323Z\016\277\216\275v"
+	.string	"\377\361\375#\200B27\225\351\221s\266iR!nLZ\035d\223.g\247\256%\ntYA)\273\254|\240\234\272f@)\273\254|\240\224]y\311\351\307\222OU\356Z\202R\346\354\223s\316\331\311i\251\004.+(%S\366\201Rf\253\274\242\316\312\346d\327Rv\342\312>\331)3e%\227U\007PN]VPJ&+\037(e\227UVv\345\236\354\304T\025\345\224\253|\262\262+/+\271\254z\240\224\\VP\312\2562K&\n\r\037\2140=xD\261yPN\371\305\324\026SU\017\035T\222+\337\345l\235<\345\252L\227\363"
+	.ascii	"r\336\342\252\272c\232a\337\232\350^4Aa\342\262\311\234\363\206"
+	.ascii	"\251&/\256\354D\267d3\035\324\020\256\234\2074\031\345\251\234"
+	.ascii	"s\016a)I\227\303,\335\222\216\255,\365\224s\0069\231\363T\316"
+	.ascii	"K6\323\345\234\227r\316h\325V2\347\032=P\310\251\251\234\263"
+	.ascii	"\202\246\362\326\022\334S\316\355d\314\233\025\224\322\213K\b"
+	.ascii	".M\211\314,\222K\026J\212+#\363]WU\252\\:\313R9g\213&EZ\301\320"
+	.ascii	"k\374\235\032=\304\226X^\362\314\270&5\236\300pX#)\373\221\245"
+	.ascii	"\361w\242\300\360\016\034/G\272\3204\276N\037\376\322\201\275"
+	.ascii	"\200e.v`\341.\253\304^8\307C\210P\206\2750W\230\325\231,\234"
+	.ascii	"6\260>\031\030_'.\275\316[\372c\034\370\006\366#3\203\201oX="
+	.ascii	"\313S\003\313\207\215 2}[\346\032\377xK+\001S|\354h\254\365\333"
+	.ascii	"?\\\343n}~\251\001eG\343\316\230\006\236\201\363\004\211\246"
+	.ascii	"\255\261\024\276\332a\352\311\371G\226e\026\306\262J<\003\317"
+	.ascii	"\3001\260\fK\007\206\311\242,s\316\0356t\300O\370\274\344N\031"
+	.ascii	"V\317\242WT\316\2444\276\016\224\364v\355\005\026$\266\3020p"
+	.ascii	"\225U\342\253\037\273\350\027o\270)\253\267c\346\314%\207\304"
+	.ascii	"W\230\312\352\3550%s\325\005\261%2U\202:t0*\371r\223\342\353"
+	.ascii	"\374H\257\003\226^GGz\035\033\351\211[\340(\314\306\303\215\213"
+	.ascii	"\232\343\250\377\256\271|\030\252\201i\210,%\033c\026)\220\273"
+	.ascii	"\250+\215\257C\225\376\307Kx\005n\302N\230\311*\361\323\365\373"
+	.ascii	"}s\377\324\3308\201s\243\004\331f\t\362\366\335m\307\251'\273"
+	.ascii	"`a\206\3149\343'\234\357f\351\234\344\025g\b`\223#\214\026\276"
+	.ascii	"\234sN\336\226\227\271\034\374\034\275\324rY\2403\203\3759\237"
+	.ascii	"\343%}N]\372\034\272\3649s\351s\264\244\027\002\366\347\264N"
+	.ascii	"\204~\325\334\267*O}{i\360\306\376\322\344\375\246\371\257\336"
+	.ascii	"Ec\365\354\206&\272dcKg\201\316\r\354\317y\227B\277y\r\304I\226"
+	.ascii	",\215u\316\\\274\223\005\016%\227k\346\027\357n\235F\355\371"
+	.ascii	"\265i|\313\b\375\232\201\200\230\016\262\306\227L\\\352\306D"
+	.ascii	"\007\305\255-\t$\023\206\265\024\343\346\243\307\231e\337\205"
+	.ascii	"1\321\300\314\3024\276a\376+w\263\\09\327\216\315\254\255\361"
+	.ascii	"\2276[\202\332k\374\034\267\264\356\316\335.^Y\2269'\353\256"
+	.ascii	"\0269\244\227kg\225\267\356"
+	.string	"n\351\320!(\345Z\243b;\361\177\273\320\001\373l\2648\022\005\270cG\230\334\230\313e\202\333\250rX\343\347<I\237c\226>\347G\252\301E^\021\372\305\222\203\346N\211\244q\006V\252\240P\224g\302H\371\255\362\337)\227\312\215[\001\203)\345\334\356\031\254\"T\215\321\245\3759/\234\320\257\224\363\r\033\027N\032\363\274]\255K\0165-\270\265\2751\201\255h\034%\307K\2154p\215\237\223#}\277P:I\232\331)AvU\335\022\005\240\221A\271k\367\311e\273i\267\311ub\225W\3552\271\255\322R\267jM\327X7\211D\325\232\312\2269\347\253v\317\362\265Kr\205\004\276h\302\324\324\203\237c#}NU\372\034\246\3648j\322\343,\323\377.Q\322f\211\233 \215\225\374\3775\313\341\252\312Nza\3044i\\\006\246\006\252\251\361q\356\322\377\367\310Er\311\254\362&\271cA\311+"
+	.ascii	"\251%t\223\\ 7\311\rr\215l\320\004\225\231\274<\020\002\247\204"
+	.ascii	"\214/\347$\027\336\332\227\024\377\327H\221+\345\215^^c\"C\300"
+	.ascii	"\364\2464>N2\275C\256\220\206!&\f\257\361q\204\244\307\361\221"
+	.ascii	"\036\347+=N\215\3648V\351\177\177\200\235\301\001\241k\374fq"
+	.ascii	"\301\356\f\333\326\004\307\322\315\205j\201\306\335\262\261\\"
+	.ascii	"\323z\215\206\305\227\036\177\235\246\333|\211-\257\216\333\302"
+	.ascii	"\r\273=\356\216\373u}\\\257+vyX\345\005\353\276\337\034\267\353"
+	.ascii	"A\311\234\235.\330\265q\271\356"
+	.string	"YU\372\244\311V\324\245\262tY=\331\251IX\335\255\272X/V\200\3315`\235w3#<U\001\237\276\370X^\260\233E\242\213\2216A\270.7\211a\200q\266@\347\223\366\347\274qq\354\210!\361\270\2267\276\\-\036\274\033;\344\032\377\302\225[\343\030\215K\3472amQK\177\201,\375\205\0361\256\f\030\230NJ\355\002\215\0300r\334\262x\201q\365\013\243\r\207\r\032\027=\032_+\274\005\245\305S\343\357\331\264\377@\323KM\031\267\306\27705u_H\345\234\321\271\371k3%u\341J\2138(\027\277R6m\347\r\227Z\343\357\335\026\377\201\326M\216)\254\305\333oG\f]\225\027c.\213\013y<\272z4>\260Jz\253\274Ow\305\216\025\333\030\267\306\377\315\277+\376\020\"\334\246\324\211\023\274\251\306\267\251/\323u\372m\272K\017!\302s\234n\023\316\231\311Z\001\354X+"
+	.string	"3\316\007\023\223\023\037\370\226~\257\377\376\003/\02483G\376\336"
+	.ascii	"}\231Z\006\235I\306\326\024i\374\337*\333\257\373\2229g\275)"
+	.ascii	"Ur\343\003\227\244\007\376h\303"
+	.string	"&\313\210\222\034\215\233\257\235\256\352X4>P+\375\277g\225\275FMN\336"
+	.ascii	"\227\251\362\327\327\270\367r\230\260\332\2724>\360*=\220\t\215"
+	.ascii	"m;g\254p\303\326\370\251\232\364i\231\345\031\023I\362\223\306"
+	.ascii	"x\311\013X\354\236b4~\312%\275-\353b\365\274\312,s\316b\332\213"
+	.ascii	"\365\273gU\251\032\0231vVo\207\251';5\215A\366\213\026\323uV"
+	.ascii	"\317\213L\207\351\2736\323c\232L\227\261\312\026\323_p2g'\026"
+	.ascii	"t\215e\006\331+ZL\203i\254&\274\214*\261J\323e\007?\205\222>"
+	.ascii	"]\222>\005\222>au`\347\233\323\317\354F\f5\215\373x\206P\351"
+	.ascii	"\300\322\370\032d9\335\234mN*@\246(i|\r\340\322k\240L\223\346"
+	.ascii	"\\c\3212\225\220W\222\033G\226\264\2513;\325\374\\\263\327\204"
+	.ascii	"N\311\271\207\245\247g\242Y\264L\225\301\314J\t\031\237\216\034"
+	.ascii	"\216\247\275\306\327`\305r\211\327\004q\335/=\256\220Gr\316\342"
+	.ascii	"`\367\350\326\316\344\215\371\230\023/(\315fL\244\226\251\332"
+	.ascii	"\223--3?\361\360x\320\244\344\3304>\313X\211Z\342\327\370$s\267"
+	.ascii	"+hQ\226~\377\201\347\034U_\233\306\317`K]\335yg\3212\325\006"
+	.ascii	"Br\274\301\312\t\2634\023&\314\317\273\273\345@1\355\2315>\355"
+	.ascii	"N0^kb\260N0\347\0278\035`LQr\372\264\364\302\234^\360\331\035"
+	.ascii	"\322EF\307&\367sN\356\244\263{6\231\263\270\226\364\n\200#K\020"
+	.ascii	"5|\031j\213C\321\016\034Z\270\374\244\323r\3765y\353:\267\240"
+	.ascii	"a\276dAk|j1\265`\220\031\222\345\007\346\200i\231\323k\374\f"
+	.ascii	"d\244\317\340E\\\334y\305\242e*\313d\313\005*\206M[\322\312\317"
+	.ascii	"+v\357\251\314\255\361Y\305\246\321HF-\357F\244\r\311\223\306"
+	.ascii	"\317 \237\375lrvN\271v9y\t-S\241lI\200\004\341\313PY\034v\\\234"
+	.ascii	"\351\372\202\362s\312O)!D\270\031\342\216\264\264\306'\334"
+	.string	"m\030\2324\250\306?\335\316\267\037\b\034+\003\345M\343o\350\222\236m\t\260\321&G_\343\237Q\376\003/\200\325\371 \322\270\355\343\316\223\255\247\244\020\261\321\370|\3623\377\201:P\316\300\266\032\177\357\\\373\017\274s^vM\215\317\264S\315*\237\345trVe%yv\244\260X\313\322\370\033\344\322\333g9_`\237\345<\231\374T\376@\240\224\033_]\215\277AJ\372\237h?\020}\002F\013\331\370\033\242\244\337\220v\226\235e\347\222 \256\245\274\002\314\260\023\033\302\227s\026\007\234\260\0310\234\032\377\247\222\237Xp\204\324\250\313\321\3704\303-\374\007\362\304\250r\263\265AF\372\237d'\231%\303!JZ\266\347\246H\343op\n\362\363H\220\263\306Y\265BfK\343\006\375\243{;\323\370,r\032!2D\310\231\364?\221'\362VqaFUi!5\005\354\347\01702&5N.0\216"
+	.ascii	"i|\3668}\210\265\020v$\375\317\035\347\016sI\016\255\201W\204"
+	.ascii	"G\343\007u\2357~\3528o\2345L<\001\355\354\266\226\271j\313\303"
+	.ascii	"\216\225//\277\306g\327\351u\3468\271N\034AS\351\177n\235[X\313"
+	.ascii	"o\3167\312\274\205)\251\361\324\370\032\334\210\271\311\306l"
+	.ascii	"c\272\261JS\314YC\250)3\205!\300\310\231u#\326F\2541\r\224)\f"
+	.ascii	"\030,\215\257\001/\275-\3533\337\224Y\232\177d\232\316\025\226"
+	.ascii	"\016\214\002E\270d\323o\203&(\023\312\306,\377\316\253\223\305"
+	.ascii	"\331\306\267<\257N\246\273\030g\3269\343\224qZ\2350N,\253<\257"
+	.ascii	"\316\247\233mL7NB\347\325\271$f\231s\222'M\022\265\031=\330\354"
+	.ascii	"\273\231\r\232"
+	.string	"\240LP\202w\2768\253\254\362\244rrR\235P\347\224\245\313J\346+\234(zo\322l\350\240\243\347\345N\353\304\3779uJAI\362@\323\370t\201f\315\310\262\242\3615\264\245\377\031e\225g\213\343\355\035\201s\323\370{@\034+-x\261\245\327\320$\275\206#\351\351\224~Y\332\230k|\rA\322k\370\221^\003\217\364\032\272\322k\250\221^\203\214\3647\337\230~J\2714s~m\267E\252\251\3615X\245\235\264@'\007\373s\232{\346\032\223\357\007\362\220\275\355`k|\rQ\351M5\377\201\033h\201\013[cl\037w\232hn\246\371\201\235\005\br\252\36158\2457\363L\275\037\270s\367c\355\254\3611\350Ko.\331\376\322\320hl\236I\2370\300\373\340\202\2156\034Zcn\236\371\357\262\231L<\025\374\371\255il\2261\315\334\3043\311\230x!p\345\314d\342\361\364\345\314\304c\255"
+	.string	"\254\025"
+	.string	"&\363\002\362\344\304\307@Lj\335\204n\216\301\231\253\262\\\322\370\030L\371b~1\303d\265yA\321\022\006\346\306\255\360\006\206\330W\343c\200fg\347B\210\026\2534\265\230]\276\304r\232\\\r\201\302\345&\335on1\347\372\353J\220*\215m\022\241\233\\x\354\334\366~4\276|\026\350\234\200\3759\217\201\016997\f\254\246X\2459\305\274bBO\316^\\p\256\244H\215U\271i\3457\251\230q7n\0052Z\244~4\266|B7\253`\035j\250\2024\356,\013t\022\240/\212U\232QL\270\240\236\234\277\242\264\335\235\371\302\246\261\371\366\233mv\311\2153\253\256\240\3605\016!t\323\355\b\225\034l\032\357\330\237\363@d\326\254\322\\3\3318\364\344\354\325\207\314U1<\264\351\260\330\241\206\312|r\343V"
+	.ascii	"\023\346\246\246\361\201\346\224Vi*M\265\240\234a \300,/\206"
+	.ascii	"\207\266\025\254x\261\362\324\344"
+	.string	"f\332s\2740I\211i,$t\263\211]\342\346\314J\343\003\275\245gg&\0320\347\275S\306Y\032\207\305\354\253\261\2116&\304K\312l\311\022\233f\3212\325\205(&\0365El\2105>\320\230\231\031^\223\346\rcWj\tkG\343\003}\245\277\231\304L\202\265\0309\3039\343V\204L\343\003Y\231HL$x\r\220%K\240\247\3647\213\230=L#\370\006\005\242\204\342\3162\360\245\317p\227\3767\210\362\006\301Z&pe\253\021\214\234)!\353\302\352\323\022\2424\205\340\271F\313K<lyd\252\244uo\242\3244~\006.\351o\216Y\2459\206\243\032`v\026F\013\020K\033-.\215\237\301J\372\233@L \027\317\004.\246\261\021\222t\331\245A\3210\345i5~\006d\372\233>\224\246\017\333\306\201\213\211\311\003#zuo\251\327\225\033+\032?C6\305L1\274\306L\0302geq"
+	.ascii	"\"Q\266\3313y\230<\314\260\r2\362N\262:'HL\260\233an\324<!\362"
+	.ascii	"cgzY\245\351e~\201\220e\313\0030\351\305\354\210\251\003\343"
+	.ascii	"h\003c\017O\211\t\223j\374\037+i\216\034\033\254\254F\314\271"
+	.ascii	"!i\374\037\264\3647q\2308n\025\fU\030`Rc\231\253\262<\364\333"
+	.ascii	"\233\261\306\377\321\221\336\334\262W\213\362j\261iAyI\257\003"
+	.ascii	"$\326\246\235\246\226\251\205\327\370u\214\0254\276\032\377\207"
+	.ascii	"*\375/\220\013\344q&d&+\020\220\344\310\036~\023\013\313\314"
+	.ascii	"\272P\\\371j\004#c[\036p\332p\271\2332g\2309\320\370\365HB\221"
+	.ascii	"\322j\213k\374\037(3\206\031\003\257\211\200\232\331\262\213"
+	.ascii	"\2178\034\215\217\301\317\2442\251\314+\023\2262\354\035\301"
+	.ascii	"Xy\262\272y\365"
+	.string	"8\2362\344\332\227\306f\025\232e\316\013G\343\357=N\006\\\222-\215\217\001/\375\315\251[\2459\205\345.\024W\206\341A\226\261\235>\033l\364\032\037\003\2274*\312t\001\314\363"
+	.ascii	"\315\322y\304M\013+\215\177"
+	.string	"\263\305M\027VO\307L\214\034M0\217'~s0\032\037C\221\3647Y\230,\254\237\t\\LW\0050\353r\305\303\316\026\213)7\215\217AG\332d\256h\302k\316\234m\222\213\252*gUq0\235L'\274\306\346*5\347\2141#\0357\354\032\037\003\214\364>n\322\037\277\261J\374\306\\\262V93ey \344\354\004sFw\326\330\\\372\361\237\231\261\230\325\362\345JK\343\363tv\351\217\331X%f\203\373\272+\003\313\306\220,sU\225\207\276\037\267\301np[g(r/\032c\310\026\350l.\373s\336\307\212\0325x\315{r\316M9\337\260q\3228\303k\352\206\374x\322\370>O\322\037\247Q\3424=\307\201+_u@$\317H\033\235\"Rht5\276\017\223\364\307z\267J\254\207\255\230\300\225\257\020 \304\252\353\006_\316Y\036.\350 \363\364\242\361}\204,\227\226\214\t\225\263\325"
+	.string	"\316\214\351\264\200E\r\222\306\367\341\302\303\303w\235s\316HT-\f\312\322gE\372\3432V\211\313X?\0232\323U\001l,%=\274\207/\375\361\030%\036c\321\230P\231i\314\003#]\262<\0048\304\241\320\b,\"\016Q0$4\2260Z\207*`\240\036\231\020\256J(\004\371\340x\300\203\f7\372p4Z\205Hj\021Q8\342\302\215>\034U\242\"Rp\310\bb\350\304\206\013|\340\204\022$T x\201\0228\200B\220\204\021A\022'\370\254\352\021IE:\325 \016\022P%*\242\260\252E97\372"
+	.string	"B=2!$^\340x\202jTZ\205\352\211\236\023z\222\212CCc\211\343\217\210\0244\260\016\211'\374\2508JJ\252\200\317\221p\310h\025\"\2018\256C\023 \224\210E\tH\241D\034\036% \204\005\004\0270B\n\020\353\221X\0342O\254\304\241\361\350T\001\211\205\"\342\320\270\036A\250DJGC\304!\b\343Q\t\004\006GGJDb\221\210\256AU\005\303\343\311B\321h\264\026\211\350\t\241z\204U$\r!\251H\347\215>\250\260\300\252b C\217\006\031\250H*\222"
+	.ascii	"\024<&\025I\360Yo"
+	.string	"\364\241(\tDQ\322\020Q\t\207x\242\315c\260()g\r\022\213\222LbQ\3225Z\213\210\352\321\251\252`x\304\307\243j$\"\022\242*\222\212C\330\270&]\"\225X4<\022\242D\352Q\t\037\321\033\203EI\037t\214B\243!\254\302\270\036\207E\352\b \365\250\2108$\321s$T*ax\244\232@\024\036%\031\207\025\300PD\034\252PD\034\2528\022\221\241\347\004\013\f\215%t\216E\304\341\321\003\307!\206c\221\360HD\021q\210d\024\342\034\327\241\221\005\234\037\365\310\204\260\204\016\b\037xR\341*,\201h\230\204\336\350\303\361\250h\\\211\305\241\340\320\006DD!\022R\221\204!#\360F\037\206\202F\020C'\002p$*\242\300s!\305\020\005\"aQ\003>G\034\016\250F\245\fC\034 \025\327\243\022\tD\302\342Q\206\343\271\016\211'\034/\020\213\303uH5\016K\330\021a\344"
+	.string	"\n\304!\222Q]U\"\016*\322pM*\0265@4L\301\247\007\204\017\253Q\230\364a\035\022O8\252\020\032\215\025\320\200\223#\\\205%\f\031O\036$u=\252 \021\304P,\221B\251\002\031\020\325u\035\032U0\217\030PW!Q\222\022\2065x4\252GJ\027P\211\224\326\341\272\n\201\326uU\203D'\244(\232@I\254D\325hT\032\362Yo\364\341\004\bb\021\t\2518\024BE\037\203Fu=\032\212 \022*\245`hb\007\004\023-d\242C\230h!a\207\020\266P\212\016\221\242\205T4\206\017\035\203D\021\253zTG\024%\001}hhT\211jQ\372\020\026\220\200\005\214\220\002\375\b\016"
+	.string	"\301\001 \234\037\301\001BB\016X\200P\372\005\b]\241\017B#\004\325Ux\224\204\244\256\301`\0065X$<\022\241\026\t\217\0360\252H\303\265G\r\246P\211\210'\334\350\003\210\342P\303\221\320\004\322\260hG%*\"a\026\204\306{\243\017JH\303\243\243\242\021\033\r\255\303$\223\005\241\212{T\225\216\204(\316\365F\037\210\206IAHJ$\3561(\\\205%\034\207)*@4L\322I\301\236`K\260\"\354\252\036)\031\3611xT\217\224F\344\250GJ#v\326\024E\023\367\250\026\031\205\253\016\016\221\252&\035\315\365F\037\326\034\024r\314c\320\250\246\030\"\241\306\342ZD\272PDaTI\250G\2454\205q\r^P\223T\224"
+	.string	"\301\b\0229)\364\254D\245\"\t9\352*\034atT\215'\324\021)\214:\3065\005\242\b\341*,\201\005\341\b\"\241:b\310\210c\\S\300@\024qTZ\205+\t\343\232\302\317Q\261h\201\240y\f\252\253p%\241\"\rW\242\322\210\024\306\036\242\210\343Q\035*\032S\0302\366\254*\006\206\214\030\326\340\232\022E\034=\240\"\rK\250HB\243\210!#\217p\025\226\200#\\\205%"
+	.ascii	"W\244\242Q\304\t\f\307 \222\320(<\252CF\245\"\t\"\365hTQ\250"
+	.ascii	"F\036\342\020\351\246\020\"]\365\210\210h\210t\252\253\320\210"
+	.ascii	"o\364!\205\021DQ\322O\n\343\205$!\322\220\3214\252DC\024Ec\022"
+	.ascii	"\221\232\302x$\034\032\325\243O\n\365(I\251\204\023GB\243\013"
+	.ascii	"\304a\007\301\"\245\243\244 \237U=\252F\"\342\320Dp\025\036\203"
+	.ascii	"HJ\306\025\005j\322Q\203\034\365H8"
+	.string	"ta5\252(\210\303!#\321\020\311$\016\221R\024\f\251FC)\204H)\317\361H\210\202X\034\256\302\243b\222Q]\211'\f\0315\034U\325X\244\226\240\036\025\021+\200$$\001E\322\t\fDGE\243\243j4*\241\256B\024\303u\250\002*Q\021\005\343P\030D\034\016\251G\245`\n!R0\205\021'\205\2220\230B\210\304s4\026\215F\025\350\\\325\343\211\023E\0345I\305\352\263\341\304\211\342\2524\004\200\3430\2050X\244dB%Z\225\222\210C\rj\222\2125\250\242\030\256B\024C\243J\264\201\261\270\016\tO\004\213\253\2220XD\034\032\255\305\"\32218d\f\"*\016\215jR\360D\322QPE\022\032O\004\207\214\307\340\360x4n \032\006\327!QI'\304Q\n\343\221g=\nO\004\211\224\204&\202G%\023\307\035#\361\030La\f\252G\245\340\211\243q\210g\r\206P"
+	.string	"\n\216B\244\3401\250\022\r\215F\025E1\230tD\312"
+	.ascii	"]o\244\001\t\253Q\270\222(\"\016\211\214B\026\214E\021G*\221"
+	.ascii	"(4\032\342@g\275\321\207U)iU*\006\221XH\002q4\252(\206F\242\016"
+	.ascii	"^LR\215 \326b\321\b\002g\r\242\307\"a\211\342\360<\006\213\206"
+	.ascii	"'\210E\022P\250%\034\217\224R0\252+Q%\241G]\205#\220XH!\007\205"
+	.ascii	"Jt\327\340\002\204V\342P)M\201j<\021<\036\205I,\024\217\202\030"
+	.ascii	"\326\340\b+q\250\204^H\210\204\016<\260\001\f\244C\037\216 V"
+	.ascii	"\243\242\341\321\t\020\304\241\020\t\304\220\361\b\342C\006E"
+	.ascii	"\024"
+	.ascii	"F\365\030$R\221\214B\242Rph\\}\376\243w'\036N\253{B\022\006L"
+	.ascii	"\031\233&e;\\D\274\304u\227.\250\227\274\007\254hq\205\344C\275"
+	.ascii	"\240v[|\344u\241vh\235)\205\253jKz\243\b\036_\343s %M\016Q;\002"
+	.ascii	"\206\013\035\232\306\327v5w\336\245<\202\314\335\330\202\373"
+	.ascii	"\032i\206\fL\313\224N\036\231\232\036YP\031V+\306\225\016\271"
+	.ascii	"\271\016|;\320\032\243V\320+G\261\034\305\322(\226\373\367w\232"
+	.ascii	"yQ;\341\340\3208\004X\261\263\253A\345h\\\334S\2314u\215\321"
+	.ascii	")R\234\244?\372\206\357\370\344\276D\271Y\2775<:\027\215\321"
+	.ascii	"'\350\0234\212\025\301\006\n\345h\024\017\316\220\315h\214\262"
+	.ascii	"\331\264\026\222\264\360\204\203\261\364G\327N\"\177I)'\330\212"
+	.ascii	"\024\0324V4F\321P44\r"
+	.string	"\270$\346\305\033\223\243ih\023\024:\234h4A\225\351\017>,\262\026D\370\210d\245?z\3665\027#\314E\022\215\242[\362\027VV\206*\361\300)\347\247\254\342\207\027\333\322\354\250\222\333\245\312\2255 \034<\245?\232\004\3435\032`^dh\026\320\223\372Br\256\341\271\343\372\222:\222e\005Yf\344|\303B\315\232Y\033;\2525D\344\226\250y\235i\334$\007c\2531\372\003\375\201\006\261UUz\003\360bs\205\344\313Y18\374(\220\243A\320\261;\346H\222.t\fE\242K8\260\360u\217\267*nm\322d\031\025\225\030W\017\265\013RP_~\210\261a$^ob-\230Wz\310\030.f\302\314.c\246\344\210\200\231p)\024>#H\036a\314\034Pa\320vh\321\332Q\303\n\325q\364\213G\017+\207Vc\264\013\3652\202|\"\246\361\255\362f\360\204\224\221\242\2441\312\205\346"
+	.ascii	"C\256M9\363e\025\337\020\27618\316)\350\213$nv\3340\227t\304"
+	.ascii	"\200\2109\331\300D\2600\371\321\205n\235K`L\021\213\323\362\302"
+	.ascii	"\306$\217Jc\0324L\264\257\037W\310#5\336\3245\376\006q\350\f"
+	.ascii	"t\006^\323\304\307\025\322H\032\034oI**T\206E\313T\017@cW\343"
+	.ascii	"\310\005'\032y7b\034\225\361\270 b\226|4Fa<\216+\315\215Fc\364"
+	.ascii	"\352q5x"
+	.string	"\300`k\214Z=\316\315\332\022/\215\321\rj\240.P\027\350\324\024&uU|;v;Z\270@\245\216N5\021\351\021\005\307\351\0341\363\205F\343k\200\207\346\243LhF\243.\030\267,8g.\316\2724\376\321\025G\243\216B\205\020\341f\216\024\001\303\324\030e\361\235\254-R\226\215\217>]\020\362\2454\322\370\t\370\017L\321\260\254\254\032\243NC\314H\3455F\233\036\227\223\025\206\217\007\272\244A\0306l\3167A\\Ky!\230\301)!3\201\004\206H\250\343A\204ZH\252\305(\2142\244\030\"\032\241I\222\016s\025@0XD\036\026\312\266\315v\023@\003M\214e1\321\202N1D3\")IAI\2450\314\001f\360c\233;<@\0275gm\274\302\321[\336l\370\264\033\224\037\215}.\266\017\251!e2\372\026\372P\264\236\340\340z\030\250\255\212P4\246\273\307\350\007\2707F,"
+	.ascii	"\357\250^\200\224\027\\\313\367\226&t\357nQ\321+L;V:\371\261"
+	.ascii	"&\030\340K\250C\"3\004\271A=F\233\244XS\325e,`\331\207\256\250"
+	.string	"\335\207\364\246/q\002\252'\220\246\310\232\350\2638\241\026+\242f\216\300`\376\213X\273\255\220c^\247\243\002\323\300\362hEa*%\271\304\361d\256/\200\013\007~\223@\240<\004\rL)\274\232\315xS+\317ps]\033U\341\034P\2141\323\255h\325\307d\340\205\022y\243\031M\\\300\222\002\312\r\364\265\303#\371W\316\363\300s\033(\021z*\212\247+\351\026\351\372\247\343\262\226\273\216\326Pu|\322\260\006\242w\222\032p\315YR \305RDV]\337\355s\210\267Q\b\315\372\304\3606\r\355\327\265\b\242\251\304\334 &\005< \377cz\244U\316A\210\021\200\370Y\374B\266\365\003Re\275\332\200\036`\372\256\343\027\261i\002c\tq\335\351\357\240-S\b\354\002\247\250\251\025\356\r6\b\271O\002\327\275\334\300\331\354,\356\206\265\263\250<M\233\262\252\004\017\001s\212D[\300\205\276\035[k"
+	.ascii	"o5\256\352&\304\3336\200\177\267\341\2454\3321\b\311<\317\223"
+	.ascii	"\371]\330\267Gw^e\210\300L.p$\235\307l\221\r8\273gmgw\355\b\355"
+	.ascii	"\003\376[X\210\245\b\342e\3479\302\204:8^\257\004\305[(P\302"
+	.ascii	"\005\351\227\212Ey\002\223\336}\362(\323k\230k\233\\QN~\017%"
+	.ascii	"{h\202\3652\254\242\211\304\356\024\211zw{\003\310\354\035\250"
+	.ascii	"1D2\365\017\335S\b\022\236\234G\237\235%\023\350V0\222\033\240"
+	.ascii	"8\357o\267`\303@D\242e\233\357\336"
+	.string	"\f\366\202k\021\324\n\033\356e\332\336s\b\371l\262\213\236\357\260+\243\320\274\225\311\214\253\242F\367\004a\3511\023m\312\234\026\345e79)\247\037\222\214G\254\201`\350=8\364\222}\374\211\031;\003\313w\227_\375s\336\220}\301[\261\351%\243Ul\222\312\276\314\006Mi\237\270\r\"4\323\363H\006\td\243b\b\221\364 3\237\377\022yTP\025\220\355\"N\024r\301-\226V#\177\315-,x\336\006<D\351x\270\272;\032\244h3\320C\024\255\364\344\3577<\302q\277\f\337\275\361q\344\013s\301&\374\306X\271e\254/\343\021(\262\203tQ\202\033\343\305t\214\321l)\223;\317/\227g\360@(_\355oA(=\316\267\267\304\r\316y\177P\331=7\307K\355\373\204F2\234`\335\016\344\262\320\360\206\354\260\374\254B\342\364J\255\256\2410\302\033\005i,>F,\002.oa\221"
+	.string	"]w\233\004a\"^q\310\222%G\331\022\307\334?\354\3235f}rr\177\3627L\322\211=\274\216}8\357\273\253\340k\215$9\265\005\35082^\370\265\022\305^m'\265c6\247W\365\004\232\375M\016\267_\235\200\007\373\001\244\260\215\353~2\377-\255NS\373\227\362\036\314\026\324\364/\025\f\215\340g&\342\355$P\375\230\214g\232>Z9.\274\202\2224\327\003X1\313\271t\200\312\373Z\250f\\\365\243%8F\353\235\327\2179~\367\t\310\347\036\031D\255\342\202g\003\f\330\207(\334FS\342"
+	.string	"Zb\223`\263\273*\f\210]X\361\210\002\3771\r\034\3070s\365\2435uhX\347\3257\215%\006\016K\236\220\207\035\343x\231\357\304\206B\341\223`\230C\335<\214\210\371!\324X\277\313H3\214\311\314\203\265Cwo\255\035\273\276\271\367\271s\020\247\354\232F\312ew\365\255o\f\304\241\017-)\361W\257`\275\3413\345b\247sxM\324\355\270f\313et9\234\310q\217\340\r\2040\034\303a-D\354\023\003}\271\\\177\310\342D\214\022\027\004\031\300\202\375\003\344L$"
+	.string	"4(H\325B\301\f\243hC"
+	.ascii	"\n\352P`\262!\364\3440\244S\260X/\256\222\026\355\t/!2\250\313"
+	.ascii	"x(\246`\357\233\360t\361\302\231\231'\330D\031\307,\257\035\263"
+	.ascii	"c5\365\366\317\371H\317aJ \266\236\n\3379:\b\202\0327w`0\n\353"
+	.ascii	"\311\347\367`\354}#j\364l.\032\304\360\356\331\213\224\267\t"
+	.ascii	"\342"
+	.string	"aEU\336Q)!#\347Y\360\2426\340\322\034\305\006~3\312j\227\246\311\005\b\007\336\262\017\334\177\001\237\021\027\003B9G\005\262\221HY\tvQ\037r\225\216\207\t\024u\371\007D)\344LX\247\314\243{\351\313\317B\215/KE\232\320\316\345h\204`/\355\313+h\365AQ2\034\3274\247\327\305\247\n\344\2653)\252"
+	.ascii	"\3075\024P\370\003O\302R\327\200H\236\2754I\205(\327\303;\223"
+	.ascii	"\220\r\241`]\352DCT\361\245/ \322\207\220\035BO: g\375\003m\030"
+	.ascii	"\253\305\337\006\211\030\340\240\002``\362O\034 V\205\274\373"
+	.ascii	"\214j\242\310L\036\354\363\361\202\037Rf\035>\215\006\006|\006"
+	.ascii	"\356r\244[(`\356\304\204\214\356\374\327go\257V\362\234\312^"
+	.ascii	"\352(_Z\313\303rR\365\326\212r\017nN\320\036\245\360\374L\007"
+	.ascii	"\337T\267\202\352\222[\373\f\3210*2MUt\333\035\224\341v\260\336"
+	.ascii	"\325c\254\226\227\351\327?\371\307i\345U\266R\360\364\2753\363"
+	.ascii	"\303y\202\314\bG\267\233\302j\354'Nu\310N\251"
+	.string	"\373T\034%\3176\236%\307\237\275x\260)\314\357\212\315\323\325N\302\352/\335J\232h\025.@{\305\335\306\035\236\326\252Q\343\2648?\252\234\f#h\362\035\032\027\215\305\017!\202\2652\203\274|\343g\2435\215k>\366\236\004\233\005\274\270\207\013\372\3524s\302\t(\003\027\365!W,db\377\006!\227\347\261\326\222\333\264\325\036\234\253w\272c\305*`u\004\232\356\242\304\004Y\201b\f\200_u\342m\203\342\250\00345\372\r\206X \246f\234\247S1\005#\\\321\357k\364\356\223\255Ig\377\347?\261\224\350-\247FU\241\316\024\315g\370<\222\353\350F\326\366\355f\3763c\016\226\350K\233\034dE\036j\276e\206QR\373\001U\266\206)\274\bb\327\212V\177QR \001\204\204\302\334\342\222\301\243\006\276<\240\246\243\230*4\367\351\267\300\2706\002\027<\236EXY]\016x$H\023\314"
+	.string	"\241\003\nZ\305\372\223P\363\265\216Z\324 V\267\213s\001aC`\250\031`\037\"\316>\017\240\340\024$\210\201\322\256\364\254\013\334Gb\250bV\323\330kk\211\022\377\326\317\262\334\324p\304U7"
+	.string	"\007 \357\374\300k\bIT\336\363\t\314\370\216\026\206\021ji\203\r\331\331\353m\321A\255\321\266;w\331U\021\3702\006Jg\255\3113\001\301G\275\314<\017X-\255\276w\367\2677\300\354\321Q \262XM\327\006f"
+	.ascii	"n\355\3061\371\n2\221\336\"\362\037U4\260\234\357RO\021\204l"
+	.ascii	"\037\017\212\322*\007p\241\351\217[1\232|\270\311\240\">$\350"
+	.ascii	"BS\270\325\354N\363s\177m&4\006\216\241:k\3719\372\005\031}L"
+	.ascii	"TD"
+	.string	"L\026H \033\347\030\326\222\335\313:RW\250\375B\302\215\272\351\201\r\341\\\312nx\bb\2672\314?\317H\231\2633\355\351=\2516\355>h\347\211\227`\232\261\360\236I\321\"\300\325\013\370\004\022M\371 `\377^\301q\356@\032\322\227=\303\214E\b\307.\322+\351\361Q\272b\240\035@6\207\022`)\334!\264I\rz|5\354\370\343\341GO\236\215u~\037=\333-\201\237\211B\317$`\276RV%\r\305\337T\355 \343\226_\032\235\272D\265\b\036b\357\366\330\3220\031\027\324\351\272\225\271\005\344\375NLC\361\231p\301\363\002OY\240\365\026\216\214\f\004aC?\376&\275\346J\211\330\342\304\265\006j\325\241?/h\226t\332\304\366\207.\332\223\223D\343<M\275c3\016\204y\234\231\356\034\225N\317\032\333\363\217\255\244\200\226b\334\352\274\230\224\331\211\034n\036N\224\212K\244>\030)"
+	.string	"\3711\304\3624_\316 '\271\254\354\373t\2758\006K\202\330\251!\211\224\344\322\256\241f\242\313\273S^\237\344\t6\340\017\017\226aQP\025\023\376\272RU\005\0069\255o/\373H\317\235\202^\376\311\027!\325\\\206\201\355t\324?\013\027\264}\361B\030u%\347&YaA\232px\232IL\247\2710^\206\273\\>,\364s(\262V\376\374{tn\346 Sv\0269[E\0054\356\260\0337c\366\220\264`\220\353y<:\273\203\036\337\355\342\317\226\017\271\022\205\354q\254A\311\\\021\245(\350k+m&Z\001\306\325L`'<7\201\275\356\2763\335\360\325h\264l\364\337_.\251\210ITK\370}g\233`\b\375\325\345>\2402>\033\217\210\030\270RS\321p\364q\t\264\213B\326\357\346\007\024\222\002>"
+	.ascii	"mb\202\353\202 \177\375\221\n\b\036$\217*\227\302\324\024\034"
+	.ascii	"M\037\350\206\217Wes\303\215\237\013C\177y\035}:\b\017\377\226"
+	.ascii	"\013\246\026\355SX\225W\220<\303y\327kwY\032f\026c\322\244\364"
+	.ascii	"\r)\331|.\304F]J\236D\220\343\237\247\271\307\375bY\217\316-"
+	.ascii	"\321\246\305Qw\034\222\211\260)\001#>\207(\234\347s\315H\262"
+	.ascii	"\247opU^\221\212b\253\234\024\267\007]\246\370\201[GX?_\336\272"
+	.string	"\3637\250\203\305\022\363\005\304\177\300jT#\356\256\n\252:\223\024\217%\2646e\241\r~\273C\354\030\222\002\260\365B\332\023\250\313:\300S\334\357\031\032\344P\210\346\353\352\367\220\022\327\312\363\201\340\316`\244S\023Yy}\3513G\005r\251\360n'\3067\035\3410z\217\261\246\001=\034Q\2166\347\016\321\337i\216k\202\260\204\300\024\275\271k\351\237 O\257ao#l\314\200p\237\203\r\025\273Z\311h\312&\310\232\027\376k\254\227\005Q\3073\177\242\235\316z\246b0\332\204\352g\242\222\331\215k\375\025]\247\321:\345\241Rzp\227\002\341?b\206\205&\202\375^\\&\220\260\265\0305c(\207\263\217Oj\2174\354QM\227\367d\350\351\037\234\330[\256\205\2267\b\2211\312\177E\267^5\205\261M\313\270\356\217\024\277\361\373\223\013\227\035\270dq\256\307\177\251\276\0302\037\001\337;IM]\366"
+	.string	"v\257r\234]\331\276%q\202E\207j\374\234\304\250\363\207\373>~\243\310\004\263\375\372\234?\240\235N\341H\232\344\223\317\357\210\307\236\031\307\237\026\336*\254(\232\210\263\367\244\301/\023\366\n\331\205\320\351\331)\006\036,\375\224\233\365\301c\320\322\213\023\326\024\357\257\321\225G@&>1(\373\217\236AN\373\361\206\245d\277\202D\247\260h\274\274\305\376\347\336\223\205\0360\375\364\266\331\360\335\257\311\032\374\377\260\327L~\252H\177)~\246\241\373\f\372\033\302\330\336\2657\320\362\214\267\372\332\320"
+	.ascii	"N\327Y)S\351\036\374\2153n\016\214\255=\253w\231\300}\264\273"
+	.ascii	"\003\212\375\311\303\217\350\035\t\306\225\005\335\314\031\013"
+	.ascii	"\346o\325\263\314\234\277\f\333\271\301\366i\364\003c\337\004"
+	.ascii	"\317\353\345\372\363\237\023K\206\217?\336\375XY\177@\366\341"
+	.ascii	"\2631\r\300M\310\231C\276\001R\3765\2671\366m\274\031\365g\005"
+	.ascii	"%\013BS\301\211\325\343\361\350\315\205\001A\317\322\354*>.\362"
+	.ascii	"p\024\267I\220\007\251\336h\353\275\210\366E\301Ac?\237z\217"
+	.ascii	"\030g@\310\205\364i\224{\023\332\364\2258\267\366\023\305;0{"
+	.ascii	"\025?R\337\356\200\275\263h\343\017\027\235n\303\344Q\370\035"
+	.ascii	"\177\337\335\375Z\367\363\341d\313\207\205g\257Q\207Y\212\274"
+	.ascii	" _\330\213\344\305z\261\274\220)"
+	.ascii	"o\315?\364\002\177&\321o\224\213\314pXb\225\357\217K\320\302"
+	.ascii	"lk\001a\013z\327\025\304(\351B\374\343\216T\334\263\203}\224"
+	.ascii	"\017\313\266K\322s\001\350#\260\223\242\0278\023\026N\344M\272"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.symtab.56b531b0ce8c6e70,"e",@progbits
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"servo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"determineServoMiddleOrForwardFromChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"servoDirection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"gimbalConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"gimbalConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"gimbalConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"getMixerMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.56b531b0ce8c6e70,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
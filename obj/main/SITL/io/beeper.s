@@ -0,0 +1,430 @@
+	.file	"beeper.c"
+	.section	.gnu.lto_.profile.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 [\005\002"
+	.string	"\324\002O"
+	.string	"\013"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\004\005\222\252\354\340\007"
+	.string	"\006\317\253\250\341\002"
+	.string	"\007\b\t\n\222\252\354\340\007"
+	.string	""
+	.string	"\007"
+	.ascii	"?\207\200q\201Q\301\020\225q\305\034k\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\370?"
+	.string	"\013"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\003\004\005"
+	.string	"\003\006\003\007\003\b\t"
+	.string	"\003\n"
+	.string	"\003"
+	.string	"\007"
+	.ascii	"1\007\203\3034\033\001|*\203\265\f\272\2016"
+	.text
+	.section	.gnu.lto_.inline.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"U\002"
+	.string	"\224\002\216\001"
+	.string	"\013"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t\n"
+	.string	"\r"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344\001$s\0249\233Kp\023\217\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\350?"
+	.string	"\013"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\004\002\005"
+	.string	""
+	.string	"\006\003\007\003\b\t"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"1\007\203\3034\233\002\301TF\300]\024\3137\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004\n\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 [\r\001"
+	.string	"pO"
+	.string	"\007"
+	.string	"\001\002"
+	.string	"\002\003\004\006\007\b"
+	.string	"\b"
+	.ascii	"`\013\330\0076\003[\300>\227\315@~\033h\003"
+	.text
+	.section	.gnu.lto_.lto.a26873e7c88d2a56,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_beeper.45.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \351=\006"
+	.string	"\022\214+0\200M\032\003h*T\026\017\320\253\\\240\005A\231I,\264(\036\021QAMb\344iJ\206\216\021C\bLw\3048\024\250\273;\222-\267\224)\005\217\001^\236V\250\3700\357-8hq\r\026\205\213\253D\007G\r\024b^t\017\020F'\315\233U\235\"\230D;3\213a\264~\376\277\254jW\202+\316O\32199I\033\331\220\332z\265\356\260\207\364\007D\243\377\202C\344\237\007-"
+	.string	"p\233,"
+	.string	"\271=\016\200\334*\333\022O\215;\2443\3011\371\357X\206\245\227\254\r\342H\263\311xQ\020\376wi6\026.s[\202\266\006m+\002\b"
+	.string	"2\003&j\006.\234\301\270K"
+	.ascii	"\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_beeperSilence.46.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \273\r\005"
+	.string	"\002\t\",pe\322\001"
+	.string	"\335\353\371\177\304\017\354\343b@\255:\221\303\205h\t\277\366\006l\002\177\237\241\252/\336\004^7\306 \360\240\305\275S\n\256\250\031\257\030\033*-\205X\214\207V3\242T\301\362\212S%RN\235\272=\344\016\023H\261\273\354A\215\375\300B\316~\212gD\273\227"
+	.string	"\200\035\tB\035\333\237\214\331\244w\2345x,\025Piw\025n\216\375a\376?'h[\3667X\354\256\237\266anx\333\b\333\t\333\216\b"
+	.ascii	"3\003\316\231\001\340\313]\303c!\364\313\270\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_beeperConfirmationBeeps.47.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \341%\006"
+	.string	"B\013*2Pm\222\016$\203\310\"\242R\020\232\324k\020\202\206{V\331\221\020\373\350+\345\372H\030}V\332\204\231i"
+	.string	"U\034\256]/*\246\276\307\332\270\311N\001\036N\004c\270\254\311\264\325Y\313!\331&9\233\206\207\3244\210\314\f\314:\253\245\207\261\226\230\251\207\243\202\t\004\375\364Q\250\361\007P\034\275B\213\333\030i/VTzb1\361\370\017\363+\365\t\n\322\201H\214m\006II;!| p\226\245G\271\251\243\004\037\025\024\")m\0239N:%}\027r\227\220\350s*`\241\355*$\302\270\361~\203?\177P\t"
+	.ascii	"m\21173\340\234\031\036\276\3345\034:\204\241R\223\301]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_beeperWarningBeeps.48.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \340\025\006"
+	.string	"2\213)1Pm\222\016$\203H\t\210\312\346B\004m\220R\374\231t\217\277X\266\026L\347'l\364Yi\023f\246\001Tq\270v\275\250\230\372\036k#!;\005\034M\004c\250\214\271\264\265Y\313!Y&5\231\206\207\3044\210\274\f\3146\253%\207\261\226\226WT\240\002\217\232\370\327I*\364\bP\005\372\34404\322V\234\230T\204\022\242\361\243\345O\351\023\024\034rH\254\332\213\017\220\366!| \200\224\335\223\340\313(\301FD\341Q\3226\025\006:Ln\304\016\254D\237\016\246\200\205\266\247\350c\201+\374\r\376\374=\001\t"
+	.ascii	"m\21173\340\234\031\035\276\3345\374\034BS\251q\340\316-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_beeperUpdate.49.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \363\215\006"
+	.string	"\262\f.1pm\032\003\240{=\037\020\205\346J\214\252\323k\322\037\226x\316\f5\tAI\001-\201\225\354R1T]\241Bi\204H\362 \332\204\204$\2212\245\036\206\267\231\026>\234\027\343\203\024PI\023_\347=\007\007'\307\231\0326N\212\036\247!(\354\274\350>\020F\207\2317\0135\023\301$\332\tZL\324\232\362\377e\241v1\312\"\221\277\342\304\344#-D\003\323\326\253\365\310\034\322\035\020\275\374\027#\220\177\"\364"
+	.string	"\300-\343\201\212\033\305\002\025\267\312\226\3043\343\005\033\024\023\037%\377\035\303\260\364\222\265=|\241*\220\227E\341\177\027UY\270\314m\r\332&\264\255\002\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getArmingBeepTimeMicros.50.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \314\265\005"
+	.string	"\"\312&0\200\267\351\2003\242Y\021\026~0'\262\202\302\216\232\301\032\361A\232m\033\343]\275\326\232v\032`N\006\244\371\202\252\322\203\367\241\006\236\032\331;\245\236$*+)+qR\021CQ.q\242\231(9<+I#\300\2344B\334\276>\021\006\005l\356zp\263\337,D\260\237\345[\267k0!\261\020\316\203\202m\313\206|\2067X\256\223\001L\213,\024\020t\021\273\\\214\316x\3564_<w`\302\353_\365\357\360F\227i\327\237B\262\273~\231vp\303\333~\330\206\330\016\b\t"
+	.ascii	"2\003\202\341\243\302Z\025\220k83\242]!\310pW(\355$\003"
+	.text
+	.section	.gnu.lto_beeperModeForTableIndex.51.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \360\235\006"
+	.string	"B\314-4PO\222\016 :\203B\227\301H\370\016\240\270\200\352\266\270\232S\360\324o\355V\212L{\256\251`\303\002U\0253\t\023\260k.\207\331\236\233\261F,\3312\005\024\017T\273\303\261&\31749\274\212z\021T\003\304\353X\022\217Sp\345\231\2547QU\326\323d\331K\332\204Z\305g l\243o&\233\307c\003\351\b&3#\346%Y\\J\310\377y\315\217\330\222U\026\310\354XA\311\314\204\017\002\352\376;R\222\317\027\203E\bS\020\301\2708q\311\314\336\246\004R]\246\003R]\373\350U\274nM\212\034-\"\fT\004X\310\314Q\204i\364\326\337\340G\3707\002\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperModeMaskForTableIndex.52.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \360\225\006"
+	.string	"B\214-4@o\222\016\320\036\243\237\361j\3267D\331T\270Zt%\235\002\036 @k7A\217\315\035p\305\306XU<y\216\300\321\316\235\211\024yf\306\232X\262e\n\024\017T\233\263\261\246\31649\274\212z\021T\003\304\343X\022oSp\325\231\2547QU\326\313d\331K\322\200Z\305g\037l\243/&[\307c\023u\344\222\211\361\322\222*\356\344\343\367|\346G\354\310(\013dr\244\230d\246\302\007\001u\377\r\251\210\347\213\301\002\204!\200\210.JX2\263\247)\201T\207\351\200T\327<z\025\257[\222\342\306J\b\373\024\001\0262s\fa\031\275\3657\370\023~\215\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperNameForTableIndex.53.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\355\006"
+	.string	"R\21505Pm\222\016d\364\214Y\312\003`\332q\240\350I\210\316\026\250\324\377\200i\017\373\267Y\213\333\270\260D\035\00333\255\252:z\327\303\005,$\017\266\266\233%D\246\021\f\327\333\323\311\254\217e-@\354\202\016\227B\003\364d\017\260C0\366\2612\b\201a\031\324\304\354VmBO\342#\310=\322\367\222\231\371\333xWp*\365c%S\324\302\222)\224I\307\257\275\346w\356\033R\021\255\361\223\00123PJ2\363`N\246\324\346\362_\220\226\264\267W1\021\302@\360\020Q\230N\231\021\036;P\225\312T\240*\3658\272\325m\267#\r0i\250\220\214@u\230\204\314\334Y\214.\372\353\317\371\r~R\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363Z0\361\340.(\325\240I\230"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_beeperTableEntryCount.54.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \313\255\005"
+	.string	"R\n'0\200\267\351\2003\242\271\025\330\00351\034\271\032\261\031\273\246\312e\373\315\231\315\267\245\3275m4(L\214\210\362+A\245\367\3340\306\237\032\331;\245\256(*/)'qZ\261bI(\261\242\226H1</I\343eN\032#n\017\267\307\247\f\324\330\034\366\340\200}g\341f\277\310\267n\027 \002b\035\036\006\003\333\325\216|\204'T\273\301\341\n\264\305\201\300f\341aw\343t\t\372\343\\\001\375\201\004\257\177\325\277\302\245.\323\260\277\004dw\3752-\340\206\267\335\260\355\260\215\t\b"
+	.ascii	"2\003\326\231!\340\200\\\303\235\021\r\013A\210\273Bi'\031"
+	.text
+	.section	.gnu.lto_isBeeperOn.55.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \302u\005"
+	.string	"\202\311$.pe\322\001"
+	.string	"}"
+	.string	"1\252\260r\326\347\207\202\330\022\256\200\344\212-\"v\237\275\031\033\r\335g\250\352\353\353\230\326[\020\031\020m\210\354-S\307\256:\2659\033\222f\022\2221\036\022\253\021y\025N\265Y\245\204\322*\255\333l\005\206I\244\374\227\203\221\363s\325q\363\303\352\033q\b\325\335\005"
+	.string	"\364\0270}\376o\277\365\204b\273\345\353\351\b L\205\224\352\2762v\3302\264g\0261g4\247\222\3071\034,\272\373\320\342]\370\221\377#\376\037\376;\002\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8\\\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\245\002"
+	.string	"\224\003\n\001"
+	.string	""
+	.string	""
+	.string	"\002-\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002.\177\005/\177\0060\177\0071\177\b2\177\t3\177\n4\177\0135\177\f6\177\r7\177\016"
+	.string	"\013"
+	.ascii	"\200\036\340\033\340\033\340\033\340\033\340\033\340\033\340"
+	.ascii	"\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a26873e7c88d2a56,"e",@progbits
+	.string	"(\265/\375`\362\007\265,"
+	.string	"\372M|\021Ip\032R:\007\370\225\026F\330\340\335p\\\236\"\270\303>`\024\330L\021\364\261x1"
+	.string	"\326ue\201\374\203\240\201\350\347vM\365L\004v\247q\251\336O\247\007\263(\253{L\204\\A\354S\203\001z\350\032\322m\311';\005\347"
+	.string	"\367"
+	.ascii	"\025\001\320\356n\273{'9\025w\357\370y\227Hd\267\224\001dO\265"
+	.ascii	"N\247\356\264\231\026\246|\231V0\320Y\205\271\354\247\270\315"
+	.ascii	"/\024\334\313F\253J\256\314vJCuw^[\227\312\032oR\225(7y\307\270"
+	.ascii	"\231=\027\007X\231T=\205533\225\314\265 W9\204\t\317\265]\275"
+	.ascii	"\325\035\373z\340\236\300\321I\325\377\326\307\345\005\273\334"
+	.ascii	"\225\346\220\221\204F\252\236\301\232\265\362V\346\312Rr|\265"
+	.ascii	"\013nfw\334\223sq\214mIU\241L`\247f\001\273\377Q\356S\325\023"
+	.ascii	"\236\256\317D;_&\332\321\251\343\346M\032\347\025\262)M\304\220"
+	.ascii	"\344\376|\225\377l\365\277+\3753\325\177\270\377m\377\331\376"
+	.ascii	"\243\3757\373\017\025\373\377\374\357\374\017\366_\304\377\346"
+	.ascii	"\377*\377\273\376\373\376\213\371\337\213\213\213\213\373\263"
+	.ascii	"\372\347\341\277[\n=\320X(\363\366\364\304\255\245\246\210z\310"
+	.ascii	"\240\250\201\221jy\006{\233^\367Vw+\340\201sR\303\222\252\207"
+	.ascii	"\223\275\376\363\036\244]\035I\325\263\353\277k7"
+	.string	"\331\3354tq'\233z\273\254\313\231\350\357\311\271\314\340\277\332\375\236h7r\311\266*\331\342\362H\325\377B\355\244\273\005\352\270\223/\263\252}\251\224)\201\342\366\021\324\314\037\375\306UJ\025\356\264\343\316}\254R\262xc8\371\306p\373\323G\270\355\216\225?o\323m\363\313\254R\276LX\t\324\307n\233\351\372X\217\260\362\035\003+\177^\246\253|\217UJ \250\245\025\325k\306\225\312\355{\354\031\310)7\371\003}c\270\321\272s\323\251\223\f\272\247\340$\232\233#\2075Ag4eq\341\034w\367\001d\223\025\334G\350\233\005wg5\245h\244\2046\206\366\220\fm\177L5\224S7\202\216\273\221\335m\356\352\222\264(X\315\264\264\314\306\206\025\025\335\355h\002Y\243\346\231-\257\235\271\332Z\373\363\232\314&\277\3115\273c \237\226\215 Eb\037\317Ig\311\215T\315nr\364Y-\267Q\223"
+	.ascii	"w\273Y\315\367\326\355\372r\036\312yH\205b\205\344k\247>\365"
+	.ascii	"Z\037g\002\2735\013\330\245Wgg\031mF\230\264(4\317hdx\200\370"
+	.ascii	"\310\202\221F\225\225e37,d\224g\204\231\2654\363l\226\275\322"
+	.ascii	"t\375x\377To8\265\306\332\306\3062T"
+	.string	"\250\273\235\332\005\032\026T\224g\007\331\330\32734\223\311\2455\201\"!\343\235\255Q5\333\254\317_\300\200\311bd\350\270P\225\231\205y\026\343\263\365\214\312\271\202\364$\342vEL,\206\f\035\255\r&]\272\344'\214\245O\0201\036g^\236\237:-.q\016+:\2538k\266\364\b\013\313\316,U\001\353]\362\334\222TG8\231+;ueYG\276R\3659\271>\177e,\317Y\270r\226\f\366\237\356n\352\016+\210D\fH\272!\210\"\313$\3441\016[\0203\274(\032\207\032\b\024\203)\222TV)\370!H\005S\320C\002\027\254\211a\007vE\211\240\210\"qC\220\021\tB\204\225\211XL\022z`\225\204\"\224\212\027\214,\212 \326\0304\2614\242\207b(\034\026\203$\0020-\261,\206!Qh\f*\025\205'\206\304\fAl\322\220]!\f\321\363\240\023\227\330\342\317H$\026\177"
+	.ascii	"vO\022\026\331!\213b\275\204\242\006EF."
+	.string	"vnt\364\340\350\301\356FG@\340Q\021p}\0210gDb\032\301*\t\215\253\021\311\3108\024\266\330a\221X\023D\017\275\003\201\031\204F|\340\260&9(\262K,[\342G\024\376\206\302\240\322/\251\310\364sP\340r\344d8\240\216\247\250\02355\326\200\300\3457\036\226\022+\250T\315oi\246\223\353<\277\3459\275c~S\273\335\234\207|r\036\322=\215\270^i\326\247dq\342\344\266\265\273\333\270\243\006`I=E\335v\204\270=\250\264\375\031\200\242\250q8\246 %\"2\"\"iAA\322\001\300\002\221\031+n\021`%\323p\246 \3110\007 \200\233y\300\001\344\366\362\267_\277\254\372\261(\024F\346G\362\t\333~V4\205\224:|]~\361m\270T\325\202+\206?N\343\006\276\337t\025\307ey\004\272:\233\234\3027\216\221,y|IF\024\207\366o\035\232=\212\267\205\216\244"
+	.string	"\200\332\213.\355I\n`\321\370\177\342\260\302p\236\235\007aK\244\244\263\265`\356u\325\211\212\224k\211\364\275\030\212\243\023\305\003=:\205\224\300o\032\002b\221\2136\203dl\261z\333\361\2055\346Y\216|\326`sJ#\327e\272\267/\032\342\304\021B\013\272\n\215bQ\334:\3011\322\352oKJ\366\335\332\255t\317\022\307w\267G\344\311\344\225\304\240\214\341\020\372\004\250Z:S\203{\032AkJ|1\033\360\007A&#Y\t=V\307\342\027\240[\007\272\037\3626\235\301N\272\230'\211\364\306\227`Ob]\334\207\277#\307E\332\017G\370"
+	.ascii	"\236\204\035s\357n\372{\217e\313\021\007\247\354&\323\\LV\003"
+	.text
+	.section	.gnu.lto_.symtab.a26873e7c88d2a56,"e",@progbits
+	.string	"beeper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"beeperUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"beeperModeMaskForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"isBeeperOn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a26873e7c88d2a56,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,555 @@
+	.file	"displayport_msp.c"
+	.section	.gnu.lto_.profile.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"\275\005"
+	.string	"\024\t\b\001"
+	.string	"\020"
+	.string	"\317\333\366\301\006\004\002"
+	.string	"\002\001\001\317\253\250\341\002"
+	.string	"\002\330\370\241\354\t"
+	.string	"\003\215\377\300\244\017"
+	.string	"\004\334\305\271\347\016\002\002\002\002\003\006\224\217\236\327\t\006\002\004\002\004\002\005\002\005\b\t\230\232\324\211\b\n\361\272\334\207\001\003\002"
+	.string	"\002\006\013\263\326\341\254\013\f\262\201\245\301\003\r\224\243\302\255\016\020\002"
+	.string	"\002\007\003\007\002\007\016\232\207\305\212\002\006\002\b\002\t\t\002\t\017\376\316\322\317\002\003\002\005\002\n\020\240\342\234\212\n\021\375\250\211\317\f"
+	.string	"\017"
+	.ascii	"n\023\307~\2321\026^\312\335\031\036\034\005N1\301\200Ui$\004"
+	.ascii	"\005\034e\323\357W\254\354,-\200\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"M\004"
+	.string	"\022\206\021\032\300%\303\001\377\377\377o\356\342\377\377\177c\032i\244\021B\032ido)S\n\356\316\201\364\013\237\235\024\212,\277fY\356\b\220c\327\b\024r\204\241Z\215\3413uFN\003\250\370#\244<\341\025uH\233x\b\034"
+	.string	"_\205xl\256\306\004\t\r01\344zE\b\334\210\331pfpQl\260bc\024\260X\004\204\371\244\027U\020@.\013\221\242\216\310\264r\331M\202\341\212\005\237\315"
+	.ascii	"\276\300T\22507\320\006"
+	.text
+	.section	.gnu.lto_.inline.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`F\002\275\t"
+	.string	"B\016,.pK\222\016\260>\231{\200\006\nt\237{(\004wv\224Y\337\360\231\367\233mK\325\210\032\001@\311\323\201\030[kc$\266\331\275\345N\001\333\337\267\350\252\3514\026\210\320\212\270MM\2373\210\202(\034)W\021\222Q\341\353\350<2\323"
+	.string	"\317\251\203\2644e\270n\013\007q!!r\200\3404\214\203\377}\245\005\335\202\343\003\204\300\002"
+	.string	"\326\333\377Hkb\244c\243\261\305\036\242$\377\300\344om\333\246bd&32\255\034EfJ\276\373\026\335\326\254\320\327\2728^J33\0335\0332\363\341'[\304\2267S\273\233\324*3\227\177\276\2048 p\002\241!3\017\214\221\211\322\005\216\006zi\\\007\210~:\302\203\375e\225%\034\347:\207\263F\307\222\233g"
+	.ascii	"J#gA2\004\306TY\206\330\314\236\024\312\233\r\361CA\200Hp\274"
+	.ascii	"\223W=\327\030\207\222\017\210!U`4\272\314\005\251\242\221\235"
+	.ascii	"\005\016\274\223\273\214=C\252\202\254\363e\t\t\tD\215\016\332"
+	.ascii	"\204r\304\327\032\210\316\251F\312\240\023\243\356H\357\321\023"
+	.ascii	"|\324i i\303#F+\312\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`O\002\035\b"
+	.string	"\322\313\"&\220)\205\016\330\377\033\277\343k+13#\307\351\322\240\233\032\365\255\036\005E\337\337P-y\002\362\rm\262\267L2<(\325\203A\251\244\243\301n\024\364y\245,\275\0012\230B\234s\016\302\2740\252+K\210h\232F\202\240]zV&\030'\003\213\300\321+\001W<\305\0237\026\356\375\260\177X\347\225\020\210\231\221;Xy\263W\344\365\257\370\341\271fZX\277+\302+2\2518:\323\227\236\302OE\352%\377Kz2$\2062 p\002\241*\243\007P\311\250\352VXS\331\026\210`9\307P\037f-\230S\200o`\030\200\303\324L+\303\205\200\005\211:\006\030t\001"
+	.string	"\344\214\031\003\242\273\240\302\371\013j/\022\206-"
+	.ascii	"\033\362\206\232#N\200\236\2239\306)\364S\215\223u\311\360\033"
+	.ascii	"\232\240''\bl\333j\005\2070\326EA\251\341\273b\260\215\t\237"
+	.ascii	"\021\303[\314\300~\307\245\307*\370\020"
+	.text
+	.section	.gnu.lto_.pureconst.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\205\004\001\200\004\002\200\004\003\230\004\004\230\004\006"
+	.ascii	"\230\004\b\230\004\t\230\004\n\232\004\013\230\004\f\230\004"
+	.ascii	"\r\230\004\016\230\004\017\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\235\004"
+	.string	"\302\305\024!\260'\303\001\f\303\212R\301"
+	.string	"-M\\S\007\246v0wT\272\021\262{\333\332\266\275\367&D\312\024/\034\216an\2545\034C\005\243\016\344\361~4\371\032\302@\360Z\211\262\377\2110"
+	.string	"H\210\362\360P\256\264\344J|s>7\224\377\"\341j\365T\004\032"
+	.string	"DK\340\243A\323\300\303y\354\026\374\254\\\3033\203\307\322\360\271\261!L\214O\020\005\230\0200\360\030\360bs\300.\346\250\273?[\267Z\001\340\271"
+	.ascii	"\343\330\252\354\370s5\f\024\001"
+	.text
+	.section	.gnu.lto_.lto.52d961983a29218f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_heartbeat.20.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`5\001}\016"
+	.string	"V\\dE\360\222(\035 E7.|\236(\236li\255d\261\374i\"Hc\273\314%KK\265W\230h\307\255\337\020\030[>\1778d.\276\020\245`\023\216,\025U\257\272\307p\365\230z\360mHqT\330\266\367\336;\245N"
+	.string	"P"
+	.string	"P"
+	.string	"\365\324\266\037\3432:[f\202*>\006\256\226\230 \273\233y.\240\236\316\217\324S\231\342\335\247\214\235\377\360S\205\262\341}+\237 .g\201\024\tW\200\3574=?fZ\336zt\371Xb\334D\330]G\357\373p\323\3336\261=\301\376\210\277\004\220 \304"
+	.string	"\037\273\036^Cv\206\366`\361\325o\337\217y\313\306L:\313\262\006K\265\273\030\311\306\336\371\2411+X\320}U\232\213z"
+	.string	"C\b\315\356\013\311\251\035pN\243}\230\323\350\016rxg7\245c\307.\210\300\031\347\324 \347#\001<X*\357.n\231\352\267BZ\274We\225+\2571\361\272!\255R\251D\t\201\260\304\032\3738\236C\305_a\r\\\274w\352s\365\224J\021-^\240JQ\202\201\257N`\206\353\305\024_6x\212\022\205\375\2712e\323\350\r\215\2563\232\036\f~J\350\203\262\201\253\243M\243\200\371S\"\342B\025F\233&\"\235`\020q\240\224L\003e\031@'\241\354\263qY\211\307\232\310\302\226\2154m\3130\320\364)\253|\353&\035`\"\3117\322\305\366F6(a\222'\227\346\356\t\b\341;4\253\211\305\003?\353\341\005\221\026"
+	.ascii	"\266\311\"x\266\301\210@-\336\323\002U\030f\261\366\027\265\026"
+	.ascii	"\003\251*\342ri\361RV\0202CpM\004\020V\304\250\241\213&J\270"
+	.ascii	"\030A\025\331\220\272mU\243S4\265\007"
+	.text
+	.section	.gnu.lto_grab.21.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`}\001\235\017"
+	.string	"\366\234gF\360\222(\035 \3255]\275\306Qg\205\344\354\306\003\372@\323D\260\210\3552\227b\322Z\345c\337'r|C`b\375\373_4\325\372\002-\005\233pd\251\250:W\242\030W\217\251#\241\025\242*6\275\367\3362\245Q"
+	.string	"S"
+	.string	"P"
+	.string	"\322\237\307\266\357\342/<\373&~'^ ,\227\313L\217\335\345@/0/\343\t\314Kh\342\336#T\317\377\354Q\006\343\321z\261<v8\214\007b\"r\006\274X\021t\343\346r\333\325\365jQ\005q\260\273\326\326\213\303-o\333\3046\004\3739\0028\f\350\330\335\260\363co\322F\212\327\374\366}\231\333Vnc8\243\311v\3674\257\361k&)\361R\2171\234\321\244\374\031\223\224\244NS\305\2051h\341\003g\367E\344\322\013<+\366\347\236\375Q\3730\217\341\375\273\360\220\335X\215\306\356\247\300\234\347\001_q\337L\337Fa\244oE8!\313uF\354\324\240Q\023B\024\231\035-\252c_\306g\240|\024\356T\364-\225y\t\341mW\017*X\300T\372"
+	.string	"A\355\032\002F\316\313Jw\354\217\245\260\204\375\2700fO\265\234\352(\325\360\337\257\001&\210~\312(\204\2022\315S\251\213\360qh\204d\032I8\225:\222\352\244\002\311$J\341:\021gAt2\342B%\0237\002rG\232P\342N]W\342>\337\352\021F\223\f0*r\t]\266%\374\354\327\200\341\303m\005YV\305]\022\rBpb\242"
+	.string	"M\360\333\274&\002P\203&k\005! @\002b\310\252\0366\263 h\233#\264\304\200\207\360\026\207q\314\027\206\376&e1He\307\3255F\301\017e\n\202\341\240<\303\303H\001\371\206\017\n^_`\255A\031\013\004\003E\b\301"
+	.ascii	"\031\315\027\372d\220\340\302\277\033\351\006m\221\246\024\024"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_release.22.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`9\001\205\016"
+	.string	"\206\034eF"
+	.string	"\223\223\016X-\030\214\326\037\257nf\344*\325\020\322\346\354\331'd\331\345\206e\361\361\035\177\332T\215\332\017\267\225\3017\350D\024\002+l\350\377\256\276\327\266Z3\210\376%A\331\375y\336\254h\311\336{\357\224\002O"
+	.string	"P"
+	.string	"N"
+	.string	"`\307\266\317\342-:\333f\202%\276\013\325\2422\323cw\263\317\007\324\323y\001\365T\222x\367)c\347?\374T\271\354\360>\224\317\016\227\263@\352\203\217"
+	.ascii	"\037j~r\334\250\234\365\270\362\245\304x9\330]G\357\343p\323"
+	.string	"\333\036\261\r\301\376K\007\177\t\240\256\320A\300\306\356\206\326\217\275\2418N|\365\333\367g\316\2621\227.c\371\202F\265\273X\311\306\336\371\2411'P\320}e\352,\212\013\206\b\0178\273,!\247f\3209\215\366c\356\242;\230\341\236\335\024\215\033\273 \002g\235S\007\336U\3346\325g\211\264x\257\312*Q\236\003\242\025C\372\244RY\022\362H\2119\366e|\306\211o\302\027\270x\357\324\347\352)\225.)`ZL\361\201\201\257.kj\300\260\234b\313\006QQ\216\260?ww-S6\215\276ht\235\3214\277\211\bT\202\201\253\244M\213\200\031$2\342D\022H\2336*\221T\030q!\223L\013e\026B$\242\f\264q\231\310\307\332h\302\226\2214m\3130\360\364)\253<\353#\032bb\310/\271b\373\222\013^N\022e\323\334\r\321 \274\007g5\261x\340\227yH\001\244\206F\025\026"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\241q\231(5\364\321D\021\027#\250\"\203"
+	.ascii	"\023\221T\203V\2114\245PP"
+	.text
+	.section	.gnu.lto_clearScreen.23.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`9\001\215\016"
+	.string	"\006\034dF\360\2226\035P\243\222#\302\253\315uw\217\376\0345D\354\322\206\312\377O\026)\022j\364\035\023}\241\243Y\004\303>\376\214\036)\027\257\022\006eq\214\360Y\327\237\2145\3157k\246b\013HU\224\264\275\367\336)\005N"
+	.string	"N"
+	.string	"N"
+	.ascii	"\266\375\027\207\321\331\252\t\232\370,\223\313\212\314\315\356"
+	.ascii	"f\235\017\250\247\363\002\352\251,\361\356S\306\316\177\370\331"
+	.ascii	"\002\004\017\357K\371\354p9\013\234\\p\002|\246\331\331Q\263"
+	.ascii	"\362\324#\313\247\022\243\345`w\035\275\217"
+	.string	"\303Mo\233\3046\004\373/\001\007\177\t\240\352\350A`fw\303\352\307\326P\034)\216\372\355\3732O\331\230G\217\261\224\241\302F6\366\316\017\2159\201\202\356(\322\265*\254\231\021'lv[DN\315\340:\215\366a\036\243;\230\341!\273'\0337vA\004\316\256S\203W\252\033\357,nU\365S -\336\253\262\312\224\347\204X\315\220F\251T\232\204>Tb\216}\032\257\201\342\243\360\005.\336;\365\271zJ\345\207\025.<\220\342\003\003G]\322\344\300i)\305\225\r\232\242$a\177\256<\3314\332\242\321uF\323\361' \217\t\006\256\2126-\002f\317H\210\003I\020mZhTR!\304}N2\355\223Y\370\224\2002\317\306e#\035k\241\t[&\322\264-\303\300\322\247\254\362\251\223h\200\211\"\267$\213mK.x)I\223IsWD\203\360!6\250\211\305\003\177\314C\n 4\001\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_drawScreen.24.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`9\001\215\016"
+	.string	"\006\034dF\360\2226\035P\021; c\221\206\314U\334\264\0257D\354\322\206mJr\303\220\002\003.C\274\372\013\035\315\"\030\366\361g\364H\271x\2250(\213c\204\317\272\376d\254i\276Y3\025[@\252\242\244\355\275\367N)N"
+	.string	"N"
+	.string	"N"
+	.ascii	"\266}\027\177\321\3315\023<\361Y\246\024+38\273\233u>\240\236"
+	.ascii	"\316\013\250\247\322\304\273O\031;\377\341\347\013\210\033\336"
+	.ascii	"\227\362\331\341r\0268\205\360\021\3403\315\216\016\233\225\247"
+	.ascii	"\036Y>\225\030-\007\273\353\350}"
+	.string	"\034nz\333$\266!\330w\t\007\177\t\240\366\330A`\265\273a\365cmh\016\025G\375\366\375\231\247l\314\243\313X\306Pa#\033{\347\207\306\234@Aw\024\351\332\025\226\f\022/7\273-\"\247fp\235F\3731\207\321\035\314\360\220\335\223\r\034\273 \002g\327\251\301+*\034\357-\356\232\352\247@Z\274We\225)\317\021\261\232!\215R\2514\ty\250\304\034\3734^\003\305G\341\013\\\274w\352s\365\224\312\017,`<\220\342\003\003G]\322\250`ZJqe\203\246(K\330\237+O6\215\266ht\235\3214\363' \217\t\006\256\2126-\002f\317H\210\003I\020mZhTR!\304}N2\355\223Y\370\224\2002\317\306e#\035k\241\t[&\322\264-\303\300\322\247\254\362\251\223h\210\211\"\267$\213mK.p)I\223IswD\203\360!7\250\211\305\003\277\314C\n 4\001\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_screenSize.25.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\315\t"
+	.string	"F\223C9@\305(\035\235\272-\342\300\223c\377\364\307O\310:G\306\230\203\206?\345\213A\253\375\210?F\026\242\241p$|\245\212\213N i\260\002\344\022\204E((\204\020B\244L)3"
+	.string	"0"
+	.string	"1"
+	.string	"\240}r\205\032'\215\224*\215\004\330\335\210\371@v\354\272@vL3\016>A\377 \277V\027"
+	.string	"L'\321SC\330]\247\351dq\353mgl\037\330\317\004\231VMg\246\277e,\225\002\226\335\212\326jS0\023\016\333\240}\261\375\264\257\372\007\3700\364\200]\024J\311n\250q\334\2169\334l\373\036O\005z=\234DUsM}\211\345\357\"\020\333\356\204\201\037\342El\033\307\374Pv\354J\260\242\032e\313\016E\251\030\366\257U\224\255i\355\341\237i\372\n \217K\270\270\263\351\276\217\002\310\343:\tNC\367y\026\"\347\211\016\036\316'v\274/n0\346:\006/\2028\316\213\227pok\212\031)\311\227\246j\252-\024\035\244lY\003\017"
+	.ascii	"\266\231E\246m0\302\210\t\003l\356\251\344\252\232M\351\255C"
+	.ascii	"c\231k8\264,`\t&\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_writeString.26.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`\352\003U\034"
+	.string	"\246\265\272I\240\326Q:\304\253q\361\326\230\001\205+\343N\216\327a\023\313\276\357\213k\321Z\227\246\200\317\037\216\236\311\270n\237\203/\332\213{\322v\303\006\307\204\275\343\\\372\007|\202kY\370;\0356\036NOVj\2364B\210\334)\005\244"
+	.string	"\230"
+	.string	"\256"
+	.string	"b\265\326\237\227\026:\311,\025;\001*\323\025\224\013X>* \351=@\375U\251\021\264\324n\360\300w\253\236\267\326\241\231\t\247\366\215\374\210\357\304\026\307\251U\252\310U+q\201m\347K\023O\333>\221\027\361\331^$qJ(\373-\001&\031Sk\265\371\\\200\371\222|\216\371ry\334w\263$\227\372\374\027OR\r\307\202B\245\2333^\222\006\244n\220\261\021\272 }\244\200\001ol\242\344\323\227D\020\026\305\305F\310D\326\206_O/\236\276\020\376(\225Q\250\265\232\006\2052n\331m\037\331\376`\223\265\3003K\364\350\032J\2636\n\034}\360{\243\304\006\030\323*\331\304\037\335\035\366\311\272R\346Y\352\332\211\377\316\261~\035"
+	.string	"\3249\267\372q\216\344\277\271\326]\363\254\237f\251g2\352\363\244\226-\2659\243.Oj\362\244\336\245\2462\352\367\310\250\204\021xRk\214\243\231\nV\032\177\\\353\337\362\273n\264i\336\235\313[5FUk\245\355l\332\313\333>\237\311\213\246\271\311\235\370\276\225tV \026\242\232\210\325\352\364\363\322\035\316\227\324\351\300\265\354u*9\235XQ[\001\\\307\322\301f*x\345\305\236NIz"
+	.string	"A\037\264O\323*\331\334s\001\f\261\2202\233\340\227%\342\013\230\344\312\226\303\260\b|\372\321\343\273\304\204\341X\033\231\345\022]}1\3212\326\331r\033\f\225"
+	.ascii	"\317\220@\267\022\374\022\364\236\271K\356\216\030 \215\037="
+	.ascii	"\2628\225\020\016"
+	.string	"\"\330\">eD\202,\2652A\220\362/\022~\217\227\036\272\225\376m\035h1\352,]\023\312\306\030\360\f\316F\241\267W\225\02727k{\201\227!P\373\236i[\301\213=\232\251Zk\204\255\3522&L\317\355e\326\254\271\f\240\216Ma~\364\350o\315\336I'\222\210\366\310D\321\2428\302\351x;S\307\343\r\221*r\272-\312\335\226\247\313q\240\371\006\204\2643\"\301\323\345\220V\f\025!\355p%l9\234\355\b7dd\273\351v6 \037\347\220L\350l\274\\Ng\243\021\227N\326\225\262\311\262\226\001\206\021\362\347<\373\3026\317J\300\261\264?'\221\265\352\b\372\326_<\216\230\225Y\200\316\212\026f]cT\027r{\231\276\021\203\006\372`m\315U*\223\343\230U\2460s\226\350j\213\257\345[R\370=\274A\210>(d\276\314\331\033Ok\004\031Bc\311\312\315\235m\017\230\246\341"
+	.ascii	"z.\315>H\250A0\303\224B\006\tF0\023\320\024I\222<\200\"\231\272"
+	.ascii	"\353\020xW\022u\266%\341&\023\3400\342\246k\222\365\346\357#"
+	.ascii	"\f\257}\036i\330\3278\242?\226\265\242\247\211\370B \306AG\231"
+	.ascii	"<\256m\335\003\036\013B\247\350\262\204\314\244|W\356\330x\220"
+	.ascii	"\322\037a>\f;vNb\227\001w\024\315,\301\373S\310\340B\b\304\372"
+	.ascii	"t\013\013\344h\016\202\003q\272\302\037\023f?\035p\215\357\331"
+	.ascii	"\036\261s\277x\332\201\311l\206\214\001\341\257+\b\370\324M*"
+	.ascii	"(\266\232\301cS\310R\003"
+	.text
+	.section	.gnu.lto_writeChar.27.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`~\001\315\016"
+	.string	"\306[bE\020\221\223\016\300rF\025\256\302\221\226#\024\360\341\203j\223\242\220V\346\232\315k\235\360\276\203\365j\321\"\377\354\331$\252\261z\033\310\230"
+	.string	"P\316\021\255\227\2757(\213\241\200%2|k\332lA\266\355-wJ\001K"
+	.string	"Q"
+	.string	"J"
+	.string	"'\216\242\373\227\341"
+	.ascii	"vY\240\213\335O\304\331\365\351\357\262\355\227\270\211\316\206"
+	.ascii	"!\277\226\025'\245C\265\"\307\356f!\027\260\371\224\017\260\371"
+	.ascii	"\324\020\357\036;\377\340\245\013K\350\255P\217\234\005\273\353"
+	.ascii	"\350\2556\334z\333\003l?\260\037\006S\243\245F\253F\307\031}"
+	.ascii	"Pge\006H\214]\225\260\307\312\230/F|\346\267;\0374f\231\263\350"
+	.ascii	">s\272\226\304\245A\005\017\232\335\025\002\237vp}\202b\214L"
+	.ascii	"\003\030\021\f^P\016\332\024\r\225\022\215\266\201\003\335[("
+	.ascii	"\326\335\016;\024<\332\017\027J\361\336G\345rP\2241\225\035U"
+	.ascii	"\275\252\346C\243\222\260\2047ml\213h\212\320\005\307\325v\201"
+	.ascii	"\203&O\313\356\222\334\2731\365\nbCU\223\022C\373CE\005a_\256"
+	.ascii	"\262\374\371\367{\336\372\261\277\374\235\303\374\037\217\371"
+	.ascii	"\003\025L\022T\364\215\343B\362\244mj\242\211\224\3334\b\230"
+	.ascii	"E#\244\322I\004n\323H\030B&\244\322hB\246\2152\013\243\320I&"
+	.ascii	"\332J\331H\2105\022\205-\3434m\313\260o/WY\037M\340!ES>\311\335"
+	.ascii	"\017%4\255\370\026\0075\0045\274\250\252R=j\007\" \260\"\262"
+	.ascii	"\013=6\263\b\354\265Y\213@Sf\f{\031?{\355\260\264U\203\371g\263"
+	.ascii	"(-\037\341)T{\242\027\303\001PD\364H\230\215\335H\223\r\016\350"
+	.ascii	"{\260\203\300\317\301\016b\316\r\343\005\340\b\201\341\337}r"
+	.ascii	"+&a\221\001"
+	.text
+	.section	.gnu.lto_isTransferInProgress.28.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"\242M25Po\322\030 n%\"\245_\022C\322\026\bP\t\203?\251\264\352\225U[\004\311;\2623\033\213\204\273\315\006\220\206\211^['P\271\005+\225\326B\342\3362\005\231\214\f\325\235\315\205y\0342\031\257\tN\304\205Y\0170ZP\302\342x`Gbp\2439^\020\022f1JX\315\325\215\322T<\213\237\037\3676^\001vw\177\243w\r\244R\213A\312n\350\305eI\023\212\307\257}\365;\367\n\242!\232\212Ph\300\356\210\345dw\036\f3:=u\200\322)\243\002\224N\377\b\t\332\233\316\216\020\346\002\204AR\332\235\360q\350\246n[uD\t>JTVLD\037u\230\205\335\335\201D\031\372\323\277\340W\3705\002\b"
+	.string	"\266\231E\246m`\344\250"
+	.ascii	"X\005D\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_isSynced.29.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"%\007"
+	.string	"\002\01635Po\322\030 n\203\240\360\034\2512M\013\004\250\204\201\025B\331\273\005U[\004\311;\2623\033\213\204\273\315G\304\222\224R[\344U\225c\235Z\333\210\264\275e\n\230\214\013\234A\036\353\n5`2Z\022\037\b\353\252\034`\254`D\365\tA\220\274\240\247s\264\036$\304b\224\360\271\232\331\267\255\032\325\241x\025?E\356q\274fvw\177\333;\206Yz)@\331\035\305\300,\313\244\362\361g\317\371\235{\rQ\221LG&\024`w[I\331\235\006\303\215NO\025\240t\332h"
+	.string	"\245\323\377\001B\266\246\323c\244\261\330\270()\355N\370:TS\247\255J\242\003 '-.&$\221:\215\302\356\3560H\031\372\323\237\340O\3705\002\007"
+	.ascii	"\265\311B\241\301\3143\227\225\235t\r\201\354\020\361u\315'"
+	.text
+	.section	.gnu.lto_redraw.30.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`N\002M\023"
+	.string	"\226$\200I\300\322Q:r\251\237\237\303\210n\r\250\006\236\260\274\342\005\211\270\035\341\203N\002\364\340\265\3438\273\353x\351\315\246/]\030\377(j)\300\3669\021\273\r\fB%$\037Ze\002\363\206\023y\207\321\b\370\212\366\367&{\247\024e"
+	.string	"f"
+	.string	"o"
+	.string	"\247n`\032{u\372\225\355K\373A\027\242=W\363\222]\234\322\322\356\270\300\240\352\324\343\t\324S\325\005\324S\323l\037\037}6\325s\3139\342\355.8U\234\366oJ\232\377\241\213\2106\233\177\">\277\0038\236("
+	.ascii	"\266\332g\242\343)\347\272\313\0176"
+	.string	"\034)S\017v\327R\264\205\270\351mO\260\035\301\226/\002@\271\033\331\263\307\232\234=\366\277\335]O\234\235\222\036y\356WU\351Z\245)\225\376\252\364\254\322\222J?\200l\272\321\3033y\214\253\323\013\262Ot\267\342G\277}\237\350:\232'y\0229\361v\3670~\344#\031%\2056\363\321t\204\317-hwg|#\243\244\314\274hfb3\256\016\003\023c\020ow'A\3771\206\025yq\245\236\216\314\022-\200H\314$\004\004H\227'@<\335\204v\352\2643\334\206\201\267*\235\365\233\224\3455v\337$\3311E\345\346\264[\276\324R\355\256\212?\003\2065\300\347\247\246\236J!\342\017\222\267\252\234s\316\035\036n5\331\363\247\234\317\031b\r\227\341R\355\342\250\3701\256\264\301\3779\365+\224\027\303z\372I\262c\n\337_^,\227\016\262*\023\013)\254\314:\201\311^,2\261\0206k\341"
+	.ascii	"\223\271^\300\320\005\302\270Z^ +&\003OL\034\302Z1P&\fc\340j"
+	.ascii	"\274\371\267\0237t\tM,\242\240nf\315\263o7\205\203\022\250\242"
+	.ascii	"\257\200T\360'\035\251\202\b\r'\236x\027wS\365u\026.\310\213"
+	.ascii	"\256\323\346@P\364t\3231ud\272\030\365\300\221@\354\343x\216"
+	.ascii	"\030\007* `\2021\202\220\036\266\227E\266\207d\333\323\007P`"
+	.ascii	"pi\261p\251\1777V\200\300\032\206\220\2231\\6\340\223\"\377\t"
+	.ascii	"\242\2438\005\246\322\003\266y\031\355\341v\341\305`fvd\257\302"
+	.ascii	"\362M\253-+\203?\301>\316\304\201\341\013\007?/@\255\201\227"
+	.ascii	"\246&\264,@\030#\022\2619O\313-\317\b9\245\020{"
+	.text
+	.section	.gnu.lto_txBytesFree.31.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\225\007"
+	.string	"\222N45Pm\323\001\244\024\241n\336\200(k\327\320P\233^\251\264Y\276\201\371\263\321\b\372\\\2322\253f\027\357\350h2H\242\326\232\274\335\206\327\321\344\355\267-wJ\001\230%\021$s4\325\325I\300,Yy6\f\325E)DI\305\006j\323\211\034\353\212\232\311\262Z\260\"&\245\025\245\271\267\352\004\241\037G\317v\360\274s\252\323G7{nOC\366\341*\310\n3'%\004(\273\022+*K\022\215`\330\316l\311\366{\366;\356\221}>\034`\027d\"\262;\013\0341\217<1\266\375\215sd\326\340\254\3502\241\213\b\220\224\335\031\247\013X\036\301\007X\036)\305\265?\315\377\307\241\206E\b\327m\177\227\203\335\365\343\272\211[o{\300\266\201\355\214\013"
+	.ascii	"\266\231E\246m`\304U\335\341\232x1\321\022\215\333\201\t\002"
+	.ascii	"N\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.32.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\035\007"
+	.string	"$\f\356"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}\212\001\202\200\200\374\342\303\347\302\005{y\270\347\222\005wu\370\346\362\003sq\270\346\242\005om\370\345\322\007wk\270\345\242\005ig\370\344\302\005ec\270\344\262\005a_\330\337\002o]\270\337\302\005o[\370\336\202\005oY\270\336\322\003oW"
+	.string	"?\202\210\200\370\001US\310\001Q\307\001O\306\001M\305\001K\304\001I\303\001G\302\001E\301\001C\300\001A\277\001\277\177\276\001\275\177\275\001\273\177\274\001\271\177\274\001\267\177\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\016"
+	.string	"\200\024 \205\fD\003R"
+	.string	")\200\024@\n \005\220\022\223\0243\351A\260\224\360\006"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_displayPortMspInit.33.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`2\001=\r"
+	.string	"6\227VD\020\2176\035"
+	.string	"\334\340\341\264\033!\240\025\244rz\365\221?\264}60-\325\r"
+	.string	":/\355(0\222\221\367\365\2341\214<\213\277\006(\257\325\r\n@EP`\004\220\006`\220\362\031\202\374\361\375i\223-S\n@"
+	.string	"A"
+	.string	"A"
+	.string	"\026N2JL\021T^vC\314\3417\254\313\353"
+	.string	"\254\313X\341\241WQC>\306\243JAq\371@\321\253\t\217\032\240Wq\354\3567\\M\300\221*\306cw\255\037xr\313\333.`{c\037%\34198\360/\\\232\003\351\277K\037d]\332\017F\364\237\003\2508\241N%Qd\207#\215$\373\325F\n\266\252\217\341\234^Z\020p\331\225\220\212\261,r\005\203m\022[\343g\270\006\022\207\006\204\001\235\246twE1\222lg\326c\002\017,<\205a\373\343#\262k\327\353\360C\\D\307 !\032\0223]\013\252\324i\312\032}\351 \346\265\013\341\303U\026T\237iM\353\362\245w"
+	.string	"]\273\335??\356l4\356\363!\262Mm$c\240q\036\005\330\364`\r<\331\007\353l\034\266\341\360\324@6Ld\316\r\323\204\335S\240\32001\261tq\344\215\023+\006\016\230L\240N^\025I\347X6\202\227\340\bX\261\273\035$2.^\244\264\004\037"
+	.string	"2\003\302\360\325\206\235!0`\210\245r<c\0076\036\260\236\0218"
+	.ascii	"\303\320j\263\361\020\004\253`\211\216I\2762\361)M8p\007\314"
+	.ascii	"MU0\020\032\334\301G\r\350\032\316\304\302\371!\b\340.Dj\234"
+	.ascii	"\242jlW)\003"
+	.text
+	.section	.gnu.lto_output.part.0.42.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`\033\002\355\021"
+	.string	"\246\241sF\340\360&\035C\037\260\302Q&\21705\221\366\364\320_\242u/\\\013\353\337\340=\350\223\233J/\227?P=\271\310 \021\"\216\363\261\333 \030\326 \303\032\344s$\352\234\244\003\266R.\352\215\324 \333\366\226;\245["
+	.string	"d"
+	.string	"^"
+	.string	"0\017\267\306\306\032m\221\021\360>0\326\335\234\032E\273\341\201Oo\331\247}\024-\033\333\376\211\367\200\366\221\fyn\030\304\240\201!\355\356\366\371\361\001\246Oy\001\246O\025q\360\032%\350\307\327M\314\365\261\027`a\343u\303\341\021uy\"\331]g\035\356y\333\rl\263\354H!\353\nAl\177n\361\byp"
+	.string	"\334p\201!\007i7\334>Ot\177oa\007%L\354\256v_\250\345\307\254\021\r\275|\304|"
+	.ascii	"\371\364\034zy\200]\035\241\007\031hkA\007\332\003\371Hv\254"
+	.ascii	"+DN\321\356.\220\361\260V\27082\332W\361\037\360+*xt\254\353"
+	.ascii	"g\003\2020\263\306\207\026\031i\335'r=h\214U\245~\006\215\222"
+	.ascii	"\235:\fU\266\353R\340\033\375E\212?\342\323+\225\370\327\247"
+	.ascii	"\257\242\th\244\270F}\354\0344J2q)\352\216U^\256\3528\323\350"
+	.ascii	"\323\203~\323a\377\344\210\226Y\264jt|\370_;\201\244\335\232"
+	.ascii	"\245\244\0051\215H\024\271\205d&\303\005\371\003\223\321\203"
+	.ascii	"\024\236\020\362\251X+\024\316\353R:\003.\036\007AcQ\261\024"
+	.ascii	"\345E\202\236\254\244\324\251\220\356[)q\361\270\316\202\t\253"
+	.ascii	"\373V'\033\267\332XV&+[\312\373\266\220\017s\235\312\333\\8\316"
+	.ascii	"\3334\333\361\252\343\307\216\212'\315T\203\355LM\"\2433\252"
+	.ascii	";\266Q\321\217`2\351\324\250R\355\022\223\370\327I\003/ `\242"
+	.ascii	"a\314z\034\314i\264\213e\310p\214\321%\035\270A\336\023Y\024"
+	.ascii	"\376\211\3260k\270\345\302\271\334\320\326A\2342A\357\204\331"
+	.ascii	"\232`\320\n\200\223Z\273TX\275_\270\216\b\317 Y\003\374\303}"
+	.ascii	"1H\260\353g;6h%5\2739F\356\233\255\201(\016\221\b\216\363\261"
+	.ascii	"\362\r\222X\304B\260\274\302\260\360`\312\330\371\327\2521"
+	.text
+	.section	.gnu.lto_.symbol_nodes.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`\256\001\265\007"
+	.string	"2\313)/pi\323\001\346\364w\372\366\361?\f7=\001\\\374w\240\372\377\377\377\377i\340\365\377\277\337\276\333\354\277U\355&\242\206\325V\365\367&r\313\024N\206'\262\"M\n8\240\020\324\207\202\025\024\320\204t\361\004"
+	.ascii	"h\306\314\212\205\214D\343hb\246F7I5\341\021\204S\016^\271|\222"
+	.ascii	"\273kg\031\203K\222\322\236\332\211\331Iz\266]\\\b\313!\2253"
+	.ascii	"(\307&\267\266\023H\376p\221\0278\310+m{\331)\367\260<\333\332"
+	.ascii	"\306\270\017\216_\032\317\030w`o8\033c\204\203}{B!\233\335\335"
+	.ascii	"\353\227\263\355\032\002% \020\003)\252\034\030\330\201\350q"
+	.ascii	"\220d\250\2145\004\333#\031\344\260Y\177\327\336\3105\207\241"
+	.ascii	"\036\301!px\200@[\032)\005\003\371\345\301:\234\332\251\235\332"
+	.ascii	"Q\355zu\366\024b\035\004]\2031%\022\244\307P\017\365\340\032"
+	.ascii	"4;\234"
+	.text
+	.section	.gnu.lto_.refs.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375 u\205\002"
+	.string	"\342\005\020\024\220\265\351\377\377\377\377\277\026-A4zzj\264\366'\231\002\n\377\231\274\001\033;q1\332| I\332J;$w\354\322\001\242\240\250)\215Q1O\321*]y\004\302\314\213d^\016S\007\001\005"
+	.ascii	"\216 \f\342\352y\013\354J[\302"
+	.text
+	.section	.gnu.lto_.decls.52d961983a29218f,"e",@progbits
+	.string	"(\265/\375`\311%\325\245"
+	.string	"z\004\2719V \nI<\035\027,J1\337\035\032\233o\022\346D8\303\310\246\261\373j\254\200\277H\203R\234\260\2429HI\345k\330\333\206\250\21465f\036\323\265"
+	.ascii	"EK\321d\214\365\272\306\364\271DuE-\2031\212\333J\225=M\323k"
+	.ascii	"S7\314\376\003\221\356\366\2202\245\024*\003\220\003\211\003"
+	.ascii	"Xd\201.\206\345\245\2276\3305\025\fb4\364G\242p\313h\250\346"
+	.ascii	"\235n\305\001\233\210L\375\272k\336\351M,03\032\302z\027\337"
+	.ascii	"\3631\376\3710\336\347_\274\f\257\276\363\231\375\315\347yi\363"
+	.ascii	"\021D\017\003n$\256a}\3713\266\037\214\355\317b\373\255\330\376"
+	.ascii	"&\266_\210\355\317l;`\267Wq4o\333@\316\325\2343\0050xF\250T\217"
+	.ascii	"\375\257\246\375J\2065zD\315c\037L\335\320z|\375X\\\3045P\241"
+	.ascii	"\201\261\023\204[\342}|WJ\300n<\336\243:Y\326\304\004\277\236"
+	.ascii	"\260M\"\211\267iM\321\343z\353)\033x\236$\374\260KS\363\266\274"
+	.ascii	"\351\021$xN<\212Kq;\177\342x>\305\365\274\316\363\034\212W\375"
+	.ascii	"\316\345\332\347\234\256i\2509;\311\312\374\314\343\216>\260"
+	.ascii	"\n\324\0332\346b17\347%\301\251{Q]\254\304`n\016\272k\356\\\211"
+	.ascii	"\307y\334\0215\013\371\222\024\264\"~6\002\220\0037o\213aR3\220"
+	.ascii	"\211;\250U\220\356\021$\374\316\233\370\331\245N3\017]\320\005"
+	.ascii	"<fD\002\377r\246\322\034\200\245\262\341\366F\203\333\253\330"
+	.ascii	"\317\256a\355\340\3228g\322\322s\243\251I\215A\203:\001\037W"
+	.ascii	"}\211\303Q3\r\f\241\2179\367a\333]"
+	.string	"\260-\002\266[\260\275d\033\311\316\254\271\021\257rp6\252\f\fa\026a\340\343N\301\266sX\275\3209\254\215\202\245A\201\355p\366n\346+\264\2379\021\013N\252\237\341\234\233\356\036b\334=\260\260Q5\301V\334\022`{\004\366\203kX\373\003V\204kX]\210\177y\225\306\303z\004\211\276\314\257\314\225s\226\3619\036h\322\343&\301\266\2035\005\315L\242-\260#\310\205N\263\366\263%\\\303:\343\031V\347\342p\237>\322<\2263\365\202\f\265\350\347\306\343\246\272\206\225\365\fk\267C\371\026o\362\005\350~\002\224u\206\356K\324\355&\272\t\216y\0138\364\004\335\267G\267O\273=G\267\343\350v\035\335\276\324\355Q\335\276\243\333mt\373S\267K\273\275\252\333\235\272\275\251\333\245\272\335GZ\220\013\020$`\247\003\335\236\242\333\211\335\215A\367U\241\333\337~\003\262\273\327\356\013\002\031wY\273?"
+	.ascii	"\0244M\367}\342j\321\267\373\262\350v\237\237\016\355\322}\251"
+	.ascii	"h\276\202\227\200\245\3733<\206\356\037>\006\031\240\240-\350"
+	.ascii	"\276S\335\235\327\335N64\333}w\322\234\326p\030\221:k\230\356"
+	.ascii	"\313\324\355d?\323a\335\036\323\026\272/R\367\313t?\333\355\203"
+	.ascii	"\335\036\245\333\225t{\222no\353v#\335\276\326\355j\335\236\326"
+	.ascii	"\355E\272\035\255\333\317"
+	.string	"\272\275\254\333\273\272\235\253\333\267\272]\253\333/t\267Y\267\003\351\356\275n\277\352v\021\335\276\241\333At;\002\272\033\205n\317\240\3331\350n\266n\037@\267_\320\355\036\272\235C\267\323t;\206n\237\351v\231n\267\320\335}\335\315\327\335\\\335\r\242\273\337\272{\246\260\260\260\260\033cuc\033\335\034P\004\027J\003j\205\365\203\204_e\003\3173c0$\250\325K\271U\337\367UV\272%\250\325\320i\205\277\247\003,]%\227\267\257+\301\233\324W\311\rjN\350\361=\272H!\230bk>\2765\302\354\272\330n\215KC\346\331\346\347\224\262k\021\333k\020\333+\f\266Y\006\331f\341\023\272A\370\355\257\313\312\215\366\r\212\371\311r\203\361\004\372s\207\264Y\261\362\351\3733\354\321'\206\364\370\312\370\254\005\344\330\252{|c@ \211\235\213\307\027F\314\0207,\246\307\367\371\2625D\006\344w\310"
+	.string	"\t\224Q\367\326s]\270\354\200A\006\275\316\276.X\226\246\342\242\217/\317g}\325\022)\321\343\333l\001\352\201\262\344\361e\016\205x\324\250\361\370fos\261\313{S\3636\026\247*whil\263p\261\"\004\003\327\261\262\036\202\200\375\201\315\266"
+	.ascii	"\351\220\031\213\025\333,SlS\253\370\261U\256P\375\250\364\373"
+	.ascii	"\311\001\206\365<n\342\333\203\336\335-\341\365\357\275\336\232"
+	.ascii	"\246\004\207\317\343\017\237\327\342\244\346jK]\237\322\030\r"
+	.ascii	"\266\375~J\214\234\217\025\322\224\273\241\234\026U\340\225\324"
+	.ascii	"\222\225\307\315\362\303v\021L\b\345\311j\303o\316\247\256\377"
+	.ascii	"\211K\265\371P\037\277\223\317\222\021\352j\013\343c;nN\216\245"
+	.ascii	"\t]\363J\\\277\034\025#xu\217\237\311g\261P_px\217\177\311\303"
+	.ascii	"\301 \261\323\341\002\316\311\215\254\262\267W\"\263W\243.\215"
+	.ascii	"\311\033[\022$-Ube}G\372\221\310\020\021a:y\374mR\232\030\361"
+	.ascii	"x\374i\317\266&Q\332\313\361\370\325~\315\253\031\274\221fiR"
+	.ascii	"3\365\247\006\311\300\314\330\366\f\326[X\350\031\254\355\367"
+	.ascii	"E"
+	.string	"\230\354\020++\202\306f$\214o\230\346S\346c\205?[\215\304\210\364t\261\215s\260\255WF\346\002D+I\327X?\231\237\275\230Q1\362\342\361\017\371\254\226\275\034Y\352g\026b\b\255-\331\b\253\3128a\033\274\002\353\257\302\b\2425\247\036\377\327g\001y\355M\t9\262\365\364\346\365T\003\004\251\022=n\354\364\272}\254g\317\300\265\345\222\303/jP\253\177\253\361,\344\r\257F\327\305\365\270\375>\253\273[\234\206\230\215\250,,(\034sF{y\255.\306\320\003q\271\341\213\241)=\344X\217z\206\325%K\257\331\264\275\372\323\027\"\201\232\231\032pC\372\361\227\243Q\r\372&\355\250\332\032\202\322\321\222\026xE\364\370u\254u\321\302\236\307}\177\330\227\372\034^\375\251\306_R*\314m\026\301\241}Xe\374CT\033\035\234\017\317\343\207zz\034\375PM\205\222\021\374\036f3\bWL\265"
+	.ascii	"\0044%uz>\265\347\217&\246u\310\032\330\364q?S\367K\375\310+"
+	.ascii	"m g\352\312$\204\212\355\361{\206uDM\277\215\025\313\b\323\225"
+	.ascii	"\352/)9\340\007\222\335\343G\372\244~\245\257\361J\035Hs"
+	.string	"n\276\222\214`\316M\031w\017\356\036\260\226\323\216\262\025\367}\322\370#/\251*'\217\373\217\272\277\350\215\234.EG}F\036\177\3245\254\027x\206\365\207j\372\211X\244H\351\243{\354\3013\314x!\013HV\334r<\336\243yQ\033\232\253\n\362\263\341V\233\323X\024\bC\327\274\326\036\367\003q\311\260e\276\267\30755\375P\367\n\024r\344\177\336\tt'Gt\204\220\313h\350\263\213i\031\r\005\217\337\257\247\374\217\332\225\322\343K\245\363\314\204D%\335\276%Nt<\217\257\336\335\363j\277]\276\216Q{A\366f\306\366\b\274\337\326;\245/\236\332\322SS\365\256\254\016i\352\3056\213\265d\311\215B\303\346\256',=\027()Y\321\205\3227J\036\240\215\037\217\357\334}\302\264B\024\312\343[\347\325!R\201L\354\245\273M\274z\235t\206yy*2\326|\354\201a\263\255W\316\333\202\304"
+	.ascii	"\242\366\370\306}\324\345J\032\013\362\3702i\266\373u\346\026"
+	.ascii	"\204\312\345\307\n\212\306\343fg\260\375\366v\225\320H\231{\037"
+	.ascii	"\216D\013\225"
+	.string	"|X\305\362\264p(\321\273R\200\304\355\220c/\222\213\344&qq\001w\364\341\215h\001\366h\277\276I>\353N\351G\330\n\354\027~\341uq\345\305\213\373CFDt4\315G\321\241\241\017dm\374\337\377\375\026\373\2644c\306\007\316d\036\272\252\351-\272E\037H'\003\351\007\026Z\365\242\371\031\215\364>\211\006\352a\345\214D\203\030\2612\260\031S\366\257\374\225\017\274b\326^\275f\027\313\2772\363\003hG\032\f\257\220x"
+	.ascii	"\315`\275\256\230\327-[sv\252\024(J\326\267\214m\311\\O\336\343"
+	.ascii	";6\204J\275a,3g%\267\3327\214-\355G]\327\343\013\366Y\353\021"
+	.ascii	"f\215"
+	.string	"!\217\357\227\267\335\251\234\024\251\307W\310G\375\360h\016i6L\224\266\005\367\270\207>l\257\204\354\333\275\335\357\261.OT}}GO\330\204\357\347G\371:\211\201\364\003+\037\r}\350\233u\265\372\0025\320\r\"!\347<\344\341:\212~\350\376\35657\2439g!\026j\216\362Xhgq\377\320\r\343\027\347\314a\00553\361\250Pa{\2405\221\272Cn\226\270\234\235ML\0064\0059\233\214\236\325\246\314tV1/Ds\023\363Y\315\371Bv:\231\"H\363\205g5\007e\027sA\236\251M\314\354\224\346\013\331\231\233\035\236\316\246\240g\265\031t\341Ym\n\312\325\246<\223\235\315(\fg\216^\310\325\246\275\\\225\006\315<\253\322\240g\265I\311\273\236V\222\202\246Pqz\363\240\2473C\177\222\232\321\231\270'U\232\241\344\354c=9zA\316I\322(\224\246\221\027\341\211\203\362\2305\245"
+	.ascii	"\370\341q\222fg\334\323\2074g\037<9\371\247\003&5.Ky\034\363"
+	.ascii	"FR\366\351\311\271\202\237\234\231\236\343r\316\314\234\3630"
+	.ascii	"\232D\315\271\306\314s\372\363\223\363\021\315ONb\246\365\344"
+	.ascii	"\374cR\212\004=\253N\322\2324\261\3524\277\2402\375\351#\315"
+	.ascii	"\323\f\245)\312V\231B\262O\316\331\373\330i\320\f\276\307\027"
+	.ascii	"\310C\t\253\bU\331\366,\177\253\366\352[\335+\fa[C\032\\\037"
+	.ascii	"C\270%6\275)\333\316\365f\237d\352\352G\025\324\352\217\210\333"
+	.ascii	"\317\345\200ZaY\271\362\202IP+\254\271\013t\205\216\240V\177"
+	.ascii	"\327\352\342\270:n\217\313\343N\335\250Kum\\\251;\275\322\013"
+	.ascii	"u\231\356\216{\343:\335\246\233\303\253\267\312\341\372{\274"
+	.ascii	"\017)v\317\347\302c\243\353\305\276L\007]\223\207\"Us\213^\320"
+	.ascii	"\307\312\337s)A\255\376\350\242<\224(\250\325_W\220\017\033\362"
+	.ascii	"PA\255\376\006\277\360\366\324\200Za\375\225\321]\332\001\265"
+	.ascii	"\302\232\0014\035\202\326\020\275\240\307\035\315d'\330\317t"
+	.ascii	"\356\276\b:J\0234\274\264\311\035cr\251\\;\007\2042D\213\263"
+	.ascii	"c\2749\026C$\225;!&0\032w\216G\344q\270\264i?PT\256,\220\311"
+	.ascii	"\234%\3628L\201\330\032q\013\235\033\025\255\212\265\230Bqyl"
+	.ascii	"qJ\230 G\271s\202\322FG\251b\003\n\313\342\261\004\035\245\t"
+	.ascii	"\235\003\242h\274\321\320\342 M(\032o\206*\332\245\262\305\t"
+	.ascii	"\033\035\245\t\033V\021 \226I\242\016\210\345\216\316r\007\t"
+	.ascii	"\3237\305d{lS\260\335\201\007\033xP\302\003\303.aB\204\t\021"
+	.ascii	"k\2270QSc\302\203\032\266=\250\271K\245\215\214\222\270\342H"
+	.ascii	"\fa\331\246h\301\255\222\330\032\333\344\360\345\204K\373\201"
+	.ascii	"\342\t\227\024\307bry\342\245E\251l\223)\220\311\023\216%$\333"
+	.ascii	"\024\224E\t\226\304\026\3052IlsZX\020\2238mr\305io\216-N(\213"
+	.ascii	"\354\322f\004\007m\233\034A\331.[\200\340\201\345\013N\253\263"
+	.ascii	"\023\263\274i\215\355\211\227\326&\002\030Z\350 CH\266-\210\306"
+	.ascii	"\226\245\215\0075\254\322\006G\211\214I\266\313\033b\222\230"
+	.ascii	"\023\302\362\210\034\241]\026"
+	.string	"\223,0\264\300!\266\024P\341\246\315\271q\321\231@\005\307b\212\026\305\fQy$&QX\026U\250@\336\\\220\240;\2646Gdqy\323&\213\"\350(U\304$\21197\270s@(uR\350`\240\264i\215\305\024\220\311\023$0\"oZ\226\312\035\016\3404\200\0052\331\262L\266+\216\305U\205\033\242\021\205\214R\331\036\2279)\212I\020\332e1\207\205\214\221XL\266'.(\333\035#\321\002\311\345\222\350\262\354\034\020\312d\273\242\230\304\341\320H\2356\031b\211D&C\274\250p,\032A\020\241U\356\304(m`\2246\026X&\221'dh\215(\210(\254X\333\233\342\212\026gU\262@&\261\322\210\274\301\027\330\031b@\211\324\301\307\266M\336(\215\306\235\021Z\345\016\214\021\211\004\301\206\005\247M\022[\343\315\220\005\222\002I\2442\271s\323\262\264)\261<\026\327\256\251\t\241C\005$\360"
+	.string	"\366\006\204\216R\205\3152\211\324iA4\352(\2138!\220\305\020\307\"QE\210\233\2442\004\b\001,\217;\310\020P\020\223)Z\242\242 \325\355\271\341\300PchN*\316\373\346\324S{\214\245X\212o\2640\001\321\214\206\376\360\r\354\304\001\272':\234\232\226\312\236\020] \354\027\223(4\314\364L\251\274B\030\217\273%\006{\257\006\235KH\2260\220\022\217*2\224\256\022\030Kx\201\2171\217\333\214$\\\2431\022_\021\023\322c|\204i"
+	.string	"\231\226E\351)x=\356\324\202<\306E\330(jJ\266\366\270\365\242\177>\376\244\020\rB\267\002\241\036\377\r!=\251\"3.\326P\006O\222%!\374,\002\344%\026t\313\300|p\304h\034\003\003\371W\006r\260%P\253\277_\242Ex\206\241\215\201,p\0012\231\036\343\237\317\032R\2434\200`\237^\232J]\371`\0311nTKF\327\007K\026\205N\211\260\2601O!~^>\366H\312\334S"
+	.ascii	"\333\025\230\263\032YRg\343g\343\027#H\334>([S\225\307\270\247"
+	.ascii	"/\340\021\234\232\236\213\013\330\343\251\272\001\373U\024\024"
+	.ascii	"\204\233}\361\202\260\365\320=\306\314\276wP\320\270\271\307"
+	.ascii	"{:\212r\\a\233\345\263\353\233gw\007/\235\205\314\374\312@C\""
+	.ascii	"YPU\376\362\363\350C\214\214\274\246\247*}\007\373\n\216 \321"
+	.ascii	"S\216Pbb\217o`_@\251>\261\347\225\013\310\343\316\214p\215\275"
+	.ascii	"\177\033(\0012\tZ\211\232\243\272\n\203)\2502\0019I\343L\231"
+	.ascii	"!\022\021I\222\244\320\001r\n\020\206bi\036\311\231z\022@$MM"
+	.ascii	":\007\315\314\210HR\220\222\02466\003@Y\374j,5\335\321U\203d"
+	.ascii	"!\213\354H\366_6\220\335\274\342\274\314;\340uY\202@8\330enb"
+	.ascii	"`\260%r\265f\311I\b\374%\201{*\346\\\237\350=\345U\3542\021\036"
+	.ascii	"%J\316\033t\375)D\220\231>\212WK2\351T\0059\261\371i\020\242"
+	.ascii	"\004\270\363r\001\201\350\210W\274G\017\300,04HJ\343\324}A\264"
+	.ascii	"\006qS\214\220c\022J\321.\231!*7\030\262\360\340\317B\341\302"
+	.ascii	"B\234\370\320N\360b\207fb\2069\360T\240\240\250*\003\202\253"
+	.ascii	"\265\"G\270\332qY\317\004#\177Z\315I\3676\200\376o\b\026\377"
+	.ascii	"_?U\371\351\202\031\203!\343\364\251l\203\032\261\327nm\245x"
+	.ascii	"\301\315\270\204\367\353W\200\223U\366'\331\366\320EB\375\342"
+	.ascii	"b\300\025\237\313\323[/\370`\247\345\224p\356A\306D5\311\231"
+	.ascii	"\026\216\266\360\224/\003\244jD\224\336\177"
+	.string	"\343\232\321\321F;\246\200\344\202A\265\330\214\352\263\376\227Z\257\026\233\363\022\350}\371\202)\212\300#\001z)\334\245m\013B\341\222c\320\235q\310\331\247\262\357_GR\371\3359\373E\333\236'JB\336g\311\355\202\235#F\216\307\nW9\274\334\367\016K!\032\tm\376J\235\302\323\365\201\203\314\361\037\351n\305\236\245\034\003\032\2762\363\247L\210\344\0226\020\202h\3166H\310O\274\332\350\026\361Pp\377\232\312*m\226\231\360\201]`\303\375\030R\005\350\244Y\300\365\001\313\247\271-'\021q\3104Z\274;\373r\026\372J{\300\031\242\221U\243\2529\223\336\334\224n\356\260\250?b\365Y\020"
+	.string	"\201X\336\322\210\202=\376\224\006\253(\347\373_Q69\353\246\215\304I"
+	.string	"\225v=\253 yi=\326\367\342_4\035d\354\266)\310\330\244~\366~\037\024T\036\325\267X;\027F\256P\341\005\331>p_\332V:dA\203\rr\315y\263\203\315=\333\312\236<\350mX\020V\247\2115b\352\002\257\210e\311\304\203\007\245\037\3315x\244(#_\\g\025\b\362!\341\241X\005\245\343\t\360\323?\202.Qk\016\353\257\305\215i\032\224\312\274O\224Y\342\271#L\211\036|Y\3453.\354B\300\250R\210\340+0\300\023'\340D4^\205C\343\262\001IL\261\222\006p<\347iI\255\225\265\354j\234*\030\231\220J\005r\255\225\322\210*\304\335b\343g\227P\307%R#%\234k\210\377\\\315\312\025\216\371\036\350%#\320G\3044\314\361\"jX#\264Q\247B\032j`\"\300|\013\221Q\262\350fhE\227zd\303\277_\264K"
+	.string	"\261\371Y[@\213\233A)\213\373 *\"\300\352\325\317\271\233\361\274\241@\037\276|3\251\262\266D\276\317\237\272\033\303\365\230\036\020R1N\375\242\027m\330A*e\204\004t\325\270\371*\222i\275Z\221nynn\231\274\323x@\025\265\250n6\314\374\323\035^^\tpr4U\255D5\343\030=Q\276U\365\372\337\023\243\f\227\017\3476*\007\275m\021w\2025\206\273d\354\"\201Um\027\021\333\300t1*\2027)h\275^O\32600a\022\262\222\354\224\206\356\030\271\306\202]\321\033\226[\225\276\372\021\220\0212\350W\232G!\272\334\247F\345n\262`\200\217\007zB?\324\230\232\034\274\253~\3544A\200]\343\345\276\217"
+	.string	"e\222/InNs(\265TO`\374\n<\311@Pq9\337\007\261\320\242\2470\250\n\340\326JI\275\257\270\261j_\255\337b4\307\322\304s\327\362\372\n\224\360\265/F\002\004\2771\352\262\376\30748\243\001\214\225M\377\030\301s\266\334\323\343*\375\262\205\235\260]\352P\312\235\020\254\2634h\210\366uR\255\203\311\307\020\023YHqf\330\344\021\214B\263\360KV\006\372\252\355\333\255\343\226\252\260zm+\023\021q\314\013j\362\205\362\301\360\336\314\306\033\254\006\246\216\236D\323\372UxTr\324*\370y\316\234\274\226\276\366\240k\301\325\0225"
+	.string	"\231[\227\235\b\f\\\347\204\330&\300\340I\002q\234\321\034\261\222u\023\3319T\214S'{\177^R&\300k\222\272Zb\177\240\260N\276\231\212\267\016\220LUFq,K0\343\264"
+	.ascii	"\242@$e;\200_\346\331zJ~j\223\346\277\300\357\312\022\235\321"
+	.ascii	"K\2477\316\224\260\037\321\351\337\310\267\353\340S\353@\275"
+	.ascii	"fo\226N\276\371\003~3M\035\3444\233\023\341\\\220\241\213\006"
+	.ascii	"\005\217\250/\244\232\371j3:V\263Q\177)B\237\027\222\304\204"
+	.ascii	"\302\017\030\336\300(\316\354@\233\001\247\325r\005\226\f\330"
+	.ascii	"\217\240\\\2034\305~\345\264zku\0277(h\277\026\273a\243\255\273"
+	.ascii	"\020\334S\276]|\271\244\274\266\227\213,T\340\036\\\031\314\245"
+	.ascii	"\202]\351\r\t\fMQ\025\337\324\325r\320\374\f\321\204\233\256"
+	.ascii	"\214X\224t\201\352\314X\250\202\274\320\310E\375\371\005\343"
+	.ascii	"*\326D\252\214<`U\350\002\227]>\260\237\200\263\002\243\277\376"
+	.ascii	"\023 \365\003\366``f\200\206\n\373\277\2361\362\350(\233a'Y\306"
+	.ascii	"\375\013\002\276\304\361\337\001\247\tw\275=\201\341^\325\f\353"
+	.ascii	"\272\375\357\"\317\0277\t\276\246\234\337\316*\267\336n>\255"
+	.ascii	"\364\257=\037U\ru\377\377f\037\355\332\312C\324{>\036\3627W\301"
+	.ascii	"Y\276\211\213\274\rM\254\206\fWr'\203\336\322\236\355j\b\365"
+	.ascii	"@\234j.\321\312\271\003SL\006=\202\357\337)\204Y\364\017B\274"
+	.ascii	"\300\333\024\356\006\205\201\353gb\371\221\363\353\365\367\023"
+	.ascii	"\212\357\340.\333\035\342\234\3164\240O\365N\337\377\370\277"
+	.ascii	"\001\037J\361mx,\336dq1\362\335\317\275\023\240\375\235j\333"
+	.ascii	"\027\252\336|S\377\371\336\343=Pw\3246\310\274\371\3038\212o"
+	.ascii	"@7\360\227V\321c\321X\335\341\310#\227\255"
+	.text
+	.section	.gnu.lto_.symtab.52d961983a29218f,"e",@progbits
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.52d961983a29218f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
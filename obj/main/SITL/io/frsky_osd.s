@@ -0,0 +1,2504 @@
+	.file	"frsky_osd.c"
+	.section	.gnu.lto_.profile.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\027\005\005\030"
+	.string	"\364\"\013\006"
+	.string	"@"
+	.string	"\311\323\267\232\006J\002"
+	.string	"\002\001\002\002\003\003"
+	.string	"\002\001\001\240\342\234\212\n\002\202\313\257\254\016\b\004\003\245\203\376\302\017\022\002\002\005\005\004\265\323\366\226\003\020\006\002\006\005\222\274\200\203\f\002\002\007\002\007\006\205\230\234\341\t\n\002\b\007\303\242\237\321\b"
+	.string	"\b\237\263\321\376\017*\002\002\002\t\001\003\002\t\n\013\002\013\002\f\r\t\342\254\223\235\t\016\n\246\214\362\003\016\003\002\002\001\013\330\262\206\224\004\004\f\373\207\245L\b\002\001\r\336\357\337\307\002\006\002\016\016\372\316\255\300\017\032\002\017\002\003\n\002\001\017\273\362\264\244\f\002\020\306\234\214\254\007\002\021\230\357\275\333\004"
+	.string	"\022\332\220\373\226\005\b\002\023\226\304\334\215\013\001\024\212\341\274\267\017\f\002\003\001\003\025\303\337\344\366\r\b\002\021\003\002\022\026\251\236\360\230\003\027\236\316\215\321\002\001\030\254\341\220\343\n\002\031\356\355\304\344\006\032\365\247\303\255\r\023\023\002\023\033\235\331\203\342\004\f\002\002\002\024\024\002\024\034\221\340\210\037\035\365\216\305\212\f\036\216\333\376-\037\204\242\213\245\003\004\002 \225\344\334\313\t\004\002!\251\240\264\362\t\b\002\016\002\025\002\002\025\"\342\305\201\360\005#\357\373\376\224\r$\361\335\271\311\013%\323\253\250\222\001&\205\201\330\356\016'\245\360\234\\\n\002\016\002\026\027\026\002\026(\223\312\344\345\b)\247\302\251\352\002"
+	.string	"*\230\254\336\331\f\030\003\002\030\002\002\002\030+\230\367\275\344\013\f\002\016\002\031\003\002\031\002\002\031\002\031,\237\352\337\244\007\032\002\002\032-\222\374\252\256\002\033\002\033\002\033.\237\240\365\325\b/\274\346\314N0\304\305\314\373\001\034\034\002\0341\367\310\362\232\n2\234\220\234\363\0073\360\257\277\260\0044\214\237\323\365\0065\276\212\273\364\b6\226\314\345\255\0037\355\264\317\242\0028\206\243\210\376\n9\232\352\222\345\002"
+	.string	":\202\261\365\221\005\016\002\035\002\036\036\002\036;\237\353\353\307\001\006\002\035\002\037\037\002\037<\302\216\275\330\007=\337\332\355\325\004"
+	.string	">\300\262\265\244\t"
+	.string	"?\366\311\255\311\005"
+	.string	""
+	.ascii	"j\250\361\254@\t\2246S%i\241\003\240\202#6\234\007\0210\261q"
+	.ascii	"\206\031\221\tf\024/\354\254\0016\220\241<\265\201\273\027\345"
+	.ascii	"\357?\244\244\352\232\025\357h\021\345\220\326b\226wR\210X/\330"
+	.ascii	"8@\370>\252\340\326Q\206{8\347\213\177\026Z\317\363\006[\204"
+	.ascii	"\274=\3440\217\342Q\034r\230\332@VO+\271\263\350\340\314\027"
+	.ascii	"\204\362?\001\031\246\351d\253\240F(\235\372\230`)^/5L \202:"
+	.ascii	"\242\377u-\236\351\027\310\331y\374_\332\374\033\345\263L5Y\t"
+	.ascii	"\235\314S\354[\223\313\002\201\215<\254\263p,\351!x\305g\355"
+	.ascii	"\202\220\265<\253 N[\222u\323A\377\222=i\277\001\255\177\336"
+	.ascii	"]\267\247W\352\267\337\271\236\032=#\207'\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`%\003\025\n"
+	.string	"\202\314#\"\360\330\2461\260\310&\262\211l\"\233\310V\254\022EQ\024EQ\3044Dj\377\377\337\215\354-wJ\001\356R-\373,\373ZQ\331\237\024\224\023\223\022\222\221\235\211\204\200\354\317\307\362\330WG\343\200\2246v\215\f\214\213\235YTP\354OH\354\021\373A<840,\254\302\325mH)\341\234N\204\363\3404\270\200``\005\336"
+	.string	"\351\004P\357,g\2632\315f0\021\364\270\354\272\225\275|kT\255[[\333\217\355{\372\357Z\256\224l\nd\250\220\224\215\323v\260\002\252\242z\022\200\325\030\206f\214(\026\225D\333\343v"
+	.ascii	"\017u\375 \245^o\\18\271\203\207\272?\2106\020\347L\006\350:"
+	.ascii	"\211E8\032\264\362\352\211\210\325\231\262\212%\211\317l\250"
+	.ascii	"\372\213\3700\223\320\0062z\007\307F\221\210\200G\004\025)}\340"
+	.ascii	"\262\274p\271\265\033\214\267\302\037x5\240\232Aa\203p'&F^\311"
+	.ascii	"\214\234\0032>A\370\236\212n\266\023\252H\036\232\212\205\027"
+	.ascii	"\256\tO|)4\356\304\021\251\264UHm\324J,\263\357\030!\346\035"
+	.ascii	"\032*\335\017\356^\303\324\036\271\303\020\262\270ytrP\254\255"
+	.ascii	"/1"
+	.text
+	.section	.gnu.lto_.inline.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\311\022\035+"
+	.string	"\246\362\255H\240\232M:\305GJ\017\270\020\233\244i\312\372\323?\267\247\"\270e\3219x \337\304\021\bt}\214:\360\n\207\3018~%\210\236\302\210Qx\0351"
+	.string	""
+	.string	"\200Q\303\342\372hR\266\217\0307\327Y[3b\t\331[\312\024\220"
+	.string	"\226"
+	.string	"\235"
+	.ascii	"%Y\316\323\37151\253\272{g;\214\355O\367\364C|\306j\311\216 "
+	.ascii	"\035/\357\367\304\214\361{\252\302\235\236,\367d\t \334\237\340"
+	.ascii	"$M=\320\030\300a\265\244\351'\234"
+	.string	"\237M\372\323\350\317\364LK\360\r04\264\360\353\251\217\273\273\305\337hJ\031\002$3\206\377)o\216w\377/\013\221\362\212\317/\n\236\002#\004I\316\371dI\243'\313\375w6\371<4\273\272\272\220\304\037\005+QeE\255\r\3767\005\247I:\203\345W\177\207\333\232\004\035b\334\026R\n\351\270-\302\311~\354\365G\241\351\024\324\232\242\257\265E\360\267\373\\k\207\3405R:j\354k\257_\205\370\207\305d\205\276\276\226\340#NA3\342s}\"\234\245\002\3670\357\323\233\367\261\340 w\253==\274?\274>\274\313\303\033\245\316S\031\347\251\242\254\213(\021\001\037\355_\233\210:V\301\377\344u\301D\344\341\243\357|\213\370\207\r\340o\303\307m\361\027\315\254\356~\375%\343\177>F\304N\260\230\244jF\274\345e\307\225m\305\223\345<\031\033B\005\265\240l\277\341\263YS\006\313\353\365?Q\370"
+	.ascii	"\377\356_\377k\260\256\"Idx\370j\262p\225\272\003\240\343}S\004"
+	.ascii	"\342=\357N\374\216};\021\210W\234\277F\023\206\325\326\227:i"
+	.ascii	"O\206\314\370\325L\260\222\2321Un>#\313\307V\306\262\2450J\200"
+	.ascii	"9t\370\233b\212\341\332\212\032p\331\337\363*K\213\016\235-U"
+	.ascii	"\200|\251\217-Y\376E\034\344\207\305t\343\232\361\343\202s\330"
+	.ascii	"\267\327\247#\345\355\336I\260SP\353\t\356\271\356\261?\214\270"
+	.ascii	"\021V\332 \256\354I\214\335\034\357\260\034\276a\3240\307\f\363"
+	.ascii	"\206\341\202\205\n\024&H\240\021 <h\016\251"
+	.string	"\bs\320\200A8\303\005\2247g/\005\034\224`7)\221\356\226\211@A?\013|v=\b|\224\307\203M\036\337\024y\274'\252S\220;`\340A[@\n\212G\227\327\tT(\335\035K\300;\253\272\233\026\0168Y\206<\362\326\211\023p\333\031b\366M\235\247\262\273o>\225\363?\200\230\265\223\321\3355\306\351\245\240\226\221\327mM/\240|\340\222\332\264I\222\363\032\255\271\336G\037#\371\020\003\024\337C\242S\246\354R\355\321w\201\001\201G\250\321X\247\214\b\211\210\244 I2\034\001\005\0041\347\240t7\022\200\304,\t\242\234AF)C(\020\231@B\td\342hA\2226\300\261\247w>\234}\223\372B\2465e\302\316\371o,\253\"\347\244bg\344\210\035`\216\270\351\030y8\357\034\2078\305j\230\271\245u\325\312\243\355L\235\346\030\364\210\3645\002\247r6i\235\025\024mI\023M\025\333"
+	.string	"\264%\273\202\026^\322Q\234\300\026\254\277\363\256\255p02\022?\334\2037\331\221fI=^\234\177\320\002\225\253\023\237\236\313\250\253\214\322\342c\345\324D>\tIG\310\364\202H\273\276\202\320\257\270\375e\371\246z\002\364\254?3\351i\343\230c\260\316\343"
+	.ascii	"gm\220{\270\323\023\246\205\002O\265`\260\002\f\352\305\274\017"
+	.ascii	"\246"
+	.string	"\3429pJX\211]\363K1C\245\274ECT|3\326Z\325\300\001q\243L\f\336x\250?#\033\020\3547~wx\365\246\203\032\024\221\352}\342\236*\220\304\253t\324\311\200\334\355\242\t\327]\320Ayn\274~\013/\\6\204\027\336\251,\247\357\201\214\213v!JDp5%O\n\0223\250\377\254\242\264qB\246m}`>\362\024\322\005\357\r\274ea\244\306\237\323B<\204L\007\004rU\372\017LC\223%\020\016Eoq7\256#c0\366\354\246\344D|\207(0\r@d[\222x\37545b\330O\244\2210a\360\245c@2?\343\207\277\0134\316\231\320\017\253L\006\255A+\247\356\367~A\375\214\004\355\270X\026\224\237\207\261\022\340-|U\313\345\305\216\002\341R\036V\022F\253\003\213180\230M\367\036J\354\322S\022\007\270\030\020\267\020\037(B\2704\2268\243\"\30368\377\247"
+	.ascii	"\312\ffq\212A\277E\313\037Q9h.\325tU:\336t\323\365eM\333\213"
+	.ascii	"S\315\341\n\361\021,\375f\373\324\374t#\026v\016\035\364\362"
+	.ascii	"\223\223\354\216\213\2678K\274\0276\330\360\032\362)\204\207"
+	.ascii	"\202L\274d\364\"\272\226\332\376\317\260\016\276f\344T\002S^"
+	.ascii	"\007\302\001\303KY\211\267\001\376\206[\0274\222\007\234g\337"
+	.ascii	"\377\256\0377$i\266k\301\265)\351\f\337\355\354C\310\332>{V\323"
+	.ascii	"\325\201\335\241(\232D\024\247M\302\266\225,\205\366\026Hc(\034"
+	.ascii	"\361{\244F\\\303w\303\226\321p\370\370\314\001\345\033Z\364\""
+	.ascii	"\307\2115q'\321!l\025m\251\017\350\316\240\312\3779\270\305\223"
+	.ascii	"LM\312ev\362j\0164*\236s\207\256\2621"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\306\0205$"
+	.string	"V\350\202D\020\315\2501\245\bh\237f\225\027\2421tc\277}\037\375\344"
+	.string	"\210 \333\221\235\001\025\006\306\264\356!\261\t`\005"
+	.string	""
+	.string	""
+	.string	"T\204\333\342#Cm\364A\322\235\002ck\f\354j\024\260\201\357%v\313-wJ)]"
+	.string	"o"
+	.string	"x"
+	.ascii	")\257\266=k\244\373\335nM|\331\333\026\267\333m\306r3\372\373"
+	.ascii	"\3646\270\353\n\362I\362\371}\302\330\346fv\215c\214\356\b\371"
+	.ascii	"i\317\f\362\356\004e\r\312\3337\313\226F\363\214\037;2\342\212"
+	.ascii	"\220o\023x\201|l\271\370}\306O\013\373\177}sl\347\343\254\216"
+	.ascii	"3\267o\013\323\322L\245^\314x\f\f\022\251\324\226\324Z8\307\207"
+	.ascii	" ?#\310\327\223\221y22O\t\2225A^&\223\311<)\310w\272\242\256"
+	.ascii	"\267v\305\352\206\343..J>9[@\0034\266\365\tr\333D\004\320\266"
+	.ascii	"#\247h\314\343,\004\302!\246\205ZC'\006\005\367\003w\276qOHw"
+	.ascii	"\2349\3304\026}\260\007\257V\263\231I\241\220P\353IS\233|*\007"
+	.ascii	"\277\177\336\224\272\217\202\362}\246T)\327\254R\201R\202\240"
+	.ascii	"o%(\224\212\344\343\343\244\300\351\004\216xx\210p8\035\035!"
+	.ascii	"\221\306\301a\002\262\261\261\372L&\224\206\306G32T\247\266\036"
+	.ascii	"\355\272\223\364'R\253\245\300\216\273\303g4\216K\262\331F\261"
+	.ascii	"\037dq\264\033\255\251\325h3< \017\310\306f\236\370!\330K (\310"
+	.ascii	"\263\202\374\337\340\177\350\365\t\016h\213Q\n\375\371\201\361"
+	.ascii	"\3619\320\323\023\032h}\007\346\341y\t\205\276\263\023\232L\f"
+	.ascii	"\272"
+	.string	"y_\b\037\347-\013\317\315\307\204\b\302{\376\013\337\371\206\267\254\216N\030\313\311\201\275\274\274\302\320%\026k\201\301X^\257\025\027\227\250\322\322\342\022\2410\013\213l\211D++\250\233-STTX.\027JW\"\266Z#\333\211I8\322L))\243\3573\366\333L</\262X\252\317\224w[\311\0327\003\201j\250\021y5#I\222B\226\315\301\005\204 \345\034\232\007\022\300!\242\f\343\030R\312\020E\002\221@$\230\021\211$H\220\256tH!y\241Rt\362\0240F\3438\323\263\262\020\037{\306\312\253\201O\365^\002\350\334\032\205\030\b\270\312\377\233\002Z\343y\303$\342`\254TUJ9\232\004\035zM\016\304\257\025\245*\353Pg\177\002\006\352U\250\224;\343N\225(u\346\235\254dNex\203\035x\035\3401\034\205\245\360\207)\t\312,\261\330L+\247\357\3035\274\240\036\241_\376@\236"
+	.string	"\216\201\006\377"
+	.string	"\33086\327!\340\247\034\230\3163\242\303c\177\317\024\243\260\320\320'o\256\230L\177\240\027I\n\362\3010\334<:\302\230j\361j\270\223b\220}\346%\205\333\333\004\336|\253\246/2%\221g0\327\243\027\216\177B\2144\316\231\301\002\205G\237\251\206F\004\311\373,\275\031[\355\275m\347\301xk\330\331"
+	.string	"\260\210\bl\234\021Z\275\340\335\333\2232]$\343\335\365>g\256v\226\017\310\335!*\347\201B,\225R\202m\213\327\355\230\025\321\260-\243Ko\312\021W\267\352\311\017l4o \232\302\244>\006\240 \025\246H*\211\273d@1v\223Q\373]j\370\244Brx~\2560\253\006\031D.\271\236\350\033\344\206\352\354%\205\032v\300F\233k+\221\342\230\024\270K:\330:\262\372\316\317\bv>\311P\332\330\331\365\315\341tdD\236\240\262\226th\026BQ{\245X\376\224\242}TpZ\331\357I\212\304\366p(\215\230^\317\211\316\031\251\017\222t\211\214\r\016\331w.\003[\"\344\370NI\002R\267\201k\210\315\244\n\312\306\274y\230\210\317ClH\013*\202>\250\342J7\350\322\245"
+	.ascii	"\340\211\307\353\222\317\235\360\271f\312\250\347\3622\376>\267"
+	.ascii	"A#1\311\022\016 \036\026w\312\t\3518\241\306\035\346\322\304"
+	.ascii	"\341\310\201\032ZW\001?\205\212]\363\023\272-\253\333,kq\346"
+	.ascii	"\377\324\250\255\242F\006\355\005s\333\252\324eQ\271m)\271\232"
+	.ascii	"\364\256\302\346\314Qh\200)\226\220\035f\255\021ey9e_3\001\004"
+	.ascii	"\334-x\022'\fl\367\240\362\266\211\365+\215\001\265\212x\005"
+	.ascii	"r\031\004kO\0050\241x\2441\256\2157\301\033\353\300`G\257\003"
+	.ascii	"\203^4BEj\367"
+	.text
+	.section	.gnu.lto_.pureconst.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\"\314#*@\315\264\006\257,\212\342\325r\206"
+	.string	"\036\3030\f\3030\fk\310o\311o\311o\311o\t\370[\370[\370[\370[\370[C\272\f\216\271\206g8\206_\270\205W8\205O\270\204G8\204?\270\20378\203/\270\202'8\202\037\270\201\0278\201\017\270\200\0078\200\277\334\345-g\371\312U\236\362\241\374\344&]IG\322\215t\"_\310A\376q\217w\234\343\306\306\247\361\214\017cvq\213\257\342\243\370\304%\036\361\351\0209\036f\rk\255u\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`[\002\035\n"
+	.ascii	"\302M.3`O\322\0300\f\303\024'B\301AQ\204\332\217\203A\240J\301"
+	.ascii	"\200\220k-nIG\020\275F:\202\b\254Q\330\371\344c\330G\304l#\331"
+	.ascii	"\204\354-e\n_)"
+	.string	"\237L\264\0265\224O\204{8o\233\\2\311\233G\0269d\220\265?\216k\366\310t$h9\336X\343\354\214\2611\276\330\342\212)\236\370Z\342\b\210\207\035\022\264\r\f\237\275\360\n\to\337~f\256\262\"lT\317\254\377\340\r.\370\334\243yG5\253\034\230\302^Zbv\227e\030Z\371\t\004<\200\006\206\336M\303\250\271D\255\313FK0\326\356\355t\232\362\223\243\371\246J\240\252\271i\336\271zw\022X\250`\f#J\032\003\360\202\031*\316\001\020H3\3026\205\345\200\210\362\227i\312:\302\b\275\325A\245\330\275\2127\340Y\"\261\341erF\223\017]}\372\237@!.S\233\327\020]\350k\t\024\211\1776\236$y\301F\001\254j\363\321\312wQ\264\261Ve\350\341\371j5\270\\A\354E\021\345\\\350\002.\344C1\374f\220haK7\233\237\316E;\033d\306\222\242\037T.\034\201"
+	.ascii	"`\210@\220!\2713\363H"
+	.text
+	.section	.gnu.lto_.lto.1a39f81bc6e719fd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_frskyOsdProcessCommandU8.20.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\311\001\275\020"
+	.string	"&`qF\340\322&\035\2235z\2468\3258[\314\364\022#\037\211\302\223\0250pI%\376*)H\035.\260r\2378\366=OW2F\027<\013\374`\231\034C\b7\224%\250\270(~\236\026\375\177\353\335\322\032\331{K\231R_"
+	.string	"W"
+	.string	"Z"
+	.string	"V\331@\376\345\314l\305\211\226\017\2219\247\266*\274\252\272\2140[U\371&\260X\347\255.G<\302\004=\204b\240\274\032hR\"\305\215\363\\m<\226B\001.p\236\301\214u\303\002\345\321\300\224#\243\240\223\327\322=\317\241\fX\216\316\303\271f\020\346\234\326\316\023q\227n\273\3066\212\255\246\366\267\322\224\234##\257\313\376\316\217\372\367\217Hu\266j)\325\021\252\341\2527\252\025\252O2@\210G\204\2379obH\223(\006\265\260\375\223\315\240\201\352_\214wN\023H'W\3733NC\365\035\231\223\314\351\032\002\232\363;\361\202\322\243\277\033\220\217\245\023\220\217\001\013\327VY\321w.a\301l\3005ydw\001\300\206ZI3\032\203\373\362\277?;X^\266.\177\223\272Z\324\363\203F\217\034@\277v\006\026}\247\373"
+	.ascii	"\005\315\256l\267\334\247Ci\316\351\300\357y\r\027_\347\321\334"
+	.ascii	"\213\276{\221\217_\023\f\035Evf4v8\347\234\273\257\333\267\324"
+	.ascii	"\266\336P,\300p*\037Z`R\0304\216E\323\300\262\342\242m)\030\r"
+	.ascii	"\005\201\271\r\027R\032\007\216Ki\247o~]\022\206\210f\026\204"
+	.ascii	"\314v\304\307\207tB\n\350\256\\{\002\005}\227m\tkW\216+W}ZI\307"
+	.ascii	"Q!\246\244\023\327\003,\210\r\t\005!\200\210\342\276|\031\211"
+	.ascii	"\332\003\257\027=E$\272\001\" \200\202\221\262\365\342\300\352"
+	.ascii	"\rz\255\204\352\355\332\360U\260\315\0212\314%m=\334\362\206"
+	.ascii	"\r\323-\216 \2055\237\033\223\021w\366\355\255\252IC\026m\005"
+	.ascii	"\026\345\"C\277\206b\004\226\253\233\033p\224zon%IxS\313\030"
+	.ascii	"?\302t\0312"
+	.text
+	.section	.gnu.lto_frskyOsdSendCommand.21.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`'\005- "
+	.string	"\006;\316H\220\230Nc\202\327\026\3277\227Oi\310\036\214#^7]\032\273\002}M\244\027\001\211x"
+	.string	"tR\023\021\n[\024\302>B\265!iB4\001bF #\021\020[\252\0170\203\3348\364\\\303\364A(\222\275\367\336R\246\024\267"
+	.string	"\247"
+	.string	"\276"
+	.ascii	"\227\310tS*\261\205v/\262\301MK\260\313\034F7\001\356\020\013"
+	.ascii	"\212\307V\373W\307\021<\322R.s\257\324\332\016\362\002\316\233"
+	.ascii	"\351i\316\233\256\325\206\300\023\374\r\240\355\275\306!_\367"
+	.ascii	"\"w\274 \275\351\240\035\345\310\251\213R\325H\322q\345\336\233"
+	.ascii	"\263-\202\265D\336i\r\376\226\242gik\320G}\020pY)6\035\375V\242"
+	.ascii	"$\226\252\216\204\351\251\354YC\363q\260\244\232\036`\341\224"
+	.ascii	"\342(\352\003v\223*9e\205S\212\237(^\226\f\320\300\252\bX\252"
+	.ascii	"*\336kXmL\023\261\324\271\367>\371\252\324$\254\025\365\271\367"
+	.ascii	"\272\026\233\234n\227\333~a\373\202m\036\bH\265\315F\n\253=\332"
+	.ascii	"\357\231ZC\263\225\262\237u\347\340\034\371\337\374\306os\255"
+	.ascii	"\273\346[\367\314s\3742\377\272c\236u\303\244\325/\265\032\227"
+	.ascii	"V\273\244\325\267Z\235\246\325hZ}\242\325&Z]\246\325\026\255"
+	.ascii	"\256h\365\013\320D"
+	.string	"\035\261 v\357R\233\226k\304\364\001\343_\177\326\257\365o\275\264o\237\313\0073\356\313\250H\225\264\360\256{\3318\377\316\345\262L\310\275\027\367\263q7\353u\274\307\223\306m9Lg\030\340\016\251l\304\250\220\3568\217\340\265\034\226\0361\245;\250\254\320\356\275\023\322\233:\345i\316\254\242\007WH\265\315Z\036b$\232P\033k\033\304\315\200\004z\354\fg\242\301\306l\311\016F\tO\223\250\323\246\326dK\332\202\332$H\216\274\230\006<O\213Z\223\215h\024\222\001w\306v\t\212\234\226\b\013)\243\325\325)S}\257\r?\365E[{t;Z\031K{\364\201\247\265\367\372M09\232\222\344lX\327rNX\321\260\366Xcg\354\3151\013\026\331\260\256\331\2645\245=\362D\247iM(\304\030\326\226\366\006\272\030\220\202\231\255{\220]\204\251{o\004 \017\343\371.n\332\203P}Q\350\274i-"
+	.string	"52,W\325\316\330w\375D\347m\265'\032\205\265\3152\366\326\227,K\332\022<^\r\322\371xED:_*\244\363Y_\210!\253\033\301\373\225A?\275\017\"~\206\320 ! k \007A\277\336\006\021\036~>\016\271\036/\007\202\367#\224\003\362\375r\016\006\2707\244\363\345B\364z\276\034\016\211t+\225|\372C\205\021$+\274\331\243og(\2165\241N+\035\354.T\236\256\320\034\373\344o2\236\252\316\033\013c\225dl\214}\032V\221a]{y\357\275\351\203\303\330\234\031B\2433\306\342\330Gq\225\021\215/\035n\005h\240\212\206\034*;"
+	.string	"jl\305\264\247\005aH]\370E\347\315\027\213v)A\335,\316\236c.h\300\234\224\235\202(e\277Y\027{\216=\001\346\234\354\024\234\335\354\301\336@mI\215_\250A(\244\021\244\f#B3\"\"I\322\030\260\002\031\261\"7\021p\265CdbRm\007\261\300\267\\\0379Gd6qT\3221\345\352\207\245`6\215I\301\211%\2160\377"
+	.ascii	"\333H\027\222v\202L\337\210\025\237B\354F}\374\225\310\2508\264"
+	.ascii	"3\236y%\006\bP\240r3[\327B8>\025LNF\016\326K\210\377\030\027"
+	.ascii	"$\253\346m\321\030\203\252]\030o|\021T\034m&G.4\324j\235\264"
+	.ascii	"\357\263\246\322\202\275\203lq\375\373\367-\377\236R\232\372"
+	.ascii	"p\213\1774\270\235\224f\3053\300\360'\2716\035j\305\275$\251"
+	.ascii	"\326`\305\r`\341\330\200u\302W\376y\016FV\241}\342\214d\214]"
+	.ascii	"\257\276\023\035\347\346\330\024\252\006"
+	.text
+	.section	.gnu.lto_frskyOsdUpdateReceiveBuffer.23.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\024\017\225;"
+	.ascii	"\332[\234\024GP\\V\007\177\327\360\201i\320\214A\035\262\f~\b"
+	.string	"\375\250\006\320\024\307\007H\020\024\365\032\340#f\317\033_\230^\327\261\022\317\250R{\033\222V\250*\223\247\"K\247\261\310\201 \204\324\"J\327u\263{\357-eJ\0018\001 \001:\001\356\253]\273\332\277\002\362+\f\007\274y\266\332\356\315oo\026\257\267~\326F\024)h\330\264-_\363<\227\275Y\213\277:0\n[^\013\377'O\346\342\257\376\222\221\316\363,|1\3771\005\f\240\336*\377f#qv+\317n\236\257\t\376\365\241\337\277\356.\334\205\377\276B\207rO\363\327\352\034o\3219\243\344\315\363\254\334B\034\251\241\376\2104\362\354\350\344\340\024\211Ca\020\370\213\341\327\335\032\312_\267\305=\243\315?\2721\225U\221\207\203\026q\037\350\331e\371\260\3271\242R\032Yu\345\365F6;1-\017\331\177t\207\310\020\255\223\343\"\250j\234\230B1\231u5}b\217\251\036b\205pP\036\356"
+	.string	"$\320\035:\350\002\301A\273\334\002H\240:4p\354]']\354\304\264\277\354\023\230r\025\323\306\017\007\225\n\243N\r\307[[5YW]\377\272\3060@\320\024\243T.\202)[\215\037\373$\022h\227v\267||\0264GU0:\005\007\323\206\244y2\013\332\005\357\017{\fsuj\262\256\274^\307\024\346yv\375\214^\275\373\274\373Wqw\004\356E\235b\n\254\366\276\304\233\352d\\B\326~\250\026\2057\365exN\026 '\3074V\343\200f\333\257\273\237\271\034a\257\320\313pr\037\020RWffJ\353\371\253=\317\335[S\3639\025\355\215\033\356\246\276\030\3771\256\365\315?\314\366j\363\007\243\255\274\370\177\371\030/\214\314X\\\374\273x\232\337<7\177\352\037"
+	.string	"\376\327\365s\206\241g$\315\177\252\237\363\320\002,\247\356s\367\245\327\";\250:\323ga\026\311\375\213Eo\342\230=m\216\376\355\016\242I\3773\271\007L\355\246\273\213x+,~\363<7\360G\373*$\374\271\376\365\022&\364?M\300\377\376\376\261/\260e\017\314\032\245\267\373\214\013Uto\252\373UJ\377\203\252^\237o-\367W\2732\326n\364j/z\353{Rk\007"
+	.ascii	"\324\036\344j\007z\265\377\304\332}b\355\310W\373\021\326n|\265"
+	.ascii	"\367\300\332y`\355;\257v\235W{\316\253\035\347\247\275\370j'"
+	.ascii	"\306\332\207\260v!\254=\370j\007\302\332\177\261\366\030\326"
+	.ascii	"\016\277\332_X{Z\230\243\356\215\270\265\206P\3164\331\210\031"
+	.ascii	"\036\351&L\364\022$\235DF\242\217h\223\264\327\262\210\356R\322"
+	.ascii	"D\206\350-\254/i!Xg\322A4\025{L\342v\025\316\277\204\207\233"
+	.ascii	"\210\013\257\f\314\224\326#\212\033k\006\235\340\342\376\254"
+	.ascii	"2\267\344.\356\016kn\316>\342\376!c\371\210_\206\201\233\270"
+	.ascii	"\377k\215K\325t\270y,w\350x\2561\332\361\036"
+	.string	"\366\3609k\b\267\321v\035\334\277-\3340]\325\036p\007\367#i\251\374hU\034\314\tr\372\306~\264\255\3753\322ms\266k\247T*I\323X^1\215:\272_\2645k\321\266\232!c\210\212&\025\227]\023\244\335\ro\177)\0326\350\177\026\355\227\362?\273\355\233\326\216j7\375\335\360v\3118\373\\I?\345\307\302`Jx\361\356\307\316Y\223\333\335/];s\366\261\375P\315\007Pk*=\3054j\251\261\327h\\J\246b\277#\335\224\365\274\325:Cz\276=&\361\315\3312\351\363\226xn\356\260yo\367\237u\245\277c\263&\326\302~\335\371\313\360g}\351\353\344c\326\231>\r\223H\367\331\327bZ\\\323M\357MF!T8}haB\305\323\b\245S\t%\212\022 N(\233\236T(\215\200\334)\205\210'\345\n'\247'\245\360\032\365`oQ[\312\356\b\365\004\016\332\332\315"
+	.ascii	"\r\264\335+X\320\377\f\332\020\260\364\226\305\257\017h\177\330"
+	.ascii	"\017\215\301\373w\221\233\272\345\235\302;\215\357\033=m\021"
+	.ascii	"%S1\236#\215\347\246\r\222f#\257Q\223\244\353\226i\350\224\364"
+	.ascii	"\0313sd\276\244\343\310\234I\227\321d\310v\222\373\307\214\030"
+	.ascii	"\331@\025\216\031@.\314\317\006\222q\323Z\341~\250\306\247\363"
+	.ascii	"\344\335d!0Ld\233\220\252-/gS\335g#\347\276,#xa*\327|v\2049\353"
+	.ascii	"q#\271\310BjLd\332q\003m\264\201)\265d\301\302V\306\263\215\333"
+	.ascii	"\337L\271\337\254g\033\255TA\353\341\331/\375r\305\331\347\356"
+	.ascii	"\036tV.\360"
+	.string	"\300\375\202\236\222A\200\024\246\361L\302\234\024g\357l\230\317\331\247\263\243\310\f\314\230Deo\346q\266\316\206\371\252\246RG\232Lfpe\022\215\341l\342\02260\253\333\017\325\334p6\3255\321}\031\026>\207\373e\030\300\216\341\016`\207\311BrN\230\310*\2304Jo\335\342\246\006\2016\250q8\350\234#4\"\242 I\n\222\326\261\005\204\030\351\224Y\007\021\300$\245\030R\fUM\2224\007\361\261>\256)a\324\023(\310\242\267in\251\037\257#X\020\322^\331\23700\275JB\\\241a\322\315I\371\003t\223\353\264\013\262\023\224 \337\037(\352#75\333\355\371\241\222\343\366|PI\307\351\321h6\220L\206~\250\332G@\r\205\257\323wU\215\372t\250\203\021\033\315\224\310\231\304\240\003\004v\367\252cm\352\273\363\227GH\354)\022\002\332A\210\245\263\305\007y\035\030\331-BA\027\237"
+	.string	"\372{ #\334\345\307\007^\265\031\233ih`1\005\202\001\005\2627w \312\352\323\225do8\263\3668L\032\235@[\266\217;\373/\200tD\2674\357\357\321\234\375\247a%\r`\374\216\273\206>Cc\262\224XO\367\270H\037\331\007\273\335\236/I@\227\313\274\373\360>\230\267\323#\313\007\321%\375\243\241j\037A]:N\003\207Q\213v\220\260}"
+	.ascii	"\235\020\234k\251\351\023a\032\313HJ\333\342\213\270M\375-@8"
+	.ascii	"o\363\322_H\3761\0231^sM\215.!\007\244 \031\332\342\223\230b"
+	.ascii	"8]\013T4\202\374eA@0\200r:k\033\252e\271,Y\177\023\354a\270k"
+	.ascii	"N\244J4\034\026E\346\034p\347\220\311\237\305\315\232\371\223"
+	.ascii	"\260\207\226\007:\b\272\374m\251\342\374b\232\254[\370\203\n"
+	.ascii	"<o\245\340\356\027\305\025gG?\277\316\370\fs\363<;`w\246\036"
+	.ascii	"\346\356\373\241\204C\267\221\272N\207\026H\221\321\025\206\242"
+	.ascii	"\363\373\355\303\367\267\017\337\356?\200rO=eQ\261\004\233\001"
+	.ascii	"\205C\036\230\022\270\003\303\205\251\n\304\001\303[H\037V=\303"
+	.ascii	"\201\002y\b\254ih\250^'\343Ido=\034\213\034hJB@\030K\366;\231"
+	.ascii	"\314\262S|)\206\373'\361j?\034\352\003\312\273h<2\324\2100\177"
+	.ascii	"\342JJ\325M\307\214KL\334\306=\257\215\353\3521\006\330\br\030"
+	.ascii	"\tc?\231\241\304P~b$\304~\271g\006o\306`mt\340\"H\024\030K\263"
+	.ascii	"7\2113S\233\376\257\261\245\364\246\354\373\003"
+	.text
+	.section	.gnu.lto_frskyOsdHandleCommand.25.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`%\n\0252"
+	.string	"\272S\200\022CPdR\007'\254\301\257^\035\255^v\302G\032\216\306{\341\313fP\312\342\235 \001\020\315\n1\255y\207\026\357i\274\237wDi\210\n\b\001C\001\306\336"
+	.string	"\334\217\350b\277\332Zkw\223\275\267L)\005\023\001\f\001\032\001su\276\346lRn\246\221\272dY\226\345\234=M\252;\330\243;\350+\356\236\352\016v\267Z\306G3\003\206\372\230)'\323z\006\212\262\361LHR\353kC\333\377n/s\263)\177\006i7\347\2579p9C\223\032\251\365u\201\033\261\276\252.\200\365\265\273\373B\206\251~\035\332\334\372i\341e\241\r\312\031J\304R\374\365\"\242\241\2410\bt\333\037\273\252\370\337v`\222\312\213\274\252\351D-\370\224)\223~q1}H5\332\302r\\\252\022\366\322\004\032\252\024\3248\003;d\023U\200\262-*\374-\301y\0033ke\316/.\246\007\031|qu9P=\002cJ\335\016\311D]"
+	.ascii	"\247.\313\331\272\336e*\277\265C."
+	.string	"\371e\261CI\254u\315\337H\362J]\220s\366-\310\346\253\252\203:9\245\333!\233j\002&\025<\216\346\f\266 \231\217\231^F`\322\212\025F\307\230\370\027\262\271\376o)\347\334\177Lry\003\360n\177\321\335\034\272\335\254\007\332\242c\354\030gb\035\373\327\231\036\343\363Qp<L\n\2329\0337t\303\360h\2146g\243\322\235\025M\004\356\2548\261\276:\376\245\2459\343\252~\212A\331\026]\213\232\\\240\234\321\271\361'1uR\325}\260\003p\004\261:gr\214\317\327\316\306\335\254n\320\036\325\367utL\351\206\353\332\351t\236\322\335\322\013\323\265\313y\274\2657\355p|\216\223\271\3666\235\327z\020\326\327\026E\226\263W\366E\256\273\363\016\220\021\242\362e\336\0373\222\257\001\260\2439\01338\351\036\326\027\352\206Z=\016\353v<\235N\365\032\203u\003\277\217\234\214\273\221\227q\037\340O\367"
+	.ascii	"\375M4\374\036\022~\017\201\337\302\340w\260\277\201\300o\027"
+	.ascii	"\370\335\272\337?\367\233u\277W\367[u\277\261\373\375\356\267"
+	.string	"7\320`e\351Ue\017\306\003\315[SB\271n\215\023\353nw4\036\267\303\323t\n;o\016W\344R\354\336\321\255\346m=\374L\343'\001\257\224\367ccL\345k]J \004\366\b;\233\377\222\"O*?u\362\264ax\260\227\002\241\3159k\350\017\373()\332\333~\315\233\017\353k\321\021\3666GJ\242\225-\315\340\334_\366\311[\240\351\304%\223\033\364\247\352\247\215\225mQ\327_\026\210\375\235\362M\336\326\013\210\327@oR\267\3123Q.Q\262\242]y$\257\323\305\301\350[+\366G^-\016\336\261\347z\273$\221}^\336\310\353lq\220\r\032\351/\314\023\321:\016\341\363\232}\326\017\007\311\3208Y\334\375\212\371+\023\n\232\037\336\b\342\304[}\225*\027\3423\213\203XnR\021^\250\217\320\b\347[\261\233\346\346|V\375\264U\334M\302\007\231(p\327}\302\005\2450j\346\234\225"
+	.string	"y \025\335,\\\274\037]"
+	.ascii	":\366\351\027\356\207\251Uq\t.v\226fOvL\351\326\2569\023\213"
+	.ascii	"\2610\317\367\230\374M\317\325\356\274\345X_1\366\267)\377Ss"
+	.ascii	"&\366\361?\223\034\217I\351N\017\261\371X)\217\007O@\240\244"
+	.ascii	"T\031M\305\033?\232t\374d\340p\302\355TA\206T1\306\017\033RQ"
+	.ascii	"3\210E(b\016\250&\034D\247()b\005\004]\324\361\024E\344Q,F\021"
+	.ascii	"\203\320*W3\006\353\377\255\370\207\302_\372\263k\236\264\245"
+	.ascii	"\246\246\376\222\004\036\237\332\033\321\1779\021\326\352n\""
+	.ascii	"\374\330\252}\215\373\367\2519\347\\\204\303\346x/\271{\226\253"
+	.ascii	">}DK\337Po8\354\020\017\341\356\227\352\265\352\340\344\241O"
+	.ascii	"W/\346\315j\307j\274C"
+	.string	"\206\360\n\350\230\344\315hh\360c\367\253\365eo\021\017C\354q\366L\217I\252~\332B\334\375n=\230W\313\203;\347\333\365\305-\371d\257\363\273\254x\217\264/\022\326W!\016F\243\316g\0015t\332\f\341\260\036\223\241\357\214\316\370|\2556w\205\034B\261\301<J^\013\024\005\345gy\273\304\202\330\325\370\004,:\3513\216;\232\267w\346\220R\241\205o\367\301\266\267\036;\241=\356e\276O<\316Y\bBJ\367\2600U\260\302\267\263\275a\001\200\326\250q8\004\225sfDd$I\222e\f\240\002\231!*n\003\021P5SN\215\266\311p{\260\016\233[4\031\355\350\276\017\213\277\304S\365\b\340S,!\002\337\370\177\022d\373\177\0258a\207$\262\302P\232}0\262\035sl\213yV\320\223\376MA\224\b\352\031TsA\230\254\264\340*\235F\230\322\324\242\345O\351U/\203GK1"
+	.string	"\245\360/&s\220\371H \026|9\325\025\254YT\003\301omS\242\3509\266\357\324>\n\377^v3\224K\t5\031\022\335\023\301\266\222-\336\317\246X\317d\324\025\201\357H\344\214\335o\305\262%\244\026l=h\221\344^\006\205\354\312s\024\242\266\247\235\230\313\221\254'\212\202\347\024G\005i\3758y\344\254_\004/=\016RW\267{\357\350\245w6\232Q\310\360"
+	.string	"\bq\224\370W\256f\211E\030\300\376B\336\2458\t\207@\262\266d\253L\205\325\270BG\200L\203<\375\300\267\332-\276\210H\221+c\375/\305T\360\216\22202\023_\357\013\201\204{\370\332v\276\306\236\007\b\361\322\352M\374\343P\357S\207\026M<\365\022\254`B\023\030d"
+	.string	">\306'm\020t~\251m\327\277\354\032(\266\352\002\317\227\361\342Ae*\235\363\3525\300\013\247\375\315*\013\243\001\020\345P"
+	.ascii	"\206\023w\003\365\231\305\362\"\271\215\237!\321\321\327\036"
+	.ascii	"\235\223C#\233]\212\025\336s\361/:el\233:\026\231\300\265Q\""
+	.ascii	"UJ\201\341=\261I\306\363\f\3543j"
+	.text
+	.section	.gnu.lto_frskyOsdDispatchResponse.26.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`P\003\305\026"
+	.string	"V*\224I\300\324Qch\306\224\200\247D:\212\377j\371\004f\210\335z\243\215\234\017];\366\021\023#@\256\253\346\345\361\231}\031'\261\0174\243v\311\214/\216\243\371p\024\202)mS\342\335\177\320\001Lh\017m\203\244m\271\245L)\177"
+	.string	"q"
+	.string	"\204"
+	.string	"'\372\n\235\233Vr\361\230\b\204f\351\273\367.`\335\272~2\336\2127\031o_\326\\;\346\315\251\b\217J\224['`\335Z\245\201\216k7{\271\325\007(\037\026T\367\232\257j\342\265[\261\322\232\277b\371]\364Q\rq\272\235\333"
+	.string	"\272\233\350\272\367\376\354@E\226\210WQA\024\r#?OA\350n\342I\016\005\356\277\323\037\035\017\245+\226{\257)N\027\342\036o\033f\333\201]{\001w\245\305]\324\370A\267\226\335\320\343n\306\333W\f*\230vCD6:\264\315\033\255@\366\305[y6\371\340]r\363n\275\274\255\251\305\221\272Zj*R_"
+	.ascii	"\004\246\035\t!\"\265\311\274\271!\222\313d\223R<\370\227\277"
+	.ascii	"\371j\337~\221\177\232\f\322(\b\235Vnt\240M:\347E\266\245oW\336"
+	.ascii	"{\311[;\307&o\251\255\343\017\375g\322\001\274\240]"
+	.string	"9ek\243X\r\224%\214L(\255?\272\r\027\3333\364\335k;\316Oz\215\f.G7\324x[\253\375\002C\217\023\253\253\247\356\270\244\326z\262\322\372\200\352Ly\253\222\265\202p\330\263\273]\306\221`\004\234\202~^f\274-\251?/&\t\205?#\336;\0225C\254@\257'\212\316\245Z\201\214\362V\275\021\321\257\310\217'\036z\304\257\255\372\030>I<s\0304\006=;\366\0274\007\234\356\r15\260:c\023\223\231\265hd\324\260\224\030\034\331\013\215\006g\246\341%\213\275lb05/\330\f\347\225R\300\262\r2\263\027\007\231l\366\"M\333+\317?\037!\347\301\007I\374k\343(T\345\203T\257t[\177l\333\372\337YRRQUQ\266z\233\371\020\332\223\020\336)\341MA\200\264\200g\313\204\373h\351\3014\025\244z\216\037h\013\347\261C\307\212\027\364M\331h\343\201\276\360%\332"
+	.string	"\240c\307A\003\240w\243\006xZ\006; \260\002\231!\253\003m\243\340)4\247e\350Z9\033\214C\330\341\334\314\335\203!\235_\350\027\035\237\007C;O+s\202\307\375\227\005\t\201f\030\334d\213V[PY;\225\356p\341\005\343\374\322\306\324Np1v\3400\266&\235\r\033N\270\376I\330EQ\244\321K\020M\3603oKlVo\302Zw\242OG&%\034\253\271n%\266\023E\342z\020"
+	.ascii	"9\321\001#\n;\302bst\327\032x\260\f\005"
+	.text
+	.section	.gnu.lto_frskyOsdClearReceiveBuffer.27.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\204\002\255\021"
+	.string	"\346]nH\360\316\2521@\230\333B'\202\263o\"\t~\021~\324\330 \031F\236~N6\331\244\276\360\340\023\227\373*\206\312-UK\206\027\350\316\375\177\376\247\201\323.\262\025\312I\307\274e\246<Y\224xI`Cfo\271\245L)X"
+	.string	"S"
+	.string	"\\"
+	.ascii	"\226\206\254\262]\234\006\273a\254C\313\246w\357\025\353\207"
+	.ascii	"\253\016\332\257R\225/;\201\235\223\2037\317qc\355B\224*\267"
+	.ascii	"\033e\206\317\300\2757T\246\320\017@\251\362\372%H\351y\330("
+	.ascii	"Q>QPk\305e\247\032J\026\245\341\202{\257\251\253\344p\207\267"
+	.ascii	"}\262\215\300\246\273\364\256\021\360\326\326\237\247\263\230"
+	.ascii	"K\313\214\271\242"
+	.string	"3\fR\333\302\005z\227)N&\307\252'6\215E\353\213\375\357\326\227]\251m\245\276\310\203GG\322s\357\206\0312n\316\342\304l\337\247\375,\371\314a\t\226\022\37337M>s]\321\211\271\265M\354\320\003\346\351\354\005\3232\343\375\266\222\003\262#\370\212\201\246\205\035\362\021\343\001\230]\372\315\324!\342U\243\225#SYb\247\356\023@m\221\221\b\007\302>7\246K\255/\366#h\353e\037@\343s\276\330\261@\241A\376i\322m\243\007\354t\3515\023\307\317\275WA\315mN>\314\255\311\221\036}DH\221\020HL)\224\004\221,\211\023J\"'q\204J\211\037\005LR \241\304\n$\211\022C\264\325\353Kv\0060h1\200V\225\005\206|7\252\320\275l\r\336\203K\241Qc\363A\300\233vp\024 'xx\265\336\203\357\350\344\204\257Z\f\357$~\323\244\343\214\035?\246K7a\n"
+	.string	"\273\t7 \320\002\231\251\262\003\002\003~\222\306\350r \330\223\021\033\34025\256\203\351\332\234\303\211\343B\016]\354\r\366\020\365\301\230\271\303\301\374\3622g\224\253\210\331\004\267\037Se\350"
+	.string	"\206\314\004j\374\301\332\215;@\3121\003\226B^\231\035\177\212\307\356s"
+	.ascii	"\235X\266\306\327\245=\214E\323H\270\335\342h(\202\204\006_#"
+	.ascii	"\374\3532@&1\231\020\303\324%[\3735\004\006\005"
+	.text
+	.section	.gnu.lto_frskyOsdSendSyncCommand.29.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\254\003\345\032"
+	.string	"v\362\260F\220^Qc\f\002N\270"
+	.string	"\2357\377\352nJ/\343\022]\376\360\227BY\310XF\377c\006\303\332\253@\242jZ\223\273=\327\301\276\277\033\020\t\020\\ \006\b`=3\023PhL\212\357p\334\315\335\366\336R\246\024\237"
+	.string	"\216"
+	.string	"\241"
+	.ascii	"\346\272\200{\177t \240\237\221\037\313\367\220\037m\353\245"
+	.ascii	"p\266\367:eQ\271\027\205\340\006\345G\t\023\214\234;\032\225"
+	.ascii	"\004K\222\262\001\345\315\275(\315\nqi\230\315=V\302L\362\034"
+	.ascii	"E[s\276\3561-\245\246`\215Z\376X\312q\230\f\t\323M\035\017^A"
+	.ascii	"\022\245\246J\"-\345\370)Z\230b2\344ZJ;D[e\205u\372\220\352\370"
+	.ascii	"\340\027,\031\003,#\3641]\304q+:\350\252\342&\200\217'\316\222"
+	.ascii	"\214\364\236\276\336\360\355j\205a\270\367\272\366|K\367\316"
+	.ascii	"mo\261\255\301\2665\002\026\312\376\201\364L\224\355\3176\253"
+	.ascii	"gfu\317\257n\331\243\374<\257\372w\216\376\347\245~"
+	.string	"\323\325c\254Zt\265\215UW[\375\002\227\203\276Y\203\343\2727\351k\316\0053Z9\362\253\337\276?\345\251\355B\227\020c\363\245|h\237\206q\241-\026\2317\367\336\023\206}~\254\266\221\037\364i\373\352V\352\224J\253T\330u/\372\340\243/\220O\016\305\350Qn\242\354\362\2004\251P~L \216U1\b\310.\017\250C\202X\355S\335\211\321\321Co\270\027\034\202\250\2419\274K\207\001f\262f\366\303W\251#ONST\036v\2764\331\2554U\302\221\307V+\263o\203\344\264\253_\366\2516\210\020\365\275j\037|\f\t\234'8]\342S\0215\033\333\n2\264\307\221=V\005\020\r\257\306\361S\217\270\026\234\0013\251I<K\t\236\250{/\205+\307b\302/\362\321'P\324\367P\220\037{\354\3233\360\r\273\234\246\250du\307\236\366\326\376\001J\200du6\355-\r\240\215:G\365\313"
+	.ascii	"\252\315\242V\337\363\2037\275|\201\331Y\235\215\356jA.\204l"
+	.ascii	"Q\f\233\320P\255\b&4\243v\023\177\212~\202\304\240! k\240\bA"
+	.ascii	"7[\n\031-nD+h\266\032\315E\355g\210\006Dt\243E\360\261\355\205"
+	.ascii	"\020\021\255\310f#\242\235\350\321\355\317$\027\027\253\264|"
+	.ascii	"\230?\370\017\\\251UJ\3769r\2647\2541\034\331\335\220\230\205"
+	.ascii	"\262\314\212\366J\200Y\274\032G\264\001z0\375\342\275\367\226"
+	.ascii	"\024\264\270\020\201\025Xbsd\332\237\237#\255\255j\024T;\347"
+	.ascii	"$C}\317\332O=\355\254\356>Sxx\221\026\312\277\r\362\370a\235"
+	.ascii	"\366\347\3618r&`\313\313\207\327\326\231B\250A0\242\210D\206"
+	.ascii	"\221@h\202\021d\220\244\003p\002\221I\325\003\020X\311\264-\214"
+	.ascii	"\001\302hM\245\016\235^\032\201\177\367\bj\3636\003\270o\266"
+	.ascii	"Z\013\n\007\351d\272\302\003P8\233\206\347\324G2\257\332\367"
+	.ascii	"\351\266\300\355\003\005*'\271\035\3536\330\346$\035>g\373\220"
+	.ascii	"\266\020\330\211\343~\261\251 S\251\030\240++\202\b\272\204\217"
+	.ascii	"\f\343X\234\004\355\345\3409wA\337\220!\327\227\025\334#\344"
+	.ascii	"\315\243\ns\220\373)\217w\206\314xD\250\371+\344S\254P\003"
+	.text
+	.section	.gnu.lto_frskyOsdRequestInfo.31.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`U\002\325\023"
+	.string	"\266\244\202I\300\224Q:\350\230N\247\002\211T\354i\246\243\321H\225\256\037\331>\273\006[ue\025\033IT\276\366\215\205\272\361-\017k\317\313\243\207Z/M\230o\334\262(\212\005@U\246\274q\263\207\331\210\267\347\367G#{\223\275S\nj"
+	.string	"f"
+	.string	"q"
+	.ascii	"\3627\257|\241\017\311n\253I\315tRF9\212\364vq\nN\255\222:5\360"
+	.ascii	"\224z\372\035\245\236Zf\0339"
+	.string	"\356g\301 \"%tO\273\313\232,.{\245\337\2242\377\267\233\210\265\331\253\252\226\342\024\305?\022\273\0339\277\004=\035INj8_JN\013\361\267K\0235\232\224\340\204\335\265\024k'n\360\266]\266\035\330\022(v\bB^\2543\200\212$\036m\316l\034MN\037\373s\034\307\321\263\307\256\322\252\333\356J\245%\225\376I\201'!#\226vs\306\250\345\321\035A'\372m\227\366}\243\357f^d0\352\307\214?\343:{e\232\027y\356D\305\330\335\325q~\256\301\003\331\211b\251u\001\326\bj\352\355\"1H\235\3324\366\3524L;\263\274\307\005\036\252\371\335\021\324\216z<C6\024\371;\251\276\3509\f\035n<\036!q\301}]\206\026y\321\327\235\305I\007\252\2073g\376c5\367\003;NOHl\344\370\037%=\2449}\\\347\347KN\351F*\261\355r\0345)L6\314o\264"
+	.string	"\374\354.\004\033?\342\340\003\235\332\025#/\306\324\323O\n\303I\206\315F\2166\221\0012\241\013\366j\211"
+	.string	"gB\231i\230\025\r\260\260%\026\003{m`\205.\226\214\313\305\003\013\346\005c\255\fp\370\241\365b\205\b\303\027k\205\263\371\267\263\347\366T\020(\236\315\244}\273\2735\366\355\256\220\320#\222\243\345\004\242\324J\372t\342\021\220\3515\265N9\237\273\312\322\022\332\022\r\036\032\025 \375\035\205\ns\316\"\360\232^|\217U\325|\311\r\371\316\026\356#F . p\002\221A\304\007\362\320\020\007\234\312\034\\y\253KAk\267nI1\3161F\222Q`\271\007_p\033\002k|\212\202\036\241\340\236qR\277*\356r&\351P\2748m]\216\013\301U8T\260G$v\324&P \200\233\030\fFLX\341\030\213i\322Bi/\364\375\035K"
+	.ascii	"V\001\352H\\d\341\373\266\305\231\205\347N\006\030\n"
+	.text
+	.section	.gnu.lto_frskyOsdInit.32.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`D\005]\035"
+	.string	"\326\364\273J\220\232Q:\032JC\204@ha,\231\006%~\265\326.\266\221H\311\005\274\006\n\350/f!\362\013\325iv\024\325\177\366\325\024\277\223\345\310\022\221H \020\b\024\360\351\277j<\277\311\363\242sQ\332\241\252y\322\310&{'\031\237"
+	.string	"\237"
+	.string	"\256"
+	.string	"\263c\333-\324\377\365\254\277>\212\320\245\202\n\344\255|5\254g\364\225\363\032\341\270-\230\307\275\232\326v\337w'B\177\002\243e9\007\tV\311y\225\320\020\314c\006?P\036\2237P\036wwS\260 \324\350\327&\244?\265\221Ae\314y\245]\246\243/1y-\332\307\275|\360d\226\244!W\227\225\232\343\330\314q\222|\260#\311\325"
+	.ascii	"5%\021\200\231\0025Sc\330K.\340\312\202z\360\366HM\311\006J@"
+	.ascii	"\256\376\273-Rs\326\306pr\316mu\252\215w\354\335\355\323\335"
+	.ascii	"\031\2721Qf\316\351\205>\226\037\036\323\351\370\367\301\343"
+	.ascii	"\254$!\223'C\366h\325-#-\367\362:\250\214\335\213\233Z\362\023"
+	.ascii	"\223\3325\035\300\2229\277Vv\257\350\261\327\305\356\177?\022"
+	.ascii	"\"u\005\373J/\256{\315\331\313\353\376=\036\217\307\276\273\356"
+	.ascii	"\003\337\262K\275cm\333\232\266\217"
+	.string	"\340TNKJO\307\333\265f\244cX\326\302W\236\016\374\245\336\247\362!\213_5YF\013\213n\252\013\273g\375\342W\215\207\020_u\253nq)}\255L\025\227|9\347\331\247\372A\340\315\327K\3021[t\317^t\007F\276F\347\246\351\310\301\320'\002\304F{7\242J\324X\335\301\316\f\324\323\f\033]\362\"\312\004\315\207w\260\243\022\325\344gt\276\274v@\324\311\313\220\031#\233\002\346\240PN\314\351\002S\2542^\353\0276\206{\341\332\212\355\252\242\212\327)/l\r\357\242sC\024\366\206gq\020\320\224s\276\260\345\\:t{\370`\257\373P\036_x\353\3339-\371\212\375\205\210\203\b_\336/\017\035c\300\310\313\353\337J\331U`\304\204C\303uc\373!\312{\021e,\315\037Q\322\336'Q\336\312\177\273K\230\260\327\311.\001\254\314\243O\034k'@\266\363\207TQK\341sb"
+	.string	"\262\235?"
+	.ascii	"zx\200nA N\036\0245\027\263\336\231\200\342v\232\bZq\263\245"
+	.ascii	"\240\2355\232O\355D\017m\307v\243MH\320\347\017\217\215\006t"
+	.ascii	"\2366\332l\035:\231\357\256\377\273I\246W\0048$m\215?x\231S\357"
+	.ascii	"\007p\210\177\264\264\267\3506\316\320\315\2219\347\\^^wW\260"
+	.ascii	"\335\350\016\264\207\275\256\037\374\217\252nh\201}\345\216\226"
+	.ascii	">,\022z\204\213i\242d\367\2075\272\t(\302i\021L\t\210\2451C\006"
+	.ascii	"\221,\3652\206\021b\323\034\005<\233C\231\354\220\305\025\275"
+	.ascii	"\242\210\374\330\206\r\252$\f\313\2141^\250aD%\0254$\"\242@a"
+	.ascii	"\031I\007\340\"\241\262\315\001\020X6\001I\320\270\r\220\245"
+	.ascii	"&\330\345\024\243\324\243\2362\272\2657\370\204\325&\374U\177"
+	.ascii	"\035\350N\333\301:\2010\001m\f\3457D\021j\210\222Y\004\r\331"
+	.ascii	"T\237\205 \201\203d\021\3628\2531\354#\002\207\304\243Q[\241"
+	.ascii	"0\005\\\341\267\301\346{|\235\002\0163\356+/6,\361\256c#>s/\333"
+	.ascii	"\023\362\233\300\221\236\374P%B\333'E\311\303\026\237\032\372"
+	.ascii	"\305\303\037\202L\260\330\251\2627Ek\016\f<\353\233\246]\354"
+	.ascii	"\007\300\236-e\006\006\365\347m,\356OsV\210c\334\247\330\351"
+	.ascii	"L\244W2\254U"
+	.text
+	.section	.gnu.lto_frskyOsdIsReady.33.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"m\007"
+	.string	"\202N45@s\322\001\230\266\317y.4\351\274\211`\214\241GI\257\027\365\220\350\320\255!k\3633:{\234fe\256\204K\201\024\220\243\300I\314\001\254H\177\262\211\224)\005\376x&.\030\021\262\270\254\212\007A\017\003$q\361>\326\365<\007\206\031\024\326\323\200\320z\034mO\255\202\250\"\220\264d\277S]Uo\222)1|\345Z'`w\035|\226\267l\370$w\346\b\345\343]\276\3344\325\035\301\r\252\273\253"
+	.string	"\f)7[\033\245\206\330\247VAl\2475\323\247\006L:\262\307\232\335\323v\2633.\346\304\266\310\346x\241Ad\354\332\310\251"
+	.string	"\245\304\344b\263\253=\0259\366\304\374\253\034\342#n1\033=\001\036v\327\0313\217[o;\301\266\202\355\224\t"
+	.ascii	"2\241u\037x\304D8\254\302vML\031A\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_frskyOsdUpdate.34.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\025\t"
+	.string	"\266\320>: \005)\035\340\030 \b\026X\253\002y\222XL\247y!\rxLX1E\tgB\355\327\357\227\360\b\030D\271\205\032\001\003"
+	.string	"o\203\201\356O\023 -\264\207_7\262\245L)-"
+	.string	"-"
+	.string	"/"
+	.string	"\"7\035j\232|\001\357t\330\361\270\302\204\226\213\214\300K\301\202\231\353\343\257'\313Se\006\200v\327\271\362:n\355\266\027l#\330\226\005v,\225\032b_\277\357\373\254 \366\323\327\006\\\033\336Y2\273\034_\200\235\321`Jl\337c\223m\363\330\310\032\230\240h\264\334\354n\3244,/3u\211suX\251Q%"
+	.string	"\333\030W)uvW\301O9,\303'\271\346\021)\277\272\346\2238\327\256\177\035\302Z1'0T~\001\016}\036\272\215a$\321q\021q\023E\nQ\303D\fq]\374\034x\253\200\340\342\305\266q\321\023C\035\204\322\024\334\335\205\235\264-\272\374\312\252\247\f\016"
+	.ascii	"2\003\352\fO^\330\252\202\200+\200j\037\244\250\210\013\350\020"
+	.ascii	"\216\\\206~\031B\\\272\246\232\246\201)("
+	.text
+	.section	.gnu.lto_frskyOsdBeginTransaction.35.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`}\0015\017"
+	.string	"\326\333dF\360\320&\035P=\325\326\033%\006\307b\233\326\033\333\361\266\335Nfl\323\366\330\323\235\206\rA\272\0137!N\272\255\"r\231Z\347[\360\331\272\370X\034\226\236<\243\344\347\237\260\341\005\207\277\375m\333&[\312\224\002Q"
+	.string	"R"
+	.string	"M"
+	.ascii	"9vw\323\017G=\0245\250\211\362[>0\236\034/\365\320\353#\225\307"
+	.ascii	"z\f\225\304\036 F\307\223\343\261\256yx.0dw[\022\212XWX`\306"
+	.ascii	"\002\207\207\307\002AV\"T\277yZ\360\272\314P\311\356:U^\206["
+	.ascii	"t\333)\333#\366a\001\243\222\214\025\214\367\0133vW_\320\322"
+	.ascii	"\320Z\214\210]\026\"F\303Q\374\245r\227\325\223\231\210\251\331"
+	.ascii	"]\3225[\305&]K\222\355\247\375\232\237@\335\206\202G\273\035"
+	.ascii	"\202tv]#& \272\026r\220x\r\376#^3\312\356\271\213f\005\224\200"
+	.ascii	"\361\222\"3\027\020/\331\013Mgp\236Z!SI\036`v^r\247eE\002\306"
+	.ascii	"T\265#H\310\253\f5u\032\240\231\216Z$^\025\300l\260$\220\177"
+	.ascii	"\221\250z5\320\352\351j\310Z]~\266\253K\235\261\257\337\367}"
+	.ascii	"V\031\3736\277j:5\375\247\024\024\016\272D\262\340\304!\230\340"
+	.ascii	"\340dj\260q&\333\003\223\004'[\311t\332H\006\230Ca`\332R8\316"
+	.ascii	"\264\221\\+\207\25327\027\341l\230\375\314V\264\203\273\273\241"
+	.ascii	"\257\370U\034\300\353\365\344\020;\322?\211\276o\304\217\333"
+	.ascii	"E\364c\034\204\307~\300\007\303O# \220\002\031\303v\"B3\247\200"
+	.ascii	"\245\216\367\226X\266\307\245\312\350~\267\311\261,{\242\211"
+	.ascii	"y\350\303\244\335NX\250\025b\251\035\244\233\210\327\366\201"
+	.ascii	"\0358\212P\270+\321\234$\215m\020\237\246\003\204\212\263\334"
+	.ascii	"\355\t\016\342\r?/o\f\032\303\201\002"
+	.text
+	.section	.gnu.lto_frskyOsdCommitTransaction.36.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`P\002\r\023"
+	.string	"6ayI\320\362&\035R\t\220rv!b\250N\250`]\213\221\266\f\354\342\253%\326_\243\215,\260\331\325\201\2422\315(\364\251\264W\322\032\305$\320\301w\321\212f\220k\2616s\357\rF?\320\032\300\325:\372\021\215\220-eJ\001g"
+	.string	"\\"
+	.string	"h"
+	.string	"\2722\215}\343\266\241iB\304\213\345z\3149Y+t\232\253\300O\256\322\370!c\315U<\007%\212T\323\016\2211&KvH\310~\313\321\017\202O\016\007\2654\362\\J\224\237\247Y\211\f\0216V\343\215\256D\020\004\304\023\031qd\002\247\030\261\037]uF\230\252Je\316i\225\215\036n"
+	.ascii	"\267=c\233\201\255@\001J\031\374\021\377\374\212\321\313b\300"
+	.ascii	"\177\337\037]\346\350\351\031\325l\264g\333`\2724\373"
+	.string	"rn\220\275j\220U\253\244ZJ\365J\265\256\372\001\n\350`3\224\210\246\026\3126wz>f\214oW\302\366}\333o2G\362uH? d\354'\2756s$\207\370\234(\232s\256\376\255\376\0059[\263B5CP\337\322B0E\270k\372\314'W\244\303-~\260\370 \227\346\r\240\\\027\256\306\256\256\334\307f\003v/\340!\250Z]\223\027\261\035L{\r\256\013\025<\260_\316d\341@\324\222X\202B\265\237\365\364x;\305\2011\215\366!\370m\301\321\270\321)\333\255\233\bO\242l\230\347\304\221\2419\247\003\334\003vI\241\360\022W8\204/W\005\226\330b]h\261\300\260\\\\/V\212\001\213\030^\\,\r\242\350b\255l6\337 \253\330,LE@\375\233\204\t{\035\246\251\020\340\322T\034d[~s\353O\341I\324\3150w\022G\\\200\354o_0\352\244~\222H\324_\001}\343"
+	.ascii	"I\356\025\240_cq\321\313\374\332#\360\350\300\223\n4 `\002\231"
+	.ascii	"\252\343\003\342\200\325C\256.y\273W\2446\376u\tu\034\254\237"
+	.ascii	"\230\303\266k\032\027w\351I\226\274\246\307\237\033\253Y\030"
+	.ascii	"\tF\326\361`\023$\254\367$E\334\225\333\331\256\274\r3V\314\366"
+	.ascii	"\350\255\240\230Up4\204\266\344\374\032_@\323\313\236M\314\255"
+	.ascii	"\002\275\204\2031\035d{\320JAr\212\310BB\261\350\350\241\335"
+	.ascii	"0\367\036\205\306]\341\341j^\315\262\360\036"
+	.text
+	.section	.gnu.lto_frskyOsdFlushSendBuffer.37.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\245\t"
+	.string	"\206\221B< \005)\035\340\334&\016\340\320\033$X,i@\244\277S\350\370O\016\344\361\006c\305:\333\377\231&\341\021\261\260\251\313\267|"
+	.string	"\003b\024p\344\255C\235\b\f\035\324\2535B\344N)/"
+	.string	"1"
+	.string	"1"
+	.string	"\032~\323\031\372\207]@\034Q\337\002<\256\233B\331r30\256\266\002V\211x\330\347\306\250\232\263\323\260\273\236\342\330qs\267\375`;\301vM&QSE\354\377\365\362\202\261\266\354O\237\013\315X\034\343?bvY\265"
+	.string	"+\303\271\230\330\276\307\241ms\322\265\006' \032+\263\335\355t$\f\003\245\272\304\271J\250\320\254&\315\266w\262\2040c\203O\301 p\355\356B\354\262\f\237\344\234M\247y\361\234\177\342\234\273vF\2262$&K\315\232\003\006}&@\017\3024\002\277P\347\211\272\nQ\004\251\003}`\3679\260gA\361u\027\236\367u\036r\257-;\240\220"
+	.string	"\312\224\2526\317\264G\244y\321\252(\006\027-\017"
+	.ascii	"3\003\3569\004k\340>,\373\323>\210\242!\006+xa_\202\336f s\031"
+	.ascii	"\372e\b\340\362\305l\207\006\246\240"
+	.text
+	.section	.gnu.lto_frskyOsdReadFontCharacter.38.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\221\002\315\024"
+	.string	"\006\347\212J\260\022R:\342\261\320\026\030\273\316\241\222A"
+	.string	"\322\322\253g3bF\005p \334\321\251\374\245\242c\332\236e\t\364\327\037\321v\240\220\031\363QX\357\007\365\007\375\007-qN\2229\327\016a\347j\33025E\177\023D\b\331;\245s"
+	.string	"o"
+	.string	"y"
+	.ascii	"Kct\243R~\364YRj\337\367!\333\177\t\034\262\273\323\202i\367"
+	.ascii	"d`\005\345\307\326\013\220\037\305\017 ?\3326J\212\315\267\237"
+	.ascii	">;\002@\277\032$\036\273\247\253\206\370\355\243X\351\315\307"
+	.ascii	"}\204\320\273\021%\225\304\353pQDI\342)\211\220\3001\202\305"
+	.ascii	"\243\241u\204\247Al\355\356\205\2476\274\031JAVv\327T\307\313"
+	.ascii	"\271\311\333\236`[\202M\251\0029\304\372z\341E_o\306\214\024"
+	.ascii	"\360G\216\016\355\023Gk\217}qw\327\225\307\376\321\315z\321_"
+	.ascii	"\376\367\213\246\256#5"
+	.string	"\035\251?\342\342\333\335\360\356a\270\273\033^-\324\330$\342G\177\360\324\266\371H\027\232\345\2278\320\366 \255\225;\027\007\304H\347dzP~$\241?\272\265p\347\356H\020:U\276\005\037\335\240\254\347\211l/\252\225\220\004\270Z{|#Y\265\204\303\016\"\035Q5h\250\017\3735\362\205\223\213\343\364l\004Y\t\240\325\352,$\275\235\310']\370r0\245\243\367\n\322\206\265\320\353X5\300\006!\250\036U5\025\347\262\332.WQkJ\021\202S\372\3710\244S\207\303\323H\033\346J4\004Sv\314Q\310\210\370\354\256\212\211\237\220\371?\037\215aF\257\373\350\317\310\217\317\351\321\b\262z}\360\327\005f,\366\022cd\324|\201\325\331\254\305\214\305^,\346\353\005\006\300\260\223\330L\306R\213\231\231\024\\2\030\227\005\230\227\214\013f\316\\'\007,\273\320b\2722\310d\246\213u\356\305\255<O\257"
+	.string	"\004\003\270D\377\364\013_^\0019\001\227\304\377F\326jS\275\222\2533\246\211\273;\021\036\374\253\212\306\332\343\024\026BA\261\362\320\372j\032Q\311\240\231\304\2201"
+	.ascii	"E\253\t\325/G\207\247\273\033. \220\002\241\241\r\036\345BG\b"
+	.ascii	"L\346\303\205\222 (\306\231j\246\272m\353\002\003\327P\217\306"
+	.ascii	"\375&\207\205\354\334\003CV0\316\301X\005n\031\333\\h\221`y\334"
+	.ascii	"@1\f\262zo\312h\335m9\333\352\303Es\262-\002\263g\002j\2521$"
+	.ascii	"\266p\362\333\255\260\373\342\365\233Xh\2670\3601P\256\316\253"
+	.ascii	"E&\267\326\350\001"
+	.text
+	.section	.gnu.lto_frskyOsdWriteFontCharacter.39.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\004\001\255\r"
+	.string	"v\032`F\340\2228\035R\266\305\263:\3620\023p\350\264\252\240\350N\322"
+	.string	"\351\241\356X\212iu\246P\341UP\f\247M\247U\327\242\203\342\301\002\274\376,\2061\306\030{\375LR\353\264\006\347`\326A\242\022#D\233\354\235RJ"
+	.string	"K"
+	.string	"K"
+	.string	"G\001\336\245\343\315\256\312\214\030\273\243\307\013\264W\005\347d\257\330\rd\257\266\335\340\001\350\360#K\352@K\013\005\323cw\334\350\210\207\237\241\377\362\230\t\224\231\032\254\030\325\351S3aw=EU\207\233\336v\307v\004\373\036\002w\371\353\311\237\326\351oJ:R\034TO\201\261\233z\315\254L\225Q\342\253\337\006\375\322\001\374\025\207\001\277\032\371n\330\215\215\226\033\256\335\023\006\257\206\240\275b'\347\220t\274\n\360$\t\202\002\253\341%\004H{\365\250\315i\377D$\007-\321s\273d\232\027\335a\341\220A\321\223O\355\220\227\"\224ewA\027sTz\2521I\341\201\372\361\027\031\276\267xL\347\223\360\313\013\276\370:\377e\257"
+	.string	"Pv\274\260\\\200(\231/{<M*\302>\266\273k\272b\007\334=\020\216~\037\311\033\215D!O\004\302\t0\367\031}]\210$\344\363(l\235i\253`\022\211l\234\367m\237\004\356,\220\274\rC\327y\333\270\307\226\256<\314\006\254R|\360\341*\241&\036\301vU$\270\310\3712\201\251i\235\313L\3364\262\263x\031\023"
+	.ascii	"|#\332k\340n\273P\321\f\323k\215\b\301:Umd\360\026\363\354;\327"
+	.ascii	"\300\250\211\022\\\274*\034\026\210\005\34175\005\356!L\315\201"
+	.ascii	"]S\017"
+	.text
+	.section	.gnu.lto_frskyOsdGetGridRows.40.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\31766@S\323\001\2336`@@\026\234\262\377G\3054\240\025b!\332BA\373:\210\3117\237\243\262\3336\315x\251zvk\222FE#\274\225\263X\325\207A\233\310\235R\366t \260\351\220}\260KBNKNX\017 \351\2710\3319\360\244\210\270\244\305\234\227\334x{%\251r6\315\360U\365\242\032[W\371 \224l\320S\246\301\207+\216\202\021\224vW\341\344\336\205\017\362h\214\f\236{\3643\352\361\032`\262\301\317\366BP;\354O\253$\033B\353\241?\t|0\335G1\273\033\037\315\272D\226\020\333\232\275\361GN\242\271b\320\330\272J\204F\2642\263\353I\316\013\250\307\351\003\324\243z\\;\324\374\227\274\341e$\303u\241C\200\205\3355\344:\216[o;\301ve\273%\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdGetGridCols.41.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\31766@S\323\001\033\214\035"
+	.string	"\301%\257\354\377Qq\033\f\353\202\252!\034>t\032\315\344\233\317Q\331m\233f\274T=\2735I\243\242\021\336\312Y\234\366\177\320&r\247\024\376x \260\351\220\201\260KBNKNX\017!\371\2710\3519\360\244\210\270\244\305\234\227\344|{%\251v6\315\360U\365#\033[g\001!\224\354\320W\246\201\347\212\253`\004\245\335UH\371w\341\213<\032#\203\347\036\375\214z\274\006\240l\360\306\376DPA\354O\253$\033B\353\241?\t|pt\367`v;njV&\272\214\330\326l\216_r\023\315\025\203\306\326U$\033\243\026\232\335Ov^@=N\037\240\0365\344\332\241\346\377\344\r3^\f\327\211\016\001\026v\327\220\353<n\275\355\004\333\225\355\227\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdGetPixelWidth.42.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\31766@S\323\001\033\214U\204\031\223\300T\035\025\267\001v\362\017*\206 Iu\032\315\344\233\317Q\331m\233f\274T\r\320w\273\313\321\b\017\344|N\373?h\023\271S\n\366t \260\351\220}\260KBNKNX\017 \351\2710\3319\360\244\210\270\244\305\234\227\334x{\035\251r6\315\360U\365\242\032[_\371 \310\330\240\253L\003\222+\236\202\021\310\354\256\002\312\275\013\277\364h\214\f\236{\3643\352\361\032p\262\301\317\366BP=\354O\253#\033B\353\241?\t|\224\272\223\276]\216\217fa\242\213\210m\315\336\370$/\321\\1hl]5\262!b\231\331\365$\347\005\324\343\364\001\352QA\256\035j\376M\336\020\023\322\302u\241C\200\205\3355\344\272\216[o;\301ve\373%\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdGetPixelHeight.43.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\317660q\323\001#\002K\357\323p\264\305`B\234\034\324kn\326a@\241\203\316if\003PZ\265\365\377\205\313\207\003'\300\025a\372\037\b\355@\321\302\037\2106\221;\245\366t \262\351\240}2LB\316KN\\\017 \351\3012\3319\360\244\210\300\244\305\234\230\334|{\035\251r8\315\360U\365\242\032_W\371 \230l\320S\246\301\207+\216\222\021\230vW\341\344\337\205\017\362h\f\r\276{\364\265\352\361\032`\302\301\223\375\205\240z\330\247VG6\204\326C\237\022 \261x/\305\354n\234h\366%\266\204\330\336\354\215?r\222\315\026\203\006\347Y\"\035\242\225\231\335Or^P=R\037\250\036\225\364\355p\363_\362\006\230\222L\347\205\016\001\026v\327\260\3638n\275\355\004\333\226m\227\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdSendAsyncBlobCommand.45.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\205\002\245\024"
+	.string	"\266\247\210I\300\322Q:\342\250\245\231\366\004\365\230\\w\037k\305\355'\027F\t\346\"\t\177\211\223\304 \261\362F\240\341\003>\001\325\321\027hn\315no\001\022\200"
+	.string	"\001HP\200\217!3\2226\235\f\224i\323\323GZ$\261\204\310\235Rs"
+	.string	"k"
+	.string	"q"
+	.string	"\337\200#\310(jw\017<\264\203\361!\nh\203E6P\r\224\310PK,\340\220M\211\025\235\366\205\276\302v\237\241NZ\233\201\005\207\024\337MT\017\307\227\250\036zN\033A\002\333{8\326\335\335\016\244]_\212\r\214\017m\263y\234h\330\234\225\240\336N\013\251\335u)\211\333>m\376\177\017\311\351r>E\006\273\353\231\323\365\334z\333\004lS\260\247\217\177\353F\367\310\213~\326\207~\362\276\1775\247GqZ\034\247U\342t(N\203!\323:NOq\372&\254\024<\335M@\355v\230\002\262La\322\211\033\375G\237\366\375\031O\262I\327\216\344\325\007\035*v\227\254\331\344\303\037\306\177&c\\\206\355G5_\334\216=\202\204\242vy \214\017\307\375\332w\361\027\266\033\231\306\267g\003_*E~h\376\303\t\360\243\322\347"
+	.string	"5\324\343v#\n*\311\215w\2435\257SU\355\027l>7\242(,U\375N\020_\251\024\340d\227\377p\0248\355\356\202\207S\237\363\2403\247L\352\367\266\241\272\222M<%\034\320mN\2315I]\351\221\376\263 \362\223\263g/\3639\027x\3221\3414\307\366\335\246\216\260\017\356\356Z}\354\367~\222\023\005\261W\ts\363\232\021idf\264\327\205\032rl)aZ@\031\206\331\203\025M\026{\311\\T\261\030\230\032\246\022\253\225\023n^j\264\n\256r\346\222\231\275b\\0Z\315\2452\300\345\214\214\346\242)K\232\213\364\351\034\\\365\361\370\004\202IGo\256\001wE\260\374\350\377\035@\324\320\234r\311\024CP\324"
+	.string	"\332\365F\365\223\"Hx\322\303\037<RQ$:\2624TQ\225\327\204\333\261\264\245*%C81 \220\002\231A\363\267\340\240\b\370\200F6P(\364\211\f,\b\356\356)\265\316\344\214\317\016D\211\2071\212\356\2041B\021)\343\203\210!\223\0228\202\t'\261\rB\271"
+	.ascii	"\023\262N\313\277\035Sh\354\007C)3\201\032\020\267\333\"%\302"
+	.ascii	"\025\210\215\001,\3442F\b7\\\323=\206\021\004\270\260\313\030"
+	.ascii	"1\034B#\276N<\300s\213\266?\001"
+	.text
+	.section	.gnu.lto_frskyOsdDrawStringInGrid.46.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`P\001=\016"
+	.string	"V\234bD"
+	.string	"\261&\035\360\363\037\206\201U\316\363\017\266\216`\345\335\227\200\346A\0072\226\260\367\365/;\b\032\236\326\re\254u\346#+\n\364s1\377\377\377\327\006\313>\322U\003\005\027\210\304\311\021j\220H\366\2262\245L"
+	.string	"N"
+	.string	"O"
+	.string	"\331?\260\317\025\222=\372i\177\304c\272\313\0340\307.\013\213\233\335\357c\004\331c\201\023\300\036\341?\260Gwv\316?\227\365\300\240H\225\240\261\273\233zx\367\354\374\263\316\341\251N\317\215\006\273\353\364T\031n\275m\003\266\025\330w\005\273\326\026\3735\277\366\357\317.\363\307\230\2061\2550\2350\375"
+	.string	""
+	.string	"B\270T\177\261\331\275\360\252\261\255\230\342\303W\277\375\263\254\371&n\323}e\372\256l\007\b\230\026:\273\030B\036\235 {\364h\316\234\246{M\005\217\200U\241\261\360\371\002\240\274g\270\032\364\344\377\004S\205\372Y\341\200\312\227=RS[\204\222\367TAnpbZ*z\262_\302\354\321\310\206\034\0213Rm.\323|\221\332\271\332\021\316*y\270\354\356\202{2\242^7P/+R;)\371\262\277Sj\007\373p7&#\220\206B\023\034@\323)\334 \021\223\022GbB)\221B\033'\332\036\210JF\033\210T\332D@\314A8!m\0228\216\264i\337\036\256\2668\303!\321JQ\224Mp\227\205\301W\277\316L\276< \241j\252\267\013\354'\316\"\031\201\3419\306\255\002\263K\002\030"
+	.ascii	"2C_\025Xx\224\200w\205\330Ui\020h\200\303\250\030q\306\0323,"
+	.ascii	"\342\032\3432\227\305\231C\273:<\013\326\003dMM$\241%p\016\f"
+	.ascii	"V\240F\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_frskyOsdDrawCharInGrid.47.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\352\001}\020"
+	.string	"v\036jG"
+	.string	"\261&\035\331\013\022\030\364\360\256\253\271\303\275!\245\342Y\270%\360\351\372>\335\376@4\312\236\006\262\203h\253QFG}\260@0h|\264\276\344\252Z\277s(\211L\320&N\223\033\352ct\373d\023\262\311\336)\005R"
+	.string	"U"
+	.string	"Q"
+	.string	"\273\001VRO\003\310\207h\"\r\222z\352K\373\252\223\b_3bnWft\355\212%>PO\013\\\200v\232=D;uh\363\\\004\261\003hf\234X9v\267\233\037\036^\206\376Y\347P\251\227\313M\301\356Z\242R\031\356y\333\006l\243\330\262\024\317^\363\317\333\374\007\371\030q!\365\020:\273\030b;v\207\266\020\361\326o\337?q\227\313q\354\021\023\343+\336\362\307\233\020\274\t{\304\334"
+	.string	"\375\033\037\305S\200W\321\3625m\355\241\231y\355\302\220\234\372\244\236\216P\027\373s\372\217\355\271z\211\3606\025L7\246\371b_DS\325\036\316\305\254\223\253w\216\366Y\347M\260\222\214y\373\352s\323\020dS\233?\301\350|\313>\371(b\224\243l\314I\347\307/\3400\243s\202\221d\314\026Krz\260\237\355\356zv\2607i\256J\327Mz\333\244\265M\232^|) /\302\b\304\262}\020Bst\nw\310$\005\364\032\214T\300\357A\347\211:\t\"\320J\027\372\300\316\204\200=\026\007_7\301\363\276\356#\222\316\372-\324x\261C\232%\267d\2732\t\306\203\274V2f"
+	.ascii	"\222\3360\264\343|\024}\260\310\221\241A\2052\217\357RY\221G"
+	.ascii	"\371\2563\300\001\243\343\025, \240\202\031\272\232\007\" \017"
+	.ascii	"k0\354<\211\245\016\211\301$\341\272\n\254\023\226F\364b\030"
+	.ascii	"(\264\266\013G\004\344\021\002-\240\013\313'\035.\026\316\233"
+	.ascii	"\315*J{#\367D\210\203\331\223e\002\266q\277\030\236\\jG(\217"
+	.ascii	"\360\030\020\315\241\335A\235\361\023\315\3603:\341\242\3470"
+	.ascii	"X\301\215\006_^\264\213\f"
+	.text
+	.section	.gnu.lto_frskyOsdClearScreen.48.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"u\n"
+	.string	"\226\223IB \251*\035"
+	.string	"w 0s p\rP\203\342\323O\002\232~L^\212\037t=y\201\303\004\022\350\bm\325K\021l\220c<\b\211\232\025"
+	.string	"\030H\2571A\231\215\016`\033e\370rX0\332&r\247\0248"
+	.string	"3"
+	.string	"9"
+	.string	"+\261"
+	.string	"Vj\305v\227S\003\007]S\t\362\033\300\320\265\013\200\253F\201\"p\301\001\034i\025\022^\245\253.Q@\222\224\f\232\335\2654\201+\367\274\355\r\333\026\366!\002\026GRS\366\265U\224-\245uvb'\025\360\t\306\335\3238\333\327\214\240\300\366}\326\303\317W\316\0200c\260\273\333\247\375\261\267\317o\006\331\260\213\007\002z\325e\200\2240da\002\005\222\224\371!\306\305?\300\\vW\303op\007&>\202\317\207'\036y\323\247t\335\025,\237\017\217\260|\252>\374\005\330Z\r`A\020\311\321\001\336d<\276\216\303\323\371<\020\256\343p\"\234\216\020n\343}\\f\302\335\310\207\307\225t\235\307m\242\350\212\262F\244#\355\"m\222O\336d\325\320e\005F\227j\312\307X4\016"
+	.ascii	"2\003\3269\304\352\245\202\331\013h\373h\020\276p\367\270&\262"
+	.ascii	"\017A\006\025\342\345\nq\351\232j\232\006\246\240"
+	.text
+	.section	.gnu.lto_frskyOsdSetStrokeColor.49.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"M\013"
+	.string	"v\326PC\020o\234\016\b\251pP"
+	.string	"\035\376&\244\252t\200c\352Su\001\365n\340\312-\214;+\316\031\366\325c\267c"
+	.string	"\264=\337I("
+	.string	"\001"
+	.string	"\240U\376\003b)\315\b,\027\024i\205\t\254~#\332d\357\224\002;"
+	.string	":"
+	.string	"@"
+	.string	"\224\335\220\212\323.Hb\021\354\024\344\034\327\251\365\215\353\324\236\235:\330a=<\254>#^\354n\235\034\356]z\376\303S>\320\346rr\331]\313\017d\341\236\267\035b\273\304\376%\024\306\030\213\242&F\007\177\373\276\210\213v\346\314M\316\300 f\031;;\275\355\371\2413\003\b\340\035\324|=\033\241\305\207\t\252\335\323\310\251+vj\373\322>\351!\274\227$8\257lR\2102\220\276\216\373\304\345\213\035\004\371\317\027?\300E\005\030*\317\334\370\363c!\347\347D\003\b\022\237\025G\2166\330\221s\203}kw\327Sd\277\364KK\372\023\215\025%@\037\215\273\001\332\271M\301\246Qk\026\003\335F \223\240\343\020\324\rS\031`\n,\250\032\327U\313\207\267\006\007\270\372`\333\270\232\201\234[;E\306R\027P\234\331\261\306\332\r\t\b_Q\231\344hL\376Fq\335\364\320A\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetFillColor.50.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"U\013"
+	.string	"f\026QC"
+	.string	"oj:\333\221\312\201\363\002S\006,\250t\007x\254\021d|\352\346aAq\017\037\366\337o\266&~\f\301\313\035\2266\\T\200\nP\325\224\364\001\360\245\264\205W\210\221c\2141F8\240H\233\354\235R;"
+	.string	";"
+	.string	"A"
+	.string	"\224\335\220*\265+\226xD;\ryGv\212\235#;5h\263.v\330\217\321\307#\202\305\356\326\311\341\340%\350\177<%\004i.'\003v\3272\004]\270\347m\213\330\006`\337\022\025^.vEIx\270\370\333\367C\034eo\306\374d\f\f#6\214\275\235\336\006\375\321\233\003\b"
+	.string	"/f\276\235\225\260bD\241\265\233\"9u\325Nm_\332/\035\004x\323\004\007\0174N\230(e(\205\036w\211\314G}\021\344C\037u\002.\013-Z\235\251\361g\250B\316\317\211\006\222\313\363b#_\266\310\221s\203}lw\327Sd\337\364KL\372\223\f\024\037\320I)v\003\334\275nA\307Qs\225\003_W"
+	.string	"\243\340\363\022\324\356R\033\\\f0\250\234\367\325\n\210;\007\b\274\n\241\353\274\272\211\233c;E\326X\037V\233\311q\006\333\rY\306o\264N\362eM\376Ve?}\f\r"
+	.string	"2Ck\025\030\036U!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetStrokeAndFillColor.51.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"5\013"
+	.string	"v\026PA\020O5\035\303\3046\020\245\002jLl7B\037\260]\372\364\377\235\304\370\334\f\325\264`u\007\231\372w;\006@\333\323\302Z\021\b"
+	.string	""
+	.string	"%R\002\274\207\002\2360\251\312G\246\274\232\266\264\311\336)\005;"
+	.string	":"
+	.string	"?"
+	.string	"\221]O\213\323\2568\300\001\262\323\217w`\247\327%\330\251?[uQ\304N@\033:%`\354n\235!\376]~\376\307G\3000s\t\251\354\256%\030j\270\347m\003\260M\300~%\030Z2\026EQ\214\270\370\333\367I\334dk\276\274d\r\016'\264\213\255\235\336\376\374\321\232\013\030\370.b\276\234\265\300\002uX\355\236\004\234\272f\247\266/\355\213>\372N\272\340\227\204+X\036D\340\344N\201\371&\257\202<\350\233\216\340E\206\030+\316\314\370\023t!\347'\344C(\325\231\241\221-[\334\310\t\302\376\265\273\353\371\261O\372\345%}\310F\312D\370\020\213\335\333;\356\001\267Qo\224\005\036\227\340\342\300\353\032T\316R#X\024@\250[\347U\212\2079\t\f\272J\201\343\272\252\211\232_;?\316T#\224fn\214\271v=\007\306s\254J\262\345L\376V\201\275\364qB\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetColorInversion.52.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\035\013"
+	.string	"F\225ND\020\251j:\007\007\373=\020\026\261\bn\360\330\313\300\334O\300\230\310\271\213\340\001\007\006\007D\332a(n#\323n\251\236\265L\336a\023\263\002("
+	.string	""
+	.string	"\246\001\252\2467\023\t\301\242#Q\345217\273wJ\0018"
+	.string	"9"
+	.string	"<"
+	.string	"\366X\210'G8\267\315H\006\273&\205%2\347,\332\264\233\256\345\274\\\253\003\024v\327\253"
+	.string	".\236\212\376\313kF\326\351\024\203\261\273\246#\353\344\256\267\035a\273\302\276'\324\3074@ a\035\206`\267\344fag\234\202\001\217\375\366\375\002?\355\316\245\233f@\221u%\273;w[\364Kw\266c\246\257jEl\257"
+	.string	"\265\335\004\023\347\354\241\324\001\016.7_~\337\020x  \205\034\037n\331\305?AB\372\321?\2371\301\244BMUO~\2150J\240\365\325\301"
+	.string	"l\301\352\002\212\336l3E\353\212}\313\356\256k\313>\371S.\237\203B$0\0242\022e\374\351\200\302O\303\324\021\202\034\336'\362F\242\r\017\357\003\206^\007\302\337G\b\364H\337\007z\235\211\272ek\313\031Z\203\031\252\246l\262\354\252\\\224\337\324Nz\263\206\376\016\016"
+	.string	"2Co\025\030\036\365!\002\347\267\310P\b7f"
+	.ascii	"\202k\"\r\301L\025l\242\206\355\347`p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_frskyOsdSetPixel.53.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`D\001\245\r"
+	.string	"\206\233^D \217\223\016\340\337<\215\001P\325\026OS\201\\\364\314&\342\224\027`\200\365\321Jj\254)\020\307\255\241\255Z\240\303\034\331\341\3315\032\250N\013H\216\214\207\022\255\017P b\305\363\007\202\324\032\331D\312\224\002H"
+	.string	"J"
+	.string	"G"
+	.ascii	"/\034\233C?\355\257\274\204\350,\226q\266{\242\022\263\273\034"
+	.ascii	"'\330\034\036x\001\354\360:\001\354\320\"{u\017\304\032H\tQ\372"
+	.ascii	"^\354\356\246\037."
+	.string	"z\212\374\177\317:\023\311S\323`w\235\235i\303\255\267\215\300\366\002\373\252\336\2579\313\177ai\205\351\204\351kh\254`L'\321\332\325\320\212\261*hB\304Q\277}\337\345)[\363\310[\234\301\001\2056bk\207\377g\3156*\364-\331L\2252\202\265k\302qh\005v\2362\254\210\331\3658\346x\001~\312\363\221\357\374\324\035\2700\201\301*Q\022\253\332\022\376}\334\311TSm\220\303h4\365\245\231\253\035\362\227\013\356\330\361_\005w\016\337\261\270\364\n\200\244\342R\232\031e\313\366H\251\036\354_\273\273V\024\373\247?{\"\240\344\342\204\350\201\241c\270=\035\020@\361A\b\004\304E\330\342g\243\360\361\b\331<\034h\353\330p\024\371\3406\0131r\233\346\215~\255\242x\263j\241\032)\311\241k\367\204\301Q\377\367\001\254S\266, \257\373\004\366\226\177\036\001L)TtX\3516n\031,\026"
+	.ascii	"2Ck\025\270x\224\266\256@@v\200\330I\221\351\223\333\230k)\027"
+	.ascii	"\032\2331Q\325\314\305X\323(\005 \004\347U5pE \005\270\353\240"
+	.ascii	"\260\200ky!L2"
+	.text
+	.section	.gnu.lto_frskyOsdSetPixelToStrokeColor.54.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"]\f"
+	.string	"\206\230UB\020o\234\016\001\341\027\341\034"
+	.string	"r9X7\b\026=R\272\374\3237\251X\310x-\017\304\352\203\205\317\020Rmu\307\020\334\1778\343#P"
+	.string	""
+	.string	"\310'\020\020[\004\345\"\356\202h\230h\032\264\211\334)\005@"
+	.string	"B"
+	.string	"?"
+	.string	"/\361\035e\016KvI*P\354\356\305\b\260O\003\037p}Z\247\\\237\376\354\026\027El\305t\022\215.vW\323\020\377.?\377\343%`\350\271\004\260`w-\301p\303\255\267}\3006\306>\207\237\004"
+	.string	"\311\020\036\343cW\303Jd=f\212\021\327\370\355\373'\236\2623{\337\360\244CG\346\331\331\347?:\3633n\342\273F\347\033Z\t\t\023J\265;\262|\372\202}VT\354\260`\237\276\264\177\n\034\227\237\332(\310\203~\352\fBF/T!\365X\252\335]*\365\242\221\253m\341\343\005'8\b\242z\315>`\204\210F>re\213 \251 \354[\273\273\326\222}\361\277\216\372\325\222\226\226t\234{\307pg0\017\272\255\201'\241\343\"h\233F\233\240q\260\3212\\\247a\bx\343@\340\264\n\333\306i\231\370\271\265Z2\366\021z|\024\344\216\265KR0^\200*C\256<\221z\257\270\276\361qsJ\310B\304\303\t,p\007\024"
+	.string	"2Co\025\030\036\365\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdSetPixelToFillColor.55.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"m\f"
+	.string	"\206\030VB\020Q\234\016A\356p\331\300\007j\f*nLTT\26184\302\271Z\005\322\331\252\316\250\341Z@\334\001\275\367O\361\211e\375\340{\302"
+	.string	"\n"
+	.string	""
+	.string	"\317(\020\262t\037\265C_\357W<\r\332D\356\224\002A"
+	.string	"B"
+	.string	"@"
+	.ascii	"'\361\335\303#\236\354\232P\244\330]\214\021`\237"
+	.string	"\006>\340\372\264.\340\372\364g\307\270(b-\035'F\343\215\335\3254\304\277\313\317\377\370\tX\372\\\002X\260\273\226`I\303\255\267}\300v\306\376\206\247\004\250!Rz\350b7\303*\307\222L\025#\016\362\333\367M<eg\366\036b\n\207\027\231gg\237\377\350\314\377x\211\357 \236\257h'\250\016\021\325.\351\362i\f\366iQ\221\305\005\373\364\245\3750#\227\237\332(\310\203~\352\fl\220p\250D\372\261T\273\273T\352G%W\333\302\307\013Np\220\206\3525\373\020\302\030\225\200\344\312\026CRA\330\267vw\255'\373\342\177\335\343WKZZ\322\001\235{\307pk2\017\272\255\201'\241\343\"h\333F\233\260q\300\3214\\\247e\bx\353@\340\264\n\333\306i\231\b\272\265z2&\243\003\tHC\366X\273&\005\343+\252\017\2712E\352\275\342z\310G\316+3Z\240<\204`\201;\024"
+	.string	"2Co\025\030\036\365\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdSetStrokeWidth.56.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"]\013"
+	.string	"vVQC\020o\225\016\303\234G\253\037\001\b\275\356b\007Q\214\206\202\006\352\212\204vo\t\210\350\003U}\364\251X\027\217"
+	.string	"\2028\240\321G\240"
+	.string	""
+	.string	"\220\017\200WXZ\217\021\f\303\nVR\323H\r\322\310&{\247\024<"
+	.string	":"
+	.string	"@"
+	.string	"\224\335\322\207\326\256X\342\221\355\024\344\034\332i\366\r\355\324\240\255\342\242\206\3558\221\030yp\261\273uf8x\t\372\037O\tI\237\313\311ew-C\022\205{\336v\210m"
+	.string	"\366/\001\022b0\326ECl\270\370\333\367;\234es\356|\345\214\n)\270\216\315\235\336\006\375\321\234\003\b"
+	.string	"/z\276\242\205\320\342T\342\265\333\"9u\335Nm_\332G=\005^%\342\257|N\240\260\200\n?n\021\232\317\372\036\310\207>\353\004`\023^\274D\363\343\317\220\205\234\237\223\013\251\021\243\030 \031\263\305\220\234\030\354g\273\273\236&\373\252_f\322\237h\300\"\220\236\002\261\033\234'\330d4\034j\214%\363u\005:\n>\017A\3554\225\201\306\300\202\212\361\276j\361p\327\340\200W7]\347UN\004=\333i\362\266\202\203\0134C\366d\273\245\001\343+\257\225\214y\223\277Mh_}t\020\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetLineOutlineType.57.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\205\013"
+	.string	"\006\227RA\020O5\035\003\366\215f\007Bf.\200\364(\363\303\357\322\376\332\235\017\360!\201:\356@\330@\241\376{\t\214\216\342\017\203X\005\320\021"
+	.string	"P\322\001j\304\221\312#\323\320\232\324)\256\246\215\032\331;\245>"
+	.string	";"
+	.string	"A"
+	.ascii	"\023\034\331"
+	.string	"\035\275X\355\226\004,`{\006\340\034\3323\354\033\3323\2176\212\227\034\266\243T\"\364\201\305\356vu\303\307\323\321\277\371\b)\352\234B*\273kJ\212,\334\365\266\003\3306`\277\022\247s\227\302\tc[\331\210\016/\177\373\276\207\253l\316\342S\316\270\360\342D\233{v{\364Ms.@\031_r\276\240\225\360*\235p\355\256\006<3e{f\373\324\276\351\247\361\250\332S7#\\\"\302\004\t\203\211\374\270Y\232\257\n7\364\244\257z\202\025\025Z\270@\265\343WR\005\255\257\220\f(\020\241\030\036z\332\345\207V\r\366\261\335]W\222}\324O1\352C4\\\204\020=^F\324`^FD\340a.\0174\233\217\263e\302 \374\024\210\016B\260A\367]:\314e\001\204\316\002\206\335\304\303_\306\003;\315\367\201\035Wz\216m%yK\301jy\352\307\034lwt\300\274\304\225\242\2477\372\233D\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetLineOutlineColor.58.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\205\013"
+	.string	"&\227R?"
+	.string	"Q5\0352\237\2700\231T\032~<"
+	.string	"\320\f\016\035\341\337\333\347\341B\n\250\301\345-v\373\322\206\320cT.;\324)\013P"
+	.string	"\200X\335\31652j;\303\374\230\321\035*:\322&{\247\024?"
+	.string	"<"
+	.string	"A"
+	.ascii	"!\007CvG"
+	.string	"0R\273\342\002'\320N\017|@v\212]@v\352\317^]4\261\004J1B*j\354.7K\374\273\374\374\217\207\200\242\316\345c\262\273\226\240\b\304=o\033\201\355\007\366'\001\242\207\254]\017\257\033\253\242+N\\\374\355\373)\216\2627o~2G\b\327\266\261\267\323\333\237?z3\203\006\337E\316\027\264\033h\224V\255\335\224\202S;\320Nm_\3327\035\305\367w\213\354\247\217\032\036y\341\302$\302\004\032\270Yd>\312\323\310\203>\352\022\\\037l\264@\263\343Op\206\234\237\217\021\241+\324\341\221/[\374\310I\302>\266\273\353I\262\037\376\022\223\376#@G\207]\275T\n\355\352\245F\250`,\227\214\246\0020ER\301\253\0236\027\274\316\002W-\034\306B\001\003G\351<NR\3005C\245\3432\265v\334&z\216\355$Yc\311Py\346\307\034lw\004a|\244u\222/k\362\001\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdClipToRect.59.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\245\001\245\016"
+	.string	"v\\bE\360\2606\035\226Aau\n\246\345\376Jew\263\326\335\311\336!\006\212D\336Duf\327\332{\235}\377*\023\235\226$\216\356$N}\305B7\221\315;{J\356\n\304\005~a\217b\027\243wG\262\267\334)\005M"
+	.string	"M"
+	.string	"K"
+	.string	"(\234\217/\364\270>\375h\337\345/\335a|c\317\356\312K\315\356~X\301\365y\340\004\254O\371\001\326\247;\373\305\277\021[\240\305\206\351\004\215\335\315T\304\273\307\316?x\217wBy\344x\260\273\216\336\311\303\255\267\215\300v\003;B\b\237\177\377u\230\177\312h)\243UFG\031\375\016"
+	.string	"\253\360\364\230\234\335\016\253\235\325\2316$>\363\333\367U<\2641\217N\343\317\007\0256\262\261\317\0374\346\243x\212\3563'\337\224\365\224h\331I\355\252x|\232\301\365\271\300\222q\221\005\341#\314P\251\221JQ\024K\265+\234\005H\245\252-\272\r\311\301\222\217jT[{\315\245QoR]\355\f_a\342\020\233;\270\301!\237\367bL\275b\245\230\026&\025)\256\354\257\0245\204}\271\273ke\261/\363\203\216\372\003\333-\334\344\243s\270C \0238M\302\210\204\333(d\232(\273 \022)\311B\033\227\201\030\260\206ad\3134h\332\226a\037\351r\225\305\027\214\033:$-\371D\356\2568"
+	.string	"/ \205\212+wD\353\306\261NsP$\200\211\034\031 \\\274\004\367\215\345\207\241\221x\317\017\037"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdClearRect.60.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\245\001\225\016"
+	.string	"f\334aE\020\221\223\016\300'A\211\b\032,\272"
+	.string	"\272Y\377#\0365$\350\272\263\253\227\b#\025\300S\fD\257\315\"jl\b\f\361p@r\215\373\016P\004@\341(\225\3177\376B2-G\212v#\033\251do\271S\nM"
+	.string	"L"
+	.string	"K"
+	.string	"\251\032!\336\f\bv\351C\373\250\267\340\016c\033wv[P4\273\033b\005\330%\202\027\270.\343\t\\\227\346\354\034\367R\254\201\027\017&\027;vw*\212s\207\234\377\357\235\356\244r\b"
+	.string	"\302\356\032v\247\020\267\336v\002\333\016l\030!\367\334\373\261\303\3742B\307\b\255\021\032F\350\177\0040\361\341t\225\214]\020\255\036{#kV\\\365\333\367g\276\2623\217.c\317\210ldg\227\377\347\314\177q\030\334U)\337\225\355\260x\351X\273, \227n\200]2\270bp\314_]\202\016\026\036\254\025UqT\333\302g|4\252\332\241\327\230\374;\361\250B\265\265\323`\n\365\246\234\253\255\3411P<b\213\376q\360\310\345;\034\251\327\254\244\242a\312!\301\226\355\225\240\236\260\037ww\255.\366c\376\317S\017\333/\034\345\243w\270A\"\024D\332\204\221\211h\2530\265\320\304\020\"9\231\240M4E\016X\313P\262\315\r\232\266\315\314#=\256\272\030\303\021qC\322\222S\342n\313\203\357\003X)\330\362\007\274n\033\327e\376\221\b(qC\005\tT\267\340\266\271\374\025\250\004\276s\037"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.ascii	"\302$E\246Onc\256\345\\h\302\326\"\2105B\263D\334r\020\22709"
+	.ascii	"\2009\220\031\030\004\310\003\216\001L\200<\340\230\203B\r\256"
+	.ascii	"\345\2050\311"
+	.text
+	.section	.gnu.lto_frskyOsdResetDrawingState.61.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"e\007"
+	.string	"2\016470\217\222\016D\341\233\233IHfO\251n\201>\314\2177\276\336\214\022_\365\371\036\241\375|0l\3061\316\031\377\006\022\006\271\b.\274\261I0\250\252\007k\373\204\310\024o4\r\234\266\320\201\340\266\207\250q\242\004\207!\"n6.j\n\326&\034\266H\241i[\314T\240f\022\236.\252\001'\032%\326\n\004C_\357V`w\027\f\241\257`7\325\261x\025\335T\025^J\254\325\005\374\274*\364 \3077\223\360\364p\003!\215LEie\222Z1\311r\251|\374\275%MyJ\362\300F\212Hff\275\336\363Y\257fw\337R\225G\022\214\2140L`23\302\216v}\335-\252\002\"\323\247\017 !3\177\"SF\207\375\r\376\203?$\t"
+	.ascii	"2\241w/\260\341\002t\r\307\036\342\r*\372\345^p\351\026\355|"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_frskyOsdDrawCharacter.62.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\177\001U\017"
+	.string	"\206\236iG\360\3166\035\323\013\214[\343\223\036%l\235\032w\366R\374`\177\236h\302U\314\017\265\353\252\006\332\233\236\177\006\231\034\034\206R?\276_\255s\322qX\234\212\347o\001\2449\226&\272\304\"\2479os\023\273\333\336)\005Q"
+	.string	"X"
+	.string	"P"
+	.string	"#\217\262S\221\274F\025q8\262S_\332\207\271\b\3601\3261h\227\245\306\265\273##\310N\r\234@=\305\256QO\r\332-.~\330\215\227\r\252\022=\273\273M\227\203\227\240\377\361\240pur\t\340\301\356Z\206+\r\367\274\355\003\266\033\330r#U\372\031\031.,Vg\251\330\315\360\023cwh\016\210\333\374\366}\023o\331\232I~\343\220\nN\210\335\325Hl\355\364\037\255\3715g\201\267)\371\242lh\345\205\303k7\205\343\324\245\3544A]\300"
+	.string	"<\315\351\242M\241\300\240@\346$\300\317\230\230\356\256\254p\355\212\001/R`\274P\346\211C\323\236\360\361\224M\333\364\321\304%\220\212\2346\310s\352\224\363*\237O;\344\256\317%\273\373h\301\245\323\207<s~\016H\261\\\250|P\362\307\026Srz\260\217\355\356z\266\330\247\371C\237\371\263\213\177}\314?\253\264\f\234\207\374FD:\314\243\300\315\323/\334\034\311\343\353\"\234@>O\302\326\231\266\n\246\216\220\215\363\276\215T\300\235\310\207\267\215t\235\267i\"\352\330\316\026g<#vP3\345\022l\227\305\301x\001/\031\371c\221\254\367\211\372\233\217\035\001V)z:\300\204\244[\247\372-\356C>\364[\207\020\032"
+	.ascii	"2Ck\025\030\036U\273\005^\371\n\232\031\326\251H 0I\221\351\223"
+	.ascii	"\333\230k5\027\232 l+\215\021q\346\320.b.\224A$\320qQ\242\306"
+	.ascii	"\022\256\004\207\201,\034\324\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_frskyOsdDrawCharacterMask.63.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\357\001\035\021"
+	.string	"V\341sI\340\3206\035\352\007\226\024\f\274+\3650\026\342\003\017\340\023\001mW\200N\211\241\370\331\022\303\264,\"W\351\217\344\243u8\350\316\312h\313A\021\256\207\030f\250\037L6\364w\003\320"
+	.string	"h$8`\305H\255\233\355\266wJ\001["
+	.string	"a"
+	.string	"Z"
+	.ascii	":.\256\273 p\314vI\224Q\334\253i\376D\"\207F\270W\177\332\277"
+	.ascii	"\271\212\3618\016riW\306g\266\273(\033\340^\t\\\204\364\252\375"
+	.ascii	"Dz\365h\3378Ib\005\330\224x\261\320\261\273\036\035\361\361s"
+	.ascii	"\364_\276\004\213\275|n\017v\327\023\026\363p\323\333.`\273\201"
+	.ascii	"=[\001\333q~\215\233\246\333\364\334\246\037\002\200\306D\354"
+	.ascii	"=0v;\034\361X\242\nt\342>\277}\337\305gvg\361?\376\220\t\241"
+	.ascii	"\330\335N\264\273\327\277t\347\367\274\305x\237\226/\314~\324"
+	.ascii	"\330\320\024\355\306\214\274\232\001\367\272`C\220`<\317"
+	.string	"\352\246u\325H\241\200\356\2604\323r\b!;\220\363\025\343\003E0\364\305\224\332\024^\256\234\002\241\264\243v\311e\254J\3246y\f\027\247J\262I\355\357BA\033\235\364\257\036\2476\312_hp\312\266p \225S)/U\234z=\314H\243\247'W\317\214W\217\326<\262I\327\244\"\354k\273\273\2463\366w~\220\363\374\335u\376\322\311?\337\311\024YV@-\0041\200_\r/|\224\365\r\367Gr\"\202%\254\0241\254\340\201*/\203\312D\305\373B\321#\031`p\005%\364X@0\364:\262um\351\2149\243!\242\026u\271E\333\225qP>\244(g\036Ydn\367\020\351?/#\004\240a\243\346\303\r\314\273\203H\376L\302\204y\230?;\204\0341;\002\" \200\002\022\272\253\003rh\235\201\021\242:$\003\367I\201\230~\336,,\336\364\350zq\326\314\356\214\032\350\021 \2149h"
+	.ascii	"\243\235\030$\314\331\202H\341\275\347b\006\001-Ax\264\354\244"
+	.ascii	"D\220!P\250\261\350J\016+\013\207\232\002\271\274h)\031"
+	.text
+	.section	.gnu.lto_frskyOsdDrawString.64.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\201\001\035\017"
+	.string	"\006^gE"
+	.string	"\257(\035\025\210\024\242\016Zgv\277y\2179YH\215\331\002 "
+	.string	"\021\332\237\320\256\251\307\340\032\320\330\320B\341D\367\"\213m\253\006L\375\377\377\235\331\246\326w\266\b5Iq.6\007C\003Ad\023)S\nP"
+	.string	"Q"
+	.string	"T"
+	.ascii	"a\310\241\220;h\013K|p\217~\332\217\271\314\367\031\347Xc\367"
+	.ascii	"E\006gwC>\300=\026\270\200\355Q;h{\364g\273x\b\263\003Z\254\224"
+	.ascii	"\210\027\273\333)\210\177\317\317\277\353\032\240\n\365\314x"
+	.ascii	"\260\273NP\305\341\326\3336`\273\201\235\004\002\366k"
+	.string	"\376\317m~\317\303\237\373\314\037\267\264\266\2455\2463\246\017\240\203\325B\365\327\210]\r3\030\013\213'X\277\371\355\337\345\r\3337)_\226\365\304\264Z;\273\033>\036\255\300\t\026|\2679Yw]d]\322<\304\367\032\f\017\260\273b\201\263\033\037\331T5\r\261\270\254\344\314\035\371Q\273dB\036T\365\320\211\305\200eP\224=j\217\356:}\034\264\250h\265\244\332&7\301i\256H\311\2566\351/\013\034\266wW\205\017\314\3562x<\030\213z\315\360\360B\221\222\251\344\314\016Q\251\037\354k\273\273\326U$$\221\232PN<\315\364\323/\334\"\020\022\223'r21\225$t\336\250\2430\032!u\242\222\251\003\361\260wRR\352P<\257\324m\204{mue.6\203\251\350\212S\264\335\227\220\035\232\234\031\224\232~T\273Sl'q\027\204\020\035\020\301\235\263\331\021D\362\240\265\355\240(?\033"
+	.ascii	"3C_\215\241hC\035\331ha}\303,\341\036\2606\340AU\f\243\342|\271"
+	.ascii	"5\246\335\3065\346gwO\030\n]C\230\341&Ps\020\314\022\342:\r\261"
+	.ascii	"\204\213\3009\220\231\203\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_frskyOsdDrawStringMask.65.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\335\001\325\020"
+	.string	"6\241rG\360\320&\035zfi\325?\271f\316w-\021e::Pp\314\227\262q.\277{\202.\256%\312\256\216\r\004\0316\220\262\351\232\241\242uqP7\221\215-\357*f\243\365}\343\255\006\025c\333n\321\210%\233\310\235R["
+	.string	"^"
+	.string	"_"
+	.string	"\340w:<d\367\246\bhWL9%r\027\331D\032#\334\247/\355\253\370\n\3609\016ri\267\306\007hwSV\300}\036\270\200\355S\273\310\366i\320\276q\021g\t\304|dZ\344\330\335NK\034\274\004\375\313^\ng^\227$\t\273k\031\316\200\270\365\266\021\330\206`\313\r\001\376\316\217:\317\177z\317o\272\370\227\236\363o\234\364\344\2445\222\264n\322r\223~"
+	.string	""
+	.ascii	")\306\231\2173v=\314t\254\320\224a\342\343o\3772\233|\027\377"
+	.ascii	"\001?\266|c\326\303F\354\307h\367\303\310\247\035p\237\t&\203"
+	.ascii	"\022\360=.\007Y\330P\254Dy\\\032\310\302\330\210\350\244\316"
+	.ascii	"Y\004\0266M\247\246bF\300\344\314!\022\245\266\311\211|\250\251"
+	.ascii	"\001\240\243\023B0\372\262\252\255:\251\252\307\32083\251\235"
+	.ascii	"r\231\313\307\003\032\242\030\215T\033\303c\224T\026\311\354"
+	.ascii	"\270\332\253\303\370N\266\312e\254\017\234\335m\360\371\020\307"
+	.ascii	"\246W\222\315H$\263\343E\316l\361%\225\204}mw\327z\343(,\225"
+	.ascii	"~,+\236\326\3622x\252\371\335u\016\267\212\004\345\363L\\*_\353"
+	.ascii	"B\347\255:\r\253\023V\247j}\035I\001{+)\255\216\305\363Z\235"
+	.ascii	"I\334k\2537\346\216P\b\275(\314-\332nM\204\217\277\221\216\234"
+	.ascii	"y\200\234\212\322y\327\330\376\342\262\t\347\301\t\027\334A\233"
+	.ascii	"M\241\202|hmC\350\313\177! \240\202\231\311\252\003ch<bHNFq "
+	.ascii	"\2055\224U\216\030\271p\257\265\341A\215a4\316\367\255\261v-"
+	.ascii	"\323\0304]\026\315\321\356U\027\006\213\004\316-0\324\022A#\213"
+	.ascii	"k1\330%\356\362E\23733\007\030\r\177y\321\n2"
+	.text
+	.section	.gnu.lto_frskyOsdMoveToPoint.66.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"]\f"
+	.string	"v\230UA\020Q\234\016Q>\233Ni(\250\310C\345\335W\374\023\t\230\032\356\n\025p\203\325JE\244\036\254\372\200\336\373\247\370\304\262~\360=a"
+	.string	"\005"
+	.string	"\200g\0240\266 \245\302\241\377\331&J\2366\221;\245A"
+	.string	"B"
+	.string	"?"
+	.ascii	"G\001\036e\017KvI\250\025\273kq\202\354"
+	.string	"\363\300\013`\237\327\t`\237\006\355\030\027I,\305\344\"4\322\330\335MG\034\274\004\375\217\227\204\243\316%\200\006\273k\031\216:\334z\333\bl_\354{\b\237\0048\261a\364\025\310.\207\226\310~L\026%\276\361\333\367U\\ek\376\316\341\311\007\020\355\263\265\317\177\264\346\247\236\002\374\006\347\013Z\211\t\323\013\326\256\250\362iK\366IQqU\311>}i\377\024\036\230\257\342,\310\207\276\352\016BD5X \355X\252\355a*\365\241\221\253\215\341c\006/x(C\365\252\205X\205\204F<\262e\213\037\251\"\354_\273\273\326\222}\361\307\216\372\365\222\226\227t\233\177\327pc.\021<\356\301G\301\353&l\\f\253\220\201\240\3310\235\267]\f\230\333H\350\266\013\034\327m\232\350\371\265Zr6\243\343\303\243\037s\256]\022\203\361\003X)\331\362D\352\335\002;\307G\215\200\016\030\" N\241\202;\024"
+	.string	"2Ck\025\030\036U\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeLineToPoint.67.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"m\f"
+	.string	"\206\030VB\020Q\234\016A\336\303\267q\213r\275r:^\324\375\025\213\205\326\330Y}7\335\303\265\312\370\367\023\363\032\350\275\177\212O,\353\007\337\023\006P"
+	.string	""
+	.string	"xFV!K\367\021\r\372\272\353\342i\320&r\247\024A"
+	.string	"B"
+	.string	"@"
+	.string	"'\001~\303!\236\354\232>P\354.\306\007\262\317\002\037\200}^\027\200}\032\264]\\\f\261\226\024\213\3218cw7\005q\360\022\364?~\022\226>\227"
+	.string	"\026\354\256eX\322p\353m\033\260\235\261\277!\247\004\030\361Q:\310\212\335\f\255\032;2S\210x\307o\337?\361\225\255\371\273\207)\034bh\237\255}\376\2435\237\343&\300wx\276\242\235\240R-X\273\244\313\2471\331\247EE\221K\366\351K\373\252!\230\277\342(\310\207\376\352\fd\220h\260D\372\261T\333\303T\352G%W\333\302\307\013N\360\360\205\352U\363"
+	.string	"B2*\001\311\226-\206\244~\260\177\355\356ZO\366\305\037\373\306\257\227\264\274\244\003\235\177\307pk2\017<\256\301'\301\353\"l\334f\233\260q\300\3314\235\267e\b\230\353@\350\266\n\034\327m\232\b\372\265zr\006C\305\bHC\366\\\273&\005\343+,\016\3312E\352-\202\335\343#\347\225\022$\250\016\252\020\301\035\024"
+	.string	"2Co\025\030\036\365\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeTriangle.68.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`J\002\215\020"
+	.string	"\266\336kG\340\262(\035SbP\025xp\350\037\021\273\303}\004\363\225\252_}\216\345HktH\016\022-\322\303!\333\260\217\346\373i\215\315x\211\006\214h\2141\3066>\320\366(o\t\235\203\325\032\377\036\377\331,\331{\313\224\002W"
+	.string	"S"
+	.string	"V"
+	.ascii	"\245\375p\002\204\203\233\036\223\214\307\027\263\261 \364\351"
+	.ascii	"\253\375\232\263X\335\3067{\2732/l\273\313\300\tB\237\007>\240"
+	.ascii	"\373\224\027\320}ze\373xL\305\026\240\341q\271\340\331\335/\246"
+	.ascii	"\370\352\272\362O\273\367\202\275\\A\023v\327\372\202\215\270"
+	.ascii	"\343m#\260\035\301V\035\001#\217\375\242\333\374 \251\356\244"
+	.ascii	"zJ\265\224\352(\325*\325'@j\021\002\366ZmW\304\017\221\305\315"
+	.ascii	"\235\025\317\371\355\373\265\333\354\221\303\353XT\242\310(\264"
+	.ascii	"G\237?\315#\037\306c\254\236\343\362\205Y\017G3$\267\033\243"
+	.ascii	"\340\323\020f\336\214\304\003\034\337d\267\235\202\220\230\236"
+	.ascii	"\034L|q\227\203$v\363\306J)NY\203\024e\234\3012\022\243F\033"
+	.ascii	"\274\fQ\324x\227\317\243\315\341;\036\214b\247N\353`\224\317"
+	.ascii	"\277\200\200\342#\251U\243\341\362a\351\217\035kiDa_\356\356"
+	.ascii	":\316\330\237\375$\307\371K\277\371I\227\375\001-?\t\365D\245"
+	.ascii	"\246PM*5\t\325D\245N)\271\220\002+\204+)\024\206\017<}\032N\026"
+	.ascii	"X\276\024T\352+1`p\203\n\352k\001A\3247\212\261.7\3168\024\244"
+	.ascii	"\007\307\212-\273\310]\031\t\264\007\310\311\324\273qt\3279M"
+	.ascii	"\005\300\217\035=L\324\354\356_\r\356[\347\3332\234\364/\007"
+	.ascii	"0 0\003\221\031;3\241u\304\220,\241\020%tl\030\360\270|\260\345"
+	.ascii	"\274+\314%\310\351\273\207\340\203-'\357\036\302^\242\034\361"
+	.ascii	"\232\024d:s\033c\355\353B\343!&\004\230\371o#\3426PL\320\256"
+	.ascii	"\330\205x\216\305\004y\260+\231\023\330\221\214\223\330I\206"
+	.ascii	"N8h,\340-/\004F\006"
+	.text
+	.section	.gnu.lto_frskyOsdFillTriangle.69.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`J\002u\020"
+	.string	"\266\036kF\340\222*\035\243\177hJ\300\220<\3663\341\025\226g\336\201\322\264\t\030\232\3071\227"
+	.string	"\204\262\225|\37524\232\303\374>Xs0\270\365E\b7\3140G\027\210\216\361(m\016*B\263qv\373\212\266F\366\3362\245W"
+	.string	"R"
+	.string	"U"
+	.ascii	"#^\032\320\354Jd9H1\234\017f[\340\371\364\325\276\314U\244>c"
+	.ascii	"\234?\2731+n\273\313\300\t<\237\007>\300\373\224\027\340}:e\343"
+	.ascii	"8\314\304\026@\221\303b\321cw\277X\342\251k\312\177\355\237\226"
+	.ascii	"\253\345\332\211\260\273\326\226"
+	.string	"\353\303\035o\033\201\355\007\266\342\004 \207\375\240\317\374\035\251\366\244zJ\265\224\352(\325*\325' \262As\335\266\333}\331\375\330\334\2649q\332o\337\267\375f\207\034\276\306\240\020\262Ph\207>\377\232C\276\213\277H\235\306\362u\331O.\205\007\335.\214\202O;\230}f\306\311\321v\b\277]\002\017\030\037:\227\330b\257FH\364\346\214\224Q\234\362F\024e\224\241\002\022\243F\033|\fP\324xV\316\243\255\3416\034lb\237^\333`\223\317\267tt\342\243hu\323\202\225\243\322\235\r[i$a_\356\356:\276\354\317\376\220\323\374\243\313~\321c\177+'\t\225\004\245\244PI(\035\tu\004\245>\021\251p\002'\204)'\223\205\017,}\030J\024T\276\023\323\351\0231`0\003\212\351[\001A\323\027\202\251.7\276\354\331\001\"\247\212+\263\310\335\030\b\265\007\320\305\364s\323\360^\363\032\n"
+	.ascii	"\0307^\"dv\367\255\222\033\347\371\267\013%}\313\0010 0\003\221"
+	.ascii	"\031;3\241u\304\220,\241\020%tl\030\360\270|\260\345\274+\314"
+	.ascii	"%\310\351\273\207\340\203-'\357\036\302^\242\034\361\232\024"
+	.ascii	"d:s\033c\355\353B\343!&\004\230\371o#\3426PL\320\256\330\005"
+	.ascii	"\361\260+\031'\260+\231\023\330\221\214\223\330I\206N8h,\340"
+	.ascii	"-/\004F\006"
+	.text
+	.section	.gnu.lto_frskyOsdFillStrokeTriangle.70.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`K\002}\020"
+	.string	"\306^kG\340\262(\035\243\333\324\232B\033\331\246D\344\340B8/\200\277\002=\240\236\261^`\n\003E\236\032\r\207l\303>\232\357\24756\343%\0320\2421\306\030\333\370X\235\003\274%t\016V\353\370J\350\177kd\357-S\nV"
+	.string	"T"
+	.string	"U"
+	.ascii	"\245\345 \242\303\202\232\037&\332\roF#\001\350\323W\373\262"
+	.ascii	"\243`\235\3067\207vcB\333\356*\360\001\320g\201\007\350>\345"
+	.ascii	"\001t\237f\3318>+\261\003f\\^*x\354\256\027I\234ue\371\017\037"
+	.ascii	"\202\305X\256\037\b\273k\205\305@\334\361\266\r\330v`k. \237"
+	.ascii	"\375\242\323\374\037\251\356\244zJ\265\224\352(\325*\325\027"
+	.ascii	"@\252\341\022;.\307\356\207\036\037\233\2339&~\363\333\367]\334"
+	.ascii	"f\217\f\036\307\"\230\025#\320\036}\376\241G>\213\267`\375f\345"
+	.ascii	"\333\262\241\334\214\007\235\335\027\004\237nP\013\325`\030\330"
+	.ascii	"\370&\003\267=\302\316K\017\235\226\310\342n\206H\354f\f\224"
+	.ascii	"R\234\022G\2122\302H\001\211Q\243\375\375\205(j\374\213\347\321"
+	.ascii	"\316\360\234\r>\331\252\207\032|\372<L\307'>\222\\\270\235\027"
+	.ascii	"OK{\354\231K\343\b\373rw\327Q\306~\355\027\271\315_z\315O:\355"
+	.ascii	"\017*/\001\265d\245&PM+%\001\225d\2456\031\241\240\372$\200("
+	.ascii	"\252T\005\357Cy\027P\023R<\223\224\312\033!\340\017\303I\312"
+	.ascii	"S\371\276\2247\232\265.7\312\030\264\343D\256\025]^\221\2731"
+	.ascii	"\017\302\207\350\3204t\313\350\216\363\360\344!)l\310B\310v\367"
+	.ascii	"\260\323}\353|\233\005\224\036\3460 0\003\221\031;3\241w\304"
+	.ascii	"\240,\241\022%\264p\030\360\270|\260\345\274+\314%\310\351\273"
+	.ascii	"\207\340\203-'\357\036\302^\242\034\361\232\024d:s\033c\355\353"
+	.ascii	"B\343!&\004\230\371o#\3426PL\320\256\330\205x\216\305\004y\260"
+	.ascii	"+\231\023\330\221\214\223\330I\206N8h,\340-/\004F\006"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeRect.71.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\245\001\245\016"
+	.string	"v\\bE\360\2606\035\3330\370\312\225M*\037\237\256T+\003\300\340\267`\025\027\206\224\005Z\034\274\326\336\353\354\373W\231\350\264$qt'q\352+\026\272\211l\336Y\247HL\347\275D\307\340j\300|\277\355\311\336r\247\024M"
+	.string	"M"
+	.string	"K"
+	.string	")\234\217/\364\270>\375h\337\345\250\356/\266\261gw\005E\263\273\037Vp}\"x\001\353S\236\200\365\351\316\226\361\317\304\032h\001aRqcw3-\361\356\261\363\017\336\343\235P\036\001@\330]G\357\364\341\326\333N`\273\201\035#\004\237\177\377\365\227\177\312h)\243UFG\031\375\216"
+	.string	":\341\3517/v=\254rl\316\2549\361\230\337\276\337\342\241\215yt\031\177D\314`#\033\373\374Ac\376\212\263\350\036s\362MY\017\212\226\020\252]\025\217O3\270>\027X00\262\341%\330P\301\241JQ\024K\265-\334\005H\245\252-z\r\311\301\222\217jT[;\315\245Qo\332\271\332\032>c\342\020\233;\310\301!\237\367fL\275b\245\033\035\323\016)\256\354\257\024\225\204}\271\273ke\261\017\363\203\236\372\003\333/\334\344\243w\270C \0248m\302\210\204\333*d\232(\303 \022)\311B\033\227\201\034\260\226ad\3136h\332\226a\037\351r\225\305W\rT\016IK>\221\273+\017\300\017P\245\342\312\035\321\272q\254\313\034\024\021\220\"\006\215\021.\236\203\333\306\362\303\320H\274\347\007\037"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdFillRect.72.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\245\001\245\016"
+	.string	"\266\334bE"
+	.string	"\261&\035\320\226|{\205U\325\236"
+	.string	";\177\354S\"\277Eb\316\345{\344W\206\241\372\354g\270\240\272i4\2423\037`0\006\334?\323U\257\252\326\212\373:5\034:9!4\242\177DS\213T\262\267\334)\005M"
+	.string	"N"
+	.string	"K"
+	.string	"\032\252\006\004L}`\237~\264\377\362\024\336a\274rg\227\3454\263\273 V\200}\"x\201\353S\236\300\365i\317\266q\320e\r\234\\J*pvWS\022\367\036=\377\341;\237)\345\021"
+	.string	"\204\335u\374L n\275\355\004\266\033\3301B\340\217\035\346\2372Z\312h\225\321QF\337#"
+	.string	"\r\017\246\333\274\330\375\320\332\2617\223\346\304e~\373~\213\253\354\314\242\247\354\t\261\302\331\335Ldg\237\177\350\314_q\026\336eP\276*\333Aq*\301\332]\371\3704\003\354s\301\0253#\227\220cE\007KES,\325\266p\030\037\225\252v\3504%\017M<\252Q\355\3553\230F})\347jk\270\213\023\213\330\335C\016\026\371\374wc\3525#\331\304(\345\214b\313\006IQG\330\227\273\273\326\026\3731\377\347\250\337\363\334/\374\344\242w\270A!\024\272m\202\250\244\343*h[H\303\020\0321\321@\\\247\205\034\360\226\201\204\3236l\033\247e\340\350r\265\305\030\216\232\233\221\222\214\"wY\036\204\037\300B\305\226=\342u\313\270\236z8\"\300T\303\204\210\227\317\301\275\272|\025\210$\376\363U\001\036"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\025]h\202\260-4F\304\231C\273\204q\001\342\001\307"
+	.ascii	"&@\036p\f`\002\344\001\307\034\024jp-/\204I\006"
+	.text
+	.section	.gnu.lto_frskyOsdFillStrokeRect.73.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\246\001\245\016"
+	.string	"\206\\bE"
+	.string	"\261&\035\320\207}\232S\353Zo\346\226\037t\204bp\303\341oZ\207\315\353\340"
+	.string	"\n{\n\027Tk\026\215\350\314#\036\306\200\373g\272\352U\325\372\007\002\312\311\276_O\b\215\322\033\320\324\"\225\354-wJ\001M"
+	.string	"M"
+	.string	"K"
+	.string	")\030 ^\213\017\354\322\207\366]~\202\373\213m\334\331]\371hv\027\304\b\260K\003\037p]\306\013\270.\315\331\253{\"\226@\313\210\023\212\033\273;5\304\271C\316\377\367N\207\"\035\002p\260\273\206\035\252\303\255\267}\300\366\002\033>\b\236{?\366\227_F\350\030\2415B\303\b\375\216"
+	.string	"+\025\352.Z\273\034Z9\026G\326\220\270\314o\337Wq\225\235y\364\031{<\274\310Fvv\371\177\316\374\024\217\341.\203\362M\331N\211\026\023\254]\225\217K+\300.\023\\0\253\031\252C\260\241\202\203\225\242$G\265)\234\305G\243\252\035zM\311?\023\217*T[;\r\246P\177\312\271\332\030\276\342\304\"\266\350\237\006\213\\\276\233!\365\232\231nbN9%\330\262=\023T\020\366\343\356\256\225\305>\314\377y\352\017\333+\374\344\243o\270A!\022DZ\204Q\211h\2330\265\320\264\020\0321\231\240M4C\nX\273@\262\315\f\232\266\315\314+=\256\262\030\253A\003\247\244&\243\304\335\225\006\337=X)\330r\007\274\356\233\3533\377F\356A\222\021\343\203K\307\340\266\271|\025\210\004\276\363\003\037"
+	.string	"2Co\025\030\036\365\225\025X\021D@"
+	.string	"u\340m \b0\003\020&)2}r\033sm\347B\0236\023A\230\021\032#\342\314\241]\302\270"
+	.string	"\361\200c"
+	.ascii	"\023 \0178\0060\001\362\200c\016\n5\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeEllipseInRect.74.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\246\001\225\016"
+	.string	"\206\334aE"
+	.string	"\261&\035\340\363@\274R\3762T\345\203\376\347#\316\342\206\330\213\377\033\336\n\355\240\262\247!\\P\3354\032\321\231\0170\030\003\356\237\351\252WU\353\037\"\032'\034:9!4Jo@S\213T\262\267\334)\005M"
+	.string	"M"
+	.string	"J"
+	.string	"\250\027\036 \213\016\354\323\217\366M7\341\375\344\031svU`bv\327\303\b\260O\003\037p}\312\013\270>\355\3311\016\216X\002,&\322\211\031\273\253\251\210{\217\236\377\360\234\257t\362\b\300\301\356:~%\017\267\336\366\001\333\013\354\370 \235\203?\366\323?e\264\224\321*\243\243\214\376F\200\032\016\245\253d\354vh\331,\315\224!q\227\337\276\257\342);s\350/\356|h\221\205\354\354\363\017\235\371(\236\302\273\213\311\027e9%XN\253\335\224\216O+\300>\023\\-5\264\251C`\245\320X\241\350\211\245\332\024\276\302\243R\325\006]f\344!IG5\252\275=\006\323\250'\335\\m\f\207)1\210\335=\324`\220\317\1775S\257\331H\305\"\335\210b\313\006GQC\330\227\273\273\326\025\373-\277\347\250?\334+\274\344\241o\270?\037\022\272-Bh\244\343&h\033H\263"
+	.string	"\n!\321>\\\247}\024\360vA\204\3232l\033\247e\240\350ru\305\030\253D#\322\221M\344\256J\203\360\034+Tly#^\267\352\372\313\303\220s\270\200a\003\302\3641\270g.?\365\021\211\377\374\037"
+	.string	"3Co\215\201mC\275\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdFillEllipseInRect.75.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\246\001\245\016"
+	.string	"\206\\bE"
+	.string	"\2576\035\223m\252\236\205\222\271\302\220!\342$p\361\215f\001\264G\302\257a\366\344riY\254\242\334\252\034a\361\234\312\005\270}F\313U\277\364\353h\035P"
+	.string	"\027\302\2442M\302YX\214\336\035\311\336r\247\024M"
+	.string	"M"
+	.string	"K"
+	.string	"\250\027\036_M\307\365\351G\373.'\321\375\3054\366\354\256\2042\273\353\341\003\327g\201\013\260>\345\003X\237\356l\234\177 v@K\312dB\306\356f\372\341\335c\347\037\274\307;\235<j4\330]G\357\304\341\326\3336`[\201\035\035\004\237\177\377\365\227\177\312h)\243UFG\031\375\r"
+	.string	"1\302\323mX\354nX\315\330\2339\023\3421\277}?\305C\033\363\350)\177TZ`#\033\373\374Ac\376\211\243\350\036c\362EY\217\210\226P\265\233\322\361\351\004\327'\002\013F'\013\341\037\344\244\350\250P\364\304R\355\t_\001R\251j\213>3r\220\344\243\032\325\326.si\324\233v\256\366\205\253(1\210\315\035\314`\220\317{0\246^\261\222\215\013\323\016)\256\354\257\024\325\203}\271\273ke\261\017\363\203\216\372\003\333)\274\344\243k\270C\037\0218\r\302h\204\333$d\232(\253 \n!\311B\033\227}\020\260fAd\3130h\332\226a\037\351r\225\305W\216\312\rIK6\221\273+\f\300s\250Pq\345\215h\3355\326S\007C\316Q\002gD\007\027o\301Mc\371aH$\336\363\003\037"
+	.string	"3Co\215\201mC\275\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdFillStrokeEllipseInRect.76.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\246\001\245\016"
+	.string	"\206\\bE"
+	.string	"\261&\035\320\316\360\366\036\371\024L\017\037\324\324L\234\305\r\211%3=\350\r\376I*\236\206pAu\323hDg\036\3610\006\334?\323U\257\252\326\177!4N\366\375zBh\212\317"
+	.string	"R+\211do\271S\nM"
+	.string	"M"
+	.string	"K"
+	.string	")\236\020O\006\bv\351C\3730?\301=\3067\376\354\266\340\324\354n\210\017`\227\005.\340\272\214\377\270.\315\331;\367D\354\200\027\030'\024<\273;5\304\271C\316\377\367O\207R9\344h\260\273\206\035\252\303\255\267m\300\266\002\033:\b\240{?\366\230_F\350\030\2415B\303\b}\017"
+	.string	"\254\r\250\347\264\330\345\320\272\261:\322f\304g~\373\376\212\253\354\314\244\323\030\344\201FF\262\263\313\377s\346\247\270\n\3563)\337\225\375\220x\301Y\355\262\200\\:\001v\211\340\222i\315\252?`\261\330X\255\250\212\243\332\023\356\242C\243\252-\272\215\311\277\023\220*T[{\r\246P\177\352\271\332\027\316\002\305#\366\350_\006\217\\\276\253!\365\232\231r^\234zJ\260e{&\250 \354\307\335]\253\213}\231\277\343\251?\333)\034\345\244k\270C\"\021F\032\004\222\311h\22305\321\254 \"9\231\241m4E\bX\263P\262M\f\232\266\315\314+=\256\272\030c\231\320)\251\311)q\267\205\301\367"
+	.string	"\253\024l\331\003^w\214\3534\377H\376Qbg\306\007\230n\301}s\371\252P\t|\347\007\037"
+	.string	"3Co\215\201mC\275\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdCtmReset.77.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"]\007"
+	.string	"B\31636@\215\222\016\274\201\276L<\202\311j\201\365\236\200L\237\255\271\262\243\325\200yy\370\177}`\323\261\345~I)X\377\214#\272\354\274#\373\355\352\322\316j\333'D\246c.\f\234\246\260y\3406\207\250ebDf\001\"b6.^\n\326$\032\2668\241i[\314R\236Z\022\222\256\251\001 '\021k\345\201\237\257w5\330\375\004;\244\213`\027\265\241x\005]T\023RD\254U\005\354|\352\363\240\306\327\222\220\364P\243\n]\214:\322\312\f\265V\262\344Ru\374\275\247\2428\365x \003\245\224\231Y\257\347|\326\253\331\335\2334\305\221\004&\022\213\017\225\314\214p\243]_wk\252"
+	.string	"h\324\351\003@\310\314\037h\204\321a\177\203\377\340/\005\t"
+	.ascii	"2\241y/\360\341\002t\r\307\036\342\r*\372\345^p\351\026\355|"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_frskyOsdCtmSet.78.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\334\001u\017"
+	.string	"&\034eG\340\2626\035R\342\206\260\367\263\007\252\243\27791{\312B\324SP\024\b\"\210\214A<\200?l\332\353\177\333\260\017\3434w4\370\241\001 \210s\030C8\035\264\367\210L7\201\202P\367F\025j\277\365\247M\366N)L"
+	.string	"R"
+	.string	"P"
+	.string	"6:R5\242\275\372\323>\352'\306\317x\345\317.\214\023kwGl@{%p\001\331+\366"
+	.ascii	"\331\253G;\307\311\021\033:\335\340\200\242\307\356rT\304\307"
+	.ascii	"\317\321\177\371O\311\324\362\351q\260\273\236%\023\314Mo\273"
+	.ascii	"\200m\b\366L\t\307>\363O\221\220"
+	.string	"\0379\246\317\240\261\353\362\332Y\234\312\242\304o~\373\376\352,{\263\350*\203b|\230\330\335Mdo\257\177\351\315Oq\025\343oX\2760\253\345\234p\264v_\016\274\372\201\366z2dC\202A\215W\230\310v \271,\240\331A\220\n\342\266CG\215\017\250\222W\334.2\237\265\242a\276\344\263\036\301\365\242\323\332@[\f\022\243\202P\332\013\232\321\026\023\363>\223\332\356^ze\005\tbx\350x\030\315\227M\222&\ra\037\333\3355\225\261o\363\203\274\346\007\235\346\327\236\372\263\223\017\"\312J\005\223\f\231W\362\321\256\344\243\236\367\321\316\373\250\327}\264\353>\352\023\222\t\"(ADA\fS8P\205\263\240b\362q'\241\310\221\f0x\001%\3440\200`\310m\344\350\330R\031k.\027\316\210\222\314\202\355\202hP\036@+5_\366\314\320-#\273\352e+ \020\203\221\232\270\0013\2415\306"
+	.ascii	"%\241|\3301\2321\262+\3071\026W\236\001\346^\246!x\206\273\006"
+	.ascii	"\266\034\261\272p\356\201UG\200\365\016\316~\242\360a\376\024"
+	.ascii	"d\206\367^q\216\346df\020\344\301\216d\234\300\216d\234\300\216"
+	.ascii	"d\352\204\003b\201\267\274\020\006\031"
+	.text
+	.section	.gnu.lto_frskyOsdCtmTranslate.79.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"%\f"
+	.string	"VWS>"
+	.string	"3\324t\\c\247"
+	.string	"v\331\251\034\t 7\356\314\226\304\320w\322kb\333\001\004Z\275l\266&h$d?\207~\240\323\024(\001"
+	.string	"\320A\273\036\032\311\362\ba\373?q@A\215\354\235R@"
+	.string	">"
+	.string	"B"
+	.string	"$\247\034\331\2751\203\306\3566\260\202\355\031\202\027\320\236a'\240=sh\353\370\330b\r\210~\214 y\354n\245,\036~\206\376\311GD\217\346\023Baw=E\317\347\246\267\235\3006\004\373!\002\236\343p\355\226(},+S\275\270\351\267\357\3138\312\346\f\376d"
+	.string	" \016\264\271g?i\316.=FxS\346\373\331wr\210\312\326ng\3013\327q\033W\f\266g\376\264?:\214\360\001'\277"
+	.string	"5v\270"
+	.string	"\215D\253n\033\232\217\302|\230\027}\324+\270:\257\226\b\2521\366 2\251m\007'\235\262\204\b(\312\327\211\315,\355\2213\351\n\373\330\356\256i\310\376\370c'\375s\023\240\202D_\005\243a\342A\003/\023\304e\232\"\271\360u\026\300\f\237\207\241v\226\312\3012\331P)\336W%\007\334u\250x\365\322u^\345\306\315\261\245!o=L\2606\224\343\f\266\233b\002\371\001\255\322,\r\231\333\275\322~\n\025"
+	.ascii	"2Ck\025\030\036\325\216\005NiE\006Aj\316\005\347\035\202k\342"
+	.ascii	"d\307\206\260\2150V\0026\2402\201vMp\001\342\001\307\034\024"
+	.ascii	"jp-/\204I\006"
+	.text
+	.section	.gnu.lto_frskyOsdCtmScale.80.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"\035\f"
+	.string	"\346WT>\0203p:\230\277\005\254\024A~\314\222N\243>\370\365\307>#\013ME\300H\364\301E}\336\"\276]\020\206\004\372\363\300\017\002\021"
+	.string	"@\031a\217\375e\002\022\204\222\244\324\277\221\b\331;\245@"
+	.string	"?"
+	.string	"D"
+	.string	"\336GFY\262\233#\254\261\273\r\254"
+	.string	"\273\205\340\005\256[\325\t\\\267\354\331=.\256X\003a\t\022#\220\335\2554t\357\323\363?^\362\201\232\317\b\205\335\365\374@\317Mo;\201m\b\366E\004\337Q\356\232(\207l\312\262\321\342\245\337\276/\343';sw\223\001|h\270\330\335\254\263\263[\377\350\314&=\206\367R\346\353\331wx\204'\310\335\316\202[\256\"&\242\030`\267\374i_\3640\246\217\\"
+	.string	"\320\007\371\021}\276q\343\270\374\023\006\304\374\347\237^\341G'\b9\202j\\=\220Lj\333\301G\243,!\302g\306\013\024\233Y\332\"gR\025\366\253\335]S\220}\361\257>\372'& \304\002\f\234\005\243\201\362\341\352\270\031\202\233\256L.p\232\205.\003\267a\250\332\245r\270P6\324\312\306\325\311\001k\035,[\365\240i[\315\304\315\253\245 cB`\2446\224\343L\265\233b\302K\377\370\001$i\226\216L\354\326q=\023"
+	.ascii	"2Ck\025\270x\224\224Vd\020\244\346\\p\336\201\270&\016\021\006"
+	.ascii	"a\242\004b@\025\002\367\232\220\003\230\003\2319\250\321\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_frskyOsdCtmRotate.81.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\365\b"
+	.string	"\226\321?90q\323\001\200\306\0252\232\247[c?\224C\037\233\314_\245\020\317\320_`\262K(n\366m\355h\235\005\326\217\277\013NF\004\203\001\356u\252y\210:F\030\2767\331;\245-"
+	.string	"/"
+	.string	"0"
+	.string	"\247\330\013\262S{\366\314G\222=P\201p\240\334\354n\235#\367.=\377\342=\037H\272\004p\330]\313\017\374\270\347m+\330f\260-\023\273\036;:\373\242.&\376\311Y\243\217\026@\265\264S{dk\247\327l_\332O]\345}e\026{v_V-\273\247\006/\004\234&\334 \013\037/ze \244&D\245v\367\237[\267+\363Y\032\"\371\317g\375\301\346\204C\2631I\366h\222S\304>\266\273\353\031\332\223\240D\005|LJ\334\r\372Ht\033\204\250\242\343(\352\026\252\027\241\b\213\n\342\272\372A\360\2061\301\325\214m\343\2526\226\216\355\f}\361\357\310q\275J\323d*\261\033&\013\n"
+	.ascii	"2C7\0258\340\302\221\313\220\246\342\005\215\215\205H\315\352"
+	.ascii	"\n\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_frskyOsdContextPush.82.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\007"
+	.string	"B\016470\217\222\016D\341[\333L\026X\221:a\231y\006\330mr\"\r+\203\203n\341\377\375\351m\364\214c\2343\376\r$\fr\021\\Z\332,\030T\325\203\265}Bd\nk2\f\234\246\300y\3406\207\250mb\304f\001\"j6.f\n\326$\032\2668\241i[\314R\237b\022\222\256\251\001$*V\213\365\201\240\257w)\260\373\n;\245\253\260\213\342X\274\206.\252\t,\032-\326\005\364|\n\364`\307\027\223\220\364\260\342D\2241\252\312*S\364\342\222(WI\310\337{*\252S\221\0078LJ\231\231\365\372\316g\275\232\335\375JS\037Ip\002\301\030i\311\314\b=\332\365u\267\246\n\204F\236>"
+	.string	"\204\314\374\205F\033\035\3667\370\017\376R\t"
+	.ascii	"2\241y/\360\341\002t\r\307\036\342\r*\372\345^p\351\026\355|"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_frskyOsdContextPop.83.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\007"
+	.string	"\002\21637@o\222\016x\r\200&\301\231\256\3516\351\364\333NX\367\006\331\237\020;\225R`\377o~:\234\255(BV\352\270\207E\201p\215\251\216\b\2449\213\006\352f\t\221)o4\f[\246\320y\3304\207\230qb\004g\001\"n\264-j\n\316$\032\2648\221eZ\304:P3\tK\327\324\200\222T\367\242\002\301\320\326\273\024\327\275\345Z\245\237\\\027\325\261x\025]T\023\\4^T\027\360\363]\350\301\216o&a\351a\305j\224A\352J*s\024\003\223)\226\t\310\337{*\312\323\221\0078P\260Z\357y\254V\261\271gi\367\221\004'\021\f\222UfF\350Q\256\217\2735U@D\372\364\001 d\346OD\332\350\260\277\301\177\360\207\004\n"
+	.ascii	"2\241y/\360\341\002t\r\307\036\342\005\025\306\251\310\227{\301"
+	.ascii	"\245[\264\363\t"
+	.text
+	.section	.gnu.lto_frskyOsdFlushSendBuffer.part.0.101.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`^\005e "
+	.string	"\006\272\310J\240\024R:\024\027l\323\005S\232\f\372+Ql\0162|\372\f\235uj\214h\227\332C\321|cU\351(\264\330s\252)\201\2748)g\2037\364~\214\2273E8\001\367\013Dc*\300w\002\306\221x\265\377\033!D\356\224\002\263"
+	.string	"\255"
+	.string	"\257"
+	.ascii	"\025\030\241v\223\n\310@\"/\022\364)#gZ\030k\220\3264\354\202"
+	.ascii	"\252\271\351\006\265\2333\037p\336,\037\340\034\362(\352G\001"
+	.ascii	"\3318\334M!\266\201\200A\366\225\033\211"
+	.string	"\265@qxd\244K\255Uwsm\270,K\337\370\322x\3236\350\266\032\3554\313\245\267 ?\352\013\204aDc\307\240\320m\nj(\t_+iEI;>\005\270T\342\230%\275\376eDi7\0373~\326f\334,a\304\212C\231`Q\tA\230%v\256S\030A\"ZR$\0372\276\347z\371C\210\234\032;\006e\234\002\370\215f\241\326\352\017\ro\334mg\331\276`\233\030\002v\017\005=\222\217\365\307\250*v\225%\213V\210\356\223\367v\034\242Y\322\353d\237\324\271\222Z\306\244\216)\251ap'\365\255\244\266\335\353\256\321N\352\263\2446\277u\227\247\272\327\244\246%\365\021\224E\250\034S\255Ig^*\r\323\213\307\217\277\325O\365o\375^>\222//\032#\rTqG\262Vc\315\215\317\362\271\214\333\322\252ZF\276*\325\277 \026s$k\2559\037r)\337\310\257\216e\334\321\017$"
+	.ascii	"\375\310/\tXk\327\003\tA?\362+\353\022\205\"\261G\255]\023\254"
+	.ascii	"\252~<#\004\254\372y5\252\177\341T\274\221\254\001k\265\244("
+	.ascii	"x\232\353d\\\223\245\255\211\203\326\274\\\030\273\373-Sa-\250"
+	.ascii	"\231\367T\230%F,\035\274\\\332\022h\032B1b\":\367]\307\342\251"
+	.ascii	"\315\230{\356\255\254\370\325\257Vk\3051\367\\7\223\b\225\004"
+	.ascii	"\361\032\242g\336_JS\025 \273O\266\005\320\362vr>\353W\034r\210"
+	.ascii	"Ht\355\016\036\350\221vg\214V\310_\272\213<\372\342\017\017\373"
+	.ascii	"Q \332 \376dgCVk\275qr0\035_\307M\217\340\321#\361\316\233\337"
+	.ascii	"'\205\310 R\376\357\374\361fP\213\006"
+	.string	"\023T\226!z\346\0335\221#\177\026\243t\271Q\0067\362\364y\316<\036\335\371v\353\323\331\331Q\021\342\324a\301\323@\"\305\210\036\035\0237\357lD\370\364>\374J\370\370vt=\236\256\207\007\202G\267\363\371\350l\f\270wB\307\247K\321\353\371t\364\353d\373w!V\026eh\211l?V\277\262\326\0329\311\"L\276\345w\200L\313.G\314B\223\242E\226\333#/\263\271\375\321\227\037/\263\307\002+[\032\242g\265}r\356x\342\32643\035\263\265\2458\246\300`6f\237\374\335\020k\2557Xv\016\256\300\354\315\r\251\262\326Zi\373d\373\2479k\213\333\004DC.\267}\022\333\336zN\345w*2[\303\3116T \216\355\"\210\331\366_\317\240$\\R\026n\250Q@\243\024S\246D\202\031\221Y\3404\006\200\002\031#\253:\021P\275\204j$\251\266\003\234\205\264\311\274\023\223\tA"
+	.string	"T]\0046\250\304\216c\241#\330\001\364)A\021\351#b\253n3\025\261\205\005\264\004\357\004b\245Y\271\346\321C\314m1\220\373\240\222F,\304"
+	.ascii	"n`\2053\322\032\306\257<a\275\310\347^\255\217|\2471/\356\317"
+	.ascii	"\324Sc\032\327\231\326NJ*\260\355_\232\2162U\224\215\323\360"
+	.ascii	"m\002\302\350\316\024\213\024\233\td\245\001\237\rgN'\217EP\331"
+	.ascii	"\016\t#\360^\214^`\007\231\231\341[\273\314\275|\271\031Q\035"
+	.ascii	"p\006\027\201\022\344\r\354\317\275\356\244\230\200r\222YK\344"
+	.ascii	"\362\340QS@7\024M\265\fx\017IhNz\211\273y\247\273\026\020N;\220"
+	.ascii	"\341\325q\246B\266\031&\003\337\037"
+	.text
+	.section	.gnu.lto_frskyOsdClearScreen.part.0.111.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"M\n"
+	.string	"\266QB<\020\005+\035\240\301\345$\244\016Gb\203\002z^\327\035!\234\024\345!\212\274\360B\363\352\253\273e\216\032\030Da\373\257\b"
+	.string	""
+	.string	""
+	.string	"\204P\304^~\223\n\343\332\212\325v\b!{\247\0240"
+	.string	"/"
+	.string	"4"
+	.string	"\365\265\005\260Z\007\315\266\273\364\335,\371\351Sr'_\252X\250\317\327\023\300\244fZX\037\227\003\347\002B\273k\016\310\335\335v\203m\004\373\013\001\240\321\244\327\327\352#*\232\230m\267\322\337g\371l\274\314\f\255\033\312\350\257\274\226.s\247\005\240$}\025\223\375}\357\236b\333\344\341\223]{~\0253\344U~}'\346F\206c\242\344tyr\347v\222\330\223\203\335\004BvW\001n+\322\271\234\320\374\001\231L:@\315Llb\266\335\250\n\266\375\t\026y D\320a\234\020C\t\n\216h\305\350\201\202\212B\221z\f\fZD\204\024\003\004C\372\331\226\017i\314\324\234.\333\034\351_x\276k\274\204\373\305\013\032"
+	.ascii	"0BE\200\204\t$T\221\002\310\003#\\1t-X\302\304\211N<\340\213"
+	.ascii	"\002\002\003b\340\236P\333%X\354lw\246\360\242n\350\264e3o\247"
+	.ascii	"\005\340\332C\n\013\315\226\236P\306"
+	.text
+	.section	.gnu.lto_frskyOsdUpdate.part.0.129.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\225\002\205\024"
+	.string	"\346#\201I\260\324Q:X\264\265l:\203\337\343\211sx\021\006\360mZ\365k\370\357[\236\034H\376\234\325,\250\253eee\273,\323\237\271;X\317\002\375|\350_\331\333\323-\375\rK)D\265b\212\203\314\361\314\225\266\021B\266L)j"
+	.string	"j"
+	.string	"k"
+	.string	"v\253u\361.l\373\200\360\217m\344\273\333\"X\321\202\350)\270\273\344\305i\342?_\215b8\225\365\343\007(c_\215\370xR\022\205)\273\333*\207T\fQh*f'\245P\350"
+	.string	"H\003\311yC\032\352\254\024\361\031\266\b\005\221N\312\240P"
+	.ascii	"\025\021\220\347\256E%\220j\201\263V0\273\353\313j7\200\333\226"
+	.ascii	"\331n`\253\217:\227<Y\017w*"
+	.string	"\331,u\310R\317\225ZG\365\007h\355\005i\227V\265dmb\r&\030<<\240\314\342\342\343\235\224\330\356F{\257\350\207\013n\320\356\201m\263\270\300\274\363\335\215\026\201\t\020\027\334\335\221\276\377t\037\317u\236\245O)\t\307c7\275\327s'/h\262%\341v\367\273\363`\327\231\245\026\004\326\243~\316'Pw\221\361\"\201\243\214\027u\276w1D-*\311o>\334\335\rQ\324\306\220\001j\352\310B~:\333\234K\026\0373~\326\214X\22482E$H\251|\2375\374\027\303\340\346\263\314g\314\034\030\262\273/1.\203\306Oq\32156\372\231\315x\361\363\276+\216\311\226\224\323\311\264\312-\265qr\3643?\367\337~TI\001\315X\246Y\331\240\343\222\201\341\350\2748\220\256\033\262\303\315L\016I\363\322!W\024\330\345\241\346E~p\271^d\313\266~*\031F6\201V\022\214|$\244\222"
+	.string	"'\n\247\0279\306\271\344p\316\371&\275\036<O\370\016\n/:\302\351rB\227@}^\005\013\372\331\234?\262\375F\005\374\211*\243\316\363n@\tU\254\327r\033\217Ra\355.\004\377\306q\\xO\003; P\002A\352\3166\350\020\216K_\350\020#\374\336-\225\222=\007K\360\360+1v\266\330\034y\357\262J"
+	.ascii	"\201\324^i[S\241\317R\020\255\311\0233\2628\322\340O\341\004"
+	.ascii	"\224\222@\032\344!v\341M\333\267&\317\245\361\036PXmlP\366\266"
+	.ascii	"\256\201\341\244N\001YXIk\233h\021\037\215\375\006\341\226\232"
+	.ascii	"%\362\261I\003\226{\353dc\213\005\342\024\001ZS\266\033 loD\350"
+	.ascii	"\2335X\347\312v\320h\034\273\202\023"
+	.text
+	.section	.gnu.lto_frskyOsdBeginTransaction.part.0.136.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`J\002\305\022"
+	.string	"\366awH\360\356&\035@\207\246\233\347\236\033o\275\233\017\213\007\005\034{;.P?:=\213\037\375\370/\002\214)\362F\0052\206\035\037?\377\221G\306\211_\344\036\214\3055\324\223|n\003\361\227v\351\r\3427oh\223\275wJ\001`"
+	.string	"c"
+	.string	"a"
+	.string	"\234\013\234\316\205\374\243\236\243\027P\317\331\027a\233\005s\313~\361PgAxP\314\370,\355nwnvx\353\034\235\262\266|\020%\3279\331\345\353\313pz\242K\233\240Y\013\240\017\303'50\022\301"
+	.ascii	"\360\305\320\017\032\017\257\213\227\026>\030)=^3\026\354\256"
+	.ascii	"O\032\356\214\333N\331\356l\271\0231\023'2\313kNP\223\024\002"
+	.ascii	"H\034b]h\305!\256p]0\377\304\203Z\027Z\371\312\254\306\021\217"
+	.ascii	"\212q\0276r\316$\247s Sf\263\330?\377\331\001m^\342>-\237y~?"
+	.ascii	" \300\330\356\266P_\306\262Q(K\371\220\365\036\027\032\356\007"
+	.ascii	"\263\224\366G\234D\353=.\326\330\275\211Q\333\r\017<r\336)\352"
+	.ascii	"k\027)\274\203\005m\t\214\275<"
+	.string	"n[\365m%&\362/\337v\007J0\246Qf\272\274qr\362S\252\355]L1\202\213'\360\321\222\300X\322\213\274\311\231\343YOww=q\354*-\037\376\337\240<H\001\300]\232[\214\345\300\025}\370\320o\337V\363\374hKFEnp\264\002\f(_\251\240x\324)\222\b+\357A\213\311J5\241\363J\272\n%\020N\272\224j\325\221\f\260\207\"A\325\251x\236\252C\235\356\304\221\375D\33302\215/\023\206[\241\2737\n\304w\2142\312!\375T\365\215TG\214\214\346\257\3234\326\346\314\261-R\345T\315\\\304\310&\313\213\324O9/\236\301\354\302m\246\006F\336\314\0216 p\002\221UU\007<\022\003\326\200\343\f\00711\016.\310>\242W\324\266\004\2373k\306\375\323!\rr!\363\333\325\302j/\226<>b.\212ApJ\271\013\3157c\030\216\210\3772\240\304\336\204P\n"
+	.ascii	"\306m\256\377\231 \206\377\336\220i\360\336\221\357B4/\t\202"
+	.ascii	"\375jl*\361\374\211c\323I\237\331\013,\347\205\313\n\345\275"
+	.ascii	"\016\217v\004\206o\372{\257\rc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`Q\n\r\036"
+	.string	"\306o\252>`,i8q\0013\272HIq\035\254|\347\020>\222\221\354\271\322\343\353\314\232Epu\030\337~j\022\355\037\363\305w\\]u\235\254*\030'\332\266\341\035\204\250\017\304-m\267\335iK\031\242"
+	.string	"\225"
+	.string	"\222"
+	.string	"\355\301Hw(\322\034\2104\326\256\257\206\364\006!\255!Hg"
+	.string	"\322\030~\364\005\037m\241GW\340\321V;\232\202\216\226\220\243#\340h\b7\372\201\215vP\243\033\360\035Dw\022\321h\0063Z'\243\027\304h\024F+ \325\224\317\361ES\271h&\323\242YKj\220%\037\213\226Z\321Q*:W\226\242\017\240\350-\373\361x<\236\350)\262L\3234\315\352*\322D\027\240JU\225W\242w\022\211\211D\023 \277\313\274\324\n\300lw\315TU\323=\273\275+\226\206\261|\306M#\332"
+	.ascii	"\271\273\347\213\344\371\267\200\310g\375\310\023)r\231\376\331"
+	.ascii	"Gm\235<^0Ml\330,\327>\213\017T\024F\315\256\3732\275\220\310"
+	.ascii	"\364\036\032\323\213HLo\2420\275\214x\275\215\300\364:R{\037"
+	.ascii	"i\365*\342\264w\021\247i\272;\325\275C\376\322k\310Ko\241.\275"
+	.ascii	"\204\270\364\n\267\364\016\322\322+\226\245W\020\226\336\260"
+	.ascii	"+\275`Vz\277\252\364\006\242\322\033\234\322\013\224\322\353"
+	.ascii	"\025\245\267\013J\357\357I/ '\275k\223^.&\275\177\226\264\b%"
+	.ascii	"\035\"I\203@\322\037\216\004\307\263\002\027\231\270\323~\300"
+	.ascii	"3'\366&\223\355\274\244K\353\327\236\347\342\002\317\363\312"
+	.ascii	"6Iu\302~~W\236Go\347Y\345%\023\372\211c\273\355\355\246Z\263"
+	.ascii	"}@\221\r\030\032\033\256W\355P+\277M\030\245\262v\250\036s\320"
+	.ascii	"M\033Z\355(\355\246\312W\221\312\362\334<\367\230}FL\302\322"
+	.ascii	"\274\216\277@\3634\265\234\335\334\342\255\256\331u^\263\233"
+	.ascii	"+\333\350\364\201\363\362h\211\256\337\3541\217\315\271\244\207"
+	.ascii	"\374iD\362?\211\344o\3768\001\032a\244\345\n\213\2128\032\342"
+	.ascii	"(\210\017\337y\350p\224\003\326\325\006\r\031nb\270`\341\264"
+	.ascii	"\nVg\n7\327\252\233\274\252\t\023nJ8G8\n\341\346\203\233=\007"
+	.ascii	"\r\030\350\316\275rA\211\236\211\n\250\246\022H}\307l\224s\f"
+	.ascii	"\322\020\334$\226Q7\325Y\356\374\225;\253\005\316\275\223\300"
+	.ascii	"w\037\300f\300\214q.\300\216\226\217\254\024p&\342Y\201\3032"
+	.ascii	"\300wN\001\276cr\354'\210\f\007\340\267\225wR\2455b\314\2473"
+	.ascii	"\217I5\3043\303\r>\005z\372\316\351\274:\341p\347\342\002q\001"
+	.ascii	"\200\241\250A(#\212&\")IR\311p\360\002\231!\252\016\021P\024"
+	.ascii	"\005\231c\204\020\tD$\220,\351\330\252j\307\0066%\215_\005`\267"
+	.ascii	"\002pj\026\267N\301\213\306\353\310\300\231\215.\261\237\357"
+	.ascii	":\206u\211\020$\360\036\327\265'5-\216\351\320\264S\226\216\322"
+	.ascii	"7,\030\366\340\320\311+;\360\261\2278cu\320\347H\305\372\211"
+	.ascii	"\345\271\352{\301\273-\324[s\264\037\275B\275\250B4o\350\357"
+	.ascii	"DB\311\003\217\360V\224\013`UW\370\3076:\241\272pzY\321\335\n"
+	.ascii	"q\243%\323\223S,\241\277$:_\036\352Mm\312\257\006\375\247\372"
+	.ascii	"S\361[\375\251j@\245X&\0058J\"\b0@\002P\007M\317%\211{Iz\016"
+	.ascii	"\232\236\036\037b!1>\212\327\202\343\265Qdo\024\257\005\307\253"
+	.ascii	"\273\307)7\246\027\334=LN\336wWv\327\275\006\n\020?\330\242O"
+	.ascii	"\231\202\221&5<\302\235\030\246\357\252\211x\304\247?Jr\240`"
+	.ascii	"\330\315\357w\205\376\r\2618\254\n"
+	.text
+	.section	.gnu.lto_.refs.1a39f81bc6e719fd,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\005\b"
+	.string	"\006P))\200K\263\00630\027\214\r0\00330\00330\307\230\247\2206)P(D\216\265\036\217\317\305\245MBVvo)eJ\001\031"
+	.string	"\034"
+	.string	"!"
+	.string	"/\302K\260R\353\300;\255\321\013\275\317\353\274\357m\336\345e\353kD\377\b\357\305j\361V\254\024\353\304+\261F\274\020\357\303\352\3606\274\f\357\302\033y\025\336\204\325\007\274\322\033\271\247\254k\025\266"
+	.ascii	"k\364\332\"\344Y\333\262f\262\226z\254vplhd\274\030\001\372\036"
+	.ascii	"lEm[\240\251nj*=\344\350\326a6o1I\263\270\227\215qj\260\026\274"
+	.ascii	"\2205% `\"\221R\355\264\006\304=\250\335\234\306U\033B\027\376"
+	.ascii	"UHy\200\207\261z\217\266\0014\207\315\264\034W\304*\017\0237"
+	.ascii	"\263>\3229\306\237\026'\203\335,\263\260C\213\350\177\371\321"
+	.ascii	"N\225@\223\317\261U\331$\267+\350X\301\271a\366\037\f\022w\203"
+	.ascii	"\341\020\205A0\244"
+	.text
+	.section	.gnu.lto_.decls.1a39f81bc6e719fd,"e",@progbits
+	.ascii	"(\265/\375`\355b\275v\001\032_\366\203T \016)\225t\336\213\206"
+	.ascii	"\211!\274\202\002\324\213]\356RQ\305\006\276Sm.\027\272\251b"
+	.ascii	"\210\341\270\316\334\245\310\332F\375\025\375N+\036\253\254\322"
+	.ascii	"\231\320=%f\234\251\234\2312p\361\3408\273\255\317f\232R.\241"
+	.ascii	"\274}\212\376\361\372\306\316g\204\020\262\267\334)&\007\016"
+	.ascii	"\b\203\bv\355&(C\036\202Q\267\344j\"v\355\256m\251\221\031\235"
+	.ascii	"\221.b\327\346z\2579\217\345\234A\200\3209\245\256\316\220N|"
+	.ascii	"<\225\036?\245\3073\322\267\331\234\363\030)\355\365\r\244\177"
+	.ascii	"\330\265\265~\253\245\247\234\264VWu\326\225^k\265\017\273v\023"
+	.ascii	"\264\346%\0323.Qo\2019\257: @0 \006\r\251\023\377\356\245\177"
+	.ascii	"ga\221\031)\322k|\265\325\345\313K\343\337\272\264{\264\025\216"
+	.ascii	"\2624\242\306\277l\351oZ\372\373\225\332ls\316n\223\212\272R"
+	.ascii	"\222\344~\264RvJ{\233\322;\354\030\233\035VNY\032\377\026I\373"
+	.ascii	"\316n8\333\251;G?\275\235\272\351\"F\334f\250\235p\316A\326\016"
+	.ascii	"\340\306\332\001\230pZALN\374\273\225\376R\265\215\036+\263\267"
+	.ascii	"\306\277N\351\257\214\264\373\354\206\363\357\031L7|bz\312\306"
+	.ascii	"\275t\304\307U\\\343V\3221\273\226d7\032\277\tS23\013\205\004"
+	.ascii	"\321\322\214\022\023\037}qu;\226ptQK\013'\005+\313S_\022%v\214"
+	.ascii	"\004\321\322L\022\236V_\316k\210.\326\313\r[J\321\360\220\372"
+	.ascii	"\364\224\372B\200\261\201$\210\226fh\b\311 +\373\036\t\242\245"
+	.ascii	"\031\"\274\037`[\354\334\315P\206<D\345\264\314y}\b\277\205\263"
+	.ascii	"\203\272+\264U,\026\022DK3Fx:\372r^m\222_\304\b[h\007-\341]\227"
+	.ascii	"\250\031\325V_\316\253\325\302\305\316\335\260\245\324\214I\216"
+	.ascii	"\276\234\327\377\255\354\030\375\242\223\332\250\217\032\251"
+	.ascii	"\205:\250e\364P\347\206\321E\266L\023\331\325\026\3321\267\202"
+	.ascii	"\226\314u\326\234\207r\316\267`\177\b[h\373\354\227\033\266\224"
+	.ascii	"\207\254\224\005x\221wcJ`\316+\b\035\0207b@\220V\002\2548\030"
+	.ascii	"\312x\225!\323\370}\226\236\331\346\234\277\263\033\3167X\372"
+	.ascii	"\333@1M\302\272pY\361\220,l[\215m\030\013\270f\235S\t\036\026"
+	.ascii	"\225\306\357\037\351\273\312\317\376\341\210A\002\203%\207_\r"
+	.ascii	"\313g\3035C)H\3437\221\335;\026\223\302p\203n\320\2615\276-\223"
+	.ascii	"\336\002\246\267Z\322[\2714\303\223\364\267X\256\230\313-\261"
+	.ascii	"\275\306\326\212\305\263k\0076\357\"F\374*\3052X\316w86e\220"
+	.ascii	"\340\361h|\213\226\336vp\332B\333\301y\033\226\n\200+\275\275"
+	.ascii	"Jo\235R;\305R\261\353\007+w\033\305\306}fh\315c9\25783X\276@"
+	.ascii	"5i|\313\224\336~8q\n\013\013\013\355\207\363v(\025\200\3159\261"
+	.ascii	"\335p6\300n8\177gs\334\354\2236\374\002\n\024\254\306g\341\366"
+	.ascii	"\266\323J\222\\\326\370\267l\267m8ZkU\252\032\333&v\255pm\016"
+	.ascii	"\256\261=\263hv\365\300\246\335:\261j7\203\326\274\346\274\342"
+	.ascii	"\364\017\3023&\2153\330\234\263\355\206\363)\322[\017\316[Xh"
+	.ascii	"=8\017\370\275\37735q>\250\352\032\037\004\351QH\277\332\r\347"
+	.ascii	"\355j\305,\223\024\207U\320^\343\213HoW$\026\314\206\335\242"
+	.ascii	"#\251\334$\347U\003\ra\220\272\300\306\277\210\021\347\263\311"
+	.ascii	"\031,\347\354\001\203\225\031[r\343\333%\317`*\2178N\372N\337"
+	.ascii	"f7\234_m\316\231\332\r\347=\270\246\226Y\002K\374m\216-\341\201"
+	.ascii	"\355\020\210\325\301ov\200k\306\001\254\013\333\363\302\r\363"
+	.ascii	"\037\305=\270\320\002L8\202\"!\020\362\365\001-\023V+p`\005\036"
+	.ascii	"*\264\006\376o\340\351\177\342(\341E\005\224\023hA\004^ \241"
+	.ascii	"\005\211\024\214\360#\002Q\204\nx\302\337&\\\340o\363\2029\316"
+	.ascii	"\177\016=\340\300=\300\231\201?\t\374\r\001\022\374\216\342\032"
+	.ascii	"\374'\006\274\364\b\021>\002>#\007\247\003\272|\320 x\320\343"
+	.ascii	"p&`\313\001\376.\200\001\3766A\\\315\246\003\n\363\254\271\250"
+	.ascii	"\026\r\177s\370\233\203\2773\350\340o3\313\265\347\025\004\354"
+	.ascii	"@?0[\372\252t\n\353\244\315\346\243\273Wf\334~\013\345\357\364"
+	.ascii	"o\323:\271y(\256\3417\241\234\3467\315\354\226\320!\3610\330"
+	.ascii	"rGf4S\001\254\225\277\177\024\307\360\233[\177\033\375\367\356"
+	.ascii	"\332\335\252\272\337\216\371\255\340o\311\374\037\274t\177\033"
+	.ascii	"\335\250\376\026\272-\344"
+	.string	"\354\n>\202\025\316\3417;\374vD\332\031\215\337B\300L\351\203d\246\021\025\261;\345\277R~\373w\343\376\376\021\313\360\233/\376\246\272Q.\034\210\036-$\030\374\246\013=\267\3711\231\017vh\201\221\037\024@\356\333\177\017\232\004\257\371M\022`\0253|\34679\360\333\022\315u\376&1\251(\002\004\354\007f\\\032\377\205\362\333-7\307\337,\236\3746\356\277nlv\257\207\214\370M\325&m\005>hs\276\301ovP\224\366\267\013\256V\267\300\346\330\016f\n\355t\321>\230\274Zg\377\335z\006\277\t\201\306aWp\315~\373\302\007\332\003\377G\360\337\303S\207\337t\300\177\313\326\337\372\370m\326o\201\3746\354\277H~\013\342\267b\277%S\300o\177~\273\200\277\205\356\222\031\306\337\216\370-\216\337\212`M\370m\b\277\265\001\201\337\336\370\355\003~[\302oI\370m\216\337Z\340\267M\277\245"
+	.ascii	"\320oKX\250\250\377*\371-\325M\362_\260\337jy\370\342j\272\005"
+	.ascii	"~3\304\tF`?\360[\020\374\326\003V\004\277\r\301oY\374\226\004"
+	.ascii	"\377]\321u\215\374G\300=\\\256\273u\002\374X\317\252\277M\361"
+	.ascii	"w\362j\375\266\347\267>\277\345\271>\376nA\243\370\2209\363\337"
+	.ascii	"\236\254\377\376`\335\235\253\337\026\377\356\271=\356\301m\362"
+	.ascii	"9?\006\374\257\325\177\235\376K\343\2771\376K\364\337\026\376"
+	.string	"\013\364\337\342\177\211\377U\377{\202\377\216\340\277!\370\357\007\376k\342\277+\3747\003\377-\341\277\025\370\357\004\376\033\201\377\222\360_\022\377\035\341\277\"\374W\304\177\033\360_\017\376{\200\377\026\340\277\034\374\227\303\177m\376k\376\367\376\327\376-\370w\340\337`\376\356\373\233\357\357-\177\343\375m\3677\335\337r\1773\375\035\367\267\333\337i\177\237\375m\3667\331\337b\177#\371\273\005\177\033\371[\353\357\253\277\271\376\036\362w\220\277\261\376\256\372\033\352\357\247\277\233\376\236\361w\322\337G\177\017\375\355\202\277U\360w\213\277\201~\333\345\267\031\376\356\371\277\201\277\215\177\377\374V\353?\337\377\277'\177\263\370{\305os~\273\302\337\352\337)\376\036\376G\361\333\016\177\233\340\277\332\177\017\376&\301\377\342\337!\370\355\013\377=\374\r\202\277Q\374\037\374{\205\277U\370\257\302\337(\374=\201\277\035\360w\210\277\021\360w"
+	.string	"\376\006\300\3375\177\333\337\022\376\366\313o\377~\273\367[)\277}\373m\331o\203\374\367\371\255\325o\253~\313\202\337\256\340\267*\370\255\213\337&\177\213\374\355\361\267)\370\255\206\3772\376\313\375\257@aaa\341\317\301\303\177\323\366W\300/PCP6\256\314\033zcy\\\260\336M\030#\300\270;.Y\260\026\345\020\337\337\223,p\267k\303\341+(\254Yy\003C0\352-0/-)"
+	.ascii	"\347\331\374\205y\372k|\0331<\242\032\200Lx"
+	.ascii	"w\270J\372U\210\005\206uG\207\353jjh\025\2225\276M\023\035\025"
+	.ascii	",\227R)\373\224\310PYk\332v\234\325h\214\343\360P \024\242\306"
+	.ascii	"\257\341\303Q\360\023\f\305\256\227\303o_qn\236\3008\223k\374"
+	.ascii	"\232,\351\355\345\316\027\330\313\235?v\303mo^\250\224a;nkB&"
+	.ascii	"\b\247\243\261\210\020\307lg\327\033\2171x\r\253i)\207\370\320"
+	.ascii	"\216\325~\234\206\235\234\255\245L(Z\212\234\032\333\325\346"
+	.ascii	"\234:!\216\321\2640\271\3318krv\371R'\303\f\223\3412\273\342"
+	.ascii	"&\230\t\036\273F\356\034\214\225o)\206\211\272,\233\340\260\275"
+	.ascii	"\276\2343\324\3352\256\346-}\215[\372\232\265\3645i\351\217\227"
+	.ascii	"\340$Z\\U\2744\276\215K\342c\251\004\203a$v\305I\260\027\376"
+	.ascii	"\302\271\321\222d%\301\272Q\332\222RJ\255\272\216\340xm\025I"
+	.ascii	"1\202\213\330\025\037\301D0\327\221\013x\365t\344\312\351\354"
+	.ascii	"\"\323C:q\215\320\020!(\222\224[\266\360\322\256X\b\006\202\265"
+	.ascii	"p\220\373\242\b?]\030X\b\316\302?\356\2724\001\003\251\017\013"
+	.ascii	"\301XI\313tp\306\017*'F\355\2063/\365A\243\005ih\255\361i\316"
+	.ascii	"\322\323\224\245\247\001K\177|\205\251d\370P\202\327\370\215"
+	.ascii	"Fu\001\257bP\025\366a\252\2562+\302=p\025\266\262+\246\302<\360"
+	.ascii	"\024~\2720@\350\330\246\261%V)\346\221\376X\n\327\300\301V\305"
+	.ascii	"\243\361\217\2430\324\0232\244-\215\037B\223]_\316Y\007\336a"
+	.ascii	"W\f\205s`'\374ta@a$\214\343\256\313\f\274\3202\263\324\266tw"
+	.ascii	"\342\323n8if\244\2471Jo\340\245\233<\261\270/\215?3\230>\204"
+	.ascii	"$*}x\006\266aW\\\003+\341\245\016s\215p\215\271>L\003\327\300"
+	.ascii	"Lr\346\0260\2025R\374\031\301T/\375\314\226\3643y\351\217\217"
+	.ascii	"\260\221\315\336\232#\t\313\3001\354\212\2150\f\\d\243\3308#"
+	.ascii	"l\204\205\310\364\345\274b#<\204\211\356\272\314\200\225\240"
+	.ascii	"\315!\346n\311\351\226\342\027\267M\007\004^`,5\376LX\372\231"
+	.ascii	"%\351g\274\322\037\007aes\261Z{Qx\254\374qn4Khg\304Mm56\355\206"
+	.ascii	"\323F\t\361[\210\253\302(\r)C(\225\205c\253\005/\231;h\327Kx"
+	.ascii	"\003\357\230\016s\215\304\\Q2\"\314\222\345%\274\200\226\020"
+	.ascii	"\265j\002\302&\356\213\214\0313N\351gp\244\237\251\221~F\t\314"
+	.ascii	"\030\220\254\033[\215\377\373\345\376\025\255\032\354\320\226"
+	.ascii	"\023\261\306\267\357\372\375\376]/\371\376\211\360\207\203\277"
+	.ascii	"\250\266\320N\374\031\031\351\177\371\366f\344\314\324\326\306"
+	.ascii	"]\326\030v]\312\032?\025\263\345j\271X\356\225\313\345f\261\353"
+	.ascii	"\325\273V~\361\354\333\261\035\274w7l)e\023\362\322G%\217\314"
+	.ascii	"RN\260\357\352\335*|}w\216\016o\314R\357\326YB{\327\224\225~"
+	.ascii	"\",Q\366(\023X\343\345\n*\356\006?5Km\354\206\363)W\372\364*"
+	.ascii	"\275vv\314,\213L\343\247K\351\3212\351\321.\351\233\330\234\363"
+	.ascii	"(\\z)S\256\0248\246=\277\3067\312\215\263\353\225\362\214\241"
+	.ascii	"\306\252\255IPc\0279\347l\017w\242\207\203\2032H7d\324\370!\254"
+	.ascii	"]\265\233\024\353\320\013\265e\316\371\311}\263\353\205r\331"
+	.ascii	"n[\207\271F\267\311u;\334mr\241\\\264\253\346\301\212\315EDV"
+	.ascii	"k}9g(\277g7B\260\025[_\316\031\204\016\b\020)\341\213\034e)&"
+	.ascii	"K\2172Io\332u\362\253f*\357\256\032\036\223\3129\350\252\335"
+	.ascii	"\302\301\234\203p\254\035\200\265\0038\255\320\b\013r\342\243"
+	.ascii	"ag\035\220\300\257\311Hc\033\263\262\245\237\020Qc\262\233|d"
+	.ascii	"\325\324\370\250V\372\377\212]&v\275cwy\205\334!\227\310X\373"
+	.ascii	"\210\032\353\265\033f\357\232\314+?\372\232\211H\317\307\271"
+	.ascii	"\344\256v\275a\277a\027\311U\222\005\343\267p7\354\026\271]7"
+	.ascii	"\3125+i\254|D\275\005\202\2509\273\352kr\342\377&\371U\362_\257"
+	.ascii	"\373u\245\212\002\363\032_\260\020\277Ih\276\342\374\3124\036"
+	.ascii	"\321#\275K\233s\216p\344\267\353\277\\\275\304\351b\205f\327"
+	.ascii	"\370\032\t\361{d\250\006Z\220\3063v\303y\024*\245\261\033N\274"
+	.ascii	"ds\316\213\241/\322\377n\335 \r\270\243/K\220\253e\203\214]\334"
+	.ascii	"\025N\020\275\027^\367\207]/\220\266\272@z\355\372\260wM\031"
+	.ascii	"\204\245\030#]9g\035\020\250\327\327]\022\306\377\315\262d\367"
+	.ascii	"j\306o\251MH\343\213\025\3427\313\232\325h\252\322\230\002v\303"
+	.ascii	"\211\363\355\341\204\"\211B\325\344Z\335\252\232&\2047\3004\246"
+	.ascii	"j\2023x\304FR\343\237o\351\033-\206\3212\250i\231\363z"
+	.string	"u\\\244\253dUt\2632\3075:\212Q\246\013\235\372\356\323\205\272Q\227\307m\2727.\216\353t\247n\216\273\343J\331\365\352\270Kw\306\245qk\334\256\271h(\347l\343i\t\243\350\312\221\f\031\275\024R\272/\376\020W\307%2\263B\002\273:\356\220]\273c\313\024\006YR\037\006)\205NG6\300?\231\244\266\310\346\234\032.\323?CC'&\307\262\361O\260\364\247U\372\337\244_\245\277\303\\\243\343V\216\262\306\326I\210\337\244\333\026\205h\260\361\317\250\364\347\214T\307\346\234?_\2447\003\323\233^\322\006\340\245$\244\2447\235\2447\303\322\233[\351\265L\245\357\2639\347\337\204\0370\214\301\"\3245\350\206\222\351\230Z\311\b\312H\002\206\255W\033%\245\037Rc\002\355]W\324R\314;p\214\357m\325j\334aB\274\305D\340G\325W\343\013H\330xtGB`<H\207\240\244\201}\351"
+	.ascii	"g\275\201T\365\2477\305\306\022Q\343 [=v3\264f\0326\213\226\250"
+	.ascii	"\267@\032z\215\243\235n\224kV:\257\370\242\336\002u\3505TK\221"
+	.ascii	" Z\232\221\221e\257\257y\264^S\265\226\275k\312\220\207\262t"
+	.ascii	"Y\346\234[\257\355:\017\311R\355\357\262\326\353\263\236\273"
+	.ascii	"\tZ\263\322fI\213z\013\344\322}\355\245\371\332\257\273\364\236"
+	.ascii	"][\257\263\274\265\364\226\246\241\3275\372\306\315\320\232\231"
+	.ascii	"P3/xMM)F\006\254\301js\316\016\264\033\316\2333\322\316"
+	.string	"\353\265\306\363ZvY^;\371\272\322X\354\332y\177\323u\335\020M\035\036\020\301\023\377m\245\254\3570\354A\341*\323\270\253\204x[\241y\301\304\307Sc\273\304n8mL\030\251M\221\3159mX\\\313\265\224\216\322Tz\212]{\356o\263n\362^C\364\\\257\265\333\2152C\316Wg\3137%K\270$\313'M\032\355\357\264\271v\202\2466\327Pd\230-\351\313y\325\301\221\3123\323\273\3017\225\3511az\f&=\306\222\376\335\326j\226\360\004\032\3300\345\275%5n\266\020\357\266\r\347R\323\232\233\344\234qjxh)=i\374B\273\341<\256\222\246\231.\265\331n8?<I\323\245\3159-\221\335p\332u)\244\271\256\354\2269\347\377M\326L:\254\305z\265k\217\3415g'c}\244\221\334u\231\022e\221\353\3139\177\204\222\265\270\036\353$}\303\214\255/\347u\254\227\240]\251\201"
+	.ascii	"\001\"\035\203\204\212\230\r>v\222\036\227\245\307_\351GtY\302"
+	.ascii	"\033e\206,\224\205\312\022\254\277\354\332Hn\327\334H\332+\355"
+	.ascii	"jJ_\316+\b\035\020\030\2168!\264r\342\343\"\351\261Vz\214\225"
+	.ascii	"\336\252\r\t8xd"
+	.string	"bB"
+	.ascii	"\177\2069\234\f\243 a\215O0v\016\360\251\253\361\371\245\001"
+	.ascii	"\315@\245\"\036Y}}\347]\003l\206QF\206t\322Q\305H\303\241\247"
+	.ascii	"w\362\351\2449\t\231Q_\316M\037\260\230*B\332\366~\362]\t\034"
+	.ascii	"\214\321\370\354\322R\375\343\r\007\221\016FY\262\234[t\244\356"
+	.ascii	"\025%\034K]7\214\022\027\016-?\267\320\324\230\"\326Cj\346.L"
+	.ascii	"\230&\215\337![\261r^\271\302\273\332\221\236\371\201%\311\373"
+	.ascii	"y\305\022\316=\271qi|\342\215\220\207\024\245\361\001;\320[\313"
+	.ascii	"\263k|\035\271s\356\234;\357\254XV:\311\216p,\005\346\334\364"
+	.ascii	"a\006\211G\230\323i\367\363\316\316\331X\341"
+	.string	"\001\241:\353Ve\346\253;\351f\376\272\350\r\335\b=-\257\032_\247\214\n\025\f(\001\257\250\267\2562AwB\032_\207\210\024)I\200\200\371\021B5\276N\324\371v\276\235Q\222D) \t-\237p?\243\200\215\345!\351 =yr\266%Ij2}~W\032_\203A5\265\263\215p\211F\2512%\237l?\333\n\311\320~4>\327\262\234c\347\330\231\006\001=\f9\224\274\0209\321~\246\231P]\200\0205>\317\316\226\204\026D\260\361\331\344lY\2328\225i|\232\235\255k\313\024a\343\263\354laVnV\032\237dg\303Y\013\323\362\203\355\377\214-\262\346\205&EL\f\003\326\231\201[\354\242\314\326UJ\333H\303\241\344J\211\0224\232,(Q~4\276\006H```3X\\\004\313\374\276\276\202\340\304u\251\001R\351\352\302Z\206I\323\321\243\361383b\344T\332\234\2218\331"
+	.string	"j\351\033l\374\f\214pq\235K$GiY\236\002k\374\f\236\316!\347\220s\351U\006\310\225\027P\215\237\001\321\231uf\235K\257@s(mj\310\271\365s)\345iF\3433\310\3410@\221U1i|j\035N\252\214-G\343\023\310\371\343\364\221\343\345\274:\257L>/.2h"
+	.string	"!l\374\034\270\323\352\2642\371\254\327\034\024\036xG\215\237\023\226\236P'\324Ies\366:\263^E\224x\234S?\251\254\334p\013l|\362"
+	.string	"\003c\305\325\370\224\322"
+	.string	"\r6\241\306g\024\356\303\3711\205\310G\343s\207\217\0337\316\247\255\324\317\016j\214\323\317\247\233\032A@\2404>s\244l6pP5>\233\016g\036\331\362\342\325\370\304\201\373p\276\254\\\355\310\301q&\235Ig\r\257,\273'\364\227t\322\370Y\303N\350\210I\343s\306\341\246\362\354\032\237L\030\260\006\313\364\032\237Kv\r\357\341\tB5>\225\260\335\225\341\265#\215\360\204q\3028\217\036\360\024\365\326e\316\3451\361a\364\363\250"
+	.ascii	"R\356\2544>ed\254'\273\306g\f\266\033X\204\215\317\"\273v\003"
+	.ascii	"u\326e\203C\226\363\305\371\002"
+	.string	"\003\332\274\344\225t\243\346\325\226\326\370\034\324N\241S\350Tz\025\305\201E55>\007$\203\203\247R\020u\"\007\345\314?\225d\216\256\242\032\233\205\207\253q\272\242\221\326\330,s2gK\362\032\233\204\034\260\004\005M\271#]l\021.7\304\032\237\303Q\2300f`\035N\325\334\225)17\003[\215\316k\305VzT\231\203\341\367\367g\202\221\262\274\021\244:\232\361\345&\030*A[\362\032\037\360\203\214\2620B\215\277\201J_\237\311\207\266\022\032aQ\242\247g\362\201-m\356\006\251\214\366n\362\321\240eM!\323\330\354r8T\256\216*\352p6\334\220\3205\376\006\251+W\314-\016\b\022\365\3265cWu$\247\345\346\226\032&7\260\23446\263\034\316)\n\230\222\306&\226\303i\225ay\332\240T\245\212\211\207\265\264\231s\233\301f\345&^V\027\033zN\377gld\314\200\262\243\3611"
+	.ascii	"\264\2633\345\354\021' Uln\215\217A\034\035\235)g\217\034-y\304"
+	.ascii	"\351\001i|\f\304\246L1\345\312D\275u\245T\340\226V*7\345\316"
+	.ascii	"'\246\306\220+\273\2522Uu\215\217\301\217\024\n\0243\316\346"
+	.ascii	"\\d\013\013<\372\240D\271\031\207N\251\263\022\322\330\204k\301"
+	.ascii	"=\272\253\306\346\333\rJ\253\243a\327\360\022\"M=\032\037\203"
+	.ascii	"\032jj\246[\347\234\363\022\225R\204\255\017L\314\223\263\266"
+	.ascii	"\233nC^\340\b\033\233l\037p\030\241\252\321\330\\\373\360\177"
+	.ascii	"\006\377\315\225\361\350;B\306\b\013\231\264\264\247\232!L\346"
+	.ascii	"\362\316\316\222z\fZ\035\336\232\231Y\004\212\304X\252q!#\244"
+	.ascii	"\3615|\215\215\231d3J\277\017D\006e\300\001\301kL\366\213\030"
+	.ascii	"\361!\t\327\027\276\306\327\320#I\022S,\004-Qo]\3122RFa7\305"
+	.ascii	"\260\22080H\215\315\365\003\233\226^\220\306\0074\227\210\351"
+	.ascii	"\"\342Zb*\251\311\002\206\215\f\203\r$Y7\032_\203QW\227\211\204"
+	.ascii	"\003\021%i\027\232\f\033_7\221\304\230J\232klz}\300\300\205\306"
+	.ascii	"U\316J2\033\312k\374\f~\251\021#\0300\315c\242\336\002\317\255"
+	.ascii	"\265(X\342\270\270\314'\024\224!\264\242\336\272rS\323\007\214"
+	.ascii	"%\311^]\343g0[.\315!v\253L\324[\340\f\235Q]\231\220\233C0\264"
+	.ascii	"\345\340\343\332\362\177f\001Wh\177\215\237\341\313\207\031\304"
+	.ascii	"\207\251\365\343?L-\233\227rn\212\200\020*\313\334\324\364\001"
+	.ascii	"\307\357\314\013W\343\337\004rSk\211^&\2323\242\004dI\343g\340"
+	.ascii	"\221>\203\322\354ab\231=\314+\363J\310W\027\221\322\212j|\234"
+	.ascii	"\277\3648sQQf\225\022\230Y\025\264\247V\325\330\234\262\2044"
+	.ascii	"^d\262\334\032\233<\356eM\355\313IcS\n\303\365\030 \022/\215"
+	.ascii	"\017\3307\250\2041\345\215AAa\300-'\234,\323\311t2\237\366\366"
+	.ascii	"\242\336\272\314\247\031!D\250\216\032\037g\251F\r\263\311H/"
+	.ascii	"\352-\320\304q\263\251\235b\264-!\322\330\274\201\245`\210A\346"
+	.ascii	"\213Vc\323\206\240\271d\3160\227L&\223\251\b\037M\332\023\264"
+	.ascii	"\271\306\277\301\222\376&\315L2\2230\240\027\275\233#DD\346\321"
+	.ascii	"\b\260\250\267.\363(-\362\267\343\251\261)\003\207\bn\314\227"
+	.ascii	"\306f\214\233)7\250ec\263\b\303\245rJ\257\030\215M\030Nf6\263"
+	.ascii	"9\344\025\365\026h\n\335\034\n\301\356nGc3\350\234B"
+	.string	"\325W\330\330T\336\013\006'aX:0\334\255\243\302\023j\374\033\242A\\f\020\003\2369\333UJi)7-} $\304\200\251R\207\210S\323\207\032\245*+\312\306\307\300\227\036\003\233\0301X\320\346\234sS\276[\242\242\336\272\360\230cA\273\204\314\030\264\3068\260\001m\274\301\320k|@K\370\177\306\244\n\323\205\255\3611\030I\217\377\360\227c0\307`0`\232s\316\332\213z\013\314MK\037\376\003\036\003\232V\270\202\2405>\006\247\364\277}\377g\016Z\3129\3170\327\274$ds\376\366\326\264\366\303\217\301^K\200\377\370\376$\240X\263\320[^\316\331\202I\211\260\005=\t \233w9\017M)+0\30544\205\243hl\212IC\321\330TV\016\005QjX\312S\312\242\261\2345\f\r)M\220b*\032\013\312\032\212\3062S~a\205\311\346uJ\231\207\244\262\206<\224\203\362\230\024\223"
+	.ascii	"\212\206\246\230\212\306\202\2304\024\215M1\345\261\251\234!"
+	.ascii	"\017\005-\305\030\312K\032\362\330\224_\036\223b\312P4&\305T"
+	.ascii	"46\345e\307\304\340R\203\006[\336\325\016"
+	.string	"\353V4\224\223\220t\004-e\270+Z\245\262\226\234m\023\242\274\224\357r&@\316:\244\226\264\004\341\260mBwIBN\202\244: \tQI\345\241;\245\315wE\\R9s\t\255\310H9\347,\202r\275\313Y\366NY\245#\037\021\345\274A^sF\312Yi\363]\316Y\231sF\227t\2549;e(Z\"!\345\334\244\203\224u(\335\210r\356&\\\332\230\212\306\250\244B\270\225\215-3\214Ui\213\216\244\3622k\231ZJ\307\224a\371(\347l\277\244K&\032\177\215W4\314K\333[\237\027$5z"
+	.string	"\31183nd\212\330\340\333\013>-\214+N\354$\223;\030$Ud\212\241\017q\330\202\005\220)p\360\323\002\311\202G]Q\"\303\261\005\020.\252>\307$\362\354)\022Y\340p\242\250\002\031o\276\342\003\365\207\230D\022}|\210H\020\324\236\026><E\"\bGd\013\0202\360\361iQ,\032\213\250\013\306\343\212\244\261\210\2620T}\360\013@<?\352\317\371\025\037xP{\214<\305\013$\213\304\343\260\205\026\030T\365x\002\n\r5=C\232\257\370\200\347\310\003B\321\370\363c\344\321\021\201\334I\321B\317\016\t\236#O\215\212\"1I\034\202"
+	.string	"\251&_(\301\205\t \343\nd\213\025J\250\311a\322hB\203\3523\3449\241&\207>?\311\022\034\222\352\211\237d\211\237d\211\f\001\360\361!\236PLAE\002\021}|.\220\344QM\360\250&||\210'$yT\023\030l\340\343C<!\203\"Q\003F\024j\013F\025X \207*\250(\022]\030\036MH\252H\325D\222G5\241!\311\243\2320\242"
+	.string	"\"\372\224\300 \251\236\310\200\003#\212\f\305\024:\364\024-\320\201\217\017\361\204\244z\202\203\312\302xL\236H\252'2\350!\0361PLAE\221xL\236pax4\001\003+\344 }\214%0\220T1\260AM\022\217 \030\252&\222\304\237\037c\211\027z\206\252\td\nIb1\005\033\235\"Q\205ZB"
+	.string	"nrx\212/\234\350)\252'4X\301\223\034\002!\211&\350\250>=\305!\n9\033\212\252z\3449q\034\252>%\214,\024SHa\364)\201\247\370\002\322\002=E\365DQ=\321\200\017\222\307!\320\007'V [\370\234"
+	.string	""
+	.string	"\022\036@\"U\036\343q\005\03559\354\001\362"
+	.string	"\007\347!\036\325\242\252\"\275\b#0`\004\022.\320\223 \241\001$4\340<\t\022B\204 a\204\020\351G\bq\325\235\0238\250;?j\022\371\302\t\243\332Cl\001CR\005z\001\205Z$\372$[p@-\0225\320A\335\031\"\213C\017\352N\017\322h\223\3349\221;\252\217\212\342\220xD\021\002\250E"
+	.string	"u\b@}\200\236\342\360\347\307X\342\230<1"
+	.string	"\026\310\241\nI\236\236>\032}\214%X \207?3.\f\217&l\200\334I\362\250&\212D\025\304\243\361L\256\260\310\035U\005\304\033\027\254\252\002\"\022#w|T\027\304\025\222\352\t\f\222@\366h\3641\362\230\310\235\236\237\022G5y\242\207x\304\200\013\303\243\t"
+	.string	"p\241\242_P\321\310$\220\021\037\207+xp\022\003#Q\203\027\216I\365G\365Q\223\032 wT\020Y(\032K`\300\0029T\241h$&y\212-X\260QwR\310"
+	.string	"\b\371\203\004R\241\301\205\332SLAM\016\217=-\206)v\\\030S\260\340\031\372\244\310"
+	.ascii	"\271\223,\022\215+\270\260/\330\344\006\240\341O\222\230\342"
+	.ascii	"\034&\207=\303\244\372\223&\213\306\0234\370\212\017z\220\306"
+	.ascii	"\244\252\002\342\t\026<\303\344\211\244\0135Y4\362d\350QY\360"
+	.ascii	"\f\201N\344\216\212,\032\201\220\031\360\020U\240`x4\026\211"
+	.ascii	"*\254\340I\016W(\032\211"
+	.string	"\310\243\332\202\r\322\005\243\211\036\342QEZ\242\207xTQ\263\"\331C\004\001\r\n>\252\013\"PM\317q\330S\034&O\264\220\244\031\036\325\237a\211\244j\002r\270B\203\252\002\342\t\365gx<\301\305\360\307\006\271\243&\207\311\023=H\016\340\364\024U$\215\232\034&\221&\317\221\347\246I\026\210+N\364\250I\036\025\310\205\212a\230\034\366`\244\021\350\266\300\243\036i\216F\024\f\177\314\243\261H\3741\223.\324b\r\322\005\343\021#\213?-|\214<h\017\361\250\002\257H\366\020]0\223+T\020\325\025g\362h\004rA%\266\220\032Y(\022\36178\366\364\fq\022\271c\2749\256\340\271G5\3113<\016W\224\350Ar\240\005\036\365\230!y4\002a\037\243\261\204\035\263GU\001\321gHL\022\213\304\232\344\016R\005\365\207\230L\223H\265E\nT\023F\026\212)$]\250E\234\344W|"
+	.ascii	"\002\362\250\266@<\366x\270\021H=\202\2204\032\217 \324\034U"
+	.ascii	"\"\013\304dQ\355!\322 wl>\220<\032W\310\240\372\244\030\242h"
+	.ascii	"\341Tw\324\036\243\n\311\243\021\210F\3551\376`u\207\003\311"
+	.ascii	"\243\021\b\003\262h$&\201\214\250\232\034\232\350i1L\221\252"
+	.ascii	"* \236PU@<\221&wH$\213\304\026h2\355\031\252(\034mz\206*\n\311"
+	.ascii	"\035\021!\370\020\207(\216*\013,\264(\301E\322\246\005\242\312"
+	.ascii	"\243\232\320I\356\214\020\"Y$\266Hi\206\311\241\t.\2167\307\344"
+	.ascii	"\n)\370\f\211G\025\231\363\020!J\b\300\003\033\300@\312\363A"
+	.ascii	"\017\322\270\363\002\013\344\221\005\020\214D\020\212\304\341"
+	.ascii	"\017\b<G$\b\037t`\3013L\341\3433,\241\372\364\020m\036\030h>"
+	.ascii	")\325up$\375Q1X\320\356Q\001\013\013\003x\354\373\262\242`\372"
+	.ascii	"\306Q\326\220\306\357\240\352\313\037\230\245\265Kc\324/\375"
+	.ascii	"\262\021\006L\343{(\223\376h\037\352\245\306\316\016\255\b\345"
+	.ascii	"\303\\6\212\215\303*{\013\322\370\036\346\322\037\335C\273\340"
+	.ascii	"\262)_P\275+U\203n\260\361=$I\177\224\013\376\221\004\344I\336"
+	.ascii	"\026TK\n\370eELc4\213\235\0211-\215\357!H\372\243X\320+\335\243"
+	.ascii	"\310\030:4o\214\324\024&\215\357\341\311\212\0253n\004\226\207"
+	.ascii	"\241*h\035\n<\326\250\334\231Gd\205O\230P;\324\352lSZR\206\322"
+	.ascii	"\241{H\306,5>\007W\322\037\235;\303X\340N\251\213\034*\205\214"
+	.ascii	"\032\021\242F\251\274\003<\270\304\257nJXg\325`\232R\243#\020"
+	.ascii	"I[\234];q\274 \223\026\245\n\003\337\225\221$8S\013\005\242$"
+	.ascii	"\323\367F\303\f\253A\027\004\305\351/\307\227\224\306nn\031\262"
+	.ascii	"\320\026\247\245\032\252\206\252\241l\2512K\n\272v\224\255\307"
+	.ascii	"\223\022\214\203/'h\214+\307V\344H\332S\t\177GVgg\346\023\nF"
+	.ascii	"u;\322\037mb6\225\005\225aB\313\216\232\375\335\340\361\324\030"
+	.ascii	"\035C\311\216,\321\2664\276]\277\307G\244\313\023%\215Q1\224"
+	.ascii	"\t\326\362\f\312\275\274o)\220+\220K\030Q\022\0222=\320\325\034"
+	.ascii	"Z\223!\243\256q\013\246!\341:j%\327\007\266\322A\224\227\004"
+	.ascii	"\005\313\022\205\206[\333\320i\r\3065\376\3722\207\266\202p\360"
+	.ascii	"\302\353\334\"\002\313\022\2511zD\004\251\234\203P#h\327\321"
+	.ascii	"#_\321#8\2038\326\016\240\2118\241Q\346\304B\204\240\\\235\245"
+	.ascii	"r^\242h0\006\373P\"G\271\320(2-H\215\321!\226\220F\317\213\334"
+	.ascii	"\223\r\300\240[\350\026\006L\225Y16\230\222\376h\020\fx\226\003"
+	.ascii	"\213\2521\372\343"
+	.string	"\276\240\260\260\020\375\321\250\026\n\344\350\217\343\240Z\272\212\202N\037W\332\312O\312\213\254\223\357\006p\307\221\036(\326y\327D\030\204\356\352\n\026\r%ec\035G\245t\240V\367/\315\31257I)\375$"
+	.string	"G\006\203\232\223\227\024\217\243VG\253D\214\300pIpSa\032\243T\277i\242{\322\327\370\350\024\r\021\253\261#\215\317\200T\354\006\023\023\032U\243\004\216\b\2571\272\303\366H\272\263\002\365\317\330\370\001\271\341\243\3617xK\277\201\032j\003\265\201:\351H)\277,"
+	.ascii	"NH\21726T\200/\226\2407\216:\2419\006\237d34\007\332tG\345\306"
+	.ascii	"T\227\016M\2500\2418\256\025\016\366\212\324p\027\033\265*ej"
+	.ascii	"]FF(\r\035)\245_\004\342\374z\224\tT\022\006J\035:\343(\215\226"
+	.ascii	"\232\361\341uT\2441\312t\357P1UvD\032\243K\270K\rY\325\032\221"
+	.ascii	"\306\250\222\205\202\223\305\345\253\2501\232\364=<T%D\2561\212"
+	.ascii	"d\347\300v<\231\322\030=\262_,\2316,1\274\334\262\254+J\032\177"
+	.ascii	"\203,\264\b-Bc\234\t\r\001\013\274\022L\302\2451\032\343\306"
+	.ascii	"\230\034R\204\215\277\001\214\300\237\203\201(\321\305\263\311"
+	.ascii	"J\261\254\204\246!\331j\013\314EM\037n\214\274LY\025\036%:\372"
+	.ascii	"B\304\210\357\025{\224\2255F\207n\263\276\224\025"
+	.string	"5>\032\204\n\37533B\2728)\323\370\035\264\244\250\222\001P\202<\006\033\037\315XV\264\2124n{\270\363,\363\275FzR\004\252\361Ix\n\376$\363\317\314<\331a5\325\370\035\356\322\377\034\363\317\240hX\236\226\215\337A.}\207\267\277\2773\214\315\022\372Q\027\207\"\250#B\224ZH\226R\024\244\216(45\"\244I:\243\026@ @8$\023K\303\234\036\023\200\004\312h\345y$\310\224c\310\214\210\210H \"\"\222\202$)t\211oh\003@\360\336Y'\312,\232\212\316\215z?20\313V`\024:8\317\246\200!\266\332(rJi\031\3030`6\357ncPL\221'\274\207,\027L+*\316\362n\212\277F\234@:[\022\222\007\024\244jd\234%\242k\241\025\3224\020\316\307,\263i\324\371\3533\006\345\235jS\335\353\336\002\230h\330e\307 \264\333\013\260O\017\375G\347"
+	.string	"\354\317\201\260\2055@"
+	.string	"`\332 \357\307\332\364\344"
+	.string	"\\o\006\367\276\030v\303\007\016\2753\202\031\2647\204:\311m\253^FiE \036@S\305\204\360\244\307\bHr\273\326Z\312\036\214\333\321\026\274=\005\356\225u\374\264\315gbmUfJ{\331\236s\305Z\320\265B5'\351K\003ZnM\304\026\360\022\004\003V\207\243\3212\373\274\207i\036\"\276\322vQ\213N\031$\233\370\003N4\302\274\345\032"
+	.ascii	"\311\305\263_\231\306-B1\037\344g\340\231\212 \037+/\035\305"
+	.ascii	"~\t\031\332%bb\201\005\302Nf;\201\324\t\2717Xql\267\343\303W"
+	.ascii	"F\303\346\031\310\276|\232H*\243L\020`\345\030xHE\225Jv\320i"
+	.ascii	"\003zb1\037\320\212\376\233\3770},\242\371\206Z#G\30238\036R"
+	.ascii	"7]\026\211\035\320\005\264!\br\264&\333'\022\371?\211T\271BE"
+	.ascii	"\330\251l\323\025\013\352w\376\212\3359!\264t\0340\243&3\202"
+	.ascii	"\361\261_\230\215\310kw\303\220\033+[\313\030\007\235*^\345\352"
+	.ascii	"\b9\337\341\207A\250\"e\367\357_J\347[_\004]\245\033\206\341"
+	.ascii	"6\225\337_\004\031\360~\317\252\227\003\244l&\240\031\261Z\305"
+	.ascii	"\211\233\3707\002}\024\002\2667#\374P\277\205wUq$\340\354\260"
+	.ascii	"KM\213%\305\260(I%c\033\266\035\232\375\312\202\260\210L\243"
+	.ascii	";\350"
+	.string	"\314\257\221\245\204\214[\364I\013Xk\357#? \316{\016\367\376!9\242\310g\003O\277\212\351\205\b\241X\310T\234\227\b\232\037~\025\347A\002\205 \004\352\210\355\261L\367R\305\245\215\002a\207\016,\276z\341\020f;@\373F\270\035\306U\347\204 \023\222\377sy\261\023}\035\225h3?\020\r~.\3776n\025\b\300\350I\204\265f#\021D\252s\255\f\364\375\371\344\370\216(\265\232\177\003*\235\220\225O\354\306\177M6,D\2162\262\035\005X\343\273As\331\036\331\364 \310\372\\\205\247\r>\032TQZ\264\306}\373\257\226\251\270\235\227\246dp\354\326\022\222\3723\210\302\341\261\320\211'\255\023\237o\256\271j\355M\217\330\326\t\252\345\r\"\020\260J\340\212(\021\304[K\241!\213\022\270\013\032\260\273\306j\223&\302`\037!\005\217\337b2I\272\275\366\370-\027\242M\336\177\035\342o\"5"
+	.ascii	"8X9No\0358\033\335\206\034\205i^T\233\222\352K\0339\002}y\304"
+	.ascii	"\321\016\317#\001\2021\n`4\215N\\\236\355b\037\375R\332\266\376"
+	.ascii	"u\376R\221\2642\031\304c\325L\337=\022:\323\242\324y\017u\003"
+	.ascii	"Lyoe\371\234o\275\231;\246Y\223b\360\244{'\213\004\b\214l\371"
+	.ascii	"\262\306\330a\336\350\315\355\204=\261\212\343K\370b\364V\225"
+	.ascii	"\323\001\320\317\353\206\215\250\247\257F \313fn\017\214\200"
+	.ascii	"\002rMY\212R\374\233\035\002\251S\216J\314\341\374}\325IFn\236"
+	.ascii	"\b<\f\240\003\2640\221\013\214\302'\2765B\375\344\306\020\203"
+	.ascii	"\377\003r\347\013\252\\\264zu\232\203\216\237\262P\374\254\350"
+	.ascii	"~*2F3\263\376`\001\261\t\3520\245\276\031\251\206\247\245\360"
+	.ascii	"\335BS\025\323\270\332\213h\353\304\203b\216#\253\343\324\021"
+	.ascii	"\023\225\007w\031.i@\313j2\026\231\260E\354\340\370\013\232\324"
+	.ascii	"y\033\002\346#\243~\r\246\257\372\"`\032\303v>\240BG\222K\022"
+	.ascii	"\3748\363\346\2209\217\313\266\300b<{b;\235\b\316\353\334@\241"
+	.ascii	"&\3656Z\363D\016~\323.T)\344s\240&\023\372^\313t\347<\271W'\225"
+	.ascii	"\007\372\001Q/MFfk),\211\252Qh\201\326\350\210\304\0203\273\215"
+	.ascii	"j\307\371Q\330\273\231\2659\265\232\234\350}K$\220\307\343\311"
+	.ascii	"\004\003\213\363\277\371'\f\202\347\306\264j\337\306\025\263"
+	.ascii	"\003=?\213\221\235\346\370\\S^\261y\024\267\024pC\267\304/\377"
+	.ascii	"\005H\263\205\270\002`\241]\210{8\335\372\277\004M6\215\270\002"
+	.ascii	"\356 ]\376\327\232\236\3769\227\305\036\336.\377&qf\313d\361"
+	.ascii	"\036\337]\376\256s\364\356\323\220ENX\265\307\367\305\n\321>"
+	.ascii	"\375?\361.\333\335\344\337\b\310y\033F\254;\265\255\027\345u"
+	.ascii	"b8\323\200l\361B\305\216\357.\213N\034\364\300|\337\246.G\266"
+	.ascii	"\362\022\321\376)\357\030$\305\341\317V\023\254%\337<\301F\373"
+	.ascii	"-\b@\273\214'\210\311\035\331x\233\346\343\007\231\214iQ&\b&"
+	.ascii	"Q\2356\250m_[.\005\201\361\324\242e\340wms.\035f\340\230\265"
+	.ascii	"\024j\355\203\363\3320\b8\213\356D\203C\337s\252\316\343U\314"
+	.ascii	"\341\276\360\327Q1M\234\234\257\242\367\335@\017<O5A\260\213"
+	.ascii	"\355\312n\307\337++\342\256\306\261\326\360\303i\271\340>\224"
+	.ascii	"\2025C\216%\240H^3\027\353\245\351\346\262\234\265W\336g\305"
+	.ascii	",\213\310\305\t=0wH=\376\351m\336\235 \331w3:-jjw\375\310\037"
+	.ascii	"'\002\236\024\356\02714\315\264\242\366a\316\"'\311\326\030C"
+	.ascii	"\030\310\215Mw\203\211\267gI]\206\331\024\n\254T\213\357\304"
+	.ascii	"Kj\210c\354\213'\273\022t\365"
+	.string	"\313$\213UC?\003\235\221\334\001\b\223)M\340\253\352\211\241\373\242\376\363\033\242Yd\f\255Bx\262\365\344\267\277 \206\305\354\226\335\032\232\300\327g{\205!\240"
+	.ascii	"\226.\025P\004\007i\263\201VG\3111\023\246\004\202\345\321\341"
+	.ascii	"\246\202\231\223\032w=P\207\327\334\333c\261\303t7<\233\n\240"
+	.ascii	"o\305\325\306\007\326\003\\\367:\201\227\220\307/\325\303\254"
+	.ascii	"NY0\\\372\027\343}Z\257:\263\266HrR!];X\222Y\205\021\336\323"
+	.ascii	"\3563\262\234\037\223\307S#\3423P\261M\333a%\033\345H]\371\210"
+	.ascii	"\307\347\262f\fH9\373\256$\351K K\333\356H\321;\3579*\240N\224"
+	.ascii	"\272\013\307\\\024j\220\251\315\362\033!\320\221\222~QE\223\n"
+	.ascii	"\353\016Xt%\3056>\305\035\340\004\324\224\357\250*U,E\252\f\204"
+	.ascii	"\215FoJ\031\236\225.\255\240\312\243\247\024\346\300\333\270"
+	.ascii	"7\3537q\034\376\202\2514\213P\233\177\036)\345u\236130I\240d"
+	.ascii	",\346\240\221j0&``5\204\251\224\023-\"\026s\t\307\032\030\020"
+	.ascii	"O\364\225\256\365\253\367\311n\007<\362q~&r\013\005L\025\233"
+	.ascii	"\251\fK.\002i\262\204\330\332{0 \275\340\312\356\306+\254\201"
+	.ascii	"\007\264\276\227\215\334\001\311>\322r/\021\320~\227U\036\021"
+	.ascii	"o\355\034o\252 Z\006\227\3275\244\255]\276('AN\343\037\254\035"
+	.ascii	"[\001\034\205\236\fE\203\201\326H\376\302\336bz\204}\032`8'\313"
+	.ascii	"e!>\327\260\002\033\210\213e\001=\324\300\201\006c9Z\nE\372\270"
+	.ascii	"\244\016\203\025\231:\372) \2303iL\035\2562\035F\323\370\247"
+	.ascii	"!'\b\313\323\346\207PW\007t\270\212\315\235If]\203A5\260T\356"
+	.ascii	"\272\356\032\210\251a\005f35\026.L\263j)\200Q^\344\250\206.\267"
+	.ascii	"\202\234\314S-\330\017\2261\353i\274>|o\323\200\334uF\300n~\020"
+	.ascii	"\323KvqNEY\367Q\322\2454\202)[$\222\r\f\003{\251\200\326\353"
+	.ascii	"uQ\031\246\003\354\024\260\263\331\002z\236r0R\013\214?\243\034"
+	.ascii	"\325\020\254\251n\207\001tD\326\022\310\352\\\350\230*di\262"
+	.ascii	"\212j\301\225\252\343y\346D\034\2414U\311\020vr\331\340\245W"
+	.ascii	"\370\026-\213U\231\244\354\217\316p\0348"
+	.string	"\036%\335M\322\237\t\354\0038\n*\034\027\257r\370\212{u\244v`\210\331\203\254\351\356\177\307\320A\334\027\256\306\210\244\203\214\026V\222\235x\342\202E\274\323F\0229\252\257\255\240\020\026\177\023\255\324\337h\302\372\217s\022\227 vJ\313\221d\313W@dz\004\026\223oMd\3530\211q5%\2620\340\030\323\211\265\346\314\265lC\322\363N[>\231|\232\f\362\240\222`ug\362\317\270'\2560\b\020#*>\202\022f\013\302\003B\361\315\307\305\345\215\024\034\224\320\314H_\221\230\030\336\b\034/\2377\255\243\nn\344$\247\357H\247\270\202\022\371\223\336\221d\335~\224hE\273\365n\250\f<\034\236\3050 \250s<\234\351P\327\332\020\376\241\221#y\367D\264\334\311\246\254\026\241`\265\267\333}\325\260\"3Q\204\201{\036\031\236\n\032\321\371\3058\334\232@\204Uk\336<\3544\205R\377\223("
+	.string	"\004P\356\215\034\235\330\320\020\277S\004bN<\336\363\302E-<6\335,Y\361\016l\353\317\2505\222c\006\312C\200#zp\2225\353\266\033\304\243\341\232@\264\020h\337\022\240R\235q\306p\337\003\f\333(\031\"p\320BtK m\205\007\352\230\261\373\250;\001?\240\371(\371\226\004l\264\nB7`\002N\251\250nXY\323'z\3104\223yB\254kA\021o-\256\252\027\220\0377\267\351\320\332\377=\342\221\236Cn\352\311\307\210&lmC\363\241\034\340\245\203\335\330\377\344E\345\367\203\317\037o\365\304\213\002m\317\352_`\361t\237\033\256\030\370\357c,\371"
+	.string	"\267\225V\003\005\353\251{\270+3\355\250$\345b\246a\3373\327\"\224\"\351\331\2625r\220\250\373\316n)\263\004\001\212<\001b\243\327\304\366\363b\2233\"\2411\034\320 e\020\323U\0063\371\213%h\200k\24378<\200f\206\005\375\220\345\320\275 \210\217\250_"
+	.string	"\255\n(\240\340\374\235v\361\341\300\005\372\2176\3702\263\351B\240\261\201j\373\266\345\302\277\247\323~\230h\263\226U^\263\246\263\260%r\240F\3578\241\255\337\006Czq\327\362\303\360\337\310\315\034A\322\321\255(\246\325\304\t\371\220\345\n\\\3009\3018\273\0027\024XY\306%\322&@\337\327\247\035\n\003\017\021\274\367\005c\240\222\370\347\\5\r;Qv\262\312\\X)\275\317\212D\272\206a.\367\224+\017\273!7\177\375\035\\k3\020|\021\272\212\fp\213\272?\246\357\257pr\001\276\201\321\253\314:\3066W\205\310\004\206\274\336~\333\355\254\304?\303\313=\214\346\274o\030\230>\260\334\274\207pR\320\356t<\211|\f\255\362\221,\363\021\\\336\2542\326\273\365\357\302\272G:yY\317\343X\270\205&U\r\273\351\247\225\003\357{\310}\355l\020\361\373\205\365\277\304\240\027\275\373"
+	.string	":\250<\204\233@W\030\256\024\006\275\002"
+	.string	"uCa\260C\201\271Z\026|\2220J\240F\364!\220\352\374r\240o\003\030l\007S\374*\304\333:\376\372\032\247\236\246yF@\373t\276Cu\262\206=\314\217\316\236"
+	.string	"D\313$x\245\302\313\025\216\334c\b\356\216\210\245\017\320\250\367\004\374>\207\037Y\227An\320\356?C0^\313]\024\254\376\272\314\347&Or\0361\0020\355aS\336\216\25332\270\251\256\355\224;\206\017\266\372"
+	.ascii	"\356\353\030\224\236\216x\372\3414H\257\234\201\205.\177\223"
+	.ascii	"\334\356f\212\355\220\037\320\310\363\260\006\t\234"
+	.string	"\361\276\205\333\376S2,\254q\252\236N\347\207D\372`\340}\363\313\374\033\351Y\275\0235\037\266?G\234\3733\265\004mk\\\313\346!\177\234\031\262\017\260/\340\377*?7\020\244\036c}\326m\332\323\206\332\347\353\272\313\373\271N\032.\007l\275\\9\003\320\255bG`>\204\257TD\271\001[T\024\335\037>4d\013<\341:\225U\236\006\214\264\270\352:i\333f\223\353\337\303O\356]a\355\t~x\304\361C\3315\324.0\356\316z\332\375=\265\255\256^\200\264{\315\324\3331\233\013\255\274\b\220\371\024_\365\227\373\233\361H\267\317\"|`\377_\262\335\224\302\035I\355Orz\214\335\204\316>t\272\034\377\353\006\236w\363N\347{\001>\320\307\253\354\276\026\261I\360\243\242\3543p\022m[\216\353\036C\323-Xs\275\273\3064\031\222\317_\273[6'\033\317c\331\3309$(\3364\371\324\346"
+	.string	"\230+\220\237q\367NJ]\270\330\265\373\334\352\3474\373\035\247\\Y\234T1\263\213\033\r\2279\004\275`\351\032"
+	.ascii	"?\300\330\373\253\007~O\340\376+\365\2415S\"\362\334\020<\372"
+	.ascii	"\373\300\207\256N\030\005\275\301[nko\224\031\036\234C\3064\313"
+	.ascii	"\006\233^\r\361\033\303\372\3633\027\337S\\\3540\335Y3\217\003"
+	.ascii	"\037\253\373\204\023\312x#\356\213\3633\273\375\003\343\rr\315"
+	.ascii	"\224m\312\036\221%\307\fz\023a\n\312\354.+\327m\360\244_\217"
+	.ascii	"\335\215\317\241\213\n\006\250\234\020\367\217\242\177e-zN\\"
+	.ascii	"\\|.\223\375Z\177\272\330e\247Y\275\270\272\332_\234\022"
+	.ascii	"\335"
+	.text
+	.section	.gnu.lto_.symtab.1a39f81bc6e719fd,"e",@progbits
+	.string	"frskyOsdInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"frskyOsdIsReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"frskyOsdUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"frskyOsdBeginTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"frskyOsdCommitTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"frskyOsdFlushSendBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"frskyOsdReadFontCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"frskyOsdWriteFontCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"frskyOsdGetGridRows"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"frskyOsdGetGridCols"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"frskyOsdGetPixelWidth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"frskyOsdGetPixelHeight"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"frskyOsdDrawStringInGrid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"frskyOsdDrawCharInGrid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"frskyOsdClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"frskyOsdSetStrokeColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"frskyOsdSetFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"frskyOsdSetStrokeAndFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"frskyOsdSetColorInversion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"frskyOsdSetPixel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"frskyOsdSetPixelToStrokeColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"frskyOsdSetPixelToFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"frskyOsdSetStrokeWidth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"frskyOsdSetLineOutlineType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"frskyOsdSetLineOutlineColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"frskyOsdClipToRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"frskyOsdClearRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"frskyOsdResetDrawingState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"frskyOsdDrawCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"frskyOsdDrawCharacterMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"frskyOsdDrawString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"frskyOsdDrawStringMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"frskyOsdMoveToPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"frskyOsdStrokeLineToPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"frskyOsdStrokeTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"frskyOsdFillTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"frskyOsdFillStrokeTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"frskyOsdStrokeRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"frskyOsdFillRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"frskyOsdFillStrokeRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"frskyOsdStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"frskyOsdFillEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"frskyOsdFillStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"frskyOsdCtmReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"frskyOsdCtmSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"frskyOsdCtmTranslate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"frskyOsdCtmScale"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"frskyOsdCtmRotate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"frskyOsdContextPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"frskyOsdContextPop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"uvarintEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1a39f81bc6e719fd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
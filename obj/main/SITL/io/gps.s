@@ -0,0 +1,2813 @@
+	.file	"gps.c"
+	.section	.gnu.lto_.profile.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\326\t\005\037"
+	.string	"D\036\312\n"
+	.string	"N"
+	.string	"\326\223\366\324\t*\002"
+	.string	"\002\001\002\003\002\002"
+	.string	"\001\004\005\001\352\263\360\321\b\002\003\240\342\234\212\n\004\005\006\007\b\t\322\340\376\252\003\f\002\006\002\006\002\007\b\002\b\n\013\356\302\211\306\b \b\002\b"
+	.string	"\002"
+	.string	""
+	.string	"\002\t\n"
+	.string	"\f\r\260\312\257\333\003\f\002"
+	.string	"\002\013\f\002\013\016\367\252\271\276\007f\002\f\002\r\016\002\016\002\f\002\f\002\017\002\020\021\002\001\002\021\002\022\023\002\001\002\023\002\022\024\002\001\002\005\023\002\025\002"
+	.string	"\f\002\f\017\020\021\213\326\277\344\004\022\024\025\251\253\376\231\002\232\001\026\002\026\024\002\024"
+	.string	"\023\027"
+	.string	"\002\004\004\t\026\027\030\031\032\033\334\307\272\354\tt\023\002\023\005\002\t\034\035\036\037 !\"#\336\261\231\314\n\222\002"
+	.string	"\002\030\005\002\031\032\002\030\t\033\031\034\002\035\036\037"
+	.string	"\002 \n"
+	.string	"\002!\023\002!\002\"\002!\002#\002\035"
+	.string	"!\005$\207\245\203\341\004&'\315\343\200\255\016(\303\256\201\375\017)\223\222\223\260\0076$"
+	.string	"\002%&\002%*\371\335\301\245\t<+\265\244\343\267\f\002,\307\333\345\224\001\002\002$\002\035-\370\262\277\340\b.\204\303\374x/\262\273\233\244\013\n0\306\311\227\362\003'\002(1\360\237\325\371\006"
+	.string	"2\322\277\262\337\n\002\002)\002)3\315\343\301\244\0134\377\331\231\340\001\020\002*)\002)\002+\002+5\331\254\373\355\f8,\002,\035\021\021-\021679\331\351\335\210\001:;<\327\351\362\306\016\022-"
+	.string	"=>\354\263\203\222\001"
+	.string	"?\242\365\310\247\017\f\023\002\023\021\002\021@AB\243\334\230\230\023C\316\271\204\323\t\022DEF\233\336\363\315\r\n\005GH\212\352\333\304\013h.\022\033"
+	.string	"IJKLM\303\222\355\327\004N\376\253\235\261\tOP\240\342\234\212\n"
+	.string	"\201\024\250\001:1\021)%\005)\264\031\321\004L*)Y\231\007\022\200#:\016\351\f\202HhD\222\222\224\224jL\007A\341K\351\360"
+	.ascii	"\037ci\360\353\027\247\203\007 \256\"K\3463Y\261\237\204\032"
+	.ascii	"\375\223\253>\210\202R\271j\261\214"
+	.string	"\345`I\2110\307/\276HsO\255\201\016@\252\021\331\270w\031:S3\214j\324\017^\241SBr\356\0305\306\031\262X\252p\3408o\365Q\207^\300\370\026\262\215\207\024\017\tR\230\304\330.\327\216$\024`\216\275\004\323\373\303l\243\006)\260v\237W\365\250\310s\366qe\025\202N\310YXF\267\245\315\246\336\260PK\003-\336T4\251\325\305qDmG\330\304 \352L\302:\242\006o\3064x\374?\\\275\034\236J\204\227\331\037\357Zh\302>\2028\301*\031\340\320\373\360&\033\320u\227\350\315\022\275\r=2\302\253A\257\241\311j\277\341x\230O+\337\356\326\234\305`u\377\353\213F\\\236K\210\026r\373\345\341\371\370\302\025\267lD\376\347Y\353gX\354\216\335\212_q\0316\351W\250\255k(\331\322\375\345\220\033m\231\027\277\270\302\021\322\350\334`=c\301N\301\270_o\035\r}\330\201"
+	.ascii	"\"\006\233\211\337;f!?P2\006\016\343\365\202-o*\020\255i\243"
+	.ascii	"\360A\323r\"C\272\212\314\253\236\3335\261_\031\252\030~\331"
+	.ascii	"\334\277\006\211@\356\372\262\307\372\036<\331i\f\250\234\272"
+	.ascii	"\257F\222\261\266vp\263\316|\016w\357\n|/\336\265\227\250\232"
+	.ascii	"d\202\324\270\\^\303\3741DZ\366\265\211\034\007\236\247\207I"
+	.ascii	"\205m\212\241\210fg~\341\340\317d1C\315slAF\030eiX\227\177x:"
+	.ascii	"\212\272\370PW\206;\3679\3028\350\263\241\036%\2667r7\3239\273"
+	.ascii	"/`\315$mG\360\236\023q&\343\031\211\314\3171\232'\013\n"
+	.text
+	.section	.gnu.lto_.ipa_sra.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\345\006"
+	.string	"\022\210\030\"\240)\215\001\377\377\377\377\347\301\322\377\337v\231\331\321\233\337\312\267\326\"\326:#}B.q[\312\224\002\252^\241\350D\022\201<t\207:\300\\\252\265\332X\314\314Y\321\313\311(\273i\314x\361\370\273\252w\214\\A\235\t\273\021\037\f>]x%\350I\247@\275\003\346\251\006\330\337\240}=+y&9 \200\002\251E\334LY\3408\013\214\204\200\267\216\21101\202"
+	.string	"\343\026\f\bQ\207;\177F9\2003\325r\300\361E\340\306\003\234\205\225a!\267ng2I\007x\032f\242\2615X.\243\245\247\330\\\221\303\035C\325\230"
+	.ascii	"n\r\023$.\222\021\244\272\203q% \217\253\r\311\244\300\261-i"
+	.ascii	"\013\254\306\330\262W\244\220qh\272\220\333{C\264$\0244\340\213"
+	.ascii	"\0137\004"
+	.text
+	.section	.gnu.lto_.inline.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\321\t\335&"
+	.string	"f\265\265H\240\330M:\300\313|\177\312\267\343\346\202\303\016\317d\315\3360\271\375\031x\235j\205\007\347\013jO\237\354\233\317\361\024@\250i\254\2377\363\024\306\007\247\340\204\340\301v\312\031x\206\300h\2023z\332\365\266\210\220\266w\222)\227"
+	.string	"\234"
+	.string	"\252"
+	.ascii	"\366\216\251\357L[\234\256j\366\357ZH\242`\020\270\355\334w\327"
+	.ascii	"\373a\0229UY\2111\355\324\247<\007\3232\202\272\251\351o\036"
+	.string	"\331\332\n\023\301\247[}\312\233\3011-T\353\233\3354R\204\b\311\032\347S2\347*\304\272~\334\2244%y_Jb\"L`Z\232\366\346\022\324\224/\322\245y/\326Zg~\351\353\324\365}\336k\255%F\233D\2555\310\276\371u\272\306\313\flz\302\267\346\273>\366^\231^\240\244\221\346?\036\275\037>#\213\354*g\313\270V\025^\301G\365\314\254\242#\260\215A\026\360\275\001~SF\323\230\327^}\177\223J\n&\241\263\324n\013l\001\364f\367\233\034\"5-I\017\227\262\344\253iF\326rVM\313\234\233\226\273/9)\203\261\246;\363F\330\216\244\231O\357\341\\@a\216\365V\363h\035\340\261H\234\316\351\306\342\034\020bj=\326\027^\251\325=\304\332\017\026\310h\324]\304\322\274\276\307 \203\202e\300\002\326kj\3736\263m\226\244wNI\2737\021\214\266\307\257\355\351\375)x"
+	.ascii	"\343\f\2153\274\275\266\031W\016\230\346\211i\313\216\030/\265"
+	.ascii	"\n\335,\241\236\362\274F\310\365&\261V\241\322\020L\334z'\253"
+	.ascii	"\261\005e\363\203\332\362\346\375\005+LG\315\016\200\243\335"
+	.ascii	";UT\017\261\021\367\020\027\261(\326r\203\351\305\031\002\260"
+	.ascii	"\035C\023\032\205\b\353\n\016wS\024\037XLe\0068\303\365}\250"
+	.ascii	"\253\n\221)\365!0]@\216bM\314xGM\232\334\235\310F\220\212\273"
+	.ascii	"t\331\341EC\256\302n\234u\206j'F\3337\2137\246(\255\327h\027"
+	.ascii	"7w\037(\271\377\360X\240\027c\356>\246^\337\034\013JBt\030\313"
+	.ascii	"x\203F\273g\3528\021\256\355m3\347NA\245.\237GM\236\236\326\t"
+	.ascii	"\005\020\227\372B1\265G\336\260\326P\326\205\265Dwc)\303\201"
+	.ascii	"4\343\f\337z\322$fS2\345\203F\315\030l%ya\275\026\252\225\025"
+	.ascii	"\227\020\315\355\351\233)\252\204O8W(\001\354\222;\275\331\303"
+	.ascii	"\b8\344\340\2628\263m\363\r\2626\3671\220\213\321\346?\236\236"
+	.ascii	"=\307\221\243I\314U\244\r\215q\270\322f\236\223\244\257\263H"
+	.ascii	"JMZ\320Xp\001\2052\266\235\247\236=\263\310\212\0138c\035\225"
+	.ascii	"0}'\326Zk\236PO\263\220\264\254\320\\\263\346\231[B\247`\031"
+	.ascii	"\244\001&\200\370\250a53#S2\")(H\222\306`\002!5D\325\003\021"
+	.ascii	"0)4\210\031\231\031ISP\3100\006L\211S*\334\002]=-9=\262;\354"
+	.ascii	"\243\365\365<'x\344%\262\252A@\246@\255R\216\330\312#\031sz\037"
+	.ascii	"\247\321\362\245\003\322\303\302\3045\201%\226\022cT \311jB\314"
+	.ascii	"\024\2504|F\211\035\306\314"
+	.string	"\306q\377^\350@\n\"H\033\020m`\3578\327cJx\fcp;\215\033O\332\213\301\2653@\274~\354m\300\264\230\333\363\026\002\347\220\244O(\346X,^\204\353\316\035\374UIuL\201\224\225\373u\266\204\264\002\330x\247}C\232r18\272\365\231t\270\334g\343@\316H\r\026fs\t#\330\0306\370\026:\254.\260\233\336[\f\351C\230\302\211\370\353N\027a\2123\370\265\035\320\236\027i\024\223\265\250`\376+\255\374Z\377\247\204\302g\2550D\362\205p\300\337\032\325\003\254\252#\311]|\254\252U\t\327\344\231c8\250\260\303|\235`1}&;\377\215z\307\301\251\241\347Tl\030}\250\315qXzS`q\240\036\355\352=lD\006\275\343\337g\235\354 \245\301\264\312\r\336\364\f\336\317\372\317\253\326\004\\i\3655\361\214\236v\375\314~\363>\312\351\331y\347!#\226\357\320\272\0134\372"
+	.string	"\272\270\371\344\020D9\245$8\021\306\t\270n\302\033\034\037\013"
+	.string	"\270\006\200\363P\247!T\b\237\017\364\017\3247\230\356 \236\316\\\372\242\202\2367.\024nR\366\241<\366\311\021\335\201\212\302I\244\343G\035\211"
+	.string	"\311Px\301\034(\\"
+	.ascii	"K`/\031_\004'\367\330\035u\224\374v0\355)<\203\231\030P\004\262"
+	.ascii	"\371\030;QkC#0\272-\030\nl]DFZ:O\337\302&UI@\342\017@\3049\006"
+	.ascii	"\350\232\317r2'(\340U\016?\322b^\222\325  |\207\213\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`n\007U\026"
+	.string	"v\334\\@ q\223\016\033b\177f\005\311\307\260!\001\335\303S\005\020x\252"
+	.string	"m\303\237\353\374\206*\0312P\220\304@\224\304y\006`h\315\210\245\365@\033B\365j\374r!\001x\214\217\206\364n{\247\224\002@"
+	.string	"I"
+	.string	"L"
+	.ascii	"\367<\233=5\233\316y\236\037\032\227\260I\330#|7\357\f\361\334"
+	.ascii	"\353v\323N\021\357\276\005\274\tN\002\261\377Qg\316\273Q\355"
+	.ascii	"Fn]\346\231y^\317\367tf\333\016@{\233\335\220\236\264R\025>\207"
+	.ascii	"\367\266\346\354\360\316\361\333\224;=\274\377\316\017\357MO"
+	.ascii	"m\023\264..)\255\210T\234 \236\033\215\320\233\214\353S\214\353"
+	.ascii	"\022\213\353\257\241\270nL]\247\311U\361\016\222eY\346\354H\257"
+	.ascii	"\020\f\355\246iW\354\302O\336\002\242\326\255\210D\032F\376\371"
+	.ascii	"8\352Y=\251\327@f?\3179\235:\263^\362nL\307{\332\330\216\367"
+	.ascii	"\340-\235T\362\337\216\031N\253\240i\233\300\252%\031\221\214"
+	.ascii	"\256\"\261\020\310\r\022\213\0214j\263q]\274\312O9\203\267\327"
+	.ascii	"\326&\002\365\320|\"\025\241\005C0\306\316\307\262\240\005c\201"
+	.ascii	"zh\256\016\025A0FxE\013\245\202\005\n\007\006\3240\374\203$T"
+	.ascii	"D\004\245\215\320\026\302\313\313\213\026\016Z5h\341\202\f\316"
+	.ascii	"\004b3\262\245!W\303+0\033N\221-\005\265\330\r"
+	.string	"\f\007\226\243 cZ\200\023\016\200\235\250q\301B4T\222\024\2621\007P\002!\006\251\350\001\022\340\222A\210\3049\352\214\021\314\214\210H4RZP\220Js\034D1\276-\262D\226\227 n\030\323\325\226\3048\312\371-\001\256[\005*,w\344\320}\231\327N\013\fm\033v\260\013\264\245\367@ \350\223\365'T\254E\2162<k\342\365\226H\t\303\251CI\021\314\037\377\355Q#\004\206\027;\276Up\342\206\264\345\305\3744\200%\241s\3628\254\024\363\020g\264r\272\353\"/K\013\353\225\316\361\031\2631\\\204\310\271w\3046X\260\rb\204\027:1\233\\S\226\037\013\034nH\351@\022u\001\242\305\346\230\2069\314\200\212;\036{u\311\365\311\245YZ\\\304-\026\300\\!\326q\256\321\250T\355e\022wppn\251\350&I\341V\344\251\344\242\"\241\353[)\350)rH\026\f\2464\366k"
+	.ascii	"\035\323\321(\200\2326\232\200\007\200uGO\002z\227\354\333\375"
+	.ascii	"\255\220\256#\253oC\341\375jz\022Z\201\260\254\341)\013\364\314"
+	.ascii	"E\306\377\370 \rL\207\032_\2047\240;\203\022\fa\234\r\030c\317"
+	.ascii	"C\370\335\337\313\003%U\033\334fM\212\213\220\200]1\221\331\313"
+	.ascii	"\030\364\005\204\027\327\355\001"
+	.text
+	.section	.gnu.lto_.pureconst.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375 Vm\002"
+	.string	"bE\022\035pe\322\001L\377\0206\377\373\377\377\377\036\313\324s\315\002"
+	.string	"\200\027\207\002\007\204\370\331\001\003\262\213\335\353Z\267\272\324\235\256tF\027\272\317\3179\2337\346.W\271\311E\016\034\3278\335Y\234\3049\374\2043\370\241CD-"
+	.text
+	.section	.gnu.lto_.ipa_modref.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\233\001M\t"
+	.string	"b\215&'pM2\034@p\377uz\235v\253\337\365WSs#\030\314\304{>6$\344q\fk\001[\221\\o\261\311\336R\2467@6\236eE1\361\222rI\273\304\021S\2433R\036\351\204\252\236|\270\013\025\207Z:\347\234sj\247\334\351dMZkm9d\2243\374<D9\244\013\316+$\020\341?x\003V\336{\035c\314\213\362\250\340\250\211\3409Z\371\2303\266\336<Y\224\377\002\025m\312\2332v\342\314\245\264\006|b\354\331>\031fQ\232\002\3709\277\361\201\327\327#B\250\361L\311\324\214H\222\264\006`\2021\225\305\003\021\240\251&GSP\311\264\237\001\307>\363$\345\335\307\266\233A\030\367\211\025\253\0329\013t\211MgV\362\030:\260\254\2619\366\365U\367\266\223'\311\231\241\300HHm<\334[5\234\021\357#&\362W\006\"\263\246\220=Z\277\310k\030#"
+	.ascii	"\347^\006\221u\202\241L\313]MV\340\202,\034\026\206Q\330~\026"
+	.ascii	"z\016lhV\351\366\351\315\341\b\214\347W\224\324\230[\264\336"
+	.ascii	"<\n"
+	.text
+	.section	.gnu.lto_.lto.f641a502402869e3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nmeaParse.19.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\271\002\365\025"
+	.string	"F(\216J\300\224Q:9\272\221V|T\261\312\017u\246A\230\\<=z\330s\233\262\002\276B\211t^\217\320\307\337x\343\257\277\233\246\347\240\212\303\3425\333\246(\206 !J%$\034F)\310\214pF\346\352G\377'd\023\"wJ\001z"
+	.string	"q"
+	.string	"}"
+	.string	"\225\267b\004\344E\363H\333~\211\233\230\231\026\362\214v'\033\222\340|Fj\345\271R\216B/\206\017@/n\207\323N\216T\fw\322\374\234\223\343-7\216/\275;\270\361"
+	.string	"\321\360\023t\nt\221\265\333\tSj\255\377\335f\030\266\254\330\271X\211\360\021B\265\323\231\033\242\350\220r\254\035.L\360\003H\344\275\317\236\235m\316\361\245\326\352\231\333\375\334\250\333\266`{\201={\0047T\334 \035\222^\r\235\351d\363ls\213\354\207u\211Zt\232E\247Wt\272\204N\253\350t\312\323\250\363\376\361J\367\206\323\223N_@\n\b\207\201\246Zu\301$\365\206\b\343\203\357\373\317\346K\336]\320H\255Uec\253.\336\236\331*\333\341\264[\030\314\256ts\223j\313\341\303Tk]\261kN\373IG1;\017\347"
+	.ascii	"j%:\302T\003O\254\215Q\0368\213\257\226\265g\312\020\334\021"
+	.ascii	"\262\251 iZ"
+	.string	"\022\267\310\255\227t\265\021z4t\246\223\314\201%\271\332\005\322D\"\251d_\224\253\035\317\005QmjK\366\277\237\f\301\001\331f\320\342\252\326\023\367\364\237'\274\205S{\301G\210\320\t;E\021\033\270\360%\375\236C\217\207g\276\242$k\255.\276\212\030\005\322\303E\037\207^\374\0228J\252\315\340\347\214\233\016\304n\221\025<0\227\301jd\257\030\265\004\226\027l\206\346AM,\306U\312\270hd^3.\030Y\215\213e\200\313\030L\346\252P\2262\227\212W{X\227\3101 \322\210B\r\001}\250O\243\273=\266w\375R[\033i2\347\216k\277`\346s\250M\271m\216\305\235\373\336U\224|6\035)\236j3\350\035\3013\3444Rq!|\306M\001\243Zk\203\377\f\273\214\230\326\216\213.G\030V\333Z\352\303\0057 0\002bH\332\035\177B\357\032\034Ah\347\367\032\243_]n5X"
+	.string	"\"\274>\202o/\202G\241\351\262\356-\312Z{h]\371\224\202\344$,\205Z\372$f\304\260O =\031\201x\244\013\036\205P`\374\273\253\267\354\205\204w\351X\222\243"
+	.ascii	"Y\205=+\"\306\346\333\220\314\341i\005\216\354\236f6j\354\205"
+	.ascii	"\215>\333\210 ,\323\004\241\004tk\260\365\006\335\003\275|3:"
+	.ascii	"V\243e\226g\255\023\n"
+	.text
+	.section	.gnu.lto_gpsPacketLogChar.38.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375 <\341\001"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\203\316\221\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.text
+	.section	.gnu.lto_gpsInitData.56.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\265\001\375\f"
+	.string	"$\024\201\001"
+	.string	""
+	.string	"(\001"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\204\305\376Q}\273\001%\206\b{\by\275\006\035\001\001\004\005\001?\202\210\200 wu\300\001s\277\001q\276\001o\274\025'G\206\bm\330\375\001k\303'\\\206\bi\bg\305\006\035\001\002\003\310\001s\307\001q\306\001o\304\003\005\001'\177\230\375\001k\313\224\001\315\307\001s\310\001q\316\001o\314\002\005\001'\267\001\330\374\001k\321\314\323\277\001s\300\001q\324\001o\322\001\005\001'\357\001\206\be\230\374\001c\326'\205\002\206\ba_\330\005"
+	.string	"\333\001s\332\001q\331\001o\327(]3\334\0014\325\001\320\001\317\001\312\001\311\001\302\001\301\001"
+	.string	"\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"!$PUBX,41,1,00031,9600,0*16\r\n"
+	.string	"\024$PMTK251,19200*22\r\n"
+	.string	"\",0*2338476576CD\r\n"
+	.string	"\025115200*1F\r\n"
+	.string	"#,0*1E\r\n"
+	.ascii	"/  \243)\362\005\002\300\252\376\322\021/\270W0\356\"\\`/\005"
+	.ascii	"c\343\224\374\025\250\361\037\301\315\324\326\3124\201\016S\363"
+	.ascii	"\005\270K\367ua,w\373\352\303.\031hL\220u%\2147\035\352a\214"
+	.ascii	"\254n|\304d\007jj\017\253'\2513\246\313n\334\331\254q'\364j\002"
+	.ascii	"4\002"
+	.text
+	.section	.gnu.lto_ubloxInit.57.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375 \306M\004"
+	.string	"2G\032&\200K\322\001@\\d"
+	.string	"\243\316TOb"
+	.string	"f\340\031C\214\3244=.\tT\257X\207\232\356\332@5EH\333D\246\020\313\275W\267\247\271\36704\222(\030\242\021\2651\240\346\002\320Ui\2633\310\274 \370\002\314%h\316B\234]\3166\367*\322_\375'\356a\307p8{*\220\031\343\323\324\334\353\344\310Z\324\224\337\t\r"
+	.ascii	" \023\220\t\310\004d\r\006\001\231\200L@& \023.\271\242\030\233"
+	.ascii	"\323\256\001\024\001"
+	.text
+	.section	.gnu.lto_ubloxAirborne.58.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375 >\335\001"
+	.string	"$\003\004"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"'\002\002\177"
+	.string	",\265b\006$$"
+	.string	"\377\377\b\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020'"
+	.string	""
+	.string	"\005"
+	.string	"\372"
+	.string	"\372"
+	.string	"d"
+	.string	",\001"
+	.string	"<"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	"\034l\002"
+	.string	"\002\243\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_gpsConfig_Registry.63.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375 \227u\004"
+	.string	"\004\bi"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\203\367\203\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\006us\250\364\005uq"
+	.string	"\005\001\006'\001\034\005\001\006\035\001'\001\036?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gpsConfig.65.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375 S]\002"
+	.string	"\364\003F"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\177}{\001\001\005\001\006y\001\005\005\001\006w\001"
+	.string	"?\202\210\200\310\001us\300\001q\277\001o\276\001m\275\001k\273\001i\274\001g\273\001e\273\001c\273\001"
+	.string	"\004"
+	.string	"@\004\334M\261z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_gpsInit.68.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\022\b\r)"
+	.string	"ZI\334\017Dp\\N:\377Up\361\262\20680V\332\257\302\320\267U\225\262\0276*\225.\352d\317\".\034:\356\366\007\222%$\2540bi\326]\004e@Q\323]0m\241\306\254\226Y\026\343\205\361\326nB\244L2\354"
+	.string	"\340"
+	.string	"\356"
+	.string	"u\265J\335\375\251ke\031*\037\373w_f\342\r\354\210\300I\235{\271q\327\2679^\334\322K\216V\227Z\253\357\345n\216]\337\313>q}\373.\027\243\037\333\361\0325\025$\005\247\226\247\326\342\204\227\373\240\367r\213'0_\366.`\276\\\272{\347\305'\365fb<\276\330\325Z\177\315\265<\246\027\n\352\361|s\250$\233\351\236\351B\306\223]\\\342\202H\nWfn\3166e\204\024\360\246\245I\357lSWP\314\353Y\335w\342\221\272\354\342\230T]}\002\260b\365!\222\203\030X\327\331\246\220\220m\004\243\306G\025\305%\231AK\017\264\263M\035!}fu_\2772\205\305$\006\264\265.|\230Ta\275I\fgTiETO$Q\226;WN<\377\240rb\346u\250\265.\013\251\252\276D\337]8\273ka\227\027\027\304?\313\214\2255\247f\332\375\207\243\307\371"
+	.ascii	"g\313\r\030\035\203~\331\"\275-\211\215\365\b\345\022"
+	.string	"\360\276,\204\b\276\220A+\250\232[sz\331\216\270\332\033\336\261\315\202\371\262-q6\3005/;\231\346\354N(W\200\t|\331\314\t\177\361jR4]\270G\3634'P\244\330\247\230*V\360\205\313f\254\326\242\232i?\346\273,^\206\214\233\233]\322\334m\361\264$\264\362\350\006v\340\334}\3613`\321\223Z\253\206}\230\233)\355\275^\256\f\032|!\215\371\362\304G\300\242fG\327\304w\273E'\356\341\2314\251\342\366\326n\363:h\336\006\315\313\340c_\243\036o\021\217\227\250y\207&\257\257\344\025\232\274A%o\257\344\345\225\274s\362\226%/Y\3626\311\313\315\373\013\377\252b\027\027\"wM\230\212\016\177Ovq\360\024\3452 \247\326\247\r/\227\205\260\024\355\"\243P)S\312|9\373\3275Fv\331\347\021\b\b\260\367\203l\036\335\236\2601\262\326Zy\032\330\330@\361\365\226\230\373"
+	.string	"\026\350\021\204\245\316\216\316(-kn\366p\3776\313\332B3\324[\344\201\263[\001\027\027\2627\335\273/\030\n8\200\237\204r\007N\262\273u\244\341\211\322r\342\273n\243c\fS\366p\277c\032\365\001\256&\022\230O\255\314]\372E\263\360\205FT\314\020\327\236\232i\215x\240\332\220=|;z @\r\372\307E\272\237>\307\006\307\035\361\272=|\334\022\237\223;\006P\363\341\326=\344\323\260\311\355\202\f\356\211\373\354.\335r<4\254W\353\223\206\275\235\337\241\\\250\030%R\342|\311]\036\355\204\215\275w=\234\316\234F\333\020\"\372\001@%\0305\202G8\226\202$n\330"
+	.ascii	"\022mR\205\0336\200\277\240\322\257\206R\013\032\277\244\245"
+	.ascii	"\033\277\n\0036h\343\305\322\017G0\270\364\363\025\233\336[\333"
+	.ascii	"\241\251\235\214BG\254\205\2638\350\033\027\211\277\370\212\321"
+	.ascii	"\201qG0\025\236r\343\226\340(\300\"(\306C\300\242\206\354\355"
+	.ascii	"L\016\202\0349\272\240\340,\352\033\333\226\314\265\301\025\365"
+	.ascii	"\262\023\346\n\356\275\226:Q(\250\371\362v\204r\034xO}\314>\375"
+	.ascii	"1\207\372\367=\r2\271\236\250w\251\024\245\342\013\213\232GW"
+	.ascii	"\261\232i\b+\241D\210\232\353hI\211\301Z\324\252\267\214\204"
+	.ascii	"\263\250\221#4+k\276\034\352\273\201+#\324>,:\374\335\f6B\271"
+	.ascii	"\376v%\324\277\353uP\021\"\275n5\257*ZbQz=\354\331\275\207l\316"
+	.ascii	"\023\367I\302C\350\260\307M \350\222^\255\225\327O\203\033k\342"
+	.ascii	"\200\216\250Q,\005\035B\f\231\210\004i\222J:\240\002\021!3z\021"
+	.ascii	"\020\245CN\261\022\325R\271\032\322Q\255\375fL\277\306\201\370"
+	.ascii	"X\033\212\017\246\216\214\366\355\274J\200\307\217\3722\276\224"
+	.ascii	"8  \327\260\244H\251C\316\227\263*\276\255\325O\b\222\021\221"
+	.ascii	"!\f;\210\025\3325\022\fK\207.W@3q<\226X\272\361\024\363\005\235"
+	.ascii	"\207q\034\362f\213\006\321\231\364\356\026\213\n+\236\242S\236"
+	.ascii	"!\273\265\033\035\332\034\304nI\372\036%\r\214#\202 \272]\245"
+	.ascii	"\205^\236*8\371oU\037\246\3303$ \257 +>\315\326\217\354\324\270"
+	.ascii	"z\013H\2105\230\271\273\2617\306\177~\033\240\037\257\n(V\267"
+	.ascii	"\336\261\2746:\027U\206\227\001\3024.\217\351\250\t){{\323\376"
+	.ascii	"Ey\003=T\335\003q\217\226$lJ\330\351M~\224\013\fmM\0033\"|\211"
+	.ascii	")\250yj\032xQ}C\263r\353\353\275*\212\241\336\225\261\035\277"
+	.ascii	"g\001\377\013~N\353=\234\004[A\351\334J\334~u\352\354{\351\031"
+	.ascii	"\r\236\032\344Wt\b5"
+	.text
+	.section	.gnu.lto_gpsInitNmea.69.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\224\t\225,"
+	.string	"ZL\254\020D`\346M:S\264\227PF\213\347:\227M\232~y\204\r%\257\220\304\245\251h\270\223\357~f\315\034\374i\333\334q\037\352\223]'\273|\235\264q3E\341\020\245\033\354\005|>e\367\324\236X\262\311\226I\006\354"
+	.string	"\351"
+	.string	"\003\001\315\274\263\231\3106\247g\363\356lFm\263=\233\317\263\271\236\315]\233\377`\311\220\234\017u\367\352\2503t\335\254\232\261/\317\274\323u.Gc\356\261\214\237\261-\322\365n\231e0\367n\373f\334\343k\371\226\341\227\302\224\210L\301\244\201\305\335{\306\340\226\235\322\333\002\007\242\267\347\221\320[\0362\363\371\331\327}\232\222\206\227A\367\336\251\312\344\303\033\375|E=\036Q\272C\355Y{\310'\336\b\355O\376|J2$\221.\352}\016r\310\311\220B\232\027\204\210\371Nc\323R\226\356>\007\331\325K\322h\364H\270\212\334\236Pqi\002\375\222\306\023\250\343\311\261\227,\366yB)\337\360\370%\267N\240\234$znv\003d\310\"]\201\360\222Z(\260\211Z\330\221 \213\324\336E\270\367r\037\223\\\347\2433\037"
+	.string	"3\213`&\032\020i\233\263\332f\333\334\322\251\262\t\201pk;\265\266\262\256\254\256\343\2704M\267\263z\361\356\355B\264\326\031]\332\266\232\020wu\252\265\266\035#\024-\266:\033\341\232\256;\265\265\271_3\2338\321?:U\240\21767\255J\344\247]\211\315\215\330to\242\326D\255V\2573|4\225\373xo\260A\271F\310\360\3130\237\364^\342\225?\001\364\266\223\2561L,\356\336\373\3641|e\372u\221\367\354>\365\214l\365!f\276z\030\024\351\275\267\212\377\345`R\360\305n\031\213E\377\310\002\275}\275\331[\314\211\230r\3132\253\353\230\317\264\272z1\277\326\325\325\t\342\252\204\371l\206:\233\237\234\276<7\235\315Lg\363\222mV:\233\201gs\222mF:\233\003\240\315"
+	.string	"j\363\021\332lT\233\177g\263\357l.:\233{gY\024Z\007\2124\307\257:(\312\225-{\325\313\3278\372\206\257\332f\237\246\266\3215\372\360\324^\324\253M\265\250\215]\354\325\235\332\236\246\n\374A\305\314o\366\324N\226;\027G\364\013\350\231l\241\211\027\372*i\273\"\367T\317d\253\037\242\353\346\361\317\231O\265\211\013\320\233\021'$\234\3331\337\\\221;\3633\371\352\202P\374\276\0021\217`\312Z\227\2671\177\250\336\312\204\245<9@vNTy~\204i\034Q\265\315:s\313\001\375\263\363\301\220"
+	.string	"\356^\343\217\031R\243\002\005\314\033:\344I\253-\326\021\300F\312r\367\005\350Y\245\234\024J\323r\341\320\352U\341\204Kpo?\376\371\205(Zw\365l\032\225Z]W\207\016Zm\023\316\334\022\330\b\316.Dme\366\360\241\177\344\002\305Jd>\234\307\201\301\027c\020\"D\240\267\266\332\"\034\004=\344\004\331\352\305B\364\2543\272\340a\036q7\302\314\3639h"
+	.ascii	"\025\254\212\n\006\243\03401\317\367 \b\025\214\242\212\202\020"
+	.ascii	"\025\f6x@E\025E\025\025\fRU\340\320A\303\001\0021\260TT.!\345"
+	.ascii	"b\305\211)\254\253)\025WV)\246J\264p1%\225\304X+L\264\230z\201"
+	.ascii	"\205\325b\252w\226\365\363F\310\252Z|1\021\210M\367\363\336{"
+	.ascii	"\215:\313Bc)\203\252Gc\253\266\322U\320\240\320xDKi2\213\306"
+	.ascii	"W=\326O\320~L-\326aK\225\251\301\372k\251\332f\240\262^2t2\034"
+	.ascii	"K\215\024\024\334*u\022\245j\213\3159\037\236\373\252\324XX\021"
+	.ascii	"\260\217\264\221\244\nle\023I\252\266)\027\240\"u\020\244\232"
+	.ascii	"\004\026\242\273\206QRn\037\375c(\345\034R\031Z\031ZAo\003\324"
+	.ascii	"*05G\025\300\260\254y\f\263|\r\356\336\255*f&\321;\206["
+	.string	"\316\374\272w\013\302-w\262\271\206f\247\204\t(\177\002z{T\277\206gY\215\352i\034\n\200\261\250A8\252\0304E#RRP\220\244\305\320\002\021!\"\326\001\021\320(\205\034r\206\306&%\2054\006\0308D\310V\204\305MR\340\277h\251 \267\337\255\007\276m\353\025\331~p\326(\215\3766\374~iu%\324Gz[5M\371\2070\022\203_[\277K\334\357~z'p\316(\337\365_\211\305\216X\231\207\360\250\301\2239>\233\365Er\260\276\201\242\326%Ve%\\\304\002mI\220\357qH\006\001\032\345[rb\346k:\237S7\311\230\306\021\020\212~fs\261\374)\203\374\t\240\002N\307\271i(Z&\341\375\025\311\001Z\366\031\0363M(\301+\333\331\256F\301\321/\215\2534\327\347\200v\314=\216t\336\350hKC\240\353\204\311\231\201\003;\340\304P\351\300\327\365\001\310\351n\030\351"
+	.ascii	"\273\331T\216\2013\177\207a\n\004\037\355\017\0355\307\314\305"
+	.ascii	"\001\346\211\352\224\374<\350\3553V\310\273\253\002m\026U\373"
+	.ascii	"\276\200q\304\327\321A\034O\305-d\n\203\253\036y\031\264|\327"
+	.ascii	"b\314\r\356\260\377\256w\251\321h\023^\3709Fu\336\231(E\210U"
+	.ascii	"\365\\!}\025f\250@\376\362\031\235\351\250jI\366\312L\017\302"
+	.ascii	"\264\244P\332\233\037\223\3003\023\017\207\004\347\017\t\273"
+	.ascii	"\226\230O\342\0033\226\032"
+	.text
+	.section	.gnu.lto_ubloxSendDataUpdateChecksum.71.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`O\002]\023"
+	.string	"\006d~H\320\360(\035Z\345\303\256\225\363\255\021^\273D\347\360\2728\342b\374C\030\310j\002O\002\r\244\334q$\337\206^\325[TIFh\242\341y\005\3740J\275\321\037"
+	.string	"2\035\237S\001\321\325\313\233)\350\321\3777\331R\246\024f"
+	.string	"d"
+	.string	"l"
+	.ascii	"\327\311\3345g\217\016\030s\206\t\\ \365\317\341G\344\277\324"
+	.ascii	"\001\310\177\246\3317\036\376L\324\207\0167;\035sNp=\370\275"
+	.ascii	"\307\360\216J\373\027Wi\276\362z\267\334\314\277\210\262\341"
+	.ascii	"\200`\345l\261\344\311\311\350\273+.W\323(\"\347\373\335#\t^"
+	.ascii	"\322-\227sEA\230sZo\271\r\267\274\355\025\333\017l\325\tvIuK"
+	.ascii	"\252E\244\232%\325! \037\372W\017\372?\036\336\252\207?\352\272"
+	.ascii	"_\376\272{W\255R\375\221\001:\0320\2449qz;\246\322g\024\302'"
+	.ascii	"z\321\313Wxu^\224\230s\256\376\331/\366\352\337W\366\220\214"
+	.ascii	"\0061\bF@k\326\b\001!X\265\0270\240=\214yk\326jh0p\265\217\342"
+	.ascii	")h\001~\021\nL\1773\001\333\316\330\217q#\f>\220Ub\372[L\376"
+	.ascii	"s\355\004\"\023\034Z)\"\313\332V\212\310~05\341vX\373\033\216"
+	.ascii	"\220\375\262Vw6<\265\026\026b\f#\377\205"
+	.string	"\354\213~\200i\t\267\363\325\275\213\233\036g\221A\226\002\362e\344\277\357wxK\270\035\032\355-\021\222-\267\353c\2075}\311\317\223\223\267\307Fi\022\"\304^ZT^')/\325\312\311\2055q1\251\020\375\"iaA\001e0p\005f\022\003_\263\026\220$\200e,'3\320E&\233\201\253\220\346\333c\n*\224h\266\366\255\217y\034\351V\205\332\270\270\357\236\312q4cA\326Q\345\356\342<\023\262Q\243O~\35712\256j\035\360\222lxjq\3169\243\025|\027dO\360\232lF\324T\327\265\0012 \220\002\231Kq\003T\013\n\003\253G\374\330\002e\021C\257\036\r\342\212ok\026x3\303&Y\321\376\366D7\334n\3134^\205\005\326\fm1\200F#\374\342\b\207\246\256qp\255\241j\005P(\234\260\232\333\334F\373Znjo(\023\016\232+\n\030\037\303\bb_\230a\234"
+	.ascii	"\034\021@\224\352^0\013y\202\222\233\001\224MW\177\002"
+	.text
+	.section	.gnu.lto_ubloxSendConfigMessage.72.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\024\003\r\025"
+	.string	"v\346\205I\300RN:2\230c\003\032\tJ\037\007\\5\211\235\225\353z\307}\224\206\3542\016\333\300\204nf\326`i\324g\241\216b/\277\213\330\360\235\212\211C\020\004ez\323h\2773\235@\313B\274\212\332>\373\226\020\262\211\224)\005o"
+	.string	"g"
+	.string	"q"
+	.string	"\377\331\345\273\245\354\234E\036\232Zz\267q\236\020_d Q5gS\201K\033\030W\355\003\bp\347\335\036\233\272\034\030\b\\\355']\005\356J=\0070\247\021U\323\234\274\025\253\214\227\346=@x9\336$\2744\316\376q\336\321\024K\214"
+	.string	"\372]\3159e+\342\270+\316\377\357\255\235P\356*&\230sZwB\033\356\275m\025\333.\366\206\bEV4\260\215H~Ox\371\345\231\222\n\":\323\337\373\200\243\337\302\373\2762b\\Y\371h\226\315\313\351\202\260\017\3165\262\317\373Q\256\364\237\200\352\230T\303V\375\002\325%RM\262j\027\250\036\271\272\265\352\021T\213R\035\256Z\202jP\252w\325\n\252\237\""
+	.string	"+\252\202\323\234\032\262\260&\224\204a\342\275\337\367\245%\373\352\275dC\033\035\206|\\K2\203d[#\353\332\373>\262\241\023\215!\230\236\351Kg\372o\266\033\267\2656M\006hs\326\233\204'\333\332\377\240\320i\226\305\035_\344\267\020e\305}\322\324\220\237\"\235\334\260)\004W\2728\270<S@\202\210\\\252\273k\323\324\350wN\271\2609\373,\336b\307Gr\rG\277\303\t/w[C\253\273\002\024\n\026\324\354\330hf4\n\263\226\r\315\302\306\350\304L"
+	.string	"=c\261\335\310\310j32\233\231\230\032\331,\307&c9q\355\206\226#\323\251\325rd.\336<8\327\310\020\210@\371\254\256w\003\347\374\340r\337_\325\373Kh3x\217\027)\311\343\351\312\312v\360\035:D!O)\254bk?8\216\333\353h\316\331\342C=*\202\217ti\t00>vA\2366\266\347@u#\210\350\265\260\032\260= \240\002\021\2622\017T\027\024\206\376\265\300\034\254\344\n3\275\355\261]\227\245&\220\323\"\267\250\005\2465\277\226\327\357\240k\304\027b5\336\350\340z\002\277\313\343\250\216\327\344\335\316\363\3305=\3219\013\255b\235\036\\\016Knc\212V\327\300;+gd\367\026\323\345xF"
+	.string	"\355\325\314\270B+\354H\214\311\024\270\345\206\216`O\034[\024\301\366\302\244\255"
+	.string	"\372\230/`\204\343\023(/\340\210"
+	.ascii	"\030\005~y\321v2"
+	.text
+	.section	.gnu.lto_gpsInitUblox.73.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"]\t"
+	.string	"\326\321@80\221\322\001\2609\316\307\250v\326A\246s\301\350\303A}\3626U\273\034\345\004\273\355\223}2S}\347\370;\270\340a`@\231!\372\263\240\021x@\355\266\021\"eJ\0010"
+	.string	"2"
+	.string	"/"
+	.string	"\273\0335\344\253k\232+\037\364u\327"
+	.string	"^W\355`#\346\025\372Z\232\200\314\243\346\261\247\305\347\312\374\214v\327\351}\030\367v\333\b\266\tl\317\002\005 3&\031\254\fm\260\225\n\263\257a\030\206\326\017;\323\371\364?\r\0322\207\226\335\213p\2662\333K\211\355\207\274\262m\016\212\354YV*Tr\002V\355\322\005G\306\241\n\263=\341IUH\241q\245\216?y\265S\021y/u\300\245\235\375\223\243P\370#\226P\345\275o\276\312\363\355\372\330\003&\211R'\206\310\225\342C)\301\024I\250T\024\005\230;-\240\"\004\307\241b\bd}\304\322\326;:\022\230\233\005\327\340\271smwW\003\245m\342\362^\016"
+	.ascii	"2\003N\035\206YX'\002\202iX\001+\200\266\217\205x\241\207p\350"
+	.ascii	"2\364\313\020\342\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_gpsInitHardware.74.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`$\001]\f"
+	.string	"f\325OD\020\215*\035\327b\2435\005\n4/\334\312S\304\365\320\004SO\3760V\346\276>\240?+A\nB\331\311'\035\357\263\001\272$\035\325"
+	.string	"\251"
+	.string	""
+	.string	"@Y\201\020"
+	.string	"\r\277\3410\025\363@\254\327\006\331d\357\224\002="
+	.string	":"
+	.string	"="
+	.string	"\r\366\"5\032\320\022\261\273\034ep\320\253F'\310\3278\301\300\320{\245\"\b\355\252{,\020]`x\340T\364m\026\342\353T\t\005\3209\201\331]O04po\267\375a;\303\376(g\001\360\037\274:\300g\036|\365?\333\353)\007\301\206\031+4K{\374&5\331\247eY\316LK\366\247\277Q@\320\020\336\001l\267@9b\311\312!\202\355[\f\262e\037\003~\205\217H \275I\342\342K\354@\251\351\030|\327E\324\222,\370\027,\243\274d{=iS\tP\366)\330\226a\300<\354zW0\301\345\260\220D\263\204m\317'\234PvE\035\376*\316\\<\034\021\256\323p$\032\220\r\227\351x\270K\205;NH\2073\351\272\016g\031C\327\226\226T?\201X\b2D?\177\2741Z\325|h}#\366\322*\323\336t\363\240\237!\266\"?\352\005\036"
+	.string	"2\241u)`\202\037\313\005\235\326\004\006\212"
+	.string	"r\241\032\024H\306S\311E\27387\355\201W"
+	.ascii	"J\236r\006*\3261c\212\243c)\314b\234a|\312B\271\214\3622\304"
+	.ascii	"\270t\240q\23024\343:u\023\344\333e\345\t"
+	.text
+	.section	.gnu.lto_gpsUpdate.76.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\300\022\rR"
+	.string	"\252\203"
+	.string	"\035P@\214\332\351\377\334\336\262\037\031f\356\004q#\306]\364B)\250\003\231\212"
+	.ascii	"7\301-;\262\2028`\243.X<\273\352b+t\220jO\354\277vN|E\001\244"
+	.ascii	"w\316\221b\354\262q\201\326%\013\0231y\002\275`/x\212\276\233"
+	.ascii	"\334;\245\224\002\271\001\232\001\306\001\327\031G\306\371fu"
+	.ascii	"\266Y\235k\2563\315u&^\347\231\325Y\346:\017W\347\253:\253C\347"
+	.ascii	"\364:\277\352\354\252s\303\250\031\363F\325]\202m\253\243p\205"
+	.ascii	"\326N\215r\204\333\255\337.`B/`n\353\300\334[;\240\371\346\244"
+	.ascii	"\237\0314\032\233hJ\311\200\271\233t\232\006\215\306\035\232"
+	.ascii	"a\304\332\266%\266\312\254\0013\261U\225\310\314\355\314M\326"
+	.ascii	"el\233m\3002m\2535\026\327\266h\001p\322\332j\261{n\253i\357"
+	.ascii	"\334V\231e\336k\264\255\026(\fn\352)\246m\333\246\037\302I|\237"
+	.ascii	"m\244\243\242Q\021\321\220P\020\320\217O\017\317\216N\016\316"
+	.ascii	"\215M\r"
+	.string	"\rqFf\035&\335t\351\225\234\345\366f`\022\357\t\325S#=\351\243'm^|\302\346Fg]tV\346D\251\320\225\034\217\24542\037:c\342B\303\017A@K\304\374g\354\210\373\030\361\036\257\346\351\362\235\"\256\343\005\266$\3429\251\206+9\036}\267\\\222\366h\001!\f\227\343\f?<\273\251n\266\260\334f\255\221\334\254\220Ek\2024\315\3352HZ\004[z\340\304\341\207\263^\001\303V@A\253jI\317\\1\233\027\247m\333\326Z.Ie\216\264\252\200\364\232j\3503!\205\036\035F\224\r\266\264\362a\372ikU\372n\t$\365P&\306\325g\3558\250\222\236\344n}g\220\370\350T\252\312\255\227R#!XQ\"UTZ\314b7\325o}t\267\204\363_}\264R\272\003\344\255\213\r\325T\n@\027\021\230}\326G`\3137\367\341\207\266m\331\225TU\315\027\232\331\2230\263"
+	.string	"\3148P\002\017e\231\306\"!K\\\264\217\233\365*\322{\254\027T\310\234\030 \211?\322z`<P\351\207\301\271\333X\021\3300o%\211'\252\372\263K\376\0237\226V\322^\216]\206N\344\304"
+	.string	"\325.\272\335\306\354X\343\031m\266\332\266-\200[K\337\261L\270\273Ze\266\214=c\317\332zi\204*j^\236\370\375 \036\222\265\350\216xB5\357\242;\374\021\317>e\225l\271\2363&"
+	.ascii	"\002\304mu\370\0260\241Q\032\033xd\303w\036\357\375\004\206\\"
+	.ascii	"}f\005Dx+\257\025\365\373\254\3238f\230\250Uw\332\266m\233\344"
+	.ascii	"6\244\300M\271\f\344\334o%Nx+\371\377\251\303\240-\203\244-X"
+	.ascii	"\004\254\310\222\213\033\242\307\323\347~[\321\200\2672\304\367"
+	.ascii	"[\347\304\361\315\331\375\247\337\320)B\035\367g~\200\205\267"
+	.ascii	"\362\277\030\365OQ\374e0\241\217\247\227\326\366\357\344n\"\036"
+	.ascii	"eJ\224\230\306\355\217@\rL\224\217an(]\002\r\356.\206\240\205"
+	.ascii	"\267\262\305m\265\277\0033\314\230\025\224\0272\243%\375\235"
+	.ascii	"\314\235!H\326\037\277\020\346\353\314bu^q\235U\f\235S\254\316"
+	.ascii	"(V\347\023\253\263\211\325\271\304\352L\342:\217h\263n\0215\316"
+	.ascii	"!\256\263\207\353\274\341:k\270\316L\3279C\2153\206\325\371\302"
+	.ascii	"\352\274\244:+\r\235\223\2563\322\352|T\343\\T\235\215Vg\013"
+	.ascii	"D\347\"\032g\242\353<Dt\026\232q\016Z\235\201V\347\237\325\331"
+	.ascii	"\347:\367\\g\236\325y\347:\353\\\347\234Q\204\276\253\232T\334"
+	.ascii	"\231\225\314\351F\016\336\240o0\265<\244\n^\002r\020J\020\323"
+	.ascii	"\323\\\327U\231\031\224\027^:\264\0338\31777\023\337\3176\266"
+	.ascii	"\247\211\347\323\211\262\373\231\326\344\311\301;\260\231\221"
+	.ascii	"\205\354\020g\333;\263\213\372\247\255/<n\336\311;N\232}\272"
+	.ascii	"@t?\357\363@\377S\244\276\312\216+\331\317/\345\231\371\274\263"
+	.ascii	"\3551\231j\016H\370\373\212\366\331\274\223\257\213\370\230\213"
+	.ascii	"\225\370#\236\304\303\326J(q0G\342P\335k\314\216\371\021\243"
+	.ascii	"\315\226\221^\353\371\256h\363|\217\023a\223 x\336\251\271\026"
+	.ascii	"\265\2022\326\360!\306\236/\356\364\020\330\251\033,\016\034"
+	.ascii	"\267U\013\232kb\200;\016\302\321\307\265R\270\235O\255\3545k"
+	.ascii	"t\036\313Ht\265\245s^\347w\360\304\352\244\242$\215\027\347s"
+	.ascii	">\r\354\300\233F&\316\313h>\307\314\324\244\224\0344,\325\275"
+	.ascii	"\371\326\322\341?X\252\265m\243\n`\357\341>\330\035=\330\037"
+	.ascii	"?n\2537\217A\323\311\230\231\315\3578\372xU\037o\315\333\374"
+	.ascii	"C\245\256\222^\b\304u\034=G\3153\300,\214\232\371\215n6\275A"
+	.ascii	"b\223\375\340\213\236\240?5\214>\273'\037\234\231\332\n2\343"
+	.ascii	"Jv\0347\214\360\313\0067\227\254VI\363\013\312k\270\024\357\t"
+	.ascii	"\255`\345\273\250\350B\261'yom\333\247\276j\365\350C\273%LL_"
+	.ascii	"\233\3252y\313}\265n\265\313\026\255e\"fI9!3\241q\035\244y\241"
+	.ascii	"\300+f\2002\304W\241\225~\203m\2743O\374\0263\363\f0\001\307"
+	.ascii	"\254\006\300b?\200af\307\301\213}\274\314\254\223\035\322lze"
+	.ascii	"2\317\314r\365\337\221\307/3R\270\230\340\005\212\n(p\341\344"
+	.ascii	"D\243E\r\267\3400C\206\004M1^4Q\360\002\202\t\232Z8\315h\342"
+	.ascii	"\300\3031d\270pj\252 F\f\247&\"T\277\220\225o\212\035\324'\221"
+	.ascii	"\336\371=\232\260\215W\303o\370\376*\r\357@\023\032=B\346]\246"
+	.ascii	"w\"S^\0072\357s0=\001yfE\026\031\236\305\263?\007\306* 2\244"
+	.ascii	"tM\250\321\212WrQ\372\311\354\350\353\r\256\210_\361;\311\256"
+	.ascii	"5\251+U\260\311`\221\361\252\370\007S\243\3534fk\274\224q\375"
+	.ascii	"\032*\036\001.3\"_2J\224\342#P\253C\361)"
+	.string	"\276\341\246\bO\274\210G\361-\365\225|\250O\036\221W\220Y<\313m\365\304wZ\253U\314\272\250\025O\216\270%C\030J\324!\265x+1|\263\361a\331E\025v\373\240\320;\tY\257\013\203R\232u\234\326\005K\320\205W\341\b\300\030_\366\322_\370;(u\225\024#\270\364\375\325\244\0333[\300\223^\211\013\322K\261\206\003*\275\214\025\322'}\n7EH\346~\310<\003\330\373\034\005\244^\212\204\"\371.\222\357\266\212\364\375\314\213\002\345\205{\320\243\277I\232s\321\031\350\027\240)]|\327R\003st\243gF\376!\003\275\225E\007c47fU\374{\376\274\2237\364\361Z\370\366S\233\363r\354b\341\333\252)\027\365\241\353\242-\254\327\212W\364Cr@z\230Y%\256\345h\027\327\2542\307z)\3115Y\223\212\030@\234\250\033\21772z\211\336&\005A\277\202\214Z!\372&\344\032"
+	.ascii	"\272\334\251k\017\337A\bj`\232\256\207\336\303\263S\031\372\336"
+	.ascii	"\302\325\214\207%K\347\235\234\n}\337\235\300z\255\001\201\200"
+	.ascii	"\250\201('\225342\"\"I\222B\032\003A\005\204\030\006\241dw\021"
+	.ascii	"\340,\244\244CC\"\005*\250\221\306\t\256m\017\2147\322#\317\255"
+	.ascii	"\217\201\023T\001\032\ri\340? zPxL\342\234r\375d\301g`\222\223"
+	.ascii	"\033g\320\035\345\313\310B\202\331\355\325N<,SU \304\312[\260"
+	.ascii	"\004\272\03129\254\005I'd\b\264\345#h\003\tHW\274\212\033k_\270"
+	.ascii	"d\200\017\354\221D\210uK["
+	.string	"\255\256\355\005q\255\021\340\353IM\025\261Q\244\323?e\025\2230\277\264\272\013\024\316\316CM\2261\310q\f\311kq\021\244\367\362\262\177 \204\306R\335\034\b\036F\007\271\324\325\263\212\215?\354\365+\036S \3616\244k\323\b"
+	.string	"\241\276\036}\307\326\337\005s\354Z\334N\244u\316\304\325cFF\205>[\322\277P]\356e\021\253^\007\005\233\216uJ\341\336\007&K\326\242\213\037Dp\2610\363B\217-\034\374qPp\252\341{hap\256\320\341\300\204\202\356gU\007\324\370P\027A\037\262\307_\216\"H,h\205\307\216h<s\032\013\345\026\200\260\215e7\001\300\250/\373s,"
+	.string	"\212\372^0\304\207\222\006x\310\362\331\2403\017%j)\237\217;\226%\243b6/oj\033<\005\336\013\302\344\035w(\306/\276\272vf`\b]\034|\210\342\310,\341{\310Tx\222\023\3473\267\235<\253\023\222\3702U"
+	.string	"#\216G\353\246\037\025\024^\315<\302f\003\215\0243\rB*R\221&\340M\f\032\305\336\211\310\251\274\235\001t\206h\344\252K\335\n\024\331j\321'\351\231\326'D\023z\351m/v\277@%\305\230\227'\274\202\251\351$\b\r\003\f\303\345\245dn\205\342L\342F\351\222UV`\217\247\334y\037\265#\b\036Q\016\315\327\374\023b\210\343e\212\177\265e\266-\374^u\306\250H\272A\217\276@\307\277h\204r\375\304g\352r#(\272\206\200\352\037\310\006\224[H\317L\216"
+	.ascii	"\300,\037\0028\215\373\255\003\260\227x]\177\224\332T\022\357"
+	.ascii	"yq\311\360\240\220U)\3314h\002\232\357\205\203\324*\234)K\305"
+	.ascii	"\026)\245x.B\\\0265\361!\007\362\231$\350\233\304\226\020\342"
+	.ascii	"\265L_Q\221\001\017\035\317MV\003\220\001\321\376\345\303T\277"
+	.ascii	"\243\360\372P0\232\253\fm\325\321)\305}\324_\276\231qW\366\002"
+	.ascii	"!\353\nL{P!\336R\240^\3772x|b\376\207\273\036\026\341?5f\271"
+	.ascii	"I;s5\032\300\215\360c\327|\375O\332\254\207&\254\016\211\317"
+	.ascii	"\n\0230r\246\035\2220\030\320^\303^J\332\020\225\321DgEV_\f\026"
+	.ascii	"\305\016\357\210\311\361A\024\013SC\032\231\017es5o\243\033\344"
+	.ascii	"\022f:\007\262\270\366\222\033\275\264fN\226\310a\345\212\027"
+	.ascii	"\344)\215\271S\003"
+	.text
+	.section	.gnu.lto_gpsNewFrame.78.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\235\001M\017"
+	.string	"\226\035fE\360\260(\035\353L)1\262Sn\036j\244\177\373\325BU\316\254\3625\247O\327\334Co\233\353\027h8|\333+\260NY\247\020h\300\023\341\201g\210V \263\353\2477\214\007\356\234\3555\213\224\332\356-eJ\001U"
+	.string	"L"
+	.string	"S"
+	.string	"\232\177\261`\335Uy\325\354z\nl@{\264\355\005\fN\\\272\327\242\372xq@\221\261\261\353q\372\341\245G\250Y\362M\217\032\203\321\255X\207\2079\254Ii\0213#\266b]S\250\316"
+	.ascii	"\227\r\210muA\263#dw\235\335J\303\335"
+	.string	"\271\355\007\266\017\330\031 \251\006\276\211{\"?\304\243)\220\362\335\243O\352<^k\244\260x\2258\345g{\250T\026\373\372}\337\r\353\212\355\364\307\351\355/\277\346t\3244\324\264\306t\302\364=F8\252\f\253\303hvU\037\216\275\211/D\330>\261=\266\003\252\366\bI\276\373h\201\224\232\234\252zMS7\024\214\006J\316)??\305G#nL\231\343.\033\227L\225\305_\341\303\336\342\262-\031_\205g\332C\235\307\277\265\257\016.\217\261=# \223\261k\272\212\355Yv\233\300\323Je\216\355\b?Q\242\355\006\240\033\004B2!\341D!nBH\244\204\003\215H\034\310\207E&##\256\202H4\342<\336\351pu\305\022^$fh\322/u:X\036\340\246\207\271\203\r2\375hT\f\266\242|\024w\b\334\335\215\002\022\252\rA$\337m\232B\335P\261\030\2379\002\034\027\020@\006\037"
+	.ascii	"L\023:/$\336\337\n\034P\0017u5\270VC\201\274\217 \332\230i\311"
+	.ascii	"\277\323\006\253\200`\200\346\247\234\201\nk\245\326\216\032"
+	.ascii	"x5\273@f\006.0\237F1\232@\017\327D\217\211c=\027&\270\006\314"
+	.ascii	"\343\240j\n\334\355\334\362\004"
+	.text
+	.section	.gnu.lto_gpsIsHealthy.79.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31515`m\322\001\300\216\f\237\305\352AAi\345\2408\256\256\216("
+	.string	"M\264\005tk\350\330\241\321(vWM-"
+	.string	"AG\314\305\035\261#\211Z\3301\255m\"eJ\001\316`\340\246\301=\215{\320,8\270L\005\035\346\342\267a\250\\\304{\225\263\304=\265:R\035\370(\310\355\220rUU\220\220\td\210{@\200\335E\360;N\222\3603\336<\301\311_o>\207\362v\025\300 }\362dGOj\205}jud;\255\231>\025\220\215`/\221\354\212N'\033\322L\231\355\216m\261\301A\307\326\343\205\350\242\301\021\3720\331\215N-n=-\377\033W\020)\225\\\230\347YI\330]\347\205Q\334z\333\005\266\tlg\001\t"
+	.ascii	"2\241g\037\230\302\004;T\241\270&\246\214 K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_gpsApplyNmeaSatellites.81.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`.\007\265("
+	.string	"\232Fl\017Gp\\N:\033#\300pi\217\210\036\202\020\227v@\2352\250\341_y\002\322Z\262\311\031x\023jg\304\354R)\234\345s\330\370\202K? \362\327\350b\272\330\004\036\206d>\274\347,\016\325\323\335\032!d\023\271\223\f\337"
+	.string	"\321"
+	.string	"\351"
+	.ascii	"\274[2V\373\325\272\237\021\247\224S\220>\214?\026\345R\204\027"
+	.ascii	"c5\037\253\036\367\307\206\032%\2336\367^\245[N\220\336\0220"
+	.ascii	"+\217\231_\231\377\344_\302\203\305\370\317\275A\342\256\334"
+	.ascii	"\033\246\200\r\244\267\034\366\241\3636}\320y\313Bf6E2n\325\002"
+	.ascii	"e"
+	.string	"\025\342\224\270{\357\257\207\260\371\345\315\260s\257\n\357\343\351\361v\272\024=\255\331U\310\337\031\253\356C\236\207-\213KG\355\t\321:\236gB\370bB\344g/\300\226\265\303l)eZ^\306Uw\365x\335\017\255\034O\013\240G\242D\343\346\207\326\326O\242\365\031e\230\004\356\275<\343\260\232g\313\312\3013b\3256\023 \275\340\360\031\257\314!1@\324\034\312\013$\311B\326\2126\335{\271\026\215Z\347\2363\3372\263\003\346\323L\035<\226\247E\361\275\370\205T}Q\352\274\355\016\036\337\344\266\254\352\022\b-\315\207\371\233\221k\300\326\245Hw\222\201\347\273\204\230\033V\245\303\314&n\005\230\336\213\325\200_\245\351D\352u\313Gq\336\276\017\345f\223\343\03290\253\272d\016\253\252\235L\233KN\341\016\302\274t\263s\022Z\031\301\305\316\007\016\366\017@:\331\371(\255l\224V.B+\023\331\312"
+	.ascii	"l\345![Y\310V\016B+\003\241\225\177\320\312>h\345\036\264\262"
+	.ascii	"\017\255\314c+\367le\036Zyg+\353\320\312\251\255\214\332\312"
+	.ascii	"\347Y\331\236\225\315\263r\333\312g\362\215\3612\276\312\333"
+	.ascii	"\2757\226vn\030\233v\344f?\331/v\263v\265\314T\370gf0hx)\351"
+	.ascii	"\374\3128s\252\031W\220,\274N\262\317a\234I\335Q\316\274\211"
+	.ascii	"}Y:P'u];\352\237\006\352\2422C\344U\363\364O\233k\206H\263\247"
+	.ascii	"}\272h\3120\t\323}\335\323\350\332\020\371\366\265-C\234\353"
+	.ascii	"5O\232^\377\354V\307\361\216\262\307\244\221r\266\353$\327V\372"
+	.ascii	"\313\376"
+	.string	"\033D\036\310T\351H]\203\257\343\271}@\320<\2405\342\234\317Y\355<\320\b:\301\332\020n\327i\037h\243\265!\362\252.Y\327;\356p3\272>\030\"`h\247}\342\034\031\264?v\nm\216s\224\351\331l/\276\t\363\341l$99\266N-+3\320N>\235|/_{r!\242\276(\342\274\005q\214\303\004\3166\227\266R|cU\227[l_\353\b\327\373\222\261uv\322\354\356*g\304\263\220Pk\202\212\321\016\210\\7\304-\313F\235\035(XhX\001\345\324\202*\005\036\212D\rJQ\005\241T\234\034\305D\245\302\304o\n\370K\001\204B\361\213\nR\375\230\204xJ\205T\360\267bj*\370\343\205]\2627Y\365\025\231\317\250\213\277p\311Y\324F\375!\362\252\016+Q\270D\250\024:\021:9o\213\342\270\310\224Fx:\311/\273\222\016\336R\263\251C\352\243\256q\324D}0"
+	.string	"M$\374\252X"
+	.string	"Z\200\333o\336{oo\351G\275\324/\273\007 hh_^\255\236\002\324*!\024'%\\cqpC\313'\242\266\271\bq$\334\016\220A[\035\013\013\272\350t\r\365\263p\215)\205\342\236\220\272\346L0\357\024\337Tx\034`\203.\346\013\207\263\260\240\355^\254\007\030\016'\303-S\233P\177\313q)\007\026\324\314\034\342n\236\210\332\356\275\017\370oo\263\201989\235I\035\324Abh\001\200\231\250Q4\307\240R\246dDFAA\222Bc\220\002\021\252*z\021@\301s\254\246\315f\"\016\326\252\034\007:\321\024\t\204\224\220\023\201u+dUk.\351Z\321\2314\313H"
+	.ascii	"$$\316\353[h\033\272j{\250b\324\\\322\327\370\2035\2572\030\016"
+	.ascii	"q\3261t\300R\037u5\016\351A1\312\204\200\022\376{\371RC\fFr#"
+	.ascii	"!I\027\"\266\342\360\353d\342 \211\323\233v\237\2317!\305\343"
+	.ascii	"\370\324N\177\027\375\026b\034\213K\330\216F\271\"=\351|\257"
+	.ascii	"\302\030\003\330\032F\355\330\356\005\r\236z\0163\240\316\022"
+	.ascii	"\366,82\374\271\360d\307\\r\316/\303\3239b\033\362x\242ad\320"
+	.ascii	".\357J\205\342.h\270 \227\200N\310:\274\n\367$\202X\340V\032"
+	.ascii	"\354\267Z\205d\3261!\355Qh\361B\241\004\210m^%a\026u\020\202"
+	.ascii	"\364\353d\b\331\336\204\300\257\371\3059\t:B\306\244\360\303"
+	.ascii	"\017\270\310\346\274\001\357\322j\365\320\354\177\360\201\203"
+	.ascii	"\317M87\220r9\261[H\251L\017\371\333\216\f\250\305\353A\b\376"
+	.ascii	"\nk \b\242\fwW\326\177U\237Q\003"
+	.text
+	.section	.gnu.lto_gpsNewFrameNMEA.82.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`e\020UG"
+	.ascii	"zx\\\032>@\346\316\030\327\337v\241\241X\3209'\264T\004Hj\355"
+	.ascii	"k\313\373\211\200\210s\241\343\035[A\334\237\363\375\242\237"
+	.ascii	"\275]vt\016\354\276\237g\343\321\261\322\366UU\365\312uG\221"
+	.ascii	";\245\224\002\224\001w\001\234\001\314\266\316\306\326\271\350"
+	.ascii	"\350\274\262\316*\353\\4:\277\321\331\337\271g\020\220\023\267"
+	.ascii	"\227fm\354\371\244\357\222i\242WO\305\373\322s\335m\272\245\375"
+	.ascii	"\314p\334uk\232M\221n\363\003jK\3722\217\232y\n\301\244\356\216"
+	.ascii	"-\327s\334t\334\246)r\325p\254BPa\224\355\212;\r\267\255^u\034"
+	.ascii	"\026\024\227\364}rP\023\310V\b\301\330\2523\027\341~\343\226"
+	.ascii	"\333\255\321\024i\251\220~\231\274mdp\rJ\340\373J\037\264\312"
+	.ascii	"\t\214\255Burm\265\330L\353{\263e\361\277ot\315\335\373\276\021"
+	.ascii	"\370\200\261U*\013E\330u\352b\022\222\260\266\344K\256\360}\245"
+	.ascii	"S\217\205\233\272(mV\335me\262\211iI)\t\351\310\b\331\036Yc\321"
+	.ascii	"\252\026\177\351.\367\223\331\312\336\362\322\311\003~{ML[|\251"
+	.ascii	"\bD1-\232\246\251\324\244\223\212\016\002\341\034J.\361\342\354"
+	.ascii	"404G\232\342GG\317f\021*\r,\352F\355\263\311\007\f\352\310\250"
+	.ascii	"\266\bD\025&]\372\310\007\214\254\b\365\276o\277uT\032X\024g"
+	.ascii	"\265d\341\"\245\253\200AY\217r\264\310aw>\233\253\321\0034\316"
+	.ascii	"\036\037\233g\223.*R\261y\272i>`cE\2431\200i\375\366\345k\361"
+	.ascii	"\273\n\245\034=\275\212\034\016\277\3724\035\227\253\3070b]t"
+	.ascii	"/\375F\261^\026\035D\361\2045\037\260/\305\344\0363A\375\326"
+	.ascii	"~\344\331t/\002\361\276/\273\363\311\244\331\251\231\273\r3c"
+	.ascii	"`Fz\021]\230\306\017\235\265r\357\021\311B\366q\341\256Z[}\352"
+	.ascii	"\033l\275\336S\305\315\205U\260`\261\266\352O\005\215\2436\266"
+	.ascii	"\345SUI\230\236\242?\3631%|{\n\355\255\177\306\024\016\2131\376"
+	.ascii	"\331,\233\216\374\230"
+	.string	"\225\2758@\\~XT\377\214\231e\274\233\276\223\245\354\263\363vN\301\236c\326\252\353:Y\306\367}3p\317i:-^\304\210\261\266*\343\027\370\341!M\247\323ic\2550>\3067]?\b\253\213\343\233\2136\237\357\316\255\254\370g\f\350\316\267\001\203`:\"wG\335\301#\363\177\306\335N_\336\364\226o\205\205\254\030\376\231\202\002\305\371q\371!/y\177\3035\034\033\306\367\335j'\367\233\276\233\301\315\245U\256a\303\333ic\275\201\303\333\211\341\241\272\236\311\025\276\277\337Z\225\002\255\213\343\243K\334\362)\263\264\351\177\306\334\b\016\245\251\343\267\302\354\3162X\347\030=\327\f\243u\326\320\322f\f\315\326]\201\235\251\220\316\023Zg)\244s\004\2443\004\244\363\003\244\263\003\326\271A\353\314\200u^\300:+h\235\023\260\316\bX\347\003\255\263\001\3269\212u\206j\235\013\260\316\004X\347\247\326y"
+	.ascii	"\353,\200u\016\200t\006\200tvb\235\227\254\263\222uN\262s\023"
+	.ascii	";3!\235\227\220\316J\255sR\353\214\204t>zg\243\326\031\371\316"
+	.ascii	"\355;\037[\017\177\360\310\035\271\\7}\0036]\215\333E\327\364"
+	.ascii	"\t\262\264\221\2732qpf\327\210{\304\333\311\364\035H\330\246"
+	.ascii	"\327|&/%\3618\270\277%.u\311\320,};\201\376)=\275\315}\202\304"
+	.ascii	"\326\304\317\270djJ\177\202\202\n\007\017\265\323\255\275\206"
+	.ascii	"\310\2441\215\330\356\332\212\364I\337_ciHo\005\375\243\326\036"
+	.ascii	"\2119\030\367\311\027;(\336\305%\343r\364ZP?FP\327\222\005\315"
+	.ascii	"\320\024\277rf\364=\006\355\203\244\342f\356Z\225<f^&b\n\362"
+	.ascii	"\233\t\264\217Z{\346P)dX\034"
+	.string	"\312Xkx|f7\213;q\267,\373\330\355\342b\356\227d_\253\354M<\314\r\343\212q\307\214Y[}?N\301-v\313\370\323U\003;~\207A\365\250\271\261\257\304\373i5>\373\375\025\326t\247\037q\327\3346\027\215\213fm\325\370V\320<\303\266S;r\3743\026\261\026\275U\034 \016\341_\"\214\357\313u\201\275\313\275F\220X[-\372\025\320<5\267-\276!A\240y\n\007\013uQ\231\262\302@\246#~\024A1\366eg\252mND\356\304\342Z\242CnD\337eo\033\0240\204\334\205\236G\312f\346-\033\3446\304\200\306n\023k\253\335\365w\356\330\314t\034f\006\354\301\302\250\224\367evt\375\266\354\313\023\231\271D\0232q!p}\032P<\206n\352\003vc\255\305W\277\275\242M@\035\b\013E\212\024\017\003:\3070jH\226/\377\374\253\370\003\023mc\242\0228x\350"
+	.ascii	"R\303\007\017\034@X\035\rd\007\326\025\016\253\365F\363\r"
+	.string	"\251+\0379\246\252tL\365\320a\203\307\324\r\253\253)\251&\256\362\201\303j\nHU\225\325T+\335\352\267\302\033\334\320\321%\273\3355\321\032\031\335\233w\271\246\242z\377\246\362\317\222)\274\341\034\321\006\0024O4\203YkO\313\017\0212\\\310\316\214a38\024\243\3274\201\360\320\240KVh\302kE\347\f\335\230\236V\r\337om\024t$-\365\032\236=P\352\255\242sjc{\242r\323fp(\266\024AP \277\276\bS\b\177\374\354\361\2010=\224\230\250\373\255\033\215\320PO\351G\361}\253|\b\204\363)\237\360\266\353:-?'\263V \255?o'w\037\241\036=\256g\362\203A]\347>9:\370\007\337^i\r\336\301\277\241\257\304\255\006\277l\346\021z\3411 \264\340\031\374#*\370\005\277\372Q\276\202A\t\n!\370\004\377\210\007\036\201\307i\345\037\370\245Y\036\237\001CQo"
+	.string	"\352\243~5\344\205\327\201K\332X\253\362\241\364\024 $\360\005\376\363<=\001v\003\366\364J\263<:\003\f\273\316][\2429\005\005\374\200\377\277\257\304\255"
+	.ascii	"/\340W9^x\315\273N~\200W\356\345\275\361:\003\340\231\265\020"
+	.ascii	"u\235\373d\211\206t\327\356\223\325\351\001,\337\351W\273\257"
+	.ascii	"\304>\215\265&\177\371]\327.\342\362\350\274\360\222\f\337\222"
+	.ascii	"\352Z\371\177H\013\321\337\270L7\312\357\271,O\301\213\031\022"
+	.ascii	"sM\276\003\322\232z\033\227\311&\371\025\374\234\003\2018\250"
+	.ascii	"QH\244\024ShHDDA\222$i\r\301\005\304\020\306 \263\016\021\320"
+	.ascii	"0\207\23032#\"%)\024\24613\300\221p\276\204w\313\247\f \244z"
+	.ascii	"\253\247\314\2601\240\321f\230\244Z\237\021eg\314\272\006\223"
+	.ascii	"\323\205kF\236\202\244\241\316?\252\374H\210z\341\277\007&W\227"
+	.ascii	"\225\322\247:\203\036!\313\260[\234\347\002\257\b\321\307$\227"
+	.ascii	"V}\210%\306\253\264\352C,\352,\306\005\326I^\001\365V]\225\377"
+	.ascii	"mQ.Y\006yf\003K\201\306\f\230t\215v\305#*\316\360\272\263a\204"
+	.ascii	"\360z\322C\365 \037\243}\023\253\376ar\242\003\224\221\301\030"
+	.ascii	"\212\0207Dz\021\035\264\r\031\261\031]\314a\306\263\204\372&"
+	.ascii	"\247\275\313\376\306\243\264\341}\031iz\264\006\203^P\303\016"
+	.ascii	"\02527\026\254\036\202\341\361\245v\372\304 .Mb\347\021%(\006"
+	.ascii	"0~t\242\214\332\3165-T\356\342%,EE\347\211\033\3429gy4\022\006"
+	.ascii	"\031\304./F\342i\204\024\031V\0342\363\342\341\236\254\264M\301"
+	.ascii	"\320f\307o=\222]2\253\325\226\271"
+	.string	"\2747\036;z\243\205\bBo\006|\\\220\036n1n\036=\032\375\342\034\232p|\300\326\036rB>\307\003K\026[\221\200\336\024x\027:m\364$eH\214I)\261#\217 Tp\005}\305\375A\332\022\207C+_5\360\0130\255\277\323\340\364=\007\"\226\006\2731\367U]\306\351\b\303q X\212\021S\30458\022\342\354`\264\324JL\204\346\3641\341+|;\002g\266\002\2159.TC\250]r\230\020\220\273%\326$R\017\262NZ\b\240\234\274\r\202\360\204"
+	.string	"3\031&^e\232`\210H\234\307\246\246W\330\254L\233\201\334\327\321\226k\226\271\371\377\205\034\223\n\304\251\371x\337\316<\204\032\245\024\372*l\322\007$\002\365\b\031\233\231\347\201\342f\210\256\024\235e\315~\360\236n\236o\020\004B\344\255\320g\305!\241mx\",\340W\344+\301\234\2605\236@\312\020YP\363I\215\2368[S\234\025\272\f\301\210\020s\2316\215\237^\206-"
+	.ascii	"V\314\342/\371\027|)\367\265Mi\320\202t\221\016T\003"
+	.text
+	.section	.gnu.lto__update_checksum.98.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\344\001\205\020"
+	.string	"\246\036lF\360\316(\035\030,[Q.\267\177\234su\271\021\255&\2225|\362-\272e\252\366b$M\214\372\r\264?\362\327;\2057}'C\362\251\321\2608\3345\270\3125\022J\265i#2\026\254\200b\337\022\262\267\224)\005U"
+	.string	"V"
+	.string	"W"
+	.string	"7\260]z^`\273\264\312\3069\37025B\340L\240\255\230svk\301\017\037\301;\252\3522\256\252|\004^\n\327wr\0319\226w!\300\307\212\035:95\247]_\337Jc\206\225\357iwp\343\325\\\337\312\225k0\347\264\272>\225{\273\355\222m\221\255\242\007"
+	.ascii	":\370_|\366\177\016\336\334g\367\026\3252\252cToTkT\237@F\007"
+	.ascii	"\030\225\303\3029\275pg\332\310\032\f\030\366LJc\300L\221\241"
+	.ascii	"\300\021\263\243`\325f R\035Dy\347\214\225"
+	.string	"Hp\265\277\341\034T\237\245\036\232\323\305\003\2109\301\005>\340\2714\030\261U\234s\316\2702\333\034\3376\264\234\3143\321\322\260\322\320\362#\356\256\374@y\342JO\304\213e\027t\342.\025\272\337\335\267h\305V']\035\361\032\b\312\003\343\247\266\313\357&\363>\274XP4\334\032\t\326\267+\263\301\023\355x\321\311\361\272\330\241\317\374\002\036\363\017<FHq\3441B\212\245\220\b;2\031\201D\2236JH t&\221\256$2\222\320\221N%\335F\206M$!\247\316\304d:u\030\340\374\272\370S\201\205\r\312\256\344\312\354\321\264\300\026t\261\334\276N\373a4-\263\r\255\243~v\333\227O2(RT\307\017\217\332\270\005-w\343\325Z\001* p\202\231\224\333b\340\225#A[3Q\221\243`\024\003C\214\273\r\030\351\263.\235\346\363`\333\240\013\347\005\217o\230\255;\030\2363\340\324\006\263"
+	.ascii	"7:\"\312\035\243\371\2256p\255\r\216\035\003\263a\006\246\224"
+	.ascii	"\035|\f\343\006\340\210\200D\t\367\022Y\310\023\224\335\f\242"
+	.ascii	"l\272\350\023"
+	.text
+	.section	.gnu.lto_UBLOX_parse_gps.99.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\024\031\025e"
+	.string	"\312\237l#O0\016\333\031\003\307\260:/\345\306r\016\037\331\251\331\371}?\345\017\031\216\304\003\253\241\362\003\307\034\226U\200\263wl\251l\225\361G\210\n"
+	.string	"\200"
+	.string	"\301\033\n:F \350@R\241\307\345l\274\025\242\001\021"
+	.string	""
+	.string	""
+	.string	"\300i\367\020\021\"r\247\224R\t\002\020\0020\002\"Tg"
+	.ascii	"T\347\020\252\263Q\350<\265:\203X\235\245\204\316\037\212\316"
+	.ascii	"\036\204\316QE\347\0167\316PD\347'\242\263\323\352\334\264:3"
+	.ascii	"\021\235\227\210\316JE\347$\2423\022\321\371h\350l\244:\027\261"
+	.ascii	"3\221\320yHu\026R\235\203Tg v\376Q\235}Tg\036\325y\203\352\274"
+	.ascii	"\303\316:\252s\216\352\254Au\306Q\235oT\347\242\352Ld\347\341"
+	.ascii	"\352,\\\235\327\325Y]\235\203\rm~\325\331\203\316\r\202\007\271"
+	.ascii	"\2641jp;\336L\324\355\021\330\306\245S\2654\351\264nh;s3w\224"
+	.ascii	"[MJO\301\321i\037\004]\257\250\333uS7\304\316l\352\272K\247a"
+	.ascii	"\253\034\03563\016n4\276i\263>\303\321P\253v\273\334\3261\205"
+	.ascii	"S\352\271n\364C\253\3144l5\251}\326V\203\335\263\266\312\"J\340"
+	.ascii	"\3406\b\013\tC\b8\035Z\322\251\353F\215\017V\304;\035\2146\017"
+	.ascii	"}\333PONMLKJIHGFED\035\206\204\202\200~|8\364\360l\330\321\311"
+	.ascii	"\321\200sS$\016\205\253\032|o\271\221\r%\254\013\343{\353\247"
+	.ascii	"\034\256\244\233;%\333\274\211\t\213/\261]q\245\244*\216\304"
+	.ascii	"\206\346G\016l\245`t\026\305\213\314\232\250\257\314\272CP\210"
+	.ascii	"\325\203I\213Y\266\020D\341\247\247\345\351CI\272\240\264\020"
+	.ascii	"\224\016*k\240\262&\376\343\304\214\232=}8\004G`M\207\264\230"
+	.ascii	"%[\020\307O\213L\217-\225x\017\n\316\023\326\033\302^\337q\266"
+	.ascii	"N\021\247\347\024\031[2]\003\016\233\222\230\345\020\277Q:\322"
+	.ascii	"%\244\213A\017L9\037>aNH\323cK!N\024\263\f\022L\032[~\371PHU"
+	.ascii	"@3H\013f}G\272\330Z\b\244W!\025\220Vs\270\262\202Ih\355[\\X\036"
+	.ascii	"\364\267~&K\210x\345\200\366\221\245\225u\350\272n\221+9t!\225"
+	.ascii	"\353\272\354J\256\256\346\250f\376%f\236b\376)\013|\305G\362"
+	.ascii	"}\\s\036\007\232v\227\303\375^\027rl\271 m\223\216\373\312\371"
+	.ascii	"\226\273kb\226\246\361\215\326\315\003\332[Z\303\323xv-\257$"
+	.ascii	"\n\016\344\350\324.\361\037m\223#\247\227\240\341\373\307\333"
+	.ascii	"\005\216\313\224\317K\373\225'\321\276\3417\273]\227m\n-Y\005"
+	.ascii	"o\\\231\020g\204\277>\2567\217\363\255\345\265u\363Q[\276\326"
+	.ascii	"\342\357h\345^\227&~\361[\313G\322\003]\353\350D\006\361\253"
+	.ascii	"\336\267g\221\217\2632\265]\207_\225v&\207\3731{\322s\264\355"
+	.ascii	"\223\226\254%\373\024\257[\237\227\360\351Hw\003\343\224{\305"
+	.ascii	"\346\270u}\341\013\333\262\240$\243t\233\030 fh\300\311o\375"
+	.ascii	"V\341u{B\325gn\317z\312F\206\026\255\371b\330S\373\240\301gv"
+	.ascii	"\321z1|\354`\264\032\002t\360:\317\200\003\022\360V&\260\266"
+	.ascii	"\372R\345\036+\320hbH9\231\031\3503\r4"
+	.string	"\231\260\353;\007\270\225\264\312\020H \301\267\330\333\366\204\262\200\323\301\313V\306\327\\\272\321\032\201\024\364\246zH\377C\341\364\323\013~\323\255\231\n\351\177\334\355\201\322\253!\377\3151\334dB0\253\230\225\321q\207\341qA\31452\307\375e\205\203\"\346\002\367\013\037\204\316\254\3145\322\205\273\005\307R\275\246fe\256\273\205;\256yd\341\326\302y\3036Z[\3556\342\306}\211\271F\334\250~\343-S\346\020\327E6\223\363\\\351F\005\335/\007dn\266n;R C\306\332\252\177\324\332\227R[\260r[\t\301\002\267S\302\355\301\332*\220\035_S\3515\017\270\2250\215\032\336\312V\271k\274\02661\346\231\327\225\0072G\221\376M\346\376)k]\220\374H\230Ug\032\252\363\214\343\003\252\363\002\354<\300\352\fcu~\341\242\241\315T\354\334\202\235Y\250\316+Tg\0258\316\002\250\316)T\347"
+	.ascii	"p\234Q\024\235O\024\235M\024\235K\250\316$T\347\021\252si_\214"
+	.ascii	"~G32\346\224{W\354\235OY4\316\206\305\223\301\270\246\317\312"
+	.ascii	"\23221\355W\316\226}z?\337\344\352=VMK\026\301\253f\3127\005"
+	.ascii	"\203\353\251\301S\356\201\370\251\377?v[J=\210\017\302\313\202"
+	.ascii	"\222\214\301\323\304Pa\207\206\r,\341<#\365\275\367\252y~X\343"
+	.ascii	"vf<\374\207\377:6^g5E\206\r|\032\343\341\273\354\315\353\203"
+	.ascii	"F=3\333\347aZ!t\035>\352_\252\005x\305\316\340_\254\244\234\354"
+	.ascii	"\237\317\261\201Mr\035\362\270\340\201\351\027\354\211\317\007"
+	.ascii	"A\327=\322Bo\212\007r\013oi\253\265\311\241\222\271\305j\265"
+	.ascii	"\274\225\334w`D\350r<\222\241\276\323\332\377\224{\304/-0h\304"
+	.ascii	"\232\270>=\324K9\375\322?\275Q\323;\255\310\021e\372\246\217"
+	.ascii	"\252\313\202\222\334\341p1\\\352\324\322\202u\033\273,L\357\322"
+	.ascii	"\027\372H\277\364C\177Y\314\244W\332\3627\253N\343\326\2025\231"
+	.ascii	"\266\244\3574wP#c:\334f\271\365\350\221~H\2325f\364G\037\304"
+	.ascii	"\323\002\274\022\301\257\264=Z\330Yi\301N8\253\030}\253\265\n"
+	.ascii	"\370\226\351c\325\213\024\220\203S\351\031\"\234I\273\303i\243"
+	.ascii	"\265\350gH\217F\247Z\013\366d\227V\364\306\267\347\233XM\364"
+	.ascii	"\031\234p\346\226\204\266\004o%\321\367\035\030\020\272\344#"
+	.ascii	"y\b\210G[!hx"
+	.string	"_~\326\n\2012k\301\220\234\036e\350\233\371\222\021\"\342\317\243N\343y\231\377\025\361\025\216ROZ\260&\025\204\276\307^0}<Ac@\037$\006\364U/\230\r:\037\272\331\256\220\271\345H5\f\030l~\230\300\370\237\035\235G\302>\244}\036\247\214\t\256\344\330_Ph\301\232K\230\317\367\227\234\005\312\360\374\002'\270\363\370\324t\260\026,\t\317w\220\367\313\333\234\\G%YC\207\364?\r\033\2168\217\336\371\rFv\276\352\225{z\341|\223\275\370\241{\355\312\223<\242T\277\370\255\017\375\342\177J\033Z\332\031\235gz\234r\357\305\353|k\001^y\340z\363\315\340\024\030\26250\260\301\201\f\r0\250\301\001\321F3\215\251\r4\270\300x\303\2061\003\033\026``\244Q\265\201q\212\003\337\320\240F\225\221\203\0337\252\2147Q\267\037\t;\300dm\355\311\271\206m\342\212\254\275\275c\365"
+	.string	"\003\274\177\222\223P`\352\346\332+\214\313\224\217\323\256\266\224yj\3610^h\321\322\036Lv8\261\370\031\357\205\305\177W\234\222)\327\325\364\\\342\332\246L+^\005\234\226\025,\274\271\251X\202\266"
+	.string	"l\254\224!\026\001~\202\260\266'\013\035\025\346D\251\n+\345\307\271\026B\330Z\031\337*e\2114\351\233\234\342\003\370_\201\354\245G\265\024\337\\\356\236?\345\330T\242\274\024\366\254\325\234\321"
+	.ascii	"\276\251\274\320\036\022\260\246H\337\354f\245\254(\276\n\355"
+	.ascii	"\317X)\303\217\362fl\232\224][[[E\361\023\204Q\351\203\302uT"
+	.ascii	"\330\027\035\322\377\216N\374\323\304\237\370\316b&\177\205'"
+	.ascii	"\263\262\302b\301\262\266j\342{\031&}\032}\223\241\224hnD\017"
+	.ascii	"<\320\225\263\274\016%\336\305oY\255.\276"
+	.string	"\001\233\243\310\242o\"i\027\377\300\367H\213\230\311b&\235\214yP\363\022;\"\3315\311\362\343\r\234~X/Q\322\3137\260\354\270\266\371\327\311\276\200S>\242orwx$\334h\035\345\202\320\3619\030\364O\365[T_\342a\220\370\022\237\204\304\003\335uw\320u]w\310j\245\372\343\3674\231lF\234p4:\322\366\366F\2120\211\f\031\361\315\367\376=E\0049\"\331}e\231\203{ G\026?\3300+J`\353J\370`\361@\220 \342\333\357m\323\007"
+	.string	"\327\361\310\271\214c\347\202\322.?\302q\205\235\bl\030\025N\036l\035\t\347\026\213'\365J"
+	.ascii	"\276ex\333<\241!^\307\321\210?\353\265X/\334JZe\366\005v\316"
+	.ascii	"[\311\316\375)\367\300|\216\343\nf\001?\311\2069\201b\314_\261"
+	.ascii	"uFf\321<\222\305\223z7\3047\337\313\246\357\177\255\013\026\227"
+	.ascii	"\320\217\0036\007\345Y"
+	.string	"\036\020\267\325\372\277\305\0354C\377U\360\3120\345\003\372\346q5\376Oys\022\202\001\250\262(!\321\322$S4$R\220$)\264\006\202\013\020\206AyT[\350\001\022\240C-\210\303\234S*G\224\244\003ZBJ\326\222di\236o\037\2633\241V\354J\033\363H\215\026a\005z\265\032\311\300>\336\037t\252\240\273\356t\270\326\372\r\217'\004v\250\331\214`\246I\347U\346$\206\240M\303~@h\236\210\233\300\006\303\336K=\250\313t\\LG\034\006a\377\r\b\313\203\231\005\020\034\277%2\220\016K\262\244\037R\326d\2120K\374\345\2225\004\222\360H\205B\372\177\214\304|'\006\340o\212\311\323sX\241\240E\345d\274\345\356\034\333\027\005\205\025\267\0212\024\032]\244\351j\361so\364\327\342\364&\255\242\360\320:\366\226bfE`\371\017\233i\376\371|Pz;\177\3144\220\317\230\214\243x"
+	.string	"\205\2506M\017}V\202\005\036\204\002n\022\250\260\346\241b\347\300\351p\216F\224\361Y\007\301'TD\001\340\r\241\262]\202\302\244[\235\243\362\300\313ux\365c\311\177r\217\226\\\031\320\201\t\006 B\022w\315\216T\2717\302\"\312Te\322{/\205F\370\305\201T\021\303B?\376\215U\3713\2051q\202j\230e\177j\036:K\305\021O\020\007\230\336\251\013#\320\261\313\247\004\3126\343\324\302\357"
+	.string	"'FF\202 \r\016FNo\227\354\333\274\034\354\301y\031\246\177(+\315gX\305\267\330:\367\301\252\034{\206^\232\300\3164\376\036C\372\002\224\360\353\321B\031\250\t\257M\366\321\003\302\341\252 I\311\2508\002\354\316.\370\033$\272\272\346H+\321\276\025y\320L\005\326[\214\004t\205\255i\247E\235\310\265\\\255@\020\216]\340N\276\334\207\206I(\337\374\374\032I\001g\016\235\211\262\377\020z\226\365\032VX\321@\004\307t\006W"
+	.ascii	"\332\330\200KTVz\332\345\276\005\230\177l\234\355\r\203k\270"
+	.ascii	"}pz\215\355*\206\332\204\024\266j\260bFq\3756\360cJU\241%\342"
+	.ascii	"nyV\220X\245\254i@\355\177\342\261X\220@\200\241v\013\210\356"
+	.ascii	"5\304h\336\\\347T\235n\264\270/\261\304\333\004ZT\032}\247\036"
+	.ascii	"\2637\235\342?\252\0217\303b\037\243\253WXQ\026\216\b\\2\374"
+	.ascii	"W]\356\326\277\227q\245%\333\356\201\244m\373\217\276\256\320"
+	.ascii	"4k\352X\216\300\202"
+	.string	"\0036\336imZZ>U\331\232S\234\331\215\264,\316\212\346\205>\0236\021\t&Y1\346\307\272\202\364F\035\273\236\246)\212`\377\246`F{c\376\267\342\016\314\367\373\344\326\3240\342\346\350\363\243\fB\243\353\270\006\201\356<\021P\230\274\206\375\326\251\273'\275\":\326@GyC\277`g\"\304]\336\353o\021+\220\224#\353i)\313P]\265\3718\370\275r\322V:W\027\356\215\031\353C\227\307f\314\254\251\272\337\037\322\3753~\020\333\307&\2471\320\227E\233\360\004\037W\222\2203\303_\342\322W\3523a\261Ps\0053\214\r\232\353h\243\253\026\264\262(\005\237\257$\376\306{a\037\031\375\nH\335\337\322\307\276U@\352!(u\030'\317\027\nQ\211BX\253\b\256NO).w\317\"\023`q<\t\242\b\315\321\333\311K\341@\200\353L\263\316\304\323\355m\245~\003\202\210\001\354\001\177"
+	.string	"C\013\354Kr\331\365\352\177\243P\337\315\343nR\320\034 \212w{\222\365Q\357p\016\335H\241\300\020\\\373\332\034\267\216\347\030\270\357\275(\251\365"
+	.ascii	"|\020\226\332\372\206iT\031\313C\300\336\354B\017\030\364\240"
+	.ascii	"\016\001"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOX.100.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`F\020\265C"
+	.ascii	"\372k\030\030C@bR\007\255\272Y\334\275\023D\035\232\3500d%\213"
+	.ascii	"!\204\367R!\026\236\214X\335\314@\324\005\fU\307v\177s\220 \312"
+	.ascii	"\032Y\177\216~\265g\260c\360\343\307!\312\222\007\"\036\005,"
+	.ascii	"\266\225M\244L)n\001N\001~\001\257]\332\303\375_?\273\277\377"
+	.ascii	"\333\303\371\307\271\221\313\016\033\217um\227\367\027\265\306"
+	.ascii	"ql\303\237\213\033\377\365\327\362[l|V\353\311\013\033?!t\t\244"
+	.ascii	"\202\377}\372\344\376w\370E\373\337w\337\341\357\346Fw\277.\237"
+	.ascii	"\270\260\261\220-\245\276\261\036\370\327\245t~\353\226\3538"
+	.ascii	"\216\322\325\3051\026\201\007\200\377U\320`\207/\225_\\t\022"
+	.ascii	"h\331\300\336\006\343\030K\245\2378\362\207\330we^~\023\323\222"
+	.ascii	"R\022\222\362\310(\211,\"\032\022\n:\002\375\030\213>0q\277C"
+	.ascii	"\235\227\376\017\250\200\314\276\271'\3277]3\2235\317\3220)\004"
+	.ascii	"\255\371{\316\266\241\201@1v^\315i\315JT6\314$\266,\031i\250"
+	.ascii	"\277\006\307~\317Y\035B\300\003\306\346\343\322\262\322I\330"
+	.ascii	"\332\037\021'\304\275\0019\254\265K\026\266\366F\311\343\223"
+	.ascii	"\031%#\213\250\231h\372CS(Y(\350\370d\272=\224\232SI>B\221\205"
+	.ascii	"E\037h\317\031\035>\305q\374j\316$\371'-\215\261N\361E\363\342"
+	.ascii	"C\224F\351\203\253\246\177\331\276\271\347\220'\3569\241`y\017"
+	.ascii	"\371wh \212G\344\370d\016\223k\232\374\275\333\347\037\317\257"
+	.ascii	"<\314\327\327hgfcbH\236"
+	.string	"\314y\244\207\327\336T\216\320\025\237\314b&N\210\343\330s\363\031\366\356\364\3569\313\335\023\270\037\305\002p>\316rE\213\026\373_\035\3236k\202]\271\020.\023\023}\255\374\326\236\322oW\231'Y?\257\214\307\237\356\337\3553\234\211\007\003\271\262\036e\232\226\355PK\275\274O\340\312z\374\377\271g\316:\332\215\177\037\314\206\265\256\361\371\263!\336A\331\372\257\331U\254u-\317_\315K\210\306?\315\020\360\316\337\214\206C\306_\233\177I\254\315\223\"\306\337\356\377\353=\013\264\256\305K\300\370\207\3619p\034s}\324\237i\377\0135!f\243\355\022\370_\334}\316\177\324\347\344f\\`\030\213\345=\356/\367s[\376g\356\002+\177\363_\177,]\245%\214\266A\273r\241;\226\231\265\324\375\277N\232g\325u\231{1\273\025\234\035\304\303\275\177x\353\377\324_\337\245<;\001\237\354\003<{\024\234]"
+	.string	"\234="
+	.string	"\234\035"
+	.string	"\234\035\312'\373\323\316\356\004go\202\2633\355\354K\304\354J\304\354I:;\0221\273rg?\332\331\215v\366\344\316\216$f/\"f'\"f\037\"f\027\332\331\203v\366\343\316\016\264\263\377\020\263\033w\366\342\316\356\263\263\303;;qg\337;\373\273\263\017wv\275\263\377\210\003\200Y>.Z\253\356\303\306B\n\t\343mo\306\267\352\235&\267HI'\351e\225\364"
+	.ascii	"(\320$\255\345\255\311M\322Ei\025\220\310}C\276n9\231\271c\310"
+	.ascii	"m\032\226\314\3428v\360\257g\266l\345\340\177\366\257w\360\340"
+	.ascii	"a\377\313\300oL\251\221t\320[U\017l\317\320\335[m\245~\262l\336"
+	.ascii	"\232R?\021*]\025zt\305H'\365Q\025\243\244VC\352\244\024\244\316"
+	.ascii	"A\375\322\205\352\375\313\241M\021\"\376\326\216\222\202\n\027"
+	.ascii	"D}*Y?\177\253=\265\372@\002\357,:v\324\322\374D\007\225\313\340"
+	.ascii	"\217\221m P6\363V\273H\277]xM\262j\212t\031\221\036\322EdD\272"
+	.ascii	"\351\245\266\220\036\322\337\203\220)\244\211\276\322\n\203\224"
+	.ascii	"\0345\220\016Jr\004\022\373\321@G~t\216iauk\004\020\257\373c"
+	.ascii	"\324\236\211\344\"V\"H\220\330F\035$M\273\003\333S\f\363"
+	.string	"\321\260.:}\340 D\r\003!\352\034S\302n^n\246\305\235\3213\3720Qbj\247;\266{\240x\365Po\257W'\375\240C\335\365M\256\326C\375=\242\314\\\230c\255sL\355T\241h\366\240\351\225\321\026\tQ\344\274&\027\217\212\033S\301\352\330\224\036\274\0321\005\354\216\335\331\271\323\344\376\0306\037-%\363\202\305\267(zM.\254\245\276\265\351\244\230\376\t5\003\267\020}\317-\013\247\356_\216\232d\273\265\324\177\316\211i\233l\337\034\367\227\333?X\317\242\005\215\031W2\366U\215+\026C_1EC\206\013\252,,\252\030XW0\250V\314\240A5\205\364,\031-fP\325\310\312\232Ae\304v\275.\363\337\336\245\001\013\303\224\315\236\205\266\r,\214\376\277\227\222\322\307f\236m7\260K3=\353\3016\021(\220\335\227i\313)\371\233\004\364\247U\33125WV\303%\306\024A\315\316"
+	.string	"]E\355\253B_\270:\257%-\365\377\373(\301(]Eu\323\205\n\320\334"
+	.string	"Z"
+	.string	"`\016\324\242\262\264be\377\033@\343\240\266\351B\225"
+	.ascii	"\310\371\313u\017\245\001\300\321\202\375\240\264\f\252^\367"
+	.ascii	"*\341_l\317n\226\327\027\3107q\034\377\231?\214\375o\324\033"
+	.ascii	"\301\256\314\227\331\300XbYV\253\373\337']E\325\253B\223\234"
+	.ascii	"\364\223\255q\322\357\366Q\334<\301h\033\222\226\372\002<G \264"
+	.ascii	"\2363B\376\320\3202\276\241\322J\233\311y/\214\336\340i:8w\036"
+	.ascii	"e2\232\027p6\223\317,\331\226mK\267\245\333\376\327J\023\360"
+	.ascii	"\263+,,,|\255\375A\203\320\037\367\007\210|\311\366\301E\231"
+	.ascii	"\272\257\356\312\344\210\253\rA\305\033\024lCg\313\225\365\030"
+	.ascii	"5\3511ZKfv\257\265\231t\223\326z\234B\016\243\005{\246\313`*"
+	.ascii	"X\270pa\377\313\244\211]yU\242m\327l\366^\312$\265\324}I?\231"
+	.string	"\334\222NA\325v\335\304e\271kr\367\306 \371r\201b\250qL\307\030\242\021\021\021)H\222\2445\001\006\204\030\246\356\352\001\021\3408\306\034\232\271I\n\351\320\007\302\342\2470\246\230\351X\375t\262\333\376\220\017s\340h\347T{\3318\254\246\303\362\320u\376\024\334\270\303\275.\352\372\233[_@\203@+Hc\261%\277\217<\3304\275)\343\254\206CG\316\225\312\341b\004\354]>8\311\363\314\024\020\367\230D\301c\211L\327z\177}\006\242\313j\207\330\260\350EN\250\275\023~\350NR\t\243\2320\300\3153\177\020~kwH\271\212\364;\371\233(P\353\227\247\355\024\257!\276b\223\257\370b\202\313Gy\022\021\0343\200\342\340\007\226\301\366\243O\354|\230\236\301+?\301@i\023\363;C%\277v\337\006z\335\306mf[\016\323\343d\336\375\026Za\360\255P\024wn\200D\005\005\322\027\177J"
+	.string	" \365[}\032bB\325\324\031R:\266\222\365\266\027\357\375\027\266\210_\352\013j\327^\241~\226bP\002\037R\212\266\230\2733\266\275\223\bo\225\031\337\324\276\267z\207;L\222\237t\346\037\317\316\243W\201\270[\246\211O`'|S\b\236\320\262B\277<^a\327K5\2707\336Ou\237\234,\027K\353v77\322\243m8\307\036\326\204h\264E\374R\213\300]\263MR\263`vV!\267@_\373\210\320\022Qb2\232\267\351\342\t\211\325\233\327b\217\021}=\232\217\016\253cA\035\260\027\333\177\ra\3735\275\b"
+	.string	"\304R\303d\0036\r\345\342!D\024\212\t\f\243\326\212k\277\211\325\335~\251"
+	.ascii	"\261\bg\320\375\203JP=\312\355"
+	.ascii	"&Q\221\345\263\355\230X\332\177TZ\253\321\345(3W\304\rq\256\351"
+	.ascii	"O4o\360\233(\337T\235\252\2012U\003e\252\006\245\344\214\230"
+	.ascii	"|\367$\240R\2518\0036\257\216\345\271P#\21285\213&\235\r\347"
+	.ascii	"\363\213x\213:\253\035SO&Q\346\344>\314\240\365\3555\232\227"
+	.ascii	"\235Z\021\002\254\032H+\020\002\205[5\302\244?s\025x\272\301"
+	.ascii	"\265`\\pY\246EM\374A\255,\2167\244\277\334 8\260D\021\364\344"
+	.ascii	"\356\324m\016\002Rr\"qL\342\n\f\003\306\244\336\206%k.\274\266"
+	.ascii	"\270\022\256t\370d\351\221\311\001\013#\001L\030yCg\203\177"
+	.text
+	.section	.gnu.lto_gpsHandlePassthrough.101.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\265\n"
+	.string	"\266\224J?0M\225\016h\373\276V\3533\247r\265Ec\351z]\244<\033=\267\036\335\334\032\016\264\243O\320\0331\2630!\034\342\257\207A\006[\201ME\246LY%iJ\0068\222\304\332H\266\224)\0058"
+	.string	"8"
+	.string	"6"
+	.string	"\313\001\b\201\002\231P\354n\246\026\276\035jn\3767\334\242\363\270\303\bW\270!\242\240\302<\017\224\2148\201\036\237\017\274O&D\300\356:;/t_\267=\300v\207}I\241\227H\354B\370X{\272@`\260}\237\303#\347%c\\8\241aw\261_6\307\306~\035\263\235i\177\004\330NZ`\335\235 \342\303n\3640G\344\2277\333\204\006\203J\240\003\352\223+C\362\352GM\202|\007\365\361w\320 \305I\225\372(\347\324\353M\245\022\240V'?;zRG\366\341\252\310\206ix\322\237\231~$%\264X\001\224\r\245"
+	.string	"te\242\301\034\3104K\206\300B\271d\225\214&\233dX\303\030\310d\033M\313dX\354\034\256\212\374eP\245:\352\201\027\351\307\213\226\357\254\312}U\341\363\240:\262\255\240\002\006\017"
+	.string	"3\241Mh\214\327"
+	.string	"\036{-\r{\005mj\t\361X\207"
+	.ascii	"]\303{4Q\006\025B\245.\213ky*!\247\024j\017"
+	.text
+	.section	.gnu.lto_gpsEnablePassthrough.102.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`i\001\005\017"
+	.string	"6\035gF\360\260(\035\270\377\016B5 \237G\250{?,\211\217h{\376\331\305S\216\026t4p\312\005\232_o\255\236\214\272~\312N\373L\001\370\036\203}\243\223\007\223>\016\007\227\226\246Q\244\323\274\300B \331D\312\224\002R"
+	.string	"L"
+	.string	"V"
+	.string	"\273\256\0303\273a\002\037\340\036\035\036d{\344>`{\264\311\246\361\360\265\005`\344X\315n\354n\247!n\272\246i\362/{\007\330:]c\271j\bl\\\324\360\264T\032\bK\004x\331sC+\225\t\200\301\356:\301\326\312\035o\273\201\355\005\366e\004(J>\314)*y\360\321W\331\036\257\017hp|\200iAe\216\035\236R]\354k\273\273V\227\375\330\337yz\323t\324\264\226i}:\237\276\347/$X\034V.\263\261\313\312\301\2615\361\305\b\017\333O\373&\016cz\254\364"
+	.string	"\001 4\350\311gq\325\250\004f14+\226\324_863\252.\266C6M+\244\230\241J\034\347C6UMUf\325\222r\350+,p\273;\342\307d@\341`\245\355Q\265#\206\312\034\025\251\020`\263\022\\v\376\322\241\206\313\253\215\341\313\2036\240\322\223\375\023\017\244\221Gr\002J\361F'\244\357\373\220|\"\220"
+	.string	"\227\210|\"P\347\205\272\013\241\017JW2\372:\221\017{\"\223QG\362\274Q\347\021\356\265U\227\035x\bolP\232\362G\372\021\266\207\022&\214\274vQ\007;\272\251M\341\263\322S\213M;0\231\033\315\223QSm\023\220\202\031"
+	.ascii	"3\241\221\037C\016\213\20767\320\336\223q\3656\362^\025\304b"
+	.ascii	"\201\355,=v\263\241a\006D\326\304\030\314\241eD0\\Bs75\037M\013"
+	.ascii	"\001\230s\t\266YM\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_GPS_calc_longitude_scaling.104.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\305\n"
+	.string	"\246\026M< M5\035\004\341spI\004\234*\276\225e\344\036\207\001\301\367\205\217\027\2007\\\t\211\034kzT\bb\200\215\343\026\021\004X\2200\020\034\360\211\204Ar\316\342\331\217\337M\312\224\002;"
+	.string	"9"
+	.string	"="
+	.string	"\266v5|\"v7\201\035\214\307\003'\260x\254.`\361\350\315.\361\356\263\006\276\217\205Q\305\356^\272\341\333s\363/\272\305m,O"
+	.string	"\013v\327\311m8\267\336\266\303\366\303>\203\035\373\335\035\037\372\253Lk\2463\323\267\nt\270\300y\311\333\305\020\246X0\216\370\360\356\267\177\221\033\266;{_\316&H\342\343\220\332\335\307\243\0210\236\366A<\304\366P\205'bF\265'P\310s\252*\002\235\300\214Zl\357&R\031v\255 \fI\231\335\213#5\352Q\032\020&C_S\023\245\251\250\364\032\300S:iR\227\f\355\316\222\352\261_\355\356Z\003Z\203HVU\"\020\324\022\210Fypa\223K\302$\022\341\222d\332\005\031`\214\342 \273*\030\226]\215n_];\266@\037xQ\214U\375\321I\366|\017\326l\312s\217\276M\213\307D\301\005\f"
+	.ascii	"3A0\f\202\353\213\"D\026\t\227\307\264\340]\263\273p7\244\250"
+	.ascii	"\301\251+\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceFlownVerticalSpeed.105.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\257\tu1"
+	.ascii	"\352V\264\022D`\236N\007s\301\374\356\256Q>\322Y\304\271m\301"
+	.ascii	"\3740\255\264[\221nw1f\001\r\321Hs=c\tw\307\257H7\3548%)\330"
+	.ascii	"\230q,H8\256\217\333\230+\305m\267\345\271\t\331\335\366\336"
+	.ascii	")\245\024\r\001\005\001\035\001Bw\016\2723\320\235Y\326ye\235"
+	.ascii	"\177\254\263\352\316)\353\214\272\363\263\316\276:\367\203\242"
+	.ascii	"5'X[\ts\257\215\276<\267.\355r\326n\335p\335l\375s\325SW\231"
+	.ascii	"\233\271\251p\277u\034\007\341\262\236tty\367n\221Z;u;\312`C"
+	.ascii	"7&\357^/\b\335\306\034\354\264{\n\007{\255\245\264\315\306s}"
+	.ascii	"\301n\307`C'%\357\336\213\240S\206Z;\0356\221\332)\332B\252;"
+	.ascii	"\263\202\006mCyq\324{rP\304\334\313\366\304Lk\247\3342\343\035"
+	.ascii	"q]$\003:\265\256\267;\367^\342\017\351\266\177|\204A \273\376"
+	.ascii	"\324\024}o\271\177R\354\362\013\331?>b-\344\321A\036\3500n\207"
+	.ascii	"\003\321\246<.v\232\310\306\221%\232\227\016g\227\326\260\376"
+	.ascii	"\251\361bv\271\252\364\024\035\266\365\222\032/\261\340\027\227"
+	.ascii	"\243?) `c\375"
+	.string	"?_[\350\360\336\333S\332g|i\271\377\244\356\275\354\313/\260f\240ff<\314\\\201\231\245\n\334c\232\f\006ng\247\234A\203\006\265\323\337w[\247hN7jk\314v\357U\277\t\246U \336\\\243\257\212\351\260\341C\212~\204;f\322\373\272\323or'\251\304\357)\275\352u\222\352O|\366.\246\226\227\376\322\301\303\207\017j\247\376F\247\035\037\023\375&\b\225[Ko\001\021B\204\b\265\323\366r\266\271\323Y*\267\225\276\222\305\355\344\021$Rn\022j\2470\234m\232\320Iz\237\337{\221\377M~\241\"\370O\332\r\241\362f\313\361p\177\3237\226\256=I\357c g\236\242\362^\366\177\025\264\276:\255G2\263i\3717\231\033\275O\306\314:\023\205\316OBg\247\206\322\215\240\331\232\233\204\316\007\334\231\311\235\r\270\363R\320y\350\316JA\347\002\356\234\344\316H\356L\300\235\007\270\263"
+	.string	"w>rg\243\325\271hu&Z\235\207Vg!\240s\020\3209"
+	.string	"\320\031"
+	.string	"\320\031hu\376\001:\373"
+	.string	"\235\003\275\f\372\341\326#\031\300\373|\200\3776\3121- "
+	.ascii	"?\017\364\255\314k\270\376\371\306r\307L\340\254\245\031\335"
+	.ascii	"\2727\311$|\346\366G\033D\355\245\317\017\271\036\311\301\027"
+	.ascii	">:\247\314\003>\373\301o%\022\337r\256\343U{v\246v\n|\bfMO\036"
+	.ascii	"\031<\035\331\246A\371e\277\2738\361\370\200qa\270\202\3374\323"
+	.ascii	"\3537\332\036=\353\267\227\023Om\315\311[\256\337\332\2638\022"
+	.ascii	"\353\262\345\232\357\251\357\034\333\256l\257\016;5\235\243\003"
+	.ascii	"\275\236\323\232\261h\213\264E\324<#-\347\330pO\2746\255\335"
+	.ascii	"\236qZ\256\341\264gC\317{\223\275dn\223\364\233c\224\222\276"
+	.ascii	"k\323\030t\372\344\226I\253\346\275\344\216k7\313\261$\317\r"
+	.ascii	"{$\003\277\311\276:\275\321\2140\274\337\323\037\370\031@]\245"
+	.ascii	"\036\3704i\267\206\312\231-\307\203\262O\232MU\203y\256qz#3_"
+	.ascii	"\277\031\245\323T5\\\331\2757\212\033M\327\265R&P\240\240v\372"
+	.ascii	"\364l\377.\250\277o'\026\272\314\205\365\336\255\250XWE\023\250"
+	.ascii	"\261h\342\257\212'N\0245`\245\2402\032YL\371P\265(\236(Q\304"
+	.ascii	"*\246(\002y\n\352JE\025\321\252HLQ,\201\2028e\274\"B\r\261\225"
+	.ascii	"\n*#\021\313\312\312H\f\262%\033\275O\306\254\2229u\311\327\342"
+	.ascii	"\246W\302\301\231G\215\311\364I:\316R\357\354\210\364<\322\246"
+	.ascii	"\025=\2150\275\321\271\307g\300\311\213\020I\342eC\204\030x\027"
+	.ascii	"\316=\265\245g\346'';\002\225q\353y\020\237[\352\031\361\037"
+	.ascii	"G\2452\037mZRY\217\245w\341\264\303\3673|n-.\006\"\204\210\364"
+	.ascii	"\207Co]{\260\310\376\323W\355\004\313(\375?\273\222N\201W\372"
+	.ascii	"\240\267,h\222\276\300\243o]{\220~\300'\375Q\035\245\023\002"
+	.ascii	"\337\364Ha+\b|\207\271c\376\236\315s\252\200\037\360?=J\264\243"
+	.ascii	"7z\0019\216>\n\307\021\352F\233\346\004f\224:q\326Q[\3639\272"
+	.ascii	"e\241\367\002\221\220\327\346}\\\3645z\251G\364C_\364\255\034"
+	.ascii	"\323\"z\226\231\264\3424\206\276\307\234r\370\204B\277\324\013"
+	.ascii	"z\241\3779\345\231\005\036`G+\246\006\200\275\250Q$\007\225c"
+	.ascii	"\252FD\202$I\ni\f\240\002\221)#n\021`\251S\210\212h\232}\306"
+	.ascii	"B\364\207t\343\251~\265\255!5V\346mr\3639?\204\231\304f7\322"
+	.ascii	":\275\366R\304u\214t\022J4On\360\0328\222\220\002{\031\034\312"
+	.ascii	"\350\030\215\352\334\226\271\366a\341:\231Cu[j\033\240?\267\374"
+	.ascii	"\212D\365`3\365\314\250\215\316]\273:\030\247\332\b\216\004\002"
+	.ascii	"%\213\037\340@\251\274\322\335M\351X\212\231\320\232N\217y$w"
+	.ascii	"k\342\321F%\210\nL\n\227b\326 'HJ\224\207\212\241\355\315.O "
+	.ascii	";d*\027q\265\243\031\205\361\345\026h\330\242U\315u\324\301\342"
+	.ascii	"hr/\244\355\201N\311\016\326J\267\263\266\"\237p\267\261O\315"
+	.ascii	"\230\024\207\274\240\003\322\315\260\345\235\377\277\024w\023"
+	.ascii	"\306_\332\303e\206\316\201\b\215\314*\220\305\236\302V;$\212"
+	.ascii	"L\3134\373\016\r\347\267\252A\215\354\351\302\0055k\016Uc\370"
+	.ascii	"\206>@\232\236\325\002a\277\204\226\274\303\205\272\316\342O"
+	.ascii	"\001)\0261J8\363\222\246+\344\354\204-\260\"[\301\335\022\204"
+	.ascii	" \021:&)]\022\037(\370\354\324V\251}\300\224=`I\243[j\216\301"
+	.ascii	"\001\3675\233\300\341\375=}*\236wj\244\005\035j\336.)R\2450\326"
+	.ascii	"\202\203\273\272\366+\265\303\310#0\352\231|\335\003\235?\033"
+	.ascii	"\214\275\255\013n\263\371\003"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.106.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\245\003\035\030"
+	.string	"\366+\227F\300\032'\035P\351\351o\027\257N\247\""
+	.string	"\243I\250Fv\335o\322\303\204\303\216\234\202\026\257\177J'v[\303\353e\225-v\2544\370\334\267 \b\242d\020\202\001\0349\342\277\225\364R\305\313\241(!d\023)S\n\201"
+	.string	"u"
+	.string	"\215"
+	.string	"\016g\253\236\013y\217\272\004\305\204\346\234=\376\314\341\345\207N\324\363 6\272q\315\246\314\303r\204\211\220\203K\343\200\2277\037\340]v7y\227\017\275\262\275|vc\026@2\363\"2f\316)\256\215\257\376y\262[]\371\237\005"
+	.string	"#\314\347\237\214{]\203[\0231\003^\344\030C\330\217\312\026\332\275B\230K7"
+	.string	"\254\325\335\3149\017\344\352\002\346R\375,\3149\255#\f\306\r\336\366\264\275\300^\\\227\273\023\226\210t\316\351\263>\340\231\366@\016*\325\226\\Z\306\377\001\357kZ\353\013\250u\"/\342\361eV\261\320\217\227>\213\225J60\261! \226\346\354YK\267\206\375nn\220\255jS\247\2669\355\256\351\3244\235:T5\250\352o\325\336\252\245\252;U\257\252U\325'"
+	.ascii	"\241H\355\312\020\2443k\233\315\027\2713\263\212<\322q\332o\337"
+	.ascii	"\027r\232_\013I?c\302}\355\035N\346\244e+\272y\020\256d\205\303"
+	.ascii	"\251LI\362\3663p\f\361A$\327\366\203K\tA\200\202\217\364(\035"
+	.ascii	"<|\370\240d\304\261\f\342PB(\320b\021\1772\"\201\226K'r?C\226"
+	.ascii	"#S!\307\030\363\272\363x\335\352\217"
+	.string	"\332\024\022?\342\001\347\234\022|&o\222\243\263\263\263\342\022\021Ks\377l\316)\267\206\221+\016\315f\246\266Eu\273\223\267\253\266\211'9\201s\272$\370G\216\344\204/\2734\n\024\312\013\252\0229\251\316:\021T*L\210\250\223\230\342\224\203B\324I\251\304\b\002\214R\261\223\022W\240P)1\234\261\336\315\r\262\206\035727\326\266\214@\037\334\276\200A?\232A\017\032\037\270\\>\342^\344\337\202\373W\214\245o\001\214.\262\330\020\220\315\372Yn\263Q\006/\361\022\357R\303\2148\003Z\263>M\303\006\375h\263+\204\007\224*\256\365\261\215\376\345\026cNW\310\345\212\\s\262ph\266f\237\364\303\243\2459\207K\263\032K\250A@\344\bB\212!\212&\2300\n\243\306\300\002\031!#7\021\260%\204\2064j\266\003#h\212\360@\233\261\340:1yss\375\226`\313\\\007\245Ye\227\371"
+	.string	"*\262\2779\220\023\027\231c\344\363\354\314\252\253\351,\377\375%\261\376`d\200 \214n(0\211\00383nBL\027\377\241)\n\213\343G\005\270\\k\260d\354\003\203\030/\320\221Vy\346\237$O\325\310}\346\210\036\244'\0377\216=D\357\314\002"
+	.ascii	"Pr\207Zi\256>\351\005\364\324\301\250_w\333\370\355@\226H\273"
+	.ascii	"\2457z\251\001"
+	.text
+	.section	.gnu.lto_GPS_distance_cm_bearing.107.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\345\003\335\031"
+	.string	"\366/\246J\300VQ:4\366N\300\002\316\261\023\214\347C\244\201\356\342~C\344\027\363\326\034\0316\256v,M\033\244[\033>\347\315\315\330\351\377\225\025\034\200&\201D\026\"\fD\2617d)\211\235\231c\304!\350\265\375o\215\220-wJ\001\223"
+	.string	"\200"
+	.string	"\221"
+	.ascii	"?@7\306\361\034\271\023\271|\345\2513I\351H\305\222Z\353\201"
+	.ascii	"\207\316\200z\030C?\204\323\342\302\264\321\001H\302B\r\244\t"
+	.ascii	"3p^V*\217\306\n\006\277(\261O\3731.#w!\234\263\324\352S\356\250"
+	.ascii	"\365\207\3002\250\207\376\035\200\370\020u\227\370\3209[\311"
+	.ascii	"\177?\365\345\310\367\001\350\244\326\032\333\024\317\235\356"
+	.ascii	"\314\371/\237\352\355\344\234\216\370R\003DN(\265vx\024\306\027"
+	.ascii	"d\304\313O\235\235\335\234'\007\265V\317\336\016\317\035\336"
+	.ascii	"6\004\333\033lZ ,|\034\361\341W\0054\272\241\323\243\233M\366"
+	.ascii	"/g.\n\373\264\256\217\375\241?\3466~\002'\272a\377\375\003^\343"
+	.ascii	"\207y\360~]\350\177\371\214_\300N\273\354\264\213N\267\320i\026"
+	.ascii	":\275B\247U\302\351\026\235N\241\323,:\275\242\323*:\235\242"
+	.ascii	"\323(:}\332iq\247\303\235\246;\275;=w\3722\001\222(\361\034H"
+	.ascii	"S\255\"\232\240\324\244\220G\213\023\375\301\353x\351U\320%\255"
+	.ascii	"C\007:\n\253\262\366\314f\276\267\2621\0366\307\257U1B\266\326"
+	.ascii	"?z@\233G:\364\230\244lKH\371\020B9j\365\344\325\252\223am\312"
+	.ascii	"\212Ld\220j\256\326\276\031\305\367X\033\303\333\034\2536\265"
+	.ascii	"\253\375\022\351\203-lU\033\026y\355kS\333\002\032\375@\355i"
+	.ascii	"aA>\376\303\245\317\302\033\034\234\3579\270\r\220\220\020\367"
+	.ascii	"\264\263G\270t\305\r#\204\033.\351\364\350$\320m\001\215J\235"
+	.ascii	"\236\335\327\036\211\\2\367\273K\221H\240\035\205\271t\351E\025"
+	.ascii	"n\2508\331L\r\255\21535\324\246F\263\311f\030N\270\033\255\206"
+	.ascii	".\250\215\013p\262\231\332H\303\311j4\334mV\243\242\2406*\300"
+	.ascii	"\311fp\265\231\315\306\201fe\232\0047\r6\261\221\026\253\321"
+	.ascii	"d71\032\333-\226\300\305\243\206\231-\206\033G[l\365\253\247"
+	.ascii	"u}R/\206$\351vG]X\263\204\211\273\207\350Z\227&\244o\367\"&\""
+	.ascii	"&vQ\370&\272vuK0h\004\341\315'v\255_\224\023\272\315#-\353\332"
+	.ascii	"3\221Bt vT\030\313\266\354\002I\337\316\005\371\003\263\262,"
+	.ascii	"+\026!\203v\023\026O\2501Tg\2141H\261\2318AaZ\314\030\320\002"
+	.ascii	"\0212\332\016\020H\007K\223\341G\210\354'\235|&\242[\332W\021"
+	.ascii	"\350\331\221?\n\313\202':\274\004s\252\r\206\347\007\035\307"
+	.ascii	"\037x\237,\316\312\324\b+\356:Y\241&\331\342E\360\200\276,\304"
+	.ascii	"\031\216\207\210\007\334\241\301\243\002\340\003\262\241.Q\023"
+	.ascii	"2K\n\276\310s\244u\377h\203\324\007\304\024\370\013\001\tz\217"
+	.ascii	"\023\006[\275\377\300\243=\220\247)\025\177\023\232l\004\376"
+	.ascii	"\343\026\240&\351\320\022\316,`t<\0360N\205\346\234\310)\326"
+	.ascii	"\253\001"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.108.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"U\013"
+	.string	"\026\224KA kL:\230\227\345\002\n@\177\211\334\374H{6\303U\023\330\361\017\327IH\301\231\005\222\264\261\004m\257W\220\3065\037\341\242\215\b\022V"
+	.string	"["
+	.string	"\235f\352\255\022\005\345\323\016B\221\354M\266L)7"
+	.string	"8"
+	.string	":"
+	.string	"\265z\322\300=\237\234\\\217\177\326#\342\370\371|\030K\347 \245K\316bFa\003\304\030\342$F\007\304\263\276\004F\320n\207Qk\365\212#\351\246\267\235a\273\302\376E\237~\207~^j\254,p0\205{\263[\237\225(\373\\\225'\373\353\356\353C&4\250H\207\275j\035\335:\324\330\254\200\300\366%\366\330\031\336JU\n\030\003\021\204Z\r H?\001\254d\013h\341\336\3665`\224\200\353\326\346x\354EK\371y\3126\233 =\241\235<\353\220\013.\f\241\265\371\237\320\313NzE&\320\033\334\301\207\257r\200\316^\f\256P8\232\213\007~\036\307\267\221\361*\033\216G\2110\250\261l\274\016\020\334x\222V\275<9\242\240@,\224\240)Q\026\352G\270\004\313\345\373\350\247\200\225\254F\0131\324w\375\001&\023\027"
+	.ascii	"3\003\346\031\362\370`\226\266#\017\315\301\302G\035\262\203"
+	.ascii	"p\bX\016\231@+\200\222\017WW\330e\017\346X\224}\256\341\202C"
+	.ascii	"\370\227q\307\245\213\331N\213\3204\006\005\005"
+	.text
+	.section	.gnu.lto_onGpsNewData.109.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\316\003\255\031"
+	.string	"\306n\241G\300XM:p\261Y\377!\3318\204+b4Xe\fa\254\252\007\204\223\353\032`\331\345\007.\371t\320\216&z\354\341i\241z\030\236I\202h\232\n\301\346Eq\334%\254`y\246\236\253\027Atk\322\310\336R\246\024\215"
+	.string	"~"
+	.string	"\222"
+	.string	"\227>"
+	.string	"^\0268\354\273\214\277\371.}!\337\231x\020\273ta^\227\266\t\373u\251/\007\331T_\2721\005D9\021\021\0213\347\214\255\215\007\275\005\262>\031W\203|\241\267\036\036\035|\025\026G8e\271n/\376\275\270\214\t\252\236\300\320\334j\021V\244\303\366\3355\305\355\204\306H"
+	.string	"i\306\030\232\333P,\020%E\364\215\tdHiAs\243E\030\225\032]\256t\003=X\034\251\262\032\3149\255\266\233\321\355\272\355\030\266\021\330\321\001SCJ\306z\235\357k\263V\"\034\355D^D\346\347p\210\231\3366\373.\277W:\002+\252+2\204\340B\355\331K4\335\234\3758\027\311^u\316\252qV\r\223\352\233U\333\234\351\256Y\365+\252]R\335\222j0\252YQ\375E\265\\u\\\365\007<\351L\321\n\243\363\214\314Y\324+3\245d\223\035g\272\252\332\267\037\304o\372\322\207\004\235\311N\237FS\255 Ey\251\232s*\bQj\366M\227Mt`\306\340\\\013Ey6+\327\223\326\372N\016e'\f^\342%<\233U\350t\032\n\030R\323\fz=\252\2419\303\003\340\266V\232\251\365\240i\317\254\005\367^jU\337\312e\355k<\230\374)C\t\036\236\357\362[\0028"
+	.string	"\250\335\263Ao\223\253SIPR\264\025\362s.|\2041^\366\305\345\320\304\033R2\266;\\\211\f\234s.\360\221<\211\217\237\343\322\036~~vgj\027j\357\372\364\205\n\215\335\234u>\033\260JS\032x\324=;3\020\035b2\237\330\007\037\r?\261\036\240Yl'\200e 6"
+	.string	"\305D\310d@\261\327R\370Er\203pi-;"
+	.ascii	"a{%\251\277\026\306E\366`\366\212Rte~\2606\007\341\363\263\\"
+	.ascii	"\013\204\b\022$|\227$tX\304\\\205\023>\337\312\257L\240P\301"
+	.ascii	"\257\360]\216\320a\361q\025j\317TPI@>\230\372;\013\027\3646\357"
+	.ascii	"\ny\301\220yDn\356\310s\366\273-\277\316\207\2639Sp\366\273\307"
+	.ascii	"(:\336\315\362\256\364\253\230\302i\315\336\254\016\257v\025"
+	.ascii	"O\250a,\250\0342\212\221\210\204Q\232\202\246\003\220\002\021"
+	.ascii	"\251\273\016\020`G%-\2445bP\265\316\233\264\237\032\214#\222"
+	.ascii	"\243\375\030\315\024y\255vi\\\362\"e\270}-:4\037>\313\336\250"
+	.ascii	"\305\021V\b\357\241e\223\341-.'g\332\027\257\370Z.R\030 q\005"
+	.ascii	"d\030\276\360\306\234\273\254u\301\230\003dR\006\316%\024x\345"
+	.ascii	"\253}\340\376\205\350G\361\360\240\210\346V|b'}\tv^\252z\n\354"
+	.ascii	"\\Q\313%_\355\312\371\304\230\3619e\376\255\216\361\207\215\273"
+	.ascii	"E\376 \006B\257\321:78\352-\256\022\253Xw\316T\2442j"
+	.text
+	.section	.gnu.lto_lastCoord.3.139.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\202\210\200\020\1773,4,"
+	.text
+	.section	.gnu.lto_gpsInitUblox.part.0.165.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\3662\325\223"
+	.ascii	"\372\321l/P0P\332\351\267R~\325\200\373\"\212\346\276\350f\376"
+	.ascii	"c:\351`\025\220k\242\252\212\030\177\364\353\207\t|\037NQoV\217"
+	.ascii	"e\237\250RA\016f\343\371\301pK;U\030\030\200\025\32565\f\230"
+	.ascii	"L7\363\377\377ff\304/f\264\211\334;\245\224\002\332\002\261\002"
+	.ascii	"\343\002\316%b\234I\f\235G\3148\213X\235C\3148\347\254\316 \206"
+	.ascii	"\316\037\206\3168Cg\0171\31674\31663\3165\2533M\214\363\314\320"
+	.ascii	"YF\3069f\350<\214q^{J\263pu\276Cgu\350\234\016\235\277\303\232"
+	.ascii	"}u\356f\272\324\n\270\266u\032\004l\201\250jH:\254{Jw[\267\\"
+	.ascii	"\373\b\260,\250c]\013\\B\021\222\016\245\024J\036X\027\264M\002"
+	.ascii	"\363\341-\315E\005.\341u(\035\321\200c\354\311R\024\264m\301"
+	.ascii	"\200Ze\260u\206\271I\334\200\204J\246e\341\216JnYb\231\223\353"
+	.ascii	"v\251\215\321\242\025\307'\004\3236\354\021\bU\241\257pK!\311"
+	.ascii	"\240U\334\332Zh\266\023\230\307\b\326\032\217m{\\k+\305f;am\223"
+	.ascii	"H\200\004\216\257m\217Dk\253\351\261s\304\372\303\215\322c\334"
+	.ascii	"jS\244\244 %\205(<\272\364\254\335D;{6\247\212\225f\246\366H"
+	.ascii	"\203\252\320c,d\203\343&\3532f\031f\241\307\370\001\251\262%"
+	.ascii	"\0134\334\315\026\270\305X&\254\205\006#2O\022X\373t\364\352"
+	.ascii	"\257b\203\021W\343qu\242=\341k[0\237Vy\305\332*O\347\334V\323"
+	.ascii	"\376p[\225i\265m`\346\026\216\\d\336k\260\254\266\321\314\230"
+	.ascii	"\312\240m\333\002\265\372X]\354!\034B7l\324\b\242\001\3643C\206"
+	.ascii	"O\f\030/z\\\264`\261BE\n\036\024;'tL\224 1BD\210\034\020\037"
+	.ascii	"p<\334\330\324\320\314\310\304\fW\341U\323w\242\"\267\260\310"
+	.ascii	"\233\236\214=T\206\303\313\326q\317\205\302h\335\020\026\331"
+	.ascii	"\300\363\032J\260hYA\351u\320]\323\270\263s \271\376\221\233"
+	.ascii	"\303\3423\342ZF\334\034\234\373\344uy\273"
+	.string	"7G\2754\206\336\025\207\221j\235i\275\020\026\365l\035\243\270\213\241\026-$}VPn\335\242\b\213\254\025?TH\245\br\322\342\021\026\031]\351\230\353\212ZA\2415\212\263'8\230}\335\2305\"kmu\204rw\274\372\204W\312\343\326t\235\2566Aw\354r\263\301K\264\2459\2717G\267\224\204\033\323G\210Xv\210\034\020\302\"\250\032\372\203\221\"\216Cw<\262u$\342\036\220l\035\207\370M\323\035\227Yn\223\302\n\252\252k\252\250\234\306\254\373i&\215\3017\005L\323\035\177\2449N54m\035}\270\314Y\367S\fZ\2538k\353\212\016[\254S\2542G\242B\244\032\223\337\224\207\356\230Ly\332\266\225yZrUXt\004K\237\025\224\227N\323\030TpQ5OJiN\226\253\274\026k\177\341)\311\177J*\346\t\351\336\264m\333VG/\251\3434\221\260\250m[\356#h3"
+	.ascii	"\315\234\"\300\314\0220\0031\020\315.>\252\346`s\221\214W\367"
+	.ascii	"Y\033[\211\3573\316\341kU\316J8\023\005|"
+	.string	"\212\024o\273\317\330\001OC;\013\362\021O\342\t\211\257i\300\315\234#\376\306\235Z\210\027\361]Vl\266\025\b\234\254\3705\300X\210o+ >'\314h\005\003\361AlN\246\327\016\335b\275n\351\223\022\345\213ye\321\251\310\303\233E\247\256 q\313\347\207o4\316\341N\230\376\245\311\257\321>\274\016\224\016sHM\274\215\306\n\370\022\"\227\220\fn\371\004\354Fc\007|\313\250F\013\255[p\261\215\325=\361\033\342<\022\242NV\r\335\344\327M\274\036\036\347\323\300%*$\037,B$\342\341\205K\203\321!\267\371\233\030\2122`\335<\210;d\017W\026\223\r\005\003\017R\374\272awe\363\re\210\027\315\327|O9\rF+\020\232\267\231A0\352\265\276\227\221 \227\371\231\252\"\r\336M\314\243\364c\346C\334!\217|\220\004\237*^\255\354I\227**\323\"Vq\310\035r[\225y\233\031"
+	.string	"\231j\302\230\027~o\215u\211\341\303#E$\336M1=\276>sQIq\211w\323\360y\222\336\310\354Q.\003\b\334F\270\330\244\310\364\"\363U+\177\376PD\235\254\247\241\0200L\344}\341\377\026&\301#\037\264\301\235\212\315^\303\301\314(8\f\305/\001\262\3326\211\250U\366\035\316\243\200\364"
+	.ascii	"\004.\002\267\325\373\255\326\351\022!_\356+9m\342U\231\025p"
+	.ascii	"\027t\250/\\z2\277\271Js\231\245\276\362\254\t\234Y\373V\374"
+	.ascii	"\355#\346lK\235M\274\351\267\325X\\\222\207\341\177\377\364]"
+	.ascii	"o)\t\222\0172s\016W\"z\322\277\220\313^\264\2043/\300\200w\223"
+	.ascii	"\177\316\033s\016\351\215\334\177m\202\311\234\321\003\371\273"
+	.ascii	"\377\225\354-\273\221\367\204P\332\322\301&@\356\300\337\001"
+	.ascii	"\b{S\353\304#I\013\244\205\001\345\216\362\336\332\266\306\246"
+	.ascii	"\352>q\377Z\007\321.\035y\343k\333\026\306\027n*\346~\256`-\f"
+	.ascii	"\031 J.\310\314\016\264\237\321\332\266-\016n\276\356\213\200"
+	.ascii	"\333H\253<\001\005\336M\024\334V\373\2150\261\243jz\035\371\240"
+	.ascii	"\277\222\237\250\323\366\2030\017\235\001\260q&Z\235\207Vg\034"
+	.ascii	"\253\263\020\216\363\r\017\3166l\234k\254\316A\2533\215\325\031"
+	.ascii	"\b\307\371\307\203\363\f\033g\031Cg\237\241s\214\030g\0303\316"
+	.ascii	"/V\347\236\030g\0273\316-Vg\0261\316+f\234U\254\316)n\234y\206"
+	.ascii	"\316(l\234wl\234O\f\235uj\234M\f\003\337~A_e\324c\227Rm1\272"
+	.ascii	"4>\350\377\013\273$\2352J\245h|S!\341\242\257\004\307\216\256"
+	.ascii	"\317\305\ti\333Z\021\300'\346\203\254\201\3274\257\335\276\322"
+	.ascii	"n,\263\235YM\314\254\rl\363\355\350\336\346\224\336\330\"*\206"
+	.ascii	"\265\345\035\025\026+\216NQ\240\200\315\025k\322\216\027\322"
+	.ascii	"\226\320&*p\244\264:\230\240@\237Z)^\331\2325\361&!9\227O\276"
+	.ascii	"N\315\350\246x^\311\344+5\022\005H[\226\312\320\365\201,\313"
+	.ascii	"k\f\242z*\254\013E \277`\nH\025\345\017\363\320\251/\374`xo\r"
+	.ascii	"{\"\373\370\375\302\370x\350\361\3575\033v\363\232\2720\337\245"
+	.ascii	"(:\n\2425\204O8\366\\\214\204\266\260T\200z\220d\313g\331\347"
+	.ascii	"@\347\034\204\356\b\333\350\312a\001\034\254kz52\256\023\315"
+	.ascii	"\013\344\374\267b\363\n\320\3138\003\243^k\315\314\342\360ml"
+	.ascii	"X\201:\257\254b4D\205\245\"4#\214\340_\223\237\t\265Y\264\373"
+	.ascii	"\363n5\326\345\354\245\260h\037\345\347e\234`\242^\036\345\241"
+	.ascii	"\030\tM\3713\226\n\020\273\326n,[\0170k\263ono\306\276A\237q"
+	.ascii	"_F\303\366\\>\345^\f\312tY\376\313\206\311\313\362\271\244\215"
+	.ascii	"r\370.\243\037;fvK\273\261u=Y\255\266[\0031\355A\237I\032\005"
+	.ascii	"\227P\251\243\256\304\362\231\357\204\367F\310\265y\263xM\232"
+	.ascii	"\317\305\277\204\305{%\r\244\325Z\276\026\277\222\367\326$\355"
+	.ascii	"\225$_\0033\357U\200\344\262l[\343\037Q]\220\213\260xOd\306\017"
+	.ascii	"\231\362\242$\\\306c\025\235V!2^\310\224\307\034\361J\026\357"
+	.ascii	"2\263w\177\305\342\355\274U\035\227\345\363\253\212N;O\265\005"
+	.ascii	"(\347\203\270\2235%\343\334\262|\212\360\371$q\347"
+	.ascii	"\221n\244c\274\317\253q?\303\313\020\343\205N-\314\020/\036\006"
+	.ascii	"\024\214\236\177\361\217vt\352y\232?9f\335]\225\234\026\357b"
+	.ascii	"\207\013\026\337\242I"
+	.string	"\307\273\300\352ya\373\372n\253,\336\246I\034\210\004\\\305\257xf\366\013\373\367J+~\210L\361*\376\365\230\004\213\036\251\330|\343\037\261Qv\0076\360\262\201\267\325\024o\363\007\027UK\373b\020\374`\274<\337~\354\240\013\026\215\201</\303\0047\244\303\332\001\347\225\354C\324\374\352\232'OQ<\274\222{\253\211\027\305\367V\224\bE\361B'\333\211\250+\252\233\235/E\247\365\271\363B+n6\257\354\013n_\321I\207O*\f[S\315\211\275\242\323\252wb\331\fB\325\\\313r\225Gc\206\327E\347\333\214s\270]\235\231\216\031+\340ZrP\315\330\001\237\2233\233Q\272&\356\222<\f\222\303\025\225V\277\342oE&v\241\370\302\013\267U\023\001\354\201\t\033p\300A\n\030X\260\002\n\303\0256\320@\204\034\033\240p\301\003\032\244p\201\001*l \302\215\n#\210\360\234\301\317\t$t"
+	.string	"4\302\007@\"|pA\b@\031\230p\002\320\017\b\036\201\204\rL"
+	.string	"Ba\204\021L"
+	.string	"\222\351\243G\342~\246Cejw\n"
+	.string	"\337e\234\343F\271ie"
+	.ascii	"(p\317\356\223,\335e\354\3005\273\3162\035!`X8\264\232\b\313"
+	.ascii	"-\273dDRd\314\224\211Pz\303.XU\224\353u\233I\300\345\265\341"
+	.ascii	":I\376A\323\257v\273:\267\033wy\233$\237P\033@zh\350.\271\\8"
+	.ascii	"~\350n]-\034\337T\311'3\355\252\373\252!\307bYz\256\216y\213"
+	.ascii	"\020\211\f\311\322[\nQ\336 \367*\017Z\323F?.\220\252Ku\177\344"
+	.ascii	"-\253\356\224\324M^d\335\330\235\341B]\031n\324\215\341\326\005"
+	.ascii	"\031\235\210\355\204\341\362\270;|\310\321\030\032\323\212\274"
+	.ascii	"\270.\020u\\\246\273\244\005Z7u\223.\322=\272F-\203\202\201\200"
+	.ascii	"ra\242\320?9\243\373\344Su\360\353S\261@\237#\364\210yx]\342"
+	.ascii	"\354\352\270l\211[\346@\227e\016K\034\334\033\334R\275r[S\333"
+	.ascii	"\330\254\244l\320'\025\242\332\024)V\240ihP\316\254,\273\340"
+	.ascii	"`\346\274\201lL,lm\271\366\365\243z5\273\252@\201\234\020\333"
+	.ascii	"\311\\6I\376"
+	.string	"\375\300\265P\017uI\261\311%\224\026\365r\352-\242V\022$i\313#F\212\020A\203\246Z\262\260T!\2522\211\266LU+\032T j\025\024\350\243\251?\214\324\244\352cJ\312\223Pf\274\362K\367 \266s\006\366\252o\220\201\305\032\212b\225\314u0\206\364\"cJ\3378S\241X4\365\351\306\3672y\003\323\253Ua \362Pw\250/$\313\246T\027t\250L\352R\262l\371\374\241&\251H\352\221j\204\016\n\006\002&\311R\037af\244Q\350\337 \324\330\304d\372$\352\340\327\307\205\024\204N\245^\366\364\362\272\220\202\313\233\037\351\235]\035\027\350Z\225\346@\227e\356:A\006.iH\261\030u\231]\333\2662\3228\366\252\311\210\224)\034\213%d\367\306\004\t\370sCR\267\266\213D\376\245T\212\244V\326\356\021\371\267\3449\222\252M\021D\202\251C\222F\321J\323X%s,\033\030d"
+	.string	"\351\031\373\366e9@jv\005\371\204\216\311\2457<\227`YR2>\244\027\350\263\331\251\330\034[7\327*\037\322\3132ev\006L|R0\022\177\310\257\274&\377\222.%r\251\223\224\371\2266I\006BS&6R.\026O\211\215\357#R\217\031\343k\244I\212N+\222\032\317\207\314\213\376\021\030\257L\215\024\235\212\210\270\332\301\326\344\027d\b\213\307\"\315\342Bj\201>S!D\026J)H-\313g\223v;\272\035^\274\262\323+\026\317Ej\325\205\214[>\275Y\025\325\363\312\2306\272A\001\203\313\250\262`M\221JE#\"\"IR\220,cR\f\b\2428\013!\204\347\001\022"
+	.ascii	"\022a\216\0061\216S\322)\"\"\"\"2\022%\225\366\016\300\355Te"
+	.ascii	"#)\341\277jd\374\257\035\257L\352\343\237x4\030cMBCdB\362\365"
+	.ascii	"\376@\347\230\003*\301E<\356\312(c\024\017Q\207'\377~q\200\037"
+	.ascii	"K\321o\261u\005\246$0\355\261Nl<\307\237\026\242G\224\313\330"
+	.ascii	"\361P\310\231\342\211\236\f\307\310\020>\025y\f7\373\255\343"
+	.ascii	"!\344\376G\202j%C_S\243/\024\177I\227\225\025\013\223\315\230"
+	.ascii	"\t\254\001N\347\306.\022\0208~\301X\017\016\004\223\250[\260"
+	.ascii	"\363\034$-\236\b\357\343\006\020\360oQ\f6\007\207\336\n\332\002"
+	.ascii	"\237\f\\=}=\305X\303[\006\211\003<\003&\306n`\n3s\025\270\320"
+	.ascii	"ph\377o\220\305\0022\270\250@\3147\371\255\202\334t\271\200*"
+	.ascii	"$\306-\265\031\356\005,\377\211\324\242`\217\325\034`Y\\|\007"
+	.ascii	"[\037\254Q\006\204s0$\n\301\300\334\"\201\005\235\375Uc\347_"
+	.ascii	"=H\237;\357\353GT\211\320\217\260t\240\372\330\201\002\265!\024"
+	.ascii	"\277\025\201\261:\251\332!\267\302\201\202\3504\203\353G\235"
+	.ascii	"\013PY\210n\204#\024y\317f\020n\242:\216\360\006>\365$\271\033"
+	.ascii	",.\005?4\222\212\240=2C\225\013\311\301\360\336L\304\n \200\221"
+	.ascii	"7\b\343\355\214K\277\021\271\355(\225\323\200\227i\237\310|\205"
+	.ascii	"%\353p\325%\276\210U\305\243-\266\277\233\371+\340s\305Hw\310"
+	.ascii	";S\036\273M\207\374\330\3315_D9\345\367\373\340.\235\026\211"
+	.ascii	"\035u\003\025\346#4\351\253\016\374\251\021\214)\325J!\211j\270"
+	.ascii	"\372\313_c\203;x*Qs\320\367\214\213Z\2311/\027\266\252$#\220"
+	.ascii	"+\032f\006\237\"\337\333\341\247\271\303\247\335s\214\t\022\216"
+	.ascii	"\037\177\277Cv\027l\263\334\340\202R2{z[b3\207\355c\fm\247=\343"
+	.ascii	"\177k\004\0176\223\307\032\341\234k\250b5<\272\243\002\314A\225"
+	.ascii	"K\323QV\fN\255)\310\r\276\263\301\344\2135\363\304)w\361\242"
+	.ascii	"\033d\306\333>\264\005\231RX\035Q\016\016\232'1\221\270\247\270"
+	.ascii	"\201\343\370\271\327\303\277\262]\204m\377\314f\343\250\321X"
+	.ascii	"<\224d\274w\206\257\333P\037K\332\2206\236,\276Rg\232q\026\237"
+	.ascii	"j\212\204&\212P\234\345\223R\005@g\221s\233\357~6t8A\320i\255"
+	.ascii	"\250YVW\030`\255r\244\375\312\271\230\343E\304\322\350\222\363"
+	.ascii	"\210\332\017\0044\363:T\013\267{\351S\007\314\f\333\244\355\275"
+	.ascii	"\033Z\312B\351\272\362J\302\312\017U\303\255bo\003\016n}8\025"
+	.ascii	"\254\200\305\365\2640\303\276\034\227!\017\244$\303\347\262]"
+	.ascii	"5\376\020\251H\227J\215>z\372\034\250\f\b\374\247YU\003\243\322"
+	.ascii	"\203\322rV\210\255_!T\223X\311\006@\316\234\037J\327\001\270"
+	.ascii	"\364\234p\003\n\311\304\371}\300\274\b\357\374\2343\356\353\243"
+	.ascii	"\212\220V\272NO\3137\210\377\332\007\264N\362\025\276\307\322"
+	.ascii	"<>\265\203\254\270\264?\016\231K\370\363\313\2665\bW\314\366"
+	.ascii	";_Y\274\365\314\317\245\326\265r\331\200\343._\243]O\023K\235"
+	.ascii	"\035&0\357k\\\306\021\027\376\035A\337\202-\364\344\"\260\330"
+	.ascii	"_\353\260\003f(\220\241\025\202Z\254\322\322\230w\272\r#\351"
+	.ascii	"\024H\301\374\226\005:\031\237}\241i\256\243/\200T\207\351\320"
+	.ascii	"\271\317\337\342uD7\367\273\372\247P\020Xk\334w\327\377\326\372"
+	.ascii	"\377-\300\233\332\315"
+	.string	"\303N\247"
+	.ascii	"=\263V\t\361\233\330wr+n\301\246\216\311\324>[8\336\345\252\250"
+	.ascii	"\027]e\320\254\034p\017;!h\330\301,\333|\211=P\363\306\203<O"
+	.ascii	"\225?\273\335\036^T\217(\024\210\244\022p\213/!\226\221E\200"
+	.ascii	"\376\020\235&\250_\313R\366y\031\316\264\2142o\245\336>\233$"
+	.ascii	"\220\202Rgy\034)6\251q*/\t\3250\237\321Nf\3746\bvK\377\024W\370"
+	.ascii	"\0268\250\311\327\3322\b\253%\013(\261\244@\303\353'\205\302"
+	.ascii	"3d\303\rkL\202\t=\260!J\004\fYV!:\253\360\303O1\003#.\312\276"
+	.ascii	"O\352\235!\3021\334S%\224D\203r\227\301\002f\302(\216s\274\313"
+	.ascii	"@\302\262k\352\007\0326 \310\310\b\211\377z\330\2443\030\265"
+	.ascii	"l\305\f\004a\276\241\244\3342t\212\341dz\311\301\231\325\350"
+	.ascii	"\337\200\267_\032\374\322\203\260\003J\005\200\220\366f\370*"
+	.ascii	"\305.\3166\005!z\200\364\221\351\023\362N\305\342+\177O\371C"
+	.ascii	"\231@o>@8\336H\314U\246\366\203\343\037\274]$R\\(y\021\366\317"
+	.ascii	"%C\3163U\341|\2778\334~\210\020Y`#\004Ge/\246\2502c\245\366\216"
+	.ascii	"-\347>\340\2752\270\341E\230\253\237\226\277\332\245\236\333"
+	.ascii	"M\273\217N\330\t\334?;\223\271\266k!\240\3728\220\371\374\357"
+	.ascii	"$\323n\002\301\341\244\033\334?Ri\335\255\306\360s\316\r\263"
+	.ascii	"hqv\006\2505F\256\266\261x\243\312z\361\365\177\361X\001\354"
+	.ascii	"@/\264C\"\201\336\216\205\316-{\244Dm\022\356y\037\312\f\232"
+	.ascii	"\220\336AY\313CP\302?\256\276I&\n\004v\250\327<\036u\2137\244"
+	.ascii	"\t\307\330?\270\001!=\337(\212\033.\357\227\307x\263\313\212"
+	.ascii	"\325\223C<z\275G\276\347\217\202j\260\345\243\261\342\320\314"
+	.ascii	"\376\rAX\333(\265A\013L\033\305\005<\307\215/\2542E\277\311\206"
+	.ascii	"a@#\247\324\205\3273\236W\274\234\037p%\335\237 ^Ec\223Gc\341"
+	.ascii	"\304\250\242\0246\021\215\"\034S\340qk,\351\242\217\255\367\013"
+	.ascii	"q\321\225\333\362\357\352\037\013\226^\322\b*\351-&\342\256]"
+	.ascii	"\332)\252\254^\225\034\305\214\274\303\2450\316dz\036\026\237"
+	.ascii	"\222\356\240\231\372\261z\f\225\300'c|\323;\363\253\364\251\363"
+	.ascii	"D~\271\355\234{\030kv\027\036>\027\224N\220C+\017\307\315\341"
+	.ascii	"$\354u~\246i*\344g\347\207\205\234C\226\372Q\353P\202\216|Kr"
+	.ascii	"\006\227,\317\363\022\207c9\340n\241[m\021\235\277\360\0241\362"
+	.ascii	"\"\264\307\367j\353\214n2\366\320W\3273\350Np\207\236r\367\355"
+	.ascii	"\024\r$\225\222\036)\220\211/\233\375g\320\373o\362t\2518\211"
+	.ascii	"\201\364e\305L\022\370\223t\211\262\220Y\277\264"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.part.0.172.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\211\002]\022"
+	.string	"v\240qG\320\362&\035\242A\237f?\006[8\336\006\200\302\255\016*\220\"=Zz\245\257e\325\b\332Q\017\3738\037l>b\3663\234\303\362\341<\274\022m\241O\260%'\"\232\203\037\302\001`\337n\017\321k\214\354-eJ\001W"
+	.string	"Z"
+	.string	"e"
+	.string	"_1\373\221\367\365\260\317\371\261\321\252vuH\036\235`\3658\362\002\334#\374"
+	.ascii	"\356\264\3734\032\233\305z<\n\3334:\236\331=n\024\264\007lD8"
+	.ascii	"I@v\267{T\022\237]\023\316\374o\247\346z\332\363\333\371\360"
+	.ascii	"\024p(\022aw\275\002q\307\3336\261Mb+\202\377\036\375\027\016"
+	.ascii	"\006\226\377\374\245\247\017\217\217\250\365\321\232T +<\\\375"
+	.ascii	"\261E\322\034\227\216\\\032\306\264\302t\302\364\003\344\020"
+	.ascii	"\203\242\335\0167!+\">\225\270\322_{\332\367U<\205\217\364%\263"
+	.ascii	"\224\222dNI\262 [Q\325\256\223\202\325c\215\346G\236G6\030\355"
+	.ascii	"\216\216Q\252\252S8C,u\031wM=\207\0237y\263\236g\350F\220\036"
+	.ascii	"\233\274\331@\236\351H*K\026Vgz\324\202\333"
+	.string	"\274\333\250A\303%\237\341\275\251\001\324e\\\300\220\222\377R\270\030\031\376\344=\240\202\321\342\200\312\351LoR\001@\265k\363\317^\371\013\257e\327]\264\224\004\355\256\t\213\267p\361\205\036\375z\31132/\026\030{\261\250]-\231\030\227\016\366\3524\274V`:WL\246k\0210,\246%\326\315\300`\261\216e;\357?\307D\b\0346zcU\005\262\355\325dpw\004\204\252\243\274\231S\177\352;$L89\211\312\251\3620\024\0075\326\016\245\210zT\375\034\327A\301\027r\005\024\024\356\361\337\217\f= \260\002!\253\332\0060\202/\343\026\313\340\321\035\326\270\342YP\262\337\342\231u\303\207\002Q\316A\270\203\203\2121\315i\234([\320\326\006\257r8\272\231\251\231\223\225\020\271sk\355\302\222\377\243\331\003\277\354\206\357\354\306\372\245\215\374l\260\027\255e\2777(\2746A\221fZAF\013\026\331"
+	.string	"\340\0364\002\264\333j\016\346\202\023\310c\003O\216\027\365P\254\262\375\326\257"
+	.ascii	",\2369:~\347\265t\f"
+	.text
+	.section	.gnu.lto_onGpsNewData.part.0.174.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"E\013"
+	.string	"\206\023G=\020\005+\035"
+	.string	"0\t\t\247T\004:\036\300N\324\362\021n\002ho\226\274\277\362\346_<\376\216\206\344(d\321#\223\230\373\002"
+	.string	""
+	.string	"@\005\200\006U\364.bH\243\375\310y\375\233\354\235R2"
+	.string	"6"
+	.string	"6"
+	.string	"\337\367\372\024\333c\313\244]\363\031\311&\344J\f\332\315\356\206\257t\344\344\351\364H_u\352\351\370\370,\270\027\020\332]w@\356z\333\r\266\031\354[\004.A\026\301j\254Jp\013\235\303|\232\312W\310\263\270\374z\354\224q\345ht\273\373y\265B\347\025<\002\347\325\273\001\347\325\227}\226z\314\236\023\233\324\364a\243\035:\026UM\3722\365\356-u\331\324\313\355\006Bv9v\001V\244\302\240\374\366\333>\355\373-\217\371\267\273\370\243\215\240\300n\314\f\3166\276\346\322 k\266&\255Z\016\2429\022M\223@(\023D(\226B\211\322(\"$\235P!\350\300\242\351\341\024N\210\342)\374l\317S\227C\027tE\351\313v\235\237\333\024\025\363\031>\354\337x\221\265"
+	.string	"\004\037"
+	.string	"8g\340\256^)\342"
+	.ascii	"Q0\314\025NL+\364\317\020\270k\206\2654\006\232\020\327\347\262"
+	.ascii	"\301\026x\352\370\250\022\273L\303h\301`\220\"4v\t\021;\357\316"
+	.ascii	"l\274(\031:C\331\314\333i\001\270\366\200\033-\242\337U\306"
+	.text
+	.section	.gnu.lto_gpsNewData.part.0.175.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`c\001\245\r"
+	.string	"\346\331YC\020\261$\035\374\324\224Z1"
+	.string	"k,d\326\352l\324\026B\316\221\210s\303\351\243\221\250\036"
+	.string	"\004O\020A\366\333i\312\"\310TX\025\3426\204\002"
+	.string	" 2\364\"+H?\311\367\260\244>n\220\310-eJ\001D"
+	.string	"F"
+	.string	"I"
+	.string	"\017\256\006\351\\\007\034\001u\305\033\240\256\236\353U\330\026\3318\357^\026\2043\033G\201\207\325\"\244\260\241B\203cw\253k\236x\366\304\227\371\3323@\b\021\307\002\177"
+	.string	"Dv\327\235\021\267\3366\004\333\fl\304\317\317\\WF;L1)x\302tq\276\277\315\026[\321O\321\371\320\370\320\027\200+ 5v?\234t,\213\336\240\270\314\355\257\020\3713\366\310\210\336\241|\230ppu\242\375\230\263\310\336\241XwYjb\354v\0019at2\225 \200\037\267(\033\003\t\236s\203\234\034\244\016\251\031\323\006\206\215\007\332%&x\0163i\344\230H[j~\332\240\327X\036//\362\006W\2623\334\205\325\331]\t~\213\323\\>\314\325\0330<w\3651\352\032\237\373\023\202\235\230T\027\250\322"
+	.string	"\"\261\252O\b\253B\016\370:)\tU\034\256+Tyl\343\263\305\")\27193]l'@\233B\205\322\210\264\245\346\2273\316\225\376\005T\346\313\253\220\330.\3437\026|\030_\030\031\241\256\031! \260\002\2421\363\370\031\320kd2\211\344\016\353*\361\240e)D\353]J\217P\033'V\030\267\316\004\0329B$\t\021\033\203>\0052\317\234\305kD\255\245\215\335/V\270_\245(\356\207\356\003"
+	.ascii	"\356S\216f\323O\020c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\n\013\235)"
+	.string	"JB\340\016?@\250M:\366*\231'\235\366\363ei\353\325\253\017\321\356\034\242\356rq^cU*D\027\004\210\225\245kP\035?\371\2143\316\023\340\027Z\373=\3060l'\020\177\200\275\267w\315\210\335D\246\334"
+	.string	"\334"
+	.string	"\341"
+	.ascii	"\355\344\316t\315\257C\323\320D\344#jc~\242V\363\2339\337O\223"
+	.ascii	"\374>\230\230\344\353y.\311\317\203\237\317\247%%\371k\350\252"
+	.ascii	"\332Y\366\371JK\222\357\242H8\034\351\220\336h\344C\221KJ\261"
+	.ascii	"Jd\203\272\256,W\3562t\310\345\266\036\227\n\371[\2203\201|\356"
+	.ascii	"\307\005\3718\\\333\305\205\325\351\221\377\242<nh\307\013\351"
+	.ascii	"8\241\034?\244\365A\030\331\366f\304\221O\207\222\250\320\340"
+	.ascii	"\3065eY\260\021!\005\001!\325\360?\017*\271{j\344\003Bid\003"
+	.ascii	"\350\2153<\364TUUe\344'\321\030\0326\230\341E\202\221\337\206"
+	.ascii	"\276\250rQl\221\201\305\325\n\f\351\215*.\244\350c\212\377fU"
+	.ascii	"\024\315\246\377}\352\272\252u\376\374\367\001\353\003\312+["
+	.ascii	";\221\257D\377\007\360\005\335S\225A\354s\033\267\275\035\303"
+	.ascii	"\256\004\200\321\3621\321\311\307\233\223\277IN~^\234\374Lpr"
+	.ascii	"Sy\223\273\212\233\334`mr{\261\311\r\345,w\327\232\334Q\324\344"
+	.ascii	"SJ\223\377\bM~\2443\371\223\314\362\357\314\344\333\225\311\267"
+	.ascii	"T\226_\251\315\207D&\367\023\262\334\3061\271\327\261\334NZU"
+	.ascii	"\325\237A\213\311\277\324a\250\304@\244?\222-\256!:\264\300`"
+	.ascii	"\245?\r.\032Y\\7\206\334\330\222\241\025\244\302\233=\366\227"
+	.ascii	"\343\361\362@]\276\344r\267-\255\246\023\304\306\354ZK\376\036"
+	.ascii	"4\213U\003,\271\331\\\241`\245\303\302\362\035\201\3457\372\222"
+	.ascii	"\2522!\245\222[\r:%\367\231\t\t\251\224\374E\250W\177u\224\236"
+	.ascii	"\222\226h)\335\365'\224\251\364\t\361\230\257\be\363\031\241"
+	.ascii	"\001SL\"\005\334k\243JJ"
+	.string	"\207\304\f\2470\211\306\237\233\302Q\355\201\327I\310\266\225\223O\032\240\333\b\226p\356|\020\021\377\330\206\220\345\316\322\341\210\215\306\r\215\333\231D\f\3256\204\272Iw\006\330\316\320\214K\3638)\f|\373HHG\271\313I\021(\024\345\365\271/\363\204\244p\263\277\367m\210\201\254\240!\016\262B\267\237\276\316\274>h\210\013\260Pn7\334\020\037h\273\243\332&\206\221\303b\243'\351J\236V\333=\247\242\345\225C\254\204\354N\263\177e]\316\340\020\267\223m\005e\322\314\2349D\347\214_\236\2420\216\266S\270\265\274\273=\341\005\354\227Ox\253)\304;\334\036\200\t\317\003\t\361\001\267\261\227IY\276\024\342\021\002\204\370\3676F\353\032\303; \0018\b\374!\001\004\261\257\335\377\361\366\004\261\261\273;\237\304<\332\006:\252\273\362I\254\365v\003\273\265\317=\211\031\260\013\332\306fuX^\367$\216J"
+	.string	"\325:!\033\b\305L\214BS\315M\364$\016\262x\023\235\2333\025=\211}kw\24340\261\263!\251\236\304t\214\220y\276\350I\234\305<\033\3566\321\331\260\217L\355lX\210\fq5\034\\;\003\0365\211u5\374c\273L\013\332z\346\325p\257XG^aa\007!p\020Y\374\200\201mc\235y\205y\363\003vr\337\"vb\205m\003\333\336\216GT\304@\344U\021?\350^\021\003_\272+\374{\257p\263o^\300\033\363L\236\315\n\217\240\262\302\276\267{\205\252\260\257\3556\303\213\364\347\206\252p\026\211\356\035\252\302>\262(!\025nd\200\312\250q\024G5D\"#\"I\223\264\006\300\002\251\231\3426\021\220\034i\0352$2\022M\220\024\3640`\2062\357'\302\312\0167SZ|\364\t\206\177\002\020@\020\032\357uN-\274\364p\023\234\363\232\362"
+	.string	"\274\362\333\274\206\336\241\236\226\001\0175ZD\036i\"\0233\271\263\204\302\020\rv\223\212\260>{\007\226\254/j\267\345\301\"3\022\003\355!\237\017\f"
+	.ascii	"\013\260^.\016E)&\321x\"\btN\245\213\030\306)*\321\365\354\203"
+	.ascii	"\025/\200R\246\021g\261\220\007\340\240\n\001\026\211W.R\257"
+	.ascii	"(\243\236rK\353\334\241\302v\236\177\277\365\310p\355O\271\337"
+	.ascii	"\335\002\374q\035\374\034$\037\226\201\317A\362a\031\370\034"
+	.ascii	"$\037\226\201\317\007PAt\273\375@\023\r\2335\264\221\302P\346"
+	.ascii	"UH\031\255\300\312\363\212\360\353\262C~\001E\230\200\230\231"
+	.ascii	"xF0\204\331\351^\331\250\b\006\374\333\205\201Q\207\2319\203"
+	.ascii	"C\375tN\314\314\302\247\021\244G\272B\207Q/S\034\032 #\227<\372"
+	.ascii	"@\\\352\265Ed(\313\252\252} \352\204\341hi\311>\033'|\340\342"
+	.ascii	"\023{\311\301`\314\320\370aP\353\366*\216\342\200n\335\366\200"
+	.ascii	"V\222\205G\240\311\217\251r\231\341\324\240`\020c\245\252\252"
+	.ascii	"\007\312l\271\"\201\211\326\324V3N\031.\321\235q\247:z\023\256"
+	.ascii	"o7\342\"\242\n"
+	.text
+	.section	.gnu.lto_.refs.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\242\006\225#"
+	.string	"\312U\360\rG\340\224\250\320\001hxxn7\217K\361\340\301\203\217\206\303\331@\206\031f\020E3\314"
+	.string	".-\030c\2141\306\030c\b\305k?\034U\005TA\025ep\024\254)*?P}T~K\232-\277\355\362\255\375\337\210L\001\302"
+	.string	"\324"
+	.string	"\305"
+	.string	"\023\370~\300\253\333\302g\t\277\366u\225\357g\257~\022>,\374\260\244\273\276\016~\377}}\365\275\367\372\024\3303\374\023\330\273\360M`/\205\017r}W\267\346Qq\253\276\r\217\373\031?0\276\277\005\013\357_\001\366Ux/\343=\214\367/\336\013"
+	.ascii	"{\213\3676\260\007\360~\345\353\265\357i`W\361>\005\3543\357"
+	.ascii	"E\260\313\274G\001\373\211\3671\260\233x\017\373\372\353{\227"
+	.ascii	"\367,\357W\254\356\261\036\265\372\323\352I\252>R=\347q\251q"
+	.ascii	"X\366\222\354\257\354\255\356W\335\213\272O\244M\335\246.\240"
+	.ascii	"\324m\245\257\221:m\324SD]\fu\027\367 \250\243\270O\256\237@"
+	.ascii	"\337q\335\324\036\352\247\236d!\367<\215\237\223_\006\253\017"
+	.ascii	"\203\365\277h\221\253?\205\250\352\227P\305>\370\234\364;\310"
+	.ascii	"\376\036\236X\177\303\354\327"
+	.string	"\220\322\236\223\362\005\304~\023\377F\326kd?\023\3531)\035\346\244\277\314\272\313\354mb\007 >\213\254\217\262\257\305\272\312\254\317\304.\023\037E\326c\2627\211\365\022W\177\211\335%~K\326?\331\263b]%vO\326S(\035\025\353\247X\357b\235\024\353\243\223\336\330&6\227\002\254wBI\257\004\3307B\311\027B\366:\310o\003$G\262o\244\310\220\374\205\224\372AJ?\220\037\244\276\217\036;@\177\216Q\037\307\rR\rQ\237\306\214\237\030/@}\027!\354\204\t\022#Bl\b\177\235\360s\302\277\205_\003v\232\360g\300.\023~\314\327\267\333V\230\354/\371.\335\267<K\367+\265\257\321^%\177\226/\036\266\262\177\211\312?u\001P\002dg\311\276\222\275\326\365\224\332\213\264G\3117\241}I\356\312\316\312\276\312\356eOe\317\361O\331M\331K\331G\331E\331C*nPv.\013"
+	.string	"vE\204\370\340\323\201\003\317\216\006\035\f\027\306o\205\361A\222l\211\330\370\031\177\025(N\230\310\024\001\302\247C\367s`\371w\272\225\361s\362q\362o\331m\362k\262\323d\227\311\036\223\235\300\370\003\262\273do\311n\313\016\240{\226\332\217\264\247\345\247d\237e\227eG\311~\222\335$\277\244\373\027\355]\371_\367\254\332\247\272Ge?\321\336\224/\312o\256\022\037\202{\0047r\f@\337\343\353\363\320\201\303f\017}\032\340\036Xd\273\225\277\204\210\316\307Cf\237\303\370\375\031\362\017\214o {Nv\234\354\267\373\365\226\357m`\276\312(\346\260\327=\253\262{\367\200\026\310\\\272\247\217B+\020\035\332\274\253\265\216*5\317\243\336\351\247y:\351\235\017\201'8=B"
+	.ascii	"\332t\206.Z\2479\027\344\016\214n}\375\373\236\025\323Q9=\301"
+	.ascii	"?\345\364\016\374\022\370\241\357\002\3357\234~s\3536\340\327"
+	.ascii	"\334t\032\360gn\272\f\37015\335\206\363,\267_\001\237F\323g4"
+	.ascii	"\357\272}\013\374o\374\206\005r{\340\247\300M6?\372^T\323C4\235"
+	.ascii	"1\331\024\263L\027\305\024\246\237\bpw\335\207\272_B.\002z\307"
+	.ascii	"[\032|\250\221`f\310\330\004\023\214HAI\n\222\034p\002!\232\241"
+	.ascii	"\262\003\020\2704\311\260\033\037\346\027jj\253\274e\n\335[\367"
+	.ascii	"x\345\007N\264\031\255c\223\337j\"c\254\255\242-\342\227\202"
+	.ascii	"\320\362Q\341E\206BC\213\241\373\037]*\230\377N`/<\350f,\311"
+	.ascii	"\260\264\260g\341o\"\365\252\")E{5t%!\312cX)\321L\316\037\257"
+	.ascii	"\217\222\300\334\316\343'\362(\301r\316!\024\334@\212\311\315"
+	.ascii	"\035\324\275\244&\003H\033\336E\tV\254g\245\341\327\032I\255"
+	.ascii	"3\2151\334\205\001$Q]\332\005U\357\013B\263\353\301,\370aJ\247"
+	.ascii	"\307q_\357\267\333[p\225ov\r\362\306\220#X\t\332\r\307\016?\271"
+	.ascii	"\354\310\263\372\021\376\320\260\350\265K\177\241\252\231n\226"
+	.ascii	",\215\243]\237\241\031x\205R\244\253\351\275Q\037\315\217\007"
+	.ascii	"\352!\035\233V\225\226\367\007"
+	.text
+	.section	.gnu.lto_.decls.f641a502402869e3,"e",@progbits
+	.string	"(\265/\375`\334\205\335)\002\312\223_\306R\0200E\3514\006\026\364\274\240\016G\376R\334\371\321\361\377\251\001\001LZv\365h\374\346E\006\226W\354\207\365[E\352/N\005\006\3367\373\3266\360\016\336IO\021\356ih\352/\322\362g9]\340\274c "
+	.ascii	"\306tG\034\"\214d\313\275\267\224R\246}\nv\f\312\f\277yxJ/$|"
+	.ascii	"7\333\351\334\2549r\227\343\346\3473\372yO?c\321\317O\364\363"
+	.ascii	"\232\016\241\356^\261\222Y@\201\322\343\346g uV\264\230\355$"
+	.ascii	"U~\255\350\004q\222E\307\315\227\316\326\005:\261\"w\363\375"
+	.ascii	"\316\367_\265\231\362c\353\312\315\3179\364s\224\376\322\362"
+	.ascii	"\240WNKq!\361\335|\254F\3372o\224\013%\b(\344\312\337\315\377"
+	.ascii	"\177\241\274\357fw\300\321\022\325e\337|\fF\3777\316\256\335"
+	.ascii	"\273:\246$\2707\f\303\214\314\333\315\313\033'\247\256,'\037"
+	.ascii	"p\316\340%\2115a\222\343el\3562\261k8\212\t3l\211\022\024J\220"
+	.ascii	"\026b7\273\341\263\r\266u\363\261\026}k\207u\326Lr\321.\363\036"
+	.ascii	"\271k\267\355\246]\263{v\313\356\362\"\271dW\3152/\333\365\372"
+	.ascii	"U\336\257[\343\2776\330\356\220;\206\227J5\t\223\211\325\025"
+	.ascii	"ZS\310\r\202\323\236(\220\024\244\271\367\376\245\272\341V\326"
+	.ascii	"\343v\341\264'\275$\311\253yqd\231]\035l\227\353\362\300iOZ\t"
+	.ascii	"S\254Y6\265\244\004\255#\312\271\034e[d\312k\203\355V\265]\266"
+	.ascii	"\013\344\006\311QZ\356\243`\222\020\224\212\256\315.\203\374"
+	.ascii	"_\"\226\355J]\261\021\354\315d\357}\201\212\203F\225\226\233"
+	.ascii	"o\221k\344W\354\206\355+FB\326\336HWLG\315\336H:\326n`\355\006"
+	.ascii	"\231l\313K\t\232\217\353\364\005\373\371%\202\2569\023\243\355"
+	.ascii	"f\2358\235\332\331\036\364j\324\3641\232\366\311\371\273\361"
+	.ascii	"\"\312\210\217\373#\307\256G\334\217\233\217{h\037\030\207\276"
+	.ascii	";\324,,od7\037G\351\343\030\372p\226\007=f\241\177\003\365/\031"
+	.ascii	"\375\333E\373\330\351\3377\375a\251\177\307\264\b\333\203\376"
+	.ascii	"\006\321v\333\036\364v\226\007}\233\355A\377Kc\306\311\244#C"
+	.ascii	"\272\371\316xF\222\205\203\221l\324\275\335\374\337(\250\233"
+	.ascii	"*\177uW7\337\247\245\322\336\333\007\245\222a\245\305\315\277"
+	.ascii	"Z\3726N\317\346\341\264'\315\306dj\226u\261|9J\313\r\225n\305"
+	.ascii	"pj\376\331\263\213d\307\3305Q6[>6\030\313\367B\t%\312\r\247\246"
+	.ascii	"X\2226\034\366\f\315\256Y\273\251\215\357z85\305~\372,\237\265"
+	.ascii	"k\333y\013\206SS\314M\211]K\267\260\234\232\177\027\311\336\331"
+	.ascii	"\274\034\245\235\255\264\325TF\305\326\345 \355l\245\244)\245"
+	.ascii	"]\026[\207\227p\332\005SF\334\023\273\226s\264\263\223\356\252"
+	.ascii	"\376\333t_\\\030\327\205\r\274I7\306=\272,\356\276J\267\305u"
+	.ascii	"\2722\356\322e\262\314\213d\233\267a\254\230\347\345\336J{\357"
+	.ascii	"[9)v\r/\225)\333\026U\363\312E\262Xl]\016\322r?\245L\247\333"
+	.ascii	"%\"\224p\221,\023\373\226s\264\334N\350\226\225S\363o\357\345"
+	.ascii	"\007>\037|\360\201\215\2275^Zp\220\355\032\0138\202}\201\215"
+	.ascii	"\325\036\\\226\233\325\370X&e\246\366\315\277Q\372\277Ec\317"
+	.ascii	"X\246Mc\315\330\345\336\313\275\367K\370\263k9xo,5\312\275\227"
+	.ascii	"\037\341\377\371E(\301\246\261e\354Z\207\244\275\261\2562\270"
+	.ascii	"S\3434\366\267\367\322\347\203\017\3243\037kR\320|\253\247o\347"
+	.ascii	"\364-\024m\311\374\334\372\361\240OS\313\335\266\367\326a@\227"
+	.ascii	"\016\262\2331\234\276v\266\0075\300\232\276-\323\267C\264\365"
+	.ascii	"b\277X\346\345\354\336\326\261>\246\034\371\270\371\366\207V"
+	.ascii	"\261\367\336\366rhz9\364\026\207\276\275\241\355\026\313\305"
+	.ascii	"2?"
+	.string	"X\274[-\326\356\252\322r\253\355\275\324Q\361\306\\\265\335|\013\245o?\240:\201\201\201\201\366\003z\313\244\263\345Ao]h\017\266\007\275=\322!\330\036\324\322\331*\226\351\201\265r;\305\316\375DZ\356\345\336K\235\333\005\350\306\274\371*\364\255\007(\016\f\264\036\240G\241wl\017z-\017\372 }8\333\203\276\003\372s\266\007\375\005\364\355l\017j\337\256ub\341n\337l\223\213P\302o\224\354[\336\033\311\332\rr\254\335\340\224\013\202\304D\363+\240/\001}=\333\203^\204~\323\366\240\017\241w,\017\372?\333\203\332\245M\263L\f\254\332E(\341\370\b\311.\333{\251\203\263flM\232\233\357\201\276Er\035$\273\204\007\365-\006\250\r\264\030\240\277\332\203\345A\217\3302\f\360\022S\326n\333{\231Agi\243I\307\315_\332\036T[\036t\307\361n%s\240Y\310;\350\2577\b\001\207"
+	.string	"\006\017\362\206c\360\353\002\200\371\357\227\377\356\375\267\371\337\276\377\212\371\357\231\377\216\371\357\337\177\375\376K\346\277f\376\253\346\277ip\214\377L:\221\376;\367\337\257\377J\371/\035\225\363\350\277r\377\005\374\257\225\037\363\374\370?\276\t\376X\375\261\376\261\315\2177\3748G\356\334\347\n~\033$_\235*\370\263\2153\005>,\024S\276q\242\340\317V\377i\202$F\177\332\204\032\311\031\203\020\236\344"
+	.ascii	"\374\231\347\031\374Z\003\237\3774f\013\324\316\0262\217\366"
+	.ascii	"\340\317y\177\326;\036\366\273\0070\3405)\340\2179p&G \301>A"
+	.ascii	"\373\013X\314=\374\232\303\177\"\377\334w\036\377\274\346?K\200"
+	.ascii	"\001\177<\202e\263ng\221\215b_\270\332i\f\341V<\300\037\370\236"
+	.ascii	"\223\223\360\243`?\366\373\263\226?\337\375g\361{O\377\224\313"
+	.ascii	"\237\247\264\220\347\376\223\350\317V\316\241\337\236\340"
+	.string	"\267G\276\023\205-\372\255\214\367\374i]\346\240\005\224\352\307:\316 \333uS\360\3330\267r\222\340\307<p\230\r\273\023!\353\367\337\244\337\236\271<7\347\342\334\r\377\275\340\277\034\376\353s;\374w\005\377\365\360c\257k\200\033\342\267Q\376\033\302\177\221\376\213\200?\313\3703\323I\374o\005\376K\342\277#\376\233\336\027\376[\271\033\370/\005\376\373\201\377\036\3757\004\377]\377+\364\337\375_\024Z\226\312E^\243\337\262\335\024W\351\277(\370\257\n.\013\036\b\200\372\257?\360\337\347?\001r\f\256\365O+\360\277\003\316\373\177\376\351\333\217O\234'\376\234\364\237B\177V\372O\023\277\315\373\355\226\337\352\375\326\313o\361~\333\345\267\\~\233\363\333\363k\376s\375\261\2163\350\267r\277\315\277\205\373\037\370\3338\213\377\023\350\267m\277\305\261O\277g\231\330\374g\t\255\240\215\300o?\b\301\226a)\005\234"
+	.string	"\366\303\177\017\316\341\177\216@\004\330j\304\237&@\005V\377\314\377\376\023\004\277\275\371\317\020\374\266\002?6R\257\366"
+	.ascii	"\026~K\200\377\374\300o\321\235\337f\260\032\376w8=\360[\n\f"
+	.ascii	"\340G\241\\\r\333]\377i\032\030\256:9\360\3370\\\342\202\251"
+	.ascii	"\335\211\331\177\321B\234\347\006\360\223S\003g\006N\030\376"
+	.ascii	"S\377\031\312>\3711\211\223\304o\203\234\030\300V\262\316i\317"
+	.ascii	"\013d\002\374v\304i3\342\317\0028-\360\343!\347\013\377\251\343"
+	.ascii	"\202\225\272\007\231\203|\200\037\213\270\006~\235\201\037\257"
+	.ascii	"\321\3350l\345\377\315\237\216\375X\355l\341\317pg\005d\334\346"
+	.ascii	"Oc\374\326\353\2673~\253\343\267@\260\322oG\234\024\370\005\177"
+	.ascii	"\312\341\317+N\026\254\214"
+	.string	"\025\016\203\005\236\363\2476\377y\302\217O\260A2\217\377\214\300\217'pB\340\317Z\177\336\372\317\007\330\037=d\274\303\361\376\301\237\206\375\330E\376:\035\360\343\017\377\331\200\0373\371q\223\223\001?\356\340\307 \330\027\260\333\271\200?\213\345\261\377T\300\177\227\030\316r\375V\310o\251~\353\343\317Q\177\236\361\237\t\370\355\217\337\366\370\263\222\337\222\235\"~\313\343\267]6\210\360D"
+	.string	"\006\357p\017\376\323\204\271\377\017\370\323\257\377\216\375\367\310\177\321\376k\366\337\263\377\226\375\327\310\177\311\376\273\374\363\n\377\005\373\257\327\177\257\376\333\343\277[\377u~=\343\317$\370s\361\317D\177F\361g\241?\023\377<\364\347\242\037\303\235!\376\234\201?\233\370\363\372g\026\376\023\304\377\235_\337\375\370\t\217\037\313\375\267\177\032\344\307n\377y\200\3774"
+	.string	"\331\177~\370O\017\376S"
+	.ascii	"\377\311\301\177i\374\367\351\2773\376\033\365\343\266\377\314"
+	.ascii	"\340?1\370O\016\377\351\363_\303\237\326\370\361\003~\377\264"
+	.ascii	"\001?\226:-\370\255\004~+\342\267\016\370\255\n\277]\200\005"
+	.ascii	";{\376\303`\211\330\370\237\341O\177\376s\347?o\376S\377'\372"
+	.ascii	"\237\367\317k\376\334\367g\275?\337\375\031\313\237\353\376<"
+	.ascii	"\367\347\270?/\371\363\330\237\207\374\271\307\237\267\376\214"
+	.ascii	"\365g\251?\317\370\263\323\237[\374Y\351\317(\370\263\t\376l"
+	.ascii	"\364g\344\237K\360g\026\376,\342\317%\374Y\204?\207\370\363\007"
+	.ascii	"\177&\300\237;\3703\006\177\016\300\237u\376\314\363g\237?[\360"
+	.ascii	"\347\r\177\336\371\363\315\237\203\177N\377\234\377|\377\374"
+	.ascii	"\037w\340\307k~\354\367c1?\356\373q\336\217\355~|\345\307V~\274"
+	.ascii	"\366c\272\037\317\375X\312\217\241\374\030\356\307N~\254\344"
+	.ascii	"\307I~\234\366c\264\037\233\375\370\310\217\307~l\344\307a?\006"
+	.ascii	"\373\261\327\217\203\374\270\353\307>~\314\343\307\\?\326\372"
+	.ascii	"q\326\217\261~l\365\343\251\037\313\3701\323\217]\374\230\305"
+	.ascii	"\217U\360\343\023\374x\305\217c\370\261\321\217\221?.\301\217"
+	.ascii	"\211~L\374o\345\307#\3747\375\377\302o\233~\f\302\217K\374x\370"
+	.ascii	"[\260\037\013\177\034\202\037\177\340\267l\277u\373\255\224\037"
+	.ascii	"\303\360[&?\036\361c\027~\334\302\217'\360\343\023~\374\200\337"
+	.ascii	"\026\177{\374\255\b~\334\200\377x?V\300\217E\374w\362[\004\374"
+	.ascii	"W\373\261\t\277}\341\177\207\377{?.\341\307$\374\370\347\307"
+	.ascii	"!\3748\304\177\027~+\343\307 ~|\200\037\033\340\307\034~\354"
+	.ascii	"\363\343\013~l\301\177\231\3747\311\177\221\3747\355\277X\377"
+	.ascii	"\265\372o\325\177o\374w\352\277-\376\313\342\267_~K\345\267s"
+	.ascii	"\277\235\362\237\304o\317~k\366\333\262\337\036\371m\330o\211"
+	.ascii	"\374v\310o\277~\353\364\333\021\277\265\300o]\370m\013\277\245"
+	.ascii	"\300oy~\233\341\177\331\377\261\377U\376\013 000\360\3471\300"
+	.ascii	"\317\323\200\177\004@\001\377"
+	.string	"\325s\253\314\336\333\315\337\300\245\177\373\373\243\033\351i\357\035u.\367S\322\r\372\333\333\323\332\017?\216\305\226\203\377\031\237\003\"\330\233\305\232r\357m\311h\2607\244*\017\373v{+i\035A@\013JIKjIM\013*\303\222\232\326>R\022r\224\341ik\035-\251\355\235AI\351(\205,\250%5\244\235aImCm\026Z\240\354^j\035m\245\254\235a+m\244\255\226\005\345aII\013jI\r\t*\303\222\232\026\324V\323\332;[\t\351\351\205\322~\312\260\325\264\302l\265,\250\235%\265,\250%5\2559\313\004C\013Y\r5e\327\222=ZR\3322\232\254\220\236v\354\226\226Y[oo\333\326b?m\273\2759\330\333*\353I\017I\312\302%\331\311Hb\202\224\305\241)i+k+\331\035\331m\267D$ko\"I'v\323\336{\223p\264\264\333>\254\335\221\016\253\315\324bo"
+	.ascii	"\354\345\336M{\037\331m\267\367>\332{\247OV\313\275o\354,)\233"
+	.ascii	"\232\366\236\362i\332VGq-\366\276m^\340\240\226\324\266\262~"
+	.ascii	"\342\222\250)\267\213\345\221]b\312\332\312\255\247\365\244\325"
+	.ascii	"\216\3226\323\336\333\216\321J\250\031b\324\216\262\375\350\032"
+	.ascii	"\232$xCOF\216\233\255\236\355A1\260<h\346\3739\252v\026\261A"
+	.ascii	"\025\004\311Q\346\257\030\023;0P7\243i?G\221d\0251\262u\363\005"
+	.ascii	"h\226\211\242\341#\037\226\373\310\007\354k\n\204\n0\231\241"
+	.ascii	"2\0065+\023\303o\312\315\347\271\242\3212\262[&J\206\211X\250"
+	.ascii	"\275\221\202\244TOO \234\007\n*v\203d\303I\226\233\317\243d\211"
+	.ascii	"\243\243\017\217\254\310\351#\214\310\0130`\364\201\035%r\263"
+	.ascii	"\274l\310\365\335,\302\317Q0\261(9\316\f\341\020\207c\307W\236"
+	.ascii	"v\353\263\213\241\264|\327K\206\227\237\327\r#\004\305\312rP"
+	.ascii	"|a\202\240@\252\2605Y\336\334\225\363\002\313^\222\233\317cD"
+	.ascii	"\377G{\240"
+	.string	"<P.T\007\352\003\335a\231\350\017T\313\356\246A\263p\332\223~K\002\323\334J\243\264rUh\320\037h\216>\2533J\364\007z\205\206D\266\306\006\f\217\253)9\371<.\3645\220\321\327\220\207\342\260jl>\322\334|\rp(\3267\216\r\027\\\033\322\315\327p\246\257\001\210\276\206\032\372Go\020\241R\242S\201U`oin\376Q)\324\006 \r3*\224\006Z\3032Q\033G\241\320(t\306\355r/)\2416P$\324\t\253))\340BH\023\265q\302\241GXMI\001\036^*S\006U\r4\347'\333\203\036\t\372\364\253\301:3T\312\233\257A\206Fe`.E\312\320\334|\rI\350\022\352b\215\257\331\242\2132\211\313\236\322\027t\te\2016\2411P\030\350\013\224\3112\321\245\377\304\263W~\227{+\371\234e\330\216\264\335\344gP\243\237A\214~\006=\375\fW\3643L\321\317"
+	.ascii	"\207n\0169e"
+	.string	"nv@n~\0065\375\377\004<\327X\346\031\030x\306\235ul>\224g\340y\345T\203\323\236T`\373\321\334{s\370\340\203\264\311\005\225\035\232\31747Roh`\334\374\fG\264\231\223\313I\006\247=U\200\307U3\213\225r\013\225\022\315y\346,s\372\235\177\226y\232\371O'\347\333\234\226*e\tf\316\273\033\312\276\033sz7\371?\363~\222\371O,\247\3359\346f\365\365\030#\346\346S\314\235\341\007\325\274\371\031\272\364K\360\302\003Fs\357\345\331\227c\330<\266\246\346\227\027\312\346\271w\362\235aN0\226y\366u\211\241\354;\365\362\230\22495v\214.7\371\031t\350g\250\322\317\020\245\237aI\237x??\363\256\331\216\245\0377\243i\364w\310\350\357t\321\337\251\323\337i\242\361\322\366\240\",\017\372\2356}Z\3619\337\210(5o\376\016\232\276\235\203\222F\031\005M\363\234;\345"
+	.ascii	"\251\234S\316*'\335)\3052\317\271\266\271\363\t\0275\347\334"
+	.ascii	"mb\201\352\242\373\273d\350\360\252n\362w\302\364w\274\364wx"
+	.ascii	"\350\357\\\351\357L\351\357<ilg{P\0064a\242\3425-\301r\373\311"
+	.ascii	"\344?\225\234K\354\332\b\304\3540\303\344f\233)\333\203Z0\313"
+	.ascii	"\203\236m??\335p\344\212\344h\336l\207\260\235I\214(\361\022"
+	.ascii	"\266\3663I\372\366\227\305\344\346S\355\347\347ZY\236\23117\203"
+	.ascii	"p2O\035H\3161\267)eXn\376\b`g\021/-3\036G\232[\347\216\255\262"
+	.string	"\036g\027Y\016\257sH\222Xs\357%\333\330\231\205Fv\226\235\313\363\354D;\315N\261\363\310\231f\231\347\330i\344\034;\201\234BH0\362\0248\365w\313|5\311\261!\177G\211\310\031\266E$\353\252\f\021>\345\371\245\203\254YI\242EI\005\353\f\"D\304\r\211\233\276\316\231\217\363\307\271\205\n\233\234\322\207\016\017}\035\250\223k\312\2170R7_\207\205\326\221SF?\347\212~N\023\375\2343\375\2378N\254\023\353\274\302SVMVOye\245\352\274q\235\214\211\0359o\374\277\315\273YO(\0278\245:\252s\312\b\r%zK?\247\376\363\305\t\343\224\272\261\331Y\324\244n\266a\346\355\212\232\233\237\243\324Og\223\210\026O*\214\255/\315\022pU\027\345\031u\312\320k\2365N\250\223\3069\3032\317\250\323\311g\271\267R\324\031\343l\352\220\264\264\221\264:0\313\321E\367w\345\232"
+	.ascii	"\312\005\363s\200\350\347`\351\347L\351\377l:\231\216\320\330"
+	.ascii	"\001d\353\250qi\302j\334\374\034\032:]\332\036\364\177\226\007"
+	.ascii	"\265Z~~.e\035e\234\206\270\270\225<%,\355l\221\003\001\307\246"
+	.ascii	"n\316\201\031L\006\254k\006\3421\030\215\210\026\333n2q^\232"
+	.ascii	"90\353\310bz\315\034\230\217\344+\"\242\266*\026\207\245\231"
+	.ascii	"\0033\226\274g\355\332Z\210\273\242\314\201\0300\347\020\021"
+	.ascii	"\265Ue\\\2275\247\322\271\317\244\023\351<:YXf\016\314\201\030"
+	.ascii	"\f\026\323!io\244\253\340\325W\027\335\037\207\017\320..\224"
+	.ascii	"\240\331\311Y\215\272\304\306\013\250\233\237\303B\217A\023S"
+	.ascii	"\326\314M\233w\246\364\033\353#SZ0G\224i\362\231L&\243\311e\262"
+	.ascii	"\231\374g\231\331\357\317|\271\317/\2071S\356\275\255\335\034"
+	.ascii	"3\315N>\316\030}\034;}\234'\3728g\3728F\264\265\263=h\007\313"
+	.ascii	"\203\346/>\251\027\237\21547\037\247\207\276\275\222\305I3\333"
+	.ascii	"\3155\255\2224\371\271\263zK\356\230(\251\356\262\331\333]\326"
+	.ascii	"BeK\356\222\271d/Y/\343\345<\313\314wL\202c\312\362\336v\362"
+	.ascii	"qr\350\3434\351\337\244\321\277!\243s\235\22763>n\376\315\235"
+	.ascii	"\276\205\362\377$\351\202\304\214oJ\236\313R\362[~\222\235\344"
+	.ascii	"&Y.W\311T2\\\206\222\255\344%9.3\311Q,3\323\375y,\223\2611\367"
+	.ascii	"\224I\312\314\3244\263\022\300\246=3K\243\264li}M\253W\267\346"
+	.ascii	"\245i\317\270\314\316\264\231aaS3\373rF\227\317\314\320\240\375"
+	.ascii	")\227`\350\262\233\331\025%]f3\323\263[2\242\214u\220\177sE\377"
+	.ascii	"&\212\376\315\233\376M\022\375\233#\3727D\364o\202\350\337\354"
+	.ascii	"\320\277\201\322\2779\322\267\t\243o\223E\337&\212\276\r\234"
+	.ascii	"\276\315\232\276M\231\306Y\266\007%\301\362\240\331\310\025S"
+	.ascii	"F\214\310\315\267\t\242o\343|0\375YH\036\222\203de\376\312E\262"
+	.ascii	"W\006\313D,3\207\375Y+oY\275\027v]0\232q\\Sl=l^\023\017\031?"
+	.ascii	"?b4\367\336@\250\302\362\016\313G\006\315\311\347>1\355E\331"
+	.ascii	"\220oc\245o\023\245o\363B\337f\353\007\315\350\007\373\364\203"
+	.ascii	"w\372\301(\372\301&\372f\331\036\264\003\313\203\346,\034\253"
+	.ascii	"!E\224\334\374\340\231\256\312\333\326\211\200\261\355\376C;"
+	.ascii	"\322<\"\253\312HvMD\213\255\202\f\332X\263\312\352\331<\021Q"
+	.ascii	"\333.\375\241\2115od\034\031+_e+\313\314U?N\203\325T\345\244"
+	.ascii	"L%\"j\253M\264\262\346\336\373\203\340\030\253#Rn2\325\217\327"
+	.ascii	"\340\300<u\263t\260\360\360\\\334\234\245\202hykT7?\310C\377"
+	.ascii	"Z\275\370\241\314LWJ\373\347C\231\237rT\266\221id\247\f\225e"
+	.ascii	"\344\032\226\231g\\\3113\262R^\262v= \200\326e\347b\340P\226"
+	.ascii	"\345\031\271)\0054 J\034\031F\217<\303\226\301R\332\243%pH\032"
+	.ascii	"\362\2039\364\203W\372A)\375\240\223~\020\206\316,r\013\313\344"
+	.ascii	"\220]\210\351\221\004u\363\203HZ\005{[\016\250\r\f\264\034\320"
+	.ascii	"\253\200\372\252\237\276\nF_\275\323W\251\350\233\375D\337,m"
+	.ascii	"\017j\333,\017\212\317\330<\005f5o\276\252D\177\0042\f@kS\226"
+	.ascii	"\301\177\226\211\315\034\233\301~g\240\272\350\304\366^~\340"
+	.ascii	"\363\201Z\004J\233\0164_\365\322W}\350\253\\\372\307a0\037\356"
+	.ascii	"\263k\352\0315(/n\306\315\237\3430:X\216\230\341\335|\247X\036"
+	.ascii	"\364*\016\335\263\264=\350\235\263<\350\217\367\360\026\260$"
+	.ascii	"V\244n\276\265\273B\245\264kRZ\325U5\253\340\300\342\264\005"
+	.ascii	"g\211\321\374\331\202\255\200\305\375\270\361\247\207\271\340"
+	.ascii	".\370\013\316\303^0\236e\342-X\313\361\235\225\373\305e\320\236"
+	.ascii	"4wr\360\214\276&\243\257\373\364\265\027}\275E_[\321\327Q\364"
+	.ascii	"u\023\375c:\373\226\036\221\262\325F\305\003\255\004eI\331\034"
+	.ascii	"\216\222\242\021\273\342u3\216\202\231\270\tN{\242\300]\227&"
+	.ascii	"\225\275\2704/\030\n~\202\245\3408,\207\247X&\216\202\235\034"
+	.ascii	"\277a86\034\305J\351k\316\331,|\312\275\227?8\n^~i\342l\001\332"
+	.ascii	"\235\345d\273\264=\250\317\021&"
+	.string	"\326\307\022%r7_\007\321\377\261\033n\303J,\023/\301I\216\221\330\270\347\021\326\252\224\261\325)\355\226`5\313\267e\245\271\367\366\371\340\203\017n\240\224\211\271\322\371\232\207\276\246\322\3275\3645\224\276n\3227\226\007\275f\241\237\236\321?F\273lL(.(g\327\207Y\021\234\252$Z{eG\304\244\344\332\3040\331\025\033\301\0058I\326\220\266\334l{\330\036\264\307\362\240\330\310\317\261\230^#E\206\217\2337\340\"WL\002E\252\276\3400L\344E\224\r8/*R8\300p\324\220/\233e_\323\354*1\027\016\202\275\260\020\354\003\377\300]\230\007\336\201{` \226\211\277\260\326\361\026\326q\006\205ip\371h\306I\341\033K\270\\\335\032\270\212\213\025\266\201#\007\223\362\212Jiu\243i\331\356\026WU\323.\253)\016\213\313I\211\2770\2165\374\205k\034\205!An\007N\235,\304\366\246"
+	.ascii	" \337\245\355A?X\036\364)\235~\nE?U\242\237\236\351\247B\364"
+	.ascii	"S\034\372\251\r\375ti\nSi\033meae\246\272\350\243T\364Q6<\343"
+	.ascii	"\002F\201\225\271\371\250\021\034\205\n\321?~\302N}H\276\034"
+	.ascii	"\335\374c\247c\031F~\360\230r3n:\305\224k6n>\232CO\241r\261\210"
+	.ascii	"h\361\244:1\1774\355\356\260\224\327N\013\016\245]\226\036M\275"
+	.ascii	"\252\246\216'W\212\210\026O\252\214\273 ?{\027\314]S\323\262"
+	.ascii	"}q\"s\377D\264xRg$\301\270S\346\316'\242\305\223\332\342\256"
+	.ascii	"\253\254\313\r\273-W\200\227\313\315\023\321\342I\215qg\005x"
+	.ascii	"\323x5-\233\027\252f v\201\2230\023~\201a\340\030\370\bo\274"
+	.ascii	"\204\221\356\032\314\002\267\270j\260\222e^\300{\346\327\306"
+	.ascii	"Es\2372\300\333\274c\254]\333F\212\362\360\265\0243\225\203\004"
+	.ascii	"H\323\222\203\374\363\214F\317=\375\337?3mi{^|\362\220\2747/"
+	.ascii	"\313\274e\256\337\377}v\327\203\356\346\237U\364\317(a\256\030"
+	.ascii	"\0353Md\360\334\302\250\361\335\276\033\"QNBn\376Y\204\357\024"
+	.ascii	"\242\177r\351\237S\372g\f\375\023I?g5nV\371\322<.U\220\334\254"
+	.ascii	"\356\235U3\276|\371\325\233\036"
+	.string	"V\256\210\271\371\035\024\321\357@\311\205\213\252gw\226I\\\232\2249^9d\210\311\273\252\367\226C\217\212\307\315*\336\337\234\244\351uu\260\225%\213z\347\223ud&8\305\244E\371w\224F\203\210\252\345\352\335\033\233\227,P\376f\303\234\214)\271\371\002"
+	.ascii	"\304\202%\355\373\200\026\331\032}c\rK\222\233/\200)ttj\335\323"
+	.ascii	"\351C\311\230\225\253u\371\210E\035\340\315j\025\235/MJ\252;"
+	.ascii	"&\215\232\002\007u\363\005\340\006\005\212:W\247E\266\006\207"
+	.ascii	"\006SH\217)W\347X\354Xb\335\254JI\367\274z\2745oV\345\322=!u"
+	.ascii	"`p\334\254FA\343\224\356\326\250\304A\251\323\032\273"
+	.string	"\371\0020\2426Q\233\250qP\226b\246\376l\364\234\254\365\200\273\032\207\003g\343\207\023\365\355fy\264\373\3247\325\211*f\357\213RNR\225\222\307\315\027@\325\221\253hG\324%\030\317.\367T\326Q\230\004\244a\"\233\372\333KS\037l\322b\244eIru\311U%\"\224p>\261\"xH7\253n\317\231\252{\322\274\371*\233\332\366\253A0.5#7\237\0035\372\007\320Hl@A\335\254\256\235\357\022\341c\ns\263\252v\271\233\251\274?\036*\363\312\326]\322\315\352RM\263\314WQ\221|\251\223\363\304\205[\225\233\317\201\237\276}\025t\005\366UP\325\354\352\331\257\252O\260\270\264n>\007|\372W\313~5U\202W\245\274\371\034\350\351s\220\205\310\211\250c>YGc\f 7\204l\315\337\315\226\037\013\264\260\253c\252\230\232'\233ML5bGgC\253\213C\033\035\224Z\004\325\n"
+	.ascii	"\337R\023\364\354\246I\226$M\230\374\370\241\016\361\311:\n\303"
+	.ascii	"\200)b\310\326\374\341\2632P\256|]\035\222\356\375\030c\n\273"
+	.ascii	"YU\242Y\251\031\035X\300nV\275\3203\2335\035N\300nV\205\\,>\274"
+	.ascii	"\220-\335\254\0069_V\322\361U\345f\025\210\315+\303zB\345f\265"
+	.ascii	"\353\216I\003\207\367\342\202\301I|p93\343\342R{\300\211\231"
+	.ascii	"\022C\273$\341\200\343q\265G\316\223\215\245\222\233\325\035"
+	.ascii	"7K\330\002\265\234:F\322\304\300\273\371\034|\251Yj\226\272\005"
+	.ascii	"e\337\314\305-\233\250ZW\267\322&\024\267\262\233\325\034\351"
+	.ascii	"\333\025\272=\034*\225J\245b\205P\005\t\331\032\264\t\0310\245"
+	.ascii	"z\343*\326\325\r\223\035jn\334\254Z\331\360u\305q\335|\016h\250"
+	.ascii	"U\026\275\342\244\006\315\315\347`\327\250\241J\221\260\0233"
+	.ascii	"u\223C\206\024<\325\306U)\233\247\362\300kb\352\303Up\025u\206"
+	.ascii	"O\326Q\230\002<1\t\221\302\003\215\231\227\233\325\031j\324\031"
+	.ascii	"\252,\300\233U\250 .\266(7\177\003%KK\252\223E\262\235\022p\364"
+	.ascii	"\343\206\030\312\342\316\252\211\214\253NSX\360X\322\364_=\263"
+	.ascii	" \031bEmR\231\312x\261\005\336\254\276PaX\346\255\2501\216\007"
+	.ascii	"c\313\352\346o\260\324+\330V\320o0\246\266\270\332\"\345\262"
+	.ascii	"H\266\023\002\342~\334\020\333{\352\003\2563\363\203\213\220"
+	.ascii	"5kT\245\rc_?n\334)6\267 IW\225@ \213R\273\371~*\322\1775\003"
+	.ascii	"asOn\376U$\365(\213_\034\215\233\325mcU\005\356"
+	.string	"\353\346o\260\245u \326\202\343Jj\216\206\0325\351T\360n\316\251y\302aq\353q\3637H\322f\314h4\026\311v\362\211SN}\310f\262|\301\235\271F\303\345O\315\213\233\365_\272\327\025E\n\314\203\031?\277\274\364a#\035u\020\246>\345\2101\345\346{\270\323\277\036\243\307\240Z>\354\354\275\205\006\267\237\246@\260\201\233r\225v\363=DYr\035E/\321a~\2226\222\020\017\200Y\256\262\364\354nn.S\244<<*7\337\003\233\234\226\262\327\234\362\205N[\261v= P\004Ks\356\306uHZZ\241\314\213\356\242\257h<k7\265\263\225\234\3745u\027\324\005\231\336\027\rF\367\351=\255\247\275h>\313\324]t\235\217\356\242\251\330:k\327\003\002e]\232{/u\310\034a\223\332\311r\347\353\220\264\264\302Y\237\346\242\363,S\343\371\214\240\3614\026\275%\001W\230\266\244p\370"
+	.string	"G\314\026\275*4\377z\213\276c\262\3441\346f\255%\235\222\252\302\342\346{\340\241\177mg\231:\213\237X\\\032\017:\364=`\351{\200\322\272\212\346\322\274\272r\363=\304\320\367\340B\337\003\222\276\006h\3645\360\323\277\226\022\247FG\346\312\315\327 \214\326q\032\212\016\031\334\216%7_?\371\257\276\360\003\313\222\2333\334\255\342\245l\272\371\372-GO\210[\332\315\327N\226\004\222\241\272Y7\321-4\270\363 x\345\004G\025\223\353&\277>b\227\230 \020\320\314\315\030\311\3175\023\233+R\232h7_\0038Mv\335\246\311\264\333\nS;\312"
+	.string	"\201GV \3404D\002\341l\332\272\334\330n\326j:\211f\373U\025\n\323\235\325\315\327\240M_\007{h\t\022v\363\265\227C5\222k\346\257\246eOJn7_\003\246\276^\3524+P^\334|\r\216\350k\264\377\352\n\276\344\030\273Y\237\351\026\032"
+	.string	"\361@\365\202\204\257\253\354\372\354\327f\326\355\212]\246\252)07\347X\036T\037\371\271.\363j\253R\345f\034\313\203^\203(#F\264\330\n)\240\361\345"
+	.ascii	":\271\371\211\005\022!\242\303VH\001m\2152-.F]X\337\327\227\036"
+	.ascii	"\262\302F\232\021\204JK\257\206`\271Y\017\311\200N\377\032\210"
+	.ascii	"\026\242\275l\036\221\260\263f\006oA\202\350\037\036\224\366"
+	.ascii	"n\261U\220\t+kfP\246\237\201\227\356\241{\350\037(\2258\354\242"
+	.ascii	"o\337i\037\327?\312\344\232g"
+	.string	"\306\376\253B\271\037\1777?\003.}\264\317\352\035zG\034\337\032\245\275\233\237\301\r\034z\013\207\326\241u\350,\235\245\265\276\203t\205\002\246\351\034\327Z\270\356\007\230Z\035\032\330\324\216\233\237\201\223>\006\200WW\177\313\313\r\244CX\\\027\335\337\224\322T\223\233\217\201\231\033\372IW\331\274 6fP\030t\321\307\200\312\324\324\217\0371\316\300\335|\f\326l\330\260u\0376\322\321\2070(\\c,\306\335\315\307`H\224\246\0215\3433\3225\273\237\366\236b@\2251\345\236\232\372\240\311\336\232d\335|\f`\350w\250\242e\350'-C;i\247tm,L\027\235\230\22535,7\277\203\023\375\016d\232I3\245kw\357\275\225\351\034\2254\315=5\365\001'm\316N\307\315\357\240\365\002\206\345\313\273-\005*fJ)\375\0160\364\257[\320i\027\226\017\002/\366\326\002b#\225\266Ax\007$\375"
+	.string	"\374\351_+i%\273f\221l\247\340\013$\2352E\256\366\364\257\2214R^\032\241[l\001i\356\247)\020\202?\306\242\244\335\374"
+	.string	"\310\351_o\275m\336\n\033\t\352C\330\227\215\032\272*\2017?"
+	.string	"hf\314\244kl\300\262t\321\375\335\265+?(\300\247kr\320\256\334\220\334\234\252A\225_Lm_nN\323\240J\034\"i\362\350nN\321\240\312\034he\245\344\346\364\f\252\314\031\263\242%\360\346\364\017\375\002T#W\246\374\257\342\234)\363\244\334\374"
+	.string	"\360\320O\307\330\324\317\357o\366\311\002+*X\315\2753\245\256\233\037"
+	.string	"\033\372o\366*\355\215$"
+	.ascii	"\035.3\275\03277\233\251\030\233\032G]tb9kn=\262\244a\236\212"
+	.ascii	"\261"
+	.string	"J\366\024\020\213v!\222\303\305\315\007@\232.]\322\276\300\270.:\261 L;\234\370\236\366\005wT\035\225\335|\277t\317\256L\231\266t/\3752'\243J\027n\3127\226D\241\222z\271gn\260\270n\344\341i\321\222\346\225\t^e\351\242\373[\333\nk\272\371O\361\236\346\351;\035EZ\334\234r\271q9`X\2028\335\234n\271\223\263\263K\271VH\245\322\3161C\226\314\270\371"
+	.string	"h\273r%\005\363Kg\330l\035\2759\271\371"
+	.string	"(\263b%]c@\030\225\022\215\202\003#\007\204\216\316\202e\351\242\023\333SS\037r\220\244|\331\335|"
+	.string	"d\351\271\271tMo\251\270\353\304\252\312\334\224\0343\225K\245\254\260\2637W\223\362\206\r\314>\273\371"
+	.string	"\220\361\204\231>I\241D\211\230r\337F\300f\325\224\273\371"
+	.string	"\330\372O\341n\231)\034\252\345\002{#Mu"
+	.string	"\230\345\202(gw7\237\003\030\375\247L\316$u\262B\326\216b"
+	.ascii	"\330\023\2625\177{[\201\240w\260\350b\2266\261I\226\314(7/7L"
+	.ascii	"\031\221q\3639pi\263\314\264-U2#\004\26304@H\335\202n`eoz\306"
+	.ascii	"\220&\0267\237\003\025f\232\204\231\256\241{\333e\226\323\323"
+	.ascii	"\236z\372\240\246\226\256\351#\016T\216\246>\004\373fx]\335\274"
+	.ascii	"\246\205\210\020%7\237\003\023}\016bii\266\356\003\004\342p\360"
+	.ascii	"\320\177\212f\231)\232\255;\367\316\362\021\234\221E\312\314"
+	.ascii	"\314\256\3710 nJ\311\001\352\310\021\273\006\025\246\213N\214"
+	.ascii	"C\214\261\261\0329\272\350\3768(\0311b\337\320\255\242\031W\325"
+	.ascii	"4\023\026\226\026\346"
+	.string	"\353+\005\323\301)_]tb\351\220\247`rTE\252|\354\274\274\244\216\344\202\004\261ov\271\235\2025\342\272\350\304\330\272\272\354\033\256\001u\246\377\324\207e\246>r\240\272\264\367\214\340U\232O\021\036<\354\032\336\033\253GpF\234\217\020\035:R\256\340\327\321\375\236r}\201m1\335|\037,\375\247Z\251\226]\363\311:\022\343\001mH\240\232\277\275\347@8\337\230R_7\377\2021iV\232u\244y\246\005\006\232\233\177\301]\212\205\205\213\344\020\001\226v\301\023\235\336Ho\244VV\351W\230.\272\252\247V\366\355\332\355\001^A\362\364\224N\251{\357\243\345v\322\260\245\306\251I\343\351T*\2052\247\370\215\2719\265\001\005\211\022\0347\377\002eZ#\205Jg41B\006\226\316H\243\306\360\320b\342v\001.g\352\304\376\253\267\317\212\224\255\233\177\301\016\375\2472n\231\251\f\324N]\332\033\312"
+	.string	"\200X\251\355\013\335\315\277"
+	.string	"\353\305\213\224I.e\312jP\310\250nNa\250V?\304"
+	.ascii	"^\340B\377\251\213\324\005v\302K\033IK\304\221\270.\272?\013"
+	.ascii	"\002u\272\231\351NY\330\275\367\236\332GaJ\200\002\225*=e\361"
+	.ascii	"\264\203\212\223\233\323\244\013g3\346\315O\307\315)\222]\263"
+	.ascii	"oG\316\344"
+	.string	"\2709=\3123fdy\3358$e~h7\337\202;}T\215E\327X&\272\306\346\331'\235\204Y\326\334Os \\\252\252#%7\337\202%\372\326\346\241?\232&\215\222T)\211\r8\2613g\226x\031\363\206\344\303\214\031\267\033\273/c\274n\276\005T\372G\375\230\250\337e\362ag+\335\265)\367\323\024\b(\2207$an\276\0050\364\217\216\371E(\3012\3211v\315g\037\205\351\300H\2309\020\316\032L\212\264\270\371\026l}\264\317\242M/h\030\273fw\213\275B96wF\277\247\251o\355\032z\324\213E\367\274\240|\227\207\335Q\333\276\3302\366\326\334OK\020\336\263E\277G\212\276\275<\320-[\320.)U\232\336\321.W\365\316\366\2247\337\017\315\373\257b)*Ih\344\3411E\271\245q;\265\204\200\361\201r\271^\232\313T\031\251\233\337\203v\245\310\302\204\335\214f\301R"
+	.string	"w\314\270\371=`\032\305\222\262\025)\263\272\371=>\364\217\3261\321:\224\b^\332H9:\b;\322L`\330\232n~O\226\276\035\263\250\024:\264\nJD\357\257\275u"
+	.string	"\261\221\372\352\261\241\247LA\251\330HA\315\035\245\222}\354\325\370\362\366_\275\201\021\005\005\353\346o\350\323\337\240E\377\350\223[&\372\004\215r.\355\035e"
+	.string	"#9p`\230iq\346f\024\312\031\215\026g7\177\003\234\376\0067\375\243q(\034\225\246\21407\243o\331\215\205\223)7\177\003\231\376Q'L\376\350\270\274\270\371h\033\352vT\311Q%(\223\357\354\275\223\366\306\272\n\002N=}\370\321%\226\21129\217<YJ\335|?\273\026\253\320\020\211\\\211\324\244\t\342\tdN\262H\304kr\305\t\253\020Y$\024L\256$\220EB6\307\341\t\024\202\206V\342\004\206+Q\021'h\030D\256\311\025'\250\300\300p\035B\341&M\256$\220G#\262\270\"\203ADDd\376\t\240\342\360X\242HL\032\2137ADD\244\207\3658\034\002Z\203<\024\021\031wL\304`,\312?\001\002944\004B&\211%B\030\025\205\016\240\302\250H\034:"
+	.string	"\t&\bM\020\241\"D\022Y4\002\235&\222\307\022 O\021\212\303\344\360\346'@ O$\207D*\214\307\242\242\241\020i\004\n\n\025\211\311\023Hb\2218\001#\fG\343\004\222\304a\f\003X\203\214.\340\254H\026\021I\340\204$\221\bY\034\036a@\022\003\360\023 \204\212\304c\022\031b\r2\032\002*\022C\034\221F!,\030\0322*\026\215\3054)\\M@D\2421\030\217'\222\306bjb\270\016\345\344\212$Z\211\320\240\"\321\304\006\022\305\265\310\230\223,\022\217#H\254\302`\221\021\n\243q\210\347\204\344\252B\006"
+	.string	"$\205H\027\200\222G\025]\211\2100 \207+"
+	.string	"%\217\301d0\205\344J\002(y\314\0312\036\223E#\n;k\222x\334\200\215\t\023\306\025\3050)L1,\362\254(2\242\220\223\374\t\020BE!\204\212\200\212F\023\260)\232\270'R(Tt\223\024\026\205\212\316\242P\021^M@Df$r=\006\005\r\323\025EF\240|L\026\341\343\2548&\221D\241\025\003B\rAkQ\21084L\203V\244QF\246\037&\207ABE r\222\303\241\"\242\025\206\344\212\\1 T\304A8d\0042&\215G\r\310\022F;\310$\261\204\220'x4&\207@\304\240\"\013\310\"\0254\230"
+	.string	"b%\"\302\220\202\004Z 1B\205\033d\221\220Jb\204\n\301\240P\206\024\303\"\fA'N\b \216+\021\021\206\"\243qH\230bX\324\341\321\260\022\031W0\302\260\036\211)\004\025#0L\016SP\241h\344Y\217\301\037\0207\251\b \222C\021\020*\022\211\216C\033\022D(\024Y\020\222\030\241\202\005D(\024Y\350\021*\022\217\303\265\204\220\bH\030T\214\301\230B\321\330\302:4\004\332\021*\022\207\206@H\241\020"
+	.string	"%\206E\t \213\2046\b\215\204;+N$\207\206\353\n\310\3430\206\240\343p\005\235\341J\364B\232$\026YP\327\342\321X\342H\214"
+	.string	"\016\321\232D\256 \261\203TmnB"
+	.string	"\221<\016\213@\2500\016\225\310"
+	.ascii	"\017\320\216P\247\304P\210\002Hx\242ED\024H\341M\321\232D\n\317"
+	.ascii	"\235\2400\206\265(\304Q\261\026u\ta*L\221EB\302\025y\034\026"
+	.ascii	"\t9`\201\026N"
+	.string	"\310\200\316O\200(\032\035C"
+	.string	"\231\320 x\034\236@a'\002\022p\341\205\225hx\234@\f\353\013\310\"!\235U\230\0342B\256\030\310\240\246\026$\217\306\021\310\"\241tM\016\203\21220L\016S\b*\256$\002\220,\032\0311`4Qd\341\002\r\306b\0201\005R\247Hb\204\n9B\022#TPQ\022@\254\310\341\t)\220\332\246\004\0208\310\027V\f\025\025E"
+	.string	"Y$dA2Ib\204\nZ\325@1\006\343\320\004V\240\3420\211$\246\260&\207CF@CC !\211\021*x0\002\210\240\243\321\210B\022=\256DF\310\242\021\205\234\023BF\306\343\211$\0229\034\261\016\005\025\207+ \213\2046\034\210x\\\213\253\220>\t&\034\300\004\021*\322\213P@\b\n\b\001\275\b\005\374\374(\300\204\037}\023~\260\220\261\205\344\212\002h8\002Y$t\263\n'\260\001\231\201\244\206\013V\034\223+\321:\264&/\320\200\0029t\241h$&\201\212F&nV!\013\026\024!\211\220EB\031\204*\214%P"
+	.string	"\r\207JX\020\264\242"
+	.string	"\032\026\tU\2240\n\016\241?\"\254C%\210\206\353\261HE\"\207C@B!$\221\032D\024\n!\211\320\343\0324\\O\240B\025%\214l\220\310\242\220PE\t#\235 \026\220\310\242\020\212\\\217Z\305\220H\377\224"
+	.ascii	"\2729\256\032\020B\022\2411\254\020\\\221\0318\201\002\212#\f"
+	.ascii	"DFE\033$\n \343\320\tDFE\035$\262(\224\221\303\022H\241\212\022"
+	.ascii	"F\372g\025\032\"\215N\022\0218\201\204\212!Q*\302\032d$*\016"
+	.ascii	"\201\220*rX\002\231\203\206\306\241\025\303\242\024\211,\022"
+	.ascii	"\262Y\205#\220EB8\3075\210\230\302x,\322\253\0209,\201\324\253"
+	.ascii	"PG\210h\242hD\301\2304\032\006Wa\004\220EB8AF\303\023\214I\243"
+	.ascii	"\2416\256C\304\241\241\220pE\032\365\330\254AF\"\241\n\343P\211"
+	.ascii	"\234\025\250h\024&\213Dc\221p%2\236\020&W\244\020Y$t\2010h\004"
+	.ascii	"\341\2124\022\"\213\204vV$\211G\2415Y$\n\221\303\022\310\234"
+	.ascii	"$\212$\021N\022\213, \213\204pT\254AE\342\251\242\204\021\006"
+	.ascii	"\"&\217k\212\fAD#\262\21084\264\n5\020\2710\204t\001gh\230,\032"
+	.ascii	"M@<\032O\360\234\030\032B\032\213\320\225\210\230,2B\207\206"
+	.ascii	"\304dq=\256&L\020\203xT\020M\b\223\310#\321\204\320\230\314\200"
+	.ascii	"\356\210\200\\\217\031hE\026\205+\0211\251\242X\327\030\362Z"
+	.ascii	"\264\")TA4\241\221F\311a\022)TA4\021T\261\002\r\032A\270A\305"
+	.ascii	"\212\025I\"\220qhM!4\201\320\304\n\264\352\214\260@\n\302\033"
+	.ascii	"\344z\304Hd\020\251wN$\217\306\242\232D\016\327b\f\306 a\320"
+	.ascii	"Z\324A#\350 \021\204BEb\320p=\021\\\0014<\032\001\001\r\2059"
+	.ascii	"AkqhM\201\346\b\205)\206E\241\212\022F\026 W\f\034\213\316\342"
+	.ascii	"\t \214\024\032\016\2318K\220\246X\207\326\234\024\232\360C4"
+	.ascii	"\3010\017\255\305\342\360\004Pz\002\005\"\243\342\211\024\032"
+	.ascii	"\016M`hX\3028$d#B\320\232\342"
+	.string	"\270\"\327\243j4Q$\246@\242(\200\206B\025%\214\322\003\005\261 \204$:\203X@\016\001\235(\200\206\030\271&W\2248\177\002\304JDL\206(\032\211\210\214@H\341JD\204aM\016\203\2046\307\341\272\"\237H\026\215D\347\212a\020F\036\215\214'N\344\2324*\022\211RdP\321\b\264\"S$qh\210H\204\026\215\304\244\321\220\221\004\262H(C\222\b\205\344\320\360D\n\213Fbr\bdl\001Y$\204\223\034\016\341\242q\b\237\030\032\302A#\244A\353ZD\302\346'6 \213\204T\344\321x<\256(2\251\207l\222\310a\013I\344pH\247h$&\211HcQ\0162)\324krx\f2\032\226\300Y\205. \213\2042\020\335\004\261 \204tA\250HL\022\207\033@\0014\3249\256I#\343JD\204\001\005\3200\303*\214\200\n\343P\t#\23559L\222@\0014\324\311\237"
+	.string	"\021\002y\\S\020\217A\035\216+\321\0041Y\\\203\210A\244\360F\003\311\243q\304\316:Tb\bC\nt\025\256AF\027\222GcQp\r2\022\345Uh\201\344\321X\204\203,\032\211\311\"c\272&\207\030\b2\032\226\320\253\t\210$V\023\020I\350\244>\336\004\r\327\025\206\210C\030T$o\216\311\021\030\360\t\016\223\303\024T\034s\216\311\021,\f\r\211\307\025\331\203\002hXbhh\210\302:\024D\274I\036\207'\200\362q5a\302\350\004\244\360\270\"\217\303\021\303\3440(\237"
+	.ascii	"J\016\217@\310t\025\346\254@\3055Y\\\221z\025\3020\\\211\212"
+	.ascii	"7\307\025\305\3200\211\256\311a\022y\236*\326\240\"\013"
+	.string	"EF\306\243\nA\215B\320\232\202\270\002\255\307\035d\222(DL\201\310\b\211\002h=\001\224\223\034\022\035\215&\320\023I\241\342\332B\320\320J4a\223L\376\004\210\341JT\024r\270\261h=\206H\032\215\307\0206\306\"\020F\n\327$qhhM\016I\fW\242\242N\0201\0052\247@^\244p\230\034\2460\\\211\212\301\341\220\026*\032\207\324\224\b\2055\310(IL\016\r\203+\0211\231\223B\021FH\016\203r\2211\350D\016Z\327\"\344\231\024\232\360\223,\022\215\364\212<\032\031Q\b*\032\031\217B7\311!\t\"\243\"\272\"I\034\032\032]@\005\321Dp\r2\272\240\202h\"\0352\032O\020\236A\304\241a\212\223\310\350\205Uh\210D\256.\244@\336\304\260\0225Pd!\005R'\205\"\222E\242Q\372\237\037\024<d\340\005\0254\020\bd\221P\b#1D\2218$\n\001tD\206"
+	.string	"\301\223,\032\031QH\201L\377\333(\005\0019pT\204\231\304\324LSF\351f\373\224ees\224JI\231\314\274\300;\233\230\2266SKM\316\202\201*V0\315\030Y`p\215*\245\221\240\316v\004\325\264H\nC\346\346\023`\210\016\226\t\226\t\242\271\206\017cY\201S\177{\212F\020M\360\314\227\215-h\316\004\377\002]\0341\202f\271B\274H\001\0234s\032Qm\030\301Sr\363\t\320C\377A?\224\n\020)>\034\227L\027/\037K).\266T\211Q\365R0$\261\3000\351\232\2341\253,X\232y)s}99\002\346.\350\026\030f\257o\356fi\315j\213O\255\303q\2025\204\307^\332\027\344\352\263\242\374b\353P)\026i\226xQ\235t\230K,']\272,y+\023\324\013j\271C\204\020\251\n\346\251JeV\306\316n^\226\355\275\314A\213"
+	.string	"q\021\307%\345:A\f\023\327\315K\0338,7\0327\337xQ\202\305\357fu\213\255\3415o\016\332\005\355\3225}d\241\322\b@\245\3232Lf\302n\260\016\003:u\351[.u<\255\341\nZ\271<\242\226;\372n\016\322m\235\234+yxz7\237"
+	.ascii	"5\364\037\244\222Z\365y);3\027l\241\243\227\305\3054%\205r\344"
+	.ascii	"\006\236\216\233sX4\311\013r3\024\346U\225(h\224\253%\251\256"
+	.ascii	"\233\317\244\246\232\032O\202HYm\357\f`\\\220i\nPH\035\234\326"
+	.ascii	"\361\226\202\325\3415\2258\t>\211\200\247l\n6I\327\250zl1Q\343"
+	.ascii	"\316\310\3218\263"
+	.string	"$e1\005k\007\237\022\215&\307\017\313\310\0165\265`\233\266q9\272\350\304\330\036lc\001\006\305\356\346`\222\340\332"
+	.string	"\316\350?\310D\231\267o\353\211\032$(\233\336q\207c,\255\207z\326\305\214\306r\013\017Q\232b\201\246\016I\243Q\207t\3632M\003\003\027\305\314\311\r\226\017\026xe\251\222`\031\324\2142G\306\304P\221\315\005\311\324\031U\336\302\214\214\251K\354\320\002}\004Q;+a@\332n\016~\005\277\202E\354~\252\021\327E\027\366`\221\323\312\205\262\305\315\367\013\022\371\257\342\25307\244\233\203`7\215\232\214\0277\177"
+	.ascii	"}\301!\003\320\242\377\240"
+	.string	"\022\325\342\345IL\223\240\227vK\233\201f\212\220 S\3133B~<\030\344\017v\005\201\344\243\257)e7\337)\333\203\n`\307\317\203?\322\2650u\333G\217,\345L\025\022\256\007{\374\301\035A\036\350\333\221\262\0317\337'\333\203r`y\320\240\325\317\203\\^\274\214\271\323\261\225\243w\203\b\231\034\017n\375\330HP+\207\216k\212\214\233m\226\355A\203Y?\017\346XR\005\320\353f\236 \216 \026\323\036\023\026\301\252\007\261\376\240U\360\212\305_3\360\346\273d{\320\r,\017j\317~\036\254\322iV\240(\335\bR\351D-\361\"d\352A\252+6\202\013T(%\005\336\374\363\363\340\224EK\2236%(\225N\375]\225\321qs0*\030\025\254\241\036\331$U\t\322x\260\006\023\214\027\"7\007gD\221!#\370\024\202\335.\222p95q\031'\"RA\247\007\237\326\2024\250 \3311"
+	.string	"\267 \214 \214 \223O\326Q\230\017qjS\216\264\033\301\030\0172\345\335p\335\001\331\"\262\264\024D\362\321\333l\rF\323\rL\t\212\207\222R\260\205\217\336f\\KML\366\002\017G\220\305\203-p\374\326\354\316p\004wp\007\221\242\002\325\374\331\224\2011f)x\364 \322\035\032\236\336"
+	.string	"h4\257\256i\252zY\312\336-,\222\355\364\264\227\254>\344\230\241R\306\306\315* \016\216#0#7\253e\3244\252\232_E\267\320 5\335\374\0018\351\253h\300\240\t\321\273Y=\243[\f"
+	.string	"\311\203\034C\311\237\332\337\3253\277bVCtp\335\254\232\371\271\372GU%G\327\3156\226\007U\305\250dT\277_\3058\254\242\222\334\374\016\302\350\253c\306\212\020\321\211r\"\266\367&\301BA\221\216\310\340\270Y\r\243F\271\360\202\273\371\330i\213\005\334\315\357`\317\313\325>/\352\235\315\322g')m,\254 \032\323\335\337\337^\262\372pv\321\005\211\211\250td\217\326\005\251tI\214\204Z\f\005\225c\212\251\262Q\002\223\025"
+	.string	"0H@ \222I\246e\354\006\024"
+	.string	"\020[\312\210pP#\354Q\320*\245\214\f\300\f\022"
+	.string	"$"
+	.string	"q\342\270f\362\225`zu\2313\257\334\254{_\007\n\242\026\3553g\003$\267z%{q\2130Q\357\240\325\242\321\2602\2038\306\002\322.D&k5\022\005\2467\333\271\253\031i\250\020nV\027\302\302\354\300z\210]\352B\006\332\201\325&\305\261*\273\327\347\223\342v\351V\331\310\216\201\343\2169j\301\302\3610B\300o\215\030\310\024\263k\343\207o\277\334\274\261"
+	.string	"\0250t\334\367\020\310U\006Hk\2547~p\222\331\215\2360@\337\275k\001\274\224\276z>\223BT\022z-\310`\001\017\216\352)}v\267\360\226cR\203\311\022\037\201\234\231\237\r%\240R\214\301~L\310\375\320\017\364\355\243\361#\215\n\037\2501\353x0+\364\246O\347\b\330J6j\037\275\201F\342xy\322\026^\330\262mF\177\031U1\222\356\240\245.\213\33303\261~1\272\023\205\252)\bq\030*Ql"
+	.string	"\302P\272\354\337\303>\201\331I\307.\322\312\022\004\341\037\347\221\257\350\217\nCb\317Z.\321s\353\214N,\f\234\363i.\246C\206\3012\335\33622\240\247\206\342\nj=4\301G-{3\214L$r\253%\264r\273\f71\263%\236\273\002\372'\270p\363\247)7\2338\017-\316\343(\037?\305\370\320\244\355\311\003]\"\272 <\332\t\202[\233\272\321f\003/\252\210\020S\274\314\030f\215D\352\005&R\276X\221"
+	.ascii	"\340\006WY\367I\213-\350\212w;J\265`\230W\234\232\f\030f&B\033"
+	.ascii	"u\345\353G\200\265\355)\201\021Z`\034p\270\361xc\246\363o'\265"
+	.ascii	"G>\\o\316t\274\223\311\245\214\275:`\326\214\244\314r\247!o\276"
+	.ascii	"\363\254\272Fw\021\177w\375\333r\270v\334\202\354k\2079y\243"
+	.ascii	"\241\036\3552B@\336\363\322\317\204\216\210\b*\306\261\036\256"
+	.ascii	"6;\243\356\210rl`\340\214\306\t1\341@;PV\201\2238#\331o\301\313"
+	.ascii	"\252e\2701\261\215y89\247_^\375\225\363\2745\224\"V\223U\254"
+	.ascii	"+7\035\2050\213\210\224\253\r\f\021\002\326\246\2242\362c'\376"
+	.ascii	"@\003\253\262\344\310\315[q\367\366\342[\".6\370\226r \n\200"
+	.ascii	"PK\002\263bK\255\313-\206\\O*\321\022B\356t\326\016!\035]\207"
+	.ascii	"\301\035\331Uw\241\307\206\332E\237\301\210x\314\026\020\251"
+	.ascii	"\004\247\320f\r\002\355D\242qJf\367B\025\177\214\270\b\247\307"
+	.ascii	"\257\211<H\033\005\201\371\312\0325\276\352\214\271g\263\311"
+	.ascii	"&n|k\214#\2303=\205\214`>\234{U4I$5\260\310\211\020\326Se\241"
+	.ascii	"&\016\320\362\364\203\317\f\273q~\235C\225\240\n\030\250\021"
+	.ascii	"\270\277\tIqR\003l\272;\334\275\325\231\360\357\345\376\203\324"
+	.ascii	"\b\200\316\324n\247\310\276\246\222HJbJ\247H\342\227\353\201"
+	.ascii	"P\343\224\332&\205b\233\350\024<\236\004\"\241\261\265\t\233"
+	.ascii	"\026\315\267}; u\214\007\344"
+	.string	"\036\226\317yQd\n\006\371\352]Y\245\233\325\033\344*\035\020\024\002\317\227\277\234\265\354\273\214\346,\311\343\334\026\356;WU\333u\205\260\353|\006\004\302xX\305\201\310\"\341\2703]Y\272\244\222\343\312YxR\364\322\350[\360\330P\0307N\264\265\266\355q\001\206\376\207\356\211c\342\214\355\2636\035bY\361\220\273\236\257\336\024\003\177\344\254\305\016\355<\375>^^\230\3518vqQZ_\302\320\277\337\337\320\r\t\335\334W\217\222!?\357R\315\250\266\r\367\220\r\3447s=)\357{\273x@j\366\246U\243\313\223\024\024\276X\310NozQ\316\341\335W9v\335\031\372!\321\006\rB@\300\214\t\177\227\240\361\004B\260'1B\301@\205\022(\214\355\024\342\331:\370\227\305\347v\327\347\336\235\250\3454\030\373j\314\377\226}\237\3018\376@Y\013R\360\362\007\356_z,\007\244\242\021\237\204%\240"
+	.ascii	"\247\020\224f\347\035>\206m\370D-x\005\2663J\366H\267\232\215"
+	.ascii	"\274\226<\004qg\3742\271M\261wT\002C\255\205\t\264\205\361\354"
+	.ascii	"pJ$O]\300^(\205w}\367\222\231\230hp\301\305\301V\313\230\274"
+	.ascii	"\267`\177\3077\033(\355z&!e\323\331\254\330\3039CU\261E\373-"
+	.ascii	"l\322*\255\364\215u+\n\373\325\211\354q\302m\262\214F\316\365"
+	.ascii	"\252\343\320\346\337\341@\206T\272\2316\210\207\003\252\271\334"
+	.ascii	"\236\211\363\233\262.\311\032\223\204\352\316\240\035\030\275"
+	.ascii	"\016a9h_\277\367 \210j\251+\nb6'\n\365!\311\354\315\030KA.!("
+	.ascii	"5\220+\310\373\240\340\232\020\340\323a"
+	.string	"\266\256\312\252\025{\362\254m\035\027\354\333\250\220\030\206\373/QT\212\225\327\242\305\031\331\207`\353w\326\3547\305\2450\354=\023;\027V\242($!J\351\311\356\275\037G\030\222{\316\302\361\2049\033H\235\005\272\260&\2373\325?\266\236\233\025\375\373\353#\327\247\021\346\323\317\360\377\203\274\377\323T\2104\204z#$\265z\3111\257\356\271^\252\332_\304\027o>\320jz\242Odm:\320\3104\347?\353\373\346\343\n\025\037\216\rf\372\224\327\276\236\360\357\210l\257\030\310o\324\001\n\257N\306\001$Z\365\326\225\232\345\264\351k\270*C\314\231\271y\016\003\352\0052\366 ;\265$\226\325\321"
+	.string	"y\031'\230\343d\2406\274\247>\037\371\032*\032\246\360\262\363\260\002\336FM1\367_v\365f>\022\b\361\025\340I\230\276K\326\204\332\034L\350\004\0321E\326]\\\022Am\344\316\\&Q\326\274'\324\270$\0248\326\347\210\307\374A\262D\005\013R:\245]S\357\201Q\205\341:\201\344\235,\310gi\245\340zGb\024\223^\246W\305,Z\013\246\330\325\222\016\215\263g?\373?hD\241@\3530\036=N\350p\355\362\342\303h\226d\261D\342\327\370\312\t\306\2342\322-z\271*\324q\214\274\265\245(?\"N\367\227\307\321\\\023&\354Y\266\305\374\033\2349GO\344\276\365\347\032\364)=\352\254{\263"
+	.ascii	"50EE\001\322\315\335\253]\0202c_j%\033o|{\222\251iY.al\303\027"
+	.ascii	"\2461\rV\034\210%\206\315\n\237\005ws\204\n\037~]h+\323\321{"
+	.ascii	"\233\275KD\344;\006@g{\363\016Gy\200\264\006\201\276E\257ER\330"
+	.ascii	"\365\321\357\245a\f\203\221\247g\221jx\264\256\262W\217\203\241"
+	.ascii	"\t"
+	.string	"(\027\375\262\031Mj\033\216M\223\225\033eY\236B\264\242\332U\254g\022!\263\265\211\221\240\037\017\267:H-^\262-\267\030\237T\001\230\345_E\371\225\220\rO\317\313\033\302\364<Y&a\243\271@\236(ms\207\\\032\360T\335?]%\277\347\005X$\024\270+\020\232\"\253\235\201\333<\236\212!\003\006Q\013\252\307\301\020\034!*\243\317e>R\345P&es\001\227p.\341y\275\005\305\250\321h\311_\374d{=[\341\331\377\371\243A\247Y\243\245\302\013\312p\3756\272\177w1Vr\355Z\3039d\274\275~Si\366\207\313p\241\334\t\017\016b\343\013LzhM\n\034\273\324\023\n*,\037P\245l\317t\234Kj\212p+YR\366_\254!\026\256\022\002J\340r\026%\374'\251\206\036:w.c?/&\214\035\020\370;\021Gd\302n@9\301\026\342\320Dq\3073\b\334\325!"
+	.ascii	"=\354\270\264\244a\344!/\225\024\326 ![G\017Hl*\214S(x\256\331"
+	.ascii	"diB\303\200I\326\213\260\215\b\261\207\255U\222Y\240j \241\366"
+	.ascii	"\345\007\b)xM\031\212%y)\363i&\270\330\350j]%\364\304\356\232"
+	.ascii	"\373M\035~\330\0308Y\252H$\357\037\260\356\034\201U\233A\344"
+	.ascii	"\007Z<\3679\241\006\357\253;p1\272\216\002\261\305\005\2450\374"
+	.ascii	"\322@\t\324\246\244=\200\0339\333\314\025\330\031\367\225~!\304"
+	.ascii	"\233\"sw\002j`\201\032\332\204\247\336\343$\256\357\307\364\356"
+	.ascii	"J\236$\324'<u\235aCt\021\315=\277\377\323\231\001\332x\342\203"
+	.ascii	"\026\230\360.\256i\034\333[3\377\234`^5\367\233\261\254\323$"
+	.ascii	"\f\n\337D>\232\302]\311g\217\361Y\211\217\355\204xa;\246\340"
+	.ascii	"\306jj\036F\314\212\223\206e)\013\311\341I\253Q"
+	.string	"\030g\f\036\316\353\267\204\365\225m\302\271\311\335\367\335>\256\324cIt\372\221\347z\213\201 \302Q\311\246Hi'\360\272q\007A]\027G\252\023m\f^\n\b\200)\333\336\201y\232~-\024\322\035d\277n'f\317!\007^\332q\034\004\355w\3611\002v<W\006EG\316\013=\320A#\245)r$xLc\345i\371WQ\306\203$`A\260\212a\267\210\016mY\026 \3115\003\365\210\367\350\032I\330\225\f\332-\345\320\252\236a\327\334\020\210E\251]\241\2333T\035\344\231\244\334\212\004\377y6!\345\355\0334\016\320r+\364\323C\275S\316\257\031\277\177\026+\354.s\221\353J\025\016\346\362\177\200\257\300/:B\244F\037\361\256\331p\237\001\300\251\306\220\346\0225l\250\021\347\027\276\277\310Q,x\236\320\3258\030\303\216\022I,\267\314Z@\rg\021G7\244\t\n\254\242\3646\027\224\345\024"
+	.string	"\355A\370\265\272p\003\310\334.\326\320D\313\303v\374\255\342\335\334\300\\\373\335\266\203\261o\374(\312\213}_cO\022\206\023E%\272\221\365I\003\347\246*\002]\262\252W\361t\254Q\322^V\310\215S\256}v\323\373\331IaX\355?a$D\324h\273\265\251\023\324\323w5\255\325h\235\275\362\004\200Z\025\\\003\300\222P\337Kk\303\035\332\030\200-\201\341@\203\245\226\033\212Txh\332\206\261\224\252\222\221\370o\364m\361O\361;\005U7\310OL\204\263\336\365\223Y\317Ec\b/\3026\021\367\344_S\327b]\007]XxDQ+\271\370<\353\213\212\211@\326z\024S\203c\224\241\372"
+	.string	" "
+	.string	"\271\227{\3135N\340\266\300\2506c\r\241\200\230\245\367\016odv\314\276\263\035\252\020T-w\355\216O"
+	.string	"\274,\022\300\306\276Y\003\242\317g+\304\306\227\201\325(\357\313\3678\3438b2E>\235>2\200\323C+PO\315v\252aE\372\n\003\261\"(K\022\230<\275\306\210X\357m\222f\307\177\355\321@\037\350\001k6?\373\274\336\274\177\023D\211\266\rEL\341\240\320\263z\004\020z\360\346\254x\322\254\271\005\017\327@\202\004\034%\332N'\335\370\204\n\024`w\356\243\363\025\324/r\370b\246@\332t\227\263v\306m\211\352\347\203\326\354sj\214x\357\316T\031z\210\344\007y\320\026\177R\024\257\3248\227\206\3170\226\356w"
+	.string	"\211\b\270\232\342#\224\343\227\205\n\257_|\243\226\263!\370x\233\315<\r\257h\224\025G\242l\b\260qJ\016u\215\330\264\300\\f%\310\216\320\016\242\201=\365\345\\}\202\202\007\374m\343b\247m\r\b\217\023\223Y\025\277\224\212\017!\331nU\250"
+	.string	"\361U\325\214X\256\361\371&q\\\376\375\345Z\006\022\265\266g\017y\366\363e\206;L\013\215s.\320\234\340\f\363\332\233\026P\315\214\276\364\340\256\240\\\305p\213{U\207Z\fv:\250\003\005UD>\024\013\243\nG\336H\274\007]\234\207\271\256HH\007!*\362\263f\2573Kj\013\274\223\336\362h\230!\273Qr~6\335\250\375\305\360\277g\320T\003e\f\255\343S\342\347\274\351\257\255\202C\375\264MZw-n\017\233\177ht\202\374vCdI:\371\3521\314\013%xP\327\306\300%\210m\355iG"
+	.string	"B\203aH\3417\006\277w\264;\362\211\366L\345\236FPQDM\245\205\210q(%\224\033\351Z\225\035\230\213H\267de\\\267\272\350%\206+kV@\375\223Ly\t\250\017T[\277\352wN\334\312\3759\311@\315\037%\"\007\021\266v\217V\261\024\331w\317"
+	.string	"Q\334g\376N\023_\223\237\b\242\252\177\357)O\257"
+	.ascii	"\262\244\300\230\325\016r\210\333\034v\367>\237\177\007o\376"
+	.ascii	"\025 "
+	.ascii	"\254\272I\344\275*\251\021U\033\253\221\315A\030^U\343\"\317"
+	.ascii	"\037\2661\216\374\230\204\007z!\340cA\017\217j\356\f\200\214"
+	.ascii	"\353*Kk\025-\021EV7\232\345\022fw\242`\343\340k\317Q\371iP\302"
+	.ascii	"\031\177DG\310\271\362\271<q\316\001\320\323\307{8\200\251'\334"
+	.ascii	"\212\310\375b\210L\232\327\275\3466R=*P\365\t\242~\252\247\007"
+	.ascii	"\274P\301\034\227\241\322\314<\n\"\027\256\222U\0242c\251\263"
+	.ascii	"g\375J~\255I$]DYv\250r-\331r.{`\276\202\317\375\200<&\216S\370"
+	.ascii	"\326F\276\034\326\2171h\177\336\260\234\276\016}\210<}\363\331"
+	.ascii	"w\217)oc\3416\007\355\031\375\364O\177\b\371\360np\206\021\r"
+	.ascii	"\343\342$)T\207\2710f\373]\362\020:\325A\307\260\371y\311H\007"
+	.ascii	"8\302*\240Ko\240\320\344l\031-\027\032`\216\212\017\314\026\326"
+	.ascii	"o\214nq\352\356\233[v\367;)n\276\023 c\230\232V)U\321\265+\300"
+	.ascii	"\301\255\243\247\277\244\361p\307/\236\325c\251AS\223e\201\023"
+	.ascii	"\237\240\257\t\235~\343\004\357+(\240\025\037\375W\370\277\263"
+	.ascii	"\017\302@\002\030\260\232\350\225d\257\221r\215J\272\200a\267"
+	.ascii	"\026\002\351\365\177\303\355^\337\372\277z\236a%F\324FZ\256\261"
+	.ascii	"\240K\256\255uEJ\224!\b\304\354\254\024\350KW\263\f\336\320\255"
+	.ascii	"\276a\330\035C\t\177\307\013\024#\267{}\252\377\233\261k\216"
+	.ascii	"\264\333C\215?\342\203\274\275\n\313\"r@\211pJ0\023\007\374\204"
+	.ascii	"9\237\316\246/F\374\244\350J\257v\347\200\237\304\220\366\013"
+	.ascii	"qx;\315\210\030\201\206\261\216y\225v,'\r\303\202\003\356j\361"
+	.ascii	"\271\301\350,\342\321~3\273\255\213\324\377\360\021}\250\033"
+	.ascii	"8C\t]\321b'H_BDD\2401\231\fv\265\275\301\202\345|\331\036\375"
+	.ascii	"+\177(\004K\212\356\030"
+	.string	"\331\2407\362V\220\001\373\n\r%\351Sth\375m\352\007\266\267\354\002?\2664H\364^\265\035f\250\304{\363\372d2\217\366XY\223\317$\202\003.\374N\302\035\270k\360d-\352\243\201$L\271\236\260\361\005\253(\003m\253\377\355\271`\005\224\340\026\272\334\313\245\377/)\316_\255O\257d\304\226\223\r\330\337v\322\205&\223\013d\\:G{\273\216\003<\022w\261p+\274|\262\267MH\220\313\360FJ5\243M;j\225\250\244p@\333\272\224\306<\202 \271\312\333j\261$\004:\031\257\310H\024\373q\311\271y\346A\001\023\274\277\346L!YE\030\360\211(\344d\346b\f\267\217\026\331\207)\340\034l\326K\raVR\327\027dbn\354/\2307\361\345\2271\013<a\203\205FdY\317\215sti#:\271\013\373F\036W\r\271d\323I\355\233\256\334`\206\342\376\246m\033\\(S\235\211"
+	.string	"\266\274\345\034\224I\276\243\311\344\223\250\222\331\202\032\337_\027\335Oi\322\007,\260\361\bk_\323\342\313\274F\347\254P\211\n\001Ua\263\220\024\324\t\306\336q(\227\342\353\327\374\"c\224\312\354b\312ca\271\235\333\177\323$\210\252\236RtRkS\316\234A%KgA\247\247d\243\246\322\361\372\372\241x\2636Q\310\276\246?7\334\211\206\303\210\234\246\250\357\0274Nl\376\255\0077\234\340\301g\341\030'&\250\225d1\314\301O\264@\f\344\251\332\032\265y\002\300\005\026\211\320iQ\0022\277\305M\221\225\226\021y\241\222\205_\313"
+	.ascii	"v\227\252o\252;\023\321_\017&z<\227Lh\235\by\310\002\026b\263"
+	.ascii	"\315\377\237\026\320M\353\363\361\026a\030\263\265z|9U?\255\230"
+	.ascii	"\003\013\314\370\277}H\337v\220\256\215\350x\253_\374\177\b\275"
+	.ascii	"\025\236\213{\277a\207\272|o\356\254\314\276\301y\374\336\037"
+	.ascii	"\002\253\205\263\204Q\317 U\265_\340\276\266{F\007h\261\373\336"
+	.ascii	"\317\002\016\227\321\364Q\362\360\265m%\252{I1\277\023\235\217"
+	.ascii	"Y\346\277i8\034\036\267\345\343\275A\213\223mze\360O\036y\273"
+	.ascii	"\337:X\311\007\021\342\323\343\355\241y\366\346#\305m\005\365"
+	.ascii	" \311\367\357\374\217\265sK$\036F\3676\b\315\3609Xv\300\234\322"
+	.string	"\273\356HmsP\035L\0326\023\250\363O\032\366\212\337\305I\364o\304c\345\345\226\305\343Ey\f\322-\n\377\360m\240\340\021w\227\32694\304S\203\371\212\322e\307y\357\2173\260\005\363e\351\222\204\033E\237\253\352!%\352\313de\221\317eM\027\366\026\313\266\270ug['Z\216\350(\036\267^/\364\216\326\347\340-\020\332\001G\352\023\320=\374\376\351\263\317\253\3353\365.[\343x\274\177\004\356\353\246>\t\266Mns-0\2078\331\02583jv\001L_\215\226\177/{\210u/\254\2334}\207%rS\366\357c.\257\t\003+\376_x\363^L\266\210\315\242\321B\357\352\375\323\371\202\304\355\233\335\034\340\275\324\323\331\360c\274\307\355\256C]\026\316q\367\244\357Z;\316\3605\374dPC9\271\251\271\217\021C\275q?\347\330r8\276\270\363\003\324\330\211\323?\021,\206\365\341\304\357\207"
+	.string	"d6\370\327\247\\M\335#\245g\026q\336h\252\266\353\245\317\352gm\237\375}"
+	.ascii	"\374xz\310[\013)\036\004u\031q3\031\322\3532w\275\276\204\037"
+	.ascii	"G\350\326N\t\217(\357W\350C\335\275\006\316Y\3706\370=\264\315"
+	.ascii	"\307\177'\250lX\362~Z\261\276\237\221\364<\037|\220\312\233\202"
+	.ascii	"\342\367\226\370v.N\236\361\342\2017X\327\317\3446\235\377>\224"
+	.ascii	"\237\322\377\303Y{\244\303j\367\257&\033d.,\265Q\334\214\376"
+	.ascii	"|\236\360V\b/,~\3608\262\263\337V\336\313x~\261gV\375\333\335"
+	.ascii	"q\307>\320<U\234\372\2728\007\265\376\036\342\235\300\360(\337"
+	.ascii	"?@\036\311\377!\223m\265sF\206l\346;e\272\022\265e\373S\210\035"
+	.ascii	"sh\225\f\325\375\243^\3109\203l^\247\357?\350\017\302\345\320"
+	.ascii	"\235S\f \027\203\267'\365\356\374\003\027o\321\234^\310\031\373"
+	.ascii	"\224\266\337\351\363\262\336m\354\037\201\314\224\201\277\255"
+	.ascii	"\326\377\321\377\347\357+v\230ni\377\361/u\026H\035\260pUr\242"
+	.ascii	"\311\357\020\273\354Y\372%(\311e&\023Aw\337\361\262\354O{c\246"
+	.ascii	"\362\275=vY\316\321\375s\372~{\330*\362!\365\214_K=]\r\376\351"
+	.ascii	"\313\003\301\323\323\017\226\273\225\222!\"\036\351[\241\001"
+	.ascii	"\225\360\255t\246\377"
+	.text
+	.section	.gnu.lto_.symtab.f641a502402869e3,"e",@progbits
+	.string	"GPS_numCh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"GPS_svInfoReceivedCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"gpsData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"gpsPacketLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"GPS_packetCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\003"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"gpsInitNmea"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"gpsInitUblox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"gpsInitHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"gpsNewFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"gpsIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\003"
+	.string	""
+	.string	"_update_checksum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\003"
+	.string	""
+	.string	"GPS_calc_longitude_scaling"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"GPS_scaleLonDown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"GPS_distance_cm_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\003"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\004"
+	.string	""
+	.string	"GPS_calculateDistanceAndDirectionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\004"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\004"
+	.string	""
+	.string	"dTnav"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\004"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\004"
+	.string	""
+	.string	"ubx_nav_status_bits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"ubs_nav_fix_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"ubx_protocol_bytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"pgResetTemplate_gpsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\004"
+	.string	""
+	.string	"gpsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\004"
+	.string	""
+	.string	"gpsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\004"
+	.string	""
+	.string	"nav_takeoff_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\004"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\004"
+	.string	""
+	.string	"nmeaParseControl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\004"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\004"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\004"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\004"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\004"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\004"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\004"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\004"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\004"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\004"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\004"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\004"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\004"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\004"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\005"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\005"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f641a502402869e3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
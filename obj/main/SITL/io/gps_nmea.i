@@ -0,0 +1,1316 @@
+# 0 "./src/main/io/gps_nmea.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/io/gps_nmea.c"
+# 32 "./src/main/io/gps_nmea.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 33 "./src/main/io/gps_nmea.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 34 "./src/main/io/gps_nmea.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      __attribute__ ((__access__ (__read_only__, 1, 3)));
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+    __attribute__ ((__access__ (__read_only__, 1, 2)))
+    __attribute__ ((__access__ (__read_only__, 3, 4)));
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__read_write__, 1, 2)));
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 35 "./src/main/io/gps_nmea.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 21 "./src/main/platform.h"
+       
+# 126 "./src/main/platform.h"
+# 1 "./src/main/target/common_pre.h" 1
+# 21 "./src/main/target/common_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 127 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 23 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 27 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 21 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "./src/main/common/utils.h" 2
+# 105 "./src/main/common/utils.h"
+
+# 105 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+
+
+
+
+
+
+static inline void memcpy_fn ( void * destination, const void * source, size_t num ) { memcpy(destination, source, num); }
+# 29 "./src/main/target/SITL/target.h" 2
+# 145 "./src/main/target/SITL/target.h"
+extern uint32_t SystemCoreClock;
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 218 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+# 128 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_deprecated_post.h" 1
+# 24 "./src/main/target/common_deprecated_post.h"
+       
+# 129 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 23 "./src/main/target/common_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 21 "./src/main/build/version.h"
+       
+# 33 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 26 "./src/main/target/common_post.h" 2
+# 371 "./src/main/target/common_post.h"
+extern uint8_t eepromData[32768];
+# 130 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_defaults_post.h" 1
+# 131 "./src/main/platform.h" 2
+# 37 "./src/main/io/gps_nmea.c" 2
+
+
+
+
+
+# 1 "./src/main/io/gps_nmea.h" 1
+# 21 "./src/main/io/gps_nmea.h"
+       
+
+
+
+
+
+
+
+typedef enum {
+    NMEA_SENTENCE_NONE = 0,
+    NMEA_SENTENCE_GGA,
+    NMEA_SENTENCE_RMC,
+    NMEA_SENTENCE_GSV,
+    NMEA_SENTENCE_VTG,
+    NMEA_SENTENCE_GSA,
+} nmeaSentence_e;
+
+typedef enum {
+    NMEA_TALKER_NONE = 0,
+    NMEA_TALKER_GP,
+    NMEA_TALKER_GN,
+    NMEA_TALKER_GL,
+    NMEA_TALKER_GA,
+} nmeaTalker_e;
+
+typedef enum {
+    NMEA_STATE_IDLE = 0,
+    NMEA_STATE_SENTENCE,
+    NMEA_STATE_CHECKSUM,
+} nmeaState_e;
+
+typedef enum {
+    NMEA_PARSE_PENDING = 0,
+    NMEA_PARSE_OK,
+    NMEA_PARSE_CHECKSUM_ERROR,
+} nmeaParseResult_e;
+
+typedef struct nmeaSatellite_s {
+    uint8_t svid;
+    uint8_t cno;
+} nmeaSatellite_t;
+
+
+typedef struct nmeaData_s {
+    int32_t latitude;
+    int32_t longitude;
+    int32_t altitudeCm;
+    uint32_t time;
+    uint32_t date;
+    uint16_t hdop;
+    uint16_t speed;
+    uint16_t groundCourse;
+    uint8_t numSat;
+    uint8_t fixQuality;
+    uint8_t fixMode;
+    
+# 76 "./src/main/io/gps_nmea.h" 3 4
+   _Bool 
+# 76 "./src/main/io/gps_nmea.h"
+        valid;
+
+    uint8_t svMessageNum;
+    uint8_t svInView;
+    uint8_t svCount;
+    nmeaSatellite_t sv[4];
+} nmeaData_t;
+
+typedef struct nmeaParser_s {
+    nmeaData_t data;
+    nmeaData_t scratch;
+    nmeaSentence_e sentence;
+    nmeaTalker_e talker;
+
+    uint8_t state;
+    uint8_t field;
+    uint8_t fieldIndex;
+    uint8_t fieldGroup;
+    uint8_t checksum;
+    uint8_t receivedChecksum;
+    uint8_t checksumDigits;
+    uint8_t format;
+
+    uint8_t fieldLength;
+    char fieldBuffer[16];
+} nmeaParser_t;
+
+void nmeaParserInit(nmeaParser_t *parser);
+nmeaParseResult_e nmeaParseControl(nmeaParser_t *parser, char c);
+
+
+static inline void nmeaFieldChar(nmeaParser_t *parser, char c)
+{
+    parser->checksum ^= c;
+    if (parser->fieldLength < 16) {
+        parser->fieldBuffer[parser->fieldLength++] = c;
+    }
+}
+# 124 "./src/main/io/gps_nmea.h"
+static inline nmeaParseResult_e nmeaParse(nmeaParser_t *parser, char c)
+{
+    if (c > ',' && parser->state == NMEA_STATE_SENTENCE) {
+        nmeaFieldChar(parser, c);
+        return NMEA_PARSE_PENDING;
+    }
+    return nmeaParseControl(parser, c);
+}
+# 43 "./src/main/io/gps_nmea.c" 2
+
+
+
+
+
+
+
+typedef enum {
+    NMEA_FIELD_SKIP = 0,
+    NMEA_FIELD_TIME,
+    NMEA_FIELD_LATITUDE,
+    NMEA_FIELD_NS,
+    NMEA_FIELD_LONGITUDE,
+    NMEA_FIELD_EW,
+    NMEA_FIELD_FIX_QUALITY,
+    NMEA_FIELD_NUM_SAT,
+    NMEA_FIELD_HDOP,
+    NMEA_FIELD_ALTITUDE,
+    NMEA_FIELD_STATUS,
+    NMEA_FIELD_SPEED_KNOTS,
+    NMEA_FIELD_SPEED_KMH,
+    NMEA_FIELD_COURSE,
+    NMEA_FIELD_DATE,
+    NMEA_FIELD_FIX_MODE,
+    NMEA_FIELD_SV_MESSAGE_NUM,
+    NMEA_FIELD_SV_IN_VIEW,
+    NMEA_FIELD_SV_ID,
+    NMEA_FIELD_SV_CNO,
+} nmeaField_e;
+
+typedef struct nmeaTalkerFormat_s {
+    uint16_t id;
+    nmeaTalker_e talker;
+} nmeaTalkerFormat_t;
+
+typedef struct nmeaSentenceFormat_s {
+    uint32_t id;
+    nmeaSentence_e sentence;
+    uint8_t fieldCount;
+    uint8_t repeatStart;
+    uint8_t repeatLength;
+    const uint8_t *fields;
+} nmeaSentenceFormat_t;
+
+static const nmeaTalkerFormat_t nmeaTalkers[] = {
+    { (((uint16_t)('G') << 8) | ('P')), NMEA_TALKER_GP },
+    { (((uint16_t)('G') << 8) | ('N')), NMEA_TALKER_GN },
+    { (((uint16_t)('G') << 8) | ('L')), NMEA_TALKER_GL },
+    { (((uint16_t)('G') << 8) | ('A')), NMEA_TALKER_GA },
+};
+
+
+static const uint8_t nmeaFieldsGGA[] = {
+    NMEA_FIELD_SKIP, NMEA_FIELD_TIME, NMEA_FIELD_LATITUDE, NMEA_FIELD_NS, NMEA_FIELD_LONGITUDE, NMEA_FIELD_EW,
+    NMEA_FIELD_FIX_QUALITY, NMEA_FIELD_NUM_SAT, NMEA_FIELD_HDOP, NMEA_FIELD_ALTITUDE,
+};
+
+
+static const uint8_t nmeaFieldsRMC[] = {
+    NMEA_FIELD_SKIP, NMEA_FIELD_TIME, NMEA_FIELD_STATUS, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP,
+    NMEA_FIELD_SKIP, NMEA_FIELD_SPEED_KNOTS, NMEA_FIELD_COURSE, NMEA_FIELD_DATE,
+};
+
+
+static const uint8_t nmeaFieldsGSV[] = {
+    NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SV_MESSAGE_NUM, NMEA_FIELD_SV_IN_VIEW,
+    NMEA_FIELD_SV_ID, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SV_CNO,
+};
+
+
+static const uint8_t nmeaFieldsVTG[] = {
+    NMEA_FIELD_SKIP, NMEA_FIELD_COURSE, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP,
+    NMEA_FIELD_SKIP, NMEA_FIELD_SPEED_KMH,
+};
+
+
+static const uint8_t nmeaFieldsGSA[] = {
+    NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_FIX_MODE,
+    NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP,
+    NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP, NMEA_FIELD_SKIP,
+    NMEA_FIELD_SKIP, NMEA_FIELD_HDOP,
+};
+
+static const nmeaSentenceFormat_t nmeaSentences[] = {
+    { (((uint32_t)('G') << 16) | ((uint32_t)('G') << 8) | ('A')), NMEA_SENTENCE_GGA, (sizeof(nmeaFieldsGGA) / sizeof((nmeaFieldsGGA)[0])), 0, 0, nmeaFieldsGGA },
+    { (((uint32_t)('R') << 16) | ((uint32_t)('M') << 8) | ('C')), NMEA_SENTENCE_RMC, (sizeof(nmeaFieldsRMC) / sizeof((nmeaFieldsRMC)[0])), 0, 0, nmeaFieldsRMC },
+    { (((uint32_t)('G') << 16) | ((uint32_t)('S') << 8) | ('V')), NMEA_SENTENCE_GSV, (sizeof(nmeaFieldsGSV) / sizeof((nmeaFieldsGSV)[0])), 4, 4, nmeaFieldsGSV },
+    { (((uint32_t)('V') << 16) | ((uint32_t)('T') << 8) | ('G')), NMEA_SENTENCE_VTG, (sizeof(nmeaFieldsVTG) / sizeof((nmeaFieldsVTG)[0])), 0, 0, nmeaFieldsVTG },
+    { (((uint32_t)('G') << 16) | ((uint32_t)('S') << 8) | ('A')), NMEA_SENTENCE_GSA, (sizeof(nmeaFieldsGSA) / sizeof((nmeaFieldsGSA)[0])), 0, 0, nmeaFieldsGSA },
+};
+
+static const uint32_t powersOf10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
+
+
+typedef struct nmeaNumber_s {
+    uint32_t integer;
+    uint32_t fraction;
+    uint8_t fractionDigits;
+    
+# 141 "./src/main/io/gps_nmea.c" 3 4
+   _Bool 
+# 141 "./src/main/io/gps_nmea.c"
+        negative;
+} nmeaNumber_t;
+
+void nmeaParserInit(nmeaParser_t *parser)
+{
+    memset(parser, 0, sizeof(*parser));
+}
+
+static uint8_t nmeaDigit(char c)
+{
+    return (uint8_t)(c - '0');
+}
+
+
+static void nmeaFieldNumber(const nmeaParser_t *parser, nmeaNumber_t *number, uint8_t maxFractionDigits)
+{
+    const char *c = parser->fieldBuffer;
+    const char *end = c + parser->fieldLength;
+
+    number->negative = c < end && *c == '-';
+    if (number->negative) {
+        c++;
+    }
+
+    uint32_t integer = 0;
+    for (; c < end && nmeaDigit(*c) <= 9; c++) {
+        if (integer < 100000000) {
+            integer = integer * 10 + nmeaDigit(*c);
+        }
+    }
+
+    uint32_t fraction = 0;
+    uint8_t fractionDigits = 0;
+    if (c < end && *c == '.') {
+        for (c++; c < end && nmeaDigit(*c) <= 9 && fractionDigits < maxFractionDigits; c++) {
+            fraction = fraction * 10 + nmeaDigit(*c);
+            fractionDigits++;
+        }
+    }
+
+    number->integer = integer;
+    number->fraction = fraction;
+    number->fractionDigits = fractionDigits;
+}
+
+static uint32_t nmeaFieldInteger(const nmeaParser_t *parser)
+{
+    uint32_t integer = 0;
+    for (unsigned i = 0; i < parser->fieldLength && nmeaDigit(parser->fieldBuffer[i]) <= 9 && integer < 100000000; i++) {
+        integer = integer * 10 + nmeaDigit(parser->fieldBuffer[i]);
+    }
+    return integer;
+}
+
+static char nmeaFieldLetter(const nmeaParser_t *parser)
+{
+    return parser->fieldLength ? parser->fieldBuffer[0] : 0;
+}
+
+
+static int32_t nmeaFieldScaled(const nmeaParser_t *parser, uint8_t decimals)
+{
+    nmeaNumber_t number;
+    nmeaFieldNumber(parser, &number, decimals);
+
+    const uint32_t scaled = number.integer * powersOf10[decimals] + number.fraction * powersOf10[decimals - number.fractionDigits];
+    return number.negative ? -(int32_t)scaled : (int32_t)scaled;
+}
+
+
+static int32_t nmeaFieldCoordinate(const nmeaParser_t *parser)
+{
+    nmeaNumber_t number;
+    nmeaFieldNumber(parser, &number, 7);
+
+    const uint32_t degrees = number.integer / 100;
+    const uint32_t minutes = (number.integer % 100) * powersOf10[7]
+        + number.fraction * powersOf10[7 - number.fractionDigits];
+    return degrees * 10000000 + minutes / 60;
+}
+
+
+static void nmeaIdentify(nmeaParser_t *parser)
+{
+    parser->sentence = NMEA_SENTENCE_NONE;
+    parser->talker = NMEA_TALKER_NONE;
+    parser->format = 0;
+
+    if (parser->fieldLength != 5) {
+
+        return;
+    }
+
+    const char *id = parser->fieldBuffer;
+    const uint16_t talkerId = (((uint16_t)(id[0]) << 8) | (id[1]));
+    const uint32_t formatterId = (((uint32_t)(id[2]) << 16) | ((uint32_t)(id[3]) << 8) | (id[4]));
+
+    for (unsigned i = 0; i < (sizeof(nmeaTalkers) / sizeof((nmeaTalkers)[0])); i++) {
+        if (nmeaTalkers[i].id == talkerId) {
+            parser->talker = nmeaTalkers[i].talker;
+            break;
+        }
+    }
+    if (parser->talker == NMEA_TALKER_NONE) {
+        return;
+    }
+
+    for (unsigned i = 0; i < (sizeof(nmeaSentences) / sizeof((nmeaSentences)[0])); i++) {
+        if (nmeaSentences[i].id == formatterId) {
+            parser->sentence = nmeaSentences[i].sentence;
+            parser->format = i + 1;
+            break;
+        }
+    }
+}
+
+
+static void nmeaFieldEnd(nmeaParser_t *parser)
+{
+    if (parser->field == 0) {
+        nmeaIdentify(parser);
+        return;
+    }
+    if (!parser->format) {
+        return;
+    }
+
+    const nmeaSentenceFormat_t *format = &nmeaSentences[parser->format - 1];
+    const uint8_t fieldType = parser->fieldIndex < format->fieldCount ? format->fields[parser->fieldIndex] : NMEA_FIELD_SKIP;
+    if (fieldType == NMEA_FIELD_SKIP) {
+        return;
+    }
+
+    nmeaData_t *data = &parser->scratch;
+    const uint8_t group = parser->fieldGroup;
+
+    switch (fieldType) {
+    case NMEA_FIELD_TIME:
+        data->time = nmeaFieldScaled(parser, 2);
+        break;
+    case NMEA_FIELD_LATITUDE:
+        data->latitude = nmeaFieldCoordinate(parser);
+        break;
+    case NMEA_FIELD_NS:
+        if (nmeaFieldLetter(parser) == 'S') {
+            data->latitude = -data->latitude;
+        }
+        break;
+    case NMEA_FIELD_LONGITUDE:
+        data->longitude = nmeaFieldCoordinate(parser);
+        break;
+    case NMEA_FIELD_EW:
+        if (nmeaFieldLetter(parser) == 'W') {
+            data->longitude = -data->longitude;
+        }
+        break;
+    case NMEA_FIELD_FIX_QUALITY:
+        data->fixQuality = nmeaFieldInteger(parser);
+        break;
+    case NMEA_FIELD_NUM_SAT:
+        data->numSat = nmeaFieldInteger(parser);
+        break;
+    case NMEA_FIELD_HDOP:
+        data->hdop = nmeaFieldScaled(parser, 2);
+        break;
+    case NMEA_FIELD_ALTITUDE:
+        data->altitudeCm = nmeaFieldScaled(parser, 2);
+        break;
+    case NMEA_FIELD_STATUS:
+        data->valid = nmeaFieldLetter(parser) == 'A';
+        break;
+    case NMEA_FIELD_SPEED_KNOTS:
+
+        data->speed = (uint32_t)nmeaFieldScaled(parser, 2) * 5144 / 10000;
+        break;
+    case NMEA_FIELD_SPEED_KMH:
+
+        data->speed = (uint32_t)nmeaFieldScaled(parser, 2) * 5 / 18;
+        break;
+    case NMEA_FIELD_COURSE:
+        data->groundCourse = nmeaFieldScaled(parser, 1);
+        break;
+    case NMEA_FIELD_DATE:
+        data->date = nmeaFieldInteger(parser);
+        break;
+    case NMEA_FIELD_FIX_MODE:
+        data->fixMode = nmeaFieldInteger(parser);
+        break;
+    case NMEA_FIELD_SV_MESSAGE_NUM:
+        data->svMessageNum = nmeaFieldInteger(parser);
+        data->svCount = 0;
+        break;
+    case NMEA_FIELD_SV_IN_VIEW:
+        data->svInView = nmeaFieldInteger(parser);
+        break;
+    case NMEA_FIELD_SV_ID:
+        if (group < 4) {
+            data->sv[group].svid = nmeaFieldInteger(parser);
+            data->sv[group].cno = 0;
+            data->svCount = group + 1;
+        }
+        break;
+    case NMEA_FIELD_SV_CNO:
+        if (group < 4) {
+            data->sv[group].cno = nmeaFieldInteger(parser);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+
+static void nmeaFieldNext(nmeaParser_t *parser)
+{
+    parser->fieldLength = 0;
+    if (parser->field < 
+# 357 "./src/main/io/gps_nmea.c" 3 4
+                       (255)
+# 357 "./src/main/io/gps_nmea.c"
+                                ) {
+        parser->field++;
+    }
+    if (!parser->format) {
+        return;
+    }
+
+    const nmeaSentenceFormat_t *format = &nmeaSentences[parser->format - 1];
+    if (parser->fieldIndex < 
+# 365 "./src/main/io/gps_nmea.c" 3 4
+                            (255)
+# 365 "./src/main/io/gps_nmea.c"
+                                     ) {
+        parser->fieldIndex++;
+    }
+    if (format->repeatLength && parser->fieldIndex == format->repeatStart + format->repeatLength) {
+        parser->fieldIndex = format->repeatStart;
+        parser->fieldGroup++;
+    }
+}
+
+static int8_t nmeaHexDigit(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+
+
+nmeaParseResult_e nmeaParseControl(nmeaParser_t *parser, char c)
+{
+    if (c == '$') {
+        parser->state = NMEA_STATE_SENTENCE;
+        parser->field = 0;
+        parser->fieldIndex = 0;
+        parser->fieldGroup = 0;
+        parser->fieldLength = 0;
+        parser->format = 0;
+        parser->checksum = 0;
+
+        parser->scratch = parser->data;
+        return NMEA_PARSE_PENDING;
+    }
+
+    switch (parser->state) {
+    case NMEA_STATE_IDLE:
+        break;
+
+    case NMEA_STATE_SENTENCE:
+        if (c == ',') {
+            parser->checksum ^= c;
+            nmeaFieldEnd(parser);
+            nmeaFieldNext(parser);
+        } else if (c == '*') {
+            nmeaFieldEnd(parser);
+            parser->state = NMEA_STATE_CHECKSUM;
+            parser->receivedChecksum = 0;
+            parser->checksumDigits = 0;
+        } else if (c == '\r' || c == '\n') {
+            parser->state = NMEA_STATE_IDLE;
+        } else {
+            nmeaFieldChar(parser, c);
+        }
+        break;
+
+    case NMEA_STATE_CHECKSUM: {
+        const int8_t digit = nmeaHexDigit(c);
+        if (digit < 0) {
+            parser->state = NMEA_STATE_IDLE;
+            return NMEA_PARSE_CHECKSUM_ERROR;
+        }
+        parser->receivedChecksum = (parser->receivedChecksum << 4) | digit;
+        if (++parser->checksumDigits == 2) {
+            parser->state = NMEA_STATE_IDLE;
+            if (parser->receivedChecksum != parser->checksum) {
+                return NMEA_PARSE_CHECKSUM_ERROR;
+            }
+            parser->data = parser->scratch;
+            return NMEA_PARSE_OK;
+        }
+        break;
+    }
+    }
+
+    return NMEA_PARSE_PENDING;
+}
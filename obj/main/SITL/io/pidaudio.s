@@ -0,0 +1,487 @@
+	.file	"pidaudio.c"
+	.section	.gnu.lto_.profile.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375 s\225\002"
+	.string	"\344\003g"
+	.string	"\t"
+	.string	"\266\317\357\244\017\n\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\367\227\233\370\005\003\262\374\202\245\005"
+	.string	"\004\005\006\354\206\342\366\006\002\007\256\330\276\211\r\b\316\211\235\213\003\006\002\003\t\352\263\360\321\b"
+	.string	"\007"
+	.ascii	"\271=.]\262Z\006\360\2452(;\2766\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375 =e\001"
+	.string	"\3401"
+	.string	"\007"
+	.string	""
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\005\006"
+	.string	"\003\007\001\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"7\003\377<\002vQ\254\001Co"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"E\004"
+	.string	"\362\306\026!\240'\351\340\377\372\217\255/\336K|j!Y\235M\210\rp@\340"
+	.string	"|#g^|\322\032\331r\247\277\375\203C\334$\262\2000\017\031\017\207\204\031\220\016\244\263(\350?`\211\266\212\347\233:\364\335,\373\005\264o\226\362\023\022\247\303\266]^\261\321\266\300\277\207\253\255\341\323\246\002\021"
+	.string	")\016I3"
+	.ascii	"\200\006\004\347(y\003\206(\206` \b\310\016\200\230\246\3206"
+	.ascii	"\006\376'\004I\323\335\256\006\205\251\360\n0\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"5\003"
+	.string	"2E\020\033\300%\215\001\203\327EC\207\370\377\373\354\377\301\027\004\203\304\033 {\023)eJ\001\352\207Jy0\252,\256\216=\321\241\022\352\251\346\207\272\360\204\215\261di\r\243Tpy>\344\207V\200J<\020\r"
+	.ascii	"QI\031\027\006l\302\227\230F\023\307@\201\201\252\016\320\234"
+	.ascii	"\253y\231\315m5\233\024S\337\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\003\230\004\004\230\004\005\230\004\006\204\004\007"
+	.ascii	"\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375 \204=\002"
+	.string	"\204\002x"
+	.string	"\007"
+	.string	"\002\002\004"
+	.string	"\001\002\004\001"
+	.string	"\002\006"
+	.string	"\001\002\007\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006\001\007"
+	.string	"\b\b"
+	.string	"\001\002\b\001"
+	.string	""
+	.string	"\r"
+	.ascii	"-\274f\216\273i\001\034\342llE\267\022\030 \r\220\006\250\005"
+	.ascii	"\001@h\033h\003"
+	.text
+	.section	.gnu.lto_.lto.be59722de4b8acde,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidAudioInit.24.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375 \315u\005"
+	.string	"\"J%+\200k:\300Tpl&\222E\r\361P\273R\275)D\274#!\016\232\327\205k\375A\372\031\200\251\300\033\243\267\032 D\233\225[\246\277\252J1\207\205\321lV:\027\324R\314Kc\314\252\360\232%\264\331\250U\233\223\330\313\240\024\216\022\356\316\362\207D\344z\2474c\307\334/r\222/\377\002\232\301\237\247\016\365\351\256\214D=J\234\314\377\235\276\375 \302d\340\241lB\335=\031\263\333\312\355\273\341\n\274\217[\031@t\367\245\367Y\366\274\377\r\377\017\377\037\001\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioStart.25.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375 \315\225\005"
+	.string	"\"J&/`e\323\001@+\260v\203A\004\031L.\b$v\031\344\224\031\366'\274\002\020\335YU<\244BQ\314\020(\265j\356OL7\220$\312-S\307\254J3\311\225QmV:\037\364rLl\203L+\361\2525\266\031\251u\233\225\330\313!E\032-\354\235\345O\251\310\375n\030\215\036w\277\330I\336\374\033h\016\177.p\016\241\356L"
+	.string	"@\217\224\310\363\177\253s\277\tq!\2240\240SwO\356,\267\222\373\356g\007\037\330\255\0240\272\373\362\0035{\336\377\212\377\213\377\223\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioStop.26.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375 \315\225\005"
+	.string	"\"J&/`e\323\001@cX\030\007\217\200\350\320\037\"\244&\f\300\223\031\366'\274\002\020\335YU<\244BQ\314\020(\265j\356OL7\220$\312-S\307\254J3\311\225QmV:\037\364rLl\203L+\361\2525\266\031\251u\233\225\330\313!%\032-\354\235\345O\251\310\375n\b\215\036w\277\330I\336\374\033h\016\177.\230\016\245\356L"
+	.string	"@\217\024\250\363\177\253s?\tq!\2140\237SwO\346,\267\222\373\256g\007\037\330\255\0240\272\373\362\0035{\336\377\212\377\213\377\223\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioGetMode.27.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375 \357\215\006"
+	.string	"\222\314-2pM\322\001\260\006\200\325?@\3331\312 \350\202M\255\002\314X\252m\315n;['\242\323\244\203\266\374\257^\377B\027X\362{V\305\027K6\2212\245\276P\317a\",\030\227i\3175\007gih\227\352\241Q\006~\031\206\252A\274W5)\356\325\223:ut\302~\310#\3649,\241\311[g\276&:K\r\300\350\344\307\216\234\324\f\373\320\252\307v:U`\244\300d\267\342\263\262(\254\244\303\366\306\226|\217\177l\f\241\270q-\250P\210\244\354\3066\235 :\203>\020\235\251\306\341\023\372\007\371\001\311\211uq\236"
+	.string	"\n\273\353\264.\213[o\033\301v\202\355\213\b"
+	.ascii	"2\003\316:#e\b\3055Q5\002_!\262pW:\355$\003"
+	.text
+	.section	.gnu.lto_pidAudioSetMode.28.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"]\007"
+	.string	"\262\21644`o\032\003\027\022\302\016\001\231h\243\226d\347\020\336\004\004W[\221\316L#\253\203\313nO\036\342C\311J2`\022q\205\302\333\364\243YK\232l\271\245L)\237k\202\252z8\023\273$:\027\026\222\023\223\017X\007$=\031\204\344\030t\206>\231\214\2303\223\033\356\256\016Ou\310H\225 E\037\254O\2142\252A:!z\336\034k\221\345\0309RF6J\257k9\322\203\036\255\253\377/<\265F\331\257b\320 \350\376\213\016\346\251\330\022\262i\353\327\232\304%\232Q\243j\376\216\025\226\237[h\002\200\343\201\007,\307\312\002\226c\265\326\245\240\" \306B\345\345\277\204\037\326\374\264\332&\326l&\222_\246\341\177\337f\302p\241\333\"\264Uh+\022\b"
+	.ascii	"2\241u/pq\241\020\f\271\004K\254\246\204;\274h'\031"
+	.text
+	.section	.gnu.lto_pidAudioUpdate.29.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375`\375\001\035\021"
+	.string	"\006^lH"
+	.string	"\257(\035"
+	.string	"\210U\241\277\257CXQ!\342\241\231op>\3262h\004\255~_\343\242D\237B\235[\277|\370\266\337NU\221i\007\r\356==\374\327]\372\\\025:\205\355\343j\263\342\006\353z\307'\204\020\"eJ\001Y"
+	.string	"V"
+	.string	"S"
+	.string	"\250{\300\317\353\270U\224\2771\246\356\271\252\345\240\207\027\354\264\033X\361j\321\217\302=\362\003f\264F\226w/\377\017+\235\022#\3139\320\030\201\343\230s~F\226.' \347\345\005hL\341\024\304n&\234vU\031W\252\337\307\234\323\332\032%\334\033\267\355b\233\201\255\b\002\266\230\313\213kY\220s\245\006\215\211\323\241\330\360\331o\337\017\361\362\3442\276\t\025'\366A\234\264?F\271\214\327\206\306\366\316F\261?\357\3644\177\354\321"
+	.string	"\365\331\211#E\316\025\017X\213\231mNr\301;'"
+	.ascii	"\337\031e\3038\t3_\252\244\210\260\3159\303\305\3605\334\312"
+	.ascii	"\374\223\007n\001\227\216\332\310\310\261\260+\003\367\373\240"
+	.ascii	"t\301\322\035\3733\037q\36238D\324\267D\357\335\367\033gn0\225"
+	.ascii	"\326\360\247\007N\342\331%&\372\026\270\247\335\303\241C\315"
+	.ascii	"\255\306\332\224M\256te\366\271\271\027\354\317n\360j\275\372"
+	.ascii	"\001@\001#S\310\344\300d$\002Z\324!\222@JB \244\221P$\205\"\244"
+	.ascii	"PH(*\221\204\035\004,\216\214J\241I\024K\341\207T\375C\265+\217"
+	.ascii	"E\273\251\n\340\312|\022\327\023\272;\246\210\371VF\023\343\212"
+	.ascii	"\021\243y\344\210|w\203\323\001P\277$A\320\267\374\362\235\206"
+	.ascii	"\327\255\266\332\324avj\001/ P\002!\223\260\035\222\200`\370"
+	.ascii	"\315\260\225@\231\367M@\330\325\035lK\033\250j\002\203\013\347"
+	.ascii	"\232[pw\347\363\206\327C}\016\0342]e\243\325\276\027|\0304\345"
+	.ascii	"\230\344\023\303&\205H|\267\272[\364\232`;l\320~\"8\217\035\n"
+	.ascii	"[$\rj,c\341#\203\340\202\033\314\247\334t>\326 3\236\356\271"
+	.ascii	"\274\fq\016_\227z\355\204\002"
+	.text
+	.section	.gnu.lto_pidAudioUpdate.part.0.39.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375`\316\b\335'"
+	.string	"\232E\320\016G\220XN:\301\365t\245>\376\020\356\005\341L\342g\314\032\036\033\207\236\322\246\202\240CC\271\243\243?\253\376\217M\301Y\034\231\024<I\023\312\214k\025H^"
+	.string	":\240\316\364\256\023\n\352)9\2761\333\226\020\"wJ\001\327"
+	.string	"\315"
+	.string	"\322"
+	.ascii	"b\265V\n\024lL\314\351\305\022\346\t\271*\325T\330\243"
+	.string	"<\275X\202\002\247h1\250\025\201\236\344\335\247<9\236\247\004\263\277\345\344O\232\276\304\207b\326\344\177\235\211\275\263\211/\361\216\205\355L\230\364\267\234|%\367\362.\t\022\024Lr\264 \323\345\007\020\234\316u\302S\\'h\005\222k\222#\213\214\003z\362I\274;\351\007\020\236\216\004\005\017\310U_<\250Z;\242\246V.\241\223N@O\336\210m\247)?\331n\347\302\252\367\222J\361\245\246\326\332;\271;\376\364\\I\216;\351\223\237#\002>7\211T4^\262}Z\265!\323>\255\300\306\217},R#\013\221j\3067J\030,sj\2558T\303q\356\234\346\210j\255>T\325\255\273m)\333\031l\332%~\226\177!\346\211!\312\223\337{}\216\225iUA\315\270\271W^\372\261\256\016[7\035t\300\200n\032H7]\340k\367\017\235&\360\266\333\207N\367\320i\036:\275C\247u\350t\316"
+	.string	"\335\264"
+	.string	"\335t\200\243\335"
+	.ascii	"\350\364\356\\n\034:\255{\327Mu\3239\335ty\261\233\244\323\343"
+	.ascii	"\313\356\245\32337}\004:\022\316j}\021\347\246\342 \245\374\270"
+	.ascii	"\222\277\353\027\373\313~*?\332\317\345\327\362\257\375m\177"
+	.ascii	"\230\357\354"
+	.string	"\373^\016\306\027s\267\266(\027av8Qc[\373\362%\f\203\032\226g\361\267\274\013\227'Z~\210]IC;;\333\272@\257@\271\024\237\354f\336\225eUqQ*\350\304\002\245\342T\247\230\214'\314\251\302\253\036\001\333\340K\2678\033\024\326\302\305\307\rM\026\276\243\301\222\322\355\273|\334\332\222\205\315\357u\034&m\306\334\322\235d=S\350\025\366\355&+\205^\256\275\201\303<1\267c\255Z\240\311-\327\250FY\n\270q\311\375\330y\324\206i\305\263\361\216\260V(\004\273\343\016\235\031\276\005g\234\347\356\006}\r\325\330\035f\224\213\207\303\252\265F\260\315`\n}?\263Vk\235p\322\023j\006\217\374\254\223\376\220\224T\236\234{\263\217[]gk\222\034\315\3134-\300\371\306\373\357^\331q\236u\341\300\332\370n&\033\034H\200T\034UA\032_\215\335\350\017\242DC\261\352\224'\261\006\177"
+	.string	"\371\233\305\230\325\n\374\r\373fl;MbU\300\213\232p\366\311\274\f\210\033\214D4\025!\375\226\350\206#\337\364\340\233F\"\232\212\220~K\271\244\021JLc\022\323\021S\221\211\244\021\324\037\032(\375\220\232\216\220~K=\245_o\304\357HD\357\003\211\022\275\006@VZJ\"\321cRR\"\321\233'\202\332`n\257|\266\217Z^H\003\243\326p\034\240\303\"\342c\3512\r\2112y?Q\036X)\373g\006\255]\244a\236h\236p\201>\260A\013l\214I\001g\346&\032K\2405P"
+	.string	"\350g\013\254\221U\032\002\373\263g\363Y\002[!l\370\026\254c\317\372l\2023C!<\253\263=;\0246\274\261\263<;\204F\303\305\375\232\341\233nd\354\354~\361\310Y\235U\320\026\303\305\251\266\006\3037\321\250r\366n\037\255\004\361\002\327\204\006)`\007\314\025\237*.\364"
+	.string	"\002"
+	.string	"l\2005\262j\262["
+	.string	"\3734\234\335\005\200\254\250aL\246\224R4#\"I\n\n\222\306\360\002\221)\342\034\022`59L\033\207f(\230 \n\212\213K\3526A\034\241\365:QI\322\246J\bA\200\375\216z\023\301I\256 \244\211\002\016\306*\201C\204\300zJ;\n&\032\350o`\250\336\301\346\0136^g\261\350\207\271\263\016j\336\022AD \"U\325\323\031p\350\"9K\342\313\237?\250\326F{h\202\326z$CT\342\367&?O!\260.\346\224I\210:\264P\241E\002v\355\036\246\t0\254\260\027dB\020\370\214\367\027\371\357\205\351~\033!\237F%\177\274s\023H\342\bD\030\370!\331\340"
+	.ascii	"\343Lq\221\006\211\2304u\027n\231~\204\377C\202\376o\320\333"
+	.ascii	"\242\220Si\300Z\336;\233I\267\"8\356\"V\206x\"\276\246?\334\353"
+	.ascii	"\210\254\343\202\017E\n\210\307xG<\340@\261h\255\240\f\357\213"
+	.ascii	"e\322\002\267hP&\265%\372\354w\215fR\302\352\3700V\261w\t\203"
+	.ascii	"\260ed\210\252\001\330\037\353l|\254\f/\240\315\377\301\032F"
+	.ascii	"\033p\344gQ\244\2021\260\027.0\352\305\210R-5\225\007\214\340"
+	.ascii	"`\353\214n\224\361\f\225\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"\205\006"
+	.string	"b\311#,pU\323\001\216o!\375"
+	.string	"\205\204\236>p)\004\020\036\021\310\377\377\377\377\377;\341\361Y$6\3532h\0326\021\221(\223\275\345\226)\177,\0323\235\215\344\320jXA\253\240\352\004\200\203\241,\250\232\333\311\355TN\273Od\201\252\321\367\n\245\257\306\215\2149\2147\0033\n\334iw\377["
+	.string	"\201\037zas\300\013\001+,NT\214\240\370\020\275\256L\254E\3111\367\327\257\243l\376\347\332\363>\312\317\377%\242\262\273;\300\220\370_5\001\033"
+	.ascii	".#\201\202[\204l\255\324\300\022\330\027,qY\335\263\206\001\352"
+	.ascii	"\001\300\001\300\001\300\341\003\344\363K\225F0<\277\221\031"
+	.ascii	"\034\240\035\370\034\370\034\370\276\223\260p\243\b\001i\352"
+	.ascii	"\310&\230e"
+	.text
+	.section	.gnu.lto_.refs.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"\002\f"
+	.string	""
+	.string	"\002\024"
+	.string	""
+	.string	"\002\026"
+	.string	"\001\006"
+	.string	"\001\001"
+	.string	"\001\007\001\001\001"
+	.string	"\003\b"
+	.string	"\t\002"
+	.string	"\001\t\007"
+	.string	""
+	.string	"\t\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.be59722de4b8acde,"e",@progbits
+	.string	"(\265/\375`t\0135="
+	.string	"\212j\214\027DP\236N\007wL\304\273\256g\376\237y\371\3741.j\207\221\035g|\251\032\304\030~\342\333=\204A\001x!\374\300\006\250\274\251A"
+	.string	"@\f\b\261H\354\005\020\2023\023/\240\201\325\347\032]\351\256\335dJ\001B\001Y\001l\001YI\337\r;\254\266T\006\343d\\\214\217\3610\376\272\235\317\265\323\371\227V\337\177\347\026\271\270\267.T\334\215K\225&/='\344$\372\034\\S\326\376\277/t\273\026\267\363\272\236Cp\343\337\316lH\254\313/O\341\377'E"
+	.ascii	"\022<K\223\007\244\366Sv\327\221\326\243\t\271#\344V\312\r!\367"
+	.ascii	"\203\334Dn\264\022\247\216\264np\243\325\2574\265c1Z\237\321"
+	.ascii	"\367\207\210tc\266\360`\025K\273\275\315\335\034\216\330v\271"
+	.ascii	"\037\367\377\026\365\300\335Iib\325\2478\025\177\035\256\333"
+	.ascii	"\255\370[\253o\356K\377\337 bs\354\314\034V\0318\322\252\272"
+	.ascii	"\321\332^\245\205\366>C\343\334\256\264\016\271\322\332\257#"
+	.ascii	"\255\331\215\326n\037j\320\355>\f\272\273\256\273\313\244x\353"
+	.ascii	"\366\005\036\224\324\355e\216\274@\202\241n'\263\227\307\021"
+	.ascii	"\020\016\240\363\346\210\360\357\200\332\355l\272\335@\267\017"
+	.ascii	"\350\366\243n\027\320\355D\335\236\273\275\273\033\260\273\r"
+	.ascii	"\273\333Nw\323\351n\302\356\036\354n\301\356~\323\335\201\335"
+	.ascii	"\235\327\335%\272\373\256\273\325t\367^wOIt7\\w\027\350n\274"
+	.ascii	"\356\316\207\207\207\207\335.\326\215\025t\347%\001=\357?\265"
+	.ascii	"\200V\357qW\352\016r\242;xb\017\b\374\037;\"'3\231k\232a\265"
+	.ascii	"\273\031|C\371g\026\375\373\317V\232\306l\257\354A\213\336\377"
+	.ascii	"A\340\245@\276}\323\240\252\373\370\337\367w\246Ac\264\257\373"
+	.ascii	"l_\227I\364N\227\371\377B\211\332\270&\323[i\032\264\225\272"
+	.ascii	"\320\242w>\363\245\315\037\331\351B[3.\224\250\2256\241\2553"
+	.ascii	"\rZ\264\343H\020\267\033F\366\212\270`\353\374/\257\263\346\223"
+	.ascii	"h\332\276\356\367\375{\334\326?\035\374\237\271\317\276&\017"
+	.ascii	"\247\323\232~iqi\272\376\376\177\001/-5\367\235\323\226\315\375"
+	.ascii	"g\323\242z/\f\314w\372E|\312\004r\366][\377\006\376\375\367\372"
+	.ascii	"g\372O\377\237\371\377>\317\263\367\277\214\250]\363\362\372"
+	.ascii	"\217&y\375\031\363\313\326?\216\373\243\203\266R5\267\351\013"
+	.ascii	"\026\351\332s\275L_\373\276\264g\2262\255|\327\377\373`^\203"
+	.ascii	"\352\210\223\306\325\374\270epM\254\266s\3454\276\007$\227\027"
+	.ascii	"F\tV{\006\032=\237\2661jqXu=\354y>m\327\3633"
+	.string	"m!C\0039\337\355\377u=\365\277\351\336@\310\275A\217\030$M\270U\355\030f\360T\271!szXm\307\353\366,\036\347w\330%\360#\247\t\363\305j\231\217\206dM\020\020\316\032(8p\340g\222K\ft++\\\321\314\322\2720X\343gO[\335\313\003\177\365\250\315\t\234\303*\316\201\273\374M\200\275\210\314\267\241 \303(\206w\260\332D\261\334\236`\365CO\2606q+\343&n\342\326\337\036\314\325\364x8Q\002\340$\023D\303\\\215[1>K\374\230H\260\212\267\210.\22692\254b\033\001\312\206\350\220\303*v\346;Z\252\244\301*\326\362\301\313S\363\321b\324\035_\332\316L3\376\027\277\353\371\373`N^\276\342\024b:<x\3340\023\275V\240!\234\026\204tA\260\033\002\030\"\0077\210\325&t\276\356\376\311|]o>\336:u\334\316\317\206\272:p\262X{\370\332q\276"
+	.ascii	"Rt\330\261Y\243C'P%\344\201\366F-\023\022\022"
+	.string	"\377\321\364\326z\240\\S\314v\344\301\036t@\217>1\360\016\277y\361\313\322\346n\027|]\320\361\324\267g\006\220\013\334b+\374\217J\370)c\307\f\177no\343\376\346\3657\3167\342\003\034;8\377|%\264\017f\242;\337\352\347\201~\016\270\376\373\353\202=?\372Tjg\343}\355\177\257\3779`f\3763\337\007s\270\034_q\n?\032UR\343\374\021!t\003\364\357\366\377\bz\366\330\222l\331\222\333\331r\343\356\365\233\317\377\017\013\313\242\205\013K\3441+7\325\222UQJ\311$\365\002\304\n\250\024\0368\024A|0A\242\350\001E1\n\252\210\225B\262UG\026\353\230,\301.\217T,\330\245Q\311\"Y\021\004L@]e-\331(\240\246Zb\302R\2622\216\312\251\003\313\242\323\022y\314\362a\221\311\0245\214U'\260\250\226F+&d\322\312*)e\200\205\2014\242`\253\214RX"
+	.ascii	"\246\330*\027F$\210\250%+b\350*\271\214Z*\215\313\250\240\345"
+	.ascii	"\021\t5u\274\362\001\352\002B\025\226\226J\343\325\022\2734N"
+	.ascii	"]\251@j\251\243\222E\2620rc\320@A\203\023\r\237vz\252\360Tam"
+	.ascii	"\247\247\246\246'\rM\27154\021\331\342\024\024\215\244\013\037"
+	.ascii	"\266\210\305N%I\fU%\223\035\212=\313\246ZZR\3018V\275H^\261J"
+	.ascii	"\246e2\251d\n`\225\025E\304*\032\227\306\017XG\032\034\246\216"
+	.ascii	"WA'\034\312?x\b\357\246&\017\fT\224\020\221\245\226\222\307\251"
+	.ascii	",\343\324\361\212)y"
+	.string	"dB\036\215VLRJ,\246\245\244\264\247P\341\235\232\033?p\353fba@\224\260\217\376q\276\257\364(\372\344\013\253\255\216\345n\214\206\313\202\004\245\3149\322\203\017@\324HX\2333@-dD\324\260\032\215\342\262 g>\204\370\204\340\310A\326\270\314\365\206\264\232\034\351\342k\202\240\264QC\36676FE\210\213\335\222\2663bbI2\227\264\016\356JX\230\0036\321\031\200\352\250\221Dg\2144\"3\"\"I\222d8\240\002\221!\253n\021p%\304L\233$\313\032\221\004HL\350\024\332\241@\377h/l\376I\263\332\275\326\344!Zqb\376N\267\003\223\356u\272BG\305\036\246\272\0372L\220\265KJ\006\305\222t\026@Rwu\274x\332\324S\3029\026\226~P\211\nm\212\037\223;^Bu<\345\216\345Z\240\250\323\b$\022\250\240\021\034\233kPUt4\233\027\037\2018\272\245\241"
+	.string	"\016\336\303YtF\234$\035\252\275\274c\362\367\bt4\026CC\020\256\3213\311\325m\223\3148\b\003\363j\016\002D\233\254\227\226:(\001\232\350_\366\360\"\004\264\b8\266BY\354\363\212\"\306\307\024\325\344\224-K\266\333\214l\013\3243\3350\373\314}\253\234\006\021gh7A\306\2421\335G\351\317\201\200\236'\032L\316\237\024\374\277]\337{\351\205\\\017\243\377r\272\275r\225XF\364\034\266x\261\227\244\321I\022\215\024\233\f\202'\227\232\323\213l\244p\022\227Iq\n\330\214\336' \325\222\243M\200\034u\242Zel\356T\fn\2154!\325\007V\232\006\336O\372%\347\351\317Ak|\354\371\341#6x\224\337"
+	.ascii	"C\200\334J\345\305E\007\324\341\235\303}\340\234\375\035\271"
+	.ascii	"\200>\371\214\374|o\234\24540\326\222l\017b\\\325\034\037rZ;"
+	.ascii	"\323\342\225\322S\353M\357\254n\001\360\377\373B\226\307a\342"
+	.ascii	"g\032\034\220\373\310M\350}\006\206+\366\353\365\346\346x\233"
+	.ascii	"'\246%\302z\203e?r\026~\033\360\177|\232\364]\334\346\210m\317"
+	.ascii	"\226\217q\350~Ze\360\376\007"
+	.text
+	.section	.gnu.lto_.symtab.be59722de4b8acde,"e",@progbits
+	.string	"pidAudioInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"pidAudioStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"pidAudioStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"pidAudioGetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"pidAudioSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"pidAudioUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"audioPlayTone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"audioSetupIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"audioGenerateWhiteNoise"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"audioSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.be59722de4b8acde,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,430 @@
+	.file	"piniobox.c"
+	.section	.gnu.lto_.profile.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375 =\275\001"
+	.string	"\344\0021"
+	.string	"\004"
+	.string	"\367\344\223\371\001\006\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002"
+	.string	"\002\003\001\240\342\234\212\n\002\331\277\377\371\017\003\371\237\363\375\r\002\002"
+	.string	"\002\003"
+	.string	"\002"
+	.ascii	"\240)\336\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375 -\035\001"
+	.string	"\270!"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\001\001"
+	.string	"\002\001\001\003"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"7\003\247\004V\tg\003X"
+	.text
+	.section	.gnu.lto_.inline.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375 \254\235\003"
+	.string	"\344\005\240"
+	.string	"\003"
+	.string	""
+	.string	"\020\332\314\231\353\002i\001"
+	.string	""
+	.string	"\002\023\303\231\263\266\002h"
+	.string	""
+	.string	"\007\367\377\377\377\003d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f\001"
+	.string	""
+	.string	"\001\220N"
+	.string	"\002"
+	.string	"\020\314\277\331\273\016\357\377\377\337\003g"
+	.string	""
+	.string	"\006\200\200\200\200\002\002\220N"
+	.string	"\220N\003"
+	.string	"\022\322\201\351\206\022\311\307\252\350"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\007"
+	.ascii	"[\035\032P\r\260\341j+\300\251\005\325\330\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375 \230u\002"
+	.string	"\302\304\r\027\260%\351\034\246\020\315\0040\254 \032\f\303\034E\315F\276\361&2\245n|\261N\247\224\207\032)\031\260)7\265}\217\022\336\001\321\364\347\201\3518\235uO\362\022\211\007"
+	.string	"[M\340\024,\204\022XV\007\3374G\234\333m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\231\004\002\230\004\003\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375 K\225\001"
+	.string	"\004\002?"
+	.string	"\003"
+	.string	"\001\024"
+	.string	""
+	.string	""
+	.string	"\002\002\006"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\177\002\007\002\b\001\001\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\006"
+	.ascii	"19\201Y\243g\214\227 PB\335@\033"
+	.text
+	.section	.gnu.lto_.lto.563e7674fa5968e3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioBoxInit.24.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375`R\002m\024"
+	.string	"v\246\207I\260TN:X\3235]\213oaB\200\317<\302 \324W@O^F\237=#\320\027\274\360\200x\203\030\216\266\375\372g\245\215\212x\367\2706\314\301\306\316\016\004\355K\207\332\213\303\346K\225\366\036\016\273\247\2735B\266\224)\005q"
+	.string	"m"
+	.string	"x"
+	.string	"\274\006f\360zh\336\t\210\017_?\021\037\332fk\031\340\221]\3718\025\231s\316\266\205\345%\357\026\325v\227\030\312U\233\337tU\361\323\355v\356\2222\240\322\220\311\316G:\020\202\002\336\207S1)\350al\227\342R\236\bA\001Mv<R\005\2504\364\337\365g\227\323\275\357Zu\245\333\005]].sN\253n\207\342~\3356\220m\t\266\222\b6oG\267\b\250$$\345-\262e\241:\366\247\033v\246\337\025\252\345{\367J\265\256\372"
+	.ascii	"\002\364\024\370\315y\"\210db\205SH\177\372{\366\235\374\337"
+	.ascii	"S\216\013\256\004\006\253![s\362\"\274\316\363}.yh\323x\r\333"
+	.ascii	"{\246\222\323\206\205%![s\316\224\207\206\360z\210\"_b\373j\177"
+	.ascii	"\3513lg\322\271\2009\213~H\315\031\326p\036\033\020\034\3159"
+	.ascii	"Yv|\212\203;\274\350u/\342C\025\027+n\032\224a\314u\314\370Q"
+	.ascii	"!d\036\304\026\306t\323\340\225\310\n\250I\256\221sD\330\206"
+	.ascii	"=\031\275\254\234\032\261Lum\032\b\275\016\266(\271\335\361W"
+	.ascii	"w\201\370$\261k\3171\363\250\2439s-\366x\034\"^s\346Xn\324\334"
+	.ascii	"L\b\362\342\241\257\263\377=\001\013\0301\246n\032\\!(`\322\256"
+	.ascii	"Q\265\021fi\377@\363@3V\250\215\024L\034\263R\033aF\032\r\255"
+	.ascii	"f6\322f4\264\227\231Y\214\315\315l\345\200\307\032\031\233\331"
+	.ascii	"\210q\264\231\225\360\346\267\250\351\027\210`\335\026\347Z#"
+	.ascii	"\273|\204\262\335,M\371\356\217\274\251\304\335\373>\340\b\222"
+	.ascii	"\3129\347\024\327\310\272\017\036G\374\357\031Lh\311\330\312"
+	.ascii	"\375\261U\276+\333\373\276\240\352\252\207\b\247A\313\355\201"
+	.ascii	"\243\240\305\001, 0\002\202\030\274\033\177\362\004\001\273c"
+	.ascii	"\304w\360]\332\005\203=\321\315\204\304\332,\023\367\3057\204"
+	.ascii	"~q:3\353.\n\233\310\f\337\212\234\347\376\254\363\203\360\001"
+	.ascii	"\250G\350>\250\026N\267(HPs\234\302\220\244\305\216s\013\336"
+	.ascii	"\202\330'\227\213\335\372\351\256\201\210\375n\363\266\002\b"
+	.ascii	"\213\207\b\356P\305\340Gp\277\224\037\336\350\264\217\f"
+	.text
+	.section	.gnu.lto_pinioBoxUpdate.25.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375`\262\001\225\020"
+	.string	"\326\237oE\360\320&\035;>W\212sL7\303\202\321\017n)\2431\260\256\257\305\t.I\264\350\026f8\304[\227F#Z\016\220\370\363E\344u*\217\235MdLH\373)\3044\336\253\344!e\372\231\351-!{K\231R_"
+	.string	"W"
+	.string	"\\"
+	.ascii	"){\306\201\025\016\033\253\234\032\273\273)\n\303\303\327\235"
+	.ascii	"e\352Z\026\241f\312\267\271\002\027!\326\247\272\0069`3$:\276"
+	.ascii	"\025|\320\352\201\261|)\231\005\220iy\024q\bM1\206V\035\337\n"
+	.ascii	"L\340z1*}*\251\307y\006\025\261\276\226\247&aw\235\254/\304M"
+	.ascii	"\272m\020\266!\330\027\n/U\252\0136\323\362\261\272\354\322o"
+	.ascii	"\356\030\323\020\246U\323\231\351s8Xa@h\367C\354\306\016\305"
+	.ascii	"\037\025\277\271\375\227\217sc \270<\023h\216h\354\256\307\243"
+	.ascii	"CH\217/\331~\332\2479\213\324k:\030\300\356\211\032\237\335W"
+	.ascii	"\0033 =\232^ {\204'\220=:\026D\362,\233VTeU\250\227\261:\352"
+	.ascii	"\310T\373\204!\317R5\251\250\312\327T\317egut\236\022\255\027"
+	.ascii	"\030;\227]\275\026D*i\343\344;\334G\314\356F\2603\\\207dA\314"
+	.ascii	"\356\206\270xN\347\247x\264\006T\236\365\350\243\262\307\353"
+	.ascii	"\013\033\243\037\224\214i\253\007&\243\nc\007\334Q\025N$\034"
+	.ascii	"\205\223\222\223\347m\030\021\340\021\020\016\335\205\216+\341"
+	.ascii	"L\266\216\333J8\021\222m\304Cm \b\334\231\234\274\355\244\353"
+	.ascii	"\274\255\364\332\253\313\346$\235\021C(\232\242)\2145\030\261"
+	.ascii	"\244J\224\036\217\312\002o\240,\352k\016ww\263\217G-\251\026"
+	.ascii	"T\344\301DJ\3062\016H\250Q\355! P\202A*\351\006\342\200\3371"
+	.ascii	"n6\316\004\355\322\256\361\276\257\"T\324\030K\f\345\306\003"
+	.ascii	"Z\f\0022\261\270\004Ur\210\214\002c(6\320MnFW\034@\243x\254\342"
+	.ascii	"\006\fj\304\270\302\233e\260\210\3540jD&\336\342\276\021u;\027"
+	.ascii	"%\003"
+	.text
+	.section	.gnu.lto_pinioBoxTaskControl.26.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375`\377\001\345\022"
+	.string	"ve\202H\320\360(\035B2\277L\"\003@\226\215\310\230\365s\013he\341\004c\2613\340T\311\"\307N\fE\324cRw\374\365\264\262\356\224\204/\324\212\310-:\204+1 \366W\222\024\313\237{4I\n~\r\263\233l)S\np"
+	.string	"h"
+	.string	"m"
+	.ascii	"\b8\376\031f\307x\3103\017\204\201\026\3044\347\\m\007\307\307"
+	.ascii	"\360\226\n\373I~q\025\346\353\256 \021\220\222\020\030\373)\246"
+	.ascii	"\222H\340t\200\2648b\033J\222\001e*E\330\374\213$:\023\036v\307"
+	.ascii	"[\201\002i\032\243\352\005\022\255\003\214\211\005n"
+	.string	":5P\340L\367\273k\321\220LI\b\264\271\236\032\3149\25550\303\315q\3337\266\023\330z k\033J\032\261\213\263\303\230\356MF\211\0263\336\233\235\372\317-\237\273\277\250\216W\357\252U\325\357H5\345l\330\241Y\245p\326\364\232&\322g\024\342?\177\356j\337~\217\277\273\317C\330\177|\244\232\205\023$\261\205s\204\343\237\352\003\344\277x\017\371\357\327\031e\021\005\260\347^T\261p\326\210\3340\345\230\346\f?\3769q\3169%\310\345\246\326\202\215w!G\246=]\032\025\034h|\213\363\213\334]\020\001T\327\216\320\322\327vU\263\215\371\253+g\320n\300h\357O\241\301\246\023\027\327{\212\374\276\200\226fj\303\266_\347\245\200\360\3149\031\330*G\3412\3003\347\\p\342A\023\374\017\377\334\342\242\257\375\363]\344\277\357wW\02630rtF0\332\013\255\247\264\260\036\240H0a\255\240"
+	.string	"\360IH\005\227\211\253\265\322bY\271Z\253\225\026Keu\362jY\205\020\260\213\005\345\265\242\340r\275V\250p~o\276\356%;54\"y\241\177w\0072\034\032Q\374_\344\2672%>H0+\263"
+	.string	"\215\353q\b\322f\235\350kV\305l\314\337\306-\"\222)\361N\213\363\311\305\227\332]\322\217\313\225\211\367\221\224\373\236\007! \200\002!\262u\f9\002\206\367<\224x"
+	.ascii	"\022\272\330\020\356\331\245]O_\257\"\220\n<\310\317\200\002"
+	.ascii	"M6\031\242\213;\304\266 \320\227\332q\311B>\036\366m\202L\304"
+	.ascii	"\266\0251\302\326\345\231I\336\270\2056\020\007\330W@\362\t\374"
+	.ascii	"\272\026\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"m\004"
+	.string	"\362\306\032%\200M:\363\020\030\222\271p\b,\023\366\240\233DmT<\003\310\300\f\314\023\177\322b=y\203\002!\310O2\245\245F\201\337L\360\2733\335\315l\317\245a\250\373\304o\237+\003\350\025(\251\320J \004\201\021gfk\225\016\3700i#\252\030\320q\005l\334[\263$,\246\266GIN\213-\310\342^\232\026\032 \343\332\272\n\f"
+	.ascii	"L34\030\032\227a\200\332\001\320\001\320\371@\276p)\206\005\303"
+	.ascii	"e\217+$\212\320J\017"
+	.text
+	.section	.gnu.lto_.refs.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\001\007"
+	.string	"\001\002"
+	.string	"\001\001"
+	.string	"\001\003"
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.563e7674fa5968e3,"e",@progbits
+	.string	"(\265/\375`7\f}?"
+	.ascii	"\332m<\030E`\336Q:\377\250\251\240\206\341\305\034\200'|#ti\265"
+	.ascii	"e\322l\240|\236N\\\253\251S~k\035>\257\216\311~h\2643\bSw\360"
+	.ascii	"\016\f\330\033\226(\310%0.\202\350F\270\007\025\264\357L\332"
+	.ascii	"'m\313\024E\001v\001r\001WM\2368}/\321\234\371\372\221\304\311"
+	.ascii	"\013F\244F\310\n\020\234v\2316\363^k2\271\3270<sF\366\332Q\241"
+	.ascii	"\234\221G\335K\335K\251\226#Q\314z\351\333U\337YEB\3531\001\320"
+	.ascii	"\320nx\341T\314\013-br5\345\fN\317\252a:\254\317Z\354\375\376"
+	.ascii	"\302\017<\353\2616S\220\314\231K\353\350x\346\013\025\271\234"
+	.ascii	"\363\257\311'\210\231\325\322\364\315\245\2734\230\0269Cs\316"
+	.ascii	"\006|{\314\274Op\332_\232\254\303\026t\331-d\370\356(\226\301"
+	.ascii	"r~\217|tY\350\b\341\364\037\324\327\365\202^C\201o/\003zL\347"
+	.ascii	"\233\217<4\351\322\202\323]\006\365\017\324\367{#99\303\261\252"
+	.ascii	"\324\005z\351\226\277\277\032l\301\316\265z\346\262\234\337\244"
+	.ascii	"\2437\310\262\013\247\177\273@O\355\001\275\277\025@`\200w\177"
+	.ascii	"#=\370\333\200\203.\372{@\317\375\247\363\037L7\370\377\246\207"
+	.ascii	"\226\376\247\371o\366\267R\331\377\025\377\025\020\370\273\317"
+	.ascii	"\337\f\376^\360\367\357\357\244\277\325\277\373?\335\377A\377"
+	.ascii	"\345\376\363\371\037\347\277\230\377z\376\267\375\257\363_\316"
+	.ascii	"\3771\377\301\376\013\370\317\346\177ZWWW\367w\211\037\177\370"
+	.ascii	"\211\260\002\371m\"\271e\310c\273P\256\246\013}6\223\2622\037"
+	.ascii	"3\024\271\245*\237M\267\315\263\211\344B\221MW\311\325LB2g\211"
+	.ascii	"Y\025\024.\263Vs\225\231\3072\013\311D\212\272\3573\337\311\271"
+	.ascii	"\313pdf\203\234\263\236\314;H!\235\226\214\362H\236!\237\375"
+	.ascii	"\346\234\017,\223G\236Y\031u\253<s\256\222\214\312K\f\3077\232"
+	.ascii	"\227t\364\330\225\225\255p\344\214 \2779/s>v\216\346\234\217"
+	.ascii	"9\347!f\326\2333\026\222\353\265\\\346\354\374"
+	.string	"-s\326Q\rG\316\270\254-\255\351B\217<\201j_\240^9\307{l\257|\207\213\251B\217a\331*\347\334~T\257\246\0178\234\362\371\365\033+>ts\255gCf\363\372\243\266\333S\261\247o\207\f\342\006\r\247}\247\361t\030S\267\021)\337\fE\006\031\023'\217\372f\352\0355\223\035:i\025!qppJ\247\323\264\231\321\361\315\315\016kx\220\251\323aM\247\3474\375\212\272\260\350`\223\246\357,lr\214\240n_d8\215\363*s\316?\337\232\271\037N*o\332M\303\351\260\216\366\2327\233n\363\337\233\2632M\2531\332\345\\D\213W\316\320N\373-d\350h\217\265\232\216:=\234\001{\313\031\372\006\373\201\321Vk4\035u\276\271G\212\257*8\271\234\337_SS\223/:\344\213\210\232\366\257}\250o\321UCp\212\201\020=\261\306\220c\360\217\267\252\n7\177\317\235\333\031\021g"
+	.ascii	"6?mW\230y\334$\2205\006\020N\361\325\327\332\212\032\0237\274"
+	.ascii	"\254\352Q\246\bN\361\022c+\314\343x\211w\024)\3612\355%\243\356"
+	.ascii	"%\336\332\023\344X/\375\256\210\372\035\020\025'\237\304n\213"
+	.ascii	"\345+\017fN&\314\\sna\345\261\213s\340<p[\342p\016\214C\355!"
+	.ascii	"\267\303J\034\214C\312\225\022|\243\327\f!\267\b\265\201\341"
+	.ascii	"\035\001\344\206\206\323\3572\3168\343#\333\322\313(\314\231"
+	.ascii	"\036\271\307\035\037yr\252@1s+T\250\351\006\365vX\325%\347\336"
+	.ascii	"tF`ko\202\362<\2551\221s3(\254\007\365\333O\004\323\315[f2%\034"
+	.ascii	"\223\251\357>\r\367\366s?-\247\"\345\244\033\234\267\354t2\341"
+	.ascii	"@J\264\224\201\336r\337S\2243X\316Y\301\321\026\331\026\031\234"
+	.ascii	">\256\001\375'*\232K#\263\302\200\342\234t!\353\022\363\246\\"
+	.ascii	"\316\242h\3414\254\377\264\330\377\314Cz\031r\304\351\261\026"
+	.ascii	"\365\370\357e$3\347\334\203\367ff\262\350\315\353f\372}\275\353"
+	.ascii	"\006y\367\b]9'\231\363G\245\202\206$\202\323\377J\371Xr>&\345"
+	.ascii	"73](\327\321\365\"\247\231\364\346-\003\031\332\225\335\227\253"
+	.ascii	"\231>3\316o\356\254\344j\316p\337'\323}\237G\244\254|\036s\217"
+	.ascii	"\242`\\\205\254\324\023T\321\t\352EK\\\215k\021\305PHdC\020\331"
+	.ascii	"a\033\2541l\241>\254B\326\204q\250\364(\n\305U\006\r\341\032"
+	.ascii	"\005e\\\022\2562\\\004\211\"\332\325h\264\266\301V\005\210v\205"
+	.ascii	"\341{\024\005cq\2551,\n\023\310`Y\020O\274vU\241\242\260\001"
+	.ascii	"\202\212\005!$\016_\020\220\301\026[\"\033\"\2061\270b\300\332"
+	.ascii	"\006\205S,\214\n\264C\"\211\242C\r\213+q\205\241\036\203\206"
+	.ascii	"\t\0328P\r\235C\207\n\035*\364\316\241\003\020\330A\003P\275"
+	.ascii	"\006\340\256]\237\204$b\030\203\255\332>\031Y\250_\245\206-\221"
+	.ascii	"F\n\003\355\243\236\246\214R\306'!\t*\326\005\257\030\214\202"
+	.ascii	"JW\251\340\t*\326\305P\033\005c\352\300\331\251\265\350\324\262"
+	.ascii	"l\321)@\373\304\241%\016i\f\tI\264\304\225\030\224*\256S\001"
+	.ascii	"\214O0\206/\210l\b*\026\004\322\201\300\020J,N\214P\241(P\261"
+	.ascii	".\330!q8\345\304\016\235\210\303\240\224\023T\321\350D\341\227"
+	.ascii	"D\213\227%\315\n\022I\363\310\316[\234Z\027v\372\372h\001\344"
+	.ascii	"\344H\277\361\206\004\"\304\203\313m4]\206\354\301jz\274-I\303"
+	.ascii	"\251\021#\330I`\315\213\315k\327$\b\032\033N\237\346\300\302"
+	.ascii	"\302Z\355\205\316\b\026\200\033_`UY\307ZCesT\306p\212\211\364"
+	.ascii	"\036U\215\330\025\2213>|`\347\357\271kkS\005\327\204\306\256"
+	.ascii	"\300a!\307N\274LZq\"&\210\017\213\036:\001\200\356\250q0\207"
+	.ascii	"\2244%B\"\"\222$I:\220\002\021!\263\316\001\021@)\224jj$I*\313"
+	.ascii	"\276\001Z('\276\365{\363\020Nh\234\033\031\345\353\034\213\266"
+	.ascii	"\\\330:\301\210\257+\033#\206\226\346\213h4\230\314\001\353\324"
+	.ascii	"\001F\315\n\351\320l\266}\250\323H\036l\032\206\214\241\007L"
+	.ascii	"\226op$b6Z\371\377\316\200\fD\\\"(M\"h\336X\330 \003\350\251"
+	.ascii	"\037q\001_\360\216\013UqR\031\003\r\006\365\032\024ais\362\245"
+	.ascii	"\213\334\245\035>{\221\242\027\263A@\263H4\223\350K\020\236\237"
+	.ascii	"W\r\353\031\032\025]\036\003SI\330N\0368\370a0\331\2563\266\301"
+	.ascii	"\335\366\257\305u+w\001\324\310\337G\262\203\377I\254\251\031"
+	.ascii	";@\006m\017\f\020?\240\034\2637fM\024!\303\247\201\fw\276~v\264"
+	.ascii	"\023\255@@9\302F\333\371\316\270L\210\2625\216~\310\364\210q"
+	.ascii	"n\377\236L\2105\016g\312\bq\026J@\214f\330\007`\300.\021\230"
+	.ascii	"\266T\201\334\221\342f\221\300\316\322\347\005\355\032\276b\342"
+	.ascii	"K\366WN\3400&\002\257Z\322\251\021\310Q\276T+\177\337|T\226\302"
+	.ascii	"LC[\246\013'!\204\272\202.\036\033\177}\332\242\206B&\266\345"
+	.ascii	"9\311\213\306\003\024'\340\310\340@\263\313q\312\2136s`c\254"
+	.ascii	"\205!\203\f\254im\023q\004\245k*\322H\212\265U\204\247k\034\270"
+	.ascii	"n\226\207/\r&\366O\003\n\200\344\360\002\200\b\324A\304\212\373"
+	.ascii	"iv@\3310V!\210\213\216\207yD\361\241\n\023\222)\324\r\257\251"
+	.ascii	"\006]\032\r\2364\273\037\020\365"
+	.ascii	"\244x\0028\346\245\274&X3>\243\337\234\231\357~}\222+\340\023"
+	.ascii	"\374\277\265R\334\300\262d\365\306R\242\313\247\347J\037N\253"
+	.text
+	.section	.gnu.lto_.symtab.563e7674fa5968e3,"e",@progbits
+	.string	"pinioBoxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"pinioBoxTaskControl"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.563e7674fa5968e3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1185 @@
+	.file	"rcdevice.c"
+	.section	.gnu.lto_.profile.646aa49399299041,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\016"
+	.string	"\025"
+	.text
+	.section	.gnu.lto_.icf.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\310\001\305\013"
+	.string	"\222\317980\217\323\0304\224\222kUO!}\234\245\325\317\247\333\310)\020\341,\346\203\316\240I\213\036\222\006\022\006\006\271\b\013\n\031\360$*\360\331Fzs\255\021Yim\347&\001\026\245T\022\310\213\322*\264\261\"\213\007D\322\\\020qZ}*\017\036\"\017\0232\235Xd\344\326\024Dh\352*\300\234\265\213'\245\004r\363\316\313<\247\\\307\355-\007\252DI\006F\255\032*\325\200\262q-$\325\006\335\327\333\274\232"
+	.string	"\3319\201\210`\276\277\357\355\314 \344#\324\346\233\267`\370A]2M\001D\"\332}\275l\317t\327\273\227\273\312\367M\340\324J\347"
+	.ascii	"\233\323\247\025&\023#W\034s\\;~y\236\235a\f*\n\004\211-\347"
+	.ascii	"s\354\035[\256ma8\032]_r\316\035\013\016`\214[_X\302\207C\303"
+	.ascii	"\332X\203\001G\250\301\261\300H\211)TP\310\260\033`\202SE\262"
+	.ascii	"\003\021p=r\256\306\222a\rs\370\006\b\3770\205\322\036\\D\251"
+	.ascii	"\021'z\270\355w{`\205T\300\201\2442\214\316\352\302\365\201\035"
+	.ascii	"\212$\t\267\326\333\277,b\027l}\031\240(b\002\037L#-\327@\315"
+	.ascii	"\206#\273\242\376\274\037\336b4\305\030&a\277t\013I\317B2T\230"
+	.ascii	"#jt\250\250\177)-\275\343\276\315\353c}3_=,U\345\204\360\314"
+	.ascii	"\222\376\005\310\365\334\312\210;\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\233\001e\007"
+	.string	"\362\311\032\035\2007I\007s(,30\027\222\t\221Z\340@\374\326\236\276m\262v\357\326\332\3362\311|\2003\213#K\n\305\232\270+\035\346\\\006W\202\266\0071\361pf\331Fxx2'\3264\303\304B\370y\0256KZ\245\357N\362\"\215#k\371\217:\327\201\351@\277.0\242Z\210T\240w\372\260\263\221\r\350}\276Ar*lB9 p\202\231I\263\003\005\002\352D\314\305\313\241c&X@\027\215\3200\211\b\226\\\204\315{\2260\3300\211\300\206}!/\\\002\2723g\323\202\266\t\200\20717\256^1\214\242\005\026f\001\252F\b\013\006\240\371\302\320D\001\230\2409$\370g\316\200\324\303\205\330\230A"
+	.ascii	"\f\231\006\342\001\f3P!\250c\"\025tc5\353al\017\353\262!\271"
+	.ascii	"A\b3\032X\205\006\357\n\366\024e\b"
+	.text
+	.section	.gnu.lto_.inline.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`)\006\365\031"
+	.string	"&dyH\340\322&\215\001\324\272?\363\312\334\210Z\312\215m\220\227\224p\251KP\355\364m.\210\271n\321\371\350\354E\334\273\2103\260C\257\0048\355\025b,v \316\374P\231a\004\013\337\327\264\354Z\307\336l\310\210%do)S`"
+	.string	"`"
+	.string	"j"
+	.ascii	"+\314\322\230s\262~X\030\377~%\277?\232\270\203\323D\302\300"
+	.ascii	"\340\262\305\3159\273\027|[T\266s\316\351\275\2039g\315w$\253"
+	.ascii	"\177T\"%Y\332/\360Hvv\\i\342\317\f\037>(\235\246vX\250\257\252"
+	.ascii	"\270\357\313\272`\262\035}\017\023k6\0239o_g\342\013&\333\n\325"
+	.ascii	"\267>\231\004\337\353\365~\256\367s\275\037K\344\t2B\322A\020"
+	.ascii	"\365+.W\237i\221\232,\355.\351\366@Gk\324\252x<n8\347L\221\331"
+	.ascii	" \0306:\005tv\362S\373\311\222\023.\256\n<\223\235\275\353K\224"
+	.ascii	"\340\241)\367-\245,\312w\306\325\345t\224\307b|%\370/\3733\347"
+	.ascii	"\f\221\177q\002\253k.\233\"\247C\017V\314F\270\321\023\244d\326"
+	.ascii	"\260\020\264\361~&\002\335\334.\254\320l\210\245!\245\003"
+	.string	"\213|\177k\027y\245\362\027\351^\266\354N\215\t1v\320\202\216\355\346\3641\213\342C\021\007\025\251#4\247\226AHEgjX\250\253\302\302a\241T\3272\211\213\277\257\257\r<\271\264\225\253L\304I\372\001\224\002\206\270\200\007\277+9\005\245\245\032\221\202`\2609 A=\347\036Q\325\002dl\021x(K\323\025q\302\307\210u\200Vlw\026s\316\225\002X\202\237K\266D!\f*rt\257\334\371\312\225\225Q\341f\244\353d\331\243\032\016\233\215m\213\035H\032\344\257W\rj\300\3527=\221\270\250\232\300;\331\331'\033G<6\214\f\376)B\030*\301\203\372\200\235\250\201\265qddFd\224&\205tP\0021F\310\322\003\022\340\244)\206rgj&\220\221$E\325\354o\247(\250\3575l\033\034b\243\332\035\246\3259L\236\3527V\341\036u\217G\232[\334d\351\221L\203*8>Ov"
+	.string	"\2270\f\255\301\277\337b\341\265\323\263[$[\017\202\362\357v\344w\254\3470\311Z\t\374\301\"\ff\004u\255\314\305\016\354A\bd[\362|\020N\361\322\310\0334\311\303j\361\221\334\231\301\005A\265{5Q\f\326\334\300LN\367\341\203\266U\334k+\277\334\233\344\005\266 \262\033I\"\247\350\036p\004\374\b\205\207L\305\331\277\f\006\213\032l\272v\217\241m\273\333\237P\325}\313|\236\332"
+	.string	"\223\231\b\024\252c\327Et\215\240\312\317\223v\323@\022?\357\353Y1:\374\353\201\363a\320Bb\312fP\2076\250\311\246\302?\003\322\201\314\216\370\272#\022"
+	.ascii	"O\326\274L/\355\031\326\376)\006\312_\025\357D\\\211\033Af*\216"
+	.ascii	"\347\035\262#\002`5\027\tL\007\t\036u\224\361\272\f.\230R\371"
+	.ascii	"V1H\227\334\246Pd\230\031E?\2029\223\317UZ\236\217\2454\037U"
+	.ascii	"g\237\336\335=,-\333W@\001%*\317\260[\003\345\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\253\007\315\024"
+	.string	"\206XG5Pm\222\341\210\310\314\222j\203A@\020\fG\0258\272`\216\250\331z\323@e5\"\315\315,\227\210\017|\020\343\237k\nj\320\177\354zc\021!\273\355-\223\f1"
+	.string	";"
+	.string	"8"
+	.string	"\212\fO\257\230\304p\020\226\203@\336e\261\337\217\305\2670qx)qx\343p\2279\326s\270\332r\330\271\310\363\255T\320V\320\033\347\322\317b\215\204\031\354\005\213\221\242\250\t\260\276.v\f\232\236\252\252D\210\270\340\212\355\037\377\212\002\300\026E\252\26268\\5\324\302#<Di\300\003Lj\333\363<\023+\301\334\303w\250@^\003\030\026\327+xd\322\255\302\006\203M_\321k\261@ \002\246\215\031\331\001\177\260$S"
+	.ascii	"\3648|:\301#h2\345\321C\341ik\225\314\223\301\377\303G\357\250"
+	.ascii	"\252\241\260\001\233Til`\020/(\3005\376D\240\304\223\230s\254"
+	.ascii	"Glq\025\371.\036\0367\303b\347(E!\305s\200\202\331\354HQ\022"
+	.ascii	"bNH\351R`:\036\246\343\271\025\0267za\361\271\001\200\250\250"
+	.ascii	"Q\275\203f"
+	.string	"d&I\n\255\001P\002!\204\254\254\016\022@\303\034\005\3224\247\0304\320L $\263()\025\346\037@m\210\206\275]\323e\357\260\202\341@zf\344:\346\310\033%\250\265\336[\2601\356\360\300\344\316k\223\264\265 h$u\215&8s\336\245\256\223\225\314\2218K&R`c\025\035\277\347<\205\024\276\030O\007\375y\227\277\322\322\\\244\2317\241\217^\255\261\334\214\344\327`\313\276\023\261\330\232\334\314Dz\354\004\256/\374\364z`\343\312@vC\312k\307=\224\264R\276\220\221O\304\264\330>\317\277\003\025\\\220\021hA\3022P\013\274\335\341?!e\256sJG\354\264k\326\372\023\0130YT\230\001a\200@\246A\036\024\2034\223\223\223\235\360\004\305\221\216\367\024b\331\214\364a:I\356\215\265pdD\377\3062\226\371+\025\177\317,\344\366\203\234\201(a\b\032\002\026\320#B\323\026-\255\022"
+	.ascii	"\221\234be\347L\2156D\204\t\f}\020\366]\"\222\035\204,\361\363"
+	.ascii	"\257M0#v\362\301\321l\"C\250\377\"\256\247[\203\\\234r\206\205"
+	.ascii	"l\244%\020J\177a\220e\325\376:\267<P\013W\023\242F\211\260\271"
+	.ascii	"+\230'b\210\234\311RSR(\243\247\341]\",\212\351\033I)\375\314"
+	.ascii	"\201\\\360\223z0\302\3214\2416q\346\347T*D\325\0242"
+	.text
+	.section	.gnu.lto_.pureconst.646aa49399299041,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\271\004\001\231\004\002\232\004\003\232\004\004\231\004\005"
+	.ascii	"\231\004\t\232\004\n\231\004\013\231\004\r\230\004\016\232\004"
+	.ascii	"\017\232\004\020\231\004\021\230\004\022\230\004\023\230\004"
+	.ascii	"\024\230\004\025\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`'\001-\b"
+	.string	"\242\213\"(\220'I\007\377\377\277z}w\273\2353S\302^b;\376\377f\311\003:X4\025-Z4\364\366\377\333\326\220F\244L\001/j\221LT\342E2Q\347^\03686\270qA\031#\244,H\315\316E\330P\316\360\004\345\2433\325pa\356\341n\241&`"
+	.string	"\205\300\235:\227\232\203Pb%\374\214t\252NHMo*\0204\3170[\363\236\312\355\354\236\344\217\232Yj\177\207\023\321^v\275\236s\204r\205\362w\360\306\003\337E5 `\2021\205\325\003\2264\246\225{\202#\230\t9\b\034\016A\346fB\260X\"\317\205\027\311\304\301vq\270\200\252\224y\020\244\001\361\200\224\302\275 \323\222\003f"
+	.string	"g7\305*\222%\240hF\250"
+	.string	"\005\346\303\303m\374"
+	.ascii	"`\304\327*$\363\210\026\246rd\227\335i5XIl\013`g\361F\326\002"
+	.ascii	"\343\310=\027\230\207(\013\265\302\b`\017\222\017\2746~m\033"
+	.ascii	"\\\021"
+	.text
+	.section	.gnu.lto_.lto.646aa49399299041,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_expectedResponsesLength.18.646aa49399299041,"e",@progbits
+	.string	"(\265/\375 \203\275\002"
+	.string	"\344\003v"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\004\005\001?\202\210\200\020\177}\274\001{\273\001\005\001\006\025\002\273\001{\277\277\035\001\005"
+	.string	"\304\001{\303 y3\305\0014\302\001\301\001\300\001\276\001\275\001"
+	.string	"\n"
+	.string	"/\202@\335\250\356\200|7w"
+	.ascii	"\203@\271{fHi\020\003p"
+	.text
+	.section	.gnu.lto_runcamDeviceFlushRxBuffer.25.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"E\f"
+	.string	"\346\326SB\020q\233\0168<N\317"
+	.string	"\272C\224\261\200\0349Hi'\231\027\253\264\241\253\371\021"
+	.string	"Pt\006\361\030\350u\354\343\317\210\323\345R\324I"
+	.string	"\200\212\b\212Q\204\270\243\002\303*CA>\277\033\331[\312\224\002@"
+	.string	"?"
+	.string	"A"
+	.string	"&7v\327R\020\206\311=BM\316\317\016,:\357\363\b)P\210\210"
+	.string	"\036\bfJ*'/yj\360>\022\222\020\271\276\344\220\204\003\251\363D\236T\203\335uv\336\206{\272m\215m\214\375\007\001\376\350\2374\255\231\316L\337B\325xq e7d%\307\242\304\223\021\027\333O\373&~\202\373\250\343\002vC)-v?\005NP=\372;\201\351\261\372\200\351\321\234=\343\237h\251\01722\004j\241A*\001ww\241\216\330\256\362jW\340\344;#"
+	.string	"\321\217\355\013O\341\001"
+	.string	"cw\027\370(6\f\006D!\036\375\216\351\361\252\036\t\307\310#Wt\205\013\220\247:b\177\237\314\210J*\326\220\003\330\225u0\315\344\013\203]Y\007\323\\\233\245e\326\204\f\302\306\2726\216\205)`\215\002\266Y\0264m\263.\337^Cv`\003\305C?b\204IUIT\304"
+	.string	"\311\222/\231jK\330\344;U\006\036L<U\225\001\025"
+	.ascii	"2\003\353<\222c\353\365uX\\8kv\030A\334\021E \221\313\235\250"
+	.ascii	"\022o\302\302<\n\232P\213\224K\260\315jJp/n\251R\265\f\324\313"
+	.ascii	"&a>\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSendRequestAndWaitingResp.27.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\350\007}0"
+	.ascii	"\312U\020\023DPdR\007\301\274\321[\022\203E[\212\272\262PQh\f"
+	.ascii	"\320U\232\303\356\264K\030~\332dI\254\"U\214%\2158\271@\004)"
+	.ascii	"\371p\025W[[\355RI'U\340K\313\210\216\027\224\215X\226\354\275"
+	.ascii	"\245L)\037\001\r\001 \001\300\375\373G&"
+	.string	"\207Y\322Es\274/pj\3443g\253\246\355\275#\270\213\026\314\233\351\017\023\305\016\355\251\351\023\024\300o\025\260O\344z\331cb\311v\224\301\220\261\373\204\n\372\255\313\037\332\3155P\210\217\335\177\354\251\372\253>\n\f\355\251\262g\332\336\326\b\256\004\374\326\255/\300\375\026\370D\356\267\256\335\345\274\325k\377\246\\\254\276\354\331{\023\263\023g\237\265\276\273X\277P\2200\370\003\374\271-\233\261\366\377q\300Yx\312\256gP\251\027\342\372 \026\302\0211q_\207\245\204%\272fa\362m\302:,.V\301\033\305A\326\201\024\216\310\327a%a\005\3201\211\363o\\\370gAW\326\326\003Y\004k\324`\371:\254-\326(\272d\314\277\277\240\n\326\021\374c\205vV\220\f\241V,\205-4\273\247{\374\2046\261\013\246\365m\360zuB\215<\313j\240ny2\204R\261\231\314\314-\b\235\302\371\351^"
+	.string	"\265y=\203j=\376q\330{;vB\263\336\207\336\375\205\356^\345\376\033\021\314w\372\337\275\033\021\376_\337:\t\023\370\235&\334\023\377\356\b\340\265\367\266\240\3742sj1q\237\023\300\277\337\323\270\017\376\327\376U1\364r\272\263h\001\324g\256*K9\021\006\312\356/`\340wz"
+	.ascii	"7\253^\336T\226r\2676q\236\362\345aC\305s\023\367!\354KB\330"
+	.ascii	"\225\206\330\223\206\330\221\032\f\2613\030b?2z\264\377\004\357"
+	.ascii	"\345\277\350\311\376\017<\231\177\002\037\346\237\350\317\376"
+	.ascii	"\207\336\372?\374\352?\320\317\275\273\031{\033\204\235\025b"
+	.ascii	"\317B\3548c\177\b\004\276\244\321\251X\276Z\367U\037\337\236"
+	.ascii	"k\325\246\374\334\277\232\277\232\237\363\247\363`\234N\363r"
+	.ascii	"~\3745'\241\365%\035\3734\376q\036<>\234\022\273\303lv\252'm"
+	.ascii	"l\317\336\326\007T\300\343\231\177\273\361k\216\347\234\271\341"
+	.ascii	"\036d\3736\367\240#\177\315\r\030i\"\035C\272\007\277\315\377"
+	.ascii	"z\320?\355\315\350WK\376\256\302RAU\315\333\033\353\301\267\336"
+	.ascii	"\003\370mL\364\024\277\323\025\024e6\377\373GYx\315\253Y\037"
+	.ascii	"'\263\353\302\003\346\251\277\334\003\363\300\204\270\376K\367"
+	.ascii	"\351\276\035\343\263*\3032\310H\371\351\276\303=\220\013h]\313"
+	.ascii	"\336\374\322u\327N\376]\376d\305\331r\007\350\311\277>~\314\253"
+	.ascii	"^\024\312\2779\310\256a\321\034\205es\326!\3128\347\334\342)"
+	.ascii	"aw\r\246\255\340w\342\214\364L2\327\304\362o\224]X\024)\273k"
+	.ascii	"-\357/e\265)\273\236\325a\342\276_\236z\0064m\203\334\356a\177"
+	.ascii	"\342\256\2627Sx\217\335{o\367_\3115\312\rX"
+	.string	"17\267*i\263\371#\211\231\226\315F\331\315O\017{<K\242\227\362\357hj\204;;\fr\214j\330\200\262\26396O\375(\017\263\262\314\315\024\336\363\227s-\366t\226Iw\232\313\347i*\322\0059?Gw\351\300\304\344~{\224\237\356\003\360\211#\245V\231\270/o\241\331\201e\037\346\317\257\365%g\325g(\273\177\370\327\331\352\264\t\033f\367\020\377.\177Yl\364\242\376oL \270\333;\307\347\001\305d|rJ\342x2*\203MNQ \214O\311\032N\"\224\306\247(\340\223\021y\\\321C\teL\301\243\210\f\202\212J\"\215G\250\237\223\261\204\260\bU\364\200,*\2138~<\210\240\341TD\"\223M?\2567I06\035u\030i4)\211\311#\321\351XD\022\233\224OD\t\006<\211\303\250$B%\223Jb\320\312\374\334\304\343\250\350\3451s\323\223\354\336]\033^\355\377}"
+	.string	"ydB\034p\233\201\262\177\233\226\322\315_\226*\022S\003\027$\303]\3123\312\334\264\271\246\302Dd\f\261\241\255\336\207\373\355R\376\266\307^W|Rj\265(\267y\202\2242VK\321=8a\236z\321U\002\326e\300\277\206\257t\021\003Z|\3221!o\372\251\203\340w*\345V-\f\317\226`\236:f~R~.o\256\257\360s\tt\374\003;5T\017\321E\360;u\021\367\333\244\374o\217\273"
+	.ascii	"\271\"\245V\023\030\371\327\361\272\346\204E\177\212\266\376"
+	.ascii	"]\016\370\351\302\323\233"
+	.string	"\200\331| \377\032\246\322J\200\232\353_\275\004\301\235\016\200\236\250Q$\245\0343N\231\021\021\tf$i:p\002\021*2\363\021\2009UU\222\024\2461\312\002\325\251\277\231\362\351\3559\274\325\300J\370L\020\016\365\020\305\245\267\275\001\201l\037\334`p\270P\325]h\036\030\t\331i5\005\306NaE\217qQ\327\322\254\227k\275\026R\224C|\215\243\341i\005\311V/X\201#\341\013wJ\365e\006\314y+\022\345\274\224\246\2345\035\300\334\307\364\214\261?\f\317@\251\300D\256)j\211\273\234\327\315G\013{\314zlw7\250\340\225-0=\210\031=\007\274\212\324\340\354\255/\220&\273\252\326m\203\260\035m\246q\377\237\260\033\202jppt\374}GI\204\240I\004\205\252\254\232C\250\300\351\301\3313\372\261\005d\275\255l&\356\3045\224\tFj\320j\263\277\216\306\235\212\307\375AO\266\243\n"
+	.ascii	"\223\274\357G\320A\034\303\217\030\0333(\002\f\237\366\020\345"
+	.ascii	"\210\347\004f\006L\201\006\300\215\273Y\235\256/\352I\220\006"
+	.ascii	"\244\036\370\373\237\001\376\226\273\023\2500\325.P1\277\220"
+	.ascii	"+\240\377K\027\205;\202\031\200\274\324\241(v\3140\364\250.F"
+	.ascii	"\330\206\213\364k\207BN\223\367\250"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.28.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\035\n"
+	.string	"\346\022F=0\345(\035\300s\330s3\237\226\262\335$fa\272\216f34\224\364\251\242\255\346Lo\237o\373\330\241njC\207\245\273\205\224\226\202\302\031\0300\363\303R\262\013\222\265\211%\204l\231R4"
+	.string	"6"
+	.string	"1"
+	.string	"2\032*\264\335\375&\311\307oSG\177\2004}\363V\237\233\002\313eE@\2426\316L$\346\261\353\006\231R\325xv\327\252\";n\356\266\035l/\330\367\002\352w\017"
+	.string	"h\001:\003v9j\005\366\205k9\331\330\276\332w\3755\036V:(\330\224\354ce\267dp\202w\316\3459\3359\357\006\3359\217\366\314\313\222\325\264\002\237\0212\230\224\022\260}\361\224Q\203\217B\312\360v\367&\347\374Rw\356\363\261+\210\207\213\365\202\235\264f\227&\235-\373\333\356\256\347\210}\330?5$\0218\rv> \b\343#\001\212_\b\372(@\020\023\037(\206\276\016\202\303\212\217\370\211\302P\3746\345\336s\232\250\315\3239m\213\220^\345m\232\224E\300,dz\324\005\020"
+	.ascii	"2\003\3020\304\204\275\032\310\r{\t\325*\b|\"\3049\304zKx\002"
+	.ascii	"S.\3016\253)\342.\267\264G\003S{"
+	.text
+	.section	.gnu.lto_runcamSplitSendCommand.30.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`U\006u'"
+	.string	":Fp\017I\200\332Q:Af\227|\035!\006\020K\250\t"
+	.string	"\246\353\203\007\275\3703q\260\250 \250\321T\275\200DV\2156Q\242\353\370\024 \270m\221s\224\3178\322\200E\206\323=\220<5\370\366\313@I\025D\020!\204\020\"w\222\001\337"
+	.string	"\331"
+	.string	"\351"
+	.string	"\307{\203\017n\362Qz\323\310l\313\\\341\002\357\304\335\003\334\236\231\034\266[\346G\271\024\336\263f\\\300\275Um\270\356%F`\243\364&\023\017t\336L\357s\336d\3461\2779\221\310E\257\212\374\214t\356\275\266\276J\323t\207\313\227\304\363\332\274\003\340Yk;j\212\236f\331\226\307o:"
+	.ascii	"\343yJ\264\206\016$'\013J\225Gh\307\256\203\325\260\253O\b\344"
+	.ascii	"\265\022}\n\2469Yp\252<B\302\211\272\230\317\356\f\021F]M\251"
+	.ascii	"\204?\216\226\r\312\bis\262\240\217rh*\f\217\025\352gO\261{\270"
+	.ascii	"zBR\t\243n\036\354\036\312r \251\204@^\026Q\t\203\274K\013Ml"
+	.ascii	"h\251A\321(W+s\224\334x\013\204\352Y\213r\270\367\262\305\001"
+	.ascii	"%<\367\234\371\t\230\231\004\263\031\026\275\257\263,'\233d&"
+	.ascii	"\366l[1?\275\342e\204\273\212yA\321\275\316D\n\036vN\200\340"
+	.ascii	"\200j\331\200jy\250-\013\265\345\002\252e\002A@?\251e\237\001"
+	.ascii	"\347:\363\234\370\253\317\372\315\177\235-j\371\fz\244\312h\b"
+	.ascii	"\273WG2\355\2221\273\222\374\353\017\373\271~\257\177\n\177\313"
+	.ascii	"\303\370b\274j\341\335\312\277\370`\\e\013\250;\025~\227{i%c"
+	.ascii	"\206\367\336\325\253k\227^,t\253m\327n\002\n\346'\"\275\311\305"
+	.ascii	"e\351\327\027T\177WEN\335\271,\235AuG\331\215\343M\016\221\336"
+	.ascii	"\n_\313\257\034\213\356Y\214\322\246`\212\245\354\351\b\"\275"
+	.ascii	"IT\352\370Ux\325}kG\324\024\340\366\312\200X\367\022;\2447\177"
+	.ascii	"#\257\327z\221\367)1\322\213\365\341*IQ\3039\276\251\236\332"
+	.ascii	"V7:\203\032Ag\360\362\245\365l\016-&\307\324@\037h\353\346W'"
+	.ascii	"\351\034j\003\375_\017\241\036\352\362\353W\007\302\013\264P"
+	.ascii	"\337\227\326\263I\016\352\002-\303\311\326\257\216\323\223,E"
+	.ascii	"2\264\255\370I'\201>U1LP\023\350\213\275\354\032&\177u\234z\353"
+	.ascii	"\351\254\353\374i\237\006\352\273\371\365\350]M\212\035\377\b"
+	.ascii	"\177\351\274\351\323\326\b\214\242p\236\036\320\007{)6\204\343"
+	.ascii	"[\322;B\372\260\314\2662\"a\214\216\231\332g\354\371\2538\346"
+	.ascii	"D\352\021\350\230}}w23\204\033w?D\356\275GfQ\314\320,\206\035"
+	.ascii	"\341\300+\354,\350\204\366\342\264)c\224\367Rm\370\224\367\016"
+	.ascii	"0'G\255S\031\223\325\374\342|\237(\256\241a\321\230\031\351`"
+	.ascii	"^\244\367^\f\374/L+\322#3\316\233\357\033\337 \314\266\005\216"
+	.ascii	"E\347\230\\4\322o\271[\347p)R\350N\224`\312\231\320\255L-pI:"
+	.ascii	"\0259\023\351\3117\t\270\033\022\f\034\212[\316\246\204dk\201"
+	.ascii	"d\"\311v\313-\331$\b\261\222\013\\\316\306\244"
+	.string	"\244\224\263\255D\247w\225\355\336\001\254?m\033\370\243\226Mr\2175!\020y3\337p\3668\330r\001B\306\327M\3744\227S\242\031\232\331.\2369\363\301S\326\202\232\t\231U\376\370\2374\r\271\245VT\002\017v\025\0139V\033\320\\\226\247r\243\nt\307\230!\016\236\334\223\337\235D]\2245,\363Mm0C\223Z\333\212_\353*V\277\250\n\324(\3107f\n\344R]\220\232!\307L\240\016j \b)(E64,Zy\357\275;m\305KCR\004\375%q\236\320\003\275\240\201\314=\311d2y\2433A+\350\007\200\204\250A<\205\020S\004\231\231\tdF\333\244\003p\002\231\271\332\r\020`H5I\007o\360b\304\363\373\366\35259\021=\264\223q\036\205\21467\243\001n-\"\312\323\226\330@\0026\301\276Q\266WZ}\0362j\360Hk\026\307\341\241P\246\332\266\307c\323\375\037"
+	.string	"j\314\312\305\007\nb\255\312J4O}\352\303@o\235i\260[A\317\244\360;\360\223\035\026\003\260C\216\360\3701\257\037\0038,;\226\241P\270\3613\317%\303:\367\343j\\\332\360\030\376+\r\306\240\314\n\322=\325\232{cYd\230\337\001\254\333\300\005E\006@\372"
+	.string	"\352u\305\376{RE+\355\336$U\203\375\362\202%@\231C\343\274\356_2\200\271=A\262\220\276\327^\032\356\3136.\b\224\tm\305\354\005[]\003\313_\177\203G\351\023\204\001Pp%\271|\315F\375\020\221\004Eo\301&\310\202\313\037\350<\343\325\244\317\301\341 "
+	.ascii	"\023mb+\335J]U"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.31.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\331\002\275\025"
+	.string	"\366g\215J\240\024R:\203\320[9\232(\310\270A\024J\3075ZT\345\352o\001./\202\255b /\005\177\321\376P\325\352.\253\217\352G\037\030\277\334\200\367h4x|\230O\035\230u(;\361{\2746f\003\2657k\244\221M\344N)u"
+	.string	"o"
+	.string	"}"
+	.ascii	"\020\310S/h\240{\231#+Qk\351E\t\252Z\313\003\247F@~\332/\272"
+	.ascii	"\221\356A\034\001\261\252\223\264\242\251\3262\201\r\220\247"
+	.ascii	".\2172\236\222\0070\236Zg\013y\351\242\266\202\244zB\253Z\253"
+	.ascii	"l\203\256;\025w\352\374\234\323\027\220\347\"\311\363\025\031"
+	.ascii	"\214\260\3629\001\352\210%W\275\036\027~\376\200\2749[*\265V"
+	.ascii	"O\037\020\305=\336v\213m\027{\025\004\364{\341\247\317\317\324"
+	.ascii	"\217Qp7\207v\311\233\013d_\254\265Vo\013\373\345\035;\322\r\273"
+	.ascii	"\322m\362\340_\362\232~\271\246]\256i\3225\335\"\247Gr\232\266"
+	.ascii	"\246\305qz\351\364\024\247\217r`i5$\002\215ZM\f\261\352\016\352"
+	.ascii	"4\364\362G\372\225\276\366\177\364\244\013Mb[\311\346u\347\204"
+	.ascii	"\353\027t\204\212\005)G 'Vy@H\020\005\273\022\343\327S\343&\347"
+	.ascii	"\013M\330>`Z\372\365\210k\273\034\312B\200)_\370\023\006'\230"
+	.ascii	"\f&S6\343\251\030\345\253\332\315\241w\305}/\353M7\271\323\214"
+	.ascii	"\247\273\243\360\327\243\3413h\346\272\210\fax\303e\330\024\230"
+	.ascii	"2Y\372\224edU\f\035\361\020c\263d\355\227\331\274\317\342\346"
+	.ascii	"\370GS\220\305Zf\374rH\n\2423\257l\323\316$\343\300_\212\251"
+	.ascii	"\221\265\326\013\235\3728\343\003\264Y\255\206\0063\206\260\265"
+	.ascii	"\234\314\340j\022:\310\324Vh7\032\334\013-\006&\0027[\317Rh\263"
+	.ascii	"Z\r\rfv\223\331j\262\017\265\027\017\262\331mF\2262\3006\020"
+	.ascii	"\264\233\fg\263\335d$\345\356*\273\345\235.\320YF{\302u\260P"
+	.ascii	"(\241U\221\327\332\024\216\243\302\215\315\341\253r\355\213\334"
+	.ascii	"\326\272\366\275\024\260%\307m\355\350\243\227E\336Q#\335q\277"
+	.ascii	"\203\305\233C\307\226\356\213\230l\364\262\2446\0266 `\002\031"
+	.ascii	"B\273\r\3420v\236P`\321\rc\310\260\277\022\264\375\326h]\234"
+	.ascii	"\230\013T\210\2161a&C\263\2010V:\3520@\02277\f\217\340\356\276"
+	.ascii	"\025o4\241\332h\027\n'j\375\013\241\325\247\251\020ps\353\331"
+	.ascii	"\033\007r\310\027\311\207&\273\361\310,w\003\267BT\252\017>c"
+	.ascii	"\242\207\330z\325\376\352\306pz\2478\231\317D\034\205\225\004"
+	.ascii	"\266\221\227\233\236\021\271\246k\264G\003\313{"
+	.text
+	.section	.gnu.lto_runcamDeviceGetDeviceInfo.32.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"u\n"
+	.string	"&\325J> O\234\016\243\026\361\301\225YC\300@\025\362\233e#\b\236\"kt\036X>\314BQ\326\020\207\346\037\320\366\017\212\032{\200\004"
+	.string	"\346B#x^5\326\270\342\2004\377\021\215\270\255\224)\0057"
+	.string	"8"
+	.string	";"
+	.string	"\273\337"
+	.string	"\013\250\016\375\275\203:\254\316A\035z\263W\374\303\260\220\f\024\"\224L\273\033\365\302\267\347\346\377\3033:\317\346\t1\260\273\316\316#\341\326\333\016`\233b\277@*@\242\021\227'\373\343\244Z\260\377\330\335\265z\366G?|\244U\323\231\351C\376\t\231\\\034(\261\3339\301X\024\360\004\207\210\355\247}\017\027m\037=\270d\327ca\"\267\250\311\241\332W\202|g\215\316\204\255\240\033\333\330E((\251nt"
+	.string	"m\270\246&)\305\210\030\276\234\224U\273\020\b\370 \036\242\201\257\341\320\230L\276;\3643\324\341\025\222\360\002\227\205i.\013e\213rY\230\346\262XZ\314\260\270"
+	.string	"\253\\\242\245a\"\005\2003\006\227\026\035d\231\026#\037\367\307\252g\370\t\275h\301)\307\222\374\207\240R\355r\357\342SU'w\f"
+	.string	"2\241\201h`\306\005"
+	.ascii	"\005\313*a\020D\016Uw\017\230u\t\253Y\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_runcamDeviceInit.33.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\006\002U\022"
+	.string	"\006#{G\260\230M:p\345\222\005-\032\264\037\266Apob\036hZ\023B\320\220\367\262\200r\006\0346{i`?B\003?\f\251\030\227\365k\326\246\260\036\260MP\343Y\341>\007\343\006\370\360I\346\003\334\310\332M\210\224)\005c"
+	.string	"a"
+	.string	"h"
+	.string	"\376VO\373I\277\301\216\373\271\200\335\332\020\"\273a\214\035\254\3569<\201xo\365\001\361\236av\224\207G\373&\031C@\256\354\356\2474\016\273\327i\302\374/\035\200l\006t\257\350\235\313,\226\332)`\242dG\200\331\212n\201\321\f!_z\262\230\te\252\"\354\256S6#\272\343mw\260\r\301N\234@\366\301h\347\374\007\270\332\335\031\237i\247\304\213T\215{\376O\274\027c\253\321\222\250\004e\316\016\205Rm\3665\227\313\345\2545\373\341\315:\356W\305t\347\245\265K\247\246\017\323"
+	.ascii	"\n\315\b\351H\235\204\353\"\247e\243<#6\036\376\366\277d\027"
+	.ascii	"\333\241O\2670\302%R\341\004\225te7|p/\266P\223\227\325\304{"
+	.ascii	"\252)l<h7\\\252}\341Ez`\264\211l\312@\372\031\242^CT\305\366"
+	.ascii	"\033\342w\237C|\220_m\017\037\362\262T\230\247\215a\020w\262"
+	.ascii	"Y\355\306f\374\246\021\255\325\025\264\351\240\335p9[\322\002"
+	.ascii	"J\355\023Yz\300\226\203\351I,\263\370%\277{\234h\273H\344e,\315"
+	.ascii	")E7\260H\211i8.\021: \r\317\013\334aE\267dnZ.\0247!Z\257\017"
+	.ascii	"t}:.\233\234\257\3652\361\311 0\270s\363\372x@\360\365\271\204"
+	.ascii	"A\357Vk\030\254D\005\251P\267\273\353\251\3156\203T\365\200\371"
+	.ascii	"\310\313|\342\305\236\b\007\020R\327\023S\023\330\224:\265a\267"
+	.ascii	"C\301\224\nH\331\022\236\204\346^WE6\245\332\351\207\266x\302"
+	.ascii	"\221P8\362\247\n\001$ P\0021\306\360\016\257\316\233B3\032X\310"
+	.ascii	"\025\221m\205]\3503\001\277\305\305\f\320$+\212\004\027\016)"
+	.ascii	"\304\313L\303\204\016\220\372\254\326_l2^\fd\262|\206\356-\304"
+	.ascii	"\0278\351b\017WVx\365\013\225q5a\321xh\033\332kyF\312\360ra\223"
+	.ascii	"\2274Wu\340="
+	.text
+	.section	.gnu.lto_runcamDeviceSimulateCameraButton.34.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`!\002u\023"
+	.string	"Ve\203I\300RN:\302\211)\204\020\314\246\344\232.\247\223\013\264}\021\"\214\n\312\223\276\236\\ab2\252R\002\344C\373\353\337\340\347;\031\350c\352\245\332\300 T\005I\026\352\240\002\202\341\022T\031\224Y\203\331J\310&{\313\224\002q"
+	.string	"e"
+	.string	"u"
+	.string	"\036OB\357\201\037\241\367l\033A\002\032\307>\016\351\034\204\021\355\004U\255c(\205\036;\370Qo\312\215\3715\007/\353\371\267\262\361\234N\023\031N\264\327\320\3203\013\340|z\340\254\307\3639OzT\320\020\261\331\314\021\034%\200\256\243\255\234\007n3vDl7\223\344\t(\307\221\2769\266\331\356\247Rk\365\326l\033n\220\333\306`{\201\275\016\002\3668[\231\263/w\273\335\316\022g\203\353\325\217~\320ko\256\347\267\226\337z\351\372!\367P\251\246\032\360\250UgWU\235\274\027$l\337W\272.\346I\226;6\210j\255\254\030\233u\3576\215\315\262=\367\243\314\003\324\031T\206\246Z\233P\034\356\332/\272\021\315\217f.\240V\234\216\246ZG\024\033"
+	.ascii	"\357\005_\031\202\273a\342\203lw\317q \222Q\026\352\023$\264"
+	.ascii	".v<\375x\003\366\344O:R\204\222\240\237[Q\355\344\240\364u\022"
+	.ascii	"V\3665\177\262\306T\035\246\222\246\314Y\244\253\353\334\372"
+	.ascii	"\n\021\364J\016\351|D\355\346$\317B/'(I\331\254\017\333\256\247"
+	.ascii	"`!\020e\277\276T\001\254\265*@\341\322\002 \252\326\372\020\367"
+	.ascii	"\374\031z\357RD\256\352ft$\333].\342\013f\005\346z\021A\250["
+	.ascii	")\256\326\353\202\213B\013\026\212\257\320\345\265\322\022\266"
+	.ascii	"`\026\302\224\022\213/.X\b#\212\260\2205\312>\253\304\231J1-"
+	.ascii	"1}\177\214\036\351\f\244X,1y~\214z2\307\266'\255\"\223\263Yk"
+	.ascii	"\255\240\314-\214\237\030P\037\311N\tJ\373\001\004\223\033Yc"
+	.ascii	")\247|\013\332\017\331e\350J)\217s\233\355\316\037\003' P\242"
+	.ascii	"A\210\365\357\363:\013}$\361d\035\307\333\212\274 \204\206Z\020"
+	.ascii	"\343\013\265K\2436N\351\254V\350\210\272Y,\221{\214\216!\361"
+	.ascii	"!\202\342.v\2065c\341\\^\006`\336\230\331\274\bc\252\322>\342"
+	.ascii	"\231\023\004\225\025\326\261\003\017h\033q\036'\243s\273\001"
+	.ascii	"\303\331/;\031\340="
+	.text
+	.section	.gnu.lto_runcamDeviceOpen5KeyOSDCableConnection.35.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"U\013"
+	.string	"v\225OD\020\3118\035\250G\343\373?\003"
+	.string	"G\200;h\376"
+	.string	"\330)s5\203\031\373\016o+\234"
+	.string	"\345\256\330\252B\210\032\261\321\036\235\007\271\215\022UUG\210Y\013I\266\312\034z\244\020\311\256ry"
+	.string	"=5\262wJ\0018"
+	.string	"?"
+	.string	":"
+	.string	"\253\3351\303\025\3333\217\207\320\236m\177\320\2369\264)|$\260w\020\201\205Akw+\035\360\3603\364_^#\232H\237\231\217\335\365\024M/7\275m\n\333 \3669\002W\3754\363\323\266,\210T\330my\271vB\366\300\300\311\337\376Ko\254\261\021\236\034m{ \323\240\200\004\326\356\352\342\231;\2669\242D4\354J\231\240~\332O]AxU\312\035vQ\031\002/o\023\243\365\323\345%\032\306\277\340%h\023\261\033\202F\251-:\231\027m\201\300\2650\224\344\177\244\235\374\204\200VL\352Bi\276\354\2214i"
+	.string	"\373\330\356\256)\312\376\370c\001\236\317\013u\300\356\363i8\217(\244\003\201\235\217F3\307\3518\317\244\033\341\300\372y\325\343uH*\007\202*G\302\337\247\003k\350\373\300\272\031\367\330R\224\263\323b`\225\250\212G\330."
+	.string	"\017\0269\003\020"
+	.string	"o\23173\264\327\030R\026\325`\202\352\034\345\377Y=\256\331v\270\fn\203\tM"
+	.ascii	"\315`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceClose5KeyOSDCableConnection.36.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"=\013"
+	.string	"v\325NC \2518\035\307\223f8\276\004\0220\340\321uW\325F[Yad"
+	.string	"\025b\223\254\244\\\036\310\013\0352\315t\351`\257~\251\006\b\373\001(\2660\326\2443F\273D\375j\001c\206r\374\023\022!{\247\0247"
+	.string	">"
+	.string	":"
+	.string	"\252\3351\303\025\3333\217\207\320\236m\177\320\2369\264W\037\r\354!P`q\320\332\335JO\017?C\377\3451\"I\364y\371\330]O\221\024\340\246\267Ma\033\304>GO\375\364\362\322\266,\210T\330my\271vB\026\001\301\311\337\376Kg\254\261\021\236\fm\233\340\362\340\300\212\265\253\272x\346\216m\216(\021\r\273R\242\352\247}\324\031\204O\245\334a\327\224!/o\023\243\365\023\300K4\214\277\301K\317&b\267\004\215R\033t2/\332b\201k\005P\221\347C\332\311O\234\024\f@]\030\315\227=\212&-`\037\333\33555\331\037\177,\234\317\373l\300\256\363a8\016(\244\363\200\233\016F3\247\3518\317\244\033\341\300\372y\225\343mH*\007z\252F\302_\247\003\353\347\373\300\232\031\367\330R\223\263\322b`\215\250\212C\330.\001\017\0269\003\020"
+	.string	"o\23173\264\327\030R\026\325`\202\352\034\345\377Y=\256\331v\270\fn\203\tM"
+	.ascii	"\315`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonPress.37.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"\035\f"
+	.string	"\266\326R@\020Q\225\016p\016\307\270c\305G[y\022\037l6\t\257fe\212x\333u\004\020\035p3\2645\344\037\351\237\003\254\201\220@\022\001\030\201\346\241\006\346\035)\005|t1\200w\335,\331{\357\224\002?"
+	.string	"B"
+	.string	">"
+	.string	"\017\200\235\332\263q<,\261\177\301\203\304\302\265\273U\232\356}\312\350\371\023\020\364\331\341r\026(\205\330\001"
+	.string	"\024M\0032Z\244\257\0363\200\243\030!\230\335u\374@\0167\275m\007\266\033\330\207\020\207<\205\bW\216\b5v5\274zl\213\302@a\373\024\333Su\341\006\003\031m\005\013\274\207\237WVD\303\004k\227eq}\264\177:\312{\n\303\200\312\216V\037k7\264\370@\344\324\341\005`\247\221\273\377\342\035\003\233\322\246\320\211\377\214`\306i=H\320?F\274\\H\177\260K\t+\033\243\370\341\207\277<a\322\001\002\365!\024_v\b\212\222\204\375\271\273kY\262\257\372\351S\377\244\321\001\331\246\302\003\255\323e8\222\r\267y2\235\306\341$\230\263\213\226m\026\264\tYW\271\255n\266\214\246f]\247^\b\230\343h]\365p\\W)\341\036\023\222\2429\211T\326\277\305\345\206k\260\004\377\212\253\340\"\033\025"
+	.ascii	"o\231'3 \f_,l\026\201\352\330\033Dh\020HQ\215\313\213X\376&|"
+	.ascii	"r\r\030\207\241A!\270l\253\021}F\013PQ\304]~\252\275)\232\332"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonRelease.38.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\315\b"
+	.string	"&\321=80\345(\035"
+	.string	"\21691\033e\001\203?\315\331Z\036S\006\230?j\300uE\222P\177\314\201\322\232\327\230\276 L\027\206\002$d\360W}M\220\"\252\226m\237\333J\231R+"
+	.string	"/"
+	.string	"*"
+	.string	"\234\013`\177\356\354\227G\220=\212\006\206\311kw\241~\274{v\376I\336A\251N\317\215\302\356:Q*\216[o\333\300v\202m\227\177\276\267\366\025\303 \263\233\n"
+	.string	"`[\236J\210\355{lg\2348\201O\373\"\037\351\356\242 \b\330\213\222\214\224\335\370\361\001\347\317\361\003\330_\251\n\237\367\n\246\033/a\b\367M\330\347\251v\204D\036\345dY\245V\333\241';\236R=\354kvw\255,\373\361\327\273\002\331\310\264\240\225\270\020\251\2039\003i\231\bBk\3108\270\211\340H\024r\200\031W\202\240\002o$\215\203\017\333\306AO\334kVY~\255\235\201\251P\013o\002\f"
+	.ascii	"o\231'\023\372\375\002'.@p\rh\205\241A!\270\f\214\bPQ\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getWaitingResponse.39.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\213\n\2655"
+	.string	"\372Z\024\024C`\350\325\030W2z|N}"
+	.string	"\020\240TDI``\243fsH\357\231T\024\037\330\235\3124\222\306\324\252\341\370\347N\346\275\313\316/\273\333\234\227:\343\202M\365k\231\230\021o\204\322\210\224R\312\224R\n6\001\027\001.\001Mn\271\267\270\375Z!y=\304\276\346\336\227\271\324)C`\335\231\333\254\263\340h\246\024\n|\253\216\350P{_f\023/`;5\200\366\225^\342`7"
+	.string	"3\214\353(\253\353\252\013\335\3732\207\314l#\265S\266\205j\247\257\204\213\334m"
+	.string	"GFEB\242 pH\350\347k{<vUS\364\335\345N\337\214na\266\246\032@\273u\364#2(H'n\324\206\374B)4\233x\221\025\327X\013\221\342,\313\214p\2115\021\02341\017F"
+	.string	"\203[\322\300nC\206\235-\361\241!-\204\n\2058\351t\033r\b\312D'JW\322\177d\355\353f\243V\330\234-\353\214p}u\333C\225\346\310\374\3516\244\027j\244\345\004\253\233]\316;`\204\313\253Y\224)\b\0307\335\206\f\202\n\337\246\034i\265>"
+	.ascii	"\005\351\345+\252$\0045b;\"\327n]\271\212RH\266\361\321mH0\264"
+	.ascii	"\331\216\310u\323\312\323\246\032k\364\265\2741\276\205\331\362"
+	.ascii	"\321\217>\230\003\313\"\264eD[\2556-]\246=k\253\312}\255\360"
+	.ascii	"\276/;\326\026Ws\200fn+\314l\201\231W\025?\006<\202\357\253A"
+	.ascii	"T~g\242\331\254\031\360\356\0169\246g\\\362\231\250\026\370\266"
+	.ascii	"\322\254S\345v\334O>\321h\210\354\373\276\020\270\327\372\f\n"
+	.ascii	"\356\261N\371\251\350\215UT;-\360f;\226I,fT~\307\3144\372+\231"
+	.ascii	"\033\302\361]\303\217\204yuvjbZ\235\227\332\331\254\244:3X\235"
+	.ascii	"\027\254\316\n|\316\t\372\331\234\244:#X\235\0134\263\033iu\036"
+	.ascii	"P$\354-\315D=\347`\353\fT\235\207Tg\241\236\363\257\347\354\343"
+	.ascii	"9\267\252sou\346\361\234Y\325y]\235U\3269U\235\321\325\371Wg"
+	.ascii	"W\235\333\201\3232\371%\346\365o\314W\353.\320\033'}\222\265"
+	.ascii	"\263\373\331\275\245\237\271\237\334e\210csi\2556\243\2710\203"
+	.ascii	"&Df0\267b\332\311\215\306m\030\0345\232\013\017\235\204\325\340"
+	.ascii	"\016S\343\345\352.\2574K\272\376\322g\314-\337h.L\300\t\222\344"
+	.ascii	"\362}\337\366\006\267\027n;\275\321]\\\364\r\302L\372\202[V\241"
+	.ascii	"\300v\2122\343\340\016-\364C\217\316\371\340S\274&\364)\0325"
+	.ascii	"f\277'}'\205\n\302\332\203\364\276\377\275*\310*it\243\264 )"
+	.ascii	"\33778\242)cv\2454 \"{\024\246<C\327\247M\362\336\267\317\354"
+	.ascii	"\226\271"
+	.string	"W\f\034\177\212\256\345}\357\017\357\033\034\327\312\274\216qJ\357\225i\332\211\354\342\212\360qc\275P\245\361\0168\372\351\257\317>\267\232\233\305\2027\026\257?\365G\037S\354\n5\301\247P\343\013\275g\205\036\027\030\270\307Z\250\235&\370Vk\017\323\n\304\031:O\213\"\270!\034\373<3\365W\r}\207\250~sYb\326v\240X\346\r\035\307\201M\177\300\332?\372\216v5\210;4\334\177\331\0343eh\0241V+\232\n\237\210\250\372\267\221f\035\017=\207X\302\177=\246\325\371\352\320\326\324W\362R\367G5\3370\177h7^k\033\021\242\277\233\355cct\177\246\2173P\372J^\335\252|IsnW}Ae\314'}\323g17\372\312g\307q\233\340\260\372\311\354Vi8!$\300u\332O\026\321oH<\200\353\324M\322\243w\260\0026d<\275\r\031\027^\304(F\25518\024[\260"
+	.string	"!\303E1*j\306\323\217\237\234\212O,h\024U<E\r\241X\f]\260@\321b\370\024\025c\350$\200\241^\024\243\2062\240\240\242\206-\223\212M\033\t\237\321#\341\267bU\256\322|\315\326E\237\3650\312\342\324\315Q\275\221\r"
+	.ascii	"\244\017\376\377i\266\251r;\227\003\206\025\345HJ\r~\343y\342"
+	.ascii	"E\244\202\235\244N\277\036?lE\214\204L\317(\332\364\302\317b"
+	.ascii	"k!\200\270\267\"|\334\342\032}\337\367-\n6[\277\2402\206H\351"
+	.ascii	"\231>\213\205N\037\342dv\307<\351d\021\016\346_J\013\236\201"
+	.ascii	"\t\357r!\013\210\0248\371\204\003!\262?\024|\243\005_I@\3553"
+	.ascii	"6\341=\270F\200\301y$\361\027\246u\327Du\351\235\276\357\030"
+	.ascii	"\335\274$\215vdSm\200Kg|\302ux\326\322\367Y\273\031\017$I,fC"
+	.ascii	"L.|\006>\267\222\212Z\335\\\325O1\301(\351\204\\1\025\030W\345"
+	.ascii	"vK<\207+6\002\370\353\361M\231\267K\2462\273M\374\350\222\215"
+	.ascii	"\230\320D.\271\354\003\306\356N\311\357\225HF9)\276\2417\362"
+	.ascii	"\232S\200\313\250a $\235c\212DDD$I\222tp\002\021)"
+	.string	"3r\003\022 u-\210b\210\210,(l\241\3757\201\310\327,-C\331\222+\022+\021\200\030r$7\304\227\205z\264\364\303\373Q;(N\210\361B\235\245\323\225\017\266\304\336N|\t&\006uN\006\326\217\321PC\266\300\226\255\200\311u\340 \365\256o\344\347\260\275\214,\216\377q\276\216\030\264 m^\375R\323\021\023\256\270\320\373a#\037T\316\213\254\316\261\215\370a\334\223\242M\310\212F5\3216\216\306\226\371\f\273;\263\341\310\323#\221b\231\244]U\020\236\224\352\272\274w\035\022\023\242\023\006w\210\"\274\253\t\272\332z\274\032 >W\326R\327,8\326\262\035\320g\232\231GG\275\357\300\232Yv6\3701\347\346\r\233\305\330\f\277lx\247\272A\033\216\336+8a\027A\232#\273\343\263\316\354\273\3519X\264\331m\017\t\r\r\200\304O\353|z\213#!I\337h\210c0pXh\036\005"
+	.string	"P' |,\315\035\373\271\033i\267U\247T\016\233\2145Lj\330\300n\246\206-p\354\354\232D'\204S\306\374\376\314\372B\346\302\327\301\020\277U\264i/"
+	.ascii	"\037\361\\\025\255\245\323\331\341Q\367\315l nJ\353\262\372\032"
+	.ascii	"\256z\254\231$\020\372`\021\026~\212Qs|'Bsm\232'\037\360\031"
+	.ascii	"\241DH\037\221eH\225\372!\213\002\357=N\335\337\311\037\"\026"
+	.ascii	"\251uz\2704\033\2122)\344u#\217#\021\353w\021\301\341\223L\347"
+	.ascii	"\030ZJ7\344\272L\263(r\0325"
+	.text
+	.section	.gnu.lto_rcdeviceReceive.40.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\371\020}V"
+	.string	"\312\221| N0R\322\031\016\2078Pi\025\032p\3215C\366\356/_aSD\207#\037\"\"h\025\355\305\315\234\261u'\251,/wg\t\347\252\202\216)\2029C\314\3546M^j\0326\307\340V#\272RY\021\023\021\021\301\r\r\332\264\311\2262\311\367\001\317\001\365\001oId^\233\232_\325\263|\313.qI\270\226\205zb\327T{\016{\2675"
+	.string	"\205\362m\"\034\271\236\253\017\f\352\346\324\374Z\250$\354\261,\361A\022~\305\004t\005\362\034\021$O-m\205\372`\237m\211\273\317\343\240\274\025\023\276z1\207+ \241\343[\327g"
+	.ascii	"\017\356\224\372\340>U\336\275\332\251(\277\206\302\016\327\265"
+	.ascii	"\254\212\227u}\016\260O\352\203\307\007\245\017\242\377I\037"
+	.ascii	"T\356\256\371\263\310\372-b\276\256\370\255\353*\325DvU\243]"
+	.ascii	"\364\350\201G\237_\343>\005\225wzjb\022\261tTJB:\2122*\"\032"
+	.ascii	"\022\n\002\372\361\351\341\331\3211\026\241\2109CU\230\006\321"
+	.ascii	"f\345^\250n\211F\313\017\256;\3351\273\260\235\303~,\371i\356"
+	.ascii	"M)\204\3441\241'\370\204T\371\035s\013J\364q\207\303\267\300"
+	.ascii	"\261\b8-\274\344\366#\372\003\003\0277T\2003M\310\356\326\306"
+	.ascii	"J"
+	.string	"I2\326\364\236j\177HT\312(\341#\2571\265G\241B1\346\231\3371\307\240)\372\330\220\035o\t\033Iy\321\022Q\331X\224\017\241$\322P#&,\204w\030D\304\372\312\306\244<HHU\346(\2244;\265\003%\341\037$\354s\204{\326\2140O\225\"\274\343\366\245\262\261*\327A\205=|,\371\035\263\211\246\200\303\007\346_\276t\306\f\302F!\325\2201!/\276K\310\241P\024wL\031\320\2343\246\030&\376\216\t\3673f\f\234\343@\235\037\334\207\352\317\230@X\210\036\311\330})\231\311\360\3673&\f\234\242QM\036X\320\371\361\205\006\225\251!\r\361\207\027\007\321\343\035\223\f=\256\353J\374\321\203Q4\001*iF\356v\026\373\301\003m+Y\344~\306\354\302}\266\243P\350\370\324\376\312\306\346\316B\252u]\227\301~\214}\003\370n\227\330\335\fvu0\b\302\026\266 D\224\373"
+	.string	"\007\346H0\231\246\273/\336&\231v\360J\020Q\2168\306\f>\230\211>\262\351"
+	.string	")//\004\t\246\362\202\215\244\247\006mb\034\020\177nB\314\342\320\245\221v#\331\364x0\234%b\356\335\0338\370`\335*f\340\321\\\273\013\301\365:\310;A\002\035\351\203\334(\214,\005?\243C]\327ujoF\331\254@MbB\372\340{\314\2228M*k]\034\330x?Xi\353v\356>\227\374\251;2E\266\315v\213\2748\212\2747l4\360\272o\r\032\277\37320CF\017o\214\036^+\225w\001\225\027F\017\357\213*\027-\212\274,\250V\2508\231o\212\313}\247\336\3665q+\337\022\367\362uj\"\362\222\330\341\035\301\303\313\264\303+B\207wI\310{,\362*\025y\223\212\274HE\336#!/"
+	.ascii	";\274F:\274E*/Q\221wH\345\025Ry\203\212\274@B\336\037#\257\217"
+	.ascii	"\220\267\247\310\313S\344\335\271\335W\247\310k,\362\026\205"
+	.ascii	"\274D#o\316\337\276C!\257Z\344\025\026y"
+	.string	"\323\034\336\340\220\027%\362v\016/\017y\037\001\n\276f\020$c\032\315s\365\021\030g\265\013\202ar\273\377\356'\363\327\375r\277\227\377\355o\373\255|\270\373\375\016\277\333\343-1N\3710\267\333\227Y\035\264.f\317\303{\230\341$M\035]\022]\201\254\235Fe\272\344\237\253\217\317Y\240>HfL\026\3252\205\025\345B'd\255\217\311\"z\256co\246\265\251\371=\270\023\314\311\225\240\327&C\r\263\217\323\272\227\247-h\304\370\264\366:h!\2206\247\346\327e\377\305\313\306\251\\L\025\356\r\214o]W+U\313\036.Aa\326\300\021j\321,\332E_\315\227\013K\016T\212\261h\276\022FV\300S4U\277\314I\260aaC\203\305\311rL[_P3\213D^\002\307\036ByCJ\233\362\316\364\344\300\332t1\231Ur\237\244\247\372sG\341\350u\t#\213\332C\003t\344\311T\251u"
+	.string	"_@\225\372)\2569\214L\016?\201O\246Im,c\201\223\372\210\216\323\025\316\330\370\264\023\251{\b\217Y%\325#5\221\23102\23706\177=\311\364\250\177f\225<jTM\030\231X\026"
+	.string	"-\304\302\005E\fgq<<L\234T\331\203b\346\310\016jl\352\241\321\023VA\211vT\344\r\254MQ\033\365\207]\004#H\236\020_a\226:\355\334\035-\305\025}\275/K\240\002\270S\207\375\313\207j\276\254\025U\364\341>4\363\245\tu7o\3520\247&j^\302V7\324D}\260\344P\023`\344Os\312\320g\024\340N\275\242\357\227'\307\304A-\324\273\312)J*|0\025}\354\321\\\333\324B\375/@\240\016\352\246{\234\t\222@\37502\237\356\351\237\276S\373\264\320\f{e\365\364\277|"
+	.string	"(W\376\332\254\013\215\206b;\367\007*\313\363\002\325f<\314#\311\323B\257\034\242,\240\23078\304v\356N\033\033\251\254\302];M\274\022\370\267f\354\335\027\274&\201\212\034\254\315\203x\261\215\335@x5\227\034\b\230,v\260\007`\2245\023\275\217\303A\362(o\237\225>x\302\b\220\234V\233\330\375\346\345d\311\201\233vN\243o_\200,\016'K\355\340\020b\370\r\2304v99,4\327.K7\214\026\264 \206\033\027\024\334\036\210\220)S\357\346\3026\356\241_\353\002\205M\310\345\"\244&\272\330\206m\217\007\303\371\276\321\r\231!m\347\376\311T\330/sq \222\001\037`y\320\310-\020z\013\253\203+\rl\350\330\201\204q\205\2742\346\370\025\362\252\257>\302\326U\217\260\345\002\004-,\244P\013\002,\0359\036\330\372"
+	.string	"\013\211L^\031\367\212"
+	.ascii	"\254\253\034!`mp\205\224\332\221C\352\203\034\032\350\220\272"
+	.ascii	"BjI\021P\264;@\300BJm\355\330\201\224\">\273\336fA\271\347\037"
+	.ascii	"_W/\2218\371\360\022\335P\330\366L0\211\336U\306\240\024\302"
+	.ascii	"\007+\321\307\022\274\253\244AY\003\037\214D\237\355C*S\354\376"
+	.ascii	"\370\226\315\265?\272\256\353\372\324N\271\246v\"\245N\236\""
+	.ascii	"e\002!=\340\350\264\244\261\b\332\215\306\321W\263\304\303\322"
+	.ascii	"\\\236@R\245\006\246\033})\337\262J\"\374$\251r\023v\2424\262"
+	.ascii	"\253D\242T\302\007{p\257T\222>x\243\277\345\274&f\326\244\262"
+	.ascii	"\246@\2223C\210\030\241g\203\022mD\013\275\344\226\332\311%z"
+	.ascii	"\231z\357\214{\376\361\361h\256\2719#x\307v\356\225MR\246\275"
+	.ascii	"\033X\211\262\tS\013\275\342\376\224\224h\351\021%Z\222\333\241"
+	.ascii	"v\350\342\367\346\004_\2265IG-ZGD\221$5`m\226Z\304T\353\364\322"
+	.ascii	"\023,plh\262\204Y\"EU\365V\337\032\320\335\274\205\032\247\017"
+	.ascii	".\252\001\364\311\264F\207\275\314\2076\364\325EQ\365\242@\307"
+	.ascii	"N\321a5\032\311\266\307-\274F7\320kih\274\232\313\036M\346\216"
+	.ascii	"\242\332l\207c\212h\f\325\372\326\004\251a\213\026\331P\337\364"
+	.ascii	"\325\005\271\350\252\016\263\n2\205m\217\210\t\332\017F\355\\"
+	.ascii	"\255!D3\372N\334\210\r\311h\033;"
+	.ascii	"\201\201\201\201\177J\031h\032}\2624!\274\232\313\242v>\245U"
+	.ascii	"=\243\017\320\301+\316\262\210\007\370\206(F\313hV\363\005xA"
+	.ascii	"j\3251\372_.,\320V\215\306}\001\np\030\275@\337+NU\303\350\021"
+	.ascii	"\242d\371\002T\371\370\274\206.H_\360P\325/\372xG\301\244\005"
+	.ascii	"~\001v\005\201X\250q \005\031d\246FDDa\222$\255\001\021\005\304"
+	.ascii	" )%5\017\021 5T\022\315HR\22062\215\217\271}\225J\325\347\332"
+	.ascii	"$\216\201\037qYK\231\300\300\3148'\221\203\261rk\364hS;d\271"
+	.ascii	"\376\333NQ\322\234=w\013\021Q9Y\235\271~\260\340\212\335\200"
+	.ascii	"ImN\215\252\030a\264\334\357m}$\003\005\327\203\255TLM#@\353"
+	.ascii	"\366\361W\031\326}\226Uo8t\231\241\331\236\334\266c\240\256\r"
+	.ascii	"\364\247\201\021[\211)M\027\221\201\301\222\230\206\246\205\326"
+	.ascii	"\375#1\330\320\312\317\037\004Y9A\033<\231\341\322\2247\005\225"
+	.ascii	"\206\017\271\034\031\346R\201Z[\274b\236wP\266\240\341\341\005"
+	.ascii	" i\221\316\320h\335"
+	.string	"\324Fe\260\013x\020\227\200\336\201\27222P;\204\240\2741\213\247T4?-6\016\305\317\3542\003\222\350\211h4$x;\273%\035\016\020\0336\013\017u\244\226\352\300%\331lA\266\023\241\327\302\356+E}\216e\310W\267\360\017\034F\220\257\376*\225\355j\365\204[\203\035\007\225\367\374\366\233\326\247\362\2742\376z\256yT\265\217\364\304%\217JL=\217%\274\337\235\275!H\243Ah\022\367\n\252\r\200B\202frq\321\341\222.?\f3\247\326%\277 2z\220UZ\034\23717!\337\r\251l\207\265G\245\3758v8+\001\270\324\317\241i\275\357\207iU\346\026\025\324\n|\306\205}l\333\315\320'\314ef\221\363\024\007\324\354\221>.\027\332\350\305`r\307\336G\241#\223\277j\327\232\342\212\232\021\036\372\252\315\226\363JG\376|T\3250\206\t\b:lL7\202\371\255\020fa\300\211"
+	.ascii	"K\245\217`\237k\250t\232\343n\t\314\311 \221:\201\204\2115\271"
+	.ascii	"&v\341\377I\210~\220\227o\365C\246\303\242 l\203%\321\316\312"
+	.ascii	"Q\3662\332N\363\030\354MP4;\2550a\232\314\321\016\027'\276\265"
+	.ascii	"?x\202\321\270\354\376\342}\267\004jx\023\344\246\264\334\314"
+	.ascii	"qk\027\262\304\t-\025\262\306M\n\365xoH\340\004\373\336\362\347"
+	.ascii	"\333\003\n\334\"\271@\206!\222\344\3111Tn\220RbtO*\314\340\265"
+	.ascii	"\304\234\234\335Z=\363\226\t\233\\i\340p#s\352s\233\003E\207"
+	.ascii	" `\034-a|\004\327yn5\223\3421\013\315\327v\277\243\304\257W\026"
+	.ascii	"B2[\304\310L{\245D\364\324*\035j\027t\277E\324s\033\374\267\037"
+	.ascii	"\241\01680a\3340\277\262\241\201\251D.\317M\215)6\307\017Cb5"
+	.text
+	.section	.gnu.lto_rcdeviceRespCtxQueuePush.part.0.57.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\307\001M\020"
+	.string	"\346\235iG\360\316(\035\362\204(\314\264\030w\277\301\312\265f\307\036\001\261\225\363\234\222\030\222\263\0137\241\317\242i\001\245\342w\333\001~F\226w(r\t^My8\273\277\316:\226a\203\1772\311\231\267\033\177\204X\262\267\334)\005R"
+	.string	"V"
+	.string	"S"
+	.string	"\353B\203\365\354\206\007>]\240\373tx\016\356\263\373\006\367i?\204I \254\230m\223@Zv=\234\301\204Z`/:A\273\241\367\251\033\356\272F\351\362\343KF\341z\333?>\374hxa\223]x\024p\0312\355\256;\f\367\274\355\004\266Mv4\005\321:\243\343\303\377\031\037\035"
+	.ascii	"\314\354\302\334`l\206\351\343\341;\267\257\303\362m\026\355"
+	.ascii	"\260\034\363I\274\326z\t\377x\270\204+#\305\250\020\021\264\273"
+	.ascii	"\006>]\352>=\3447\270\226-\262\214\247\345\254d\316j\305H\343"
+	.ascii	"CV\270\026b\326h\377\3468\255\217X\031\020 \240F\351A\314\355"
+	.ascii	"\005t\237\024\021\337\306_q\237\266U\336#\3021\333]\0046\352"
+	.ascii	"<\0214f\237\222\005L&\252\352_b\330#?\001v\273[\362ML0\361m>"
+	.ascii	"\375\025\3563\352m\217 *\270\230\271\301a\211\267\2505Vy\271"
+	.ascii	"Jc;z\236\366K.*\220\201\004TH\203\325G\222\241r\242\240D\365"
+	.ascii	"\245B\037\312\207b2}\032}'T\312\007\341\224\362@\224G\202\n\031"
+	.ascii	"\361N)\2257\"`\260\344Ky' \230\362D\227\2534\276\355\013Zp\250"
+	.ascii	"\361\304\337\305M\205\331\236j\023\213\266XUk\334\301\245p S"
+	.ascii	"{\001\375\035\234\375\035E* \200\202!\313m\003\0202\306T2\270"
+	.ascii	".\r\241\220\300E\0013</\224gl\211_P+Y^3\340\345K\254\031\271"
+	.ascii	"m\221<\217p\307 \322F\221\350\240`\2348\355\372\306\001\321\202"
+	.ascii	"\260g`\223\375\022\337\245\351\020\310\322f\023\377f\026Mn.\b"
+	.ascii	"\255\001\212\303\250\007\2220p\351\376k\337\030"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.part.0.58.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`N\001=\r"
+	.string	"\346\026SA"
+	.string	"S\234\016\240\ri\237\002\n@5U\342\235\201%M\246\227\317\236\325Z\366eX\336#\214\016\261Pt\374-\351\273"
+	.string	"4\004UUU\005\200\244O\370 \230*\3271\3069\016\212\370\326v\267\275S\n;"
+	.string	"B"
+	.string	"C"
+	.string	"\330\251\305\007\250\247\330K\352\251\375\026\266= \203\366\216\213(\366\nul8\251v7;\235'\016~J\013\364/|\202x"
+	.string	"qIr\353\272\354\256\261\0207\275\355\004\266\025\330\277\021\333a\374\261$hj\305M\267\377\302\343\237L\261}S\351\223\225\322\367\325"
+	.string	"\232p\b}\360\330\025+\247>\200\235R,\345E\217\270\037@\226\322\376\350$\360.:\002F6Ci\004jWDpj\003\001\266\203\323\310"
+	.string	"p\367\031\021BdT\320|\365tRb%\352aKx\214\217"
+	.ascii	"\216\335]\340\303\2600\301Oq\352w\352\251\234?]\252\020\221#"
+	.ascii	"4\"}\344(g\350iY;M\334\362\342\377\253\300(\022\332\233\306q"
+	.ascii	"6L\245\260\321\2465\313\246q\234\r\243yY\307e\0178\006\231L\363"
+	.ascii	"4\231e\200;\b\233\227m\272\316\313(\277|&\006\3179\303o\325\326"
+	.ascii	"nc\243\251Qt\235\253v\203\243\270\032\027\213\225\352\231\032"
+	.ascii	"& \200\202!B\333\001n\005\360\2713#\330H(\335\316HX\270\321\001"
+	.ascii	"\270\204\206\301\227\222\210n \353)\265\003\335\016T\236=\333"
+	.ascii	"\002y\035\341\037\246\230a\341\330h\266\"\312\356\220\204\371"
+	.ascii	"\002\205\251\321\334E2\275f\251\315\264[`\344\274\262,H\274\346"
+	.ascii	"\350\233~B\037\003"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.part.0.64.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\342\005\255\""
+	.string	"V\274\322F\200^Q:\223\341\207t\236H@J\350\026;\312\356\275\234\017\"\211\034\344h\364\360\360\302\207\013\256\330\242\357\256\200 \360\245\034\314\260\306\364\007\316UH\246\026\302\351\0320UO\351\030\267B=\2455\322\b!{'\031\267"
+	.string	"\264"
+	.string	"\302"
+	.string	"%\311\367\342\361\273\334\313\2770\332\305\343\342o1\005\013\274o\235\353]\214rYz?\005i<\254"
+	.ascii	"\211\211\330\302\264\240'\240}ttD\301p\276\244`\341^\013\323"
+	.ascii	"\331Qf]L"
+	.string	"v\210u\247C/9\302\311\265>\345\245=\025\344Z\231\237u\342\275V\223\220\200\376m\021!\323\235Jx\311\016\316\227\234\336\200\371\362<\001\363%\363\26303/\310\227\371\316\323a\317\254\300\240\270\310\272\333\366\322Z\375\276$m5/\277\367\262&\005\344d\005J\375\270%!\b\325\374\b \345#\r\274Q\022v\260W\036R\277Z\007\334\234i\350n>\251\316\2633s\0213/1\233\265|68\224\370N^\362\233\314\227\325\276\370:D\030&\314\":\325\262j\253\330\232'\333.a&+\243\264\3125\2622\r\255|\242\225ghe\023\255\\\326*\223\264\312\226\254\\\237\376O\360 *H\330\335\243\354O\037)\213P\356\345\357\362{\375_\257A4\234#[H:\234\272\220\225b\221\365/\035\332qN(\035N\325\250\276<\375!\353Nm/g\314\347\2339\0303\3124nd\353\343\317Uw\323`"
+	.ascii	"S\366\\\315\364\214\355nd\232\361\210\362\303\034\f\277\370\305"
+	.ascii	";\031\245*\224v/(\346c\356\311(\245\200Z#\326\035<q\276<\373"
+	.ascii	"\355\305\214>D<@\252S\312\0300\317\314\232\366\264f\230'\241"
+	.ascii	"\257\017\331\314\236\213\016\261Ae\276U\256\225z\240i#\3648\343"
+	.ascii	"\306g{\\Z\346{\345\305\233\305\332\311\372\361j\351)-\252g\254"
+	.ascii	"\017\261\334@3\216]\035I\313\334\341E.C\256\001\346\261\226\264"
+	.ascii	"\207\n\304\036~\347\303\331\375#\342\207\335N\b\021$H\230/\255"
+	.ascii	"\005`<\366!\276\354L&s\211\027\231f\306\343\325\221?\247H\301"
+	.ascii	"\234n\247\003\371q.\307\004\212\242z`\221\251\342\305\025\007"
+	.ascii	"\2067\262\312\200T\003\352\373\234\306\034\372\215/6\025\030"
+	.ascii	"v\367\201\314,Z\004a\271y\262=\016\252\3252\337p\365@^\360\263"
+	.ascii	"=f6z\233\245\263\273\211\002\034\303\b\311FR\007\334nF\016i\207"
+	.ascii	"\323\241\346RnD\200]\322\021\207\030FG p:\245$\0278\030A6\222"
+	.ascii	"n\226o\023p\267\243\032\270\0277\235-wd\233q\344B\206\355\246"
+	.ascii	"\333\331& \340\034\022NgK\312\345t6\364\032\234\254\257T\"\273"
+	.ascii	"\223d\370\327/\246%P\230W\333$LT_v.c\242@n\220\034\266W\243P"
+	.ascii	"\002\200\206\220\025\352yc\335q\253\020\030q#\304\322\001v\211"
+	.ascii	"\334\"\245\355\261}\375\032{\203\304\332*\256\275\327\354\261"
+	.ascii	"l\325\371U?|0\276Fj\016\246\352\253\277\213\344*\271U\267\312"
+	.ascii	"|Y\263ZQT\204Y\327\212\017\331\221f\213Kp\002\321,\315\007\237"
+	.ascii	"+\304\313\3446a0\354v\272O^\274P\036\f}\250\2214\306\020CJFH"
+	.ascii	"\202\302\202$I\007p\002\021CG\364\022\340\226A*\221P\205\205"
+	.ascii	"\031\366\357\214c\242\b\303\302\230w\216\252\352\232a%\020A\234"
+	.ascii	"A\334\\\034\321\264\345\263\2154\222>\364\033\355\304\t\225V"
+	.ascii	"|\004\261\017\2176e\215\021]\250l'\204Q\262\305\332m}\374\215"
+	.ascii	"S\376T\260b}x\034%a\373zv\210\350\255/^\bI\327\226M\027E\313"
+	.ascii	"\023(\323\206Jn\333\222\231\240\366\370\360\346\005o\222^\327"
+	.ascii	"\364u\262l\337\004wA\021\365\003U\207c\204{\314LwQV>$\256\245"
+	.ascii	"+\307\274\315\335\222\344\013&\3242\240\016\t\363K\206\352\177"
+	.ascii	"\006\237\002\340\3570i3\375}\246\225\346,\342\201\036\233\021"
+	.ascii	"e\025\227\340\016g\b\372)\235\034\205\303\004\261Q\320\221jB"
+	.ascii	"\240\345\rV\232\267\271`\272\3272_\270\"\347L3\024!\334\272\336"
+	.ascii	"\203\354\256)5mO\306\334' <\272L\223\233\266L_;\370\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSendPacket.part.0.65.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`\271\003\365\030"
+	.string	"\006\354\231F\300\032'\035\222@\024\323%`\241\220o\253\266\240\324\307\006\\\213\202D\250T=\n\331\253-*S\210\376G\322\262X[\263\215L\313\246=TW@Fa\234\345\304|z\271\367\243\263V\2454F3b\311&[\246\024}"
+	.string	"\177"
+	.string	"\210"
+	.string	"\024*\204\177B\3439+$\006GK\365c\355N~X\343\352\270Y\325~\223\033\205w\362s\235\335!e\226vG\t\237~"
+	.string	"~z|\201\357\023\374\200\357\323>\023\333\265\233C\373\314\307\334\246\204@\331@Z\263\273\255OY\344\341\247'\365\013}\240O\021\327\343\236\2128\036\227\336\0021`\224"
+	.ascii	"\300\331\274\006>\200(]w\275\201\023R\025\360/\245aw\r\026\335"
+	.ascii	"\251\333Na\273\204\355=\352\325T\253<5x\245?u(\377\347\251\347"
+	.ascii	"\217~o\252eJ\255\037\377\263\004D\200\332\315\021\005\265?\246"
+	.ascii	"\016\311\231n\277J\315\327\371\206\251\366%\037e\215\273\343"
+	.ascii	"v+\277\022~\311\347KtSE\031\272\201f\367\026\341\323\"\300\317"
+	.ascii	"o\316\215Rm\\\334\315\236\224O\t\237\344&/gmB\252,\355\356\006"
+	.ascii	"\360s\307\233z(H\264\211Dc\345\254\355\350\310\005O\177d\n\025"
+	.ascii	"j\343\346\360\324\016KvDW\\\030\034\\\244$b\233\366}\222\305"
+	.ascii	"\343\351\210\214M\331XG\247\334\361\344\224\020\224l\264\321"
+	.ascii	"\321S\271\233\276c\271N\005\350z\351EkR\222\335\220\004\262\224"
+	.ascii	"6\354\013\215@\216\313\275\320p\200\341\263\313\013\0059{\371"
+	.ascii	">\245"
+	.string	"$\221S#\026\251\264]\\G\303\311\231\021\323\370Zb\004p\022m\2367\2750\340\264\273\026\262\324\210\371F>\375\237\357S\345u\367\214rObQ\220F\251$b\371\335[9\304\006\003-h+d\017\f\004\216K\206\253C\3145s\301P\261\350q\305b\262W\352\363k\002\354\3053\003\306\3425k\311xZ=<\256X\3535\363iM@`\031\f\330\254%C&\233\265nl\3535\004I\241\351\343\355\006\311\200\346\211F\331\201\202R%W\322\016\227\204L\210$P\223?\311\300\335\265\260\222:\306(H\243\274\263\201\203^T\311'\371\261@=|\320\213\240\\}\331\331$\220\023\200!Fl\331\035P\225\f\234L\234`\332\ry\0044%?\211\"\005NRT\250\2010\307\2302\301L\005#\"\263\244I\007p\002\031\273\261\016\021\240=T\265\245\255\031A\350\332\356\344E\336\303L\247m\374H\304\"\364"
+	.ascii	"\361\242\243\275l\363s\320\325\341\024\340\2602\360\213\b\233"
+	.ascii	"\210Q\326(*\265BG\327f\217\300\362\016\200\375E\"?\n~1\035\342"
+	.ascii	"\264\217%\217\261;9\3723\334\002\tiHt\332\242a\221\031\232\270"
+	.ascii	"9G\243H\340N\226\302\027\342\352\177\b}f\262\374_\024\024\375"
+	.ascii	"\335\023x\324\027\253s=lY3t\351\025\354\314\261\"\243\244n\256"
+	.ascii	"O\356\356~\226\225\334\241\335\310\324\355\004B\223\332b\226"
+	.ascii	"\024\303h@\372j<\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`G\004\225\023"
+	.string	"6\236tI\300XQ\007\340p\t\024g\261KY\270\210@5;\033G\002\212\346\005\020\346\025\225\274k\023\260\016\330\260\255#\333fST\200\352*0\235\0218k\013\027\340\034\223xhRK\247\"\340h\355c!\216\214n\264\225$\311\224\002a"
+	.string	"d"
+	.string	"\\"
+	.string	"\033\036\247\366\2629^\037\376\373\375~?\037\323\311\335&>o@\303\303f\206\025\345.[|90\274\315\274\360\034$\347_\223o1\026\265\220\200:s\343n\205\030J\3419)\2117{W\317\367\300P\367\336\313\363<"
+	.string	"\210$\301A\373\033\360\216\343Eb~\346\"1\232f\304\005\313\316\267&3\323\237\324S\270\032\352\266\324M\352\341\330\324m=\2178E!r\224\257\310N\ti\261B\323\3368\031\366Z\373\220%\271\241\031v\027Ok\361\007X<\202\025\377@\305\357\244x\035\024?\341\304K0\361\021J<\004\022\277`\304+\020\361\016B<\203\276\3672\277@|\203\35691\372\3609\036\276@\207'\300\341g\001vl\317\315\270\325\320{\264/\276\352\265\353\007\224'\325\272\252lF\202\344\304\233\326C\262\271\224\262\273\022\263^\311\032\353\265\226u\031[o\262}6\325A\262\347P\017\006\023WuP\310\200\352\240\357\246z\n\367\252\236\"a\325S>\232\352\266\346)F\200\020\321"
+	.ascii	"\356\323\250"
+	.string	"K\035\250\025\374bG3\023\323Q\223\210\n*C\321\203H\261\311\261\207n&\372\322\rR\311\214\350@\355MUJ%\031\321e1n\353\346\242\373)Y\326\312\np\260\354.\252\301\033\033\306{\327\374d#KYa\034\354u\313\320q;zQy3\311T8*g\321\350\231\264T\364\024\242\302]O*B<:\364K\250\201\220A!44\022$\245)-\016\340\002\031\"\242\007\021\320\214\207\0202\"\0233\201\320\314\003\250V\223Q\221\336\247-\374\273?\225\2356\310Z\232V\226\033\021\373\305\256\\\2321\252\231\315*\323\260\033\320\252\225\030\030\333\213\2341\3571\002:1H1L\375QM 5Q\320\005\251Q\242\327\177Zo1\001a\354H\236Q\204\n\326\341\300\016`j3\206=br-+\374\026B\004\033dU\331n\007\272\0357.\n\221\235\036\b\024\321\204\313\004\325\234|\347}\330\206\003\3343"
+	.ascii	"\323"
+	.text
+	.section	.gnu.lto_.refs.646aa49399299041,"e",@progbits
+	.string	"(\265/\375 \204\025\003"
+	.string	"B\210\027 \220'Ic\360\314\314\314Lwfff>\210\216\265\3761\177E\374\2505\333\232\334\2555\262I\n\217\230\031b\346\207%8\253\006\230\r\243\f{a+\314L\230\211\260\215\321\263\315\002 \013\204\236\332\324\345<\0305\330\211r)\237\203\022\306\202\321\201-P\320\245N\352\243.\0162\352\016\001"
+	.text
+	.section	.gnu.lto_.decls.646aa49399299041,"e",@progbits
+	.string	"(\265/\375`6=\265\372"
+	.string	":u\331RW LI9\351\256\272\276\377\256\357\326\375u\337\375\377\177}\367\347\316DFO][\373\377W\325\335\354\376\376\334\336\306v\027"
+	.ascii	"\377\3641\265\212\214\236Z!\266E\323\351e\354\323\f\023h\367"
+	.ascii	"S\221\233;Z\324J\320\253j\277-\251\255\177\211!\312\334\217t"
+	.ascii	"#{\313\235\002m\004!\0057\005\027\274\374\035\251\361h\334N8"
+	.ascii	"\034\206GJ\317\032k\004\206\222]\343\007`\240\024\333\270y\211"
+	.ascii	"q\346t\345\227\366R\303\350\031lPK\340z\251iX4\232\3453\037\271"
+	.ascii	"\204\3155\315\r\326h&\373\354\245V:~\346\374\301\0077.Ne\204"
+	.ascii	"FC\374{\226\376\ni\0311P\254\242\276\232:\306u\221\376\262H\221"
+	.ascii	"h\246\200EQ6\322\373h\253\212\n\256q\033\335\240@\234EdhI\213"
+	.ascii	"\030\261mFaU~pM\232\234oLn8\225\340\250\241\206\037\221.+\346"
+	.ascii	"\342n\207u\373q\244\330\276#wE~Q\214\374p\002\355`\022P\213\""
+	.ascii	"c\347Sqg\245g\347h\2306\231\t\265\344,\341\267ot6\352\n\255\235"
+	.ascii	"\305CA\305\321\313\320\035\223%b\013\255\026Kx\237N\027#PX\026"
+	.ascii	"\356\267y{v\356~\035\245F\302h\370\345\374T6\213\016j\027=\324"
+	.ascii	"D]\324@\275\354\026\315\354\334+Z\310ni\025\366i\013\355\225"
+	.ascii	"[,6\313o\23693s\316\267\\?\216-\264~\226\312\375:\312L)%\001"
+	.ascii	"\202\350\222\300\r\346\374\374\340\346\003\0320\035E\317\016"
+	.ascii	"f\266\004\331\222\205,\035f\333a\370\272\036\222\376v\320\n\331"
+	.ascii	"\227\224\275'\356QC\032V\025+\370\3147\303\256;\034rU\351\033"
+	.ascii	"\352\317\002\326X)\n\304S\372K\262Sd\264^\030]5~\007Y\276c\260"
+	.ascii	"\346\314]\312`\222F\230\336\006\246\2675\244\267r\251\315Z\n"
+	.ascii	"\005ub\201\3615\266N\354\235}j`\237\\%X]\215\314\226!wNe\351"
+	.ascii	"\255\006C[h5H7\260Y\351\355TzK#\265qV\316>=\330%\267I,\334_\230"
+	.ascii	"\317,\366\202G\305\006Y\343\333\243\364\326\303\260\306z\030"
+	.ascii	"\336\002\245\033\330\016Cl9\fG\250\263\035\326,\233\032\016j"
+	.ascii	"k\303\321\3700\254]m\350\204H\036kl\325jv\240\331E5\266d\026"
+	.ascii	"\255\020m\356\255\261"
+	.string	"-\263G\354\323\003\213\344\326\314\236\035]>\3633\347gM[\021\226\2055\266\261\035\206MLo=\030\336\302B\353\301\360\202\347\213\201\253\202j\322\370\033HO\201\364O\313ah\303\322\031RK\276\306\307Io\237\026\354\267C,\227\375\272BD\315L\226\363s\003\f\341U\223\301\306_?\t >E&g\256\234s\0063N^\350\345\306\377\275n\3012\203xM\372N\257\366\264\035\206\251\3450\\\335\376\366i\373\233\207\355\357\023k\177\023\325\376\006\001\216Y\241\225A\004I\030\032\255\315\002\025\360_\275\232\377BQ\262\240\371/\005c@=\243\310\fm\302\217A\300\003\303\t~\233\342\267@6-\3667\330C\370\261\007O\177L\"\203\307\374\030\003\034\204\300\017\370-\224\356*\264\340\307 f\364\020\221\337\216\365\013\256\254\033\340\307 \374\r3\344\2674\376\026\362\333\030\177\247\320AN\301\217\007\360\333\021,"
+	.string	"\376\007\200\204\337j\020\370\003\374\375\343Z\375\355"
+	.string	"\037\235\325<~\233\302m\376\333\201U\375\313\177\251~\273\245u\330)\275D\3766\206\277\253\376\356\371\255\013P\277\225\341\2670\374\226\004\277\365\371\233\304\323o\215\277M\242\370\355\317o;h\247\337\036\377\026\321\374m]\337\370\007\3767\375\266\357\267\205\217\300\217/h\022\226\376>\201\306o?\334\203\317\3747,\307o\255~\273\343?\376q"
+	.string	"\376V\372;\351o\242\277\227\177\377\374M\202\277{\376F\361w\211\277C\360\367\013\177g\340\357\007\374\255\200\277K\370;\204\277\021\360\267\007\177s\360\367"
+	.ascii	"\376\006\300\337\035\376\346\360w\315\3373\177\307\374\375\337"
+	.ascii	"Z\371\255\340o\003\177\013\370[\277\337\342\375\326\356\267L"
+	.ascii	"~[\366\333\253\337\316\3756\204\377g\277U\361[\020\277\225\373"
+	.ascii	"?\345? \333o\225\374\366\355?\317oE\360\377\205\337\266\375\326"
+	.ascii	"\003\277\005\301o\323~{\366?\203\337V\360[\365\277\226\337Z\360"
+	.ascii	"\333\023\277\235\341\2676\277=\362[\255\337:\177\213\365\333"
+	.ascii	"\250\337\332\370-\323ok\374'\361\333\245\337\032\375\326\305"
+	.ascii	"o\213~K\364\333\241\337\266\370-\213\337\n\375v\305o\033\360"
+	.ascii	"[\006\374v\001\277=\341\267\033\376{\340\377\222\377\025\024"
+	.ascii	"\026\026\026\376//\374/u\377\007\200\001Y\311\274Rn8\312OJ!\261"
+	.ascii	"\2347d&S\271B3o\020\022\313H9\310\t\222\315\317'ef6\363\206\314"
+	.ascii	"\314\313\r\204\230OHBbK\244\rBbOHY\354)\333d\346\362\210\005"
+	.ascii	"3\037m\310bO\177Y\254\211d#$\326D\022\022{\332a\203\260\330\202"
+	.ascii	"\361\202\357\211\224\234]\023bf\027EL\313#\233:\241g3\347\345"
+	.ascii	"l\311T\344\243\016rfj\036\345-gX5\240:\027@f\313&\006E@P\315"
+	.ascii	"\314\254\023\322j\346\254\005\204\"\027\231\240|\326\345\034"
+	.ascii	"\266N\031\305\224\211T\344\f\200\242\234\2256\327\345\234\225"
+	.ascii	"9g\227#\246g\316K6B\316\242\242\234\225n\2122\223rME\316M\266"
+	.ascii	"\247\206$$\006\325\304Y\033\023s\346\025O\245u\346\274\247\243"
+	.ascii	"TL\371\225\211\250\244N\244$\300\264\333\347M\273"
+	.string	"+Xxfe\315\331\332\324\322`>R\002!\335\0026\345\307\023\355lfG\026\030\220\331\215u\341\244\2150\b\222#/K\214\234=\033\227=\2314,\350\244\300L\245c\267\310\r\273`\327\310\025\263\317Kv\275~\237\326\355\030\316j\271D\200\372\374\356\217\257,\316- X.\331\355\232\342w\203\b\271\273\342$\273C\036\240\354\301\005$\246\217\312\006\034\r\376K\225T\346\345.\375K\222\364rY1#9\2624\376\213W\372\227\035\351_j\244'{a\246W\353\340C\353\r\211\357\257\361\355q\263\354\363j=\317\304H\251\221-\033\247p\371\033\217\363\265\362k+\316\211U\023\346\244E\220\306\277XW#\310\231\f\317`\021\204H\343\0357\027x\022\252j\374\224.}\t\375\304\022\322\334\234\233\344\252\256\016\373\274V\027\307\023\204\325\315a\305cji\310tJ\2522\304O\267\322\247/\322;\205\363K\305"
+	.string	"\253(!\215\357\225\222QC\224!\215\241\356\223}\336\250\353t\303u\243\273h\224\033r\216\"\342\274Q\267\331]\031"
+	.ascii	"\tu\2630\211\022\006\n\323\233\033\342\273HI\357\222\227\336"
+	.ascii	"\345IS\313\t\236\215\331h\271\013\034\211\362\305\344a\346\n"
+	.ascii	"\036\020\220\0324>L!\022\203{\321t\\Jw\306]\2722\354\363\322"
+	.ascii	"\2700n\363n\f3\267\206a\tm\235\022\003\204\220]\032\027\311\316"
+	.ascii	"\331:\262\025\270\274\374.\215\233d\t]\250\234[\264n>\370\340"
+	.ascii	"\003t\211+\316\017\006\333\354\022$\275\313Tz\027\242\364.\314"
+	.ascii	"\364\277G]\250\230\\`\023#<\027W.C\222@\221\025y\2202\333\220"
+	.ascii	"p\021\305@\303\344\204,\207\266\356\212\027\\j-\006\323\032W"
+	.ascii	"O\256X\f\211\230U|W\350w\205\005\234\272\213\321\370\252\210"
+	.ascii	"\201\3521C\007\327Uv\341\225\226*\347\031\026\035 \256\262\263"
+	.ascii	"X\335\240\233/\320]^\246}^\345\337\204\275\345*\273\331WPPqD"
+	.ascii	"\""
+	.string	"h\207_\316yl\350\t\212\f\376\220I\372r4|K?<K?\fK\337W\336\2032\315&MG\346\032\277\311\3141\251\241\025\201Q\303\371\204\005\224\316K+\322\004\342\307\271k\021\006\305F\036[\317A1b\322tR.\2348v\335e\353\224l2\263\b\221\263\256\351\212\024\365^\037\351\263,E\303\231s\306qb\ti\2246\031\b\312\220\263\307z\257\215H-\365^\243\365\232\224\222`Si\275\266\322RzJGi\300\376\353\276\366k\276\016\354*\366\331{\335\366\366\352'\226\275\026\373\033\r\363\231\221\206RLvH\207\026\222"
+	.string	"p\3270\034\352\242\373Q\2057\204J?\254\221~8\224\036-L\217ZI\217\366u\223\035)#nx\351\321\267^\0227\203$L\017\317\253\345:\016U6\371\213\322J\336q\027\006\220\252\274\306\027l\270!\326\220e\023\\\222\030#>\242\2345~\213\311b\"\244\244\231\272u\033\232\025\004\344\324\370\2502=\256\262\246\366d\346\304\310G\006\213\353\202\352\264\306Q\023t\364\364\324\227\276\317\376&\353\262\031\340\334\314\0327\022\234\267\331ma\267\024l\334"
+	.string	"(\351\365\263\035\206\016P\222\216`;\fQ\260\035\206\307G\322\343\257\364~\226\303\020\007\347\375\345\225\345\013\256qj\263\3450\264\204}\307\204\b\210\210\0065O\031EQ\\CzO\n-\250\361{H\013\261/\340\236\260\032{\260\035\206\250\3450\264Ip\336@pT\025\243\036[?\264\230Il\215}\f\275\362\244\304\350\221\362\350\254\356\321N\373l\255\306\361\316\321UI\335t\277\216^\\"
+	.ascii	"\355\371\265V7\033J\351\002\245\32747XBk\265U_\321(\237\331h"
+	.ascii	"\b\025\245in\260\265:\252\251Z\334\345\335\324\334)\313\202`"
+	.ascii	"p_u\357h\254\367U\353\220a\366\025\316yi-\0074\326r\200\276\355"
+	.ascii	"X\206\r\361\261\216\3648*E\237Jb"
+	.string	"PM]%.\226X\265Q^B\342\026\327R\366\212L\223\324R\r\215\217[\244o\250\276a\tG\020n(\023e\242D7M\345\037\003\340\376zp\335\256*mM\320\241\243DTUA\210|4F[\\\".V\242\350X\334\270\230\"QhY\215Q!\333\226cO\210Pct\305\371\230Q<\2264FU\3309\256&\266\270\306h\220\245b\263\250\341\261\260}c9\240t\025\261r|\305\n\272\274wH\204\320\f\365=Ii9\272<\2524N\215\2155F\3631Z\016*cB\205\030\215\207\024\263-\215\361\226\020l`q\322Bx\034Nv\370h\3348K\021\233\017,\357\2331\373\302\3014\330E\205\n\026\274I3\227\326\336\013\223'fD\002\217\005\273\313\005,0O\371\243\257\017\377Y\233'\320\236\236\237\235\352\272\332\341w\374\367\026\323tZ1(w({tP{{\230\357\246y\371\352\n\223"
+	.ascii	"\211\253\213\322\304R\216\371\n\223\250\0206\306Q\260\234^3H"
+	.ascii	"\031\005GO\236\340\274\233\346\325[b5\001\"\363\203)\354\251"
+	.ascii	"\206\343\274\231%\2512\247\306\030\n\306\253\251\233\313\302"
+	.ascii	"\201\247d(\203\315\t\222\356\002\343\022\364\242k\362&\330\311"
+	.ascii	"/37)q\336\300%yv\307N\216\334P\263j\214\353\260\334\231\336\231"
+	.ascii	"\220\306\230\356}\202[\232\203\033\326\222$\301s\266\254Y\230"
+	.ascii	"d\320\002>\005a\201\227\034\317\271X5\221z\321\030\303a9\034"
+	.ascii	"\224\245\245\211\345p\234s\211\n\241\231\213\f ,pX\311u\262\361"
+	.ascii	"B\207\327\206\"mm\330\255li\2455\210\251\260\020\331\273\340"
+	.ascii	"\261[\323\275\\\241\321$\204\372:.\362\205\327.\236LV\202e#\227"
+	.ascii	"4\271* \203YH\311C\314\327\320\227\235\331\361\332\261\032\t"
+	.ascii	" \316\227\002\371\201\267l\214\323\216\321\224\230\260\3715>"
+	.ascii	">\303hYRb[\215\277\201\231>\0040\031HH\2151\222\363\265\026\037"
+	.ascii	"\321_c|\344oJ5\fR\2255\201\272\003j\214\307\260\021\373\374\022"
+	.ascii	"Lv\032\266\025eK\b\323\237\300~\311\020\207\035\213\2615I=\t"
+	.ascii	"\202\035\301\253\341\364Ko\243\027$\b\366\272I3\221\".R7&\027"
+	.ascii	"U\327\261\327\324\0256\033\2151\221\246\2021\022\304\313j\214"
+	.ascii	"\205`\256B,\205b\230\013\017iA$0\255\237\\FFVM9\037>\360\326"
+	.ascii	"\b6\257\030\2232\362\273U\214\264f\3748\336\262\20400\342\300"
+	.ascii	"\246\250\352\252T!KK\217\205\205\263,X6\032\026!\222\261\305"
+	.ascii	"\303K\221\323\327R\217\343,;'#u\247\003\n\363x*\363\024\036\330"
+	.ascii	"\371\002(%\n\223\006\250\206\223J\210\225\025\3361\004)f\310"
+	.ascii	"\306\336\236\216\343\0354\\o~W\356\222\234\267\252\301\306\267"
+	.ascii	"\251\312\221\003\337\340\261V\243e\005\311\013-PP\230\352\006"
+	.ascii	"\217\016\253\303\0332uL\325\200H\242H\365\332\013\223\3115\324"
+	.ascii	"\030GY\302\2270\265\247\220\232\223\223\265\3615\265\004\004"
+	.ascii	"\333\b\232\352\303\301\304\204o`P\343\013\006+1e\323\361\r\030"
+	.ascii	"+\"Nm\215\261\r$Hz\324(g\314\300K\035f\254\311\344h\002E5\215"
+	.ascii	"\343%\232\264\0253\214\032c%\232:\034\003\307\300 \351O\311C"
+	.ascii	"J\365\247d.-\305H\030\t'\331\234\0059\310r\302/\216\223\032\016"
+	.ascii	"\rLC\322%\367\205\364\244\361i\270\260\0216\272v6g\020IJ\232"
+	.ascii	"\247\3646\210\305EO\\t\261n\236\371\305\005V4-\360\362x\211\207"
+	.ascii	"\322\2343\024!N\334\342x\310\252p\022\203k\214Y\364\332\027\020"
+	.ascii	"9\032\215\261\220%\f\343s6\306+\272+f\271\305\253\2511Va\t\371"
+	.ascii	"j\250j6\306AMG\243\247%GXc\314\374\333L\r!*t\2151\320\371\322"
+	.ascii	"0(N|=\027\203\345b\207\323\223+8_\271\205X\260\334B\257\257\251"
+	.ascii	"\245\301-\277\205\036\216j\320k|\t{M\206\312\235\023\025\215"
+	.ascii	"\257\026Kx\235v{9\032\337,\3355S\304ci\344o8\306\332\020&g\351"
+	.ascii	"g\260\254\334>\257\225\313\004\203\345$\232\034J \304\\\375\330"
+	.ascii	"\222\321\37034\354\236m\327P0EvG \004\336$\201\035'\223\233\201"
+	.ascii	"\200\327\r\260\343\224\2302iy\327/\357\366\rs\266\317\246\321"
+	.ascii	"\221\236\336\355\033\201\307\224\337\276\276\242\t\032T+l|\367"
+	.ascii	".\237Er\226-\341\273R\242\274]\351\273*\334\2244\311j\034\345"
+	.ascii	"<\202\226\310\374H/#\343\356\356\342\375 ]\274\"\200.\204\032"
+	.ascii	"\337'\267\317\250\314\211%D\241\252H"
+	.string	"I+L\351\350\256]\232\033\360\365[\367k\007S\0274\330c\315\305\350o\352\006\224\247\313W\237\232[\3439\264\271*UnW\256Ff)\003\315\016\311UBSeH0\346\307\205{{\353\270T\231\263\t\224SK@b\224\322\337\265\313\366\333\366\333\326q6\037\345\254\224\225\177&0Q:\362p\030,\351\377\333a^\036\345\234_\240\317|\004$3\374\355-j\255\207\177\306^\333A\316\3533/\247<\tL\263\322\22656\310G\353rf>)!\360\204\304|\232!$\366\024'\212&\214\307\0204\253\361\210\234@\f\252*B\203\325D\021\005\t\f\326$\2628\001\024'\212,\314\030U\027V\225\0021;\306\242\211\nH\030U\237#\r\r>:\310U\204\313\tcQ\035\201T\217/\240\320Y\2133\220\320A\352\354\030U\037\037bN\016\t\311\234\0222\354\344\240\240\203\324\271`\006\005\r\304\034\205\b"
+	.ascii	"H\026yx\212=\303"
+	.string	"\243\020\341\204\261\250\356\374\360\350\030\213\037\220\311\237\017\026\360\360\374\030\215G\243\313\232\243\226\240\230\034\316pD\242X\217F\027\023D\225\007\257j\262G\355\031\232\370QA]\213H\016\320\354\020a\222\352J\203\n)F\324\250I\242\312\243\216\b!\231T\221\"@P\223G\236\020\036\250F\3431D\210\025H`\200\006\265\002 \214\252\017\006\016`<\256\353\217\nD\244\332C\f\241\256D\236\237\236\"\211\r\326\242\261\005\233U=A\301\252R y\301\2161\002kR\375!\201:\302"
+	.string	"\026\254j\f:D\021=\352\232\244\201\004\t#\210\260\"\211>\"\240H\376\210H\261\206\030@\210\035\243Jb-\362\370\220\260`\004\212\344\017\317\0040X\327\234\244\006\324\234\nH\300\331\200\006\327)\"U\243z\"\275\t'\204p\002\n)\\\216B\n#\2440\302\360(\244\200\203\223\302\t8\351O\300\2713T\260\256\024\\\320\243\362\250\353\005\024\304\220$Z@\307\370cBF\315i\301\002\237dO\322\347\304\206\024\352\216\261\005u%\"sR\034K\304\240C\344)a\301\2523\223\314A\261\2360\252.H\240"
+	.ascii	"G!\202\211\237\022=D\025\271&?\030"
+	.string	"\217\002H\346\230\370)\221\034\"W\237\273cT\357\t\237\234\023E\023\306c\b\233$\005<D\031\220\352jla\365\351Q\3275\002k\321X\304\300E\375Q\1772p\302X\\\213D\016d\220<\212\330!\252(\\\222G\021<E\342\352\262\032\177\216!z\324\265\370\242\346$\177V\342J\342f\345\371I\252\310\341\216\221\330\323s\324q\331QW\035\325'\205ZcT]\2101\361\243\202\f:*\322e\3759\272\2549I\013\244>=\304u\3759\252=\305\325\246\303\232\314YS\250\253\361\030B\204\2324\036}\222\352\b\001\350\030\177&\200T\223H\242\017\314\360\305\250\272\320CD\022}d\222jO\361\005\032\220\253:\"\005\261g\006\251&\177\322\225\347xT!\007\245a\207\250\216H\026]\222940%\206\353Q`\220T\221?+Q5\221&s\216&\214-\254\320C\3241\376 )Ps\214\307bNN"
+	.string	"\214\307b\022\251n\200\347\250s\\\217H\237\232\243\tc\021\257G!\302\207$R\225\241\210\334\311\340G\037\025\371a=\036\221\037b\220j\321Dq5\252;E\230d\216\314\006V\344Q\204\215\312S\202\370\202\fC5G\3359Z"
+	.string	"F\3359\366`5\007\003+\362\3503\2234\036\213\253\317\321E]\211#v~\210%R\265\004E\022\351\232\203\202\313\232\"ev\210*\013k\016\t%\360\024\211/ U\023&~TH\261\312\310PTu\324\0217k\316\t8\253\261\370\223\302\020W\342\n)\2204\310UD\013<\304\"RMv8\016N\210\r4p\001\n\244:\"\250:E\031\324\035\035\344\207c\361\203\261H\354\371\240\203L~\020\341&\006\035b\t\036\036b\b\225g\247(\363&\210w\224\325\005\272\375U\240\354;k\343\233\tS\332\"\307\206\363h\344"
+	.string	"[\350X\303Nz\250x3C\325\346\252\330\300JC\321\232t\331\300a\006\343\024\324\243\2571\031\031jf\217"
+	.string	";\320sn\321\032\314J0<\240f(\222%T\203M$\350\221\242#G\236\314\301@\005\345l\214\226]\030]Z[\242\330\214\340\244\253\245\246\"l\fU\222\372S\022\324bb(\030\2105\016Z\350\023}\242`6\037m\260\365\207~\035\005k\302\033\002w\371^\226\214\004\361-y]\274\026r\002\222\245\013%B\277`0Y\022A\223"
+	.string	"i\bQ\302\205\207j\240\204"
+	.string	"65~\212\245Gz\210=\265\220\313$\211L\350Hct\313\026\026j\331\252\021\022\013\202\0029\272u\313\301\b\210\240\210\206?\260\027\231Y\f+\215Q-\023\2329/\321,\324\307Q\255?Q\255\032-5\326r\320YfI[\206\030\275B\257P\036,(I\200:\217\362H\3225\005\2541\212\325]1\334VD\341@\264\343\026\256\r\r\312@u\334\276+-\374\230\240UG\255"
+	.string	"e8\325h\214\342@sl9\217\350=\3177%K\n[Wct\n\245\302\341,k{\337\375\216\006\265\006\367\244\372l&\320NMG\024\272tq1$\313\024\024v\273K\322|l=5\024\226bR\361\304\t\257\321\324y\025\346@\233v>\372\230\304h\2142\241Lh\023\013J\030#%j\343h\023\331X\026\244@0\375\321\0328K\211\360\212\311\022\336\"\001\317Y\324\030\215\201\306@\225\250\234`5\031L\313\376\270\210\2403\216*\315\325X\333k\214\312\260\204'<)J\242\301L\024\264'tz.\\\240I7M%\225\004\274\361\220\201\022\f\3622:\232\204\276\300Z\330\262\221\027(R\235\234\214\2472\f\310\344\220\320\243\353\025"
+	.string	">\241\263\033'sf7v\026\205]\250Sc\023\202L\335rHA\207F\204f\222$\035\023\025@0@L*\030\315\250\265\036\023\200S\310\323\221\030(\245RjfD$)(I\241\322\001!A\214>{6\200\346v0h\322\006h\325\030\033\321\304\336Yf\f\313,\260\243\244|\034\231\207f\230}b\276B\344x\344s\007\355`\327\021\310v\"\240B\263\273fG\340&\217\316\177\247\031\032?\217\026\274$\274S\260\320\367\211\005\033\017\211\025\237\261)\241\252\217\327^\201\3463\270u\347\247\177\233+\"\265\237\370!\334\211\200\230\274X\3428\364x\003C\260\344\351\337\003u\302\373}C_"
+	.string	"\323LrO\306\246\004~\f\346\354\322\306\240FS:!\272s\265[B\211\002\276\217\025\324\274\030\017\367\343\241\275\252\276\253`W\330cO\267\215\327\217\026\004\272\017\036\364\242\233mo\302@d\025\t8\003\362\320S}\215\254\333c\316A\2551\224\007\003\372\201\326\030c\376\023\371/,\243/\3329\224\363\336\232\360w\\\223Q\036X\335\223sH\001Q#g\356\375s\231!\207\343\200\332dQ\0331.k^\221`P"
+	.string	"$\356\235\2518\302\251\001\231\256\264\256\230\007\337\r\320\257dG\355-\020\325H\262fI\037\035\230mh\025*\316F\301u\274E\265B\301\242<\2232\253I=\033"
+	.string	"\244\007\252\020\344\203\001\210\203pG\260\346e\"\363N\225\037q:#G\372op(\343\235\022\226G\304\326,\016\021\235\232\037 %#\206\222\326\370B|\013 \377t\211\302\013\324\225\024I\377>8\030#g%\244\221+\317\257\366\334\260\311\346\031q\310\017\337\243{\\\032\202\270\227\3551CYv\350\251\3102\216\007\3142\253\f\202^\370\007KJ,\262P7Q\016\211+\377\314G~}\254F\374\005+!\270\323\322\032\020\256\f\2628}\302\b\024\333\207\343\342w\370\236\313+n\362\3707\212Fv*\005\213\350\205{\013\2658\2305\210\320\177\222\3312\"\026\031\300\003\263\226\027\017\276\\5\254\255\352\313I\\_\332\332p\bN:\276\314\266jE\034\033\005:/9\375:\t=\314\360\315\240\037\207\253\370\242\353\347\214\372\003\032\216\2541/\377q_|Ca\262"
+	.string	"\004\200\333ax6\264\3702\2044\330\031q\216\264\007\265\355E?\234--\325\362)\372I\027nd"
+	.string	"\374\376\223P\021\326S(\022PR\264nz\316\271\020\276\260\204v"
+	.ascii	"\006r\273\244kbC\372\361 \213\350\326\031\006\340\020n\337[\030"
+	.ascii	"\262\354"
+	.string	"\004%\025\034\271AD"
+	.ascii	"S\233\326+\220\216\305w`\266\236uc\343\210d\261\024\277>\027"
+	.ascii	"X\322@\332\006\304H\241\357\243\306\217\317\215\200\003*~^\f"
+	.ascii	"\355CH-\346y\261\3400\216l\246\251!\325EUpDM\370\021^\023\374"
+	.ascii	";\003y'\034\356\214\035\n)\031] U \360[\256O\377\205:\2055t\234"
+	.ascii	"\266\b\032\025\221C\033\226\343\307<o\254\034\310\f\317\265\251"
+	.ascii	"\324\376\007\323\355\037\362M\352\322\236^\033[\276\324\345\310"
+	.ascii	"\032\225B\307\n\345\216\236\254\310m\316_@\360\n\217\224\340"
+	.ascii	"\315\325\345zU0T\004\342.]\347D\266^\244$ \326\321\322\346\006"
+	.ascii	"S\331\202\230\360\025\351\337\323m\021\351\365\213D\314\340\324"
+	.ascii	"\200\350E\235\tB\216ftMw\365\201\266#\250\001E\260\377\346'L"
+	.ascii	"\354\323\213\235\256x\b\313\251\314s0\f\366X~\256\275k\352\342"
+	.ascii	"\322\243\243\336\n\211\001\342%\030\2661&\205s}\036\242(\035"
+	.ascii	"\337I\001e\264\260\264\265\334\327k\323\245\274\023\252x\374"
+	.ascii	"\027Q\221\341\325\0044\033\235\331\025"
+	.string	"\252\220\034\233\204\252\347\025\234\300\275TI1\344\271=j[\020`\336\223\"\341E\253_\024\342\262\017[Qz\005\024V\355\261k3R\245\215nW<\340\246\376\004\277\263H1fA\345=\250\244\327Ny\335C{\323R\304\341p1Ig\361\261\352#g\321\243\006\202\373i\031\317j(|\372z\f\026\250E\305\246!\242\317\210\211\377m\331\305\2764j\222\246<\237`\3435\237\200Yx\311\334\3658\213\300\246w\034{W\247\r\2665\334Y\201\217\260\312z\\\214\316SWm7~yH\320\246\315\233R@\353\364%\232\223%\221\241\357W\317-<\211~\026\264\365O\004\206\367\017w\360\270\365?\006O*\374/\214&\024CZx\350\230\213(\021`1l7E&H4\037O\236P\221(\245\224\2643F\327\264\177*8\t\211\r5\244-Z\216U\317ksI\022\335\372\254\256O\276{\277\227E\325\336s"
+	.ascii	"\352\366\027}\324. \016H\372\201\332\2532\007\224\333\217Y%1"
+	.ascii	"!]\221?\265\273\n\311]z\214\001\347W}@\331t\372\372\f\200\360"
+	.ascii	"YT\303\362o\2379)\323\345\215(fD\333\0359\n\034\272\364\032P"
+	.ascii	"\267\304\240Q\302@\311<]\031\030-Q\376\\\bx\255\t\203\272\313"
+	.ascii	".Nl\177\211\211\003_^\362a\247%\245\313\242\f86G\222\004\306"
+	.ascii	"\322Y\316\305\3478\035I"
+	.string	"\377\257\330 \232\003mt,\362^z\021\250\357\026\262\234\354\f\261W\023\216P\300\220P\270\307(`k>\361M\031hg\007\226\313\226\252\356\317\340QJ\003\017\324~[\024\254\362\200\024\263\372\244|\253\335\373:\337\273\317\324\026\225\0218\276\362\241\237\001\037\365\002\035\314\305\227\025\202\201\001NC\2332\373\2043zt\313\311YF\356\fm\246\020\033r\200\353\b(\204\223\021\206\310\202\350\034\232\200\300\344F/\261|\020\270\205\025\302\243\263\024\364\324\335\366\273\267\005\013\226I\252\275\266hU\033\032\231\367\002\221y\204i\300I\217\352\320\202I\372\3159\374\fH_\253\370j\021Igd\211+\177\242\276G\334\315j\036:=*\220\265\344\022\363\207~L\334AC\310sT\201I\323\202\203\254\256H~T\037\327n\332\361\377A\316h\024\237\214\274\033\354*\231\\6J\3111\306\027\3771\235\330~&\232\204\241\206\265"
+	.ascii	"\323\t\234|\220\332\030-\261\323\301\235\341\034\237!\b\357\245"
+	.ascii	"^\024\203L8\"\301\375\353k\253/6\342{_\246\253\177\364l\021\330"
+	.ascii	"G\n\032\272\026\013\205:\263\354\260g\225\362\220\370\361\006"
+	.ascii	"\023\314\375\260-i>\365\221%\247\263^\356\303\025F$\207Y\221"
+	.ascii	"f\221\234\230\214(]\377\263\261\034c|\205\\\366,\260G\024\272"
+	.ascii	"\245\303_\372\221\3616\304\177\237C\316\302g\310\n3{o}r\350\341"
+	.ascii	"I\303\030hX\034DX\221_\271\320c\351\036\376G\305\304o\237\271"
+	.ascii	"\035\340\324\327"
+	.string	"\306\243\310\1774b\017p\216\\\205\003P\336\307\240X%x\312\371?\200A0>\b\232F@8U\031Q9a\032\240hA\2053:8G\227#\227\257jCl\024+jMv\004@ <|\356\024\336\241E_\030\031\374\020(@\213`\023\3138\266\013\024\242\fLB9(\303\"D\001j\235\032\1779/\2339\037`s\024\341\277\016\304\334E\212\034\265\306P\rK\332yS5\326\0173k\331l_:\336\336\334\312\204\356\305\275\364\263\240\021\307\266K\274\022(\032\274&\254\325\241\250,\300\356\324\234\256\244\221\206Mq2\022Y6\235y\306\024f@\244D\003\026\f)\240\355K\023\346z\005y\004\365i\240\276\271\242\r\364\302\352\026\344\270}\325S\316y\263.\204\360\207%\242\036\313C\311\267\267/<\207\005\2159W\325\004<\027\2070\b\006\322\202\033\351\212\023\024 \260\336\236\246v\361\347\254\253\376\321M"
+	.ascii	"\331\333\325;\346\3258\370\271\356\251-\345\246d\343rwk\322,"
+	.ascii	"\234\265}\221L\030\0272\357#\224\002\310[\027\035\034\306\255"
+	.ascii	"\357\272By\325C\270\3253\026\357\350\263;l\023\034\246\217\356"
+	.ascii	"\220\356\002\235\212\272\t\025\262\202.GK\"\250\273\2003(\242"
+	.ascii	"@\205\241\034 u\200\205u%M\007\306M\300\016H\373\250L\334\225"
+	.ascii	"\345\007x\240\310\374\341I\241\202s\205'\301Q\2400mn\264\252"
+	.ascii	"2\253T;,\177,\266Z\215\242RzD1\017\023\233o\335\311.\231o\326"
+	.ascii	"*J\215\367\300\030\344\2207\364\342\315\360\222x\260\235\251"
+	.ascii	"B\006BS\230\343\r\374\245\341\365 \016\272@\332\032\346\026\360"
+	.ascii	"n\234\351\204\034\323\2049\276)\333\357>\275\325\313\317\035"
+	.ascii	">\235;\030\337\036\271\206\347\2441\303\272\317\312u\202\220"
+	.ascii	"\320\353\202\257L\207'\361J\026c\020w>+m\242\310\373c'l\323\005"
+	.ascii	"S\232\303i\007s\rN]\276s\007\f\271\211\377\347\323\r\310\360"
+	.ascii	"a\304K\242\003\233\227\303\274\204\354\314a\343\006F\035/\007"
+	.ascii	"\204\333z\025\306\206I\035\342\335\234\317\031\365\f\247\243"
+	.ascii	"Q\003\371Wx\326Jd\333\377\264\346F\177\274\206$\207D\016v\215"
+	.ascii	"\275\242>\253=eh\255n\233\374\3548\024n9\311\3177\221\317\347"
+	.ascii	"S\313\330\365\020\367^\347\351\344\023a\217\255\2037O\322\257"
+	.ascii	"\276?s\347\336\303\321O\317\376~\377\257\357\206\277\213\363"
+	.ascii	"\261\363w\377\307\177j\316\377}\335\007?Z\360x{\032\370\035\366"
+	.ascii	"W\313\276\202^\276\277uo\336\336\240\275\260\257\016\317\357"
+	.ascii	"\003\303\257\307\214\f\336B\302\235\351t\021\213\312\034\247"
+	.ascii	"\355b\224\177\026{3\204\306\365\367\035W\342\247m\374\342_\256"
+	.ascii	"\316\004~\342\371\322\354\030\364\277\375El\237p\205\365\350"
+	.ascii	"\005\374#k{\304\317f\355\233\005\370nH_\342G\352`\036\271F\335"
+	.ascii	"\247m\341\353i\366\021\363\226p\271~\233a\203\317\352H\356Aw"
+	.ascii	"\373\3264\337?\245]\360\332\353\343*\347\355,$\367\255u\333x"
+	.ascii	"\272\326 \363z\267\204\214\2336\233\363\022\360U\255\2256\244"
+	.ascii	"\350h\227\343\245\343\234\314\377\034\345?\322$<\330\277\265"
+	.ascii	"\243d{r\007\250Grx\206\035\321\2720d\250b;Z6\220^\024\007X\332"
+	.ascii	"r\327\235w\347\237\037;=6\367\243\341\261\302\215\375]\277\360"
+	.ascii	"\244\007!\356\220\367Jqr\377\026m\316\370\247\002\326Et\247\372"
+	.ascii	"\337pl\321\213\353Mxc\352O%\256\333_\353\225\372?\316\341"
+	.ascii	"vG\365\226\365\217\344\210\354\367R\207\024n\371\267\310\027"
+	.ascii	"\317aS\205gq\245\353*\336\032\354\273\002"
+	.text
+	.section	.gnu.lto_.symtab.646aa49399299041,"e",@progbits
+	.string	"waitingResponseQueue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.646aa49399299041,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,889 @@
+	.file	"rcdevice_cam.c"
+	.section	.gnu.lto_.profile.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"5\007"
+	.string	"B\212'0`K\324\0300zE\2364\001\001\327\367\371'\325\256\377e\030\324\255a^_\b\363L\222$\001[\024LV\302\n\335ZF\266n[BD25\031\031/\314\313\002\232W\0214\211\005@:\f\013\t^\265/\365D"
+	.string	"%\016\017\035\365G\211\221\315\232\340\322\n\205|TPH\032\031\326\027A\021^|Z\307\263\321\321:\224\0138\337\004\005\002\306\013\363\262m\336\363<\376\fwn\336\007(.\242R\321}\327\231\265"
+	.string	"d;`\224\203\303P\030R&\r\033\313\377r\256\3521\021\351\262\312\305 \037"
+	.string	"\3600\013\002V\002\374$`*\004\020`\205\300\r\201\023\023\340\002\330k\236\b\2400\027\311\034\344\n\006aF\301\261\224\026=\361\272Y\373\022\261_`\013\023W\005\373I\342\205"
+	.string	"\004\230I"
+	.ascii	"D2\020`\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375 \233\325\002"
+	.string	"\322D\r\023\300\2471{\357\377\177\353e\332n7Zj\333\250\2242\245\356\036\311\r\013\223\330=\177\372\310\306\fu\352\265R\331F/\320S~\340\320\227X\241z\333Wp\t\016"
+	.string	"+\003\202\""
+	.ascii	"\346\300\245\206\331\f\001w@m\260\002\241\244\316\214iA\224\331"
+	.ascii	"z\332x\261n\003m"
+	.text
+	.section	.gnu.lto_.inline.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`'\003\355\020"
+	.string	"\266\331T? o\223t\001\251\347\212\0278\200\233\226\205y0k\365\240\234\315\"\266\345\350\301\302\020\202m\001yTK\036\021\377{?H\b\230\003\b\b C\203\002\214\272e\255\t\315>b\264'\277\021\271SA"
+	.string	"D"
+	.string	"@"
+	.ascii	"\"\035MBh\204\002c\rh\r\250\375\227\211z\324Tg\244\277=\255\327"
+	.ascii	"\343^A33K\371\255\342\310\001Q\204VA\336(\225J%\344p\003"
+	.string	"\250\001|B\016g\225\301m\364h\226\231\227\317x\032\020\325\324nE\002.@C\306\030y\241aC\201)D\215Z\332\377\321\017\020H$\314>.h\b\n*H\213xZ\003\302\251\327\350\023\247%&x\310(\367\335N\321\301S^\021;`\246!_\311\332\230\300e\032[\036\177Wr~\327\357\332\264\222\320\210\005bn\032\201\204I\346~\030\306\351\210\026'H\246\037\225\277\315\243^g\312\3736\357\327\311?%\311\314\3526\0213\326\266\\\025\233aU\221o\326\020\021\270{\324$31\226\255\374((3\251\253;*\002\201\341\0043\364\n\026\\\210>y\343z\237\201\023\205]_\330\330\246\205F)\262\216\371'\363\240\342( x\300Ym\260[\221\242\344\202\2001\236\346>\315.\335DfV\002_\250Q\275bHd(\214\244\260\220\351\200\"\2421\353\001\021\220\271CT\244\255L\233\001P\360\325\027\302"
+	.string	"\342\340I\246lNH~F&"
+	.ascii	"\n\363(-\020\312BwG $(U\241\333!\211\375\017\213\322\034\005"
+	.ascii	"\324Nf\245k\311L\263\210\262\032\261\267p\265\327X\021\313\017"
+	.ascii	"/\325[d\236\310\365\352\267\316[\236A\b7|m0\022\2339\214\376"
+	.ascii	"\274T>O\321DP\233\363\350\360\247\030\346\220\203v1\372'\220"
+	.ascii	"\266+\260\2224jD]\031\021\215\240\314`c\260\372\264\270\367\\"
+	.ascii	"\256\200k\345\013C\023\207\203\\\007\025\324\233%\270\340\254"
+	.ascii	"\327\263\341\016t\3168|4\230<\257\365\343\365\367\202\016\276"
+	.ascii	"yb\375B\275\"\325\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\345\005"
+	.string	"\202I\033 \240'\351\377\340\377\371\227?"
+	.string	""
+	.string	">BU\260\251\252\177\331\266F\316\371\263\337\377\372\275\355&2\311$U\225\246\355\033\210\374\334Hs\222\254\265\326\264\002I\270\361\214\007\216\031\206\334\242e9q\255\225\351\003\207\237K?\327\021%\273s/6RMe\265\236>\251\241{\350:\025L\023`\347\270s\035Y\325\"n\321\344)U\351)\340\217\037"
+	.ascii	"U\213\023\034\032\024\376\343\211@\024\004;\233\211\233\005\270"
+	.ascii	"\032^\001\335\327\004\021\225\002pn\337\006\324\031\002y@73\202"
+	.ascii	"\216\007\202d\240\t\032) \370\016\235\333S\331\200Y\200\246\001"
+	.ascii	"\335%\020U\306\243J\301\314\345\247\275\005p\003"
+	.text
+	.section	.gnu.lto_.pureconst.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\003\231\004\004\271\004\b\231\004\f\230\004\r\205\004"
+	.ascii	"\016\230\004\017\230\004\021\230\004\022\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375 \335\215\003"
+	.string	"\344\003\321"
+	.string	"\n"
+	.string	"\001\274\006"
+	.string	""
+	.string	""
+	.string	"\001\002\b\001\003\001\002\032"
+	.string	"\001\002\020"
+	.string	"\001"
+	.string	"\001"
+	.string	"\300\007  "
+	.string	"\001\002\033\004\034\002\b\001\024\033"
+	.string	"\f"
+	.string	"\r\002\002\035"
+	.string	"\001\002\036"
+	.string	""
+	.string	"\016\017\001\002\021\022"
+	.string	"\025"
+	.ascii	"\013c\200T\362p\022\020\\* \343\351\f)X\265\341\017V\266\005"
+	.ascii	"\344@\02663\325\314\003\026U\331\031e\301\3168\305\216g\263\335"
+	.ascii	"\2320h\003"
+	.text
+	.section	.gnu.lto_.lto.e1e3f078f14bd658,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_camDevice.36.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375 D!\002"
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\265=\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\035./src/main/io/rcdevice_cam.c"
+	.text
+	.section	.gnu.lto_rcdeviceIsEnabled.42.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\r\b"
+	.string	"B\21777@\217\322\001X\360d\r\220k\225\003\307\023\023\214\270\272\216b\352nw\037\323\267z\373\327\003}P\210\253K\320\330U\024\b\323\215\033\216\366\373)\341\2741B\266\224)\005\3262\033\215\346\260i\\\305\366\240y\261\343\"\004\247\331D\315\343\304\f\201\273\210\315\213\023]\347E\314\267\207\253)\250\005#%\331\367d\251P\241J)\205d\211\213x.\273\313\340\177\026\234\213\352\223\035K\rX=\344\253\217\2572E'o:\346w\262cW\201\225\214Q\276\354O\224\312a\037\256\246l\247\241\2463\323\307\022X.\226\201\326\356\351\325\262,\f\345\3036\310\306Xa\001\344\320?\217\3237.J$\256\335/j\307C\317\220\177\220\037h\224\214\264LP\242'@\303\356:M(\214[o\333\3006\202\355\223\f"
+	.ascii	"2CW\r\314d\202I\032\3331q\205\n\256\241\356s\rg\032\361\230\020"
+	.ascii	"$\334\271W;\237"
+	.text
+	.section	.gnu.lto_rcdeviceCameraControlProcess.43.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`\306\tU0"
+	.string	"jR\364\021D`^R\007\363\240P\255\023\216]\234"
+	.string	"\003\372*\343\007\037\0164\303\314:"
+	.string	"Ex\025,\3444KB\250x\204)x\025}\261\361\"\224\f\263"
+	.string	"\034s\271:\322\251\340s\2506\b\234X%\266\211\334;\245\224\002\023\001\362"
+	.ascii	"\020\001^\367\3366\353\266\033\315\205{\316\314\275\027\270\205"
+	.ascii	"\233m\355\r\314I\205,\334Z DP6\364j\275Qzn`E\034\254\215\205"
+	.ascii	"[\255\317\032M\331i6V\254\346\352\006%bwoZS\253\314`m5\251\213"
+	.ascii	"\266\325\264\211\266U\346\033\314\300V\037\310J\346\272N\013"
+	.ascii	"\273=0\257\255-y\367^\247g\302E\256\354b\021\221hh\b@\030\024"
+	.ascii	"\002\376|k\317\252\351\273\222\273\367T\326\316\005\b:\347\306"
+	.ascii	"\205\325\305t\350$}\260\364\242%]dM\354=\021\365\236\206\206"
+	.ascii	"a\016@\350lC\342A!#o\255\004L\222\322l\342?\"\356\033[S&g\032"
+	.ascii	" -\327\364J\213m\300\352"
+	.string	"t\264\225\2444\207x\357\210\035~5\213\330!\327\226\035*}5\307R\373\003\023\273\373\352\032k5e\262\373\262G\310\225#-\372x\302l6-O\345\232bi\222\226\366\035\\Y\376\255\326LC\274`\351\363\325E\326\336{\272\367\2623\271\272\232\215\232\271\333\230\031\003\363\n%^:\375\376bF\321c\254\032\204\335{%0s\215\026\223\002I\316\275\227\002\230\016\243\202\233\254U\206Jz3\223\357;#\376\177\263\265J\205H\227\255N\273\367\246\377d+\353_\005\235\223\345~8\350\302gn!\345\315\364\027\256\225\305e=\026\267\234\276\262\375\304\367h\016\347\322\007\261\360\373[K/qE\241sl\202p\370\240\277\367b\375?\231\323\226\336\367\336\313\257\204\271\327\232\233~\316L?\347\245\2373ru>\256\316\013~\316\n|\316\tVg\004\253\363\201\237\263\222\3179iu6\260:#\035\375\234\215>\347"
+	.string	"\251\263QC\233\211\251\363P\2475\013\255s\320\347,d\235\201\253\363\257\347\354K\235\327\325\271\327s\266\251\263\252:\247\326\371UgO\235\273\201\205f\336\235\261\313\275>\006\001\272q*\030(\275\326\r\355N\353g\356h\23278\001t\275\364\375v\264J\277\364\306\037\032\320\033\213\350?\312\263\022J}\222\276\337\320"
+	.ascii	"\377\311H\333\373\027\203\322\3055\322\332\357\2751\320\226W"
+	.ascii	"\002gV^Q\226y3\3557\233$\313\307jU\020\\\336\357\310\032\371"
+	.ascii	"\344\240t\335GV}\243\273\306\273R\232)\321\224h\266U\325\273"
+	.ascii	"\360 \3721\006\347\273`\r\274\343!-\322\033xc4C\333\331\260\336"
+	.ascii	"\233%\201\233N\327\341\320\301\2037\323\203m\025\351-\320\235"
+	.ascii	"\025\215\330\035Y\217\226i\225\363>Z\3433=\373\226\3272\312\037"
+	.ascii	"z\016D\201(\213\3508$\212pB\224\340&\233\262\255\032\277@\223"
+	.ascii	"3n\271v3\305M\306&Nx3O\330V\003|G\233(\214\235\323\314\253\315"
+	.ascii	"4?ay N\002bv\245\307\206;\216\353z\316k@\032n5\\\327o\214p\334"
+	.ascii	"g\270\256\313\230\021\3206l\253e"
+	.string	"\370\216\327\275X\355t\346]jU\370\30255qZ.\350~\321#gS\347\375\257\266\360\204\351T;UTR3\240\\D\255XkD\261x\321\301ER\206\024\215\030@\251\346\244\203)\250\244\212\250\244\324\214(\026\311*'*)\247\027RPSN\311\252\030N\016\216\230\nFT\225\223\f*\252*'`\032\216.k\rh\315>v8~Y\374'\007\335\210G\257\212y\303\265\360w\020p)\235\026\375\223mX\341\037}\253u\003\265\350rn\315\271$\343\304\177\036\261:\262p#)\n\024\211 'O\260\r\237\345\034\033\321?\031\350Bz\002\231\037\367\225\365\260\262'C\317\273r&\324}e\233~\207\225eF\341A\034\210\377\b\336\351\311\313st\340\013MQV\361fr\222\326c5\205\336\327\364\300\037\341,#\240K\353\313\320?\371\364\257\367\264\357\177\276\341?\363\364\020\236^\177\310y\254=\336"
+	.string	"8\276\343!\355\202?\2761\232\301\231\256c\201\020\371\335\226\366\321*x\344\007\317\321\306\"\\\313\212\002_&\370n\353\016\322dM\360N#x\307C\332\003\217\340\215\321\f~\007\035\020\372g\200\304\250q4$\025D4#\"\222$\005\311p\260\002\021\242Z7\021@%%\214\221\2206\205\264g\002\257\b\254\330\274\306\244\255:\312\334\300]\035\334\f\372\220\345`WP\034\234\004\310\231\357l\245\227\305\313(\020\2158!d(r\207\223\224+\243\326\345\b0636\221?\t\212\247\235t\nW8\\\326\265\277F\215@\016\005\tT+\345\334\301O!\214\034*\027:u\013\371\374\006\277\355V}\022{\244\034\276\023\211\372\3527\240U^\030\363-\255\304A8\027\033\265A\030\b \320\030\226\016\034\007\352\322jD\017\0210b\303\237\221"
+	.ascii	"\270Hb\005,\307\220\274qpl\236\207\272\312\223\316\202\253\357"
+	.ascii	"`z\026\213\261\274vi\271\037w\301R\034;\336\353\033A\215Kuq\226"
+	.ascii	"\306f\365x\314\003GH\026\264\037\343\357\t\372\025\323o|U\253"
+	.ascii	"\332)7*+\305e\241\235\303\003\f5\013\323Z\212\250E\033,\277W"
+	.ascii	"\020\327\206Y\361\311\345\324x\351\354\036\230C5\363\314\337"
+	.ascii	"\205\335O\005\300\233bp\253\332v\237u\206!\267\330\fL\265\030"
+	.ascii	"\217 oi\242\260\353q\260\365\363B/\370'z\362\360\261/\216\252"
+	.ascii	"U\2758k\366F\026\351N\033\r^\034\340\3510\341\377G(\327\306\361"
+	.ascii	"c\374*\2744\253\251\362\217\242\352D\201\375N\001\315\222/\350"
+	.ascii	"0\343d.\310\347Q\026*\032v!\274=Un\034\361PT@\330W\b\345K^\177"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.45.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\265\f"
+	.string	"\306WVC"
+	.string	"\2216\0358\253\2231\257P\200\253>;z\031\177L\233\201]\036\240nK\323\276h\314\305Z\312\366\366\021Ep8\230\206\221\340Vv\311^\265\376\377+\355z^c\001\024\261\2368&\252-m\"eJ\001D"
+	.string	"A"
+	.string	"B"
+	.string	"\216\361\357\303bD\030,\260\274\354nT\017\357\016)\315\316\337\360H\016\255\223S\nJQrq\302;\271R\007B-L\002x\036\212\243\205\003\214\223\236\027\274N&&\263\273\316\217\007\272\253\333^`;\332\307\002\207\232>\206\201\351E\206\201\323n\311\251\306\232 \213\020\376\210\257\210\374\263\202P\\\207\266\210}\035\376\262\375\264\237r\225\356\243\021\002\002\326S\312\240b\367K`\004\326\241\277sT\207\326\007T\207\356\034\371\317\307\312SD\211K(\305\345 >!\223:\244\272:(\275\360$\r\333 g\tQ\340\223\330P\260v\367(\207\376Hux=\351\251\301\304\024R\031q\362d\177\235T\221}jw\327\332\301\376\350\001\0256\230\032\353\320<\260\006\032,\233\240y\200qq\313b\204\314C\213\030\007\022;\nx\223\240\341\342f\333\270x}\234g8\332\201"
+	.string	"\022\252\235A\310\177|\3223\036%\311\0253Z6P*\322*\277\304Mh>\212\267\217\027"
+	.ascii	"2\003\3020\323\302\316\021He\3666\332\302\301H\334\325\0010\321"
+	.ascii	"\004{\200\352\211\270\347\020\353-\341\311eJS\361\202\306\306"
+	.ascii	"B\244fue\\\3137\305\223j\262\242KA\001"
+	.text
+	.section	.gnu.lto_rcdeviceCamSimulate5KeyCablePress.46.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`\241\001\275\016"
+	.string	"\226\235cA q\223\016\037\241x\030\240\021"
+	.string	"\367\247#L\206\306\031\223;\301\330\330~\226\031\303E\314\266f\354o\211\3665B\322\273\025$%H@`p\001\362\342C\224;\200\355\332/\260\330\265\021\262\367\2262\245R"
+	.string	"M"
+	.string	"Q"
+	.string	"'\216\"t\226\013\357cK\036:\300\330\345\022\030\201u\2309H<|\037\020\017\035\262m\234\013\261\325\211\206\212\212\034\273{)\210\207\016\237f\310\257FP\277l&\321\341\003\271\336Tz\231\335\215&Rf5\262\273\316\315\244\341\216\267\375\300\266\003;\t\004\335E\"\324\247\316\024\016\244\354lN\224z\262\377vw\255\037l+\246\253s,?\204\351w\356\326\227NM\037\023\200\304\fMj7C\267ce\300\026\021\347~\373G\031\343\005\fB\347P\254\035Q\2558\325\270\261\313\0358\264\002\353i?\234Nv\342a\352e\203\352\365\250\0330\221R\3511\312\016V\032\025"
+	.string	"\216Qv'w\021\342\006>\213\267\360\274\257\034Z3\211\337\016}\223xX\351[\236\236\216\022-\005\215\262sn[\340\311\303\177\356\256H\365\344w\221\370Tc\224R\207\005t]\027$\032\007\264\371d%\332\305B\326Qc\032\317\006\213\220a\234\223L\002\366\2714\316E\302\331x.\354C\341\322\204X+\311>\027H\323>\027\206\333\253\245~/\252*\006\b%d\214\224\344\217|\212\rf\355\216\276]S\355lB~s&EE\366_<U\301_q\033"
+	.ascii	"?\003\3020\260\215\031\036\013[`&\236\031T\216\262\212W\226\263"
+	.ascii	"e\bk9'\254$\252qRWw\033\f@\360\032\301\254\307\005\027\313\f"
+	.ascii	"\307f\005\013\235\301\255\001\247D\007w$(\033WR\364l\343\023"
+	.ascii	"\312\023"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.47.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375``\002\315\020"
+	.string	"\366\335iF\360\262&\035\242\353\226\344\022:U\352\263\032\242"
+	.string	" Ffz\237\234B\314\bz\006`\020\343\206\322\274\324\212i\335H\t\324\356Xb\372\320\331\204\027\317\3003\360{\223iaO\006({7\205\235\006b\311&R\246\024V"
+	.string	"R"
+	.string	"V"
+	.ascii	"\006\270\307\223\017\330\036\265\013\330\036\215\262\203\036"
+	.ascii	"~\330\363dX\355\004\331\335N=\034\365\320\0265M\224\237/\035"
+	.ascii	" \353{(\301\217-O\340\210\\\353\332u\256\2210\341\003\262ZW\031"
+	.ascii	"\030U\314&\002\302\3010\302Z\305\f\245\354\256\023dU\270\271"
+	.ascii	"\333\236`\273\263SC\333\243\023\334\225\b\327\332\330Ga;Hy\320"
+	.ascii	"\354~\257Ip\013<\252f,G&\223E\354\360K\355`_g\263\231\017\353"
+	.ascii	"\215}\330\257\231\316L\177\304\304\302\016\004=v)\314\206\254"
+	.ascii	",\316\030Ab\373i\377\365\034\324a/Z\200Uq\250\371\331\r\0178"
+	.ascii	">\213g\254\206\006 \037\226\032p\273\251\203W\333\345A\036\364"
+	.ascii	"I\214~\366\177.C\202\037\302\021Ny\360\321?m\217W\235\241Q\202"
+	.ascii	"&\2253\337\305K`\262/\211\030\b\347B\217\366\3701\356\345Z\233"
+	.ascii	"\027>\214\320\006\327.\217\337b\003\241\342+\276\343 \356\361"
+	.ascii	"/\001\247\021\213\332CiY\361TF\036\t\302H\201g\352J\244n\001"
+	.ascii	"i\245\245\363L.\035\n\001\227\030\214L\235\203R\311\324\221\204"
+	.ascii	"{m\365F\347\234OK\226R\030?\274S\264P\252\255b#Ugr\b\211\361"
+	.ascii	"\214\t\331LR\325\366Fy\320\242\030\020\231*\305KnDQ\332$\026"
+	.ascii	"\325/2 \260\002\031\312q\003\"B\377\312\200\221\310\250\177\""
+	.ascii	"\3416\270gE\231\245\310\341\253\341%E\270,5\240\345]I\271\005"
+	.ascii	"\250\362\214\f98\270\267\255\017m&\0304\353\350\361\336\242D"
+	.ascii	"\304\021\344\275\224\r\243\r\021\351\026\345\036\307\355j\220"
+	.ascii	"\305aWy\312\005K\354\247\004\037\201[L\2246\031D\213\3067\\\204"
+	.ascii	"!\236\233\363\235Ye\321e\364\t"
+	.text
+	.section	.gnu.lto_rcdevice5KeySimulationProcess.48.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375``\013\2553"
+	.ascii	":Yh\023D`\236\326\030\367y\312Cb\335=\002\262\367C\001G\244K"
+	.ascii	"\321\312\024\3156\367h\350;.\327\353p\003\366\314\314\343\355"
+	.ascii	"\037v\314\r>l\360BQ\274\r\006\316\365\352\026e\244.\211 \267"
+	.ascii	"\334M$\221R\246\224R'\001\006\001*\001no\027}i\364\311y\351V"
+	.ascii	"8#\275\326\314\035\345f[\223j^E\337g\227\245\335\235\355\275"
+	.ascii	"o\264@\257\334\240\355\225\033J\253\251\350(?\026\275\275^\231"
+	.ascii	"U0\007{\365 3\2673\367Y?\231j\264\025\354\276\357\227\031+\357"
+	.ascii	"\033Eb\003m\257\315F\262\275\252md{\345)f4\035\025\362\376\302"
+	.ascii	"\252`\261\355\275\357\233\364a=\325A\314\245\022\350\307\247"
+	.ascii	"'\211<\032yvt\212\304\2410\bt\333\037\273\252\357S\334\300'U"
+	.ascii	"\0071\227g\256t\342@M\374\307\207\211\367\030\361$\032\231#\213"
+	.ascii	"\034\211\030\207\360\214\355\230\211\271\016\332\023/\372pb\227"
+	.ascii	"\017{\270P\b\017\017v\235\326\216f\353\2412-4\007\016\271*\001"
+	.ascii	"5W\364\2204\310\262\272L+\207\267]\246\305\345?4,g\273NK\207"
+	.ascii	"\332|\3377\370l\341\253\022Z\364l\372U\003\255U\225@\327\027"
+	.ascii	"\033\304'\013\025\t\006\210\231\340\363\312_\025\002\3631%>\255"
+	.ascii	"\324\246\027:\254Nk\207\361\274r\377=x\337\227=\353Y\243Y\250"
+	.ascii	"\231}\0033;`v\243\001q\032\270\211\364\312\0338p`{\365\3468\266"
+	.ascii	"\327\365W\251\236\031\\\225\3671\334\024\036Tl\024\253>\210~"
+	.ascii	"k+Q\035\226\226\376\267\362\2408\230T\255\336\245L\224>\325\210"
+	.ascii	"\375\367 L\327F\254\377\377\357\214\2163\177`\362\316\362\357"
+	.ascii	"\035^VO\325\r\347G\237\224g&\213\324\326I\361\256\034\016w3\331"
+	.ascii	"~\244g\307\342\262\352(-\245\211\233\b\213p\362\316rb{\355\357"
+	.ascii	"\264.\n\223f\312U\345}\314Q+\177(s\253\357\2031\367Zs\002\240"
+	.ascii	"\263\222\352\214\324:\033\271\316\003\\g\001\255s\221\353L\344"
+	.ascii	":\007h\235\001\264\316C\256s\323u\026r\235\203\\gf\353\274l\235"
+	.ascii	"\225?g\240\237\363O\353\354\343:\367\270\316\311\326\031\351"
+	.ascii	":\037]gc\353\314\343:\357\270\316:\255s\361\347Lt\235\207\256"
+	.ascii	"\263\260u\016\272\316@\327\331m\235[\327\371\347:\263\255\363"
+	.ascii	"\372sVY\347_\235]un\005En\272x\204\005p?mg_;@q\200~\265\321f"
+	.ascii	"\306\205 \306\236T\347\347\373k\032\005a\351\347W\033kf\237\304"
+	.ascii	"\305U\361\241\334.i\f\254\317'\313\364\362|\336\323<\261\347"
+	.ascii	"\213c\311\357A~\362\217\344\332\260A~\363\r\255x\325\030\036"
+	.ascii	"_8f\374#\317\033_\251&\r\317\267[+\275\242`\302\235w\352\374"
+	.ascii	"N\361u^\315;\320g\314\024\177\225\366My\001\224WJ\360J\023\337"
+	.ascii	"\211G\374fk\357\341CL\327\023.\340C;\212\265\213\212\260\324"
+	.ascii	"i}\204\344\r\0237Lo\251\204\t\355\373Vu\226\322s\253Q\250\340"
+	.ascii	"\235\305M\026O\305\334u\035f\204\205\013\027\330^\225\376\267"
+	.ascii	"\346\350\230y\nM+\344\325z\275\336\243^[\255\201nS:*\237\303"
+	.ascii	"\354\235\326\013w\370D<\341\017\203/|\2438\003='\027\374\326"
+	.string	"\363#\234\335\333>\224K\003\377\353\244r[\332}`\373\356\003!\265\227.\3557\233X\037A\335\250~>\326O\354\357\235R\271\3173\353'\226\375\337w\213\256\365\331W\253`\361Uy\037\226\326\202\241}\337\227\001w\226\016RM#\336\204\206\246'\247\f'H49\235(\230\206\314t\340\351\003\223\207&&\247\024M!\230\234IPNI$\234><%19M$\035`2T\211&g\322\t((gR0Z\325\352\373`\314\017\252\336\252\203\036\312}#\310\362\367$\263\343d|z\253\355\270\216\331\"3\252-\305\266\222gW\221m)\226(\306\205\365\306\363-\305&x\030\274E\001z\327u\326w\315\375\346\317_\226/{n\206<\3013\253\230J#\302\255\241\273z*e\021 jL\243O\262\221\316\371\f\227a\364\376f9\340\213x\002~@\321\013x\002\016\303\263\212\336\333\224D/\304\013\360D"
+	.string	">\300/\335\005\026\200o-bp@\006\240a?C\337C&\235s\026~5\364\316W\346}\232\177\024\372\346\362\205\276@\234O{\202~\030\204\371A\312g>\263\n\026\037\223\311\261&I\224\327T\220\324!\227OtF*\367\\vk\307\252V>\321\030\351\334\225\3039\362\346\302\370P.\276\215\201]~\243\221\316!9\225\277\313w\223D\231\302\t\303t=y\336\264\362\233o\216\362\177km\323\200\340\250a8%\225T#\"\"R\222\024$\351\360\002\021\031\032\353\021"
+	.string	"\251B\326II\254\305\002\341\237%\235\37443\370R\351\263l=3\007_\323 \001\003<\203\276Bx\240\030Yd;%\020\036Q e\370 +\326\031\267lRlm\337\244\330\\D\021IXl\233\252\370\2419\237t\270\210\0328\262\023%\360`\217\340&b\230\003.+lOYNP\246\221\245,1\027\345 \223tB\300&\312"
+	.string	"#\376l\b\f\224\3416\n\262q))\027\223o\324+\277\2445\006\021\350S\227\243\254t\370\023\2403\363?\342\271V'\226~\3126\215\bu\260\275s\336\034\262\251=\265gI_\351\023`\353\001\260X=\t\027\214\206\367\t"
+	.ascii	"\\\214C\222b\020\247\223^2\350\330L\t\3631\241\333\244\t\310"
+	.ascii	"j\3128u\213{\224\3266\3119\341\216~\314]H\301\314&\r.\354\277"
+	.ascii	"Ph\217\242\020\005\033\304\212\353\326\301\201\037\357\r\344"
+	.ascii	"\031<\216\227\3300\330\034{\347\315\334\350\260\315\317\366\230"
+	.ascii	"\230\375i\264Q\360TA\234R\232\336\304\231\001\245{\003JXM.Re"
+	.ascii	";\025t\022)\214\034i\037\215\261\357C^\017E\236t\004\005\352"
+	.ascii	"\004:\216$WU1L\220S\371\301\205\316\020\"\3423\205H\227\267\016"
+	.ascii	"\216\350\231\326\243\372\373\273\316>\026\205\257 \303(\252/"
+	.ascii	"\375\2447\227\351\377\304\233\250\361\277\363\235\346Lq\020)"
+	.ascii	"\002\225Qt\002\3331l\307\\\001\203\232\231I\214\226\275\032"
+	.text
+	.section	.gnu.lto_rcdeviceUpdate.49.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"5\b"
+	.string	"\322\01797Pm\323\001$\203\310\252\220T%\276\351>\234\212F\302\216"
+	.string	"(\267\240\216\370\321PoQ\373'L\346\"\262\216\326\320\210 \021^;\337*\356\330\306\352\377\273\221\275S\n\033\303\225a\013\236\316U\353\207\002\230n2\016m\270(\006q9\320:5lv0N6i\335\346F\300\332\303U\247G\323\352\324\200\373i\345\310\n\034\341\204\fi \215K\264\267\217\225\021\206d\347)FiG\200\342=G\024\214\220Bv6\330E\351a\177\332\335\265\034\331\377\376XY\033)\t%\273\026-,\033R'!\032\333\217\366E>\302\375\223pf\267\343+\355\202\006.\300\234\032x@uj\272U\2352g\253\034\004\331\233\220*HVvw\312\217s\217\234\177\3223\236\250{\274 \354\256\243'\272\270\345m\023\330>\260]\n\f"
+	.ascii	"2\241\251/0.\230\243\022i6\206\224@m\206\\0\344\022,\261\232"
+	.ascii	"\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcdeviceInit.50.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`\243\001U\020"
+	.string	"F`oF\360\320&\035;\262\\K\203\330\005C\237\321C\322vC\272\200\213sJ*Q\311\254\277L\023\254f\324%\215Z\231\362]\315\262\333\031l\233v\026\331\302\235S\2319\274\323\366\202\272j\n\203\036fE\006\331[\312\224\002Y"
+	.string	"X"
+	.string	"X"
+	.ascii	"\332\213G\006\320\356\247\340\321\013\264G\220\023\310\036\341"
+	.ascii	"\007d\217\337\214\262\177\376\325\354yzZv\204v\227S\021\206\211"
+	.ascii	"z\204\232(\377\346\311\nJ=B\001\273\033`\345\0012xY\251\022\236"
+	.ascii	"`]\377=c\374\270j\274V\254\347\207\204\335u\272\254b\356\354"
+	.ascii	"\2661\330\216`?(\032C\334\230\301\001\241\2221\373K\245\266\354"
+	.ascii	"\177w\327Jc\213\256sk\317"
+	.string	"\271aL+L\247\246\277]\006F(G\205\027\273\037b=\226F\204Q\342:\177\316\323\276\375\025\276\313[\003\007\250\353\240hk\342\3435bF\210\366h?\205\377y{<\316U\240\236\223\242\245`\0025\273\373\300\366\311]t\005|v\027\302\353-H\276\315\243-x^\366\310\371\004i\252z\026,\3262t\237\243d\251\232&\214eF\2251CM\275\3531\006\246\243eH%c\252\273\233Rm\331\026\345\325&)\345]\f\262\242)\373;g\321\301\267\261\206S\336\345\321?\005'\244\221\022\n\027:\023\217\303i\363\356.\204d\324\211\220:o\003i\2443q%\217+\361F$\\g:q!\b\\\312@2q&\245\222\211\333\276\275\322\334|\202\f\314\016 \025UEm\031\300KE\032I\244\201\027\333>\220(\\6V\222\307!\324\226S2\250\"\375\367\330\003\303\3012\243\372(\263E\016\033%\b\035"
+	.ascii	"2\003\006:\206\346\016\344`\355wi\005(a\b\226\265\310\260\026"
+	.ascii	"\013(\204\263\t)\306ib\f\tE{`\240A\275g\025\227Y\334\022\020"
+	.ascii	"S\367s\212*\256:\375\322D\340\030\016&\200\332U\366\367\314:"
+	.ascii	"(\"\257k>\001"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.part.0.64.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`\205\005\235\037"
+	.string	"\2264\274H\220\332Qc\212\006v\034\032%\034\251\341\221\274L\343$\343\277Q\276\272\023\024#)\244\317\b(\225\0226\201\305j\0053\202\205Z\266\223\336\326e\350\216 \306u\324u\257\342\002i^\030\325\2648\321\261u\333\275\267\224)\005\247"
+	.string	"\237"
+	.string	"\244"
+	.string	"KX\367\246\016n\272\001z\323\351q\316\233\350\005\2347\355\013\261-\004t\317\006\363\364\351\312\2101\212\214$\357\275\266\2336\307{\257\241\251\321f\250\3544K[mz\276\254\307\367\032\033\247\251<\260\214Aj\264\222\001\330\2221G=\214.\005\\\2523&\004R@\032\025E ;m\220\212\312\003\367\336\032\322\213j\226\f\204Rd\334\npF\211S\345\206\227_\275\302@rQKY\317\324K)(*\243XS\220\351\366GC\"\252q\002\270\367\276\t\310T\326"
+	.string	"\267\221\365\334{\375!\341}s\333flg\260M\t\001\317B\323\253S\033\272\250?\307\342\241\367^\t\276\222\026:?\212\305y\263\332'\031I\341q\310P=S-\321\326\346\345\265N\366Y}\236\325\246\254\272\274\325m\317\352\372\364\177\200\004Sn\204\367\036\235\031\273C3\313\307\255~$\367\217\034\351'\371\225kVU\274*\036\007\250$\005\364H\f!\202\320\251\202\f\204\020\241w\252\240\003\276\364\036Q\330\221\032\223\367\246;7\375"
+	.string	"\235\362\213\334\310\212#m\203V+\252?%d\327j\256\365\251Pz\203@\327j\377\370!\275\023aQ"
+	.ascii	"\300\375!\003\346y\247\265\277zeJ\322\202\374\372U2\276y\316"
+	.ascii	"i\332\323\272\026\315 \372\227\024<?\352?q\3364m)\006\306\322"
+	.ascii	"\355]N\240\245\265\220\344\325\340_<\236-\367\336\t6\356[F$x"
+	.ascii	"\272i\255N\222Qx\314\302\362\253+\bnu}\200\326P\254\264\304\240"
+	.ascii	"\323\257r+A~\224s$\352\215H\2347e\301&\305\260s\275\003X\022"
+	.ascii	"\314W\313\330\376\367\336k-\321\236\342S)\273\240\260\240\370"
+	.ascii	"Q,\327\325\2214\026\357\275:N\374-\203A\357\365]X\237sj\r7\\"
+	.ascii	"\036\251\261x\207W\207\211/\264\003\0304\224\320\345\200|v8\023"
+	.ascii	"\272\032N\204\356\302N\267\333\341f*\200n\3267\236\037\237[\b"
+	.ascii	"\334-\227\002'\342\266\263\351r\266\0229\237\037\333m\207\302"
+	.ascii	"\306\223c\235\t\334\316\006\244\323\355l\265\362Z'\367\fY\242"
+	.ascii	"\232+f<TP\n\023\032\263\376\222f\314K2L\353\237:\255\n\210W\355"
+	.ascii	"c\316\365\343\212\030\226\342\354\330\204\203f\211`?\355\002"
+	.ascii	"\245\034\006\244P\211\231\325\035\245\033\310/79\026\237P\002"
+	.ascii	"\2641\257\237\365\311\004T\234\1778m\020!\352\215|\247\255"
+	.string	"T\f\354g}~\226\207\361\231\ru%\303\354OKt\316y\332\005I]\220\\\354w\246\216<\t\177\250qH\306\020S3$AJS\220\244\003p\002\231\2621;\021 A\310\234\320&)l\354\031\355!\274\n5\370\227\251\325\212\353#\r\265;\362\302\260\033\376\202\270\025\002\232\232\366T\214\324\243\246\256\t\312\235\376\263\237p\236\362 \271\007Pf\"\333\022\235X\245\243\307g\345)\330\355Gh\377D\242\236\021\006u\213!\223\322;\n&u\277\240>\233{(\323\201\274\257m\277\031\240\215\376\375\003\035\371\264h\021<\362\377~\245P\013!\003\027\251-\264\021}\201\2647bS\253\207{NC\333y-\201\273\327\225\314\371\324,\326X\032\353\210\374\322\030\001\351\240\247{VX\232h\007\346 \003\207\t3\224\004\316\203h(\300\255c\302w\344\227\233!@\275\"\346\356\322/\264\316\314y\215\026\321Z\033\371"
+	.ascii	"\023\003\347\211\327\0209F\360\032Z\005(\216\272\330\177\030"
+	.ascii	"^\377\006\326\301R\213&v\262\030S\001"
+	.text
+	.section	.gnu.lto_CSWTCH.20.65.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375 cU\002"
+	.string	"T\003V"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005\005\001\006\177\001\004\003\003\004\002\002\001\001"
+	.string	"?\202\210\200(}\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\t"
+	.ascii	"@\004\334\201\306\200\b\270\003\215\001\021/7\r\240\b"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.part.0.68.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\325\013"
+	.string	"F\225K;01P:\320\247\031m\022\261\345\362\376\\hg(\037\250\206\272\277iH\354l\025PT\322\260\355\243\013E\205\345\233\020\026_\ne\240\233B\3553\016\364\241\353/\316j\367\2262\2459"
+	.string	"<"
+	.string	"8"
+	.string	"*lw8X\263u\274+\2617\205\320\020c\307\356\306C%q\355\232O\363s\005\016\356\343\271\276\364\207\"E\016\356\003z\016\370\003P\331]W\035nx\333\013lG\373\031\002\nR\273\033>R\033\2027N\234t\373,:~\311\021R\347\035'\031\354\346\341\300\2413\355\267\270\013\355\035\347\t\330\013#D\330\330\355\022\034\032Au89\001\310\341\273\004r\0309|\273\235\273\332\0222y\316\023\f\352\261/\343\246\215o\302\0244y\356\320\327@\016\257\n:\361"
+	.string	"\261\345\007\214*\264\006\016\223\306\t\345\311\036\251#\353\373[\025\331\232\376\223\004\233\353\201\332\242`,V\203\313\272T\270\034XY\304.\021\302\305\202\211V\226\211\224\002\306\"\\Y\234\200aY\214\330\316\277U\221_zU\343\003jS\0133\222sEud;@\376\005\006\2536\037"
+	.string	"\233+0.\034\202\365\020V\363\002,\240\007F\334\202\036\026\005>\330\201\020\243\tPc\340\370{k\306&@\024\fs\205\313k\002\353\321Q\b\306\363\244{\232.\252\235\316\005m\272\354\\"
+	.ascii	"8y0\217\323l\351\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`@\002\305\f"
+	.string	"\206RH:0\317t\005v\007\356\030\215\244\001i\001_2]>U\312\364\261\206\344\3767r\320P\n.\"\"$\r\307G\341o\341/\241G\341%l\200\b\007\330{\013\353\266\367\336I\246\0247"
+	.string	"7"
+	.string	"9"
+	.string	"A\253`2\221J%\020\351\371gG6\220\210a\f\215:\341Q\366\327\201~\312\352\020D\275\273 \016\031\231\231\274iz=\230\237\231\204\327\342\275\367~^e\231\331q\001\016\266\247\325\376E\373\330\354a\262\227\305\276\006\373\333\353q}\357e\376\254\256\237\265\267Bc\263\336\265\372\226U5\244\236\345\353\272\246,\374\312\246\367\003\365'\273;=\007\031/\203\245\332\233a\017\205s\361"
+	.ascii	"\265\001@248\027\357\370\232S1!\334\210\216\252\030_\217-%+\250"
+	.ascii	"\350\271\366{\257\216@\364N\333\nU\206\027\027\367\3227\300~"
+	.ascii	"\373\f\321} \340\021\247\306\037D\215\213\f4.\221\266g\243\007"
+	.ascii	"4O\307\250M\236\360(:g\263`\254\"\350\351\244\3321\235L\331\364"
+	.ascii	"\006fL\357]\263\t\207\305\210\307\364\\A7 \300\002)\262n\002"
+	.ascii	"\361 \335 \260N{\003zh\f\315\032\3653\036@H\232\204$9\270\265"
+	.ascii	"\023t@'\350\200N\320\001\235A\347\016\031\262K\265\244`tB\031"
+	.ascii	"i\276\235\375\254\345\\\257%qD\261\001k\333\302\2143\233\200"
+	.ascii	"#~\333\200\364C\317n\246\324\034\306~\306'b\\\333\332\307\247"
+	.ascii	"\305\300\220\003\001<PqG\3516\201\224a\330#\344\r\327\242O"
+	.text
+	.section	.gnu.lto_.refs.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375 \3675\005"
+	.string	"\342\216&'\200K\322\03230?\0051A\0234A\0234\001\266\303\201\360lv\233m\233J1\261k\237\264M\202\310&dK\231\002'\305\332}n\016eo0\266\306z\306\032c}\261\236XK\254#\232!\232\035\326\fk\2055\302\372@m\240l\004\335\202[`\355\254\231\365\302lKH\244B\267\271\023t\321\rH\332u,B\367\"\312\0220\366i\254\323\330\304\330\2041\200\324B\261\025\212\245\270\037\226\033\322\013wB\372\340~\226!i\245L\036\2212d\003w\326A\367q'\033\275#\002"
+	.ascii	"\003\030$b\203\371\004"
+	.text
+	.section	.gnu.lto_.decls.e1e3f078f14bd658,"e",@progbits
+	.string	"(\265/\375`}'M\253"
+	.string	"\212\004\t:X0\nI:\351\252\334\214\027!Q\321\360\377\277x?s\361\336O("
+	.string	"\210{7"
+	.string	"\250\360x3_m\n\370\256\266\267\336\360\375\016\301\241\016\260\200N>\374\244\253\340"
+	.ascii	"\264\265\275B\004s\211+W\\\327\245\331\250\n^m\242\r\323$\273"
+	.ascii	"\355\243\t\212`4$\202\366\3362\005\n\003\234\003\245\003\025"
+	.ascii	"P12lJv(-\026\003\346\252\230B\223\003\363\005\233-\251R\260\330"
+	.ascii	"\013\352CJ\225*\213o\227\322w\227\346\322Z\372\331\200]\345m"
+	.ascii	"\245\257\274\307\231\363\362G3\271j\314\031($*}\215\366\003\001"
+	.ascii	"\266\223\326K\006\277\246\344n\3731\310\240\001\033K\377\341"
+	.ascii	"$\2359\n\375\342c2\003\354\275\346\363\240\304\234a\302\223\322"
+	.ascii	"\227\263\263\207\003\007\016\034r\360\222@\222hp\377\331\366"
+	.ascii	"\353,\357\277\356\263Y\366\037\316Y\331]\001Nw\0052t4\224l(\276"
+	.ascii	"U\246\357/\251\214\263\216\217\217\312\255\203Z\"f\361\024\234"
+	.ascii	"\025\304H\022'\351\263\245t\224?\347l\303\005\226\025e.}\377"
+	.ascii	"H\337z"
+	.string	"\335\244\363\374\230r6,\356\273\206\322O\f\215w\f2\370M\256e\264\2331:\306\200\351\221>\2601\240\375\004\350m\327o,\256\356,\226@\343Hqn\036tI\317L\325\220\2561\213\3370\322+\340\007\352\272\216\353\271\253\306LS\370Z\322\327o?\320\273\256\2134\222\353\224\313K\244;\006(\207\250\020\003\230\263\363\255\244\237]\327)\034;3\007\016=\301. b\242P\334F\232\256\237\032\372\310\033\256\201\\F\351\314\316\234\2359VL\f\0206\213\177\224\2765\24070\2605\240'J\317\201\226\253\321\023\203\241f\361!\220v\220\026\322\317&\362w\217~;^k\346\266\234\2357W\331\242\t\021\213\005\240\314\031\234\202\364\275\001\315\351\r\350\203\251N\363\240\266+\240\031\232\007u\312\261\365\332\215\323\013&x\026\277\327\376v\266\032\006\017\344\274\3149S0s\345\345\305\225\305\033\232\007\225\351\nh\367"
+	.string	"z\373\250\2002\257\2349\007\303\340\022Uf1\356\nh\243a\270KN\315\f\227\263s'\307\331\342\t\206\305w6\017\232v\005\364\313k\376[5\324b\003"
+	.ascii	"\364\367\317\3375\f\360\301\363\337\021\330k\201D\r3\333\363"
+	.ascii	"\267\334o)\370\314\177\305\302l\375\355\"\315\002\340\177\317"
+	.ascii	"\205[\360\337/\032\266\302\337@\254\004\177{\261;_\340\244\376"
+	.ascii	"vbu\256\366\235\377v\340\357\036\rl\316\177+\3607\236\275\371"
+	.ascii	"{\212\265\261\300\337\"~[\363\367\016K\363\277\356\377\221\377"
+	.ascii	"\\8\370\373C\237\235\371\177\200\275\377$.\\\371m\372\r\377\375"
+	.ascii	"\300\377,O\377\253u\325\337\342\337\376\3571\177\207\371{\313"
+	.ascii	"\337T\376\316\373\373\311\337I\376F\3627\335\337E\376\236\373"
+	.ascii	"\033\356\357!\177\307\375\355\3667\333\337j\177\373\370;\355"
+	.ascii	"o\036\177\343\370\373\354\357\262\277\311\376\036\373{\352\277"
+	.ascii	"\227\277=\370\357\367w\003\376\226\361w\214\277-\374\r\366\377"
+	.ascii	"\302\3770\3775\374\335\365\037\357o\004\374\315\3657\213\277"
+	.ascii	"\251\376\256\340o\r\374=\302\337 \376\177\371\233\002\177\177"
+	.ascii	"\360\267\003\376\336\340\277\230\377`\376\257\375G\373\377\200"
+	.ascii	"\377K\376\337\004\006\006\006\376x\003\177\212\363_\b\006\335"
+	.ascii	"\354\244+O_,\276YW\253\237\026\356\326_\f$)1\251\brn\013h\007"
+	.ascii	"\006\266\005\3246\233\0075@W@o\013\240_+\034)\035nq\026\357\334"
+	.ascii	"*\013A\034s/L`q\251p\256\254\361%/\325\357\024\016\031aH,\236"
+	.ascii	"\"\223\203\314\255\205\305W\300\023\253\027\305&\243\357m\n\027"
+	.ascii	"\331\236\224\027dQb\\\321jKb\233\340\321\370\263[\342\360\236"
+	.ascii	"\372\244\374\242\372\276\3301THLnN\360\304\320\260\330!_Y{T\\"
+	.ascii	"\\\245\345\263V\360\266\332\256\362\346\257\032}v\b\033V\337"
+	.ascii	"]^\247\273t\245.\324\215\272\314\253t\223\356\323Uq\221.\323"
+	.ascii	"m\272\311\273\242\237W\331Qn\2236\360*-\027\353\245\355\340\262"
+	.ascii	"r*\203\rg \223\003\316\332\214'\247\005\370A\272\024\315c\304"
+	.ascii	"\300\251U\241\342,\213B\244F\030\013\006\355\201\027CI[\372`"
+	.ascii	"Z\027\013\230\323\345I\313^Yj\273\320\260Zl\314\246\242\306^"
+	.ascii	"\2446K\320*}\020*}0\231\036\325\222\036\345\263R\205\254\306"
+	.ascii	"\232\025\273\034\2331<\360\272\240\244G\351\322\243p\351Q\036"
+	.ascii	"\351\321\n\250\315K*R$F\025\336\241\240P\322\362\217\273[(94"
+	.ascii	"\236w0,\266v\215$\360\311\204\356Vj\220\310\370rb\361Q\246\364"
+	.ascii	"2`,\023+0\245\025\275%Jh\304\2149\001\264\370Jn\240LM\311\026"
+	.ascii	"_\246\256\316K\246M\211\026'H\350~\2568\265\275=\355\0134#\266"
+	.ascii	"\210=bS\350\247\245\263r\267RvN\210\215\353\270\316k\273\253"
+	.ascii	"\007\354\200\263t6\210\035\322vp\037\320|\320Y\"\235\027\f#\343"
+	.ascii	"\013\303A&\013-I\037\r\356,C#\275LVz\231,df/\213\013\270.\351"
+	.ascii	"1\026\036 \033n\274\354!\345\200\323\220.\213\004A{\373\201\201"
+	.ascii	"\2756\213o\177\374\266\207\365a\335\260\0175'~\026\267y\215\301"
+	.ascii	"xJ\222\256\365\323\262Yg;-\233U;\301\211\307\005\260\346I\237"
+	.ascii	"\2227\214\217k\244\307XiO\363\240\027\016\3506M\356\210R\030"
+	.ascii	"\264\376\013\3628\362\005\307\303\356H\265\306\362\306,\256\262"
+	.ascii	"a\262%\367D\3528- \260\0251\254\f\"n\\\031\374@0\230:0\337\212"
+	.ascii	"\222\236\013\251)\273\005\245\027\345\302\276\300Y\352\344%\030"
+	.ascii	"\024\031P\227\365j\273+\235\274ts\"\223j\332\027onOhv\206]a\235"
+	.ascii	"2\030\026Y\316\031\350\253\363p\222:\031I\257\211\314.\355\f"
+	.ascii	"\233\324y\327I\026|\003\313\262Jv\206}\262\314&\260+\034\366"
+	.ascii	"\314\212Y\035v\314\222Y\032\326\314\336\2606l\231\255aQ\2609"
+	.ascii	"\372igX\252[\023l\230M\332\031Vy:\234\2453K\241`[\034z8t\323"
+	.ascii	"\f3\251\001`1\366\004\264\251\307\023\024,>\316\351\257\2274"
+	.ascii	"\355|\375\322\337\273\364"
+	.string	"\227\316\353\235g\361\2328!\rI\177\3356X\256\231\2453\267\r\201\275\031AK\177\305\254V\020\266){\026\377V\245Y\026+\351\304\217\357\352\026\353Wlr\276pY\344\220!\305\342o\261Vh\r\036J.\253\0265og|C,\256\252\271\321d\251\216K\312\302R\311\334HB\352B\222\336\nIu,\323F\341x\t\201\022\345e-I\217/\213-TW\311Ibzy\271\245\267N\277Ua\227@\200\304\210\020\213-\023\320m\323e\272Sn\261\030\002<\322\333\327<h\004\306\322\013\232\007\365\320Log\255\322\367uLT-H\220\262\264,Y\356\226\036\035\311,Y\2006+\213\023\031Z~\267\320\214Q\362\013r\302\005T\304p\252T\271~\023\024Q\373\273\002\304\3013\201\251\251\357\327\017\351l\306\020,79\254\350aY\271Wf\232Yl\3120V\250\354\355]*=\315\344\237\207\033w7\320"
+	.ascii	"\257S\225\0213\213\251\334)\301+N\236(\211r\245\244x^\300\226"
+	.ascii	"\320E\361qww\363z\322\234\006\226\326g\2034\306L\314\305\373"
+	.ascii	"\315#\242\302*\312\342\013\3052/\226( Pd\276\270T!b\361o\270"
+	.ascii	"\322/\371\222\373\244\335\342\230\3146\320\344\201\331i9\371"
+	.ascii	"}b\377\202\3605-\276M,s\271Dk"
+	.ascii	"\262\3702\351\274\03169\347\322V\r(\032]\177I\336\317\233\244"
+	.ascii	"\277\200\350bv\270\215\036\022$\367lJ\035YZ6%w\325\245ttw"
+	.string	".\315\026\254\374\260r\210\355\001)\322\317[\344rmh\346\251\fg~xJnPH\001\313k\214\b\221;\347e.\214\013P\356w\016\007\215\256\317\213\230\220N\006\240\305\267a\246B\204\334! \362\0046l\344\324X\001\366\303\342!\3757c\343\306\227\323\230\267\013\344\355\306\2419\267\263\031\305\214\203\203\273ci\262'\313\325\325\006\2312\277$X\216\244\257\tss\363C\233\340\246\260\220bc\353\277\236|\255\314\205q\345\310y\003\223T\243L\257\232Z\377\2653G5\215;\313\324:\333\361\227\372\270&\370\260XWK\232gZ?oZ\347\365Z\216\242Y\221\274\201\006\230s]\207\034.(\270\020\363\322\361~^\035\227\007^\313T8'\\u\250\031C\001G\013\213\357\216'\023.2,>\215T\372\03108\372yq\330\037\355\314\311\032+jW\035\320&\023\244\262+\251\231\331=\353\234o$\303\270"
+	.ascii	"\277\345\367L\006\212\331X\334\\\331\363\2265\230\036g\236\242"
+	.ascii	"\241a\203Y\327A\346G\032\031\213\267\364\255\243/Y?/Y\257\365"
+	.ascii	"t3\t\214\257/3\225:|&-\2351\343\216\2459\347\016$\303\270r\344"
+	.ascii	"+&\215\3371\235\260)J\327\313fE\230\236\022\255+#\307F\331\342"
+	.ascii	"y7ucX\253\246\262)\213?\223t\303\356\327\205\361\013\366\013"
+	.ascii	"f\261:3s\276\312I\277\005\314\335\205q\001\346+\346\206\247q"
+	.ascii	"o4+\2319\347)\031gf\"\331\240\177\277e\2727\3747}\333\202\377"
+	.ascii	"8\347\037\001\037\234Y\371\226\247%\275AD\251\225!_\306.\347"
+	.ascii	"\245Wr\002^RK/\253\2456\257\234\\\216%w\230\331+\271\324\226"
+	.ascii	"\363N^.\223\037\232yg\251-K\345$(R\235\235^\311\274l\346\235"
+	.ascii	"\274\314\312\fKK/\251\2456\245\324\316R\233\227Tn\363\312:y\251"
+	.ascii	"d\256Xf\346Nn\363\362\313mM)\235\245\266\246\324R\233W\214N\262"
+	.ascii	"\342\313\310\324\217<0\247\236[Zf\250\247-%S\307n\311\331\314"
+	.ascii	"Rrn8\245\314\264 \347\255&S\212\322\252\345"
+	.string	"\220\354\240\220\204(\233m\341\t\351\253\231\227vKf\315\234\315\220N\344\247\005$\235v\371\204\266K\302\330\312NJ9\007\340)\347dg\273\234s2\347\034dn9s\316\322Y\"{z\312\371\252\347)o%\347\224r\266pT\344\244\226\332\276\232@s?\332\310\262\ng\262\311\262\024/f\332\226T\313N9\347\316\222\222IQ\375Y|\273\232Ya\336,~\232t\233/\270\332\331\324!\306\342_\256\377^]\254\353\"C*\021q\370A\206!\325\350h\304\007H\242\004:9E\325(\204\003\250\310\241J\244\212H\200\220Z,\032\203\220F\242 \r?\341\363c$R\200\376\204\017R(\244\n\207B\2440\222\020\364`\204\020$\2028\020z\360!\004\020\204A\"\204#B\354\250\302\341\004H\342\007\016V\325\004O\006\265\203\315J,\206\260Q\327\341\220Q\006~\302'\305\361'\305\261\202\320\021\3050T\364"
+	.string	"\031bG\003\321\360\303\210\020\206\212\352\b\037\023E\342J\034\202\200\347\250\250\202P\f\2013\244\026\215\353z\324\001\222\230s\201\317z\034\032\371\024\340'|\204\204\305\243\343\217P\t\002 M\f\211>0Q$\026\035\2075k\221\272\"K\030\201D\332 \221\252\220\361(\002\221\3618<\252E\303\240\231\0130\360\001\021DB\003#\202f\220H\365(BP\tj\0052P+X\205\310\f\034U#U%\301\346B*\321Pq\b\342\302\205\210G\265\250\232H\277"
+	.string	"\r\022\240\201\207\024\301{\330\340\202\r.@\357a\003 \240\r4"
+	.ascii	"J\257\001\320U\205kQE\341A\tj\005\206DGE\304\021E\303 \002\004"
+	.ascii	"\177\302\347\207x\034:\252\304\022\304\265\250\016\021iF\320"
+	.ascii	"Q\211H\030\222@\201\252Bu\310\b\002\215:d,\302\2520\204\365h"
+	.ascii	"4\272A\026\215\304\325\310\030T\327\241\210\241\243!\t\251\032"
+	.ascii	"\002\342\210tM\2176CC\025\004\021qH\242\203\024\253\r\n\242*"
+	.ascii	"\244\212\350\241Iq\3049\256\"\204\340\371\200\320\220\004\"\242"
+	.ascii	"a\220J4D\2641a\204\024\232 \226(\032\203t\220\022\020\rQ\034"
+	.ascii	"\325\265\030b5*R\327\225\203\225X$ZX\205\030( \270\376\004\206"
+	.ascii	"!u\035\242 \256B\034 \2115H\241zBh%\202`\204*D\036\255\303uD"
+	.ascii	"\317Jt\204T\217\350PqXTd\024\n\016\251\253\220j\224B\315)\252"
+	.ascii	"\026\250)q\324\001\n!\365\030\\\217\214\301U\210\004!5*\032\256"
+	.ascii	"\353\221Q-\"\256:<+R\270\246P\327\2421H\004\025Y4\032!U\021\003"
+	.ascii	"\020*\036}pT\221\307\241\021\r:ST-0\\\207\037\212\206\307\241"
+	.ascii	"\221\rR-\"\222(\341\270\252\"R\f\213n\216*\362(]\211\214\306"
+	.ascii	"\016\2042%\f\rU\021Hb\020)\304Y\221B\233\365h\024\201hH<\252"
+	.ascii	"H\232U\350!xTK\2248\"\001]\177\302\307\302\215F\352\361g5\032"
+	.ascii	"\217?5\253P\003\240\265H<J\221\352\361h\035\252%R\244\320X\242"
+	.ascii	"\030\342C\321P\250xt\224@\025\242\020\n\340@@A\0312p\001\n\244"
+	.ascii	"B>EC!\241*DD\241\016\t\035\177\214\304\237\"qX\364#tD\376\370"
+	.ascii	"\\(\032\211\310\243:\002\221Q\310\270\032\217F9\306\022E\"\326"
+	.ascii	"\272[~\340\340\203\263Yx\231\236aiR\205uvu\347\306\374\271\315"
+	.ascii	"Y\214\253p\213c\253c+\213\255n``\230\234\2259\335\025tW\200\246"
+	.ascii	"\345\275\241,\306d\260\334hJR\305a X1\276\246\276\0349\341,J"
+	.ascii	"\352\t\340\222,;p\024\216\362a#\347J\372c\250<\035{\177\201O"
+	.ascii	"T\230T9\313,vNp\205\003\252\211\007\246\202[\212\303L~~;\270"
+	.ascii	"\314\300JJx\tD2\347\250.\254\342x\211\016\013\005\255%X\211\225"
+	.ascii	"x\251\203\354\356\361\340\252\202\221\216\227vI\200e\226\031"
+	.ascii	"\214\3623\341E\\z\234\357\334\016&\263\03467\374\254\264v\214"
+	.ascii	"\031\003GFD\tT\016U\2300\367K\3538\221\364"
+	.string	"\202\220\3458Y\220%\365\272t\271_z\232W\017\b\223Y\216\002(}\371\360\362\373E,\255\253\210\305\027\320\006\203c\250\222\321@I\342\030R\206dDd$I\222\016B\n\020\204\202q\034\t2\017\022\200\004APB\247\220\f\211H\220$I\241\2601\006Lx\272\325\362\332\203C\301t\203\362\026N\337\251\002\263l\323\201\251\372\330X\355\026\262\2344\005\377\226AVT\262X0\321\313i\326Zf\266~\021I\210\230\rQ5\177\"\231\321L\251\004\267\005\177y\206H\211\225{\371& \221`\rOEDV\026TP\333%sHY\311)\n\306\005F+\363\313\265\311)O\211\327\017\226\205j\241\031\302\363\210j!\310\347E\234]\235\311\310\354\017\362\017 \224\204__\037\220\362\312\366\f\255QV\227\022\226\320\"\264\213Y\021\324qc\276{\220f\n\243P\263a\f\326U\377\202lg\244E8\002\210;"
+	.string	"\236y\242Q<'i&\372n\201\271\231\204\236MG\262VR\371\331"
+	.string	"\347\235\340I\233\001\030q\005{\334\323"
+	.ascii	"\377\345\303\276l\233\231\332\244X\355\200dY\f"
+	.string	"\265\274 \230x\342\006W\027z\204Z\341P\270\027\250n\200\375\037\244\236@VAkc\255\351C J\215b\357t{\247\346X\001\031!\271mt/^\026h\221\brq\324\322\021@\302\226\006\200<\267|\006v]\331k\341\037\002\363\204\251\256;\342"
+	.ascii	"k\243\341\216r\310'\270\272\355b\236$\022\321\t%\232"
+	.string	"\023L\214\243w\220\360>\033\265m\272\264\323\245\375\261xN\370\251r'\241\364\033,\250\270:$v\342\035\306\205\367\350\3750\t_\231\346si\207\355\2103D\236\366\373#+\300k\270\272i\321\177}\241\237\236\232#\025*6\320\2012\032:\247T\247\023\225o\226\213T\344~?\202\004\367A\205\022$\243\365\036\256m$~\240\r\220f.`\320n\254\251\245\036\025g\273\240\275\246\253O\277\213/\323O\261#R\307\203\305\026\307y\271\261v\371\274TYmW\200\253\3044\202_\004\326\037\372,\240\264\363j\371\241#\275\354\221\026h)\344B\f\304\223T\334\023Ah\363\223\217?\0318\220\316\307\235?I\032\r\315\231\353\232\273\366\033)\330\267\034c\212v\350\020\336Uc\315\3361tV-\376\215~%\365\030\254%\023ME\266_\0070\275]\230\256h@\016\020\262\357\221\026\344TO\365\244\253\177\256Ih"
+	.string	"1g\366\301b\317\032"
+	.string	"\024\0263\"\335P\021d\\\266\343@M\\<\342\3422\212\202X \2417\326k?\3252\005M\320Q\r\n\257JZ\027\003J\231\364\252:\321{C\257\trQY\031]\0258\227\032u\240\372\013\232\241\350\231\001T\230\266B\371a\030\034:W\321?\375\260'\306\227p\367\315^\177\240\264\353hc\b\037\233+\277\267\346\345\233~T\234\353\212\177]\302o\332\222S\222\263\326Q5pA\373u8\334U\t-\201.\237\237\177 \362\325\233\024\317\035\326\\\246\304\b\260a\032\353\327tDc \276\t\301\234\304\313\330/\0356\315\022\264a\224H2\321@\246\323V\001\036\232l?\224H\315\222\342YG v\3171\332\022\027\034\372o\360\332\003\362\235\252\2479\344\203\032N\217=3\026\032"
+	.string	"\272"
+	.string	"\306H\211\304y \326r\177\260\203~\301\214\324\326\2478\207+\022\\V2\350\f"
+	.ascii	"w\016*\032E\001\276\206_\362T\372M\024\305\245\027\320\013\321"
+	.ascii	"I\001\221\211\2017\312\361m\276\355\232\215Z\374\246_y5\200h"
+	.ascii	"\377\237\330\241\337\016\212\213\266O\001\035\277@*\003\235q"
+	.ascii	"U\033\316'\222\240Ny.'\224.\260-.\306\315?3\352\tg{A\271D\035"
+	.ascii	"\005\267\240hT\243\3716\231\237\024J.mh|\301X\375H\230\247\250"
+	.ascii	"^0yG,\027Pm\027\365I\232\235\340"
+	.string	"\200X\325\363S\355bZ_^\013\rCG1\253CZ\241\025\344H\265\2061\232!\224\007\270\214-\307\3318\202\032\307\322\344W\263\326\f,\356I\374\373\247\305\320\3538i\026\202\373\225\205r\225\034\267\t\2076\343[\026\223\221\036P\342T\344\261s\034\266\024\367\251\224Q\b^@\020\371\273\316e{\b8\027\006C\350\230\306`<\006\225t\0046z\361G\356\303\357\267d\272\037\n\342\322w\256\2555w\344=\200\272q\345\210\005\321\211d\361\337\362d\254\016g\353L\250W.p>i\0228\357\226\003t\3058\f\361I\264\364\017:\307\007\250\367l\034\250QH\224\002\323[4\016\fx\320w`7\242,\202Q\020K\2106\237b\271E<2\035\017\220\\<7u\200\211mA\211+\314O\201\337\354?\247Bsz\003{;\225\374\330O\222\017\244\237\317&\304\326\1777\202+\023\215\270\356e\251\3358f\276"
+	.string	"\211\242^\364Uu\344c\300\335:\ro\237\362\2207\355\345\3631\247\177s\232\347\274\025\264\253\t\370\211\334\212\273\267,\362\211\234\0051L[\374\377'E\362\263\352\241Y\273"
+	.string	"\217\231\360\244\344X\332\003\270\263o\352\026JYk\223X\302\t\023\257\032\205\2779Y\224\200\305\231\t\303.\304$\023\b\fQ\326\225\256\322\364P\202/\"/eQ\023\022\312\371\324Q\035\231\243\226\236\275\020\022\344\3539\3549\243H\007)\324\210\365\017\247\256R\223\373\362\\\332\273e\032qh\350&\004\374\013f\332\035\215\204\034,\330\005\210t\bqZN\003N\301\207QH\037\035\206\212k\251\324\246^*\240`\266\205\0272wN\226\357\203\241\333\031\221\215\333\253\037?\3153\362%^\210\017|\222\325&\205\276\302\353\2438\307\207\330r430j\205\254hv_\013\343\233\b\211\024A\256"
+	.ascii	"\354\022\2441\007m]G\260D\030\347\002n\246\237\225\212\0211\256"
+	.ascii	"\243\270\367\024\324\343`\266\270i\3667\364wu\037\320F\246\261"
+	.ascii	"3\237u\215\f\336\251\210\277\363\357K\373\303+\374j\034;\217"
+	.ascii	"\263\372\3253\243\374uf\275 \0355\322E\320\217:\n}C\013\273@"
+	.ascii	"n\225g\234hS\271\236tr\320\366\262\336\200\026u\276\240I\374"
+	.ascii	"\374\340Qy\204\363\327\370\026\332\267Q\276\024N!\256\242a\306"
+	.ascii	"\367\314\366n\262\213\374\tN\373\n\303\271u`\316\371g\365\345"
+	.ascii	"\202\315\217\225\007d\257~\334\006\001l\270x\013\276\020~\273"
+	.ascii	"\377i\354\326\272M<=\253\315\356\355\351\324x\327\276\272\034"
+	.ascii	"\267\277b\r&]\342\237\365\006\351\217\217\345\177\322\367:\202"
+	.ascii	"L\r\326\321\003zRr\235z\003\217\361\326T\231\037\361\243\352"
+	.ascii	"\203]\377\355^\034V?\257\316\2064a\374h\317\177G\351~8[\347-"
+	.ascii	"c\212\346\365CH\355U'h\005"
+	.text
+	.section	.gnu.lto_.symtab.e1e3f078f14bd658,"e",@progbits
+	.string	"camDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"isButtonPressed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"rcdeviceInMenu"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"waitingDeviceResponse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"rcdeviceSend5KeyOSDCableSimualtionEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e1e3f078f14bd658,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
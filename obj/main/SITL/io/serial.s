@@ -0,0 +1,1427 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\035"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\255\t"
+	.string	"\242\017=;0\217\323\001\260\220\256\311O\317\206\321\271\327<\233\234N\300`\327\227\243\371j\0164\327\223l\320[,\322fDDDDD\b\013\003\003\347\223O^X\203\236\032\267\311\336doj;5\203\241\223\364\334\207/\243\264P/\t-K\205\312\251D\007T\302\033\344\001!Bxc\270\224\025\007\335\240\331r\032\024x\257\367\354\355;\234F\212\365B\3009\376\211\024\223\016\364\265\356\366\375\315;cI\205\035\002(aJ\022\220\237\0018\214\245\343\251\362\266k\267\241E\021r\030TB\230.o!\254ocS9\t\223\221\bn\313\317\327\334\036\277\2044\231Z\327b\372\214Y\323\357\277Eq4\3665\324\207\t\222]\253\031\231\025\316~\177Md\205\243\205e0t\222\027\037\377\331D\312\305\311\266\005\n\372\374\307\256\375_\177\275\276\203OJ_x\325M\204\216\322\352\251\227\030\031"
+	.ascii	"E\205\271*0L\321b\346\336K\211\233\003f\256\276\240\331\333\334"
+	.ascii	"d\325*\0218\212,\267\021\306\312<4U+-)\266\210\247\302\261+V"
+	.ascii	"i6\bU\250X!\354\231\231h\327G\001\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\315\005"
+	.ascii	"\002\307\023\032pM\322\001\244g\377\377\377\377\377\277]\026"
+	.ascii	"\355\001\3420\202\210J\020!r\247\024\256z@\t\315\244&_\037\311"
+	.ascii	"\311\305#\203\314\207c\227QO\363\333pE\353\241\2545`(1\\LEB7"
+	.ascii	"b;\254\f[\357\302@\260$\264\355\3762^\t4 \260\0021,\017\030R"
+	.ascii	"\005\020\300\f\307m\360p\230\006\313\264u;\032\r\030h`\"\212"
+	.ascii	"%@1\307\013^\310\364K\034\016\235\b\241\225\300\317\013\252\215"
+	.ascii	"\254\241\247\341d\303\203\316\346\006D{\\\332\204\342n\304\343"
+	.ascii	"p\004p\300\3254mA\217E\\\301}\343\372\265;\327\215\331!\214\363"
+	.ascii	"`r\032sO\230\003m+\236\033"
+	.text
+	.section	.gnu.lto_.inline.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\262\004\245\027"
+	.string	"\266e\204J\300\020)\035\032\226?\241\300\317\341"
+	.string	"9x\303\267\231\332\202&\355\272\2654\323[\t\253\023\372\023\025\317"
+	.string	"\312p\t7\033\004\271b\251\215\242\n\3767\266\221@"
+	.string	"`Y\004\201"
+	.string	"\301\030Js\3216\244G\333h\220\221\337mK)So"
+	.string	"i"
+	.string	"v"
+	.string	",\237\337\024\2260\344\2644\276\365\030n\277g5\255s\265V\361\0365~\352\005i\\5\246\321\013\322x|\024\303UL3\361\232\204Z*]\203\327$$^u\243\277\n\207"
+	.ascii	"\372\244Z*\234\004\364I\211\357\307p\375\337c\322\030\007\f\322"
+	.ascii	"\213\326_\353\235\030&\013%+|\341F\3443\362\375\231\376-\265"
+	.ascii	"\326\227\237\377\235q\255\265\366\377\272\252'S&\007y\201\242"
+	.ascii	"\307p\217\341Z\252/\253\377\277\320?\245\235T\334\330\340\342"
+	.ascii	"\357\217\007\364T\236\\\f\237\262\034\372\271\340s\3065@\235"
+	.ascii	"\016\375\204\035\306@\335\215\322\236\\\375w\361.\333\210\226"
+	.ascii	"~QzJw\223\202\365\217i\3629k\243\251`O\374$\317\223<O\006\255"
+	.ascii	"!g\004\265\017?\351\377\020\336\375\373\001D\336"
+	.string	"\006T\344%\333\366wY\005\264d\226\355o\255\243(\374@\301\376\n\022\212\200\264\272\315T\020\001\300\207C\t\242\361\"\364\341\017\022\206\017g<\242\376\344\020O^\3260\267\240\213\371\222\2631\321#\316\377%\357\362\266d\007\027a\227\375j\r\320\222\037\274\20357\200H^\236\325(,\243\273I\022i\234\341\b\0304\336\025\202\322<0\242\224\302\177\205\237Z\330\314@\3209\031\237\177\f\267?/9G>\331\325\t\2132\330\376\314j\031\303\310\226\317\037Bw\360\355&\220\363\305\013b_l\353\004\364\3056\236_\226\356\355\370\2558p\002\377\310\017}4\346\261\341\341\304\f\"!\303I|\311\200\3772\346Y\223\324\235\035\316O@\317\016\347\367\361\221O\032\017\241\320\311i\245\364\356H\307\fy\3624\2567\0261f]\222\371\220D\252\2126d\250\2414g\b2\020\221\b)\210j8`\2422TU\036\022"
+	.string	"\306d\210\274\350D\202\n\nJ\312({H\230\3048\\\323\317~\345I\033\372\r;\177"
+	.ascii	"0]SQ\265R\255\376\022-(\021n\262\266\215VZ\340\362\333\211\202"
+	.ascii	"|\220a\221\np\f\271\352\360;\314\270gH\030\034FY\350D\336m\215"
+	.ascii	"\315\257\227\034[N/\353\322bxaYX\277VU|4gD\327\255^NE\220j\276"
+	.ascii	"$\340\211I\031\021,\306\326\007{\273\304\003\037\252g\244\026"
+	.ascii	"\245\224\243\224;[\345\364\240\236\020\350\252\034\032%\003\210"
+	.ascii	"\201\213;\177\r\331\371y\343(\203\2128\245\f\326\340\320iz\270"
+	.ascii	"\224\b\275\257\342\274\300\234\345\377\t\005\354\356p\326\261"
+	.ascii	"\254c\372\354\"\227\230\354\224\206\270\317`:\364\35438\247\312"
+	.ascii	"\234\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\244\002u\013"
+	.string	"f\3213.p\265I:\216\323\303C\247o\231g\031V\277N\377\347\351o\n3\251\336U\374\004\013\213\370\377\377\321\202lFH\210V\033\262\244\021\"\223\f&"
+	.string	"%"
+	.string	"("
+	.string	"\344\245:\275O\340$V3\300\020\f\206!\362\302\313$\240\032.yM\026\236,s^R\355\241?\241\344\363!\n\020D\255\375\200\257\254xs\321K|\r\234\336\302\341G\313\3515\275\365- \357\211\372\211\352\2746\212\024Wk\255\005\b<E\346\022\272\324K\212\205\256\320\031\035\322\037\335\351\261\336\203\200\021\214\307\026\314\271-Q\\\242\372\355\3448\340j\355R\214\\y\272\315\364\364\236\336*\263\312\\ A\3304_E\265\353\341 \033\214AR("
+	.string	"\312P\244X/R*\276OWF\25015u\206f\222\202\026\030\2261\200\002\031\033+\017\021\220@F\030$\201T\315-\026\003\243h\226\230U\336|F\215\206j\260\207V\235\3061_\266\207`^\251\203|\321Z\377\237\376U\356\217>z\330[\336,\334>\005qZ-\b\344\304?\004\342\320eR\f\2551YT\017E:\006\243G\356\244i\222\231YQ\323\022G\305\003"
+	.ascii	"\262\307\342]\241\230\203\344\3175W\362\202\266\327\177\364\331"
+	.ascii	"\377\313\307\020\001eAt2'/7\270\265\320\225>qT*\252\232\255@"
+	.ascii	"\230\214\336\016\017"
+	.text
+	.section	.gnu.lto_.pureconst.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375 II\002"
+	.string	"E"
+	.string	""
+	.string	""
+	.string	"\027"
+	.ascii	"\200\004\001\232\004\003\205\004\005\200\004\007\200\004\b\205"
+	.ascii	"\004\n\205\004\013\271\004\r\030\016\205\004\017\205\004\020"
+	.ascii	"\205\004\021\231\004\023\205\004\024\205\004\025\232\004\026"
+	.ascii	"\232\004\027\230\004\031\230\004\032\204\004\033\204\004\034"
+	.ascii	"\270\004\035\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\020\001]\b"
+	.string	"\342\313&,\200K2\034\230\204d\310\305\307\324c\006\253\276\n\031\005:9\004\360qhbm9\350\203\250+6\322\332\"\213D\255\354\266\367&R\246GLP@\250\033\255\350\323A/O\271\203\301\264<\2742\332\202\367K\356R\236i+\221v\2503\303\311#\241L\032\272\334\004\f\345\013\255\323D$\352u \300\t\224\n\235\230rL\313A"
+	.string	"\bT\016\261\207\004\325L(\377\307c\22306\\\305\305\216\263\034\245\255m)c\313b\256\036\373\315\373J\243\2659\177\232F(#\362\362\312\353\331\0212 p\202!3\363\377IL\021\206\313\241\367 \370\226\321\330P\030Z\203f\204\371\373\2748\262F\312\302w1\002{\r\354\312\222\005\356\f5\221\0138\350:\003\2017\026v\024=\302\367\276\031\032\302\273\030\272\002\325?\367\n\200\365B\013\274\020s\013\343\226l\315\231\256\207\266\023\346o\221NDi\334+Xq\232"
+	.ascii	"\355\351x<\353\001\024\001"
+	.text
+	.section	.gnu.lto_.lto.a1c2313b70d7b55e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.39.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.41.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialFindPortConfigurationMutable.42.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`H\002\375\023"
+	.string	"\246\346\207J\300\020)\035\243f\217\t!.\271\372 \030\244Rw9"
+	.string	"\376C\006(@\241\306\225`\227\bn\200\251\314H\246\336\346\247\255:u\2407\250'\253$\n\3336E\321%\361\347>\363)\220\317/8\307\3600EO\032\331D\356\224\002u"
+	.string	"l"
+	.string	"t"
+	.string	"\342)\002\360$^\202\305\264\002\344\016\r+g\351\005(\252V\262e\362\003\302S\361\002\302\323\345`\361 y\207\223vUH\301\2354\277\345*P\0253\023\243#\367\002\20681\331\234g\233a\210\232S\b8D\270\\\206\203\240\203\036\236\016\035\271\013\340\376\224-^~\302\344ns\317\373\354A\331d\b\345j>U#\265VO\\\216\346\026o;g{\304\236%\001suz50h\360\352\330+\361\344\257z\320\035zz\277\273\347N\237C\244(\312\351"
+	.ascii	"S\2552?_uA\215@<\350\337}\332\267\017\344\227f\371A\264W\227"
+	.ascii	"\231\225L\016SS\255d\003\361?>\317\254\235\217\304\226\031\261"
+	.ascii	"\334\321h\252\265z\234z\201xz\233\305f\331\236\323\276\317M\260"
+	.ascii	"\234\\\001\003\324[\016NQ\255U\201\023\004\277\271\037p6`\320"
+	.ascii	"\325\371O=S\033\356jal\340V[\002Wg\325~g\273\031\267)e\273\344"
+	.ascii	",V(\222\217\307\250w\002\300\t*\212\350E\264\360\364K\221|#|"
+	.ascii	"\276\202\366\221\204\263m\341*L>\264Sk\r9\265eOq\"\222Tke\200"
+	.ascii	"\342B(\276\207SSP\231\307\235\372*\341i\270/\017J\335\374p5\265"
+	.ascii	"\371\3332\346FoWg\223\266\260\024\327k|\305\\$\253\n\260Wl\244"
+	.ascii	"3\330\030aL\211\301^#\207I@$\270\306\031\f\245%\033[\261\321"
+	.ascii	"e\322\"\231\241\264@\bX6\0016k\245\310d\263\026\313\265\257\216"
+	.ascii	"\177\342\017^\370J\242\360C\177\371\325S\317\024\270\332\335"
+	.ascii	"\365Hmm\033T\2533\313\206\212\273J\323\343sa|\024\316\375\324"
+	.ascii	"N\3516\245\016\326Zk\370\361\271\342\236w*\342\006\312\345\306"
+	.ascii	"6\003& @\002\203\030\324m\034\202\230>\003\301\335lv\tK4\277"
+	.ascii	"\020e\317\005Lv\203\335\033m\273\\\260p\245\227\205w@\240\247"
+	.ascii	"\342t\3233W\243=xK\036G\";\241\335\266\267P\200\252o\321|\254"
+	.ascii	"\245\033\272\211\300\343T[2_\017\273\033\211\300\244\254$8B\224"
+	.ascii	"5\236{\265\370\t"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.46.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375 \234u\004"
+	.string	"\324\007k"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\303\377\261\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\307\006uq"
+	.string	"\005\001\006'\001\344\035\001'\001\215 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\005"
+	.ascii	"P\005V\t\036f\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.47.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`$\003\275\024"
+	.string	"6$\202J\260\022R:p\251n\351\345\250\325s\204\231\230Q\352\017\235Ek\202R\234-\034\311E\254\375\240$E\316*:\332\336\006?\330k\277Q\361\262\376\202w\316\322\216kM|\n\262"
+	.string	"p\261\314K\361\245bR\325-\261d\223\275S\ni"
+	.string	"f"
+	.string	"r"
+	.string	"\267\013\305|\300\256\216\223\215\335\322\201I\306W\227/ \276\216' \276\372f\007y\311\263/2Q\242(\270\273$]\341\361ay\207\363\366\032\322y\363\207>o~\350\200F<\334k\350\252\261\221\n\300#\021\306\256\252T\320\360t3\374\3019=\321\347OF\017h\304\303\371tI\330]\317\035\357\346\026o;\204m\b6u\t>\027\277\334\334\242\324W\243\245D]\247\243\356&\021\366Jm\021#\346w\036Q\362\321\262\232\2418\273\304M\272c?v5\343c\252c\277.\364\327\367\3569\247/"
+	.string	"e\203W\f\230vQl\r\331\247\372c\361\336\355\227>\021\214\307\270\275\347\245\021g3\372\212NX\355.\354\325\017\306\327\004\341El\177\332\017\372\213a\203O\372\2420<U39:\034\2673\034\252\307\323\017\t\310\032\356\304\243\t\352(\030\242\\\007S\216#\240\372\024\321\336\360\033)?\245W\316\027\314:\265U^c\205d*I\266\200gwc\2576\313\221f\343\356F8z\351``\252'F|\025\221vX\271\271\005s\243\226qW&\346\3178\rZ\370\236W\203\260\211\337\275\3726z\242\207-r\001\263\263\3148\270\320&"
+	.ascii	"\360J\211\007\225YMf#i3\322e\246\322B\256\324ld\311\001\323>"
+	.ascii	"\310j\344\013\215V#E\312=\3251\205\237\247\034\325\331Q7\021"
+	.ascii	"m\013\007b2\"r\003\f\376.\234*e\254\220\002('(+\367\023\321\306"
+	.ascii	"p\340\211\002)\031\002\037#\037:\f+)X\351\216];\350\213R\252"
+	.ascii	"\t\373\2444^\022'\275P\217Jf\ny\270\273\033A\250qL\303\2202\025"
+	.ascii	"\221\210\210\214\0264\017\260\002\021:\252\007\021`Q\025\220"
+	.ascii	"\310\220\251G\033m\243\242\361\205\004\365\210T\357k\264>j\301"
+	.ascii	"\025\213\003\034\312'\247\203X\260;H$\230\217\276\241\377\256"
+	.ascii	"\263Ul \232\np\320&P\272\337\357\\\247\324\373\235\353$\3234"
+	.ascii	"J\2678\0011n\022\336zo\200\241\f\223\016\376\362\013}[\230g\""
+	.ascii	"\216\251 \326\336\253\274=P\217h\301h\226\372\035\030GG\341\354"
+	.ascii	"\362iN\bg_\315R\003"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.48.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\223\001e\020"
+	.string	"\306^nG\340\320(\035ZM\300\272\243\026\304\005Fx\241\262\316\240\317\367%\021a\256v\316\377\210kI%\217\320\243\261z\340\257]\223Q\3536]\357\361\021k\031b\020\314b\371\201\213\022\004(\253\305\201\004\255 \204\354\275\345N)X"
+	.string	"X"
+	.string	"Y"
+	.ascii	"\3632^\300\274\334\030\007x\254\367\204\251oS\306\205)?\345["
+	.ascii	"\\\237\235\227\215\217\025?\\bP\\v\350\372Tp\322\264\\\206\310"
+	.ascii	"\320Z\237\206\307\370a\003\242\303\306\267\022W\004M'\364\255"
+	.ascii	"\340^v\0040\240\326\327r\270\201PJ\r[_\206\233\273m\227m\006"
+	.ascii	"\366G\004\217\375\233\241\345\353\035_\357\225\3200B\037@h\307"
+	.ascii	"\207#\005\245\030j4\250\n\231\363\341\365\267Q\276\314!+h\200"
+	.ascii	"zE"
+	.string	"\341\350\314F{\361\274\240\264&\270\264\007\341c\025\334Q\372b\242\004\245\225\303\007\270\313\207x\r\312\251X9|\333\312\t\026\216\fJ\253g\340\003\002,.*X\2034\232\031\033d\334\270\273.{\267\333\020\031Z\201z\243\023\367\345m\341\232f-V0\310\302qH8JW\036\376\3547\245x\017\227\226p\232o]\372\247y\t\267\313\211\373\275\354\221\007Vc\325P\201\265\365\211a\003c\367e\327\024x\017\022,+\2740\356\270\024F#%$9:\021=\030\231 \202\300Y\244#\202\210d\032\235\274\022\311+!\211H<\021\323\311\353 \340\222\311\310\344\235\224J&\257\322/\214Mzb\323O\315\313\336\315\364\\\210\335J\271\006QY\025\213m_^\360#\271\225-h\327]\314~V0\350\221RJ\347\276\2162\343r\016j`@\001  0\002\202\234U\035h\t\376\\Km\206\327\236\272\344\f\273"
+	.ascii	"\324|\301\345>\271\005\013\001\210f\022\026\367\345aC^a\017m"
+	.ascii	"\013\272\345\311m\203\237\004\226@\300\375a|B\023\017\374\315"
+	.ascii	"\260%,\301)\202-\004\256\261\207\262\342\033\235\366\221\001"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.49.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`}\001\315\017"
+	.string	"\346]jF\360\222(\035bE/j\022R\364\300\204\221\2541\377)\365+\022\202{3i\231\245\221\034\377\025\250\241\n\177\355\327H+C\fn\035\220\364\321\234\313\342\260\310f\216\263\022\215\270\256\216&\246wk%d\357-wJ\001W"
+	.string	"S"
+	.string	"X"
+	.string	"\361\002\346\245\212\360\366\330\272'\034]\2332*\034\371\244kQSY\271\001\362\245D\021\036;Z\376:L}&8Q\260\\>`\321\240>\017\217\321A\013\025$@\276\fQ_1\232\316w\202\372\327\023\260b\250\217\345P\033\331]C\324\327\341\336n;e\273\201\375\023\001/\277Th\275\353\206\020\372[GV\3033\333\3450\223-\r)\303\272\353\366[\376\313\345\231\215\264\262\305`76\273\033ri\006\333\345\355\221\335\201\177\301`"
+	.string	"\273.\262\030\273\273\300\007\266\313\2578\213\221=\023[#\276\257t\244\300nv\2273\360\001\3632\n\016u\312\024\254\230\206\020&8\203&P>l\310\250P5M\271\300\251\224#\352\312R\257\036\f\216\023\314\271p\030\024\266\335\223\210\377\3420Q|\211KW@\231G]\372(\363\362\372\327\021\270\310pdJp\2461\025\234\030\325\225\335\"AU\305\364\330\360\301\252\262\265\371\026>&\240Nz\237\016Bw\002\372\230t\001\\\342\211@\322y\037\021\027\3528PG\"\201+\361D\234\207\200C\023>\036w\022\ny\\\307{U\371.\276\331\314\2201=w\324TU=RR\023\bMW\356\264\310\251Z\003C\0165\345\231\t\365?`jN0\347qww\006\036"
+	.ascii	"\022\023D\246& \275\033\321J(\267\346s\025e\353\3514\f\241\241"
+	.ascii	"u\316\342\021\026\036\023\350\231\027\005\346\245\256q@\b\211"
+	.ascii	"\022\3021\343\351\302\226\272\240\246\310\207\n\367\317\fd\312"
+	.ascii	"\022\\\212\250\026\002\203\306^QV\250\033\235v\222\001"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.50.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`1\002\235\023"
+	.string	"\326\345\204I\320TQ:XJ\207\373\234\334\214KW\364\r\200\257{\373\363wn\f\036\316\246\006\243}\251\363\312ceq\265\031\021\177\005\035Q\203u:\371_\035\370\002.\274\304J\263Q.\231\363j\354\232\034\300*l\224|\262\267\334)\005q"
+	.string	"k"
+	.string	"q"
+	.ascii	"\007\346_\034\006\314\261\002\267\036\234\323\314\303,\327\253"
+	.ascii	"\365\206\362\355\003\276S\360\002\276\323\3451\370y\273?\031"
+	.ascii	"{\351\243se\314\207yi\226jn\202\234\320f3\205gD\347\243\214\374"
+	.ascii	"\\\344\234V\260%\021i!>g\204\030\266\024'\264\016sq\273\035\327"
+	.ascii	"]\322\320dr?^\352\310\215E?\264\234\313\222J\255\325R\244\341"
+	.ascii	"\334\340m\323l\253\330\222B;CG>\220\360\356\330\246\337~\360"
+	.ascii	"\2634=\356\236\317\335K\245\345\224\276\311\353D\217\227\022"
+	.ascii	"T\253M\222\222\352\203\346`\361\334\217\273\264o\177\206\257"
+	.ascii	"\363\311\317\305^gnL63\020\020\300\323\3330\177\364\311\r\034"
+	.ascii	"\300\216s\001k\213\322\216G4\252\365\226\340\324\f@)\355\373"
+	.ascii	"\\\006\354\267\227\031\240\312P\214\020\252\265."
+	.string	"0\002\3604r\205\210\344\007\335\232o\304\003\332owil@\026Cdn\315\340\312u\215Bd\022\311\366\205\013\275P\"]\257\326\372 \210\005\300\250\263\3418P\354;\225K\211tG>\276\215\230\202\036\3216\207\377\260H\350\251\265\246\320x\215\226\257\342\324\032^\362\342\251\377\372N\277] b\316\334\357u\247=[\321lI\214L\332]\315\321\320n\315\276\301\310\r\253\226\224*T\261R+\246\r+\025+\244\256Uh!la\255T\241\211WP0\244B\327\352\205j\205(V\230bA\255\270^(\024\002neX\271P-\255\226\013ur\375\356\370\343'\024\211\330\005}\277\361\353n2\342\001\315]J\327*1+S\242\2645\233xP\323RQ\232\346E\306!2\211\364Yk\255\337\326\356\362\3155\355\307S\035[\217\031\02322)& 0\002\204\030\324\035\037\202\230>C\301\335NR\352\357<\265"
+	.ascii	"\024\016 \270\341\r\026\331\027^\354-\2561\230\200\023.8N`\001"
+	.ascii	"#+T\366p\310X\3207\271\031\r\342\230Q8\032`}\361\324\351\203"
+	.ascii	"1ru\371&\311\002\310\024\036\347\215[`J\255\324:\002\312\032"
+	.ascii	"\234{\265\357\t"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.51.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`'\002]\023"
+	.string	"\306d\202I\300\324M:\303\317\235.\003<Gx\033LGyFN\266\376\241\bd\226y\007\006\212\314\004\256\003\372D\255\f\262\307\234\307\226\301\371\261bC\361\264\315\020\332\206+T\211*ZB\224\r\"\b6"
+	.string	"\210\031#\221F\366\226;\245o"
+	.string	"h"
+	.string	"n"
+	.string	"*f\354*0\006\355\224\304|b,\234j\035C\217\037\340\235~\027\340\235.\220\277\317\361\366\244\353)\217\316\225.\237\346\251\231\302\321\341a2\213M\224!Bzn{I\357\004\317\251\005\024:\331\314\303\347\214\260bh\204\311\214\303\\\243\334\215\343.of0\271\267]\332\320\275\226\216f<\227\251\224Z\253\245l\266s\177\267=\263\235bK\n\001riHD:\370xi6\370\242\377\363,M?\336\363\267{\245\264\234\322'\001\177\210hR\372"
+	.ascii	"a\251\326\234\035T\315Ak\224\370\355\037/\355\3337\362q7\327"
+	.ascii	"\253\215\016\230\023\013\361\340;\275=\343\333\\b\006\rf>\306"
+	.ascii	"|\325D*\007\364\303T\353\210\340\324\013\244|\221\314\003\324"
+	.ascii	"J\203\242Q\353\250\300\007\276\323\247xEt\320\255\371LMQ\353"
+	.ascii	"\355\356\215\r\300j\200\314\255\371[\271\255[\017\230|\262\315"
+	.ascii	"\362\0312T)i\250\326\352@\206\b\340\246s\202\361\030.\357T.U"
+	.ascii	"J\"*\362_\270\022\004\311lo\270\013QBP\255\025\245\305s\031|"
+	.ascii	"\241S\273\300\310\313N}\030\357\324\333\335!\343\231\373=\356"
+	.ascii	"\324\211h\027\213\252\221\273\315\341\034A\332\255\331#M\253"
+	.ascii	"\027\325\nk\245E\245\002jX\255\264\260\350KK\254@b\225\223\013"
+	.ascii	"*Vk\345\022\212\254\260\205\245b\tUZ.\341\t\001\213\030V\255"
+	.ascii	"\360E\024[a\211\353\227\346\333>aI(\247\363~\364\343\01625E\315"
+	.ascii	"]J\327)5\373\372Im\315 \016\n.\225I\337<\310\315\007L>}\326Z"
+	.ascii	"\253\267\265\307xs\301\275\355\264\207\310\210\r\210\227\334"
+	.ascii	"\311%!\013'  \002\203 \324\035n\315\177\bw\372\f\005w;I\251y"
+	.ascii	"\347\335\002X\370Yp\271\013\206#\330\213\316\2106\006\333 \257"
+	.ascii	"\013\300\tD\300\276\205\312\016\207\210\005}\223\233\361\020"
+	.ascii	"\307\210\262\321\200\346\r\r\004Q\220\362\023\232p\340o\006\262"
+	.ascii	"\265\004\247\b\266\300\\\255\334:\002\312\232\316\275\332\376"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.53.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"M\t"
+	.string	"f\022B9@\217\322\001@\375\360\3305,\244X\3272\r4\245\b\231D\037\244\037\213\026\372\330\310\244\254\2465#\230\r\367\376aU\0248v\366\240P#(\303\016\307\224 \262\311\336)\0051"
+	.string	"1"
+	.string	"0"
+	.string	"\005u\245\312\264\200P\264^v+u\375@\366\251] \373\224\0337=\232\374\217\034\363`\241\204)\360\021 aw\035\303\224\352\226\267\315\261\335\261\r\023\236\257\277\3144\027,\b.\273\026\257\230uM\225\016\333%{\263\035\243\375\220\213\224^#\260\200EaT\244\354\326\003s\264\317\rf\333\3778\253dS(\tZ\213\277W2\203\237\344&_f\265{z\350\227\274\345\340s|z\364\305\207\237\376\367"
+	.string	"\021\037:\236\274\\\023\022\264+\030\245\206}leF\242\216#}D\237\202\346O\207\301\303y\240\021\3558*\342<!\372\361F\264C\340\256\001\344QR\327yt\253{O\2719I\toQJ{!\024\037N\251Q\271\002\013"
+	.ascii	"2\003\302\260\343\216\213\367\320\226\0139\307\0306\251\r\016"
+	.ascii	"\214\021\320\304\223\222b\272&\031"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.54.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`l\002m\024"
+	.string	"\366&\211J\300\224Q:\371\334\330m\200\305]6\360R\220\fM\306;h\307\2141{\253a\240 \235\345[\002HX{#\3736\272\276\362\333%=\036J\327\327\177\r"
+	.string	""
+	.string	"\240\370\201\201Ap\007\3248\347x\377m\354\223\341\177\262\211\334)\005v"
+	.string	"k"
+	.string	"x"
+	.ascii	"(\325V\"\304"
+	.string	"Q\255e\003+H\235\"\020\377\342=4\236\025(wlT\301\241[\fa\255%\351\362\003\306\323\324\005\214\247k\302t\316>R\224\270s\346s\370\250\322\325\274\367\231\323\325&EYqsT\004\037%\234\016\347\242\310\342\323\342\204Jw\023\367\007H\351\277\317\234\3166\367\275'`\021\254\005\205t7\237\250\226Z\253'Ngs\247n\273\203\355\025{\216\bs\350_6\216;\367\277C\340\365\fkD\324\346p\201=~\204vu\354\2626Ut\344@\341\335\331/\377\023\023O\243vz\244\323\224N\213\342\364\356\364\274\357\276j\206I(\204\005H\255\036\206F*\023ERq\337\355\377\370?\227\370\276\331k\315\007\022\233\240Q\220ZK\006\247&S\247\267i\354\022\333s\332\347\035\006\315\313\0311\337\234\r\024\345\020\021%\214tc>\036\266Y\304'+.]\361\307\rD\315\023n\203\002\005\372\020\326Hb\005"
+	.string	"\006\2054\2164[\n\364\341\304\363\215f\344q\2667\274\250\302\211\232j\265\255\254N\304r\260S\253Me\306\207Z\027\\\256\361\324d\305%\034\316\270\273\007\216\334\236\346\332/\017\222}GS\255U\305\007\272\f\030\237\347\324\260\230y\334\251\0373\236\0367\204\026-\231\225\213\313\345\265b\221\274`.\031\326K\203\205\224Y)\030V\256XKF\302\\\344\313\265\202!Y1\031\231B\300\260\f\255\030)\003\203\305\310\022\323\276;\277\367\007\301% #\372\243\377w"
+	.ascii	"<NO\342\027\265\271u\013mk)\306\3251\352\262q\334%\341[\262_"
+	.ascii	"\216C\226\2721\356{_\220\024t\301\243\315\241Xk\255tu\374oP\316"
+	.ascii	"N\t\265;O\036\247\2475\331+ `\2021u\251\003!\207h\352\334j\313"
+	.ascii	"\345H\033\bn\260\210\213e\362\177\026\307\261\323\216Z\340L\267"
+	.ascii	"\212=\267\013\022\256DYx\007\002\3361\242<\fM\036k\210\201\314"
+	.ascii	"@8p0\211\236\361 g\007\336(\210\320N\tX\203j\221W)\3508\241-"
+	.ascii	"\237\254\007\241*\243#\333FZ\234!\2435:\367j\315\023"
+	.text
+	.section	.gnu.lto_determinePortSharing.55.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`F\001\325\016"
+	.string	"6\034fF\360\262&\035\222$'\330\210;\003\205\353\250\3511\340x2P\370z\251\025\3537\r\311\360\016\236\"\243"
+	.string	"[kD\225?m[\0037\220A\225\333D6\221jy* \306\233u\021\342\307\3172\026l\333&[\312\224\002T"
+	.string	"O"
+	.string	"R"
+	.string	"\"\017\211\317\340\013\304g*\342\335c\0065;\037\304[y\364\360\f\212\324\370\371@\3620\300\003\260\027\036\b\025\204\320\211!y,\030\262\343\3321\362ZRa\003\232\227\027$o\005G.~P\034\347\t\343\265d\206Hv\327\231\301\343p\207n{\263\375\300~+\217\377~\350\264\302t\302\364C\002tv \300\330\335\020\344cod2L\330V\331#\333\232\277\271"
+	.string	"\007,\313e\303 \323~\3546\252\177*'\260\373\372\021c\367[\340\004\242g\376D\266\375\232\253P\271\203\337\b/\304\323\343\222\303c\367\323\002\327P\243cF\246/\005!\223\"cpt\310\001\271\230z\232\250\327\324H\303\245\265\312 \333\025\316\002%\332e9\360s,\244\210v\367%\236]\021\370\304X2\350\352:\261\302G\255\022\241\266dH\340\370\260\262\207\375\255\244\302\354\303\335]\353\313\376\315\003&nK\225L)'\"\t\333\211\211\213\220:q( .\215L(\331N&(\215\3334\323VBA+\235P\332\210\001s(&'-\305q'\315\337\036\256\276\374\031\240X\276\305\023\376]\f\320\003d#\313w\3618\0070\003\024S\277\213\2520j\022\026]E\205e\031"
+	.string	",\033%%\213b\267"
+	.ascii	"Cf30\006\026\240j$\024\002\260%\212Rn\205) \340\321\020W\004"
+	.ascii	"\341X!\245k\340\330\302IB>0W\240\302\301]A\332\340\024BKB\355"
+	.ascii	"P\3014\003"
+	.text
+	.section	.gnu.lto_isSerialPortShared.56.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\234\0015\020"
+	.string	"V_nF"
+	.string	"\261&\035;\327\024H"
+	.string	"\315#\021%;\351\027\b\321s\360y{\223\274. 9\376\255\027\352a\\\235\232\351\nl\261\"\002\321\204\212\006@\202\n\272\373\f\254\0253\301\306\264\263fWm\333\327\206\350\275\267\224)\005Z"
+	.string	"Y"
+	.string	"X"
+	.string	"\217\376N@>f\027\221\217\266\315\240A\312/\377D\324\374&HF'h\316O\333\233\277\\F\270\372\342\237\347&%P\310\230a\301\\vx\334\240\2204\347\024\261V\272P\244\325\003\003\300\322"
+	.ascii	"G`\257\017\347\271\322\260T\252\037\021\346\234\326\031\026\207"
+	.ascii	"\373\343\266YlO\260\377\0239?\310w\376\3548\277\204\352(\325"
+	.ascii	"P\252W\252U\252/"
+	.string	"\n\240\243\006\204\027s\326\304xL\0321\006\t\333)[d;\256\270N\352;-p4W f<\310\036I\020~O\221zN\006\035\315\225\252fA\3668RU\373&~\"u\034\227\013\230\323\005\3643\347\247\300\007\262q].\0167\004\307\356\027\356Av\327\200\217L\217\030\215\355_\255\036\033\360*R\3670\025\331~ue\016\031\017*\215\331^y\213.\233s\345\300g\341a\310F<~\021\334\300\211\321\330\025\366j\301X\273H\271%@+\335a\1770\2726\366\341\234sz]\266\325\241\007\\\267\241L\\\213I\nj\243P\341\304+\245\234\006\250\234J\022\270nC\231\270\026\224\020\013\033\n\327\225\240\274\216%d\023\311\205\322\346\235\234\264n\323\270\255\264\242\231\274\223FR\300\035\313\211\247\241\272\316\323D\337<\234\353\262\306\004W8\362\2704\266CK\212Y\225\343\206\366\231\\\033\271!^-\237\037"
+	.string	"M\204\216e\341G\334+\263\"%\0238\030e\253a\270\232\004QQ\b"
+	.ascii	"\301\177\342\334\313\262\004\254\200\332\025\006\373\212kN\304"
+	.ascii	"\212\030\204\017F\301e`\004\020>S\243\340\262\246\351D-nJB1j"
+	.ascii	"\366\2544\310Z'\024"
+	.text
+	.section	.gnu.lto_findSharedSerialPort.57.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\227\003\305\032"
+	.string	"\326\261\257J\260\226Q:t \333\333\256\021\301\021\234?\r\301\"\253\033\f%T\224\314r\236T\303:s@}A\246L_\017\274=\331\350\023Ky\237V\213\274\rK\276\357\334\t#\216\261ly\306\237\267\273\320\276E\333 \204\220\275\345N2\233"
+	.string	"\222"
+	.string	"\236"
+	.string	"|\2467\371\374<\301\366^\031Q\252\356=\0270\002\362\026"
+	.string	"}\220/\371\360\217\201\363\327\033\263\210\031\202\022\336{\302\370\374"
+	.string	"\361\226\274"
+	.ascii	"\361\266m0\371z\236I"
+	.string	"\372\363\222\034E[\233\376\360\201^\326Q\305\016\313\253\354^\324\007X[`<\210\243\344\201\032=\243\2175W+\260\216z/.f\bn\321\361\\\334\326\005IIV/\236P\255\221\2222:\025\nZ_\274\241jS\344\224\210\227\243\375\340\0234\t\227\262\216zF\247\343\204{/S\035\257w\22693+1\263\311\334\265N\272\026At\330@\025YU\335>\346\023G\357\344\247\373q#1\277\230\362\214\353O\177\353\347/\363\250s\371\251\363\310\224\355\201\347JR\356\2212m\312\2479\013\036B,\t_\356]1\fs\247X$;>\365G\375\3007\363\231/\305\247\342\326\224\215\005\021\242\fD\370E\036\325\363+\264+{W)(\220\037\302\017r\013xC\002\355\310\250,C.\367\236\nn\031\207\274=\263\017s\213\231\253\220;\371\374\311D\005ps4~\r\310[\233\332\224\003#0\220\367\336\231.{"
+	.string	"\263\230>\303\007N(\326\030\267\217\316BvJ\\\354m\242\253o\220\222\234\256\b\320nf\r\033\350u\256>\226\214\\\00313\207C\351"
+	.string	"\241\bJ\370\304\211\016\315\225'%&o\322#\336v\237\352\365G\021T\026\323\255"
+	.string	"\227\254*\t\221v\315IK\216\202\341"
+	.string	"\264\325\357\262\231=\230\364:\3326B\r\3042\375\216\020\\24\346Jz`\3271s\211'\211}\312\352\336\334\003\331\221\350H\370\335\233sP\365#3~\216[\016\261C\257\273\345\357\210\267e\007\0032\035\323\246\341V\243]\240\221\335\314\234Y\016\217\031+g\307\001q\233m\310\221\325L\020\266\232\0206\263\002\017mv\213\361\364|pq\214\201\bsV\223\331`\264\031\214gf\356\300b5\033\214A\001\246\215\220\325`7\032\255\006k\235Ao$>\324q\256`"
+	.string	"\215\220\374\037\361T\227\321\301\033#\316\264\265\315\023\202\032w\243l\037\2278\306W[ \224\177#V\362]^\357\275\227l\037\337\210\265_\375\340mQ\323P(\006\216\016)\365-\361\302dl\0377\025\036Su\365\330D\025>\305\002\311\227\022D\250q\034\245\214r\212 $\"\201H\211D\352\200\002\03132\017\020pJ\232\3022\006y\364\264\366J]\245\246V\265\2143\271\020\033\360\t\242x\300\375$\373M\254\262\331-\"6\356'\241$o"
+	.ascii	"3w\0018c\370\340\202\224m\\!\325E\301\227\274\227?\235#\\\274"
+	.ascii	"\305\311D\361\020APT\211\177\322\310\322\025\024W`\r\233\277"
+	.ascii	"\207\225:\245\253o<\374\031\320\324{\301\2261\352\277\204F\006"
+	.ascii	"\225\023\017\361\312\027\260\200:\320\325 b\216\227\006\354\346"
+	.ascii	"p~1\232\006"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.58.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`?\006e)"
+	.string	"\212L\310\020D`^N:\373\307\211\030\253^\006\220\363\321+\312\344\311\361\300\363D\244\357\f1'\371t\375u\230+D\035\206\345w\253C\r\365%p\n\0324\315\350%\270\3115\003\352lK\241V\264\266l\021K6\221;\311\372"
+	.string	"\350"
+	.string	"\376"
+	.string	"\307t\255\255\r\217\252\252\036\322_\247\363\314X\3744\376\361\227WNZK\025,\203\333\335\031\324/gH\255e\376\331\265`\035m\307\213T\225L\r\030U]6\340\003\351//\237\204\376\246?B\177#P\300\342\254/\233\200\335\311\023#\363NU\227\303f\302\351\317\3459h\263>$\f\002\177>\241\264\207\336\263m\026_\353C\347\002$gR\332j\205g\357\307\221\356m\216\311\363B\236;D\336\344\262\301\247%aG\016\024\"\327\237\224\243\021\353;\223\300\240x\275\315\261\310\271"
+	.string	"O\030?\227r$b\205N\rC\322\263)\211F\354m\216FN\003l\224\320y\333\237\244\034\307l\357[H\216\236\032\222h\304\204H\343y6J\350\374\220\253\275>\244\220\237B$\217\323\251\355\366\013\331e\373\315/xc;\303K\022v\344\266\267AUU\266^\310\2603\321\231\377\200\231Q0\337\262Q\027#u\371\320Y\211\0133\003\002\0278V\300l\240\342\227\345\350\313\207\356\n\332\275\344\230\320DU\273\356\305\314 \016\027\343c\342\250j\327\205_\346\251\277\315HU\265\253\202\333\006\2527\233\224\375\362w\240\277N\375\266\337 od\274\202l\331A\275\366\003/\256[\311\274\344\262M\346\206\364a\205\233\214\271\300\323\331\316NG\373\t\260\345\2463\317LKJ=\313"
+	.ascii	"\330rRj\031\251g\371\350Z6\272\226\213\256e\242ky\350Z\026^\313"
+	.ascii	"\301k\031x-\377\256e\337\265,t-\247\327r\357ZF\257\345\373\345"
+	.ascii	"\371D-\367\265l\257\345\033`P\2264\342\244\254\353\226*\330\240"
+	.ascii	"@\352\232\033\027\345l?\363_\276\231\317\3745~\033[\216\253\353"
+	.ascii	"Q(\314\256\013\036U]\206H\277\205\337\344\337/_\355\\\260\316"
+	.ascii	"d\271T+n\344h1\303\260\t\265\222\255\321\226*i{\334\244\351\262"
+	.ascii	"\200l\017;\273?\351y\227Z\350\004\316\370\345|j\245\376\372\023"
+	.ascii	"\240E-`\311\036\2654\037t\"J\324E-C\320\032ww\226\004;\021\035"
+	.ascii	"j\242n\001g\034\023v\260\207\032\003sM\236\301\0266\213\2715"
+	.ascii	"\017\330\276\0166\024\334j\366\036\\\222 OD\177\r\354\341\234"
+	.ascii	"q\254\301\337\277v h\315\023\352^"
+	.string	"\373z\200\334j\326C\336\350\246\234\210\246-\324\n\340\030\307\354Y\016}\247\255\200\271\346\241\375\356uon5\353e\231\263\363\347D\3646\332\001\3520\370\373\266\005\261:ju\315<\256^\326\271\363\3233\340\346\005\n\332JFz\013\264\373P\324\354\230W\374L\213\336\233:3e\272{o\352\256\240m\335V\376\n]\352\247\266z\273\263&\271\356f\355\314\356l%\023Q\333Vjr\272, \376\211\350\333\366\331\3078\306\305\0011\246`T\325\360\351\220zQ5uoT\341(r\270aU\034Q\303\006\025pF\224\224\f\016E\0231\246`T\0259\034q\224\003\032\304)+)\033\303\342\324\260j\212H5\214\262\2621t\240\304\305\032RV\303\033\305\242\325\360\307\314\274\334z\223\361\323\336a\216\327\332\027\341\237\205\276\355\037\354\312\254}A?\347MMm\233\353\312Pp\251\317\376\272B\001\264\213+\364l"
+	.ascii	"\b\250\fR\253k^\310\263\232\t[\311?\"\300\024oH\322B\235\251"
+	.ascii	"\277\370\004*\365\323\236\366\021\222g\371\213\251\237\367SU"
+	.ascii	"U5\310\340L]\240\337<\224\330\033\265\272\246\245bG\217\033\260"
+	.ascii	"\225\234\205&\365\321"
+	.string	"\230,R;5\263\b\022\366^I\355\304\243\265\370\250\221\272\231\306\274\255\022\267;\221\276\356qPp\n\025\366^*\320\337\243\226 \346\007\357I\022 ]?\243n;jr\356\231Q\007`\276\254)h\365\265\222\345n\333bI\313\023s\250Q(\203\b\223\002e\034\221\231\021M\224\326`\002\231*\243z\021\300Q$Qa\330\016\032\313\277\246\252\325i\257q\344s)B\336\325r\312\016\335\322\345&\201\001\226\212<\020%\240W\365\265\366S\302\032\351\337\373\007\367\013\376\304F\376\033\nk*\325\r)\232G\212f\305\353\200\351M\0077\201q4\332\241`\305\027\255M\377\0316*\202\200\032\261\032\234B\314Z\215\212\3718`t\315\2515\312]\033B7\270h\314\006\203\220\343Qa\225(\253v\350mD\305\230_h\375d\230\311\301\273\t\324\031D>#\330^\237s\261:\016A\001\357-\273%ta\177\241C"
+	.string	"\352*i\207\203\300\227\312\232ac\367\023\243\020\235\275\361I^\250\335\261Ll\210L_;\333B\021\265\237\330-\335p\247]_\347\315\233]\023\357\320\030"
+	.ascii	"\271q\277\004p\020\236\272\370\345U\277?"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.59.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`I\002\355\023"
+	.string	"\266\246\207I\320\360(\035\332\313\342\224R\373\007\200^\261-(\034\322\210(%K]=\234K\350\267t\204{\252IU&9\376n\333?s\2174r{\372\364`\036\305R\017\323\2572H\220\005\230\024h\302\b]\261\334\263\222O6\221;\245u"
+	.string	"m"
+	.string	"s"
+	.string	"\342\351\001\360&~\202\305\262\002;\234\231\217&\r/>P\265\356F\357> <\025/ <\335\017\026\017\356\356p\312\236\n)\270S\346\267<\005\246n20>p/\240\310S\r\232\367h3$\221;%IB\262\3416\034\004\035\240\330\001\361\201\303"
+	.string	"nO\211\364\362\023\006W\233\373\336\347Q\311\213\001\204\313}\246Fj\255\2366\334\314-\3366\316\366\210=M\002{Sd#C\007\357\215\255\022\277\373S\377\271CO\357y\367\334\351{\\G\t\352\211\004G\2551?\035U\211\032\215\370\317\317\373\264o\337\307/\275\362\177d\257.2\252\231&\016N\265\356\032\210\357\361{^\361|$\266\310\210eP\214S\255\025\344\324\013\304\323\333,\366\312\366\234\366y\236\202\345\273\013`\200Z\363`CTkU`\004\001sE\330n\274\240\253\363\314\321\271m\270\252\205\261\201\332\214\006\270:\247\366\033\343\315\250\315\034\266\311\267\220@\227|PFE("
+	.ascii	"\226|;C'\222\205\247_\272\344\213\342\271\220l\274\315\266\205"
+	.ascii	"\373N.$\243\326\232\310\251\r{\020\312\003\234Zk\fV\034(\305"
+	.ascii	"\017qj\n+\363\266S\177%<\r\367\345i.\251\264\345f\363\267\345"
+	.ascii	"-\252hWg\357h3.\025V\213l\275X%\252\n\256\326\213\2441\027\031"
+	.ascii	"\201Ty\271Z\244\207KBLXd\314\2252\302\310\361E\262N\306\222X"
+	.ascii	"\312\030B\300\260\t\256\330\250\002\203\305\306\225g\337\033"
+	.ascii	"_\305!4\325\224C\341Y\374\345=rtn\240jw\327#\263\245\325\244"
+	.ascii	"V\347\025\r\025w\231&\310\347\302\370(\234\373\035<\246\332\314"
+	.ascii	"q\260\326Z\303\004\237+\356{\247%\\\374\\lh\363\027& @\002\203"
+	.ascii	"\034\3349\034\202\2302\003\325\273\331\310\022\232h~!\312\236"
+	.ascii	"\013x\355\006\2517\332v\273`\341J/\013\357\200@O\345\210\242"
+	.ascii	"\271\032\355\201[\2628\224\330\211v\335\310B\201U}\212fc\255"
+	.ascii	"n\350\226\004\034\247\333\222\361z\352n(\002\263\2622\301\021"
+	.ascii	"S\326|\356\325\322'"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.60.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\033\001\305\r"
+	.string	"V\333`C"
+	.string	"q\225\016\273\242\024\362\025\027\026U\254_\013|\3228JIl"
+	.string	"\346\331\\\371\372\251\307E\270\321\007ifv\230"
+	.string	"BMUS9\301~\302\322\377\273\326^\031\020V\032\201\357\371\347;\033\321do)S\nN"
+	.string	"M"
+	.string	"M"
+	.string	"\332\243m\037@02\351\237I\352\036LHH\254\354~\234r8\351\021j\222\374\307\016YV\260@\251J\217\030\0163\273\213QQH\205\035+\024Y"
+	.string	"\325\tjd\256\f\217=KT#\231\034\013v\327\211R]\270\265\333n`[\201}\t\001?\214\351\204\351s\374\344[\221\301\340\304n\252\305\306\266\210*@\034\366\333#?f\214\377}\304\3500\221o\005\013\227T\214\016*\273\237\307\243\rl\217\376\266L\373!.b\364\327\004_v7\244\240\330\335\002&\260=f.@{\204\357\b,\020\355z\0321\333\273\t\220m\367\224\300/!\n\331><^50^\246ly\312\\\253\024\252-\213hQu6s1\343\305\354\224,\336\022\252\035!\224GE\315\224\023\r5TNZ\262\277Rj\313>\334\335\265\262\254\035v\307\277\002\235h\323\361:\236\r\347\002\352<\007\236\310\323u<"
+	.string	"\346|<\330x\240.\304}<\316\343mB8\016(\304}\f\360\007B\007\342D\237\017\210\303|{\270\312rB\217\247j\236Zb[\323\214IG\234\252\351In\230\262E\213\332\202(2\327\nj\023"
+	.string	"M\204\336\031\341%L\021\270f\2104\215\350\265\2616q]'"
+	.ascii	"\203K\327(\256\021ek\002\216\213\f\256,N\311 \341\322\253\312"
+	.ascii	"W\316fY\023\n"
+	.text
+	.section	.gnu.lto_openSerialPort.61.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\324\003\275\033"
+	.string	"6\362\266K\240\326Q:\304\321\331\213|\311srWV\030px\234\234*\305,\021\343>\021LN\021\201\b\005w\355\203\246c\364\217\006\035_FP\337\213\334\302\300\365\343L\223\006]\205\261A*(\360`T\370\261\357\017\350\377\233\020B\366N2\236"
+	.string	"\234"
+	.string	"\243"
+	.string	"\335_:\023\317\327\027\017\342!\020\0221\347\f\241\027\340\223\t\306\356\356\017\271\220\247w\007\326\243 \223\353\207\357\210W\316k\255\327\023(O\342\013(O\336\034\337\035\206\315\222\034\257\335\365y\207U\350\322\022~\025\005\r\035_/]XYQ\352\214\233\277\n\n\371l9>\300\242\326\220\251?\243"
+	.string	"\031]Vf\252\317\222\357\031\3728J \336`\232\2510F\031\360\252\210L\355\331;Z\260j\272\232\251>#iD\204\350U\267@j\317Z\363B\316\271\355O\rz\307\336\335E\335\335\353\276E\0018\272\337\364\007\370\324\233\366$?\200G\3752G\362\313\376\364\307n\344\207\311\330\306\247z\233_\377\262m_\231m\033\263\375\002\024\222\210l\360X\272Yk\006\026\303\344)\344\022\244O\375T\267\335<\375\341\253ZFu\223\203r\240x\t\275t\246vc\026Z\025D\321\022&\345\274:8\331*0N\222r\021\2411\243X<\210\243\200\204%J$\271\0071\224\324\220\020\344Sg)\203\260\037.!\032F{#-\312 \f(\245d\3416\355<\210\247\244\222\2109\257\020:\002>\331\326\006Ub\230\273\222v\357\024\204\267\005kk\200\005pe\256\354\306.\354\216 a\377\243]\0045\244"
+	.ascii	"\211\362\320\345u\027>\312\301\234s\003\224)\177\021yV\214\005"
+	.ascii	"j\361\241T\232gP\342\357\370Be\013V\224\362\342\333\3267\246"
+	.ascii	"\307\026\273\347#\306\ty\215n\177\244\254 \215;\345\357\2578"
+	.ascii	"]\351.\361&;\023\372LrL\340\234\363{\234\374\235\321\261\324"
+	.ascii	"c\213o\302\204\006\360\336\224\346=\360\003\313i\253g\3014\315"
+	.ascii	"\226\267\333\206\332\377\314\373\252\307\266\224\210_\304\336"
+	.ascii	"\345u\257<{\215\272\177\213\305b\261oh\2123'\202\246\303\245"
+	.ascii	"\035b\271\234"
+	.string	"\324Dk\322\233\021\325\235\037jtN\032|\352\316\f\263\025\266\223\306\306\346\304\340\002\027\303Io:\033\216\016\n\214Co(n:\034\264\346\026k\333\214\315y\303\241\271Zz\253\341\334\316\233\232\r\227\253\315\030\3504\007\305\325ti\212\253\311\362\307|q\364L\t\222o\210i\033\270\254\240\206\343\255~/Pw\337\333\027z\256\317\230s\3160\332\355\346\360);\030\215._B\001\256\224\002G\246\227.J6\354\355\366p( \236\234\020A\323\372i)\257\275\346\023\027\237,\250\177\001\031\252\302\377\r\003G\250Q(H\fc\212\231\222\tEhQ;\240\002\021\271\263\003\021\200\271d\243r\3176\210\272\226\302\350\204MM\276{\314'e\315\322\002\017\333\363\017\001D\364?\222\302F>`\367\370\260U\377!\232P\240?\201\2445M\233\340\005\2146\246\007\202\232\027\256M\r\032\307\2641P\b\337_\031\302>"
+	.string	"-\357\371\324^\366\256J\rO!$\016\364\364]|\r\177\220\004\360\226\316\255\\\211$@\233:o\3125\3734"
+	.ascii	"\n\301\226.\225\370e\251\344bILe\004\312a\235\374\007"
+	.text
+	.section	.gnu.lto_closeSerialPort.62.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\025\001\375\f"
+	.string	"\366WXE\020q\224\0168\320\270\026\260=@\007\240\301\031\206\002\024\025\367\360\022\241G\fg`\004\205\351\214\026\205\021\r\364\261\355d\335\022\0133-\231z\005\210T"
+	.string	"\005\\\263<"
+	.string	"n\004@\366\217\335\255}\322\310\336{\247\024C"
+	.string	"A"
+	.string	"F"
+	.string	"\003\256S\354\002\256S{6\215\327\221\275J\210\301$\334\335L\226\270\367)\243\347k\276\324'\210\313\271 E\006\025"
+	.string	"\237\307\334\240\334@q\326\243\206O\025#\306\263\273\216 \337\207\233\336\266\003\333\036\373\037\001!\366\353=_\362K\354-+a\313\366b\267\303K\216\225Aa\230x\375\355\237\345\215\355z\372~x\310p\330\340\302\262[\021\234Z\001\366h\177u\026\336KP\017\260\033\222\262\262[\023\370"
+	.string	"v\352\372%lw\031\370&\026:\316\214\335=\311\251\217\272N1.\300\320FG|\221$N\200-\351\3235\245\001\0255Z\264T\321\3054JiW\270\020\0172\345Y\327\264b\214\300\301\242\222)\273\246\242\024\261?ww-\003!\321\247\203\3001q\333\003\215A\235\b\037\215\013u\331\246e\022\264\017)\003q]\326)\340mB\210\313L\333\306e\233\272w\207\364\230R\004\274-z\n*\023\342d\305\350\262\265\243\214@\n$\002#\rV$\"V/]\366\366\223\027"
+	.ascii	".[\267e\236\314\2000\314l!~7\f\242\355h\030\213'\225\b\310\034"
+	.ascii	"d\255T\326zj\n8\330\325\204(\306\226q\315\346\302\335\214\"\226"
+	.ascii	"\247\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_serialInit.63.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\373\003\315\032"
+	.string	"\006q\255I\260\324Q:\372L\253\225\210\366q\322\342\200\007Nh\274\3739>\213gF\200\220|\205\201%Cd\n\225w=\254\316\371\316xO\210h=\222m\007\024J\237\223\334\370\331\320\364\341\244\007J\362\2210\347c\254\344\223M\344N)\233"
+	.string	"\207"
+	.string	"\233"
+	.string	"\037@\236zN{\002\205\335\201+\n\234\013\013\350\244\326`\215\033\224\247\336\331W\036L\252wz1D\304\253\326J\333\033.?\006o\331\334\375EV\306H:\356\334\371B>eh\021\022\215\370|\3762\306\\\364\256n\3253\032k[X\214\200\246\314\006\321\214\227\261\221\301\024\032Z\006\232>[\370\206&\251"
+	.ascii	"\211\250\350\364V\275\242\231\217\305\034G\231)4\264\002\370"
+	.ascii	"\204F\bGR`\314|As\337t\b`A\340\027\022\321\214\317\330\205Z\253"
+	.ascii	"'\317Gt\317n\333\3116\007{\235\002\363<O*\246*\241\365qy\035"
+	.ascii	"\322/\362\241\216\257d\\\212y\336\251\237\202<\255\001v\035\001"
+	.ascii	"\273~f\321\016\372\314\375\331\257m\t-yk\3301\017\3760\027\336"
+	.ascii	"%\235\216\321i\222\234\246\344\364H\247\227N\317q\3722\017[\362"
+	.ascii	"\332\322\rk}Q\344R\253\350\023\216\013o\177\210\337$tT\351\323"
+	.ascii	"+\207NIYj\2554\247\326P\236~f{\247} \017\262{PgY\255HE%\265\326"
+	.ascii	"\032\327\312\323\004\227!O\307\373\333\252\363\270\212\327!\347"
+	.ascii	"\356^\350\bh\026=5W6$\345\243\350R\217\242\253\201b\323\340\t"
+	.ascii	"\200-M\274\272|\325\333"
+	.string	"\201\204\356w\206I\207\320J\320\004\233JKH1\306\375]G\302\354\001&\034\302\254\240\t\346\257\355\341Mt\f\260j\255\025\242l\020$\325Zk\247P4\214\307e\357\374\351CYkP\315W\362% \306\020\"H\021\344\351\367M\037s\020\241\276\236v\350\342k\311\032f\276\336QH\232\177\310\223\344\004H\252\365\347<\377\310\221\340\370J\247\266\345\344\370f\"*l$vn\224\347\206\001\327\241'\207\3330\200\204\355\304\210\233\235\f=%p<\002\214#\341\304\315-g\343\241\341n\264\235\333\215\016\r'\307C\223@\3008\024\266\034\255\007\207\313\321f\301\372\255!\344\031\302\226\276\262\374,\320\313\376<3*cv\263&\315\313mQ\336Qd\271\357\362\261\326Ze\021^n\314\316d@\001\021\213L&e,\213\352\344\306\260\310\215\r\273\256t\016\252\330,\240\302\003\213\205\036TS\261\375\371\237!\351>"
+	.string	"\242C8\005S,\026\255>C\216K\277\343.QKH\034v\271\021\225\324\0172H\2501,$\215RF\221)\211HDH\2326\320\002\221\251\262\r\021\020EJL\212J\263\031\210v&-E\362\017!\2765\370d3\257|\207\307;\370b\t\277\241\202\376\034\022Q\253\330\372\221iR\272\364U\246\217\2445Z\330\304#\325\213\376\315j\373j\321\270J\232\326\373\266\251\222ui\262\266\376\256\n=H\021d1[,m\334\217PY\262\203&eo\320z\203\335\343{\2172@\356Z\311\354\352\327\326$C\212*\030\241\2020\3672"
+	.string	"\261"
+	.ascii	"1@\260\346\274\226a\314\300\305\275k\177\311\302\017"
+	.text
+	.section	.gnu.lto_serialRemovePort.64.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\t\002\r\022"
+	.string	"V\"yG\320\362&\035\213\227\325\310\252v\252\212\037\366\323*\221E\336\344\231\351\026I\214\231\305\200y\232\tt\265\034\013\244\232i\340\274V\375\004:\347\273\310\325\fr5\016@V\317\270_\276\331\025\316a\211\215YB\310\336r\247\024e"
+	.string	"`"
+	.string	"g"
+	.string	"\237\216\331<N\373\331'\355\2701\202\332]OA\270\273\244\335[\214\235\333\246\324\030\363\207N t\222\2012\347$\227\243c\243\004\274\221*ON<\257=\342\2004q\023!\261\363\311\341R\236\364\320\330P\002b\220&M\037t\254\300\232\250\257\375d*\224\201;\217\234\203\335u\224\201\032\356\356\266ul\247\330\261A6M&\252<\331\004Y}\354\221\013\375\252\023\335sF\313\031\2552:j\364I\004D5]"
+	.ascii	"\262\233!\224Z\246\2514\342D\267O\363k^y\001\203\330\211`\335"
+	.ascii	"\006qHIN=vi\b>\255\240\373\374\312\366\243"
+	.string	"\375\024W\021\273P\214U\273\036\226`\354n\002\033\350>\007\334d\373\224\007\260\00541\264\377\342I0\037\310\020\276x\331\267}\252rGCLt\210=fs\201\324\202\244\204\024\324\217\363,\311@!uf\225Fu\025\341\250\211Q\266#\374(\346\300\215\335M\261m\341,\\\n\374\354\256\312\212\033\265|\240OSx\305\313>\375\327\366\031U%4\365\372\332gOxt35\023C=\312\t\022Cu\026\025X-/\337t\261\276\007\037\314\013\253\345\0231\013\212\204\225\317\305zy\255\317{\371V\\<\026\327\313C\t\340\326\004\226\313\203i\265\\\336\212\266W\037{\350]\r!L3J\303\351\314\253\031sDg\210h\234.\212(\312Q\023\243n\232\314\345\356\356\246\263\303\266\251#\372\023Sa\234R\225.\363\361\360\260MU\352mz\002& p\002Bu\324\003\241\300\256\323J\330\243+\365\356\261\354M"
+	.string	"o\366\251\345|\202\t\250D\306\207Xl\301\356j\313\206\333\264\3342\213\215\023\034\327\n\251Y\374\241\260\373\266\355@["
+	.ascii	"\026\372\023\350\343~\213\270rZ\230\030\321\371^2D|\007D\032"
+	.ascii	"\262\276oD\335\316E\311"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.65.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"\342K,3Pm\222\016$\243\252\214\252\216l]"
+	.string	""
+	.string	"#\234f@\253\321n5\ta\366\357vxz\347\r\234\260\337\314lVQD\337JX)\022\034}\270\241\275e\n_*\f\226\251\302d\03255\207\311\322\320.U\246U\b\246\0360U\203\240\250\252Q\262,\206\016\013:\350\371r\264\303\272\032Gh\256W\245\253\231T:\024\250\350\334\3503\316\341\305\027 1\364\337\207\003\026 X?\037\231\240QI\216H\"\242\177\363\224\021\0226[\3152@\023\321H\302\203$3k\210Q\253g\335nt\301\363\t\2710N/@!3\277\013\243\350\330\377\3407\370'\002\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.66.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\200\001%\020"
+	.string	"\306_pF\340\322&\035R\357^>r&(\200aP\2029u\321fp\305\362\024\035\220\223\306n\303q\361\255\303\263\2745j\253\3465\305\354\023\340-\227\030\326a\206\3718\006\263\202\370\206+\207\365\362\020\263@\322\310\336R\246\024^"
+	.string	"T"
+	.string	"_"
+	.string	"\221A\203\027\257\376\361\334\bxe\230!\342\261\373q:\302\333\341w\307\\]\213Ps\345\303\\\203%\227\006\031!^\013\226\340@\342\360\330\323\306ce|\341\034B\007@?$B<\031\2501Y\013\223\327J}\354\brd\254\031*<\234g\311dw\2355\336\206\273t\333+\333$\366\205\002\207\005\375\232\323\360\260[c:a\372\033\204\237\033\227w\032\244\335\233\231\217}\021Y\2308\354\366??f\223\017k\371\266\266\205\347\345\272\261\373%x\364\202\355\361\366\213m\262\235i\377\304\201^\036\344b\220\335\020G+vW\201\rl\217\004>@{\204\017\240=-\232jIED\320\354h\201`\345,}jt\304\200\272cMSSC5d2\311\266\204\313\\\016\320\330]\022\333\027\236B\245"
+	.string	"\317\356\226\2408\021\312\357yt\005U\276\346\321Wi\217\251 A\252\327\307\376"
+	.string	"\006\315l\346GL\316T\346\352a\244\272c\1770\251:F90x\260\352\330\001\026N)+]L\235\272\b\035\313\312)\245\003`\224\221\t']\352\244\342P\035\267\322\235\250p()\0257\"b\024\205S\212cA\241R\234\351\333\253\216/\364\315\306\253\203\254(\372+\355\261\203\364\274rdE\372\2574\b\325&1\312\372\240\351\216M.`Ic\211\264\315\226>CG2\231t\270\273\033\377\031"
+	.ascii	"Y\b8Z\315Sz\r\244)u\335\t\301\030P\035\301\202\210\212e\303\355"
+	.ascii	"\342\354m\323\006\232\006`6\352B'\204\315\221,\323\272\355d\n"
+	.ascii	"y\366\264\027\227\002\252\205\252\240\261\251H\274\256I\006"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.67.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"}\n"
+	.string	"vSG:0\257\322\001D\310\001\241\201\2401z'\017\217\302i\254\003\330l-\322\300\205\305\020\306\177\366\261\217\021kFy\333`M\030`\020\207M \231\021\224,\264\220\001\265O\310\336;\2455"
+	.string	"5"
+	.string	"6"
+	.string	"\225\316\320?\020Y\304\321t\256jR*\221\316\230\252\237\322&;\354\223c<\315\352Z\235\036v\206\0261&\216\253O\315\302\356z\212c\307\335\335\266\203m\005\37343K\343d#\035\333\237\366I^\022\376\205q\201]V\231\262K&\030as\316\344\t\272s\233\017t\347\034\3321'[k\340\362\3208\221\331]\217\202\270\316\360\\\247w\251\251\324\335\335\352nrN\321\331\025\026\363\242\217R[\241\241\250\211\306f\251\221\322\017\2334\315O\253\264\231\262\354\277\376:\247\257\t\b\201\031\277q\333U\335\002%\360k\3408\344y"
+	.string	"\215@\021\311\373F^\304\b\004\341\205@\222\347)\360'!\002\275\322\367\201^\207\334S\2267\265\031-\203\236\270\213\356\0244yA\315\322"
+	.string	"\263R\373\233\230\027\003\023"
+	.ascii	"m\231'3\360\316#:\326R\\w\365\002\rc\035\2502\251h0/A\273l\221"
+	.ascii	"w\t\240YM\t\356\305-U\252\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_nopConsumer.68.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"R\013+3Pm\222\016$\203\310\"\242\342\342\366\241\322\b*\004\225\252\321X\034/C\r\314\341g\nz\222\314\03723f(U\004\026\300A\005P\0167\363\033!;\005\256\343\034\2425\231\007'\301\r\247=\251EH\016\242i \247e\006~\022\033\330:\357\301\206\251\232\fT@\301*\276\232\026\333\370\214\312@\277\004:H\250\274\020i1VTzb1\t\375\211\371\327z\005\206\230\037\023\263Vc\244\244\255\022>"
+	.string	"H\313\361Q\b<\235\026<B\026!)m\033\343\310\230+\236\t\222\001\037j\312uih\373\372P\0319\313\337\340G\370=\001\b"
+	.ascii	"3\003\316\231\001\342\313]\303\265C\030*5\031\334\345E;\311"
+	.text
+	.section	.gnu.lto_serialPassthrough.69.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\222\004\005\034"
+	.string	"\266\362\262K\240\226U:\204\337spz\201\302\324\370\304Hk\005l\275+\323\026jx\332\207\337\353\271\300T\321:>W\263\372\0207\r\276\305\\o\233\352\340\344\230\353)\214\227\342\302W3C\271ZS\016\367\344\267\223@56B\b\331r'\031\244"
+	.string	"\226"
+	.string	"\232"
+	.string	"\243\354/\350\351\262jQ\261XRfI\216\266\253\214\317\373\371\213\214\243\026\306'G\355A\333\f{\200\3104\345D\266]=\227\236\332Q\324\003%\204\223q\227\334WA\233\215\030\265\005\306U<\270\240\263l\271\343\223\343A\333\013\033\241H<r\"\333\215\312\002|\n\007\257\b%\204\013z\312>\270\021\361\361\240\r\206ME\341\001\357\273"
+	.string	"\"\033P5/\204\313\275d\271\375\234t\361\221g\247\332\026o\233`X\024t\336h\266\005$dx\337k\317\rE\255%\205{/\327\332\rwn\235\3714\314<\201\271\207\0011G\372[?\372YO\177\364A\376\363G\347r\254L\332\312\243\255l\307\312m+W[\371\002\352\212\241\321\355+\232\356\365\271R\345:\215Gt\\\351\377-\371(R\301O\342\003Y\305\r\034\310\376#\361\313sI\360\340E\021\357M\021|d\t\346\307\252bFB\002\241\036\225\b\200^Z\317\006\203\264\210\340\225\371F\007\"{\020\023_\335\253#b\344\336T\001\0270?rz\030\362\243\371\026\371\221e\314Q\236\356n"
+	.string	"\236R\n_\324\275\327\3255\330\344\223Y\270\fh3k\250]\233\b\245\334\336\325\006\232\372ZL\037\370\026P\b\025aW$\246^\344;\326s\342b\003\253\257\275\337D\230\344\257P\200\360\244\246\001 )@e\017\021\250\215\354\341\346B\356\211m\365L\36709\266n@\261\331\303\215\205\034\223\250{O\274\306\266\262\272\354\236!o\365\223\226\330\036z\321\031u\353\370%HV\367,\351G\357\211V\213lV\364\2253\353\331\314\"r\352k|\337\277\023\3768\321z\306\234\316j\0171\277\001\225\037\267\216\371H\347\231+\235e\376;\007\257W\320\351`\003\213\221\025F\235\0166\260\330\250\303\241\346\203\345\327\202\0174\260XM\216\013\007\346\002\001\243\271q\275b9\256\005"
+	.ascii	"\030'DM\314\245\203\203\023s\251J~\353\310\346\231f\016Ad\237"
+	.ascii	"2Mv\331\3131ya\246\"\301\035:\366{\234cW\342\360\207\251<5\245"
+	.ascii	"'*\323_z\313\310\220\205\023\255g.\325G\343\266[\331\036\201"
+	.ascii	"\332\276\357+\242\360JKL\355\346\262\371\025\005S\2731d\250\257"
+	.ascii	"\361\314N\3178\246\273K\032>JRX9Q\257\250z\210\377\3765\355\334"
+	.ascii	"X\255;\323k\237\250\367\024[\250q0%\rR\n\221\210\210$I\r\351"
+	.ascii	"\300\002\021\271:\007\0200\310\244\212\2269`\212\322\361\335"
+	.ascii	"\351q\246Q\312S\202=\212d\021\357\242\377B\221\357\026\344\321"
+	.ascii	"\362\326B\275d9\003\354a\234\246(\351\224\006\377\267\340qS-"
+	.ascii	"H;KU\206\363\001\027\320W\365\034M\22074\271q?\301\341(\340W"
+	.ascii	"\\\334\305\220\343\263\031\302&\007\333\327l\003\334t\266\342"
+	.ascii	"w\0015IK\263\275X\316\200\365\n\002\321\350\032:EB\024 ]P\b\340"
+	.ascii	"\377\026\271\272\3166\n\n\222o\315{<\034+k)\002\ft]\247A\373"
+	.ascii	"c>d\026\242\274\bO\231<\345C5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\177\003\r\021"
+	.string	"\004\031{\004"
+	.string	""
+	.string	""
+	.string	"\002\304"
+	.string	"\177-\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006/\177.\260\206\3618\272\320\202\002"
+	.string	""
+	.string	""
+	.string	"\005'/\301\204\001*\1770\234\211\365\321"
+	.string	"\220+10\1772\346\206\316\220)31\1774\0022\1775&!\300\003\0023\1776\0026\1777\252\333\34264\032\300\003\0025\17787\17798\177:9\177;\250\212\250\332\001:\177<\270\215\221\313"
+	.string	"\005\310"
+	.string	"=`;\177>\002<\177?=\177@\377\377\377\377\003>\177A?\177B\220(C\300\003\002\300"
+	.string	"\177D\002\301"
+	.string	"\177E\302"
+	.string	"\177F\303"
+	.string	"\177G\360\372\250\002\305"
+	.string	"\177H\307\3712\005.I\305\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005,J\001\306"
+	.string	"\177K\037"
+	.string	""
+	.string	"\200\220\200\001\307"
+	.string	"\177L\311"
+	.string	"\177M\313"
+	.string	"\177N\312"
+	.string	"\177O\317"
+	.string	"\177P\316"
+	.string	"\177Q\315"
+	.string	"\177R\314"
+	.string	"\177S\003\001 $\003\r $\003\r\013B\003\020\017\320\371\216\307\003\001b\003\020\b\350\274\307\343\001\001\302\001\003\021!\204\223\242\253\001\001\244\017\003\024\023\"\003\025\b\003\"\271\255\362\217\002\001\204\006\003\026\n\027D\003\034$\221\205\327\307\003\001$\003\034#D\003\035\034\"B\003\035(\300\206\275\355\002\001\344\001\003\035'\244\006\003\035&\304\006\003\035%\007\007\003\035'\231\365\231(\001\244\n\003\035&\300\327\351\371"
+	.string	"\001\304\n\003\035%\013\004\035\325\007\004\035\231\365\231(\001\325\013"
+	.ascii	"A\250A$cyj\346\242$5s\260\002\231\252\232\007\021\340\220F\210"
+	.ascii	"\030\022L \025\ta\320\003\366\225P\234\355\214\022\317\346\215"
+	.ascii	"N\225qj\245\335\235\216]qE\031c\266\331\352Z]8\f\345\332\342"
+	.ascii	"\317k\342\347H\370\362\376,\365U\301\346\265\305\301$M.\262\256"
+	.ascii	"\356\342w\223\266\306\024\316G\270\377b\265\322g,\315\016\214"
+	.ascii	"\244\324$P\314\311\206\353\330-\277\317\237\320\030\"` \356f"
+	.ascii	"\2102@\227\310\345\243\371\204\346\007c\362\200\362v\251\001"
+	.text
+	.section	.gnu.lto_.refs.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375 \301\305\003"
+	.string	"\322\311\030\033\240'\351\377\377\377\377\377\377\037x_\332\332\367\326\372\355\177\373d7\322\310&R\246\263\214V\027\346\343^W\321\205\363Npt\374\334\265\021\265r|p/0\236\216#\367\310x\0317\235\307C2\364\245\260\302\017\2413i\200[\362\247\276\2527!\240R7\366\265\"\235\035\361\036\037\336zVMo'\377F\006"
+	.ascii	"v\306b\321{C\264R\305C\026\001\017\226(z"
+	.text
+	.section	.gnu.lto_.decls.a1c2313b70d7b55e,"e",@progbits
+	.string	"(\265/\375`\332<\315\371"
+	.ascii	"\312s\235RW0\f%\235\306}YU\226{\2623\211\242\b\252\250*\252\252"
+	.ascii	"\312\204AD\0201#g\032\263\240 JgB\025U+z|\201\007\227\002\206"
+	.ascii	"F\017\207^C\233\310~b6\356\342\253!\355\366s\307\363Co\347z1"
+	.ascii	"\n\220{\340\333\252S\353v\366\025Kj\333RJ\231\002m\004\030\005"
+	.ascii	"M\005\n\270TWj\335J,X\\SP-\354z\251\356\3249\350`kP\203e\344"
+	.ascii	"\310\241\225\363\261\020}\274FA\271T\361\272\213\273\231\305"
+	.ascii	"\313\231\024\245\0305\364\255\022\272\347\177W\\\247\253\302"
+	.ascii	"\256\367\351\246\360\213\342\246x\315\2727\232\327}\272%.\222"
+	.ascii	"\032\330\221\247\233t\233<\030Zj)\2017\367\334{\325\240F\003"
+	.ascii	"\rd\206\216\214E\321\331\316`\250\246\0238.iN\306\315Ly\305\331"
+	.ascii	"\233\021%}\227\256\322\327\2757Q\352j\005\337\315\307@\372\227"
+	.ascii	"\312=\212\231bBJ\221\273k\342+\f\006JA\267fD\337\"\364\257IJ"
+	.ascii	"\336\315\277E\377\035\272Dv\017&\016\317\204\322\315y[\f4\303"
+	.ascii	"+d\363KbHX\305D\331\31527\bJ\313\237\340P\f\240\f\264\220\333"
+	.ascii	"\231\327\017\007\230*{A\\w\007@fM\201\344\242\220\320\232p\233"
+	.ascii	"rt\363\0254%[dB"
+	.string	"\364\255\240\265bW;h\245\334N\261T\024`\007-\233}\303+\233&\022+\032\264Dl\024\034di\204\240\302g\332\240\r\2742z\302l#*;\235\177y\350!U\336\215\241\243X8\013\2058Fw\347\344\346'5/yR\177;n\376U\241\001m\023\313\304\372\331\247\375\263\253ub\371n\373\254\222\347uo\241\257$V\310Z\020\340s\357}[d\211`\234\021\0262++\n\370m\254\023{g\367p\220%M\006\326\344Y\207\304\322\305\374\314\354 \274*\316\275\327[\257\337\346\347\240\003\353\304\332Y:\274:w\020\336\020\b\004\025\256\025\t\334{\255\321\340\005\020+\252HL\276\235\323\267\263\030\206D[\246-\236\315\263+\007\253\327\"\264\356\260\226=(Qe7\337\002\321\267\034\2062\034\206\2678\364-\226\276E\241o\203\364\313\344\354\234]\003`\217\234\203\016\216\177\276\266\027\f!\017B\023\350\333"
+	.string	"\fm\241\r\300\360G}\2668\213a\370\016\350\241\035b\333\354\232\201u\273]\263iG\201\326\275\356\275\312\\\031W\314\300n>\t\3726\203!.,\264\031\f\357"
+	.string	"}\355,\315p\306b@;k\361\261\225\202\355\346\333\263\337\222\3312+\344R\355-\264\367\316\020\003\227\367\265d\315l\030\031\f\301\233\217\201\276\333b\030n\2604C+fs;F3\\rZ\267\214"
+	.ascii	"\322\340\206\334\314bi\206]\326\313\202\341\242#\252]\266\367"
+	.ascii	"Z!\3031\3759\271\331\372\260?\354\032\304~=\177Q\355\260\275"
+	.ascii	"7\314\313\025[\031\320\315\033,\206a\2664\303\230\252\275;\370"
+	.ascii	"\325>{\357\315b\0177\374j1\f\265\245\031\376\266\354\277ah\377"
+	.ascii	"\315\373_\206w\357\376\373!\211\315\360\347\256\343\037\373\370"
+	.ascii	"o\227\335\177\201 \241\021\002F\376\363\225\005$L\035i\236\202"
+	.ascii	"?7\021?\340r\353\016\363g\243\021\256\016\272\337fp\321#^\303"
+	.ascii	"\237\177\256\315\021\263\035\016\322\377\316\230\373\355\212"
+	.ascii	"\377\312\031\261j\377\305\362\300\035\306\335\rE\262\b\0374\374"
+	.ascii	"o\371s\003.\021\273\301\202\n\027\376L\200\377\316\300\275Y\342"
+	.ascii	"\2373\370-\0059\303o5\230e\031\375g{\335\250\374w\3711\224\377"
+	.ascii	"V\036\370\237\311\377\277\377M\376\373\375_\302w\333\376\353"
+	.ascii	"b\210\005\300\217\317\376[\342\277I\377E\372\257\211\377"
+	.string	"\022\375\327\350\277G\377]\272\352\177\205\376K\342\262\375\237\371Q\002\374\007\254\362\037\312\327\313\217\223\374V\260\357\330\355\277k\377M\373\257\331\177\305\376\273\376\327\353\277[\377\245\361\337\253\3776\375\227\351\277!\370\357\006\376\033\342\277%\374\227\204\377Z\340\277!\374w\002\377\215\300\177\031\360_\016\376\333\341\277\007\370\257\001\376{\301\177+\370/\315\177+\374\367\345\277,\377\375o\007\177[\345\267O~\373\374\255\222\337\352\375\266\356\267_\277\005\301o\345~\033\367\333\342o\321~\213\301o+\370\377\344\377\225\337\026\371-\334o\333~+\201\337R\340\177\362\2676\277]\373m\332\177\275\377G~\233\301\177\263\377n\277%\3766\354\267`\277\005\362\333\020\374\366\307o}\374v\004\277\025\301o\t\360\333\013~k\301o\365o\357o\355o\377\277\360?\341\377\263\377`\377C\374\237\373_Aaaa\341\317\222\302\357\"\367o"
+	.ascii	"\2022\242V\226 \200loSv\267\303zz\357m\305\214\2348`\035WN\316"
+	.ascii	"\274c=,\243\204\217#\214\327\302b\311/\017\357.\031\366\214\273"
+	.ascii	"\262u\321U\024'\234\304J\201I1\324\203\354\346\303\024\351\343"
+	.ascii	"#\230\356\270\016\327a2k\303)\005\016'\016\352\017\367>\201\256"
+	.ascii	"{)\2108\264\250\265\034~\030\213-\006{\337\001=\353\016Rc\022"
+	.ascii	"E\347X\003b\261as\330\373g\251(\254\352\247BQ\030\320.\022\263"
+	.ascii	"c\252P\264\356\026\031v\230\213]\264R\375d\252\237\273\327-T"
+	.ascii	"\305\264\205\250~x\212\326\275\264W\252\237\231-\3044S\264\002"
+	.ascii	"\375\024\205U1\331\2420*\246\n[h\377l!\240\026Z\210\212\251\350"
+	.ascii	"\b\025\323LQ\030\020S\221P\025\223\335+\325\266I\334\326\252"
+	.ascii	"\237\241\035\006\004\263\367>Z\235?\304\275\201\226\366\317\335"
+	.ascii	"E\332UO\244-\265\255\035\217\325\305\256\331{\377\224\365YQ\265"
+	.ascii	"\254A\333\256H"
+	.string	"\213Jgh\357\276\215\264\200\037\373C\264\203~\354\336C\353\322\336AT#p\242\262yDK\033f\013\001\035\005YQ\021\207\202\250\210\266V\013\313T\024fEe3d,\314\271\203\326\037\353\334}UK:\354g\335eP`\302d8\035\335,guHU\205\331\351\377\326\321\2558\262\262\256\334\214\213\034\257\310\336\212\300\331\025\303a0\020\353\376\211\001;\"\202i\354vq\033~;v\303C\210B+v\313{\003Y{A\214\265\027\240p4\200\300\206\371D\037lx\355\304\035\220K\021\211%\252\233W|\206\323\354\272\225h\210\272\226\2266\300h]Nf\370\270\371\304\026\372D\"!fF\236INn\306e\331\214\204Z\221@\375\3431\273b2\264\253mUa\351P\253)L\326n^\303.8\355H\n\303`\304\272\035kRn\006\373q\020\374u\241\2102|*\314\242n\326{\343\325\211\253\210A\345"
+	.ascii	"b\002L\256\007\020\376\221\002\313\310\2326\370\247\244PI\034"
+	.ascii	"\376Ar\241D\tt\326\335\277A\347\223*6Fk7p\024v\302RX\007\246"
+	.ascii	"\3022\260\r\314\003?a\034\230\013\367\300Z\030\n\373\300+\360"
+	.ascii	"\024\366\3025p\027n\201s\340*\354\304Wx\006\206\201w\340\027"
+	.ascii	"\330\005\266\30210\r\214\205Y\340,\273\342-\214\3428\005V\361"
+	.ascii	"|\373\224\030}])\267\n\027\3403\210\356\002>\255\340\255{\227"
+	.ascii	"\344$1\367\214\273L\256lK\327\267$\244\003\"#E\256\237\245#\264"
+	.ascii	"Q\302Ig\316\2428'\336\302M8\005\027@\234uLfN\033\\B\315\246\341"
+	.ascii	"!\271\276\337\306D\232\023\037\341$4'X\350\b\006\252\273K\n\t"
+	.ascii	"\375\236{|%\360\216\234\327\212`\023|\342\001=\312\310\360\326"
+	.ascii	"\275b\337\254]V\004\274\2304\261t1xo)A\347\315\303[W\317"
+	.string	"\322Y;\247\375\343d\0017n"
+	.ascii	"qj\331\313\353\353\272@\306\036\274\030\3218\005\272\021\354"
+	.ascii	"]\306\222\2430\351\311\315\177q\323\177\t\242\377bC\377\305\205"
+	.ascii	"\376K\220\306H9\005\335U\215\233\357\"\250\357r\247\357\302\246"
+	.ascii	"\357\242\245\357\202\245\357\002\245\357\262\244\357RB\337\345"
+	.ascii	"G\277%P\277\245O\277\205M\277\205K\277\345J\277\345H\277e\353"
+	.ascii	"\353(\372:O_\253\351\032\213ax\247\\*v\255\271\201\366.(\t\352"
+	.ascii	"\346k2}\202]hk\206\327]\372\032\206\346\240\225t\002\236\332"
+	.ascii	"\003\2268}\226U\237\305J\237\245\204\376\360\251?\274\323\357"
+	.ascii	"k\323\177\202\351\007\016s\350\017\235\222\330\311\350 \361\342"
+	.ascii	"\307\212\246\2078WA$uM\276\374~n\246\333\021\003\253\310\315"
+	.ascii	"L(\227S,\305\214\213C\t,\306\363kK\312\231C\307\224S+\353\331"
+	.ascii	"\305\342y\365\342\306H\302\243a\003\344~\t\301Cz\242\370\241"
+	.ascii	"Dv\317\232\202J\f\311\370\337\020\236\f//\273\027#4\263\205\254"
+	.ascii	"V8o\216\035Qi\227\353\3660\201\007\365\274i6\211\215\213\302"
+	.ascii	"\307\323\363\026\271n\367\3105r\345\356\334\035r\331n\334m\273"
+	.ascii	"j\027\356\022\271h\367\315\2567\355*\275\306+\355\202\3351kW"
+	.ascii	"\266\201Nl\270\261\002N\321\240F\203\230\257\031H+\006gB\312"
+	.ascii	"\2020Y\262\342\340[\263q\263\331-\033\376\300\313\222[\242\217"
+	.ascii	"\342\205]1\031*HQ\366\342\302\334n\020\242\326\t\245\032b+\352"
+	.ascii	"C\037\325\322G\261\364\321\025\372(S\017\036N\033_\1777\333\311"
+	.ascii	"\020\t\273\360Z\334|\264H?\013\352\347&\3729\211~~\323\t\260"
+	.ascii	"4C\347\275a#\223ps\313\352r\336\306\360\316\307\256\361kC\206"
+	.ascii	"\206Z\022\0277_\032\366\255P\355\b\334\315\227\362\277\227\""
+	.ascii	"1\254\352\234\372\271\305\205\241\342\n\350\357\346g\023:\013"
+	.ascii	"\313\345J\215\272\300&D\013`\356N(\331\204\372l.\256\325\034"
+	.ascii	"Y\332z\363\223U(\306\b\t\223\261*\252\0303+A7?<N\334\275qh\261"
+	.ascii	"\212\n\342\206\3168J#\347\211\t\321\335\214\312\310KqU/\334b"
+	.ascii	"\030\021^\031\272\031\205\321D\352\205\334\315\277@\002\315\242"
+	.ascii	"Y\242\217\342\350\023\212\002\275\302{\304\375\363\265\225X\326"
+	.ascii	"\344~\020\t\334EN\034^\202\230\b\222\344R\035\275:\352\202\203"
+	.ascii	"\016\376\307\265\265\007t3ju\264\312\211\256\355\331\002\255"
+	.ascii	"\372[\\r\\\205\3558\323G\200\376J\301\304t3:\365\277\253\365"
+	.ascii	"w\344\344fT\352pD'\276@,4\252\316\n/\350ft\005\312\302\256\237"
+	.ascii	"C\241\036\323Fd6\027\246\177\002\373\271!\252\342\250S\233\324"
+	.ascii	"U\225W\n!{,\234;\364i\234Mh\223%\0041\263\267\225\034\033NJB"
+	.ascii	"\321$\225\221<?\355\232\221\240L\270\310i7a`U8G$\306\336\315"
+	.ascii	"\350\022\013\020\337\036\r\223\276\365\202\222\2450yN\361\263"
+	.ascii	"\222\007\267\220<\251\344(^KP\243L\210\016Y;\247\231-\244\026"
+	.ascii	"h\203\032\345*}&P%4\t=B\213\320\022(\222]Q\243|\345\331I~b\203"
+	.ascii	"\032\345@%2Q\272\310T\314d(\377\263 \250\b\304\217&(\t\224\310"
+	.ascii	"\256\350\320k\326\275\321\241\\\210\nY;\247u\237xI{\262\303\212"
+	.ascii	"\006\r`\236\344\365\261\030\346\037\025B\203\320V,(7\243@N*\346"
+	.ascii	"H8\321?\272\355\212\376H\341\032\"h\241\211\276\205>}\013s:\013"
+	.ascii	"j\275gT\035\234\276\205!\372\026\204\350[\020\323\267\340C\337"
+	.ascii	"\002\227\224(arQ\352\242\\<\272\243 -}9X\232af\222\233d\300\036"
+	.ascii	"l/\316f\350\347\277\021b 9\2739\333\303\r\363\222g\2779\033N"
+	.ascii	"$,\375\334\227\225\364\3250\013r\363-L\351g\276\263\302(O7\347"
+	.ascii	"==d\201)\003\227(\265\251\274\367\347$\267/\353\215\240\004\205"
+	.ascii	"W\250\334\234\361r\336\263^\276\313z\013\240\332\033(\353\311"
+	.ascii	"\f\356\r$c\355\005\326^\220{X\331\0202\314\267p\244a,\315\320"
+	.ascii	"\366\331<\333\275\324\021y\002\231\022\027\227\351\036p\303\314"
+	.ascii	"\271\235\2708\350\025y\201\177G\236\351XH\274X\245n\316s\267"
+	.ascii	"\311F\326\332\363\346,w\233j\320\001N\335\234\215`!BxbF\204\304"
+	.ascii	"\270\321U\361\310#B$\207\351\232\033R\202]]z?\336\336\362\026"
+	.ascii	"\210\0137\2162 6\365$k\310\220\3346f\243\360y\346\325\003\212"
+	.ascii	"\224\3476:\242\005/J\230\270*\034\245\245\345\265\265?\230$&"
+	.ascii	"svj\317k,=\254\206<\t\3463K\347\022D\267n\360\031\277\261\261"
+	.ascii	"lf\001\225\246\240\270^\334\264\342\366\312\236\315\326\270~"
+	.ascii	"\024\2719\223a7!hSav__9\314\246\005\306\260\025\331E\201=\207"
+	.ascii	"\275\211\313\013\026?^3l\\\\y\325~5\246\240\002\207<\242\214"
+	.ascii	"\210\200<\2571x\034\351\2709\377\260BX\250\270@\342\343\"\275"
+	.ascii	"\210\271P\313qs\366\2728d`,\351Qts\356\372_\026rqc\356\346\334"
+	.ascii	"\303\356\311xI\265\361\270cV\220m\317\350~\3411\030z?\202hi\345"
+	.ascii	"-\0202\262\2064\202\324\226t<o\265\204\345\321\370\311r:3\016"
+	.ascii	"\020~HSP\201,qG>j\334x\306\261\004\210C-\310\314Q\215\3335\327"
+	.ascii	"\300s \250\366\211\003\344`r\332\300\305\205\337P\322`VV\236"
+	.ascii	"\241a\310`\301qF\003O\306\363\2143#nj9\306\365\003T\221\027\003"
+	.ascii	"F\036\222(/\235\245\245\364\324ge\225_\220\361]y\326\250\032"
+	.ascii	"\263\273\371\305mz\013j\273\2739\273p\213\212\312-@X\254\300"
+	.ascii	"\244\230\230W\246zn\201\335\352\350\004\215\334\234\247\362\022"
+	.ascii	"L\030\337X\334\315Y\312\276\345\361ye\255(Pd\026 X\370\3720\300"
+	.ascii	"BPM\3053\213\025\232,\213\007\337\315\371i"
+	.string	"\230\007c\310\022\034\331)\247\310K9\236Wk2Q\271)7e&>\037\316\250\023/\224n\276LQF\312H\231)\206\017m\n*\360\004?Kh9\351\231)/\r\266m\262\274\224\225P;\271\024U\032\312\344\230.\0221-\311X\032`6\312F\331D\013\346\203\232\202\342j\211\241e\345\255\304\263\211\007h\tm\335&\273)S\312\3402\320\2012\221\005'\313\031Q\321\323\305\006\224A\241\034\364L\224\207\354\223\037V\220\334\241L\"\354\211\320\214\305%\263{z\312B7\005\02745\251\036:\b\t\363\266WM\210TG\216\\\025>o\270$z'\212bP\b\256X\020\017\272\004!\311;\214\020\225\300b-@T\312j\230\210\022\005W\321,$\344\2408`g\216\2736)\307U\002\211h/\006W\334\214\251\274\374\311\030ru\363c6\236\2627\254S\032\264\302\344\311\355\212\237X\302\226\242\275\231\b"
+	.string	"V\350\264\301\013\026\022+Xq~~\370\t\342\305\212\tL\025\241 aL\216\237\200N\027\201D\030\02079\202fB\357\t\361\212\320\b\340\237\345\253\340\257(\315\n\251@\342\307\206\016}\313\303b\276\025\363a%2`IP\033\260Ty\302r\302}\227\002G\0019J\244\2124r\240\204\013GcZB\312\004\241\231\252#>\360\t\221\252H&\007^\256\323\001"
+	.ascii	"#\214\311\364\210\216Pyv(P\301u:\360\334\250\305\r\312\224\207"
+	.ascii	"\004\236\233\020\327\351pA\3123\"D\007J \036S\237\022>\250M\017"
+	.ascii	"\351\261'y\243Dz`6{<P\220L\366(\225K%\213Z"
+	.ascii	"\034\222`\251d\3011\246\311\254\246\315\235tg8\202"
+	.string	"g\371\241x\235\0169<7\312\236\027%\316E\233E\242ZT\346\360\240\312\034\036\254\243\346(\323\3440-\001\262\231\233\315\224y<\032YF\360,o2S\345\301\307T\231\203L\032Y\216i\263'\247M\2263\2139<\035`\362\b\246\332D\346\244%\0241\350\344\364,\231:j\263i\314Q\"U\025\271\323T\032\231!t\232H%\022\204e\b\346\022\004\025i$A\001\232!`H\"\215\"$\240\246\025\020\261\334\231Q\225=\313\0172*R\031B\332\\&od\224)\3172\246\251\201f\272<\326T sD&\215\033\2409\246M\244\205\264\230\243D2\215:&\244J\344\0163U\323\343\205\013\252O:B\215\206\021\037\f\240\331\222\026]>\340\351Aa\271L\322\354\244js\204\t4j\217\b\314\036\f\034\225H\0200hb\310A\342\024\225 \224\220\303C\001\317R\371\362\033$3U\2469\372\013`"
+	.string	"\002\030\340\201\017\213\252\026\233\"\244;HU\253M\344\005h\222\313\345\007ET\325\300Lwz\232\327\351\340\303\364\220\303C\323,\362\030wn\230(3=\"E,\231<\307\324\207\351\223&yz&\200\2234\352\270(\221\033\324\"K\2161\304\022Y\314\351I\362\324TP\323f\312<*\221'\024Uc\263\270\323\303TQHy\232\025\334\020\323\244\361\306Ee\246\"\224\310\033\346\021\271\203*\221;\032\205\233T\347\306\307\270\243e\232\037\222F\021\306\344\222\207\231\252\312\020n\230\031\232i\312\314I'\220&s\224\022\3301~\020\301\203c\341\230\\\3524S\246N\210T\275\221"
+	.ascii	"\023i\254Q\"o\322fO\321\207\371\342\323c,\372\030wd\232\314%"
+	.ascii	"\223\231b\030\252i\023\007g\371RA\003\016\316R\355\271\021@\023"
+	.ascii	"\351c,\346\364\234\220\036\325\036\036%2C\3123B-\246\"\220\252"
+	.ascii	"Q\004\222\231\036-`.\325\033#Nq\251\366\030\2139J\244\216\272"
+	.ascii	"\\\3564\2137\314\232\343\022\311Ly\2128<\311b\272cd\342\024o"
+	.ascii	"\230\315\"\262\331dj8\"\213*R\331\003\303A\322\207\331\224Q\233"
+	.ascii	"F\234b\317\t\315\030\246\262Y\364a\026\323fO\021\247\311\274"
+	.ascii	"\221A\241i\334)6\223\251R\231\036\221Lf*b\t\200\3534\231\251"
+	.ascii	"\b$\363h\301\006f\322\344\t\306\020\"\206i1=.EpI\217\313\235"
+	.ascii	"\234\026I\200i\362,YR\325X\202NK\2004A\253\232I<\032S\020I\244"
+	.ascii	"1\0043\305\301\351\371\300G%\212@\2467i\t5.F\3258\001\037f\f"
+	.ascii	"S\305@\b(\334\030OH&\215\037\322\344\021I\374MS5\301\204\243"
+	.ascii	"\022\211S\201\3324&[\324f1\315165PAm\026\211.i\021\204\013Ze"
+	.ascii	"\246\352\215\221i\324\271)\252\313\345\t)s&F\275N\206/yR\246"
+	.ascii	"\007u\271dzx\031\301T\323\2354\231\252\031\232E\013j\221\003"
+	.ascii	"\005\240\3204\212\240\\\"\325\033e\017\016\021\351\302\323\334"
+	.ascii	"\251\320\344\311\251\240\026=`\361I\217\312\020\216=\306\023"
+	.ascii	"\212>\313\023P\2701&O\240\240\231\203\304Q.?\250\314%\317\213"
+	.ascii	"Zd\200\215\252D\366\350\022\3500\213\251j<\362\364\0241\244E"
+	.ascii	"f\212\304A\252\312\364\030\202\312\\b\200\202\333\330|\330\240"
+	.ascii	"\201\021*\240o:$\215Hf\332\364\260DzP\"\215;\036n\230M\017\035"
+	.ascii	"(\330\023\213\221\"\265\343\205\036\232\306\301\236\023)\017"
+	.ascii	"5sq\272R\203\016\017\223\005\312\351\031\335\205\271\\59\342"
+	.ascii	"L\202z\351*p)T\261CW\230\225\220\207\037\222l\002w\021M!\254"
+	.ascii	"\333\242\323\001\003\210\016\207\314\2141>\263#(\r$\177we7\257"
+	.ascii	"^D%%\031Trs\303\266\247'\022F2Q\006\034S\353\021\227[\270x\232"
+	.ascii	"\342w\363\265r\211\253A\205\214Hf\302O\236z\304\301\3414\030"
+	.ascii	" )Z$\241ox\020\327\371\021\001\202\272)\241r\302\307\217\333"
+	.ascii	"ve\007\244\020\306\020\254\227d0\353\356\346\265\265\243'R\213"
+	.ascii	" +\306\316\316\320\264+\245'\236\242\244\245\002E;\232\226\202"
+	.ascii	"\221\257\027\030\272\310\310P\263\004\330M4&\206\364\034\322"
+	.ascii	"Y\031\235\225\0355\263{\304+\274\031V\030`|}\241b\031p\002N\341"
+	.ascii	"\312T\222\334`\013;*\246\0278ht3\nv\233d\274\251\310q\fQ?~\240"
+	.ascii	"\253%\373Z\222B\214\222&u+\200\034]\227\2200+\303q1rA\230\362"
+	.ascii	"\006\271\270P/\267\025p\312K\237\232XV\327Q/\266\0241\324z\254"
+	.ascii	"?\273I\017\224G\313\023&~B1A,\234Xv6l\240[\366\353\013\217P\346"
+	.ascii	"hJ\022!\252\343\350\326\\\036\330\322\315\250\326\341\262\025"
+	.ascii	"4\257\252\233\321\034(\016\364\006\352\274\240\205\365c\2414"
+	.ascii	"\354\327V\272\020\205[\2503\323\003zh\262d\n1fh\204$M\222\016"
+	.ascii	"3\025@PPH(\232l\313\\\017\023@R\250S\242\232G\025ShfD\222$)\354"
+	.ascii	"\261\033\240*\210\035\305!\262\201\005\264\203\020\200\244!\006"
+	.ascii	"\374\004)o\306\236\240\037}e\303j\257!\273\277k\003\004f+C\032"
+	.ascii	"\276\002\330\347E\211\370T\253y\342\240\020\370z\323Q{\252,\200"
+	.ascii	"\025\316\001\021\347\220\261\273S\b\273\035\253^\326\342\327"
+	.ascii	"\376g\325\340\347\353ag\004\317"
+	.string	"r~\027g\254\211g5\305\bv\367\035W.\036`\314\201\206C~3\304\356\022;p\254F\315P\262\351\021\337\235V\320#m\373Su\007\3512\260;\240\231p\264' \216Q=\005\341\231\370\237\264[\237V\266f\315\252{]\377\226\210\341\274\252\036'\022\376f\356\177\3776\235\360\211\205\234N\351 (\030\254I\304\257\307`\246\324\314\314 \013\250\301\277[\352\274\033r\236  \027\n\362\252D\303\\y\002-D\347\2018\317ba^v\337\202\031%\326\nP\210M\343L\200S\3038>\021x\222\274\345\205\226\231\322\251\3604\025\262\330!\316p\316\215\266\005v]F\216|=\264\005\367\026\025\350u9\220\311\034\201m\232</\316H\360J\330\020&_\347\236\235\364\276\223o\365\205\204\322XH\346\363\211\266\3071\001\300,\226\3312\3004\317\022+\\\364K\206<\036p\0051\372!p\347\247\335\232CN"
+	.string	"G&\f$\225<"
+	.string	"\027y\361=$\344\227\032`\033\016?\201\246\312\366\346u\226hI\322\310\326|T\247\324j\346MQ+\253\032R\"e+d\205\307S\201\232-n \265\036S\307\210*\342\364CHh\\\tDK\311\345\002\250H|"
+	.ascii	"\311C\225\002a\363\303}mP!N\265\"^\233\325\346\023\005\237V\235"
+	.ascii	"rS'\231\340\271\t\366\354\341\rY}\316S\343P$\304\276W\351\210"
+	.ascii	"`;\237s)\301\"n\234a(\221\037n\2501\006\307\233\321\245D\025"
+	.ascii	"5\374\364\326IlIE\034\332\303\r\013\003\021\256\351\222\215("
+	.ascii	"\221#\206\f\246\261d\271\370\370G\213\225<\021\006\205c*S\247"
+	.ascii	"\036\007\217\203/\360\361\330\317:\300L!\255`.\274\226\363\202"
+	.ascii	"\0211\364<e\262\311\314\202\003%\351\364\006\354\324\315\\\265"
+	.ascii	"\336\204)\003'9&l\201\234\256\230\313\006P\312o\026\324_\024"
+	.ascii	"OY\025\225\265\2000\375\333e\300\270c\312J\210\1778\230\304\311"
+	.ascii	"R\331\341\240\327\322\251\355O\212rq\005\277E\366\302\256P\207"
+	.ascii	"\225\2579\257e\314n\3461\003o\251\fR\305{\214"
+	.ascii	"H\017bC\365\274\332\274\332\322\366\242\364P\350&A\025jZ\206"
+	.ascii	"\022\301\207U\304\255b\367\250\003\342\375\206\220l$B\270\262"
+	.ascii	"\273\263\277\214C\341x\024\251;E\nT\036\020\004#f*F\256\276\271"
+	.ascii	"\264\251e\b/\277\f\3400\253\216\377ru\035\212i\b\273\255"
+	.string	"z\225\353\371$A\311h\346'\266,\300y\324@\023\264\256\240vX1\377\376(\232U\230\373z\f\323l\347\361x\246;\243S\025p\260\27667\013\227/\\ M\365\002\243\260l\250l#O\346PT\312xX\213L\336\334\216\006\247\225\332\363o5\326\025\230\313q\377/\324\032x\377&\200_=\221L\343\212cK\305\003)\204\306p5\256\262$f\352@\025;\326\3236Q5!\310&b\022\230:\022J\021\240B\200kb\373G\303\"\252W\354\227\343\355\201\313\f\030\314I\234(\210\253ld(\320\346\362\244!p^\332\334>\370\345\004s\273O\370\306\242Fx\376\345\264hT\266\357J\243\260\026\256d\241\205KW\366\007\324\004#Vg'$\346S\255\027\272\317\203\201[b\317x\347?j%\326-\233c\261W\347\177\357\266t\227J\025\273\212<\300\032\226\363\006\205\001G\331\250g\326\005bbtg"
+	.string	"\037\bk\211\031!.\335\032\311\340\210\337\306T\016\003)\245\244\236p\230\\\250.\004\3205\001\357\270\204\304\361\006\013m\026~\332\314K\273h\267"
+	.string	"\013u\210\016\263\023L%\371a\240\205_c\377\270\005\337\233m\311\t\031i\276\247y\007\303\344DF\215\311\002w\034\224\334j\021\b\205yq\332(\215.`\273\300x\2726N\255\265+\352\bwIk\275L\261\374i\t\316\226PJ\003\020q\375s\257\275\3670<\335\0313Q\273}*\n"
+	.ascii	"\025\203;X\346\006\206\0044\330\320.g\316g%\036\016\246\324!"
+	.ascii	"\004\244l\332\300d\013\226\245\264\250\336B\242\016\373\306\034"
+	.ascii	"\226\016o\363t6\363\025dL%\2035s\033Ot\326\241\357=\350,\243"
+	.ascii	"\233\276\276] \254\0238\375\222\314\035T6\207\007\024\rx)\223"
+	.ascii	"7m\331,\377Gc\t\032\016+\016-\200\033\346\354 \250\207\206\207"
+	.ascii	"\335cm\\\344\266\244aG)\257#\004\r\203\255\306\253jvM\270\374"
+	.ascii	"Q\230t\311\320\255\033z`[\247\271\301\2567p\261\261\361\370\274"
+	.ascii	"2r|\260\2022G\201\334)\344\240\242\314\034\327\351\260\245\355"
+	.ascii	"\022\334\001\231/\365\365s3r\252\262}\245d\235\335\027\013(+"
+	.ascii	"P:Z\272\334\266wl\375z\366P3\250\020\232\340\004M\2107vPIO\320"
+	.ascii	"\350y"
+	.string	"_D\260 \335ml\026\245\335\252\212\345\352\2055\274\337\350\331\272\370U\032\376|\035\356\001\355[M\255\017~4#v:6&\225\364\177A\310a;\232Rt\364]\220\257\270zT$\271f>\037TeB{\361(gkS\212#\204\317f\341\347<\246\312=\366U\023\312\273\022t\023Q\326}4\0030u \006\213\2629\"\206j{Um\307\275\224x{\204C\324S\022\033=\223\254%;\\/\\\3168\303\262\"G\2044.\023s\004\013\232\305\304\002\362\213@\235\327#\270e\230\025\336!\201\204a\203\302\001\377\034\003\301L\006.TZ\234T\005\251\177z\236\337\315\371\376\352\213\344*\017Q\226g[I\333'?mu;\005}\370\177\007\016M6\235r\222\213\001\300&\351\265~\342(\234\345\361M\217-\222~\214\377\340\0038\340\206\230N\314\216:\3010<\237\214m\336J\226W\263i1\252\370\222\336"
+	.string	"\201\b\2736\242\352\213\314\332\307m\rR\301\273\356x>\006\230\252M\fh\330a\330\341\324\030"
+	.string	"6]TE\006,j\262\340\276\377\372Yb\363i\370e\265\377\004}^twFV!wh\221\303\"\032\274\264qw\2429\303\017H\b\257ez\261Z\243\334\203\256n\254\377-`l\230\327\344\221H\025!vL\334U\t\343\236\240\320\212\262\251+Ox@\270\262\030\276\031)\341q-\b\271\311\363\307"
+	.string	"`\202\366Y%\027\ba>\fc?\037\016\210\327\203W\243\221\037\027\314"
+	.string	"U\005B\0361\331\036\300\230\314$[\361\272k\267T`\334b\214S\341\221P\305\351\365>`G\310\321\3721\034z\314\230\337\2053\373\353\277@3\206x\005\370\265\305\330F\354I\264\356n\317\246O\264\235\223=O\352\256\377q\035\025X\3014ng\\A\275\004\200\252\\\327\326Hn2a\303a\321.\344\304\246Y"
+	.string	"f\307\260&#\260\302>\366\377\021\245\256\261*\360\360\307-/\232m-\270\222\372\302\323W\321Rf\255\334rb\217\323\fM\017\323IDg\355x\005\306\327\243M\244!\343V\274l\254\264\240RM|\270\025\236\034\307<\232\025\305'\305\355OPzXPL\344\315\2177\324ZT\203\307\303d\007\362\002la\241\212\007!\213\240\3344\200\026\320\341\320\346\277\200\362As\371:\323\247\262<\272\247\263\273\361Q\316\365\277"
+	.string	" \220\316\3705\272\034Y\234l\024l7\244\355\360\301q\367g\324\030\bS%\227\177\322x\305\fT\357\312\252\026\355\312\261\034\r=s{\261\216\235\f`\242} c\376h\311\226R\376\254\304g\225\036\214\330\264\225\303\001x\216\031\177C\260+\002\217D ]\372%u\271b\354 lR~\266\340\313Q\376\234\225\234\021\236\312\314\355"
+	.ascii	"\033\225\366\345\252\260\2233\230g4\236gH\322\360\225xR\201x"
+	.ascii	"\331\227K\3232\316l\210 \331\357\326\013`q[\262(\263\363\330"
+	.ascii	"-\3519\016\303\343\354\f \006W\265\277 m(}\244\202\0034u\003"
+	.ascii	"c9\031\255\312\270\307\251\340\251<\234{<\350\340\377<\201\237"
+	.ascii	"\335Ka\311U\330\212\006\343\301d\361Hr\3348\030\351[Ai\016\216"
+	.ascii	"!P\200\326k\207\177\211u\242\360\202\003\fev\267\013\226\013"
+	.ascii	"\021\357sC\330X\362\263\250\267\364\243\346]\237\003\306\017"
+	.ascii	"\333\337>NHf?\350\305|\007\355\211\205m\235&\224\271\236\322"
+	.ascii	"\n<<\363a\323\261\356\024\377\306\316\234\322\317=\035@\341\""
+	.ascii	"-~\250\305f\274qh-\342\261\260o\340iv\253_\007\275\325\247\037"
+	.ascii	"\330\354\025\304?\350\377&wf\320q\321\371\343\365A\007s\225\236"
+	.ascii	"\213p\037\355\037\3138Q0\327\303\274i]\331\3644\313q\030\243"
+	.ascii	"O\367\027\005\007\242o\016\3450V\274\2516\223\355Y\324\245K\376"
+	.ascii	"\261\377>\231\033\366\013\323^#}\213\223G\254\246\2669\025YA"
+	.ascii	"\274\n\334un8\363\f\260\327\276p\352cD7\275\002\253\227\216 "
+	.ascii	"<\235y\3506r\020+\374\316q5\273\022\337\311\017\213\013<\036"
+	.ascii	"\203\027\201\331\321\230c\307\335\027\257\275\2000\344n\354N"
+	.ascii	"\314\250\315+\257)\231ow\b\346\t\036io\343\302\2078\373\346\236"
+	.ascii	"\024^\002^|^\330\3253#\227\366\244\226\234\027\230\215\371-K"
+	.ascii	"\335\231\277z.t\367\315q\261\377\373\fV7:\367\200\355\261\341"
+	.ascii	"\3178\357\240o\272\257k\364R{\315\370\307\030\376\225\341\023"
+	.ascii	"\345\201\276\265\340\302\303\205\315ctd\375\t\364\311s\321\202"
+	.ascii	"\313\226-v~\271t\336\221\204\274q?\331\r\203'\035\177 ;\3367"
+	.ascii	"\216z\365o0\346\254\367i_\253q ;\377_\355\032\177\266L ^\376"
+	.ascii	"\3521p\203\310\247\337\351\362\236`\303\324.\252\374\373\345"
+	.ascii	"\362\315\326Xs\264\007\220\177\322\020\352\336\365D\343\215c"
+	.ascii	"\242i?\347\345\265P7\362\355\252\307"
+	.ascii	"\361\241\033"
+	.text
+	.section	.gnu.lto_.symtab.a1c2313b70d7b55e,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a1c2313b70d7b55e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,578 @@
+	.file	"smartaudio_protocol.c"
+	.section	.gnu.lto_.profile.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"\235\005"
+	.string	"\322\207\035(\200M\032\003\350s@"
+	.string	"8\f\326\301\212(\201U\237u\260\302:\313\215\310\210!h\016\201\206?H$\222\220M\266\334I\356\016\256__C\330Q0,\2255`7(l\036%*5\031&\211\321\003j|&\353+GH\213\300\375w\335\267-*\t\255\236Z\2476\203\241`/\306\237\340O\210\332\350\260\351o}\277 "
+	.string	"\311.\242\314\317\335\233\034\322\004\341\326\245!\031"
+	.string	"g\023\005\342\300e\273\302\365\034\240p\266\200\f}>\334Y\256O\371\353<\334^|\034\020k\265v\323\002h\363\242\347\323\006\2452\336\034"
+	.ascii	"\256\256T 3P\273\223\n0\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375 \332e\003"
+	.string	"\302\304\r\026\260%\351\f\303\260\240a\030\206\241\024B\b\215\020B\032\331[\246\024\222\r\217+u~0\305\005\366\327\310P\"Ai\202\246]\332Z\202w\351\213\257\r\260\275\3238\b\026"
+	.ascii	"R\034\221\230\005\320E\tK\001f\252\211p\b\001\002L\023\t\027"
+	.ascii	"@T\244 \002\b\310\222\201\224\335\230\326HU\330K|\225\340.\027"
+	.ascii	"\203L6\200\005"
+	.text
+	.section	.gnu.lto_.inline.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`\364\004\255\023"
+	.string	"\366[V<0m\223t@cq\254\212y0\321\325\242@\021#\211\2171+\030\346\243\303\200:KP\271\204\210\321a\237K]\374\316\234\344E<%W8@\350\354^\351\355\377c\220o\237l\271SC"
+	.string	"D"
+	.string	"D"
+	.string	"\023\256\327(\373"
+	.ascii	"\236\301\300\001\030\300\033\222\334a8V\320]\3465\210f\235\016"
+	.ascii	"\003\277\002\021\253\307E_\007\2062S\300\247\346h\366n4$3-?5"
+	.ascii	"CfR\360\317\364\356>\016\004\221\231\354+\246\210\b+5\360\344"
+	.ascii	"\344\304D\364\017\336\342\3266\240\346AAQ\3307xw\021\005(\350"
+	.ascii	",$#&\035\020\3349\2419\241\376\027\274\274\274j\245\256R\322"
+	.ascii	"j\335u\227\347\343^\322\353\243KOX\271Rk\227\315\356\347\002"
+	.ascii	"Sz7*~R\375\353\270|\251:g\254\226\257\f\0341\361`\001\357Z3\226"
+	.ascii	"\263\016c\235\266U\351@eo\236\022\225\333Z\336&-y\324\322\007"
+	.ascii	"ADJ X\256\304\362J"
+	.string	"\227w*R\002\022r\257\374\342\006\317\t\251\253ZA\302\207\b\225\337(\005\r!.X0\f9L8Ab\300\024\tZ\263`\354\242\201\237\374\034\346\205g\0240\3005\013\360\024\201\327fR\257\351\325\023i\n*V.J}\277#2SsD\331\220\231\230\325\317\t]\200\217\250\361T\251J\206\222\244 i7\220\002\031\033\242y\022\200\0051\312rlDDcj\331\377\f\227 \331\311F\004\360\200C<g5\217|(\220\353\026\016\321\003\253\333\th\320\013\007\241\032W\247HsA\200\333\345\327_\3631\301]\224\316\265\217\313\217\2055\317\304\274.\314=\022\fZs\177\211\226\355\212\2202\206\320\343\324\372\323j>\230\213k\251-a\215i\264Q\337l$P\260\303\265\202\033\370\025,\004\277N\b\002LZ`\2560o\241\275\013-\310\347 \200@\016S\233\324~[\346\205J!@\246\360[\2130@\013"
+	.string	"nU\216N\347)HD<\"\017\343\322<D\326\247\005\031\013\363\270\327\320"
+	.ascii	"\273\213\317\215\030\377\333H\266\221\320\235\236\272QcF!\024"
+	.ascii	"+z\315-\353\002\242\217!\215\3340\030\234\361\360\367C\341z\200"
+	.ascii	"\033\356\334\025\245\2725;\027Cr\246\024\334C\341\253s\373\265"
+	.ascii	"\365\035\242w\305<at3\333\215\246?\036\t\307\311U\277\232H\277"
+	.ascii	"\250\341\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`I\001E\005"
+	.string	"B\207\025\035\240'\351\377\377\017r\006"
+	.ascii	" \212\252F\265&\204'\210\3322\"&o\177\333d\023\231d<\215\030"
+	.ascii	"G\254\177\242}\276\201A\t0\005\352\025\214\027#\376b\306\234"
+	.ascii	"\336a\314\252NX\311\r\327\216^\371\362\025\241-O\267\022^\311"
+	.ascii	"$\257\252\224\237\336=\364\245\200=\004$ \320\242\221\263\035"
+	.ascii	" \007\343k*\213\377T`\252<t+\250\234\f\016\317Mw\0053\b\006\005"
+	.ascii	"/\360x\004!\300\307\272\035\0023+I\236\3106!\034`4w\364\322y"
+	.ascii	"4v\t'#\321|\006\33418\007cNA>\374\256\305\335\327\360\020"
+	.text
+	.section	.gnu.lto_.pureconst.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\b\232\004\t\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`\\\001\375\006"
+	.string	"r\212\035$\2205I\007\377\377\217\273\273\357\356\356\356n_\337ii\2274n\277\375\377Mf\253\262\007\377\227\335\3266\271S\377_uk\fY8%k\016\344\307\352wK\301'\213rJ\326\020~\236t\221\301\216\363\020\263\371\203\034u\202\353I{\016\232]\335`\213\256\031&\177\300\344fg\207h5\263\007A\324\273\252\2363N\314\372\266_\037\270\256\027\344\n\326\212"
+	.string	"7L\200. \240\002!9\233\007td"
+	.ascii	"\362\b\020\215A\334\333\3069Z\2736B\001p:\300\266\327\324\365"
+	.ascii	"@-\207`+\326\205\0066u\257ncj\031\314\214D\034\212{\275UFpWE"
+	.ascii	"c\212Cw3\177^K|\251h\027\206c\274\324h\303\367\364\26132\224"
+	.ascii	"E\337\350i:\307\301\327\f\365)\221\241\265-\242\024x\b"
+	.text
+	.section	.gnu.lto_.lto.59552f0e7f5103a0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_smartaudioUnpackSettings.12.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`{\002\375\022"
+	.string	"F\343{H\300\224Q:\352h8\243\bM\325\321\313\345\266t\275\353\210\233\210\300\335\226\017\221\261\305\225\314\314\214K\246vL\207\213\340f\313Lh\335\266?o\225a"
+	.string	"\323LK\240k\320\033\340\232\r\2652Y\242\216\253Y\262\211\224)\005d"
+	.string	"^"
+	.string	"k"
+	.string	"6)\002v&\344\303\301\323\276\213\377\304\016t\363\001\273=J7vq*fpz4\356\007\276\307\323\013|\217\216\331D\216C\261\246\022)h0\220v\027\245'\036{\3644c\276\251%w"
+	.string	"5\033\316\343\316\275"
+	.ascii	"\266\235+\212m\346%\330\335\017==\330d\231\246\226\335u\326l"
+	.ascii	"\"\356\357\266%\330\206`\247.6\337\343\365\001\b\026#~\200rr"
+	.ascii	"\311\306\311RM\330\367vw\255=\366\227>\371\322&_\032<\320\177"
+	.ascii	":\3567\231\3221\246\275/\2551\2351}\002\rt\220\216 \020\262\033"
+	.ascii	"bIi\177\304\034+l\337\217q\"\232\007\371\272\033\215\r\n}\250"
+	.ascii	"\346Av)\002\037\355\032\033|L\320v\342\002\236\211~\310\026\316"
+	.ascii	"\343\305\200\221\275 \265\235.y\361\227O\325D?\035\236\"\264"
+	.ascii	"\233,w\027G\275\340\003\365\366\001\211\320\220Y&\361w\017\363"
+	.ascii	"\251\202\352\244\335d\027\256\003F\025\004R\224\224j\247\216"
+	.ascii	"\343Hu\033\251\246\\\221\317\325^\275F\314iwY|\0322,\024\243"
+	.ascii	"\233\3571\225\324v\326\360\031\255\323\356\214\305\2271\023\236"
+	.ascii	"T\004\253V\312\225!\276bdX0\330\352u\262jeC\250\na\241k\006&"
+	.ascii	"da\340\220\202\271R\255\027*d\241dX\251\026J\345z\241V\0248\234"
+	.ascii	"Y\271P\2600t\241@\\\316\275\325\236\334#\264\320I2\222\2432\247"
+	.ascii	"d\324\223\372D.\023\3625\237\350-\035\024\307\236FU\241-\241"
+	.ascii	"p\335sW!\241\363\211'\025\336C\217j\273\035W=\321\357x\226\002"
+	.ascii	"/ \260\002\02113\017B\241\201\t8\356G\371\340*{\254\242\260\246"
+	.ascii	"\267<\205\0258B3\337\023\260\276\207\233?\242lV\313m\330EV\335"
+	.ascii	"\354\352\020#\\\310\2066\357\245\326\022\037\030\223\0131\036"
+	.ascii	"ea\365\262tq-o\245\260{\361m\240\334\304\007\023$r(\006X\224"
+	.ascii	"\372H\226W[\270a\0010tp\2046\276\225\033\342\336\326v="
+	.text
+	.section	.gnu.lto_smartaudioFrameGetSettings.14.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"e\f"
+	.string	"\206\327UC Q\224\016\360\310:\342\020\362\264\200\032\247\017\257\215\004*(!9n\202g\306SB\250q\254S\265_\362|\362\333\362\273M\006\342'@\254@"
+	.string	"\334\002 \027\230\251008\233kC\230m{\223\275S\n?"
+	.string	"@"
+	.string	"F"
+	.ascii	"\273a\306\r,\237\266\375\221\223\214\374\035\b"
+	.string	"U)jzqb\355\330\r3\2077@?-/@?%\211\177\217\237\177\223_\"!d\200(\322c\345\301\356:\202\250\324-o[\201m\b\366;\004$9J\261e\207\246(G\330\277V\202\330/\371\343\025\375K%d\006\002\035\273\037Z=\026e\3060a\373\376\212\257B\017-\241\206\310\356b!\033\373\274=\2621\3331\276\204\303\007\354\202\3308\t,\020\207\200x]\243Q.\270\275m\342\301\313\233\374\242\032\001\221r\303\203$Yb\270\213L\n\025\037\3472\274E\307 $\345\343\255w\350W\256gu04v\327\201\317B\344\361K|\372 \372\371\325\t\3608!\"\233N\363\"\004\360\246\321P\267\372\251\036\307B\345.\200\264\217\247u\236\254r\331\006N\353\262\315\363d\232\004\256\234\215\227}j\3652,,\335\236\377(\200\023\n\224\2224\371\322\236p\030\235\345DD\001\243\332\335\n\3643\006\023"
+	.ascii	"\242s\241L\2130,\332\202\270\330\210\023\233\2304\004\002\006"
+	.ascii	"gt\346*\b\006\0019\n\211H\025\240k\270]&\036P\341E\025\202\360"
+	.ascii	"3\243\251\235O"
+	.text
+	.section	.gnu.lto_smartaudioFrameGetPitmodeFrequency.15.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`\032\001\375\f"
+	.string	"6\030XC"
+	.string	"\2216\035s\321K\370\256lHp#\255::co\375\340\006\314\236\t\234\321\366\223\021\367*\336\177D]B\253\366m\332[R\276\306\315\275\326\377\357\253\276\316M\003\203\336z\200\230\337\262\332\337\326\266L)B"
+	.string	"B"
+	.string	"H"
+	.ascii	"\243\035+v\303\020/\320\334\262\355\2238\t\305_\201\260\205E"
+	.ascii	"\202b\204"
+	.string	"L7vC\314\341A\344-\315?\344\255\350\341\337\365\363\037\363\352E$\003\\I\271f\032\354\256\025\\a\271\343m#\260\355\300~\207\362\326K'\220\003\204\210\204\372h\312\016A\0329\330\2576\216\354\303\374Z\251\017 \003c\206\001\033\273*)\035{\262X|\360K\274d\362\320\020P/\273{\231\330\327\255\333(\366e[\3650\031>`7\366\204\021=\370\b\022rq\322\020S\254\273\357\244\235]E\247Iq\242mZv\227\023suQ\031\211H(\217\nG\021\"b\204~\263\360\023\234\202\02086<\365N\276\344yS\267\241\261\273\f|\023'\035\337\345\226_\022\034.\363\036\b\260&raj\3233=\222\221\271Q(\311<^\306u\260\271a\030\266\214\3034\257\203\211\034\360$\341x\230gN\017\273\302\317\253\215\243\314?\031 \364\342\364\211 ?\332\021\336\202S\023X\343C\345%H\215\t\036\030"
+	.string	"\242s\241L\323M\r\233[\213\213\320"
+	.ascii	"\214\200\016[\3720\"\214\310C\034\b\027\f\003\314a\224\f\020"
+	.ascii	"\220\243\220\210T\001\272\206\347\262pL\b\rTxQ\205 \374\314h"
+	.ascii	"j\347\023"
+	.text
+	.section	.gnu.lto_smartaudioFrameSetPower.16.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`<\001\315\r"
+	.string	"\346\331]E"
+	.string	"\223\223\016\240U\032\330F\345wT_H\241lj}+\030z\260%\245u\374\211\212F\\K\336\265\037\351"
+	.string	"x\333&\337\206'\016D\202\333Zs\225U\005\350]\210\252a\002\353\261\2735B\252\265\275\311\336)\005G"
+	.string	"F"
+	.string	"P"
+	.string	"\207\t\361\001\273\247\035\251\335\352\261\203\316\245m\337\305_D\376\016\324\226\225I\342Q\232\251\331\255\230\353E\346e\347\005\346e4\361\357\360\363\037s\213\005\t\035&\025\224CN\204\33554\251\254\334\361\266\025\330\246`_&+\273\222`,a\337\332x\262_\177\3530?\234\320\2778@p X\355\246\254nV%m\240\360a\034\025\272\214+\334\324\354\356\025\262\257\313\333\"\373\262mA\273\301\003\321\253\311\005,)\307\211\324.\312c\t\020\006\306\220\001\336\364(R\372\241\022\021QlE\233\3445\270N\352$\013i\331]-\346\320%\205\206\345\205\334N\303\263\242\305M6|\006\307@\205\315\210\257\336\315\243\314\3412\272\020\232\335\205\340\3078\241\276\313\245\377a^\036u\002AR\260\274\370\030\301\336\006\202~\344\326e\336\204"
+	.string	"\326F:P\215\202\250\367!\241\234\206P\006\362\262\256\004\243\034\346\201\313:L\363J\260\221\004\246\237\315\303@\224z\330UG\2676\236\346\277\t\240d\243\032E\222\037m\013\277\001gL=\f@\371\013\023\306\005w\031"
+	.ascii	"\242s\241L\323M\r\177\\+\202\200\026\202pb\341\365a0\f\313CD"
+	.ascii	"p\005\030\006\230\303(\304\300\"G!\021\251\002t\r\227\323\342"
+	.ascii	"\235!4\320\360gB<\240\002\n?\363\230\332I\006"
+	.text
+	.section	.gnu.lto_smartaudioFrameSetBandChannel.17.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`\210\001U\017"
+	.string	"&\335gF\360\2226\035@\336v\347\016\362\f\025\237\356C\367\177\254[\265\257\350*\f\266\335\201\004\323\325H\242\201Yd\314\223\253==\245\307\210\031\243s\001\276\254\244\244\235\203\242\021J=:\016\327\003"
+	.string	"\200\342\266\275\244m\231RQ"
+	.string	"P"
+	.string	"W"
+	.string	"{\332\241\272\331\265\371x\202\352iB|\300.*\347fw\374\370A\347\231m\377\305gH.\035\030S0\363\364\022\301\n\262;n\036O2\237u^`>\223'^\272\226\374\257\216\251R?\304\227\226\253&aw\255\342\013\314-o;\201m\013\266j\001o\235\200\020\02523@L\372\262\307\223J\023\366\261\225(\3735\277\366\361\237\247\371\261\251\226S\255S\375\021"
+	.string	"1:\024\300\330\035\361\032\262\256\254F\n\237\365\326\3506\276\300R\355\256gd{\236\335&\331\036\273&G\005Lm\007\020H\037Y. R\222\210$\\.\262\305*m\223\337\360:6V8\221\324\356v\363\231\362\020qL\362R\345]d:\367\346\224\227_}\201\211\265\352\321Zq\322\2275\320i|Z\2708K\207\317\360\032\260\310\211\371\353\337|\313\037.\343\023\361\261\273\021\374\030+\240\217\342\231\017b>\013(\240P\210\363\320i'!\216\003\006\372\270\220B"
+	.string	"w%(`\007\212\3000\305\004\364NF\234(\344>\225\r\364\266\220\307}[\027\252l%\b\f\246\200\302M\004\202\341\346\031M\307V\242\346KsD,\3412\311\223\245\2641\034\207\262D\034\003\232=\303\304$\203\333\0326\350\305\035"
+	.string	"\242s\241L\323M\r\247^+\202\200\026\202\020f\341ilp\213\231cT\3609C\003\303"
+	.ascii	"s\030\205\030X\344($\"U\200\256\341\267[\024\201\211\0074\346"
+	.ascii	"3\204\n\212\200q`X\237!\200\nM\370\231\321\324\316'"
+	.text
+	.section	.gnu.lto_smartaudioFrameSetFrequency.18.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`\013\002e\022"
+	.string	"fc}I\320\224M:2\214!\311S\3217Q6\027\234\314\264\211\242\233\b$6\362Nj\346\223\323\234\250\343\026Z3\215\200\356\315\032t*K\035\222\275O\f\330\341JvJ\f\002\022\320\222\034XB\207Q"
+	.string	"\307\256\215\020B\310\226)\005d"
+	.string	"d"
+	.string	"l"
+	.string	"\265\240\244]#\025?\b\357\235\250UO\304\341\002v{\200$\355\226*f\020\336\263\355\013}(fYJ\t\264\363u"
+	.string	"\221\203[\332-S.\217\362\335\013O\340\2737\177.{7U\346\203,\235\212\022Dl\267\331;\236\317\222[\2553\260\273\307]un8\252 \313\356Zm\267\235\333\273m\b\266_l\265\020\276\206\357\336\217>\300\310\t\022CCh\232\263\313\232N\037\373\335\356\256g\217\375\242?\274\321\017\202j\357D\177wR\317P\255\240\372&"
+	.string	"\210v \230\261\373!\327\264J^\215 \377\305\217\\wa\t2\226v\027\345\262Q\217\331({A\203\330\215`/\013\214P\032\312\341\322\251\375\362-b/\272\321\223\305\t\366\004\nz\233N\024\233\220\222\2079\363\247]\3418d\302\0336\027H\200v\027\303wO{\330\202\204\323\233\237\307\375\224\303S\323\234\347\364\2465\347\bMs]7}Tww6\r\373\300\031\202\351g&\204\307\017\034-\342\323\313i\250\244X\241\207Q\035i\245"
+	.string	"\005\223\210\347.\363\375\310\342c\310\220\370\330]\007>\f\033\226o\342^7\253\031\021V#\222-b\314\330z\261hNnV3\"\254F$3\234\304\226\212l1\361je\303\270\032_#I\0033\262b`\252\027\251j\271R#+5\303R\265R+\322\225Z9\340\221F$S\257q$S\250\222\366ng\317[_\200&\033H\372}\353\233S\3076x\331Wbc\241D\2335\353\264]\256c\245\270\024\375\036\341\353f\202\007\" P\2421\b}\242\027Fg\332\337\360\213\326\013H\230G\343\031\035\\\330p\352\202[Y\304cT\252\270\327\030\3046!u\030\314a,\203\200\034\221\210\334"
+	.ascii	"\337\017\204\024\032 |=\264\367\243p\357\301\315J\272\262\"\214"
+	.ascii	"\272c\274\331\240\207,Tn\273\270\036"
+	.text
+	.section	.gnu.lto_smartaudioFrameSetOperationMode.19.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`:\003\365\026"
+	.string	"\266j\227J\260\226Q:\224H|?\210\3665\270\006\307S\0021\031\210aj\375\243\307\203l\352\257\234\246E\265\021\342\227L\331\337\036H\263\317=\365\tK\233\336U\321R\332\025r0\315\344\304C\315\320\203\255\366\355\2375\322Z\022+wJ\001~"
+	.string	"x"
+	.string	"\211"
+	.string	"8\3142M\r\3577|\002\206\316\352\341"
+	.string	"\t&J0\027\r\341Lo\372\371\222'@\305\250\265\262~l\326Ej\013\331,\333{\002\325`\325\210)\210\002J/\334\360X\255IRx\324z\312\330\300\352\242m\177\306\225\204\374\253\235(@\214\034R"
+	.string	"m@\251\365\264\371<m\274\270\372l\274\270'\376;\375\371\257\361T\f\025\303\340\207\241S\025\202Z\253i\360\003\210{o\273\200m\034{Y\004;\376\n\335x\361M\227Ii\201\244\344\204\210\016\355\263\210\256\t\373\251\272I\366\235\356\227\222\272VR\273\220\324-$5ME\315RR\317Jj\031I\035#\251a+\352WI\355*\251[%\365\nI\315\"\251\313\0255\271\242\026\177\376\251\013\177\252\242>"
+	.string	"Jd\204\t\025\273\344\254\036\206Sj\224\330\203\305\235~\373~\216;\371O45B\274/yF\204\013$%\236\037\353\"s\332\266\254\270\203ei\022n$\207%\212l];\213\255\214\336?F\330\306V\244\362Z\030\205\017y\255\nI\022\031\302\326\256\254k\017\f!nkW\226\026\001V\211y\271\254\035\237\034M)\242C\223[\356\201U*\\\b\271?\"D\350d\013\007\202\263\252\325\310\306\207\322p\001h\274(\356\237N\205\035\240 \321\020\2620\334\207\f\f\031\317\271\235\207/\346E\224\022\037>7\276\311\270\357\310\265\230\324Zm|\035A\0019\035\363\246\307\324\365n\273\234\217\331\342\355\364\350z\275\034o\225\343\271\355\030\274\214\233\311`\342\314\236\271\363\3111u:\276[ow\343\341\331L\235\255Gw\343\261\341v<\333\314"
+	.string	"\233>\271\235\255g\232;\033\353$z\252n\322\370\337\350\n\036\211\"\332\"\177\355\004WBm\004\003P\361\013F\2720\267\0338\240\017~i\301\"QG;\344\227\265\037\034\211o\025\025t\323BQk\215P\343\004\226\240\230\226<5\251\355\213\313\316\266\326\022: \260\"\231\323m\242\264P2\275~\303\371e\205"
+	.string	"\352\330\204 \272\217\350#l\025\347H\fQ"
+	.string	"\202\226\f\253\302\217\201A\3665v\177\326Z\3375H\265w\f\214\021\216\346\034\207\030t"
+	.ascii	"\232\317t\261\f\331\030c!q\227\235\334\366>\214\3460 \316\"\007"
+	.ascii	"H\224\022\303\237\204k\233\310\373\031\3417\0024\030xz\006^\021"
+	.ascii	"\270\b\230>0\0022\337\321.\0137\flh\302SFS\333\237"
+	.text
+	.section	.gnu.lto_smartaudioParseResponseBuffer.20.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`\220\002\275\025"
+	.string	"vj\224H\320\026Q:\344\3519}\271\331\374\003\246\321\272\032\203:37\363\277+C%\341\036\231\034\254\016\bE\365\217f\257\243-\236\254\317o\r\334h\363dd/Ee\205\022\360\330x\301\225K\203\n\365a[ \215\020\"eJ\001\200"
+	.string	"w"
+	.string	"\202"
+	.string	""
+	.ascii	"vnp,\231\263\204\371\347\b\341\226"
+	.string	"5\002\002\246\215\020\214\007\252\366o\374g\346@\"\3162gO\024\037s\226\t\314 \374\347\362.\340\277\360-\340?\333^\320`\3064/_\214\270\217\215\234\034P\346,Q\353\3424\377\274U\032\237\204\263\375\013O\3343\341l\274\2279g\tw\243\353!\340\021b\302\204\273y.FZ$y\356\272\203\273Q\035A\230sZup%n\360\266/\330\206\331*\024\237\017\002\374\367}\356\005T\234p\302\363\003T\243;\273\274\351\372\330\367\346\234\323\333c\037\350gy\320}\372\320m:\321\275\362\362/YM\262:\004\240\036}j0T\177\237\332\033\251\027T\353\247~\213l\005\024&0D\346\034\261\2332\213|@f<\350\037\372\211\276\366\214/\364\034\317\271DD{\261\t\2307\335\017\r\016\037\242\205\223\306\250H\007D!\250\366\211C\",kc\310\240\327\t\367[\333_HY\362\303[\237\3357\200\243\r"
+	.string	"\303\326p \033F\373\035G\256?\236\030a\261\357"
+	.string	"\202\373A\b\211\215J\361IwK\373\255\255\022\365:\340\276\340\254\315\336~\373\0359Uj\316\303\003\315\257\201\253\333Ia\332\335\0052z\350\226\366\264\252\303\251\261\262\272G\021c\227SeM\013\323\304;\r\374\256\254\016\301\341\271\231\365\"Z8\247\215\003_G\313\025\3169/\343\001\255\031+&V\020a)R\302\353%\023sj\315X1\261\302*5\276j)\013\244\270J\211\255\026rfa\025\023AR\214\211\221\371"
+	.string	"\312X1\327l&\312B\253\024\274F\3258\033\311\020\035F\327J&5#S0\031jt\241b\256\024\f\245\"e(\005\006<\206\020I\324l\034IT\251\254\371\366\370\271\017\320\007\271=/\234\240+\312\365X\237\006$\355\216m\322\352\336\254Du\346\001C\260)\025\357n\267\333}.Z\332* \220\002\2311\334\001\330\2009\230\225\213\004\203"
+	.string	"\302=\235\204\231\2548\321\302\005\"\032\2148\324"
+	.ascii	"\223\373\303\004[Uo`\204Y9\263Y\366\020\344\016\002\024\314w"
+	.ascii	"P80*\256_b8\037\342\005P\355\234\221C\277\340\362\302\331\240"
+	.ascii	"0\343\310\221G0@\314t\357\205=\214\001F\374\270\272\336\220\336"
+	.ascii	"e\240"
+	.text
+	.section	.gnu.lto_smartaudioUnpackOperationMode.part.0.22.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`Y\002\025\022"
+	.string	"\306!tF\360\262&\035\222\307\376\2074\2404\337\225\330\310,<\353Ac\347\003%\200k|\235\320\376_\235\231\370\213a\2729\354\2325\303-\021\244\005\003;A\252\231\277M\272\340\024w\f\205^\006O\200\277&do\"eJ\001Z"
+	.string	"_"
+	.string	"_"
+	.string	"\r2\377\255\276\345 \343L\3738G\301z\212\227\002\242\325\220\263!\266\373\225\034z\301v\350\357\004\342\341v\001\361\320\276\t\333+\031\263l\036\377@,\203 \256\035 \273\313\035\352\315Y\327\314X\376k&\303\365>\317\327L\207'\3113\315\301\356z\363p\303\333N\261=\301N\234\026\321\322[LkZ:\3064\374\367gZZc:\237\363\237\004\001,"
+	.string	"\315nL\220\220\375"
+	.string	"a\210x\317\355\357\254|\037\207l\277\207\247%[\330}\374(8\344i\371w\200&v\302\306\256\016\204\3550\344,\237\343\023\224\325\26712\273:%\316\322>Aa]\205\313E\333\312Q\"\266\253\023@\260\236MdS\273\364\030p\347\005\344\342\232n\234+(\323\242\332\025\036\313f\370\006\"\324x\363\303%\243\005\325f9\213\013\003~v7\305_\201\301\363C\034\372/\3610\333\361\002JU\275\317Kj\364p\r\201\311 \377.\361\232\352t\301Z\031\224jc\315\236\255\326\3301\035\322\322#1\003]\312\344\235R\235\004Q\247\342E0y%\325\b\325\235<"
+	.ascii	"\251\025SI\245\352R\233I&\026<\222\247\362P'\n^I\245e\244B\215"
+	.ascii	"XR\234W\342L\245\021\013GB\2458\223\004\366N\035\212Sy\036\212"
+	.ascii	"\313g\2535~0\002\007\214\266\254\2526\266Cj\223~\243S\035\242"
+	.ascii	"w\361\032\322\223\200\275\030Q{\3454Z\210\350\b\f2 \240\202\031"
+	.ascii	"\233\343\006\210\nEn\031\244X\006\306\302\221\346\240\2040\317"
+	.ascii	"\221\034,\177\217\250\021%\2209.[\261\215M\002Jta\314q\331\212"
+	.ascii	"}<q\003\232\344[\263+.n\222\367=X'\321\030f\nG\250mD\036\225"
+	.ascii	"\370\305\335\346~\225\326\263\324\324L\377\312\356\315\261\""
+	.ascii	"\267\310r\323 \264\b`'k\232\235o\316D\035\327\316\023\350\030"
+	.text
+	.section	.gnu.lto_smartaudioParseResponseBuffer.part.0.30.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`\225\013\3552"
+	.string	"\332V\370\022G`ZR:?B\\bDm\261~\241K\227\333&92\302o\310*\212\312e\210\356\277L\264\231\301\315"
+	.string	"dt\232\234\226&\242\341W6X\004\334\0163v\216\237X\375e\025\224\226J\020e\177\353\2374B\310\336I\006\031\001\016\001\033\001\337r-}.qp,\340X\250\371\t\315\316\303\361\272\023\313K\266l\335\300\257l\237-\252\177\345X\236\345o\rtks\272DmN9\254\304\230\332\265\264\276\225\250\216\321\267\362\264\2575P-i@\312'S\315\215}\2318Z\262\315_\276\2659\262\rg-\236\257\232?\032Vew9C\211\276\266\205\266\325{3*-T*-\004\370\344*\263#\023\360=4\352eP\002\240\331\331l|\273?v\262\030/\203\372O\316\\zn9C\031|\355\007\355\327\206\036"
+	.ascii	"\373\265}\020\373\265\373S\332\001\204\250fw\267\003\b1Zyh\021"
+	.ascii	"\034\357\222\262<\313\313\031J\374\212\211\\\371\036 \317\257"
+	.ascii	"\365\261\253\212oP\331\227z\017\360\362\360`e\375g\246\331C5"
+	.ascii	"`\367\003`M\255\333\022\301\370n\022<v\353k\0033&V\326\325\277"
+	.ascii	"\035\201\226:\252\350\032V\326q\225\217\347\362\212\007\213\212"
+	.ascii	"\3759\271\324>\244\271\345\273@\017\372(\344\234\373S?\336\302"
+	.ascii	"w7]wcu\003\205\001\227\231\207\232\344\347\335\353\356\022\257"
+	.ascii	"\223ls\256\212\320\247\003\343D\337\313\t\377\355\n\300\322\204"
+	.ascii	"\221M\335\351\305]\215\203Ws\316\2711Ww\337\026\022\336\016\352"
+	.ascii	"\333@\302\333?}\333Gx{\330\267\205\302\333\301\341\355\236\341"
+	.ascii	"m\340\3606\317\360\366Ox\273\025\336\366\to\263\303\333\353\360"
+	.ascii	"\266z\350\217\205\267\357\315\376+X\320c\b$g\034S;9\310\252E"
+	.ascii	"\311\335~,\377\225\237\355\217\373\275\374r\177\231?\315/\375"
+	.ascii	"\333\374r\336\323\375\376\335\363\212\207\323\2373\264\345%'"
+	.ascii	"NR\315\317\214\351\212\217\223<4\343\220\300#\355U\355\033<\351"
+	.ascii	"\322\322\222YDs\273n`\257\270\232~\335\020\217< b9g`\233\250"
+	.ascii	"\2631\252\271HV\231H\334zn\367\327\234n\305\331\030/47\3310Z"
+	.ascii	"nby9Wy\321~\365\271\017b\347\242i\216\307\256;\275\202\214\231"
+	.ascii	"2KKVywa\304\310\301\035\341\216>\272\350\356\272|\361\342\223"
+	.ascii	"\253\316\302|uN\256\337\002\226\007\337\356?\320\250\024\336"
+	.ascii	"\031\272\252K\247\237\363\215\354\017\363\340\276\313g\222\037"
+	.ascii	"~\364D\3474\254\206^\333z\251rL\351\324\205{$i\004F\206%|3'r"
+	.ascii	"\332\2211\306\347\303\335\032.\021\025\373\360\235I\242\313="
+	.ascii	"\026ws\270]L\351\212Y\374\345^\373\216cU\274bU\356j\217\352N"
+	.ascii	"\273\333\303\035b\274B`|8\262_U|1'\032\022G\217\254j\013\213"
+	.ascii	"\217\237\324\201Y\262\216\335\037\377\362!0;\035\377\333_\203"
+	.ascii	"\r\212\032\340\036c\334\035B\304=\263\205\330\226\220\261\302"
+	.ascii	"R\375\027\261\335#\256V\021\00159\347\b}\237.H@\261_\317\345"
+	.ascii	"C`\321<8Sw\3327\037\330\203\214\324\275\323\370\255\346\344J"
+	.ascii	"\303\270\253;\253\357\216\237\016+0X}\235ks9\303F\337\033j\r"
+	.ascii	";3\3722\261\f7V}\257nU\220\276\314l\265\346+\007\311CR}\247\332"
+	.ascii	"\256\375\013\2607\267Er\263\005\221\275\324\210E\271\335\200"
+	.ascii	"\255(R\007\322\375;\335\035\325v\001E\244\243\007\246\243\361"
+	.ascii	"\311\bYl:\006\241\216\230\212I\026Ed\322\257\311\251\210T\331"
+	.ascii	"\342\222\021\022\203\222R2i\250\342)\005S\261\003\222\321Q\t"
+	.ascii	"\312\b\004\262\210dTT\021\204|\002\201\304Td\221\305\244\244"
+	.ascii	"$"
+	.string	"\n\326)\005\223\361\351\251\350\324\366Q\003\245\343\321\361\351\210l:q4\"%\215\236\220FKN\304\243\221\310d4Z\"\036!\235\210\r\022\364\261\251\210$>\035\217H\"\360\230\253\331\250\026Z\333\372+\331\277=\303\334\032Z\333\355+Y!L\243\273\205\360\305T\375;o\nx:\235\352\365\004A\271fEsLi\021\033\304A\370Q\236s\200\302.T\031\307\224NM\371\017\006\202{\272Q\177|\246\3341\245\320\212\345\005\330!\366Y\245\317\350\022\216\352I6\210\207\270o+\307n\230r=cJ\203X\210\237w\242\324\231Y\024m\017J\020\037\357\304-gzd\315\026\315\233\246\336\035\260GYv\235\340:\246t\311\177\270\007_\2525\345\001\342\333u\205\313\304\202\320\034S:\265Wv\013\354\017\0031\333\324r\263|\342'P\013\200\335\250aH\206\034243\"\"%I\222t\320\002\221!\333\346\022"
+	.string	"T=\017D\314\320\210\220IAAk5\007\347$\230#\324\032\344\001\365\235\276\247wWy\375\003\034K\312u\223MT\202\220U\017\004\r\356\243\254T\272\220\037\255m\314#\205\3235\260\307|\3578\304\375\234\254d\211\213\030z\322\245\\\t{\b\n5\342\237.\204\202P\375\365\2452\344\244\312\262\260\231\f\254~\210\240\260\007\250\343\310\225s\272\223a\237\003B\352z\2568\030\256\001\235-\316g\024jz;\273\037\241\355\025\344Z;\217\005\332\354\303a\305-\304!)\355\216\213Q^\260\345\205\355-\216\316\350\220\300:\300\002\003\247\345L\360\246\305I\362\353\025\210\270\301\320G\024/\273e\003\266\312Q\210A\021\033\3542\201\2724PT\204\3508\2260\212b\027\261\252\315\270\025S\254\337\b\205\321L.$xO\312\304\324\357\f\304\207_ \017\313\271\3541\203\327"
+	.ascii	"\370(Qk\006\356\216\340\\\377\300\020&\032E\304\304)\017\245"
+	.ascii	"\016\316Ec\272\335+\340\255\005Q\3156\274~\265\017f\025\342f"
+	.ascii	"\024\001R\005M\177\326\302\274\213\3578\026\212\312Ab|:\350\037"
+	.ascii	"B\\\221\267\001!\313-\353G3\312\031\013\2000\fi\250Y+\017\256"
+	.ascii	"\360\234\370%\300j\346\335\0172gpxf\276\200\224tZ\341%\274U\001"
+	.ascii	"\352F\244\210)\003\304-\243\202\013k\270\356\260:Q\337\342\332"
+	.ascii	"\374\030\245)\rv\016\023?:1\370d\361\345\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"\315\005"
+	.string	"\"\b\037(\200M:\314\203\340\306\303\305I)X\266Z\200\001\310v\036#1\022\243\270\323\002"
+	.string	""
+	.string	"\366\032\005"
+	.string	" \202 \366\337r'\031Ya\366\007u25K_\264t\220\005\364\305J\235=\200::\365%P5\366\240\223\344\211#7\255Dvk\335\335\314Gjs\2065_d\256\300<q9\302\362C\345\206\0067Dy\341\232\334\361$'@\026\302\005e>\263\324\261\333\335\215\274\3212\323\234\032"
+	.ascii	" \023\220\t\310\004\362\005\233\2702\241YCs\251\325\n\354\262"
+	.ascii	"\320\276\271\f\227=@;\3609\3609\3609\360}'a\341\306\023\002\002"
+	.ascii	"\316\\E\\ \003\330\013|\320\326t\002"
+	.text
+	.section	.gnu.lto_.refs.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.59552f0e7f5103a0,"e",@progbits
+	.string	"(\265/\375`\331\036=~"
+	.string	"\352\305\214+R0\220\312I\007\373J&\216\347H\031\013\302N\316u\337\240\277>\240P\367\254\250\321\3606\246O\260\340\034u\314'\262\267.\177\274[k\025\221\357<\232\260\257\343\352\270\035\237\030\3032]\035"
+	.string	"\251p\314J"
+	.string	"8\207\232\232\232J\261;C\342\304\222-e\nM\002\251\002\247\002\334\306\304\317:\304\351H\243?\263Y\223F\301i\243\322\250\334\210\264+ML\225F\337@\324s\323\013\217\361\232\022\t\274\276\3149\220\003\243\321\370z\342\302\363\n\003\363\304\265\225e\255\200\263'\256--[n(3c4^\233\202\200\253\313\034\031\263q\030\036\363)\256\027\t\201\0270&\177\371\020\327\373\364\302\371\304\205\307]p`4\037{o\021.\313\030\177\320\377\"\006\263q\032\243\225P\272\267\210\025"
+	.string	"Jl\234Qx\367\256o\334\306i\030\216\3250\032v\3433l\206\343\330\311l\254v&\303e\336\353\275\306{\357\212\021?F\302\366\340\004\200\236\275\250_c\021)\017SQ\317N\3243\022\365l\245\262\030\036\303N\023|f\211Y\256W\317\236\225\275\274F\317B\324\263\211\224\237l\"=?\251#x\207z\202E\244\374\205\301\2603\005\213\235\271p\227\373\212\353]\357]\177:+\016\027\260F\037\203z\276\3410\230\2711\356\201zN\221\332\347\223S\244\217@\005b\021i3\210\324\005\003\352M\250o\252\352\305\316XD\312]\354\305_\366\330\224\274\315{\327\0179]b\256\232\215\362W\263\r\274\236\277\370\312_\3048\217\361z\335\273\362\027zo\221\031\205\0173\n\237Y\223\"X\212\276\325\257,\"U\031D\352\206"
+	.string	"\213`!\313\177\270\036\035\n\374\355\346\354M\203\377\374m\366\263\013XR\374\007\240\351\330\376\273\375O\363\377\314\327\177\021\256$O\374v\002\256\262\001\221\001~\353"
+	.string	"\024\002?K0A\005\027\301G"
+	.string	"\277\025\340g\030\034cI\304o{~n"
+	.ascii	"\t\225\377z\317\213\243U\374\037\342\267:?\0331\371Y\375\337"
+	.ascii	"\366?n'\375o\346\377\231O\204\243\360s\326I\374\215\346g\254"
+	.ascii	"\237_\3709\3713\221\237\241~\366\361\363\322\317\306\237u\374"
+	.ascii	",\374Y\205\237-\370\271\306\317\017\374\354\342\377\363g\002"
+	.ascii	"~\376\371/\3663\317\177\033\376\313\375L\302\317#\374\337\340"
+	.ascii	"\377\002?k\3603\006?g\360\363\005?W\3603\215\237\203~V\361s\212"
+	.ascii	"\237K\374\f\364\263\317\317=\377\331\374_\363\177\375\317\300"
+	.ascii	"\377\264\377\036\236\317\347\363G\313~\237\215_D2cK\367v3N\f"
+	.ascii	"\352\310\274J\006\215ma./\217\225\310\313\373\246D\252L\"\226"
+	.ascii	"\333t\357e7\352\022*\252\256\321>k4v\252h\034\256c\\/S\307\315"
+	.ascii	"\215U\263\212zV\221\376<\237\317'\253H\377\036#F\307\211\266"
+	.ascii	"D\327\250\031\211\235/g=\316\220\214u\230&cg\227\365\r\355\354"
+	.ascii	"\262\376\322\314\253\256.k0\r\305\256K\020\300\270\272\254\305"
+	.ascii	"\232\313\256\313\016\300\274H\254X\261\202\307\314\251G\226\212"
+	.ascii	">\025\242\246J\352}u\352}g\324u\365 V\204K\220F}R*Lx\214qi2]"
+	.ascii	"\261s6\272\362<=e%\303\266\364\026\327\026\262Q\2715\207M\211"
+	.ascii	"\236\232\026&\017\022\270\270\265F\301z\rK\230\234S=\223E\341"
+	.ascii	"-\353\276\340|)\333,\357\275X:K\257\354\354\257\366\352+m\003"
+	.ascii	"7\273\254JK\020\025M\031D\332\325\305\205\336$th\215Z\031\321"
+	.ascii	"\223d\271\365\304R\265\232JWago\265\224\236\262\025\247\267:"
+	.ascii	"jo\256\331[m|\356\304\335\231\301QQ\037T\024(\036\230\220\341"
+	.ascii	"\361\244\321\345\321V\021Af\331\251Mxm\252\202\035\342\346\272"
+	.ascii	"I\033\3258\351'\354\354&]Cg5\023\256\323{\243\006.E}c\226\\\213"
+	.ascii	"7U\266\203\222$\27677yi\032\305\302c\243\314\241K=\327\001q\""
+	.ascii	"SvT\223\322\007\r\215\244\217\364\025;[\331E\332H'yN\371\003"
+	.ascii	"\375\262\241\311\216\0354\207A\244\250\021\253*#UZ\3124J\325"
+	.ascii	"\344a\232:\202\026\215VR\r\244Jj\206\031\232H\017\351)v\266T"
+	.ascii	"\007i!M2\251\216\3421\037(\240kT\242Z\336\273\256\350\271\312"
+	.ascii	"2r\334A\321\250\267j\352m\231\3727\024\222\355\232oZ\2152}x\030"
+	.ascii	"QK\363\224B5\206\361\342\325?\332I\314\234VV\243MMc\247\275\255"
+	.ascii	"\205EQ\317s\315d\231K\225\007X\223\271{{G\373\350\036\315\243"
+	.ascii	"\227\372\310\316fjb\027[\211\301\214M\246c\322Ll\327\327\256"
+	.ascii	"K\325y\265d\356\336{\2563\313\"#\002]\24535hi\24662\232]\227"
+	.ascii	"9aWNV\214\310\241;\323u\347\203\336:Qw\030Dj\233\324\347\b\017"
+	.ascii	"pS\276\334\354\324;\220\307ox\214\315LI\340\225\303\\\331\016"
+	.ascii	"d\226y|\247\366\304\025\207\365x\217\235\234\307:0\034v\303d"
+	.ascii	"\347\365\036\231\367^\265MnMNE\337r\352\317x\277\316\216\232"
+	.ascii	"\016D\226h\3247\030\365\r\246\276\275\324\267\226\2122\210TE"
+	.ascii	"'Qg<Y\314\246n\211\3748=\217p\032\265R\275\307_Xet\215Z!v\310"
+	.ascii	"\230\224\230^\243w6H\2235S\3124\352\263c\267\204\311<\342\344"
+	.ascii	"d\241\236=L\330\226P\220\267P9VzB\324\032\265O\275\007E\f\331"
+	.ascii	"]\243\366\007\243\355\250i\223F\246\263t<Z\037l\226m\027\246"
+	.ascii	"\310\236e\272\365\241\003d\007\220f\243\266G\357\261\333\336"
+	.ascii	"\026*l\354\322\355\2225\252\367^\265%\217\023\033\234\025/y\317"
+	.ascii	"\263F\236\272D\272\023V\304P\037{<\270<o\215V\351\347\206(Je"
+	.ascii	"\032\265\327\022\331\3714[|\212\234Zo\323\207\214\007\2274\246"
+	.ascii	"z\031\370i\351\357z/\215r\254\206\2758>\3058$pf\355<\222P\353"
+	.ascii	"\334D\241\322\353\033\332I\302W6\005H\326\022\273\206c\327xw"
+	.ascii	"w\215\027bLrJ\205\017\215kL\017\035\336x\374\245\266\0313\263"
+	.ascii	"j\264\337\330\274f\032Us\361p\245\326\246\372P\237\343\246\312"
+	.ascii	"\311u\235zc,\363\226[t\357:\333\346|\342\246\321\236\353\266"
+	.ascii	"\036\253=\"V\267\361\301\211\213\022k\303&\316\226Q\257\251\213"
+	.ascii	"M\246\362f\246\271\346\277eva\356\300\250d:\r\231\216K\357\345"
+	.ascii	"5\371\204\204{\307\241h@\324\2045\332o\335\266C\303MfA\363]\275"
+	.ascii	"\221s\346\320j\3572/\323n*\361\336\234'\310\274%\336\235B\252"
+	.ascii	"\370\033\315\333\355lx\356\365\272\367\226P\225d\274\3364\332"
+	.ascii	"l\335\206\252U\355p\325v\246g\245b\223\"\227\036\265\316\362"
+	.ascii	"\032u\266\031V\373\177/\223\351\251\331h\2571\232\272\367\203"
+	.ascii	"\210\261\321\337\351\3600\001\tS\244\321\3470\251O\321\250\177"
+	.ascii	"\377\351-\"\357\275@|\353E*\361\234}\334\303\226\017\370\217"
+	.ascii	"\332\377&J\270\227\270fi\247Jq\026\251\032\275\367\255\335kT"
+	.ascii	"\022%PB\031\225RG\246\362\022\215N\210\037\220WI\374p\215Fb\005"
+	.ascii	"\311\373\341\310\274Pw\207\031(\276\253\222x\215\311\373\341"
+	.ascii	"\032o\361\304\321\250\204:2\213P\037\216L%\324e*/\3205\026\221"
+	.ascii	"=\214\027\371\3412\225t\227\231\204\002:2\223PG\246\322\212\233"
+	.ascii	"\216o\270\240\344\226WgL<\032\357\017\247\252\"\022h\355\270"
+	.ascii	"&\357\333\275\334\\\272\310\003\356\255J\"\337\212R,\246\264"
+	.ascii	"\366C\351K1\311\253\223\322U\362\032\327"
+	.string	"\216S\222\367NQ\272q\235`\020\327\265\273\204\327\210G\252n\323\322\275\0038\335K\344\273v\357%\336{s\220U\353\2753"
+	.string	"\035\227NN\367N\215p\272U\304\037\030\0015"
+	.string	"A\3427X\020\t\211Z"
+	.string	"\203#~\303\241\242\243$\241\027HB'\264P$4\203HH\004\200\0015\212\200C\024\f\177!\230\020\376\\\b~0\374\205\360\301\001C\241\037\fFH\351\360\207\301"
+	.string	"\302\037\n($Q\360C\022\016}0\342D&\\\260\030\n\207\216Xx"
+	.string	"\264\221\300\211\214\204?\340/\005\3650d4 c\306\0139\237A\303\005\r\027\351g\320\b\n\242!#H\275\214 ;\024z\341\3000\351'I\350\003\021\320\020\t\204\031I>C\0203@\fC\310\b\262\021b\250\003\007\320\203\032%\206\004\314 `(#\310F\211\242\241 \016\035CG9E\277\026\204?\244\237P\035\022\t\211,\222\320\017\t\030<B\372\201\200b(@\021p(G\216 \321\320Q\212$\224\301/\307\220\360\002\001~E\301\032C\341\320\020I\347\3060\005\340\017G*\374\025\r\375n\244\300\240\321pH\370;\n\366\f\177#\201\007\217~\302\026\303`P\330\302\3030\311\003\021HBH)"
+	.ascii	"\215\206\303_\b!\200A#$\341\257\205\234\242\337\nDA\034\300$"
+	.ascii	"\025\307\017\b\034\272A\2243\024\232\221#\374\271\020<\362\241"
+	.ascii	"\2403\024\222\0214\004\032%\251\017\n\252q\302F\007\030\250D"
+	.ascii	",p\004\211\202\303\240\360H(hT\22444\024\016\345@j\0214j\001"
+	.ascii	"4\032\312\321\202H\210\324\202\005\002@\277\242 \007:\210\200"
+	.ascii	"\277$\026~\302\013\204?\244\244\017E?\034'\f\001-\360\371\265"
+	.ascii	"`4$\232\340\227\002p\b\004\240\006\277\242`\216\241\321Q\b\034"
+	.ascii	"\301 \005B>\260\272\237\2731J\346\2624\236\362\214\031\270F\355"
+	.ascii	"\n#\371e\261\334\256\226\270\332\365G\357\336\"3\212\226\362"
+	.ascii	"%j/\355\352\262Wt\352NTYz\335^\361\031R\265\324a\207K\265[\374"
+	.ascii	"|\352m\375\034\231\311{\213\226\313Z\271\335\372eF\301\214\342"
+	.ascii	"\307\204\246\253\246\264\212\305B\263\326\34049qb\265\354\232"
+	.ascii	"d\336rk\312\255\226\2070\342\226\263F\255\224v\003G\n\207F\355"
+	.ascii	"\023\033\205\315\030i\022f\243X"
+	.string	"(`U\302\274<Y\b\033R\252\321\245\316\027\2552\313\035\333\244\343\324XY\302\324\250Ub\225\330,\276H\030R\222\266\206\333,\036.JV\262\032\265K\272ME\213\232\301m\310\227\224)\254F\277\323\244^\251\264X\234\345>\245I\350\236\210\301\273wJ\005\217\334\224+O,\222[,F\353\321B\266]i\324\036a\264\025\313e\230F\355\325\333\f\215[V:-%\363\244\267\303\232\245\262T6i\003\231\267\334\332\241\272wA\214\334&\321.\307UM\243\266H\357u\3012{b\305y[\364\340\254\225\255J\325\362\272\260!*\213\034Y\243\242,\0214S\2763\252\202~\250\262\3710\007\322\214\231\231\222\021\221\244I:\302\n\020\204\"i&\371\314\003\022\240\004-\220R\230\031\031\032\031)\217\224$\331\230\003\326\031\305\243\345\302R\325\204\224\350y=\360\265r\252$\260\037\377\307\243\003\241\300\013\233\376\276"
+	.string	"\213\340\206\265\335\357\332\212P\352\\\302\022\302\245\264\0304\017\232\200\204\274\306ZI\020\256\004\250kM\214\362\325\007\013\315^\024\216\007,\240\006{_\337\253pf\333\247\230O|$\244J1\021Jpk\270+\007\301P-l,\300\273\"_\201"
+	.string	"\200\311\372\361]3\377\3016\226\353\251\237\300(\277H\214v\364\"q\316U4;\t\202s\007\273\n\376\270\022\004\363\352\364\211\341\247\312\021\232\332\243\305 \"B\234>0\302\210\330\\\364A\222\346"
+	.string	"a^\330\347\203\253q^;E}\002\234\216\353\356\207\2141\320r\372H\375\344}Yv\274/\2208}1\250\271ob\257\253''\323\005X\327(/`\247\252\345a\367N\364\327\001\013\305\264I%C\363\2310/\201\034\204d\310\345z%\252\001\342\177\031}=\260\315\306z\334\362\272\320\374.)3\250\201v\223\233\026\275\342\235\236}\300\247\354c=\272\345\342fhF>p\351+Ht\3334H+\235\311Tk#*h\264\214\f\t\361n\3728\2734\317\3146\311\020\311E\234jDs\205\341\360P\272\250\355\240\227\205\366;\203\023;\270\350\300\001\200\305<\272i\016\263\231\t'\035\024\265\3404\022\373wV*\016I\320\364\302<g1\302\216\251u?\013\t\276\205\266\264 \361\240\373\242\b;g\\\200-R\3575)\003\303\005(\351\315\222\210\026\217\035q<\311}\2326^1\\\203*\023\265|\313"
+	.string	"H\340\001\272X\211\247|\260\220\212\034s:\214>{\036Bl# \207\270\201\260\007\375\200I\3774\rc7\266$Q\343rl;$\231\204\223\346q\273\324\3708\005\331 f\304:\025\242\3335M!K\254\246\222Fe"
+	.ascii	"L3\342:F\001\333\307r\267\340\355\263\3719\345\023\376|t\240"
+	.ascii	"\263\215~\253'\310\227\314\311\355\250i.q'\322\251\204\345\031"
+	.ascii	"\331\260hc\354\236sZ\244Rp|nu\357\273i\3574\232N\013\266)\324"
+	.ascii	"IC\004\273e\261?\331A\366\363\226\232O\253I\236\343C\334\004"
+	.ascii	"\214|\275+M\350\334d>z\017\270:\205\216\217\214\033\364\237R"
+	.ascii	"^\212 :\347\237,O\337\210\264\372[\343X\254\326\301Cc\236h\220"
+	.ascii	"\212\233\202&\221\250\210\262A\314\217\350\222X\333x\363\221"
+	.ascii	"\322\330\337t\261\304JT\374l\002?E\335o\203\207\376\354\177\023"
+	.ascii	"5\223\331\f\231[=\347D\332\241G\r\023\344\2014T#y)\2621sB\313"
+	.ascii	"1o\271\264\023\211lj\276\220rP\376Bn\366l0\251\226\326\322\007"
+	.ascii	"\3551\213)8\026vb\212k\272\367^F\306\305\r\374\347\030&\312\003"
+	.ascii	"\311<\236\312\367o\253\031\260{.b\262.\335h\376\233-Vw'{\257"
+	.ascii	"\324\025\270<&\316\251o\304\2748\200\n\314g\f\205\3470\200\336"
+	.ascii	"\371g\342d\222I\306\221\335\303o\306\256TjX\025G\361\245\221"
+	.ascii	"q\372f\2141\271x\301\300/\243\272(Y|\340\3016\262\205\034\r\340"
+	.ascii	"\323$\215\314\205\024\307\022\275B\242E\036\312\364\211q\"\367"
+	.ascii	"\210\231J`\023!:\350#\330\367\377{k\373x\200\2216\205\352\025"
+	.ascii	"i4vs\245c\033\026\240.H\354\253\366\204\374\341(Ve\211\300N\227"
+	.ascii	"\256\356\007\032>u)\324d\327\251\343\277\243Od\243\221\306\340"
+	.ascii	"\257\357\020p\007\0166@\016\255N\355\342P\312\276\352\362,\211"
+	.ascii	"M\313\271\256\372\007\255K]\222\261\317\036g\366\313\260}m0f"
+	.ascii	"\025\200m}M3\350-D\370\274\373\246%\004\022\352\212!\334/w\331"
+	.ascii	"\372\262\246&\3166\221\034\361\005\255t~j\276\037\030x\275f\007"
+	.ascii	"\301k\317g\367\376\302\376\017\260|\300^\336\233\315\316\212"
+	.ascii	"Gk\374\3427\343\334\017\322\213\005+\365\234z\276\216S;\337\337"
+	.ascii	"\343\237\225\355\006\305\330\236\313*V\322^\r\272\204\232q\334"
+	.ascii	"\204\327`,0\376c[aO_\006\034\037$\3364k\201\337\356\336\231\255"
+	.ascii	"\r$\230l\365\253\3104O\331/\357n\371\264D\363\317\033\360uwn"
+	.ascii	"\366j\fg\344\230E\320{s>9\276\347\024\365\233\372\001\r.a\224"
+	.ascii	"\336T\331\245\333\017|\371\355\204\317\362\235\302\037\341\242"
+	.ascii	"\372\260\312\r\337\233\036\221'\026"
+	.ascii	"\233)\260q8.\216\345\317|\303\331[;\346\200\215}\234\324G\340"
+	.ascii	"\267\177:\006&\341\004\331?u\242\300n\261\273\311 \231F\013\357"
+	.ascii	"\243\2053\210j\005"
+	.text
+	.section	.gnu.lto_.symtab.59552f0e7f5103a0,"e",@progbits
+	.string	"smartaudioFrameGetSettings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"smartaudioFrameGetPitmodeFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"smartaudioFrameSetPower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"smartaudioFrameSetBandChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"smartaudioFrameSetFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"smartaudioFrameSetOperationMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"smartaudioParseResponseBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.59552f0e7f5103a0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,264 @@
+	.file	"main.c"
+	.section	.gnu.lto_.profile.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\231\317\260\204\001"
+	.string	"\001\314\337\304\332\f"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375 \036\265"
+	.string	""
+	.string	"p\022"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375 v\r\002"
+	.string	"\264\002j"
+	.string	"\002"
+	.string	""
+	.string	"\006\301\377\257\207\003n\001\201\200\200\200~"
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"\002\013\001"
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"\004\200\200\200\300\002g\001\n"
+	.string	"\b"
+	.ascii	")\033\336*\360\024\035:3\233\366\262\f\207y\375\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375 )-\001"
+	.string	"\370\035"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002\002\006\177\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\264\004\001\224\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375 \"\205"
+	.string	""
+	.string	"8\026"
+	.string	"\002"
+	.string	"\002\001"
+	.string	"\003\020"
+	.ascii	"e\020\274a\001"
+	.text
+	.section	.gnu.lto_.lto.f1583db9dc93e95f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_main.14.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375 \317\275\005"
+	.string	"\222\312'1PM\223\016$\351\252\301YF\313p0,LJ:5\255\204\270[`i)T\225\037{\271\321Xs\026\311d\3206u\007:\n0\320\266\021Bd\nKP5E\024\254\246\210\202\322\305"
+	.string	"!\201\255\005\205\0136X\326\005\235\353\320>,\024\256\375\003DkvE\232\220q\211p\330\217`\315m|_f\346N\343\037"
+	.string	"\nAI\246\305\212J^\030\023\217?~\300\005iH\374\023\004\211\327A2aI\311L\370\264\240)\363:\320\224q\034\215m\361\336\234\203\314\274e\027\030\335\3657\370\237\277\"\b"
+	.string	"h\310\f!"
+	.ascii	"\334\255\331\344\315\325\344\302\227\004#\243\005f"
+	.text
+	.section	.gnu.lto_run.15.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\315\006"
+	.string	"b\214-4Pm\222\016$\023\n\255\322R\223Dn3\204\026\036\372S\345\035\355ep\214\335'\311\332E\323l\2311\315\314\f\256zZ,\032E\034\303\264\371\377\033\331D\246w4 \017\347\363@\036\316\347u\254\320\323\004\\%\034Xo\241\252\254\227\261\\\304\256C\354\2774\203*T>\304\300\221E4h\214\355\035\036ZIw\243\027\222\214\f\002E\275CT\227\231\211xq\033b_j\302\304c\304\276\2020\002\021\020\311\244HA\311\214\n\301\370\233\371\372\222\001\t\200\221\321\307If><\215\355\252\303v\335\002S\235E\021S2\265Y6\231y#\225*:\325\177\363\023\374\247\r"
+	.ascii	"\024\013F\023f\201; \037\315a\304\031d-\227\274\f\001\344\200"
+	.ascii	"\333i\263e\340\306\025\212\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375 \323U\003"
+	.string	"\362\004\022\035\2605\215\001\3144\212\245\022\030\272\n!\031\306\327@\273<)\240\210\210\016D\344\226R\246'\033\2524\\nTpTi\f\224H-\222\032\267k\037\t\240\036\366g\332\335=\025\214Y\316\353C\313\262\001<\246\303\375G\001\r"
+	.ascii	"`\0200\b\030\2445\210\301\f\003\324\003\200\003\300\360\271\352"
+	.ascii	"\247\270\270|v\032O\2039\006"
+	.text
+	.section	.gnu.lto_.refs.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f1583db9dc93e95f,"e",@progbits
+	.string	"(\265/\375`\327\003\315\033"
+	.string	"\026s\266J\260\226Q:\364\363\216\036\002c\204\b\243\030._\234\372\243v\002PF\001R\030#\264\212g4\221\203\2332\365\332\276\340\227\276\267\372\313e\310\372t^\370\344K\267\r\374\277\340\331e\346f'P\220\341\032pQ\242VI#2\005\222"
+	.string	"\227"
+	.string	"\250"
+	.string	"\357\241\036\210\320\205\022\004<\315}\274_\317\b\235\001\352\241AG*\332\340\231\032\241:\305az\364^5\367\374\241?z\225\020X\246f=\361\377j\241Ik\020\375Fr{\254\322\372\200\355\017o] v\371\352\323\277\326\270\244hyA\034I\234\275i\221+\240e\004\245w\3112\274C\360Xza\255\232\205\265l\023\231*\272\354\025jB\022c\257\n\333R\266\213\266\243lC\331v\262=\264\r\3046"
+	.ascii	"\333Jl\263\256\256\256\256l\343l_\261Y\"\002I[J\035Q<\027#i\033"
+	.ascii	"\347\260\337\004\236\251\320|\235)\357g\023U\360u\326\027\021"
+	.ascii	"x*\343gEM\0225\377\233\343\353}\302\340}\250\211;\353\201\257"
+	.ascii	"\250is_\320\346\254<\363L\205\301=S4\370\272\357\346}\274\242"
+	.ascii	"\322\207\006\317%h\320\346Ly\301\323'\fnE\277M\244\252\320\004"
+	.ascii	"z\312\243\371\377\253G\346\314\317\003\336t2\n]\230E\3500\276"
+	.ascii	"T<\252\214\027\370o\022\253\214PW\355\235\352DB{\200\376\252"
+	.ascii	"\013=0\327\254\377\203\3363\367\007\252\300\007(P\260\256\304"
+	.ascii	"\250\262\261TFE\355p\231\022<\235\200\221Tc\232@s$\275,\312\247"
+	.ascii	"\247\205Z\246\017\255\0200AK\272\374D0r\312\b\215\251%\342\205"
+	.ascii	"\302\362\344\207\224\252\221\264\3252\265\230\f\201\3712\222"
+	.ascii	"\336!\022\327\311\346\275*\304,\b\302\254(\342t\204\334Qe\t\307"
+	.ascii	"H"
+	.string	"\272C\351\r\262\251\267\311\3076\355\260\254\0372\220\343\267\304\245\313\211\222`2alDa\262\362\016\355\006\020\214e\346W\372\177 \306\t\322\215!#i\t\345h\267\376\0241\365\300\336L\313^o\314.\314\246Y\326.\260M\376\004\352y\001\273\232\255F\272'GA\216\346\363\303C\353\231\351\\5[-6\003q3b&\373\200\273\335.\350t\264\331-\207\253qO\316\205\r\0264\304v\264\0209\331\016\307GF\313\355\350xl\267\031Mw\313\315j\030L\310|h<\003H\007\360\rG\313\305v\267[.&c\373\311\261<\253\345h6Z\210\322\017\"0\2100\241\004\200\335N\003\007;[\355\247\264\216\016\005\034\016\031*\224\263\034[MF\"6\313\351b9\257$P\251\025/a\246\354=\262Hv\310:\177h}\221N-f\030\215\244\353\336\264\312\025\320\222\222\032r\202\274aET\242R,\356\260"
+	.string	"\312\232\022H\250q4D\224RD`\220\n&\220\240d6\311\003\200\002\031\262\235\003\020h7'i\335=\001\266m\314I\002\210\202\342\230\201\334^\005f\210\246"
+	.ascii	"\320\3259\301\251\007\211w.1\235\201 ^7\260D=\3542I\344\207D"
+	.ascii	"l\226I\0326^n\206\330\330,\305\321\333_Be\300h\027\257\301f "
+	.ascii	"\320\243!\366\211\264\"\244A\220&\273\203$\2045\305\353\310\377"
+	.ascii	"e\304'\r\201]9{\241\374\211r\242\004\367i\347I\235\265\346KD"
+	.ascii	"]\366e\017b8\266=a\007\316\035\327P\2776j"
+	.text
+	.section	.gnu.lto_.symtab.f1583db9dc93e95f,"e",@progbits
+	.string	"run"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"main"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315"
+	.string	""
+	.string	""
+	.string	"processLoopback"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f1583db9dc93e95f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,5369 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`G\n]\027"
+	.string	"\246\334bI\260\226M\322\001\264R\212\247~\245a_\371mC}\317\235\322\032\303GV\234!\267\267\334OQ\207\037\356\017\372\017\372\017\372b%\374\370\t\b\233A\033\236%oy\256\361p,\001'\030\027\017\333\310V\267\256\275\005\371;\311\026L"
+	.string	"D"
+	.string	"S"
+	.string	"\013\356\n\216'\230\005\301\201\r\334\272"
+	.ascii	"\313+\347\254Y\247\226V0\234\030\335V\b\254z\200*\027\020\340"
+	.ascii	"\b\340\325U\031\334\353w\356u\325y\312\335(\307\324\371wn\356"
+	.ascii	"\331MKr\314\230\373| %1\225k\214\333\021\023\307\342>X\327\303"
+	.ascii	"\331\341"
+	.string	"\276:\354\016\366\213Cnh\256\341^s\206k.\315\030\356\205x<\023\334Bw=\263\353\n\273\246\260\353\t\313\\\231SB\204{\3141\303\f\003\341\376\362K6\037\334]v\271\345\356\3406\030dpY\240\037\237l\333#\242!\316T\220\016\t\023\245#<\2347$\252\t\215\235\360\360\263\031Qz\322\231\311x\336Y\347\227\007\362x\372\341\"\307[\361\242\210-v\204\302\021\245\002\247\317\316e\313\276\271\347\334inc\315f3\217\333\234\305\271\001q\267\271\037\002\034\027\223R<\251Q\333\203\022\322\003\211\026\036\026\305\023\027\2318<\234Y\351PB\304H\250\304q\024\325\016\024G,\202\200\300S\361\346$\343\306\017\211\226\257\305\222\255\311'\005H\022\033N=D\023]\2736m\332\265[\323n\215\350Cw\017\375\022j\020\330\305\332633\200\276\250\261\321\240\002\222\221\244\240Ph\016\260\202\033\032I\334\022"
+	.ascii	"\363\030\317s\214c\bA#\001IT\022\215D%)H[X\003y\304+\344k|Vk"
+	.ascii	"\0379T\334\225L\034+\037i#\307L2%\370I\214\206~\202\312\216K"
+	.ascii	"`\326\303n\246j\231Dd,:\341\375\2219\232\257\334\340E!=lOX\361"
+	.ascii	"\210L\363k\230u\237~{[\032\246.~\367\305W!\307\325\033\036\241"
+	.ascii	"\246\343\204\310\303\251\\\221Z\263\364\335\377\225m\336\330"
+	.ascii	"\235 k\037\003\277\211\001\016O\203Dv\351I\244Z\026\003\217e"
+	.ascii	"\323\222\271\240w\370W\016!\314\302'\241nfr\356C \2369\362\336"
+	.ascii	"\206\311\365\017\303\253\332\247\251,\276)gQ\302\262\033\r\353"
+	.ascii	"/\324\220\234\223d6\261W44'}\344(/Bx\236\333\023\361\372\013"
+	.ascii	"\b\2333\321\220e\234i\342L\\\371M\2775\205\254\340\324\326\037"
+	.ascii	"k;\317\375\375\025\214\375M\276c\233\373\314\330\233\003\322"
+	.ascii	"\255\203\363\205\001\226\272\221~X\266\263\227\270\353gY\266"
+	.ascii	"\020\235\327\270Id6\231nj\230\236?f\373\310\025=~\331v\277\375"
+	.ascii	"\246\2143\370A\\\002W\003\353\227\304\2754\036\262\213\364\373"
+	.ascii	"\222\323\375\307\351t\365\313\177\334<&u\314A\t\001\375V\224"
+	.ascii	"C\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`\222\034-\026"
+	.string	"\262\f\034\034\2007I\007"
+	.ascii	"\210\f3p@\034\221\223\275&\tZ\311\020\250\347S\266\331\310\336"
+	.ascii	")\005\356\022\f\224J\245\036\002~\\\b\227\200\022`z\324_\237"
+	.ascii	"\252\261\277\373\273\272\273\373\352\257>M\007\327\210I1\364"
+	.ascii	"\362\302\350\321K)4!\302L\027m\333h\333\266W\217\366\036\231"
+	.ascii	"'\303j\3652\032}\357=\203\251\020\223\242\235w,\005\323\210\211"
+	.ascii	"[\360\220\020\201?\250A\336M\226\315\261\005\0061\007\031m\033"
+	.ascii	"\022 a\210\020I\202\034EB\306\020B\f2\210\020b\b!DH$\0209\021"
+	.ascii	"is:P\200\325L\004\314\212J2\246\227\3032R\373#\372A`\2309\013"
+	.ascii	"\016Y\212l\2240\037\033\217\037V\202\037\206h%\006S`\177p\t\251"
+	.ascii	"\013\267\364;\245\217i\004W\234]#y\177\225\354\365\2606\016c"
+	.ascii	"<\200\034\304\302\200\340\266\220\324\336\027\004O\225r\371\343"
+	.ascii	"\343\252\360\215A1\352\3633\365Sc\225\326\304\210\bR\335.ErK"
+	.ascii	"\272\247\206\243\005#\344\005\t\017\261\213\023\332\252\303\035"
+	.ascii	"\302~\310a\240\367\245{\ry\277\013\020\311\357\2119\350\234\304"
+	.ascii	"g\236NX\256\352\001\002r-\314\333wT\262\373\212\326P\316c\370"
+	.ascii	"\247\215 \003\021\200x\240\250\320,\277\031\243 \306\227\026"
+	.ascii	"\300\324\252\257\376\370_\003n-^\377E\250\302\242y9\024\304>"
+	.ascii	"\t\f\257\260\361\203\354\314|:\037\002\022W\263\236\277\260\347"
+	.ascii	"\240L\367\315\312\263I\333\331\302\270\020\211W\n\327i\0200i"
+	.ascii	"\t8&\005b\267\326&\206G\213\255(\255\266a>\0202\245\366\3078"
+	.ascii	"A\3603O\355{\375\301:H\001\276\321\250xL\224\324%\265D\345\224"
+	.ascii	"8vEo\274\233\205\016\320\237^\337\216\005\202-\365.\303+:p\004"
+	.ascii	"\007}\367\002\033\362c\020\200\2374\r\224\367\327\020\312wo="
+	.ascii	"zAy/\021\252\245\272h\300\354\356SS\334\266\251\324\323\177\034"
+	.ascii	"\304G\260\273\244\026t\276h\201\200\312\bd\361T\317A<W\037\320"
+	.ascii	"\321\274\221\370\216Q\371\304!M\034\226\340\rMHs\240f#\231\034"
+	.ascii	"\027\200\300\270\271\337\267\275(\253:\231\006\235R\303\b\364"
+	.ascii	"l\377\203\025\204\213\325\201D\017q\222\246\361+\242\243\n@\035"
+	.ascii	"Ghh\330\316\363]\267g*\2363\274z\325\006\344Aa\033\235\367\353"
+	.ascii	"\326{\226fy<c\206\237\236\320`\nP}d\306\201\377\025\224Dy\227"
+	.ascii	"g\213\201d\302#\2472\211\311i<\270\226\225\311\227\007<c\310"
+	.ascii	"\233\\ \213\306\252\005\n\330S\260\2701\f\276\237\310\304\005"
+	.ascii	"\034\n\331\2068\254\370S lt/i\300\353\325\334\372\370l\355\205"
+	.ascii	"\325\303\246\001"
+	.text
+	.section	.gnu.lto_.inline.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`53\375R"
+	.string	"\232H\230\017Dp\336M:\245\301cj\025\027\025\363\302\023\320\3415Z\2700\003S\020\037 \035b\226E\247ZF\372\240#\221\317<b,\273q3\261E\347\360/B \303\by\305\245F\321\231\376h\337\317\016\322\366\2262\005\332"
+	.string	"\340"
+	.string	"\371"
+	.string	"oy\334\360\330\251\243\226\3665W\3634GC\306\030\342\203\007\r\030,H\200\320 \001\321\201\323\031-\206\016P\035\217\307\322"
+	.ascii	"\256\266\3443\233&\233MD\372\363\027P\317\227/\352\367\265\\"
+	.ascii	"km\"ri^\363&\260\213\307\"\025\002?\177\376\310s\260\273\302"
+	.ascii	"\374\030\231\336N\375\372\263\267\367\226\367\363\376\274P},"
+	.ascii	"\036/\357\\\346\243k+\351}oT\267\311\201aSz\275\027\212\226\371"
+	.ascii	"\350\272\345\313{\203\035\346\247m\213\350\346\275\2272\021\244"
+	.ascii	"uuub\275\377\276\346C^C+\276qo\336\206\003\323\002sWi\377\314"
+	.ascii	"UcH_\323\370\321y\252\255l\034\031\243`H-w\357="
+	.string	":\363\337D\354\377<\372\267\260\357\275\227\374\253\356\275V\177\377\034\203\022\357\275F\277\3211<\bx\276\362\304\341\333\003;\355\215Z\261J\365\225\333\025\"\004v\377Q4w\325\036\022ESu\237ct\241AsY\f^\342\006\371GQ&YC\243\031\206\344\311\325\322I\234\317@(\344/\244=\030}\346X\204\323\373\b\266\374\372\237\177\315\0275W>_{ff\276g\323<\317\363y\231\231_\226\246i\232\246\311\314\227\353+\220\222\36193\022\335\336F\365\230\033\231\034I/_B\321\342\021\212\025\246\263\257\337R}uh8\246\364*l*WN\016A0\177]xa\304\006i!9\005\2527\205\024\217pJ\300\363\314\306{\315j\274\271\220\267\226\206\335\033'\341\246\231\005\017\2326GZsS|\360\316\f\325]A\300\fZz\367\223 +F\3761zH\022Bq\365-\351\177\037>{\364\300\005\b"
+	.ascii	"\234e\364\021!\206\332.\350M\335\377\371<Ok\255-\313\262l\346"
+	.ascii	"\337\2624\371\347\213\272\351k\r6\027\033\016!\274_{\301S\305"
+	.ascii	"\214\351\251\323\254i\261C\004\354\263\2654\271)_\203i]\255I"
+	.ascii	"\272\r6\237/c\361\300\315\247VR$\312\233\005R3g\242X\021\375"
+	.ascii	"xVc\302\214H\257i}\264\344"
+	.string	"\216n\351\264|\305Qx\223\005\354\n\3208\005m\310Enp\341\272\344\217\366\221\243e\256\301\022\2549*\366\026H\2010\301\241\346\350\345\2552T\273\t\320\260\206oJw\260\344!\362\315j\242\005F\340\366^_\253\231y\335\266A\001e\271y\243N\f\374\354\246\315Y\032\2633f\312t\341-mlkt\346\26093\273\230\b\020\0332\\\230\020\301\001\003\005\374\027\361\201\323\251\336Z\343\362\342\275\335\355Do\027\354\250\266N\315g8:\266%F7\321\365]\237h\377\177\"\256oQky\341\356]\376q\\\200\3745\215\323\263\024\375b\b\nW\357,\254-\317\016`\002j\007\260\013F\350\317\363\303\026\177\330\252\275\035\237\337\225\257\023\235SE\353\007\277B\265\23328X\265\307\034 \\\222\240\274\352\333|\233/\350X\031\332\220o\326{\323\211\216\225\301\201\353`cq\273B\034p\n\233\314\210\027\265"
+	.string	"0h\027;pR2$\375\251\f\307(\232\252\376\354\306k\004\315\221\331\363\024M\313\222\343\016;\251\260\242\004P\215\310\363\300nB\207Ud\367>\337@\036Z\271(r\303^\275\317Es7\017~j*\312t\\%F>5\r\336\235a\3202G\324\320a\272\n2\252\215)\354\311W\330uh7\210K@Z<\026\345 \t\233\354\313+\bRT\227V\344\016,\035\354k*\376;<\b\203<\250B\024\315\310H\211\210$I\222\016R\n\020\022&iRJ\n\371\022\200\262\034F\2434\315!c\b!DDDD\"\021\021\tDD\222\2649"
+	.string	"\364\"pu\004r\025\343\314q\236\002\341\265~\034\013\270Y\342\001/z\004\341,\320x"
+	.ascii	"F\341\016\222 \032\035F\254q\226g\035\231\025\3238\002\271$\001"
+	.ascii	"\217\317\243_{^(\326\234a\367\256\326\227\025\017\317\366'\365"
+	.ascii	"\356\203\201\267\236\030\377\0175^\252\b\030\020J\037\022\264"
+	.ascii	"\271%\004\265P)\251\027,{x\300FH\304\265\256\373\223[\037\307"
+	.ascii	"\211\275\374\357\310\310\360\203\r\262\030\322\236XX\r\366\027"
+	.ascii	"\rF\"\340\n\355S<\252\275\2555?\315)-F\003\335\200\315\226X]"
+	.ascii	"\272\021\365\362\2066x\264\312#d9}\302\353\340\215\027\245e\030"
+	.ascii	"5K\370\326\262\233`@\230\234\317$J\324,Z<q\b\n%\315\305]e\250"
+	.ascii	"\300\344Z\275&^\343\322\366\271\340\211\274B\016\2329v\023\025"
+	.ascii	"\251\207\340z\342L!\3554\340\373\222S\372\322\022\tbL\203zg:"
+	.ascii	"\211\362\332\244\373\311`\306\035w\365S\324\352\304\r\025\027"
+	.ascii	"\227O\002\021\212\355\325\r\030\367\367\323\250\231S\232I\320"
+	.ascii	"~\001\242\005!@Mk\342 \247\341\213\304S:4G\266\007\n$\311"
+	.string	"K\324\316\352O =\236\206\211CK\264\251\r\311\f8\243\320b\267\222(R\256\367PH \361\224\276u\313?\2441\007\307\240\356\353c\037`b^\330\341\023\035J\255\027\013?X!M\317\020wV\"\342\357\035V\253\343\231\366\022t\370\022\273t?.\253\270\022\315\267\327\224\350y\203\301z\341\374Z\300%T\231\360S\244\300\247\340<\272\261\336Cj\254F\263b#\335xXH\001\037\367\221\372\206\24220\321\366t+\260v\3316\307\275K\204f\262\276q\244\204M\346\346V\222\271p\237\f\266\335\311\037\304\207\277,\242>\016\344\365\204\335\213\366$\267kY\307\236\360i\247d\272G\275\024@\204\353\277K\375\036\243T\246,~Q\267Z2#\253\323\005\2225\0024xg\013\360\037?:td6z\375\276\270\343Y6'\210\341T\026l\211&\001p\2008[V2\362\2462\266\241\363\0025jk\307\261"
+	.string	")\375\363p\035\305\247\261\303\355\237<\316D\331\305H\356f\242j\3001\206|\331v\334\244G\275F\331\033\327\274\216\002z*a\232\301\342\337\224\214\316\270y\304\362\247q\263V\177FLA\267\270F9.\005{\"\220HA\216\250\202\2142 v6\312\231\331O\311\311B:8\206\t\004\245?{1xt\342;Ig\207B\246bj\031e\250\360\206\253\222\337(G:4a\307\302\224\"0K@G\347\315\242K\371y}\004"
+	.string	"\374\212Fj!\037E\250\177\024\3177\364|\247\350xMy\024_%\350\326K\336\265L\0031n\250\025\037\227\250\nkh\221\3601T9\023\"\247\375\223\336ea\361n#\363~\254\027\327\213\353\304\310\2360+{z>\365\207\217<H/6\030\003\027\"#\207\003\fc\336\306]M\235\365\326\372R 1K}\375\324e\t\324\206X\\\002\"\367B\275"
+	.string	"\205\354\326{\246\345htH\2030"
+	.ascii	"\034\016o\273\334=j0\205\300\260\213\t\316\261N|\277\255]j|\332"
+	.ascii	"\251y5\307\\-\231F<V7Q\013\250L\331y\f\261\037\321\345\336\305"
+	.ascii	"4=E[\317Bp\340\nY\363\036\037\n\226\210\270\021{6V\237v\344\206"
+	.ascii	"\352X9g\007\2608\343\t!c!\330\267i$G\265S\332\254)1\345\354\025"
+	.ascii	"\325#\r\007:\254\277e\"\364\306B\336\221\302Rr\n\364ZA"
+	.string	"\3175B[\205f\273\201e/:\240\n~ \267\027\263\0366)\330\341fC\t>Q\310\227k+\201T&\373\354W\200%\275\362x0\326\"-\207\237v\300<\204\202\246 \320\307\275\333\213FI\004\246\037\2761d\340\177W\366\271\026\363\t"
+	.string	"\344&\230\323\177\237\214\336T\013\367|\271\322\0313\230\216lB\341\251\263\350\205\271mX6U\r\357\377\272,\036\220-\004l\241\311\f\200\361\033U\242.\240\r\250N\266<\030Q\240w\343b'c\326\232\003\371\203\177\"[7)Y\006\264:nyM2\322\362N\005tE\206.\315\271\300E\302,\352\3447Z\267)\022y\247\022l\375\237\022\353I\243\2711/\025\371\255\204\214\265\376;\\D;\227\224\265\235\032\005A\214\327\0248_\315u\234w\3472\371\344\177t\037\275\235\0257\377Q\333\246\223N)\236\362 \3341\222\333|.F\315\377bw;r\326Dj\333\240W\303j\007W\235W\215x:\240%\214A{\236|\314A\256\216"
+	.ascii	"T\250>\244V\006\240\221\320~!\364\327\306,0\254\"\322\031\b\210"
+	.ascii	"\024\274\302\226X\2310\003I\2622\340L\216\267\037:\266\262/X"
+	.ascii	"\337\374g\2014\202K\253\205\tQwz\004G\271\2408\204257f\307\302"
+	.ascii	"3\326'\352\222e\247\261\215\365E\201\003R\215\225\376\3659\322"
+	.ascii	"\333\032)\277\220u\2775"
+	.string	"_\235\242\213x;|n\342FP\312\35606\323\257ZI\366\022\262\216\343y\026Ww\t$Y!\0048\006\030\003\017@#\240\221\300\031\363e~\021\233!\254b\356\335Y\006\337i\355\267\260\275\316\356\315E\205HOs~\335\371\373\016z\215\342\347\013\352Ao\377\376\371ysfT\3362\374:\237\324\361F\270f\375\363\022\bQY\207l\317\320/\346\037\306lJ@\352\320{\036\262\034\367 \225\213\374Y\272:\304\255\345a\345\275\021\262\317\363\344h\305\235Q7\r\374\027\032%k\n\216\200>\205\272\315gkZ\nsY\240\211\267\n\362\021z\321L\351\"\034f\317\204\304\311bq\022\311\304\344i\201\027\214u[f\236\362\264!\326\006X\314#\215u\3356x\033u\001\212\232\220\245\262\006\337\252\341\314\306p\332\t\324\242\340\035i\n($\242\034\210\273v\215\320\304/FX\357\033\337g\2230\f\316\233\247"
+	.ascii	"\315\366,\372M{\0048\247\344\315\003\340\262`4\006\221\260\244"
+	.ascii	"M\345\200\332\253l\254\245\027\027\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`oO\225<"
+	.string	"F\255\200?\340\330$\3518\fNe\006\013\260\022\021J\312\354\227k\004\343< MS\2102\220\003l\021\222s<B\214-\216\255\204\304u>\224\024\234\307-\300RV\320\232\202\034\247\377\245\331\335\b\331I\006a"
+	.string	"s"
+	.string	"p"
+	.ascii	"\036\317\2552\333\277\365\310\021a\336{\357\2567\220\317\031"
+	.ascii	"o\373\361\245qw\323\311o:\211W\304{&\373L\342\263\3764\025\361"
+	.ascii	"y\214..\323\214\231\267\312\221 \271U\366\273\336\273;\306$`"
+	.ascii	"G\330#7\350^\376\205\235\360\027\275\216\333o=\022[\207\254\324"
+	.ascii	"Y\351\266\216\261\0212\374\3024[\0137\001\267\277\344\t89\224"
+	.ascii	"\236(\005v\252\240:\224\023\225C\211\327L\rY\004\223\366\002"
+	.ascii	"F\223\201\223p\367b\327\373sr\276\377'72\376"
+	.string	"zc\013\0340M\253l4\250\021\207\026S\3622P\306n\345tN\322j\330h7<wJ>\255,\375\311\376I\274%w:\304\356\020\004*\216\211\304\004\023i8z\214\266\034m\007N\342i\261\365L\256\227\227)*\003\350<\240C\360\257\bV\306\026\007S$\305\001\335z\b\330i\352F\270F\270\026\374\353\301\357V)\032\277A\253\"\0219`\373\fV$b\327\303 3FQ PL\f\n\031\261\346P\036e\274\006\312\241l\337}\357i\271U:\022\211D\332\245\214\214\201E\016Jc\321\242\271\300\230\230[u\300\365\352\361\264\177\337\237|\311x\005\b\270\027\377$\006\235\340 \003\203\251m7L\241\215\206\235\337r\210t\267\022\371\255D~\300\225\263\2258ZF)\211/7Bw\343\331\371\177\302\220\316\245T.\307.EI@f\203\316\006\235\007\304}\\h+\334\2362\037\370g\024v\362F\246"
+	.string	"\267J,#\266\233H$\221H\244\333\211D\354Xe\021"
+	.string	""
+	.string	"\267I\342\225\206\"\353@<) \005W\262(\013\r\003\025q,G\2103n\002\202\204\250\242\354\212\315\210\210$I\222\345\362\t\020\204\242\231\034h%[\017\022@\320(\204a)\222\243(\006\202 \bB\220!\204\030c\0203\304\030#$C\244q\016\340B\206\3643O~\177\351\026\023D$r\304\270\233\371\221\351\024`\016\253f\022\006\326\207\302\360\301\257{]>@~T0d\327\3548P4\n\200>\317\212\367N\244\266^\017\341bw\240\322\242\355"
+	.string	"\356\342\242\203\214\026q\240g\031\225L\302\022\224\025\313\275\203l\027\035e!B8\223~d\217\331\336\n\3664\036i\2744fC\223\224g\033\350\206\327\215BA\337\340\037\325J\001\016>\322\003\206\013}\236\363e\316^C\213\367;t\237\025\027f\005\372/\3537\251\247j\351-@^\245\224\"\235[\245\323x\265\346\"D\032kB\375C\264.\022I\227\232\266\300\362\231\300\264N\242\351@_\323&\353(\244\007<\300:\3363\004i@::\265\341v\332\025M\2412\247\345\310Ijkv'\001\034\375"
+	.ascii	"<\342\212\340\331\0340H|\246O\2054\345\206PF\217)+j\355BTi\002"
+	.ascii	"\271\320\246\305,{g\257\220B\244k/J\212\305\2142\343\215\310"
+	.ascii	"\341H\270\373Q\252\006!\312i\241\276\321\344\366\031\226n\350"
+	.ascii	":\206+'\202m\241,\355%\367\363S\236\337\340\224\246\305X[\001"
+	.ascii	"\252}\"\204\n\2700\363\371\024\241\302\027\\:\230\021\355\002"
+	.ascii	"\024$\305\0166\263\260\214\253mL\264\002O\274\313\253\024\007"
+	.ascii	"V\345Y\312\340\023F\033\316\337\356\211\035\naI`\263\003E\f\343"
+	.ascii	"{\304\220{d/K}\371\3634\022\202\n\312\002\314\254\202Q\303\243"
+	.ascii	"+'\225\261)\213\332\254'\325f\331\330\334zdP\231%JO\263\3714"
+	.ascii	"Qi\342\265I{\202q\037\021\230\262\267\037\347a\020\251\231M3"
+	.ascii	"\007\017\003\034\224\024\316E\004\025\031\204\236H|Ar\244\001"
+	.ascii	"y\314~\332\t\210g\242\333P\360\310\377N\320\016\210\262\017\331"
+	.ascii	"Cb\242\b\272K\", \335I\276+ P\252\201+\214\026\314\270\001\221"
+	.ascii	"\320\373z\203\310\201\313\024\371\032\036AD\363\302\302\335\005"
+	.ascii	"K\325\2024\022\236\001=$\344\340\277\217E\273\036\246\013\267"
+	.ascii	"\210Y~-\3324)|\267\3401\303\004\210\304\361:\246\311K\321;\274"
+	.ascii	"\257\372d\260\311m\032\211I\236C?4\346IM\242HOI5\b\026\257\357"
+	.ascii	"\207\345\317L\244\305g\026\354k\325J&~\005*\030aW\203\242\257"
+	.ascii	"\304\026n"
+	.string	"B|\t\0040\0213\254\342M\201_\216\364\323\3069\343s\230\373\227+O\301\323x\3421\204D\220\004\236X\024\354\364\273F\024\212u\020\360\311\241>\341\025V\261\370\340\322&\\\217Z\005\275@\271\\\016tC\200j\331\037\311']\226\335\230\025u\235\340\3103\347%/\203pR\026\242\020N\207\200\031n_\307\372\356\223n\324y\035?\216\215\002\203\360c\221\205\032\220\322g\342\235\371q)<9\250\t\242\024\2111\262\263g\f\340\270\3625\225\267\217;Je\370\f\032\372\325+i5 \253\306\232\347\335\t\324\234\335\356\251ee\361\002\260I\035O\300\021\312\221\332\364\267\t@M!\316t\232\254\2331\270)\005\276:Z/\317\354\223{h*\030\370r\233\2758\\;\034\351\364nX\225\216\356\265\200^\2569\\\024%ac\f\025\2042Ft\330\334t4Y\370\020?\224g\237\337\311\365\301v\266?lJ"
+	.string	"\256\373\245\034QC\033s0\317\343nBY/\350\207Fi\303h\2675\"$\240\371_.\201\233R:\343V\254\032x\366\360\325\261\264+\222\307\277~\372\363\333qB\bYT\376k\301\354\364\026\316}X\304\031\345\262\362\t@z-\300\331\030\262\365\213\027k\025\235\002\235\215\241["
+	.string	"H\007\227h\020\037_m<Z\350\363]\301\373"
+	.string	"|\031\270\277\357\371\177r'\366t\334|\237\002)!\301G\230\231=\200D_\224@@\231\236\330\347/\032\200\035\224\321\013@\"\376\235 \n/\376\236o]\r\234\271\035."
+	.ascii	"\013\223\002]\260\331\323 \020\314f\361\\P\345\331\343\242\311"
+	.ascii	"\024\t\f\024\366\230}\227\331\305\345\003U\325i\005\345\220\303"
+	.ascii	"\006\017\240\257\352\370\352\225\244:\260\334\334\234S\367b\202"
+	.ascii	"E\261\345|\354\362J\034$\303!S\206\212\b{\027B\376\0073t\205"
+	.ascii	"T1~\024\354?\217i\315\360\232\207\226\336\023\305|\035\026\274"
+	.ascii	"\253 \255m\244\223\237&\025\357\027]@>l(\\(\377?\354tZ\235Y\247"
+	.ascii	"%\207a\214&:z\020\312K\272y<\2562p\231(\206\266\201k\260\321"
+	.ascii	"e\375\323\004\013\353Q\324 g\243!\004\035\204\032\375L+\356\314"
+	.ascii	"&\221\306\t\030xG\333\017\024\t\bD\350\311\230\020<\021Y#\222"
+	.ascii	"\314\312\376\272\305\005J\026\262\260\276_\234Y\330j\003\324"
+	.ascii	"\325\341\242\253\340\231b\236>\026\321\366'z\357\222\214\007"
+	.ascii	"\211\037\237\rB-\211\301\026\245\212\370\354B\262z\226\350H\\"
+	.ascii	"\271@\222\020\202 \213\020\320\303\342\f\003\213'\\\022\3023"
+	.ascii	"\270\360\314\335\217\374\263%Zy(\277\227\020\324\001\214\373"
+	.ascii	"SB\220\277\252+|#\377\017\005\344\307K,m;\262\307i\3744i\237"
+	.ascii	"\236Ft\213\345\344\360\224\373{Q-d`a3\250\266D\273Z\240\326M"
+	.ascii	"n\017"
+	.text
+	.section	.gnu.lto_.pureconst.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\001\230\004\002\231\004\025\271\004B\270\004D\231\004"
+	.ascii	"G\232\004H\230\004I\232\004N\232\004O\230\004Q\232\004R\232\004"
+	.ascii	"U\231\004V\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\235\007"
+	.string	"\342\213%,`-L:@S\206a\030\030\323\310\2007"
+	.string	"\022\321\323\316\264Gw\310\023$}\324\256[|\177\310\310\300\002\365\344)\230\356\326\210\224)\023<\020\005\313\016\377\r\337\206\344\177y\0048\021\331\360\230\214tX\307\326\3101\333\266\306\233\344\220FS\302\360u\225\013\317\f+\202\252rVU\024\205\004\346\343\031\302\007\245\301\357t`v\323\235s'\205\334\335ubt>\\P\345\244&\213NJe\363:+\312):\241\362\211\316\250\\\2423\242"
+	.string	"\177\237u\0360\363\004\t+ \240\002)3;\\U@:@Q\201\006\262\250\034\344\034\031\255\332\2361\303n$\327\276lgc@\3462\347\334\332\311D\026\242\243c!\216\334N\n\247(\370U\334\b\273\007\263\"\227\205L\262"
+	.string	"\332\241\366\032\210\254\211\002\267"
+	.string	"\364q5&\032\274\211"
+	.ascii	"\026Jp\005\017\240\b"
+	.text
+	.section	.gnu.lto_.lto.cecdcad914df8b5f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mspDescriptorAlloc.172.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"U\007"
+	.string	"\002\31614pM\322\001\240_\377\f\030^\310<B\230L\210j5\277\273\022\260\325\312\271\265\206\214wM($\246\336\253\252(z\314\276\004\306\323\217\203o\032\331[\312\224\002\326d\252k\202\3255A\206\205\204\tj\254\013f.\246*\005\0136P\224\005%m\357V?VLG=N\005yL1\3705\365\017\024\236\177\\\263\211\217a\007o\371\370\347{\213\376\256"
+	.string	"\023\235\f\331\032'\325\302\276[\375\330\231\316L\377\tl(\007\"\273\021\241\225=y%\031\2667\266\344s\274cc\314i\027Y"
+	.string	"\250\002\"Dew!\346\227\350\317} \372S\320\261'\346\337\343Nc\203$f\234\247\005aw\2351\223\270\365\266\013l\023\330\036\t\f"
+	.ascii	"%\013\335\264\030\t\023\f\002\246\2248\251\270\263\250\365\\"
+	.ascii	"\310\217\303\\\026\214\f\327\212I\230d"
+	.text
+	.section	.gnu.lto_mspFindPassthroughSerialPort.179.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`\211\003%\031"
+	.string	"V\357\242H\300\226M:\243\334c\333\3717\353?\375\200\002(\202\200H\311\362\"s\372\"h\032cR/\271\302yu\275\275\265\215m_\300\016*\203eP\242\3026E\311\177jGNUX^\271\017\3772\204f\033!\204l\"eJ\001\223"
+	.string	"\177"
+	.string	"\221"
+	.ascii	"8\263~\363\360\t\202D(b\306\304\311\234\242\202K\303\200\227"
+	.ascii	">\215'\361"
+	.string	"\3705@\\\361\303\312\0215c\232\232SlY\374\213w\t\276\305\273\334\242\277\036\202\237'\273\325\227\237\244\003\212V\203=<\240\342\347\304\301\307N\374\353\302\033NQ24\220L\034\367\003H$\202\324\003\272\354\002 \231\372\001\2406\353Z(fG_\272\372\324>hw\334\021\224\310\331\200j\252\001}e=\336\213\321\023\213Um\266\372\315\3149\255\264\332\317\275\272\355\"\333\r\354\025\ns&ud?\207m\251_\310RJ\233\t\f\310\264\312\376\2153i\360[\030\307\245\247]\372.\357\362\373 \nUPLG[\204\351\332\354\3578\216R\274D\266\325.-,W\272W\254f\375v\257\244:\374\324\240\247\376<\265\327\251\245Tw\235z;\365\005\300\310\020BQ\264d\241\3049b\314\315#2\310\213+\375\267\253}\373\242\277\244\324\241\233A\342\3749\020NI\322T\fxy\233\307\017;Cv\204\017\221"
+	.string	"\316)\223\361\237,L"
+	.string	"[\\\206\313 \306Hu\213\351\350*PnFrm\356\340\255,\201\024Tl,\221\351\024\263(\270v\005\032=m\345[p=&o\027\374\333\203\310\365\350h\271^\020\271_z\007\343I\025\025\217\253\017)\235\001h\267v\215\215\236\326\262\006d\013\363n\267\237U\305t\364q\263+\205\344f\\\307W\214\034\201i\225\033=\031=\355\332z\370NUT\216\346\320\016\277\311R\340\234\260\013\275\312\013x\227VZ67\0306\270\034\254jlhv p\320q\345\204\276\020\223\263\203\323\332pC\203\323\272\240\263\323\212y\261+\247F\247\305\301\345\322i\261\304\371n.\221\365\363_\236\202.\313Z\037\333,Yc(\266=\356\2729\347\f\327\346\007/\362\002\347\2342>\221\f\020`\224\270\354qW\220\004\307\214\347\220\\\204"
+	.ascii	"\327\206\343\236\371\265\307\t\310\223om>\356\241\214Q\304\266"
+	.ascii	"\204I\306*\311\262\253\365\361\340\255\226\002Q\f\363\f\301\212"
+	.ascii	"\2328\231\342Lp\334gtES\324\364B\226\r? `\2021bx\036\215Po\214"
+	.ascii	"\t\342\211 \356\303\202=\222G\204\276h\\\036\327\252\311O\326"
+	.ascii	"u\013'\246\326 \332\026\314\335\200\030Vh\016\316c?i\237\257"
+	.ascii	"t7\371'\261\261\313\246\326\267J\234\252\21517 \331\003\220\023"
+	.ascii	"Z\034Y\036\264\232\260\n\304r\"\274\027\327\224\336\357\314\332"
+	.ascii	"x\3340\271\270P\022\322\205\"\334\242\350Z\330\276\021f8\301"
+	.ascii	"l\341\230\213\0202\305\003\023z\224\306\374\027\3336\330\240"
+	.ascii	"\b\346TH\221\037\244\020~\221k|\273\017\231uY \003"
+	.text
+	.section	.gnu.lto_mspSerialPassthroughFn.180.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"\235\f"
+	.string	"\346\030XB\020\2176\035 4#)M\315(\200]\214/\367\017p\313\tD\276\240\277]\356\024\363W\253\022EtL\367\323s\r\201;9T@o"
+	.string	"\030\241\021\030\001\342\r\330D"
+	.string	"\200\rz\007\242Q\243M\244L)E"
+	.string	"B"
+	.string	"C"
+	.string	"\231\351\260\372\200\351\320\233\r\343\321d)\020\236\356\004\313\356Z\372\341\333%\315\315\277\350\030\357\323\271\264\341*\025\370X\310"
+	.string	"\360!\2212\236\020\336E\317\f\037.\223R\260\273N\357\243\341\206\267\275\300v\002\373\r\002\2177\225i\315tf\372\032\007\215Xb0H\261\353y\231\261*0E\304\343o\377\"o\330\216\234/\206\022\214\367\242\303\267\033\r\034\332\252\236\366K\334\304\366\023\316\005\354\206VF\273\361\200\tT\207\216\017*\335M\\\276\221\332\302\244\352"
+	.string	"e\205$]\234zU}\307\341(\2574UW\370\234\211\322+\002\025.\272\026\\\276\030\246M\241B\336\2434G\200JZ>N;v\354\244z\260/\355\356ZC\366O\376*\032vy\204<\230pa!Z\226i6\0014\354\362\200\240\021\301@2\r\177tl\262\021+\202\210f\304\372\3002\253#\343k\003\202Y\332ua\326F\334K\253!C\320\250\345\273\240\234\204\311\243\270\177M\225RjK\310\362\2369RH\004\022"
+	.ascii	"\357b\314\3043\243p\b\206\370x+|\252\rp8\306\nF\263L\346:\241"
+	.ascii	"\211\313\273fs\341nF\021\313SW\304\265<\225\220S\n\265\007"
+	.text
+	.section	.gnu.lto_mspFcSetPassthroughCommand.181.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`^\003\205\030"
+	.string	"&k\235K\260\324Q:\352\240y\216\327\2610\311u\222\273^a\"\234+6\370\307Qq\276C\001\022\027\035\366\310D\220\276\355s\305_\030p\341\026\232J/^\031x\201\361\241d\003\377\216\305\206\337\271{\244\376g\177(\327\276\355\023\262\345N2\213"
+	.string	"|"
+	.string	"\211"
+	.string	"\265\362$\357\230\205\234\350t[!\224~^\034\271\367\336\032\304w\227\305`/W\253$m\327\035\377\205\006\317\313b\260\027\337\302$\364\360W\013\223\320\350.[3\232adg|\2348\272\t`Qm\331\230\220\020\037\347\001<\262\006\202\004\217~jiY\222tt\210\0059\330\227\252\017A\316\003\210T\311\241[Xp\350mmAP\250I\320g\t\034k\\\275\370\n\024\354\325\332Bp\357\345\212\006\205g"
+	.ascii	"gf\031\314|\200\271\027\004=d\231\277W\206\"\212?|\025\t\277"
+	.ascii	"*\254\231s\031\352\321w%1\004\304:\372\372d&\236\265\207\314"
+	.ascii	"\267\267\233\230\337\342W9\213?\245\254L++\317N\374ade\322V\266"
+	.ascii	"\266r\333\312\265+\237\345Q\307#C\024\304\2707(Ur\215\244\215"
+	.ascii	"\022\314\374\0303\327\026>+(\327W,1C\314\202ye\276\212\257\330"
+	.ascii	"\235\305\206\317\356m\262\232\272\227X\200]\\'\231x[y\322\365"
+	.ascii	"C\326P\222\255+\002\251Uf\n\025\352Q\262Ml$1\366\372d\227\323"
+	.ascii	"\005\336{chW\306\263f\275\206\221\252\245\362fI\353\027o\213"
+	.ascii	"T'i\272\244w\263\2345\255\313\244^M\331\366\254\271\376,\231"
+	.ascii	"\262\r\201*E\021\257\246d\323\260`_t\277\bw\324\226\352\036("
+	.ascii	"\221\023\234M=Z[\200\220\312\350\353\363NH\216S\266\207\351o"
+	.ascii	"J>\214\307\270\341\217`\234\234z4\247<\331r\201\003E\021^Mk\216"
+	.ascii	"_PT\007;\tL\323"
+	.string	"\006\227\323\325\364\230\271\032\036S\007\005\2473\273\307\304\320\214\243\3411un;8\027tn8\235y\243\261q\216\307Fw\353\311\345t\267\030\361\336\336nb\tJF^\367d2\034H\306\337\322\215\261E\021\261\216g\315\202B\223\252b25\"\343\317E\352\004\020,@\235yJ33hP\217\262\311\r!\343\257\317W\017\037D\030`u/\357(?\207\203\t)V#N$\225\242D\274\2322\326S\212+\327}J\225\206\031&!\361\0045\324\352C\250q8\203\214S\304\231\031\t&\310H\013\232\003\220\002\0212\354\006\021p\27562\245\205J\007\2176\206\366\350D\204\373ybPU\315\257\n\277u\b\233\233H\224\357\245\357\322\037&\314E\225\226\215\344I8h@d\212\205\374\310\n\031\r\035\003e\201\366k\036#\020\337\222-@\246Ke\322\311\353d\344\243(\030\203\325\317E\267\315O\262Y|r"
+	.ascii	"K\337\273\370g\347\004M}\222\006[\002`\224\201\235h\016\r\314"
+	.ascii	"\266\031w \222;\355Y\237\300\206\236\0355>\250\006"
+	.text
+	.section	.gnu.lto_mspRebootFn.183.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`\254\0015\017"
+	.string	"\366\032bE"
+	.string	"\223\223\016/\251\206\324 \223\233\247\016\244\202O{\323PV\372;?68\251W\252\246\315\237\340\2747\376\254\375[\\\004\217\360D\025P\306\257~U\337\245\371.\235\005\363\326u\200\211\245_\261\022\262\333n\231RP"
+	.string	"K"
+	.string	"M"
+	.string	"\213\311\314`\300q\355\356\026c\214\251\3503\303\244'\252\310\327\200\334\354P\201\243O\006-\317@\260\270\034\313Z.\035\314\370@\323=G\035\201)\007\251\207\n4=\226HS\033ACF\004\274\020\025#\331]\353\007\262\334"
+	.ascii	"n{\203\355\217}\036\001\024*\350?k4\273\323\"\305\221\035\216"
+	.ascii	"4\302\330\307^\304\204p<\331\252\376<*t\371h\240\263\313\341"
+	.ascii	"\025dWR\006\211\021\333W\3735\267\021\035\205\205\017\330=\301"
+	.ascii	"\210\261\033.p\202\354\322\341\265y\231\235\300\274\264\310f"
+	.ascii	"=\024\021/\360c5R!\232\242\321\021U\276\213[\277\325\200*\261"
+	.ascii	"\037V\370,\314\312n`^f%{\303F\315\t\3738\266Y\233\211\027\017"
+	.ascii	"\273\243\277\350\267\n\016\224t\210\375\024\277\341\374\031O"
+	.ascii	"\360\364\337\245\357\315\313G\211\243\203\313\212\276,\325\016"
+	.ascii	"*\035W\022\301\004\324\241x\">\371\244x\241M\002\310$\264\235"
+	.ascii	"t\336\366\321\314\245\240t\233\n\307u\333H\270\217'\324\245M"
+	.ascii	"\313\325Z\211$?u\223\314\b\343\314\203\305\323\177\231A'%-@\375"
+	.ascii	"\007\323\006A\250\001\256J-\2569/O(@\316\316\352*\002) \220\202"
+	.ascii	")\321y\377b\204\321\270N\310\006\300\317\223\311\334\026e\271"
+	.ascii	"\236\245\345\023\342\016\324q3\354\307\244\355<e\235D\223\216"
+	.ascii	"\220.\220\304\255\2377\233\350\320\253m\242\216e\353\305l\230"
+	.ascii	"\003\r\266\353\367\0134\217e\264\233a\365<\031\020\231\360\320"
+	.ascii	"\005\206\3743\336\355\343X\347\0322"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.184.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\005\b"
+	.string	"\362\01655@o\323\001[\340\227\373w\242 \233\365\002\315\250\321\377\207\213\327\373\316\005\326h\310\315\302juc\340\360\350GQ \\c\203\376[\214\316\022\273\277\337\215H\231R\037\214A\315\331x\260N|pX\350D\316\205\305\215\306\226\247\341\212\037\313\272b\306\333O\253\234\023L\276\n\2650\314\217\274\004\246\017Qa\021#\221@7\245\301Sm\211\211\374\346<\t}\027\252\331\236\226\272a\177\332\335\265r\366\273?\341Q@H+\n\245\335\214\022\313~\324\350#c\373i?\344\241\354\035\305\001v\271\024\321\256w`\002x\312\3365\325)\370\200\352\2243[\345^\307^<Z0HH\273\033\225\343\3313\363/r\314\006\322\236\027\204\335un \215[o{\300v\201}\030\021"
+	.ascii	"\357b\310\304c\240\321\342\302\353\234\200\273D\350\002\026\002"
+	.ascii	"\201\001Z\340L\\\316;\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.185.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\345\007"
+	.string	"\262\21644`O3\006T*\013EJ\023l\201<\226n\347\342\247\357\371\202\353\234\316f\020\374:\326#\330\310]l{"
+	.string	"\300"
+	.string	"\035\250\237(\337\312\245\253~w\367\2262\245\"\255!\326\323\ti\037\tz`\370HO\246\311\016\247X\310!\223\"\f\313\344f\336\323\243\327\005\222\257\"Z\214\030\305\"\027\254!*-\202 d\202\b\206\261\225\230\200\356\032\300\262\361]D\256\235\034\214\034\255\247\377o\364Z\223lh9f\226`@3\177F\r\315?j\005d\323\326\260u\211M6\223(,\360{-*\377L\250\301e\252\323\234\312\324\345\201\312T\267\366\305\323\343\326\207\013FJ\351\277\214\035\336\f\267\332'\006\350F\234\241\245\360\277\260\033i\270\321m\013\332\036\264\225\t\020"
+	.ascii	"\357b\310\304\303\277h\270`\301d9\235\003Q\350\224\002\002\343"
+	.ascii	"\f\\\316;\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_mspCommonProcessOutCommand.186.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`g&\305\227"
+	.string	"\332\361d4G\020HLg8\300ZWi\256\3107\006@\341Z\337:\007\332\357\037\302\2710\371-Me"
+	.string	"\277\237\304\376o\304\356\315\273n\354?\244~\315\""
+	.string	"D\263\bD\321* \022Fy\221\227\331\177\022\"\313@\221\354-e\222\001$\003\350\002G\003["
+	.string	"\221\227\200\346\265A\344\225b\342\255\321\2744\220xg\224\340\215j\336\001\210\274\002,\361\312h\336"
+	.string	"\210\274"
+	.ascii	"4o\214\346\205\321\274/\210\274.\224x[4/T\363\262h\336\025D^"
+	.ascii	"\025$x\237H\360\246 \301\213by\235\226\267\251yO\020yM4/\023"
+	.ascii	"\022o\211\346]j^\242\022\257R\022oR\363\"!\361\036\035\361\222"
+	.ascii	"h\336\021H\274FG\274E\315Kt\304;l\336!$^\341\021oJ\202\027m\336"
+	.ascii	"^^f$\213\346\261\357\207\266f\337\221[\235<\007\255\314\224\315"
+	.ascii	"\226\367\371\001\377\346\237\347\277\363\327\371\373\376\275"
+	.ascii	"?\357\307\373\331\374n~8'\261\373\r,{j\312\001r@\373'hM\345\356"
+	.ascii	"\377\354\032\371Q.\357\370<\345\311\331\343\334\273\241\345\001"
+	.ascii	"\356\211x\340\032\351y\263\370\276*\"\3472\013s\304\227\204Z"
+	.ascii	"\362\354\377\226:\340Y\243\274*\313)N\277!\366ihu\3123\367B\334"
+	.ascii	"\316\032\365\t\371\212\\?\346\\&q\256\253\330\f\303\247u\254"
+	.ascii	"\276\202\2552xY\3020\334\333\363}%[\237\344\n\230\247S"
+	.string	"//N\215\\\2219k\204\267o\302\310\255Xm\376\346q\326h\017\307\n\212KnuR\304\206f\227\302\256\033\254\244U\210\365b\203\276 \235#\f\237\252\371\232\342\331\024\201\362\222[\307\212\312ha\276E=\335\251\341S(\364KB4wA\344\331I{3\363\262\263@\301\327\335N\353tK\264fO0\355m]W#\255]\243\247G\273\305]\243\335M\1770\322\224\264z\225YJ\241r'S\274\0170\\i]\253<\325\254\253\034\215\215\032>]\271a\363\356\337>\246x8$\233\256\353\032\237\232u]i,\214\341\323\2443\t\237\362\227\204O\013@\240\270\306\246/\256=6\332\364\204\315\t\256\253\234T[\331=\013\247?\377|Z\364\250\334W)5\036\306\013\027-\240X\254P\361\224\002\205S\323\t\023L%\226\210JIHG$F\030\025\021\r\207\204)\3321\330\270\347:\fAg5\277\027*"
+	.string	"\271\240\303\247E\240\347`\233\223\006\n\n\216Y\304}\205\237\017\373,\357\366P!\213\273\212?1\374\364\366\024CS\177\317\301f\306\356m\220\n\331\333Q\240C_Nx\270\021\310\311\346|<\260\323\362ME_wH\261A*d\312\237\330\202B\371)\331\004\337Q0\3176*d\3133\245\370S\246\204\030\300%1g\210\350\b\277.R\216\306\276P\003\314\202\360\373\234+\254\224\003\231\016OZ\")\001\217\206\246X\312\363\330Gb\312GLAc\243\263\027\271\211\235\t!&\205\211ZP!3\373P\b13\024*\316[\270\211\225\361\320\013\2632\302w\005\361\264\313\332 \307\240\034\375\334Q\267\262\347\361\216\2311(o\326\3411\356\260h\t\263\203\332\0313c\354\262"
+	.string	"\221\026\006\346U4v\024v]\023\264S\021\013\202\310CS\353\272.#\307\310\276"
+	.string	"|\267\255v\027n\367\205\215\3063g\263\340\037\024\346\221\250\321\206\0326\321\260S\271;\204\230^C\302\036\352\247-\354\337\205\025\"\200Q5#\016|d\332P^\315\265\313ulgdC\257e\215I\244\321Jo\231\025\032,{\342n\250\265\273\205ljq\302\nu\361\223\250\223GhJ\347p\215B\356\2542\177^\034h\243x\327\230\305\270\003\037\311}D7F\315\240\363\030\365c\216\fc\233\261\213\232\026\313r\306/\f\307qF0{-O\327\2704\212\341#\237\016}\365\b\343|\350\247d\202\205}\247\206~\244\321\370\201\306\3123\346\227\327\231\256MnP\330\311w_\035\223:i\013F\351\030\2141.\006(^\300\216\224`\b\366\263"
+	.ascii	"\236\342\250\300\317\006&Xs-s]\206\337\030\023\3357\302@3z\b"
+	.ascii	">q\324.\006\032\360\221{\273>@\314\257\346\332\027\372\347\236"
+	.ascii	"CmM\320\311\305\204\272\223<|\247\270\230\320\376O\312=\314\030"
+	.ascii	"\235\\\336\262\314e\233)\322\310)\244ey\207\257\205\301\363\246"
+	.ascii	"\324a\031K\027\23049,[\341:\343\302\266\\\345k\234\334\3322\016"
+	.ascii	"M\245\340\224\34547|j\336\224,e\371l\331\210\261\343\262\256"
+	.ascii	"EY.\273\261\204\343\262\256=Y\206\"\003\r\363M\271\256\215-\223"
+	.ascii	"m\363zD\300h\262\354d\233\327\303%\r\r\212\225,/I\225vo\312\032"
+	.ascii	"\226\223l\323\351\256\f\375Z\006\353%\334\265|\344\257\255]j"
+	.ascii	"\340\262\256-\257\333\034\376H\204O\377\325N\324\274\t@hw\233"
+	.ascii	"/\304LC[W\256\2475\031\271\n\360\364L\372s\377\225\276\"\234"
+	.ascii	"\244\255Y\270\320\256\334\361\350\332\311\335\243kW\331}\366"
+	.ascii	"\271\233\357\235zt\316(\277\274\316\367nM\274o{\336\367\\\266"
+	.ascii	"h\301r\300\357\255\344\360;\337'\325\234x_Fv\037\376\2135\357"
+	.ascii	"\233\034\356?\223\345}\330\373|\017\366<\337\177}\357{\257\343"
+	.ascii	"}\177\354:\233\357\271\016\347\373\265y\215D^\265y\213D^\032"
+	.ascii	"\232\027\t\221w\206\346\225\301\2117\206\346\205\241y\2174\361"
+	.ascii	"\032i\336-\"\257V\363f5o\221\346%\322\274XD\336\253\346\265j"
+	.ascii	"\336!\315+\244y_ \362V5o\220\346\005\322\274?\232\227\212\310"
+	.ascii	"\353\243y{\020y]h^\036D\336\026\226xYh\336\025\210\274*,\361"
+	.ascii	"\246\320\274(\020yOX\3425\241yK@\342%\241yG@\342\025\241yC@\342"
+	.ascii	"\335\321\274  \361~\320\274:\232\327\203\346\355\240y9h\336\r"
+	.ascii	"\232W\203\346\315\240y1h\336\013N\360Z\320\2749\232\267\202\346"
+	.ascii	"\245\240yq4\357\004D^\t\232"
+	.string	"w\312\004o\004\315\013\001\221\367\201\346u\240y\033`\342e\240y\027h\336\033\315\253@\363&\320\274\b4\357\001\315k@s\367;O\271\341\312\2252}{E8\232\202F\t\201\2059N\3208\332i\016,M\202\236\240\237\344v$\350\357\241\325MMu\333\001\206\025\232\201?\304\355\250L\206\310\b\234\250cn\035A\017\261\331\361\375\351.\352\023\201+\353\352uc\273\255\335T\033P(j\224(n};G\347\240\315-\357G\266D\317D'\233\207\336\242>\315\3243\341\231\360\351\271\364\365\216\2629#\264,\243r\031\201{\230 x\240!x\240[N \236\0035\332\201\376\234\bB\006\272F\0215\225\201F\345\004\2769#\310\351A\377L\017\225%\271\006\355A\rW\2405\350\233Q\240Qf`\\\023AL\026\375&\0254\213\003\272\202\276\335\001\215\342\t\034\303<^/F_o}\001\035\203\200.\200"
+	.string	"16\244\332\006[\257\251\311\264VS\255\350\240f\311\"|*\325\367r\246\247g4\215\252-j\033\0379\243S<\201]\230\307+g\272A\347\240\263DT\1775W\2276S\277t\224.S\301\250KU\215J\275\234\355-\341\304\276SK\201WNn\376j\217\365\274\251\307\374\312B\207\330\311%\222\222t\262N\261\304\210R\262\312\377H\324\374\233\240)\363\224f\374\307>Y\023\331\302\324\201\245\035y"
+	.ascii	"\001z\200\276\036\031-@_\260\305\220\334\330n"
+	.string	"\322N\3241q*\0312\302\2472\372s\236\226\235\271\031d\323\305\317\336=}t\203\222dp"
+	.string	""
+	.string	"t"
+	.string	"e"
+	.ascii	"X~\3412\350\354\343\255\372_z\250L]\327 mu\030\035\244\217f\016"
+	.ascii	"F\243\314&\230\027.\372E\377\256\316E\267\234\346\027\346\361"
+	.ascii	"9\364\022:>b\203\316#\375\034\272\250\210\250g\365\221?\375\204"
+	.ascii	"\352\254~\020G\303hQ\263&\214\016\2053\352\035\037\t\325(\236"
+	.ascii	"f\027\346\361FwY#\366\215.*bE\023{\031\254\217\212^\321\250^"
+	.ascii	"X\241\022\326\250m\370H\025\235\342i\2661\217j\227\321TC\032"
+	.ascii	"z\032\364\346\251S\320\231\rS\b\306I\321)\346\360Z\260\021\212"
+	.ascii	">*\236\321\212\020E\027p6\267,c\344\23360\271\230\320Q'\237\244"
+	.ascii	"\243\2637\342\317^\324\250\253\225\254\220?B\362@\340w\265\252"
+	.ascii	"\247\362\001\256!\321\311?\033E\263L_\335\223#?Gtrc\320\321i"
+	.ascii	"R\364\027\0212\201\341\241!\332\027\021\236\313\311\003\336\253"
+	.ascii	"}\302e@u\b\033\374\247\336\311\243\002\362\221\252\0365\220\217"
+	.ascii	"tZ\032\025u\225\345\265.\315\2604\303\225\253\322\005\210\260"
+	.ascii	"4C{+\341\327V\302?\274I\335\323\324w\002\2521\217'\332D\237\340"
+	.ascii	"\303}\252\237\341\272\256\t,\327a!T@\352\240*\210UA\302\247&"
+	.ascii	"Z\225\302\267d*\321L\273*!\336S\237\303u\365J`9\217\365\214\\"
+	.ascii	"b\204OK\364\271H\321\033\204[j\321K\3758W\272SA\250\324-z9\254"
+	.ascii	"\354\310\317\205\340\313\030\306G*\355\201J2`\255\001%F&|dR7"
+	.ascii	"\363\257M\0377\244\243F\"\321G}H\2649\351\323l\367\247\246\300"
+	.ascii	"\305l0By\241\214\3715\302\250G\024\265\321\235E\335j\376\242"
+	.ascii	"\034`\026\033\244\006\025\020\036[C\260\216Hieai]Qi\251\330\r"
+	.ascii	"r\2040A\272Ajh\005\331\342a%u\205ee\205\325\003E\026\325\026"
+	.ascii	"\225U\352\243\212\267\256\214`\365H\253\256EU\265U5\244\312\005"
+	.ascii	"\036Dx\340\330\242\002\222\305c\213Hed\b\217#\251\226\025\325"
+	.ascii	"\020\027\260\262t\\aUm\361\3102\002\244\352\307\025V\017\246"
+	.ascii	"\253\034ZZT=\260\262tlia\351 \242e\225\264\245\345\243u\354\340"
+	.ascii	"\300\207U\017\341\366\250AD\313J\352\252\212\207\225T\217,-\251"
+	.ascii	"\032L\213E\204*Kj\013\013+K\312H\256\353]e\207\304\321\251K\223"
+	.ascii	"\376F\341\347>\034\024\207W\227\206\371\207?\254\225\2045\367"
+	.ascii	"q?\350;\325\317\347\223\f\214N.\222'\202\376%uq\344\320.\003"
+	.ascii	"\220\037\346\213\021uf\227\001h\214\351\302\250\266\261\177G"
+	.ascii	"\005\007u\260HC\027\373wiSh\330[\"\231\241\221\364\357\244\230"
+	.ascii	"\315\2407(CY\313\300\2010\206~\331\030\024J1\356I\fz0\2645\f"
+	.ascii	"\036\b\215\364\333\310\240b\3052\250\023#}\267)y[Z\275\205.Q"
+	.ascii	"\242\225\327A\221\356\200H\027i\2479\254&\322MzW\2155\207\326"
+	.ascii	"\020v5\b\327\2456\244\257&\244\207\274\320B\252\372\205:\324"
+	.ascii	"\013=V\365\275L\211\223\001\220\316\340G\003\351\246!\300\302"
+	.ascii	"(O\325?z\210\220\217\246\352\027\201@\327\247\217)p\006\341\230"
+	.ascii	"|\247Z\364p\241{\364\357\316\364 5)\310\005\036-4\017\026\272"
+	.ascii	"\205\273\026\374\323\200\212i\326\024\333\264\021>e\241\2777"
+	.ascii	"\005\315\221\036V\215\227!\334\230_+\250\320+\244\320*\274\351"
+	.ascii	"\300f\n(\234\320(\230\320'\364\3434`\021/O\377\025\351\350\025"
+	.ascii	"\371\370\204OM\350\303\231B\267\274a\371'\302#d\201\256d\307"
+	.ascii	"\207\220\r|\360\240:\271HaV\314x\372\247\"\352\007\353\3739\215"
+	.ascii	"5~`\312\344\361\342@\277\261\247O\216E\t$t\tu\232)\030\210o\217"
+	.ascii	"\204\300\345\b\"\364\b}M\247\317\340\034<\021B\330\321!\024\207"
+	.ascii	"h8\352\023\251\315\317\231\366v\3017\305;\350\022\016v\276\200"
+	.ascii	"xk\323n\212y\212\200E=\305@\341\323\035\375?h\315(-/\314/\020"
+	.ascii	">h\020\232\357ft\032\3659\274k4\305=E>E?E?\302\247\037\0201\310"
+	.ascii	"F\371\347D;>j\275\002\017\0373\346\327\r\204T\244\370\226N\261"
+	.ascii	"\240\210\372\277\276Z\207\216n\275\260\247N\356W\177K\377\357"
+	.ascii	";\330\314\244\251j\" &\350L\240\0210\240\023\340\240\r\350\363"
+	.ascii	"\351\3457h\016:\275\003s\003\264A\337\211\2267\250%\360\026D"
+	.ascii	"Y\005\033\350"
+	.string	"kY\240\033\300\240\027\350\357)\016>\260(\b\203\276\340\202n3\202\302\nuq\361\235\017,>-\340R\217V\332\202\036b3\023\330\247\311\310}\251Q\254\364\003\341\244\200S\237a\352\331\223}<G\331\240\241\031L\026\001\006\305\234\246+;\305\302\024\245\304\253s4\216s\351\034\375\347\354Y\346N\335\271\313L!8\247N\256\t=\230\360;\321\032\336\032*NNP\320\247\323J\274\372\312>\337w\260\305=\301\322\204\240\353J%\002\247\017\374\304\322vn\301\030S\360t\372X\232:\271|\222\200m9\321Uv)\320\003\020J\320\001\203\020\250\362 -Q\222\0221#32\222$)\2445\"\013\020\b#a\230\345\262\007\022\200$-\f\303\2129#\"\264I\n\255\001\310d\007\326X\264?\372W\013\356\236\022\206\353\240?\246E\360\302\323eiF\267\214\3413k\311\346T\275~kEH\f\247G\022@"
+	.string	"i\215\271R\335\201\024aK\336\306\222\":\316\177\222z\312N\017\227.4\214D\001(\037\344L@<\026Q!F_\237\035\250\333,\025"
+	.string	"U\"b\237\267\"_\245\024k\377-G\357\330\3736H]N\311Q\020\213\t\265NX7\244\204\245\250\002\037\017,}\b\265\323\210\211]\246y\006\342W\030\3349\235\344s\216\276\030\235\270LP\344\202\306\243O\275\357#Sa\334\225\376\031}\006M\351\203\235y\374\214\026\241\216\223vH\360\333\225\220\314\034\214\n\363\211\225\tPO&}\025\377O\352c\305\321;\255aK\037\260l\313\301\013~\370\322\326!7c\331\247\356\327"
+	.ascii	"\264\224\315\367\350\215\202k!\3643\371@\223\305>2`\036\255)"
+	.ascii	"\345I2\026\223\313:\037\372\2416\254"
+	.string	"7\3520~\364\220\023\336&_\327\300\207\210\013hoz\247f\037\361\335\316\3144#q\360\364\276\274\263}\313\026\243\377\230\226\264\340\\\221\314\342\246\340\226\236\213\035\261\327O\026>\311\332\231\302\006\3641k{\235\033\230\324\303k\3168T\320)\246Me\307\244\254=\2056X\020\324\267\227\355\227\304\230\212\255\262\315\001~%Pg\\A\f\026X\302\n\032;\307\336%\001L\372\211Gl,\002\205V\323?<\315k(\b\334a\302\216\025\230\334\002\341d\313\007G\203u\244\313\367f1\020\220YS\207\235:\327\031\037\271\354\034\301\373\177\262\305\367\201%\003^\021$\313\221\206\310\250\036\371dp(\242\251\255\231\350h\343P\354\365^\364\346o\355\r\3224\033\r\332\326\035\217vq\326\"\003sB\244b\"\022\373\2445\354\n\275|\031\211p%%\307\222\262f\320\241\005\207\235C \263\006\245\3405E[\f\236X"
+	.string	"\311\035\314z\017\016\r\375\356\342"
+	.string	"\213\270\220\220\247\201\304\203 \274\"A\362\246l\355\224\276\233\215"
+	.string	"\305"
+	.ascii	"(\n\332\266\363\325\313\021\351\324V\365\222\245\254@iD\331o"
+	.ascii	"\312\341\034\266z~I\223\241\204\357\270\367\327\324\377l\337"
+	.ascii	"<\267\370"
+	.string	"\216\314z\362xo\226@\315\275\227\345\340b.\366W\\2D\367K\212a\t+^\236s\305\004\353\324\204,I\023\177V\005\272\026\324%\bL8Be8\373\027\364j\332]\240{\370\322\360\220xP\343\315"
+	.string	"\312\255\362M$e\250\306\224Fet^\325\372@\247\376.\341B\245\212\"qz\2560\276\210\264\020\035\315\317\351l\2571\351m\222\205\271\\\025"
+	.string	"k\256\330\0254\367[\304rm\025\016q\323\223\345\bj\322\366\3132\n\354\266H\337\207\345!\230,\017\004\237V\b(\207\005\207\250\374[G\253$N\203\264\241\224\025k\f\346\350\371\272O\311?~\277"
+	.string	"\356\200Z\032\0021h\271n\264\276`\373\223\270\264\317=X"
+	.string	"\275\206g\337\"\225/\246C\267K \021\001\200d\007\225(&\270!\334\345\233r!\020\236?sY\327\037\027\255/2\205\006\f\323\370AXn\277\273\023\210G#rZ?tp\314\347\221\300k\375\2205s\326\017\216\035\r-\257l?\253\256\321\304\332\227*G\312\376X\270\200\344\363ZJ\314\313\370\032k{p\031\005\024\bN"
+	.string	"\037\365\211S\242c\206\006\336\351F"
+	.ascii	"n#\336\232\027\030\312\213\266W\353#a\230\217\006\265\fE\206"
+	.ascii	"\221\336\301\034$X\230'\222\254<u\021S\262\003jeA\002`\204\314"
+	.ascii	"\034\356*\203BRc<\343;\023\324\374\375\\}O\314\211\313l;sU.\237"
+	.ascii	"\314f\247\223\340u\337\032@Z\216+\211[_P\361\037\310Vk\0078f"
+	.ascii	"x\204cu;\236\371\017\037bDp\235,\321/\240~\317\372\264\006\355"
+	.ascii	"e\021\340\247K\367s\362\303.\325am\023\306\001\307\351c\336\355"
+	.ascii	"\334(7\270\367\373\177\033QK\200\217\002\325\312\302\364\233"
+	.ascii	"\216\2047\210``'\027\005\342\325N5a#4n\226\243\365\227d\237\252"
+	.ascii	"88\2503\020U\221\034\251k>\026\327W\224\001\242R\260&\224 %\260"
+	.ascii	"\206\233%\025\360D\3072\356\255e\234\bGt\213\r\022K\033pg)\017"
+	.ascii	"\\\305\274\313L\220J\216\351\351\322\034\177\205\023G\026f\344"
+	.ascii	"\222r\036\034\336\037e0c\026x\224_\331)jPm\372og[?\305\306\307"
+	.ascii	"iZ\221\330W\214\2622f\271%\023\232$yO[\330\317\3137}\251\224"
+	.ascii	"f\201{\317\344\306$3\364\006\351\272\tHc\271\f\214H\370\204B"
+	.ascii	"\303\255>~\311\257\271\231\251l\202\263\264\351b\364\361\305"
+	.ascii	"\001\216y\243\352\223\232)o\262\236_\344\276\260:\235\353<\265"
+	.ascii	"\252\016\317\355\246f\307\372\326\b\314\235']\315\217\230\213"
+	.ascii	"\221\\\n\006\030\r\003\b\020A\230\323#\212\306\210:\263\201\255"
+	.ascii	"\363\214X#8\t\254p>\340\304\327\266\260\003\260\201\366\307\304"
+	.ascii	"\035\240\360\220'\201\227\030\256fQ\236q\353\002\231sS\257\031"
+	.ascii	"$\224\263\326\017-\320LHl\263ax\267 \256\346m\344F\025W\350\341"
+	.ascii	"\370\340}@\270\f\367 \276p\017\225\027\037g\225_\363e\"\232\343"
+	.ascii	"\324\t\365Ss\315n#\265N9@\250a{2\251\373\034J\207I'\301\317\213"
+	.ascii	"\376\003/0p\266\007\033s\036\265-\007\213\236\353=\302\253gr"
+	.ascii	"\262\336\323K\377\244\203Nw\240I\355L\210\235\031P\341\022Kp"
+	.ascii	"i\001"
+	.text
+	.section	.gnu.lto_mspProcessOutCommand.187.cecdcad914df8b5f,"e",@progbits
+	.ascii	"(\265/\375`\026\243\315\001\002Zx\323\271R\0200'\251\244\003"
+	.ascii	"\377\270\263\323\335\335\335\323\377\177\177w\177ww\325\377\377"
+	.ascii	"\315\230\375\377\357\315f\357vU\377\325\327\3777jd\226l#\314"
+	.ascii	"^ Y\203;x\007\357\340\035\274\2037PAuB?\320\307af\320'I5(\032"
+	.ascii	"8\354\331\355\023\262\223\2242\352\na\nI\f\235\267\275\215\027"
+	.ascii	"Bo\337\275\267\355\322\336\256{o\323\245\275=\367\336\346\222"
+	.ascii	"\366\366\226\367\266\226\264\267\345\336\333q\033\3646\\\b\275"
+	.ascii	"\375\266\275\355\026Bo\267\275\267\331\322\336^{ogI{[\355\275"
+	.ascii	"\235f\354m4coc1\366\366Y\332\333W\336\333fio[yo\227\245\275M"
+	.ascii	"\366\336\0363\366v\225\367\266X\332\333T\336\333a\306\336\236"
+	.ascii	"\362\336\006K{[\312{\373+\355\355(\357m(io?yo;I{\333\353\275"
+	.ascii	"\335\225\3666\327{{+\355m\255\367vV\332\333X\357\355e\332\333"
+	.ascii	"W\357\355&io[\275\267\231\244\275\275\344\275\255\304\330\333"
+	.ascii	"I\214\275\215\304\330\333UioS\275\267\247\322\336\226zoG\245"
+	.ascii	"\275\r\365\336~2\366\266\323{\273\311\330\333G\336\333F\322\336"
+	.ascii	"V\276\267\213\030{\233\351\275\275d\354m\"\357m%co'\275\267\221"
+	.ascii	"\322\336\036\362\336>\332\336\026\362\3366J{;\310{\273\310\330"
+	.ascii	"\333@J\364\366\217\367\266\017co\367(\321\333<\336\333Dio\017"
+	.ascii	"\275\267\205\322\336\016zo\357H{[\307{;G\332\333@\357\355\237"
+	.ascii	"\264\267q\274\267o\244\275\355\363\336\356I{\233\347\275\275"
+	.ascii	"c\354\355d\211\336\326yo\347\030{\033\371^n\032{9\361\275\214"
+	.ascii	"h\354\345\303\367\262\241\261\227\013\337\313\314\3672\341\006"
+	.ascii	"\275<\370^\376\262A/\013\276\227\003\337\313^\322^\356\362^\006"
+	.ascii	"L{\371\357\275\354\227\366r\337{\231/\355\345\275\367\262\036"
+	.ascii	"\b\275\234\367^\306\373\240\227\357\336\313v\036\364r\335{\231"
+	.ascii	"\356D/\317\275\227\271\244\275\274\345\275\254%\355e\271\367"
+	.ascii	"r\234\261\227\341\336\313o\306^v{/\267\031{\231\355\275\274\226"
+	.ascii	"\366r\226\367\262Z\332\313i\357e\264\264\227\261\274\227\317"
+	.ascii	"\322^\276\362^6K{\331\312{\271,\355e\262\367\362X\007\275\\\345"
+	.ascii	"\275,\226\3662\025\016z9\214\203^\236\362^\006K{Y\312{\371+\355"
+	.ascii	"\345(\357e(i/?y/;I{\331\213\203^\356\312\240\227\271\336\313"
+	.ascii	"[i/k\275\227\263\322^\306\242\351\345\345{\371*\355\345&4\275"
+	.ascii	"l\365^f\222\366\362\022\232^V\362^N\222\3662\022\023\275\\\365"
+	.ascii	"^\2462\366\362\224\211^\226z/G\031{\031\312D/?\275\227\235\214"
+	.ascii	"\275\334d\242\227\217\274\227\215\244\275\2544\321\313E\336\313"
+	.ascii	"Li//\231\350e\"\357e\245\264\227\223L\3642\322{yH\332\313G&z"
+	.ascii	"Y\310{\331(\355\345 &z\271\350\275\f$\355\345\037&"
+	.string	"z\331\307{\271\207\261\227y\230\350e\242\367\362P\332\313B&z9\350\275\274#\355e\035&z9\307{\031(\355\345\037\023\275\214\343\275|#\355e\037\023\275\334\363^\346I{y\307D/'\337\313:i/\347\230\350e\344{m\244\275\307\367\342\244\2757\357\265yo\315{k\274\227\206\2617\210\022\27536\350\005\342\2752\336\033\303\330\373C\211^\030%zO\360\336\027\306^\037J\364\272xo\017\306^\023\224\350-\301{yH{wx\257\016\306^\022\224\350m\261Ao\016i/\016\357\035A\332{\303{E`\354\r\001\211^\020l\357\007\336\353\201\355\355\300{9\220\366n\340\275\032H{3\240A/\006\336{\201\264\327\002\032\364V\340\275\024H{'\360^\t\244\275\021\320\240\027\002\357}@\332\353\200\3676 \355e\300\006\275\013x\257\002\322\336\004h\320\213\200\367\036 \355\265A\203^\003\274\267"
+	.string	"\306^\002\224\350\255\341\2754\030{Y\224\350\235\341\2752\030{c(\321;\200\367\302\220\366\276\220A\257\013"
+	.string	"\350m\341\275,\030{W\300\240W"
+	.string	"$zUxo\n\306^\024J\364\256x\257\nc\357\t\030\364\232@\2427\005\211\336\022\336\213\202D/\t\306\336"
+	.string	"\274w\204\355\025\341\275!\274\027\204\264\367\203\367z`\354=\361\336\016\322^\016\336K3\242\327\304\210\336\r\336\253\301{3\330^"
+	.ascii	"\214\350-1\242\027\203\367\222x\257q{\323\021\275#F\364^\360"
+	.ascii	"^\013\336[\301\366R0\242W\304\210\336\020\357\235y\257\314\366"
+	.ascii	"\306\214\350-\216\350\205y/\372\336s{\353\210\336oo\277\227\213"
+	.ascii	"?X\300%\271D\351\212\273\235\0272\250y\210\224;\257P\365\024"
+	.ascii	"w\024\267\023\367\021n%\367\0227\022\367\021w\021w\017n\037\334"
+	.ascii	"C\334;\270\201\270qp\367p\357p\35307\231\021\231\003\231\367"
+	.ascii	"\230\363\230\357\230\351\230\2710ka\206c>cFcVc^c\246\302\\\205"
+	.ascii	"9\n\203\260\313T;C\201\017\236\025\251\216\202!s\344\210P\213"
+	.ascii	"0I\361)\216\260\217l7\345\031ie\034^\024\323\316\304U\371c+*"
+	.ascii	"5\302\017\264\322\336P\251]u\322\316\360Yx\247E8D\371fE\2130"
+	.ascii	"\004-d\371J\324\233\321\356L\020, X\256xl\373\350\0375$o(`\315"
+	.ascii	"\251\307\323\022Q\322\r-\264\234%\352\213p[\307v\320\316\360"
+	.ascii	"\271\003\207\265\034HE>;\307\332\317\337\317\3164\216\026\026"
+	.ascii	" \267 y\350N\215\360\250\350s\307\243&\325I\231/)+Z\204\235\263"
+	.ascii	"\333\310\235\341\263\"\247\330pfX\205Dz%\356\214\026\022\326"
+	.ascii	"\376\262\320\025e\231+\312\202\"\256H\007\376\2627Np\204\202"
+	.ascii	"Zj\204jE7Ni\204iE(\320\262\360\300}{tB\273B\"\2213|;\303g\323"
+	.ascii	"\231\323_\336\262\336\331\016\274\235\271s\241u\246\243G\261"
+	.ascii	"\2169W\221Sl0\353\253B\"\221)\344\226\267\354\214"
+	.string	"\226+\263\270?$\022IT\214\203[b&\3069\212nm\373C\023\031!\3312\026N\343,\314\2663k&\030\272\353\352\373C\"\205n\324\\hu\371\305@[4F\022!\031G\021\263\243?$\022\311\203\031_\301\341\263\027'v\274\220C\025\360\374\334a\240\310\347\211\312`\\\266;\263@0\331\306\\\341\333C\322B\"\2213|\356\262\224e1\036\333\031>\253\300`d\017\262F\021C\303\277\003\024\371\344)\034\206\303Tb\234\320\361B\346\314\370\304\335i\021\"\221B)\370\334\002\024\371\\+2@\354\316\360\031\302.\316\362\327\316,G\261q\"\307\013\031\2042%zi\021\"\221^)\370\334\025\305\332\273\354\305Np\370I\020|\001\022Y\204i\005\211\364:aS\024\371\\\257\342{\227\265x\013\207\271l\366D\"\225\326\254 \221\310\0236\204\"\237\0260\t\224\317\346\024\345swW\005\026p\326\006"
+	.string	"xr"
+	.string	"Q\350\202\363\371\"D\"\275V\374\310\005\027\224p\201\003\0168\220\341l\304\210*7~\204\005\037\214\030\021\200\377+\316\363Taw\005\rvW\204\335\225b4\032\007`\201\005\026\230x\333\"W/\336U#a\203\327\313vY\300\375[\277\355[\276\335[\275\315[\274\275[\273\255[\272\235[.\273e\265\254\334\306-\334\276\255\333\266-\333\256m\226U\333\264E[,{\266W\326l\255l\331\222\355\330VY\261\245\262a;e\301V\312~m\224\205\262O\326\311z\321\300b\006\031b\030"
+	.ascii	"\f/\270\320"
+	.string	"\002\013+\b@\205\024PX\241\342\004\023R\224\200\202\204"
+	.string	"\214 B\b |\340\301\211\0168\2401\261\201\006\031"
+	.ascii	"\240\004\006$\214\351\022\216\270`\231\026T@\201\210\020321E"
+	.ascii	"\030\364\254\337\300\025\334/;\270\205k\270\207\213\270\211\333"
+	.ascii	"dd\333X\376\342z\305\365\006\305\216\312P\016\257\227.KLz\274"
+	.ascii	"\200\021@\253\373\273\343\3653\261\224\274k\252\270\336>\304"
+	.ascii	"\035|o\274{on\275z\0250\351\311\253\321\364\001\303\013\242\313"
+	.ascii	"\007\354\016\002j_\354B\220\235M\325m\375\240\223b\336A\226E"
+	.ascii	"\326c\211\211\214w\016\203\245d\225\255GK\311\261^.K\253-M\244"
+	.ascii	"h\241\200I\235\\\214'\037\2608/7\340\236\226\275o[\274nm\315"
+	.ascii	"\251\036KLZ\274lYX\275kO\3149\304\232;z,1m\361f\271j\212\352"
+	.ascii	"U\243\342M\233\342E\233j\222\352"
+	.string	"\305\322LI\275g[\230\240x\257\230\031\305\230}=\226\230\236x\25585\023\327\243\245dSo\031\363\007\331`\332X\222\220\336*G\274b\202F\250\204\300\310\007,L\315\310\2247)\260!:z\245\324\036[\230v\360~\ra\316\001\2245\325c\211i\007o\224\231e\035\224\266)>e\373\344\304\232\331\226\240\036KL?\274N\352\t\034\030,%\177z\275L,%o\224q\375\261\224\374i\032:\020\345\003\306\242\001I=3\324\2761\2263\303`\222f\0071l\031\0169\006\"f\017\240\220a \342\272\226\204d\211\250\220_\250\347!<\222\241\320g\256s\364\265\013~\334B\363\013\013?z\275\302\036\013\240\312\240\215\225\261\360\224\004I\373\340\265\ny\234\002\003\f\323P\250\026\334U\024\340zE\034\253\340\341\252&\205d\211(\216O\020\3541\301\213\221\024\200RJ\210\223\202\242\242\351\371\200\221\220$\353"
+	.string	"\224\361\b\215\254\322\"\214q\bH.\316\235\031\002.\021\2151\b\211[\375\001\025\366 \214O\0249{\003\\\"\n\343\016\246t5\007\265\204?\263/\234D\210\253\222\b\232\372\341D\366`\213PW\323\324k\311\262$\003\322\0218\026\314j\023Z\274A\205\331!T\007\350g\304|\313\326"
+	.string	"\2133\340\034T\224$\002\240\302\360\004M\275P\370w\205\365\246\272\004\025c\240\307\365l\007\222%\"*&\221W\007\325\306(N\243x\t\t+\nsN=\302\b\321\023_\300:O\274\314j\001\022\2114\261\224dV\024<H\"\224\324\026\030!j\342\n`j\340b\240Y\034\340\022Q\023S\340\301\022\021\022\213\030\022\342\b\251g\204\304\261\007I\204\220Z\206\307\370\202\020\314\264|\312z,1\345q\f\317\330\016!\346\022Q\020.n\021*\252'\220H$'\021\n\3220>n\354A\022\241 \215\376\340Sf\350\007\327Z\002\222[\017\n\206x*\t-L{\314\306\r4\264\323\367\343\r\354C^A(\336/ \034\361\016R\341-,\3435\314\343=\334\343E\304\342Ml-\336&\bT\314H\236\033p\315 \302\266\034b\211\210bT\302\022\021\017\337\326\262"
+	.string	"5\r\013\257\214d\206\222lkY\312\272\246\370\031q!\271\361\261\365\361\r\tR\324\266\307KBR(?\241A\031\227\222x(4L\rH$r\373g\210\210\227sx7\204\216]\266a\367\007\f\001?\213B\345q\\f\035\267\366\330ut\322\374\323\302\031\217\215aF\204\310%\341\255\201\304\225\033\303\226\242^?\363h\244\340\312\307g\344;\352\365T\031T\306\302\ngA"
+	.ascii	"_A\005\001\024\251;\266L\204;(U"
+	.string	"\307qM\305]\005\2529\216_`\307\2600\224O\025\316u|\376hBLi\\\200B\371\231W#\005\327\275\275\021{G\241<U\356\030L\001\205\247\260\342(p\240\353\336w\217c\307\262\346\237\025\34796\2561]p\345r\215\027\331\030\266\n\320\257\237y\024\244\340\252w\240\335\335\023\270\352\235\023\241\344\355t!\227\200\366\204f\201\t\\\365\216~=U\352h\246\320*N\270\n\023~\302{,\003\235\342\273\307\263#\032\312?&\374\304Ix\212s\017[\262\233\213\342%\234{\376\362\216\342\365mwg4U\236-k\341\205\335\243Z\3359\256\251\270\253I\022\316[\370\314\322\024\310\274\242\323\315\257W\222O \221\310\n\256\\\031!V\"X\310\217\020\375e\2462\fT&H\232L\221a\2405\357@K\301\225\374\204\006%\342E\336l)Z\032\355\t-D\361\354\"%\353|B\203\232\271\022\311\30774"
+	.string	"\347\245=\266\275\360\370fb\367\030w\346Q\013\006MH$\262\005>\367\203'<r9\322\035\355\232\177\370\\>\332\241|\006\340\034\307\365\257\251n\311\025\310<\3062T\200\3101\377r\032Q\346\312\335@Z\021m\373\006\254`*p\343\030\245\265\241-Ah\nF\353\016\264k\202\212D.\321\300k\314\177O\272\271,z\004\021>B\003z\367\250w\344k\376\021\341g.\t*\240Q\271#\340\321\013\336\322\333\001z\3678xd6\377\240rG\303\226\332\344\222\032\360\242\241Kir<h\335\271\355|6\244(\270\273\336\367L\260\034\305\347\236p\307g\345\345C\371\344\222\3539\013\317"
+	.string	"\036r\204\177<\317Yn\326\375,\214\271\362\t\230Z\361E\226\213h~@A\201\333\351B\230+\331\215\273\350\207\322\025\024.o;]\270E^44\204\243m\357\261\036\254d7W\007^4\024\005{\b/\301\203\303\256\007)\331M\364\312\335%$9\236\347\300\360\004M\235,\032\204\017\016\302{\354h\370\301\253\331\222\220\023\270\303\226\202\310\361<\347V\204\034\251O|*\375\324\211B\005\005o\247\013\373v\216\027\r\365\340\335\367\355\236\300d7\367\304=\370\021\t\320\273\307\246\215\234\346\237\023?\303\226|\260\350\016xl\370p\360\016b\350]\033@6t4\377p\360\003.\361\220K>g_\350\237q\bC6x,\t\311\365\320\374\004\317s\326\304i\316\033\274\304Mh\360\r~\302\327\231\3015\370\nD"
+	.ascii	"<\003\006\300g\230`\360\021/A\342\030\234\004\276\312\213\206"
+	.ascii	"\032O\342&\274\2457Z\220^&\351\202\213\370\b\013~\301i\320N\340"
+	.ascii	"\nn\301I\370\242\340\025\234\240\3400\313\020/^\304\314C<\003"
+	.ascii	"\304\346ECe>s\023|1\227)\306\034=S\332y\316\302\374/\236}z$\273"
+	.ascii	"\271\350a\216\276\231\300\347\321g\200\326s\230\354\346\326\237"
+	.ascii	"\265\236\333\224\376\263O\242N7\227\205n\266\001\004\335\265"
+	.ascii	"\021\304\206\220\346\237\376\t\233M\271\235\024l\243P\216\347"
+	.ascii	"9\233B\267\227\237E\276k#\311\006\221\346\237e6\256YJ<\317\331"
+	.ascii	"7\233\274h(\277\275|\333\247(\331\315U\321\225m(\321]\033Gl8"
+	.ascii	"5\377\360O\330\364RBs\033\263\331\220r\241\t\211D\362\317\256"
+	.ascii	"\r*\033H\232\177P\2603\033\033\2554\343\344v\236\263\r\310<\306"
+	.ascii	"\t@\254\"\374\313i\304]\257\344\231\310\210\002\004\330\f\267"
+	.ascii	" \nk\032\321&\350\206\b\307\307\361\212\331\306\225\273{.\336"
+	.ascii	"\032r\032q\231e\320\236\320\030ye\327\336k\373\272\251\204tt"
+	.ascii	"\002\207\326~k\020\317K\353\n\251\264\334cm_\217\355\001Z\355"
+	.ascii	"\233l_\013\026A:\342\277+\331/\341\2763\354U{$\234\0257E\353"
+	.ascii	"Jj?U\344\315K\353\352P\333\327\201`\226\037l\2036\355\235\030"
+	.ascii	"(i\212\326\225"
+	.ascii	"rod\373z\357\017\351\210w\226\366L\333\327uK\220\2168\231"
+	.string	"\264W\332>\030\354\022\217\366C\266\017\206\270\"\304 {\243\355\373\230\034\322\321\341\217=\220\355\3531%\244#B\036\373\036\333\227bPPh?\264})\374\262\374\351\330\357\360{\252B*\375g\017\304\207\306W\345\263\277\261'E\270\263\347\321s\263\242u\365\234\275N\036\333\237\326U\342vs\373:m\016\351\b\317p\373p\373P\354\335\021n3\355\316\206T!\225\004\267\277\324\231qUu\331\366\262}\035|)\242{b\026\255+\277\355\277\355\373\236\022\322\221\334\3366\037\234\226\027\336v\336\366\r`\256\310\255\177\352\266\355\330\234\344\264\256\220J\\\266\347\254\024Y\321\272B*\311mk)3\222{\333\206\333\276\025iEcl\333m\333\327\207{bj\333YV\n\017L\320\237\326\025\226m\264\355k\304C\244\243\3652\333\276\262})\310\212f \333.\213\201\225\220j\210Ub\333U\266\257\210D\3460\322"
+	.ascii	"\330\006\345\363\244\372\323\272B*M\331\016\333\276N\214j\341"
+	.ascii	"k[\312\3665\335\334\nO\266\241l_#\356!\035\251\320\265\355\265"
+	.ascii	"}*\340\212L\320\332\336\332\276\026\324B:*a\271\215\265})\300"
+	.ascii	"\212F\260\332n\262}=W\344\003%\333K\266\257\253D!\035!\2219\214"
+	.ascii	"$\3036(\237\273\273\2738\273}\375\203D\"\221H\024|\3566\222\335"
+	.ascii	"\355+\"\2219\214\264\273\273\213\263\333\307<0z^ZWH%$\n>O\245"
+	.ascii	"\223\320\304\022\204\204\314\353\304]\257$\277\331Ll\366\225"
+	.ascii	"\273\374f3\261\271/\262\313y\274E\036|\307[\034j \336\242P\357"
+	.ascii	"\340-\002u\021/\f_/\361\302\3245\022/\214\331{a\274>\350\205"
+	.ascii	"i\"B/\f\223\264\027F\311{\321:>\343E\345\030\215\027mc5^\024"
+	.ascii	"\214\265\360\242_\314\205\027\205\302t\274\250\027#\362\242["
+	.ascii	"\255\303\2136\351\035^\224\251{x\321\241\306\301\213\352\340"
+	.ascii	"=^\024h\203\336\363\360\275g\341\006\275'\341{\317\300\216\342"
+	.ascii	"=\001;\212\367\374\343&\357\251%\204\336\223\255\217x\317\264"
+	.ascii	"\036\342=\307\272\007\357\031\326>xO0\016\344=\237\364\021\336"
+	.ascii	"\023I+y\317\252v\342=\247<\350=\215\360\023\346\263\310\211\336"
+	.ascii	"si\204\336\223\bs1\237J\035\364\236I\\\205\367\324\351(\3363"
+	.ascii	"\247\235xOd\037\341\255\315V\362\326\304V\362V\304^\342\255\207"
+	.ascii	"\215\304[\r\373\210\267\026v\021oe\366\020o%l \336:\3308x\353"
+	.ascii	"\227\356\341\255\202\275\303[\003[\207\267z\341&o\355\302\210"
+	.ascii	"\274\025\220\003y\353\037\357\361V?\316\343\255}L\307[\371\230"
+	.ascii	"\013o\335c-\274U\217\341xk\036G\341\255x\333[\357\336[\355\214"
+	.ascii	"\275\265\356\275\225.\355\255s\357\255\\\322\336\272\345\275"
+	.ascii	"UK\332[\345\336[\343\322\336\n\367\336\372\226\366V\267\367\326"
+	.ascii	"6coe\333\336\272\366\336\232e{\253\332{k\332\b\275\025\355\275"
+	.ascii	"\025K\332[\317\336[\257\244\275\325\354\275\325J\332[\313\336"
+	.ascii	"[\311\322\336:F\323[\253\274\267\212\245\275\225\nMo\r{o\235"
+	.ascii	"\222\366V0\232\336*\345\275\365+\355\255Qhz+\224\367\326'iou"
+	.ascii	"\242Ao\365\242\351\255]\357\255\\io\335\242\351\255Z\357\255"
+	.ascii	"Yio\305\242\351\255\313\367\326\253\264\2676\241\351\255V\357"
+	.ascii	"\255L\322\336\272\204\246\267*yoM\222\366V$4\275\265\352\275"
+	.ascii	"\225*\355\255S4\275U\352\2755*\355\255P4\275\365\351\275\325"
+	.ascii	")\355\255M4\275\365\310{\253\221\264\267*izk\221\367V\246\264"
+	.ascii	"\267.\321\364V\"\357\255J\306\336\232D\323[\221\336[\207\030"
+	.ascii	"{\353\021Mo\025\362\336jd\354\255Ahzk\321{+\220\264\267\376\240"
+	.ascii	"\351\255>\336[{\244\275\225\007Mo%zo\035J{\253\020Mo\rzo\335"
+	.ascii	"\221\366V\0354\2755\307{+P\332[\177hz+\216\367\326\033io\365"
+	.ascii	"\241\351\255=\357\255<\306\336\272C\323[\223\357\255:\306\336"
+	.ascii	"\232C\323[\221\357}3\355}\"M\357\021\337\373Cc\357\riz_\370\336"
+	.ascii	"3\215\275'\244\351\375\340{\377%\355\275 M\357\003\337{/i\357"
+	.ascii	"\273\320\364\036\360\275\3773\366\336\217\246\367}\357=\237\261"
+	.ascii	"\367{4\275\327{\357\363\214\275\307{\357\357\214\275\267{\357"
+	.ascii	"\353\322\336\323\321\364~\356\275\347b\354\375\026\232\336ky"
+	.ascii	"\357\345\322\336\307\275\367pi\357\337\336{7c\357\333\336{6c"
+	.ascii	"\357\327\336\373,i\357\325\336\373\264\264\367h4\275\307\362"
+	.ascii	"\336\237\031{\177\345\27573\366\336\312{_f\354=\031M\357\307"
+	.ascii	"\336\373*\306\336\213\321\364\236\312{\037f\354\375\224\367\036"
+	.ascii	"\314\330{)\357\375\227\261\367Qhz\017\345\275\177b\354\275\023"
+	.ascii	"\232\336{\275\367]i\357\271\214\275\337z\357\265\322\336g\275"
+	.ascii	"\367Xi\357\227\357\375\225\261\367MJ\364\336\352\275gb\354\375"
+	.ascii	"\222\367^I\332\373$\357=\222\264\367U\357=U\332\373\251\367^"
+	.ascii	"*\355}\324{\017e\354\375\323{\357d\354}\323{\177$\355\275\221"
+	.ascii	"\367^\231\366\276\310{\317\224\366~\351\275'\222\366^\351\275"
+	.ascii	"OJ{\217\364\336\017I{\177\364\336\013\021\241\367F\357}\220\264"
+	.ascii	"\367E\255\344=\220\367\376G\332{\037\357}\017c\357y\274\367D"
+	.ascii	"i\357\207\336{\241\264\367A\357\375\216\264\367:\336\373\034"
+	.ascii	"\306\336\003\275\367?\306\336\343x\357o\030{\357\363\336\367"
+	.ascii	"\244\275\347y\357w\214\275O\276\367:"
+	.string	"i\357s\336{d\332\333\315\367vb\332\333\210\357\355\303\367\266a\332\333\205\357m\346{\2330\355\355\301\020z\373\313{[0\355\355\300\367\266\227\rz\273\313{\0330\204\336\376K{\333\357\275\335\267\275\315\027Bo\357\201\320\333z\357\rE\204\024\235\232\230\346\226KD\336KC\212\312\"D\224\224\222\212Dn\222\224\222\316FSqK\244!o$\"\305!B\212G6LJ\233#G\206\024M\3011\271\026p\345\356\221\220\367\221S\261\310\006\nH\0139#M\2711\333\310\350<f#U\354Q$*\362\260\241Bb\243D\t\312g\007A\232r[v\226\002\256\334-\002\362.\372\361\006\302\244\030\264CG\216\037G\255\246\320\230\\>\272\307\333G\217s\223\"\216\343\020\036\263Y\026o\330d\261\224\265\331*\372\330t\255\320\264E\236b\217\215\023(6__(\237\315\343I\004\233\230\360\326\220\200+w\346\347"
+	.string	"g\332O#\033Rp-,|\023\335"
+	.string	"=\364&*&\207N\343T\244\323M\004\024\376L;\006<oj=HI\241\240\267P\021\331\004\013:[I\371-w\35484\f\323q\346\222\352c\346"
+	.string	"z\347 \034\024\2631\003:_I\365-\257\350\364O\343x\377\234\351~`\002a\024a\272\300x\261\031+\26313C\371l\034\357!|ZI\3611\257\034\340\206\317\373\206\337\231\317U\220\332\213b\024M\220\330\320=\355\367\356a\246A\233\347\355\247\007\003\315\306\260y\316FRu\314\235\344{\247u\336I;\230;\0335\233\2655\224\317\326\371\tuA\212:'\007\206\013\314\334\361\255\315\346\355\r\345\263\221WA\212\216Y\364\244\330R\311"
+	.ascii	"\004`\3467`U\303\277\230\313hH\3010^\007\332f\342\271\031\007"
+	.ascii	"#\027\227\030\207xxF\324\002\343\326vx&\222\2023,<\033r\201\311"
+	.ascii	"r|S+|\f\021\337\037\322\026\240X\223*"
+	.string	"\346\237\327\033\260"
+	.ascii	"\004\bj6k\270rm\fa\302s\231\333N\027\356\337\230\t\317\314W\276"
+	.ascii	"\036\254$\035\314\025\033=\031\314l\374Z\260Bx\356\"\365\306"
+	.ascii	"\034\374r\036\264\203\031\253\"\366\345l$\365\266T@\263`\340"
+	.ascii	"Y\020\017f\212\215\336\b6|0`6~!\334I\tt\363\322\345\354\005\020"
+	.ascii	"\006\n\214\"\214\023\230'6^l\004m\006\007Q>\271\313YH\312\r\020"
+	.ascii	"F\311\031\220\006\345\277\303(\201\321\202\331\202a\303\2641"
+	.ascii	"\2641D\371\344\277\363\221\224\032\263\b\311(\254\336\344h\270"
+	.ascii	"r\327\257\357\354\207\b\263\274\352cr\361\355\235\371l\2320L"
+	.ascii	"\216K\366\320\364Z\357\254\267D9\357\255\227\003Su\223\244\312"
+	.ascii	"\303\262\304\203ir\306\313B\371\3560Mx`\240n|\236\356\230vF\316"
+	.ascii	"v[(\327\3754\202\003\306\310\r\220\262\356l$U\266\244[:\323\235"
+	.string	"\307\370\2021\033](\317\375\\\322\001C\344&(\tF\351f\210\307\315\315\334y\214Q\\\331\013D\332*\302[\003\213+w\335\344x\236\243\304\ns\371\2263\027 0F\307d\220-g\244\250>-rg-\3471\226\373\315\224\304\301\235\343\202\300\364\340\001\267\267|s;\277\t\201\021\nr;WE\3311\271\332\330\316m\347\261!09n\222`~`\200n\2100\335(\225(\237\314\026e\267\344\"\302[\303\f1\300\360\375|\002\"\005W&\007\314w\220\246\202T\225D\006\346a\370\336A\230\002_bj=H\311\265,\347\265#0<E`v`\222Y\230jig5'\030d\235R31\355|\0245\267\344\322A\303rF3,<d\022ba\236]9\237\t\036\223*\356\240\320\300\233\257\230-t\204^\272\\9cE\305-\315\254\234\315\244P\277c2f\013]\340\321\356\214\034h\337\r\325K"
+	.string	"\322\2059\355\241|7H\224\3340i\202\362\311V\316GQpF|\001^\022fw\205\361\274\305"
+	.string	"\3039\366\363\351\205\024\\\t\321+\\\t\317\003 \3749\366&b\n|\2055{\220\222ed\347\262\273=\2623RT\032s\354L:\217\275\177\360\005M&"
+	.string	"\312U~&-\321\271\233\254\030\"\272*.[\252\244\211Q9\213\305\311\370\273\021+R9\023E\2411\303\302\316C\266P\267\033\264\nt\350\232\332\330\302\316\177Qh\313)'\230\032]\221\242\335\031;\3204\264)\357\037X\2300\240W\222d=I\222\245\\N#\276\320BQ\350\347\223\214\024\\\007\017\264hh\035|\347\220\003\322\362ra\360E\241w\016\246\300\327\024\265\036\244$\230\2243X\027ZF&7VE\312\271*\252\312W\224\363\227\0234\354\2304\241io\240\240Sn\276b\210\346\264\220\264\300\244D9WE\2011\271t\240<9C\001C\241\034\2231DsWO\234<9\023E\201-\271t\234x\235\235\234\371n\302P.t\353\305\335\215X\021\007\224O\366:\023EIar\2555w}\367\246\354\306\254\371\247\bt\036R\2729C\261n\320D,\315U\365\320\356\f!ty\243VI"
+	.string	"\016\372\370\241M\320\253\233\265\275i\273y\213C\371\344\256w\020\237X\242\244,\321\254\206\364Z0\201\251\020\307\250\fY\270rg\330\004\200\3528\314\023\316\336h\271\341\322A\023\022\331\303?\365\313\201\216T(s\335"
+	.string	"h\222\031DG\252\342r\013\224O\346z\3770\211/ \243\025\270~9\252\343%\224]`=K\222[Z\347-\256\263\326\373\207#\360\325U\346\223(\200+w&/\005t\350\347\323M\n\256\202i\\\005\337>4$NA\251 xt\350%\276\270\300z\220\222YX\347,:4\n\352)\007V\323\222y\325\344|e\207*\2130\021\335"
+	.ascii	"\256\270kB\304\352\314\005%\310d\311\231\311\231\017\017E\202"
+	.ascii	"\341\302\335\316\350\201\016\271\321k\241io\370\320\243\033?"
+	.ascii	"T\bN\321\r\340\212\003\240|\362\222\273\200\307\205\026\241A"
+	.ascii	"\016\260\034\2657^n\004o\004Q>Y\311\333\207O.\250@f\021\013N"
+	.ascii	"\311\264\024\256\334M\202\344\234d\020\365\201\2043TD\362\030"
+	.ascii	".\036U\3474(>\252\2513\025*\024TdJ\207\324\3362\n\352\034u\002"
+	.ascii	"\372\203\343\t\312\347\211\351\324tvBw\216o\034\245\351\206\211"
+	.ascii	"&o\f\253p\206Zhj:Gq\272\202\346\0349g\201\2623\242<\033\271A"
+	.ascii	"<\023\255\224\207E\350\230\226\316L7\315\223\251\2053T\\z\f\327"
+	.ascii	" \021\272\245R\322Y)\320\313\223$@\2448\346\220\037\235\207\234"
+	.ascii	"}|S\216\364\204\304-\215\202\234\215\356\354\310\202\234\205"
+	.ascii	"\023]\021\263H\007\310\2173\220\363\330\313\316-Z\260\340\f\261"
+	.ascii	"p\367\3433\340]\211\363qN\203\202[\026q\017\036\347\036\347\261"
+	.ascii	"\234\323\355\370\306\306\203\215\350\234\005\352\2159$t\036J"
+	.ascii	"\236jrBhAo\313\035:\316;x\316+u:\254\3448\247A\2711\213t\200"
+	.ascii	"~\316@\3471\237s\f\013g\017g\250\370\363\030.1\034iPn\313\"\024"
+	.ascii	"\256\334\230'\025(\323\317\247\023Rp\r\f<wY\021x\224\351#\276"
+	.ascii	"\260\374z\220\2227|\3167\316|?\316)0hh\302q\202u\301\031r\301"
+	.ascii	"\34748}\365\274y\370\204\203R[\026\351tS\305\225\273<;g\236'"
+	.ascii	"0f\270\003:\235\020\362\316g\300\353\342\3449\r*mY\304:\234s"
+	.ascii	"\3269\217\231pj\301`\201\243\343\314\302\t*b\341$\342\f\261p"
+	.ascii	"\207D\"9\001(\237\234s\026NW\316&\347U\002\226\243\026\207\007"
+	.ascii	"\216\017\037(\237\214<\247A\2411\213r0\212)\264\023l\034o\003"
+	.ascii	"\310\271\344\230Lr*\301\t\"\004g\310\020\224\317\343\331\b\252"
+	.ascii	"lJ\013\347\3468\3471\237D\235\244s\352\230\214:\245p\2100\341"
+	.ascii	"(\225(\2377UPdVxk0\241\017m\336\207GN\247&\033\346\031X\3633"
+	.ascii	"\320\351T\026\2519[AUa\216qU\362\3055\336L\250\223\b\216T\021"
+	.ascii	"\211\334ia\317\244S\t\207\n\007\t\216\022\034%(\2375\316c|ZA"
+	.ascii	"\2011\257xkH\241\200\256\203\0346\345\243\2510\n(\304\022h\004"
+	.ascii	"q\032\347\261\031\017\202\225\275\213\323\004g\331\3743\343_"
+	.ascii	"\203\002\224K\002!\343@\360\322\026NW\363\217\214\177\r\352\r"
+	.ascii	"\007\243\200jC\021\343?<\306\031\306\177\220\341\f\320\023\034"
+	.ascii	"\306y\254\007+\351\344\374a\243\302\007N\330\b=Np\276z\022\\"
+	.ascii	"\276\360\341/\\\334\007(\347\220P\220\213\036L\360\036\316c%"
+	.ascii	"\270\t\276\316\0346'\340\200\235@8a\"\334\2358\316\037\034\261"
+	.ascii	"1\234\2622\224\317\022\234\227<\005.\337\003\325E\302\225[\001"
+	.ascii	"\326\bh\223\237O6)\270z\361r\036\316};\234\207\263\331\351\003"
+	.ascii	"\243x\362\234=8gh8jj(\237;\274\223\314Rx\\:\335\f\200\227\243"
+	.ascii	"M\316\001\235\224\232\016$\270\016-N\202s\321\231c\323<\2218"
+	.ascii	"km8oo(\237-\336IFq%m\017ik\204+W\004\225\020N-?\013A\250^\270"
+	.ascii	"v9P\227\347\360^\302\3419\234q8\373PJ>\247E\250\177\\\273\374"
+	.ascii	"\324\362F\362\231\305\t\021\212\235\024\244d7\215\344x\236S\364"
+	.ascii	"C\216'\005C\365\220\343y\016\024\221\034\317\262\r h\3470\357"
+	.ascii	"\240\262\206d\376\361<\247\2060\202\033>\2023N\334\r\277\331"
+	.ascii	"\021\301\0379\342\005\204+7&\317\003t\353ga\315"
+	.string	"r\"\313,}\300L\002Z\001\217n=\375\032R\326U<\020\301Cp\021pP\203\340\2738\\p\350\232\177BpT\371\266\254X\365\352\036\216\035\016\036\216\036\216\036\312'\b~t\n\\^1!\346e\345\004\t=\276\034\"!\277td)\307\363\234s\275\222\374\202\034\022\303\016\256\254v\374\201\367\027\306\321\036\370.\216\037\016`\363\317\007\316\303{\340\234\310\030\214\371$\002\376<\374\366O\027\235n\326\365J2\f@r\210pp\345\332@;p^\302\361\322\201s\"\2170;\322D.\371\034\232\302\r\316'?\237l\244\340\372W\225\270\376\235\005\231\211\222\302(\023\177?\237<\245\023b\327\203\224\344\300\006\316\001\301\312%\nq\213\226\r05\220\201k"
+	.string	"\003\317\300`\205k:|s\303"
+	.string	"\335\005,\360\013T\340\026`\3265\262\"\206Y\324*0G\201\t\234\002\206\025\013\231R\341\331\225\t\314I \002\227"
+	.string	"\004\036\2013b-;\372\020\2614v\310$\033\203"
+	.string	"\363\001\016\370\003p\232\225\n!a\330\024\007\234\2618\3055\200\001o\300\231/\247~\035\223\"\226\306\002\007wg \325(G\236\227\320B\367\244B9\372\3408\002\351@\371d\300Y\220O,Nppej\033\\\2711F\031\240@?\237\216)\270\372\035h\216\253\337\231\217c\3726g\b\021\r\374\216\002}\204\322\250L\001\275\200\030\366\030T\271^\314\\\031\323\n\334\322Z\300\031\313I\215\251\200\004\\\001\bx\002\206\352\362\312\313U\023\004\234\257\234\324\226\\:\007\260\341\0070\300m\340Q\227\034}\314<\031[\322EI\022\003\234\257\234\322\230\005 \300\013P\303\t"
+	.string	"\244RU\001NI\325\220\266\244\201\305i\230\341,\202\324\247\250?\247\246\031\316XNhL.\235nn\n-C\f\227a"
+	.string	"\217\341|\024R\225\307!3W\306\232\220\264\220\310\235\026\330ow\206R-rL\352\016\210\034\202ei!\221\310\027\226*\323\221\b\323Qy\004\345s"
+	.string	"g>>\261\234\320\226\\hP]\3042x\241- \253IG)\016\232\220H\035\376\331:\244\"\035\235\240\216RRaF\266z\220y\214\331\311H\226\\N#\002\340\312\235\301\302\240\310\343g\036\211\024\\\373\0164\364\332wN\204\342\266\323\205,w\030\004\245D\337\213<\216\001]\321`\017R\022\206\027\016\203\013\177a\251\0069R\265p\207D\356 \251E\307\345\212;$r\347G\005rT\262\205\362\351\302Y\217O6'\260M32\307\207A\013/\016\275\021[\364\326\036\307&\315\001\273\203\n\032?\254\240\361C\272;\250\210!\303\207\026.d\304"
+	.string	"\242\0049\334\320\301\356\240\"F\213\034^\270\b\001\016?\254\300!\203\335AE\214\0273~h\021c\305\006\273\203\212\030;\310\270\301\305\n\037^\270p\361\002\007\rd\370\320\302\205\017:\360\320\003\001^\374PC\007\0212|"
+	.string	"\342\005\016'\215\027\005\310\241\205\t|\340\241\207\030\032/Fp\034\330\207\026\016h\341\342\006\037`x\340\026=\334\200C\2143\207\027\017\220\261\203\016<\364@\202\nb\310\340\241"
+	.string	":\334\320\003\t\2122|"
+	.string	"\342\205\001Z\310\2501\202\230\030:\334\320\003\002Z\3640\202\033b\360`\203\016>\360\340\342\207\033F\310hQ\201\030\013h\341\202\007\013\264\220q\203\r8\310\370\301\002\0319t\016>\334\340\302\305\013\003\344\320B\306\017/Np\002 b\370"
+	.ascii	"\304\b\0311r\270\004*\360\200\034\\\340\200.\016*N\020\303\305"
+	.ascii	"\212\023\304p\261\302\007\036np\261\002\207\037b\254PAb_\234"
+	.ascii	"\240\305\017+d\274x\361\303\212\231\335]/\035~\221\345/.\316"
+	.ascii	"u\335\371\224\375P\355\230\3078\346\017q\351S\006\203\331\006"
+	.ascii	"Z\361\352\335aP"
+	.string	"\322yr+\336\353\335\371\213K\340z\203b\007f\244S\221H$2\306\211\276\376\220\266\376\236tS\360\t\r\352\007\246\322U\205\200r9\215\b#FO\235\340\312]\273\272W\273eS\035\337\352\316F\\hK\272\271W\272\2549&\227-\257\\\266\266`Yj\221{\325\322%\307\214\203{\215s\002W\266|s{}\203\322T0\334\316E\\d\265\255\262\275\266\275i|5Ue;\033q\221\275\270r\355\274\324UM\265\366\246\342\021a\205M\344v\030E!\022\271\234F\364\341\312\355 \250+\261\207\232\303\306\262..\023\304X\341S\347@\233E\3475\313\321#wv.\256\354\341E\252\332\177\200\222\347\326L\306b4\302\2124\304h\2145\377T\2653\336 \242\334NM#\362\232v\036\343\030%hE\373ID\004\225\210*\032e\313QK\303\214\306\331\031\312gE\273\n[\210\247\342.\353\022b\376\231"
+	.string	"K={\305B\003MD\224\b\250\263s\222-\262\345\225j\366z\205\206\232\210&\021FD\034\241\261F\243\215\006\2157\224\317jv\266\332\002\253Vj\331\253\025\032q\"\230xD,\3252\256\255\257e\037o\r%\270r\227l\354\225\214\206\026\021I3\352\306D\f\251\202(F\345U\214\006\027\021F3\366\250\210(\n;[i\0352\247\200\275N\241A'\302\307\214.`\"xH9[i}\371\212\362\372E\303N\204\320\f\302(\"v@9[i\tz\341\222\343y\316\223\352\344\365I\365zur\306\023\361CC\017\351u\243\213\311\265\365\312\305'\202\247gKDR\213/\013\3535\213\206\237\bd\016\254\304e\335U\223\327+\032\200!\f\211\2320\255\316VZqL\226\2742\241\341%\304\227\242%\201J>\243\204.\020i+\t\222\327$\202!"
+	.ascii	"\221\220<\206\313\257*\215j\352\225j0\304^\221\033\300\342\324"
+	.ascii	"c\270\362\244\230Q\025\3525*\204]\335\023\324\334\023\332\322"
+	.ascii	"\2516\275:\205\320\"W\325\004w\204YT\215T\345\253\221\020m0X"
+	.ascii	"hZ\032\314\020l8AV7\200'\334)\317\202\323\225,E\316VZX\230\226"
+	.ascii	"^\231h\030\206@\323\272\001,.=\346\214\310\331J\253l\251\224"
+	.ascii	"\364\252d\345\3706C\2102\262'I\237\241\n\022\331r\310\321\353"
+	.ascii	"\220\260\343\033\213\246\023BL\001\233rt\026N_B\230FA^\215\020"
+	.ascii	"C<9\276\315`B\b'7z+\334\205\360\n\202\354\006PES\220\317\200"
+	.ascii	"\307Ut\276\322"
+	.string	"\032\003\362\343\025\b\215f\210,,?\226>\300\226=x\274\366\310\ta\305\306c\t\321\331J+\nsH\350u(\031\002\211\234\020UP\342\016\035\257;xBD\301\b\242\256\352\b\361Ts\234\255\262\006+\320\177^\201|B\034\201\021\304^\375QV\034g\253\254/i\365F\365y\275\201#\004\221 \272T\237\020I\265G\360\212\\\345\251;\257<@!\204\004AXw\202\324d`\325y\315y\325\321\021\342\307\361-\210\304\232\323\243\"\317WY~\314\"\277f\342\337\f\n!\004c'1\304\016\304\263UV\037\263\350\320\360?\034\n\001\364c\030\002G\341\371*\253o\311$\374\231<B\364\b\021\206\330\031<_e\361-\361\363\363\373\"\370\177\3611\203\370C\3200\320\316\317\310\317\317/\314\217\207\034\243\360\033\222\343\341^\336\345\367\002d\306\013\214\243.\200\200g\253\25477+}\\}I\372\252\372("
+	.ascii	"\224\373\363\373\377\202\314\330\035\337\226\374\350\372\316"
+	.ascii	"WX\207K\276\275\237O\310\314\226\343[\323\236\234\336\371\nk"
+	.ascii	"\220Y\224\207\367\347"
+	.ascii	"\r\231ys\303\033\274\263\373\357\222f\326\262\330}\251\243\373"
+	.ascii	"\353\210\314\240\301\260\242;\233;[a\t2\213\270l\371\2710\315"
+	.ascii	"X9\276im!\323r\276\302\nd\026\311\305\375r\312\0311*q\347#\254"
+	.ascii	"@\270\267\037\356\310\f\230\224\267\363\021\226\037\223\313\255"
+	.ascii	"\355ws\232\201\362\244\315o\311\266\366\263uq\255\235\221\260"
+	.ascii	"\372\364\262\250\375Y\240f\260\216\311\245\332\371\b\213\217"
+	.ascii	"\311\225\206\366\247I\315X\301HC[\202\345l\205\305\267,:\273"
+	.ascii	"\362\237Q\315 \251\272bf\3457C2#\025ee\257\214\354/S2\3434Gv"
+	.ascii	"d\314\256\212\330_\205\311L\221<\261%*\347+,\273eQ\330\224?\254"
+	.ascii	"\311L\022\322\024&\027\230\224\037l9#\304H\312\031\t\253n\311"
+	.ascii	"\365\025\345\377\312"
+	.string	"\232\001B\030\305\007\024f\321\237\334\311\377\244\306\326\f\021*\204F\342\r\340\235<fF\350^\347+,\272e\327\271\376\256o\375\\]3:n\222r|\353\bk\216y\307[\303\016\373\204\027\r\325\312\372\265\234\314\370\314\360\314\364\324\200\362U\003\f\f\345\363Y\347*,\270%\326\362\307\n\233\321\231\311Y\236\217\260\336\226Wo\362_\335\352or\026\223I<\016A\264b2Y\3623\031\223)\274Ib.9#a\271-\225$\371\225\224\311|\021L\302DR\365#\251a&\323\005\260\352|\204\245F5\365S\365\361M\235\217\260\322\230RQ\277\324\231L\036\336]\324\371\n+-E^\232\034\317s\240\236~\250\032h2s\\\236\316UXhNM\277\223\232\214\334M\222\212\273\270\032q&4\3015\235\261\260\2600\217\030\371\217\254\311\264\261\255\031\301\262T\026\371\225m2i\307\244\212\032o2h5\342\002"
+	.string	"\363#\203\345E\316WXeL_\372\231jh\2211\223)\223\261R\203K\r\272\032v5\354P>\277t6\302*[\3465]\336R.\247\021u\270r)\330\352iq\002\236\206,\213+\207\363\357g\316\201\226\210\322OD\214\212\0223\t\351O\002\223R\203Y<\322\031\013\353k\310\321?\004\312\223\037\235\217\260\2420/\004\206\311/\344-\305\004\275\321a\230\034\250wk\350\325\340k\376\271\321of\327\224K>'\310\213\376 ~2ZX2Y5"
+	.ascii	"\327K\rAA\224\317\027\235\223,\017\355\340~\344\374?\216\036"
+	.ascii	"A\032$\201\325\022\031&\013\370\031\313\300e\213\032\2032I\252"
+	.ascii	"d\220\324`\256\320\204D\"k\030\326@\244\200k4Q>\317\277\317X"
+	.ascii	"\362\345p%\314\036\337\307\217\267\323\20592SQ2R5I\236\032\037"
+	.ascii	"\037\037o)\256\205\313=$\034\256\334\355\301\343\357\201C\306"
+	.ascii	"\251\211\307"
+	.string	"\331jI\267$\032\372\211\200d\224E\206\230BA\277\220\016\031\"J\017:_-\347\226\337\241\343\337\021$3\344\230\024\"sT3\304\243\306\207\017\035W\3138!\2745\214\340\312\335\034@\177\016 2E@\200\230?8\376\237 2=x\3408[-\337\2267\356\363\337\020\"#t\223$\263C&\250fHR\r\021\"(\237\367Y\2721\213xk\270\201\251\256-\216\233\214\211\227\b\256\334\3559\317\337\243\224\371\301q\236\363\222e\025\346w\222\377\316y\254\346\310\223\377Z\035\022\271\244\316s~\235\032\247\347\374fuIr\311\347\324\035\311\035\331\374\221P291M\031d\215\024U\r\022$(\237\335</YJa\232\020V\027D\216Q\324\371\220\013A]\3270\251i\302\245\231F\226\004\002\017\234S?\2374\220\202O\344\211\374\300\211\3749\365\021\312&\230\007\022\021\337\211\205L\302ADC\303@/]"
+	.string	"\013\317\204WQ\b\007\337\204}|{z\203M\301\300\267\340\235]\035]\007\236\t\251\232\335e\313\013\026wZ\344\342\272$\236l\375\024s\204\373\357'\233[\215\030\2136\266\265\277\304\016p\200o\217/\r\210\304\030\264;,5f.4\235\355\275\237\030\001GT\207\033\270r\267f\240&\376@\016\224w \357\274\267\021F\2002\261\251\001\f\234H\336M\314>\200\020\247\030\231\202k\363@[1P\021\337F\230{\210!\"1r\031\006Z\023\233\357&\016@\222&T\006\256\334nb\006\002\204Hv\201\263\352[-P\023_\021\017\324\374\211\344#\224\211j\030\310\341\232\370\263\3523_\211v\027\300\273\303{\005\306j\304X\312\0352\246J\315\030\1775\211\325\230\265pG\345\356\335\304\b0\242\022\264"
+	.ascii	"\005`\352~>\315H\301\365\360\360\315\3041}\0258<L\335G(\017\355"
+	.ascii	"(p\345\256]\335\333n\031#\345+\n\224:&\335\334\233.+\306\253"
+	.ascii	"\213kk\256o\311e\313\233\313V\f\326\362\252\311\026-Z\316|]1"
+	.ascii	"K\216I\026MJj\306d\270KRc\246\242\t\211\334\231\220\212o\031"
+	.ascii	"G\370\216{3\221\2006\334OB'1R/X\334E\325\214\315\320\004Uc\246"
+	.ascii	"\342\356\t\356\\H\265\307\374\322LM\320~{\1771R#\306BY3&C\221"
+	.ascii	"\0323\025LogB\252\275\t !\277\304%\2401\215H\240\335\316KP\362"
+	.ascii	"\340\272\333\276[\363U\003\326\374\323n\277@MX\214R\215\030\203"
+	.ascii	"5!\221;=1I5c\374u\207D\356\324\224\305 \325\230\271\020s\024"
+	.ascii	"3\244\346\f\255FM\r\345\263\333\336L\214\200#\252:f\004>\307"
+	.ascii	"\033cT\263\026\023\244\246"
+	.string	"-\246K\350\f\002W\356\262\261\325\274\305\370\210\351\261F\005\267l'\2745<\240\0010f?\237\202H\301\325\320\360\235\245\325\336Yb\210b\206\324\336I\0160<\214\3319\240+\364KC{\247\235\371\316>,o\264\f\316\336X\316^\351\342b\200\216I\276`\013\242\326\322\017\216\276r\364\210J\215\331m\345]\243%\246\347\230\254\200\b\361\212\310\356\214\0331<5\\*\t@\3010\274\230d\314N\r\235]\r\236\236\225w\022\237]\250\324\032p\345n\031\331\273\214/\006\331$\3032V\345=\346W<\274I2\254r\266\242\302\262\024\243\362\026\003,\022\036\223\203T\316K\250\312\230aS\336a^\212\2017I^\246\234\255\250\312\226`R\336`\202\305??)\347%Td\314\257\257\232\301\342^^Q\257\206YcX\203X\203\030e\t\025\331r\215\001W\356By\362\206R\323,\332\325=9\027Q\201\315"
+	.string	"*\021\376\361<\307\211\327\333INq\213\026/f\027\327\273+Y\204{\343\032\\ni\275\267x\212lkZ\314,\254w\226O1\r\r\353\313ry\365^\342(^1\273\022l\322\004\250H6f\305d\262\344\315\344<\246\243H%l\311\271h*PK\216\3479YXr<\317\311\272\222\343y\216\222$o%0wH\336I\3162||C\273\352\215\344\334\223$\331\315m\252w\325\001\300\027Tt\342Eu6\232\262[NI\275\247\206\212[ZR\314(\250w\024\217\342\362\230\274\202:\027M\325=9\275\237|\024\231,q\242k:\362n\002RDRu\344l4E\2674b$HQ\352\230\214R\236\213\246\346\230E\230\336\001\212\353\250D#\327\311\013\017t\231\024\246\240B\n\325@\303"
+	.string	"\022\343\031"
+	.string	"\b\005\3424\217[\351\356\024"
+	.string	"\017IlHzf@\242\022\323@C\0019\332\300\f"
+	.ascii	"&\t\343\tX\273\237\346;\322\022\n\340\272?T-\232\277\302\230"
+	.ascii	"\364\363\264\353\2310\031m\004\307$k\243\331\0049>\371N\034\314"
+	.string	"j\200\031\207\342cB\254\240\334\263\354\351h\235N\004j\216\324\214\2215\222\034q\300\007*\264\007\200xAb\302\300\034\223\027\370BA\023\n\342\344\336& \365\215sp\007\272\200\032r\374\234"
+	.string	"\330\361\314'\213\3517<7\264\3173\376\211\371jW?9$w\254Yp\375R\032\275\022\2167\200\022\231\350\363\220\n5\207\211\263KkX\352qD\224\315\266\211\247\361\026H\253\3706g\016%GY\330\026\257\362\"V-\214F\234\271\212C\013+\272r:\201\270\263"
+	.ascii	"\216\254\312t\205.,X \215\202^\002\021\251\300\fWzD|\3678\232"
+	.ascii	"\031\214\016!-\362\313_b\224@\361\032\361T\320\370\315\252\327"
+	.ascii	"\016[$;JM\3343\207\031D\020P5l\317\225\267\013N\230\203`\303"
+	.ascii	"\255\305\b\225T^\352\027\365\373q\210dg"
+	.string	"Z\n\317\006\274\340M\024\272uR.\256\374\020\005\252l\006\361\353-+(:\027j\320\341f:\3473\351\322\303\277\215\304\235)}3\327\323\317n^\204Rn\201\212.-~s2\035\356\351\303\247\031\265\025\034\352\303f^1xE$Fo%\032D9\276jV\256\002 \357\370\020\303\032\372V\250|D\236\321\210UX\243{\350\205\372\334\2653\037\340\013\246\003E\215\271'\036\036\r$L$+\017;\355\235\252\303\036\0232{\240\302L\252\376\244+r\217\303C|\347\342Ed9R\373\263\230\257\361\001)se\242\210\212\"\271*\254\340\027n\346\371\004\n\223\365\026\3320e\305\020\372\304\312\247\020&6\360\207\222\350\211\336&5\350\216\223C\001\0345\215\211\234&\360\230\311b\202\255\007\331\037~\210\206\016\207\370\030\317\327\214\361\374h ' R\2220\2463\345\200}\240\001\317n\250\2341\216@\346\226\207"
+	.string	"\034\027X[\021\345\177\364\250\b\332\226\031DjDH:\003\3075\377/\226\343\n\244\303\023\224\231u\357d\212\224\333\251N\nD\241\332\036\336\355_\264\032\025\030O\274ph\317\016\002\3324\034\240\272P]"
+	.string	"\001o5\013OM`\356\370\215~A\236\234\216\261\211\212\006\202\2064\301\2035\030\347\337\226&I\222\201\236\226\230\027\254\256!\261\213\331\227\206\316\223\305\230d\rb\346WO7\225\272\341\224\224\036\276#\274I, Pk\f\2618\310g\207"
+	.ascii	"\342\215\207\255\3121\217+|f(\321\271\346\023\255\222l\370\233"
+	.ascii	"\211\306\270\312\250\304\237E\325\035\331\322s&\311\032\235"
+	.string	"lH)\b \021\245\350\252\251\002}n\205\363E\257\240a\344\"\bUF\306\345\234\323?\342\016o\017\374\346\226\275\244\264gg?K\247)\213k\361/\247A\214\306?\302\2054(e\026\332i\\3^^\3475\022\037z\227\272\245+ciM\302\220g\260\025\214\303\261/|\260$\212L7\321\354t\265\233|\363\363=E\001\223}\271bs\016\236\364\345\355\310\004RIk\332\356\205\251&\257\0371\273\264E\026\276\340-\264\300m4\275\255\377v\360\342\217\367\243\241!t\273\022a\231\266O)z\223X]\322:\357\307`\351o\013;\242\030m\272i\214\242\210x\261\222`\b2\274\2778\227.FN\032;\273\210\340h\340\341H7\277\212\275\003S0\355\rl\215\242t\315th\221\264[\325Y\271\013\001\3645.2\365\374d\274,\2411oDk\317)\350\243\221\034@yF\203^S\303M\352Hh\344"
+	.string	"Z\243M0\260\342e\313)\362\275\005\200\330\242\f\f\005\265Y\366\352,T/\265\f\3349\320\023\241>\274\006\324\367\r\340\332Y\215?\336\261\262?bDs\343eM4\177\032\rBq9#\026\247\226\3045\370\357\266W\237r\266\206\215(\367\025\334;\240j@\367\373\204\332\032{\031\343D"
+	.string	"\313\334\370]\374\230L\331R\026\265I\374r\016\036\312\032\353W\223\244\315\235\223+\001\331\364\002w\311P\217J\372\317k\203h\032-\230\332\366\021\314\260\001\341\301\275\312s\377\2163{e\352\001\004\336X\235u&&\343\342\201\306\307\370\332\236\357a\004\022\351-\330\301\030\322\220\274$\025\354\b$\231\0234\227M\0368dS\354&8\227\364\373\373\016\214^\312\221\252\271\243\342\\c\246\337\316q\b\226\270\231\353\232\350\333\031<\266\222\tj\001\260\3559\0249W2\235\261h\213@\370\305p\231D\201\244\306\244J\225\266\313\242S\231g\022-\252\231D\220\246l\305\037\027\"\306\3245\203f{\244\t\233r\356V\251\245\232KN\312z\013\237\227\003\033\3501\202\352\356=\rJ]\226\314\\\244\344\370\222\215\031+"
+	.string	")\200\n=\354;\255\021\350#k\353\362\277\273Z\370\347\255\3055"
+	.string	""
+	.string	"G\275"
+	.string	"\332\226$\t1\205\264\025\031\006\370\234\3416H\317\326\r\261\353\234\223dU\274G!\026\260\221\213\334f\375\253V\002\021E!\343\257\023\211tc\254\217SH\370SnQ\246\274r\317m5a\215+Ch\261\257N\232\002\016)m5F\022\002/\306\025\220\035\377\353S6>x\006Uc9\033r'\230\243\2155u\340\362I\246/e\342\350N\327\031\243n\262n\3665\207(\313\034\256\026\247\344%\266'i\"\353\220\215\036V\274\230\350\333\376-\320l\\C\253\313.\242\2520\303lbX\351\210\260\220\260\300\251)\334\265\371\276k\361\271\247$I[\361\275\303\0239\304'\006b\344:>1\2151\217\204\245e<\351\235\222\376Ia\222\320\2774c9J\337\255\246A\317]4\246R;v\213b0k#\013\323\224\0275D\303(m\246\234V%\330\206\322\342\357Z\315\344\036\003\217u\305"
+	.string	"\270u\370%n\337Ita\024Y\206\375X\210\355\027\202\023\322[\257\253="
+	.string	"\020\262\353\326\252m\222\314B\340:8\227[\177\276\356\2741\223!\252\032\311\214\277LB\274\312XuQ\253\215y\214VQ\t(\227\037G\311\343\007\253"
+	.ascii	"\024\240\242"
+	.string	"\316\024\271\322\220\212lce\233\214\306\355\\q\037\364\224\351\220\2575\300R}\224\224\001\005\245O\276&&\230\334\257\300\251\225\b\315\327t\016wHX}\317\244\341\253\223aE\330\200TuFpj\306\351c\352\2727b\375 #lH\341<\351R\017\311\315\2651\305\262\314\037\321\355\304}\005P\257-\013\235r\016\210F\n\254\310\257\306\016pm9\005orp\251E\227d\325wX\005\206\221Ya.\242RG\t\004\202\002\327u\316`<\372n\337\313\002P\351>]a3x\2268\231!\024\331\213\376\0227Rw\300i^!\340..\213Z \"\335/l\227\270\245S\2539\363\r6\023\226\232\034\214*\\\225\301\243\344\202\020d0\351\374\002-\226\013\326\216\301\204\345,\327j\230\031\277\224\302v\032\301\030:I&\351\233\013U\026>o\327/]U\026\313\215\355O\214o\340\270\247W\316T[f\n\033"
+	.string	"\2321\221\367M\214\340d4<\f3\262\243_P~\2469\017\217v\226b\273Q\f\177\017\005\037\370\276\357\323\370Y\306U;=\303\200Al\322\214\357:K\222.\323G\203Q\371^\210\302\366\331\313\361\253\2656\362\217sG\200\253\016{e\357\325\"ny\335_/\217\017`\344^\357]ZK\254#\3263\3778\326\245\260j%o8n\370|M\347\346\026`w&"
+	.ascii	"\321\350\2626\247f\301ZB\317\032gP\030\301OR\365\274h\r<\340"
+	.ascii	"\202H\330\246\254\341\033\337\361"
+	.ascii	"\352\031\250l\376\bq\231\303{\260X5\n\225bR\023a%g\267\224\025"
+	.ascii	"C\254[\346\217\374\026\201\027\342!{\037\214RV\335\253\362mO"
+	.ascii	"p\230\324\332\033\025"
+	.string	"{\232\024s\236f\355\203\227\352M\305\241\371\311&Qx\307\300_%\305\312G\335\230\344K\224\231v\rJ\t%p\356kQ+\2413\345T\375(d\233\n\035\323\344\260uv\2444 \n\367\207-\217+j\314&\256%\312o\263i\277>/\225\365 MB\016\230`g'\224y@z^\013\021-.\220\023\245a\247f\353\303\204~i\355\203d\2051\325L0\301\3679!\006^\334C24\242T\351\366 a\373\374\363\270\347\202'\r\022D~\333\270q=\340\006\315\317\353\203x&\212\231\276\246]%\251\002\355\330\303\254K\261\252!\225\250y\201N\2606\250y\227a\322\013X8\343V\302}/\315\351\337\376B\375S\265N\031#\233\370\213^\323\272\323\020\234\021\210\330\354\267\340#\372\3409\304\315\241\367\330sf\2121]q\312Y\234\222\t\244\302\362\210\252\001\254c+\364\016\324g\340\372\034C/$\226"
+	.string	"H/,\202\030\274Q`\t(\272>\236\255!\f\325\357\322\026\016"
+	.ascii	"K\363\307\231\275*Da7\375\240idC\226a`\327\023 a)e\030)w\255"
+	.ascii	"=\300\327YO*\253\363H\303wE.'\341D\370\225*\217\025+P=\346\227"
+	.ascii	"\rT~G\306\240\211\017\321\360}\031\304\315\274\363Y`]\350`\037"
+	.ascii	"\370\342BJ3;\306\037\256M{\313\036W/\016\254Vp\336\300\316\177"
+	.ascii	"$\252Y\310\034\343\033m\034&\342\201\212B\244@\340G\374\242l"
+	.ascii	"{q\203s\013J\204|\351B\371\321\003\260;a\243,i\264\245~\373 "
+	.ascii	"\3100\216]W\212\343@\363\265\240\237\177_\341\240*\220\030\320"
+	.ascii	"\\\325P\377\321\222jL\313\021\224+\317\n\261L>|I\327p\227\226"
+	.ascii	"\351\313\221\363@T\bS\216\376V\013\356v\004\206\b\034\273\334"
+	.ascii	"kT\352\353\302(\023\370?C\373\267\304m\035\307\037\255Jds\206"
+	.ascii	"\377%\371z?\234\032\230G\177*('y\364s\320\374\230c\267\021\210"
+	.ascii	"\344\006\364\363\260\261D\333R\2221\003\370kl\306\352\026\263"
+	.ascii	"\363\032\031_\017\311j,\352\f\234\375\034\006\315\n\013\211\234"
+	.ascii	"\203\032\247\355d\253\312\202J\022U\016\267j\310/\375\210\325"
+	.ascii	"GC\273+q\017\321\217~o?\001J\370@\032~\354\201\"\2505c.\256f"
+	.ascii	"\2522\307\264s\254\216mH\004\326\341W\005x\304M*`\024\324\212"
+	.ascii	"6\206\302\364]\230\236y\007\325o\340\300\364K\232\306\374&\242"
+	.ascii	".\3332\216\345\365;\006\252\341<\342\337\214\263\346cA\003W\301"
+	.ascii	"\203\331\334[\007\030\374\363&\260KG\266v6\3358l\3311\366\351"
+	.ascii	"\227J\005\241\350\253Y`\331\211=\325\036]#\250\f\302\304\005"
+	.ascii	"\214w\336v\354?\306\301\212g\031\335\316~"
+	.string	"\226zA\364\013\276\f\302u'\274tQ\201G\304\317<\234\332\223\322[P\331\351k\373\375k;{l)\bmx\371\322\343G\356\304|t\020\326\277\315\377G\332d\036\377T\224\300b\262\262n\320\355j\003 \337,\337\255\3032\345W\330f\214\027J\231\371\226\007DQg\013\322)\f2\307\202\354\333Y\313\r\023\343t0\002\241\300\266j\244E\375\023\270\032\270P\314\373j\270\251&aX\275}\273~\213E\336\343\234B\026\306#\022~\023\003\027\277\035\3554>>\307\240(\262W\305\b7\216\0135\023\210\303`\022j\337\273ILP\023\373\320_\324\341\352\302\202sd\204\343\302i\242[\263\226`\002y\033\223\303\036\376\026\300\256=k\315H\251\331\fJ0q\213\025\026\245)\036\273\347|V.\304\013X'=\236\225\341\344\305'>akT\227\031\330\262\240\243\001\253\273X\352\343\216_P?wI\0309"
+	.string	"\327B\200\210\017BH\032H\326\331\242P\232\227\321\264\003[\001\322\021\372\212\006\031g\303\006Z\244\262\200\005\254\214\365j\353\226\264U\316\352\301<\242\255\377\202\303\225\003\030\326N\215m\255\267\214L"
+	.string	"\314\204\035\342RD\242\314K)\031\324\237>\364\222\257\353=SZ\242\202\331S\210pE|m\275\032\224c\346\017y\375\020\324\201\222%\225C\020A\321 \223\217\242\227\264\231\307\242\373\366\356\037Z\255\246\264\274\302\355U\242\021\2146\370\267\030\".\006Y\377\221\233/!\007\3345V\2475\243\306\3157\356\365\020\342h=G\355\017b\242\242b8\204"
+	.string	"\272-\b\342)0\262y\003u<\320\333x\336\313\262\nV(\222X\320e\312%fA\370\213\303yS!\372\373\261W\tz\233p\252\027H\355\270X\22672\204\350"
+	.ascii	"\332sI\333\373\316H\204x\255>B,\241\340\372\351\007dZ\\\251="
+	.ascii	"G\366\225\265+RA\213\006\003\311\310\217W\213\365\224]\344\030"
+	.ascii	"\336}Z\367\343\2129\234A-\347~\027\314\034h\302\213@\370 U\341"
+	.ascii	"\261\334?s\361I\fKIQl\264\305P\304\036\321B\017\"1\351aW\032"
+	.ascii	">\255\346\261\327\211{\305\003\201\031\003\226\375\277\371\364"
+	.ascii	"HR|\242\220\265\003\2117B@a\007\212\204\232q\016\204\354\374"
+	.ascii	"\357f\302\312\323\3247\241y\274\301\030I\277\373`^B<Ibx\370"
+	.string	"\356e\024\201\261\226\322\007\246L\360)\3307\222\305\367\034\303Hs\323F@\311TJM\032\267\202\337'\325\261\365\305(\177)\234\264\365\203\241\020/\307\265\272\321\302\006OjU\231o\247\021\013Q\277\354fZv\334\344\352>g\364\021\365\247X\213\343l\373\003\215j\360$#k\006\244w\320C\032\326\335\237\252\231x\342\351\016\300\231\030\2211\021\271i\253\002\f\034R\b\206Vs\247\262\0130T\341\351\346P\343\223\262\033\325j\034s\315\313\"Hqz\362\251\"y\333\367\031!\257E\313T\242\255+\350C\260\300\254\214P\330U\262\b\357\001\331^\307$]t\265\322\273Z\317\247\037?\361Z'Y\002\243\313\033Rh[\241\270)bj\034\245\3669\007J\201y\033D,\227\350\255f\221z\360\227V\313\t\220\233\3133\205D\355\216E\201I\336\321\260\241o/hn\214\272\207\270\332\037\333\340\266Ya\331\001q"
+	.string	"\256A!UC\260n/5\002\306\206\":^\215\365\364\363.\323\211U~\327fJ\261\206\3201\341\360\036X\207\232J\252\273L\324R\316\373t\214I]/\275\213\375=\254\250\236\235\256j\035\\K\255;E\275\265\303\277m\304\3605U\222~\251L0_\001&7\265\252\340\217sn\251A\300\\\332de\3231\222|\313<\007)\331+a\200\017o\314\260\260\324\276p\013\355j\013\243\305_\213\224x\236`\347A\202\022\002\322\004\265\360\321x\243~\312\320\320\366\322\232#\200T\023\3170\276\231\367\233\370&\343\343\275\017d\205\207\223\n\007]\2675\256;5t\344\323=\375\250m\217@\221\033\356\nil$\221aJo:d\033\354\250x\334\034\334\350\336=\306\310\004V\r\261\021\310c\343\374\016\020"
+	.string	"p\362I\352_/\317\006\302\334\324J!:V\200#O\027Yj\361|X\036\211\211\317e\235\234\002\331N\336\201\334\204\340\302\346P8t\2419\206\017\254\b\001\037\342\214\240\215s\037\226mxok]\324\307\213/\333\031\240\306 $E\004\372\270%\266\230\313>,`\234\253\231"
+	.ascii	")G\266\2340y\237R\3723a\027"
+	.string	"\006\353K\370\351w\023\351~\300\212\253\r\242%'\2230c\237j\177\204\303\276\310?\261\020\023\336M\003\3154\027\207\033\355\256O_P\3264\017F\374\223\r'n\353\343 \366~\237\036\023\306{\255\351\275\356_\226\3373\373\205I\347\247H(\363\fB\345\345(b[\2509\226,c\357\324\n\364\276\232\005\216\333\314NO\200\r\364\327\007\217(6\262\264\211\021P\243\037\n\204\354k\321\373\326\333\241\316<\325tG\331\026\204\033w\302\024\266\227\347\025\335\233o\226X+\204\345\262\372\342\352A\361FoZ\313\200p\310\206\200\221\342\245g\033H\226k\023\271|\373\243"
+	.string	"\034\306\031\323\331JyU\304\3333a\227\020^\231^&\357bM\216\241&\006\2404\211\203\207\212d\231?\376\277\221\202f\344\377`N\303\017h\034\317U5\354O\226\324\373f\373\206'\234\020\342@\216\321|\343+\036\273(\2703\002\231\330\276\374\004i\300ff[\233J\226\0214\253g\004\346\037&\266\355\330\344\350Y]a\363Z\363^\263"
+	.ascii	"j\022\324\360\331Q\312[\023u\236a\323\201`a)'\337\201\217\f\277"
+	.ascii	"M\340\343\237f\036\232\270\331I\023\275\334\361\234\240\376l"
+	.ascii	"\336\234~\300k\210(\375\357hD\303\232\207\325\265\205~\301\366"
+	.ascii	"\316Q\322\275\032&\351\257\257cV&V7gM \330eM{\274$\350\204F\365"
+	.ascii	"\330\243_X\210\244\320\246\222\342\366j|u;\fe\372\320g\273\205"
+	.ascii	"\260r\266\226eQt*\360\206\243b\201w.p\2677\347\363\354\344\346"
+	.ascii	"\313\357\254\"\3302N\177r\274\314+?//\030\221N\274\327)YC\365"
+	.ascii	"\244\273(\345\276\177"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommandWithArg.188.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`\365\022\375^"
+	.string	"\312\237\254#M0\220\322\031\016t\212\005\304\bO\240\372\345\240\377\013\347\331T\0317%\301\375\272F\317\r^\267\003\250K\005\373\266G\226\332\023\3557\030\206\330B0&\002\b\320\262\332\262T\037=\272\230\355\350=\346\020\303dD\034\362\323CD\310\2262\311-\002\361\001/\002\321U\214G\b\241\340\277nw.\357\362/\007\263\310\017W\200\002l\034O\3715l\255\001\303\224\b\340\272FI0z\331\273\257d\353M\b2]\003\\\327Uyw\245\324\344\260\256]mv\353\n\355 \313\265\330\370\226\253\344\272\267\036\215L\217"
+	.string	"\256+T\003\343\207\217\022\375\207X\227\245\256e\321\225\f)\205p\312\233\340\272F\241>\\\026\306\017oe\0279\334\265\261\213\334]b\225%\224\035\tL\36131|r(6\036\205\213(\271~\315\321\331\255kt\304\016\0205\252\321\313`\343Njpr\375\362*\022e\3740\311\313\374\270\021\324\344\372\005\344i\267\256\353\210e2~\350\3667\033\313T\001\326EV\2420\316\tEp]W)\245\007\021?T\377C\374\260\205|z5\372\355\260C\315<\210\017KJI\036\220\216:\030\025\021\r\t\005\001\375\370pH\366\360\354\350 \2179\306\"q\25063\367\315\203x\022\263{k\373P\345KJJ\240TX\251\312\024N\222\273\007\265\251\rN\227\357A\345T\243(`D\356\027\307H\322)o\203Gj\021Ll\355{\3207\365"
+	.ascii	"8\200Z\276\327\204;\264@\346v\243\275K \2440\352\366\"%P#L\244"
+	.ascii	"\266\023)^\276\007mS\025\200c\033r0l<D$;r\241\265\007\251Fgb"
+	.ascii	"r|\017\272\2466\351\001I\3632.0\020\230S\320Ghw\344?=\356\243"
+	.ascii	"\242\340rF\357{\320\"\352\213\360\360q0D\230\303RR\3751\263\302"
+	.ascii	"\367=\250\231\032\305\367\302\0165\356\361q\236\035u\201-z_\276"
+	.ascii	"\007\365\241F\235\251\351\250\013\020\341\363\373\036\224\005"
+	.ascii	"\365\205Y\331\225@{0\362\214\356KJ\240<\370\370.\272\347\250"
+	.ascii	"\205c"
+	.string	"\222\030\321\310\312^\374\036\264\354\212\223\211\247{\004B\322\b\276\r\242\221\231}x\034S\341\252*\0020\313\r<c`j\220\330\332\363V\3167\306\276\270\207\300\205\035\307\274v\020\217wD\356\216\006\245#r1\305\272\256\313\3171\262/\323w\371\311\356\006\331M6\003C\b\223\344\021;m\271\241~+bxXTe\223\350\033\273D\374+\027\270\030\241\266\256]\177\222h\024\275\373\"\003\376s\377G\310#/\254\233\352\260[\331EP\234\322.\236\356\317\006\034\360\237\335g\363\343\253\233\367i\022\370\247v\332B\235[go\016\315\027\303\331$+\320\2731\250\370O\356[\371\017\033B\263\274\257n\356\327\274\007\357\207 `\223\013M\b\256\225\351N\023\334\017\362\025\341D\003\3677\334\016,\347\206\335\033[\233\275\ro\276 Y\177\324\260\007t\363\037ka\025$\353\232f\257f\327\030\237\274\006\361\303\203\025\325"
+	.ascii	"\276\261\255?\326'4\273\273F\225\222\346\214\205um\376l\r?\327"
+	.ascii	"\247\017\021\350\323\375X\207\007\035\004t\262t7\332\344N\333"
+	.ascii	"=\327i){\262\035dW\345U\252\274V\257\362S\311\200\3613\337\027"
+	.ascii	"\025L\261\270\230\357\212\307\375*N\346\013\301\353\276\r\244"
+	.ascii	"\370\224\037\305\243\374\n yO\334\311\217\300\362\226Py\245T"
+	.ascii	"^\022\357\373\216\270\3367\nJ\204\312\373t\344\005\340\310\033"
+	.ascii	"\342^\276NH\336&\225\227\251\310\013B\345\375\200\344]\332\341"
+	.ascii	"U*\362&\025y=\350\360\"!y\217\212\274\035\212\274F*o\021\221"
+	.ascii	"\312;\264\303+T\344\r*\362\002\351\360\376\024y}\212\274\034"
+	.ascii	"\212\274I\225\267G\345\345Qyw\220\274:G\336\343\2217\347"
+	.string	"\310kD\362\026U^\"\222w\250\362\252H\336Vy\371x\337\177\240b:g\346I\241\\\367EW\261i\2345o\250\345\310\373\3763\277\336/\346'\363\327\375[\376\273\337\313\217\367\343\356\375\026\3317\3438\004G\264\207\231\375\f\213<\223\3651\277)\236\n{\213\324\333;\245\257\350:\206\224R\030]S\b\263\037\3632\213$\243T\327\262\265\373\b\277\274\261\235`\024\243Tj\006\r\3257\352\002\327~\030\307W\025z\213\350\033E\315m\346\320\024]\207\330\233\037\203\200W\207\202\246\232Il\360\fh\252\235\372\306\313\334'\250\202^\025HD\377B\234\344\"\272\202\356q\306)\3038\364\002\357\202\246z8'-2Wf\250\241z\252\037\206\204E\017\265\2173N\335\257$\256h\026\315\343\214#%\354L\250Wt_qJ\203\032\250\205\2728&\214\211\027O\221d\031\215A\375'C\342\244\370y\274\306\325d"
+	.string	"\020f\032\377\t\324Muo"
+	.string	"\007\001\243\230\307\376\274sy\336\2730\207\030U\024a\272\300T\244\205y\316n\356O\3572\217\274K\215\243g\033\b\372\247{\244\020\326\340\224rh\237~\036\013\341\002\342\302\204sR\013B\302\247s\342\272x\212\226\005\344\327\305\2043\301\2411\220#\323\026\007A\277\314\201\262H\3374\225\036A\274"
+	.ascii	"%a\037Y\306(\277\006\032\206\234\230A'Nv\262\037\206{p=w\231"
+	.ascii	"K\336\205"
+	.string	"\t\227\304\214\201\331\026\326M7\336\221e\300\262\0313\214\tW\200\032\027\361\303d\237\220\023\323\026G\342=\235\242\371J\330Y\222Q\364\264\232E:\306\200\2750D~\266<\347J]W\264\005~w,\271.m\200Nx\272Wa\313\022\037\236>\332\334\037O\037\314}\250H\275\274\371\2234\013\207Nc\3121\300\344\267LV\002\233\003<~Fz\372\006\373\236:\234\340\360xKv\332~I\244\352#\037|z6\230A\203\304;\022L\240\004\326\315\325\351\235\276S*\246\323\002\304I\007\313\272x\272%\007\234\236NS\022O\300\212+ds\323\305\323&8\266\033x\336D\215\331\316N\no^\230\373\363A3\"Dg\006\361\330C\2577Er\372\316\034\234\323wjQ\257$\026\333\330G!k\372\234o^<\335b/\203q\230rodWd\361\237YP\236m\212\335Y\b\263 \211\255E\354\377\021\312\321"
+	.ascii	"w\354\264\263\216\2638Or\210a\326\212V-\205eJ*\006\343\260\255"
+	.ascii	"\206EU\355_Y\302"
+	.string	"\346\247\373\003\313e\025\025\025\327\262\250\265\325\242J\004\253e\321\352-\\L\201PE\203X%\202\225\013\254\245\262\270l\341b*\204\030\312\242\0074\254\2520XVm\325\220\301Cc\002\343\026\227\005[U3\250b`\345hm\265\330\342\302\2421\301V\325\262Jk\207F\004\313e\025\325\225V\213\255\345U\013\254\2452\271\265\354\240\251\264\226\335\302\305T\007J*\"\325\262\352\001*\255eq\251H`-\225R4\254b(\245\250\264\226R$\202\366\n\253JKj\353\352JK\n\031]\337A\026\210\314\007\026.\341Lb\326\230\324Y\227\3633\211\247{N^a\r\316\272\035\346\231\304\022%\232\333k\377\367M\321\344B7\020K\377\f\342\325\214\215q\326)\311\350\247\215}q\326%\261\t\037\201\304O#\372\251\213CP\230~\210\022\362\373\371C\301\313SG\027\216\343\035:\305\215\240\233\234\036M\002\227L8"
+	.string	"}%2:D\003\320w\226\215\235\252C\264\bS\334x\365I\3412"
+	.ascii	"C}\227\311\203\331\203\377\224\321\r\006\210"
+	.string	"\233\022\022\361D\016\332\334\337\217Dl\352\023\275\354,\343\302\364\321\324E7Q\316$U\001b6\264C\254\005\017Ld\230\372~\367\251\2026\315ss-+\374\030\004D\372A`\351b+YNL \236\266H\343\234\301\305\035u\332\"\233\030\301\350!\232\"\250G\365\215\355\017\355"
+	.ascii	"\031\242\376\320]\370\2156\337l\002\365Z\350\020\365\250\206"
+	.ascii	"\321\337\373\220\211\\\032\257\276(gK%pQ\006\251=\333(\365R\367"
+	.ascii	"\fNiR{h\245&\006\2061\t\340/:\251\211\256\204\301\340\305S*\\"
+	.ascii	"Ij\004\250y\350$1B;>\276i\033R\007>\333\0345\322Q\2532Lc\310"
+	.ascii	"Cb\250\237\217e\340\002\n1]\222\007\326M>\216\343rR3\241\366"
+	.ascii	"\242?\303\201\364\246/\264[\n`\204FD\"z\325!\021M\344\304F\335"
+	.ascii	"\301\215\213\207\211-\213'\252\003\223,\036\277\002\374\214\372"
+	.ascii	"\204\\\337`\\\003\rC\226\021HmhF\312v\006W\244\b\252\221s\205"
+	.ascii	"4\314\221\371b8o348\241B\324i\233\243.p\315O\212^U\310)\201t"
+	.ascii	"\250q,\346\220b\206dDDDF\222$\0351\005\304 (\035\274\016\021"
+	.ascii	"@1D\214\311\214&\251Lk\343\302C\224\253\276\031\367`\330\220"
+	.ascii	"\244S$L\212\365V?"
+	.string	"\3510\310A\002\241\361\003r\326,\352|n\376\246\313g_T@\302S\247q\2148\206\2314\203\330\231r\266}\376\243\026\327\376L\330\004(\001\031\273\327\005E\220vJ\210\212\254\260\006I\345\306t\004\327\342\301\036$yRm\306\324\001\f\223O+\005\253\352\225\316\016\020]`B\366\231a\024\363\241FA_\256\215|\024\003\261\354im\b\232.R\220Oc\337\035\b\255\374\314(\344\263\3348\313\370\300m\234'\272\035m\311}\340\3450\337iL\203\361\177D\017R\277\006\314\263\271\342}\236\315O\347\241\317\307^\035\025\347=\247Di\344\225\232\222\242j\200\252\330\324\326\223\322\325\240\313\3673\314.\243D\325\017\004\"\202j\027\023>\301r\206\2238\244\262\344\301#\252CH\373*j8\221\223\347w\260\260\177w-\271\346\274\324s\204\353\337\366@\035\204,\031\230\023\264\351\342\330c\305\031@8w2\013\276"
+	.ascii	"!\235\336\256h\246\026\223\007\260\361%\026\225\240{\005w\237"
+	.ascii	"\344\r\337\274\240\375\343(3\032\305\275\202\377\244\022\220"
+	.ascii	"\270%9\361\260\330\031l8\205\007\267D\221R\022\242\006/D\b\216"
+	.ascii	"\262g\324N\\\352\317v\255\207R\320z\252\214\005\373N\n/\031\360"
+	.ascii	"r\220\252.a=\214S\231V`\365\035\325T\017:\276 \307^s\006\225"
+	.ascii	".\233\003\"\343}\022%^gT\\7\356M\246\317\"\320"
+	.string	"+\240\031\343\252\001\227\203\017\257\030\\\021\223\367\227\303\204\242\364e%\247\241\277\334\276\320p7\251}Xn\330\373-2\370\232\006W\217\363\376\361p\233\034*\335]\373\227\032\232>7h\323c\355u\002\3612\231E\261Oe\b\342\300\300\377I\214\237\023\001y\364\304\357\270\264\240\037\327O\375\373$\r\370\342<#\262\273dV\376\265\311?`\216f\364\362\311\212\007t\021\324+>L-\030\215\251\020\316X\254&)[3\203q\337\202\035\005\316\250G\353\3075\363t(\302s\327h\313\211\026\212\210\201\305\265\244\332\224=\n*'k\232\261\360\024\245\263\321\303T\033[\221G\375\320`\005\335\270\302\031\023\273\n\237\235\301W[\320\027\240\326\326\2121G3\226q\027\024\201\347\377O\271\344\314n\b\307\214\302\3067\007yea\001zj\030\333\255\370\232\307\0320\303^\353\325\244I\307\230\234\002\353\347\260a\025\316]"
+	.ascii	"y\331\035\302\256BqK\220\264\327\323\254$\345\021\226hcq\"3G"
+	.ascii	"\026\266\311\212\006\311\244E\251*\253Ua\311\213\002\256\b\270"
+	.ascii	"M\016\253\315\263\3601\242|\210\306\215\244t&\031\247\001"
+	.text
+	.section	.gnu.lto_mspProcessInCommand.189.cecdcad914df8b5f,"e",@progbits
+	.ascii	"(\265/\375``\242\215\030\002\232kW\273N\0200\306\334\214\001"
+	.ascii	"\347\332f\351|\271S\253\307\232\327\313\355u\241Q_GfC\263\213"
+	.ascii	"\343\315\206\373\320\301\241Q\200\235\325\0013M\021\217F<:3\361"
+	.ascii	"\351\314\304\247S\207\275\300\237\366\004>\345\244\375J\247\253"
+	.ascii	"6\205\276\214\317\021\"\245L)\245I\013\226\nu\fb\253s\207\271"
+	.ascii	"\316\r\206\342\334_\253s\373`:\267\027\323\271\273V\347\346b"
+	.ascii	":\367\026\212sk1\235;\013\305\271\261\230\316=e:\367\325\352"
+	.ascii	"\334VL\347\356\201\342\334UL\347\346\201\342\334TL\347\236r\235"
+	.ascii	"[\312u\356\250\325\271\241\\\347~\372\340\334NL\347nb"
+	.string	":7\223\353\334K\256s+\271\316\235\264:7\222\353\334G\253sKW\347\336\301tn\035\253sG\231\316\235\303un#\327\271\213\\\347&r\235{\310un!\327\271\203\\\347\006Z\235\373\307un\037\024\347\356a:7\016\327\271y\\\347\336q\235[\207\351\3347\230\316\235\303tn\034\327\271oH8\267\215\353\3345$\234\333\206\353\3344\256s\317\220pn\031\327\271k\270\316\ru\235;fun\030\327\271\237'\316\355$\341\3344\\\347~!\341\334\257\353<\343\203\263\013\323\271\345\2033\013\323Y\306\007\347\225\325Y\205\351\274\203\353\274\202\325Y\005\256\263\016#\234c\254\3160\230\316)\256s\323u\316au~a\202\263\013\327\271E\t\3168\270\316)\020\341\214\002\327\231E\b\347\033\\g\033\\\347\032V\347\025Lg\032\230\316*\230\316'p\235S\200p6\301\352<\003\323\271\004 \234Q0\235I"
+	.string	"\302y\004Lg\021\200p\226au\016\201\353\f\002\020\316\037p\235="
+	.string	"\302\271\003\2533\007\\\347\r\200p\326\300\352\234\001\327\031\003 \234/\260:[\300u\256"
+	.string	"\bg\n\254\316\023p\235%"
+	.string	"\3029\002\2533\004\230\316\017"
+	.string	"\341\354"
+	.string	"\327\271\001 \234\031\340:/\300uV"
+	.string	"\b\347\030Vg\030\\\347\004\200pF\200\353\374\202\353|"
+	.string	"\020\316\006p\235\013\340:\273"
+	.string	"\302\231"
+	.string	"\253s\013\2563\013\256\363"
+	.string	"\\\347\025\\g\025\\g\001\254\316\001p\235O\220\340\234\202\353\214\202\005\316'\254\316&\\\347\022"
+	.ascii	"p&\341:\217X\235Mp\235Kp\235E\270\316!Hp\006\341:\003`u&\301"
+	.ascii	"uFY\235O\\\347\017(\316L\327\331Eq\036\301u\026\001\3059\004"
+	.ascii	"\327\031\004\024\347\017\\g\017Vg\017\256s\007\037\2349`:o\360"
+	.ascii	"\301Y\003\246s\006\2533\006L\347\013N\234-\370\340l\302t^\256"
+	.ascii	"\316%\2533\311\352\254\\\235\223\253s\273:\263\256\363:\202\363"
+	.ascii	"\257\316\255\374\303\001\017lOLg\372}^\357M\365\310Ke\333\240"
+	.ascii	"\374\254\235\253\375\253=\254\275\252\335\252}\332.\325\336\324"
+	.ascii	"\356\324\016\325\276\324.mGj7j\217\266\017\265\003\265\347\264"
+	.ascii	"\353\264\313\264\323\264\327\264\307\264;\333\337\356\307n\306"
+	.ascii	"n#\335\210\335\203\335i\335j\335d\335f\r\202\271\321xY\346f-"
+	.ascii	"~F\201\271\232-e\263\376\242\370\217.\007s1^\206\305\325\365"
+	.ascii	"Pz\271\217\026\377\262\300\372\372\260qvQM\312f;\311\003\273"
+	.ascii	"\226o\2658\027\006\372\215yI\224\342\002\207\224\315\216`\233"
+	.ascii	"\203\266\207_9\026/\247\032\250\212\303*\264B\321\357\314\333"
+	.ascii	"/\323\270\254\034\245"
+	.string	"Wq`+N\313o\224N5\305\313fG\\ 8\245j16\261;\371\223G\361\022j\372V#\243l\266\352\315F\372v\243\304\316\2644b\353\315\206\307\034y\022/\221F\254/\231\003\334\"\375U6+\035\341V-4\364\"\366\034\256\203\227\321&\237\333\034\021\245\033y\340F\225[]\235\222h\250Y\345\006$,(-\210\314}\374\207y\311 p\036f\027w\020\t\201\200\035\307q0/Y\006\347a\226g\321\357\206\357\360\262Y\035\301-\271B-\245\3470\t\222\035)\233e\226\201y9\3436\334\206\2275#X_2\007XmE\021)\233u\232\021lYq\365\216\322eP\240\320\360zq\226gY\214]\003\345\245\307\314\2605\3244\303\237(O\2577\247\244\214\216Q\213\321_\246=j)\272\312\335\343,MECrk\231%2\276\357\273<\302\313\307\025\031\274zo\347\374\361\004\312P6*\361"
+	.string	")|\337\327\204\"\367\"/\215\360\333\372\2229\200'(\352}_\023\315\262\212\262\220;\321\260\017[\032\321\206~g^\222?\036\240\302\367\3051\321,\303P6\353F!\270\331\270\t\007\233(/^\357\315R)\251P\213\261\006e\263\202>rE|\344\372|X\020\221\203\364\221;\342#g\201E\237\0244\033\257\204<\210\204\336\367]\346\311\335\r\361\251\223\233\313\363\211\303\223\353 \375\306\274\344\026\315\3067@\372\274\357\273l\226\271\005\363\262Y\026j>/\232\215\037\016-\221H\353}\337%s\243q\003\3515^6\253\326\\_\037\004\350\004F}@\331l\232\212T\247\310\003\224\315\216`n\341.\3533^\252\300BK\2335\373\215ywP\324\311\212\201\fF\2777\336\226\021\242\243U\370\276^&\232e\002\260\316\334a-\326\322?t"
+	.string	"!\203\367\t6]{_/\024x\005e\263\354\245\\\275\332GK\177\251x\006\357\323\371s\202\262\331\f\234\335\233K\006\223\274o\224q\355}_\0248\204\262\331\254\326j\341\031\021\200\241qC"
+	.ascii	":WP1\306\367}O\240\264\207\266\331\2659h\233}$\r4 \353jk\265"
+	.ascii	"\325\006\033t\300\262\254\b\374%\224"
+	.string	"\275z\265\022\006\356/f\f\252\325j\265W\257\306\240Z\255V{\365jn\261\222\031\335A\332\255\333\232\255\327Z\255\201tZ\243\365Y\233uY\223\365X\377h\261\016k\260\376j\037\355\325]=\327\\\275\325Z\235\325X=\355\253\266\352\036]\325<\232\252\247Z\252\243\032\252\237\332\251\233\232\251\227Z\251\223\032\251\217Z\332;ZGG;G\033uQ\023\365P\013uP\003\365O\373tO\343h\236\336i\235\276\3219\215\3237m\3235m\243iz\246e\272FC;\246a\372\331\316\246\321/\375r\225#\031\222\217\360#;r#3\362\"\033aENdD>dC.dB\036dA.\302\201\f\310\177\354\307}L\204\371x\b\357\261\036\013a*\3471\036\337\261\035\3271\035\317\261\034\3071\034\277q\020v\3436f\3435Vc \234\306h|\306f\\\306d<\306?X\214\303\030\214\277\330\007{\301\220"
+	.string	"\004\274p"
+	.string	"\003\024\300\005\002\264\300\302"
+	.string	"VPA"
+	.string	"\0018\221\002\n'\230(Ab\204\t%\210\b\001\002"
+	.ascii	"$\240\234|`\272#\210\020\002\b\037x\340\241\003\0166h8\r2\300"
+	.ascii	"\340\002\013L\226%$\312d\313\256\337o\035\327r>\203\373\245;"
+	.ascii	"HO\341\020\351\341,y\273\315\r\265-y\263\315\311\254%u\253A\223"
+	.ascii	"\304\240E\336@\220\210\272\323\240DbC\336hP!\357\2638 fqdeS\320"
+	.ascii	"\033o2\237\356\261\251\326@D\234\020Tm'\212\344\323\375\203\t"
+	.ascii	"\246\352-V\323\035\346A\024*\343\r\346F\2416\242\2404\336_H3"
+	.ascii	"\335>Dx\373\261\023E\232\351\366\202\326\210j\022\272j\272\347"
+	.ascii	"\246\\\221\236\264\345D\216\336ZY\353\013[WJn\024\346q\375\257"
+	.ascii	"\2618\327\201\345\201.\313f'*=\322=]K4:Q_\255I\033\034\".\030"
+	.ascii	"\022\002y\320\240\267\225"
+	.ascii	"\236\224\260\273\307\223T\225\333\222\024\017\017\2420E\274\251"
+	.ascii	"\234~\274\264\032\247\336\272s\244\376\272\243\376\336\374\274"
+	.ascii	"\241\362\274\237\360\272\235\360\356\274\233\362zeR\202\252\355"
+	.ascii	"D\245v\335Lu\335Kuyt\336Js\335Iswr\336Hj\335Gju@\274\245i\335"
+	.ascii	";\322\346\320\274u\234uG\335(\314Y\234\231w\016\030;\2302o#)"
+	.ascii	"Yw\021\fY\2277\021W\367\020\327\226\267\220Vw\220V\2267\020V"
+	.ascii	"\367\017\326\324\333\247\007\006\312\033\007$\243\326\224\247"
+	.ascii	"k\253w\036\311\264\246:7\230\272s\334(\314\322\212\242\344\215"
+	.ascii	"\3237E\3366;]3\324mcH\310\233\206(\310{\006\250[\006f\347\307"
+	.ascii	"\273FC;\346\306m`l\274a\236\035D\2455\335\316U\004\030\033\253"
+	.ascii	"\b\030\032o\032n\323$\300\314x\277,\261\n\265\246\375\302\324"
+	.ascii	"\250FF:C\362\221#\316\217U\203"
+	.string	"R\216&\232\032\033\233\031\033\031\235\027\t\233\215\020\016:+\n6'\n\026qF\fl>\f\004t6\374k.\374\363s&\314k\036\314\303s\026\274k.rg\347\034X\327\fX\347A\324I\347\374'\345'\345'\327\334'\247\346L\004H3\037\2204\347!h\315{hg\316zf\315B\314\312\234\251d\315yd]\316x\\\315w\\[\316vZ\315uZY\316tX\315sX\036D\235Sg\271\",\3038\250f8\250'\3477\247\346 NM\316nL\315mLK\316lJ\315kJI\316j\353NTGQ3\0207\352,Z#rN\003\224B\2036\211t\350\316\360\314\203\2503\210W\241\250S\310\331\214\313\326\022\205lF\334\250\023\310\241\275\342\210:\177\234\311\222\306\204~\f\325H\211\005U\245\302l\200\221\334\371iM\2437\210\232\277\334\250s\306\207\033u\312\254\261\027\221?#\035\206j'"
+	.string	"\001D\220\376\302\001\210\246p\036\335"
+	.string	"J\276\037(\303\350\r\242.@c\273\320\310\350\004 \354\026\b\007\235\005\301\036\200`\021_!\260U\b\004t\001\374u"
+	.string	"\376\374\374D^\247\220\207\347(\334\365\t\253\210\251#\\\353\341\334\255\"\374\200Y\262s\023k\006uk"
+	.string	"\346\274\304\321\r\272&\361\322J\305\0365\303\350\r\272\036!\327&\310\251y\t@Z\304Z\002\310\024N\232\207@s\020=P"
+	.string	"0s\022H\210\336 j\024\262>!\353\362\017+\007}=t\234\340Sv\327G\232\204)\034.g\256(uTh\353\341,\255';\212\032{\ng\313]\273\021\326\222\2674\265\326\303\311ZYX\232\222\352\306\251\213\200\325!\200@4\205s\345\037\360\\y\300\362,IEo\020\265\2075\ts\363\324z8N\253\013\216\205m\275\310\344\035\034\335hj\016Lh\352\r\232FS7\334Z\202\310n\307\215B\237V\017Bt\024i\302&a\ng\3115H\306\360"
+	.string	"\245$/\255\306\350\r\242\316"
+	.ascii	"\203\f\220\232\372\202u\005\030F!\023G\350\220\236\302)r\013"
+	.ascii	"L\326\022\205lFZ\017gh\365p\3634#\344\313\022\022\2427\200\232"
+	.ascii	"\004h\255I\230\302\371qeGo\020u\262\247\333\013r\2401\316\266"
+	.ascii	"\036\016\321\212\362\276\3572\007\306\327U\004"
+	.string	"\"\273\235\326\303\361YE\b\321Q\244\327\332ir\236\376\"\b\273\337\260\272\343\274\332-\307\004\003Y\205*A\203~h\236\2168\3728o\2346\316\032\350\225\263FRI\216\323\t\351|<\203\202IR\002\n\202\361q\234\273r\016\311\004\002:A\0211\226\t^=9\3014iu\020\205\332\264\375t\204\323Q\234\245\023\236\214\341}_\366\231\234\033\315M\327\314\034\274\300\334Q\31467\0049\311g\234\037\220\264\021O\342\033\0329\342\327C&\305\016B\222\236\230\360=e\302; \023b\t:k\031\031u\354\007_\t\277\0362\031\212xf\027\236\025\254\311\364\353Y\277\\~\330\2608-\"-\037^\"\362B<\263K\320\272\325d\303\342\256\264\262V\305\231\303\020\317~1\335\201xf\227\241\365\312\245\210\r\213\343A\244\025\311\034\303j\345\222\243\rA\310\"\315\215\326Z\265\366p\321!uARj\233}A"
+	.string	"<\bf\027\246\225j\006\345\373>[\340u\312E\021\027'%"
+	.ascii	"\276w\314\2144r\321\360*\334Z\364\303\212VY\366\3543\216\352"
+	.ascii	"\006'\341\231]\244\\\250\274g\224e\217\362$\374\0062Oy\320H\224"
+	.ascii	"w3\246\267\017\177\362}\244AP\366\244\306*\225}19hf\373\341?"
+	.ascii	",N\007\330\335\323\035?|\0032u\271u\t\246-\352\213C\272+\234"
+	.ascii	"\371\314.V.S&\346\367Z\257Sf\202#\274\224\227\200!\260i\317."
+	.ascii	"u\234\211~\245\247\341\267\366\225\276\033\233d\260I\315P\004"
+	.ascii	"\245g\323\376\203\262\246E7kE:\222F\300\215\216\320(\302\326"
+	.ascii	"jTDT\001\021\202Bx\026\263\"S\020\236\331\245k\375i\232\300*"
+	.ascii	"M\253\217\213\017\021.\200\255=.b\312\025G\006\\\306\272iFW\032"
+	.ascii	"\b\337VF\317\177a^o\254:3\272\312\\\316\316\332f?\370n\354\365"
+	.ascii	"\210Y\337\267\200Ed\030\202\007i+N\363\203\237\315z\343\242\306"
+	.ascii	"\346\342\346\3266\313\336y\360,\340\022$\365\371/ \230h\017\237"
+	.ascii	"\002\006\370tG\017\337\200K\217\324\347\277\230-5v\360\314.o"
+	.ascii	"\253L\363d\205\2565\\\342\346\\\352\352\332f"
+	.string	"\333\267\016\276\327\332\003\275\245E\037l\216\341\003\016\356\326\347\352\\i\254/ (n\360\034l\360!|-\335i\360\314.y\037\251\322aI\357\373\266\300\354\"\344!]\366^`\027\276?\342\322W\202\337\373\276-4\313\357\370\217.\177\334M\315\262K\240\213\240`\333,\b\220\031\274\006\337\320\310\f>\004\263\245\272\257\356\265\356\245\2459\017^\312\275\330\033p\353\321\001\006\3776\236\206\331\206\365}\24304bw\341\227W9\002\3766\276\025;\321\305P\204\337\373\276=\303\354\202\350\242\350=\303\235\330\033\230-mQa\376\205\331\313\351\341\245l\201\031\007\254\220O.5\234\211\376\244\247Iz\f\236\001+\315cp\327\325\036\321Z\360+M\263\227\263\331\307\323\321\333\301\t\375I\317\n\371\021d\224\362b\210\234^\345\013\236\231U\236:\021\0053\351}_\027^q\346\360\202\357\305\356\340kiJ}\376\313\033"
+	.ascii	"\307+\306\001\020\236S\324\353\332\340\245\334\235\364\221f5"
+	.ascii	"\334\006v\317>\203tY\360\254\335\t\375E\336\202o\302\246\200"
+	.ascii	"R\322bL\244\323\253\3747\272\304R\217\006&\317O\370\205*.\213"
+	.ascii	".\215.\215m\263\2366sH\303\253\274|\223\357\005\270@\272T\275"
+	.ascii	"g\226\357tHU\244.\201\004\231\001\fN\362%\316\0310%$\337k\r\001"
+	.ascii	"\245\"\265\336\242\301\302\300\003\377hF(\354\202\227rw\263e"
+	.ascii	"\371\236\335Q\333K\036\021\351\260\340\005O\276Rf\006\r\314\277"
+	.ascii	"0\333\367\312o\366\357\223\237T\"Z\204F>\332\215;\223\275f\371"
+	.ascii	"\376\303\324\254\376\336\221\344\372~\245C\212\243>\377\205\357"
+	.ascii	"\335\f\351\215j\243K \271Q\227/\345\017\332\262\270H~\257=\264"
+	.ascii	"e\331(\331\233\177\244\266\006\351\333O*\r\225\370P\2214\022"
+	.ascii	"\366\346\331'\220\300\352\315\227\374\r\215\255YsA\312\2272\263"
+	.ascii	"m\312\325r7\333\r\254\214\260\254\315\377\321\3230\273\340\354"
+	.ascii	"3\317\310\231\241\343=\303(G\317~\211\222\020a\362\245\235\366"
+	.ascii	"\326\330\376\216n\266\254\315\263"
+	.ascii	"a@\230\300\360\236\356\370AL\210,\263}\304\357\265&\211\202\375"
+	.ascii	"=\335\221\273\231\355\372\217\370\354P\037\247W\231\377\356"
+	.string	"\361\232\334M<\203gF\217\367L\263\3343z\332f\327w)\033\322\350C\303\253m\2178\276\365\245,\201\366?\005,\357\351\216\314\332\374\377\0062Bc+\004\315\030\362\236am\336\315\216\252\324\347\277\360\357\350^\353\rXQ\031\013_\034\222\331\313\371n\370\346\323\035\367Rf~\247\346\030^\034\222\273K\016\245\336\226{\251\034\377\034\3655#\323\272z\343\207C\231)Z\323\272j\343ws\274b\324\272R\343_k\234\243\211B\343Oc\214\233\213*\34373\202\345\247u\365\203\177\354\360\216Q\353\n\214?\214\220\247)\3525\362\342\367\221\367C\027\265\305\317\305\203+\337\020\"!<,\376,\273\245\250\327\310\212\377\252n\210(\3525\342\301_\305\203\027\030\243\223\342\237\342\301\013\204\311\315=\361C\361\240\005\342|\340\230\370\233\202\324Q\265\256^\243$~%7\235H)\377Q\033IP\241\326\325\373F\371u"
+	.ascii	"\261\252\021U\304o\224\266\204\022\342\037j\264\236i\324\017"
+	.ascii	"?\020\017\256p<\332\f\007\177O\331\262\321O\207\177\207\214$"
+	.string	"\t\207?\007KKN\353\352k\370m\332\212\210\354g\370i\366\226E\036\312_\203\007Y\270+!O~\230<\251\277\250\177\341\247qW\224\025\025\311^\255#!\244>\262\037a\313\"cdod m\364\342\006\024\245\310n\204\007Y\204\311\241\035\262#\362`\233F%\022b\037\204\354\205<8\201;\237\004\024a\027\344\301\025.\211H\350\205?v@\002X\020TH\204\275\217\205\251\227\326\325k\264\307>\204\007Y\300\255@e\027\302\2033D\372\240p\307\216\307\2033$\312\231\240c\2573\0012\216]N\304\362Q.\b\373\033\017*A\264J\333l\303\2208\025j]\275F/\t6\3666\036LA\232\317\373\2764\321\262U\270\205y\320g\336\367}_\022\3152\273\0323\017\266|T\"\241\367}i\"ff\346\026\346A\237y\337\367}I4\373\202\317\356 \324z\375<\222\373\277\310\277\0304\222\206W9"
+	.ascii	"\376\200\317<#\307\f\035\3363\375}\326-m\263\362j,|\376\013\263"
+	.ascii	"\227\263\327\367}_\177)s\257\357\373\276\374;\230]\252Yiw\342"
+	.ascii	"\254\234\353\307fe\231\353\254\364r\235\225V\253\263\362\351"
+	.ascii	"\304Y\271t\342\254<:qV\026\255\316J\034\253\263R\347\304Yys\342"
+	.ascii	"\254\264q\342\254\224q\235\225O7jN\376y\2649\331\347C\315I>\037"
+	.ascii	"jN\016q\240\346\344\235\353\234\034s\231\346$\230\3134'}8Ms\222"
+	.ascii	"\313k\232\223Z\2563{\304uf\017\233\253\2335\364\234f\266\320"
+	.ascii	"u\232Y\301Nkf\377Z\255\231\355k\263f\226\257\2154\263Bz\260\231"
+	.ascii	"\265k\306f6\315\337fVluf\213\332\254\231%j\263f\026\250\315\232"
+	.ascii	"Y\034m\326\314\336\264Y3k\343\316\346\365\321c\232\327\272\325"
+	.ascii	"y\205r\253\346U\311\247\315+\322\352\274\016yX\363*\264:\257"
+	.ascii	"=\036\326\274\342p\235W\233\023\347\225\306u^g|\251y\225\361"
+	.ascii	"\246\346wt\247\346gt\250\3467\342:\177\242\353\374\210.m\376"
+	.ascii	"CGj~C\327\371\t\373\253\373\005\233\254\371\213\364\217\356\007"
+	.ascii	"d\347\237r\251\346\227\362\245\346\217\362\241\346\207r\240\346"
+	.ascii	"\177\362\234\346wr\231\346org\3633\371\333\374K\315\330\374J"
+	.ascii	"m\244\371\223\332\254\371\221\332\254\371\217J8\377\216\325\371"
+	.ascii	"u\224p\376\350\352\3749V\3477Z\235\277hu~\242\022\316?\264:\277"
+	.ascii	"\220\353\374A(8?\320\352\374?'\316\357s\202\363\367\270\316\217"
+	.ascii	"cu~\236\023\347\3379q~\235\325\371o\270\316\237\343:?\216\353"
+	.ascii	"\3747\256\363\333\2348\177\315\352\3746L8?\315\352\3743'\316"
+	.ascii	"/\343:\177\r\327\371\241\256\363\307\270\316\017\343:\377\363"
+	.ascii	"\304\371\235L\347\247a\302\371_N\234\377=q\366\252\353\354\221"
+	.ascii	"\256\263C\272\316~du\366\307\325\331\035Wgod:;\243\353\354\213"
+	.ascii	"\253\263\033q\235]\321u\366D\246\263#\272\316~\310tvC\327\331"
+	.ascii	"\013]g't\235}puvA\327\331\213\254\316\036\270:;\240\353\354\177"
+	.ascii	"\256\263\373\271\316\336\347:;\021\327\331\371\\g\037\262:\373"
+	.ascii	"\236\353\354z\253\263\013Y\235\235\352:{\336\352\354x\253\263"
+	.ascii	"\337\255\316n\307t\366:\327\331\351\\g\237[\235]\216\351\354"
+	.ascii	"qLg\207[\235\375\315u\366 Lgwc:{\033\323\331\331\\g_+\341\354"
+	.ascii	"j\256\263\003Y\235=\315uv\264\325\331\317\230\316n\266:{\031"
+	.ascii	"\323\331\311Vg\037c:\373\217\023g\027s\235=\314uv0\246\263\177"
+	.ascii	"\255\316\356cuv/\246\263w\255\316\316u\342\354[\253\263k\235"
+	.ascii	"8{\226\353\354X\256\263O]g\277r\235\335\312u\366\036\256\263"
+	.ascii	"W\255\316\316\303uv\252\325\331\247\\g\227Z\235=\312uv\250\325"
+	.ascii	"\331\237VgwZ\235\275\311uv&\327\331\227\\gW*\341\354I\253\263"
+	.ascii	"#\271\316~\344:\273\324u\366\035\256\263\353p\235=\352:{\016"
+	.ascii	"\024g7r\235\275\b\305\331\211\\g\037Bqv!\327\331\203P\234\035"
+	.ascii	"\310u\366\037\024g\367Y\235\275\207\204\263\343@qv\036\327\331"
+	.ascii	"w\\g\327Aq\366\033\253\263\347\270\316\216\203\342\3547\253\263"
+	.ascii	"\333\270\316^\203\342\3546\\g\247Aq\366\031\327\331eP\234\275"
+	.ascii	"\206\353\354P\024g\217q\235\035\006\305\331\237\256\263;Q\234"
+	.ascii	"\235\206\353\354/(\316\376\256\316]u\235;\022\305\271!\231\316"
+	.ascii	"}\004\305\271\037\231\316\355\210\342\334\215L\347fDq\356E\327"
+	.ascii	"\271\215\2408\267\242\353\334\211(\316\215\350:\367!\212s\033"
+	.ascii	"\272\316]\210\342\334\204\256s\017\2428\267\240\353\334EP\234"
+	.ascii	";pun\300\325\271\377\230\316\355\207\342\334}L\347&\202\342\334"
+	.ascii	"|\253s\017q\235{\017\305\271\365V\347\026\302tn*\212s\3471\235"
+	.ascii	"\033\017\305\271\357\\"
+	.string	"\347\266Cq\356:\024\347\246s\235{\016\305\271\345V\347\216[\235\033nu\3567\246s\007Aqn7\246s\267\24187\033\323\271\327\230\316\255\346:7\020\024\347N[\235\033\215\351\334g(\316m\346:w\231\353\334dL\347\036c:\367\017\327\271\003%\370\275c\tS\216\303@\251\230\346\030V\334\b\311\350U\240\343S)\352)\221~\265\212E\337\206Q\242\027A\336\320O\211\321\017v\350\333jH\350E\200\367\023\024T\022d\226\026\364\035\347\003\364\"\210\233\363\371\031*\301!\003\210\313\330\311\317\367\\\211\216\373<\013]\334t\007\357\351y\007\204[\301K\231\001\331p<\263\214\242\222\233\026\230 ;\3578>\371V\303\363'J>;\237l\003\234\352\344(\231\241\323\371\256+\201\336x\026\2724\025x\316\247\344|\003\002RQ\237:8\216\216\222\247\f\252\343\224\274\370\315\263\320\375\210\3416\357\302m\276\365"
+	.string	"u`\324HI\"\211\b\326|\347=\332x\031 \347h\220H\032e"
+	.ascii	"\322|\327\031\231yV\315\217hHF\211$\261)c\320e\354D\346\233\315"
+	.ascii	"\260\306\313\2208\007}f\031L$\204\315\303;\350wV\221\230g\231"
+	.ascii	"K\234\302<\340_K\240\f#0\337nD\236\215\316\037\262\347\230\346"
+	.ascii	"\316\3578\252\323x\2269B\177!\301k\226\340'\303\211\344\256%"
+	.ascii	"PF\244\277|\277\321\371\373,s\203)"
+	.string	"m\265\372\r\330W\325\214\204\"\201{\212E~\277\271A>\313\\\221\351\0216\024)\220\254\251\3258\362\355\206\366\370,s}SG3\024'\222P )#\263\221\346\370\035G\"\326\370,sD\032\031\237Y\206\024\t\030\212\024\374N \371\"\361\201#\306\370\375\306\265\3702\0201BE\242\265\2234\362\2758U|\031\362\022\253H\254|\022\277\335x \276\fw?\207V$SB\207P\206/\003\\\341\224\304\311\310e\354\244\360;n\211\360eP\233\033\314\"I\332\3412v\302\362\r~o\221H\005\237eNmZd\213$\332dI*\362\355FR\024\370,si9X"
+	.ascii	"\b\370Nd\352\005\021\027\177\177\337\200D\206Z\370u\221\374D"
+	.ascii	"\371}\347\341\350{\031~\374\020\361A\262\203\202\207\313\330"
+	.ascii	"\t\221oD\222\034\276g\231\023k\304a\310\220w\";)x)3 \221\234"
+	.ascii	"=0\222\032,\227\261\023\261\275\3577\222\031\275g\221\253\242"
+	.ascii	"@\210\220o\300=H\252\030\t\324\313e\214\311*R\277\331H\236y\037"
+	.ascii	"\202\3109\2741\022\032(\302\\\306\230,\336wV\365\356c\310E\032"
+	.ascii	"I\244>\377\345p\317\320\256L\331\330$s\031c\332}\317\031"
+	.string	"\251\373\030r\213vt{r{p\324\347\277\274\275\263K\354\271\261h\272g\226q\3462\035\244\373\020\020\246\271\320\354]Q\235\377\262gEu\3360\247\246\004\004r7\367]\327'\367,rDl\210\213{\337\273Q\303K\231!W\300\301\275\353\035\322\360Rf;:.-\327\303\322\233\252x{\373\006\324\3739A\0206e\235\\\220\357<9\267\307@\344O\233\233\022\316N\260\355;\317\215\355Y\324 \327\336\224lkk\237\374\352RT\213S\246\241)\252}\362\253\013\021\310\234\262\2549\344\016\310w\335\217\264gQ[L\241DC\2533\301Y\235\362\013\005\340\331\367\\\227\331\263\250)6\226\335)\267\232Ze\337:v\275\221\345)\247Wd\337\036v\271\215\tQV\361h\307\276\005\354b\373\241\224B\241\214\372\361\255^W\327\226\3303\313\330S65\225L|b\337\036ve\315\360R^\035\273\303\302\246%"
+	.ascii	"\343S\"5Y\034\337\300\276\347v|=\213\232 \n\037>\250H\340\325"
+	.ascii	"\247\314a\344U\324\365\247\034\022\352\032\032\301K\271\271>"
+	.ascii	"\005\f\217\353\033\260+\210\372\024\301V\240\322'\306e\354\244"
+	.ascii	"\335\372\256\343\321z\f\360\315e\t*uf\\\306N \263\276\335\224"
+	.ascii	"8X\317\242\3067\235\022*mj\222w\323O\002v\351\\\031*gP\204P\312"
+	.ascii	"\\}\322\254+G\206\227rR\256\333\312\352\033\220\253\332\003Q"
+	.ascii	"\t\263s\327\343;KI\243\3521\220\367\343\363\3142\024\225/\212"
+	.ascii	"\025G\213\217\313\030\223\025\344\361\335e\004I\3651\324\360"
+	.ascii	"\032}\246\236Y\306b\362\021\305\007G\251\357\251oh\244\324\267"
+	.ascii	"_\\\215o\227\340Z\244\206@F\243\013\r\227!\325\t\202\250g\226"
+	.ascii	"\361\2304\322\024\221\224\230T\224\001)\243\312\362\362\022\365"
+	.ascii	"\255\031W\335\007\240\240\342<\360\344L\0266\t\305\236\276m\343"
+	.ascii	"rs\202I\026Q\tl\372v\372\206F6}\253\307\305\306\004M\372\241"
+	.ascii	"\350c\372\244\036W\327\222Lr\310\036\bwK\017\002 \327\226\022"
+	.ascii	"M\222\232'\246\364m\033WV\322\3335C$\275\357[\227\364\355\027"
+	.ascii	"\327\264\003\374\3266\322\247\200\341!Yq\340\250&\t\3274\341"
+	.ascii	"\215\345'D\220\264\243O\322qQm@*}\347\212\242>\377E\003\\C\031"
+	.ascii	"\350\035\237\002\006\270\343\033\220\013\003:n\222@P\204\360"
+	.ascii	"KK\352\370\244\036W\317\005:"
+	.string	"\032\375\006\344\342\311\221\223,CA6&\226\343\3336.\035#\235d\030\330\027\237\321\267\207\\9E\317\314\302\223\354j\212`\351Ir\261\374|\360cLn\025}\253\227U%\nJb5\231W\311)\313P\021K\216\034D\337\232eAf=Bf5Z\200\007Ub\243\317\352\207vT\201\265N*\212E\212\002\036\220\301\251\217o\261\035\241@^\367\320\377\223\323\320\367\r \202S.\032^\235\200\020\223Rr\351\002\241o\001\263t\202\236\231EG2\271#)e\221\232\340\367\276/\022\213\022S\333l{\027\364-`V\016\220S2G3DRQ\322\210\005J\212\205\212J\021\350\333/\254\252\004^z\325\375\363)`x?\337\200X\215>U\311\240\346\211_\362'\t\304b5e\311\312j\233e!}\2765\303\312\303Z\353\336\241\335\201#\326\334\264K`\275E@\210w\3173\263t\261\370H\352t\317\253"
+	.ascii	"D\355{t\t\254-*\004p\200%s\22288\254x\304\22256\024y>\371\205"
+	.ascii	"U\2653\226\224\251\221\266\363-\035\026\225NY\022\246)\"\351"
+	.ascii	"L>Y\316\322X\324\324\332fYA\035\017\216XRT\3151<\340\006[\362"
+	.ascii	"\255\262|7\236=\304\372\311qk\217<\346|\253\207\325\3238\317"
+	.ascii	"\314\362\3262\242\b\221d\244]d\211\233c\251\253k\033\207\016"
+	.ascii	"\213'\2529\006\007\260\334Y5\366\3153\263\344\265\207\315\345"
+	.ascii	"\223\260H\237a\341\315\242\215\220V\320\217H\221\300\232o\233"
+	.ascii	"ohd\315\267_V\2126\366Z\277!|}D\024i\276m\320|\373e\2058\303"
+	.ascii	"\327\356Q\207\350\t\021\233\371\266\315\312P\346\231Y\372Z\274"
+	.ascii	"\026\230\345\223Pk\357\316\216\255\361-\363\r\215\254\361\255"
+	.ascii	"\231U\036\364\257\235\273\322\223\213k\025\241\237\374\262\272"
+	.ascii	"\243\306<3K`\033\244\271|\022\nanIl\335X\004Y\0179\370\330\332"
+	.ascii	"6\026B\026C\026D\026\305\266\331\244X\314\267\242\321\363\033"
+	.ascii	"\346\223Jx\204\rx)c\320\314\266\237\377a\204\317o@+7\261.a\325"
+	.ascii	"\305\200v>3\313b\213\306\322H\262c\320O\360\314\214\357\213\005"
+	.ascii	"\222\245\352\374\366\320\252\212\306K;6\244\310\017\261\366\345"
+	.ascii	"\233F\277|\322\314\212\252\337gnq\266_-0$;\006\251\201>\274\322"
+	.ascii	"f|\2773\236\245\263\222r\201\266[Z\200ZYw-\357\322\362,\240U"
+	.ascii	"\021\213L{u\365g\325C\306\263|\313x\266\315jh\205\246\245R!\331"
+	.ascii	"1\310\243\375\230]l\264S-5k\b9\216\244\311\264Q\255T\313MN\213"
+	.ascii	"\016O\273\303\257<\273\202W\371\026\334\341\3316\253 \352\363"
+	.ascii	"_\026\360RN6\263]\301\177\330\340\n\276\001\255t\024`A\303h\277"
+	.ascii	"\310\177\230\340\343/\365h\214\341\245\274tL\300\372\370\354"
+	.ascii	"R\313\231\350gbz\025|\017\202\351\360*h\036\316\334\362\323\022"
+	.ascii	"\344=\243\303\373\263\327G#\347\277\354=\201\306``\372\365\361"
+	.ascii	"?\370\243\213\221\324&\261\032\263=j\221Z\206\212Zr\344h\233"
+	.ascii	"}\310\231\303'\207\361\314-\322\026$\357\231\030)\017\343\327"
+	.ascii	"4hd\312\373\263{K\307\352m,|\376\313\313\345\374\215%\340\245"
+	.ascii	"\314\334|\346\026\2456\332<\311\321\374\244\031\325[\016\317"
+	.ascii	"\334\302\324\0225O\206\222i9|\222\216\312\r\001/^|\003Ru\271"
+	.ascii	"pj\177Z\240|Z\274\213\026\317~Qm\341 \325\362\264P\355\244\340"
+	.ascii	"qH\301\263mTY(\250jsZ\254pX<\n\276\241\221,\236\375\242\232\336"
+	.ascii	"\360\314-\323\266\246%\213\351\327\322\2646Z\266Z\272Z|\264\370"
+	.ascii	"P\264\341o\370\206F\332\360\354\027\225UW\227\240\252z\341\245"
+	.ascii	"\314T?5\200\265\320f\210\230\366\255\206o\365\250r\250\317\177"
+	.ascii	"Y\277\244\214\034`\305\247\254\370\006\234\252\322 \326\322h"
+	.ascii	"_"
+	.string	"\336hxVo\252Q\305\030\033\t\251\342Y\300\251\305\023<sK\031\353\210\202ed\033[\316Z\322Z\324Z\324N\360\275\326\036"
+	.string	"\247\264\232c0"
+	.string	"\333T\034\325Y\200\024nlb\223\253E\020\205\024\337\210\206&\370\346\201\026\304\205\031fx7\233\352\"@\t\006\005\303\222\220%\370V\007\020E#\t\374\372\310\322H\360m\317\220\021|\363@K\233\212@\017\005\001\336X!-qh\"\370\226\007O\206o\036hhT\305\271\026^\312\253R\207 \004\357fSR,\200`\216\255k\003\301\267Ar\037\370\n\374\370\361\3003\267\324\261pM8\020\304<\360-\217[\007\276y\240\2115\016\200\003\034x7\233\342Ya\003kjv\202\033\370\256\242i\240\252B\006\276\243`x\031x7\203\022"
+	.string	"\006\276\214LO\021\003\337\346\210]"
+	.string	"2"
+	.string	"\026\260"
+	.string	"\342\211\n|\371\360K\362U\340\033\222\213\002\213)L`\002\357fPu(H\340\231\231\235\262YM\026\260\006[\004Q\360\346\267\266\331\344\235\004\276\037{D@\321\201\352\206\234"
+	.string	"\201\357(\004\336\315\240\334\036p\307R\241H\204\2349|\3007b\224\003\236\002\204s\r\310c\237\030\323\032\360\035g\364\374\027&\006<\005\b\177|\204\260Jb3\207\013\370\266\r*K\001\317\334\262\307\0365\225\354\353\022\331\"h\302\314a\321+\340\333\267\0351|\257u#)\371\fi~kax\266\350;&\321\351Uf\211\036\206w\032M\262$\263\325\007\215$\372^\353\r"
+	.string	"\241\254\250\317\1771\361R&\241#\301\212=\0138\302D\377\322\323\364/}Gz8:\212)\261\364\254\330s\240\244UM\300\022k\324\034\200\037\037[\364l\021D\241\025\2349L\300w\236\321\363_\204\020\360\376\322,\217\263\"\323\307\340\210\235\030\t\240\346\211\237\231\3023\"#\200\276\007\307\214\343\031\237\t/\374\001v\232=\304O\247\355\374^\370\036\222\323d!\251\217\305\231i\021D\341"
+	.string	"\317\202\022kc"
+	.string	">\240w@(\035\352\363_h\232'fL8<\313+\201\305\3615\240}\344\f\257\373\360nD\024\340]\370\216\202\375\235\300\3024\233\357\331w\005\370\346\373kc\024X\032M\026\230[\376\330\227\226@\366\235\201\323\"\210\302\264m\326\205g\341\257m\205\\#gL\271\233\270\205\260\305\260\305\260m\226"
+	.string	"\337<\316\360\246>4\274\212\343\035\360i1\004I\363[\333\302\247\200\341\265\240\370A\210 Z\020]h\342XP\\\027w\030Qd\005Yx\326\361\311m"
+	.string	"\317\334\262\270\0366\331 wF\206\205\254\330"
+	.string	"\236m{b[A\260\310\221@@\301\025~u|\352R\241\257\371!\251\245q%\342\362\303\006\261c\344\033\242\302\263fO[\002x\346\226\307UH\223\rb\227\350/\363\f\242\225\332\002\311z\020\302wV\206\267\346\265T_\\\2340m\263+\244"
+	.string	"\2365{\312\002|\232\236\370"
+	.string	"|G\366\007\376\246y"
+	.string	"`6\263=\361\037f\027x\342\033\360\211\312\371\236\244H`qf\027\031\027\032\357\031v3\246*\325\371/()\324\254q.E\311g\\\"\334\333\035\n\237\202\333\214#\024>\001J7\270\211\023J\274\211\347@\t\212\020\032Y\342\337\214\251\221\3043\273\334\254j.\001|C\n;\244\234\330!\205\003\276!\005\030/T\220\262\002\306\211\0307\330\300\002\207\021\370\206\024`\304p\261\242E\f\030:\240\200\206\024'|C\n0V\320\360\242\305\f*RN\250\250!\204\025):\304H\341\302\006\0260Hn\210a\203\213\0258\264+Z\244\270"
+	.string	"\r))^\234\200\204\006\t\244\254H\321!\206\212\0245\350\340\"E\213\013`\250X\001c\205\301\002\007\034X\264hct\214\224\0241`\260,Xx\f\027:\274PqA\312\n\0265\260\210\341b\005\r,Jl`Q\203\213\027\f\210\221\362\"\207\222\030+R\240\"E\006\\H"
+	.string	"F\214\224\027\031\260\301\005\013\027,R\264X\221\342\001\r.R\264h\361BE\262\206\032^\254HA\212\016\250\244XA\n\027:l`\005\016'H\001\203\005\r\036Z\350p\201\0251R\244$[\274p\261\242\001+b\244H!y\301\"F\212\r\344\320\306p\261\242\205\013\033X\340\240\200\027)*6X\260\303\213\023<\213^\321\"EJ\rl\f\027:\274`"
+	.ascii	"\016+\\\270Hq\203\n\223\0300h\300`\207\0254\270\220\300\n\034"
+	.ascii	"X\324\360\"%\003*R``\260B\007\034R\250\200]\261\302\202\003)"
+	.ascii	"b\244\240A\251\"\005\306g\200\003\026\240\241\205\212V\005\214"
+	.ascii	"\025\rP\221\002#\311*R\310\001F\213\0239\300hq\302\005\213\024"
+	.ascii	"-N\250H\201q\"\005\017\374\"\207\025)'b\274x\221rb\311\314\354"
+	.ascii	"E\343wp\237\265\322pN\013\252vA\367\214\266\t\233D\b\217\017"
+	.ascii	"Tm\203\031=\243\375\251\237z\177g\265Zuv\220\035\210;\336\342"
+	.ascii	"\334\334(p\266\203\342\224T\2303\223vh\334\341q\252\250\207\243"
+	.ascii	"4\277\265\236\346h;@\242\265\006\201SC\324\230\266\350\016U\031"
+	.ascii	"\316\3507\342\324\017\325\td\212\215\313\002_/2\234\215T\247"
+	.ascii	"s\221\272\345\314$\250\212\f\224\242\005?\315\314*\\\3365\003"
+	.ascii	"\211\351\347\023x\344j-\007\313\347\370\022'\256E\265U\350\331"
+	.ascii	"\230<\253\241.\025\232\325\350\327!\241\177\243\367\261&9r\342"
+	.ascii	"\352\023\372\207\nB\355\031H-"
+	.string	"3\253|9\330\f\244\017\\\002\023\031\023ix\025\310\324\277\350oTrp\370\242/q\332\252\246u\320\315v\305\361l\f\336#\030^\017_{\336\1778\230\n\317\211\237J\217\312\217X\257YF1\377\302\035\020\375\332\263\342\370'z\377\321$:\322\266\bq\274\2135\007\210PVh/\345\022\037\375C*A?\364\215\bU\365gm\002\212\212z\366B\317\2542\024\364/\364\235\026\364\276\007\365s\003\325c\306\001\257\372(\367,\357\241\222C\251\242CE\372\364\b\364^\325\016\331\344\377\363+\3223\253(\2510y\317<\320\257J\377?\177\201`V\337\252\364\377\370\264\350\363+\322\273 4\322\347\035\253;\b|R\244\222=\325Q\313^\312\036\300\3521\245\335'\261\372\207\211Y\277\324\334\277\324\373T\227L\201\331e\240\234{\247jW\022k\262\307~\251W\332}/\tN\373\276G\310\202\230\031H&8Y"
+	.ascii	"\243R\025\302\002\247\005O\025(\225)\216\377\236o\034\357S\355"
+	.ascii	"!\360)\213\332cH\256As]k\242\331\244\252B\345=\303\0010\211T"
+	.ascii	"\251\262R\231\262J\226\312\326Z\267\r:\304\250\306\302\230\346"
+	.ascii	"\030~\274\224\227t\035\266\312<\353\330s&f\375QQ\357K`v(\202"
+	.ascii	"44Z\354\245#\332\217\372U\346\235\251A\340\224\324\347a\317\363"
+	.ascii	"&=x\276\2252z\376K;y\214\240\rv\370\277\363&=\300\354t\376\215"
+	.ascii	"\374\357\374\277\305D\375\353|\337\370\337[\232\273Q\364X\355"
+	.ascii	"\257\2272\237-ub\242\035T\373\310Y\024\313\371\326m\351\r'1\r"
+	.ascii	"\347\333\272%\267\033\303\273\233g\003\227\330l\006\233w6\317"
+	.ascii	"\006.u\325\004\2624\326<\013\266\264E\343\247r\266\303\214J\332"
+	.ascii	"\007\034\324(\021\316\0342\231\212\324\332\353\245&i\375\216"
+	.ascii	"\317\306\004\351\243y\307Ga\374\247\371\017\322\222\252\320H"
+	.ascii	"\306_\335\226\206f\376\215\274\377\314{Ts\200\270\024t\002\323"
+	.ascii	"\027\324]\357#\220\252\347"
+	.ascii	"~\307\210\366\017\377\177\004A\002\2733\374\227\371?|\177\033"
+	.ascii	"!\363\0378\025Uc\210j\374\033\276\277}\215\1777$.\030I\r\342"
+	.ascii	"\207\032a\020$\305\255\2272\n@Y6\235\225\344{\017\350\246\203"
+	.ascii	"=M\016\371\207z\232\207\372\236\352j7\333\207\372$\337;Q\177"
+	.ascii	" mh\f\f\2500\247\265\240]&x|\320o\021\221\356b|\230\324\305|"
+	.ascii	"\373\210T\007\003f\"\007\363\355\031\322\334\363\231U\304L\336"
+	.ascii	"\232\317o\317\220\342\234c&m,\215o4\376\235\337O\343\331=\244"
+	.ascii	"\2672\0235\2253\023 94\251\2441\375<\250!R\2339\244\361\002\r"
+	.ascii	"3\270\316\362@\233\374{\366\007\220E\037\377\227gVaSq\363\236"
+	.ascii	"I\376}\262\357\377\345EH\033\312\203F&\373\336ut\007\210HT0\370"
+	.ascii	"\2503l\254\177?9\344]\320\244\254\277\310\377\373#\b\n-\306`"
+	.ascii	"9\275\332\323\021\255W\277\243\311\036\321~\221\367\352;Q_ M"
+	.ascii	"(.\246\315\217\351\b\222\372\342\220W/e\022\240\356\221\274{"
+	.ascii	"v\251\337L\364?=MX\377\323{\220^\314\\Z[=}\362\3567p\nR\213!"
+	.ascii	"\212\214\232\214\251\274\231\374P\211;IZ>\231\210\245E\276\007"
+	.ascii	"\265\207\272#E\216\333IJ\353\036\220s&_M\246\211\017\310\272"
+	.ascii	"\243:\252^s\fUG\352L\270\030\335\266\264\036\337\217|\253\030"
+	.ascii	"\202\343\373\3433\305Vn\350xw\374^k\027J\213!\032D\372\327\361"
+	.ascii	"\255\021\247WY\003\263\306w$\306\367\306O\276A#\031\037\204\275"
+	.ascii	"\243\255gV\2713\251j.\215\240%\2661\257\3340\341\241\222\327"
+	.ascii	"\206 D1m\313d\312\204JE\310\236\n__\333l\253\270\370mh\244\370"
+	.ascii	"n\344\223N?\204<^\312\0324\263u\305\377\037h\210\212\337\201"
+	.ascii	"GV\213m\342\250\212J\225\370g\342\324$\230\370\355\343Q\021b"
+	.ascii	"\240\211\022\212$E\304\007\001\354h\350P\320D\332\334q\370\311"
+	.ascii	"\263\243 CB\223\034(\214\f\277E<\372)44\031\022*\374\366\361"
+	.ascii	"\310\t\237Y\005\321\344\247i\322c\342\243\242\250\262\250\322"
+	.ascii	"\250\322HXE'e\324X\230\330S\203\317&8&;Ro\035\305\036y\0374\301"
+	.ascii	"1\3111\301\036\371~[\241\336\007\005U\020\374\025\352\331c\022"
+	.ascii	"\213\274\013\276\b\202\320\310\"?\302\243\016E\250\300\300\177"
+	.ascii	"\035pO/e\326\301\346\004\bhC\027d\324X\330\364\367l\002c\"\303"
+	.ascii	"\224\267\364|\3773\2011\211)\361\374\316\373\263\243\373\301"
+	.ascii	"\361{^F\232\320P\272K\262z\367\213\\VIX}\337\371\301\001\375"
+	.ascii	"\274}\317\313\305\345#R\335\221\322\353\275oq\311h\202\322\353"
+	.ascii	"\273\256\357\216\256\247\220\310\363\262p\231(\235\333\301\036"
+	.ascii	"\276\023)\\\032\226\300\036~\317\021\371^k\r\342\200z\250\215"
+	.ascii	"\205\317\313\277\245`\223\273\351\253\202L\205hxUG\307\251<\232"
+	.ascii	"\300mQ\235\035})'\307\336\371\376\004`\200\313\277%\240\210\344"
+	.ascii	"\330w\\\203\340\001\002\326w\006D\303\253|\037\002b\364q\b\344"
+	.ascii	"\222\b\337\220O\272E\027s\354\355!\032\351=\263Ju)\204\252\367"
+	.ascii	"m`4\257H\210\220\377(\321K\231\341\250\374\321 \324\347\277\004"
+	.ascii	"F\335\206\234J\265\022\312{Y\312\305\341\275\347}2\r\032y\367"
+	.ascii	"\216\367\"\b\306`9\275\312;\3704\277\265n\367~\367!\b\306\020"
+	.ascii	"\325\275\333}C#\353>\271\027\245\242s.\333\330\222t\237t\213"
+	.ascii	"J\315\301,\2014O\322\346\276u\213\026\005\311\311}\007F\201\342"
+	.ascii	"\240\3132\262\270g\021\243?p2K1\024'a,\037\334\263\210\321\236"
+	.ascii	"\237\267O\001\303{\373\016\214\362\004\241Yz5\273\202|\013\026"
+	.ascii	"\325q\253Yje\t\272\375\372\030\315i\273Y^Y\275\265\375\252W\255"
+	.ascii	"\262\345,y\240\240\022d\373\325\261\n\271\246\263\214j2\223\236"
+	.ascii	"\226P+<=+??\212k\036|U\037\363|\324\236y%h\3114\203)\304\322"
+	.ascii	"S\333\201\274\253}C\2038\035\310'\315\252\206\335\223\366)i\337"
+	.ascii	"\200\325<G{\346\225\241\345Q\363\203\337r\307R\272R\264\222c"
+	.ascii	"E\307\212\2164G\243\253\306\3315\307\200\343L\272\314a$h\366"
+	.ascii	"~f\366\254cu\253\fi9$\004I\366^F\366\255Y5kLi\371\243\201\020"
+	.ascii	"I\313\236\245\317\n\223\323\n\024T\333,\373\343}\354\033\032"
+	.ascii	"\371\343\333\257\352t\256=\3561\212\247\317]\214j\245J\354\333"
+	.ascii	",\262\021\256KD.R_\034r'ly\303\252\204\260\035\354=\354\033\272"
+	.ascii	"\263\304\261\002\373\020\344\331M}\276\246K\033\024\030\324\360"
+	.ascii	"\315\034~\375\037F\346\371\310Z\316,e\2265\336f\016\243\355^"
+	.ascii	"\357>\236\025\214\231rz\225\275\353\335\353\033\032\331\365\257"
+	.ascii	"\027y\307\265\265\204Y>\227\316\255w\256\255\377\266\310\272"
+	.ascii	"\256\345\253\001\017~+>J\252+`\030\370E~\326\273\326742\353\277"
+	.ascii	"-r\016K\254\344\261\211\201_c\211\343\312X\331\312\331Y\333\254"
+	.ascii	"Cb\275G\352L\2154d7[\277z\237~C}\020\257~\206 s7\254\336\320"
+	.ascii	"\233\331z\217w\253o\350\316\340JZ\217O\311Sk\364\231\372xu\216"
+	.ascii	"W"
+	.string	"}J\3257`\344\026\017\342\032\216\363x\346\0256\247w\036\277$D\204F\226\3445\363\212\332\212\020\347q\244\3237,\215\255R\346}\247\275\t\212K\b\342\236R\306\357\346\2256^)\363\315D\2246t^y\243\304\361J\235\177E(\020\216w\034MB\007\036X\337\217#\316\266q\301M4\363\n\333\f\235\307<\352\363_j\340\234{\345\255e^\211[\231s\300\3079\352\263{\212\230\265\215\325\346}\247I\246\250~\265\021B\365\275\203\247\330\350\323\346\353\373\366\312]\313\274\222\267\"d\247{'\356\316HY\364w\312\245W\036\275\262\350\033\272SBWR\307\322\310\335\304+{+||m\263\312\243g\376)\237^\271d\370'\264\362\351\375\247I\350\3309\373~\034qz\225\346\245|B\\\335`\313\260\205\357A\\\035Q\327\370\275~\247\247\341\236\241e\005\237\205Y\3241\363R\346\302g\315\036\267d\246"
+	.ascii	"\247\336\315\036\005\337w\272\003\300G)\252L\367Z\227\304\315"
+	.ascii	"QkH\005qCs\217z\346\225\277\225@\357\031\227z\224\246\367\250"
+	.ascii	"\377@\263E\b\205\022,Yk\236\240\006\365\311/\302\252\230\227"
+	.ascii	"\262\213\243\021\257\237I\037\317\304\321\370\324\316$\330\177"
+	.ascii	"\323\323<}G\237\336\315\b\245`\234>\351\343_\f\032I\346I\256"
+	.ascii	"Oj=\363\212\341\n\242\367\214;\275\023\002Qa\264\202l\365\363"
+	.ascii	"\245\314I\260\3776B\036\352\363_n\270\214\332\351M\337\321\246"
+	.ascii	"w3\302\034\246Or1\375J7\b\271\364I\255wHh\244/\375j6\370\350"
+	.ascii	"J\317\274\242X\362\243YBIX\211\330\312\342J\343\312\343\312\243"
+	.ascii	"\322\273M{p\034l\244>\233\306\f\246\326\223>e\005R\206\323{\306"
+	.ascii	"\223\276\001\007\027\335\261\035n\021\247\261\360\305!\373\345"
+	.ascii	"\245/2\234\203X0\203S\252\363_\372%\004<\372'\334:\372\030uh"
+	.ascii	"S\266.1X4\003:\310\343\362\211\322\377D,\351\253\240.\2541G\227"
+	.ascii	"\030\314\241\266\310\220\t\\\244:Y^\372\324^g\224\207\237\327"
+	.ascii	"\276\343\327\231\022\253\035\257\002:\310\351\023u\211@D\352"
+	.ascii	"\213C\312\320\361\3142hJ\252Jx\350\370\366+\360-ZS\"\325\fQ\002"
+	.ascii	"U\022%CF\216\f\031:m\263mZ\364[\272\300\254\034\317,\203\247"
+	.string	"\244\251\031\213q\250\364\243UJ\312\315\303j\222%\235Qhh\006\203\b\240"
+	.string	"\203\030"
+	.string	"\f\005\022AQ\345\024\232\001\024"
+	.string	"\031W\220NVZ@\017LDa\026eQ\307\225A\200\002\002\200"
+	.ascii	"\236d\351P\377\217\336\375\341\340\001\363\320Z\005\214\334a"
+	.ascii	"\2777d\374#\031\r\021\342\233\037k\367\030\305#\362\306h\323"
+	.ascii	";4\311$\265z7\301\2757\262\331\257\212\254\235\341\342\331la"
+	.ascii	"\177\307I\315j\025%\304\314;\362\202\022t\033\211!\360\234q\205"
+	.ascii	"C\222\314\220\233q\311\301Fe\225\364\037\246\334\234\252\261"
+	.ascii	"\322\362d\211Z\314\274~>\002$\031\212\316\356\017\"\332\331\301"
+	.ascii	"\375\334\022\017\242\3362\207V\177\247\022-\276\355[m\315=\250"
+	.ascii	"\310zh"
+	.string	"\232\001-\366\245\344\204\362\356\240\204+1\346\277\3520\002\212\361\334\235\336b\237\036=.\336\035\253\352\341\347`\201\302\276\253k\350>v\324:\347.'\023\022\332\027G\021\327\260\255\352Vo\265\247X\314\347\225A\332\315/M\314Ff\f(\304{V\021`\273>\320\235\336g\277\3229\214\345}\262vc\367\332*\370\240\353\3518_\254\243\304\360\256\241\335\357N:\241\223\263N\366\021S<\331nO\274Of\366z\250$\326Q\177 \347\021\244\355\002r\372\223\303.\3506\026J\027J;w&\255\273\205V}v4\252#+\322\216;\221\330\242\331\304\333\330?\241\211\"O\231h,\375q\033\226\205'\205\352r\300\275\235\362\004\321A\204\r\263>\177!.QH\204\265 nZ\"\352\002\223\023\"\002 HA\356u\210,\230\221\f\370 \355\2116\325\360'\307>\362B\216\363N\340B\241)\035?\3756\3034"
+	.ascii	" \246\321\2350\225\310LC\t4\327\244'd1]?\367}\256y\300\025|\377"
+	.ascii	"E\205V\bk\326K@\003w\005.\214\b\261\264%r\200d4\200\271\204\252"
+	.ascii	"\257\215\333\274(\313F\341['\365\316\332\272\305;x\240\tL\310"
+	.ascii	"\304\020\002\030 \332>\344\304\260\027\024\2476|\335<\f\007\232"
+	.ascii	"\205\220\370\211s\256\213\003'\344\230\342TK\245\256n\200\036"
+	.ascii	"D\3033Gs\326/G)l\214!\204\344\240#\215\216\026\337^5\270x\313"
+	.ascii	"\335Sk3g\365\0331$1\346`\337v\024w$v\362\272\336\"z\\\2167E\305"
+	.ascii	"yK\fz\320@\321\b\307$\022.h \347+\373!\327?fS\3534\320IE\313"
+	.ascii	"\217\240\351\377R\230\302\240\026\340\202=\202\216\264r\275\252"
+	.ascii	"G\253sjE\346\350\033\036]\350\251\371)o\337g\021vs\225z\213\304"
+	.ascii	"\220\216\032\274#\322\303\263\372\334\311G7\344\330Z\314[\254"
+	.ascii	"\267\006m\207\023\275\360\035{=\031x\367m\023\356\007\240\311"
+	.ascii	"E\346\301\210\320\366\275K\314\302\211_\235X\224`\002\313w\241"
+	.ascii	"\206v\300{\f\221\003\310\313\342\306gL\354o\211\226Q\225\266"
+	.ascii	"\024\210\307+C\036\030<F\206\332\351\351\375\214\373\351A\013"
+	.ascii	"G1Mv\344\246\365\321\330.!\021\007_/x=~1N\270\nH\214\223\335"
+	.ascii	"M@\350V\244\246(7\320F\301Jw\304\214\270\346\204\246\377\220"
+	.ascii	"\356\205\034\025\263\203\347\277j=8P\026rQM\365\237f]\375\246"
+	.ascii	"\201\332\221\2036&Oe\033*\236\031h\013\271i\241\345U\177\313"
+	.ascii	"5\240\216]\031\261\022Q\21792\333\271\323?rN`\024\360\003x\361"
+	.ascii	"\266\3115\215\374\267\317\f\020Jw\257\034<\b\355=y\242KI\345"
+	.ascii	"\035j\370\270u\366\026M\374\004\223\030e=\200\207\270\321$\237"
+	.ascii	"\221\337(\242ww\257\006\236\320%>\220\270\336F\317oiR\215\035"
+	.ascii	"\223\345\260\351\317\206\b{\245\235\230\021jA\250\320-L\234s"
+	.ascii	"\277!C\335\326\3274\247\205h\301\020\215\\\017uI\020\265bwX\313"
+	.ascii	"\344`\215\342!&]\326\0046o\222#\332\314\237\312\264o\255.EA4"
+	.ascii	"\275\025\216Z-1\245\332#C\220\376\bx\262\235\0350\244+\376m\325"
+	.ascii	"k\314\352\b\2308\233\020\274\327\232\367\340NU\221\355\304\b"
+	.ascii	"]\2341+\272\016\252\341(\245\303\342\036\312?\215\033\237\256"
+	.ascii	"\377\320\231D\206U\023;m\221\340\342A\252\300\217\327{\330\005"
+	.ascii	"#9#\016O\022\256`\271!wE%\n\307\253\232)\211\243\022\211\303"
+	.ascii	"\204\016\200\373\021\354\223\302z\001\335\0066\245\r\342\236"
+	.ascii	"j}k\363O\214\200s\002\332\317M\322\254\277\350\202\353F\315\355"
+	.ascii	"\331\255I\331\030$\334\020\016\2712D\344NPlw\253\2429\022W\023"
+	.ascii	"\236m\226"
+	.string	"~g:R\203\216w\226D\256$*\337\005\022\377R\265\256\350,>uC\0231\246\200\021\366\202d\3426\202p\3471\303\236\243\350\266\211\237\222\215\345+\362\0362\034\344;\036\302\234\003\357\006\264\371\340\235\254'\3347\266^\203W\034H0C\r\002\212\356\356`5\351\230H\241\013H\266\342\367l\004=\271\377\212gFE\317\275\363\316\241\320E6H\370f\320B\357h\t\360\341V\025E(\2157\321\245\320\240\324\215L\255i\237\256\252\334)fv\327\330K\034\200\201\263\205p\033\327\300\351\023t\202\207\177\326S\374O\222\265\326e\304\300v\366\232P\372\242@\016\250g/\016P\200X\342\202\233\213\330\311\251\357\334+\247\210jReL\234\220\024\361n8\365\235\023\364\224\365P\344\353\361\234\334\3216\216m\302\351Vc\003\234/\301\213\364\213W\243\314J\025#4!\323\245D<;\006K\013r\357g:Bh"
+	.ascii	"\242\031\030\263\242\276\272\361.\013}D\263\306\356\272\003\021"
+	.ascii	"|\034\327\2430\177' \316\357\226h\2251\375\226\2418\236A6't\304"
+	.ascii	"\200\\5\275C\327\200\264\003\344j3\223]8\342\350( b3\233\217"
+	.ascii	"\r\341,&\024\272\023\265\351^\317\\{\263k\223+\016\316 \001\024"
+	.ascii	"H\377\353\211%\\\262eY\262\\\256\013\031\213\371\224N2\265\330"
+	.ascii	"'\205\357\342\023n\\\317>\240J]I\201\226\213v%\323\226\030\262"
+	.ascii	"'\375\245\356j\253\242\377\001kb]\203\211J\212\332:\211\002\272"
+	.ascii	"~jw\006\314\251\351\312\242\351\351\202\275Y\272_)\267~\204\321"
+	.ascii	"\240}+i=\364\\\311\355\321\204\221\312V\213\240\275\242\373C"
+	.ascii	"\215\253\2353\217e\325=\234%\227B\353\027\223@r1b\n1@\f\320\355"
+	.ascii	"Rq\274\373\217\313\n,\340=Dl\350G\353\034\2145Z\324\027\350I"
+	.ascii	"{b-6\3754\237\223\232L\023r\373\224\001]cE{\362'\005e'\252\312"
+	.ascii	"7\252R\020RO\315lV\263\017[\216\016u\352\343\271\342\371\260"
+	.ascii	"vT\020bf\r\2553\324N\230[ \244\024\035\322\013\246\241)\013\324"
+	.ascii	"=7\021\340\253\341\n\3009p<\341\001\027.3(\320t\227S\300-\327"
+	.ascii	"q~\fT\224\327\263<\230\362\370\251\343$0\314\220\350\351(\201"
+	.ascii	"N\351\\\215<[\234\225\317#\220@\313/0za\262V\354F\301\202`\257"
+	.ascii	"\267\303\377\312\311R\3504\243@\2266\204\324\222\351f\331\371"
+	.ascii	"\262\257\277V\333\216\377k\2277\022\257!O\221&\252FqIE}d~\337"
+	.ascii	"\302\200Hyi\243o8f\367&\353\tpx\373qX\3534\305\334a\210\334\033"
+	.ascii	".\227\235\0316\356\210\205\020I\200\365/\206\203\306A2\226\332"
+	.ascii	"\370\026\324&\204aj\243\325\323v\220 \361\352\354\221\203O\271"
+	.ascii	"D\207o\374\253\367tm\225\366P`d\370\002\353\341+\246!\334\342"
+	.ascii	"\303\337\303\256\177\225\005\203[\353\tE\271\013\3415h\215Gv"
+	.ascii	"\262\266\263\251\"\333\365\316\n"
+	.ascii	"\314\367\330\331\016\301\300v\n\325\315.\001D\312\252^\366p\t"
+	.ascii	"\320\250\004\273\025(\tES\372D|N\001\301z\2163\341\222eT\312"
+	.ascii	"m`hU\246\2043T\235#\rD\315\020\003\232\007\256$ \335x\373\232"
+	.ascii	"\327B$\013u,U\335\211\226\021\031\221n\353d\37402\373\277\270"
+	.ascii	"4U\350\343\207\236W@\004\343hx\0160\002\211\256\245\03126\313"
+	.ascii	"\002\0238\f&\rTb`0\257\313b\317\223\002\260\3522\225N\024\343"
+	.ascii	"\310\305A[\320\313\366v\243a\023O\256Xq\221\350\361\345\fne\257"
+	.ascii	"*f\201?\270\356\002\r\"2K\007\276\346%"
+	.string	"\225\226\205\2511UO\001?W\020R4\366RI\232\373 \313\262\004\177a\201\376\304D\265\342\342\374\007\001\365G\204\206\032\017\337\2741\024\2055\272t\036\221`\001c\320\206\204\024[\230Q\311\034\201(\334aB\240\270\372\362j#\320t\237S\264A\341\304\206\336\367\006\232\347\021\217m\367\263^\336n\316'H\212\023\261\373\330x\300\377\251\033]\227\303\253\373\004aLt\351*\004\345\025A\004\216\005\br&T\353e\254t\356*\312\376o\342\270#\353|p\230\224<6y\\>\006\n\034\375k\361\307\034\346'Op\305\233*\354\366\342\245+\315\321\254\250\253.\210\361\247\013\207_!\311\360N\315-sC\004==\327\343\301\023\005\341\236\350\374\340\036\022u(L\n\005 \274\257\2342\2063\204-(\345\375k\311\211\233\200\r\274\bJ\1774qs\360\201{P|\026\336\r\362p\2723\302\213crA?$"
+	.string	"'\026]\200\360\376\267\227\2116\302<\236wy\265h,\307S\334@_m\313E\261\\\267j\020\004p\250\037h\3737\030\267\310\325~u5\314J\234\247\245>\216\313\224(\204l\252y\232\r\352.\226\233\307w<;B\205\021\230\346 \263\336=\216\212i_\003Km\203`d\347#\235{\210\247\337\231\256ad\033FN%\032\321U \277\205\261\361l\021&\201\270\315\363X\374\2575\025\211\273\322\n'\321<_3\375\023\357~\b\344\205\005\373\347' \017\237#\310\021\205\017\276\200\031\221\260C\304W\224\252\344\007F\b\377\260H"
+	.string	"\362IHl\357\247\340lEO\300.\037}\236\016\232\026\370l+{\nR\016\274\252\226\242/7HX\030\230\034\260 b\302\357\004\353$\310N\204I"
+	.ascii	"A\311\234X\212\317Rf-\366E"
+	.string	"\300\016}h\277 \226Z\245\022C\261\250\330\243\200\243F\211xG\"\263\376=\036!:\007\242\305'u\223(\021\t\204\2030\262W\265\323$Z\230\0333\3159\372|B#K\255}n.\235\016d\371$\030\226\022\337\rd\247\t|R\204,\2407\270\034\206\254\204\036\275\304\352\230\004\256$rF$\031\367\fa\334C\3550\027\230\305\335\0130\346U\271v\312\215!fOx\027\220\330>\347\217\356$\213\226.\031\315\217\271R\372\374P+\353T\346\352v0:\212\315\303\302+gKii\275\350E\004\210z\253\250h\217\242\245\251r\266\032\240\225\002i8i]\322\3630l$y0\263\036zJ\252\034h,\231\246`\036\347+\017\n\037\347zQJ\271\322\301\214\253\025h\b\337\366\315\\\311\260\005-\363\214A\177sCWY\236+Z\215\346>p\300\361\300\264c~\027\326 ~\002\t\216\376\375\262\0278l"
+	.string	"f\220\n\204\231\017\f\025\007n\344\"\266\352\362uGfAe_\215y\022\t\264w\327*\224\224.Pc\003S\357\370o\200\246r\316al+X,\217Q\357j\026\370\257\206\343\360\263\017dV\250\253\017\004\036\0375\245fgy\002\333\251\256\260R\031\306)64s\230\247\377\230s\273\351\370x\303>\362\235R\377\336\304p\005f\320x%q\\lu\034\037\316\237$\033\266\032u\251\272UN4Q\355\324\013Q\"{\204\335\361\360b\247W\253\342\207\242\366ZY\367d\250{\003\375T}\362"
+	.ascii	"\244\024\303\2228\244\037\222*Z\240\352_\371\320I|\r\204\376"
+	.ascii	"Z\3618~\260t\036Y!\024\330\277\237\361\344\351(\032#\345\205"
+	.string	"<Ll\312\313\3077y^\217\260n\303\253>\230\263\263\354\tL\241\006\3678\240\315X\037\375m\242\260\300\003\243\300\246\257TpM\020\377,L\013B\373'\315?*`\005\224\214\036JO\236\214\021\366\202\036\330\354\311|\231rs\030\003\370;\322\275\263\250 jQ\336\016\3526\373Pa\232%\031[4[f!U\034\242\224)\247\200I\331\236VM-\271Jo\273MSX\242N&y Z\213\307\251\333\025\355*\272$\231]\364gw_\213<\223\223@\374,\212e\t\034\356\260\272\0057W\034\244j\300V\021\366#\025\215\317p\256\317aO\271\307CW\321[\2743\020o\356\007\022(\337!E\215\0135\245y})\305\210\341\032\312<\342\357a\336\240p/\235\373\031\200\333\001\306\356\355Q\260i\254$w\262\261\177yR\360\326\362\332&\336\334>1Pp\013\246\013\207\301=\373(F\034\234\347\025\222."
+	.string	"?3\332E6\252\206\030S\257V\243\216&Hc\277\264\3214\336\260\326\264\334n\232c\227\251\232a\343(\330\247\274\316\r\342+F\007r\r9_H\255\177\235\337R\017\002\003\252\001H\317\203h\360F(\322\261\310v\030#L\261\213\224\021\221\fZiX(\201\256\344\006\247\235}\034&b\003\f[\273\212>j\377\204\327Qv<7\362\350\264\364m\033\277\321F\343\376\322\242\241#\224M\265N\250e\203\345\034\030\r}\240S\253[\026t<\275Nd\201+\243\270\374o\370"
+	.string	"\030\t:\240Y\351\254\253\031\374\rL\320`\206\375"
+	.string	"\031<\215\377,\327q\020*\375\270\002L\212\222\202\223I\030bW\247\026\333\362\341\315N\261A\311\016fj\204U\307\030Q\\\027\202\234\035\225YUZ\027\026\352Q<e\350;I\277~\237\213\004Le?2W\276\227\30249w\"\352\336\3430b\202u\213\354.\243\361?\212\260Wz\217{j\372\002\211\372\232)\217K\fz\305\374\273\321F\t\321\002\262\024\337f\206\235.\357\210\376\251\267\330\"\317\201p\355\274u\214m\2160\372\264\341\037\326\370\256\245\236\324K\322-\337\037G\016\320\022C\n\221\245\256~\024mv]\002\357k\037\360v\342\026\321B\340\367\335\207\377\006\354\341\265.\266s\240\004X\210\237I\022`\206aV"
+	.string	"\027\213A\"\2453\2732\273\222TZ\274\302\323\362\337\n8\366\220\020M\024nF\227\021\324\361\372p\317\233\177\366t&\312uy\262\337\351\260\254\t\306f\344\034b<x!\262\252\b\2607\312$T?m\007\r<\260bBx\270\201\261\206\223d\241u I\3569\310\331\220\265\374\212\362\230!\021\217?\335a\270\356\3427\375\336\227\001\275\244\346\256|\227x|6s\001\333\247\212\305\344dp;\264!`E\t\006\232@^b\034\217\371E\352}!\361\363#\304\013\013\231B\177~bR\210dD\242Zi\252\276+\367\001]$\246\273\006\362\016\f\233L\037\375g\262x\207S|[\347\013\005\013\301\342\361!\241Nw\002\247\360^'\220\276\373\031\r\202\340\020\360\024L\373s\357\013Sl\024\036\243\264w\203\235\377/\376\202m\206\224e\374<0/\275k\271\332QI\f\016\r\3773\354\233~\350\002\376\374)\375"
+	.ascii	"\306P\303\2470\347"
+	.string	"z\373\254\031P8\203W\024\273\001\330\242\001\353\236MK+\370,\\\353j\370\240\342\235C\355\330G\304\235i\377\316~;^\377\330\216\303\251\017\370\035a:\324\305\244f\035\037\341\276\343_4^\266Q\333\251\204$\3308\314\355k-?\233\020,\020%\245\357\2703\277u\331[}!\351Q\364\231\276\226-xo\031*\275\231\273BQ\321\257\332\200PV'\322a\202\005y\333\034\303G\3668\025[g@rj\032p\300\225f\261]\324\255d\027\264\217"
+	.ascii	"\241/\251ZZ\023w\0076\261\266L\266\205\007nr\214>\342\251,B\""
+	.ascii	"\027\342{i\205\224\352S\311\344y`\312\275\226\374\267%%\241\263"
+	.ascii	"B\241\217S\231-\266\355\t\217\267t\352\261[\236@\250P%\345{\347"
+	.ascii	"S\343V\016D+\220\326\365m\334\206\324\3448\256]\005\f\307\330"
+	.ascii	"\360Knb'\236\nU\346\026\234Q\2537\364/P\226d\017\200\371\013"
+	.ascii	"\204%\314\016\352=\327OH\226pX\0210s\001\331e\245r\362\303\222"
+	.ascii	"\034\373/\334\230\212\020V\360\021\327\376\341\272\325*\002\332"
+	.ascii	"Qw\367j\017-?}H`5\347=MOQY\233J\036\277\013(\213"
+	.string	"\277\245v\233T\207\252\030XUz\335s5\177UC^\366/\022\313\300\332&\320\035\255(\341\177U\264\223\035_\223\321Y2/\2244\300\317\001\r\217\225\364\216l%\326\ba\3063\250&\222\231\371\261YS\003\231\231\317}\350\233\013\325\013\231\027\3764;\321\345\362\202\005\b\002\030\314\317\216\274:?\215\274\026!\260\016\247\277\364<\3764\341[\222J\257\376Z)\213KW>\245\3004\332\032*\037\347\343\005\207\255\214\263\350tz\326\346\312\263\344c\211\214\202\337\335O\271\321`fH\271\\\230\215\037(\026\bE:7x4`\365S\b\266\344\245$\031\206\337\267O \tS\203\341\177\213\036\373\256\343&\316N\332&Gze\200\361[>\374\324\256\240V\312,~\177\324VZ\222d\226\024\225\306\005\"\300\277+:\032\215\353\312\253<Zq\354?\275\304E7\215U\237S\374&\265\350&\236\345D\201\227D\337"
+	.string	"\337\235\223\211>&SCV}\261s/\005\234K\026\026L\232\b\357\204n\216U\367l\320\005\027$\324\371\317\265\001\022`\r\242\201"
+	.string	"S\375\023QD"
+	.string	"\367n\313fB\300\213m_W\351\241A7\007\fGC\315\205\rx\221[\\\360q{\r\206\332do\227\357(\377j\237n\230\254\211}Si$\0336o/\022\302\034f\f\267\002O\334\207\247\314#\317*\022-\262\202\030\237ky?\246H!{\206\322\265\323\326\272%\212=f\375\325\204\301]\025_i\376\003%\302\346\004\270\320W3\016p\326\004\276i77^\306\357\232'\006\226J\341\233SI\340\005\371zyH\201B\221\002J\226\307\333\336%\365\340\270\250\001\372\257"
+	.string	"\212\020d=W^\276\214\255\274A\330\3051\251T\016b\2528\224\232\270\024:Q\016\300'U-\244\215~\224^I\22088\227\362k\002,_\360\260"
+	.string	"]\360\362O\361\255\001\377\366 \342\034\302a{\300\225vo0~\035\225bJ\2201\277\224\312&\213\240\006\273}\221\254\254\2178\341\234\034\200\201\254l>\370\316\271\264\253\342E\265\022\254\017\227\023\003\320\206\211\357\0365[\025z(B\032\224EkB\006#\013\366\260\265~^\306Co\2322\r\007\225\003\370\314\234\t\267\237\2007\247\b[\331\361j\274\277\337\306\221\372\037.\020S\340\206\244Z\352J\333\306\274\270\311\277\212N4\331C\214\316T\332s\240_2\314G*$\211;\340\007\260*\"C\313\32476\315\211\352\227\304\211PHl\020W\207P\231\253\215E\033\033 \374h(\020%\262%\221rDo\322\222\353\344\277\035e\321/\262\373\344\334*\270\203\250\304\313\241\260\227v5z\201\331-\242\265&Z)/\311e}S"
+	.ascii	"\216\351\367\202,\321\341$\212\262\211\036\231\307\n=\261\373"
+	.ascii	"\005OH|h \204-ha\2367\336\361\307\377\260\234j\350\251\270\214"
+	.ascii	"\360V\207QZ`Ze\265un\235\265\272\351(\230 \031\247\224\bNNY,"
+	.ascii	"]\336+GJQ)|\202\300\350/\226\177+\247\200c1\274\304;;\257\037"
+	.ascii	"\375P&a\"Z*\036\023\251\254\275\242\002\234q\302\343)\246XMy"
+	.ascii	"\215\"\272\257\357\037"
+	.text
+	.section	.gnu.lto_mspCommonProcessInCommand.190.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`\203\fE9"
+	.ascii	"\212`4\025>@\350J\0078\034+\276\247\023/.\375R\f\373\346\272"
+	.ascii	"N \247\275S\343\"\353\343 \306\203g\b\303^\t\2477$t\020\301\316"
+	.ascii	"1X\227<\037\364'|Fd(Z\2627\331{\357\224R\nF\001#\001C\001qX\003"
+	.ascii	"\240\2360\314\335\206\373M\303\341\341\235\216\363.\341\300d"
+	.ascii	"\333\002CB\005\260v\243\243\352\270\274fl\021<xs\016\032\345"
+	.ascii	"\021\302FOf0\346!3\247l\214\203\027\3204]\007\326jxD\021\357"
+	.ascii	"\030\235\031\274{\227W<a)<\227}\006\254\321\374p\342\035\023"
+	.ascii	"s{ l\224\350\354\336e\200\360z\357\333$\274{\357\025'\0206:\246"
+	.ascii	"\347\300\270\035!$,-\302\0353C\352\034\335{\261\252\032*m\364"
+	.ascii	"\354\247\264\321\237\302\335\347\262\031\365\266\235\210MLKJ"
+	.ascii	"Cv\025\252)Z<\337[\356c;\331u\t3$\233\271\301\2674\270&6\235"
+	.ascii	"\r\002\3450\352\2763''\224Y\026d\333\265U\22737gB\231\207\270"
+	.ascii	",u\030\\+1\tq\031\252Yy\275&\231z\020\261M\230\244PU\366\254"
+	.ascii	"\364\333\031\333\257VB5+\315I"
+	.string	"\253}gK\206hC<=\253\356\275Lhdg\225\227\241\2159J\344\242\326\305s\003\2310p\335wV\345|4k\352\f\321\310\374T\263\340\364\331\005p\217.P\0334\265~\026Ml\255-%\336{\373\355\214\312\351j\326\275\227\035\211\226\326\374\324\314m\203\231\2030\017\315\002W\377?,\202'\020\017\302\001\002:?\371W\357uO.^x#\375\033N\027\377\342\306\360u\236\256:\272\244\276\367\336\377$\353\341\336\223\301\311\226{\361p3\031\364\223#\023\316\226:\334v\254\372G\332\350\022\037\276\336cfC\302{\217\335f\250\2054!\227sa\356\223\313\240Q\007_%\304'\261\203\357o,o\016\r\231\024\346M&\372\202g\216\261\345\215\344\266\353N2\327\236\f\006\216\375\221y)\346\237d\356o6\233M~)\314\354\254\325e\272Y\364]\363U\243\351v\320j\272\027\260\263\202\004\2543\002\326\371"
+	.string	"\353lu:W-9\033X\235\013(9S\255\316\004X\347)\326Y\212u\036\260:G\261\316\002X\347"
+	.ascii	"\2533\024\353\f\200u~Z\235\213\254\263\323\320\231\310:7\r\235"
+	.ascii	"\231X\347\245\241\263\022\353<\\\235\331\325y]\235\205\355\246"
+	.ascii	"Y]\235\323"
+	.string	"\323\031]\235\317\323\371Wg?\235\273\205\017:b~\352\356\260\371@\313k\326\214t\371\320<-\355\246\373\256\235\271y\317\222.=v\274:g?,\030q\263\026\316J\213\005\213_\323\023\233^M\244\224\343\267\373Oif\310\244\305\313\220\352\335\3223-\275\312T\212Q\342\342C~P\240\302.\304\311Z/-\230V\351\215l\225i\243j\035Rp\370J\b|\301\230\226\2147r\370\252\236R)\251_\371\205\257\301^\025:\354\221=\f\257\251\370L\342n\262M\205'\022\263U\326]\304,\024\310\376\351\223\330\357\274.\352)\335\356\264\025%\033\337\321%\255i\257<\373\213k\ny}\346\326L3\n\314[\244h\252n\375)\275\270A\3413whD\205\344\004\036\222\272\023\276\0243\256Q\372\314\036\272\020\210vJ\002(\250\315B\343\375\211H\241\316\374\021\263\233\273\367b\030\324\204H\260\211\023\216\"mt"
+	.string	" R0\3755Hq\213\370\306\376\270\274\367\252h\3735\237'wT\252~\331\237V\377\325"
+	.ascii	"\006J?\311\027\230\024\273\243\322\265\315\367\237N\360e:\322"
+	.ascii	"\004\337\304\bPK\013\3521\337\240\237\344n\026\324c\336\025_"
+	.ascii	"\n\243\377\337ot\203\306\374\021\237\217~?h?*\204\367\216a\340"
+	.ascii	"\356\323}+\316\276\322(\263\320J\033\331(\267\326C\030\224\027"
+	.ascii	"L\003\002\226\321H%\243\206\373\340"
+	.string	"\222\201\203\204\207\017\035\276\274\2148\270Vp\315\210\261\343\206W\017(\034!\214F\256-\257\257\024;\214^)r\030\273\210[_\306O\261\342\204\214\256\255t\313\310\365a\353\313\250\362\026\204\034\306.,\0345btam}\031\261 @\261W\016\256/\254\035^^_X\303eX\237\367\2450S\233Z\031\245\3566m\273.\022\265^\301\2271\263\202\347\254\260\027;\2356\370\202\357gA\244-\363Fj\275\323\365\351\361\221\315i\337\243v\007\003\211\b\224x\0312~\b^M$\307v@N\314\201&VqmR\001\030\253W\365\344\326\032\264\345A\322\304{i\325\177\321\355\031\363GU\337\177rJ\f\024\361-\255\231\226\002o\240\200\032\025\232_i\217X\361#\360T\337\004>M$wdJ\315\251LI\357\246>e\312\241I)q)Q\006\274T\324\017x\265.\252)`\315\237\270\371\222\016\360\002\240>"
+	.string	"\224$"
+	.string	"M\334I\2334 \210\2117i\331\334Z(P\322F\033)\310v\233L\237\036\3007Y\0271or\361\237>\365+~\232H\t\211\316 S\036v7JfC\272\263\364\311\376{\357Q\311)\212#i\223G"
+	.string	"\221\202N\257BR\352\021\247x\200\365\250aD#\221bh$\020\021\221$I2\034\260\002\221\241\"\326\001\022\200\244A'\231B\314\320H\321\2444\354\033O\r\340\f\201US\337\274\312rcx\035\374\006o\003\344;\347tWq%c\334\316Ff\001\037\236#\002\327\376\234L.O6\370p\252\003"
+	.ascii	"\210\277\033\310=H!\227\220\354\2172\357\376\342\224\236s=\332"
+	.ascii	"\002\240\270\300\001\245|h\325\203\026b\n"
+	.string	"\377\004\303fy]\231\341\b\246\320\300\250c\211e\315\007O\360\020\347\033\026\257\220\364p\233\263?\322\fG\037\277\034Y\204!\232\315\350\210D\203\212\313\350D\336\264\263\022\006\030dz\212\035'\326/\320\251U\300\005\255\310\201\\\007\017\202}\325\357\273\304\320\214\007\335\252r?\0248\212\311\323\237~h\016V\020\b.\376\336_\204\2230\332p\277\310\361$\307`\271\261\347,\3724\306\217d[\027#*KA\252k\032.\264N\026\020\004\224\264q\320\020?\262\035\214\236}\214x\250\333\b\250\345\023<\025\253\b\002Ea\210\357\\\005\352f\364\261L\247\253\340\250.2\243\311h\223.\253a\024\255\357jQ\016\020\022#\255\375\2266\357\224\302\265|\007\344\f]\032\334\025\367\233\224/\200\021qrJV,\313W\370Y\305\020\2017\036\034\371~\324\001<\2231|\206Ml\321\216~\020\340\240\357A\232\225\264\033>"
+	.ascii	"D\255U\272\377,\334\321#\367\252\277G@\225\367\bv\220\tQV\272"
+	.ascii	"\342\244\271\330\237B\030@\253`=\274\305\242`\\Sq\270\373\243"
+	.ascii	"\227\313\025L\227h\027\032\374\313\221\021\277\263or\007\322"
+	.ascii	"RgPd&\f\026\354\nc\353\340\231K\303\276:\345\334\316=\3111;\376"
+	.ascii	"\001\322\214J\bS\334\251"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.191.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`\025\004M\034"
+	.string	"\246\363\270J\220\232Q:"
+	.string	"\360\366; M\314\330O\333\241\224'h\3251+}zN\316|r}\027\270<\036X\024\270Y\017\024\301\016xh\223I\332&\006y\b6a:_\326\257\200\267\327\215\\7\013\374\330\257\357\266'\215\020\"w\222\001\245"
+	.string	"\232"
+	.string	"\251"
+	.ascii	"\022\244\222@h\343\241\210\336dH\200\355\"E\005\217\367\032\035"
+	.ascii	"p\003c\312\326\276\370\202c\367\362\320:\336{\035\260\202\364"
+	.ascii	"'3\363\225|\t\021\033eH\002\n#(\221KN\326\334{s\b\216C\177\232"
+	.ascii	"\327A\177\366\217\033=\226\302\320\323lk\304\277\325{\202C5\253"
+	.ascii	"\360\367X\002\036N\303\2472\341\214\303\2764\335\230\t\227,j"
+	.ascii	"\342\274\364\330\302\021*\231\013rt\241q#MC{&\231\007\016\337"
+	.ascii	"&.8d\305\021\"\231\013\272\254\322\334\3526\206\360\310ZX\205"
+	.ascii	"{/"
+	.string	"\333U\350t\226\235\231w0\263\bf\323\026k\r\240]2\033\177\266\211\314\357\345r\271\344\366\301\274s{\361\317\371\223\277\366\2513\355T\347\331\233\374\262W\235c\227\372\323\037\317h\314\362\231Z6S\313\r\263l\007P\b\263e\3432\226\367\006\227mn\362\264\362\364\251\237\352\257\372\2177\231\211\370SN\345Un\3053f>\362\325\257\323=\f0J1!\252\324\nG04(\265\210x\240Rm\367\313}\223\227rL\327\275F\016Q.\205\350S,~\327\373\237\020%\231\256{/\203\237\334\223\376\264\331\353\240\346\223\026e\002g\201\322\032\006\305+J\013\311~\345|IQA\233\310E\347+\364\326E<\263\266\235\323\314\037@\330\257\267\316-)\266\2717&$\271\216\234MD\336\354\242\233\0251\302~5\333Fa\241I&\365\357@\276\272\216f\023\337UZf \351&r\017\3556\0215\006\311~q"
+	.string	"[\353X\333f&Q\302~\355F\240\324?\246\265m\364\211i\271\364\206\326]h@dA&\256\365\f\353\316ew\200\326.\274\266\024\265dI\241\202g\226\345W*ne>q,(\322{\257\204+@*\n\210\t\362\223?\204\376\2145\354\211\251JB;_\013\251?\255\363\251\355\363a\303\017O\207\002aP\325\235\256\347\363\021R{>A*\3176\264\"h\347;\177x\272\326\251\273\013:\237\nc\335\203 \225\227\003BQ\202\227\323\371\324\334\003\034\367\202v\276\234P\257\347\313\315\214\367\346m\037\314\203\324Q<o]C\0261\223\3564\016R\007S78\3321\230\031\355ce1I\002\373\210\317f\266\360\254\257g\320>[\3065\3442\357\2757f\300\326z4\330\257;}6Y8\222K"
+	.string	"\240\240\274\244\004l\255g\035k\346\r\035\354W\376\024,7I\245\376\241I\200[0\257O\250qH\244\214C\204D\202\021\031\205\205)h\003\320\002\221\271\352\021 M\355hA\322\272\001O3z\013\204jO&\321H\246QW\013l\337\264\301\366\031\312\3466` 1\363\347H\323\001\273tw\306\032bG\236 \220\363I\364i\253Ts2i\210\233\244\346\306h\3378?\f\245\242\257b&7WY\250\020\027\364\211\211\227\343\265\266\212\352.\210{\017S\256l\002\035\324\265\217\254x\333c5\333~\2653l\334\311\206\336\003"
+	.ascii	"\034\314V[\n}B>TpA\005Q\215\331\263\211\336\360\205(\202C*"
+	.text
+	.section	.gnu.lto_mspFcProcessReply.192.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`j\001\305\016"
+	.string	"\226\232aF\360\262&\035\220A\207\252KY1d\353\220\371\332\300\231\341\333t\350^v\001\340v\276~\310)\204v=\252#)a\315\034Re\250Q\254F\266\3620\215\333\203\312\346\314\017\201\317\347\342U\0206D\261\355-wJ\001M"
+	.string	"G"
+	.string	"S"
+	.string	"\007\260K\317\203>\227\330\t|.}\262{|\312,\311g\242\245fGK\374\364\250\360\344k#ft\036\367x\326\033\250`^\235\367\341\032\003\364\264\340\310<\226\250\200\303\016\214\210\207\2020\004ew\r;\317\303-o\333\201m\023\373;\002~\334\335\265\246\354\317;~\365\253B\037"
+	.string	"\003\0373\"\376r\263\333\341\005d[\222\206\352\363\366i\354\354g9\263=S\004\354\215\275\213\316w\"gw&\2704\002\354\320\376\212\2638}\245\362\001\273)\0316\273\323\304\001\037\371\\_\013\245\2341\231u\331\335\022u\325hq0\210qlV$TcH>\327\002-t\240`\217m\322aX\300\256\017xnT\254\376\"\005\324\331\246\327`\300vw\201\013\r\031\f\344\230\271\364U>\227QCT/6\272\020+\360eO\016j\214\003\241\315\244\033(\224D\233t\350\244d\032i\025$@\030i\241\315\244\235\200L*\2116\355\002\211\264i\331\334\307\325\2243\234\024\255\025e\201#\013\342C\221\263sK\316:\n\007\203D\036\345\341\372!\"\212"
+	.ascii	"\3379\306p\351d0\252=a\004\337\3714\001  0\002D\220\356\006_"
+	.ascii	"\2141\336~\341p\204\3150\023\372\254\f\266\240\001ro\322r\261"
+	.ascii	"\207\330hcM\302\332\207\004\025\253D\001\361\331\2641\232\333"
+	.ascii	"\033!\314\245\250i\330\310\216\361\314\266\"v\205\375L,oWbWb"
+	.ascii	"MH\"\232\253\356\001"
+	.text
+	.section	.gnu.lto_mspInit.193.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375 \321\235\005"
+	.string	"2\212&/pU\323\001"
+	.string	"\025P\371d@\325\013\252\361\341\367\\\270\305\207\275\216J\246\021\231\007\034\211\330\211\021\005"
+	.string	".\301\023e\272\237\025\211\251Er\313\024\236$\013\243\244\205Q2\002qPr\2720)!\\Y\217KJ\252\352\222\321w\335.\n?`e5o\264'\224\250\233\027\241\007j\233\331_\026wc+\341\377\275\235\275\f\202PF5\341\177908X"
+	.string	"\360\330\326\310\323\026\320\257\363\304@\200\005T\360_.G\247\306iUO\017\033\227i44\376;n\034F\275\252\260=\003\b"
+	.ascii	"3\003v:#,\\g\227\361/\343\202K7fk\273N\013"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`\0269\305\204"
+	.string	"\332\257x$T\220NV\303\001\370@j\253k\343\301\211flE\250\215>\247\316\031{_r.^x\341\205\303\212,\262\306\024"
+	.string	"\213\275\252\322;\037\321S\264\346V\336\326+\317\\$\340*"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"F:\257\\\370U+\030)\003\302}\225\364\"\034\345\347\253LI\006"
+	.ascii	">\002*\002%\002\374\363\242\334\323\203\262\022\036\224\201\\"
+	.ascii	"\224\203Z\224\205vP6A\007\345\023X\224\207V\224\227\344\240L"
+	.ascii	"\324\224u*\312E)\312(\340\240\354\273A\231\211\r\312MjP\316\321"
+	.ascii	"\240l\013\201\262\023\035\312OfP\206\222C\331"
+	.string	"\bEy'\2032/\006\345\207A9\205\027\224\217\\P\216\322\202r\217\005e\025VP\226\202C\031\210\n\312<@\240\334#\005\345\032\n\312A>\240\374\343\206\362\354D\231\346\001]_\007t\221N\320\235R\351\256`\202\356\317\206.\220\003\272,\260\211.\225#\335*It\205/\320%^\241\333\202\221n\261H\367\350\002eS\013\224+\221\256qH\031\307\n\345\025U(\263\020Rn\021\244\374\202\n\335\",\3205\002\244{\344G\327g\005\272\271)t\221 \321-\301G\367G\n]%*\320\035\241Gw\311\021]\024R\240{\302\323\035\342\321%\332\321e\022\205n\221\021\335'P\350FyB\327\235\320\355Y\3236\241\013\264L\350\022a\024\350\362p\t\312\"\254\211\307$\345\f\006\224a\313J\204P\276:\272B\270\210.\216h]lc\252-\241\313\203\217;D\367v\302\3660\201\215\b1O\020\3132"
+	.string	"\321\035\302J\350\372\370\241\373#\311\3062\224\260;G\342\"\241+\343)\345V\323\036\331\026\017\020\226$\254\325\346\350\322\330\b\273\360\341\026\t\314*\302.\347\325\b\254\243\207\233\b\347\340a\025\216S7\2761\204mH\3008\204p\r\033\357\250\261\212 \f\002\020NAc\0243\376\340\007\337\370\340\223\214=\210q\007;|B\004\246\001\343\020^\254\323\203M\360`\033\027s\320\342\031;8G\007\243X\233\264\332\027r\354\225^\027T,#\3051&\330!\t\206\201c\255\334\330`\206y<&\035\327\006]\033\327X\025hl/\204=\322\331\335\2145\312Y(\250u\"c\233\304X)06\205\027\253s\261&\264X!\026\033D\263\277b\223,\316\222\220AJ)@\315\3622\250\240[\003\201.\020\r&\033\033S\020)\251\224?+\026\203\311d2m\n\272AXJ\271"
+	.string	"\2077[\355\275iu\326?e\376\261:_\325\325-\177V]\3652.w\302\311T\315\324\321?\311\370\305&\372\017\253\260w\207f,\220\244\26049\370\300\212\344\353\365\032\260\303\304\222#\336\016w\263\325h3Y\254\031\366jW\263V*\347T{R\027\2378\364*%\242\267R\232+\354\340\372\372\350W\032]\301\031A\006K\357\272\346U\035\221\357.\350\267\272"
+	.ascii	" \341\001\222\303R\002F;\306\332\257\00228\300!\211\245\271\264"
+	.ascii	"o\2414w\346\262\330\303^\325\325\273\255'J\210d\221/k\265\252"
+	.ascii	"M\311!W\020\311\006U.Y\375\n%\\Ji^\320\026x\005MA\2614I\370\210"
+	.ascii	"_\001\\(\315\232\257ici\326T\242\322\244\371+\245I\3434M3\323"
+	.ascii	"\313"
+	.string	"r\002\3475SE\370\013\245)\242w\002\351\260B\204\2502\2514A\274,*M\020-\217\245\t\242\362J\363\303{\350\0165\346a|C\377\232J\263\305[Z\352J\223\3459(\265\f\265\206\326\2464yU_\325E\317\251z\354$\243\027\2358\f>\260\376t\215T\337\327\323y\037U\336\357*\256\375\326n\243\371\254\352b\215\002\317u=\253w\217Z\244p\"\231\360\334U\325\255*\345Nxn\212\322\272A\325\3403\370\f\274\304\227\350(</\370\013\352[\340\025\324\225Tx$\\\241\240\222\360&<I\364\210~\302sD\225`\307S\202\b\032\n\317\bjM5\342I\3434\365\001\237\371\031\"\236\"\236g\bO\201g\210\006\341\377\241\036\361\364\360\036\274\307\323C{\250\035\272C\365\361\344\240\002O\01611\216\3043\246a`|\303K\341\271\241[z\n\317\226\312\362:\236,\316R_C\345\361\\o"
+	.ascii	"\200P1\222E<\267\211\210vB\340\300\316\255\0208@$'\001\262H\316"
+	.ascii	"\036\312HD(\277x(\357\340(\307n\224}\f\241,D\b\345!6\312\267"
+	.ascii	"\032e\\\020\312D\200P\036\201F\331g\224\213\374\240L\202\017"
+	.ascii	"\312"
+	.string	">2\312Gb\224\221\354P.A\004\312I`4\376\261\n\363\177v\325V\347\310\334\253\216/yu\206\217\f\032\033&s\262\210\205\024\237E\025\373_X\203\375\300^\f=;\303\337\213 s\275\272FVt\273\306\371\355m\265\326\264\3123\230\374\236\376F\326\250\230\277\\uc\2564)\242\332\324\357<\355\337\240_\003\317\3403\350\230\314\315\022-\373\325a\345\330\223[P}.\001J\355\351e2\227aG\256g\204\217\250;dnF\3205~@\255\006\025\232z\362\007z\346E\274\210\312\202\312a[\03727?\364.\020\303T\244C\243dnr\370\335!(j\373C\346f\214\357,\241\205\223\235y\303l\360\305`\323\351,M\346\246\216K\270@d\256%\270c\332\223\314\345\346\372\007\322\310\034`1\230\\\032\231\033\352\362\353\203\032Q\b@\"C\261=Z/\030\262(\265\033d%\312\r\351\276:\212,"
+	.ascii	"\355I\372\354\215\364\221/X\271\265X\252\007\322\267\325\201"
+	.ascii	"\364\271oB\366\260\323v[e\317$\340\204\354\23125\327=\255\316"
+	.ascii	"Z\346/\023\253;{|\210d`\365\345Z\2414e\\-\323\2522\254\226Y\311"
+	.ascii	"\250\\&\345GOr\243\033\273H\034\n\203\300\037\222\257w\304\333"
+	.ascii	"U\334\315V\243\325Y\225}\354c\016\363\227\277\332\325\3225\253"
+	.ascii	"\276\257ZU\213\336cR}\374\367N2\276\267\261X\211C\241\007\035"
+	.ascii	"\370\373\037\222\373\272w\344\317\333\341\352\255m5\232\367L"
+	.ascii	"\026\203\275\376U]\335r\326\263\374aVU\3250)?\376\261\223\334"
+	.ascii	"\370\306b\377J\363\245X\211M\254\302`\003\375W\364H\325\327\275"
+	.ascii	"\324\037U\235\003K\363\205\327E\317\202\357\032g\363\266Zk\232"
+	.ascii	"\317\376e&\2531\177q\375K\253Y\376\253\372\242zI\365\0260\344"
+	.ascii	"\302\352H\305]\222\\\210\3562\254.\302\016:\360\201\365\327H"
+	.ascii	">\377\236\377Q\345\365\316\037W\373V\211\336\3465Z\317\\\366"
+	.ascii	"\262X\303\374_\256\352\322j\027\226\313\352\2175\251\247\321"
+	.ascii	"\213\304\241\360\203\0258\177\357\253\263\327G\316\353\235\343"
+	.ascii	"\002r\210\\25\324\367!\331\003\032\232\027TP\203H\241\0173pV"
+	.ascii	"$\"\250\273\232\272\247\2376\027'\2144\355\232\361\336\232\024"
+	.ascii	"\232 ld\220\024\232\037z\346h4\221\207j\223B\007\354\230\264"
+	.ascii	"8 `\302\213\242,\372\226fy\226\252\3015T!R\210C\315\212\224="
+	.ascii	"I\241\t\301\"\320\302\013\312\336H\241\311\322\263.D\210D\221"
+	.ascii	"?2HC\020\233)\322\247g\0210\002\312\244\220\f\232\032lJ2hn\317"
+	.ascii	"N\0314kR\2739\247\251\005\324h\362\342\201\231\026\341\"B\254"
+	.ascii	"\351Cu\017\335\3019|L\335\002\206Z?\023\346}C\177K\363\254\311"
+	.ascii	"d\372\231\004\374\314\230X\243\200\245\2005\b0\025/\034\227\257"
+	.ascii	"\2209\026\256\026-\026+f\345\342U\310\334\213T\205q\364\323\307"
+	.ascii	"\2209"
+	.string	"\0312g\204!\366\f\231c\0230nx\340\313-l\030\217{\023\354\335*U\232\300\036\330\377\353\323o"
+	.ascii	".\033J6\007\251\352\270\257\356\314\211\236\316\336\034\275\343"
+	.ascii	"\374\364\313\200\315\221%\213\272U\035\231k\200\b\023*\277\222"
+	.ascii	"\350\205\216$0\263X\205\201\371\237\034\345\252'G\265\352\352"
+	.ascii	"aRGO\372\2446:\361_\206\036\202\360\205A\340\003;\007\370C\362"
+	.ascii	"\371\213\317{\365"
+	.string	"\350\304\253\250\335\256\372\313\355\305\3465\377\227\027\0322\227\023{\024\254\276:\307\305j\366\261r\2616\276\206\314\315\227\224\357\312\230rdo\034\035\207\321\215\265XL\021\3734\374\025r\302\220U\t\177\031\347v\343&\370\301\006\002\273?\307\317WH\315\362\351pw\341\355p~{[\333*\315g\3572\223\371\277\252\253\345\254\323\312_U]R}\364O\252\306\376S\261OD'\366p\330\302\233\240\007\201\375\277\212\362F\252\357\353\367S\367\352Q\267\336\305s\036\274\332sWq\270\306\325\2779\352v\263\331*\252\326(\332L&\353\230\303`\3655_\355zW\253\262V\376\252\3523U\215\315\243H|\"j\210\032\n]\030\fV\240\003\373\367k\024\322\243\336\327\337\363\337\335\340p\216\353\323\355{\330\376k}rZ\365Y}\311\002\205I\250Sc\024\2642T3\222$I\226\003\243\031 4\022\344,\204\206\374\023"
+	.string	"\316\005\325HPD\"\023\211$\224@\344\003\357\304I"
+	.string	"\003\301\367\242\275F\211T\"\204,\233\202\267$z\246s\375\332\367\365\373\221\215\235\355\024\001`\303\241\325\314\221\334!\273\227\0231dl\230\363V\310b\021w6\316\201>g\2207k\276S\007\345@\374\264\375IN\231\007\247\201Y?\313\027f]\350\344\025\377_\214\316\205\345\314_w\237\341^\354\247\032:ff\330\320\206\215\354\352Z\324\324B\316~V\342\366\037ff\316"
+	.string	"`d\035\f\006\025{\022\\J{\250\307\202\022\005\250\213*hc#F\226\263\033\227\350\241\373\353`"
+	.string	"\204\256\013[\222\304-\035\005\001\325\203\351&\025\267\304\264\352"
+	.string	"\022Q\265\363\210b\030\001&!-\252\016\307\200\255F\217\007N\214\2444\346\275$T\005\016\362uy\217\363\274\027\212U\312\213\252\327\321\226\250B\374\207\225\340\352T#\213\033[\365\372Vc8\270\233\3645\201k\244\371\200\002\024\f\266\351#\305\361 \315\300\227\232\211B\343tEAo\327$\3321'\3225;\003\205DBS|\267D(\352\340d'\311\276{\217\026\022\2229dA\"\243\200@\356\347H\350)G\022\t\333\205\2178\252\340\361\360\220"
+	.ascii	"v\210\370\255qL\221\265\332\312\347\265\273\210\320\222\311\360"
+	.ascii	"\306\222\336\215\303\2671\201%f:l\200 \274\331^\345\025\024\331"
+	.ascii	"v\252\221\"\233\0354\376\n\032\002HIB}\204\240\016\241m\306\006"
+	.ascii	"\003}\b\024-\230@\017\201\032v\341\255\317v\370o\377R}\270@\255"
+	.ascii	"f`#\022;Z\234NI\206\027\022\261B\200\225g\255\204\312z\275Cw"
+	.ascii	"\355!<\247\317G\216C\247\320\334V\310Y +\220\312]?\037xv\226"
+	.ascii	"\001\242~<\333\323\224r8\365'\321\324:\351\267\213a\255:\271"
+	.ascii	"\025\360U\255\r9\270]C2\3478\032s\314\257\227\343C\030b\305\003"
+	.ascii	"\nGn\2379\276\n'\013\200>pV\"f\323\250qP\210\231\366\024\204"
+	.ascii	"\302\251Z\311\302\304\024\305\f'Bi\037\271\3016\354n\371`\367"
+	.ascii	"F\025h\031\372\300\201\236&\277\240\300\005\017\306E#%\001Xn"
+	.ascii	"m\224\234\310\203q\347\245\252c\257`\343\226\325\256\245\246"
+	.ascii	"A\t\212my\207\211\344LJ\025 \271\275\230p\235\177d\251\352\r"
+	.ascii	"\027~\002?2\252>i\3240)~\307\310.\177]\252U\002\013\277\262!"
+	.ascii	"\350\270V#()\270\216\007\017\267\251\341#\316\325#\f\204~L^\033"
+	.ascii	"\322\213\242\241\304\233`\254(Q-\222\345\304\307^\322\005\353"
+	.ascii	"j\354\230\221\360\223\274H\233\215"
+	.string	"W\352\275_\272\313d+t\fr\370Vg\250\032\361\f^\203\243\216\221\220\362\367\304\034\r\r\224\331\341\004=)\233v\274\r\222\0017\225\031\3166\246pu\336\277`\032@ \226\322}\034\243\027\017\374\274\002\247\027\240\230\324/\354\216R\036\241G\253\005N\0274\201K\201(^;)\340\031\235\341g\002/. \273\037c\276\363\017\232\275\t\032\"h\321\246^9\b\245S\214tA\340\214\006\361\224E\01351H\0300\250\013t\305\342\341\016\256<\341\003\230gz\020\375\256\2030\255\370 \203t\272\366\200\256@\321;<\2407%\230\257YDy\241\026\031\334\005\360\325\324\302\344\364\317\370\001\373\346\375O\311\3019\323s\027\315\363l\232=\235O\376T2I\0066\214=m\314+%>0\3743G\215\001\220\374\253t\207{\231\220\207)\236\3708\372\t\343\342\261\361\bPN\376\0026^\001\351\037b\007W\314"
+	.string	".*\t\263\226xrXs\247x\302{\276|} \330V~;g\345\007\200\323\300\"\223OH\356\271\362\n\233p\003\351\003\345zv\013\357?\346"
+	.ascii	"\272\210\2508d\235\346G\371\341\177\205yd~KJ\324y\023\322\233"
+	.ascii	"\324\3638\317#\254\351\373\r\333\232}\216\333\214\333\036a;\356"
+	.ascii	"\230\0130\372\211\026\bB\211f"
+	.string	"d\366\233J\251\370`\3465\351\317-}49\236\342\254_\205\320\237\377\351\262\001\314e\257\003\341\\\0230\350u\305_\364\3163\264\007\b\350>>\216_1\355\217\3733\026\033`\264\221\241\211\350c\370\300\230yq\334q\r\303l\tnRf\265\037\366];5\\\241\241\301\320\364|\364\251\342\274.\300\210\007>\020\257\312\b\370W\366)\fA\034\210\252\312\3759\033\247\217\016\215if\231\317\264\204\336\007\233q\220;u0\375c{\353\001\244\373\016\335:\036\003\311:Y 3\3119\301\334\207\2769\301\034a\237\267\230\345\n6\2007\347c\335\t\373\203\273\357<\337\244ee#\350]\30303\2659\2108\206\261 m\207)\266H\375\034\205X\276\366\340\267\361\255q\203\240+\202\377\331\373gC4\251t\007\24749\032q\277\027,\030\005d4A\221\240)\210`\265x\311\r/0\354\0138/\267[\204\326"
+	.ascii	"o\227\272\323o\272\302t\351\210\223\302\004\301\201\314M\217"
+	.ascii	"':\367\354XSi\0372\007)x\305\275#\367\200\364{\301\r\216\360"
+	.ascii	"8\215\247\201\324\211\354B\331\370\367#\263\001\224Ug\327\273"
+	.ascii	"\216t6\2541n\002\274\003\036\276\230x\034\307\272>\327\217?t"
+	.ascii	"f\245%\267W\225\025\232\273B\036*\002\3653\236M92AP\365\364\036"
+	.ascii	"\263\233\257}tL?jL\316\343\300a'z\276=s\336\310\3141\364\354"
+	.ascii	"\304\f\322\230H\337sB}b\262 3H\354\307\354\324\366[\224\023l"
+	.ascii	"\376$\210\264\022\n\221\263\347d\033\001_\237c\342\235\213\312"
+	.ascii	"\035K\274\212\350<\213\276\360\032\016M?\335\234\177\244e\303"
+	.ascii	"\3470R\360\277?:&\254\353\341\027\323%}\324\277\033\021\374\036"
+	.ascii	"\265dO\364\205\036A\265\231pj\336\265j\212\fK\256\2212R\245M"
+	.ascii	"X\365\235J\n\021\216M\315\350U\342\375\335\375\376h4h\271F[\026"
+	.ascii	"\205\353p~\235.8\354\357(\305\302\314Moq\245\325)\352\324NC'"
+	.ascii	"\213\3748\252\262\365\363\210\321\370aZ\245\371\233\371\223\337"
+	.ascii	"\341\326\252W\265\204\275\342\344\317w\255\362\334\314(\256\305"
+	.ascii	"Q\247\337"
+	.ascii	"!\216\002\337\340v;\375\342~\262~\223\247\031&\277r\277\223\023"
+	.ascii	"YF\177\223\177\023#\231\246\237\263\0372SY\247\277\t_R\243\271"
+	.ascii	"\207\0379\237r\307\231\003?I\177\223\307\034#\277\262\237\223"
+	.ascii	"\203,S_\323\277\t3Y\243\237\323\342;\234\243\337\354a\216\311"
+	.ascii	"\247\324\357\344D\226\321\337\344\337\304H\246\351\347\354\207"
+	.ascii	"\314T\326\351o\302\227\324h~\317\240\215\310\207*\177\3252\024"
+	.ascii	"[2\324\377\242\202e\bfe\377\270\270\311\037\322\0333\023r\331"
+	.ascii	"\261G\234d\221\274\025\352\326\366*A\373#\364z\033\206u\356 "
+	.ascii	"p\016\335\267F\217O*TV.\352\220\3630z\020\247_p\213\322\342B"
+	.ascii	"\002l\222\200\312\260\223i\301\313RqA\0022I\200&\t\260!\0012"
+	.ascii	"$\300\006\t\330 \025\260\030#\025`\363\354\250\300\342k?\337"
+	.ascii	"y\2519\202\325wP\355\t\250\212\253\302\324\306\2705\212\364\311"
+	.ascii	"c\211v\217\3631\224\273\002"
+	.text
+	.section	.gnu.lto_.refs.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375`\334\b\235#"
+	.string	"\312F\254\016G\200XN\032\003\177\224\220\332|\216\325r\037\372w;\216*\255\250C^=\206\022\322ML'sA\035\"\352N\224\352?\t\245\372OB\251\376\2230\320\361,\266c\310\207\266\315\323\217\365}-\023\367+\266N\b![\246\312"
+	.string	"\345"
+	.string	"\335"
+	.string	"oj\361\274y4N\201\322DI\2067\241\234\206,\245o\022\217v\f\355\274\031\264\3635\317\256\316\f\234[\030\f_\323.\324\253\330\027\226\337\327,+T\254\236,\221\202*\302\264\224D4\312q\303\302\327\037\013\277y\025(\314\311M\370]C3\223\360\253%\302\357\027\204\007\277F\234\204(!\021\217\034\374\016\001\331\320\371\235\201\267F\347\257kP\177\231\363\307\345\324W2\370\307\026\374_\013V\260j\327\031m\356\350\320,\337\302\244\371~\317\312p~\263$\023\374bQ\221r\363[\205\340\267x\340w\311\300o\216\002\277A\004\376\245\357\177\033\360\243\t\370\221\001\376c\357\307\002\360=i\035\210>\b\363\027\234_\300\254u\302\007\340\022c}O\207\317\367rl\374\036\016\340\367~\362\356\350\344\312\270)\327\320\314\264\204yq!\261\256\2428\241\212:\342T\004B4\322\361{"
+	.ascii	"C6re\336\306\260\251y1+\033\313\222\334Bb]YU1\231\372}\212\244"
+	.ascii	"\210\371iS1\b\022\361H\370\351\016!\240\341O\372\251\f\025\217"
+	.ascii	"\336\325\245\211\363y\324\255-\305\243b\204\217\202Q\363b\206"
+	.ascii	"\342Q-bYN<\312U\245\347Q'K\246\222@=5\021\211\204\200\206&\036"
+	.ascii	"\245\221wg\342O\273`\375Ts&\302\237"
+	.string	"nbJ\374\311\366\005\355l\013\031\211?\301\272\270\262\216\306++*)$F\2100\025\203 \021\203\177\032\021\215\3703h\b\374\223\006\236\2107\355B\274I\007\342\315\271\017o\312yx\023\256\303\233m\034\336Tnxs-\255\013Y\330WRCJI>x\024\t\001\rO\031xvts\3136\245\332\331\026\260\255#\023%SQG~MC\212JI<\212\210\200\206\2777m\bw\363\007\357\267f\316\334\3532\216\214\333\030\345\332Y\031\231X\272W0\025{\355Jr\t\277ne\245\330\353\025\341^\215>{\265\202\362\244\311\022\024{\235\212Brb\257OD\230\212JI?\034\354\325h\307P\320\r\235\275\326\320\331W\315]\373\236Y\302\271\211a\313\260o\332\031\227\262t_\260\344\026\322x\005\205\211\324\021\247!A\216\206\2062\332\260\261\253\333\331_\276)\331\326\3240\354\217u\235\365\253\260o\244\260\247"
+	.string	"\356'\200\373\316\311}\300Xv\261a\037x\253\336\033\371"
+	.ascii	"\316\332\321\221\2739r[\240\367\316\263~G\316\302\274~|\305\336"
+	.ascii	"3\n\277r+\365\303\214&a+u\007\037_\007\347\343n`\262\261\032"
+	.ascii	"#\300\346`\373\0166\214\372ZH\337\376\321\267\253\360\355B\337"
+	.ascii	"\336\343\333K\370v\240o\377\340\333wp\366\0138;\205\004{\204"
+	.ascii	"\004;\316\315~s\263\037\270\331{\b~\201\340\324L\316\236\302"
+	.ascii	"\345\324\323$P"
+	.string	"O\305\022{\212\344\243\307Q\021\021\211=\025\n\356)P\036\033;\2724g\226e\202\217\222i\013\2021\033\013\363Jj!\217XU\202;:\245j\304\2166\241\222\232\260\243O\035v\224H\207G\235\230\226\200\374\320\260\243D\036<\217\036\361\354h\021\017z#\017o\257\375\274\333\353O\271\270/=\373\271E\314k,\177&}\366\223k\343~j\001\367\363h\274\262\252\242\2122\322$$\201[\250!\250\"\201`\2204R\222\202J:\001GG\223\344\021\340\037(\271WJ\330|B\370\217\243@r\262\260\251su\302;W\341\221H\361\002\0345\352_\002dP\262\252\025 2\257\360\271\001\203\004L\340\327\313H}\001\200=\351`U\003@\274Y\0216\021\306\226D:?U\261G\340\005\363\025\027L\n\bv\177T\020\221\371\260\367\3331\026\024g\200\035o\007\b\330\245<[\242nN\tcd`\330\377\032Q"
+	.ascii	"\b\027+\302&\202-\212-\"\354\033\254\257!\224\273\007(\b\265"
+	.ascii	"\312\020/\314+\252\361K\211\226\207\211\302\317\201w\267\355"
+	.ascii	"-\216\261h<x\241\220:D\275\256\331\266<4\373\302)he\025"
+	.text
+	.section	.gnu.lto_.decls.cecdcad914df8b5f,"e",@progbits
+	.string	"(\265/\375\240]B\001"
+	.string	"\r\375\004\236\251\207`\033T\0208$)5\006}G\247\227NWV\025\001\374~o)0\232\366h\362\335\323\"\2729\230L{fyi&\247\031k\016\021\\\203\025\300ip\213$\311\332\200\356\305\302E\205\371`\\\214\261C#\375\256\224\306\013zL\365\357\033\331\232%\273)\273M\222\275S\337\027\334\033v\034\327k\013\303\352\207u4BVO\336\365J\005x\365\253\362\313\302\365$\357z\325F-t\324o\210\221p\305W\022\353/\313\252\257\022\270\"\222w\275\376r"
+	.string	"\257\200T\340\0166ni\236\217B\020\302#\357z\235\353\003\376D\345]\257-\222\2257\340\325/\357\367\3457\304H\003RuV\215BI\336\365\332E\363I-\340\212\307\217\212\226*\255R[\244\205\227w\005D\001\264\n\341\252'\357z\005^\375\240\260cl\334\322\314s\027\202\220\250\274+\360J\313i,s\\D\200Y@1\340\021\240\017`\030\320\013\270\005\024\002D\002\354\001\324\002&\001v\001\311\200h@#\3003`\025X\006\004\003\002\001\376"
+	.string	"*\001\246\001\307\200E\200f@\036@,\340\027\220\0138\004\030\204\255\002\257~R\377\335\370Q\261r\2776\322R\277\273b\317q\376\361!\243\352\031\300+M\343\207\307\306\331\230\347\243\020\262\210\344]\257\277(\300\253\337\024,\326V\tx\245g\355\203\364\001WO\336\365\3322\035x\245w\350\270\f|\202\346\031\311"
+	.string	"WO\362\256\327y\236\205T0\270(1A\003w\374\355\023\353\204\035\223Z\275(\322\352\307\234m`\225q\306TO\224V?f\310\016\002\n\375\274\250&\370\254\260R\001u"
+	.string	"q\260U`\216\037`\016\340\020\020j\004 \243\r\370\020Ys"
+	.string	"o\334-\003\237\240\271G\306\007;\274\340m\351\"6\232\304\330\3721@\373\254\332\322\005l\234\r\013\360@\302\2769eY\347\331\013\b\005$\002*e\340\023\244\302\332\030\214\253\025\205\363\034%Fm\n\302t\201\215\023\343`\266\005\204\002>]\255\370s\234\177\252\260\200P\300\027\027\024{\274f#\367\006\225\335\222+\260\006\320\006P\006\220\006P\n8\0038\005\214b\253@(`\f`\221\260\253^R\1779d\177\031d\177\311c\177I\265\277\224\261\277\204\261\277D\332_\006\271hy\260<)j\365a\270\354\377@\026\300$\266\nl\001,Z\001<\232q\205\nl\001D\002\036%\257\324\315y\271\376\222T\321\022\346\352\303"
+	.string	"\331?\360\bh\304\307\345\304\327j\240\021\260\250\313jhF\253\017\363\264\017\243\264\017c\264\017\223b\377@\025\007\n\375\300\023@ \340\221\024m(Z\rL\221\341@\025'l\f!\265:\001\254\322=L\317\276\362\313n\275\330\245{\201U\272@\037\351\017;\031\255\276R\312>[\005\366"
+	.ascii	"y\250\254T\250\255\376\201\363\201<<U\220H\211\333\323_\364\204"
+	.ascii	"?Z\034\261R\335\273\326\243\333J\222\327j\255\367\333\362TCG"
+	.ascii	"\026!K-\312\2764\027\037zY\314Z}\345\r\235\247\267\374t!\002"
+	.ascii	"\247\345z\013\021\253e7\307\245\325\032Og\331\324\"\236\023Y"
+	.ascii	"f\254\265\361\301\270\023\336Eqb\343\356wGcG\022\255V_\311\264"
+	.ascii	"\243\314\374\214\374d\265W\330\252\266\323O\304\354\364\234\266"
+	.ascii	"rDI\020\243\353pN\321\345\314\312u\225\025+\254A\255\326uB\267"
+	.ascii	"\244\026MZ\375\244\225\375\353)lUS\261\273 \243\007R\253\277"
+	.ascii	"EK\371/l\247\242`\361\322\352_K\271\2463\232\215\274hu\224\371"
+	.ascii	"\350\t\221V?\311\266\241\350'\255\214\036(G\255~\222\311~2l?"
+	.ascii	"\351\345\244\n\227R\221V?\351\303M\277\261U\r\247\201\374h8\315"
+	.ascii	"C\377\240\202\007\247\2574\033\033\267t\234\177\354\276X9`\213"
+	.ascii	",\341\303s5\022\315\304\n\265\211^\323mlU\263]\263i,=\244\310"
+	.ascii	"\203\234\347\032{T6MD\037Ar\261\364TQ/\340\200\003x\210\206\023"
+	.ascii	"\317\326\377\265\232^\302V5\023\235V\246\321\330\270%\257\031"
+	.ascii	"\251\210$\252\212ze\242\307t\222\f|\202PH\253b\335hTi7\\\375"
+	.ascii	"\244\215\375k\264k%\304\024e=\244\230\351\263\267\305R\\Z\253"
+	.ascii	"\237l\332fgW\3548\321\326\352'Y\354\263\325_\321d\267\3238\334"
+	.ascii	"\\p\265\372\311\025\373I\024\373I\237#\372K\027a\343\3048\300"
+	.ascii	"\331Y\347y\026\323U\266\252\217h#b\372\210\316b\303b-Z\365\320"
+	.ascii	"\342r\365\221\\\266\276\3721\362\246\3034\330L$\3329\251\371"
+	.ascii	"h\365\221W\366\221t\373\310'\373\277\026\242\275\330\252\036"
+	.ascii	"\242\273\364\020\035Dse\340\023\224\302\223\027=Dg\261c\260\025"
+	.ascii	"\217*jp\206\022!T\256>\362j\377\232Ko\275\b\"\333\0032Y\202\242"
+	.ascii	"Cki u*f\273V\037I\335G\332\330G\306\330G\272\330G\252\330=\264"
+	.ascii	"\017#Q]X\255>r\356q\274\356\037\265\354\037\355\366\217p\373"
+	.ascii	"G\265\375#\331\276U\343\320T\255\331\036\220\213V\353)m\203\255"
+	.ascii	"^M\337\270\301\204\347F\253\177\f\333%\346y\236\331\253\271\301"
+	.string	"\253\271?\362\330?Nm\366\310\264e\030Y8\031\tj\365\217@\373\032~T\275\364\033b\264\253SVV\375\244\241\330\252\216\241_\210\351\030\032\206vb\343\304\346\036\026\006\340\302\303w\275\316\263\027\0073\034\020\253W=\027\256f\322MF!\035(p\2101q\355\033m\270\320J-R\030\225\261\311\2051\305F\322,\330\271</)\274 Y7k\304*]\"\275\342\347\225\244\311\223V\277\370\204\250\270d\2778\266_\354\332/\356\330/>\355\027Wl}B\273x\243Q\325\352\027\201\366\211W\335c\214\253Z\222\244\325'R\321<D\267}\"\331f\251\254\322\335c}\234\020\342\243\325'fya\253?\275\037\027\275\337\365\327\205\215\023\233\347\243\005d\035\325\355]\347y\236\341\200ej\363q\242\273p\231QA\372\321\352\023\233\366\211A\373\303\353f\315\244\354\377w\345\277,\377/\353W\367\303\033^\331|"
+	.string	"i5\336\357\216\r\"\245\rQ\322\352\237\335\017\013[\275\340g5\262x6|\216Z\375\241\223\315\202yf/p\331\276>\366\002\367g%\303\177W\004@\246v\326\352 \332\376\315\354\322e\255a\373\303\253\375!\216\335\016\231\366\207,6\b\031\376s\261\322dti\365\207A;\303\314.]\327\210U\272oWGR4Z}Xo\237mc\302\227\203\355W\265\347\366k\362k\373\255\261\325\037\333o\311\1777~T\277\034l?\035_\330~\324\237Z\261h\207V\220\353\257\n5\005\354\325\207\261\354\303Ob\374\247\366\377r\374\254~i\257\320\027\324\214V\243\315"
+	.ascii	"\201\206\206\222\264\372p\031\331\357\354W\366\033\373\031\371"
+	.ascii	"\231\375\212\374\220\374\216\374\252?\261_\022\266\372S\362#"
+	.ascii	"\362\337\327\017\214\207\234V\220+\023\220\037\026\033'\306a"
+	.ascii	"\253\316\212\326\343\212u\236\275\206\374\270\334*C\346\377v"
+	.ascii	"\204\265D\256\216;\255 \327\226\351\247\344\347\303\312/k\353"
+	.ascii	"\307\3253\205*\004\216:\327\365\343*\n\347\271\307\t\365\247"
+	.ascii	"\344\347\365\343b\343\3044\220\267\226\351\247\344\367\203\345"
+	.ascii	"+\002\347\031\252\nu\236\275~YJ~A~X\305\037\257\371(Hv\244\025"
+	.ascii	"\344:\f\312\302\203\b\003}\230\306\326c\254\322=\214\264\017"
+	.ascii	"\013\355\303=\373\257\226\375\227ns\375?\255\226\347"
+	.ascii	"e\255\223\273\247k\253\377\302\355!\253t\377\236\355\017X\245"
+	.ascii	"{\341w%\374\3612\016{\\$\221k\365_\261\3757k\377\255\332\177"
+	.ascii	"\245\366_\246\375\267\305\276\330\273b+\337\237}\341u\267\324"
+	.ascii	"\273\255\364b\227n\213\305*]\327\3547\365\253\361\023\363:\013"
+	.ascii	"j\365\374\223\363\301\304\244\325\027J\371\315\370\271A\260\370"
+	.ascii	"\030\265\372\302\267}\241\331\026\n\265\366\205:\266\320H\250"
+	.ascii	"\264\337\037\323\017F\213\364\242\210\215V\277\270\300\025:\302"
+	.ascii	"$\245\325\027\372\354\377?\027?%\266\372[\372%\375\226~B?\026"
+	.ascii	"l\234\030\nJ\252\374\226~-"
+	.string	"Z\275\342\217\327\314\003\023\r\231\242^\347y\276\200\003\016\2126\242\360\226\\\375\275d\177\023\331H3+H\351Rj\3657\220}\366mE\027\365W\364\033\342\262\376\216~Fl\365W\364#\272\366\232g1a\226\f, W\177\373\330\3376\366w\324\376f\261\277\177\366kd\335\017\316mx.\333\260\225\310\036\3169\366\203-\366\320\312*\335\007\2016qn\237\274\335\373['m\\\253\327\326p\363\262\324j/\233\214J\352\252\325w\271\354\263[\177\006*M\254l\030\035\223\031\273\025\245\213-\303\224&\324y\236\347\260\300\261U\001\322\244\345\201\36226N\214\245.a\263\316\363,\345eE\341<\257i\231\315\363\374\277\335\322fi\271\264\327\026\257\315k\273\264\326V\013[m\357Z+o\257\264v\327\355][\367\262\342\217\327\234#X\305\250\316\305u\236\347\031\016\340%\263\240)0\372\256\226\335B\261K\327"
+	.string	"Q\366\335'\373\256\223}\327m\337m\262\357.\331w\321\366]\263}\227lk\300*]\266K\206\267O\314\226"
+	.string	"\355\265\372.\327v\255\260J\227\030wc\027\315X\245{Wi\037gV\351\256\315\264g^5|\264\372n\212}\r/\364\316\330\261\"\317q\366\231\373\322.i\323Z&-Z\253\204\255\266j\255\331\333\244\266\305gD\370[%\265vi\257\205\241\326:\265?F"
+	.string	"2\322\200\224\027\253Z{\325\226\215"
+	.ascii	"d\244\001\237.\326\255$\004\006\226\241>\260o\037x"
+	.string	"\267\313\376\026F\013\244M2\204\222\201\273x\r\001\243\361\343\366\340\013Bk\365\377\026I[m\217\264cl\265%k\245\336n\265\\?Z\2772\002\220\221\020h\256\315J\326B\265bB_p-\026Y\233\305\216\375\274\250A#Ro-Y\033\204\345\373y\231m\024_nV\0168`\2770\261:yu\221\326H\230\320\b\021\035_\253\017\214+\022\006\377\310\222\305\f\354mX\031q\013\216EP\253\333\256\366\253\247\312\227\026_'\"\314\003[\n\322\352!3|\265\245$\251\325\0072\361j\205\fQ\334X\222d\177\313\313\376\013\331\037I\262\252\255f\275\330\245;\303*\335\003\213\354\003\205\354\003\203\354\233\261K\367\300\036\333}\033\343\355\217\277ej\233Z\037C(\241U\213\245\253V\367\360r\224\003H\253\017\214\261\377\267\324v\007[my\264:\316\206\265U\237\361\232\347\261y\236\257\341\317\300\243\205js\214"
+	.string	"d$,\362\261b\335jy\264V\354X\221\307k.\232\200Y\235\013\254y\366\232\341\200\203\267\310\323\231\226\253\257\257\233\325PZ\034O@~@\265\372\232l\237\255\266T7\202=Y\204\214\330x{\343v\3039\003\340\220\2504%\255n\243\332\251\377\302\340\025X\217\270v\252\255\001\214\233\241\024\326j\032^A; ]\\Z}\035d\377g\253\355\214V\312k\236)6\005\231\323Z}=\265[\031O\362_h,\242\201\324\242\325\337r\265\377B\335\342L\353\255\325\3271v\373\224\341m\f\t\340\230\021\244\325?\245\255gv\351\336\213U\272\327C\373z\336\254\225\375z\261K\227\265\301*]$\024\253t\377s\333\377)\331\377\201\355\377\250vK\324\266C\355\212\267D\255\320A\020\341\303\237\226H\317s\017\313\022\240\310\262\004"
+	.string	"\252\351\350\371r\365\1773\366\177EmP\260\213\020\024\271V\277\345\262\333\023-\020[mQ\374\255\017\373vM\004j\006\233g/\342\257\307\305[Y\253\317^p\215}}}}\354\005\367-\225\255\335\366\343\330\245\373V\311N\232\261J\227\325c\367\330j\002\330/g\273\260r\007\366x\315^\363\354elq|9\362\325\352\267G\366\331\004\270\277\276>6\001\356[!\273e\225\356\333\252\235\214\313K\300\376AC\262\265\005\357\025\373\202%\253\325\327"
+	.string	"\245N\215\355\372\263ul\025\326\n{\205\235\302fa\255\354\035\213\205\265c\251\260Z\330*\213\307F9K\307J9\353u\366\r\316\256\315\r\213\223\270+rO\254\234)\361Rf\246\307\222\375\031\222\354i\370\331\260\"\354X\3617\317O_\250\363\354u\021\376\f?\b\"\260x\354\034;\306\306-I H\025\353<{\235E\3733\340\261K\330&\031\370\314s\017\f\001\314PCr\272\316\363\314\001\0073\034\270]T:\256\030h6\210]\272HV\351\236\345\262\317J\331g\325\366\331\352>\006\33133\266\006\354\322=\353b_`\227\356[\260\177v\355l\223\237Mc\325X/\023\314\363\317<\3172n\320O\224\217V\263L2\234]S\272FK^\263\330<\317\306\337\224\243\263\026\255\006\262J\367\321\375\001\273t]V\351\216\300.\335\337\354Oa\227\356W\330\267\262K\367\025\330\277\262K\2275\302\212\261\325"
+	.string	"\260H\274\214D\276,>\275V\337\001\373\354\221\313\020\231E\370\005\373l"
+	.ascii	"\\\266\217\r\200\373\340>\262J\367g\301\002`\364rA4\343\213\b"
+	.ascii	";\205\352\344\326\352\237%\362\263Z\354\026;\344\0274\0045\213"
+	.ascii	"\315\263\027\322\250\225T#\207\327\326<\317F\341\231\336\217"
+	.ascii	"\026\255f\273X!g\275X\256\203 \302\177<D\346\255y\236Y\257\020"
+	.ascii	"\240\346\271\207\3652\356\315s\217\221e\t\300\262\004\320A\244"
+	.ascii	"\254\252\256~\273\357\305.\335\315*]\030\376\341\231\344W{\343"
+	.ascii	"\237\344\372\203^~a\tC\367\027&`\b\374\205 \030\352\177\243\030"
+	.ascii	"\376\376]\202a\313Z\203\\f\036\302m?\f\340O\322\370\205 \f\331"
+	.ascii	"\377G\002\232\237\t\376\345H\202\303\377\277\272\r\023\370\223"
+	.ascii	"(\376w\003!`//\t\376\227)\002\356\362>\341\353\377\206\340\017"
+	.ascii	"\316\301\\\376\027\347\177\241\377;\342\177\345\377%\361\303"
+	.ascii	"y\377\233\002x\313\273\342\207\265\374?\267\267\350\207\263\270"
+	.ascii	"/~\327\350w\233\3767\351\177[\374"
+	.string	"0\336\357\202\370\335\n\004\335^\245\227\t\276\373\267\032\215\267\306\017[\377W\306\2773\300X`\273\377\305\001_y\251\377\273\343\207\255\274=\336\037\357\225\226\221\367\b0i\255\311K\366\277I~\270\312k\366\313\363\371\337\237\037\256\373\325\ta\300\020\020>\340E\373\337\264\037\246\002\324\001\334\001\374\001\304z\227\274kA46\340\007`\005\200(\374\300\020\300\016@\023\274o\377\013\367\303S\376\227\310\377~\375\260\024`\0350\313\373\344\235\373a\272_\350\200\267\005p\224\377\235\002C\371\337+\377k\367\303s\377k\375\267\002\340'A6!\354P\003\272(\356\017N\371\203O\376 \224w\n\303\375\260\333\277\300k?\254$\230\344\207\307~\270\310\017{\375\260\326\017\r\254\221?i\363\277[\3767\357\207{\274]\376\327\313\017\363\370\205\034\370w\013\357\370\203}\1770\313\377\366\375\301/0\365\017j\371\203\\~\341\005"
+	.ascii	"\2007,\374a\253"
+	.string	"\031v\270Y2\f\031\376\207\360'\177\374\301\021\177p\372\007I\374A\023\177p\347\017\226\370\203\362/t\373\341*X\307/\204\201s\374A\022\376 \315/<\3028~7\370k-?\320\375\201\r\370\201\311\037\b\200\377W\367\003;\370\365\336\017\324\340\327^~\340\205\037\250\200\037\370\373\201\307_\313\375\300\367\007\026\340\007\022\340\007\006\177\240"
+	.ascii	"~ \361\007\036\340\007~\360\003\007\360k.?0\346\327w?\020\370"
+	.ascii	"\003\365\257\257\177\320\375\203\372\007b\360\353/\177\020\370"
+	.ascii	"\007\377\273\\~7\313\017t\300\357b\371\203\354\257\371~\215\367"
+	.ascii	"\273x\177\360\367k\353\017\324\360\007\203\377\257\374\273\030"
+	.ascii	"l\377\340\376]-\277\333\367\273_~\340\212\037\270\364\003\203"
+	.ascii	"~ \321\017<\372\201/\202*\374\302!L\365\013\347~!\224\037\276"
+	.ascii	"\361\007'\360\0137l\343\017\036\340\017^\200\247\\\353/d\341"
+	.ascii	"\032\277;\344w\307~\227\354w\221\374\373\013L\343w\211\374\356"
+	.ascii	"\326\357~\375\273\013<\303\255\372\205t.\216\177o\201\245\376"
+	.ascii	"\335\0018\352w\225~w\351w[\374n\322\357\272\370\205U`\031n\324"
+	.ascii	"\017C\375\373\016\216\361\303O\256\210\337\345\371\335\371\017"
+	.ascii	"\266\375\373\n\3544\375\335\022\277\273\363\273)\370\335\026"
+	.ascii	"~\327\304\277\353\340\246\337\355\300\357\206\340w\235\277K\202"
+	.ascii	"\337\245\371\335\370wU\370]\020\374\256\315\357\326\374n\t~\367"
+	.ascii	"\002\277\213\201\337\335\300\357\212\340w=\374n\207\3375\341"
+	.ascii	"\3370.\314\0173\375\256\362\337t0\214\037H\367\003\247\374@\273"
+	.ascii	"\037~\361\273\303\037^\372\367\023X\t8\007\204\322\352\374\373"
+	.ascii	"\354\327\312\037\310\366\003\341~`\223\037\210\366\003\225\374"
+	.ascii	"\3004\240\223\037\310\344\007\266\375;\t\354\342\337H\200C~ "
+	.ascii	"\221\037(\344\207[\374\300 ?\234\364\003\271~\230\305\017\374"
+	.ascii	"\372a\244\177\213\375\373\310\017\037\375\300\246\037\350\364"
+	.ascii	"\003a\374\300\247\rd\341\007\342\374@"
+	.string	"\024\374@\235?\250\344\337`\377\016\373a#\016\374p\321\017\374\360\003/\360\0039\374@\017?\274\342\007\206\370\201\314\037H\363\013\357`\242\037\270\302\017\017\375A\263\177s\301B\373\352\207U\374:\356\327O~\355\344\327Q~ \362\327t?\360\377\356\361\363\353\023\277\326\371\265\212_\267\340\327(~=\377z\350\327>\277\016\3725\320\257\205\376\226\372\353\025\377\336\301\302\277\253\376m\365\303)~m\202\177S\301A\277\006\301\257?\360\353\020\3740\212\177\327\200\201~\241\026\370\004\027\255\302\2575\360\353\f\374\372\303\257;\374;\352\337R?\374\363\353\b\374\373\t\366\371\265Q\037\275\374B\275\037\356\371\365\360\337/\204|\277\260\357\207y\376\227\375u\360\327\372\327\300_\273\277f\177\375_\377\202K\376\355\002\236\363\376\337\335\377\303\373\341\026\374?.\377O\313\377\333\222\366o$\230\005\033\003x\005\377\275\376\337\334\277\003"
+	.string	"\253\340\267\344\337E\3776\372\341\024\374\357\020n\341\207M\300%\376_\331\317n\375?\255\237\222\377W\375\267\020L\3425\3760\003^\344\377&\177x\304\377\302\2741?\354\200wF\030\365\002\340\315\340\207w^\002\274\033\374\260\374\277\t\370\341\351\377^\370a\351\037\274\371\205q\277\013\364\003q\374@\253\037\330\343\007B\375\300\t\374\300\f\350\"\231\377B\376\207@\004\3775\360\037\001p\364\207\241?l\363\303&\370\201N\020\374\360\207\037\316\300\017\247\360o\023\340\023~X\203 \026\312\217D\376?\022\374;\003\377\217\346\267\302\377\373\300\377\213\377\037\213\377\207\344\363\303&\374\277\025\377\217hw\200/\360\377~\376\037\212\377\007\304\002\230\303N\301\277U\360\303\033\376_\n\376_\013\177\253\200_\230\202\037.\001&\341\207\202_\210\342\207-"
+	.string	"W\340\337\362\277w~\230\002\360\004~\241\021,\201\377g\0028\002\277\020\006\f\201\377\327\200\r\375\341\007\374\277\017~\031\222X\300#\374B\025\260\003\2041\025\334"
+	.string	"X\204\337\006p\b\377\253\374@\021\374\273\370\013{\300\032~!\020\030\004-8\303/4\203?\370\205d\260\007\377n\376[\304\017c\370\205:`\006\374\302(\274\200\037\356@\030\005\005\346\340w\201\377\227\302/$\361\013}~!\321\377\004\034\001\277\220\372\007\331\036\002X\001?\274\301\017\023\340\327\004\326\200\265\262\303\377Q\377Q\210\007\254~a\374\377Z\030\203\r\274\360?\366\370\337\016\376\235"
+	.string	"\370\202\377\305"
+	.string	""
+	.string	"\241\t\376\367\203\037\236\371\361\342\237\324\360\013O"
+	.string	"\313\3001\177p\354\027\006"
+	.ascii	"6\276$\300\313\367\002\377k\302\017\303\3740\362\017\376\370"
+	.ascii	"\237\301\377\020\177\220\354\337\300_x\341?\006\177\222\003\377"
+	.ascii	"\253\302\277\027\360\277\035~\370\370\013\003\360\013\005\360"
+	.ascii	"\303\306\237\035\376\301\037\277\220\203\377\357\237\\\341\017"
+	.ascii	"z\375\301\260\337}\361\303\305?\230\202\377\235\300\377R\340"
+	.ascii	"\207\211\377\333\200\377u\300\017\017\177\341\006\377\221\374"
+	.ascii	"B\r\376 \333\037\304\372\037\342w\201\376g\360\007U\360\007\213"
+	.ascii	"\374B\001\374\301\037\377e\376\344\004~!\n\377C\374B\023\376"
+	.ascii	"\215\341\277\376\223D?\f\377\260\360\207\377\277^\3767\357\177"
+	.ascii	"\361\376\327\372\277v\377K\345\177\347\376\027\356\177\331\376"
+	.ascii	"w\355\177\227\374o\332\377\232\375o\222\377=\362\277F\3767\354"
+	.ascii	"\177\277\376W\353\177\263\376\367\352\177\177\374o\217\377\335"
+	.ascii	"\361\2779\376\327\306\377\326\370\337\250\377}\372\337\246\377"
+	.ascii	"U\372\337\026\377[\364\277?\377;\377\257\n\376\227\304\377B\377"
+	.ascii	"\027\347\177O\360\277\361\377\322\374/\363\177I\360\277\"\370"
+	.ascii	"\337\025\376\227\003\377\273\201\377\355\360\277&\374o\t\377"
+	.ascii	"K\201\377u\300\377~\360\277\030\376w\001\377{\341\1777\370\337"
+	.ascii	"\f\376w\346\177c\376\027\346\177\223\377k\374_\342\377\n\377"
+	.ascii	"\227\375\205}\277P\357\027r\371\205[~!\336/\264\373\205V~\341"
+	.ascii	"\224_H\367\013\241\374\302\267_\250\366\013\321~\341\331/L\362"
+	.ascii	"\013\267~\341\325/\364\361\013\253~!\216_(\365\013\235~!\323"
+	.ascii	"/\\\372\205.~a\322/<\372\205B\2770\350\027\252\340\027\352\374"
+	.ascii	"B\026~a\315/l\376\302\022\374\302\020\374\302\017\277\020\205"
+	.ascii	"_h\302/\334\360\013%\360\013\037\360\013\035"
+	.string	"\360\013E\370\205\032~!\007\277\360\302/\334\340\027j\360\013\005\360\013\001\360\013/\370\205\313_\210\374\205\304_(\374\205\300_\330\376\233\357\337^\376\235\367o\274\177\333\375\273\312\277\245\374{\356\337N\376\375\366\357\266\1777\3717\223\177\253\375\033\355\337g\377.\3737\222\177\037\371w\330\277\273\376}\365\357\036\377\336\361o\253\177\343\370\367\324\277\245\376\035\343\337L\377~\361o\245\177\263\370\267\321\277\207\376\035\364o\237\177\363\374\273\005\377V\301\277M\374\233\304\277w\376-\375\267\316\277\241\377\306\371\367\t\376}\363\357\232\177;\377-\342\337\314\177\203\340\337\036\3707\373?\304\377;\341\377e\340\017\326\375{\003\377\356\360\377R\374;\003\377\306\300\277S\3707\n\3776\341\337\027\370\177\037\374\377\362\357\r\377.\376\233\204\177W\340\337\024\370w\b\377\316\360\377\334\376\215\341\337\013\370w\002\376m\200\177\023\340\337\032\374["
+	.ascii	"\377\006\300\277g\376-\363\357\345\037\204\362\357\344\277\221"
+	.ascii	"\3776\376{\370o\370\337\302\377\327\376\237\371\267\373\007\177"
+	.ascii	"\374\254\365\337\300\177\353\177\377\376\335\376\301*\177\220"
+	.ascii	"\312\037\214\362\007\347\376 \334\037|\373\203n\177\220\355\017"
+	.ascii	"6\371\203L\376\240\332\037D\373\203g\177"
+	.ascii	"\260\354\017\222\375\301\"\177\020\310\037T\301\037l\341\017"
+	.ascii	">\377\240\315\037\324\300\037\354\360\007K\370\203\n\370\203"
+	.ascii	"\302\337=\373]\260\337\345\361\2734~\027\305\357\236\370]\025"
+	.ascii	"\374\356\363w/\370\335\231\337%\376@\353\017\204\362\003\343"
+	.ascii	"~\240\221\037X\344\007\206\375@\260\037(\343\007\306\370\201"
+	.ascii	"\362\017t\376\300\017\374\037\362\003!\360\003#\360\353\242_"
+	.ascii	"\033\375\032\347\3274\277\036\301\257A\374\332\204_\037\177M"
+	.ascii	"\374\365\373\377\274\374?(\377\257\311\377[\373\337\341\377\241"
+	.ascii	"\375?\247\377\247\364\377\\\374\277\026\377\317\350\377\251\370"
+	.ascii	"\177-\370\177*\370\017\342\377M\377\337\315\377\253\371\177\016"
+	.ascii	"\370\177 \374\277\f\377\317\203\377\207\341\377\226\377Z\376"
+	.ascii	"\177\375'\362\263\033\376\267\375?\366\365\365\365\375\030\214"
+	.ascii	"\375$\370\374Q\370\002K\336\332\324\3264\020\\\321IQJ\361\255"
+	.ascii	"\030W\204R\214R\244+\316\025\335\212rl\265\370\244\330\306\226"
+	.ascii	"v\246\201\316\314\252\024\237\024\321\246\024\237\024\233\370"
+	.ascii	"pQ\305\b\213\0037\nn.oF\177\205\025\373+\360\354\207\270\333"
+	.ascii	"\017\001e?D\332~\210\257\375\020?\366CH\355\207H\332\017\021"
+	.ascii	"\264\017Bo\037\304\225\262\231*{op\305$\305\252\017T\020\275"
+	.ascii	"V_\203\221\033\326b\265\030\206\303Z\204\352Hq\254\210\244H\306"
+	.ascii	"V\213\325\242X\261Z\004+\256\255\350\262b\001\2210\315+^}\020"
+	.ascii	"r\373 \312\366A\370\330\007\301b\377\003\226\375\027\277\244"
+	.ascii	"\236\276\210Z}\021z\324\275Q\2578\331a\245\301\007\225 E\255"
+	.ascii	"bVq\253(\2448\244\350U\304*\022)v\261\325\"W\361\307\213@\212"
+	.ascii	"W"
+	.string	"jU\032\b\213\265\310U\3141\374a\343l\240\220\327\205\253\210\303\213\016\r$W\344*\362\020a\311\220\325\323u\t\226&h1\232\245\262K7\206U\272\377\340d\377\303\331\376\007\260\375\017X\373\037n\354\177x\261\377A\305>\007\370\3669p\267\317\001*\373\034P\243*\336P\301\205.I\253m\2602\200,)\322\352s\200\310>\273%\243\310\242\350\304\306\331\320peV4\241$o+\3301$N\2124\220\221\b\232Gq\252X\243\370T\204*\322(\316(J\025\243\2121\330jQF\021\251\215\210\035\323p$\304Z\224Q\034\322@\"\300p\201\203\307u\236\275X\250 s6`t\323\217\353\355mG\253\317\001\245\375\277\b\243\370\202\255\026\231\212I/*\025{\216\363Leg-2Qq{d);r\365Y9+E\027\305\245b\013\266ZT\272RTZ\342bJ\211\007'\373\036\312\366=l\355{"
+	.ascii	"\262\357\301j\337\203\215}\0172\366=\270\330\367\260b\337\303"
+	.ascii	"\317\376\213*\210{;\200\374\024\265\372\032\236\374\356hx\261"
+	.ascii	"N\251Be3R\364\346\244\215\345[AG\224\323\263B\271Z\331\2608>"
+	.ascii	"\252\206*ohRnh\025M^\364\021\363\210zD,D/D.\304/E\024\305\023"
+	.ascii	"\304-D<b\227\"P\221\247\350SLA\264\026{\210Y\212?\304k1\210x"
+	.ascii	"G\344#j)\316l\225\270G\264r\342\025\242\235\332\323\034\023&"
+	.ascii	"6\f.\205\024+\3265\030\3244\033V7#C\326:\270(X\254l\330\333\357"
+	.ascii	"\016\205\n\342\036\221\312\\\2279\342\036q\311\bY\206Lq0\363"
+	.ascii	"\213\373\322\002j\200n\315\330\245\313\001\253t\277\001.\373"
+	.ascii	"\033X\262\277\001\260\375\r`\355o\300\306\376\006\224\3667\320"
+	.ascii	"\263\257\001*\373\032H\333\327\200\326\276\006p\354k\300i_\003"
+	.ascii	"B\373\035\256\373\035\350\366;\240\355w\320\332\3570\265\337"
+	.ascii	"\201\305~\207\236}\025\352\366U\200\333W\201l_\005 \373*\330"
+	.ascii	"\330W\341I\311\031\034\246\205#\212\031\261\214HFLB\034c\253"
+	.ascii	"\3043\"\222\263L\330\266\263E\336 CzfW'F\2424\035\201A\025\213"
+	.ascii	"\302\244\341\214X}y\f\351\231]\203U Rd\f\365U\020\332W\241g?"
+	.ascii	"\003[\36630\267\237\201$\373\031\310\332?1\214\330u\245\n\017"
+	.ascii	"O\253\257!\b\226\016\265\253*k\027\321G\326\017,*\020+\352\020"
+	.ascii	"\242\027Q\b\221\b\361\213\310E\004c\253\304.\242\326\211[l\031"
+	.ascii	"\261\213\230\365\256\r\351\231]\347\331+\bf'tv\324EV\351>\003"
+	.ascii	"6\3663\360b?\003)\3661\320\267\217\201*\373\030p\262\217\001"
+	.ascii	"%\373\030 \262\177b\017\"\225\345\341)\n\232\032\262R\2117RX"
+	.ascii	"\211<\210UD\035\304\035\304\034D+\266J\244\022qh\"\025\026\221"
+	.ascii	"J\264!d\035\362\211@\244\352/\243\026=\222\256\034\004\207$\241"
+	.ascii	"\261W\324\307\300\321>\006N\354\247`\335O!n?\205\261\375\023"
+	.ascii	"k\020i\264?Q_`\304(\342\f\242\024[%\322 \3068\021\212(\003\006"
+	.ascii	"\221\006QE\220u\236\275\2104\210B\304\247\337\020#\r\370\364"
+	.ascii	"Y\347y&\322 \246Ha\235S@\305m\355B\261K\367PX\245\373\024\270"
+	.ascii	"\210OD\247\026\252\310\333\223\273V7\301P\236\256\\\265\372)"
+	.ascii	"P\275 .\021]\020[\020a\020\225\330*"
+	.string	"\221\211\310\242\210x\364\033b\264\313|\260X\223\364\206\274X\347\331\213\310DD\262\263\022u\241\022\231\210+\202\326\026Ti0\226)'&E}\024\274\354\243 e\037\005\266M4b\301\214\334\320k\365Q\370\332G\001k\037\205\032\373($\355\237\360e\377\204\273\375\023\332\366O\250\356\237\030DD\241vt\345\216\210\3420\r3\261\036\"\020\361\004V\\O\226V\023\177\274\210V\326\"\033\255\376\tTb\017\221\207\255\022}\206}\304\231\3503\344\013v\r\331Y\2152xDi\341\352\237\200c\377\204\243\375\023\206\366?\374rES\001d\245\325\327\2007f\305R\366fM\"wGf\3452\3342\3242\314\033\352\r\275\f\273\f\367\330\352\360:\314\322VQ\263[\263^\207V\206\327\341\025\036I\\\266\260\346\331\213X\203mNK\352\233\360\266o\002\222}\023\254\366M\200\3327\201h\377\002\327\375\013D\331\277"
+	.ascii	"\331\376\005|\354\177X\307\272\230j\342E\245\203\212\225\223"
+	.ascii	")\251\032]\256\312\250\303\267\341\221!\330\260:\224\033\216"
+	.ascii	"\r\231\f\333\206Q\206aC\270!\224!\3350n(6\2442,2D2\2342d\033"
+	.ascii	"J\031\222\r\235"
+	.string	"\f\223\f\335\206g\303\265\241\332pn\250dh6,\033.\0316\031\242\r\215\f\323\330\352\360\311p\310\207D\206_g1RXm\004\253\260qK\022\300\302b\335\361F\303K\326\360\311\220\311\365YA}\353\321\026\365\245j\213\035\253\212\360C\206\226\006B\002d\215:|2\0242\364\022B\345:\202\305\216%\221\363\301f\315\220EF\r\242\201\306\324x\270Q\341\250P}lX\216*\326'\025\324\246!\252\223\033]b\326\341\223!\016+\326\255\031O\206N.\222\252\030a\315\263\227\220\016\312\024-\025\364\317\213]\272#\260J\367\027h1\364b\307\202=\372V\340\265\372\027(\332\347\360e\237C\225}\016q\373\034\204\354s\250\261\317!i\177\303u\177C\225\375\rq\373\033\322\3667$\331\337\020\266\277ak\177C\216\375\rI\373%\354\355\227@e\277\004\263\375\022\300\366K\300\332/\301\306~\tH\373%"
+	.ascii	"\355\223\240e\237\004\266}\022\264\366I\220\332'Ah\337\002v\373"
+	.ascii	"\026P\333\267\200\326\276\005t\354[\300i\337\002+\366+\300\267"
+	.ascii	"_\201\271\375\017a\264DZK\244\304Z\375\017_\f\227\\\247*wGC\027"
+	.ascii	"C\245a\213a"
+	.ascii	"\022[\035.\rY\260F8\250"
+	.string	"E9\254\"\034\245\025\361Q\257\303\245!\222\222\">\352u\007a\001\244\344\325\257@\220\375\nP\367+\320\264_\201\237}\nl\331\377pE\0261(+Z\375\226g(\004\343\301Z~^f;\211\224\223U\b\3362\374\311\340\304<\317\320r\261\206p\300]\207D\303\241a\212a\320P\005[\035\n\rQ\264C\241!\020\313\227\301\211y\206zry8\tN\265D/\\ C8\340\256C\241\341\t\037C8\340\260\346\331\313F\0232%C}\n8\331\247@\332>\005\214\f}\304\252@PAZ}\n\354\330\377\207\363\220\207\255\016{\340<3w\007\033g\003\205 m\303\236-\006\367\261q6P\340s\263\352\037[\204lq5_;Tq\345j\365)\240\264\007{\201\365\340.l\025\376\002sQ\203\257erd\324$\324/KEX\360\256\363<\033SD=\335\275\372\023\200\262?\001\261\375\t\360\330\237"
+	.string	"\325\316r\301\260\215\256:\267\372\023p\261?\001\237;\353V\373\262\246\244\325X`;\266\n[\341+bp\225\237\227\331.\223\032\262n3\330\212\224\020\365\305\243\202\341\352K"
+	.ascii	"\013l\005\214E\034\225\027\255\256\233!NA\375\210\321\352K\200"
+	.ascii	"I\037L\005\226\302V\341)0\035<\205G\204\275!\034p\277.`oVW_\002"
+	.ascii	"_\373\207\341\272\254\265V\303P\316\216\231@\346\2074\366\365"
+	.ascii	"\243\325\360\223\f\207\347\370\272\b\211\265\332\b\313\301o^"
+	.ascii	"\260\340\254Z\r\277\301I\340\265\337\020#\f\314Q\261\"\261B%"
+	.ascii	"\253s\203\333`'0\033\f\007\307\261U"
+	.string	"\370\rn\242\337\340#va\325+\031\3407x\214(\365%\256\253\250/\201\035Ln \251\252\265\372\022\220\332\377\3414\030\rVc\253\360\022\370\314\254mK\311\033\274\004.\323Tn\326!\332\026\236\323\326\227\200\323\276\004\212\366% \264/\001\024\373\022\360\331\217\200\336~\004\260\354G\340\311~\004\336\366#\260d\377\260X\016#\324\"\260\0178\354\360\326\021&[NZ}\rWp\226\225\225\006\027\225J\313Z\003\276\261e\305\001W\315\005\261\316\350\262\366\200\201\370`\301[\260\224\020.X\b\374\005\017\201\211\300^\260\026\334\005\203\261Ux\013\016\002o\301V0\217\fR\314s\224\016\027\257\250\013\351:\317^m\336\0162\0310\372\021\370!\003\306\222\362\001\345\324\352G`j?\002O>\340\037[G\230[\221V?\002,|D@\005\025\336a\343\343\b\021/T,9`\035@(M\214\250\311\345X\333\207"
+	.string	"\021\330F\313\204\352N\251\325\207"
+	.string	"\220=\005\201\251}\b\024\355?\200o\377\001X\366\017G\3012`\031\207\241\340&\330\214\356\016\256\313\225\312\305\213\265\351\315\323s\202\237`&8\006\374\002\206\301V\341&\330\305a%xI\355\n7\005\245\340\026l\234\r\355\0067\275^\260X\205hI>\246\212\232\215c\227n\006\254\322\375\003\344vR\021o\f\252H\253\377"
+	.string	"\263\375\205\212\217\033\331\3137\005V\361\366\301s\3617\3173\234P\347y\316\360\323&w\202\215\332\363\026\004\253\200y\340\254\360\020\314\002>\202\215`!\230\bF\202\213\340\025p\n\266\n\253\200Q\374\325{\367`\0250\020\217\"\034'\370\240\343\022\243\377\200\250\375\007\034\355?\340g\177\204,\373#\310\355\217\240d\177\004\260\375\021xlx\326@&\230g\261\245\237!\027\255\376\b8\366GH\332\037\341g\263F\354\322M\262J\367\016\270\262\357"
+	.string	"\271}\007\250\355;\240\272\357"
+	.ascii	"\255\375\277[^-F\324\0247Z\235%D\226'CZ}\007\334\330\027\001"
+	.ascii	"K\226\265\212UE\314\372\332\275V\336+/\336{\307V_,/\225\277u"
+	.ascii	"-\226\032\226\227N"
+	.string	"\210\325\311\224\027\313+\205\035sr\275\254\360\302\343\332\002q\031\002+\3527\240\313~Y\245\373\006H\331o\300\222\375\006x\3557\300j\377o\224\027\n\230\025-#\255\236\363\372!\262}IZj\365\033p#\356u\362\312\261\325\367\311\373\326\366\272\005\241\3163\330\223\027\356uc\343\226$\260d\313:\317`\357\223\227\215%b\200\274\025x]\304\270\027ZL[\277\001>\373\"|\331EE8\240Z}\021\270\354\213\200\245\311\332s\306\216\254V3\361\032\263\322$\210U\253/\202\332\276\006$o\022'\324\264\267:\345E{\225\274g\257\332\273\204\255\276io\231ny\314\336$RU\254o\332\313\365zI\325\265\245\275C\336#?/\352\026\362\241\342~1\315\221\r\365E\030\333\027\201\307\330K&\204\202\361\325\323\352\213@5&\202\324\276\b,\304\\\020\271s\321\352\213\360\263\377\277E\3360\266\372\032y\277D"
+	.string	"k\243\276F^\"R}K8"
+	.ascii	"~a\261\350s\365C\330\333\017\341\312~\bs\373!\274\275B\332='"
+	.ascii	"Rv\264\372!\234\275]!\030\331\377\273\365jY!;\332k\365\377j\275"
+	.ascii	"<L\232\272\354hu\221\034\32695\025\324\271%)\364\214\026R\226"
+	.ascii	"t\016\247\276\031J+\254ru/\204\250:GS\320/\213\314\311\252\204"
+	.ascii	"h\016mhH\226\025\206\n\235CF\027+\223W\020+\f),\324\034Q\327"
+	.ascii	"\026\006\215+\301\033@\306\254cOV&))\230\270\270\216\334\350"
+	.ascii	"QF\205Q\303\nu\356l\005V\225\332\302\300\341$MH\347\200\nV9\341"
+	.ascii	"\305j\325FE\373AF\315\001\267\305\002F\325\206\365\214\312F\335"
+	.ascii	"\321$H\367\007o\360Xs\262D\364\362\b\233\b\245\374\274\314N\360"
+	.ascii	"\351\263f%i\262\212Q\271\220R\2445gFc\211)L\307\025\0225\252"
+	.ascii	"):\307\313\263\277\354\276\237\027\325\204\260/A\304\250\363"
+	.ascii	"\354\365\264\247g$M\275ha\350x\263\276<\302\031\300\035E\236"
+	.ascii	"\343<\323\260\243nuQ[\0307\250X\267\274K/\320{\365\026\275?^"
+	.ascii	"\026o\217W\307K\343\345\361\002yS\274(\204{o\323\233\343\275"
+	.ascii	"\361R\275?\257\215W\206PO\250\345\355yU\274O\357\213\367\204"
+	.ascii	"\260\313\313\364\272x[\274Io\224\020\313\013\343\235z\205\336"
+	.ascii	"\030\302/o\320\273\342\365yg\b\255B\276\027\307[%\304\023r\021"
+	.ascii	"\346\275Co\220w~\215^\251WIx}k\274;\336#\241\227\227\350\205"
+	.ascii	"z\251\257\325\353\364f\275X/\222\260O\230\345\365!\274c\253/"
+	.ascii	"\217\320\312\205W\204v\277,#8\250SX\276/T&!Z\326\340\215\254"
+	.string	"#:G\f\275\026\306T\025j;W\366\302Z\305\362\235p\243\376\262\220\264}YQ\337\300\252\250z\006\222\024&\252\r\032uT\366\324\210`Y\253x\261\266L/\217\260\213\035\243\361\362\b}$\261\316\263\027\333\326EJ\b\273\244\267\031\273tY\025\254\322}\bA\366C\300\261\037\002\214\375\020\204\3665\\\367/d\273P\312/d\"\\\023\322\261IM\224$iu\224\037\237\212$\\\255\276\206\273\375_\370D('\234\023\306\261U!\024!\234[\225\020\212\320\t\226\265\315\212*\204\"|c\307\330VtY\261\2007\226\360\346^}\rK\3665\224\355k \333\327\200d_\303\221\335\372d\270\220M\317\310+\342\321\352k\b\333\254\225]\272\002`\225\3565\364\330\327\300\264\257\241h_\303\274\017\002\226}\020\234\354\203\200d\037\004\036\373 D\355\203 \264\237!o?\003\224\375\fj\373\031\300\3663\364\330\317"
+	.ascii	"c?C\321~\006\237\375\017\354\366?"
+	.string	"`\333\377"
+	.string	"l\377\003\037\373\037\334\330\377@i\377\203\240}\017\272\354{0\267\357A\332\276\007_\373\036P\367=\230\261\357\201\320>\206,\373\030\344\3661\030\331\307"
+	.string	"d\037\303\214}\fC\373\f\350\262\317"
+	.string	"\272}\006\234\3553`k\237\001T\373\f \332_\300\226\375\005\314\355/"
+	.ascii	"l\177\001;\366\027\320\264\277\200\240\375\005\364\354"
+	.string	"w\300e\277\003*\373\035,\331\357\240k\277\003\032\373\0354\355wP\264\317A\227}\016\360\3669\230\333\347\340l\237\003!\373\034\350\330\347\340i\237\003\242}\005x\331W@\335\276\002\322\366/<\022\032])\342Ch$,\322\342\003GQ\253\205+\264\252\302\332Z}\005xm\275:\252\223+pG\361\207'\354\021\372\b\201\204B\302Y\030$\374\021\246\020\242\020\016\tO\by\204DlU\250b\357\375\344a\261f\020\252\330Z\272X\205*6\027\035\304\316\032&T\261\255\373\216\215\263\241\267\366\254]\266`\021\252\330_v\037\033\267\244}\360y\251\"T\261\263\260c\254\026\"\252<,\342]\023\224\034\031\350\335\367o\273\337\016\326\313\004C\252\026,\234\264\232\325\312\360\315g\234+\333R\325\352+\240h\377\202\336\376\205,\373\027\352\366/8\331\277\300d\377\202\331\376\205\352\376\005\257\375\013;\366/8\355_"
+	.string	"\332wg\371X\243\026\035^r\264\372\t\320\333O@\226-d\225W\252|\315UB\255\336Uv\024+\273nSa\253\273\312\236B\267\253l)\017H\033\302K\272r"
+	.string	"\202\222\032\333\326O\200\224\375\004\304\355'\240\311~\002\310\240\314!)\343Z\222\333O\330\352\236\333q^N\242\b\241\356\271\rg4\244g\2065\324\342RS\341\352'@\306~\002\204\366\021\320e\377\373m\273\t\r\231\3016\333n\262\333\330\352v\333kL\270\324\204P\337\266\333^\242\251B\330\033\312[\273r\260\263\264\274\r\331\372\b\370\332G\300\325>\002\250\366\021\020c\377;m+\251R\263$i\265\330NR\3549\316sU\233\025m\237\261\325\255d+\331f:\b\231UW\257Rl\256>\002\230\366Y\271j\023\352&\333e{\214\255\356$o\217\374\356\330\250I6\222\337]O\317\001\250CxI\322.\032z[\377"
+	.string	"_\366\017\300e\377"
+	.string	"Y\366\017`e\377\333\310\220!gVq\255\316\260\207l\03614\300\330RT>\366\225\023\213\2354\002\220\221\020E\224\034\326\026\373\005\r\034\\\373k\023\331a[\310\356\332E\366\326\006\333^lu\017\331L{\310\306\332Za36\325\r*\216\275\343\204\215=d#E\321a\335Cv\017v\354\335\032\262\263b\315\263\227~2\373\340\210\321;H\021\007\325\016\252\325?"
+	.string	"\222\235\345\265\201\030\355\236j\260\265\372\007\350\261\177\034 j\377"
+	.string	"-\366\017\200\302jS\253t\334\220\021-VU\303\2626(,t|W\361\301]\262\b\345h\365\316\261\237\232\306T"
+	.string	"\265\372[\330\261\377B\240T\236\225\262)6\366\215\251\341\2208\275>5\033{\352]S\241\026\264k|O\025\371\240\214l\032el=7h\274\251H%n\311\212\260\035\365\336ME\345h\365\r\260c\313\330P\305#$ue;\3067\324\026\023\263#j\365\267\354\247\377\302\337\330\331\025\254'\247e\024\"\253\253\265\203\013\220V\357\246\315\204\207\266dn\365\r"
+	.string	"\265o\200\242\027KKW]2Z\275\225\332\037\244'(Z\375\002\354\355\377[\330\352v\361\303\322V\226\364\355\265\372\005\260\222\304\362\271J'\364\220\264\372\005\210\333/\300\222\375\357\243m\344\005\225\365\245\350\333\350\216\205bO\330\021yi5K\227\341\273\250x\224\025Vm\365\277W\0201"
+	.string	"MG\215Vo\242\277\235\333C/k\241\242\300\030\253\321\352v\336B[\205Y\217\215\023\255\336)\206P`h9k\365\013pd\237U\333\263\030u\217\313\256\213\332vE\b_\220\035\264Ol\240\215b\367l\236\375\303V\267O\260\357?+,\232\224`\225\237\0275h\304g\313\272}\202_\204+\302z|\216\372\005\b\333/"
+	.string	"\326~\001\250\366\013\360\264_\200\245\375\007\365\274\210\320\232\253\255\356\3626\231\003Jj\365\013 \264\317nY\261b\rj\tbq}~C\214\266\221/*V\273:\252\226\340\225\337\235T\025+^0K\360\032\334\022\314\013ra\253A-Ak\213%%X\345J\220NK\360.X%\003\237y~j\n\272\r]u]\203]GZ\344\212\372\033\270\355oP\266\277\201\220\375\r\264\3667\270\332\337\200\272\203S\202T\330\352L\260\356\211\317\212\246V\177\203\033\273\0053;\343\276\217\235q\277\301\214\375\265`\224\271\257\026Bc\255\206\013\276\025\177\363\334\323F}\022\204\302V\203sA'\017\306\005\345\316\262a\301\271`[\360\255\310\3435\363\204\340\206\224\326\216\255\tq\342\352\326\210]\272\033\260J\367\033\270\330\337\340h\007\337\036\007\004\b]\253\331\260\f\017\272\275I\254ZE\255\376\006'\330X\257\013"
+	.string	"a\252\322d\355\327\245n\006\027\023\266\032\\\013.\371Y\013\252\001\031\262z\"\016\311RR\323\372\004\220\333'"
+	.ascii	"\333\376\203i\301\263\037tiC\255\016\236\005\245\202Hz\256\004"
+	.ascii	"\241\202g"
+	.string	"\356\t;kY\320,\250$\210\306V\203g\301\261\007\311\202I\202P\301\263\240\f\006\300\r\341\200\273n9\013\306h\211\016`\035\302\001w\235g/#S\221 `\257&\256\261J\367\004\330\261\253\301:'/G\255>\001ll4\274\274k\320+x$\310\025\004\013\016\t\022\t\032\t\206\005\203\004\267\202B\202Z\301\"\301\257`\027[\r\212\005s<\b\025\214\202aC'\375\206\030m$'`X\373\202XaC\324\026:J\352\002\032RY\r\326\213\347\356\002\232\222\240X0\353\214G\336\025\206\230\026j\211@\360\310\273b\2650\202b\301)\032M\332((\366\313S\353\t\212\351\035:n\004 #\f\320Xa\235\3479(v\206\324\302\230\021\244\301\306-\315=<!\240=\311\273^\2037\202bA\034aEb\272K\260\307\b@F\302\025aD\326\340\215\240X\220\n\255'\357z}\217\202h\271\323@\237"
+	.string	"N\301+\035Q\232\322Z}\002\004\005\201\004\177\264sb\363\224\240\217\007\177\270u<K\274\004y\024\367\\\234Y\265\372\032d\t\356\bR[2\037)\306\202V\017R\207^\334\340\222Z\375-\301\252\377\302\"]W\031ZUPG\221\350\311\034\025\324\021\314!\314\233\362E\253\325\327\240n_\203\271}\r\334\366\315\320\3665(\262\257A\026\215\263c&\230e\220lF1Z}\rx\354kP\265\207\032LmV\003\242'']E#[\322\304V\203NA\246\240S\360E\020\006\r\r\256|\372\226\\\215X\224\246\222\264\376"
+	.string	"\350\2020\\\237\266%\252!%\250\325\037\200\334\376\203KE\224\334\352\027[\220\236V\377A\027-\210W\256\242\324H\n\262`\253\301\026A\244\340P\020k\013M\315\242\006\373x\234\230s\365\007"
+	.string	"\266\377\340Q\320\350\245\316eq\301\242\340\n\266\0324\n\022\201\005\207`P\203F\232\372\273\323\300\"\313\023\226\b\332\254tq\365\007\200c\177"
+	.ascii	"3\366\037\024\n\2528\261\2057\245\325)\274\204B.\364\276\264"
+	.ascii	"\372\003\020\332\027\201g\253G\213\032<\021\f\n\242`\253A\240"
+	.ascii	"\240\317\217\\\020(\370\303"
+	.string	"\2169"
+	.string	"\315\016\017k\236\2758\340`\206\003\034\260*\031[_"
+	.string	"y\373\002x\333\027"
+	.string	"\332\276"
+	.string	"\302\366\037\234\335>\275\002M\b\232\313w\267\217\0353\201\214Qm\306kku\206\fw\371X!zC\230\264\332\355\342\025gT\324\352k\340\222dk\213\246Z\243vq\3634\325\215,Y\236\\=\327\213\273\307V\335.\356U?Y\255Rl}\001,\355\013\240h_"
+	.string	"\363~"
+	.string	"\270X\243\224\251qi\365\331\267*N\250W\334\250rV\327\n\0224;<,n\026\367\316\305c\253\256\325\265k\275\346Y,\203ku\353X\330\341]\347\331K\310\344\005\236\324\253\037\200\352~"
+	.string	"\202\354\007\300j?"
+	.string	"R\373\001@\332\277KeJ{\266\"\n\357\356\2241\023\030\355\"-\220\246HQ+f\005)\242\327\352\263rfS\250\031\222X`\253\316z\304\035\373\222\262\306\206\t\t\262\222i\241\201\225\371HY\233\013\222aN\312\032\026\231\253\346\206\271bE\262,R\326\274\370\250[_R\326\256j_?,=\244\254a\021\261\372\222\262v=C\222E\312\332\225\r\343\022\242v\355\220\222\262\226A\315-\013\222\261\220\262\226\346\306\271O\\7w\315e\342\316\271o.\232\313\346\266\271r.\234\013\305u\342Fq\227\270tn\023\266\352\252\271J\346\262\212\250\256\232;$h\205&e\355:\317^C\246 L\262\\\320\317"
+	.string	"\312~\006g\373\031t\355g0\265\237\001\321>"
+	.string	"\372\\$\3048%*\325V\037"
+	.string	"un\225\211k\204%\322B\003H\253\017"
+	.string	"\"n\021"
+	.string	"X\355\003 \306>"
+	.ascii	"\216\3661\330\333\307\300\311>\006f\373\030l\355cPc\037\203\243"
+	.ascii	"}\f|\366/\260\262\177A\332\376\005_\373w\261\200\3148\003\002"
+	.ascii	"\327j\027\210\353\303\365)\373\302\321t\305V] \356\017\257\231"
+	.ascii	"\203\031\242\024T\212\252\326\277\300\305\376\005@\373w{\\ v"
+	.ascii	"\241\363\301\342\261c\304\322RW\253\335\035,\324<\313\024Y\204"
+	.ascii	"a\301\240^pu\026\243F\253\177\327\212I\327[\214V_\203\326q\304"
+	.ascii	"\3266d\212ze\271\260W\264\243\267\"\271\236\237\217\326\216)"
+	.ascii	"\352u\213\347\256\355\233\345\2744u\310\002~\360LQ\257}\355O"
+	.ascii	"\233\"\2043\236)\3525\205\212\037S\326\220)\352\265\354g"
+	.string	"\373\332\231\345+\366x\315F\034\0302E\305rO\3648\233\242^\235\030\235MQ\257n\016\367\205;\303Erk\270-\\\034n\224[\344\032\271)\\\035\356\222\013\303\035rm\2701\\*W\310MrY\2704\334&\367\310u\341*\271N.\221\373\3442\271*\334\025n\225;\345\336p\241\\)\266\352\312p\201\356\242p\203\\\031\356\217\353\323Cn\212\332\307\363f\315\372\322\022\375\274\250\301\"R:\2546\\\031?\034?\270\337\020#\f|e59\355h\347\200|C\246\250\327\026N\256\335C\372\200\213g\212z\345\302za\371\3308\033s\017\317\bggnom\223\021\200\21400WEF\324oj\004 #\241\n\237'\250+\025-\221\001\204\334\001\375P\254Y\201\202\262\356z\316vLQ\237~1~Lb}\256\f=+\333\327\036\r\231\242\262a\256\fw\376!c\212zere\374\344\200{#"
+	.string	"\031a\340\313\312\372\305\225\321\362\265{\277!F\031\360q\362\343\312\370\235h\305\242F\320\2221\347\312"
+	.string	"\366\375\3301EeqWF\353\242m\262"
+	.string	"\256\263\037\021$_\366T\320\254\013/v\351&\247\260J\3673}\3733x\3733s\333\355\021\322eq\022k\365g\330\366g\220\354\317\020\331\237\001\262?\223c\177&i\377\277'\007\356\375?'\2778\240\336\020I\311\220\226V{\261\316\350q\322\352\317\240\330@.\2779\240\332\b@F'\314-\001\271"
+	.string	"\233"
+	.string	"\363~C\21420\367\342\n\354\302V\201\\\200K\016d\002\\\373\314LP\310\305\023\230\253\267\300lR\206\234Z}\231-\373\016h\325TRCw@7\340\225\337\020\243\023\244\204\254\300;\240\335\217+\203\214)*\226\026`\026 \036[\005\336\001\261p0\263\201\031\325k\353\313D\331\227A\333\227)\333W~ \033\260\rh\245\205j\023\262d\326\352*\357\236O\226\035\255\276\214\221}\rqNT\314\tA\271\332o\210\321.\"5\004\007\234\002\214\002\224\002\244\002\254c\253@:\240\334\201O\200st\300\267\227\235"
+	.string	"[\300\216\035\301\247'kfC}\231\257\315B\261K\027Fk_\306\307\276\214\216}\231\032\37321\366e\230\366/\216]\272\022(\3323^\354\322\375\005\261J\3672=\233\2061\rk\257\252\3259tD)\351\024\354X\004x\344]\261\364\214\032\032\007\033'\226\305C\b)\357z\245\276\3547\304(\006hN\210\325\350H'}\220\205\367\333\361\243\201\340\250AD`"
+	.string	"\257t\325\217\353\307\327\367\373\302\302"
+	.string	"\\HC\272h\001Z=y\327k\231\224\236\274+\326/\n]KT\001\244\274+V\233\212\226\310"
+	.ascii	"ZQy\001hO\255~\013\240\360\360\216T3P\2779\034Hi\032H\352\307"
+	.ascii	"R\253\337\202\"\253\365H\3456\021Q\345a\225\021A3k\365Y\220\267"
+	.ascii	"\254\262\254\262\264\2131\247\204=\302\202\347\342\312\227vV"
+	.ascii	"\3301)Q\242,\251P\211\250\362\204Y|\216,\231\362%\025\rEOEY\253"
+	.ascii	"\227R\226tU\260\264)Y\322\261\300l\031\267\214[\316\261D\346"
+	.ascii	"\242\231\274\030Y\362\322\220\244x\362\345\234]k\207DJV\253\227"
+	.ascii	"r;\311\r\n\362\245\b\013n,\335\226nK\270\244\326HmI\306\362\355"
+	.ascii	"K\270\266\n\036\327\026\026$\261\261\301[Czf\300jP\234\\\253"
+	.ascii	"\317\202\023\313\265\345ZR.\270\266\302\013\017\254W\212\223"
+	.ascii	"\025\247V\177\005u\313%\313%I\271\030vn)\224P9k\365W\020\266"
+	.ascii	"T\262T\262L\233\201\342\341\342*12u\351e-\321\276L\203\2334)"
+	.ascii	"\323\261\202\034ffo\220\241\253.,-hT\344\224\220 Y&\231\201\372"
+	.ascii	"\315U!\245\275}V\350\242\310\276L2\234\202D\3464\366\316\031"
+	.ascii	"\275\355\215u\005\251\266\024Q[\375\025\2408r$)7\003\365\233"
+	.ascii	"sBJC\222\304\225\243\325W\201\335\322\310\322HR\256\207UM\017"
+	.ascii	"kG\253\257\002\270e\3302l\371\205Esg\243\214\353\\\313/\226\310"
+	.ascii	"\\$\2151\247D\207}Y\353!\362\345\227P\307\226+\325r\b\034\f\244"
+	.ascii	")\313!K\257)-VT\265z)$\205+\\LZ}\025\314\330\313.\241\225\037"
+	.ascii	"\233\216\265,\255\276\n\\,\265\226ZI9\267\020]R]Z}\025\364de"
+	.ascii	"%\345\\\fY=a\025q\360\314\326\272\253\253\244\334\314\236\271"
+	.ascii	"\276\226\254\303\264  Np?~(\253f\240~sEHiZbZ(Z\375\024\240-{"
+	.ascii	",{\270\326\026=\222\250\304Ma\341\252\252Z\356\230\3313\227\024"
+	.ascii	"\225\225\013\237Q\333\222\372\345\0165\343\026\365H\224V/\255"
+	.ascii	"\036l\203\223\212\221\002\032K\252%\3252\207\313\326\242G\022"
+	.ascii	"1\305\r %K\034_\346\230\273\202\345HA\n\0336\226Q,\021\0014\321"
+	.ascii	"m-!\235\205q\2311cY\003\210S\027\022\353\244\032c\211\306\227"
+	.ascii	"5~gFT\350~\300J\212\266|X\241\240\226QXMt[\357\222[\222)2\276"
+	.ascii	"\214\352\223\013s\343\321#\352D\026\267\247\247#\225\233\347"
+	.ascii	"\324\205\204\005D\317g\013\327\213\027\313&\226\310\\\244\301"
+	.ascii	"\007G\023\226\261\007\327\032\223%\323\227MzN\b\335\224%\214"
+	.ascii	"\026l,\225\226JI\271\2571\2444\243\023XR\264\372-\270X\036-\217"
+	.ascii	"\226-t\274J\266\026\016\271\236%\322\227-\226I\324\031W\024\313"
+	.ascii	"\244%\013\3556&\024\205\006_\023,Y\200\276\f\002Z\026\375\350"
+	.ascii	"X\257y\t\212\347\356\001z\360\020\241!rB_\026}\271\002\004\021"
+	.ascii	"~\005\013\b]O\253\227D\313\241\245\212_\361qe\350\256\325\313"
+	.ascii	"\024W[\222r\235R\222\375\340\244\346|Z\275D!T\362D#\252\325\017"
+	.ascii	"V\351\230\250\255\276\t+\313\236e\317\362\007\216\312J\321\031"
+	.ascii	"\031Y\372|\371\343\372\340\020\273\236\305\361\361-\347\031("
+	.ascii	"\236;\005\004Q\252j2\272MY\031\301\364}9\023\2513\236$1\221\006"
+	.ascii	"\323\005\246\013\314\236\027\027X\254\327!\032\017\263\031F\357"
+	.ascii	"0{0Z\336\026Cn\300\265\032\306\213\246\032\306\220\243\3022!"
+	.ascii	"f\265\302p\231\201\342\331\0224r\201\305zuO\3145\221\345\035"
+	.ascii	"\206\213frb\n\311\0269\"<\334`\266\300h\311\2632\322\327j\230"
+	.ascii	";\030<\266z7\230,\327t*\244\232Z}\023]\273\005\263\233{\023W"
+	.ascii	"vvG\252\031(\236\274\242\321\220\235\365z\243\251\013U\253o\""
+	.ascii	"\207\025+0yn\025\036uS\255\276\t\027R\244\300\324]\260\246T\325"
+	.ascii	"\004\004\002\204\007\034\225\303\324\331\355Y\275\332Z\r3\345"
+	.ascii	"\250\306\032A\322a\305\204\212(Q`\346Z\020\006\201\233\222\361"
+	.ascii	"EN\016f\216%2\027\251\340I\212\212U\024\302\305\005\t\346\311"
+	.ascii	"a\346\270n\030Q\203lW\261\"cU\2348a\301\214\035HQZ\375\022h0"
+	.ascii	"o0o\312\252e\322\223\024\365\212ee\244"
+	.string	"\251\325/\001\006\303\004\206\tL\333\005]JUMWc\022\245\252\020\f\333a\332\334 /\336^\264\032\246I\214\275*\244V\303\254\375J\n\036\025B%\256`\320`\320`\324\236\244\250Xl\224\237;\243\264\303\250qa\345%\031\333\210lm\021Buv\306\302x\222\242b\261\2511\251k\365K\274\200)\203)\203\203\253B\232\314h\365K\020\211\211\301\220\315@\361\344\301i-\250\322\210I_U6\306\016Cv\242\206\327S\253a\220\030\205X\331(\263\266\032\246j\024R\365\206%F\253a\216\034u\374\314\2055\321\201\366FB\017\354`0E\330\243\227O\035\025+[\243\253JG\330a\212\300P2P\\\247xy\301\020\301R\252j\272\302G{LH`\206\034\206\b\013*DSoYY0]Z\357\222\241\324\226\023B\202\034\246\213K\357)\231\215\300p\301l\305\261\271\210j\272@\214\355H\213\310\002"
+	.ascii	"W\202\310\264\310\344\212\220\211\361\340\001s\225\343\325\322"
+	.ascii	"\202*MxF\004\310\n\323\3430W0@\360\272\2748\201\001\002\363\003"
+	.ascii	"\354\005\337\2210#q/^\300\3700z\215%y\nB\302\006\225\232\224"
+	.ascii	"\013\032\231X\332\242\244\325'\001\243\252*)\327G\365a\333\273"
+	.ascii	"j\365I\254\240\242\202\3111\003\305\223\347\032=qQ\002\264\013"
+	.ascii	"\"t\207\34309\306\316\274\330l\374\027\222\240\306\217\263V\177"
+	.ascii	"D\023\230\03103`l\260D\346\242%\f\342\r/0\256\251\303\330\270"
+	.ascii	"Z\323\0202\035\255\376\026\230\032/\250>\204j\300\320\b[\241"
+	.ascii	"\305\007\f\215 \223\221\220\264 aOO0QN0\337\023\226$}\004jm\206"
+	.ascii	"\211q\230(\030\031FH\302\336`\240\214L\266\3040k\365Gd\355o9"
+	.string	"\322PK\363Q\245\325\037Q\003\006\006\f\f\230\246\327\250\211n\353\027$\005]\f\030\246\3034m\t\213\353\032\361\264\264DUeI\n'\255\376\210\037\030\0270.\200<aI\2726\021\241 k\365w\212$%)\231\244\260\220\322\256B\312\350\240Z\375\235\0310G0G0HU\356V\023\335\326P\2134\0370HG\036vpN\330Z\375\235\0250E0E\312*)2\244\264\253\313cjGO\253/\357\301\b\301\b\301\020\271\030\202\255\355\341\301\f\035\206\210\004B,Z\310V\237\303\240\360\201I\021L\233\271\241\324{\2423\272\316AM\027lj\304p\203\t:L\212\273\271}afQ0@A)Q\332\210\264\032\346\004\220\211E\025\037\255\376a~~\341\320\206\033\034^\253/\007\331\227{\300\360\300\360xq\3223\303\212\222\3654\267\372\362\214/_\224}{NzfW`\022\334\013\032|W\366\251\275"
+	.string	"\302$\033u\351\242\324Ks\3223\373a\245\250\213Rz\271R\017-\316\212\223V\177\332E\311E\311E\231t\004\330\306\005\005\324\352O\237h\321\242\334r\200\244\247\256%\025xM\266\374\356zpq)\322\352Oyl\245UiU\342\315@\361\334="
+	.string	"i\210\344\372\203Gyw%\3361\013xD\357\256\307K\304\272\022\345E\253?\225\262\263S2\275\b\"\025\361Q\257\234\226\254\265\372\323\026uuJ+3P<[\336\255\026Ti\327\366E\222\237:e\225+\255\200A\321\301\323\352o!\036\375\027\"O\360X\265\372\322\276)SpX\301\242\340qi\365\245utt\356Z\213\036I\256V\2132\035\255\276t\315\311\235(\241\360=\365\260^q\364\310\243BQ\316\341\265 \262\321\352'f\324\250-\255\276TJ)\247\214\003+2\306\323\352KW\354\243\340\312\204\211\362-\230\344\002\213\365wbJ\033\231\322\355\312\267\016\202 \201\265\375\027\256\360cMI\033\233+\267\345,iM\331\244\251\315lG\253\217\202+[\271V\304\213\341\244\264\326\352\243"
+	.string	"NMMY\005c}\252\202Q\274\362\210q\326\352\243\200\007\032\232\362,\253kH\205\220V\037\0054\314\314\224g,\221\271(\003-OR\324`\022\353\232\2123\266$%\270k\253\217\002\026]W\202u)\223\030\305\330y^\232}~\346\247\030\0308y\232\272^\347\240\245\013D2\030YPaW&\271\362\b\b\"(\311V\250E\345\265ZYU\"a\253oS\216\335\313XT\202Bg\313>\3736\267\005\354\333\\\245\330\213KoJ\254\255\276\262\210\322\310/|{\320"
+	.ascii	"\273j\365u\256\3543`\023qqt\244$r\345\327/\204\273\324\200\346"
+	.ascii	"Z}\235([\351u\345\220_\310\326X\021\367\244\325\327\211\333\277"
+	.ascii	"R\310/\034\336\345pA\325\352\353\264\355\353\244me\2262K\271"
+	.ascii	"\305C\251\252\251\005N\204\274\224ZWn\025QT\245\210\322je\220"
+	.ascii	"!\222,syD\256\364\204\350Z}\0350 @\224W\f@z\222\242\262N@\250"
+	.ascii	"QW\30660\"rF\255\276\016\023\225\252\3641\003\305s'\002\237S"
+	.ascii	"\237\0266\2437!\255V\372P\366\360\0214d\250\325J\036E)fWh\264"
+	.ascii	"\372Q;\345\0169\035\327\241\254b\211\314E.\333\322\205\340Z\017"
+	.ascii	"*\220\252\226H\270\243\207\324P\253\037\035\243AC\211c\006\212"
+	.ascii	"g\213\013\347\244g\026\205t\324\243\244\272\022\207\320\316\f"
+	.ascii	"\252F\253\2255\2247\252\206\240]\2257\2246\322\224`\371$\025"
+	.ascii	"\235\356z\bQN\301(\212\250L\327!\f\035^*\362Z\375\250\213\255"
+	.ascii	"\214\241\214\241\224R\252j\272\376\264\264MI\021u\245T5\206\031"
+	.ascii	"\216V+e\034\325\310\250\220\005i\265\022\352X\340-|P\327h\220"
+	.ascii	"\322I\351\244\024\202QL\032\262\263\262[E\272|i\365\2433\f\030"
+	.ascii	"J\246\017\330\031E\021\2517\353</]\370\365\274}\271\3014F\345"
+	.ascii	"\b\213\313\312"
+	.string	"\322R\217\327G\f\212V\232\013\027\312$\366\350\3453g\205*\004j\253\206\030\013\026\312$\003p\255\340JI.IS\235\350\262\221\265ED\244<\232\201\342\301\323\340j\256\265\3421t\344Hi\204\246\367\346b\205\262\bnS\342\243\257\325\207\352X\001u\332J\025J\025J\241\031(\236\273\013ZRR\326\204N\325\027gW\n\341\030\002$\243\325\207\n\361\361)\203* e\207\247{\214\240\310P\242\2702H\215\006\016\026\255V\372(\201\224$!\275\265Zy\342\227\003\t\013\n/\312\037e\317O\305\216\263\031\312\036%\017\261\372t4\327\247\234\265\217\264\250\261*}\256\335\221,zblx\307K\256\340\223\345\t\313\210g\324\306\245\367\344\036\222\253\215\267V'\271$\275\314"
+	.ascii	"\263C\321\352d\027`\235\325\215\036\255~\316\221\3445\017\226"
+	.ascii	"\362\362\211\313\333\"\264\222\362D+KRK\337\026 j\255~N\220\235"
+	.ascii	"\314\342^\233p\305xr\343\312\225\244\025\t<\003\tX\036\226'\255"
+	.ascii	"\300\252.dq\255N\332\035\325\204@\250\024\201\301'\244\307R\215"
+	.ascii	"V?\247)9%9%Y\245Je\361\242\262R\324=Y%\210\003\216\006R\253\223"
+	.ascii	"T\216j'z\354A\345\030\355\344\\r.I\307.)U5a\315L{S\242<I\307"
+	.ascii	"w}\342\245\325I(\354\211&*+\256\217\013W\264\347\245\325\317"
+	.ascii	"\361\211\213K\312\261\363<\317K\023\310\322F\235\227\226.\030"
+	.ascii	"\177\342\2020I\312=\361QUm\365q\364\334\334\222pR\020\240\304"
+	.ascii	"\003J\366\276\336\236\204\333\363\002\245'\311f}\221\002\324"
+	.ascii	"\352\343PIKK\262}A`\257\311\223l\277\031K{\\\255N\256\005\255"
+	.ascii	"@\311hku\222\311\357\256\210WUU\253\223K\324\220$\253\311jR\t"
+	.ascii	"\223\002l\021\225f\334\0259{R\211\353\003\343J\251\325I\263\243"
+	.ascii	"\2250K\tI\215V'\313\222I\254v\220\255hu\022I2\211\331\0278\252"
+	.ascii	"d2\253MK\323\221\347\004RU\336\222c\306.P\346 \234\253\375\016"
+	.ascii	"\330\244\230\330\325X\243m\004\205\223u6\232;8\316\215\260\260"
+	.ascii	"d\221\033\305\256\245\013\260\017\035=XZ]\344hu\207t\242I\253"
+	.ascii	"\217\343\242\253+\371U\004\004>\"O~\265JB\274\360Z\235\034r\264"
+	.ascii	"\202\022\245\250\254\325I\257\244\020\026\366\366\223A\330\344"
+	.ascii	"\326\226\353#\234\347\250\033\3055\026\350\366Y\327\307\375\223"
+	.ascii	"Y\311,/\303\251,eG\255>\013L\366\237\274J^\375\356Z\"\263\321"
+	.ascii	"\b\247.$,\267%P0Z}\026\262~\374`\307f\240x\360\b`d\314\003\342"
+	.ascii	"\204CG\216\034\311\036\354\007\263O\0240\004X\255\236\354\221"
+	.ascii	"\344Q}1\327\243\325\311\035E\262\023X\272\264\372,"
+	.string	"\310\330Ij\262\352h\365_\350\326@\213\222\242\325I\035,\020%\251\222T\311\027\311\247\023\344\315\230\221\264\221\354\232z\322F\220\206Ru\253\325\311\032G\265\026J\216\257,\255N\322h\213\212b\307\330\343\354#e\215\n\006\005e|\332\221tJ:%\237\252\214J\222O?\b\"\030\205\020yM=\265\372'H\332\177\222)\311\304\216\375\346\371\311\006ld\344\325\301O\220\"\251\224TJ\276\210YK.=\371\342v5\230x\266\204\304\345\345\211\265\372\317/\373O\262H\262H\266\020\376\314Q:\340\244!;\353\360\305\225Y]2i*\f\311\253\325\177Z\367\237Q\366\237,J\026%\217\024\340\346\242\212Q\220+\031E\255N\032\251Y\t\203k\365\237h\373\317\255\375'\205\222BI\"\340\317\334\223\243\b\267\242\313z\315\341\204\032\326\352\344\020\222\267/\264V\377I\335\177\306\330l5\211\"\231\342\002\324\314\202"
+	.ascii	"^\206\254\236\314\346X\204\265:\031\364b,I\224V\377Y\264\177"
+	.ascii	"\343e\377\311\237\344O\362\304\005\250\231\005\003|\270\300\301"
+	.ascii	"C\n\037WV\253\223'\214MX(\267:\262\250V\377\346m\377\311\371"
+	.ascii	"l59'{.@\315H!l\0312E\275\246\230\243\201\244\325I\036 |P\262"
+	.ascii	"Z\375\033\263\375\233\256\375#\367\252\310=$\337\007\354<'\211"
+	.ascii	"b\303:\317K\035h+Z\220\031\371\205x\225\361\224\326\352\337\340"
+	.ascii	"\330\277a\261\177\344\365l\025yEzi\211\314<\357uH\317\f\253\013"
+	.ascii	"\212\250\254V#\273\234\270\305\226\005u\220-\261\266\3727=\373"
+	.ascii	"6V\264hA\346\t\177\346\032Y\356S\213\036IQ;\252\266Z\215\334"
+	.ascii	"\242\367\214\247.\260V\337\246m\337&l\377H\353O\204\"\312`\253"
+	.ascii	"H+\022O\3703\367X\275K-\250\322\256_+\352\266 \357\3401*@\214"
+	.ascii	"\264\3726@\366m\242\256\\A\332\375~\346\236jpIp\310\265)\big"
+	.ascii	"t3\001\026\024T\272V\277\346\013\025*\310*\027\240f\026\007\330"
+	.ascii	"J\342\262u\345\261ek\255\325\310\272\266\216\313\226\271\325"
+	.ascii	"\257\261\262_\263$J\024\244\224\337\317\034U\345\302\261H\327"
+	.ascii	"\"P\220t,\260\013L\316\252\325\257\021\333\257\371!'\207\234"
+	.ascii	"\003\376\3145\272\\3\270M\357H[\253\221O\332<.]M\255~M\214\375"
+	.ascii	"\232\037'N\246\f\351\240\030"
+	.string	"\221\332\362\366\346\204\235K\0026\367\244\255\r\216\372\245\b\021\\\253\037+\331?\262\t\262\t\f\205=z\375Dy\243\2565}\231\361\305\204\211\033\314\003\b\326\\\253\037g\251\251\261c\354\321\313'J\023\352<\257u@\254\266e%U\241\241\375\356NdY\347\027?\216\264\3721\214\2633\226\317\003;\007\251\240\201e\335K\260\340\220\321\352\307(\310\376v\253\345b\253H2dY\020\370)\005\235\016\262V#\223t%\001u\265\372\316-\373N\273\375#\221 \221\260c\277\237\371\311F0\257\211n\013X\366\245\264\243\325w~\355\037i\004i\004yD\3703\367\344\b&\025u!\ty\204\345\325\265\032)\246\177K\276\324`\321\352;\257\366\2355\366\217\364b\253H/d\030\360g\356\t\022t\261\302\013\017\267h\212\017!$\330\221a?r\b\222\210\021\355W%\016j\252\325\310\257\fG\202e\3618U\265:"
+	.ascii	"\254\322M\306\261K\267\315\301*\335;\263\330*2\013\331\205\002"
+	.ascii	"\324\234t\201k\256o\211\021\253\315\315\332\352\037\311ud\327"
+	.ascii	"\217\f\202\3242\236\265PA%):\232\264\032\271\225\341H.\030I\333"
+	.ascii	"\027\253V+Y\245\0133\263K\267\245\201\262\177\344\217\037\310"
+	.ascii	"\253\337\317\334\203C&mE\227\365:\317M\035\024}\344R\324\030"
+	.ascii	"\002k\261\0055A\002a\275\342\350p\354h\353\321\343\325\232)a"
+	.ascii	"FBJ[\232\347\265\0168@\361D\244\325\2479\262\177\344\016\344"
+	.ascii	"\016\241Q\206\237y\006\227\353\202\210*\357:\317k\035\004\271"
+	.ascii	"\370\330\265h\365i\254t\350@Z]\200\232\2212\300\301S|tp\265\032"
+	.ascii	"Y\365\266\203\310]\253O#\265O\203\264\177\344\215*\362\006\022"
+	.ascii	"\307\357g\206\262\202]\f\351\231]\205\210=\365!\251\214\344\320"
+	.ascii	"\212\322\352\323\370\354\213\300B\203\006r\n\005\250\231\305"
+	.ascii	"\001\222\206\362\326|\232\020\251\"kd\tB2\245\325\027\001\267"
+	.ascii	"/Bl\377H\031U\244\f\244\324\005\250\231\305\003\272\206\360\222"
+	.ascii	"\366\023\276\024y\255FF\275eH\226\216Z}\021<\366E\334\330?\322"
+	.ascii	"\211\255\"\235\22012\374\314=Y0\220\342\236S\027\274V#\237\202"
+	.ascii	"j\334\360j\365E,\355\213H\261\177$\023\222i\033\001\177\346\036"
+	.ascii	"\033.\334\220\235\025\210\222\027Q\255\276\210\236\375#"
+	.ascii	"_T\221/6\221\360g\356yr\257E|\324(\027{L\255~so\377\310\026l"
+	.ascii	"\025\331\002\251\204\204z#\t\030\023\244\322\257s ]\030\231h"
+	.ascii	"\033`le\255\016\316\354\322}\023n\377H$\266\212DB\262\020\376"
+	.ascii	"\314=:\202x\300%\265\2629$\213\033\325Z\267(Hn\255~\263\310\376"
+	.ascii	"\221+\316V\221+\220F\232\310\314\303n\rY=aM-\351\341\004Y\024"
+	.ascii	",Js\212\321\3527\275\366\233[\373G\2528[E\252@\016= o\b\007\334"
+	.ascii	"\257\215\013\337\214V#\205\2220\245e\265\372M \373M\344\t\344"
+	.ascii	"\tdP\005\266\220(\216\f\272\242\326DH\253\221@\277\273\377B\241"
+	.ascii	"\317\013-@\232N>>G3\017\354\034\204&\305e}\251?W\254\255\276"
+	.ascii	"\t\364\366\217\344A\362\034\223\264D\346#\rhY\236\260\276\244"
+	.ascii	"\242T\264\372&x\333\377\221\257z\344;\366}\300\316\263\022)1"
+	.ascii	"\253\213\253'#\307>c\025\023\200%\325\301\b\242\247w\334c\211"
+	.ascii	"\314E\023\230\263\303\303\232\347\246\0164\213\266(r\257[\020"
+	.ascii	"\305\233^\213V\337\004R]\272\320\2101l\202\372a\002\026\\\270"
+	.ascii	"\274n,\221\271\b\304\\\226'\254yv\353\300\345\241\363\342\243"
+	.ascii	"\325g^\367\177\324\242\345\270\205=z\315R]\250\363\334\324\201"
+	.ascii	"0NHF\323\353\206d\304\212[\253\317\234\262\377#^\365\210\367"
+	.ascii	"\272\315@\361\340\215 \304\307\016\017xe\305\334\221V\237I\266"
+	.ascii	"\377\243\265z\264\036\217h\"3\217\006))"
+	.string	"kX\363\274\324A\033\245\255z\245\325gb\355\377hw\266z\264;\026\321D\346\243bQ\026\034ME<-&<\255>S\312\212\025w\307\005\250\236(\r\254J^x\020w\004\t\363i\365\231>uuco\035\031\216\031o\312\224\343\023\026\3713\317`\243\316\263[\007C.3\227+S\350\350\236\210\325#zBZ\375\022\300\355\377\b\345l\365\b\345\b\366\013\202\232\217$\200&7E5\"\364\344\325\352\227\240\311\376\217r\325\243\334\361\311/\b\252GJ\001HJY\274\\\347\331\255\003\241\023\r\237%\257\245 \262.\036mmG'\354\007\263\317\334\220\002\300\375\350\244%\022\276\250\353R\324\352\343\333\357\016\356(\250\332\352\243\333Q\315\352\003\345.\311\177ap\211\225%_\255~\t\224\232492\331\363<\363x\315E2{JX``\221@o\377xvT\362#\332\321\216L~\234\347\331g\236\237\234"
+	.ascii	"\300\246\204\005\306u^2\272\360\037\227\374\310\344Z\004N\311"
+	.ascii	"1D\224:'ji0\025F\226/\\\\\370xa\322\352\223\240\310\376\317\276"
+	.ascii	"\375\335\271\307h\236g$\240\327l\3443t\177\366,\220e/\374D\366"
+	.ascii	"\307n\360_\377L\253\233y\266b\342c\236gV\313\356Q\326\303\244"
+	.ascii	"\301\374\377\227\231\347\371(\350g\346a\203\300\242\216\202\300"
+	.ascii	"\242\214\220AnQG\363\317\021\326O\024\024\033\364\023ed\3643"
+	.ascii	"\363 g\260(\243\2409\352\3508\203\315JA`=<l\320\317|4\317Q\363"
+	.ascii	"q\016\3529\232\301\274\214\220A`QFA`QG\310 \260\236\243\240\031"
+	.ascii	"j>\006y\3150\232\275\242x\220B`=G3\030"
+	.string	"\324\021r\006\213:J\321\325\344\314\203%W\032^\350\300\234\344`\217\202~\346\025DM=F\307\270 /\250y\312<\263b@\263\321\0347\317\033\314s\023\224\321\224\036%\326\314'n\205\317X\017\024\3535\317\363\005D>RP\363O\034\017;\307\005\371\200\232g\037>73\321<\317s\b<^q\363\r6\216gF\323<\0044\317\030\314^\363L4\317<\354\0347\3173\317<\317A\243&\257y\206q\f\242\022\021\315\363\322\f\321\334\304s\0064\317\255X\235\331Q\020\230\024T\206\263\"`\324\031\205\027\017\0334\0045S\347)QF\033\214g\310<4\3173\233eS\217X\340\035\313~T\370~\214\264\372$\370\331G\262\266\250$\315\311]\253?\202*\373j\307\224^\253\275\2520\334\246Z\355\005\233=\035Ij\365Q\254\255LFY\253?\2026/\230\245\253\025\255>\206\201\345\350\241\205\325\352\217"
+	.ascii	"\311>~\335E\341\006}\346\304\222\021\262V\177\004`{\310\220c"
+	.ascii	"\327\177?\363S\031u\236\227.\374j\33059\265\372#\330\261\377"
+	.ascii	"\243\327\261k\337\315\270\302\345\b\344@\216],\221\271\350\002"
+	.ascii	"\352\n\274\256\353</]\330[\\Ul\\l\365\330\365\227JF\f\272V\037"
+	.ascii	"\203\034\267v\215\254"
+	.string	"1%[Z.\224<Ar\3242\3429!\345\020\322\352o9fM\351\220\202\342\230u\304B\272\n\375\230k\201v\024M\035\257\336\267\036\031zu\255\376\b\224v\217\243\0176\313\3543\324\327\203z\334\261\347\272\320h\253\243\036\253~U\032_\346Z}\021\260\355\377\250\343\230\243\211u\305]\253\2178\216\234H\302\244\325\027\001\222\375\037o\260\325#\025PK\211\227\322q\312\305\233\225\232Z}\021\3648\3268\316p\300<Gm\365E@u\224\032b\202\030[\226\254@\235\255\036\241\216O,\221\231g\004N\220\322\206u+\256j\264\372\"P\332\3771\306\361I\b\212\261\037\255>:q\215\251\235\265\372\"H\261\377#\214\352\021\306\221\t\3703\327\260\361R\207\256\272Dp\365\241\322\352#\323\357\216\2052n\341\021\243k\365E\340\363\272\231\300\304\002M\351l\365\250tl!\374\231{p\270<\222\252\030\2753\252"
+	.ascii	"\255h\365C\220e\377G\027\307\026J^\2748\321\352c\322\217\247"
+	.ascii	"(\260V?\004S\206\230\200\213\\\021\322Q\365xt,b\211\314<\360"
+	.ascii	"\\\020RZ0\r\355\252\324\352\207 m\377G\243cQ\326P[Y\253\217+"
+	.ascii	"\316j$6\270\031\255~\b\302\252_zbB?\254\004/\261\325\243\320"
+	.ascii	"1\305\005\250\031\351\001{K\035\300N-\224P\264\372!\340\261\377"
+	.ascii	"\243\212c\n+sYt\255>\006\265S\324\330\230\264\372!\230\261\275"
+	.ascii	"\274\274\314\025q\001\272\022u\364 \342s\242\r\214M\013\334\217"
+	.ascii	"q\317\b\233\034\223V\377G\237c\217\225\0300\222\264\372\310c"
+	.ascii	"\344\371\222F\324\352\207`i_\003\226\337\235\232\027v\314\316"
+	.ascii	"\270g\264\032\257\031\370\004\251\200Ug\3343\332\365\031\365"
+	.ascii	"\214_\216\263\221\217\255\032\367\214]\214{\306+lJ<\222\204D"
+	.ascii	"h\364Q\031\352\203\340\272\017\002+\\\236\240}i\365A\020e\377"
+	.ascii	"7n1ja\253\306<#\336\f\273\225\305\330V\344A\316\363\fc\236\361"
+	.ascii	"\316\3306\302U\251\252\351\252}\276\250\270\271\372  \262\017"
+	.ascii	"\002\255}\020\\\355\203\240\307>\b\254\366Apc\037\004Q\3737Z"
+	.ascii	"\251b\223\303\t\227V\247\300\342Z2\245\316H\345m\313\314\316"
+	.ascii	"8\345F*\354\330\030U\327\214V\033\245d\270q\nqm\312\332\352\001"
+	.ascii	"\260J\3677\322\031\243H)\342v\244\325\306(g\275L\220\344-\254"
+	.ascii	"\006\024\343\\\021KIM,\356\306\271\337(g|B,\022\326\003\245\325"
+	.ascii	"\254\rv\351.Y\245\013|\222\341\306\270\315\267d\305\r'w\323L"
+	.ascii	"~\f\341\201#:]\321\003\2422\276\031\335~?V\340\325\301'h\200"
+	.ascii	"=i\233{\033\362a361&\241n\031by\243&\255\031\231\354\262\236"
+	.ascii	"\2701,.\200\024-Q\263\272\200r\367\003T\013\203\001\224fDc\231"
+	.ascii	"\206\240\235\330H\327\031\211\2223\241/t_\332\245\273b\201\231"
+	.ascii	"\031\313Z,Q\370\204\214e,\037\313\366\266\244."
+	.string	"\tY\215\032G\304Z\215\3048V\335+\276"
+	.ascii	"1i\365A\260\002I\265\303\223Y\226#7V5\225\023)X\264\372[\214"
+	.ascii	"b\377\205/]\235^\234\030W\360\204\02760#\306\"]\266\236\254\265"
+	.ascii	":\fF\262\245\210\252\325\377\300\336~\313\363f5\202\031\211\030"
+	.ascii	"\207\260U\343\227\321+\303\227\021\313\250\225\344\313\355\313"
+	.ascii	"\270e\024\362\363\3321\3173p\004\201\264\240J3\002\271\025\321"
+	.ascii	"\262\365?P\267\177\243\020c\327\332\2126\034>4\f$iMZm\3442F="
+	.ascii	"\321\200!\245\325\377\200\223\235e\fR\314\023\332\302\244\325"
+	.ascii	"\377@5\353\003C\366o\274\002R\264#R\205\007\310\177\\QM1i\265"
+	.ascii	"\017,j\230\213V\377\003>\366\217Q\305\027\225\365\215\350\211"
+	.ascii	":\024\203*d\003\211)x\243"
+	.string	"\310g\354\231\323\341\302\370\202\310\332\302\311(c\004 #!\013\037\025L>8\266X\300X\341d\234a,2\0365\031g\020\213\254\214I\306\032\306*#\225\261\207\221j\334a\344a\264a\2342Z\031o\030i\030s\030u\030\245\2148\330\252q\2061\3523\306\031C>c\223\rwI)\252H$\007\221\327\006\372\037P\261\177\243\f(\261!V\3524\017)eV\2556\3060>u\315\331`k\365=\320e\337\003x\033\206\221\311\310\205H\013\235\024\030\306\245\241\017\244\242\252V\337\003M\266Q\311\003g\373\036\020\333\367\200\326\276\007\252\366=@c\377\306#\243\021\325\212\310\225V\307\031\207|Zs2Z}\0174\355{\240h\337\003=\373\035\330\262\337\201)\306\024\372\004\032\232\215\262 #\212'\\s\221V\377F\240\033Q\030u$\221\233\321j\343\t\226\017\356K\342\246v\345\277\020fB%\005\327\352w"
+	.string	"l\277\003?\214<J4z\256\264\372\035\210\261\317V\215s\261\357\375R\005w-\366\021\237 Q\231[\375\016 \355\277\370e\257\315\b\231W1\205\023+E\212z\305,n\217\"nJv/\250rV\"j\333\025\246*1\234`)\262\026\263\024\357\324\212Y\212V\202\270\300b\275r)j)^\213^\212y\305.\305-l\265\230\245\210\367\313\023\242\304z\324_\301\312\376\nR\366W\220\333_\341m\177\005&\373+\224\355\257`d\177\005\257\375\027\353\212T\212T\212S\212O`\274&H<J\250X\2350q{\0131\216\210\246\274\323!"
+	.string	"\031\230(\001"
+	.string	"2\003H\316\214\260\002\0134\361\315\206\025.\030\200\f}j0\205\356\fgf\220\260,C\237?\350\263)\025Nc\250\tE\0238:\361\207'4\205\232\035\021\323-\225=\324\354\210\230\006\341\343\214\007\023:E\023:Q\232\230\337\224\220\352L;\224\220\"a\344'4\205\"\t1\006\277\301@#\365\200Fi\003}~\220\237\320\3471'*5af\203\263\031\305\2011\236P\342i\202\023JB,7\235O\234\346\210\231i\321\371\224\241)8\237:D\032\232\246R\332\224A\310\304\362SJ\002\356\260\201\017\036.p\001g3\226\276O\347\005L4;x\220\211\345&\316\016\rNs\003"
+	.string	"\220\256s\n\335Q\232\2206\245Q\235\2348D\b\001\3044M\034\235\370\303\024\031\343\210h\312;\0356\220\343iN\234\343\202\240\241\001\031Xhv\200ef\234\363\fA#K\205r\f\202F\226\272:\323\016\323\227\204\351\024\231#\215\326@S\220\221c\020\323\024\246\303\351p\372\234Jc\235#<\225M\224P\263#b\232\034a\005g3\376P\263#b\372\302\230(\301\t}\326\f"
+	.string	"J\"\352\224wn@\300\277\301PB4\204\2143\332\301\004\026h\232:J\231\031\347<e\270)\343\304\034X\2306C\310\261M2x\301o0xp6\243*\214 A\216m"
+	.string	"\260A\216m\b \3076Kg,}\356\240 \376 \3076\310\251\016\007\234&\315\215\334\314\361@\236B\2434\300\032\031\372\224\342\270\323\024\246)(K\\ \032B\226\306#br6\340\220\020\363\033\f\323\250N\364)mv\300\031\313\315\234\247<\275\200\034\333 \235)\224\210\226`\242\204\022\321\022\234\320gMQ\216m\2101\216\210&\316\2639\202\004Y\032\3650\315\211Bc\016\261\334\374"
+	.ascii	"\023}\312\315\017\036\344\370\204'\364)\307L9\266Y\312/\0079"
+	.ascii	">\201F\226\026\177\203\001\204\023\372,\241\304\0079\266IJ\233"
+	.ascii	"\321\022R\220\306\322\035\231\246Y\263\003mv\220c\033\344o0L"
+	.ascii	"cdf\334\302s\352\342\340\354@\241Qh\220DTz#G\241\301\232f\214"
+	.ascii	"\243c\351\216\216\206\3068Ry\352\332@\237R\031\204\3617\030\242"
+	.ascii	"5\320'\223\246\006j\363\004!\3076C\rbf\016\354L!\3261\021b\207"
+	.ascii	"\246\203\034\333\f\23514\216K\2306Q\240\241i\302H\243r\264\303"
+	.ascii	"\005M\271\311\201\370\234N?\310\261MPi\202\246i\023\253 \307"
+	.ascii	"62\035\344\330\006&A\216m\340\230Y4\312\261\r2f:S\220\231\307"
+	.ascii	"\230\351LAv6\343\017\307\006d\030\001\006A\303\n\261\374\224"
+	.ascii	"z\240fG\304t(?\241)\350Ls\202H\033)\t7\362\323\003\001P\022i"
+	.ascii	"\24288$$/ Ag\232\263t\3069\322\337`\210\245Q\032\017hj\2348Q"
+	.ascii	"\024l\2329A8f\352L7@SPBM\320\231\346\304\3101\b\032\023t\246"
+	.ascii	"9\030\310\3208g\307FJBL\354\214vH\202\270\261\331\211Jo\344\351"
+	.ascii	"\264\351\301\t}\232\2403\315\311 vF;\274P"
+	.string	"\023>\350Ls\340\230\031#\303d #e\031\371\270\224\2316\317\032\245\001\344\245\234\2241\210BM\310O\234\346\016\n\222\316\347\210\251\021zC\303\214\326@\237#\246L\020\036N(\336l\310\331\2012Ax8A\370*\343\234(\n\321\020O'\023\204\207\023\222\262\313\224z@S#\03730\3004\316ij\300\371\324\331\036\220\033.\220\217\262R^\312\314\2514\306\331\271\3002v\356\310OYnn\271\330\224\233\034h\244.\020DNT\236Ned\233f\316O\246\241i\376t\24690\004\b\200\211\246TJ\302\006:\315\016\034R\210\312\0338\220\0203u\246\260a\352L\301\330\001g,K\243::;S\f``~\203\301\003\233\035\021\261\023\370A~\236 K\2437\323c\234\363\f\021\313M\016\302\250\324\204\215\376\r\006\017\2348\317\035\021qNS\003\357\006yg\003\033t\2469\0308\245\315\r\034@"
+	.string	"\3404&pt\342\017&\244\315\234\234\035\0207\323&NMSnr\020\300i\236\322\030\032\333\354\207\320"
+	.string	"\0064`\204\022\301\217"
+	.ascii	"\201\017 \360\201\373\021 \220!\003\004\032\220a\277\001\031"
+	.ascii	"~\262,\313\032HBM\360P\"ZB\334\302\363\202\230\t\215N\233\361"
+	.ascii	"\207\034iT\205\2309\265i\342\230\020\343\210hN\237\034`d\246"
+	.ascii	"4*\353<\2454\323\230\203\3164\307(\215sv\246\322\330\331\214"
+	.ascii	"\342\310\321\250\b\231\230\351L\201\205iS\336I\031h\224\225r"
+	.ascii	"N,OM\200\370\315R\372t\n\247L9f\201\246\351Ag\232\003\313\277"
+	.ascii	"\301P\263#\"\247\031Ke\0018\241\361o\312\254\331\0211u\245\262"
+	.ascii	"\316\257fG\304\317\231C\363\233\3324qj\2002\316\316\024*O\243"
+	.ascii	"\036t\2469Jy\272\002\362\215\231&\300l\2319\034v\340\030\343"
+	.ascii	"\210h\206\030\341\312\322\250\316\03337 K\243:\304i4\030\313"
+	.ascii	"\315\017\316\235\246\210\035\267\360\004"
+	.ascii	"\021\267\360\004\261\345-\035:\2331\n8\317f\bi\\S\263SB"
+	.string	"\ty8\342\031\323\304\037f\336\246\334\344PBZ\224\312\036R\370\r\2068\347)\313M'\023\2266c\023\372F\206Fs\200&\232\316\337T\272\023\275\001Ncy\007\372\314\tN\235\320(M<\rN\23788O\243\361\210\254\321\301a\026q\342\021\314\032\032\330\246)3i\242\361\320\246)3\24584%\230QiS\004\321\371\324\201s\242\320\330\311\234N\235O\035$4\372\224\241\361\210X\252\203\201\006r3f\241)3M4I4\241;\322\002\030\2316\315\034\242M3g\b\027\2314 <\2316\315\034c\021:\245a>u`\233f\bYgG:\214J\343\020\3304s\202L\233f\216R\036\021;mtf\344\035&2'*Owh\214\034\200\323\235\022\236:S\327\246\031\002:\245q\247;%\320\200\360$\201\006\204\347\033\007C\310\3208'\036\021\355\240\301t\207\031\225\231-\334\030[\2709f\310"
+	.string	"\002\263\205\033\030\020\230rMt:C\242i\202ID\306:&d$\211\246\211\244\214\362Fv>I\310\240"
+	.ascii	"\206\232p\036c\234\3614Z\363\254a\322H\223\233D\323\304\020\031"
+	.ascii	"\333\340Do\2302N\023\206D\323\004\f\007\rG\022Q\234\342\215\315"
+	.ascii	"\363\306\350\324\200\323\224\312;1T\350\324\340\2046E8\233\261"
+	.ascii	"SI\"\212\003;5\f\235\032\234\261\3617\030\216\316\030G\304\324"
+	.ascii	"\211\023?k`\2469\314X\272#\353\030\247\322\250L\363t\306R\035"
+	.ascii	"f<\342)\3534\235MeQ\376\r\006\017\242O\031Y&\311\302\264\331"
+	.ascii	"\001\272S3\214\231\2624\352\341\371\352Ls\246:6H\271)-\021\025"
+	.ascii	"\301\002M\023GD\314T\032\325\201[\270a\3560\227\322X\246iJ\233"
+	.ascii	"74L9\032\025\021K\217\262N,O\265\t%\244\027\304\316h\216\376"
+	.ascii	"\r\006\017\002pD\222\210\3420\001P\254\251\211Nab\351\2163\246"
+	.ascii	"\211Ju\2222,\320<\345)3\256iNq\236\315\232\231\337`(!\365"
+	.string	"\300FGYB\372\3524sh\244@g\214,\021\343\350\354p\250\301i\336\274\320\247\006L\233\035\034\235\031\251\023\372\024\301\224\233Sf\316\216Tf!\326\231\002`\030\3434i^Y\032\217\200>i\244\316g\016\020\372\314\331,\320\30474%\2329\3338\335\200\323\034\001\215>S\240\221\312\34447\214\320\251I>\2333\320'M<\335)!\205K\3544\231%\2329\306\351\022\216uL\310\310\013\004 \023\217\220\306\316\f\2306\320'\215tF'\316iJk\2304\322)\3639\235J/p>\231\362\023\272C\004\001\247\204tj\224\247\315\032\246s\247)\2029\335\0211-J\241Sf\ti\315TJcda\332\314aN\231\261\363)\325\231\346`\360\033\f\036\020cg\264\2034.\361\314\0212\247$\232&dt\23685\313\026n\2305:8\262\314\254\211\235\027\374\006\2033\226c\034\235\234\350\006\230)"
+	.ascii	"v\230\034\226Qi\034\002\032\232fP\226\306r\234\023M\356\324\304"
+	.ascii	"N\246,3eNs\236\322\02074\362\323\203\023J\002\016NT\252\2342"
+	.ascii	"\233r\223\003\210\251\216\rR\316\331 \3434\201S&MT\205\251\216"
+	.ascii	"\rQn\342\374\240Q\234\337\r\016\316\317\251!\350\214c\035\020"
+	.ascii	"p<\225\356D78\241;Q\251\315P'\352\274\321r\023D\316\016\324\375"
+	.ascii	"\r\206\251\216\215\007\321\347T\307\006\216\247:6D\235\0353\337"
+	.ascii	"\330\031\3550m\212\230\356\230i\214\312;\3157f\2220\325\261!"
+	.ascii	":w\232%D\345\235\346\216\3068O\234\246\r3\236\356,cf\354\214"
+	.ascii	"v\200KDqD\024c\032h\224\031\347Do\230r<eNuld\234\032\230\361"
+	.ascii	"t\2079\325\2619\232\220\237\323\246\210i\221(\377\006\203\007"
+	.ascii	"6:1\3228\347\031\302\031\307\214\2109\304r\363\303\360\b\215"
+	.ascii	">\247\322x\0044\205\034\022\036\2209$<8c\032\250\211)t\205x\272"
+	.ascii	"S\224\247\322\235\022\342\351\016\321\204T\216sb\2348\004r\352"
+	.ascii	"\342Di\242rT\352A\226Fubl\240M\021\362\263\0049z3\345\020Ow\214"
+	.ascii	"\361\016N\263\003\033\210q\234)\3404\345\247\315\323\031\003"
+	.ascii	"}\346\300%\2329\260\023\332\314\311\211\322@\2379o\324CQ\236"
+	.ascii	"\016 \306i\322\2000\"K\3544\227\322X\206\306\033\216\362o0\224"
+	.ascii	"\210\212`:S\220\2411\264\231#\215u\340)\263DT\004\020\030\347"
+	.ascii	"45P\"*\"(GC8c\026\240O\234=e:\241\321\r#\2362\r\t\2613\232sA"
+	.ascii	"\314t\246P\"*\"\350L!vFs\334"
+	.string	"\022;M\243\354\204\306\301)3\266\2016?\024ub\031\204,m\312Sal\003mJ\2011\023\246y\332DU\210\235\321\034\341\2249l\341\206I\242i\242\330\302\r\363\330\302\215\374\033\f\316\247\216\t\354\224Y\343|\352\270\036\330\024X\016\254\363\251\363\223\241\317\250\007\235\035'\364\351\001\031\230D\023\004; \234O\235\"\364\331A&\301\371\3249\3124qM\215R\226\306:%b\246\214\363\224\231\320h\013Oi\364f&vF;\230\220\237#\232\322\023\2362\264i\f\021\003}6O\220FI\200\371@\242i\002\031\313Mi\321ist\342Do\246\261\364Ff\312\361t&\316y\312/\f\023\302\004g\034\327,I4M0\215o\0137L\244\ti<\"J\023K\2317\323\246\224\246X\\\036\237\360\314\364Y\242)\003}6m\220\323\034\246\263\031\3374Y\210Fq\230\322\030\372lJefTJ\323\274"
+	.string	"\372l\332\034\221\322\250T\032\313\3200\247\"\232I\020\222-\3340\241\317\026nr\244\261\354\204\211\235\321\016!2\220\2379O\025b\034\033(\t2\320g\363\004\244\034O\343\017\322\330\306\346)\rA\"\212\203C\302\206\033\032\350N\023G"
+	.ascii	"\314x\272\223,\321\304\211\245L\022M\023Lg,7\2456\261\f}\302"
+	.ascii	"\264\360\2246c\350S\005y\272#\275\221\225@\350\263i\363\3064"
+	.ascii	"\320\346\bg\323I\224wt\344\235(S\032\225\2439I\034\234\230\206"
+	.ascii	")\303\224\241\361s\nmJ\345\031y\032\215\212`\326\324\354\034"
+	.ascii	"\035)\023\372\314\0312eh\234#OwN\340l.]\347S\247\030O\233\261"
+	.ascii	"\224\006\372\214q\234O\244\016NT\247\246\006\311,\321\314a\326"
+	.ascii	"\324 Yx\352L\23155EiT\246i\3260o\344h4g\312\254\2519FuJ\304\314"
+	.ascii	"x\204t\207\206Y\243\203\303\204\232p&c\232\246\224\211\023\217"
+	.ascii	"\210q\214Sh\254\223\023\245a\3324\247L\271)b\304R\376\r\006\017"
+	.ascii	"hj\342\234\246\006t\340Xn~P\216\340|v\220\336\310\301\021\242"
+	.ascii	":%. \275\221\367t\032\313\315\0174\322`T\247\304\005h\244\356"
+	.ascii	"4\226\233R \207\024<HoB@\237Q\035\026\232\261T\004\263\251#\027"
+	.ascii	"c\035\023\262R\207\211#\313Q\351\215\034#?s\2368\314XnJ\337\330"
+	.ascii	"\031\355\320\324\221\203;9OX\347\311\0023\207\306\351\30686\320"
+	.ascii	"&\023\007\247\2313\305\211Jeh\224\246Y\314\2216\231Lh\224\211"
+	.ascii	"\323\244Y\232h\342\304Nf\216\2649}:\231Qy\247\211\374\r\206\246"
+	.ascii	"\001\246L\022\21688Q)<\234\306\261\324&\346@\242i\342%\321\224"
+	.ascii	"\376~\203a'\3479\203\203\023\225\352\033\032\371\251\003$\321"
+	.ascii	"4\361\233\306;8\315\021"
+	.string	"\356o0\224\220zPB\252\224\231o\254c\"\304\007>\200\030F\245\036JHq\232Oi<=\016c\271\371!\376PBJ\242\371A\nKe\017;rS\006!\225=(\247\3148\347)Cw>\224\220\036\241&L\2471MT\352\201Fz\224\343\023h\244I\250\t9M\251\t4RcSnr\240\201\233r\223C\234\323\224\326\b\345\022Q\021\277)S\032\227xv \312;:\320'\354\214c\235)P\376\r\206\251\00781\024\332\274\331\220\023\225\232\340\2246IH\2435\311)3\247)mz\210\216\220\306\323\341\324\031O\245\361\210Xj\204>s~%\2329\277\030\307\351|\346\270n,7\245r\024\347\251C\214s\232P\035\34745"
+	.ascii	"\377\006\303t\332\324\311\211\3324s\200\0338\220`\323\314q\177"
+	.ascii	"\203!\306\211ih\232\033L\23144M\240L\023K\231/\r\r\t044\315}"
+	.ascii	"B\006&\rM\323uih\232\233\206\2469\214\235\321\r#b\351\260\306"
+	.ascii	"\035\021;\177\0338\220@C\323tc\032\350\006\344i3VA&\301\031\313"
+	.ascii	"M\247\316\n81\r\r\t\323\347\0054R\017hjr\344g\t%\242\"\206S\371"
+	.ascii	")B\3434wd\351\263\003\031\314\310\361\264\246&\352\312\322\370"
+	.ascii	"\211\243\363\224qvr`6p a&\306i\322L\345\246\210\021B\234\346"
+	.ascii	"\210\021O\3474\226\312M\021#\210\277\301P\334\3624\226\233*\304"
+	.ascii	"6\315\"\224DS\312\341\206\204\234\375\033\fE\247\321\031Cw^g"
+	.ascii	"l\323\234\30255QygC\007HDq\216\277\301\020\200)\263D\023\372"
+	.ascii	"\314I\222\210\221\241\3614\226\352\310Q\250\334\0241\342\002"
+	.ascii	"\232\0218\304\230\231\214\23101\215t'\nB\032\313q\007\031\032"
+	.ascii	"K\245;4I\023\362\223\246\251\323\024a"
+	.string	"\224\233%t \236\356\020\247\2624\306!aC<\335\201\211m\23224\246\221\306\036\240\321\247\254\223\2633\205Fi2\230>\247\2614\226\247&n\344\246\210\021\305\330\246)\343DG\340\340\304488;5rS\304\b%N\274\301\2044\226\345f\t1\2154Z\2634\321\304\321\231>a\344\246\210'\321\006\372\204J\233\036\210\301i\322<\345\247t\2034j\002\007\271)b\204\2143\372\224\306\036jtT\260i\202\220\233\"F\034\177\203!\203\032\34346\301i\2342\243R\0236\256\034\333H\233rQf\202\240!\316y\312:\321\250\n\305\232\r\034H\230\3029; \204P\022Q\247\214,\333@\237\320g3'\3760\215qhL\320\030\247\314\rQ\251\t\033d\316\316\364'C\2319\277)sD\354\224\247\301\016\035@8q\242\314\034\027\004\211\030\312\314q\245\315\021?\021O\234&\r<e\016\177\203\341"
+	.string	"\322\030\007\347iB\264\346Y\363\312Ff\3607\030d\232\035\251<\005a\312,\021\313;9H\026h\2428L\246+Cw\2424LfP\032CID\231\314\340T\032Ow\240L\346vB\237,0\231\356\024\372\324\2312\231Ah\3649}\342\304L\246Pf\312\323'\316\3617\030\246\261\216\t\231\001\316X\332\274\2312\300\203\251\374\024\341\301\016\324\206\001%v\240O\034\006\204\320"
+	.string	"f\003F(\341A\354\334\301\241\201>=\220Nw<x\200\\\"\206\3424\241\322X\206>\231\316f,\275\221u\230L\231\021\261T\207\311t\345\351\023\207\311t\233r\323\311d\272q\013\317)\223\351\262@\023\305\321\362\023\232\202\374\204>\227P\023\234\315X\352Je\0174\320\035\023\232r\223\203\263\031\177\210JM\234p\001\324\004\342o0<\345\022\2614\306qB\233(<\345\022\261R\206\326\264S&M\374\201\005\232\246\b\034\234\346\206\247\\\"F>\345\022\261\226\247\314\247\016\210\232\230C\254c\"\0043\005\017 \340\230\006\332\224\247\320\347\226\231\033HAC\237\036\240S\032\367\2513\375M\231\033@H\001\336"
+	.ascii	"B\nB\227\006\204\347\3577\030\246;\".\2302;8\217\322X\2366s\334"
+	.ascii	"\3514\226:\235\315`<\242\211\003bG'g\3570G\304\316\351\216\210"
+	.ascii	"=e\3064\317\0211\207\351\216\b8f\306:&BLwD\bc\035\023\362tGD"
+	.ascii	"p\272#\342\027\3434i\246@cT\032\207 *5a\2637p Af\202\240A\206"
+	.ascii	">\203\036\222$\232\0376p !\226\356\310Mi\254\223\023\313\260"
+	.ascii	"\374\033\f;:9\314\250\324\204\r\rM\323\203\2514\036\361\224:"
+	.ascii	"\025\0203?| \302\007\r\330\321\311QB\243Oy\007':\215\245\357"
+	.ascii	"\224\t\0233wtr`\031gg\032\177\2109\354\350\344$c&\263\b\265y"
+	.ascii	"\342\220\300$\266\200B\006b\271\371!*5a\003\233p6\343\017M\271"
+	.ascii	"\351\024J\2475\314\033\233\347\r\263F\007gX\243\203\303l\341"
+	.ascii	"\206\005\0204\334$\247:Q)\007i\354|\216xr\330\321\3111\312L\233"
+	.ascii	"f\210\3503h\323\f\361\224K\\@\206\246\260\243\223C\214\231\305"
+	.ascii	"X\332$\341\2246Q(\312\323\033\271\231\223\303N\231rT\312\324"
+	.ascii	"\251Q\226xJ\345f\007\031\032\347\030\217\301)\314\002M\024g\203"
+	.ascii	"\263)O\343\035\024\304\037\2425\317\032\242\363\002\321\232g"
+	.ascii	"\r\034\255y\326\030G\004\243R\0236\257"
+	.string	"\314\302\264\331\001\2362\207\362o00\t`\342F\306i\3067\301)\323\204\250\324\204M\322\335M\031'\346@\214i\240\315\247\264\331\001\2423\206\332<q\232\301\351Pf\312{\272B\234\363\f1\335\211>G\304R\235\"\216\214\263\323\254yMH\243\362\364y\023\274\231\306\322\032\240\013}6O\210\247\317(T\bC\243\317\351N\215+O\231#b\016#b\016 H4\24508\304\245\374\033\fQ\251\t\033\017\246\322\350\024\032O1@\3560U\210JM\330(e\026\330)\023\216\345\246<\005f\220u\212\305\f\031\224 \f\227 \304\024e\020L\264S\246\263\271\203\202\247\210\342\007\"\332\f\"Z\020D\264\031\232-\b\3156C\211\026\204\022m\006\023-\bP\023\034\240F\020\246\323\246\016\211(\216\222\006)O\237%\232\302)\223(\225=\220p\224\231{\032\214\235O\251<uc\035\023\262\236\272\362o0x"
+	.string	"\215\346\344\310S\351\263\346\2352\225R\331\003\324\204\f\304\310Sfl\323\224A\324$\241&\230\300\321\321i\006\247\301\330\246)O_\031\272\023\335\200\023C\2451\0130\364\331\274\331pC#G5"
+	.string	"5\341T\266\200\002\216NN\023\004\rM\323\030OW\210\206\210JM\330\bcg\264\0034\372\224ib9*\365\260\201i\023\205\250\324\204\315\0058\321h\tL\240\r\364is\002Ns\207C<\335\201\221\231%b'\364\311\234\322<s\232P\023N\246|c\363\304\251\221\231>K\220`\263#\"\346\020\225\232\260!Jc\031\347i\302\020\372\224\231\r\310 C\237;\273D\263C\215\216\nP\023N!\013\323f\207\351\263\004\t$\24285\322xD\364\370\033\f"
+	.ascii	"xT'\226z G\243R\017\340)sCN,OML\213%b'4\005\347S\3078\342)\323"
+	.ascii	"4\221\2613\232\303\264\331\021\021;\337)\315S\236>\345\246<e"
+	.ascii	"\2620m\312\306\033\032\371I\002\3044\352\241\0011\316\263&*\365"
+	.ascii	"\020\313M\351\222\005\232(\016\2154\036\021e\356\350\320\020"
+	.ascii	"\343\234g\210\230\246)=\001\272\001iL\"\252\023#\215\2375O\031"
+	.ascii	"\032;Sp"
+	.ascii	"J\233Q\021\306\026n:\304\323\0337\226\2332\bh\364)7\245;6\317"
+	.ascii	"\032h\224&\031\313\315\017q\013\317\234\247\254\263\001i\214"
+	.ascii	"\263\343\214oh\246K\2319\202\f}\356\004\237!\303\006\rV\320\300"
+	.ascii	"\t\233\006\203\3164\307\003\235i\216\007\320g3\307\003\032\351"
+	.ascii	"\324\003\f06\320g\216\224\004\026h\2362\210\030GD\023\032#\245"
+	.ascii	"\315\033\032\375\177\006E\362\353\310\254\254\007\220\215\025"
+	.ascii	"\332~\370\234H\262q\2302\243\313\0172hh\267\303L\206\317\321"
+	.ascii	"IY_\226\231\236d\017!Uk\\2{2{3s\331\b2_>3\313\364\265S\230\240"
+	.ascii	"8\222\351\223\3413>\325\020R\007\334\361\265\004\213n\3772zj"
+	.ascii	"?4$,E\274\300\314\355(Hr'\272\300\324\021\255\336\246|\2560m"
+	.ascii	":\211\225(/\270\300p1~y=%\311\203\331[\202\242\005dK\360\215"
+	.ascii	"\370d\206\222(Z\226E\3058!}7\262\2640\306\020r\203\f\257I\203"
+	.ascii	"Y\351\362\345\256\006\037\222,P\254\313(\240\252\026,\373\210"
+	.ascii	"]\234\220]\016\275\025E\206\217+;X\252\033'\242\254$i\241\320"
+	.ascii	"ZtU\371\241\263B\341\250K\323gO\200RP\201c\231\bya7\345\253}"
+	.ascii	"\322\342\345*e\356\347b\313\222+t\363f\253J\202\021\205\n\224"
+	.ascii	"\245]\226\025]msG\252+[\224\024\255\226\221\013\001j\236{d\342"
+	.ascii	"d\236\\F\356^r\306=#\313\022\240\3551\306\202\317\325pp2n\233"
+	.ascii	"g\236\253\250l\017\033\233\214[1\257\3552n0d\304\341\035\255"
+	.ascii	"~?T\252\270\350\321!\223&\223&\263F\245I\3552k2LP\204-\321\301"
+	.ascii	"Df\211P\2365\013\314U\247E\244\247\205L\022\231$2J\232\224]F"
+	.ascii	"\211\314\231SX\020,g2fB\252\316\332\230\374\346\336l\210\361"
+	.ascii	"l\221\021\223\021\223\031\303\373\352b\235\227\222\216\\fL\006"
+	.ascii	"\t\216\0325\366\220\310T\355\324z\270\354\024Gb\034\361<\221"
+	.ascii	"!\"CD\246\b\225\025A\027CW]2_\227)\"\0236b\306\317\013\2310\031"
+	.ascii	"\260]uu\021\244U\361\343\372\343\210\f\227\f\227\214\327\217"
+	.ascii	"=@d\204\\\306\213\025\242\327\245\332j\231.c\033\260E\032\212"
+	.ascii	"*V[\346J\346JFK\3103\317<\307\331\247J\223\231\f\326e\264d\202"
+	.ascii	"\024\24101\321\222\t\"\223\305\0269);\302\202\255\016\214\247"
+	.ascii	"H\346\307\326B\362C\254\325gyz\366/\343c\231g\234\207\234~dz"
+	.ascii	",\275h\035G\342\264\310\360H*i\242B\351\333\0213_Q\355\274Pc"
+	.ascii	"R\274P\221fd\025#\306\243\312\007\223L\225\362m\313-\253KG\262"
+	.ascii	"\305\215'L\372r$\2174\213\"/p$\211~,l\364(B\245\204\002\344d"
+	.ascii	"\304C\346F2\205\2345\211\214\215\023K\326\310\320"
+	.string	"\246\222=Z]j\360=y\272\213\243\341%\350\225\005\206c\0062\017\376J\002\304\205\324\221\311\320\254+\213\212(\245\225\263\251*TZ]\334k\241\326\252\270\030\221\201B\342\t\241\345\r\3058\276x\303\352\364\334\236\354x\370t\2719U\031bV\375ju\321\005\222\003\305\031\223\024$`KzZ]\227\203\210\021\031\255\366\002[c\242chi.X\315B\273\242T\346\024\244\204#\007\254\303\307\272\327\242\325@\264/\247\266V\033A5\r\265Z)\310\335\017\031$\344\021\270\316\b\217L\346\b\031\346\323\304\tH\253\331-(<^Z\355\265\305CU%\263B\211\347\266En\252\325^:V\334p\032\352\352\303\241\345KF\bye\224\241\343*JF\205\025\220*\245\243\0248\262\300x\024\031\326U\235l\221A\201\234\262\342j\361\004H\271\305\016iJ\221\023H)\016\2565\210\374 c\b1\"\205\305Go"
+	.ascii	"L=\320dz\372\336\350\254U\031\036\244\322\030\030\026)\255\326"
+	.ascii	">l,\232\372\220,pX\341\370\341;2\261r}HH\276\034\243\246jkI\366"
+	.ascii	"\220F? U.<=\030\"\027MSTx\371"
+	.string	"0\202E\327%E\221k\022\244+r\250HeU\325\304\005\311\255\205\027\217<\230\246)P4\206\266\300DuP\304FU\313X\f\270\026NY`lDi\342\341\326\352\030+k5\006\201A\315sO\f^\314\335c\2547\301\220\324\220\253\251P\211\261\2232\024\\2dg\255{\214\335\225\026,*E\223+V\204D\206d\004\251B\374\271\341\226\005I\225\341\220\013Y\\\037\225'Ob\244l\315=FJ\f\335\214)PYt1Q\226\030\201r\313\",\353\231\212\001\345\245\362\273\246E\301\261\266\333\332b\342\260>\340\232\353[\342\366\230\270\030'GB\360\322\234\304\300\3010\002\244\312\204\245\301\004\005\322\333[\306\032qa\021E\310N{ZL\023\003\374\3143\320l\242J\n\211U\3551M\326\226\254\035\261Zc\"\334sR\201\265d\013k\324\2202\267:fI\260/I\321|C\307&#\213Q\302j"
+	.string	"5\317\324\331'J\212 \336\320UW\222\307(\2119\253\303\322\212\2129\2131\343\211\321\344\332\245\315a\266\244\254,h-\006\261\262:!c\307 \321\354Z\017+sI;\346\b\234\024v6\332\312&,V\030\235\325\310\321L\251\210RVL\221c\222$F\206\204\035\373\264\335\215#(`\307\275\226\312\223+\320W\214\324\213\204\211\227\030\221\344\336N\202\"enHL\324F\233A\245\317+\250\317\352M+F\310qK\214\024o]*\270\264\224q)\217\202@\325P\021\263u<B\366\245\003IK\311T\345\245\344D\220\"Z\305\030\221RV\322\020\032\327\025\226R\b\001(\206\314b\256\216D\\<f"
+	.string	"Q\342py\020\375d\371q\004\2633\342\361\345C\351c\370ec\306\212\036\312+\253\036\231S\313C\271U\005\027\366\266Cy\246\245\216\330"
+	.string	"BU&q\315\212\204\024\261:>)\322Y\367\310\252\224U%\340\r\321\320\221\264\376V\\aA\221\203\205\023\"_\356bp(\245x"
+	.ascii	"\251\215"
+	.string	"\265:fF\314\214\230\033O\366X- \313\307\016\217\306cn\304\330\360\242\243\322\331\210\231\002\362\204\n_\212\260,\273j\253cj\004}\210LR\244\025\351\262\223Z\2500\226b\264Z9\263\320\205\252\250\3251MM1P\254\221\321</\315<x\013`\"W\267w\235\227\222.\37411\036\003u +Z\236\264:\346\351jzG\204@iu\214S\013\260\354?\206\211\216\210\246\005\316\f\006L\216\025\\\324\216Z}\266\032\363\")\367\302\206\324R\262J\236\223\225R\362\305K\303\316\215\352\202H\023\275,<m\213\"0<X\310Z\035\203\364kA___\337\336<\367\304 \2651I1,\036\203t/cp\nVP\217\253\377\230#\030\262\240\260&\251\030\243\344\223\335\024\025*\255\366\n\016\301b\226\266\002\246\013\357E\220\265\030\"\230+,E\222\004iu\214P\214PR\256\355\247\224\346\325\327\352\267"
+	.ascii	".\246'\246'&\305\005>V\340u]\341 qHt\304\004=&\205\027\251-\255"
+	.ascii	"\216Aq\334\202Yt\361\261\325\352\030\240\253\031\351\002\304"
+	.ascii	"#\346\304\256\022\315\335\2109\021\363\003\243\261\301x\022\343"
+	.ascii	"\303\204\354\311Q\253\337\202\262\375\026p\355\355\305\3143{"
+	.ascii	"\336\342!f-\n!9\361-\373\0363\037\325\200-\230\310\b\322\352"
+	.ascii	"%\037\254\303\253\351K\253\227_\214m,X@Y\265\300\307\362\272"
+	.ascii	"\274.\275"
+	.string	"( M\251\252I\370\006e\214k\331\345K/A\"Z\246\360\264 \307R\313R\3132o\005RZ\261E\212$i\313-_\346\265ch1\256Z\"\025H\001\230\r\250\244%\317\324&U\252$\206\362 \3069\305\034*\"\332\200"
+	.string	"\263\025"
+	.string	"0`<\032\216\007Ta\225\273\001\024\200\017\\\262\200pN%\320\263,\211\2242F@\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.ascii	"p\375\013@\007\240\323\233H6\253\035\226Ki\211VN\004\244:@\322"
+	.ascii	"\334k\354DbdK\302\345\31767\177\177\276\346\344\3179\317\020"
+	.ascii	"$RPv\213}\347\313R\316rA\031Q\274\254^R\277\321\353\363(\006"
+	.ascii	"\362\311((\221\354K\341&\366\307rG\027\210c\215X\241\324\270"
+	.ascii	"-X\315z\305b\03412\330\316f\326\262\357\314\341\210\253\330e"
+	.ascii	"\t\361\206\366i\222\357\007}\201\330\360\241\2366\343\263\037"
+	.ascii	"jF\227\332\335\n:\272v\352\034nl\205\325P\276z\223\225\207\213"
+	.ascii	"\314m\251\320\201;\273\300%>n&|\321\027\260\235\031u\263\013"
+	.ascii	"L<1\237i\036X"
+	.string	"\037\215\023\016\216i\037\276\204\n\366\235\264_X\252\271L^\177\367pb\272\350 \202\2427x|wv\021\332\021N\270>\325\237\323J\357\354\023\320\203!\242G\225\021\313\032\177\247{b \021\017\311Q\276\202\354G\344\373\257\307O\263(a\035z\t\236{\334o\0345\035Q3J\1776\232r{JS\036`m%\352[\036\225\317\f\321\315-\001\361/\240\031\330\231\255\341\212+\264\016;\001\036\273\271V\007\321s\027\271\350r!Q\305y=\fqC\255\004\217]\177\002\333\346\027\2241\021\254\310!\027\216\322\037g\224\341,\033{\217\332\212\013J\374\215.\2641\216\325\324\216S#\036#\245\017\214\222q\267&@Yd\037\353\341\253h\260`\216\356\2309\325\324\230J\r \377\375c!\005\007\024\341\337y'\330\003\205\252\211?\021)S\341\027\317z\256\026\343\245\3418Y\3069\231\327\016\200\304\217\031\240)u"
+	.string	"\243\r1\210U\f\316\233>k\273/=\016g\373\333\033t\261v\263\213\312A\273G\r8\220\365K[\325\020\300\227\233\372"
+	.string	"\\e\214\r\245U\265\034\347~\030\203\217k\"\351\037\2534)\204\273S\005\204\002\330\304;\321\350\360sM7\250\215\214\367\377\304\277\316s\356\t\355\220\352p\315\033e\231\346\203\302\357M\371\221\232\022\360\220\320\274By\242\0202\tt\36167\240\210Z\347B\347\376\314\023\365\017\277J\031(\346\352\252\007G\264)=\223:S\364\230q\036\274\313<\2179D0s"
+	.string	"\236il\377g\366\277\257\235=\337\017*\213\013\001\272\321\330\005\220K:4\365\241X\327o\373\376\375|\020a\222p\204}N\312\316\243\020\377I\313\303\221\267\355\262.\033\234\230)\022\2442\255xe\241\230\353\234\240x\213\365$\215J\204)XHJ\360\250\177\214\246\237\221\026\034\033\375gV7gFR\033\251\307\266\273%\307$t\013\027skDodG\f\313\232\300\005kV\262\350\021zd\017}ilRW\312\272\220\264\031\335\353\0357\243\035\271\371\213\"}?\334\224"
+	.string	"6dO[\366\203x\344P\263p\371M?vx\222Z{H\241\2168\274\266\267\2716P\246O\273\361\273\273O-c\230\311\274\2272\367\021\255\002Q\rC\221\373=@\004c?\242\"\246\016\344y!\225%1t4\206\200\303\230\361\227\263\362\007\302E\236\304\335\313\274\335-ymH\\>\223{\303\353\267\373=\202\271\366\313\227wd\324f\321\255\277xx=\365\313Cp\362\351\177f\3020\266\357\331\370\331]\244y}\204\252y\374(\023\020\353\363S\212?\241\b\200O<(\261\020K\272\240\235\001RS\305@\360\362s{tl\025^\026\350}OF\375Ai<v`\003\227\374C\202F\b\211\335\017!"
+	.string	"xh0\315\021\346\366V|z+_\213\224\274$\242\177\332\306\206i;\3462\002\321]^ZP\f6t9j\203\016\251\003\225\224c\335k6\257 \036\023\305\260\337\303\016\276\372\257x\270A$\310\301|\302\230\240~\225\2211}w\335o\367_d\300(&\225_D\304\211\n\217D\341\021\257xu\374\206\035\263\n\030c~s\366\332Z\315\032u\221FN\024\2035\n\261\257\313W#\020\343s\206\235\301\342k\345\240UO\233\323X\240"
+	.string	"\225\302\221\270P\270e*\273\227\336E\252\225\354\203Q]\377\344\247\206U\037!\267\3063\322\0244U\ryN)*\221\232\332g\r\354xg\004\347\276l\340\rgz\250\rG\313\210\202\001\242o\201+\215\f!<\262E{w4\334\242\201\217\033V]E\215\213\260\355\337\0032\177z\312\216\334=\035S\006&\270\215Y\201\236\272\2736U\016\200\016\022Q\363c\221{\3115A\3522g\324\253Wp\t\360\373\226&\251\207<\331\222P\277G\301`J\210L\027\330'tup$\203h\210\326\t\277\312@\275\"RA\023D#|h\330WT^\001\310\252cp\300\\x;\331\223\017T\367"
+	.string	"\2419\037\312 \230\360\231]J\330@_\242\302\262\027t?\244w\307\337QC\252\0033\004\342\254C\304`\264n#`\225\337\035\242\366w`l\274\304\321\236\260\254\311\235\356\027N\004\2317I\177\351\222\361X\004\305N\351\300\2172\273\t\314\310\223\262\f\210\025@\\\210j\0047n\214\247'9\212\225j\313\310o\024i\234,\226\256xa\305]A\"\343\361\270%\311\036\312\227i\305\001AF,\\}\262[\262\242a\037:\3424G1\006\305\007?v\263tQ\365\235$-{\207\335\212\224UVN\352\303\314b\221z3\222=\253N\270\n\f1\033\237\3743\252\301<\253\253\342\257\367\325M\270\024!\352j\330\001ip#C&\346X\031nU\2201"
+	.string	"\362D=h\243\001\215\224E\204\375\321\327\3277\316 \311\n\277\350\305\244Y\032\337Q\310M\341\213\t4V\224]\305\0065\310\306j9\240f\264\2227n\b\243\224\022\327\201"
+	.ascii	"4\027\217{\360\267\026t<\016\305h\255\233\004\031J3\277\021\273"
+	.ascii	"eop,\243'\376\236\203\020"
+	.string	"(\246\t\304L\210J3gb\316\227\310\215+\312atj\033\377uu>J\232Q\271x\344\223\276N\265\273+JL\032K}\273fI\340\262\316\304@t\207\334\230\371m\355\353\350n\231\366\230F\314\017D\274i\243\253\030\202\bCn\001\026\373\374_\264\253>Vm\032\360'n=\276\027e\030\321\255\257^\266\242jG\007~\375a;<\316s\007pSB\220\244B-\024\3511\037?\235\276\304Pb\006e\2306\271Z\254\304\331\nt7+\321\256\b\214\216wB\2534\321\314\304\016\277\307\373]\271`\"Y\006@\316\212,`jwO\305\357\245\275#\234=\257^\207Oz\332O\227j\r3$P_9\362\375\002j\311\204[.\246\215n\315O\257\310\005g\026\326\256\005\256\236\\\301m\354V\200\376\353\262\256Q\302`\237\340W1\005\236\276\0319\330\331\034]}\360c\r\311\361\344`\303I\323cOS"
+	.ascii	"u?\210\3328\204\022\336\232\260\336\\1~\306\307\263\r\333\307"
+	.ascii	"\355v\315\223:\304\302\201\216\255\266\034V\357\001W6\367bR\205"
+	.ascii	"\261\3020\316O\220\335\315\272\353s-w\374\356\277\301@\217\017"
+	.ascii	"\21538\223\2045\005\225\254?\205\202K"
+	.string	"\f\271\357\314\270\320#\315\252[\300\345\260az\3179v\352\346A\227o\310\252\210UQ\252s\363\207\026\207\240W\344{\036u\022\177GiG\242\327\277\350\262\234\317\240ID\233{:\244\227\254\030\003\374\025\275v\013"
+	.string	"*Ol\021\231TQ\323\006\\/D\276\266\027\371\330\267\241n\0160j\237\343)B%\366k\3420\035\023\373\224\032\272\275U\375:\304*i\337\nm\304"
+	.ascii	"!2Y*\034F\330\271\212\240]\322F\235mX\364\256\t\315&0\3645\t"
+	.ascii	"}\002\264"
+	.string	"\255\241R+Z\356lx\360\027#\017R\021\026\024t\0366\007\023h`\007\365#\327\357\031z\315\270\020\034\350Jx\264l\270S;\367\335\036\004\025\351\321\365\370,\3029(\325\276J\270m\005\225\357\026i\b\363f\250\372\035C\2258\273)\232\361\247Lsx(\036nP\004\021\265\211H\323\362e\227t\001\327#\026\3647\336'>D.A\336s\256\031E\312,Uw\226\252'\003\315\275P}F\313\004\261\341\231?g%\255\361A\272\nH\033\345z\347Iq\351R\240\217b\224K\235\302\035\377\326/\t\341\311\032\241\260\223\017n\215\272j\377\026zh\212I?\360\307\022E\214 aG\353\312\274\023$\350\373\240\374D\233\336\232\273Z?\265 2\221;\026\260x\266\370\334H\337\364\330\r\003\206]@\002\245\332qU\021\003\217\322D\365)\333G\332\351}p\316\372O\371\211\227n\257\246\236z\236/,l\210"
+	.string	"\310\021,+\013\234\263\032>\366\221{\222\323TE\"\037y\270\353z\246\005\352%+\330i\362\277\226\304\3751\006C\307\232\265DMu\323.\266R\305\336\322\352K\327\331\271\276\364\030\001\016\235\274\246\313\374[2R\365\375#\274\215\207h\356\025^u\222{\013\227N\247\\=QFu\366\023\237\254\335xq?\342\004\271\315\b\225\322<\276p\371\353\352R\003\020\233\237w\213\334<\256L\017\235"
+	.string	"F~\355\304\026\335\207g\377)d#\035\3311\224\007+\035\334Q\365\213\206\274\352\345\373\241~\334\250\024\344\226\203L\243\220$f\313\177\007\307\234\307\233\327\313\345\372\2539\277\355FD\226\374\243\260O\227-\025\265\243\230\231F\236R\303@\350 J\235\340h\177\262\212E\270\346Y\307J\265}t\377\307\313}D\250U\017\317\006\213Vq(T\326\203\037\344\032\321x\224\032\023\222\370\262\307\200(T\tf\240\214\235\332\270\246x0\355\013\313\303$\307Q\336\236\274]\362\270S\306U\343r\233nfh\206\322\237\017(\257z\337\226\201lbQ\274\234mM!\214\016\250\240;q\300xA^[j5\311\n\310\036R\2125\210\037\302/0\r#\216:~\206R\237\025R\025\210\030o\243"
+	.string	"\354K\261\330g\336U\310\002;\373\213\276.~\260\373\324\276u%`zs\306\030\204\331\023C\361%\255\221"
+	.string	")\223D"
+	.ascii	"h:\375s\352q\b\367\033\022\263/\227\025P\">AY\006\r~P\360i$."
+	.ascii	"\007\212\304`\347\214\314\336\342\r\213\342\320\240\232\232#"
+	.ascii	"\0173\336\006\017:\bKC?\221\022\253\020\332{\2542({n\267\337"
+	.ascii	"(\202\271\204\260\353\327\342\200 \217\246\352\267\211~Y>\201"
+	.ascii	"\325\321g\b\347\r\214\241\025\254\201\307\333\027\317\317\300"
+	.ascii	"L\242\240A8_!\277-\3355\364"
+	.string	"\200\035|y\020\342\347\370X\355/\215h:&\375H\240\370\006#\004\266V\355\375\361\341\025\341\325\245u\210`+\n=+'\036\241F\3756`\bh\\\003\371\023)\036\223\345Q\253\375\264D\306\362\270U^?\001\325\365%W\274\266BI\374\221\206\375\323\035Q\217k\2549|pD\023n$\342g\252\213\233\354`\331.\033q{t\204\022] \216\241\311<\220\276\214\256 \346\367\266\262+\373^c\247z\"\234n\215\204\276g\246J\233\005\236\\yS\306\245Q\207d\375`Q\271\347\203\203e\316\026\306\275\t\241\276\230\325\211\262\r6\351\304\363\205\324\205\352X\274W$\305\306t*\346tC\037\2459m\230\301+\264d\320\"\3500\221\216C+\264\312\206!\353\225\210\r\303\300\202\200\006U]7\220'\227%\316\220_\001Z\2216\366\254\375\207\216\343\374\277\342\226yP\240l0\222\276\032\346\316\355\243\320t"
+	.string	"Q26Th\032v!\003\013\214\223\007`\275\001\226\326\311\274\327f\351\004\214\243\342\265\207c\374\341Y8@\024;\311\200\20304\220\f.\fX<\301\323\357\220]\236\362\f\327\301\031\264\023\210\r\220\227_40\016\r\262\203\031~Y\242=\327e\322\247Z\352)\2339\224%\316\361\314S\275\005\220\261\236\331Ub\022\365QT\2455\334\215\241\277\272\241\210\273\321b\377\307~p\306\217\205\367\266x\200\314,\251\202\273\311^F4\002\2735r\336`$\230\327+L\321E\026\207\024\216\037\256C\246l"
+	.string	"\366u\343\001\306\3247\205\234\262\256K\341 Zd#8L&\260"
+	.string	"\377\237\213\004\036\214"
+	.string	"K\202-o\030\216`\303\276\210\204zG\242\270\003\267\202\365\266\210h\331\\{S\361\211\332N\236\025=\323\262T\326\354Ql\263V:\346\277p\020\243\324\217\360\022p\332C\304\367\267\313R\230w\210c\311\020\243!\366\356\337\233\005\236\273T\210&\257\301\367p\324\256\206\330T4\370z\013S\257\335\266\215\fju\242\202\2623\023\372\377+\242\307\354\326~\233\331r\001d\236\356u\250\026h\263\022\333'lOM\020\007k8Y8\207\254-\022\027f\0335<\b\323\255\255\003\230@G2DB\233\024\231i\313R7\325\270v\001\361\t}\322\216\003\314\205B\277\202\311\370"
+	.ascii	"\366\3559~\261\325\272W\322\356(~\034\330\245\353(\343\006\242"
+	.ascii	"0\316Y\360Q\241\215\020$\355\327\205\353\327\345\352i!c \\#\375"
+	.ascii	"\360\352\201\002?\204T\026\272\320\306b\300p\202\336\341\222"
+	.ascii	"\341\013\351\226\332\fC\240\246\255\b\241U\331\"\245A\204v\004"
+	.ascii	"\243\234\020\376|\030DI\032\001\320\323/bodc\266\216\214J\340"
+	.ascii	"\301\241\001[\320l\242\210g'\"\376s\256\346\325<\311O[i\f\337"
+	.ascii	"\350\350\204\246\274\352\177\222\225\327\214h\034\316C\315^\274"
+	.ascii	"'\374Tx\007\327\374.D\200\202\347\277\213\023uzev!H\211\275\357"
+	.ascii	"\n\360\217>m\244G 7\b\013\331X\331h\276I1\301n)\3052\bC\002C"
+	.ascii	"\325\300F&\3618\275"
+	.string	"Q\257\356\355*r(\032\f\261\247(\320\233\nV\004LF\351\355\310r\226i\266e\200\016\261\262\2269\203\315\232b\257\270\305\307\232\2420\007i.\237\215l\b\b\236\256c\263\226V\3641\n\247q\256_X\022\031\227)\017t\324\317\276\213\2016\001\226\263\260\221\341H\032N\264\273\223\326\020b\367`\307/d#8\b<@N\315i\216\343x\264\225h\222\033\n\004\231\317\341\021x\377Y\307\035^\336\306FE\211%\035\003\016\322n\221\031\361\2549\004=\2249I\2545\346\303z\312RBg-\021\237C[\322\351\322O\251\263,n;L\037D\324z\217\320\324\204\005\261M'v\262\343\f\261\256~Z\307\025P9{\226\342\360\267\302\240[JD8\r\346Y\262\261$ \024\334\007\367p\256\354\227\0265\200\034}v/\207\267\021Q\0064\374T\346Ar[\017\320\357\360\207\301\203\005}2\007\367\242\366\031\225"
+	.ascii	"\221\347#\300x\211\355OO.\301\271\025\274\311\374"
+	.ascii	"V\316\213\\\026\370Z\257\320\321\224n\332XC\b={d\247\373\\\266"
+	.ascii	"F{@\232\311\b8\370\336l\340k\222\253/b\234\237\242Wv\226\374"
+	.ascii	"T\375\266s\367y\347$\nzv\263\315Q\013\236\346JbS^R\220\331Ne"
+	.ascii	"\324Lf[\005\261\0356B\260x\346\003\331G:C\215\261\006\373\035"
+	.ascii	"\256\034\250\343\240\31795Q;\254\032[\363\375\266\210\352\344"
+	.ascii	"\237=WiF\223\036\375}\303 J\021\360\315k\276\321\344k\235\227"
+	.ascii	"\311E\211fQT\254 )m\304\353\027p\030\204\213\220\220\251Q\314"
+	.ascii	"\354\302.\240\302\254\214\312\360bQ(\373\257\370z\372J\023\230"
+	.ascii	"\264\243\304X\304\302\3544\370]\351\313`\353\377\230\277d\016"
+	.ascii	"X\017\211\364\321\210\357\334\257/\252:je\214\250\007r\376\345"
+	.ascii	"Vd\225\237+\365\374om@\354\224?\342\377\3230\350\300\322\374"
+	.ascii	"\3703t\251\034\204\326d\030\324\300\265Rtf\257\224\002h\3070"
+	.ascii	"\217\225\032\337\002\035\344\262\234\004 \235B\034(\220\266\b"
+	.ascii	"Wf\365t\242A1\022\373\243\263\241\371\312)\022\303|\030\223?"
+	.ascii	"\361P\330\374\357\366L \221\203-\001\242\005=\373I\344Sy\027"
+	.ascii	"\227%<I\034\t?\236\254\342\334\223q\256Gp\030\225\206\211\232"
+	.ascii	"<\013\200\371\372\222\020\231\363U\253\f\004\0321\247]4<\324"
+	.ascii	"@$#\036\306AY\013\016\002\265.\254r\257\033.%\333\002\274\356"
+	.ascii	"\357h\037\326S\201\244\337\214<r{\031\007b\002\f\t\216((GV\257"
+	.ascii	"Os\274\277\227\032!\225\256P\326\235\005\246\211_\321\243\037"
+	.ascii	"\263\223zh\336\032\363\3373U\225L\022\224br\376C\332\357\005"
+	.ascii	"iy\331\017\026\006\t<\242H\213\245\322\005d3\266\031\227\262"
+	.ascii	"\254\311\365\304\203\320p*\304\373\202]\235\233n\201\032\032"
+	.ascii	"\276}a\331=\034\216\003\247\211I\366\257\223\240*?("
+	.string	"\354\335\366\210\321\206\352\355F \227\021\262\036\224\006\023\253\212\345*\b\310\305\317\335\301\347\250\233\005tV\021\260P\b\245V\215w\312H\017\b5\007\354\212-\231\346\241\204\277\311\n\267\2608\374\035f\224?\374k\245\211hp\310U\273G\r2Q\214\374\301\351|\2577+\252?\013r1v\341\362\320l'\177\326^\220*h\377V7\241\334\351\3354\017Cq\300\243\203\243uyZ\317Z\204\031\032u\006\002b\265\216\233\335\021\331\204\351\203\272\331\031\267\020B`3\026\263\230\201\3124'ly\206o</\217\240\262[\266\350\245\322\351y\327NZ\312T\360\256\007?mvel\200-\357\351[\376#A\306\013\345\302#Y\n\3346\227\204\320\321\325W\323\350\215\005yG3\232S\232N@\203\244\213\331\001\215\3350@\377\273\210W9\210\227D \234\300\353\241\004\226\b\357\232\257\260m\333\304\303\213\221\225\3337"
+	.string	"t\353$Qy\375\201\367H\273\303.9or\273%/\211\bS\250\262\223\336I\036.m)\376\305Z\226\033\f\"\3138\210\263\263KQ\"(\354\370Q\320\224\322QP\300>[w^r(\327\307\360$\365du\n\201"
+	.string	""
+	.string	"T\001\005\314n\364\001\243\326\267\236\244\304\001m\206,\276\351:\257\3724\313\246\304\360\334x(^Z4\350O\222\017pf\214\213\274"
+	.string	"\360NO\236\276f5\226\364\036]\354f"
+	.ascii	"\2522\353\372\347\020\n"
+	.string	"\374\t&fx\330b\025\372\022ts\337\rn\260Y\036\335fD\n=\023\250\222\3700pJ\231q\006\317\313\201\254\274\245\217\373z6f\177y=\022\036\206F\025&\324\366\033\352+Nx\324v\243\f\227\271!\373\021,Y\222\250\267\246D\232\351I\226\307\375\266\336K\336\273\003\277\274P\262_(\334\002\236x&@*}\361 \220\314\234p\003\031\354Y\356\321\232V\244b\263k\260\032\205s\354\366S50\f\337\003\303\260i\260\205\236rZ\317m\237]\343_\216\370b\254cP\356\272\307\016!\317sW\031\333\374@\331\241\270x\336\305\n\260\357\231\270bQrn\334\005\300\233\262\225h\274S\307\264\347e\333d\b\356\fv\277-=@\250T&\204\021\325\032p\007\324\004\372\016!\326\210ii\321\345\2657\227\031D\225\321eR\017Y\264\325T>\373\205K\212\2256x\021A\r\017/X\240\036\260A++"
+	.string	"\001\\lY9CIU\261\3244\2730\252\264xd\377\251\243M\324e\270\013"
+	.string	"\270\233\374\027Y>\0069R\013\363\275a\001\002\356\036\023\245\013\271\017\374\251(@\242\312\002\333\326\251R\257\366\214\301QE\036\361\"\267\030\025\252\351^i\265C<\252 \021\221\022\253\237\006\276\252\004\307\203\310\247x\244\275\n(\270\330R\326\257[`\032T\210\0274\364\365j\353\245_\021\204\313\231\034m{\353\264\253\244=\362\203M\237\203\373\036\220C\307\234Mx\316\240\300\254\353\370\023\207M\0037\003\234k\226y\200\233h\f\366[RP:&\013)\340e\332\212e\b/\0365\334\320\220\023\3310\022\351\002\247\353\0039\3716Ke\323\306@k\225H\340\310\376P\271\306\023|R"
+	.string	"_E\273\346\205\313Y\354OM\247>\315\213\214\024\215a\252\324ZXB\016<\345\\j7(\231jJ\322\277\346\336\231\021\264\300\365\255H\263\020\241\304i\341\214\347'F\223O \255s?\320x\322\246\007\337\363U\310\035\215/\204\307r\310x2\260-G\030\367\372\0214\034y\331#\335\347\002\311\n,\302tB4s.$\317\346\200\311C\255'\243\363E\273\006z"
+	.string	"\232\342\341\243\213!B@\246n>\361]\302\242:5\355K\244\367\026R\337\314\332%\026+\251$\326\353\274\t\267p\226\244\212\020y\326F\035-\263"
+	.string	"?\242\241p\201vQ\320\023\336\271Xx\326nW\3423\354\205U\224v\356\\9\0043r\220\026d\262\f\245\027\327ro$\264\354D;\312\367`)\016\320Wf\033\261\300\022\r\311\005\364G\037\360\340\231 \237kj\325\016\324\246\223\033\001\305\227\335\257\215\220\257B\241\247\n\t\220b\221\367\375MC]\347\277\234\330\t\266\377\222\b\027r}\251\246\213\323\262\371\260"
+	.string	"\365m\003\327\270\0206\305Q<\243\3422\373Y\260\"\316\371\302\005\347\274\017FL\227\217(\377\361v\240\324\205\223&AS\t\307\n\363,\271\200\301\2248\222\034\223\224\263S\301\262\3719[E\326\245\001\306\2143\017E\274\357\255\362\024\303\310D\347\344\2019\376\032eZ\007\007]$P\3151\202\022\2058[\021\211\364\031\250\233\r\344\274\275\031\237\362S\231\326\037d\214\317\023\222\255\261"
+	.string	"\330\351\256\362\350\017^\267\245S\332\354\\r!\244\232f\004;#\347\324\006-=\344\327\214\206\177\367\021\203Ssmm\\\260\346\222)L\236\3066p\356\334v\344"
+	.string	"_\311Bl0\221\307\001\266\021a\331\274O\325\341%3\307-\352\266\340\215~lPy\306\362\273N\322\2465\270\252\304M#\r\207\221'\352\270\206\374_\202\321V\270\342c\026zEY7\034,\361y\r\207\364;b\2044\027\020\336Fd\207\353\220\032\233\374\375\351.\217\2129C_\2642\354\344\212@\311\340\237{\004?h\203\235=c\251\343\211\013eO\242\227\372\323%\002\267\003b\243'\031\331\245\312\n\376\310\"g\371>#\2037I\311\343"
+	.string	"\232\364\234\302\340\257\326e\317\031$TA\203\340\331\263J\212"
+	.ascii	"\223[^\243\217B\326\240\b\214\371.\244bq\353:\334\231n"
+	.ascii	"pY{HZ9\231\227W^\021\333\366\315v\350\307mP\301i\321\253h@\242"
+	.ascii	"=\013QY\353\n\030\202i\310\023\221s\220\222\2159\177g\340\217"
+	.ascii	"\331#K(\253\266\035A\\>\003\312g\373\020\366T\004\blA\271\177"
+	.ascii	"\024\264\324\205dL\2044\357\267aK\3467@\355|*\351\325\216?\025"
+	.ascii	"S\235a'U:\266\nR\254fwy\214\376\345'\311\270A[.\210\375\344\372"
+	.ascii	"(c\372\016um\332\273\252\201+\033[b\312\233\261J\307"
+	.string	"\322\350Z\334\271w:~\256y\353(\223\024e~\326PD\004\334-\240\2359-E%\335\324\340?\245\276%\235\377\3442\373C\250\330\336>w-S/\364\264\362}G\245/\247\251N\361*pAW\235\324r\257\364\364\022Z\026\033Td\303\277\036\244\177s\351^\330q\273Z\236\275\tU\031\td\311\217\371XL\026\006\364<~\274!ZJ5\233\007\215\"Td<(\336\322\021k!1\252RV\357`Le9\301\367G0\367^\260\224\033H\203 \213I\331\341\036Y\354\031\305e\016M_\031s\217\333\336`\271\330H/+\232\310(\275\335\274\021\234\271\016\241\353X\347\375xj\372f\310 a\030@z\354k*\250=\262\227\315\271\270\030\b\bi]0Z\371E\364\272\007;\235\215V\322\034,ID\267O\241Oq\363\274\n\227\263\025t\376\030!\002l\342\213)\n\353\210\352\321\021\026\354D~Q\213"
+	.string	"\307@\371\314\034\277\325\241qJ\376|\303\372iR\2753\226&\026EU\337\322O\217\350p\016\325\373C\372h\374PBQ\227\222gr\375\234\261\370K\363Z\3163\245F\307<\376\340\231\340T\231Y\036\244O\247A5\177\302\030\262\250\227P\332\360]:q:\206\245\360i\334\240\007\213\316\237\366c\276\r\3716\322\276\274\t)d\323\220)\364Ht$3\212\217\253I\251\3078\264z\206\031tg\374\255\262\"<\332\023\276\203P\254\024g\217\201\313T\331\317\321\365\310\203>\261\232\007\302:\005d\005\333X\031<\266\021\272@~\007\235\310\351\207\310\372\236\222\335o\025\033>e\340eH\211v\222\310\350\353|\262\303\355\200"
+	.string	"\201\030r\337\032\323-\240E\352\332\312\023\272=\353\234X\005\325\222n\221k\331\236H\236z\306\227\277l\261\013L\361Vwqc\r\262kB\357W\310\254\225\016/\211h\314\230W\341\205%\216\254\231\017|\324D\302\300\301Q\337!jd\302\003P`\251"
+	.string	"\n\313\005\"\353\r!\033\3550\266e4\340"
+	.string	"\216\016Y_\2178\023\275b0\227\362D\020$W\030\r\022\214\021\244F0\355\317\r1V"
+	.string	"\027#\t\271%\361\212\221\337J_5\332\327L\247\274\334Z\215\034N(L\3107\317\215|qK\315:A\032\262~1I\230h\034\275\337\324\214\366\270\034VC\t\227A\244\243\025\027+\214\355uU/\361\336\323U6\331z\026A\231\250\313c\001\036'\230\251IL\253.4\312\272\016b\273\370\b\002{\300\2624nV\315h\367\334\367h\215\237\276\020V\276\377@\310\020\360]M=\365\270\234:\0269\323\312\013R\331/@\365"
+	.ascii	"\273\212\270\002\177\336#)/\021\363Nc\2334\035\375\302\332\344"
+	.ascii	"\320\302\326\222\301\247\355\227}sh\320\255\nM\212\273\3338\372"
+	.ascii	"F\317\364\253\003v\020)\216\270Ir\335\240o\225\3610r\021\021"
+	.ascii	"\341"
+	.string	"\266mNx\035}\211\0268B\334\270\343\255q\3547\227:\210l\030.\017\217\251\264\274W\373\240\034\201\271\324k\306\023\343_\206F-\306\2067\370\003r=\210K\336[R\231\365\310\272\025\f\3007\273\016B\347M\007\317\261f#\303\252\2316\344\036\250\322\247!o\351\337\200U\257-w\254\250\r\257>Y\323\241\360\300\230\324\020\211D\n\350\313\013\351%=\323\364\233&\315r\361\367\350)\261o\003\035J\334\b\332\n\246\327\0075\361\321X\026\344Cz\341\322\207\255\203\257\326a4\210\360\201Z\326\371j\217\250\256v\362;\254\221\243\354\264\264\370\032Q\177c\335K\216\310\25427\3204h\321\226\376y\346\241mj\261\r\347\215v\206\276[gh\232}\331\033Z;]&\034\260\337\226\301Me\005\214\020\0229^1\224\274\023rkh\2145\213\226\004v\022\213`\370\246\0307\206\376\n\353MA\203\361\313q\270"
+	.string	"\022\344\206\303\337vZ,\255T\030\f\355"
+	.string	"\325\360P\017B!\253n\"F(Y_\223/\330\321\3135fX\332\256\356V=\216\276"
+	.string	"r\237\235C\220q\007^9\250\360\007`\354,\223\2042^\361\230\217*Z\327\020\226\346\244\353\341\313lx\344\276\037\271\224\331\276\327!\tz\353JF\201\2747`;<U5\350S\bK\312\342f\276?\276)[\364\236\223\260L\255\353Wr\367\256M=\302mU9;\024\220t\332>\312\355\013\017\\\353\336\021\267\376\217G\034\224\265\257\251&@d\203\016Q\376\324\024\200\024\241n2\355\0303\030\021x]\337\371q?\233\177\202\310\272HR*\351\2372\254\246\371U\020\2179x\274C\254\322\255{\360\321\351\224*\352\321\304.q\352V|:\333dCh\311nu\nWT&\004\242\277\234M\002\366\333\300\3406\254\241\2341\330\255\302\257}4CG\t3I\316c@\004\337\314\315\322K\331\3304\226]1\231t"
+	.string	"z\266\266\303\026(\254\252\244-\022Z\037Yg\031)\332\311\356\217\f[\311\202\333C\340\316\335\033\213\022\314\362\353\371\352g\314\035vd\177$\310\031]\217\260f\253\366\b|d;\017^\025\230'"
+	.string	"\300\276\325\212\003\345"
+	.ascii	"/\242\257\345\376?g\275\226\311Z\003\244\302~\b;\216K*tmW\263"
+	.ascii	"!\264]\356\250\214b!\267\334\220\023\362\205+[,\352j\246\247"
+	.ascii	"e*\256\355\236\217nI\326\207\214#\003z\222yA \"q:\265\203\302"
+	.ascii	"\013h\013\255\262\344\301\032\322\244\233O)hC\021\232\237\fa"
+	.ascii	"d9_\340\353\334\247E\272\0175-hY\305t\210\301\371S>\267i\362"
+	.ascii	"e\226\0248}\004M\205X\003\177,\020\035\310\237uH_\346\b\203\370"
+	.ascii	"\320\buu\221\256\377\335B?<S\250eW\037%\030y\245B\324IR\207\356"
+	.ascii	"\202v\031;\262\353\005\340\277\236\354\205\264\365\225t\252\330"
+	.ascii	"\r\3139\253\256\200\315\251TF\203\360\215^\301\202P\231\267g"
+	.ascii	"\002\343\373\225\030\311\277\1772M\213\3124&\205=!\b\254\324"
+	.ascii	"\350Xn6P\216\332\256\223\255"
+	.string	"(\354\331]\355\260\224\347\320+\375Z\211\245\313\026\002N\2561\307\226\254\316\370\270a\272\321\245{\213\374\034\331\341\003\253\007\352X\275o(Q\250;\226\274\326m\272\323\242\372\t\322\223dS]ec]?cz\325o\nr\2264\312$\272\343\315P_\331\312\241Or)\266\023\305n4\211\245\237\351J\270X*\205\232\377\313a_v\206\032K\3315\006\025\334\020M\027W\274c\244h\035\274\302\304\354\367\341\304\311O\364\342\361\351\302)7\236?\017\301\364\365T\217\fE\210\036N0\354\317\231o9\254\226\326\240\017\373\375\364]\223\377\231\264QtO\224QB-eE\n/\367Lx\257~%d\313;\"?DF6\177\030\270\246N\335\241\016\257\333\220\036\273\373\331\337QC\251\022\306\336\206\020\222f\274$\035\233\251\323\305(t1R\244\326\304(|&D\266\262\263\234a\313L\037\344\367\320\024\002\037\343\366"
+	.ascii	"\343"
+	.ascii	"\"C&\006\364[)/{\304O\323\303\200\213rPk\264r\252\260\300^?\371"
+	.ascii	"\245\243uk\222nd\357\304Hp\312\213AJ\241b,\005g\260,\230N\301"
+	.ascii	"\261a\327\332f\322\357yq_+E\271S\177\374l\351\260\350\311\314"
+	.ascii	"\372P\316m\027\314[^H>z\337Co\243\360\246\351\254$E\t\032\350"
+	.ascii	"\376\243&\231]\363\345\217T\247\303\260:\371\244\r\224\364\357"
+	.ascii	"'\223h\252\223~\327\260\205H\0336C\305\253\006\267\347\237\332"
+	.ascii	"\252/\3454\205J\006XF}x\365\304\b\271XI\3706\322\362\327\261"
+	.ascii	"\177&Vw\017\027cX\362\372\205\026\262h\255\2056v\340\201r\370"
+	.ascii	"\023\b\245\2128#\314\217^\2651\322H\365\364\200\035\251)\336"
+	.ascii	"<\020\tn\342\312\267\223\240\217\210\337)\220ay\\x\372\323Q\367"
+	.ascii	"5P\371\263\221\217\203\205C\006\337}\305].e\363+{\202$\277\202"
+	.ascii	"\323\036.2\241}\3535\230\247\004\207\310B\\\377\252\243\n\215"
+	.ascii	"\245\025\301\350\006\237TY\241\3569\r'\317e\210]N\270@C\033\372"
+	.ascii	"\317\004\343\264\002\243\361\366\200f\262c\023\355=\263\370b"
+	.ascii	"N\216\361\343\326\327|\366\352c\313e\326\264z\350wW\2573\030"
+	.ascii	"\016\274{\335|-F\206\214[\317\304\340j^o\004\017\013\232?\377"
+	.ascii	"\234\207{\326\222\375\020?Q\31392E\346\246\032R>\226\002\211"
+	.ascii	"\202N\357\363\001\247\232\031x\307\nM?*\260\250\tYN+\004\260"
+	.ascii	"\035\034\347\351\177\250\226j\206\272\335dS{*/\275\256\251\200"
+	.ascii	"\006\345t\225\274F\213-G!\231'+\350\tx\365\230\310\023\263\""
+	.ascii	"O6n\bX\202\255\024\001\300\203d\274\304\320U>\353\230\317.\006"
+	.ascii	"\222\273Y\003\257\nWd\203\2007\363]>\333\313\212Zj\233\254\235"
+	.ascii	"\370\224\227D]^\341^\252W=\344\347\316{\247]\276j\243f7\310O"
+	.ascii	"u\205\266\035\226\313\3515E\265T\206\250\032\356~y\230\326\232"
+	.ascii	"\270EaY\205\264d\265,_\2710\341+\276s\017\341:I\255\320\005p"
+	.ascii	"\264zx\235~a\354f%\217\243$\372fb' @\026\266\257u7m$6o"
+	.string	"h99\271\255\0305\224\2342\024\247\342\032\024\021\365y\036\002p\3400\t@\373}\220Vg6\244\256$\322\226\212\024\324\321s\377\301\365}\366\0054\372\013\205!7\325rB,v\321\001\\\f\032b\205\216Fd\252\306\0218\352\273\256\004,\030\365I\003\336\003#<\2266\177\033p\335\214_F\302;HY9J!\273\030}\230\232I[\316bW\036\304r\362\345\204\316jJ\317\232:YFA\343\n\231\322\274\205\027\007K\372\264+\017\264\362\003.n\276;\034\353\262\236X\"4^U\241\036|\345&\253#\367\246a\265!\270\255\237\017sd\311\220\373\213\b\001\b\201\350\335\233v\344\313\006\207\207<\367\004\305^\347 \b\333a\214\036\225\270\345\303\024\t\321\374\225D\243cA\342\355S\327\376\201q\371xe\205\001hi\200\351\362m\226\301DkF\232u-6{\247H\200\274\267S\032\032\352\221jZ\201"
+	.string	"\r\365\217a\037\"\260\244\206\377l\256\337\320N\200O\037%C\355\211\214\024:\3357\212\236\027#`\251s>\356n\271\230\215\214.Mb,\247\222,\226\200mG\242&\263\344\346:\3302r\344\342\254\333\337\365\335c\205\023L\365\306"
+	.string	"a\352c\034)\244\372\2255\337r\375\364f\304\231\216\237\231;\316\007O\230ne\001&0\f\036\272\2524\361\236\246\034[\333\332\372\021+\\k\032^\035\032~\215\316\303\215\331\315\bk\332EREj\r\263\226\207\265\275\212\\\033R\253\337m-\247X"
+	.ascii	"\034\340X\204\354\365\314\317\353w\326\177a\035d\253\341\253"
+	.ascii	"\027a\260i\253\343r*\352\270q\321\306+\311\215\261M;\212@2T\316"
+	.ascii	"\301\212\3157B\267\355\254*\201\356\326+\201\363\3534\375`^\305"
+	.ascii	"\004@u1\033-\223\021\317oZ\035p_\245g7hQ\200\337<\023\001\223"
+	.ascii	"?\334\257dq\016\276I$\255\256\235\276L\033\001\036\241\0358T"
+	.ascii	"\354\343\265s\346\213\034\020Hm\037KV.\0055\256\367\243\365\362"
+	.ascii	"\326$@\"^\233\026\203p]\327\227\003\003\247-\\<\r\361\006\306"
+	.ascii	"\2612\250\213\3117\352o@\224\261MM\347b\346cO;\362?\370\256\270"
+	.ascii	"\216HF\203\227\226\031\244\\\303 \023\005CGu\362\tH\2638\231"
+	.ascii	"\034\215J\205<`\n\207\327P\242L\033\036?\254>\303\326\247mW\206"
+	.ascii	"\200\365"
+	.string	"Y=9)\3413\022\n]\205\240\360\201DX\372\016\"\205\036\371\022m.\357\257`w\260\366Y\254UQ\316\204\2123\242\270\251\022y.\356<qz\262\272VZ\f&\2117r\323\254\036)\332\353[`\222\277\222\271r\272\271\342\206\0050k\022=\004\3740\300\200{\006\273\203\336\360\340\216\214Q\\\016\\\225\\\377%Q\274\2239I\354g\272Q\236)L\005p\365\215\231\t\340S\340\f\343\204{\253\223\273\326\345y\001jpN\203\023\030\213o\213\211\210l7u\250\3730D`\217\205\210Sk\221\034\210\324\007\357\t\266\235=!\334\241\n\330]\3521\250\261\253\356%d$S;wf-2\352\177\311{\321J\374\2647\007L4.`\235\255\242\351o\027\016\327\371\277M\356\236Q\2526.\f\233\032\3572L\230\r\007\n\340\036A\202\273\n`\243\352\37480m\207\360\213\021\364\020\251W!C\313\f\363\246"
+	.string	"8\252\367\377\354\030\223hHPL:u\275\261\254k`\340Z\376\363-g\221|4\"\371\255\303)1*\205d@\226\213\221\217E'\203=\261\214\244\230U\243\020M\bQT\247k\030S\333\373\310\022\205z\320w\017\211\333m\223cv\200B\177\253\201a$\027\225\024\222\327k\200\362N\220\007\0324\341\341\006\236N\303{]\240S#\243\324\340\275\300\n[\316\260R&\223\306\205\233\013\247\200`\344\330\002q\223\202\020\260\310f\320*\301\263@\312]\231B\213\320\016\2339\026"
+	.string	"QAio'3{\323\032\316\211\317\225\314\247#\315\344\343\247R\025\313\300f[UC.\t\013\351t\313\021\370\244a;\340*b\366\321\373\341W\034\346\354f\231\363X\021\341\243\370YV\3075r0Z\212!\017\314R\002\002CM\272\300*{\240\262\324\360=\240\275(a2\022\304\360\013\312\037\311\346q!|P4]\023\274}\374\006vf@\216>\310q&\204\004\334\370\204!\212W\263\364\335\356\035^X\013\203j_x\013\311\274\250T\357e4\373Bt\234ZT\251\316\306\234$\345\245\232\225\311)\325\037\261&\261\3532m\367\260"
+	.string	"\374\007\021@t\326n\263*j(Sif\004}m\02395\321\3106\3776\236}\276DN\026O7\211\232\210\263;\232d\037<\002\364\002b\200`\370+\322\256iA\2473\363*g\335\355i\3769\372#|.&Cv\304Gq\262\323\b\343\313\360\254l\214\307\200y\324Z\036\231\013\032\004d=\237\340\344\303K\232\023O\353\002\200\233\263y\026M\327|.\246\222\023\323[E \303xLD\030\326\223G\321%\343\204\340\217\"R\202\276*\371\232PHM\335^3\257V\"H_\277\277\216h\237"
+	.string	"\254\024\305k\3176\355h\024\246_\266\030b\271\206\314\312\266\214\227P\242\3420\254\246"
+	.ascii	")\223\216J*\363L\354\013\331\302(\313\006{\371\177\252\001Vv"
+	.ascii	"\274\376\020"
+	.string	"RT\376w'*\336?\240\243\t\364\210\245\221?\243}\327Tf\332e\311yv\377RO#n\020'\375\335\315\013\351\357\263\226(?\004\022\306\252Mo\324\332\212rs-\242\002\"\211\"\350)\240\244\243\364\177\351V!=\227N\342~\b\225\252Oej\224\2350\262\f:\302@.\224\256\256\354\342\327\221\341k\021\347P\203\270\233\217\256-*\365)>\215\206wr\027\327wY'\204\227\235\241\032K\362\320X\364\034\242\005\321}\351\032!\364e\"\227Oy\215P\361\372\262x\274i1\243F\r\f(\313\007(+\373H\377['\375B\340\r\377\273\003\270\021\350ze\212\003\204,\312iF9\314\035X\0268f\"?_\024\244-`>x\272R\350\341\330\311\303\307\033&G\202\216\026\325p0\334\260\261\316\3355"
+	.string	"\341\300\210\030\021\031(\300)B@\332\370\331\313\233\226\340\016\244\231I\177F4]\323\334\330x;\234\b\307F\335\177$+\252\315\022n\320w\251\322\3730\317t\221EV\037<4?\031F\353\341\332\330\301\2117\025\367\256\223\373N\330*\363r\235I\366\377"
+	.string	"r\026\252\321\243\204\232\356\366\352\r\301\177\263\325\n;J-P8\265\304F\371\214\251\017\226a\230\002nm\331z\210:hP\356\030\302cX\\\205"
+	.ascii	"\020\310\t6\352\363\034\226\322*\3278\347\353815U\361e.\364\260"
+	.ascii	"\205\232\240\022\036*\217H\302\221\217L\335\327\346\316|)\272"
+	.ascii	"\036&\233\227\2270S\230~J\221\033]L\330\276\364r\177\\\371C\252"
+	.ascii	"\300\332\362mB\217\371\325Mk\313\343\020M\315<u{\247\r\n\214"
+	.ascii	"\252f*\201\374%z\2424#\020\006>\246\312b\263\007g\336#`\373\031"
+	.ascii	"B\255\224\016\344\343\313\363\305\232\037\004\202Z`\231(\371"
+	.ascii	"\021I\021\0048S\351\034\216\231\236\2036MO)r\353E\207x.q\204"
+	.ascii	"\307`\371\357\313R\203\3079dt?a\221#@\224\376}\227\221`\b}\272"
+	.ascii	"d\027\267\267\340_T!\253\035A\257Lf\255\177A\2562\251N\027\332"
+	.ascii	"\017\367\245\025\034{\036\016\227\327\200\262_\353\345\307\t"
+	.ascii	"|\361{\016~P\226\020\177\316\345\244{\266\b\004\340\030_)AP\t"
+	.ascii	"X\354g\322a%Q\327aP\340\264m\364\rx\036\232\361\031\370r8\357"
+	.ascii	"\301\t`}\004\003\177|\221e\346\244\346\354\264"
+	.string	"\263q\336\016\273\236\315p\333x<\343\247\211F\022\235z\267\321|\1771f[\353\212W\271\220\r+\336\336~fQ\314/\350\027U\272{~s<jR\365|\221\252\310\373\201;\226\366\345?\371\361\375=\020\2536)\004\214OM7\220\234sd%\252\354\r\ro\\,M\006\023\275\024\213r\204=^#\\\235x5NW\201V\214<\300\350G\206\353#\340\331\031\232z\304h \2635\bp\"\247\026\327\304|\216Oc:j$R\232+_@\230%\260\347\210vP\254a\223n\350^\343\302\353\230^B\037\374\267S\367\324\302\230\177\334\2674\003\236!T\344<\275S\026\275d\b\223\251!\331\277\235>Y\275\370>@\270\314\335\032&0`\336\317\177\f\340\346\275\244C4R\322\311n\247\263\031\201z\212u\230 5bA\004\031\366\177I\345[\320\003\322\330\370\017\201L\264F7k\276`N\210,0("
+	.string	"\321\301a\372`KI\303\300\352z\357*\201\017\241\021\013\r`\273\314\247\261\246J\244\362\322\355\365\235\2616\226\301\372H1\017qJ\004\201B\310\323\255/\026-f\fG-\376N\302w\225\340`\004\330\tT\002\177\264\td\315\244I\326\314*~V\336\270\225\352\377\t>\2460z\306\341\375>F\bU\n\326\250\356\377\246N^\240\377&$\261\035\032V;4\023\240\233 E\354\254\034\262\025\272\036\240[\304\303s\303\201\027\023o\365]H\302p$\207v`\236j\327v\273\361\r\345\204}j\034\210\340\356<\306\017ea\2500t\275\350\220\346\032q\236\002~\363\254.\007\230\200\220/\213DE\0246\331\246\346>\331\335\217\316\353\201\034\347"
+	.ascii	"'\367\034R\r\320\300\035Ry\332\3154\301\271f9\036o\017\221\304"
+	.ascii	"9\257Q\226\307\326\242G\373I\035h\225\002w\244\334,\3565\345"
+	.ascii	"\227\307\370W\365 \372\232\254l\2647\347:\263\253\026 Q%\226"
+	.ascii	"M\217\311S\b$\020\032\375x\3140\313R\200\270\363d\003\347\203"
+	.ascii	"\240yu\034\312\217\231\004s\031\253\252\211bL\231\3007y\027n"
+	.ascii	"\236+\023\215?\377\026\341X\300\224#!=\213\265\225\373K\341\002"
+	.ascii	"\330\374\252\305\324\374\033/\275\221\337L\240\312Y/\243\316"
+	.ascii	"\n\264/i\370V\344q\272\244\017mZ|4NYT.>\332\r\317s\247\232d\204"
+	.ascii	"c\254t\013\027\365(E\250\265\337:\334y(S?\361\003\227\261\263"
+	.ascii	"\357\021\375\345\031<`,\274\347\211p\254WB\274\r\262\221\n\302"
+	.ascii	"\236\252\340A\032\215W;W\257re\361.A{\332hA(\216@{\225\217*H"
+	.ascii	"f\005D4b\311,&\331\374\312\2555\374UD\347\221\222cR#\322|\317"
+	.ascii	"\333\373\215\370b\232\212\270n\t\316\351Y\2660\225\374\031\251"
+	.ascii	"\241\326\241u\340@\251&SY\262\204\303\341\0258#/\334\321\300"
+	.ascii	"\261=\271w\264\320\273Po\234]\307\371\356%\255\353?\206\351="
+	.ascii	"[!\307d*?\321\315d\023\213\261n\2633\032J\013&X\026\324\201\032"
+	.ascii	"\320\321\342\227r\375\361\332'\32523\256\304\323\260\263\223"
+	.ascii	"U\214\257\017\262\332#\024\372\360!?5Z\305\304\200\224\333\025"
+	.ascii	"\022\266 \363\212S(\347(\013\203\2559\212\237\035.\244\272\320"
+	.ascii	"C\376\244\\+p\352\342Y\311'\317E\320~N\303\201z\202\247/\244"
+	.ascii	"\235\024#\270^w\226UA\340\353\253VI\017R=4K\031\340-\230\365"
+	.ascii	"!2 \201\213D\307\nu*@\211\211\376\371\2575\312X2\013\304\225"
+	.ascii	"!#\211\212\316\214\021D\317\303\217-\252\274\333\017\221M\274"
+	.ascii	"M \233Zs|1\025\034\342m\225[\332\337\302\243A\347\027\307\216"
+	.ascii	"\253\200k\251\027\313\2306\204n\317\367\300\257<\352c\325\205"
+	.ascii	"\254m\231\214?\\\305\326\220g\304\366\221"
+	.string	"\203\203\003\210\016)h_\214\\\340u\020\273\232\003\365*\226@2\021:\275\350\312\327\343\256\013\\\346\r\365O|N,R\036\302\233\031\340\352\335\362\324\301\307\026\230\232\247Hd5\235\270\314\372\270B\306\316,\2532\333\306\234{\357\311\007\357?GwFf\230\234\301&:E\241\377FU\203T\006>\376,)\257\ba\352\261o\264\262\210,\203\242\356\2639\347\356\254Z\2701o\013\004\342A\337)lln\324\313/\372\t(%\022\3160\242\022\274I\245\335\224__g\363\001\355L\327@:f\232}'@\177\364\322\034\n\202\231x\303\226\214~]\265\253u\336\033\317\021\262\354\300\215\227\221\264G\306\322]bC\272V\342\366'.90\323\374?\374\227\3360,\341\227\316\231_\364\307]\322\025}\223\250l\246\006.Q7\002t\240\254\341\205\345\230\324\245\232\265\360\264v\342*y\255R\331\t\333\346Oo\356"
+	.ascii	"Nv\254\367'\351\327\027\\\003\262\223\023\235\251hY\372Wl\r?"
+	.ascii	"\330\367\306\212\373a\275!c\205\036)$j\316\f\243,V\2543\003\273"
+	.ascii	"D\017\226e\2379\033\232\342*\b\243{\373\366\322\"\320\2109\247"
+	.ascii	"G~f\373E\211)\007\025\312\313\005\367\353d\277?\210\016\255\345"
+	.ascii	"\375\256\323\331H"
+	.string	"~}\252\t\335g\251\016uh6"
+	.string	"\3370\370\215I\351=\363\367\301\bi\315A\357\242\264\007\205\327\273\303>\346N\257O\201\002=\302\315\373\301\034\367\006\357\roj\247S\210\220}\270\214\327\261\td\036\336\316\206\254\222\231\350c\2214\304\212b\233j\376^\306\003\357\277K\005fm|y#\364\f\315\220/\334(\240\376\007\033}tu\253\337\355K`\277\002\306|\235\270\365\341\340^h\2558\217t\352S"
+	.string	"|\033\370\277\006\321$\300/\301\362\374b\233\005\332\307\251\3601"
+	.ascii	"<\365\337\325\003,\257\336\316\351\325b\020\020\273\023\353\335"
+	.ascii	"Ak\235\003\354\274\203M\256\232'k\200\343\317`\303`\324|\f\260"
+	.ascii	"\302\377w\275\217\211m[\273\260\027\377\007\335$\274\217\264"
+	.ascii	"\323\271k[#\334_\264\302Z4\271D\230\201O\264\341\200\242c\277"
+	.ascii	"{\325-\244g\371?\236\337\367\002\363\357c\364\276\311\334\371"
+	.ascii	"n#\334\333}l\213~\036\207\225z9\261\337\024\302\035\025vs\262"
+	.ascii	"\357\354T\335\022\004\217\337\225|\237\017\275\272\314\202T\276"
+	.ascii	"t`\305/\026|\275\213\036\317\031\220\366\217\357\374\357\207"
+	.ascii	"Y\0166\274\306;/\245\264\377\024>\237\311>F\303?:\321\342U\020"
+	.ascii	"\033\235\214\324\275\314\311\263\321\374\007\201\031\007\201"
+	.ascii	"\027\020\260\212\234\033\337\216\217\243\221\357\256\357}\255"
+	.ascii	"e\332]\241\034\213k\2275X\263\337\242\036\t\212\352\325\356\344"
+	.ascii	"cO\237\007wS\236\256\221(y7\344g\002\314\226\017\233\355n\233"
+	.ascii	"\355\351\333\303v\253\310#l"
+	.string	"\275b\341\f\342\312\177X\366\262\303\353\022\363O\321\3024\004\274\204,\273*~[\021g\016T\273\363l\357\335\233#\234\0353\365 \243m\2151.6\332;\273]\3735C\343\255\247\275\270\373\337\336\241\243\027[\376\016|\256K\350d\203\333'\337\271lX\304yX\256\277\366\220\321\005\363\264\356\030\355\027\331\232b\340-\263\235\206\230&V\310\363\202\221\217\202\205f\226e\177,R\247\020\276\027kh)\301\314\216qq\317\354\344\030|}6\373\340\274\215\371\177\306T\364`L\235+\020\343\342\363\255\3740\332\026\353\316\342\255SqB\204-y\377\304<\344G\201X\206x\320\266\261c=\347\260\3677\305\346\366\216zG\267\017\336r\266\253,\036\340u\256\360k\353\027q\361!y\376\357\242\211&\226\275\305\244\273`%\233\326\233\243\341v\021\217Qq\226S\371\032;\230W2\025Lm\303\260\352\271+\003\031&\363"
+	.string	"\200\233X<\262\206E7f~\343h\3736\247\367\310\374(\277\337\232\210\351\023vor\350\257\266\265>\032\325\360O\"\323\"R\"\272I\006g\347X=q9\233\337`SE\337\2625\250\377\371\212\001\226*vW\276\373JJ\337\221q\003\031\263g\326\037\352\3564\236<\346\251\375\302\375R\341\223\003\243\3507\t\033\231\316\314C\341\225\257\266\246\036Kp\375`\332\367\"\3562\245\234\300\313"
+	.ascii	"\351\274\336\247\345\372\315i\372\217_[\376{C\177\3237\037\033"
+	.ascii	"\243%\177\260\243\3632\272?\231\032\223.\037\366\r\325\213\314"
+	.ascii	"\0270q\211\272\027d=\354\215T\376+\205\037\\\350\307\331\271"
+	.ascii	"\366\377\f?\274\361\352\347\026k\267\261?\3339F\200g\001?\343"
+	.ascii	"F\370\007"
+	.text
+	.section	.gnu.lto_.symtab.cecdcad914df8b5f,"e",@progbits
+	.string	"mspDescriptorAlloc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\t"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\t"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\t"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\t"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\b"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\b"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\b"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\b"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\b"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\b"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\b"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\b"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\b"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\b"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\b"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\b"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\b"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\b"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\b"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\b"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\b"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\b"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\b"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \b"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\b"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\b"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\b"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\b"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\b"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\b"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\b"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\b"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\b"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\b"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\b"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\b"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\b"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\b"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\b"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\b"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\b"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\b"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\b"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\b"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\b"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\b"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\b"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\b"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\b"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\b"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\b"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\b"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\b"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\b"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\b"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\b"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\b"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\b"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\b"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\t"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\t"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\t"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\t"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\t"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\t"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\t"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\t"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\t"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\b"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\b"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\t"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\t"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\t"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\t"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\t"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\t"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\t"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\t"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\t"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\t"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\t"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\t"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\t"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\t"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\t"
+	.string	""
+	.string	"getMcuTypeId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\t"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\t"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\t"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\t"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\t"
+	.string	""
+	.string	"getRxBindSupported"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\t"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\t"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\t"
+	.string	""
+	.string	"blackboxGetPRatio"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\t"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\t"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\t"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\t"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\t"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\t"
+	.string	""
+	.string	"motorConvertToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\t"
+	.string	""
+	.string	"motorIsMotorEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\t"
+	.string	""
+	.string	"motorIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\n"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\n"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\n"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\n"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\n"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\n"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\n"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\n"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\n"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\n"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\n"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\n"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\n"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\n"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\n"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\n"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\n"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\n"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\n"
+	.string	""
+	.string	"startRxBind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\n"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\n"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\n"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\n"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\n"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\n"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\n"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\n"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\n"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\n"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\n"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\n"
+	.string	""
+	.string	"rtcTimeMake"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\n"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\n"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\n"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\n"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\n"
+	.string	""
+	.string	"featureConfigReplace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\n"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\n"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\n"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\n"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\n"
+	.string	""
+	.string	"blackboxCalculateSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\n"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\n"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\n"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\n"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\n"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\n"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\n"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\n"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\n"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\n"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\n"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\n"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\n"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\n"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\n"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\n"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\n"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\n"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\n"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\n"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\n"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\n"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\n"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\n"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\n"
+	.string	""
+	.string	"sbufInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\013"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\013"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cecdcad914df8b5f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
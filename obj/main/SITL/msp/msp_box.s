@@ -0,0 +1,963 @@
+	.file	"msp_box.c"
+	.section	.gnu.lto_.profile.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\b"
+	.text
+	.section	.gnu.lto_.icf.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375 \273\205\004"
+	.string	"4\007\257"
+	.string	"\013"
+	.string	"\317\225\334\332\017"
+	.string	"\001\240\342\234\212\n\002\344\323\355\321\b\002\002"
+	.string	"\002"
+	.string	"\003\311\211\325]\004\326\272\336<\005\342\351\332\356\006\f\002\001\002"
+	.string	"\002\002\002\003\004\002"
+	.string	"\007\356\225\345\247\002\002\b\361\365\353\314\f\t\227\221\315\217\006\024\002\005\002\005\002\001\002\006\007\b\r\214\227\337\207\007\n\002\t\002\t\002\001\002\001\002\n\002\n\002\001\t\020\215\235\301\314\r"
+	.string	""
+	.string	"\013"
+	.ascii	"c\n\006{\271\216\246\026|\256kw\365\b\002\205\n\272\335\325\311"
+	.ascii	"\274d\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\r\004"
+	.string	"\022\005\r\022\260%\351\f\203K\303P\314\2435F\bk{\313\224\002\222\321\347\232\343\340\352\352\214\"\256\257\005\321\247\300\233\3641he\357\0236a\271\200\346m\263\304\001\001$ \300\202\251\231;\221"
+	.string	"\254\233]\r\211\326\345\017vh\206u\311\370\0326\205\224\322-\330\216\004\013\245\030\354\260\340\266\3157\001\023P\001"
+	.ascii	"\001I\306d0\023\257\366\302\003\002\350P\233CH\206\023\203\023"
+	.ascii	"c\001>\006\f\270\270C"
+	.text
+	.section	.gnu.lto_.inline.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`\002\004\345\020"
+	.string	"\006\330UA"
+	.string	"\223\223\306S\265}\255O\200\033\002\300uu\233F\214\022\251\fKHA!\032\272\231G7\255\255\223^\232}"
+	.string	"w\253\203\031"
+	.string	"\377\207\376_\372\377\277+\377\037\013M\350m\340\317\266M\273\355-e\nA"
+	.string	"D"
+	.string	"F"
+	.string	"\232.\006N\0240A K\244\245&\371M$I\317\322\222\354\234\013\024\304\204\n+\020\274!\251\r\024*\013!\251\f\n\225u\326\261l\313\275\216tw\367}\203\335=y\375T\320h\354n\365\234]\217\227.\226a) -\356qW\220z\220\231a\311u\327\025)\206\230\031\034\336\327W\250\255\300\314\210x\307c\250\301\234T\204x\273\235H\037\244|\270\360\206{\202\006\203\202\206\037\237\025\356\032\312\316W\033d"
+	.ascii	"\001\351Q\222\277*\241H\217\232$\350y\264\344M\004S\n%\300V\336"
+	.ascii	"2s\313iIu"
+	.string	"\274\200`J\025\022m\3011\342\2242 \307\272\361\331\214e\371\351FZ\007\0265*\007BJ\232rq\242\0310t\353\316\315\312\305\177>\226},\264\274g\320|l \321\"\216\264\03454/\002\216P\344]Hc2\270\274\270a\274\206\021\324L)\224\035:\214\3038\322\225\023\007\022:\303k(\322\030<j\260\270\257GN\244\325\357\321L\021Y\250q\301332C\222\372V\016\200\242RE4\017\022`\0041C\342\244\02383\301`\230<\313\266Y\fi\bM^Qh\242EC\020\3641\237\206\224.\350\317\320a\312\027[W\027\311W\215\366~p\330z \b\346\250\003^\\\260\330\274(\036\004\345(\304\215\264\262\264^\027\375\2024\212\372\006\334S\257\033\311'\322\n\304\022\t@\3473\300M@\370y{M\365\376\377\"\2667\256\324\337*RR\232c\220fi\211)\255\313\252\276\213\013\252)\244"
+	.ascii	"x\310y8D\025\031\311\250\177\346\306\363\220\013tJ\243\312y\314"
+	.ascii	"\213\357i\231\370?\236\347\rE\261l\336\316\341U\221\204\023\b"
+	.ascii	"e\253\276\022\344\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`Q\007\325\017"
+	.string	"6\023?8Pg\224t0\215\354,\036\033\205l`plP\274\201\311\314\f\f\254\323?3\223\212\241\374 \272\356\3167\3465\340Q\024j\003\374"
+	.string	"\372\242\337\372\205l\223H\032i2\355+"
+	.string	"/"
+	.string	"4"
+	.string	"\247\202\327L\255.\233X_\365\235\036\316\252&}\323\332\266m;Ss\332\240\367\240\3273T'\312\235\350\274*9\253\367\223J\330\020/\337\274\316P\204^U\303\372\302/\301|\373\017:\037(\260\201k\300\004\262\001|\305\375"
+	.ascii	"\013x\310)\022\"\242O<uN\006\357I\332\343\t1F\"Y\266X8\327hT"
+	.ascii	"\025\2140\376y\255e]\227\303\361xL&\024J"
+	.string	"\245\202\301lo\336\333\355\016\257\315d4\232\021\374h\t\227Ie\315\f5\341My\203_\035m\377\252\325\310\005+\334\227\371h\213\2451\306?\020H\214\020\236\340\366[\347(\nBI:\306\313\345\275ib00\214\303\221H\002\200\222\250\001\265D\"IA\n\n\225a\f\360\"\221\242Q\007\022@!+\004c1\342\210\200\020#4\002# \n\205y\352\264\006\034L\347A\300\323\233r5|\363\311\344\tB\357\231X\202\213k\345Qpo\235;\361\243\n\367\363F\317l\013\331\\-\334\274\315\200\204\360\3542x\006h\260\334\206%\225\024\f\003Ut\0218\305\347\025\241\346\251\205\0335\247*\350\301/\351\003\031\177!\021}\232<\256\346\273\372g\204\357\025s\333\340v\240\245\377\363\317\330No`?\350\306\233O\213\233\237U.\274L\352\310\277\3437\236\275\243\366\033\251\323\020\213\371+\\\323\347\\N\177C"
+	.string	""
+	.ascii	"\r\230\267\017\243(\220\017Z\320B\003^z\234\0269KO\356[}\325"
+	.ascii	">\200\371LX\331:\306\024\007bY\3365\227v\004\t(Q\262y\203\017"
+	.ascii	"\351\350\353\273\345\312\340Y\220\234\240\227JL\252\334\352\016"
+	.ascii	"\366"
+	.text
+	.section	.gnu.lto_.pureconst.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\002\200\004\004\200\004\005\231\004\007\231\004\b\270"
+	.ascii	"\004\t\271\004\r\230\004\020\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375 \312\275\003"
+	.string	"\002\207\024\034\220)\351p\344\356\356F\357\016\232m~U\373\272oA\002g\243\202\334\226\220X)S+\030\216\204\271q\217\007\363\027\244\273\273\357\023Q>U\347\241\323\320\271\312W\013jr \003\314\214\307U\031`\241\221T\263'\371]\265?\341\232\362\202\035}\376$\017"
+	.string	" q\234\255v6\3006;\020\364\0312\030\332\3240\250\316\345\232\330\"\332e_\220\t(x"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.6936269edf29ddae,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.49.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`_\n=0"
+	.string	"jX\220\023;0\352I\00703\205\023\300\221\006i\001\021\021a\023\006\264\370\367\024+5(z\356\336-\b5\333\"\262\335 6g\265\277!\266\217"
+	.ascii	"\374F\342\"\224\331\261\223l\373\311\277S\222\001(\001#\001*"
+	.ascii	"\001\n\034\351\267\333\017d\301\377Hs@\355\231\364\300\354x\301"
+	.ascii	"\237~\036\373\353\274>\251\346\200\330\316\244\353\311\216\275"
+	.ascii	"\362\350\317\261\237\216\301\343\200sB\376&;f\200\247}\324vR"
+	.ascii	"\250(\244\003*\321d\307\r\340h\367\264\375\223\203NH"
+	.string	"\007\f\223\035\243\227\264g\332\256\351\001&\244\027Rj\311\216-8\210\244}\322vJ\020$!\275\320\362\304\231\364)\331\361\205\007\201\332\033mw\024\201\021\n7\244Lq&=Iv\214\001\202!\355\210\266'jp\250\315\r-W\234I\267\313\2163D\b\244}\320vBU\202X\370\242\026g\322\347\262c\r\022\376h\367\333\376'\241\017\316\027-\343\262\343\257\tz\332\371\266\363\231\260\347\302\003\225/\316$\212\354xC\266\243\035\317\366<\371\216\233\007.\337\316$1;\006\243 G;\235\355x\024\346\3009#\245\334\231\034\313\216\303\334\213j\213\312\261\267\321\376f;\034\0325\020\314\325\345\030s\\\301\335\330\270r\362\210\311\032QssI\367\341\370\306\231\374\354X\314\275\250\034\337\267p\257U\205\370t\257D\372#\355\227\204!\265\215\001f\307V\200\372\031\355o\204\025\2306\346\227\035_\375\321\217h\177\""
+	.string	"\207\322\034o\251\227\035c=\036\375\204\366\003f\375 \244\327Y\232y\3311\200\277\323\017h\3772\300\377\271y\236\231\365g\364\373\331\377G\353\373\240p;f\227\3548"
+	.ascii	"\026\375z\373\367\004\354I\363=\313*\331\261\326\024\375w\366"
+	.ascii	"\343\031`'\315\365\224M\262c\001\357D?\235\375x\004\346\244\271"
+	.ascii	"\336\3224\222\035\017P\242\037\316\376\273\002o\332|Oi\366\310"
+	.ascii	"\216\t\024\321\277f?\033*5m\276\267,\225\035\027x \372\315\354"
+	.ascii	"?c\340\313\2649\237\3627e\307\006\276N\177\230\375b\266\036\214"
+	.ascii	"\013\347[\376\241\354x\353\351\364s\331\337\205k\313\352}$\316"
+	.ascii	"\344\367\311\216\271\022\351\277\262\037\313\001+6\274o\311&"
+	.ascii	";>@J\277\224\375S\020D!\272\237\022\301'\375M\366;\351bBt\277"
+	.ascii	"e\227&\375I\366+I\200\204\350\177\312\342\231|\035\331q\002J"
+	.ascii	"\372\211\354/\242`\210\r\377[\372\244\3548qr_\032\272\356[\f"
+	.ascii	"\026q_2\336\336\342\276\260\256\312\252\035\215i\020-\262H3\264"
+	.ascii	"D\221\214D0\035\222q]\277\3638^\307\363\\\217\357\361>\356\307"
+	.ascii	"\001\371\322\001\275\220+\362E\376\310!y%\267\344\233\234\223"
+	.ascii	"\203\362P^\352\347^\307\357\370\036\357\343\203\274\2207\362"
+	.ascii	"G^\371K\376\311Cy*_\345\263\274\226\367\362_~\314\223y4\237\346"
+	.ascii	"\333\274\233\217\363r\276\316\347}\236\327\363|\317\347\373\336"
+	.ascii	"\357\003\275\240/\364\206^\321/zG\377\350'uxL\237\351;\275\247"
+	.ascii	"\027\365\243L\034f\016s\207\2314}\230?L!\034L#b7\3560\037s\210"
+	.ascii	"6\213ls\b\221\264\203\022Kv|\335\313N\233A\266i\007\004\331a"
+	.ascii	"*Jv\354o\362\320f\217m\362\250S=(\247\336\374P\332\324\261\237"
+	.ascii	"\3225\351\340>(\247\352\262\343)I\372Kms\316$\225~X\006\317\344"
+	.ascii	"\024]v\214}\213\215~P\373CM}j\003\361);\246rB\3727\355\347d\245"
+	.ascii	"I\005\261\264\224\267(\351\267\264\377\322U%5\204\331\2314\033"
+	.ascii	"e\017\227\310\246S\227\352\242\025M\254l\361\354\274\310\343"
+	.ascii	"\272\226\262f\350zDK\263\256YJ\234\272\252\312\226Y\335\021\302"
+	.ascii	"T\230\252g\347%K\217-1\r\236W\215=;\266-\253V]\266\342P\250\016"
+	.ascii	"\253.\331:L\203T\227\255E\205mQ\353\"\331\243JT\207\352\361\352"
+	.ascii	"\202\205\211\025\327X\265\255\272VW-K\333\341\232\226Y\261kj"
+	.ascii	"u\205b\350Y\360\270\262\265\350W\211\225\210\252C3\264\024]3"
+	.ascii	"\226\005\270\025\3446\210\211\240\200\252m\312\252`abh\312\252"
+	.ascii	"\30448\340\236\265)\033DY\365X\226\242\353\260\214\353\022\331"
+	.ascii	"Te\215U\367\210\246V\f\242\352q\035\016\325c\332\242FU%\353\272"
+	.ascii	"\252\260HD\217\2531\353\202\205\211q`\325V\215\352\026W\241Z"
+	.ascii	"\212\nW\343\325UM \207)\233\032\255\256\252\026lU\026m\215fX"
+	.ascii	"\227U\321\326\224=\242E6\230f\2258\256\241\352\220,mW\241\201"
+	.ascii	";,\262G\264b\020=\013\242\251\245C\255\253\nW\226U\327\212\250"
+	.ascii	"\261%f\335\025\032f\274\251H\021C\316\355\013\206\2136\267\257"
+	.ascii	"\025\001\200\310\250!@b\fVVQP\224$I\2061P\203H\323\346\020 \344"
+	.ascii	"\234\334j3j\266\376r\234R\321\301\033\b@u\315\2347\240.\275O"
+	.ascii	"7\263~\203\265v\022^jK\023\254d\236\220YS\323\267\334\336}\024"
+	.ascii	"J\003j\240\206\312\235\257D\215\362\260)^\t\\\305Z\376\276\344"
+	.ascii	"\003+\022\313fy\021\f\322J\367\024\261\322G\245\220\333_\227"
+	.ascii	"Xf\312\327\254U\\Q\261\357\231Qd\303\037\225R1\333\254/GAg\353"
+	.ascii	"\205&/\220wl\\\2019\213$\315\310Xj\231\035\226l&}\330\005B\346"
+	.ascii	"O\217gU8\244\310i8T*o\310ty\2137lJ\241(\213$1cy\263\r\261\005"
+	.ascii	"\233|\242\247\325\001\354\r\241/\210\263.\030%\2344\240\005\313"
+	.ascii	"\324t\232\215\3625\031\211\246\277y\263G\034N\257]\023\347s\207"
+	.ascii	"\225\230n\363\327\203'o9\220t\276E\226to\215\346Ok0O\362w\333"
+	.ascii	"(\226\231\334Y\247\026\327\252\231\177\365\207\264\257\374\320"
+	.ascii	"\346Cm\374\363\bN\252\370\205\"7L"
+	.text
+	.section	.gnu.lto_findBoxByBoxId.51.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`0\002U\023"
+	.string	"\006\245\201I\320\362&\035\223\210y(e\006\340\f\236P'A\177\215\177\374\320\t\264f\330\221-C\230\2531\003\370\274\313Q\352\337\367\226\375!x4'\016\272k\362"
+	.string	"\237b\312"
+	.string	"\221\3309\230\323*\365\323('j!!\204\354-wJ\001m"
+	.string	"e"
+	.string	"n"
+	.string	"O!c\326"
+	.string	"\261\347\246\033\225j\206\236j\025U\026/\200;\365\036\200;]\021V\360)\336\234d\275\343\350\\\311\362[\357\346i\267&\220\260fV\b\262\311y\315%9\0238\247\027v\216`a\316\347\234\240b6\002$\3540W\310\026\343\266\313X\370\222\373\332e\322\315u\243(\304\271\354Fj\255\226\260\360\346\366n;\264-\301\226\030\002\336\305\277;\321M-=?\336;\245\345J\037"
+	.string	"\005\361i\207\201[\255\037\242~T\033\024F\211\023\375\343\245}\373C\276\315)\237\210\365Jc\363\305\306\032\016\274\013\3715\247\306\020\257e\343\0251\321\320Q\253\270\340\324\"\336\351m\031;e[J\373\264\003\311\\\344\340\257\326\020FH\265\212\r\034\342\235\036\230\377\t\263\037\250\245\373m\314\005D\240\331\\\231\273\225\273\032\233^\322\207\277r_\003e\rOZ\241KN\263Z_\020\220\300T\353\366\364\342G,\356\364K\227\234|hw\301Bp\230\355\230\267"
+	.string	"\031\364\324\372\212\300\342E\033\346I\234\332\005\206;\354\324\207\341N\351\336\366\251\244\023\005\303\231\221Q\353\344\241\345\263+\263\305\226Lp\202V\275<\366\027)/%(*(,%'\237\312Q,\304\200&\324'\"1\240I\206\026\227\025\025\213J\311\212\352d\345\242\022!`\260%e\245z\001\301\225*\345\372\345\361\203N\302\224\303v\304\335\350\267\375\233\375@\315o\347\\\217\314\254\253[\231\037\314\240\336R\024\322\261\363\030q\274\244\217\317Zk\345V\366\020n\327\333\327N\002B\247\007\315\216KF\311\225\261B\250EW\346\007( 0\002\203\234\274m\\\341\035\342>\277\221\256m%\242o\325\230Bb\301\307\317\032\267,c8\214\271\250MZ\241a\371\303\334\0021\202\240/>\"\266Z\253\021\260F!\242\273\223\354\002{{"
+	.ascii	"\224\351N\315\213\255\276\201\231\020p\234lK&\353\251\2731\021"
+	.ascii	"\230\227\225\006GDY\203s\2576<\001"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.52.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`%\002E\023"
+	.string	"\246$\201I\320\322(\035\214`\232\273?\307\\R\333\fyA\243\326\315F\340\232\213\200\257\f;\025\271\212v\277\251QCt\375\321\177\003\324Qi\365\006\256.w\344\013\256*\353\233+@\367\220\210q\331\016\265\005\304\230i\204\220\275\345N)m"
+	.string	"e"
+	.string	"o"
+	.string	"(\\~\t\030qf@]\216\030\236^\255\343\311\343\003|\247\341\001|\247\013\302\t>\307\373\223\257\203\037\235+_>\354\340<NG\021\210\0303'\350\310\324|\027\223\037\t\232S\n66fb\315\347\224\220\342\026\002D\3440w\207\027\343\274K\232(\223\373\335e\320Q\354\206\217Hs\t\226\324Z-g\342\314\035\336\266h\233\304\226'\001\377\336sOK\357u\267\234\322/\221\b\365x\024H\252\325C\322Q\025\2420F\274\347\327]\332\267\317\343\363l\362{^\25702%\232\356\307H\370\321\337\331tj\235\357\270\256\013\ta2\241\017QoG\255\243\202S?\bO\r\314\333.\333d{\245\355"
+	.ascii	"\202\353\270\r\336Zk4\200j\035\0318$<\375\211\0072T\354\300\350"
+	.ascii	"\332\374[\256\266s\303\245\231\300\230\273\315\265\371\333oK"
+	.ascii	"W$\223F\266/<HE\207\220n\265\312F\200X&\330Q\357\305\177^K\207"
+	.ascii	"\220rpo\361:\360\231m\rg\301Z\200S\253,\302\212\373`\230\027"
+	.ascii	"qj\026\227\357\263S\337e\317\373\254a\3633\243y\221I\353\243"
+	.ascii	"\003,g\327f\2170\211\240\004\256zo\354\020<\356\001\251\026T"
+	.ascii	"\212J\312\n\205RRy\312I\313*\265B\251Z\251\025\223QD2\260,TX"
+	.ascii	"aQ\235V*(\325\t\245\305r\022\031`\326J\252uja\261Z'\223\353\367"
+	.ascii	"\306\317\335\204\b\211\367\363\335\305\317{\351\226\253\315p"
+	.ascii	"wi\353\222\227\215\201ks\203\031\024\\jB\232\366\036:\0342i\364"
+	.ascii	"Yk\255\337\037\362\311\005\367\273\233|\260\341\301\324b2In("
+	.ascii	" 0\002\203\244\273m\\\341\035\3426\353\034\370\332Bc\353\255"
+	.ascii	"\216\007\324,\210\360C\224\337c\270\215\215\272\215\264\306`"
+	.ascii	"\002\236p\301\240\210P\224\342#\"\253,\354nb\037\244%\344\366"
+	.ascii	";\331n\333\026\372*\336\221\260\031h\to\320\004\233\310#\273"
+	.ascii	"\3604o\254\005\346j%\254#\246\254\341\334\253}O"
+	.text
+	.section	.gnu.lto_serializeBoxNameFn.54.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`\220\004\005\031"
+	.string	"\026\351\231L\200\222V:\324\024U\245V5Op\350\r\334E\265|E\2437~\317\345\325\227\376>"
+	.string	"g\036\021^\306u_1L(\237b^T\347\341\345\333l\217Q\231\335\3563,\224e\331j\276\n\261\357)5]\373\320\272n\226\220\275w\222\001\206"
+	.string	"x"
+	.string	"\205"
+	.string	"9\373\256\211\023O\322\033\341\355t9\334mU\361\265\304\376\251\276\342\0245\"yN\242\322s\032I&Y\036Fa*\333>vL\342\024\033R\240C\035K\330]\223\016\351P\307#\233C\202:\032Y\234\252Lq\003\262\353\307\216$vH\017V]\233I<\226\204\224\307\230e\307\f AO\306\035\262h/fI\202\021\365\220?\370Dl\251v\252[\020H\037ko\016r\316m\215H\241w\311\273o\322\335\276n\374 9\027\023\364\2536\fq'v\326\253\277\327\305\226\224\263\307N\273\237>\3666\273\177\247\323\351\264/\263\373\316_\367\347\237Sm\257\330\266\212mcl\373b\333\366\332\276\211\316\207\230\201h\316AS\"Y\252r\241\350\356\357\272\333>w\322\016\334v\177\352,\210wv\270I\316\314,\0319?[\272"
+	.ascii	"\356j?\177\262^\305=\300z\265\211\335l\1772\345_\031\001]\005"
+	.ascii	"\311\001\300\222\367\332\332\002&\207(r\273M\030\277\327:\275"
+	.ascii	"~\017c\272\360.\340\261\314\270j\356}X\323\021\264\350\270\252"
+	.string	"\240\020\r\271P([\221\n\300\366c`x\371\026Pw\273cd\354\215\315\323Z!\375\271<\013\244\220g\370\267\332k\227\252\320\212V\b\202k\375\376e\226sV\320M\363,\340\255\230\260\376\242\2465\004\355\215\301\365\252\275\377:\343\372\2231)\275\267\231\362\233\365w\246\352\254h\205t\267\360V7\270:\302\231\2333\314p\373\347\242#\234\211\261\031\006}\034jd\202\276\037\316\320\347\"\240\205648\276\034\241\020\307\267{\366\034\347\313l\b?\244=\327\247\007X\006\357\2575\202\004\253\325\003\347\2343\311za\224z\302uPXoN(\332\326\204\226\246\324[K\273\332K\264\201\n\345\210\021\325\254\302s\224\251QCDf<\002N\266li\214\332\221\211},\245\253e\351E\246\3037,<\f\f\1778\332\232\312\255\210X\016Aq\030\341j<z\032\001f\250aT\305\bV\"A\224\024$I\n\035"
+	.ascii	"\003\221\241\242\003\0208\251f6\0059\007\237d\\\273\225\254)"
+	.ascii	"&\315\001\331*\353\252\236,E\n\254\b<I\002?\224\240\242\003,"
+	.ascii	"K \244\207o\302pI\024\275\216\277\372$1=|\023\206K\242\350\230"
+	.ascii	"\331F\371\212O\367\331\314F6\253\303\202\335\372w\355\343T\366"
+	.ascii	"\210v\205\177\241~\270\373\201}D\rs\210jP\366S\246\304\216\""
+	.ascii	"\264IR\274\242Gv\031\352:HX\242\206\221,\231\t\224\020\001\254"
+	.ascii	"?\244\377\273\027\323\256\326\267\247{\366\007\334{\325\360n"
+	.ascii	"J!\355:\363\316\260\267v\261\314\265z\362$a\365\243\006"
+	.text
+	.section	.gnu.lto_serializeBoxPermanentIdFn.55.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"=\t"
+	.string	"\326\221?8@\305(\035\255.l\261\335+\026\t3\317\263\254\321\017}\303\245\263\031\340.u\315\202\316z\314\250>1\034w\3048\2423\3033\267-)$n%\346\332Fk7\2212\245,"
+	.string	"0"
+	.string	"0"
+	.string	"\227?\355\003\227?w\366\312\243\307\336\305:\271Zv\027j\307\273g\347\177\344\001\250T\351\211a\330]'*\245\272\365\266\017lC\373\231\177\226\245S\323\307d`*\t,\273\033\261"
+	.string	"\373z' \266\257\261\235\221\004@\341i\237u\221\356\255\213\013\354\256PLv\343\306\b\332\237\343\t\002(\033hh\311\327\324\315\tf\212\227p\332n\306\202ObQ\241}\220.\177W\214*%\244e\312\230\035K\251\034\366\263\335]\353\312~\353\177\217\001\243\255\243\"\016B\355\341\214\266\216\003\210\373\300\t\211\207\017\364\2048\310)\360\006\212\bA\321\266\205\240&\356\263\325\225\033b/\223b8\223\251O\355\317\226\017\017"
+	.ascii	"\357b\310\304#p4\341\202`z\240i&\344\301\006s\215m\205\361@5"
+	.ascii	"p\005\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeBoxReply.56.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`\353\005\005&"
+	.string	":E\034\017I\200\232U:\2372\370MJ\374\177\377':\237\235\273\240gs\3502\256\022\314\336q\330PU\177\203\240\377G\354-Y{\273\356e\273{\257\350\233\337n\371\327\260\016j\344B\310 ]\002\353\251\013<\"\323\2024B\310\336I\006\333"
+	.string	"\321"
+	.string	"\340"
+	.string	".\302\"\334\346\241\004\377\324\320\226\345\234\204U\225s~\320@\354U[\372\333}\247?\t\236\t\343<9+EU\345\334|\3207\366j7/`\275\312\276g\275\032\354V\363\346R\276\224)\243\024\260\2343\016\013i\360\264\371\216u\213\203\247\2653\031\033[\325Z\212o\260?u\005G\236FI\341i>\240\303\333\006Q\366\370,v!I\311\343\262\004I\312\035g\3233\275\312\234\013\251#\265"
+	.string	"\005\231\343X\277\307\244\214\033S\222\343kJ\341I\323\020"
+	.ascii	"\311b\212\237\236V\217>\001\023R\307U\331\034\257\245\020\270"
+	.ascii	"\340xr.\344\216\224\007\310\031\347\231\220?n\232"
+	.string	"\332\270\220<R[\316\271M\022/>\364\352\362jM\222\262\307o\354B\316\271\257QR\371\006\360\356\247\335\315\353V[\004\263\333\005d\267\t<\353=\340Wo\001>=g\376<\217\362\007`o\357\034\352]{\324\233\366\247\277\275\226wl\275\324[eo\247\354m\314\336\276\367\366\017\264U[@]9\337\b\233\223\277\250X\220\374\352\317\372\265\374P\177\324/\365\265\373\375.\327\352n{\305\2674\202\2430HN+\272\333,\317\352G\273\305\022\254\372U\037\353T\301*\267\352\036\372\226\276i\256\250\364\241\335j\001~0\322t\002\323U\365\261t\333C\277\302\342\271\210\224\035\235^\276D\274J\237\252\333\241[\271\331\210\315\234\004\361\343\313\t,\304Pw{\365\376\371)\237\352V\252J\207\250\233\215\030 \023\227V\222h\350\206\272\261B$\373\224B\365\225s\323\301\325\266\320\215\243\004\313.\200c\370\347,C"
+	.string	"\027\3007\326i\021G3B\335j\323\2243Q\302\031\022\255\320\013\254\314\315\334\212\305z\225"
+	.string	"V\267\3324a\026Y\275\213\305\202\033}\370\030\022@K9\023'\204\271\230\022\351\213\\\355\234n\275\221n\275:"
+	.ascii	"?\372\005[^\316.\251\243\242\033\206\333\320\0206\251x\331?\003"
+	.ascii	"&\314\\\303J\\O\361\2230\2768\305i\032\243\216\032^1\306*\035"
+	.ascii	"c\023\r\257\370\342 #VF\346\360\206]YT\342$\365\255;\370\320"
+	.ascii	"_\037G]N3\304\033\247"
+	.string	"k7\206\373Z'z\367F;\370Z\277@\304\302\253T\203\313\rn\333o+\r\3270\220\234\"\3221\r\337\215\261N\321\rk\333\033\272\266\3708F\2217E\246\341\r\353n\016/^v\177\225\003\266\244\261R\267z\333\300O\273\336\345\t\345v\275\235\212\234N\326;\321n\003\221\317\304*\364\313\ty\220\355Td\210\021\3710\360^\364P\344z?\036\220\306;\221\013J\205\200;\334:\bD>\023%\202\200)p*z\271\0248\335\017\210\203\360\323\276 \336\017'\344\363\375pm\263\350X\251\247\256|)\302C\032^v\315\314\314\007\333\270}\354t\246\342O\235\005\303\322\272\367\372Z\341\b\314\211\314\210.\265xY$\252%\353\301\235\342\025\253\370\b\\c\330\007\237\213\221\347\235\245\371\212{\0260\251qvA!\311\360R\003\2303O\252\330\311\374\321spz1R\251\003\260\001|\354\366\271\0060\017\356"
+	.string	"\270\017\275l)\232\004\316\227\f,d\361\262#d\255?XuR\353\343\331\2449\347\034\303\313\337V\001\370\007\037\353\032x\374xSD\032^E=\345\025\007s\250q8\205\bR\314\b\005B#B\n\323\214\001`\002\221rfu\020H\311\206\222t\023\236eH?\\\216\354\326L\301\263\003\260\225<\204\001\005\377\220\032\346\354\210t\0252"
+	.string	"\342\256\005q!\272\307\215\362\304\227\352fV\344t\250\324\204\210vV\003\032\035 ?\024\333\354o\226]\256\305\004\023\203\221H\036\f\373\032M|\270\241>=\277<\031\203\314\355\305\320\325A\2544w%C\002:A\246\320[\340\031\"\300\356\237\222\220\371+eI\t\231ZP\016\204\212>\257`L\373\352L\026\232\250q?a\316\353\b\272\276j\302tnT@\205N\345q\244\221?"
+	.string	"\221\337C\017V\b\301\364I\016\030\025f"
+	.string	"@|\026\215\311\330"
+	.string	"$\241\211\320\315U\230\244P\023\376iiZ\325q\274"
+	.ascii	"\240\226\215\025)\357S4N\005\353\033_\222A%\317\341-\2747\004"
+	.ascii	"M\002S\001"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.57.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`\257\025\305Z"
+	.string	"\352\222\240 M0\320Z\031\016\245\236yN{\274\003\002\t\245Y\2271^\243\263\017Y\374\225\245\037I\265\300\325\021'\020\355\211\006\333\"\bKq\3511|\311\ts\034G\303\241R(D\3542@$\215\333K\344c]\254UH>#\220\344\357\275\245L2\007\002\307\001\371\001(\323\331\217\373\334\026/w\027\324/G`:.\3272\n\330\336$\021X\276(=:\374Pz\364\204\n\365p$0y-\327\036'\334\226pu\326u\031ut\235\206G\325\335\031\276\\[\177\305O\354J\235u]\251ZI\025\024\324\210Mq\236\347\323\366\317\345w\230\252W\221\002\305\t\023UTS+JHEA=9\221\b\240i\204\210\020,@0}\360\260\324\001"
+	.string	"\245$\244#\243\"\242!\016BA@?>\306\"\261g\310\223\242g\263\272\377\221\246\316\r\0272\257\253\220a\215\032N\001x\024\177?q\246"
+	.string	"$\033R4\233\241\315\327\370\261\211\276\346\032\256zs*6|}<\365\346+\316\2514>\342\336L\376\235BH\376\352.%9\003\227Xs\264I\2238G\312"
+	.string	"/\225\346Qi\3200\324il&\363N\024w[\370\351\314\235\300\374\305\022\3028G\312\314\234\204\224\344\335r"
+	.string	"\347\220\020/m.\325\246m\310\301\330q\323y98}o&\277\234-\346\222A\016\003\027\036\221\244\314\313E\234\005\304\271-y3\331\345l\272,eN\346\013\207\370\227\227\2638\233T\320\202<\230\203h&\315\234Jl\250\b^J\022\016\203\340A\340\356PvK\270\301#eg\316\244\345\037\264\270\300\036\344\276$\027\307\035\340\016"
+	.string	"\234\025V\252\362\244*o\214\344\366#7(l\304\366\"6\242f\322\311\207N\024au\316\336L69\215\204b|O\230\003\223\0131Y\302Ak\007ZK\343\037\264\373\240\025a#\210#eg/Ji&\2110\361\315\344\031\b)\311!\334s\0065\223B\316\252u]\303x\370$e)\234'\310\323\263H\017\t\340\017\231\330\t\205\226\306\307\261\234\221d;\030\345\024~\372x\237P\201aj(\222\035\317\242\036lc\237;\243@\006\306\314\203\300\272\256\313cde_\001\276{n\355\356\215]!/\001\315\265\253\300\3530@\300\331\032\032\334\272\036W\\\313n\b\247\323"
+	.string	"\177@r\007\306\006\267\256\253"
+	.ascii	"\202\257\301\201\275\223\243\373\002\006\177,\202^\352\223C\352"
+	.ascii	"\356\001\334\312\210\335\360\305\205\304\2679^\320V.\363\375"
+	.ascii	"~,\177\300\r\017\277\247\215d~\340S%&\210\335\365\003\317\215"
+	.ascii	"\334\237CL\264\004\204\264\201\031v\263\0371t+w\227\204\364}"
+	.ascii	"U\347wd\302=b\236 \335\255\340\002\376\330\333\0079\310<v\240"
+	.ascii	"3\304{\247\364\b\203\030>HAfX{m\020\017\277h\322\250\237\356"
+	.ascii	"sV?kc\273XZ\374\261%R\303\034\f\334\321^\273K0n\345\356;\316"
+	.ascii	"\216\220m\265]\224w\313\206\221\267\006\221\227\306\367\276Z"
+	.ascii	"Y\327\373b]\025y5(\362\316\220\3611\337\030\031\020ya\\\314\267"
+	.ascii	"\005\312k\300\325|\225n\367MB:2:o\321y\211\210\274CD^!\"o\320"
+	.ascii	"y\201\316\373s^\237\363\032\213D^\342y{\316;</\317\257|\323\363"
+	.ascii	"\242=\274\347\220\267\017\367\345\363~\203\022|hg\312\277v\263"
+	.ascii	"\\{\024\332Y\231(\036\224\353\375{\277\230\177\314\257\346\267"
+	.ascii	"\373\257\374p\377\362=\273\337\247\371\336\236\017\r\233\274"
+	.ascii	"\353\355\233gT3gn\327\331,\032Ff\215\232\017(\3103#\3010o\217"
+	.ascii	"\246\213M\240\231\375\231\256\"\201]\273E\273\217\331\223\331"
+	.ascii	"\342\027\265\313\305\354a\340\242~\313\361t<\314\366\034\005"
+	.ascii	"\301\354\335\216)\300n\t\027\325e\377E\307\275\200\360uG\262"
+	.ascii	"\007Y7\030\350b"
+	.string	"\370-{.:\322\226\253cEx\226m1W\334\326u-\356\236n\217e\213G\353\376\202\372+Nd\026\270iY`\3702\272E\037\206\273\030\222\226e\007\032\330\225\030\332\270\211h\345\302h\241\346:\336\252E\030\216\332\206\352\335q\233AM+z\331\251\003\3102\250F\316\343\201\220\036\205\321\250\336\235\267\343\261\037\bM\037;\336n\tt\334\247\246I\271\3417\252\221\023\211\252L\225\351\321\030}2o\322\263S\347\206\013\220\335\"\0033N\210\243}q\203,Zm_x\265-\025Z\b\230Om+\261\266\256G\001vU%\274\247.\361\360\006]\326\343\246\332\344\211\n\005JzT\250\177\367(\2659\203x_\\\b\342\003\025\245 I?\230HffL\034\006\205\350\004\225\tn\236\021\300\017\255\\6\362 .[\202\032\345K3(\367\305\205\036\200\312\316,\001\r\201\332\210W\346\247,\f3\254\203\217\025"
+	.ascii	"~\316\2376\342\2751\225\210emI>>\255e\266\016\006\036\221\212"
+	.ascii	"z\330pdd2\266\361n\220y4\022|R\303\034\262q'9\030X\214b\204."
+	.ascii	"\001\365 \302H\300\200\024!\375\264p\277f\030\321O\313\361^\036"
+	.ascii	"\333P+wx\265-%\366U]\337\221\t\2430\232\3326\\>\343\"\352\024"
+	.ascii	"\225\212\372\306\037S\337\322\243\304\3566B\2068\355\361\203"
+	.ascii	"\031\306a\351N\351\035\241\236\276\352i\243]\234 ;e\200\206\303"
+	.ascii	"a\033\355\306\374\364\304\235V\370N\351\333\tO\305\207'\004\363"
+	.ascii	"\325\270tWu!\001\376\030O\033\355\2460\217\355\265\306!\niUZ"
+	.ascii	"\340\212\255\\\2649\311W\024%\242\302\261\275Nl\345\3569<\352"
+	.ascii	"b#\003_\354\317]hnoN\316^\317\023\023\236\254\3363m\244F.\217"
+	.ascii	"Q\357yr\0375\262\2003%\377}\350\004\3060l\345\036\313\211,\304"
+	.ascii	"\221K\177\022\322=\321\2436j\344\356\357\224\"uV\337\207\333"
+	.ascii	"\335\01640.d\236V\246r\276\320\244\255\266<o\316@z\006kc*k\313"
+	.ascii	"\003\252\0346jl"
+	.string	"q@\003)\313\201\020p\\\241Z9\254\262\266\262nXa\365l\335\352\206Vgiqpeu\203\201\256\033[V\rp\341\310a\305\245\305\201\026\026\226\325\321bM\205\200\343j\206\007]\035P\335\330\262\352\200\n\213\253\213j*iqx\240\305E\225\003\007\016.\252\342\362\353\255\266\026\310a~5\330\216p\256\353\221\003\276\374\003\351\270p\277\374v\262\311F\330;Y\225\314\212\255\322\243L\2360\321\342R\370\342B\025\255\\ B\024\0314\312Dj\221\314\366\343\205'bR\264r?H\225:\203\006\022\034S\347\006\013\212\016o\314\276\346C\301)\314\301\300\260\366J\341\354\265\235`\336\305\336_\226\273*\276\277\250c#v7\245\325[[B~\177F\344\354\365\231\240\262\321h\225\025\367;V\340\261\316u]\327*\254\266\321o\336\305\220\"t\332\214\026\272\225\252F+\321\350\032}\261\033V%\322<\346\230"
+	.ascii	"\247\305\2304\032\325\233\303\3540\346n\tn}l0\255>\337\233\364"
+	.ascii	"\340\364\034\036^oS$\250\310\255+Z\255H\005+\365\331|\316j\250"
+	.ascii	"\006Q\205\360\307\212\372k~\024\310\234)\333\021\245J\t\022@"
+	.ascii	"\342\230aRMwJ\201\264E\021\201\235\250?\367\237@&\nT+\227'\317"
+	.ascii	"\351\252\333\217)\352I\347wL\232\324\227\023\232\002x\303\223"
+	.ascii	"\324\223\372\352$\264\313\3424\243\037\346sV$\226\314\344\f\327"
+	.ascii	"\326\344\272\256OCyL/\276\343d\b\034\211V\356V\252AO\222:5@\205"
+	.string	"\205\205\314o\2453Z\203N\321\300zF/\023a\032"
+	.string	"\325\243\2326\\\327u\210\255(Y\001-N\356\344\361\307\026"
+	.ascii	"\336]\354\335\311r7\202\377~2\177Q7(v\027\"F\033\320\310\277"
+	.ascii	"\033\320\007s\016tU\364\344\3545\265rM\344\211h\321h\025\026"
+	.ascii	"\367\273\214F:\2452\3724\324\371m\227;\265(#ZI\370\201\252\250"
+	.ascii	"q@\005\025BD\"\"\"I\222d8\241\005\204\030\007\331\0317\021\340"
+	.ascii	"(c\220!\222\221\244 I:\2660\250?I\241\265\304\301\207\231}P\250"
+	.ascii	"\354\030)\206\204H\246\275\264\027\215\201b\240:\0349L\177\240"
+	.ascii	"\222S\343\216\013s\2411\232qM\314g\370\316#J\022\321\244\310"
+	.ascii	"\344\016\314\214\344}\347"
+	.string	"\245\231\307\327\240B^\262!+\002\355\265\240\232\232\242Q+A\312\247\233#\007\331a\333v4\334'\221x\301W\373\251o;\353\375\357/[\361gL\241V\021\352F\262\3229\367)\027\252\307.\276\205\022\307\322rde\226\315\344\2254\222\241\026\205l\320P7&\374\222\013\206\374\341\370Gaih\256``\235,<\322/,\"\021\205\277\004\354\213@,\017\001&\242}j\352\314O\fD\230\"\315~\371\244\350\222\331\3567\355\201\244E\205(&\3119\026JI\b\276\327\340@\253C\020\273\302m\366\203U\t\031K\b\307\357\365\223\315\302\026\frx'\372\265\351W\274U\240W\213\226\366\214\344\265\311j$S\324!T\rf_\037\212'\224*\204\234\020\350\255\224\226\255\267\301\357\333\275\270\366z\250q<\021\002\"a(\025\200\311\253\204\264x5\223\310\254\f5N\237'\026C\275\224*C\215\343iB\322"
+	.ascii	"\243\257\213\222W\261\312\bY\004\373C\364Z\371\240<\004\301\035"
+	.ascii	"Q\370\336'N\371p\231\220\037`\3131%gv\354\247\373\242\214\254"
+	.ascii	"\0249\026\245=)p:\247.\3249Y\332\2020\245\252\3048\314\345b\202"
+	.ascii	"\025o\003\273\262\376\342z\221\332\276f\265r\037\312\353\223"
+	.ascii	"US\236L\214*\351\211\350\261q\316\206\316\235A\255\f\255\363"
+	.ascii	"\372\245=[gqe\264Y\316nP\r\216\236)\232\003q\306\357\3038\260"
+	.ascii	"u\211[\022R+#c!\300W\351}\260\224\225\3507J9g\f\202\016B\216"
+	.ascii	"\232\001(D\211J\364\324\302D\177\216!\335\375"
+	.string	"\330\236\334S\207\356\224\\\260G@\325\364\026T\246\365\243\032\016\0204Q\001\226\300\251\320\022\"\314[f\374e\312\312\325\252!\236-\037&cG\006(\247G\356\354\244\2360\3735@\342\277'\344\374\203\256\365\032{f\032|\215{\263\n\034C\t\377\307\206\006\236\245\330\360\001\217(\337\232@9\324\345W\f9+,^\3677B\275\302X\346*)2\334ra\304\2669\320\254\334\365\220s\313\246\240N\267W\344p\322m\216\001\376hb\220\232k\371\322\300\211z\354UV\036\202a\023\200\331\211\001\256\232\225\257\260\201\222\032\236|\224\3519f\340\246|^Pn\222\201\265\214\210\022\256\3645c\303m\2441\270\022\016\217\304\214\305\204\243n<\201\001+\266\342\305cL\035`}N\371\324,Q\257H\022\270lZJRW[\202X\2544\301FWF\311\330*\261\300\032\206\262m\320\345$\2609\177\024\232\245_\007"
+	.ascii	"D\rL0f\003P=\320\224\270\f_vsj\345\233\247+\200\302m\n\322\331"
+	.ascii	"\207S\234E\r"
+	.text
+	.section	.gnu.lto_getBoxIdState.58.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`;\002]\024"
+	.string	"\226g\214J\300RN:\302\300`G\024\354%\323\037\205\024\354\022V\353\252g\201T\013\201\306\326Z\006\215\376\231\236\200\020\332\366G\227'9$F-\347\263\221mv!\256\340\222\301\202\213\225\320\003\364\020\331\2454C\270}#d\357-\245L\001z"
+	.string	"l"
+	.string	"z"
+	.string	"\273\264.j\313\264\363W\255EJ3j\365-x\002q\247\201-\241;\345\216\320\235\377\317\240A\355<\353;\001\264(\226r/|\324\352\233\265\211\345\331\220N\331\314\363\355\331\260\302\224\023\335 \251\036S\226"
+	.ascii	"\361t\261\235\2174\321\202\342\001\333y`\331A\352J\267\023\332"
+	.ascii	"\226&DR!b;\234,\251"
+	.string	"*\241c\201\313?\273\033s\230Rk=\353vA{q\377s\370O\341\347\231X8\346\272\016G@\260\277]\340\036`q\243\007\302\306\301\337\327\303}\364o\007\203\301\340\333\350\227|\221\363e\347\207\234\037[\246]\220\363E\312\017)\237R\376\224|I\371=\371,\371;\022 \251\352BV\255@\301\256J5\243\220\366\267\373\327\276\300\303\276\276m\252\355OG\254*^\272\034LZ\265\326\223\235G\021w\336'2\377\001\035\322\233\243A\273;l\371\224\033\232\255`i\313-\237\256\033\007/{fX\340\213X+\316\201\354\007XQ\334\335\233\373a\213\261O0\264\230\030\272\223\373%\342\nG\222\2557\303\002\274\026\300)\034s1\324V\325\b)\322\262^\340\276r?v\t\320m\221>\347\206n\353\2640d\276)>\326\360\352v~k\350\316\355\260\206Uohy:\"\252\356\243\357P\220\026\300C\002\0060"
+	.ascii	"\"\345\375E\232\025\225\027\227Q\005G\003\fm\203\204\321\202"
+	.ascii	"\313\204\234\221\205\304\205\2263\262\314\267\240\344\214,\030"
+	.ascii	"hndf3\264\025\231Y\213\315\315\fe\300G\232\027\233\031\3168\332"
+	.ascii	"\314`\276\272\262\266\321\227\204\322\007\032k>\352\355\230!"
+	.ascii	"[=\031-k\261\177\376\213\375\024[\337\256#k-\202\240\365\343"
+	.ascii	"\240\254\265\326P\306 \375\257\264\360\352bM\"\264\202\n\327"
+	.ascii	"=\317j\262aEO6\f% \220\002\021\272\353\006\217\030\256\037\017"
+	.ascii	"\244\f\240\201\034F\332\362[q\024\206+(\372d\321\340\332\241"
+	.ascii	"\003\022\253Z\027_\310\001\233\217FK&\327\242\002%]\207b?\254"
+	.ascii	"\326Y\221\263\013\031\277\371c\346-\240\020\371W\032'1\037\313"
+	.ascii	"A\237\013M\f4)\\\001\215\260\366"
+	.text
+	.section	.gnu.lto_packFlightModeFlags.59.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`\251\002\215\025"
+	.string	"&'\214J\300.)\035[\324\203\221\025\003\344\236\020\210\275\244\203\360\363\362\022\263\033A<T\003\223j!\216\371\273z\217\361\267\375\236by_6\333\246\"\263\341\277)\240u\301 :\201\346\332\002\020d\350R\264\372)8\2144B\210\334)\005y"
+	.string	"o"
+	.string	"w"
+	.ascii	"\017\221\263\241\306\240\206\337\201\244l\222b\324Zg\037\367"
+	.ascii	"(O\216\347(On\006\2334\367\227\351*\311qi\316\027~\024\232\252"
+	.ascii	"\352\375t\177\2157\252b\361\0258\027F\003\"ptN<\365\375x\324"
+	.ascii	"\374\311\331\271K\343\247\363\322\302\311\032\032:\216!V&\260"
+	.ascii	"`?\233\321\343\246C\357\374\315\320=\361$\020\325UO\316\316\251"
+	.ascii	"\213\244\326j\332\373\345\334\032\267\375c;\201"
+	.string	"M9\004>\266l\244\336\210\301H\352\363\301\377\365\341=\356\221n:R\237#@\226\212\006[\265\336le\325\"y\"\350\303\037\311O\372\222}Z\346J^(\030B\265\326\363#|\3420\206\251\211\n\201\214}\236\274\235\363\205>}$\020S\207c\022\233\\X\325\032\0249\351\002\346Ij\337\350G\271\007)\\V\253\217\323S\255\301\001\0061O:h\236(\273t}1\345\270\261\275\226T\025u-\360 \345.l\031L9\325\360\360\350V\031\243\273)+\364=wD]\025i\b\f1y \027H\342\337\367\230\345\333\0215U<p\227\3654N(7\026C\020\221\260\305\f\235\341\223\216\353/A\240\321\3676\366K'\231\331\027\025tC\273@\363NQ\212\374\265\266\204\033}\3174\nE\261fuv\220G\027h\377\304\322\032z\003*&\270\032\n\211S1\301\325\016\330n\264\327\215\345\304\245dE\245\266"
+	.ascii	"\346\001K\213K\211\355F\003\340\224\021\\\r\305\201\355F\233"
+	.ascii	"Eh9\241\315R^n\263\021\001\256\331V^f0\265\332\313\354\f\356"
+	.ascii	"\276>\366h\356\312\316\375\330-\317\262=\327FkG\267\224^\013"
+	.ascii	"tl\206+\266\033\212\244\250}\036]t/\274)\243\250\004\265/DA\320"
+	.ascii	"\207\217\265\326j.\320'\376\005\342\210\247\204\255\307\r7 `"
+	.ascii	"\002\221a\272\r\177\214\324h\362\353Rl~U:\215\345#\303\245\211"
+	.ascii	"\245~q\222\311\356\2246Q\344\276\023\203\210\036t\031\255r\023"
+	.ascii	"\207\332\n\215\233dX\376\305\231\013\027N\303\205\002U\377\003"
+	.ascii	"+b\004\330\255k\233\034(\331\234\252\324(\336\205`8\3520r\277"
+	.ascii	"\273\216\375\212\2656L\230\351\242\337\305\241Z\320\360\357\322"
+	.ascii	"\016|y=\f\227\226\370!\214\356^M\240\f\344\273\"\231\251\rO"
+	.text
+	.section	.gnu.lto_activeBoxIdGet.part.0.75.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\205\n"
+	.string	"&\325H>0\247*\035\220C\276\024\024\004\213\360\236\373;\344d\235\2733\\?\003\025\016\214\234\007\364\202\264\325]\024\305F\214\022Z(\247>\"\250*b\340\334\204p\256\205nP1\274hmo)S\n8"
+	.string	"5"
+	.string	"4"
+	.string	"\033N\211e\333\033\216\311\247{\261UE\005\3621k\260\353i\217j\362\3235\341\311\317\256\205\272\376;\f\020c\320\265D\236\t\207\225\316\356\3322r\307\333\226\260\235\261\257\005"
+	.string	"l\337\376W\2621\266\311\306<\332\326\274W\272\214\004\275m\261\254i\177\300\t\230.#\371\262[\222@\301\256\227yt\204\345\321\341\013\224Gx\005\312\243}\001\016\233z\347\317n`\363O\036\255\301\345\273G\237\343\350\310w\251\377\236.\225\242RaVx\270\273k}\331N\253\323y\357?\005b\205@\262\273z\340`]qA\026\023\243\315\023\375\321\2146\017E\210\003i\031\030\025 \355#\3424\r\203\267\320\205H\333\3306\221\2069\\}\371\337\037\020d\252j\210\272\223R\017\253*\314\366%\257/\360\003\\Cl\003\020"
+	.ascii	"\3571\036\026\356\320\206BY\340\fc\312\225\271\025\220\007F\004"
+	.ascii	"\22709O\316N\273k\216\240\316\360\220\232B\363\322k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`d\003M\021"
+	.string	"&\332dE\340VM\007\242\247\342%}\235\276\005)\034\"\235\305\345h\257=\350.\002e\033\234q(OE\276\205\235\b\207\235\347@3\3140\303\032\330\362~!u~(<(\277\242\353\267\356\314\376z\2246\371\326\222$\231RS"
+	.string	"S"
+	.string	"O"
+	.ascii	"\013vH\201Cx\t6\007\202\025\202\007\026\307\214#\0242\236\363"
+	.ascii	"JM"
+	.string	"\230\274\f\370\203W\300q\0367\241c\261X\214\345\256G\300o\006\324\274N\302db\320\220\002\274\365z\227\247\324l\340\356\306\310\256\223?\273\276\313#\004\223\244\2242\306w\307\333]\322\205\225\237\013#GVl\260\263g\035\031*Nl\260M\3173>>\2126\330\245\347\226\004\341d\203\315\3179?\"\212l\260Y+\3338\276D.\337\032\016|m\334\370\336h\371\006\331\370\322\032\327\241q\t,\245\334\205i\340\024\370\264\344\211\020\003\2170\263:\002\363\205\276|UQ\325LU\372\251\271U~>\034LP\226GU\024EM\225J_e\236h*\366\351\231f\b\210\213\235UUl\246\314$J\f\341b\363T\305\336\261\300\305f\271\304\316~\240\220\270\343\367\037\204(Y\224\3361\365i\262\300\316\002\313\224]0\242\027\2475w\314-\272\243\036)ZW\340N\342a\003l\265f\271hm\242\274FAA\210"
+	.string	"Hi\r\223KFE\257\226\330=\317<\242\003\f\330J\354\036\236\312\363\031\236\371E\n\240\3070\353\303\314\312\013\204\005\022.v\200\271\242\253_\005L\250a(\323i\023H\nJSk\f\340\002\241)\323\006\021\220$\244T\030J0\242\240\240\240\003\304\231]\321\361\210\313\244\235\304\337\210Wu\272b\356\222\177Y\370\223\302i\226\2674\311s\276\342\026ba\263\257M\250\265 U*^Lk\030Z)q\317\022QI0\016\273\003\002\026s\303s\332\032\252z\245X\252\273\"\376\3739\321S\375G\307\214"
+	.string	"!4\321j\253\016"
+	.ascii	"\270\334\027Q\024[\250\375\314\344\326 \313\303\211\270\340\355"
+	.ascii	"\304g\2601G\224d\250\001"
+	.text
+	.section	.gnu.lto_.refs.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375 \201\345\002"
+	.string	"\022\007\024\035\240'i\f\343X\335\262UU\325RUU\027p\324Z\374o\277\265\326\332\266\277%I\001#\203I\260\331\215sf,\024\364\004mD`\003s\201yY*J\206^h\311\022j\007uS\313\324J-R\037\265T\217\004\260\243\017m{\316\236\037\002\003"
+	.string	" \344"
+	.ascii	"\301(Q\304"
+	.text
+	.section	.gnu.lto_.decls.6936269edf29ddae,"e",@progbits
+	.string	"(\265/\375`\3657\215\350"
+	.string	"*g\201OX LI:\215\001v\235$3frUaQ\002D\024@U\323\311\322u\033\r)\2703\263\001\3444bTUEl\024\251\354\302\232`\333\002\206\346Hfg\353\b\007p\217\337\207\322oWr\030Gu\272\361gIO\016\004\316w\374>M\375\373\374\277j\223\332\266\224R\246;\004"
+	.string	"\005"
+	.ascii	"\005Eq]\315\275\2357\312m\263Q\013'\265\211\354>\310\241F\026"
+	.ascii	"\355\220jI\335\305\311\344\317\344\351_\026\375\231+\3723U\364"
+	.ascii	"g\250\350\233\204\347WI\216\221\307\344\302\315yFN\333\013f\326"
+	.ascii	"\364g\304\364g\272\364g\230\3723L\3722}\3722U\364e\216\350\313"
+	.ascii	"\224\351\313l\351\313D\351\313(\365c\360\364c\244\350\307\254"
+	.ascii	"\351\307\204\351\307t\351\307\\\351\307,\351\353.\372Z\212\276"
+	.ascii	"F\242\257\241\372\372K_\317\320\327S\372\272H\037\346\005}\230"
+	.ascii	"8}\2304}\230\247>\314\226>\314\223>\f\221\376oN\377\227D\377"
+	.ascii	"\367\324\377\325\320\377M\351\323\375L\350\247\245v\372\306\270"
+	.ascii	"X\026\252\301\225\361\033e\367\236&\235\333y\267\370\240?n~J"
+	.ascii	"\247o5\370\341\276>\253\301\357\351\232~\352C?\215\241\237&\351"
+	.ascii	"\347.\372\331M?\233\351g/\375\264\027\372K\254\316\017\312r\261"
+	.ascii	"\321c\327T\220\233o\024\317\357\n\234\226\304\204\227\233\357"
+	.ascii	"\224\306pyI\037.o}|E_\244\233d\241;W\311F)Z\252\232\242K\260"
+	.ascii	"\373\354\316\357\270\210>\316\241\217k\350\337\023\366\212\222"
+	.ascii	"\206\206\212\247\267\233\255\030\317\257\211\2338#x\230\251c"
+	.ascii	"\360\223~\224O?\252\227\247\177\347\364/\233\306\371\241wnh\f"
+	.ascii	"\2544\207\353\244;\260_4\b\253\363\3335_v|\331\273\371\026\213"
+	.ascii	"\266\333\314\352XyZ\272f\213&7\327\315<\365\222\\7\337N\261T"
+	.ascii	"\354\234\205\332:\033w+\305\312\335\216A\371\302\304Mn\331\214"
+	.ascii	"\202\263\225q|\315:\013g\237\330\0209\367\323\357G\337\322\022"
+	.ascii	"\275\275w\007\032\027GfN29\3379\246om\350\333\026\372VIc`\237"
+	.ascii	"\3306[\346\201\275\207\354\2757\304\274\200\242\212r\263m\302"
+	.ascii	"s\353$\303\257I\312\271\315~_\270 \231\335|3\002m\267\325\371"
+	.ascii	"u`\241vI\231\t:\250\252(\261\300\031\245\024\343f6\233\247\025"
+	.ascii	"1!7#q\356\324\264\361AI\335"
+	.string	"\374\026\264\232M\263G,\324\256\331!\267Dl\221\3578\367V\356\275y\200X4\033\274\267\213\260\246\007\277\035\373?\200`\327\254\021\213f\341\244\026\220\204Gt\357\347-\217\237g\315\366\260O\354\274\261w\f-\033(O\202\254\351\355\355\334\351\320\241C\r\334\224\030\225\3167A\333\035\007h\033\304\n\261P\013\354\231\363\206\206\211i\213y\363\023\240o\315\276\241l\203p\035}k\301\317\366Y\013~\277\321\277}Z\036\366\007^&1\267\331\336\316\234\0331(\0315\23471j{9T\334l\235\326\307m\231%\373\007\020\216\211\3126\217\275\267-\373\200\271w\322\226\335x\331;ycm\006\326f\220\303\256\272\316~\3712\372W\3438\255\316O\333\f?\231?\023\340\001\307\371\363\n\022\030\300\210\255r\213<\347\317D\026 \222f\213\374w\b\332o\201\234\375W\b\375\255\331\177A\374W\001B\3560\310\177;"
+	.string	"\344\277!x^\0038\363\360\277\370\336\334\035>\376\213s\235?\367\244\255\240\201\377\256"
+	.ascii	"6\367_\356?\335\1777\360\337/\035\377\313\376O\371\217\377>\036"
+	.ascii	"\200?\253P\201\t9\376k\360g\013\376\213\343\277^\377u\341\277"
+	.ascii	"7\376\333\374o\327\177m\374\267\306\177g\3747\353\277X\377\215"
+	.ascii	"\361_\346\177_\374\267\352\277T\377\235\372\355\357\277R\377"
+	.ascii	"]\361\337\247\377\246\370\257\322\177\223\376\213\342\277\313"
+	.ascii	"\377i"
+	.string	"\377\215\374WS\376\267\350\177\006\177f\300\177I\360_\021\374\367\003\377U\377\033\374/\360\277\034\370/\006\376\233\302\177%\360_\b\374\227\204\377>\340\277\r\370\357\002\376+\302\177?\370/\317\1777\370\357\001\376;\200\377^\360_\235\377\346\374v\356\2771\377\205\371m\330o\361\376#\371o\372\333$\377\315\277\345\362[\275\337\346\375V\313\377,\277\245\362[\272\337J\371\277\302\377\n~\013\345?\334o\337~\353\366\333\264\337\236\375V\354\177\225\377u\377\225\374O\362\237\355?\210\377n\377g\372\372\372\372\376\334\364\313\b\377\003\330\005N8\313'\323i\371\2642\263aGWQP@\350\264\216,\224\245r/)U%\233p\340\226N\346\246\333\333\232\231\330M\003\330\273\212\331D\227\\a\323\212\340\226\212\206$\231\226\002\245\242+\346V\302-q0\367\306Q\004\264\225> r\302m-\013G\024\243j'\231\330\033"
+	.ascii	"J{\023\331\r\267\367&\332{\3034U9\367f\201\263l*)\355-\265\243"
+	.ascii	"\264\253\210\324L\354}\315\352\322\234\226\317+&\217Z\220gs\237"
+	.ascii	"p\022\331\346\246\263j\322O\"\037;I\213n:=\335e\0241sfe8F:\237"
+	.ascii	"H{<\241tm\321N\rR_K\331(+\327\332XD\2719\027Y%D\2428\321\351"
+	.ascii	"?\023YhN\036\013\315\256@\206\006\214\027Sn\306_\362\3262v\f"
+	.ascii	"9\222w_\324\221(h}\370\212m\221\242\006\331\315\307\303|\377"
+	.ascii	"cf\262l\314\235\340\363\222B\017)\007\022\3475q\203)\353f(\336"
+	.ascii	"\263C\376o\230$\214\275\272\233\177\324\234\365Q\221\241w\013"
+	.ascii	"\305z8\317\226m\242\0339$\251\r~J&\022s\310\026\234\027c\365"
+	.ascii	"C\013\017\343\321dQ3j\312\361\002\326Rc\303\253\254\350\346\273"
+	.ascii	"\245(k|\\:\212\263X(\266\303W\206\360\300\202\255\330\020\345"
+	.ascii	"\354\035c\314\016W\301V,\234\224s\247\200\021\342\243K\217\\"
+	.ascii	"\364\203J\223_\376\r\222\376\215\322\312\215s\222Tt\363ov\035"
+	.ascii	"\335\213'*ZL\201\342)\230\016/w\322\352\0031\030[\252\364v"
+	.string	"S\323\006s;v\211\227\2258&\3726C\260\224\232\030&\213\037\311\247\306q\317e\314\032\234\214rb\344f\347\214\324\222H\017(\032h\345\032\032\017\2707\036_\273\312\315\307oQ\017\300x\365-\335\335\214\235\360\034?\271\200\b\233\332\3150\270\211[>[#\222\244\315B\261\033f\362\354\334\333\f\273\341#x\211\215\322\271SLP\004v\223eE\026T\316\267\371\322\307K\224\\\346\336fWI\306\334\362f\214\004\263Y(\007\234\3441J\247\363&f\212\226\026f\\\372\226\303\357\306r\370}\3409^\003C\002\203\313\315\267\321RK{\221E\026\304\210\205\3424\\\004\247Y#\230H\316\362q\327\003\254C\r\227\246\255\226\363k\276\350c\"\177\326`A\342\264q\363\205\3429\036\262\200\255\030a\030\r\237\375ZT\261s\302f\030\212\205\340 \026\212\3170\220\337$v\313\263G\334\326X\215(\bd\270\254"
+	.string	"9`d\211\322\303g\370\351\224%J\207=\2318\"\223_\303\246_\203\246q\331\305>\360\217\3432\354\244Qn\\\226m\0066\326f\220\262\331H\376\370\345\327"
+	.ascii	"\321\257\271\241_3\245_s\244\177\314\003\213\245^`\311\0327\343"
+	.ascii	"0g\214\035\025\330\022\237\276\007e5\242vjGoGP4\265\330\027\346"
+	.ascii	"\244\212\372\260X\275%\272=/HM\242\254%\023h\213\267\"JoF\222"
+	.ascii	"\306vD\371\2166\023\027)<\302\242)\2624w\223\236\023\213+.\f"
+	.ascii	"\211\232\271\260_\346PH\3311\006D+\332e\344RUYi\022Y\322\302"
+	.ascii	"q\326t\2720\260\336\336\322\220\366=\272KF]\2424\334n\020q\262"
+	.ascii	"z\322\344a\263d\261\260<\202\314\210n\325hk\332`2\305\265\204"
+	.ascii	"K\027\245(\017\336\227\355\312ag\332\tE}\321\263\252(\223'\215"
+	.ascii	"(\236\315\233c\002\341\213\254y\207`I\371\260\341\205\246\205"
+	.ascii	"I\027\305\303\373\032\335\023\330\331\f\001\204/j\367t\230-\275"
+	.ascii	"\330\331\273\254\251+'Q\274\257\212+\265\261\260\200\365\260"
+	.ascii	"{A\345\005\274\002\033a\035x\t\343\300)\260\013\270\006\216\201"
+	.ascii	"o\340\034x\211M\334=L\205\267\360\f\254\205\213p\026f\336.W\013"
+	.ascii	"&\302(p\013,\205\225W\017\263\300*0\024~\3020.\026<\205e\340"
+	.ascii	"#\354\342z\301'\260\022N\342\253\233\345\362a\032\330\306\265"
+	.ascii	"\273y\027\017#\341\035\267\0173a+\034u\267`,\334\304M\227\013"
+	.ascii	"N\302/p\027\346\302U\030\f\177a\247\373\345\336a\257\033\265"
+	.ascii	"P\274o\335o\225k\345&\177l\361L)\342\273ObbQ\255\034\320\273"
+	.ascii	"Q\354\265\250\322\354C\233\212z0\343f\331$q\266\322\250IS\310"
+	.ascii	"\213(\036YW\323)\307u\345\267X\256\314Q5\235\\`\325\315y\261"
+	.ascii	"Zz\200E\251t\271I\274o\030\226\363j\341}\233@\212D\367vv\330"
+	.ascii	"\351`\335\270\\\221Y\251|\2329\255\323\216h\332\364i\320\364"
+	.ascii	"i\302\364i\266\364i\244\364\257\334\177\327.\222+\3052\367VB"
+	.ascii	"19R\344\346\270\035\374\345\250\310\330\315\247q\322\377/\334"
+	.ascii	"}\273P\356\023\013\275Q\256\333o\023\253\345\027\004&6\212\235"
+	.ascii	"M\030!W\\[n\224\353\344fag\232>\361\003,j\367\226\330hV\347\227"
+	.ascii	"3\306\363\224\206L\221\250\030\223\326\f<)N\236n~:\343\307N\254"
+	.ascii	"\235\\\221\273\0317\337&<O\263\356\230\214%\215TF\212\305d\276"
+	.ascii	"\230\273\371)\326\237^\2451\242$i\320\270\331\232Y\235\037\005"
+	.ascii	"6\303\317\022\341yjE\263\226\242L\t\ff\r^\335U\312\374o\251\264"
+	.ascii	"\302qs\352\202\347\351\013L\347\244\246\342\346\264E\225QS\223"
+	.ascii	"\264\352OU\\\252__\327\013I7_%\317S*%\324\031\027\213{\"\365"
+	.ascii	"\261\314;\233\222\362\301\364\204\343\346\247R\177\272\342N}"
+	.ascii	"H\322\312\272yF\005\317\323\250\345^\330\3152P\351\023\035\013"
+	.ascii	"\034/\334\374\364\351O\235\322\0246mXJ\226n\266L\253\363\323"
+	.ascii	"\300\304\363\264i\006\315\215\257\353\346\fKJ4WMT\260n~\252\364"
+	.ascii	"\333&\266\317\215I\334\336\315)\022\317\323$\335\327\267\246"
+	.ascii	"u\263\315Q\212B\006\2203\0257?E\361\247\313\273U\242\217o\313"
+	.ascii	"\3155&x\236\236\230y\222$Jv3Mj\224*\303\260b\244\312?M\246E\266"
+	.ascii	"l\306\307\233\227\0357\333\246\325\371M`3\374\322\315\363\224"
+	.ascii	"\250\005\027\221\324\315:6\303\357\313\227\334\204U\265\264D"
+	.ascii	"\317&N\306\021\222\020+\317Q+\331\013\236B\263\211\3126\023\214"
+	.ascii	"\221\266\2704\275\275\224\3420\343\003\311\007\224-\317^\236"
+	.ascii	"\367>\200\360+\032L\307\224.\267\221rr$z\363\263^\346\362\307"
+	.ascii	"\310xa=\277f\350#\240,\312)\357W.\216+Iv7g\274\263I\315\351e"
+	.ascii	"\275\360\344*\256\350\346l\227\357,\364nY\313m\216\234\200\272"
+	.ascii	"\301\320/\201\275\333/cy\316\362\307\304\034q\201e5u\345\217"
+	.ascii	"\2019\233B\325\274\371\032\240\3645(\315\315\345:\036+\26240"
+	.ascii	"\032\262.Q\306\250<\327e\272\267\270\270,\247A-\351\325\206\303"
+	.ascii	"PLy!\345Y\256\006\017\b\\\017%\277'L^\272(\201\002%\277\2015"
+	.ascii	"\271(\255\252\2405i\222\337v\230x.E\030\0130\030,]`\024=y~\203"
+	.ascii	"9\032\333r\2729;\371\225\037\224\257/\033dJ\224\344\266c\345"
+	.ascii	"v\301\244Y\2027$'\223\3476\233\023\\(\344n\316Kh\320\264\304"
+	.ascii	"\345=o\276\366\220\246t\0359\222\331,\024F\227\036z\366\316j"
+	.ascii	"\007\212\214\344\231\rf\353\tV\212\233\363Z\3162\362\362\302"
+	.ascii	"\314p\2453\221\023\311i;L,w\027\306\002lo)\016X\t\017((#\317"
+	.ascii	"i5;\324j\234\335\234\213<K\316\323R\326q8\n\222W\304%H\220\214"
+	.ascii	"&6C\203\355\351\356\354\031\355l15\236\336\3062\324E\031\023"
+	.ascii	"\b4\233\271P\022\245\306\334o/kM\231\205`&4MdH\302\344\236\026"
+	.ascii	"\232\2377\213\0033\231,\300\327\235\276Z\342\302\210\255\314"
+	.ascii	"Bs\231\215\332\262\315$\203\"\351\325\246\267\367\222\rn\362"
+	.ascii	"t\264\330\322r:s\223\316\227\217\276\273\346\036U\217\036\371"
+	.ascii	"\310\226m'\233,\273\273\036\231\013\227\032\006#\036\320\314"
+	.ascii	"#/w\230\311\024 r\330e\211\262)\364\202H\271\323a\241YG\016\343"
+	.ascii	"\300\334)>\320\002\205,z\343\302\211(\264\233s\330\237\2772X"
+	.ascii	"\336a\265\212.[\222~lC\342\226\334L\001v\221\323\346\345\225"
+	.ascii	"q\324\245pGd?\216\367\214#\n\016\2563\250\r\033\371\006L\225"
+	.ascii	"\266\025r\315\347\0330J\\\266\354\233sW\316j\342[J\336\234\271"
+	.ascii	"\316v#\204\213\t\027\262\321\231R\234\326\327\326\026\217\246"
+	.ascii	"\225\241\327\327\244E\214\307\310Z\332\271\231v\326\234\2448"
+	.ascii	"\244\321\347S\307\214g-\353el\313\354\346\214\225\2630\022\230"
+	.ascii	"\3273+\313\230i\262\320\302w\007\023U\324EI\316\021\223\231\255"
+	.ascii	"\306\240\334x\245E\325\301x\266\272U\356\306\360l4\275\312\263"
+	.ascii	"b\004O\337\356\260y\0054\257\310.b\226y\t\225\350n\202"
+	.string	"\332\300\262\301\324=\277\276n~n\361g\251<\225\253hl\330\246\214n\334\214\344\006\025\022\216\2333\013\236g\252\364\210\t\025r\363\001l\206\237\003`\2428Y\364\323SV\001B\314G\025\007\032\262\375c\013\352Y\005_\n\335\263\363\202\323J\331I)7\375\366\266N&SSF\312I\317K\317K\271\311\356\246\275;P#\222j\342\360g\246\347\246\262\233\242\0345\210\310\325\200]\221\233R\323\307\021\323\377\375\177;\331\264\367N\221:wS\021\315mj-\207\277\306b;\200\357?\002C{+\203\320\275\240\275\214$\2510\330O\341\366VZ\021=\300\312Ii\265b\371\264\332DJ.\242\234\246mE\264|\356\235\263\225J\"\b0w\316\362\271\235\266Q\024'\273\235VD[\311\3349[\271\223\030,\225VN\313g\322)g\371\264r\332O\253\215\263\225\311&\024\312\335\224\263\237Vv\373\311\f3&d"
+	.string	"\205\025J\030\001h\002\004,@\001`\t\027"
+	.string	"\252\200BNq\250\n\207\210=\305\241\207#r\310\303\004D\342P\261h,\302\254@\265\304\020\371k\301x\004Z\215E\030\237\240J\314\253\212\fR\203<T T\211\"\202E\023\220(\250\307\2415\250\372\340 \217FdQE\302\254\252\nGb\t?\305\341qU\341\006\004\006\324ux\324\300\314\2018\b\256C\021\026\254\352\t\353P\304L\b\020\364\004\2052\374\f}\212C\002@\376\004\211!~\212\303\240cpF]\203\253\n\253\372S\243\203\201D\360x\034\001\271\0019\302:,\016qH\020\205\324\013\344\024CPP\f\201!\005\rH\225\004\t#\214$\b\213C\037\033\233\0168X\217A!\016V\365\004\235\367\f\217jQ\375\321\377 \004\004\204"
+	.ascii	"b\004\314A\210\320\201\b\035\374\016B\004\036\036\021B\340\321"
+	.ascii	"\017\201\007"
+	.string	"\257k1D\211!18<\252H\233 uE\222P!"
+	.string	"\353\3523$\"(\250\036W\244\207\2421(\310\330s\201\260\250b$\320gH\004\362w\\\205\360W$\tj\220F\005\nQ@\002A\200\f\006\255C\022F\030E\320\254\300\017\036 \327\241\210| \017?B\024\2140\222`\034\026\207B8\007\342"
+	.string	""
+	.string	"5Gu\3040(\206h4\222"
+	.ascii	"L\205*\362\250\262\240\036\201\310\fB\033\214BC\242\017\262\250"
+	.ascii	"\n\005\031{\200?A$p\r\212`A\007\tLA8\024\242)\001\004\264)\001"
+	.ascii	"\004\304)\001\004\324\263\032\213\353\2018\020\016\205<\254@"
+	.ascii	"?C\242O\b\213\004\372\b\207B\277\024,\n\026\002V8\024\302)\b"
+	.ascii	"\r\t\213C\rl\230i!\270\201!\025\204C!\233\342\220\002\353\b\302"
+	.ascii	"\241\020\316\332\243\372\370dX\217\352J\034\256\300\242\261\304"
+	.ascii	"\360h\004\332!\261\016Y\b\036O\030\256\305\340\315\n\023\034"
+	.ascii	"\215k\360\250j\270@\013A\0229D\265\247g\004\033\341\017\216\220"
+	.ascii	"h\004B\252C\243\320\252\"w\324\240\341*C\"HT\2053\0322\254 <"
+	.ascii	"\006[8\032C\bU\325G\347F\246\004\020\360\003\022\031\024j\301"
+	.ascii	"H\314!qTY0\366\250G \0202x\354\261\261\321Y\21568\303\231\340"
+	.ascii	"\016r8\"\b\374\031\022\241\n7\344 \203\200\302\240\n\024\004"
+	.ascii	"\201\321H\004\036\325\3420x\\\201\306cO\220\002\234\234\243\361"
+	.ascii	"xT7\370\370\030\327\241\036`\017\020)\"\210A\025\"\261\002?\034"
+	.ascii	"\325\2258\364\301P\002\bX\034\256\300\020xt\t\240\240\243\272"
+	.ascii	"\n5\250B#\005\212j\317QMa\205\n&\240\022\177\212#l(\016\203'"
+	.ascii	"\344\254*R\275\300Q\375\371\031\036Wh\301H$\216@4\036\327\242"
+	.ascii	"\261\004\240\236\342P\220x"
+	.string	"\001PE\016a\030\021$\252G`\013A\022@\341\217\206\022\303cP-\016'\260\"\207\216@k\206\2648\f\376\310\250=\305 \013\302\240\260f\035\022Z\207\214\300\243q5\006a\370\255\305!c\017\220HT{\200@\343:\024\334@\\W\343\021h\035\"\213\301\343\272\263\"\215F\021@\037\037\255\006\005+\240\022\207>\306\243\320L\220\320\021X\034\006\321\bUU\b\t\\\213j\320\212\034\372\2000\250\363\023\016\205lTdP=\366\024\207*Q8\314\021B\022\215BGu-\016\327\340\0218\"\030\004\364\361\311Y\207AC\"P\005\301P\310\346h\\{\202>@\240\325h\fB\002}|p\214B#T\240\312\302q\250\007\350#D\004\026I\b1\250=\301#\220\250\262\240\022o\016\304\001\022\330s\364\320\343\203\004\376\f}\212\306\022\212\306\341\032da\270\366\214\240\n\215A\023\360|\360@\r\n\026\201\037"
+	.string	"\217*r\b8\302(\342f=\020\0057\n\251G\017\253\321x\3640#Da-\252\305`\320Q\025\232A\002W \210\2658\034\2029\017O\t\030`\240\002'\350\036\016F\030E"
+	.ascii	"\205\220A\036\212\303`\220\207\236#\322\003\007;B\024F\030E\244"
+	.ascii	"\307 POV\203\202\025\030a\024\001\223v\263V\030\355\241\241\205"
+	.ascii	"\240zZ+\222\326wd\271oFK\021\325JK\207\344#\276&UFhK\033\264"
+	.ascii	"g\222\344\231\234\3239\223"
+	.string	"\346\002\ne\026VSdnH\234\220\272\033:&VR\2207-\267\304\225\005H\366\002G\326\247usZ\206K\220\226\335\364\231\376xZ\366\033\030:\260e\362\227S\261\213\245\316cH\356]\264\267\213\031\005\220\202\342\360\247<\236:S2\025Z\240Wdi\017:\025K\\8\f\205+cJ\322\261[\207\333l,\321r6\025jbN\230\350?\rk\252\261\013\313\253\261#\263\345\265\350\002\303].\221\274\r\344\253\215\206\353\t\020':\262\213=6#Q9p\260\200\201uts\212\243,\246\310\f\032Q/\027\200N7\344R\027\312l\370l \275\2457\322&\315\206\223\2216\377\024\351&o\022\225T\226\233\323%\317\323\256\333e\346\346\306e#J\214#\251\215?\335Jk\330\300\351\3201\345f\273\f\204\273\250\003\243\364i JAh\220B\212L\315h\232tC\025@@p\\(\030\220\213\350\003\023"
+	.string	"S\211\023\272\226\246\031S#5\005I=\366\332\f\005\317uA\362O\035b\026L\301YwF.\035\257\037{\342\025\362g\361\361\305\300\363\225y\n\354\304Oy\247'\305\321R5\342T\303\\\214i)\001\232\f\300\227\324\211\341\250&-\f\024\004\021A\375t\b\005\005\343\211\375\322\200\246\224\023\312\254V^\331)5\216\007\355\023\213\367Wi\215\"\264\324\223\270|C)\320\262\204x\211\334\356\364\\\356\313\274\255\030(n\233\341\035\325\262\251\215Y\212\215,:Z\006\213ff\022\323\373\025C|c\335ou<\346\376/T\302\020\357[b\210UU\251\332\3711\346\222\033\321\212\203\266\214\324\232\022\263\017\303\002\343\263\202f\020\214$\003\207g*U\201\261\242\216\227\335\225\346\335\322\347\0324\t+\3761 1\361\232r\372-\200D]\306]\246(Y\f&5\034\201`\005\216\023$"
+	.string	"5-\210.:\025\205\264\304A\325\251\2122\023\002\223\224XR\233\361"
+	.ascii	"6\234\216\346;]\bFCK\310\323A\225\315UCl:\366\022(\361\334\260"
+	.ascii	"\366\311\317zw\030\317\242\211\2644\317<\3010>\242q\3326Q\363"
+	.ascii	"\326\310J\351\354\366\017/\202b\203\212\021\"[\326\3156\357%"
+	.ascii	"u\277]Q\376]c\026)\262x9\nf\314_\366Kf\367\035\017L\322b\253"
+	.ascii	"\370JlGM\205\263.\201\253\333\323p\025\341b\b\331\"\\\0300\340"
+	.ascii	"G\262\332c2\033\305\030m\324m\270\270\330\224\331\272tt\325*"
+	.ascii	"\253;\221'~\231\024$\334+%M\240BJ\304\212\375K\240\350\325\263"
+	.ascii	"\3243\327\22557\227'9\312n\020\346\275\220\242\223u\221\316\223"
+	.ascii	"\212\301\365\345H\223-~Tx\271G\326s\276\007\to\375\222 \363e"
+	.ascii	"\n\274\"\267\316\317Eq\331F\272\312{OB-|P\325\002\275E\330\006"
+	.ascii	"C\326/+z\337\353\242\204"
+	.string	"\206\372\356\336\272\220\201B\235\377]F\016\365V(^,\262\224/\255\005E:#\342k \306\343\356{\362\026N\0230\235]\320\344X\304d\345\263M5\365\305\214\276\340j\355\224\003G\256X\0321\361\217P#\002\022\277\233xB\016|\260\030\265\266h4e\2344]\n~\322#X\360\035l\312q\013\b/%e\205U\376t\337\365T|X\300\261<>~\270\245XB-#F\3024\263\355\247?\366\237\323\017\210P\247\262@?vu\273\316\3401\017i\r9\021[\335`l;\371\035\2748\306\254\006\031`\316-\271@\243w\222\322\322\270'\036\343\3038\257C^\236(\r\033WX\023k\221\226\354\026\340Z\2031B\367\211\231\304(ad\032\201rL\276\034i\271\213\351\3266\317O0\3165\311\t\035\357o\230\315\271\225\346\302'\242w\252\017\250\322\370\301\021\261uc\250CL?\213\265:\t\272K2"
+	.ascii	"F\320\027\355\257\241\355l\006j\3507\002\324*@&\322\347\023u"
+	.ascii	"\377\332\250:\005\255K\360+o\303\tZ\327\347z\003\312\315\236"
+	.ascii	"\302\216)\016\371\256\327+\322\302\344\221?2\314\205\022\255"
+	.ascii	"\300_\302J\246x\2514#\322X\002\261\251\266\353-\021\232)\"zZ"
+	.ascii	"\016#\332\034\233\247\350\314\325|\313\263GRIJ\352%\260"
+	.string	"$\243\277\247\201\234@\364\032\233b\313\t\377lj\274\333\033R\321t\032\315W\365\004\376\035\243\340\\\nq<3\320\231Z\220R\2326 \n\201\016\301]\277\352a\247P\013:\250\252_\200AuKmDE\200\322H'\265\231~x\266\001\237\262\252\353\277\245\202E\347kt\035\024kDH\367\302\347\250Lt\373\225%2\272\376\216\220\003\3562\023\b\346\217\212\322\272eI;\325\276\022 \234S\241\020\210qJ\232(#\210,M\204\256\271xT\251\331\244\311,\004}v\261]V\031\232\356\264`\261\f\304\367\276d\3542\021\006\246\347p\255\025\235'\276=(\265s\201\bP\211\357\235\004\277\201\202"
+	.string	"\327\273Z\002\020\022\332\344:D\3326\033\335"
+	.string	"\330\301Q\236\264\177\325\023S\225\001\230\300\206\305\365Ce\225k\333\207v\326\205\244\017\270\201\224\317\2708\306W\357\344,6\276\030/wd\205\376I~\374\212/2\34607]+%\356qO"
+	.string	"\224u\352\362\331U\234V\007]\276\236\304Q\326Y\211\242\347x\272\322\312\331\305o\222\366\356\235\313\210\321^\fG\r\236s\233\202&\034\2673t2\340+fm\320O\354\001\003\323e$t96r\200\216)u\206\310\324\302\243\020\223\025\231Lt<\2428\207\237\246J9p2!q\362\021(\337\026\234v\227\234<1\003_\353\322\245\036\221`\253\360\300,\343\267)-\363\274\332\016\004\016\242X1\345\216\327M8\306\236\344\245\\\364\3568\024\035}+~)\275y\376\263J\322\277o\346\331\023\311\344\234\343\022y_\342]%B\321y\215\0059\240uvO\026B\224Zh=\2521\203(m\321\256\335A\234\353\\6I\304\266\363\351"
+	.string	"\316N\2501\023\030\211\013\307\363-\251\302\323\253\346\204\347~Q\241n6\366m\223\030!\360\220\370!]X\224\"\276@%\322\337\311\231\365\f?Xs\216r\242\002\022\211\252\225\b?\003K\237\227\371\266\300\232d\313\214\364\310\2171\244\365\364\363v\276kF\341\306Hz]\b\336\335\216<mOf\033\035\027]<]\023w\025Z@\345\300\030\t\205S\277[[\330\200\216^ \224\242\r\260\365r\353\206\213&*\303Z\256\336\207SrMj'\240\027[\370\335k\335\337Z\022\332\367\232\3022\"JGp1&\267\027\202y\003\f\005i"
+	.string	"\035\246\370Q\215T}Z\365z\326\255\263\001x\344\026*\343\324\206\323z}#\244j\343\314\246\356\"\357\266yqs\352\251\371i\031\2551\344\266\343{"
+	.string	"\223\345u{\255t\bM'\234p\177@,\177\\\377Y\261!\351\332\315I\343\373\336\023\271J+@H"
+	.string	"\b\310\253\225\370\007\342\332\270W\342\366m\373a\362J\256"
+	.string	"\376\f[;\2528\267T\345/\266\026dd*\220p\340 {L\226v\0038\376\365k"
+	.string	"\314\257\315\240\236"
+	.string	"c\342\201\032\016\310ZQh\357"
+	.string	"\271\023\3501\247`\371\n\2015X\247\310\215V\237\236\031\032\316\354\030EO;h\tS\177:\372\017\340M\325u\233\313\220\345,\006\317Gf\321\311n*%\330\307\224\353lE\276\373\006\356,I\343\373\312\332\342w\301\260\321\360\320z\303\304\271\347\3152B\354yX\206i\224\274|"
+	.string	"\355q\251\232m\301\210\345\235A\341\374\236t}x\363l\202X$\320\\\335\226S\246\251\254\371.\337\334p\275}\321g\347\273\326\362+\327\272\177\304\274\271,\327\\\273qi\217\317\367\b\324*\345\252\301\213\311\221\tv\025\226,C\271\200\254\275\325\367\376\232\261\2247\210\341\177\341o\222B\030\322\004\361\305X\260\310\232\366\267=E\203z\370)w\337\322\265\246\250\006{:\306\361W\312\250\252\305\320\273d\343\245*C\377/\340\035A\f\323\326\204\356Z@B){\022<\353\341\221+\306\275\233N\347\023\213H\223Y\201\314\031~u\266\037\353\273\217o\n:\255\352\225J\231\222\2427H\272Xp\371\325&~\275\300>'\221\030\006\006%*^\332\002\307\300$\341\241\240\314\213\022\027\303*\256\303\260\222^w\372\037\211\242\211\210Mo\266\330l\n\250\330c\274}W\234\373\220\nH\344\013\277"
+	.string	"\230 \023\257)K\227{\363QT\016\276\r\334\346\223=x\300\240\266S"
+	.string	"\2704\205\274\256\354\035nIsH2\322h3\004\037\301\230_\2052rb\262\305\325+D\224\322\262Cd\277+\220\361\276\262\245k\305p\310\rYy\230L\211\213\207\334\336\263\005\375P\321P<\031\240\260\261"
+	.string	"$I\334\2758(\355"
+	.ascii	"X\324d\371\254.\343~\323_\342\360\345r\236m\177\b\270\234\364"
+	.ascii	"\t\316Y<]\004n\034.\364\237\373\024\370\243\375{\354\35306\245"
+	.ascii	"9]|\350\303\017\343v\312\306\223\255\303\371\324\233\307\310"
+	.ascii	"`\237!\377\215\314\373\270'\013{l3&\316\362M9\356\031\350\373"
+	.ascii	"\263\252\203qO\372\233\021\246V\211y)\275v\365\230f}Y\267\211"
+	.ascii	"\016\271\375\2704\"sC\307\340\350L\321\233\364P\373\210.\343"
+	.ascii	"\016o\310\344\201\305nTr%y\344\364&|LoT|\267q\336\021\365\326"
+	.ascii	"8K\357\315\366k`u>\2302\224\313\036\020[[\317m\351\223\303Y\362"
+	.ascii	"\317\230\232\302\263\341\222\261O\032\327\212y\013\377\362k\331"
+	.ascii	"\221\243\357\367\252\363\226}\371[\354\016hO\302!\371w\316\035"
+	.ascii	"\333\037q_om]\340B\352*\216I[7"
+	.text
+	.section	.gnu.lto_.symtab.6936269edf29ddae,"e",@progbits
+	.string	"findBoxByBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"modeActivationConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6936269edf29ddae,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
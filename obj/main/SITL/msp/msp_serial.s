@@ -0,0 +1,1806 @@
+	.file	"msp_serial.c"
+	.section	.gnu.lto_.profile.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	"\022"
+	.string	"\033"
+	.text
+	.section	.gnu.lto_.icf.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\313\003\265\021"
+	.string	"\244\024\277\004"
+	.string	"\035"
+	.string	"\303\266\246\210\b\002\002"
+	.string	"\002"
+	.string	"\001\357\325\223\367\t\006\002\001\002\002\002\003\002\004\003\247\347\300#\020\002\005\002\005\002\006\002\005\002\007\002\004\b\002\004\002\t\002\005\002\n\002\004\004\230\343\355\201\t\b\002\b\002\013\002\f\002\013\002\001\002\r\002\016\002\017\006\330\312\227\325\007\024\002\b\002\020\002\001\021\002\021\002\022\007\240\342\234\212\n\b\t\206\260\252\216\001\f\002\004\023\002\004\002\022\n\013\334\227\330\222\t\006\002\024\002\004\002\025\002\004\f\300\366\351\215\006\306\001\001\026\027\n\027\030\001\002\030\b\007\007\007\b\002\031\031\007\n\n\002\004\r\350\332\272\274\003\026\f\002\004\016\204\217\260\340\002\n\002\032"
+	.string	"\002"
+	.string	"\017\374\202\224\241\005\016\020\260\375\200\312\007P\002\033\002\033\002\001\034\t\002\035\030\b\002\036\037\031\037\037\037\021\245\377\341\237\f\022\265\272\314\267\013,\001 \002  \002 \023\024\351\341\216\206\004\b\025\375\360\231\200\r!\002\022\002\"\002#\002!\027\371\312\370\232\n\002\030\275\240\275\342\b\031\205\330\227\263\t\002\032\233\360\340\227\033\315\345\214\346\b\b\004\002\004\034\317\210\347\342\f\035\342\363\314\365\013"
+	.string	"\036\343\324\302o\r\005\002\005\037\231\341\276\316\r\004"
+	.string	"w\250\341\271\240df$I\n\222e\f`\002RTD=\021@\251b\024I-II\ni\317\356M\026\034\205a\005L*\314$\312\317\020m\005C\366f6\310\2664\366%\030\304\017\247\035\333e\232\331\211\216\240\355\364\214|\313\264\271\354\374\027\244\265"
+	.ascii	"\006s\260P\255\2467\311\276\300\254x\320\232\366\205sA\362B\335"
+	.ascii	"\321+\271\343^\340\362\353\257+w\224\n\203\035~\206\303\016\034"
+	.ascii	"\207\353\"h\342HO\361\3706\nz\272V1\371\270\354\332:\237:\327"
+	.ascii	"\020\236t>\247{0\360\026P\315\223;I\315\313\272\331L\223\347"
+	.ascii	"\350J~8\013\260\312\f\353\203\360\273\\\240O2,\035?@\030\373"
+	.ascii	"\3368\261>\271\235\362\207\"\203\231\034\277e\354\034\262N\265"
+	.ascii	"`\b\200;\232*\177\344\215C_&\313\234\213\017A,\253\037P\273\377"
+	.ascii	"\217\264,d"
+	.text
+	.section	.gnu.lto_.ipa_sra.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\037\002e\b"
+	.string	"r\t\032\037\220+\215\001\377\377\377\377@\023wwww\261\371\321\266\255Em\372[\002\266\221O\244\224)\005\252\031)m ?\034\337`\330b\243U$\356\261\242\324#\376\254\fiM\363\2645\325\271B\262,w9\314k\216\311F\241\332!\370\r\264\324\253\274^:\364\274\300\f"
+	.ascii	"\354\364:\223jR'\237\222T}o\327\246F\332![\250\241\321\273I\262"
+	.ascii	"\354\033\300\002\251\252\325\001\0210\265RP\316\202\024T\322"
+	.ascii	"\336\001&\b\207\027\3228\316\303x\272B\220@J\tl\262\221(Tp\212"
+	.ascii	"\242\306\216\347\2279\344\303G}n\013\301\32582\t\246\233\305"
+	.ascii	"+\374b\004\2639`d\224\277Q\211\217^\375\302\360\316oW>`\236&"
+	.ascii	"\203\rB,9\356\267!V\255\333\345\006\021\tl\211}Q\346\034\031"
+	.ascii	"\276&\231\300/,em\250\326\026\327{\025J\3505\034\212.\026\\\262"
+	.ascii	"T\365\232\005\347\303\276V\b,\tsB\32181W\311\341`\301+>"
+	.text
+	.section	.gnu.lto_.inline.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\215\021\345@"
+	.string	"*W\354\021Dp\234J:\3770,\271\354G\262j\246\240\372\024j\n\340\n6}A-\302>\236j\276\304\337\034\311\221b~\240\226m\244\222\025?6\n\272\201\023\307\274\"\24235qXJs\213\324V\305\272#qo)S\367"
+	.ascii	"\f\001\017\001\300+\035\351\377`\rj\252\366\033)\245lw\357\r"
+	.ascii	">\350\177\277\205M)\222\241\177\216\3522aS\212\024\375\347\377"
+	.ascii	"\025\371K5\027\263-k\025$43\237\245\372\213\331\226\265\002'"
+	.ascii	"\377\237x\004\302h\337\367M<\002Q\3549\2619&|\276Co\2760\310"
+	.ascii	"\277\305\275\327\352\377\375\364\f\232\0334\337a#\222\3218BS"
+	.ascii	"eY\361\266\024\347,lDF\350\251\377\316%\232Kl.\311\020\327\262"
+	.ascii	"|\003o\354\333\333\267\023\253\335{\177?T\377\374\036T\243\207"
+	.ascii	"\320\374\013\325\350\03747\237\236M\320 \367^!\"\255\357\372"
+	.ascii	"\256L\224\213\226,-|{c\313\361\335\t\251\\w_n~\377\023\345\272"
+	.ascii	"\373\322\373\371\374?j\346\177\001W)!\217z\212\373\fE\243\274"
+	.ascii	"\335.@\347\337\370\312\357\367S\337{/\371G\321\037dl{\300\376"
+	.ascii	"o\324\334|\216\242cdl{??\361C\253,\202\202\3358\346\361K\276"
+	.ascii	"e\021\370\362e\261\251\260A\003\243@y\357%A\207\034\251C$\350"
+	.ascii	"\246iv\277\315\267\311D\353\340\360\362\350\315j65\036\032V\215"
+	.ascii	"\237\267YM\340i-=\273\337\347\373,\266\214\032f[\365g\275EJC"
+	.ascii	"/\354\213\317\373\254\227\37123\363u\242cY][\013\336}\233z\317"
+	.string	"\213:eC\257N=\207&%m\330\324B\260\344\220\330\327Z\253\265\367<\355\375\333\n\275\275\224\251\337\327\226\367\345uj40\312\364 z\227\267\251\351\240\\i\"\274\351\3241\304X\221\t\213\024,n\254\214\274i\232\346y\337\247\225\376yY\255X\177\366yI4\032\r\2755\276\tE\223\336\346\275;B\\\250&\274\364\017\204\256\320\fz\n\237\320\037X\230\204\234p\356\002\347\241\303\033\273\361QS\325\375\355\f\2660R\257Hc\244N\001\f\002\372\261?\322\247\322>_\312\\E\204D\352\251\0378\233\3500[kt\360\334\003:\246T\351\333\362\266|\242[mtZG\267\346\351\324pl?\312\200'\023\245\022\003\017\217\2765M'\353D\373\372\372\372\352\023%\255\250]\360\377\205f\013\315E\315a\370BOQ\037\344\205\246\242\177\203\341/l\241\251\272\n\bi\241\247\032\350,E\273\352\220\324`\255"
+	.string	"e\265g}\261\355\330\372f\030\251\221;{r,*\334\3304\215\f\313\013\310\213\356\352\b\004V\362\217\300F\275\242\222>\372\362\274\201p\241`\255\225Z02\266=!I\217N4\333Y\227\221\241\013\205d\004+R\\\3372\220^\351\330@j\317[\250v\233\221CM\227h\034fv<~\242\250\221+W\256\301\255y\363m\233\332\355\214\236\030\277\274\317\273|Q\241\231\203^\030\251\251\202\\%\304\347\214\242\307\344p!\303\341\301\256\345U:^\351\3307/\275\267\336;\342\214\371\322{\315{\317j\255\265\345\275#\372\265\326[k\255\265\326Zk\255\265\366\266\336{-3\007\277\361\026\207\217x\326\266\304kx\004,D\026ol'nmJ\372\211\346x\"\226U_\376\211\332A\003\347X\243\372k\016\016\313\001\r\315\365D\315\375\244\346:N\252\342*.2\251\251\376{\321\344.O\021\361"
+	.string	"\320\355\037\357\275\366EWz\226\304\241\021\311q\215\031\003p\003W:\326\254+\035\3115)\332lL\n\220\242\n\332#F\024\256\203y\201>QC\265\032\001\252Ew\205c\330\347\342\273\373\032\236x\245cP\357\335k%\034k\222\246\253\374\200\237\317\303\037\2464\310_\212\336P\222\247F\301\tz\346d\207\013\t\027p\373\324Zl\214\t\023\360\2664L\332\034:\324\212t\320\314t\234\241\251\376\"=W\225\221\031z\252\004\255c\206\r\030\361\001\002\330\277\3764M.-2\254\337o\242]\310\361\341%\b\272P\020z\f\3018\037\257\2576k\0176\fk\265ei\313_\350\243t\344\337\227\372\376\303/\3615\322\035xs\334\200_*\357\227\2144+\315\236<("
+	.string	"\374\266e\261\311\004\201\324\250\001E\207\314\314\210\214H\222$Y\016\001\005DI\207\230\263\272\001\022 %E\n[Il$I\352\354\317f\200\004\224A\305\275k\312O\256I\214{\222P`\266Be\361\215j\3706J\263\322'v\311\333\232G$\366\256\273x8\f\243\313(\023\263\255\340\251\245\350"
+	.string	"\213\340R\310I\f\252u\354\337\366]\013\327Q\331\260\n\027\027%\025\031\016{\361\266\217\277\007\263\262\030\373a^\3503\324>\231\210U`:\204]U{\311\244\341;\364\b\242\367\331\225\325\221\272k\202x\247Kx\200\023\233\242\240\0179\305M\224\2343\274J\220<C \2626Z\021\240\203\375\252\334!M\323H\271\002S\266\006o\314\317\006\344\332\320\226\314\250\364N\f\234E`\376\3137\016\003g\255\006Q\243\317H\263\364\006t\377\355\257\2624!\367ZF\363\276I\334l\250*\024V-\272\232\214;\306u\t\335\253dL\333-?v\213\205\335Yz\301l\205X\360\350\013!"
+	.string	"\261*\371\244\020@\217l\201\371\2206\007&\215|\013\313p\253\341\024\271\220D$\255\240\306\226\335{\356\364Y\275\251\345K\246\201uU\356y\001\351\327\364\264\353R\314\215\266\336CG\260\325>]\251\033\243\350\376\347.\314:m8\306x\"\211~?kv\314\337\030{\003\370\347\265N\035\233b\033\023i!~_\350\214\373\321H\276\240M\\~\325\355\021baI\373\r#y`\017\343c\030\352f\242\301\260j\023\241u\242v\241\350"
+	.ascii	"DD\262\217\233~\354:$\212\220\265\263\325B\324\322\364{\224r"
+	.ascii	"\371\360\217L\013\347m\214@lD\243|\"\316\213\220}f9\306k\223"
+	.ascii	"24Xg\215\347gT\240\323\3153\250|,\364\363\244(\320\260\303\324"
+	.ascii	")\020\016`\346\372\"\341\t\300?\357\214\3212>9\2568\036p-Q\027"
+	.ascii	"\202aD\300\265\324]r\b\213\013"
+	.string	"\274\273\353q\2740z\210\007G)\314l\334e0\251}\031~[\342\343\021\214\223\366S~\333BkVY3B\201:\325\251\200\rO\306\212\326\340\004\214\303\333g\342<\235%A&\225`xk\307\217\0053%h\005\300'\310g\232\353G\270\335{\272s\273\353t\347v\262\331E\220\314o#\246\275_V\\!\306\034\333.rp\241R9\266^\217;\344\2445[P\373\007Y\221\230C\203L\026\373\275\020\034\210\021%k\315\303\374\204zd\341,\357;\206\3216\030\250\277\331h\312O\227\332Y\273F\300\347\306\344I,\353;\247k\005(&l\375\352o\032O(\311L\355\215\212\265\025\201]\2272:\255\364\345\030v\201L\357\034\037K\335\201\237\353\207e\313\253!X\240%Y\354\300+\250t\331\320\276)\327\251\320D\237\334\214\217\2158\030\306\363\226\343\273\313\372w\343\264\240XE*\335\220KI\2323\244"
+	.string	"\030\352\274\230\177\306\227U\306\322KhL1\354\344\314p)+$TD$\331\270\367"
+	.ascii	"\222\351\002Z*\256\026O{z\013~\233\274\027\016\030\216\374\315"
+	.ascii	"6\fs\235\255\035x\254$\031\302b%\311\020\026f\f\364\317R"
+	.ascii	"\360k\255\265\223\031}\201\255\301;4\330\3400\322 \302n)\316"
+	.ascii	"G&\363wy\016\212\203\361\204ZMk\317\n:Q\352\362\021j\3209| \001"
+	.ascii	"!\003\206)\033\202'\201hs\342@\3645\221\034\370k<\355Y\214\366"
+	.ascii	"G\364\017q\202\\\300<\005\001S\021\270\232\017M"
+	.text
+	.section	.gnu.lto_.jmpfuncs.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`C\n}\032"
+	.string	"F_]> q\222t\237Y\013\247@\216~\363\340\207@\307\360\017H\004\300w\200;\225c\325\326\337\326#"
+	.string	"\006 \304\nd\n\026e\3605\210\375\300]?s\242\357F\312\373#6\277\265\244\021\"\223\fF"
+	.string	"H"
+	.string	"N"
+	.string	"\3441@\001\341\325\214\303\230c\246\214V\362\005\227<\315\002Z\005\326\230\322[\351\261\r\371\341\351\235\264M\271\236\225|\177 Z\347\247,\304Yh\262*\235\3656\337\325\351\261\236\364\335\244\307^\247\027\341_\024\341F%_\207V\005\223\264\257\001\241OJ\234H\352\257O|\341Z3UUU\037\212\2428\0345\255\347\276\346D\263E\353\322.o\342\316kHJ\257A\217\244\367"
+	.string	"\320\316\3261\336-:\326\210\301\345\317HS\357\352\237\205\364\216\2611\036f\036\325R\016\303\305/\372\341\226\251\234\305\212\2439\365\306\317%:\345#\355G\264t\020\230Ny\353\020\235\276,\224\2058)Vq\0318\t\236\206\333\320=\034q\246\215v\264H\317\245\364\321\260\004\230\035\272\2676\212\373\221\271\031E\001L\260\210\366\351\225\323\203\236Ior\320\313TG\b\330\250FQ\350\"9Pr\253\252f\371\304\300\204\256FN&#\344Mc\221R\245Vz\353\013|\243u\255A8\032J\216\326\031\207\260\027\3662H\307\236A:ZK\022"
+	.ascii	"\355he\003J\006\361hSB?\200\332\250\221AS3\244IJ\033s`\002\021"
+	.ascii	"\"\253\342\006\022\300\022\021\205\2418\211A\247\024\233\021"
+	.ascii	"\t\022$)*(\251\244\003\267\221\360,\331\200\030\037\304\352Z"
+	.ascii	"K\357\306\t\bluc\245\r\263\205\306\324\017\242\232m\272\274\276"
+	.ascii	"\224\3557'\027\377\0230\003\325lQ\273:U\371'\207\377;\277\370"
+	.ascii	"\224\345\375#\267\033\207\252\351\030htv\261\260\217H\025#R\177"
+	.ascii	"D\"\206\024\240\337Y\341\001HW\021\325@.C\342\330\266\362.I\241"
+	.ascii	"b\226Y&b\277\362\231w\004\356\230\211\016\267\2648\363\314\347"
+	.ascii	"\350\007n\226T\276;\224\211\214\214\225_\3471A\3120\331Y\362"
+	.ascii	"Y\333\367\024=\302u\037\b\316K\202\315\234\321g\033\022\201D"
+	.ascii	"| \232\2106n\367\006\311\b\336\336v\203=\007;\204\277\303\202"
+	.ascii	"P[s\347\325\3549\232\265\273\023\315\250<^K\301\\4a\3615\243"
+	.ascii	"\032y\201\"Y\261\332\016W\030[KaT\361\215\221\304\265\344D=r"
+	.ascii	"&\271\206\230\272\247i\023\241\204|\341\n\235ckAu;%I\327\013"
+	.ascii	"\317)3@\331\373.5`\311Z?\206\305\347\271\f\301\020\231i<\333"
+	.ascii	"\375Q\371,\373\272:\325\265\203\251\310+Nf\2464\006\370\320\344"
+	.ascii	"8\027\231E\022_\267\252\376\301\033;\355I!\206\245I\215\t%D\246"
+	.ascii	"\bF\276\203D\362\307z\206z\003\312\352\217\006m\250\276\200\355"
+	.ascii	"\004\226#\257P\304\317\216\020GK\363\034\n\263\205\2113@\002"
+	.ascii	"\220\033\361\240\035m/\fQ\002\b\033\237lQ\304+\374\031;\200\204"
+	.ascii	"\372@\006]*\370t>\375\322\261\245\351\303} \b_\201)\375\006\366"
+	.ascii	"\037\363\335\2617\244\350\204;\312%\203\251\243$\270\224,\177"
+	.ascii	"L\013\272i\224B\\\\@\006"
+	.text
+	.section	.gnu.lto_.pureconst.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375 M5\002"
+	.string	"\322\204\020\033\220E\351\377\307(q&{wwy3\3639\354\333\377\205}l\377\353-\366\376\035\0230\253\0335\247+\335\242\005\320\\\363y\340\314f2s\231\312M.r\217k\314\212K\314\276\303\025f\267\356.\020"
+	.text
+	.section	.gnu.lto_.ipa_modref.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\"\003m\020"
+	.string	"\326\027N<@k\223th\260 \375$\243a\331\242\362\322ax\262\372Su+\346\332W\244\001\3028\024\345\302\243\220\242\rc\336e\263#\n\312\250(\027\313\235Q+5\343\321AZk\215l\231\0028"
+	.string	">"
+	.string	"<"
+	.string	"\227J\006"
+	.string	"B\336\213\025\344\202\314\037lQg\b\033+\357\271\212\334\332\212X\f2\2478N\366\020~\335;Ev*\373u"
+	.string	"m \216\354\375\310r\254(\262'G\336i\001\260\032\t\t\241\273.\331\232\003q\207\304V\006\265\326\226\350\371\226\327(y\204|mJoF\276&\305{\334\212\304\n\313HH5xD\013\031\"\203P\322L\331\232\224i\340X"
+	.string	"L^\214\f\261\252<\\Q\363\267\326\314m\377\275\276W\315mn\221\271F\324\021u\\\301yn\215H\372\266\366\320F\362\236\023\271}\210\350\200\241\272ra\022B\311\302H\b\267&\344\343637\fO\227\t\263q\211\2360\033\227\347L\360\3053\001\211#8 \340\343\372\220\211\335\340Qq\2101\306\352[\251\313[\221\0173`\221\210-@\261\374\223\244\220\227J\002\216BR\311\364L\2158\007<qa\n\021g\2501\275R\350J\222\024\026*\303\001p\002!\"2;\021\020U\247\2144\226\302\036\007)0\020;j\033[40\302\247\243\221l\333\377/\016\213\213?\230\364\367\351\2510@\260{\262|Ip\202\022 \332\245\001\331\026\256\211\355a\005\227\037\026\217\374\341\374\224\001@~!\341\265;\372\023e\336I\205\"\2513\033\021\"\243S\202=\213\262\340\345Q\003\330\002"
+	.string	"\f\367f\025\205\257\3006\370\306Ad`\025\325\321\033\027\252+\200\224\241\017\221j\f\026\340\\\241\004\331\200H\372\217&\350[\342"
+	.ascii	"9\332Q\322f<p\250\037'Sh\362\3371]\034mLH\314K\323\017D\300\210"
+	.ascii	"\304)w\374\264\231\003y\346\215l\274\345\006h\265\225;\266\022"
+	.ascii	"\356\344\342\344\003"
+	.text
+	.section	.gnu.lto_.lto.772e92aefa2ed4c8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetMspPort.21.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\027\001\r\r"
+	.string	"F\231ZC q\223\016\214\314a\004\006\310\2272TC\367\016\245;\276\002\f\276\f\032\250\2154\021\270\260oQ\206\2544A!R\344l\315~S`\337;@\321\270rs '\235\206T\377\316\023\221\2435\273\211\224)\005C"
+	.string	"F"
+	.string	"G"
+	.string	"\366[\356\242{)\345\004vI03v?\005\026\331\034\372{H\346ps\220\314\241;\373\306\277\023\333AyxA\355\356\245&\336=;\377\246\177x,\242\247\306\301\356:=\026\021\267\336v\002\333\024\354\207\b++F\231\262?Qj\t\373\325\356\256\225d?m\335\345\327\374\373\341K\277V\351\007\020\240\243\200\214]\020)\036{\2024T\330\276e\273J{\001\203\356.\241\177\bF\304\264\304<\310\217\203\201\001\333\301\364\241\363\fi\307\013y\357\232(z\234F*\262F\355\317c\204*\224v@\2651\034\006\266\331\335\006\376\213\rY\210\215\024)\231\303N\211\005\t\225LY\223G\33552\"\267\324\3364\344=\337t\t9N+*\362[\\\325Rg!\215\213XD\211$'\334g\202\205\250yN6\020"
+	.string	"\\\334b\204\214\204\3232\b\240\r\343\330d\004\305\363\321\342V\002\332\260+\303\307\203]&\332v\215\034p\006\212\332\305e\231vY\337\276Z%\031\246N*:\362\325.9\214\247z\361pp\002\025"
+	.string	"5\003\220\347\214w\201e\342\t^4\270"
+	.ascii	"\200\314g\025\f\243\322az\267bM\260\320X\250\256\001\307a\030"
+	.ascii	"\334\001\313@\211`D\200\2122\356\360\242\235d"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.22.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\346\004m\""
+	.string	"\212@\034\016J\200\030R:\273PG\356zWN\332\2741b\236:j\377\337~\301C\231J\357\2079\205\206\301#\031\235\315\332\260\2459\355FI=\232W\021\307sp,\037\027\253d\177\324\374p\027\224\314Q\312K\236\322j\377'\204\020\271\223\f\320"
+	.string	"\301"
+	.string	"\317"
+	.string	"Vi\311\264\f/\3027r1\316\205)9\301\230\320\\\"\236\331h`{\372\0239\223s\n\026"
+	.string	"\277d\262\335\037\2533\213\030d{\312O\036\fxe\213\337\250\030\267\2513\251\347\275\313\003O\371\200\355)/\237\243>\265\035G}\312@f/_j\3357_\b\303\322\356\275\273\326\3019\013<.w[\325\024m\013\344\003(k\242!)\006\217CW\250\251\036\307\022\303\210\n\221y\222\235\351ds*U\215\337V\032W\321"
+	.ascii	"gW\274"
+	.string	"tE!*\340\352F\222\\1\312\246k\226\361\013\026\225\325Q\024\307J\211\026]\021\nE\240\245\313x\261[b\361\311\366\231G\201TmI\252aQ\325\270]\033\334{\331\016\213Tg\2323\363\0273\227`F\223\001\367\006A\361p\373\342\374\"\373\023%\365\251\355\224\251D\210\222\357D\351Gk\310\314,\336\304C\201-\367^\241%g\002\202\317\343)\207 \262\037>\345\023\251Ou\332f\031\316\320\365\373bO\217Uc\204g\232\354Z;\313\240\212\315:\373\363Tf\023E\366\303\234\266O\256\245\332\363\251\203\314\313\240m$\363\205\264\310x\341\306\301\374\343\323\363#g\2367\317;\017;\353\344\334\330\350\276<\327\244\226iR\313\271\3242N\265l\303Y^o\226U\325rj\263\214^y\356\325\262U-\037\250&y\274\312\0326\332\362N\255\225\271f)\231\217\037\371\233\177\330\257\374\227\314w\362\307\216\250"
+	.string	"\n.\357\024\206el\300\332z\247u\270\200]\366C\006\342i[30:\205g\bX4y\236\212\3406\315\f\f\002\024b?\344\351\217\035\227\354z\252=\243:\310<&u<S\227\324\235\276\031\032\023\314\231"
+	.string	"\313\007\202\251} \021U\355\335\371\016\324'\371\332\314C\017\354\207;\215#\343\0329\302\315$\254\335a\216[\312&\273\366\373\225\tB\374*\267B\001\255pA\375\360\202\372T\355{\341B\206v\332\027\236\341\f\247\262\301v\357S\020\177\212\b\0166\036-\324\247hw\232T\230#\230\362.\250\300\330\2216\322L\313\325\3616\026\377L\252\256\177\372\203U\223\250\243\223]\273U\226\021\303\005m$\247Pm\373\232]\236,\031f\356\360()R\246\222\257\033K\276\037\317\210\207\202\247\341\304\257\210\003\t\236\217\350D\022\016R\222\321\372\363\365,\340V\360H\034I\270\231(*q\324\033\372\371zH8\036\221"
+	.string	"\005Q\221\217\227\024\002)\311hwTDd\264\033\341K\332%\350\341\036\022\317\267\373\365z\276]ny\3378\030\365z\252=\233\332\351\211c\036\367\344bbs\232\321[\267M\023\317\274-\f\227\322\362\231TFo7\255S\241\322\364P\256qM\323\326\214\260\312\346\032\315\"\034\"\3456\215\3533?\200)\326DsB\371\321{\357\3155\222\267\204\316\325\247\031\265\351n\"\243k\315"
+	.string	"+\241\023\375\351\233&2\377\326H\376\330Q\257\034jO3\232\352\272\246\211I\316\f\334\362\201@\305\354\251\203k#\313\256\353\236\376`\fV\2501\034\205\214\202F!ddD*\030\321\266\030`\002\031J\326\r\020p8\232\244\220a\f\013$d\302\301\371A\304`\376\022\346\025c\214\335\247t\203\233e%\027\324\004|\215\320`\002f\002\343\2207\311\f\317#;B\342\346\301\307*ltU\325i\302(\037\233\371\357\233\367\215\026Q\013\352\375\034\270\267"
+	.ascii	"\026m\265\341y\270[\255\017\217;m\007z.\262o\333\003\241\201"
+	.ascii	"\325\304\027\024\002\334\261$_\206\006\211\256\311\324\372L+"
+	.ascii	"\204\206\257\200\264\226\202\245\320\365Y\277\276\315\351v\t"
+	.ascii	"\223\234`\022j.\233\344\031\361c\037HB\030*\376s\315\331\035"
+	.ascii	"\242\242\321[,\207\210\007ec<~\300\t;F\r"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.23.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`G\002\255\023"
+	.string	"\326\244\201I\320\322(\035\322\2005\373\302\314\354\250\037\\'\225\220`\361O\226\204\264\254\203\332\347\243\034\026\f\006ta\244\227\275\0010\002l\004\227;\205\367+\030\304_m\034\240\304\023\230m\001V\2253H?gl\036\210\020\262\211\334)\005j"
+	.string	"f"
+	.string	"p"
+	.string	"(\341\247\307\023\370>\303\017\370>-\263\227>\362\354u*hvAv\027\245#\254\367\306\373\223\262\203\337\364T\312\374\237\037\bad\273\315\016z'\273kr\243\361\026\320\344G\202\002\347\363\346\236\247\242t\3131\271m\360N\037\226r|wYs\253I}\356\tt\220l7\234K\220ew-m7\017wx\3336\266[l\031!;S\305\331\343L~w\327\272c\237\356\363\207\017\272\301\003\335:\245\245'}"
+	.ascii	"\240\215\215\002F\273\034\232\206l\322\244a\342A?\220}\235\277"
+	.ascii	"\013\202\371\316t\030\251\241\365\260\204\037\375\234O\237f\320"
+	.ascii	"@v\240\230pO\200C\272\025>vG\224O\257\204\237?\331\276\264\337"
+	.ascii	"s\026\262\373h\270\200\335\035%\242\335Q\201\003"
+	.string	"vJ\365\025I\232\321\231Kd\250\366\004\226\274\315&-\210$\325t\346\034\020\0207<\3059T\251\242\216GM2\331\246\360\031\027\300\242\243\025\031\255\222\331Q\n\030\217\001\363}J\005\213\216\204\370\370C0\bv\330lg\370\213\226\n\317\356:\020\272\013\227_\342\323\026`\362\266O\037\366}\202*q\330pT\257\337}\022\351\350\240)\"#\233t71\321\325\362\202AX\305R.,\227\227\224\352\004\303\312\345\345ALt\275Fb\242\253\205\304\252\224\n)\226\270\202Ix\301Z\250\027V\252\205R\2110T\212\001\273^+\021\025s\271D\324i\334\353\216\375\363P\350&IFi\240\342\034 g\236t\222\220\256Q\271\244\353Q\223L\367>\3059\346S=\351s\237?t\220fD\320d\223\234'R\356]\343C9\250\001- 0\002\204\034\273y\315\3707\2064\264_\363\b$\310M\335\3674\033|\t"
+	.ascii	"\341r\301T\030\271\007\205\340v\t\301\267\264\267\001\263\216"
+	.ascii	"\351^@\226\030B\224\023#\030=\300(\332\n\2255\034:\026\340\315"
+	.ascii	"\233\353\016U\266R\252-\205\bV\tb'l\305\031\306h\206\323\257"
+	.ascii	"]\212E\270\203\252s\375[\317\346>\332\253\256\270\323R2"
+	.text
+	.section	.gnu.lto_mspSerialReleaseSharedTelemetryPorts.24.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\\\002m\023"
+	.string	"\026\244~H\340\322&\035S\367Fh`\335z\326\to';\022S\032Y\r\017\220\334f\226~\366\227\272\224\212J\362\213:\266\266V?\233T\265U\244\260\270\0061\2242\036\"\210\352\326\355\343\341\f5\fB\004\001~B\310&r\247\024h"
+	.string	"d"
+	.string	"n"
+	.string	"H\2735\223O\233\200\237\017\375\262\215^\323\331\333\204f~\224v\327\244\"\254\357j\267'_\377\274\331\251|\371;7\360\341h\224\301\376u\"\273\033\"\233\351\020\304\244\007"
+	.string	"\305\315g\207w]\t\322\215G\210LC7RSb\274\355\222F\026#\365\264\227\340$\215\262\233\313\317\301\356Z\2162\0167x\3336\266\037\330\262%\327\333>\207pr3K02\247\273\013S\235\3315\230\374j\216\035\336\247\347\356\246\264v\322R\245\037"
+	.string	"L\342\311Ar\264[\223\373\261E\223\310\304}\376\236K\373\366Y\3706\207\257\275\305\353>._\231\r 4\261\031(\340\247k\037\361>\301\027\360>\355\363\3704\207\237\tP^\357y\001\367\304\027d\223\021_\212\"\031\2059D\252\332\250\t\362\243\033\204\210Q\230\355\324\211.\2047\234\322mH5\274\341z\320\274T\303\206\247\323\231[<\251\242MG\214\364a\233\302\205Z\276\033N\305\356.\210\241\022"
+	.ascii	"\273\241\024t\030.\336\247\324\357\206[A\363_\270\034\3001\332"
+	.ascii	"\316p \225\002\235\335e\360s\027+\237\304\247-\264\344\307O\277"
+	.ascii	"\245\322\306x\323i.q%\201\325\212\200r\235VR+,'\025\021\f\250"
+	.ascii	"\025\026\b.q\305\002\261\312I\205SJD\265RX-\225\211%uR\231T\304"
+	.ascii	"\226\351\204\304+\026J4\271V+\321\024\326\366_\315\3319\b\264"
+	.ascii	"S\004\243\261Og\036\340a\206:GH\323H\243w\273\273\236\316\374"
+	.ascii	"\342u\032\352i\237;p\222d@\304dNN\002R\356M\30339\250v\312)."
+	.ascii	" P\002Q\312\252<\317\030\322xK\nm\255!+j\337\263\361\220\210"
+	.ascii	"\005:\364\241\031(+ou\331\025\252\300\257\327\314\353\241\035"
+	.ascii	":\346Mn\031\336I\2018\2065\210\327\005\303\t\0340\224C1\006["
+	.ascii	")4j,\350\315\317\365\0163\325He\203\2120\210\247-\362\2363I\306"
+	.ascii	"sE\220\031\216\033\330A\345\271\276[\231{i\257:\305\235\366\221"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.25.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`(\036\375["
+	.ascii	"\232\215l\037Q@P\322\351_6\332\272\372\336\344\315m\210\0045"
+	.ascii	"\0054\267\315*z\352\357pJC\301\2155\223\317\\)u\301\353\247\344"
+	.ascii	"\232l\216D\231\221/:B\273<6.\24436.\244\373\203\020!D\007\345"
+	.ascii	"L\n\212\252\b8\262\221\242&B\244\334;\245\224\002\324\001\310"
+	.ascii	"\001\355\001\316#\256\363O\352\354s\235E\244\316=\327\231\347"
+	.ascii	"\347\\\264\316;?g\035\353\234s\235qR\347\020\327\371&u\266\271"
+	.ascii	"\316\304\353\\c\235AXg\232\353<c\235?\\g\017\327Y\306:\017\255"
+	.ascii	"\263\360\347\034\264\316\300\353\374\273\316\367:\333\353\254"
+	.ascii	"Z\347\324:\277\352\334\255\243\261\244@\277\364<\327uGt\207u"
+	.ascii	"Ne\373b\346\3562f\3413\177\300,d\346\324\233,\3313kT\335\bJ\356"
+	.ascii	"\314=\326J>h\247\007M\263\256]yR\326\225\354\210\215~\2552Y\333"
+	.ascii	"\330V\177]c[efNb\372\200\235\232L\310\216\033u\247<\203\256+"
+	.ascii	"\231\361Wh\247fZRJBq\302\210td\302\250\210hH\250D\020\020\211"
+	.ascii	"\021?>\"zx\212;:98!nl\2105 hf>x\220\031\n\203\300\337\265j\372"
+	.ascii	"\356\304\035\254zj\246%\245\274-\236\204\002\317O\030\345\032"
+	.ascii	")K\0239?\212s\023FEX\2568\321\220\025\027*\261\326Ajk\016D\""
+	.ascii	"J\232\2170C\363\037\237\333$\"\206%\336\303\303D\211\027w\222"
+	.ascii	"\264\016\f`TI<\347\007'\004\363\313o\350\250\232.\270\315m\""
+	.ascii	"\266\220\372\200Q\021\361\232\264(\013\356\252\313\372\207\216"
+	.ascii	"\212Gj3\003W^\203Q\rq\020o4k3i\037\204h\261\360\036`\220\371"
+	.ascii	"\032\022\021\002\351-\252\037A>\030\364\003\330P\\\372\247\362"
+	.ascii	"0roS\002K\035_\2542X\205\303\332x\265\r\341\237-\252\036\257"
+	.ascii	"\256\320\2222\266\267e\305\243S:*.\251\317\272\256\315\244]\204"
+	.ascii	"*)\177\033\356\340\336\236P\234c^Y\275E\345\343\206M\303\224"
+	.ascii	"\360\026\254\212\222\361\333\264\256+\373T\225Us\212fNi\230y"
+	.ascii	"\211Y\307-hX\206\022X\346\b\274\207\004mP\267\352 \025\341\t"
+	.ascii	"\354X.Z\360\022\330\257Xxy\025\223\312\216\233KGE\255\207hK\346"
+	.ascii	"\202\277d\244\325\241\266\327D\2640\340/\373\363V0\242\365\363"
+	.ascii	"\034O\246(\2370\373\232\210\366\343\376\022\206e\246\300\245"
+	.ascii	"`\b\255\316\240k\016\205\354\001\322\2351u\350\240\325\234\f"
+	.ascii	"\225X\231\215\262\257V:9\302\016\334|\254\326\311\034"
+	.string	"E\326u\314\324\262\207\227\027\237z\037w\230f\216\321Ph\3222\313\350\034\222\300\247(\223\373h\231g4\230\343\315\235\322\007\325k\264\256`\t\331\236\372Kn/E!\300\024\3040\365j\254\254\321\245\277d\240N\332\027?\264\003\211\031\236\224\217\341\216\241[\024\201zyr>f\262\247\0262\022\344\354\363\270\271\f\207\340q\333 \314\341\303\216\273\206 _\0357\r\300\2749\356\031~W\342\270\263\\\346\025n,V\210\033\267\025U\311\203\nw[\0327\205\233\355\235k\334Og\237Zoh\025I\343\216\322\215\264\255\376\030X\265\346\306\230+\n+QCa\346.\277u}\352\254.N\\qpm\361\262\256+\221\330\232\345}\314|A?A\376\326uM\301\355\004\004(\006?\"\255r{`[\355'\262CH\226\022'\224G\231\311\236\372\243\321h\233\377\222\271?\032\215\266\361w17Y\367\213vv\027"
+	.string	"tn\002:\017"
+	.string	"tv\301\316-\2563\013\353,\200u^a\235\003\270\316*Rg"
+	.ascii	"\256s\212\324\231\351:/\375\234\225\254s\322\317\031\205u>q\235"
+	.ascii	"\215\2513\322u>J\235MXg#\353\\t\235\211\256\363\320u\026\262"
+	.ascii	"\316%\254s\220u\006\272\316$n\336S8\357s\343\237\370\346C|\332"
+	.ascii	"\246\354\203\212\341\320\344\315\247\300s\332|_%\221S\366\021"
+	.ascii	"\303\324<Q\257\346U\263\270\t\034\314\027\0207\320<\b.G\232\007"
+	.ascii	"\206\301\301\365p\355\313\317\026d\221\253JN\364\307\t>2\215"
+	.ascii	"\264wm\"^\374\214]r\346o\024\225\267\036\256M\351\371%7\r\310"
+	.ascii	"\"\327\032S\217\347\227\374\341\207\337[fxt\037^\030\246\266"
+	.ascii	"\347\3640'\363\036\262\310\274j\246\326\264\300\341\260\f\337"
+	.ascii	"\274H\013\177\350v|`X\224=g\225n&\335:\326\214\024\177\311\256"
+	.ascii	"\323WZiLN\273\265\213\027\201\331\305\267!\205X\340\001\345\321"
+	.ascii	"t\347\227\356>\356r\350|\027\360_\013\310\227\231\r8\264\fG\031"
+	.ascii	"\316\230\006\370\224$\016M\240z\301g>\300\237\bp\231\002\363"
+	.ascii	"\373\340\267\030\363\211\262\017\370\314\t\270\332\261'\345\233"
+	.ascii	"\002s\037\370\315\374\212*\373\322#R\254r\322\220[}L\234_2\024"
+	.ascii	"\344\026\037S\317\t\f \266\035\240z]e\305,\304/YU\201U\347\\"
+	.ascii	"Fn\334D;i\177\337vfx\nx\331\357/\233\230\246\323\206,\fS\317"
+	.ascii	"\276=a\021\223\366~\203\231ea^\300\225\370\030\b\320\006p\332"
+	.ascii	"\001\333\352\375.k!\250\034\300\240\276j\372h\323\037"
+	.string	"\302\342\262\337L\252o?=S\236 \303\221$\325W\313n\330s\276xf\356\300\217$y\356\326uU\301\374\200\213A\320\352\215\021\017H\372`\307\240\273\236\002\323G\373\237\276\032\207#+\312\243\314<\303\277\216\377@\260\033\232N\031z\230\226\004D\013y\314\255&\246i\321\004\351!vP\025\232\230\326c\346\227>\232\005-\314\256\026Z}X\201\035+\312\222\375\n\n\327\323.\0059\250\224\036\242\361y\370\345\bZpP\252&\242}\221i nnB\023\0032\232\203\0324\030\330\300\006\362\262\f\244\fb\\Pc\206\r\030\033\330@\0325\270 \006\322(\243\206\r#R\221il0\243\206\221\003\0324j\030\205dk\247\353w\261\305\033{\362\374u;\331:\350\223\347s;\331\026\334\342\271\t\352\243\326u]\231\354\272\334\226\034\217\206\256*J,\350X\374\225\252\322\334\322C6\267\244\274\271\256'\024\205"
+	.string	"\277\"\213"
+	.string	"/\024{6\235:\036\016\313\212\267"
+	.string	"~\205\3331\200\007\212\2555U\2641="
+	.string	"*R<"
+	.ascii	"l)\230\276\257\240\334\261\235@\352\274f\362:j\274nj\222R\f2"
+	.ascii	"\376\322\221\222\376\275\272\222\254\025\257\234@\227\242\024"
+	.ascii	"\343\320\230,\275\260\313IS)\206\242\232\023&J/\224:\333s&}\223"
+	.ascii	"c1n\n\f\212O\372.c\202\203\342\273I\033u\235\035\035\355\t\347"
+	.ascii	"\211\277RM\232\3061\023\217d<z\244\346\221\211\357\253%Qe\237"
+	.ascii	"\327#\371\027\214^\254\350\215\036\254\350\201a\321\246\226\036"
+	.ascii	">u0\361Ev\200\032\275\013b\240EDD\210\376F\211i\016\275\227\320"
+	.ascii	"\017\275\020\241W\315\302\320\365\360\371FT\367*\350\r\225\370"
+	.ascii	"\240\357:\226xa\230\323\013\277\365)\004\275\026\320\007}\220"
+	.ascii	"#\320\003\303\272\3549I\374\217\021O\342{$G\374w\351\361\363"
+	.ascii	"X=\357\363#\342}\376JD\317\367\225\0229e\237\334\363\210PP\327"
+	.ascii	"5\323\030\240\236\353\001\006x\253\022O\204,J\320\316\377W\026"
+	.ascii	"\222\247\262c\352\361<\263\001OB\222\357\310\353H\362\274\260"
+	.ascii	"N\313\236\263\370SH>\204\342\013\315\2644\235;\217C\347w\276"
+	.ascii	"\307\306\236\312>\240\227\252\223\203\222@\300\35285\377\t\201"
+	.ascii	"_A\200:%\321i'%\266U\235o\263\026\342\222k:G\374\222o\037m"
+	.ascii	"\016\3371\347oT\226\246\023\347uH\336\234M\201\361q\233\017\361"
+	.ascii	"\314\004\024\020\2023\250\222p=\320R\244JFD\222\202$Y\306\222"
+	.ascii	"\f\2101R:+\327\003\022\240\002-\206t \350 \"\221\314\215\224"
+	.ascii	"\224\244\r\217\304J\206\324\201l\375\006x\213\205\254V]h&5\223"
+	.ascii	"\253\266\210\022EN\003i\036kR\253g\314g|\307J\264\316@\241\017"
+	.ascii	"\222A_\213T\365\267&7\252T\245\256\013\364\317\243v\277@\b\003"
+	.ascii	"\303\232\364\254\211\370H\036\264\266\f\265H2~\205\262\\\213"
+	.ascii	"\264\320\205\376\254\001\367]\351\220$\203\217\276\002\361L\032"
+	.ascii	"5\344\355\333\350:\026x\"d\004\f\245]{t\366A\215\020\365\275"
+	.ascii	"\311&\310=\343\n\331\361\232\240s\355\237@GTCV\243\264\373Z\211"
+	.ascii	"R\326r\302\235\207\351J\254\3669.aIG\026\213M\300\3211CG\227"
+	.ascii	"\177!35\001#q\254\333\343R\221\252\324\372F\b\005\261v6</i\273"
+	.ascii	"kt\036\177\261\323XT<\357\002\275\207\322\3139w\023\342\007\307"
+	.ascii	"\264.{PZ[\341X\362\\\033\300\265I2[G-\336u\313\305\315;2I\025"
+	.ascii	"\302c\321db\033\207\334\334\370\\+\371\220b\242\253'8\001\202"
+	.ascii	"\223\251\262\001+\216cna\310\201\024\274a\303F\354>\361\001\\"
+	.ascii	"\323\f,\356\001|\016\373x5\317\346\004\006x\253\347\355\2561"
+	.ascii	"\321\220\2122\007\241\233\001\005\\\375\246\300\202\013|\020"
+	.ascii	")o~qd\354\327\336T\205\353X\250\374yu\247m\236L\333\206\372\351"
+	.ascii	"/\330\360\217\231\375\006\312\275\367\361\177\213\314\367\277"
+	.ascii	"\304c\327|eA\356\235,\037\022\312U(\204ZC\324\007i#\274\216\330"
+	.ascii	"]@\"\223\023\007%\363]\227\311P\243ovFo\364_\357}\021\330\223"
+	.ascii	"\363\030QD\00438@Oalx(\013\005\311)\f\343\025,\252q\342\270\340"
+	.ascii	"\270\301\300\3332\257\037\215\221d\254b4\373*:\335w\340\256\213"
+	.ascii	"\330\313s\337*'>0fl\300U\356\343\337;F \227AI\230w\335\301\024"
+	.ascii	"\247\246b5/0\346\305z{O\270\342~9P{@MZd\373\2323\306\224P\357"
+	.ascii	"\374;\272\362\252\255#\374~*\374\205(\262s\236\332t\007\220\365"
+	.ascii	"k\303\355\216\314I\265\226\366}7j\262bG{\206\343\237\026\203"
+	.ascii	"8C\376\221\357\213\263\374C\257A\037XJR\377\026C\004\003\024"
+	.ascii	"\370\262\b2\b\362\347\357\235\367w\354F+6m\277\0217\316\204\330"
+	.ascii	"`\224\013\305\202ofDe\273\2127\201\031z7@JKbp\006\372\226\351"
+	.ascii	"S\343\0049\225\334\004[\212\355\225\321\311\034\316E\250\370"
+	.ascii	"\312>\306_\f\300\250\264n\013\306\013\251Mh^\265\354\033>\212"
+	.ascii	"\216\rC\224#\232\2428q\215M\003\200JS\215\261\357O\032\243A\232"
+	.ascii	"\006\005\306\273m\320\221\240$\274\002lZ\025T\020)\321\360.\255"
+	.ascii	"`\332F\235\002\030\262\3403\"\327\362Ce2\237\r\203\374h&8\254"
+	.ascii	"n8\3218\t\204\224\020-\237\246\021@\037\200\036\205\007seB:}"
+	.ascii	"&\217)\330\033g\311X\b\242\214\204~\377\2426\313\213 \032\007"
+	.ascii	"\252\\\376\220\241Q\255A\342\365-\307\032\233\374\005\267:\346"
+	.ascii	"\360\205\252\343\354\221\324\220x\255\237\2279J\212L/\252\327"
+	.ascii	"[\f\342 \304\314S\260v\310]\331\357E\221b\216Z&\253\313\350;"
+	.ascii	"Z\307EC\002\302\315\250\235\240\2448\020z\226\t\005\333\370J"
+	.ascii	"\177\243\312\030\332\316\017D\002\344\223\343\027\320mWy\312"
+	.ascii	"(cE\246|\375-\356Q\372\323\325A\374\207"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.26.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\203\001\225\017"
+	.string	"\006^iE"
+	.string	"\217*\035\004#\256\n`\033\022\231\036\264@\261\326\033\r\231\006\205\213\256o8\360y\201\251z\0347\240Z\337P\263\231i\215\272iX\021U\325/-~g\210VP\330\356\021l\340\b\007h \237\354-eJ\001V"
+	.string	"S"
+	.string	"T"
+	.string	"\326\350.\017$8\031u0\346\322PP)\251\255\230\023\364\226\2033a\030\206\217\340\035\025u\031WQ\276\347\206\202\365\211\\\306\314\312\345\341\342[EO\214\212\226\327\256\255/\245\021\204\311\367\265G\021\267\025\326gr\3154\230sZY\237\205\233\273m\223\355\005\366m\001\277<\355\216\007\357\325\313\356\003\31089\341\3006\247+d1ad\313\007\333'{c[I|v:\315.\021c\2522\304X\346\234\033V\320]\022\210\253\366G\\\345t0D"
+	.string	"\306T\315* "
+	.string	"\037\200\273\354\236\301]Z\3652\224wNX\t\2269\301\215\217\373\224\231\t\225\306\270\363\270\3352\270\255\220\300\342\234sFoV\227\263\352R\202\341\266\t ]\007?\204\273\334\254\246h\235\214hh\003\337\325\254\351\366B\022\"\245\341\332^V\337.\212\r\212\250'\026\243\302\253\301\346D\365\346\340\255\351N\3733\007\177\356\262\036\241\216\375\230>\020\242\b\244$\001\024\212"
+	.ascii	"\352\f\352t|8H\241\322\203\217\222\310\363\340\370\210<\020\251"
+	.ascii	"\344u\006x\364\021\"y\246\321\210\344m\300\371\030u\277\255\275"
+	.ascii	"\270\360\202\031\331\224\\\024\277\366\256\305\013\266]fc\201"
+	.ascii	"\224\325p\273\333z\355\362\265a9\353\250ru[\266\255\021  \240"
+	.ascii	"\002\241\273\355\3771L\243\371\t0\315|\210\345j\325/\306\340"
+	.ascii	"H\020\013\231\212\362\360\r\247\357\2339\270%\344\226w\336\206"
+	.ascii	"\274\331\bm\030!\2135\214&4ph\204E\324\235\335\320^\236E\266"
+	.ascii	"\230\222\353@\211\230.\361\004"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBufV2OverV1.27.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\311\002\025\026"
+	.string	"\326\350\220J\300.)\035\347\332\t\316\036\342\002\366\333\002\250i`\252\352\221\216\207\210O\350\227,^Xr\355#\361\t\376;\376z\353\257\273\353+b\320\312\236\225\"u\272S\030\260\231\001\307p\247\253\350\020\251\316\253U\037\215\020\262\267\334I\006x"
+	.string	"|"
+	.string	"z"
+	.string	":\230\353\326\f\351\f8e~\207{\330}\250;\307\275<RK\367\236#,R\336\362\371\327x[\336c\274\345\035\363\324O\237K\376<\335\024Y\335{cM\201\311b\261X|=\317\225\356nk\323\035\237\2028\361\013\362n+\351\303\001\322\b\372\352\311\025\025\323\225N\201\301\036\255\030r\336Wz\335@T\361\013\346\234\222\005\356\275L\177A\b\347\361\314,\303\314\t\230\251U'>WT\334<\314\260\217W\307\215~\216\013\375\256\215\237\277F\306\207?\200Vy\2433y!\244\263m\312\265)\367\223\316\324R~"
+	.ascii	"\217'\023)!\356\305)\266\270Q\226\351\302\221\376\244\177\270"
+	.ascii	"\022c$\345Bx\256\333K1\"\bAy\313&\002vG\312\2257\210<\372!Au"
+	.ascii	"\357)r\313\007\230\233\350E\273\033qSu\335\232\tOK\367\336\021"
+	.ascii	"6P\336\206T*43$p\006\032\204Y\375\321\\\251\253\307\00623\213"
+	.ascii	"\234\354W\030\202\252\241WLr\262;:E\312FB\257\336{om\321\356"
+	.ascii	"\332\314\265\007\364?X\207\370\232\307\255\256\375w\367\261n"
+	.ascii	"\262J>\366G\177\207X\264\311P\366\373\325\264\351&Bo\311v+g\306"
+	.ascii	"\333\367\002\342\212>r\362\005{%\367B\261\321(\304\022':\310"
+	.ascii	"\201\370X\340\353\306\333\214F!:\001whh\221\371\344\321\356"
+	.string	"a~4\334\315\305\234\261\230\245i3\033f\366\3222\031Y\203j\242b\332L[\242B\303\335\\\314\031\213y\301&\311\213\254\3056\2731\210\271\321b0-2Z\314\264\335b$ \\\213\231\331b2\265\232-\206q\336\327V\333\006r\255eS\005\"\242h\272\307v\245\211\252X\350\320\2466\247\212\203\216\355\036\326\t\263\032\3268\341\220nt\253\201\377\021N\365\253qB \232\321e\211%\204\352\016\216&\033x\245_\0049 \260\002\0313\362o\214`\264\237(\\\233\026\206\021\230\216^\315\242}\344\n\204\035tN\342G\027)\026\254+\335!\306{\"\200\240\2211\013nF>Fl\025\030\300\210\242i@/\335w1\255\324\320\220O\\\301\240b\336\002\212\001\017!\376\301u)Q6\236\355\326J\032\005\235$\266\226f\2436\260\311\t\276\n\277\354 \220ld\001M\277\355bN$\225)\331\034\370\021\223"
+	.ascii	"\237"
+	.text
+	.section	.gnu.lto_mspSerialSendFrame.28.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`L\0045\032"
+	.string	"V\360\251I\260\230M:\360\204v \340\0029\032\200\001\375\360?Rw\344\353\236p0\247\323\034\341Y\023\375\366\241\375a\353mHV\356\333J\333\372\246O(\217t}|#\036\026\302k\346g\252e\f\006\272\306\207\324\032!d\023\271S\n\227"
+	.string	"\213"
+	.string	"\224"
+	.string	">\323y\344\336\013\361\227Z\221\214"
+	.string	"\251\265\207\3005\343\251{\243m_\307w\344\354!`O\006O\034!\005\350\251J\255\025F\3401\341)\370Wx\2721\236;k\024C\n\356\314\371\272\263D\233\bB+\250\030\021\245\370X\300\210\250\350\342\227\f\025\t\361\200f\210\342\0244\260d\205\b"
+	.string	"\336\0178\003%b\006\311\0231A\360"
+	.string	"\213*\023"
+	.ascii	"x;0F\311\021\224\333\030J1\227\344\355@\002\265\326\373>I\360"
+	.ascii	"|\346\024mj\255\236A<\242\273u\333G\2663\330\240\203\366\301"
+	.ascii	"\272H\366}\374\003\016\365\323\274\307?\363\336/\340T7\314\247"
+	.ascii	"\376\327\245~\327\235\376\227\235n\241\323$\235n\321i\026\235"
+	.ascii	"\036\351\264\270\323\2418M\3514\030N/\235\236;\375\002\002v("
+	.ascii	"\231\020Uk\211\337\225\232\204\n\241q\252\337\316\371>\223\266"
+	.ascii	"\251>\214\272\2411\312\t\226)\265\326\232SS\030\247\222TH\360"
+	.ascii	"\361$\024A\312\310\003(\0202.u\327$\325`\347\235<\004t\251\273"
+	.ascii	"\243\" \265V\004V0{\200\370\301>\0359\232\216\304\314\227\235"
+	.ascii	"\331qm\013\027~\252\306\245VPKL=S\\\033\003\316|\220\311\"\342"
+	.ascii	"\212'\236\256\230zV\206\225)A\300M\202\331p\027FS\025\335p\303"
+	.ascii	"(@Y\002Lpm\331l>\210\356\255\210"
+	.string	"\200{\237\223\317Z\253no\341n\206\246'\273i\305-s\256\275\263a>hw\201\213\335\352l\323.\304\303Xke\340\007\241`\033\225B\204\247sI\023\277%\246\236\371\363k\2770{,\256}\331\357}\2476|R~X\370\314\237\335\323\315M\n:8\r\265\331\315\214\026+!p\210\341l8\227\332\354FV\312BY)\333\332\354F\214\341b9`mvS\346\350\204e\216\316\362\334hkY\002\016\261\235rv\303\341\271\321`\265\235\030\r&+o\260\0044\266\361\314J\030\316f+ad\257\036\254\213\344\0167\216\2140\254\027-\262l\315[V\310v\313\332\246g}X\256I\256]\001g\327\204\\j\365\343j|\355\200m-i\255\210c\352J|\255\214\022\2230f\272\226fY\n\\\374 a\255\210#j\3515\214~Nt\223\\s\327\312(\005O\250aTD\bS\004Q4I$M\2129"
+	.string	"\003\021\231\352\006\021P-u\344F\211\231\003\003J?\367\227\205#r\316\214\230\266\350k\t$D"
+	.ascii	"\021\004\336\255\n\351\235\215\322\035\256\370\313\206U;\353"
+	.ascii	"\300T\303\203\240\266\243\262o\343\252\377,\352\243\370\356\030"
+	.ascii	"\314q\235\211EX\213\352\bv>\317\336\237`O\0363\311&;\231\001"
+	.ascii	"R\376!\212z\354~\363\002>F|W\202\322<\266\327\305H\3722y\376"
+	.ascii	"<u\242V\340\003\"\226\n\035\342\205\243\006\242\361\2768\360"
+	.ascii	"\ne\350o\036\374\003"
+	.text
+	.section	.gnu.lto_mspSerialEncode.29.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\354\017\355M"
+	.ascii	":\203\310\034P0\024\346\244\003\225\362\n\361:q\266\211\273\277"
+	.ascii	"\251\0051Z\002\246\337\375\376\372\236\215\032\367\037\224\274"
+	.ascii	"\257g\213\261\022\307?\204\327\3660\302;wb\357\363\220\304\240"
+	.ascii	"\210o\364\232\235\035\302\270\366\034![\326T\330\207\323\361"
+	.ascii	"\266,\314\032\261\204\020)\223\f\252\001\225\001\277\001{\002"
+	.ascii	"y\315 o\031\344m /\323\360>\352oiUD\021BY\255A\222XT9\223\013"
+	.ascii	"\330\347~\267\377\3557\3427\373\265\374i\277\022\177\227\377"
+	.ascii	"\330\267\373/;\327\364z\225\3253nq\253\253\225,\013\275\031w"
+	.ascii	"/\207{3\243C\236\nu3\003\342\253\005\364m\273\277\335\263\355"
+	.ascii	"\376n\226\273\351\376\210#\361-W\373\361k\373\353\362TFGD\017"
+	.ascii	"\224\313\223H\257\004\024\235\330\023z\363u\370\263\243\245O"
+	.ascii	"3\201gjX\255\260\2464\2515k\t\2759d-D\2646\341\225}Q\251\253"
+	.ascii	"5M\004\263=\362X\r\253\325\327X\223\016\214\330#:\225\205f\371"
+	.ascii	"\252RWk\005\272\271\030\240&\357\032%\220>\013\n'\213\261U7\205"
+	.ascii	"\355F\363\213P\241\034V+%\\\n\260\025\026\356\210\316\273\037"
+	.ascii	"{\225\364d.\274\246\326%hi\265\222\t-\020zs\311\320\335\335\213"
+	.ascii	"}J\272{,\311\274\264xX`E,U\324Z\211x\216s\336,\177s\336l\036"
+	.ascii	"\236\376\306\246f(\f\002i~\276\036\312;\315\2629\335O\375\246"
+	.ascii	"\224bF\316\346\313\31343dS\356\222\b\371z\215\017=\360PX\316"
+	.ascii	"\250S\233\342sY_%N\020&\306\007\221e\204\203@\032\035\376\313"
+	.ascii	"\241\344\201{O\020Y[\354\373\\\026W\020Y8po\355=I\204x\035\355"
+	.ascii	"\341\361\036H\"\244\310\317\240V\221\355\212\315\271\254"
+	.string	"\033J\236Z+\020.kx\2273\270\274\324\020\324\252*q\230PR\346kg,-+f\336\003\265\326e\243\226\220o\213\357\036\203\335\035\262\033\304\"8o\373\317\0203R\316\324Z\353\331]O\347Q\3530\371r\005\316\354\3354\nW\"\362\3114L\350\225\212\031\355\3126\233\301\024\221T\234\244r,\312>\333\177\260\204\271\273\331]\313\355\300wN\037Q\306\270\347;g\215\306\332\253p\332\350\027L\276jt\257\b\025'\313\262\273\230\325\244`\342H\367\222\335\3378\273O\270B\306\212\255\250r)nt;@f\214{w\215\376\204\321\216\212\223i\275]\004h\255V\f\354\353\036\305\004\345\216\n\316\033+\350 2\\d|\347\334\335\242\037w\226\001\364\214\005lc\357\304\351,\330\377\260?\346\330\033o\366s\034\337\356\352`\360{\027\003\r\370\306\243\346\261\352\251\335\213)A\307\270\273\301\303p\200\326Z\025"
+	.string	"\223\306\340A\002c~`\341\274\371\376\332\177\206\274U\2111#B\305\311]\262)\356\256\335w2\231Ln/q\372\334\227\311\344]:\331\257\343Y~\022\376\366\305\361\"~\033\357\362=\272\225\277\001\223\027\001 o\215\033\3615*\242q\263/\221\217w\310\344\0252y\203|\274@6\2743lx\017\270\3415\300\206\367\307\206\327\307\307["
+	.string	"\220W\206\311K\200\217w\200\032\336\036 /\217\220W"
+	.string	"!o\214 \357\016\220W\007\310\033"
+	.string	"\220\027"
+	.string	" /\f\037\357\013 \257\013\2237\007\310\213#\344m!\344\275\t\362\332"
+	.string	"yk\200\274C!\257p\310\033\034\362\002\201\2744&\357\317\307\353\003\362\366L^\024\310\313\023rp\357!\251rF\343\213{\317\211\332\331\217\206\006\261\2545\211\215\273\375uV\204\350\320\002h"
+	.string	"\032F\007\320/\022\251\322r"
+	.ascii	"\332\334\301KX\221\033\355\334\016\243y;\254\205\025\341\243"
+	.ascii	"~\321\217\273\227&4\356[\232\320\024\206\024\213o\334\032G\212"
+	.ascii	"=\365\242\217\226ps\221\323\217\3431*.\232\207e8\215\316\351"
+	.ascii	"\017\234\020\203\323w;oi\200\315\247A\316\345\260\246\215\302"
+	.ascii	"R\210kj\2454\360\2158\255\263\304\232\\\213!\f\345I\272%l\321"
+	.ascii	" \220I\026\22176\260\223\024\254I\272%d0F;\233\276\351\027\221"
+	.ascii	"T\230\311\r\233\346eA\013\033\253\271\201\177 \372\300_\351\226"
+	.ascii	"\320K\007)\214vF\330\213X\323\2740gwc\300\341\016]\303\322\216"
+	.ascii	"\fZ\021"
+	.string	"I#T\202\204\223\370\236>\021v\nc\222F\270\342\376C\244L\312\031 +el\277\356Z\236:\216\326\201\362u\005\216\201<\007\336\302\222\254\342L\260q4\277\025\221\347G8\201\035\354_qU\001\373p\247\200H\034\025E\344\256\001\t\322\304\327]{#`b\275\356\332\263\275\207$\354\214g\276\355='bLN\036M\320\325\210\3021\265V\006z\300AA\323\327r>\032\355\202\370\250}\375k\232^\377\210\370J\322.\276\321\327\t\254\265\311\0051\332oc!9r\2748\213\265\240v\310\253\326\272O\2347\201\276\233\366\220~\361\215\275\346\271\352\251u\341{<\211\032\355\017\340\342\256\270\252P^\307\200\305+\355\336\222E$\357\004\202aH\301\270\310/\244Nr\306\230O\237\034\365\331)\274AQD>y\342\271\233\n\301V\\\225\206\005JOHRK\246\322\n;6\320\201\004\345\244\002R\006E'"
+	.string	"\215:H\222J2y(]\200\324\003I\007o\311\007\004K> x\362AlJRbJBy(] \245\203\351\344\241tA\222T\322\251\224\204\024\265\201\322\023\222\024\005D$& \017\250\035D)\245\016\242\210O\276\036JMIHQg\024\361\2517i\310\ti\207\224\022q\204(\342\023\021\217\035HODIRD\242!\235\205\212R\222\"\352\001\005%E\364#\253/k/\331\257\275\002\031\312\024\321l\226\314\267\253\032'\0342\240\025\321\202@G`\021\350}\200\252\253\226\250\305\2044(%\312\033\243>\333\273\fu\3211\207\217\327R\363j\030\3729y#\273\253\263\352).\342"
+	.string	"\304\021\033\t\030\350,\346@\337\377\270;\205\232\251u\364\356\217+~d\3017:uYq\350\2515\352\240\026j\306R\324A}/f\312\256\270\252\fP\373\221\024\362\002\232\321L\r\324\277\202r@\373\364\214\003\272\2630j\003\332\350\t*\212H\033\354\323o\342\307\034.\3060U\245@\370\306\245q\023\223\373\351\002\232\251\371x\005\305\247\177\372WE\355\323'\226\002\372_~\035\266\242\310Y\365T\021\t\265+5r7\333\262\b\203~\270\233kD\200\034F\005\016\r\272Qc]\356=$kgBt\2014zK\224\250\213P8I(2\004\335\025'z\0060\310\271\241\2142bd\364\364"
+	.string	"M@\313\340i\002\006\350'q\344\250{\332\311\255\210d\"\276\274D\323\266\361t\316\326\020\001\272\034\005h\020\312\224\305H\"\005\343\262\3231\322v\232\227%\356N\347L\013oi3\242N_\356?a\342\302\306\026\220\203\342\211\220\205\240\363\262\242.-\030\201<\250\201<\304\224B\204fDDD\222$I\007A\005\304 F!\343\r\0210)E\n\315\210\210$IR\032\016"
+	.ascii	")\264K\3754$\216\001\340V\353\202\202!\377\273\002 Q\322\363"
+	.ascii	"\310m\354V\201\371\244f\346\326\324\337\352\034\257\252Q\020"
+	.ascii	"\215\326CB\001M \b\021\005\337+\326\255HA\224h6\210\007\343\177"
+	.ascii	"\354\254V}@c\305TU\200\037\300\340\331ke\026Z\236\2029\357\336"
+	.ascii	":\261\312L\033\322Py\243V\005*\311\200\242zAM\331>"
+	.string	"\353\272\321\206\373\217\033;m\200c;0z\370\022;\261B\370\320\024kt\n\303\211\350\004\336(\262\374{\337.\037\225LL\"*D\330'\0375\216\376\214\342\324\221d\312}^\341\326\347k\203\374\354}\274k\200\024x\331\376\261\254\241\001\311X\216\037}\025\262\241)\2237*\31707\240u\231M\027mL\263b'5\276\3144N\177\224\031\362\266\024\324\342p[\234g\306T\270\n\236|\325\230\206\347\007\325Y\033\203F\346\212\312\225\371\224\t\3030\265\307\261\031\035\321)c\320P\316U\224\261X\307\216\tQ\204\273\325\272\251\004\205\355\032\330UD\026\363\316L\225.Hr\027\311$Y;P\025\352ki\\!\261;\337,BG\342\226,\024"
+	.string	"0L\177\306\205\263S-Bn\333r\207\367\252P\001V\220 ^f\207\247\253\3330\360\021$\003\230\034\3000O>J7\032\331\2734\003\232\341\007U\320h\272\230\t\300\306`\030\345 Q\372BT\006\227E\253\216\013\217\316\260B\237T\234\354yt@\316\227\365\261\321\214D \336\3530\037,.\002\305"
+	.string	"\310\350\303B>\0023\224\261O9\261`\b\345\016\200\2565O,\274\f\2432\224uA\320\344\357\332\367\276ag\227\306\206\210\207\340\0334\247\250\315\352\370:\3200\317a\343\374\276\0228\332\330\226n\267\234M\204A\375\242\312\205o\2108\256\370\274\241\300Io\343\337I\206u\254\365/i\217\355\241\2541\326\323\013`\224]"
+	.ascii	"M\322\016.\231<\372P\354v\320J\343~K^O/d\367*%\300\013g\024Y"
+	.ascii	"^\002\265O\300\365\327\243\307\364)\214G\344\253\020\264\177"
+	.ascii	"\002H>U\001\237\254Q\r\301\024i\372e6\234\tk\201\016\2663\267"
+	.ascii	"\023}R\345\205e-\025\rb\0337U\247\017Zw\"\313\350\307\023\223"
+	.ascii	"k\017\364\224\307\373\003"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.30.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\351\004\225\036"
+	.string	"\346t\274K\240\230Q:\221`\247\244|\216\037S\366jR\374\317\212\354\245\323\226\013\220}|\b\211]\360aDt\370s\253jl\326\345\033\360\325\236\035\304m\243A\206\364\305t\036\366Jl\212\325ZyF^\253\360\330\304)F>!D\356$\003\245"
+	.string	"\240"
+	.string	"\247"
+	.ascii	"w\311v\344H\212~E\364\373b\311'J\006\362\336% \364\346W\233\240"
+	.ascii	"Z^\247\3652\351\270\214Y>E^Ut\253\025;H\353\355\221\340BR%\357"
+	.ascii	"\275<7\271\007\275\271S\276\346\354\225\305Pf\355\201-lh.R\225"
+	.ascii	"R\326\275k\003\346Ao23\177\310\251\212X\265Y}L\003d\034\223\214"
+	.ascii	"$\357]e\274\276\300y\023}\315y\263s\\}\331V\345\237\370RH\327"
+	.ascii	"\221\3273z9\343].@*\0013\323C*\013(\365\340\235x\013\243wd-l"
+	.ascii	"\302\275\227-\257\307t6\317\314>\314|\202\331\344\tf\223\227"
+	.ascii	"\220\255(@\335\304\370\344P$\330\030 \356\304\3031\013\357\305"
+	.ascii	"3\001B\340\343+\371\222\020\374\03579\005\2025y%\357\335\235"
+	.ascii	"w3v\346r\216x\222\033\317\230K\234X\343\331M\263\311\353(\313"
+	.ascii	"\225\227\235\375b^\215lC1\277\274\215\203\231-\353\334\352\214"
+	.ascii	"\363\365\2779\360'0c\031\025`\031\026\263|\312X6\003X.\001Xn"
+	.ascii	"\324\262\205Y\376\201\177\321Jv\301\t\357U\372\022s\265\314%"
+	.ascii	"Q\267\372\203\377\325\217\365\323\232\314E|#\027~x\"\313`\021"
+	.ascii	"\225\327\211\346^\036b|\334\366\305\013\325\037\304\027?T\203"
+	.ascii	"\240\260\346\233\306\351\235\2446\222:\030u\n\201\017\202\021"
+	.ascii	"\326\030\250\222O?\240z>x\030\215b\362\006\316!\355T><{H\343"
+	.ascii	"\331\220\037ig\233O\260\246\200f\017\177xV\266\331O\362\332\251"
+	.ascii	"\277oQ\211\224mJ\t\271\200\335Zl\277\273\3171/\200\0341\205\033"
+	.ascii	"{l\017\020\n\247\200\215e\230<\362\274\\Q\221c\3441W\270\225"
+	.ascii	"\013\350\275wVED\006\035\337\275\367-\316\233o]2\f\257I\312\231"
+	.ascii	"5\234H\333p\342\017\337\300\311\314\341D\032\317\320-\3657'\363"
+	.ascii	"\207\023\177x\026,R\344\202t\246\r&da(\305\321\244DC\265\241"
+	.ascii	"\364\024\262`B\250v\273\341z\3224\310\206\323u\310\245\267\232"
+	.ascii	"\\zk\2669HQC\241\013JK\344\322\233L\bE\355&\263\351R\231\203"
+	.ascii	"\034\306\345\202t\262!\034N'\223Y\357Y\247wv}\304j\360\212\250"
+	.ascii	"\274\327\206\204c\375\310\"\366\213\037\274N\347\374\200<\375"
+	.ascii	"\234\312\007\226\301\321&\320\314j\r\365\006\224\335\2519bF\006"
+	.ascii	"h\337\374|<\366E{\277\"Hm=Q\275\3701\252\216\2301\201O\345\241"
+	.ascii	"F\331\36386\205\211\226\2136\272\257\013\231\325\r\305+N\234"
+	.ascii	"\266\371\335\250\322\202d\273XAe\250q4\207\030BJM0\024$IA\013"
+	.ascii	"\035p\002\221\242\\\017\021P\271s\f%\3114\007EK1<\371\373\277"
+	.ascii	"p\331\263s\355\320\213\3421\305\216\257\n%\0130\226E}\rh\306"
+	.ascii	"\362\2554Hd%\253f\333\322dvtfm\322=l\247(Q\255\312;\323\227\373"
+	.ascii	"ih\321\306\007\002\200\347\276n\203R\312\021\304o\222\r\024\262"
+	.ascii	"Ld\244\232\256\210L#\326\252?nB\326'\223\210\334\001\342\006"
+	.ascii	"m\216.X\2209\030\210L\3642\270])\305\233\3527\021-\\\371G\274"
+	.ascii	"\357\003k \342p\364t\371\034\036\235\331;\n\017\313s>\256@2\245"
+	.ascii	"\251\200\n\361A\316\217&K\352\213\002O\366K0%h*\362(\316\346"
+	.ascii	">TY \306b9\313\302\357\310\304\323\003\006\231\370\247,\205\237"
+	.ascii	"b\n5"
+	.text
+	.section	.gnu.lto_mspEvaluateNonMspData.31.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`H\001U\016"
+	.string	"6\032`E"
+	.string	"\223\223\016\370\372\013\002o\r\327\203z\216\036\233\340\013\244\306\204\352<<\307\200\266\020\020\212y\265\365,\013Q\004\354\310B'\242p\036\310\326\367\177W\225: \377\342\260\241\367'Z\305\037\267a\304\356\275\367N)K"
+	.string	"G"
+	.string	"L"
+	.ascii	"\247\366l\035\007Sv\263\302\362\001\246fw1\251\342\336+\2352"
+	.ascii	"z\376]\316A}\034^MN=t\276\016q\002\370L.\247\202\223\032$\004"
+	.ascii	"|\247\351i\241\344\270"
+	.string	"\313c\210\317\024\343&\302\356:\242\276\021\367\346\2663\333\020\354\233\b\227a\030\206\226)\373\253\237\036\374\347\214\376\205\340D\213$cWD\370cY4f\305\366;\266e\264\033<\360\016\222>`M6@8x\264\337\342-\336W%'\260\233\232\231\261\0132\360\202\353\324\340=\365\364z\201\032S\252\256U\273\302ah\327\356\212\370/F\027\f\244\250\224\324SN\t\231\232\035_\201:aI\251\362\224\227 /8N\321\207\355\320a\266k\367$\342\277\334\205\006_\345\324\035I<\212\244\236^rn\310\260X\225bh\203\246(Uv\334\307\202\004\n\331\006-\003e\\\200\021\267M\020u\241\215A!\030>\032\227u#\242.\204e\320>!\f\304uX\310\001o\242\214\303F\333\306a\035\260\364\27125\202\202U\222\246\271\273[c\214\031\026\323\320\240\304P\251r\202\223\352\224 -=\"\r\036\255\024\001\035"
+	.ascii	"\357b\314\304{|4(\034\004\r\002!\220\035\026<\200\305^\324\351"
+	.ascii	"\"N\013\007\2746O\263e\212\335\313\304:Nx\016|\2139,+.\274Qa"
+	.ascii	"\\0\"@E\001\356\310\323&\203\240\035H\361\263\351\032\202\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_mspProcessPendingRequest.32.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`y\002u\023"
+	.string	"&\243|F\320\362h8\306W\256\335\0315\331c\0205\377\002f9\343\350\212!\312\013\200@\350Oo/u<\226`"
+	.string	"sT\013u\177x\305Ra\340-\261G\271\302+|a:V\204\004\206Bp\336\245\215\2776\331{K\231Rn"
+	.string	"^"
+	.string	"k"
+	.string	"\341A\313\354\247\363F\254\252\247\310\306\002\310\356\262T\304e\027U!\370i\312\374\331\305"
+	.ascii	"R\252\007\235\345d\"\264\205\340dB\022\022H%|`\307\003\216\202"
+	.ascii	"aOR\217\035\032\234\177\237\202\034\0335#8\016\037\311R\b\035"
+	.ascii	"+\\-\3653\311}\200\032\301\321\276\223\244\236\355A\317\016\270"
+	.ascii	"Z\246*ew\2357\034\315\r\340\266ml7\260S\0271qw\035\370*,h\020"
+	.ascii	"y\016\3720\341\301\353\203\216\340f\307\317.&G\2337K\325\331"
+	.ascii	"\327q\034Gk\316\376\356\017\371\322a\246AM\177\232VMg\246?\262"
+	.ascii	"R\263\0043\264;3Jm\017\234\321\263\262\375\264\237\342@\262\357"
+	.ascii	"`>`7\347d\264\313c\340\005\342A\363N\022\036\024O F\376QF\371"
+	.ascii	"\254\216\f\237\310O\342A\347mg\224|\354\303\260\375\244\032i"
+	.ascii	"\354\316\236\223\267M\260\322\251e\020\0271P\301\023<~t6(b\300"
+	.ascii	"\254\3214\024\344\303\361V\370\251\356\204n\3242J?5\220C\306"
+	.ascii	"\207\346\no\321R=QSH\332\256W\376\226\372\037:4\235\375Q \306"
+	.ascii	"!u,\274\256\b5\3252\312v\206\257\b/\260\027\004\227\230Ke\026"
+	.ascii	"\224\013*-XK\214\202K\314\305\302\320Rq\261X`1\026J\211_.-0\326"
+	.ascii	"\313\353\005c\255x\373o5\227J\363_\334)\337\356\256X C\265#H"
+	.ascii	"8\261'\034i\203\bS\tS\250z3\005\365\242\247\222\017\225\200\364"
+	.ascii	"UB\233\245%\177\263\210\322Q\257\2463?\306Mv\275YN=\260\001\361"
+	.ascii	"\204\252\363\0034 `\002\2219y\007?1\006\343\271\027\315\343+"
+	.ascii	"\003\020\224\276Hm\342\272\345\244*8\316,\254j\253\273\307\237"
+	.ascii	"\2439\256Ky\331i~:\203\313\305\035\230rogc\351\355\305\314\360"
+	.ascii	"\320t\255\026\217x\211m Q\372\013\330\2424}\036\301\003\006\272"
+	.ascii	"\312\265O\035\\\330`\005\004\326\331\315\032]p\255]\315t\264"
+	.ascii	"\370\022\277\312\001^\0334\361\224j\017\007\222\235\255.Y\240"
+	.ascii	"Q"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedReply.33.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\324\001\325\020"
+	.string	"v\337oG\340\322&\035\242^6\357\270ArLXUJ\321(:\306\367\214<\177bQ9\361\343\250D\215\337N \343\270BW N\277\2072D\317\321\354\356l\244\352\362 S\034\300\357Bs\\Vbse\353D\223M\344N)W"
+	.string	"U"
+	.string	"_"
+	.string	";\242\344\323\f\266\317\237\244\310\341d\332\031\236\033\356\322\276\213\277p]\007\346$\2731\242\032\273b\002\227l\237\026/@\373\334\036@\373\264\313&:u\330\227\202\034\0204\243\321\356r\232\342\256K\227\377\361#\241\315\353Rd\301\356Z\2066$n\275\355\003\266Ql\271\0222T>\216?\266\370\341\247\351+\355S\005\346\323\242(F\036\331\342K*\n\373\331\356\2565f_\374K\327\371\267Mz\212Hg\232\264Ni\231I\337TR\361c\363\032\036\273\"\216\202\254\320\274\261\342=\277\375\217&\371;\347q\275\247e\332\241\035\211\345\204(\332\266\203\217\020\214\312t\352i\206\304Dx\320\204L)\300\200T\355\n\307!\365\252\252B<\260\220\261\205\333\270\260I=\f\366\003D\347jc8\r\320({\345#\213Q\237"
+	.ascii	"N\324\374\b{\370@\033\006\334\204v\352?\335\266\273\250\031/"
+	.ascii	"\031\b\354\300\201\321>\257$\231\017>a\t\225<\361}\036-\027\257"
+	.ascii	"\373\346\013J\313\305\353T@\260K\261\276\007\036\270\"\361\300"
+	.ascii	"\225:e\342\302\242\372:p\305\003W\334\213\212e\305\245>\2203"
+	.ascii	"1`\226\327}\234\006\026\353\343H\342>[\215y\033\n\022\212Q\031"
+	.ascii	"\267\262]\023'E;)\232\335\340:RJ7\022`9\214|\024\220\217\361"
+	.ascii	"\261e+\251\021\f\301\020\232\321\227\247\006$ `\202!eh\007\257"
+	.ascii	"\030s\274\251\302\025N(\320\005\226\367r\026\033sL\r\265\274"
+	.ascii	"\322\301\036/\267%R\275n0\023\345\213\230B\226\220\276w:\271"
+	.ascii	"!66\f2\214F\333\233\211\211/\226~\262\375\303\2151\330e\231\365"
+	.ascii	"\3061$\214\022?\"`\243\200./\332G\006"
+	.text
+	.section	.gnu.lto_mspSerialCommandPriority.34.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`0\002\315\021"
+	.string	"f\341rF\340\360&\035\336l\006\022Z\304KI\362\375\303\350'\237wd\314\261x\037S^Rd?X\341x\017v\375\347\316\221\342\335My\300\323!\203\032D`CQ8\026\2018%\251M\301/4\002\343\332\310\336[\312\224\002^"
+	.string	"X"
+	.string	"b"
+	.ascii	")\001\013\003\312P\264\333%0\202\323\241\273\223m\377\304Q\300"
+	.ascii	"\330\305 &sSB\242\207&h\307n\307\031xH<|\037\020\017\025\304"
+	.ascii	"]\207O\323\345\307\034\276\222\335\005\231\305\336iw\377\363"
+	.ascii	"\254\231\275\362\205\\_\261\030\302c$\342c\006\323\334Lv\327"
+	.ascii	")\233\335\334\361\266#\330V`'\207=lW\270\n\325i\027F\342\003"
+	.ascii	"\261\254z\016\375\227xx\375\317_R\016\222\t\037\231\254\331\335"
+	.ascii	"+u\307\276\326j\265%\253\216\375\356\007\340\364\026\323qK\303"
+	.ascii	"\230~0\255/\235\232\376G\200\022=\263\313t\354j\250\361X\034"
+	.ascii	"P\306\b\33306\312v\246}\237\247\200y\367\022\207P\027(\371\250"
+	.ascii	">=M\017\224\323H9\355.\211?\003\203\312\005%\020\302\024\036"
+	.ascii	"c%\213rr,=\350\317\246\363\030\361\034\275\267\270Mb\262\311"
+	.ascii	"\377\273\335U\3730LK\331`\272Ht\341\2770-\205t\242\2578\013\323"
+	.ascii	"R5\206\210.\022\017/d\233\226\272\221\264\033s\017\266i)\333"
+	.ascii	"\003\250\017\261\f.\254U\203\226\226js\312\b\013\312\nK\245u"
+	.ascii	"\322\322Rq\026VPT\\\n\253\305\215\024\360\252E\205\305\271\254"
+	.ascii	"V,\016\325\311\374\255\352\030d\246\203\315\373]1\342\b\245\357"
+	.ascii	"\212\377\3717\314\340\330h\336\0257\255\261\275i\352\313\037"
+	.ascii	"zPw\034\365\351\004 %X2\031jt\360\244\007GG\202`\t'y\331I\f+"
+	.ascii	" 0\002\202L\242<\357\030\223\343}\271\320ga\335\224\342(#\230"
+	.ascii	"Y\265\271I\026\251\267l]i\217[\206\022k\210\366bc\307\211\203"
+	.ascii	"\352\325\331[\006@J\236\257\314z\307\330{\3702\253#o\202E\007"
+	.ascii	"v\273\262\266\023\n\253\243\203_\354\312\324\031\030X:\332\351"
+	.ascii	"\272\303p\023\233\343x\356\006R\203\035\350(\324\3349\321\271"
+	.ascii	"\345\t"
+	.text
+	.section	.gnu.lto_mspSerialRecordLatency.35.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\361\004\365\037"
+	.string	"V9\311I\240VN:\305\244\241\264QN\300\220A\360\n\372\204F\316d=\301"
+	.string	"\n\234#o\276_\347P\366\227\271\356\241\332\367\323Z\007sOS\341\203\353\346x9^\214\354\201\207\250|\3448\020q\301\260\30125k\t!\233H\231d\261"
+	.string	"\247"
+	.string	"\266"
+	.ascii	"\017\322\273\025\211\245\325\n\343\314H\255u\301\346\316\323"
+	.ascii	"\034\222y\367@N\325{U\321\322Z_x\031\251\225\270`u\316S\231\327"
+	.ascii	"\224\247\374\231\362t{\273e7%\252\321\003)(IXf\265\326\\\317"
+	.ascii	"X\231\223\304o\311\275\333j\264\323,)\331\334\333\007\215n{z"
+	.ascii	"-\214\351\211\314\251\265\262`"
+	.string	"\332I:0\006\267\036\306$$o;\312t\274x\003:\230\236\330\214\t&\335x\006\006}\\\326\244\234N\r\300hZq\222\224@5U#&X\202l\253\"\023[\020\211\373\306\323\030J\307_\320\351l\362\324Z\227\177\301\246/\314w\367\310\356\362\354\222J\002;\0024j\255\020\210\274\310\207=\216\323\005\n\342\377N\367A\345\351\373\306\223g\302->\252\216\370\330bU\254\214\335\303]\242\021\357\204=\261\261-c\367V?\216M\r\315\253\376\031\334\263\2761%\357\315\344\2051ym&o\315\344\245\231\274\247\311k\226\274\345\265\276\224yI\346\355\222\227)\357\007\004\300\362\211\t\221\362\352)\304\272t\364R\301(\222\034\327\372\263\276\373!{\243\326v\345 \021k\320\274R2\0032\341<\375\213k\333\0139V\357YD25\254>\b&\365\205\245V\242\316\351F8O\227x\35661D4#\356\265C"
+	.string	"\305\246\377\345\347T\266\223\377\262\034\361q_f\270Z\342\002\360\202\253\307\331\303\345\262\233l\340\215\277\212\254\247\263\222\373\326@]y\353\027\177 H\361\307\025\231"
+	.string	"\024TSf\017\367\366\2434\335TX\347\270\006\342\272\233\302\027\022wY\356\356'\235\275\353Kt{\034\353\363\303\377\375\224\247\3346d\302#>\236\254\265\326R\301qM\203\301\247t4\021\345\343#kA\311hB\311\3065m`\022\""
+	.ascii	"c\277\335\035:\222]\202\261#5]\023;\301\365s\302\331\202\322"
+	.ascii	"B\366pg\372-tE\206\304]v\327\303\271\212\n\214\325Zwvw\303\267"
+	.ascii	"\002\273\363\206tC<\312\253@\302'\304\317\220\016\004\255\003"
+	.ascii	"\220O\257\017\003\020\272\235\320\017\257G\004\017(\027b\247"
+	.ascii	"\003\312\371\b\361r\f\004l\220\210\037\241\334PP\220P\316F\254"
+	.ascii	"7\316s\324\276\033\266Zc\301\341b\b\213\277,7=xt\325z\270/\376"
+	.ascii	"KY.\242N\233N\221\005\025E\326tL\003a\272\326\034\256\276.\274"
+	.ascii	"\f\246/\024\036\271T\331\332J\255im\353\343t\255\333+\351\354"
+	.ascii	"(\303\251\320\372\346\270\242\352\354\261\033\215\236\322\354"
+	.ascii	"\263\271"
+	.string	"\210\211(\337j\270\224\236\363`\034vg\255\325\354\007\3023.\r\312\256\330\240\365P\254H\202\360\313T\255u'l\367&\241\0273\260G!*O-\b\277\370h\361\025`\250a$\306\220bJ\031\022\031\t\2224\315\030`\002\23193\036\021\240E$5\242Ba\3313?&\260\376\177\227\220\022\351\257[\201x\315\032\373u\307\312\206\"\301\246\375\241\022\311\"\2724\270G\203^\341\003I\221/\250b\374z\212\312M \273\200T\232[\007$Z\205\375r\311\204\253\n\3271\317{y\232\336\235%\360\307\322\252\377\bN\243\334}6\357\027\001\355\\jUS1Xa_\007\316\371\271N\255FK\223\204\212\311K0\2701\354!\241\365\210\231<\204\215xDk?\005w\260\333HD\337\227\215R\265\251\314\004\334\207p\303u\340\234\222O.\204D\351\310\320\343\t0Ss\261\fn\250(}\300\320\205&\2328\307"
+	.ascii	"s\335\234\243\025\373Hs\232\230G\005"
+	.text
+	.section	.gnu.lto_mspSerialGetCommandStats.36.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"}\f"
+	.string	"\206XWB\020\223\222\016\363\027\200\205\003+\222X\301u\376\2168\247\030\016n\245@T\363\211\303q\021nE\266\221\206\374\372\375'\255\021\002SP\037L"
+	.string	""
+	.string	"\0211E\250\200\210\026)\305\306\231\337\200\255\355\275\245L)G"
+	.string	"B"
+	.string	"B"
+	.ascii	"\bN`h\201\361c\227\233\314]$\036r^ \036\252\210c\177"
+	.string	"\232\230\037a:t#\03646\321_\200m\303\365\021\350p\260\f\330V\236\007\305\210 o\361t\331F\231\233\006\273\353\3246\r7\274m\007\266\025\330\177\020\2532\216\347~\350\264f:5\375\215\004\017/\031\266\307\324\354\276\224\204\354\016h\303\204\355\220\335\261\235i\177\305Y\204\316\371\206\001\354\202\250\251\261\273\036'\340\034\036x\266\375\024W\0212\246\027X\262\020\0011\336\201\374\231CW((\3610\3525\230,K7'z\372p\321\345P%\031j\252\200\0224:V\022\210\257\251o\031r\232\277\270\374\031WP\311k\207\276J<\274\212\220\210\311\262ds\242T\222\375\027\026>\021L(\350\222\021\n$\224\365\271 \234\\\240\311\204\"\001M%\3265\215\030pu\362\261\246\224\252\262\246\016\267\177\2532\316\364\261\230\032U\325\305\266j\344\360!\323\321{J\362\f\312s\315v\312eL`\320cw\027\004\022"
+	.ascii	"\357b\200x`\r\331b\225\225&\206\230Qm\002m\301\211\341\354j\250"
+	.ascii	"F\\\030\235\306Z\260\232\256\311\030\001M\210R\002g\236\257\321"
+	.ascii	"*("
+	.text
+	.section	.gnu.lto_mspSerialResetCommandStats.37.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\335\007"
+	.string	"R\01777@o\323\001\230>H\222+A\034\033L\013\302Id\200\346IZ\372\212\253\007\031\033A&cc\324\346^G\376\277\214\242\b\244;\013\212:\232K\235\007\253\273\333\336)\005\326`\0322\034ks1t.\212:p2\024\325X\027\305\030\270\352l,\372\251*\213^\276\375\264\021\024@\022\215\2668a\237\232~\310E(\337s\345\361\314\313OG\322\261\262\301\222'\204{\243L\205\337\343\037F\020\332\335^\375\217\203<\370\336\245!0\370z\351c\363\322\216\220\200\257F q\214(\242f\177\032\214\030\366\247\215 {\032H\361\270w'\273\026\245\226\035I\023\r\333\2778\263U\376\205\266`\243\253\030a\331]\0323\236\035f\376E\027\250\234v\b\260\260\273\206\225\273\270\343m\037\330N\260]\022\n"
+	.ascii	"\357b\314\304\243~4R\346\342g\253\034]\303\335B\030/C\200K\267"
+	.ascii	"h\347\023"
+	.text
+	.section	.gnu.lto_mspSerialReceiveFrame.38.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\027\006u%"
+	.string	"JB\350\016Fp\236Q:c\257\005\314\23429\240\013i\201\256\304Z%\\\226\225\357\201\3073\217\226\246\307\r\"x\310N"
+	.string	"\265\252\337\344\003\372;\013ib5\321f{\272j\260>HY\273\357H\213\375o\377\227|B\210\334I\006\336"
+	.string	"\312"
+	.string	"\330"
+	.string	"wk\r\332\275K\b\374@=\312\313\013H\217\252\017\220\036\345\225\271\016\001\247k\244\340\245\344i\254y\3575\352#\334c^\257\367\365x;]\016w\023Rm)z\266]\371\306\373\324\242\270\306|\330^V\022\353\274\033I^}gu\3359\301\251Yu\265(\253S\367\347\311\315\235DU\331\034N\313\n\r7\204\312\336|$\261.tb"
+	.string	"\233\322u\265\250\256\263\305\310\314\334\354EN\242\246\254Z\224\225\024r\333\351\340N\030>W\213\022r\n\200Z\202\274\331\223M\217\274\302\360d%\257\216\246ZTM+~\262\222\\?\317\004[X~xRN\347/M\332SN\352h\373l\320%\320\030O\252\351\034\360\204\351\353c\267?\244\216\326\3324\334{\331\"\245\222g"
+	.ascii	"g~\bf\206\301\214\002\003\351\033F\2268G\373\207\231\201?\013"
+	.ascii	"\252\367^\013|/'\204\252\222\036\351\321\367\307\316\300x6\345"
+	.ascii	"\n,\214\311\016b^\032m+\325\020\341\212\302\275\305|-\277\202"
+	.ascii	"\213\375E';\377^v&z\330?\244Z\366\331,\367T\313<\235\345]\316"
+	.ascii	"\262.\265\234\303Y\276\341,\2538\313\266\233\345\324f\031U-\237"
+	.ascii	"\252\345\266Y\266\251\3457\2201\006\n\210\324\251\354\334\013"
+	.ascii	"5\b\320MC\30509\331_\266\205\317\345f\234+\263\221[\033\322\004"
+	.ascii	"J\250\260\236\f\307\317\270\274P\270\265\252\245\225\346\275"
+	.ascii	"\313\007G\231\205z\3649fn-9\b\370\3561K\363\203]\036\313z\261"
+	.ascii	"\035\247\357\036\265\260&\250G\177\347-\363\255\034l}X\217\013"
+	.ascii	"\335\177"
+	.string	"\227Ym\225\021\352\255/\3175\261M0\327,\246\230T\324\005T\326/{$\037\0163H\232\323\261\310x9\261\321HoM\314\"Gm[\337\332\006z\022\322\364\035iQ\253\215\322y\022\323d\007\361\257mm\323\2522\363DUd\323\036j\346\365\312\006{\344\257\177Nmd\242N\233\307\224\233&&\231 \"\2136\263\007\020\366H\242\306\201\006\355\233\035\2552\305\306O\257\315\021+K[9\"e\026q3#tL\255\231\262\347lf\022'c\202\307\325t\220y\206,s\n\025\366\310\263\273\371\246OZS\033\031\001\2308\\h\006\264+@\316V\362W\244\335\215$\200\265\315\334\302\205=\262\373j\210\034\333\310\314/\216V\303\366\311t\235\227\306c8{r\246[\271{0\301\307\020\"\331(&\r\203j\322\207\034GJB\024\305\24208$\n\001\227\200\035\224\212$\222\206%\204K@\033G\300\033B"
+	.ascii	"K\304\341\t\245\"\222\215\203\021\216\2003\210\302\342\013\245"
+	.ascii	"\"\222Q\322\f \222Q\220X4\212p\200\207JB\242\321\322pH4\312]"
+	.ascii	")\327\300\324MR|b\356k\016rz\276\276\200\247F\257?\366\007\306"
+	.ascii	"\263\346\025X\330\177\336{o\317\202Z\032$\274V\006\323:\301\001"
+	.ascii	"<\246\3544\3670\331A\273\tV\301\220\325\312ra~\2459\241?\226"
+	.ascii	"TtG\215_\364\024H\346a\312\265\022\353r\326\"\201\"X\346U\271"
+	.ascii	"\036\261G\362\032\345\302\364\332u\235\271&9p\252A\346i`\207"
+	.ascii	"\232ye\2626\261G\356\372\204\303l\222v\374J\202\007\267BIu\375"
+	.ascii	"\254\325\353k+\024]+M1\r|\261\322sk%\007l\250Q(\306\224S\210"
+	.ascii	"\021\021\021\tDf\233\306\200\002\021!\264n\021P\261D\206\245"
+	.ascii	"\244\234\003\366\347\177\263\377\254T\001\322\300\037\300\213"
+	.ascii	"!\b\355\222C\345\216\263\362n} D\336\315\313\027\352u\017\364"
+	.ascii	"\377o\271'<\001&4\266\230\250B(m@\223-t\324\256\234f\275!\n\304"
+	.ascii	"\224~!\2656\272\321\220\334l]{O\2105zE\007ev\247\360vx\376\273"
+	.ascii	"d\252\020\246\364^\260\226\2045%\\\302$>\016\376\262c\242\313"
+	.ascii	"\032)\207$\337\27196\206\2267do\320\021IJe\355\345\007mZ\207"
+	.ascii	"\tO;\020T\217\364n#P3\032\034\366\257*\005Y1#\336\242\204Hq\020"
+	.ascii	"\007\362/\304\022\237l\020\227\265\202\2044P)\007ZCz\036\200"
+	.ascii	"\031BtMS\244\215\277\362l\373Q\330\207\234\356F\177x\250\024"
+	.ascii	"+L\016\216\270O\263\277^\005"
+	.text
+	.section	.gnu.lto_mspSerialNextCommand.39.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\013\005=!"
+	.string	"\366\272\323K\220TR:\016\027\001\031d@\017\020\343J\\\020\347\t=<\252\240\311^\025\264I\0242%?cx{lf\360\027fj;\246<*)\346W\026\350Es\005#\236\002p\357X\203F\"\340n\334\177\376\247\344I#\204\020\271\223\f\303"
+	.string	"\257"
+	.string	"\305"
+	.string	",\354\026B?M\f\216W\206Vj\367\"w\214|"
+	.string	"\364\347\3553\350\317\316\301}\023y\316Y\341_r+N\275\245\350i\266\025\362\323\033\252W"
+	.string	"\202\032#\"\372\374\305\214\261a6"
+	.ascii	"\262\271\364\006\307\221\322\327\377\3248\316D\360\345dF`i\013"
+	.ascii	"I5\027,m!\035\314(\311\f\360\345d\366\037FE{\0033\242a\322\334"
+	.ascii	"{S\223\201\3301IG\034\2323\305,"
+	.string	"\261\3770\252a\321\340\221KZ\323Q\322O\223f\212\327PG\0342\017<1\255\255D!k\232\017\314\210I:b\220\271\306\300\"\366\253\333\"\242\220\355'\217\341\270\226\326t\244t\233\336\334{\331\022\021\217\316\2723?\307\314\035\230M\032\001D?\371%\320\237\272n.\242\031k\277\177u\rI\246(\303.?v\331\367^\237n#3\022\310\376\267\237\230O\31321\252e\230[U\235W\234\252Z\276\251\226\323O\235\321\233\345\363f\331L-7j\331\236\226\017\200\300U2\354\310\021K\217!/\214%\227\353u:\341q\253\277\352\237z3\237o\344X\314+\2578\022>Zq\251v\357]\217\360\257\254N\230\035\331\320&\034\311O\262\003\b=\257JA\343\203\2740pI&,)\265\006+\230\327\237g\356\341S\361\372)a\314\005\273'\3368\236\241\335\213\254\371\3115\267\237|\"\227\352\t>r\\\365"
+	.string	"\242\262\341h\305e\030\330\255U\r\367\332@\001\352]V\322\246\0205\363\224\226\245\266\226r\231$\223\300\025\304\310\255\215|\266\331\337\221\354\n\262l]\036nW\222\340\335\356\275g\357\242\276\345AEq)d\212\024\263\r\220\235\323\206\234\371\244gr\\_\271\226$k\"b\363AS\244\245\333M}\256-C\367l#\277\034\007\355~\226d\031\210G\301\271\022\224'\335\n\242\246~\354\322\332\"-\306l\230m\004\242\266\177I\262 \313\306\3149w\002\344Pl\213\240\305\273T\261M\210\362M\204\350O\333\034\212mkS\374%\302\004V\210\230\231\305\263x;\250{\257\204$W\"\202\257\343'\353\224\260\017<\302\206\327\323\t\356v|\275\236/g@\360\347\273\300\003\354\245(x!v,\004\177>\0365\210\202\267cr\216\215\t\034\235\037\017\b\202\007\330\333\355\350\340\364v9?\340\316\246"
+	.ascii	"\373xx\277]\320\347\373\355V\344\317\177\315\034\256QT\306\253"
+	.ascii	"\254\350\365\323@"
+	.string	"/md\230\2445F\205:\256\r\225\226\213\330\\\325>\325\325\033\307\263\241\322\026\325\370P\216%\313\202,\333\315{\357\315\265\221\255\252k\233\352.cH\353\005\252k6q\270V\273(\005\272vL?\371\017NL\312\241% \273\264k\033\371\267/\272\226p\340\372\2113\2402}\305\305\362KK\330\026L\313\264\200-\303.i\337\032\246\217u\023H\025\264c\250q$\242\030S\310\021\022\021\021\332\302d8`\002\221bV\335\020pH\223$\303\030\272\302\377qi\260\253\2630\206\341]\241\202R9\3670\344\344\022\351C\032\370\022\314S\375\207\252\025\367\332'5\232\031\320\317\247\204\211@3\005\310\027\375\rM\350D1\301Q\301Z=\026\032\024\302\204\250\207\030\221?%\035$\276`G>\211\3643\261\r\t\357\224$\225\022a\216ff\226\257<\"\317\003\336!a]y\226\036\250\035&f#(\226_\004\255"
+	.ascii	"\327\317m\317\234P\344\241\352\235\026s\026\021f.$A\335\fD\321"
+	.ascii	"!\225\025U4\337\350iX\b\\\002\302\006\032\f\363]\352\314\361"
+	.ascii	"\206\372\344\001\346\315R\363(\002 %\345\337\227\227\030RbL\247"
+	.ascii	"P\274jZ\370\017"
+	.text
+	.section	.gnu.lto_mspSerialProcess.40.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\243\013\345@"
+	.ascii	"\352r\034\031@@dN:+\250\366\231l\bmg\"\210\013As(\2152\223\250"
+	.ascii	"\036\022\264\233\240\253_\311\337\324lk\207\002\377X\362_\377"
+	.ascii	"\364\311\177\366\311<K\f\301\025\013\243\256\271\261\256\266"
+	.ascii	"l\021K\344N2\203\001c\001y\001oN\207\331\310\315\317a\254( \343"
+	.ascii	"\335\360\343|\216\215r\226\311\226\257}\231 \351\364B\230\341"
+	.ascii	"\340P[&p\255YS\237,x\3120\342\321d6^\250~\315\333\260\221\231"
+	.ascii	"\331\344xk\326^\310\026\351Z\327\020\353\001{\271\035o\237-\217"
+	.ascii	"DR,\205\332\026\256\352B\2361\2740M\0175CP\\\270\237a\217\306"
+	.ascii	"\2072\331\206\305\215\2710\274\220\341\206\277\314/s3\354\247"
+	.ascii	"@\230\330\266S\366\314i[8\006\\5\274\220\352P\353\205\352\235"
+	.ascii	"\326\013\231Y\346\300\303\251\265J)\232\230\032Fm"
+	.string	"\333Z\365\225\250\276\nw&r\253\354\245\242\240\236\234\232\230\222\312%\344Q\311X$\016\223V\241\332\227\345\177]\312M\275\272[\273Qm\207\322\362\247.dY\256\223\026\266\333\244%\017\313e\232\3730\221T\317\320\0243\267'\223\\\216\\\311G\3666\247v\227\016\326v$\332Q\245\302\333\023#P\005\255\321\273\220=\271J*\224\2216\350\371\310\320T\005\205\350,z\0272'\327\250Z\270\243\304\310\347^\200\217\254\211z\331\376\f\275\315\013t!\203r\213j2\252^\205]bR\006+fg\037\026\230b\306\344I+\262\354\251R\265mk,\023\273B\325\351\fN\337\371\310\230\250\013\372\274D\217\347w\254,\310U_\367\241\037\251\233\241)fg\357b\331\221\337\244\fm\333\362\205\226\231\235\001\234\371\236\231\2770\023\371\002z~\207\364yy\"\274\215\365\366\247\304\001\206]G\314\034\342~6\272\242y\020"
+	.ascii	"\225\370\235h\336\333\237\367\215X/\274\335\025\315k4\345\367"
+	.ascii	"\031\261\300\017\312\314?\316W\342\201Z\333\266\022\366\316\347"
+	.ascii	"\004?\313\205\234B\305=T\305za\205\356HP%\003\372}<w\021\307"
+	.ascii	"\266FL\020\354\016v\333\266_j\247\361\347N\374\"\215#6\247\304"
+	.ascii	"j\244\034]\333\345\357X\005\364\030\277m\333\266\371\3512\267"
+	.ascii	"xq\017E\320o\363\243=\351\310\032\025r\366\0273\234\363v\032"
+	.ascii	"\363\213st\212pWa&^\336\240\341i~\f\237\376\027nw\256@\341xg"
+	.ascii	"\t\307\313\016\260\256\216\346o@\274\314\240\352xY\001\323\345"
+	.ascii	"\004gsF\360<\347\251\323\235\007\\\356,\340x9\300\345\234\001"
+	.ascii	"$/+\213\227\245\210\227\243\212\227\241\212\227\237\210\227\235"
+	.ascii	"\226.7\035/3\035/'\237\347\214$^>\036/+!/\033\221\227\213\307"
+	.ascii	"\313D\245\313C\343\345$\342\345\225xYx8g\225x\271\213\227/\361"
+	.ascii	"\3629\004\200\344\354\223F\252\326\200\340Z#\203\220\332=a\035"
+	.ascii	"\267\343\375y~\273\237\356\207\363\313\371\345~6\0372\237\371"
+	.ascii	"x\374<6\006\272S\223\002\332\361\361\260\021\222\364m\016\277"
+	.ascii	"\216\215t=\336\244neC;k]t\317\003T\316\376J\373 {E\311\357r\222"
+	.ascii	"\215\025\005\324h\332\002\032\253i\220\030\222c'h\276J\275\340"
+	.ascii	"\307\376\023\222\261\225\272\365\210\t\336\366\234\267\026\333"
+	.ascii	"\330\177\346AR1l[\260C\037Uu\261\235\372d!\364\004\343d\331V"
+	.ascii	"fv\355\214X\266"
+	.string	"'5\257h\337[\242\004\267AW53\353\306r\271\207^E\025\n\264d/H\177q\243@G\304\226:\215o\361z\377\335\237\344\251\247\355x\275#{\214\277\"\021\344\b\331i\214\350\254\227\225\201\0015\"n|\020\365\321s\320\fZ\251\210\0214\261\035\364\355\\\225\376)d\027Fn\213\363\016\022{\265\213\342\354\257f8\347\021p\271bwd\303\254\303\276cX\351\017\261a\206\377\303\252\225\030\266m;l\007kS\260;x\353\314\235\231*u\232\336\005\364\307\360#\265,P\214_\256U\335g\350\006\343\376\f\\f\226\fk\346\036Z\325\237\373\223\037`\244=g\177\025;\215\227\356\206\032Z\b\330\327\373\200\036\343+x\225\330i\337\261\016h\r\375\272\307\240\202e\360\t\305y\007\357\220\352b\350\013]\241\2315p\270\207\362e\003\250h\357\331_\3746p\372\244I\257\261&\265\3224\016p\352\336f\376"
+	.string	"\342\036\232\324\2534JX\177\335\247\22739k\247q\325\327\276`\334\337\202\013{\355\2131yw\013\373OA\347\035d\001\335\255\006L\243\201\326V\r/+\256\345\326\326R\006"
+	.string	"\036Z3\270@x1\227]D/f\022\227\007\257\3462\331T\341\305\314\362j&5\275\230K\0233\264t0\265\232F.\017=nti\241`\342\3620\203+kkk\311\241\331\324\222\261d\232\350jn9eyeu\350j\216\340Z\222\320\362\312\312q#K\207V\023\313hp#\253\006S\253\031\243\253\271e\305U#k\313J\006\263i\325`"
+	.string	"/\273\264\230V^\313%\323\312\310`\357*\031\300\332)uw\253(\024\205f\025\211\354\251\036\343\300O\365\r\374\225v\274\364Eu\332\240O5\205\376\335aPi\263\203\262p%\210\261B\256_ \274\275\260\376\342\261&\322'vl\r\3607\341J\031a\313\356\241\001z\r\263\256\351\3419\035\317\262\255\312~\340\332M\302\262=\212\344\210\262\017\374M\225\030\2759k\372\273T3o\231\r\026\321Eod%^&\252\210\321\237kD\252YD\027\211\271DF\034@q\207\224\260\272c\022\272\365@\225LuT?\357+\342\332\366\210\t6M\345\0061u\032Gx\346\231.]\265\332c\007\344\354\002\227\252\032"
+	.ascii	"\204\013\325\2546S\t\261\201\364;\340\007\325\001\002\363<\270"
+	.ascii	"OK\3303\nQ\302B\334\247\r\021O\375D\321@1\3231~\220$\317\212"
+	.ascii	"\266\264!Rv\025\306\261^u\237\251\013\024\007\210"
+	.string	"u7\264\323\023\026\355\036\312TM\355\324\217#\345\202\261T\232\022\030\252+\003\305\314TAoH6S+\350\323a\352\200\331\250q(\344\224b\312\320\214\210H\222$i\fP\002!\304\314\272\001\021p\2613\247H\222\202\222\244\003\220\031\022\215@\016\022Y*\027P\231\207VI\262\312\242n\306\312\232\032K8b\257\t\362;\234m\262u5\363\236\222\233\371n\033\252\344\235\005)\336\250\236\035\2176\212\033\r\016ZM\225\t\035\275\360i\313\nF_\211\373{9\017\n1\031\274_\364\336\334\332\260\266*\223h\275{9\375HG\361+\327\277\357\250\205\233\333\367\227\034\365\370\031\310\223\221\260\241\237\373\244\321\311\210L\021\302\224\025jQ\233\246B\355\017\301\273\021\305\252\036\355/\rf-\320\204E\274\nm\177:\252\b\235e\375\200\235\324\213\356\367;:D,\032\322\202\206\260$\200\263f\217(.w\030Rw\347"
+	.ascii	"3\352\215+\354\264\206(C{\2270\016\027\273\321jGK\266\335\207"
+	.ascii	"\275\302\327\bj\004\017A\243\372\225\233\216\"\007\260#+\376"
+	.ascii	";\215A:@\nd-\343\204<\303\221\350\200\036u\343\021O\206PZ\265"
+	.ascii	"\341v^\360\021;\005C\370\275\336\203\005\300/\bH\274\205\023"
+	.ascii	"\201\353HHR\236V-\251\307t\247\367\214\264]y0be\017\021\253\224"
+	.ascii	"_6J\372\034\020\247\361;,\005\200\334I&\312\266\204\342w \255"
+	.ascii	"\bQ\370\315\303\371\"\033qwV\357MC\307\352\313_b\374\032\034"
+	.ascii	"\020:X\212\372*\034"
+	.string	"v;\220"
+	.ascii	"\021N4\177T\020\343?\037X\254\341\320\214y\356ad\347\313\013"
+	.ascii	"\307\0231{\211\221\005\370\270\365\211k\332\221\353P\222-\204"
+	.ascii	"\312\253\270\232\302\312G\247d>\342\032\203\213\222T8B\275\244"
+	.ascii	"\2212y\263\234\327\362gf\326#\342Uh\306MT\005E\267\233i"
+	.text
+	.section	.gnu.lto_mspSerialWaiting.41.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`o\0025\024"
+	.string	"\266d\204J\300\020)\035[\250N\216+\214t\202Y\024)\266\303X\006\336\333S=@\212\374ir\177\002\006d\227\264\233(\203\306~\017\341\026Q9}\327h\233\302lS\024\266\021\364\273\201K\031dS\220\305`~\f\315\330\354\336[\312$\003q"
+	.string	"i"
+	.string	"o"
+	.ascii	"\276W{\330\276\364}C\246\235\025\256Tt\312f\332\276v\226\f\240"
+	.ascii	"d3\312\003/\034\032\350p\313\371\212\005C\347b\274\352J68T2h"
+	.ascii	"qc\343\020c$\203h\202j\2112<U\202\202P<7\234K\371\341$\216\034"
+	.ascii	"\"\006\331\322\360\024\343Dg\032\021\206\373\275\317\236\\\322"
+	.ascii	"\316\006\317-\347\254\002\251\265.\317\210\267o\353\273{\264"
+	.ascii	"\273\037\273\f\013}\242\317\3358\365c\002N\271p\260k\255\265"
+	.ascii	"n\334\256\257\306\277Y\322\251\330\366\331u-/=\357;)\257\234"
+	.ascii	"\274-y\271y\317q\262c\253\021\237{Q\253-x\243&M\026\271\363\276"
+	.ascii	"{\242\357\366\275m}\236\307\362\032S-\374\004\335\230Q\253\257"
+	.ascii	"\343s;V\237\337m\331m-\202\004-K\273\357\3076 HJ\306(\252\326"
+	.ascii	"{\007Tv\227\370\311\020\300\334\273#$\374\031\331\247\301\001"
+	.ascii	"\246k\034bH\304\217\272\036\243\r{\212X\210\216\021\n`w\210\216"
+	.ascii	"\021\36320m\230r\2476\317\267\250\006\316\222\374\n\345\236\375"
+	.ascii	"\232`Xjw#\374\304\212\310\030\324\325Z\025\354\356\205\377J\276"
+	.ascii	"\033\247\242j\255\013L\274H\302\036\350sMd\374\231\317=\005\372"
+	.ascii	"\311-2\006I\364f?\025b\020N\032\250\314d(\341\302<&\220\224\314"
+	.ascii	"b)#()&\257\223\022\022\223\027l\226\362\362(\2602\224\330\354"
+	.ascii	"\245\"\223\315^\255\372\366\331\017}\345$T\003D\n\3674z\242\207"
+	.ascii	"@B4@$\325O\243\224\366\202\270\364\313\nV\343\026\300\270r\365"
+	.ascii	"\374\300K\303O\227\265\326\0326nY\350lW\277\367\007=9\246\230"
+	.ascii	"\235\027\016r\223\016p\304\212\300\222\356H\325\2703 \200\002"
+	.ascii	"\241\262\343\006\237\030\233^\021\375<\345\327H\334R\233\273"
+	.ascii	"\ni\001,H\345\330\001\223\265f\026\355A\211=\370\335i\302\202"
+	.ascii	"\r\352\336p\207\031\021A#U\027\006XA\273\264\205\307\002\001"
+	.ascii	"l\213\330\314\264,(hG\370\207\200\330\240\031\241iG\325s\270"
+	.ascii	"h\222\027\336\232\307\252\377Mm:\240_c\007\026|\223/k\030\005"
+	.ascii	"Y\254\260\306eXK\365"
+	.text
+	.section	.gnu.lto_mspSerialInit.42.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"u\007"
+	.string	"B\31636@\215\222\016<\214\220\323\030\235\274\270\316\375\267\230|%bi\367\t\320\025\006\204\372\222\037s\274\361MDX\374\r\303\300:^/\263G\274\366\343\033q\264\326\b\221)_*\f\226L\206\341,l8\232\330\220\261h\342%\343\304J\301\330\006\223\305\007\f\313\"\205\313V\tE\001\251S\367\201\240'\3571\007S\007\202\332\327\273\262\207\\\t-G\271\316\300(\363\323\355\242\332\001qI\265\216\350\274n\265n\347\252\365\022\023\257\333\007\251RG\001\265\347\264\0073\276UB\321W\002\"\244PM \231\026%$\331Y\037\033\177){>Un\224\004%\214\n\217\221\314\214P\243\236>\317\355\251\223-\244\365\001(d\346o\013]t\330\337\340G\370Q\001\n"
+	.ascii	"\357b\314\304\023~\264\027\273\212\ba\030\327D\267\020\360\313"
+	.ascii	"\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_mspSerialPush.43.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`g\005M$"
+	.string	"\nD\244\016D\200\236M:\021\337\002\270\350\324`R\327\234.\031\323;\020\313\020\200%ST*\201\267\027\017~\nq\026\005\276\270\270%\377\271\237\"\243\2300T\272<6\300\253~U\222\nR`\230\025\351\326\244\021\262\345N)\331"
+	.string	"\306"
+	.string	"\340"
+	.string	"D\272\253T]J2\320i\337\312\307~\277RchW\251\306xX\030\226\336iS\270\360\373\020\312[\353\026[\230Z\207\021<\341\363b8\214\253\225\013-L\2555\202\211\312\217\017\373\224\237M\244C%A!0#@,l\265\326\"\006/@~\244'@~\334$\336\323\341\235\233\277\353r\270\362F\216t\347\317\277q\340r\nE(gJ\255,\030u\035\335\245\365\020\322\tS3\207$K\3538\342\313\006\\YC~\243\f\320\264\001.8b\244\215|Z\017!\272`\325\034i\205\034lD\004\004sP"
+	.ascii	"\177\200ptA\340\244\324\302\235\240\226\200 \025\325\371\310"
+	.ascii	"#\347\304\317\253 p\356\277|\354\222bfJ\033W\226\326\347\215"
+	.ascii	"C\255\325\323*\230u\003\270m5\333<{\f\nf\220\374\257\217\346"
+	.ascii	"\301\230\267\202A~\f\332\023O\375\b\311L\251\225\005\221\232"
+	.ascii	"\305\255\265F\355z\331\303\250\271G\212\305b \357\021[\001\202"
+	.ascii	"k\371\207>\374\r\234\354\027\372\225\177\300\305\376\335\307"
+	.ascii	"\334A\367r\353r8\334t\251\233\276\321i27=\3564\305M\357\313\356"
+	.ascii	"YN\177AO\013\213G\360R\262\324\212U\004T\333\214fNn\366\217\371"
+	.ascii	"\275\374e\247\366\355\203\361\317N\0343\343\301;`_k\265\016]"
+	.ascii	"\224\037\035\346b~7s\332\325\264\212{\002\026\266Vk\017\025\303"
+	.ascii	"\241\023 \337\305\377b\335G/l`LH\224\037o\377|.\326\331.3\361"
+	.ascii	"5\253^\007\034\260%k\265V\242\217\0261j\241a\246\303\2229xt]"
+	.ascii	"al\254\370\214;`\311}\325\223\251Y\264\320\216{\340M\230\032"
+	.ascii	"0\320\200\265G\334N\r\033\331$~f\302F\037qDN\314\r\276\332\347"
+	.ascii	"\234\360\277\3743\024\336=\005\371q\205PM\333\232\026\222.b\351"
+	.ascii	"D"
+	.string	"k\345\332p\263k\020\246\211\262fe\026}\373\261U\227\213\214s&\315\327m\267t\005\370\031\253\263Kw\001\036` \251Y\034\267\240\021\251\310\365\362\3578\310\335\006\340\032\253C5\377\320\003\342\003\345\312\270^\026:\024\271{>*\236\006U\336\315\r\026e\255uW\302\0221\251Y\234\223\212\016\265\"t\275\334#\277\2761:T\363\217\355\026g\323[!,\303Vk5Zs\364)B2P\322\\\315\013\362\343w\205\260L\233\330\321^8\230ce;\306\317\034\025)\251\265b(\363O\276^\211&\247\245[\f'\032M\324\006/\211)\004\356\211\347[\246\236\322\023\022\317\247\224\204c\342\311\270\035=\035%\321\244%\244}\362\365\232\250\221$\3108R\362\361\234^49-\0251)\035-\025!\371\234\212$$p\257\211\347+z\352\365|E\272a\375+\315\345vN\036Um\303\2665\251\235\362u\353\345"
+	.ascii	"h8\005\307\252\352#6\211\256\333+S\034n\317\345\337A\326gk\022"
+	.ascii	"=\267W\021\256{\260G\215\223\323Zk\315\321[\356XdmMJ\004\213"
+	.ascii	"\333+\033\302u\253`\377\345,\272\244\260\251\332\232\232\305"
+	.ascii	")\205{\203It\377W\205<\231\237\241(\203\326\356\340a\336\n\301"
+	.ascii	"\236M\017\2206\300\215r\271\366\207\237A\rm\271\007\006\222Z"
+	.ascii	"\033\304\317B\330\350\006\366\266'\327\026\361f\250A<\244\220"
+	.ascii	"#D)2\022\310\310H\245\031\003`\002\031\302c\007\020hI\232\244"
+	.ascii	"\320\030\216\210\020\340\217\016\247\336\310\006XLd`5'\3133\262"
+	.ascii	"\313\2734&\326I\001_?z &\233\234\344\007\377\206=\200\030\337"
+	.ascii	"\232o\305\233IV*j\233\323KwI_z(3A\244\242\003\276u\310\232\314"
+	.ascii	"\230&T\304\035TC\232L\204\222\305\362\304\350\024\332\251\215"
+	.ascii	"\211 \030_\006\211\216\231 \n\305\360N\236\237\360\240NA\030"
+	.ascii	"Jp-\320\231\003N)L\226\032Vp\277\005\246\024\241\177#\222\336"
+	.ascii	"\331h:\220\363F3\032\026];\240\206\013FG\246\255\222\027\240"
+	.ascii	"K\326\222\225\260\b\3444\337\"\327\002\f\313\240\310\300\032"
+	.ascii	"\251\005\267{\223}\324\325\367\212\300\312\233\210\006s\024i"
+	.ascii	"\245\n\023X\r"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.44.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\b\003\335\027"
+	.string	"\306+\234K\240V\231t\300F\031\337\216\024\322\347\215\367\334\2707?,"
+	.string	""
+	.string	"L\255\305\264p0\020\343-\261\004\302@\257(\013\2041[0\020\304\321#\034)\253\344I\214\227\343\302\323a\032\030\312W\307\033\274^'\267h\013\204\b!d\313\235d\210"
+	.string	"\177"
+	.string	"\212"
+	.ascii	"w\250b\371\212\371\322^\200\371\262Wp\337\016\317\246\032\373"
+	.ascii	"\311TBO\263\264]c\374\023Fx\t4a\362\226\223\375dU\204\360\354"
+	.ascii	"\354\002Z5\031P\241\003z)%\227cY\\\360\374T\264\203F\247E\300"
+	.ascii	"+\352\271\020\036\037\273\022\244w\304V\315\317~^\236=`z\313"
+	.ascii	"\225\270\265\f\216\344\200Rr:\366D\002\311\321\217\257\270\\"
+	.ascii	"\255\366\213\257\360+R\022\244\003z=a\356\275\\o9\335\031uf\016"
+	.ascii	"\302\314\020\230\253\217I\030\301YM\373\336+\353\3661\017e\365"
+	.ascii	"\267S0\247>D<\237fi+\367\203\347\332\225\237B \245\031\r\375"
+	.ascii	"|4\322\360\216H\243\\d\271\243\305\207~\342\037|"
+	.string	"3\237\371F\376q\b\204\b\344/\371\340C~\221O/\211\314\303^\032\327\366\200H\241\027\367^\025\372\362\3148|!\237\036\214\375\352\356w\222~DI\356\035\272\274d\027\364%?\306\205p86!g\226k\371\365\260\035\223n\027z@$\035\036\255\246\265\324>F\265\331M\004bd\374\241Rcd\352o\250\266\310$\020d\255e|\035(\242\374P#GE\216\316\001\2371{u\0343\350o\204\240AY\274\354\206\355\2308\251\300\035\244\023f\373\270\232h!;*\331\362n\007\235\213M|\206\330\366\335\230o\227\221H\255>a\346\r\267qca\227l\300\314\255\327\250\271\320\016I\322\275\327\301\214\323`\361Y\274\344\016\257\372\333K\276\007\363\345\373\307[\242]\253\225+\302k\005\273\311P\372\260\322`C\001\346b\265J\260\225\253Y\346\205C\f\215k\365\302\320z\325\250lhbjT2\256\227\352\245"
+	.string	"\263Z+\227\n\306b\271T\247\341\2755\231]k"
+	.string	"d\022\nr\326\264S\3738ETJ\331_\221mFu\371\3318\266\245\262/<\232\364#\262\345\250"
+	.ascii	"\3224M\337b\232\215S\360\363\200\222\037K\214Ej\365\311\355\275"
+	.ascii	"\367\232\332\307?\376=2R\036\212j\266\245\331e\343\230\023\374"
+	.ascii	"\354T\277\370; `\002!t\271\003\177\f\263\241u\0046\241\016\307"
+	.ascii	"(m<\325\306N\215d\233\303[\217\226\026Z\244\b\201\230\005\326"
+	.ascii	"\305X\370\240\200\364Y\233\256N\335:|\327Y\230\236\213V|\315"
+	.ascii	"\244\266\234\323&\3137[5\333\203\267\004^\253qT\226\024;\232"
+	.ascii	"w\t\331k\324\n9\374K\321\345\270\307\243-\316\3601\333A\320\b"
+	.ascii	"\203E\310\216\264}\227\246\003wh\r\003XF\353\320K\313e\230\b"
+	.ascii	"U:\334\360\274\361.\233\332N\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`i\007\355\035"
+	.string	"\346\257\261CplM\007\330\367\206\017\251\372,\323;\246C=\321s\227x)\314j\316\251V_VJ\313`\2651\2036\240\320\300"
+	.string	"(Y\033\372#\376\002\302!\030J\323v\350\226\203\217$\271\262o\r\245\t\331i\247\024\245"
+	.string	"\234"
+	.string	"\230"
+	.string	"\377\240\323\254\2249\t\307C\350\033\377k\333v\221\215\207\252\361O\035\205M3\307\352\025\334\360\210-\251z'\032\237\200\234\361>\031_`\354\030o\004#\212\306\314c0kM\241\027O`t\361\b0`\240Q=R\013~\323\262\370\243\025\177@\305\243#\373\311\242u&\3053\215c(\336\300H\236\370]\207\034\255M|\323XBGs\346V\2758\f\220*\343\363\205\304\367F\\H$\342\227F2M\3234\304+\241"
+	.string	"a\201\346m\333\266\037>\251\226\006\203Yj\230\237\371NVOi\235\231yx\336\310\314"
+	.string	"Z\004~\256=\323qeM\303\362R\343\246\343T\237\351e\261\233\r\230C\244\351\267a7\2261\2562m\272-(\300\364\332\332\036\210P1,\201\351\275\366\021\236AZL\246\267\332\026\354\230\321\3233\275\307t\371\241V\261\335\264e\005\316\222"
+	.ascii	"o\"\202\3227(\225^\033k\322I\254\007&\371\bH~\301\221g \374\006"
+	.ascii	"F\336A_=\207\251\317s\212|\206\340\263W\023y\376\352\364y\375"
+	.ascii	"\347b;\344\245\204<\303\t\362\034\007\3103\330\217g9>~B\217\247"
+	.ascii	"\300\343%\354\370)\035_!G\017t\316\242\373LK\013\306\244\363"
+	.ascii	"\262+G\342\2067\347%\333\255uf\226\247A\316\255\212\347u+b\217"
+	.ascii	"B*b\262\374\256[\005\317\353UD\031\013\256\307P\273\205t\304"
+	.ascii	"\276~\327\251\250\324\337\365\025k\003\001\031\342\212\272\216"
+	.ascii	"\026q\327Q\342\357:\257\214\257\363\324f\262+&d\242\256\343\212"
+	.ascii	"8"
+	.string	"\365w\275,\353\346\353\033\332\031\\/\233N\277\2617\265\233\314\260]\235N\267\021\235N\257\261\355Zgfb\nNo\266\3074M\211<\235\336*\324\3515\265\035\214\354\252\311\022.\334l\267\230\026Eh\236\222\274\fvS\341\262e\354\"\271\206&wGG[l\270\276z\007\234\007\005%\221\206=bU\351\322\241\216\262]\363\362\207O\017u\243\265\3115\354\223)\324\t\fk\250\017P}('\"\344D\230C\275\\\333i\253\013\231\017\r\200\272m\330\035VGP\227\211\266\021\256)w\240P\367\371P\367\361\274Y\245E}\236\264\001\026\360^\225\214\270\210H\n\0134\362\033\013a\347\267`\271s\333\332\034\246\344J\240\b;\267\251\335G\366,\361\"a\347>\251\235\333\210\016t@\241\2330\001z\250q\030\205-$4#\"\205Q\265\030\320\002\251\241q\033\021\220\034\n\221\"\022H4&\201\f\311\016u"
+	.ascii	")\270\026B\262\013|=\361^\027\020\270\203E`C\313Q\"G\226\330"
+	.ascii	"\211/c\311\274\3240\210C\246\320B\236\264\220\273 \026\022\323"
+	.ascii	"\231\246\225\344\234`\303\331x\246n\301\361b^\316<\325\252^A"
+	.ascii	"8\b\020ysrgJ\272\346\002Dv\377\351m%:i\t\351]\353\025I\223\005"
+	.ascii	"\243E\253}\355k?5T\340\225)\002\034\356>\370\267b\316j7\311\""
+	.ascii	"\376=\335\016jn\233\230\236N{r\037\361Q\374#\0342\022\025\242"
+	.ascii	"z\360\242ev\255\330\3330\224\320\345\022\314\016\300\264\256"
+	.ascii	"+\366i#\352[\2259F\016\271\230\220\242\321\364\232C\215\365\351"
+	.ascii	"\334\004\024\345oxb\206\275\211<\303\233m\252Bf\314=\353;\364"
+	.ascii	"\256\361A&\251/pn\217\032"
+	.text
+	.section	.gnu.lto_.refs.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375 \311\025\004"
+	.string	"\222\211\031\035\260'\303\001\f\3030\f\303@\003V\332\232\272\27355$\333\004\023\222\354M6\331R\246\277\276\230\202\257|v:\301\035\375F\237Q\376\224\247\022\221\314\265\247x\340\332\300\002rx\t\217p\200v\032\316\206\257\241"
+	.string	"\235\0023{\351+\375\324G}\226J\232Q\033\240\370\262\266Z\217(>u\222\274\322\310\036\337\376G\t"
+	.ascii	"7\003\244\002\t\230k\262\332\337\306P\021\002h!x+\342+]\352\f"
+	.text
+	.section	.gnu.lto_.decls.772e92aefa2ed4c8,"e",@progbits
+	.string	"(\265/\375`\236S\325Y\001z=\356{U \016%\225t\235\033\026\026@@\004\004P"
+	.string	"\021A\001ET\215dpaa\004"
+	.string	"E\021E\020AUTL\314Z\033W"
+	.ascii	"\\40R"
+	.string	"\234 \230\\\341\240B\262\335r\337M9{\017\326\270}u/\036\216V\002J\244\347\232\303\030DWj\2656\3226\331[\356\024\205\006\303\007\344\007/\225\314\f\271v\300\235\353\016\376\r4\377\016k \302$\3009\265\276\r\244\177\244\231\347\006\213kF\227\276\277y\346/^\373\370\341J\002\245\357o\026\363\367\211\331<\216\234!C\353\373Kf\376\352\300\3219\312\026Y\222\274\300\302q\251\266\372F\307\300\202i\255\357\257\322\026\032\363\357\254\267\215\277i\364Uec\001GL\234\230`\337\256!\342\235U\223\224\266\303\252o5\3533o\322\272\2033\2141o\271Pu\214\332\202k\255L\337[*\353fV'kf?5TMO\327Q\277!\343\307U\337[2\363\365t\270\005\365t\370\366\313\254uu\007\337r\231\267Vf3u/u\fo\246f\361\017B\370\rR.\3139m\246\233\263Q\255\005\310\251\265"
+	.ascii	"\245\234\227Q\032\276\2670\314\333\344\345\032)\353X%\\i\266"
+	.ascii	"\364}\357\231\357\273N\346l\001\034\243\321\367=\305\354\334"
+	.ascii	"M\314\252Ww\360_\323\004\226isD\214\372\326\300\2478\326\210"
+	.ascii	"\312J\0234\200\215\244\225\246\326\367\177=S\377\252_M+`\345"
+	.ascii	"{\355\253f\034P\001\253\222\372fS'&\013$K\200\325I-c\317\240"
+	.ascii	"<p4\250\207\344\257k\2005\t\027\223\036Nf\312\2523/\316\252\035"
+	.ascii	"\360\355\352\016~\247\346_\237\254\325&\225Lgy\270Y\263\242e"
+	.ascii	"\257\357\036\217\215\035\226\230\261\276o/\363\177\035S\305T"
+	.ascii	"0\025\257\346\32505\255z\365\356\265K\365\362\233\346\214D\205"
+	.ascii	"\256\32659\312\323\3139\277\306}A\003EN\230d\013\320\001\277"
+	.ascii	"\210\252W\263T.\366\f\312L\222"
+	.string	"6F/\212\224\312\226\223\314\220\217\266\374\201\345\234\276\226}\020B\325\253S*\233M\301\362\321\026\270\n Ey\022\346\227s\312\323\201M\036\216+)9\367u\317|]\355\200o\352\016~\275bV-uKM?T\273!R\232\325rNu\206we\256\330\372\276\312\231\257\037\260\316\007\374\312V\261T\265$:\320\364}\375a\326*\325JM\347*\225_\264\254\254\226s\306\261\341r\302f\324\367\205\234s\256\227\303\302\301\301\301\301z9\374\332e\336\272\2035\250\035\360\353\013\363\325\310<[\355\200\337\202y'\265\003\376\224\332\001W8\021\257Ov0TU\232\331r\316:\003p\223\203\353+\254;\370=&\316\265\003\256K*\223\232rP\335^\333*\222\227FiNsNu\232G\232\266\264\276\017\201\371\312\001\266\203\203\225\003\374\013\230]wp\306\021\034\"\210\246\357C\230\257\253;8C\355\200\377\252&"
+	.string	"\235\224\312\351F\337\277\246\375\265H-\253hv\251)+\263\345\234j\2601\030\341k\322\267\032\251Gj*\200z\366\017B\270M\242\245e9\247:7OO<\262\372\236\003\363\325\354:h9\204\267\371*"
+	.string	"\\\007\253"
+	.ascii	"\360\323\332\001\233u\007\003\271]X\365P\254W\033*`]\341Xn\200"
+	.ascii	"\277\364\372\373\313\332x\273\252\026\250$6h&\337\371K\031\177"
+	.ascii	"\367\260Y\215E\200\2645\356F\202\305\372[\303\013\366\352\357"
+	.ascii	"\026\226\006\211\rLkeg\020\2409\274\002\1779\365\267\206s\260"
+	.ascii	"Ak`e\374\275\342\202\377\226\371;\205}\361\327\r\364\237\235"
+	.ascii	"\372\353\005\202\254T\367\330\250\277\223,\324\337i\354\323\355"
+	.ascii	"\372L\265\300\340_\r\360W\223\203\r\254\213\277\t@\342 \374%"
+	.ascii	"\006\r&\215\305_\253\234\260N\377o\376\362\350\257Q\376*\345"
+	.ascii	"\257r\377\355\\\210\373+\225\277\316\321}\203\326p\267s\370\357"
+	.ascii	"\227\277\266\375\266\305\337*\330\030\376Z\343\252sZ\347\036"
+	.ascii	"\216\265^\272\277\216\350\fN\240\340\004\226\251\205&\200\212"
+	.ascii	"\333\344o\334B\013\201\277QX\372\353\004\354-\213\352\365\016"
+	.ascii	"\177Y\202\277f\340\257\036\2301a\225\376gp\234\377\236\375\275"
+	.ascii	"e\223\254\003~\013\204\3647\210\2777\370+\032\rE\025)\250(\370"
+	.ascii	"[\204z\202\016\377O\360\324\025\354\321\337%X\243\277E\214\270"
+	.ascii	"\210\377&\375M\343?\232M\332\f\303\337Rv\305o;\370o\367\302_"
+	.ascii	"\305\350U\025\277\365\260\202\277W\260.\374U\260\377w\275K\301"
+	.ascii	"_\317\277\236h\256\337\026\375\026\265 \202\376\n\364W\342_\001"
+	.ascii	"\277\301\026y,P]\241\362\375mI\334\204\277\324\200\251\302\246"
+	.ascii	"\315\244\370m\206\263\003\325\264?$\356\341/%PWx\315_r\360\377"
+	.ascii	"\354h]\002\374\337\261\277\352\3755\357\257b\376J\246\365,\212"
+	.ascii	"\277V\340\257\032\220\300_\357\376\312\345\257_(\360W\r\376\212"
+	.ascii	"B\004j\t\177%\341\257&\324\021\365C\006?QIT\263\304\201@5\277"
+	.ascii	"\341/\213z\214\370\023I\310T\360[\022\376\316\226\205\337\236"
+	.ascii	"\320\363\333\022(\370?\346\267'\370\033\310\337a\326\004\377"
+	.ascii	"\277\374"
+	.string	"?\263@\t[\202\337^\340\357\r\254\360\337\312\177\016\252\327\001\272\346\035\374%\361\257'4\235%\301_!\360W\013\374\325\013\214\035\201YI\374\235\374\257\341/\355oE\360[\025~k\342\267 \370-\n\277%\341\267\021\370\255\b\277\005\341\267!~\353\301o\023\360[\236\337j\370-\316om~;\374\255\375m\375[\360o\300\277\317\374\275\367w\230\277\253\374M\345\357(\177\277\375\315\344\357\266\277\323\376>\373\233\310\337d\177\213\375\r\366\267\327\337#\376\326\361\367\215\277\257\376\236\372\273\351o\245\277\223\177\257\370\333\205\277\321\277\215\177\013\375\255\342o\024\177\263\360w\t\376\036\376\025\360\257 \376\212\200\277\222\371\353\227\277\216\360\327\372\267\n\177\275\372\253\n\376\332\201\277M\374\r\202\277;\360W\251\277R\3755\371\367\006\376F\341\357\004\374\365\304\337\"\374]\302\337\017\370[\304\177\273\377\031\374}\200\2775\370\233"
+	.ascii	"\177{\370\217\345?\232\277\336\277\232\177\365\3607\207\277~"
+	.ascii	"\370\277\302_7\370[\303\377\r\376\273\375U\303\377$\377O\374"
+	.ascii	"\325\203\277u\376\316\371\033\347\357\233\277k\3766\377\276\177"
+	.ascii	"\327\277"
+	.string	"\242\371\253\337_\373\376\272\302_\313\374\025\357\257Y\376Z\367\337\304_\261\374\365\312_\255\374\265\312_\351\376\312\344\257_\177\365\372\253\217\277\036\377J\364W\343_\207\376*\364\327\240\277\266\360W\022\377\003\377\003\376O\373\217\366\277\351?\335\177\f\006\007\007\007\377\033(\277M\221_\002\203\001Q\031\226\324\214\242\226\220\264\242j\232\225k\226\270T+\251\224\325\214pr\316M)X\362&g#\250\234\324\322NYK\317)c\345Z7$\275\221sN\262y\331\312\032\246G\271nI,\013H)g/\331\t\204dM\2469g\026\371(YsVJ\241r>\312b\241*\347\234\263\252\035\013\250\214\223\221\214\232\216\266\262n\224\216\262Xd1\0335\347\234\243\226\324\266\262D\300\255\251\201\345\2434Y\227\232\2622X\366\242\005e\252%k\031\0345\036UM}\177ce\376\227\354cqE\266\364\304n\220+\244\262\261"
+	.ascii	"\210\206\212\254o\006\275\332\001\267\213\272\203o\230\210_\261"
+	.ascii	"\241\0264n\202}\333\251\356\340\373\343\013\256J\023\224\276"
+	.ascii	"\277A\002\373\252\241\001f7\310\343\367\353\372\300G3\306b\364"
+	.ascii	"\275^9"
+	.ascii	"nIy\177}o\343w{\334\035\2354\034\022cIW\337\253\243\346\353\207"
+	.ascii	"\233\213\2767\307\320I\232+;p\374\037\n\243\204\211\222\206\343"
+	.ascii	"]]ml\227\313E\032%)}ocg\376\367\306\335\032\333\201CJ\337\253"
+	.ascii	"U\222\201!\241\352{\033)fM\3624\366\244\357\255!\354\322\241"
+	.ascii	"#\254\357m\320.\326\275\032\346.b~\227\306\357U \240\235Q\337"
+	.ascii	"\367]\253\377\303:$M\027\245kug\f\241\343\243a\001S\260\005\306"
+	.ascii	"\312\225\321[L)\273\274Duc\340;\250A\2450\252\373\242hc\314\256"
+	.ascii	"\357m\356\324\215\322\221\322W\303I\337\333<\231\251\215\023"
+	.ascii	"\254\266\027\351\020N\315Kv\361zE.J\314\236\323m\352\267!dEn"
+	.ascii	"\023\227\316\202\312\0360\027'HVZ\3040\244K\342\226\366\335\313"
+	.ascii	"a\302\022f\215iI\f\252\312\251\357kz\227X\220\300rR\346*\375"
+	.ascii	"\262\270_\222\230\246\372\276\257\303~\207\207\246\356&]$\245"
+	.ascii	"\263\253\035G\277Hl,d\017\032\346\240j\364\375@\304\357\021\031"
+	.ascii	"\024\033\177\327\350&\205<]\321\350{\263M\343%\307\2141}_#h\336"
+	.ascii	"\001\202l\2035\265\202\267i:\340\021\222\0314\222qo \23205f\274"
+	.ascii	"\365\265\200:\3114P\234\372\276\206\214\371\333?\277\262&c\322"
+	.ascii	"3\267~\277\r\263F\216_2\326\372\3266\021\267g\254\223(J\201f"
+	.ascii	"\372r\360\206L\351{ec\301\203\225b\222\026\204\257\314\022\227"
+	.ascii	"<\265\276\226LYDH\220\254\276\257\2613\363:\n\023\275\226R\337"
+	.ascii	"r\2422d\244#\2671V\317\356\325\324\346\335\206\261b\254"
+	.string	"\020\244<\273\245\276Y50\223E\332\233^\316iZ\032_\223y\313\272\203\301\340\265\261M\021\353k\277\360\350\260y\251a\365}M\024\363\277\355b\357jj\275\334r\251i^Js\316\017\241\245\224Y/v\313\030\030\236\237\037\276\362R\245\013\337\337\332\375\303\032+gd\200\365}M\023\3635J\314\337j\331\312BU\327LE\242l\261Y,\371\312\007\234\277\273#2+s\230\317\214\016\246*t\3026*g\306\232\334\322\335\316\325\330\305!\221\352K\345\232G\236\222\254\372\276\206\314|\365\022gU\346d\206\234\205\343\222\0016\305J\261Q,\224\232Z9\373\344Z\271\226R\337j]\216l\224\034!.\327\\y\321+Rs_\243\303|M\f\3635Q\346k\220L\373&\342\266\t\026\374k\301\326W\307\272\251=\205\311\002\243\357+\022\263f\3028\316|\004\372\235e\333\305\206\217@2!c\266H\255\253\232"
+	.ascii	"\231\231\2365r\304\bX\031\216,>\002\375R[\204\305\017\037\201"
+	.ascii	"~j\026\210\r\222cs\326Z\002\226s\026\241f\177T\266\234d\232\237"
+	.ascii	"\204:\316|\004\372!\261kV\211e\263m\226\211Mb\227\324\324\252"
+	.ascii	"Y\264\333\264\032\367j\023E\354\210\336\206kSw\360\207m\346\207"
+	.ascii	"f\346\207A\314\017}\230\037b\231<\265\003\376\320\205i\311\354"
+	.ascii	"\220\232\362X\"Z\216\\\320\350\373!\013\263\005\271\362\340\017"
+	.ascii	"V\036|\263\317\374`\305n\203\250\215\201\222z\365\265a\"n\305"
+	.ascii	"&\300\343\006\221\276\266\356\340"
+	.string	"\233x\346M:\363\267`<8`\002\255\\\371\362a\003#Ub\346C\253\353J\221\276\200\201\326h\004%\250\341S\332\016=*JX`\366(\251\006\230=B\312\241\327d\305\327\327\177[\274\240\354\324\026'\275\234\323\247'\275*Kc\004%\250\341\324Q\f\r\330h.f\004%\250\241\322\026\036eN\225K\016R\206\214\2645\003\314\036\261\270\262KX\226\311\266\030A\tj\330b\013\r=>\213U\351\276\\\310\260Y6\207\275a\275\354\016\313\303\366\260Z\326\206\325a\267l\r\333eq\330+\313US\213\325?\220,\226}ach\360\343l+\320/\3474\007\255\207Sj\200\373[\032\326\212\355,\f^z\201ti\362egX\031\370\310\226\034s}oz\2317\273,\225\316\031'\276\273\2767\255,\f*+u#&\365\344\243\357\315%\033ef\363\3023\346\205x\346\205V\314\013\241\230\277mac"
+	.string	"\373B\023\323\267N\347F\260\310\026\033}/\\bjPw\360\205G\314\013\177\230\027\3360/\214a6\240\356`\233L\212\213\313\321\367X\320|Mm\376 \326b$\257\365\355A\035\257\267,7\372v\232\3726\370VE\256\357\373.\346\377\320F\312\216\255+}\217\313\230\307v\346\323\272\203\333/\006\227\221\230\276\307o\346k\332g\314\324\244\361q\305\257\357\377A\b\037s\223sY\3169\003\034-R_r\337\3433\363N\352N\0312\345\335\337S\221\024\311\006S\226/{\215C\017\003\341\030\\\215\256<\016L\244\270%ec~\201\310!\331\020C\2476\307w%LwI2\227EJ\337;@J\313\345\2249g\201\001\353&N*[\255\253\232"
+	.ascii	"\2211\335\245\251\264\226\f\216\226:@\206\327V]:Je\313\2619c"
+	.ascii	"\205\001\303\353\273\366\322`\372KM\273Koy\3335\227.\r\327r9"
+	.ascii	"Fi\206\022z9)#\304/\347<D\343\032\374rskZ;`\236\272\203\217k"
+	.ascii	"d\341\251.\264\304\245\351{\\e\376o,}\245\246]\327U\336V=\345"
+	.ascii	"<i\316Lr\316\257eV\232.'\251!\347\033F\300\352z\256\35128Z\312"
+	.ascii	"7I\232G\206\354\036\245}\251\202\357\313>\363\345\030\363o:\266"
+	.ascii	"-V\232\216\372\276\3043_\336\2315\327\016\370\245\026\363e\025"
+	.ascii	"\263\237t\\M1h(Y\247\222\311q\024\325\367%\024\223\0059W\fp\035"
+	.ascii	"\034\254\030\340\227n\346\3134\263\001\375\346v\243\007gfG_&"
+	.ascii	"Y4d\\\365}9\304\254\202c=\004\004Px~d/Z\255g\244\345\211\330"
+	.ascii	"\321=\266\200\321k+\255\346\312AJs\024\005\234\340\371\221Q\351"
+	.ascii	"\243N\002\301L\017\317\317o\n0\204\026i\376^\322g\235\244\211"
+	.ascii	"4\222F\353\262^\353\"m\326J\372H\263uZ\267\265\221Nk\332j-\366"
+	.ascii	"\016\322B\316\323V]\255\303\236A\231J\216\3024U6\020\314R<?\277"
+	.ascii	"*X\007\333h\001p\031\317\317\017\254\303FP\202\032\272H\373\242"
+	.ascii	"\327/d\370\201Y\265Zc\265\r\233\202\241\2605F/\347\354\325_x"
+	.ascii	"z\355\244\326.Zj\004%\250a\f[\320\350y\371\373E\2535\214\256"
+	.ascii	"\252ul\331H\352\203\031\024\236\237\037\222\017Bh\265Vj\246Z"
+	.ascii	"W\225\223{\b0\253\303\363\363\3139\355\200\247\003\241Z\226$"
+	.ascii	"2\004\\\262\033#\252\267,}_N\231\001\031\322\2430c\364\250\324"
+	.ascii	"\201\311\n;\026\033\234*\223\246/\006\202\251\276d\ri\243+\353"
+	.ascii	"\353\240\345\345\205\277\252\027T\036\231\332u\304\207\027\366"
+	.ascii	"q\374e\223e\203\205_\207'\214\003\343\300<\310\334\204\0213\362"
+	.ascii	"\205w\034\363\300\t\002eg\244/\326\321\001\030X\\_\234\343y("
+	.ascii	"\022\331\020.\370\312S `\337s\b\3043\216i\340\031\230\313nYB"
+	.ascii	"$\247E\236\026W\215c\256\343\033\037\204p1C]kk}\361\326\253\216"
+	.ascii	"2kK}\217\265\206?\3020\021\354\213m0\340\n\320F`\337\343\254"
+	.ascii	"\034Z\274\202\364\355z9\214\261\234\236\004\271\352\213\257\236"
+	.ascii	"\207\303\344,\007\rl\32575\205\253\334\262\362\310\f\255\330"
+	.ascii	"11\202c\034W\321\t\321\370\274$\373\276\017S\375\037\236\340"
+	.ascii	"\202\207\005Sa\030`3\312\244\311\222\205TG\200R\360\213\256R"
+	.ascii	"\257"
+	.ascii	"\244z\230\365=\0071\370\t?\341\250\212\226\2378\304\331xyC"
+	.string	"\222\003C\035G\3418\241\332\361\306\001\016;a'\270\255@?le\213i\211Y\213\026%\231\n6r\370\236^@\371HJ\302L\025-?\201 \313V \024\2442\034}\177\274t\314\204\323\365\367\344\252/fq\005k\236\372\356\302\372b%\0165\360\021>*\311*Z~\342\221\373\201\261\204\361\301\001\ng\234q\262\315\310\214\n\007\240\021<\234\374\372\223\221\225\246\35790\005\006\226\202<Y\311=\004\300\355m\005Z3Ob1\322\274\024|A\005\255K\360\357\377+\001y\262l\027-fTdf\214\260!L\200=\344\206\2112\030X\245L\231\362\fOVr\357\003\334\331V\340\320\311\306\331\214\322\314\3133\\[zl\365\335\244\311<\246\354+\371\206d\302\200A\3129\262\002\303\321\367;I\306\214)\367*Z~\3028\264\024)3\333\366\312\214\350\275\334\253b\005\207\327\267\314\023\301\316)J\337\367\t"
+	.string	"\314\233\035\226\276\337\321\272\362R\313\2252\214\275\273\311I\264\374$l2GD\210_^\252\372`s\326\342,K\227\227a^\202\371 \204\2131\311\204\334\031\365-\361\236Se\345\211^\337\227^\312/\377\260&\214Km\254\357w\216\3143"
+	.ascii	"\215**\252oyw1-&\246i\257o\311\345r7U]\374p\364}_iwek\313Q\337"
+	.ascii	"rK\316\023\026mt}\277!\320,\353^f\371\207\303'X\\Z}\277\201\317"
+	.ascii	"\374K,\377P\250\344\316\n\254\3577\344\231\337\340\305\244\243"
+	.ascii	"+\253\360d%\311 \340\207\2232B\374r\256\372p\255\214\004\231"
+	.ascii	"T\351\244=\251$*}\277An\312\224\222\312\f\214&i\363\324\026\330"
+	.ascii	"\326\267\244R\271\340\215\325}\365\375\206\324\211\2232\n\224"
+	.ascii	"\261\032z\227\251)\206\224\334\313(8y\2005\204\364-\241\324:"
+	.ascii	"\035\033oP^\372\226q\225\355H\fcO\372\226O\232\316\226\321`;"
+	.ascii	"\322\267\204\273\234Es\233;RU\343\004\244K\006\220\267\26728"
+	.ascii	"iZ\224\323\215%KJ&}\030\213\r\234\325W\244o\311d\370#l\253\251"
+	.ascii	"\3577L!AR\266\341\270\275\2739\262\234<\030\206\204\355e\233"
+	.ascii	"\016\322\321\024\301\276e\222\013\343v\351\251\231\365-\327."
+	.ascii	"\220\034(hP\2246\030\245\245\225`fpX\335\262\361\003K\337k\350"
+	.ascii	"R\226\225e\345\031\021\374\343L\270w\204\214\2574\362\362\254"
+	.ascii	"L]\310yI)\323\322\314EY\0329*6fe=\232\224G\354\023\034kZ04\274"
+	.ascii	"\021!R\202\2319g7\260\\U\365a\350w7\306\244\3575\350\020\"\244"
+	.ascii	"$\033\033\033\362W\245\357_\216\275$\253\351\262J\226\t\326\231"
+	.ascii	"1\303\326\367\032\230\314\277\004\002\244\024\333rE\303\003\263"
+	.ascii	"+\351\213\2212\254\256\245iP\372\246\034\252\306\\\364}\206A"
+	.ascii	"\363\353\253\004\343\371\021U\365\241\344{\272\253\321W\323\022"
+	.ascii	"L\213\230\017%}\237\301K\311\243\344Qz\375\355\335\315\371\365"
+	.ascii	"x\3515\246\341\232\252`"
+	.string	"\364}\237\223\222\340Y\337ghb\276\354\252e\216\222\253\324Qv\335\\\225\363\224\002\306\242^x\360\fk\3463\0241\313\256\3160\306A\316\021.gD\320\206K\212\2105\365\255Q\243\274\021d\357n\216l\353\345\r%{\177R\372\226Z7\2052e\343L\337\322\306\265\272dW;\222\372\226Y]uTEC\t\016\0300\312\253\3169g0a\022\246<\275\222\306\313+\271\234\260\"=\314\372\226V\235\374!\026\330\267\234Q\323j\216\271\037L\372\2262.\307\003\212\336\\\337\262\252\246\231Vn}3\372\2261.g\246\221!D\260oI\225\341E\351\242tQNU\253\344\335\034\231\324\313\251\034&\246\036U\372\226QM7\244j\017H\337\022\252\351\206\374\340\361\326\267|\3229S.\225KeS\220\263\026/\233X\3049\201\351[\306pS-\035Bn\364-\231.\f$N\234\314t\262\224G\345Q\251\324"
+	.string	"#e\322K\245f\252\2412CF\326\267DRC\203\246L\2329\347\2572\277L\326\250\351\255Y\365\275\203S\246\270\366\372\336\300+\230\335\242"
+	.ascii	"\n\3364v\212\013:\036W\353\316X\002\205\n\323\377\341M\f"
+	.string	"RqX}\2573\346\347w\377^\241x`#pws~\357\373\375\273\251\245\352\002\343H\337\353\230I\257\231\312V\323\374T\343\004w7\347\227\241R\017\256\343\264\267w\371\254\316.\337}2\230D\353{\311\324\2670\276\031VRAn\360\020\353\373\0343\346\177\363^\323\233w\243T\264\234\324\321\261\347#P\030\304\352\307\023\225/_\256\230\316\3129+\345\025d?z\350\205\371\025\323F.\252\244\260\200\321\3412\372\n\002\006\257\205\224\036\236\016\222\2610\256\276\317I\355\354n\227g\3109\037\345\214u\205\243\316\356~\273tT\027X\226\276\227\213\207(R^7K\311\353K\256\357s\264\314\377jyM\257\226\013\345\242\345\244\r\227&\2519\277\234\253<\300i.\360\372\372>\307\205\025+\267n/\2043I,\277ucSZQ\372\336+(h\022\263\245\357\373\312-3a\232\364=\216\237\024)\227nH\246"
+	.string	"1\346~\351*\333M\027U\334\221\276\227Je\373?\264w=\340\002\373\336)5\rg\020pPM\356\377\360\302\200+b\245\357q\266\230W\256]\b\232\221\352{\2347\363\3061\371\"$I\337\343\230\231\377}\253\351}\273p\303\245\013\345\313\205\373o\223\353\244\335nT \373\013\354\333"
+	.ascii	"\214#\304\374/\223\232^&\226.\003iN\346\270\235\335\315\371\341"
+	.ascii	"t\231mWI\216\231\026}R\372\036'\252m\355&!\223c\320\350\373\233"
+	.ascii	"?\363\256\335!7\355\252\335\261\232\245\2408\340\004\250\227"
+	.ascii	"\241\240<\370\r\031\363\227\310-\362[\366\262\213V\225\223eD"
+	.ascii	"X\331\273\233\363\313UP\037.ZWI\003/\320E\337k\344\246\377\207"
+	.ascii	"&\2222\245\244\233^35\254/SL\2063\210h\331r\244\305\354\213\271"
+	.ascii	"\257= \377\2079y{,\320\364\375M\020\363\177}\3778\033A\345\234"
+	.ascii	"\245\3124C\035\335\340\277\276\226\265~\370q\252\255\006\370"
+	.ascii	"\177s\376o?\302P\316Gk"
+	.string	"`9\347\312g\20651\262\322 \377\377\207\234\2235\347\f\265\244\246\225\324\260\244f\224\227\220\324EiXR\323\212ZJ\263\r\017Y\355F^J\263\2227+\231sNvN3\222VTF\312J\022-\245\031*\247Y\311\f\031)*\303Rj\224\\R\323\212\252KjYQKjYQ\0322RNf$#\033&RV\324R\225\254\007\002q\n\025Q\f\220*\234B\305\023DB>\303#\021\310\347\242CE\253b\250\210\002!\213C\305\023\214'\216\306\023\320\"q\005\t8\221\306 \037\235\237\241b\n\016C'\2211gC\211\027N\017\374\f\025S\360\034\b\304\b\343\t\244\207\003\201(\006\371\204(\006\371\034Ot\310\204b\220\217\231\202\361\004\220\017Z\\\201\t\025C\305\241\"Q\350L!E\021\n\344\206\r+\210|\204N!|DK\244(B\201\024\256@\211\204L@\213B\310!\342\361\004\262\030"
+	.ascii	"\rCE\025\347\210\024E#N\264x\024\301\317\220\t\305\240\240\242"
+	.ascii	"\020\376!\326\034\b\304)TD\001\2004\036}\212B8\205\003\201\360"
+	.ascii	"9\372\360|\200\354A\341\302O\317\b>G\037\233\003\201P1T<\242"
+	.ascii	"\310\020"
+	.string	"\347OQ\220\317P1\304\021Y\024\342\202\240\240\242\241!\343\220\020\3559a(\"\361\n\214G \3248$LA<\203.z\"\205N!\274\341<\217' Ot\305\210\027Np"
+	.string	"B\026\225@\213C\032\300Q1TD\213D\021d@\236)"
+	.string	"\340D\301\004\002~Rh"
+	.ascii	"I<\203\316\024\220C$z4\2268Q\242\2171(\210\204\022<f\003@\370"
+	.ascii	"\024U\020I\020!\205jF@\202\204=\177\214>C&\350\374\f\235&6\210"
+	.ascii	"\b\301\361t\341\003\037\204\340\024\"\036O\350@D\211%d@\002="
+	.ascii	"\221\347\361\006}\341\364\300P\221\021\003\034~\216F\2373\205"
+	.ascii	"\013\210\220$2\340\021\300N\207\024E#0\300\001E\232='p8{N\242"
+	.ascii	"\025'\216\347\017\321\030\204\032\215(<\340\373\020!\205\bp\237"
+	.ascii	"\342\361\034:U\230\007A\004\006\2100\302\013B\021 R\024\215@"
+	.ascii	"\213\214\346\005gO\nDH!\033\024\271\203\036\321\022C'\254\b\""
+	.ascii	":S@\"O\037#\207\263\247\004\"\244P\316\331CD\211%\020!I\f\031"
+	.ascii	"=p\242\304\242 \242\013&\020!\205<\240=D4\350,\341\024*\2426"
+	.ascii	"h\317\007F\220Pa\003\031\320\017\320\036\021!8\236?\3043\003"
+	.ascii	"DH!\234\037|\302PD^4\210\210\032\321\034d\017\022%\242&~\206"
+	.ascii	"\210BBF\f\020!\2054\240CEF\237\022\251\302\n\237\241\023%v\340"
+	.ascii	"\005\242\320\315\201@ \211z\320\243\221(\204\n\242\004 {\316"
+	.ascii	"\240b\n\343\261\004\207 \243\317\020E\026\245\340\207\204\025"
+	.ascii	"\030\217C\364x\2720T\304:H\3449\204\002\251(\036G\234h\021h\005"
+	.ascii	":\330\004z4\226XA\f\"B\026\1774 \317\242 b\b\216(J\254ia\250"
+	.ascii	"\0304\342\364)\272p\226p\"\213rB \217\247\013\305\343O\b2\234"
+	.ascii	"A(\210'\\\300g\317\371c$\201\036\215D5\347\217Q\350\236=\037"
+	.ascii	"@\217F\"\034\344\220\261\210\022\031\205'JL\341\247\210\210\302"
+	.ascii	"<a(\2328a(\2320Q\363x\363C<3\020T$\2368\236)R\024\215x\001\275"
+	.ascii	"9\242%R\340\251!\242\304\022^8\346\034\321\022\032h\301\207\210"
+	.ascii	"\"(\210\210\2013\350\247xs \020\035\220=6\350\201@\244(B!D<\217"
+	.ascii	"(2\304\220QH\310\3503\200\237\241\323\"{R\024\241@\342#JdS\024"
+	.ascii	"\241\260?B>\026\251\202\030\224\242\024\242AE\310\363\210\317"
+	.ascii	"c\361g\210\036(\003\264\007\251\202\n(\t?\247\013\305\323\347"
+	.ascii	"<\336 {\320\243\261\004\021Rh\210\354\271A\217F\242\213\366 "
+	.ascii	"I\234BE\324D\222X\201\026](\242>$\240HbP\316\331#t\242\310\025"
+	.ascii	"&J\020!\2050@\221g\221\n\316"
+	.string	"\024T\f\025\177\206N\242\234\263\347D\211\250\t\"\244P\315\211\022Qd\217\217\360\354)A\204\024\3229\211V\234@\317\026|\210D5)\212F\f\025\313\022&H\374\b\371`\244\nb\320\t?B>\346\331s3d,\"\217g\b\210\220B5\350\211L\221\302\210\221\304\024=\350P\261\b\347\204\241h\202\210\022\177L\021\037\b\025![\3609\201|\206AF\343\210\236\362\004\020Z\024\301\317y$\002!w\320\236\022\210\220B:G#JT<\372 \317\237\232\263\247\004\021R\bg\005Z<\032\213G\"3\007=\020\210\020\306\242\207\033\211\316c\b\324h<\206\260YqDO\2413\350D= {6\240=\0378\240\005$\221\304\220\261\210\372\f\025\245\2709{4\200\036\215%.8\236\305\024Et\350\374)\326\020!\205\220D*4\274p\376\fi\340D\211\307\237\"\"\212\236\027\214(Z\360!\006\241\270"
+	.string	"\251\242\230b\310\210\001\364h$\262A{D\020\201\016\025\213L\030\200zN\224x\3549Q\342\017QQO\207\343\211\372\020\217D \237\036\324hDq\0363\240=#\240C\305\"\341E\210\300\200\006*x"
+	.string	"\005\323\007D\020\261x<\221=DH\241\020DH\241\020CE\242P\b\237#2\004\210"
+	.ascii	"\374\027j\201\265\311\310a\243\364\212\342\264%\314\272|Sh|\224"
+	.ascii	"\325@3!\212\353\017\353\376\205\361\271\025\021^\225MU\n\032"
+	.ascii	"$d\246\222@\254\273.\223s\321WH%\244\022\312\030&s\300hA\363"
+	.ascii	"\302/W\275\370\360\013\253.\224q\245t\360p\310\315\365\025\306"
+	.ascii	"\350!V\213\240\327\231!\377\207=r;\374\372\336C\225\371\013a"
+	.ascii	"\334.PI\320\250\275(\001\275\334\030\322B8u\305\224dig\262\b"
+	.ascii	"\245n]\te\252*\2130\252T\372z\323\342\006U\n~p\007\346\3247\007"
+	.ascii	"\013\351\301\002\316\205\320)J\314\027\257\224I\316\231\007G"
+	.ascii	"jJ\351L\337\254s\217\346\246h\b[\334(-\216\250`\365\375\353\223"
+	.ascii	"\013c\340c!g\0179i\274Z`a\"b\343\342\214\\\324\022NZ\272&A\306"
+	.ascii	"X\\(\265E\234\231&\245\362\206\3316&\355/\t\213\245U\t\316\t"
+	.ascii	"\221\332\306\031\0264>\314'\\lO\204F\345\225NU\022\rL\230/L\222"
+	.ascii	"\241\262a\325\027\013\342\30110%_.fLX\230'G\372\342@\234&\007"
+	.ascii	"X[\334\363\256\007\345'\346\207\207\321`.\027E\320ta\300r\nm"
+	.ascii	"-,\206\376\303<.\217\272\277&\277*\257\266:\2763\227\316\362"
+	.ascii	"\215MYb\246\354bB%)\211\307\034\367\3758\017\353a>\030\006\323"
+	.ascii	"\234\351\213\311\3402\307|x\017\363\201\220\225\263\021\346\323"
+	.ascii	"\t\314\331H\347\022\331\372R\202\357=L\231\367R;`\234\272\203"
+	.ascii	"k\027\021\307cl\256D\3213\023\363\305!\231\347\326\027\343\331"
+	.ascii	"\026\f\016\016\016\006\346l\204\361\032\207\301`\216\361^k\001"
+	.ascii	"j-\200\216\320\013\331\222\021\376\322Zp\274\302\320\216\274"
+	.ascii	"`\246\313\306\004\306\231.gj\252\322\370\260r\207\243\376\344"
+	.ascii	"^\374a\2734\347J\227;/}\357\341\311\374\361\226r\257\271\366"
+	.ascii	"\246$i)\311\270\306T\001\313\222<{C\013R\207\223\334\220a\006"
+	.ascii	"\f\026\270\263\027V\214\372\246j9g\034\341Y\236\023(VJ\261\033"
+	.ascii	",\035IwU.\\-\362v\244\017\323\341322\210L\231\253\302A\216\034"
+	.ascii	"a\230J\230:\263A\035}\245H)\311j\206\364\210\313\034\330\f$X"
+	.ascii	"\326\276\310\311\225dH\246H\315\371\301\355\030\004\244\022\027"
+	.ascii	"\307Cjn\253/\311L\255\255\r\3035\240f\026I\270\230\351\331#f"
+	.ascii	"\342\256`'\307pWp\307\220\246 }q\223Z'<s\003K"
+	.string	"X_\374v\227\330 \271\361\026\326\027\273Y#\035xD\226\372b&\027s\221n\374\240\353\213\227T.:eXO\250\364\305Jl\214\212\306\311\035\223\235Z\323\301\345H\337_\020$-\r'\251\\_Rs\275$)\307\217\265\343$W\254\240\241\322\027#\301\251Z\227\265)}\261Z}\263\353R\226C\253\354e\370\254\242\345\247\034.=\244\346\374t\316\004\323\224`#\307g8\r|\222\223\340\024\233\325\315Qi\355a\3006\027u\244\336\005@\314\222\333]\342\226e\315\255\357/`\"#\303D*Z~\022a\224G6\206H\213=<\344\230\210\016\023\270t\356\004]A\340\372\276\003\024,\004\013\271,\300\224irM0\202\374\370\201\305j\206\036\250\363\361\343ZP\256\245 g!BC42\323\2445\343\025@ @@ \023\314v>>\023@\205\213\353t\211$\350\230b3#\222$%\251Gc\367V"
+	.ascii	"\271"
+	.ascii	"W\301B\205\\\306C\266\363\240\234\310\260\212Y\361\340\307*\024"
+	.ascii	"\225\312]\321\233\322\364\316I\f6\252\311\016\326\240\320>\244"
+	.ascii	"hE1\313\351\201\025\271i9<\302\020\2113cw\346\034\215\304\003"
+	.ascii	"\341\374\251\312\214\334\213\004\016\331\327\327c\337\001\325"
+	.ascii	"\226<(.\250\005#\330N;\205\003U9{\342z\221>\270\nd\304\230\236"
+	.ascii	"\037\360\317\004g\033\023\261\021\004\204V9\023x\350\341\352"
+	.ascii	"\\F\020\371\277$\351\315\202\235W\257\221-\202\356\260|\205\001"
+	.ascii	"/\322\222z\274g\364\340D\037B\366o\341\274\215A\375.Jb\003\246"
+	.ascii	"\021\\\340\240K|\027h1\b\217iv\205\254P\327N\013o\207\256R\357"
+	.ascii	"\210\215\237\313#\235B\251\270\272\n\347X\320\302\215Z$\231\007"
+	.ascii	"\230\244R\205\217\241\r\b$\"\330@\017\373+\271:\n\262uALOb\037"
+	.ascii	"\360@\013\036o\365\257ATaSx\323\370\347\256\273\316Ldw\226]\350"
+	.ascii	"\305\354#\251\224(\312\311\332W\265\201\330\001{\213\337\201"
+	.ascii	"X\001`\n\227\270JH\020\236\272\253Iz4`\242z\304\345Kd\324\325"
+	.ascii	"\232\023\327m\230\210Ab/y\364\304\224\032\241/\323\340d\026\277"
+	.ascii	"\\\366\347\307dA\330\231i]s\250\001t4[\005\030$\004U\330\024"
+	.ascii	"\331JK \"\002\225\220EM\231Ct\336\370-\004)\013@9\374o\0048\307"
+	.ascii	"NXV\034\374\250\375\"\212\214|\237\307S\246\350\020}No\315R\215"
+	.ascii	"\312,\325\231w^\207\304\260s\327yH\027\320D\222DB\344^\013A*"
+	.string	"\334 D\036C\352\024dS\344\235t\266\224\225\344\353\177A\270w\033\b\327S\255\372%A\354\017p\256\003\374|\340qL\r'\022O\233\002\320iZ\004\327W\220\026;T\206u\327\376\t\225\341\300DEk{q\367Ih\021\361\354\250\020\021l\027\"f\207\272e\353\351\247\333\301\206\260\261\254:\2008\007\361p\302\260\315\216\201\321\305j\320\025\352\261|L9N\327\b\336p:*>\027\372\326\022\031g+\247\203\340\341\241:\236l\350\321\0177\344e\324N\026%pKI\254w\356\365\220\243\306\313\b\365\316\303J\177\271\213\241\262\364b|\372\272\374~?\255]\363\330i\337{Y\302l\300\002\3172\330\275\305\025\336\311\037\346\324o\261 \372\316\242\345$\312\217w\343\024$~\343K\355\373\202\373\375vP\216;zTP%\332\fe\027\r-\033\007\345\323$S\204\275E\021\030\3112+\036\352_\355\225\316\335"
+	.ascii	"u\212F\037\236\027_\363y\317a\354\365.\200\r`l\302\302\002\356"
+	.ascii	"\346\267C \260\200\200\377\357z\n8\235\255\231\013\360\326\244"
+	.ascii	"\271=\251\225n\367ql?\031bL\356\347\003H4D\003\\\017=z\223\231"
+	.ascii	"\n\222\350\273\372\371,\336\247o\020\020\341\224\033F\r\333c"
+	.ascii	"!\371\025Zm*\254%\307\233\375Qe\\W\321\343\363\346{\371\227A"
+	.ascii	"\345\303\221\026#\223\\y\217\252,\005}FrJ\230\274`H\224\031\244"
+	.ascii	"\242j\034m\200\331\204\225\276\320]\350|\301\002\271\237\352"
+	.ascii	"\213\236\006,\307!\316#\246\215R*3M\277"
+	.string	"\262@cc\223&\223w\254\352O\357\304\202t\221\"\272\214\256\365\320\226\n^\370PH'\343D\177\266R\243\355!H\240$\001))\\\2145x\227\261#d'6\201f\375\252\001\351\n\372_[\327\373\222\247\207q!\262\nY\266<t=8\224m\205\343\013\250Q\326\026\350M\332b\256\261%\372\345\255y\234\3345E\336\320\2347\b\3458\237\3056B~y\r\265\322\340-Y\310\362\007\245K\300\240\366Z\253\232>m<pDq#(\002Z\300\030\375\310\264A\03041\303\267\242\362\372s\025\364\2202v\262Vs\021\002\253\252I\365$\336\334\255\002$\334P\325\243s\364\274\347\\.\204x\340>\220\205\244%g\213\006P\247\372\333\224D\350\332h\273\3167\232\030\nuxn\352\371\302\356\002\3118b7\241d\272'\\v\230\214\203\257)\230\205\271\201\311N\222\001\307D`\265\302\267\367\341\312X;e"
+	.string	"KLVFp\254\026uV\361\3630\\\265\263\210\254\272\213\b*c\240;\3019\331\252)\r<$\241J!\265\267\0026_\027\240\340\313P'U\245\221h\3014\254"
+	.string	"\246c\324\025\023\332\333\240\370\3021Ff\030\024\023\007K\037\024\263\t\354\344\2216\320\364\310\235\t5U\024\332\233\201\271h\275\352\240\360o1Y|\037,2\224R\266Gr\016\031\250\207\f\207\027\253\252\224\262Y=\332\004@)\036\216J\242\317\025\355\223\240\260\311\026\226Z\f\240o\244\266\f\303X\305\267B"
+	.string	"L\235V\242TI\260\274\374~\031#\205\006\315]\017$\035\b\201\205\247b)\244\264G\013\320\240\030\351\362c\352\027AX\215\323\373\214 \272\005\0318[^/\307\361OddWyc\353\200\262.\317\215\206 M]\305\361\006\237\2017\333l\036\364\210PZh)H\347\263\004\332\"\267\356\2644\245\240\021Bn\330s@D\221\276D\202\r\007\344[n+\346\306k\214\300\337G\004^T\261b\247\006N\223\307\035f\352\b\367\237\304\002\020\026\n\004\241\327Vj\027\300a\351\241f\0344\006\261\317\347q\354s{\344-\222u:\310'X\tK\303 \310\213\\\201\211\241C\0016O\277m+a\264#j\212Nz\2233M\205Q\313\005\357\367\266\f\240\351y$\320\004N\373\237%\023\366\244"
+	.ascii	"c=\017\246\246\362\023l\337\037[\001\314\240[T\354\241\300\265"
+	.ascii	"g#\262V2h7`\311@\222\037\364\300\fB+sA\316\251\357A\362\311C"
+	.ascii	"\242^\266\206\267D]\353kwss\tR\344R\001-|\033ts\n\350\322\217"
+	.ascii	"^G!\252\b\314xU\300=\354\344^\315i\366\361\027E\206yk\275\357"
+	.ascii	"\177\006fNv;N\357\316\004\225\r\032\257i\\\334\215\314\332\361"
+	.ascii	"\223E\\\300\225\360\b#\024\224A\020\347\261\325\316\365\234\210"
+	.ascii	"8\260Dx\376\365\243\007\257\240\336U}51\224=/\311=#O\376\026"
+	.ascii	"\266U\234%9\207\270\220\277\016\203\343\001\355g\032V\"\013\246"
+	.ascii	"\030\244\311+$9\220\360\255\306\301\371:\223\024\304\225B\303"
+	.ascii	"ud\f o\201`0~\360)\361=Q\253\266q\332n\"[7\f\240\027o\272\313"
+	.ascii	"\276\242\177\2218-\n>H\277p\205*\357\"(\034M\031\275?Uz\253\035"
+	.ascii	"\2166\322\326\030\006y\361F\203l\350\263\037Z\370\327\020\341"
+	.ascii	"\330l\354L\213\201\2247\300\330f\277\004\264\277\252x;\017u^"
+	.ascii	"rA\307\272?\245n\306?\nV!\300om9\360\323\323\336)\366nH$\363"
+	.ascii	"\003\212\rca\216\311\020\177\247k\344P\360\006~m\340\357\341"
+	.ascii	"k\027\r\372\300\350P8\255\255\371Q\264\302\274\326,\271 m\311"
+	.ascii	"\215\013H\234\312\247(\221hz\234\306\n\247\033\316\025%!Q\227"
+	.ascii	"\263\256\201\333\266\214\3756m\310vr\315v dn\316\360l\177n\r"
+	.ascii	"\331\002}\246X\t\007?E\021 jf\201|s\300\302V\226\016\336\033"
+	.ascii	"X\017e\374\235\352\247\r\340<\2157\f\3175\031\324\217\361\203"
+	.ascii	"\016)B\226\267h\036\222\024\211\305v5MU\365\310\310f\244(\t\254"
+	.ascii	"\265\177\347\306E\377\373-\206\027]\246\032\024\352PY\275\016"
+	.ascii	"*/\350\2530>M\337\333\261\274\005q\326\006\306\216\202\306\301"
+	.ascii	"+\350\231\242o{}+jdt\021\017\271\361\021\370:G\357\237\200\263"
+	.ascii	"i\347r\021\201"
+	.string	"\253\237\345\177\351.\201\031\372\252\307\267\371\272\345\245\277\333>\317+m[\271\253\316[\366\034\210K9\201\342Y\345\017\203\373\0074\370\346:@\264t\006f\300}DF\3741O3?\335\224\013\320-r\231\217\275\325\313\351\355.\367qm5Nfp\256B\213O\024\t\232n#\323)\305\376|/'<=+z\371}\016\032WQ\307/\3101\317\353\216\250@e3\317\2372\340\n\252\376\323}\214he\334^\302cfPD\237Pc\006K\005G"
+	.string	"$#\205\354&1\307\224(\324\037?\016\177)\250\252E\017\2523\316P\226\266\241r\223T\262\343h\t\b\036>\334S\035\037\\\3111\350Fq\001>\237Gq\332\301\371\b\222\007\001*\323\211\3310*\341M%\222&GR\200\220\253\3367\214\274\"\227\267Z\236"
+	.string	"K\035\234~\351\315\rO\254n\227\275\241\222\254\\\202\006\333x\264\324>\336\375\222\336\301\237p\"\023,e\2007\375P\346M\031\327\301\273<tTepA4\212\026\330B\352\234\246\272iQ\322\236\032\315~\306\"B\336\247,S\333\243\335.\364\367\335\206\335A\312k,\232\021&\335\300C\201\312H\233\027:\3358\022\260\340\252Q}\021\222\334\374D\377.0\026\362\203\316\351?\255M\365\232\362j\244\265\004\025\275D\001\315z\023+\205\343\301\350\330\301gt\204g4^\243\377\024\223\327b\030A\225\266+\2047\266\267\222\231\313\023{\025b\001\326\343\017C\271\344\001\355\341\317\312\215S~D\237\354kt5"
+	.string	"\350\261\225X\223\204q\020\301\265!e#\322\274\310\377\307\003hkn\214\326\231\333\234-\252\nW\217\013o\020"
+	.ascii	"\027\310i\3253\265g3\301V\243\233u\221\034\004s\004s\377;\345"
+	.ascii	"\035\020\322\234z}\3174\320*.\336fO\241\004\251>h\265\007\213"
+	.ascii	"\025\305\355J\013tK\310\251"
+	.string	"Vj\b\320\322t\r]\310\020\316\016\270D\377w\020\020@5\202\3369\321\362\214\033c\375{\330\365\367cX\236\247\322\261\327\250w\355\330s\243\232cQ\177\254\256w\311\030\356\177M\334\266i\275\220\372\314\314_\207\0323Z:\226H\n?\354\372Uz3`6\202\3661o\236\363W\203\275\003[\313\037+7\330,\246\247\376\037k\177!]\347\330\221\311\303\226\237\271g\344\335\363\337\267\034\343>\344\342\261\r\323\376\023\240\366\224\354\367\017\315z\317\322\027j{\027\037YwxK\367e\354\336][\226\216k{\013\3217\355h_\274\336\005\316\023\370c\025\365\273\323ns\307.i\316\033\177~\3335A\336\tyv\221\302\317\032\273\243\323Wx8\230g/:\b\013o'\355c\236\256\350\243\005\260\207\350|a\373\255\363X\022O\206\314\364\200\217p98\323\367H>B\363\002\353e\3411\337\273\276\273b\250}"
+	.ascii	"\360\304w\b\036\263=\334\337\025\345\256\363S'}\361\375[\314"
+	.ascii	"\233\222\327\364\352J\325\250\352t\013\357\257\255\337\271%,"
+	.ascii	"\017\353\370R\247oU\257X\265X;^\322^1q\002}\275\266w\3056\211"
+	.ascii	"\256\343\026\177g~g\233o\217\3318\365\335f\303\026{\377\241\020"
+	.ascii	"\223\214o\2511\340<\254\212\360\262F\034L\317#\376\224\204s\222"
+	.ascii	"\343\337#\334\375\023\342\267\200\325\230|@(\203M\377k\001w\311"
+	.ascii	"\367x\t\277f\fZ\344\242\207\340\334\021\217T}\376F\354\302\365"
+	.ascii	"(\236[uK\361\267d\354\003\177\230~c|\027\232.\233\317\2548\251"
+	.ascii	"{\233J\356\240\350\236\311\016t7P\217\313O\252\271)\354\347\370"
+	.ascii	"O\310\001\362m\"f\241*\361\233\342>]\313|5\367\230\210\313M]"
+	.ascii	"\256aZ\316O\275\277*|\361>\332m\246\364\251\346+\355#5\353\247"
+	.ascii	"\315'\211\372\271\242\305\275\256\315tD\345O\351\370\301\177"
+	.ascii	"\021m\246\351\2120\370Cu\215\235\275T\3471\367\357\t\207\234"
+	.ascii	"\006Ef\237\222\326d\377/8\257\035\233\346]e\317\322ULqt\366\214"
+	.ascii	"\307\240\354U\346\323\362\025\374\320\025"
+	.text
+	.section	.gnu.lto_.symtab.772e92aefa2ed4c8,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"mspSerialGetCommandStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"mspSerialResetCommandStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"mspDescriptorAlloc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.772e92aefa2ed4c8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,423 @@
+	.file	"board.c"
+	.section	.gnu.lto_.profile.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375 B\315\001"
+	.string	"\304\0026"
+	.string	"\005"
+	.string	"\262\312\266\244\n\002\002"
+	.string	"\002\001\001\251\373\333\314\f\b\002"
+	.string	"\002\001\003\254\376\355\236\b\004\240\342\234\212\n\005\240\342\234\212\n"
+	.string	"\004"
+	.ascii	"\273\030\\\334.!l\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375 5\025\001"
+	.string	"\200)"
+	.string	"\002"
+	.string	"\001\001\001\200\004"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	" \210\232\211*\026R\fQ,\274\330\261\001,"
+	.text
+	.section	.gnu.lto_.inline.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375 \303]\003"
+	.string	"\262\005\024!\240'\351 \266\211\277\244\365\365n\227\207H\204\b\255F\333@\0330P\225],1\244\035\271\021\271S\377+\262v\212\305\201\221\274C\004!\320X\020#\200!\261|?k\263\226\376u(>\033\026\332\"\317\260m\217\377\361\276\357I\202\266\312\363A\t"
+	.ascii	"7\007(JC\0262X\3027\200T\205\020-\205\211\225Z\017\006X"
+	.text
+	.section	.gnu.lto_.jmpfuncs.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"e\003"
+	.string	"\242\004\017\031\260%\351\fC.\230\345\025\r+\345\"7I\222\344\334UR$!M&\031\333\030\243\002H7\341\007/\270\224\372\364O9\003\244+\301g\314\250,\212\264Ez\333H7k\370q\205\022"
+	.ascii	"`\204V\027e\245A\034\020\301\312\030Y\311\265U\002\270\203\306"
+	.ascii	"T\020lN\016\331<\364Rrd\205X\224\261\240\332\007\314\2167\320"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.pureconst.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375 S5\002"
+	.string	"\224\003?"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\002"
+	.string	"\001\270\006"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\330\003\b\b"
+	.string	"\200\214\201\200\376\215\001\001"
+	.string	"\320\003\b\020"
+	.string	"\200\200\203\214\200\f"
+	.string	"\0071cO313"
+	.string	"\004"
+	.string	"A\031\b\334"
+	.string	"\026\016"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.lto.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardConfig_Registry.12.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\364\007i"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\202\200\200\374\342\203\246\311\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\347\006us\350\377\005uq"
+	.string	"\005\001\006'\001<\005\001\006\035\001'\001\232\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/board.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_boardConfig.13.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375`\266\002\315\022"
+	.string	"\326\241vF\340P%\035\330u\244Fq0A\342_\336P\t\315\035.}\306\366\304\225\367\205\241\030.\021\3126\365Gk\312\212\343$a\327\006\267\374v\242=r\037\306\t\f$\317M\360\200\002\340\354\211\321\353 d\357-eJ\001a"
+	.string	"Y"
+	.string	"e"
+	.string	".\300\035zv\221x\310=$\036\372e\343 \271Y1\345,Q\355.KI\374un\213\360i\276\374\315\304\243\223\301\316m&#vz\276=\326\363\370\f\320\234r\200\310r\236\210\316\211\016'!\317\037"
+	.ascii	"\031\317\025Df\363\b\354\356\225\236 d5\231\233\311\356:;\331"
+	.ascii	"\316\355q\3330\333\b\354\254\n\2730\265\207xeQq\303&u\330#\355"
+	.ascii	"V\206|w\215%\266\212V\2430{\006K\r\262\377vw\255@\366\223\376"
+	.ascii	"U\2469\230\336b:\3024\324\364{i\325tf\372$\372!\247\205\200\332"
+	.ascii	"\256Nm\307F\301\030D\037\266\237\366\217\216\364z\022\315\003"
+	.ascii	"\354\002A5\355\316\016\004(\361\035J<\214z\027T>H=\261\254=\r"
+	.ascii	"zJ\264\037\274)eDh\202\t\252\251\220\024\271J|\nap\200\360\027"
+	.ascii	"\021\240\204\247)e\024\025\222\360*1U\325\246P!\3379\301\017"
+	.ascii	"\316Yt\350\354\225/\265p\273\253`\305\213\0137t\350\323\304C"
+	.ascii	"U\225\352D\304\262\346U\3321\027\362]jV\241\210\312\r01/2\255"
+	.ascii	"\223\017\267\224Xp\255\264XX03,\231\230\025\f\254\026\227\006"
+	.ascii	"V\311\210[3..\326\206V\313\305\372\230\355\337*\220_Q\210*ZL"
+	.ascii	"k8\277\224n\343AQ\371\034M\305\262\366t\243S\264\r\310\225\332"
+	.ascii	"'\013\362\235\337\205t\320\232\242\006\2458\307\200\323H\364"
+	.ascii	"\003\235^\303\350L\217\272=\321\330|\031\237\321\340}\310\016"
+	.ascii	"\0026 \240\002\221\031\333\003\244\311\033\206\036\227\030\\"
+	.ascii	"`\305\313\336D\211\002AD\217P\323N\373\2739\036\033\370\316R"
+	.ascii	"^;\3634\315@\372\367\223(\346\0353\220_\370[u\324P\337\256\223"
+	.ascii	"k\362\261\255\220E;\310\214\312:N\334K\\\364\355\230H\300\224"
+	.ascii	"\304\345!\334\366Q\250e-l\337P\325\305U}x\003\214\331\202m\026"
+	.ascii	"S\302/\331\236\3308<P\303\372pO\312\rqok\215\036"
+	.text
+	.section	.gnu.lto_pgResetFn_boardConfig.part.0.22.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"\275\013"
+	.string	"V\026N< 1T:\244W\202\001@1\340\250\374y\013Q\335Y\\k\331\214\002\3158*\252u\3641^\255\230\031\214i\235m\003@\240`7\0218pH\r\350\025\3678H\016Ad\023)S\n:"
+	.string	"<"
+	.string	"<"
+	.string	"\005\260G\373)ls\354\325C\323\206\374\331+\210\006"
+	.string	".8\250h\354\356\366\250#\376]\363\372|P\324\271>\365\004E\037\236\004~9\032\354\2563\020w\274m\211\355\005\366)\004\341\237\232~\206\240\203"
+	.string	"\021\273\240\215\032;\2120J\330\276\375\024\307\3264g>\344\034\265\201\204\353!\344L\373*~\372\216\332|\300.)\306\213\335P\301\243\023d\217\016o"
+	.string	"{\314\036\256X\362\240\031\2146h\307>\013\f\231]\341+.\331\356JT\031:\237\304\243\277\301\036UU\006\030\302\223\033v\244\255\271\220\007\257\017\220\211\026\353\243\235\324\222\365\372\265J\262\257\264>\025\313\004L\347@\363$\"\301\343\272\b[%\263a,\334e\233x\232-\362p\227\241x\233\205\256\3636\355\327*\311\327\211P\213\345\321\217U\265t\016\263!\274\005\3670=8\241\230\021 \017\234\202]U\035\030"
+	.string	"d\311\343[\f\271\025\030\017\276d3\206\026.D\bD,\211\ts\022\253\375ZV\001\357\001\024.\033\314\232\0254Z a\351\234rxg"
+	.ascii	"\316\b\341\256s\031\035\363\316k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"M\006"
+	.string	"\364\b\211\001"
+	.string	""
+	.string	""
+	.string	"\002\026\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \r\177\007\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\022\b\005\f\t\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\t\n\201\204\005\n\013\001\024\177\f\377\037"
+	.string	""
+	.string	"\200\200\200\001\025\177\r\023\177\016\020\177\017\021\177\020\017\177\021\016\177\022\003"
+	.string	"d\003"
+	.string	"$\003\001\f\013\201\001d\003\001\t\244\001\003\001\n\304\001\204\006\007\003\001\b\304\007\003\001"
+	.string	"\320\360\372\250\001\001\202\n"
+	.string	"\027"
+	.string	"C\030\304e\343\234\005\273\f\335\032\3554\001\267\nI\331<\nV\206A="
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.ascii	"8|\2000\270\364\304\202\341\362c\215S\013\201\205\n:\270A\007"
+	.ascii	"\323\t"
+	.text
+	.section	.gnu.lto_.refs.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002\n"
+	.string	"\003\003\002\004\002\005\002\001"
+	.text
+	.section	.gnu.lto_.decls.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"(\265/\375`H\022\355]"
+	.ascii	"j\243\260#Q@P\322\031\016s\235\031\225Kw\330\256\220\346L2j\030"
+	.ascii	"\025\225\013\243\204\340\242\204&\254j\351A3\223l\004\030HI2"
+	.ascii	"\200>\016&\320\201\227\003\001\037\252\326>)\203>\003\226\374"
+	.ascii	"<\264C\f\200"
+	.string	"\030I\346p\262\030j\273\335T\025lk\261\233\224)\336\001!\0023\002Q\026\352\204\200\tZ\264{}\003r\273\266X\314\310\344\326l\253,\324\231\0369\213vw\227\235\333\033\326\313\306\255\330\312-\334w\313B\277k\367\262\201_Hn\265\354\333\016\260[9\205\253\273\277N\376\375\372M\240X\271\345\262Q>8u\347\270\362\351\202\026c\212\257{%A\202\204\007\022$p\270H!\323\221\223\376\250\002\241\373\023\204@\250~\337\376-\333,\033E\307\f\210\023\036\234n\233\320\327M\007\213V\224\323\003FP\271\027\313\277V\226,\007\355M\314\007\247{E\350\313\226\362\330\223*\302i\252\201Z\263U\376\225\262SV\355\204\356ew\017\2403&\246\224\343t\323\226\312Wmm\350U;\361\354V\256\032\017\232n%\317n\210\335\020)\223,\"R\202\3511P\367L\350\213\346\023l:\327\346Q\375\256\314\370\301i"
+	.string	"\021\250\273\265?\301\237\365\t\"\260>\301\021\373\023\\\260\205\262b v\354&P\034\230\004k\257\356\225G\307o\211_\037\247G\241~\303>\200\262Q\\"
+	.ascii	"\365\013\"\270\177\013\"xV\237\266?\301\022X\366'\370o\r\377"
+	.ascii	"6Y/\020@&\324\263\311\272\327"
+	.string	"\016<+\216(\036\234~\335\237\240\272>\301m\027\376w\371\357&\201\213\r\240\303\277f\376s\371\177\346~\377Y\370\357\345\377\330\177\271\377j+0\375\277\341?\333\036\025\377\r\201\370\337n\227\376-\341\337\017B\374[\346_\023\377\246\370\027\305\277\r\374\033\364\257\320\277'\376U\261?\377.\360/\003\253\364\277\347\347\343\277)\374\233\364\357\360_\243\177E\370\267\203\177'\3707\202\177\037\370\327\201\377\177\377\373\376\243\371O\367?\314\377\350\377\273\377u\377\275\376\373\374o\373\237\376\375\375\375\375\333\302\317R\376\235\275S\374\324s\024\007@\266L\371Z\220c\234e\3747\334F\204+\312\214zf2\214\377f\207nH\331\2230\352\371E\315\224?\275\0308\345'\365\211\343Dp\270B\323Q\305\351\371\351\347%\303\340\302_\2322\234\236n\177\202:\353\023d\245\320\331\t\007\356J\364\213\323\034F\363\023[\277\375\363"
+	.string	"\3264\220e5\254\360u\273)ps\325\303\311yg\267:\231gN8=k\251d\026\r\231\355\013v\357\372\224j\266\2639\342;f\365\276{\337\333\276\355f\267s\367h\244ai\247s\204Z\3675Dy\346\333w09\375\001\207YF\006\247's\263oRalf\370p\204\230A\211\320\231"
+	.ascii	"-b\203S\261-\263p\377\233\347\311\316\214\312\031\365\373\246"
+	.ascii	"\236\377`+\233\335M\243f\355\246S\316\267fw\304\257\263\300M"
+	.ascii	"\240\201 \270\272\255\242z\252\021\033\224UG\240\257\244;\331"
+	.ascii	"\241\327n2\303\260\222L\261.S\035\326\3361@\207\361h\346\212"
+	.ascii	"5\225>\233{\355\355%\326\224\n\314\365\331d\256\317dO/\237\311"
+	.ascii	"\356u\252\207I\246L.3\fk\212\031\366\234\352\320\313Nv\230r\207"
+	.ascii	"\272|N1\335\236S=\3140\345\024s\2115\325\201*\252\025\005\343"
+	.ascii	"KId\223\314e\317\210\262R6{\240\314\365\331t\335K\366\324\315"
+	.ascii	"\004\272\255\236M:%\325\2469Ag8\231)\237M@\224S\326\263\227P"
+	.ascii	"\346\221g\367\021'\244\216:\221\\\241\375c\241I\036V\r\365\324"
+	.ascii	"]@\257\335Q\335\311mhw'\273\333\246i\265v\313\320\303\344\212"
+	.ascii	"\212\352vz\210j\253$\225\247n&\373\2226\305\f\313z\nQ\031\013"
+	.ascii	"\343\352\027kr\271\232\016\253\251\206%\2374Tw"
+	.string	"\357\030\225k\252\206\0301Uv\224P\255\221q\272`6o\305\336\266\321\357\250\275(k\353R\377\302\276\r\357n\351\270\256\334\356\354\232\330\360\021d\365\272\241\322\207\344\006\247\377~\331\272\033<\035rT8\245\363\240:\231I\323\305\3517K\375\256O6K\364\2468\345.\\\030\372\306p\\td-9\205[5\013\222T\331q\312n{\007\224R\202\t\243\245f\206\232\032\263\355\217\247\252\204H\024+\266\265\233.#YP\234\362\032\263\025\276r^\343*9K^K7\304\316n\210\2325!J(\301\3645L\365\251\031\260\363\030\030\247\001\343r:\t\326R6S\224\314\331\340k\246s\304\216\214<\254\036\\vN;\333`\002\305\361\210>\306\3068e\264\363\331\2171cL3>\353\2723\363\323\242\362\024\006~uf\007\032)\034\266\272\bA\302)\223\035\217\243\324\220\\q\312Q\236\247c\366d\313j\303"
+	.ascii	"\341\262\342\2348\345\260\263\330\177s\243\226\243\007\226\032"
+	.ascii	"\224\377\306F\212\227*\2563\365\351\230\372\257\363\027\257\013"
+	.ascii	"\326R\301\272f\334\021\276n\347\210\275J\302\205E\346\274\336"
+	.ascii	"\340\020\006\306\245yUC\rg\034\362\272\216\b\247O\241\232|\305"
+	.ascii	"\270\311\326e\320\323\235%#\255\233N\005x`,\265\236\314\250\337"
+	.ascii	"%\313\311ss\3058\311K<<Y\2238zf4\322\370\272i\245\300\004P_\362"
+	.ascii	"8U\262.m\224s^\262\334\251_/\033\214\303\311\035\327\240\262"
+	.ascii	"\303b\036I\266\254\327/\344\344\033^_\272\330\007\017Y\250\263"
+	.ascii	"\247\227h|\321\252_\210\273x\007\235\021\246\201\223\360\021"
+	.ascii	"\346\342\"\214d\305\270\213{\234\247\230\306\222c\340.\266\342"
+	.ascii	"\347B\267&\360\252\213\362\3505\211B\325\223\3328\336\007'f\006"
+	.ascii	"N\300\374,\204\211\254"
+	.string	"\030\017\271\207\265\233l\bkq\220\205:\327\246AB^\216(\001$t\304\310\321U\005\203\360\ff\253\326\030N\031\210\215\223\252\r\006\263\255\025\343\037*\031%T\372\216\207\303\006$\253L=\020\212z`\222,\365\206\350\025\034\227z`\020\365\300\036*_q\216\025\023\301:\3162p\325k\224\353\312\3033\244)\203b\245~E\004\201\177\177+\"x \225\332\263?A\006J\251\007\306P\177\306\3017j\302\264\350\301\361\215(\034\367\006\345\304\351\201Oj\317\b(\236\301R\377\r\017\2234\037\001Ha\213#\213\237\r\220\302a\007\n\212\210F\344\321F\251X\244`\250\006)lqd\261CL2\"\217AB\243&\245\"bR\220\361\330\024$\200\222R\023\221X$\332\260P4\"!\213D\233#\"\241R\352\202\251hI\270\024<\022P\361\210\2304Tt\324\002)\034\346\270`*V\320\263$D\036]\264"
+	.string	""
+	.ascii	"y$\240!S\320\220\311\247\210\330\204C<bc\315q(\0079D\0342\325"
+	.ascii	"\020\207L@$\344\220(T\n\"\207R\b\251\351\361(4\032\031\021\331"
+	.ascii	"\270`*\026\245F$\023\320HH\034&)\021\331\030\t\217Mi\221\360"
+	.ascii	"hs\343\320\220\tH\307\205\021yL\032\n=\030\n\340H@\304b\322\321"
+	.ascii	"(\\!\310H)\251\t\005\003\220\302\241\221\b\311\341E?%\200\220"
+	.ascii	"F\"&\240!\342\005H\341Q\350\301\220\351\303\213\222\214B\242"
+	.ascii	"p\250\376D\n\006R\250h\301\346*V\224XQ\"x\025+\204\204V\244\020"
+	.ascii	"R\237B\b\210\034\022\272\220t\f\"\217$\300\213LBc\020\262X4\006"
+	.ascii	"\341 \205-r\216C\303\244#b\261\002\035\"\3420\351xc\304\302("
+	.ascii	"46"
+	.string	"!\213\210\216\232\210DK;F\"\244\242T\270D\304\301\rrH\005\222\230\324ds!\241\n\020"
+	.ascii	"\201\003\f\324\"\240\240!S\0201\211h)\250\310x\f\002\372A\n["
+	.ascii	"\020\213IH\242%c\361\210\310\302\310HTD\301\247\017L\362\210"
+	.ascii	"\301\261\243\212S\366\343? \r\\R\352\216w0<F\356\324\234p\312"
+	.ascii	"h8\315\026WY\225\347=\312\303w\204\357K_\232\315\214&}>\316\360"
+	.ascii	"\312\023\355;\273b3oo^i`\230o\377\274D\321\234\355\235\313\364"
+	.ascii	"Y\211\223\343\224\365\230\f\207,3(T\215\241^C\2668e1<\346cX0"
+	.ascii	"\322\232\034\350dxQ&\214\\\215\225\347\031ft.\315*\333J\222\307"
+	.ascii	"l\024\210\201\352\301`\260\314\215\271\225\341\365\251{5\334"
+	.ascii	"\2608\265\263c6-\256\270#|A\273\"_\264\220\324\375u<w\340\262"
+	.ascii	"s0\341\262A\213b\211\221\345\305\013\317\355\334\215\023\250"
+	.ascii	"\030_s\277\216\r*8>\034Y\316m\317\302r\300\275]\333\371L\206"
+	.ascii	"Q\261\306\324)S%"
+	.string	"Jc\313Y\356\034g\002\005\303\361|\005\201]\250q8\247\224$23\"\"\222$I:1\005\204 '\251\263\033\021P\251\203hj$IRH\233\001\266dR\027\221\277(\261<\227\tZ;\310\205^\300\362\375\034\013\013\316c:\355\242\263g\034J\225C\265\340\334\200p\001\277\276\232\325N\313\244\301l\3208\253\305-A\273\253\375\320\377\002\177\022\217\363\032\\:\344O\345\312_9\023\270)\226\242+I\212R}\030\304,V\220\261umY\037U\331\203\037\2701\346'b\002|\007b@sQ\275\333Cr\252D\327\305.\004\207\242\021\340\034\333\203F\261\026\300\375!\225Q2\237azS\366<S\200\237 \223\347\032~ \373\343_\305a\301(8r\261$\222l\367]i\276\333XMD\377\0222lz \022\271\207\037\336\216\314/\nwW\034\323\355\364\244\206RlO6K\275\276\354\356\376\253\007\276"
+	.string	"\220\247q\202\304R\342\313(171r\333\252\254eU\005gUM(\251\216b\013<\334\376\275\332\316\026\255Ud\023\331\265\3353H\360?\023\023~\320\214I\b#\254\001H\020\356#\257'm]\210\2269\313\237*\250y\310\332[\2271\251\201\005\035\303\335O\233\275+Q`\025\271(g`\301T\220\035\004\274$\2515Q\272\002\332\033CZ\364~\311\224\211A\331K\341\263\260\205u\311\364\200\033z\004\370\345R\344X\030k>\235WN\335s8}\300S\331<[\004\321\031\254\374\360\250\346\200Q\237\253$c\n\362\023\273wX}K\215Nh\300c\257r^\217\023\342 M\334\234\243\211\2012`\233[6"
+	.string	"\246\324\343nB\032#\246\222\"\242\311\336]\341\327'\331\037\226D\023i\2561\362>,\021+n\246AA\303\205\305H\347\332\203\250\314@ <\202\345/\034\033\021\315\247D\266g2=yB\371\333\313\304\376\016\025\351d\304/\341\311\027\177M.-\357L\344\232Y\343\001(\322\270\204\206V\005\r\241\231\314\306\244^\222C\001\213\343x\"\220\025\251\356\345\241\333\\:kQ\025\351\013\223\325S|\260\241\370\260\214\005\3145\"\304\275\315\253\013\302\005\275C\337\022\007qe0A\\\025\300\372\221E\372\bi\232\021\320\317\311q \002\277\035\302\311\346\024\200\211}J\013\334\305\272\340J\025\225\037\t\0042R\244/S!\346\016,\251\314\214\376\")\316]\201\256.\312m\314m\206\017M\270U"
+	.ascii	"c|Jk\377\334y\217\005;\351\264\3031\001\372Ipr\361N\340\021\362"
+	.ascii	"\177\373\243p\225\227\027\230/\327\266\300N\245\376\n\034z\274"
+	.ascii	"G6*\330\346\332\301s\031;\354\340\\A\362_\274*"
+	.text
+	.section	.gnu.lto_.symtab.df7c1eb3fc1afe1a,"e",@progbits
+	.string	"pgResetFn_boardConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"boardConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"boardConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"boardConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.df7c1eb3fc1afe1a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,302 @@
+	.file	"motor.c"
+	.section	.gnu.lto_.profile.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"4\002?"
+	.string	"\004"
+	.string	"\301\253\323\333\017\022\002"
+	.string	"\002\001\002\002\001\305\377\344\314\003\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\005"
+	.ascii	"`\013 \260\222w\327\022\f\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375 \027\235"
+	.string	""
+	.string	"h\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375 =\325\001"
+	.string	"4\0031"
+	.string	"\001"
+	.string	""
+	.string	"\024\341\222\204\270\002j\001"
+	.string	""
+	.string	"\002\021\340\222\204\320\002h"
+	.string	""
+	.string	"\017\362\353\201\300\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\r\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375 ;\255\001"
+	.string	"\304\002/"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001\004\002\006y\001\004"
+	.string	"\001\300\004\001\004\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004\001\007\001\002\006\035\001"
+	.string	"\006\035\001\007"
+	.string	"\002"
+	.ascii	"\276\210\261\2016"
+	.text
+	.section	.gnu.lto_.pureconst.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375 b\035\002"
+	.string	"\002\004\f\025\300%\035\273\276\177\323\377w~\320\246\277\037\226\2405\322vJ\001\272\031\267\024=\300\366\261\301\270[\271D\253t=u\341\222\001\221\204V0v\211\006"
+	.string	"4\005?u\372g\303L\221\007B\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.4155ca3ff30c58a3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_motorConfig_Registry.15.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\364\007i"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\202\200\200\374\342\203\254\277\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\346\006us\350\376\005uq"
+	.string	"\005\001\006'\001\034\005\001\006\035\001'\001\206 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/motor.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_motorConfig.16.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375`\303\002%\024"
+	.string	"F#\177I\3200'\035\330%\022\f\021\214q\026\232\347\321\274*\003\023IO\247\313\217#\340\305\213F4\313\004\303\315\351\177\340\355((?\021\263\216\177h\032o\232S\2050\002h\n\227\205\311\364`o\276tl\306\343\277\265d\023\271S\nf"
+	.string	"d"
+	.string	"q"
+	.string	"\277\331<V\253\220\356\251\326R\201\r\274N]^"
+	.string	"x\372:\txj\233\215c\300\016\200\031!\226x\265\326pQ\370\365\257\274\277i;\375v\332\374\244\023\b\312\032\311\233\323\317\3453\302J\204\334\371T\264\262\202\236\373\354!s\346\307\342\347\373\334\021"
+	.string	"M\215\344\317\247\353A\255\325s$I\334\340m\323l7\260\027$M\265W\255\225\201\317T\343AFTk}\212S\337\006<\235\200\304\323\2013{vy3w\310\276\212\026\317\n\257\220\035\333\351\220\337~z\334=\347\364\003\314LhU\351\326FYE\364z\324\035\215*:\356\366K?\247t\027\266\343,u\242SV\322\001\320\323\021\312\251\027\274NO\276\303l\177\332?:\222-\276\360*\f&WT2zc\334\"\231!\373}\005\2643h\230\037\277\317\375EL-v;{\343\271!\3539n\341\314\336n\223\317\016\250\335!\226\323\230\311t\037JMF\337\211\226\313\200\221K<\327\225\313\245\240\226\214F\236^\036U+qQ\345x\037\237\2016\314\235f1Vn\274\335\305\034F\315\344\312\342_t8\245p3z\251x\r\264i\036\037\\6\310H"
+	.string	"y\201\341 #B\200\271%\205&\326\2101\341\313L(\003\303\022\023\266\320h\302\024\231\305\031\027ZX#\212\264\020V\326\257\220#\350v8\233c\221\n\267\232\225<\351\007H'\272C\036\0317\266\2135Q>\267\307R\340\334i\205\303\322\231<\376\325Z\353\227\340sc\373\034@S<%rf\317_\333 ^\303B\001\242Z\253\212\003< \220\002\031\272\352\00671\244\357\t\r\017ir\267\3051W\b\200\007nW\322o) \345R+\374\265\362\005\332C\b\264\347J\361{y&\022\262Eq\332\b\311\305b}\037\213\200'"
+	.string	"\222 \230k@\t\202y\r\365\2174\334M(\375"
+	.ascii	"\355\256{D] \333E\007\207/Z\261\212^\270pR\216?\220\262\277\212"
+	.ascii	"\350\246\205m\336\302[[^v\266\263\026\326\374i\241Y\020\213x"
+	.ascii	"/T\037\357G\244s\365'"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375 j\035\003"
+	.string	"D\005f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020\177\006\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\017\007\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f\b\201\204\001\r\t\001\021\177\n\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\321\371\216\307\003\001\244\006"
+	.string	"\004"
+	.ascii	"F\020\002\2275\313\340\013\201\202\002"
+	.text
+	.section	.gnu.lto_.refs.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4155ca3ff30c58a3,"e",@progbits
+	.string	"(\265/\375`&\016\345L"
+	.string	"\352\210\344\035T@R:J\007\236\205V\t\367\352\222\255\025\303Z{\322\320WK;\220G\3345\231\371i\035y\303\336\216\255t}\326\274\365\023\341D\264\024\263\366\356\316\372\013aU\343\214\023\273;\347\356\016i\"\331]\312J\t\205^0yI"
+	.string	"xhK\342\354\222\021+e\n\214\001\307\001\324\001\337*c\373\245S\3536B&\265X\016\324X\262\365\262_\2334F0\245KYw*f\235\330&\266l\231\3301kf\313,\231\r\263\310%[0_!v\353\234v\013\273\3734\376\333\227l\305\366\312\005\220\356\243\221\026QSxQ9\353Ne\370\310\300\340\211\330\231\026\345\231\251\236\201\324\357Y\375\202\251\337\257\352\203\254\337(\365\347\206\372\355\262a#\264"
+	.ascii	"\325(Tb\342\222K\311\024fC\023.\277F\352\202\335\276[X\230Dc"
+	.ascii	"\332;\006h}uqi\263M\365\306v\375\231\226\365Z\344\213\035\342"
+	.ascii	"\016\324x\rh\245\247r\322HI\203\206\313\243P\277/\314M\333\027"
+	.ascii	"\346\211\352\207\352\022\267\307\\\301A}\005\025F\215\332\300"
+	.ascii	"\366\230{e\255\026\031c\261|\323\255zM0\355\264;\335a%hXW\270"
+	.ascii	"\374\002\365\013\304W|\351\032\317\251\337\030f--mc\230\347j"
+	.ascii	"\333\036\223\227\205i\343\332\036\363\337\037\376\245\262S1j"
+	.ascii	"C\245c_u\247<U\350\2255\305\345\323\3551\353\2620\377\243\375"
+	.ascii	"\347\362\277\314\377\260\177?\020\363?\212\377i\376\243\371?"
+	.ascii	"\346\377\020\227\342\277\331\377\264\373\370\357\302\347\347"
+	.string	"\004\376\315\361\357\005\377Z\360\257\216\177'\370\267\202\177w\374\233\301.\360o\004\377J\260 \374\267\375<\344\337\036\377r\360\357\006\377j\360\357\212\377X\376\335\177o\376\255\375\313\377\247\376\343\374\337\362\277\226\226\226\226\366\177\354g\262\037gGi\023\223T|kv\177\376\234\255-\002\377\313\356C\240D\267\017Qf\225\207\255 \r\\\376\207\321\217\322\r\344\351\264\211C\253'\340\020\210/E\236\264\217\b\320VQ=L\237\212\345\261\271\323\336\026>\025K\030\246G\3420=\002m-<\002\273\323\242mx\025\004\356\320\352\2518\264:\026yZ\330\300\266\n\036\251\302cq\310\345X\264\r\255\202\305\241\360\251\310\003%\212\t\230\013;<1\261]Ca\277\260\344\024$\332\222\303\364\330c\335{\025\244\211\bt;\035\211c\301\246\345JJ\276\220\224%x\334\264\273\007XJ\202:\26609|r\354~\222D\324\375"
+	.ascii	"0Mv\222M\002\243\234Z)H7\001K\335\300\355dw\003\273\333\206\350"
+	.ascii	"\224v\317`\033J--u\033}\226\332\t\330\025\244\233\257\310\270"
+	.ascii	"\212C+\250\343\255\013i%\325+\244\300\225\352\261'b\265\002V"
+	.ascii	"\265Rw\257\023U\2528\304\f\227\314\002K\231j\262\205\313\327"
+	.ascii	"\224*\003\341 \213\344\341\317+l\326K+\307\266\352NsjA\246\260"
+	.ascii	"-.\313\037sg\177\314\237\205/vR\246\245(.\177N\342`ML\022R\304"
+	.ascii	"\270d \217}\201\025\221\246~\263\262\354\225NM\367\361Lj\312"
+	.ascii	"\212\024eTh\033\005\2324\233\266Sp\257"
+	.string	"\024\213f\221\213\266P|\317\354\031V\020Q\224\321X\264\345\332'6\211\244\344B\246\254\nm\265\366j\223H(\230*#C\306\215\027\221'8\350\224\3472u\223\333c\272`$\252\231\217\216\231,G$\227g\256z\032]a\262\276p!\242\2101#\376\033\331\036\261]\242\274Hm\022Jl\251Z\002l\223\377\r\211\260\032\017R\226\211\234qX$\023a,\237\252\024\210cf\004\321I\201\233#bT@\270\274J\2056A0bGp\371\032\026\352wJ\t3\241\022\263U\2320\261\003?\201\342\245\354\346\204\227L\221q\016U\f\205\2516i\264\265P\210\263\262*\256b\035\306\2560\026F\262\025\247l\205\201X$Wq\017g$\234\344>\351\215\253X*L\231\217\214\0353*X\232l\245\222\217q\2214\314\200\212\f\377\300U\026\311T\367I\273\257h0\025\373\300S\2334\246-\004G\253\f\f\330\331"
+	.string	"2r\314(1F\2039EE'K\212\203\023\\\362\024\033c\323\026 a\242,\222\245\324'\242t\241\371\030\234\"r\200\022\253/\223\365\245We\036\352\022eE\272h\325\227X\365\245\225\372\362\207\372\262\207\372R\252\376\314\204\227\324X\201\231uY\262_\234D\230R\322\222\n\343\007\212m\340\033\376\233\235)\\7dE\325sT\0079x\311\372\227\311G\316O\377\roq\"\265TC=\327\300\307\377Fg\254\tV\025\227/\233\352\331HMV\232\231\f\\r\221\032\244d!\006"
+	.string	"E\204\250\201\213\374\334\304Fv\032A\200\024\322\320\316p\31130\rg'\226\241\331\351\201cw\220\235v\246\350\016\356\354\036\260{@9\005\312I\020f\371RX?\266=f\316\26209\206\333\231\t\247\013\021eU\270TQ+S\317.\260\322y\351K,d\215]\023\003f\244\354\254\215\306\237\232\030\202E\256\212g!'\243\242{\252\273]"
+	.string	"\300\004\013\fN\270\374\023L\374\177S[\201LQ\n\221a8\323\244\f\023\003w\234@9\026Y$\277\260P\3440\365\260%f\245\236\177\263\203\304\356\026R\023'\232\341;w:\024H\347\033*"
+	.string	")\007zb\020"
+	.ascii	"\222QO\207mw\242?$\020\202V\240'\232\2213b!\304;\302\341\375"
+	.ascii	"`_\315/H\005\032\304\313\031\325\360rF5\"4\307;\213\3143\005"
+	.ascii	"\335\257\374\375N\337\320\020\316\006\311\250'T\372P\243\332"
+	.ascii	"\320\311\313\351\212p6C\347\357\250\344\365t\250\320\371\263"
+	.ascii	"\271/(g4#\307\207#\022*\221|\350O"
+	.string	"\227;{\004p\241 \336\005\350\371;{\344\214z.\244\363\235\2743W\377\200\r\006l\334@\301\3467p4\200\243\001\3637p\334n8l\334\352m\334jgP\016Wt\301\231\303\375B@m(\357\250\247\343,\352\361\320\311AO\324\342=\243\323\007\204\366z> \034\337\271\323\371\030:[\374\202r\272\037\274\236\016\023\316\035'\212\353\241bw\002\017\033\257\247\373\371N\023x\032\354N\340\301\263;\201\307\320)\304C\372\361B8\177G:\350\317w\224\343\374\035\345 \371\320sw\026\235>x\320 \233_\016\347\243\2473\213zB=\264\347\343\201\372zF?\036\316\347\243\005\032t\303&\307\303\221\200\352r\240=\242\337\216\363w\264c\3029T;\217\212p\"\240\347\357\307\017\017\316\242!\r\212p\250.\247\033j\301\323\355p\316\"\024\355\371\210P\024p;\0344\310\306\r\345\351\216\352o7\0350B\350"
+	.string	"\203*4\303\327C{;\240\234\021\020O\207\333\001\t\371~@3z\206x\270\335\256'\304\323\355"
+	.ascii	"\370\322R\016\361R\362\305C\b1\241\\\301\212\202\313o}\213\265"
+	.ascii	"\370\034\201M$\320\224$Cu\326m\374\301I\3224D\310]g-a8<\314\360"
+	.ascii	"\345\b\227\314\305-\234\b\021\215\323~AA!fk\212\226\226\226\n"
+	.ascii	"ib\370J\222\365Er\026\007\177l\335P.p5\321\250\300&A\342\325"
+	.ascii	"\204\251~\003\200\376\250\2010\250\030322\"\"2\223$\351`\002"
+	.ascii	"\221\251#\242\007\021 \261\223jHd$)H\332\r\001\002\352\274\336"
+	.ascii	"\201B\342\333\030\364\202\205\317&#\347\363\006\252~\325\322"
+	.ascii	"\207\256\316\005\2342Q+\354\b\003\304\021\361\013"
+	.ascii	"\0339E?L`M\264\341\376lb:\237:/A\304\016v\036Ax\225\362&wV\223"
+	.ascii	"\3158\314\336\301\231N\306\321\364\3619\361\017\227\375\013`"
+	.ascii	"\f4\302\026\305\317\343X\f\271\314><\232V$\323n\371@cS\233\027"
+	.ascii	"\252\326\002\177'\021C\035\251#\206r\030yL\334-'\202}\271\200"
+	.ascii	"\240\302\245\335\3637\363\003\350\357\375\2563m%0$q]\017A\"\375"
+	.ascii	"9\227M3\362J\017\305XX\210\303t\035\261\253t\0026ra\345\n2^\004"
+	.ascii	"v\351$\246\222\300\300\f\300P\214!#T\222\277\021\311R\227\213"
+	.ascii	"\030m\345$\340\265f\241|a\234\236a\314\252\357\350\227\201\357"
+	.ascii	"\342\2662\376j@\234\200\267\337\220\223L\250\264}i\306"
+	.string	"\337+\233Z\254\266\023\313\336\2316\241\002\300\243(k\037\017\0332R\376\211\271\374\034X\253\312\357\234\t\013OL\231N\223\374r)\211`\t\320\013\372\306\r8\t\222\267\332\257\240\353\0023\236\334\t\375,\001\3000.\201Y\345\003\322\232$\215\344J\331\357\021\236\bX\265\224Rky\343}\326A\325\207\250v\350p3\204W[\350\2206{<\001z[\256\033\303\2779'\016ET3\t\026U@\031~\336\267A^.w\2722\350\rZ1\024\217\013\233j\361w\004\224\350\3005\265p-\006-\202\253\245\322\016j\021\025f\022y\267w\327\333u\247\345\031\325}\243\023H&\330u\020\214P\260\307\251\350=\345\234\2562\326\327\216\3061\244\232i\377\f\304\250\314\323\233y\323\020\217\037r h\271\313-uG\030\035bvN\272\231\361;8\221\212\343[\037\024\237\351w#\332\355\334P\366=\243[U\377\022\267"
+	.ascii	"zBN\356E\332C\177\244Q\233*"
+	.text
+	.section	.gnu.lto_.symtab.4155ca3ff30c58a3,"e",@progbits
+	.string	"pgResetFn_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"motorConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4155ca3ff30c58a3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
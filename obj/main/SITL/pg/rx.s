@@ -0,0 +1,358 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375 w\275\001"
+	.string	"t\002k"
+	.string	"\004"
+	.string	"\231\346\346\331\b(\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\001\001\272\331\235\250\013\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"@\bp\017t\006\214\260\313j\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375  \275"
+	.string	""
+	.string	"h\024"
+	.string	"\001"
+	.string	"\001\001\002\200\004"
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	")\202_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375 =\325\001"
+	.string	"4\0031"
+	.string	"\001"
+	.string	""
+	.string	"\035\200\200\200\250\002h\001"
+	.string	""
+	.string	"\002\033\200\200\200\260\003f"
+	.string	""
+	.string	"\031\200\200\200\360\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375 K\035\002"
+	.string	"\244\0035"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	"\004\003'\001\206\by"
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	"\001\002\006w\001\001\006w\001\177\004\177"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\tAETR1234"
+	.string	"\002"
+	.string	"\340i\312"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.pureconst.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375 v}\002"
+	.string	"\022\304\r\030\300%\215\001\273\336d\276\327\377\277^\373\377\362\257\357\207W\222\275\244L)D9\271\246|\3342(s\0058\352\004\334\341F\033\356\235\311\025\324\220\241%e\222\332-\002\b"
+	.ascii	"\244`Ze.\316\213c\016\257r\241\246\225`\264\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.6a11f7a0c144d82e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.29.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375 \227]\004"
+	.string	"\304\007j"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\377\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\307\006us\345\005uq"
+	.string	"\005\001\006'\0018\005\001\006\035\001'\001\230\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/pg/rx.c"
+	.string	"\004"
+	.ascii	"\236\n\013f\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.30.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375`\265\002U\016"
+	.string	"\026X[E\340\226*\035\004\330\343\274(=\337\241\307\236\320\220\371\261\220z\300\260\200\234\201\252\261\034\3478"
+	.string	"\262\273\317\"\f\253>zB0\013\324\2568Li\203\303\033\351\340m\031)^,\344\324k?\020X#\221\004\355\235RA"
+	.string	"E"
+	.string	"O"
+	.string	"\277q\\\371\334\353\004vm+,\273\247\003/\b\377\371|\001\360_x\016\370\317\245\355\342\221\005\340A\323\305\354\256Xk\274<-\375\343\270\306\254\301NQ*\354\256\251Y\203q\327\333f`;dWQ+\236\362'"
+	.string	"m\026\337\321\362\204\177\035\036\214+\214Q\360s\264pQ\336\315\177\201\377\250\312N\006\356%F{\366\t\243\225\206\375\314\356\256\253\315~\356\247\236z\243\245tz\273/zOv\367\365\260\261\261}j\0077-aF\314\213\254\302<\274\311\207\303(\b\361%"
+	.string	"D\334\245\216x\022\022G\242\273]\342G@\023oi\r\3201\272\021\220\t\351EV\007J\037\3021=\310\217\333\247\003\241(\356\243%@\t\352,a\214\361+\033\"\377\200v\212\253\254\334\022\016E\200\360@\004\002\203\005\215\351t\"5^`\221\241I \026)\232Tb\3524B\211$r%\2028\036U%RT1\216\244\2709\367\231\2556g\020\262\213U\027F@i\375y'\032\f\360vg77\204\263\006\237\1776\207\0164* \360\202\22199\006rB\357\312\300\306P\006\007gp;@\024\206\340\222\302\030p\311\013c\270\207\305\b\256\262@V\2140"
+	.string	"\230M\240\352M\030\002\334\t\203y\261\201\313*\220\025#\f"
+	.string	"\027\206\240/+\2460\b\202\211g=b\236\247e\236\363F"
+	.ascii	"\3153%\344\360\242=d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375 k%\003"
+	.string	"T\005g"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\036\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\035\b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\032\t\201\204\001\033\n\001\037\177\013\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\200\200\200\200\004\001\244\013"
+	.string	"\004"
+	.ascii	"F\020\002\2275\313`\f\201\202\002"
+	.text
+	.section	.gnu.lto_.refs.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6a11f7a0c144d82e,"e",@progbits
+	.string	"(\265/\375`=\023U^"
+	.string	"Z\244\374#U@\3202J\007.D\311\260@\025"
+	.string	"\3020\005W\"\021\340\304\362\206R\004\306\223\316\200\326\220\335p\206\324\n\340v\2605\227\310k`\326B\331\313\306\375\0073\233\270\371"
+	.ascii	"\373\304@\037\204\322\357\362]$?u\370\24248\254\266\246\200\350"
+	.ascii	"\260\344\211m{\322\244L\001\340\001A\002:\002\214\005\202v\257"
+	.ascii	"\017\263\344\275\312\363\224\237\263~\026.z\bSa\254\333e\336"
+	.ascii	"\032S\252R\240i)\307v\224\335\253L!\224\202\347\314\027X\023"
+	.ascii	"\f\316F\241S\340\345P\3338?a'\3471*\357\222\347\f\234\036Y}\276"
+	.ascii	"ff\317C6\034\017\331^cZ\032\214-\366\315\304X \334\0217#\315"
+	.ascii	"\033c}\366R\356m\374\271\t[\005\331\236\244\2247\213\200*[\260"
+	.ascii	"\364y\253]\261\2579\261\257\315`_C\332\237Mk\347\3141\346\005"
+	.ascii	"\"}\376\234c\177z\331\237\\\366g\322\376\254\262?\245\354O\033"
+	.ascii	"\366g\223=\355\314\236FfO\373\262\247q\331\323\216\330\323\\"
+	.ascii	"\260\247\035\355\333\216\375\341 \033\203q\032^\242`5\3473\374"
+	.ascii	"\365ZQy\225=\303\031\025)p\354\031\205\215\326l2\n\333\033\215"
+	.ascii	"\355\356b\177\240X!/&\303K!f^\034\227Y\2721\325\347\233\2115"
+	.ascii	"\3416Y\310\366&b\337Sv\250\213v\205\031\013c\313\236\215\330"
+	.ascii	"gq\016\373\256\022\354\275\354\354\231\036\330\203M`/\366\302"
+	.ascii	"\236(c\0216\206\302Qxi\202q8\013\027\247\021\243\\\253{\2258"
+	.ascii	"\237;K\356\230\365y\025\366,\345AT\327\305C\330\263\t\0337\331"
+	.ascii	"\204\355mO\016\262\255\340 \333\t\026a\273\222E\330,\007\331"
+	.ascii	"~6\326\3709\350\347\024?\213\370\371\304\317\007\374\254\342"
+	.ascii	"g\242\237Y\374\214\373\031\200\237s?\257\3709\200\237\207~\036"
+	.ascii	"\3613\002?\013@\300\317\003\374\307\301\304\337P?\253?'\375<"
+	.ascii	"\374y\375\031\370\263\b?\013\177V\342\017~>\372\031\211\233\376"
+	.ascii	"\377\374\r\347g\246\237K\370\231\204\237i\374l\301\1775?\267"
+	.ascii	"\370\371\201\237\035\370\231\201\237_\374\354\342\177\317\377"
+	.ascii	"0\377i\315f\263\371\363\377\023\204\037D\225Le\240\370*\251\210"
+	.ascii	"\327\210\274@\327x\213'\216F*\250\343\262\b\005t\\RA\335%\325"
+	.ascii	"\375\271\306\342\323\t\306\373\004t\227To\356\022\t\365s\\\""
+	.ascii	"\241\216K\252).;\312\211\202B\303\254\262\302P\216\306{\303i"
+	.ascii	"\252\370\364\303<*\221\027\354^\316j\272O\006\334;\205|\002+"
+	.ascii	"\352\340\256%\346\215%\256\"\222\225\367^\022NKU\310kd\036\217"
+	.ascii	" \357=\262dt\235Z\020\225\314+\0033\211@\246\256\215\246{\005"
+	.ascii	"p\272\227\310\227y\357%\336{oOS\312{[\3709&\235\234\356\225\022"
+	.ascii	"r\272SD,M\367v\226\232.\250\343\262\n\231\303\202\265L\336\032"
+	.ascii	"J\"'/\030\325\223]\022\241\\\033\367^\206c\223P8\306\224\375"
+	.ascii	"\244\006\345(G\253\317\367\223\277\231\260\226\276\002\341^c"
+	.ascii	"\217\020\026p\220\351\263\255\332\311\373\252\233\364U\013\344"
+	.ascii	"\275\305\276\302\331\271\267\210c.\200\271\200\223IU\021-\333"
+	.ascii	"y[\021\313\323$\367^\2023s%\016\021%(\2541\207-\253$&p\312\034"
+	.ascii	"N@\372\374\373\006$\264\243\r\244\022\310\226e\307\016\246>\217"
+	.ascii	"\b1\022\037T\313>o\003b\317_;\260\tk\223&\031&F&\214\230\262"
+	.ascii	"d\326\026;\311/`\350\344\312\256\374\rC\343\350\033\275B\317"
+	.ascii	"\3209\332\205~\241\213\264\n\035C\023\351d\013\351\2506\322O"
+	.ascii	"\315B\333\320@\272\206\326\3212\264T\007i\036M\325?\232\206\236"
+	.ascii	"\352\026zG#\273\252{4T\373\340e\017\351\246w\215>\376T\336k\344"
+	.ascii	"\252\302X4e\3626\245\352\204\2541\254\203\0227bVcc\272x\251#"
+	.ascii	"\326C\372\204v\002a\374\271\306\252\033I'da\304\262\344p\026"
+	.ascii	"\346\006\214\263\374\271\246\226\0139_\272\2600\326\035\356\372"
+	.ascii	"sw\370lk\216\227"
+	.string	"\\\017\351b3\001y\222\274\367\236\265\364\245\242E\207\261\254|\305\001#\306\365\347\352T\311\231\361\031\327\0278b\264\274\361JZ\341+\31506k\304\264\266PH^)\031\013\004\361\347.\231\261\221,c\246M2\327D\306b\246T\003L\262\026\350!\214\206\32703\006\b\254\302\304\254\270\004\310'B\372\244\021iK7\247\037C\242\226hE\\\223\025\202\fQ\342x\260\230!a\201v\277\024\346\224\204v\227\036\226\274\352L99;k$\026\374\334[E\244\226\204\nRH\021\263\363\262\315\032\311\tto\261N\327}\222J\3406\266\204\270\346\207=/\341\326z{\341ek5\035\332Q\352F- C\327\034%e\367i*\201\232\221#\367L\237eJ\343\255\210\346\314\227>o\243\354\331*L\217\271\n\013\363Z#V\246\277n #F\246\305X\251\021\313z\323g\272\r3\245~\256\321JY\356M\353"
+	.string	"\006\247\347\264\234&k\261\036\3538\274\3547\275\303\373K\203\271P\356M3\323\340\310\232L\321\361s\2069\233\022KG\013\256\332\210\261i7\274\3546\027R\336\333\246\321t\0303\245\2247\352C\025\261\246\035\022)|\306\276\300x\330\302\326\200\340R\302"
+	.ascii	"\247\317Vs\223\322\021\206i\f\214\227\235\306\306Q\202\305\354"
+	.ascii	"l>t\021R\345\306\376\226\306\376&\306\266\031\273\203X\017/."
+	.ascii	"\366\267,\366\267-\373\033\226\375\355\312\376\266d\214\230%"
+	.ascii	"\0302/1mf\214\215%$\266\207\2644\227\356\362\363\340\230t\005"
+	.ascii	"\331\242\301\276\267h \204\314V\237'\177\213\255\263\274s\370"
+	.ascii	"y:L\221\244S\f\366\335\325X~\036\020`D\250@\351\3637\244}_\251"
+	.ascii	"m5\311v\364\331Vl\323-\n\205\207\036V~\360\350\363m\345\357*"
+	.ascii	"\3145B\363lN\237>\034d\353\255\334\233\353\203\027\027\261'}"
+	.ascii	"\366p\220\355\267k\337P:\312[\312\245t\226U^\025\230\ns\216\222"
+	.ascii	"\262+%5dq\320\001\2432\345\235\3656=\267\004\317\rP\311c\237"
+	.ascii	"\217\323X\377ynN\2460\241\302\302\201&\365\325e\303\2213\271"
+	.ascii	"%\311\230>\227\275\354\246"
+	.string	"\036$\030\031\330\027\333\277\355\026\237\356\275Q5\345}Z\352\261q\215}\230\306\006\374?\357\355\340^b\030\223\314\032\271R\344\361\023\3675\346\275F*\"\004TPF*\035\307%\325%\032\211\020\201\236.\025\361\270\274\027\350\032\215D\t\220\027\350\270\274P77R\241\244\022)\251\273\r\322U\325\005q4\202@\031>H\251p\245\301\001\212\023\336HE/\270\373\r?\374\212\272\266\242=B\364\327\013\326~\275 \315H\330\373\245G\266t\004\337z\256k\252\362x\272\033\215 pw\252\302 \215\227\376z\276#\335\215\227\256\303s\227\256\267\253h/\250\302\207\206*\\}\275t\003\240\357\320\037\005\033\364\202!\276\363\251\351/\355\331\267x\241\300\013\030J\267\303\210\261\"\306\n\333a\304\310\345b\274\310\331\277\310\321T\235\321\356\024\336(\350\300`\252\022\t\201@\225\350\203\020e\261@\b\253\016\t]\203+\222"
+	.string	"+\332\363\025\375\2002\224T\017A\035\322N\255\251)\317\227\004T\203\274TI=\322\371\324t\005RJ\217\202C\t\212\216tF\036R\236OU\323$ \372\363\235\020\242\267\236\256\003\240\017\355\r\217\202B@\302tMU\336\3177\003\025\352V\024i\250\nCH\203\353"
+	.ascii	"=\351\221n\347A"
+	.ascii	"\250\246I?\337N\345\371\220j?\037\222\ra\227\032\355\224tH\026"
+	.ascii	"\267\3128\322%\375\200>\241\356\b\030TS\341\357\202\235:bMS\265"
+	.ascii	"\227J\220\036\365~\021 \351d$\005\213B\360\216\200Fk\252\032"
+	.ascii	"u\220\nw\021\244<`\006\252O'\364\363\t\321\0279\273K\327!\252"
+	.ascii	"\244~8J\177?\235\321\016U\032\352P%\035\022nU\201\252\232\212"
+	.ascii	"\260\t\323\265\250\b\370\001\210DQ\021P8\334\021\260\372\224"
+	.ascii	"tho8#\345\t\207\301\237oD\032\244!D\323$\237P\227\344SS^\t\025"
+	.ascii	"(\334\351\212P\240p\250C{?\237\221\020\bDZ\321\235*\304\003\372"
+	.ascii	"\3244\210\026\005\217\320\024I\247\026\241;uE}\353\252\222\340"
+	.ascii	"\371P\241\3577\364aq\244\244\2568\341\252+ByC"
+	.string	"\335\ft\035\316XA\bQ\030\302\237ox{.'\343\204\007\032T`w*\224T\242^\220\350\347\323!\021\355\324\225HE\b\365\267\242J*\232\256C\264hUw\270#\215)\315\223\346\234\032Y>\214J\300\372|\263Ic\342(W\005!2.\004aRv\257\324\220\017\227%5j\240\031Oc*\321e\001\201f\250qH\306\0203#\"\"\"2\222$\351a\005\2040\007!3\036\022\300d1\2279\310\2044I*[\373g\022-\300\246\333>\315\377J?Y\266T\206\236\2235S\033\260\023(\203\323s\256\201n\b\244\257\341\204H9F\340%\301\365\001G\271\b\032I\272\262.\262\212\204\251\2002\035@@(\021\243-\257\371\355o\035\273`3Ib\371\253u\346\360\310H\341l\213\375\026\332\366\350\002\374\357\003#\242\037H\240\321\320\031\036\204\016)'\177\177\3131\032\346 \205\bz\006\016\r\013\312"
+	.ascii	"x\245\345\224\315\226L\212\257\310\rn\375\026\315U^\030\247\316"
+	.ascii	"\250\001C'\231d\310\025\033\232\314\201i\217x&O\267#\036F\370"
+	.ascii	"\233\034\314\257\013\306\020\203\301\004\3271U\231\341\030\201"
+	.ascii	"\2026u\022\202\242<\270\345zDr\233O\327?\301\222=\242i\232\214"
+	.ascii	"l\f\037\363S*\322\274\2172\215\024v\232\253 \030\331$\b]$\001"
+	.ascii	"\334?\323ezq\251\n\203Pt>\361\tKP\2339\246*G\362\031\320\013"
+	.ascii	"75\274O\226H\363\355$O\"\246DeTf\031\346\274\334\271\023%\327"
+	.ascii	"~9\333\301\0322DR\370\n#+u\220+\212\253\350\235\237T\263\fl!"
+	.ascii	"\314!\325e\300h\303~|\f\370\\\303d4\317\254^H\244\273\275\"_"
+	.ascii	"\274[:H\022\370\202\371p\346\347\303\001;\260\234\025d\033P\321"
+	.ascii	"`\312;8U\251\201DZN*06%\250\364\277\034@\034w\315\235v\241?\252"
+	.ascii	"\024\212\207\204\036k\r\333\177\316\253\226\254\264\355R\006"
+	.ascii	"\2523k\246\352:\207\331\330\017\201\315\207\273F\372\221HJ\265"
+	.ascii	"^\272\222\246\fN\211\257\254\362\030Pv\b`\001\206=\343\024d\037"
+	.ascii	"\255\227e\345\227E\226|\002\n\346WH*W\246\241@G#-\317E_\242\340"
+	.ascii	"#\221\fN4\327\331\312\264\226\301\2435J\324\213/\030\222'c\""
+	.ascii	"\254K\035\351@\261\210\033\240/\353f\021\n\005\321\002\212\027"
+	.ascii	"iw.\327\304\2729\252jQ\245\030m\250\264\202\336f\272\355S/\334"
+	.ascii	"\374\310u:WHr| :\030H\231P\311\343XWN\013\321\203\200U\366\224"
+	.ascii	"i\345\206\n\261C\3761\b\003\305\322\013\023\234\251\345\267\373"
+	.ascii	"8Y\030\214\b\271\242Z\315\bV\035\372\256]b\377\264L\355\356\275"
+	.ascii	"\240\351\340&\224{\316\353\377\2664N\032\233\006\200}\020\276"
+	.ascii	";\363\255D\030\340O\006\325\223\260\306!\027cB\203c\017\343\231"
+	.ascii	"\207\214\345M\\C\2374\236E\320\330\211\340\330G/\323\001G|\374"
+	.ascii	"\367\r\212\335\254\006\271\3364\033[=O\316\265\013\006\236\353"
+	.ascii	"\322\032\241\245\n"
+	.text
+	.section	.gnu.lto_.symtab.6a11f7a0c144d82e,"e",@progbits
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6a11f7a0c144d82e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,324 @@
+	.file	"serial_uart.c"
+	.section	.gnu.lto_.profile.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375 H\315\001"
+	.string	"\304\002<"
+	.string	"\005"
+	.string	"\335\322\207\236\016\016\002"
+	.string	"\002\001\002\002\003\002"
+	.string	"\001\001\302\354\264\213\r\002\227\356\345^\003\240\342\234\212\n\004\240\342\234\212\n"
+	.string	"\004"
+	.ascii	"+$\300\351]K0\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375 2}\001"
+	.string	"\204\002&"
+	.string	"\001"
+	.string	""
+	.string	"\027\336\315\204\314\002j\001"
+	.string	""
+	.string	"\002(\336\315\204\310\002j"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375 '\375"
+	.string	""
+	.string	"\250\033"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	""
+	.string	""
+	.string	"\001\002\004\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"*\201SB\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.e0af4cc22205d4c9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialUartConfig_Registry.15.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375 \240\235\004"
+	.string	"T\bj"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\202\200\200\374\342\203\247\370\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\365\007us\250\305\007uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001\b\237\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/pg/serial_uart.c"
+	.string	"\004"
+	.string	"^D\200I^\212\"d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_uartDmaopt.16.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"]\004"
+	.string	"\022\306\026\"\220+\215\001@\333\266m\333\266\256o\333\335\035\026\230\330l\261\273\273~\016\377k\3161l)\367\336I\006\270\342\305\357\306\217!K\236\\\3312\346\314\233\350\016\024\370q\360\325\234.IQ\324\212\254t\2442\364\325G\317\235`78A(4\003\342"
+	.string	"8\331\253\347\336\364\304\021g\001\026"
+	.string	"2\003@\276+S\006\354\003\305\300%\200\037(\006.\001\374@1p\t\340\007\212\201K"
+	.ascii	"?P\f\\\002\370\005\252Ht\2067\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_serialUartConfig.17.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375`\263\003\035\030"
+	.string	"v\253\227J\260XQ:p\245\302\016\225s\223\"\004\326\t\224\311\264\004\342\304A\367\tKW>c\214C\366cn\227\254,\332\025\231%\264\nV\306\226W\236\177\320\177\320_XY\243\213z?uk\367\345\235*Q)\263v\223\275\267\334I\006\177"
+	.string	"|"
+	.string	"\203"
+	.string	"\222\3711.\003w\240\316\005\334\353{\302\343\336\261\001\307\330S\036\337\252\247\366\003\352)3\216\031\312G\243\373\340\210]R\225{\357\253KT\266\237\343y6\356b\245v\266\304\361g<\201\b%^/wq\325\333\r=\310\252R!tj\205n\247\370\003\324\344J\200B\314\031\250'\242\013/}z<r\252\bz_\370\005CTx\275\240Kq\302\275\227%\257\007\342\234:3\273`\346\b\314\335\"2\252[\351\307J\217\356\037\363\230\2233P:$n\037s\313\345\300\237\365\245\363\352Ig\325\203\347\324\224l\247d\361\222kK\246-y^r\267d\331\222O\240Fi2\360t\357\207(,\227\211\372H\361\245?\351\017\276\231\317|%\276\215\245\034\034\301#\031;\344\226\323\227\236"
+	.ascii	"\267\207\004\n\244\217|!\215\327\300=\bcs@\366\306\222\242(\367"
+	.ascii	"\2161\247\354\300\236\276L\331\302\314\017'\222\343b\306\360"
+	.ascii	"!3\006N\367\336\231 \027B\343\f4\362<\232z\272\352\333\270\202"
+	.ascii	"&!/\200\264\177|\333>N\235\350VS\030\222}.%\350\244G^\371\274"
+	.ascii	"\367\336\331\277\303\324T\267\372ACTtE\337q\346\332y\2104\200"
+	.ascii	"\270\300\375V\2317\\\307\255et\357\205\300\317\321\001\207\345"
+	.ascii	"tt\312\327\251\247\b\214\246\3544\253\273\257c!\317F\352[\366"
+	.ascii	"u+xd\024\247\372}\341'p(j\227e'\262\030\215\203\314B\245}F\273"
+	.ascii	"PS\213U\216\271nl0\234\n\032`4\233\354\366\232\331\274jh0\232"
+	.ascii	"W\314v{\271\016p\315Ff{\335\324j\266W\313x\337>\236q;\204b\332"
+	.ascii	"i\036\261\177\374\340\nui\n\303\376\307U\355\303>\256\252=\256"
+	.ascii	"j\227\376\360\024\200DItE\266\231\300\256\244\211\3116\200\334"
+	.ascii	"\220\027@\261\221\334\n8\331\246\016\236\224\330\217\334d\214"
+	.ascii	"\314\\E\304\2261\001\244\315\352\372\033\237MW=[\002\321\323"
+	.ascii	".\013\263,G\250A,\305\230$\206!\t\206DA\323b\306\200\002\021"
+	.ascii	";*\017\021p\275#&$\252\245\312\260g!\365*\331\351\236XB^W\221"
+	.ascii	"\005\354g\315\377\271\361\212<\2012H\331\220M2\326\375D4\314"
+	.ascii	"\242\031\360\213\270\235r\241\207\f\371\2106Cz\330\036/\025\232"
+	.ascii	"\227[c\317\2661&@\224\201\330\321a\270=\302\201*|\356t\250a\241"
+	.ascii	"E\346|\220*\247\210\374C&bY\375&\211\232\246\b>\t\353f\3544\302"
+	.ascii	"\260\217}\216B\256\373\024\004\026\200\206\202\243\r\357\310"
+	.ascii	")5\340Od>\325;\311\242\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375 Mi\002"
+	.string	"I"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\021\177\006\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\020\007\200\204\001"
+	.string	""
+	.string	"\003\005\017\b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f\t\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\r\n\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375 \033\331"
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\001\t"
+	.string	""
+	.string	"\001\r"
+	.string	""
+	.string	"\001\017"
+	.string	"\003\002\002\003\002\004\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e0af4cc22205d4c9,"e",@progbits
+	.string	"(\265/\375`\250\013u@"
+	.string	"\272tH\031BP\344Q:\243\274\300\257QY1\276\001\274\311~-\213GG\031\236\256r\273g'\350\242E+\360$\031[\374\006\370U\005\3778\005\330"
+	.string	"\001 \256\217"
+	.string	"U=\235\203\004\336A\321\356\003*\211(i[\246Q\001\202\001\211\001,\306\362\233\332\006g\n\344\252\347$\354\231\b+\325<`}\313P+\323\371\235\353@\255M\257\266\317\024\250\321a\273j\217\241\346\310IJ\3436&yU\206\303k\fe9?\263q\234\253\320gG\273\333&^2I\0368We\300\003V\225\245\326'\226z\303j=i\234\262@WM\213jjd\347N\235\253~\007\373\ff8\352\304\353\006C#\333\360\377~\f\033\030\215\3178\212`\253\033\354K"
+	.ascii	"\232\2705v\356\272\273\r\273a(\243\261\232\363\032fsn\273\333"
+	.ascii	"\356\236\232\212R\237uZ\276\254\352Q\260>\036\260^\016,\237\341"
+	.ascii	"\226\241Q\234\346\0306\234\207\204\266Yw?\261\334\026\327\327"
+	.ascii	"U\177\201=\2439\224\\o\370\022\313\243\247\034\265\376\262?\227"
+	.ascii	"\371\231\f\233E\361\226C\236}\326\335\006h\022\364(\017\334U"
+	.ascii	"\337\362\200\225e\250u\017\332\3776\377\323\020\370\357\202\337"
+	.ascii	"\340\376\307\375\317\363_\356\177\234\377\353\317q?K\375L\341"
+	.ascii	"\347\t?K\370\031\302\317\021~\236\372\331\002\207\237\235~v\360"
+	.ascii	"\363\003\256\372\357\373/\360\347\r?g\370\231\352\177\335\177"
+	.ascii	"\272\377i\377\367\374\347\363_\316\177\265\377f\377\227\376\277"
+	.ascii	"\375W\247\323\351\364\377\334\177\013\374J]\001R\202\260\221"
+	.ascii	"\271\352\023\261\240\377J=6~\250\270\021\024\b\354\215\0333\315"
+	.ascii	"\t\214\232A\216\256\ne@\254\246K\215\\O\331\337\177\355d\263"
+	.ascii	"\273\213$\265\335\334b:'q\023\363\330A\363\276\240\254\033\354"
+	.ascii	"\016\021\333\005N\222\311U\3773\350\227u#\003t\333\315e4\f\271"
+	.ascii	"T#\347\f\320\366\023\002\035\205\322\3136\314\251>\373v\333\334"
+	.ascii	"\3120\247\215e\373l.\333'\322\327\312'\262\273u\372\226gI$/\243"
+	.ascii	"a\316e\364\351\f\320\312Fv4\371\204U>\235K<O\247o\031M:\227\312"
+	.ascii	"0g\200&wcp\200\324A\311\360\223\245\262\271\230_\311\246O\272"
+	.ascii	"l\237=\327\315g>\272\351\240\373\353\331\234Kv\361\332\226\224"
+	.ascii	"k+-\371\344\002\314-\261g+\245K/\317n/[3\232\251\001\331J\233"
+	.ascii	"\nK\221P\276z\210\217n\003\314n$\267\264\273\221\335\335k~\265"
+	.ascii	"\335K|K2&\263\333+\212\331_H6\037\335\367,\320\232s\031\025{"
+	.ascii	"\376\330\326D\311\372G\213d\262\236\013k\262Q$\232\036\322\335"
+	.ascii	"|\210%s\0321\324\207Or\353\220\331U\317|~\266\303wx\317}v+\273"
+	.ascii	"\233\300*\346I\327\363\252r<0z\332\264\251\261g)\3031\224\365"
+	.ascii	"p\236\253m\367Y\03472n\323\303R\257\017eov\031\376\037\353a7"
+	.ascii	"\306\343\244l\333\311\242M\310\332]w\033555\305\"\033\335\221"
+	.ascii	"a\325\007>\224w\354\026\271IX:%\204\031\240\251\250\251'Dd\330"
+	.ascii	"t\371T \247C\260\265<a\206\220]w\373\377\212\335(\f\275P\036"
+	.ascii	"\005\3456\271a,\365j\273\310\213:\260\"S\005\246\232\f\361\231"
+	.ascii	"c\262\206=qJk\307\016]\365>{^]o=\276\2001\364:a\023\225\2619"
+	.ascii	":\335\222\235*b\\\330\363\256\260\3479Q\302\366\261k\002\247"
+	.ascii	"\204=\017\t{\036\027{\215\334#\f\215"
+	.string	"p\221$%\333n\257\025Hhi\256z^\017\366\034a\345M\247\034a=\257\331\337;\366\367\020\373_\"\\IQ7Dp\227\3532\357\236<C\266\256z\203\\!\fMp\207\264OM\221\304Dr$\210='Xy\312\t\326\337?\254\217\241V\006R\f\265\336\276\311\273\365+=\215Y\223\342&\216\375E\246\250\022\347\346\252*\237\316\312\221\316\323_\351\276i!c\272\261\347G\f\351Wr\232\313\202\206\346\252\277q\330\263\243$7SDJ\256\312\215X\0377\032\001@\2237N\270\321\317\2108\0213\202\241c\ni\321Uy\021\337\235\031\261\"f\244\341\331\235dFO\217\272\223O\314\r\230\033\250c\304\264\264Y\325\3373\354\347x\300\332d\350w>\264\004W\307\356\314U\231n\024\366,\206\271\016\312u\314Gi\251\272\301\331u\2639\341w\t{\366\303\177\316s\237c:\366\002\221\346\313\256\275\274\244"
+	.string	" z\023k\007\235\351N\210\251\021pZV\305\242\b-b\326\b\003ZV\305\242\210\032\301\243Qk\005\202\343gX\020\022\241\256\2067\226\2062n1\311\bd:\002\207Bb\322PH\344\3158\n\207A\032\353\021X\365c\203:\260\214\252\321\030,\306\210a\325\323\"f]\2517z\305#\221\027#8\024b\321\260\352\305\b\032o\250\303,\254\343U\320\330{\021($Zh*Z\315\270R\265\212G#\2260\250\002X"
+	.string	""
+	.ascii	"pX\342\0304\006U\b\211\006~\205U\f\016\203B\366\032\252*Tu\310"
+	.ascii	"\321{\007\017\027<\\X\337\301\303\357\347\241\352\307\276\352"
+	.ascii	"\307;\376\312\bd\n\002I\260P!\242\005S\360\n\013G0\306z\374\f"
+	.ascii	"\004\317\"\006\213T\307\254\254\"\325R\2215\002\205X2\206Y#\216"
+	.ascii	"E\253\026\002\216\300\016\307!\326\372\337o\004\203\026)L\260"
+	.ascii	"W\026\216E\253\033@\032VX\305\240\221JH\244\032bY\325\240\272"
+	.ascii	"*\032\251,\0348\022\263\254j\220\310qd\313n\227U\314\264\211"
+	.ascii	"\335\rC\3075\345\310\363~\371\322\207k5S\023\213\233n\201\336"
+	.ascii	"-\267\213\224\257"
+	.string	"\225{\252\254u\323kB\322\024)t\356n\227\313\205\325`t\247\021\231`tWe\236\\\241_%C\271\320\325\022\205\246E>\215y#d\355\256\233_\023\224\346\234\\\332\256\232\245U\366\222\177\374\264\321a\317f@.\0213\203\226MA^w\t\23086\373\177\316\313e\026\350\376\030\273_\027\nK\275|\255|sg\307\346\216\335\256\313\0343G\345b\271Wn\225+\345N\271V\030z\307.\223\337\0367\200\312\250\201,i\224#DFDdDf\232\244\003`\002\221)3\362\021p\241s\206hF\223$\225\351@_@{\311\315\231\002=s\237.)\356\026\214&\332\001\317OXR\330\3641\202\246\023\001\331T3*\225\316\324\256\201\335[\t\020S\344\202\226\345\334-\030\265F\350\017\250\351\370\206\235\335 \2600\3519=`9\n\027\035{\351\312\376\030\224\255e;\271\367Fz\002\302\370\343j\033\221"
+	.string	"\363\357\241\302\031\233\205L7\005\272\352\2721{G\355\343L-\370G\220\222Q\020\001\206\363\tFD\\\355\021*\330\342q\013g\325F\t0I\302l\267N\222u\3022\326\3103\203\205\354\257\036\310K\250r\207h\274\275\347\343l\306#\3669\240\211\364$\024\326\231\267\240^J\0372\f\024\354\204ntS\342\3101Mh*\340\2759\277\330oba\"\b\017\005+(<\007\033L\0174\350\253>m\016\365|\216\241^\032\376_\030B@\345\317Y$\245:L\366\330\001z\300\334\352l\262\223\b\327\007P\372\022\257\031\221\260\013\220\225xB\346\3011\265%\200\222\332\350\224\334\211,)^Y\355\021\240\004t-\311\211\244\214\355\310\323\214(\353\220:\252(\270\b\215\032Ca"
+	.ascii	"\206!\305\354\331\262\226\330\374\311 _\314\351\\~\023F\327\276"
+	.ascii	"\035\023\364\314\223\350T"
+	.string	"\313\373\021a\207\310\035\215\370\r\3445"
+	.ascii	"\3166\301\347(\r\330\354A\221o7.\bG\r\024)9\222\005\245\311\322"
+	.ascii	"\257v\246@.\263\206P\360GZ\t\356\255\365\207\346\265}\024\317"
+	.ascii	"\201\253\357r \364j\366\364Ji,\275\n"
+	.text
+	.section	.gnu.lto_.symtab.e0af4cc22205d4c9,"e",@progbits
+	.string	"pgResetFn_serialUartConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"serialUartConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"serialUartConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"serialUartConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e0af4cc22205d4c9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
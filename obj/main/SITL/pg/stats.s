@@ -0,0 +1,258 @@
+	.file	"stats.c"
+	.section	.gnu.lto_.profile.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\311\235\325\233\013\001\353\332\260\343\002\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.c73b9cd5d301b05f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsConfig_Registry.12.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375 \232\215\004"
+	.string	"4\bj"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\206\200\200\374\342\203\237\277\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\355\006us\350\305\006uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\243\304"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/stats.c"
+	.string	"\004"
+	.string	"\237\n\013&q\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_statsConfig.14.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375 +Y\001"
+	.string	"\036"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\030\001\177\005\001\006(\001"
+	.string	"?\202\210\200 \177}\274\001{\274\001y\274\001w\273\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375 C\375\001"
+	.string	"T\003?"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\016"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\f\001gistry"
+	.string	""
+	.string	"\005\t\002\201\204\001\n\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"W\005en\323\t"
+	.text
+	.section	.gnu.lto_.refs.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c73b9cd5d301b05f,"e",@progbits
+	.string	"(\265/\375`7\b\305/"
+	.string	"\032W\354\022D`\246Q:#\\X\244\325(\252\262\215I\324/M\n"
+	.string	"\350H\023\032\245\215R\023=\333a3.\256\bb\334~\036\375,\306l\276\031\351)\336\353\207\375b\252`?:\013\332\206*L\217\243\336 #V\312\024\366"
+	.string	"\036\001#\001\327\351\334p\345\371\352\363\034\3549\r"
+	.ascii	"&x\240\\\351\263\371o"
+	.string	"P6s>\363\353\216\310\272\214f}^\203=#\331\354\327\345\024\321qS\243\317S\260\3472\377u/\332\216l\351\223\311X\031\017\236tl`\334\234\364y&\363\363\312_x\314\212{\215\367\336\002\3155\344\370\247O\016\303b\316c\030\314)\\xN\013\314%\273\367\362\030\013F\356\335\3421\273D\367n\355\230\0350;8\271 \221b\006=\277\300\236\311<t\211\233P&\233:{\371\271\013\2275\241]\307\365\"\357\275\273\226\202LK\353\363+\363P\313M\250\0227\241o\373\177\355\377\236\377z\376/\377\263\3757\3729\316\317\n~v\360s\203\237\027\374|\340\347\004?3\370\371\201\204\237\371g\003?;q\324\177\246\277G\374\034\341\347\247\237!\374o\373\177\376O\373\237k6\233\315\377\367g\265\0375\013M\354\234\351\363\204\3534)Sp\bZZF1\373\022\310\350L\023\316\253O\006det\225'"
+	.ascii	"`gE\206\364y\006\3643\0313]4\025\025\352\363K\346\241\3746u\376"
+	.ascii	"\203\244\006\207\351\245\317$0{\336\302<v^\303I\036\343\266\363"
+	.ascii	"\313\332#\005\222\307W\334\355\372\222\2404c)V\243O\266\325)"
+	.ascii	"i\221\022\213\2158\373\njL\207\225\310\017d]\230o(\\\3405V\262"
+	.ascii	"\036V\0367hA2\357\275K\346\303{\270\017'y\215\355\234\331p\233"
+	.ascii	"\237\353\275h\356\275\34729LgIwo\230\227)\367\256S\3475\256\303"
+	.ascii	"t\022\324\2707\214\310.\214\236\263\264\270{\327\250(\247\250"
+	.ascii	"\250\fk\030\032\200\223\3570\036N:q\236\035\343\201\221\203\317"
+	.ascii	"\354\213\333d'\364\234\305\236\305\354\371\207=oYF\3439\234\204"
+	.ascii	"\342\2643\034\216s\235q\275b\356]w:>\202\300\220}>\313\236\241"
+	.ascii	"\320]\263\331l2\024z\026\266\001\363\320S\311<\364\354\346\303"
+	.ascii	"\260{\341!,_\346\241Lh\370\214\325<Q\354\271\214\023\365V\231"
+	.ascii	"\03760\332p\264\016,v\214\255E\306\306\210\276zG{\261\362\310"
+	.ascii	"t\215gq\314{\357[F\1775W_.K\"\035\326G\272H\017i\2606\302\311"
+	.ascii	"\376\352\256\263!>d\214\323_=\243o\260\222I\007\262>\314{\327"
+	.ascii	"\035\334X\231 L''\272[\002\0304D\224\275\375}l!\234l\257;\255"
+	.ascii	"\367\"+\374S^\315\243\203\260\362\270^\036*\376\b\2013\020\245"
+	.ascii	"\024H\317r\b\032\004\310\022\232u\211\240>\373\307\3211HZ\214"
+	.ascii	"\034=8\331>\376\226to\002;H\013\233AwC\212\323\004I\356\206}"
+	.ascii	".\206}\307\345\260{\230`j\201\354\373\315\276\327l\323\350\032"
+	.ascii	"\234|j\033\357\030-\343F[\353]\333\211\"\2630j\366\374\204\346"
+	.ascii	"\232M~B\337h\226\211yh\263\261o4\366\357--#1s\340\324Z\253o\216"
+	.ascii	"\006\227\2215@\347\251\303\005\243OV\304\2138\251\200\233J\213"
+	.ascii	"\266,B\324\347[\214=+@\271\311\n\320\367j\033p\023\332P\203\270"
+	.ascii	"\320\216\313\032%g\b\221\bY\304\241\007&\254\237\232f\231\350"
+	.ascii	"\335j\002\220\330D%l\001B\375\245HB\026m\224\366\222\324\236"
+	.ascii	"\020H4\022\002\2119+\025(\374]\241j\017\303\324\317E0=\323\364"
+	.ascii	"W\254\252\362\035e\021\207T\247\332\313pTT\211\271+e\025\325"
+	.ascii	"4\b\374\225\030p*\365V\004>$\376\212R\352pX\224BR{\031Ta\020"
+	.ascii	"\255\372a\025}=a\020\253G \355)\245\252\0250x\305\242)\355\375"
+	.ascii	"\260\202\252\332\243PA\025\006[X\254\236\232\006\253zW>u\250"
+	.ascii	"\366\004|j\312C\003\024$BX\252\tR@\242\2240\350\303\222\242*"
+	.ascii	"\246R\023xU?!0x\345;\252\372\245-N\3410\250R\375\322\243\373"
+	.ascii	"T_U\261\007$NX*\372\254\250N`\220\205p\350!U}j\332\373\251\276"
+	.ascii	"+\"\326\357\204\372K\177%\200D\004Oz\211\006\034\203\336\234"
+	.ascii	"p\233\330\022+\177ZL\fm\311\320Y\225\037gJ\376V\322K\240\230"
+	.ascii	"\2561\217\2165\267\353(!\207\205\n\215+}\262-y-\315\250\215\271"
+	.ascii	"\235\3438\311n\235\304\351\313\252\205\224\250\254\357\330\232"
+	.ascii	",}\"Y\215G[k|\320\002\200\220\250q,\246\224Sf\204D$\020\221\231"
+	.ascii	"$\351`\002\021*\262\362\021\200\255c\244Fh\222T:\026\231\025"
+	.ascii	"v\236\214\315\224\324\345=\357\f\213\376\320V\036D\321\177\316"
+	.ascii	"\252@\002\220\300&N!+\224\320\033\235\277pO\343\212\324,\206"
+	.ascii	"\235c\217\355)\207b u\303\211\225\324\f\036\246\205\210\026\352"
+	.ascii	"/\321\236\322]b\317\370\230\016\377\272Q\322\202\221F\345@t\335"
+	.ascii	"\274\211d\267.\016*\271\345\323\355\230\301\276,N*\261\360\350"
+	.ascii	"3\245\313\354\0333\037>\335\333\207mb\363a@\212\361{\344\202"
+	.ascii	"f\331\r7\271QuiH\224,\030t\330\265\264\031\343\341_\261\364]"
+	.ascii	"^\315\363\312a\330\351\r\b\0307\363v,&$\316Sx2\341\315\b\267"
+	.ascii	"vPw\n(\327\326\221\227\225G\002\242\221G\300\266\333\347\242"
+	.ascii	".\244=8\335\0065\020\226XI\300\302\321d\252\350\207!+\3513\274"
+	.ascii	"\265w\376\261\237\3051\r\366\330ft\354H\351\344mL\235\216\021"
+	.ascii	"@\342\204\337_\230y\315\265\376\207\313\214sa\223\344\370\325"
+	.ascii	"`\026\005\242\020\311\024\337l)\374s\321V\005\202\330\307\\\017"
+	.ascii	"u\267\027\303\037"
+	.text
+	.section	.gnu.lto_.symtab.c73b9cd5d301b05f,"e",@progbits
+	.string	"pgResetTemplate_statsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"statsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"statsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"statsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c73b9cd5d301b05f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
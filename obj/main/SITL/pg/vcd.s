@@ -0,0 +1,194 @@
+	.file	"vcd.c"
+	.section	.gnu.lto_.profile.e667255f26c75168,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e667255f26c75168,"e",@progbits
+	.string	"(\265/\375  \345"
+	.string	""
+	.string	"\260\024"
+	.string	"\003"
+	.string	"\371\361\340\313\r\001\240\342\234\212\n\002\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.e667255f26c75168,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.e667255f26c75168,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e667255f26c75168,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.e667255f26c75168,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.e667255f26c75168,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.e667255f26c75168,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vcdProfile_Registry.12.e667255f26c75168,"e",@progbits
+	.string	"(\265/\375 \211\005\004"
+	.string	"$\007["
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\236\332\013yw\250\306\005yu"
+	.string	"\005\001\006'\001\003\005\001\006\035\001\001\202\0048sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/pg/vcd.c"
+	.string	"\004"
+	.string	"A\b\354\345\206g\222<"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e667255f26c75168,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\f"
+	.string	"\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\t\001\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\n\002\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.e667255f26c75168,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002\001\002\002"
+	.text
+	.section	.gnu.lto_.decls.e667255f26c75168,"e",@progbits
+	.string	"(\265/\375`-\006\355%"
+	.string	"*F(\017D\200\236QcKhc\342\302"
+	.string	"'\212\231\t\246\306sEn\005D\022 \345\3202\273f\272\177R\f\371|o\234\362|\233\350\202\207\021\213\334\364\006\221{\203PP\270@v\t\247:\255\222\310\345A\276u\023\231R\305"
+	.string	"\341"
+	.string	"\345"
+	.string	"B\325h\344\310U-\235\263\376\225c\261\205\214\216E\260D\251\245\035X\337\212m! \260\344Y\216Z\276\212]q \t\300\016.<t\324\322\257b?}\224\177\221\270\267\352\336["
+	.string	"E2MO-?\345T\374\257K1\204\t\256MI\271]\367\336\177I\330\272\227\370/\233\237{\211\266\237\301\317\240t\322\303H\026\2634\001\353\343\221\314\242\337\314w\345|(\366\237\334\353f\316\310J\357\225{\257mHl\214\031\224Z:=\222i\1773\211~3]\255\355=\266\323l\373\261\315\307v\036\333H\333}l'\221l\207\331F\263}f\333\310\256\267?\300\276"
+	.ascii	"\373\266]\263m\264]\223\311d\322\266\b\373&l \021\001\305\243"
+	.ascii	"\031\227^G\260sh/;\236Z\212\344^\037E\016\254\241\002fD\336\233"
+	.ascii	"*\031P*\272\303\346\250\303\304s\307HK\n\004O-o'(\013\207Q\205"
+	.ascii	"\220:/\336\314eD\367\"\260hL\276\240\231\316"
+	.string	"\020\231!=~X\177\313\3725\342\3306f;~e}+\353\023\355\331\274\315\213Iw\343\2539\231\201\210\351M+\2214,Sji)\353'\231\265d\362I\246Q{t$\263\"\231\206\262\356Y\373h\302\200\250\2349\023\013\273\261\326\002\306V\032\240\256A\003\203\252\226/s3/&\370\231\324V\364\247\311\237>\265\264\316\372\t\314'\237\300\364\b{\364\233\271\3407\323\017\343\022R\356\004_\260\265\201\226sy\027[\310\346\304\313\017\260Z\232\202\365\267t\030\222\006\254\226\345-\306|\026\037\314\016>\031\214j\305\304\313\314E\327\204zUUT+\243\251T\201V\rd\231{\357\214\032\243\312x\261^\325\027\256T\265\312O\357\265\307+\343\231-]\225X\327\037\3265\207\255+*\213\027q\265\305\311\250bh\325\322\025\313\246\270\311\343LW+\213;\222Y\273\036\3537\371\271|//\236\253^\\\224t\n"
+	.ascii	"\326\023\0316\220w\206\326\203\2410\262$\\\265L\246U\367^\\\020"
+	.ascii	"\361\215\0333b\254\357E\346h\274\346\214\021\223\003\347r\226"
+	.ascii	"\244\271\227\235K\363\260\2568\027\203<\235\243},\353\350VqA"
+	.ascii	"\232\221\331\271#\177\274\361cY\026\234\034\371\374\317\323\336"
+	.ascii	"\347z\276\347~^<\362s\374/\007S\365\261#\277\346o>\026\004C\027"
+	.ascii	"\034%\234\222\355\214\313\n\216\243\222\214\351 \240j\301\301"
+	.ascii	"\253\314\354\336\364\354y\036RA`\006\033J\344\247(;$\032\352"
+	.ascii	"\200'\317\027Ed\242\347\320\311\t\250{\262&Nt(\005\"\200\007"
+	.ascii	"\240~Z\352\005\r\f\236B&\024\b\0242\r\355~'4\240\347p\350"
+	.string	"\347T\321sx\n\201\206\272^\220\b\325\375zA\240_/X{B{\277\023\312Du\024r\366D\341\033\226\303\341)\344\361\232\202\244\202\300]\211\352*\240?\337\211 !\032\2549\227\313\260 D\207\rv\267\304\333E1\365\202L?_\223\t\246\235p\310\264t\343\235\277\236\017\252)\210w\016O\224?\240\017\335\235\303 \013u\275\340R\221\260\351iWJ\t\321\241\257w~\320\235P>'\240\320\003o\027u\273Q\261\252\361X\246\242\226v\265a\243b\271v/Q\314\313\267\312\350\320\022\263v%\372\305J\254XO\357\224\205\254\007FWD\366\344\251%\r\234\215\311\213\030E\276\330i\250\2010\306\fSFD\206F\202HaT\350P\002!c\354l\003\021\260\251r\306h\322Lk\333\310\364\356\240\327\336\220\242\005\375Q\215\300x\227'\322#\246.2\325\r\374\311\nd\021Q\251U\352\252\303\241w>"
+	.string	"uO\372\\\006P\212O|\022\202A\222\347HJ\003\343\216\251\255+\026\314\022\032\001\252NC\272\206/M$R\206f\307\031J\240\203\264\301\330\t\027>Q\013U\341\3265\261}\032\350\254\026`\306\241t\357{`F\201\301wL!\374"
+	.ascii	"\354c\305\210\002x\007\f\215\253\2279\242\275\220a[\377\n\177"
+	.ascii	"\306\2649\3218\220P\034\031\330\202\036 \317(\346\310\226?B\024"
+	.ascii	"^\322\211\330\303\027\216\216\002\277\232\224\316az\273\003/"
+	.ascii	"\374\215`\362@m\255\266\f\210b\310'\254\005\271\007,4\210A#-"
+	.ascii	"\231\325\321\267\236\266\325\217\253?"
+	.text
+	.section	.gnu.lto_.symtab.e667255f26c75168,"e",@progbits
+	.string	"vcdProfile_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"vcdProfile_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"vcdProfile_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e667255f26c75168,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
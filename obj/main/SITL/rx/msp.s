@@ -0,0 +1,321 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375 b\275\002"
+	.string	"\304\004V"
+	.string	"\006"
+	.string	"\332\205\333\362\001\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\237\275\226\271\002\004\002\003\352\263\360\321\b\004\376\314\317\334\f\b\002\003\002\003\002"
+	.string	"\002\001\002\002\002\005\277\257\241\307\t\b\002\004\002\005\002"
+	.string	"\002\005\002\006\002\005\002\007\002\005"
+	.string	"\003"
+	.ascii	"w\202\t\362\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375 6\025\001"
+	.string	"\230*"
+	.string	"\004"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\002\001\003\004\002\001\005\001"
+	.string	"\005"
+	.string	"@\025\034\024\r\227\0303\203\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375 \306\305\003"
+	.string	"\202\306\024\036\240'\351\317\371\244\300\263\370\027w-\276\273Q<\033\002\377\377\367A\341\377\023\261do\271S\377\367\256\n^\025\373\266\356l>\215\307%\013\242\020\372\007\216S,\2102\030\177u\213Dr@\275a`\024\316\305{\025\340S\357G5\263m53\323<\216\b\016"
+	.ascii	"7C\2030.AW\304\322p5\220\224\013\030\215\352$V\261^\005v\223"
+	.ascii	"\036\313e5[\203\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\002\001\001\f"
+	.string	"\002\n\177\002\b\002\001\001"
+	.string	""
+	.string	"\002\005\004\002\001\001\017\177\002\003\177\002\t\005\013\177\002\005"
+	.string	"\002"
+	.ascii	"\0035\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\004\231\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375 \274e\003"
+	.string	"\342\004\017\030\2405\351\017.\357\274\252:\352\377\377\377\337P\3646#t\315\332\266R\246\317\303SupH\277\217\307jv`\262\352\233\344\323\307\322\n\233\001\220\224\246Qv\232\362\242\374\211k\247\225\023"
+	.ascii	"H\t\300TN\213\035h\f\246D\227\223\255\262\377\312\202RV\251*"
+	.ascii	"\361\025\201T\001vs\201\272\252\205og\314f;`Y\030\264\001"
+	.text
+	.section	.gnu.lto_.lto.87c6d70590233c58,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspReadRawRC.20.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\205\t"
+	.string	"\346RC:0\305*\035\210\213'\361 \2344\2322t\266\224\032\336\330\265z*Ymq&lC\206\272nI9`N\301\216\021\350PD,<\216&\0016\036\\\f\022\334\325\356\275eJ\0012"
+	.string	"3"
+	.string	"."
+	.string	"\017\351\354\351\307q\241`\302\212\001\330\375f\346\032\313\245\276\300r\t7\356]=\377$\337\304PZ\256\3245\300aw\255-\027\306\ro{c\233\3016-\032\331\256E-\300\246\310\231\207\355\316\306\330\216jw\026\272\303&\236\331\225JFG\325\276\310G\272\177\024'\330}\255\234\354~\tF\270\\\372\273\330\366A\002\227\335m\360c/\221\360;.m:\351[\227\376\311r\031\241\300L\341\341Y4\225\326\354/\245P\303~\\\370\262\255\216\207\375\032\325\227\230\217#O\304'\2028\017\007\001\022\205\270\321\351\001\265\r\370\303)\231D\023\265\315Q\310#\232\237\31549\006&\225@\333\344H\244mb\276}\\\3702<P\301\225mW\\\346\005\f"
+	.ascii	"<\241\005(\306\013/J\020\224k\370p\026/\307\204\006s\005*\034"
+	.ascii	"\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_rxMspFrameReceive.21.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375`\250\002}\024"
+	.string	"\246\246\204H\320\356*\035Z!A:\0327\324\003\207\n1\231Af\343\230j\215g\321D7R\254M\256\222\374\207Uc\356\033MpT\236\357\306\233\255\313+\270\302\013\256e\207\234i\340E\337`t\301\303\037/\235\321\b\"\233\310\235Rq"
+	.string	"l"
+	.string	"l"
+	.string	"\273\267\237\240\335\035\211\007\214\237\336=D\374\034\017@\3744\314f!`\246a\364\322C\332]\224V\020\375\361pw\207\n{I\234c\250\022\346\363\356\241sy\211\303\366\3423\223\242\tg\346s\234\371\030\226f1\031\256B\002\205\320$\t(\364\236K\030\233L\20682\327\367<DGV\364c\223\271,!\330]\313\232m\302\235q\3339\266\017\330\222Czc\357\\\244\211\205$\240\365fw\\\367sl\234\3477\335w\213\357\3353\224\016/\255*-U\372\036\020^|\001\200vc\20206\305\024\322p\337\337\363\021\311\330\265i\261\341 \374\236\236\207\302\365Q\220\373\001ww\344\323\006\306Oy\262-w\377"
+	.ascii	";\217\207\234\261k\203\"hwIL`\374\024\t/\355\347\276\003\273"
+	.ascii	"\256\345\036\001\037\365\346SM;T\177r\344Sal\333\244S\257\343"
+	.ascii	"\235\210 \223\036\356\356\206.\360\251\035z\242\021\321jB\265"
+	.ascii	"\275r\240\027\210\321\356\232\370\">\202\345\343>\375\300%_s"
+	.ascii	"\211\237rE\315EL\006\355\207`y\2158\277E\017C\023S\016U=\255"
+	.ascii	"\203\274M\210W\251\247\345\310"
+	.string	"d\320S\2579\035^\221/FL\006U}D3\233\006\251\257\254^\254\004\016RV\253\023\006(\032)\252\223\326\202i\224\022\025\227\n\305\322B\255R'*\024J\313\205*\0011K%\245\205Za\261Z\250\323n\2577\243v/\2001\225\371O\211~\211\023\245|\234\033\250T\342\347y\227\270\035\244\243\230\f\226\364\306'\232\271\241\372\033M*~\334C\242\250\362\002\357'\212\272\241\247\231 \255F\366\022m\267.D\002C\316\303\321\324\033\0075 \220\002\23122\017\242\300\002\217\360\250\035\007\230U\245\255n\025\0016;\242\360D\265\032;\346\001\022\253%,q\342t\240\334\313\212\346-A\233=F\322\002\202X\016\231i\250q\323\306xi\b\264\204vk9,Q\252\006t\203\341\202v\022 \221P\205\0330\2406~:l\320\204\300\262\245\005\327\223\200y\341\306\204$\224\215V\233\341u\260\241\321\364\004x"
+	.ascii	"P6]\364\t"
+	.text
+	.section	.gnu.lto_rxMspFrameStatus.22.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\005\013"
+	.string	"F\325M? O\225\016\303\322@R\240&\003\340\207K\024\211,\304f\004"
+	.string	"'X\241\226\374\024\307\270\206\276\272YL\371^N2\370\242\234_ m\t\004\320*H\213\305\353"
+	.string	"\215T\n@\350\223M\244L)<"
+	.string	"8"
+	.string	";"
+	.string	"\366\016\302T\017b\240:\\\354\202\233r\270\367L\323\363I\317\032\260\302\324\267\272f\bZ'V\222\317\224M>6\254x\354i\341;eB*\273\353L}\027\356x\333\016l+\260\177 NM_S\026\312\243@\270\253\na,\212h\302\203\355\333\036\331\022\333\231\366C<ct\215\t\027\260\353RAb\027L`\003\221G\203\237h\217\221\017\320\036m{\001\203Q\231\2768\336\0217<@\260\310\022->4\250E\332U\002G\212S\276\260\277q\021\"\277\203?\240|\352\321\007i\217\327\307\236\030*\300Z\031\254R\2066HJ}\331\317vw\255\256\230\316\322E\300h2\335\346\003!\304\005\360\205\322\361h\266\020\267m2\026\315v\341<\033\205\2009\035\f\267u\034\016\267I\300\275\272\f1\251P#\364\367\264\307\016 \303\007\215\364=-\225\202\272RRS\016"
+	.string	"o\b8\252\343,\026\n\035vHe\b,\266\025\177@\020\211\020\265\206"
+	.ascii	"\271\214\276I\005#U94\227\332\003"
+	.text
+	.section	.gnu.lto_rxMspInit.23.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\005\013"
+	.string	"\266\323JC\020\251j:\307u\304J \004\232\004\357\212\024{\301>\013.b\256\263\330\316;\f\301"
+	.string	"\026\304\201(4\227\226\317\272dP\0364\222\260"
+	.string	",\006\b\245$\fQ1\0073\020Q\2102.!\267\261\021\331)\0052"
+	.string	"6"
+	.string	"<"
+	.string	"\3357\247\327p\337\2727p\337l\332\020\236\252\354Y\350\b\002\331\356zZ\312\315W\323\277\201cN\224\351\365b\261\273\256'*uk\267\275\261]a\177#vj\252\032\212}\313\356\256\265\225\375\364\257\027\256\301\203\007\007\273$3\t\013\333\030"
+	.string	"\260\375\214\355\232\226&H\274\332\037p\002\346\013\204|aw\325Z\260\233Nx\023\n>(\372:U`\007Dl\367\364\323\016\337\022\237B]\247\352%&'9\333\343\tHL"
+	.string	"\227\214\341#\316\026\375\300\250\333]\n\237\005\362\241\211\255\224\270o\230\023\227\200\b\247:\013_\331)5\276\020,A\242\f\322\250\360\0019@\342\005i\354\354\341\204\310\320#\215\036\b\354\204\236g$=\216\203\305\3207z\245(\216^&\335[V[\031\343\005;i\"v\307\023\361=\024"
+	.ascii	"2\241[/0.$@\020\250T#\030\2412\225p\251\200&\225\331\323k\237"
+	.ascii	"\331\245\006\273\342\032\305\n\343\201j\340\n\230\033\240\242"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375 y\315\002"
+	.string	"d\004u"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\024\177\022\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\022\023\200\204\001"
+	.string	""
+	.string	"\003\002\026\177\024\270\300\202\202\200\006\023\025\025\177\026\360\372\2508\200\002\027\177\027\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"]\035\301\275F(\006$6\312*\"\207*\003"
+	.text
+	.section	.gnu.lto_.refs.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	"\001\003\003"
+	.string	"\003\004\001\001\005"
+	.string	"\001\001\t"
+	.string	"\001\003\r"
+	.string	"\002\005\002"
+	.string	"\003"
+	.string	"\002\002\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.87c6d70590233c58,"e",@progbits
+	.string	"(\265/\375`\r\027\315h"
+	.ascii	"\212\253,&S@\216J\352\324\223\276\373\007*?\333?\244\036\373"
+	.ascii	"\240\n\t\252\007\334\335fv\223'd\361\354\344G\001`:C\256%\f\330"
+	.ascii	"i}\333\273`%B\3077\333\232qwb\307\260\340\230Q0\351\216\356p"
+	.ascii	"\254\232&\351\347}1\335\221\344\204\331W\372&{\247\224\002'\002"
+	.ascii	"J\002P\002S\310\330\341\200\235e\211\252k\267\343\272\251\233"
+	.ascii	"c\n\362\252\217q6\225*J\214%9^U\013^\300\240`:\0173\207\223\025"
+	.ascii	"%sW\204n\316\246,\306X\362\255}NN\347\f\023\312\253\016\306\341"
+	.ascii	"\\k\203\307\245\306&\031+\347\f\2223d\202\340\366\r\253\337\371"
+	.ascii	"\206\265\303\370\027\0073;Z}\3515\035.Q2'*\314\343\027V\347b"
+	.ascii	"\023\347\243\031\344\325\366$n\333\242\263\364\352\002\246\245"
+	.ascii	"}K\177\341\255\255\267\246W;\214\263uwM\032E\354\313\021\266"
+	.ascii	",>lMp\317U\t\0211)\274\252\345k\256\326\235\177\\n\nY~\265A\300"
+	.ascii	"=\024\305\342SF\226\350x\325\257<\022J\355\305\253\255\001v-"
+	.ascii	"G\353\026A\302\255\340\344\254A\365BvW\346Ug\301\313\\\013\310"
+	.ascii	"\253\264\233\371Y\327 \237\031\212s\244\361\225\366*\007\367"
+	.ascii	"YU\013p;\320\272\343@k\237\300\034>\340\020+l\330y\322h\332!"
+	.ascii	"\306\265J\271 \343\025\366E\243\204\254j\353U\377z\227\342`\355"
+	.ascii	"_\036\245E\220h\034d\306\312\371\351_j\316G\367\003t\334\017"
+	.ascii	"\340\215\231pt\262\252\r\204\273\335\313\273\036\f\333\031\246"
+	.ascii	"W\333\273\272\375\351Y\316\345\314\234\2219g\f<34\262.\257z\023"
+	.ascii	"w\342Z\035\374I;\024\337j\336\361\231\2379?w\036\210\031.'\257"
+	.ascii	"\362\270\317\372\006\340vh\3374\311$\372q{\2075\275\273\363\016"
+	.ascii	"\3533\335gM\300/\254\276\244\327\316\344\302\252\234z\346\035"
+	.ascii	"\235%\022\255\256W{T\350v%\216\325!M\312`\346\255\234\237=\030"
+	.ascii	"9\305\013\353\325~\272\317\212\375\302\272\243\333u\274\252\333"
+	.ascii	"s|\374\346\330<\335\251\004\275v\247\035\024\350\356\016\032"
+	.ascii	"\247;%\241\001w\247\030\272\275\331\3555\272}F\267Gu{S\2673u"
+	.ascii	"w\230\356.\323\355\030\272[Jwou7W\267\037\273]Cw\263\350\356"
+	.ascii	"\270n\037\240\3333t\273Xw\207u7Xwwu7Vw\377t\367Yw\363\356\356"
+	.ascii	"\356\356\272}D\267:\327\335C\026XYh&\b\261\203\253\373\2627\323"
+	.ascii	"A\362dd\225\223\323\311\031\234\225\031\267%m_]$\264\252\370"
+	.ascii	"(\301\345\316\274\217\356\236\224\217\342\365\244\254W\367bO"
+	.ascii	"e\007\023g\316\271\007\306\345\354m}\371\026\324\254\252\273"
+	.ascii	"\307%\245\327\365Q\242\fib\345\307\363\212\223G\217;7,78\035"
+	.ascii	"\315\030N\034.\247c\344\311Jk2\234\177\004\311\2333\314\201$"
+	.ascii	"[pcu\257\304\271<Z\302\003X^\202\270\234N\2323\0162\316\317Q"
+	.ascii	"\367L\227\363\350T6\306\215 B\244\007\016\0175Z\262\264)\271"
+	.ascii	"\340k\264\314\335\330z"
+	.string	"\265\361\022\334\270\n\247&\246p?\0259\017r\336\242\271\272s\222{\365W\350\365O)@\312\230\330\2534\030\n7\316\270i\336p\323\254\341\246i\202\337K\245\201\306C\310\253M\223\0047\215\016\3344O\270\3279\334\253\026\334\353\031\356\025\f\367\312\205{}\342^\215\340^}\340^\237p\363\304\340\346e\301\315\363\302\315c\202\233w\205\233W\205\233\327\204\177\212<\n\256\365\363)\270\232\222\023\325\253\315[\302\"\344;\377Y[\265\303\255\266a\240/\034b\b6\241J\341N\357po\251\341N\271p\227\r\301\035\325\201\273m\211\033.=\342\036\363r\270\373oP\345\314\331\r\251\362D.)\305)\331p\272\026'\304Y\325 \243r\301\201\335=\t\375S7L\240T\201y\365\245\222=\254\236i\270\375\314/\375\316\271\322g\030~\241\225\003.\315\273\37483>\362\006\334\024*.\366\202-\310\030\231Gy"
+	.string	"\351\376\246\217z\250\237\361O\357\3644^\306\217\360J\327\372\245\253\365\303\370\030\375\363\354\375\362]|2\315R\342.-*/\336\202G\247x2R\313\312\331@\267\273\271\0307\343\344\242\004\237\322\277|\246\376bbIY\263\304f\002\\\316\317v\254\356\336/?\273\\\372tf\245\265\025:h}\221E\215\311\371\351\341\307\203\252\226\225\200\b\240\366\033\301j~\372\205u\351_\350"
+	.ascii	"q\2761\177,\345x\245\2357\034=\314\240\360\037[m\302\314I\217"
+	.ascii	"4\320\336\210\333\351p\273\026\334a\356\263\222\3612vjT\006\224"
+	.ascii	"W8R\034?\206\303l\243k\353\"%\225\326\300.\305hc\247f\343\005"
+	.ascii	"\t\235\326\350\267\177\363\332\202\344\325t\312\305\326d\022"
+	.ascii	"3Ozl\206\230\022\2642\334\376\345\351\f\255t\206\177\3713?\321"
+	.ascii	"\300\020{.\3205\\OOi\024\266yJS\002u\247P\235F\311\255\325\210"
+	.ascii	"\263\221.5(\231Qf\251\324I[\033\363\366WPV\244\2164i\245M\336"
+	.ascii	"E\3013\033m\254\262\224\312\005\272f\b\356\024\231\272\350t\251"
+	.ascii	"\323\245\224\211\202g~Z\271\342~\320\215\311SS@7T\252\230]Ic"
+	.ascii	"t\312\364bePH\362j\372\"\205\201\223\025\303\356\fF\262\006\205"
+	.ascii	"\036e\316\227\322\311r&\006Y\r\023\356\376\3565\037\2259g(\336"
+	.ascii	"3+\225p\332y\356@\3359\236:\002\335\255\346\264\273=H\220\363"
+	.ascii	"\021\254\215\016_\201\035m4\207\334\035\315\031\3314>\320\\\""
+	.ascii	"\233RIh3\033\221B\214=\312\3344&\2419\367d$\322\230\202\231{"
+	.ascii	"\222\320\274\314.\324\226\236\237McF2sOF\346#\207$\262\271LB"
+	.ascii	"\217\313\236$\264\271\314\320f\346\311\310\243\022\0062+{2\264"
+	.ascii	"\031\227\241\314%O\022\312\\&\241M+7\203\341\203\f\352\253\215"
+	.ascii	"\007\225\247%\221\331\251\211\352\250\344\211&\237\314\334\226"
+	.ascii	"\263o-e%\0029S1\225mG)\017S\212:)E92=C\223R\0253#\243\311\"\314"
+	.ascii	"\234\213(\025\345\246\021\306g4[y\324\270\203*\313X\312y\200"
+	.ascii	"\246\234\215\236\2439gc\316\231FI\365\314\271\006O\322\331\324"
+	.ascii	"\224\363\324OS\2462\212-\345\374[]\302\226Ih\025\263'\366\004"
+	.ascii	"\352\314/\236Fw\346\266\246\022C\215YYF\316\331\347\260s\031"
+	.ascii	"%\227*\245G!^TP\276\232\032u\312\302\260\234\341\366\255$_\334"
+	.ascii	"T"
+	.string	"\340\342tc\202\205\310\tc\234c@\312\fq\326\345\200\342r`N\272\217\376\331\247\375\230_\373\267\227\3732o\345\303<\2317\363b\036K\232\037\355\325\376\356\343\376\314g\371\026\236\355\347\276\355\301\274\227\267{.\277\345\265\374\227\207\373.\177\345\335\\\353\353~\254\237\354Yh\365\253v\320@\251\2021v\365F\216\200\201\363oPXA\r\213\024d\201lP\017+\034\246\320\341!\272G\270\003@\021Dt1Hju\032\030lY!K\204{D\t\006J\230H\242i\023'B\234\b\261\266\211\023\275\336\211\022=\334%z\351KD|}\"\032\370\300\375\035\371\\\242{4\200\353#\n\016\t\207(\222Z\033\342\357\b\330\362\210BlO\022kD,\246\0302\372\025\331\260B\301\266e\221\206>a\220\303\353\243!\372\261\030\006}DE#\342O\317\313\272l+$\f\266\360\275?\327wTl\337\017X\242K"
+	.ascii	"\016k\364\003\332\274-\213$\f\002[\241"
+	.string	"\340\021O\030<\302\037"
+	.string	"\331\"`\322\357\b\357\270(\214~H\302a\360\375\031\r\211-\373\n+"
+	.string	"\266\030\\\226m\211\330\024\254\021\221\020\202\243\037\n$\342\020"
+	.string	"BF\303\"\026\354\013\204\200\025\032b\320\006\177?\302 \220u\213\276\244\366\306\227T\374\371\222~G;n;l[\326g}Ywhhx\323\223ahh\370\026\201\005\270\301\244\237\217\250\330\202\025z\213Da\020\003K\f\341\365\261H\301\367\207\024lY!\r\355\360\005\376\206|\303\267\370\363\021\t\203E\357px\344\372\200\355\217\3200\330\262D\337\020\321\310\347\003\266\256/\350\272m\006\241\240\357\r\n\2139\"\214\222Zw\347u\177C>\241\342\257\205\317-\266puZ\241\353Kj}\254[\364\r\271-p\347\355\242\017I\355\220\310\266 \336\341\260\005q3T\363\372lXb\b,8\b\322"
+	.string	"\247e\205\202H\303vERk\364\013\266\254\313\363\n\213C\0248\354\373\013*r\331v\210\rJjs"
+	.string	"\020\252"
+	.string	"\341\027$\364c\203\200\355M\373\2560A#T\341\026\333w\305\005\327\307\276\277W\003a1(\251\345\021\252p]\0268lW"
+	.string	"[\236\227\235"
+	.ascii	"\330\002\360\372^,T\341n\300\036\005Y\260G\277V\005\260\335\371"
+	.ascii	"\275\277\024F\254P\370+\002\336\030\r\207\021\370x\257\257D\357"
+	.ascii	"\025\006\213\270{=\024\0346\310`\002\f\374@t\217@$\265 \204\301"
+	.ascii	"\337\021\b`\353\202\370p\201GT\212\006\346\214\310\016\246\254"
+	.ascii	"+\250\332\253TTi\0237\240\343\007\335\221\034\243\013'.\035\235"
+	.ascii	"6q\262Np"
+	.string	"\273z5\275\2212kz\230\021\263L\231i\016#F\322\326R\343O\223\201\334\250\2214\247\0244#\"#\"\222$I:a\005\304(\350$\243n\022@d5\2301\251\244d$)\250S\330c7\205v\301\r\341\232\002\003\b\206\377\342\336\204\233\255\333G\337\272\033s\237\346\372u\225\b\256\221ZA\253\307@d\226A\323(\013\236\3100LK\252h\3445\035-l\222\007\034\262\274C\375Z\306\321P\306\352F\n\236\235\257y\242\251\315\022\003&z\346\315\0328y_\226\326\272\\\037V\031\334\227Nb\276\200\003\332\023+\241\023:_\177c\355D\200\206T^\250\204,\272\353\311\217\355W\204\023\267\261\265\3775\334\353nBB\230\237<\027\357\2521\005\027\243\235\245\364\220\n\020jS\227\313\006\276\362\236J=:\274\374\211G\241\254\204~<\001\027\033B\333?\236L\371\023\276\304*68\314ng\032\240b}"
+	.ascii	"\352\023M&\224\214\002\006\263\343\037QMr\360\0340O\306\301\013"
+	.ascii	".8x^%\246\371\004\373;{\226k\226\304\254\207\231D[\321\270\272"
+	.ascii	"%@\2369\027\023]\025\262\354G\250\201-.L\313\256\302>\242"
+	.string	"\360k>\306\201\361D5\023\326\247A\r\177~{\030\367\177:\177vN$\221\375\332\250\365qv\342L\004\277\373\373\277\232\202Q\322\305\232\310\363\237cV\245\266W\236x\232\255\314\274\257\224<\375\253\333:X?&\2078\301\036u\345\240E\231\216\2244\224\3677\303'VA\036#\311l\314\324x\344\374\304\2774\326AF7\230\334\f\275\272\317V\254~es\245\365\300\017\037\360f\225R9\311g\007I\226\302%\264\202z\022\001\030\021\002\300 E\332b\212\221\267\262,\331\312\206}\022\003\266(\f\016((\350?\236c\251\212\006\305D\333\263\223\373\326\b\200ex\341\025\001\267\271\315R~\301\324H\220ePEv\262:\251\243\r\252Z\351\364\204\316B\202\310\300\207\r\003e\033;\214N\240\217\323\005\204\206\343\222n\350\356\210\270\261pa\227+\025\227.T\313W!#\273<\302u\303\263t\301S\314=J"
+	.string	"\334{\325]V\333\373\020\340q\251\203cS\322\340s\243|\274'3f\362&E\\\236 \307\004\033:B\3752W\372\322^\n2P\231\032\241\205\230\257\363:\353k\276\365iXl\203\224N\357x\233\341j>\362,\343pT\220\232\002\231)\240\032\004\2322\225\236\351\002\bF\205G~\220k.\226^\260ao\255\360O\352\235B!\021LZ\222\224zc(;*\034de\351a\330\211\235_L\b\332\376=\327&\005\232\276\317' 7\"\231\313#\3275\221\375\r@)\256\3634\330\315x\270\022\234Gh\310Q\004\345\302;e\032\224\245aZ\340!\210Z\3308\262"
+	.ascii	"o`\n\341w\204\312>\225Zo\360\020\362\031\006\206\243S(\227:\236"
+	.ascii	"\274U\323\230CN!\034\242\321\\\320:\244v\220\252\241\341\241"
+	.ascii	"\344\027\356M\203Ad\271\210\235\206\252\231\2114\231l\275DN\217"
+	.ascii	"A\224\311\307\214G\244\007\226I/\227\352\246D\274\271\355\215"
+	.ascii	"(\203*\212\363\232\032e\351$:\243\0372\372q\233*\344\317\220"
+	.ascii	"#%\033\037\326R\bXt\355\356\223\270d\356I7\013w\331\206\224<"
+	.ascii	".>O6\343w\360K\201\213|89\025^t\343U\361eo\225\005\005v\345\253"
+	.ascii	"\347\036\354X\270\032\316\263\240KU]\362\374\007"
+	.text
+	.section	.gnu.lto_.symtab.87c6d70590233c58,"e",@progbits
+	.string	"rxMspReadRawRC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.87c6d70590233c58,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
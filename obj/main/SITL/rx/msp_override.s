@@ -0,0 +1,275 @@
+	.file	"msp_override.c"
+	.section	.gnu.lto_.profile.959c77e4385ff9ac,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.959c77e4385ff9ac,"e",@progbits
+	.string	"(\265/\375 \035\315"
+	.string	""
+	.string	"\230\021"
+	.string	"\001"
+	.string	"\210\366\241\371\017\004\002"
+	.string	"\002\001\002\002\002\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.959c77e4385ff9ac,"e",@progbits
+	.string	"(\265/\375 @m\001"
+	.string	"\3604"
+	.string	"\001"
+	.string	"\003\001\002\004\002"
+	.string	"\020\b\001\020\b\006"
+	.string	""
+	.string	""
+	.string	"\004\003\001"
+	.string	"\002\001\200"
+	.string	""
+	.string	"\002"
+	.string	"\005"
+	.ascii	".6d\036I1\314\247\r\033h\003"
+	.text
+	.section	.gnu.lto_.inline.959c77e4385ff9ac,"e",@progbits
+	.string	"(\265/\375 \202\365\002"
+	.string	"b\305\022\036\240'\351\017b\342>\337\213.\204\220\200\256\337\333\001\003U\325\033\375h9\267\326\310&r\2477\307j\255\026\177\346\026\224\f\340\367\315\207mks\006\270h\213\274\200\bE\342\240\244?\321\270\025}\264\271\r\220\201\321(8o\023\002\006"
+	.ascii	"/[\301\340.\304\310y\t\277\024\270\001,"
+	.text
+	.section	.gnu.lto_.jmpfuncs.959c77e4385ff9ac,"e",@progbits
+	.string	"(\265/\375 n=\002"
+	.string	"T\003b"
+	.string	"\001"
+	.string	"\003\001\001\001?\002\002\001"
+	.string	"\002\003\177\002\005\002\002\006s\001("
+	.string	"\001\300\004\001(\300\004\001"
+	.string	""
+	.string	"\004\004\177"
+	.string	""
+	.string	""
+	.string	"\300\004\002\001\377\001\001"
+	.string	":\200\001"
+	.string	"\006"
+	.string	"`EPw`\022x\t\342\231\367m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.959c77e4385ff9ac,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.959c77e4385ff9ac,"e",@progbits
+	.string	"(\265/\375 <\275\001"
+	.string	"\344\0020"
+	.string	"\001"
+	.string	"\003"
+	.string	"\374\005\002\002\007"
+	.string	"\001\002\004"
+	.string	"\001"
+	.string	"\001"
+	.string	"\200\001\300"
+	.string	"\300"
+	.string	"\002\b"
+	.string	"\001\002\t"
+	.string	"\001\001\001"
+	.string	"\240\003  "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"2C\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.959c77e4385ff9ac,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspOverrideReadRawRc.25.959c77e4385ff9ac,"e",@progbits
+	.string	"(\265/\375`>\002\265\023"
+	.string	"6&\207I\300\224Q:j\302\344v\361\031\323\005\202O\t\374gF#\022"
+	.string	"\331H\345\321\343\361F\177\356\003W\240\376\227\375\365Y\255\224G\355\261?\243V\213\36382"
+	.string	"\305C\335k\b\334\210t\237\326Cs\354\257\3033\221O6\221;\245o"
+	.string	"m"
+	.string	"r"
+	.ascii	"\253\232\033\362y0\247}\240\007\325^\336<@\255>$K\265\226,^\021"
+	.ascii	"O]\212\266}\237\377\324l\233e\317\t\006A\273\242#\265\226\343"
+	.ascii	"\352)\341\351\374\200\360tg\334v\n\356\264\371\267S\252S\342"
+	.ascii	"\365T\034T\251\265\246z\272\271`JS\214!(\275\034\230`\307G\212"
+	.ascii	"\377>sz\2709Q.\265VO^\017\305\035\3366\214\355\r\366\264\t\267"
+	.ascii	"\271<\366\301\272>\373B\377\352F\267\352H\367\311\211\376\324"
+	.ascii	"\313\337\304\323\2428\215BM\207\250i\212\232\006\351\364\322"
+	.ascii	"\351\031N_@\314\356\210\300Q\255:ON\225\211\362\260q\243\037"
+	.ascii	"\351\323\256\371G\3779\205dS\241\265\276\370\335\300p#\033X{"
+	.ascii	"\\~\222\212\324Z*8\265\004\221N{A\203\332\211J|Uq@~DX!\033\003"
+	.ascii	"\0013\211\013L\004\267\020\332\027`\346y\250%]0\345\366f\272"
+	.ascii	"\340\206\013\026\355Z\340b\276\224AI\203\214MxJ\227\205\006\320"
+	.ascii	".8w\345\273\243\f\\\020#'\334|\262\312-r\236\247\332+a\301\004"
+	.ascii	"`\3165Y\177OVE\2677\247v\356wK\354\272\016\021b\2559\007~R\210"
+	.ascii	"\227Xk}\215S\377&<\375\376\367\024!\337N\016 \234\371d\227\001"
+	.ascii	"\344\214\354\305z\231\221\275X/(0\026\210\026\370\301\345\001"
+	.ascii	"\026\203P3\023I\032\213\366B\276\\4\330\210\n53\024\267Z\310"
+	.ascii	"\016\256\331\214$\021\223\221\321\274\306\232\331\bs\261^ckF"
+	.ascii	"3\266\034pLF\316FZ,6\033Se=X\327\347\324\n\360d\377\373\004\023"
+	.ascii	"KV\265\342\346\330\026\327.8\213\243\313\343\036:\035\034\340"
+	.ascii	"\372|\na\270\223\310\347\016#M06\026\242\226\303\220\220\\& "
+	.ascii	"\240\"\"\254\035\340\240\b;\235\004\361\314H\310\022m\0264\256"
+	.ascii	"X\340\256Z\231k\200\361\265Rd\344q\377\036\333\216\005\310R\232"
+	.ascii	"t\214v\370[\374\211\226_\"\276\024xs\310\023c\303B+8\273\300"
+	.ascii	"\221\341R\370a\202\"\177\002N\032$\256\003\257\361.!+\240P"
+	.text
+	.section	.gnu.lto_.symbol_nodes.959c77e4385ff9ac,"e",@progbits
+	.string	"(\265/\375 s\205\002"
+	.string	"\264\003o"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\031\177\n\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\001\033\177\013\377\037"
+	.string	""
+	.string	"\200\200\200\032\177\f\003"
+	.string	"\002\204\001\003"
+	.string	"\001\244\006\004\200\004\001u"
+	.string	"\007"
+	.string	"]\205\341\032\032\n\303"
+	.ascii	"u\370\024\375y\2312@\006"
+	.text
+	.section	.gnu.lto_.refs.959c77e4385ff9ac,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.959c77e4385ff9ac,"e",@progbits
+	.string	"(\265/\375`H\025\245b"
+	.string	"j\243|$SP\314J\352\214\205\343P?\371\365S\323#\024T{\213\362\3376l\231\243(\347\327\016\311P\021~u\375Q5ZC\364#\024V\262\267Gbc\325o\246m~Ma.\222\334\224\331PO\001\030\230\253\016\021\"k\202\277\341\224\2434\224zKl\273wJ)\017\002,\002>\002\371\355"
+	.string	"\324\001=\313F \002\240\375/F\363\353\027\3226>\307\003d\351\246$\322\246\207\313\365\270\335\340\201\305\006v5\215n)w\316\342\f-\357\204\333\331\340\3667\334b\216!\3652ah\363\251k.\013n\027\303p\036\367\246\243\325\224\233[\002\367f\241\314\211\f\351\326\376\266\305\323F\331\365h\233\3616\017\303R\364\321\326\\<a\232U\242\202`\037\277\220z\0300\026\342J\260\272\022\001\253\201\341\221\202\"&\354\254\035L\247a//7\250G=\355\035\315\277\264\247\271\027\235\243\247\2419\027\335\021\340qG@G\026\244\330$E\333c\3406sF\031k\303*\342norq\252#Y8\036\365-Y\3768u\306\364h\003qw\233\361,\327\222\005e\2532\267\346Q\267\342e\236\025\344W\332\261\270Y\343\034\337\314\324)\316"
+	.ascii	"\353\362\350\006\307\220\242E\270=(\355\361\240\2641\300\033"
+	.ascii	"\250\200\2454\\\310Ay\264%\300 \306\304P'pas\217\212\205\351"
+	.ascii	"\204\231\241\305\360j\017\353\016!\302\301tr6 '\r\231\027W\217"
+	.ascii	"\272\023\177\342Y\034\034J{\024\377j]\361\315\357\003a\343\244"
+	.ascii	"\311\243>\216!}\023\270\235Cz\316\3159\207\324\233x\027Z\025"
+	.ascii	"\305i\311\273\272=\211+q\025N\344\2232{\345\374\376`H\203\202"
+	.ascii	"{\323$CV@\341\321,\347r\346\233\201|\314\224*\371\321\006\201"
+	.ascii	"\333\214ou7\216.\307\031\266\260G\235\211\277\236\245\301\265"
+	.ascii	":\204\210>\211[YI\316o\317N\233\024\332\310=\332A\270]C\352s"
+	.ascii	"\256!m_\322=gYD?\356\3271\244\330/\244\335^A\267?\311\350\366"
+	.ascii	"#\251\030\335\r\326\355\272F\353n\016\335\035\326\335+\372\253"
+	.ascii	"\273\201\272\317\013\335>\325\355P\335\336\324\355\037t\273R"
+	.ascii	"\267\367t\273\007\335\255\325\355\303"
+	.string	"n\347\240\333\177\272\335\247\273\305\272{\247\273\315\272\373\347\346\346\346\272\273G\267nC\267O0Z\036\355\273\374\333o\371,o\366g\237\366\\~\3127=\353\335\376I?\224\217\322\350S\211p\323\225\243\211\254\307_a\275\301\271\022\024\264X\345P\003\347\366_\037\306s\364\311\307\034QK7\3032\203\273\301f\215\210Z\223'\"\220\\\251\032\301\267\332|U\367n\353\265\240$)\333\271\275\n\357D\007\223e\316y\307t\262\334-\001\363\257\024\260Pu\357\262\276vL^+\212\216#YH0\262eY\303\306\334\332\2205\270\0314\234\2261|\213\207\350\223\215^\236\226\037D\210\333\222\253\001$^pdn\277t0o\366p@\t\033\016\337\3429s\276!\267|\031n\037\202oy\223*\023\343\030\0302\204\207X\007\234/hjI&x0\234/dF\360z\264q\027n|\205O\0228p\277\223-\r\362"
+	.string	"7D\346\242\306<\372]\273~\257\013i\222\352\315^\007|\221\215=z\203m\340\306M\270oV\300}\303\206\373\006\n\376\027\235\241e\207\220G\373\246\t\356\233\037\270o\326\340N\337p\247h\270\3232\334\251\024\334\251\023\334\351\213;]\342N\251p\247\031\267\256\r\267\216\nn\235\027n\235\022\334\272+\334\272\031\030\310\307\377\360,\240\007\222{\374\314\030U\365h\353``\020\362\234\003\245\2553\342F\343p\220\025\f\002\013\223@\225\270Q$n\2575\334\247\024\334eX\270\233?p\253\325\300\rw\276\300\215\346\345p\367O\005\355\244\371b\304z\251\376\344\016\0315&\\y\364a\274\307%c\234Q\fn?\363M\276\202\203\235\257\030f\342\"\001\256\213\213\371a\226\306\327\214"
+	.string	"'e\212SaJ\273\"\363*\336\214\332\001\304\305\277x\247\207z\246_\372\250?\376\323#=\353\233\234\331O\374b\003\2759\037s\316\273or6\237O\255$~\302U\305\346c\274I\345\223\217\\>\226\013t\373\232\223q3Q.z\270\224\376\2467v\033\211\245$\316RZ\020\270\234\337v%\335\273or4\276u\276\313l\364\"\205\003\227\225\031F\320\344\006\204"
+	.ascii	"\025\207\344\314\325)\343\234\322\"\302<{\024\006\214s\312\267"
+	.ascii	"\244N\300\352\301\362\205k\210T\237S\r6\266\306\b\222G\317\344"
+	.ascii	"\311\244\243\345\244\306\214\r\356\027/N(\337\3120\002\230\242"
+	.ascii	"e\302\f49S\005\361x\341\341\364\342\251O\250\264\036\243\221"
+	.ascii	"\253\257_\263\203\325\226&\302\030\356o\363s}\346\316g\023~3"
+	.ascii	"\214\264+\016H\0254\231\212*\310\3250\021"
+	.string	"\022w\"\373l\002K\223ti\322\361\350\351\342d\312)\202\206c\013\323\022\216\021\036e\313\207\301\203\326\306\251\312\243'\361<\356\304\260\372\242\345<\236\306#G\272x9\003\264E\344\306Y\374':J\2652j\2176N\025\356\376\3564\027\2239\347)\335\233\223F\235v\235{P\367\216\237\236@w\243\371\354\356\300\342\315E*le0\221\260\242\215\336\220[\327\314\371hEt\300J\352hE\003\311\264\312\304\243\020\342O2[\021\221\314\234\177\362\361H<\241\314?Hf\226\312.\316\244<\277V\304|T\346\237|\314\305\r\310\243\225\024\222Y\224\372A2\255\2442\323*\373\344c1\331t\314\311\237\314\264\212\313L\245\224\017\222\251\224B2\255|\270\\\323\017\252\2510\266\0357<\016y\314QPU\305\244O\023\371*\263Z\316\356\265\224\223\t\344\\\245L\252\025i\270\230\261\031e\214RT\372\233s\316"
+	.string	"e\314\241\314\307&\262\2102\347\"\306\243\f\305"
+	.string	"\361mf\037\336$\352\250\312OK9\023"
+	.string	"\2253\321s3\347L\3149\337$\253\336\234k\370 \227PP9S\001A\345*\342\330R\316\357%FL\n\311\314\241\334\215\251\300\\f\246\227\350\313\254f\225\304L\242V~\3129;\031\274\224\2121\346\337"
+	.string	"\250\216D=\372r8\312\032M\212o\257\346M\223\244y\362B\263B\216\020\266%\311G\317\360\224\211qA\303\355_&\264\255\235\020f\271V\204\013\217\022\320,\311\224kt\354H#C\211o\205-\303<\331\213}\225o\373\262\367\362`>\356\307^\314\303\375\230g{*o\346\245\274\225/\363_\236\314_\371\265\307\362j\037}\344!"
+	.string	"!\236>\362\320\256D\300$\265\307~\350\025e\200"
+	.string	"\203\024+\204L\250\020\234\260\200\002UhH\275 \305Ok\350\rY\020l)\030\262\002t\317\307\256\277\325\b7\003#\024\030Abx\323$J\200(\001\"m\022%v\273\022#v\270G\354\316U%J1\004\266\270q\215\202\256\032b\201\rZ^\222\332\022\320\252F\276\242\037Ph\310Z\b\362\222z\254.H\264\376\fW\244\240\360D\021\022\357\310\302\317\267\301Uo\214x+\200>\325H\210\024\004\372q\327ve\211~\276\026\252\313k\325$!\353n\260\006\333\002tV$^\317\202\313\256J?_\217%\362%\351~\276$\274Ao=\352\ryI\270\247\025B\342)\375\200>\227\207\004\f\262\253\373K\321c\007h\327\2255ZO\254HF?\023I<!\245`\021"
+	.ascii	"DH\300\243\025"
+	.ascii	"\253\333"
+	.string	"3\261\022\001)`}<\240\237\257\267\266Bu\310\346\250C!O\035\362\222zZ\026\310\262+\206\324]\333\242\"`\316O\206\242\"\240+\354\035\320\372\206<\325H\330b%r\205\301\237o\2005\330\201\253\256J>\227\247\344cW\"\003X\240\333\343\025\251@W\310S\215~\276#\027\bLj\325\036\013D\004\364\261kP-\n\"\251j\217mU_\333\262\031\210|\252\353\373\twB \r\331\266\307myE*\221\220\327Bm\205-Z\036\366\327\252CV][\241Z\324\262\275\036\267\217<\f\331\013\r\f\256\354\007\027\bd?\344\024\341\270\252\2055\330\301\212\f\206.\320aW\"\237\022\220U1d\221x>vm}\334\237\020(\244\263\272\274\241\243ve\213\326\241!\273\303\001o\210\210\267\016\365\330\034\326U\001\300\017E+d]\025\027\220\200\300\007T\335\017E\333\256= \253\242\307\372\270k\004=\026"
+	.string	"WmY\340\037\212\226\305\232\344[\261&\361X\024=\266\207\347\362N \255\277\037\357\250\227\343\252#v\270UW\227\347^\260&\371\334\237ph\310\372\270*\t\367\347\023\336\364n'\264\201E\005\021\340\236\207\225\310\307\262\253\022P\r\266I\037\206\354\207\237\217\227\364\241\307\266\037<\004\201\251\250\2214\310\2203$\"\"\"\232$\311pq\005\304(\007!+\036\022"
+	.string	"d5\3301\311\244\204$)\324\031\366\317\330s\035@F9M%\214\226l\231\b\2357\331:\272d\264\311q\366\223\256\004\274\215x\266\201\017\250\0308\3022`\252\n\340\241\315\264\235\271\232&\265$\335\232\261\026\201\310\323\034\262\017\303\274u\301\321:\301fG6\221\365\006n\234\261\216\317\340?}\374\314d\007w\004X\266\3502y\330\177\322(:\211\371\003n\350pMJ\bt\323^e7\241\001`\245\362\370'p\233\f\317\260\277\347\320\315\225\311x\312\332\031\214y\233\316\241\224\332\340\213\342\027\267\016\003\002zf\276\317\312Z\bEPjN\350\023\024\n\377"
+	.string	"\317\211\354\0030\224\251\202\023\013\247\261\"7\263#\020\334\324\020\030\331\335\\\374 \341L\367e\r\351\305\262\361\377Z\335#\236\206\013\251m#\026F"
+	.string	"\t\355\215\214\273_m"
+	.string	"\246\1773-\3001\270\325`/\217\341\250\333U\335?M\3158"
+	.string	"\234K\343\032\344\306\377\t\270\272\323)\251\350\203f+"
+	.string	"\210\2231\232\315\213\201\253AB'\211b\345\215\223>\247\250\2268\325\300p9k)\257\370Wa\361\3000&1\262O\245X\223\206${\260X\206\242\221\332\241`\234"
+	.string	"9j\277<\363\312\206\320&\001\244x\244\020\240\f>\331+Y\257$\313+\263\340%\315i\032iH\302\013\n\200\261\tfu\317YD\322u\320)\275"
+	.string	"?\271\016\352n\212e\211\317>\222\323\246L\b\001\365\360\241\006\021\035\3403\205\220\021y\273\347\211\266a\242\220~*"
+	.string	"\3059r\202V\273\320\310\020T\226\331(\342\362\366\216@\316\003\\\334\313\t\233As1\226\364\006&\345\203Vb\252\307B\340\251.\323\250V\211%'"
+	.string	"\326K&?\363\033\265\276\333\f0\324"
+	.string	"JS\026*\365\212[\024E\317\300F-\200}\301C\250\341\016\016R\257j\236\255P\2433/\346\250\326\025Ac\211\254\267S\301\235\223\333I"
+	.string	"\250iAz-\331\224\t\0332\r\375s&\350\240r\026\346I>Y\210\f\"\363\242Y\377GW-KS\367\220z\002\202\227\241u\307\345B-\233\001hD\242\234\361\342\265\021\233\341\377\334#\222\344\235\371C}R\b\267\374\345\006|\020z\001=s+\344k\203\373\005Q4\372e\247\312\340I%\353~\221\373\032\343\344\314\027\026\002`\236\345\003\216\302W\337\227\276#\365\241\003\201\217l\315j\242\021\200\022\262\347\001\260\313(\031\317\206|\027\030N-\203\356\342X\003K\304\220 \r\330"
+	.string	"\3600)\030f/\325\341T\254\316\031\257{A?\177\t\353\203\021k\263\335\002("
+	.ascii	"\300g\003 e\227e\340\326\271\033\302$~$\263\025\220\304Q\272"
+	.ascii	"\363\246\303o\202\321\013\260c<\246s\222\341e\227\035\345o\270"
+	.ascii	"\030\315\226)\305r\f'\350Un\340\006Y\t\250\250 T\334\b\326l\016"
+	.ascii	"d\357\274\307`\276s;X\257\310u\034\334\243\037n\270X\265\025"
+	.ascii	"\320U"
+	.text
+	.section	.gnu.lto_.symtab.959c77e4385ff9ac,"e",@progbits
+	.string	"rxMspOverrideReadRawRc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"rxMspReadRawRC"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.959c77e4385ff9ac,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
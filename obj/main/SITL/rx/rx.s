@@ -0,0 +1,2207 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\f"
+	.string	"9"
+	.string	"F"
+	.string	"Q"
+	.text
+	.section	.gnu.lto_.icf.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\363\003\r\027"
+	.string	"\304\036\347\004"
+	.string	"T"
+	.string	"\354\256\342\024\004\002"
+	.string	"\002\001\001\321\332\305\303\017\004\002\002\002\003\267\335\335\337\n"
+	.string	"\003\317\253\250\341\002"
+	.string	"\004\330\370\241\354\t"
+	.string	"\005\204\365\237\235\017\016\002\004\002\005\006\006\240\342\234\212\n\007\b\t\n\013\350\373\222\243\013\004\002"
+	.string	"\002\007\f\364\214\364\233\b\n\002\002\002\b\002\006\002\b\002\t\002\n\002\002\002\016\017\020\021\357\220\305\366\005\b\004\002\005\002\013\002\013\002"
+	.string	"\002"
+	.string	"\022\023\352\263\360\321\b\024\231\212\366\300\001\006\002\002\002\f\002"
+	.string	"\002\b\026\242\264\360\361\003\b\002\r\002\r\r\002\r\027\030\211\373\302\306\005,\002\016\004\002\017\005\002\006\002\020\004\002\017\031\032\242\302\263\302\013\035\036\037\341\276\262\363\b\020 !\"#$%\231\233\302\213\016\002&'\323\331\354\253\b"
+	.string	"()\256\334\323\366\007\004*\307\233\244\242\007\021\002\022\004\002\021\002\004\002\004+,-.\347\346\214\201\r/\264\370\341\227\0050\370\300\377\377\001F\002\023\002\n\024\002\n\025\002\n\002\026\002\n\027\013\002\013\00213\350\300\306\254\00545\274\205\242\255\006"
+	.string	"67\354\301\314\336\005"
+	.string	"8\240\201\310\221\017\b\002\030\002\030\030\002\0309\377\245\346\313\017\b\016\002\016:;\365\273\261\345\005\031\002\032\002\032<\202\245\236\333\006=\274\201\267\213\007\004>\205\326\204\336\017\020"
+	.string	"\002\033"
+	.string	"\002"
+	.string	"?@AB\267\205\240\220\r\026\022CDEF\324\351\375\343\005\032\025\002\n\016\002\016GH\323\343\357\213\016\006\013\002\013I\312\267\354h\002J\225\232\322\306\r\b\034\002\bK\345\274\275\032L\347\273\234\355\fM\223\335\346zN\004\002\004O\313\331\347\361\004\nP\342\201\222\246\004Q\212\254\201\341\006\f\002\035\002\n\002\036\002\036\022\002\022RST\260\233\213\233\tUV\321\265\255\355\007WX\240\342\234\212\n"
+	.ascii	"\200\203\250Q\275@)2(\243))f\rp\202RCD\036\021@e3WS*,\007\367"
+	.ascii	"\225\2764\315B\322\2249fY:h6\305\213a\254\271\230NK\202d\372"
+	.ascii	"\fnY\220\351X\215\233\210\240\274\216\215\371FXy\017\351\246"
+	.ascii	"\311\211\201\006\241\363\377#w\227\306z\376\341\317m\271\b\324"
+	.ascii	"\236p7\217D\024D\310\260\224}\225\231\020\200\352K\207\204mj"
+	.ascii	"\327S\376\032\241'\332$n1\366\255\267>\251_\003\275\344\341\313"
+	.ascii	"\200T\0378q\257\265\224m\261\265\265\330n\375\027\2175\311\320"
+	.ascii	">\201\005\226\355\335\3428T\306F4_\312\331_\306\301\0273`\320"
+	.ascii	"Xa*t\373\017\345D\303\326\371ku2\337\307\350/\300~\022\376\237"
+	.ascii	"W\241y{\354\207\321\355}\2060I%\373\366KDNO\225\001\016\367\004"
+	.ascii	"\241\340\361+\377A\231\247\302S\037c8u\316\3079y\030"
+	.text
+	.section	.gnu.lto_.ipa_sra.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\205\006"
+	.string	"\222\210\030\036Pe\025:033333\253b\240\377\310\204\206\267"
+	.string	"\260OgG\275\367:\362\345N)\252N\201\0310\001F%\232!\320\374x\276\243o\316n\326d\364\302h\275/\333\362\225\245\354dJfD\310\3031\303_<\255\242\\b\"\016\026\352\245Iz\325\2455U\025a%\301\336\006\032\254z\033>\0203 P\202\201\322x\252`[\367\251\345\220\025\322\371\004Uw i\ba_/\315\026j\303\360\0334Dw\021n_p\023+\322\307P\003\037\304W\374\214\270"
+	.ascii	"\ft\367\227\251!\241\271\230n0\307d@\2461\274H\257\330\335=?"
+	.ascii	"F\027\235r\3011,\334\220<\r\2019\227\026G\b\216\013Z\030\354"
+	.ascii	"b\324P\344`\330\305E\031\002"
+	.text
+	.section	.gnu.lto_.inline.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\311\007\375\035"
+	.string	"\006i\223J\220\224N:\f\230\301\325k\007\340\nQ\355\272\035e\256\313\310\305\316\227I\n\r\254\213\253\201\345\223-\220\255\327\3740\"\022\005\200\220`/fD\"\021\302\177\226"
+	.string	"\211\270\227\3643\363\345\023\342\335~\0135\202a\324\032\331[\312\024t"
+	.string	"}"
+	.string	"\205"
+	.ascii	"<\240\246\201#iJ\346\346}@\362\366?s\3666\307\336\362xo{\276"
+	.ascii	"\355\371\266\"\352\233\217\024\310/o\313\377\254\217i\3465\377"
+	.ascii	"G\300\274\026\272=\363"
+	.string	"T.\266\257\035\347Q|\352\026\222\321i\306\247\016\221\214N,'mMq\357%\372\353\373\247\215@\005\205+?}\204\n\nu\347~\353\364\275\367\342\376_MK\323cJ\377\374\253i\232\036O\376\233\227\303\377e\232\317\347_+\301\302jsy\314\177\302\367\001\371g\263\376T\251\036Fd(\216:\220\3308\331_\376\363G\351\362\266\fQ\303\224\236\306\372\024\256\323\\m\306\261\235\321\023W\333Z\213\375\337k\366\342^\233\b*\301CC\\\257O\234<\363t\230\322\023\217\001o1k{\021\337\222\354X0ir\264\373\312\317;U\355\336{6\335{wW\331\341\356\003\326\237SH\235E\215/d\004:\345N\347.\241n\t\245\320r\277O\317X\352\242ra#\222&\026\340\021~\025\362>\340NXd\032\256\034\002\325\222\243\220\372\266\357\034&\336K\224\023\003\026\001\323Y\232\2523\265\033\346\0378h\300"
+	.string	"\247.`Fi\240:\326\266\342\212k\364_I4\272\204\006\371\333\025D\245\251\233\371\225\246n"
+	.string	"\236\340\177%\336{afT~\240\337t\323+os\235-P\177-u\357=9\315\210\346i\263\242!h\274\032\377\377\323\376\n\325\n\346\226~\240[.ET+\212\345\037\376\223\367\320\3017S\306a\003\367t\321\275W\3005\224\335{\t\364\2172\024)\2612\3132\217!\245\317\242\254P\363\027~]L\022\026A\364tP\205\013,\234[\310\351\"\323\220h[\200\0019b\300\2469\007\316\246\203\336JYiH0\257p_\371r\247\327\252\304\300`~\022\331\212\2635\315C\256i!\376I\036\322\302\325t\020\307\230\352\202\361\362\t\001\200\250\250!9b\204\346\002\032)IA\322\001p\002\031\251\251\262\003\022"
+	.string	"\024uC\235!\210\030\343\f\005\023$)('=\234\2075\352c\243\207\334wV6\035\316\256\374\336\220\260\033\215\330\275Y2d=\022C ?\323\325\345Tg\202E\346\367 .\266d\017\233W\222\350\324\257C\236\313\327\325\225\005!U\273\326W23_;\213>\323IQk_kq\320\f\0344\356\200\332\243\016\024a\354\217\346*\025\307\326#\332(\260\033C\342$\217)\266\360\246\346\004C|d\035\331\260}\263\241\305Vk\3065\211\0236%\215\335K2)\345\036\266\226\3059hc~#\334@d\376\221\322\204\235\222\333\331\351\362g\274/R\"S\350\005\334\275\362&\243\371\215\207;\177q\272\354\311^\251#\035\220b\td\316\373%p\037\250\272\331D~k\342\324\033\367\365\213\307h0\274\245"
+	.ascii	"\023Yv\033K\3743,\360\255\210>\332\233@\360\036\200g[\002\241"
+	.ascii	"UX\240\t\347\020\364J\034] \224uJs\216\307@%\032\266\324\245"
+	.ascii	"#\026F\306\023Sr\003\371\212\325\236\261\341\b\b\360\006\005"
+	.ascii	" \032\236\357\260\360\037}wW\003\253\365\210\307L4TC%\rQ\221"
+	.ascii	"/\322\017|\330\267x\216\002\202\254\222;,'\260\0370%\034:\331"
+	.ascii	"\265\257\225\243\034\032\2051\252\006\226"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\371\003=\021"
+	.string	"6XN=\020\221\222t\240\b(TA\004\024\376\004\335\340f\016\024(]\007"
+	.string	""
+	.string	""
+	.string	"\033\216\\\025(\002P\244\240\037\312^\360\035\313\376\341w\310\2338D\326Z\230zB\275\332\357\301|K,!R\2467"
+	.string	">"
+	.string	"A"
+	.string	"M\353\310c\261\312Y\252>d\363\262yY\023\243\211)]8\216\225\3022\265F\025\232*\304\377\324\207\246G\275\rY\220\317|\024(q\372\247O\266\211\354%r\320JG\035\223Y\203\244\301\265x-\001X\262f\311*M\372$s\006\214\214\360ZV#\0261\336\212\325\276"
+	.ascii	"M\3234\366\005\351\202ek'\030\273\217\007\020\235\232\215,\n"
+	.ascii	"\232\030\203\204\301r\022)\001\255\265S\226\224@\022\301\003"
+	.ascii	"\341\037\274\203o\360\f>\304B\214\364\360 \023aL\2041\316`\253"
+	.ascii	"n\320F\216\026*\330[hmG\n\306Px\252~\205*'\t~\320\034\224\021"
+	.ascii	"\312DU\232\224\347\300\037G\367\006D|\210\007\361\341\304\303"
+	.ascii	"w\200\201\221\301\276\0139\374\206\357h\340d\340\251\311N\017"
+	.ascii	"\204,\2063\031~VO\255\251\005=\224\013_\005\004=\017\205\257"
+	.ascii	"\304J\223\"\320+0!\272\276i-l\250\3618\254\220\315hS,\354\006"
+	.ascii	"P\002AL\025\331\006\021\240Hh\fD3%II1c\246\177\301^\335\177\323"
+	.ascii	"s\036H\340\t\322}\260\002\240\036\316\222\260\271.YB\262\377"
+	.ascii	" \027\344T\207\300\026P\032\324p\251\232\224\355\265\374\332"
+	.ascii	"\366\342\241\t+\225\374\013;\307\213v#\3317\343iKC\004\357+N"
+	.ascii	"\327\213\344\020\267(+\200~\026e\225\033\007ke\223m\001\270\030"
+	.ascii	"\223\260\210\261\327\023\345Q\376q\300x\004\003\346\377\246\275"
+	.ascii	"w\263\b\037$\267\330\325\245\022\365\213\0070\214!GuZc\273\312"
+	.ascii	"\246\203\r\355\034\317\234a'\212\224\265\254\241\306\334\200"
+	.ascii	"\275\334\200A8\0179K \3358\230\253\272\234\224\223Ri$\017Nw<"
+	.ascii	"H\273\345S$\357>\204\017\316\005.\347.3f\\\301\242_\314%[gM]"
+	.ascii	"\247\3416~\251}\027<"
+	.text
+	.section	.gnu.lto_.pureconst.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \200-\003"
+	.string	"\002H\030\035@U\322\001\352\252\021\034]\206a\030\005\250\"|\025\252\202/"
+	.string	"\361\344\227\002Sb\254\355'i\034\215\242\033\272\240\361s=c\347r\356\346jn\346b\356\345\264\334\312I\371&\237\344\213\214\220\361\361r\234\215\313\270\352.\256\342&.\342u\270\206[\270\204\327\340\n\276\277\300\0078\247\323\224\231\225\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\313\002=\f"
+	.string	"\006\320.,pm\226\003\374\377\377\227\226\246\376\377\377\377\2573\312\212\223$\223\202E\353\221QCO\r\017\325\032-%\364"
+	.string	"\b6\212O\332\336I\246\037"
+	.string	"!"
+	.string	"%"
+	.string	"\004\272\315\204\247\303\037.`=\255\235\345\311y%\324&\365\1773+O\315#M\313\211N!\001\224W\214\326\303\016\363\304\f\232B\370<?O\007\332\331y\336\240ry^v\235\247\002\235\016\250V\001\231\227p4\021\027it$\300MH\327\241\211\236\327 \255*K\373x8\033w\355B\317\320T\203\206a\n\224gV\036 \013\022\215"
+	.ascii	"(\255C\345\320mh\250\031jy\030\027\332\261\320\n\245\020b7z\257"
+	.ascii	"\251\tw\231g`\250AI$\021\321$\231\306@\002b\234*\273\001\021"
+	.ascii	" -C\022\231\005I\241\345c\"\233u\226\206f\311\230\003\264\351"
+	.ascii	"\001\331\030\271R\271E\311v#\204\376.XrB\344\302\263\276\205"
+	.ascii	"\36003\235\"\271=\221ig\327\016*\342\357\026\222i\202\006\373"
+	.ascii	"UGI\t\305\262-o\330\367\275\266\0130\211\021e\2442\324b\347\371"
+	.ascii	"p=N\001\t\307\352\246\021\3702$\253\177\201\303\357\313\020\021"
+	.ascii	"\037\301LV\f\021\227\034\227\tO?\230\323\266\233\303\370|\327"
+	.ascii	"\003\257\214\371\033\212\250}j\361\212'\362|J\371\362\334\376"
+	.ascii	"\206\361%p\335\336\225[LF\316\251\240n\326\253/ v\340('\307!"
+	.ascii	"=1\024\364\005\224*\203\357\364\t\324\240\017"
+	.text
+	.section	.gnu.lto_.lto.ab32f613826644d9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.85.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \226E\004"
+	.string	"\244\007i"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\304\242\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\344\030us\355\007uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001\004,?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.string	"_\304\202Yt\212\"o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.86.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`}\001u\017"
+	.string	"\206\335hF"
+	.string	"\221(\035\323L\261s\2110\360+\r\313\007'\234\356\315\027\2219|k(\030K\360&L\210mj\220\240\332^\271\276\2315\346\277\264\341\341\375\377\227>7\301\350\f\003\221\256\313A=\222\316\354\027ido\271S\nR"
+	.string	"Q"
+	.string	"W"
+	.string	"\335?\270O\233l\034\017\301\375l\2252\263\331]OIX^\206\267\214\246O\251\321\344\277<\244D\214\025\353\364)\003\330^\"\004\260:\310\006-\030\333e\217*\254T\224-+\327\313\256"
+	.string	"\254Y\261V\0369\021v\327q\305\nqs\267\375\331\206`\277E\235\303~\316c\267|\264\306\350\030\243\357\351\270\330HPc\367\303\355fe\246\214\023\217\335~\350\313V\234\205\3511\307t'\020\035m\346!\307\356\212|\372A\367i@\336c\373\321~\212\2530\035\206r\002\273\256\036\265\335\220\201C\272O\207\007\341>\003`\215j\304\200\032\3510"
+	.string	"\334\240\331pf~\302\331\031\356\342\344\300\314\356:\360i%\r\005@\023\237>\n\367\211"
+	.string	"\324\201\2127G\345\250\352U(n\032\3345\352U.\251x\263\324\353e\2277\340\216\224\036\250xSm\301\330ZTY\354\360\024\325e{\265jV\227\035\241\223LB\023D#\022\220\211\350#\241\002H$\372P )} .\031)}^\351\363D\241\217\005\257\344#y#\037\036]"
+	.string	"}\036\206\321\350\363<\341^]\376\313\273\027/\031\224\246\246\262\2303C;\2524Q\344RUl\307pR\017\213\321p\210<.ww\245\027\\jG7\004\035"
+	.ascii	"3\003\3769\204i@\272\266,b,\201\225\221Y\242\203a\320\216\245"
+	.ascii	"\236\360\264GDka\314\024\0023P\227q_\205TKh]\354U\021\250*\034"
+	.ascii	"\334Y\325X\263\022\035\334\213\033\"\312^\250j\274\237D:\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.90.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \226M\004"
+	.string	"\264\007i"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\315\362\023\032\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\305\031us\350\314\030uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001\022+?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.string	"^D\200I^\212\"d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.91.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\366\001e\022"
+	.string	"&c}I\260\324Q:hF6\002:\357\035\270+\256:\353\005U\203KC\375\267\202az\037\256^\221U\270\250}d\373zZfN\nPe\373r\250\375\261\263\263c\322\007\231\277_QN.\337\240\215}7D=ldo\"eJ\001i"
+	.string	"b"
+	.string	"j"
+	.string	"7\221\217\226\331>\256\013\2327\002a3\212\232s\206K\302\002\376\351n\251\262\2032~\2532\277\350)%\230n\270\233\203\337\236\b\242\263\302\331\276\026\033:B\316\273\346\340h*U*z\036y\376}\fh\2040\262\302\325\276U\212\0354\022\\\006\335\363\256@\b\352\206\353\271\202\017\346\234\326\033\316\303\235\272\355\035\333-\266\242\004Z"
+	.ascii	"\312G\311\013d\227\234\350WE5\370\335-?u\274\372[\365\256ZU\375"
+	.ascii	"\225\n\007\217\004Osv\350\025\231J\361\006\212\357n_\347\363"
+	.ascii	"`<\206\354;'\245nvRGF??\346\234*\217v\220z4\360\235\304\366\325"
+	.ascii	"\376\320_\310Nds\022`\326v:5\346\324\2558%\365h\335\007\310\307"
+	.ascii	"T\030\204\240p~\300\265_G\002\3403\323\336\0277\247Q\033\\<}"
+	.ascii	"\013\004\201g\304\256GM\2078\256]\3412h\020\004\3159\033\370"
+	.ascii	"G\027b\007\232L<\3726\3621&\335\200|\343\022X\332U\355\267\307"
+	.ascii	"a\241\267\016\251\273{\234\025ru\277\031\266#3\355y\345r\277"
+	.ascii	"\347\375\245\205P\3176D\323\336.i`\022\261\233\263u\264\255\307"
+	.ascii	"\"\264d\\/\227\231\030\227\213%\301%F\206\025\233i\261^j`'\206"
+	.ascii	"a\251\201\2055\260\320\325bM\ba`\261\220\305\304/\n1\260\320"
+	.ascii	"\302\353\005\013It\263/P\321SH9\224fK\0037g\320)\226\354:\251"
+	.ascii	"\312\345\3468I\312\r?\020\3319\325t\210~s\316)7g\375PN#\265)"
+	.ascii	"\211\303\306\323Hps\354\005\227[\262\001\" @\002\204\030\026"
+	.ascii	"\017a`\357\035\232\033'\313\312\342\276Q\0205\312\244\301\206"
+	.ascii	"\360\013\350kLz\f-\370\252\235\265\335\377Va\343\231ZRh\016\250"
+	.ascii	"%\344Vw,l\320\315n\fPen;\233\260f?\035\3552XDv@\364\220\365}"
+	.ascii	"#\353v.C\006"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.92.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`r\001]\017"
+	.string	"\306\034hG\360\260(\035p\016CF\375A\263B\301\016?\306hlG\220\330\357\327s>\266\242\325\227\327\232\037\217\235y,\326!\362.\"\314\036[\360\350#q0\231$\311\223\366% ^\315\215\203\255\037\315\203\221X\262\267\334)\005Q"
+	.string	"P"
+	.string	"U"
+	.string	"\333\247O6\216\203(\3661\025\037b=\273\353\351\t\313K\360\226\361\364)5\236|\232\207\270\344P\261P\2372"
+	.string	"-\246\204"
+	.ascii	"\226\007\331\240eC;\354q\305JE\371\302r=\354\".2\025\213\345"
+	.ascii	"\361\023aw\035U\254\021\367v\333\237m\b\366g\002\177\375"
+	.string	"\362\341\035\377\272\017\340$x\302\026\"<\273!j=6g\312X\361\360\366A\037\366\3420N\017}\303\241Dp\262\230\214\216\335\005}\372\001\367\231@\376\303\366\243\375\231\2738\375\205r\200\300\252\204\253\331.\310\300!\334\247\301\033\330>\271\203\004q\307\345\356\256\364\202G\355\024\024\256\2308\370+\247 \032+,R\261\346\0013\r\257\351`l\310\370\243\363\223\315\336p\331\t\267\273\016\374\030\0358 \320I\361\351\243l\237\207]\001L\215\236\235\224XSm\331\320^T[l\020\025\325E\213i\315\254.\273\343\002\243\233\214&\220J$\"\023RHB\005\021\211\024\242@b\372\n\270d\304\364y\246\317#\215B\026\274\222\017\2037\002\342\322\005\321\347e(\225>\357\003\334\253\213\346\\\r\217\234\024MMm\361g\206vj\302\001\021A\217\272:\354\335\016\316K9\265\214R\257+\337lQ\377\no\250\004\035"
+	.ascii	"2\003\376\031\343\206\306\341\364\367s\267\346C\024\203\t_f,"
+	.ascii	"p\r\245\2100\225\307\215\265\027\346\242.\350\2762\tLT\246=\235"
+	.ascii	"\331U\006\250\312\034\264\263JX\263:\035\264\213\303\"\312^\250"
+	.ascii	"j\274\237D:\327|\002"
+	.text
+	.section	.gnu.lto_nullReadRawRC.93.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\365\007"
+	.string	"\342\01677@o\323\001\230.\f\312\231O\"\320\215\006\352\226l\236\003\375$\324\314z5\366\032\311,\310-\022\372z\242\252\006\231\253Ow\344\035H\204K\035\030\031\313\254\233\020\231R\021\033\307e\020\332f\3632\357a\013\201<\216\302\341\223\001\326>\237\214\237\214\034(\013EMN\304\217\307\235\304&\243\327u2bs\037^\004\027\324\310\236\"\245N\366\253\245L\266b\034/\007+\273\03154\353b\265\204\330\006m\314v\245\266\302\002x\224\212wv\004\323\221\240j\337\344'\340\247\305\005vM2,\273\023\301\005\234[\236\034\333\376\310I@\207:?4"
+	.string	"N'\030*3\2733v>p\335\322{\256[\224\307\303k\350?\345\225\bH\f\251$\272n\032v\327J*m\334\324m\033\330f\260]\022\f"
+	.ascii	"2\003\202\341\243\302^\025\220kx\227E\3531\241\301\\\201\n\007"
+	.ascii	"w\215T+&a\222\001"
+	.text
+	.section	.gnu.lto_nullFrameStatus.94.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \366\325\006"
+	.string	"\222\21515Pm\222\016$\243\352\206\"\2408\333\013\205\212\212\207\247X\266v\350\334\301\376n\234\023\r\254\335ems\346Q\263D\3234\250\035\023i\270\272\f\177\354f\033\221)\230\306\321\032\260\217G\003A0\204\240\300\235M\b\276\020| \017\347\363:\360\341m2g\016\030|Z\226\301w\305\354f\025HP\023\037G\216\302\370^23\247N\357\256\216\024\315Hf\251\205%Q*\023\216\277\277\350\257\337\271\257G?D\005\211\350@\346I\245$3j6\300\264:\226\300j\205i\306j\365\237\240 zk\324(\005P\220T\210\254d\306Get\253\333nCz\351\3308!\231Fu"
+	.string	"\013\231\271#\231,:\325\377\340G\370/\002\006"
+	.ascii	"2\003\202\341\243\302^\025\360v\031c\272&\031"
+	.text
+	.section	.gnu.lto_nullProcessFrame.95.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \370\365\006"
+	.string	"\362\31526@o\222\016X\250_\t \327\002\242\033 X\241\346.\300\341\237\231\033\005\221\335\034\230\273\241\302F\323\3772\252\320\352\311O\023\t\370V\t\334t\201\355\257iBd\n \314\2039\200D!l$\321P\202\002\177:%\370J\360\215B\036\321\373\300\210\327\331L\202"
+	.string	"\301\207\221H\360\035\263Nu\263\253\200\302U|<5\307\361\005\310\314\334\251\276=\200\254\\81\231\250\030\230\\\261R>\376\376\246\017\370[\373\212t\304T\222\211\016d\252ZP2#g\003M\255c\t\256Z\232n\256Z\377\n\013\246\263F\017T\306B\345\302d\225\031\237\353h\326\226\335\226\364 \344e\203\345$uj\3130d\346\r#\225\321]\177\204?\341\327\b\005"
+	.ascii	"T\b\203\347\220\254\202\343.s^\327$\003"
+	.text
+	.section	.gnu.lto_rxInit.97.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`g\020\305K"
+	.string	"*~\354\033>0\342J\007\257|8\272B@\b\324\343OD \271\311<R\332%\207p\n\336\252\241\375\024\201f4\357\221\002\340\002\005\002\240@\367\336\301"
+	.string	"/\t\023\244I\0038[\304\373M\366\3362\245\024\256\001\217\001\264\001\354\267\243\320\372\323\326\204\356,;R\343\"\325?1#;\346\316\017\335\301\270\027\272sq\247\"zb7\301\300\325\205\211\343\370\200\233`\001\354\207:\240`\324\270Hs\215\215\244\2642\216\251W\356`\273\241\027'\204\275\220\207\033\207q\317\n\317H\3061U\200\353\254\321\367\360\301F 8\247\262\333\005\273\233\201\335t\326(\036\243;\264\322.m\007\354f\373\324\377`\247\266\"t\214\032\247=\370B\225b9\333"
+	.ascii	"\\g\241\256\324:\273zR\353l\377pic\325\355\265I\3438n\262M\270"
+	.ascii	"\373\216S\347b/\214\232\rV\306q\274\225\245<\237O\250F\362\225"
+	.ascii	"\352]\224a\207RMIEA=951-)=\223\220\216\214\212\210\206\234M\241"
+	.ascii	" \227\331\262k~\270\375\221\340\tt4L\003s(\241S\021\376\375\024"
+	.ascii	"3\302\232\207\206Pj\371\2466u\251\325\231\207\346\267* \253l"
+	.ascii	"\322U\215h\323\217Z3Ye\023oD\223\256\017.\315\342x`\335C\311"
+	.ascii	"\251\365\371\323\026wj\342s\246=\303\273_\332b\367J[\004\253"
+	.ascii	"\374\223\031!\320\r\034\342\275\251\365y\022\022\025?\232\262"
+	.ascii	"B\373\350\336h\315v{\204x#\332\334\372@\214\220I\007\364\252"
+	.ascii	"<\264\266/\222Sss\"f\004@\277\372B\225Z\276\251\271\371P\225"
+	.ascii	"\263\331\210\326d\205\346\241\261\275P\320Z\036\032\223w\231"
+	.ascii	"\336\210\266\304\354[\266\254\231F\366\253\277\2519\361\274*"
+	.ascii	"\025\261\213\022\245\215\255W\222b\370x\237\377Y\232\330?3B\034"
+	.ascii	"\307\375\32145\357*\357~\023\335}\242\233\350-\321$0\037\334"
+	.ascii	"7`.\216\303<\332\r\3739 \370\357\217\243\031.F\2230s\267\004"
+	.ascii	"\277\244\240d\271FF\365\264\231\231\335,PW\360>\026\3348\036"
+	.ascii	"c\320N\351|0d\330\260\241u\266\315CG\312XN\303\276:\324z\362"
+	.ascii	"$:\331;\221`\220\376\026\233\254Q\034\307l~\252\361\t\250\332"
+	.ascii	"\t\255t\034\021\373\013\021\266\2405\216\327\374T\303\322\222"
+	.ascii	"C\b\335\334\370\346\320\341 \372af7\347\247\032\336\223Q\023"
+	.ascii	"\330\376\0325^X\2745m\330\0347\306?\277\376\371\251\346\204q"
+	.ascii	",\203\271d{P\326\034\347\036\332\356\016n\306\003\023\2358\216"
+	.ascii	"\031\264\227qE\020\355u\316\266\b.\266\235\253u6H\257K\345d\330"
+	.ascii	"W\215\246\004\371\3139\256q\264\236U\004B\216\375e'}Sc/\321v"
+	.ascii	"\237H\361\036\365\354\225F\265\224\034\313`\335T\261\317q\335"
+	.ascii	"\336t\007\310\3309J\367\t\022\\^\350=\302\371\035\302\017\275"
+	.ascii	"A8\030\357\017E\337\030\212\276/\024}ky\241\367\001\347\342\235"
+	.ascii	"\345To\254\366\373\312\371m\300\371]\240\375\266\"\372&@\364"
+	.ascii	"=\200\350[\200\363;@\373\r\240\375\256\032\372\206\006}S9\277"
+	.ascii	"\247\234\337R\355w\224\373\r\345~?9\277\235\234\337M\3567\223"
+	.ascii	"\373\275\344\374Vr~?\333\357\244\366\033\251\371}$\364m$\364"
+	.ascii	"]\344~\023\271\337C\354\267S\350\273)\364-\024\364\035\344~\273"
+	.ascii	"\314of\373\335\262\337,\373\275\262\337\231\375\376f\201\374"
+	.ascii	"\231\225\262\023 \244\374\314\355\022\304E\263@L\026Z\244\354"
+	.ascii	"\206\376sr\216\226\223E\b\227r\\RF\312y\032\270f\354/\353\374"
+	.ascii	"\337\364\315\303\262\371I\223\362#>F\376\226~\361"
+	.string	"<\337\233'K\331=-H\331\333\320\371\036:niJ9\256_\312\366(\177\005>v\277{^\357\245\324 \267\327&\365.\335\260\334_y\373\004\335\025\331\243#u\266\037\357\363^\313\327\317\013\350\255\266\316\036e\027t\003\202\216|\216a\246o\317\034\327\217t!;\237\2226G\030\262V>\3536\312w\036\325\343E\331({\035XQf\307\342\360-)\252V\253U/@'\006\3031\365\334TNj\345\356\326z)]CrK\302\276\272&\021\345\013d\037\005\216(\373\"\322P\306\220\237\022\312\223\241\354\203\217S\247\022F\311#g\366-\320\330\231\275\317\275\311\030?F9\256\231\220D'r\206\034\302r\254|\326\212-V\366\251'N\251\013,\312r\254|\"\373\370\342\245\311\006\273M\3151\3715\330,\b|v6\030\325\363u\016\017i\205r3\263l\312\332\304\276\332\r\276\033N\203\215\274G\205\362"
+	.string	"5JF\261\f\326Ay\356\221t\0255\3507\362G`$\260\022\230\t\0236n\016\202\331>\rv\362hnv@\267\232\\c9\315Y.!\341\020\265C\2368\354\326\366\013\371!\260\033\024\030\016\256u\226)\270\270\347:\332~ \037DG{]\303q\260\024XJ\353,\253g\246r\222\016\246bE\247\312\223\301wck\206\216x\360\025+,\017\006k\371x\211\241\233\375Bk\307\327\226\213\032/\264lx\261\240!#\305\212\257\255\025-\234\272R\274\212\024\357\205#FW\016\026\206\367\n\255\035_[;\276\266f\300\350\222\261\265\342\313\306\226VR\323\250\341\365\265u\203\006\215\257\255&5\314s\224\346\372c\f\313b}\225\367\350"
+	.string	"\204\245\204\310WHr\314\002}\310\006r\210\354e\223 \262\201\354\2002\360\363\350\370?\222 \362\317y\234\206y\361\002\371C~\222S\326f\225\013\f\376\235H\253\354\211\276\362\r\342\341\233\232x\002\331\245_\347Et\377\361!\337\302//\"b\233\370\212\031\361\235\350\207s\256<\201P\255^v\277\212\357\342{\224@\206\n\310\235\350O\332\035\213\343\260"
+	.string	"\003\262\227\245\t\220\005\344\003e\222"
+	.ascii	"r\200\354h\036N#\200\214 \356\016\037\364U\323\366\267y7\257"
+	.ascii	"\232\227\315\353\346u3hgo\222\212\352UY\305\233_c\301US\225\261"
+	.ascii	"\354\244m~\323)\347\032\365\f\231\227\312I\016\357\3227\303\005"
+	.ascii	"\241n\257M\321\357\311lp*1\207\201k\3221\375\312y\035\337\243"
+	.ascii	"\355\205\307h)I\226\301\272\017\036\036)\257\026\232\227:<\030"
+	.ascii	"\017.\"\324J\2172\352\211D\316\220IX\236\365\314Z\3438\216\241"
+	.ascii	"\2622\211\354\201\276\3769t|\270\247\034\327\316\326\245iDv?"
+	.ascii	"6;&\256|\200j\302\033v)\025\036\310T\271I\321,\320*\225\2472"
+	.ascii	"32*Ke\177\037\277\213\205\022r\177\006\005\243rS\017\217\245"
+	.ascii	"\023\027\207\312#\036\320\2372\224S~\312\362\246\354\224\235"
+	.ascii	"\"\223r\223c\023s\314y\264L\231+?\240\2626'\347\321.e\246\354"
+	.ascii	"eyJy)g\312\201L\250a<\343\220DffFD\222\024$i\f\241\005\304\020"
+	.ascii	"\007\231\331\r\0210\251s\016\031I\223\016_\303\277\200}!\306"
+	.ascii	"\313*5G\237+\352\224\204n\242\n\210J\370\017\373$\236\210z\276"
+	.ascii	"\227\213\205\360=\034\213\205\022\312\357\334\354\3465\024\345"
+	.ascii	"\255Wi<#^\251\\C\t\226~g\367\255\021m{\310\254\325\36026\221"
+	.ascii	"\354|&\212\365\333\005\260o@_\013O\313K\231?\316\215,\r)\302"
+	.ascii	"N\034\225\355vq\310d\340\007\0236+\260\241lz?\302sYr8\351D\263"
+	.ascii	"\243\262\021s\237\266.\367\236\303\204\252I\204\313T\005\304"
+	.ascii	"\337]v\244\343\3541##\203^\200(\231k[b\230\221\367\266\344!\261"
+	.ascii	"\013a\177"
+	.string	"\330\353\232\311\350\232\005b\"C"
+	.string	"QH?\220\354L"
+	.string	"\310b\257T\323\304\241@\241F\b\027\005\030o\342\235`\331\262\246\350\303\270\320w\323\263\002\354\300]\305\231\257\032\004q\257\215C\006\013\247\256I[\367\224\252\252P\331`\374x$ax\365\025[\245\264\302\206\242\361\026\271\311g!\017\003\337\303\240\353"
+	.ascii	"&I4\221SIr\2059#\271K\323\016}\025\360(\352;$R~\203\251\032\261"
+	.ascii	"oa\374\370%`\362J$\242s\025\215\024\244\217\360\266F\224\275"
+	.ascii	"SS\027\035\356xN+\321\274\216\3618\234\261\003\341;\315\303\242"
+	.ascii	"\310\032\225\235\326\302\017|J\233\370\265\r\252\347x\246\003"
+	.ascii	"\322\305~\314\327\357q\236\262\271MzM\306p1\315\262|G\2335\236"
+	.ascii	"9o\262\022t\205\327\020\r\276\361\340{\320e\264hw\237\330\317"
+	.ascii	"\315\306\260\343]~\211\332\030I\321\tq\r\336\325P\023\257%\370"
+	.ascii	"\217[_!R\370j\332n\254\034\250`\227(\341\2343_f\207\371n6\360"
+	.ascii	"q\002H\366d\nA\003\321B\\\317\302p\361\3311Q\367\334\362\243"
+	.ascii	"\036\330\230\021S\340\220zC\302t\353\257\271\r\342R\303#T\321"
+	.ascii	"A\325\3166^\020\210ESg\326i\365\241\273\013\274\223<:\2451 \370"
+	.ascii	"\246\304\303Ht\305-W\022\3607\330\326\245+\2634\302\366\253u"
+	.ascii	"\341jm5&%\254\361\207\311#\364\355E\n9\031\007|:\355F.\217(\\"
+	.ascii	".\355\024\b\240t\345s\020Ss\032U\n*\265\017{d\200Ro\234\312\207"
+	.ascii	"\025-\320H61\203\013\216\210\377\217\025e\202[1\202\330j"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.98.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \3365\006"
+	.string	"\202\013+3@o\222\016\230\016\217\276\323\032\246\206\031`_\304\231+\247lm\336$\342o7{@h\204\004\"v\3352\f\b\037f(\270\321c\370\2661\333\332\3362\005k2\233\3066\215=4,80M\213`\031\201)\b\206\306$(\2521\314\225E\321!\301\007)\276!\025\251n\307\023\234\253\325\351r.\235\016\0030>7\372\313s\230\361\225\022E\377}8`\242\242P\222\t\032\265d\312D\342\361w\036\363\001B\347\252\327\006\250\034+\025#,\231\027C\215V\275\352\026\244\322\307\t\212\025\362\364"
+	.string	"\0222\363\263B\027\035\373\033\374\005\277E\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.99.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2PO\222\016 \017\221u\326\022=uW\247\026"
+	.string	"D[\274\267\270\370[\303\332\2555gufj"
+	.string	"q\0013\323\210\272\033+\364q\035\354\315Pk{\313\024g0\232\3064\215A80<\260L\223`\230\201\247\210\206\306&\246\251\261\213\225\305\320a\201\007+\276\"\035\241\256\307\024\233kU\351n"
+	.string	"*\035\ndx\356z\253s\250\361\215\022C\377}H\260\222\262pe~\256\226D\221L>~\316_FH\340L\325\342\370\264C\305\202\204%\323b\270Q\252G\335\2064\0029)\251@\235^\200Bf~\025\b\243c\377\203\337\340\277\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_suspendRxPwmPpmSignal.100.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*\200M\032\003@!u\213\t\315\260WQ\367RL\232\024\305#\"\006\3076\034\332 \3621C\210\205\275\335\214G\341i\213{\313\024_V6e6%\304\261x\310kJ\244E\030\2130\246\234`\330\224\325\267\032=\003%V\376\333`\324\274\0026z\017\013\231\221\202\264{I\241V\024\bu~\255\326\276\244\037g\025t\262|L\273+\343F5\205\332\252\036\035p\335\246P\220\330\335!\327a\364\250?\342?\374\215\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_resumeRxPwmPpmSignal.101.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*pm\032\003\240{\375\f\200d\002\303\370\300\232*\t\313\226L7'\033O\314\2041\275\252\212\300\211\306h\340\341x\027\365\3362\005W\0246%6\245\203\241h\310jB$E\370z,\246\214\\\327\224\223\267\032;\203$N\336\323`\304\274\0026v\017\013\035\221\365\355Z\276\322\206\002\240\315\257\323\331\217\324\323\254~*\024\017iwe\314h\2460[\225\243\203\215\323\024\n\022\273;\334\270\213\036\365G\374\207\337\n\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_setLinkQuality.102.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\355\002\235\025"
+	.string	"V\347\211I\300\322Q:v\020T\237L\345vJ\t\300\021\252\035\320]\367\f\276\302\344y\362\226\312\246Gi~\232\021\027\324\272dJ\246*\304\241R\251\257\221,\360(\n\305\301\005\027\362\227\024b\223`T?4\236\331F\b\331D\312\224\002v"
+	.string	"f"
+	.string	"w"
+	.ascii	"(7\t/\301\227\204\227V\265\r\034\260}\250\346"
+	.string	"\344Q\274!\2459y*\0260^\332f\3538O\304\024I\030\355\260\230\232s\2726\304m\027C\t\256\332\374\023}\205\313\331\\\344\360\020Ly\222!\325\023\204\273\251\334pP$\227\003\242\3149[9\035]0\345gI\203Hn\0074\271\361!\307\211\256<9\034Uq\301\234\323\212\313e\270\307\333\276`[\201\275\003\002\226\265\350q\227~Kx\371\225E=~\370\334\350\317\346\331\350\352\354\203s\201\354\017\375$\347\375#+u\210\252[\252f\251z5\252\307Q-\216\352pT\313Q\r\252zU\255\242\372'\267\3614\305\303\3457g\317\017\310\364I\244\022\241J\005u\355\267l\257\332Oq\025\266\363j^\315\351a\352h\316\251b\225\3612V\320\237\205\327\325`Z\361\367Y\030\262<!\206\016\257\205\273\001\204\232zL9Jeq\223\376Y\030\256\2104\023\256\004\341c\347#\367(d\301\2250n4\263"
+	.ascii	"\203\355\n\224\253S\323\320\3511\001\276&$\331\002BB=\034\273"
+	.ascii	"/\216\203\032Y\335\335\337~p\336\342.j1\261Xx\251+\336\244v\017"
+	.ascii	"\302\375\370vu\226g\t\277\022zN9Je\277\367\025,\376\2101\017"
+	.ascii	"b3\231\203\227\214K\214\201\314K\214F\233\201\001\210\315^\264"
+	.ascii	"\006\023d.\257\n,\303Vhh.\032\232\353E\366\232\271`\264\030\327"
+	.ascii	"J\211a(\304h.\031\030\030\232\253\305\233_ C\370\371n\026Gl5"
+	.ascii	"\325\240|wR\310\332\226\217\265bQ\220\235\017\223\224\252\232"
+	.ascii	"\212R\372\222\234Qu\"\212D\345\t\204\253\265#\274\3648\243\350"
+	.ascii	"\254\215\307]\355w\202\210+w\334\004;b\334P \330\345\234\302"
+	.ascii	"\325\005= \240\002\021\251;\017\323\003\336\016i\267P8\262\207"
+	.ascii	"\177c#\004\224\f\240\215#\n\004\b\256\235\270\001\022\264\256"
+	.ascii	"\361\254;5\2662\266\3711h\031\334f\024[?1\274\247\331YQ\314\300"
+	.ascii	"\016\316\362\2411c\334\020\rm\031\235\331\270\266Y\222E\233%"
+	.ascii	"\343\302\032V\344\024a\035u+@\201T\002\025\030\235\026m\017y"
+	.ascii	"\213\212\325,|\207\206\241|x\026\332\303Z\216\3021\24411|\357"
+	.ascii	"t;%\345\267!<\356\252\321\273\f\024"
+	.text
+	.section	.gnu.lto_setLinkQualityDirect.103.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \362\245\006"
+	.string	"\342L/3Po\322\001 [n%\244\220\017:\362"
+	.string	"!\305\230\305\265c.\272?\354\201\"\231\375\020\3222Jc\215\0223\345\026\363\253\252\371\254\274\345>\030;n\231R\035P51H|\250j\002A4x\250*S\316\346\202\357\202\317CM\016\217\003#\336FS\353\241\003\337\307\262\340\303dw\033\325\200\242U\264Y(\333Fk\200\377o\033\265Y\360\261r\245\374\030/.Wq(\036m\215i\233\331\032\304!\321\"\023u\277F\311\311\237%\364@\300.c\002\311.\255\221\354\032[\026g\035\267\311\205\005I\313\377\3278\034\235\261\366\210\007DX\310\031\260\360\277)\3022\334\346\266\bm\025\332b\001\007"
+	.ascii	"2\003\3169\003\027\016]\306#VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.104.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\030\007\335'"
+	.string	"\352D\030\017Gp\236Q:\273H\016\303`|\362*\033\334bBg\361\021l\036\2668\221\336\035G\234\314\036\027\007\373\217\301\227\221\2447S\007\206s\255\361PP\206v\203\016\362+nc\n\354\n\317e\016\036\374o%\237\020\"w\222\001\340"
+	.string	"\313"
+	.string	"\334"
+	.string	"\2269\006\277\3118\376\024\242Q\221yq8@#\343Rz\312Kk3_\310\341r\357]\300\r\326\247l-\363\271\336\025\343^0\330v\357\020..\3672\027\360\321\372\324\350\001\324\247\350y\352Sff\007\020b0\361L-\034\337\352q\004\313s/\323\327EN<o\027\004@\007\364\223\303\335lkMM\321\266D~m\202\007\"5\266 \257\212\347\335\210\344;$AF\216X"
+	.ascii	"Z\327\241CJ2:nf\245\205\"\225\021y\003\304\002)\377\243\374a"
+	.ascii	"s@\216\303j\372\2607\003Cr\364\270\255\207\201%V<\354Z\2330$"
+	.ascii	"G\362\265\035W\201\256\2164lz\f\273\275q5\303\242\311+\267UW"
+	.ascii	"T\266qWS\250\321\275\367fVX\326\326&\334{\331\"\257r\234{g~\t"
+	.ascii	"fn\301\254>\b\327\352\006\271\t\2166'\317\234\242M\263\367\336"
+	.ascii	"b\367\222\355\223T\001\375\346A4\305\250\254\036\326=\237\317"
+	.ascii	"\264'\251o\001\315\226\206r\212\177\327\322\264\336{#\360\261"
+	.ascii	"<\013\220\237\344)\243\b\332#\203\352\323\267\004.>\312./\243"
+	.ascii	"}23\247l/\231\217\336\316bN\262YF`\263\214\304\226\017\254\226"
+	.ascii	"\217\316\374\013\334\353/\272Y&\272Y\036\272\225\263\320jY\300"
+	.ascii	"\315r\357f\231g\263\234\373\2243\216-\337\330\262m\265\274\256"
+	.ascii	"\226\325\325r\272ZF\331r\327,[\325\362\023\334\271F\211\265\345"
+	.ascii	"\243\3250/\216'\237K\226v\331\272\225\177\312-s\030\337\311\277"
+	.ascii	"bE\212E\232\230\016\007;\025f\034\267\270\223uEg\023%\327S\334"
+	.ascii	"\323l\210\030D\210}\221)\271\354\030\355\323\206\326\222.la\035"
+	.ascii	"\267\364\307\216\353*\242\257\257&J\264\366\222-\372\261[\365"
+	.ascii	"'\2526d\372\261'u\225E\225nU\005\267F\366\364I\225\216\240\253"
+	.ascii	"\230\211l\201F\320\314\0314\330#\27176\206lF\027ki\237\341\260"
+	.ascii	"\201)\005C\326)j\264\323\376\313n\306\301\003\023S\353\216v\320"
+	.string	"\222F\373T{9\324Kl\250\254\2363\363\336\233\022\325\236\027<egf\326\241n>\231\213\021\371I8\204\b\021h\220u>\346\275\356~\330/(I\223s\374b{G{\311'\240\362Z\313\353\254\331\346\227R\205\232\327l\217\311)\373\344\235}\330\303\004\217E\353^\343\221`l\013\365\231\004\241\352\"3\217\370\027\022^l\377\312\027\340\201\203\306qV\255\234\202\001\320)8\364=A99A5\r\210\222\032\376\206\036\200N?\341\t\234\t \213 \260\t\330A\305\357\tE0\n\3507T\001\254\260\213b\002:\005?\f\237\200B\241T\323\01771p!\364\271\020\372\236\202?'_\2230\312\307\200\307P+\200B\337\020\nJ\350\3031\215Gog\261\rR\272\335)x\256\253\230\371@\033\031{\212s}\240\257\362z\311\177\357:\353\326Kh\267\266\331 [\333'\3156xl\335R\234g\224]I"
+	.string	"w\210_:\222U\242\330\261fU\302\324\320\365\222_\250H\026\216\r\"B\316\314\2249j\244\026\272s\354\263vQ\037\365\251\034u\202f\016\0245T\224\320y\035\030\024\226\226\324\247k\003\215\311\001\373)j\265e4\305\340\250]+sf)\273:\347\306\3020\351\214\202\353%\0075\237egfn\275L\363\200\234\250\221@'\215BB\224$\205)I\032\003\240\002\021!+\333\020XV3\223$\035L\307d=\235GS\266v\f\311"
+	.ascii	"\230\224\001H-\343]\rXA\227\372y\370X\024\327\370\266w\201\250"
+	.ascii	" F\020\262\024\207\277+\031F!7\020g\005\177\002\020\276\213\030"
+	.ascii	"t\315\003\316%2z\221z\002nt+%\266f)P\3144a\021\341\355\034T\325"
+	.ascii	"P\231r\004\326\037\004)~Q\376kKv,\005\373\213\224\2458\261\307"
+	.ascii	"\255p\267\3710\206\342lh8PA\357.m\005\345\375\305\371hrJK\346"
+	.ascii	";#\312\261b\022\322\200\335\315A\310\333J\311\005\371\205z\037"
+	.ascii	"x\222\221g\004olL\263K\252\324\362\007\241\352\342\272\034A\311"
+	.ascii	"`\314j\037W\002\362T\231\021\377\316At\271\325\033\367\250E\331"
+	.ascii	"-\377\223\247\3071\336\206\226\217\350\177\271Bt0\f\202j\201"
+	.ascii	"204\345\336X\302\217I\2529i{\201\256t'\240\253\224\263\250\203"
+	.ascii	"\332\256GcV\035\002UF\362X\355&\342\245\254\341\365\021 u\331"
+	.ascii	"\002\3560c3\262\232\207\213\026\r\t!\227\335\020\266\214\032"
+	.text
+	.section	.gnu.lto_getRxfailValue.105.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\234\003-\030"
+	.string	"\206+\230I\300TU:\300\230\243f\251>\247J&\313\312\204\300\b\026\304x\021\0363\210\232\357 \246\214\247n'\020\236\362\3676\2748g\266\n\334\254%\001\200\220$\220\245\322J\255)\370\243w\335\366\251\371\207\025\265\215\220M\210\334)\005\177"
+	.string	"~"
+	.string	"\206"
+	.string	"?\035\376p\237\337\244\353\362\243\326\232\272\rd\247l\357\264u\022"
+	.string	"\275\027\363\326\272SzR\253\017\201\r\224\037m\373BN\004d\331\215\b\032\355"
+	.string	"O\351V\304T\253oEs\033\372q\276\206~\334\032\227\275$\351(\356\224\371\263\227>z\340\310\037\274!=M\367\361C~b\342m\001##\205\356\242\210\240\275\325\250\315\020\322\rT\316\266\223\344\251\265z\342r)\356\323m\267\260\275\300\336 \001\265V_\305I\t\005M\241\355\326\213\\\247\030F_vD\265\006)8\021;\304\217X8\351@\201\203\nQ\255u\247\310\215`\360q|t\206\r\363\270\217\376k\277B\027\004\322K\355\367C\356c\304D\322MH\233C\333W\233K\303\376\016\207\3030\336\031\266\247g<-\343i\325{\177\312\323(:}\242\323\3458M\222\323\224N\3578=w\3724"
+	.ascii	"\226J\344n\302I\255(\206M\0258\006t)\350\206b~F\377\022\222\023"
+	.ascii	".h\200iC\2100\217\333\335\235\371Q\376\243\245$\340(\341S&\224"
+	.ascii	"~\322\225*\370\260\346q,\372QFl\322\205\271\223\233g6\307\354"
+	.ascii	"\200Y:\022\245\370"
+	.string	"H\373\030\217\313\223C\371\317A\035\235\027\246X\214~\334\245V\234B\377\350\255 \300\331\034\363!\244!)\313\304o2{\214\330Q\205\222\370J\034,_\200~\374\205*\317\312\216Z+\316\221\330\016\016\020\352j\235}\027\234\270\276\240\301\365\363\303\272\320\"\335\312\001\001[\201\200\255~0\2606\254Z\260\016\253\234\032\2778\270`+\017\257\027l\225\362\321.\326\235a\0016\030B:\303\302\210\227\203T\255\305q\017\303\366\"\207(\263\250%a\033\265\346\241mM\254\265\326r\f^FO\253\332\333v\004.\243\345\236\3666\036\26594\271\345\316.\f\236\305\245\3121\261\201\005H\356\177-\212\200\364\226\374F\213\n\222\356\314\376&\364\225\006\245_\345V\034<\350\351\241\037\003E\250Q0\303\024U\210&(\021\005\205R\311\030\200\002\021\"\263\033\0210\271\203\214F\013\2549x=YC\241\007\235\272\247\302\327\275"
+	.ascii	"QZ\264Vd/\370\024#\023\333\re\013\005V\302\264\027\177\2270\203"
+	.ascii	"\030m\215\336\037/\031=\004M\263/\366s\036`\360@w\303q\360d\342"
+	.ascii	"\007\275\373\305\020\203 \267~K\212\376\026\326\002G\301\200"
+	.ascii	"G\363\201\265\324\255\217\246P+\325C\033\373\243-9=@\3003\363"
+	.ascii	"Q\255\221\341\234\214TSk\025\210\365\023\254[3\002!\225\352\244"
+	.ascii	"!\013\b\373dN\350pL\005"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.106.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\302\001\375\020"
+	.string	"\026\241sF\360\356&\035C\007\312\265~L\347\334\305T9]<|g\210z\337O]\376\277\315\212\231\371\352\377\003\3556\232\326}\306\311\2334HP\346\2608\334;\305\243\244\020L\201U\343\361\314\206\036Zg\302Z\262\267\224)\005`"
+	.string	"W"
+	.string	"`"
+	.string	"\007\021\373g$k\354f`Q\264\273!.\200z\374\200\266}\236\177\210Y\226`\302lf@g\006\006H\306\356\347u<"
+	.ascii	"\367\230\367\340\036U\303e\207\2322\337\345\360D\263 \024c\243"
+	.ascii	"\271B\0027\027\226T6\032\3748\221\004s\240\247\214\255\226y\022"
+	.ascii	"\331]g\214\255\302\035o\333\201\355\007v\036\bp\365\306*\247"
+	.ascii	"72\235\372ww\377\3715\376\375'\247c\246aLk"
+	.string	"\2463\246\317\221Z\221c{\315m\227\302m\306&E\243\016\266\357\013}h\345An`cbgw\273\025\273{\314\356lk\210\373\304\376\323\"\240ck><E\273_\210\025\240\036\375\2412\355\367\00421\202\\\320\362\346Tr\024\235R\334H\\*\324\223\332&\021\3621\235\302\255Q\027\253\302\326I\250\"\330\320sM\375\013\230&\273.B\002j\267\306\300':\201\241v\3679\217~\013\367x\375\221M\211\245\236Y\336\316\204\3416\244\212\343\005?\351\201\016\3422B\311GE-\231\354\217\226\212c?.Y\301JTX-\017\305\325j\271F\006\220@@a\275\"\311IJ\213\005\343<\262byy,/\017\305\204\325\362F^0o\345aW\n\311\313Sq\271^^\367\315\016Wo\254z\3610s\232\027\035\016\351\313\270\2502\266\243Zd\2464\230\322\r\270csDS\022j\212-T\232R\347\013\f"
+	.string	"D\235\252\364C\0071B\021\037"
+	.ascii	"&jeb\343\225M\330\243\216\276\333\336\252\365\270\332\362>,\256"
+	.ascii	"\271|\347b=\267\231\262\034\210\007T\251_\202\243\251+Eu\214"
+	.ascii	"[\327\205\321e\315\035\033c1\250%4L7\215\361\200\r\320\204M\241"
+	.ascii	"\203v\001)\001\247\252\221\347RP"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.107.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\027\005u!"
+	.string	"\366<\325I\220XN:\t47\020\273\361\231\275\302\313\312\231\374\217T\375\372\036wh\374K\0059\244\220\2611\027\216*\355\337\\\005\260\276\345f\353\r\261J,:\220\001|\002\200\030\241"
+	.string	"^\305,\211\306\223\n\177\333F\b!\233\310\235d\277"
+	.string	"\267"
+	.string	"\312"
+	.ascii	"\367\016\025\234\267\001\352}\360\211\377:X\372!\033\371\215"
+	.ascii	"\272O\021f\013k\355\336\273\340\226\021\234\267;\037P\336\222"
+	.ascii	"\027P\3362\243`\276\335\326\033\247\314[\b0]%\007[6|ba"
+	.string	"\356\275\272\256\301\247\315\311\341\031W\323\317\340n6\3644KKvM\371=N\316\250j\362\003*}\2064\231\236p\034\nT\025\3313f\355\354\304^\305\321\210z\361\033\325mT\007r@MU\364\300iF\220\021%u\223T\260V\004\314\241@\271 \007<\341\370\371j\031\274\265\001\203'i\200L\344\316\330\253\023p\251\366\211\337\260\205\325EF\324\213W3\302\275\227\353\017\030u\24693\177a\346\016\314\344W\266\205\\\364!F\027\253r\357R\0173\320\315\202 \\\335\273\364 \310\205\b\361o\334\262\b\242\372\337-\237\250\274\265i\364\214W\217\217\202\345\007\031\331B6\317FJ\264?\366\004]\204\200\2051Y\252c\272\210\306\004\354\0262\017{\265\347j\314\032\267\025\263N\216\255r\016\347\006\255l\203V\256A+\343n\027;\333><\243\266\362yV6\315\312\245\255lme\262\254\334\266r%+\337"
+	.ascii	"\016L\026\340\247\324\356}:\222\271N\354Y\326\305\376\341+\363"
+	.ascii	"\331\304\213\234\223\206\204\357u2\024/2\b)\265\035\367\336\333"
+	.ascii	"\017\376X\330\201\244\027;\361\373\273W\272\332\342\261\026T"
+	.ascii	"$t\223\253_\321\247L \201\\\335{{\242\\\n\205\n\026,\224\267"
+	.ascii	"\271>\3311\220\211AD\013\255,hk!\227]\301\363\246sM\\i&N\333"
+	.ascii	"\032\034\355&\232q\2051A\013T\262_\374\023\037\007N\272oz\207"
+	.ascii	"\251\225\030\327d\327/>#_xZ\206\363\336\373\200I7J4\263"
+	.string	"\202\341\305U\253\306\2122g\256\326~\331\225\020u\031\025R\254\370HR<\022\037\236*\367\362\376\343\0379\232\006\016>\365?\237\322\303\207\372\037N\3574\265\022\343\272\366-\214\212\213\317\030\314\002\303\302l!W[\323\2711\035F\322\246q\355\364S\276waW8\304\317~\316\"\357\2344\251/^=\222%\3325]\313\370\214\274z\254\001<4$\"I\250(\311\bhDY$tt\0044\024dr\020O\211\235\256\304NwD\004d\244\013\332\215\320\361\b`\244$\241\235\216\004\022\322Nw\033\362\336V=\376\024j\\Nx\335\233i!\003(\273\351t_\251\013\216\266\023\237=!\315\354\263\3573\362\265|K\212\305\277\301iV\252\245U\336\2326(uD\214\013^=\236\207\275\223\367\336\213k!\177\354o\321\324\265\305\226\323L\242\266\27618\332:}\342\177zS\\\232`\364\352\221\313f,\351\026"
+	.string	"\276\225_Iu\244\\iW\375/\355*o\377\363r\353\262izUCn\bj\256m3\247^)X\375/\307\326\226\\\"\245\326S+\032O\366a\250A,\304\2203H\021\222\221@\210DI:`\002!df\035\021\260\275Dc\n\222\346\332\361N\273Y?\232\276\rn\312;\256\331S+\316k@\213Y\321\203"
+	.string	"\347w\267i\231x,&\241\266\222\260\304\202\030\232d\322&-\033\221hG\302-\207l\"\233>\036:\202\320\306Q\206\306\306\031\f\202z\332\327\270\2173q\273)\203\227]\035Dq\272\"\006\336\354\220Vj\362\027T-\350|\337ID\366v\225$`\323\354\343\221\261z\375\343\273\303z\255\247\b;78`d\016m\221:3\220\226\232\376 \212\177R"
+	.ascii	"a9p\252\032\371\035\246\336\200\021\226\256&\002#\21474\377E"
+	.ascii	"\376-\366$\031\034\306E\fui\033\366@\360\363\f\264\036\323\303"
+	.ascii	"\024\3566\205\217\n"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.108.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\024\013\005;"
+	.string	"Jc\034\026DP^R\007\357<8\317\211\267O\213\240\274 Mw\025@^\024\236\303\237\347p\bI\005"
+	.string	"\2633\033\373\021\234\336\306\245\326\021\200&ci"
+	.string	"\b\354\202\251\334\277P\027b\273\263\252/\017Z#{\357\235dJ\001R\0017\001W\001\307\326\245\355\323\270\266#\260%\205\235\356\364\371\007\215 t\266\273Gw\321\331w\270.:\324\243\257\277\371p\330\013v T\324\330\364\301\260\224\311\3316 t\226\200#[gW?\266\316\276\335u\224\\0\226\223\332]\027\227?\030\206\227\377\004@\027\371*\365F\376\353J\002\002"
+	.string	"HBR\036%\221F\307\"\242!!c\020P\2218\024\272-\273~~\333]\250\225\f\315\016\323\211\345Jo.\340-\232\003@\251Y2"
+	.string	"'^n\236\344BQ\375"
+	.string	"\232\024\3326\346\345\346H-\031\224<\250+\327\006}c\366\270\225f\333\212,\"\205\351zM\266|\3246%'W\227\253\210\024\327kJY)\364\351\253\363\251XF:\361\212\342F\3073/\362,4':\203\222\207\210df\3224\027r\241\306\274\320\334\270.\3515\315\326$:&9\310J\363\231\201\300(\311E\275\346\222\225"
+	.ascii	"]\222Lt\241\246\316\222=\377\240\200c^Q|X`\314+\314\205\256\327"
+	.ascii	"\f+`\245\t\226\335/o\327\006\3175G\214\316\256\025\331\206l\316"
+	.ascii	"\217\314\"\361\265\350\334\342\312otn\255\004`\030v8\317A\234"
+	.ascii	"Z9\273P0\fwf:\275\274\007xw6\321\335*\272\207+\002x\374\331W"
+	.ascii	"\332{\262\351\022<\032\341\372k?\356\2742\271\223\\\364\371\016"
+	.ascii	"\034\351\203,p\025\355\3720\246|h<\215\212\025,X|\2120?\300\226"
+	.ascii	"\375x]\277\254\214g3-\362?\235y\200#Q\266\377\270\257Z\377w2"
+	.ascii	"\255n\345>\335^\347d\256\332\323\332ETvfT\353\254\377\020\213"
+	.ascii	"Z\366\214\202e\345\301\016\312\3351fdg.}\202\037n}\200}Z\217"
+	.ascii	"\325-\325\312\037w;\005\263>}\375e\335\303\334\030\204\271/\020"
+	.ascii	"s[\250\360D\314\355\324$a\230[\3010w\002\177\363^\032\346F\362"
+	.ascii	"0\336J\237\363>\3628\357\244\233\033\331\3466\032\346>\266\271"
+	.ascii	"\213\334\334D\304\334Cln!6\267q\230;\250\315\r\344\346.\ns\023"
+	.ascii	"\205\271\207nn\241\233\333es\267nn\266\315\275\262\2713\233\333"
+	.ascii	"3$\341M\367\266\250\341=\034)\\d0\020\316c\353\246x\030\3679"
+	.ascii	"\3678\3677_\273\235\332E\342\024M\372\305\301\344\360.\355e\302"
+	.ascii	"\376\260\345h\327\342^\272\213\335\303\2734\353\244\006>\241"
+	.ascii	"[\332\351\270\270\334\353s;\034f\302\216e\246\366GA\350\354P"
+	.ascii	"\366s\202\271L,\t\364\370\361\037\277\"&\307\246\307\217j\267"
+	.ascii	"V\3641Q\362Y-e\246L\357\030d\005\337\375Ny\253dg>\035\305T\221"
+	.ascii	"\344m=V'_\301wf\342q9L\240T\207>\0262\030\370\204\177\314\235"
+	.ascii	"\f\312WFh\370}\3365\004f\200\254\035\023ON\363w\255]\372\341"
+	.ascii	"+M\231\330\371\361\324\312\203m|\325Z\f\331L\310`\233<{k.<\206"
+	.ascii	"w\375\210\277\364\027\336\275\370\252\346\244S\204\217\034\025"
+	.ascii	"-\277wM\230\307\365\274X\336\266\327\355uk\235%.9\251\201+\221"
+	.ascii	"5G\340\202>n\013\337\364S_p\323\273\250\337\351\263\360\305\254"
+	.ascii	"\300\266\267\276\343\327\246\f\350\343v\372\246\377+S6\016\246"
+	.ascii	"_8\257\243A\b\303[O\355s\234\316\006\016\035:\264\316:\275\203"
+	.ascii	"\361L\375\202>\243o\276''\216\256\310\344H\337B\210\240\226<"
+	.ascii	"{U\3417}\266#\341\325\021\3028\316\347\341\003\b\020\255\263"
+	.ascii	"\302w:g\200E\315{F\353~"
+	.string	"\356\f\227\223\370\261_\265nD\340\b\343\303\246'+\017\016\335\007\276\247\327\276\373\336%\230\225\007\363\332\307\300\007&\374\270]\215\257\377N\252\332\224\317m\007\2167\342)\016\f\303\024\332\327\370]\211\3664g\373\004\n\024\314-\003\202\r\0323n\\-\251\252\246\246\252\242\222\244h\324\230ra\243\245!EE\345BF\224k\003\204\324\324\f\0237\250\244\254\254\256\242\202:\n\202\016\253\245\016\253%\325\f\027S\313(+\033K\b\307\256\252!e\265\274QUe\265,J\263\374\313ZX\365\223\227\365ZJ\310\007\313_\356\035\204\214d\204\360\b\362]\356\254N\200Q\3662z4bxm\001>n\t\314$\t\317BAbr\245\362\217E\177l\026\275\202G\213\233K\003@\371\022\376\205\026\332\034Q\210L$\017y:L<CO\304 '\030z\247\372\361\257\232G\371\t\276\363\007\3021\273\222\302\200\344\354\372"
+	.ascii	"\373\374\215\003\321!v\206M\317R+Z\2074!w\277K^&\331\231\355"
+	.ascii	"t\3254"
+	.string	"y\3038\372T\n\275\013N\253\313\334\372K\326v\277\361\373$;S\350\375\253\311\326c\035}l\374\027y\313\370\016\347\007\234vi\317h\362\343\026\362bT\341\277:d\362\344\007I~\320o\300\003\372\240\367\234\245\342=c\001\364K|`+\f\3030\362\343\344Wx\237:\373\027\306g\nG.\033}\334\036g\215\331E%zz7S\373\353\242\032\233\376\350\203t\027?\303#\220q\006=\240\2018\372\342\363\020\243N\341\004\200\347\250q(%\231S\204FDD4IRh\f\200\002\021)\262\342\006\021`\251T\020\221(\031\306NM*/\273\237\030\311,\204\310\333h\365\036\316%M\264\2142\th\351\212\375\253\006\236\311\323\365\272p\357@\212i\363\313\343r\"\351*M\n\361\235\201\3238n\206\314\316b\0204\327\b\252\024\30543RE\017)\0014\250%e\274b\200\263k\255|U\330\\\300fo"
+	.string	"8\005\237u\202\331,\302,`\202w\361\330\f\301\263\374\215\f\274\351\376'a\345)\2430\316Ud~.3\223\260\332\216Y\262!\330\232:\254E\303\335\210\r\255\337\356\317\315\032\372&\021\035\034\257K\340\366\205r=\300o\346n\203\317\316\211\216\3079\005\377JM\334D\302\035\033r%\t\322\344\002\231#\215"
+	.string	"\013\024\311\377!\242)h\032*(@\345%\376pj\013\350n\247T\340\231I,l$&WJ\021\226]\340\351i\232@5^+\220\204`Yv~cQj\356\213=1\226\215\273\374\fK`\230\\\377\003-*o\371\247\215\357^\0062\346\206g\227\215\361\203L\312\223\212\2575\370\237\207g`\352<\322&Z\310\017\316\034\316mR@\3214\362{\220F(\376_\034\333\r\341\243\253U\362ig\205k>v\310\207]\304\337\034Gv\r\2238\n(\001\026\303%\271G#\300TF\265Z\217\257\222(\277\271\240\335\253\tr\t\364g"
+	.ascii	"ZF'\312\362%H\243\031&\247;t\240\223\337\274\262\262\355,\265"
+	.ascii	"\226\036\250\017\320\213\002\032\035[\367/\302` \t[\301\242G"
+	.ascii	"\350\272M\0349\002A\235\377\325\322\227\022\363x\345}\007NTb"
+	.ascii	"\274\352\233\262\345\300\273\322alq\273\355\300\177"
+	.text
+	.section	.gnu.lto_updateChangedChannels.109.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\326\002%\026"
+	.string	"&\352\221H\300TU:X\007B\3364\271\177\2736U%\335\rd,_\230.j\025\22197Tp\246\211\366\027\206\2722^\255\266W[\013\003\323V=\213 \004"
+	.string	"b\306\267!\223\335\260\203Z\337>F\035\245\373\246\t!{\313\235R}"
+	.string	"t"
+	.string	"\201"
+	.string	"\030\352-(\341\211!T+\257\345\324\005\304S\002g\001O\347U\300S\277l#\001b\025\007\001\317n\326BI\255\325\264\036\\\372\344\335\240|=\004\351\\\371\362w\237\270\020=h#\316\303\031\306tD\240\214\263\t3$\344{\357\2626\302$(*\261s\252\341s\262\374\300\005\241\214\261i\340\266#\303h\254 \367\275S\234\356\2076\356\\\206\nj\255\226\264\021\303-\336\366\005\333\t\354\335\276\356\324\023Z\362\264S\277\005\236~\337\373\314a\003\262\304\227#\177\373\342'6\356\346l\036\216\204\3710$\344\345`\257\224\356s\223F\242)}2\245\305\225\016\2514\370\236\233N\351\271\322+\245\245\224>\013"
+	.string	"\023A\343u/j\325\3711\251>\250o\304}\376\236K\373\366y~\317\3078f\205\261\200G\006\211Z\353\001\361\364\337y\344\247\270\212\327{\\\257\001<\300\r\375\032\267\221\362u\226\241\241\001O\301\375\216\r\b\212\r9\362\367Yk\255\340\346\374\336\177s\001Tc\226\326sG+\332\232\355r\322\256\354"
+	.ascii	"\230\356Gv\203\311\237\244_\0326\002\204\314P\301\351\216\320"
+	.ascii	"\220\214vni\267\310,\003L\376\274;\367\263&\244u\371ni\205.\210"
+	.ascii	"\214\tL\352z\004\201\230\233\263\334/k\305\220\nr(\006\214\b"
+	.ascii	"rM l\bwa#\326Za|\026o\261\n5)\225\3524\203\n[5)\225\3524\023"
+	.ascii	"\363 %\243:\315\240R\214z\271a\231nX&\025\315\311\306\204b\265"
+	.ascii	"L/*^IH\261L\024V+\226\211W\277\034\354\t\216\226\212DN\370\310"
+	.ascii	"Y\230OV\307iH~\027(\356\311^v\303\341r\200\022\267\201\255\b"
+	.ascii	"\n\272\276\3577\\'\024j\367\231\304\026\264$\334\234Sd\320\225"
+	.ascii	"}\357\f\200:\310\226\223\266\346IE\373\335\257#\003\272I\337"
+	.ascii	"\005\216\266F\332pc\0025 \220\002\231\301\262\r\275\"\330\301"
+	.ascii	"E\254\007\031\\%\017w\346.Z\b\031\276a\b\255$\b\227\013\350\311"
+	.ascii	"\372d\033\207\rb\\\025q\003\216\t\216\365\204rX\002gj\365\227"
+	.ascii	"%\316\017kl\264\367\306!%\227\231K\353\357\362\223]\b>6#\213"
+	.ascii	"\365 rw py\273\312i\334Z\024,.A\202\223\371\2763\364?\210\n%"
+	.ascii	"\310\027L\021o!\022HV\355\225\256\327\324v2"
+	.text
+	.section	.gnu.lto_rxGetChangedChannels.110.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`i\001\265\017"
+	.string	"\226\235kG\360\260(\0358\005\336\351\342v\3779#\214\3138\3003\373\245\315Il\265{\314Y\232\367\234\215p\364+\325\335j\231\331\307\032h\366\024u\313\317dN6\0322\337l\036\021>;\374\370\004\001H\266\212\366\t\331r\247\024Z"
+	.string	"O"
+	.string	"X"
+	.string	"\240\003\027+$\231y\221\241\346gW\364F.\322\235\233\017\351\316\351\207\203\347\246J\320\007\265j+^\341\312\271\217\220\303\347\034i\221\243\303(tM\002\263\226\031\242\220E\3524"
+	.string	"\343b\303(lM\221\235\230\236\337.a\241KJ\320\202\335\265|\205.ww\333\017l+\260\217\0236\350\342\337\335vO\225V\225\226*}\017"
+	.string	"4=\341C\214\273\032\306\035\253\303\245\250\335\366\333+\377f\221o\003\277.\373\226\237\031\036\033\273\342\201sF\020\222\322>\315K\254.\252\036`W\306\342\304\256\230\300\005B\347,\206l\373#Nb\345\254\271\273\313\341T"
+	.string	"\351\027\303!\342\205\365YlG\305\324\013?\330]UG1h00\300\264$\n\237\035\017\252W\b7\032,R\307o@_\306\026T\362\257sR\005\200xy\315\007\206v\3672\276\252;w\355bh&`1\226\034mqE\352\314\276\216\3438Ze\001\251\023\323\351D2a\020\301$\341D2)\201\230PH_\203\224\024\351\304\303\245\022\225\317S\371\274\323\004\022\212W\372R^I\210Q\024L\237\227\202B}\236H\334\317U\231\273\034\031\nr\222\256\313\261\231 \035`\223C\223>\330M\205\331\236z\235\032>:,mY\252\344\371h\325n^7\002\034"
+	.ascii	"\016\013=\266\340\235[<\224\035>\231f\300\213\013\013\200\034"
+	.ascii	"\\\226\206\021A\006\230\3451\241\215jTH\260\302\026\320\230\334"
+	.ascii	"\323\354@\265\314\005\301[\246\263f7(T\363\251s\320n %0\346\335"
+	.ascii	"Q[e\006"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.111.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\233\001U\017"
+	.string	"v\235fE\360\260(\035\320\215\224c\034\303\303d\275)\233\346\340\223(c\357z`\316\374S7\315r\025\264{\241\353\266f\312\251\317\033\342\354\257{#g3\303\023\331\023\260Z\330\340`a >\320HX\343M\357\275\245L)S"
+	.string	"M"
+	.string	"Q"
+	.string	"\361\360]$\036\332\266\211\201\224U\3578\274\002x\350\341\"\313\261\333i\272\341\252G\3704U>\b\267z\374T8|\004fvbB\\\2047\302\223a\006\f'!_\314U\304\265\036\311\356>\347\371\302\265d~\234\354\256\323\305Q\270?n\233d[\263\317#\334\213\331\f\216\005V\366\330\335*\265\306\376\333\335\265j\260\017\373EN\203\234\216NC\247\237\323\252\351\207\230l\274`\270\337\340\330}\365\314\026\006tqc;e\207lg\332\017q\234\324a\020\f\332\305 \203\305nW\300\002>\207$\037\t5T\237>\205\313\205P\276\373\t\324g\227u\227\211T\325w\240i\351\312v\203\353\224>\273{\300\227\275\304\311\2679\364\003\024*\036\246~G\206\004\bX\356\356J\255\212\327\005\261\030\255\334a_\304G\250|\033\253\254\344]\207\376J<\274>\347\003\002\250\004\244\022\n\202\024\023i\333TF"
+	.ascii	"<*a\3314\226M3\241((i\243\r\245\225\210\370\344\200\264i)\247"
+	.ascii	"\323\246\205\272\375\203\3603\3730Ag\305{\354 }\261\rR\237\260"
+	.ascii	"\264%\206\244H\355\021)\357\202\372t\325\342\006\017\r\324\232"
+	.ascii	"\330\243\n\006QMdd:\336S\024\217\206+  \260\002\241\200\254\007"
+	.ascii	"\340\2007lM\302\0052\210V\340l\31396\217yF0\016/\203\016P\213"
+	.ascii	"\024\025\004\t\230\210\234\217q$\355m1\266tB\220i\004\221B\224"
+	.ascii	"A\003\224\327\2242\3604C\304\347\253\027\315R\320%kl\327*\003"
+	.text
+	.section	.gnu.lto_parseRcChannels.112.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\303\002\375\025"
+	.string	"\346\250\217K\300\322Q:b\t\321W\215\302\314\030e\002\022\216\314\362Q\317m\357\005\"H\341\356`\273\207\254l\341\354\222"
+	.string	"\366ZSC\r\311\354D\273_`\354\024\024\205\221E!\340(\rE\216\231,\nJ\331\336Qy\331\2154\262\211\334I\006{"
+	.string	"s"
+	.string	"~"
+	.string	"\035l\260\t\312\327\r\276"
+	.string	"\371Z^\204|\335\332.\324\203\2756\360\363\263\t\372\321\335.\036\261+Z{\271\"\353\310\264\266\007\372\270\373\351\320\2354/\307\025\016\207\304\2278\200\030Q\250\244\220>\274\321\025"
+	.ascii	"\0239'?\274\222t\267y\342\3508\212\350\0241\265\316\334X\302"
+	.ascii	"tb\347\304\323\233\263\206\362\207\257;\337\224\356\3149]E\350"
+	.ascii	"\356\245\272\263\303\227\365\335\r\261\273\017vi\216I\270\223"
+	.ascii	"\231\267\033\244\241(=*\250e\236\335\326\203\177\310\205\276"
+	.ascii	"\346\201?\353\302/I\322\255\225\3568\322\345\221.e\272\027\020"
+	.ascii	"\240\307\206\363\276\250n\234bU+U\244\022\027\372\205\273\017"
+	.ascii	"\332\023\327\024\362\371Y\341\240<\213\375p\315\327\335\025\316"
+	.ascii	"\f\350\245\376\231\342\007(\325\035d\360\272'\345\353\315\335"
+	.ascii	"\245A\231\247\005\247\273\377]E\355\300\231\023\350\346!:\352"
+	.ascii	"M=2\344\353u<(\217L\332\260\tb\273\214X\031\203\231\201\260\230"
+	.ascii	"d\312\007p\374\214r(n\264\270\027\001\364\371T\346\r\035F\254"
+	.ascii	"\304\350G#M\373D\276\232\234AX\243\206R\235\002\253|\354\030"
+	.ascii	"\231\267\237!Mf\240\033;\241S\r\245\332\020z\376\320\213b\nz"
+	.ascii	"\335\271\353\366Do\001\033\337\363\272\026b\344u1Rv\201^g2\t"
+	.ascii	"\216i\266\362\371\304K\330\371\2126Al\264\310\3040\177\275\002"
+	.ascii	"\254\305E\226B\233\2251\030^\\`u_&\264\231\2136s\271\300Vb\256"
+	.ascii	"\327\f\306e\"\262\262\027\226\231+F&\233\271\314`\237y\200~\r"
+	.ascii	"Q:J6\276I\225\314[\226\023\331\342\352DoT\310\312)\373\0273\225"
+	.ascii	"\262\362\350\342f\307F\213\037\273\273W''\271\305\037~\202\320"
+	.ascii	"7\225\363\271\321\"\365@\216\274\273\264\323\240\200\240\327"
+	.ascii	"\335(\273+Oz\225\335\r\341u?\243\205e$6 p\002\231\"4\017\341"
+	.ascii	"\300\357;\332\006\202:ze\002\013w\236\312\016\232w\367*K\212"
+	.ascii	"\260\003\265I\377\221)1\321\205\231:\354\360X\252\270\3239h\263"
+	.ascii	"\3048\353 p\244CC\306v\241\301\013\026g\212\035\306\0035\234"
+	.ascii	"\330btY\016(\tw\233>\340\\\346p!3b\362\200B\330\205\3042\r\213"
+	.ascii	"\373X\255+37\300(\335\275q\327S\f&\\\360}\b\227/g/\2333\265\346"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_setRssiDirect.113.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\005\013"
+	.string	"&\225K?0\247*\035P\034\370\203Y\3741\016\325Fx}\313-\205\r\"\241\352\352\302\274\360AV;#\2645\254"
+	.string	"T\033$\032U\347{J\230\bB\224`\001\262Ks\f\324\275\263\025\177#{\357\235R8"
+	.string	":"
+	.string	"6"
+	.string	"\030\356\325\241m\373X\262\f'\0026h\tv\267\233$\017O\247\f\375\003\261t\372\361\231 \236hfw?\273\344\020QRV6\273k\231\022=\356z\333\023\266!\354K\004\322\257  h\211\177\335v;n\013\226@\035`b\373\027\333s<Jx\331\310\006\273#\006\034,\257\031*\245\375\327a\341c$\327]\021Xmw|p\203\345U\341\013\334\253|[\232\223e:?-f\005PR\201}\332SF~\313`H>\365\352\207\270\327\317\317Nk\252\003.\020\223\274\331cIN\226}\272\273\353\271\262\037\373\353e?\245\001\035\316\027\362@\316\003\202\024\032\235O\305\034\215\350\353D_\367\361T\\t\234\017\3544\030{\030\235\257\313\360\274\257\273\214{\272seoL\363D\353\364\001<"
+	.string	"\311\003\201\270\327\b\225\315\025\"w\003\023"
+	.ascii	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341"
+	.ascii	"\026$\027\206a\030\r\204\017F\301e`j\264\270\313O\265W\224\272"
+	.ascii	"\255-z"
+	.text
+	.section	.gnu.lto_setRssi.115.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\361\002\205\026"
+	.string	"6\253\223I\300\224Q:y\376\317\244\324\375\003\260\016\212\315\021+*Z\267\217o\245\037\022\221\301\334%W\361\030]4\254^\2576BO\177\314\f}\376&\344{\374k\b\022!\bA\005]\"\202\332\270\241\177\343\333\377%\237l\"eJ\001|"
+	.string	"q"
+	.string	"\201"
+	.ascii	"\252\313\253lo\357,po\241c\324\234\035x\250\210\227)\240\252"
+	.ascii	"\375\024W\201\373\212\233\345\234\034F \315\331#`\001\342\245"
+	.ascii	"\353\261\360R\017\013/\215\263\207\274\027b\0020\261d\367\002"
+	.ascii	"\311\234S\266 \216{(\301U\234\277\3630\305\373\271\024\177\016"
+	.ascii	"\202,=H\204Z\274\036p\305\264\363\241\342\361\350\266x#\2302"
+	.ascii	"\347\274\357j\201\247S=\265\3149\255>\274\f\367\351\266cl\027"
+	.ascii	"\260WAF:\276\bK\250\321\373\\\3725\341\345\367\276\203HA\277"
+	.ascii	"$@9\375\331\275Q\227\310>8\347\234^\017\366I\035\023\325(\241"
+	.ascii	"\032\246\352\227\252OD\265KT\233\210\352\226\252Y\252^\235\324"
+	.ascii	"*U\247B5J\325\342W\374\362-~P\325*\325\017\320\372p\304{\321"
+	.ascii	"\2219/\374\224\314%\2314\302\366\375\027\207\201s\027F ttb\316"
+	.ascii	"\251\272\264q\354@\200X\333Z\255.kUIGb\324\237U\273\212\360\244"
+	.ascii	"\2338\3474\340#\335F\003_\304\245\035\300\300\204\227\252E%\241"
+	.ascii	"6\265\3375}\306i\304\310\314f\341%j\017\343\240\221\240#I\200"
+	.ascii	"\344\352\246F\243\030?\322\260DD\262T\\\033\002\215\336\307\367"
+	.ascii	"\275\205gw,W\\\353\256)\247?\226\037\0330\200Kdy\235\020\334"
+	.ascii	"\373(\341\003\302\243L:\347\334\331%2\270\337\007\276 <\312d"
+	.ascii	"_\306\0033\263\332\r\315\026\316\334L\220a@c\263\325P\236\255"
+	.ascii	"\344\324d95\031\005\032\231\032\331\254f\223\255\300L\2530S\223"
+	.ascii	"\331\320h5\231\252\227\373zpKn\3070\266\376\322{\334\022\270"
+	.ascii	"\270\204\227\367\375\200\317(\006\312\306\366\240kQ65\026\341"
+	.ascii	"\3205\301v\307ka\2533vM\267Rx\262\257\005\205\354\200T\236\332"
+	.ascii	"\223}\215E5tC\243\216[+D\016\233 %(\204\\\213\343>EL\266\265"
+	.ascii	"\256\275nh\274q\245\001\013^^\302K\223]\0057 p\202\231Q\325\r"
+	.ascii	"c\001\253\315 \\\215\221\313B\325\021\253}qs\213\237#\370\201"
+	.ascii	"\364\201\023\030c\231\265\305\\\325N\246\353\363\027\001\363"
+	.ascii	"A%\356\205D\267\214\257\f\301\016\316:\240\233xha+\374\030\327"
+	.ascii	"\310\275\345\365 \337\2535\234S,s\264h\004,\304\254@\033\245"
+	.ascii	"\013\217m\231\304\"\241\n=^\250\205\332\317\031\026\"\344\336"
+	.ascii	"\333\317\250\227\201\355h\020\227\364t\377\366\324C\261\265O"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_setRssiMsp.116.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\016\001=\f"
+	.string	"\366\225PA\020o\234\016c\001AbUG\220P8\3520\033\370p\320\027PT\363\367\354\200i\007\262\323\"\343U7z\354\036P\370\252\343\006\006RT:"
+	.string	"P%\267\223\035"
+	.string	"T!\325>j\300O\233l)S\n<"
+	.string	"="
+	.string	"?"
+	.string	"\226r\270\366HAM\315\2574\025\256\333\036)\027NA\004\035'\017\323I\200\032&\245\025\035\t-\\1\035\t\016\330\335\207<'t\034\231\225fw\235\\W\341\256n\333c\273\200\375Op\325\243:\310\0375\235\232\276\005\343\341Dw\023/v)\234\310\330\022\n\005\b\333\277\330\316\264\017$\320\016\022\301\272\253\301D\262\373\0310\001\312)k\266\213\177\0356\200\311+\2218\355n,HBl\240\364c\304\263D\252\200\024\031 |\026E6\336\310)F\356\356\246\316\342\265\201H\013R\232\330\027\361/\363?\030\202(\317\235\362E\361\324u\343\215\2300l\344\211\375m\251\037\366\003\236,[\020\312\024\210: \2139\231\021f\2150\013\344a\360\2618Xfe"
+	.string	"\370\nu0\353\301ua\326\345\333\303U\017\n\f\025%\033\312\021+Y\251}9\310s~\3105$\335\034\265Rgi\206\003\033"
+	.string	"3\241o)\360\202\257\301^\324h\016\r\217\003\2364\020\200\340F\345\024\016\222A%\t\002\266\025\177@p\210\020"
+	.string	"\207"
+	.ascii	"]\303\027&0\251\272O\245\306\tw\037\214\262\bc\2011\212\252\261"
+	.ascii	"]\245\f"
+	.text
+	.section	.gnu.lto_updateRSSIPWM.117.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\212\001\265\017"
+	.string	"\246_lE\360\260(\035[\030\372 \300\227<\264\223\\\225g&g\231\324\307\374\302\220\305\262\344s\246\305\265\363%\263VG,v\272\265vj\031Tz\r\241\374\201\345/\033)\274`\264^\223\321w\037\325\265~\333{K\231RX"
+	.string	"P"
+	.string	"["
+	.string	"\036\371$^\302u\234\312[\021\246\333\210\230\335\3758t\202\320\341\200\027\210\207y\217xh\227\355c \303\276@n23\233\033\273\333i\210\273\3764]>\3104s"
+	.ascii	"\264\332\353\357\303\225T\213=\004\273\373\232'\207\232,\023"
+	.ascii	"d\332]'\255\346\341\206\267\355\300\266\002;I\001(\361\360\372"
+	.ascii	"\030\033\f\0348X\346l\232X"
+	.string	"\252\213\375\267\273km\261cZt\334\035\202\351\370\322\360\245\337K\353K\247\246\037\200\004\323S\373M\213\335\0169\035\273\003s`\216\373\355\373&^c\217\234r\032\213l1dvwth\247\330\243\303\177&+P\243.\230\375\020HP\356\343\002p@<\267N|jO \311\323\240\276]\321\227C\372T$\343\306\206[g\241r\200gw\033\370*\276\342Tbb\022\017CJ\232\221Sz\252j\334\241\001D,s\276\246~\366c\324ST\b\355\312\030\370(n\223\362_\016\255B\311\323\016\375(\026\013B\n\303\t\310\247Rk\325\265V\235\005\024I\252;\255X]\311\303\252\223\222UwA\245Zu#\032\330\337j\313\314\277\241Fn\007\246\261\027\325\177q\235\007\021BB\342!\b\213\317\315\226\273\373Ruq^$\212\224\302\t\032\262\314a\037\347.D\374\027K\030\031\211\207\"}\315\037\016K\317-\032"
+	.ascii	"2C\333\220\200yw \314\332KUsX8\bw\376\366\247<\326\210\007\257"
+	.ascii	"\256\335gX\262\262\344\324r\227\360\026`\234D\236L0&S5P]\360"
+	.ascii	"pe\371\300>\340\362\001\313\213\252\261]\245\f"
+	.text
+	.section	.gnu.lto_updateRSSI.119.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`M\001\255\r"
+	.string	"V\230YD\020\221\223\016\267\314\021%v\r\027\321\\h\255+\227\373\326\356l\337{\277\271I\bh\006{H\0051\375\304\022ts\343\026\201\331[0-\251"
+	.string	"\216"
+	.string	"%\005"
+	.string	"\356=>^V#\200p\027=\261d\357-S\nE"
+	.string	"E"
+	.string	"F"
+	.string	" \326\2455;uS\207\025P\2321\341tcw'\344p\3552B\325\374\350\002C\325y\333\345\265\362\370\231#p\251\251\351\274\225CN\305\n!\331x\370\360$@\345\220\354\256\265\363,\334\326m/\260=\355\203\b\362\360\003\203\215\022\313H?\333\304)\334`\037~\337\207\303\360\305\276\314/U}N"
+	.string	"\0310\336Y\250v+|:\026%]|\350\330\276\332\027\361\021\332e\"\330cWC\210\026\273\246\003&p]\212<\304\272\214\017\235OsC\003\305\301\315?=\213\201\332tu\222\r\351\005T\341\257\210\253\230mA\341\247p\352\322\213\336\262%U\214\375\023\266S\003N,\273\3333h\267\006DTt\207}\022/!\362a\f!E\337]\372)\326\003\231\202\017\250$\301\211\311\007\303D\036"
+	.string	"\366\214\240`\023\005\233&%\f@\323\203es\004\304!\007\037l\236\204B\330\354\230F\217\013_f~\n5.\240F\220\363M\334$\233\256\242\354\250\335"
+	.string	"\004i^\340&G\274\324~\220\351\003\037"
+	.string	"2\241w)\340=NX\240\223\352\263\013\272\226\332\013\325\252@2\236\222\f\0077\263\32556\001\301"
+	.ascii	"\315O9\003U\030Q#\213\243x\251\314b\234a\005e\313\300\250KX\304"
+	.ascii	"j\364\270\233}\022\211\325d\247n\202|\273\254<\001"
+	.text
+	.section	.gnu.lto_getRssi.120.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\366\001\355\020"
+	.string	"\266\340pE"
+	.string	"\317&\035k;\034\340L\240"
+	.string	"="
+	.string	"S\227\222\bf\330Sy\006.\003\357\204\233p\276\2168Q\306\f\373\341p\323c\256\375\320\346\204\371\343\273\254\377\027\346\025t\216\005\304\005\250"
+	.string	"\272\230\351\326\b!{K\231RZ"
+	.string	"U"
+	.string	"^"
+	.string	">\216I\177y\337\326~\207n,\b\355\302B\036-`{\364o\336a\305\036\210\004\025\013\310\315K\213\316\320.\2143\335#{\314wd\217\212\341\336\241\246\347k#\t\276\023<-\027\313!\205\353\206k\005?v\3678O\027\327\227\251\215\354\256\263\345\232p\307\333>`;\304\316\224\036\236\343\3714\206\220\312\267\036\375T\366X\322\0020#\\TPe\314\206}\2513\366\341\252\214\3554\207\251\364\327\255\001\323\0310M\202\351QL\213`z\203i\r\2463MG\230\206\232\326Lg\246\017`#\210\306\365\037\236\335\227\030\214E\021Ih\370\353\267W\002\253]\325"
+	.string	"M\267L\241jz\026\207/c\216\232\35154\252B\215*XB\251\252o\211\341\223\213\b\221\212"
+	.string	"\246\204\315\013\226T\213\335\313L:J\361\303\202\265\341\313\335eQ\235\361O\331U\301\207\240U\276\260\275\340;\247mwE\300\007q\035\006>\315\243QP\250\354\361J\002\323c\363z')\rJHN\251T'\262\211\210J\307\251t\234\203S\t\ng\322\2458\221\016\243\036\234t\\\004\024\252\343H0\325\341\252\214=xj\200\324\244\245\226\232\230,\251\206\272\330\346\320\017\225~\316P\016=\013\210\244\233f\250\246\303\212\371\266\221\222D:\322"
+	.ascii	"&XB%\3671\351\021\351w2\274|~aE\016lm \026k\021# p\002\2411\343"
+	.ascii	"\rM2t\367\024/\225\300\255'\233p\331$n$\005;@\302od\013\221\373"
+	.ascii	"AI\250\341T\212\310bo|\211}l\025\034\277\214\302]%w\311\234\247"
+	.ascii	"\005j\017\347YH<7<O\360\005sP\304\020B\301\210\035GM#\261,Tn"
+	.ascii	"\273\202\036"
+	.text
+	.section	.gnu.lto_getRssiPercent.121.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\211\002\345\023"
+	.string	"\226\246\204H\320\360(\035\333Ib\206e\256:%\224\013\252\312\020\303\275~\256C\363\210\006\031\241\352jR?\327\355\233j\277\225mN\237\310"
+	.string	"E\333\335\017\242\fn (\013Y\003m\331\253\003\241}\337~X\233Zk\204l\262\245L)q"
+	.string	"d"
+	.string	"x"
+	.string	"\272\230\227\3738\202\315\013\2469\347\213\257s\352\337M\374\347\345'`>q\363\223\251\307\303\322\234\272\222\177\036\020\376[\275%\377\351Y\3621v\312\006\016\304X&\300\006\331\215\002=\"n@Ls\352\\\013\3422\217\2532>x\322s\005\264#%\\N\366\330\341\253\312\325\"\311\234\363\274\353L\216\246\n\236\3149\255\270\034\207\373\273\355\005\266K\354\r\003A0\276\216+\254\350q\377\374\025\371/\356y\217>6B9jf\332\263u4\335\034\373q.\216\035\252[R=\"\325,\251\026\001\325!R\275\222j\020\251VE\365\207\207T\247\242\032\365\251O\341\247\006\255\226\337\3351\2525\252\017@\225$\224\373Q\2159iz;f\214\257h\304w\277}\037\305w>\317\251\020\212B\366A!\210\376!i\247\233N\320\353\341\250\3159#"
+	.string	"\262+\325\246\026do+A\323\236?V\265\367\330\017\324\246\366\243a[:-j\177k\232iO\302\211\206N\373\300\306\005\317O\214\013\366\016#\303E\311\200\241d#A\3239\247l7\307\177Ip'\360l\324T\207\277s\312Y\274\3029k\b|\025_\241\342\353\3743\005\030L\376\003\027\305f\210\347\347@\017*\032,\244\240\300ZZb'\277L\\b.\227\230\353\002,e\305\365\212\265\270LXf\301\240\022se`a\211\271R\272\331\343\\\034\267R\354 m\270\347\3754\267\235\033\215\353\2613\266\345\222\314\226f]\331R\317"
+	.ascii	"{\267\221,\371\327f\320@\217\323\215\263fen\355\367\3264\262"
+	.ascii	"\255\275\r\211\265\253\035Y\020\310vC\013E\226\025\262\"+\300"
+	.ascii	"\310\266\344\340-\002+ P\202a\350\252\033\223\024\272\016\023"
+	.ascii	"^\272\204\264\030.W\022\327\214\n\226_\234\254\302i#\0219Q0\004"
+	.ascii	"\344\3137n'l\037\360\005\243k\315^\306\035C\260\203\355\266\223"
+	.ascii	"-\303]%w\335\232\374\260\275\262\363H\025\3056\021B\f\235(~\302"
+	.ascii	"\001<\301~\211,\365]8\260\257\270j9\260\037z\371R\035[k\312"
+	.text
+	.section	.gnu.lto_getRssiDbm.122.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \356\215\006"
+	.string	"\302\214.4`M\222\016@\343I\031R\226\023\240U\021\n\024{B\306p\326\225\211\214mmc=\225G\353\245\033{\bb\003*\205\202\004\235\001\201\300\0061J\006\3312\005k2\233\351m\246\027\361\320"
+	.string	"\3614\323\304\313`\226$\034\246G!I\323\273d\331\366\301f`5\317w\244\031u=\256\340`\257\272\313\211\352\260\thX\330\362Y\205\215\343\013\220\231y\373\3748\266\001\225\024\254\241\222L\214\026\226Dq&\037\177\347/\027\324\220\316\224\202\205U!\200@.HV2\363\021\264 \252\303b\242\272\326Q\252H\335\212\224\301\023:\271\260\252\030\260\220\231\343\205e\364\326?\341?\3707\002\007"
+	.ascii	"2\001\0238#(\016%\256\321Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_setRssiDbm.124.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"-\013"
+	.string	"&\026M=0O\224\016G\200\007P\200\210\313A}\204\250\203\0221\372R\216t\215Lmf\332\373~k\r7\272\023\017\265\334\373\212?#\027\221:\026D\200\235\221\216\220\032|R\177\302\310\336R\246\024:"
+	.string	">"
+	.string	"7"
+	.string	"0/\231\016\255\331\033\3476l\201\017&D\032,v7\252\206k\177\232\232\037`\363\374Q\024\256\221\r\364&\273\373\356\031a\013e\002\250v\3279\332&\334\360\266\021\330>`\277\n/}*\302Ab\373\211\024\273\022:\\,\nX\242\203\355Cl+w\021\3323:~\354bXQ\332\345(\216\324\341\344e\332\007\361\020\3321 \030\356^\360P\332]\212\rP\207\003N`z\223:E/R\365z\351T\204\222\303\276\306Gt|\016\306\262\374\350\320\317\246\303\353\273\277\222\205\215\026\025>\331as\240\324\f\366\337\356\256\225dgz:\306\377\236\361k\031\314\225Y\330\224\311\026X\024l.\t4\030v\t0\246\302\271\"\347\212\f4\226M\304\\X\254Hl5\310\\\361\201e]\021\302}\256$\273\372(\350\275GNj[\016\362#\277{\025R\217\237\006\023"
+	.ascii	"2\001/~\364\021\202\300\0350\206T-\203\027\330+b\303\374aAta"
+	.ascii	"\030\206\321\200\030\340\n05E\334\345\246\332\033\n\363\326\226"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_setRssiDbmDirect.125.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"E\013"
+	.string	"\266\325M@ \211L:_\306a\346!\202\036\204V\260\226m\255\363\257\033\030'\341\262k\342\r\244X\235;\354\326\360\030O;\340'\316\006\"5P"
+	.string	"m\256\270 \001\260\200\217\rz\257g@(\222\275\367N)9"
+	.string	"="
+	.string	"7"
+	.string	"\362\027\356\325\241\375\340#\200u\030P\323\230\331v\267\233#\017O\247\f}\212x:\365\370\264\210)\212\331\335\313.7D\225\224\222\315\356Z\256\304\216\273\336\366\204m\b\373\022\001\227X*\324\3043\200\260\313q\233\260\r\352\002\001\266_\261=\307\037\b\037+yaW\304F\333\0353\316L^1TJ\373\004^ <\314\344\272\033b\200\266\273\031?L^\031\336\300\275\006{\232\323e:?92\007*)\301\376\354\bJ~"
+	.string	"\203#\371\325\253?\342^?/;\245\261\"\274>P\362f\217'9]\366\351\356\256g\313>\354\257\217\375\224J\007\236\3167\362@\016\304\241\370\200`E\206'DqGC\372:\322\327\205>\026\240\256\363\201\235\346b\357\302\363u\030\236\367u\225qOw\266\354\rj\246h\235~\202+0y\"\021\367\032\301\242\360\002\221\273\001\022"
+	.string	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341\026$\027\206a\030\r\210\001\256"
+	.ascii	"SS\304]~\252\275\242\324mm\321\003"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.126.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \373\345\006"
+	.string	"R\21505@o\222\016\230\016\034\371\035\b\241b\332\310\230\344\366T\340\016\301r\007\242\250\265\315\036P\327*\nH\350\250j8<\r\001\250q\017k]\316?\2436\261\204\310\024w8\036*z\250\b\341\300\360\020;\224D\344h\236\"\032\25081MT\314h\331\027\372\031\\\357\342\247\250I\025\220\231\t\267\244Z\305\025\025n\361q\305\n\357G*tO\200\344r\333k\226{\035_L\276\320\357vo"
+	.string	"D\224\225e\313\324\330^r\005\252\204\374\240\317\\\221\216\200\2566\030\227\265\031qd\240\270dj\221\240\005R\241\253F*|\036\255\352\252\333Q\027NZR\260\314\252\003P\310\314\035\226m\364\327\037\341?\370?\002\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_isRssiConfigured.127.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"\222\f.4Pm\222\016$\223=\302\211\2128\n\3345\240\001`\267\026\343\240._\317\276\375\273e\307\031\001\250P\343\331\2316m\f\025\260B\022Z\2249\252\265\3667\221)g0\233\3476\317=4,8\270\314\213p\030\201+\b\206\347$\252\352\271K\226\305\021\"\301\007A_M\245\210\330P\b\250\245vh\256\306\023\234\326\253\324\345TJ\025\001*>\355\364\231\247\341\305\227\2228\372\333\330\332\245\004\220>\260\232H2E\247\223\024\241@6\376\316_>@\350l5\313\020\r\224H!\017\223\314\314!F\2556\353\226\243\n#\246\222\013\363\264Y\0222\363va\024\035\373\033\374\005\277E\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_rxGetFrameDelta.128.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`~\002\245\024"
+	.string	"v&\210J\260\022R:\252\002\034\253o\330\333ym\212E{5\216\262v\007+\270\324\f\375b\306~\232\345"
+	.string	"tf\016\255\325\331fDpo\377!N\326x\3069\344A\213W\342\355\003\016\\\275=\024\3358t\313\365\276\226\337\022\"eJ\001q"
+	.string	"g"
+	.string	"u"
+	.string	"G\262y\260\346\2639\201\244\\\314\031Dq\001\362\243\203\244m\037\305S\330\230\347 \247W&0*\322\021^\3159i'\027\320\372(\336\244\365qE\234\367Q\\\345\371Oz\003_\017\250_y\363\361\303E\2222G<\231s\302J\034]\321\304\347ix\341\325C\231#\"\030\022\375<\351\332\241\364\251\272\026\3149\255\277\222\347n\335v\315\366\003[\221\002\366\3059\347\364\002\331/\365\214T\227X-#\325\261\007\377\221\227\372\365\245\333E\252\227T\253K}"
+	.string	"2\023O\345w@\315\271\2235dN\215/\206\276\364\226\216\272\366\235\376\003\304q\2457\321\234\311,@\252\2429\347U\370B\177I\303'\317<\207)\243#\2539\203\007>\032\205\244\261a\037\325\266\261a\266U\355\037\005\275\365\243.\360bUB~\215\360\242\024\220\312\227c\205\217\222\235\355"
+	.ascii	" :E\\\253[\262o\272\201\021C; \230H\3704\3133\265'\324\364?]"
+	.ascii	"\275\022R\222\250\277\256\275\360\001\254\202\020\231\362\355"
+	.ascii	"\215\016\211|\242v\203\374\230\326\227\202\222\016\034\rb\333"
+	.ascii	"\366\0261\344\234S\201\317\342O.\276\320G\337^\364\277\227\326"
+	.ascii	"\307/\013\260\006\326QO\263\354\240O7(\266\220b\303\335dh09\034"
+	.ascii	".\327B`\247b\303\335 \300v*6\027\0066\\MWa\304-)3:\332\214\216"
+	.ascii	"\006s\253\341h-\272\035-\305\3049\f6\035M&\227\323\321`\301\336"
+	.ascii	"\305\271@\262=\351\255\3174d\373\244\213E@\036X=\243];\343<\300"
+	.ascii	"!\326\3532x\273\232\r\300\341\211|\236\252\304\b\255\227\206"
+	.ascii	"\330)a\343\307\215\330\276v]\033\333;\3710\036C\202/\344\f++"
+	.ascii	"{\242'0 p\002!\242\343\003Nf\350_\221\332scm\220--\026\315\315"
+	.ascii	"9\261V\314\301\005\234\265f\210\326q\265qq\026gi\305\212\216"
+	.ascii	"Yf\234j#\215\247\360\334i\236x\214\305\314\234q\213\333Z\336"
+	.ascii	"\250\241g|\013\330cm\001:\022\203\2471\302\332\313M8\260m\222"
+	.ascii	"U\"\016\204wN\333\226\371\252\204\275\241}\"P\032d.\322^M\260"
+	.ascii	"\013\233\001"
+	.text
+	.section	.gnu.lto_getRxfailValue.part.0.168.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\365\003\375\031"
+	.string	"F.\245H\260XQ:\200L\035g\fH\026\003fS_\026\252\312\225%]\361\355!\332F\240FPr=8\311\030\f\r_\335\234`\027\312\206h\276\315\370\351\231\310\235\302\302\331a\273\006\200"
+	.string	"5\352\337\2358H\253\337\310&r\247\024\214"
+	.string	"\230"
+	.string	"\210"
+	.string	"+\274\265\336\b2\251\265\204p\352\004\255S\033\310\036O\205\334\214\233%\323ng\333\017\362& \343\030\f\345r\013~\004\213\236\252j-c\247\003\356\022O\347\r\210\247\253\343\270\263D\032\356l\341\374i\304\013:k_\234\021\235^\2101\342\3158\205\325ZG\336\320\fC\227\025\245/#\217(tp\203J\f\001<\335\334\0206E\252H"
+	.string	"\217(D\260\204\303\314\241>[\360\204\346,\360\026\253B\255\325\317\365n"
+	.string	"\267-d[g\357\225\025\211F\3718\222?\371!\375\243\244@\310KQT\223\023(|\")\201\226&\242\340|\225LG;&\356\tk\257d:\n\240\344\242l\252\252\272\362\201\315=\313b(\227C\202\022\r\242\335\213\234e\337W\362%\366h\362@\037M\017\314\217\024\321#\363Cq\240\305!=\252\337\213*h\333\201\366\351\225\251\242>\221\233o\344P\036\221\334\376\3643_e=\3329\375\b\320\237~\006\324+\365G\277\037R\3068([E\034a\302\355\345\n\330\216\007\247\016\247\035a\002\320\313\255Zu\024\374*\227\362\340\3638\365\007\020\324\007\261\25725$7\257|2~\271p}S>wZ\271\246\353!D{\004\211y\243\271w\202\264\277U\216+\340\256\317\366\216\370}\222S\027\335\2642\201\t\253/!\332\262\331\274\321w\002\261D\221\322mP\320\366-L\213\251\356*Rmpz\250\023"
+	.string	"b\201\"\0254\323\314\365y[\017\353.\3316\323\242\3154\265\231\016k\246w\234\236\343\364k&\r\0055j\205q\205&\326\321\271\261\361\220\265\0244rVbV\213\315r\016X\307\204\217\211\235\034\032y\001'Gf\343\331\221ep\361\340\320h2\235\031\313\263\033\025\265\230\212Z\214\266#\353\211\315j\266\330\215\001\223>8\265X\n\222\254\305F\333\363\273d\321\006\225H\367P\317`\343\t\rW\334\026\266\305u\205\334\nyY8\"\237\342B\367U&\312\366"
+	.ascii	"\222\245\212!\260n\222m\013\337r!\313\265`\320\260a\203x\032"
+	.ascii	"\356c\364\250\3148*I\215 \272>w\020wk\3028M\331\034n\245CN\250"
+	.ascii	"\221,\303\020b\004!\221\031\td\202\246u\240\002\031;\323\006"
+	.ascii	"\021\220\255\224F4M\215\232\365\016LP;\020Y\243\036vg\250Va~"
+	.ascii	"\303\363\367\315I\236|Y\306\377\351=\003B\211C\275E\215u\271"
+	.ascii	"\311|)V\307\321\262\347\031\205\313\363\303#*(<\002T\264\316"
+	.ascii	"\210\275;\364\222\244A\346\267\307{ \356\245Np\254\006\200\227"
+	.ascii	"\r#\302b\210\002\033\021\321\313\235\022\230\307\331@\373E\002"
+	.ascii	"t\030\373\3430o\026V\2125\234v\225Q]\370\217\t\205(\326_\271"
+	.ascii	"\336\270\306VY\003X#\354[\244\026\342x\025\233;\032"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.177.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\337\002\325\025"
+	.string	"\326\347\214I\300\324M:\340\357\202\201\200\333F\367\274A\200\301\314\be\230\347sJv\224<s3\215\370y1\243\231\004\274\355\234\217\025\364\020\322\f\017m\265H`\002\374\277\242\026\004M8\300s\310\332\377\005\257+vl\204\220\275\345N)|"
+	.string	"k"
+	.string	"z"
+	.string	"~\201\341!\262\355\027\230\036\313\256S\032Z\t\321$\b\305\222Zu\342\351j\270\354\253\020\374\350\\y\"\363}\276\022q\213\002\022R8\370\335\247\323\255\006R\220\026\266\t\377d\315Vt\212b\003\232-\265V\226-\202\234S@\322\005\252\377 2\232-:|\004\261l?rg\001\\\224\004\024\033m\262H!\025\371\356R\310\366#e\312O\300\230Z\253?\253p\263n[\311\266h\313\252\247\337\235\200TT\023\256I\311L\366\344\346\274'\237u\223lK\257\250tH\245A*\375Mi:\245'\225\336)-\257\373\2772\227H\004\300\325:\324\253\252\030\350\f\017\266o\177\307c\263\354\036\233\345\225\327\361\374)6u\325F\344\225\366M\334\251\347O1\257j=\"\"\243V\335\201S\017\bO[\316\362\235\316\253|\247\366K\004\035@"
+	.string	"\351\321\315\231\356w\344\361\240A\027\302\r\006S\016!*zsss\277w\342\355\220q(\232\226\313\265\0066\030\315d\317{\t5%\225a7g\273\346\333e\300\033\362#\231\330w\361\0275677\337\351\356\313\355\005\225\221\\\237\305[\304p^\257\357TN\325\222\274H\217\307\276\257\334[\270\271\240\005I\201\243\311\236}\331\347\2378\n\231\317\301\016`\362\265S\037\366\005\260\031\027\216\215\214N\216k\034\037\264"
+	.ascii	"\270\345\2623\212;\243\230cC\203#\266F\230\350\242\342W\003\327"
+	.ascii	"(\352\274^\243\310\372\254\233\344\357\036V-)\251\210\001\376"
+	.ascii	"\262o\265B\266W\353\230\331\322V!\217\231\327|\340\206{\0353"
+	.ascii	"\340\312\334nP!\310\221 \007\207\217\024i+X _\263L1\365\201\n"
+	.ascii	"\tm}rE#f!\270\271%F\240\206p+\352\036}\337\332x\357[\024\036"
+	.ascii	"\323\021 \034\355\001= \260\"\2512\333CR\fi&8\006\035\307l\222"
+	.ascii	"pa\226L\003\203\335\032K B\202\2666\001\237\213\321\316\275\231"
+	.ascii	"\025g\017b-\231h$\021n\036\335\376\220\026\333\225\213\231\274"
+	.ascii	"\225\267C'|`\020L\233C/\355/?d\001\177&;5\273\327\031\210m\347"
+	.ascii	"9I\213\264\215;\243\013\331\235<<\302\306,\366\2079\022/yr\226"
+	.ascii	"v\027GH\031\n@q\251\f_\006\213\334.WIL\261p\220\265\306\t"
+	.text
+	.section	.gnu.lto_setRssi.part.0.180.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\271\001\r\020"
+	.string	"&^gE"
+	.string	"\261&\035\310\346\205JW\315\364\333\236\007QRv\367"
+	.string	"\340\\"
+	.string	"\204\016\303\354\250\231^\310\207\351\226h[k\241G\323\211\323\006K\336Z\245\273\326\327.A(\376\006\3500\016~\375\330\201\215D>\331[\312\224\002P"
+	.string	"U"
+	.string	"S"
+	.string	"7\361\023\247\313t\216\273.18\273_\202G\033\310\036\003\234"
+	.ascii	"\366\230\017\301\036\355\227\260mR\371d\333\3707b\013\260t4\264"
+	.ascii	"t\354\256\366\250\"~\272&<\371\351\261\240\256w==\226\016O\001"
+	.ascii	"\207\036%\273\353"
+	.string	"\314\303\035o{\201m\006v6\b\276\277\342,l\217\271\323\3707\021ZnH\354\256\347\321\246\246\313\026'\003\301\322yq\257\351@\366\251\027\253\306KA\306\335Ga\362]\366\330\376\214\351-\224|\260\251\017#\217\206)\256\342\364\026\212?vC\320@\220=\212@\2175\377\231.\323\345\267*\2255\3559w1\301\207y\264h\224\367\036\375\021vB\312{\252\"\031\024\345k\352]\207\240Bsc\345\225\312\235\324\027+<\\]\331\036i\210\245\025K\347\277\377Y\266\034\220\261\313ag\307\272\304\234\230\333\274\205\007l\300\360\215\330\356@P\016P+\355\3613W\007!\316\344s!\206@\033G*a!\316\344#AT*m\037\006\221\244lZ\312\246Q\020}N4\320V\322HBL\252\020\3324\013$\322\246\345\341\352\312%)U\261\252\276\330\206\352\303x\214\316\207\361\007\004\302\036\357\341P\205\372\034+3"
+	.ascii	"d\352i\376b\224\355\246\356\371\001) `\20216j\007\2012\210\224"
+	.ascii	"\f\214\256\221\241\301\274\244y\343Vd\017\235\255\213(\0173\016"
+	.ascii	"\367M\203X\f2g\3565\260\345\325Y\331Lc>b\270 2>\017\260YI\032"
+	.ascii	"'f\254v\253\214\310\024\361\026>I=~hv.\3548^\362\344\354\354"
+	.ascii	"6S\266\r\200i\257\004K|;O\bc"
+	.text
+	.section	.gnu.lto_setRssiMsp.part.0.182.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\365\n"
+	.string	"\326\025K<0M\225\016C\210\273)\323\243z\243qS\256\216\201\201\034\321vn\362\007\276v\204>[\2131\304\253\241\007\303\260\252\203\203\271k\360"
+	.string	":\247^;c,*3\203@\215mo)S\n8"
+	.string	"8"
+	.string	":"
+	.string	"\321\027\215G\373\026lwF\356\354\022\377&\254\005\252\024\312\320\332\335\354Q%\274\273&\354\374\177wx$\317\365Ar\360\2548\244 \260\273n<\270\343mOl\013\260\177 &;\246!L+L\347U\377\035Y\n"
+	.string	"bW\364rm\204\350\241\202\355\333\377:6\206Y\363*K&\235\2478\377V4\262\246-\231tOq\254\273\020P\035v\277\001\017N\200\311{P\265\305\372\260\002\251\307\252\376\205c\320|\nV\300\345\275G\237c<\336\204\307\312\003`\244\252\276\201\013\224/_S!#8\210\b\235\370\344+\365d\205\207\273\273\326\027\2163\240\341\n0\250d\036\246D6[\266\331\262\314\005\001&\243l\\\026\201X\323T\266l\201\246m\031f;\017WMn\260B\254>\nR=\331\206\352k\370\006J\305ba<*\t,\035\023"
+	.ascii	"[+0\036\270\201!\005\002\006\271\004V\003\001*8@\024\f;W\354"
+	.ascii	"+\234x\225\255\346\264o3o\247\005\340\332\213)\247\345\364k\313"
+	.ascii	"\030"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.184.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\353\0015\021"
+	.string	"v\237nG\340\262(\035*\221*i\207\365\307\002\242z\221\230\004\205\222\221\035\220\237o\230\242\361?\252\240I\r\257l\261\276~\327\343&\364\211\270\036\033l\230\317\305qO\344a\204\360\371\027\223\302\340\251\252X\023\335\"\331d\313\224\002V"
+	.string	"Y"
+	.string	"\\"
+	.string	"$vvg\b>]\300\363\t\372"
+	.string	"\356s{\b\367\331}\276\204\355\325\005\263\354\032\237\305\254\310\f\r\226\234\332\356z\237\022\346\254oR'\313\007\021}`\261\3267\205\3050\\\006\210\2756\320\356\376\346:!\346R\025\360\t\"\332]{2\334\334m+\260\235\300\326Qj\235\352\177\264\303\b\315\256\205\261\307\266\314\0272)\214\002\275f1\261\343\264\240\321\324\366\265$\266SF\215\"l0\"l\354\324>os\037\305s\354\316\251\343\270D6\216\330\335.u\337\304\312\277qg\3736\253\317T:\332\025\r$\237V\265\177\3425\254\317T\376\354z\b\233\224U\250\261\2711C\306KwX\312M\212\344`\371q\251R\312\347|\004\204\f\005\026\235\020.\035\335\251\355"
+	.string	"\324\303T\202\\\262e\177\305Y\250\374\017\016Q\364\260O\037\205\373\274,\221\2153\033VtT\341i\331\003\237\006n\360\240\265\324\207\312\027\313\371m\245\213\315\251\267\251\2263n\020\"\201\245\223g\nA0\374\b\244, \201%\223\223\211$\212\020>"
+	.ascii	"\376B*\242\247\"z\246\022\003\320\373\304\024/\024\342\360\001"
+	.ascii	"I\364Na(z\235m\375\266\322\3057\277\004\035\034h+\322\005Ca\026"
+	.ascii	"m\3778\177\347.>\322\311\t\367i\"\033k8\344uw[R\276\3301thGq"
+	.ascii	"\001- `\2021VV\036V\204\301(\211\241|x;\255-j\rX\201\026\031"
+	.ascii	"\221\005m,rm\030\305\310B\323\235\322\306(\377\026\247\317l\221"
+	.ascii	"\324\242\306'X\253\232@\331^\213\331d\2420\314\t7\024\2020\b"
+	.ascii	"h\2079<\217\211\351\f\215\261KS\253|\221n\207.\236SZhKY30\324"
+	.ascii	"^9.\315)\357\326k\361\030"
+	.text
+	.section	.gnu.lto_setRssiDbm.part.0.188.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\370\002\345\025"
+	.string	"&\251\212I\320\322(\035\243\201e\370C\226\370\230\r\355\b\204#8\274\t\213\252\024\017M6?\245\bj\3002\230N\013\270\301WC\352\325:\027\373\256|\245\340\034\\A\322\345 \225\247\205Q)\337\340\003\300\201_\355\227|\262\211\334)\005o"
+	.string	"s"
+	.string	"t"
+	.string	"\213\373P\362i\020\347,n\317a1j7D\016\240\335\337(~\016"
+	.string	"UV\371\237\35575\371[\036\317*\355\247\270\212\333oj\236\27326@\273k\340\323\004\304O\221\007\b?\345G\302O\373>\3336\236o\366\216\377H\254"
+	.ascii	"\037\321.\247\307\356\216\237:\342\267\253\004o\276\3135\265"
+	.ascii	"\241\303%\200\203\247\223\335\265\350\341\236\267}\300\366\002"
+	.ascii	"[7*\255R\351\224J\243TZT\351\223J\207'\351\251\322`(\255*-\377"
+	.ascii	"\373O\"a\024\024\355jh\372\26123\310\304{\376c\222\f\030\266"
+	.ascii	"\304v-\345\322\300E\306w3~^\347j\337wq\037[e\332[\370/\030\300"
+	.ascii	",\251>{xj\342\002\211=\037\221\322\356\226|\322\316SK\355qK\276"
+	.ascii	"\033%\004\"\355\376\n\233\277c\225\355\353\330\236\303\"\037"
+	.ascii	"\004 PJ\364\027\036\242\236\024\245\327\305\344d|\206\207\\\026"
+	.ascii	"\262P\370)*\253D/T\251'\225:t'r\262\311S\303\225\307\250\211"
+	.ascii	"\273\233\300\027\372\320\313\257\371\364\004\030,\374\234\212"
+	.ascii	"\nR\005\365;&\037\306\203(\3705V\211\311\277|\372\261\360S\365"
+	.ascii	">\237\034`l\370\350]\245~\347(HG?;&\234l\222Jc\005\017\256\316"
+	.ascii	"\330'i\226J\203\204\322\253/ZJke\276\\2Zl\026\276h)-\b*\022\034"
+	.ascii	"\300f3\331\312.\223\026\331\330\"\033+\300Z*\243K6\033MF\034"
+	.ascii	"\263\360\222\215\027b1\331(\2573>\301i\316zpwW\225\3066K\375"
+	.ascii	"\032O\252Eh\265\302\317\357\034E\304\321\017\210\262\364\"(\005"
+	.ascii	"\321\024\222\321\216\016\305Ji\250t\2452i\307\024r\017\205)U"
+	.ascii	"\3514\332\365\n\034\324\224\216\340\0245\351brG\265\020\034F"
+	.ascii	"<\230\0336\001B\250q4\346\210\024\310\020\211L \2254-\034p\002"
+	.ascii	"\031\263\344\006\020xG5\313\030\303\002\241\241\217\316\305\270"
+	.ascii	"\032\272\241\241\360 \215\3033ad\271\340h\366\020K'\004\223f"
+	.ascii	"& a#\\?qQa\317\025\216w\227d\216\362\235\271\bvH\250]\334\025"
+	.ascii	"J\351\321Q\362\205\216\335\363-\002\266\260\253\305\222l6\207"
+	.ascii	"\237\022b\210F\005\352?76\320\260\227iB\360\245u\267|\315\247"
+	.ascii	"=\337\307\254\311\316\354&\363\266\337\002\305c\305\330w\260"
+	.ascii	"\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`\202\b\025 "
+	.string	"Ft\273AP\346M:\023\305Q\030\222\221\224Uc\213\317\342\263w\r\017\220\316Q\221\017b\206\205\207\222Ha\217\276\331\370o\375jUUUU!\251\344\n\b\230\\/\001@\025\030\345@\033\300\375\333\266{\313\024\247"
+	.string	"\245"
+	.string	"\253"
+	.ascii	"\023p4\227\2417\256\264\361d\215\303\261\365\322\270\233\031"
+	.ascii	"\025N\031\315h4\306\347\300\370\361\005sY\027\274\325\342m,\213"
+	.ascii	"\263Y\321/DU\\Om6\233w)\372\203(\n\266r\340Ds\030jB\252\004\005"
+	.ascii	"K\242\177GG<\216\275P\304\357\330\013\031\234\355@\003\316\n"
+	.ascii	"\321'DA\364\353\350\207\333\361\360:\035\216\264\365r8\035\373"
+	.ascii	"\237O\341\206\313\261\367LT\230<;\r}C\031\372oT\375?\276;\034"
+	.ascii	"\252\031{\367\336\213\241\357\347\tO\f\356B\177I\207jh\376\376"
+	.ascii	"\353t\361\351\310\214\261Y\350\347\241\377\003<\t<\252r\\\315"
+	.ascii	"\250\022\342\340|\022\331\353}l\027s\251\302[,W\363\335\3527"
+	.ascii	"\251\364#M\351C\322\352?\222\322\317\213\322w\224\325o\344\210"
+	.ascii	"\241\364\361(\261\277\210\236_c\254\276 :d-!K\261|9\212\355>"
+	.ascii	"\035}\302X\254\023\016\263M\030\214I_\321\222~\242`\224=\244"
+	.ascii	"\244oG\223\\\315\"\351#j\036\351\0372\322\017T\244\017\210H\177"
+	.ascii	"\356\252/G\207\364\231T\bC\261A\376\306\336\337\0306p@\372q\367"
+	.ascii	"G\337\215\372\210\320\203\265Xq\026\313\203\307v4\247\241U\315"
+	.ascii	"F\035\022r4\233\241\017\002a\306\241\005\326\247#\323Gk\264\262"
+	.ascii	"\234~\365\351\344\007Xiw\356\347W\013 9\300\227\264.\377\363"
+	.ascii	"\253\005N6\360\225f\274\333\257\n`2\023\";\253s\372U\250\277"
+	.ascii	"\375\252\257\310"
+	.string	"Q\211\344\222MN\225j\331T\371tk\352]>\003\252\357\216)\032\030.HL=\245\341\022S\365\235\314ac\030}\275\017Se$s\236Y3y>K\265\330|\305\254\031\253\254\371$k&vi\026\343\322\374\265\245y\250\245\271+K\263\327Xs\025\261f!\226\346)|\357\375\201\034\326L\205\301\246\276\216\347\312\333,[\371\036\373+\271*B$7\242\354\361\311\224\216\314\230\362qW\322\005\247S\225\346.\247\362Q\301\220\371\254\355,\317\200\303\251\314\344\007bSS\226\340\311\312m_\353-\r\231\217_\253JE\226:\3435h\352\307\312E\206 \210\254\013\301T\245\342\372F\017\321\353\200$T\006cz\357\025J\365|E\246\312\273\2702\240T\265\232c\006\253\225\\\260\352\360\302=<4D\237\013V\002H\001'W3yur\177\013\326$/\f\325\024\343C\362\355\266\222<\307\024\317\262\315\227A"
+	.string	"D\243\031\324\227\301\212CA\3453.\001\034\202\232Td\002\326\244\343\017X\223\230\314_\002\200\220\250Q\024%M\214DR\224\244\222\345\300\002\2511N\033\021\260\220e\231\tDF\002\t$\020\262\351\026D\"{^\223\234[\333\031\265\371\361\333+z\341\311\273\023y\025\247\031\374k\020\323\025\265+\3717zt}M;\206\027\254\234L\336\227\334vX\313.\211i3\330\225\255Q\022\b\tT\032e\"\030VR\002\232\222\322t\246g\330W\334}\361\375\200\367\347$$000\020\215!\352\203\353#\206\205Bdh\026Vf7"
+	.string	"1~\347S\305\032\274\302\213c\211\252\004p\303\202-!#\250\340\331[B\004\021\315U\251\003\206\025\216\003n"
+	.ascii	"\340W\316\277\b\253KT\257\002\307\242\323\203\344\204o\274Le"
+	.ascii	"\017a \030H\212>nT\362\274\252\034\315XG\001\225\271\323\224"
+	.ascii	"\251O\1772\001/\273\324\275\350p\221\300m\373\252\373 PX\372"
+	.ascii	"\224\271\310\340]\242\223B\350\007\025\034\241\027+\230g\217"
+	.ascii	"\220,\317\201M\337\025\345\203\255\317d\260\245\205\317\271\205"
+	.ascii	"T"
+	.text
+	.section	.gnu.lto_.refs.ab32f613826644d9,"e",@progbits
+	.string	"(\265/\375`I\002E\021"
+	.string	"V\355x=\020\253(\351`\370\037|\177\247]\036"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300E\377\377\377\277wu\237\035\367\345o-\3020\f\363hP\017\374\241\017\364\305\177DZ\333Zk\244\265\266e\nc"
+	.string	"i"
+	.string	"g"
+	.string	"\240\2161\372\n\355M\257C\214\272\210\324=\244\347\300\357\340c0\177\031\365(\352\026\320s\242\236\205\376\002}~~\350\034=_y\237y\356\\s\360\037\347\2155\327uM\363\327\373\3023\327\035\355;L\217\227\274\022\363-\276\006s-\346\030\374\204[\266;\256g\270\307l\335\242}\226\365\314\276o,{+A\207^\377\300\177@u\217\251w\256\274\023;\307\3129\261o2\337\304\336\305\236\211\375\022\273%\366-\366\027\273\025\313qq\346\324cF\3474\372\266\321\263\215\2774>3\306\310\316,\276\3101\213nu\255\310\257\256'EN\344\032S\307\230\276\022\3215\211\177\022\177E\274\005\321[*"
+	.string	"m\017Q_\275W\205~\200\366\035\257\007\bc\006\351\227C:<\344\267A>\373\370\200v5{\344o\225_\253<Wi\300:+\375S\365+\346V\374\252.\200\375\266On\002yGw\364~\026\320\357\240\365S6\240P\344k\310\240\351c\200\377\005T\337$\346\233\300\374\222\370\213\274\376\221zT\3529R\177J\375\006\3273\270\307\330\372\305\353\024\360M\360I\244\006\237\247\344%-X\3159\244'+X\307Q\036~\322-\243\234L\001\233P\t\335:5BB\350=\375\240\016\256!\374w\273\033\\\f\372\245yK\263\300zB\365\022\245\217(u\022\304\217>=t\311\203>\375A\3253\227\364\013\352+\240\034\213+\210w6\213|\247y\204\244W&y\356\221\256=\362\330\"\335Z\004AeO\3277\037\r\031"
+	.ascii	"G\023\370%\360L\340\306\213\222\022x\252\200\327D|\227\230\022"
+	.ascii	"\023\347\247\277\262\265\346\036\306\340R\006[\314\231\225a%"
+	.ascii	"\325\244\265\r)Y\033P-\003\013\367\326F\234\231\205\236\233\225"
+	.ascii	"\t^\013\347\252\314"
+	.text
+	.section	.gnu.lto_.decls.ab32f613826644d9,"e",@progbits
+	.ascii	"(\265/\375`\243a\375\220\001\312\223z\217U LI+\215\001\253T\026"
+	.ascii	"\303\316\252\230/+ \376\255\242\351\340\001\277"
+	.string	"\212\211u'\202\317\304\345\246\253\232\273iT\331\005\r\032\311>B@\024z\272!\2427\273\310q6Y*\n\202`\360\352:?\255\265>)H\030\277\277TQ\356\362\265\310\310\336{K)e\n\225\007\002\t<\tDp\221\353\345\336Jc\310\264p\201\235.\335\324\b_`\232b6\346\260\022^A\246\211\327n\337\375\303Q\322\331J=\234\266\236\340\220k^\301}\006Ka\032z\205>\322@\370\261\024\326q\345\n^\302\013Gx\317\374>X\370\n\n\225\025\274\206\201`!8y\357\253\261\255\275\367\361Q\326\0231U\027n\3552\311\021\327\034\363\373\360\210\342\203\255\360\225\032^\272\201\245y\364c\251\251,[e\376+x\315\024b)\031{M1\377\025\034t\261\305\007\330\264\205\237\240\372\266|~\\\270K75\202\022\264\346\025\304k8\306=\273t?\032 \366\245)\206\223.\034N\336\233\252\314\r\364"
+	.string	"\004\274v\303\\8\234\243\345~\362\331*\003\365\265\367\222\203\036\016\206x\\\364\302$\240\363\362\362\240\"\314P\261\0208\017\354\n\322\256B\247?\254q\020\237c-"
+	.ascii	"Dys\303:\275;\350\323'\365\350\031\365\350\236z\224N=:\206{h"
+	.ascii	"\032sXD\260>\352\245\036\245R\2176\251?\233\352O;\365\247\025"
+	.ascii	"\365\247\232\372\363L\375\271D\375yD\375y\245\376lR\257\003\325"
+	.ascii	"\353:\365\032M\275\026Su\356\016z\275\245^W\251\327.\324\236"
+	.ascii	"\313\203\342\027\270\3512{0\214-IN9\260\276NRK\260o\017\372\302"
+	.ascii	"\333\203>\213Q\237\357T\017P\324\016\204\250\"\\\036\364Y\206"
+	.ascii	"zlF=\232\026\365mg\352\255\bQOG\245^\357\362\240\307N\352\233"
+	.ascii	"\205j\207\273\203~\360\362\240\277`\324\013\3466/\323\303\365"
+	.string	"\033*-7s\357e\316\020\017P\007\032\326\277x\352\257\0074\247\260\260\260\360z@\177\241\250\035|\331\253i\022f,\307\322\303\020\"|^<\334\214\301K\372\352\242w\227U`g\352\266\\\273\233w\253\366V\332{WpW\364\301 \203\365\345r\357.S\303\305\3339\367\357GR\024\326\277MT\022\354}5\240\267\260\360j@q\325\345A5\270;\350\245\363\371\255\333A\241\246\226\033m\357\235\203\023\005f\226\2065\206\273\203\376W\213\206\324\313m\207\217,s\031\211\323\237\027\254\261\254\300bn\301\372\027\210\372\377\306\335+\227y\345n\225\273\334{\271\367>\bV.\034\316\221\316N\262\323\023\341\001\bW\356J\271py\271\225:\351\241\245\271\367\262\207\003\016rx\030\271\233\201\352\337+\365\327\205z\247\\*\227y\301}\273\007 <\037\225m\261\275\22797\204`\204e\260\376ER\177/@o\341\275"
+	.string	"\375\b\324\377\272]\220\263\244\001\343\n\353\377\266]6\033' q`\260^\353\251a\262\243\313\022\326G\241^\304\362\236\341 \351l\245\244\276\255\275\227\377/\224\033\3452\257\332u\362\213v\237\034/\367f\356\275\177\231\374>\277j7\355\236\345e\333VJ\252K@\335\333\222\216\301\275\227\034\364p`C#\215\252\f\252\357"
+	.string	"\265\303\345A\365\335A\377A\275d\267\35427\270f\277c\227\311O\244\345^\356\275\314\301Zg\2364\301\372\031\250\277M\216c\265A8\252\376n\200\346\302\302\273\001z\254\342\273\203\352\\\036\364\277K\376\033v\3056\310LMU\033m\357%\006Ui\n\0241\254\277\274<\250zw\320\353u\277~\274\307\007\325Y\302\027#\r\237\250\233\r\300\351g"
+	.ascii	"\362\221\316*,\235;\037\210\310{$\370[\346@k\203V\347\3757\204"
+	.ascii	"{\205u4\036\200\276\177.\314gn\220\fh$\177\026\363_\343]"
+	.string	"\303\374\027\350\277OA\202\177>\313\030\316\363\243\002\270B\033\376+U\363\337\f\255 \017\321\235\037W\345@*\005d\300?\247\377\361\320\234\001dM\301\217\016\377\033\201?\377\375\267\001\377-\341\317H^\301\177\025n\226\177\\#\373\375XD\336\243\361\337\346?\013\360\337\3546U\230\201\261`\025\264\216\037\303\310\315\3776O\363\237\027t\271w?\306\373/\236\035S\006\263A\335\322ys\211\267\211\345\004\373\257\335\377\267\373!_\375\270&\367\361\375w\213\006\262\3408$?\376@\376r\207\260\024\242\377\032\257\220\276[\200\334\375x\310a\021\316\201\005\277c\370\365\021\213\330\3733\321\177\327\274\374\030\001\026\310]\376\274\345\277\337\365\351s\341\022\271E\200\360z\026\262\036\227\037\347\177\360\353&\377\3372\007\022\030\221\347\376\263a\022Y\377\335@\016\302\362_\024.\003\376,\267w\016\227\003YH\3349\370\365\323\237="
+	.string	"\227\346%\277\375\337\303&\334\374\372\005\036\306@f\313Hp\007\200\3747H^\273\231\346\372qQF\373q\221/;\3711\341\232\202\205\373\302\177\225\362\331\177\277`3\030\374\347\230\377,`\265\323\306\217Wd\262\377\022\377\313w\263\031?\366\273_\204>\301\177\316\375\030-\352\367?a\374\330\005f\213\037\027q\231\376\317\025\267\305\177Y\3703\323\177\317\020.\377\fc\354\277\006\370o33\371\257\n\177\226\261\344\277p\377=\373\257\331\177\245\374Y\354\277U\376\034\366\343%?f\222\225\3747\356\206\200\205\262\321\237U\200\341\020\356\b\367\273r\231\203\374\365\337\030\377e\263\327\177\233r\222\377\276\370\257\b\376\033\365_\244\377z\360g$\030\303\370\357\022~F\3768\037Q\341\277Jj\3777\370\337\363\177"
+	.ascii	"\377\335\3779\274\345\256?\013\271\007\376\323\205\377\002^\241"
+	.ascii	"\".@\376\265\006\376\2067\370\371\353\t\260\035\375O\240\377"
+	.ascii	"W\376[\371\217\205\303\377\f|\356\303_\223\360\003$\377\210\372"
+	.ascii	"\237\366_\355\277\3313\360\237\355\351\257E\374\231\204?\233"
+	.ascii	"\360\347\021\177v\300\237\027\360\347\006\374\271\204??\340\307"
+	.ascii	"\020\3703\013\177\316\372\363\207?'\340\317#\374X\303\237}\374"
+	.ascii	"\327\371Q\254?c\375y\306\237\235\376\334\342\317J\177F\3723\b"
+	.ascii	"\376\\\364\347\366\317\037\370\263\320\237\217\177&\376\031\003"
+	.ascii	"\177f\341\317%\376\f\201?\243\360\347\n\376\234\341\317\030\376"
+	.ascii	"|\363\347\232?\017\177L\365\347\364\317\372\317\367\3074~\354"
+	.ascii	"\364c\302\037\233\371\261\230\037\007\376\330\357\307}?\356\362"
+	.ascii	"c\274\037\333\375x\351\307X~\034\367c)?f\177\334\366c\265\037"
+	.ascii	"\243\375\370\354\307\314\037\227\375x\354\307^?F\362\343\256"
+	.ascii	"\037s\375\230\310\217\265~\374\343\307<~<\365\343\250\037?\375"
+	.ascii	"\270\305\217\367\217I\360\343\020\374\330\350\307E?n\177,\364"
+	.ascii	"c\027~|\3741\320\217\327\037\027\177L\374\361\317\217/\360\343"
+	.ascii	"\r\3748\003?6\361\343\025~\254\302\217%\360c\b\374\370\001?6"
+	.ascii	"\341\307\013\370\361\b?F\300\217E\370q\b?\376\340\307>?.\300"
+	.ascii	"\2177\370q\207\037k\370o\320\177U\374w\351\277\354\177\003\377"
+	.ascii	"{\345\277F\376K\344\277@~\254\363\337\271\377^\376\347\375\307"
+	.ascii	"\362\177\355\277_~\214\363\343\363\277k?\316?\306?\376\177\t"
+	.ascii	"\377+\370_\300\377\n\375\267\371\337\357?\336\177\263\377\032"
+	.ascii	"\377\277\375g\341\277}\377\345\373\257\336\177\363\376\213\367"
+	.ascii	"_.\377\315\362_\271\377\306\375W\354\277a\377U\362_\260\377&"
+	.ascii	"\376\373\365\337\256\377\026\371\257\326\177\203\374\367\307"
+	.ascii	"\177i\374W\306\177;\360\337\026\376\357\375\357\362_\357\177"
+	.ascii	"\226\377s\377\333\376\263\375\027\373\337\343\277\334\177\002"
+	.ascii	"\024\026\026\026\3769\3771\220\360;\240D{\337e\325\023T\034\215"
+	.ascii	"\026\331\022\017\254\341\340\264\025\365\b\307Q\225k+\251\213"
+	.ascii	"-\313\032\030f\250\327)T\257\335\256\236\302\324S\356\231\207"
+	.ascii	"\215\204\244A\027\327\036\324\240\016\031\365\367\236\241\277"
+	.ascii	"nk\313~(l\244(\021\274\270\254|\310=\326\366t`}\0350kki\215#"
+	.ascii	"\235:5\265\253\327!\214LGN\375\365\023\246~\242\323(\260\267"
+	.ascii	"\017\034#\270E\321i\361\013\242\323~\331nU\005\r\200rU\004\353"
+	.ascii	"\353\2009q\242\217t\330{/m\243\300.\255\246\316\216\345R\233"
+	.ascii	"\241\\u{P_{\n\212ymFd\314E\023\326\272\311\260\006\213\020 P"
+	.ascii	"eg\020\253\266\2732\262\232\030Iav\216]_\027)\254\237S\310\204"
+	.ascii	"\311\375\323:[\251\207\227-@\365\327b\227\251\305\356\337\205"
+	.ascii	"R\323zti\316\251\277V\302\324J.\334\325\331Ivj[\033j\371\341"
+	.ascii	"9k__Wo\002(\b$\3515s\306\324_'a\352$W/J\20307\0208\031\323\365"
+	.ascii	"\325\325\245\217\\g\357\235\2647\225"
+	.string	"\016\264\212\037\224\207\377\202\327G\316-G\210\244Y\025)\242\271\356\336{O\355#\277\016\344\352\366\240\006\267\256\271\360\215Y\020(IXA\224\\a\021\005\004\210\036\262\202M\310\365\020\273\033~8\264\376\0179\204\3150\243\025\004\247\316n\260\017w\305\300R\003\353\347\034YY\351,\274\367\336[i\032\326XsO\311\360\360k\037\327Ynf\220(\301Z\367\320X\377\2076d.\310\310a]\r\221\370\260\262\225\377p\270\020\272\200\303\032\020\007\016]\245\263\223\356rl\r\227\306Z8\331q]\205\242\n\025&\252\377C\016@a1\246\251\264\216'-lO\260H\305ya\346\270Ul\304D\241+\304\3728m\352u\f-u-\3432\264\ru\357}\264\334O=n<\366\240\006\367\324\224\207\323I\022\036SO]\333x\237\024@\036L\254/\250k\334E\301\005\251\241i@q\001\213[\343\202C\317\270Nh"
+	.ascii	"\203\374\311\300\3728[\352\177\217\177t#A\355\275c\234\313\r"
+	.ascii	"\225d\203\376\367\367\274\327\303\177s\363\315\340\277\336{\004"
+	.ascii	"\240\345N\2723\263\367\276\201j\027\033\022\216\016\373\244\333"
+	.ascii	"[\311\352\250\001VQJV5\230\230VQ\030\230\230V\373H\211\310\021"
+	.ascii	"\006\250mu\304\304\334\033\203\222\322\321\210\252(&&\322\306"
+	.ascii	"\300\304\334Q{\305\226\250\273\227VG[\251jc\330J\033i3\253\242"
+	.ascii	":0)YE11\221\242001\255\2426\323j\353l%$\250\026J\033\n\303fZ"
+	.ascii	"\371mfU\224\016\023\263*\212\211i%vw\264\370kJq1\223\365\344"
+	.ascii	"r1)m'\0309\220\240t\350\230\226U[o\357\213\266\264\2416\335\336"
+	.ascii	"\031\354\235\243\nJ\017\251\306mK\242sJRC\252\272\313\275\267"
+	.ascii	"\006\030I=\252\266\022\335\321\335tLG\252\366>\222\024\264a\354"
+	.ascii	"\275\367\007GK\272\r\344\322\035]\345\330MK{[\260\227{\303\330"
+	.ascii	"\373\350n\272\275\367\321\336;\205\312\261\334\373\206\016\323"
+	.ascii	"\026\f\030{O\365\300\3309\216\334\226\366\306h^\332\242\230\230"
+	.ascii	"=\252|\334\316\230[\233\305\362\35025U\355\255\255g\005\2452"
+	.ascii	"\217\310v\323\336\373\002\252[QR\177Xk\250tH\024\270&\326\277"
+	.ascii	"!\243^"
+	.string	"7]\355t\231\332I7\321@= \311FsC\345\370@C#\310\321\031\254\177\323E\325M\352\322\315\224\r\206ObZQ\\\340\236\354\b\303t\375\342\327-\264\213l\347\201\23333$.X\337\037\227\007\345\271;\250f\341s\315\244\022\3029\001\301:\203^\301\324+2af\332HV\035t\371A}\370\rs\231a\312\313\t\353_#\37525R\316\202B\325\216A\200.\2502P\203{O}\240\271\332[r\302\3727G\324_\357_\246\336Yp\310\264w\f\017cu{P\203\033j\352\303\315\233\024\034\013\254\177\023UHX\204\312\324\037\326gzZ\310cR\003\353\337\254P\177\237\2149\033\316po+L\266\366\336d\262\230\263\341(-\267\0204\317-\317\310\340\336\373\1776\223\313\\f&\223\007\257\227\034p\3203\004\343\361\265\204\352\333\344\251\267\221So\363\246\3769\214`\315\230\223\036`\230|"
+	.ascii	"Y\006\002\002\222)r\005\353\374\267TZJ\362K\302\3726L\032\271"
+	.ascii	"\231f\231\305Xb}\033\257eM\033\325\023\031}\231\357\b\217\251"
+	.ascii	"\205u\366\222\367.\363o\371KNN\025\301\035mX\337FK5\332{\357"
+	.ascii	"\37374\375\033\372\347.]r\224X\254\351\351\365\334\354\231\231"
+	.ascii	"\313\222\207\2476\205O\b\336\031\031\020&\337\035\2270\031>\204"
+	.ascii	",\305\366\3369C\2672Hf`\235\353\362\226g\273L\227\355>\250\332"
+	.ascii	"\033)\333\345\230\331\033)\347^\f\356\305@+\351Q$\r\325\267\361"
+	.ascii	"\241\376YK\316\"\305\206\215\025X\3479$TVL\254o\203\003\313\375"
+	.ascii	"S\237\364\321\275\220\313q\307+.0\254\257,\325\366\336=4_\256"
+	.ascii	"()\202\365m\216\324\213P\313lZ2\\\206\362\226\251\344)\271J\266"
+	.ascii	"r\231\031.\267\035Ke7\2652R2[&\203R\235\364\330k\302e&\231\254"
+	.ascii	"\207\227&\023\\.\313iy\271\245\276H\352\322\334{\243Mp\330E\261"
+	.ascii	"\321\257\031ToM\226(ymXu\243\t\022\326\257\201\213R\303\246\276"
+	.ascii	"f\354\211\r\2152?\032X\277f+;\311g\227\231\3212\323Ln\013-79"
+	.ascii	"\362\373 \214\207\022,\203g\223/\251BT\277\306I=M\241z\032A\365"
+	.ascii	"4`\306\362\022\233\321\222\307\205\365i\354\3241\232+\352\237"
+	.ascii	"\227`?\032+!Br\210\341\301\023F\374\200\204\035)Y\001\366uF\311"
+	.ascii	"\022\251$\202\331\353\346\335\234\0334\206`\215\367\345A3\022"
+	.ascii	"\237\347$(\341\230\027hX\347\034\311]\332/\311U W6r\3770\n\350"
+	.ascii	"\205H\036\326zyy\320\243m\345\")\246\246\230\020y.\222w\253p"
+	.ascii	"\244\314\276n`\235\207\370<\023\031A\353J\t\3269\013\351\013"
+	.ascii	"\203\353\201\226\265r\020\232/:$\300\345r\357\335sS\244\371\364"
+	.ascii	"\003H\266\342\333;:\302\372\"\250\264\266\236\344\030\202\203"
+	.ascii	"H3[\345),\260f\241\215\257\255\033+\212la\345\253\334#\373\310"
+	.ascii	"Y\231G\376q\231\331*\357x\256\272b\216\231Xe\035\367\f\007i\271"
+	.ascii	"\241Z \353\032L\231}/\334t4\316\335AO\243\245\236&\207z\232&"
+	.ascii	"\3654H\352\207}\352\207[\324\017\337\324\017\315\324?\327\240"
+	.ascii	"q6\211S\202\2045\215\347\031dnE\350\260\376-\314O\230Pea\266"
+	.ascii	"\243\351\005\003\006\3319IG\263\016oaq'D\320\016w\301\322j\346"
+	.ascii	"\0279*Ce\251\f#7e\031\331E\216\221\235.3?a+\317L\271\305{\362"
+	.ascii	"SV\312,2\031\224\232f\226#\020\223\271tS:[\311\fH\031|F\204%"
+	.ascii	"\250\241\323\212\037b\371\t\323\235O\204%\250\341\322\335\220"
+	.ascii	"f~\302\205;\337Q-Q\351\321[v\222\026\005Z\357\313\203~yw\320"
+	.ascii	"\025y\tGk\253\257\352k\305\220\214\224\323G\345#\016\353\017"
+	.ascii	"\253\362\321uY\325MF\2421\307\206\365\207O\352\207H\352\325@"
+	.ascii	"\025\233\231\243krR\210\365\325:\365\352\333 \036#\306\206\214"
+	.ascii	"\256La\331\240\030"
+	.ascii	"\032+.\336\230\302\034\213\271p8\204UN\260\276 \026\374?\274"
+	.ascii	"lqH@\004\177\005\247\013\035\234\223\021\374\327\244\361\313"
+	.ascii	"\262\022\202\365U*\325\257\211\023\005\305\013\333\336q\363}"
+	.ascii	"*\032Z\037\f\254q\037\306|\030\314q\037\376r\017@\270\215\022"
+	.ascii	"\356\323{#\335\213\001\316\275\030\234oC\220\232\240\372\352"
+	.ascii	"\224z\301\254\346\306\367\205\365U\026\352\217\273\350My1\341"
+	.ascii	"\2015\316\303J1\266\260\300\372i\240\372_\36021\036\276\323_"
+	.ascii	"\340\n\315`\215\271\330 \321X\253\333S\237\312m\271gh\215\025"
+	.ascii	"e\240`\375\224M}j\246\376XK\026\375\244\311V\210\365/\023g\301"
+	.ascii	"slr\\\244\260\306sg6\233C\315\030\300\027B\260\306U\260\234\316"
+	.ascii	"\241\346bI.\216\347\016Fs\211\206q\211I\202\365\377\313\304W"
+	.ascii	"\260\225\345\356\271\177S\3406\326O\217\250\027\274p\377\207"
+	.ascii	"g\2170_\330\260\3761\034\215\254+K\254\257`\024\037\226\232\321"
+	.ascii	"e\013K\325\320\302\324bp\353\n\"\231\331\302,\306\004\356\270"
+	.ascii	"pl\370\tF\202\267p\022\034\005\177\341&\330\tv\303\\8\r\267a"
+	.ascii	")X\r\037\301o\330\b\366\302T\360\031\236\202\3010\024\254\004"
+	.ascii	"\243\341%\230\211\3110\033f\202\305p\030.\303fx\fw\341\345e\342"
+	.ascii	"5<\3448e4\242\242\260N\251\362\035zW6\247\226\342x\232\343\037"
+	.ascii	"\3260y[\262\303\372\035\252\250\251\215"
+	.string	"\2477\376\341\365\341D\267\005\353w\220\242\376\351\324?\264\361\023B#\b\326\357\020E}\2073(\250tF`S\017)\2036gm^{2\236\316\350\273Y[\2328\260N\243R\251\377\303\263\314\024#QRi\f\030<\246<\031\313\256\220d\275x\221:\365\250{\211\335\217\346\336S\036n\246,\3312&\205\361\324\211\215\207\236\215,\254\323\246\23452=-\033\351R\272\224\266\350A\022U\223\225\003\317\211\351i\213\276\234/B(3\260NYtx\221*\245J\030\317\2160\260F\027X\013\254\337A\311\314\315\244H\267l?q@\302\225gd\220\260\213\334>z\212t633X_\260F\317\244\333F\212\307 [\272\321B\256!N5\316\b\206\365%\241\204y\220\317\t\214\231\263!Y\003K\023\024#\006%\203>I\"\f\324Yd\226x!\203\216\031\216\261Qu\006\0354b9\241\202\365\003\340\246>"
+	.string	"i\202\202\372\310\325Y&\331\315m\355=\345\241FK\232\031\021\254\037"
+	.string	"\"\200\200\372HO\230\035\231\266\024"
+	.ascii	"_\320\205\001\003\006\365\273e\373\311\004\231\022,_8v>\\\274"
+	.ascii	"h\036\365\313IB\"$Jf\273\371\342\273\263\301eo\017\345\313\300"
+	.ascii	"\325#\f\225\315\030\231-K\320/G\371\004\315\350\230\374\241Y"
+	.ascii	"\236\314\220Ibg\207vA\235\364\370k\252NqyqzG\273\240au-\256\260"
+	.ascii	"F\3634V\315\021.<\262`\215rA\361n\244\254\360\346P<\364\016\365"
+	.ascii	"\362\252\263\353)\353\242\002\300\021*'\207\326\335\262\375\224"
+	.ascii	"!\f\020L\216\301\275\247<\320(\331\360\243\242;Z\367\267\324"
+	.ascii	"H\227\243!X\243Z\376Vu\306f\003k4\313\337ndIA\301\032\235\373"
+	.ascii	"\233Z\346\311\030\027\254Q,\177\223\313\322c\307\337f\270\205"
+	.ascii	"\315a\375\013\344\324\037\205C\341\320+(l\244"
+	.string	"\030\037x\221\r\237\312\264\b\261F\255\244^;\274@\301\372\0278A\253\\\200D\375Q*(\025\235\346Ag+\335\211\241c\234t\215a\375\013f\250\035\225\242\206\242\235X\242\311\302jQCfG\0134\254\3216\324\reC\327\320(\034\302\250?\232\206\246i-(\350\354\215\205\245mCM}\250\031\304\202\362\206\3659LQ\177\301.j\343h\026\372\003\005r\231\250\r\024\315'i#\251u\220\343\303\r\017.\035`\260v\222\"\345\341]\301\372\034\316T,\025\004\025\362\2459d\257\311\205v]\272\037\rH\242\205\b\252\305!\211\t\0051/\350\022E\202.Y\033l\242KtK\257\211\226\241g\250\031\332\004\035C\311P\346e\242K\364\310\321\037(\220\367<\371}\320%Z\244K3'0\314I\r\035\035\344|\034\222\230P`\322\207\212\241L.\023]\362\236\345F\227\240I\320\260K7\265\3341j\242"
+	.ascii	"\332Q\321\300\301\315\037\027=\034\250\376\3210T\211\3322\013"
+	.ascii	"\020k\024l\252\206\334\n\254\317\301\207\372\243^\227\211~\251"
+	.ascii	"\202_ne\260\276\340\371\252\004\351\321C=\007\035\3529@\241F"
+	.ascii	"\324\273\246\216,X\237\203\013\365\034\226\324o(T\277\201\214"
+	.ascii	"\372\r\177\3527\360\251?*\004\325b\306\005fA\265.\266\233kJ\302"
+	.ascii	"\372\033\272\250xyyP\017w\007E{\240X\250\217\177\230\243\244"
+	.ascii	"\315\007\024\254\277\241N=z\365\177\250B\020-P\260\326\367o("
+	.ascii	"\312\343\250\325?\304rE\266``\375\rX\324\243;\320\252\177\210"
+	.ascii	"\243G\344\t\031\326\337@E=J\005\2450\320\006\326\250\016ui\303"
+	.ascii	"\331\0064:\326v\340@q\034\325\361\2439\356\230l\007\202\3023"
+	.ascii	"b\260\276\271;(z\303\347(\216,p\3151\254m\356\016\372\rW\352"
+	.ascii	"?\\\224F\215\314G\267$\254\271AJ\375\206\255^\207\271\250\024"
+	.ascii	"\032\003\225\201\357\216,Qb\301\027\365\026\300==\241Q\201K\276"
+	.ascii	"h\206(\361\251\241PG\2432_\030\246\033\263\357\377\360\246\f"
+	.ascii	"\356\252\t\353[p\246\2420P\030g\331p\357\364\215\253\217\f\212"
+	.ascii	"\016\254o\001\222\027/\322)5G\350\244\364a}\013\256\320\026h"
+	.ascii	"\213\223\312J\330\227\346\232\225\214;\254o\201\224\212.\241"
+	.ascii	"K(\213\341\336_[\251\333\030\026,\272\226\2109\303\372\0260\241"
+	.ascii	"Ih\022\252\304%L\253y\272\350K\342\242\004\327%\352k\t\326\327"
+	.ascii	"0\006\335\350F\217~\241\220R.?\034*\\\n\247\260F\2174\370\235"
+	.ascii	"\204\204`~\032\262\214\031s\232Q\001y\244QU\250\364\312\3744"
+	.ascii	"\2031p\326\365\207\365I\006\337\3414YI\241\322\320\026F\314="
+	.ascii	"\353\200\244\263\225`\\\331:S\257A\311\tx\2029\003\357\231\272"
+	.ascii	"\333\324\027C\25445\030Q\257\341\207\372\017\367l\2029\3752\237"
+	.ascii	"\336h\033I\n\0039\036{P\203\032l\250\327\300\342\334;\367\316"
+	.ascii	">\020\256\324\235|?\373n\256\354\266j`}~\301}P8\256\304\340\373"
+	.ascii	"?\244Ar\245u\004\353\367\f\252\277`\356\251\267\345\354\342A"
+	.ascii	"o\264\021^|[\201\352{\372\356\266\234x\031O\007\311j\017\217"
+	.ascii	"x\3555{\360\324\367d\331r\332y}\351i\323\242\345\254\273\362"
+	.ascii	"\352\322<\351~\326\2451\336\326l\3640Q\337\263\245b\301r.y\255"
+	.ascii	"\235\265\255-\261~\317I\345\244r\306\205A\305\220e$cK\212\234"
+	.ascii	"W~\306}\020\207\032 \326\247\225|78\250%\n\326\027<\253\374\037"
+	.ascii	"\246K\234(\261:\253\234pS\\\332\214\3449\275\365\3465w\276\341"
+	.ascii	"!Uz\201zX\277\347\224rJ\361\362\253 \314\271v\256\235m7P9,\003"
+	.ascii	"\t]\f\266\237m\177^a1\256*\300E\213\f\326\257\240\356L;\323N"
+	.ascii	"\265\353\027\225\303\303pi\205\254\n\312O\265\n\324N\264\023"
+	.ascii	"M\037\341s\332bR\332\242\204\365+\360:\317\3163}D\001P\3124\367"
+	.ascii	"T\016\017\2720\256\212\211\365+\340\301d\236e(,\251KRr\262\303"
+	.ascii	"\372\0250\221\221\235e(\360,\211J\341\005\b \326e\\]=\232\260"
+	.ascii	">\005`\227y\202\235c(Tm\031\036\226\324)\301\222"
+	.string	"\363%\207\245y.\3719\366\237J\316\260\223\tNk\344\r\271\202\365\025\274\301/&\326\247\230\317\317%5P\344\316\024\301z\347\356\240\031\366\345A\361\362\356\240\247\200M\375O/\257\373\027vD\301\027\022$\372\310\215\342\261\007\365\305\207vG\001\327\331uv\275\325\245\\U\232V\260>\005M\352\317\"\367\344:\271n\036^n(\021d{P_\024(\251$ \2747\017\375\207{\0169\263N\"\177\273;\306\276-\252\302\24047\324\376p\2363\352y\002\325\377\frf\235Z\371\253\001-\230t\330\223-\236.\352y\260\364\370="
+	.ascii	"\341\314:\177\\\270\273\227\266\212\255\2604\236(\352\325\325"
+	.ascii	"\351\243\203\322\336K[EU\330X\023\353\247\217\233\247\301\023"
+	.ascii	" n<_\352y\262n\234;n\234<\252~\362\310\001\323\226\365"
+	.string	"%o+P\310\021\3268p\234Tar[9l6\334\222t\374\244\312\001\024\343\333\302\372\314q\363N%6j\360\361\344P\317\343B\352\254!uN\235S\247\214S\306I#L\252\203\314\006\313L\310\3219\343'\215\343\210\2755\307d(T\237\201O=\243\316\250.\267\fW\316\027\347\323\371\342t:\233\316\246\323i\004\260\034[*\026\026.)\030\227y:\235aR2\254\251\317 v\"\235,N\244\263\305\311\364\263E\236\013\322u\317\306\272\246|`}&\235I\347R\030\264\320&.\210\213<|.\025\321\013\302\005\353S\351\236\375\037\342\220\035q\335a}\301\354\367\1778\004\024,\023\206\3653\034Q\237\001K\275\036s\317}\356\013\327\263\217\376:\214\371e\250\241^\233\271\232\220\360J3\003\222\372{\377\320\3531W\227)s\341:H\323\222\342\232\201\352\357\205C\257\303\\=8\210\357P\330H14"
+	.string	"\263S\177\361\035*(\350U\267\223\006F\003\202\321\177\315\246\376\273\033J\020\325\342\226C\345+\311\314\357\372oH\210\305\353\306\335\377\341\317[\220A\254\277\203\245~\2021\352\257\371\230\232/wy\b\253s\"\270C\016\353Op\267\267\307\203M\375u\227.\271\310O\245}\365\265\265\367\324\207\033.%fIX\177\202'\352\257\363\362.\334-\333O4,bt1\031\334\333\312\007}\006\f\036\020\254?\001\226z\374\345\352\273;\334w\227\373\351"
+	.string	"\\{P_1\324\343\276\253\355\354p_\317>\362\353"
+	.string	",j\202\243\272:4\314\r\203\226,Y\264\226\033\2657\222\216\016S\270hZ4)\215i-s\027\f\213-<\254\217A\211\372k,\277L\215EGy\250\332R\032T!\353\032<\307\260\260\002\303\372\030\256\336\364\2257\035\207\0068k\213,Z\241=\332\034\225E\251\007\"\210\204\212'O\362Hd\225mr\2508\354!\022*\016{\324\007\201"
+	.string	"J\036Ye\033b5\026!\213\311c\b\266-\nA\001\022Y\224L\016%\323\027\206\330 \345P2EA\\\221ze\213\2104\033Td\225-\372 \020\031\224\307$\t\2426\005#v\230<\022\037\240<&I\334\264Cl\361(\204\342<\b\304*tT\206h\3315\305\2215*\177\332\024\332#\022y\024B7<\bD\b\343\212<\022\223\023@\241\301\204\n\220`\241\004\022~L\0301\201\024~J(\361c\202\004\206\007\201\bQ4\256\310\023\304\244\t-\211\225-R\022W\024:\017\002\021\302\210\275\2408\001\2426\2056HI\024\262\200f\375\331Ab\b"
+	.string	""
+	.string	"T\020\r\225\220\201\362A \200\210B"
+	.string	"\021\025\223E5I\024\370l\177\200\210l\224?I \2423\tD\224\203\224@\311\025\211\256 8\266\272mW\326h$\246*\210\206\212\232U\022e\343\232\004:\"\211\251qm\213tr\350\250,\256mz\366\007\210\b\304\215\nV\331\036\201\326\022\030\350t"
+	.string	"\242m\001\305\004;> \210xr\214+[\004tD\221,\321\036ut\204N\350"
+	.string	"\321(\223k\221]W8\266-P\272\262C(V\007L\340Bq\r*\301\210\275\031\212"
+	.string	"B\250\310\304\001@\b\025\2318\266-;\304\351\300\007\304\312b\300\021*j3\b \204\212\3323\r\001D;\2549\266\255\001@\26477m\211\265e\211D9*X\342\021y4*\"nP\256\0170b3(\213+{\034\241ByD\022\213(\340B\362(\001\345\332\256BE\355\312f\020\"ZA\350\205\025xV\226\004#\266\007(ylI\030\261;\032\264-\250 \"\327\021F\304\024\3265I\201\362\230$a\304\242-[\204D\222\240\001\233\242\036\200\020:a\024*jU\032\021 \204N\030[\033\234V\350\304\210c\333f\370"
+	.string	"\204\320\tc\253#tb\204\320\211\021\030\332\026\216m[\202\250MA\331\022\221;Dm\n4Dm\n\030\322c\333\226P\256-N\221\275A\036\225\311\026J\030\223+Q[\324fhW$\221\020\321\204Q\t\242\243\013\355M\333\202\222\004\245\321\252\202\021\253c\\\331c\321\007\326\022@\311\243\021\333\243A\013\306\344\252$\"\213\212Hb\361\303\n-\262h\005\343\021IL\221$Qdw\214G$\261\002'\030\261<\347\203@"
+	.string	"\025\235X\215!\214\310c\321\211\3258\224\302p5\016\245\220$\321\2220b'0\256)\216kq-a\304\352\260EC\307\024\304\240\325\001m;$\001$1\tt4aL\222\240,\256\312\325\210\201\006<8\035\200P\262D\"\020k\021\222X\001\344\221\210\302\250\204r\005\3429\266-\253iR\260\300\n$L\230(q\363\002\261D\221=U\020Y\226\204\026\203v\005J\022Ih\215\304\225\325\220\034R\022\331\242\022*\220DD\304"
+	.string	"\324\360(\223EC%\340\264EC\307\024+\273\002\016QI\034QdQ\343\n\244$\032\211\212x\220\310\242\244\016\022Y\224\314)\241\004\022Y\224\274i3h\177\222'(\327v-\001D\024\200\027\217\354\232\\\201\324\177\020B\001B\020\301(\275\b\b\350"
+	.ascii	"\001\035\240\027\001\001>>\b\b\301G}\b>Y\331\262\253R\271J\240"
+	.ascii	"\310\352<\b\b\305j,\236 \212`\200\020@\370@\204\007>,\2240\201"
+	.ascii	"\004\036\2265\001GhU\266*L\344\034G\371 \020(B$\207\204\204\206"
+	.ascii	"\212\033\\\270\355\017\273*\221\307\023|\224D5\253\222\250lO"
+	.ascii	"\345\372\263\026\331\242!\023\312\037\242\022\271\216X\205\216"
+	.ascii	"\312\032\226\030T\324J\345\020\013\306\325\205\344\021\251\266"
+	.ascii	"?\311\241\243\362hL\016\225\220\034:\niX\177\214$\214\206N\244"
+	.ascii	"F\022\253qH\b5Z\215I\022E\304\034\345\203@\264\253qHH\003\321"
+	.ascii	"\2524aL\256i\373S\304!Z\225&\224,Q\331\016W\240$\221=\327\237"
+	.ascii	"\232\342\021hH\002\253qHh\370 \020-r\210U&\207\212?E6D\021\005"
+	.ascii	"\207\021\"\224A@G$\n\235\027\206\2208A@\307\240\034\243\b$\221"
+	.ascii	"U\026\255\311\341\212T*\207\330 \345\217Q\2041I<a$\256\306\235"
+	.ascii	"\027\206\2205A@\307\240\037\243\b\345Q\350\210\2641\212X\215"
+	.ascii	"CB?\3065\250\250<\276\320\346(\177hV\"\025,\\\240\204\t\233\025"
+	.ascii	"t\224\311\242\242\315\252$\226\bjW\026\305Z\302\210\275a\225"
+	.ascii	"+$O *\211#^ \2260\022\327\022E\266\206U\2560A\362\204\266HIT"
+	.ascii	"\232`\225+\354 \207\206\034\360s&Oh\333\2658\304\256Pdu\224\353"
+	.ascii	"\003\212\354\004\312\037\245\232<\241m"
+	.string	"a\025:\262\260\n\021\331\023\212l\016QI\034QCT\022G\f\333\237UIT\232X\205\216\312dQ\t#V\007\210\310\210\245!\"\n\025\331\223]\215\307\024C,\221q5b\221\304#\273\266\030\214V$Q\321\b\024Hb\020M\362\330A\371\223\002\021Y\030:\376"
+	.string	"\025!\211z0(\327ve\215\311\343\211\037%\261\375\021*b\225.\254D\355\006\233\025I,\322(\3315E\362Xd\215G\2413y\024R](\256AE#\242\220\232\323\"\211)\222CG%\0219D\304\256\312$\211\"[A\273\256,\320:bE\002%I\020\"\226\220\202\b\305\004F\344PP\273\262A,\254Jb\212\243\262H\302j\034J\201=\022{\222\307\342\332\026\375\030\021\205~\214\330\032\243\"\342\217\021Q(\247e\207Xv\345A\225k\213\002\305P\315J\244B\211A\003\n\024C\312\242\""
+	.string	"\332\243\021\361\007\250\350\304jT\026\021%\217\025\254D*\224?k\212\243\222\230\342\310\256F\016\354\220\262HD\3613\244,\"\376"
+	.ascii	"%\217A\312\241!\241\366\247\310\366\030\207\216\354J\364\203"
+	.ascii	"\202\b\371\263\n\021Y\024?E\266\3759\266-\253\301x\374Q\036\223"
+	.ascii	"E7\036 \215\3306G\331\022Q\374\030\213\210'~\332\242\023-\016"
+	.ascii	"\233l\177\214\330\237\265-\372A\321\262\305\034\345\217\007\""
+	.ascii	"\\h\211B?m\361g5\036YvM1\364C\324\nY\220*\211Ve\253W\024\304"
+	.ascii	"\026y$\236`\304jP\376\210\240L\036\213\322\3258$\244\225\017"
+	.ascii	"\332\371\020\321\312\206P\016\r\261!j\214\210B\271\375\001:\242"
+	.ascii	"H\016\225\260\002%\211%\220k2I\f*\301\210\245@\371\023\202\217"
+	.ascii	"2y,R\357\343SB\207\026Tx\200Z\004a\304\2060bC$\217D\241\020E"
+	.ascii	"\266\r\001b\202\344Q(\377W\225R\244\0345\036Owj\222\216J\227"
+	.ascii	"`L-\025I=\"\2027\244G\315\222\2172\203X\377\352N\013k\210|Y\002"
+	.ascii	"\205c\245M\013\326c\306\244g~"
+	.string	"\020\240\nY\327\340\0313X\212y\305\207\2312\350\036\224(Yd4\324p\t\327\006#\223w\234}Rppa\375\f\272\324\235\223Z%\261\212!\006\343\351]\201\275\020{s\022<y\\0\1770\322\002\261\270\326\302\260\326IqR9\376\316)\277\323\tg0\356\256E\363lq\276A9\372\001\246\211f\206\323\024\230\276\024+\275R[\322\302\247\377T\036>\310(}\321Gl\374\350\261\207\372\371)\t#$\365\242\255\374\001va\202u\212\227\342\245z\303\r\005\330a\316-\315{\252\207\202q\021#/\003\037\252\026-)\227\"\351\221&#I\352\236r\261{2\365$\335r\201T9\002\202\3653HRS\272\373gw\303K\036\006g\324?\315bV\2439\2257\207v\251z\242A\006\3534\311\t8\244\246X\261\222\306\375!\300\216\314\225\247q\272\214\220\360m+\257\nZ\207CF\214+7\267\364\355\217"
+	.string	"U\354\300\344\240\362\364\355m\351K\340\026\254\323)\251\2249\365O\333t\334"
+	.string	"X4\265\245\245\245k\002H\332[\2422\230By\272\226FaZ\265\270\222FI\325\206eM<\224"
+	.string	"\301\002\b\205\371\004\337\325`)3\003\207v\366\305\t\311\242\206u\332$m\222\236](\300\002\2105i\0351{z\226\343%\353-\016\353\224\211\357\266\020\016\021\203AU\331\271t]\004:\201\221\245-\266"
+	.string	"\226\271[\246Ni\027\322W\341X\366\303\001\262\245J!\223t\006:\266T&\2105\026;\nB\004\353%\316\020' :\302\316\261\232B\255\300&JP2Y\216\r\211\027\030\027\227 da\276\364\22090r\\^:\213\254\213\271\005\353\247'\255*$(\237^\025V\023\326D\210\244]_\035\244E\236v\245F\242\306\376\250\244FR\256\033N\222\244]\271XUX\304H\267r\033\224\030\251;\fX\244Z\251V*\344\023 \345\370\240\013\252\214\214T\b\212'&\004\007\016\254\337\201P\375\323 ZK\216\221$&XR \272\312\005\030\221\247\037i+\210\245)e]\333\230Z\201F\206u\215\247:j\244X9[w\357\251\235\244\264\251\250r\346\232\262\250\0067\323\224\207\224Y&\320\306\216\247XO{x"
+	.string	"Bz\225\305\005\n\223\364*\333\231\220\004\307\036\326\251\325q\246\346\2444\261~Z\225\362\370\2074]XL/\254\337A\213\372\002\004\207\t\250\323Q\023\213X\254\346(\006\231QH\210dh\223\f\007\323\025@@@D\032\222\t\327Q}\023\300C\213\213\245y\240\006\231bfHDD$)()Ie:\222\350\003\036L\241\027\0349\236i\374\377\001\300\326\263\220\316\376\322\360\0343\304\357#\027pGv\322\027psLrD1\252\215\360x>\244\331\031;\003\346\262?\356\202\231\276\252\273&\353\206H\327\366V\256\357|\355\340<\246\211D\024\267\335j\r\216\006\026\221\034\264b\274\334\337\252\265\346\270\340\256\244\247\235\006\304\205\267\034\306\261\f\340}\270$D\304A\351"
+	.string	","
+	.string	"!\305\247{*\t\310\244\036\346\314e\"\236\f\376*\377 [\036S\214\220"
+	.string	"\030\340\005\303p;Rt\006>\027YD\262\346\303C\013\203\2620$cW\325\035\0131i\255\266E\333\b\306\375J\372\203\023H\2633\342\247\246\343\223\312#\016A\373\027\325\371?>\323\021[\300\250\217a\301\231\221i\277\032t\273\237\247R\323\202\f\371P3\247\201L\322\376\346c\025\323L)\243\212\240\001\207\3758\017IL\321\021\326\217\205\007J)\247\03182\016F5\334\267\211\372\025Iy\013\360\312\230\tH*Y\250\330I"
+	.string	"\273\"ni\\/\177\370\316)\220\203%,Q\021(\327`\224v\036D\217}2\3614\030\353TX\251\004t\026\023@0\352\013:\"\335\252\017\340\034\024\302\337'\023=\002H\003o9\304\336+l"
+	.ascii	"\\\r9ZfO\361\3269\333s\370\017\312\267\342\227P\366\265\327\301"
+	.ascii	"\370\035\3033\177JZi\005!=\350\0161Y\230\272rA\361M\270}\343"
+	.ascii	"\376\022\233\317\375@\315\201\3347b\360\241\024\344\256K\303"
+	.ascii	"\244\252^\344\347\342"
+	.string	"\315\366\330\016\021e\376\342rgZ\261\214\bY\306\2658\247\322\336\276)P\216mR`T9$\235\016z`\363Cm\264-\007XFf\005l>\t7]-+\021G\220\233\212\205eYwE&L\343\356n\200\374\305\255\252>6\247s\210\307'C6\034\004\005k\013\300\260\346\013\373\2765)\241pu\305\233*\376\251\177\213\t_\262ad\355\240~\206:\210\337'4\261\235\352\\\231tq\200\250\206\367\037\307\257I\207\351=\343]!IO\270o\271\336pU=\210\277\361\222%a\002\341\370\264Ei\3016y\331C\227\205\002\375\202\233\334\300@8\224\377l\236:X\330\304\006\361r~\347qC\344$]\030(\374\n.\227!\031`c\242\345A\006p\346\033\217+\220\213\350Q\353\200Py\211\277\251])\277s\037\326#\013\034\306\205\032\374\267,\317V\351YR\033\211\306\344-qAk\253\326\311Z\377"
+	.ascii	"\306U\264\307\375\337\276\206\311\254i\\\037\337+\231\232\244"
+	.ascii	"fY\023\266\360\021\377\017\206\300\256\246\313HI\217\214\030"
+	.ascii	"\312\312\365\226\315_\247\271\226\001\030N\211\367Z;:\243\304"
+	.ascii	"\006F\337\371\006\203\230\317~_\253\214V\204k\257\035{\226*\243"
+	.ascii	"\025\005\210"
+	.ascii	"k\367e7\272\372:\\b\346\001\350)T\366\351JZ\275\323\237*$Y\300"
+	.ascii	"\373\253\364\314e\343\2317:\371\324<1Xh"
+	.string	"\371\231Z\377\323\244\355;\203\2074\331\212R%/\207\327\005r~\2369\006Y8\330\341[\351\\\210t\273\220\3452\247+/\224fN9\224M\312\236\324F]\352d\f\bM\340\305;c\032GA14C\362\\\3440Jp\024\365\033?\241^)\017\320\304\024@\222\260^j:\n\366\023\356\304J\032-w\326\224\246w\270jmk\352\n\364\016\001\266\024u\212c\026E\334\240\031\006$(\032\232\210\252\346~o\202\354\263\013\357\246\267J\t\333\325c.'\254D\306\221\351^\271\225\362\363\022\277\321.1\250\222\342\005\363>\0217t\013Y\020x\230\322\\\364y\005@W1\375\242\376g\220\206\356\3119\003D6`fe%1\264\234\275\b\336\267>p\220\303=Pg\207\271\0063\327\341\375\222\217Oa!\346Lcp\344\232\306\037\237\232 \264P\354\013e)\n\036n\373\243l\337\212\3568\225\343\373\214F"
+	.string	"\004\365+\f\260)\r\341\n%\2435\307\013\323\275_=\250\306\n\306I\226\006x\372_5k)\314{\320\203\331\f\0225\002!>b\203\314\220\177\334v\335\251\335\224/\310\221\250mWq\2732\004\035\t%\2464\335<\357\004b=\031|\r)\252\013S\353\200\371\231j\225G\270\022\035\023/\016\366{`"
+	.ascii	"\270j\037!eN\022%\205:\2541\354\372/R\013\003\251:\261\\$\256"
+	.ascii	"\211(\262\213\350N\030E\276\237\356\357\035\213\024F\005\373"
+	.ascii	"_=\005\364\257\3500C\020\344\006\213\220\301C\\\237en!\376q\221"
+	.ascii	"g\001\260C\311O\233\202\212M-'\317\372-E\341\377\177\3116(\034"
+	.ascii	"Q\236\302\346\247s\b*\351\233Kh\314l\262\233\324\002;q=g$\340"
+	.ascii	"\350}\bg\310\270dj\254\265\271\300bk\233\267\255\361G\221\216"
+	.ascii	"\366\177\276s\3441\0223\336\205\23079\217\353\230i\034\016\207"
+	.ascii	"\025\200\361\2319G{\257]J\303\034\223\341\310\205\203\032z\332"
+	.ascii	"1\034\346\024\224w\037,\203\215\365Z\245\336Y\366\330\243\357"
+	.ascii	"o\320Z\270\221\265\027b\223\342\373\235G\201B\224\234<.\350\361"
+	.ascii	";\227p\375\202,!\206`\004\255x\361M\257\254\t\026>0\221k\r\351"
+	.ascii	"-{u'\302\350\371\247vZ\2565\374(\030\267\377\227\372%\355p\327"
+	.ascii	"\"\236c\266*\275\375\205\027\234B\033\372\222\260\210\300\005"
+	.ascii	"\211\032R\306\361k\204\324\202\005\364g\363]\215d\031\303\240"
+	.ascii	"\203\024\335\227\215\255p\303h\355\034`\r\340\204n\030H\314\024"
+	.ascii	"0&\332\271\251\352\024XJ(\306q,\365\026Ok`\333\371\322R\223w"
+	.ascii	"\372\210s\244\200\033\245`\016I\264\317\345\002\001U\254`\345"
+	.ascii	"\365[8\2554\230\025h\236IZ\233}X\351\204\030\232U\360\320\326"
+	.ascii	"\t7\221\212\302\275!\2556\345\027,\230\234u\005\264n>\375\336"
+	.ascii	"\f\370L\305\320\260|\320\204\262: Do\332aSN\300\030\032G\304"
+	.ascii	"\257\261e*=L\320\003\325\351\3647\367\252\312BF\235\2135\234"
+	.ascii	"\333\016\370\265\034\034\212\375\204vyhR`\"/\311\206\033:\272"
+	.ascii	"\001\215\215DU<\251\361\350\034\331\3113_\250\246\\\\\270jl\t"
+	.ascii	"\276\262-\\W/\t\t\354\323\217}j\022\2371\027\362"
+	.string	"\tO\343jb`\316\211\363\304\245\254\213\361Nu\034\330i\035&\373N\260\252\0023\354\270\026Ur\276\3210#\331;\351SHT\320\007E\267*}\271\225\032\360\312[\355L;\267D\220]rF\262\034\376t\240/-\3625\254/\324QCa\001/\215\030qa@\371\225uc\204\3144J\\\241\365\360I\307\353zB\330Z\301\263\364?v\360\233\031\021\210{\313tr#\331b\313\f\3633:]&#\226]\331\f\371\332\274\b#&\351K>\205\263\313\306\361\224\366\214{=\031[-\363;\230J\374\357\271\230M\310,\031~\201\204\367>\263\034\347b)\022=\255b\036\376\365\260\0313\004\027\027\200\227U.\317\226\242\t\253\323bZh\261qA\206f\031\2227}W-\252\267C\3427T\203\305N\036\310\375\236,_b\b\357y\363\262\237\f\303\036\305\214=\370\232\303t\016/\376\247EHj\306\301o"
+	.ascii	"\236\205\326\031~q\0333\324\254\370\277=5\244\274\277\265C\305"
+	.ascii	"RwGR\324\305\235"
+	.string	"\225\217y\265\177\216\346\346\244\2429\221\3733\223\265f\024\362\216\324)t\016\363f \276\236\333\340\260Y\340u\033\017-\230\221\202\370\257p\205l8\353O\200$\n \205\300W\200\340s\260\215V\276\022Z\370\301$\203\022\364L3\003\016\310`\370\3010\b\\\351\264\362J\006u\205\0228z\026=\306S\275A\224\325Bj\257\030\374m\2215\206%\2747\206Dy\021)\214\365\212S\037\265\2201xB\210\314\336B\"\324\374\376\356\253\355{Q\220%\204Y\210\343\033\320\n\200[ Q\370\253\313d\266\365>\326\036\031\\T\3609\363\t\033M(\205\375{\275CI7\372\320\306\323\200\232\250\313q\0373\305\027\004\302\210\201\371K\346\037A^\375K\370\200\002\251b\r\317h\243<?\317\177\366\202\3126,\271\216\203\2610N\364\032P\356C\263\215\210)\352;\037\236&Z\202]\341:\302\326\203`\231\001\377v\262"
+	.string	"\270\207O ,\274,\007H&\300\021\226\177j\362+g\250&\nL\020T!\"\001wg\324"
+	.string	"OU"
+	.string	"\367\211\217\252\221\345\332\033\227\255`q\021\221\251@\022\312SDj\274\237&\345?\247\243J\2325\001x\310R\302=\335Wys\231\203$\200C\255\032\262\312\021\027t\033Y\242\203t\325P=\212\001\345\271\252\253\351e\002\013\003\261\367gX\340\354\227\236\376\370\232\244Y\215V\335\025}\374\205ae@?\177U=*\215pU)\276\210\002\242\003\230:\205\251yM\305\374\257\304~\225\35459\200\366\316\017\310\177\026\260GF\221l*n \330LK\313\337R\305\252se'+Q\266X\2558`\24510\205\340\351\202e\245\352M\324Vt\274\234\030aj.\211\021\254\330\004u\r\356|\025b\240\372\364\202\0362X\fe<\250#\235\327Y\t\017m\301\314\330\020\2327~?\006\261\314\344\370\177\003r\356<\030<\255\377\205\215+z\037\212\320\030\323eWi\360"
+	.string	"m\362\013,\360Y\361\200\261\254\253Y\261\007\227x\306\351\030\357\r1\334\337Y\375=\347\343\223Km:\\lWZ\275[Pa\333R\017\250\253\005\370\366A\024\024\017@*J\257\001'\245\242\325K\305g5\371@\f\372r\216A\244+1Y\240\307\002k\020\277)\303<\362d\224\234\246\276x'\177\211\261O!\246\202\202E\217\243V6\212W6\315<\2025t\\\312\373\346\272\016\t\2168\354\344\300`}0+\235\326\f\241\r0\224\203\024\004\031d\023I\355\273"
+	.string	"8\221\237\331\270*\310A\243\267o\271{I\206z\222\351Y\225\032\347\316\350\002\205\0215F\016zV\023\2078\033\023D\003\" \340\265\007\374u\354+\377\002\370\003\023\352g\231\020\375\324\364\221~t\304\315\234\206]['K\223\\#N\2471.\2304j\t\367\243\311\303U\246\r\267\272\224\266\333\031kb*\206"
+	.ascii	"e`JQdP\235\3715\\\325F\365r\202\264\210\203\341\356\367A\024"
+	.ascii	"\024\226YVU`\347\024)"
+	.string	"\302\2012t\223\233\346S\274h\027\203=h'\223\270\333XCz\220\232y\360Q\216\032*\004+\n8o\2742\277\252\376Y\024\233Z\334\216\340\306`\233\035\311"
+	.string	"\003\b\362\265\340`r9\327\215M-."
+	.ascii	"k\247\275\031J!\230\257V\377\227\226\024%'\217\227\333\273\225"
+	.ascii	")7?7\220\217C\2271\001fO\350\276\376\005\245JA\212\372\\\311"
+	.ascii	"w\277\373\241\300*\243\252\272[\007\314\233\201\306\373\004p"
+	.ascii	"\270\305\264\222\036\bE\373^\375C\362\224e\376Y\013\303\253a"
+	.ascii	"\321$I\230E\307\2062j\204\323 O\031\037\f\250j\304\247\026\322"
+	.ascii	"80w\211){\374\365\033\263\346\370\3774\003(\006F\271\200eu\235"
+	.ascii	"\013\035,\260\361t\320\307\245\342\355\341xJ\270\237\206\357"
+	.ascii	"T\2118\251\310\b!Y\324\340E\367\337!\232oK\037\270\315\033[\346"
+	.ascii	"\377B\3355\r\035q^Ew\317\344%p+x\303\333mr\225\216;\234\323\362"
+	.ascii	"\317\030\233\034\247\355\022\215\257\340\375\251+\346\030\205"
+	.ascii	"p\211a\346\250\262g\3459;W=m\205\341?\356\364\202\304\376\362"
+	.ascii	"CT\207\230\343\177\314G\217e\270\036\262\001\212\342I\320\237"
+	.ascii	"\213\b\340DPov\334&\3311\203D\\\227\351\313$\036\223\037\234"
+	.ascii	"\024\267G36\247z+\364\366z\007\364\235\330K\322f\300\342\035"
+	.ascii	"\024\236\303\233_df\"\277\302\347\237\326\314\211\326\352c\027"
+	.ascii	"&\261dH\322C{v\377\312\303\365\376rV{&I\330\365\360\234G\235"
+	.ascii	"\2353\3714N\362\262\037h>\031U\017\234\243\275\303\252\\B\335"
+	.ascii	"kq\364\234\255\270r\376\031\300\243\322\377\243\226\300\266!"
+	.ascii	"\306>\376~rx\272bl\341V\3538~\324\377\376cy\2126\267Hhn\321\025"
+	.ascii	"/\361\032\233$\233E\374\017\210\235@\323\370&'\375\373\261\307"
+	.ascii	"\275\224\347a\254\221\271k\033\237g?\311\030\343\233\007\260"
+	.ascii	"|\256\344w&\3537\020\373\320k'\017\031\363\0014\003\033O\263"
+	.ascii	"\366\232\216!\202d\243\314\333w\23536N\n\277C\214\331\266Wj\371"
+	.ascii	"d\364\342A\r \036\307\221f\327\310]\220\026\002\313\177\236\013"
+	.ascii	"\227\273\371~\246\271{\335\275\200\377\203F',\355\346\372Q\247"
+	.ascii	"6\365\224=\303\367K\364\315\f\017\321\276Z\343\317|\377\004\340"
+	.ascii	"\266X=\351=\305p\243\334\214\305\\8l\030>\247\371\021\253\223"
+	.ascii	"\0306\273\007\375}\372L\272)hG\313\351H#6\r{\213\374_\244\323"
+	.ascii	"\025w-\327\306\030\210\270T\322?\tXh\347'\351z\366:\375\367\210"
+	.ascii	"\223\317A6\023\260\276\265{1\324\333\342\307x\305\353\261A\031"
+	.ascii	"\227\330\373\237&\354\024\231f\3626\375*\233^s\310\377u\334\216"
+	.ascii	"c6g\246\r\357\034h\206\365!\311\375\252\377\025\232\337nV]D\373"
+	.ascii	"\310=\257\316\214\257m\220oG\366\276gN\0228B\3666b\003a\366G"
+	.ascii	"b\350\252\017\3639\364\226\374\366eC#1\003\376\322v\230\265]"
+	.ascii	"\214\374\343\365'\231FP\335Z\310%^\204\354\252x2\361_\007\013"
+	.ascii	"\031\301K\300j\230u\033\267[\230;B>\257\345\323\247\375\376\357"
+	.ascii	"\326\233\246\021L\204\275m\340\265\256"
+	.text
+	.section	.gnu.lto_.symtab.ab32f613826644d9,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"rcInvalidPulsPeriod"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"setLinkQualityDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"rxGetChangedChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"getRssiPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"getRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"setRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"setRssiDbmDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"linkQualitySource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"rxMspOverrideReadRawRc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ab32f613826644d9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,300 @@
+	.file	"rx_bind.c"
+	.section	.gnu.lto_.profile.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375 1u\001"
+	.string	"t\002%"
+	.string	"\004"
+	.string	"\314\207\332\246\017\002\002"
+	.string	"\002\001\002\372\266\366\312\016\002\002\002\002\001\003\363\240\215\235\004"
+	.string	"\004\307\253\231\017"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375 .%\001"
+	.string	"\300\""
+	.string	"\004"
+	.string	"\001\003"
+	.string	"\001\002\001\003\001\002\003"
+	.string	"\003"
+	.string	"\002\004"
+	.string	"\003"
+	.string	"\002"
+	.string	"\004"
+	.ascii	"*1X\202\274\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375 \340\255\003"
+	.string	"\002\306\024 \220)\351\357\016\3043\354\255^Ob\231n\273\335\273\342h\335\016gff\324\016j\310!R\312\024\017\375\241\252\020\317\351\323\005\212@\177\3569d@$\tf\002\366\277<\340d\361x\320\234\r\277iUU\352_n\206T\026\346#\324\321\250P\230GG\002\f"
+	.string	"\237\202\003\265"
+	.ascii	"l\\\031\"\b\026\216he)\240\354\253\243\217 \027\313\001@\331"
+	.ascii	"\273\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375 N\345\001"
+	.string	"\244\002B"
+	.string	"\004"
+	.string	"\001\001\003\177\002\003"
+	.string	"\002\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\177"
+	.string	"\003"
+	.string	""
+	.string	"\002\002\001,"
+	.string	"\004+"
+	.string	"\300\004\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"@D\315\303\234-\250)\330\312@\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\230\004\003\230\004\004\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375 HU\001"
+	.string	"\310<"
+	.string	"\004"
+	.string	"\001\374\007"
+	.string	""
+	.string	""
+	.string	"\001\002\004"
+	.string	"\001\002\005\001"
+	.string	"\002"
+	.string	"\006\003\004"
+	.string	"\007"
+	.string	"\240\020\\"
+	.string	"{`\260\232\325\202"
+	.ascii	"6\320\006"
+	.text
+	.section	.gnu.lto_.lto.9a845b9ba8ed64af,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_doRxBind.20.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\225\013"
+	.string	"\346UO? Q\224\016\237!z\2430O\021\301\224BDt\336\254 \037E#T\260\240\250Iq\264\263\355\023\354V]:*\331.\035o\004\f\200\360\220\027\016H\346e"
+	.string	"4\243\003\f\247\365do)S\n>"
+	.string	":"
+	.string	">"
+	.string	"\222G\333N\240 d\355\036H\007\203T\t\305\310\256w)\210k\207\232\232\037\240\333\016\007\\!\001\030\036dX\335\b\"0\275\350 \240#e\002\300\354\256\223\3538\334\361\266\033\330\266\330\177\020\250S\\x\230P)Q~\266\267\245~\330\207\253\037\\\375\364\307L\253\323\251\351O\024U\n\241|\273\035\337\215\025\211,F\330\016\331\226\355\314\237\264\312k\2548\265\330\365,6\020QU\235\245\034\242\374fH@v\303z\354\201\t\211\021\032[\342\270\b\316$\242\372a}\206\352Z\340D\fR\332\260\215\335\204\005\311\356.\360K\334\363\370!\036\215\341\223\347\036\375O\365x}\232\316\306\001\246\251\234\271h:\033\t\020@\331\005\312\256\316&\002\347\312d\236\353R1VaBv]\300\260\354\262\274=T\230J\021\242\"}\255J\325\240\306\210t\004\255T\265)p\362\\\205!\351\346\023"
+	.ascii	"b\b\b\303\254&Z\255\367\201f\313c{\233\350\244\016\273\370\002"
+	.ascii	"\\\206\213\212\276\241e\226qa\374\030k\267j$\017&\207g\333-\362"
+	.ascii	"\336\327\324\003"
+	.text
+	.section	.gnu.lto_startRxBind.21.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375 \330\025\006"
+	.string	"\"K*1PO\323\030 \330\f\n@\315\304\030\341\005\327\2601\263K+KmqD\304\346\243dC\354Q2H\220\231!L\335-\263\2006sK\243\237\310-SK\321\003590X\317Y\317QSC\204\223\336\204\213\004\256$ \236\243\250\252\347\236\270\251\032U\350B1v\332A~\205E\313L\025\312P\354#\326\324\343\323Y\325\374mu\02486-\003'\273\230\027\227U\001H\t\371\257\177FH\270\206\031A0\3311\242a\262\331\215N?\022f\203g\212$\001\311J\t\013J\006\313\026\260\260\273\267,\263\221k\376\006\177\301\017\003\b"
+	.ascii	"2\003f:\003-\004\347\032N\030\341\230\020$\334\271W;\237"
+	.text
+	.section	.gnu.lto_getRxBindSupported.22.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375 \330\025\006"
+	.string	"\"K*2`M\323\030\300\020h\026XA\333\330\232\371\0226\324A\007\264!"
+	.string	"\255\216\304\366\313C\306\301\377\301\360\021\004)[\355>+j\370\312\224\007\f\"\267L\001K\321\003590X\317Y\317QSC\204\223\336\204\213\004\256$ \236\243\250\252\347\236\270\251\031U\350B\263\235v\220_a\321\322\242\na(\366\021k\312\361\351\254f\376\266:\n(\233\224\201\223\335\313\212\312\232"
+	.string	"\224|\374\327?#$\\\303\214\036\227\334 \311\020\331\354F\247\035\t\263\3013A\222 D\223iF0X\266\200\205\335\275Y0\032\271\346o\360\027\3740\b"
+	.ascii	"2\003f:\003-\004\347\032N\030\341\230\020$\334\271W;\237"
+	.text
+	.section	.gnu.lto_doRxBind.part.0.25.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375`w\001\305\016"
+	.string	"\206\033bE"
+	.string	"\261&\035\274D\001d>\321\212\030\202SO\377|\021\"L\331[\224Q8d}%\2473\232_\027\236vl\031\032U\3013\230\001\215\232\210\351\377\377\357\223\016\317S\020\231q@\201\330\311s\007\211\335{K\231RQ"
+	.string	"G"
+	.string	"P"
+	.ascii	"\377bR\n<\r68\346\374\260\307\005\361\3552\302U\320\346\003\350"
+	.ascii	"L\227\005\036\225\3538\034\302\220\236\0267<:\f\360#%\303\375"
+	.ascii	"\273\272t(]\370\001\303\003\215Pw\202!\253\027\033<"
+	.string	"\272\f\252\004\016\002\231\3149}u\270\257\333\226`[\304\276N^\320\341\\\030\333\352\275\367+T\3772\320\032\260\2323\365\243c\276D\027$l\337\376W\262C6\213\035\362\352\275\267\266\1773\245\362\352[\033\310m\260\240\321\231\363\023y\364\201\353\321\376\t\223\224\224T\266MR\302\342-\272Z#\003\305\f\224\372\254\220\"\346e\270\325\316.\313\002~A~\227\007\245>\266Q\256\"\273\346\234\t\374\024\267\251\340\217xt\212\212\236{\364U\344\343\227\301\207\031\257E\177jl\227j\\1S5_&\202\307\177\217!J\344\3501\351\016]V\"\322\250A&\222>\031\021\221F\020\034\254h\330\212\206\221F\017P\260\023-\005\033\001qF!\202\206Y\3102\r\013}a,c\320\334\344\304\177\223\377\016=\234\233\034=\316w]\326&-{\362\312\030@\355\321\004=\347\263L\354\234\326\344\375\202\231\216\007n2\037"
+	.ascii	"J+\200\244\216\253\332\300\016;\314G\2607\020+\350a\024\275\030"
+	.ascii	"f)\254\002\037d\374\361'\251XX\207\2455#p\006\244A4@\024\fs\205"
+	.ascii	"\223\235\211mU\274\251\"\342\fGT7\327\034\341\234x\t>\r\332\360"
+	.ascii	"WX^[\360"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375 \265\315\003"
+	.string	"\324\005\261"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\031\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\027\b`\024\177\t\006\025\177\n\272\220\202\002\026\177\013\001\030\177\f\377\037\001\220\316"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\220\200\003"
+	.string	"\005\351\221\2719\001\304\001\003\002"
+	.string	"\340\236\212\256\001\001\242\001\003\003\002\"\003\004"
+	.string	"\n"
+	.ascii	"-2\350\230\031V\205\211\313\036 \267\223\315\340\246gp\201\217"
+	.ascii	"\021K=\001"
+	.text
+	.section	.gnu.lto_.refs.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\001\002"
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9a845b9ba8ed64af,"e",@progbits
+	.string	"(\265/\375`\023\013\205:"
+	.string	"\ne0\026E`\246N\007\243r\241E\3070o\322[\026\274\220a&\314\203\365a\234\023[b\303\003\250fM\310\030_\b\334\030O\300"
+	.string	"\256\tv\316\360J\346S&U\376\240U\317\177"
+	.ascii	"\036\002O\227\t\212N\351\346MdJ\0011\001U\001C\001\316\304\235"
+	.ascii	"\347@>50uPn\332\355ng\214\346\270\356\262:E\t\036'7u3^&\377\221"
+	.ascii	"\327ak\373\233v\f\334D\334\355mc\334\371\304\212\217\233\272"
+	.ascii	"\230\253\354\222\313\272i\243\300\335\235\347\331\331\272+`\360"
+	.ascii	"0\277\177*\377\177 \245k\213\362Ir0@\312\374\320\037\322\313"
+	.ascii	"K\334M\333\t\267\007\214\344\245\213\252C\306\036.7\3654\327"
+	.ascii	"\342\031\202oi\347\342j\375\203\314\237\377\363\320\035\353\243"
+	.ascii	"\305\354\246A7R\357\006\334\016A\365E\243\016A\355\t\270\031"
+	.ascii	"`\n\320n\237\342T\334\314\267\334j?\355?\023\375\230\235\221"
+	.ascii	"\202\274\251Wq+\236\335\254\333\261xY\247e\355C\377\263\220\017"
+	.ascii	"\351\225f\355\246Hn\244\246^\244\266_i`\331c\350\213\333\223"
+	.ascii	"\324!OR;\273\221\212\275H\355\366\005\017\272=\250\354Z@\352"
+	.ascii	"p\324}9t;\001\007\335\016\240Aw\357uw\211\376u_\246ng\320\355"
+	.ascii	"H\335\236\240\333\217\272\335@\267\027\350\366\356n>\335N\324"
+	.ascii	"\335j\272}\250\333\201\335m\326\335B\335\355\326\335?\321h4\332"
+	.ascii	"\335t\335\027@7P0gh\356%k\316\310\332\027o\0032v\327}"
+	.string	"e\\\032w\306\345\272Y\027\353\326\270\312\273u\227\236\257\226\227\351\213\274\311>\312\377\312\377g\272Z\276wY\037\026&\336r\306c\256\215\3379\2343\370\3123\"d\026\272}\216\216\343\251!c\210\237\365\325\362,]\247\001\213\t\2045w\344\356?\267S\351f\272Z\256\307\351|\231\354\223k\302@8\023\323\366\245\367\237#\034EH\345>96 M\337\215\212\324\373\30012\273\026\n\216\036\301\316g\310.,\310\231\233\366mq_\033\270/\022\267\343\341\376\342Fj\236\337\301K\341\266\320\342\362\360~knln\330i\307\353\022\224\307\016\r#7\365:\356\226\362P\233\201u\323\316s\272\237\347\035\272\2651\330\316\347\324\375\260\300\355\211\226\331\325\005(3c\314\362M{\035\035p\257E\273\251\303\3618\236\021\270\034\037[\366T\204\366\242\354\355\221\202\333\021\250\036u\004j\347\271\033_;\203$\342\246\315"
+	.string	"\341\300\265\325(\202\203^\244\372\232"
+	.ascii	"t\204\210\031\271i\273\027\226\213\0036\271\304YC\323\036\327"
+	.ascii	"o8-\315\216\353\246\376v]\215\303\265\277y\232\256\200\241\177"
+	.ascii	"\312\354o\351?\322]\001\320]\301\317\230#H35\355\377\236[\033"
+	.ascii	"\314{\343\342\350\353u\275\256\023\263\377l~\033\032\254|1\365"
+	.ascii	"\336\311L\352\276:\372:\373M\215\255\307\223\267\337\214.\266"
+	.ascii	"\260\233\266O\007n_\026\356\333\255\376w\375\344g&\177\355?\356"
+	.ascii	"I\335B\356\363\005\335\235\376w\267oI\357?\t\024<\274d\r\371"
+	.ascii	"\205\364I\377,s\t\025c\211\226P\344/\317\340\232D\313\374>\b"
+	.ascii	"<\364\307/s\313\246-{?\277R\254\371\312\226\255Z\346g~n\331\340"
+	.ascii	"+\233\301eF\262K\250X\323\227\320\266I\364\312g_\211\364\201"
+	.ascii	"\225ms\211\246m\006\227Pds\251\024k\372\347\366=\216-\213\261"
+	.ascii	"X\017E\n\375\377V&c\177\377H\346\263r\227\353\305\356\270>\354"
+	.ascii	"\035.J\376\361\377\317\246"
+	.string	"\275y\266@9\371pK&\255\024\326\377\233\347\272\300:\233\365I\326\377\2612\363?\331\246p\266\316&\213\371B\257Dn%\237\355\017+\331f=\023\037\336\\B\237-\023\230,P\262Of\326\311\376\215\030\023C\331\374nG\b:\346\334\272\351m.\203\020\311s\270\3732\243\327\006\0260I\340\364\256\226\347\361.\276\374\005g\235\365\270#\343l\212\224\355\361>`w\001-\245T\201\352j5\016\250@u\265\032\201\242\206\307\265XUeEb\310B\300q\025\036\215A\300>\302\024\224\216\253\260\312\303\225S1j\250\241\246\326!q\310\002\367\205\f\0232h\270\002pl)\245\242.V\r\327\245c\261\270.\005\035\237\002\f\253`\2248\341D\342\267\016\243\246\\\024\327\021W+\225pj\035\032\203G\242U\361\303ox\024:I\031\207\353\212\241\323\325*$\200\330\364B\350\024%\034:A\255A\353q\204\006"
+	.ascii	"\304&\243\325z\034QDU,zx\3721>\r\217\302#\t\242\225\323\325\032"
+	.ascii	"$6\031\215C\250\342:\002j\r\036\207!\240V\001\307\247#&6\031"
+	.ascii	"M\f[L\225h\202Z\207\216O\031\230\216\304)+L5$\022\205RPA\302"
+	.ascii	"\243\020\304\260\205p]\001\324LL\037\220L\210\b\201\241\224\242"
+	.ascii	"\210S*\236\256\326\245\253u\2118%l\261\004\265\032\227\224\b"
+	.ascii	"\b\271\317T\313\216!\317 \3279\364[`J ]AW\320\236sn\332bb\367"
+	.ascii	"y\324\372\350\210\364H\nJ\273\323\344\331v?rL\220lq\323v{\303"
+	.ascii	"\336\371\2765j_L(BG\320nt\021\203\301\300n\030~\177^q&\rE\331"
+	.ascii	"R\343\307M\373\206\001)"
+	.string	"Y\362\334J\373j\317\367\353v\035\225=\013\004\342\346\025F\357\337)\001\310\007,O\235(8\307\335\221\343:\325\200\336\250\201<\310\2203\"#\"\"#\005I\322\001\240\002\221\2612m\021p1sjJ\222$Yv\003\324\007\200/\265\352\346\366\345\227\320\342J\234\305\320H\366:x\032\245@\252\345m\347\272$\t\225<\326^\374r\337\260n\320K\002j\251\265\204\020\373\356:\371-\304\327\343Q\002\241\357x(\210\344\243\271\311U`\177\031w\3621\276\t\207\243\272_~\313\207U@\023\247m~\340\260\344\303\024\257e\255R\327\211\020\274h\311A%R\211\025\200#aw\276P^C\211\323\353\002B\207\331M\016Y\213\226\n\210fr\032\tF\213\274\367K )\250#}\266\322x\254SN\247\341\321R\222\033\202\317'\202t\007\260T(\364\212;>\024\245\364\337M\356\343\245\375`\246\222\244eI\211\033"
+	.string	"\240\252A{V$,tO\211\274)\r\023\016?Iq\265J\263\375\263\330`\004\366\226@\310\215\234\317\335\232\n\306\027;e\2204\276\275!*J\373\376\220"
+	.string	"\243\255\250}0\277\243\013\026\302\370b\301\244\317\205;\236\361\203r\"?e\276"
+	.ascii	"\337a\314I\002\331}\022\306n~\273mC.f'\343\206\256 \356\322\226"
+	.ascii	"\343\005dD\333\300\327J\037\211\271\032\367\200\202\350\325\266"
+	.ascii	"\306\245\241p\251\370\263\021\312\323\240>\312f\033\270[o\322"
+	.ascii	"\005\276,,\372\344\260\364\023\025\362\276\347<\006\226I\r\023"
+	.ascii	"jJ\020UJ\370p&\231.w@b\211dc\022S\3221\346\315\177\345\320 \316"
+	.ascii	"\325\325\341 \177\260W\250;,c\357g\2432\2276/\027\366Q\004}\342"
+	.ascii	"\324\270\217\375\267/k\303\3548\330\004\372m\300\232\314\252"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.symtab.9a845b9ba8ed64af,"e",@progbits
+	.string	"startRxBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"getRxBindSupported"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"srxl2Bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9a845b9ba8ed64af,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
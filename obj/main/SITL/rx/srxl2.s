@@ -0,0 +1,1497 @@
+	.file	"srxl2.c"
+	.section	.gnu.lto_.profile.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\244\002}\020"
+	.string	"\346\226XH\340\3206\215\001\230\212\235jt\352\302\213a(;\377\260NQRD\213\270\027 \220<?\276~\377\240\t\321:$\303\f3\314)\206y\3100\303\f3t\367\f\205\254\020w\200[\274q\347\355\373\251\211\320\246M\222\022\331\001E"
+	.string	"F"
+	.string	"G"
+	.string	"\237%\200\311Y}t\272\366|w\205\340\006\204\327\311e\266o=\240\262\341a\343\030\214,\027\252\305\270\370\241\241\315\023<49\031\266\\.\257Q]LPK\207i\n\240\232\030\227\\\376\254\301R\320\222*\022\253\020\363\005\rP\213\023i\322\243G\203\317\277E\177{^\2663\303A\310\3034S*\231\taw\307\275s_j'\003\204\016LH\247\247U\275\037\233\031\0218\350\fR\301\302R\"\215@\271|{\243\033b\364\321 \322\336+\257XP3\246\210(\335\235\001\252C\202\205\203\223}1\357\033\032oT&%\373\316\215\202\b\233\022$!\n\234\224\317\b\252\326\367\360\360z\307\365\352\301\231h\3310#\"\227\034\317}\341\031\222\020\002\362QzK/\rR\\\334]\\\274n0\037n` p\261z\032\254\006\254\354\213\362\311\363\272\340b\341\201\2003\231\02180T. \343\245\025"
+	.ascii	"\300\366fR2\311\310\250O\"\203\207\f\0162\370\307\340\246\301"
+	.ascii	"\367\264\351R\250\221\245\2001C4B\013\n*\305bP\202Rd6\017\022"
+	.ascii	"`\304\n,\255\005cK[\255\377\031\243\n9\376\244\307\306/\264-"
+	.ascii	"\300\buYb\351_-\203;Pw\225M\242\371A\024\242\307\376\3259C>j"
+	.ascii	"\026\240\335\303\357;\236\242\247^\036\241H\314\237\334\245\222"
+	.ascii	"\342\320\340\017\271\355\360\354\254\256+b\3579\rZ2%\234I\367"
+	.ascii	"\322|\032\322\273N\372C\251\311@\375r^\217)J\031\020\326\255"
+	.ascii	"\214\003\371~D\254\215\217\260\306\266\215\237V^W\242\210\276"
+	.ascii	"b\274\035iv\034\376\007b2\217\265\332\364\375\227\350\370t\237"
+	.ascii	")`"
+	.text
+	.section	.gnu.lto_.ipa_sra.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"\005\007"
+	.string	"\022I\033$\220'I\007\377\377\377\377\377WLUUU\025D\233\261*\374\365\265\326\342\377\2771\322Fk\3046K\266L)\356:G\362<o\266C\331P2(rn\320\230m\314\253\205\244\260\344\t\b2\302oy`\255\001\304\nF\313N0\260\002\245P\361\200]"
+	.string	"D_\321\363V>\2411{\2132\222rz0\226\366\022=\341\016\335\225.\036\0214 p\002\0313\365\356P\235\0343\003\2707\332\226\215a\355\203\030C\356\252\003\354D6\226T\223\f\267\330\225\242\241\200\205\273h\331\257\326\371\f'\216\342\200c\\\310KPj\210F\326\260v\306f\013\030\267\304`\343\323\027\026\3122\026H\355"
+	.ascii	"a\307A75\230\356\212u\200q\356\034\254\n\002\234\210\375]\333"
+	.ascii	"\310'\266\251\315\237\206\265\221\n0\004"
+	.text
+	.section	.gnu.lto_.inline.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`]\005\375\026"
+	.string	"\006_lH\320\322(\215\001p\207\200\232'W\004"
+	.string	"\230\f\353r\307t\221\b\260"
+	.string	";\373\001n4B\240\266X\220\325\311\305\353\252\207\221,9\373\327\322\fr\036R\017\017Ky\351Q\001\004:\n\256\021\315\026\277\372\321\276I>\331R\246O"
+	.string	"X"
+	.string	"_"
+	.string	"sN\226'=\210\273\242\215\216\217\005\323\250\223\234\233{S\024\026\273_\301\252\036g\\\256\276\253\254\364\251f\316i\262\177\202\325u\235\355\320\234\223u)D\266-7\033\317K\266?\\8\240\030\360\356\013\353^\302\356\276\302\342\234sr\357\335A\b\244_\005\362\201\372\252\372\323v\004\311ll\211l4\036\245W\211>X\300"
+	.ascii	"\265&,\216\233\213\020\255\275(e\334^\204N= lvP)\326\353\033"
+	.ascii	"\377\016\f\360\3076\007\200IYb\t\031\232\033o\007\242u8Z\275"
+	.ascii	"\372\017\2141\271\257\263\220S\177\340\037\210\342`\\\205#~b"
+	.ascii	"L\221H"
+	.string	"\307\307%\265\t'U\303P\257\252E\306]\253:c\031\017hI\207\262\024\216a-\374\031\331@\r\033-v\244\321\207\034\241\002>D\250\320\341\245J\376\300\370\247H\372\201\221\373_{\262\252\273\252l\r\201?0\302\326\302Z\212m\221\265 \232\"\217df\003O\017k\001\257\001\317\354\2669\247\b\213\201n73\347\034yA\224*\321\304\234s5\312\213\364\311\353\203\374\253\222\\\276)\032cV\\\210!\362+[\364\302h\310A\367\332vh%\342h\270\341\241\301\256\017T\f\335\317b\310\202s\2430\366\034'^h\037\335\242q\353\t\275\035\206D\217\f$#\b\003\200\205\250\361<\205\224B5$)H\322\030`\242!Uf\036\022\240\2041F\303\310\230\032\n\244\002\203\202\324\273f\374H\346\271p\254i\351\025f\346\\\350\310+\344w*a\236\221\226E\033\036\360\347\334\377\312-:\027\233X\351D\200"
+	.string	"L\320\276'\367\005\212\234\003d\254dI\220\3402\225\177\240n\2078$\305\372\245\257n\227\256\2019\300\231\255\325b\200HB\021\301\373-\272!e\205~M]S\3171[\201\260\2457K\2439\315\307b$\367\242\312\034"
+	.string	"OVI\215\227\245\253\240\255\243\177\005\277`\301\323b\237\241\214\275I_RY\267\177\013{M\317\n,Ol\357\231}-\n\306\0242\3507\260\257\24546W\263.\024R\244u\302\350\210G\371"
+	.ascii	"\275\220\372\322U\274\244/\336\250\346\371FBS6\231\272\204_F"
+	.ascii	"IH`\233\327\241\247\2517\273\215&\325\033\224\257\352|J\200\371"
+	.ascii	"\311\207\377\305\273Rh-! \177\200\344!d%\274\251^\274\023\270"
+	.ascii	"V^A\277\353\211\253\\q\227\250\253\211dZN\023\326\t\316\321\223"
+	.ascii	"\344*K"
+	.text
+	.section	.gnu.lto_.jmpfuncs.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\r\005\345\021"
+	.string	"6\231K8@m\222t\306\301\202\362tQ\266\366\315\"{\207$\034\335\024$\313\275h\232\303\350\\X\307\3009\312\307\315El\350\324/\300\021P\013\265\227\2626x\240E%\203\020\231d4"
+	.string	"<"
+	.string	"="
+	.ascii	"\351\343\260JV\256\"\013\220\030$S\362\t\360\276\277\016\253"
+	.ascii	"\223\202G\323\"'\274\257*\342*\232\363\224\372\202\365\230\262"
+	.ascii	"\371\n`\203\222A/}%$K\362\341:\275\016\003\237\032\304\177\270"
+	.ascii	"\002\030cMP\212Mwz\001\276\031Lc\032GF\246\b\333\024Y\225;-\016"
+	.string	"q\231Z\233lZk\3556\345E\357\341s\201\236\013\364mXUN\231\236\222\002MQ\364iX\3455\275\214r\001\373\\D\220\230\001a@\024\314\331\352\267\233\200}\004\355\201\311\304b\2155c}*\247\247\327`\330bZk)f+\335\254\n\255\265F\023\363\304J/\216$W\021\205r\t\002\353\036P<\254\224\001\254\034Q\301\272\205\254/\007\037\225\320d\001\202 \f\367FS\337\303b\031\202\034\2077\265Q!;H\216K\334Jf\253B\222a\365\343\301\275/$\344B#\004{\250\361@\251\f\t\325\244\240\240\220\326p\"\24122\017\022\300\2039\004\342\034R\006M^X-\355\377\006\230\211tI\310\273\n1\231C\332\301\177\n\002\267qZ\242<m\355%\334>\226t\201\036je3\251\315\274\312\200\001\260\2758\256v\006\177\351\207\024g\032\236\207:\301\327\341h\337\200!\211.i\215\2252-\016"
+	.string	"\2272\363\221j\254B9PC`\023U\005k\323kw\023\225\332\006\250\276g\321\023F\254\264F\245\331\374\005\360 \006C\370*\253\004\214\274\354*-\016\030\025\204\2679\222\222\302\223\332\267\222\224\223\236\005\276sQ\242\020\332\2550@\"/o\021\365W\316\2028\365Wv\264\030\366k\302j\254\021&\2402\037O\326\272dY\343<\0045\311nw=\026\327O(\355S5\223\343a\177\030\320\250Z\206\300\304\016\273a!\355\325k\2413\226\023P\310\013\006\225)BiA"
+	.ascii	"\2751\261\301k\t\231+\206]\r\257\030"
+	.text
+	.section	.gnu.lto_.pureconst.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375 M%\002"
+	.string	"\322\004\020\030\220U\215\0010\306<333g\246\333\232\303\340\031\f\233pc/-\312#`\254.5\233f\322\215.t\237\3219\233\223\271\313\251\334u&#2\036\327\270\305\215\270\rW\270\301\354\326\335\005\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\304\001m\f"
+	.string	"\326\022>;@\247(\303\001\020\334=\245]\262\n\030[\314\346s+\254O\307"
+	.string	"\320z\241)\212\316U\217\325\023\227A\240\207\242\377mT\274\n@<\261\372*\360\036\373T\r\022\266\315h\267\224)'"
+	.string	"."
+	.string	"3"
+	.string	"c\355\315\271+'\225\202\231\272p=E\255\n\327\243\362\221(\341\331\312[g\250<\324\t*\007\265\225\036\345\021\273o\202un\2206\005\227b\234\30346\336\217\013!\256\277t\270\246\246\\\323Y*/\265\r]e\rV\331\303\334\030i\362&\257\f\234rN\307\002\357\025\340\346\"i\027\265\026\256\305:p-`f\243\312\030\244\334Hy\305\024\035?\341Z,\004\006\336S\244\234\022\001U\211\236\312O\344\226rS3\031LH\177<\237\001\004<\22496\236o\354\241\\\200\306\237A\214Ny\2473@9\200V\334\016\346\025\327\007\363\226t\002\001\325\013\013U\331K\275\027F\250!\271a\314\325\004\nR\222J\007@\002c\224+>\020\2106\252V\003\002\021c\002\261\035"
+	.ascii	"=k\005<'\204\226\216J\255\243\332Y\321i1u\351Lt\311\213o\351"
+	.ascii	"\370^Qd\250wG\247\352\324*\b\260\020C\300\240\274\017Z#\200b"
+	.ascii	"\r\346\271\215I,a\356\034\274\362EV@\344\304<\325y\366h\234\017"
+	.ascii	"!CGwJv!\033X\225\026;\231$\257\371\267\342\350%\177\336X\204"
+	.ascii	"{\324\206\241]\345\253h\343H\337F\221\202\335k\231T_("
+	.text
+	.section	.gnu.lto_.lto.73bc6b1761f7efc9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_readBufferPtr.33.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\002\177}"
+	.string	"\005\001\254\001"
+	.string	"{\274\001\273\001"
+	.string	"\005\0018\200\200\200\374\342\303\346\241\013y\275\001,"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\350\037w\276\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\026./src/main/rx/srxl2.c"
+	.text
+	.section	.gnu.lto_processBufferPtr.34.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\002\177}"
+	.string	"\005\001\254\001"
+	.string	"{\274\001\273\001"
+	.string	"\005\0018\200\200\200\374\342\203\347\321\013y\275\001-"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\250%w\276\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\026./src/main/rx/srxl2.c"
+	.text
+	.section	.gnu.lto_srxl2ProcessHandshake.45.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\177\002\305\024"
+	.string	"\206\347\212I\300\324Qcd\302\232'a3j\344*=G:\232\323|\264\245$T@h\275\367u\231\205\003\307,\300\300\211fr\036\240:\013`"
+	.string	"Xe\007\213\002\223\211@t\002Tc\364\f\226\221\\\"9)Z\242o[\271\245\224)\005u"
+	.string	"p"
+	.string	"x"
+	.string	"s\332W\372\317v\340\315\007\334;$e\343^\222\201\021\210\017M\376\304>\024_\300>\264\355\225\0076\337N\022\365\334\267\243\303\224u/\371\242,~\273\r+\2357\037wK\221\254~T5\361\202\036\326\223\236\243\235\213\227S\023\\A!11\253\030tZW\232xO.\236\256\n\200A\004\351\345\347\016\017g\316V\313\275\327s\307;q\267n;\204m\007\366\214\n\264C\031D7\225\330\246}\006\215x\257\016\3463\315j\342\275\367F\017\351K\330\207\247-~\222z?`n\006m\0227\251\317>\r\006\203A\323!\373\300_\254\323\255:m\353t\255\323\264N\237"
+	.string	"\n\220^\n\037\017\255\"oOp\311\245\no\270\370\322o\337\266\315/m\342\223\217a\373\222\315\001\034yqc\221\016\245\254{}\024<\364\202+W\217\212\031f_x\211\301\260\207c\321\324\016+\207c\226!D\222J\272\367\336lx\311\301\260\357\240p\231,\376\323k\270\274|q\3530\366!\004 \253\336\357\3529e\017\032!\365\271R!\272\251\304\r\236b)\255\364:?8o\272S\3147\262,f~\367\320\217\261\017)\325"
+	.string	"\364\242\367\023\372\201\342)Rm2Ej\213\220\231\337\271R\234\207\034\031\361\241\324\027<\215}\262\332\2146S\223\215\342(\363"
+	.string	"#\373`\035SY\031Q3\326^5\343k\006\002F\346\025\033k/\025\024\323fd\343\213\004\2156\276L\310\373z\351\320o\326-9\212c\233z\357\n\226\253\245z\357\2756e\272\356({\031/_\f\020\355\354\b\022\246\223\n\252\034\212s\213\332\023N\365\035VN*F!fR"
+	.ascii	"B\001\236b\355\n\347!\036\261\324\246}G\016KC\037SI\200\247\266"
+	.ascii	"\205+ `\002\221\300(\363c\204\036\f,\330^\225\021\333HX\305\255"
+	.ascii	"\234X-\215\265\346\236\214\240\304;\330\340\335\203\263\236\216"
+	.ascii	"\207\013lP\001!\270\027J#0\206\3555\201\261P\265\024\263\022"
+	.ascii	"z\363c\245\310?o\213\317\330\245\004\313Q\355\315\026\304\306"
+	.ascii	"\233\001\226-\304>c5g\026\270\020\336k\336\344P\227\213|\005"
+	.ascii	"\207\2431\274="
+	.text
+	.section	.gnu.lto_srxl2ProcessChannelData.46.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\323\004e!"
+	.string	"V=\331I\200\030R:\347\3721\310\002\245\027t\034\033N\213\205Q\026\367\373\026DaU\016l\323\374\216\255M\346\332}t\263:$3f\252\r\266\177u\367\001ml\016\214\350?\201\270O\026\311\354\n\252\240x^\253\375\204\020B\344N2\303"
+	.string	"\273"
+	.string	"\306"
+	.ascii	"]o\362\216\231\275b\374&\235rMTn\034\356\344[\306s%\255G\247"
+	.ascii	"\265\331\205\206\355^f\203\243<\264\036\r:-S\306\016\200\213"
+	.ascii	"\334R\022\341\226\371K\316\304x\255\031\017po\217\267(\3672\037"
+	.ascii	"\260\320z\224\231\327I\217\256\307I\217\262\221\371\313\231U"
+	.ascii	"\367]g\312\256\266{o\257\177\360j\215\317\255j\212\236m\215\374"
+	.ascii	"\343s\247\312T\303\352W\234p\234\024\334\330\310\224v5\340\003"
+	.ascii	"*\352\352\233\307\240\366\026f\n*\352\351\225p\034=\031\3508"
+	.ascii	"\263\301{J\236:Vxta\262\247\215\367)\204\304\315\214\367\204"
+	.ascii	"<{\274\230\200\274y\333\364\264d\255:t\357e\273|\202:\353\316"
+	.ascii	"\314A\230Y\310|Z\005[hH\353\306\314'n\206b\275\0279\201_6\302"
+	.ascii	"\267\n\231\321\250\0230g\264\376_\312\227r\262\037_\b\003W\330"
+	.ascii	"/W\244G\337\274\320\324\22762J6\216\231y\264MU\006\244,\bw\017"
+	.ascii	"f\3252\320\317\231?\001\237\207\235{.v\346\331\371\327Y\347Z"
+	.ascii	"\177\316\271\3167\367:\363V\3136;\31359\313;\235e\235\316r.g"
+	.ascii	"yU-\253\252\345t\265\214\252\226;\265\374\240KamUy\220\345\336"
+	.ascii	"\032qo7\r%\273z\330/\366\177\375\\\277\027\224\217\211)\bB\002"
+	.ascii	"\270H\2524C"
+	.string	"\356e\032\255G\303\222\272\340T\374\t\037\214w_/\300\324\326\330\356\275%\326\243\366\001\301\365\336;\201\237\005\203\021\311*\243\007h\321\262\307Iy\355\323's\025\227\314R\273\207\247\035\\m\030Wf\222oi\363\264-S\302\035\2607\315ldbl\222~\231\366\307~\251&4i\310>vs\n\323\223\252\036'\315\351\235.q5%\231\265D\241\312\215-\005\262\314\025.t\037\013\034\251(A5\244h\023mi\311\3604\rBU\274\341h\035\216\nXC\373\315/\230*sF\353\334\261\375\017)P3\207\020a\277d\254\035L}\344\216\353\006j\266\312\250%\033\3079V\215c,\347\262\264\301u\232\231\204\t\373e\267\375J\262\344F\365\221\337:}\260\237fVM%\034\002\"gG\272\251\030E\372&\nH)\212\332\210\350\013\236E!\3607\004z(\"\022\207;b\005`\3207TacD\364u"
+	.string	"\026}\305\020\300`QQ\370\002\004\322\220\347+\372,\264"
+	.string	"\n\205>\026\277\035\377 Hh\2014$\366\220\206=a\221/\330\373\r\211=\b\002\370\310\005p\330+\036\035\r{;\346\375\220R/\345\232\212?\366\\V\030\032\352\317\332\206\246\225\242}\323M\037\373n\r\rN\365\351g\241Y\245;\315\353\246\244\364\246\245n\214\331\332\202\264n\347\275\367\2567m\323?m\275(\243z\332\246]\034i*k\232\357\205\205\021+AU0=\212\226-\305\234\013\221\261\b?Fz\264\246Q\265\246\034\272^{\327Of-q\2254\327\272~\222H\256O5#_\013Y\250Q \246\224b\206\021\023\031\tj\nZ\350p\002\021*,n\020`\311\264i\f\344\321\335\257\nj9\353\004D\336\223\316\241\306-\301\220\262\"\311\273\0308\026/_\316\006\201<\217\372b~dd\t\242\024\353\364:\363\2630\215}\205\013\324"
+	.ascii	"\260\237\322\343\3202\362\tF$\214|\\\276\342cs\204\016\211\353"
+	.ascii	"\030\207'Sw\301\334\021\307\257\325?\345\264{\216\262\342\341"
+	.ascii	"?@\332\205\213\032z\222_I\024\264\321N\221\202\2736(X\017O+\002"
+	.ascii	"\341\224\031\0023\346IF\0223lo\233\237\334W\221\323\001\337\331"
+	.ascii	"\206\2673\313\r\244\203\371\331\226\257\200\376/p\340J\222\312"
+	.ascii	"\230\0274\345:\205qz\034O!T\r"
+	.text
+	.section	.gnu.lto_srxl2ProcessControlData.47.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\221\002\205\024"
+	.string	"\026h\213I\260\022R:\342\34520\260E\271`\322\205O9J\336\331\230\b\300\321\261\376\020\005id\241LBd=\266\274\326\267'\333\362)\312e3\315\351\240}\031\376\207\322\2735\336\216\311+\367\017{O@\351\315i vw\333;\245x"
+	.string	"o"
+	.string	"u"
+	.string	"?\262\035\250\341#\273@;\230v\307\0046 \236z|I=\025OROm;\205\201\315\267\217C;\027\342\260K\252\332\035aS\350\267\267*eMy\363MP\345\210\022\366po\211=\257\017\276\300\007\247\\\224\260\327s\252\223SK\210\234F\270z\273\311\342\371d\035\360\331\340y\365t\254\022\034\"z<x\271\241\227\223\262\265\262\273\226\274\236\207[\274m\235\355\025[\256\b\3235\277\343\311=\351,b\374\"\317h\344y\247>M=\375<\371\321\341;\362\301\221C{\304\311\031d\177\016\207C+O \373\343/r\244\333u\340\337\252\322\224JO*-\251\364_\266_\225\017\225\341\356\316\360j\241hS\211#\375\366m\333\374\240C|$\033q\215Z\302(\020S\273\343\311\251\035\210s\3140"
+	.ascii	"\300\352\202!\020Hi_EDOt\006\3713|\032/2\332\237\f\337\311R\342"
+	.ascii	".\356>SK\336\356\206\214v\327\344M\266\245~\237mK\211C\333a\307"
+	.ascii	"5\t\371\351d\020\333,g\232*?W\276# \353\277U\337\305\225n2\027"
+	.ascii	"\227z\332\n*UQ\235\004\317wc\316 \273\246\234\025\202<t\362\207"
+	.ascii	"\355\227\013m\304]]\003\277\305\314\005\261\350t\276\246\236"
+	.ascii	"\312I\203J(\200\nN\240>-\017dlfTV\213\325\"\310b^j2\030 \334"
+	.ascii	"\320^4YKLf\241\232\005%\005\346\206V\003\273\241\301d^b10\026"
+	.ascii	"Z\r\fE\200g32\032\2546\233\321`!\343\236\265\023h\3510@|\254"
+	.ascii	"\246pf\316\207\361\263vw[\001\244-a\302\2348\377\351r\251F\035"
+	.ascii	"\221\"\223N\233BL\236\347\005\277\234\2113=ImM:+0\305\013\235"
+	.ascii	"\02399\364c\374\305\004\205\223@N\344\024( p\002\031Q\271\003"
+	.ascii	"\235\206\316\314\300\034\335J\302U\303\307\265\221\354\002D\177"
+	.ascii	"u\022\215}\020BJ\274\363\037\267X9L\\2\252\203\364a\340m\244"
+	.ascii	"\255\325]\373\241-\276\225\217>\210\207\302\201*V5R\215\204\217"
+	.ascii	"\3340R\3622i\002\315\016s\300\t\361/gk\210\350\367+\263\315s"
+	.ascii	"J\321\367"
+	.text
+	.section	.gnu.lto_srxl2ProcessPacket.48.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\257\001\355\017"
+	.string	"F\336jE\360\262h8\302.\t\325\253\203U\301Z\370I\006X\337\315\033j\227\277\265\021J\317E\302Y8\330!\003\2162\210\276\t\302Kg\207\331A'T\363\300\323q\"\207\345\013\345\312a\031aG0H\333\357\275\245L)W"
+	.string	"Q"
+	.string	"Y"
+	.ascii	"\261\0344vE\006&\361\316Y\374Hw\316"
+	.string	"{\201\356\234m\2334Pyu\261\304\3531=Zjxv\305Oc\276:\267i\256|\326\271\b6B\230\313\267\317\234\244\345\323\332q\003s\271\272Z\335\210,\307\004\b\306\242\t\340dw\235!L\304\335\3356\005\333\017\354\f\t(\025\357\3049\177\245;wM\001D\305\214C\216\266\310J\205\261\257\3438\366Xc\266\323 \247\275\213\177\367\331\235[\372\241\303B\360\354@\320\331}\215>K\343j\240\260}\333*;d[\305\r\007\006\254\213\006\304\202L\373+\316B\365\331\312\t\354\006?h,7O\034\037\033(9\265K\246|\bR\221\327\016\315\245,\337\346\002t\320X\371sY\216\354\206*\214\037\303\227\361\031=2\373\362\302\207\341\232\227\340\b\272s\316p[td\356\302vM\177p\354\262>\302v-\303U\020zqe\020\333\032\336\342\344\355\272\034\3704\001#\224\b5aT\"\241RT$\244\300"
+	.ascii	"\340\250\202ht\2413J\211\t\206\024x\372R\340\227B\022\225>\024"
+	.ascii	"\360\364\225\030\260)\303\b\374P&\023\370\205\304\375\266\032"
+	.ascii	"s\307\303\203\rN\372\253nEb\363\3643\337\306\016\n\322\324\017"
+	.ascii	"\266SS[~\315}\262q!\331\251\005R>\364T\344\025! p\002\241\200"
+	.ascii	"\325\r,\022\232;\tE\204$|\\\372\221-\311-]2\243\222\207>\351"
+	.ascii	"f\037\224h\323\3748\003\023E];6\220\236]\221?\003\201'G\243\027"
+	.ascii	"\036\375\301\303\231\367\343\360,\3140\0060\304\0035\316\031"
+	.ascii	"\357\366\347X\347\0062"
+	.text
+	.section	.gnu.lto_srxl2Process.49.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\302\002\r\026"
+	.string	"&(\220K\240VN:\304K\340u7\bn\202\321^\376\244\364\030`\337\205\001\207y'\357l\225\354\005\220\033\270\005F\324k\333?\344P\037\032\265\245,t\341\350qF~\201_\341)H\257\205\261\302\026\222R &\336\301J\310&[\356$\003{"
+	.string	"r"
+	.string	"\177"
+	.ascii	"\273\251\252{\177\017x\001y\221\177_\261\027\311"
+	.string	"\033\260\027\031\307\234\344\277\336\275\224\t\035T\223{\257\254\227\216;9Z\2616\305\361\001\234\271\223\017J\372\230\002\203\206\255\tv+\234\304N]u\031\222\245\203\235ET\264LJJ\\ %\275\326\225#\031f\354$\252\016\276\254\230\300\316!\332\261S\250\272\334{\037<5:\207(\035g\356\275L\315\023\351\234rf&bf\t\314\364+P\317\361\303o\342\332\016\275y\221\277c/\276\037<\203\023Q6\222\202\350\220\371\227\243\315c~\017\207\303!\367\216\371\276_\345\3003\314R&E\312c\245lE\312\265R\246M\371\002\n@)B\301\353\336\243!\224\233%^\3158\360g\376\203\fc\376\035\007\356@ \362V\221F%T|\335\373{\271\310\021\310\213\003\350)\363o\374\tw\037\211\023\2707\307\0022E\266\025J\0311Q\260\360\311\251'\222/-_x\254rC\r\275Yc/\212Z=\234\226\304"
+	.string	"F\375\250\315\343\261kw\r\333c\263 \321E\341\360\253\362^[V6?\322\253\272V\317\366\275\270\270\303\251<\220\367\266\220!k?\212\313\007\244\303\277\233\367\342\245\245\375!\3305D\2370\363\354<J\230\0363\355;l\024l\361\315\245B\220\367^\031\035#rZ\266\232~\032\206\311\367\245m\002\b\332m\206\323S\342\314\312"
+	.ascii	"\264\333\354FC\313\271\271\351\364d\360\261\305\270\214\201\200"
+	.ascii	"\343c\343\221\371\330d:7\263\034Yi\343\221\305\034\340\232\b"
+	.ascii	"\232Mv\253\325l2\330\357\276\336\336\361LP\013\325{\357%[\250"
+	.ascii	"J3W\260@or\355\\\003\036Unl\236\217\023\021\276\244\350Z\262"
+	.ascii	"\315\343\003YX#\330\rY\350\330d\277\234\371\002\006z\023\326"
+	.ascii	"WbQ\3249\346\013\3411\231i\036DC6 `\002\231A\325\003rh\rb\210"
+	.ascii	"\034\021l\005\223T\327\333Q\303-\243\262\226e\256\261\233\333"
+	.ascii	"\201\025:7\332\021\337\222\215\362b\017\332\225>Q\3502\205\203"
+	.ascii	"Q\361\007\241H6x\3610\205\211\2761B\307\225\362Cx\032\354ea\263"
+	.ascii	"3\266h]\355\317\275\206\b\237=\336\324.c\003\023\262\214\034"
+	.ascii	"Q\373\304Bs\322\360\306\205\023\"oQ\021s\004\321\336h|\302v\207"
+	.ascii	"\313\236W\360v\005="
+	.text
+	.section	.gnu.lto_srxl2DataReceive.50.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`r\002\255\023"
+	.string	"\006\343zH\300\224Q:h\002\0021\255\3142\243\310h\346\210r.8\277\307\264\377\343\375/7\215\r\364c.|\365\024\275-\223\347\317\357\331\002\353\255I\330\373\335I"
+	.string	"\220\f\032uW\344\341\037\250\351\343\242J\314'm\357-wJ\001d"
+	.string	"]"
+	.string	"j"
+	.string	"\020\332\257q\033\261\357\220\260\334u\001\024\264\213[\340\024\3572\300\t\314K\370\223y\351\230\255t\334mO2|lp4\355\356\2471\036\373\224Qa\314?\261$\340\321C\253\311>\345\205\037\"Zm\305c\211\222Z\rT"
+	.ascii	"\265YD\331\335\363\034\236\250\325@xb\331]CZ-\305}\272\355\016"
+	.ascii	"\266\033\330\320'9~\201\221>\314\274\324!\332R\016\356\214\202"
+	.ascii	"\266K\004<\355z@\005\013\243\231\312l\234\f*\216\375\270\273"
+	.ascii	"k\265\331\337\371M\"\264\027\241O\023zFh\031\241c\204V\t\r#\364"
+	.ascii	"\007\234\004\035E \332E\261C\262F\262\307\f\333/\261\255\270"
+	.ascii	"\337\210=\347\244\013\330\2655}\336\245q^\227\336S\323'\372\217"
+	.ascii	"T\205\226\226y)uI4\230h\024L\037\222\t\251\211I#\320U3*\204\301"
+	.ascii	"S\364\240\013\251,\270\270\314\313\250\016\206\334\344\340\356"
+	.ascii	"pwe\2528\276j\252f\340!R\003\217\330\306\360\037\225\267\373"
+	.ascii	"b\305\3371b\345\345\310(j\307\367\271\016\031?\307\254VK\245"
+	.ascii	"\016I\347\206\006\356|\365s\274g\003\312\003+\330JC|\265`\254"
+	.ascii	"\325k\305\201\2052K\205\201\207\231W\3147\363\372@\274\254>|"
+	.ascii	"\254W\314\247R\300\256\020\255\327\007s\271^_\tn\037Wm)!#\032"
+	.ascii	"\235\305\251\272\334U\363\244\236\336D\213\331\321I\245\256\210"
+	.ascii	"\316T\333\260\013I\245\334v\367\201\r\341E\022\020\334<\341A"
+	.ascii	"(x\273\273ri\340v\332\222\211N\235C6I\200(\312\246d$< \220\002"
+	.ascii	"\231!\354\001Ch\315\007>\361\312>\027\363\205\242=\262\033\255"
+	.ascii	"\367et\271.\223a\025\232\200:\252G\264|\247\273\026\022\266\264"
+	.ascii	"\204\305)\345\210\273s\321\030\245\356E\026\016q\250\244\340"
+	.ascii	"\004\254\313\177\300,c\003&]\rl(P\353\005\013;\361\337\261\213"
+	.ascii	"\013\212\023\031g0\303\031\020\3501\005k\264Q&K\022?\342X\243"
+	.ascii	"9\005\325\236\352\275`k\212\300%\306#\210\313\005d\002K\343\""
+	.ascii	"\307\372\362\266\313\350\001"
+	.text
+	.section	.gnu.lto_srxl2Idle.51.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\270\003\365\026"
+	.string	"&\245\212I\260\226\326\030\344\035\206K\363-\240\374\3550\b\243H\n\332\r\247\332Lf\016\332\320\245\362\230\021G\356\"\357p\255t@S\240\334:\026\366\251\313\n\034\2269\3751;\364]\321T\236\003l\030_\034'\025{K)eJ)\005t"
+	.string	"m"
+	.string	"w"
+	.string	"N\236\212tJ\261\273\034\333\236\335,V\342\275i\002\353\247\006\361\377O?\342\036F\201\275\314\222\034\275{\226M\030\230\272\336\030\005f\3405\304\346\330r\205D\304U!tc\200\241\246\253\330\372\323%9\252"
+	.string	"\241PSV\017#\202$;\266bk\207\036M\230\022AD\354)knd\371\177~\301\375a\365\3516a\376\177[]\203xc\274\273E\273;\333u\254'\226\230\242\310Z\331\256\363\023\376\230F\315\206\203S2\331\336\340\bF\221O7\372N\006\3170\207[\304a\377\377\315\227C\311^\341\207\225\353\256]\366q\214\034\026\356\255\206\235f\225\311\345\235\222I\366\225#\025E>\335R\027w\225n\355\273]\036\337\215v\273\327\364\336\322{\311\356\035\275\327\273\267\271\227U\030\351\211Z\016\246\376\201\212\001\275\034\b\023*\235\005\377q\254\356n\013\373\240\275,x\342\036\017\026BL\263\032S\242?a\256\273\234$\220nZ=i\242\303uqG_\006\262\216\t\024dd\244T%"
+	.ascii	"zw\206\246Y\035]\306\203\213\312\307o\373\344s\301+}w\240\334"
+	.ascii	"\255\341\034\265\327?\t\005\3138xh\003x\377\317\275\264dR\306"
+	.ascii	"\0332\023\337H\227{"
+	.string	"kssS2\351NZ9I\322\3418K\363\222\300\002\017\232s\362\240\347\005\233\231\332I\203\346\234/\002\326\206\241\006=3\330l\350\031Sz\036\337\2156\302\n*\234\373,71\027\331\202\2118D1\235\tJ#\020\374\177^bz\001\241V\351\246\b\033I0\337!Ie\301\254#F\242\240\204\351\214\027,B$\n\310`e1\342\345\273!\251\254\212\326\302\0232\245\003,\252B8\251t\306s\341 4\227 \220\037\033\200\\\252\020\256\213+\001T\250QH\246\030ch\002\221\211\232\244\220\003\240\002\031\241\253\016\020PgfD\332\314\001C\\\215D\207E\325\341\006iPm\275\260 \271kI\373\251\036\016e\320\257\374FH\272.\366\362=\223\346\343;\223K\370@\26147%\202\367!\025\361!\336\320(\250\n9\214>\350\251\200\\[Q\2232\370\2443\321\\\220\246\306\213E\352\370Ls\324\356\315"
+	.ascii	"\270\221\322\343B\362a o\367@\236Bz\246\3778|\347\f\346cj\207"
+	.ascii	"\353\356\211\227;\250\275IM`\016\336\253\272@S\274\366\016\206"
+	.ascii	"\331\311\366\024\213\254\f[ca\364\203\354\030\215\331D\377\003"
+	.text
+	.section	.gnu.lto_srxl2FrameStatus.52.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`t\017\205F"
+	.string	":u\f\032DP^R\007w\214rg\220\353\227qS9\026%\020k\377Q\30111\0069\333\262iz\350\177\277\355\353\302TBH}\025\001\310@\002\002\034\207\020D\001\033\200-\204\030\352?3\037\253\264F\366\336;\311\224\002\217\001n\001\226\001R8H\025\020L\307\242\241\342o\356l\356^\374\273\275\333\277\264\303\365\360m\tdv\001\313\214)3\001\210\206\032\233\231\342\365\225a\377\332\246b\334b\007\343a\272\207\215\303\277t\353&\r\f\303C\034\335Cg\335\356\036\355]|\332\303v//\020.s\301\210\221\345=p\251s\351\341l:\216XR\330y\202\215T\r\351l/"
+	.string	":{\\s\356v5\327\322\303\327v8\021\f7\261c\006\206\245\bz"
+	.string	"\320\331\226\272\261u\026\350F\255\263\335\335Q\fz\364\353R(A\204\\_[\323>\030\226&\377\211\277\376\344\004\240\211iI)\t\311xdTD4$T\f\"\016\205A\240\333\262\353\347\267\335\245\260\246\341\201i:\231\376\264\346NkZ2"
+	.string	"5oR\313\222\231\226\242Y)\251\350\324\242\222\221\260\270q\035\020\365\023\347q\272\260\254L_\262\244L\311G\002\302\204\214\271\321\230X.\"\032\212R\245\013J\026*:\265\222\344\242\021\017\"\256\006\220\254\306#y\350p\236\2018\265\274J\027X\026\256L\3176D<N\327s\035"
+	.string	"\207\311\035\257\322\365\225\203B\247\021\007\306\351\362Z\2170\f\373\324\005T\351\212\263\233\261xK&e\253%\206u\245\265D\352\331\227\320\251\305\262E|]\r\344\235\3413\006!k\016\235X\371W#\2576j\321\231\265\036\240\236}\371\3243\227\363*g\227\002\f\303\235\233N!\336\001\274;Gu\267\213\356 4\001\355z\032\017\b\303L\177\272oh\235\355\334\204\271\264\224\301J`(\307\353n<\367g\343\345&\fu\324\312\177\335n\307\357l\340\320\241\303\223p\023U\312\335 Ddo\"\337\311\210\036\272\253g\366\035\324?\234\\4f\037Z\240\265\313\261\002\300]\200\273=\266\\\255\373w\213\300\371\305\306L\340\273M\240\310\336lb\034\034\035\3263\273\371\302\356\320\326\207\266\253h\363g'\235\302\337\250"
+	.string	"\302\360\222\006\355s<V"
+	.ascii	"\307\234\315\377e\317)kl\271\352\231z\346\345\345\037\3327Z\377"
+	.ascii	"\026]\352`e?\335\316\306\333\334`!%\325:\353\357B\337\374b\177"
+	.ascii	"\333v9O\363\266\217\365\324\213\354\315\027\255\263\006\306\372"
+	.ascii	"\236j{V\271\332-\275\312\017\355\366\257V\253y\372\233t\007s"
+	.ascii	"\223\030\346\036\341\346\0261\314\035\302\315\rb\230\373\203"
+	.ascii	"\233\333C\207\rn\356\f\376\346m\301\315\035a\230\033\202\003"
+	.ascii	"7\367\002\005\303\334Q\311a\356\003\316\346\215\204\3625w\002"
+	.ascii	"G\367\342\305\373\311\315\355\344\346nrs3\ts/\271\271\225\334"
+	.ascii	"\334I\302\334Hnn\243\233\373H\230\333\310\315]\344\346&rs\017"
+	.ascii	"\271\271\205\334\334\305`\356 77Q\230{(\314-\024\346\016\006"
+	.ascii	"s\003\335\334\256\233\273us\263\300\334k\233\373\335\334\271"
+	.ascii	"\315\355%\0344y\036\021"
+	.string	"\003\3739\001\336\026\205I\321\177\334\364hu\247\026\352\025\374\2117\325-\"W\022\320\222\320\031A \212SeFx\bD\217\374\b\357e\234\020\375\303\375Ec\253=\236\345\372\024\r5\311OG\376P\037\2760>\"!%L\370\020\277\244B\357iso\264\236\305G\262\3025\367\274\226\031_\266\310/\276\227\315\311i=\257\364\276\370\354\365\355\265\361\033\330P\020\235\370\205\276\bz7k/J4\203rEH\313\243\372,\321\253{\263\340\243\210\217\374\005\357f\262\221\345\023\r\304\001S<\277\243?@|\305\374\303\207C\206\317\342Q\323\212\031\002\rBf%4\241\330;\345\230\025D\370,\334\035\277\330\254\316\036\361\241\355b\301\276l-<\222\254\256\013\235\0029\370\335\257\331{\226\275i\341\217X\271\231\271d4\332{\345\275\322:\033|\207sd\326\234h\034\374\363\3475t5\016|\017\223\313>\336\216\276"
+	.ascii	"\276\013\245\372\305O_ny\3027K{\340}\352Ek\364\230zus\031\376"
+	.ascii	"\300+\361\331\372k\337"
+	.string	"\375\f\357h|E\263\313;\273\362\245\354*\353\325\342~0f\313V\371\352\335r\364\261\256p\341B\353l\373\354\224\032\215\331\202\017\365v;\031f\321\354\372\024x\265Q\201\313\226}% \017\264\304\240AC\353,\373A\2737~\236\307}\352%\374\3201s \352\231\027\031\367\241x\274)0s\240v\317d\244\200\231\322>\264\375\332\375\254Q\276\366>\377\003\211^\373^\376\223\027\r#\301\024\215\030U\311\032T4hPI-\271X\262\260PUcJ\251\\J\r\253f,oL)[\034T5~\252\212E\225\210)\0321\252j,C\344P\026[*A\324\214\034\312\033\311\034\312d\215\030,h$\245\2247\222\t\220\232\312\306\2242YEE\245L\016\245V\276\302\337\344\370E\2603tV\177\365\344\364\235\343\262\334\353\005\366\"A\322\334c\365\346\364\256\025<\277\230\315i\352\301%l\236M\035\276W\246"
+	.ascii	"\177|\256n\247\226\304\307V\364\204\376\266\307'\361\235\267"
+	.ascii	"\342\253\\\005\360\320'\036\340;\374\007<n[D`\030f6\3019IJ\262"
+	.ascii	"g\250F\007\337\353\321\323\273\231\334\337"
+	.string	"\322\206\026\352\003<\027\325\233\262[6S \311\273dI\353l\323\277\221;\321\330\252\207\022\246\030\226<X\nCy\016\2642\265\005\251v}b\354\322\302\310\351\333\360'\354T\231\2760\275\307v\372,uY\372\217\233\213\n\260+\353Zzh\277\226\333\210:28zus\"~\204\322#_\304{\230,U\372\217s\343\327\347y\215\236\322Z\234Z\\\332\036\025\207\372\344\237\250#\227\204%\351=\256\343\206t\005))D\335\023. >\204\361\221\017\342]\f\232\361?\316\215\217\3475Y\220\036\372\347gA'm}{lyfV\332\322\366\374m\237\336\301\237\270\353\263E\344\210\354\371\2009\362\217\336\343\273<FbF\006\324\360\370\214\017m7\333\362g\244\340\227hxEP\377\364\\\037\352\302\270x\370\017E\217|\017\037\2018\250a4&\025C3#\"\"\332\024T\322\001\301\005\204\030\345\244\263\r\021"
+	.string	"\255c\314\241\231MA!m\006\n\300RQ\306\272\372\t\340\252\201\211\007\331y\364\030\362\362\233\200D"
+	.string	"z\250\243e\244\257i\275&\t\230\376\020\334w\036Y\321\235\315H\343\325\230\n\026\310\345\3006A\350\304\377\225J\267\r\370\374\220\013\026\215\267pWQxq\302x\021\024\270\320 c\326\223\303\321\266"
+	.string	"\315\333[\033\351?\303Ve\3727(\275\307\024\b\205&q1\004\\'\003\032TL\237\367F\237\312\001]E\335\306]1\352\343\201G\212c%\032\274\272\346\207\223\266!\210\367\360\"\214\244\241*\n\304\035\227k\321\f\251\375 \006\234\r\373\021\020\253\374\375\215G\327\001 \024\342\r\210\304yJ\036\017\002+\275\036\317WA\232.\201\274q\0310\210\361U\265\357\234c\023\200\337\242\315\302\237?wxF\35609\033\210\346\272\263I#\346T\005\201\230L\225>m\212\344\217.\022\312!&\017!A\r\322\356\001?\023\232\f\217a"
+	.ascii	"\340\255\006\2414T\2129\"X|\036\240U,\220P\025\203W;\004\304"
+	.ascii	"\nt\352Q"
+	.string	"\347#\261\347\312#\007\226B\027\255+\301\220lI8'\3002\225\273U<\252B"
+	.string	"\t\260\346_\334\232i\346i\266\275\354\226\237\274 \331]\221b\021\n \003\341\321\242B,;\023+\311W\307\233@\270\377\2053\211\314Z\214\377\363\n\320b\333J\243\222\021M\033Y\034\266\317\026\333\233\315\301@"
+	.ascii	"c \350\270a\0334AHF\325x\206#&\333\341\243}\201\032\310\b\264"
+	.ascii	"W\230s\224\255O\261\246mi\273\241\215\022\237\350i\032@;\302"
+	.ascii	"P(H\013\343\013J\007\320\350\316\006o5+\253\234}\034\223\366"
+	.ascii	"\002*\033 \233\\\276\335\261\231\352D\367\223.\260R\024\252+"
+	.ascii	"'\364\f\204.\316\007\247\030K\210\033'0fR\0169\302s4\231\367"
+	.ascii	"\301[\214\244\b\313\202Kj eRm\364\307\006+D\206\ty\306d\003\312"
+	.ascii	"\0323\233\3149\251\257\337\f\362\307\256\367\221\350\330P$\261"
+	.ascii	"\027\222\330m\3336r\021\244y|\025\357\322\223\005(\177"
+	.text
+	.section	.gnu.lto_srxl2ProcessFrame.53.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`G\002\305\023"
+	.string	"\266\245\206J\260\022R:sL\036\234\263f`\001\240\203\017\321\nm`\003\263\321\363\023G\220;si\267\345\354>\343b\361\266\315\376\342\277t\375\372\303\037\225\254}\t\247?%\311\216\262\230\343\nk\252\205]pJ\030\301\372=\331D\356\224\002t"
+	.string	"g"
+	.string	"r"
+	.ascii	"\365\247#\251V2\201OV\247"
+	.string	"&o\"\236\256^\"\236\332\266\n\203\233q'M\364@<\344\330\031I\325J\276\266\304q\027i\270\023\347\267|4\027W7\247\341\201\250\027>Lz>\274\321\307a\206!\201\034\032!F|6\341I\023\t\250\321W37,\360\03315\342\323\205\256\031L\273\007?;\370l\346\004Y\251\265z\362|\037n\220\333v\261\355\300\236\272\2668-B\247C\350\364(N\267\016\274Y'\372E:M\351\364\322\351I\247\017\240\001T\216\210\036\250\305A\326^\371\2432Q\245\237\003\177\373H7U7\372\221=Z\346*\274K\245T\255u\224\261\307\323i\337\374\240G\237|\212\333\201\032\\5d\365E\330!C\b\301\251\027\254N]\341\234\366\205>t;\321\206\223\324E:<\234l\214\333Z\001=vUsw\307=\322\r\370\374\364vG@:\245\226]\026\016\360.\236\004s\235\3071\027\027\361t\356\336TM\341"
+	.ascii	"g\351q\332\026d\363<\326\376\351\006\320T\224niN\245S\256\330"
+	.ascii	"\3351\212\370\245\020|\252\231T\366Y\274\005\212\317c\032\314"
+	.ascii	"<\017F<\375\006\235\020\312\031\302\311\315\322&usw\354oY\226"
+	.ascii	"\245\367\027\256\220\022\223\275\330^3\232LF\203\r\220\241\315"
+	.ascii	"6fk\261A\210\311^l\263\f\017fj#\206\245\250\\\230\251\305\274"
+	.ascii	"fj\257\331K\213\354\005\253\305\274R\002\230\206!V{\331h\264"
+	.ascii	"\332k$s\337\337q\242Wr\253\013k\255U,\231\266\204\t\363<\357"
+	.ascii	"\322(\250\221CAw\307\3579\213(\342T\324\024\262\"tY\033\262?"
+	.ascii	"\212Aw\227\312)\0200vA!\213\330\332\007O\022\f( \240\002\221"
+	.ascii	"\032\365\3270\2100\340\336\031\032\307\003m\305/\377q\254\334"
+	.ascii	"\206n\324LZ\342\354\366q\205X\320\3200+\025Q\360\254\302\226"
+	.ascii	"\207\306\030\276\177;\207\231\004i\223^\213\270A\f\206K\366)"
+	.ascii	";G\020(\230F\214\253\243\342\260\031!\343J\363 \023q\337\201"
+	.ascii	"\221K\005+\n"
+	.text
+	.section	.gnu.lto_srxl2ReadRawRC.54.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\275\f"
+	.string	"F\031ZC\020\221\223\016\033\236\013T\240\341\343\232d\007bD|Q\007@G*\223\025\007\006\220\246\350\271\326\276\261\026\323\372l(3\332\367\022\321\016@\r\024@L\220\377\340\324\273\200\"J$\202`\026I\333{K\231RH"
+	.string	"B"
+	.string	"E"
+	.string	"'\361\022&\2372\272l\340\274t@\221\241\331\215\230\307?\340_^"
+	.string	"\374S\021?\335i\236|\316\nuw\255\\\335\001\017.V:V)\367\321\n!\343\254\247\312J\225\271\361\354\2563e\305\341~\267\335\3006\003\373\"\001\3601\377{\374\235\323\371\322\277\b\264h\225\314\330\325Pcca\274\025/\266o\333dwl\273\264C\024\230\036Sr\217M\305pI\220i\037\346&L\217&\017\260\313B\223b7\"p\201\353\317\361\262\355)\033\017\006E\371)T'\312\215T1\323\372\240\332\342\247\327\b\254\027\252\254a[\364\023\243kW\265\300\227\271P\341\332\335\217\370\363M\340\337\365\254\033`\201\202\006\314I\326\330\021\225\332b\337\255\262\3300\275q\351%\021\007#\231\246}$\2008\031\351C\202\220\211B$\315\302\203\322\326a\020H\310Hi#\301J\033\246\205>\"\f\264\221` \003<\242\220m\030i4\332\260N\334;\345"
+	.string	"1\223!\375\023LU\261\235j\317\211\246\034\200\204\352\324\016M\310\007\021"
+	.ascii	"p\b\b\303h&\232\255W\364a\205\252\255L\261\376\022\236/nA\027"
+	.ascii	"234\366\200\021\002\025\016\356\002R\r\266\bMcPP"
+	.text
+	.section	.gnu.lto_srxl2RxWriteData.55.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\272\001}\020"
+	.string	"F nE\360\3204\035\002\325\306\316\355bd\033\203&\001@\362\370c\3375\342\003]|\364:\214\234>S\321\036\213J\374J\215\n\r\353D\b\303Sdf\266p\033\330c\377\364\262\212\235E\260\235\321\022\263n\264\211\224)\005V"
+	.string	"Q"
+	.string	"b"
+	.string	"(\276\343\030\345\320\356\007\030<\273\033b\220\354\361\303z\3327\361\023\337o\034\364"
+	.ascii	"\2734,xv\303\020\033\310\036\035~\300\365\230}\273\036\375\331"
+	.ascii	"4\036\326\354wD\234R\340\330]NC\374{~\376s\036\002e`\236\030"
+	.ascii	"\203\335u\2022\034n\275\355\002\266"
+	.string	"C\354,\t7\352\352\320\353\325!\245\3024\023\223+;\204I\005a\337\332\335\265\322l\277\371I\307\371;4=\312\322\032\226\026]\351PLgX\032\273\322WL\307\230\266\254\264j:3}\017\002\252\030\027V\273\033V9\366'\366\214\260}\373:\266v\315v\206\017 \251\240\223\212g\323\353\274A\211\224\f\223\rQ\212\002)\020\351\325\"S\222\206\276L1\370\230f0\365Wx(\0363l\374\226\353\361`\215\322\310\310\013\212\027`\252@\032<D%\351\2457\221\210\331.K\243\276C-\205\220\332\3212\225\244\bnWP\311\203\252\037&\205\3615UQ'U)W\316\020+')\332\271t\023,\233\210$Hy\361Z\270\027\217[\241\320\251p&^\013'\342a\026\013'\036\347\302\302\342qZ\270\267Vi\\\262\372)i\214G\352\243\376\342\200oc\007$$\233\216\364A\352\306I% 5%\371t"
+	.ascii	"jvK\007}\027\357\211\340\333<ZB\227\007;\233\234\344Ao\252\351"
+	.ascii	"s\036# p\202\021\261\355\001\362\320\356\016\214\241\205\346"
+	.ascii	"\353t\017\216i\237\333\200\025\023\2521\223\255e~q\251\214/\230"
+	.ascii	" \216\022$\231-\023kb\214\016\362\231\274\333\246\f\243\214\365"
+	.ascii	"\300f\212`\203\305\f\310\214^&gH\364\253\271\260\205\220\223"
+	.ascii	")\020./\332G\006"
+	.text
+	.section	.gnu.lto_srxl2FrameTimeUsFn.56.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375 \357\235\006"
+	.string	"\222L.3`m\322\001PX\003\313\b\356\224\302\247\326\200=P\202\bLx\262B4k\265\376s}!\340\027\252"
+	.string	""
+	.string	"\024PW*zA\302\2175\377Y\262\267\224)\005\266P\b\r\230wq\230\347\036\030\024\034\234\345]\034E\340\nb\341\271\210\252zN\212{\365\244N\034\245\260\037\362\b}\016Kd\362\326\233\237\211\336R\001:\234\f\331q\223\232a\237\255zl\247S\013:(\023%\273\026!\320\2364\222\217m\215-\371\036\377\320\030\262\270q\005|F*DRv\243\233>\020\275\261\013Do\252q\370\204\376A\316:@&\326\265yV\022v\327i]\027\267\336\366\201m\003\333\030\001\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_srxl2RxInit.57.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\271\007m,"
+	.string	"*NP\021E`^N:s\206\177\013\036l\325\031l\313\026\373\225\315\360\205\242\007\034o}\252\347r\022\337\365Bc\203\022\"j\262zW5;b-\371P\247\210\356B\305\303\037\237\nX\370\013\" \3757k\304nB\366N2\377"
+	.string	"\362"
+	.string	"\b\001gL\317TV\275\343\227\232\270\020\351\321w?\365\313\316\354_w\233\3258sr\231\257\324\346\027\r\357r\262\247{\261!\234Zf\244\211f\234X\321\321\256\220\036\025\236wy\243idm\367\305\256\345\351c8\036 g/0dr^2\350\004\351\321^\236"
+	.string	">\232^"
+	.ascii	">\372 \302S\257_2\001\362\2571\3062\273\234\227\303\273\244\205"
+	.ascii	"?\227\357\323\256\017\002\205\202~\276^\312\303\350y\355\332"
+	.ascii	"\207z\220wa\203\3241N\354\016\311\325\221\003\271.\304%\305\312"
+	.ascii	"\210\r:\027$\317\334|\315\252\310)\240\255J\222\337\326}[Z\266"
+	.ascii	"7\204\344*\353\351\232U\326)d~H\212U\322\362\036u\344\370\204"
+	.ascii	"Pe\207\030 \322x\376\316\352\246\234Ie\321\363v[w\200H\035\247"
+	.ascii	"\005\343\234 UH){\202\t\371=\332-\032;dmhH!\267\274\0139\347"
+	.ascii	"\266G\344\325\033\300\273_\324\335\"\272y\016\002oB\200 \340"
+	.ascii	"v\343*\020\363\210e\333\210Hq:\022_c/\317\230'l\354\267\217\346"
+	.ascii	"iJ\364\237\364\211\024\366\307\024t\216{Z\305\325V\2449OI\350"
+	.ascii	"\2371\301\"}\202\343\236\371\004mx\356\306\242l\023\275\312\356"
+	.ascii	"\035o\321E\265lW\035\216\fn\312\366\371\231s\316\347U\236\t\007"
+	.ascii	"\335\242{+@iT\\R\266\3316\347\037\341\356~\3611G\005\230\344"
+	.ascii	"\234'\364\303\\\214\213\376\223\243M\003\311\376x\264\217\204"
+	.ascii	"\217^\031s\343\022\233\213\262\315{\343\306\272\262\356Uv/\241"
+	.ascii	"l\220\313\033\267\276^\335Em\233h\350fo\341\227\277\201\217\375"
+	.ascii	"\003\332v\020x/o\241\237\275\203|\266\177A\266}?\333\275\237"
+	.ascii	"\355\324g\033\367l\243\251\3553\265}S\3336\265\375\005xH\234"
+	.ascii	"\235\236\034\315\234\2014\377\3448\250\231\257\237\375^~\263"
+	.ascii	"\363\354\331\375\245\217\026J\272\344\330\336\360mKe\2151V\251"
+	.ascii	"U\307\252\003\037\265e\024,\360\336\257<0o*\177\255\302\303\377"
+	.ascii	"\313\352c\005\222\236\317\321\333\275\"\327 \366G|}g\262\326"
+	.ascii	"\205\032b\363J\304n\035[\263\320\373*I\346O\350\016\335\273\203"
+	.ascii	"\215\357*{\200\031\362G\332\273\r|(M<\274\3646\260\320\255\352"
+	.ascii	"\363s\353\177\316;\"Y\026\326\273J\f\245KI\332+\360\275-\310"
+	.ascii	"\340\272W#\277\273\227h\313\037.-cAk\272\200\341]\345\361\033"
+	.ascii	"2Xp\r,\274\007\266\324!{\233\262}\272\201\355\345\327.\334\275"
+	.ascii	"&Y\225\366G\3415:\"\027g\352Bu\257K\326&\013\2308\271\334\n\245"
+	.ascii	"H\240\346\327\n6\345q+\225:+k\230\2025\313\357\254Z\264\002\345"
+	.ascii	"9b\255[0t\206\303ih;b\251\331mx\333\221\025\272+s\302\227\300"
+	.ascii	"\335\035>\247Do\311\234\335\334\327\220\022\270\345\034\365\243"
+	.ascii	"\234\366p8\037\322\234\263\204~I\207\221\364B\211\230\241\251"
+	.ascii	"H\\\3621)\021\223\232\226\210<\244\246\243&\022H3\222\232\224"
+	.ascii	"j\214p*\002a$\275P\"fp*\246\355\302\350\201\f\247\"\323\320\251"
+	.ascii	"8TJ:\2321tQd\032\032\025h\342\022Rq\330D$\026\207\277e\376\365"
+	.ascii	"\352%\260(\3064 \321\315\343\207\231\206\373+\016\006o_\210\272"
+	.ascii	"RA\273\343\277Kto<c\344w'$\321\204%\201W\251\205\"\251f7w\202"
+	.ascii	"1\211\b]e_e\303\276\333\202\354\315bY\"*\033\035\265\255\r\037"
+	.ascii	"\365]\024I\265\260d\357\266\rb\205\254U\352\233ZG\255Cw\251\310"
+	.ascii	"\\\275\203\323\333\273\247\030\016\266[\325\263\202\331\037\323"
+	.ascii	"{\227ke\342H]\250\376U9\334\326\207\375\241\312\251tj\235Z\207"
+	.ascii	"\217JH\246\331\315\251w\252\037\004* {T\233\226Gq\205\n\346H"
+	.ascii	"\216!k"
+	.string	"C\303J\331~|\005]e\237\371\236\027X\2251\3157t\373\354\t]\340\255\212\201\361=\320#\200\217\250a(\343\024T\n\r\215H\032I\222t\200\002\221\261#z\021P=3\251$I\n\212\031\003+PH1\266N*G\251`O\330\",h\"\266\334\356\247\013i\235\313\270U\265\272\357s\3034\256\f@\"<>\263\326 \243\256\264\fDX\013//\212L\032\242\251j\231\360?\373\220\331wc\303])\205|\273\243\334\3332D\0166\355\240\217\266\216\250\367\342(\320x2\357kF\022\n\b\"\231\217\234r\241)F\200\305\300Bq\302d\342\n\336\277W\220\257\254\223oL\026\353I\300;F\3612>\303\n%p\016ZT\307\370\221GZ\214\tM\264+\316\n\246\211.\231\016CK\304\r\343J\026\303@\223\330\313#\301.\357\326\277=F$y~\212\320\243/\203\227\303B#\302\240h\254\361K"
+	.ascii	"\035\036w:\351+F4\004\032\325(\336\321\236}\242\023pY`\353\257"
+	.ascii	"\310\024\211>\257+\241\241\rs\220\366?\312\220n\212\200\337\200"
+	.ascii	"\344\317O \330\330\300s:6\025$\306\354\3207eU\235\332\251\376"
+	.ascii	"\0233\213#vj\314\351\206\344\363\366\024\232\371\325=*"
+	.text
+	.section	.gnu.lto_srxl2RxIsActive.58.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\302\f/5Pm\222\016$\243\252\022a\341\312Z\322\n\030\242a\fd\031]\253]\327\266\265\273=\277\t\322u\003(\236\233Y$\b\030\272V\200\\\211\202c\267\326\376&2\005k0\231\006\216\265y\034\353=0(8<\215\265y\230\201+\210\005\353ET\225\365.[\026K\210\004!\304\276\236J\021\261\"\021\254\036\375\360\\\215%:\256Y\251\333\251\224*\002T\204\334\3517\220\303\213/%\261\364\273\321\271K\t0Mh\035\215d\222N'YB\205\230\376\317_\316\034|\276\272e\220\00468D &\231\333C\214^u\327mG\023\260\021I\246\201\352,\b\231\271\3134\212\216\375\r\376\202\337\"\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_srxl2TelemetryRequested.59.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375 \343U\006"
+	.string	"\322\013,3Pm\222\016$\243\252\214\252\353\326\r(1[\213\2007Wi\037(\2245\373w;\273C;o"
+	.string	"\305s3\213\004\001C\327\n\220+Qp\364\270\305\275e\nc,\027\b\r\225i\032\252I<4D4\f\225i\026\203\247\t\007\252QL\023\325*X\026C\207\007\036\374|G:\252\256\350\212\315\325\252t7\001\225\016\0076<\227=\3269\344\370\002$\206\376\373\220 Dt\365\"\313\004e)y\"\231|\374\234\257|Q\340\\\025\363"
+	.string	"\025\200\214,HP2\261\206\035\255z\325\255H\031>\030%\326\325\351\t,d\346g]\032\035\373'\374\b\177F\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_srxl2InitializeFrame.60.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`*\001\205\f"
+	.string	"\246\026Q= 1T:'\006\360\310\002\257U\241\234\214\335\3351g\235p\264e4\035\016Y\266\001\033\373\b\333qB,A0\244\314\375\013\001\bQ\300r#((k\340\374\217l\314\020K6\3312\245<"
+	.string	">"
+	.string	"C"
+	.string	"\001vO\255\026\273\243\001[\266O\217\037\240}n\027\240}:\264m|DmE\325\"\261r\354.'7<\274\206\376G\034\200h\022]\037\nv\327*\232,\334\362\266\013\330\276\330\177\021$\"H\210\240R\237~H\373|\230(\335\020/\2144f\217\"\225\031\354g\273\273\226'\373\253?\223jU\365!\221\017%\323K3v+\304t\354k\272\340"
+	.string	"\261}\265\037\342\"\302\257B\017\030$J\361\260\232\016\022\275\206\333\245e\322\3360\320\213\276\300T/\nRd\237\0058\241\241\342+8\226\004\237-\312-\243\301S\3408\n\317\004\265;\272\350\2378\253\343\316\243\027=\337K\200\333\356\"\360\003\237o\201\264\006s\300\001\310\3738\220\307=\340d:\234\306\3738\f\305\035\204\215\307}\272\316\343 \343>[y\362\006\003\361\032\311\t\226\250J\002\227*O\332\341:\f\216\237r\006\324\213\240\366yY\251\021#\036"
+	.ascii	"2\241]h`x\370\"\226\201a\267\243\231\017\201\346&\030\320\017"
+	.ascii	"\020\214\247l\350\021\332\360l\365\231\256\312\006\254\273\004"
+	.ascii	"I@\030%8@\273\241\340\226R\242B\203\331\330\001,c\305\301\250"
+	.ascii	"KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_srxl2FinalizeFrame.61.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"M\013"
+	.string	"v\226O@\020Q\225\016\210\242\234\004(|\205\336\007\203\303:\"$"
+	.string	"\353\215\357I\013\242\266.\240\037Q#\350\211k\013\fBs\332D\330we\002JE\200\240`\030\004\025\344\343\213\343\356\373\266\306\215\244L)<"
+	.string	":"
+	.string	"="
+	.string	"\273%\027\250]\220\200\005P\036\r^\344z\244<\344ztg\33388b\001\224\230\261\201\005kw1\025\361\356\331\371G\361\312'\362\236\023\003\273\353\374D\036n\275\355"
+	.string	"\266\007\330G\020\256`!\377\371-F\333ZeP\317\006\275\324\020\366%\273\273\326\222\375\323\0375\255\231\316L\337\222\311\bu\020\235C\270\033\ns\254*\306 a\261\375\264o\342'\272\237.\374#\252\366\002\006\023\222G\266\311\177\252\032R\336\251\353\232z\321"
+	.string	"\002\224\241;2\252\315y\240\022\024\215\224\n\203z\256\344\301\257\340.5v?)\256B\363M\217\246\300\345\277G\237\273\036\243:\035\316\201:\303\024\200\340\3318\314\263a\0228\r\"`\331\306a\230\021k\0236\033\326\321\264\r\263\200{\311j\311\007F`k\365Q\220\375\314\345\2778\214\214or\002\215\346zT\360\001\007\353\306'C\203dj\017"
+	.ascii	"2\241\265h`\3610\002,\305\034\326\356`\302\250>$\265CS+\\\324"
+	.ascii	"\322\004p]\354jV\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_srxl2Bind.62.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`8\001\305\f"
+	.string	"V\227TD"
+	.string	"\221&\351\034\232\rC[\300E\333\372\224\2066\023\350\373\023y\245=\375\311\364|\336n\346<W\350\177\030\2105\277C\213L\371h{\033b\001"
+	.string	"P\213\226\r\234Z\234L\303\247e\370\220\267\277\221FH\222\001>"
+	.string	">"
+	.string	"C"
+	.string	"\035\222\323\231r\2502C(8\366\300\346x\351\316u\354,\340:V\324\316\214*%\001\323\214\207\030\034\231\211A\023\213~\242>7g#\215~\032\006\231\331\267\221D\\x[\003m\023\264w\001/\303\234t\227\316\241\364\355\250Y\303u4a\331\241B\265\362V-j\364 \211v+3\263\260\245}\257\007"
+	.string	"\220r!\375a\225\tb\245#\273(s\342\323\267\317\325\243\257\230\205\350\223\312\031oE\2202u\034\340\250\360\3014P@x\006l#\034\343\315\3060\226\311$x^\367\\\307!\207\345\032\237_\214\314U\350\200v\321\027\013\267\270\304\005\256\226\344\230\254!-\206\271PC\216\233\033'O\244\007\024J@\023\254~@\026\\H\321BX\212\206\225\200<$\330G\013a \037\315LF4,C\226i\230\007*\267\022\266t\223J\321\255\300\rU\2612G\210|z\025\314[\365\343u\256\214k\324\034\312\200\322\3266p\360\002\034"
+	.ascii	"2CO\025\330x<\264+\002\270\016T10\0063\327{\212\235\274Q\200"
+	.ascii	"\270\261\305i\214\331\310\030C\3000h\003\b\342j/h\007H\f\256"
+	.ascii	"\021P9~T u\031\375\325e\001[\300e^\264\223\f"
+	.text
+	.section	.gnu.lto_srxl2ReadRawRC.part.0.82.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`_\001\305\016"
+	.string	"\226\235dC"
+	.string	"\221(\035\037\021\252\252\267\234\240\210\301\245N\350\b\037\264\32636\031\f#rRG\261G\252\2431\352#\2417\210\377\245\346\177\231\3775 \250w\336\217\r@6\004U>\234\n\222\326\332&{\023)S\nP"
+	.string	"P"
+	.string	"O"
+	.string	"\333\212y\331\355\024\374\031A\374s\027\355\2438\261l\373&~\002\345Tv*,\r\313\207\222W\314n\267\375q\234"
+	.ascii	"\374\313\017\200\177*\342\251kf)?MR0\\\017{\366BC\206I\312\206"
+	.ascii	"g\3073\rdw\0359\334\357"
+	.string	"\266\033\330v`\037&\351\030\323\032LC-\375\264t\366\327\2570\235w\371\017\300@\002\017\273(\261\032\033\342\275`\261\017;\331\033\033eo\374\362/s>N\335\242\274\2649\037\250\257\260p\216U\315PY\240y\227\323[L\007\272\325\300\262\246}\025\357Po1]\300\006Q\363\265\272\241\272\013.\345\257\370!\360O\323\237tx\232\n\365\253\022y\303\300L\237~EB\2251\253f\372l\224\334\260Ao\021\022w30\360Y\\\b\371+\177\276\t\376\245\036\366\273F\244 \311X\252\313\232=[m\3311\255\211\351L\f%\t\017D>\"Qg\202G\363!uH\021>!\020IT\001B\211\013`\217\007G\244\304\215l%n\023\201:\241\315\303\215l\036\005<\242\360\3416\322h\304m\033\333\371l\265\345\303\336\221\031\325\350\211m\215\032\204DU\252.\333Z\214\247`\324\214~\005\002\3360\240\246\001\033"
+	.ascii	"\33774\031C!\326P\206\020\201\251\220\314\f\374\245\002\001\344"
+	.ascii	"\201\021\256\030|\261\001\221,\224\036\342\334\f\303Uc\001\335"
+	.ascii	"\254\202\344\274\223\235\366\240\335\257\204\300\275\233\303"
+	.ascii	"\204g\330H\r\244y\364\265\005\017"
+	.text
+	.section	.gnu.lto_srxl2ProcessFrame.part.0.85.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`>\002-\022"
+	.string	"\326\237qH\340\262(\035B\261e\367\034\216\001\023\303D\350\004\003\005h\340L\222\320\257\017qe\302R\357y&I\fFCo\207\316\267\334\023\331PEL\bl\022S\302\214\347h\0275G\367\225q(G\317F\201M\220F6\331;\245V"
+	.string	"b"
+	.string	"]"
+	.ascii	"\325\n\272W\227\335\313\257\261\350\325\237\235\346\365\025\034"
+	.ascii	"\274\224r[(\354\2201\013\332-G^\235\240{\365^\200{\335N\200{"
+	.ascii	"5i\377\274\334\r\201\320\241B\013\332\335\217\312\234<\235\033"
+	.ascii	"\351\303N\237\363\031k\021\3619\340"
+	.string	"[\210dw\335\215\270\353m\227l?\260\247,/\265\007\005\217I%\322+{0\223J/\257^\316\254\260\354\226\264\233\345\205[^J9\323\322 eG\\n9\360\260\311\244\350\301\343\3658\337!\361\343-\356\302\026\331u\035S\237\232\310\345\351\227\244O{\216E5$\016\371\233\023\017&`\027\346\004\017\235\366Y\334\346\365\233\023\003\345\206x\215\037\006\017\025,\314\307\354}\2400\3733N#\274p:q\257\224\202\320I\257\362\303\367y\f\021_f\024\bR\0043\030\027\232\022(\263\346\177\305\371=\207\201\301\273\314\251\222\371X\t\367\2723{q\231\001\331\314\332\2441\246\333\267\335]S\030\033d\232v\32334\375\3563\021\300ew\245\346c\003\3160\002\303\024\353S\211a(\242\016\200\254\023+\002\030\246X\252\026\004\223\021\200KTQ\243F$\r&\343\3523\031?U\352\024~\250q\365\215B,n"
+	.ascii	"\307\217%\212\343'\262=O\202B;\230R\032c\021.GH\207\246\002("
+	.ascii	"dNz\235\3430-\230\331Ey\314\267\361\033\022|\331\253'\230Lv8"
+	.ascii	" \200\002\221B\363\3334\3200\377\303\342(\024y\017q(\320\201"
+	.ascii	"\377\323Vim\311r\335\235\222\320\034\032E\336\261)\306!\311\253"
+	.ascii	"\332\334\372\215\224k\317D\3710\033A\212\016]d mJ\242\205\373"
+	.ascii	"c\372\023\337`\366\002:\\\307\035\331'\224\340\021\215\035\226"
+	.ascii	"\265\264*U\352CT\003\013\026\031\214\353\342Zi\032\203\371/\235"
+	.ascii	"\235-\177\332\3136\031u\255\226r\036O\027\246\311'`<"
+	.text
+	.section	.gnu.lto_srxl2ProcessChannelData.part.0.86.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\266\002m\023"
+	.string	"6\241wI\340\322&\035\252l\264\313\362X\324\357*CL\340K\t\242/\304\226\346\344\214\317\377\t\001t\352-\214\300\353CY\216\357\247-\3744}\367;\331\002\212@\246)\216k\242A\211\360\035C\260+\327\345u@\237l\333d\357\224\002]"
+	.string	"e"
+	.string	"`"
+	.ascii	"\"\036h@\026t\257.\273\027\207\001{\f\226\256e\326\341\324\202"
+	.ascii	" \355\226\t^]\322\275\236>\240\364\312\235\244\364z\032\333\257"
+	.ascii	"\231a6\217\227)\366\265#\230\332\217\335\375^)\212\303N'\007"
+	.ascii	"\363\247"
+	.string	",\246\345\364>\347Z\254\270\311b@|\n8g:\331]w2w\275\355\006\266E\233\316\265!(\007:\r?\310\236\355\207\364)Vn\314lw_\363m\366~\310\035\035;\220v\327B\367:\375\332\313\3179\317{\356c\317\346U\276vtT\252\216J\201\221\215\325\320\330\"t\2578\257\337\254\234h\207u9a\343\346\315Ji&2b\303\221\202W;\350^_\336\306\336\253/\3433`\257\321\360\3450\0137\373G\277\241\362Ux\305\232\227\261J\257\247\367yI\016\037.B\270\314\333\2444S\356\334\356\256\251\t\3334=M\323\257$\007D\354~\270%-\211\032\304\342=?\317\017\364\033\375E?\316\277s\223}\277\310\3506\210^CB,Cfv\313\241\023\331\253\201\340\024\033\331\030M\310\214\252\023b\t\256\013)\252\"\301\025\327\022C\324\030NH\221\344\350\205-\260U!\\\245Z\242\n\005\327\030"
+	.string	"l\201\020\310\007\341\n\034Q"
+	.string	"\250HPBJ(\212 \006\224g\224\t\203\024\327H~\256\361\023S\340\352C\215\344gB\300\254\f\341\370\265X\254\361\233?q\241/\246\224\322th\222r\226\226\360\2448.\353\321\335@\351t\322\303\310\274\314@\250qP\210\bRfhd\342\202\202\264\030\220\002\2212\263\r\020H\306j\n\3224\006\355\210\"\2735c\376@\2045Q\367\013t\342"
+	.ascii	"\252\005\275>\315\347\335P\026\355W\024\020=\346\353Q\272\264"
+	.ascii	"_W\240\250Cff8\207\231\252\367\314hm\264a_\271\365\034\250\306"
+	.ascii	"\312\231\312@\202}\347\357y\243a\"z\032\263\025\354=\264DG\323"
+	.ascii	"\254p\222\263\327\325\037`Q54\360|\220\331\235W\037s\\3\006\360"
+	.ascii	"G\020\023\305\371\350\363\003"
+	.text
+	.section	.gnu.lto_srxl2ProcessControlData.part.0.87.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\351\001\275\020"
+	.string	"6\235jH\340\260*\035\350B\036\210\201\244\207\2108\246;\035$Y\222A\017\006\346\0238l:\005\342\254\344:8\2452\262hk\356-\311\035\013\254\276\f\031\036\362\300\016\351c4\031\224q4F&\022\220Y\356\035\213\244q\243\275S\nO"
+	.string	"Y"
+	.string	"V"
+	.string	"\257\336\013t\2576\313o\361\347\325\242\020\326Md\360\266\204\347v\003b\306n\031zu\002\357\325\244\215\363r\3675\023\230\315\306\356~\264v\362tvH\277u\372\333g\215\027\257\233\233\007\224O\002\357xDv\327^\312]o\273\201\355\b\366\244\020\263\226\332\367\372\232_\346\177\371m\267\177\202\364a.\363\231\337\374\251\241IMP\271\037d4\251/\007Y\007\312\214\212\003O\024B\332bT\235\030\025h\300j\200Y\311\211\274\277\220w)\371\240\035\326E\313\321i\037\305K\326]J:Y\307\n\314\204\301\253C\336\253\313\033\350\002\363\b\272\323I\017Ky=w\025\027\374\0216\205\363\261W?\354^Ok\214\0267T\\3\007g\034\217ee;\333\005\257\277\035"
+	.string	"\316\205Mk\346\230\224f\332yg\251\b\3333==\323\357\024\310\020\020b\367$\007\307\316\352\n\022)\214\362G\253d9\221\031\005z\243q\364\200$\024\307SH\372\200\343h\234"
+	.string	"\232J\343)%a%z\210\340\310\b\264\320\215@8\251\302j\022\210\210d%\242\276\225\370\235J#\323G\022Q\037\310\001\207\030@\361\033\303P\374\346E\\\364E)\315\266\307\244\007\273\320\355\n\245\371\230\003\340`\330l\240-O\312\3421\032\001. \220\002\221\261\341\003B\0059W4\302\243@P\202\276\340*\362\240\263\204\302\336nv\271i\243\214\001\030@^\241E4\f\363\303}{\340C(\210c0"
+	.ascii	"\r\3238c\253\321\273\327\225\324\261_\207I\202\214\022z\210\360"
+	.ascii	"\021\314\311\016\217{\206J&-\273d\243\256\26561I\247\035g\331"
+	.ascii	"k\261 \347\003\351Vo\377\to\f"
+	.text
+	.section	.gnu.lto_srxl2ProcessHandshake.part.0.88.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`;\002%\023"
+	.string	"f\243|H\340P%\035X6\263\203\330C\323lD\315o=\303\302\020\224P\t\2039J\326\265\320(R\364\020\334\027\203bC\231\3649DTR\337\316\314b\032Jc\020\303b\310'*\243\005A\223\270z\231\251\033\231\264\275\311\336)\005e"
+	.string	"h"
+	.string	"d"
+	.ascii	"O\272R\3546\234\017\3305\212A\265;.8\365Hw\352\361\007\352i\367"
+	.ascii	"\002\365\324\242\215\343\343\356k>=N\267\335\365f\207\213\247"
+	.ascii	"\334\224U\364e\247\217z\202\254\0244\256J"
+	.string	"\3202\234\2233\232\320'\307\200\347\266\001\204\266\303\005\320\352\251\361\250K\037\232\216\224\004^](\273\353N\303\355\272\355\025\333\016l)\024[D\253>\230\260\311\211h\232\243\037\33369\211\231&\344EJ5\037\254\335\321;=\324\357\364i\337\276\223\350\223x\224?\240\236j$\311S\r\267C\343\006}\350\310\306x\322\2356\211g\2721P\314o\362\307\251-\342#bg\272\021\221\215+\013=\260H\272\355\002\221\234Z\001\026\310\345\227\304\333pB\306\r\002\362\245\035T\266\2429k\366c\352\234!\323\215\035\251e\233\345V\223\316\220\na\223\323\247:\n\320G\362\204\027\371\331\251\377RO'\214Y\226\r\363\251\230nw\247\201/u\341\345#\235\316\327\324S9\247\204d\020)\331r\344\226\2345\317znw\327\323\310vIsUzVi\371\245\377\036#-\004\020\355\376l\355\b \314\347\002k\221\371\\"
+	.ascii	"\2000\231\327\f\f\f\273\020l\371@\227j\226\022\023\n6!\314\263"
+	.ascii	"\t=\231\227/\306c\ta^\t\002\277f\300\320\263\360z\205\336\207"
+	.ascii	"my\224\234\251C=\254~0@\355\344`\356)\325w\361\027)\017TT\262"
+	.ascii	"N\334rp\006d\b\210=\204\312M;\302\212\374\314\"<Sf_\305WT\220"
+	.ascii	"\360}uVI\351\030\232\367U0 p\002\031Ih\007`dE\001,\005\202\356"
+	.ascii	"\336\013\331\266\024\247Z\212b\267\204s\264x\034\211\037d\372"
+	.ascii	"oi\360\326\"\236\022\221]N\2543\326:<uds\246\013\3306`\230\007"
+	.ascii	"]\202.q\251\033\013\357\030\212@\201\362\270\212A\252\270\247"
+	.ascii	"SS\263\312\265eQ0;Z\262\270\210&\222\357\016\367Y\0016\222\344"
+	.ascii	"\334\213\3704\030\367.<\006"
+	.text
+	.section	.gnu.lto_srxl2Process.part.0.89.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\353\0015\022"
+	.string	"\306\341wH\300\324M:d\220\003"
+	.string	""
+	.string	"\376\313\027\365\247\342\334\365\340U\224\200&\031$%\350itt3\032\352a\002\177\266\347'\232[\\\363\027k\233\364\026K\331>M\r\"\273I\314g\332lo\273\214\004\2548\004\244\221M\344N)_"
+	.string	"_"
+	.string	"c"
+	.string	"{cj\332\035\037|\232\201\367\351\361(\335\247\367\002\335\247\375\031\266g5\323l#\037\203\3669N\2248\242\332\335\357Sa\234\366\311\251\354h\276\211\355\346Sr*K;D\233\212+\327\300\007*\305\211M\207C\221zQ\344I\227;\266\034)\t\274[\261\354\256\275\236{u\333\031lK\260%\205\332\235[\275\331+\351\371\361\347:i\235\322\222\223>"
+	.ascii	"\003\037\324.\212\252%\3733\237b\034\351\366\221f~\222YG\263"
+	.ascii	"\033\325x\001\316\270\265\332\217\314\372\364o\274\210v\243\032"
+	.ascii	"o\233\274\035\023,\216\354\216\016>\035\301\373\024 -\345\307"
+	.ascii	"\331\211l\022\214\313S\263\224\366k\334\006\355D6\037\260\001"
+	.ascii	"R\211\021HNU\355\227\013\362\342T\b?$\364\306>\217\031\005A\273"
+	.ascii	"{\321\306\360'\r+\336p'\016)Cvw\245iD\007_H\246*D\354\361\231"
+	.ascii	"\256C\326\002Ae\365\200\222\261\342\352+}\311\345\013\031\304"
+	.ascii	"k\372\257\356S\247D$8\262\312&\322\216\201\311\213\327'\3757"
+	.ascii	"\036 Q9z#\025\310\001`8\341\203+\326\202\221\2010-0\200+\326"
+	.ascii	"\212\275\270b^1\031\231\005\232\360\304`\212\n\fM8\363\321\204"
+	.ascii	"\237\314\253\025\363\201\341\314\227r\300\260\020\256\360\213"
+	.ascii	"\301`\341\307:\013\216\346X\247\367\226\316\367\361\037-\025"
+	.ascii	"\\\344E\227\356s\336\202P%\321K\247)\251\026\234\002)\r\321\300"
+	.ascii	"\261\352\302\372\017\211>Q\252@\266EtS=\024\021\321\t+ `\202"
+	.ascii	"1\007\251\007\325\t\2009\033\211\320!\024\313\316Up\350Y\323"
+	.ascii	"\200\332Yd(\2671\301\310\302\200\274s\224\343\"\n]\216r\300\343"
+	.ascii	"d\347\033L6U\236}\020\275a\306p\342\310\320\032\255\bvr\007m"
+	.ascii	"\226\205\002\206\"\343\n$\251\323>\264/0:\257,+\224\227\\\325"
+	.ascii	"\036\006\206\320\361\271\327\2061"
+	.text
+	.section	.gnu.lto_.symbol_nodes.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`\341\005\355\027"
+	.string	"\206\243\210G\200\234N\007yn\227\002G\267\374\353\205\320\\o\325\327\256G\305\231\232\315\374`\334\323P\033\251T\237n\331D\321\210\210Zq\273\236\202\202\026\266\273\377CIo\210EH;\266\036\210\371\007]\005 \033C\226\"\311\224\002r"
+	.string	"s"
+	.string	"v"
+	.string	"E\325\274_\214\326\205VD\304\023\205("
+	.string	"\"\201\375\360\254\305\303\263Z=;<\247UO\3234\345\360I5x`\003\002\253\001h3<\243U\f\257\344\273\246y\231\\x\306R\231hAA\005\237\243?\252\024|\226\211\023~\326O\t=\313\304\b?\020J{>"
+	.ascii	"r\360\303\352\314}\336\006C\366\232&\230\027\3633\227e5\200{"
+	.ascii	"\357e\360L\225\231\311\266\\\326\304\347)}\237\251\374\263\225"
+	.ascii	"\036\317(\217g);\236\301t<\207\345x6\2468~\352\306\263\230\215"
+	.ascii	"\347(5\236\253\364\275\227\271G\343\231\254g\274T\225\361Q5I"
+	.ascii	"\310\306x\250\n\343\237^\274\223\013\036\263-\370\250\023\306"
+	.ascii	"\345\215\3057\255\330Y\025\006\312\\=RM\361\302\212\202gO<o\251"
+	.ascii	"&\336\250\226\320\245V\037\254\372%\252 \0229\253f\304\007N\325"
+	.ascii	"<\306\210\231\254\036\236\343\334\226vn\305\264s\234\311\243"
+	.ascii	"\353.\264\256\264\234\316qg\373Q\r\013\bR\316Ic\363\210kM\b\344"
+	.ascii	"\274\335\222r\245\0226/\245\2347"
+	.string	"\332\034\306\f\212\326\260\347\210\307q\3056j3\277rv\334\252{\315\220\364(\334\361\3362\312\3616\273\236\241\351\242\2053\300\201\212n\234<\233\263<\361\"RT\035\353\371\312\371l\346\343\371\314\374L\032wD\336\305]0*\350\013\244\202\0164\025t\362\334\352\023j(\300\227\037G\204@\2345#\231\023\320\005\234O@\277B\373\007\f\222\254a\351U>h\0139!\223\306\255\311\261 \\\303\322u\266\332\223\21093,=\007\355\0336m\2044\225N\242\302\222\323\024\337\226\374\312 \2562\242\357\347$\312\364\023\372\274\213=\237\267Q\327\363\346\365\034\347\245\033K\214\355\270\343\005o\250\201\fDE5\243EI\312\r\300\002!*\262\003\021\240\220F\031\"\201\220\0042\021\205\231\007\2607L\350x6\347\001SU\357\335%\177wLP\240\335\247G\360W\254\302S\306\354\021r\263\017_\035\345\"kW<\357"
+	.string	"\246J\313\341\204\326\352\354\035\243\211\245\",5P$A\275\262\312\300\361\251\230\303x\236\332`\362\227\233\232l\345=w\366pfU\270Y\013\250\227\033{\037\220\221\\\234\333\272\273jFY`~\364\252\244\321r\213\253'\374\201aNY2~\323\007a\006 \347_T\3415\365\241\267\3042f\310\027\252\330\0210wh\261\264\206"
+	.ascii	"\362@\316\201\313\207)j\330\340\220\317\225X\032\340\322\227"
+	.ascii	"\3511\"\314\354#1\0057k\267\223Putf\230\367\005\325"
+	.text
+	.section	.gnu.lto_.refs.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`%\001=\013"
+	.string	"\026\337Q4Pk\222t\230hch\024N\020UUUUUUUUUUm\013\250\336\f\002\261\241o\3641\022C\337\374c\315\242\265\215\020\333lk\215\020B\b\3312\005>"
+	.string	"C"
+	.string	"G"
+	.string	"m\254\237\352\216zF\375\322t\247:[\237L\027\347\262\325\345\352\017\325\037\365\260\375s\371[\275\341\362F\353\216\313\235\325\031.g\264\336\270\234i\277\260\316\326+\365)\365\246\323q\373\375\214\002\022\225\031\355\210\264kzj\237Q!\322\316\344U\344\207\374y\375=\351\220/Io\344\206\274M\005\364\006\365\005i\200\264jz6\003\310S\323\333\374\310\027\346\027{\305|\337\0165{}=\271\202\237\357\233\002W\2400AB\204\350\207\300\364\037@}\007\261\337"
+	.string	"\376\f\342/`\272\002\250'\210\035\001\374\003\2247\020\237@\354\026P\257\240\364J\354\023P\217\221\207\210?\201\357"
+	.ascii	"\277\001>4\371\007{\007\363\017\324_\364\r\364\255\035\317 \027"
+	.ascii	"\350LR\0029\203|^\344\275H\213t%W\364\302\007t\n\374X\351\021"
+	.ascii	"\225\217b\237@\375!s\t\354\221%\177\216\274q\356H\344\f'_(r7"
+	.ascii	"\351,\322K\321\t\370\0310\260\377\302\373-D=\r\004\001aL\364"
+	.ascii	"J\027\034`@f\036\263znh\033\"3\026\370\n`m=d\025\242"
+	.text
+	.section	.gnu.lto_.decls.73bc6b1761f7efc9,"e",@progbits
+	.string	"(\265/\375`cV\335e\001JO\026\200U \016!\235t\253\277\256{3\224\254^\217\"\256\346\357\235\257\355\2210\031\346!\244\351\231\335\355W}9\310Jfw\343\247\277\356\207 WX"
+	.ascii	"\267.M\223\277\266z\022D\307\034\224C\245\244\376\322\350\006"
+	.ascii	"\253\364\210\204\212HP\342\333U\355{:\266%do\271S\325\006\345"
+	.ascii	"\0073\b\230\t\032\216>R5\215JW\325\223\235\320\270D\370\373X"
+	.ascii	"\325WRO>\252\232!\r\344b>\2448\332\244\330\342\265\024\373\203"
+	.ascii	"\206\264\216\352\266\263\224\314S@\036WW~{9'\201:t\350\320\241"
+	.ascii	"\303\255\313M?4\334[8|\223\325\347\334j\037;?\220xXj[Iz\007\017"
+	.ascii	"\336U\017\271\276\267H\334Z\277eX:\226i\306\025e\337\333\034"
+	.ascii	"\370\366\005\276u\302\177R\177p\264\325\215K\327\"\355o\f\216"
+	.ascii	"\0339\312*Z`\330x\337\340\303\341+\303\002H\337\256qq\260E\245"
+	.ascii	"\350"
+	.string	"{\275\352\366\337\306\324:\023F\331\367\275\005\313\350\0311r\310\350\322\374A\221\361\030S\242\340\240\372v\f\267\035?\254\264\027\377m\252R\216\211\353\005\224\027:)R}\337e\270\247\372\234-u3f+\013H\337w\020\374\252l\027-v\250\232|Q\366\355\026I\254\246\206\347\242\357\365:\352\277\215es\023\003\326\367\357\250\025?[\\,\223'\222/4-\364\375_\225\r\325*\222\031\250\222\211\"%\367}[\341w\013\374\367S;\325*#Jt\364\355\246vzQ\247\242\357+\037\376\257W\225\315\364\2070B/\345\344,\226s\336\340\206\221\362\247\246o\347$O\016\323\214\266,}_\227\370\225\016s\360\206A\250>i\372:\305\227\255\031}|'\215\2474M\372V\275z\246*;\250h^\367\352\333M\246dN\346\234\344\351\037k\326\314\372v\023\374\332\301i\377\376j\007f\352t\270\204\0301R&"
+	.string	"<\311\031.v\220\031\203\325\005H\221\276\177\035\203\367\301M\352\256\357\253\031^]R\265\330$2\003MB\226\025\257r\251_,\331\0217\261\013\262\3149\313\262\346Ue\305\253`^\303T1\277\035:"
+	.string	"\351T\031b\267<\257\211U\177\316\277U\237\363\025\r\327.\365\256*9T/\257[\252\331m\234\222\371,g:\236\212u\306\244\244\357+\030~\345p\362\374\375\375\375U\016\347+\013\370V\237\263\332m0\363\270\344a\351\373\312\205\377\327,\225\256*k\335k2g\247\264\252V\353j\224\212\305&\221\032\320\352Z\346\234/\302\037TW\327*\224\235\245d^\272\321\342\212z\333\3139o\350\320\241~\341\3109\316[\347\200x\242T\371\222\352\373\232\002_\004)B\376*W\253\324+UY\255\274N\251iU\3555\231\241\234r\316\037\001\256\272\355\330\234\257\300\2209'_\337\376\240?\204\021\252\225J\245\272m\320\224\363\225\325\216\2160K\322\354\345\234\354"
+	.string	"\324\241C\3475\252,|\017\002\374\327\270\337\346\346\n\232\032\310\276\367"
+	.string	"\376\006\360+\200{\352\317y\007\340\n\345\257g\025\255\272\245 g\247\234s\006f\\\337\224\260\276\225\255:\251\312"
+	.string	"\324'\017a\204\333\2452\036\035\277#~i\372>\004\254!+\217p\037\374\032\200\263\376\325"
+	.string	"\234\225I\320k\023\237\363X\225\314j9g\036\035/\261d\356{e\3659\317\203\201\352\317i\253\317y\214\315\\\177\316?\251>'\007\365\347\374kYM\002\221H\321R\353[\223]\307*\331k\262*y\b#<\307)\213\345\234\254\311\2333S\255\004\330\251\225"
+	.string	"&\234\027\223\331y\337\370\257I\376\212\244\212q\260P-\260\262Z\316\311\013:|\\\232\300\372>Y\177N\\}N6\213\243j\3002Y\232vU\003\177RS|\254\337\342\204(\340O6"
+	.string	"\353\243\363\374f\216\377O\250\372\f\3477W\374\326"
+	.string	"k'a\271\232\210i\342\257\"|"
+	.string	"\222\363\233#h\024\374m\202\277\203\177\313\t\375-\374{H\256U\240\366[\264\277\215\316~\273\341\024\341\377\230U*\373\255\013\310~\273\224l\021\327\360\237\013\260\351\330\006\376\206\201U\362\267\006N\242E\274\347?\023\360\261\023"
+	.string	"u\205\217\235\031\374]L\362w_\275\025\373k\361\257\023\370+\n{B\003\325\002H\376\226@\206\277w~K\264H\277\r\263G\376:\302_w\376~\252!\374\365Z\260\277~\360W\r\177\377\360\360\327"
+	.ascii	"\374\225\204*\002\020s\003\004\324\266\006\361\277\003\017\377"
+	.ascii	"7\310@\035\301_\275\354\365\300\177\332<\375\376&\2165\362\337"
+	.ascii	"\255\221\2766\300\360\037\001$\372\316\355\357.\213\374\253\002"
+	.ascii	">l\360\343:\277\031\202\277\207X!\035\364W\206\337\034\372\353"
+	.ascii	"m\220\213e\261 x\375\026\005@j\013\354\326\3373\354\217\277\255"
+	.ascii	"\330\256\016:\317^\325\025\352qi\271~+c\217\001\2779\246\253"
+	.ascii	"f\340\335Kg\2335v\240\337\314\300\352\200\321K\026\353\2575\307"
+	.ascii	"\215\366\016\200\377\226\371;\317^\375\226\004V\377\261\374w"
+	.ascii	"\243\362\037\357V\350\236w1\037\363\016\226^\017\300of\371\233"
+	.ascii	"\315\342\370;\212\275\361_\356\357\243\r\300\354\374f\334\337"
+	.ascii	"m\326\306\337d\266\306_\213\374mW\211\374\325\310\006^N~~\363"
+	.ascii	"\306\377=\021l\025\215\277\315\354\214\277f\375V\306_\267\254"
+	.ascii	"\007\177\027c\374\026\004\214\277\356\370\355\213\277ri\035\001"
+	.ascii	"\377I\360\0162\370-U\365\3522\363\351\357.v\352\257+j\213\277"
+	.ascii	"\246\370k\331_\225T\264\377s\277\225\372\255\212\277\246u\226"
+	.ascii	"\226bS\374\025\352\357\243:e\237\372\355\002\370M\256\240\377"
+	.ascii	"\313\266\372\373\352\267M\377\315\337\354\340\267L\277}\301o"
+	.ascii	"Q\3746\351\267H\277\025\376V\350\267%\370\355\007~k\201\337F"
+	.ascii	"\340\267\017\370m\320o\025\360\333\016~{\200\337\002\340\267"
+	.ascii	"\033~\253\341\267\031~\253\363[\234\337\342\337\236\277\275\177"
+	.ascii	"\253\371\273\357\357\275\277\227\177\233\371{\314\337`\376\366"
+	.ascii	"\362\367\333\337w\177\333\375\235\345o'\177\227\375\215\345o"
+	.ascii	"\271\277\343\376V\376}\366\367\327\337F\376.\3627\221\277\177"
+	.ascii	"\374\r\344o\255\277\261\376\276\372\273\352\357\031\177\303\370"
+	.ascii	"\233\352o\251\277Y\374\r\365\367\323\337\036\370\273\351\357"
+	.ascii	"\n\374\215\200\377v\177]\373?\366\327 \177\005\3627\323_\271"
+	.ascii	"\376*\365\277\203\277~\370{\351\277\230\377^\376\316\177\375"
+	.ascii	"\3371\370\353\t\376j\201\277Q\374\235\364W\r\374]\374\033\351"
+	.ascii	"o\342\177\243\377\033\374\037\376'\361\377\311\377\275\277\217"
+	.ascii	"\3766\372[\304\337\027\370\333\002\177]\341o\023\376.\341\357"
+	.ascii	"\017\376\366\340\357\016\177'\340o\016\177w\360W\345_\233\374"
+	.ascii	"\225\311_\325\376\232\366\327#\177\005\373\317\367W!\177\365"
+	.ascii	"\372\353\217\277v\375\365\305_\251\376:\365\327\026\374\325\001"
+	.ascii	"\177m\300\377\276\377e\376\223\371\277\374?\346?\331\177\261"
+	.ascii	"\377)\376W\371\017\200\277\277\277\277\037G\355\3279\376\021"
+	.ascii	"H\023X\031\231\357\262\216\370l\211,\267\3109\3272\030I\005\203"
+	.ascii	"L\337\253w\206\205^\\\337\367\304a3\227\fp\013\355E\262\357{"
+	.ascii	"\230\340\377\216\251P\310\300\210\271\313S\336\274\n\345\204"
+	.ascii	"d^\272i\242\022\365\266\227\217G\017\336\243\004'\305\246\246"
+	.ascii	"~`\211\2713@\221\270\026\372\276\252%Q\263\3149y\3570`w\357\254"
+	.ascii	"\222\253\305&\2216mMi\2269\347;+\266\306\313\rs\277\\0Uy\357"
+	.ascii	"~\267\\.\267K\334X\030\222\233[}\324\237\363\247\372\234"
+	.ascii	"\327\016\b\247\212\fXS\337\367p\341\217p\247|YZ\271U\232\315"
+	.ascii	"\236!qZ\023\236\bT\274 \255t\334\022\2730V.\224+\305\236!mT4"
+	.ascii	"\211Y\276Y\271q\247\035\030\025C\366\262\334\271\213\345^\271"
+	.ascii	"u\227\256*\257\225_\271>^&l9g<U\206\334\271\357\341\321c\205"
+	.ascii	"\337\023\003\277\207\005\276Q\356[U\276\312\205{\222\347f\207"
+	.ascii	"\334[\231\276\357a\302\257\257r\306\240\276\312y\2365\370\277"
+	.ascii	"n\367\211\027\221\262\246\276\312*U\027e\315\031'\227\255*o\333"
+	.ascii	"]{\037/\023\266&6lg\351B\316;\222\264]5\033V\351\252\222\371"
+	.ascii	"\0050\215\314on\3576\231y\261r\336\363D\301\225\207\r\237G\r"
+	.ascii	"\3777-\314<\2233s\227\\\264\213v\317Z\311\02721mf\267\254J\232"
+	.ascii	"\223d_\262\025X\302,\351{\236\"\370\377Ur\223\\$7\354\216]\261"
+	.ascii	"\252\274\311k\344\027\254\327~\315\272\313-b\311\216X\331\224"
+	.ascii	"\267\214;\222\346\253oy\223\267\005\274\345\020>\344M^\"\023"
+	.ascii	"X\352\353\003\3139\t\204\223\267e\025\267s\317\363\204s\252\317"
+	.ascii	"\371\0352\370;[\360e\241\236\245q\245\351\373\2356\374\0351\374"
+	.ascii	"\235.\374\035\030\370\277\310+\004\216J\314\230\276\327\353\006"
+	.ascii	"\251\312+\344Y\007\207\307\0235\246\276J9\347\\\017w\002\017"
+	.ascii	"w\376\027H\273\310\002\002\004\307\217'\036'\025mw]-\243\304"
+	.ascii	"\2201\\\\8\356\332R\371w}\334\255 a\222\034\373\336\036;S\236"
+	.ascii	"`\351\373\035(\\\375\352\304\364q\213\027d\037\273`\3515X\366"
+	.ascii	"\220\325ON\rr\216/Oyk\334\247\233o\212ku\241.\214K\343\352\270"
+	.ascii	"K\327\306\305\272Y\027\307u\272<.\323Uqw\334\031W\353\256\270"
+	.ascii	"7n\324\255\272.n\214Kus\\\251\333\342\262\270/\256\214;u\233"
+	.ascii	"\356\261*\357\225Us\273\306\372\375Z$p+\314\350\362\226^\256"
+	.ascii	" sNV?+}\367\312\376I!\315\300TYV?*k\372\310\245\272\335!s\234"
+	.ascii	"a\322G1T\252\337\224\352\346g\343\376 =k\246\t\022o\n\362^Y>"
+	.ascii	"\233f\307\0302\347|\373\204&h\331\266\f#\267\034\343\004I\306"
+	.ascii	"\232a\273\362\305\3122\347\344\361n\316O\312_\037\265\200Y\346"
+	.ascii	"\234\254~oQn-\220jY\360\220{j~\367\312\332U\276J\347\203\002"
+	.ascii	"ba\252\244\201\362W\277{e\243\344\2451\f\370\372\312\233\262"
+	.ascii	"\227s\322\206\213\226;$\033\270\327\241\202m\262\376\234\037"
+	.ascii	"\252\317y\2356\374\333\276\3334j@\"\177Rd\372\332\033A\267}\002"
+	.ascii	"p\002\347\326\367:j\370:-\340\353\354\300\327\251\201\237\263"
+	.ascii	"\207m\231;\343\n\217 }\237\263\304\317\211\303\317A\303\317\341"
+	.ascii	"\302\317\301\201\237C\205\237\363\204\217\363\207\217s\006\037"
+	.ascii	"G\f>\316\025|\0344|\034/|\034\033\3708K\3707z\3707^\360o\250"
+	.ascii	"\340\337\230\341\337\030\301\277\341\201\177\303\002\203P\177"
+	.ascii	"\316\333\204\301\267y\303\267\021\303\267\311\201o\223\002\177"
+	.ascii	"J\030|<\207\217\333\360\361\030\376^\3759\217\205\340\337>\261"
+	.ascii	"\312\245)O\230\264\335*_\371*\226\215\227>\345\223\276\326I\320"
+	.ascii	"m\333\224\255e\337\001X\266\016\234\2424\021k\302\004\314\222"
+	.ascii	"\264\274~\2622\007\266fE\207\n\313\225\231\232Mk0"
+	.string	"10\236\354\231E\263fvIU\332\264\333\244%\263eP6-\003Z]\313\265$\325mg\251'7\331\001A\346\234\f\262iV\314\313:\331'\233f\225\3301\233Dz@\353\3072\347\254\303w4\262us\277\254?\347\316N\231\025@Z\350{\274\205\217s\340\343*\374;\033\346\326vWZ4\035\001\233\221V\306H_k$\231$\317i\257\357\201~\370\"|\265!Y\260-T\245-r;\244\356\325\267d\021KD\271\304\321\222\205K\222\363\036x\006\003\361\360o\221V\210\rr\312\211\224$\316\223\253\265\030A\274p\306\322\264\362\372\202U\250\036\\I Y\247\f\035lp?\272\252\262pY\351k\271z\354)\211\215\276\007\306\341W\265-ke\263v\250z\262S\0205\277\365a{X\036Ui\267nm\330\033\026\207\335\2621*_\255\253\242\200\330\227\345\226\225akT\272*\b\200yY\346\234;"
+	.ascii	"u\350\260\002\0161p\370\346\260:*]\025\b(}Y\366\252\331*\235"
+	.ascii	"\032\210\2674ZvGU\332\254\263\r<a\262\344\246\363Z\035n)\310"
+	.ascii	"\371,\347\234\201\016\336[\322\253oM\013\272\305\202\300\217"
+	.ascii	"\035a}\017|\303\007>\301\007\236\341\017\365\347\004\332\031"
+	.ascii	"\226FU\002\331\252\314S\353\232\244p\364=0\t\216A\256@\347\377"
+	.ascii	"*\320y \030>\020\b\376-\f 0j\256\314\275\260TfraL}-\325\355\321"
+	.ascii	"N\215\365h\242\243\257\225R\323\362\343,L\337\003c\340\327\267"
+	.ascii	"\\\335*]\025\004\302\306,\013\013e\243\254\013\273\302\252\250"
+	.ascii	"J\333\342\266\311:\331\247^c[\330\024\315V\353\252@\2101Q\353"
+	.ascii	"?\265\021\354\222\022d\373\255!m\013\313\344\200$*\206\334\230"
+	.ascii	"Y\2217\265s\017d\201\257V\177N\233\352s\236j\360\317;\374\023"
+	.ascii	"\013\376\351\206\177\262a\016\255&\315\016^\031\230\2454\357"
+	.ascii	"3\322\265\025\327\227\017\310\004C\242\315\350\373s\fw\225\265"
+	.ascii	"\332\207\024G\233)\263\256\245Y\333\025\322I\016dU\303\304G\224"
+	.ascii	"\033gb\235\224\262\363\352\265?(\256\345\354\\,\245L\005ai\273"
+	.ascii	"\017)\21660\232\242\272\213\314\356\207\330[\263\3558\365d'-"
+	.ascii	"\033H\245\225\227~\322PX\330\3418\363\322]\252\233M\"\201iZB"
+	.ascii	"\372\b\327l\226\354\210\323\314j\200\3512\235\327{\255\327g\032"
+	.ascii	"M\213\3510m\246\361\372K\217i2}\327\313\252l/\255\345\275\245"
+	.ascii	"\271T1/]\245\347*\235Zfz\301\301W\262L\214\016;e@\\$\013p\177"
+	.ascii	"\322\300']\3659\177F\341\277\355\352\324\310\302|\271C\272(\205"
+	.ascii	"di\272S\211\235\017\271\2767\371\360M2V\372\n\017\032\027f\270"
+	.ascii	"t\261R\207\2474\225\034\026^L\005\351{\363m\212\311\206o\232"
+	.ascii	"\341\233-\340\233\\\370&\026\376\033\212\233\211\024R&\206\216"
+	.ascii	"'\307\017\211\235\216\2767i\340\233Q\370w\r\376]\342&6\\\312"
+	.ascii	"X\251\365\375\355\202\177\345\360\351\352\317\271\244\323\320"
+	.ascii	"\356S\224(>\372\376\222-i\264\272$yI\337F\343\361j\313\262\243"
+	.ascii	"o\233U\276\2776+p}\257g\203\023\327\2455\327\367\267\005\374"
+	.ascii	"\273\245\244\307\222`\032<\230\304\364\375\245R\222dM\220\271"
+	.ascii	"\275w\222\343\351\324\275\360\222\373\376:\341\244\255\352:\222"
+	.ascii	"\"\254\217\224\351\023B\245/X\322)E\323\230\246\276\267e\360"
+	.ascii	";\307\037\364\036\322X\225\317&\237`\025h9\226\235\242\247\272"
+	.ascii	"\314\262\232\207\325\262\252\251kj\237\212-@\374\352_?\361\370"
+	.ascii	"\261\354 \315B\023\351\026\032\331B\332H{u\221\376\252\312\036"
+	.ascii	"\322*\336]\375\343@\311\234\235zH\367h.Kv\fg\234dY\342\244\357"
+	.ascii	"7\324e\311rz\001\302Z\032\003\201\2701}}V\311\231(sw?\275\234"
+	.ascii	"Z6]GZ\024\351{v\271E\200hv`!\322\367\344r\317\240\355h#\322\367"
+	.ascii	"\334\322j<\\_\302\240\372\236Z.\306i\307W\225\276\247]\263\361"
+	.ascii	"\210]A\241\322\367\254\353\271\232\346\t\227\025-\267\204k\213"
+	.ascii	"\222\276\337\020\345\312\225\023\013]\231\030`9:\244\244p\231"
+	.ascii	"\373\211\245\331\266"
+	.ascii	"\270\270hqj\331\320\2359\243\326\367\033\310\342\342\316*Z?\366"
+	.ascii	"\376\354z\234r?\253\360\245\261Z\321\367\244R\371\316r\310\365"
+	.ascii	"\365=\247\244N`G6\310H\373\271\226v\302Y\273\234\274T\226\247"
+	.ascii	"\200M\220l\251\331\313PU\034vX\344e\361h\373\t\367\363-\204\021"
+	.ascii	".f\330c\311\222\276g\224W\2562K\240\372\376t;\241\3746"
+	.string	"6_a\330\374\372\036\350\f>\237,\300\252O\207\232\276?\225>\352\274\212\364\355z\270\363t\322.\240\024\261\352{\262=\217\215\314\007\216&sZvM}O&;PT\254U\351{\240<|\252\331@\271\342\221\325\367@&\\n \357\306\306N\264\fH\312\364\b\273q\2521\346\352\354'\032p\210\227%\257\276\247\331\341\260\226(k\364=\313\016gc\013F\223\276'\331\341\322\254\215i\351{&\017\007\2542\247\225\243,\311\237\344\004\002\204e\267\374Uq8\300\331\333[\337\003\205\021\371y\204\310\211\344f\311\271\t\204d\323]\206\302\301\341\036\301\252Q#\354'\022\270\027Xg\271\357\3658\374\267\341\211Zr\246\251\357i\344'\330o\003\354\262\245JY\337\003\r\301g\221\237-\3746\346\r\030`X\350{ /\374\237,\37469>\254\314\221\351{\240-|\240\032A\202\234_\265,O\241\220\313\304"
+	.string	"\313\231\342\226t\202\374\371\005\\FY\023\353{\n\001*\347\344\302\260\315M\251\351\353{ \025\\\\'\220\212\346w\345\007d\"c\215\214\363\307O W\310]\227\226\276g\327\016\331\322\327\226[\306\246\214^\032$|[[u~H\032D\216\254 ceu\362"
+	.ascii	"r\243+\023\003\2779\211m\355\370\311\243\007\037\024\253\276"
+	.ascii	"'\326\251u3\245\307\205\210\326\2315E\252\312\017\276k\243\311"
+	.ascii	"\033\025\035\255\345\212\207\215.}\317\2533\307\177\033\235\277"
+	.ascii	"\276\277\263\034\027\317F%1\243\314\300\356\274q\243\231jY\236"
+	.ascii	":\323\310\370!\367r\256\342`\366iI%\225TU\23550^\324\033\330"
+	.ascii	"\216\274&3}\317\032,\314\230q\306\2509\347\\\005\201\2579d#\221"
+	.ascii	"_\322\364}\006:\246\246\316\030\235s\316H\340\224\257&K3zGh\300"
+	.ascii	"\370\031co\311\034\224\276\327;_\374\267!\261\345\013\226\027"
+	.ascii	"'\025\322F\2315J\340\214\246\276\270\343]\253V/\200\214\365}"
+	.ascii	"\006-\\\270\bR\322dIKY\337k0sF\235Q'\213\0232|\035\301NX\340"
+	.ascii	"\336\372\236,\276\210h\265\350{\rZ\360\177"
+	.string	"B\235P\267\314\tX\227\007\223+?\260\234\247x\220S\303\310\223/}\257\201\n\376\317\024\347S]c\2255\2778j@\310\224\245\206&~~\247\223\2206\036+L\240\\5\375tJ\332\"ji\307\276\346\337\311\364\337\306\246\307\0324T'\323\271d\304H\026\273\333\003\250\214\310\325\231\255\232\034\254;3wcj\3244\333\355\311NZc\310\256\276>%\032j\3403g\314=\234Y\330@ss\317\315\316\306\230\033\032\240\360M2\3254c\246\331\324\362\360k\263\235b\3141b\314%\036\236\271\304Kk-l\352\240\226h\362n.\217\230\374}\375\324\341\377\264a0`L'[a\316,T?\302\372\376\007IKi)H\266l1\357pV\006\321\271R\322D\317\354r\363\356z\271\235A\351kry\236\236\037\326\036\234\f7$W\372\376\247\013\277&\253igW\2235\231\247\200MXhd\311R\335@"
+	.ascii	"2i\n\3739\342\233W\252\211\005\213y\305.\311O\024~5\257\234\246"
+	.ascii	"\025(9Z\350\365}\206?|sJ5\345\344n\232\3462\210\301\365\257V"
+	.ascii	"\267\323\315\204"
+	.string	"s3\343L)7\343x\2608\311\375A9\024\363\255\346c\316U\331na\021\365\006v\023\246\327\246$\312\315\267\034\025B\360\264\372^\017\003\321Rs\214\303\317\020\266\304l[b*\225ii\246\223-\251\234#hD\364\330n:\261A\316\260!\243\257\251f69\321h<\001k\302\304d\032;\213[\253su\n\360X\206f\267\366:%C\026~\206\246#\246\331\021\363\354,,\314,\303K\025\315J\025\007`\027\256\262-\223\354fY\3638\272\260\352k&1\223]z\204\351%\307\270\274\250\314\260\\\326\206Z\216\334T\327W\tT\246Z\362%E\354\277\315\006Hd\250\021C\262\223\305n\017\257\211\274\260B\243\357}\300\340\373\260\341\3374b\244\323\234G\033\026fV\226d\370\265K5\213\024\341p\223\231\352FK.\352m\317gH\020sH\020\223\310y\275\233D\352X\b\302\244\257\020!\346\027\006\272"
+	.string	"\203\274\371\225\324A\353j\322\324\367z\266+\214\212\212\276\367\301\302\367Q\201y\230@x\230?\020\220sMbM\035s\325\221C\217\036\346\217\023\226\254\314\256\233?\334\324\024\t\353kn\231\\\377mr\310\242\372\252\230\\\246\217\"=\246 \301v\264\370EI\301\260\207\217\241\016\337\324QM-\255\352V\223y\352\324\022\023\365\266w\246\013\313\223\276\307"
+	.ascii	"\207_\253\333\211\205\265\226\304\277iCi\3320\2570\0341`\306"
+	.ascii	"\266\314\307*\017vz\314)\271\230V7\257~\363\206\211\243\342\365"
+	.ascii	"N\227\2469\036}C\b\272iu\202\275\351\340\353{\223\254?g\365Q"
+	.ascii	"}\316c(\202\253\252\332\200B\346\370\304v\340\2331\2529c\206"
+	.ascii	"\311T\217\270\315\214\311\022\303\013\374j2\235\257G\252\tCi"
+	.ascii	"\302\250c\316\243\215\n;'\313|\234\342\001.K{\"\243\35718\341"
+	.ascii	"\233S\325\244\242\252_n2S\355\230)\317\340\327\372\345\274\331"
+	.ascii	"\242\232RJS\312\\\252\311<\205\2435%\213\007\277@\207_\315\245"
+	.ascii	"\323\2142\243L\026_L$Xn\313\276\277 \005\337LQM(\245\t\325K'"
+	.ascii	"\344\253\005&\352\r,\037\223\036\374\302\031~\355\245\323|2\237"
+	.ascii	"\232\351\204\033!_I Y\336\223\267\276\311\263\234\363\006\236"
+	.ascii	"*~`P}}T\321\222\246/\335\016\216\n\245V\2234\312\233\346\376"
+	.ascii	"q\360\362\353\367\373\367_5w\215\223]S\263\206\325\367r\t\372"
+	.ascii	"\365\343\261\n\262T\325\267\"\353\317\251\241\372\234\277\220"
+	.ascii	"\205\177\321\334\275_\276_\276F\3039g\256\265\250\267\275\\u"
+	.ascii	"\344\360\013T\370\177}\377gf:\346\234_\230\311|l\3129\377\372"
+	.ascii	"j\326\312\341\327\251\266\026\340\377\3753\260\201\234\235\336"
+	.ascii	"\260r\316\325\f&\242d\272\301A6\351rv\312Z\242@\026\225S\026"
+	.ascii	"\r\250\263,\252\013PgYy\311)\310\322\205c\316Z\202:\313\371\202"
+	.ascii	"\223\323\022\b\254|\001\352,S\345\247:\252\232\223YK\331\t+_"
+	.ascii	"\310N\231\211\003(\247,*\2503&\252\013PgYT\371,+\367d'\246\343"
+	.ascii	"\n\247|\274\220\317\262\306\3443,\252\036\2503,*\250\263\254"
+	.ascii	"\265z\027\265E&\206\022\213\313\252\222A9e)\0278\230\216=tPI"
+	.ascii	"\254|\227sUK\221\217\231.\347\002\344\214\003\353x\307D\243>"
+	.ascii	"i\242\223jbc\302\252\311\234\363\006\027MZX\331\211n\251f:(\026"
+	.ascii	"\260rf\241\351Dv\221s\316\fXJ\322e\256J\267\264\003Gn\221\"g"
+	.ascii	"\rr2g\0279/\325L\227s^\3129\003\2178\2229\333\350\201B\272p\221"
+	.ascii	"s\025\220\213\214c\311-E\316\255\366\345\t\025\324\231\026V\220"
+	.ascii	"\333\2223dV\221\\\252P-\002\350Q\260x\001\f\033R\241`j\204\202"
+	.ascii	"@\217\204)\016\322\321\220M:\024\332"
+	.string	"b\360\304\320\365\031A$qb(\025\262"
+	.ascii	"\005\023C\341P\030<BG\030\321\024E\tEI%\214\030\212\251\210\242"
+	.ascii	"\244\022F\340\207\017\024%\2250"
+	.string	"\342\020\r\205E\031P\030\242H\304\035\f\374\204\207\241\342\020\020\232\006\211\220\222\204\322T84$DB\320Pq\b\303Ox01\024\026S\343\007(Q\222\321\320P\370A\321\230\364\201\006#\243\244\341\2208\004\246B\350\nB\343\211\002i\350\b=:\177\302\203\361D\032<BM\f\203#n\200, \026O\244\304!\260(\210\032\335\3248$\016\231+\244CBCaj$L*!$\244SB\212\242\220\016\241E!\b\241\3218\"E\215:gQR\t;?\341\001=\022\246\032\214@!\204\221X\034\022\036\331\020\r\205%\330\f\205\350\nB\243\2400\025\016Cd@\215<7 x\320I\205\303\020J#pH\030\031%\025eH\"\242G\302\264\247\207Hh\024\004Aj\f\032\001\345\370\210\300\220\n\213!P\032A\204\216\300@\024\"\025\016\223N4\r\246F\263\210\246\306 \007\214I%.\374l\220\201"
+	.string	"n\224\210B\354\\"
+	.string	"\332\001\301CZ\f\"y0a\304Oj\224dDG\030\005K\020\215L\344d\270)\246\"\220z\220\216\202\251\321\210(D1\025\241D\024\202(\210\026uH\230\030\n\323Txd\034\006\213\351\017jD\024\302fDj\f\032]0b\330\t\246A\020=\037\022\026\321!j\002\237\001$,\200\204\017J\300\177p"
+	.string	"\b\016"
+	.string	"\341\374\007\007\004\0059\200\204 |\022\202,*t\201\f\250\020\nB\243\261\210\246\302\"\013pD\020\213\206!\210\206\302\0222\020\t\223ljD\223V\200\026\201D\030EBA\202h(,\201S!\006\220@$L2q\323\237\360P\224T\342(\210\026S\343\007C\342\321\021qH"
+	.string	"DC\324\032\205\212\222J\030\317b\212dS\fDa\006(\212)z\204\032\241i\006\030R0\00690$\n\323\241aRQ\016*\024B\003\222\361\310\210d\342\202\022J4\f\201\246\301\242\022\261D\nCA\243\022\032R\023H)\030\203GBF$\343\221\006F!\023\302\242!\321\004\245\342\rR\360h\250h\"\021\241\027\224P#\244$\020EF\301\0237(\221\260XDU \n\r\205\034\244B@\023A\022D\241\220\211$#$\240\013)jD\213DCa\t\2414h\024:J*\246)\240HF"
+	.string	"\344\240F\301\241\233\264\210\2520\024\016\025\211\204G\346Px\204S\030BO\f)\005\2170\217\321(\250\202\021\021\251\210\246\303\020C\305\f\214(Z4\201\202@\215L\f+p\0244A\005\244\"\fDF\304\023F\264x\202\004\232\006U\020\246C\025@\211\210\034(\n\203@C\341\020jL\022R\n\036\t)\025q\204\224\222\202BJ\301#\036c\221X,\242?)j,*\"\342\240H(\322\013\033\212\212\210i\322\220"
+	.string	"\214B\245\240\220\211\244\022(Q\232\2044\024f\200\"\241H\205P\025\204iP\005a\021%\332\240HL\207\202EB\3044)(db(<\221\022\211GF\241\241\"\020\021QXD\221\204\212\220\214\204\204\206\212F!\241\321X\334@$\024J\205\303$\035\236\324\030,\022\"J\n\226\0202&\2250\356\024\207F!\245\242\020jL\022*2\026\207x\210\202D#\024A$\340\t\023\302\023\206\212C@\026\02070T\034:\211\305tH\334@\024\002\205\021\022Z\004\022\r\203GG\304!\240\t\032>$u\b\"$\331\024\214A\016\234B\243\261x\215\250\321H\334"
+	.string	"N\211$\024\320\024\202'\214D\303\340\t\031\020\205@\223V \034&at\250\230D4\356\020\205@\207\204*\240 \206Da\032\034\nS#J\344\203\"\025\026\211\302\"\022&B\323\"\021\t)\t\005\242\244`\t\035b\321Px\323\237\360\360\201\261\210\252 ,\022\025Qa\2210\035\242D\302\033\243P\016\b\322\"Q\004jT\"HB\205\023\025B\211\210\034H\213D\244\033\224\210xtQ!\017\244E\"\222\216qH\024\246HD \232\006G\020%\005K`t\005!\n\350\nB\024p\212\211\202\350\t\305\034\242 zB*\024\202\bF\302 \211\"ZT\224T\202R\232\243\202\020\035BG"
+	.ascii	"\335\004\323 \b\245\342N1\025\021\342'\205\241`\t#\243\240\t"
+	.ascii	"\250\021\2210'\375\t\017JE\237`\032\004\201\036\005\213E6\251"
+	.ascii	"\320\r\212\204\202\204\bF\240\220SD\211\204*\020\213\"\224\212"
+	.ascii	"FAa\0215\366\244\303$\242\t9h\032\034q\302\210\026\213\320\021"
+	.ascii	"JE\235b*bx\201`\032\004\301\202\340\b\242 :b\250\210SLE`\030"
+	.ascii	"^\300\230\224\006S\024\212\251\b\037\243\020\232\006S\024\320"
+	.ascii	"#a:L\032\241T\354\031^\300hD\207\210E\021C\305\236\024\305\300"
+	.ascii	"P\021C*\224\342\341\005\214\037@\217\204$\206\212<\3014\b\302"
+	.ascii	"\b\035\016\203'\206pR!\022\202\322\2410\t\027%\225\240T4\323"
+	.ascii	"\241\220\003\"thBh\034&\345\fQ#\213\036\005\213\027\270\371\220"
+	.ascii	"\007\r'\204`\244TD\001\347'<\030Q$\024\251\320\006'\"\241\305"
+	.ascii	"\017R\"\261\370\001\316\211\324\304\0205:\211\210\204\215\"\241"
+	.ascii	" qSD\211\202\350\2113\025\372\220\016\205I\300\007\005\231\300"
+	.ascii	"\301\007:\200\001<\344!\004#\245\242\361\003\245\342\007Ca\360"
+	.ascii	"\350\203\241\242\361\003\017?,\b\026m\212\2460\024D:\215\210"
+	.ascii	"\304\022\204\314\377\300&\025\213\226\276+f\230\234<\256\032"
+	.ascii	"\233\f4j\007\256\375\226\314\226u\213\033Uy}\201iA\007\252\t"
+	.ascii	"Q\253R\245\257\316\022 Z\234\227\025-}\201g\027\312\2248\365"
+	.ascii	"\275\006~\370\007\232\235|^ktf\312\3165\031\226\362\234\220\001"
+	.ascii	"\231\314\252\374\344\222\247\336\031+!c\1778c\254\334b(\271e"
+	.ascii	"\270\352\342\376\200IL\026>\214\234\021;\275\230d1\2560!9\227"
+	.ascii	"\226L\215\260)a\346\027PK\027\331\231#\346\336\225\274*_@#\007"
+	.ascii	"\202\221\231\241\343F_`\021`\013F\220L\274\364}U^\f\036\2210"
+	.ascii	"P\224\364\005\022\001\262\340\003\271\026\345y_\036\367X\330"
+	.ascii	"\3732\344\204\003J!I\323"
+	.string	"\343\353\307\016\031\221\263:$\021!K8V\312\324H\tr~\331!NUO^X0\023\225\222\036@\232m\r\217\216\005\360\207y\205\307\2136\037}\201;\200;\200\\6K;`\354\214T\355\345\252\030\034~`\217\003\271\200>\276l\301\311me\036\2368\275\034O\372^\203)\030\310\243\227\352\374\274\320\364\275\236\215\020\\\327^\337k\320\206\177\240\226\271\264\302\312_V\375b\243\305\310_\235\016\323\036\271\243k\001\253\231\352\335\216#,r\230\313\273\265\326d\306\325Y\245\337\316\224I+\323\211\212|\205\007\020\207\371\366\367\027C\353\206\022h\243L\313\311\027\262d\024r\r\031`\325\211$\325\343\342\004H\303<\253\341C\253o2C\225\021)\031'\220\032eF\352H\214\023\355F\214\027;\222\267I\016\006\216\303\001\251\222g;s]\270\334\365\275\006L\360\017<\232w=F\271\002J\324\201S\277\275aq"
+	.ascii	"\245r\266\264\221\361\321\027\330\002\350\342@) \013\240\024"
+	.ascii	"\003\260rf\002J\361\250\311\231\211\247V\002\324J\200\033\246"
+	.ascii	"%\204\311y\257\001\032\006\256\b:0\252\223\364\200\352\352{\002"
+	.ascii	"\241\200)\360\224"
+	.string	"+,\026\200*\3148\0363\026K)\200O\025\316\314\022\220\276\327\340\013\377@'\363J\205\335\222\266\276\177\177@\246\332\223l\n\203\267\304T\350\300`\001\227\016d\372\203QfM_`>_\350x\301:\262f\303\312\304\364\306\256\322\2449\327\324\236d\323\027/\313\332CI\020/5?\327\340`\351P\261\307\002\r\232\223\017\bg1\026\276,s\256\342`sE\013[\222\275\237|6\fXf\346nI\203&2dN\275\272\246\303o\256\222\311:\262\302\314O=\340\2179\036/\372\236e\316\027OD\324`\241\001s0\347\022\bk\251\214\002\340\276\372\372\366\264\364\236\306\302\374\\\236yj\240\344\2643\357\304\243\223\233\221E\266AM\216J\3145\002"
+	.string	"1PN\002\206N\250\343Q\304bH\327B\306A\245\2242E#\222$\215\001\243\025@ P<\"\022\n\027F\365\023"
+	.ascii	"\004L\214U=\224sJ\261\231\021I\222\202\324Yv\003X\211y\246\021"
+	.ascii	"\373!l&\007O\271\0214\002)\312\304af\331\nw\232\324D\002*#7 "
+	.ascii	"=\360\246$\236\363<\f\036\361\363\242!)\302\355P\301\017U\214"
+	.ascii	"u\265w\260\231\022\321\244\202\311K?\223\247\351\r\363>\342\227"
+	.ascii	"\361\207\204\311\250\205\036p$\307\022\235f\3644Ck\3730I_P0g"
+	.ascii	"\246\226\002\330\266\214"
+	.string	"\276\005\301Q\2256%,h%\230\375\033\3008\334\r\035\231\3705\205\245uv:\345\336%\006\n\030\305J\300:\013\372\265\302\024X\360\240\274\327/\026:\232\340L\371\337\210\020]\267\201u\227K\263\016\324\302\371/\214+\200K\231p\377\244|p\242\320e\001\346\375\0035FO\244\f\210(~l\364E\305Y\035iA3\2110\321\372\322^\377\317\005\bkm\017HuV\312*\030\201\357/\240\320\212\325\350\213\264cH\220N.X\026)H\360\314\177\267\375\320\256?cF\222\307\215Y\272.\022\213\327H\351\324$\342\232\004\034\353\370W\261\271\314i\375\212\3441\222\030\311%\265\3066\032YE0\271\020\204\b\032\213-\022\2504q\331<^w\266\0370\255\342\036\302\317=\032\fGI\220\350B\026p\037|\325\016\tH\3431\0212\231\271\037J\337#\244\215\300\251Vp\255\222\200\304l\210\202_[\267\300\375"
+	.ascii	"\034Z\312\260\233\031eoN\230\203!\220/\335yVC\013\002\027\372"
+	.ascii	"e#\333<\316k\274\251\255\356\216\213\341.\210\210\022o\212\303"
+	.ascii	"\306\275"
+	.string	"C\300\213\026*\242CuQ!\372\272\356\230k\226\212U\022\240\227\201\255\023\260\237\300&\033eB\207\200&\201r\203\233\365\230#\333\326\207B.\355\206\261\340=\224\027\004\355\301;\002\3419\233\273S&\201\244\034q\275\004\342\023 \351X\241\353\221i\260\230`\243\250\2725#8\205r\277\340[bL\030n\302\255\231\270\322g\236\235'\302\206\231l,+\307\371-\"\374^c\034e\215\370\002\242\232y\245\f`\371\276\374\222 \253\017\b\342\177\200\305\006\214\271w\212\356$%\017\332\200I\241;d\204>\031g\206\035\214j\235L\276[\377\221|\240t\326 ~\266i\301\253\220\301\340\260m\314>\274\350\360\016\023\333\335\343sW\375ZR\372\350-\377\230>r\3733T\244\r9\023E\335\203k\306\201\243\2120VT>\001\371\235\270\233\376\244\316\013\307\023\334\024\034\031\213\3006h\204\355\027\240\310v\377'wO"
+	.string	"\026r\323\353\251\326~\027\032\252\267\276\205h.\n\205CXtr\265\251p\240\333\004\264#"
+	.string	"%\230\244\376\266g\330\207\374f\360\023E8?\2137\313\352^\354\362HT\301h`m\335@\344\021\024).S\021/kh\341+\300+\320\340p\207[\267#\372\372\032\301\241\324OT\3065\262kd\337\200\027\231\246@\341\366]\374yQM\004\366\330\203\2003w\246\031\t\333:\\\201#)\303\001d\370\346\3026\254\211\025\374F\242\374\022}\036b\273\326r\326y\271\303\241\203\271*^I\314}\323\366\204\262\340\003O\301;\026Z\343\353\245\207r\326\372\246\333\273qR\236q~\003W\231f\264\0348\037q%\210\237\271\312c]?\2334\257<\327\n\261\370"
+	.ascii	"\006\201\037p\346\346\214f\324\246\250\366\037\375@Gx\321\t\213"
+	.ascii	"\257\367\315\311p)\352\244\017\200\235M\037\365l\236Pb\2065\017"
+	.ascii	"rW\022\261R\366\270\230\350\240=\3051\235_\232\213\261\217\212"
+	.ascii	"\357\027_\202\021.\254\252Z\241Gk7\005\r\205\006L\210\020\323"
+	.ascii	"W72?\213\217\007\336N\304u\270\211\022\344\225\274\235\277\245"
+	.ascii	"I \270g~\301\375\021F\343S\257\351\364\006O\270YR\223x)\223\224"
+	.ascii	"\356i\016HsRD%e\031\237\315\315S\227<\251\3171\004\217\3039\316"
+	.ascii	"g\236\204\030\031\355^\"\027h\262\003\347\236\310\346\264$`,"
+	.ascii	"N\352\035\271\331\274\332t\337\203\2464\357\\lY\267\365w\313"
+	.ascii	"\320&E\330\202\302\360\273\b\034\001\216\232\303\311\237\211"
+	.ascii	"\007\025G\361\211\342&+\317\224\324\311\267\361\255XA\274|\344"
+	.ascii	"$Eu\f:\212\343\377.\307\261\231\376-\027\201e\274|\371\260&\263"
+	.ascii	"\317^J\226YQ\241kP\317B\314\312\213\\\226\252\206b#t\340\367"
+	.ascii	"\234\023\273\021!\354\004\037r\203oI\234u%\205$\271\013\257@"
+	.ascii	"V\326\177\223\347\235\"\300g\375\037\241\001X9\327\013\016\n"
+	.ascii	"}\f\310G\240e/n\236\034a\270\216T\023M\225\231\025LjB\b\311\261"
+	.ascii	"\332\375P\227\370t@6\2603\273\263<v\r:q\246J`\305\240\035I\177"
+	.ascii	"\323\203Zx\007\323xC\021D\304\323\306S\207q\206\373\"\003\347"
+	.ascii	"\026\346\262\tcO`\325\316\203\244\3106\243sB\254\216\017T\340"
+	.ascii	"Ke>\300\002~\2516\222OR\260\334\035}P\241\217\t\252R\n\022N\271"
+	.ascii	".\3459'\036\235\275\024t\241N1\206\310\346j\351\037\362\265\336"
+	.ascii	"\305f\bT\2712\025A\026A9Y\226|V\341{Xu\330\354\374\326\227\252"
+	.ascii	"\033\277\252|\rB>/\b\354\f\253\221\320F\240r\377\255\221\312"
+	.ascii	"\006\321C%G\0027i$\204\230(\202_\362p-f\336\033\240\025\364f"
+	.ascii	"\016t\024\207\277\331\002\303\332@\002':\270p\262\310H\266\356"
+	.ascii	"\243\"\031\250;K\213L\341\023\233\267\301\363y\277\243yU\264"
+	.ascii	"\243\370\253Up>\375h\325\235\320\310\366\367\341\267\362\216"
+	.ascii	"~\270\344\231\f\227{e!^\232\340*vl\205B,\350\221{\177\305z,\354"
+	.ascii	"\001\346\211\225\2750=+Im\377\316\301Yhs\027\214\031T\211t\210"
+	.ascii	"\227\023\\X\245\203L\\\362\321D\333x:\336\001\325S\264qsC\250"
+	.ascii	"\271\275#\367D\272\364\272=\201\032!R\347\306[~\365\026<\324"
+	.ascii	"\217\224\364\024~\\h\036_e\241Fsn\277\347\177\300A\304\373=c"
+	.ascii	"\363\033\267>4\252y\225\353K\244B8\340Y\332\343\314,\264\360"
+	.ascii	"\252\330\203\324{\253\nL\210U/Wa\"\035\363\345\313\351\202\261"
+	.ascii	"\307\347\366\227\221! \033-_[M\342\210F\252N\2618&\275\013\266"
+	.ascii	"\311\031Q\261\270W&\301J\203\023\361\207\314O\343\337y\337\220"
+	.ascii	"\340\201\024U>\030!\206aa2\331cR\331\206\271\rhl\351\001\301"
+	.ascii	"03a\201\266<\327\325g\370\311\357\250\315\354W\034fm\325]\250"
+	.ascii	"\217\335J7\020\272\2320(\363\267!\314\337\276\225\375\b\225/"
+	.ascii	"\211U\3059\247\363\340X>q=\254CA\375?\001\256\364\311L\241\233"
+	.string	"$\260:q\0301\307\307\206\353\025{\030N\030P\340j\177\376\335p\035uE\336~\345k\320\206\bMqf\275\262\2532\315~\226\204\275ki\232\307-\315\212[\303\255\211{\252\226\374&\027(\037\257\226\3176\254\"\336fn\334\264\340\336\2170\355S\205\202x\030)\004P\\\243,\033\260\243\235\016\213\242\270%\343\230N\322Ek\326\257\332\020\f\235\200K&\351\353\327/\006\217D*Z\367\036\363\273aG\tY\024\013u\315\274\322\337NRE\220\263<%\222]\264\332\247:\331>\243\252\216'LA\200\232\356o\0138\303\373\006\032%\335\306LcL\bT\255\272`5\216\\\0179\274Mj\222!H\344\nPP&Ax4\255\031\201\237S\254\226\255\246\207\3439\037\305\235\266\251\361y\031\035a{j\241r\373v_\t\271+\036\\e?F\302\215P\234\274\363\030\262\2571\b\270F"
+	.ascii	"W\2218\005\371\232\322\314\343C\034\036\017A\301\207y\300\222"
+	.ascii	"\377\223\356\330\025\034\244d(\251\370:\310@\177\374$%|E\025"
+	.ascii	"\232*\352N],\205\035\027\n\306#\347Zx\333\276\316B\360\004\313"
+	.ascii	"\001pK\\\226\250\326\001\371\2403`>D2\303\356k\352`#"
+	.string	"\327j9dpUD\361\241o\361`\336^x\355\264Q\377\3743\003\267\202\346\313q\347u\246\337\340Y\"<1\330\330\bZX\n\316i\363~\365\3356\250\311$E^\255\346JS\345\375\344\370)\320lzM\333k@H\271= \205\033\267@F\266\367F}\256#C\031\265\223\330\256\265\224\246\321\2365I\240\232\243!i*\376\317\\\347\277qGe\257\211]}\255\265\003?\371\370\241n\254\031\254\334;J\342\n\265!\216\241\274AuV\273\303\374\276\377\243\241\013\250iQ&$\355\223I%\323\326(L\3059>\263\216\252\2431\211\261\227\346\312\200\326>W1cb\025>\256\032\205\257{\022\024j\350\273\277 \177\bw\333\310\"c \305;/\251\267\311l\261\363n#\252\214\323\274\315\3001O\261o\356\336\212\361\241\036\232\325%\023g\034\212\rHB\24065\027,\021(\211\207\307ds\275\331\213\201"
+	.ascii	"\342:\3725\004\227\336I\273wWxE\336IH\337\321\036\030@\364\207"
+	.ascii	"E\370Zf\207\036\374a\020\304\232\256"
+	.string	"\005\340j\202N\006e\312\302\216^fm\2452C\211\267joe{\211\235\324\277R\210\305\\\020qN\006\374\267\212G\004\035q\361CE\317R\330\240H\0224 \022\204\363\243\340\373\257\005\230\002\222\263\200\365\306\202\320\260\203\221\271~\330\364\363\24231\350q@\314\322\231Wa[\233^>\326\363\0248\276\224T\207$\237qC\020,\213a\335YD0\023\037\273q\334T[I\341/\320\004\016\356x\332\203\310,\026\312|\271\242\263\3407\257\224\360\366h\036\032\241\312\034\t\032\025&\272\203\315hY \022%'%\224 \302#T\233\270\234\213\237Uc\217M\023^(\266R:f\307\340\031~`\212\020\246\\\260yN\277/Qt\365\200\214p\2446\002f\331\266Gp\023\301\311\313\276K\2309 \b\032&\2771\240\340\267\356/eW\207]\221\273\352\214\304\276\301\334\257\317\b\t0\350'L\223\003\245\276U"
+	.string	"\343\224Vo\305\020\"\242\247\305Xq\2119\311\177\210\256\016n(J>\344\214`c\321\203\024v\263\277E\254\357\213\250q\030}\246\375\370af\032\013\327\0017:\006\006\2551\363\263\017\317\243\271\272\311S\317j\274\213?{\347A\207^\344\325\257N\374\354|7\240_\247\3107\324\217\346\330h\315oGc\350\275\226\244M\200z\353#\273I\020}\004{<\365\315\351\363\306ls\033Kx\271\206o\373\231\247\351\205\206\323\001\274\274\036\233_\376P"
+	.ascii	"\177\240z\240\270\215\323\344\243\203\327\374\260\221\345\n\336"
+	.ascii	"Z\236x\226\"?l\337\251\273yI\337\331\3037y\215f\253N\023~B:\224"
+	.ascii	"\233\327\0054q\243\177^\375t\252\217Z\373\371\315\313w\3750L"
+	.ascii	"l\371_P\216\346<9\363^\376g\322\344\002\n\247w\257\372\211\353"
+	.ascii	"\300\f<Dy^\326^R\277\302\266\325\336\322\332\262\3567\305\037"
+	.ascii	"\325d\036Q\340*NG|\336\326\032]\346E\310|\260\231\245\341\314"
+	.ascii	"\355\300'\006\357\033\264\017\362\336\303\347\276\331\360\273"
+	.ascii	"\213n\377\036\372\276\351d/\367~n\273\345\272\207{\217\275\300"
+	.ascii	"\373\203\265"
+	.string	"1U\365\261w\315\255\221\240Y\361(\372\177@\223z\277|\354(7\266^\177Eo\222\271\215\355A\302\233\220\016\224\330i\3076\351\237\223\325\357\3541\\\266\3477\266\322\234\204\211\030\256a\356\301\347\016\232\033\350'\3409\205\305\241\205\364\245\311\021z\307\310F\026\230W\t2\026\326\273j\377\252\3563\271f\376\357>\n\370\327\357\bZ\372\031,\024\223\344XQ\274\240\336\217\342\365\366\273\232\037n\316\f\224o\311\353\035\374E.\240\303\\\261\027y\\\341\017b\246\333VA\366\034\240u\025\0304o_\364{'f\003^\315\230\031r_\361^\262\277\370\233\273\275s\354\242\214\243\230\307E\267\345\273\360\213&\235\241\274\032\254\211\354\237\006oD\003{r\\\203z\246\346\273\206\277\356j\b\220\217\236u\0032\312`i\027\235)\273\275\236(\254Z\354\271\b\374t\322\212Q\371\3046/\370\261\262\023R\377\032\370u/"
+	.ascii	"\352\324\313\3435\341F\226l\006\273\002"
+	.text
+	.section	.gnu.lto_.symtab.73bc6b1761f7efc9,"e",@progbits
+	.string	"readBufferPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"processBufferPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"readBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"globalResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"srxl2ProcessChannelData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"srxl2ProcessControlData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"srxl2RxWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"srxl2ProcessHandshake"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"srxl2ProcessPacket"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"srxl2Process"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"srxl2RxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"srxl2RxIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"srxl2TelemetryRequested"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"srxl2InitializeFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"srxl2FinalizeFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"srxl2Bind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"microsISR"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.73bc6b1761f7efc9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1302 @@
+	.file	"scheduler.c"
+	.section	.gnu.lto_.profile.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"!"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\254\002\365\016"
+	.string	"\204\022\240\003"
+	.string	"%"
+	.string	"\370\312\200\357\003\036\002"
+	.string	"\002\001\002\002\002\001\002\003\002\001"
+	.string	"\002"
+	.string	"\002\004\002\001\240\342\234\212\n\002\230\201\227\344\002\002\002\003\002\001\003\267\343\241\205\004\337\363\213\234\n\016\005\310\213\254\231\r\004\006\313\204\207\323\003\004\002\003\007\b\352\263\360\321\b\t\n\352\270\372\363\016\004\002\005\002\006\013\305\365\377\217\006\016\007\002\001\003\002\003\f\354\241\333\263\003\006\r\267\237\261\376\b\005\002\b\002\001\016\017\217\346\223\377\b\004\020\201\273\366\332\b\006\021\371\303\201\363\r\b\002\t\002\t\022\023\024\025\335\336\263\251\003B"
+	.string	"\002\n\002\003\002\n\007\002\n\013\002\001\002\013\f\002\001\002\f\026\220\275\232\213\006\003\002\001\027\352\377\252\313\016"
+	.string	"\030\221\327\357\\\031\271\213\357\254\003\002\032\330\254\371\204\017\020\033\305\362\273\213\013\006\034\330\247\207\372\006"
+	.string	"\036\254\263\252\037\313\347\307\230\001\002 \227\314\374\033!\234\231\224n,\003\t"
+	.string	"\002\001\"\371\252\244\320\006T\007\002\r\002\016\002\007\002\001\t\t\t\r\t#$\236\376\250\313\b%\347\273\234\355\f\002\002\t\002\t"
+	.ascii	"V\250\241\261\300\314\214JZZ\016P\202q\212j=\021\0201C\020\232"
+	.ascii	"\242\202T\266\003\205t\035b\304f\031@\025\320B\326\215\360\364"
+	.ascii	"\037\334\360\301\036\350(6\347<R\324\020\204\253\twxH\323\005"
+	.ascii	"\002\334t\"\2342\3170\243\344\3546\250\001\f\333\363\242\315"
+	.ascii	"\351#\n]\037[\220\370z\020e8#Q\362T\366\226\251'#\024\375n|\275"
+	.ascii	"\334&\211W\024Vf\255\364{6\260\327\267u\242%\034\330}N\363\304"
+	.ascii	"\022\n\315a \224jdt\372=v\215T\215Z\324\363\277_+g\334\016\221"
+	.ascii	"`L\b\034\250\333g\034\207&\332I\342\223k\332w\031\322K\315o\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"U\005"
+	.string	"R\305\020\033\240E\215\001\377\377\377\377\377\377\377\017\320\377\275\n[\262E+\023\253\326f\245L)\236\202\r"
+	.ascii	"\366j\251\351\245\327\321B?;\333\326<\363\313\251\234\211!\307"
+	.ascii	"\032W\354\022\303.\330}\277jf\236\313\007\0011 \300\002!\253"
+	.ascii	"\361\021\207\004\021h\020`\202\020gfp\202&\214\003\210\220&p"
+	.ascii	"=\202\371\256\032^\035\f\023\373t]\212\036.tdx\337\t\326z\266"
+	.ascii	"H\033\264\242\207\bX\267\250\003\301-\025\307aXd\200\201\006"
+	.ascii	"\0320G\2068\230p\025M {v\020\3501Z\203\224\026\205\320\303\264"
+	.ascii	"\006\021\320\220b\016\001"
+	.text
+	.section	.gnu.lto_.inline.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`A\b\225\034"
+	.string	"f&\205I\300RN:\\LLP\275K\253\035J\027\213A\240\026g t\370\321\351\024\"x\036\242?Ub\341\361\311!4\3767\212<\247\251=r\376\021\004\027\b2\bh\177O\026\205\200\352ng\231h\333\3045*\004\266\225[\312\024h"
+	.string	"u"
+	.string	"z"
+	.string	"\031t-\017w\346\217\333\242\337\256'\036\375v\275\360$\177\t\257\256\273G>G\246\t\357\232\221\274\3566\301\355\257\273Y\3167\211\325\335"
+	.string	"._\323\3618\177\333\312\377\260U\325+\315vw\203\337\327t\257\351\366\277l\352\365\377K\206\273\337\231\275\372\351y1\373iV\312w\245\323`\177\255\221:\252\232v(\370W>\342\0228\331\363\333\365\034\354/m\226D\225\317\324\255\216\362\212-\211\344\2113\256\303D\026/\216\233\013\261\3654\257\r\036\224\331\035\253F\261\177\251\320\335\271\177\256\306vIe{\243\020\246lq\364W%\215\355\315\177\024\2150c\213\363I\324a\350H\366\222\021\275!\027*+x\360\3308\371Kk:\376\332\344\215\"9~h\316\224\257\ti\001\177\215\344\305U\234l\"\001\262fg\b\361I1\270\001\360#\313\276<\226Q\316\232U\321\335\260\027x+\001\333\356"
+	.string	"\355\202&\207\247-\r\257\257\204\243\b\025D\207*v\225Q\016\210\221%\226ZH\241\250\037\037\237\226s\245P\026\261\241\306\211\327\005\3105\352\266\020>"
+	.ascii	"(\276\234c\366|\226Y*!&'>H;h\333(\037Y \370\264\034l6\341\256"
+	.ascii	"\353m\213\234\202\350\224<\3455\035\320\355B\312\037oA\240.1"
+	.ascii	"\376\200\205\232\270\364!\317\374%H\f=\262rt\210\315\022\301"
+	.ascii	"\230\002\242&~@d\346\3762\214\3042\222\261\323\263\344\375h%"
+	.ascii	"}\230\347\335V\336Yf\257\315\343\322"
+	.string	"\200\302\301$\236a\3166>\323N\373r\314j%y\210\322\333\372(!\005%\270\330\312\223?\331\226\207I\336L\266\374l\365\253L\252{s\nS\027\347\340\003\200\253\250\021Eg\204\204fF\222$\225\341p\"2ES\365\022\2004!E\323\244RFDh\302\t2a\312*(\224\213\001\216\034J\216\216\267C\024\244QD\240\021N\367\240F\320\333 u\021H\342H\300\030\344\r\313\261\202^\301\353'p>\355\304c\252^\223\313^\021\310\227\215\037\210\0050\221\f\345\227\021\346\357>o\034\266%\016V\212-'\235\007)\234k\232\224\034\035\004\371\005K(\313`l65\326\023# \321\256$\251\bJk<;\205c\016\026|(\034.\247\345\333\244%\256\221\235G\230~)\252\020\220c&GY\3257\240\3428]\243\271\201\312\327\347\231v\253P\273\260E\244\305&\013\312\324Q\246\260\246\0050b\024X"
+	.ascii	"9\230]\243\031\004\035E\351\260Iuh\371j0\256\246\"rOt\203\263"
+	.ascii	"\261\377*\025\330\345<\212k\224\3537\277n*\326\021\303\341\346"
+	.ascii	"\f\320\r\270\233\351\037\360\275\252\230\253\270x\375m\207\214"
+	.ascii	"8\\9L\035\310\021 \205$>\026\355\025\021o\260\021\330\213\306"
+	.ascii	"p\321A\321\227\326\326g\264{\002!\272\036\232\316\366K0\265="
+	.ascii	"\236\233\221\377Q\335o\343O\213\353\227\273\037\034\250\216\301"
+	.ascii	"\263H\246\2116tZ\001ro\363\333=\310IUn\267\031E\230q-\365\240"
+	.ascii	"\220?\315k\310\242\340'\346\226\300\273\217\223\307\f\341)g#"
+	.ascii	"\354\260C=\256\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\200\005\035\f"
+	.string	"\"\017-.`k\222\016\324 \b\022\004gd\033\300\006H"
+	.string	"Pw\364\036\302\206"
+	.string	" P\t\374\354\037M\253d\315\307\177\277\233\231\305\367\007\371\204\310$\003$\035\310\2066%\245\226\"\031\2160\344\021\004\347\302\243\220\361[\334&< \b\202\276\254\247h\245I!X\016\036\203\n\357\247\200\247\030\005\022\231Hv\310\b\311x}\216}\007\036\231\326\232\300\025\374\2151\376\342\316\211\256\200{\351!\334\274\231\032\253\344\017\367\326\254\327\254\316\210R\232\026\271\332w"
+	.ascii	"\364\225\323\373\351TY\317\351\004\337\016a\310#k\255\265S\212"
+	.ascii	"\\E\223_VKNz\222\336\275\314\237h\341\222\bV\250aMfjf\323:\303"
+	.ascii	"\032\200\002\221\242\"v\022 2Y\006e9H\200\004\310\031\201\322"
+	.ascii	"\210\302\tg\342,,-\027\0038wB?\2359^M\366\"\216\221\016\372\024"
+	.ascii	"\352\004\n;\310\345\037\0320\322\364K\2653\233xG)GZ!\370\337"
+	.ascii	"\033\207\024?\321<\036`\311]\222\365\362\332\244\234/}%\317\210"
+	.ascii	"\205H i.$u\263\302c\224\227\034\324PV\375 }\235}\264\254\275"
+	.ascii	"\003\2558:\354\310\017\264D\253\342\256h=\340\235\214\340\334"
+	.ascii	"\236\323\304\273\217\002t\266\223\007 \331\343e\237q\370L\327"
+	.ascii	"\214]\013\371C\302\363C\021*\031<\353\237\332\377\267+\301\310"
+	.ascii	"1\022\303}\376\366\027\235B\352\217\211KY\362<\354^W`y\002"
+	.text
+	.section	.gnu.lto_.pureconst.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375 VM\002"
+	.string	"bE\021\032\200G\351-\356\216\304\250Ldd\0301p\204\240@\277s\337\333\307\277\371\327\016/\304<\\\303-L\302\034L\301U70\001\3374\245\033]h>\323\231\315\307\314\345S^\311D\356q\377\214[\\Sf\226\b"
+	.text
+	.section	.gnu.lto_.ipa_modref.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`6\003\305\r"
+	.string	"F\0226.\220\245\311p\0175\366\177\331\254\273\257\350\366\273w\007\262 \251R;\212\317W\333\333\214\030\261\344\377[#\366\023\362\377\377u\333\266\275\245L\001%"
+	.string	"&"
+	.string	")"
+	.string	"\337\016\225OE\177?6\332Z\233>\265\303kMMs\365S\306\226\233sE\327P\373'2\007PG\037\374r\004e\224D\2503\233_\224\263-p\r\210\311\260\200\030B\212\340\237,w<\016"
+	.ascii	"xF\345\021\3429<\353\325\317\246lP\363\202\002\023\376\326:5"
+	.ascii	"uq\215\323S\272\337\2202F\001\223\257\3612\3510\345&\031\243"
+	.ascii	"[Q\304\217R\021\270\f\251\\\nS&\224\212e\222\230R\261L\032f\030"
+	.ascii	"1%I\271\244O#e\222w\234\016\220Vk\3532\337\242)][\317\035\231"
+	.ascii	"\020\345\334\017\307\023=\215\003l\250aAc4\265I\332;`\002\231"
+	.ascii	"1\253\036\021p\2413\222\221\026$\251\026\346o\t\\Hu>=\332q\306"
+	.ascii	"\203\376\3126V\\N\246\205`\201\210\311}\n\270\2365\221\203A\212"
+	.ascii	"\360\024\036r\026u\345\223\264\n\005\"\314/\237\230\006\365\304"
+	.ascii	"\323\026\n\305\346\"MjH]t\365\262\335\266?\2648\241\3164^\243"
+	.ascii	"\013zK\013+\2146\365\332P\263f\354\0052Z2\354A\031\272N}\220"
+	.ascii	"zh\353\003\026\246\\Jo\225\236\272'.\037CZ\211M\277\301\360o"
+	.ascii	"EB\271\242\022\213_\243\030S\214\314\373}\301\366\262\tA\207"
+	.ascii	"\225\001\351{b)\307\204N\325N\337\322\275\020\204\256\364\265"
+	.ascii	"\247r\036\375\226|\326\033\216Ho\276O\216\301\362\021\334&\342"
+	.ascii	"\f\005\234\306\372Fb)f\255o)@\n"
+	.text
+	.section	.gnu.lto_.lto.2affc0cc9053d21c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_queueClear.29.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"%\b"
+	.string	"rO77@o\323\001XP\226\344yi\204M\370:2us\002\017\340\274\315\023>'p"
+	.string	"O#\310d\370\361P\360\177S~\024\005\032\306\234\005\262\300 D\036R\273\273\355\235R\2566\230\265\320A\260\022*\016mP8`\240\025\306\241\233\001_\016\026F!\256\013\243\031oOm\374\030\210>.R\220.\351a\362\241\271?\372\210Q|\220\037\\ri^J\215\022\223\013\007O\236\360\335\23525\277\310\275,\240\333\345^\375\320E\035\037t\351\210\f\276^\372\331\274\264%&\340\253!\t\344\253\210\233\355m0n\330\2476~l9C+\002*\273\027\247\227\375\344I\207\355g\254\331-\367\272\375(\303\202\304\264\2734r\\;\324\374\207\034\240z\266CL\301\356\032V\017\306\035o\233\3006\265\315\022\016"
+	.ascii	"i\3317c\032\376\206\213\246\025p\0070\013*3\244\332B\\9\343\302"
+	.ascii	"H\026,~\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_queueContains.30.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\211\001\335\017"
+	.string	"\246^kG\360\262&\035\260\b\320k\361\316DI\310\1775e\002x4m\n\276\375)\005\324\3744\n\335\375\2360;,\207Y;\351\276\366\241\225\265`g\314\206\305a\3409?\350\275\026\301jB\341\211\235\350\272\f\261do)S\nW"
+	.string	"R"
+	.string	"Y"
+	.string	"\017\321.\267\007\320.\025\220\244\334\375\023\361r\0202\032V\004\315\371q\033\302!\217\337-\265\273&\343j\347\253\256\201x-\027\217\245\322&\34616\300\271\221\001\361X\342\302B\037\221\327\322}\354\032\243\007\314!\363b\256!\2239\247\265\305\333p\207n\273\263]b?\f\007s~\315\352x\360\336U\253\252\277\225\300\004\365\020\3403\347\313\354\307\274!wH\034\274\375\317\217Y\344\2538,u\320=\233\nf\013A\032\036sN\221K\223l\227\004\342\355\224-\262\255j\037\305qR\317Y9\2009]'`\314\371!p\202\355\322_\346\321.u\007"
+	.string	"qX\351\354q\3169\345\201\357\206\366%:\330h}`\351L]xp\315\210\373\262\266\337\023\b\304\242>l;\303[\254lsN\006>\213\207(\277\346\322)*\372\226K_e\037\273\001\033\031&vV:\333\237\0350\331\356\313\376T\272"
+	.string	"\007\215\031\257\313\016\245\222N@\235\240D\217FN$\n)\021H\022F(\316B\351\244\0027:\241\270\221\0026] \2358\024\223\351\304\211\276\371u\371)\376\340\347&\324\221~\247=v\b?#B\235\375;-\306\265\311jY4\332\276,\232\211\241]\035*\362]\027\333\353\240\306e\177\341\036\277\306\030\314\023\036"
+	.ascii	"i\355\233\202\341\257j\356\2500\221F\214j1\204q\2776\244\002"
+	.ascii	"V\bmK\n\302\033\023\305\363\202\302<\n\232h\211O\314\212\242"
+	.ascii	"\013).281V5\334s1\316](\021\252P\256\251\363\236m\237Z\332T\257"
+	.ascii	"\275\204\371\004"
+	.text
+	.section	.gnu.lto_queueAdd.31.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\232\005\245\""
+	.string	"\246\275\327I\200\030R:{\346LS\017;J`\002IP\022K\375\240\372#\335\211\001 <#j\177\326S\262\270\300\334\353\203\030\021_\202\226\3628\335\346\231\204!\276V\2623_\bU\314?\002\3608\351\007Uj\237\315H#\204\310\235d\303"
+	.string	"\270"
+	.string	"\307"
+	.ascii	"F\314\353Q\313|\304\2742\263\265\314W>\353\350\313\340\177\367"
+	.ascii	"\"\2074\271\227\311\200\033\250G\231y\001\351Q\3657\351Q\007"
+	.ascii	"\017\216\030\351L\252\246Oa-u\221\271\227\t\354\03677(\007\370"
+	.ascii	"\311<\257\215t\336\272\323\251\271^\212\236\355\263H\374\244"
+	.ascii	"\363\322\234\214bKv\335\341\001u\343;\016F8e\231\035P\306\353"
+	.ascii	"\244\324\323B\031\215\246\2479E\235\026\210\033\230\213\331\260"
+	.ascii	"\271+\335x\017G\352{\"\n-j5\343\347Y!\353\312\207\357ix\366V"
+	.ascii	"\363\354`\267/\236\210\266\325\031\367\235\n\216Sd<\315\351x"
+	.ascii	"\n\3002\005w\255\357\024q2Z\233\273p\357e[|\202:\0038\363\031"
+	.ascii	"0s\004fTA\020\322\320~\370\032\311f\351;\004W\225\2415\303\374"
+	.ascii	"%g\302f\374 <\304e\366E.K\217\276\257u{\3054\346\230\025\245"
+	.ascii	"d\343\230\231B\333I\2624\311.n$\017\320\311\261\226ql\376u\376"
+	.ascii	"}\371\327\260\345\336\303\316\274\323\362\232\263\274;-\353r"
+	.ascii	"\226\325\324r.\265\234\236\226Q\324\362\211Znk\331\236\226O\300"
+	.ascii	"\267v4N)\273\215y\233\342\316\334+(\031\221\177\375a\267\314"
+	.ascii	"L\276\030\257G\007\214L\345\225\327\277\370`\274v\035=\311\233"
+	.ascii	"lt&w`\032sT\336{\237\204\337\305\337:\227\321\225\260\231\201"
+	.ascii	"!\363>U\220\212\242$s\357\3459\312\017\324\243\006\316\271>\027"
+	.ascii	"b\021\241\215c\264\323\376R\032\235~\243\235\2461\236\021\253"
+	.ascii	"r\310\272\324\320\235\335m\227\\S\206\326\f\225\017g\337\314"
+	.ascii	"m\311?G\003R\357\035B\340KiA\242\273\277\034\205,\225l\334m\226"
+	.ascii	"\260\312\222\372`jG<\312\231m,\030H\013\346\242*\231C\020\303"
+	.ascii	"E\261\327H~\363\030\324\256\232c\350\313~\260kP\023\322\034\353"
+	.ascii	"#\245\003\002\220\361\242C\214\332\033\220\264\223\274\3768s"
+	.ascii	"\272\337|<\377\365\213_\277\237\345\274\367^t\301\177\235\323"
+	.ascii	"7\"e\205x\024\202\341@B9;\211\3235M\304\345\346\341O\202\352"
+	.ascii	"\275W\002\337\311\311\202\370A\216\262\t!\241\364(Nc1U\035\263"
+	.ascii	"\310Zm\313VXw\222\377AA\326D\221\317\212\223\177z\210\200N\260"
+	.ascii	"\020\001T\342\247\b\210\"\310G\b\370CT\004\354\331\341\241\024"
+	.ascii	"@D\300\025CCD@f*\275\221l\355\313R\261kP[\322\034\323\335\354"
+	.ascii	"\327z\006\265esl}\331{\275\346\013J-\364\342!\331\331t\277\365"
+	.ascii	"x\316\343Y\031Z3\267f`bQ+\257m\372b\347\261Z\023\266yY\253#["
+	.ascii	"0v*\257\371\314\361Zgm\270\027\303\274\327\236`l#\036"
+	.string	"k\372-X\300M\227\304V\306\370\263\271V{\327\314 |\354\213L!\007\261\223\230\237E\005\216\226\023g\013&\240Z\333\265\345\262\340:\255\353\023\r\361(|\232\212\036\252\"3o8\226\240\005-G\257\250\215\262\025i\250g\2644\355t\250q4\004\tsHdF$\020\221\304\031\016p\002\021*\263n\021\2601dFR\220\333\001h\370\351\204\307\361\233}\205\035\021!J/;xx^\310C\274#~\"\0358\351D\337\b\221h\222\247@$:6 \331F\177~\001\271l\367\206\340)\222E\342\365\032\217Kfp\205\315\003\232\177/\321\367\227%h\215Vf\270\332\242\321K\244ED\374W\240\260\306\254\f\243\3428@\256x\016\242\265t\006U\007\243\3412d\035@\321\375\225\235\277c\213\311T\323?\033\261\003\323\234\256`sMDV\357Tl\211%\332\334\rH\234\342B\306W8C51s\310\326"
+	.string	"\262N\322E\222F\246\270\361:\326\206\263a\272!\275T\377\224\267|\017@\361Du\347\250\236\023"
+	.string	"\020"
+	.ascii	"\237\334\320%\371=\304\252\306E\370V`S\356A\323\356\207e85\376"
+	.ascii	"\251\b.\324"
+	.text
+	.section	.gnu.lto_queueRemove.32.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\311\002%\026"
+	.string	"\246\352\222J\240\024R:\224\347\013\326\334\n\370\213\241\370z\323\204\273\310\374\b\347\216+\350\242\352\375\226\226\340\025mR\367\377\250\377\365\343\245\365\325\234\204+\257\005\257\303\253\321\357\220\266\021\270+}=\210\337`\034\212\212\305j\t!{K)S~"
+	.string	"w"
+	.string	"\177"
+	.string	"\265\237\374\317\374\357\212=\252-\022m_\265\362T0\325Z\256\\\301\270\364\345\242\204K\307\005\020.]\320R\273mK\241\236\025\021\265\343\002\253\326\022\326#\216\262\263\334\207l[1\244\263\331\366\275\255h\262\333\341\331\3418,\362YJ\213\210LQ)\355>\354\234.G)H\230\3546\314N\372A\221;\035\356\365-7\375\350Q)\355|\226\305\227Z\353Y\267\363\260\037\367\177\317\377\006?\027\t/\366\027\373\022-\275\206\031\257n\351w\326F\034\260\200\216\234r8\330S=\222\224\272\203\376\362\306\frD\r\275y\377k\221vO\316/q5\237l>\311\366\366-\312\037)_l~8\371t\362g\363\273\371\314\374\r"
+	.ascii	"\201\t+H\001\252Z{\202F*\016\352db{\373o\371\365\235\374\266"
+	.ascii	"\330\244\332\366\016\034o\035\306_\357\006\220Zk\312\322\267"
+	.ascii	"\214K\017\314\375\003\013<\360Kt\013\177\372\223N\b\313r\223"
+	.ascii	"\264\201\036\311\264\305\036\373\247\261\341\325\375A\210\\\337"
+	.ascii	"\376m\302\021PU\263L\264\004BKc\363\325\227\006\316\212P\255"
+	.ascii	"uu\377e;\203\346R\265T\206\330\024\250\363Q\331V\207-\356\310"
+	.ascii	"\001\215\373\250p6\355\275\312\241\300q\360\335\263w\347H\253"
+	.ascii	"\271\273\303#?\301\334\t\334\200\032?Cf\007\375\244\267e=+\035"
+	.ascii	"\316\372\377\n\013\2036\326Z\035|\00333L3\203\271\231\217a\221"
+	.ascii	"\311\324\340P\220\271\0203\203a\230\201\261\201\305\310f0\026"
+	.ascii	"\004\217e\220\221\301nb1\031\214,\3536\357\313b%L\371\370-\205"
+	.ascii	"_[\270\276\2350e\365[\232\273\266\260\244\244\377\222\323\270"
+	.ascii	"\022b\007\235\034\242\257n\036\234\262\256\337\325dG\220\322"
+	.ascii	"\341\254C\221M\300\nD\016\007w\326Zk\250\262\256~\365\372\026"
+	.ascii	"\005\3101~x6\350lW\267\232gu\030I5\331\334<?I\177\237\0022 `"
+	.ascii	"\202!\346\214\007i\373\246\032\376\332\334\2310\246\241\305*"
+	.ascii	"\322\301\025\2273#Vd\"^}lL\375&\221E.\360f\261m^\221\312q6\201"
+	.ascii	"l\342\222\320B6\260a-\026\260\300&w\b;\216Y\177\242\363\206\267"
+	.ascii	"\024\275\002)\353\200\222\374n\353\023X\024\200\3268+e+'b,\016"
+	.ascii	"\356\267\214\312\033\265@V\035\2679[\254O\320B\210@<\367j\361"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_queueFirst.33.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\005\b"
+	.string	"\002\21767@\217\322\001\375ic\345\210~{e\"\025\361"
+	.string	"i\001\005 \004\237\315"
+	.string	"\375\252\337\220\327\247\305\224p\367\231\344EQT}\314\251\301\342\300\376)p\035!d\023\271S\n\3262\335\346\260Y\330\0304\215\204hPx\220Z\247\221\031\002s\021['%8\256\223\227\271\267VG\252\003\037\2558\370\210\227\355.\202/\362\322\306'=z\202\303QL\244b1\031\334\017\371\264\211O2\205O\360\337\243\357\323\365\030E\252\016\324\007\256\354\351\201\232a\337Z\035\331\206V\013K\245\b\234\354^\254R\213\022M\034\266;\366\305\367\370G\307^\300\334\b]\245\026\013\222\225\335)=\017p=f\307\\\217\252q\357\320\363\017r\013\205\241\362\201<\207X\302\356\032~\240\320\255\267]`[\332.\t\r"
+	.ascii	"i\331'c\232\372\f\267\254\224\030\333I\363N\214\025 e\213k\342"
+	.ascii	"n\004\326Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_queueNext.34.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\335\b"
+	.string	"\226\020<6@\217\322\001\320\316\311\231AL\265hOA/&6c\236d\374\023\030\002\225\306lC\224\326\217\322x\314l\313\024Eq=\272j\311j\227w\244S5\264\273I\231R*"
+	.string	","
+	.string	","
+	.string	"\032\255\230\335\b\035O\360\3566\037xw\032r\355\251\371/\271\006f\345\262\241JO\200\206\335un\250\324\255\267\235`\033\332\236\t1;\226RA\354kVU\266\323.\323\231\351?\001\217\025\005\226]\216\230\314\2528\227\210m\222\315\361GNB\262V\020W\251\327\332\b\254;\213F\243w\3474\300\225z\242\260\355\305\2241/\374\232\372\214\217\323M\036\r\363Y\276\360+\277\335\371~\275\273\253AK\207)\003\366t\262\217\204\350\341\003\341\tA\212\b\207\t\350\311B\260\203`P\305'\203\026 P\0069q\257*\247\007&=a<E\333\354.\203\217\362V\310\017\017"
+	.ascii	"i\331'c1\345\315hE\371\263\320\234\220\034(C`1K\211\255Q\214"
+	.ascii	"\2700\316\016#Z\260L\\+&a\222\001"
+	.text
+	.section	.gnu.lto_taskSystemLoad.35.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"e\013"
+	.string	"&\324KC \2138\0358\317A\231\004\351\351\210\361\216[O|\302Y\036A\n\034A\365\261\220:-b\356\300\f!\336\336\200\2145m\220s\320\301\t\340\\\303O\200\036`\037\355\326\301\237E\310\007\213\036B\233\354\235R6"
+	.string	"7"
+	.string	";"
+	.string	"\346\360\262\300\0365BA\261vw\243\004>\376\242s\3643\214&\"=\277\004\234N\220\241\313\262\273g\360\231B\202\346\3140\273\353)\"\003\334\365\2669lk\330\337\b\003\354_\273\273\246%{N?\213\270\220\341\"\265\013\240\365aU\225\302\201\212\355O\373\n\276`\274\351\304\332.\3114a\267\304p\006\304\253\345\025\330\353u\n\354\325\243\003\257\231\006\013\254\325\365 \314\020TH\260\372\351(\215\224b\255\346\356z\250E\3544\344\264!4=\330op\007\242o\300&\235y\321\253\337\301^O5\222\204\016\243\317l\331\245g\322\341G\347e<8\232\016\004EN\302\334\005\354HD\221n\204\0137M\006\304\33380\334.\026\376J:p\343|\037\270U\312\375\265\264\344\016\f\252\017\005\331\3670\037\302#x\337f\203\005\030"
+	.string	"i\3317c\232\215\032\006,\200m\n\313$\303N\230\020"
+	.ascii	"\320\201\313\200\316\003C8\020\210\255\270\006\252!\342B\030"
+	.ascii	"\002$\230w\t\200XM\001\356\0220`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_getTaskInfo.36.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\233\b\035'"
+	.string	"\372E$\017>P\250M:\360\016C6_2UR%$\032\233\335\305\020\025;}\306\304\377\252\357\\\321\2069\2245\264\370*\331\261\271\200M\030l\264c\240\200\217\372\037\234TF\315uC\322\b\331R\312\024\323"
+	.string	"\311"
+	.string	"\354"
+	.ascii	"M\371L\371{\002\301\243\263,ik\232\316X\241\334u\252\206H=e6"
+	.ascii	"n\367\337/\235\215\373\312-\334\271o[\347FV\316;\224):c\253\265"
+	.ascii	"\356\333\027\356\276\033\3319?V\215\031k\321\303\225?l\025\226"
+	.ascii	"\374\207\033\371}K\256\357?\0337\316\271mH\226@\255h\2146\230"
+	.ascii	"K\336h.\377\313\266n\316}\223\344P\265ri\203\247V\343\205c0\227"
+	.ascii	"\254\332\250rI\272\006\312%\177\376\221"
+	.string	"\326\370\245\356[\031&o\231j\255\300\366\362\250\245\306=\311\347\226$m>\277n\313R )\331\362W$#\026\305\230<S\266\224zp\263F\355W\034\243\335\006\347\307W$\343^\271\345<G7\272\270b\3312\357C\255\365<,J\331\363\366\377\222\377!~\223N[\275i\256\024\";\023\253c\206\366\207v\332\265z;\314\255n\2147\3754\263x\212\230\265V\016\337;;'\343+f\311\317\370\342\035~\225Kj\365\312\355:1sf\246G\310w\235\310Q[\\\377\307V\375\203\341\340\035n\357#?Q4M\032k%\277Q\214;\355_\r\210\004\201y\243\375&\277\213\344smQ\276\326\266\355R\330\270\375\325\276\331\265\352\361#\364\370\020(\377A\217_E\371\016z|*\312o\340\343OQ>\003\222/E\371\013z|\005=~\002\312G\320\343G\365\370\007(\337@\217_\200\362\t\364\370\003(_"
+	.string	"\024\377G\371\001\240\370"
+	.string	"(\337g\362{\224\017e\362M\036\237G\371e\311')\237\222\374\364\210f5\235k4\006tV\235\200\236@\234\362S\263\227\b\261\331J6~\215\245\026\240\251\344\212"
+	.string	"\332,\245\036o\247\233\225\324#\007\200\266P\347\353\006\303\273^\377'\234}\024$4\264\023\202\330FA\036\275\306\202\352\255\344\007\217\246If\377\"\226.\270h\201\224\2746\233g\207\t\0371\022\253\bH\030\257\261\312v0\324D\366ob\017mY\352\332B(\314Z\307\210\220\r\254\243-a\210\251\373O\261\203\274\332\323\320\356W\261\201\274"
+	.string	"\035aa\026)\227\354\316\240\366F\310w\334\022\342,\031\352\352\277\305\366\tj\370\036O2/~\214\304 )\227\\\267\275\2222\310\215.\316N\310wa\312N\273\017\f\335\352n\304\025\366\252\211\\}\325\"\006}\365\354\236\037\277b\016\343|\316\247\\\222\253\247\352\252\bi\255\265\222\026\366\252\003:tp\360\206\017\323\306\326\216 _B\312\327\300\n\003\3431\304\006X\216\032A\200>t|\365"
+	.string	"\326\b\013\002\304z\360\340\017\2600\240\220`0\f\3503\n\267\321\276u\266D\2425ps\3447X\256\334r%\032\0037\327\273\301\262\253K\215!a\213=B\221\321 t\204)\314\345\\;\331 t\326\203\236@DSU\306Z\350\033\0256\373P\325\031\034\264\025\361\f\225\025\276r\256a\341*\347\332\b\252\0066h\tD-Sf\\\366\271\267\241\235P\013O\371\234\326T{`\320\027\210fR[8\212\227\235.\374\304\353\204Tg\251-h+9,\n\322\230x\344\261M\320\nz\201\027n\262\"Ag!\350\tD+QjLv\256QK\344\376X\036\350\250\226:\222}\022\013\303b.\016\364\006\003m\201H\245\300\030\256\213\312\354\247s-F\201\326PG\240\257\210e\003\316,\247s-\200\232\250A0$\035FR\022\210HA\222$\255\001"
+	.string	"\003\021!\333\034\021"
+	.string	"5e\0305\201HD\224D\355\035\202%J\201\377\230\305\034\246 \006S/\267\3329\331-jD\254\207\335~\304Y\026v\303p\270\002\206\007jT\330\r\303\341\nF\222A>\266\374D\212\003\314\354r2\017\367\234\264\206]\323\204\177\221'*!}0K(\241\361h\005\251$\202\274`\262\320Th\024\245\375G\354\025\332'^\357\234\264\206]?\261H\354}\370\353\022\342\237\325\333\233\004\325\204\004m\004\251\177w\320%{X\n\2415/\264_\276\331Z\247:\271\334\220\344W\277\223W"
+	.ascii	"\254\243\256\212\226\202\221\f*r\211\235S,P\316f\231J\030az\344"
+	.ascii	"\212\300wB5\351]c\232\013\376\252Q\317\244\243\321\250\024\021"
+	.ascii	"\213R\351\214\230\351\302}aL\345\013\034\206\316\350G\336\300"
+	.ascii	"\206\331\206\243\206~\321M|8x\032u\267`\252\006}2\\PXM\360\233"
+	.ascii	"\337\372\372\312q\223\341\277\274\363\007"
+	.text
+	.section	.gnu.lto_rescheduleTask.37.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\224\001m\020"
+	.string	"\346\336nG\360\260(\0358\226\n\332AU-\346\211L\275\206qZ\003\201>K\246\256\035\254\2062ci{,\013+\257\032\252#:\365\366\201<\252\323y\355g\340\345\210i\224\346\246\302\271wu\322\031m*\274\224\331F\366\336;\245Y"
+	.string	"V"
+	.string	"["
+	.string	"\257\364\036\333\253]6\215\213#\3665\033\f\265\034\273\333M\021w}\253tJ\227\377\227\207\300\360\365\r4{\245\037<4=\242PFG'- \027^\220\024@8\373\244\037)5\033Da\214\216rB\314\370\313e\206\020&\345G\301\356Z\202!\312\375\271m\223m\006\366o\002\336.\376\364.\377C\\M\016\t\307\356\311\270cq*\214\022\257\335\276\314S\3701\346^}\230\253p\275\326\372\3124\204@\232\016\317\256X\340\325\013D\3209\333R$\2211\263\273$'"
+	.string	"\275\372\322\376\211\243p\335\245\304\241]\020.3\273\"\311\007@\257\002>\332\002\252\273 \001\355.\002\277\205WA\244\303\322\212\371Uv\f\234\316\317\274\314\035xhy!\353\201\311\321\376\212\263h\371,\376X\362 k{\335\346cN"
+	.ascii	"\305\206\211\016&r|\013\230\2023'\315\243\227l\237\001f#\314"
+	.ascii	"NL\352\260\305\227\2344\373s\034\307\321s\305\246\322\237\327"
+	.ascii	"\036\251\257\264\242_\204\223*\304CA\260\200\032\341N\rR_i\265"
+	.ascii	"\331\004\342\241&\260N(\t\246\257\033\t)\211t&\357\353@\006X"
+	.ascii	"E\001\345u+\225\312\3538qOw\256\370\201\r\216\311\204\321\335"
+	.ascii	"\335\215\223t~\332)\021y\320u\276\\\343\345&F\365P\341@\002\306"
+	.ascii	"&&uH\232\0339\037\350g\332\001! p\002\"\242\264\003\351\3337"
+	.ascii	"\232\356\261\261\267r+\221\313\352\326\344i\250\303v\213/\205"
+	.ascii	"\375\307l\332a0\226\306\236\266\232\004\267\300X\2445\006k\376"
+	.ascii	"l\021y\330\035\321\206\335\344v\222\204U\337g5\002\273\rh\244"
+	.ascii	"%\244\317\210\032\027\335\003"
+	.text
+	.section	.gnu.lto_setTaskEnabled.38.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\335\013"
+	.string	"f\327Q?0M\225\016k\325\006w\251c\007^cyA\024\213)\224\260lA\271\241\241\302\245\336\032\304x\373\030\313\270\315\355\363g\232\300\fCQC\201\003\256h\341\027\315\fn\216\261\206\310&[\312\224\002="
+	.string	"A"
+	.string	"="
+	.string	"\360\223x\313\233m\342\036\207\375\306\007\267\361\261\273\230n\370v\250\271\371\327%\222\352J\207\020\325U\343Y\241C\301\312\356>\343I\241;e^\227\335u\246\272\013\267u\333\030\333\t\354+\b\351\314\364\001\004P\215\300@\354Z\370R\254\207\325qa\373\3665l\311%\2665m\003\007\266{#\001?\301\201!\002\001\344\226\237\3661\356a\373\212\344\310n\206\025\307\256G\300\005 \267*\247\304[\001\311\2550\345\356\256z\024U5\037H\240\022\205S\257\252Z\202SMR\241\n\256\003\345\244\b\365\312\340\"\004\327q\312\317\366J\251\032\354\353\367}\237\325\302\276\367_\232\216_\3750\323\232\001\234\254\243\311x\262\213\203y"
+	.string	"\312\204\2427\026-\353\2108Y\203\r\b\3638\310@\3006\032\b\263\f\360'B\246a\241\317G\303$\336^-\274"
+	.string	"\203\207IO\020\306\214\n\325\026I\310\247\374\214_&h\311\227Fu\024"
+	.ascii	"i\3317\323\342\235!\013\216\002w\300\330T\265\f\016\241X\221"
+	.ascii	"`\226\301\2723\245\240\031\330p\215!\205\273\005\252i\340\004"
+	.ascii	"\001\003\0365\262?\2242"
+	.text
+	.section	.gnu.lto_getTaskDeltaTimeUs.39.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`&\001\r\016"
+	.string	"f\332_D"
+	.string	"\261&\035{D\003\030\375 z\205\265c\373\fU\301\026\266\303\350A\025JL\003\330\204w\003U\224\354\255E`\250oh\236\255wqSg\200\377]\0054\2406\007\271GE\205\252\320\2652k\367\336R\246\024L"
+	.string	"H"
+	.string	"Q"
+	.ascii	"$\370\347\336\001\377t\346\332\341s\232\232\017 \256\016A.\177"
+	.ascii	"\256\300\f\235\032\243H\301\221Zj\\\242\250\222N\002\210\315"
+	.ascii	"\025]\256\016A\211hb\024[.\300\007\031"
+	.string	"\035~\363\\\211)\231\037\220\335u\272\342\205\373s\333\013l\177\330g\005*c_\267m\333\2541\206.\355\376\372\325\351\324\364C\243\020-\022\354\354\266l8\226\305C\301\3016\212-\262\235\371\327\211C\273\032R\234\330\205\031\360\001\320\237m\337\346\"P\2549\330\206\370\231a\251\200ccw\263\001\017\253\253\304T\344\274\016\0010.b+Z\331\243\030tXv\334\351$\264\017\037gB\004\320\356\236\306\004\376A\r\275>\3421\023\237\306)U\336\365\347\253\340\337\365\343!\347\306\013+7\303\250\341\261\240*c\322O\240\352\013\214M\354E+{l\330*\003\"\nFR!%\320%\017\224\311\201J\304\304\240\224\312\0364\b!\311J\250T\346A\300'\b&TVr:\2412\021l\357Vc\234\201\347\345|\r\332=\247\277y(\006\215\034\n5uE\r\302\322\024\267\273\013E\251j\217\220\344]N\235\006\031"
+	.string	"i\355C\303\364\304\330\220\306\006\370\031\204\006\rA"
+	.ascii	"\270\020R\350\241q\020E\013IZ,\te\034E\265wT\216\300\242\250"
+	.ascii	"MH\\F\271j<\231\tW\374L\223\264=B@\201\246U{"
+	.text
+	.section	.gnu.lto_schedulerSetCalulateTaskStatistics.40.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\365\007"
+	.string	"RO87@o\323\001xY\306\213\223\314\302X\357\300n\341t\240pV\342\337\3456\325\177\215\3671K\2014\302\352\232\035\357\013JF\004n\2328\260\302\243\351\336\f\246\255\355\235RV\215\310:\225^[\275\266\271AP\324\331\261\266\211y(6i\201)G\2630\217\2045A\253\264\270f\205\244Z\225\034\003g\027\226&\267,\323\344\346\333S\033I\017*'Q\3140\214\276\311?\220?b\214\017|\367\312\377"
+	.string	"\274\322\244\230b:Dp\306\376B0~\330\2476\222\354{?\244\006L,\f\245\335\215\031\231=U($\266\277\261\r\241\255\260\300\335\003\021\374\245\305[\331\375\020\234\020\360\312\234\355\362/d_\362\3208\201\331]\031A\316\035r\376K.\320\215B\207\232\206\3355\354F\034w\274\355\003\333\016\266E\002\t"
+	.ascii	"i\3317c\372\365\206i0\255\2700\206\007\233Kj2\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.41.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\331\0015\017"
+	.string	"F[eG\360\260(\035\370qG\303x\254%\353\377@\0336>\005|WE\3359\276\256U@\037F\350B\237\227\262\001u\310\024'\252\017p\372E+\301&[\034&?\226d\374\024z\362p\301Z\27438\372\321\217\366\336{\247\024P"
+	.string	"L"
+	.string	"T"
+	.string	"5{\035V\206\234\333\356rR\304Q\257t\312\210\362\357:\350\003S\257\237\230\3239\202#\306#\004\3040E06_\b\274\020'\b\030s9Gfd\035B@\325\024\331B\330\270\353Q\003\370\022\343\007\203\335u\374\300\r\367\307mw\266K\354\250 ?\325)\t\310\270`5T\261\307~\245\242\\\331\227a\030\206\2264\366q\376\031\243\017 "
+	.ascii	"\t\333\002\236]\230\260\307\326h\214\021!\333\217\366O\034\005"
+	.ascii	"\3528'\203vA\310`\354\276\0208\301\347\324\300E\365t^\244\236"
+	.ascii	"\032e\337\370+;2Z\017\036\003\345\240\335N\376\342\206\326B\271"
+	.ascii	"\013\016\263[\312[\314Z\327\271]:\213\320\215\354\346U\233\302"
+	.ascii	"Wx\237\335-\361s,\254\f\250a\265\324S\216\206\216\2538\254\305"
+	.ascii	"g\271\002K\374w\352\263\324\323K\n\223\231\360\340\022\303\333"
+	.ascii	"|35)W\026\005&\rP\274\221JuGb\"EX1!A\350<N\302\311(\205\353L"
+	.ascii	"\036Gr\300\245\t$\023\247R*\231\270\320k?W\3228(Qs\221/sw\267"
+	.ascii	"\n\210S\332\243.\376\363\224)\363\244\240\315\240re\221\237\352"
+	.ascii	"\224\005dB\330L\025{bl\207\355\303$}'# \320\202\021\341\240\003"
+	.ascii	"\251\33071}\265a\255\025\244\020\270\312\245\226\267\\\nR<\002"
+	.ascii	"8\214\376\260\215)\001\017\177\260\215\177\334F\212\021\027O"
+	.ascii	")\321\2643\272\275\3412(\311\033x<m\b\036\265\260\210k4\340H"
+	.ascii	"\323\244/\212\032-\334\003"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.42.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375` \001\265\r"
+	.string	"\006\031]E"
+	.string	"\261&\035x\fg\360\017\332\264\230k\2166|\254\277n_S@\006oP\337\375x\324CB\303\205W\214\255\204\246\013B\342\352\224\213[\275K\357Z\177o`\026\016\300\372*\232\330\3153\f\335\364\336[\312\224\002H"
+	.string	"E"
+	.string	"J"
+	.string	"\273\231z8\352\021>M\224\177\234\2036.\365\370q9| 2vfxp\026\236\250\245f\013q\025\362up.\327\007\362\222B\203\007\247z\242W\314\213\343<1p,\231\034\nv\327\271q\031n\216\333\036\331\026\261\177\n\272\262\257]\327uV\031\3737\277f\372\037"
+	.string	"\260W\002\032\273-\335\215u\301\0236!\333O\373 \036\002\365\033\025\203v;\2700\261\313:`\004\237C\002\027\305\303\367\217xh\224\r\343\254\231\275\016\317\205\234\032\033+\235\333\245\227"
+	.string	"\241\210}\320\242-\341$\264\317\356\212\3709\024P\002\314\320\234\342\241\001\026\260\217x\353\344\323xBJ~;\364S\342\341\025\266`66\254d\367\232\355\305\245\272\262\350*QU"
+	.string	"LL\253\205*{lV*\003$\013J\264\221\223\350Q\210\211\364"
+	.string	"\205\204\324`\244e\020\034\214\230d#\223\226\205\024p)\002\311\224\235\224J\246,\304\332\277U\0313\210\271V\224\345\355\356\306P\252\332%&\371\315OS\216!B\305\n\3701"
+	.string	"\306\246\305\243\312\236\334\211\2758<\r\031"
+	.ascii	"i\3317c\332\363lde\005Z!\004\251\340BH1\262\306\007&<i\002\223"
+	.ascii	"\024%\232:\243\315\336\240\226AQ\362\206:\036gC\300\250KX\304"
+	.ascii	"j4pG\232j\322W(j\264j\017"
+	.text
+	.section	.gnu.lto_schedulerSignalTask.43.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\325\b"
+	.string	"6\021?:0%'\035\220\301\013xb\242<\202\221RSHu\037T\203\315&\301\355\316\215\030\263\026\025\025\210\005\246\372\367\031\353%\002\235\003).\274\206ACAN\257\261V\311&[\246\024+"
+	.string	"."
+	.string	"-"
+	.string	"\330\t\262G{6\200\177&\373\227\351\301\n\260\273\022\226\334\273z\376W\336\231)\3235\240aw\2553\005r\303\333F\260\315`\273&k\250\262\277\372U\325\217\003!4\0163\273\037/\327\266\242\f\212\307\366\325~\312U\274\2576\334\331\035\201\211\331\375\024\274\300y\324^\220=\0067\273\247O\237\345-\030\332O\036\315u\372\371\350w\031\032\372i\215\003\232\254\360O\310\016\005\\l:\\(}\331\237I!\211}lw\003\242\207\t\016T\312\034\372l#\212N4\212\bq\322B\002T!C\033'?\007&]\2146Y\"\2216\351\371\366\330B\225!DZ'\2102G\017\377\235\325\031\004\n"
+	.ascii	"i\331'c\372\374\f\033\267r\302\264\034\200\352b\027\261\032\r"
+	.ascii	"\356\362\242\235d"
+	.text
+	.section	.gnu.lto_schedulerCheckTask.45.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\034\007\245*"
+	.string	"\212M\314\020GpZN:\325\001yP9\220<\255G\316\r3[\306h;\350\207r\005i\223s\033\241\027qE{\346[9S\270\356\313\234\033w\370\001\345\366,tD\320\277\2065\255\364\017\205 T}\1776\244\021i\204\020\271\223\f\371"
+	.string	"\340"
+	.string	"\373"
+	.string	"W\343\2771\273E\031e)\357Q\306Z\212\324\313\333f\\\215\327,\266\261\031\314]N\204\345}\313\327\230W\036^\215\201\310:0\262!\363\372\323d\256\342\243=\215W-\004\322\226dc\"~Fet\245\274\\\024\266x!S\372\311\035R\023K\215\261\013\255\274\225\252_!\232>7\353H\216\007\351O#\323Z\346\223\275\254\352\311\033\377\2717\314\316\313\275\312%fJ\177\262\362\002\320\237\351\201\320\237\314\314\r\036T\261\325\225I\270\3264!ZY\342\334\253\0046\222[\335\247\246=\3644\333Z\361\257\356\263A\256\0320\302\343\353\351\315t}\035J\227\227\355\371\216@\216\232I\31368=G-S"
+	.string	"W\223\255\365h\264\247\231\004&\347C@\231#j\016\245+\2105\327c\226\355\236#\016\323\350\336\373\264\333\035\307\242\265\275\n\367^\266[G\036\347\365\314\214\204\231{0\243q\001lE4h^J\375#\241\f\372\306\274\244V\352\317\321\242\203e\3530\327\235\345\320\242N\352\033\345\214:\250\213\272\263\030\247\024m\035\006`\371H(\277-(\264\3372\352\267]\265\353\321\205\267\314\352+fe\361\346m$\363\315\333a\314>\313L\252e\240\317\362O\265\274\244Zf\240ZV\332\261\234\244ZFz\334Y\301\335\316G?;\037\260\226\215\332r\201\035\313E\277\362\023]\313y\350X~\241'\377\240\266\f\304\226\003\250\226\177T\313>\252e"
+	.ascii	"\252\345\036\3252\217jyG\265\274\262e\237jY]-\247l\271\307\226"
+	.ascii	"O\237eS\265\334l\331\252\226\337 \301\034\230\020\261!\215Fy"
+	.ascii	"\271\352\344]2\347\027'\217\373\335\376\263_\313M\3463\037\216"
+	.ascii	"\017\206\3278\342/\217\373\034wv\\\2265\322\276n\037sx^\003,"
+	.ascii	"S\0235\247}@-\003R\004o\211\243\257\030\330Lj\0235\260\277\266"
+	.ascii	"\341KbP\035\234\332AvI,\016g\343\224\366\004d\035X\231\331\033"
+	.ascii	"\262\314\036@\330o\025h\324\255H\261\257\036dm\355\007\332H>"
+	.ascii	"\231\367\232\347\316\354\356wOc\305_\302!F\330o\215@\177\366"
+	.ascii	"\332\201\0339*^D]G\354E\201\303\023r\366\031\253t\347[m\206\332"
+	.ascii	"\366\331\247\033\270\"\0324\037"
+	.string	"\375V6&v6\362\327f\3333fbH|\256\204\211@-,\017\254,\271\324\277\026z\323M\324K\375.7\245\320-\253 9{Rd\0237C\374%\371Z]\367O\314\376\336{\315F\312\375}6fvYV\316\355\275\367\252\033\311\267Bm\2570\273\313\262r\230\031\305\307X\245\367^\b|1\037T\244Kn\240?m\367\033\033^\3625\320\367\320\033\203\026\352\367\323\276`.\354\342'|r\232\002BE==E\005\207\232TX\250(\247)\252\240\320\006\206 \024U\006\030A\241\213\240\020\013a\214\030MP-\234\206*\221E\223P\352\034NA\ti`\360\rG\b\237\234DLA\t\245\244\250\202<0\206MS&\007\177R\302\030T,\204.\202C \224S\323\0230(5\004\376\fp\224\f\241\024p**J\n\270*\261n\336\016\343\236\2160Zl\252\006\273$hl\346\311<@\357`\346"
+	.string	"\315\025\260\272\330H\025\251\231-\330\373\366\023\021\363R\320G\215\324\022\350\214p\212\026N\207\230\212\251S\320\007sSJ\2243x\311\237\316#\366\034\265O\377\264\231\305\bv\341r|\332<\363\225\304\3528\304\236\236\336i"
+	.ascii	"m\322\031\301x\372\250{Z\350\f\207\3564O\027\2551\322)b\370\033"
+	.ascii	"\342N\367\033"
+	.string	"\035^\022\250\327>Z\373o_\231|\025\301[\026\373\212\323Fr\004%'Q\277\020\033\323bC\0134P\357\360\365\2126\001\200\200\250Q0\246\020b\n\215\220\214\210$I\222\016`\002\221\261\272z\021\240-c\250JRP\315\030\257\210\344R\252aES\235\036\255\204\236;\250\021\241\024\t37\n\257\007\312\021ZB\366\325\\\341\265'\323\0275|\231\021\235\261$\360 \211M\323i\324\362 \017\227N\335\004M\223J\241\226\0254x\224\007\313\360\253\343\030\240\003\350\013\317\235h\357\256K\367\335\020T\202\206\337\230}:\315\374X[\213\260\316\327)\272\275#2cMH\032\206<\023\"\311\364l}b\353\334/.}\357\315\240\234\31034\001\263\306\304\367\216\231U\022\035\363\306\006\026aPB\3746(\206\352\002\217\213AQ\013\227\351\274\004\343\261\n\017\331\007\207\216\300\023\370\246\210x7\342>\262\001\253\210"
+	.ascii	"\337Z*\367/\271\352\321\305I\275\353\255N\242\376\334\215\003"
+	.ascii	"\003+\365O'\034\037F\004\013P\002L\226\265\304\237` 4Q\276\033"
+	.ascii	"\266\302\330\2501\324n\315\274\321=\b<\300\264\321\316GM\220"
+	.ascii	"\302N6PQ\001"
+	.text
+	.section	.gnu.lto_schedulerInit.46.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"\245\013"
+	.string	"v\225ND \251*\035Ht\030\033\020\220Q\206\037^\365P\257f\334Yxj\273rB\325w(KTl\201Q\016\003\244z)\242\243d\343\220h\006\222\324\204\023j\200\241\b8H\257`\032\300\f\021\b\202q\243\275S\n6"
+	.string	":"
+	.string	">"
+	.string	"-\327T\355\324\332\335\356\325\026\331\335\353;\217l\013/U\373\0051\224Wmw=\n\340\243\317\221\177\3263\244\211\364\311`\261\273\236\244I\345\246\267-a\333\263\337\t~y\004 \177\345\222\320<\371\352\207\270\327\212\024\355\324\242\215\363f\227\245I_\354cvwMQ\366\234~f\242\345\304\022\200\002\255Pn\312\355\302\312\252\004\001\266\357\033\270K\364\260:"
+	.string	"B\001\315}\006o\340\t\035\206\031\306\275V\227\007\265n^u\3078\315\177\340\n\302\006\325\356\370z\202\017\177\365jO8O\206\234k\3443O\372\256c\020(m\263\023J\362\017\342\002\3766\"\b\002\342"
+	.string	"=\276\217\027\322\341x\274O\374x\233\b\207\"\240\350\221\204\241\350u\345x\314R\224/\"\310FZ\362\303<\26556 \034\246O\301\331\234\217\236\365\214\225\231mfBI\016@\007\026"
+	.ascii	"i\331'c\272\215\032\206\333z\214]\037C;\266\t\362\r:C\013G\220"
+	.ascii	"\366i\303\032\340\0166\bCT\324\224h\333T\330\3402\033\241\002"
+	.ascii	"\277\\\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_schedulerOptimizeRate.47.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"-\n"
+	.string	"&\223F?0\247*\035Ph\357\216\037\357\375\241\270<\216\265\314\315\0260D\"\206\303I\230\312\007Y\375\311\321\032\301\252\245l^\220\310D\t7X\3051\3405E\t\246\263H\244\007\037\320\252}\262\267L)2"
+	.string	"3"
+	.string	"4"
+	.string	"\"{\327\354\204B\333]N\206\034\374\224\n\372\226\315\005%\206\237\037\227\tbi2\354\356M\256)\321\244j\331\354\256\025%z\334\333mO\330\226\260\255 ,\373s\345\312~\353WU\177\273\352E;@\021`\267\243\326`\005l0\022\333\307\330V\265\037 \300\267F\013O0\266"
+	.string	"\354\216\016\326\034|3h\027\370\030\252\327\002\003$Y\362\245?\376\3042\177\304\033\216\351Q\337|\307*\337. $\255\315)Y\3521\274\356n(=\252\250\234\260\222\020\301\200\231I\031\330c\2502\235\210S\321qx>\036\021\310Cp'\363u\030\032\026\335E'\304ex8\037\256\363\205\270L\203=P\367q\"\317\3738\314\270\237+WV\251Qp\0218\245h\304-\253\\\246\266\017"
+	.ascii	"i\331\207\324\364\307\262\302ejK\260\245T\245P\343RB\b\256\211"
+	.ascii	"\023\231@Jj2p\227\200\001\213*\267]E\017"
+	.text
+	.section	.gnu.lto_schedulerExecuteTask.49.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\242\007\345*"
+	.string	"\352M\344\020Dp\\N:\177\021xOw\"\026:\267\217T\"X\325\205\242\317\020\0169ci6|\357\363U\230\377q'\241X\200\237\027\332\362,\021\371\247R\027\be\265d\r\313B\351\033\352\016\241\317a5K\b\221;\245\362"
+	.string	"\345"
+	.ascii	"\007\001O\273i\337>\234\017\306\3008\343S \351u\330q\363\344"
+	.ascii	"]?.\376\333\322\306\222G\023\030?71\267;i\232~\355]l\240q\234"
+	.ascii	"\213\201zkS\3224\005~\213\337\306\346\345\217\353\007\322\227"
+	.ascii	"\233!yi\232\272\300a\003\177\256\275\345\253\031h;\315\370\343"
+	.ascii	"\372\361[\353\002\226\227\246\312\006?=\342W\237\305\350\237"
+	.ascii	"4E\262\227\241V\373\311c\331\272R\353Ei\232D\314[\232*\035\030"
+	.ascii	"\302\357\247\225?\333~\225[\331\262\321T2\tC\335\350\370R\273"
+	.ascii	"\223\246\312 \201\037\241?\315\033\241"
+	.string	"?w\311\215\367\241\247\271\325\350_\355\346\2242k`a\\\367\0059\n\0246\366\323d\220\007Wg(\fi\036\371p\002\366\266\034\325\374\215}M#2/wo{\355\021v4\243\356\316\210\\\355\225G\230W\255>\016i\232\272\202\205\001\271\177\267\255e\333\210\355\333\nPKa\337\345\246\024\273<8\272-f\307\272g{\3701\306 ^\232\246\023|9\0171>\307\244\354\347\027\250\267\206\226|Z\177\356tZ~\231\247\250\352\301\250\320\237o;\002\271-x\212t\325\275zwF\006g\256\222\357\216\2721\266\325B\237V\251\354LK\033\257\232\307V\036\353*\261o\246i\232z\223\330hu\205\263\232\202\253%<\356\216\020\374\362\216B\253\025\234\325\t\316v\037@\253\013<\313\017u\345\377\364\264\333\351W\335\364S\315\364S\275\364S\255\364S\235tV#\235\325Gg\265\200\263\332\350\254\016pV\027\241\325"
+	.ascii	"\316j\242\263z\350\254\026:\253\203\316j\340Y\r\364\253\376\361"
+	.ascii	"U\377\316j\337Y\215\242\325'Zm\236\325{V\337B\022\2204*\226i"
+	.ascii	"\352coO\212\346\214{\362\270\177\371\263=H\263c\234\023m\200"
+	.ascii	"\035`\207\354\003`\213\354\b\001\354\0066\311\256\020\3273\022"
+	.ascii	"\35597fh\3478\t-p\207\026\265\013\332\340\n\355R\035\322\354"
+	.ascii	"x\313\241\300\r\332';d\237\243E<\317\b\\\237\330\\\324\002mp"
+	.ascii	"M7\244\331\021h\021\314\3211\325\250\365\317\372\302\021\257"
+	.ascii	"\345\262M\342p\210\353\023\223CK*U\273\204\211"
+	.string	"z\260\250\375\333\177E\b\0304\307\345r\035$xh'\r\364\267\305\343\235\r\r\024)R\354\312\205A\033\322u\026\250\275\342v,~\364\276L\241\343[5F09\350\356\372\326\204\2034\242`\321\375W\237s\315U\260\013\324\220Q\314-\260\3476\361ARi\3614\302\337\317\334\267\335@]\331\033#W\222\t\266\300.\324&\330\273\271\370\031c\324r\027(\346\206'\t\265uF`\0167\264\"\007V\303\2305d^\205\265\245NF\370C\302k \267v\\\303E\016\205\255\260Jz_}\276\001\226\361`h5\225\025\274\"ZY\021\205KR.*\026\212\252*\251\017\303\"\021\306\320C\323\013\342Tq8\003\275\"Ne\325\020\016o\200\240\302\222\3122\302B1\264\232:\221u5,\026k\b\205\250\260\244N\274\030f\t\207UC\254 \013\037\024\207U5^\fe\b\261\202WSRVAa\021+\370"
+	.ascii	"\312\304\031\303"
+	.string	"b0\213H,\006\201\312\256\233\351&\361\337\016\244DJ\362\f.\016(N\3267\242N\313\303\266\323^\355\3571\026\206\246k\217\276\n\265n\252:\210MGf\310\222\317\373\001e\feZ\244\227K\233\264L^\336\313\335\331\221\324\033\366\366\356x\245i\227\001\245]Z\037\034d\224\244=\260J\253\304\007i\326\241\036\275L\332\263\f\231\204\265?T\256'M\206D\330\340JX\fr\310:\307\017\3373\326\264\b{07\253\350\321\341AZ>\301=Z$\020\327c<\332\223\216,)`\361\030-\321\nXT-\300\026\255\3212\361\t\200\202\250a \250\fD\b\031\032\021\021\231)H3\006\200\"\231\273\232\007\021\220)4ESJJ\224\235\003\372_`\001\3537\036\266T\232\023T\2520'\345\357(\253(\323S\360\353\360\274\031]I\304.\37119Xe\264\2050J>\261\256Y\230\315J\330T\263\355\""
+	.string	"\216f\212UUu\315\366\006\314\n\030\225WU\021v\357~m#ug\203\n\017\322\315\346\301\205sg"
+	.string	"qEh@o\326\310\246nB\353\222F!\210z=\250\367\031\346\356\253\227\036\224Z<\255?\233\340\331"
+	.string	"\357\324[5\001\204!\340>0Z;\335\323Mb\355\004y\307\020\206\352\273.ad\307O\002{\373\354\346\222="
+	.ascii	"\033\263D0\275#\301\235$\277UJj\266\300\2061\3557;b&\274-~\320"
+	.ascii	"\250\311#\303\023\365\200\035\017\3440,\016\262\370\270\351\r"
+	.ascii	"m\253\"R\317\3074\207bE\276\343,\330\321\001\245\367S\030\217"
+	.ascii	"\255rl(\377,\376\f\255%\336\260\025\234[aP\241\002\035&\210;"
+	.ascii	"\036c\214\207\241j"
+	.text
+	.section	.gnu.lto_scheduler.50.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\252\031\205z"
+	.string	"\212\310p,K \320\322\031\016\245\003\365\324\305\253\234\321\304\355\236\232\275\374n\352\00388\3402\030\257\360F\027\241\006=8\177F\b\300\207\344\200\220WT\031\f\206\025\337\347\0032=q\363Ta\333Y\217\3022"
+	.ascii	"\300Gl\033\304\366\273m)\223\f\267\002y\002\267\002\274-\304"
+	.ascii	"\313\314\373\267\301\340\002eR%\260\001\347\326\262D>+_\261M"
+	.ascii	"\226\347\371g\370\351\374{\377\013\177\233\037\357\227\373\347"
+	.ascii	"~\272\277\356G\363\333\375w\027\332}\r\206\013\364E\315\241\341"
+	.ascii	"\036\277\340\201\321\223\307+\213\b\205\353\272\306`\374\333"
+	.ascii	"\343\331\343\f?g\203g\340\f\001\215\205\277\243\374\337\036\320"
+	.ascii	"\005\f\024N\271;x\314C\247\316\0059\370\337\002\375\021\032r"
+	.ascii	"\020\370\267H=B0\353\272\3129\240\325\377\266\371@\255\314\331"
+	.ascii	"\373\321!S\203\245\260\317\310\367\276=\276Pug\204\212\233\275"
+	.ascii	"\037\022\304\300\002\234!\235\321j\027N\353\321\265\3607X\327"
+	.ascii	"\333\037/t`\260v\217l\356f\367\270\036\\o\217e\022\217_\263_"
+	.ascii	"\341y{\304\033\362\265\371\004\032\253\202X(\246\215V\220=C8"
+	.ascii	"C\023\214\036\354\036_<~\314Qx\231\233y\232\253yt\217wZi\310"
+	.ascii	"\352\240\331q\031\277\236F3i\004\013\337<s\025\226G3$]\327\346"
+	.ascii	"\3263\027r\n\273\346\214/R\353\272\236\300\206\32602B-\030\244"
+	.ascii	"p2\313\323u=\201\315\255\317\027{ss\016\030_\034\342\024\003"
+	.ascii	",?G\344\351kn-K\261wf.\206\361\305=\334\343\226\227\363z\n\233"
+	.ascii	"[\315 \330[\003w\342\305\r\300\370\342\323\217\324\027\323\027"
+	.ascii	"\251/\356rw\360sS\326\327\201\301Y\306p]W\252\226\262M\274<\211"
+	.ascii	"\021Q\"B\200\200z\372\340\324\304\264\244\224\204\344\241\303"
+	.ascii	"\221QQ\222h\b)\304a\3031\b\310\370\243\026\323\346\345^\355\217"
+	.ascii	"\f \032\263\257\223\210~\304\335\243\334\236jX\304\030;\016\221"
+	.ascii	"\306\216A\2409\024\232\364I\217\n\374t\260\273\177H\213\224\330"
+	.ascii	"\375]\317\230t\352\357\004\266\367\235a\247\364G\254\f\313\373"
+	.ascii	"\236ri"
+	.string	"\213=\205m\356\347\204\233~b\224p\026w&\270/\301\211a\245\2440o\214\004\346\036\300\244OY\270\303\221\321\025+\\\024\346\311\276g\025\267'\025&J\217H\006\377\336\367\304\222\256\0204c\273\333\323\004\036\352{\302\335\3559\205\221?1\374\236\272\305P\bw\b\345,\356B}\317(\2249\270=\233\244OQ(o8\2243&?.y\320\022\267'\033\003AA9Src\337S\211\333s\215\177\322\250\267=zW\252\023\243\362<'\253\024D\001\307\314\322^,\206\365a\002\2421K{\232\232\200\302A\0232\023K\217^ A\360n\302\270S\023\205l\362<\357P}O&\351Q\031\226\261G\317dfL\346\237\030\353\272.\217\231\235}\245\276\313}\273\357\260\333\241\204db8\301\273\313*\313+\374\261\264\215\336\250\361I\261\216\336\321\273\313-\313\023\370c\373\274\007]a3\302a\241X\177\005\221"
+	.string	"G\313O\267\355\2678\271\273\233+Pd\2173\232>\254\337l2/5\b\321\034(Of\230\263\367\243\203T\320:\372G\037\316\231\215\206\346\005mA#\321\240\243+\350\013\372o\236v\361+LtS\247\205\331\354\356\n\272\3134\241\334\335\205\237^\306u]Y,\227\201\260f\371\305heH\2100Y\370@\343\32476\242u\261.\322!\276\311\r]\211c\241\310d^\206\\\337\021\326\\\206\214\r\f\254w\364\231\375&\027&'\356\277\372`}'\"\207\300E6o)f\361\370c\213\367\325E\264>oF/a\364\244\335\266\313/\307\250\024\264\006d\002\357f\227q,\266\034c\\\3270\026\313a \254\221\261\2672C}\221\202n\"\205\0164N\256\211\371R\352\356\215\034\374\261\035\375\274\037\252\326\207/\fi\216a\264\273m\211\250o\r\310\304\020\306{v\217\370D\"{+\273"
+	.string	"\003\3741\006\324\027\337IY\n\241qk`\234\270H\274\373@\004\3741\035\315v\342\264\034\0262\373kw\216\311\335\226\206\354\020\311v\224]'\320&L\226\260)YSK{\022\264#93{\226\0351\"\002\331\330\021\357\213\204\220\362\336\331\024C\362>\314\210\367\314\"\336\203\t\361\376\353\253\327\020!B\274Z\237\341\233%\304\033\344\n\b\222\367G\325_\370\372\270\335W\211\344\275@\210\327\202\267\371V0\304K\301\361\276;~\367\325\361<\337\034\247\363\305q\303F\215\357}i\\\356;\343s\337\004d\234\356\033\343t_\004^\367\205\361\272\357\001G\363}q4_\003n\367u\201\344-"
+	.string	"\311\333\202\210\227"
+	.string	"\346e\301\274\0030\357\n$\257\n$o\n$\257"
+	.string	"H\336"
+	.string	"\230\227\n\311\213\002\311\013"
+	.string	"\222w\n\311{\002\311k\"\311[\"\311+\225\344%\221\344\0351\304\033\225\344\025\221\344\r!\304\013\002\311\013\225\344}B\362~@\362:\t\3616!y\231\222\274KI^\245!\336$\346EJ\362zH\362vH\362\036%y\215\222\274EH\336$\222\227H\210w\b\311\213D\362\n%y9\020\361n\030\342=2o\020\363\0021\2571\345\375a^5\345-2o\212\fl\203\204RoH\264\324\210\026\321$\242zD\253qX\210jdZ\236\267$\021z]\"Z\245\241\005\244\020xNZ\035\342\310\316\324A\264V\277\231'\253A\364T\034'b\233\256\333\311\352\343y\372\226\206\347P\211\r\017\241\207\037*\224Y\373h\250\022u\204d"
+	.ascii	"\315\2541\237\315q\277YY\377\311p\377\221~\231\221#,\346{A#}"
+	.ascii	"\301\247\276c\372\230\f\037\372\251\213N\315\324\037z\211\206"
+	.ascii	"\246v\262\363j\352\377\231 \007\206\326.\232\211\312\013!\023"
+	.ascii	"\260NK \032\255A\031{\264~\340\331\212\224Bh\334\212.\201q:t"
+	.ascii	"\233\2263]i\202`\360\034y\365\335\004\227\352D\250q\224z\251"
+	.ascii	"\325>MhR+\365\351\222\032\251\367w(\007\306\211)t\245\375\201"
+	.ascii	"\301\343\242\347\270D\300P\347w\270\006&\305\207\205=#\244\276"
+	.ascii	"\f.\330G\273h\034F\226e\3741\244vr!\t_\263\277\366\"\264\215"
+	.ascii	"\036r\242\216\016\031@3h\227R/B\277\311\207\254\337\307\211\b"
+	.ascii	"\303\027\216\372\"\375\261~\023\0163\204\306\321/\342\205\271"
+	.ascii	"\227R\367\2037r\204\320\037<P \222\347aaX\177-\233\303-rE2\372"
+	.ascii	"k\237\255\216\036\017\375\326gL\006\260.\357\320\036\216\332"
+	.ascii	"\250;\364\233n\307>\352\353\325!42\343/]N0\024\355\214\311\360"
+	.ascii	".\265\250\215\372Mh\262\213ZU\343D$jd'{\311N3\314P\023q\361\032"
+	.ascii	"\352\373\005\312\t\265\213F6R\034$\354\306%\324*\322\344\274"
+	.ascii	"\225\240\205\215\221d\227\312\241\337\227\204\263tq\350\037\275"
+	.ascii	"87\244\002fG\324m{\f\324\r}75\266\202\301\206\376I\203s(\307"
+	.ascii	"V\366\004\251\f5\177\\*\203\307\276\337\371J\0278h\234\\\233"
+	.ascii	"q#f\206\234\342)CZ,\227\300R\226Jv\271d\331\244\211\263\177\236"
+	.ascii	" \036\2669\361(\233\267N\026\357w\316T\312\n\241px\2360\224\345"
+	.ascii	"\223'\022\226m\374\261e\233\372\242\217~\337I4\363\336\326R\340"
+	.ascii	"\304\026S\366\f\n\005\365\214\004\032\250\203\272\250\306\211"
+	.ascii	"\026t/uF\003Q\351E\231\200f\340\230\234\370\250"
+	.ascii	"2|T\340\320m\313G\013\200\354\2609\242Z\320\217\036\250m\f\026"
+	.ascii	">\361\031l\316\350\361'\242\262\312\353\037\275\215*\207\316"
+	.ascii	"(\363\372\004\232\354yo\340\212\022g\364\250lVu\364O\032Ag\224"
+	.ascii	"u\264\213&3r\023c+\341b\b\215\333\240l\2477'\034\177\322\237"
+	.ascii	"\236bs\022\244JQ\333\350M\023>&P\361\251\211\273\330SlJ\332m"
+	.ascii	"\215\314\330m\273>\355C\t\333\001\n\245U\325\026\325\025\226"
+	.ascii	"\225\025V\217\244\r\224YU\\\036(!H\362\310\200\323\255 \255\255"
+	.ascii	"+\245\220\032V\\ZWX=\222F\345\026W\017\345\0075\210\262xlE`\244"
+	.ascii	"\245CiU"
+	.string	"%\301\326\2252+\213\253\007\207\r][UYXUY\016\364\250\262\342q\325Ec\003\345V\017%\020\245\326\222\026\007WU[U<\206l\270\342\001\201\322\252j\013\b\017e\026RKG\027\017 J\032?\264xH\200\225\325\305\001r{\240\310R\002\341\332@\331A\017-\252\253*\036VT=\262\264\250P@-V\020e\026\325\026\026V\026\325q\016\354\035e7\372\032\207k\016\013\301\232\231\204\204\236OP6\305\031\215\272\352M?\034I\337H\200\013\350\317\341\304e\333\207)\353\n\366\261\345'\214\270|\362\264 \364\001!Q\305\b-\272\200V\363\234l>\372F\267H\267\350\201\303\034\341\344\352\204\023\217\th\006\r\352\244I\037\312\244\337d\311\231\034.\351\037\246g\360\330Eu\033_9\001\201{0 \240\201\244D\337\344\244\330E?\311\024T\f\237X\177)-\351\323\023\301b\200f\201\006\244g\364"
+	.string	"\255j9\004t*uY\333Bl\271\203\bU\325\367\273s\367\344\224cE\037J\236\025]T\273{[\003c\353\034\r\244\204S\r\031\300:(\233\212\276\222~\r*:J\316\027>f\177\201H\321U\235\3729\021\301\270T\001:E+\345\025\277yj"
+	.string	"-@'\331i\"2\277\370\016\227\027^"
+	.string	"\315A\212\231C\271\"\027\314\270@Q\365\241\020\022Y&\003T}=\217R3\363\266F\302\013\024\030\236\272\355*\370\232Q>4\331\350#i\262m\222\321?kz\321O\362$\315\004\227\005\205\0351"
+	.ascii	"z\252Q\324\371!\266,\002"
+	.string	"@\003\255\235\365T\0131\214:\021;\360\207j\242O\370\361\337\217u.\213\024Q_4QB\215\356m\r\254\320\251\333v\351L\303\3645 \032\362\006\205\356l\0345\024PSe\315m\304(\216i\3128 \r\241\226\303`2\340F\225AgT\210\217\374E\223\0359\216\016d\252\2400\303\234\247\353\272\256MK4z\225h\364\"mt\215&\333%\004z\225\020\220\3211\216m{X\226J\364*\301\200\321\0074\331\375\016\201\232\032\234\321%\034\275J/zS\344\2136\340\200\273^kxN\337Z\003\265\001Sk\276\316\233\272\232\234\264>\340Y\f\032\027F\302\324miY\362$Y\352({\277'\217\206\364&m\364&\331\260q\247\005\250\321\220\246\321d\233\036\311\350\273\371K~\r\352\022GN\222\220\336\024IF\263_\013\203F^\215@\223\301\350\022r\340t\225\350\2374>U\224\204\364\003\202\035\250\262"
+	.string	"5\016\302\244s\212FDd$I\322\032b\n\020\210Dy\"\330\362\022\300\0269e\251CC\322\202B\241\275\003\362o\n\3756"
+	.ascii	"\004\226R\355\340\200w\305\360\304\023#s4\033\234\007\2058\204"
+	.ascii	"\034(w{8\025\224\275\202[\230\252\253j\b\272f"
+	.string	"',\016\262\235\226%\241\316\257\003`f{\240\255\232_\305\032'\327\223D\2131V\241\264j\"yS!\374\343R\017\210\246\357\037\376?(M\244u6\033\245I\277~\"-BN\310\322^<\357Yv]I\027k\0046If\272K@\322\rT/\237\233\313\b\253ms$\nl\322$\231\311i\235h^bN\213\220>\324\215y\263qj\216\337\213l\342\264\013 \336aW\333\250phcp\021\023\001\261\364'\242v\266\226\277\036\225 \250E\354\374Q\255\352U\246\357H\241\310%\316\006Z\r\223\305\b\217/f\353\031\300\245\300N\234\306wtl\027\024\212n\351\337+G\242D~\357DyL\n~+\354\315d%\262F3\256\007\204\261\231\247J=/g\333\025n\323\356\b\360\221#\2573\262\365\207\240s,i%gZX\"\234\020p\031\005D\256\027\306\207\035\332\027l\364\006\2404\356\006\310H\003"
+	.string	"\261\034\332\301g!\364!NE\224\334\r\253\250\214\356\230_\017"
+	.string	"\024\350H\323\307\300\243v\030j1\276_\332{\026B\001\024\256\205|\353\247\027o\330\263\260P\232\311\227\223\217\351&i\360\226\313\3601\006\245y\222\337\220\021\262\322y\306~\023\242\251\265'\3427\027\244;\270 \217\356\036H\203\n\337"
+	.string	"w\241\t\021U\346\034\354\327$p\2157>\004\3021\207\216C\354\323\031\"\362\223\372y\215CHt\204r`g\361N\232\3679\007\322n\212b\305vD]ZC:J\306B'`\224\363\222^\266\236\313V\013P\332\354H\244\017\325@\220z>bt\364\336\207\354\261B<\267\326>\336\230\273i\"\022\204\024>.\032\231N\030\004\b\306\354\261\030\316\351j\003\315P\376\323w\0132\250\2768\020{'p\002\252\371\322\205"
+	.string	"$r\356_\004\252I!\031Y\372\360\016\362\234H-\254"
+	.ascii	"\356\005O\301;\026.W\221\317c\216\237\275\005z.\003\3115\230"
+	.ascii	"\303\271\241\225I\004\301\\\350]\025' \242n@,]kv:\363\263k\007"
+	.ascii	"\236\327\356\275F\337rt\305\310\254\b?x\350#I\032L\265OYt\316"
+	.ascii	"Afc1EO\306\207k\251x\202k\276\2323\030wHv\303\3544E\031\232\252"
+	.ascii	"\203(I\316\030\2037@\210\260\031\216\274\036\331&m\360\221.\216"
+	.ascii	"!0\262\021\223P]\250AW\311\367\033\225\3751\202d\3372\205~>\002"
+	.ascii	"T]\030f\372\307\\\005\351\222i6\332\362T\324\253\312]8\r\370"
+	.ascii	"`\005\257\225yT\325v\305\3420\251\007\036\254c\317\237b=\016"
+	.ascii	"\024\034\271q\330\343}5\231\210#\324fm\037P\277\351\017\346\362"
+	.ascii	"\366\002{\3279j\306\206=\330\026\rl\210\002\203{\313\352\242"
+	.ascii	"Z{\016\204\205\004-\017\322\t\305[\251\310\2367\345_\235'\223"
+	.ascii	"\005\227\274\341\036\240\200i\323l\305\346O\3024\214\316,\277"
+	.ascii	"\327\00604\224\213\254D\243v\3074PZ\221X<\254\213T\024\251\233"
+	.ascii	"\214\263\344\007\rUU\266\0038\231\264\237\332\177f(\322E\320"
+	.ascii	"\302@{KY\255\303OM\f}\242\030\231e@\017\354\224\225\312\357\200"
+	.ascii	"\223J\246\020\365D:$\324\210\360-\371$3G\202Y1*>\375\321g\n\265"
+	.ascii	"K\201\f\204`\013\375\306h\363\276O\232\221\002\340\234z\273\017"
+	.ascii	"\255\313\021\330\252\006-\306{\026\377i;\377\007\3704+\033\013"
+	.ascii	"8F\302Q:\345j\255\302\t\226=j\354\206\311\226F50\217?\325\016"
+	.ascii	"\230\272\033^1\262\202\313N\2613D\350\035\324\331B\2637\300&"
+	.ascii	"T\266\030\306\2622\036`-\274(\346\320\266_\031mh\275s\206W@m"
+	.ascii	"\032\005<\227\365\335\300\312$\b\307u\257\247\r"
+	.text
+	.section	.gnu.lto_schedulerEnableGyro.51.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375 \361m\006"
+	.string	"\302K,3PM\324\001`\235&\245M\223\006WQ\271\236\250\352\356\265DAF(\212\304\260\266\016\266${\341Y\200\252\212\310\230zT\3743s\220\337\237\354\277wJ\001~\234\n\031,\f@\004\217D\021\n\004\016\350S%\352X\034%@\225*DQ\245M\267\227\333\0045\222\220K6\370\237\030_\343\334\344[\230\201\212\307>}\212\371\004\340>$2F\256\030\332\235\025\345\204\375\311\312\315\226\007\265O\204\342\330}\bK\326cv\\\330~\343\312\006yW\261\367<\207\215ow\251\244x\365X\371\307x\005\313\254GJ\300\356:b\031\304-o\373b\233\332\216\b\t"
+	.string	"i\3317c\261\2003\202\305\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_getAverageSystemLoadPercent.52.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375 \372\255\006"
+	.string	"\242L.2`O\322\001\334"
+	.string	"\006.\305(8|fi\340\222\256gI\244\037V0Z\263\311\036\177\\"
+	.string	"\261X\t\001\202\340\021\205V\036\032\\\273\3403\366&R\246\024\236\244G9L,P\fS\306A4(<\270\351e\234t\340*\202zN\242\252\236\213\342^=\251\006\034\255\260o\362\b\375\017Sh\362\327\231\257ig\251\001\032\234\374\330q\223\312a\037Z\365\330N\247\026\224\260X-\273\027\037\230]a) \266-;\362E>b\031f\364\300h(*\026'/\273\321\t\234\240\235\345\007\332\231v\034>\241\177\222C!1.Wg\363\004H\330]\347\325\311\270\365\266\021l;\333\033\001\t"
+	.ascii	"i\331'\323\342\2543b\206P\\\023o#p\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_rescheduleTask.part.0.66.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\335\002\305\022"
+	.string	"v\340qH\320TQ:$t\207\376\023;-\215\013\363$\211w\216\302g\207\300U\031M\240[\313u\t\016\365\321\t\b\026\b\276\212\177\330\266\320"
+	.string	"\350R\237b\226p\r\225y\247\267\210J\t\341Q\237\241\272x@.\t$\233\310\235RW"
+	.string	"a"
+	.string	"W"
+	.string	"\336\270\264\231\245\264\177\3434\260\327\270\230\264\353\202\006\267;*\370\364\002\360\263\364\002\337\247w\002\337\247}\033\266_3\303\354#\037e\354m:\0216%\273+~j\214\303\256\322\203\371\267\235$\243\275\\\003\320N\\\232\334\003"
+	.string	"aw\r\242\270\347m3\260m\301\326\013\001a\317\213\307?J\261\001\033{A\002W\001\304\355\270\\\212\355\270\2763\373\021HB\030\355vW\302o\307\341\357\310y\035\247%\r\214;3\273\331\241\315\317\361s\\\007\3548\255\257\314\214$\253\025\355vG\004\237\2160\202\322\267\275\3540\264\312\337\330\270\2546.\"\270\335u"
+	.ascii	"~Z\312\217\257\327\270\004\362\310\240\274\332\036X\3622\251"
+	.ascii	"\007\372W\224\370!\212\351\213\324\232\325\273\267\273k\205a"
+	.ascii	"Oi\3577\277>w\313\217\377A\223\007B\273&\216\226l\213\311S\343"
+	.ascii	":\177\317\217\373s\277\356\017\372g\337\3779\020_\350C"
+	.string	"\272 #;\037\240\\\221\235\217C\235\363\360{\334\207\003&\024\251\001Ez\254\f(U\312*\205\241\225b\tQ\023TX\246\226\317\247\223U\212\303\007Tj\303\211%\262\244\230V\304\323\212%\236\034\260\252Cj%\266\250T+Q\336\007o:\"\030\215\261\252\326l{j\253\\\210K@\321\3566\360\203\200X\361g\264\276O\026F)`\344\221\023\\\325\323\017\235\202\n\032Cd\222\304\004B\250\321L( &\020!RT\324\264\330\220\002\0312j\007\022 \347\261t\252\362--\254\377\016mAG\325\231\241)P\202\222\232\354U\237&M\334\241\341Pcl\212\356\024o\037P\301>\273a !\352^!\376\016\245\340C\342\tX@'+\374\375\303\0253\275\216\304A@\332\001\0036m\206GG5#B\360\274\201Z\030\261\240\312\202\306\016\244\033`\007\277\357\366umn\224\2343\b9{\266m[\330\256"
+	.ascii	"(\305\2625\310\303\0324"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.67.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\221\0025\025"
+	.string	"\346'\214J\260\322U:j\3621\"\251\327\306\220\267\034\230%0\361\370\0311\bn\260\2154s\021\016>M\326\253w\211hv\306\206\365\f\360^c\266\227w>\353\017\372\017\351\326\200\315R\003\337\261\275.\202\304~\004\373pm#\233\310\235R|"
+	.string	"q"
+	.string	"p"
+	.string	"\276\t\3339\237u\366\215\227\036\352\207O5\303\247Z\353\353t;\\w\326JE\322qgK\347\177x\223\022L\274\037\314Y%+U\320G\016\237\233\fW\215\005h4\2210\321\320Ct\375j&9\212\364B\360>\303\2473\036pZ\342A3\351\344\375p>\266~8\337\221\004F\261\006\344\267\033\r"
+	.ascii	"9@=\351\323\346'3\347\200\267T\017j\255~\314\316\355\272m\240"
+	.ascii	"m\b\366\334\020'\376\366}\025O\341'\331E\314\035\t7G\312z\343"
+	.ascii	"\363\215~\244;\022\356\225\306\307\342\005\245\234j-\021\234"
+	.ascii	"\332A\271\032\336\037\346l\227\313\343|\221QRr'ryY{\343\264Q"
+	.ascii	"Rt'r\031\371\016\245\023/\030\254N=\347\313\334\207^\306\262"
+	.ascii	"\376|\236\323>\212\013u\037z1\253V\037\241R\255e\202S+X\235\222"
+	.ascii	"\\\204<\035\037B\236:\273\353$C\270s\351\332\330\205\034\227"
+	.ascii	"@\216\016\272A+}\t\347\377xe6\317;\365g\344\351n\203\017:1s\312"
+	.ascii	"\3739\323T\205F\326\374\3324\f\363\274\271\207\342\331-\214\367"
+	.ascii	"\217\352\2312\332\rZ\344/\3447*\007G\221\215\335\214\232\033"
+	.ascii	"\364\266>\326\005\332\3444I\247\351\213\376\221N/\235\236/\377"
+	.ascii	"\003\b1\211Qko\252G\345\241,D\0043\033\3546\252\310X&\300Zd*"
+	.ascii	"\225\b3\033\354F:vR\223\261\340Td\025b\266W\313\n\314\302+V\263"
+	.ascii	"\275NJL\273 \253\275n4Z\355\345\262=?\326\005\016\277Z\201S\214"
+	.ascii	"Y\031\226\004\327\217\342na\214\216j \255\004L\2726,6\3173\b"
+	.ascii	"Q\252\030\004\264\023\244\332\240m$\271\007\262ewa[\325Z\027"
+	.ascii	"\370-n\024\374\037\034yJ\256\212\350\207\220\220i\2467\202\334"
+	.ascii	"\240\003\200\030\0031 P\002!\311\316\016\350\334\302*\333\276"
+	.ascii	"\016I+\221\354\016_\271in+\210\343Upil\302\2470\351H\374\266"
+	.ascii	"{\356\021\017\033o\342\271\307\266\262,\313M\264\f\363\f\327"
+	.ascii	"k\306\376C\360\027_\r\020\306\340\020\322\275\310\304\246\027"
+	.ascii	"1n\001\177-6xe\362\344}f_`:\257Z\326 \357{\375`X\030\302\321"
+	.ascii	"\251\306\326\336x\\Oy\300\033\254\235y"
+	.text
+	.section	.gnu.lto_getTaskDeltaTimeUs.part.0.68.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\275\n"
+	.string	"\026\025I>0\211*\035\344`\260\321P\213a\321/\340\350D\035\373b\355\300\233\255\001\321\315g\375%\375\217\321.\355@d\302s\223\356\376gD\020Z\362\352\007\261\371\004\233\342b\331\302\b\"{K\231R8"
+	.string	"8"
+	.string	"4"
+	.string	"\036\374\f\234\"\254"
+	.string	"!\260\n\273\273=>\274!{\204\247d\217\312\272wM\350\371i:\221\256\177\035^H\360\300t\"\360\234\034F0\273k\255\300\035o{\302\366\305>E\337\377\b%\242\265+ faQQ\002\002\373/\221-\261G\266\304\232\377\356\n\301o\277\2125\357\n\231a75\001\302\356Wy\264\204\366h\177\201h\200m_\301[#\007\266;o\340i\273{\361a\036\036\377\300\243\337\221=\252:P`P\312\230\265\274\332\033]\336\224\032\001\005\242\244\324\225\025\036\356\356ZUvL\303\230V\230\316\007\233\212N\227\001e\326X8\016\006\307\206c\241\351\266\214\213\214g\323p\335f\201\360G\203\303m\240\317\207\333$\266\363pU\345\277>IU\250"
+	.string	"\324\230\222~XUW\266\241\203\325T\023"
+	.ascii	"hm\371\264\354\343X\336'\016\224\277\240\001Q0L\256\320\313\020"
+	.ascii	"j\253\240\261\232rU\320Y\225\0034\271\211WxZ\210\324\024\232"
+	.ascii	"\227^[\306"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.part.0.69.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\357\001\235\r"
+	.string	"\326XVA \257$\035 A)"
+	.string	"\304\0241\017q\330\360\366\3440\035,\270\370\327zh_\314\234\257}\204\354\321\347\211-z0\030l\210$\006"
+	.string	"\030\005\nR\247\241\256\006\236?\251Z\267h\265\221\266\367\2262\245@"
+	.string	"?"
+	.string	"E"
+	.string	"\317\b\244\277\002\027"
+	.string	"\377\3343\340\237\375\021\266G(\306\354\027\327X\3661-\026`b\354n\374S\020\307\256\3510\377/\347\234d%W"
+	.string	"Y\3123\300\335&\301\356Z\302p\277\333\336\260\375\261s$\326\264\244\351\215\246\241\246\237\246\235\246U\323y\355\377\200\214\017\315\356\205\032\232\365\360R\204\260}\373/#\273\323q\346\265\321]H\234\266\031\2123\355\223x\t\354.$\346\354~h!\263\253i<O\247MC\307Q@p:m\031\036s\333\343'F\242\352\264\245\370\026\264?n\302\"\300\262\273\037\037f\302\003\277\345\317\227"
+	.string	"\3776\\\3000\311\032\303\274\332\"\021\362'\251\323\226\315T\320\222\324\025\253\273[Uq\034\n<B \0214\345\271*\007\"\034U\003*\024A:@\037\221\272B\321c\300VHuE\221e]\261s\267\252\342\005\"fL\224\202Uu\305\006\235\005\310\001I\247\255\003\365\025!\032\033\2356\016\325U\\\021\352\264m`p\031\221'+ \020\203\231\332\344i\355C 6"
+	.ascii	"\211a\240=\240\207>\306>\0033\037\350@\201]S\203\003\036\214"
+	.ascii	"\231\017t\240\300\256\251\301\001_\004\032\027\334\233\345\203"
+	.ascii	"\350\251\367\0270Q\036f\037\356\333\024\373\354\023GM'\373\314"
+	.ascii	"r\201\321yyYpy1wZM?\301\217\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.part.0.70.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\005\013"
+	.string	"\326\324I?0\305*\035\200\213\272\374u{\374@\341\371\256\320\276\261~\200o\201X\344\372\315@mp\2766\2040\252^\271\031&\006\252\356\376/\225\234\232\304@<\301tP\235 \246\301w\024\311&r\247\0245"
+	.string	"8"
+	.string	"6"
+	.string	"\237\366Ul\253\\\026\355\002\037e{\233\200\220\032\202\335\375>\365\344\342Uv\242\177\3325\255\327\352j\360\032\271<xW\020\261\273\316\220\334\363\266\037l\177\354S\004\020\001vEr\t\266d\302\244\330\276}\232\312\336l>mK\371Q\365Y\252\033\367\345\262\224\366W\316\"~\226\262f\327\204\300\313\356\330\360i\207\314\247\302\021\274\317\356\035/o\001\023d\273\373\361k\036\032>\312\247\337\341}z\006\030`\311\234=y\265Q\033\362-\251\234[\f\016DWRc\326\356\335\356\256\025f\253\264\252\264\374\370_\323\t\"\t\222\tt\362\034\362\204\243\013\224hT\0212}\030\026\240\322\027\nM\237g\301`\306(\374N \030~\233w\2530O\034\300\261\364\303\252\032\263\335&\335\205\203A\225s\003\340\203\236]\n\026"
+	.ascii	"i\355[\233\215\261e\030\267\347b3h&\030\330\227\325\300\300|"
+	.ascii	"\373\225\330\200<0B\\\001\317p(g\237\331\271\300\246\363\316"
+	.ascii	"e\201\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\214\005e\026"
+	.string	"\266!\200J\320\3626\007\350\232\211\005S-\333\330\350i\021#\317\274\341 \004x\365\244z\233\266\333\233\275\220"
+	.string	"\\\205l\320\026\271\232\301\346\326\frmw\367L\304z\320A\002\215\004\252\021\n\0315\347\257\225\231\356\356M\307\375i\223$S\ni"
+	.string	"o"
+	.string	"m"
+	.ascii	"\276\333\355v;\317\242\363c\345\0139/\234\223\357\006\300g\363"
+	.ascii	"+5oi\276V\007\230|3\317L2\257\302QEB4\305|J\315\311\341(\001"
+	.ascii	"\363\264\372\022s\201}/\224\217\231+\356\252\260\275\200\226"
+	.ascii	"g\027\345s\023\371\234\252\\\034\316dy^\252\316\334\346\035]"
+	.ascii	"\337\305\341\256\022\3633C\t\265w\357\275+\037S\231\031\314\020"
+	.ascii	"?\206la\013\350#\320\347#\020\332:\024\324\215\240\236W\027\253"
+	.ascii	"\332k\254HA\202\275V\032\242\335DOO\033H\366\221\235\302\367"
+	.ascii	"Lx\037\t\377\023\341w |\316\203\307q\360:}\357eNi\360<\315\340"
+	.ascii	"o\026\274\315M\366\311\b\262\322\240\340kj\202\247\251\b\002"
+	.ascii	"|\007~\306\300\313\230\261\331W\340_\b\274\313\317\333|\276\245"
+	.ascii	"\347K\236'\003\236h\362\220sJ\211\254y!\315\033\245\371\215\346"
+	.ascii	"\267\366\\P\276\231\2039O\346}vc`\222z\341\261\312\202y/5\003"
+	.ascii	"i\241\243G}\371L73e(,}\235\350L\314\026*\246\272\220\304\034"
+	.ascii	"A\301\264\250t\371X\272\374\326}\365a\347T\262\034\304u'!\021"
+	.ascii	"%\205,\007\317\256N0x\304(a\311\240<\004\261\225x\2306,*\334"
+	.ascii	"Gh\357\214\270\242z\261"
+	.string	"\336&\314\366\234\204<\225\326\273\350lY\207\334\r\021f\227H\347\024i\335\202\3317(|\344(\255W\310\261\365\024\264\231\206\225\021\213\322z\213\264\336j\2110\326\305\263f]4\333\2178\004\225\326\3034\306zx6\t\b\251\0235\353mvl\007\221\031\245\365\221\264.\263\321M%d4T\363\302\252Zh\250A(\212D\026\310HA\322T\032\003\320\002\251!\342\006\021\220\020d\322\232h$\230\260,\360|\340{\235\332=\035z0\223R\201\202\231y\267\366\326\242f_\347(N\332H\310\\\375\217\203H\003\2031\377\"Hr\250\3352\264\233J\374\352\323\354.\352'+\3651\253\250\202\331\273\\c\265\361\332\016\2064\357h[1\031\244y\275eT\264Z\255\265\356\"8\262\240\265'\020l/L\tV\342l\2724+\204}\003\275{\213\215\027\363\247\375k\321\253\365\342k\375th5Bow\324\241*"
+	.ascii	"\330\013\335P6\343v\334\321\005\3535\223\263\351\275\236J\002"
+	.ascii	"\342\2157\312\007\304\212\023\242G\341\321\277\006!\354g>\335"
+	.ascii	"\301Q\003"
+	.text
+	.section	.gnu.lto_.refs.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"\265\006"
+	.string	"\026\220-*\2009i\f\266\017FQ\024E\311\b\006\342\031\314\300\f\314\305\213\310\017Z\030b\373o\300o\226\024\215\355\177\273WZB\266L)\036"
+	.string	"$"
+	.string	"$"
+	.string	"[pK9\023:\363q\232N_\002\234\316\322\317\207\231\326\232\332\317\034I\313\n\255\246G\004\004\353XRLg\262\r\264\351\331\037\007\032\033\245$ij\0013E\204\254d)d\355\343\314u\026\340XY\001\nq\372\240\326\341\242\231H\017\243\026\231\221D^0\023f\205m\326v\226\320h\027\263 \034\354_1X\213\030\372\304\206=\232a\267\270\230WD:\305\372\004\264K@\352\306\263j<j\306\251\030j\275P\001\013"
+	.ascii	"S\033U\205\033;\315R\332}\021\223rIR\353#\f|\301\212]\3310\226"
+	.ascii	"\245\242"
+	.text
+	.section	.gnu.lto_.decls.2affc0cc9053d21c,"e",@progbits
+	.string	"(\265/\375`\362+U\266"
+	.ascii	"\032\016Q;Y \212A:\351\362Ub\253\336\335A\326\325\346\352#;\342"
+	.ascii	"\277\277ss\366\331\223{\352\222\322\276\224\350.\255\0053%\225"
+	.ascii	"1o\001\303\270#\332\035i\242\222tz\227\200\n\320R\020P+\214\013"
+	.ascii	"\317\252\251\331v\236\025\322\305\016\330\246b\2349\365\316>"
+	.ascii	"\207D\263d\242\311"
+	.string	"\2262\005\373\002\270\003\301\003g\356=\352a\376\300\374\001\205!\310\013RR\364\266\210z+\265\367d.mQh\2249?\031L\002P\264\362\032e2|\306\303T\2656\325\304I\"\304\310\326\r\365g1zi\232\2741\265FY\357x:\367N\300\363\305\346\334k\364c\370L\210\215\205g\243\2675T\237=\225\355\370\013\233\001\361\235=\2061\277Pd\026\034Ry\252\n\267\217\201\322w\027\365]E\035\301?)\313\300^\330\314\002\226;s\341\270\327\0341/\263\215\240){\"E=[\220\332\276>\266 }\177\251>\374\2236sH\371\215\341\330\354l\274\345\366\364\3040\346GZ\243o,U\206\315\331\3227\017\325C\327P\317O\365\\\247\236\263\250#\230\212zN\242\236\245\324\263\222z\246Q\275\220z\007\250L\306el\026\304S\316OX\3547H\314+v/\263G\347H\007\025.\215>\205z\226r"
+	.string	"\034\335\023\177@=\007\245=\034\224^U\237\366\223z\340\237\024m:\341/\006\263I&\252Kv/S\203\215W[\020\262F\031\254\271\t3\317`\314\344\031\234\270\016\322\375\272\227\311`\350\275G\314\037x\230?\324\260\0359z\222\242o\365L\376IU\346\220\312\bc\364\371{\206\026\3027='\n\324\302\222Th\256@C\3603\372\354\256\216\340'\204\023\340\001\b\256\342\267\016\330l\320y\223\037[<\372[\340\317G\335\341\035~+\364\037\261\346\240R\2407\374\235\363w*\344\341o\260\237\303t\215\245\200\214\b0"
+	.ascii	"\346gb\243\327\360\367\334k~\033\201\237\211\332\216\300\324"
+	.ascii	"-\301\317.\232\257\3637\332\317)~~\340\347\005\374\334\301\317"
+	.ascii	"<?\243\370\331\201\237M\374\f\364s\006?\327\374\314\301\317\032"
+	.ascii	"~.\3613\316\317\007\3709\002\326\340\347\235\237\023\3603\207"
+	.ascii	"\237\r\360\363\315\317\f\3709\347g\004\374\034B\001?w8A\326\277"
+	.ascii	"\006\277-\241/\315\177\013\216\363[\0226\277\305 \375\355\005"
+	.ascii	"-\224v~\333\363\363\034\232\237}>\201\377\017$m\370m\316\325"
+	.ascii	"\337\332d9\363\233\277\313\374\314\367\363\336\317d~\316\373"
+	.ascii	"\231\356g\267\237\313~\036\3739\354g\260\237\231\374\354\365"
+	.ascii	"\363\222\237\267~\316\372\371\205\237\217\374\214\201\237\213"
+	.ascii	"?\033\371\271\350\347\246\237_\374L\344\347\037?K\375\314\343"
+	.ascii	"\347\250\237u\374\234\343\347\345\317N?+\375\234\3643\362g\025"
+	.ascii	"~\336\300\317\032\370Y\306\317\306\237\205?\303\370\371\367\263"
+	.ascii	"\320\317\020\3709\204\377}?{\360_\356\347\001\374o\361\377\371"
+	.ascii	"\363\004?\267\370y\305\317&\374L\302\177\275\377S\3767\371y\204"
+	.ascii	"\377w\377\267\374,\302\317\r\370\377\200\237A\370\371\203\237"
+	.ascii	"/\3709\350g\013~&\300\317\036~\016\300\177\026?\003\340g\n\376"
+	.ascii	"3\377\227\360\337\355\377\004}}}}\277\252\345O\275\374\024|\b"
+	.ascii	"W\211\3249\327\360\016[\256\340\332\377\022\b\335{|\353\022\243"
+	.ascii	"j\241\035\365h\364\376\315{\221\252\216\f\250Z\"UA%\305\252\356"
+	.ascii	"\021\311\205\243\006\345\255:&\305\356\325p\221\220\216\036P"
+	.ascii	"]\rI\261\273\274IqK\276\314\252\343E\242\272\032.\322=\362\220"
+	.ascii	"D\252Z&\305\216\226\032\222bU\313+Vu}.\322\221\262\006\322Uj"
+	.ascii	"\270bUa\256\030\325\322')F\265L\212U\365`\247$^\223\245\226\256"
+	.ascii	" ]\f$\211t\235\232\244\216\224>\315$\223\352\322\335\313d4\256"
+	.ascii	"\262\202{\245\250\224tGP\234\206l:!\247\034Q1\363\336\013A\023"
+	.ascii	"2\b\325Ej&\267\250\356\335B\302\270M&\216\314\346\275\342\346"
+	.ascii	"Q\210\324e\242qo\004M\367\036\3716\357\275\307{\257\215R\212"
+	.ascii	"y/\017\237$VS\323\275Q@MW\352\250F\343\336&\253K[&\305\202P\221"
+	.ascii	"P\203\"\206u\225\230G\306\272tUJU\354\350\3442\351\251XK\034"
+	.ascii	"yV\330\254\255\364\032+U*O\230\234W\031\006\304k\260\252\254"
+	.ascii	"\331%tM\256F\233=\\\304M\006\27646\353\264\036r\223\274\367\206"
+	.ascii	"\007\255[\367\365\274J%\210\243}M\345FN\317\007\031\231\236b"
+	.ascii	"\200\333\005\353\256\315\216\206Q1w\354\221\21674)g9Z\302\316"
+	.ascii	"\264\225\221\331\3400\003\346d2\333\300\f\211\322\227\351\260"
+	.ascii	"|h\201\322c{OR\2264\332b;|\314`&N=\213EI\2035\206\344I\262D\033"
+	.ascii	"9\323H}N\257\025w}\234\341\b\237}\3559\271\256_\340f\024\007"
+	.ascii	"]_\302\232\331O\272\253\235\264\222\326j&\275\3250t\222\006\353"
+	.ascii	"\257\346\352%\335\204\315\332\253\263\234i|\306\201\027\233i"
+	.ascii	"Qw\302k\005\232\251\266\347\230\0277\311\030\213\213\317\351"
+	.ascii	"\325X\f\306c\357\235\262s\272\300Mn\222y\260\206\347d4>\343\271"
+	.ascii	"\271\267\352\211\345\346\325-T`f\252\255\013(\025\333\022eY\001"
+	.ascii	"z\024ME/:\326\303qH'\251F\217j\251G\245\324\2435\324\3333,X\240"
+	.ascii	"\"U1\373\272\022\223\346\305uU\025\001\332\261;\363\006G\244"
+	.ascii	"\207\360\034\271\360\365\220\277\205\264UO\351P=\320zG\2365\032"
+	.ascii	"\305a\026a\016iW\221x\007\341\220*\243\230\227LM\323\346t\325"
+	.ascii	"h\207\0062\325\243\343Yu\203j\357\331\324d\376\b\332\331\223"
+	.ascii	"Cv\365T\373\270\321C\262\305\244\321"
+	.string	"\226\002B\227\364\240\220\214Q_\"\355\313T[\327W\027\236\263\3144Ui\f\315\251\345\n\177Q\301s\252Y9Z\013\251\227\031\262`q\003\303M\034+)Sm\317\022}d\322J<\003\317q\263\310E\223\250L\265u\251U\251s\253c<\23413\244\227h$\237\213d\365\304\272\227\t%\n\237\361 1\357\322f\f\f\t3}q\306\232L\265=\333\256\270\215\341\275\324\013\331T\333\023\n\332\235\263D\006'Z\211\331\030\214\347\310\274O\251\325\333T\333s,\0065\312\230\026\347\327\317\316V\3420,\206\233Q\314{\303&\251l\252\355yo+\373\251\243\332F\367h\032}\243\241z\251ktS'\265\216\336\321<\032G/{\205N6S;u\0166k\245\277\217\032y \346\275H\367^\2655>\343&\331E\255\354\246\332\272\356e\266\275\225\030\013\237Y'\312\213\024$\016E\0246\270\037\317{\231\005"
+	.ascii	"*@\001z\306\330(\343$\004z\313\245\246\247\263G\324\277o_\217"
+	.ascii	"W\216!-\334\250\361%Y\241Q>\303h\316i\230\357~\2451A\225\246"
+	.ascii	"'^\354\225\254/S\3224je\300\300\207\031 g\272\274H\334\221$\215"
+	.ascii	"\266\345\322\264\226\304G\243\266y0;S\234\024\221\202\323q\301"
+	.ascii	"\354\026\315\314\272Y9\235{\f\273O6hX\342\340\2367\031\025\224"
+	.ascii	"\343\304\206\023.m\267n\267Y28\361;\265\213K\356\250Q\213\345"
+	.ascii	"<Qok\316\030\354\225\377\006G\313JL\311\223z\f\302t,\227\215"
+	.ascii	"Z\266\337\365\326\035S\230F\255\225\263E\315=\211T\261pA\272"
+	.ascii	" \033\265iV\215\315\356f\327\316\263\246T\346\226T\257\002\337"
+	.ascii	"-\265g\267T\326\246\254t\356\024)r=\260\370\324\347\210\211\022"
+	.ascii	"\305\226q"
+	.string	"\330}J\211"
+	.ascii	"ib\346is\225wtb\311n\313r\254\230\335]\005\365,A!\203dS/&f\307"
+	.ascii	"\200\250\354\034\027/1]\367F\005\251PZKj\214\235\241_\332\372"
+	.ascii	"\316h9qb\303n\356\275\200\217\271\203\254\211L\030\317\341\030"
+	.ascii	"qB\003\b\224j\301,X\363\251\027\202=\347\225#\256\034$\0233\313"
+	.ascii	"\204\301\200\356Q\217\203\254\213S\306\313\253\371(`r\203\020"
+	.ascii	"\301\201w\307\305e\227\360\275\030d\335%\":\246l\327\355\222"
+	.ascii	"\263\036'\031\2428\033\265J\372\rI\232*ep\256\250\267H\330n\331"
+	.ascii	"-'\216\227:\"+\313\032\361A\265s\226\204\232\263z\341\205\346"
+	.ascii	"\353\201\225s\305D\025"
+	.string	"\006u\344H\353\361r\f\t\030\034\344\325\2255Rt\326}u\241y>\276\326X\2705\202^}Y\301\356\246\251\002\001b\211\250\227\315Y\367\365\314\341\241$\311g\207\334\022Q\362\261\220\326\250\265\3523\017T\222XY!5k\307\037MV\210\r\342<\323\003\322bj\r\273;+[eE\275\365\301\366\007\233\331\037<\327\314\253L\301P]\001\221\223\244I\b\236\227z\3469)+\325hxXW<,\217FC\2178o\2246\312F\261^\002\306\242\234\\c\351NL\243\2779\252V\207\325asx\261\201\245\304\352\353*\243Z\034\026\207\315\021\004FU\367\365\344q\262\201\004\317\346\35077 nO\276\250\267Ol\227fv\331S@ML\265\251\236{*\2655\254\223\255a\233\354\222]\262M[\226\310\201AY\246\333&\03324ZO\032\2656\032K\330S\017\006\323Y\272QeJM\275\352\245\244\204"
+	.string	"t\255i&\206\027l\222M\262H\365\032"
+	.string	"k++\307\230!\366h\217\026\331\200\016Ix\226PX\274\354\321-\222\315\214\013z\335G\204\314\227F\257F\365\365\235\355h\260\324%\365 \270\321\2409\033\372\304\274 n\203F5c\246\371JP\325}u\251[r,\005\371\2307_\334\226\013R\362\310\364\223L\353\225)\323z>\0279\367\206ec\245DK\017M\275\215\225\263\3058[/L\230\326\033\303L\221ZNZyo=NZJ\212\263I\252Oe\250k\274\272\276\263\263\353;\276\3120&\3020\177\222@\216_\336w\334\254Q\232\215\275\365\331\r\233\225-;5\365\251\222.M\327\245\347\322{\231I\365\244\224A\206\236S\217\367\002\271\245E\005\335$\331:Bk\271\367\\\313=\255\370\032m/m\263\343\350\352\230\026Q\237\336\340b\326\\\030\214\231\367\251\007\214\222\t\3425f\324w[\307\360\276\362+\275\205\243\3561\357"
+	.ascii	"8\230Q\312\240\277\341\336[z\220mp`\032\355,\375f\303E\243lG"
+	.ascii	"\243Zthl"
+	.string	"\365\235\265\024J\345\307\r/\215\232\265\333\331)+\311\255\321\306\242\306\345\270O\215\226\302=\2351\323\350k\346\324\377\347\364\036)\357\2757j\230\001&\030\203\035\b\207EEC \0041\212\20073\206~F\242 \b=\304!\360g\306\320o]\021c8\034a(\030C\307\204\003C\301a\n\250\t!\342PhH\370\023\202\0014\256.\204\200\302\031E!\241\242\265\310\3460B\274\020\006\211\306\242\210u\310\210\b(\f\212 \026\215D8@Dd$\024\016\2056F\2415\003\301b\212\201!\021\206q(\264q\361[\211P\343Z,Z\213\212\"\200.\034\2609\214\020\"\212\304\241\b\212C\"0X\224\2460\256/$\030\022g\2040$\316x\221s\323\301\270\026]\270(\241\030,\376:\020\016\203*bL\260\032\177+\326\f\004\213\202\306\030%\374\030\203B\021v8\020\375T\030W\0269F\341\n$\256&"
+	.string	"i(\256D1\212~,\212\306\340/\002@C\277\341\bE\253\2618\203\205\214\225\204\033c\221\030\004A\270\022\211F\300\234\2375\205a\321\272\"gh(\205Z\024\006\177F\341pg\315@\220\305Nqh\202\016\361\267\022\251\270"
+	.ascii	"N\005\017\270`\202\342\272\202(\200\r\306\365\005\004<#B\030"
+	.ascii	"\211\277\030!V\342O\021\0304\026Y\030\001\211~\300\007P(\376"
+	.ascii	"6\034\030$\256\302\365\205z\023(0@\241\201\f\233k\260\301\210"
+	.ascii	"\rF\244\327`\003\022$6@AB=\n\022\266\370\301\013apH\270\306\320"
+	.ascii	"p\340\214\037\221\230b5Z\215 \300c\024\312\240\304*4$\202Qh\350"
+	.ascii	"B(\002\316\320Jd\201\237\360\203b\360\206H\203\003\277\r*\212"
+	.ascii	"?\030:F\241\3640>|\030c%\2120\016\207D\0219>\304\037\f \272\026"
+	.ascii	"\375H@\241\370ka\001\243b\016\360\006(4\002A-\23604\f\022W\023"
+	.ascii	"40\n\203\251\361g,\362\3140\006\211\303 \321\004`\260\350'\234"
+	.ascii	"1\324c\024BA\302(\f\032\251\305\024;F\241\234\325\370\033\001"
+	.ascii	"\205\342\317\370\343C\364\023\276\b\262\360!\006\213\253\007"
+	.ascii	";\305\023\214)\206Vc\361G\324#\\S\b\022=0\n\327\024\326\234\225"
+	.ascii	"\b8C\305\372\342G\\SH\001\004\3643\022\255\036\310\370\025m\020"
+	.ascii	"\016\203F#\340*\343\003\242\237qh\354Pd\304\342\2050\230\302"
+	.ascii	"\260\250\203Q\310\250\236\004\t\025\036N !\004\025\030\202\270"
+	.ascii	"\022\031\r\2550\200E\021\302\340\257H\004\220X\024\021\302C\361"
+	.ascii	"\204\265(\330\002\005\340\nC\205\214_\021\017\321p\330\201P\215"
+	.ascii	"\217\336\242u\313\302H\355u\220\307d\325c\211\021$ve\215\242"
+	.ascii	"P(\024\272C\204c\324\321\035:c`\250\002fg\212\316\323\027\233"
+	.ascii	"\323\n\026\311CI\t\026\232\303\216\tYb\243Q\246X\207(%N\215\242"
+	.ascii	"Mh\023\272d\245\336\207\245Ryt\211\2663f\207\207\004}\332\331"
+	.ascii	"#\302\344\013}B\235z\216\020Y\"\231@Me\214\027\024\230\212&\321"
+	.ascii	"$j\343\346\310c\307\305\216\307\363F\345\b\372\321\245\2436\232"
+	.ascii	"uD\330\2624\212\326\3403\033\227\346\310N\017\225\311\223r\265"
+	.ascii	"\240\244\206\322\260y^p\311\252\244\326\353%\030\3208!\335\201"
+	.ascii	"\200RD\n\3226\325,IKrt4'\227\005\006=\226e1r\344"
+	.string	"k\224\347R\250$>\263\276FS\313\360\2326\322\320\3318y\361\r\261h\254[\023\254\357\252Q>\276\023@\346\262t\325X\345\025\331\261\361\374\237v\217\303\262\346\262p\363\013\016\270\275\233,\255 Ltbn\311\210\261y\251\322\032\241\201D\252Q;F\255\356\366K\235\315K\227\356E\216`\"\351\232\253G\327\\\230\333\274 \033\345\bw\246Q{g\235XY\315(N\013fKn\f\215F\361,\336\251$\300\231\202:\203\233\242\332q\275\335ny\263t=\312{\231\256E\272S[\260n\224\270\226\340\342n\351n\347\204C\240@i\324\312\361\225\036\224d\203\367\250\222\351<\210\342\f\231\241\021\021\031I\222\244\003R\n\020\204BY\240\b:;\022\300\364H\316:\306\320\310\210HARF\n\331\230\003\227\3110\013,\020[\314\315\333\361\316z\324\356\312J\321\305a\271\016\260\033\022\021g\203\035\334\265\377\265"
+	.string	"\364\332L5p$\370\001E\\\017\312\377\262\222R\334f\302\327\240)OP\301\246'\360\2525u\353\246\344~\366\215\317b\265O\035U7A\177\315\214K/1\n-\236\3112\204X\300G\224\207\317,\016]\362\2739\275"
+	.string	"[-\217\366\"\303J\351\034\220e\326\237\330=\217\025~w\201E\032/"
+	.ascii	"\032\003\037r\320E;\t>J\030\214\342H\300"
+	.ascii	"\337\035\360\032\3532e{\366N\304\265\274\254\274\230R\301\373"
+	.ascii	"\374,\224w0\350\234\272\024[ybw\214\267\373\032\201\307f\003"
+	.ascii	"6\321\327\007ty\t\356\320\025\366\316\203\205\023\324\202\301"
+	.ascii	"\304\201\335\2666o\225Q^-,\345-E\366+\372\332\246\026/"
+	.string	"\261\025\037[\364\247\342\tB\376\016\344\251\233\355\262H@\275t:[rp\027\303\317\344\223\340\225Jj\001\025\24114\365\337!\344t\203\274\216cF\350>\003\320\037\266\353\200\241\311E\005\245j\030\251\377L\300\317\240\321*l\364\363\336\032$\007\027\345\352\3507\241\021P\377\nc\316\361\203&-M\347zU^5\304a\363.k\260\302\315<\021\310\271\366C\013\306\255\336^R/\177\204\342P\347\003'\220/9\022gE\342-\216\356\337\277>5\234s\267\t\322\340\362\023\274\254\246h\341\246\320 \177o\376pm3\032m\323P\233\246\201\267\0229\201\226\027\016\300\366a\254>)\244yj\325v\212\377k\241\256\367B6`\330\376\200\t<^\016\353DV\037\346N\3013\030\020=NK\r\326&\272\200M15\2507X\031P\327\353\244\305f\335\016O\200\244\0168\242[\023\224V\312y\240I\245\251R]"
+	.string	"J\023\340u\227\027\324\200\214\037\312|\222[;\324\t\326\207KV\202\353,"
+	.ascii	",\246\376\245\247\353\364\334\215\373|\2250\r\217z\261\257_}"
+	.ascii	"\254\250\332\335>\260\347c\n\377\177\"\025\234\305\253XB\240"
+	.ascii	"\363\265\350\340j\\FM\225b\323\033hU\364\374\2038\206\037\324"
+	.ascii	"7h~M\245\2065\270j\270\372\322\212G\2317\241Q\004Hz\367'\016"
+	.ascii	"\321F\022P\302\013J\322\307\242\310c\273\313\347\336\373\313"
+	.ascii	"\267\211\250_\312\250\244\332\\\037c\322(N\274fPZ5\003\364d\355"
+	.ascii	"\236\343Tef/\266\370\264K\300\334`\307\312~QA`\237\221.\227\002"
+	.ascii	"7\240\351\316\332\272U\215\244\275=U\273\250g?\276\225\244\002"
+	.ascii	"\266\037\007w\222)\007\301 .V\305\210\327\t\372\206|\320\\;\214"
+	.ascii	"u\301X\237\265\216\037,d\330\360\311\204\\c\244\n\304-\340<\342"
+	.ascii	"\260tM\024\2355n\305\326\b\225\030\275\253b\326x\231\242g\031"
+	.ascii	"\353C\317\246!V\244\300\257\277\356\233D\301\362\336b\024-\t"
+	.ascii	"\020r\335\236\372rR%3H\354&h\237\301\264\243\320l\267m\347\034"
+	.ascii	"\363^+\366\310\273x\033\327a\332\347.\241\305k&\315\003||=\305"
+	.ascii	"\025\006\302\212\370*\212q\253\016\263\323\264\233\207d\030D"
+	.ascii	"\270\025\311\3001\236\351\354\2262\250\3514\262\245\3548\264"
+	.ascii	"=[\340\fd\035\223i\366\245Bz\351\270v\207\216Y\362\344\224\343"
+	.ascii	"vh\310R\210\204y\305\364;\035\005\330\317l\210\345^\t\217&\320"
+	.ascii	"\337\272\306\377\274r\004\300\027-c6\204\375w"
+	.string	"\3555\016p.\371\037\224{\r\363\200\255IZ\006\302_G\031\213\264D$\245sU|B\311\222\230Wj\262\261\300\005\224\\\237\004<\270X\356\372\310xxF\335|\226\031|\345\032\367\003W\337\277\224\360+OC\222\225\302\313\246w-\ft\332\216\311\236d\326\263h\206\001s\235\227@\347\346\332\277\377N=\246\037\215\231\306\001\236_Pb\310\302\032\361\3569\266v)]\213\304/\266\343\244\255\334Co\241j\312J^>\263\334\\h\031\023if\313\202x\013 \313\031d\272\325\2352\2344\026`\361\220\230:F\f_\246p\220o\206\217\3552\302'[\202\321\235\310\274h<9\206\314K\001/\363\320\370Y\304\215\265\r\377\236\007\301\245\317\313\352\263-\b\376\300\rr\"\300\300`\231\365\242T\007<m\2030\005\275\004\021\351q\344\025\366\0234T\016_\260{b\211\235=\232+\237Z\024N\357jW,\321"
+	.string	"\3632\001\016\375Y\230W2"
+	.string	"vD\322\203%VF\232\023\3517n\215\210\201\266\030\364\031p\203UG\300\340$C\036\315\247\rg\2444\263\233&\025\370\265\001(\021a\025a\334\272\237\346\340|\200\371\302\247\334\361"
+	.ascii	" 9\243\221\204\2513\2406 lYb\347,\013\275\265$a\266dG\336\342"
+	.ascii	"\342pFz\376k\366QX\260r\230;\027\214\271\205\212\221\314\257"
+	.ascii	"\333\033O\273.\334l\327{U\377\320\264\244\374\212]\321)D\330"
+	.ascii	"\305\274\236\200\034DM\310\210/\317\206L\206\276Y\025Q\330\321"
+	.ascii	"\027FD\246\003\305#\021\r\367\006O\035\030M\344\256\310\035\226"
+	.ascii	"\336@\253U\020E\177!\200\222\026\354R\200\306\251m\350.\220c"
+	.ascii	"I\376\211\302\3227\370p\003\234HR\352a\271\344\363\241q\271\262"
+	.ascii	"\225\317a\350\330\332\274\f\213\220\252_\256P!(\350\347\272\242"
+	.ascii	"\272\376\225\320\315\300\313\224\301\233\351\365m\227\233H\257"
+	.ascii	"z}C]pv\302H8\342C\336\361:\253\223\216E-&:a-\301\3218^\255M\201"
+	.ascii	"\321d\213p\365;\361\004\253!\324\325\f\313\257yA\371\251\007"
+	.ascii	"\312\270+\270\270qte\332\230\f\023S\305\005C)\342\331e6\314/"
+	.ascii	"7\315@DK\321\n\\\177)\177\003\017\316\230\232\241\177\201\376"
+	.ascii	"\343x\220\201O\006\267\263\236\320v\210\237\221\244g\244\323"
+	.ascii	"'\333\033\242q\177\177U8A?\202ICr{A\310y\304\270\002s\200\261"
+	.ascii	"'\204F\246\233\310\033\201\316\0056Nz+\2149u\333r\351\343\306"
+	.ascii	"\200\211\2367\231\257)e\233\354]\317\271\2021\221>a\221N\223"
+	.ascii	"\304'N\277#3\335\354*\366H\351W\r?\370\234o\234\332\202/\347"
+	.ascii	"\335HS.\270\020N\315\367L\267\321\321\274\3315i|\003\370R}\034"
+	.ascii	"o\262\376p\273X\376|\200\023\333\347\351V\275\312\270\212z\326"
+	.ascii	"\006\354\327]$\323=\367\333\3552\371?\032\033\2067\362\303\025"
+	.ascii	"\333#\264Z\034\326\350\333d>\272\006\370>\274\267\\\246\354\353"
+	.ascii	"i\r\243\363\037\004\267\325\365;\364g\277\006\306\363\235\025"
+	.ascii	"\370{ct\366\302\013>\177\324\375\204\272\027\267~\244Lx\0346"
+	.ascii	"\355\311\317\026\340}\316\022h*\273c;%j\306\276\362\022\255\277"
+	.ascii	"\301\327\346\373\277\364\260\370}gn\372\324\266%>\233\370T\030"
+	.ascii	"Q:=|\340\335+\336\263\025\316\217\316\202\377\341\374\201\240"
+	.ascii	"\207\311\t\303\241o\227\273#4o\336\261\365\256d\376\266\363\325"
+	.ascii	"\324\357\321!\316>\324+\364G]\304l\242|\357`{\367k\251\271ss"
+	.ascii	"\021}\211_\273\267\335\306{^pl\302\327\347\340(V\251\305\350"
+	.ascii	"\340q\222\2309\2715\277(\354\315\177)\270\001\226W\312#\275)"
+	.ascii	"t\bb\251\366\304y@\231\231\372\036\363\0266\375\2526\370\317"
+	.ascii	"N\275\216W\220\263\032\033!\244\317\233t\246o\347Ab\306IN\354"
+	.ascii	"\341\377\f\253\021\361q\231{.\036O.\274k6\235>K=\366\316\034"
+	.ascii	"\363\037\303\033M\236\342I\n\3352\215\267u>'\216\357\320\343"
+	.ascii	"pW^\333\315k\241\377r\207\344:\342\301\221\332\312\274\"\244"
+	.ascii	"\025"
+	.text
+	.section	.gnu.lto_.symtab.2affc0cc9053d21c,"e",@progbits
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"schedulerSignalTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"schedulerExecuteTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"schedulerEnableGyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"getTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"pidLoopReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"gyroFilterReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2affc0cc9053d21c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
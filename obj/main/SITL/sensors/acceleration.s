@@ -0,0 +1,1573 @@
+	.file	"acceleration.c"
+	.section	.gnu.lto_.profile.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\036"
+	.string	"$"
+	.text
+	.section	.gnu.lto_.icf.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\032\002u\r"
+	.string	"\306\322G> M6k(\234\2528K\353\005N\252\300\246P\3721\337W\\dj\372@\253\203\321ygv\251\202"
+	.string	"BC"
+	.string	"B"
+	.string	"B\024f\355\362}\r\265\224\264"
+	.string	""
+	.string	" \244\262\273Wv\367\026\271S\2223"
+	.string	"4"
+	.string	"9"
+	.string	"\341`\202\351\300s\342t\\\245\226C\266H\233\007\002Vz\331?\257>\273\273\271\271:\335\376\371<\023~P\245dS{\256\255M\273\021\233Q\b-C\333\306\035*t\372\363\025\233\260\2012\221D \217\307\324\261\2431x\035\374~\257\217#\2701\224\312\325\250\370\276W:\231f\027\344@e\331\262s\023si\276Q\\\f\217W\256\\\247<yr]\262\344\222\036<\0200j\344:$\234\022`\246\320\305\364\352\252#bf\241}$@\fJ\314f!\204BvY\034\225\030Q\260x{\224>h\300\n\232\345\220-\322\201\321D\212\025\313\200]<\244\021N\220\032\n\234)/\210\bP;\352\203a\301\200:\346-\207\n\n>\002\016\315T\232"
+	.string	"\177\235\f\242\024"
+	.ascii	"\373\265|\277|\267\330G\250\341%A\201\020\005\031IJ\313\r\200"
+	.ascii	"\202\251\251*\017\021PQAA\223\332c\33177\346\0061\366\236\336"
+	.ascii	"\350m\231; ?M\362\3511\234\005\341T/\210\374\003\244\266w\003"
+	.ascii	"\325[|K\230KR\024\322\351\355\205Np+\027\350\341\277\252\335"
+	.ascii	"\243;5\247p\275\323^\305\316\222\256(j\203\237\314\217\214\363"
+	.ascii	"\363\200\337\3463n\023-M\030q\274\267:\016\"'\222\031\023\035"
+	.ascii	"\214\220O\240\004\354\270kw\272\215\312\306\305\263\360\207\347"
+	.ascii	"K\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375 \362]\004"
+	.string	"b\006\023\035\240'\351\377\377\377\377\210\374\377\377\377\256\331\377w\326\350\355\217\367\277\302Zsd\313\224\002\236\030\364\366T\226\266\0357V\f\003\371\217hQ*6\261_#\266\016\273\311Y3l\241$<\250\005\232\307\277\217\310\001[.{\3667`$\032"
+	.ascii	"*\341c.RxXQ'\202j\274&\036\330\235\301\202\212\r\2306.v\223j"
+	.ascii	"f)\234\244\006\214`G\2451X\b\023\003\364\365ji\213\016\252*\225"
+	.ascii	"\2058\225i/\301m\240\r"
+	.text
+	.section	.gnu.lto_.inline.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\024\003\365\016"
+	.string	"\306\223H>"
+	.string	"Q&\215\001\300\274\204\013\206\fc\245>*\216\322\235\023@\177\330\2605\333\215\361\316\3014\f\307U\365Y\370\323X\257\352\373\377\377w\265\035\306\354\275\247r'\305(%\255\211\374\266\245\334)5"
+	.string	"7"
+	.string	"7"
+	.string	":'\341\271n\372\202Bj\302)\226L.\3108\221\320\236K\r3*\260X\220\257\\v\200I\210\240`\230\247(A\354\256\344C\252\371p\224\273\273\220\3778j\001_\321A\336 \317\0229\365\260\222\305p`J\021*:\357\022c\366P&I#w<%5\355\214\307\223A\266@\265>@\226\005\0304&\277\251J\246\252\001\275\310\227\017\307\237\003\222\332]\017}u\336tzbw;[\272v73g\315\006\370\260\242w\254\030\206/\201)\277\f\260\216\263\200"
+	.string	"\242\270Q-5\245\254\224\362\265\273\033\003\200\001\377k\r\022\216t!\2112\202\317\226&B\214pA"
+	.string	"B\f\305,\363\001\f\344\201FJ\352B\265>\313\006\n\210t\317o\211\335\267\232y:\t\207C.Wt'\016\237\007\\bX\250\021E\251\246\002\n\263(i\306\240\242\231\252\352\001\022 5M\003\2413\320D\027\324\342\342z\016"
+	.string	"\207,G\376#\353\336\362\303\243\236L\323\272\330/\251\324\302\265\005%0# \220DX\253\231g\240\360\354P\207\220\225\324\323Y\227\004\371\201\342t|:\273\323\372\2573\261\t|\202\260\305\364\273K\220\t\3008tm\340/rFTjTG\201\2038gc\274ga\341\265;<\350\205\352\312\233uy\021\036\250G\032\244N\255\324\360"
+	.ascii	"\301\241q\0260F\245\214\227\266\243\363\365\307\301\b\255\220"
+	.ascii	"\326\277\266\312\242\310\246\364\341\275\353\276\370?kS\301\037"
+	.ascii	"]1i\262\353\017\220\007"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\032\002\r\013"
+	.string	"\246\02053P\245&\35103\263\022\276b\272\222\200\016;\221\212\254\02133\331\001W\220\231\336vf.\316\313\311\030\316\313\204\337\343\020\324q\242\237\317\220'\237\020\231d%"
+	.string	"&"
+	.string	"+"
+	.string	"\236.iy\334\347@\344\250u]\022\271Z\333\027h?\020V\310\2274yIs\362\004k%l\263\247\236\003T\224\235\362E \017H\203V\260,\344\353\313`\355\352\037\017\332\242\261t\033\344\220\307q\237\353 \347\210\272;\354;\2543\033\326\237xU\300\234\247\321\024\354\210t\351\253R\300\021\331\213(\262\320\224"
+	.string	"c"
+	.string	"<\244].\254L\3234\315\nF&@\364\036\002l\245z\007I\303\213\001s\267\332\272D\331\276\013\244\206\3140th\016`%\217\270\236L\025#\003<\275a<= \200\002\231*3\017\bR\370X\304X\302\232\227\205\266\244\005\005a\260\023\013^my\221v\213\002%dX\256QQ\004/\232\031\017^ \235\347\235$\360\022`\036-\006}\020\212\270\3037\2135\334\213\030\226\244\237-\006v\020\201\235+b\350'\026\216\003\360\032=q\206\340\231A\355"
+	.ascii	"\326\f\345\226\321\363\240\267\226\204 \314sh~6\326\201\3451"
+	.ascii	"\035\343\313\323\314\332\351:\\Q\037\355(\027{\344\265\r\303"
+	.ascii	"tB\223\032p\003"
+	.text
+	.section	.gnu.lto_.pureconst.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\232\004\001\232\004\007\232\004\017\230\004\021\231\004\030"
+	.ascii	"\232\004\031\232\004\032\204\004\033\232\004\034\270\004\035"
+	.ascii	"\230\004\036\230\004\037\231\004\"\230\004#\204\004$\230\004"
+	.ascii	"%\232\004&\230\004'\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\022\002-\013"
+	.string	"rO-/pK\222\016\260\252\252\252b\375w\001"
+	.ascii	"\262\005T]\305:\001\022\265-\375\333\337l\263mL\221\241\\\277"
+	.ascii	"\375:\322\210\020\311,\324ZkD\312\024[\035\036\225c5\002N\036"
+	.ascii	"\342Y\037\236\243u\370\006\206\347\356\356\215N\2156\031\235"
+	.ascii	"\030\235\255\023S\216\351\274\224_\352(T-/:-\312\246J\251\202"
+	.ascii	"*\2234\301*\302\244(\017\236&\203\253B\",\230\2004\3631r\231"
+	.ascii	"\273\027:-\345\226\211y5\025\n\034\360\215\274\312\257NIy\005"
+	.ascii	"\340\217\b\375\024q\253\223RN\341\363\204\312\241Y\265S\235\022"
+	.ascii	"\345\021\235R\033\036ERy\274\347\274\265\2672\204\017\374<;P"
+	.ascii	"\250\2019T42aaI\n\215\0010\002\202\224J\272\001\021`\251t\216"
+	.ascii	"fa\222v\003\234\225\024\317i\271\234\244\344\\\321\364\373w\254"
+	.ascii	"b~\356 \315\311L\364{|\213\300]i$\260\227C\013x\346\352\354\347"
+	.ascii	"\225\266\351\312\333U\311'\177\023\210\231yrTe\004A\206;\233"
+	.ascii	"\3039@\013\246\341\017M\336\220\331\360\214\002O?\037j\003\b"
+	.ascii	"G\022\345\032\354\032\336\321\347\232g\377\312'B\217\327s\231"
+	.ascii	"jgS\240\317.>XU$\"\002T\025H\024\035Q\254\013\225\207\233\265"
+	.ascii	"\354\332i$\025\f\324E}\204h\265\205\235\310\377\004\n/\037"
+	.text
+	.section	.gnu.lto_.lto.2850093ad8f1c06d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.38.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"e\t"
+	.string	"\226\321A<0\345(\035\200\203QS\301Q\354Q\007o\266\331\244_#j\313X\203K\352\326M\331\206\335\241\"\313\"\"y\003F\230\036,\220\025y\300\306\214)\274:\307\370\f\243\021nKvJ\001-"
+	.string	"/"
+	.string	"4"
+	.string	"\237\234\013h\237\026\355\231\217\253\275\213\265\241\002\333]\232\211\\\274\024\375\233<"
+	.string	"\2252]n\013\273k\211Ju\334\331m#\330n\260]\023\3667\273\273\316T\366[\277\234\233\007L\001\200]\216X\200}M\027\222\216\355K\373%g\211o\225\356\331U\311\264\354\216\tV\340|z\374\200\026\233\315Tv\370x\2352\r?\3456\305YV\fV'\320\354\360\256\n\203l\213\243\\\030t\202\221!cF>\375\222\366\271\201\274\300hN2f\217&\231\205\004\341\310\253\020\022\034\311{\210\370\030D\"\260z\314}>\320#\205j'\3528.D\303\n\206_\027\322\317\013\215(WC\372908\321UJ\002\301J;\343>\r"
+	.ascii	"2\2419\034\030.,\310\256S\t\267jBL\274\241\027n\301\220K\260"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_accHasBeenCalibrated.40.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\355\007"
+	.string	"\022\21766Pm\323\001$\243\320\322\340 \264E\274\246\300"
+	.string	" /o\310H\365\017\375\007K\006\261\r\237\247z\226\343\251\321\304\3144\227\201\227X;\037JF\375\254\326\366\227;\245\2564\330\2748Tf=XUEI-\233\032fi\022\273\250\215\2542Mj\b<!\254Lr\346\314d\346\343\256\"\325\001N;\373\001\227\253\352?$\235\257\2078(\230\354\315\277y0r\304A\264\002\323n\005\303\307I\022\376\306\243':\360\336\243\337\271<^\001H\034<\331_\0075\303\276eUd\033Z!\364-\230\016\024\001\223]\320ieOb\211\303\266\307\3168a\301\343\355\337\bt\214\222\217\210\312\356'U\343\333\341\346\337\343\261t\221\342\205(\0161\r\273k\350\205,n\275m\003\333\b\266G\002\f"
+	.ascii	"2\001\3138\343\350#0!\366K\3401\323\313\246}\256\341\217\021"
+	.ascii	"n\tA\302\2353\265\363\t"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.41.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\265\b"
+	.string	"\026P;8@o\323\001\360\022Qe|\230d\267\311L=\304\364\316\336\004\020EZg\007n\250\311 >eh\024u;\244S\342\270:`:G]\314;\320\263\362(\342\377\376{\247\024)"
+	.string	","
+	.string	"+"
+	.string	"\257\314\331,\007;\366\246\024\n\022\227\335\245\222\343\334#\347\177\364"
+	.string	"O4\361\250A\330]GOtq\313\3336\260}`;\f!\006\t\325\305\224\r\206\242\334\260\217Y\251ac4(+\004\247]\213T\270*\363\344\303\366\375\322?\320IV@U\2376\310\256>\003#\377\347\205\233\234J"
+	.string	">\220\371g\317M\325\234\177v\270\310f\316\247\017>\344\301\367\3704DD\274\367)p\211\314\347\277G\220\212\2766Y\355|,\rc\300\256\313\242\233V\267\f\333h\326\261<\364\3226\272)pm\3004\372\251U\243\025\330}\364\204R\306KK'C~\017"
+	.ascii	"2\003\302\260\306\302R\231\300\200\034(\030U)\201\020\260qM\354"
+	.ascii	"\016\221\201\n\350T\320\227+\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.43.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\305\b"
+	.string	"\266\020>8@o\323\001"
+	.string	"\034\006p\304I\307\022\004E\b\350rv\367\377\003\375\bm\267,1\031\304<\3726\035\005\270(q\\\035V\370\367C\207 D\232\346u\257t\245M\366N)+"
+	.string	"-"
+	.string	"0"
+	.string	"\004\326\251C\233\345\343\307\276\004\245qr\332\335:=\036^\206\376G\036\340\001e\\\002D\354\256\245\007\264q\317\333N\260\375`[%3d\177\364K*A:\271\034\264\354~R\250]\241)!\031\333\227\366E.\n?\342|`7\024C\332\035\031\334p\235z\274\201uz=$\030\2238;\026\270\202e[\334\344\302\016\247\005\245\227\315%B\370$\030\033Y\002\3619\326\351\302\347\304!2\2112e\217\0359;\354W\273\273\016Z\306a\340\307m\2273\r\327m \346i\023Z\226a\365\363\272\217\323\276\312m\030E\315\274\257j\020\334Uh^\005\273\316\253\231Q|\2653\344\n%\013"
+	.ascii	"2\241\007\034\030.h<Y\0175/d,3\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.47.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375 \247\345\004"
+	.string	"\324\bk"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\303\307\202\037\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\366\007us\250\307\007uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\243\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/sensors/acceleration.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_accDetect.54.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\247\003m\032"
+	.string	"V\260\251H\260XQ:\360\242\035l\02566\\!\204S)w\332\212\371Z\302\221\244\013\213\247@\243<\2207\002v\203\262\350c\2757cT\0138\215\232\377\217c\276p\370\243u\251\\\002\317d\333A\252H\331\376O\b![\356\224\002\231"
+	.string	"\213"
+	.string	"\220"
+	.string	"CL\234j\345Mp\005\362\241y7 >$\177#>\264pa\307<\347\001\t\372\316\350\226\204\246V\336k\177x'\317[\254\0259\212!\335\311\343\333\336z\317\215\263\350\203\337\232\244K\345l\320\003Jz\234\034I\356\306\\\355\214&\244)\246#2N\"\311\t\315\221n\317\007u\251\\\r\232\341\211Q\220\333\024I\032\017\003\350\\P\005\265\326\373>\201t/&\245\006\202\210\340X\272\037\n!x\345\fK\347b.K'\343s\304\251\265z\342t1n\327m/\331\026ao\213\277\031_^L6\276\224\337w\rQ5M\3206\327\320Zk\335\335\331<\333\304 \325E\210w\310>\224_\300{?"
+	.ascii	"\227\247\311+\335\343{\267\350\351\320\323\324\323;\375\233/"
+	.ascii	"\t\2421\023\301J\255Am\324\324/\341S\221+\375\366\375\244\373"
+	.ascii	"\334\262\255T#m9\262)\251I\260V^\204\207\366p&\337\271\024\003"
+	.ascii	"\337`J\260\326\372\340\2417\220\017y\217\262\363^\315\253Z{P"
+	.ascii	"] \037*\240s\332?\372\223\235Ciq\002\265\006\273s\351\322*7\241"
+	.ascii	"\337\305\335\025\313\334\262\3745q\334\271\367\235r\211\202\272"
+	.ascii	"=\371\3146\026w7\345\306\371\227\250\347\213\n\317#~K\2441?\263"
+	.ascii	"\312\342\024\260\266\n\026\363\270\257\212\035\2744\301\237\265"
+	.ascii	"\371L/\020e\344@\252\202Ntw\276\357+1I\232\310\377n:\001\254"
+	.ascii	"\270@6\026\003\035\220\271\271\323\257\030\270SB,W\223\201\t"
+	.ascii	"\224\220\257\211?\237\212\201\344k\342C\362C-\332rdt\240\204"
+	.ascii	"\"\0358j\265]\207m\003'\256Vqg\255Z\251#+C\031-\304\f\204\254"
+	.ascii	"\204\261 Q\302:\304b\260\001+d$\3261"
+	.string	"\n9\263\022:\260RfB\026\213\301^\264rF\313\221\321^9%`'^\261\222\366\242\260\3003\024\262\362\2453\233\225\257\026\257\022\235\2628P\005\361YY]\313Ir\215\323\263>\255\325\264g)\346q!\216\317\332\030P\341\341\304\032\017uSq\\\327\002\271\026\301\020\037Hb~f\025\321jwLSGKu{\354R\216\241-$\024\214\"\252/\030\252\036\323\270\344\210\227\360P\177\230\035^\350\237>.\220\226\323\035\021G\250Q$\244\024C\212\020'\230\t\213\002Q\213\001`\002\231:3\017\021\200\315T3\3122\007\213\252@\3779\004\247d\t\374#\3711}\366\026\326\311\273\2152\305~\247k]\362\233L\246\005\232\276\234\364E\177y\371\367\210w\364v\034R\331\f7\266cC\210\016Z\210\237\312n<)2\370\020\214gV\242Vr\303\362\333\0201ry\321\204\035\021-\322o\300\207\211;\274"
+	.ascii	"\276\301\314\260\320\370t\271@\303\227\201\353rf\351\331\034"
+	.ascii	"ii\377\001e\201Ma\352\215\233~\345\371\253`\\\373\300\261\251"
+	.ascii	"t\233\340\007"
+	.text
+	.section	.gnu.lto_accInitFilters.55.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\365\002\245\026"
+	.string	"\366\252\222J\300\322Q:\242\362\242\311\245`\021\013\234\302T&;\302\222\371\300\021\026\242\372H$.qG\232\225\356D\226\355\377\303\263{7\366.\034\265\336\300\241*4C\020*\001\021hp\266\030\274\213\301\t\273\343\207^4B\310&r\247\024\200"
+	.string	"r"
+	.string	"~"
+	.string	"\364+\016d;PCy\273)\217z@\250Z\203'\247nP\236\222\274\300x*~\300xz\225m\266\216\007E\324\033\245\260\021\342Qkem\b\357\305\340MN\333Kr\244\342N\233O\256\2240\335\340\371n/\305"
+	.string	"\f\204\273I\232\310\371\350\200i\210\347\3139\025>A\215\033\035\225o\303\024\001\370:|E|:\221\244\326\372\237\317\236/7'\271Rk\365\344\371p\356\324m\217\260-\301\236?\002\272\351\3036\354C4e\255U\305\027z\013\f\276\317\251c\263y\336\251?[\032\325\324\003\b7\207v07\367g\177\326Zo\336\035{\344\300{EN\207\220\323\251\007\335\3458M\322\351qNSqZ\024\247w\247\347\234\276"
+	.ascii	"\003:4^\226j\3450\004R\235(R\211\007\375\300O\373\366Y\370B\253"
+	.ascii	"\202\234TdD\004Uk\215P\236\332W\341\007\255z\247\344\236\347"
+	.ascii	"\201\356\270G\242{\341M\222l\364\330\035\305]\355\n\355\232v"
+	.ascii	"\r\343;p\254@W+\316D\334\357d\344\346\320swi\324\016\352;\367"
+	.ascii	"\301S\245\031C\233 t\177\236\363D\377\017E\323\206lj{'zj\017"
+	.ascii	"\220\370\221Z\377\350/h|\037\277\300\300\214\247\004p\350\340"
+	.ascii	"\346P\024/\334E\013\302S\255:\025\277\350F\256WL\314x\032\262"
+	.ascii	"\251\327Z\353\356\3174\343\367<\302\034\0015X\206\226Xky\305"
+	.ascii	"`\025^23\261\026\213\313\325Z\331\225\"\233\301jZ\264\227\314"
+	.ascii	"\313\345j\261j\264YM\366\252\261d\260V\214\345\242\325X)%\236"
+	.ascii	"\315\274h\254\232\331\214\306R\005q\337\035\377\274\\\372\340"
+	.ascii	"\204\333\234\313\375Y\3253\216,\355\241'/\267\207\362r'\317E"
+	.ascii	"r\301\313\035\331\237`\032\332\201@0W;.\271\366\004\n\363<\223"
+	.ascii	"\354\366f\177\251&r\236m\331\225XP\236j\255\017b<\251\305\202"
+	.ascii	"\213\313\030: `\002!\204t\036\342\200\377C\222\366\242l\254\365"
+	.ascii	"%Q\"\274\363\2231\035&:\352$\256;Fo5\257\254%\214\251\310c\264"
+	.ascii	"\212>\361\340\246\300\207\335\215e\002es\347\327\230\013 \322"
+	.ascii	"\216l\255\177\243\027\020b\237\241<\2637(\314G\006\035\315a\336"
+	.ascii	"Q\313\351\227)\253\032>gV\252\203y4Wl\356\250\270p\3725\361:"
+	.ascii	"f\360\205\354\26628\t\260\216s0\004'A\331p\371\362)\347\351\261"
+	.ascii	"\2467\001\227\001"
+	.text
+	.section	.gnu.lto_accInit.56.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`J\005\345\037"
+	.string	"\326\271\313G\200\334Q\007'T\344\271\253FTbm\200\252\033q\021\333\2201\305\351\226;Vk\004\262\036\364\371\261\326\252\177\275ag\371-\0167\035\272\244P\004m\211&\215m\356\033h\262\024\251;\032\t\f\022\203\273m\271SJ)\263"
+	.string	"\257"
+	.string	"\276"
+	.ascii	"m\240\2554\241\231!\261\274\227i\251v\277j\225\250\266\352\316"
+	.ascii	"jgF\342\276j-\306i\322XH\235e\204\n\233P\256\343\230\007\264"
+	.ascii	"\353\001\223[\331L\220\332\352\250\357R\323\215\211\213\314\354"
+	.ascii	"^\345\202\256\374\203ve%\372\316\334J\232\n\251\253Xp\275\227"
+	.ascii	"\007\221)\367*\031\260\003\264+\200\3269\273z\0138\27323?\210"
+	.ascii	"\200\304\266\225I\246\206\212R\304B\273W\271{ m\373\254\346\273"
+	.ascii	"\345\276A\n\373Dit\305A*\275@.\271)\243\337T\340\264EF\016\231"
+	.ascii	"d\352\200\371 \323Z\355G$\321\335\346s\357e7\"a4\333\232\231"
+	.ascii	"Sf\036\301\\m\217\233Q\206\244\212[\313\n\f\t\222*2t\226\rX\274"
+	.ascii	"L,\002\316\314\241\203\267\321?\201\227\221/b_i\341AG\354\336"
+	.ascii	"\333B\270\201 \272J\210\034\263\210\246\002\224\223\274\367J"
+	.ascii	"\350:\305\241\034q\f}\311\001\234\271\204\211\037Pc\352\213\370"
+	.ascii	"B\326yci\326r.\350\336\352'A\271\344\275C'\315\325\343\026\322"
+	.ascii	"\225\323 ocW\356 !\024\336Fn\255\016\221\344\246\231-\275\220"
+	.ascii	"YI\364\177bn\363\376\017\346\256\352\356\341\331yg\035;\347\332"
+	.ascii	"\252\031\327Y\3159\354|\303\316\267\2333\212:\333P\347\023u\256"
+	.ascii	"\250\263\311\316os\366\3239\350\367\226\017-\023.)\302\205@\005"
+	.ascii	"\222~\331\"m\fo\343\355\017\330\036\375\356*\256\315\35066J\315"
+	.ascii	"\366\270\251%\004\357\255fco\270\030\333\034\235fuX\020C\003"
+	.ascii	"\242 \266\006\267\303\366p\257\264/\245\027r\216\217Nc\204\346"
+	.ascii	"L\rk\223fc\350K\223\317\347y\347bV\326er\347\343(\255i\"F\247"
+	.ascii	"\257\377\247\266Qg\375\023WcI\316\346\251\307\2145\231\005\302"
+	.ascii	"A,\024\324\331\265~\355Rc\376\316{XqmH\213\261Qa\035\306J\241"
+	.ascii	"\367^[\304NY#\217\233J\223\366\317l\2214\030\373\005\354\273"
+	.ascii	"\214g\330&i/\226\n\2757I\0027\227\356b\227\374\\\270pv\375A_"
+	.ascii	"J\344\013\022\032\342\335\202\276\224\310\027$4\364C\364"
+	.string	"\013\002\215z\272\025\032\322 \357C:\224\202\210\007\242\327\343\351\270\327\300\367\023\n\362\212\322\241\264\327\343\355\200E?\240/\005\356|B<\242]\257\b\270k\200\200\177)\322\242]\360\367+\332\341(\207m\326\fc\226ZRL'v\356\217\314\234{\366\031>\361\254\340\272g\266J\266\350m\274\371\326j\237\244\027r\317\353\236\275\270\346T\316\300x\324\177b\033\216g?\036\365\210\031\313\334\205\225\3029S\263\2219{\361\bB\362\336%\027\276d\217a\256d\245\330\001\326\331\221c\017\241*{\236o)*'\337\371\234?\332\363\366'\256\310&x]\250AD\204\024$\206)\221\t\0244)V\016\300\"\0212\252\007\021\0201e\310L\032-c\370\374\0222R\316\016\231\373p0%\340\334g\371$\334S\356\216\352G\002$;@\260\275\210'\244\207/_\317\334O^\204\316)\344\373\350\267Y\367wo\217\225"
+	.ascii	"\212!L\034^\216\217\033;\270\t=\321\217u\370\204\213\223'2\227"
+	.ascii	"\374\350v#m\301\001\376\037\316c3!\004e\337\016\035\311\227\237"
+	.ascii	"\031y5\246{\357A\330\026oc$V%\2556\2178\256\266\302~w\027s\030"
+	.ascii	">tE\007]\351\025\360P\254\216s\242\3537\222\277\344\327\335\007"
+	.ascii	"\346\033:\232U\244\"\214~\252\207\215\341\346\3409\230qkm\207"
+	.ascii	"\002\317\013\377\233\242g5"
+	.text
+	.section	.gnu.lto_accStartCalibration.57.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375 \356u\006"
+	.string	"2\f-2\200K\322\001\300m\006\360\002\216\216\274\b\320\331jJ,"
+	.string	"\013\321r|/\266\206t\324W\273\363\307\313\274\267\320$)\267\2407&P\205`\221\033\311\235R~\021\025'\211$a\002|OrS\306I\301\351\250IRpON\027\0218.@\351$1J\007]{\315 h6\026m\260>|\362\370\232kL|\0133P\330\2557\237\362\274\265\211\016\216\210\205u\354\253\302T\302>\300j\306\326\201\214\217\td\367\322\031\331M\363\270\260}\310\225\035\362\253b\317\021\341\260\301\331]\247\024\257\316*\377\030\027\2600\225\263\200\203\3355\2630\020\267\336v\201m\003\333\227\b"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_accIsCalibrationComplete.58.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\355\006"
+	.string	"\242\31503pk\322\001\220\341X\317\340\262-\272\271$\224\313\272\315\206\375\255\023B\265mh\350\030\333F\377\030<\2607\252*\\\001z\264\311\025\327kP[B\244L)v\224\nV,T|\013\3179\252Y\021Z\325\263ZU\241\030\232\213V\243\020\0306\274\330,\020\3066\311\366\nR\035\330(\307\376ErU}G\3049\3063.>\205\0350y\354\223\217\221|\272\006@lrdg\232T\t\373\322\356\256\025d;\255\231\276$\300\361\241\260\261\353\031\215\254\307$\262\260\235\261'>@\310\370z\026\362\274\"\324\321\020\331\315\232N\374z^\376/.\205\200t`\037\315\023 aw\235\330\347\341\326\333.\260m`;\"\b"
+	.ascii	"2\001O8c\216#D\250@\346\032\275\204\310\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_performAcclerationCalibration.61.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`~\007\205)"
+	.string	"\312H\320\017Ep\236J:\305\351\377\003\227\2268D\204\204\276@/\263\275/\261\021]J\006\214\2533\3478=d'\003\013I>\377\213m\207\232[X[,\230\212\2223\340\022pN\035\202\262h\261E\255\265F\b!D\312$\003\343"
+	.string	"\330"
+	.string	"\364"
+	.string	"\306\375\227\355r/\351\323V\fZ\245\205\236\245u\261Sku\360r3\240/\017\220'2]\234\035\r\306\034\027\214-7\223q\343\232wed\354>\313\265\314\270q{\353\216J\255\325\367rw\306\256\357%\351\333\335\363\356\255\374Jz,4\216\204\352U\231\r0\265\032\225V\002\372r\215/2_\242'2_n\272[\347F\260z.!\3132\253\253\265\002\033\311\366I\343\327\344\364<\3644K\2629\335\223=A\334\221X\254:\017\001\021\036@\216\222\023j\324u\235\215\026\020\362\267'\313\315\311\216\340\211\026\027\237\244P\255\025\250\230EF`\034\305!\233='[/\177\234$\223\274\320\370"
+	.string	"*\326 \213\326\024\231\343+^q\377\313\223\346\264\021\213[\347\363B\255u\231X\344\361\355}w\243\354\256\206\335\363EI\326\336\334\234\206e\347\f\023j\346\335G\350\330\255Y\361\221K\007\337\335\016/\303\024\004Vk\265\260\037s2'\366a/\227\n\005\n\363e9\306\255N\356Vgdl\220\375\265\255\365\240Y\240\273\244T)\213s\305{v\277\3660\301}\33069\361\211N\346\313\002}0g\260\225F\214\313\212\217]k\255\352\376\3325\016\371\257md\367\307\233\324\340X\376\004?\336\002O\373\"\375x\217~\274F=^\001>\336\242\037o"
+	.string	"\037/\321\311\013\340\344\035:y\205z\274A'/\320\311\373s\362\376z\274>\036o\357\344\345\235\274\350\311{\362x\315\223\267DyI\224\267Q^>y\017a@\2375Pg\265\3568\336U5\345\032\223\247\335\344=\227\203qq\265\3551nT\036\r@\250\207\270\006g1\026\277\024j\036\235\036\261\240\036\262\025P\007\325\375\247\201\364\374\327?J\\\217?\2735_\363\271[\301k_\223lY}\366\364\232@\022.-\264y}\232a\215\r\321\276b\314\263\321.\331\350\230\320\271\263yttbkHr;\320\320\240\231\324'\373P\331X\226<m\360$\365\321\316bQ\254x]9\373kype\203n8vp\244\306\241t\244>]\031\334\025\3579Yk\255\346\203#u\203~\327\2346,\257\341\222\031\267d\340M\303\353l@\351\b9\020"
+	.string	"\013\2132_2"
+	.string	"\223;\334\345Dy\370\300'~0_\232}\036\211\263\343R\333]V\340\266jEopD"
+	.ascii	"\201\2759\217\304Q\251+\273\r\323\017\030\033\"\036\262\313>"
+	.ascii	"V\232nn\322k\250f\325\fl\210\267\2110z\253\265V`{\032\022%L\230"
+	.ascii	"0_v\033\bTO1\202$U\324\223p\204\212\246\026O RHa\200\202\232"
+	.ascii	"\022\016m\023\004\251\251\247\026A\241\023\224SSS\020H%\234\242"
+	.ascii	"\222r\242\002J=\005\243\200MB* \204\004;\305\302I\bl15%\004\372"
+	.ascii	"\214V\177m#\313tTc\325\303=\352\"}<>h\032\365Q\237\207\030u\271"
+	.ascii	"u\024\343\001y7-\222~\361\211{\262\243o\332\232\330\331\031v"
+	.ascii	"\325\376K&\022\356Z\242\360\226\204\205\244J\224\3006]\302A8"
+	.ascii	",\340b )\223M\235\244P\370\304\024\212\331I'w\334\352\270\307"
+	.ascii	"\243\360\326\017T\316\n\311\234\302<\226\266\302\265l*\306\305"
+	.ascii	"\264\312Vx\271\254\225\216\245W\366a4\314\227\327r\036\313q\347"
+	.ascii	"eEN@\353\340\034$\033\021OQ\013\350g\365\t\320D]\324\347\034"
+	.ascii	"V\223\224\214q\004\177\266\213\201\211\031n\366\3067\002\364"
+	.ascii	"\317\342`\001\320D}\316\r\005\200\226\250a$\350\224C\n\215\220"
+	.ascii	"HAA\322\264\006\220\002\221\2512z\021p53V$\nT\231\266\003c\350"
+	.ascii	"\200\320E\256Gd\304@\213\263v\216\227\355\\\021P\032\247OR\364"
+	.ascii	"'\315\250\365\024\303\314\230\020i\340xW_\323\357'\345\006\250"
+	.ascii	"\241~l\262\251\237\002\214\254\272X|\233\233\366u\237s\232\302"
+	.ascii	"y\\N\241\326P\326\371\227\351C \\s\233\367i:\345?\021\251\\\257"
+	.ascii	"y\273\0301 2(\031\272\367\270%jM\025\363+\352\024N8\366\0139"
+	.ascii	"\270|2\017\264v\\\246\234;\261\203\201ZD>,\033\207\300\b\201"
+	.ascii	"\035\345\006\024\261\366\304\263\316X\372\206r\205\221\273\347"
+	.ascii	"\0316,\342.\353\306@g\030\224\213\214?\327\0300\316I\024\344"
+	.ascii	"#\336\337b\272\206'\215cD\346\323\007\361B\003\323\003\036\346"
+	.ascii	"\035\373\362\203\376\375\266\260WG\226\357\270\221\342\206\""
+	.ascii	"\212\264\245\251=\210\004\n\363\203\231=\344\344\334\347\244"
+	.ascii	"?I\210Z\"U\034\370w\025\266\0040\2202g\302)(\r\244\301\005Y\205"
+	.ascii	"hu\336\240\246fU\203\002Xdq\240\"t\032\3673\305E\fG\002\355\310"
+	.ascii	"\375\017"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.62.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\b\re<"
+	.ascii	"\272a\234\025?@\350M\007dJ\337\310g\353\334[2u\207\311Q\373\372"
+	.ascii	"\200>\331\236\033\001V|\222\263A\214\006\\\006\256A\302~f\366"
+	.ascii	"\250\t6\020\274\313T9\240\030\276\304G$\264\311\336{\357-SJ\001"
+	.ascii	"8\0018\001N\001\277\337w\273~\263\355\367\332~\253\355w\332~"
+	.ascii	"\243\355wf\277\177\375\366\022\216I\271\007\311\3072\216\323"
+	.ascii	"\372.\305\206R:0.\307\325O\037}\264[\331>g\316\343\300.\247\353"
+	.ascii	"\256\314\224\361\332\n>\345\333\003O\033\004\353\351\025\352"
+	.ascii	"P\252\033\177\363\303\225\275:\213?\272\235\215\313\005qeS\305"
+	.ascii	"]2\276\305q\354z\332\035\244\333\3654\273\335\355\337\355o\016"
+	.ascii	"\007{\234\220\251\247\330\254\215\223<q\254\214\320[\254\247"
+	.ascii	"\255\364(\325S\326\241TO\033\356v\344\312c\274\2021\202\366f"
+	.ascii	"/\216c\255\254\245\263\243Jo\366ao\n\002\335_\313\256j\352\204"
+	.ascii	"\346\207\333\327\017-qm\2107\031=\210:\320\323C\311\355\324\214"
+	.ascii	"hT\332\027\242\224\007\256\037\254(\211\342.\226\025%P\374\207"
+	.ascii	"V \262\027\305\355\324\240\240@>\264DO\276E\237\234\240\023\346"
+	.ascii	"\020yv\375\220EI\321W6W\321\346\234}\352\302\242;\331\251EA\257"
+	.ascii	"\3428\366\244c\215Q\233\362(\023\317\250\003\243 &Mkfh\324\241"
+	.ascii	"+x\236\364?\2626\374_?\304q\334O\\S\342\375\344\335\216\325\335"
+	.ascii	"\"\272\201L\002\356\036\307q\354\224\261\364\324[_\033Ff\317"
+	.ascii	"\207\256y\222S\322\244\020\016\351u7M\2755o\261\335y\252\331"
+	.ascii	"\321"
+	.string	"k\325\314\3532pt<\023]&\004\315\023\341\214^w\203\241\233\204/\352j\302QLp8\nQ=U\363\026\332\035d\\\232\025\335\371!Gd\367\336u\252\247\351\023\315\205\bEpA\201\320\034\324b\007I\227\363\237W\312\227\356\007E\363P\361NTQG\214$\374>\b^\367^8\306q\254\241\233\205\363i\301\306q\214a\017\020/\t\315.c\252\2479_p\243\363<\256g\314\305\213\027\252\247\237\335e\235g/\211\244\205\311\271\255)\370\227\3529F\233Ef\317\327\355u\334\316W{\227\006\013{'z\332\036\246z\352\271\303\233!#\\Q\370}\335\312\341\347\2668\216\207t\306\322\315\345q\356[.\307{A\373\235\025\374V\260~'\b~#\370}c\375\276\257\332o\253\337\367\201\337wU\373m\200\375.\360\373&\360\373\246\002~O\255\337R\353\367\200\366;\252\375\026\320~C\265\337\001\332o"
+	.ascii	"\354\367\323\372\355\304~7\375\276\203\3567\320\375v\335\357"
+	.ascii	"\310\227\301\361\323\244w\177\346u8\3077\323\325\241\371e\004"
+	.ascii	"\344\255\271\273g\034T\036#\346\301|\201\312A\346\0352@\356\302"
+	.ascii	"\345\335^\366\217\001r\220\231\350I\007 gy\263\232\337\006\303"
+	.ascii	"\313\352\210\351\257\274\354[\001\2203\270\321Qy\312+3\021\262"
+	.ascii	"\b\341]\207\335\324n\230\013\354\345\235\330<*\031z\352\231\345"
+	.ascii	"!"
+	.string	"\355P\300\300dl\3009\215oN!\r\265\237\355\2134`10\0312Z\b\245qR9\323\342\374\374Ku\312d\317\304){\322\033h\031\364,z\233\333\332\335\262r\345t\213\323\003_\220\217\364\202\374Y\274\225CG\331\334\266 se/\3037wf\034\276\352\332\233\325|\265\030^V\021\216\316O\322\224W\246 d\021Ow\177\202#\215G\252I\204\321\b8\032Y\231\313\275\275`F\203\223N\307?sb$`\016f?#\344\346_\006\032\207o\326x\262`3?\204\321T5\177\310\013a$\274\006\206\203\341TO\335\234\345F\327\346_\376\2743\275>8\311fjsf\366y~^\037\370\030\277\004'\243\370\334\022W\017\020\357D\020\252\247+[\335\236\323\205s\313\"\252\337q6\273\225=6\373\034o\300\254C\3464\267ueb>\300\3202\034bd+j\204\355\020K!#\007\327\215\033cd"
+	.ascii	":LB\2161\261\035`d3n\314\b\013\003\323*#\033+\3131\243L+\207"
+	.ascii	"\030\030\016\2550\2622-\t\bzL\307\f2\255\035ccdZ\256R\350\031"
+	.ascii	"K\177\3751$\314\303\246\r\337\r#\201\323\336\211\355Ig\3570Q"
+	.ascii	"y\352\r_u\355\037\275\026\232K\336\021\334$B\303l\237\347\245"
+	.ascii	"\240\321\343\301N\240\300"
+	.string	"R\244\274qT\f$\346\236S\221\273\\\207\370EM\326)\244R]\256E\374\335\333\030\\\256I|\242\256n\227\363W\203\344\222\361\315\231\225\355\016\r\"FR\220\263\262\243eJ\220\021d\0059\305t\026f\370}S\276\320\027\007\270\312\023\202\257`\030\224 sp\213\303\312\br\212\351*c\005\002t\365\264\312~\226\007\262\225\035\257\312\007\352\370T\345\226\351\bIg \323\275VzFxU\021\310\0062:\b-\023\236\002\271\312\255H\201*\023\310i\335\231\232a\0358\311\322\241\312'\342\360\214pr\334\271\2744N>pi\216\301\334\326\357\304\247r\214\236k\203\311L\345\314\206\367\004J\3457}}\376\245\016\310R\331_n@^\227Ld\321\335\250\254L\346\205x\270\327\3414\337\272<\034\327D\345\255\245\"\244\200\034\201\027\250q8\310\024chD$HA\222\244\320\030q\005\304\020I\025\245\007\021"
+	.ascii	"\255c\214M\215(\2511l\0063\\K:\003\345\274\204\212\263\313E\361"
+	.ascii	"\230E\231\013M1.\002\266J] \301TcK\005D\033\260\250lI\212\022"
+	.ascii	"\260s\021\250\215\330M\244\356\026BB\233\334y\032-)\347\204:"
+	.ascii	"6\257\266\203\3002\0047Z;~\201\371\241U\251\216\322h\204z\225"
+	.ascii	"\356]4\260\372\0348\355f\371\2472\247\032\023\032\221,\301\220"
+	.ascii	"\233&\231\320\201!@\311V~\fV\327\023C\007]\005Q\314\273[\016"
+	.ascii	"\315\216o\240\244\332\254V\205\305TQUl\263C\201\241\230\375\t"
+	.ascii	"\3206g#\214>p\213\370\325\027\252\031\\bN\216J\305\026\\\364"
+	.ascii	"\030\272\357&\332+\225\361\3605\017A&\211\352\351\2140\360p\201"
+	.ascii	"Nn\027x\352~4\321\256\355s\232\340\355\375DYA)\030\262\223\307"
+	.ascii	"m^\313\004\333\216{6.\220!\025\f\322\201\323\261\247\263\237"
+	.ascii	"}\233\203Hz\221\243_\177\001\032}\214\351r\277xG\250'\207\260"
+	.ascii	"\023\356\031A[\221\260(\021\213\004\314\n\375\301w\343,\265\032"
+	.ascii	"s\307\006\026B\004G>X]8\251\215\203^\3414(\350\024.\0209p%\237"
+	.ascii	"\256e\271=\246Df\360\030\204B8\200Y\374`|\017\027{\201R\361\202"
+	.ascii	"\017a\310\215\273\245a\023)\225\240\262\0210,z\346Fa\353LTh\246"
+	.ascii	"\302+\034Qj-\201\354\231\244c\004\317\217\"\251\033\t\r\270\356"
+	.ascii	"\231^H\363\303\322f\335bm\\'`\020%\251\207\331\316_\020N\213"
+	.ascii	"\031w\321\250\234\266Lp\364\316\037!\250\2626\202\r~\242\274"
+	.ascii	"\310\231\376'xM\0043\350\304\3470V\031&\006HH6\n3\267\212\033"
+	.ascii	"^\02116g\003J\215(Pe\263\327\256\316\027\334\016XO\375'5Z\352"
+	.ascii	"{Ht(\373n\020\301\246\315\360?b\244\322B\027\351\210sv\214\350"
+	.ascii	"5T{R\022%F\306\036\275d\237&\002\253\330\037\316L\202\372)\243"
+	.ascii	"\242\006"
+	.text
+	.section	.gnu.lto_accUpdate.64.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`*\001\275\r"
+	.string	"\006Z^C"
+	.string	"s\233\016\330\f\357`\0025\005h\327\3573\210\206i|Zr\022\255;u5\224DiM\200\377\377\205M\302\333\006\355V\022\250%\221^DA5\372R+\317\243\340C\002-\262\326\346O\330\267\266\267L)H"
+	.string	"I"
+	.string	"M"
+	.string	"\257\f\\\304z%?\300ze\317\336\3610e/\003\306\344\362\262\273W<\341y\236\364.\243z>"
+	.ascii	"Pt\2519y\224\tPj\234l@\222\024\271"
+	.string	"QB\307S\327\016`I5C\262\273\326\017\004qW\267\r\301v\211\375/\366\277\362\"\202\203\343\311>\313\2379\352\217R\255Q}\020+\304\207\027\036^\217]\0171?\326FE#\205\355olk\370\025\357,\032\036\262{\202q\240y\345Ps\265\277\342*\336Q\033\f\262KB\305\214\335P\201\027h\002\273\273\321\031,\215\022R9J\352\303\034}\313cP\340\244\354\216\376\301\340\n\274\210\032\031\214(E\221m\355.,\020\260?o\301\005\300\261\273\r\\\316\002\203\217\342\225\273\220\376\013Y\257\036\237:\002\260\345\204\242\202\032i\214\035\2224\232\b\335G\233&\0250\220V2a{\340\361p3\244\213\220}4\023\320\226\315\031\3028\306F6N\003uf\346\3110\254su\223\353\266\254\2736\255\363\271\260\331]#\007\314]\310\346\005\342\270ym\302\221\351$\243H2I\001\232\211v\007\323\177\226Q\024\030"
+	.ascii	"2\003\303\341\327X\270jI\317\024&\324\2550\317c!b\232\030 8`"
+	.ascii	"\b[\341z\271\304\306\352\306\263\002]c\213a^\020~SS\340^05%\270"
+	.ascii	"#-\355\321\300\324\036"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.65.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\375\002m\027"
+	.string	"\306m\232F\260\332*\035\270\273r[4'\036\3469\227EIW\377sR\224\262^O\261js\220\242\352\005z\352\310\205\355\265_\250\3570R\332\335X\370S\372\023\252\017{V\226\217\242}\304\366\301\034\311YcI#{\313\235R\210"
+	.string	"|"
+	.string	"\207"
+	.string	"\276\216\357x}\347\236\223j\325\351)R\353\030\301\024\304S\217/\205\247\342\007\204\247\025,\274\f\373\230[A@'\304\346\027T\353xZ\031\336\317\361\236\260\205=\024\322\271\242\204\371\266\330C.\036\206dx\237\273\233\225\234)Al.N\247\200Zk\214\315\304\234Pk\275\357\022\205m&'\214\356\346+\336\\\234\007p\234\334\304\330h\263A\224\234\237\363\236\240\006\213\233\224!\231Z\253e\315\326\342\026\3356\f\333\033\354\r\020\247\337\363\376\300\b\217\r\234\0357\231\f\332cL.\316\376\227l\331a\361\352\330\245\357~\222\245G\377\3350\357\335\242)-J\351\020\225\016\2514\235\322\323\322;\245\345J\277\200\001-=)>\335\220\2352\326\025\301.\025\n\365\241\361\337\337\273\264\3173\353\217:sT"
+	.string	"\351\300\361\321\367y\344\363x\217\327{N\362\332\242\376DN\007\004\252\265\232N\235A<E0\245\375\262G\266\245t\005z)\2024\234\031p\301\021\003\035\344|~\343\366\023\024$\256_\344\203\201\fr;\276{\274\324\256\310V\256\310$\\\322\206\3664\033\363n\022\322\r\367\264\0323\031\264h\351\316\237\315\227\357\\\003^h@2\031\2349\021\003\305Z\353\005_\310\207\320\370;\247f\201"
+	.string	"\261\367]\003\213\333O\016\037\231\f\356\326Zc\2738\377\257\265Vqul\372\227C\357I\t\311\305\376\217\003q\022\177\307.#\221\257\235\372F\022\006\256\025\t\324Tu@\265T#0\314\210\240\021\221J\241\0068%\241\206\265\n\201j\251fT\251\024\352\344j\261\\5*\327\251f\205\2429\245Z\256\223\004\005f}P\265N!X\254\326\311c\375\fW\354\242s\342\003H\177X8\032\255ed;\013\361\\\224\323=\261\001J\323a"
+	.ascii	"H\322\332+\017\362\265\335\271\261;\\\234\222\363N_\334\252\004"
+	.ascii	"e9]\234G3\266\264t\206h\272hQ\330v\204\213V\306\350Q)!\271\334"
+	.ascii	"c\354s\032\302E[\3326 `\2021UF76F\340\262\204\211\317m]\214\351"
+	.ascii	"FB\350Zq{\351niH[\354Z\312F\212\006\256w\253r\376\f\337\353\006"
+	.ascii	"\373u\366\332\331U\013{\357\273\330\003\342\201\020\216H\301"
+	.ascii	"\016\243\033\255\346\334\022\357\022\316^\350\036\246w\034;\201"
+	.ascii	"\270\260\264\0131Z\225\272\r\211\256\315A \231680c\253Ex'\fP"
+	.ascii	"<\356\322U\303l\213Q|\243\315>\b\360\324s\333kj\232\006&\240"
+	.text
+	.section	.gnu.lto_setAccelerationTrims.66.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"]\b"
+	.string	"\006\320;9@\345&\035\340\275\240\177\226\233\265\004V=\206\214\231x)bq\022\256\342\023A4\213tg\253\035D\213nO\020\024Y\311O(\367\267\205\2652\201S\3543a\264\333\336)\005*"
+	.string	","
+	.string	"+"
+	.string	"\321\233\335\362\316c\021BX*N^vW\302\216o\177\233\177\222\013\210F\240\277\200\206\335\365\023\2152nx\333\n\266\035ls\001\177\230\001\316b\364\013\323.\306)\300\226b\nH\306\366\237}\221\217l\347>'\330%\255\240\354v\013f\250\036\335\335\200z\254^@=\225\212K)\004)\374\240_r\223\217\377\341\t\317\273\350\321\367P\217\020\032&"
+	.string	"\033\241w\262;\320\203\034\3661\273\273\206$\373\334\003X}\230\233\312\311\350\346\300\227F\233Y\307\242X\004v]\226\254tV\r\253R\313,\216\274h\225\232\004O\t\214\312\316\234Tf\272=$9\t"
+	.ascii	"0\223\241\214\305\t\236a\\(\007C.\3016\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_applyAccelerometerTrimsDelta.67.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`&\002\245\017"
+	.string	"V\234dD"
+	.string	"\221(\035\215\21351\315r\324f\016\325\215rl\037;\237\325\034\260\263O\355#!X-\370i_\255\224\001![\022\311\267\227l\332F\325[\377\217[ \3259\340\237\003\2459V\207Y+\371d\023)S\nM"
+	.string	"F"
+	.string	"Y"
+	.ascii	"<\026&\262|\350\330~\332\037q\022\246\267H\376\261\273\202\255"
+	.ascii	"\354\272\016\030\301\366h\327\005h\217\333\003h\2176\3319\356"
+	.ascii	"b\355'\304\216\222\024\330\356r\332\341\246\247\311?\3127)\325"
+	.ascii	"\205\247F\301\356:S\252\f\267\336v\001\333\r\354\004\021?y\264"
+	.ascii	"\205\221|\352\321\037\321\036\257\207i\210\211h\235r\306v\241"
+	.ascii	"R9\330\317vw\255+\373\255\037@\246=\232\356h\232\223\351\215"
+	.ascii	"\246\267Lk2\255i:j:\313\264j:3\375\017\017\212\212\352&6vMf\002"
+	.ascii	"-5X\033\275\214\207\226F\267\3560X^\254h\364\023sii\352\242\205"
+	.ascii	"\n\213\247tD\3252M\215\372i\301\260\001\2253V\315Vx\217y\251"
+	.ascii	"\030m) \210\374\345uB\242=\252>\006\3075\365%1Kx\212\227\200"
+	.ascii	"eS8\212Q\210\277\237\0201\360\332\335\220\0227\021:\240\222\250"
+	.ascii	"c\020\216<\360\301\204P\311s\020\201\264@$\372\300\001\016\201"
+	.ascii	"\220>\257\004\002;Q\027\n\201\270\020\374BR\027r$\0174\342B`"
+	.ascii	"\310\201\020\360W\241\003\271\322\367\201\\\307uz\266\272\362"
+	.ascii	"v\243\007\314IQ\366(\215\031.2:\352\341\350\246\035\375\274l"
+	.ascii	"\224\023\303\273\f+, \260\202\231\032\355\"\241\02730\206\247"
+	.ascii	"\004\326\220\217{0\2763\211\356\r.\310\337\204\220\304\356\365"
+	.ascii	"bZ\003\006\016\361y\260\016\241 E\212\361b\304\342q9X+q1\027"
+	.ascii	"\344\005G\374\031J\276\035V2\212\305\270\206\342l\237\201\320"
+	.ascii	"\246\277L\350\275\315\372\353\320L\3266\373\024\350\345E\233"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_accZero_saved.2.87.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.88.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_accDetect.part.0.102.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\253\001-\020"
+	.string	"\346\335jH\360\2606\035x\276\350\253\006\205\203[\306\024\255\372\252\327\345l\266M\0316\216\301}8\216\246\333\323\270\205\033k\236F\315\203~U\365"
+	.string	"\217\023\002\226\374,>xe\346\334\342\201g\027,\346\203\336\3479C(\322&{\247\024T"
+	.string	"Y"
+	.string	"T"
+	.string	"5{H{\365U\234|\013\347\270\202\033\237\335\025y\365\202\355\365,lr2\256l\333\344\204\364\351\254\030\227\2273\033Z<vY\334+5\361\323\351\314N\376T\275\240N\017{\202\0246J\360\274^>|\022x\366\201\262\273\336@\334\365\266\035\330\246`\317"
+	.ascii	"\0019"
+	.string	"\207\031T3\236\306\366\370\032\217c\232)\233\nA'\216\311 \273$zb\021\266W\327x\233R\b\345\260\2512\226M\3731\336\"oS\322V \036\312\031\222W?`m\017i\244O\363\032\203^\355\342,\362/L\033j\265\315h\255\360\331e\215\274\232\301\366\032\362\002\332\003+\363*\317\235\03384P\224C?\240\331&9\r\320@\314\3566\360u\036\303\340\237x\265\3102\257b\321^\017\273\310\216\235\026\236\227\216\324\374\231\2644\315\236-\205\261=\375:\"#@\304\256\313O\217\035Qk\310<\347w\375\257S\373\366a\214\376\315e<\2378\001\2240 \303\247B\277\260+\251\204]\212\347u SH\372\302j\257d\004\212H]\370Y\370<\257\343\304\020\024G\237\310\215D\335\n\347\205\"W\202\300\340\205/\344H \030r\240gKa|\330!\364\240p\351\314\377\244\235v\240FI\321\026JK\333"
+	.string	"\346\274H\263+\004# @B\004\235\331\006\306d\361dc\f\221\b;\002tOi\257\332"
+	.ascii	"@\236G\230c\220\337\002\356\203\371\022!\035L?\2244\016\334s"
+	.ascii	"\271{\372\b\256'\247/\t\333n\333<K\036\370\373H-\261/\344\013"
+	.ascii	"/\205+\026\273X\013\253\021T\303KLQx\377\265e\f"
+	.text
+	.section	.gnu.lto_accInit.part.0.108.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\315\005\345\036"
+	.string	"\3665\276G\220\234Qc\222l7O\375=\304\234X\003\351\351\3670\210\033\257\"\347\300'\006\212L\033\310\230\360P\023ha\225+\360~\341'+\2137SL\344R`\365>\340\375\336e\362\316eH@u0\211Qb\367\336R\246\024\241"
+	.string	"\253"
+	.string	"\253"
+	.string	"O\232\006\245\bYd#\037y(\2469y\225\321\237\374dGF\331\325\212.\037d?\021\230_r&For\342W\3118c\272\362\342u\357\261\301O\373\310~\372(\263Y\177,:\025\260\036\257\321h\263\332W\362)\243S\001}\336\353\364C\312\275\307\007?\rA\366s\347\003\320\237\365\002\320\237\366\2218\202\204\"\243mG\220`\344\340\217PL\357\021\205\210\004\273\367X\373iy<x[\315\240_\213.\216n\237\274\202\"I\035\\V.`\274\006\270\031\353\271\367Z\026\343>o\273\202\355 \366\231\0256\222|\t\353\262\332\035\266\346\315k\237lW\337\374\370\317v\252e;\3251\263\032\325\251>\315j3\247\332\346TW"
+	.ascii	"\325\017\360\200\206\216\215{\231\226a\327\351\234\002\344W\277"
+	.ascii	"\325\263\350x\326\341\240\300\025U\274\262\265\323\n\252\306"
+	.ascii	"\255]\352]\201#\324\213\0335Z\3040-\007\365\f\227\222L\253-\257"
+	.ascii	"$`\027\351\330\300\204\203\354R\2220Gm\b\245tff\337\274+me\234"
+	.ascii	"\001\263\002@\206\231\254Y\322\027\330\275\367\024\3234%\206"
+	.ascii	"\f;\326\245\3304\247W\372\314B\223\332\264\2376q\245c[\226G\356"
+	.ascii	"\275\264\230oU\344_\005\302\237\232\004tP\221l\013\352\360\264"
+	.ascii	"4%'RS\t\252\261\356\212t\257P\301\225\365\006\225|y\341U\332"
+	.ascii	"\330N\205\215i\257\374\232 U\355\362\271\232\013\016\322\330"
+	.ascii	"\026\200\031\203\206\372\242\021\020\355\221\2555\355\223\277"
+	.ascii	"\017b\233/\217C\253\265\326\225\3304\254K\333\034\376\365{\223"
+	.ascii	"\25626\013]d\252\2050\003\231\306@\275\362^\035\b@\335+|q\214"
+	.ascii	"\355\200\030k\232\023\222=\262\355\341`>|\361r\213\"iL\325{ "
+	.ascii	"j\377\234\013\230c\2078\027\033\016\324\275w\202\226o\021\341"
+	.ascii	"G\375\364\b\022\365E\022\350\317'_\243\206<\005\006\342I}@\235"
+	.ascii	"\001\003\361\240\310\225H}@]M7T\300@\267\031Q/\307\353\351vB"
+	.ascii	">\274\224\350w\002\247\223bC\216\350\006\"'4\304\273\375\340"
+	.ascii	"p7\035\343xz\351\216\350\346\313\t\345p\270[\355\347K\177\275"
+	.ascii	"\334\257\326\333\335x5\234\357W\343I\340t(\347\253\021\245\251"
+	.ascii	"\257F\273y\355\223\237|\2060MUX\365\017\2427v\205\355\033\353"
+	.ascii	"\036\241\035\332\336\264v\207m\006\325\016\n\t\022\251Z7\260"
+	.ascii	"\f\355\221gFj\013 \016\013.UR5d\326\016J\325\242\261rT\330p\226"
+	.ascii	",\262H&fe\366JZ\250\215Y\313F\311\353\264\250=\261Mm\250\201"
+	.ascii	"L\342\0203##2CR\222d8\240\002\031*c\035\0210\245b\220\314\005"
+	.ascii	"R\222\222B\246\335\f\020\230v&O\240\250\020\265[wR:\351\345\317"
+	.ascii	"\277\022\217\335\235g\023\205\037\312,'\0302X\273a\233\235x\205"
+	.ascii	"\022\ri\223\366\346n\243\201\320\034\213\224!\206g\r\236@\"p"
+	.ascii	"\001%\300\002\2752a\315X=\265#1\307\267\t\002\003\373F\216\356"
+	.ascii	"\216\271\245ho\273\231\244\215\375\177$\372\375f7Ag\327\t\001"
+	.ascii	"h\263'\374S\276\213\200\232\215I}\225\275(\005\345\3100\252\312"
+	.ascii	"S\357|Z\217#5p\313\\aD\326V\251\023@\335r\221\377\372i\353%\320"
+	.ascii	"\305\016,\377\025\313Q\271\370b\027q\025\364/wP\366c\315\002"
+	.ascii	"\017\203\333\007+\222\324g\245\326\324\250\254\2372\270\344\374"
+	.ascii	"3L\032"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.110.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`^\fe;"
+	.ascii	"\252c\264\025BP\346Q\007\267;\0220]\334\326\351\316\231\0201"
+	.ascii	"\221\337\361+U\b\220\301\254/R\373\200\212 #\334\312t\357B\370"
+	.ascii	"\200\336\2300\021M\003xD\364O=\003\217\320b=\251\f\264Fv\223"
+	.ascii	"\275\267L)\005B\0017\001I\001\331\303\026\241\025\241\3139\237"
+	.ascii	"h\315\260q8\034\376\326\025\226R\034\335\236\306\325t\373Z\207"
+	.ascii	"\277\365\t\267@L\265\234\263O\307\332nf\253\035\332\276\356v"
+	.ascii	"4[\356\306\343Cd\244\022)_\033\267\371\231\327\335x\264\233\363"
+	.ascii	"\224\264\017\255\257P\252\257\377\375\271\345l>\234\236yL\254"
+	.ascii	"\377\273}\315\313\274\316\346\303\2059\227\331\271\311\371\t"
+	.ascii	"\301\327\226\320\372\332Ogb}m}\310\372\332\355d\272{K\254\373"
+	.ascii	"\355\036\344Og\3668; n\213r\316D_\261\025\266\327\330\325\247"
+	.ascii	"\267P}]I\230\024D\002\376|=\267\345\261\253\212\177\370\266s"
+	.ascii	"\271\322\0255\202\363\205U\306\314<\211\327\241\216\253he\320"
+	.ascii	"\246\214\231y\220\314\221\310\230\017\214\2322\006\305\177\252"
+	.ascii	"\003:\271D"
+	.string	"\316G\f\212\312dDK\322\241O\336\247&E\210\303\344{\274\016U\306\232\270\333\304\3338\036\305G\314\211\n\005\365\250.b\313\347\251I9g$%\0205\302\013Qv=\333CS\342\353'\225I\\U\0350\355 AR~\251L{\250\004\362)\275\036{\324W*a\212\222J%\376J>\344u\3109\267#\261x/y\267+\273\233\252\333G#.\b\204\210\021#X_\235\340\222\205\220\177\327\303\347H\2704Cw\t\007t\302\341P\370\224\312\241S_\377`\354R\263\250#\241r\302T\334l\325U\260\216s\264\001\362zF\335\336\307\375\250h?\353\025,X\260\276:\366\250/\340:\243\306\\[\342\2343\027\306\315>\262\335-\\\317\361\347\3149_h\307\343y^\264\237\371\332UV\357I+\326W\207z\003\2643\\\230j\207\220\177\367\270\331x\350\031\227u#p\277\017\270\337Q\3567\324\023\360\333"
+	.string	"\360\273\200\373M\300\375\036\320~\013p\277\003\270\337N\356wS\373\r\300\375fr\277\227\334\357a\373\255\344~\013\177\337I\354w\320\237\356H\275o\340\317\375\366\371\276{\356\267\353R\357\266\367\315c\335\357\265\375V\333o\354r\336\317\373v\r*Z\232 3g#w\216r\2245\272\305\345\334\245\356t\334NO\260\260\325G5/\277p\240\273\251\332\242\354\365\224\232`\001G\037\235\276\360\334\334SmQ\316O\242\257\216\246}N\035:e\340\304\221\006q\242=\241\213\363\267\366\250\334VCy=\263R\314MK=\217\005\257\372{\204\355~\223\274K\336\223A\f\003\017\220\302#9y\241\274\361\241\243\307\013s5\366\037n6r\340/\207\\\331c\250\317'!\363"
+	.string	"\304\016\347\237\006\306\311\\[\022\337\337\376\310K\345\2479#\337\346\217\275V\026\274\222J\301\364\305\336\276\310k\326\346\214\364$\221b\323\220~\261\274Y\336\223\355Pw'\2377z\2760\227\0177\333w\305\375\341\365J+\345m\213\277\312\367Z\374\303"
+	.ascii	"\332\202\374\361\341 \035\327\364a\305%\347\003A\224,\304\340"
+	.ascii	"]\334\303\335/\332\353\345=\351\303P_\230\253\373\275\260\022"
+	.ascii	"8\223\337\365\202\341\340\364\265\237\353\221\257\2307\355%\363"
+	.ascii	"\222a}\355aO*A\376]\226\337u\\\002\347\243\242C\247v.\3668\276"
+	.ascii	"\212-\333\324E\335~\346\234[\\\326\376\256\261<\f\243m\256\316"
+	.ascii	"\031\275k/\233\007"
+	.string	"\017\254\257<\354PW\273,\341\352\226<\334lwne1\236{)\177,\004\202?\366Dms\330\325\234sf\037\370c\026\017\333\302\024\2011\273\376\256W\254\250\343\230\246\037<Q\021\311\211\310U\274b,\005\2433D\002B\241\023\n\bQ=\321\251\330\277,\331\244EW\214\007\221\330\220\241=PG\254\035U\352\221\352\252\006V\212\033YWF#\016+\340\261\006\2261\305\f\253\033X&bdy\240AC\313(l\253\251,-\254\033U\306+\032WVVU\304\243Q\353\230uu$faU\325 Z\031\217\304\251\003\255e\343\312H\274\241\245e$\372\3343.\353F\342.\245$\004\030\317\005\245\374\351I\370\204\021\340a\233\020E\007\260\233\270(\f\205\017`\325\016\214\331\005\327q\027\234l\212S\3235Q\370\202Y\207O\323qm?\364\337\212?\354^33\326W(\354u\362\324%\031\300n\017\274"
+	.string	"6\200\035\214\331e\346\333Z\332~\326?\356\032\316{\262\341\260\276\026\220s;\304\\[\022\300O\2662\003p"
+	.string	"L@"
+	.string	"\036\240FF\300\207\371\2641b\336[\312\372\032"
+	.string	"\363\354\2308\341/^\2724a&\354\004"
+	.string	"7q\331\002"
+	.string	"\302g9+\376\234X\2300\317\021\235\350\0226s\026\177oe\210\205x\t;\030\027%<\304\177\007\214\256\371rM9s\366z\273\276\354\375Z0\315\331\353\002\025\027/\220\366\263 \254\257Jx\312,\372\340\245t\\p\252\246?|\224\342\317I&\304\256\306\237\214M\017s-\372O\036\212\f!/\021\"\254\257I\270\267\274S\267D\376]\320\b!$\334\354#\033\304\020\200\363\250a4\006\021C\210HDD\222$)t`\002\221\031;\352\006\022"
+	.string	"e5\207S\216\031\263)(1\354?\007\373JX\234v\341\321G\275\\\323\317E\247\321\226\344\363\333x\324\244r'w\001V\027\333\266,\216\360\032\030\226\245\317\231S\263\007\032D\244\267\256\373\364\323\256\2039\343\317\247\033.\033\300"
+	.ascii	"z\267\210u\344\330\"\275<\267\253\\\f\217\332#=N\250\342\213"
+	.ascii	"\261o\322Yj!\363\317\013\025\3014\2418\244\252\270\037hw\362"
+	.ascii	"\260xo\314\270H\034\323\341\225\200\360'\024`\266\237C\361\301"
+	.ascii	"\033\344(\236@\016(s\217\177q\247\342S!\315@\3409\226\274;\007"
+	.ascii	"\263\252\242\2002\202\360\216\230\316\203\377\\\031\367q\233"
+	.ascii	"\223\226t\210\274s.\006\324\300\355a\021\313\035r\270aH\200]"
+	.ascii	"\373\301\023\215[\256\030\200\027\021Dn\001\3537\315\206`\003"
+	.ascii	"A\263\356q\234p\224N\254x{&@8@/\317\344\335\bu\006\005\240\356"
+	.ascii	"\003\023\264\236\n\227\313\277\037\224\205\024\2434:\317\226"
+	.ascii	"\263u\307\b,\222\025\262\274\030\235\206\3013^'\244\303\320+"
+	.ascii	"\r\007}\226w\nI\254\213E\300\004\201J\245\332Q\326\211@@\342"
+	.ascii	"\250\202_,-xd\032J\034\214\"y7o\361\001\033l\355)\226\200\360"
+	.ascii	"u#\230\351\0210\257\321C\231AR\211\327\217\200\216h\252-\244"
+	.ascii	"\001nda\325mM\305+\033Z\201\376)\377^\230\206\335\322#\017\333"
+	.ascii	"\330q\013\177\360\217\027Z'\235\254*\243,\371s\304aq\321\bH\256"
+	.ascii	"\351\362\371q\236\212\271nRp\3207\237\255\266\020\216\246\021"
+	.ascii	"4\370qx\202\266\2416$\017\211B\264\030d\310\0268\r\273\256C\033"
+	.ascii	"\016S\336\341$\274\352~\225n_}\230\270\246\364i\2054>\201\024"
+	.ascii	"w@\253\273\360i2\233\375\231x\205\224\301([]\2666\332J),b\036"
+	.ascii	"E\005"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.part.0.111.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`,\002-\022"
+	.string	"\206\243wF\360\320&\035:\315Z\032>|\362\321\341\005x\235\251\260X\374\030K\311A4\337\313_\017+_\247\232Y=\006\303(\266*\333\016\266\243\267\030x\006\2663\375\234\334\353\374\272\243_\364`[j\207\261v\357-eJ\001c"
+	.string	"d"
+	.string	"\\"
+	.string	"\246Cw7\020\017M\367\210\207\366Kx\204\244\005\033!q\371\365.\207\246\300\354\247B\017\322n\267\035\352\007\353_wk\276\016\237f|\371y!\326rX*\341\371\333\261\251Qd\304\"\226\341\357\r\330\335"
+	.ascii	"1\230\327`w\037\364\224\211\271\244\002\230axz<\226Jv\327&\r"
+	.ascii	"w\351\266YlG\260\223\013I8v\003l\021\342\265\037\350i\337\007"
+	.ascii	"\n\372\371y[\333\327a\346\310\004\211\327N\363W\370\344\323\362"
+	.ascii	"\007L\2671\030\217\357\343\247x\217\353*\374\342[\263\267\220"
+	.ascii	"3\033:\332]\220CC0\035~\274\364yZ\366\311v\331\247\303|\327B"
+	.ascii	"\320m\r\314\232\366O|\307u\024\026z\307.\216\020\321n\027rh\007"
+	.ascii	"\001\273\253*\263\315\340\327\250\007h36bn<\244\300'R\361\220"
+	.ascii	"\017\302\267P<\\\020\003I\237B}\314\210w\303\210\251\252\217"
+	.ascii	"\021\361\222I\276\246>\350\020fC\203f\344\223\303%\223\254\327"
+	.ascii	"\335mI\225Y\343\277\212c;]\212\232\206\357\376\367\322\372\322"
+	.ascii	"y\240\373\2477\233!\340f\227&,\023\n\334KI\340V)\226\007'+(+"
+	.ascii	"(\024\347a\224H\212\312D\205[\245NR(\024\267\261V*VJ\212\265"
+	.ascii	"\245\230p(\033j\305\332D\022X5!\265\332TT\252\325v\372Wq\b<\377"
+	.ascii	"\025K%u\211\213\276@\225\371\035HE.hnj\253\034\254\377S\231\241"
+	.ascii	"N\004\371I'\243^el;\344\327\364@\223\001\2237\254\177\033+ `"
+	.ascii	"\202Aw\266\r7\"PAb<*\360i\230 \327\270\020a\247\250\272\216\355"
+	.ascii	"\030\315K\334\331\213\037\255\276\021\216\030\235\nNi\300\003"
+	.ascii	"k\020\336W\262G\351<F;\232%v\231\257@\251\220\200\001\200\342"
+	.ascii	"\271KS/\336k\222\253\f]l\200zX\023\266[h4.`\007\305\023\347\n"
+	.ascii	"\322\337{-\306\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\037\004\345\022"
+	.string	"\006\034lH\260ZM:<\374\370\230\261\337\205\251\344\2748\335\263\260\031\372!\360\263\263\003\330\227\376\203s\354,\204\373\2573\244b\027\341\340t\236\032\2751f\334\370\371\231M\244\377\377\357\344\217\037[\375\004\244\257\210\n\311\332Dn\231\002U"
+	.string	"`"
+	.string	"V"
+	.string	"\227\262!\372^@|\t\255ud\372\320\347\"=\\K\207Wqx\226\r\307\242\341T\031~\305"
+	.string	"\206[\221\224R\245\013\035AZ\270\251\3403\257t\240\206\302\247&\377;\322\t=\363?"
+	.string	"Z+e\332ZC\2205\327\364\367\037\005d?J)\225\3206\362\377,\0208\363\347qC:*\262\021\335\204lF9\337\261\207\f\235Y\324W\022\243\257[\2522I\302\330\372NNd\206\370\200\321\317\021\365\003\371\242\035\310\241Gq\361\250\331\242\033H\026\375.B\315\200\326\2532\262\242i*z\301\227\242\025\320&\024\235@\236\350\177\221&vJ\360\220"
+	.ascii	"\032\361\023t\336\024\021\033\262\013\267\253\023\262\253\267"
+	.ascii	"3!VA\300\220k7/\036\272\332O!9\2624\0039\300\316\006d\001\343"
+	.ascii	"\022\020\363\343i\266\274\243\377\244\243\357$G\377IR\037\nR"
+	.ascii	"\037\352\250\337\344\326\337\341\350S1\352O\271\321\227\262\321"
+	.ascii	"gR\243o\265\377\177\361\f\215~\225\235\021g\325\375\200\032\016"
+	.ascii	"\222}[wC\031\267z+\245\306l!\022\023\271Ua\"\263p>\"\357\370"
+	.ascii	"#r\rHd\031M\344\244\330\267W=1\006u\373\321\304\030\334-\363"
+	.ascii	"\3200K\267\b\240\212\360^0^\334\356\222\0310\274\035\030\263"
+	.ascii	"\306\335\034\245\024'\344VN\310\256\032U\250q\020fM\033\232E"
+	.ascii	")\254\264\030\260\002!#Z\007\021\300 \225\320HT1\022\314H\017"
+	.ascii	"\307\022d-\202R\247Ig\355X\305,\271=\214\243\213\350NUqt\314"
+	.ascii	"\003\246aJZ\b,\356\357\343x\236\317\303\361\321\313\217LL-[\030"
+	.ascii	";\304L\220\254\210\223\233\037c\366\343C\270\"\277\316_s\243"
+	.ascii	"H\377\212=u\276:\240\337{5:j+\353\330\013\026\274\313Y\212T$"
+	.ascii	"\352\017\203LB\344\2348'\362*\355d\340\034\314H\314,\361dUkX"
+	.ascii	"J/\3504\\\272[q\t\206\221\013^\271\r\260\351!\351\322\356u\324"
+	.text
+	.section	.gnu.lto_.refs.2850093ad8f1c06d,"e",@progbits
+	.string	"(\265/\375`\t\001]\n"
+	.string	"\226\\H.`g\223t"
+	.string	"k\030\206a\030\206a\030\206)\013\320\320\321\211\250\b\215\210\327\210\321?a\252\032c7\353\260\377\337\337\266F\304\022\"\311\226)8"
+	.string	">"
+	.string	"<"
+	.string	"N?\302<\204\341\016\366\215\2053\013o\215/\032W\215'\365d/\242%\216G\334?,\036\365'\351\023\322K\324G\322?\356\031\365KyK|\365\233>%\316\233\217?\025U\b\274\375\213<K\210\302|\320\301\177\260\370\016\372\r\230g\300\374\002\365\n\230O\320\360\003\315W0N\301~b\371\002\313C\264\257\264wh\337\240>jp\n\203/\260WP\237P\0161<\251\367u\241\335\220\334\214\363\312\341i=Q\337\342\\\fps\r\200#\200xE\337"
+	.string	"\364\024\017\237x^\242\374\241_)g\350G\345\223\276"
+	.string	"\365\317-\351\r)wH\356\246\317p\236\005\177\021\267\016\"\335,\316\326/\250X\341\315\303\027\210'\350\371L\240_\317\341\032\310@\007\345vzG\326Cz?(\277D\317(|\255W\345\251\234\275\001\315\215rF9\353\213^\016"
+	.ascii	"1\023\260\324b\024,Z\361\206\370]1\356n%e\347\242\314\355mLL"
+	.ascii	"\312\207\335\036y0co\242|\305\f\032"
+	.text
+	.section	.gnu.lto_.decls.2850093ad8f1c06d,"e",@progbits
+	.ascii	"(\265/\375`QW\275p\001*gV\206U LQ:\215\001\350M\202\025\247\363"
+	.ascii	"U5S\020\203\303\261m\366oD\253\361 \266\nMg+\277\311\356L.5\233"
+	.ascii	"4\273\222\255\247\2011\002\017\020[\217\"\004\303\317,\302\341"
+	.ascii	"\311m"
+	.string	"y\234\327\354\362;\005\261q/\272\372\374>E\276D'S\255\311&\267\224R\2466\007t\bx\b(v\026\213/l\241/T\241/\\\322\317a\364\363S\313\3319'\227\231\230\305\317yr\371N??\321\265Y9\344\235\252\223\237\227\350$\277=R\337\252[\025R1!\242\304\342\347#:\353\344\303U\016y\r\343Ta9\233,~\016\323\377\200\314\236]\"R\272\315\006\217\347\336\315\377V\315:\253\323\032\261\3155#\226\210M\253xk\233Y\265\201\227\3757\026\270w3\304N\b\233\266@0-2F\263EpR\3508\221\343\013Z\026}\324I\2315\263Tj8\220\224\241F\364Q\037VH\235\322E\320\311\342\2433\264\rb\303\252\323\212\035\243m\355\264\275\2336\227\331\002\312\233\305\257 2\016\210|\024\206>:\245\257W9d\373e{\334\202Y\036\333\202\201\260\2657\323\202\341\204\331\233\211Sk"
+	.string	"j\r"
+	.ascii	"\036\353\342\321\226\361\321'}<\250\377\254\034\262\225\341\225"
+	.ascii	"O\004\273\203\206'RZ\026\037\007\352\343U\235\374\300\312!\333"
+	.ascii	"\370\261t\366\303\342c*\372\277\245Q\235\266\206\345:n\356\255"
+	.ascii	"T\303v\331\031\025om\357\251\003\b\221\312\003\2530\352\222\242"
+	.ascii	"`<\343\267YV\313\276\220\201\273B\005\304\342c\247>\366\241\217"
+	.ascii	"g\350?\253N\266[\225C\336\240\352\344*Uu\362\361\226\256\331"
+	.ascii	"\225C>\256\322/\376f\243\370e\005Z|\374\244k\263\352\344\337"
+	.ascii	"?]\341\354\212*\253\206\202\351\002JE-\263Tvko\245\275w\207\032"
+	.ascii	"\2700L-,\266QV\252:/g\247d\224\232;\355F\023\244\033\026\377"
+	.ascii	"\356i\030\366\336\273^.\013\007\007\007\007\353\345rM\325\311"
+	.ascii	"\225\315\347\026\352\302\3151\205y\342@+-q#\263\370\267)P\334"
+	.ascii	"\246\247\255\275\266wS\203\260M\310\222>\213\255\323N\355\342"
+	.ascii	"\305,\206\305\277L\364k\031S\345b\231\267\t\247\223ta=-SmV\274"
+	.ascii	"\033fsS\335L\211qu\025h\233\354\t\253d\223\354RuZ\246\352\367"
+	.ascii	"\372W\267\034\261L\025K}\3360\233[JX\344\305\fRj\225\033\244"
+	.ascii	"\346\216\312]0\256\256\002\367n\276\266"
+	.string	"\215\b\3012U+\225\3576\277\204\316\256\253\347\336\315\020!vB\204\ba\343\345\004\211\222\032l\221\322\352\362\332\266\305\277M=X\307T\247\335\325K\222*\3466\341\364[\327\323\323\356J\244v\271a\346l\245\256\024_3\1778\2562\016\263ccc\013\210\226\305\277^\372\265-n\360\257`\352\227\352\254\20250M\260*\251n7\314\246\006c\256\256\304\366\336!vB\334/iP\236\031\337\372\351[(\272v\371\253Y=K\333{w\240\251\302\273\362\302\342\021>\257\200Y\214\211\214/\026\337\266\351\272+\207\234Su\362\355\017]\373j\226\352\344\240ji\342\330\034b\330\212X|\233C\277r\220\357\340`\345 \337n\351\252W\257T'\006u\357#B\370EB\303\261\031#d\f\030\213o\255\364+\006\271\016V\f\362m\n]\253\330J\245\346\275V\251S>\"\204\327(m\262\275\233\265\n\336\233Yk"
+	.string	"nj\r"
+	.string	"*\247\203Y$\343\333%\375\032\250w*\207\034\205\247\246\215ikL\212]\205R\235\365\256\"!R\217T</\024\306\352\236w5I\255\253x^(\214\261{\356\275yB\204\300@"
+	.string	"\317"
+	.ascii	"3"
+	.string	"~\262S\203\"\260\314\342\3275\375\277\322\325\271\332\244\312UguR\227\3346\367^{c\362\326\026\207\244\236\301U\267\033t\357\255$_{\357\177\360\373\274:\251J\252\333\207\245\275\267\260t\230}(\304\004\356\275wB\204\b\021\002\307\211+\313o\006\277:\351\023\351\013\351\227\320\017\201\366\240r\310\347\200>\t\375\327\"\257G\252[\335\332\035n\252\324\304\256,\256iU\255:y\352\332+[m;\312l\356\346\336\033\247\376y%MY\234S9d[u\362\025\240=0w\b\277\321(\330\273\362\344:8XyrE\363y-\362\327!\225L'KY5\367\332\336\033\207\204\0343\306,\276U'\177F\337j\r*\207\214\253N>^\345\220\337\254\034\262\256:\371\377\007\232\240<n\nnZ\305rQ\370-\261\310o\217.\232\t\377\235\352#\362_\022\232\327r\267\272W\233\177U\341{\267\346\257r\265\256"
+	.ascii	";\247r\317~\033$C\004~\324\003\277\275\273Y\225\355\277\034\370"
+	.ascii	"\353\233\021!U\305\221\212v\201\232\200\277F\375W\354\006\371"
+	.ascii	"\357\217\377\356\370\257\r+ "
+	.string	"~\364\355\277 \374\026\004\\\377\367\376\252W\257\244Z%\374\027\003\370\377\376(\006\257?\332A\370\327\n\3457?\372\305\n\002\376V\356\312\370\353N\355\373\007\354\234\315\217\352\370m\216\273\365\327\246J\344\257)\234\202\256\341G[\270\036\374\366\003Zu\312\f\327r\225\250\024\340\f\370Q\233\337\336e\375o\362\344\257\031\315.J\265\253;:\027\253\326\271p\257\376k\365\337\026\025\312=\3701\340\226\374\243V\376k\271J\307?:\345\267U\356\212\337z\370o\325o\263.\325_\355\177\207\377\235\252\034H\375\025\311o\033\360\333\021\334\250\337\362\374W\305o?\\(\347_\357\177\237\334n\232B\355\257Hw\004(\376k\002\247\337\026\377\177\370\273M\377]\260y\017\370Q$\377]\201\351\267n\277=r\227\256\322_\261\f\335o\2077\3512\277B\001~K\274\207\037-\362\333\255\213\364\327\246\352\2445\363\243\017\370\257"
+	.ascii	"\376[\200\377\022\340\277\003\370o\006\377\r\300\1777\370/\210"
+	.ascii	"\333\301\265\371\357\207\377bp\367\377\234?\267\360W\374_K\235"
+	.ascii	"9\372c+\247\371\321\263\377M\376\233\202\213\202\277\346\277"
+	.ascii	"\362)\355\374\326\3565?*\344\277\340\377\300\217\371\037\246"
+	.ascii	"B\271\376Q\037\377=\301\177I\360_\240\377\212\340\277\035\370"
+	.ascii	"o\006\376[\201\377\246\360_\t\374\267\001\377\r\341\277>\377"
+	.ascii	"E\300\177;\370\257\001~\033\346\267\202\277\235\373\355\215\337"
+	.ascii	"n\371\255\337o\265\374\266\357\267y\277\265\362\333\031~\253"
+	.ascii	"\365\333(\277\265\373\255\223\3376\371m\334o\337~\213\344\267"
+	.ascii	"`\277\375\372\355\216\337\312\360\333\256\337\312\370\255\213"
+	.ascii	"\337\262\370m\325o\247~\253\342\267)~\333\364[\246\337*\375\226"
+	.ascii	"\371\333\375\333\023\3746\206\337*\377\232\342\257(\374\025\351"
+	.ascii	"\267#\370\355\207\277r\371\253\337_\025\360\327\251\337\n\375"
+	.ascii	"\225\357\277\013\377\335\376S\371\253\n\177\255\377\243\374\277"
+	.ascii	"\300o\207\177\325\360\327\n\376*\363\333\240\277\276\3756\375"
+	.ascii	"m\211\337\022\377j\344\257\034\374\325\311_\343\376:\367[\021"
+	.ascii	"\374u\347\267 \370\355\007\376k\371\337\366[\016\374v\003\277"
+	.ascii	"\305\340\257\200\177\335\362\327\277\277>\377\252\345\257Y\376"
+	.ascii	"\332\367W,\177\335\373\353\225\277R\371\353\224\277J\371\353"
+	.ascii	"\f\177\305\373k\224\277\336\375\025\312_\353\376j\367\327'\377"
+	.ascii	"U\370\253\316\377\026\376J\363\327\231\377G\377\353\376w\030"
+	.ascii	"\034\034\034\374e\244\376\034\026\277\003>\004Mi\\S;\215k\347"
+	.ascii	"l%\246\224\223\322\226\322\260\323\270\374v\332\326TNS\332\326"
+	.ascii	"TS\032\027\222j\207\"\354\311\212,\317\033P*R\223\322V"
+	.ascii	"\001\025\203)\225\203\327\324\334\332z{\3275\246-\265\361\366"
+	.ascii	"\026\300\3361\266\244\364\230.*\\\022\236\212\244#\314\255\332"
+	.ascii	"\334{\363@%umm%<\244\272\361\232~l\355\375#IhC\355\2757\bHM\274"
+	.ascii	"}\243\342!\315\210\261\237\230\366\366\260\233{C\355\215T7\336"
+	.ascii	"\336\033i\357-\224\212\321\334\373*\247\351\013\njo\253\035\250"
+	.ascii	"\035\003)\216io\273\266\0077\325\224\326\265\345\023g$\355k\237"
+	.ascii	"h\"\325\246\247\255\375\265\365\270\244t\032\022\221\375\264"
+	.ascii	"\367\256[\364\327T\325\237\305{\302 c\250\3245i\340\262\330V"
+	.ascii	"Xl\245\206\331\"\311\fJ\250\340*3;\305X\232\305\257\240\214\312"
+	.ascii	"\224\253\004O\017\007\240\305\315\rVa*\356^\235\370\016\343\311"
+	.ascii	"4\355=\245A\030\030\030\227\300-e\325\201\005\302\367\343\314"
+	.ascii	"b\034\005'\201\301D\210\305\257`\205~\005R \260\035\216L\336"
+	.ascii	"\026\2545\213_\301\t\374\304\272H\001Fe\3615\bb'\230\016\005"
+	.ascii	"\034\237\0244\213\177\334\204\255G\020\245(\213\377\301\216\352"
+	.ascii	"FC\360\371\203\357\253F\324s\357f\216A\033\365\251\342"
+	.string	"\213\f,\313S\007\r0e_\201\317\372'\303\030\037\261*P\276\264n|\005\321\253\1774^<\217\340\"x\r\223a'N\303m\230\tV\202\321\360\0316\202\227\340$\030\016\317\3412\374\206\2338\016\253a9l\206\3350\021\214\244:1\033\026r<\206\207\334*\031Y\317[\325\005\343\251\367\327?\0346\234\352\233\017,3*\337\rR\316N\262ru\275\374\267j\313\206\227\227\363\351\031v\327\326C\313s\357\346\337\215\352v\002\305\f\230\r\003\241q\345\251\343\367\341Q\237K_n\025f\303\\\233\2114\302\026\264\035\027\257\310\020&\021\260\205\253\034r\210\252\223\257A\211\276\206\036\372\032\264\3645L\351kX\322\317\001\324\317\241\242\237\363\246\237\023D?G\206~N\223>N\240>\316\236>\016\235>\216\232>\216\017}\234-}\234&\375\033.\3727x\3727o\3727a\37279\364o\256\364o\222\364m"
+	.ascii	"\365m\370\364\217\2630\026\n/yI,\216Qe\004\2313b\361m\350\364"
+	.ascii	"+\031\013|\002OU</|\367\366\364\022\230\344LL\345s\373\272c."
+	.ascii	"\230\266\257;\310\026\202eR\371n\356\336Yk_\030\006\276\302T"
+	.ascii	"x\005~\201\255\260\013\334\002WU'f\201\227\216\231\254\216\253"
+	.ascii	"\027f\354\b\336X\251\342Y\221 v\366\304,\356\227\013Fx#\216o"
+	.ascii	"L`\210\020ukl\212\327\006,u\313\240@\351a\361mt\350\377X"
+	.string	"\005\206\252N\034\205\233\216S\3340s\366\306\221\345\211\243*\021<v\345\231}ly\233\312\370\265\r\243\300O\330\251:q\n\245\276/\234\242*\251n3:z\354e%\315h\200\321\3705\200\3725U\364\215\022\215\2210\263:wp\222\224$\0251,~\215\233N\301\256;\371\203u'\277FM\277\306L\277&L\277\346K\277\206\306\025\304-\240\320\330a\361k\260\364kX\350\327\244\320#T\016\371\277]. \0268\3002\213\233\3155\265\265\270\023\\\214\354\335M\031\263\345\017\006\363\215\207\305M%1\254+l~\333&E9\227<\305\320\"O\306\230Z\244\204<\230\314\311e\261/\314\240^4\365],#\324\360[\2628Jsm\357\315\243\223ZH\211\343\253GLXY\231\355]\261{4\222,\345\375^\371\257\225\253W\371*U\023.\036\026\203\250\0342Zur5\363\371\315\3033\272D\201U\301"
+	.string	"\247\331\002j\006\225ZE8d\256km\212\335ZN\f\235\022)6I\022\213.p\006\036aX\234V\r\274\274e\215\212\212(\266\205\n\245)w\226)\004\244\302\366\004\312\265\253nnjev\025o\346\205\224\013\033ut8@\362\230<Y|\351l\214\253\204\331\367\345\202\316^\325g\305\363\202"
+	.string	"Y\226;w\233\\'\367Iu^\272\273\344\227\311\225\263..\235\265\262/n\224\232\033I\004-WW,\350l\213\021\201WW\20180\214\214\245\315`\233f\345\220+]\325\311\257Y\322q\302=,\301)\213O\023F\333-+c\211\237\231\235\363\302\335\264\353v\327.\333Mr\217\\\"\267\3105r\321.\222\333v\325\252\363\276\335\245[\027\026\206\305a\201\330\261KDJ\273-]}"
+	.ascii	"u\251\324"
+	.string	"\236\276\366n\342\260C,\033\263\013\304\222)\253c\207\005C\362\003\261$\356V\275\335\025\177\253xk{\211\310\001\342z\230\331\005\332\037\265J\013=\314\354\304|\214\b\341\276U)\265\312m~\t\215\320\210a\261\356\333mZ\257\252\r\344\220\314\354\002-\334\357\233]r\231#0IQ\200\206\212\347\336\373\355\272\270g\037\222\232\366\246\002!n\312\342\310ae\250xV\233\211\004\302\222\031\314\354\002\255\333\233}\253\317\333\204\323'\324\242n\322\333U\272O#0I\311\250P\203\262m\277u\273o\026\211MR\361\274\366\236\002a\t\222\231]\340\314\324\030\027?\r\360i\214\350k\306\2033\303\006\263\212\305\247\t\242\255.\214\333\374:!I\305s\354\226\335!\325y\311\224.\331\215q\277F`\222\302@\022\324\223\354\n\271\335\207\244\246\315\224\341A\217/c-\260\021/'Z\032\177\006\214~}\363\342\251x^\020"
+	.ascii	"s;\323!\344Y\377\276.\326\265\361!\251\311\002tG\352\037\216"
+	.ascii	"\313\335\310\354\315\265\366E&\303\330\263,\007\210\212\267f"
+	.ascii	"\002\034\331s\357\346\327\335q\271\033\245\234\255\264C\354Y"
+	.ascii	"\377\356\327\275\301\223o\334\b\362\025x\203\\\261\333\343\002"
+	.ascii	"\271>\356\217\033v\301\252\363~]\036!vP#j\201`*\300\237\t\242"
+	.ascii	"?\303C\177\306\206\376\214\226\376L\013\375\231(\375\231\023"
+	.ascii	"\3722bj\354X$-R\242,\276\f\026\375\377v\335\031\325yi\\\255\254"
+	.ascii	"+cF\337\327\245q\271\256\214\n\372\256\344`\022x\223\360qQ\313"
+	.ascii	"\37029\364\177el\321\214)\303\032\263u\265n\314x<\315\260\370"
+	.ascii	"2U\3722O\3722K\372z\214\2760\376\313\342\266\260`\"@\331\234"
+	.ascii	"\352NX|_\370\374^-y=QY\314\201\027}\375\247m\263r\310 \252N\276"
+	.ascii	"\266\2425\250:Y\352NEi\035Ub0Q\"\0255em\353Y|\243\236%\357!\315"
+	.ascii	"\t\272\335\024NaZ\304\361\260\370:\210~u^\024\327\t\311\017\247"
+	.ascii	"#M#B\250Uj\366\207\032A\273\273\025\026\037\360\236\370/s\223"
+	.ascii	"g\366\266\304\342\377\236\270L7PR6\327e\272K2]\364\304\f\261"
+	.ascii	"\370Z\207\276\256\241=\250:\371\"Y\2762\027F,\276\276\032c\007"
+	.ascii	"\253\363nKw\033g\225|\347n\313\3046\271Qj\356)\341\225\347\335"
+	.ascii	"\326\211\rS\361\254r\266R\0261\317jdn\314_\306}\366\013\226/"
+	.ascii	"0V\320\212\251N\033\3466\214}b\247\334 i\330\273F\230\2570\226"
+	.ascii	"\212\345\273Qjn\252\254e\357\020<!B\320<\321\300B\322\330\213"
+	.ascii	"\r\254N\373\305v\361\263\200\025\317\252\271\251n\334\266\300"
+	.ascii	"\220\005~\261Y\354\363CR\023\nL\370\236z\t\016&72\276V\241\177"
+	.ascii	"\013x\313\305\306\351\315\207\225?\273e\206\205\025\036\023\213"
+	.ascii	"\257\231\372\357UE\217\245:\213/\374\242_\235\357\263Z\236\005"
+	.ascii	"\347\260kQf\361\205\\\364\205}\372\302+|\266\212\325\253xk&\334"
+	.ascii	"ey\356\275\367,\226\352\264|\366\n\237\255\253|\025\317"
+	.string	"\212\204'Z\2367<|\f)\313\370B(\032\207)9\241X+6o\333\330d\301\222\373a\361\205K\364\205G\364\205k3X)\325i\247X\274\235\346\336G\246X;\033\345CRS\nY\202O\262)\266\256\362\321\360\370\002C\026\270ws'D\b\341\f%g82\276\020K\3776\312\335}\321\204$L\023mbEE\207\305\377\253\323B\261t\315\275C\263\027yKu\276.sy\023\347F\311\t\266:\213\237\301\231~}]NA}]\316Z\236\237\277\214\214\222,\032\\\026?\2030\375\347,\277\214\260-\017\306\227\305\317"
+	.string	"L?\203\034zz\231oGo2\272\265\347\205!\366\305\217o\357\226\3210{\333\273R#\245/J\333Ej\242>\222\234\314\260\370\031`I\221\222\363t\234\272\274\b\326\245%!Q9/W\271\251\241DM\254\n\225\032];t\330<\361\373\2424\3056-[\226\f\\,>"
+	.string	"\362\236\374I\306\253h;\352\003\244\275,\2331=\024NQ\236\361\332h\374\210bq\256\313w2YHFh\334A\361B\0067F\nN\214\235T\266\303My\213\236\216:"
+	.string	"\250-Y\222\351v\266\356\225)[\244\304\204J\260\270A5y\246\313b\243\252O\311\342<\207\"\001t\032\2618\313U\276\300\277\"=,\316L2Z\037Y\217."
+	.string	"XB\202$\307\355\364@\323\316\266\0300\340\236\343\262\340\240==\371bq~k\342t&\306\342\234\344othH\236~nw\273N;[\327JU\226\030h\034\2208\035\026\037\0031\2473\263m\350\321\265\327\345LPJY^{f\263\001T\3033\303"
+	.string	"\305\331YV+\303\313\003\013D\233\203r\"\247=\253\321"
+	.ascii	"\331\022\327\2648\027y\022(sc\262,>`F\013\254\203\021$\243e\""
+	.ascii	"}xb@l\314\275\001^iZ.\2346\326f%LXX.\373\340\203\013\fU\215\225"
+	.ascii	"g\237\225L\366\\\366\326\304\004,\2638\213\345!\377ep\272\330"
+	.ascii	"\256\264\310C\362X\334\f/\246[M\030\030\177V\262\020\364\354"
+	.ascii	"\376\340\032\303\373[\005\222DH\333\236\017\037\031H\006\252"
+	.ascii	"\362~\320tA\261\245\351\3073\020<\345,O\017\312\177\231|\027"
+	.ascii	"\025F\360\214\007\217\334\243\242\355(\005$M\311\022\333\333"
+	.ascii	"\n\204\275\332r\207\343\353\271\307g\3060\371\271\325\375\227"
+	.ascii	"\361`/\307\016\213\377a+\353\310:\320(\025mG\355\370(\"\305*"
+	.ascii	"po+\020x\210\025\2507\213\177\301S\3779G\316aQ\200\310\331JU"
+	.ascii	"\260\340\234`1\217X\374\013\232\214yNqY\334\026\325\211\216\311"
+	.ascii	"7|\2226\323\fD\334_\214\016pr\204=\351\260\330K\310\264\222\347"
+	.ascii	"\304\342_\320\246_\311\236\262\n,9\212\217*\257\250x^\020\b\022"
+	.ascii	"\345i\3532\324\207\244&\024\310\366\236{7e\344\0269+I\3403\313"
+	.ascii	"\310Sz]\331F\256\221g\344\255\314\225iTg\226\221Y\370d\031Y\n"
+	.ascii	"\207\313\020\247\213\034\374\364\276\017IM(\230e\254\254U\235"
+	.ascii	"9\353;\037\344\254\354\"\307\240A\262e\210\035O\b\233?*z02\376"
+	.ascii	"s\214g\030G\2326\266X\234\257\254\\\324-Y\374\013p\350?[Ug~\241"
+	.ascii	"\001\305\342\300\364\375\227\241i\202\243\313\206\376\0052\364"
+	.ascii	"/X\221\253t\225'\326\235\305\277@\205\376\005(\364/"
+	.string	"H\322\3670F\337\303\027\375g\025\031*\355\t\227;\213\377\fU\371\240<%Y|\017\200:\237\310N\031\305/\2033\006W\303\315\342{\350\323\317M\377e.\200#\212\233\305\270^.\347\245g\246_\306\326\361\370\202\262\370\036\364\364sRV\372en\364v\260\021\261\370\036\360\3643\363\277\f\3526\310\345\205\305\031I3yP\302\301\fV\022-\030\350\3403\322\237\267\365a\301b\030\024\343\305b\233\252\223\255\n\237\243\2034ws\3173\213\357\001\210F\303\240aH\350!\370UW\306\244d\361=Xi\024\005D\273d\254\372bkE\236\305\250`\r\337\224$]\320@\231!]P\320@\324\213\2226\263\275(L\314\266\031\332\245\"\021R\34159a\361=$\351-[P;\024\344\2307h\250\370\263\370<{\332\317\017\215\2427\317\022\260\275/:\350,>\317\234\376Q-\257NT\013\346\003\261\265\251@"
+	.ascii	"D\333\241\235\246\320p\263\370<i\372G\257T'z\005\355\263h\033"
+	.ascii	"\351\206O\006\337\030\031+c\312\204X\214\366\375\350\036\312"
+	.ascii	"\207b\251v{H\270j\264@\371Zaq\305\253\034\362\207\252\223\317"
+	.ascii	"cc\nje\n\232G\205\n\232\247\2218\b\221B\003\247\365#\254\312"
+	.ascii	"\321<-(\250\254X|\300\372\374/\203\317|X\325\260\370<Z\372<R"
+	.ascii	"\350\f\350\fh\224\032F\005\306El[Y\201\260\361z\343ba\361y\220"
+	.ascii	"4z\207\336\241Q\032P$\312s[Y\201\250Z\350V\320Y\034\005\225\362"
+	.ascii	"cG\233\225\272:\324\016\205\275a\bW\315\333\023\256.\213\355"
+	.ascii	"v\224h'N\260\340N\230\022l\304\354\254\313\342\357\fY\2026Y\202"
+	.ascii	"\316\241LP&\350\\\335R\200\371\005\230\020i\b\023@\271\243s6"
+	.ascii	"|P7xX|\300'\3511\347\024\304\342\357\310\320\337\331q\325\211"
+	.ascii	"\306\331\027Yj\002jY\035\364\364\217\276U'\372v\271*\245\235"
+	.ascii	"KZ\035\216\350\037\375Q\235\350\017\024\211\f\trRP h\020\364"
+	.ascii	"\210\245\251a'he\261\233F\202\243+\314\342w(\323>dN\204\300\200"
+	.ascii	"#\0233{\3423\304\311\255j\336=1\013\342\344\031V\277\346\236"
+	.ascii	"\214\375\355Ffo\272!p\0335\202\246\241k(\033Z\004u\242m(\021"
+	.ascii	"T\255:Q4\364\fEC\313\376&\203\220\217\n\fU\b\032+\270&\275\r"
+	.ascii	"\370\035\262\364;D\351wx\322\357\340\244\337\201I\277C\222~\207"
+	.ascii	"\255o\201\030}\013\004\365-\360\2423\226\252\223oA\037\n\206"
+	.ascii	"\202)\261`\206\257\257z\344\250\322\236!\366\265\267U\0076=\306"
+	.ascii	"\324\222,\276\005u;vT\276\212\266\243fNPu\241\022\243%\357F\030"
+	.ascii	"\r\024\007\rT\0064\307Q\031\320\032h\r\364\206F\342\031TBs\225"
+	.ascii	"\304%\206z\035\275!\\\252\001f\205\305\250\r\254\367_F\007\001"
+	.ascii	"\024\204\263@\207\276\0051\364\217v9\321\256{\245\242m\244\025"
+	.ascii	"\330R\374\b\334\333\252\203\332\344\257\307\235\305\267\340\351"
+	.ascii	"\005\272\365\002\225\221\367\256\315\255(\251\003\036\225!\323"
+	.ascii	"\303G\327\223\305\350\025z\205ji\244\rM\230\226L\311\255\f\315"
+	.ascii	":\252\205\306\270\002\004\211\305(\f\024K\370\0020I\030\212\205"
+	.ascii	"\306\250z\317/^qX\352\252\f\311\373/s\271h\031ib\361-`\352s\360"
+	.ascii	"s\341\002\214\204\275\034kIX\260\250U*\332\216j\201\013\214\213"
+	.ascii	"\230\326\322\017-\026\237\203\227\376\321*'ZU\253\354l!\371y"
+	.ascii	"\260\004MW\021\202C\312\342sH\241\177T\n=\201N\331\252\272\231"
+	.ascii	"\244*\020\225\342\311\301I\237\303\022\024z\002Ua\231z\303i%"
+	.ascii	"QPO@\375\rS\364\253\220\212\242@O\240)l\022\274\275\366\246\362"
+	.ascii	"\361C\333\035|\203\234\376\0065\375\243MhS}\202\330b27XB\005"
+	.ascii	"\306%po\272\016\360]\224\033\226\305\337\360\245Q&\224\311\217"
+	.ascii	"j\203\223\376Q\245W'\252dQd`\357\0320\016\020\367w\375\266\220"
+	.ascii	"\024\261\370:Y\364\2172\235(\363\332\335\246\315\354\"A\016\314"
+	.ascii	"N\377x\020\203A\267\255\202\200\217\023\251\016\256"
+	.string	"\363D_gN\037\203\251X\214\023\213\251O\020\233\311\334@\216\252\331\301u\330\364k}f\300\003b\301\272\367\336V\033\311/\204&\177R ~\374\345X\020\347D\027\251$\201\225\251\246\342\031\350\305\002N'[,R\315\023\237\024A\334\245z\001Re\307d\361ur\350c,\270\3578\313\263\340-z\357\215\324\334Q;gh`\\\002\267\225\025\210\f\204-o\013\377\035o\251-n"
+	.ascii	"b\277\37725^\352\260\252\374\360S&E\030\026\027\326\311\006\360"
+	.ascii	"\t\354\tk\251~:K\013-\213\257\003\245\377z\373\347\315\224\332"
+	.ascii	"{S\241\315-\225T\223\377\372\212\326\n\342\267\251\267\n\340"
+	.ascii	"?\336\373\002'\354\255\244\345\271\367\256\\\264\2177&\f\r\366"
+	.ascii	"\377\037\305\333[\211\013\t\002\\SJ\\.\232\322\270\24644\245"
+	.ascii	"qm$\245\035H\032\2446\027RS\332\336\032\224\224\220L\330\232"
+	.ascii	"jJcn\rMi{j/I\231\252\273\311\205\264\225\266\266\206\255\264"
+	.ascii	"\231;mkJ\203&%\256\251\2464\346\224\206J\"c\322\005\013frt\226"
+	.ascii	"\312d:T<\032\"\036\215'\0341\2404\022\340g\231*1\270PO\320\321"
+	.ascii	"\230\\*-\030\0322:\036\221G\341r\230\306`T\346\027\220I\241%"
+	.ascii	"\362(\004\"\246Cx\231*\211R\242\2544\212\300\205z\226\306\243"
+	.ascii	"Q\205\344\t\032\\\250\347'ID\226\020\261A\013\036NX\301\002K"
+	.ascii	"\3431\005\235\013\365\244$ "
+	.string	"\002\205 \221\222\200\bds\241\036\021\037~\322\241\022\304\243\004\224)\244I\243%1\005\312a\301\346h\250\250\210\204\206aJd\\\036\215\222\"\212@\031,\323\026f.\324#\002i\354\220/\324\023d\004:\036\001\031\227\310\013\374\034I\230 *u\216\212\220%\354,/\324\023T$\"\250H\247x4\2429\002YT9\f*\252Y\016\217AE\3501\250\350\n-\203\216\351PNc0*\361Q\021\262\210\223\313\242\373\223\n\177R\245\021V\n\237\034\006\025\365\330\034%\227JcP\312\002\361\003q9\224\232@\342h\250\250\210\370A\271A\231B\261H\334I\022\227-\024\213D\035\rG\304d\222\304\007!\361\206\205b\221\310\363\223\036\3234\002J\"\n\305\"q\003\013\313T\231&-\340\t\"&S\023$\216H#\211e:\201b\221\250\201\262\303\362h\204,\341']\022\207\214\210\214\212E\342\005\313\013\365"
+	.ascii	"]0\342\310*\207?D\243\022\030K\334xP\302\372\224\260#JX\037\242"
+	.ascii	"\035A\264>0\330\0210X\237#{B\261H\224\211\001\205\245Q\t@E\026"
+	.ascii	"(\026\2114\350\205z\202\214J\244?\"~\206\214F%\322\037\244\n"
+	.ascii	"2\305\"1G\371\223\376\340\310x\320\263L\022\213z\226\305"
+	.string	"t\231C\204L\256 \001\t \227\251\tb\013\002H\217H\023\222FJb\252\002\001R\023\306e\221\304\021YB\261H\342C\211\352AO\211\213\343\323CdL\272\220\016\005\035\211\032lF\364\374\244&\210\312!\316\006\022\307\024\n@\224.\225G-\f=h \326\017z\210\227D\320\261\246X$A\224D\002%\323\"\f\206\307\023\226\2512e!\250\b\203\027\215\311\364\230\006\351\203 \002\002D\030\001\006\341GX\200\007\013\360 \177\204\005\370\370,@\004\037}\021|\356r9Tj %2.\365\206\027\227\305\"\361.\207#>H\207\351\017R\205dZ\224\246%j.\324\203L\036\005\325\270\260<\246D\251\t\244\n\310\344Q\220\006@EC\303Ti4D.ib\020\032\342\304 \224\343\3433b\030\203\320\206\021C  \344\322\250\270\004B*w^ \036\r\227\251\022\b\b\211\363\002r\b(\231\232\300"
+	.ascii	"\t\212\251P\321FCZt\264\034\216P*\211E/ \207\206G\311\324\004"
+	.ascii	"\262\230&5\374\f!\205\224iRh9|\201xT\201\221\t% \223GA\035\206"
+	.ascii	"@EC:1\b\ra .\217i1\231\026\r\205\226"
+	.string	"?\306\027:\224\200&\006\241\341\321H4\024*.\221\307\341\361\350'Gi\204\2018\f2*\221\376\f\223\351r\310\202\237T\211L\036\005\331 \201\214@Cd\362(Hfy\241\036\023\351\0172y\024$\"\250hgy\241\236\3451%2\032j A\204\\*\215\2128\310\344QP\005\031\206\364\347hD\225F\0210\026)s\020\321\205\243\262\230\225F\021(\2160\222(\2160\316,\207AD\027\220Fa\020\321\005\343\022\206T(\243\034\026\213Dty\241\036\002,\217)\021\316\022g(\274P\317\262h\224\\*G(\2070\244K#\"\r$(\"\207\206\303\274<\032!\213\303\2410\231\036_@\016\207Be2U\032\035\207C\375s4\222`8\314\312\243\261H9\034\n\207\322\341Pf9\\*\215C9\027\352Q\246EGK\004\374\244I\242\220\022\001\"\224Kc\t\021F\307 \004\300`t4\016!"
+	.string	"\004\021\206\"\214"
+	.string	"\203\210\364\307h\250x4\212H*\215D(`\tCz\034\"\036\223\351\362h\034\376\020\323\244\320\262h8\354`\"M\026\r\207y\2514\016\r\207\231\270$\376\f\2079\215\301\250\034\0163\t\212\310!\\L\223\303\t\370,\215\307\024\216',\215GcN.W(\036\215N\370!\246,\024\213$6(\207&R\023\212E\242>\236\360CL\223y\251\034\032\213Z"
+	.ascii	"JMH\213\216\\\030\246\260B\0134i\361H\\*\217F\275\034b \005|"
+	.ascii	"4\256pT\026\263\261Hy\225\303\022F\244@S\302\210\024drq\204\361"
+	.ascii	"^\250GiT\202G9T\341''\231.\225D\242\254T\246\311\237\037\242"
+	.ascii	"05A\034j\301\250\210H\033\rM\244?J\243\022Z9L\213F\023\251\t"
+	.ascii	"J\243\0224\3510-:rAiTB&-:Z*\215J\b\225F%\356\004|\206\305\"1"
+	.ascii	"\277@d\241\004\023H\344\345\205z\214\212\210\206\310\344QPj\302"
+	.ascii	"\230\3741@:d\301\203\020<\020\301\250\210H\347\2104.\215\206"
+	.ascii	"\220\31249\243\034nH\207-\030\025\021\321\344\345\220\2212e\341"
+	.ascii	"\2104.\213\35125\301\250\210\250\202tx\f2\016\021\2077\307 \343"
+	.ascii	"\020\211b\221\250\217~\210)\013\304%\361G&I\024*\342\364\007"
+	.ascii	"Y\302\021iT\032M\244\311\232d:4d\004\312\313\013\365(\205\226"
+	.ascii	"D\"\021G$\021\021\262\350\201\250*\207\303\" \035\030\214\311"
+	.ascii	"%Q\205%2yc\"\375\2711\240\220.\211,\244CEDDeM\t&\220(\026\211"
+	.ascii	"9-\0361\260T\022S\013,I\374\244K\342O\221\006\206\322b\221\204"
+	.ascii	"\322\310\263\034\216\370`y4\n\227@\351\317p\331\341B\002P\032"
+	.ascii	"\r\205\212K\343\n?G\022CC\310\244N\005\312a\220\021\350\210,"
+	.ascii	"!\231.S\"\244\216Ah\bT44,\026\2113\313\341\b\313\243\321H\230"
+	.ascii	"&\211/\374$\211CHd\004\206hR\t4\024\n2\n\r\213Eb\315\022(\375"
+	.ascii	"\341\271P\017\006G\026\245I\021K$2)\202\346']\246CED\310\022"
+	.ascii	"J\030\207\210\305\r\312\013\206\206\220I,T\\\032\213\320\027"
+	.ascii	"\210GW\231\032\r\021Md\243\241\222\310\230tAY4\022\021\217G&"
+	.ascii	",\205\202\214C@\034\226C\021|\226G\243\360>>%h\240\201\013L@"
+	.ascii	"\027{\216H\343\222\230L\207\322b\221(B\231D*\217\251R\304\321"
+	.ascii	"H$\022QL*E\364\004\340\005b\362\"\223\351\007"
+	.string	"\212E\242\360\302M\223\267\244K\225\264\314\206\243\267E\343\251\b\026\024\242e54)\034L\204D\312l\200\335eY,\034\"\034\"<\253[J\214\024\241\331\205g\007x\362R!,\303Q\022\263A%,\023\222a\"D\310n\360X\030W1\222\f\216\321\321\034I\363\021&D(&6\3704g\231\226\206H\021\206\t\203\260\005B5\2178%]\321\263_\377\022\376x\005\314\275\223\366\316\302\"\001\020m\307\230\037B\037tf^\210\370\020\202\355\273+\316\275\246\265\202\"x'\354\201\205\224-\341\220\342r\343\206pG\016\031|c\2048.\334\241\203fH[3K\207\f6p\210\201\305h\3461\255%R\2049\360\222\f\214\"]\240\310\261\210\033\002\305\342k0e\306\f\241\215*\365'\"\311\353\352*p[\255"
+	.ascii	"!\264!\254\301\204\031\267'\254!\244\201W\314-\351!\244\313\025"
+	.ascii	"8\213\257\301\233\376\205]\031\bN\303\362E\f\027:\247\346u\246"
+	.ascii	"%\224\201\312\020\226E-l+\3670\022\306\267\246\205Fa{\341\325"
+	.ascii	"e\2610\206\020\353\302\254\013\263\2540\353\016\016\3462*\316"
+	.ascii	"\214\205W\302\253\332\204\013\214\213\330\r++\324N\306GN\203"
+	.ascii	"$a\013a\0134J\335R \bQ\222A\025\375\013Y\240y4X\360\256\224\232"
+	.ascii	"b@r\302\243\n\325zf\021R\205\312z\231\215\2215\205Sx)\216\004"
+	.ascii	"Ja\276!_,n\222EE\345\330B\373\346\350\220,\261\270I\266w\363"
+	.ascii	"&\007\221\341D\334S\236\330\323i,\005\037^\340\022\026\212,\346"
+	.ascii	"\006\357l\360\206\223\260\351\310\222(:\333T\332\302E\216\311"
+	.ascii	"\211\034\207\215Ha\022\302\204\"\021~\241\315\240Z\252\317\354"
+	.ascii	"b\t\214\233\022\306\303\301cG\214\244\243G\276\210i\022\204\211"
+	.ascii	"\312\210\300\337\023\r!\022\336\362e\020\013\314\306\271\021"
+	.ascii	"\234\022\345\305Z\2330\"U+,\356{\366\353\313bn^\315FB\333Q\302"
+	.ascii	"\267\2721d\201\273\311\n\004\r\221\024Df\b|\026\363\034fD\b\357"
+	.ascii	"\023\013\222\307\2648\203\371\215\025\024%O\213\237\277d\301"
+	.ascii	"_f\306\007\215\2640\213\237\201\021}\004h\264\026SS\026g/\357"
+	.ascii	"\263?\372\236\374,\316].ge%\320F\006\274\353\232\222dq\376\013"
+	.ascii	"\206\002\250C\202\203jL\256\305 \214\203\n)\205\210\204f\232"
+	.ascii	"t\203\025@ HP\034\022K\247Iw\023\200\003\314\213\264q\034h\035"
+	.ascii	"Cf\206DD$\005E)H6\016\n \250\305?\233z\177+\316=Z\226c\322\223"
+	.ascii	"\232`\232\360\253\004ZY\252N\267;)\003M\334\037v\340\260Z\300"
+	.ascii	"/l\252,\033\2267\003\355\350\301\317I\300|h\330\2710q\372\236"
+	.ascii	"\212\246)\263\003\206!\341MPR\244\320y\247_\027\345\275\215\231"
+	.ascii	"\b\3113\202\342\036\214\210=c\016\226Y\3234\244)1V\022G\250F"
+	.ascii	"\314)\t\231\004\305\315\034\373\315\375\317\222Nb\306\n\203c"
+	.ascii	" xN\332\206D\250,e\353bU\325)\200y\243\375"
+	.string	"\312\263H!\323nK\343\242S\374@\215i\254E\t\301%!N\355\016\266\364s\245g\351D\022_uW \261`\217\263\340\024Xy\006\311\247~\203\362-\b\013~\217\006\341M\205wF\0347\336\310\2621\326Q\266\216\276\345\310\377\257\321\354\215\030\266<l\0056IgW\224\224dv6g\357pt:\217\305\001\245'?(\230\002L\224\241POS\237\300%G\257\221p\200<5FR\025\357\013i\212i+TR\rTA\b\r\321<Ca\316\200\351N\306([\030\0370b\020\3463\250P'\270b\036;\211\304\353\373-\250a\315LCc\376\276\211I\004d\225F5\314W(O\357\\\221\237\211g\3573\233\264\350,\2077\267Q\375)\006\304\275\271\f\204L\032*~\315\342\n>\360\331c\236J\034\366\001\rV\002\377\243\256]\224\313\276\177\034\222?\352s\b\250\366~=\002m[\"\352\336\327n"
+	.string	"~L\202\020\205F\230s.\244\245\032kz\244\353\240\313^\223\227\333)C\213\b_\032x3\273\334\n\203M\233xT\363\300o\315\b\342\366K\337\254Z0\252\261\3762\032\337\320\024N\020<\"\207\332\202P]\250\260\242\224PU\301?\255\271\217h\001{D\317\247&L\236\226\325\025\222\352\200\220Q-\327\3510j9\240\002\377\310q \203\272\331\244\274t=mJ&ju\265\027\n*\307]\303\372\360\027\320\250\036IN\222\267\2066\202\336\235\361\326\266\027\365T\320\205\001\372\244\312\202}\373\3106\345\330\032@Rp\021\326\353\004Q\272\017bV\t'\225'\320^\rE"
+	.ascii	"\257\027\301G#\337'\351\206\226\333\226\220\372\204\246\025\231"
+	.ascii	"\230\210nk\262WA$\201\315\330$C_\351;\t\225\022\303pfG\205\315"
+	.ascii	"\347\026\344\344\314\033\222\336\336\235\306\345I\302\242\347"
+	.ascii	"a\320\2563K_j\234g\214\024E\247\f\351J\331\035\312\007\343\036"
+	.ascii	",\217\204\203;3\362\271AP\211\222N\227\361\356\2760PZ\327\004"
+	.ascii	" \317\322\212\243\251\013\rM\006\256\004\274\251\035<\026}\261"
+	.ascii	"<\001\034F\367-\016)\244:\326\370$<\bX\346q\t\220\2129:K\234"
+	.ascii	"&ig\354\275f\033-\tD\302\320\310\263\354\232\373\262\275\020"
+	.ascii	"\341\365\t\270,\361:\206~\343\327\032N\257\217e\261Z\267\034"
+	.ascii	">\271\327O\322}\236\027\232"
+	.string	"O{\327\346\036\237^\245\372G\tVC\243\322\250RBY\275\305\016\037\300\022\036\215j\032\254,\347c\220\364\320\264\236\247\034\366\315\314n\345W\177p\031\241\001`\351@\342N\r\341\347\260(3\215\271\bpz\371\323\364\364\313\363\356X?\322y\247P\324\250Q\bO\377\277-\240\253\375:\213\377\341\323\300\350A\316\317\213\373\247\250\323nf\361h\021\376#\2451lL\232\030\251\211\tk\013\b\320|\261y(s\335|\367\353\346\323\020m\342!\036\3746\036\007\260\230QZ\325\211\261b\301\255B\002m\t\300\33192\027\207F\263?\216\203\002\340\261\240J\317L\215\203 \251\276nK\367R\021=Es\337)V(_`l\240\327\246b5\231n\265\210t\324tEU\273j\241\230\250_>\342R\207\236\013e\244>\200\247\223\b)\211w\200\007\324S\036\213t\347\020\231\235\300\244\"\213/xtJ]!B"
+	.ascii	"\243\231\004\302'\222\202\271\215\"^\210\250\357\273\212\345"
+	.ascii	"4\021>\2364p\344v\237\335\255\376 \371h\207\321\345 /\364d\207"
+	.ascii	"\330~\325G\254\225\372F\344UA\361a\030\n$\357n\024\316O\213\246"
+	.ascii	"\216\234\362\314\372\353\213\021\313\001\367YjN\212\373\002\236"
+	.ascii	"7#\f6\355\364-\371\224\334\034\230R\25556\037\306\006\263?\213"
+	.ascii	"\254T\237\260\334\002S\2607\276\350\001\272\251\262@d\213G\267"
+	.ascii	"\003\307\274\223\257\233\312\036\354\324\376\334J\267\2071`5"
+	.ascii	"\331\255\030 \nH\266\301=\177\216j\306Xl8\200@\\\311GT\005\202"
+	.ascii	"\017\374H\216\036\030\346&\201F\361\304\2228G\264\343\206\373"
+	.ascii	"\275\353\277\245\r}\221wz\333\362\346\016\026\fh\334&a\to\260"
+	.ascii	"\303\f\366\001\340\352<e\bk\371c\355@M\003\b=t\264\332;g\223"
+	.ascii	")^\310\317J\343\fy\306\350\211\256\350.\016,\307\256X}\313\355"
+	.ascii	"GD\327\")g\225E\261`<u\311\357\343\340\240p\201\207\201L\270"
+	.ascii	"\342\270\21504\321G\202\257\004\2268\\\306\255\027\3131\n\363"
+	.ascii	"\352\375\222\031\n\346"
+	.string	"\340\f\202\315 0\227\327\0171\372i\376\023~\277\311\336\"\005\375?\364>s/.\177\350%\002\235YKh\276a\215\027_#\244\362\217q\245\205P\004mN\253\313}jD\361\301C\337\341_\347\00501\235\331\"\365\345\216C\301\024\267\t\343<\305\016\250~\202[\376\243\253<\347\222\302\255\302\002xP\306X}:\314+|\310\205\340DIQA\223\315\235p\233\236}\201\241\355\252\006\206\226\272P\3236L->7\3138*\222\271C\f\002\302\312i\314R+G\026\227\312]\320\245"
+	.ascii	"\2529\363\3076\225B\177m\017#\245\266\263\211 \006~\237~\336"
+	.ascii	"\375\301`\265\213\020/\304]!TX\251\322|$1%\263\026\351*\377c"
+	.ascii	"\021a3\021\f'\321\303\272FK\305\357\\\022\224\032\016:\327^A"
+	.ascii	"me\241\f\rn)\253\253\202\035Z`-]]\361\350\303\230\024\212G\316"
+	.ascii	"U\372KqT\r\255\034\331\304\312\336\207\273\362\216S_\370\270"
+	.ascii	"E\264\351o\277n\270\320\312:f\301X\373\373D\210~\2543S;\374@"
+	.ascii	"\245\250\236\221Y?"
+	.string	"\016}\266\235\354\334\031\315\353\232\216u\022\237M\216\246\026V-\340R\033\352\316\210\256\250l\\-e4_\020\366w=E6\211\312\2250\0256\024\b\301<c(PN\340\253\314\"\300K~f\330\242T\311w.1c1E\323v3\037\320\245\036\271:\265\372@\260\331\2221D\027Oj\253s\243\nW\017Y\323`\365\240\255\207L\212=A\352d3\332\274\252\204\3340\245L\301\211\307\371\375\272\250\263^\230u\f\223\3323'\276\334Aj\331\263\217\305D\232\270\361\235>yIt'c\250\260\215\305@\005g#\024\245|H\337\272 r\227/\355\223RJ\256\025\202\335\220Xx\337#\215\271\262E\366\343\355\307\0204\223\350\271\266\240\371\304\216\265\327\232i\252\020\350\370C\277B\240\331\214\241\315\301\001\004x\025\304\206!\031\262\035]Zk\332h\353@@\300uG\324:R\3256\031\220\326\013l[#E;"
+	.string	"a8\304\302k%\204\242\252\335Gm\0236c\255\034\257\230)\354}\2669m\261\264{S\247\350\251}>\265\f\310O\251\305O[\261\260\332\307\354gF\261^;"
+	.string	"\350\264\217EK\350\260\b\301\247\242\272\224^QY#tI\356\227\f\235\020\242\363/>\230\353\254\250\b[\357|\304\230\273G\340\353\343=\272X\205w\363\321\316\321\031Sv\034\f\317\243\257j\202dx`\204\3758\236BQ\236$\316QH\013Kg\034\223\032<\003\366\233\006\037\367\020\203\032\260Vx\034\001\3658\234\343\034tbOLz\332A\300\300\360z0 \005\234r}\361\\\211\364\267f\034\222\324M\240*\221zu\032\3724Q\245\276\327\300*\252\030\233\341@"
+	.string	"1y\306>\3270"
+	.string	"\243\366\351l\252-o)\3501#Y\345\357\360\t\350Out4N\020\342,\177^\032\207P\016y\322)c\347\277\032M99\305\226\226]\352\233\215\021$w\342\277\334\265\0321\331EE74?{oF\375\006f\305j\340]\001\220G\357't\251\351IYB\326~\354\373\022\276b\"\373\337\271\273\212_\033\205\020|\007a\317v\005z\350\207\212_\250i\355\2413\357.\332\302\317\037\250\255H\022/\026Y\336\205\211\256\177\270\376u\255$Z\f\b7\241\033\232P\007\313\337s\304\035nz\240z\b7-r)H6\2014\242No^\261\333&J\023\307\226\2139\032g\331\305\345\376\b\203\374\212\317"
+	.string	"\\\243\352$;\373\264:\254S%\242{.\031\227 \311\265^\341\205\037\310\362\240:\223\001\352]!\301\202\364\234da"
+	.string	"\tS;\301\"&\262`4?M\235uM\377H\n\246\323T\2366\244\244\245]b<%\301\221-\033\230"
+	.string	"\3323\363\211W\356\347\r\234\2312\322\254\332\254vnu\251a\270\374\005\313\372\257\036P\025\211\322\231\265\225g\225O}\327R\355\001\201\333kc\373\004\271\266-\252\330\314\334\261\336~\223\325M\340\337\270\007\264\354h\226\r\210\354\365iN0\336\274]\023\236\226]A\017F\301td\301\021\363\265\247r\214O\271\027R\371o\246\300\361%^p\314\003\203\361\350!L\361\306\350\331\270x#\335\034\251\220r\026\205XoP\225\357E\2728\203~\263\022\210\030\216\373\303"
+	.ascii	"C\177\303\270\020\216\363\245w[c\275\032wl\317#s\374\301?\006"
+	.ascii	"\352\214\267\335\377\r\333\177\013N<;\0068\370\017\240Y\027\212"
+	.ascii	"S\274\337\201\204\333\260\2679\223q\342\353\304\2770\2426\361"
+	.ascii	"\250\240\331`\241L\362\325\375\311\277\213\2446\f\332\342\273"
+	.ascii	"\f%\264\2430N\340v\005\36088\216\2519\021\021]\346\233\214\031"
+	.ascii	"\211,\325u%m\363R9\314\367\234\217f\275s\203wG\260\023\220\373"
+	.ascii	"`a(|\245UV\007\250{F3\336\303\266O\n\312\217\244\274\031\027"
+	.ascii	"\236P \310P\322j\216 \325\017sT\221o\262W_[\241)\343\301\374"
+	.ascii	"\277\355\307\350a\356\314\326B\351\303\373w\311\fGI\030Zhid\351"
+	.ascii	"\222\035\342r\t>\372:\200\213\320\024E\r\254\022\363\343\203"
+	.ascii	"\230\002\243\355\241\203\277Xz5(\3127\002m\021\034`uW\347\371"
+	.ascii	"j\353\273<\275\177.\254D^\210\260\212g\203\302\002V\211\306+"
+	.ascii	"\266VI\2377\b\003\230Z\341\367\034\362\336\261\306nP\347~]\303"
+	.ascii	"\363I\264\262\207\322K\377\017\355\200/\246\303a7\377V\335[r"
+	.ascii	"\307\376\277A\t_\253\353S{\367\260\2618\234\306\336\346\242\351"
+	.ascii	"\201\2679\317\347'\245\026Z\310\f\377R\327z\354\234u/\213\351"
+	.ascii	"7c\037\304\310\277\317x\207\205\355\006\355~\357\215'"
+	.string	"\345Fy\036\322Wo\0378\352\250\217^\177)\337Om\330X\303\017+\366\332zh\3541_\177\fy\314\370\303R\203\235|b\177\330\034\257\030\366[aY\360\372\257\025\0169vs\336\377\3249\363\324;O\013\352\375\217\370\037\217\277\343n\036\330i%\300cC\033-\332\257\253\237\250\234\366\273\226\345x\322\034\b:\262L\343\214\025,\207q\327\201}Y}\352\314S\255Y3\271\351x\205\271\0052Or\255-[O\304\370\205\277g)\273\341\037\236|\017\"\263OzD>\342\362\217\235\277\251\016x\337}\262gb\364\035\315\261\375\251\352K\002\352\365\025\354\n\016>\2753\234Po\236@\206^\364\216\357\203O\230\256\372i\341\253^?\252\036\235\373\352\354\005\005\036\220\367\346\272\3576\263\276wy9S\344\210Ll\2123ll\006\337%p_\247\f\276@\365\302d\310s=\304;c\355\375\327N\356\2045\333"
+	.ascii	"\016i\177\307u\204\233\f}\346Q\353\nK\307\300\240c\244+"
+	.text
+	.section	.gnu.lto_.symtab.2850093ad8f1c06d,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"accGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"accelerometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"applyRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"buildSensorAlignmentMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2850093ad8f1c06d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,852 @@
+	.file	"barometer.c"
+	.section	.gnu.lto_.profile.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`\026\001}\t"
+	.string	"d\f\n\002"
+	.string	"\036"
+	.string	"\245\357\300\317\017\026\002"
+	.string	"\002\001\002\002"
+	.string	"\001\367\255\350\337\016\n\002\003\002\003\002\004\002\004\002\003\002\005\352\263\360\321\b\003\004\240\342\234\212\n\005\205\320\323\240\004\016\003\002\006\006\007\b\t\274\205\242\255\006"
+	.string	"\n\267\335\335\337\n"
+	.string	"\013\200\333\377\224\002\f\r\342\315\302\207\007\016\215\251\367\230\f\017\350\300\306\254\005\002\020\347\327\360\252\007F\002"
+	.string	"\002"
+	.string	"\002\007\002\007\002\b\002\t\n\002\013\002\002\013\002\f\n\r\002\013\003\016\002\016\002"
+	.string	"\002\017\004\002\002\013\022\253\327\227\253\013\024\025\026\027\030\031\204\323\252\315\013\022\002\002\017\032\033\371\364\264\234\013\026\002\003\002\003\034\364\201\355\242\016\035\036\364\302\210\333\007\037\240\342\234\212\n"
+	.ascii	"1 \200\002JS\365\002\002m.lA%\001\222\030\360\367.C\333\370x"
+	.ascii	"`\366\201\350\212\255\357h,\022I\312]1\215w\301|P\013\031Y\230"
+	.ascii	"\273\260u\301\222\273\013\033\330\225\3215\037\002\346\203\204"
+	.ascii	"\233\2726\316\022,\3066\\!\267B*\0279\306\267\213\204\311Oj0"
+	.ascii	"\021\334m \353\217\255\274Z\250\020\336)m\016\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375 n\205\002"
+	.string	"\204\003b"
+	.string	"\f"
+	.string	"\001\001\001\003"
+	.string	"\002\005\003"
+	.string	""
+	.string	"\001\003\001\001\002"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"\001\n\002"
+	.string	"\020"
+	.string	"\007\013"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\001\017"
+	.string	"\003\020"
+	.string	"\003\031"
+	.string	""
+	.string	""
+	.string	"\033"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"6\205\244$T\325"
+	.ascii	"X\365Ma\177\326S\271\366b\335\006\332"
+	.text
+	.section	.gnu.lto_.inline.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`H\001\035\b"
+	.string	"\342\013+2`M\222\016C<.\001Q\366\002\223\016\f\216\231\t/\264P\227\376\3764\251\f\027\260\3156\200\301\206\002\203\306\246`X\225\3206\232u[#!{\223\024\3475\"\321YH)\351"
+	.ascii	"I\370\340\177\326\245=\253B\216\226\303\200\237\033\364h!\024"
+	.ascii	"6\220\032\373'\367\263\362\217\034&\257\353:\331\350dL8l\260"
+	.ascii	"b\305s\361gi \302`&\333\227F\271!\201\207\266\234\317\003~V\""
+	.ascii	"\340/!\233\315\252\374\360`\250\020\354\266d\006\333\026\340"
+	.ascii	"5\030b\"\202RPa\304G\203b\232\215TNO!I[\b\237i\322\242m\364\226"
+	.ascii	"\261!( \360\002\2411\352\262\001<\013a\230\346Z\314\334\230\232"
+	.ascii	"!\bX\304+\201 0\t\340\201\373f\205q5)4\r\351\204\t\262\037\327"
+	.ascii	"\332\220LR\340q\254\265\226\013\231<L\210]\343$\257\321F\013"
+	.ascii	"\3409\324\352\262`\215\025\230\271\216\35486\201\255\241\001"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\275\005"
+	.string	"\322\211!-\2007I\007`\006\223\350\351\254\032\267Y0\220\031\020\"\350\007\242\232\021\0241\203\2704\\\312\260\207\377\377\377[\267\331\377k\233%D\312\024?8\\\032XA($L\017\320Z\004\3024\035d\312\276o!h\200\300\300\233U\314U\272\310@.\260\334\240\224.\366=\255\265\346<\364\317?\336\361\214I\217\364\311.^\361\361\036kTJzPOCr%\216\222CJNyA\0315\031\305!]\215\310\336\"o\314*\022"
+	.ascii	" C\243\226!\0250.\036\004\206\222A%(\272\256\226f\204M\316\231"
+	.ascii	"\224LRf\032\202)\360q\270ij?3EE\345\312\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\001\230\004\005\230\004\t\200\004\n\200\004\013\204"
+	.ascii	"\004\r\230\004\016\230\004\017\204\004\020\230\004\031\230\004"
+	.ascii	"\033\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\275\005"
+	.string	"\"\311\031!\240\265\225\003\377`U\277|VU\020"
+	.string	""
+	.string	""
+	.string	"\217\005\320\326lm\367\342WKf\311d\311h\223$S:\362\350lv\317\t\302y:3v\324\223\332-\236\212\021ev0\024\034\364\324\1770MJ\2002p$\352\232g\342C'=\245]\364\214^\253\312\313\232\030/\347\204f\026\005\234\326\242s\335\347)"
+	.ascii	"\230\004\327\b# p\202!S\036\205@p\271\337\210\210CY7{\030A\004"
+	.ascii	"/9\274sm\023\b\243\223\bV>\300\223\315%\nA\0018\321=`\265YN\f"
+	.ascii	"\362\306\343\262\265`,8\217\2301\344\300t2\026\276\270\374M\331"
+	.ascii	"d1p\204\024`1\335"
+	.text
+	.section	.gnu.lto_.lto.d8159e8932f4a8a2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.18.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375 \243\305\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\203\275\234\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\316\007us\250\345\006uq"
+	.string	"\005\001\006'\001\016\005\001\006\035\001'\001\246 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_barometerConfig.19.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`\251\001\205\f"
+	.string	"V\225PA"
+	.string	"Q&\035\020\267\334\225\276\276\333\365\331\374)Y\023Z\351\237\340\311\374\321L\261\376\021|\301\323\"\374!\030\262\300\210\273ovFK\377:h\373 \327\222\361\377\355z7\352GW\332\210\330\237\354\224\002:"
+	.string	"<"
+	.string	"B"
+	.string	"\213\232\241bw4`\213\344\324\343+\334\251\344"
+	.string	"\270S\2136\215\001\0278h#\262\334\335n\343p\361S\364\337\372\204d\n}F\020\354\256'\311\204\341\336n\273\200\355\213=/\001\276\b\n\025\002t\360p\352\203\270S:\242<\255n\210f\315\036Cs\333`\037\262\273\353\re\237\365\317\016\232a\004\023Pc\267T\243\255\214\262\370@\261\375i\177\365\020\342Y\240\177lv\346/j\212\204Js\0273\262\334\274\205\r2\305m\b_1{\225\346\034E\230z\251\356\335D\270\240D;\255\"0$\274\304D\303K\005\211\375\303\331\340\311\017\203VYy\310\331\023\356\n%\273{ \232\315\203\216\227\300\303\031\313W=\225\343}\030\007\035\370y`\247\202]g\203\341t\231\017\354,\004\354E\250_\347\361\274\257\243\214{\310n(+"
+	.string	"!\023m\026\032\\Fu\235\210\335\306<FM\301*\027\" \340\202\221In\205\253\"'\036iF\303\260\321\201\240\030\227\003\305\030/\217\216\360\360\017t\033\374\261#3~h7\271@\"t,\367\366\"\313\324\017\333\016\005%\t\301\243r\200u\rh\333\034\346]"
+	.ascii	"\315>%\366\360\242=d"
+	.text
+	.section	.gnu.lto_baroPreInit.27.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375 \304M\005"
+	.string	"\322\211$-pU\323\001\032\345\276\363`\270\214\343j\023k'\355\337R\201l\330FP\311\251\337\341y\321\374\377\367/\267O\277\006 *\276\265{\313\024\236\"*-IM*9b\245\263V\262\306\n\"Qq\2425F\b\317\210\244\321\232\223F\210\373\302-!\201\023\233\303\036\274\330;\370\177\303\315~\007\002\200E\347\257\024\f\374C\360hl/\344\313\016X.\363\3556\224N\340\177\204\230\275\366]\336\345\254!\323\260}\205\306\177\277L\263\254\341\332V\330f\330~\004\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_baroDetect.28.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\365\007"
+	.string	"r\01776`m\322\001\300\215\326\220\253\315o\003n\306,E\270\351\336\311la\350y \204\037\264\333c\261\220Z[;\304\303&\013fX\327\205\2453\261\201#\310\240\335\366N)\2216H\2068/\t\317\274\0262\021\321\343\334\331\314\030\212\0379/\007H\247\244\240H!\350\341\372\300\316\244p\243\261\204\210\023\206\244\234\020S-\236U\315\211\354*j\316d\377\262\273kW\262\177\372\357\256\201J\255\030\240\354\216ZXV\345\235x\330\306l\214mW?\202\3754\341\200\335\215\024\216\365Wpi\315>\310C\260\213P<\263[\372@\355\326\003o\254?\327\023T\177\326\007\252?\333\346 `\316^;F7\231\\\224\244v+t\034\317\3362_\200T\361\006\220\260\273n\030\244\214\333\335\266\306\266\202m\222\f"
+	.ascii	"A3\240\314\200`\330\250\260]\205#\327\224\213\211\030\204\317"
+	.ascii	"\324(\270,ij\342\275\212\023"
+	.text
+	.section	.gnu.lto_baroIsCalibrationComplete.29.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375 \375\335\006"
+	.string	"rM03pk\322\001\220\341\352\037\\0\373\275y02\202z\231\r\373['\204j\333\320\3201\266\235\372\305\363\265Ye\341\002\017\344\324~\006\302+G\023B\244L)\256L^\3034\213{\224\005\006\237\203\227\006\331\205\201ba\225\007\331d\300\256\241=\206q\3561I\334\253H\225\240\243\036\373\231\352\252\372\017\311s\215od|\013;h\362\327)_S\235\272\006@t\262dGN\252\204\375iw\327*\262\235\326L\177\022\300"
+	.string	"Q\350\330\005\225F\366\203\"]\330\336\330\022\037 ll=R\200^1\372p\210\354F\246\023\267\236\226\377\214O!\036\243+\304y\002$\354\256\363\n=\334z\333\005\266\rlG\004\b"
+	.ascii	"2\001O8c\216#D\250@\346\032\275\204\310\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_baroStartCalibration.31.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"E\007"
+	.string	"\262\r26@o\222\016\230>\302e\203"
+	.string	"`R\355\357\336q\352N\335\005P\031\272\\\257\330\216\315\036sgS\242cpo\362\352@J\030]C\375\350T}\245\002\275!Bd\nk0\361\352\\\033,f\030`\026\261\214se\220\323\220\331@M\314 \246`\314\341\212\260\203a\021Z[\250\246\n\214\230\240BOtA\352\271\334\255\036\236\213\361\303\307u\324\352~.\255z\352AIe\203\"\344R\277\211\334\253\370\002\344+\375#(9Q \311\224H\265$\252\022\311\370{;z\002\225\343\205\025\253\325\203\336jUk\355S\272]dCP\">X2\023>\213ju\332\255\251\003#\022D]@Bf\356F\244\211\376\372\033\374\b\277F\013"
+	.ascii	"2\003\302\260\024aK\f\001\272\206w\207p@Eq*\362\345^p\351\026"
+	.ascii	"\355|\002"
+	.text
+	.section	.gnu.lto_baroSetGroundLevel.32.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"=\007"
+	.string	"\342\21526@\215\222\016\320`\255\310nd\027s\303\273_c\254\262d\017\360;LIV\266l},\273\237\242\225,\312\327ay\016\256jL\314&ic\345~U\264A\210L\001c,\361\332\\\031,^\032`\026\261LseP\343p\311@L\314\240\305`\354\341\212p\203a\021Z\333\247\244\n\220\240\230>\0174A9\225\273\025\204s3\206\350\270\206Z\335N\245UKE\030\231tT|\\\3527\220{\026_\200|\243\177\005'%\013\251\314\211\024*M\325\210\306\337\373\321\222\247\0363\24082\323j\365\236\267Z\325Z\373S7\214\254\310I\"$%3\341\273\250V\247\335\222:\020\022E\324\005(d\346.$\242\350\257\377\301\237\360o\004\n"
+	.ascii	"2\003\302p\024a)\f\001\272\206w\207p\200\212~\271\027\\\272E"
+	.ascii	";\237"
+	.text
+	.section	.gnu.lto_applyBarometerMedianFilter.33.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`#\002\375\022"
+	.string	"fc\177I\320\362&\035R^\271\222\273\016m\005\214\b@\273\242c\250R\212\022\003\306\225\2227\360\031\377\004t]\341\277f\374\356\316\b?\304 \013]\210\202\027\324\303\231\311\265\361-N]_&\006M\017k\303\2440\260\226\354-wJ\001j"
+	.string	"d"
+	.string	"l"
+	.string	"\265~\330\221\253\265\252x\205uj\333O\361\242\033\317\346(Tka\030\302\303b\252\326\3722yIw:?\240;\335\020\237\275\243s\345\314\307y\327b#\210X\343p:Q\244f"
+	.ascii	"q\325vf\211\317\220xA\316\237\357D\261\335\370q\325h\263\004"
+	.ascii	"\007\b\036G\272\354\251\351H\271b\251\265Z\2125\r\367\352\266"
+	.ascii	"!\330n\261\245\203\262\307\216M\347I_\341&\037g\nf\222\027O}"
+	.ascii	"3u\247\337(\\\t\233Q\207\034Y\304\036q\344\336\354\317\272A\256"
+	.ascii	"\037\375"
+	.string	"-\226\245\347\307{;iI\245O\242\022d\003\022Ads\214\325\247\210\220\352Di\220\370\370)WJ9\355\033\037\311#\266G7\231\320\306ZCP#W\224rj\005\362G3\003\bBUR9\2727\377\311\204\217M\371\310\210\f<2$kw{\354\260\223\353\222\244\203&\253\234\223\273\033\226v\227VO1\250Zk\333\302a\314\n@\325Z\023\370.\376\"\346\343N]\341\373\272S\031\016\312f\0044\367\366\260\363[\\)\254\231\231\351NWDJS?>$\332\234voV9k\t\340P$E\321d\225\017\374\313\3326\036\214l\201'A&\006k@c\343\311H\036\310b``\036\003\017\234\020\206\036\330R\343\311\004\370e\005\364h\274\330\007\302\\^!\370\2052/|\311b`\261\327\013\030\276V\f\370\223\361\300\027\315\367\201\257\221\261~\203|\242\235\331\332#\375D\244\256\235s\315\222\263:]"
+	.ascii	"y\025o\372N\240j\315\271\310\344\230\b\362\242k\357\341\204\023"
+	.ascii	"\225\024mq\002& P\0021$\035\037\021\006|A\023\340\335eY1Z[oQ"
+	.ascii	"}!u\234\342\341\007\026\234v\324t(\342\026\203]\346|\bw\315\020"
+	.ascii	"\2437H\026\007:\340\b\371d\203x\020\343\326\201\273d\370\326"
+	.ascii	"p\215\005\216\357JP\203\337\354A\244$\034T\210\314\212/Gi\215"
+	.ascii	"\b/k\214)\205\201\002"
+	.text
+	.section	.gnu.lto_recalculateBarometerTotal.34.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`\251\002%\025"
+	.string	"\326'\215J\300\322Q:R%Ha\374g\332\376\341T\001Q\016S\226J+\300\031\320N\344\340\321\030\2528\363.\262:\275a\247\273\276`G\005\263c\035c\033\211S`j\363N\225\005\207\374\245l\022d\220\300\276|\266z\333'\204\310\235Rx"
+	.string	"l"
+	.string	"z"
+	.string	"\025\304#\035\013\245Zk\212\035\320\013wb\200\332\343\361\220`\251m\340"
+	.string	"\315\215.xk\005\352P\252U\230b\225\326G\333>\321\213h\274\023\205 ~"
+	.ascii	"~\202n\206U\265\ng\003nB~\024/#?\356\207\357..\335\371\037^$"
+	.ascii	"\361\004\303\367\343]\324\371\212\004\2003tF~=\321\244\006\217"
+	.ascii	"\324\207\2478?\033JY\nj\255\246\276\037\207{\274\355\006\266"
+	.ascii	"o6\215\n>\220qf\242\367}\364\315D~\374R\b\232\002\226\330\251"
+	.ascii	"\241W\266\220G\327\307\276X\267\307.\271\360\226]\370\223\374"
+	.ascii	"\350\217\335\350\207\275"
+	.string	"\216t\273X\324\255\245f\261\250\311\245\036\227Z\\\352]j\272\324?9\221P\025\325\004 \265n\270\022R\241\306%\021G:IG\2726\215?\264\210m$7\265x9\255\023?\301\251Z+\312G\007$K\256l\351\323\270\344\336\302_\350ZM\343\272\226j\\\210\353\212\262a\265\263k\033\303[\350Np\324Z\021\370IW\242\371@\037-S\253\221\037\307&\237\017\030\215\255\335\342B\357\333\245T\301\034\253\251\336\362\304\365\371\013\351\253\370\212\027\233i\222\037\307!\032U?\036\302\007\204\332\365\361k\351\256\230\310\321\243A\f[\272\247S\217\233!\005\376}-\335\241\001hs\024O\341\2463%\313\215An\246\274\305Zn.,\264\022\302\003]y#\201\241\345L\t\345)\203\303\225g\f,w\2231\027\224016Z\204\230k*g\231+m\346I[\231\341N\023w+q\263\233\013\3156\253\235\270\231\212"
+	.ascii	"\2331\3459\313\231\3469\023\021\326o\217\0375\202\307\242\\\344"
+	.ascii	"\247\350&\211\276\326\2658\266Kv\244\303\020T\315\332\330\265"
+	.ascii	"N\254\fR\301\235\326\312\266D\210\265-\230\313\210\301ZW\324"
+	.ascii	"\215\340R/ \260\"\031;;TF\222(]\241VV\265\2555\017q DD\303\352"
+	.ascii	"\262\313\035]\2600\022#\306\t\206\272n\007\250\245x\331\202|"
+	.ascii	"\271Bj1\315\231c\352\234\375j\023\203!\030\237M\013s\270\003"
+	.ascii	"\372\217j\227]\327#\301Ul\214QZ^\214\005h\246~+\017\020\2539"
+	.ascii	"\304\013\003\2177\032\323\235d\024\305k\306\256\321)\232\330"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_isBaroReady.35.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"BL-3Pm\222\016\204\\\316"
+	.string	"\t\314P1\273u\024(\226\361\346*{Kv\325\376\335\016\2736B\251\203\367\346\230\231!r\272H\345\276\300L\035\032\323,\3312\005g.o\342L\032\3670\013\215z\216\332LT\3330`4-\363\250v\031\3305L\257q\234{\315re\331\b\031\001\210=|9\332Q]\214\035:X\253\322\355"
+	.string	"TB&0\001\302\224\277>\310(\276\225d\243\037Gf`\322\021\224\314P\312I\212H \031\277\347-#$x\256zY\204zA\002\341Q\222y5V\321\252X\335n\264\242\021\362a\211>\305"
+	.string	"\205\314\034-\221Dg\375\013\376\203?\"\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_baroUpdate.36.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`\314\f\3154"
+	.string	"\352U \023H`\\R\007+\322\306\365\016\266\277R\321\360W\301\032Z\336\001\224M!\017\244\352\231\006\025\f\034\366?\3106|\005\236\226\256\340\202\323\0258\276\314\306\363`@i\260x\f\344v"
+	.string	"\321rlV\215\255Y\262\367\336[\246\224\002\025\001\n\001+\001\r|\277\177\356\267\257\367\335\343}\363z\337/\357\333}\277[\367\233e\277\327\366;\263\337\277~\273\004\2366\\F\200\211\343\250\2736q\033K\005\210C=\377w{w\277h7k\237C]\274H\345\273\344\211]\2318\216\"p\266\205^g\333\311\274\310\213\206\327\350s\331>a\343\224dM\034G\207\214Nl\235]]\330:\233\265\034v\342P\230\003"
+	.string	"\347&\b\374\371z\274\327m\3315?\334N\024\027\227\\\"\235\250\200N\310\260\313\205\356\246\354\362\3619"
+	.string	"\\\tWR\\\216\263\365\374\233\325"
+	.string	"\332\0270\377R\352X\213`Sin\312\346\007\201_\312\252\377U\360*\342\353\005})q<\357\275\374\r\272\222j\272\273\032\335\224\315\325\030\307\261o\351\364\255\233\271\005/\034f\256\244\274\234\265\312A\345W\312)\030mO\312%\355-\233\332\265\206\347\365\200\325Z\215\340\222i%r\301\"\343f\376O\313\245\177WB\034\307\375\311\245\224w\321\273=\252\273\035t\373\350\002\310\356\246\340n\026\212\335\027\234\313q\370\026\307q\203-\336\206!\203\006\r\255\263lf\247K\252P\245\277kO\363\035\034m\310\257k)\227\364\311f\347Z;\333\212\226\245]-C\247\355W^\254J\273\025\347\222\322>\305C\264\316\366'c\250\034A\342\035\335\016\245\273\251o\034#\335\252\273\233\372\303\030\206\027T\2318\216\r\030\235\336\016m\315\036\224\2549ww\002w\262\341\346\331\316\304\233th\357r\266?\200"
+	.string	"\221<\3639gw\262\363$\256$D\013\021\"Zg?\263YH\252\376#i\325\226}D\353\271\304Y\030\246\247\353v#~dD{W\223(zO:\333^\324:\353\231\rC2\326T\372\273\356\350\222\257qvv\373\032\347\036\335\021\210\0308\324;\350\3756\266\337@\355\367\317\357\333\247\375\356\371}\363\254\337;\275o\001\300\357"
+	.string	"\277o\235\365\273\b\374&\376\276\207\277o\241\357;\247\367\215\303\373\276\351}\007y\037X\303 ?\204\331\235\203\033k.\350\362\301\303\243\277\005k\275\257\365O\030\013v\302Z\357IX+\247)#\267\336\t\373(\3668\016\261r2;%S\205: c\203\273\301y\036\023\210\317\337\361:n2N\356\340\365U0\231\3173\307Q\347Iu\223\335\254/Z\374\247e*\2706\325\005\030\374\033\317|\033\300\034\004\3624^\352\227\300\3542\267`\361\237Z\335\357\227\211\204|\324\317x\250_\3461\331\262\374\023\333\313\370\030\357\344\203\301\276\311B\361\231\216\303_\362ev\272&\365\237\232\031\337\364\221\323^v\246\361\336\235\335\261\300\263\216\227{D\234\r]\225\227]\246\224\212\377\324\244\274\354\364\257\242\252\031\362fg\253\231\213\"&w@\312e\305\315\316\366\023\355\233\375\352L\314"
+	.ascii	"\271\tC4\307\002og\334\374\346\rc^\006&"
+	.string	"\353\211;\026\251nv\231P\242\370Om\254ms\204\374u\r\2279\031\330l\300\230\343\317\233\2306\363\230hR\374\215\rC\023\223\003z\217\372\227\t@oq\254\344I/G\002\317.l\356\007;\230rF)LpXad\204\"\211\327EBHF,\214R\034!\221(1\224\204t\224\244\302(iH\205\t\022)\206\212\220\222\206\204\200\372h\205\021\322\020\213\243#\244!_T\311s\217\366+a>\242\354e[\254\206\fr\0133\352\353\276\271\213\326\313\252X\261\021rP~\352\356\240\034\244b\323\246\224\227\362\335\335\235\031\24213x6\330l\300\257\035\177^\2131\363\230m\252\320!\220\320g\301\002\224YP\3258\331\375\274\225\237J\337[\332\372\344\037*N\237j\263G\301K\331\240\363QxrO\032Ov\263\346\306r\340\344\276\204~\346;\331\257\376\311Nv\303\322T\2339\254\207h\231\264rM"
+	.string	"\323W\022'&\307\303F\235\303\021\320\364HN\364\374\331\261xD@v\231\324*4@\216f\270\344\031\b/\314\304\254#\003~zO\006\310F\030\031\331\305\254\2233\324\227\301Qo\03435\350'\373\"\360\222\006l\303F\353l1{\332\026T\354\307\340\033\360\324T\353,1\273s\324\261!\325\207\021\001\033f^\026\\\265)\314\335p\325\013\201\003\201\006\250q@\347\0344$\"I\nR\3104\006\021\006\204\020\346\\\261\003\021"
+	.string	")b\0161\252\26156\003\222\002\007tV\326\221\352\376\375D\347\257aM\255\242\213\270LvM\2131m\024\302(\243\367n\274\214U\355 o\006\263\223\205\2773\320\205\353\216\b^\310H\340\005y\231\377\232D\361\212U9\211\306j\331\214\333yc\233\230\33534\033\265\266\236[\360\351\265\210{\034\t\243\224\353\222B\272"
+	.string	"8j\217l\3046\251@\206\201\351\305\336\036\321\245\234\340\333\300\233\360`;v\303\230\245d\306\266\233\275\335\024\312H\177\031\203\203\245\210DbJ\341\266D\026\023\217\037_\351\207\325\244Y2\"8\350\375\217\202l\246j\225\204\300]X\355\226\326\362\360\363u\213\203u\330\273\315pY\351\232\027P4\226\350~$\245\203\343\203\021`6\2604\033\034/"
+	.string	"f\b\333\3264\n\206\301\276@2u\223\226la\311\213Y\352a\247\n{s\006}\031\355\034\241\255g\325\240\017\\\221\221q\022.\274\210\"Lj\216\306\013\372\322\371\257+8\320\214\307\311v\260A\341\241\264\262'\342\255\237\252\031}\241>\253\275H\235{\316\305\264H\377\213m&\fl\367P\357\374\340\275\002\254}G\301\031J\351\t\241\363\205A\341\311\323\225\307\363\221\340\233\362\342\362\301=\037\237\254\350\002c\027\225\210k\002\354\2370\025%f\036\363D\035\206\001q\033\324"
+	.string	"\017\002\304D"
+	.ascii	"\2230\254\220\333\224\003\251\203%t\203\fP\030\226Vd\242r\207"
+	.ascii	"\f\374\"=\366rN\0160\352\330/\323\213\2517\311\267\220\262\027"
+	.ascii	"\300r\247\353\232YDGfF\331\3543\0172.\033n)M\021o5"
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.38.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`\201\004\355\034"
+	.string	"\326u\270H\260\326M:6Gp\201\031\036\276\003\013\216s\240\271\2055/Z\236\366\2317\246~\316\261\024\r:l\310\177N\235\022\244\220\203\223\373\330\274\340\375\341\337\200\345o\243\265\270\217\341\274\217\247\f?\250\214\307\277\021\262\211\224)\005\232"
+	.string	"\227"
+	.string	"\252"
+	.ascii	"\242z\245ZC\365\003\324\2148\361\300eN\023c`\246\227\0342\365"
+	.ascii	"\340o\337\347\361\254\017\277\362:i\321\370`_\307\261\354\231"
+	.ascii	"A\374\312\222\213\326\354\322\006a\317.\325\016\341[y\366\340"
+	.ascii	"N\266tB\326c\312D\330\234s\300\245\211d\227\376\215\343\b\341"
+	.ascii	"]x\005\003(N\225h\312\3522\347\274\331\276#^\206\317\021/\367"
+	.ascii	"\305w\227\341\352\316\037\021\204B\276\034\371\001\227.S<\224"
+	.ascii	"\001\246\370\322\200\275\3206\347\274\325\225\004\220\247:\""
+	.ascii	"\230sZ\177@\024\267x\333\022l\033\260\303\257\266PT$^\352\236"
+	.ascii	"\tX\360@\036\304\350\b\207\023/\277\004\234\264\274\350\234s"
+	.ascii	"i7\n\203h\333[\375f\207\024\035Y\236\200\365\364\213\375\036"
+	.ascii	"\367\201\301\227r\006\r\372\237\006\361\322\266\317\272\326p"
+	.ascii	"\001\345)\207\n&\035\263\257x\272Q\366\303\271P\366\250\036\262"
+	.ascii	"Z(Fm\013z\360\256\215j\240Q\3753\252}Du\217L\3153\252wF\265\316"
+	.ascii	"\250\316\031\3258\243\372fT\333\214\352\232QM\023\32541\352\231"
+	.ascii	"Q=\023\3252\242:F\246\226\215\3521T\213\241Z\212\3520\005|%_"
+	.ascii	"\222`\001\003\006\342\245\314\316^ly\t\306lm\203\366>*\036\222"
+	.ascii	"'\3315p\340@\274\214\331qk\205\n\331\326V"
+	.string	"\255\370\350\320\332\017 \210\377\311\356\304d\206W\257\tJ\006\321\320\216]\276\252\2375\327\347\234\352\263Z\304G\325\243\346:\326\025\251\026`\200\326\307\212 A\374\357gm\"v\311\346z\324\017\2469}`l\314\2537'\323\320\270@{\254\207H\272\034\361U\211;\256\212\371\302\344~\305\005\240\345\263\021\256$\372n\2705-\337\023O\307\254\273\373\2460\236p!\024ds\366\n\370[\347\252\340K]\006\035\220\224\212\2246$\310\351\214\024\314|D\244\303)\341\220r:\243\013\267$].\211\003.\351\306!\203\021\322\355H\227t#\nr\256\003NwS\312\345t\267\331\025\323\303\271PBkcZ\236\255\354dU\204V6\025\251\021\224\003N\005L~\021\241\241%t\317~\355hS\244\374\207\205g{V\267\354\360\254\255\267K\326Y\233\335\331\315\362=\345\354\315\352lM\f'g\203\304|T<\332\342\254"
+	.string	"\255\240\275\331\237(\274\021,\274\256\324\254\rmg[\263\367U\321,m\305._\330\314\322\354n\334k\227\243\311\314\236H\214\240\314\316v\305|a;\253w\355ds\316P\250!4\005\215\201\306\231\022\211d\302\266\220\306p\002\031A4\274\001\021`\265cpHamm\006\362\244;i\371*\021\277o\332O\232\264;RK\006\261n\324q\322/\027\371B6\231\213xx\340f\332\t`\fs\034*\345\375\246A\037\304`k\361\037\322\341S\343\213\2651vH>Eb\017\203\025\301U\r\226i\243\350#\030\307\016L\264\036]\231\322F\326\325>\247\227\200\241\267\264\230F\253[\226\264\242\264\201h\247\357`;?IDI:%\236O\253r\207\247\270\203\365i3\373\334+\017\343\025H\335\t\272\241'\212\034\022\021\237"
+	.ascii	"\257$!_h\206\230l_\370\003"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.39.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`\030\003\365\025"
+	.string	"f'\211I\300\020)\035\312\034\266N\337\354ix\031\017\353 \350\360h\321\242\231\375Nd\340[\363\251t\021\244\274\r\233\352\367\373\356S\346d\314\216\272#\"\013\356\262\333F\321\317\020\330B\226k\221\217\231\231\233\235[\373?\331$I\231\002n"
+	.string	"i"
+	.string	"v"
+	.string	"f}\275\332\265j\327\243\270\226_\213\273\376\256w\327zbR\341\311\246\306\234\023\206S\323I\"y\320U[]\276\261ch\321\206\251A\0169@\033sN\3325\350\215J\361{c\325!e\365|8*wTT\245\3149[\276\035\2758\240g\211\302\313\267\023eO\031`\350\220n\004\237nW\2252\347\364\366|:\352Qm\037\260M\300\276\204~\251\325F\225\362(QD9\022j\304"
+	.ascii	"&&ft\205\020\006\355\365\377\201\274\036\335\016\355@\2354\352"
+	.ascii	"\367\312\023\322\351\b%\222\261\376\330F\263\332Si\245\031U\352"
+	.ascii	"]PK7xr;\264\213t\373\237\255\342\274\217\375u\311\270&\031\327"
+	.ascii	"\262]\307v\r\333\365\210\\\213\310u\210\\\203\310\365K\256?v"
+	.ascii	"\355\261k\327\327\255o:x@ wP\347\234\033r\021\310\373\020[\007"
+	.ascii	"\325(\352\350\302\324\353v\002\005\253=\220\237@8\216\035\324"
+	.ascii	"\237\212\334\234F\031\016\235vs\346\004|\374u\345\001y\374\343"
+	.ascii	"b\022O\206\353\036\037ur4\361\204\\O\241=\251\326]%g\275u\375"
+	.ascii	"Y?pu\361%\227B\236\220\352\253\231\216W\035\200P~\274\346\354"
+	.ascii	"\360\002=\301\262\232sW\300jB\201-\326\037\225\001~\231\335j"
+	.ascii	"55\031\333\255"
+	.string	"\305\205\206\273\331p35\034m\006\246E\206\366r\303\321f&\2665\250\335h56\333\215\346*\312\351}\314b\301)w\235\204\275\311f*\330\223\"\271p8T\225Qv\022\027\262K\245\027A<\273\202\306\023\006\361?U\031\255-TI\305\300\312\nT\223\210\031\332\241\327\343\364\377b\207\335\245D\324nq\260x\020;\013\tv\025\n\246\033<#G\bD>\302\224\333a\216\017\210\231\310\003\004H\250q<\306\024Q\312Q\345\024)\303\001\220\002\021\272\252\016\020hHD\031\016c\334\2222\214\203LC\224\236+f\326dbj&\r\317\262\355>K\271L\271\314%m\275\334#B\344[\00574\"\255T\231yN&\346\245\004\212\303:\340\271v\372S\217\213=\304\244\214#\227\242\336\034\321\036b\211\232\376\245\343?\325n\354W\r\272\275\310\361\361\016\346\3261\204\t\353\231\\\037\003\377\214\272\203\025C%"
+	.ascii	"\244>|bY\363~\3106G\367W\332 \324\302\275\037\201j"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375`\343\001\r\013"
+	.string	"\322\217=9@\257:\217\212\265"
+	.ascii	"d@\277\260\345c\333u\2424\274\361z;{\017\001\0246\215EU\321k"
+	.ascii	"\250\206j\320\330\266\365|\337\367\0076\006\231e\361\003\272"
+	.ascii	"\273%9\266\323\2262\245\213\t\021y\252\006 \007\022\253\267\302"
+	.ascii	"eH\254a\355\35367\260\2269\003n\230\232w\362\236\"\247\355\353"
+	.ascii	":&\307HPX\372\253\254\302\335\377?w\365r\3146\227\226\223\221"
+	.ascii	"\353\205\277,\334U\341-\376\377\335\317\013\205\263x\342\353"
+	.ascii	"]\217Y\007\207\206,c\206!\333 \227i\037\022`G\300\032\202\340"
+	.ascii	"\301I\324\201\323\r>\242[2h\026DN\030\016\364\226b&vj\005S\357"
+	.ascii	"\356\230Pj\230\037\274\\D]>\266\374CY\002\275r\003\322\013\036"
+	.ascii	"\247rO*\205\352\234P&\017QpU\"\273\3562\355I\252\336]\357M\363"
+	.ascii	"GF\0162Kp\273\276k\002\302\335\377?\202o\350\356\322\2241 \360"
+	.ascii	"\002!*z\376Afc\177\nQ\242 /I0\004#\270\004\253\210\262v\r:g\220"
+	.ascii	"\315\323\322\363$\030\312\017\326\003\267\303}h$?\333\030\306"
+	.ascii	"\235t6\320a\336a\356\204\327\030\2121?\240\320c\376\210\351\360"
+	.ascii	"\275 !\207H\fCt\326\027\344\214\202\001s\206\214g\254\214\030"
+	.ascii	"[\200>$\003\247\214\335\215\366bc"
+	.text
+	.section	.gnu.lto_.refs.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"\225\007"
+	.string	"\266\0248+@k\224\016\3030\f\3030\f\3030\f\210\252\2426\303l\273a5\2022o\212!\022\037\213\377\326\375\fG\r\326\276\375om\313\024+"
+	.string	")"
+	.string	"/"
+	.string	"U_\336\3271U\271\317\r\2002z\335S\247\234\316\200^\202>r\036\202z\363\264y\226\030\034Z\376\301\3560\235Yz\361:_\213_\2208A\376\344u\201\304%\371[>\344u-\361G>\366\272\225x\346\277\327\251\304\033\371.\177z]J<\312w\3367\001?\242\277\310\257\250:E\325'\254\227\250z\304\365\020\216\177x\335\341\365\206|\006\254/d\257\200}B\366\312\365\b\331\017\254\247\\8\305\302\r2\217\022\3140`9\022\351\233\353\232\373\207\353X\344\257\355-\2553\266\336d\317lC\246'\371\003\3313\373\227Oi\317d\277`_\027\005"
+	.ascii	"I\303?\375\020\002\216%\305\b\200\245\310"
+	.text
+	.section	.gnu.lto_.decls.d8159e8932f4a8a2,"e",@progbits
+	.string	"(\265/\375` +\035\305"
+	.string	"\252;\005EX JQ9\351],\\\354\312\203\356\253\177\364\303\324\253n\216\330\\a\220\033\357H\264'\337\243x\256\0268F\261m\003\013\021\360\031\271\257M\341]O\264\273\255\213\003"
+	.ascii	"\300\004\004\001\016\230\345<\216+(\322M\b\277\025\025\364\356"
+	.ascii	"9\305\211\273\307\374\3771\233\215{o\231\002\227\003T\004e\004"
+	.ascii	"\325\251>\2653C\2151\007$)J\f\177 \347\316\320\353\274\274\316"
+	.ascii	"\320\253)\020\275\302X\200\020,&\365\332\276\360\"\203\022\264"
+	.ascii	"\035>\232\\\344@\361\302DYo]\252L\355\254.~\305\230M\037\253"
+	.ascii	"\234b3\253\367\355\241\007\344\241\367W\245\232\304\203\313R"
+	.ascii	"\n\365\276&\3755Y\2259b\334\322\352\355\311\315<\242\327\274"
+	.ascii	"\001,"
+	.string	"fV\275C}a\005\274:\226\202\262F\275o\274\277\353:\254\357*S\202\236\263;\246\251z\333\256\337\264\363Z\032\316;N\253]G\251\231\235\235\265%\231U\357\255L0\013__K\257\247/\364\272\214\350\355\346BoI\325\314@\366L\215\351\256\r\235\257\211\332UY\275MW{\256\331\274\351zM\217R\323\335\234\225\335\034~\2729\344h!\242\204\322\273\257]\370\357g\007\254\224F\345\253\325\264\334\225Af\303\251\3364B=Z\320\214\201\251\367\325\n\277\243L1\363\344\322\245\323\276\250ma\313\242\005\214\024/kc\332\255\321\264\nM\246\315\364\231\216k\270\026\323o\355\3542\315\366\006\323a^\2339+\345\234\217\301\227.gh\235\026&\254\331d?6g\035g\264\300\332\232\254\333\250\026\300$\256\277\272L\233\365\225n\003\322\301\027\3343\347\3465\370\211~\021\032t\231^\3534\rI9\353\310\001"
+	.string	"\347\030\024\233]\316\315\017B\037zV`\306\270\021\272o8\374gc\350\375\264\032~K\301\357%\370=\004\277\253\260P\303\300\033<\200=`\361Ya\311\nq\352=\022?\210/8\201\233JWig\207\266\362.k)\317Q6s\263\n\301\223\002\245\336C"
+	.string	"\277;\364l^^w\350\275\0018\2501\364\352Yc\350\365\223\026k'\005=v\021\032\334&\305\362W\316M\240;\305\326\243H\275O"
+	.string	"\376\017\345\022\210e\r\016\204\337\024\364:\257)\350\275\342\267\3015\206\336\337N\372\213\002\333\344\304\314e97-"
+	.string	"5\247\236\260\352}\2631\364p_\350\325\216\313\360[\264\377\030\370;\351\255\376.\360W\013T\340\024\370OB\245\300\337n\025\374V\312\337,\376>RO\250'\252\211\277\225\376\316\177k@\305\337\304\277\207\177o\340\357\025\177\267\370\373\3707\362\357\n\376N\3776\376\307P\374\033D5\341K\235@\275}d\001"
+	.ascii	"\376\013\375\335\373\257\241\226\300\200\337f]5T%\241\2035\372"
+	.ascii	"\253\001F\220\362\371-\007\263\0355\002\177\347\374\026\307"
+	.string	"\377*\302\177\003\364~\033u\177\013\343\375[\017\374W\341\377\230\377e\376\217\375o\373o\346\377\231\377d\376\303\375\217\373/\306\355\026~+\201\277N\360W\001\374\225\202\277\006\340\257\022\3745\303_5\374uC\255\240\346\3745\202\277b\250!\374\017\372/\211\277\202\360\327\017\376J\364\327\016\177\255\340\257\034\376\226\373;\356o\270\277\337\376v\373[\314\337a\376\376\362\267\227\277\325\376\316\3627\332\337f\177[\371\233\312\337e\177\217\375\r\366w\223\277\275\376N\3627\327\337D\376\016\362\367\362\357\037\177\347\370\233\371\367\317\337@\177\327\377w\377\347\376\237\370o\345\177\232\277\223\177\353\370\273\003\177\337\370\333\306\337T\177\323\370[\306\337R\377\343\374\307\362\367\213\277\233\376v\3617\323\337K\177K\360w\320\337\370o\337\337\366?\336\1776\377M\374W\363_\356\377\327\377\007\374_\373\377\223\227\227\227\367\337*\277\017\311?"
+	.ascii	"\250\235\231\226\020x\221\367\314\313%\210\373\234\360\255\223"
+	.ascii	"}\272\215q\033\303.\233*'\3478\3548\253\363\262\313TK\017\277"
+	.ascii	"\205\272]\366\035P\223\250)t}\3273\323\305\303\005\032\376\353"
+	.ascii	"\337\313\312e\316Y*\247\231\227I=\275\316\351\366\360\373\264"
+	.ascii	"m\002\374\277\231\202\b\344\234D\303d\203\271\314\2248\276!\377"
+	.ascii	"m9+Y%;\260\212R\262\252\321\344\264\312I\245\"I\013\313l\225"
+	.ascii	"lr\346l!+)%?`f\013M\316\034\225\227T\210\352\334\264Jf%f\266"
+	.ascii	"\220\225\262rC\223\222UT\223S\031e\241\311i\025\225\235V9(+)"
+	.ascii	"\227/\224\362\322BvZ\255\311NfTP\223\223\031\325\344\264\252"
+	.ascii	"j\270&\272\271\2502\314++\375\244I)\307x\252R.\203\332\232\232"
+	.ascii	"\314\f\227s\2271\345%\001r\256b.\341\2245\372,\251-FR\025%\263"
+	.ascii	"3<%]1\263R[S\0273\347\256$\025\371)\203d\263-gu[\022\253*;1\345"
+	.ascii	"<\301S\316\311\316m9\347d\316\331\267\254j\346|#\250I\353\351"
+	.ascii	")g*\241\247\\\225Dc\312\271\226\2359\213jr^1\211\320\310\234"
+	.ascii	"Z\331E3\331Z\031\316j\211\235\311'\331\211\016kE\311\230\223"
+	.ascii	"\201\177\233B\031\236\271.R\311\027\036|\336\274%y5\245\261{"
+	.ascii	"\273Zr\361\036:\216\264\311\253L6\351\326\001I\372\n\253\352"
+	.ascii	"\273\037\235\234\255\342h}\345\350;&p\2366i\227\254\222U\266"
+	.ascii	"\323&\325\025^\363l\266I\225Y\3614$5]\26076lR\275\321w\034\334"
+	.ascii	"I\315\310\361q\346\246\334\271\275f\317\351\256g\013\030^\262"
+	.ascii	"\336\367\224\317:W\353*\233\352\246\266\251k*\234JW\337T\273"
+	.ascii	"v\3268U\352UG\335q\241\016;\302e+N\355j\272^V\233\334\263\306"
+	.ascii	"\251Jj\231\344N\026S\356\311\003\b\233V\026\221\372\003kM\253"
+	.ascii	"\210\021/YA\276<\243\3248\225\313\354YyX\325\037\\\300\024\321"
+	.ascii	"\252C\324\272T\034q*\\U\363\224{~\260QbR\226\b\3354U\016\215"
+	.ascii	"\333r\314\r\024\234\006\215O\224\265\033\312\270W4=n\230\356"
+	.ascii	"\246\324[\317\3300x>\224f|\300\264\312\250\231y\337U#1\214\264"
+	.ascii	"Y\362V\343\234\324 #\202\307T\267vV2\325\311+\222\232\344BM2"
+	.ascii	"uI\375\212\362\231y\222\251`UL\267Q\005e%9\274\347\207\017M\246"
+	.ascii	"\266\302\\\357b\251`\320h\265\3250U\205vV1\257bjX-\373IZ\310"
+	.ascii	"\331\307\235\226\230*\245\236\375(5\263TOM\316\0372|\370\300"
+	.ascii	"\343\324#G\022\337/\225\255\235\025L]S\253^\272\215\252\231\245"
+	.ascii	"~\2500\337\244\354\300\324\264\252ECR\223\bY\342\2368-H\226\254"
+	.ascii	"\336}\016\017/]|^\230q\225\331R\271\354\320\240j\313B\003\377"
+	.ascii	"[\036cki\315\351ij\226\013\3712\345\244\336\347\270\300\317\311"
+	.ascii	"\370\367\016\327\263:\245Z\351\266\262\017\300\310=s\316f\025"
+	.ascii	"\255\235\365\254^\371m\346\\\326jg^\324<\205>\374\030\341j\342"
+	.ascii	"\344\211\257\022\245(l\265J\245\222}|\344rh\351z\303\277a\360"
+	.ascii	"\357Z%\253Q\332Y\313\352\330\353V\365\272P3\347*e\365IujHj*\241"
+	.ascii	"\003N-\253\315N\373I63\024\217\021\2557)\241\017\037|XX\302\202"
+	.ascii	"\364\356\257\226\023\212\265\321d\345\256\231\263\205\312\215"
+	.ascii	"\210Xu\302s&\205,W\357o\026\376\345\201\177\251\360/\024\376"
+	.ascii	"M\252M\200\242X\201y\275\301L\354\032\334\331\236\301-\364\005"
+	.ascii	"\337\246\341\333)8\350\t\276]\2027\034\251Q\205L\365\021"
+	.ascii	"'L\032X\370\026\007\276\300\312\250>\260z`4\335Y%\334\003\253"
+	.ascii	"v\265A\363\272z\305j\272J\227\346\207\\\305\303o\276\3019M.k"
+	.ascii	"\360\253\030\374\263,\370mT5\230\204\341\275\251\267\306T\020"
+	.ascii	"+!Bh\274N]\256'g\r\032b\biR\357\333\324\031\377uv\334H\001y3"
+	.ascii	"CF\307\211q\263\253\327YeT\2517s\026\352(Je\322\024\374\327\250"
+	.ascii	"\345\n**\260z_\227P\315\314\271\354G\306\230\327\215z\003F\316"
+	.ascii	"\352\275\205\272Z:+\313\3725\222u\267\272M73\02539W\200\035]"
+	.ascii	"\346\236v\271\251\312\203\221\217\035_\264~\267\276\364\362\306"
+	.ascii	"\316\254\314\032\311\225%S\352\275D~\213\374:\2762d\326\304\226"
+	.ascii	"\370\n\371\035\202CF\\\027\214 \277N\017\220/`\346\352\375\317"
+	.ascii	"\022\276\317\n\370=n\217\373C\210\231\\cAXR\315\224\207^\334"
+	.ascii	"s\006\234\353\343\367\007\004\310\210$\317\256\356U\313\t\005"
+	.ascii	"\345|\365\346\314&-\2015i\373\374M\266\323>/\017\333D\225e\200"
+	.ascii	"0\253\002\321\303\232z\326\325\313l*\371\224e\336\272\024\301"
+	.ascii	"\357\257\253t\231\300\320l\271\270K_q)\\\247n\003\322A\2220\265"
+	.ascii	"y\227\276\316\330\2701\356\324\025\273\247\224k\343\276\3504"
+	.ascii	"8\034w\307\325q\253.\325\275qs\264\363\332\270O\277\312\233\244"
+	.ascii	"vm\334& 6M\242\324\b\272JO\003&G\343\326h\347\235*\273S\027\352"
+	.ascii	"\316\340\261\262\346\f\033\273\f\037|\346\334\340p\364f\310\370"
+	.ascii	"\251\322\374AW\357\225\362Q\325X[\212\261l\347\215\302m\274\320"
+	.ascii	"\342<\r\317\226 W>0\360}\226\360{\354.\fL\346\231\003\314\034"
+	.ascii	"~\217\034~O\031\374\036\025\360{\330\360\177\231\356\222\323"
+	.ascii	"\013\0330w)m\f\233SR\027\\=\364\205\236\305\263y7\377:@L\316"
+	.ascii	"|PA\303\267+\374\327!!H\030*\365^\033\347\366n\315\210\326S\025"
+	.ascii	"|\373\306\302\371u~\340\212Hy\342\304\267vT\362\330\330\250\327"
+	.ascii	"\326a\246\236$\035vr\\\331\201\243\336\333\272\337\3165\230u"
+	.ascii	"\203\201\234\2258\220\207WW\257ec\333\334\272\261t\331\272\311"
+	.ascii	"\200\231\263\322\272\001\272\313Y\t\324\315\241\233\303eredJ"
+	.ascii	"\357\276g\013\373\324\021\335\256\341\001\243\366\f\253\367="
+	.ascii	"Ti\314X\271\276#j\363\354Q\302\347\221\303\267f\332\306\305i"
+	.ascii	"\311k\230\350\013\256\257\245\007\007\327\306\367\225\245\f+"
+	.ascii	"\354\315\276=y\206\214\031c\335\326\024`\r\027\020%(n\275%0 "
+	.ascii	"K\352=\317\224\230\267\323\212i9\333\224sT\0075\314\272\243I"
+	.ascii	"\230\\\036\276ek\033\306\206\261S\026hY\252\301o;\365\305i\277"
+	.ascii	"\324e\025\313R;.\222T |\266\230\214%\231\301\267[\332v\321b\275"
+	.ascii	"X\03624\b;\333\031\203\277\263\206k[\036jj\235\326b\031j\307"
+	.ascii	"ET\022. ."
+	.string	"\236\232\267,%8-\315f\251Z>2*q\2367I\fK]\026{FI\233\221!hh\266L\004\fN\212\350\254\230a\232\231Y03rZ'\260$\311\365~\347\311\212\225\f9\226u^v\27574]\202\330\341[)m\2518-\225\276\342!+\225\026\244i\305\341w_\351E\211b\313DH\346l\343Y\347\345\345\223r\023\303\251Lg\213\353\312\t\255\331\264c\021tYZ\037jO\320\254\363v\254\351~\272\212\240}\325k\237X(9d1\256\310,\024+\266\203V\005\311\232;2qOM6\252\300\226\250!s\342\304\202\341\234\263\320\226\\\345\301\207K\013\210\nos\013\226\243BW\221)\365^\207\t\023\333e\233\324\244\016^4\345,E\204\344Y\347e\247\223\205\2573\345\345\264^M'\224\223k.\320\322V\347e\247\343\204\244\313&\271\026\234\\\342)0\274\236o\360\261\233\021#\226\253"
+	.ascii	"H\216\334r\331\251\233$\206\026%\365\332\255N\333As\212\241Q"
+	.ascii	"\257\325\262SU\315\t\227\204\247`;\304FY\"M\267\241\267\226u"
+	.ascii	"^^y\331\004q\354\205\217\261lV\224\rr-7\227e\245\024\207\255"
+	.ascii	"\f\342\030\006\276\357iu+\373\003\007\345$4w\317LE\345\001\247"
+	.ascii	"\225\3158c}\334\376\250\3115%m\266G\326\030\232\245\036Xtj\316"
+	.ascii	"\3444@b\212@\321\250\367\252\331|\362l\224\335P\303\226\351S"
+	.ascii	"\303\270`\2032V\365v\332*\253C\204fN\366\2402\025\b\2376nb2\352"
+	.ascii	"\26592\300\343l\013\030\276o\t\256\272AY\251G\016-\020]o\264"
+	.ascii	"S\204\254\224\332\220\326\254\363\262\263T>\027\316\326\322\311"
+	.ascii	"\020lkx\2604t\336\350r\224\325{\337\325\f\274\0352"
+	.string	"lM\2300l\224\225j\274)\220x\224\"\207x\242\bA\372;\236\200\"\tS|LQ\023,\210\306b\021\370C\201X\334\271W\021\034\002\215(\206\302\2248\354)B\022\0367\240F\340Q\020-\332PD\"\006\245@\201X\274GG\300\3401\025\242\030B\016\215\020\300\0029\024\036! \203\021\277\021\033\260\030B\213\220G\301\241p\310xD\016\r\241@4\252H\211C_\n zt\323\343\220\030\314I\221\016\205\306\243\236\212\024\21044$\"!\021\203\023`\240\201\240\020\271\001\bZ\024\211$\"H\213CF\305\013\301!\222g\230\242\032s\216\277\236\36474*\346\f\215\212VEj4D\217z(\007\204\307\333\242H\f^cZ\264E\350\320Hx\004\364\025\241G\344\r\242G\337\215?\243b\b\037#PE\360\2660\246G\241\021j\302\205\013B\024\241+\200G\fG\301\026$\220\214\304\024F\264\030"
+	.string	"\264\b\231\n\323#\007`@B\323c\013\023?$\244\t\240\234\234\021!\216\276\253\b1Tt$D\242@\213\210#\030!Q\240E:h\n,*\236\260\343\301Q\310s\204\256@#P4D\022\215!\244\250\t\023\036\030\r\203=hJ$1$\nS\240\021\205\360\bH\342X\"C\032DS\364\203\235T8,\201\032K\310"
+	.string	"\002\b4\210\340\b\230\022O\240\306\f\026D\204hQ\004DM@\272 \204A\b\026h\321\260D:D\215Fdp\202\337\020\204\024=\242&\030\0253\240?4\005\246&\202\322\213\376L"
+	.string	"\340\301!PX\204\216\340A\213\243b\0218\301\203B#:D\215\3603\030\201\200\021\033\260\360}\003\016.\340\340\202\3367\340\200\210\210\203\021D\370#\210,Q\210\243\t#\232\036\tA\020:\376z\351U\2048"
+	.ascii	"\211\b\320\024x\204\f\036\001\203:\351\361',\232H\201~\360+Q"
+	.ascii	"\202\t\03648\004\246\307\241\020\247?\t\224\270Ca\t\303c\260"
+	.ascii	"',\036\355\361GBD\t\036\022\"J\350\364\202\"\204\366*B\034\221"
+	.ascii	"\350\n\241\261(\303\3617B\220\021M\217@\244\236\017]\001<2\201"
+	.ascii	",\"a\344\017\037\177\037\034\221(x\320\037Zlq\342\210D\241\343"
+	.ascii	"[\201\026\035\221(z\277\"t(D\201D\f\372\244H\334\002x\204\026"
+	.ascii	"\375\212H\234\246iQ\002>F`z\304E\344\257\b\210\032}\306\264\204"
+	.ascii	"\340\020\tB\212\206PD\376R\324\250\267\002-\262\351\221\003\210"
+	.ascii	"F\240\007>\324\210L\201F\264\210\204\236@\215\310\022\216\277"
+	.ascii	"\025\350\007:\351O\004\006\351P\350;\"\022=\370\345\244W1\200"
+	.ascii	"\023\213\250q(%\022\215C<\306\243 \213\343\317H\230bH$a\001-"
+	.ascii	"\266H\217H\024@\303c\360',\036\321\240p\005Z\004t"
+	.string	"<\242\306\242\"\340/(B\030\204\032\201(\024\031\201*|\322\337\006\276t\210$\006\177\350Q\021\tx\264\220\242x\364C\217B\342\360'\375\215 J\207B$>BW\374R\004\177<\351\317\bx\202(\364\235\210\210\304\206\023H\b\001\007C\030\321\024E\032:\032\211\307!z\034\032\n\201HCA\343q(\204"
+	.ascii	"\214\200\351/HD\177D#\020E\317\233M\2363\035Rf|\261]Q\274\336"
+	.ascii	"\302l\221\331]\221j\252\271p\303\301\346\364q)\275\362\266l\271"
+	.ascii	"k\nX\223gx\371]3\2733\352\226\236\334.w\263b\006\251\367f\227"
+	.ascii	"K2(\007\352\255\216\213\026>P\0165\313\305\243-\251\244^,\315"
+	.ascii	"/((!\314,SX\212\\\033\2144\035=A\234P\261\301by\b\251\001G\354"
+	.ascii	"\236\365(\247\256\210\251\367@3\314\226SC~\034\271\362\303\r"
+	.ascii	"\217\306\230z\357\224;\345V\351\274\\\243\001\216\346\245b\331"
+	.ascii	"\202p9\257\204qQ\371\210#\245\257\364j,\305\241R\313\354\217"
+	.ascii	"\2539'C\352%\373\311\256SC\332\226\b]T\362\236\\\277O\270\256"
+	.ascii	"\363\252\345\314\264\374\251\353\342f\n\312\257\363f<\340l\374"
+	.ascii	"\250\367\212\335\354W\236\300\ti\376\006\331\221\344RR\357]r"
+	.ascii	"\301n\330\025\034\345S\034\376ur\325\204\025\201\253\367~a\246"
+	.ascii	"\0370\035.\214)v\316z\177\277|\252\216`\365\250\3672!\372m\222"
+	.ascii	"cc\215\207\220zy\372B\357\"\271J\256\327\216*)2+\3707\311\222"
+	.ascii	"$]8|\020d\271\275\361\372\352\264\2362\311fG\275\267KG\312E\203"
+	.ascii	"\233\250R\3318\311\322\230R\206fFdF\222$\215\001R\n\020\204C"
+	.ascii	"a\036(\352y\022\2404A\316:\307\314\210\210H\222\202\224\322\034"
+	.ascii	"\364#p\245\273Ih\006%\260z4\244\254\223\3470e\235\f\027\224w"
+	.ascii	"Tnbb\326l\005\236\270\302\356\"\001\213^u\006-u\3106\006/\357"
+	.ascii	"\034\341#\f\211&\226\257'\006\315\220\2748\311\033\346\233\223"
+	.ascii	"\257[\333' \"\274\314\232AQ\231\263\317\f\017\256\252\036\357"
+	.ascii	"\036A\006\312\247\236\006:pD&\270\036\370\rIVc\034\2028\261`"
+	.ascii	"\204\260\376\365\344\321\017\340\223S\317\356\004\214\235\033"
+	.ascii	"5\2664nF\224\327\032;1\321\t\227k\001\337X\326|\036r\220\354"
+	.ascii	"\355\276\316/\2457LF\240j\355\252\211K\205dn\335b\334\346m+\022"
+	.ascii	"\344u\370\tm\352\310\200\333\033\033\355\245\244\003\274\255"
+	.ascii	"\273\312\326\276\316\034\261\232\225)6\207\212*\312\325\262$"
+	.ascii	"\345\355\201~C6\315\356'q`,\304#\\5\316`!\355\016E3\331\325\232"
+	.ascii	"<\266rj\341\003\210\211Zl\2018\246\364\230\320\316\344}\325\027"
+	.ascii	"'\255\346\354\374"
+	.string	"\n\371~c\3179\220\035\200\372\277\334\344\267\2162\004@%hX\353\212KU5\242\325\325\327 \275\310\226\350p\002i\247\241\226\230\373\001\314*\347M\332\343\203\372\026-\355\307\033\346\203Z(E\201\215\274\343'GU\021\345\334Y7\270\252\326q\322\316\017\204\335\022\255\233-\n\271;\235\f\312\213\360\275\357\337\272\315{\355\324[\203Re\241`bo\200\207\306\007\275 \255%B:\3521\024\316\237\025\236s\265<\264\332\200\342\332\341\"\321\336\2249\273N;\241\036\211cXo\b\200\206\245\372v\3701\266\030\326k<D\257\016\237~'!\327\357@\213\341\213\035\316\212\2260E>\302\324\261\366\320Wp7\337\264?\304a\331\013Q,X\356\327G\007R\021\221\n\020\027\211\256F\255Bd\214\227_\365Q\004\277\223|\037\233\260\204\274A\355\256\226A\362T\325\022\226\256/\n\250\260\373P\343YVA\334\211&"
+	.string	"\021\264\256\f\034s'\227\241"
+	.string	"\323\205\r6\025j\367z:\004\226\203;\226\247\3108\200\231\320\177\343I3\265\264\300\250a[\223\205\371\264br\005\277\034|\241\321S\324\225\364W\316\210\326\2472\341\221\305=b\217\n\347u=\334aa\255\037\3034\230\t\202Z\024\021N+\240\346\202\272\343\362t\312\353\n\331\300)KD\270\205\245\245\315b2\205\276\2348\334n\3609\256\316\n\222\237\355\306\242\350#k\"\301\263\345z\206\316\251D\264^@5\301Y%@)#\036\344\352`\255\355\222w\236\307+\233x\344)t\355B5\315\320\237S\264\225\002\031\256Y@\355\332\342Q\r\036\345\334C\226)\030\336\222\345V\375\230\347\016=\225"
+	.ascii	"dg\264\205\376C!\264\356\230\013h\313\347\016F\274\300H\275\204"
+	.ascii	"`QU\334\342Tsp\375\267\315\263\375\273\363\314\002W\226<\373"
+	.ascii	"N\236\354\220\002\032\nb\377\260.`\234\371\303\343\226\237\371"
+	.ascii	"+\207\n\367\037\033\213|E\021\365K7\030\2707\tk\303\213\332\370"
+	.ascii	"\367\271Ij\370\355\246O\243g\2063$\265\310d\376x\242\030P\325"
+	.ascii	"\300\214c\200\235ni\271R$\350\312\276\233\026\002\006\306\227"
+	.ascii	"h3\214\343\301\331\032\356\210\264\263\210\242?>*+\035\374j\304"
+	.ascii	"\347\310o\270\201'K\344\240\250\302\234\327>kR\326\273\200zp"
+	.ascii	"\200\342=\236\030\003\205\276\034\2620\026\300\\2\224*=\206\336"
+	.ascii	"j\324\337j&j\272\323\022\365{C\031\250\347\320\261\225\261\331"
+	.ascii	"\224\257\003\342\375\260\200<\t\031H\346\017@\241\202\303$W\270"
+	.ascii	"\332\016\212O\373j\fFH\367\301\351\257\366s\227\262\305\034\311"
+	.ascii	"\326\214\227\t\021\353\025\230-!\350JPog\321GN\177\213H\315\233"
+	.ascii	"\302\303B\025\341\242\r\020\271D\263\200\300kf|\353\237\314F"
+	.ascii	"P\237\216\"?\034x\223*\223\037J\301\243\004\017\305\210\222\034"
+	.ascii	"\027\016H\257PS\310\230\373\013\242\362c\332)\371\r\221j\bm\205"
+	.ascii	"\037W\362\311\242\222|\367\034\240\225\352W5\314\266\266<M\343"
+	.ascii	"$rC\007\203+\272\225\242y\342{\035\217\330\360N\352\3751\344"
+	.ascii	"\002 +e\365pz\024#\256\255W\246\006\350\371M\017G\223\021#\316"
+	.ascii	"\253\275\313#B\262\226a\374\250l\"\333\007\\\266\330W\234\222"
+	.ascii	"\207PT\326 \022$\245\270\244\273\026jb\022"
+	.string	"\245\262\305\315\224\224\fm#<,\336I\254\353\373[?S\002\356\301\300\331\330)\223\002q\350\240\201\206d\247\200sv\202V\234\330;\034?\222\242\3324Lv\231\376\367\024#C@B\224RV\246gP\032'1\230@3\021bpD\353\023G\005\321(5`\226\261\244l\224M\2002\004\252\034\37073\202U[:\303\004\rL\320\224N\332\366z\344&\207.\212i\274\205A:m\241\273\001\326\374i\n\035\211\021qC\211\\.v\023\t\214\350M\375\215\257wT2\246m\331\030R\347\222\351\230\036\262\"$\256o\270\036\016llp\267\013\231\305\224\2409\t \354o\t%J\265\020\210\026\236\013c\304\316\340\203\003q\300\305\243\313\2144\313\375>\251>d\255\337M\220Hq\241\341\272\314\220\342\205\352+\022\331\t\220\201u\364\036pG\320\2746\246/\334\241pW8\252\212fb\304c\352\362W\264]\016"
+	.string	"u6g\240\227k\202~?\025\212\025Y\274\326\n\037b\315\236$\007&\223\211\215\351 $\222f}\352+\004\310"
+	.ascii	"{\330\216'0,\346\272\031p\r\332\352\236'UBs\210\360N\341o\032"
+	.ascii	"!\246\300M\363i\216\204\rpj\215\034(\206UM\307\363\3457n\026"
+	.ascii	"\215\350\245,\206\237&\232\206\367O\004\005\b\255\2210\251\350"
+	.ascii	"\267\321\317\3163\034\255\204\270\315`\305\356Z\306\352~\311"
+	.ascii	"\032\354\217\270\343\2077A\265\304\027\317U\036\351\264\007E"
+	.ascii	"\023\204b\341\227\f\300\200\b\215QA+\252r>\374\201\217\206\266"
+	.ascii	"\001IB\321y\311\220\321\211\360\034D\370<\3665\277P\034\371\026"
+	.ascii	"#\352\006\252g\242=]\234\257_\344\206\3250\341\006\016\364m\001"
+	.ascii	"\274\373?\362.\217\222\252\021\204\200\246\037\307\361\036`\233"
+	.ascii	"\223\303B\340\214\221\021\351.}\367\273\315_\366\"\315\002\254"
+	.ascii	"\207\364by,N\320\277\311Y\353\313\266g\033Aac\306\337U'\275/"
+	.ascii	":vo\362\323\363:\236\231\240\267\346<\270\177\251\274\021p?\r"
+	.ascii	"X\252\372\330\221^\223x#\370\354\n[\231X(\2318\231im\034\"w\217"
+	.ascii	"\343\031\3634\322'\216\216\221\333D8\217\332!\006\233r3(\366"
+	.ascii	"{\207'c$=\370F\374wh\354Nz\263\376z\257w\341\211l\213\262\030"
+	.ascii	"\020\335\220=N\262\007j{\360,x\303\376\372\fP\227'\033>\3714"
+	.ascii	"\363J\345\232\312\216\356\3174>\3477\325Z\357\316\342\356\371"
+	.ascii	"\370\373\337<\251\373\340e\321\334\345\357a\027n;\372\036\362"
+	.ascii	"g^0\235\251\f\260\334\367\307\323!\256Mz\311q:\017\347\244\025"
+	.text
+	.section	.gnu.lto_.symtab.d8159e8932f4a8a2,"e",@progbits
+	.string	"pgResetFn_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"baroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"baroSetGroundLevel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"barometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"pow_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d8159e8932f4a8a2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
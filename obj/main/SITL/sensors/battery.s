@@ -0,0 +1,1655 @@
+	.file	"battery.c"
+	.section	.gnu.lto_.profile.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\006\002\035\016"
+	.string	"\204\022\372\002"
+	.string	","
+	.string	"\254\372\361\363\002\024\002"
+	.string	"\002\001\002\003\002\004\005\002\004\002"
+	.string	""
+	.string	"\002\004\001\240\342\234\212\n\002\003\004\314\346\255\372\005*\002\006\002\007\002\006\002\006\005\002\005\005\002\005\005\240\342\234\212\n\006\007\b\t\246\300\251\343\t\002\n\013\311\215\301\376\005\004\b\002\t\r\347\217\220\351\016\b\002\n\002\001\002"
+	.string	"\002"
+	.string	"\017\203\271\332\373\t8\001\007\002"
+	.string	"\001\020\021\023\313\322\375\213\007"
+	.string	"\024\354\206\342\366\025\026\027\234\236\237\233\f\004\002\013\002\f\030\361\220\342\261\005\031\256\274\321\260\005\026\002\006\r\002\001\032\033\204\225\341\235\001\n\r\034\352\263\360\321\b\035\373\310\241\374\006\f\016\002\017\036\336\253\202\201\b\016\002\003\002\002\002\037\314\344\207\235\n\006 \355\241\206\304\017\002!\250\267\374\351\002\001\"\300\253\277\314\017\007#\205\246\225\244\001$\317\356\361\267\004%\350\300\306\254\005&\307\266\257\307\n"
+	.string	"\002"
+	.string	"'\241\365\225\242\b(\367\345\303\353\007)\207\312\266\244\016\002*\320\374\270\356\001+\325\241\220\227,\317\266\256\202\001-\355\220\274\212\006.\240\342\234\212\n"
+	.ascii	"O\250\241\251Ad\354f\013Z9P\002SC\304\007\021pQg\216\223e\337"
+	.ascii	"p\254\357\300\324\304O\204\210\246/\207z\362A^\311\330m\362\300"
+	.ascii	"\340\002\341\342+\300\375\320\226=\353\332\252\246M2VT\223\032"
+	.ascii	"?\224\227\210\236\360\002\205\352^\362\350\315\210<Ul \311z\242"
+	.ascii	"\347\211n\342qu\212\026\347e\243\206\231,<\022\273j\013Y\222"
+	.ascii	"=\303f\211\355l\351\026\222\247\272g\271\301\033\002\364.+\n"
+	.ascii	"\3639\023\230y\206\327n(X-\020C\202\200\212\221y\035S\366 \324"
+	.ascii	"\335\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375 \314\275\003"
+	.string	"2\005\021\034\220G\303\001\377\377\377\377\377\377\377W!\"\"\"\"`F\226\235-+#\361LF\246\256b\023\213\330\303\032\266\260\204\035\254`\003\013\250&5\255\264mK\350Yg\233evY%\0312\217i\350\332\214\\\004\025"
+	.string	"E\b\243\263`\346\335\235\246A\233\231\020p\001V\260\003\307\252\262\2222"
+	.ascii	"\240hQ\342jF\304\274\033\224\221\234)\260ae\360K\030\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.inline.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\366\003\325\f"
+	.string	"2\31799 \223\322\001"
+	.string	"wg\256\035\207e\261R\377z\030\031j\201\320\223L\214wy\306\236\327\007\b9K\242b \204\013"
+	.string	"/\027TU\305\316\307\264\367\223\036q\376\234X\"\345N\001\276\260\250\240\230\020w$\021\001!z\370\220\231\235"
+	.ascii	"\330!@K\376wn0i\317?E\254\177\202\f~a\376\2311*\352\237\240\031"
+	.ascii	"l\351\322j\263\355}\246\214\325\222\202\241\366\236TUS\271\220"
+	.ascii	"\274\200\332\233\377\243\323\306`#)\320\n\313\261$\200\0208t"
+	.ascii	"\375u\374\237\366\327\007.\255F]\321\221\325d*\007\306c\343\030"
+	.ascii	"\033\020\254-\007d\b\016\t\355\333\030\210\211\352sA\270\231"
+	.ascii	"\364\343N\2428;\\oS3\255\032\317\002\235\322^h<6FU\231\241\210"
+	.ascii	"hxSk\250\377\317\331\242\256^\256\026Im)\252\354\345j\205\354"
+	.ascii	"\220\267\235Q\2501e4\301L\325\312\306f\200\002\231\271\252\016"
+	.ascii	"\022@s\201\206\341\030\343\f\022`\303\2043\023?\037\216\346F"
+	.ascii	"\363\361O8\252\005\205\221/\304\tX\034\241\257\200!\253\230\310"
+	.ascii	"T\277\035\211\346R\007\316@n\243#\2652,\325\226\331'M\373\037"
+	.ascii	"n\376fF\007X\220EA\322\"\272\303\223r\020m~\2461S\3645\0319="
+	.ascii	"\023a\232\013\277Mf\366;\004(+\212-\212\354\240Jw\206\217\245"
+	.ascii	"\t\035q3.\372\243\275\325F\360\273\355(6C\037\3109KY'h\264\270"
+	.ascii	"\342\330!7\376q\233Z\202\346R\017\016.\355!\266\034\226\206\351"
+	.ascii	"\325\\\236"
+	.text
+	.section	.gnu.lto_.jmpfuncs.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"m\006"
+	.string	"\"\313 )pK\222\306\374\377\277\252Aa"
+	.string	""
+	.string	""
+	.string	"8\301\372\377\242\325\252\252*@\"\375\377\377\377\035\037\016\255Z~\260\r1\304n\231\002\307\370b\213+\246xb\211#\206\370a\2077|\362<\317\203\212\251\325\306\360\205\025\032\206YF\252f\233\005\201\362\203\r.\2302\301\003\367\324\223\363\330:\366N#\025jVI[%\325r\024r\n\024\2442\013\030`Y\206\234\310\220\263\221m\244\252%\021S\rd\233p\037\001\035"
+	.ascii	"\030\206\333\243\340\324\026G\314\026\340&\256\324\323\217Y\354"
+	.ascii	"\214u\240\262\027l\n\003\213\316\032\264V\300\032|<C\b\336\003"
+	.ascii	"\0202\200\273\322\020\232R\233g\n\r>\2519u\205\247)h\f\b\201"
+	.ascii	"f\016`\364\002\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375 YM\002"
+	.string	"\222E\021\032\220\2730\006\177y\363\377\331\377\217\300u]\327u\335\210\236\210\300\356\035\274L\006\376p\2077\234\341\013Wx\302\021~p\203\027\034\301\r\234\300\003nr\222G\016\371\343\216\221\3061nq\212K\234\256"
+	.string	"U\005\t"
+	.text
+	.section	.gnu.lto_.ipa_modref.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\365\005"
+	.string	"\242\207\026\037\260'\303\001\f\3030\f\3030\f\\7\024\226\020\262\t!D\332&KP\230\031\325\255%\231\002:\032\212g\304x\026\n5R\241\365(\364L\313i\024\367\354\326\233TB\020\007}\005\347\331<G\320\201\353\230'\263\354\226\247\"\b\250\2473\354\022\257\332%\317d\227\006\210\270G/ \320\002\021\233\365\246\210"
+	.string	"\276\207\036\254#\335"
+	.string	"\036n\211\231\bD\022\374\007\361}\260\322:\241\3661\244\323\200\002\362\242\352(\221\223Y1*"
+	.ascii	"\022x5\340\341>\271D\0233\245\261\006&`\026\246\350\026\306K"
+	.ascii	"|\206\265\002\013\306;h^T\371@J/\370\026l\363\025u\034\254X\344"
+	.ascii	"\241\025\312\r"
+	.text
+	.section	.gnu.lto_.lto.67b1fe2c597a78,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.52.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375 \242\315\004"
+	.string	"\264\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\337\301\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\376\006us\250\326\006uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001'\001\213\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.54.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375 \263M\004"
+	.string	"\224\006\246"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\002"
+	.string	"\n\036\005\001\006'\001\232\003\001\005\001\006\177\177'}{\344'\001\254\002\336\312\256\003?\202\210\200\330\002yw\312\001u\311\001s\310\001q\307\001o\306\001m\305\001k\304\001i\303\001g\302\001e\301\001c\275\001a\300\001_\277\001]\274\001[\276\001Y\275\001W\274\001U\274\001S\273\001"
+	.string	"\016"
+	.string	"`\b\230\013\216T\354\201dZ5\001r/\307\204j\217\247Dp\002\332M\021e"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.55.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\226\002\035\024"
+	.string	"\306#\201I\260\326M:4\316X\211\345\345\256\006\330<< \376k\214\361a]\267p\001\222$3ld`\215ZAfm\333B\351\210\2155\306\317\f_&\022\227z^\343K\207 \277\023\364\3317\307\272\t8#16i{\223\275S\nl"
+	.string	"d"
+	.string	"q"
+	.string	"3\340)\202\303\324\323\357\002\352\251k\266\223\363\222\366O+~\236\266v7\2343^\373\013tU\372MY\363\025\324\260\032u\266\277~#:\370$@Dgz\202\034@C\322\345\342\365G\205\2442L\2763\375\343A\003\310\250\023\372\374`\260d4i\321\341>\231\242\253\240\027]NJW\204\335\265\034u-n\226\333~a\373\201-u\004UN\002NY99\305\266\210;\365\200\273\271\032\377\307\233d\276\322\251I\314\344\307S\177VO\345\204\020\204\243h\267t\223Wl\036NN$\373\337\356\256\347\221\375\245\277Ri\372I\177SzJi\031@\203\321\026\024\006BvY\\\241\262=:\344F\213\355K\373>\276\253}\t\205_\2731\242\244vy\r\034[c\365\315?e\275\312\337\3249A\234\352Dn|%_\300\301\251\247s\322\246\253\035C\264\300\224\2241\344\030\351\345\2146\006"
+	.ascii	"TUONia\301\370\006\310\363\036\245\003\356\336>\372P\017\262"
+	.ascii	"\201\203\216\374\250S;T{\007\306\262\324K1mv\221v\b\036\371\321"
+	.ascii	"/P\273\036n\332\f&-\320\356\306|\240\222\222\362\304&\253\334"
+	.ascii	"\306X\324\233?\021\263\234X\017O\006\232OL\024K\300\\\f\2431"
+	.ascii	"!\306h\264\035\017\341L\224\315|b\263\320\207g\247'\204\211\263"
+	.ascii	"\220\346\200e#bbH\223\311\304\260\205w\373\267\363\310\026\264"
+	.ascii	"z\267\211{-\220v\255Gm7\247\355\340D\362\253>\247\001\241%.:"
+	.ascii	"m\317\374\252\306\024&\355\256\003\377\310\221H\230`cSO\253\222"
+	.ascii	"1\3127\351\374\217\025Sx\221\n\340n5 \200\002\031),\017cB\007"
+	.ascii	"K\214|(\367\006m>\327EFQ\"cJZ\330\004\257\007\211\346\330\300"
+	.ascii	"s\223K\326\314!\215\256\227\207\350W\214\255\305\263\211h\366"
+	.ascii	"\234d\376\321\261O\266G\203qw\327\340n\374\236J<7\024~^\020\355"
+	.ascii	"\037\001#\007,\314\002\033\242\356z\201\3266\300\365\355\"^\243"
+	.ascii	"G\227|\223(s\236\331\345r;\020\364h\346\253(\307q#y14\202\330"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.56.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`@\001%\r"
+	.string	"\326WVC\020o\234\0169j\321F\023\022\373"
+	.string	"#.\b\3128\017\264\207J7\005w\360C\373\034\222\006\013\320\200:\361\217\352\353\2761\f\207\320\265\001W@\005*\002\002"
+	.string	"\310\325b\004B\222Jk\013D\264\311\226)\005C"
+	.string	"@"
+	.string	"E"
+	.ascii	"\237\317,\262I\036\252\226\222\362\210\020\022cw5"
+	.string	"\251\341\242\317K\252\310W\016\027\037\350}\026\200q\275\343\027\b\326\310\007V\270$\225\260\001+\221\r\026\320$\225b`w\255\037H\341\306n;\201m\214}\216\017@\372\357\323\007a\237R\036\344\212\201\245B}\234F:\332!Ie\312\276\034\307\321\304r\303V\265\3042\017-0/v%\2142V\234*8\330\276\377q\220\320=\254,N\273\233}\332!;\013%\351\371%n9\021=\235\361\225\310j\205D\341\247P\353\267\246V\207\315\020\342\2330Ie\327;\352\377`\237*`!\244B\224\354\356\345$|TE\265\0236\334K\307\021\214\210&%%=\261\037^\304\307g9\336d@\034\307\343\321(\320:n\353:\234N\353,\3200\3206\\\247e\bxk\300\3414\317\266qZ\026\216~\255\334\360\201\017\342H\222\374\021\377\265\273;)\027N\034@\313\302\245\241\225o\230\355\240\323\177\016\320\002\305\036"
+	.ascii	"3\241\233)\006\340\005\017r\201\354\300aS\r\017H\261T\342\340"
+	.ascii	"\312g\006\272\306\022 .\350\307S9\024\335\3511s1\263\215d6\026"
+	.ascii	"Rm\327\0055\240L\27441\3169\230\302_\016i\032s\252Q\340D\347"
+	.ascii	"\226'"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.59.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\343\n\2656"
+	.string	"\312Z"
+	.string	"\024D`\332N\007\277\277]\273\202k\302p5\337\351\025\225\267?\340\273\315j\214BZ\305~\241B\002\306\f\332\212cX+\273\250l\360\313\006\277l\360\307\017\235x\253\203IR\bD\233\232\027!![\356\235RJ\0010\001\020\0012\001:\246lZ.+\025#m\327\215\327\035\245\237Y\216{\217\221Q\216\214W\\F(wa\206mK\2674\346\245\341q?y,bk]\327v\334w\214t\302\214\321r|bl\f\231\\\323q;i&\335$FG\231O\251E\327v\261^lR\344\220z\345$c\257\312\006\272\275\252\355sc0\367\\Cg\264\0347\t\372I{e\236\301\214\354uE2\223\271L\323\235\265]\267\330\254\223\266m\273|\"\315l"
+	.string	"@?>=<;I\235\034\034\344\315\321\310\336U}gr\033\220+tv]5"
+	.ascii	" 6UY \220\253\210\377\254\265\317ZO\232\232\363\244A\321|\207"
+	.ascii	"\355\314\223*\020\233\232\240\215\013\210\353\260\024<4\341\314"
+	.ascii	"\224y\261u\016\216\232\300p\n\232\016\344\032S\201t\2609\305"
+	.ascii	"\034Y\240\314+\254o\302\366\272@\033\327\017?\262\024\312\274"
+	.ascii	"\306\332\b\326\306\365\345l\\\323\357\212\354\332rU\247\213\206"
+	.ascii	"\252l\333\266\363\264\374U#@!c:\220\213L\r@\326\307\243\343\332"
+	.ascii	"mte\271\263\024\332\266ewvy5\0075s\2631\263\023\36311F\376\232"
+	.ascii	"\213=\366v&]\225?\025\375\373\320\177[\224\237lk\003\307`\324"
+	.ascii	"\030JQ\377\311F_\364C>\nAt_\bc\333j=qgi-\"F\220 q{-\372\th\320"
+	.ascii	"\316c\250\306\022el\333\366\211\333J_\221\342^\353\225M\240@"
+	.ascii	"q{5\372\316k\004^l\024\241=%\0210\310\367\321\365\027\022S\213"
+	.ascii	"\372i\271\032NN\247\3236}t\373\375{\213,\253\2474\225\024\334"
+	.ascii	"k\274\202\312\333Iu{\355G\n\326)~a\371\224\231.\313\377\311\334"
+	.ascii	"j\373f\314\253s\004\326\031\002\353\374\200uvp\235\033\\\347"
+	.ascii	"'\326\231A\3335;\261\316\013\256\263\002\326\271\351:3\261\316"
+	.ascii	"\313\306k^b\235\225\256s\022\353\214t\235\215\256s\321uV\262"
+	.ascii	"\316\003Xg\242!\326YHu\016\352(\315<\327y\347:'\257\263\316u"
+	.ascii	"\316\271\3168\2533\222u\276Y\235\217\253\263\221ufY\347{\235"
+	.ascii	"\327\353\254\256\316\257:\373;\267\204\344\017\300\345\264m\003"
+	.ascii	"\177\371\346\034+\204_\345|\327\021B\221\2173E~\307\265\222\220"
+	.ascii	"+p_9J\277y\346\n\026\274\235\254\324\372+\016\372\033*K\376\232"
+	.ascii	"\213\323>\272<\037tC(\227\004\347\237\334r\207en\214o\207\320"
+	.ascii	"\343\320\363\274\r\0017\302\261,J\330-\340\036?\302\2637\277"
+	.ascii	"\244\027"
+	.string	"\216\317\036\362\301}\031\3214\317\033_\306\222\273\346\"\362\237;n`z7ofd\377H\3540\272\205\375\241\367\304\346bR\337g\237\310o\213l\375\253\276\321\257\317v\331Z\302\374\241\017\317\250\337{\255\272U\321S\204\036\377\271\013\333\020C\006\r\032n\2572\340\366\234g\224^\334\300\214\377d\016\367\277*\032\206yC\217\341 \346\237\215\346\301}i\302\016\317\347<\203\225\342zA\356\270\223\"2\223</m\354\317\362\305\b\003\001\017\005\375\226~\371J]\266\244J\217\364KO\244\267u$\351\225\276\233\213x\354\241\005\003\223\336\371\320\240H\337OZ\235kK\314\372r\227\005\2267x\007<\321OE\373\274\231\357\n=\321\007H\334j\313\362)\027\275\320\263|\315E\243\037\360-\002V*THE\255/H8G-\301\250\222r\341\002\252\304\322\252\212\312\212\205\224\325\222\005\n\250\025\313\250*\253\345\222"
+	.string	"\246j!U\265tAEU\265D\322a\365\2331\2070.X\237\005\300\323z-\3111\253\2134\352\242\261\207]\336\272\320\207\fbAt3\347\341e\035\327H;\376\244\210@\377d\367I\352\206\266q\360\017\332c\003\251!\034p\216\025\376\374\263\257\206\032C\2377{\360M?\025\335\302\245\035\374\203\247w\360\215XfN\221L\317?\271\3013\375T\324\357\203\007q \r\360\252\2549\344yz\246?(\203\3601\261\247oh/\233\354 \222\306\313\316`3"
+	.ascii	"\",\343\364\f\026|\323;)\370\005\036\374\207\203)`\372&;\206"
+	.ascii	"r\037\336\203\351\373\256\017\210\361qF6\347C\366\n\365\222\235"
+	.ascii	"\342\366\023\030\023\363P7\260=\235\1772\325\320\334\213\251"
+	.ascii	"\326\025\355\223\"b\r6\206\313\314,\34290\020\201\361\033\216"
+	.ascii	"\203i\204\211\204\351\346v{=V\351{C\334q&a\306\325%\037\347w"
+	.ascii	"\376\372)\361\032\315\3447E\257(Bu\236]\313iD1\341\230q\314\270"
+	.ascii	"\333\353\267q\236\311y\234\327\t\200\351\250\201(\005\021SJ\321"
+	.ascii	"\210$I\nY\016\200\002\221)\262\352\022\2005E\2111\223\032\223"
+	.ascii	"\235\3757c\260\365O\035\005x\t#6\021\377\2329\304\316=6\033f"
+	.ascii	"\016\023:\r7\247\335\321\227\323\310f\352\371{Q\342\245)\034"
+	.ascii	"I8\034\221\261b\277\277\251\363Z\336\307\337r\202\355%\237a2"
+	.ascii	"\200\213|\344\337\005\345eD\027\252\332\206\345_l7\364\001e\327"
+	.ascii	"g\272\305\003\230"
+	.string	"\201pA*\204\315;\270\271\301\252 0\033\203\330>\231\037\211\247o\0012\366\370J\301\314\237\325]\001e\024\355\256\366\024aA\350\220\205\032\374\354\331\007n\261\007\016\312\234\177\311\267\276\357\243~\035\365\351a5\245\020iX2}\307\336\307b\264\314Ad\234q\243\021T\230\253<O\374\3554\365\270\202\305w\266\024fP\203\007\375\202/\335b\244\n\273-\2265qK\027\220}l\267\013jCS\275\307\202\325\201k#$\325\335&\220@\211sl\332f\232r\034O\341@\0260\r\213\220\030\005Dg\342\210/\350\352\374\202\242\343\244\032\271\330X\024\263I\032\300=\266q\243\247f\324\213w\370\314\247\333$5E\n\211\300N]\362B\223\273.\331 h\b\360&\254\220Q\005\343@.\006\324\006\364y\330\001\316\242\277lo.\332\215\351\336AR\251`\253]#4\253@\304\020\306\227\032\221\034\320\311\253\337\365"
+	.string	"\326\207\262\223n\367\320`\353\360\371<tA\236\336\207I~F\3608Z \326\224\"M\341)\370\361C \3570_\347'\243\252;\360\256\326\037\333K\033D\313_\302\005_\353\212"
+	.ascii	"0\324\270\250\227\235f\t\225\316Z\221/5\210\375~\334\302\273"
+	.ascii	"\252\3642_\303\"\322\317S\003"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.60.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\203\007\315#"
+	.string	"\266=\327I\220\224\322p\035\005\360\372^\272\231@\017\340\200\337\013*\276\326\327o\253\022tJ\013\231'\377\314\007\206\262V\343w\342\221\205\305\262}\336\270g\b"
+	.string	"\030\231\033\220n\346>\303\227\005\300\n\370\263\350\254\031\331f\367\336[J\231\002\277"
+	.string	"\255"
+	.string	"\307"
+	.string	";\225\257C\3719\224\257\246\374\024\345\243'\377D\371}\362\271\371K`\005F\232\001\260uu\212{[\231(\231\013\346e\263)\227k\273<,\214\243eoY\213\376\036~\336\242\314{\322\337\334\345\212UU1v\364r[\327u\330*6i\201?_\217\267\323\345\324\024=\233\223\276\252\217\016\231TZ\340O*\212}=\250\345A\231\340\235n\261\236Hp\356\034\220DG\223\025\362T\342\f:\265@\356\326\002\300zR\262\252\372\244"
+	.ascii	"\246BH-*\344I\212\227\374\300\347/\311t\336l-7%\227\270O\034"
+	.ascii	"wIc\232\262\256\353N=I\235\254\372\254\353zF&C\354S\366_\341"
+	.ascii	"\377\004\277\032\f_\026\213\336\302\320P\272(\267Z\326|\322U"
+	.ascii	"\344\270\357\327\002\263\230J\034e\273\253V\354\213\203A4\331"
+	.ascii	"\370\336\330\346\325\212\002\354K\343\315\334bH\027=#\327\343"
+	.ascii	"\331\325z\375o\266\b\261\254uU\332(F\256\002n>0\334\2771V\006"
+	.ascii	"\206/\213\023\021y\221\213~\211\351\242\333\017\326\236(\213"
+	.ascii	"\034\367/\215\334U\377\236k\247\370Q~\217\312\337A\371:*\037"
+	.ascii	"G\345\333\234\374\232\223O\243\362\205'\177\006\345\313\240\374"
+	.ascii	"\230\224\017\243\362_T\276\013\312\017\242\374\226\224\317\202"
+	.ascii	"\362WN\276\n\312O9\371@\225\377C\371>\224\337K\371<\225\037\300"
+	.ascii	"NQ3\002l\265\314I\215\355\215\241\251\277.r\256!\225\024\177"
+	.ascii	"\2353f\3064\266R\332U\337!:*6\2676T\247}\275X'\2627K{\355k\341"
+	.ascii	"\032\023\026\257{\n\226\031\204\327\273\265\001\240\242\334\242"
+	.ascii	"\270\272vZ\247U&G8]\357z\247w\271\347\213\344Z\023\330\327\f"
+	.ascii	"\377\013\030\360\"w}cl\245\177\177\354Y\203\016\016\034\244\213"
+	.ascii	"\352\032-c\323\372r]\327\263\253\236\233\222\201\266\304P\256"
+	.ascii	"6\332\271\216\361b\2722r\334\323V\037\254\017\b\271u]*\360\345"
+	.ascii	"\261=\"H\2300!]4\355=S\353:\033\335\035k\026D\341\347']\364\354"
+	.ascii	"\r\263Rrw\357\021\356\007Z\262\240\334\272\256\005\2769V\207"
+	.ascii	"P\277\300s\224a\bi\303\260\210HDD\f\222y\020\017\007#!$$\240"
+	.ascii	"\n\303##\342Q\221\320\321\260h\b\210h\030dt4\344\2419Q"
+	.string	"\203\220\321\020\211H4\032\362\226\305=\267Slm\216\214\213Yl\343w\306\336\347\004\332\360\321\246s\310N\360\222J\344\313\255\355W\3234\275S\\\254\351\241\225\222\3278\232Vw|i\205m\217l\204O\030E\3309cq=0(p\274\231\006\002Yb(n3\355\243\202\3232K\243B\262\023k\362\026tj\201\324\365\264\314\246mL\313\264\220\tL\307\034\330\266%0RL\234\356q\351\227\306\351\355z\351\233$.\215\226\275i)\007D\235\211\310\005;\245\245W:\3301b,\335\322\\c\351E\263R\351\225#\b~Tz\303\324\002\200\233\250a@&\221DC\")HJ\222a\r\340\002\031\241\251:\021\020\245\203\n\241Xh\243}\003\013'%\030\2172R\277\007\222\256#\036/\227\301\242\272ua0Y\225\311\275\341R\361\313\310\334S\343\220D;c\233\230\317<\225\347\371\034Bw\027TAc~"
+	.string	"7\003\271tU\276\231^L\215\303\020\376l\305\251\336 \356AlC\036\201\213\262\252\354?\351\365+2F"
+	.string	"c\337\211\333B!\364e}\235\373\325\364{\006\236L\363\210\250\224x\372\275~\005\243\032\t{Z\314\303k<\276A\r@\t\335\333\252\370~\025\321\"|`SA(\331sk\017\306\201\240)\256A\341\230c\360\372\234\030\020~\035\2132YS\270\005\306\017\257\377\316\257\305\365\367\243\331\310\276\262\306g\254\242\320\202{8\315\353i\tgeG\"Qz\347\352\022*\025\n\341E"
+	.ascii	"4/\340\032\223Z\346\333bX\244\264\024/Zt\237\316\033\002\276"
+	.ascii	"\310k^\202\334\260\034\330f\260\\\016\310\261\233\205aGV\003"
+	.text
+	.section	.gnu.lto_batteryUpdateLVC.61.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\366\003\345\031"
+	.string	"\206n\244H\300XM:pML\021:\234\373\254\211o\031\200\203\205\313\214\377\363x\b\035\216p\315\347\2079\304\310-\377\207\354sXS\265\255\020\242\255\016\213\215\261MQ\020dK\366F\320\374\215\007\354\226?L,!do\"wJ\001\213"
+	.string	"\202"
+	.string	"\230"
+	.string	"\316\261\303\317\207\266/\355\353\370\321\316\221t\f\326\n\243\210\221Zs\020\374\340\373D\360\025\375\354>C?\275ccyn\250zDC>K^j\255\254\225\361\235\253\300\317\243\263[\271\343{5\340\317m\304U\t@\257\006\306\t\026\377V\3240\241Bz>\222\246\370\fo\266"
+	.ascii	"7\022\262\353\032\340\232\202\002\334l\335\nJ\214+\341\255G."
+	.ascii	"\224\t\026\035\202Z\353w\\\226\270\325\244\364jj\255\226?\267"
+	.ascii	"\023wx\3337lW\260\027*S\256'\224\344\213\nYk\035\261;:\312_\364"
+	.ascii	"\313A\311\251G\202\261\335\341>^_\255=\021\374\036_\372\340\027"
+	.ascii	"}\032\026\223\377\371\364c\364\363+a\034\302\035"
+	.string	"!\361\310);W\223;\332\357\352\n\331\236\364\212J\317\034\351\227Y\351p\245U\2364\350I\177\236\264\347IS*=\247t7\245\267\223\226+\375\001\013\206p-\210\210vJ\256\002M\205\251O\363\b\r\237\307\223r\2363\2031\n\247\343\323\001\337q\001I3^l\2112\263\253\365\272\370\214\231+\2633\373\244w6nR@2|\030\325\344\224\241\350<\315\235AM_\356\355h\344\335\212Oh\237S\267]\323\n$\272c\324m\250M\341Ml\230\204AL8\270\310\254m\341L:J.\2147pG-~\032EB;@\345\b\030\245\004\007\027\007I?\226\314\323\350\256\004\243d\005\303\213\320\276Zk\004\177\310\211d\320\260a\003\375\334\375\022\321\315D\002\310\250\333Q\376\206\312\025\225\252\034\310\203\334\370En\271\\\364\001\366@#\003\361\232\321X81\030,\326\" \263q\301^\025f8.Q\244\265"
+	.ascii	"\270E#Bt"
+	.string	"\315f7\034X21&\303q\311X8\257\033\030\253%\312X4\006\034\013\341\022Y\263XLd\2059\236wu\205(\240x\342\331\232\352V\252<\207\220,?Z\300p\247\330(\240\"E\352G\013\217\223\2536\334\333p\340\252\226:\345\270@R\277\005\227\201\030[\216\325z\373m\201.\266\032t\035u'\241\336\032\220\262\031\325\226\256\027F\b\223\317\030\347j\255\337\216\356\240\212\246>\201\2566K\250\021\300\220S\320\t\n\032\212\023$%\315\001p\002\031)\274:\021p-4\210Ha\266\031\371\214\2377\"PI\353i{\312\260\264)\352\235\bq\2612\212p\0178\367\321}\250\310i\227E\304m\266\374\205\310\246r\320uC#^h\350\365\342\"i2\3146k\373{.\3114\300)\210@\261\230\300\265\0319!\026\206\264\024X\022*~\210\237G,6\264\003\371\242\340%\301C\272\346\004\336D5\222\217"
+	.string	""
+	.ascii	"$u\\\310\034r\214\004\271r0\304\246\324H\376\301\030vu\311\273"
+	.ascii	"\253\260\211eE\246\345qd\231#\030\250"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.62.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\230\002E\022"
+	.string	"\206 tG\340\320(\035\332\203\370\336)W\201\003\320C\272\22513\366\325E\243\003\031\347t\307\036\213\350I\351\377\036\355\037GD\t\253\252\376P?a~@`\236D(\333 >\360D\n\bwe\242\021$,6\262\t!R\246\024`"
+	.string	"Y"
+	.string	"]"
+	.string	"\007\276w/\371e\023\375\026b\243\f\013\026\235\032\273\013*\210\277\336A\372\242\327q\232/?\212\220f4\225w\200\220>\240\026\016\334\007\211\226\227\214Q\304\203\013\314\275"
+	.string	"4\226\022\355Bv+\311\311Rm\007\001j\201\341>v\3676O\f\264Xf\024\331]\347\214\346r\227n\033\3076\003;W\002\366\311O\254\276]\331\002\377v\034\n\376\314;\267P\362\263w>\212\367\356\032eA%l\260<\262o\261\324\232}n5\306\376\315\035\2714\307\245U\323\231\351\227\004\364\304hP\264\233\341\b\307\376t=4\277\271}\023\276-\201\202\327oR\276\035\021wdxh\354\336\f\274s$\336\273(c\250\306\350cw=\255\371+\036\225\300\207\240\034!\217\264M\247\374,\352m?\215\206\016?1U\261o\273\333\245x\252"
+	.string	"lW\361\235\024\177\306!\n\345\275S\375\220\320\013,\217\362\234\326|\023/5s\244\236\302D'\365(\204rwUTk\276\005\357Z\2223C\2267\034(UJ\2252\235\204\017B\224\311\245\nO\254\320\301"
+	.ascii	"\237B*\260B\227\313T\002\266X\253\226*l\201\252\224\351\004<"
+	.ascii	"\261Z`H\001\257&\204,\320\265Z\261\300\322\rv\215\261\315?\037"
+	.ascii	"\237\037\230\306:\374\202+z!\335\005Q\215\221\307\356~ZsTN/\""
+	.ascii	"\007\006\204\373D\350\341\024\301\206!\033\266\230\037\361\374"
+	.ascii	"\026\347\031\221@\0227 \320\002\251!\363\263d\221\263\355o\262"
+	.ascii	"\237{\333\367n,\256p\344\346u\3672e\241\261@Gv\330$s8\007\251"
+	.ascii	"\270\362\2621\337\272\221\027\276\271\363\363,\372\263\355*\325"
+	.ascii	"ep\366,\246\302\356\205\221\315\364H\355&\227\032\262\036\217"
+	.ascii	"\250A\0039A\322\212d\267h9.\2320\270\027\\\031\316Y\201\tn\301"
+	.ascii	"\215\366\302P\b\275\335h\264\372\352\321\256\303\307r\031"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.63.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\b\001\305\f"
+	.string	"\266\327UB\020Q\234\016@\264\320;\212\005\244\321\001\217Q\277WD\320\337\212,@l\247\f\001Kj\364\311\232\006\373ZI\035l`\262'\245\231\214L\334*\002L.\2021\307\032\216N\034]\001\330w\243M\366N)@"
+	.string	"A"
+	.string	"D"
+	.string	"\340?$x\262\273\341\304\310\256H\300\003\260\323\313\001X\247\325-\326\251A[\306E\017{T\214\n\"$\273[g\207\203\227\240\177\220OBR\350\362B\260\273\226!\251t\317\333\026`\373\200}\r\001\036\366\224\306n\272\257\237n\353\037\177E\261\320x\221"
+	.string	"\306\356\205T\311\216TE\210\233\376\223}\321/\361\220\023\350\222\0321\200\231@\337\322\336B\016\024\311\214]\021s\352\002\330\351+\266/\355\2178\211\024p\214Ph\327\374\215\017>\352&@>\b7\330\344\303S\177\263N\255\371\220W\033%\"2\210d\312\024YM\273\303\271\030'<\260\264\260\244\375\201 \037Z\256`1\216f\310\026Crr\260_\355\356z\006\033\215\344h\244\307@\353l\013>\217\326u\237\254\303Y&B\247}\337\206S\275\216\363<\232W=\333\246S\263\316\253\231"
+	.string	"\346\034h]\3758\256\253\025q_\355\364\260\202\032\243h\216\214\315\024\331A~\f\327\264&61\"\001\032"
+	.string	"2\241=i`\\ \210\003\22755\036Sc\202\024\320\256O\324E\252\025 \034HA\263\3415\005C\327@/\356\226\320"
+	.ascii	"\374h\302\302E\035^A\004\234\242A\254N\203ky!L2"
+	.text
+	.section	.gnu.lto_getLowVoltageCutoff.64.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375 \365\315\006"
+	.string	"\362\314/4`m\322\001@\341\034\2217 G@q1-\373'J\200\320U\2306o-jia%\307b\252G\350]V\242\002\234f\201\320\261\226@w\304\222M\366N)\266T\030i]W%\001N\031\347\305\232\360\242PY\200\0269a5\340\310`Ix\305(\341T\367\316cs`\322\356\346\324\337xm\360+\376\214\301\332\351\237\217E\177\004\033\347`WMs\022\366\241u\036\273Q\237\020\004\221]\210\223\317\202\274\017\013\333\031{\3621\236\221q&P):"
+	.string	"#&\017\035%\273\025\272> \372\223NE\177n\342\331[\346_\343\320\205\007\t\345h\336(\007\273\353F9\235\333\335v\201m\003\333\021\001\b"
+	.ascii	"2\003\336::V\b\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryState.65.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"B\r03`m\322\001@\203"
+	.string	"\247@f9\364\2515xW\025\001\251\"}\321+\321,\352=\234d7\320UBoJ\207\223\300\034\205<\027\253\026\370n\311\336R\246\024\316\\6p\262,\214\302\253 Ui\246\352i\0260\f/\003\253w)0\3250\301gQ\024|R\334+(\325\362Q\007\373 \217\227\257\341\r'\217\335\371\234\350.\025\240\342\223!;zR/\354\267\335]+\310v:\225\200\342$AdW\"\224\262&nd\303v\307\226\374\216{t|\265\230\221\005D@<\204\240\354\306g\371@t\327.\020\335)\306\257\347\345\377\343\215\243\204\004\313<\317\n\302\356:\261l\342\326\3336\260}`\333\"\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_getVoltageState.66.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3pM\322\001\240\f\030X\201s\303/\017i\234\201\231\2105x\233\242\212ZC\332\366pd\3242\345\244f\356\177\327\277\260\214\356\2711\f\334X\262\267\224)\005\306X4P\252\252\313\302\243\340De$\352e\030.\r\017\003\251g1\360\344 \301WM\023|Q\334\353'\265\342\321\007\373!\217\226\257a\315&\177\335\371\033\350.5\240\302\223\231\035;\251\027\366\333\352\307v:\265\200\303D\341dw\"K\331\0227\262a\233cG\276\307?8\266Z\314\300\004\"$ DPv\343\253\234"
+	.string	"\272k\037\200\356\024\343\326\323\362\017\362\326A\222]X\347\t\220\260\273\316\013\243\270\365\266\017l#\330\266\b\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getConsumptionState.67.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\203@\324\020N\201U1k<\226Q'\206\236|\336\n\321,\352=\234d7\320UBoK\020\025\340\024\205<\027\253\026\370n\311\336R\246\024\316\\6p\262,\214\302\253 Ui\246\352i\0260\f/\003\253w)0\3250\301gQ\024|R\334+(\325\362Q\007\373 \217\227\237\341\r'\217\335\371\234\350.\025`\342\223!;zR-\354\267U\220\355t*\001\207I\002\311nD(eK\234\210\206\355\216-\371\035\367\350\370j\021#\013\200\250x\bA\331\215\317\362\201\350\256] \272\323\213_\317\313\377\307\333\306\310\t\226y\236\025\204\335ub\231\304\255\267m`\373\3006E\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_batteryStateStrings.68.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375 \357u\006"
+	.string	"\204\013\216"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\331\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'?\206\bwu\301\002\005\001'I\206\bsq\304'R\206\bom\306\001"
+	.string	"?\202\210\200(k3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005INIT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\fNOT PRESENT"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\b"
+	.ascii	"H \r\002\006\204\203\214\001\341<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_getBatteryStateString.69.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"E\t"
+	.string	"\306\021A;0\345(\035\036N\322\241\200A\022\276O\021i\344\212\212\"\355\353\221\341\034\324\251y\3416\266=\274 Bl\260\255Am\026\206\202\b!\240\337]\311\b\202;"
+	.string	"\2425\262\311\336)\005/"
+	.string	"/"
+	.string	"0"
+	.string	"*\215\312GF\b\333\255\324\365\003\332\347\346\002\332\247\354x\351\261\344\277\365,@\213\013*e\361\250i\330]GTJu\313\333N\260\275`[&\266\243\245\214\216\031\001\013\214\303\312\256F\f\300\276L\027\210_\362::\211\0030^\260\335\335>\355\221\275}\336&\331\233/\362\021\222K\005\325#G\371dg}\272\013i!\371\326\025b^3\256\233\374\344\363Y\236\020\305\243>}\221\366\031\345\353\021\3020d\303\024cv=E\311a?[\271\n\366p(<\016\004;\017\364\363\272\017\304}\024\004\321\371P\217\367Q\216\201;\t\316\243`\327yt\253\246g+WR\036\230\344\311\266+\236\022\261\331\275`\360\303\f"
+	.ascii	"2\241\365/\260Z\302#\235\2333q\216\324}\256\341DL8\250B\027T"
+	.ascii	"8\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_batteryInit.70.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\324\003E\030"
+	.string	"\366'\222J\260RRc\366Y\207\377+\202\032\274l\306\002q\316\327\242\033\246J\352t@\3146$\0238:f\030r\234\316\261\315\372\260\246Y1E\376\207v\270"
+	.string	"\336\256d\273\2615\350\336dd\331\275S\312\340\257xFnm\357\275eJ\001y"
+	.string	"{"
+	.string	"\200"
+	.string	"\313\345\362\313f\217m\255\355\255Orc\216\222K\302\362^\017K!\367\210F\tm\177f\325N\276\351\347\376\211\b\247\250\274\367\322L\237\253\217\245\350iZ\325\267<\240V \3571\031\247\324fI\255\300\021G5\004"
+	.ascii	"\336\244$@SA8\346\371\341O\026VX+0\304\315S\004\f\347j\006\364"
+	.ascii	"\235\bn\224%F\200?kc+\367^\333\025\370\341\226\335v\3176\212"
+	.ascii	"}\232\004wIm\b7\272P\001\270\301J\272r\204K\335\242\026\020\035"
+	.ascii	"\375%\265'\034\352\245$\353\336\253\342\313\370\f\n\276\320Q"
+	.ascii	"\303\324jH\0351\376\024c\233\211\025\2211\251\377\3420bdff\322"
+	.ascii	"\2431$\344\231^\324\321\354\320\340\225\322\277\245~\213\273"
+	.ascii	"\270]\310\345\322\243(\322*\351\274.\365\227N\324\371B\306\260"
+	.ascii	"\263_\217\372\273\364\350\201!-\035%\257\236]\332M>k\006\355"
+	.ascii	"\233\001C\252P\025\252Fj\2120]\232\245\"\355>\274\001\344\020"
+	.ascii	"\245]\357\211Wx6\354TU\214\030\215\262\237\233sy\356\211\210"
+	.ascii	"q\352\310\263a\306"
+	.string	"\242A\3341\315\240\375\f\351\315\022\247\035?\013\266\3429\324\241\354\336\237\212\177<\016uIebaI\217\336\214\025\267\276\210\005\254\235@\201\200\243\243\317\344\331\304^\3517Zd\367\366\276\3725n\203A\203\226\226\364\250\355\340\201\375jk4:\376L\236\035\256\245\354p6\033\033\230\n\264\034\356\226\253\261\345h5204\264\032.GK!\340\233\005\033\216fs\273\341h\263\246\336\315\236\017/\253\352:\366L\237\357\343^9c;&\202\\\244\212Dz\242\n\304\275> \347@S@T\250\322\377\262\034\212.\317\017\037\210\223\262_E\221\036\265]o\207\rE\357\262\2354EP)\357\345]g\306\363\263C\202\347R}zX3V\\~\021Q\222\252P\353[jP\\\250a@\013\225\022\253 E)J:\240\002\021\3011\017\02109\244\214J\2450\254\001R\034a\301\266\264\260\213|\303\003\005}\223"
+	.ascii	".i^\256\373<\"\220\241\205\272\362\266\351)$\001B\304\254\022"
+	.ascii	"Z\370\244N\007\320\022\2110\310\275\030<\215\221\"\232\240\240"
+	.ascii	"F\310^\335\034\243[\033j\365\334\363\020\005q\037\020@\016\230"
+	.ascii	"\36138@\221L\316\350\347\007\032]\344FU)\nJ\342G\314\302CN\f"
+	.ascii	"\033\007!\004!\300\030Psd\030G\211\333q\001\005\006Q\013\336"
+	.ascii	"\201\301\025?Z\211\302\"\347\035H\224\226\237%\001A\250\266\201"
+	.ascii	"7v\303\343\241\344\026\235\202>\225{s\311\005\321\304\260\n"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.71.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\302\005=$"
+	.string	"\n@\020\016B\200jQcZ\003\230\020@\211}\005\252Q_X\347E\242\331\377s\016\002K\264j\224\206\353\fD\037\b\177\241x9]\301\236Xy\231\225\377\nk\261\302\0173\351dk`\n\275\264mo\271\267\224)\005\312"
+	.string	"\300"
+	.string	"\325"
+	.ascii	"'\031\034H\300\341\235\262\021v&+\302Kk8_\372"
+	.string	"a.&\307\207\2365\361\323\345\336[{i\347\260k/i\315\366\251\375\254k\371\276\265\303\263{\257\350x\335;\234`\t\347K\244\017\260/\311\037\331\227\366\331a\037>\271W\003&X\306x\357\305U'\367\275F\233\235\246-\311J}\376\3575\334\021+\2640\261,/3S\351PE~\"]\221*BM\022\202X\233C\327#EE\016\0202Ex3AjM%\256\177\220B\034T\376J\352H\017\332\024\017\033`\301\225\224\021\222\254 h\2305v5\344\310+i\201\207\021\311m\nH\332\310\202|\316u\352c*\212RS\351\336k*\234\032r\333n\373\313\366\316.a\004\367p%\211\027\227`W\225\250\273\371\233\022O&L\330Y\023?^*\025\2250x\310\001\364\303{\2558\357\205\272\320_s6)\374(/\255b\305\n\313\242\005\275\320\266:\307\"\260\376\374\307k\313\252V,/\331W\027c"
+	.ascii	"\001)\231}4O\263\344G1S\216^\230\263/_\277h1ViQA\321\243=\214"
+	.ascii	"\242\025\313~=\036\217GW&\266\245Np27\201w\335G&\265\221\215"
+	.ascii	"\272\350[\377\315FM\263Q\317,\365Y\2436i\324\226F]\316\250\311"
+	.ascii	"\223\272\232\324\324R_\301\ty\031\007\315\370s\257\220#\242["
+	.ascii	",\335P9\231\277\353%\255\366\355\017\37527\343Z\327\r\035`\306"
+	.ascii	"!\210>)\364\302\262"
+	.string	"^ \276\261\263\212u\303Q\022G\320\331d\311j\013\033\023\310\001\rp\237\025k\373\260\370\264\320\013\311j\265\254\200\365\367\005s\260\0201o\330\243Z\200\370\345GhO\003/>0\364\302\243z3?\025\"W1\n\317mD0E\033\b\220}Z\007\262 \321\242jo\340p#b\271\235\237x\215b?\232\310~|\210u)\367\234\317\3738,\003\237*$\365\035\250\260\350\347\241\246\302\013\344\253\312\265\372\362\357\374\035\354K\022\027l\230\365\340D\337\373{\325\371\344V\030\033f\031\257\325}P\263\342A\313l\1778\035\020\347\275@\f\276\234\317\t!b\304\b\373\262V\263\353\317\330\326\255\302\231\262%K\225\026\022\243ZTMC\3012Zo\325\250^L\216\221\304\243!\243\367\204s\32255\351\230\f\360\236zK=\023\275\034\357\305\213\0219\032\275\236n\027\243w\343\241\3105\3118\321s\312\355vOL"
+	.string	"\314\224\204c\227\353\365\226\\\340x;\035\317)\307\3039\311Xj\3021\355x\270$\004\326\325\310\355p=\235n\207\253\r\241N\336\312\204\326(_\317\255D\336\262D\267;Z\212\300:?\327\377\343\216\225\"\255b\231\236\021n\003\373\nbJ8\255\3728s\262\261\"s\212\025(\201J\253\263Z\224\304\247\204^h\244`\3759A\235\031\201\005\313~\004\366\254\t\252i\220\n\315\013-\371\226\344\316Ja\213\2411*\263\022\250\365+X\226Dm\265}X>'\366B\263\"\231\315\311,"
+	.string	"x/\024\203\262\332Z\366\351q%\212\036\035\001Jv\250\201(\347\024SdFH&H\222\026\322\001p\002\2211\243\362\020x'\243I2\214\001\315\365x\310\253y\006X\310\347\342\021\250\321\236:\275\337\202v\306$,\231\030D\244\343\021"
+	.string	"\375\2649l7\271\035\030\374\217gn\340hx\261\243KZ\302a\215G\216\005K"
+	.ascii	"\372(/q$\362\037\002*\033\252\033\370\320\223\353\342GH \022"
+	.ascii	"^D\270-\225\022\372I\354\0066\267\357\215 l\362\003\367\376\212"
+	.ascii	"{\350\345\220L-\017AMK\0304\304\273>\261X\376\251\3251\026\271"
+	.ascii	"]\260\362\314\314\001\250\245\314O}'2<\017Rhip\007\035\304\233"
+	.ascii	"\323\244_\003\020\f\017\277\r\360\206\276\"\3369\202\007\307"
+	.ascii	"F\004\365\t)\346\273\240a\236w\254\0064]i\263[\257\301=#?\330"
+	.ascii	"\211\270\377\027\025\205\372\262\325\024~\201E')\350#|\f{\357"
+	.ascii	".F/3A\357r\350\023\177KP\376V$\214\032"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.72.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`q\004\315\035"
+	.string	"\2068\302I\260TN:\331\361\200\327\034)\245\364K\023\217\350q\314\261\246\233\345AQ\372X\370\341\237\017*n_\200\225\310f~\332\374\246\223w\333\342\365\002\336\354v\366\272\240\326?\2665\253\320\342x\213C\215\232\372E\354\336D\356\224\002\252"
+	.string	"\233"
+	.string	"\264"
+	.ascii	"JDt\221$\212,W\3101\032\204\352Z?\326\247\375\256Z\021\026\277"
+	.ascii	"q.\333\346\021\317\341\226\025aW\027\372[\266}x\034K\327R\032"
+	.ascii	"I #\324\227\214\006\343\251\314o\352\351|M=\265G\330\266\323"
+	.string	"i/\371Y\266\035\0138\222U\265.*\2512\222\034\0328\365\201\361\324\t\024,\031\370a\f\024\225\312\305\023\027\025\222\034\3426\352\300W*\356\004\3725\007\342\225\0252\250 \211W\025\247.A\025\027o\301\022\266\240\323\334\255\317\023\301R\004@\222\344\263>M\004\233\346\2549 I\322\023*\230\342\256\335\366\007\333F\266\030\f^\377\261\363\247N\335\341\350\250\236\n\355\267. \n\254\212p\222$Ib\027\206\201\365\313a\353\211\323D\263\317\343=\200\376\224=\360\346\241x\365\364[\213\002\253\301\202if\261\207Msa\330\027\311}a\023\r]\353\026\252\323A\307\272\201\352\364\3178\3553N\367\324i\236:\275S\247u\352tN\235\306\251M\337\214\3236\343t\3158MS\247g\352\264L\235\216\251\323\267\3324\3148\375R\233\266\325i\027:\335B\247\307:]\243\323\225NS:-\326\351\245\323S\234~"
+	.ascii	" \264_\231\r\022\203\331\333\376)-\302\305tc\030\314\236LJh\333"
+	.ascii	"\227\245P\236\322$\034\211\222\221\037\241P\301\202\205zj[\004"
+	.ascii	"4\302j\b\251\316\022\r8+\322D\326\225f\3409\253\263\236\345\024"
+	.ascii	"/\271\301\252\313\346\354\273.\332\230\0022\203L\207\224\226"
+	.ascii	"uY\321\253L2n\335\226}\211\244\266\343\276,\253\255\017\330S"
+	.ascii	"\332\327w\370\346D\222LDt\353\3660)\255\304\235K\367eU\323\314"
+	.ascii	"\342]qu\304\3122_\370\020\f#I\222\013\374 \027\222A\303\206\r"
+	.ascii	"\365t\367C\234\b\205v\356\257\320\316\312\262\213W\252B\353\223"
+	.ascii	"E\303\271\177\351\0244!I\247\005~6*J2\372\345x8\244\036\217\327"
+	.ascii	"\323\361(\375\216t9\020\271\0071\273\016\271\037\322N\347\333"
+	.ascii	"M\230\261\256H\311\267\373\375r\034pI\276^\022\322.\t\207t\224"
+	.ascii	"\343\341t\276$\\\321\217{ v>\334\257\327\363\341lC\246\213\337"
+	.ascii	"\027\376YI\207Z\260\230E\021\2116\204Y\213y\037\007Z\023\266"
+	.ascii	"\201\366Y\377\211\026U\306\230\266I\2541;\024\026\2641D\376\263"
+	.ascii	"A{.\237\375Y\321\253gm\326g\013`)m\360l\317\316\312,\31720+\255"
+	.ascii	"n\213\263;\213\303RV\335,\016\204+\031\273\331\tEJ\310D\240\326"
+	.ascii	"\254\315\026\340*\255h\366ek\226\207IY5\26342{\333\231}i\025"
+	.ascii	"Q\250A #\221AJ)g\"\231\321\264\260\325\200\002\031#+\017\020"
+	.ascii	"XfE\311p\303cE*3\366\213\312s\226\322\306}\2363G\205\332X#b\001"
+	.ascii	"\270*,\254\343m\306\3741h\204\"\222/\032#\205x\351u>\027\361"
+	.ascii	"\356\377/r\f\r\235\362\017\300\271\305\331<~,D8<I!\233_\nsX\027"
+	.ascii	"\rP\233\r\317\212\320N\260\t\245\223\236\0348\250Lz\ti\201\315"
+	.ascii	"\032\264\025\345LF\003\006\242\331\322\223t\360\214\302\357z"
+	.ascii	"\200\320\211\257\373\324\206\2620\332\325\203z\256;\376H\tx4"
+	.ascii	"Z\":*\252;\237\330YRD\276\177j"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.73.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"-\t"
+	.string	"&\321?80\257\322\001\204m\0056\340\3131\002\374{\245\326.\006\251\366qDI\002\243Ka\316\017m\377\324#\250\305\366\206\371\322P\200\306 \305\317\351\304\2103A\313\326\310\3362\245."
+	.string	"."
+	.string	"2"
+	.string	"j\3623\235\335\275\353\0320<]V<J\203YI\213@\230\222\003+\016\360\256\353D\370\251f:\273k\005C\212{\273\355\004\333\007\266O\002Z\263c\237\306\f\373r#\313\276\372[\301EJ\204\310\356\252\366\262\262\315\244\303\36676\331,\217\265\366#0U\210\313\356\316\250q\323e\f\001(\026\262/\236\336\242\315H\242%0\217\037\220\225\224\322l{\207="
+	.string	"\354\246\020\374\217\277 \374\215o&\225\364\3407\277\204\371\366\230Q\251x\274P\001\006qH]h4\362|\246\327q\236(\344M\321\202\207a\202:or\b\3145\204\2729\342\270nnb\250\313\215,+`\310P\361\223\032\2659\007=\350\r"
+	.string	"3\241\305/\306\326Pq\330\233\250\266@\n\212\270\355\206"
+	.ascii	"]\303\t\230\340/\343\022\227\313\224B\355\001"
+	.text
+	.section	.gnu.lto_isBatteryVoltageConfigured.74.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"\"\31624Pm\323\001$\2412\312)\261\312\230]\007J\200\307\017,\262\215\235\373\017\226\f\222\273\307\2661\303G\235=33V0\274\326+\bH3\321\304O\233\310\235R\276T.IY\226%!NYM\f5#F\301\262\020/r\306\n\305\025\003%\243UU2N\235\366h\225\243*\240\351f\177JWU\351\223\371\330\334\360\215\t\260\033q\340k\334\343\340[\034\372\341z\347\016\375K:\274RD<\332\013\331\335\366t\302~\264\312\261\375\254\357\371Q"
+	.string	"F\b\306\261\253\t\221,\b\364\350\330\306\354\311\005\006\230\263w\025\232w@\231\317\310n\027\225\342\331_\346?\343\260\243\004\304m \376&\b\273\353\307m$n\275\355\001\333\004\266/\002\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.75.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31514Po\322\001\240\276\t\013\001\206\257Z\263\233\242W\300\317\253)\375q(n\r!\275{D\226\221\275\241v\246\252\252\030\253\375\317=\321P%\210a\311&R\246\024\326`8\260\302\260\f\303\273\240um\252\353m\0322\016O\003\257\207)\260\365P\301\207Y\026|T\334K\253!\353\301G%lC<D\003\330]\005\037\3441\302\337\2703\247\223\337\356\374\216\006\210>9\262\243'\365\302\276\264\032\262\235N5\020\235d(\273\024#\2265q$\034\2663\233\362;\356\221Y\313\250Q1\215\224L\210\254\354\306'p\202\351.?0\335i\306\265\247\346\377\343RJ\213\312\006\362</\013\273\353\334@\026\267\3366\202\355\004\333\030\001\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getLegacyBatteryVoltage.76.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\275\b"
+	.string	"6\021=6@\217\322\001\201l=\202\324Cg\367\001\230XC\"D\027\364#bf5r\377\027\261J\332B\f^'5\341g\030]J\203"
+	.string	"\342\240\n\266tZ\355\336D\312\224\002,"
+	.string	","
+	.string	","
+	.string	"\260dU\"i\331\355\242\300\t\340_~"
+	.string	"\376\251\306\271'\347?\344/\305J1\235BO\f\303\356:M\247\213[o;\301\266\202m\226](5\303\376\265\212\262\235\206\232\2764\255\232\316L\037s\200\262Bq\262[\321rY\225g\322a\033dg\374\217\203\200\314e\267a\021\357V\301T\325\247\"a\214\262\345k\352K,G|\204\003\330\335\005_\344\335\346s\374Y\342\2237\375\371\037\370w-X\245D\331\262\003\346h&4\314\343\3314\304M\313\266\016\266\305\216\303\346!r\264-j\f\234A`Z\364d\231\0263\335\376ZEAE\020\351\310\227\302"
+	.string	"\325K\337\013\311#\f"
+	.ascii	"2\241\347\037\230g\002BE\027\004\207f\214Cu\265k\342\372\b\235"
+	.ascii	"\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.77.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"\262\21514Po\322\001 o6k@C(\3010\001\203#\300\312\253)\375q(nM\324Z\347\210,\343\242\202\332\231\252\252b\254\366?\367DC\325\360\201\310&R\246\024\336d:\220\262,M\203\253\340\2538T\3458\016\232\007\267\201\225\313\030\370AP\320Y\357A\207\211{iudE\b)\205\355\210\223\\\001\273\273\340\217<J\370\035o\356x\362\330\233\357Q\001\221Pfv\004\245f\330\227VG\266\323\251\007-*\023\331\256E\366\262)\r\305\303\366\307\306\370\037\007\371\370\312\310q1\235\254T\224\270\354F7\360\202\351-O0\275\351\306\257\347\345?\344\022Kf\202\211@O"
+	.string	"\206\335ub\"\214[o;\301\266\202m\215\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.78.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375 \350e\006"
+	.string	"\"\214,1pk\322\030\200\030\204\003\024c\275\203\302\027\211\230\2201\272\364\300\221\025\326Zk\216KF\2372K\356\251\252\337\370\223i\353\302"
+	.string	"0=\333\b\221R\246[(\0307YV%\241U\216\252.S\325.\n\225\205fqU\243\004L1L\256Y\024\345\332\004[\324O\352"
+	.string	"G\033\03610\343\215\025c2\211\027Jc&\202R*@\004'\263\3076\251\022\217\321\352\347\317S\005B\035\317c\267\223\205\226C\332"
+	.string	"\375\232\237lp\240\371!F\321\211\200B\0344@v\261\246\023\3700\337\210\027\030Yd\037\227g\203)A\330\335\363\362@\340\212?\301_\360?\004\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getBatteryAverageCellVoltage.79.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"E\t"
+	.string	"6R@80\345(\035\2363\2124\305\204CQ\305\225\303t@{\037\354Z\3246\230;\314\267\206\235\201\326 \006\333\274\267\373(%\005\f\f\370G\315L\201f\315m\236\264\275\245L)1"
+	.string	","
+	.string	"0"
+	.string	"\233\211\223i\343\241J\241\274\354vQ\340\004\230\303\374"
+	.string	"\346P7\316=9\377\"o\310P\255\254X\246'\306\260\273\316\025\313\342\326\333F\260\235`_\023\251\032\366\337\356\256\265e;\215i\032j\372\275\264j:3\375L"
+	.string	"\206\013\353\252\224\335\212\027\200e\201*\035\266K\266\306\007yH\311\\\252\357&?\001\371.?\204B\252\320rqM}*\200\263\227p\231\335]\360I\336E\370\256Co\244\374\352\320'a\016\257\005\034#\247|\331\235)\366p$\264\317h\324q\210\233\226m\242\317\026E\240N(z\264-r\f\234A|\2648\3122-j\272\375[mazpR\224\241bOS\241\236\342\003\225/\007\r"
+	.ascii	"2\241\037(0\366\005d'YN\025\337\232,g,oe\346P\265\322.\334Y\260"
+	.ascii	"<\\+&a\222\001"
+	.text
+	.section	.gnu.lto_getBatterySagCellVoltage.80.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"=\t"
+	.string	"\366\221?6@\217\322\001\233\016\217\336lL\240r\312a\344\227\215\213\223\327\335\367y\333j\266!\026\334,\304`\017\376Vzw\030]J\203\300l\356\020H\206\356,!\233H\231R0"
+	.string	"-"
+	.string	"/"
+	.string	"\020'\323\306\203\"\205\322\262\353\305\200\017`\207y\001\354P7\336=;\377\"W\300\230HQ\255L\317,aw\235\252\225\305\255\267\255\261}`?\023\236)5\303\376\265\312\262\235\3164\r5}]i\325tf\372\030"
+	.string	"\215\326\352\022\337n\305\347\262+P\245\303v\311\316\370 \017)\271\333\004V\275n\362\023\220\3372C(\244\032\226\213k\352S/\326^\322av\027\301'\271\347\340\267\016\315\221\362\252C\237\204\035^\t8FN\371\331\001\366p\036\266\317h\324Y\210\334\246q\242\017\027E\240N(z6.r\n\2545|\2668\322\264-f\274\375\265\312\312\324\340\244(C\315.M\205\372\210\017T~\001\016"
+	.ascii	"2\241\037(0\366\005d'YN\025\337\232,g,oe\346P\265\342\302\030"
+	.ascii	"\003\263\235\005\313\303\265b\022&\031"
+	.text
+	.section	.gnu.lto_isAmperageConfigured.81.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"U\007"
+	.string	"B\21635Pm\323\001\244DX\205\214\222\256\261\352@a\246-\177^1M\206h?X2\210\215\234\365`\245\207{s\2623S\244\361\265^A\214\226(`\331\250\021)S\n\306X\262\253\302\260\313\002\214\227\0253U\204\031\206K\003\304\\\021Z*\266\034\252\013b\226uA\312\267]Z\365\250\016l\312\331\217\324U\225\022m<8?\234#\002\354N \370\033\017A\370\030\237\034\221\345\273O~F}\272V@B[\216\354\217K\265\260/\255zl\2475\323\227\002>!\3369\"\273\235Q\311~L\035 \333\032\233b\203\003\215\265\177\027\035\201\214\212\215\210d\367\203\372\271\366\324\374k\\\201\343\214t\236\304s\222\260\273\316\316\243\270\365\266\tl\027\330\006\005\t"
+	.ascii	"2\241g\037\230\302\004;T\241\270&\246\214 K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_getAmperage.82.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\035\007"
+	.string	"\002N24`m\322\001@\203(\033\201;\350\n\370\261)\032\243{F.\247\f\003\2324\324{\207\232\354\006\272J\350]B\301I\n\313\334\253r\255\330e\255\311\336R\246\024\316\\6q\262,L\003\254\"Ui\246\nj\0340\0170\023+x)0\0051EhQT\204\225m\357VAV\013\246\037\333\021\017\271\002v7\301\007\371&\341k\374y\303\311g\177>G\372K\025\370\300rdo\236\324\013\373n\025d;\235\352D\031?)\331\255\030\245\254\311\033\331\260\335\261+>\307;:\276\026&0\315@\204A!\202\262\273\320r\002\351\317}@\372\323\320\257\347\345\337\343\f\237\214$\323<O"
+	.string	"\205\335uf\232\305\255\267}`\033\301v(\b"
+	.string	"\003\013\275\262\030\005\205"
+	.ascii	"]\303q#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getAmperageLatest.83.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"%\007"
+	.string	"\022\21624`O\322\001T"
+	.string	"\303\321\303\226P`\r\316|\263R\301\321l8\316F\032\322\266\035\"\262\213\310Xr\323O\204\034\026\030\316\265\252\317\007\253\036!\262\211\224)\005\336d:p\262,\215\303\253 Uq\246\352q\0364\020o\003\253\22710\0251\301gQ\024|\027m\037\255fX1\230\206lK\374\344\n\330]\005\337\344\332\204\337q\347\216'\037\357|\217t\227*P\202\345fk\240T\r\373\321j\206\355t\352\300\207E\366\270\262{\261\265\254\212K\001\261\375\261/\276\310G>\276\030(\260\354 \304\243\002\205ew\037\346\005\322]t\002\351N7~=/\377$o\b\305-f\240'\300\302\356:c\206q\353m#\330N\260\315\021\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getMAhDrawn.84.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"-\007"
+	.string	"\022\31625Pm\323\001$\243*J\240\272\362\272\031\001\344\264\025Xd\033zv\217}\362\332\374\323\247-\271BA\3313\203$\212d\277\275\002\324J\212\013*Xo\"eJ\001\306X4\261\302\260\213\003\274\242ue\252\013f\036.\020\020\023/h1\260\025QE\210YV\204T\267\227VA\326\212\246\036\333\022\027\311\002vW\301\017y7\341\207\376\254\331\344\267?\1773\375\245\n\200h9\262\273N*\206}i\025d;\235: \nq\377\224\354Z\214R\326\344\221\210lsl\312\357\270\007\307\031\003\205\306\035lpT\214\240\354.\254\274`\372\223N0\375i\306\263g\346\377\343\r\236\317\311\306u\236"
+	.string	"\013\273\353\334\270\213[o\033\301v\202m\215\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.part.0.124.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`@\001\335\r"
+	.string	"6\031[D"
+	.string	"\223\232\016\263\231\024\021\365\222\002dw\316\366Xdd\001\262@E\242uS\202\271w+\030C\262\255k\034\031"
+	.string	"\023\211\323(c\"\212\004\220\035\240\005R,M#\033\236H*\252]\0331\242\021m\"wJ\001B"
+	.string	"I"
+	.string	"K"
+	.string	"\321\t\252\307\003'@=N\037@=Z\217_a\273\343`\317\346\361\371\355I.-\244\322\356\312G-q\357\n'\317?\315EF/\030\256#/\036\016\005|\n9\331]W\037\356x\333\013lK\260\377\005\032&\233o\262(m\206Ib\322kBV)0\277\016!8!p\370(\355N\371\350Y}\346\016\375\205\365\246&\305\356Z\367[t>\215\255\231\356s\005:X\021\b\222GCh_\346.\274\317\025\213\354\222\260\271\261;K\036((\324#\265c\324\343\n\365-Al\317gT\250v\227\201\037\3432>\276\211Gg)\360\243G?E\025\240\310\001DF\004s\240\306X\247O\25306\005\r#\364#\002\025\001D\354n\310\301\331\021\361\346\004\214\316*',.\001\246\260E\300>\036\b\034\b\323\264\013\027"
+	.string	"_&!\r\343\270\316\004\271i\331\006\3026\t\362t>\362\3226ib\300\231\005L\223\\\226i\322\372\264\n\343\007?t\210\224\305\252\032c\033\252\355\222\333\350\310ow\033\3704^\343\302\002\037"
+	.string	"\370\024C\2431`W`<\234!f\f0\232V\031]lG\252=\205\261\007\020\005\303\\\341nY\201\177\206\300s\001\004\033\206&\314 \243\326\350(\304\345y\307=\255\024\325N\347\2026]v."
+	.ascii	"\234\274\230wZ\232~B\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\001\006U\025"
+	.string	"\266\241~H\240VN:\300\024\343\344\355\251\b\353\263\220o\2349\216\200\275\306\206\274\0070\027\342\233\264 NL\203\251\206\356r\032q\274\026N\247\036\343\024VX\341\330\241\256\313\033\365Q\334\307\266\261%\t+idn_\266I\223d\247g"
+	.string	"k"
+	.string	"j"
+	.ascii	"6\305\242;\b\321\rd\350\316\022\272\261\302\337}\025d(@6\342"
+	.ascii	"\017\217\317\213z\374\025\002k\017\337\177!\217\237\324T \220"
+	.ascii	"\354\335^\302\255;;\033\f\006\271\350\\(\314\341\341\030L4\025"
+	.ascii	"\357F\334:\243ss\243\320\006G\334\232\240"
+	.string	"'\332\246$\025\002\237X\201\300\312\303\276\255\005\203\322j\255\365\300\217B\333\265/\001\366\352p;\341p\237\321Z\253\275\333pK\241\032zD\233E\324\224\224\n\250\f?\242\3154\305\3444\365$\365\024\265\004\265b\307\224l\201!H\274p7\261p3\251p/\241psM\270\267$\334J\"\334Z\020\356$\017n$\016\356#\rn#\f\356\"\241\322\223\302\005GRp\023Ir\225 \322=$\f\220st\013\t\215\0022k\313\302\345\226\2364\344\332\"V\303\227[Z\366\344p\270\250\n\363\311-5)I\251U\227\225\027\017\314\0168\005\220\324]b6\316z\264\235))\257\n,F\217\2668[I}E[\247\373Lq[i\272\311\230\3562\024\367\225\245\333\354\304\215\305\304\235\245\304=\205\304Me\304\035&\342\026\013q\217\201\270\243|\270\273<<n\242\364F\027-[05\333\344\335*\321\354\326"
+	.string	"m\267t\214"
+	.string	"\315\312\224\277qcN\242qc\314\242qq\245\321\270\267\363h\334\033I\013|\345\220\2014\256\315L\032\327F^\215[;\251\311^h\331a\254q\235h\374\306\305\235@\272\305\225A\272\275\225?\335\332L\352\262\255\0373\204t[3\207t[+}\272\005`\322\233\231\017\035?\001`\250A\b\304\321\271%\005\005\005\255\034\340\002!\3336\007\021\220\020\211\b!BDB\th\005y`!{\026\240\031\006x\350"
+	.string	"!\211\216\234\303\323\247F\356\210\313u\303 CB\222\343\033$\3441\324"
+	.string	"}\370Z\206\363\200\006S\3579w\354\347\315]\374[\303\365lC\223R^\224\b\326F\223s\236y*\335\027\300W\005\364\352"
+	.ascii	"e\336[\207\352\t\223\036\340u\332l\237Q%E\227\236i\254k\225\221"
+	.ascii	"\245Dk\201;\317naK\r\244\311\300\363s\305F\230\314\326\242\214"
+	.ascii	"\t\n\f\323{X\342^\224j\2624_\343\340h\224\376\275\326*"
+	.text
+	.section	.gnu.lto_.refs.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`B\001\025\013"
+	.string	"\226\334G-`\207\223\3063\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\270\243\037\374\017\374\326\342OC\025m\032\026i\272\273\27352\242\021$\215l\332M\312\224\0025"
+	.string	":"
+	.string	";"
+	.string	"\022k3\266\230F!l\035\326\313R\313:9ZQ:Y\033\261\215Vh\251\2636\2152\224n2$Rn'\267\320\351s\332\270un\327\255:=\323\327GMA\023\316F\254\231f1\353\203\244\r\017\275H[Y)\322J\326H\264\020\333\004\245kU+X\204\240}\224:\t\272\224\251\2249\032\017\332\225\b\346\217\215\275Xka[\341(\205\322.\271\320\360\261J\223\031E\213\2606\2245\3162\232=[\223\366g"
+	.string	"\016\255\"\305<r\262\344\310~\006Y\0378\253\203fm \255\f\026\330&X\021\254\027J-\224V\334R\334\006F\330\204m\022\2279\260Ob ~0O\322\200\025p 0\240\341\313\256gU\244\fS\300\351\210\026\212\366\211VI\001\226\323\nQ\332Lz\313\320\3100\231\013\223Iy(4\231\313\262\f\213\336d\001\031"
+	.ascii	" D\312\231\252\032n\371R\263x\342\305\200H\352\316m5\226\"\315"
+	.ascii	"\247\201\313\020\337s\226\205\032\377\312\320\244\026:\207%R"
+	.ascii	"[\002\247\025\243&\242\341\243\251\262\300\326\323B4\260j\226"
+	.ascii	"I`\244"
+	.text
+	.section	.gnu.lto_.decls.67b1fe2c597a78,"e",@progbits
+	.string	"(\265/\375`\231<\r\367"
+	.string	":oYQV LA:\351\363cr\346R4\273\373\376\276c$\257\313\327\246\022\251\244#&F\314\342\346\340Ug2\265'\304\006\344\3265\372&\204\"'\322\227\363(\217\021\313l4\004`t\371y\211RFN\277SRE\301\360\300\310\315oY\212\237\323\2352)\232\335[\356\0247\004\020\005F\005D\324\376\232\210\261s9\301\234\233Z\276\200\300\3309{\247\003\002E\364\240@{\366\313\036\234\023;w\235pi\213g\0234\t\333\323\225\250V4j\246\226/\036\224Vt\f\bj\323\354]\025\t\"\\\240\326\317b\261\\r\226\234Yj\375\242\025\215F\211\301\246\345\334\234m"
+	.string	"\266)q\322\212F\253X\001\300\237Vt\214\256\316\332y`\346\003>;\255ht\t\023\030no\316\034E\303\365B+\032\305\373\201n\375l\030;\227\263tf&\211-Z\3212\315\242[\264\322\236\261f\272\251\2276j\003;7S+\265\213^\352\027\366\257aX@\373\264~\266\357v\214%s\354\314y)\347\374\021\2775;b\323r\224;Y\t/\352+g\347m\221\337\256\375\036\214\260~V\212M\373\240\224\263\215\254"
+	.string	"\344"
+	.ascii	"\324\212\213\346\354\334\240\303\006\033\334`\021\231\023\343"
+	.ascii	"\203\273i{\204\005\270w\351/\223\364\227H\372\313\225\376\272"
+	.ascii	"H\337\177]\254\027\234;\032[\332\260tqb\365\354\023\337\013C"
+	.ascii	"\032\277\315R\233\305j\261O\233g\361\216\22143Z\316N\234\273"
+	.ascii	"\244\232\362\346#\324\261>\302w\217\0247V\252A?\245\"\354\332"
+	.ascii	"R\261w\267vv\312\315\222\265\3039/\255\025@\216\265\002\b\312"
+	.ascii	"\375X>\205\370\335\"\275\r\223\212`\345\322[\265\364k\266Gh\237"
+	.ascii	"X9\373\004"
+	.string	"a\241\334\306\331&\017.\235\331\331=\316\260=\033\337\032IoA\bo`\240\005!\274\335\221\356\330\036a\303\331\030\351\357T\220^\013Rz(\007\322\235\250\355\021\276Dj\235\366\314>3\260h\367`\304\257\022I.\222\263S\007\007\220\f\360\257\361\025\220\336\"\371\005\313<\342<\351m\006B\033h3\020\276S\r,\217\320\026\311\340695\363Z\316\316\f:N\252\247\256\306w\332\036ajy\204\315u\207n'\226P\240m\206M\022e\2004\030\317\233\377\2668S:\262\002#'(\023\376\267\205\275\247\377-A\330%\301\004\332\353\030\3747\250\0014\232j\306\337\024\220\3617\006b\374\255\302\224\007\244<\360\377\002\235\302\337\314\203\360\337\f\374\355s\275\026\021\365\333\017z\204\005\007\372\257\t\277\335j\250\020J\374\226\353\357\247\277\235\376v\361w\323\337,\376V\376\235\377N\301\337(\370o\363\337\td1"
+	.string	"+\001V\307\377\375\240W\374\017\376\267\003\022t\013\327\371/\221\023\220f\341\303-\370\257\220\005)t\f:I\275\202\350\344\003\360\367\226\337r\350\351cM\033\265\001\214PM\202\036\201-"
+	.string	"\322S"
+	.ascii	"\321\305\277\211\216\200\377\366\374\315\243\366\315k\376\376"
+	.ascii	"\373\255R\0131\021\340h\\\376\276 \305\337\001hb2\350\267\351"
+	.ascii	";\374?\300\377\017/\300\177\203\377\243\277\305\277\025\3767"
+	.ascii	"\363\377\357\2674\277\265\377\311\374\007\374\037\370\333\340"
+	.ascii	"o\373\267\351o\207\377\375~[\363\177\357\277\226s\370\357\221"
+	.ascii	"\277\373o\341\337\301\277\357o\003\377\266\177\343\277\323\275"
+	.ascii	"\337\002\376\366L\203\340\377\316\217y\376\376\300\337\033\370"
+	.ascii	"{\205\277O\370\273\002\177\237\370\333\001\177'\340\357\021\177"
+	.ascii	"\177\3607\320\337\033\374\355\363\367\001\376\036\300\337\032"
+	.ascii	"\374\215\301\337\033\376\336\371\333\346\357\341o\355~\353\366"
+	.ascii	"\333%\277m\373m\222\337\246\375\366\371\333\263\337\036\371\255"
+	.ascii	"\221\337\226\375v\354\267a\277\r\362[\260\337z\375\326\307ou"
+	.ascii	"\374\026\307o\273~\333\374m\326o\261~k\365[\252\3372\177\013"
+	.ascii	"\365[\247\337\276\370m\323o\227\277e\372\355\322oW\360\333\024"
+	.ascii	"\374\366\004\277]\361[\026~\273\376\266\004\277E\372\355\361"
+	.ascii	"\267\306\337\216\360\333\024~\253\342\267\352o\207~\333\301o"
+	.ascii	"C\374V\350?\224\337f\340?\225\337\246\370\255\b~\033\202\337"
+	.ascii	"~\340\267\035\370\355\006~\253\302oQ\370\355\005~\233\341\267"
+	.ascii	"\025\370\217\342\267\r\370-\211\337&\340\267\"~\373\363[\020"
+	.ascii	"\277=\300o1\370\355\005\277\365\360\333\234\337\342\374\326\346"
+	.ascii	"\177\221\377\352\177\272\377\032\004\006\006\006\3765\033\370"
+	.ascii	"m2\360\203\270\013wv\316\252&&fQ\264\264nSC\316I\224\354\270"
+	.ascii	"\351rr\242l\212]9'\267(\222"
+	.string	"\254\254+\341\2201rc@\260\260\256\325\211\2343\227\247\257\213$\006\253\0366\252\252\256\225\206\334\314\371\213\246\rF\023T\b\032\030'V]E\307\311\337\024\033\250;u\247.\225\230\016\264\276j\370\340\272\254*d\215/\325\235\341alKn|e\330\304pA\344\210\025\247N\222;2W\215c\364\214\0330sZ-\374\230L\233f\221\344\250\032\027\312!|Q\2351C\262z\270AA\3314\0214j\\0\240\003\0202\2654\342t\235\340j|\244/^4_\232\355\356plPY\262\242jz\336&\233\366\273\224m\220}\345\034\205\003|\346\013\226\035\215_\343\304t\231\332\253\221\344\251\232\026J\257'\321\234\2538\300\001#\222\246\264\227*\257\222\362.\ts\266\316f\024\363.\335\345]\366^\252\314\271C\\\225\317\260i\f\206\341\\\372aY`\340\327\020\310\2313s\316\341\214\277?8\032\026L\376\300"
+	.string	"\243}]\246\257\340\274\226\227S \3745\365\322\247O\306<{\214\235\363\311K\245\017\2303\n\007\301\0369\206P\231\211\021\323| \224\201\276\357\315\027\264\"\004H[WVV\343\t\231C(<(\350\033\372lhW9\221\227S$\2028\235\034<\245\341\345\366\331^\332\316J\345\274\264\002A\fZ\305A\016\214\265\"\3512}k\351-o\275\277\365z\317Ve%\230\0213r\025\223\313{\357^n\362\207\234\"r\3202\215\337\327S\377\207Ar<\242`\322\277\177a^2s\316SAgf*\335\330\240\265>?\216\275v"
+	.string	"\371\032sV\0026\371\322 oK\254\306\371\277\313yiK\t\201-\251\245-\032Mh[Y\271\004D\231\201\231\267\224Mh9g\310KKJ\022\2329C\023Z\226\312,\254H\331\354\334R\346\245f\316\220\227\362R\203\246\245-\251&\264\245T\206&\264-\251\214\266\225w\362\322\222\351b)33d\264-0\031\255)\265\323\204\326\224jB\333\322\262:\232"
+	.ascii	"\303H\235ir\225\261gMK\031\352\251\306\222\271s\327\344lf-9\333"
+	.ascii	"5\246\314\034@\3165\232L-K\032\026N\351\016Ji\311\262i\2359g"
+	.ascii	"\017OJ\\\315\274t\327$\244\231\263\020\245\242\374\004\202\322"
+	.ascii	"y\227w\330;eW\215\354\304\224\363\005O9+m\276\3139+s\3164\314"
+	.ascii	"\032\316\234\257v\232\276\236\236r\256\352\360\224k(\343\230"
+	.ascii	"r\3565=8\251&4\256&P\234\032\332Wn\341T\332\257\254e\213\231"
+	.ascii	"\242)\317\262\223\230\364K*F\230\306\316\034\341\020\037-\342"
+	.ascii	"\032\247b`9\376\032;\333\256\352r4\256\033b\021\223\265f\005"
+	.ascii	"\327\200\361\330B#{\352;\033\272&B\002y\244M\345\322\275\335"
+	.ascii	"x\273\252sn\250\022\203j|\032))\267\317\226\322r\035vr\346\252"
+	.ascii	"\372\242Y\232\353(_\230<\031\002f\016\212\\\215\2229\347Z\343"
+	.ascii	"'\035\322\257\253"
+	.string	"*-+p\366\331p\335\3446\345\345\026\211 \3141U\321\314dr\020\327\201\004exD\205\245\027\352h\267\246\001\003\206\251\306\027b\245L\226\254\r\235w\314\250\306\377 \315\255\310\221~\346\fs\336\212\362\325k\215\326O\232\035\320/~\321\234s[\263\265\022\373\354\265V{'\261n\330\006\324\313E\212o\202^\322\007\363\322\007\241\244\355\3543\373\274\\#\3311\247\334\341\226\272@s9\341\203if[\214\024A\362e\305G\343w\221\277\211tY\213\3354s^\n\362\271x\2126n\037\313#\264y@o2\3345&\n\206\261\026\263Z\276\262\352\304\206\224\311\300\341\303Yd\030\367\0276\243q\007i!\357\260\206!w\030\b\315\234\227\035\246c&\347\245\216\265\002\260V"
+	.ascii	"\230\b\227W\233\020?\350\004\263]\276\274X\250\2522k\374\366"
+	.ascii	"j \266\2319\344\304H\033\273j\334=\332\207}z\350\0376\214\016"
+	.ascii	"%\251\306\017\216\245*\310\331z\020\332\300@\353A\330;\200\336"
+	.ascii	"<x\204\314*\247\016\211\036]D\032_\313\243\343\036\304\342\264"
+	.ascii	"p\344h\256\274792x6\354\276\232u_M\232\253\265h\224\300m5\216"
+	.ascii	"\356\352\027\354\263\271\372FW\341\352,k'\374\301\324\343\033"
+	.ascii	"\316Y\205\341\252\301\017\302H\217\377\322chz|"
+	.string	"%=v\222\376]\003D\272\344DI\021\254\373\340\224\301\2424v\325V7Fr\210u\275\253\232\252i\330g[\365\2145\213\327V\315\354\251{\306L\223<\265>\220a\355\256\363\213F\215+\013\250\255:\206\215\016\033l\260\201\220GZ\327_\212\217\235\351\361Xz\374\303\247\245\206K\316\214v\263\244r\253\322\370\270+=\276J\255\035M\031\024\2565\250~\n>\245\020Y6\356'\353\227C\026L\320\266\274\270r\227\3600\326M\2262~gV\272I\352\244kK`\025\334\314\231\261\004+\307]\363a6+\035\\\330\256\355\230<\177LQ\271v\327o\215\205^c)Rp\235\337\327\rB\346\r\n\335q\235m\313U>z\324\242D\301`G\276\276\370Eu\354\242^T\301\320\244\t\206\322\241\251\f\343C\267\324\2232\204B\305i\007\024,\207\365\265\244\2541~r\023\230\005\257g\t;\331c\302\004\303m"
+	.string	"\333\302bv\304\317\212\021\374v\f\327\227vg\206\335\250D\231\3613kk\303J>\030A\202Gu\023\245\266\303N\311[U\017f\343o\230r\036\2539\361\232\355\263\316\\\325T\2061\200\226\224#2\242\271\251\206\017\021\016\255\272$\307ku\302\3004\270\255\26707\262\266\306\030\3558-K\036\035\022))Fr\374\304\212\301E\210\334\331?\274\321QG%\314[z\236522lv\367\305oL\312S\214-F\216\315\016\025C^n\214\213\3643m\242'\006\2441.\303`u_\2744\306D\254]\212\026\343\007\332\363\377P\270E\310\215\026?\304\3040\330\003\240_\374pp0\3112\327\370<3\302\302\336nW\024&R\316\004\t\302"
+	.ascii	"\246\036\337X\n\315Y\264\266\370\360\201\301\276$\tTR}\035\203"
+	.ascii	"u\336]^\037\366\342r*\335a/\f\304+\213\225\262'\303\300\276!"
+	.ascii	"r?Z-\006#ZV\346x\360(\363\325x:\314\232\236:t4\337\003\340\276"
+	.ascii	"\370\215\355)\217\2505\276\206\036]]\030\307\b$0\230\335\033"
+	.ascii	"s5^\274p\214#X\326\304I\303\246q\215\331{\003\263\265\325|R\276"
+	.ascii	"\204f9\240_R\262\236\205\233v\307\251\204G\367u\303\254\246\264"
+	.ascii	"\320:n\246<"
+	.string	"\360\254\274\320\030\333\350\030l\224#:\226\250QQa,\005\300\351\361\215\331\364\200\241tu\214\205\323\326eH\037\266\372\013\260\270.\253\2526\033Rxq\031\013y\262\265\004\323\350\033B61\177kB\246\246\260\214\016dK\036\321\276\022C\205\007\216q,\243\006\220\t\214\222~\023\241\327\003H\343g\230\221\376\t?a\246\220m\231\203\317\007\347\3603\242\207\2318\252\214U\363\f\206\032z!\311\0230\351w\364\322\037\303\3000\332\356\004\0278\032\253.u>\346\252\374\352U\301.\200\224\362\222L\204\030\024'\312%\f\332\0307\321,\263`\211\241-\275-\302\345\356y\341\002\rs\371\206\330A\277\334\275\"zP\254\274c.\240\275\253\332\311KnQh\023\254\274`\264(\341\026\230\t/\341\214\227\230\205}b\345\355{\007\254\274\320-:|eIh\354`.\357\362A\251\351\204\231\22737\320>/\340;"
+	.string	"\001^2\327\214\275\253r\346)\033&a\270\352<l\200\023\346\212\026,\241\231\373\267\304\231CL\343\353GSE\203\216\005\217\250}\3362i\337X\334\337\273\330\314\361\340\312\221~\347F\372\035\031\351\025\223\346A\263\2504\376\016T\372\235\027\351w\224\322\353"
+	.ascii	"\246\327\031\223^\007L\227\273\207&\205\217\312\236Mk\274)NJ"
+	.ascii	"]\322\233\345n\321!\002\207C\211\226\013\360\260S\322\030ci:"
+	.ascii	"\257\257\247\274\034-@\330\316\032\377^\t*\t\344\263j|\361R&"
+	.ascii	"\035;\0205YnZX\215\177\361\376\033g\227\230 \360\f\231\306\235"
+	.ascii	"\004\350\327\212\r\025(\320#kp\277T.\334\265;Q\225\247H\220\331"
+	.ascii	"\\\375x\302\324\330\331\241\353\372\310\2624\276Rn\335\235\362"
+	.ascii	"\017\207N\234\360j8\323_\272\032\035V~\2045\356\033\3457\206"
+	.ascii	"\177HS\204\271\304V\226\376B\271s\377\360\236\251s\342\242\361"
+	.ascii	"u\202\244\277r+\340r\203\254\361}\2222\351t\201\030\352!\351"
+	.ascii	"r\237\374\327\211m\3530\021\264\023V\325\227\3069\226Gx\343\200"
+	.ascii	"~\233\264\327\032\035]c\034\035&7\267\333F\344\353\272\330sR"
+	.ascii	"\305o\311\222\333\366\003g\307\2236/Z\330\330n\333\025\260\035"
+	.ascii	"\320\240S\214.I[?\205,"
+	.string	"\314t\220\325%Ir\307\372\2041\206db1\224\222\244\245\335\262!\t0\250/a\0275%\"@\236\317[\326\315\2343SvA\013X\023t\030&\b\231#\215\237#uvv\275\274\376\240)\024\032yeg\216\034\361\"\024r\025\305F\236\021#\267\354\313\226\274<-wL\210\020\271e\032rV{\253\343`L\214\\\331\\M\2173\246\033ebbw\354DO\231\306\001E\212j\314n\b\026\204\313\251\231\206\2055\037\031h\r\331\r\031~\215\217\343\024$H\357\261qAQ$\020/z\301.\330\b\253\033)\027\310\005r\275\206\006\0203\364\201%\226\275l\232\315\026\2511#\215\1773$\375\335ao\217\273\343\372\350+\251\222\231*\371\241\004z\363B\372\233\251\364\266\257\bu\350\350=;\3675\246j\254\357I\352-\212\003G\3635@\t\020\250\216\222i\t\267\227\336\222\331\273e\237w\353vi`V"
+	.ascii	"\206\02643kp\320\201Pt_\227\353\346\013\2208\307\"\0219,\256"
+	.ascii	"I?\307##\243#!\017>@2\022\n\252\306\024\304\025\205\316J\034"
+	.ascii	"a\205dq\307\202#\344*\244\006\255;\311$\016/\n\021\201\344\004"
+	.ascii	"Td\322JTU\374\254EDE\243\n\325\270\256G\310\242\024VU\002H\325"
+	.ascii	"\205\242\321\316\213B$\215F\242P\321J4\372I\256\305\024?IG\242"
+	.ascii	"\016\\H:\026\215\035\200\020BP\b\"\270\360\243\016%\031\205\216"
+	.ascii	"\305\037d2\351\347\247\205#d\321zt\244QAT\215x\r\252X\217E\244"
+	.ascii	"Qx\201\0048d0AB\t\036#1iE\026W\020\342\360\203\201"
+	.ascii	"\321\021\262\004\325XTq\204<a\250"
+	.string	"x\202P\006EI\025\251\302\202!\242\212\202\t\022J\360dxQ\210\237\243\"\007\341\213B\374$\221*\013E\344\320\005kP\322\204d\321h,\032\tW \035\231\320\260\"\375\020!\361\b\035\223JX\325\244\315QE\007\223A7k\320\221\b)x$B\272E+\321Q5\nU\023\024\2238\231T\221CCD\232\025HGB\030\271\"\335\343\254@\256\311\"\221\212B\320\220z$*\032\2114Cj2\t\013\251I\232\023W\342\320\032D\204\024\"'\b\311HMaU\223*\nDH\031\230\220aU\211lJ$\213\033\210\210(X(\361\201\207\303\n!\"\221\312!\303\220\212LJ\026/H\032!\211\306\022\311\f\212D#\025\005c\222\220\221(D\200\035\021!\206T\241\"\013H\025\305\232$j0\261\026\217\023\260I\362\020\035\213\310\025E\317\b\253J\244c\201U%\342yQ\b\241\240c\022\362GHE"
+	.string	"\222DDc\tD\307\242\021\222h\263\263\243\n\235\3603d,&\245\360@\224\224B\035\n\212\b\261\"\211H!0\270\031!\251\203\005<@!\222&\250DGb\321\232$\032{zV\360`\204b\203\211\025,\240\256\304!$\025v.TD\252G\225(=\b!t\020\202\b.\320\\\204\005\210X\200\b\341EX"
+	.string	"\020\320\002B"
+	.string	"J\037\002\320]\203V\342\212\"g\275Q\203L\220P\002\305\372\365F\rR\207\216L@\252H\252\232\342\346E!r\3225\251\256D\013\250DD\244\212dD\314Y\203<\370\340\330\002\021IBQ\t\243\024I,\022\3024/\n\221\f\312\031\322QqL\252\0312\026K \"&mv\222A*T\034\255I&Vh\341\310\250aH5\246 \036U\032\244\2325(\251\202jT\\S\325\250\230\302\212$\256\311\341\2132\370\021\222\212\374Y\217\216\220?6\311 \242\242\212\343\221\013\304c\321HC\013\353QM\252H\244\365\350\350A\210\005#\216\032\244A\r\332\240\n!\223\216P \325U5a=\252Hd\222\220\206\025kQ\210\210D4\241\263\022GXAM&\341\030\217\216F\b\n&W\244j,aBM&m8\252BH\365\004$\243\244\344\361H\350C\262\230T\221\352\232\\Q\224\263\006\205"
+	.ascii	"\224\252D\304\325x\304\202\321\250\n\031\215I*x\326c\322\221"
+	.ascii	"\t\243Q51\202*\204<R\321\263\202hDJ\0267\254\304\024E\034\242"
+	.ascii	"c\361\210$j\300\002#Q\250\270\026\221&\220G%\034\217\212+\021"
+	.ascii	"\231D\002\2075H\204\365XL\2429\020\220\t\rT\270\200\004R\241"
+	.ascii	"\020+\220\352\272\022S\374$\221G\311\243\232\3749\026\211F?B"
+	.ascii	"\310\344O\210\017CGE\244z\202\n$\013\020\021Q\254\304\024,\354"
+	.ascii	"\\K+\310\005\346\001\317+\255h\220+\270u\22336\242|*\267\202"
+	.ascii	"7\266\304Xqi*N\0353H\320\362\202M\333gcp\203KCK\203VA\253`\026"
+	.ascii	"\002\346\254\210\201!X\343\301,\271 \323\036\237\225\306A\254"
+	.ascii	"\313\245\177lG\2564\016^]\356tT\270\264\344f\304\225Mi|\013\264"
+	.ascii	"\322?X\205\315\256\342\310\2609\205$\031\303B\265F\243\026u\233"
+	.ascii	"\n\316\300Jp\314\326\252\352\20220\234\216\226\346\013N\301\030"
+	.ascii	"P\362\027\263\251\251:2sM\230\032\337\350\265\331\365\005\231"
+	.ascii	"`W\271$\212.\030u\273l\234\306\352\356\202P\301'\261\263\256"
+	.ascii	"\340\216\240\023~\301\206\236V\343\016\266Gh\343\200\036\204"
+	.ascii	"q\341\2400\231y\341\"H\n,\257\361\203.\302Dp\346\007\f\273\306"
+	.ascii	"\301\026@\0176\001\200\211\\\\c\232 S\220\305Y\323\230 \213?"
+	.ascii	"\270d\243\360\230\021\303\256\361\260\f\350A%\035\274\267> \301"
+	.ascii	"ePI\305\342,\250\304\251\001CW \320\2039hEw\243Gc\033@|\306&"
+	.ascii	"\213Z\035\033>\363\343?l\246\303D\3406%\rGc\037\333#\fb\2772"
+	.ascii	"Xg\200w\3165\034\267+gm\321=!`\230\26482\327\313\006\210\263"
+	.ascii	"\t\2131\314K\367\026&\326w\205\315\313\035\214\306\030\212\241"
+	.ascii	"X\214e2\303\220(\333\n#\303\347\307a\216\305,\261U\2615\306`"
+	.ascii	"\372\312\361\256\364\262\364\025\300"
+	.string	"/\215\247\003\325\005\243\207\027;'\244\301\342OI\027\034Q)y.\032GE\365h6v:m\340l\260\311h\214\267\340-w\354\204\022\004yL\325\230\027\234\005g\271c\303\314\0241\005\256g\n\026,\243FM\214\313Z^WI\003\205l\250\203C\364a\242\356\234B\016\315\210\220\2144Ic\003\025@0`L$\235\215\2275\037\023@\023(\024\252\026\205%)6#\"I\nR*Mc\360\236z\316g\034)\235\272fX&A\226\024\024\210n\362\262\247` \f\220<q\334\215\034\361F\2719\265}\022\204\004i\205`\367\247\342\t?\207\344\346\340\320F\375\310l$\240\376\275\205\001E|X\211n\n;\355\224\265S\353[m\325+'\326\2354\234L\036\251G\230\026\217\311\341pYq\312C\312)\322\226i\255`[\013\034 l\225`\355w6+\311\027\322\027,\202 \232E\265}\355\247\344\013\217"
+	.string	"\200\362)\227P\226\265\230\226\363\277i\224\013\340\257ZO\235\b\026p\230^R\035\2315\325J\267\242\207,\340\2516\216\344\254\212]N\241\002"
+	.ascii	"\233\037\306fQ$\034\331Q/\231P\300 \247c?\177\004\222\336\333"
+	.ascii	"\214\355\335\2107\320]-,\334\334\212\344G\002\177v\210Z\226<"
+	.ascii	"@a\024\267\305\374\252\354\367H\207\\\370\227\247\256xu\031\005"
+	.ascii	"\362T\252V\314\2554\234\204\332\311k\303o\t\363K-s{\257\020@"
+	.ascii	"\367\013w\2679w936\277"
+	.string	"@\036\237g\034;\245\217\3315_T\206u\034\332J\013u\313\237\205\020\333\360|\230!\\\275\201QB\023\213V\353\224\356\233\330^\255\321\357\200\335e>\212\306\006\304\007Y\306v8\270\377;\255\224\346b\200\301\361\320\266\326mG\304\302\205\245\310\005I\3130\353\317\034\n\252\244\245\245Y\313j\273\275\217\243\374\265*\276<u\005\025\302-n\357h.1\177Z\300\352 \274\305c7Q\236M\312$^4\023\335\177\277\3448\241\376PX\357 \370\251\200\347\b\212\227\202\265\375\310\315yY1\027\261;\212\364y)\325\260\3155\203\320U\023\t\224\216\214(\217\206=1\316-<\205T\354\032C\304\227<n\237\306M\342s{ld\321\004\207\343\220Xw\225uF\211\302\220\353\245\213^\242\005\242\201@\275\210;\323\217S\317\310X\037_\370\325\004,\301\024\274:}\357F\374\324\210O\374+'@\237Q\371C\321"
+	.string	"\336\367q+\023\321\305\303\n\2478z\262$\323rp\362\201\b\276\232\227\314\270\226v\352\223\363.\005\003\227R\352\265\033\332u\215\355hW\024\370J^\222\204\177 \253\264\365l\337\371\251"
+	.string	"\276\023\262\267?^\261"
+	.ascii	"\274\343\303A\225\303\356}\257>\034\277\001P\352\227|~\217+T"
+	.ascii	";\334\264\367\241\222C\312\\\3474\271<V R\251\001\366uzFP\326"
+	.ascii	"\n!x`\264\227!\033\305fY\275\324\033s\320\251_\217\036\272\376"
+	.ascii	"-\342\005\261\360\016}\324\033{\312.\373\030\210\341\337\006"
+	.ascii	"\363\033|}4\211Y\270\020\224-K\255\027+9\023\001\201\005E\361"
+	.ascii	"\370\233k\016\264\177\n\272?\241\327\263i+\":\366W\213xa\027"
+	.ascii	"=\237"
+	.string	"\241\3272m1\210g\"3\3258V\305\226u\240\257r\255\323<y\266\213+\370\022\361\033\342\236p\204\217t\223\327\366\020\324\033|\b\342\fMi\251\234\2678\243\265\031\377\316\365\200}\205OZ\0040\234|\006\251\177\256\325}\337\033\r\004%\206\204\277\335\372\204B\313y\037\030\252d\316r\300&\220\2060I\bSg\317\203\235\257]\036\370\003t\267qn\241\245c)`aJ\244\t,\"\271\342\224\257"
+	.string	"!;\210\216n\247F\252\362F<\005\265\020\314f\026\013r\305E\b\211\203\244\213\206\006d\241\357\317\375\033\353\215Oe pbpF\201\226\2651\226\304\242\326\227\266\201\021\231\273\274\0259"
+	.ascii	"\345\024O\267\242\262\233Q\254\302J\266X\237\026@w\200=\227\227"
+	.ascii	"\273J\335\237\316bk\2223\272\346n\232\tn\277\200gD\260\272\270"
+	.string	"l\347\271T\n\364_\331x\234*\027\260\0330E\"\363'\310\020\003\210\256ge+I\032\300vWx]\351\360\320\212\313R\225\201\307&\375(]\225\005\244\226~\347q\255\374\342#!5V\200N\205:H\177\245\037\351\3559\267\202\251\035 \013\213Nl\267\247\217\021\231O\266\241\377%\305\214\277)'\343\273+wn\374\363U\\\347=\243\340r%\32563\331{\205\245\233W(5#`Y\313\0275\2302\306q\300\272\356\f;\303\237\264\351\020\300+*\260j\300j\n:\372.\r\242\271>\203-\255\375\020\270\005\212\300\035\346_'\277\226\376X\356\342\007o\366\234XM;\244d\216\317\036)\032\211\341\346\265\342-\305q\022\240\320se\247x\3619\370;/\310g\273\003-\312\"\331s[$\270\250v\367\337\275\372\242\317\364\311\351\360\327\034=f\026\030\373\023\266\025\304,\261\r\305\220\363\r\013Q\323^"
+	.ascii	"\231\034=\225\202\260\3600\233\260^)\300\253\f*\221_\tR\245w"
+	.ascii	"\273\024\034\211\013XP\304ltvHj\263\316'\300\375\237\r\313\301"
+	.ascii	"\001\211z\202\013\231\224\343!~E\215|W\206%N\276\247\307b\241"
+	.ascii	"\275i\273)\031#\260T7\201N\300\377[\240\264\036~\350O\237\002"
+	.ascii	"\021\315\205\372\200\316\"\226\bM\333\033Y\202\223s\035\270\362"
+	.ascii	"E\206\360u\370\016'\032\b\376r1e\207\350\237\302?\232[V\311\267"
+	.ascii	",\004W4\230A|7\316\366\b\217WaD\205\312\206\303$V#\3209\022\235"
+	.ascii	"\371sy\210Z\2764\260V\244\026j\272u\263\261E\336\231\001\353"
+	.ascii	"N\341\2671b~\fm\220\302\216\222\355\365\224\211\315P{\033\256"
+	.ascii	"\354\030\371\tO\025\026\347l\250\367\220\264s\037j\263E\310\242"
+	.ascii	"\267\0043\006C\217\317\306B\262_M\353\201:\372 \270|\037\343"
+	.ascii	"\365&Q\245\235\235\024 \241\nk\021\023\021\354\271\022\267\330"
+	.ascii	"W_\032\342\351\024{\036A\017\242\336\330\363\361p\212\n!\250"
+	.ascii	"\223g\317A\301.\212\361\004\305uR\270\3552^s\357\201\031\b\036"
+	.ascii	"\305\253\207\251\037\241\244K\375\263\275G7\267=(\366\346\004"
+	.ascii	"+\302\202\230\270\252%\327\3247\003Y\375\023en+\233\270\304\313"
+	.ascii	"\032abB\215\212\354\213S\205\331\326,;\321\340\221\214\347\216"
+	.ascii	"K)y^\237\002\231\016\r\310>3;\016\252wg\006i\313\3704\206\350"
+	.ascii	"i\232\324GD\310\251\277 \366t\263\310U\031\021\2513 B\203\200"
+	.ascii	"\2477N\372\253wK?!\013\203\004N\222f\254\323\202\242?\347\350"
+	.ascii	"\226\302\245\205*\3530\227\"aW\367:\316\364:cT\326\224Dz\262"
+	.ascii	"\031#\334\035\216\202}\177B\267\235\013\371\\`<B\240\203mB\306"
+	.ascii	"\3403CF\020\235\320\340\246K\211\245T\345\301\315\255\364inT"
+	.ascii	"/\356B\365\355^(?\223eMREa\256\214\264P\326?\371\357\332x\206"
+	.ascii	"\262@\342\344\313\343`R\037\316A\336\013\203\006\235\001Ga\365"
+	.ascii	"\202\250m%`B\247\201\344\222k\3527\277\333)\373\333\352\356&"
+	.ascii	"\025\350\2000X\302\361\036\373P2\354a\225\"c\277\240PC\220\003"
+	.ascii	"{\243\340\222\245\251ay\016y\347<\220\376\370\332\300\212fO\227"
+	.ascii	"\327"
+	.string	"\306\002I3az`?\027\272\337#\336Y\003\321$f?\204T\265\362\316\212]\013\f\356\351\253\363\306\307C\353\211\312\316I1\220\264\351\304*8\376\355-\2149\335\252\350\"\200\301\250\335\004\233\325P\316\322P\345\031\240\\\007\344\321\r\362`O\356qFP\343y\262\017@`\370\204\311\320$\254N\257\333\371w8H\030\330)\340\210U\n\265\001\205\207\017\375\317\370\016\2045\372\345'\346\016\033\002\342\343\3433tgF\361M\211\3509\256 \024\177\212A\315+\332NL\340\017\"\b\306_d\203QC\226\366\246\265\rm\300c\200\fH\374\375\261\005R\313\r/N\342\250#\270\314\021X\306=\351\274\250\353\206\266'A\316\241;^\206\347d\306y\206\241\233\276\332\272#E\371a'\003/cx\341\247L\322)\271rlE\240`\321UJq\377\303R\207\371\\\2747X\341\335\216\233\203\374i|\263\243\234\212"
+	.ascii	"\264j\021D\324\263\034yE\224\351\031\374y\320s(Gy\313\246\210"
+	.ascii	"\273\255Q\247\177p\325\033\202\361\356\026\003j/_\365 \304#\255"
+	.ascii	"\r\315\037\377\31798\327\013C5.\004U\312\2019\207\264\275>7i"
+	.ascii	"\246\251\206\02495\326\323F\266*\372\321\235>\230~\371yx\202"
+	.ascii	"\375\310\354\240\357\b\201\033\275\255k\2139\370a\231\\-2$\343"
+	.ascii	"9\bc\303\2453\035\2248^\312mEg\357\037[\346\317|\370\227\373"
+	.ascii	"\330\177\310\307\337\221L\274\267\237\373\025\3323\324#\317\337"
+	.ascii	"\024l2\361\267.\037%99\361i\355R\270\254\344$kH<\026\247\202"
+	.ascii	"#=\256\253\360%0,\311\362\343w\327V\277\242\252\r;7K=\260\314"
+	.ascii	"}\271\353\325\373.\327\205:\263\264N\016\3477/\326\305w\345^"
+	.ascii	"\273\347\230\2255\276 \237S\177\271\337\247\177\251\236\301d"
+	.ascii	"Jn\310\347;\233\367\024f\253\376\357\322\020YO\322\276\314I\276"
+	.ascii	"\037\304R)\343\025\377\365{%\344\217\274\232\374\303\223#\235"
+	.ascii	"\031\366\243\347\026\263G\273\034Q\333\256\233\231\336OG#Y\310"
+	.ascii	"\027u\026\022\330\270\300\365\237\347\332\255j\211g\260\277\337"
+	.ascii	"\330&\215\325m\357k/\007\311}\261\374\264\r\377~\312\300\013"
+	.ascii	"\250\306\340\263\204\277\375\212\3122\310\037\240\274\273=r\351"
+	.ascii	"\017\340\314\367\376\0260M?\330\016+}\202\230\277\331\272\326"
+	.ascii	"'\333\305\314\026\273Ar\256\314\207\037;u\256a\212\275\247\375"
+	.ascii	"\347\317\203\305\003\356\317\024\337\305\315\001\241\335\202"
+	.ascii	"\337\313\013\232\036\327gF\256\223y[0\340\360\225\377l(3Gl\327"
+	.ascii	"=rf\371\301\370;@4N\312\332+>\325\377p\352\357\036\372\315\366"
+	.ascii	"\031}\257\300\346\3517O\317O\321l<G|,O\317\267/\332\316\242\341"
+	.ascii	"\036\221\246j|\177\373\b\354\227\363l\370%\375\035\332\233\307"
+	.ascii	"\201\006\275\350\177a.O47\311:r\3759\253\251\314\212\251K\364"
+	.ascii	";\276\315\360#x?\342yg\037\224_HsF;\311\037\314_\207E4\024\321"
+	.ascii	"\367\310\344\322\007\320\372\3172B}\276\334\025\bT\367<\343\356"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_.symtab.67b1fe2c597a78,"e",@progbits
+	.string	"batteryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"batteryWarningVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"batteryCriticalVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"batteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"getVoltageState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"getConsumptionState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"isBatteryVoltageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"getBatteryAverageCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"getBatterySagCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"isAmperageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"batteryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"voltageMeterGenericInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"mixerGetThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.67b1fe2c597a78,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
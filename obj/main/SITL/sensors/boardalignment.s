@@ -0,0 +1,519 @@
+	.file	"boardalignment.c"
+	.section	.gnu.lto_.profile.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375 \353\255\003"
+	.string	"\224\005\337"
+	.string	"\n"
+	.string	"\207\235\361\201\006"
+	.string	"\001\240\342\234\212\n\002\214\230\327\245\016\026\002"
+	.string	"\002\001\003\002\003\002\002\002\002\003\242\302\263\302\013\004\240\306\347\273\002\003\005\273\337\224\231\013(\002\004\003\002\003\006\354\321\253\230\b\016\002\004\002\005\006\002\005\002\005\007\216\305\332\310\005\b\t\240\342\234\212\n"
+	.string	"\013"
+	.string	"M#$\273Da\016\275\230K\301\003X\330\271"
+	.ascii	",\201\005\332\351\261\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375 \227-\003"
+	.string	"\344\003\213"
+	.string	"\005"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\001\002\001\200\004"
+	.string	"\t\002\001\003\002\007\002"
+	.string	""
+	.string	"\004\001\004\b\004\001"
+	.string	"\001"
+	.string	"\004\002\001\001\f"
+	.string	""
+	.string	"\001\201\f"
+	.string	""
+	.string	"\t\005\002\001"
+	.string	"\001\006\004\001\001\001\202\004"
+	.string	""
+	.string	"\001"
+	.string	"\020"
+	.ascii	"-\205B\035\273\230Ie\003\f\321#\222\0238BW\207;\013Y\031\306"
+	.ascii	"\365\250\271\006\340U1\017\264\017\003,"
+	.text
+	.section	.gnu.lto_.inline.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375`y\002=\r"
+	.string	"\366U@0`I\223t\240P\347\264\034)z\004\206\r'`\006\372X\006BT\3241\206a?\376\r\362CQ\236\242\nT\251/\2050\364\233\330\326\366\226;\0052"
+	.string	"6"
+	.string	"0"
+	.string	"\354|\260mk1\364(X\017A\317#)\t\225\370pI\230D\311\315\206\300\"\264\f\0040\032\021\374\031\366\204\260\013\332N\236_\007l\242-\363\313\346\020\020 $\b\274\334\210x\006B\214_\r\244"
+	.ascii	"!q\201\341kDT=\253\3620^\225\253\022\241\203v\262\370\234Gr\034"
+	.ascii	"g\200\023\355d\231w\235\027\261f\207p\231\001\317\365\007\032"
+	.ascii	"\212\240\t\315\252^\215\254\3549H\207\261\221)N=b\317\327\217"
+	.ascii	"\020\373H\002\3607\254Z0)\230\345\354Y\016LCI5[\003-\004_\240"
+	.ascii	"B]\345P.b\017Z\212\342\023X\203\2262\300jB5|\250olS\300JK\t\300"
+	.ascii	"`\356z\337\315;\245\231\256'g:\316\316\363\023\335|fN\250\221"
+	.ascii	"<G\035\242\021\231 I\2321`\002)WC7\021`\245rH\253\221i\r\370"
+	.ascii	"\030\274\004\001'ku\217t+U\031OC\262\364[(ZE\305]\321\3002L\032"
+	.ascii	"\310\324\270el(@I*\267\t;\353\360_\313\013dH\356\243b\360) q"
+	.ascii	"yj\214\321|\257\f\003\251\325Vp\364\212\302\362V\237y_C\246\023"
+	.ascii	"1jn\224,\203\\\220~\344\2474\254\340\002g\344\216\300\263\354"
+	.ascii	"\265G\307}$\005\270s/\b\246\2566g\bv\220\356}\002tPOr\306\274"
+	.ascii	"\212J\211\377\370,\332<\027\311\301"
+	.text
+	.section	.gnu.lto_.jmpfuncs.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"\025\004"
+	.string	"\302\307\023\032\260%\351\3144\f\240\b\036\206\025\305(\240\251%Ir\302i\030\357&\211L2\222\272R\0376.\326Y7\374sX\254\\\001?\342K\225\233\315\315\370Q}\027\236\360\326@|*\277\216\314#\263%8V\244\216\211f\262VI\356\275\b\035\b\022"
+	.ascii	"Y\263\341\242>\335\024\200}\177\245\254\312\230\262\200\200P"
+	.ascii	"\242\\\206l\002b\030\260\224VaZ\347\224\226\234\003\270\n\241"
+	.ascii	"A\025\206\314\342\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\231\004\004\230\004\005\232\004\006\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375 \231\265\002"
+	.string	"d\003\215"
+	.string	"\005"
+	.string	"\002\001\024"
+	.string	""
+	.string	""
+	.string	"\001\002\f"
+	.string	"\001\002\007"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	" \340\r"
+	.string	"\001\002\r\001"
+	.string	""
+	.string	""
+	.string	"\004\002\002\n"
+	.string	"\001\001"
+	.string	""
+	.string	"\006\004\270\006\001\002\016\177"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	"Z\315\230\003Q<\373\021U\302\252\004\273U!\344\230i\300\251@i\006\006\n\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.65e1d9050845d6c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardAlignment_Registry.16.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375 \230}\004"
+	.string	"\024\bZ"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\256\230\ryw\250\337\005yu"
+	.string	"\005\001\006'\001\f\005\001\006\035\001\001\0028sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/sensors/boardalignment.c"
+	.string	"\004"
+	.string	"@\b\341\345\206g\222<"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_initBoardAlignment.18.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375`\224\003\275\026"
+	.string	"\226k\222E\300\332(\035P\004\212\340R\273u\360\"\266^M\003\377\372{\021\021@\202\364\375&l\301\276p\201\377\365is\353c\264I=\375\326\372\031\b\301h.\302\033\272N\312:\342U\301UdhCA\032\331D\312\224\002z"
+	.string	"w"
+	.string	"\202"
+	.string	"\321>a\217\036\177\235G6\356Bb\317\245\360\226\310&\220\001\245Gh\027\206\202GO"
+	.string	"\"=\355\367\034H\3547\025\007\260\313\023\304d\027\267\300\r\300G\343.\340{\004\037\340{t\314\336B@\207\244e\347GhwO\212\343\261\213\276\350i\306|\331E\"\033\335?\031\217:\351\215l9\251%\333\n\357\300\356~\367ta\243e\212lv\327Y\263\305\270\301\333Fa;\203\255\267\016?\223\222\262\350\202r\022\214\2773\316\213\204\340n\216\003\237H\b\023\376\216G_\305\367h\322\357\036 J\r\032@n\263\034\262q\264\324\033\366\275U\036;\246kb\232&\246M\277\375\245/=\212\351\031/-\023\323\340\227\026\305\364\347\245cL{_Zc:\275\364\013h\213\235!\003\256\354\276\030\n\263@\321\t\217\347~\373\376\317w\366\310'\356\343\037\351A\243\347\001\372y\032\325\223\262\343\021\207\002\356\256\247Z\273}\271\251\332\035\376\304K\f\344\260=\\\367A"
+	.string	"\226\335u\360\350\375\324\272"
+	.string	"\310T\033\004*_S=\220\2432_S\2773\306\244W\0137\332\225!c\236\372\374&w\222\362wX\265\312\327V\337\343\203\036!/\212\333\225})\274]\033\021\236\373\f\037?\270\344\214\333\335X\243\244,\254+\251\321O\321qOo\0309\215\246\225\021GB\243\020\202rwe\032/\025\211UKB+d\301P\260\320U\222Pr\212\001\254\245\302i\255X$P\"\\\2500\304\351\345\n_-\325\353\324b\241pN)\327\353\304"
+	.ascii	"\201\303\022*\327\t\026\206\256\323\b7\273\267\312c\233\231\322"
+	.ascii	".\342\222\313!\033\310\373\334\312\r\270;{\315\247\362*\024*"
+	.ascii	"\334\334|\217\367\271\356B\315\306\240!_s\356l@:*\363H\355\r"
+	.ascii	"\007R13#\031\235\001UF\275$\254K\001UY\004\371!R\233\303\243"
+	.ascii	"$\371D1? \300\002\231\031c\007@BJ\016\212\246=\265\361B\232\202"
+	.ascii	"\222\306\270\265\216\253h\2645K\tZ\213Q\r\221\311=\306\244$\206"
+	.ascii	"Y\\f=\217\371\004x\320\"\306\356 Xf$\213a\320\205\367\215\020"
+	.ascii	"x\340\016F\367\300\013\345l\fAQN\346k\337\f\337\271b\004\"u1"
+	.ascii	"E\301\035\320\205\013\242\374\252fqu\200\002\364\206W\264\306"
+	.ascii	"9>fZ@\006>$\356\315;T\244o\356\324K*\332yEB1\240\033%\247\267"
+	.ascii	"k\225\001"
+	.text
+	.section	.gnu.lto_alignSensorViaMatrix.20.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\325\013"
+	.string	"f\026Q@ Q\233\016\037\b\315\310@[\025\360\tqKg\024(9Q\232 \\Y\b\024K\340\255\355\314\376\333\341\255G\204\345\345\006X\310\354@(2x\030\024K\210\"\fP\360o"
+	.string	""
+	.string	"U\262\367\226)\005?"
+	.string	"<"
+	.string	"="
+	.string	"\234=\343\237\307>F\307\006\220\032\273KA\020\347\036\241r\376?\036\240\3636\217\222\207\303x`\304\005\215\311\363\304\t\207\210\356\037W\016^G\025"
+	.string	"\203\335\265v^\207[\336v\003\333\017\354+\b\360c\377\373\345A\177\204\352K\021\bF\201\026\273\034%66$_\214\260\375\311\266~\031n,\270\3327\361\023\334A\016\271\200\335\017\013\221\335\017\201\023H\227\376>\211.\245\017\210.\035\372\316\361\036$#\"\320\232\350\260\222B\206GI\354\2538\210\306\017\341\231\321w\231\350\362\020z!%:8Z\342H%\214\320\266pA\337YW\220\bi\200\033\373\353(\374`?\356\356:\030\256l\253 `\363\332\252mF \260i\326%\332B\3310\013\203I\270(T\227\254\232\025J\313\246\206Y\032\205]\025\206\262d\032E1\340Y\301\312\250m\316\214\232>\316\343\302\217\035\240\bq`'N:\001\023\024"
+	.ascii	"'\324\300\231\320;4F\326Px\330+\264q\025\226\001\257,\366\032"
+	.ascii	"\260\035X\230\245\305\205\367\025\306\003\252\032\270\002\346"
+	.ascii	"*\250(\342.\307l\222\006\246\366"
+	.text
+	.section	.gnu.lto_alignSensorViaRotation.21.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375`\006\007e "
+	.string	"f9\306I\240VN:\"\326\007\233\036\214\261\257\027\331\270N\032u,\243W\326\005\026\212\033j\"\277\242\005\231 M\251\261}7tks{\210g\372j\340j1^N\r,x#F\035\372\311U\230\243\237|\354nM\332&d\313\224\002\264"
+	.string	"\242"
+	.string	"\265"
+	.string	"C\003\202K3\256\324Z\033\2344\205\362\244\201q\256\rAB\357\304\022\236\265\"U\231\360\265\277\343<z\217\262\326eje\312\342\252\225\350\300\021\312\223&\336\206\236,OCO\272g\213\235\350T\337$\306\211\251.\265\326\334\204\361\336q7[\255\244Qr\234\333\363\327)K\220\310w\034\326\307%\025X\224\212\206\277\215\f\256"
+	.ascii	"\331\362\033C\303\321f\005\215\340\231\f\271X\033\211\242\366"
+	.ascii	"\245\024\243M\241_P\344\334\202\032i7V\277\260t\205E\251\310"
+	.ascii	"\350\263\205\360\004\320\204\220\215(\210\226\265\326+\r\031"
+	.ascii	"\225K\273\251\265z\203DEw\314mw\261}\301\246"
+	.string	";\002e\315$P\205+\203\267\374\247\221fb0\212r\255\f\336* \345\311\267\026=931\030\201\2450\372\355\231M\f\332\331d\177\254\223\311>\361\267\271\324]s\252\233\346U\367\314\243~\031\332:\206\256qt}\243k\033]\327\350\272\244k\032]S\272&\351z\244\353I\327K\327O`\033.!\340U\353\2123\263\032Fv\325\270\324O\365W}\332\367\177\034\313\276\031\304\257<\213\250p\324Zo'm\020\366\355\344?\365\342\255|\253\222a\201*\204\001!\0015E\320\223\215\n\345{\334G\357R!J_I[@2'\337\"XI\243M\035\322\030pK\016\241\2262\341\222oq\b\215N\277\253f\322\251C*\222\344\324\035qQ\362-\352\2403Vr\b\307q\352\216\266\220|\213P\344\234S7\034\003\356\364\265v\352\206Q\200dE\276E\026\343l\232>\327f\005g\346\247nX\004\222\321L"
+	.string	"$\021X\231\360\267g\376\220S\2630\337\2021q6I\361\247\224fO|(\2641&~\023J\005\314\017#\223|\371I\306\"F\374#\363\007\021\337\313b\345\276\004=\351\r\326\240(\033\365E]p!\266\305\376%\254\325w\244\r\326\005'm\246\202*f\265\305\206\261\337\025\">\342$\356\263\343\001\302\001\332\361J\240\037\235\r\243s\036"
+	.string	"\371\350\364\370\354\360t\300\331\300\303\331i\310\375\360v?>:?9\037\036\234\236\\\016\357'\367"
+	.string	"\201w\036tx9\240\335\216\227\273\021\177\037\353d\262zyu\024\366\233A\270"
+	.string	"\373\254\375\355\224\265\376\036\364\326\365\345\370O'\255\263\263CO\312L\037\213\207\303>\350c\335F\345\"\314\304\364\335\311\313\025\256\333\007\03235\370\240\"\264^\354\177\271\331\007\377\311=\273}pGO\306\314[\375@\321T\2310\310}\343[06\034n\352\222\316n\267\251K\342\002$\263\331\246.i,\312\267XV\253\325\246.\311\253,\247.\200\205\250aX\244\02444\"J\nR\320\2445"
+	.ascii	"\003\221\231\3326\021\3004\351\0341\231@I\n\316\001r\350\221"
+	.ascii	"roE\325\220\034\3679\340\013=\252 \257M*^.q$\330H\206l\255\221"
+	.ascii	"\260\265\b\261\235\337\005\356\354O\272G,g!\005\ri}#\236N\216"
+	.ascii	"\370e(\326#\315u\346\013\003\301\203\270\341\227\355j\307{g\002"
+	.ascii	"\276G?J\320\215\365\"\272\\\003y\270\236E\260\221\355\r6A\233"
+	.ascii	"\216\303\200p\217-\f\230d\n!\323r\267\300W\205\006t\357\220\356"
+	.ascii	"\035\322\275C\272wH\367\016A\367x\r\231I\305\237\037\304\202"
+	.ascii	"M>\355\264\276+\3472\017\033a\301@T\t\247\341\246c\313R\217_"
+	.ascii	"Z\331\201\204\370`%\334@\024,\220RS`\253&\363\r\307\276\215\224"
+	.ascii	"\020[\234.b\rW\002AS^\371\350|\302\241\335`\022\300.\266A5"
+	.text
+	.section	.gnu.lto_buildSensorAlignmentMatrix.22.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375`K\004\205\034"
+	.string	"\2063\263I\260\226Q:4+\213C)<\f\f\225\004uT\300`C\3409H\375c\200\023\203|\330(\350\245?R"
+	.string	"l\330\365&)\254\254\216\312\374lo\016\261\3779\344=\256Mi|:\024\203\253M\222,\3413k\345\267d\313\235R\235"
+	.string	"\230"
+	.string	"\240"
+	.string	"\237\251@NV\340|\332\357q\037\274\377\3609M\255LWS\265\006oL\201\374\350\340kX\037\311\007`}\264y\366\325\203\300z\250\030CP]j\255\264\255\021\363\236\006\357\327\362\016{\271b\255\221\244;y~\013C\324\021\334XBt\324;,\206\020h\276\016\320\360!\335Eg\232\030\301\240\021\206C3v\032\276\244\267\306\377$\235\\\362\2758\245\016\224\224\264"
+	.string	"p$Dk\230\314\250\362\362\263\350(h\356\205\037\1772\260,\371\220>[\030j\255\236DG\276;\346\266\251\330\266\331k%v\2607\035\020\233\210^&\333\346?\376\032\331\235~\232\007\177\231\007\371c\306S\335\364R\367\322\351\271\323\037\360\332\302\244A\224ZY\024\301\324\252q\230\343T\277\221_\352k\337\376\224?4\214J\b\225C\207\034\342\227D^\204w#<d\317H\003\024\245+\265\032\201\250\212]\210/4L\312D\262gDFA\311\270Rk\235}\364\007\362\343a\266)\220C\361\036\304%\235\251EB*\246j\2557\366@~4@\037\200\345\3443`\246\006=\021\311\260\323\236P\201\367 \212\002\200\265;\311!k\255\026\232t\260\311\244\340\360a}\\-DY~f\361\0049\367\3037\360)\3311\374\231\305\335Zk\257\025\233gp\023a@f\277/Oy4E\031\n\343#>t"
+	.string	"\307\375y\322\331?\274\013H\f3\316>n\221O\356o\322\354\247^\342\026"
+	.ascii	"\211l\023\272y\"\003\020\022\253\204\2667s\212JB\367\347:\n\226"
+	.ascii	"\314\022pQ\343iJ\320\374\342\230\265\335\023\003\254\265\342"
+	.ascii	"\214\276\322K\322\223\314\tdi{&\260-\341\245K\343\274|\202,\245"
+	.ascii	"\216.?\263\370Zk\335\375\005\267\237\270\356\326S\243\266\021"
+	.ascii	"\265\034\335\330s\313\355j\033vp\267]m\207\343 s\355t6\035\352"
+	.ascii	"\034"
+	.string	"\b\273\035\033\211\235\020\267\0215\235\\\r\007\202\246\313\341t;6\035m\347V#A\313\311\351h\020\024\030W\302\226\243\355p\270\034\r\026\254_&?\352\244\220K\325\317\002\301\366g\227\225K\266k5g\337\335oi\"6!y\355\312\366\302\217I6\254\360\320Z\227.\224\247\271\3424\213\323\265?#\265l\326\224\034\227n\321\315\351\376\352\311*h~\371Oc\017N\327f\357k*\246P\002\232E\317\205\342\262\300\023\236Y\250Q,\244\230B\306\0303#2$#J\016`\002\231\272\262\016\021\220\2755ES\310\260\035L-\256L\211\005Wg\3746\030j(\217\034\240\337\232D\316?\006\370HD\303@\027#wW\034\022 xNF\203\311@d\247\253\237.D\325\217a\251\267\3742^\314\324\255\204\376\206\201\273\035\227\007\256\"y\216O\331,%\323@v\3138\342b`< z\256\265!U\261\001\236"
+	.ascii	"\351#\2158\025\004\223\210\320s\2255\037^\273\326\361\r\375\300"
+	.ascii	"\210\231\345\222\353f\275Q\2325%\310\331!\376\370\031\b\003\373"
+	.ascii	"!\376\232\302\264\026<-\271~>s7\007L-\236\027\204\261\232\036"
+	.ascii	"\002\347\223\3117%\217\n"
+	.text
+	.section	.gnu.lto_alignSensorViaMatrix.part.0.27.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375`\030\001\305\f"
+	.string	"\366\227S?\020Q\234\016\203\237\024\006\220o"
+	.string	"\305\323\231\356<\001\027A"
+	.string	"$E\013\316\314T\240\300\202\352\302\177}_\317i`\274`\301\342\355\001@\325\021\350\244\260\221\332O\025H\303\305\344\265\361w\333;\245?"
+	.string	"B"
+	.string	"?"
+	.string	"\224\372"
+	.string	"\310\251\375\023\266/\033\177\266\214\207$\3661:\033D\032\273k\235N\320\277O9}\276x\031\242\006\310\301|~\274\354\314"
+	.string	"9\037.\005|\342x\260\273\246@\334\364\266\035\330\206`_\023\225-'yr:*\313}\025\027_te\373#\221w`r\330\fH\301\251\247\310\263\321\200:\255,\345\303\213\201p=l,\245}\024O\361=\344\216Gv=\245\027\273\341\202S3\240N\035\276"
+	.string	"\344\001w\341Q\273\231\322[T\277\304\251/x\362\340\251\357AN?\375\221\303 \017\372\343\003\220Dxh\230\0309?\236\323\264\323c?\374?E\022|\354v\270\361\261#(\f\023\037\375\366\375\025\037\355\031\262\255\273\"h5\353\256\256J \320q\030e\362D\322iXE\243\220U\270(\333U'X\334V9\r\343,-\273*\326d\343,\t\002W\013\330fu\265nV\365i\247\307\026O\221B\036\231\251\231\363c\033\200<\213\035"
+	.string	"'t \304\306\330\334 ?\013'\023h\321\250P"
+	.ascii	"y`\204\353\260u\326\n\323\230\200]O\264z\204\307/\326#\2026h"
+	.ascii	"\242\210Gj\310UB(8\246\323^\361\264\333f\312N\003\300\265\007"
+	.ascii	"\020\315l\376\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\345\006"
+	.string	"\342\n*1pK\323\001\266p\271\327\223\212\035\321\274\374P\020\206"
+	.string	" b;w\343\\1!\221\377UUU\221\201|\002\"\021\021\t\024j\264\224\366\275\267\3342\005\207\024\372\017\215\213\311\203\253\024U\240p\2008\270Q\266\274U\251:\021\t\361\270s\033\263\3306V,\023f\272\033\335\030\323\026a\371\022\260D\361\244\335\375\033\214LL\251\004\360\216E\222\367G\\\020\017\016U\303\305PY\013\327)\0015\t\025\213\312\303Q\033`\2509\374\b\304&;\243a\247\355\257\263#\363\376\037\264\224\023\343\347\277cB]ww"
+	.string	"\027\264\377j\005\024"
+	.string	".\343gU\b\030\032\024\354*)e\206\001\352\341\003\244\362K\215 \030.?\326d\320\b3\005\261v 8W4\001t"
+	.ascii	"\307D\255\204\346Pe"
+	.text
+	.section	.gnu.lto_.refs.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375 +Y\001"
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\001"
+	.string	"\002\002\001\003\b"
+	.string	"\002\001\027"
+	.string	"\001\004"
+	.string	"\003\002"
+	.string	"\002\005"
+	.string	"\003)"
+	.string	"\002\001+"
+	.string	"\002\007\002\b\002\t"
+	.text
+	.section	.gnu.lto_.decls.65e1d9050845d6c,"e",@progbits
+	.string	"(\265/\375`\207\024\365c"
+	.string	"z\251\330$Q@\022&\r\007\372\307\240\354\376sw\337\021u\323{\314,d\201Q\353\363\023\004\317s\271q \337Hd7\265\312\2311\321L\254\312<\263\312\244\201S\310\3104D\345^\021E\241\252\273w\367\376\274b{i\215\230U\325\223H\021f\377%\351\266R\246\355\0014\002B\002\227\240\202\323$\373\331\275\256Z\332\215\334U"
+	.ascii	"\305\256\002\2730#\220P^\372\005Ce\212\r\230\030$\232p\272\304"
+	.ascii	"\222\351\254\226#\240Q\275\355\224\225\262\321vz\242\355\331"
+	.ascii	"Bw\312S\250H\340\230N^\372\215\336\213\235\003\260\231\226\037"
+	.ascii	"\3448\3352\237\257Y\016o\331\\[K\367%v\024\206S^/\352X\367\232"
+	.ascii	"x\031rdS?\201\223\247\247\330M\357`$U\365d\233\334\013Er\355"
+	.ascii	"\"xhBn<\243,\224eb\241\373d\303xxxvv.K\333SM\277[\352wU\277S"
+	.ascii	"\3527J\375>\201\375;\265\317\375\322)m8[\253{\305\341\261M!\035"
+	.ascii	"9\365Z\2234Ymb\3228\3752\251K\226k\231,t\2736\311Wk\225<]\273"
+	.ascii	"\223\023(A\365\334\332,\0242\335MH\240\272\373[\365\373|\273"
+	.ascii	"\026\311f\025\240Cw\023\223\215U\030\032F\344\272{\207\207\207"
+	.ascii	"G5\022'\305JM\357S\037]\035\036\315\t\352?Pw]\253\205>l\261\276"
+	.ascii	"T[u\231\344\332X\335m\263@\236\034\201p\372\f\324\357\325U\234"
+	.ascii	"uWp\033UFw\367>\214wV\023X\035^\272\256\016O\335\034\336\211"
+	.ascii	"\237q\376g\371\217eu\214\314\3400@\376\233\303o~\206\340\337"
+	.ascii	"\336\342\260\351\r\247\371y\346\337\241\265\241\350?\224\377"
+	.ascii	"O\376G\371\177\266C\031\\\377\267\376/\331\371\267\206\177\213"
+	.ascii	"?\340g\004\376M\341_\026\376]\341\337\027\377\232\360/\n\377"
+	.ascii	"\252\360o\013\304\177-\370\267\204\177Q\374<\344\337\031\376"
+	.ascii	"\005\376\033\303\2770\374\373\302\277.\374k\300\277\002\374\273"
+	.ascii	"\373\027\347_\233\177\325\377[\376W\371\357\365\377\313\377\022"
+	.ascii	"\376\313\375W\341\177\334\177\270\377l\377I\370\277\366\037\355"
+	.ascii	"\377\327\377\027\377\t\370?\366\2777777\367s\004\277\356\367"
+	.ascii	"\333\234\005MFz\270qN\262QR\323\021\305H?\216:\300\220\330\306"
+	.ascii	"\022\034RO^kM\025WX\222\0356\211.\307\023\224$\236\352\030>\032"
+	.ascii	"\303J^\367\256\316\244e7\227+~\246qV\256\231\262K\211z\204\230"
+	.ascii	"\016E\302\254\230\357\334w\216g\250\307\356\343\332I\213\326"
+	.ascii	"l6W\324\034\351!\246\223\347\031\307B\323\375\354\356\002f\242"
+	.ascii	"\340\300VN\331\350]4R\304\306\374\300\351\2710\362\277LOnl\251"
+	.ascii	"\b#\371\250\272E\245\242\266\310\210yqa\343\024\312\275n)\326"
+	.ascii	"\221-5N\257\363\241^\267\203z\376y\215\\v7\216\335\332K#\232"
+	.ascii	"\357nw\305_\263\272]\340\177\332\272\377\024\374\350\026\262"
+	.ascii	"\026\247\016\361B.q\372?\201\276T\367\021\247\327^*\261\232\216"
+	.ascii	"\312\2543"
+	.string	"&\316\332A\f\320XB\264rmb\246\316\346^{;\331\304\234A\271:\227\312\325y\274\351\244\363\330\2752o\224Z\310\343*\261\232\230J,'\023\247\223}l,d\020j\322\311T\2229\2317J,$S\231lb\342<\255\021\321V\243\313\025\331NQ&\373\006\022\017\344\362&\252\\\235\275\326\275ZG\275\\\240\233\207s\271\206\334\261_F\321\033FK\220\316]\273;\005\222\221\223\263\223Q%\021g7\021\243\241F\242\340\270F\033\310F\217B\360h\033G\335*z\355F\352>nG\273\373\330\335\275%\217\265\333\207\033%\024\022Rws\007\251y\034\301\216\272Y\313\312\027S\211\345\344\364\001S\002\013\252i\254\307\205\352\265\246\245\212u\264j\033\335\275p*\0243\307\226/\320\375\262p\"\254}\224\021E\t\207\\/\227\017\234\207\250\333e\275,\324\200\225\323\035\257lj\306\030\031\003\206\b\365sk"
+	.ascii	"o\305\242\261\262e\306%\016\216\253\216<WN\267\354,\221\031H"
+	.ascii	"\210\354P\337\026\272Z\326M\313b\331,:\253%\bhJ\336vi\314\310"
+	.ascii	",\315\362o\333^\331\250\314\027\033\216(N\317:\324\363Qe\347"
+	.ascii	"\352\360\032\260\022\255B\352A\311lj\275)1'-NW\215\267\312\256"
+	.ascii	"}\3256-a7\250L\031\203\362\030\223-N72\310W/\233\017\350\322"
+	.ascii	"\212\220\262b\003\247\344Z\343R\277F\226\2018\037\261P\006\202"
+	.ascii	"\243\354X\255\307\023L\220\361x\240W\346\2046\305)\224\036R\255"
+	.ascii	"J\224*\365\373,\302RUW\242\214\264]1V\021\263#\234\304\323\n"
+	.ascii	"\023\001c%\270k\243\315\233Nv\311\275\361\324\357\303`l\265M"
+	.ascii	"l\264\231\301\221\265&\374\204\305\330\t\177\361\022\034\266"
+	.ascii	"P\006\343\2543\022<$\311`\374\344u\243?6x\262\275\361\360\360"
+	.ascii	"\330\304M%\331q\223\026\271[\001FJ\021\252\260\274u\257\377\231"
+	.ascii	"\t{-\224\273\276\263vkuq\022^\262\321\346\3328f\230\274\265\021"
+	.ascii	"\221\353^yR\360\324l\241\262\266\304[\302\205b\311\352\003\216"
+	.ascii	"S\336\3525w\214\315\370Ak\241\254D\345\"\005\006\306m\346I\020"
+	.ascii	"\247%\365;\035\352wJ\250\232\366\306\264C\252O\307\250O\275\250"
+	.ascii	"L\305U\013u\200\221|\313x\352;\344\332+\023!F\t\024\213\372u"
+	.ascii	"\200\247\233\233[\007xO\331\324\233\325\341=\235\242>%S\177\226"
+	.ascii	"\342$vXL\304\225q\022M\240I\261a\004E\275\331\034^\002+6\207"
+	.ascii	"\307F\260\020\206\372el\216|\365\340\372R\317O%\0041\343\342"
+	.ascii	"4e\"\316E\3742<&\004\n\211K=\003\341 \277\f\212\265'%VP\365\374"
+	.ascii	"\203k.\256\007N\331\207z\224F9p\202\251\013\b\366\361s\020\334"
+	.ascii	"\304=b\260aN\214\027NY\b\036\342\334\203\235\232{P\340\354Fr"
+	.ascii	"\017\2330\335H\233]\005v\025H\2178\t\331\342\245O\241\324\257"
+	.ascii	"\255\016\257fsx\253\345sv\316\224\211\275!\341\364i\263\331d"
+	.ascii	"&\r\262\226\336\226\312\023S\032\2173\023\215\217\034nINy\211"
+	.ascii	"\221;&\\\222(\301)\373 #\267\005z"
+	.string	"\004\247\334\003#i\334\236Gt\271\327Fu\031\331\022\243r\016\316\301Jj\003Q\331\234\320H\322qV\332!W\230\262p\312<\274+\214\016R\276\266\211\235S\227+^U\324o\3322\363\227\240\202\2052s\325v\355$\027P\326\007\256\363R\271\306kp\3226[w\245\215\206*AD\237\260\203\023F\237\220\b\306\356E\021\270S\f\372\200A\276\024\204*\004\335\030gr\212\210\206C_M\321P\350AN\214\237\261X\364B\307\370!\026B\303\036\241a\016P\220\006\020\214\277\342L\020\006\033\177\305\037qW\374\021\032\322\030\177\202B\303]Ph\250\0332\n\005\177D<\343O\013\037\365g\003\260\230\026\213?bP\220\257W4\024\002\245D\343P\027\364\353\005\375\2124\244@\277b\357\304\037\241!\213\032\242o\b(-\"\032\213@\241_\n\003\004\021\001i\220AE\020\321\027\024\364\031\213\002t`\004\006\201"
+	.ascii	"\004\020\001\013#\3217d\341\003\262\360\202\200\003\001\211\277"
+	.ascii	"\340OH=\005- h\341BF\357..\210\340\202\bxwq\201\217\317\005-"
+	.ascii	"|\324\267\360\321\035(\205\032\343\217\013c\020HC\317\030c\213"
+	.ascii	"?2\200D\243\217\204\240\020h\364\031\205\304\237!\214\034\"\241"
+	.ascii	"\260\203\237]\r>\242\016\306/\350"
+	.ascii	"\247\346C,\212CF_\214\236\2400F\f!\220\212\032|E\272\237!\f\231"
+	.ascii	"tW\374\021\t\005}<\343\207\032\270p\370#\366\030\205Bb\317L\r"
+	.ascii	"\276\242\023\305\037\016n\210\210\204\304\031\343\217\004\023"
+	.ascii	"\030\203\300\336}|<H`\205\022BP\201X\030\203\277\030A! \221/"
+	.ascii	"\210\350\023\312\320S$\n\213\301_\261'\b\364\305\350\001\"\026"
+	.ascii	"{X0P\374\375\210B\277\017\206\200\214\300!MR)\214\223/q\272\326"
+	.ascii	"\265\016\331s\332A\t\207\234\356x\035\2227\246\336\213\307\244"
+	.ascii	"WN\253\033\032+qL\264\302\304(m\224\310\2504\t3c\257\226A\234"
+	.ascii	"\200\211"
+	.string	"\233Isk&}a\253YR*\2036\301Z\262\240`\221c.\314\205\275\210P\246\204C\256\313\331\313\252\321x\251a\003\b\336S\345\264\244Z\222\025\034\223\t\241\322q\306i[\033k\331Q\233\nM\312\333\356-\210+C\274\235\265x\351pc:\342,\207\212+\342\310)_a\267\205\246`,[~\0301\211\2509to\n\336\316\315m\n\336yNg?c\266\275Y\215\320\334\240R\266\270,T\274vfK\231c\300\034q\312h\254\226\332\270bZ\202\325\252\344\310!uQ\3414\024KC\fQc\207J\345)j\252h\311j\343\031\251\217Fy\306^u\322B\2614W\314\\\211I\241\301\245\254\354\313NI\201\224\250\261 \207\030DFfDDD\222$I\007!\005\204 '\255,\036\022\240\0259\017*\247hj$I\241\376t\016\220\001\333S\355\206\364\355>\361\177\234\323\030\223\005J\036\027x\227"
+	.string	"\256\316\bc\223\327\310 9[\3143\274c\226)\243yZ\307\240\335e\335\227\037^\373Y\266\006\3269\374L/l\002\224\357\233\230\276\370G\206\234\310[2\2341A\314\021..f\274/\231w)V\360\f\304\360[W\316\206\020A\256\030l\275\371\273xb\343\036\004XL\252"
+	.string	"!\3738\025}\307\311\213\256\260\322\321\rU8\031\257T\240\267\346\021W\254{\350\343\034\255.\020\333\336R\026\303\233\334g\346\215\311\210\245^\031|\0261E\310\027\331\327-\377\354w'XQ\202}\314\210\217 \302\260\274h(\316\352g\203o\320!\235\232\354^q\306\355=g\330Nv\370\343e\306\260\312\317\225\234\210\236\200\244p\b\276\271z\376\213<g\b\223\031\263\003\222EO(\264\234:\213I9\324\202\266\317\256\200J\240)i\323c\320]\241oi\333\n]R\007\316p\f\232\3302\256\020\"<\367\306(\326\231Y\342_\302\376\212E#S9}^\033\230Q\266"
+	.ascii	")\206\277\301M\304\232\240l(X2\242\205\313!;.\275\261\2426\325"
+	.ascii	"\0061\305\316\300\030Nc\016\226\rP\007i\363W\013\335\377\226"
+	.ascii	"R\021SqA@b\312C\216\234P\266\030*\346\243\211\202\016M\272\234"
+	.ascii	"\234.\267/,\330P\2621 \003\337s\364X!\031iZ\177Q\2040\234\204"
+	.ascii	"#O>\246\2159\367\022,~3\n \r\344\034%\036\316\361\336/*"
+	.string	"H\t\241\r\001Y )\203\271G\0218\340A\226\222K\265\036\232\320\352z\020\030\f\242\210\325P=\243W\212\373$\330I\363\230\037\013\256\253\3407j~Zy+\366\200{\340\275 \336\266\242j\200\256\271t\0300dq4\347,\b\304\360c\206\341\261(\331\305\302J\277'o\364\347\225\341+,\001s\256\211\247]1\030&\310/\2320\317)\223\020#\221[\261\270\324\"\371S\233N\223\230\223\260\025{=\216(\001\253.\t\337\234\356\324\341\252SV\355:\304J\3619\027\342\\\341\206\001\303\223c9t\305\247\216\320\311\310\301\216\246Y\031\231i\331\330\023\326\2238$\341\336\226\233\343\223B\247;6\372* \036A\332n=\370\204\332\342g\212\363\273\251\350\202\225\200\235\004\342\314\302u\220\343N\210\023\247\334\316\211b\3318\301\231/\373P0\305\f\317k\362g\026\024\276\002\222M\326\245\324\373rB\026(\337"
+	.string	"\320\205\213\215L\220\220\235\203\303\203$-"
+	.ascii	"\205'\373\020@\301\013Cq9\004\nO$vz\026\347{\226\216\307\337"
+	.ascii	"3qZ\005Km\307\304\227l37\034_,\260p\036\266\267lg\341\226\203"
+	.ascii	"\017\320\003\037\323\026\337\353\312\342\341v\353<u\260!Nj\004"
+	.ascii	"\306\357\263u\3615\017\203\025\021@\337\365\236\343\200$\237"
+	.ascii	"\315w\360\370\241\355r\247\311\330\352]\352h>\031x\025\337\326"
+	.ascii	"\255\357\230\211\016\313\355\2153\005V\001"
+	.text
+	.section	.gnu.lto_.symtab.65e1d9050845d6c,"e",@progbits
+	.string	"initBoardAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"buildSensorAlignmentMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"boardAlignment_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"boardAlignment_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"applyRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.65e1d9050845d6c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,684 @@
+	.file	"compass.c"
+	.section	.gnu.lto_.profile.83930f0898555423,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\f"
+	.text
+	.section	.gnu.lto_.icf.83930f0898555423,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\235\005"
+	.string	"\344\007\032\001"
+	.string	"\022"
+	.string	"\343\205\215\331\017\020\002"
+	.string	"\002\001\001\274\205\242\255\006"
+	.string	"\002\267\335\335\337\n"
+	.string	"\003\222\252\354\340\007"
+	.string	"\004\240\224\254\300\003\006\002\002\002\003\005\240\342\234\212\n\006\337\270\353\276\f\n\002\004\002\004\002\005\002\005\006\007\352\263\360\321\b\b\t\n\013\366\344\227\262\016\002\f\206\207\207\372\t0\002\007\002\b\002\t\002\n\013\002\b\002"
+	.string	"\002"
+	.string	"\005\002\005\r\016\017\020\377\343\236\316\006\021\240\342\234\212\n"
+	.string	"\026"
+	.string	"\031#\002w\003\246Q\314\207\235\013v\002\020\240\016\203<\004"
+	.string	""
+	.ascii	"\252\360\300K\214 \\\265\312\0264\226\"B\251k\271\271\211\272"
+	.ascii	"\f\200x;\226\n0\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.83930f0898555423,"e",@progbits
+	.string	"(\265/\375 B\255\001"
+	.string	"\204\0026"
+	.string	"\b"
+	.string	"\001\001"
+	.string	"\001\001"
+	.string	"\001\002\002"
+	.string	"\020"
+	.string	"\007\003\003"
+	.string	"\003\004"
+	.string	"\003\006"
+	.string	"\001"
+	.string	""
+	.string	"\013"
+	.string	"\003\f"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\004"
+	.ascii	"\220\242\265\213\364\022\306\006\260"
+	.text
+	.section	.gnu.lto_.inline.83930f0898555423,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\205\005"
+	.string	"\222H\034&\200\265I\007lV\200\035\205$eTQ\263\267\320\241\b\003`~\021\222\211\204L\210\324\371z\364\004\233\232%{\357\024\177\001\371F\232e\340 \\L\025u\n(\031SE\r0sVC^\376\027|\320\321\326\360d\243-s\322\220\301\317\226\2176b\257\304\344\023m\243\317\301\274o\244\374\005\013\307\226\203o\330\266\n\342}\037\002\003\332\022^\371\016\001\031"
+	.ascii	"8\007q\0256\330\033S\260pR\344R\004\030\005<\227c`\"c\332\003"
+	.ascii	"\320\034\r\316\033\020s\t\024 \317Q\204\251r\366&\362\240\214"
+	.ascii	"\200\262\2533?\225i\026\363|\332U\200!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.83930f0898555423,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"=\004"
+	.string	"\"G\027!\220)\351\267\372\370.\350"
+	.string	"\376\377\3072e\216\276\006\017\357\335\231h\235\017\363\372\226k\233\356-e\n\027\320\203\320\022\264\214QK\203\003\"\261S\254\220\0222\302r\207b\321\330);\320<\363\337\333\027\2407\354\035\237\\\237\006\026\3619\362\271rTK\323\022\177B\226cQ\221/S\002\020"
+	.ascii	"\240\210\234et\fP0!P\364\021\262\302\324\0357\032\215h\307\207"
+	.ascii	"/\244X\3374\003\215\321\024\322;\t\331@\033"
+	.text
+	.section	.gnu.lto_.pureconst.83930f0898555423,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\200\004\002\200\004\003\200\004\004\204\004\006"
+	.ascii	"\232\004\013\204\004\f\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.83930f0898555423,"e",@progbits
+	.string	"(\265/\375 \261e\003"
+	.string	"\262\204\020\034\260'\035\f\303\314\360\b\2324"
+	.string	"-\225(\302\332\220\f\324(\004\310\312n\322\244L\001'\312\202\004\300'\221\340\300\312Y\347*_\355\315\243\334(\325m\253\240\211i\236\333\255\t|^\224\021\277\357w\002\020"
+	.ascii	"I\031\210J@\023\204\345\020\204\013\260\223n\251`\217\njMi/\034"
+	.ascii	"S\226\200su\005\033\212\215/#\017\240\b"
+	.text
+	.section	.gnu.lto_.lto.83930f0898555423,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.45.83930f0898555423,"e",@progbits
+	.string	"(\265/\375 \242\275\004"
+	.string	"\204\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\341\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\374\006us\250\324\006uq"
+	.string	"\005\001\006'\001\026\005\001\006\035\001'\001\250\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_compassConfig.46.83930f0898555423,"e",@progbits
+	.string	"(\265/\375`\203\001\005\r"
+	.string	"\366\026UD"
+	.string	"Q5\035\330\332\362p\200q]\346\247\337\354o\360Ic\343\364\364\340\215\b\001Ce\376\256\371YB\004y\347 \203\225lM\247}U\225\207\032\374#Z@\214bh\021\025\202\020]\250\367\353\277\266\305\275S\n="
+	.string	"@"
+	.string	"D"
+	.string	"\377\330E\305H\261k\002p\t\345\233\315c\270o\224\203p\337,\3324n\246\366/S\005\330\271\273]\365p\361T\364?\342\025\3624\236r\024\330]S\362\204\341\256\267=b{\200ME\002\224\335\r\340\273 D\300\244T\337|\022\367-\201\251\334\300\242\225h\3156GZ;\330\237\354\356\272\242\354\267\376J\251\177!"
+	.ascii	"\342\264\021Rc\367B\355\306\306\266\025\037,\266O\355\263.B|"
+	.ascii	"\213\024\253\331\351]\205kVv\216b%;_\267=?Q\031e%\355\237\233"
+	.ascii	"\030a\020XPuP\356\206\301\221\374\325\006}\364\244-\034(\324"
+	.ascii	"\321~\t\t\036\244\335\340\260\360[\346U\200\206\032\231\341#"
+	.ascii	"\316~p\022\243\236\017\203\320g\340bO\023\206\034\021\350\363"
+	.ascii	"\272\020\374\302P'\354B\037\016\250\363\300\260\323d\374\211"
+	.ascii	":`\347\340\373\300\316b\356'[Q>\020\"V\252\023|\027\267\025\374"
+	.ascii	"\305\3464\243\244m8{\301[lF\031%\347,\002  \320\202\2219\333"
+	.ascii	"\263d\021\260\247#\326B\026\350-\315.b\034\035\340\301\037\267"
+	.ascii	"\361\217\266\341\037\250\203II\315\030\rI\305\305\333e\372\206"
+	.ascii	":\234#\020\323<\254\261\325\267\303\021\346$4\275)\033l3O\201"
+	.ascii	"\275\274h!\031"
+	.text
+	.section	.gnu.lto_compassPreInit.49.83930f0898555423,"e",@progbits
+	.string	"(\265/\375 \302%\005"
+	.string	"\262I#*\200k:\300T\024(D\200\r\202hP\007\214\354\325\002\340\377~0{Oo\353\"Z3\204\251\300\267z\006aB\032\305\275e\n\256\246Z\251\354\232\225\254tV\314\252\022SP\227\254h\225\323\3003\263\250\\\314I\245\364}\243W`\304\206\375m0F\354\005\374\277\243g\303H\303!`\376G\b\364M C\261\275\2225\333\263\337\344k\3518.\237\3772JV[\250y\267\262\002\256\333\026F\210\377\206\\\007Y\307\265m\260}\260\235\b\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_compassDetect.50.83930f0898555423,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\215\007"
+	.string	"\242N56Po\322\001 n\013\002\343z|\np\003:C\364\016\236\322\344\372\273\371\310\"\310\205\263\351\265\315\364\201M\b\252\212\210\002\206\3162\2413\032\353\334[F\273\355\235R\037L^\230Dg\242\n\240\220\021\317\026\207\322\312sM+\322lRL\322\210u\252+Z\031\215\234\002O\217\314\342g\316,n\352~\243\f.\036\206]A\356y\330\317\354\356\372\215lw\016\323\351\005\002e7\024\003\263,P\205d\373\2665{c\373\325\n\227\005\347\354\223\274\244\275\304\342\002\273\243\222i\267*8As\350z\002\352P\363\001\352\320\266\031\0324o\257 \241\207\2202NN\2735\276\217ow\233\177\223\037\214\254t\264\244\210@w"
+	.string	"\017\273k\247!\332\270\337m#\330v\260-\022\n"
+	.ascii	"2\003\202\341\243\302f\025P\270\f\b\n\301e`$\001*\314\353\232"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_compassInit.51.83930f0898555423,"e",@progbits
+	.string	"(\265/\375 \301M\005"
+	.string	"\262I$-pU\323\001"
+	.string	"\355WE\035|\327|\272\277[\236\372uX\314\214\310\356\036\272\252\267\242Q\352\277\027\253\345\246\263\370\372\021\306\267\177o\231\002\247\2449'\314\212\024O\031\347UM\276\032\223\305\224\234,\031\036\261J\362#F\311Q\215,\035<\250\375U{\360\362o\240\273\373\320\362\277\255t\027bx\272\267"
+	.string	"\200\006\t>\233\377\331\037=\241\310N\267f\266\325t$\234\256\2732\304,\335G\277\005\016\262\217\260\350\356\277\tG\331\303\375\177\370\217\370\357\b\b"
+	.ascii	"2\003\202a\243\302b\025N]\363\210\020$\334\271\333\026'"
+	.text
+	.section	.gnu.lto_compassIsHealthy.52.83930f0898555423,"e",@progbits
+	.string	"(\265/\375`e\001\215\f"
+	.string	"\366\226P?0m\224\016\2532A\252\331iY,\016P\254\350X\211\246h\0042\241\226\013-N\224 \307\f\366\223]\030\214\221\326\230o\365#\005\226\204**\177\275\326\235\351|uQ\232\321d\357-eJ\001?"
+	.string	";"
+	.string	"A"
+	.string	"\32762^\301t\361\221bW\213J\341\241\303\3474C>uy(6\022\244\f;\224\360\007!]$\263H\r\220=p\223\335=\206'F6\312\244.\273\353$e\021n\352\266;\266)\3669\002\276\205?;\370\344I\177\376\007\376]%&BDy\2625,U\303\276[-\331NCM\273Lk\2463\323\247\004\230D,"
+	.string	"\261\233qR\261!^\310\005\333 ;\342\003\b@\016\005OK\372\r\367\340\355 \035<\367\340p\177\200\177\252\007\321\273\324\234`\340\037\336\242\207\247\322\221\032\237\273\213\351V\340\252#:NX\244\251r\315\233\244\304\356*\260\253k\360\f\330\330\335\004\031\316q\005\316X\256\013\323\331T\231xY\325\305\321\\\221\303"
+	.ascii	"\263\211\031\353\212\026\002\256:\032+6\250*+F\264\275[-9\037"
+	.ascii	"\345\351*w\212a\033\352D\244#;\205\372\213\025\242<\001\200\252"
+	.ascii	"\001U\333\305\002! \320\002\031\n\356\034\0132\364\036\244\360"
+	.ascii	"^,\"`9&\034\217@%o\260r\267f]\351Y\357\222\324E\031\030\267#"
+	.ascii	"\007\271F\215\025`\307=\033\350\202\321f\020\236\037\276\334"
+	.ascii	"\242TP\344\301\373\230\307I*\006\272Qpz\273V\031"
+	.text
+	.section	.gnu.lto_compassStartCalibration.53.83930f0898555423,"e",@progbits
+	.string	"(\265/\375`\001\002m\021"
+	.string	"\326_pG\360\262&\0350\227l\301\261w\216\362\265\211\f+\3733\372\n|\024f\\\003\265\035+\235\032\342`\2229\2305\310z\205\260(d\353\341\255\351\035\006\201\312D\326NX\366\2026\375\366\2450+(\224M\222H\366\226;\245X"
+	.string	"Y"
+	.string	"a"
+	.string	"\323'\334\347\201\027\330>\345\007l\237\027\231e\343x8\263\337\251m\310\361\261\273\235\216\260^\206\267\214\254O\251\221\345\207\250\330\034\001\215\031\030k}J\001\273+\022\323 S\",\366\212\262Fv}\370\0044 0&{\fQ\331]G0\346\341\336n{e;\305\216+\001*\243>\316U\250|\032{/\323\177\361\001u\270b\315[\264+\\\210\007\257\" >\004\275\264e\207\257\2502\366\277\032c\217~sK\215\326\030\035\037\375"
+	.string	"#%l@\230\355r\250\005\331\240\331C\3427\267\177\302\017-:\212\247`\375\306>\\\253\0037c\001\313\261\273&\0172H$1L\006`\274\347\344\225\224A\035QU\245\017L\r\036\363t3\016\376\342A\211P\213\273\210`\t,\361 \313\366\031UtC\347G\217+\326\354\2236\333\026\276C\032\021\332]\006v\351+L\334\356.\320\371\354D`fwO\363\351\t(\356\251\355\363\341KrtL\354p\305\232\352\356\2664\037\nCI\332\204\362}%\027\225g\352\276\225\367\265\234\276\256\005URu\246\325\327\241\220\330s9\255:\n\236\267\352D\241\353_\215\361m\316\375\324\004\271\3645U\306"
+	.ascii	"\206t\244:\024M.\025\246\340R\317\003g(C\004r\271\273+O.u\244"
+	.ascii	"\017A\003\202\021\361\242\315\37095H]F\353\241\032- `\202Q\252"
+	.ascii	"\316\003#\241\227\022\203A@3\265\213VK`\005K\332\003\331c\321"
+	.ascii	"s\260\007\027\270\004\310\340\356p\274\214\005\2459|c\221b\273"
+	.ascii	"\026Cl\035\267g\200a!z\t\356M\3024g\006\334\333\032\331x\321"
+	.ascii	"\375\274%i\270\234C\276\235\221\002\3559;\301i\345\020\242gF"
+	.ascii	"\343\2067X\331\333\032\360E\271s\211'"
+	.text
+	.section	.gnu.lto_compassIsCalibrationComplete.54.83930f0898555423,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"R\315/4`k\222\016\320\212\260w\237\244`\251j\225t\335\032\0134\2023\317\364\233\331\337Q\213\376\321\327\250\322_\003D\0202\200\206raP\233\340\323i\333\332&2\005W\024\b+\231\313\253\034\264\036\304X\240\303,T.\256\262\240\243\f\3742\026\3131\274g\271I\026\233\243L\002O~\276\032I3\263 \322\247\032\335\320\\\213\0336\255X\251\273\221\224j\006<xZ\351\263NK\211\357\024s\364\267\263\265;\t`\200(x\304\030*\215\304\017\212t\361\367\347\374\344\003\004\316W3\212P+ @\034\"1f.'z\265]\267\031\235H\035!\230\250\323\006\220\020c\274a\"\207\236\375\013~\203?\"\b"
+	.ascii	"2\001#8c\216#D\250@\\\023?\206 \341.\233\332I\006"
+	.text
+	.section	.gnu.lto_compassUpdate.55.83930f0898555423,"e",@progbits
+	.string	"(\265/\375`Y\fu6"
+	.ascii	"\032[\314\023C`\246N\007\003?\244\030\356\361\245\207\217\320"
+	.ascii	"\320\r\252\201Os\020\364a\326\177\024/p;4\323\330y;\207<>-?\215"
+	.ascii	"\272\220\343\205\354\312Q\005\371\317\240\037\007\""
+	.string	"~\240Hi\310hF\233\354-SJ))\001\f\0011\001\377\316\356\316\235ud&\r\207+\367\302x\376\271y\350\034\221\256\322\r\327=\245\237\271\255\034\313\206\267\214\355\256H\234\234\\\027\356&7\225)L\247\212\235\251W\344\330\346\334{\251\032\345\005j\243\017d\346v\346\216\322nkKA\301\277{y\270}\271\267Y\305\004\324F\217mL\033\265]L\033e^\231\343tsy[n\315\254\312\236{\257\325\003!\026\361\267m6[\273\266\221\261\250HD\034\016\t\205\202G\300\240\237\352KQ\373\276r\373\262\236\356\344$\321\304\332hH\033\205Xa\363\242\037im]\264\322\022\330\356\350\360Hkk\";\274\212\303\341D_\326\2174f\017\227=\264\214[s\241Z\013\251\305\345\360`\2171\373(\310\2213\"\016\034r\303\203l\364\317\036\325\234\331\260\307\267v:rV\303U'\237/\213G\032\215N\355"
+	.ascii	"5\273\030B43kL\323\003N\277"
+	.string	"!\035\265\303{\257\020-\205\275r\026hdn\215\304\350o*=\300\f^\022-F\273/\353\336\313\236DKkFj\346V\303\314\r\230\201U\001c\320W\362o\357\035\374\3579UC=\213\252\206\372\316\003\267W\346}\332Z\002\r\365\016\276q\230\301C\252\221\371\223\377\313\260\027\243\223/4\031-\341\262\256\307d\320\260aC\332h'\353\370\377?\035r\316\230?\233\264\230-\005a\374\233J\013\240\253s27\346\317\377{\257\3303\321\273\331`\270\226\226^\372K\007\017\\\\\315\346\342U\344\274w\254\223[\236\201:R\274\0303w\265\026\020\352\275\027\0017\226\316\022\202\273\255Q\026\341\345\235l\224\333+m\264\377\225\3209\2212\346O\346&\231\277\222\271\373\276\017f\007X\013ZJ7\002\324\371\252\2534K5\\sTOi\206z\347\247\324\331)u>\246\316M\357\314\224:/\275\263\322;'Y\347"
+	.ascii	"\357\f\340\235\221\254\363\321;\033Yg\243\352\\\244:\027\255"
+	.ascii	"3\221u&\276\363\320:\017Yg\241u\026z\347\240u\006Z\347 \353\374"
+	.ascii	"{g\325:\373|\316i\352\214\242\316\326:\007y\367\336\340+\271"
+	.ascii	"\373\350}\b\201 \237\215\"-z084\305G\360E\177\302\256\r\262\b"
+	.ascii	"\031\020EZt\032^\003E\217U\251L\033-\376\353\351\005\021\375"
+	.ascii	"\f\0311\210?\364D\303'\246\241\235\r\235\205\277p\341-\274\231"
+	.ascii	".mt\350\32155\204\277\302U\270\231\320\003_\030|\241\024^\346"
+	.ascii	"d\301*\027\363\373\004>\212Wf.\350\001\375\361\363{\337\007}"
+	.ascii	"#\213\250\377{\007\204\234\303gkj\271\002\351=+S\315\323zV\266"
+	.ascii	"\250U\310JD\355\325H\332\250\372S\314\271;v\264\204\313:\276"
+	.ascii	"G\225\3409\231\033k\336{\177\257\344^\221\244\351\177\200\333"
+	.ascii	"\3538-gE\302\335\306\253\222\225\211wre\2226\232\376\313\270"
+	.ascii	"\343CC\205r\364\273\331p\336hI\355\255PV\267\343\325\243\177"
+	.ascii	"F\316,P?\333Dj\377\352\331\315h\220\371\223\305\2705Y\372\216"
+	.ascii	"\336\315f\363 \350\204\320z\021\0168\327\250\221\240\246\321"
+	.ascii	"\212r\346\361\004\n\336I\016\326\341\345\245x1**W\310\244\257"
+	.ascii	"\344_[H\355\177\200sS\346}\230\271B\333YP\317\330\357\267\206"
+	.ascii	"\302\023a!Nx\260a\031\272\274B`(1\242\013\f\314\004\227\020s"
+	.ascii	"\025\b\013\363@\302\353\213\313*\f\354+lDW\230\325\210\020\036"
+	.ascii	"\274\254\270\300\302\254\n,\361\027\211.0\253\022__`V\300\346"
+	.ascii	"X\277\017\326p&o\354\311\330\310\2003\2577\326\034\376\326\375"
+	.ascii	"b\f]\036\331\213\031\213"
+	.string	"\013\036\335#\242j)\251\367%E\257\224\372\005z\220jO/e\213\311\351n\036eeSZ:\375\323[=\263@\236\354\343;}\222\036\362I\323/\375\361\221\252 \325\230\276\351\311V\3279Y\231-\246\t\323w\035sN\351\227\276\315\002%\361%[\f\234JV&\002g\022\245o+m%C\316\027_i\243\217\274\265\2242\316\236;D\257d\340\336\020\353\321\275#\252\216\212z_\322\304\250\307\372\216b\247\307\207IE\210\fYK\0323\024\340\016\300\007hc\013\262\266\032\001\360CJ8B\244_nM9\201\254L)\347\017\343#}GAs\005ywu\357\025z\345\321\033\277\217\300\331\031\375\321[<\3109>\266\260z\254\314\004\276\303y\254l\274c5\302F\217\265.\3615\366\322\244\246\245\224\303\370\035\327Sx\332\360\t\200\366\250a8\005\231B\246Fd$IRIc\300\002\021\231*\326\001\021"
+	.string	")4\314!2MRi\f3x\205\300\216\r\275\311_\232#\206!}"
+	.string	"p\264\277\034~*M\316I\300D\333{^\017|\\\fq\0231%\214\\\217f\254\327(]85\265\204\376@\223\b\204\3657\254\031\350\311"
+	.string	"\023\033zL\034F\007w\210$8P\220!\020\354\206\266\355bK\\\017\3246\025\252\322\f\267\251\224\005m\215:\220\257\tx\342\352\004Vt"
+	.string	"?\007p\250\003<\3513\260\261\266[\344\340X\362(z"
+	.string	"\001\r\362\372\223\267\230;\200'\031\337\265\270/C%?\362\026!AS\0309\320\213$\254(\303\366)\332\246Vb\205'p~\373\246f\242\312\342"
+	.string	"Y\312~\250\245\006\017D<\323-\230s\251\274\341F\2662\333E@T0G2\251>\005\334\276\367\363\002n\314\274(\367ah`\323\006C %\240u\204\343F\226\254\240\022\244\003\00128\254:x\001<\f'/\t\346-\352T~1\321+\\\326\274$\013\017\342\356\035\365F\240G\247\270\244\332\027\212z\260\361u\340%p\300\302Ww\001\020&p\231\233\017vU\013' i\320\025e\332\242\030J\236\202Q\234\241#\305]6\211a\212\240\264IFc\003L\374\243qN\262&|Gy:\200\002GK\300#\203\027\301?G\027t\257\205u\345\250\211\254E_D\336\225\340\213\rz%H\240\217H\"K6\330d\251\261~\013\006\025\273:\335\267\202\224\f"
+	.ascii	"\226\314r\267W#\205\003\2634+\206;-\302\037@Q\331\330\305cs\026"
+	.ascii	"a\311]\320r\031\241\357\201\034gp\217\f\030M'X\316\317\225\323"
+	.ascii	"+\375\365\272\323-*"
+	.text
+	.section	.gnu.lto_.symbol_nodes.83930f0898555423,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\345\007"
+	.string	"t\013\353\001"
+	.string	""
+	.string	""
+	.string	"\002.\177\032\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\0021\177\033\2002\177\0343\177\0354\177\036\005)\020\201\2045\177\037\001\200\005% \200\003\005*!\005&\"'#\200\003\0026\177$\2007\177%\001\005(\023/\0250&\005-'\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005+(\0018\177)\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\001:\177*=\177+<\177,;\177-\003"
+	.string	"\022d\003\006\023\001\001$\003\f\026\330\307\302+\001\344\006\003\f\025\250\270\275\324"
+	.string	"\001\304\007\003\f\024\200\200\200 \001\304\037\004\f\200\200\200\200\001\001U"
+	.string	"\036"
+	.string	"\255@\344f\030\240\036"
+	.string	"\034"
+	.ascii	"\034|\300\267P\301p\3711\325\300`4\310\315\t\231\003-\200\035"
+	.ascii	"\030.\320\210\006l\324t\243)$D\031\201v@\031\230#\230\366\001"
+	.ascii	"\332\201\317\201\357\300 \200\f\227\235c"
+	.text
+	.section	.gnu.lto_.refs.83930f0898555423,"e",@progbits
+	.string	"(\265/\375 \255\335\003"
+	.string	"\222\312\034!\200EI\00730\00330\003}-\242R:\212\f|\304\341\255o\250\225\374F\b!M6\262e\n\177\317\251\033\240\005\024\017`\017\260~\222\270\204\361\b{\310\342\217\365\216~#=\243\\\241>\321G\224\037\324\033\372\205r\202\372\247\3578\337\364f\332\315\364^\355[\216\232\277\346\276v\263-X\3144\303\023\343\313\342\212\342\227\270\364\366Q\237]A\377@\001"
+	.ascii	"F0\307"
+	.text
+	.section	.gnu.lto_.decls.83930f0898555423,"e",@progbits
+	.string	"(\265/\375`\f'\265\263"
+	.ascii	"\212#)@X0\nIJ\035\334\026Ug\370L\317T\315\274\345\377xct\026"
+	.ascii	"x\022\314\030~3+\213\030|\373w=<\311\311\372\226\252\301\333"
+	.ascii	"\b\277\215\231\300\302x\247[\206\301k\360\3060T\324\343\224\226"
+	.ascii	"\335\266\225\214\316\202L\022&\244Z\327\025XlS<\347\277\324\311"
+	.ascii	"6\2222\245\024\200\003\363\003\375\003v\213\224)\260\277L\356"
+	.ascii	"\374\246\217q\277\351a\374\222?\235w\013\016J\023\004H\223\221"
+	.ascii	"{\373.\375R\367'\275R\257\375\313U\251\021\375\333\367\b\367"
+	.ascii	"\323-\2443\216\203\364\"f\016\252\366\367]\344X\031hjO\274\340"
+	.ascii	"\316\240\212\024\266\273;<*ng\207\025E\n\236\002\362\334.\212"
+	.ascii	"\212_\361\311'\341Y|\213/\341\213\376\350\215\334\371J\267\322"
+	.ascii	"~\305\2610\241x\235?\2358\350\242\002\375z\245\007\361\271,["
+	.ascii	"<L\351Y\036\271\204\013\224I\023\257\253\2619\327\210b\345\314"
+	.ascii	"l?\363\220\301+\035\352v5Gf~\261\301\224\032_\24293sv\356\033"
+	.ascii	"\025$E&\270\177\264`qqYix\317\277\270\363\263oi\327\253A\336"
+	.ascii	"\344|\205\367\331\307<\352\317\033\267+J\252ee-)\275zvX9\347"
+	.ascii	".\356\305\271\270\323\365\222zwz5HfF\0321eF\215\235\234\235\235"
+	.ascii	"b\030U\027|\333\306\300\355\321n\027sf2\347L\201O\311-H\333_"
+	.ascii	"7\343i\327b\331\336V\350\375m{\304\216\345\026\322\t\276\n\356"
+	.ascii	"o\202\373\337p\277\031\356\367\30299\246\320|\001\362\245\213"
+	.ascii	"\024\356_\302:\257\304\356\304\237\2703\203\323\265\207\f\332"
+	.ascii	"\036\307\362W\316L\233\313\024G\245\343o\177\306\355\031R\337"
+	.ascii	"\363\fi\273\025\254\201[H\237\027f\314V,\273\342\342|\211;]\316"
+	.ascii	"\325\306<\255\013\016*\347k\256\304\2377<\370\242\004\232s\276"
+	.ascii	"\260\263s}`\021\303\222^\270\031\026Q\260\277\355)`$>\002?\342"
+	.ascii	"o\356\364$\356\326\317\314\331\3114\262v\326\226\346lD\034\255"
+	.ascii	"\006&\347\245\032V\316\271\025\320\315\323\236\304\2138\032\006"
+	.ascii	"\0259/i\340 \351\314\254Ds\3169;;;;6FQ5\252\310\334\366$\356"
+	.ascii	"\037\334B\334\033\300\235\001\254\301-\244=\0027\007\270=\315"
+	.ascii	"\321|\231)\250\201!\204\313\204\277.\304\207\270\363\202\227"
+	.ascii	"\265\233\371Y\303 \231\231\351y7\212\222\376\336\270\205\364"
+	.ascii	"1\300\0230\311\031t\r\016A\316{{~!\365\024x\332\2338)\222\023"
+	.ascii	"3\333p\220c\252\353\257\225\301\375\370\002\267\220\246\216\223"
+	.ascii	"\3368N\352\345_\031\254\262\3052;sfV\260a2\035M\375m\246[H\261"
+	.ascii	"\343\244\335\316\343\001x\335o\201\003\272_\001\335\337\301s"
+	.ascii	"\320\200nw\321\355\035\270\001\272[\013\214nOv\373\214\306\340"
+	.ascii	"\r8@c\320m\255\322n\013u\326\335q\335\215\366\033t\177\001\030"
+	.ascii	"\320\033:\247\333\032\275\006\335M\"\246\333\252\370n{$@w\337"
+	.ascii	"n\013\202\366n\353\323\355\266\333\323\356\246\353\366\230n\377"
+	.ascii	"u\273L\267\177\267\317t\177\005\013\350\366\333\355\336\355\270"
+	.ascii	"\273\247\374\007\234n\033\354~_\367\377\272_\246\373q\367\337"
+	.ascii	"\356O\273?"
+	.string	"\246\373i\234J\367{\367\377g\320\3357\3357C\367c\320\375\b\350\376\r\335o\200\356\037@\367\337t\377[\267\027\351\366\265nO\353\366\263n/\353v\262nov\373X\2673\273\035\254\333\265\272\035\253\273\237\335\rB\267Gu{M\267[u\373R\267Su\373\207n\267\320\355R\335\216\323\355P\335N\243\333\237\272]F\267;u{S\2673u\373\206n\017@\267_\350\366\234n\247\240\273?\350v\233\356\376\352n\016\335\r\327\3352{{{{\335VC\267\257\246;\203Z7J\254\243\243\234\235r\216\362\323\221\310\212\234\337)\205-I\331\224Z\362\020\031\322\304\312$0\217\256l\261\314X\031J\024\022n\036\203\344\026V0V\022\214\274\277Nk\345Q\235\234\2254x\021A\262\240\361\025\252v\247\245\262O1\312\333c\017\372vO\234\234\356l\264;\255\r+\225\303\314G\fY\307\252\260hFr\262"
+	.string	"'i\261ue\243|/\334h@\225\341\306Bt,TL\222\231\2333H&\265\271\257\032a5/\272\366\212\320x\362)\035\275<\355\f\031,\262\251\031\177\033k\341nk\302\027L\nI\272\2202<Z\244q$\352t\301\367\203\bTU\323\323\023Y\206d\225l\f\373\302&Y\030v\311\272p\247e\372\032m[\330#\313\364X\377#\357\214\307\026Y\025W\304\240\177\305\"\2278\375\3132\375\t^\327\205\006\r\362V0\024)o[\031\364qt\377\225e\372\034i\217\202ez \037v\304\214\311\256\260%`(R\346K6\027\325\305\22533\246\nl\306\021"
+	.ascii	"\334\364\3518\251e\301\303K\263*j\215\254R\246\rJ^\235%\241\255"
+	.ascii	"\322b\311\261iY\316,\301*\301\n\266\311\252\032\034:\216\330"
+	.ascii	"X\202\333\207\004Gs,Y\022\310\333\354N{|,N{\374,\277W\306\326"
+	.ascii	"Eo&\033m!r\367\276\270p\001U\376}/1J\226b \271\352\342\316\327"
+	.ascii	"k<\035\033ZJ\177\033\313sy\253'T\270p\351\337\202\224\311d\374"
+	.ascii	"\215\372\360\222\230\2149iy,o\003\351$\351o\373b\340\366\025"
+	.ascii	"\341N\277\344\375\024\260\246!y\230\312C\335\371U\236\254_\354"
+	.ascii	"\231\235\303\254\362)\374\220$_\024h\225w\376\235?\235nr\022"
+	.ascii	"\317\013\324\207\274}\311K\357\222\227\362v?\345\361\334\371"
+	.ascii	"w\375w_\366m5\307\n9W\351a\335}\221W\242\224R\311yO\027vv~-\250"
+	.ascii	"h\034\361\205\362Q\334\371R\276\216\311\323\371\323\211\231\225"
+	.ascii	"j\316\226yOQ)/\367s\030\212\224\036\270M\201\342\"Wn8\350\350"
+	.ascii	"\236\320\030\255i\3255y'21\234\236nIpw\223v\027Y*\340\210\340"
+	.ascii	"v"
+	.string	"g\337\375\263\361r(a\002C\303\235\n\301\235\006\301\257\344\335\036\211?\235!\226\340\301}\234;_\311'\271lJ\336\314\355\222P\201\346\354\324\354\320\362\002Ko\247>\360\375\221$\213\373\373F\376\315\235\177\344G\220ih\360h\030\351\361\267\323\034\030\205\257\215\244\235N\341N\227lO\304\235\337\366k\355a?\3269\314\234\321\332\376\354\3250\024)E\324\340\002\375j{\263\337\016\254\274\247\234\235\035\337T\233\330Uz\033\006\213Z\232\fe\232\036\023f\004NNP@{\262\237\024\026\031\017\0177\f\035n\2308\3340n\270a\234\270\371Bl\310\242\302\270\302\2320[\3303\314\016\3549\216\223>\2307\311\302\305\350o\303,\361w\275\227;\377\253\373\271\234\255\357\33027sf\322X$S\334\232Nj\343:i\303\300\300\327q\322\255\034\357\241B\254\307\036\356\341\316\367\361Y>\236\307k\325$\231\371\310"
+	.ascii	"\244:'.\237\001W$w\257V\367\353\370\035\277\024\303\026E\311"
+	.ascii	"\007\023\334W\r\367\025\303\277t\013i\001\034'\275\340f\341\276"
+	.ascii	"8p\263\261\271\205\033V\036\025\345\312\310_\253\257\372\031"
+	.ascii	"\271\021d\311F\177\325\324L\316_9g\f4K&[d\177\177\352_\352\251"
+	.ascii	"\372\247>j&\371S7g\244{\0055\356\025\300\030A\001\231Bz\373J"
+	.ascii	"\341\247\361K\245!O\345\022\n31*K\373\353|\250\257\321\235s\246"
+	.ascii	"9\213\213j1\0017\226\177\212\251\362D\356\306\023\332\245\312"
+	.ascii	"R\363\232\361L.\222ML\230"
+	.ascii	"\223\221\201\324d%C\207f\013]\021\327;5\005m\304\251.juM\260"
+	.ascii	"K\244\232\024\375\275M\327\311\235\rwe4\323\246\246\215\2042"
+	.ascii	"\270!\270E\340\r\227\336\245\2761\332jPE\205\301\350\216\361"
+	.ascii	"\231\321\315\300\002\202{\206\007\356\276H\027\351_\350\334\344"
+	.ascii	",%\3076\363\245nG\026(\334\016\304\355\221\266R\334i\217\\\027"
+	.ascii	"<E\031\tDC\226\215'\013\354\215\344\334\327\337{\304D\326\321"
+	.ascii	"!\371\3333J\270\375\013\317B\303\354l\225)Q\313eK\356\315,\225"
+	.ascii	"/)\366n\205\325\273EjQ\350]a\265\270\035\024\345mqK\270FW\305"
+	.ascii	"%\341\262p\347]a\273\264\235b\355\356\n\233g\263\370\363\006"
+	.ascii	"\004\276\242@m\256x\2215\335\\\213\327wax\310\233t\347-r\336"
+	.ascii	"\242\317r\217\277\264*bz\321\013;4yN\240\314Ho\367=\336\214\306"
+	.ascii	"\264\262\362\327\356\371\234\232\340T\344yq\247\375\202\261p"
+	.ascii	"\021\351\322w\277\021\\I\331\341\376\311m\301O\2404\226 \301"
+	.ascii	"\3753\202\373\247\206\255\025{\305\235\033,\226\317\341\245,"
+	.ascii	"\005!\270}Cj\367\366|C\332?&\356\237\027\324R\201i&\271\262\304"
+	.ascii	"R\261k\022\327\242\350\007\326\240\3438\251\245\263Pl\224\356"
+	.ascii	"\030\233.\266\252\263\035\270m\035\bWrg\177\257u\322\366\t\334"
+	.ascii	"\016\254\243+\334\226\211m\322\035S\003EGY\220\277\375\213\302"
+	.ascii	"m\347`\316\366\256\310\370k\237x\305oi\203\f\r5(\373\354\266"
+	.ascii	"I,\234\225\343\300\007\366\274h\371k\343\354\222\266rVI\266r"
+	.ascii	"\030,sFZ9\033\275\234\2216\356\025\270Wp\273\244v\230\245\267"
+	.ascii	"\177/pCq\013)\215\343\244\237\304\323\026\311o\311\033T,\212"
+	.ascii	"\333\272\271}s\247}s\273\234|\314\323\3405\007\305\355nG\204"
+	.ascii	"\210-r\006\005\245\361\341\206B\230mk[\244\346\313\bt\313\022"
+	.ascii	"h\344*\312dmM\313FUX4fk\r\357IHZ\232\317y\205\234\247\274`m\235"
+	.ascii	"9\355\231\317Y\245\007zzP\031\253\262v\247-\373\027\036\2251"
+	.ascii	"\235\024\213\333\366&\204\355o\313(\341\266B\334\222\271\323"
+	.ascii	"\222\331\345e\346$\231\035YL\013Z\346\b\267\333e\332lZ-w\352"
+	.ascii	"\240l\017Z\343\305\204sb\031\033\263L\017\034\312FU\030\227O"
+	.ascii	"\311bI\211\02311\313t\031XF\234\026\020f\226\226T\213#>|X0|\264"
+	.ascii	"\020\243JUXT\315\312W\276\332\202\301m\021\022\367\327\002\261"
+	.ascii	"^\bPK2\362\262]\251\030\222\255$PvF\f\tVQK\226\253\0037\274\024"
+	.ascii	"q\375\360\202\004K\355\301\272[J\220,q\177\355\326\257\351\205"
+	.ascii	"\324b\306\203\207\325\352\340X\025\306\225\235\236tbl(mu5\226"
+	.ascii	"\266Z0Lz\3500\363\302mq\330\253\2669:\207\305\3029\347\234\254"
+	.ascii	" NN:\330\212\211E\213\035m\261l\314\256\264-\261:\276\307\025"
+	.ascii	"\027<\253\303\242\260\003\315\231|\027NhEc\177\355\tne\006\357"
+	.ascii	"\331\204\367\267c\244p\232\221H9g%\030fF*\232I\035\306]\247\233"
+	.ascii	"\306\255\017 \347\356\235\r\344\2144r\343\n\326ZC\316\320\220"
+	.ascii	"\033\346\231s2\352\b\201\250\244dT\223\262\031\225\217I\035\307"
+	.ascii	"\nH9\352\250l\346\\!'\223\307"
+	.string	"\020\313\\A\331\314IY\005\223$\317\314\250cN.s\205\234\314H\r\312dT\222\262\211L\252\240lF%\345fT\276\311I$\222Q2#U\310\315\250*\271\271L\272Q6\227I\312f\324\225\2630\272\332Rr\273A\005\345s\312dvq\364\204D\272y*\231\313\f%gw\256\310H\003\310\371i\211\004\005\331\344lEO\027Eh\310\2453\217\212\244\2269\371T\366X\346\334\243\350'\037apd>3\016\177\036\247\236r\213\0259\007\340(\347\243\347g\316\371\230s\366!=1s6!(\206\3055\370\201\004=\305\240P\211\002\214\b\0161 \302\004\375\303A(\200\024&\206\253\020\b=\304\b\250'\202F\234\376\341`\024*\n\207A)qX\\\215\035\324\036\" !q\330\241h$\3520\001\020\020\021\221(D\364\255\300t\004\241\342\317*D\364\231\b\252@wU\215AjP\232bH\b\004"
+	.ascii	"\326\376\341\3403\324\301"
+	.string	"g\bGH$\372\025a\214\300\231\025H\364\031\202!\372\f\331\237\325\207\250\002\245X\375\300\320xS\f\t\toq\035\262=\252\257G5\022]\241j\364u\021\3503\304\201\246\030\374\021\336\024\305\3258\364QGL\240\256\301\236\241\013\0301\240\b\022\207\037\f\005\251$\202\324\325\230B\004\240\004\027\304Z\f\256\"P\220\342g\005\n\252\036\030E\334\374V\241\272\252!h\324b\b5@\"\005V\325\250\216\360\031\242\240\205\303\242JT}pc\360!\001\0374@\341k\r6\270`\203\013\322\326`\003\036\236\r>\360\340\376\300cG\b\216\2109\241\206h\241O0\310\256@\343\005\324\240\341\212\327\376Y\207D\021\353\2208\274\3055\004!\221\210\002=Au\204O\360\003\tz\202j\361\366\017\207\242\n\324C\fz\200\263\022M\274\021(TGx@\030,\001\004\024\004Qa\270\242P\357j\004\016\207D0\241\206"
+	.string	"\212\bA\204\237*$\006W#q\210W\240\005D\\\3420\004\242Q\230\016\207\214\326\b\004\341A\304\017\204\007\0211\251\320\303\320\022\225\350`,\252'\206\305\236\013F\340\0077Eu5\006\203R\237z\"\b$\002\321P\020&\002b#0\204\221\250\304O\005\252C)H\030\211J\304\370N\250=F\242\022\251\n\254Y\177\326`P"
+	.string	"\202\334\b\004\016\231\300A1,\256\301\017V\241b\215O\220\304pE1\201\225(\2028\fV"
+	.string	"HHH\002@\030#\360\204\032\302'\030\204\2150 BD\300'\030\224\256\375\223a\355\037\016BAABB\003\020\001+D Hh5\022\tq\214@\237\241\t\242\020\b\233\225\250\006\021}\206@A\032\265\030\034\241\247\030\374\231Q\207R\254F\242\0225F\243Z\354\351\t\002\205\036\2066+P\203\2258$\362\251\302\341\t\265\247\206h\024\002\207CF\240O0\350\267\002}\202$\204\206>\237 \211u\210\250XTW\342pf5\241\366\\\350\037\016\031ZhH-vX\205\204\212\035~=\352\252\002\r\005\t\201 \n\r\327`\261\304\020((\224\300("
+	.string	"  \241\342\375\021\256\303!\230\021\202)\254Q%\002\n\236H\211\200\306\240a\221\204Q8\f\n\022S\204X\177|\206@&,\254\300\017<+q\350k\036\036\020\032."
+	.string	"B\005\260\220\203\321\030\034\n\022\022v0\026\205\214D\325\330\2018\f\006u\020\026\215\0358`\030!X\264BEU\003>\301 \037\323j\3352\0317\244\304\356\t4zn\\\256\204\375\370\260\256/&\330/\371\302\216d(\277n\017\037C\272r\363\262\313\237\2221\275\267\256K\345P\246\200\224"
+	.ascii	"\304J\331-3\260<\256\033U\363\024\333\303\361\003\231\226\335"
+	.ascii	"\275H\273[X,\232?N\370\253\243u\334\036m\223\271\006\032VL\025"
+	.ascii	"\036\nnZ}{\374|X!\302\374{y\264Z\334\333\227\0327\313\027\205"
+	.ascii	"\233\261u\263.\326\335\223\313\307\326\333\032\226(w\307g\335"
+	.ascii	"f\227Y\035\027\0348\356\t9K\033\205\b^\022\256\2315%dLn\216\276"
+	.ascii	"'\270\226\035\r*\177\357U\253\351\031\305\261\271\235T\026\273"
+	.ascii	"0++\253\225\243\025d"
+	.string	"\312\322\365\252;Z\373\3334.\246\272\247.\225\217\345\027)\331\\\335[4g'\035\334\244\005\304\350R-\257\335\333\236\236\035n\245\276LW\351FY\272\231|\034\313/|kH\350\222D\263\322I\347\027\244\204 sO\243oT_\033\0362\350;\256-:\344\337\273\354\013\345\024\327\006\255q\241\272cd\264\250\232?\322p'"
+	.string	"\2171%%\375\275O}w\327\242\312\337;#\203'\250R\301<G\022\2352H\241\031\221\031I\222tr\n\020\004\303Y\034\210->\022\340$A\316\"\310\f\215\210$)H\322\030_\243a\002\226\217\350le!\021v6{\211@\241\202\030\217,\013\334bu\223\2600\256\002T\207\034%\316\034D\306\312\236F\326^)[J\216\274\246\370Q\252,\301\2262\341%h;\202\340\027M\n|\270\\8\225rsCw3\027@\351\n\253\333\202\t\245\264\274\327,\332\002\326$ \233"
+	.string	"\352?\032\353\307\022B\317\361Z\261\345<\263\204S\343rL\202\317\251\256q\300\343\300\251\025\210+kj\311\036\247\201`\304\354\270\020\024Sg\355\024\270\213\214q\200\312\231\r\343s\024\241\025!*\350\003\221\207|1\251\222\220\223\024\244\364q\020\250Z\264a{_\204hd{\273F\271j \3627\200\316\022\355\370\035\177\300+\330\232\027\273\364D\253L\305\347\026\030\374\321d\251g\253l\033\337\270\251\243\026\252\300\260\203*p\311\216?\201gSB\271\237\035\\"
+	.string	"(\025\362\254W%\246}\257+\220\302\021XP\"\260(\246i%\325\200\235\227\213\310Y\363\365T\032\361\037av\213\023\"\362V4i\372!\227P\307'P\\\354\355\220\300\242]\276\373\37290X\023\020eoMso\210\355\270\200v\336\304\013>y\027\006\200\215\235A\006\336a\201\321"
+	.string	"\227\0324\3157\231t\201\351\341'}Qv\365~iV\260T\315\2351\027\311\036%\"\336\337\327\216?r\240\301\006-\301&"
+	.string	"\024\271U\273Q\235\351\345\345\237\2604$\016&\310\021\371$_S\246\204\235\020\370"
+	.string	"\202\325\240W@Y\264Fs\021O\262\334\364V1!\306p\336Q\336\r\rb\274\360'\327'O\204\312\212\007\370%\266\213\312\231\304p\235\371gL\254\321]\2374\371\223H\374\036\366\247!\343\360\315\211s\022\332\203\013\351r#\\\021V}\234\216\314)}\035\236^\262\346\307F\206\200!|\351l\017\325\013\214l\020\244R\360C\311\366\032\326\251u\341\302\025\210\262`\237T\3745\247\242nL\317\267?\3320\177J\352\3375Oc\002U\343\360Zby:"
+	.ascii	"X\257\260\332\253S}\002\205\350\027\363\273\203#P\b\006\335b"
+	.ascii	"\005\027\312\016>t\274g\234\276"
+	.string	"\370\207!\225:JD\005\245x\346\234(h\251#\347N\300\025\257\250\274]\207\252\357 \013\335\321\235I\202&\364\032\001\242\346\211\374De\314\361\237\3367\205\235d\253\350\273\320|\241\316a\261K\"e%\367\207\371\2459\261\0057\222\031\250\310S\323-\024\336\320XZm\337\245')\205\314\333\343\276\357b\301\201\366\214 \275\244!G\340c\034\306$\376\261\025\230\363E\270T7\253\306W\025@\236\301\212\210}\267\r5\036\207\316\032lY\205VD\205r\267\2214$y\334\263\031\352C\f)\nHX\313\370\005&H\375\342\307%c\3460r\336M\025\235\003\372i\331\004\244\371\363\371:\360\b\260\300)I\203\211\264\331v_\026\\\311$\313\035\330\3569\257\2264W\276\026h\237\264\0272\007\231\204Fs\231\030ht\372\343\245\244\210!\257g$b\273U\030\226\310\341\253\224M\243!/\206L|_?w\361"
+	.string	"\013X\033\340\233d\243\310\241\020a\267\313\356w\220\315*4\367\"\262G9h\270\227\240\302|\0342\277\3073\247g\217\225\254\022B\356\027\223O\331\225\017\362\373!H\324\252\n\037\302\250?V\367\342.P\202\343\265\250\222,\207\214\004\252"
+	.string	"\"h\215\273\334\213\020\r\001\025\344gG\354j\241\375E\202\333D\"\343l\204\251\215\313\3365\244o\032;\213T\356ZU\004=\302\214\252+9\210+\376\210\3527B\237\326\336+:\340\376\211\211<\213\017_\026?l-bMl\333J\267\220\361,d"
+	.string	".\261\263\226\225\342\310\202\031@\266\rb\220\211H"
+	.string	"\254\217\205\252+IO\241\265\030\2060@\341%lc\313\335\003\263\344\352\233H\032\337:<\214{\323G\341\321\016\300K\237\370\201>_\206(\222\\\241P@\334\001[\313\335\310\322\250\031\237\021\220\352[\275\253\032\200\200\367\t\200\002h0\212\032\312\323\243\230\220\227\267_e\313t\222\f\240\333A\f\211P\251\r\b/vH6j\001\362\003\035\247\31137\244L\330\351@W\242\264\336I\314\225\241r\261#\026\212\242\240\372^m\033\213E\3626U\300\250\020\213 7M<\330\024\247\021(G\221E(o\360s\220\256\302T4\256\366\243i$A\202u\315O\376\033\005R\376\357\345Ye\371\257~N"
+	.ascii	"\354\216\376R\301\377\371\233\270>\3121B\2321\237\233\036u@\354"
+	.ascii	"I\333b"
+	.string	"\270\240H\326\241\216\214\226\0169\200g\037\016\224b\355\032\220\260@[l\341,\270\311\020\321\017|aB\222f\332\376\256\204`8\3767J\017!\025\330\252\322m\202Z\255\337\267\301\345\216\250\354\313vJ\035\327\213,\240\200\320Y\210G8\2253\206\022\263m\032t\337\315\370\366\334q\220\\\037\034\275\006\201\271\244`\216\365\364\310\025\020]\310`t@\226\350\242E,\254v8/\226\3214\252\3109\260\325\026\370\377\321]=\314\367YD\207?\265\230\374U\276T\020_p;\245zx\265\035\344p6U\354\t\370Wa\331\004\232\265\030\347\033\017\236\224\"\272+}\266\303\006U\036w\225+$\266^#\266S\274\270\374\366a\212~@\rWK\266\251\031b8\202\005\233z$Bc\316\203\003\362\343\205\366E\310k\360\367\220\266\300\236N\023\b\251\311 \304\tE\212\221DY(\342_\016G\314W\3060\352Mg\271"
+	.string	"\377\350cq\206"
+	.ascii	"\374\017\\o0\231\303\245\177\225\375\244\367\242(]\001\216\340"
+	.ascii	"\277\247\265\341\017\2210i\017\371Z\325\230\275\266\333\366\355"
+	.ascii	"\336T\372\222p\b0\332\037i\023\013\277\005\323\350\352\313~\235"
+	.ascii	"\255\374\232h\036\204C\206o\3569\313\223\301\316|;\226\037\266"
+	.ascii	"\017\336D(\033\352\241\274\370s\031\315\003\364E\217?\372\256"
+	.ascii	"\017:\002\331>\266ZM\351E?#\\;\236\300V"
+	.text
+	.section	.gnu.lto_.symtab.83930f0898555423,"e",@progbits
+	.string	"pgResetFn_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"mag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"compassIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"compassConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.83930f0898555423,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,897 @@
+	.file	"current.c"
+	.section	.gnu.lto_.profile.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\235\006"
+	.string	"d\tB\001"
+	.string	"\026"
+	.string	"\326\214\251\333\n\n\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\240\342\234\212\n\002\246\201\307\205\t\006\002\003\267\235\363\261\017\002\002\003\002\004\004\006\007\250\335\362\322\004\004\002"
+	.string	"\002\005\b\260\355\222\212\002\022\005\003\002\003\002\006\002\007\013\233\346\244\226\006"
+	.string	"\f\242\233\362\205\b\020\002\b\002\t\006\n\002\013"
+	.string	"\002\013\r\016\270\272\250\266\013\017\215\232\327\322\003\030\020\315\232\225\331\016\021\022\340\207\245\357\f\023\262\235\221\362\004\024\025\026\253\327\227\253\013\027\231\366\331l\030\367\343\320\264\b"
+	.string	"\031"
+	.string	")\"\324\334\017\2615\355s\350\203\001+\004\332(\f\317\276\304\241\221\235\f\b\260\312kb:\354\326\316\324"
+	.ascii	"{@\310\340bfg\236\322\330\243\304\007\224\375\313\rvy\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375 d\365\001"
+	.string	"\024\002X"
+	.string	"\t"
+	.string	"\001\001\002\003"
+	.string	"\001\001\007\001\001\b"
+	.string	"\001\013\f\004\001\016\017\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\013"
+	.ascii	"6\t\026j .\207\254\n\353\214\241\022cf`\232w\250\f~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`E\001\255\t"
+	.string	"B\01722`k\323\030\300\203\205\301\217\241a\b\b\213\017\016\002\037\r\035\251nV\247&\240\213\253u\223\300\224\001\257\002"
+	.ascii	"g\251\037\007\342\020m\374~k[J\231\002o]\360G}\304\235\216\222"
+	.ascii	"\013\r\031\007\305\222\243\343\001\202\340W}\276\212\222\030"
+	.ascii	"\233\b\215\376&\277+5>\235\t\367\304\362\022-2*p\312\355\007"
+	.ascii	"\300,\2322a\210!\263\361\221,\020\360\357v\031\265\253vW\272"
+	.ascii	"\251\344\354n\001\224\210\217\024(\345\206\225H\312\r\335Z1X"
+	.ascii	"R\330]\313s\216h\271\351`<\022M5\035\214\207\372a\351\240\037"
+	.ascii	"\217\277\276u\231\334\326eIs\327\242|EP\211\335\035X/\335\335"
+	.ascii	"\325\214\316\023\362\330#\0373\275\330\335\367\220\363 . `\002"
+	.ascii	"!D\326\016\013\032o[py\025\3720\032\020S\330\332\256\210\222"
+	.ascii	"a\215\357f\322-\333c_\304\352\355\300x\023r\236\360\2700\260"
+	.ascii	"\b \2464\211\300\267\375\310\345\313\025f\237\003\213#;\346:"
+	.ascii	"\025`\321\324\bNbD\007\267?[\327\020\220XV\240\033^\374\341\255"
+	.ascii	"`\277T\321\316\356N\333pj\230B\302hUsn"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"\005\005"
+	.string	"R\210\033&\2205I\007\227/\216\330\263\217\325\027\375\252\177\265\037K\241\231\325\335\336\217-\365\002\333Z7{\370\237\250Md\222\001$\257\177\326\366\f=\345\253$\314\3521\275\243\177[k9\207\302\200Y\300e\006\250\222'\356\220\177\334\271X\232\024\300\016\201\b\364\220\212(\032h<\017\003Q\273\033\365\215\352tj\0207h&MF\246\266\227\236\004n\001\024"
+	.string	"\"F\326\025\006\323\235\202v@`\200\t\324)q\231\303L\313\031\016g\020J\r.\207|"
+	.ascii	"\027\361\031\005.\036%\030V\205\2542d\001\334"
+	.text
+	.section	.gnu.lto_.pureconst.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\232\004\003\230\004\007\230\004\b\232\004\013\230"
+	.ascii	"\004\f\232\004\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\325\004"
+	.string	"\222\006\025\037\220+\303\001\377\277\242\372\377\217\375_\235\276\353\246qR\256\353\272v\376P\331\337\265\277eJ\001b2\232K@}\210\303\324d+\231G\346\220\315\307\320\223\036\001\006K\301\261ml\372@\306v\013\220\343\274\330H\227k\352\242\350\256\342\304V\355\315\022Lz%\036"
+	.string	" \013\311\030\254\241!\300\0216\001@\034\036&@\\\315\013\260\213E+b\366~\300\210\341\002 \\\024\024\236\020\024h\222D\303Zp\322\262e\265\004\n\253\200"
+	.string	">=0j\022\304m\t\376\022\310"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.1c9af0ce630b5f18,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterSourceNames.23.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375 \344\025\006"
+	.string	"\244\n\217"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\257\001}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'1\270\257\005}\276\003\005\001'6\206\b{\by\301\002\005\001'?\b}\304'D\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004ESC"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\b"
+	.ascii	"gH\315\323\216\253\266\346\231\007\310\334g\326\001j\277\001"
+	.ascii	"\024\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.26.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\315\b"
+	.string	"FP<8@o\323\001XPvq\300\214\307\230\t\247\032!\031\233\320\004R\\\025gh\275\224}\315\016\365oWH\032\350\3540\214\016d\177\344\216\r\201]\3215W\372\264\355\336)\005)"
+	.string	","
+	.string	"-"
+	.string	"\237\366\354\230\207\340\236\004\2740A\355.\225\033\367\036=\377!\007\020\215@\217\233\206\335u\024\2152ny\333\007\266\027\354_\001~\351\217U\345\002S\200\262\213\221\232\331\323\\\351\270l?\332\3778\210\367\322\347\002\273_K\312n\250\340\004\353\323\341\t\252O\353\003U,$\317K6\036&\024\302m\211\217LX\273\313\340\213PT\004\200\034\237\376\247\372\234*&\222L(\246\354\020\024\245\206}\315\356\256\345\3475\353\262\3164\306\351\264\254V\017F\271\272qZ\306Q\r\342\241C\261\312Q\216\201\267\210\254\322n\333*\275\302\275f\345g\207\227SHZp?\t\017"
+	.ascii	"2\241c\034\030\027\006\\\003\016\242`1(\306Q\224h*l\310\004V"
+	.ascii	"0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.31.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375 \241\275\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\201\027\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\334\030us\347\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\200\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.33.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_currentSensorVirtualConfig_Registry.37.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375 \223U\004"
+	.string	"\304\007\\"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\356\241\033\007yw\250\366\006yu"
+	.string	"\005\001\006'\001\004\005\001\006\035\001\001\201\0028sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.string	"B\b\354\345\006\320$d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.41.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\245\013"
+	.string	"\026\326N?\020Q\225\016+\bX\026\341e5\332:\373\222\316 \364\213\320\274\217\207\001\344+\005\002h&\226\233\361?0\222+\025A`\261[Q\004\262\b\342\220\354#Ym\247\034\030\367\333\326\3306\2212\245;"
+	.string	"6"
+	.string	"?"
+	.string	"\371\364)\224\025/\002\214\330\245\020\332\330VD\301\301\366+\006\3312\016\242\366+\013\245U\215\335\305T\303AO\220\177\017\237|\246\320\223\303\300\356:?S\205[o\333b\373b_B\267\213\310\345O\035\354:P\273\336?_\365\017\233\277\341\321\020\272\374\367\350w\221G\373\023!\3779I\244h\2214d\203\242\324\f\366\257\325\223\255\351\250\351K\323\232\351!\r\233\201&\377E\0050ACV5\353\027,\031\355z\226KOj!\312\320\251\252\002H3\256\251/\335\260\263\2574\311\356\210\200\037\342\"\032l8\234\310\343u"
+	.string	"\f\025\035T^\206\236\244G\3160\236\216\306q\237\f\353\270\255\353h\035\326\331h\034`\031\327a\230\020o\0174\016\363l\033\207U@\357\327\352\351"
+	.string	"\213\226\247\"\203d\324\247~\"#)q\023\b\022d2\n\026|\244Y\307\020\003\004X \f\026"
+	.ascii	"3\241\005)\360+z\027\310\004\f\004\311\240{i\226\005\3420\225"
+	.ascii	"\211\244\222q\003W\246\233\313\232R\255\0050B\\\345\343\232\310"
+	.ascii	"6\004\3752\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.42.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`U"
+	.string	"\335\b"
+	.string	"\306P>7@\223\032\003\030/\271\007\206r\331\326\231a\376\230[\247U\371\347%\025\b|#\227\232\007d_\310\225y\226\206\243I\342\2628s\"\332\237\355\311\265\370\237\310\275eJ\001*"
+	.string	"-"
+	.string	"/"
+	.string	"\003\033\313\206m\314\254\220\2735\262\321\222\375\237\032\210C\307\260\266\2129\250\224\311\021\340\341\177#*\245r5\267Eh\353\3206\026\333\377W[\265\333\204K&\223@\363s\314j\376\2220$\235\266\216\255O\214\022:\245T\316\357\361\342\372\317\320\205"
+	.string	"\313\003\023l,7\007\232\306g\227\026\247\004&Sp;rK\251 \346\177C\275b\026\214Z\304\262\031\244h\224eM\332XvT0\223\231S\234\265,S\324>Z\007 \004\007~(D\022\340\367\261\020(\310\003\2068\317\033\201\346\347u_\210\373f\250\342s1A\3367=\006\355D\2347\301\256\363f\207uo\327V\215\350x\235\002\f"
+	.ascii	"2\241\345/0.\f\270\003\214\333\224$3\225\200\001\363.\001\020"
+	.ascii	"\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.43.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`M\002\r\021"
+	.string	"&\237lE\360\320&\035\362<c(}(\276\013>\237C\177.\233P\030\362\356\316b\222\311\350+\215b\307\200\036B#\030\204\217!\236\274\3010\322;\315?\251\334Zz\322\357\253R+\315\214\333nb\343AY\273\367\2262\245W"
+	.string	"Q"
+	.string	"_"
+	.ascii	"\033Ky\301\351\320\261\203\304\303\323\r\304C\267l\244\307p\366"
+	.ascii	"=>2=9v7\323\020o=\302\247\331\362M\"\273{\235\003\350\\.\217"
+	.ascii	"5\207\0346\344\243\271>\0056A4\002\\1\017\204\b\204\321u\236"
+	.ascii	"\035\\0\231&\221\335uv\256\231\333t\333(\266\031\330\371\n!>"
+	.ascii	"\212\357h\360s\016\315b\311w\207>K<\274~\314\030)\301^r\311\216"
+	.ascii	"\271\244\276\354\277\335]\353\215}\330\037\340"
+	.string	"\245\343KCM\277Lk\2463\323'\200\202\021\245T\354zX\342\261CP\306\b\224\355\247}\023?\321:\254\345\005vo\200`l\":\233!\325\227\023\234$>\265\300\203#&u\330\237q\032$~\216'\224\344\273\222x\370\024\356 )}P\265)<F\205\373l\016\212l\362\027\253T\321\241\013\325\0013GJ\251\266\366\026yt\341,V\244\242H\034\225\270\332'O\321\203\001\345\003'\247%\036\252P\227\344\224\363l\247\335\r\234\266\242\245@\257T+*\032\307\261\2542\026\267\261T4V\246rb\222\222\2558V\246B\340-\203\306e+\333\306e\250\330\376\255\336\370\201\316\320\213\302\304\250\272PP\204\372\362\177\376\364@\315\216\007\325\366k\034\bBH\003\337\306oD\22002\022\017\363\376\351\222\240\232\204dz\274\344\322\0370 \260\002\021\241\264\003C\241\213\213\341\021\352\336\315\314\226+\2263\003\033"
+	.ascii	"\303.\215\223\214\347\267\240\024\336*\342K\b&\352\201%M\256"
+	.ascii	"\024\213\355\034$$\203\207\341\254\207?0\017\n\300@\345\305\031"
+	.ascii	"\276!\026[\302\204\375\244\3707\302\267B\226\r\204Q\222\256-"
+	.ascii	"\330S\304\220\337\335`\326\035V\263\030m\\Mqg\0213\246\024\013"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_currentMeterVirtualInit.45.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\305\006"
+	.string	"\262\r01pM3\006\240\252\f\337\033\t8\270\205yxW6\350\324q\3070\252o;\016cA7Q,g\204\364\327\205\351\005\207\035W\t\314\027'\255\224)\005\215(\225I\222\322\022\305JR\325$UqRHX\210\221\254\"\245\240\024\203$c\205\242d|\264\373e\020J\266\313\203\250\343\006\\\020\007\2625\254Y\004\331\177\361\2547\314a\251/\f\333`9O\303\332r\f[\207\007\347Y\3271\262E<\254\3250\367*Z\003\374\177_\246}\017IH\364\370'NL\276\301\017\214\266~z\265\"\326\262[\263\221\320l\376\307g\341\313\356\252\235a\201\211\301\354\002\016\376\327M\f\205\373\334\326\240-\3246\013\007"
+	.ascii	"3\001g8\203\004\3365t\031\344e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRefresh.46.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`\036\004\335\033"
+	.string	"\026\263\262H\260\230M:\360\345\024\001\020\200I\024\335\363\b\376bC\032\332<\307\001?$\200'\013\216z\203\006\2607\276\352L\361R\r\343S\020\254\255\365\214\357\237\3267\3147.\302\245\360G\372|\300\363\022xi\254YB6\221;\245\230"
+	.string	"\217"
+	.string	"\244"
+	.ascii	"UD\347\341\235\0366j\2551\2476\221\035s:cl)\0358S\223`l\361\350"
+	.ascii	"(\272\257\200\013.\022v\332\r\036\030\335W4\373\226\255\034["
+	.ascii	"\265\372\0268\302\353\324\237\366s<\312\350=\235a\265\276(\362"
+	.ascii	"\243\326\272\300\n^\247\006> <\005_\023\236\332\310\266r\337"
+	.ascii	"S\375\024\230\022S\\j\255\264u\272\321C\n\3564\362\305\t0\236"
+	.ascii	"\322\321\303\230R\213S\026\007I\\%\315\225Q*A\003\265\326O}\232"
+	.ascii	"P\332\315)N\250\265z\362\224T\334\342m\003\331&m\360A`x]\337"
+	.ascii	"\271\024\253D\030\177x\026\320\253\326$\b>\326}\204\360e\234"
+	.ascii	":h\234\347\215\341\351\327A\223_\227\036\322\374\331\276\335"
+	.ascii	"\334&\373`\335\030\316\021\247q\304\351\2318}\363\336O`\247m"
+	.ascii	"\304\351\232[\3354\227\372\005\\\307?s\337\037`\247e\227\272"
+	.ascii	"c;\r\333\351\327N\213;\035\206\323t\247\301\235\336\235"
+	.string	"\236t\372:2PLh[jE\361\373R\227\320 4nu\373<\374++k\275\216R\274\250\234Np\325Z\023\234\372\207\352\001/&o\302\323\323\023\236\326\354\253>\243V\324`\212\352)\321\275\222\300VH\217\033\3416\371W\207qa\231\001&\270\301\025\260\2615a\277\216\350\020\0309\257\313f\347\276\226\")\231D)\342\332\254\316\223\022\007\315\212UJ(\272\341\212`8|\253\003\021\272\021vP\335\350!\201K\263\257R25\270\265\302]ps\246J\034\261\215\355\356\303\330\270RB\355\346\217n\323\301\2151\3443\273\264\3444k\255G\373\2420\300\316\226`\354\240\2224\275x\256\355\341Bt\005\244\324Z!\370@\036\244f\273\335\302S0\270\221\264\325,\220\267\334\317O\006\231\241\221\334\301\215\344\210\301G\210\002\321x\341&\202$G\034\b\362\306\347\026\204\253Q\222\302\215\254\371\fi s5\021"
+	.ascii	"lc@\n\335p\270\0216Z\0167\346\204n9"
+	.string	"\232\020P-\210f\303\345h\ft<\016\335p4r\034q\264\030\037\322\301O\275B\226\024]\270\220v\347\234\235S\321\311\236\246\360\364\344\354\206\247+e\022\234\215\342,\331\023\224\251\205\3275\333\232\305Y\212U2\355\262\336\303r\265\244Z\302\357W\225T+\322\201\233\235\355e{\2638Z%\027\201\205\255lE$%\324\256\312\032\356\304Y\001P\250Q,E\225A\b\ndD\202\321\202\026f\f\200\002\2212c\007\020`WCI\306b[\326Z\211\250v+\244\235\225e\025]\033\3060 \347\006\332\206\202X\253\372\003\352\361\372\b\271_;\026\277l\254[\007\221\365\3601\027\267\260\2479\265A\024f\332\342[\033lg\262\016\205R\202/T\r{\371\325l\216R\\C\336\214\2003\005\001\026\3419\242$\330\020P\321\310V\026\202x\332K\357x\tyL\2446\350\360\030W`[\306%\nk\007\224\277\030"
+	.ascii	"\241\200\326d\265C\356J\022\241\237UD\252\266\260\350\336\254"
+	.ascii	"\236Lj\267e\374\007"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRead.47.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\025\013"
+	.string	"F\224JB \311(\035\310\320\204\300\t\262\330\207\001R\357\266\362\207z\363(B\342\216\202cI\001\023\324lT\341\232\305\216\325h?he\203c\004\250\017"
+	.string	"\031"
+	.string	"\021\244\230f$b\006h!\374\206I\344\266{\247\0244"
+	.string	"6"
+	.string	";"
+	.string	"\236\320N=\036\";\325\376\220\235\032\264\037|D\355\005\240\224\250$\354n\235*\007/A\377/_\bM\244K\205\214\335\265\fM'\367\274m\t\333\025\366G\0020\261$c\366H\2223\305~fw\327\363d_\3743RZJ\351k\f,\006\027\rvMb\023\326E\023\254hl_\332o\271\013xqt\207\335\323\002\326\356H\021\005:\365uJ@\316\206\326\001\230\350\361\001\033,\021>m\317\003\250B\272\r*5\312N\247\202\020\202A\016\340\323v\327\302\207yL\310O\235ZD$\037\236\372\242\354\364s\323Z\005\036\007\342<\324\033\007\364\341</\264\325\317\353\276\017\367\325O\207\303S7\357\253\234\bw\037\234WA]\347U\315\270\317\354<Y\003\201\2534I,\247\275}%\035p7\360a\274\334\361\025"
+	.ascii	"2\241Q/0<\250^\320\206\260\007\017&\233\n\201\020\260<\310\r"
+	.ascii	"\336q\024\035La\243\224\364j\202=\0251\244\272\273`\324%\254"
+	.ascii	"f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_currentMeterRead.48.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`\252\003U\030"
+	.string	"F\352\226H\260\224NcX\033@\213\035\303\241\n\023\341\334N\227\3503\203\021\216cR\252\253\231\302\276\004\353\264\0040i\265\260\221\026\276t\200M\202d\362\241\377\212 \336\300\207\320\261\340\325C\277?h\337\321\274\320 {o\271\245L)}"
+	.string	"z"
+	.string	"\206"
+	.string	"\326\304\363\324>\323\233|w\332\261\355\336!-\252{\211*fp\336\"8JyK~@yk\237}v\342\321\275\261\313'J\355\336\213\253-\356\373i\226\226\254\324\347\027\2172\005\f\303\001\304\363\363R\247*\306\230\226\314\377\204/}FP\2332\024$<y0\023Bc\017\255\244\202\341\326\211"
+	.string	"@\"H\224/\242\262\027OI"
+	.string	"\001)5#\334{M\203@A\267\355\266\205\266\033\330\325*N?z\274\213\340\320\253V#\223\357\224\257\177\232\301bH\030Y\017Eb\023\201\264\032\331\257\307\343\361\350Zd[\352\233ImRR\333J\352\263\2446-\265\375\323_\357\364\237\300\225\204\324\204X\260qo\211\243\222\353e\255^\330\276\177\343F\234C9\301\321p\005\216}\213\272T\316\241\\"
+	.ascii	"\311k\310t\357\275\335\3329\366\355\226\336lS\342k\370\376\244"
+	.ascii	"\363\223{\213\224\340\316\007\017\273\030\205\n..\345-\275\261"
+	.ascii	"\312\333\007\323l5\271|\226<H\221\344\207L\371KiR9\024\357\343"
+	.ascii	"]/>\222/\300\320\007a\312[\223j\237\316\326\204\266\230oax\217"
+	.ascii	"\035\004\2433\234\207\006\225\261[-[\025\020d\266v\312<\213\232"
+	.ascii	"\315|\307\325Yo1\314\226\234\234{\325\016\300\021U\b\235\217"
+	.ascii	"\244S\336V\256`\332\215\356p\035\273\363\336\313\342\347\370"
+	.ascii	"\224\007\037\351\3264<\372 \257\2745+\031\n\261aS=\335\215\216"
+	.ascii	"\306n\330Q\347Vnjt\275\036\210\034\316\246\307\263\251\321\331"
+	.ascii	"\340jv34\270\\\317\006\267b\300\274\017\272\036\356\206\307\353"
+	.ascii	"\341n\304\337\311[|\213\222\320\032\332\257\002\311{\357=c\216"
+	.ascii	"f\253\262d\344~f\302\300R#\262\340\227\262\314\313\222~\216\206"
+	.ascii	"LD~\364\370.`\323\224y\200\326j\267H\240\017\232\254<NK#\272"
+	.ascii	"*\253\221\251\212?\tB\203V\025\371\022\262\267\225\217\001\271"
+	.ascii	"\325\033I:\342\263\304\326\203\375\307\004\026\007\016O\250q"
+	.ascii	",\344\f\223\346F&hJ\n\222t\220\002\221\301b\007\021`\27163\263"
+	.ascii	"\205\225cb\302==\266\2742L\327\340$\274\\\352\216\224yAs\310"
+	.ascii	"\320\266\320\033\344Pz\013I\317\221x\202F\377n\275l\356\221\350"
+	.ascii	"\246P\336\300\374v\215\340p*6\021%\372_\211\006\253h}IKN1QVz"
+	.ascii	"\253\374\212\004\265\364\356\240G\246\026;P0\322\343\250E\365"
+	.ascii	"\302s;\027\360N\030\316\n\005in\241\036\005\226\251\361W0\362"
+	.ascii	"\260\261\004\202\220.\316\307o\227H\200\035\177\201Rj\362j\240"
+	.ascii	"Lr\253\342\364\374^\252\216\206I\314\250\001"
+	.text
+	.section	.gnu.lto_currentMeterRead.part.0.59.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`\360\001}\020"
+	.string	"F\235gG\360\262&\035\240\342\203\334\313[\307e\266\303@\004\t\243\226\204\2447\327\265\253\267D>\334!"
+	.string	"\241\332\3248\013\f\303\344\3276\030C\313\300\210V\t\304m\"DO\007\330\224a5!\262\347\240\300\031o\250\265M\344N)O"
+	.string	"S"
+	.string	"P"
+	.ascii	"\002v_\200pvE\005\237N\240}Z<I\350S\373H\350\323\276\013\333"
+	.ascii	")\026\253\354\036\027c\3665=\037^Cv\227\373\324\024W]e\246\362"
+	.ascii	"a'\031=\\?~dGe\207M\210\021\227\003\236\211 \354\2565\022\367"
+	.ascii	"\274\355\007\266\031\330\222C\341\214\217\247\307\214\200\005"
+	.ascii	"\253"
+	.string	"ewO\366kncoFy\314\005Z:X/vwCQ\037F\312\207y\263}\232\324_)R\302\256J\224|Zc\\\206\352\257\024\003\330Eac\201\366y \333,\345\305\324gP\004\304\025\301b)\355\313\334\245\372\f\352\001-T\350SyV~|t\206\357x\332\3566\360s\256\243\301o}\232\364\311\257|\241\317\353\307K\237\026 ,\031\327J\006I\205\261f\317V_l\221\264^\374\245H\372Z\311\t\021\326.\210 \240u\2319*N\363\333\367o\216\023>\346,\210\211\030<\tv\246\2164=21\225:\020<\215\270\020\374\302R\027r%\357\204\304\215\300\22031\340oC\007r\246\357\003\271\355\260GX\341\362\343c\245*VU\030\333:\341=\322\247\302y<\007\243-<\307\005\216\307'\016U\021\235\233\037\327\311oPh!\304\243\327\360\002\304\320\350\320\371\0011 \220\002\021\263\343\006"
+	.ascii	"\nPs\017\022\201tC\3723\246`x\234\330`\255\301\341T\201\006\314"
+	.ascii	"^nj\243t\216\002\202gkN\246\300\006\017C\270\033B\210<0\302\037"
+	.ascii	"\203\214\212\022\b+aJ'nS\320v\327\275,A\243T\366d\212\275\332"
+	.ascii	"\377H\372c\350f(\302\220\307\313\235\244\325nc\312\032\003\200"
+	.ascii	"\366F2\033dZz\302\033\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`\025\001U\b"
+	.string	"d\013\021\002"
+	.string	""
+	.string	""
+	.string	"\002;\177\036\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005,\022\201\204\001\032\177\037\272\200\202)\177 \005(\020\0054!\033\016\200\003\002*\177\"+\177#5$6%\002-\177&.\177'\"(\002/\177)0\177*\377\377\377\377\003%+\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005#,!-setdata"
+	.string	""
+	.string	"\005\037.\034/\0350\0311\0302\0273\0013\1774\037"
+	.string	""
+	.string	"\200\200\200\0012\17751\1776\003\003\033$\003\003\032\304\001\003\003\031\344\001\003\013\033$\003\017"
+	.string	"\323\243\362\362"
+	.string	"\001\342\007"
+	.ascii	"% \260\002)2v\030\332\032\272\032$o\030X\017? l\271\0242\t\343"
+	.ascii	"\260\021\2010\2603\3462\006\316\370\031\357JH\354\024\270qlY"
+	.ascii	"\013\341\334O\034p\376(H\200\026\217H\201\207.\374\033\274\266"
+	.ascii	"\r\346m\360\302\2633\300\033\276k\350FM0\236"
+	.text
+	.section	.gnu.lto_.refs.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375 \2335\003"
+	.string	"\242\b\026\032\200\265I\00730\00330\0033P\304\343\343\267\265\247\337\324\255I\333D\246\024\016fXa\004\263,M\031\202\3268\364\224V\351\312\344\b&\300{x\227UY\223\027%5\357\311\200\341\017\331\204\026\241-\016%JMi\034W{]\314\342\314\021z\315\030k}\235\032\020\003"
+	.ascii	"\237\020\254\317@0\033\3142"
+	.text
+	.section	.gnu.lto_.decls.1c9af0ce630b5f18,"e",@progbits
+	.string	"(\265/\375`@(\315\260"
+	.ascii	"Z\027e=Y0JIH\351\253\230\210\240G;\216\363\315\350\016ms\002"
+	.ascii	"k:\347\265\253\205-\034\023\021\321x\353Ja\240\362\257q\262\374"
+	.ascii	"\037\3438\211\261\262\205\033;G\005\021\307\275\323\353\273n"
+	.ascii	"\227\240p\240\255\220\221\242UT5I\241K\310dE[\\r\t\245\324\240"
+	.ascii	"\022\235\330\270\267\224)5\003\316\003\345\003rX\215\233\307"
+	.ascii	"[\327\214\265%\223\367*C\204\370\331\321dK\033\020\266\221\234"
+	.ascii	"A7\200\235\256\363;D\316\357\3408o\347\316[\265\363vK\214\226"
+	.ascii	"\001\324\224BsEJ\f\254\206\301Nn\2000i{\253\343lb\273\340e\277"
+	.ascii	"\270\225\202T\002\325!\0160b tA t\2670\316\3278\347+\232\023"
+	.ascii	"\003\271\346:<w\226c:?D\226\263\367\016\231-\3301[\260sv5\\\352"
+	.ascii	"\354+\231\3635\354,Q\223\234\257U\347\2778\203\216\333\260\033"
+	.ascii	"^~\3407g7~\373\316Py\225m\244\216\225\232\343<\177\320\325\271"
+	.ascii	"9\376\240{uq\nq\006]\217\2559\337^\316\257a9\357\266\344\024"
+	.ascii	"\202\343\f\2727\217\223\323\230\f/;p\231g\300\301\253P\312\355"
+	.ascii	"\272W\031\004$\307%7\247\355\373\306y\356\240\3439\356\240{\023"
+	.ascii	"O\017g1\035\202\2248\234~\264\005c\001l\213\362\253\355\227\241"
+	.ascii	"3K\307\321\307\233\363\032D\t\353\252\302%\213\241p\341\017\360"
+	.ascii	"\224]\317\275UbY^\270\013\243\361\222\271\360\226\020C\266\207"
+	.ascii	"\033V\323i\317f\316\363\226\363\347\263Z\234\201T^\350\331R\004"
+	.ascii	"K\230\2562\216\302S\252\227\361\254bu\345\306eL\205\303\252\227"
+	.ascii	"\261\247\206\325\021-l\306K.c\261\363\030\223\021C\f\355\034"
+	.ascii	")\363\262\322\33179\203\356\207\273\316,C\273&8h\313\266g\344"
+	.ascii	"y\206b\345b\334\374\342,&b\334\356\275X\370\n/\031\214\277\316"
+	.ascii	"N\270\353Vy\357\327\275\367\032\374Dg0\256\302S84\335[\305C\203"
+	.ascii	"\224)0\300\300\335{C\f\205\360a\302\241\325\324\331'\235\037"
+	.ascii	"\341<\003\316\037\340d%{\361\362g\314<?a(\357!*/\363\336\033"
+	.ascii	"\304D\266\b\211\264=\321y\226r\t\206\367rp\237\023\205{\357\345"
+	.ascii	"\341\237\351\336\247\007\316\240\263\214Aw%g\320\235\214A\247"
+	.ascii	"\201\b\376\336\362s\006z\304\320+\370\233\354e\017\372\253\206"
+	.ascii	"\203q\002n\306\nh\"\300\337\027\\\303_\2038\205\227\241\262\362"
+	.ascii	"\363\005C\337\360\367\233\237G\374,\342\355g9?\207\320\003h\001"
+	.ascii	"\374,\327\001\370yL[\360\267\320\317$\264\207\256\200\204\377"
+	.ascii	"\034>\364\267ZS\003\340\257\036\370Y\354\347\260\237\313\376"
+	.ascii	"\327\277\n\3719\371s\327\317N~\346\372y\311\317[?7\371\031Jw"
+	.ascii	"\370\271\352g\255\237\2254\207\377B\177\335\372\337\345?\227"
+	.ascii	"\377^Z\314\317o\177S\360\367\004\177k\370[\202\2771\374\r\301"
+	.ascii	"\177\236\277\252\375}\341\347\271\237\343~f\363s\232\237\313"
+	.ascii	"\374\334\3749\314\317h?\233\375\354\365s\224\237W\374,\343\347"
+	.ascii	"\246\237a\374|\177N\341\347\016\374\314\201\237Q\3709\375\031"
+	.ascii	"\370\363\357g\r\374\027\341\177\226\2371"
+	.string	"\360\363\005~\266\300\317\035\374l\200\237I\370\271\002\377\277\374<\302\317\024\370\317\374Y\002?C\340g\021~F\361\277\316\317&\376\207\360\363\002~>\300\317%~\306\340g\022?\203\370\037\346?\230\377Z\376\247\370o\200\377h\377wssss\277M\372y\314~\016o\0017\205[\\W\362\247I\353\306\2307o6;iZH\256\3508\331\330z\r\0077\256+\311\203\344\b\035\031m\3575=\305sL\243\031\323jt\367\262\022\371d\274G#\210\277\323\274\325\264ZS\355\215\230n\276\323\236\326k\247\360\336\r;\334\216G\020>M\312D\211s\346\275\366\266\237{\273\356\275\034t`pC\300\264m3=\305\376`\266\301h\3737\255\366\277\307\307J\311\324l\333e\260\316\2449\371\3223\367\206\311Y\333e\223\341-\272.O|\244\3059\177\2129\377\376uwh\274\367\326\330Q^#\323\317y\207\201\270r"
+	.string	"\376\333{\013@\201{\207X\340\334\234J\304\206;<\334\235\346\275\304*\341\002\252\240\210UREf\325\025\022\221\b/\030o\225\260\310\274\367\302%\022\205(\220\367B\221y\241\256\2134(\276\312*\341%\"\357\205K\274C\017Eb\025T\2219\204\272PdVA]f\325\025\272\304\241\261\211x\215\027.\263\352\3552\221PBE&\022\252\310\254\032\302rMAz\324\250\002\007\344\211\251\212\304K\303ijh\024j\026\225\310\273v/\177\275\270\306"
+	.string	"\334;\2054\256\r\245x\214\251I\203\t\313\020\311\033\234\230\254\220\227\330,j!\357\325bZq\2356\020*\233\227\b7\205?\246\356\214\027\367N\340t\257\220o\363\336+\274\367\362\030\247\224\367\352\020*f99\335{\034r\272SB\262\027\367\366W\2321\250\"\323\nIDF\205\231ua(\205\234u\327\252\214'S\350ug\2649\263\240\242\330\354\342\310<\305i\253\364\031\353a\305\006\032\0329b\025\036g\227\212&Fu:\235\274\354-MV\213\367Fm"
+	.ascii	"\246y\316\251Pf\346\306\354\274l\263>\333)\336\241\022\017fc"
+	.ascii	"G\021\034g\313\222\255\255\026,@M-mC0\347y\276\312\310\306\300"
+	.ascii	"IS\245m\217u\f\031u\234\034\241\262l*\035V\213wX\205\301VV\\"
+	.ascii	"\027\3345\032EH\340\f\024\251\266\347\031Z\271\030\027(YW\272"
+	.ascii	"\312\305\216\350\316\214\305\231\302\322`\274\354+\375\365\325"
+	.ascii	"\303E\225|Q\346\274\216\313y]\331y\035s\331\314\2354XD\224(Y"
+	.ascii	"J\t\263\312+J\316x)\201\330\266\324\202\264\215\322Px\331\312"
+	.ascii	"~\322\312{\231oN\232(\273\253\267vC\241Kd\342\312\n\021\202g"
+	.ascii	"N\005\027dt\366:\034\347u\306\363\272\246&\037N\242\031X\027"
+	.ascii	"W\362\204\343\021J\333wr\213\221\032vQS\222:\332\266V/\341\345"
+	.ascii	"\206f\302f\b\023T\333\353\204g\n\367\362\006\035\317\315\361"
+	.ascii	"\006]\253@\364V\202Ag<*\357\027\002\214\374h\322\266v\222\r<"
+	.ascii	"[d>\202t\326\016\021\211T\325\214\276\222q\244\261\032\t/\373"
+	.ascii	"\252\213\234\327\332\b\026\262\276\342\261r\212a\243\261\004"
+	.ascii	"\271Z\247\345\273\223\346\374\233HK\355\270\232P\231\363fd8\273"
+	.ascii	"\235{\221kY4\030\0167\207,\240+\215\033QS\317P\256a6\f\247*\307"
+	.ascii	"N\030\313\242\333\0314cC\261\333\226\204k\232a5\242f[2I\324N"
+	.ascii	"\bh\242\306\255\245\232\251\213;\242\362B\355\262\304\201c\265"
+	.ascii	"]\275\267\207\\\0325\312\266$\\\337\026\262\\V[2\0317\207\345"
+	.ascii	"vB\345}\322a)5\200\002skK\302\255\300&\203\254M\370\266A\022"
+	.ascii	"$\321[\252\237\030\316n\250\274F\236,\306\266$\334\3378\272\252"
+	.ascii	"\177t\217\326\3219\032H\373\350\033=\325<\332\252\221\035\244"
+	.ascii	"\251ZH\037{H\357\340eKu\215wT\3338\007cXm'\024\272Ld\236\262"
+	.ascii	"\356U\362\332\237\001\007-\305\001mk\235\213=\314k\315\310\333"
+	.ascii	"y7wS\343\206\226\030\343L\201\360\0212e\206\206\234\327\270\007"
+	.ascii	"%\345\300n\264\255o*\334O\024\025\234\030\\\234\232\344\212\206"
+	.ascii	"T\2267N\332\230*\234\376j6\032k\350\210\361\2220\256+dV\370W"
+	.ascii	"\250lz\212\226\013\030726_\230\274\375\254A\322\024\243\364"
+	.string	"9\026\263T\267\277\256\371A\336K\334q\323\344\004\267\246\2669\261\021\344H\017\331\234%7\332\362\023\242W6\373\003\316\223\n`\347\353\032\3274\313\232\246\256\r]\353d\214\353J\246g\244\33289\353Z\357\222\037x\312\254)5-\205:V\222\264}=\303j%\334\253\274\340\305\350\243m\006D\257ftI-Tr\322\270\226\251ej\332\320\025\276!@\t\362\213\b\276\212\0225\307\343l\256i:e\327\317\323\223\021d\263\t\344\013\250\355x\207\264\375N\b\006L\r\303e\314\302\223X\035\264]\231\0261od\316^\321\316j\024\023^X\bB&\213\333\215!\035\036mk\227\352\245r\251[\352\007\200\226\313\327,\313j\006\3428\264\341\201\313\215\325\234\325\371\322\266L\311\244\242\365\326\366@E\316\261*\306\313JV\303\234\350\250dV9b\330\200\263"
+	.string	"\332\nrt\366@Pg\275R\261\364\230\315 3\005faH\332\325\222\266m\205\247\313H\264\362U\353|1k\252\342\0015T\\m+\225\363\005\320\360CO\032)lF\332\276R\371\353\024N\3233v\034\327\264\335=\021\2752\033\353\013\r\r\315\313\253\277\264\320%ZA\031k\233z!\345\344<squz\355\301\313\352T\243\0201\335a\223\001L\211h*6\356\221\266P\224D\236\341\0313]\220\234\347.\252j\265\302\0175Cj\021&b\334\200\324\252\2564n[\365H\325\342\346Q\350\022\303\340\334\352V\025\262\306U\237\324\256\332\2442\251\311\352\204\227u\253\032y\365Q\221\037\252[5\b\232 7N\252H\tY\252\263q`*6"
+	.ascii	"J\233\222\272\204\227U\353CU\253^U\025\270yT\336\032>Y\336\322"
+	.ascii	"\334\300m\b\001\304\246\314\332\016\235\n5\t\026\245\2206mk\026"
+	.ascii	"\317Q\n\315\005\r$\274\254X\347\233$\331\234\263m)b\365#\343"
+	.ascii	"\374\217\213\363>pg%r\252\271\361\b\303\346\274O\333y\2373\347"
+	.ascii	"}\322\316\373x9\357sfU\253\230^\334\204\251U\254\326d\300\314"
+	.ascii	"`\";\033\004c\320U\035u\252\362\370{\202\232\214\005\001\263"
+	.ascii	"r\276\356\020\241\210\030\260\266\266\036_s"
+	.string	"\374=\215\206\225\345\304<_qT\251\277g\267\206\304\212W\327\371zc\007l\316M\216\266\325\306\371\302\007\311\007\013<\302|\354h\373j\343\257O\274B\215*\341^\"\007\346\352\304i[\241j\215\327\250j\2745j\003\344\275\303\032\025D\347\336a\020\263\005\314\026\330&VXWt\366>DN \306\240\3431\242W\032>a>\340\026\245\355}\\T\031U\306P\233z\0243\316a;\377\332\264\254M\375\005\304\035F\225p\022t\307t\315\001\033\016+\214\363\336\253V'KN\215)\257\372\342\025F\017\215.j\267mu\301S\312\322l!i[\211,\227\344\313\232\266\266\225\211\345Nf\324\025\323BV\275\3656\03317\256\013\356\324B\023\005\316QN\256\223\337!\336\037\311,\240$M\2460\265\275\205\032tx\331tX\215\245\334'\0130\240\260\334\340\356\345\"\302\326Yc\206H[\\\\\2579\205\025"
+	.string	"\372\242\346e\346\005\016\234\206\033:\003J#ZQ\323q\336p|\345\036\217\260\016\215\026\025\214\245\233\363\262\335\264\227\006 o\224\007%\310\243\210VC\273\302\206\344\355\255\331\234\001h\312KS\240)\357Hii\002_\017\230\006I\240GKIF\276\036\t`p\211\204\004IIK>\337\317\307\223\026\3516\360\003\256H\177>\036\025<4\311\246h\220\005\312B\347\353\361\030"
+	.ascii	"\024DY\360D\b\0369 h\004\013}\342\bM\201?%\245\245\340\004\024"
+	.ascii	"t\b\026\235\227\362\216R4\270;\201\302D\222\022\013\224\004\002"
+	.ascii	"\264P\372\235\250 U\"\201\244\204\301\310\267\004B\212\006}|"
+	.ascii	"*:\335\t\026!)\375\244E>$\245\035\037\222R]\221\"\371\320$\035"
+	.ascii	"\312\201^\320\006\203(\360\350\210\307\323B\351gd\201\251R=B"
+	.ascii	"}H\275$\036\317\021\032\\\262Fh\220\347\300\"$\245\021@@\336"
+	.ascii	"\n#\333\002\230\006{Hh\004\004\240\301\202\235\257\030A\342("
+	.ascii	"\251\267d\302\006\364\350\027\002\322\222\t\350Q\317\t\024&0"
+	.ascii	"\254\b\242@\025h\004"
+	.string	"X\244\210 \355\371\034p\002\205\t\f)\032\274\200\301\210\024\310S\032q\304C#\240\341F= \352C\221\316o\320\301\005\035\224@\201\347%<\300\300\003\ft/\341\001\021\221\007\035\020\235\357\200\250\246\351P\032A\372\025#T\220\360\375X\260\370\031Q\240\001\016\026\021\245J>\301\035 \232&\365@Hy\037\364\214\216x@h\321\221\003\204Rp@\223xF\301\235\024\r\252P\361\323\235@aB\202\257\030\021,B\352\251\360\375P\340\371z, \330@\352C\203(P)\375\3716\030\235\220\004\204\026A\200\026E\200\032\001\227~) h\221\366\214xJ<\023\202R\336\007\023@\203K@I\277\337\007E;\301\024\210&\2318\201\006\227\"\360\241F@t\004%\026KA\337\317\210C\260\027D\201h\032l\261b\227\026u@t\242H\2744\351wBR\022j\224\224\264\244\002C\352[\372\235HJBO\264"
+	.string	"\242i\312\373"
+	.string	"5\002\376Tdh\301KR\n\366\"Hy&\364\200\220|=\037\220G\001\t\222xF\275\264\007<\001\374\201\340\373\365R\036p\t\205\206\264\250D\352\353-\361\034\375z@t\004\025J\017@\342\245Hy&\234 \224\006\213vi\020My\017\330\005\213\222xK)\2607\201\t\322\257\350\360\237\022\n$\221\376~@\022> \364\004\213L\204"
+	.string	"DS4\004\nL\2608\321\224\227\246\360m\200\007D\261\202\307\002(-\312@\203\324\327\3439\021\321\t\017\022\020\201\001\247\321\210\324\207\002\201KF$\202\300_\320\207\006I\370z<\026$\214\200A\022#8\240H< \252\304\202wb\251\021byB\263A\036\304^\3615\336Kf\217\334^\205\300\343\205\216\266v\2105\262\345\002\353h\304\026\211\213sa\314\002\204c\215\t\305\022\341\257\242U\222\253\255\025\362\244d\343\306\005\244\303|\260\264\034\331\374\210\263im\346\250Y\3259\036%\303\344\\\225\227\316\262\274\252A\325guN\216G\024\322B\355\232Q\346\210\370\350/RT\244\270l\217\032f\227\f\253\342eyT\263.\3058D\354\224\335q\317P\371b\305\356\370m\016\253\243F\225\020\006fJ\220\266 8\203n\347(U\004\225D\255\355\255TT\tu\256d\210iko\020\335\342"
+	.ascii	"@\2263\262\266<\326\206\215\322A\005$\206\215b\366\204\r)\342"
+	.ascii	"\326\366\302[\027Vh\241\252\231\237+\224r\237x\304\272\314\261"
+	.ascii	"\001w\213G\020>^2\274\306\330\031\267P\267\306\f88[\222\211\231"
+	.ascii	"a[\373tK\343\b\246\314\315\311\322P\002\204\271\245\343\374\005"
+	.ascii	"Rp@A\265\2652\316v-\266\031omm\214\237\035\317\300\t\261M\017"
+	.ascii	"cE\206\251\255}aa\360\362h\266\370]\031\f+hQ\347=\300G\323Y\246"
+	.ascii	"[bY\017 U2\316\337\016\257\230\331\221\325\366A/\316\357\346"
+	.ascii	"\350\320\251sC\347}Bf\210\033\220\331\22349r\257sb\226j-\207"
+	.ascii	"\220\203,\250\222\3218H\362\020C\206HfD4I\222\306\362\t\020\204"
+	.ascii	"ca\246\347)>\022`\004=\r2\347\230\241\021\021\021\221\024$e\245"
+	.ascii	"2\214\001]S\3404\363\034\201#\332"
+	.string	"\016G\206\210JC^\310\217Xi\270\36188a\333\274\343m\024\031d\266\325}y\307\217\211c!A\264X\225\030\312\211y\222H\002\025y5\337\007\034\247\362\267ABn#\027\373|\367\303\372\225\f\223\2666\007\200\327qW \312\262\276\360\265_\343 v\333\257\305*\2163\211\2766\247\321\357\035\327\002\271\223\375\362\374"
+	.string	"\366\212/\2376\345\322\260%\273t#c\334\237\304\2245%\364i\231\253\243\301\261\273\221D\241\016TU\334\331d*\033{\037\30350;\221\301\366P\005\r\213G\261\211\232\300\204\345thj \031\305@\214\225\250*^\202\024bd\317[\255;\255\264\026\004=M\276\0166\2320\t\231\0315\335\304Q\320\200Bg\233&0ml<B\r\250m^\227\2368\242Bxe\314\243\251\260b(\034n\270\206\213\030\245\375\247X\364\003\200p\3708]\017\212\257\320\342\022\222\274j\307\312\374\377\204\343h\227\3066\023i\262\317\314N\273\013\365\337A\217\331\004\250\353K$\274\220\265h\232\213[\244."
+	.string	"\003?\325\332'\207^\b\234\021\353h\314\253dSU\317e\221\301"
+	.string	"\001\200s\312\013}\234\007+\314\351\232\375\214\301"
+	.string	"#Y\323\031M*<'\001\200\213#!\311\251ZF\006\330\2452~P\210\217\231 :\242Pz\256\330T\35653\355\302W\361\304"
+	.string	"o\351\030\266!+\241dyT\261\314"
+	.ascii	"\003\246\266l4\312\234MN\273\207\312\\\261\232%\375\233\215d"
+	.ascii	"?\214\356\354\001\312\376y\310H\3060{=\222\373\"\200\255' \206"
+	.ascii	"\240PC\227w\225@\b1\"a\037e\004m\003\2454:f\322\223\305S\251"
+	.ascii	"\314\022~L\354\255\200\0171-\365|\224\355\315\250\376\r\303P"
+	.ascii	"1Q\337\021\377{\340\034\320\361T \332\305u.\242\b@\032yI\343"
+	.ascii	"\275#\307\273\351.\247\242 `\304Q\247\210\377\216\342\376\235"
+	.ascii	"\375\252\214\320\276i\317a\336\334\261D\260J\2546\332\002Wej"
+	.ascii	"\337\210\2013H\026x\275\262\252a\031a\037\254\332\253\200v\350"
+	.ascii	"\321\374\024\f\261\036F\203:\274\321\332M\002zsq\310\275\237"
+	.ascii	"\267\262\330\007\320w\272\232\222\222\356f~H\337\037\324\244"
+	.ascii	"\255\202g\324A\217<\342\237\027\200\302\364\001\177\006\022+"
+	.ascii	"\206LlE\266XG\032\203\357ZS\225\357\253\246\362\3776\341\303"
+	.ascii	"40\351EcLe\301>\363\305\344\202\216\233\324T\356F\337\326`\312"
+	.ascii	"\310\336\322\274\246\207\366\345\316\025\n\354\032\020\033w."
+	.ascii	"4\324\203\361\367*\216\367\024^?%\203\265\361\376G\360x\331\271"
+	.ascii	"+EN\245\235L_\271\304 \373\221\t\355\271c-\315\377\377\274 M"
+	.ascii	"\324\037$\013Z\230\223\365Y\335\262A\324\023c\322\244\253\270"
+	.ascii	"\257\210,+\312Lp\365\023\242\213z:\264\306\"\346\026_\306 \215"
+	.ascii	".^\335H\307\241J\3320\202\357\221\260\330\265\bO\334\013d\225"
+	.ascii	"\363\345\t-:[\212\302 \304\263\240<\346\030\262\372!\323\231"
+	.ascii	"\343L/Pn;\254\274Y\021\023\243I?\250L\204Fh\205P\303+\342=\334"
+	.ascii	"\336y#Z\337`.'MJD7`\247\210yrG^=]\210\340P\nXy*\354\0206;\354"
+	.ascii	"v\024]\355\002\022\2427\344\3006\263\322\364\343o\032\220\004"
+	.ascii	"\005\256\024ma\312\035\270x\347NK\300\213~Ja"
+	.string	"]\336\326\332.d\335]\305\354\317\305\245\f\240-\372\2143\323`\\\n/\241\252\005\224\340Y\347\016\266;\023\024\334\001k\237KTqeu\315\225\270\202\332\365\335$s[\275\202i\222vu\302\222\210@h\252\315\030\b\314*\006\205wb9\310\334`\272\314\314\r\354\211B\230\310^!\f\277\267\2168\3249\363H\203\322\323\366Ot\021\233w`\374b\013\177\376\214\244\035y\007\325\375\316*@g\2477\357\021\210\206o{\254\002\022G\226\327\210v\317\251\332\322x\377\307\334\004\334\263QNr\0029\326!c\304<,\013Z\361\357\3447\3006\001Y\3407\003\030\t&\221\323\213\021hb\207\300H\237\225\375\274\322]\213H/\254]8\367\243FcR\312\310j\324\305\324!\310e\215u\316#^\310,\336\265\310\322\347\306\355\335\213\374\017@\205e*\326\225\377\306\356\033\030\200\330\033\254NIk\262\027*\373\257"
+	.string	"{\334"
+	.ascii	" \331kQ\200\374\177x\222H\200\024\301\373\237l\032,\n\270\004"
+	.ascii	"7\206\225:\001\006S\341\375f\227\221\242\n\317\364.=\025\203"
+	.ascii	"m\312xW\003\231^(\340\242\\\247I\030\177\271\367\306\001\232"
+	.ascii	"\301\024\265G\367\372\344\031\225\255\303\240\0279\320G\201\266"
+	.ascii	"Z\306=\005\271\003o%\256\235\222#\304;\020\231WBb\304h\241\022"
+	.ascii	"\335\272f\241-Q*\3103\205\003T\313\370\371aV/\262\244\031\031"
+	.ascii	"@\233\013\b\374\007\335W\n\200\346d\251\325^(~\r\335,*Z D\246"
+	.ascii	"d&&\332\004\273\260\\\203U\023D\220\270Z\006\277\330@\200D\251"
+	.ascii	"\t\024\213\325e.\\Y\364\275InT\327C7\250\336P\034\033\316-\356"
+	.ascii	"\007O\234\3312\377\004\346\355\035\371\223\275-M\342$O\210%\371"
+	.ascii	"`!:j<>T\001\234\356P\2320\275\200r\354\032+\315\310\031\223\303"
+	.ascii	"1\225\243R-\007\342\"L\364\265\340\206\271\\\310\366\331\023"
+	.ascii	"\230\200\347\315\261U\376\347\035l\266R\374mf\324B\366\277\356"
+	.ascii	"\264Y\205`\236&~dC\231\223-\352O\331\365\200]|EbD\375W\342\302"
+	.ascii	"\316\255\343@=\3009m2 \343;\337\247\034\362\211\226\354\351\210"
+	.ascii	"\303\351qkX\206\\\266\036\213Tq6\017\343\367u\261{\230d\377a"
+	.ascii	"\253\305G\025Gl\337-\335^B\237\204_\246\276\346\344\271>\"\326"
+	.ascii	"\273|7\006\343\273\375\302\245\373K\236\352\351\254 :\250\315"
+	.ascii	"/\321\177J]56w}\004\360f})\376\312\274Y\263D\360\375w\221\362"
+	.ascii	"$\221\276\233+B\177\027t\245\320#\366&\244\271\347\375p7\307"
+	.ascii	"\376vg\3057\365[:\214\357\244\273\354\037\242\247\226\\\326\340"
+	.ascii	"-:R\275Z(+\222\316\323\366\b\303\233\302\220\306=s\325N\245\037"
+	.ascii	"\344;\006\203\227*\310\305\350\032\304W\032\340d\375\001\340"
+	.ascii	"\203\317\310\177\230\252\207|\007\325\007q\3638cu+"
+	.text
+	.section	.gnu.lto_.symtab.1c9af0ce630b5f18,"e",@progbits
+	.string	"currentMeterVirtualState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"currentMeterADCState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"currentSensorADCConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1c9af0ce630b5f18,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
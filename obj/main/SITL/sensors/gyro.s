@@ -0,0 +1,2053 @@
+	.file	"gyro.c"
+	.section	.gnu.lto_.profile.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\021"
+	.string	"&"
+	.string	"'"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\335\004%\025"
+	.string	"\346YdI\340\224(\035\220\263\0268\315\257\314\3300M\325Ku\347\351.\333\307j\2479y8\342\362C\253~\2749\267\356\301$\260\0163\3140\303\f3\3140\303\032\"t'\035\307J\232\211f\033!\255\345\266d\023\"7\331{'\262\003H"
+	.string	"N"
+	.string	"S"
+	.string	"H\312\331\307\303o\357\264\361\373\370\237\177\247\024s\367>\337\275\237Bmh\300\221\241\353\313\365\033dkGT\034l\245\336\312I\226\342\376\236;g_\237\271\030\261 ,\266\355\237t\316\177\373<J\317`\20113O\246\205\005\266\346[\243\351\321\032y\377\305\367=\351\224(Q\b\222\200q\2211\236\254\035~\304\214\210_M\342\201\207J\210\037\376\235z\331\301\n\341\037\267\314\312\n\007\364\320\r\201No\017\376B]\311rl"
+	.ascii	"\363s~\375\355\375\210]\364\300fr\303\002\336O\251=\206k\343"
+	.ascii	"R\3419`\275\020\252\230\023\006\376\361\230b>\024\270\2778W\021"
+	.ascii	"Mn\\\b\210o\016|\021k\3212\340\225\346\242)\"\240n\263\232\n"
+	.ascii	"\032\001&\0073{\351\001\360\234\222\261V\344\370\361\242\221"
+	.ascii	"x\361\242\367\370\277DkL\020Q\221\354k\023\277\312\327\n\224"
+	.ascii	"\223\252d\007\005\023\013\375\356\3164dG\247\302\fm\212%\347"
+	.ascii	"\206\302\354P5&\233\t\026\0042\342\345CB\004\333r\303\225\003"
+	.ascii	"\201~\264S\013\347\201\003\222Z2\245\242d@,i@\236\236<\351\225"
+	.ascii	"\226,\035"
+	.string	"\255R\375^\242\006M\b\203\005\n\022 \350w\200\223\250\241I\031\t\250\024\246\240\311p\220\002*\242!7\022\340D*\312\035AEAAII\215\322\316\032\004(%$\376\225\361\023A\b4\222e|\\\241\204C\024M\313\232\363\300\216\354\201.+\332\340b\017R\374\374\331\373\340\330\363\254\332W\303Z\235H\020\251\264\372\262sQ\312\022\005\\\322\221{i?\020\373&\002bB\323\013#xz\252],\225\211myJT\322\2607\213G9\032\f=L\342\223\2753\307\n\031\r\233\247\031Y\300\211f\246\"nY\306+\314Lc\362\3138L#\343Z\200\326\245{Q>\274(~'\343\017\b;\17782\207\373qw\317\235(j\246/\364\330\001\007g\232z\337\002`\311\274\223$h2\b\343\016\021<\210\277]CBPs\360\207\264\025\352\006\037W\002\356\266\3058\237\261f\326\340\217\356\021lKY\317\220"
+	.ascii	"\302+B\250\221\001\2116\207\326\250\357\275\027\205\2707\231"
+	.ascii	"\r.X\363\3024)\340\222\307\205<"
+	.text
+	.section	.gnu.lto_.ipa_sra.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\025\006"
+	.string	"2\007\026\034`W\241\0030LmQ\024EQ\024]\352\3073\354\032C\251\217\331\311\021\211\334)\005\256\372\247<\035\316\334L\315\314,fw\261\354S&:%G\312\tY \222\216\006\022\324T\377\230\216i6\234\241G\213u_\257\250\023\210Ci\004z\303\244\002\341\032"
+	.string	"\336\212\207\0022 p\002r\352\354$\3408\232\213\265\223\2309\016\nA9/\306\327\221\310"
+	.ascii	"\247!&\203F\346\020\202+\354c\230\216\353\242v\003V\2219e\254"
+	.ascii	"B\033f\373\340F\241\005\220\201\201\207\tky\007%\335^\020\r\303"
+	.ascii	"\315\360\n\355\272U\330\250\203\003\227A\266q1\030\362\003\200"
+	.ascii	"\016\006\372\300\206\026\0163i\032|[1\335"
+	.text
+	.section	.gnu.lto_.inline.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`&\tM#"
+	.string	"f\360\241H\260\230M\032\003\360\261fC;t3\322>y\b)\030\374!\350\264\315t8t\013Vdo\353)\262\023\223\310\317\326\356"
+	.string	"0\323\335b\343gg\002\017\337\f\372\b'\024\333}\272\333\271:m\035\211\336\351hF\354\336r\247\210"
+	.string	"\210"
+	.string	"\223"
+	.string	"=J\265\2738\262\031"
+	.string	"=\207\350\034\"\315!\222I"
+	.string	":\327\231AQ\230H\261$\237O\035\311\004\2254\205\366\f\237\033\364p\235\336pR\305i\006\215\020\201D\373\036\251\003\211J\027\016\340_\323\030?\362\2105\375\211\177\274"
+	.ascii	"\326\024(\312\245\217bI\031\232Z\311/*\216~XJu\364\303\232\331"
+	.ascii	"\265\323\335]\360{:\265\273\t\364eO\246\330\335\231\243\256="
+	.ascii	"Ydwq\337\223D\273[\243\037w\244\215\335\275"
+	.string	"y\234c\265\257\223\022\346\265\362\333\313\312m\340\225\374\006\323\222\333@\237\374\006\273\222\3334\376Z\356\020x@\224L\277\254\034\005`\374\262p\310L\233'wGv\f\214\353\t\002\374\335\234r\3457\032W%VER\263a~\235\341:5\250U\221\224/\016\333\265\302V\337\356\276^'\202\323V^\263\321\3701Y\344\321\002h\243@\313#O\262`\362B\n\354\320G}X\266\242b\222\217\254\321\302\305\323Y2\001\361e\262G\217vwBQ\221G\203h\235\330\252m[HY4U9\311\b\205\337\3743\036y\2726;\352\273\252\365\344R\215\220\025NS3\035\"a$#6\215\2563W\2143\027\007\211tu\003I4\352\2405\214\224\226\314\345\231mL\032\013\242\342\221\024{b\345\351W\373QB\311I\3152\177\200y\016\321ax\250\243\272\256\356\232\313y\370W\215\306\217\261G\304)\320\323\254<b"
+	.string	"q\372\023\243\342K\210\352J\023\332\004\242/n\\\n\024\"\344ra([\247\303\346:\345K\377\317u\262\251\252)I\254\252\251\212\306\200\245\335\240\230!\\\033:\006\230\273\020\261\036Y-\266THBz\332\222\360\003\236\306n\260\035\354$N%On\003\006\013\376\235T"
+	.string	"\343\332\021B7q\364\203\362\021\331\022\202\370\3749q|\361\370A\n\314)\320\252\004uDD\366\201\031\273[\200G\241\354.\315\006\226C\264hU\351\n\037@\264T\211P\347b\216\354n8NWk\027D\354\333\257\223Q\224\254\212`\207\357\244\021\251\0353`<\212\342E\f\251\333\374\237\200\336\250Q9S\250dF\223\242\224\032\003P\2421DU\347\001\022"
+	.ascii	"E5\007\303\220\020\321\214\026\326(\355\354\033\230\301\311\217"
+	.ascii	"\025\355\316\351\302\212\330\333\03293i\t\226\332jL\254\313\f"
+	.ascii	"\n\354 \360\235\360\247\271]\205\377O\276\t\225(nY\350\031\312"
+	.ascii	"P\323a\003\227h\366\004\355t\256\271\274\220Wl\323)\223\023\031"
+	.ascii	"}\033"
+	.string	"\360\240\2478\fKD\367\247\211\374zB,\371\343\375\310\356\264\\\337+C*\331N>\360\034|\255\007\257\212\330\223:\233=\022L>\262tT\327\304R\311\256\215\005\301b\210\364G6H\021\260\240f\373\320\037\212\307\275\177\fp\2615\027\376\027\032\301\215\324\317Aj\220+\307\265\0026\\\200\222\f>m\001\362\367SD\251\370\025\375\352\246]\231\363\3321m\240)*\201\270\f\235\335\273\245\207 \207\321\303\320\226\007\200\310v#\344nJ\376'z@\260m0t\216\bg4+O\345\243\326\030\0278\203\316a\017\307\177\006\242\350(Y)\247\255\377WT\021J\031\350e\325U\001\330\3650\345\021\276\265+\001\2619kdH\341\227h\f\250\003+\314\227\303Y\225\037\342\243\304.fIG\335qh\262Ul\365\316\321\026\267\016xBQ\330P\340\302\017F~\351\201J\n\367#y\321t?o\234\204D\235u"
+	.ascii	"%\313\203\202\205\005\027gy\003\375\027@\233\360I\230vG\034F"
+	.ascii	"\\h\215\257\t\033\223\021Y\205\314\236\360\342\276\331\363\021"
+	.ascii	"\002\027\374\340\334\237\350+\227\374\320\360\3423D$\325\310"
+	.ascii	"/\236O\227\3439\341\341(\227\276~BA~\200O\275\261\225P^\3423"
+	.ascii	"b!_3\n/\005\213\204\323\326\365\021\223\315\362\246\r\356\364"
+	.ascii	"w4\231\002Ly\271\224\357\374?\f\322\346\035\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\214\005\265\017"
+	.string	"&\024B;0\247(\351\311\210\b\026\373t\341\005\344\377\362\325\373^\234\267\210\250\342\207\202\002\254\372\220\"PKCA!\304\266a1\370%\341Y"
+	.string	"\275z\350*\350\252"
+	.string	"\231\0326\222O\310\226)."
+	.string	"6"
+	.string	"2"
+	.string	"_\315=C\021\264\007\352\262\243\327\216\036\366DwzD\f\246Y\340!\376u\247\336\246\201\207\250\301\2540+-&P>-fk\247\370\225\002\326\303^!\266\026\342\367z\203\207\224\003\352\335\254\016\263`\242\020L\224{\370/\n"
+	.string	"\022\313"
+	.ascii	"_-#\300\241\225>\372\024~:\254\032*K\205\004r\016H,\t\004\241"
+	.ascii	".H\221=>G\022K\222\257R\032\276\304g\252\240YC\256dY\226\265"
+	.ascii	"\326k\202b[\312R2hP6T\264\230$\226'_\355E\264\017j\275\033w0"
+	.ascii	"[\273A\"=\r\216\250\023z\320g<\206'\377\242\235:F\016\314\346"
+	.ascii	"j\341*\376\203\210\255gJT\006w~\316\306\372'.xk7N\023f\250\021"
+	.ascii	"Q\246H\204fS\220\302r\220\002\021\242*;\022\340\2209\212ei\034"
+	.ascii	"\263J D\"\"1\024\304\244\240\222a\016@\036:\245\245\031\361o"
+	.ascii	"\013\021\301R\237\356p\300\rz\267V\233!c\232\327\210\311\272"
+	.ascii	"4\230\242\017}\330b\367\210p\275\016\265\312%Z\271\336x\306s"
+	.ascii	"DE\005-%\230\273\376|\306\364\025]\346(\375\314\330\221\367g"
+	.ascii	"\201\341u\005X\033\004\300z\202;X\271\253\217Yv\274\355\267\210"
+	.ascii	"\204\034k\022U\006\336(\006\376Im\301,h\354\3325\221\026\310"
+	.ascii	"\344q\213\306\013\f\023\234\023\275\217\211\200\340f\002\334"
+	.ascii	"f\253\026\021\246\222:\221\215\272\354\331\253\005\321\216\356"
+	.ascii	"\313\300\fL\001\343,b\270\b\240\254\202\360\275\004pDC\225!\346"
+	.ascii	"\362\352\f\210\227\302\244+\246:T\211_\336\2449Z\243\216\236"
+	.ascii	"\254\267\246CBj\f"
+	.text
+	.section	.gnu.lto_.pureconst.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375 h\325\002"
+	.string	"\202\206\025\036`m\322\001yY\300\024\202\320$I\222d}%\350\021G\310\320\021b\254\255\005G\036\276\355\367r-g*\037\345\233|\222/r!\367q:.\343.>\305\231x!^\207\323p\013/\3028\030\005c\340\004\334\352R\343tJct\241\363\271\316mNk\230\031&"
+	.text
+	.section	.gnu.lto_.ipa_modref.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`3\003}\016"
+	.string	"V\32392\200\265\311p3"
+	.string	"1\242\237\302\200X\233\024\207\\\315\250\314\033\332\241\021m\f\362\211\020\361\321\372\243\345\233\020i\302nD\304n\270\255!\264d\315\022)S'"
+	.string	"+"
+	.string	"1"
+	.string	"\215\255\361\232\367\250\214\365\035\2303\326\213\231\271c\317\033\357Z3\232\346\346\277\3067w\276\250sU\356@\300\335\354\031S\214\312\003\324\271\b\007\3205\316\361\034\344I\355T\273#\301-\230S\371\304h\f\225C\244\224S:\245r\253\375+\225f0\305\334\002\016K\2760r\203T\006\347\272\256$\345\227:\013?\222T\2521M\324*@\346\343\367s\256I\202\201\001\252\220k2\366\330@\214\r\333\b\323*\017\376[\225E\240@\365L\213\212\377y\244\230\220x\313\214\"\206xg\347\341\267\360\237(\375"
+	.ascii	"\001\345U'\305H\322I\343\021\372\1776\fr\250AE\310\214&\251\221"
+	.ascii	"a\fP\0021\n\241u\022\240f)\346\231\224AI\356\377\006\245Y\177"
+	.ascii	"\303\371\225\372\037S:\024\225x\316U\364\363D\rR\330x\025\237"
+	.ascii	"(o\3578\016\314\217v\267}\007\030#lL\350\230\022\221\020\006"
+	.ascii	"\320\357m*z\2256+p\352C\001E3\262\375\007\356}\260\210J\243\222"
+	.ascii	"\310:oT(\206_\037z\215\346\357pw\f\246b\335\013\244\233$s\\\304"
+	.ascii	"\304<\367\3207u\202}3Om\212%c\331M\256\004#\006\3212\210\351"
+	.ascii	"\372\334\322\347\270\243\261G#\2243(Ow\212\21372\320\211k\310"
+	.ascii	"\367\203\340\205N\232\261\267\326\230\013\310\305\356\237qH\305"
+	.ascii	">\262\223<\252\003E\313\211\205\037\320\375P\255\322\276\366"
+	.ascii	"\372\0323\270\264|j2\320@\001\"q8\362\003>\250\226\250-\362\203"
+	.ascii	">"
+	.text
+	.section	.gnu.lto_.lto.ad6300dd37246489,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.64.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375 \237\235\004"
+	.string	"D\bk"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\203\346\321\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\335\006us\366\005uq"
+	.string	"\005\001\006'\001*\005\001\006\035\001'\001\212\240\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.string	"\004"
+	.ascii	"\236\n\013f\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_gyroConfig.65.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\271\003E\021"
+	.string	"\206\333gH\340\224(\035\355\253\025\215\n\340\022\026\024\314\t&U\n\266\002\274\274\256\272"
+	.string	"\033\201&s\261p\276\265\232\206z?4\203  \f\204h\346\357_\214\017\213\215\347\3404\b\001DJ\204\0039bl:\234\246\332O\b!;\245K"
+	.string	"Q"
+	.string	"Y"
+	.string	"4\026#\333\247\366a\177\241z\f\313\005\354\276ljvc\n\234 \364\317\261\023"
+	.string	"\377\205>"
+	.string	"\374g\225\275\363\230\212\275\214\033\022\263\272\273a\227\342\252S\225\177\030\027\271\260ZNA\017v\327\324\205\005sw\267\215\3006\003\333K\t&\253v\032\267\305\327\250\366p\032Q\013\236s\301K\320&?+\003\270v\352\355&h\203x\f3\264\273\r|Y\b\021%:+\376\371,\340?R\211\236\026\254\266\2429;\326B;\024\366\275\355^\366c~j"
+	.string	"e\253\317\001\037\273/9\333\342|\001\025\316So\334\266\360!&m\306Y\322B\271\020\222,W\201\334\276p\235\334I\002\355\224\007!\261p\225b\370\017\\\206\343\334\252\206\367\310\271\335\334V9\017s\344\262\225n\223c;M\327Q:x\201\265`\247\347"
+	.string	"\371\030A\202:\315\365S9\274F$\3739O\263r\033\001'\324\206\224x\002\300%\023q4O!9\212d\312D\206)\224\312JX\032\311\320\244\200\305\016\2461\374 \212c8\212\355\275\355^\036\216=\322\263\352F\234\320-A.f*\204\343V3\347MDx\022\031W\t\257&\210&s\206&\274H9\202\231Uo\007\205\0231O\314\272ZG\2501 \013\305&\020\013\3127\351"
+	.ascii	"\003\021\251\332\034\021`P\251DF\3421\254\016\030D\235\263\336"
+	.ascii	"-W\206\224\310\310\221<t\366\340\272\267\321\220\035\275t\340"
+	.ascii	"\272*\325\304DN\3206\252\"{\331P\376\316\\\216\232\264\340\021"
+	.ascii	"<&\223q\252GM<T\214/\346\347\fKD\277\2064\350\215\200E\227\342"
+	.ascii	"3!cl\022\316\234\212\027\374K\005\272\324+;\213\036od\351\206"
+	.ascii	"AMX\243\006\200\346\252\202\334\277\320\216\032"
+	.text
+	.section	.gnu.lto_isGyroSensorCalibrationComplete.66.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\r\t"
+	.string	"F\221?:0\345(\035\200\213'\271\374\206L\302\314X\214&v\2058y\356J\212f\223\376Y\333\353\037\2025\356\032VS\373\b*\244P\026X\214\3072\233\247U\013\311\233\211%\233\354\235R."
+	.string	"/"
+	.string	"."
+	.string	"\266\031\034F&\275k\2552\262\220\224\n\200\335NB\220\223\376H\376O\036c\"-*V\351/\003\261\273~*V\307\ro\033\301v\203mY\217\232\330\213\002\313\356j\026`]\"\214\304\366\310\336\330~\317~\311MFw\211\n\002\026\365\342X\331\355\026\234\300=\272\373\300\366\310]`{t'\317\277B\034\030\273>\005\203\333E=\240hd\020\264F\036}\321\366x\310\211q\231\336\314\356J\017~\330\327vw\r=\254\335\365C\370\034tV\320'BcOg\322\215\tY\351\254\240O\225 \n\211\n\351\241Uv\f<->T^\314I\345\246\333[\203\007&x\262\037\332\0165\270\311R\260\f"
+	.ascii	"X\211\"34\030q\r\307\2622\343b>\306t\324\263\214\313(\233\206"
+	.ascii	"Cu\bc\272&\031"
+	.text
+	.section	.gnu.lto_gyroIsCalibrationComplete.67.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\201\002\375\022"
+	.string	"6#yG\340\320(\035\372?\220N\313\261\322\276\263\nj\030Ra\344\212\003i\370F\310\002\357\270\002\326\"\212\307\326H\311X\177z\336\256\356\372I\036\246>\316aN1\244\304\320\021D\3670\003\0059\341\354\262\326\b!{K\231Re"
+	.string	"_"
+	.string	"i"
+	.ascii	"\337\350B5\"\272\316g+\317\261\334A\201\233s\232.\355\025\333"
+	.ascii	"t\2716\213mr\001\003,n=\244\201\361\2162\274\320ps\206\340^h"
+	.ascii	"i\353\235\214\253-\277\024s\275\373d.Ad\300b2\217\307y\307\216"
+	.ascii	"\021\317\212ZL\346\013\301\245\343\250\261a(\305^\253\336i"
+	.string	"\316i\205\305bn\357\266\025\330\376\260\365(>\207\3734\360m.\315R\321\303T\272\313oL\321\206Y\213\346\354\360\245+\263\277\271\\.\206\327\202mu)\252IV\177Q\355Y\035\337s\257\325\272\352\003\030\271\301\275\370\310\315\t\223\2331S\310 \r\357\271\375\034\237\366\235\363\260\274\307\266\317%\341\373\241\325\\\\\332\343\273$p\216\3562\006\277\254\205\207\2702T\347\355\267\335\321K\320+4\311\205P\035,B\247n+\t@3\247\213\310\210\22309\t\277\240\273\364\366\341\365g\202\315\214\316k\367\311\2454^c\253\021\332\225\371!|\021\276\251\n\"\375\340\203\360MQP\370\007t\227\377\261}\333\230\"\334\234\256\317\334\0246=L\025\\\264\206m\224wP}sN\221'w*D\265z`\002\262V*VJ\t\013L9A\241\200\251\025\013\f\021`\025\203\222\025\350@\245Z\201\246\260\345qF\251\213"
+	.ascii	"F,\221n\206f\373mt\\\237Z\366\025\273\225\371\264\037\240\325"
+	.ascii	"^\200\024\344\273\021\354\r\265G\022\350a\272\307\371\351\265"
+	.ascii	".\037\350reC'mif\222\027\315\234\372\211\0227\261>\244\375,4"
+	.ascii	" \220\202\031*\253\007S$\324a\212 !\301\207\005O\017\246\220"
+	.ascii	"ca\303\352\206h\253q\320n-\321\031#\211\335\004o`1\321\311\337"
+	.ascii	"L\312\"\250\251\231\225u\354\024\b\240m\361X\221\354\321\\\f"
+	.ascii	",\335/@\367\365B+\333Z\330v`\233\236\227\324~\341\007\255Y\330"
+	.ascii	"0zk\262\313u\202\335\216\233#C\231\244\220\346\004\266w\n]\324"
+	.ascii	"\220\367\214g{v\254s;\031"
+	.text
+	.section	.gnu.lto_gyroStartCalibration.72.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\241\004e\036"
+	.string	"\246\266\300I\240\024R:\002\301\252\321\023(\257\270w\202\275\241p\225\327\277C\343&\205\326\024\347\224\341\03769\274\360x\275=\247\353\243\346\317[\264_\210\223\363,\374Z\354\244\005\354\027\357\253y\023\316\315\023\2206\263\366\177#\204\310\235R\255"
+	.string	"\240"
+	.string	"\262"
+	.ascii	"\001N\024\366\217\235\273\371\034\265i \004\275\nH\300\263\234"
+	.ascii	"U)\251\365\350\300\013l7\035d\233\375\370T\257\325\242(\353\254"
+	.ascii	"\326\332['\323\227\307\373F\203\256\313\341n\266\332i\226K\203"
+	.ascii	"|\034Q\350\272\342sbH\305\030\024W\316\344\230\332q1$\030%\203"
+	.ascii	"\260\256\257c\251\240\267\232\r\216\244\027\267!\250\321PmUm"
+	.ascii	"\251\221\304\364\263\244\341\"z\275\020\213\312\035\017\263\251"
+	.ascii	"'\211\250Y2hj\342b&\212\215\262[\035\301\024R\221\226\027\276"
+	.ascii	"\370\276\020\207\345\201Z\353\255N\217\210C\224\326lj\255\246"
+	.ascii	"F\304\244{w\333f\266o\354\222DF(&!M\273\307\306\220Be\311\273"
+	.ascii	"K\312;\335#\337G\241?\007\230\322\212]\243\201\316sou\031 c4"
+	.ascii	"\262H\2612D\271\330\307!]\243\375wu\021\t\2757dj\32415j\230\032"
+	.ascii	"\365\013\245\336Qj\335I\2353\251q\267W\375\347\036y\323S\177"
+	.ascii	"\206\200TS\321\211i\311\216\265E\032Z\205b\036\321q\344o\337"
+	.ascii	"\377\361\255\237kYDQ\252\251\252\326\372\343\223F\361,\257\322"
+	.ascii	"\027U\255\365W>\326\201<H\320\221\016\263\t!\331\264\264d\\\251"
+	.ascii	"\265\362nz\202\355\346\201\317\2347\313\007^Hw\330\251\333\335"
+	.ascii	"\236N\210\246\2064\315\271\325\355\213\272|\313\024\376\304\202"
+	.ascii	"\255\326\241\032\277\311\235\\\300\220\201\336(\303"
+	.string	"y3\267\337:\355\261$\325duEY\210\371\300R\343\375Ik8\223\r\t8|I\007^q\206\222$HvJXTZ\2044\315Z\\SE\347\032\r\340\037N\334\216@V\031\242\\\374\244=\034\354C\201\247\244A\374H\b\336\022\232\235\342FD@x\252\265F\300y\221\034\r\305\263\032\257\177\351\370Q7\275\343+q\336\304m\325\022Z\223\325\225\220\246-\r\213*\333b\256Q\310\2777\037r\"@~\224y~\364F\277\363\346\037\276\367\374|>8\300\021>\02387;=>\036\240\004\237 \320W!\350\023\340\234\007?\340\317N/\b\374\005{t\202\275\036\037\016O/\007\030\354=\030\340\337\t\035`\317\347\367\003\366rG\341\367\206m#\334\241n\215\006:\313r6\302\250\2648\fJ\bV\2162\311pB\342\326h&\266\333\272\\\272\273G\266Mw\177\205\374_\326Z\353\255\301wo{\254+"
+	.ascii	"\363B\222%\233l2[eC\001*\035\f\024\245\310\306\246<y\036XrH\306"
+	.ascii	"\205%fe`\366ec\2666\205\310\307P\302\245\334\330j\2555~\224\213"
+	.ascii	"\371\316\2330\373,\250\253\335\2768Z\250Q0\242\214U\004!\222"
+	.ascii	"\221\t#\251:`\002!SX;\020`h\232\024\322\030b\244:s\032\3362\035"
+	.ascii	",#8\331\242\234c@X@\fn$\351\306/\\\214\317\372<\326$\331\320"
+	.ascii	"\323\254\315\035\003I\324b\241\206\333\332\363\376\244\211\022"
+	.ascii	"K\006\274\004\275\3710M\376\214h\006>!I\252?\"\376\237\204\267"
+	.ascii	"\360\364\341\2567$\345/N\242\006\"\242\311\345\006\teY\274\330"
+	.ascii	"f\3632Z\220\342\037b}\257\316\233,\020`\031r\350_Z\030\354\316"
+	.ascii	"fX\374\342v\320\272\177TC\332\313\372\361\004\026Q\225&\226\326"
+	.ascii	"\320\347\024\240\fCP\364\246\210\320F`\205\023\310\016}\201n"
+	.ascii	"*|\361\357#Io\203\215\210o\243\252\n"
+	.text
+	.section	.gnu.lto_isFirstArmingGyroCalibrationRunning.73.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\325\t"
+	.string	"FSB6P\215\322\001\007\274\214\272)\013"
+	.string	"\302\253\b?\0320\250\252\243X\001l\374\254\367\266\021dO\017FV\372G\237'f&\326\n\034\034x\330#\265\336\264F6\2212\2452"
+	.string	"3"
+	.string	"0"
+	.string	"\230\252\316=Z\232\234o\341D\215\025\210\367u\217\027\211[\230\217\004\221\232\371H\226fw\277z\232\276Q\246\205\263\273N\357\213\270\257\333>\260\035`\377\022\327\214\305\204(C\033\354RS\366\255U\224\355t\314\264\246\177eLH\f\302\335S\250\262#1$\303v\310\306\230\240 d\356`\305\351*\214\322\007\312.\030QS\376\325RT\307\323\222\366\346\220\367R/B1\322\356\271\273\235j\3126w]\363\304\243\204\224)\3667\316\301\371\027~"
+	.string	"\345\275G\037t=\006\356l2\r\224\200mZ\266}<\033\366Q@X\300:\332\206m"
+	.string	"\2341x4\254!\3134\f\003\356\025\345\264\004\236:pU\223\355\250\032\221\216\254\032\365\245\025Q\206W\022"
+	.string	"K\b\230P\307\353C\231\251\302"
+	.ascii	"c\240ZA\210\230gC\320\256\211n\b*?\0010\226\205k\017+|\252\032"
+	.ascii	"\262rGK\216\255-e"
+	.text
+	.section	.gnu.lto_performGyroCalibration.74.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\210\016\375H"
+	.ascii	"\232{0\033;0\244N\007\231\211\264\016M\367lZ\303\307\33601\360"
+	.ascii	"\"\222\223S\bIm7\342\352\360\245\036\273\253\026\340\366\373"
+	.ascii	"\321\337\203S~\352\305\377\344S\251\252\326Q\330D\204\354\275"
+	.ascii	"SJ)\246\001\201\001\241\001`}\207W'\220\354\300\230\231x\356"
+	.ascii	"\360\004A\223\030\377\270\355\f\372\240*\333k\345\302\362\364"
+	.ascii	"\3401\302H\316\351:@\232\016\343`;l\303\003\354@\026\003\244"
+	.ascii	"G\214\031\b33\316\037\377 \242f\303\r\207\333M\373\335~\303w"
+	.ascii	"\222c\322\244\237_\336b\333\266\fz\345\026\311^\251\324~b\371"
+	.ascii	"\272OH\263\341\177\322g\327\266-\263Wf!\314\314^W\2463C\230p"
+	.ascii	"{\257H;\333\250 &\022\332\231\033\257\363n\353\031\351g\333\276"
+	.ascii	")\322i\333\275\006\254 \331+\357u\024\333k\262\237\330^\3712"
+	.ascii	"'\352\275\270\026\tw\207\326\206\261m[\255\207\343ou\257\331"
+	.ascii	"\311o\003\230\222\212\202zrz:\233\232LK\314\2452\211dW\365\375"
+	.ascii	"r/\327\306\032\300\324\\K\315\205\361(:)\2300\016e(\235[#\347"
+	.ascii	"O\252\363\213\352\240m\333\250;!\271\2704\361\322\317.\355T\037"
+	.ascii	"\004b\241\324M1\200\242M'\215\363&$\227*\250\227h\327M&\bvo\360"
+	.ascii	"\032\2654i\353%\025\302\337\032`\033J\257\250Lf\022\3215\241"
+	.ascii	"\025g\252[yv]\236\215_\236\246\223V\361\245\241\324M\245j\333"
+	.ascii	"\226NJ\305\225\007\2644\231\322IuA[\237'Q\205[\0165\235T\212"
+	.ascii	"#\325+I\213\202m(\235\242N\231\251\205a\256\2419\333v\372\200"
+	.ascii	"\241\264K\303iO\262v\346+\224V\325\bf\214V\232kf\352\222$\264"
+	.ascii	"C\346Z\231\177\303\351\025.o\221\226&^\332\221\\m\333\262\247"
+	.ascii	"\2555i\016\320\314=\207\231e03\245\biQ\002\231\331\0210\263\212"
+	.ascii	">\304\201Xqm\333Z`\276f\332\320\255\263\212\273hZ\361\336\025"
+	.ascii	"\272z7o*Q\316\b\333+\263\321\241\035#\317\351\023F\217\372S\276"
+	.ascii	"\360\007\276\341\364\263PQa#A\205\312\\\022[\370\013\025\336"
+	.ascii	"\352-<r\320Y\232\350U\323\210\035\222m\333R\340\036\324\204>"
+	.ascii	"\204\0301\202\355\265\302w\233.zXo\305\200\322\346;\354\203\307"
+	.ascii	"z\326\317\031]\324\0379\302?\370F\253T\207\273\332\320D\240."
+	.ascii	"<\301)Vx\247\255`{\215\360]\247\035\r\233\230\016d\257\376\323"
+	.ascii	"\"\331\266e\024\270\375\\=\027\334r\275\272]\277`{=\360\035\330"
+	.ascii	"~\307v\330\226\247G\346\217\337\266\355\330\377\224y/\352\377"
+	.ascii	"\306\334M\266\366\327\306\377V\342\235\273\234\316$\234\316#"
+	.ascii	"\234\316\"\3369\304;\203x:\177xg\017N\347\016Ng.\2473\207w\336"
+	.ascii	"\360\316\032\236\316[N\316\031\336\031\303;_p:[p:W\240\260t\226"
+	.ascii	"\360t\216\360\316\017z\257\333A\0176g\2753\226"
+	.string	"\323\331\352\235\017\264^7U\277i\236zg\251w\216r:C59?5\235\235\226\316\317\245\263\223\351\334\264tn.\235\231\226\316KKg\346;/\231\316J&\347\344\2223R\351\314.\235\327\245\263\312t\376\245\263+\235\033\205*G\n\034\336#\356\265j\217\223\332@\253\340\\\017v\277\341\263\207cX\021\243\247\t\003n\242\210\177\214:\274\007\256\347\360\035\256\032\237\372\033\327\206\347 \2505\374\206\255\327\300\207\273\\\213g\331\372\346\323z\250<b\372i\023\262\227\273A\035\253\332\356\235\223>;G\027\346\274,\375\224\235\032\372\310fx\032|\204\f\245\344U\240\217\005\b\371N\235\312\205\213J\314\360M\330\216\307\346k\177n\314g\376{\341\353\263|\346\367\331\242\203_>rP[%b\223[\376\224\213\260\016\376\312m\216O\261\314%)\225Y\316v\257hHd\207\342Q\356\030\337\35053c\223\257|"
+	.ascii	"s\320*my\026\222\233\204\355\264\344\263S\260\224\375X+\327\344"
+	.ascii	"\211&\177\312P]\204E~\237a\227\372Z\021n9\276K\256\232w\332U"
+	.ascii	"c{E\2762\252\250Q\n\231?\016\240Tf\020\371Sf\320S\177\325\346"
+	.ascii	"\310W\301Y'\027\212wZ\326\267\235\356\251Z]\240\262\037c\177"
+	.ascii	"\332-X\f\220\326t\034\366r"
+	.string	"%\030\276\343\264\337E\231\324\226\247'\301\325g\247\334*f\216d\307\222\037\271sY\211\216v\311`%\236\335\273\002\354C\310\363K\213\262\276\227y\364\326U9YT\032#\365\375\327\357\263\266\177\365W?g\213\336\336+\r\350\326\2177K\367%V\332\212\373o\300.\202\2238\320\312\361\326UI\272wQ\376J>\304F\301\365\247\314\2218\020+qKC\272uU\323~t\341\246\230\242\203\030\031\031x?\363\375r\301x\2471U\331\21717\243\035\315\264Ewn\202\2051\275x\311h)\252\352\307\200\027\030A\276l\330\370!\306\212\345\0302C\265\241\003\f\207\330W\030\016\026<\300r\374\230\021F#\207\216\031\037~\360\370\332\361\025\004\354\004\225\327\222kd\201\205\021\271\241%\026\006&\306\343KL\213G\216\031;\264j\204\211ie\t`\260\036_aZ?\300\300\302\264\230{d\375o\314E\366Q,"
+	.ascii	"\244~P\360\336A\335\206:\262Q/\365\r\316\332\242^\036\bu4\020"
+	.ascii	"\007x\357\240\242\036y\350\3278\265\302\273\241\200\n\241\202"
+	.ascii	"\232\202lOuI\360H]\261P\357\225\370\232\036\037\001=\366\025"
+	.ascii	"\373\364P\037\300\017\232\224\023\316\fE\204\026\362N{\372\316"
+	.ascii	"\203%\372cQ5X\247\017\343Sl\343nj@\rA\021A\021\261\275:\375\333"
+	.ascii	"i\203F\212G5t\021\313\fm\004}\264$\350$\200#\2657PK\272\304\367"
+	.ascii	"\232~\262\3212\326\307^\276\246\304w_?\375\224\225\212O\n\377"
+	.ascii	"\212\236\244AO}Cj\325\t\253\247\236\302j\345N\221SJd\246\360"
+	.ascii	"\371|;W\303\201\r\364n]\202\274\013G Q\3027\377\371\354\2353"
+	.ascii	"1\321\336b\210\315^\3332\207\307GGemK\206\300\371\022~\200\237"
+	.ascii	"3\272\246w>\373\b\032\311\323@"
+	.string	"\033\3214}\004'\224\032\365\234\224 \2759\247\376\312\315\020_\241\346\373\231-n\346\326U\225\271pm\322\0301\375\3227\277\317\366t=\323\233\341\233\304\207\350f\221\304w\215x\021O\002\017\335\230\021!^\004\210\017\361\341A\340\341.\237\013\363\341\033\217\034\0076`\342\227[\327r\274lXBp\305\355\260-O\220\343\374\035\242ijz\3708\250c\001\270{\327\324\204\315`0\201%\250q(\345\230SjFDD$I\222\f\007Q\005\304 F%3\017\021P\261C\220\215$Jc>\274\236\213\335\227^\320\375\313\374\023S\245\034\037\327\033\243qz\377\201`!q\366RP\f\217\031\361.\241\205-bMw\t\211\322 \271q\251$e\323]\354\267\345\356\r\301\375b2\026\335\274\007f\036}\301\320\241\372jo\343$\021\346\216\001\266\033\332\357}\030\375\263\272\220\216\221\027\232\304\226'\274>\232\272e"
+	.string	"\356\366j-OQ\035\343>\333X\371\247+/%w\302\354\370\334\222\256\241Z\304\007\016(\016z\243\364RM\021\237\003"
+	.ascii	"r\256\260\324\207\204D\364\231\037=\202/\260z\336\036\257\316"
+	.ascii	"}\f`\215\363&BR0\024\364G\275\004-]\t\032=>\024=\366\341+~\230"
+	.ascii	"\002\345\303\005\"@\352\262\276L\242\307\bF\t>\343$\227\270K"
+	.ascii	"\212\346\237\""
+	.string	"x\0170<\300\302NE\236\254\310\367\bmp\202\n\363\003\004\2538C\236\016\203\263hKM/\203\367`9\024\370H`\003d\3233\035c\274\200~\004\274<\356\241*\244\030\272<i\372(H\360\346\314\347X\227\317\331\331D&\027EZ\027G%;\323\260\216 z4\260;\230\326\310\001|as\227\235\326\"\332\263\233\345w\013\376\032\002\270\260\302\223*\\M\321Ci\374\324\226J\311%HIL\251\360\322a\t\371\r\205<\211KE'Y\334\221IX\322\022BCHq4>\341\220\006\033v\363\243n\212\246$\236\220^\337%\213\333\314\246`\250\323\330\326np\374;v\353\262\317zt\017\224\201w\034!\254\261]aalp/o{,\233{\276\250\321\377\303\224i\t\337\2648*\347\311\305\342\364X\266C"
+	.ascii	"\334\205\303\247\207QD\364\201d\206^\221\022\323\310\217>7LM"
+	.ascii	"4+\237E\211\224\003$\246gq\t\227p\333X\362@G\211!\005\247X\300"
+	.ascii	"\370\017\007\2702\342\260\344\025\033\005\035.\f<\337'\317\223"
+	.ascii	"@\217\374?\b0)D\360\bd\255:\350\007\353\364\036a%\300\016\022"
+	.ascii	"pM\212\353\217\364N'\257\027rO\034\341/\274w0\023\035\027\277"
+	.ascii	"^\246Q\023\322Q\001"
+	.text
+	.section	.gnu.lto_handleOverflow.75.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`Q\003M\027"
+	.string	"\026+\226H\300\030Q:\360\3054\274\301\204\277\343\372\263 \313\"\222XD~\322\375-\346\235\211\020\246Bv>\313w\373\337\2220\321\216\025\323\327\201-\233\034\321\316q\024+\256\371\272\241\n\"ET\027\231\315\2631XB\310\336r'\031\177"
+	.string	"v"
+	.string	"\204"
+	.string	"[\222\370\\<4\263\030B\250t\367\202\327}\360\275\356\356\347\356u\274\326\272P\211-u\273\030\"\352.\033\254\202\357\325\300g\272W\372"
+	.ascii	"\335\353\266v\247\274\004j/Fm\307GRw\207\f\343\255\177^W)\317"
+	.ascii	"\326\336\273)\315h\256\177\336\215w\300\205\212\236wMxz"
+	.string	"d\263\232\230\024\244\305&\003\240\355P\003\335}\333\347\t\032lN\357\246\273w\316h*\276\245\357.\212\335\325\260\3138\001sHF\003\266\035\036do_w;\330\3778\220\324>\350uG\020\363\263\327=\210\356\365\234z\021\324\242&\364\232_vK\330\344\237\335\323f\237\335nnL\235k\272\320\017\363\362\013\326\271\037\235\353\321\271\035\235[\351\\J\3472\235;\351\334\313\234\005OR\225\bY\272S|\341\322G\265H\306\313\177\367{\036\357\261\013\256\316w,\343r8tv\301\327\337\266\340n=Nm@\241R\343\310\217\031\260#y\222\022\373\240=\211b\367\3721\343r9z\266\354\356\352\261\252c\217\337\345En\304\bU\203\204\373\032u\257\235\226\323\312*\312\225\337\245\301\211\354-\001\020\021\252\006\351F\271\344#%G\321\354n\027\363\317\202\314\234\201\207\222\330\334\262\223\231o$Kz-\203\017\355\255"
+	.string	"RwC\330\335\360!(\032\240W!\223=\\\024-E\257\333s\261\356\336\002\261\356\027\2023\310\001\313\301FL\241X\241jL\245\306\323"
+	.ascii	"\221\225\203\303\022W\"\316\210\321\203\006R\024!afUAL\241(\260"
+	.ascii	"T\"I\2068\231\366d3\222:\033\302\0259\256T\342*T\241rR\341\211"
+	.ascii	"\\\2056\004v\374 \222!k\034\311\020,_\247\315>\023\212\034\275"
+	.ascii	"\030\366\301\360\021\204\027\\Z\324Vp\331\355\362\370\307B\267"
+	.ascii	"W\362%\026.`\300\320\275zOrIW:\226\021=\247\213\341\333.\323"
+	.ascii	"\344\206\315\212\023&&\216a\001Xv\274|\f\303&~> \200\002\031"
+	.ascii	"\"\254\016\204Y\260\244\330c\361\270\026-\207\013\225\310\212"
+	.ascii	"gcW\206\001\2076\024u\277\210m\352\263X\221\026\316\004!g\031"
+	.ascii	"`\221K\315N\255\235\201\344)\201\026\267\001\237V\262\016\001"
+	.ascii	"B\335\256\2236\355\225-v4\b\226\301(\025#!\267[V\032\233\375"
+	.ascii	"\321.\246C\330S \003\326L\342\230m\034\310\032*\001\372\303\340"
+	.ascii	"\302\342x\037\226\032F{0\240,2\244K\316O(\305:\202\340\036Ex"
+	.ascii	"\f\263\341nT\237\336.\\\006"
+	.text
+	.section	.gnu.lto_checkForYawSpin.78.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\210\003%\031"
+	.string	"\246l\236H\260XUc\360\024\210\030,\340T#pJY\346\206\260\244\353o\022\021b"
+	.string	"@\031-\026R*EG\327\375\352a\227\233\211\337\320\210\347>\315d\371\273Szfm\200\017\371\r\277\2252\322K\241fh\311\336[n)S\n\204"
+	.string	"\200"
+	.string	"\214"
+	.ascii	"\267\366\006;u\373\224\355S\373A\027\262=\006\216O\367\246\330"
+	.ascii	"at/P\201\017\224\2672\207\031o\305\007\030om\263\243\034\370"
+	.ascii	"\273\344\316\220]px\3575+\213\333~*\311\321\212\225\332|T\217"
+	.ascii	"\303O$MY\200\334\321\221\004\221\216\332+\201(!\312\334{S\275"
+	.ascii	"\016T\034w\234LI\021\242\304\253\210\300WD\304\252\227\023a\222"
+	.ascii	"\250\200r\031\247\036z8JI\232{\257)\257\027\342F\335\266\317"
+	.ascii	"6\313\2568\001\277q\0346>\2173\274\350y\257\361\366\3652\376"
+	.ascii	"\236\241\317\004\211\033m\262\2018Zu\354\213\267\256\260G\352"
+	.ascii	"UI\255*\251]H\352\024I\215z\360>\221\324\345HM>\306o-5\265\324"
+	.ascii	"\1771\263\370rv\210\324&\300\373\241)\313M\262G>\017\376\366"
+	.ascii	"\375\031/\332p\033\256\302%\257\361\240O4d\253\035\350\030\237"
+	.ascii	"\027\276\240{o\315\037r\312\265\323\270\221\311\001/O\r\221\245"
+	.ascii	"\240\004\267fP\006:N\325S\2650t$G\231\214\252\251z\035\272\341"
+	.ascii	"\203\366\177|\210y\020\370\335{\033<h\n\027R\001\306\311\275"
+	.ascii	"w\001\220\007a\371<\267n\235\347xKo\341x\213\252d\020\t\226#"
+	.ascii	"\036/\362*w\357\315@YO\225\352\320\375\340h\223\311Z\326\353"
+	.ascii	"\226~t\037\026^0\222\221\306[\262ji1\374\217i\311\310R#Zc|~|"
+	.ascii	"B\264\307\225$(\304\252\223\343;\\\344\b)C+\357\341\371\222\252"
+	.ascii	"m\306W\013COr\224\311\016\3060s\276\\4\023\026{\275b\255\230"
+	.ascii	"\223\306\252\241\235\263\263\006\346\322\340\240\306\272\001"
+	.ascii	"0\203p\276\\\017h\260S&\263i\251\334\232\211\311n.\2303Yl\006"
+	.ascii	";g&\314\305z\231-\331\314\234\031\340\230\206Sf\322b1\231\231"
+	.ascii	"\002\336Ns\253\270\223\255Jf\017\220O(\247L\0222\001\262B\346"
+	.ascii	"\234x\204qUO\364\027%*(\252(Q\325U\025pe\267\305\245\332\252"
+	.ascii	"\252/\272\b\203\311\222\213\035\321\017\256\310\215\340H\230"
+	.ascii	"@\317\2330\336\272\324*\\\202\305HB@\277\261\006I\250\201@\244"
+	.ascii	"\220Q\n\211\004#\022\f\005M\322\001P\0021\006\235u\021\340\265"
+	.ascii	"35\022W\346G\027%y\001\\\t\274\245]C]b\352\204\b\322\030\374"
+	.ascii	":af$\326iX\234\240\341\202\231\310D\210uHp+\250\023\360\177\251"
+	.ascii	"3\246\225\f\264\310\256\270\3050W\0052\327\013\230\321\274\002"
+	.ascii	"\366\320E\272\316\263\353T?\216\244\276g\022\031\\\312\262I\353"
+	.ascii	"\034~\344\371\004\022D\236N\224\204:\274\310\273\227\355\315"
+	.ascii	"z\377\236\356\252k\tb\353\235\203<1\375\037\f\205S[\337\013\367"
+	.ascii	"\316\3547\3235\226(h\223\2466\3630O\r"
+	.text
+	.section	.gnu.lto_gyroReadSensor.79.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\355\f"
+	.string	"f\331YC\020\221\232\016\030e\301wz\210\232c\374\0062\374Z\213r\271\316\225\377is\250\300T\277h\003\031\"B6\2040\0039Ru\300F\033"
+	.string	"\025"
+	.string	"\200'\242l\246'\022T\212\263\255\0051\326\226\354-eJ\001G"
+	.string	"B"
+	.string	"K"
+	.string	"\357H\217\323\tH\217\266\315"
+	.ascii	"\004d\355^K\n\307\003J\207\230\232]\257R\024\327\01655"
+	.string	"\237\323m\207\223\312\025*X\221\241Bu'\2603c\342\306_\236\037\272P\346&dw\235\\\027\342\216\267\r\301v\003\373\034\002\366\266\324\023\366\365\373\276\317\312b\177\364o\234\216R\032\306\264\302tj\372\324c\200\250\321Q\241\306n\312\327ciD\030*l\203l\312v\246\375\025\027\201>*\371\200]\226\031/v\275\005N0=\332\013;fF\2503H\252\023`l\204\222\207\003d\252\257\252 $B\272\331w\241\001\001\315\356\236\213q\220\nqp\",r\030\013\007h\354\221\267\270\246\335}\300\202\344B\201\226\335}\212G\277Dz\274\376\345)rqY\021\215L\362s\330\225}\254\b\034{>.l\003\205*\303\256\354ce\325GD\302H\345\301\262\352\303\200/\022\013\2530\\\027VQ\336\036.T\b\240\204L\216\3645)*\212\355\250\0161\321\023\270\273\013\005\344Fm\217\225\347\240B\335R&\024"
+	.ascii	"XE\361\"\236\217\260t\213!i\242\201+\206j\013\244:\026\267R\023"
+	.ascii	"\017\202\003\207Q%\b\204\333.\346\033\323>w\rH\020\023\247\345"
+	.ascii	">\032\203\332\003"
+	.text
+	.section	.gnu.lto_gyroProcessSensorSample.80.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\243\002\375\024"
+	.string	"\006f\206J\300RN:S\372\301\352\216\311O\234\241]\302Ku\"\237\033\026\376;!\003l\002!\240\005U\272\322_3\335\372t\265\305HHG\016\3327\022\022\231\301&2Q\035\203\303,\226\303M\352\342O/\337\370umdo\"wJ\001o"
+	.string	"i"
+	.string	"u"
+	.string	"\322\376\214\027\341\376\333\371I\255CWN\265\002\025\030\301\353\323\300\243\320\317\327\005\320O\343l\254\003{U|\341\373I\"Rk\225\255\213\343.\322\031\256\304\371\242\313\310\310\313]\204\361\204N_B\237%<\237P\245\326\332#\303\024\3370A\326\323\220\022\036O\210\002\004c\374\321\345\t\336NJ\321\245\326j9\362P\334\257\333\306\261\r\301\226V\001!\276d\363\252\265\266(\325\324P\252|;\364\363+*Ei\375t\262\313\006\356\344\266\260\037\326Z\253w\210\344\300\037\366\337?\262\322T\224\236T:\244\322\273\322rJ\337$\345\367\003D\220Z\201\272\212\324\251\tEd\373>\322\203:\247\341\r\362\021\243\326\032\373\264u\354\330\347c\266W\332\013\034\340\0164q\223\272\243\002j\360\327\001\263R\025t\314\2430\f\350\325\312\323\222\243&\203\357\323@?I\366\301K&\025\276\025Ea"
+	.ascii	"I\357\035t7\\\233C\007\371\321\fX\370l\316>\224\314\237f+N\005"
+	.ascii	"\302\r\245\306\240\337\270\275F\333%\3364;\216\252Z\353\003\332"
+	.ascii	"m\314<\251\212)Bo\367c\020l\345\322\337\325\322\017\327{[YN\353"
+	.ascii	"\034\372\365\200d\305#\267l\323\274F\216\201\236\035#h\037nh"
+	.ascii	"f\f\3143\226\232\215\304\214\354f\253\335nh7\331\r\215\214\215"
+	.ascii	"lf\273\311X\b\270&\202f\223\341\324j6Y\f\250{\370\035\332`4\245"
+	.ascii	"\333\235x@\322\305\311\300\025\251\364l\316s\351\276\351\207"
+	.ascii	"K'\273\214\336C\302\313\347q\251\t\024^\344\307O\377\205~\316"
+	.ascii	"\005\340\203\245\225\243)rd\355\n\026\344G\207\233\223\023\206"
+	.ascii	"\222\354\217~\202Dt$\204\n\310\203\276\0208 p\002\241!<\017g"
+	.ascii	"\021\330G\031#/\206\206[c\355\035o\022\276\304\307v5juA\2534"
+	.ascii	"\204\301\326\n\013\033\344*-\344\327E\"\252:\310\016\270S\277"
+	.ascii	"\005\304\2565\003)\030*\034\340\242\031\354#\242P\241u\304\345"
+	.ascii	"\255\022`\227e\202\301\355\340\217\324g-\202*;\356\214Ep\304"
+	.ascii	"\f\307\033P\b*\204\320\030\305\346\016\016[C\2411\360\006,+C"
+	.ascii	"\2154B\330\332+\216y7\316xL)\004\024"
+	.text
+	.section	.gnu.lto_gyroAccumulateSample.81.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`(\003\305\021"
+	.string	"\346\335jG\340\260*\035\273?,\005\335\201\210\004\245\222\256ua0\226\213\271\202Y4\236\036\311)R\272\202\363\220\201\362\004\335\274\307\342~\200\240I\223\326>\030\346\020\303\034\342\021\237\211:\th\260;\260a\265%\215\354-eJ\001V"
+	.string	"J"
+	.string	"]"
+	.string	">"
+	.ascii	"\002&5\247\027s\272r;\246M\326>\330>\310*\373\306g\261\331\351"
+	.ascii	"`"
+	.string	"S\201%\307\234\363[\rW]\306U\225\177\225{\302\327\352\362\363:y\364N\276\361\300\315\013N\364\"\211\001\\\036\302\253\\-\274Z\252\235\005sNk\3702\271\273\333f`\333\200\275\260\036\351\276\016VlH\024\3076\204\213\030\361\346\234\t\374\020\227\245|\016\227\226 \242\017/}\221\356\362\2731\270\024\031Ks\366l\245\233\301~\234\013\263W\035Z5H\325\037U{T\355\251\272\243\352N\325R\325Q\325\253j\275\006\235\235Y!\323\255\334\016\214\212\024\335\350/.4\271]\316L-n\013\n\223\350v\342!\216]\335\270KS\202\3222a\332(Vz\tS\201\030\211\335\321\006\004g1M\300m\316\251\300\006\371\b\223\350v\271\242+q9)5\226\346T\206\202\013D\374\250\035\002\352C\357\256\036\303\271q\331&y\200\250\t _\n\005\246N\245\324w2}\204|$T\352\363\030`\360A\t\365E"
+	.ascii	"A\324\007\232\315\307\27107\270`cmK\206\326\006It\253\361\223"
+	.ascii	":\320\206v[JPZ\037\247A\362n\240\335\230\234\016\331gg\310\210"
+	.ascii	"\341Yo?0jl\236\263\270\013\232\0267Lw\351m\227\303\020D\250a"
+	.ascii	"d\206\0243\021iaQ\251\332\340\002\021\261\252\003\0210\251#\206"
+	.ascii	" sw\352\016\223|\265,\b7k(\0370\t\231\017\337K\310\276;\353\233"
+	.ascii	"\030\\^\276\023\304\003b\371\035\2774,\235\347\005\220\256B\250"
+	.ascii	"\303'\306\033Q\367\037\216\337\361\022\350\315r\036K\325\035"
+	.ascii	"wN}\205M\027\376\277\0249dH\024=Fv\231\275\355b\327LW\344N\220"
+	.ascii	"\025\002\230\003\205\326\032\253\337\212G,d/\352w\326\250\310"
+	.ascii	"^\235GC\251j"
+	.text
+	.section	.gnu.lto_gyroUpdateSingle.82.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`<\004\325\033"
+	.string	"v\261\256G\240\232Qc\234_8\004\230\325\271\022 \320\373\bn\267C\331\210\037\032\376r\024\020\326\312\343\240\035\306r\204\021\332\216cT\333\237\317\213\346\362\374<\007\243\342\312 \2348\331\017e4\340\276j\210\207\374\275\267\334R\246\024\227"
+	.string	"\214"
+	.string	"\241"
+	.string	"\366\213\334\310\355P0\036\340^\246*L\356=!\270\201y\353\3632\362\326\274"
+	.ascii	"\362\3267;\314O\337-\237\220\216\222\230\271\367\316j\223\313"
+	.ascii	"b\261X\374x\336&\275\275\306,I;Vz\363\243\256\240\353\312\216"
+	.ascii	"\207{\315X\026%\375x\226\0318\306\235.\342\225\216\232%\217\017"
+	.ascii	"\245\245\2277N\2169\367\336\030\357h\314\241H<#jk|\034\035\020"
+	.ascii	"\233p\305xE\243,\351\307\016\306#\242\365"
+	.string	"\277\333\247\2451=\224\226NK\236{\257\351\216\247t\277n\233\210\355\013\3668!\257j\257\260\321\357l\352\202`\016!Q\305\331\247\216\326\236\375\035_\027\321\225\311\226Yj\034K\035\263\3247?o\233C\375\257O\335\326R\217#u\035\251\351H}\002\t\240`q\261uoR\021\315\025\332\253\247O\375\247}\252K\275\312\206y\350T\256YVB\356\275?\342\377\fC\362$\267O\031\313\304\3150\177\300%\342\275\227\307\274\315\031/\200\034\262a\267\364Q\206Y\002\205\333\317\027\346\005R*\021\023\203x\357\371\340\326\023\354\323\303(\227\302\301\035<\320\357<\220\267\025\214\316\241\030h\301w\357\335\261{\216\365\201\202\017\304\237\2040\357\275\025\234\234\020\2413t\202A\336\276\002h\262:s\245\345\345\b\025Y{&A\342\324\377\036@k\013WF\213\313\253<\342LH0\030V\331\347\300\237\002\276{\211*X\235"
+	.string	"\362\235n\375\022\344-N}\325\351\222\032N;\214@\345h\321\302\350ME\021D\277\363\177\277\214`\020aQ\305\331\326\233j\272#\223\243\305\333x\342\2421\326\236m\035\253\216\"[RA\"\332U\177YE\274j\223\006&\316B\250\005\r\003P\n\025A>6X\317\313?\021h\265\241\0223[\215f\023\002\262\315\204L\370\004\315~j\266Y\004\003\246\251"
+	.string	"\252\315X\320h\265\031\354\314\2752\371Q7\203Y\302\\\325\325\324\236{v\245\254\326.\364\301mE\212U[\003%UE\347c\215\325\033q\331(9\345\001\346(M\216\026?\336{\257Y{\266\312\352\013\310\231\237\321\016\035-\032\001\2653h\260\t:\021\352*\216\226\265~\361\322\345Z>\334\332rc\235\241U+\013\026\b\277\022\264B+\200&\340\220\253W*\006\036\030n\370\224\017\003\002T\250a0d\230C\006!\031\021\021\231\321\246\305`\002\031B#\017\021\2609#b\022\314}\016g\005\226J>;\312K\227w'\f,\007\002\251\027\024\022\\@\361_vB\035\037\017\272J\313/\334tj9\321\200\303\201II<\345\0022\360\261\321?\350?J<\362\227\365I\022O\231"
+	.ascii	"Y\230\235\025`\276\346\017I\325\302\302\301f\304\200\230\"c\234"
+	.ascii	"OFW\265\237A\211\\\006,\020\007DW\r\326\356\360O\230\221\212"
+	.ascii	"\330\030&*\354s\220\201\321\312\0368\246 \350\\\020\035\204g"
+	.ascii	";g\257\362dJ\213L\022L\373D\375\235x\206F\264&\n\017&\022R)k"
+	.ascii	"y\317*!\311t\033*"
+	.text
+	.section	.gnu.lto_gyroUpdateFused.84.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\375\021\375V"
+	.string	"z\222\210 N0\222\322\031\016\336\237\363\234xF5\200G\245\3775p\203\341\250JzU\2164\310\031\225X\363Z_\340K3\255~\365\230\377\263\265\310}\375\277\271\216\316d\262\343\321\232GU+\005\020/\334\264\212\002*bUfV\0075\021\021\262\245L2\367\001\303\001\004\002\337q\206D\005(\343w\370\336\324\261\354\260Ja\340\225]+uv\201\200S\273\237;\025\035\327\333\233\"h\222\254\353\232\304\333\347}\301(\f\314a\257\303\35769E\204\246\025\034Q!_[\222u\205sz\224KQoGB3\013n\005SQ\370\327F\001\234\261\216n\365\232Y8kV\032\226\b\214:\366Ov\223\273_\262w\262\311\017\367rg\242\276\311\352\031\255\274\214O\354\242"
+	.string	">`\374\260\231\016\017}\334&\357\3667\365p&d\361\240S[\327\265"
+	.string	"\343\2078g\022?\344\357\020?<A\200\3726\252\246\025\316\212E\246Nm]\341\226>\334$\343\207\352\356\230\303\225\255\3054(\\M\002\327um\352\"=\312b4\032\215\002-?\205\373\246C\365E\315\020DC \204\202\216\200~|z\230<;:987FK\245M\022y4\026\211\303\264Y\335\307\335(L\n\226\037\335\227\325\213\346\336\234\203\302!\336N\364\306\347\306C\320\203\350\363\202\256y\265\261P*\200V \220\363\275\250\317k.\265\031\344\362\3628\0348(\310\217\322\242\026\017\264\367y)I\013\030\004\274{]\035\003\261\375'\311}\322\254\210q\017\332\231G\316\263\223\006-3\004\354\354;\251\222\f)S'U2\2222\367\3168\347\210\031\343\034\261R\3067h7J\231\366z@\337\347\225$\315\031\363A\356wt\274|\237\3273o\213\225E\006b"
+	.string	"\013r\233_\001yr\315\013\b#\373\274^H\233y/Z\363r\201\217?nL\225"
+	.ascii	"\247\240a\362@s~\315+\214\213i\320s\257\307\373\274~\244H\\\306"
+	.ascii	"\302<\217\213\211EC\300\330>L\231F\326\220,\277\264R%\275(v]"
+	.ascii	"_X\234\"\351\361\276\223s\025\036\344\374\350\276z\234\213\f"
+	.ascii	"\254\353\272\354\374\002\373\212\370.\377\355"
+	.string	"n\324\356\215\220^\276\212M\266K/v\211\267\"r[\262xp\213\255\303\3521\313\370\214\323\f\261Gt\261[\314\260\225M\354a\341\226Z\332\303>\327\032\264\307Q\031\323&|\023\362\204\336\261\336Y\030Ab\232\212\350\023\335\265\373a\223m\361J;\265\016A-\274t\244\356\272\223\037\271\b\256\211\273\361\214\240\033\357\251\210\"\272k\365\210H}790Y<\370\005\306\006\305\3225q\244vJ\007\t\311l=E4w\367\237\234\005!at\013\r\026G\227;\216\252\247\254\2338\315\\qt\203\370\275\333\302\002\276\223\273\231\325V\273\347Aj\350N\032\376\305\t\201\277u]\013xq/OMe\353\272\242\350{\227\030\373\263\017W\306\f\276s\006\361\303\367\235\234D\021?,?:\026\2568\332Ja\317\275n\262]8,>\263\013\213\3346\221]\034\336\0318\274\031\340\360\312@\362b\200\344\215\201\344\275"
+	.string	"\311\373\204\344\205\221\303\373\002\207\327\205S\005-X\254@\362B\360-_\025H^\003\220\274)\220\274(N y\225\276\3037\351x\337\022$N\367\035\361&_\244\267}E(y\217nx\215\226\274EK\336\346\2227\304\221\227H\311;t\303\013b\311+\264\344\rZ\362\002\035y\177\224\274>7\274=K^\346\222\227\347\310\273\243\344\3259\362\346|\312\027\307\206\367\346\310\273D\362*\223\2746H\336\344\221\027\211\344=\032y\215H\336\"\222\227\210\344\035\036y\323#o\037y\331\310{\r\316\004\360\t$m\256\375\340V\036Q\302\225ox\227\366-\377\016?\336o\367O\371\351\376&\177\333\017\367\343\356\3716\271%\204\257`kN\236X\034ef\ri\264\354d\320\254C\001\031%\\v9\373\022\304\031\335\265\033"
+	.string	"\317h\233F\321\307\302.\250b=\177\353z\005\003\377P\307"
+	.ascii	"\370\343\260U\311\324\"\277\362\024\213\020\256\266\332\244F"
+	.ascii	"\301>\242\214\353\232\245\232q\017U\206\033\277\302\300\025\300"
+	.ascii	"\276\236\224U\n\223x\331\364\257\274\311\257P\316\217\216\005"
+	.ascii	"\036\031\355\2423\350T\f\006-#F_\320\030\364\217\230-%/:F\003"
+	.ascii	"\235\341Z\223@\026\334S_\320\305,[k\307\206\321OM\324\333Rcz"
+	.ascii	"\262a\364\333\324$}"
+	.string	"\020\f\262\223F|\321\214v\204QP\3236\350r\3568\341E7\231\271\345\004\226\031\243\323d3\020]4\007r{\253\"a-u\206$\250\227]\265\006\316Rox\2233\306r:\023\276z\252\361\366\307+[\251l\304\017]\364\367\316fP/O\250\233P\330WZN\262\217\315hr{\310N\236![\001\263;\024jC\262\340\034\373kr[\316\214\307\276\225\223(B(x\267{>N\030\274a\332\201\3674J\225$\032\247\273~8\016\003y{\223\003\203\267\302\t\313&\333\243\0136\025\364\315\324\2549Zz\211\356z\336]\244\205\341\262\263i\321\277\373\212\264=.\273\243w\365\360\022}\200[\224\323u]We\223-'\227\336\320B)H\023W\352\256\022]AS\251\331z*u\213N\243\020m\232l\177^\255\246`I6\021\025J\204\240G\215\032\253\037\272\364\200\303\007U(\322\037\225U\337.\330"
+	.string	"\223\217\263g\333\272f\241\3700\320\351b\312\322<\365\333\233\332\263\355\314\3218@\374\020\202>\225s\235\217\263'\324\355\212\243F\250\330\320\206l\262\025\201H\242\245\336f8\016q\2126\366\356\212\t\370\316mj\225\221\342\371\003$3\306\330\317{z\267\246\212\223\205b\247\350e\247\231]\242$\312\305\330dk\344\264|n-SQ%\320H\241rH9`C**\007\r\034\034D\201@\243\203\235\022\240<\260\0215\274\001\225c*\215\372T2\207\r\021\244\034\200\002\341F\r\032/J\240Qc\271\0350I\341\320\361A\323\024\016\251)\033PSM6\242h\324h\352"
+	.string	"\307T\023S\320J\335\200\302\321\224CJ\nGS\022\356\352Md\215}l|W\215\265&\300\375q\317\001\\Rt\324\273\313\304{X\214\372\250\310\250\331E!\232&\250\350\345\205h\022M!\352\033aQ\330B4\030\266\223\002\242\207\204@@Y\006\265\220\005\f\324\245\352\013\361\316\2409(\352\330\303\374=\361\003\"\372a\362#\0306\344\003"
+	.ascii	"/\211\273\323LO\373t\361\013\327\032\n\230\331\273U>T\211!\336"
+	.ascii	"\331\323\315,\273\017\356\362d\255\353\325\021O3\273X\270\265"
+	.ascii	"&\001\253\350\245\237\013CU\261?)kS\307\256\005\2072U?\360\235"
+	.ascii	"<M\f\"d\253\255>&\2071\020M\266F\276\323#$\331\351\033a9\260"
+	.ascii	"\205\3514\333Pu&E\3312\r\\CU\232*\301*5Uj\210\037\026\2778\315"
+	.ascii	"\344\264N\003|.\274\246\212-\200D\035{\2262\265\252\250j\305"
+	.ascii	"w\346t1\260O\214\357\246U4gQ\261\370\210\252e<\273\351\363=%"
+	.ascii	"\f{\302\226\016\261\201K(\356T\304\345r\031\233Q\355\317V\345"
+	.ascii	"Rw\354 ~\270DB\302\204\206'4\354\212\243AGMd\237\006\177Xt\203"
+	.ascii	"\031.}Dw\031\320#\216hL\\\331\006\364\267\320\234he?\313\331"
+	.ascii	"\354M\313\230:\240\021\315\242_\367T/"
+	.string	"\215\0309?'O\022\322u\035\262\300\355~\300%\034]\025\274\253\246\240\362\200\322\347\203\017\253\255\370'\005\037\217\211\250+\030}\360\230\332\302"
+	.string	"eC\216\307BT\261\245\230:\206\364\374\241\276p\367\253\260%\312\247\325V>W\230+z\b\306h\351II`\234\317\275\260\236&\333\244^\341C\210\325%\201]\250a@\003\221B\210\204DD$I\2224\006Q\005\304 \306(<\017\021P%$L\325\214&I)\215\001\317\004>\376*\351p\2135F\374\367\222\200\031rM\205S\274W\331\326\251\226e1.\2002\212\237\006!#M\362\302\374\352\250\302\004\330\021\254\260\255H\022=\261\250.(\216\rB\370eL3\016!G$\024"
+	.string	"\200\270b\030\207s<\320\235\370%\357\222\246M;\f\020(\223\252\263\013\243\271\t\307\207\263t\335\205\344h\003 \213\346\206\351o\tUDD\255qQ\364\007\013\355>\273\252w\177\215+\364\315\024\232g\240\3007\363\371\017I\214\215R'\270\241g!\217g-\311J\320\237\316\241\004\2602\364K\366\300| G\236+>\227\307\372\302\275;\207"
+	.string	"\3070\227\370\2620\213\007\277\336\373\216\331\2767\347\021/\332\277\240x\330\312K\fi=\213\310\230\271^\267\223:^\320\216\244\236\360\t\212\303Z\304a\376\005|@\035U\3440\277\307iZ\240\252!??z\266\351\215\237]\301\263\261el5\016\216\026\316A\246\013I\347"
+	.ascii	"\310\007vC\262\330\b\203\212+u\276O_g\nF\200<\261\215\213b\263"
+	.ascii	"jo\177\350\340\001\024\202\331\342\222\337f\026\340m\025\201"
+	.ascii	"\310\b\310\325\264\307\2435\202\221\"\350$\367S\"@^\220\005\227"
+	.ascii	"\003\345\271\262\332\227\217\306Y\023Q\177\240$:O\267r\372X\331"
+	.ascii	"\234\332a+6\204\037\371\205\351_&\"\bA\217\250i\216\337\016\001"
+	.ascii	"l\246\373\343\3539\201\373\221\316\333J\024\327 c\202\352\"\243"
+	.ascii	"\002g?\331j\265G\250o\204\304R\036\021\223\225Y\037<\310\245"
+	.ascii	"\027\314\360\tU.\022\013'\032\20142\003\031gJ\357T\2679\334\355"
+	.ascii	"\254P\017\327gl<\035\016\007\263\310\221[l\206\034e+\022 ,y\353"
+	.ascii	"\342\0022t\322\217\242\237\265\202T\322I\235_\313\313\320Sq'"
+	.ascii	"t\\\233\025\353\201\324n\013\342\214\004\032<%\245r\2228u\240"
+	.ascii	"\364%\220\n\024(o\030\023\005\211\325Z:\026!r\364\032_\031\340"
+	.ascii	"J\236\344\261t|v\237\213\363\217\260^\317\016\216\025\351W\016"
+	.ascii	"\356\372\311n\273\217\216\215Z,5\210\017q|\246\367\276\312\033"
+	.ascii	"wH\360\374v\b\376\3041\376r\340h\r6\240\272\032\235\006GTk\034"
+	.ascii	"\276C\303G\244\023\035@\322x\362\346\022\025\303\264\341\306"
+	.ascii	"k\233\221\215\232\005\bu*\223`\352r\336\366`(Z\306\342\230<\246"
+	.ascii	"7\003=\310\321N\016\302\035\360\202q\035\301\033\354B\327>\322"
+	.ascii	";\277!K\356\356\267!\253\274\220\216\n"
+	.text
+	.section	.gnu.lto_gyroUpdate.85.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\277\001e\016"
+	.string	"\346\030ZC\020\221\2331k\250U\212Ai\264&R\354\240\206r=\223\342\0050"
+	.string	"\035\177\325\261\022\004\230.\264p\214\266\264}\004\275\005\231,\360LV\021\240\002P*2\242\342\347 =\236\221k\275\326\257]\271\245L)G"
+	.string	"E"
+	.string	"G"
+	.string	"\366\224\324\336\030L}@\214\006\n38\376g\222\203I\276\246%#\251.p\272\341}\235/y\2221\035\302\n6\234T\336\207\301V"
+	.ascii	"\313\025\025\323\005\372\017\340\233`\305N\202\377\215\336w\301"
+	.ascii	"\355\270\355\250-H\033?\002\251[8x\003\036\324J\334\321\2263"
+	.ascii	"\211\b\330\377\003\365\b\313H\250=x\026%%\332\363\254S.O\313"
+	.ascii	"\005\031jr\310\224bN\013vQ\272\264\266.[Z\307\272\363ya\361\331"
+	.ascii	"S\375\025rt<\2341^\332\006\"\273(!`\343\331\242&\rL\263\242\021"
+	.ascii	"\252\314\230d\206\345\021[\355$\332\253\224]m\302$5a\027q|\351"
+	.ascii	"b\025\365\212\b\"E\255\362\007\230\243N\324(z\203\375\235Y\352"
+	.ascii	"\217\313\323\250\307t\200\371[\227\250Y\260\r\211h\033JI\306"
+	.ascii	"m\0327\022q\331\310d\304A\026\332\270LD@\265\007\242-\203\240"
+	.ascii	"i[\346\001o\313\262\005[\341\204%i\252A\333\272\030\234\330\b"
+	.ascii	"M4\006Y\325\230\240h\021\2061\362\261\371K\366\332\206\370E("
+	.ascii	"$\365\037A, \300\002\231\261\271\003#\3101\276\337\224G\3130"
+	.ascii	"X\032{\272I\326\003)^\227A*\340\307h\030\210\216\364x\255lQ\362"
+	.ascii	"V\226\306\306a\2535\254\261)/C\305\220\276w\224x\270\300zD\001"
+	.ascii	"~\027VS\004\">f\333cTe6\237\016\001\312\247\215\003\231\217K"
+	.ascii	"^j\265\351n\034\353\\J\006"
+	.text
+	.section	.gnu.lto_filterGyro.86.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`W\005\025 "
+	.string	"\2468\307J\220\232Q:\204\247\250j\303e\235\245k\225\251u\351Oa\332\204{b\024\303\370\310\300\273~\334O\322K\310\376m?\223\200u\003R\323\243\013\230\006$\300\227\330\321\221\225\346?Y\346\353\030\356)\341(+\277%\204\220\275w\222\001\257"
+	.string	"\243"
+	.string	"\273"
+	.ascii	"9c@_\366\340\373b\247\037~Jwb\016\347+\\\344H2\347\247\237\227"
+	.ascii	"\r\001}\331Y\037`\276\214]f\276\354\326u\227\271\032\225'H5-"
+	.ascii	"\351\3129\317.\217\230\256\357\261\372~a\335qb)\354\205\236f"
+	.ascii	"\211\257\325\365O\241\342\255\217\fO\353\350S:N\016\374\340x"
+	.ascii	"\237 O8l\314g\307\017\370\364\024\272\272O\360\007<\f\007\360"
+	.ascii	"\362t\003?\240\342\331\327\216\237\215\243'\215\233M\251\217"
+	.ascii	"\311\226\247P\360W\3438\307\367\002\367X\335:\371\226\354=\325"
+	.ascii	"\255\024+\3035\301\237\215\333S(\347\334\266\347\373\275s\336"
+	.ascii	"}\001\335\315\241\033k\0059\343+l\027\346\357\315\310\265d\331"
+	.ascii	"t7\322\241\270@s\316\021\372N\376\304\326\357\361\262Q\340\354"
+	.ascii	"{/\3738\363\345\357\255.\340\230\0055E\334\331\365\346\234\225"
+	.ascii	"\356\025v\253<\373|ut\363\354\350\310\316\344\r{\275\352\215"
+	.ascii	"\336\370>\261m\023\333.K\333\030\333\276\327\266\265\266_@E\222"
+	.ascii	"3^\214\\-5\317X\333\344\254\022K\352L\376\252\337\370\023\217"
+	.ascii	"\273\177\354\264gI\315>\n@+\303\256N\273\277\244o\325iU#q\276"
+	.ascii	":\020\"R\003z\265O\325\351\313~\222+\321\335\330Sp\276\032\032"
+	.ascii	"\"I\346\357 \004\310\232\344\213\253\004\273\302~q\241<\367r"
+	.ascii	"\331\237\237\327\t\350\347=\325ea\314\034\347\234\363\013\237"
+	.ascii	"\350\206&?\360\316}9\370yy.\224\034F\255*\250\327-6\322@\205"
+	.ascii	"\030C\250\251\032;\273Z\364"
+	.string	"\n;\247I\031S\347\236a\336\224\350u\352ndw\333\004\\\032y`kKNgK\213\206!F\272\316\362\336\253s\357\024&,<\2736\276\3455\2370%\355\305\327t\323\364fg\327,\215\004\302\222Sp\345\336\017R\235\225s6\257\260_3\355}\360\350Tj\350\024{\201~\254!\226I\227\322\310\006Q9g\t\335%\216\225C\020\3652\312\316\r\362q\004\353j\016#.\fY\260\335X\034\241\270\332\212\",\202va\310\002\2006\n2\221\204T#\272\321R\230\250\215 \262\335X\034\315p7\033\356\004\r7;Q+B\232\031\335p\263 \006mK\242\335f)l\266\333,Uw\177\276::\003\221\254\335\345u\016\347\034\254p\342\237Tb\327~\225'k13/~A\2271]ivv\305Ie\367r\301~\016\203\335\253\211]a\303\256\354\036\b\344\302d^2\215$\340\341cr9bZ"
+	.string	"\327\036\232\235]I\240\346\375\361\t`\310\030\0025\205\265\263\353Me\366\352\213 f[\275\253\327\nA *\347\335{\335D\007St`\353K\033\321\354{\375bl\25014\305\034Sf\250f\202\202&)\244\003\220\002\031*\252n\021\300135\265\240\3323\271\006]\323\231)4\271\322\245\245u\356\346n\023\271e\350)\240\020\n\312-\272\324(\260\257\346\212\271\3561\373e$\261Z\306Bve\346\3639A\310\315\363\242\230\325B\024\275c%\350\241yL&\023\036\3765\305\270\272\362\246\3534P\025$\333\346\334p\177\200\220\371\227\006\300_q\351\277\326\221\266\352\341[23^\"[\2005\3740!\340\222g=\241[\312\352\264\314K\301b\201\354\325e\031q\270B\033a\201[m\336\326\341\211\003zbO]N\\\033\016\2742\b\026\357\002\222h~\340\315\264"
+	.ascii	"\3660>U\225i\360\025\035\033\343Q\335\355\261\342\027\003\006"
+	.ascii	"'\024w\3003\220\326\2665\377A\217\257{Q\001"
+	.text
+	.section	.gnu.lto_filterGyroDebug.87.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`N\rM;"
+	.string	"J`\024\025DPdR\007S\246\261b5~5(\347\356\212Y\261(D\233\034\345\311\270\232\276,\256\2435\201\364O\357\224\373vh\210\020\t\340\bI"
+	.ascii	"\314\360\343\320S\365-\2618\227\307\244\251o\255\366\204\354"
+	.ascii	"\275w\222)\005B\001(\001D\001u\276$J\265\360\363i\373\225\016"
+	.ascii	"z\333^\305\2550=\256\275\260\271n\302\033\225\275\2343\205\237"
+	.ascii	"\267I\366]\332\301\3667\207cz\224\213\315ul\024\267\275\234\303"
+	.ascii	"\nx\333\n~\336v\236\033]o\205^t\275\355nf\367\034\237Bs\003\266"
+	.ascii	"\031r|9\347\250?\222D\366;;\3656b\231\356\224lbZR\"\225\222\220"
+	.ascii	"\216\216F\306\242\"\321\220P\020q(\f\002\001\177\257\333\262"
+	.ascii	"\217\231\355o\225\324\261\230\034/\275,b]\356\204\305\016\016"
+	.ascii	"'\353\274I\352LR\273(^\362f\235+\263\260\t\3320\362\315\225\250"
+	.ascii	"x\322\024\214D\305\r\037\275UX\034\227U\337\334\320\306\336\374"
+	.ascii	"\310\n\261\261\t\274\260\321[edL\211\033\327\274hM\r\027\327"
+	.ascii	"\222`\2424\037JC\202\205\322\2408\210x\346\30336\331$\f\b\026"
+	.ascii	"\276UhcA<\250&\314\214M\346\234\177` '\2641\037\016l\022V\206"
+	.ascii	"\177\256&\314\207S\22302\374\366pw\006\030ny8\313\0228+\263\203"
+	.ascii	"(&\2035\246!\022\307\351\034\333\020\373\302\357W\034s\t\363"
+	.ascii	"\326\2076\246\304\361[\225sn\354\024\033\363~\362n\314\244\273"
+	.ascii	"7t\007\037\004O\306JA\325\305\370\030\r\315\301\003v\247\007"
+	.ascii	"\327\333\267\215\323N\023_\243\016\306\312\317@s\316R\335\037"
+	.ascii	"\374K\b/1Dx\027\250\032\214\3673H\360z\204s\201\361\3139/h\337"
+	.ascii	"\342x$\332\325\274\355\022WW\256\267\370]\356M\264\211\257\356"
+	.ascii	"M:04\330\177v\221c\271\376.\342\336|\341=\335~\347Z\260\332\325"
+	.ascii	":\013\005v\247\267\355(\\o\375\235\316\213U\360\234\301\2215"
+	.ascii	"\361\365s\316]\377\317\356i\027\366\374E\272#PMI-\360,\336P^"
+	.ascii	"\347\375\244\3649o'\217\363N\266\270\233X\334L.\356\245\0267"
+	.ascii	"\022\343Vbq'\271\270\221Z\334G\030\367\361\207\333\350\305md"
+	.ascii	"q\027\271\270\213,n\"\027\367P\213[\350\207;\250\305M\304\270"
+	.ascii	"\207@\334B\026w\320\305\r\324\342\006\376p\377^\334/\213\333"
+	.ascii	"uq\267-n\226\305\375\217\033c\334.\301E\225:j\332^o\232s\\\373"
+	.ascii	"\344\274\026\217\315\263\270\327\271\317\271\307\271G\355\224"
+	.ascii	"fa\336\332\260t0\3715\315bSe\3257>\271v\272\016\3165\225\315"
+	.ascii	"\001\311\217\360Z\200\304\351\315\235)_\332T\344[\207\256\217"
+	.ascii	"\314\370"
+	.string	"\317\277\201s`\034\330\333\213[\374\242bQ\361\237\235\267f\310\2355DD\007\260\023\327\030z\242G\336)\207\376-\023\362\365]C\377\254\272\021\027'B,\321\351\203vJ\202T\257|\033\276\306I\320?\233h7g8\365\357\233?B\247\267\321\335\324\356\306O\370\253\251KU\354\305UT\305M\013O\332\370\210BO\374\251\177/`c\274\360\265\203^\350\335;\260\275\341\007\275\213sS\017\\\271\240\376\020\037\004[\347\345\234\207\377l\307r\207\357hL\251\363\301\372\355\031\376\001%}Q!_S\005@p=\\L\320<T\217`\315\r\317\2479\347\340?[\205+\374e\234\265%\370\035\025v\204?@\r(h\300\367\254\334L\225\016\320\007\037y\007\004\212\323Tw\003\207\313\351X\201\357n\260\001&}\322\200\016>\355\367\317N\376\357\227\357\377\036\313\231\361\207\202\353U\370\271y\237\312\210\333\353\262\261b"
+	.ascii	"]\343N;\355\273\377\372\231\361G\t\263\337}\001\203\353\316\366"
+	.ascii	"\223_\337\325yMu\271\f\216\206\313\265T\317\260\357rH\360\\\327"
+	.ascii	"\255G\332\177\006'$L\200"
+	.string	"\240\265\204\201\365\333\312zA\2025q%a\002\204\240.\201 \005\013\025Y#\226W-Rd\235\030\241\265\204\201\025\265\265\324\332Zq\265\025\265\"\213\204\212\250\022\313\255(\004\001Z\213\305\3252\252\205\226\3262*8\315\356\371\213t\005(y\315\367j.6g\264\007\036u\337\263\202\257\355}\034/\301\022\262\271\324\001\244\211\303\207\247\211\257NM\013\376\255\312\002\016\005\225\204\372\005\357ffh\300\232\326\232zd\262a5.b\222\227\323\364\3014z}ML\217\241VS\320#K\317\364G\310\245(\310\3679\246w,W\351]\240)\275\3339n\303\361\344\f\216l\351\237\355\312/\322@\253\222\324\277\365X\300\237\236\220O/\365nVF\007\354\314\013_\261R\322w7\002,\004\007A\372\244G\336\035!\265I\035%\035\377\323\360\217\343S\275Azz#\343\033\341\262\nd\306w,. \r\265/z$"
+	.string	"\373\324\245L'Q\325\234\263;}\212y0\241\034\24197\335\331\315\224\202w0\335\226t4\223\n\023\016\273\263]\352\035\234,\351\333\223\361]\307\1776\320j\214\360o\305\005<\3716\332\223\357y\342\254l\3169\033\3753\201\031\250\2214$\225S#\"\"\"I\222B\032\003q\005\304 \346$<\017\021\360,c\220\225\210\220$Ic\231 t\216\316\314\2023\351\307\230\307\321&\306.b\201\330\035"
+	.string	"v6\216$\2620\004;\334\364\305\0240\265"
+	.string	"$age\207\315\304\350\252\307\3503\223\236\\\266G\343\027\240\200\271 \307l\001\251\007\264\021 J\224|\267\331F\022\252wg\350#M\266\347\"\025Q`j\223\222g\205+\321\257c\243@\242\256\005n\274Q\251\275\372\265\320ja\177\321\364\245\374y\277\275T\351:1\321\210\312x\030\363\225\333\307\t\201\024\362?uO\333*\262b\366U=z\006\327o\355\020F\202\205\037\031t\212i\313\027\304\333V\336s\365\344/\006\231F\221i\267\003\254\225nJKi\370EA\fxJ\340&\025\331EJ\0371\326\0354\206\250)"
+	.string	"`\352i\220\313\230]5u\276c\f\317p\016x\302\034\350\300\275\325R\222\322(\023\023\233r\241\376\223\346\221,b\375\3001\tl/,\267\325\260\\\354Q\335\020^\361\274\251\253}\236\013\t\211\330\206\204\303\200hx\004\267\001\3069>\3675[\214)\340i"
+	.ascii	"\260W\017\312\f\243\346\224\307$\305\263\203\345\342\253\353"
+	.ascii	"\322\023\200;\333\020y/\305\006\021\036\230\307u\016\353B#\322"
+	.ascii	"\3609\230\261J\201\341:\035NTj0kDP\246\325fH\323>\265\305s\236"
+	.ascii	"{\004QB\342\324\326\251@\317C@B\273Wa\307qFnT2\374\n\024\354"
+	.ascii	"&\233\031\315\023`%[!@\004\024\240\324\354g\211\233\366nU\220"
+	.ascii	"\017\274\335\377a\354Y\274d;~\241\353F.\377;l\305\316\025\022"
+	.ascii	"a@Q\313_\361\021A#\003\235&\216\231\312t5\002Q!\033X\325\220"
+	.ascii	"I\236\353\221\272nx\205\257r\226j,2n\242\212\345\344\013Si\""
+	.ascii	"\340t~y\301!\354a\fwUq\253\340]p#\211\304T\327\035\222\261K~"
+	.ascii	"\023\037\322v#\251_\213\f\351\326\323\227\234P\001"
+	.text
+	.section	.gnu.lto_gyroFiltering.88.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\341\034MX"
+	.ascii	"Z\2118\036N@\020\332\351Z\376b\2114I\200\226\bZ\342W\0358N\324"
+	.ascii	"\300\275\327\374\006\357#AA\032\244\314\013\320(\335\030\245"
+	.ascii	"\217\303\250\016\f\223\325\037\300]\016\265\317@6b?\221y\241"
+	.ascii	"k%\24483\352/\370\013\376\202\277\340\277Z\223\335RJ)\315\001"
+	.ascii	"\240\001\352\001\274rtFZ\347\243\352lUg\365\235\215\357\374F"
+	.ascii	"g\177\347\306\300\245\312\007i\035B\364^\021\026w\270\201\352"
+	.ascii	"\220\270\336k\346\306\343\346\333c\277\276j\267=p\233\223&\336"
+	.ascii	"{\233Ze+d\253\334.t^\006\215\307Q\314\032t\334{[Ze\316\200\271"
+	.ascii	"\245Uoa\346v\346\336\321vk\337i\300+\367\306\270\023r/\336\023"
+	.ascii	"/![\025\352\033\333\252\261kl\253\2742;i<\267\353#W\230\202O"
+	.ascii	"\361\336\253\3746\3766\3425W\371\332WVUTXSRQP\312\344\223S\023"
+	.ascii	"\323\222R\022\322\221Q\021\321\220P\020\320\217O\017\317\216"
+	.ascii	"N\016\316\215M\r\315\214L\f\314\213K\013\313\n\362hU\343\373"
+	.ascii	"\312}\334Z9K#\353+\305\2662\312 \032\241\370\232x\325q\213\206"
+	.ascii	"\232\223\246\3522'\215\245(\2106\305\247\230\264\024\223\347"
+	.ascii	"\022\217:n\305P;l(#Sb\fRnD@\341\254\363\n]\231\003\355p\352\311"
+	.ascii	"\303$\376\344"
+	.string	"$\005\364&$\315\204\344\210/\031i%#2xR\264\221\242A\374\bH\033\001\201z\321\217&\372\001\203\017\371h!\037=<\350\331@\317;\377\261k\037\273\035\336S\327<u-\370\016]\353\320\351\360\034\034)\n~s\243mn\330\360\032\270\246\201\253\3413o-\363\346\3461\322\206\2216\375\205\255]\330L\360\026\027\315\342\242\004_9n\2511\033idj\002\256hA4\246\361f\006\031L\372\331C9\320\326\374\030geb\240\275\2602)\254\314P\f4\251\321\n\242I\315\\e\321F\2264\026\3750i(\214B\367\336~\266\253H[\272\037\267\356\275\354gij\315Y\315l\224b\346\017\314;\020\004\335\204yD\027\016\320S\002\232\260\253\377\330\251\225xu\021\267{\357U\001]\303WC\013[\035T\277\233\274\r)\363\305fI\214A\n\362\235|\323`\326\370MC\317\260\003{\0060n\033l"
+	.string	"\002\b\374\030so\312Z\027\351\356\241$-\220\314\251\034\337)\345N\342nsW\314\275H<\302\215\244\327p\\\030\177\3342\260\023\344\275d\335\344\376i\030w\256\003\034\367\336\245\366\343n\"\335.\332\305\273KR08\360*\314\234@\023\001\033\362\277\300\332\342\024{\302\372?\240w\250@GO\004\361\317Z[T\031 q\3048\343\314\r8\340}\306\335\203\206\277\300\345\223\365\275\367>\203\331\376\007\364\fQx\016\314L\242}\200!\357\275U\334<\272\007\004\3346Z\345\022\021x\237E`[\355\317Z\213BwW\346\213\314xK\177's\373\275\227\214\177\006\363X\337u\213\031\235\303z\257y\304\212\263"
+	.string	"+\316\\\3269"
+	.ascii	"\353,\302:oY\347\020Hg-\353\f\200u\006a\235?X\347,\2433\226\321"
+	.ascii	"\371\312\350l\365\316U\2523\325\321y\312:KY\347(\353\354Au\206"
+	.ascii	"::+\255s\322:?Yg'\325\271\351\350\314d\235\227\254\263\222uN"
+	.ascii	"R\235\221\216\316G\326\331Hu.::\023Y\347!\325Y\350\350\034d\235"
+	.string	"\201T\347\237\243\263\217u\356Q\235yT\347\035\325YGu\316yg\034\325\371\346\350lc\235kTg\232\243\363\214u\226Q\235cTg\230w~Q\235]\216\316-\326\231E\365\177\205/\326:\2176\273\234\007\233\227\277\360&|\365\016\357B\351\375\317\360\231\034m\304\302_[\353\232\360[t\365\364I\360\352$\317\342\253\373~E\3227\242\241\322;\031\247\301,\rIH\311O{\264\243G2:z\020>P\361g\357\301w`\204\364<*z\263\347\200\350\213\206\210\234\276\354\311\376v\365\340b\025*CFuEB\257C\016A/\004\024\204\203\224(7x\365\024\312W\373=\001\372\206\022)\2620\364\363\211\210>\377\323\343\303d\311aW\017\032z\365\264\360\253\375\b{\276\241B\212sA<5\f\n\316\0208M\"\345\001\212\373\331ArD\206\277\001zZ\244\253\377\374\372\210\354\370\300\365\350|\fB\202"
+	.string	"\201\376\200\301\207\016\217\232\006\244m'\347y\274\260\2477@O\363\272\372\317\005\274g\216\016\216\035\316\2171\373\350"
+	.ascii	"[I\3113"
+	.string	"\347&\351u-\330\374M\215\r\013+\250\320\325\203)x\365t\356\253\375r\324|Cq\024\241\334\320\340\210\233y\032\231\031\267\001W\243\253\007\337\334\332dl^\020kb\222\356\364\031\036\343\004\030/\274\351l14/Kf`\234\351.\270\264\334J\360f?o\341$8\213\025>\202\253\301\310\2748\332\313\2171\241F\344b\\>\004\020Z\336\205\245\345\311\317\334\003\357\240\253\007=\205WO\335\354\253\375\234\003\226o(\214b\317\275\2548\371\222+D\241\227\365\331\023\344\257\274N\223\024U\220\374\370\314\253\n+\013\266\317\220/\204\342\311x\221\243\r]\351\272\312Z\327L\250t\365\340\016^=\325\341\253\375r8~C]\336\311Q\rf\343Z\354\343 \345\251o\200\362\304\206DD\313\362Nn\3016\276\232\006\205[Q\277\t\227V/i&\253\335\372\024!\302\266\252\343w\366\304\220+b%\306\0340\212!"
+	.string	"&A\211\003*\230"
+	.string	",,\314\002\022/L\"i\"\354\002\b\224ba&\304&"
+	.string	"\023SNP\302\001\t\224$\302\304\224I\0366A\001X\230\262\002\023&\302\224-xe\355\367g0\222\320\206\300\262_^\t\360P\234\232\353\005\3706k.?\361m`?\025\334\307}\266U\256\357g\024\2725\253wrK\r\252\261Wk`5\365\210W\301#\336i\264\361\276s\304\217=\216\036\033\242Ys\351\204\243>\205Mh\226M\036\001\374\022\216\"\271\035\212\370\254\017\340U\251Ys\031\355\313l\274\267\254h\353E\204x"
+	.string	"~\353\333,\307\322\027Y\353C\274\017\237Yb\231/\202\360\204\253\bJ\264\276\t\337\356@\374\207\007\340w\200\2305\227\203\034m\300\264\247a\255\353\250 \210o\300\300\351\bk\213\017\337|o\033\334\360R\216\"\037\311\003\256u,\326\026-l\253Y\337|\255\2561\021\247\374S\275\223\033\353g`\031\221\201\365;N\230S\314\365\004B9\356\263\323\341&uU\304\305\352\274\372~\366L\220\035M\266(\017.\366\334y\353\213\365\004\027\"Q\002Q<\031T\330\017y\"'V\031\253\323i[\r\373\316kg\266\r6\355\030\317)\244\255\336Wh{!'>j\365I\303\273\344;\271W8[\365\366\320\025\016y/\212*~\030\376\307z#n\225\363>[\345l\253U\277"
+	.ascii	"sp\312]_\267Sy\242\372\036<\246\236Jj*\352=\274\324\236^\236"
+	.ascii	"\013x\317(\273\035u-\320\351\360\340\264\244\t\352WPA\371PI\345"
+	.ascii	"\323;}2\207\034\2168\024n<=\\\2157\2676\032NL\257F\270\324\364"
+	.ascii	"3\270\264^\006\3237\275\216t\211I\351\223~\351u\242\230\341X"
+	.ascii	"\302\340\250\007\2029\250\242\250-\221J5\"2\022D\222$\3110\006"
+	.ascii	"\002\r\210!\fJH\251\003\022 \022I\210EI\036C\260iI\265\306\001"
+	.ascii	"c\220u\005,\006\003\364\300\202"
+	.string	",\243\277\2361b!li\374\241\207\211:c\274\247\234R\231Z\210\323\377q\020t\006\271G\307OZ\024\026m\314\320nb5\242\t\372@\361GX\323\301^\220`\200D\327t\355"
+	.ascii	":\260\003&\257\260\334\226\302S\034F1/\022X\373&\330\220\227"
+	.ascii	"e)\276\277\020\342\304\224\322\204\235\213\027\327p\273;\304"
+	.ascii	"X\207\324\304\270n\004\251\026\0237sF \021\250\006\252\201F\373"
+	.ascii	"\350\352\240\2412\322\223\360\330\365\341M\3054\304\275}?\315"
+	.ascii	"K\334[\334\021\n\372\"\007A^\306\344( \222\364\323\346\3463\321"
+	.ascii	"\362_\325\363\204\202x\001\243c\352h\226\352\270\002\343\370"
+	.ascii	"\312T\002s`\206,\235\013\217h\343\032\217\220\317\362\365.\272"
+	.ascii	"\022+d\253\206\244\340\357\222\303.\275\216%\201\016P\307\213"
+	.ascii	";\035\212\344)\336,\203\373u\373->\310\242\006Dc\202\237|\234"
+	.ascii	"]\351\024\301g_>\304\326P)r\204\312W\362@]CJi\263\0333\024\310"
+	.ascii	"\307\212\243\227u\343\267\306Z\252x\003\263y\302\336\003G\306"
+	.ascii	"\266\254\304A\033\032\306_:<(\360\225\3637\030V\2760\302\373"
+	.ascii	"A\334\306\373\263\240\301\333\027D~K\341\337\221\222\360\311"
+	.ascii	"\025ex\210\274\\\245\231\021\303\326\274\r\234y\326\214B\314"
+	.ascii	"\b2\273\2561\252\245Q\306\340\326\334V\017=\217\327\020\224B"
+	.ascii	"s\204\002u\313\341\304\270\321\225\226\376[6\334b\315E\350\250"
+	.ascii	"\034\273\341D\370x\352d\177\333B\210\221\343\202\331\206M\217"
+	.ascii	"K4\327\302\201\217\333\242&\332P\242\275\304\204\307-\177\rF"
+	.ascii	"q\226\331\221\213R\346\274\204~\025$\201K\3303\350V\336\004\261"
+	.ascii	"^\223\027\260AX\004\247\327=s~\036\335Ao\335:\202\261\013\325"
+	.ascii	"\223\361\232\315\345\365\240\361_\304\245R\027\226%\341\370\r"
+	.ascii	"*\214\326[7\3212\361w\274\203=z\222^u\200\267\\\nbQ;\002\336"
+	.ascii	"z\251\304 Q\266\340\270\203\301\307\302\".y\2436\022\376f\363"
+	.ascii	"P\336`\262\2224|>\326C3dN\232:\003\200$\352\330TR\023\212\337"
+	.ascii	"9\203\3453"
+	.string	"\225Q\037~\025\227\355h%\021Jl\375\026\273Z\372\236h\252\255C\020Y\2149\311\004 #\245\251\251NN\277\317\024\344\361_\260\242\362h\003\377\020\325\326\025\240X\340=\2462\\1\301[~\fI-q\002\300\323\2059\324T?(\006\037\217\317\327sb\211\033f\327\033r)l\2705\303I\277\204!\334>\361-\021\214`Y\354'-\203'\256J\373\034+7\317\322\244\357\375Z`H\"\371\3313\240\312\246du\206(\254\243\227\320T\022Q\341a\2054ayk\203\314M\236\343\022\036^;b=\314\025t\0171\260\365\003N\347\257\2004l1\2356i3\0139\377\032\031f\216\363\264\027\260\025\240\343\201\224\n\343`\031\270lo\365\003\312M(Zc\316o-\024SG\tR4J\215S\304 N\021\304\251b\212(\304(\203q\361c\272m\006q\352\230\"\0161\312@L\035\245DA\307\315\223q"
+	.string	"as\344A\225\364\327J\250\303\374\334\177\257\037\342$\333"
+	.ascii	"~\b"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.89.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\260\003]\032"
+	.string	"\206r\253H\260XQ:\301\347\317\2262<\"8g(v\372\366\253\037\013iW\307\321.,/\364\371\305\nW}V\300\307\327\316\023Z\221\r\261q=!\307\343\333\f\316\013\340\357\020\220\017\013(\253cV\325\307P\017B\310\336r\247\024\224"
+	.string	"\214"
+	.string	"\226"
+	.ascii	"\265\346jN]A<E0\245\275c\217\266\245\264o\364 ;?\262\322\007"
+	.ascii	"\324Z\303\247\244\326\234\0033\020O\235;\001\360T<\n<\215 a\307"
+	.ascii	"\262"
+	.string	"\347p-d\212\264\324xN\265\346R{\303\373\231\273\251le\027C\220\316\2252\037\306\306s\3613\241\207\273c\230\202\243b\224eF\220\320\301)\2006!\364|$\325\361\3423\264\351}\356\200\361\323U1b{\361\r`\253M\004\265\326\013\271\004\262\365H\031\332\324Z-\177lA\367\313m\337\260\375\301^\031\001\362?\247\276\231\300\323\357\205<\201\315\327\024#\210\320L\376\354\034\217\334\233}Yk\345\361\326\260g\256\273e~\364\243,\035\363\244\033\300\221\356\021\224\206\221\322/\241\264\030J\207\2404\bJS*=-\275TZN\351\033\240I\242\233\262+\332\262Ur\265\305\217K\225B\227r<\351G\372u_\373EfM\252\223\006\256\311\350\007\317\357yD2\023\\\321\257\251\326\312A|\316\337y<\365\207\234\310\316u)^\203\352UH)zj\n\366-\3009\271\217\241\235\223\023\314\372MJ\330\247"
+	.ascii	"G\344[\251\313\317\025p\351\302<\021\027\265/{\032\217yC\001"
+	.ascii	"\303\025\367\343\206;y\265'\231\005w\246\013\255i&\177#\316d"
+	.ascii	"\037\005\177\351K@\250V+\360\224\356{\277\340bh\007di&\177\273"
+	.ascii	"s\256\\\231]\036mG\217\374\371;\227&J\355\311\254+\271\021k\255"
+	.ascii	"\023|\245\373Z>\321\251I\270\\\340\251\334\357~\341\n\214\037"
+	.ascii	"\220\243\327Z\353\356\255\346\337\020"
+	.string	":+>R\213\375#Gb&>\221_f\n\261\026\n\325\214m`\271Z\032rpX.\026L'\246be\020\301:\300\272Q\301X',\340\274Z9\252\022:.\235\325J\205\362\352\301\013\226\342&\025\203\275b8\254X\n\247\245r\245V\260X\352\001\215_&X\260T\316\353\005K\215\271\372\031\256\310\245\307\212\236\017\374e`L\314\332f\266=\342\336\374\"\177\301\365`Q\363\311\232\003X \033%Qkw\360 \377\2636>\313\363poQ\276;\035\032\3429a\001\367\346\021\307\234Y\212ck>.\220\203\217+m|\322\006\037wf\013\350d\374h1z|\t\236\004D\25018\344\004N!cJd\202\031M\222\264\001\220\002\031\262b\007\020xW\222\244\320\030|\243\346j\252\247D<\3364\343+\023\r\232\341\236\240w\037\0051\204\225\262\205\343\b\213\341\324\210e\352\230\005\277O\316c/\377v"
+	.ascii	"\004\201\366%\250\310j\021g\001\323S\272V\025\177\027\375\221"
+	.ascii	"%+~\372\274\004\006>\212\302\023\316\203\310$\374E\215\376g\347"
+	.ascii	"\305\245\263\032\272C\355>{\210\320<@QvG\362\215\007\335\254"
+	.ascii	"\362ZA6\342\t\353\271()\263u/p^}+7h\250"
+	.text
+	.section	.gnu.lto_gyroReadSensorTemperature.90.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\305\f"
+	.string	"VVTC"
+	.string	"Q5\0358.i\037S\371\376-|{\3365\216gt\\\200E\034-\371T\364Nt\346\335\2765\202H\033\031\230L\344\200\rTI\360\252\365\377\273\327\316H{\360\3134j\240\245\327@uo\262wJ\001>"
+	.string	"B"
+	.string	"@"
+	.string	"\273\313\225\274\262\275\316S\266Wj\342\3405:A\377\251;X\231n\210\306\360\332\210S\2152\222\001#\031A\232\002\330\211\364\324\347\207\3613\347\007\203\335\365\024\215\"\356z\333\rl/\260\337\t\264\344J\247\277\215\230p\214?\221c\027\304\254\307\276\252\r\024\266=\366\304\366\234\366Qo\341y\271\341"
+	.string	"v\305X\215\335\020\026'"
+	.string	"y\025P\276\342\301\266\277\342,<\006\021\204\304\360@\n\022\035\\\350\b.\3623H\325_t\026rw/\302\370\324g\311Z\257\020\r'\3544jQ\177\333i\204\225\f4y\330\266\360\325G\300\356<\225\241\022\333]\314\353)\006\022\215\035(q\316\3542\234\264\204}m\003^\367q4\017B\234\271t\236\006\t\334\347u\037G\363q\234\t\0206\\\306\373\270\313"
+	.string	"w\0254\036w\241\353<nR\356\265\245\245J\r\210\364\343\030`\0012"
+	.string	"Y)\007\222K\2056\231W\035\006\005\221\330\346,\360\001\033"
+	.ascii	"X\211\"\023/\302h\241\217]\204@\300\3060\024\312\344-\2038Me"
+	.ascii	"c:\300\030c\210!;\f\206\204\244\320\320\210\025\324\260\002/"
+	.ascii	"\"\273&\nM\264\225\006>\312\004y*\004 u\320\252\226\246h\n\n"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.91.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\200\t\315("
+	.string	"\312C\310\016G\200\234Q:\237i\033x\013\373\026\"G\006\27266\245t\362\351\321\0304Z\300fFA\037\264\375R\326\265\2472\256\220~gU\337\205\030\034R\2319\215\370G\251\234\330\325d\002\365|7\263\366g$\203\020\262eJ\001\327"
+	.string	"\307"
+	.string	"\335"
+	.ascii	"E\245W\026?\r\304\"\013^z\327\376\224SQ\361\242R\207J\203\"\356"
+	.ascii	"(\253\3657\364\322\n\316\227\003\212\017`\276\244.\2563_\332"
+	.ascii	"*l\332K\222\346%\233\354\305a\035@,\322\302\n\235Z\353\216\006"
+	.ascii	"\361O\026o\334.=\207\273\331j\264\037\237\263\307,I\272K\276"
+	.ascii	"\217\"\\|\300\336s\244\2013\277!i@\307\342\200\004y\374\366t"
+	.ascii	"\333\323q\307\326\266\234$jA\022\025\344qZ\216\377\3440\376@"
+	.ascii	"\222\237p}H\"\025$\347\201\250\340\215\367\374\314\357FU\213"
+	.ascii	"5{&@\371\231\206\370\344MTp\370\262\306IR\207\343*\354\006\\"
+	.ascii	"A2\bS\"\274\325\027\006\320i)\016\026?\300&3Wk}\324oHn\317\204"
+	.ascii	"Z\253\327\007\f\336@\267o\3016\004\373\034\013\177:\207\365W"
+	.ascii	"\213U\001\rj\305\346\261\035\342bF\234\265\326\007>\230\207!"
+	.ascii	"\341\023y\351\243\023{\337\t\363\345\351\005!\227\331\024\246"
+	.ascii	"=\263\213MK\245\354\223\225\376\260\313\265\316\\\007\225k s"
+	.ascii	"\235+\3278s}+\3276s]{\326}\036\353\246\345z\311\365\021\330\230"
+	.ascii	"\020\001~\310\234Ze\234\335\251_e\226\221k\375S?\325\177\345"
+	.ascii	"\317\372\261n\332?j\371[\2642a\030\027\377K\227{Yz\026/\327\203"
+	.ascii	"\252\271\030i\210W\017\316\227\271\275\316\334b-\277Z:\226\267"
+	.ascii	"^\203\365/\206D-e\265V\007\347K\003\344u\246\025\226\007\205"
+	.ascii	"]t\252\254<(\364\272\224\033U<\212_\345A!X\223Z+\355\345\324"
+	.ascii	"\322\003\275\263[\017\225j\363[\225\213\216\247\312F\267r\243"
+	.ascii	"\257\032\272\235:^M\314\250\276\236\200\215\035\323F}9\237\303"
+	.ascii	"\363\211\030C\206\fx|p\224\310Z\243$@y\031\024v\231\225U\331"
+	.ascii	"3\307\341\t\r\005\330h\n\341\226\2232\300>\313\337d\250\211\021"
+	.ascii	"\275\214\367\255c\r\237\345d\033\206\206\276\007b5\352ca\343"
+	.ascii	"\345k\005\3559\314U\330\022\222J\231\203Y\243\035\214l\234\266"
+	.ascii	"\216o\345\242\217q( fe\243c\361\020@\254FouR\216\220\213\331"
+	.ascii	"\224(6\203\257QB Vk\205`\177\270\030\210\347\021v\321y\251\346"
+	.ascii	"Wn\240,\246=\363\311\\D\331Wo\361\234R\2514>\330Z\231\361\317"
+	.ascii	"\\\312\221\nU\306\3672\331Yk\357O~\001\363\345\241*\261\311\221"
+	.string	"Z\253\202.\333d\017F\0346\3041\374\330C\203#$\036\210]\022\322QR\211\017I\273\022!\214H\354< %\355\032\020\360\221\211\017H;\024GGH;Z\221\351d\245?|\216)\371b\242M\376\230\t\275\305\223\243R\366\021\336\366\3362\313!4\0306\245=H\216F\214k\234\266\316\267\326\332\303-\025\362-\007@\306\007GGO\2724\202\033\026r\232\276\274B\2310\f\bOh\250\273q\355\217\243\211\326\007\327\366\b\262\005\035]\264<\2166\372V\020\375Q\313\036\332\035J{g\250\003\004\345\032\346\320\302q\322\1779\0058\3020'7\230\366\214\326\200lL\201\321\340\t\r\201hT\0334\232h\201T+#\367\2233\272hc\030m\364*9z#\203\205\261>\260}1\205\346\t\306f\370\340\266\005\225\227\023'\236\320\020w^Y\246*\023m\200\303\250\241<\344\23032\"#A\222\024$\351"
+	.ascii	"\003\221\031b\035\022\240#A\210\363@\232@((\214\255:\303\001"
+	.ascii	"w\0340\370\307\343\205\222\3572o*i\240\254i\021N\233u\256\236"
+	.ascii	"s\b"
+	.string	"\"\017\251\345\331\220\024\302\2479\3456v\314c\001\352\250\311\207\350~u\242\203$\315FV\216\374R-\242\375B`\343\326V\b\347ZG\305\343YE\226L\212\367\252\370P\220e\200\264.\037\266\373\325\211\016\2224\033[vA%Zjj\327 \337e\3772\200\327\005\244\336\222-t,aa\005SR\235\243\374\242\351\003~T\223AQ\310F\364\203\351\325\276\366\266\215\247\224\255&\003\352\002\216\262\006IH *@O\366\221\3631F\313\372\333ub\360\367O\214\016\341\343\340\034\365\337h?/_2\225\335\304\243\246\004\200D^\323\027J,\231\374\202\217\003a\216\357\r\036l\203(\305\327\323\323\376\265\214\307L\224\215h\357\220j%\222\256WP8\211\221\341t\257\251\342}\250b\330\352\027\034\333\351\316\264a\214\341\303\r\026\034\300\270(\204\336G.\227'3e\266\232\356\023\342W\224}\344y|b\2625"
+	.ascii	"N\033\210\325\223?\341\271\024\254\302\347\360\223f\215p] \363"
+	.ascii	"K\030\302<\370%\370\022\235\331\013\230\2015\340\037"
+	.text
+	.section	.gnu.lto_gyroGetTemperature.92.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375 \365\275\006"
+	.string	"\362L/3pM\322\001\240\213&@\377\330\023\b\263\304Es\254\371\320\200\031\003\252\215\020\273m\357\364)\273t\273\365\252\276[\275sW\020\376\b>\342\320\262\277\224)\005\306\\\334\33384\370\034\324d`\323<4@4\314\203\355r`\027\221yM\302\271\327\244k\257\237T\004J=\366E~E\177\303\033N\276:\3639\321Y\252\300\005\225!\373\232R3\354\003\254~l\247S\007<H\254\203Pv+B+{\302J8lwl\311\3778H\307\3212AM\t\035&\024#*\273\333\bn\020\235\345\013\2423\325x|F\377!g\360\200R*kz\006,\354\256\263\262,n\275m\005\333\026\333\030\001\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroOverflowDetected.93.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375 \347e\006"
+	.string	"RL-3Pm\222\016$\243<&\201\252\237u\201\230\332\256\273\265\346B\355V\nk\366\357\366\352\321\021J\277\370gg\246\030\210D\361\026\036\206Q\354\320\270E\262e\n_,\356i\036\332\364\334\224\301L-\003\341\020\321.oj\026\203\235\004\346\265\t\347^\253\\Y\026Bv\340a\237\257G?\250\273\261f\203\255*\335M@%d\003\027\036L\371\253\203\f\343\013\220\2319\013\37582\202\221\211UQH&(\005%I$\021\216\237\363\225\025\0268S\2754@\005\035%\024 '\231Wc\031\245\212\324\355\250\r\037\321Heu\212\002\f\2319V\226Eg\375\021\376\204\277\"\007"
+	.ascii	"2\001\0238#(\016%\256\321K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_gyroYawSpinDetected.94.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375 \347m\006"
+	.string	"\022\314,3Pm\222\016\004\210,A@\212\320\260\2120<x\005\240h5\332\255\024\326\354\337\355\325\243#\224~\361\317\316L1\020\211\342-<\f\243\330\241q\213d\313\024[*\356e\036\332\364\334\204\271L\r\003\341\020\321,oj\025\203\235\304\345\265\t\347^\243\\Y\006Bv\320a\236oG=\250\033:\243\301V\225\256&\240\022\262\201\213\016\216\376\342 \303\370\002$\003\37582\202\217\220U\221H\346gt\222#R\210\350\337<e\205\205\315T/\215O\301\206\t\005HI\346\325XF\251\"u\313\321\006\217\210\244\2628E\001\206\314\034+\313\242\263\376\b\177\302_\021\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroAbsRateDps.95.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\255\t"
+	.string	"\026SD<0\345(\035\200\223\241(\227\333\353l\034(|\222hB\263v\0065\230\361\2218N\267\330\355\327_\202\244\021\304`zx\275\032\neD\022U\310\317O\310\n\n\f7\277\222M\244L)4"
+	.string	"1"
+	.string	"2"
+	.string	"''\243<\032\252\224\247\204c#F\333\r;\203#p\217\371\003\356QC\216z\242\374\257\034b\005\213i\271R\317\201\207\335u\266\\\036\267\336\366\202\355\217}M\377\246\351\324\364\271\002"
+	.string	"\004\\\207\311v;j\005v&\316Hl\237\354\215\355L\373)W9=4\214\tv?P^v\367c\006\315cg\263\355\233<\276\270\213e\034\001\273\353`{\217Q$\210\354n\003\313[@\177\344\321\026\246|\353\3217q\217W\316\200\231*kv\230J\005\261\277\355\356Z_\216\017\003 \t#\264Y\004\362\276\214\210\016\374<\2604\002\273\022)$\321\211>\260\003)\330\233\030}]\205\347}\335&\334o\253\257\250\035\225\256\234\032\365,\231k\352\003\260h\016\f"
+	.ascii	"2\241\031h`DC5\021\274 \334\230MK\272\214\342\324x\035\230xp"
+	.ascii	"\327H\265b\022&\031"
+	.text
+	.section	.gnu.lto_dynThrottle.96.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\315\t"
+	.string	"\366\021@7@\217\322\001\233\2763\376T\\\343\277k7\366\241c\004c\316\302\232\264\273-wf\03373\t=\250\221\261!\245c\370\231O\003-\301KJ|\nj\033![\312\224\0020"
+	.string	"-"
+	.string	"/"
+	.string	"\337\006\007A\252dA\322\262\273\331\346\002\330\257\370"
+	.string	"\354\227j\334{z\376E\3160\242*!\231@O\314\302\356:I\246\213[o\333\300v\202}N\216O\353\323\371\36431\205q\225\224\335R\350\262\255\353\244\303\266gk\362+\203\006\330EQ\231\354.\202\0172\277l\373 \017\361l0\006\271\222j\360\251\252\254\221\007x\024\013\325Z+\204\341K\305n\250\340\232\212\261.\275\364\032YF\037\242\f\355\017\224\232a?\256\236\260\257\376\353\031\236\210\256\323\266\207.\343\016G\333(\0342n\323\270\217\207\313>\020\r\022Yg\3432\316\200\265\t\317\226u\232\266e\232o\037WO\230nB*\372\242b\212Q\215\032\025"
+	.ascii	"2\241e(\360\376\243\242\020n*\013p5\025\245\030a\024\027\"\250"
+	.ascii	"\274D\265B\225\030\\\3355\346X\256\341\"\023X[\257\340\301\222"
+	.ascii	"(\313\006\2402\232\332\371\004"
+	.text
+	.section	.gnu.lto_dynLpfGyroUpdate.97.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\315\007\235*"
+	.string	"\352J$\020E`\346M:\023\362>ZK;\250\311\246\3609\341\340\005\201\034\024\253|\275\260\352@\340Z\020\002\371\354,\335g\207\336\212\035\352\270pE\203\004\302\234}\271f\024&\260\312\305n\360Fk\366f-!\204\020\271\223\f\352"
+	.string	"\334"
+	.string	"\362"
+	.ascii	"n\342\2205\251\273\367BX\217\362\271\334\213\215\25311\354\336"
+	.ascii	"\3734>\223}\334\245\306/\327\275\216:2\257\272{\323\206GY\301"
+	.ascii	"j\203\331w\264}\314|\313|-?;\036\215\337\230w\357\2313\270{/"
+	.ascii	"\0247\255G\227~\224\036=_\224\036e>2\337yZ\330M\"[ny\361s\357"
+	.ascii	"%\366\222\225\373g\3329\330\307\017"
+	.string	"\005\177@_\217\267\252)z\266=\362U\251\363\313\214.\251\274\361\241\"6\250J)\341\n\373\317\206\035\210\204\313\353>\257\245\355\t\247\370\030byg0A\333\226]\205J\270\272\256\252Rm_\365\220\211\341A\302\325\365\024\310Q\240\022\311\246e\317\323\311K\315\217\277\361!\344<r\363U\347L\034\266\335.|\343\303\310\271t\357\375\226\333\035\312,kU\251{/\333\244\222\353Lt\346\207`\346\013\314*Sek\310)Y\366\216mw\243n\310:&\361f\2112\266\317|\005=\313\2672{\357\275\321<\225\276Q0\347p\330?\314l\342c\246\326{\357\002\376\333\341N\360\307\2162U\225}\262*=\372~\260\024c\207\206e\357\230\323\262~\336\006c\376y;\t\324-?\335\362\360\226\235\232\276vf2\360.g\341-/\035\355W\032\3600\347\244\2039#\tY\016p\313G=\313F<\313E\250e"
+	.string	">\313D\267\034\274\345\241[\006\366,\377x\226\205P\313>\3252O\265\274\336\262z\313\351j\031M-\237\252\345N-[\324\362\243~tc\312\227\311\271\267\307]\240\033\207\222\201\3620?\230\177\355\357\362\223\371n\347e\233@\206%\312\027~\033\373\300p\023\013\231\330\204U\215\317\2666\303\006\354\341w\216f\020\216g\267s\334\022\025v\264\016Q?\t\004\3132\365P3K\240`\237\f\366\222V\337`a\017\365\333\236\341+\213\234\326\352\361D\251\"\227tG\320"
+	.ascii	"\233\251\333\355\327\300N\367X\370\034\fr~}\"\313f\031Z*\324"
+	.ascii	"o.\247\201A\003>\234\307\331\320\341\303\207\364\250=7\323\243"
+	.ascii	"O"
+	.string	"\346\021\266P\253r'\320&h\rm0\036~*\365\365\2250\351\234\315\333L\361\3078\204\b\021\351Q_\237\355\247\237e\031\273.6\243\325#\312\371\346\262\346\213I\207\327\302n9$\233\265\273y}$\037\265\327F\335\266\006Au\332j\037\355\264\223\344\220ug\243\375\255A#\236\006\315Y%\355\251\241Zm\016[\251\237\332\332qj~\273\035v7\221Q\262\336\336\244\331$\356r\204\273\273A8\356\305*\260\324N\2356\225Z\251\227\372^\036\202\031V,h\2348\257&\2441\252\214\025R\244(^\311\240\352U\265\270\272*\032W\\\255L\025U4\326PA\2642\026\255^TY\021_\2608\341\202He\264\"F\t\340\"\214*#\361\252X4\022}iX?o'\331\362\347\270\003(\016\253\263\206\032\214\357\366\341\334\317@\363\t\034\320II\377\345\342\254\201\005\223\332@#1\315\326\236\254Q\037u"
+	.string	"&G1\244\275*\234\374\356\b\205\303\007\t\n\024\340\250\377\007\303jg\324 \226j\354\320>&fE\313\257\301\330\366\206\277\333\037\004\331\207\207o\370\001\275\203\017,\352\303\247\250H-\007\234/\356"
+	.string	"\364"
+	.string	"h\032K3v]\016\312\224tz\366\200\2245f\017\373S\007\307k0\366\315\251M\215\316\245\303#\365\016\250#\265\275r5?\316\270\254OG\352\246Fbfi\203\364B`\203M\324\314G*G+\366I\346\327\2610\232\223d>\222\235\356Xv\265\005\001\200\237\250q0\304\fcL\215\210\210H\222$i\f\240\002\221\031#\363\021\2201T53\211\332\016\374D\245)\013\274\305}\fY)n\033]\2657\r\3138\202\006\355\231\250\370M\222r\305-\320\266\033\340j\2357\362\325\357>\261\0018v\371L\312\271\210\356I\217\241\034\227\334\244\372\342\201^?\t"
+	.ascii	"\3319\212\373{Vc\330I\342\306\n\215\233\314\201\274\207\305\247"
+	.ascii	",\340\220\333\035\316\201\374`\263!5V\250\0131(xV\021\304+\020"
+	.ascii	"\372:\224a\216\206\321\206\021\365\240\314\274k\267lY\262+\214"
+	.ascii	"\373\216!\035\31604<\353\bh\023\260\243BWA\374*\230*]\n\020\363"
+	.ascii	"r\002*\312R\303)0\026\3601\312\220s\025A$\003\022\317\007\031"
+	.ascii	"\210L\221\211\216\003i\343\275g]!8{\300\241l\257\035T\256\212"
+	.ascii	"U\2668\305\206\341\033j/F\235\001\370&\307\341\314\271\026\261"
+	.ascii	"\177\314\025d\020\t\227\3519\307\325\005j\006^mVd\207VB/\211"
+	.ascii	"\317\376X\306\366\302\023Z0';\231\2567P\262\206\362\250\024\347"
+	.ascii	"r\377b\240\232\326\203\342\305\tqn\263\007wk\032\037\007\334"
+	.ascii	",\bY\351\024\265u\367\340|\306\374\001"
+	.text
+	.section	.gnu.lto_initYawSpinRecovery.98.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`}\003\035\032"
+	.string	"v\361\253J\220\230U:\232\001\361\222\023\032\365\264\323\371\031Op\365\375\336\320\242n16\340p\243\024\271\316\025\320\333\201\226o\3317\007oz\221 Ne*"
+	.string	"F\022\210\202\227,\020\001\254\300\2205^|\234\034\020\273\214@kd\023\271S\n\221"
+	.string	"\213"
+	.string	"\235"
+	.string	"vy:\317\343?\227\2160\201\366\241\233\261\362X\330\375\260Q\253\357\202\317\303\0049\276\212#a\360\210\274\007\247\226\240:\265\375i\237\367\036\355B\036zU\353\013\241\243Z+\0047P\235&8\001\362t\374"
+	.string	"\362\3244\333\351\276\031\265\300\256\350\006\204\252\265\266V\306i\247\343N\232\377\273\202\236\250_\223\020\207s\032\374\334\301\265\370x\340\307\033=PlMB\\\213o\216\215$"
+	.string	"4\244\301\302\235\330\231\302Pk\365\334\301\261\270\311\333~\331\216\2617F\rJ\237\234\231\305v\210\013\201\251j\315\241\340\003y\220\230\257;\365\210\331\374\316\214<\375\246pKA\271\236Pm\026m\237mn\f\373[,\026\257x\177\354\226O\227/\272Y\027\372W\237N\3357t\323O\217tz?=\307\351\0038\020\365c\322c'\334&_UQ\214\252DJ\244\306\213~\337?\364\265o\237\310\027\272,\3620@\315\247\nH\221c\247\344\251\326\232\341\300\007\355\3226'2\035\262\004\225\343\325Z\337\303.m\002>\323\2117\276\3160\257\027y\372\337\027\360`\342\345z<5\243\177b\031\351\224\324\316\365\324\251\002 7nj\037\374\270Cw\204\343\b\321\224rW;\356\201\327"
+	.ascii	"\243gE'\347\203\265\345:\240\242S\3056\213\036\357!\271Z\326"
+	.ascii	"^\370\027$=N\277&\242\0356\2443\210\262#\216\273-;\225\334\262"
+	.ascii	"\324f\361J \222vW\270\245&\037\362\003\377r\345\t\352\tgb9\320"
+	.ascii	"\020\310\310\016}#\263\227\304\013\252>D\374\"v"
+	.string	"R\375\bN,\017\212\027td\246\237\234\213Zq\236\233;5\226q\231\311\324\270`-\232\030\f\026\203qu\2301\256\231\227\017\257\031\017.\232W\371a&&3{\311djV\257\032\327\006\022.\016%\\0\226a\\b2\233\230\326L\026\233\321\274f-\032\020.X\013F6k\271\030pL\304K\326\252\211\305d\255\322W\373X\367\307\272\335\223\233\321|\222?\370\225\217\322\212\246\032\343\334\353vJ7\243mYrQTpr\013N\377\206\254\220\344\026\034\337\344\007~\225c\227t3\332\377\206\244\213B\025E\n\261\2666\223\353/9\023\017]F2\022yj\242'J\007\017\335= `\002\031B\243\007\2130GM\233f\235\315\220afQ\006\016\326\231\316\316\t\253\240\222\365\262=P\265hu]\341\221\225\026i\355\323j\264\325\266\026!\354\243\272Vw1\177\036X\354\240\270\322\220\005\026NA*\231"
+	.ascii	"\310\r\004q\367\3455\215\264\035\262J\2452 !\301\235\r'\221,"
+	.ascii	"f\303ziO\013-\343\314\252\017\346\205\004\b\267\255\343\256&"
+	.ascii	"\030;}\311\214_f\274\266\264w\034A\232>9>\340\314u\345\221\342"
+	.ascii	"\341 \257V\276]\026\236"
+	.text
+	.section	.gnu.lto_gyroReadSensor.part.0.124.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`L\0015\016"
+	.string	"\026\233`E"
+	.string	"\223\223\016\370\367D\262\226\3562ho6\333\231\266GKx\022\013\215\034Qt\256_S\006\330\227\317\203\030\2427mn\020\3558\225\274\317\\\352\022"
+	.string	"\322\n\251\273\342y\013\354[\221,U5\336\"\262\267\224)\005N"
+	.string	"G"
+	.string	"P"
+	.string	"\376\n\243\244\234dl\033%\005\345\356_+\206D\203*\003N\220\335/{\324\021\357\0165c\347gj\205\341\360\036z\360H\255f\256p\201\227c\006\300\n\006\206v\210\340\371\353\251Z\275d\nx\024Q\331]\177:\334\330m?\260\315\300\276+1\rcZa:\377\375\0271!Q\342\355\306\364\fY\020\321\006\n\333\267\377:\331 \033e\203\254\371\357t\227\211\300\267\034d\254i\337\3467\250\273L\017\260\313\322Qc\3673y\264\202\317\243\277\207\260\307\317\007`\217\016:\222\"G\205\376'R\236\216*\215\377\342\251\022X\370\200I!\266)\\F\tA\fR(\325A\r\217gs\343\2270\273\345.J\006Z\266v\034R\311\316\3566hq\201\363K<\372&\354\361\257\277F\307\373"
+	.string	"\304%{Ri\254\361p\225e\007\233\306\215D\020H\274r\242m\246\t\031\267i\334H\304e#\226\b-\331\312\306e'\005\254U\020m\231\005M\3332\220\355<\\e9M\334\310Q\325\277\376\371\201cC\376\035\006U\245Vq\321\027+\2040VC\330f9\215.\301\316\f\322\201\226\006\032"
+	.string	"_E\211z\005\306\t1\374#\024\341* H\023X\234p\b\3162P\214\253\206{\305\351e\223-k\200\367"
+	.ascii	"\n\227\r\363\231A$\230\316\331\207v.\250\211\254:-\331j\340O"
+	.ascii	"]~m\301\003"
+	.text
+	.section	.gnu.lto_gyroAccumulateSample.part.0.128.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\344\001=\r"
+	.string	"\326\225O@"
+	.string	"S\225\016\300\376\222\b\013$3\370\353x\344\373\177\376|,p\226\321\005\351\354\216GP\n^+t\367\b"
+	.string	"\307\350\023\270\273\353X\372\377\377\376\347\035\002&Fe\323\340k\227(\260m\023)S\n9"
+	.string	";"
+	.string	"D"
+	.string	"-\221\255i\207\017a[\244\301#[\307_\253\245|\310\201\001\346cw\267C\355\360\3215\263\221\357\231H\327\267\236\236\351\364\034\360\214\302`w]\331p\303\333\326\330F`g\205\n\354\b'\021/8vW3\342\257\t\276\207CS\b\345\275C?49\274j\250\036\254\257\224%\251*k\366l5egZ3\235\231>\210\345\200\210\335\f%$\313\001~ \354\007\367\354\316G<\006f\370\301'\357\031\300\b\217\330\005%YUF\f\221\2738\214\357\305-29T\325P$\254\324\026,V$\270\212\024\361\202\"\177|\327\023\016\261p\207\305"
+	.ascii	"&\264\206\267\3036\346%\034\202\t\336d\270.\324\331b\307E\020"
+	.ascii	"'n \217\203\317\266\351\342\226!`\016\002\247\333$p\\\267i\266"
+	.ascii	"\363\331j\312\rN\261\222Z\260\252\252l\013\310\273\036\333Tn"
+	.ascii	"\304\0056\356:\rN\201\325n). \300\002\2412\312\003\202\022\243"
+	.ascii	"u\003\227ot\016\200\2613\343\206\310\200XTS\337\315p8\346\016"
+	.ascii	"\021o!\334\371`\3757\265\321\232.\310\3349\230\027g\317\235\f"
+	.ascii	"\371\223\313\2331ga\202\230\025\203\351\222<\200\217s\177\254"
+	.ascii	"\365<=d\026\346\274\3242\302ba;\305\202\026\227\365\013\200\026"
+	.ascii	"\317\032\035\277\363\3325\006"
+	.text
+	.section	.gnu.lto_gyroProcessSensorSample.part.0.131.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\243\004\355\030"
+	.string	"V\252\225H\260\330Mc\200\354\214U83\201\002h\271:\023~\330\235\324\321?Rw\323\277\203G=<\215*`\215FJ\326?\002k}\0337\266\361\007\303\t_\370\343\262\271n\313\027tX\302\376a\016\374idw/irK\231Rv"
+	.string	"}"
+	.string	"\211"
+	.string	"\365^\023%fn\035R\333\006\207w+\242\003\270HD|\013\304[\322\224\376\334\275\252\b\346\274LJ\246\324>\214S\361^U\364"
+	.ascii	"\367>-\271q\357Is\353\004\342\255\317\277\300n\305\017\200\335"
+	.ascii	"\332\177a{\247d\236\335\365\323\2741\025Q!~^\367\336\362\266"
+	.ascii	"\2368\357\225\206<\277\267d\364\372\337ioI\304\251\200\2071\b"
+	.ascii	"\367^\213#n{\3335\333\024lK\0132\352q\244\226\215\324\342H\035"
+	.ascii	"\223Q\303Fj;R\207#u\225Q\323\237\377_\b0\310r\257\357+\313u\262"
+	.ascii	"\300\0256\214\2231:M\237\316\270\237\246/'\205\214)\032\026\n"
+	.ascii	"/\211\323dr\240dk\312\353~8gl\017Y\b\3464\231bT.\204H\361\272"
+	.ascii	"\367,o\177\365j\337\227\361"
+	.string	"\0316i\335\261\\\233\202\264\320\r\035\313$V\027I\375\030;\377g\322\366\257l\203\263\273\025\221LG\214\024\021k\254\312\206\b\331\022a5Fs ?zr\202>l5\023f\005hk\017g!\250p\036;\006\314\035\266\227\240\375\365\240\204\265V\313\002I\207\263\316e\341Z;/\222\303v\037a=\027\n \255\265\0260\222\344\344\210~)8\220\3475\032\330\027\216\243''\350\363\033\266\232y\357\255ey\270\371Q\267~\021\354\226\326\233$$R\300#\372E+\224k\370\360\326'{F\355BR\267\214\324\264\221z6R\223\001\316\320\341\206!\b\310\352\214\266\325\340rD?\245.\207\323\005\335te\020\220\217\206\322\226\323\22551\306m\270\345J\0168\\\256$_\237\314S\265uT\221\\k\205\262\035C[\252K\265#H\240\357\371\306\tD5\262\217\345G\274\262Cc\305v\300\245Z\255^\323\253"
+	.ascii	"\315\202\366\204S\321y\rs\212\355A\260\245\332p\005\3515\321"
+	.ascii	"j\024(Of\225\254\264&]\\\263\261\222\017~\211\222$\364\326\202"
+	.ascii	"\335\216\365&\211\211\224\254\006[\250qH\245\240S#$\005e\024"
+	.ascii	"$\351\240\002\231\0224\035\021`\251Chf\252\024\246\220\2151\017"
+	.ascii	"\372H\002\353\236\223,\271d\246\367\315\223\312\246\207\203\016"
+	.ascii	"E\2522?\314'I\017QJ\351\005\257o\231\330i\023x\002MruTf_(>\342"
+	.ascii	"\324\356\313\233\372C\fq{\330<\200?e\245\n\242K\n\n\037O\325"
+	.ascii	"f\313\006Db=\374<\2706\317r`\372\364\0069Hk\032\240\361<\263"
+	.ascii	":\224\326T\372\273\237E\367$\366\252\244\022U\035\212\311\275"
+	.ascii	"\344\321^\333\240P\301Ek\nQk|k\261[1\255\303^\311El\367x\236"
+	.ascii	"\332\f\033^\350\005\2419wD;\323\366v\235\005\017\332\301!\215"
+	.ascii	"^b\374"
+	.text
+	.section	.gnu.lto_gyroIsCalibrationComplete.part.0.137.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\236\002\275\024"
+	.string	"\266\344\201H\320\016)\035Z\262\217db\252\224\235\3412\377\201\034\246~\246\305\277\231\353U\341h\321\214\245#\036\324v\245\323}\255g\215\371\323)\266C\273\304R\017'\244/\216\310\272\256\034\303\024\317\202\001\306p\227\366-\331[\356\224\002m"
+	.string	"m"
+	.string	"r"
+	.string	"2{\303v\2617>\277\301$%2\032\222\022\027\317\276\333\231I\0051\300\bA\355\356X\237j\301\361rw\3178{8\245\306\324\314\277\321\036J\017\036\237\036\216[\004\031\0024:z\2113\306\364\324\\\246|T\3404\025\335l\256\322\200\356\347\002\307\315&\225\327\033q\337\243\314\255\026\243\307S\251\223\335\265j\302\255\272m\030\333!v\\\n7)\2549\226*\243\343\303\217\023"
+	.string	"p\2733Q1\366f\"e8\321\275\242\031\255h;\0058\236'\240\237\265\355Db\007x\210\200\244\375_\221c\220\350A\276\257'\363\312\266\333\033\315u~\317\036.\344\362!\003U4\032\325O\250\350iwE>\r\242\372\\\335#\374\224\017\020\362\"\n\022\273{\016\337\305\036\344\311S\202\332\335\230\372\272\301Z\323\020\256\306\363)\341\310\001?\n38\242\325\n\326w0IHR\325\261\335\n\243\336\367\216%\237%\027LN\266\b\303\377\031\345I\255\217\025?\247\034\2502Rc31\204\213Xyogw\013,x\b\026\231M\016\007\264\273& \216\344\362s\237n"
+	.string	"\213\217y\020~F\375\357\361W\223\303\351\202^b\224\365\021\230c\361\"\252\2165\365\3534\004+wk\304\365\212\251\260`/\027\254%\005\306jYAaa\265^0\326\210"
+	.string	"\273\030\244\274X\016\\\256\027k\343\232\343\353\216 x\324;\232\377,\274\357\t\202\037zG\352\317B\2512\266\245\372\344Ek\326Pu<\235R\"\3270!U\2572\361\006\206\327\230\321\241\204mY\213\030\263 \237>\241E\031\326\313\335\335I\340WU\r\244> P\002A\320\215y\322\001\324\302(i8\200\200\004\207\037:\254|\3202\026\360"
+	.ascii	"2:r\266%\270\251R\250%v[\2115f\211$\327FF\027h\237\301*\252\261"
+	.ascii	"\304#<q\362\030\230\206~\007!i\374\200\265\335F\353\232\037\377"
+	.ascii	";\203u;2\034I\265\027\006\311\257b8\200=\216c\t\266\352\026\254"
+	.ascii	"V\306\030(\275\366\340\233R\221\r\"\016\337\217\231\033 \013"
+	.ascii	"VQT\003\337\330\206\363F-,x\200\216\035\357@\240\037y\255\302"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_gyroUpdate.part.0.138.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"\255\n"
+	.string	"\206RD= \345*\035\300\"\fw\004\344\200L\347\251\24698\247\020,0\261\324\3068\216\314\303SC\266\352\332\035\026\241\226\250\264;"
+	.string	"\001\001\204\241\312"
+	.string	"\330\221F!A\264Y\360\034\307&r\247\0242"
+	.string	"3"
+	.string	"1"
+	.string	"\217\2716\341U\362!\033\260\273\363RQ~\272F\356\344/\200\b\bU\250\353a\2278\toB\325\310\243\3019\202\210\3355gu\313\333\206\260\335\261?\021\265\032\232\207\242\\l\233<\034\317e\247FCC\305[\324\226\225;\267\312\2625\222L\233\335\220\002\004\326D\316\254\330\207\231\354\256\273<\213m\223\210O6\200-\333]|\313e.\nl\273\251\207\266\031.\0235\270v\367\301{L\206\202mw\035^\016\003\372*\227\336 \305\207\227>i\340\322.q\304\207\376,\006}\274\257T1\301\317\003G!p\216,(D\023\364\201\363\203`\017#\364M\r\317\373fg;\236[e\231S\273\321R\3321\213\305\203]\275R\002l\354\361fU\r\033"
+	.string	"d+0.\030\004\f811>\020\263:*3O\251@\267\211G\342\320\232!`\234\036\233\241at@\024\fs\205\0331aqF,\352\234N\013m\246\3544"
+	.ascii	"\\{0\205\323\274\364\3322\006"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.part.0.140.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\236\002=\024"
+	.string	"\026\346\201H\340\320(\035\232\326\260,]\002.\305b\315\310hi=ia\215\210\363\035%\352\025\031pLN\341\036\344]\202\340\353k\207\376\256\332\225\241\231\351\301\241"
+	.string	"3\306\025\016ZT\035\372\006\033\361\236\006\376go\263do\271S\nm"
+	.string	"k"
+	.string	"e"
+	.string	"5>?\273\341\310\247\033\224>\035\336\300\367Y:\310\367i\037\206KLb\264\022\023\231g\017o1\005pF\035p\212v\303\323\247\242\260^\206\267\306\331\247\324\370\315\374\370\241\266\362I:\311]\336\314\354\344\020\312\251\205\270\224\003v7@\315E>\330\335\367\036aj,Q\001\254"
+	.string	"\361\b\362\217t\262\273.\211\270I\267\255b\333\202\035o\002*\256\363\363\374@W\373>P\357'\346\020\227pk\264\037\231\\\336J\0237\242\030/t\316\343\367\330\224\023;\357:\177g\027\343\37196\034t\303\035\021\355n\205R\316\337\3714\216#{\r\r_\231\275\007\034\270\036D\273\241\310\247!\224>Cd\364s1\333d\313l\323g|\030C\020\256\f\315\032\355\313\370\215\3543\334\363\217\335\326KU\233m\007\277~z@w\333\361Bc\237\005~\020\314>~\n\337=\337'\003\035E*u\352_Z\310\373\306\027U\365/,Z\342\221\257Q\337\373\244\315\354tB\273\036,\361\310z\335\335\225\2506\353\367\357\356ZklG\223>\215\236\017\1779\243uF\307\003\3357I\027#\004\320\354\306\034\361X\022\263\027/\325\006\224|Q"
+	.string	"W\252\t0\026\270\002])/\024(\341\002\250"
+	.ascii	"DA\271@\225\b\254\226\n\206\302\220\262JI\245P N\221\264\\\034"
+	.ascii	"PN/W\353\305\002_'\226\n\265:\245\\\257\023I\002\2672\200\256"
+	.ascii	"\023\254\325r\235L\377j\r\001\351\317>\022I}\302\242-Sm\271\177"
+	.ascii	"\024\r\341bhx\253%\254\277T\233\247\315'r\223M\374\364\n3\362"
+	.ascii	"k<\241\033r\211F\0018 \200\002\0313\255\003|*\250h1\330%\360"
+	.ascii	"9L\300k\\\320\360\240X\027\214\245A\242\"\020\3269\232\367\270"
+	.ascii	"3\027?[\355#\370Q/\215\275\023Dj\356\216\225\260\325\206\311"
+	.ascii	"\265F\301\335,b&v\005\343%\254\3374\f\270\354n9\373\264\b$\246"
+	.ascii	"\017\306\300\f<\341(`\006&\363\332\245!\2137\206wu\246\213\265"
+	.ascii	"P\034V\303\366\036\232\030\027\336A\361\304\271\005\351\337{"
+	.ascii	"\355\303\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\367\007]\036"
+	.string	"\206\261\265@P\252\325\030\270\236\215+M\004\303eZ\0220\t\271\302\251\2001y\354*\027\274\264\231N\024\017!\211\nv7\035\240\331\255\272\352\352\022"
+	.string	"\002VVp\214\325\325\205,y/\022\321\345\244r'\231R\245"
+	.string	"\241"
+	.string	"\243"
+	.string	"|\247\305\263\035\026\317l\332\314\214\211r\305\363\232G*\236\313V\261\024\317\313F\361-\345\3047\024\026\315\030-|L|?\001F\321SV\342\271\316\311\364\005\251\215\304\363\234\021\317rD|/\t\361|\006\342{\315y\263\331l~x\216C\304yx\216\324\3419\355l\016\317h\347\206'\rL\210\230\201\005\241\234%\005\325J\2566]\030\236\333\\0Z\220\200\372\0325\001\352\031\316\371\364"
+	.string	"\365\325\tB\263Y\n\034\240\314\234[\225\312\325L\205g7\247rL\214\371\231\341Li\334\272\256k\3233\331\311\314"
+	.string	"\030\005I/\205\324\223\330v\246\324ul\263\231Z\330\235\246\324\225<\273%y~C\362\354\350\310s\"#\317mE\236\025\021y^4\344\231\021\326s#!\317\177\202<\277W\317\210\200<\003\372\361\314\346\3439\220\325\363\240\036\317\205x<\033jff\036V=\037j*\247\035Q(\263\221+!Av$s\\\325H\376(r\263Z:x\fM>3\247\236\327r<\373\301\361\334\007\371\314\347<>\357\271\361\254v\332\250\200\326x\326C\3439\3179\343\031\317)\243)\006\023\f\n\350\213\b\350\271\256k\226\213\017O\350t1\231\352\005\334\026^\341\362\302K\325w\314\346\245Xs\r\250\272T3\270\322\245\346S]\347\325\256&M\213\353\027\364Vv[\361\362V\005\030t\004\276\240\353\224}\246@\317y\3659"
+	.ascii	"\350\355>\001}\347:\r\360c\367\027\24469J?\357\267qJ\216\325"
+	.ascii	"\356\303\265W\237gnkY\004\370|\330\nY\265\347?W\251\335\261\335"
+	.ascii	"\340K$0c\317sl\267RM\232\023c\317wm7\317\247\332\376\221\211"
+	.ascii	"\202\026!u\244\333\001 5y%\244~|{\251\321\326\232\t\251\363\336"
+	.ascii	"N\311\322\226\030S\017\034l\273\273p\021s\206\313\212\336c\335"
+	.ascii	"\242\363\334>\265\266\302\2708M\321{I\272vk\306\363\206-\314"
+	.ascii	"\002\034V\237l`\260\234)\300\355\230\005\0228\221es\035"
+	.string	"4e\276P\242\017a6p+\fJ\023\375\252\265r\251\336$\213|\217\356\260\r\272\277\226\307\356\336\336\265\235\275\031\211=\242\037yD\317\251C\357e\367pi\350G\003\007<g\007\f\215\200\001\227j\\p\311\255\252\252\250\222/\224\352I7J\365\251\326\250:\362mF\364f\213\005\325\217n\343\274\3064\3411\325\205\314n0:T\234\374T\027\272]\f\200\205\250a \n\221Hf(#)(V\306\360\002\031\242m\033\021\260\234C\322\221@FDd\202\241\260\007\016^\324\0336%\031\331\237\327\310\n\021Y)\252\254\240]\301\366\263\3526\337H\243\230]j\3229&\362m\374 Ip\246\327\217d!k\\\031\363\2656\017c\305\030\360\336\357\304\031Z\026D*\206\0270x5\303\317$C\225\276}\351\001jWW\225\272\256\352\252R\327U]\251\376\257\321#\024\213\314\220FO f|U]\264c\343"
+	.string	"\016\202*\356l\371\311H\301}caq@K{\3672E\376?.\231"
+	.ascii	"\370$\234\253\013\273\002\224\306\213p\222\211D\202\270\341\310"
+	.ascii	"\215\254\026\017m\321\216nj[N4\375\035*\370!\231]\261^B\372\255"
+	.ascii	"\346\205\\)C\262\361\227\020hPw\037\0342PYPlgm\220\372\324\256"
+	.ascii	"cx\270\346\266R\001"
+	.text
+	.section	.gnu.lto_.refs.ad6300dd37246489,"e",@progbits
+	.string	"(\265/\375`\266\002\375\020"
+	.string	"f\346e?@\215\222\341\274*\351\336\3455J[J0\205\201W\364R-k\030\206axH\3070\f\3030J\341M\320\324\200n\317\370@\177\322\376`\017\374G\355\377\255\265\266A\366nD\bi\204H\231\002N"
+	.string	"M"
+	.string	"]"
+	.ascii	"\237\321\367\364;\217k\372\256\337\036\257\372\231G\267\0064"
+	.ascii	"\250\334S\316iw\345\004\300z\227\353W\332\247\364G\355K\372#"
+	.ascii	"\355?\036\337pm_\2649\026\337P\374Y\325O\324K\024\347t\306\232"
+	.ascii	"#\361\315\304\237\364\027}\252/\365\331Y\275\324 \020\332w\320"
+	.ascii	"W\340ViOi?i\027\320\307:\355lA\237_y+\267\312\217tkg\360N\371"
+	.ascii	"\246\257)\277\372\257[\375j\317\253\332\251\362\f[v\254\177)"
+	.ascii	"\377A\371\202\307Y\334\253<\216\342~\324/\320\236=.z\374\243"
+	.ascii	"\\\243\377i\0368l\310`\241B\f\314\204\b\275\245\317\362\370J"
+	.ascii	"?\301\343*}\004\217\037\350\243<~\322\037\2717y$y\034\353\207"
+	.ascii	"\036\027\351\207<\016\322\367p\317\3618\350\375\346z\315\035"
+	.ascii	"\240e\252\r\351\274\006\341\030\027_\223\256?\252+\017\351\266"
+	.ascii	"\033\324\340w\320\200\341B\f\005\030\t/\356wy\374_\224\266\236"
+	.ascii	"Ho*\256\021\341S{\266\rLg\356;\332?\356\333\310\231pR\023\030"
+	.ascii	"\300\231]\302E\031\367\350wd\317\221q\214,#I\233\203\361+\304"
+	.ascii	"\251\320\304\036\311L\006\030\277\005\366\263\020\361W\204\370"
+	.ascii	"*R\240\020\375'B\277\211\022\"?\211\351\037!\242\375!@|\bB\250"
+	.ascii	"Apg\310\314\214\004#\201\204\t\2224m\260\002\231)\251\033\020"
+	.ascii	"\230\267\311\001+\002\222\006\236*$\t\230\352\203\244<U8:#n\313"
+	.ascii	"\030\0211\"\007\305\235\n\033\274\214C;\310uh\305\001\003\301"
+	.ascii	"\"\306Jo\032\177\314\233\271V\\\036=\356\305\004ZN\265r\322'"
+	.ascii	"\212\024\262#\375\"[A~\f\262\320\217y\360\177I\240\201uk\312"
+	.ascii	"\231\275\237X\"}7VXW\312\317\036\346r\233\311\017r)\315\377\001"
+	.text
+	.section	.gnu.lto_.decls.ad6300dd37246489,"e",@progbits
+	.ascii	"(\265/\375`\210z\265\363\001\252 \027\260V JY:\215\001[\236\020"
+	.ascii	"\2201\037\325\267\320\345\016\363\365\315\2041\322X\365y\207"
+	.ascii	"\372C\027\334\236(\035\366w\303\272\007\347\315\317\262\nBT\030"
+	.ascii	"}M\223,\313\262LOQ0\fA\nE!\030f\t\300\327\352T\344\276I\222d"
+	.ascii	"\215\341C\206\354\226{o)\245L\001\231\t\016\0132\013!B\360|m"
+	.ascii	"\245\301:\363u\240\364s\320\350\257\240\t\2101\263q\363s\300"
+	.ascii	"\350[6\037f`]x\253\211\362\007\366\262I\334\205\271\326\322%"
+	.ascii	"=\306\242\316\374\034<\375\034+\3729U\364s\320\364s\302t\316"
+	.ascii	"\321\376\234\317\341\241\237c\245u\366\237\326Q\242\321;;\213"
+	.ascii	"~\232\324;J1\235a\267\271k.\033\\u\275\264\270\301\272\371\250"
+	.ascii	"\251\004\341Rr\363S/\035\007\213\322\312\371\345x+\273o\314\352"
+	.ascii	"H\374a\0013\203\262\253\303LI\260\320\271\271\233\275[\263`t"
+	.ascii	"u\312\275\367\205s7\236t\357+do{\357\377\030\006v\201c`\031X"
+	.ascii	"\nOa*\034\205_\330$n\201\233\216\235\360\3233r\357'\334\002\357"
+	.ascii	"\273\361<!w\f\250\336\361\215\334r\357\255\203\365&\225\307!"
+	.ascii	"?\345\322W\313\002\235\037\354\317\371\224\206~Z\245\237\312"
+	.ascii	"\320Oa\350\247R\372)\224~\332\244\257\343\350k?m\243\220\370"
+	.ascii	"m\203\337\350\242\374n\276.\243\3172\366\347\314pwE\363\274\331"
+	.ascii	"\237\363ZM\373l\373s\236\271U\220^Hn\276\036\323\367\300\310"
+	.ascii	"\033\260<<8`f\256\336\335\273d\356\030\233\274e\256\230\337\030"
+	.ascii	"\356\220\007\201\360\337\"e.\230\337=R\346\212]*&\242\216+p\271"
+	.ascii	"Q\226\271n7\214\211\250\343\nNm\224{\357\020!\202B\204\b\241"
+	.ascii	"m8\301qf'_\023\321\327Z:\314\177\217\334\266\013fG\253\203N\033"
+	.ascii	"\344Y\262\311\323\031\366'\025w\363\377\353\345v\271w\027\317"
+	.ascii	"&\357\227K\366\033w\345\236\340n\306D\3241\215\302\313\"\367"
+	.ascii	"\345\216].&\242\216)\2144;\022_\356\033\327\226/7M\2132D\b\013"
+	.ascii	"\307\212\222KN\336r\355\264\244Pb\204\371\273\371\232j\213\026"
+	.ascii	"\0351>\276\267,\277Z\3342\224\331\315\220\272\371\316\335\272"
+	.ascii	"&=8Wu\307\222\256Ib1\271\371\312\326QR\006G\343\346\353(+\227"
+	.ascii	"n\247\005\020:8\372}w\373\237Z\261\266%Qn\266H\013t\006\331\237"
+	.ascii	"\363h\237>\272\247\217\216\321G\275\350\363W\311/\225\377\206"
+	.ascii	"]$w\312\216V\207\264\310\025\226\222\233\245\270\251\212!\311"
+	.ascii	"\315G\333\364\377\273v\331l\362F\271On\345\256\332\203\220{O"
+	.ascii	"\331{G\271c7i\"\352\230R9\225QF\271P\254\032\017\023rS)\340\355"
+	.ascii	"\215\334\330\336\310\240\020!r\324vT!;\363\321\037\332\2423n"
+	.ascii	"\332\231\335\221DL\353\346\237~\3726y\321\316\320&>\030P\220"
+	.ascii	"\277g\177\t\020\276\267\263w\331\336{\002\363lK\016\356\346\313"
+	.ascii	"\344:\371\237\242J\222awN\314\314;\0376\236\334\334\004\271\367"
+	.ascii	"\222\230\261\271\371\347\030\375\337&o\331%C\356 \236,&[\356"
+	.ascii	"\346\237t\372.y\333\377\264\207\252\313\352\352\346\367}\356"
+	.ascii	"\177\232\257\252\220m\271\371g\233\276IH\374*\3719\217X\310\275"
+	.ascii	"\266\367\356\021A\210\017&7c5\235\267\005:\217\264?\347\357\310"
+	.ascii	"\364\317\"\332\346\3209H\013t\332/\373sj\320\262?\347O\030\372"
+	.ascii	"'\223\276\311\247ob\321\267\353^\037\327\353\267\353r\275\004"
+	.ascii	"\b\337y\272]y\357&k1\340\261\026\003snHS\332"
+	.string	"\231o\306\351\233fW\013m\003\343K\227\233oz\351\253\343\356\260\311\313\343\2779,\3333\232\326N\356\215\314\200\233jlq\273\371\026\304\331\023'N\2348\026\304y\023Kg\373s\336\204\241o2\351\rol\364s\030\275\341\356\322\360\200*\251\302\303k\006\005=\310\0321|\334\374_\253[\245\363G\326\346\346{\fB\223\374}Yr\3633\026}\017\302X.]n\224le\364\300\254\234\025(Tl^\342\\\301b\337d\220 \363dO\n\230\2567tyK\345\336H+\367\345\017\214\204\022\314\02605@\300\366\362\254\334\334\215\377BY\277\313d\373\356\266p\256\323\215qa\3307vi\343\334\251\333\342\272\270Tv\315\225\262m\356\013\373weX6\367\311\272\271Q6y\233,\232\3334\226\357\027\271\367\023\224\265\035R~kV%\207\362\356\267r]\\\220\320{R\306\0038\253\306\303\344\263\235\304\340"
+	.string	"s\362[3\344\217\257\262\337\312\325A\231\002\341\214\335\2251\366\r#\337t\213'g\240\374V.\213\345\322\342\005\330\336\373\026\357'\361\227"
+	.ascii	"\3416Y3V\r#\301P(]c\224q?\t1\366\215\247\311g?A\265\001\333\033"
+	.ascii	"y\313\366[\263\337"
+	.string	"&;\305\276\241LZ[\252\005\224,L\245\304\233[\356\215\f\021\024\002\337\245\221E\205\220\237\277\364}\263@g\b\373s>\347\320\307n\364q\236>\256\323\307m\372\330L\037\017\321\307X\3727\216\376%\243\177\253\350\3373\375\033\246\177{\350 \013t\376\312\320\267~\032\204\005:\255\026\273\305&=X\273\335c\323|9U\335|\253F\203`o\353\341\264q\342X\017\347m\027}\313\246o\305\364\337z\350\337Y\240\363\366\250}\354\317y\245\005:\317B\377H[*\266\315&7\260n\267Q\254\224\233M\310\215\334\033\331s\205\300aK\273\371B\372v\203\023\307\211c78\217B\373X\240\363\332\237\363\002\013t>\001\272\003\013t\3323\213f\223\024\330'/\001\3021\023\332.\333\033\331\223\341o\311\337\233\233\357\201\276M{\004h\033\204\373\350[\nN\033\307Rp\376j\023\026\350\274\3006\371-\231-\333"
+	.string	"KMi\355\265\275\221\032\364S\234\224\262\233\217\264@\247\266?\347\177\f\220\235?\272\204\305\2204\274\205#\366\203\372\347\013\230:\377\235\373\257\317\177\311X83\307LM\364\007"
+	.string	"~4\002\"H\340\036$\374\327\355\212\321\221\200)l\376g^\214\006\357\3177\374~+\344\267\307?\367x\363\333\030~\373\365\333\"?\336\340\267`\177\366rs\273\021?F"
+	.string	"\006\361\377In\363\347e\020\013\023\260Y\341\005\370\321,\377W\370\375\321\270\026\356&\345\307 \350\222f\202\375\340\344\307uxK\376Q\262\037\327\005\331\275\303\217\032\371o\213\377:\375w\n\226\377\276\270Rt\337\371\321!?f\222\373~\013\027\201c`\203\034\006\223\275\020\302\207\017(e5x\204l\005s\360c\033W&\376?i\341\003\337o\251<\001?zu\242"
+	.ascii	"O\354\207\n0\013p\037\300\217\216\310\031\215%*\361\007+\\\241"
+	.ascii	"\034\004\371q\n\371\314\217id,\023|\303\217\272\360\347=3\177"
+	.ascii	"\206!/\225\371o\027\002\275\037\213\360\333\013r\324\217#`\341"
+	.ascii	"\310\374\371\370\3471yY\314\177\341\256\226?\207\311\300\n\266"
+	.ascii	"\202?\203\311x\177\356b\001\n\234\205\037\315\200\326\211K\346"
+	.ascii	"\267p>p\216L\005\243\341\024^\301\217V\340\307\027\234\240\221"
+	.ascii	"\261\374\370\203\257\2405\302\217]\344+\331\212W\246\313snY\376"
+	.ascii	"{\376\327.\267\241\375\303\217\242\360\343\034\231\312\177c\374"
+	.ascii	"7\356\277G\254\301~\2702~\234\302\237\240\007h\202a\205<\345"
+	.ascii	"\3170,\225\003\375g\033\030\240\344(?\376\240\200\r\330,\225"
+	.ascii	"\377\374\247\231?\013\340\307A\264?sp\226G\374x\b\231\235\374"
+	.string	"W\004|\314fM\262\3753\003\312\376\354"
+	.string	"2)\3775\377\353%\243\300\344\307\367\307\351\217\361\217\365o\3410\007P\270\006\031D\006\036\224\227\300\370\363XN\362\277\205\024\216\342G\201~\f\226\203\3405\375\243U?^\300\335X\037\253\341\212\260\363_\266\377F\360\343\236\377\352Y}\203\377\032\374\227\303\237\213\374y\210\375\360\013~4\306\217\301r\020\234\202"
+	.ascii	"\2122\220\t\214p\370Q\241\037\347\360\374\370\204\267\200\226"
+	.ascii	"\376(\324o\363o\377_\315\3778\377\375~{\177\273\363\333\234\377"
+	.ascii	"l\376\377\375\226\307\352\377}\277E\377/\177\233\376_\363[\374"
+	.ascii	"\037\316ou~\233\341\267\347\3776\2775\357\306j\270\005\377\t"
+	.ascii	"\346\317\021\374Y\202?{\370s\207?\377\374\031\350\317A\177\236"
+	.ascii	" [\220\357\237}\376\254!\177\375\367\371u\002\376\374\343\317"
+	.ascii	"[\177\306\361\347\252?\267\370\363\376\363\007\376\f\303\237"
+	.ascii	"=\360\347\243?c\340\317(\376\374\200?\227\360\347\021\376\214"
+	.ascii	"\200?w\360g\002\374Y\203?g\360g\013\376L\301\217\321\374\330"
+	.ascii	"\314\217\307\374"
+	.string	"\030\314\217\273\374\230\313\217\267\374\270\356\307W~L\367c\262\037\303\375\370\355\307m?\236\362\343(?\026\373\361\332\217\325~l\344\307h?.\373q\222\037\037\371\361\220\037\013\371\261\217\037\377\370\261\326\217{\3748\353\307:~l\343\307W?\266\372\361\361\3072~<\365\343\027?n\372\361\3761\b~\374\201\037\303\360c\026?^\361\343\342\217=\374X\370\343\026~\f\201\377\212\360\343\242\377n\277\365\371\261\206\037\007\340\307\033~|\342\307\036\374\226\357\307$~\013\367c\021?&\341\307F\277%\376x\350\307\301\337R\371\357\213\377J\375o\341\377\n\377\355\376{\374\355\207\377O~\314\201\037o\340\307\032\370q\006~|\201\037W\340\307\023\370q\212\037\243\3701\013?\226\300\217#\360\343\025~\254\302\217S\370\361\003~\214\302\377\024?6\341\307%\374\330\001\377U\370\355\317o7\374V\303\377\262\377 \370\237\345\177"
+	.string	"\342\304\211\023\347\357a\341\007\n\362S"
+	.string	"\004\001x~\313{U#\356\310\366\343\016\013\337 \003\303\363[\226a)\361\374\226W5\310\356r\332\031\001\3046\236\337\362b\335\254\333c\306\007U6\017-ld\t\362b\335\260o\022@\342\371\215\235Yaox~K\274\2577<\277\345\231v\202\235d'\220\263\311\031\303\211v.9\275\316\037\247\326\231<\213\234FN\256\323\311\231\344<;\267N!g\220\263\354\f;\277\316!'\221\023\311\351\343\024;\217\234=\316\256\363\311iv\"O%'\023\233<\307N\035?w\234<\316\2613\307\211#\354\016\317oyec\213\322\215\306\355\302H0T\215k\210\322l\f\237a5\370\354\370\200\264%G\302\300\314\256\220x~\313\333w\227\330\312\252\203&\033\317oye\303\276\331\273\257\335\304d\242\312\033\237\232\2534\021u|"
+	.string	"\236\236\2221\334\304D\3241}\341\204$\211\222\273\255\333\365\301\2112K\307\225\254\035K\224x~K:\034U\3000\0221ldM\211u\216\275Qb] H<\277\3459v\332\020\323\032\303l\316\031&\242\216\017H+\242\234q\216a\032\330\n\237\035Sp\342\202\343\034\3039.\227-\023dZx~K\263s\354\254!\006\206\347'\344\347\330%r\225\004h\362\026\002M\n\034?\bd[\003i\201\316\ry\366\347<"
+	.ascii	"\232\364%\350\323\227 \214>o\244a\370t\254\335|\t\266\350K\320"
+	.ascii	"\246/\301\023}\t\226\350KPD_\002\033\372\307\313\2373~\334\207"
+	.ascii	"\327\234V;VpSjn>\253\224>\232\270\334|\t^\350S\006nc\2261\021"
+	.ascii	"u4\001\017\353\224a*\317\030\370\354\230\002\336\r%\325y\264"
+	.ascii	"\311S\206i\346\346\236y\346AA(\214\032;\222g\236:\306\202\353"
+	.ascii	"t\352\304L\351\270\371\036\226:\354\224:[\344&\\SR&\337"
+	.string	"\371\204\317\216&p\301P\236R'\024\216#\241\205\3477v\3028_\234.l\362\224:\243B\004e\360\006\206\324\371\036\362\364=\320\351{\200\323\347\323o\2421\323\234NW+\213\023\254\267\233\317\246\034?'>#7\337C\024}\017\330\254y\201\007\343\315\347\360\331Q\253qM)\313\372\3148\246\237\371w\356\223\311&M8\346\362f\033\323\r\034S\315\335\240\222\0040b\004\335\341\345\312\333N\276\0075m\265,\320\311\301L\337\203\022}\017`\372\036\200\350{\330\322\367\260C\343;\013t\212`\245\203\220\026\350\304R\366\347\274\007(M\326#7\346G\344f'H.\257\277\345-\222uX\265\004\204y\375\215-\311f\366n-\314\353o\231w\314\360\372[\246\335\r\237\035#\210\302s\242\334{g.\037\371\307\022>\257\277%\024\254\214\303\016,+\355\210\331\226\317p\\\266\232\221\253f|h2\203G\336\""
+	.string	"Y\334\237\023~\363c?8\267k\0013\274\376\306\354\336\355\372@\306\345\365\267\274G\320p[\225\211%N^\177\313\274\315\266\334\224[4\301\363\372[f\256\257,\206\317\216\251\214\2646%vs2a\210\240$\315\353o\211\321\3146\023\212\271f\357\260\366\256\372\300I\230\327\337\322\314\312\264\301\345\365\267\314\373\006I+\223]\334l\313/r\025>;\256\300EF\231s\304y\375-\333\314)\263\212\213"
+	.ascii	"J\302\362\316Rz\267\310\375A\306\207l3q\230j\037(q2\333\260\233"
+	.ascii	"\315\204\346\003'\\^\177f[Vc6\3415\301b\276\231\\\314;S\212\251"
+	.ascii	"\305\264b\306\231t\246\0273\212\tg\2021\347\314/&\031\323\316"
+	.ascii	"\3143\273\230a\314,&\025s\2129\306\3243\361\314-\246\030\223"
+	.ascii	"\315t3\353L9\363\212Y\305&\3156\274$s\345$NT\300\262\022\263"
+	.ascii	"-\217\345({\367\265w\325\007K\322\274\376\226\330\317l\303q\316"
+	.ascii	"(o\021\263-\323\3106\254:h\342\344\365\2674\333r2\363M\340$\265"
+	.ascii	"\267\325\007%x^\177\313\275w\032\004\007\033\270\022\314\265"
+	.ascii	"\377&\261xV\255X\344\206\332\315\017\222\323\346\223\036\037"
+	.ascii	"?\232\300\334"
+	.string	"\374\240\244\316ana$X\tN2\224gf\322D\263I3\355i&\227\251\304D\3241\002N1\224i&\362Z&p\222\332M=:0\362f\013.\253}a\341\241\363\203\\\350[(E<\330\273/\006\034\221\302\206d\211\251\304\364a\022\231\300I\n\002W\246\030\371\034O\272\367\326\032X\030\223# \354\335\332\211\2672S\211)\3669\236'\237\375Dd\314Tb\202y\340iB\356\343\t$\310\237\226\245\331\304tb\216\231e&\023\223\31443\227\330\244\251\304Lb\252=Y\276\331\220\337!\251\337\241\211~\0071\375\016C\364;\370\320\357\240C\277\303\225~\007\030C.\323\031/T7?\0027\372\277\031\304\024b\223f\f\246W\227\371\305\303\244ao\037f\312\314\030L \346\327\0063d\326\034\227\270MO\315\2233?\202%\3727\277\314\037Mt\374\335l\3760\275\314\212L\371\270\371\021\364\320\217"
+	.ascii	"\207~\0043\364#\230\322\277\251\343\346\326ob\2317\314\036\035"
+	.ascii	"0\331\\diq\263\311\303\324\272\331\303\334\261\315\036\037h\355"
+	.ascii	"\335d\366\350\361\333\273\251\307Z\f\254\305 3\341*\022\345\314"
+	.ascii	"\217\240\2056\263H\334\324\001\3655eu\363\006\366\347|\004[\037"
+	.ascii	"\350\215\276H\013t\202\260?\347\225Y\203FQl\257"
+	.ascii	"\007\230+\0328\210r\f\330\214\2334\230\364\244\210\261\2432\217"
+	.ascii	"2R\261+\2662kT2\3220emkb\334\224\201\373vx\r\211r\202u\345vf"
+	.ascii	"\276@\362\206\357\355\346\003\3750]\230ROm\320\354Z\334\224\372"
+	.ascii	"K\200p\273,\331\036\036\233\233M(3J\203Q1AE1\271\222\345\017"
+	.ascii	"\207\371\224\242\001\303\345\313|\262\\\272\214\264\221\335|"
+	.ascii	"\240\033z\031\204\241<-1\267M\232L\271o\315d\312kr\034681~\313"
+	.ascii	"\235\355\242M\225\234\377\034\347\371O\206\f\245\324\315\031"
+	.ascii	"N\252\205\306\025\226\233\317\201\214\376\363\033\233\314~{ "
+	.ascii	"z\204Y\335\374\276\354\346\177z\177\2009\343\346\346\334\346"
+	.ascii	"\270\241\334\270y\271\253\274\240\335|\016W4\233\334w{4}\251"
+	.ascii	"\272\371\034\346\3649\244\351s0K\243\327\304\206\332\315\347"
+	.ascii	"p\344LV\332dF\223\331\2362\232\374$\257\215I\203&G\311f\354\035"
+	.ascii	"\226\317~\332\203\243\fa\325\350\376\322\234\331.\223)\003V&"
+	.ascii	"\353\345=\233\314f\236\315d)Y\216\207I\303\336^~`f\362\\\326"
+	.ascii	"\302\363\204\334V\347\231&\263\254\345\336;\204\207\020!t\246"
+	.ascii	"\272t0\351\374?\347\34516\231\311d1^r\030{\207\205\334V<R\266"
+	.ascii	"\314\262\226d2\227\334e\002'\251\023\344\364\224:.\210\034\220"
+	.ascii	"3\237\203\227\316`2\270p\013\023\203\227\277\344\\a\335\311\335"
+	.ascii	"|\01684\336\255\f#PYn>\207*}\233\274\231|\367\275,DK\215&7\237"
+	.ascii	"\303\224>\007(}\016LZ2]\306b\357\326N\330\355)\367\336Y\362\026"
+	.ascii	"\233\314Zr\335Z\326\222\247\324\235Q\362\024\t#kr\346\377\364"
+	.ascii	"\351\254\344\t\312\226|"
+	.string	"%[\331\0312\354\351\230Cr\363\177\364\364\177\276\350\377\334\301\3458\233\314r\271J\226\313T\362\333\004NR(\354p\223\345\362\024\253\246S\344\210Y\026\352\003\316I\2203\377GL\377\371-\273\335\220\242\342gZ\301\3722$\267e62/\366\336\315\377!\242\377\343\245\377\243C\377\207\206\376\217\224V\313P\240l\231\215\335\374\r\177j\033\326\350oH\243\277\241\214\376\006-\372\033\342\3647H\321Wf\263\334\344\276\371E\325\27093\311d6\371\271\\\006\304\n\023\220\233\277!M\263\330{o\373\271\023\375\334\371\r`\372\033\272\264\335pC#\351\231\241\003\212\324\315\337\360\244\357\001V\313B\360\331QG\371Q$\033\311a6\231\217\344\030n\311l\331Z>\222\207d0{\267\266\233f|`\323DDMP\210\fQ\226oj\234\231H.\322\003cH\013!jD\310\3645x\001\311A\256\325\223 \032p"
+	.string	"\321\320Bwe/\213\267\306\215\213e\327\236\266G\373sj\345\036\030\331\206\305\313\315\367\271\323\362\221\323\367\211\242\357\323D\337'\210\276\017\016\235o\344\032[\272\210\334|\037+}\237\247\\\243\347\216\b]\333\315\357\351\313W=y\372=X\264\005\263?\347\321\"\201r\202\344\346\367<\321\377\263\f\233\314T\031F\246\312S9\206\275[\333\273\212"
+	.ascii	"K\252\336 Y\356\275\203B\330\034Y\234\270\344\030qoc\254\304"
+	.ascii	"n~"
+	.string	"\317\227~\017\r\375\236'm\337\370\364\237\237\260[f\312Q;\313:$In\316Q\177\206\262P,\027\213Z\311\235\301\335|\332\2373;\221x~\252\200\312\\\225\233Q1\032o\013tZ\245\3759\317\203E\237G\212>\217\023}\227\026\350<O\021}\236\037\272\004\211\343\3459&\327\243\315\315\347\311\322$\266\005:\317\243\3759\371\224Tqu\335|\036*}{g\346\017M\211\223~i\360\031\214\006\357\331$V\3422\307N0\022\243)q\032\034%V\303z<TF\366\254\2268\212V^2'\237\307I?\303\032\215\365~\214\206\237`290\322\264|\334<&\310\214\232\232j\273\371\031\360\360\260\030\f\006{\301[p\030\254\005w\301\\\360\035\266\303_l\022\347\341+\307Xp\335Z\227=\253e\330\024\334f\357\326N\224\221Q:a3\243\334\033i\005\307\235zg\3738\313\355:\207\240\331\263Z\226"
+	.string	"\001\347\341(V\315\336a\211\300\244\fv\203\303qMy`sv`fr8\216'\335\273\211\013\030\316\303t8\316\336\255\345$[n\030\316\303R\354\033\217\271\267\026v\313\303o\270\215\347\t\271\253P*U{V\313\035)\276#1$\310\317\260D\347)\366\347|\006/\375\f<\3643\324\320\317 \245\277\343F\307\375\270\212\245\273\333\345\202f\307\362\346\357\244\321;`t\007\366\347\004\201\251\244O\310\236\235\246\032m]n\376\216\026\375\035*\372;h\372;J\364w\212\350\357"
+	.ascii	"\321_\333\322?;X\372;S\372\202\331\237\363;P\372\007i\201\316"
+	.ascii	";f\177\316\363\r7\301ex\rYE\352f\262\215\273 \311a\345\346\353"
+	.ascii	"\274\301L\360\222\223\311\031\247\343\315\327A\243\257\363E\247"
+	.ascii	":n\372:g:=\352\b\3219F\300\256\325\r\265\257\233\213x8a\260\345"
+	.ascii	"\020s\363ul\350\3778\006<\304&1\021\034\004\023\301=0\020{\267"
+	.ascii	"v\002\234\036&\202\205\340*\236'\344f\322\211\201\304\363[\356"
+	.ascii	"\275=\004lnN\251R\250\2678e\254nNeX\265\255>'t7\247/\322\030"
+	.ascii	"\377\323\323M\232\2238i\214t\352\306\025\024\225\233\177\233"
+	.ascii	"\274[\n\343\fl\357\355\263CF\r\225\265\233\017BO\203\250"
+	.string	"K\233\322\246\264\005\f\345Y\265\207\205.\215z\332\342F\326\361\314\315\251S\n\365W\346\214M\n\225>\355\250\261\341\245\245\007\214\227m\203\355\357\177\351\356\300\356\026j\\1x\332\372t\264\3518O\267\332\220\035h\264\364r\207\252,\211\223\233\017\"\314\317O\273\241\002k\302T\366u\363Al\361\361i7F\272\354Y-\337\232\250\300is\355\306MM\227\257\277\233u\2376\322E9\243\227\232M\223\2575-\276\027b\266\242\326\3402OB\262\240n\326j\254Z\216\033\217-\366b\357\032\315\036:\346*w6\023\332\246\312q2\305\206\306\330\226\312\002a\n\2513\273\272Y+\365\031\020OZ\256\355\264\3502\030\317\"7\226\026\023\232\003(\231\212\303d\271\245\260@\360\3008\263\325\005\346\272\314\265^\t\020nf\350\245\246v\263&s\013\204OM\352\346\353<=\346OS#e\246\374\335\374\r\300h-\246"
+	.ascii	":\334\364\b\363?\315\371\3622D\354\346k?w\352/7\023\003NL\307"
+	.ascii	"\315\032\357g\246\234}eil\307\205\347t\263\346\242\357l\362Y"
+	.ascii	"t\227#{x\340Z\260e\271\371\033\330\351\333g9C`\237\345\324[R"
+	.ascii	"\270\035][7\037\215\022&\007\230\025\271\313\351:\213\266\251"
+	.ascii	"\024\320\345\r\222\261\275\261@\350\240\321mi\241\261\\\327\351"
+	.ascii	"\210\361UA\336\254\257\274m\013\335\337\016+\3502K\216$V\350"
+	.ascii	"\264\231\2731\261cJ\347\3267F\317e\030I&Q\304\260M\371\024\r"
+	.ascii	"g\3216\225\004\264\336\310\215i70m3\252\\\303\265\001cF\311\315"
+	.ascii	"\232\212~\373\237f`\302e\b\033\375\246\335\344jpU9\323\002\210"
+	.ascii	"\027\270\266+F\223)ab5\266\266\246\243X\037\244\023\036\0260"
+	.ascii	"3ny\307\205\355:\312\036OR\256-\255H\332\323\264Z\220\336M\322"
+	.ascii	"\352\224{c\201\bB\003#\346\311\265\332^\317V\202Y\336\254\223"
+	.ascii	"dcW\2566\370QV\246\317,\332\246\232\200\354\354\r\022\035\265"
+	.ascii	"\204\242D#\257"
+	.ascii	"\317\316\210\201\021\321N\332<\361\253\341D\233\241m]U9\233\356"
+	.ascii	"\300\306\316t\023s\331\207\244N\315\315\337\300\352\310\365\330"
+	.ascii	"\021\315\004\225\013\332NO{\007\220\2377Slh,\267T\026\210\"/"
+	.ascii	"\036Z\364\222k&Z\3168O\336\266t\222k%\177\212\212\001\223\005"
+	.ascii	"\355\346kP\2475\222k\261?5s\314\320Cr\3635\230\323\277\016\373"
+	.ascii	"\323\235/-vin\276\006n\372\032\254\021!\242\301\202\264\230\326"
+	.ascii	"\360XM\361e\355L\3111\267E\027\271\006\203z\001\345\005\314\234"
+	.ascii	"\034\022\275\233\257\201\213\257/\035\303\361\323\336A\344,\233"
+	.ascii	":s\004O]\311!\271Y\307"
+	.string	" d\317\216K\335\315:\210\306k\323\225\345\346\013@N\003\021\200\231\366\241}h\257 -\2465\350qJ/k\2717\026\210\213\203\317.H\327\265W\316_\024\032)^\376\247\035\220\021B\344\346\013\200\207\276\326\262zKoY\265\240\315\204\006\204X\334\025\016t\246\230\202\210\335|\001Lik\255\332\371k\036\232\307\255:\301go\256\26570Z\264\350\335\374\017~\372v\211E\371\256\267\211e\336\260I\224O\353 \341\264\233\210\020 \213\003\235,4]Vn\316B>5\211\t\203\345\346\1778\2435\223v2+#\247\237\364\224-\264\013{\367\305\200$\\\362\024\3354\201\223\324\ted\224{#\2574\fm\325\266TJ\321W:\212I\236\r\235C\343\320X\232\206\256\241o\330\244\276\322/\364\225\206b@Y\217\0322(6|\262f\272\231\t\234\244N0\333S\352*=\303&\265\325\232\266\312k\364\361"
+	.ascii	"vSa\326x\b\221!\315\227\274\034g\376\365QS!\177\360\335\254e"
+	.ascii	"`\331\310\002u\363?\270\351_O\331\244\216\241\373\306\252\274"
+	.ascii	"1\363?\325\261\022\204\213M\377C\231\226\322`\224:\354n\376\207"
+	.ascii	"$\372\037\216\350\177\020\242\377\301K\377C\017\375k'm&\353\324"
+	.string	"\330\351&\253\206\267e\312\351\346\177\320\241Q8h\034\f\367\247=L\336\274\244\334|\364\357\177\272B\020.Rn\316o\216\372\375\351\315R\004,\306\315\377\200\245\217\266A\335\374)O\036\021\266\263\233\377\341\250\217.\377\247\246\2248jn\334\214\262\321Q\037\2326\310\321\321\306#\207\232\243l~\264\017]c\366\200!\016\03467?\317\002\235\031\354\317\211\253\2208\252F\307\216N\351\344\346\007`\017=\203\236A\321\210\240\204\r,\347\310Y\2344\345Q4\367\315\232(buzz\250\031%9\224t4\270\004)s\324\314\336-K~\211\301&F\f:\346n\255\275\301P-J\250\224\033+\013D\252\005\316\227&4\357\350\0307(d\272\304\335\334\004\017\017\005s\265\366\336Q\233E\236\022)\245\356\022\303\232\215/G\301\330735V\240\002@\244K\227\223\013\027Y\222\261\215\205\005\302V\351\322\346\356\346\007"
+	.string	"\207\346\302\0055\222\356\275%\212\262\310\333\315\017"
+	.ascii	"\224\026-\350\226\333\343\316\022\246\203&\f\237\335\226\260"
+	.ascii	"&l\324n~\006i\364\217\326%\321:\313\005\304nj\272@,,\003-W\256"
+	.ascii	"\240Ww\357\275\301\320+bC\224C\322@q\335\374\f\326\344\344P\272"
+	.ascii	"\3734\355\355\264\367\216\033g\\\\\266\"u\254\202\316\035\245"
+	.ascii	"\263\\\302\334m\2658\255\264\017\2644]7?\003\"pp\237\263G\r\305"
+	.ascii	"\t\2102\003\253\2677\034\027\344\2637\327\027X\006P\372G\333"
+	.ascii	"l\022m\303qXj\357*\023a|G\016\216\201\031\375\243S\320)30\240"
+	.ascii	"C\243\240Qt8a\027uvEn>\006kkk\250\221\0238\364\375\310\243\232"
+	.ascii	"\272\371\030\370@\223h\022UC\303\307\303\344\315\223+O\216\252"
+	.ascii	"e e\256\364n~\337\355\372\237\356\274\260\212\333q\3631\240\322"
+	.ascii	"ff(\332\f=F\256\007\337"
+	.string	"\331Q4\223\213\322/\016\322d\303\232\023C:\341\231\022ge\203\247\315\213\032\324\315\277\340\314\030Z6\206\222\235K\226\240d\266\357t\302e\272\310\262\223C\231\034%\323\213\001\244H\233\021:\027I\344\364/8\202\004M\202\004\275:\305\304\320+\313\346\234\301gBi\"Bw\363/\370\241\177\301U\021\364H\021\324\210\006(\030\n\206\032I\367Q\2049\274\023\211\2173[7\0331\022\3065u\363-x\243oA\235\0362\004\275\322\373\314Z\024\r\004\b*D\35730\300\202\034\025b\301\022.\264\213\013\375\341u\364\007:\207\344\310\234\217\373@_h\246\275\231|\266\223\231\030\300,\350\241oA\023\017\264\007\017\364JK\013\275\262\373\b\302\026\256\n\314\350WP\345\006\252\343\006\232u\356m\221ZT\307\215u\004\201\003\007\232e\3671\r\006Ur\034\315\262j\247\\\334[\214\233\337\307\363C,\313\337\315\257"
+	.ascii	"M\277\202\030P\033\250\r\364\312\362\235\251\303\252 \013\245"
+	.ascii	"\201\322@\257\320.\2763u\350\225\027$D\242\334|\n\310\350\337"
+	.ascii	".\213Z\241Vh:\020\343\243\200M\377\3501\211\036O*7\237\266\217"
+	.ascii	"1\260\275\2618\310`\204\311\023\247\233OA\232\376Q\031\250\f"
+	.ascii	"\253f\3216UN\213\031zG\226{_\341 \3039\023\006\310\315\247\200"
+	.ascii	"\207\376\321\251\333$:u\253l\325\336MX\027,I\323\331\242\007"
+	.ascii	"ey"
+	.string	"\363)\210\201>\241O\350\213\017\330\204\241.\216\276\270_j\362\342nF\241P)+:\340\304\240Rh\013\030qPX\316\252*hK\222h\224if\247i\013\307\232\233\337g\325\376\247&\327\2322n7\177\2025\372G\233\320\246\2604\262$\313<\375\243\033\335\237;a7Uu\020v\334\034|\002\267\277\277\333\025\264\231\370D\b\013s\342\347G\3065A\021\375\237n\376\022 \330\344\351\346vu\200\272\341\301P\356\320\377\271\264\311s\211\333N\330MV\037\214\304!9\370\004Tj\324\234k\354\336{cm&4 \330\210;\202\370\317\276\237kx\312\346\224mn~\037\006\316\005Y\336\374\t\266\376\251w\226\371i\346f\3164z\357\315\204\334TAd\\dI\226\033\013\013\004\332\246\215\356\312\211\346g\032>98L\247\262\251O+\215\362\f_\323\230\225{T\223\003N\233s\317\242\311M\240\202\034o>"
+	.ascii	"\364\364\177\373\373\237\273\351\270\367\2662\221\373\350\264"
+	.ascii	"s\376\366\326\264\026\304\237\301b\233\301\377\374\023\325\275"
+	.ascii	"\243\340\344\355\275\255\032\035\346\326\224\343\202m\336\355"
+	.ascii	"\375\264\305\304\200\255\252\247-\033R\311\255*\rR\311\255\315"
+	.ascii	"\364D\204I\303qo1I%\367\326\360\364\304tB\253J*\331\2645H%w\325"
+	.ascii	"\206\362Re7r\213i?im\r\373i7\355\244V\325\005RO[UR\311\246*\r"
+	.ascii	"R\311\255\252\235\334\332>\373\251\351\350\342i\0375\354\344"
+	.ascii	"\026\232\235\324\252\362\221JjUI%\267\316X\0340\314\350j\370"
+	.ascii	"\345\rY\332.RO[F\214\254\246\243\317\235\024Rk\347\355m\327\242"
+	.ascii	"\366q\337\355\235\301\336YZ\307\274&\033\366\315\351N\206\323"
+	.ascii	"\224&-\0171\234\270\264\366\323\035\223\335wRH\264\366F\342d"
+	.ascii	"\264c\354\275\367\007L\310\273\r\304\3361\371\310\332SQ{K\260"
+	.ascii	"\221{\307\330\233\311\356\273\2757\323\336\033=f!\367\306\341"
+	.ascii	"#\005\026#\306\336XA1v\026S\225\250\275\357\032\231\267*\251"
+	.ascii	"$\227\026\211*jI\260\335\002\311d\245\246\2646\330\316\333:\352"
+	.ascii	"$\323\331\236\332{[>\rV5#\315\315H\344\336\310\036\235\267\035"
+	.ascii	"l4\302\334&\317"
+	.string	"0g^*\265w\325\007#3\310\222,\367\021\213\203\017xxWn\026\003\205\005\205\312\315\007\200\017}"
+	.string	"\3608\277\030`\343\201\325\300;\273\\\0330\216X\335|"
+	.ascii	"\2708\357\220\311\275w\317\016\231(\\\372\354N\031\034psk\262"
+	.ascii	"\305t\301\343\245\f"
+	.string	"\2238-Y^\024\251\263\273\331\b\031\f\253:,;^p\214\364a\371\3345\251\350\232<]9\255D\235\351\br\263\225[\265\016\354\016\032\352\216<\350\316\271\034-+d\366I\366\245\245\212\234I\225\375\326\360\322\342.\017\270*\351\222.+YU\3142R\202L\ry\303qf1nH\235n\371*\255\216IS\033\225\025XXf7\237T\254\326\336\035xf<\031\3031\345\264:\277\242\272$\221\322d$\311\023U\024\266{\204\006Y\226\233\247\220Oa^2\202\254u\241dt\\kP@\264\t\3434v\363\177\252Y1\333\302\343\346\214<\342\371-\321\244A\0069Ca\260\230\256C\341\005\306\241\322\216\317:\024\342\024\021d\270\221\b\025I\270\256@\025I\270\352$!\t\245\253\2618\024\2260\214\200QH\201\232\202\204\242\241\320Q\220\204\2410hB\006\022\200J`\001\002@k\220xDd\372\370\234"
+	.ascii	"\264\032\025\t\325\n\370\254\320\201h-z\3008\024\026Wc\004GG"
+	.ascii	"J\303!q\210\256@\025\006\241\361\\J\022BR\221N\024\031|\212A"
+	.ascii	"\365\210\204\025\352\220"
+	.string	"62*\261\260B\035B\205+\324\023C\305\340\3200\270\246X\241\016q\270\221\b\343\321QP\310h\r\"\215x\201X4Z\211C\224(\250\036\345\3258$\n\231D\353PX<:o$\302($\\\215\3025\270\246p\301\030l\241\250\036)\r\251FB\306\tn$B\b\250\"\t\327\241Rq\204\020\221\005*0\310\301X\024<*A=R\0214\nO\250E@7\0221\202(\354p\"\021\207\352\211$\"\021\002CB\026\324\025\302U(\270a)\211HB\317z#\021EI#\212\222~\204\206J:\253jT\213\246\021X\224\264\263\002\207EI\346\260(\t\033\255EC\365\350Ta\020\032\363R\022Q(\027\327$<\244\032\225\262\021}\021X\224$\"\303Rq5\n\213T\024?\027X\205C\341\217\t>\352\321\272\022\213F-\f\227\206t\214I'\3245\210\302\250b\004\036\016\253j\302\006\240\237\026<"
+	.string	"\300XT2\006U\025\206\324`\207\b\212\206\302\242\241p8TBQ\202Q\030"
+	.string	"\016&\030\205\026HP\024,\252+F\030\022\205\253j\002\261\270T\204A\216\006\017\253z\224\204D$\301\210\002\261\270Tt\301\220jT*\241G=*\032\nS\250kp(i\002\035\214FU\210Xd\201X\\*\252\200\203\272\006\217\224\220\224\204\204"
+	.ascii	"\300\323\201\210\265\030L\0221\024T\201z.$\342(\tI\250\001\261"
+	.ascii	"\270dB\316\220\272\026\203k\nc\260\002EC!Rq\204\013\314\033\211"
+	.ascii	"(RR\241\016\215\030:\022*\251P\207\210*\244H\352j\\J\001\324"
+	.ascii	"`\002R\221HTT\223\"\310\200\"h\251g(LJ\361B\360\002Eb\t=<F"
+	.string	"<\300a\t\253jTQ\024%q\270\220\260\250\016\325\"\375\017B(@\b&X\2407\201\200\016\020\320\301y\023\b A\002\001!\220\320\017\201\004\276\220\210\225X\\*\312*p\b\005\027\214\301U\253@u\210\250BQMRU\025;\306sU\213\212\301\225g\005\226\360@E\022\256ID\"\004x\210H81\202Q\007I)E:|\2018\324a-\032\n\207\302 \222\212\302\250\036\t-\t\365\030\201\032\220\224\214x\035\002\221\260\021\270B\035Z\215\250\n*\244\030:\"\002\221\316\024/\250C \322Y\f\256\300B:\002(\252GG\302\022\210DB\242\234\265\007\210\336H\304*\244T\\\215%\214@\026\352\252\204\244\301\005!\342\021\020x\256C%\242\020\020\210\026\325\341\013D \0205\026U\243\322\020\b\324CC\241\013@\340i\004\242C\242\320(<R\201\300t\005\256F\341\221\317\215D\030\325\244\245\265"
+	.string	"Cj1hd,\300\b\343*T1BiXT"
+	.string	"\026JC\341Q\001>\b\001\030\202\t\026#\324!\245#\241\241pD\321\2504\342"
+	.string	"+\013ux\024\034\026\325u(\004\016\005\325\242\321\232\004\004vX\241\026\223\200\300s5\n\217\200\3003\270\006\207\200\300\263\0304\022\312*\fB#\020x\272 D<\312\253p\210\302*\034\n\201\206%\f\005\325\342Y\\Y\020\032*\225\020\\\203'\206\202*\nbq\311\004\017\303\0222\334H\204pe\241\026\325\243\241a\360\004\341\312B\375Y\207D\327\b\024RQ\270 \024Tqt\024$A\270\262P5\bW\026j^\215@aR\n\"\365\204\232\264\324\002\020\005\026R\350\250B\303\340j\034\n\365\n\214"
+	.string	"\ny(dah\024:\205IFl\004\222P\002\005\035\022J\240\220\236B%\204\370F\"\214J*\214@\025\206|\212\352j\f\"\235F\243Z\034\032\n\242\352\212\340Q\n\245$$\255\004\\\241\016\031\225Th#P\025\022\256PO\030\225T\350\250@5i\251\005\243\222\212TMZZ\215J*P\243\222\n\254\036\005\205\214f\017\261\250b\200X\\*\322$\234\030a\005\226\360`\035\nQ\0266\274\020DA\302\211\021\324\242\322\032,\252IH\352\252\263\336H\204R\022\022\220X\\*\022\022\n\2160\026\325\025\302\342\320"
+	.string	"T \212\016@\350 \004\245$\244\237!Q\270*\035\021\215j1\307\b\344\240\002\225\222\220t\326#%\243\212bH\024*%!mP\201@\236a\221\360h\004 \f'\244\240\256A\024KCA\025Ep\r\016\245DIG;DIG@\030\214\\(\341\301\006c\022\261x\242\250\016\tW\bO(%!\365\254\300\242`\013D!Z\024lA\270\262p\300:DA)\t)\203\n\3449\201g5\032\255A$$k\004\256\304\"0\211\350\207\205\260\270\006UX\207*R\217Q\307\005!\342\021\tC\301\325\250*y@EA$\022\022e\030R\217T\004\207\016 \022\t\211t\210DB\242\036\224X\\*\312Y]0\006U\3201\002w\326\033\211"
+	.string	"b\260d\264\036\005U#\324\b,\341\324\301\365H=\221A\025\032\006\205\305 \0052\f\251\303\"\341Q\0205\356\254\300U\033'\240\"\t[0*\021\205+\324b\022\317\321z\244\024$\312Y*\022W\243\320\b52\252E\"\363\034\n\203&\250F!q\230\352\f\211B\243\022\321\271\002W\250'V\250'V\250'R\274\020,r8\312"
+	.ascii	"\264jP\002B\200X\\*\372Y]\260F\240\216\272\006W\243\251\256\301"
+	.ascii	"5\005\2115\211\207\207\004\211\237\022;@%\"\340YK,]#p(\250\344"
+	.ascii	"\001\241\n\236\016T\\\022*n\t\025\227D\360\226\b^\022,n\t\026"
+	.ascii	"\227\304\322-1\\:1\354\371\021\022\256\301\325\250a5\nY\004S"
+	.ascii	"#0Cqea\004\237\025\250\215\250:$,\256\306SMZZ\263\361\\o$b\304"
+	.ascii	"\220\210\204D\024\002\300j,\n\211r\214\300\237\342\312\302\260"
+	.ascii	"\204\024\"X\215@\265(\270\246 \3320,a\351())\210\032Q\265(\270"
+	.ascii	"\032s\326\241\022\221\204#uXT]\320\031\n\203F$\030\t\255\304"
+	.ascii	"\025NP\327 \n\365(\t)\230BH(\330\243\032'@lA\035\"\252"
+	.string	"0$\nW!u%\026Y0\006O \026\227\212<\034\021\211\r"
+	.string	"\232ECa\221\tGA\245\023\252Q\211\303\nd\241\016\r\205@\243\220\020)8\\\032\002\256FE\302#\242\016F!\213\021\212\224T\250'J\330\031\nY\004U J\202\300pi(u\301\030T\301(d1\002\321g\275\221\004'&\251\305\021+\221X\034\241C$\022\022\245F`\221\220hH\334ia\035\252H\352\n\242\n\304\342R\321\005DIG@\265\030|a\250\0304*\032\211\200FEB#\240jT\002\022W\035\030\214z`0\362!A\242\004\020\006#\016%\200DD\304UIh%\"\032\203^\b.\001W\325HDD\354y\201xDTTWD\300\005!\325H(\203\0065ii\005\2260\032\203I/\020\2176,\025\325\025D!\265\250\001\035:\"\032\031\325\242\321\n\034\n\223\214\300\027\202K\033\224N\f\211\3025XT!<\n\222@,.\025u"
+	.ascii	"\022%\035\001\207KC?0\030\001Y\004\327\241*TT\223\200F\353\220"
+	.ascii	"\360\205\016\036\320Y\201!\220X\207B%\r\203\021p(D\002\032\t"
+	.ascii	"\255\304!p\2704\344c\024\262\b\002\213\224T\250C\300\242\272"
+	.ascii	"\036\t\211\200\304\342RQ\004+\320\304:\024*\241'A\202\204\013"
+	.ascii	"&\260\202\tZH\004\261\270T4\302X$\032\207\252q\304P\030D\032"
+	.ascii	"!T4\216\020\341aH]\205\324U=a$\026\227\2122\374\317\231\322u"
+	.ascii	"\026\355\030D.\007F\256\272fL\312\2209/r\\\214\305\231\242C>"
+	.ascii	"EA\221y\2719\347)\347)\247\30574\351\020\241\017\211\347\227"
+	.ascii	"\323\"'j\347\212\031\233\263\234\250\034\250\273\355\306@\271"
+	.ascii	"X[\334\330\335|\016\264\364\337_NS\032\002X\351\362\006I\016"
+	.ascii	"\323s\232>\027UF\215\227\233s\266~\303\346\344\313\315i\034\016"
+	.ascii	"j\350?\205\203#\253y\211Z\342\227ny\341{\003\346\315\0174\254"
+	.ascii	"i,\216\033\\\225\333\300\261\222\244\r\220\"rXiR6\232L\212\330"
+	.ascii	"\332\315\347\300\205\376\3235(\331\223/'<\372\3165\347_\232'"
+	.ascii	"U\370\370t\204-\323\\\245\013\266\272'h4\234\337\022!?\224B\334"
+	.ascii	"\256\2321E\200\354\241cr\330\342\240)cF\273a\321\204\203G\231"
+	.ascii	"t\357\300H[\343\242\327b\210\036"
+	.string	"\214\031d\260\032*3\032sc\322\252?&e\260\334\214\2641\210\231\373qs\331\234\2140)\23075j-nN\247\256\223\343UV\212\307c'&L\336\315\017\241&K\226\264K\032\001\364\361\335=\355\202\333\316taRvs\272%\345\"\206\211\217+.\251\235\016\027+f.\220:ZUbbnN\265|\016\315b\307\305#\304\026\375\247u\350\025\333\215/.,\350\213\030kH\2227#\313\250\250\204hY\371\221\243\t\0175\351\334S\27245z\344\2709\215K\345\224\200E\031s\363^X\0318\263\233\323*)\334\027\030[\334\317\\y\\\"Y\222y+#\203\354\215\227\333s\224\216+\313\264\r\315J\343\303\252\310\315S\246\234k,\bJ\322B\270\351?\225\202\333\264\240\371\321\335\234L\246l\366\310W\200\262\030au\313\215E\003\304\237\252=eK\327\310\374\230\253K\241\364X\351\343\361v\363C"
+	.string	"\321\351\023\334\346\345o\b\233\233C\360\320\177\232\346\245\246Do\r-\006-W\310#\351\031\330\013&pd\334\274{x\334\340Q\261A\"\2012\026\306\214\t\252\266l\263jr\326S\345\306\003.-\323j;\344\260\254!\323Q\262X\221\002\204\311\351tg\027\327ws:\226\216\245IN`\332"
+	.string	"\037Y\222\261\020L:5\222\032I\223\244h:\310\022\227\212=MB\204\n\017\271\233\337\227\"\321n\342\304\304\220\2049\351\213Cc\n\251\343\220 \335\216\234Q]an\312\334\374\001\340\351\264HZ\004\025\362\001\227\264\001D\321i\fi\f\351\220\364\202-\\dI\322!\271\t\224\331\327\222\233?"
+	.string	"!\3726\231\nA\2154 \315TW\032$o\357x$\r\310\231&\031%\314\362f\037>\322\037Az7\301\373\312\020\327\304K\033\257\247?\334r\217\274\033?nN\273\356\326v\226'DG\232\225f\245[A\300\366\306\002\201\302\345U\335\365x\272\3253\366'\345\352\346TG\2525\243\307\322M+\345ad\210\f\033_}d{N\351\016\314eF\306\031\277\001\264Hg\2443R\034$\224o\344\214j\244\231Jo<\305\261\327\2036U\327\346\346\364*\305\262\342\302\t\234\024+\265Q\305\307W\323q\357\370\345H#&\255\201\2330\222-&w7\2474\356v\005\215\212\362\304q\332Q\371\271\271\371 \320\244.R\027i\325\013\335\005K\021\275\364\370\264\252\312\353.\210\346\250\304D\317T\006\213\351\242\034\213\243 \006\025s\n\031\3256\002S\025"
+	.string	"0H@ \222\f\306Qw\003\024"
+	.string	"\r^\310\224lN\237\217\224\2545T$\"\030\020@Q\264"
+	.ascii	"'\177\224\270\273qN\365\263aZ"
+	.string	"W\005\277\324\nr\364\036\225\324\3028\266\262GO\003\365D\266\356\307.\np\003\201HUD\r\246\226\263\370\310i\310\360\376\330\b\215p\2652K7\247o\234\tk\313[\362\220\255F\374\356ay\237\273\355\223\344\n\303l{\n(Lk\335\035v6\212\3749\227\250\203\271:`\353P\307\017\204\2537(l\360#\013\005\226j\246\250\276\346\373\352J\317\240\321\372\021{\324qh\301F\236\326\366\261}\031\301M\034\333BF\374F|\224\254P\322Z\367\031.\374\221\316ByD\007\035\310\342\246\005\346V\261\306\240\003\361\307aW\353Q\241r\232@\303:\241\322\274\037 \tZ[\244\360h\323\264L\245\340\373|\362YM#\234\322\033\202D\373\001|\343\333\366\340+IQ\226k\252\302\256*\335\220\005\3708Aa\332u\254\326?2V\206(\213W\325s\313\332\262\232\230\b\356^\324\216\215\210L\257d\021\231\363"
+	.string	"\305K\213\222\020\216\0209\301t_&\027\263{px\273\350\256\2574\367\320Z\322=E\306\263\327\032\271\206U$@\2335M\\yp\255Yt\020\315F%\273\025\"\335\232\303?[\306f\003\333\202\330\322\266\214\361C\321=U\2212\264\307\220\305\230\375s\240\210;\332\335\323ZFY\367\251\224\341U\306K\317\347\336\262\335\245a\222$\n\253\256\005W\323\310\211O\200\245\f\375\3344\332\255\277\204\tN9\370\347\211P\377\310\237-\0207\027\362\343N\311\304\020tv{p\237\021P\037\345\\\356v\274\350\333#\366a \207\225"
+	.string	"\322\315\240c\213\365~\222\307\276\252\237\364\221\321\314\236\006\214\251\325\006+\227wA"
+	.string	"qKQ\277\330\263\001\331h\262W2~\365 \b;\024\271\026\211b\b\205\217g\335\242\305\210b\245\303&\b\223\215\277\22357<\003\332\266\264\277\375\366O\005w:1\b\036\312x\201\271\205\301q\201\303\\ \367\337\031\261\257\212\002'\346\021 \323\206\240\351\347\354u\006W\3159\327\223\232(>e6\327"
+	.string	"\331q\300. \025n\337$\271>]\257\377\326\376I\376\226\274\205`\225\025T\304\017\033\212\311\035\336y\273\227M\300\325\253\207\002LN\374s1\3152o\270\300$\""
+	.ascii	"\307\325Ph\0352\022\311b\002\243`n\326\327w'D\266_\310r\326\f"
+	.ascii	"\222V\253^\375\323\t\n\317|\336\216+/}\032\262\356\246yq"
+	.string	"\237\323\252:r\342P\036@\262\005\262\003\305\251\361\344\037\212\363i\353)\203\375Bl@\321\273\276\300\273\356\310\003\221\300N @j\"\210R\020\300\232!\321\204Q\351\n\321\254C\0205\310GE\252\\\316\302\206n\361\324\245R\235\241\264"
+	.string	"\r?d\277\223\306R\rv=\"\242\307\356\256\334\341\253\n\276\266\267\315]\313b%\216\365M\313\341\364\373\025\266\327\307]\256L\347}\231\325\367\273\240,A\037*\231Y\255\225O\314\355\016\364h\037\303\325u\300*8*\303\317x\220I\371\311v\225d\214\031D\215\350\376$3\266\321\350I\\\b\341\033\030\341>vRBT&\345(G]\2401yU\033\243\364\373\366\025\221\030u\026\240}\377{\006\267\365c8\365\237\271\\\314>\0054dF\244C\216K\312\360\267,9\320!\200\2244\351\212\354d\n\034I\246i\fh \235\"h\3468\352h\213A-?\341j1\320\322i\255M\330\361\n\336\375\370\356\273)u\331\373V\355\262\214\253"
+	.string	"{d\003\237\274\350\270xU;\202G\345\263\217\373js\375apJ\034y\244\242:\271\345\242\360\024\n'e\300\203\017\267\036_4\020\344\273v\272\226\225\216W\2371\3135D\203~\225\036\213H5\364\337r\b\207\331\206\304\347q4\034\322\005}\017\354\207\226Y\277\205o\327|2\242 \342\323\002\223\245\2527\323\021Nv\247.h\277H\316l\rS\026\025\345\"\230\322T\003\351\034\221\027\322\341\342\003\265m\2447 \002\273B\276HY\304\346\b\037\006g\224\227\022\213\2066\312%"
+	.string	"\030B\226\277\313\333B\355=\366$\237\233\247\270zP@\274\266`\3715\203\362:\367\350Ekz~\334<\004\332Q\353\346g9\346TH\373\257ZN\230-0\226\201_\366\334\252\262\342\233y\323b=\317\362\333\304\302$\026\310\321\rU\206\002\034\t\223\022\242\246u\r\322\342\336\245qd<\203\177/\252\2772\350\bf\021h\312\202\315\031\036\215\341\2509&\333JA73c\235Dd<\307\315\260\212\005\3779\306\326\252)\305\372\222<\214\202#\251\177\306V\311\346.\230\3659\370t\3271\021g\332M\363\0357\032\240.\017@\330\224\301Z\3560\013\021[4D\211\024Q^FI\002\242\214V\276\322\315\270\257\234\251\277\301\f2"
+	.string	"\341\264\234\024\214\367\026\020\215\211"
+	.string	"N\273\350\3715\023\273\017\036\027\202\255\2571%>\331z\341\330k+\007:e\372P\346\246\256m\260\210G\364z\325r\021h\005\364\277xjC\337\035u3\370\230Fi\354B]\300k\001\017\237\316d\006\2374\203x\225\242\322+\205\347#\357\037q\266f\323\211\357\234\020\265\231\371\216\337\353\337P\215>\243*\036\251\020\3406\212\034\027\263#\003\264\202!\327 \362\212e\332\031\f\027$"
+	.string	"\f\t\220\361L\001Z<aY\003\b\272\313u\224\334_\336w\251x\\\001\335\240F{\325\337\3747IR(\224F\213-\255\234\316\023\034R\326\316\177"
+	.ascii	"\203\307{\201\371l\376\232\326\315-\002\264\357\262\2220_i\310"
+	.string	"%\024\017\343\274\220:n\270\212M\033\037\240\223\026\352\3307\036(\313\211\335%\274i)&\341\212\252wh{\237hhE\312\024\2140\31645\241\254F\372M~l\017\252\225K\374F\326W\317\211\r\254Ag\327AJ\220\264\274\037R\341\nH\256\001:Q\007\006\361\245\303-\220?\271\253\226\f\376\242\200\rtq\251\226\033Da\341\206\200Y\351+\325\315\341\243\003\217\323\260\017v\221\334\317\373\020S\344\243iG1E+I\343\264\003\200l\336\347u\221q\264\033\240\207+\f\372\334\0031\0327/\327\2178E\252\311\302\003\254\341$\344\211\017\223\354\354\t)\371q\355S\247\376\006\234\353\274\200\351BH\347\277+\226x\260\301@5B\205\303r\034\332_\202@\225\350\205\013c&9C!J\343H \023\376\315i}\236\325\316\367\256C\266t\217(\317J\317\fwA\314\\q-T\374\3007=L\326Mn"
+	.ascii	"\025\320c\337$\031\032$\201\355\351>\366F\r\354\360\335\370\211"
+	.ascii	"\026\256DC\006\315\022\334\276\034\215](~\364\326\032\006h\203"
+	.ascii	"r5\366r\256\205\006_\321V#B5\213N.\004\202{R\252\261\233mg6\211"
+	.ascii	"\\\220xt\237\021&\261bO\332<\351i\206\001\367#O\3658g\312\373"
+	.ascii	"\271\337\350\303+\373P\356\366\345i\200\231\376\266\201O\201"
+	.ascii	"\345\317 4\252\027\250\347\255O\213\321\247\2602\343j\246\204"
+	.ascii	"\346~J\227\241l8\213X\232`\270\233\345Fb\230\271$\304\307\253"
+	.ascii	"\342\n\262W\"\353&7U\202\273\231?\304A\302v\267nf\222\331=\232"
+	.ascii	"\252\361\3751Q)h\240\2110\352\305\0014\200VT u\020\257l\231D"
+	.ascii	"-?\340\247)\240eE\034\304R\374\020\260\326\206w\212\017( 62\033"
+	.ascii	"\250\355\364\361\237\306\341\333~~B\233\007\354\035\036\0336"
+	.ascii	"*w5n\200B\021\372\243\020\322\355\225\236i\306\325\275\274\305"
+	.ascii	"\253\225\004=\367\245\331\026R-s=g\347H\376\367z'6\246}\2571"
+	.ascii	"\255\354E\270\254\366\326\221\2718\212\003?\345\240\017\301\361"
+	.ascii	"{\024\227Y\263Wc\3418"
+	.string	"{\375\210sR\022\232\321\005GXS\274\337 .\302\261\334:\"m\nI\275\211I\0012\355\267\216^\276%\2263\237\205\036$\025-|\270\306\210\272l1r\363\252\214\024T\202\001\005r\\\375\316\222FUB\212\203\242F\267\310\264]\353]\303\203z3\f\001\024I\374\370\201W+4P \016\246\253\213\021\225\003\017\240\027\273\020\207\003\271P\220<\357\313\250'\311CWd\026\374\377\301\0166\305/\025\367\373\204\261\301\\\276\237\257\275p\214\344\243a\b\212S\375\340,?\215\370\235\274\213\236>]\263\216\336\037\252\220\302h\236k\310\005\220v\2117 \320\376\273\374Vn$Y6\364S\345jf\253\307\304\241\037r\211\256,:de\374\232\303\252n\372\242M\372C\305\276^o2\246\f5\004:\004\245\200\327p\272\326\027\024\352\036p\236C}\310s\236\210\301\220\337\371bx\3002%\206\314?)`$\313"
+	.ascii	"Cv ]LB"
+	.string	"X!\317MW\021Nc\331\036uHT9\316j\347~\276\251w\2439\325.|N\364\2730\r\206\024WK\016~$\013\236\242\272\356\360\210\367%\344\265\253\021U@\002}\303\t\205%\217\365\243\017H\027\250\201~\367\2121\207\367\027}|FK\376YU\260\016\312\3224$\004*\350\241V\302~W7F+\241\275\2574?\022\f\360\341Z\373\306\312=\270\372\344X9\301\367\370\254Xm`\270x%\222\267\302\017\234\213\235\203#l\024z%\216\277\361\210\324O\217q\237\256g\267i\350\0068q\301\275\013\235#\343\251rO\266\237\007\365\347\354\306\235u\030\215\235\236\247\026\331\355\006\2263\333\371\1776\357\273Q\b\223\235\276B\354\3748\345<\3726\022\302\326R\2540\261\241\264\323.\366\026b\034\t\340N\224\261\005o\252i\240\330\261\262\235\n&\177w\230\275\271\313\362\364\202\264\307@c0N\334\347z\266\236"
+	.ascii	"\215\374\024)\315\262s\304\002\023&\245\326\256+\262\2220\275"
+	.ascii	"i\3279O\022\340\006\212J\216\317\211O!1/\205##RE8\025b\227\\"
+	.ascii	"0\030gn}9\177\353\024\024\003?\364\304\325\212\375\217\375OU"
+	.ascii	"\223YyP\201\371\320\rC7"
+	.string	"@W\001\260\366\272\225\226V&\2010v\357$C&\360\260X)\005\202\235\021\367\230\365\374\177q(F\034\300\330\305?+\224\007\250\340 =\366\205t\252\300)\353\363%\245<I\237\302E\351$\251~R\026\304m\361AL\t\020\3313y\036\033s.\345\032\333\033tp_\265\204F\021\224\037B^\035X\fA\233\tR\027\337%U\t\216\206?z\304\204/\005K\325(\251\204\036tKe\302\276\303\264\t\360\304\r+\325!\205\337\r\221-\031\177=\002\274\r\241\nn\342\020\371~"
+	.string	"vf\351\250o\n\3401<\256c\002\315K\277\330\332\352`\255\031\3209\274{\3648B\374\304\213L\002\220\013\330B\017\303\347\321Jy\330"
+	.ascii	"\3108t\343\024v`\034A\372:y\314\324\332\310\033:{\361\272\207"
+	.ascii	"\230H\274 \205\242\363/^\347KLD\317\003\360@\335V.\2030\353\306"
+	.ascii	"\365F@AU.\331\023\335\t?G\006\250b 8h{\bm\344\376\363\320\212"
+	.ascii	"j67\265\306\032D\371Z(\214\373\220W\030\025\247$\202#\234\003"
+	.ascii	"\222\206\336;\253\324\275\215\22664\310\215I\260>\024\275\333"
+	.ascii	"^i\013\351\313\200\346_\202-\211\247\261\366S\303Is\020\302N"
+	.ascii	"\2522\373b\f^E~%\312V\327\205\254\t\240\311j\026\201\323\235"
+	.ascii	"\245\252\320&v\016\342\261Z\251\307\215&V\245.\345&y\251\325"
+	.ascii	"\377\261\232\261\237b\322\205\363\331\2741L\377\230n\001\373"
+	.ascii	"\013&\260Q\002\037W\373,\365\251\226{XK6\371\027\003\334*UvJ"
+	.ascii	"\335\314!8\3374\206\247\360\227\311\271d+\341\t\312\274\f\370"
+	.ascii	"\\\0031\200ZI\237\030c\243\354:\b\313\007\271\336o\270\302\336"
+	.ascii	"ql\225\030l\taCM\036])\371\006\2716j\021\226\315u\234 \022\243"
+	.ascii	"Z\205DW\037\217\322\273\334C(\013\f\204\tTER\b\375dD[l\202#!"
+	.ascii	"F\327\256q7_\370\367\2177v\260\214\351\370\206"
+	.string	"\274\214\223\002\240\202\310[\024\304^/\3620-\017\345)\236FY\327N\276\f\006\224u6*\217L\r\2168\3433\3622\214&\231\222\2163\026\356[D\336\350\324\034\353\336k\017\21694\334=2\212\177@\"\013\262(\354\203\306BF\024\301/\345\370\240\344A\342f\002\327;-\301\314\025\253\n\214&{R\337\342O\266\223\367\302\315\344\272\013\005\350\250\220\357\006\366\226\3439\006\267\b\0162\324\315:\310\022\277\330\353\367\177\003\206+|\034\027,\177\263\254\345\350\204/x\336\334ME\357\211\276z\306\357x\366\256\307\274\226\034\177D8\264\333)\341x\214\277\r\211*V\r5\345\265\302\274\214\357%\235-\313\316-\227\265\310\315\342Q\273\232Z\357\324\013\005\273\030\377\215\335\306\245=v\221\202\266\352q\337\353\271\317d\020\023\272\025@E#(*\036\321\314\033V\211\246\225$\2142 l\004\227S\205s.]\264"
+	.string	"SZ!\330{K~\036\332@\037\337-\234\267E+\325\370\223\254\274\376\210\246\0174\207\030\245n$h\212\016\225\200\244?l\221\013\252 \237D$h=\245\207\254\247'\004s\304\366}\376\230\347\322OA\023\336\224i=*\321v\f\037\004)U\245H"
+	.ascii	"\0332y[\366"
+	.string	"+D\337\351\337\223\261\305\230DE\006\017w\371\351\002\267JB\"K\332f\203]=\353\223\313\240eo\240`C\2511*u\330\343BB\351\347\241\004\247\036/\234\303\242O*,\003\027\021\204\036\374\335\365$\026\370\021\362_\032^;\333\371\003?- \355:\303\273N\311\240]\361Q\262V\037RVyUW\375\203\030\265v'\371\273\376k\260&\211\315]k\177\320^\367\371\320\343+\315\007\220\237\2239@3-O$B\026s\253\n%w\207\353\333\221\212V\345\207[\264=\307\337g;\315y{\024:|\265@\351\374*Gm\240J\371MS7\342!\\\034\372e*\216\203\231\242X\321\332M:<\306\352\376}\273cd\363N\340\331\333\326\304\353\217 Bu\351\360\356J\neK\tub\t\262\2638\006iC\020+I\r\323\003y',d4\221R&L\216Uq[m\366\032\003+51\355\207\240"
+	.string	"m1&\334\007Sm\315\264\323 \262\351\353Ao\342\033h\255\310\262\261y\365\373BE\334\326O)o\211;\236\377\320\313P\203\300\374\267\022\240\321\3429\304#\307\002\367\234A\352\030\220D\214\323\207\300w\250\347kN\361\005\301`\177\241\220R\350g\307\361\241Ym\254\313\246AJ|\0137\324\024q\013\233\364\225v%.\214\t&\017[?\232\024\247\223\375\311\264eOhj\233\300\034)\2129\321\244\306\254\242\265\221\f-\216t\304R\204\336p\250p d\327\245Q\032\021\220\022\260\013|V\364\f\027C\272\271\337ye3\2169\233\255\rv\336:|2\263\034yu\350\245;{"
+	.ascii	"!\" \207{\210\274j\305\344K\275\177\212Wx\236N\025\200\357\300"
+	.ascii	"Q\204\373N\336\313\335\275\232\234\017Z?\244\235\347h=\325\037"
+	.ascii	"ze\b3\2561\3012\364\005\232\007\277=\2545\177\353o\232\\\323"
+	.ascii	"\371\271\341\226\374\353;N\347g\251\223\237\256\314\375`\315"
+	.ascii	"?\273\257\367+N\326\021\027>\342O\234\377\366wv{\205Mu\357\376"
+	.ascii	"|\"\354,\001\336(\354$\306\204S\n;\345r\367\\\223\312\267\273"
+	.ascii	"\375\333\276\206pg\322\334&\306H\323\337\214\372\206R\234\361"
+	.ascii	"tc\336o\357\306\271\275\330\233%\323\307Vnb3f\375\315H\313\f"
+	.ascii	"\312\273\320\367\032\243\320\026\352lN\216\205vK\360\367\274"
+	.ascii	"\317\t\313\330\352V\255y\313\266\210q6\211y^\334\203mJP\2366"
+	.ascii	"\332{\277o%w J\370\243\331\204:\367Ps\215\267\347\355\356\337"
+	.ascii	"\376\212\2331?B\303p\216_\2224\267\031"
+	.string	"\030W\353k\036\331m\322\267\356\316\260\317\231\277\373 \351\2536\315u\315$\026z\330x[\310IP\220={\274wP\241\363\363t\035g\243/\314\314\302\235+\343F\362\372\347\345\225\332\257\262\333\226\364\314\356\231\275x\232u\203\356A\254V\363\232\312\332sL\316~\354J\006\303\270\366\357\261or\262<\3423\271\375\233\370\204\207{\200\317kz\357\241\013\370\275|\207\207\377\374|0\353j\373\2338\227U\343\266av\237\270\274E'\355\377\366\231;\257v\035\177\021[\217x\371\250\206\236\345y\357\340\306\257.\253\215\263f\327^\246\360\317Eoi\334\002U\3257\235_=v\321\360\n\244u\244I\034\220\032\2328l\377\227\207\363eLd\274\246\342}\007\307F\376\330B\2611\335i\3135T\360\213\361`\036\331\277\023,y\373\213k9\366\335\237\375\261^\227\370\350\"\033o\244\2329\232u\224N7?\316\367"
+	.ascii	"\342\020\2558^\303\177\233\025[\210\2053`\223\246\263d\034\021"
+	.ascii	"\371\025\354\023\321mN\376\030\240\035\336?\240\260\206\306\223"
+	.ascii	"9\f\216\320\020\325\331\374\354\361p\206c\205\341c>o\306q{\247"
+	.ascii	"\217!\037v\317\024>\370\260\330\347\234<kDy#\214\273cueu\216"
+	.ascii	"\3533\225\353\2241\373\002\335l\364\206s\333\3157\337\355\337"
+	.ascii	"\256{\354\267\315E\374\037\003\254\003>G\370s\n\345\037Cw\032"
+	.ascii	"Lf\255\247+\306\325\220\223\246\377\007\r\320\362\371\247\311"
+	.ascii	"\254\367{v\036\305\335\362\325\347\221C\237\003\256\213R\207"
+	.ascii	"1\306\321\313\210\330\367\273>\2421\237\321]@\364\004\004\321"
+	.ascii	"\303H\277L\377\001"
+	.text
+	.section	.gnu.lto_.symtab.ad6300dd37246489,"e",@progbits
+	.string	"pgResetFn_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"isGyroSensorCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"gyroIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\003"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\003"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"gyroFiltering"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"gyroGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\003"
+	.string	""
+	.string	"gyroReadSensorTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"initYawSpinRecovery"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\004"
+	.string	""
+	.string	"gyroConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\004"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\004"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\004"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"filterChainApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"applyRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\004"
+	.string	""
+	.string	"gyroFusionNoiseVariance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\004"
+	.string	""
+	.string	"gyroFusionWeight"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.string	"gyroFusionHealthyMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\004"
+	.string	""
+	.string	"gyroFusionUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\004"
+	.string	""
+	.string	"gyroFusionSample"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\004"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ad6300dd37246489,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,732 @@
+	.file	"gyro_fusion.c"
+	.section	.gnu.lto_.profile.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\205\006"
+	.string	"\"H\035(\220Ei\f\217\263\363\007\264\373X\365\007"
+	.string	""
+	.string	"v\200{\372\320\2524\322\346\356\256\324\177\253\241}\023\367\226do)\323\226\001\350\326\335:\356\336d\240!\255[\177%\321\301a\334\3713.\315\203\255Q\260\217#"
+	.string	"\261\332m\240"
+	.string	"\002\211I\327\271\326\327 \006\250\222L\275/\333\225\231\255\257sBR\024S\244\277\027i\n\220\322\325\371j\374\261\305\343X\260\241\222\002, \300\002\253):\005al\231\337K"
+	.string	"'\206\0268\016\304\t,"
+	.string	"\212\205!\301\234@\0018\346\320\b\030"
+	.string	"DF\325\213.\b\260\251\206\177\255\354\233(\216"
+	.ascii	"\001\230a\321\202\b\007\f\300\f\203\301\313`hAJ\375m,\020\214"
+	.ascii	"\002r\357\233\341\331j8\204\3328\245\225!"
+	.text
+	.section	.gnu.lto_.ipa_sra.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375 \233u\002"
+	.string	"\204\002\217"
+	.string	"\t"
+	.string	"\002"
+	.string	"\001\001\003\002\001"
+	.string	""
+	.string	"\003\003\004\004\001\005\001\006\001\001\002\013\002\003\265\002\001\001\020\001\006\003\007\004\003\b"
+	.string	"\020"
+	.string	"2%\3023OX\220/\221\004\215`\004\236\033Sr$5"
+	.string	"\002\330I\204r"
+	.ascii	"\330\341R0\310d\003X"
+	.text
+	.section	.gnu.lto_.inline.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`\273\003E\026"
+	.string	"\206e{F\360\356&\215\001\200\334\312s\177\337\204\364\231\035R\331\371\245:N\001\202\274\367\n|\251\007-\353\242[\037\030\262@\\l\344\344X\207\221\373\256\344\362\217\304\3530\343\220h+4\312\331\254\307@\3303\"'hK)Sd"
+	.string	"k"
+	.string	"g"
+	.string	"\"\214\210\270E<\274\350\001\301\033\361\272\350\205\300n\005\343\n;\021\250q\310\202g\374SZ\214\361b\315\270\2564\306\030s][\313\022c\212\351]J!\306(`cO\023\245y\322|H\263\231!\034"
+	.string	"\225\3600.\321\246Mn(,[\034Ja9\244\355Y\302\235\024v\306\353R\244\033\023\031\016\274i\350!\267\025\246\025\272tGg\305\245\300\277\324ehgD\242\340N\261\354^\nf_\232B\250\326\223\025\030\350\263\342^\016A\206+\035z\303\273\257\273\003\271c\301;\357\216\345\375m\214\261\206\373^\270\177-\211\240Y\314\002\223rhNH\0059\207~y\202\344PX\302\367\265B\037f1\b\316\177cDi\266\332R\006wj\020\242,\002E*-\036$[S\244\3222\340Mt\303\314\005\031\007\030\247\342\036@\367\324\276&\313\323\301He\236\341\252\330\376?\n\376\337\376"
+	.ascii	")\365\300\310\322\022\265p\273\331Po\2623\267\233\222\201\213"
+	.ascii	"\277CS\377\001\327\2410\3357\202r8\312\001\361\361\346\252\330"
+	.ascii	"\211\202\253b\371y\332n\355V\022\305\271\335T\350\360\022\325"
+	.ascii	"p\013\377{\263\326V\003:\301\332\227\231\314&\027\306V\373\201"
+	.ascii	"-\235\035\345\344d\274K\227f2\234\017.\305\342\332\240\231\354"
+	.ascii	"\206\300\035K?\214\241\276-\245a<\214\334\243\304\030S\036j\344"
+	.ascii	"\267\334\251\020\253b\252Z\321\320\377Z\344bp9\322\351\370\023"
+	.ascii	"\035J\222\371\240\300|O\226\246\004M\314>_\274z\353je\220d|\362"
+	.ascii	"\356\221\244h\250\3210\007\r)%\024\211P\220\022u@B\205\020\325"
+	.ascii	"\r\020`X\244\311p\342\004ofe\t\371c\203d\303\f4a\270\253'\311"
+	.ascii	"\217\347\276\307\"\344\262\317\224\272\210\341\344\231\331/\023"
+	.ascii	"m\332\245$#\336\306\266\224\001\257\252\030\242\371\037\002n"
+	.ascii	"\213-a\202\211.\213\306\236M\005\021\357\313\344\003m\245K\316"
+	.ascii	"\004\271\221\027\034\274&\234\330\277\363\215\364\277.\002r\324"
+	.ascii	"\203\004\022\261C\030\201\376\251\257-y\247\236\273\n\311\371"
+	.ascii	"\023\261\220\020\356\364\212\"\034\303\215\363\016\202\372\364"
+	.ascii	"\362\004\375\035\207@aaar\314u\345@\035\245\006\217\205\311+"
+	.ascii	"\245\311\241\203\214\223[X\036\310\325\030]\313\204c\030\002"
+	.ascii	"3\302\030\344>\312\032oU'\342\216\266\023\322\273\006`\254\031"
+	.ascii	"\327\2165P\273v"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\205\005"
+	.string	"\362\312\036$\240%I\007\377\243\213\027\350\307\037"
+	.string	"\200\375\037w\266\252*\326\353\313z)^\266i+\267f-!\233\310$\003$(G98J\364\212\311Zk\375\300\013\334y\344Y\255\227\022\3223^\377f\254Sg\026\250\222#.y\235g\212\0047\244\0054\r\300\241f\350\025z\251\247\370\021z\275(\276\250\376*\357\233Q\317\250\316E\355\341\366LZS\017}\225\236\215\364\356%_\032<\021\024"
+	.ascii	"2%\006\031z\346\326\233\322\314\267\240\"\200\"\3109\332\320"
+	.ascii	"c\240\2433p\315\213d\210Q0\321 \217\343\310\203\271\311\234\325"
+	.ascii	"\224\n\211\313\370\005\030\002"
+	.text
+	.section	.gnu.lto_.pureconst.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\205\004\007\205\004\b\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`\177\001\025\t"
+	.string	"\022\314$&\220'I\007\377s~w\372\260\212\256\356t\327\325\301zN1\377\025\337\022\355G\326Z\216@\253\334\356\326\332\336r\247\023\024\034\f\030\013\364\022Y\310\302u\310\007\340\262\343\304,W\342:\007\325\270J\245\355\324\304(e\221\350\334r, \304\204\311LM\225JLO\264\337}fJ\260\2560$*l?\bo\004zT\233m\305I\\lwEmEQ\246\306N\364\254/H\203A\037u\214\331R/\316/u\017@3qm\333IqD\r\365\303\307\027!C\250\221\301\300\\\221\024\0266\346@\002c\320\331\035\020H\210\246\246\031\016Y\340\321\360T\027\301\020\030\313/k"
+	.string	"R\211\004Ig\023\252\020\211+\026\205\374g\005"
+	.ascii	"8\314\213o\222I\301\027\220\212\333\265\001Ac9\205\2137\206\255"
+	.ascii	"7\006K*\372\035^\0030\013m\316\352\303^\262\275$\250\256Y_\023"
+	.ascii	"&\272\"Gpze\006\267\373:Ti\247\315\2353g\\\205\031\203\301\371"
+	.ascii	"\2449\261y%\210nj\027h\236pJ<+\247\017\001\032"
+	.text
+	.section	.gnu.lto_.lto.2efed84949c0ece3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroFusionInit.12.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`*\005U "
+	.string	"\346\272\310G\240\330M:\300\027\275\216\016\344\300E\035\212\234\234?\0276\371;p\2551_:\234\241\177/!bN\177\264}\203\257M\205\005\215\224\005\317d\344\003\336\201\036\257\0363yy)B\215\307sa\211M\255I#\204H\231R\266"
+	.string	"\243"
+	.string	"\264"
+	.string	"HGN\024\310\2136\272j;\200\220;P\206wN\250/\021\256\366\251^\225\373o\306\005\314)\265\3655'p\201\033\220\027\r<\316x\221\374\315x\3219[\214NR\355\213\022\326\330\234\323\266;\354\2259|\b\274g\233;mF\312F1\\\315\371>\254\2430-\237\356\264\260\266e\310\323\261\324x\n\0378qm\371V\222\316|t09\235\fm\260\324\270\0216\340\251LH\323G\257\037h\n\353\371\232.~\353\372\344\213\312L\016&\247\2074\237\215o\230@\214I\031"
+	.string	">\244\020\207\006\220\336\261\256K\276#U\331\2049\247\265\347c\272\313\333\316b\273\203\035j\t\373}\326C\2532A\2454;\rz\246J\344\2262\376|\300\3327\026\372\236\377\343\313\214\030ou6P\247;e\277gN\235W\312\356\341\031\325;?\362\353\254:GT\343\034\370\023\370\357\0370\252k\336u\327\256u\227\253\246\211\352\231\250&W-\023\325\343\250\026Gu\270\352\025\325\272\352\373lO\tIN\330\2344\202h\246\025\261I\220w\375Z\366\227\370^.\273\234\240\321@r\331\345\267\\>\311\225\344\256e\260p&\251@uFl\316\371s\321\030\310\213=\341\263\354RK#\277\312\375\210\013\265\231\001\253:\036\312\024\274\266=[\356\b\343A\251K\034\213\275\020\360\2609\374\212\207\237\237}\342V>"
+	.string	"q\231sJ\b\361*\"DT\215Q\001\201\302#\274\256P~cc;\r\356\3169u\343NY\\)Cx\322\262\267;[\263Kv\315\332A\227b\257\002]n\3544\030\206"
+	.ascii	"T\fm!\023\372\336\316\366$\255\316\341\332\353V\2449w\007\304"
+	.ascii	"=/\312n\270\347\211\351\354\256\210u\032\222'I\273Sv1\352\354"
+	.ascii	"\316V\226+/Hz\306\272\366\320\301d\220sN \337\t\b\0245\\|\314"
+	.ascii	"\030/\2767&gu\217\365\233%\341\r6~s\366<2G\0324\201\270\241\027"
+	.ascii	"A\341\320cX\0202\n\322 \224b\205\212 \\\315\210\250\305\215B"
+	.ascii	"9\232\004\003\242\333\020\256E\211\021\267\"\030&l\270\242\033"
+	.ascii	"\216H\bg#\032\nRa#Q\204\2631\360\361m\205P\221\315\350v+\262"
+	.ascii	"\225\300\371\225\302z\005!Qf\304v{d\332\031\222g\327K\370\363"
+	.ascii	"\262\374]Q\231-m\257\224F\314l\rt\371\3554\370\2509u\263ry\366"
+	.ascii	"[\327*UGaYP\344\202\t\300\005g\307%\367\\\277\t\243dC\2668kU"
+	.ascii	"JS\256\202\3136\234\302C\343\013\3672n-\n\n\307\357\3370\332"
+	.ascii	"\031\036\266\301\200\025\320\026-\347\272\026\261\032#\263\323"
+	.ascii	"\240\222;\345\262\307\330\263b\017\361\347\265]Z\360Zj\250\221"
+	.ascii	"<\204\0201J\231\231\031\221\026$I\007p\002\031\252\262\036\021"
+	.ascii	"\240\301T\244\260 \311rA<\274\371\343\3437<\262\224\202\314k"
+	.ascii	"\211!\336#C)\323\032\246\260E\331fZ\n:\267\347\366\234\336\246"
+	.ascii	"<\213%Es\004u2\213\257\003\231\376\206\003\263[\303\363\350\314"
+	.ascii	"\370\203e\233a\003:D\022\256>\327\331\f3\351\325\017\210\227"
+	.ascii	"\352\205\362\205\021\362\005\024\257h\026\322\345s\361\026p|"
+	.ascii	"\242\021dl\035U\273\240\036P\247\205'\340\2178\020\313\332,\200"
+	.ascii	"\257\205\311\332/\300\230\252\006\213\325\323\027\304\314\003"
+	.ascii	"\"\250\332\355E\331\252\306\253\002\211\345M\221\360\327\t\232"
+	.ascii	"\026E\207\001F\017v\300\372\314\243\026\035 \337\315\004\370"
+	.ascii	"\017\232\257\2426\270\256\243\024\020\307,\364H\236\2455f\267"
+	.ascii	"\2135ft\375\371\257jTC\314j"
+	.text
+	.section	.gnu.lto_gyroFusionSample.13.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`;\n\3550"
+	.string	"jU\234\022BP\236N\007\363\336\364=\220\265\225\177\017\274\033c\202\267\016\373\314\023,f\364\376\332\366\267)\242R\003C\025\013\230\241:\222-\200l"
+	.string	"\f\231\030`"
+	.ascii	"\306\272\313\255\226\314%\212f\"$\311\336;\245\224\002\022\001"
+	.ascii	"\001\001\032\001\\:e\3560|\324\343\275\276f\267m\254i\253\242"
+	.ascii	"\302\013\367\027>Bu\264\305\225\350\302\235\207\307\264^eGdm"
+	.ascii	"BB\330\336\302}\307\307V\231\231\013\357Y\2572\373\264[\233s"
+	.ascii	"\357M\266\312\035l\253~df\025Kg\351j-[\251\320\005k\223r\301"
+	.ascii	"\266\312\224\246W`$\t]0;4\251w\346\007\021\272\272\216\213\377"
+	.ascii	"\336\265\301\t\355\314=\245\251t5\035\215\036\272\327\315\313"
+	.ascii	"\227{\353\030p\224m\225\353\332hm\325v\321\332*w1\017v\035\334"
+	.ascii	"m49\304\262\030\336{\241\336\b\177\247u\315F\357\352\237\243"
+	.ascii	"\261h\211\253\232\276wq\033\235^\375\243\326\307T(\260,-\215"
+	.ascii	"\272\023s#q\252\210\031Z\027\233\210\230\235\265M\227\326\374"
+	.ascii	"zt`\331Y\212 \017\210\023\323\2475\277\036Fg\332\342\364\263"
+	.ascii	"\233\232\224\251\371\332M\264V\303<=:\301\374\201\2345R\246{"
+	.ascii	"o?\333\311\234_\356\304\251{/\373\230\323\254\031\331\314,\310"
+	.ascii	"\314+\230\213b\002Ij\274\351\t\233\266\364\3378\375\377^c\347"
+	.string	"\006\314\363,h3\f\235\300L\242\001\225GB\274\2772\351Op\243\327d\272\2420m\0347\214\265\325\377t\217\f\255\351\321\346+p\274d\371\346Z\375M\330\275\001\363<\314L\325b\270\236\020\217\231gt_\025\2046\367^\nV\315\267<:\237\022\366\246Rp\307]\255\255\372?!\336!\335\200\357\357g3p>\355\330<\3734=\312\\\347\345\377\306\334]\243/\310\030\277\033sTC\233\223\215\327\374\364\316\nZ\2579Ak\351>\320W\272\01305]7\201\256\353\036\320\\\232\227\210\316J\357\234dtF\262\316G\326\331\310:\003\260\316E\326\231\310:\017Yg!\353\034d\235\201\2543\322:\377\244\316\307\242\263\261\350\\\264\316\326:\023\255\363j\235U\353\234Z\347':\373;\267\203\ne\206\204Ix\356\335\021\335s\315\250zKZ\257\033\332\215\327\035^4\372\261\033n\303\305\226\375\024\323ct"
+	.ascii	"|\320\033\275\232\027\266V\364B\017\340\211\205AO\364E/\2400"
+	.ascii	"\214\311\027\264\221\354!1s/[\210F\367\200\335\33340\364D\037"
+	.ascii	" \371\311\037z%>aM\276@8\030C\255\177M\245\240\261\266*\364\021"
+	.ascii	"\216\3205\335\213\241\bD\370U\252r|\206\321>A_d\343;\004\372"
+	.ascii	"\247O\376\347\355ahk\201\033\321z\224H0|sy\016\201\276\277t*"
+	.ascii	"g\205\017\212^\007>\373n\330\026\220\303\210\335\037\362\177"
+	.ascii	"\376\351]0\214\311\227G3\364\035\206J\301\025*\221lP;u\220/u"
+	.ascii	"D\305\3177\031\232\361\013\374\361;\314I\332Lf-\276\361;\254"
+	.ascii	"\311\227Gy\351"
+	.string	"\213\337y\255\3728\213\212\365\371{o\223h\237\370\310;\r\247\3450\264\371\f*\245\344\004\343x\363\3367\0377\226\370j\205/4\246\016\230uM6\177\262\331\223\315i\232l\246'\343\356{\357U\327W\377\007\0314\033\206\266\337\032e\004\247\2324\353\267_`\252~UT^\365\202\305\362\302\t\254,\253%\363X\365\202\305\362\204\312\274\212Q\2252A,[\\}\370Y\262p\321\242\212\271\306X\236\300\272RW\266j\200\225u\305\334BA\225\245%#\005\024S+\213\211\265dBa]U\265\200\262\322bB5h\342,\027K-\250\027YYZP\307\272\333\357\306<\325\374\257\237\356\r+\263\006W\262\341\345\322$\211S\345\322\314\331Qzf*G\302\365r\200G\340\024\274\022\221`\277\351\004\257\340\235\312\204\331Y\320I\237\340\225\362\374\223\276\3034\2061iQ\261>\007\276\310\326\313\001\316\275\271\021\331"
+	.ascii	"\241\250!=3\007'\262\365rlC\324\214\321iv\360\265\255\242\225"
+	.ascii	"?\303{\257\204 jHNV\376\016\351\356"
+	.string	"\277q\337\265\323\233b\324s\2522\375\322\223-}\337\351\356\364\376\333\322G}\337\265\252v\206\347\b\215\241H$\374L\371\204e\346\200\374\370\3021:G\337ji}dh\310\036\f\025\320\306\203\36304s\226\245A\237v0\224\300\b\327\241|B\277\271\0348\226G\347\3230\257\235\300\370A\001\322\364h\200\277\250A@\204\030d\244DHF\222$\031\326\320\002\221\031\252\325\001\0210\251DH\t\311\005I\261\016Z\221\336U\211\300*-\330\002P.\207\306\033\364>\302j#$\266\251\200il\303\226\304\353,B\026\t\222\362\361\202L\320O$^\3246A\026A\302\256\22794{\321\342\036N\232\350'\023>\342v\032)\003\207\f\352\222\236\004\t1\0341\177\377<~\205\304\267:5\330\220H_w\251R\224\226\245M\376\232\331\256\236\214\256\351\316\026\346<Ox\333\335PO\263_j>\260\241\"M("
+	.string	"\023\377\347S\241\036\031X@:&P*\023"
+	.string	"M(z(\234*\207\310\372\241\214\211"
+	.string	"yYh8\034\017\225X\231\336G\353\032\340\371\255&\313\362\360\253\267\246\375\267DPo\362\257A\314\353\t\317\244YQ\276\2352\321\233\313M\341\37100\226/\3550p\207'\347\246\221\017\347@\214\341\177\337^[\3504\360\272$\343\371F\203\326\034g\233\256\276\334%\342\377\001o\357\316\312\374\367"
+	.string	"\342\323\376^\310\333\305\020\226\271\362}^P\313\375WD\254\301R\326*\245w\245l\341\200\226\215\270C\372\235\foD\333\025M\254\313\244\321\246\254\234\215\005\013\016xm@\324S\206\326\001\330\231CC<K\325\221\201\346;\277\234"
+	.ascii	"\235\"\016#~j\330\022\t\267c\251\001"
+	.text
+	.section	.gnu.lto_gyroFusionAlign.14.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`\354\005\265\""
+	.string	"\226\377\330G\240ZQ:\304\247\241\320,\305\266~\271\316o\377\035\247\372Ei\217<a\302\2023\bxJ\243I\264\303-7\227\023\356n7[\177%\004\021y\013x\340Ux\276\200I\326\303>5\302\254\371h\264\377\023B\b\221;\245\307"
+	.string	"\266"
+	.string	"\304"
+	.ascii	"'\307?\031f\033\212\213g\021\222\317O\fT\232Z+\203\223\276`S"
+	.ascii	"\341\235\020\375\311\213QV\215\230\216&\234'\r\214\247\366\231"
+	.ascii	"\274\t\321\233`\034@\255=\254\242j\025:0\204\363\244\205\357"
+	.ascii	")O\236\017P\2364\221}\346B \325d\252\002|rSk\245\355\017\357"
+	.ascii	"G\341\r\243D\217\301^\256\323,\311q)\221oV8\260\004\346(\251"
+	.ascii	"\350\261Q\226c\204 d\004\351\006\205\371P\302\361\227Y\301\312"
+	.ascii	"I\246*5<\224p\334%\304C\311\306O#H5\2509\002-I\321H@\305\204"
+	.ascii	"\005\244\345\217\2221\350hDwx\2410H6F\003\265\326?\235\312H\362"
+	.ascii	"QjV\250\265\232\036%)\335:\267_\300v\n\233\314\020\302Z\353\236"
+	.ascii	"E\371\035\341teD\341\330>\361,,\316Z\253\004\037K\007\334)\004"
+	.ascii	"Fy\362\273j\260\2244\365\350\226-\364\321\r\332\177\335\036\366"
+	.ascii	"I=#\251\203\200L\352\237\023\357\001$\265\317I\335\363'\277\200"
+	.ascii	"7\375\001\036u\313\016\345\3461\251wLj\035\223:fR\303L\352\227"
+	.ascii	"I\3552\251\317\221\332\034\251\313\221\232,\251G\222zIj:R\277"
+	.ascii	"\200\271\205j\206\246\326\031[q\352\024y\205\310\243~\342\017"
+	.ascii	"\345k\377V\242\254\345,B:\207NU\032N)>\024\321\305W\245J\247"
+	.ascii	"\314\370\2440\234T\222\262\222\f?\305\206\331\305\245\330E\205"
+	.ascii	"\365(6\314\205\r\013\247\346\247N?\365\017\357J\262\004\352\374"
+	.ascii	"\331?\375\304Rrf]\264M\021\360\254\f\2736X|\265\251Q\255=\004"
+	.ascii	"\003\366g\027h\375\330\270\366\334\001K\200\314\317\313l]\033"
+	.ascii	"\224\325\263\347\036\352\026\262\3500\363K\323\243[\246C\216"
+	.ascii	"v\234\033\324rsw\345\222k\356j\001\326\370\227\367l\271#\021"
+	.ascii	"\310\344C\345l\311\375\360\t\250\262\234\314\f\231\370l\217\200"
+	.ascii	"\245\353\263\247rzC\353\027\264\263\375\321\002\316\331\245\033"
+	.ascii	"\264\237\362\361\b\2314H\200Q\212\370\350\226G)\032M\346m\345"
+	.ascii	"\270:k\234\276\324.e\033\367e\306r7\026\244\304\275\354\236\270"
+	.ascii	"\344\267\234.\275\272\275\313\013\272\021\254\350\270A\377E)"
+	.ascii	"`\337t\0076\361\300\206\273\251\240\345t8\234\256F\200wk14\016"
+	.ascii	"\211\2409\335MEmhG\342\344q\260\341n\033l\265\234mg#a\333\361"
+	.ascii	"\224\256=\310\351n\274\025$D\350v.J\320x;\035/g\343\321r\267"
+	.ascii	"!\034\255\266\343\321\036\bY\207\302\266\243\251\320\351v4\230"
+	.ascii	"\260\367\355\341!\227\251\336\372b\033\264\353\352\005\264{\345"
+	.ascii	"bp\331\312pp\331\276Mmp\331\002\355s,\rw\326\312\305\031\020"
+	.ascii	"\017\257\342\251\222s\264Fg_\273\263\245\326o\211gc\253\263?"
+	.ascii	"\304\237\221\327\3026\266A\304_\021_\031\027\237\365\341d>\006"
+	.ascii	"\266\317\262\272\322\243[!.\306EZU\255\225\202\r\342aD\234TP"
+	.ascii	"\365\332[9\0035l\336\\\331Zk\321k\203\246#Y~*q\250q\034\007\035"
+	.ascii	"B\210\214\215\210\004\222\202\244\305\200\002\031*\253y\021\200"
+	.ascii	")F8SX#sj6\275\322:\226O\315 \263\262\313\277\314q\350\304\307"
+	.ascii	"\274\203\254\201\b\3007&A\2277h\304\347^$\270\350eX\261#\033"
+	.ascii	"\257\347\207\273l;|$|W\030V\021T\\\343\243u\360\006\3241\350"
+	.ascii	"\314\006\212\3351L\224\240W\216\220X\242\342\205\347\326\265"
+	.ascii	"q;\026\242\341B\024\221\214\327\361P\252\340\fw\342\355\016_"
+	.ascii	"\0227\021\262\300\275=x\2502\361<B\002\351\350{\201\246\361\353"
+	.ascii	"\002\346C9\201\364:)lA\210\0055\302%\020s\037\242\007\324osz"
+	.ascii	"\003\273\223\3476\306N\n\340\253\305\002\216[\237 \0065\272\360"
+	.ascii	"\213M\304\002y\b\306\352\2144\246\276\035\261Zq\3706u\270c\343"
+	.ascii	"L\004\210\273\364!\301Np\035?Vk]\333]\367q\254\006"
+	.text
+	.section	.gnu.lto_gyroFusionMedian.15.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`\227\005\375\""
+	.string	"\312A\374\rG\240\330M:\220C\336\003]\343;\331\246\342h\371\363\310\246\332\031-l\237\\]\274\310\003\024\375\304\266<o\020\240K\b\003X\201i\340\331\361R\216\006\353\007\254\300\366\t\244,\301\336GE\215h[\263\204\020\262\245L)\314"
+	.string	"\270"
+	.string	"\315"
+	.ascii	"v\222m\263\255z.\217\231V\226:\274<)\313R\310\022\256\366\265"
+	.ascii	"\276\225t\237\305~S\226"
+	.string	"VbO\312\322'\344\007\344C\373\310#y\222$\0338}XA\306\237YSW\231\262,u>\317\021\037\316\343\210\017\267G\3501\030\f\246\371\364\335\344&\375f\253\321\310Q\f\347j\222?f\b\215`\2219E)\375f\0333\350\220\302\361Z\031\324\215\351\363{\202,(*\245\3151\306\f!/\203\2621'\234\205\201r\257%%\023\360\220\232\372h\213bRq.\327\027\031\200\250\246YA\211\021\037\017\273>E\3614$B\3433\354S\253g\305)\212\306\367^\017w\224\021\243Cj\352:f(\313\322\352\024%u\327\334\276\215\355\rv\030!=`S\032\030\032\214P&\345\307\356\225\355SR\261l\253\311ke\013\0055x\223\033HT3\020\325\013\356\373s\347\372\177D\265O\317\273n\234\250F \252\017\\m\340`w\001Q\315s5\201P\2753\325:S\235\243\352\001W\343L\265\200\251\276Qu"
+	.string	"U\333\\\r T\327\204\352[\250\266\211\352\332\325\264\251&\247z\274Z\f\325a\250\236W\357T\353T\177\250V\003\013\216LY\316\b\236)\257\204P\206\034\354o\362w}\355/\237\311\303lk\342\202T\202\322y\332aF\003\t\266\343\f\003\371%\276\227m]\036#\225\240\310\257_\2310eY\006=\264\005\362\341\003Z\277)Lzv\013]TY\244\330\263\236\341\320\01388n\205V\252\367\005$\302@\033.;]\246j6\267"
+	.ascii	"n[c\333\333\236WU`m{\241\027T \343^\031hk{\255_\025&=Ca Y\333"
+	.ascii	"?Q\221\233[\232\223\217K\366\354\270\207\352Yy\226/\\`\342^\271"
+	.ascii	"\305V\225\031\264+\266\204l\203\355\331'\353f\200\371ya\322\263"
+	.ascii	"Y\226e\031\366l\320V\350\201\341U\325\326\027320g\2518\215\t"
+	.ascii	"7\267\342\217|n\b\341\343\316\365\320\333\302\253ZZ&9\254\306"
+	.ascii	"\246\207\216\333\006K\241G\306\253\362\305Z\030\230\343\022\304"
+	.ascii	"\267\230\370\020h\325\354\211J7\267\273\347\025\231\267\024\361"
+	.ascii	"\253{^\326\222\006\215\333\357\303\036\326\bDH(B\260\bO\334\304"
+	.ascii	"W\024!\355F\204GDH(B\260\020=b\250hg\342\b\211\004\210\235\221"
+	.ascii	"\213\022\272#\243\335Q\021\321\221\256\310D\210\024\272\021F"
+	.ascii	"G\272\241\004\336\251 2\322\255\330\355\214t6_\371\265\262\332"
+	.ascii	"\026\254\326\030\254\217\317\372\300\330\245y\003\336\263,a("
+	.ascii	"@\260\0136\324\302\313:\260<\213`\t\230\361\2528\034\320\331"
+	.ascii	"\334\032X\036\263\016<;\233[\002/\216#\352\354N\316\352\254h"
+	.ascii	"6`s\016\345?;`G-j\333+\261\017\006\376`1\330P\213\200\315-\316"
+	.ascii	"\315\n\330\331\305\313\n\2607\373\2464\367\230\370\263\001v\242"
+	.ascii	"\341\035Y\322\340\227HoI-\3506\253c~^\034\374gm\366\277\317("
+	.ascii	"XdMSK\032\224A\333+\323\250F\241]/\372\364\263\270\275\327i\001"
+	.ascii	"i\250Q0\243\214TJ1\031\021IJ\333r\240\002\2311\3436\021\220\265"
+	.ascii	"\203TZ\330?\003R\n\222\262Z\373G\204\027\203\260x\003\240\305"
+	.ascii	"I\031\350\233\314\356\"V\234J\230J\370\t\002]\324^ECp`WH\200"
+	.ascii	";\350\330\374\024:\323[\002WQ\302Y-t\300`\205\230\206j\355U\263"
+	.ascii	"\250\355\221'>7z\242+\b\312\350\216\035\244\334)\352\037\222"
+	.ascii	"f\r\365\230]\314\036\307\017y\214y<\346\211{\023\247'[\300H\234"
+	.ascii	"\364\331k\025-\001\331\207KN\233y\021\022\f\375\037wb\313\022"
+	.ascii	"\024E\030 uIZ\004v\375\204\232,\201.T\036\\\256l\347@\355\251"
+	.ascii	"\027\321\017\024II\001\221*\364\264\360\244\226:Q\367\221\200"
+	.ascii	"n\233@M\344\232y\357\335\340\232|t\222\331\246\220\376\001"
+	.text
+	.section	.gnu.lto_gyroFusionVote.16.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`m\026\315e"
+	.string	"\n\245\200$N \222RI\007,\306w\033z:\265\313\336\232\354G\337\346\003 \b\2733\357-'\314Eu\323+\336\330\325$\306`\301T\367\2651:\326\212\303\034\b\341`\356"
+	.ascii	"v\206 \004\360\302\320\364\343\025.\371\347\232\3253\326\032"
+	.ascii	"i\2445\"e\222\001;\002\372\001;\002\377\333\257\345\337\362\313"
+	.ascii	"\335g\367m\356\036\302\017}?\374\260\017\\s\265\204Y'\bV\374"
+	.ascii	"\333\003\316\321\245\331\253Y\0315\260\356g\225\224\345V\231"
+	.ascii	"\3448\333[#\254\325\255\253O\214\334\036\367\316wf\353\274\224"
+	.ascii	"V\300p\025?\274\002\202\032\231\275\231=\226\271z\005\253|\306"
+	.ascii	"\2058,[y\273\307\036\366c\304\310\305\231]\253n\257\303w8\336"
+	.ascii	"\036y\370\035\326\303l\260\325'\206V\353\227\222\342\207\257"
+	.ascii	"=\007\"\332m]1\353k\210\253O\005\252\"\230\275c\222\tJ\375\313"
+	.ascii	"\236n\217\037\316\355]\\\nE\212\037\016\017\367\270s\271\227"
+	.ascii	"=\356\273<\007\254\313uP\314\372*r\351c\002U\3740\351<\020q\013"
+	.ascii	"\224'-J"
+	.string	"\222\266zjeFA\363Qt;\016X\177SR\314\3722\240\017\005\301Z+\323\207{co\347\274\373\265\263a\275\315\203\373\324Je\f\230Z\335^l\214\342\207\353v!\342\207\305\003\021?\304\332es7\262\2122I\340\212#\254\2656\265\013\347i$:O\024\333?\335\276;C\254\247@\261tB)\t\311D\211#\022F#\212\210\206\204\202\200~|zD\204\340Q\261s4\246E\2248<\233\261\366^\316%hQ\372\3115\311z\212\271\276\024\030\305\227/\235\360\"\307J^r\340$\264\007\030\0260^\216t\003\233\350\322\306%\272\260\361\021\2115\033\330h\355#\316\244\032\316$5Y\270H\355\214\241\224\366%\306DX>$d\345AV\030\350\314\214\177\316\026bdL8\337\327\225S\350\f\013k\236\366U\205}\320\036\3141n\306\300\256\274\247\214\214E\244}\251p&\005^\211\357\213\214C\240="
+	.string	"\317g\202kY\306\300\260\234\347Z_\256\342\354\241;c(y\247\0050)?\236;i`\210r\276/\024\316\031P\276\244\371\230-6\266"
+	.string	"\026\345)\224\027\225P\264\307\030\330\223\023C4\341:6Y\362\220\357\013\312\231\224w\366j\002\002\237cn"
+	.string	"\323\314\315\030X\224\367\351\336\242L\315Z\341\030\230\2243\332\243\326\272\334\325\004\354\273\342\273}\356.\n\273@o\001z]OWZ\"\204\200\004\372\302h\221\256\321\311n\242\263|\243\\^\361\0325@\030\204'\2501<B\336be\221\276\231\377\324\225}\365\232\315:D\246\337h\364\311\t7\234\375u\274\255#j:]\203\\\257h\220\325\272\345\264\233\300\233O\351 \236\332\207u\350\234\315\243\205\227\305\35674\233s\206\315\\+b\367\307\340"
+	.string	"\267X\316\356\006\271\034\006\206\203a\bk\335\262\261\344\205\r\f\240\306\201\023B\361\f\206Q\213\363\301`r\207\020?\354~\336S\f\206)l\343f\263Yx6\263nwy\351\311\341\266n\210\254\326\352t\274\257H\273S#\334\275Z\265z\177\230{W\202\t\210\357\372\321I[\235\265o\356\006\202\253\316F}\020Y\254\265\332\330\273\371`0Y<\363\200\370\341\233\312\20451\2666-n\356\272eq3w\237Tk\3266\225\335\013,Hy\217\\\357[\301\317|\215\244\274\311\227\371\026Iy\221Q)/\021\b\206<\3605_(!F\336\005\316\346\033\344\t\345\005\202\362\036p\271\357\217\267\375\006\030y\005Hyy\374\357\273CG\216\243\371\342\270\230\257\323\r\0335n\367\245\361\271\357\f#\257\f\2247"
+	.ascii	"\2247\206\221\267\t\345\205\201\362\276@y]\354\3602\355\360\266"
+	.ascii	"\270\337\227\305\301|\0010\362\2560\362\2520\362\2460\362\242"
+	.ascii	"@y\227P\336\023D^%\2247\351v_$\224\327\004\312[\302\310{\204"
+	.ascii	"\362\222 \362\032\021yG\020y\213R^\242\224w(\345\025Jy\203R^"
+	.ascii	" \"\357O\312\353\223\362\366\244\274\"\216\274!R^\236\224w'\345"
+	.ascii	"=\246\274\306\2247My\213)/j\344%\242\274\303\224\367$\362v\221"
+	.ascii	"\227Q\336#9\232\"&\205\271\244\375\334*\223\346\234\2727\264"
+	.ascii	"\303r6\377\232\377\357\367\373\321\374z\377\231\277\314/\346"
+	.ascii	"\007\363\333\375a\376\271\017t\317\021\205\232y\026\261\251U"
+	.ascii	"\tj*D=\244\267\305r\340\210\372\201\177j[w<\032\2244\023'\204"
+	.ascii	"3\3100\324\307+\263\353!\223\343\006\250\231+\324A\335r\204\372"
+	.ascii	"\306\237]=\241:\250\377e%\3162M\251\003\020|?h\377\321MN\332"
+	.ascii	"\300\375U\037\250\006\352!\335s\\jq@\315\243\025\230\305\216"
+	.ascii	"\247\324\252\325\363\016\210?\232\253\300\231\021\321\314 \376"
+	.ascii	"\303X\254\234\234\240\271b\345\247Q\2555\205m>\r\325=\267$"
+	.string	"\354i\021\355\323EsK\264e\261\247OW\266\344*[\307\203\313\224H9Y#sAD?\360Mc~\205\333\265\326\254\020H\307\222\201\030\242\237\372\201\\kJn\302\300T\260d\340\341\004Mlm\004f\241\001\033cP\02289\023[\343\025\260h ~\030\242\257\346\314\346\004M\214\255\255\362\250h*\233\002\036\243\272\001\231\3513^|F\n\347\265V\345\216\361F\003`\254\321H3:\252O\367\241\224\2626\033\234\265\216\r \370\306\315\345\211\2532\213\3235\250\325\305\270\323<\375\245\330\261\323\336\351\007.\305\334j\255Dc\037\233\373\226\230H\357b\331\200\305F|\227\361,3e\253\263\224\"\240\260\307\006\251\211\364}8\002hf\315%\034e\335\277\244\201aJ\255;@\263I\270U\253\326R\261\323\036\316-\323\224\305\376\ffq\226\204hs\331:!\262\271\256\301$\006\240\337\303\361\b\350\332\365Q"
+	.ascii	"\277\013}\nrA\354\201\320Y|l\346\362\324\220^\220\222\335\265"
+	.ascii	"5\323\235l\274\271[\322^{\2464\372x/\316\331\241N\327h/'6pf\206"
+	.ascii	"M\354\377`\023\206,\322\356\n\333Z\257\331\f\302\330\314U\303"
+	.ascii	"\023+Zp\243m\264\327\363\236\276\271\253S\344\321{\2365\232\206"
+	.ascii	"S_\320"
+	.string	"\037\363a\230*z\2346s\031E\366\321\336]\035b\262y\264\327\256\213\337h\013:\002\263\272\245\330\2216A\226\3673\377\236T\320F\372H\343\230[\302Qr\263\311\025\003\361\3654\344\215\214\032\223%\0254\223)\263\273\037\231\221>\337O\031\354\310\234E\257\253\016STRI\242\2444H\026I\253\222RH\222\\Q\241Q\0230\005\023\260\324\255\222WH\2424 NIapD\016\255\2448\210:\223L]Q\371\350\340H\022$Q\311#;I\344T\262*i$Y\225\026ABu\304*Yu$I\232DNEIUE\t\341 \n\203#q\2210\246\250\244\254\256\214L@U\325A\005MVUTVSI\253\246)\251(\f\232\220UVM0\224\226*\203dUS\022*\252\252\246\243[}S\331\323M-\024\324j\345\233\026%^\356#\370\226\242\231{\224\263$\244\033P\005\323q\340h\031\375\266"
+	.string	"Z\006\233"
+	.string	"\032\351\357Sj\315Bq\034-\244\337w\246\301>\245\337\226\254\245\030k\016h\030\035c\216\313\204\246>\240\251O:\3139J@\030M\364F,\205\266[\021\375\254\230\302\004\323\364\325Q{\243uTk=\221\303_4\317"
+	.ascii	"\367\347\003\222H"
+	.ascii	"\330\032\2763/\272\251\254\315\251\326\252D\024(XkV\222\213\326"
+	.ascii	"\023RSk\005\322K\355\"ej \275\314U\247E3\365\271\242h\265\350"
+	.ascii	"\024\214\216\322\217K\031+\24604d\362P\2739\204ozj\255H+\272"
+	.ascii	"\001U4\212^\321Fw\\OR\264\2126\352\343\212\202\243]<E\223\210"
+	.ascii	"[\316Yj\024Q,f\251\277\245\254\315D3\327\207#\211'\372p\340\314"
+	.ascii	"\204A*p\307\303\211^Q\266%\224\272\312\316\212)lO\0070J\315"
+	.string	"s\240\034%\321!\231\302b\230\373\362fR\177p\245\315RLYI \211&\372W\272 s\204\241q\331b\242\32118Y\214J\264\026$\023\334\333\273\006\027\350\022Aqh\202\364\002\355\"n\371\346<\352 mDg)F\242\217\372X/p\033\262\275\204\235\261\255\221\350\267\371\231%\r\210\302\266\035\321\314\335\223HG\263`!%\314\254\bp(%\023\303\206\207\351;\332k\317\241\034\3057b\350x\236ZG{\031\265\017\300\021]\324F}\006r=\321\321#z\030\307\025\205\277w\304\035]\004v\026\207\253\006%7\177\022\005\376\314K#\364@\357\351\363 \376\300\247h\362\256\364\f\351\034;\032\202>\340\207d\316\342h\r\0051]\004 \220\213\013 @\007\201\317\250q<\345\020S\204FDD$I\222\264\0061\005\004!\006%<n\0210)D\320\214\fIAA\nRX\306;S\310\034\365\215\276"
+	.ascii	"\311PmL\310\275T\312\002\032\225F\346\307\316\240\026\013\246"
+	.ascii	"\305\361!\200ii;t\357\037y\r\2327w\210nE<\033\0352\361X\346."
+	.ascii	"\031Y\007\224u%\f\033^\373\020c\257-c\277\036#\243\212\341\203"
+	.ascii	"\220\375\213\240\322\to\020\355spGq\234iMz\033Q\254\326\tN\240"
+	.ascii	"6\371\2731\030U\243\234&\373>dP\017\013>f\255\316\217\233F\233"
+	.ascii	"\275\334\314\376\270\250z*\243\017t\317\013\fn\370F\350\211\004"
+	.ascii	"e\203\363\274\227S'\302\005rD\363D\032P:\244\351\266A\305\335"
+	.ascii	"P\3176Q\233"
+	.string	"c\036YWf\003\273MD\316\351\021\177HQ\252\264e\236\"5\321;c\"\332B\005&\341:\315\2013\025\307\223P\314p\272\332)\202lH=8\3724\363\246\345\255\236\257K\317\002t,\242\255\304\030e\024x6K\232\3163\316#\245\344\035\222\214W\273\002\n\254\006\246\200f\363o\375\202\352\3638\226\307\037;\n=\247\263\024W>\336;\360:x+\317\340\037C\r\032c\271 p\213\360\"\245\267\365\327\235\353\002\024F\370\263\213_\307oX\205\001\327\326Hbo\355U\230\254\320hH*;r\034\224,Wl\360%\351\205@\240\316\362\2741\002\033\025\321g\243\"\352\004g\301\030\370\237L\023\025za\207,\226X'\001\035q:\204\030yx\230\354,\356\344\267G\235\225\244Z\242#\336\311\030\007\002G{\364\307\325\324\267\232\252\206\031\233\227\367h\017J\352\357\340n+\357*\231\022\304\277v\341\261\331"
+	.ascii	"\310p\307,\001\323\215%N\244`\241d\024\2739!_\200oN\306Z\234"
+	.ascii	"\212}\342\355\323\003\177\256\376\273a\322F\372\251\n~\255\013"
+	.ascii	"\320\372\263\376\2270\275\022\225-+\376\311\245c\364\243\367"
+	.ascii	"\330S~\332\333HA\366w\361\240pfI\320\371\330\013\037\366\204"
+	.ascii	"gs\350"
+	.string	"?\3160D,\201!\253\017\232\023Qa\225F\361\025\354\311QZ>\230\306\031[%M$\337\275\312-,\324\275\027\2401+\361\301\345\303\263y\221c\036\215\347\037\3476Xk\022`:\300\254m\024)\260\021aZ\334\253Y\372Nr\314`\246\"\033\242\306\005\377\266\243\305)\365\321f3(oo\n_\343\374\216\346_\234m\301\337w\343\213\001O]A\020\200w\023\177@8t\360\264g\r| \021 `1J\212W\267x\263=Y\003\314\265cT1-5\\;\200\326B\363u\230\201\203\307\204\244k\266\320R0K0l\212\322\242Rf\001\201\035%\332I??\316c\016\270\375d\007\032\276\355\272x(q\001\tJN\276=\262\315\242\3011@\326|?yq\266Q\211WS`\1779\355,\367\365\\\2077D\016\261\260\021\306\b\210eg\265\355c\267\274y?'\020\331<O\034\337\2070L\246\342v"
+	.string	"[\205\200\253\262Htl\034\021!\330\362\0332\366; '3\n\323\026\t\311\342\005\314@'\322\264\256B\354b"
+	.ascii	"\\<u\223S:R\f\264\265\264s&\024\303\225q\266\255\270?t\241\246"
+	.ascii	"Q^\036\210L\314\206OD&\f\031\002\247\351E\346\273o\020\233\207"
+	.ascii	"H\0360\343\300\254SQ\246b\363\016\222\215\367\215\036\217\033"
+	.ascii	"\355\207\344\367\027\202P\001"
+	.text
+	.section	.gnu.lto_gyroFusionUpdate.17.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`\n\017\315J"
+	.ascii	":|p\033A@\242N\007\323\347w9_6\317SKz\311Zp{a\020N\353\307a\207"
+	.ascii	"\240\203h%1\256\r&\376\030\337G\364\033\355\270\372E=\"\231\301"
+	.ascii	"\231\232\243\315\210\034\355\314\252j\275\2447\331{'\231R\252"
+	.ascii	"\001\217\001\246\001\r\233i+\324XPlF\206\005\n\327K\246\255o"
+	.ascii	"\330\331\021Y!\227"
+	.string	"\025/\340\337\225D\254\027L{\030?\247\307\3213\344\017\267\270D\023o\337\033v\366\346\345\301%vq\276n\270\277\374K\343X;\224R\3438\336\353\206\235K\273\227\206\365\372o1&\361\325\r{\313\272\026\317k8\001\203\247o\001\203\n\253\306?\022\314\271\351\340Y\374\356\351x5\240\306\2521\032\204\271D\352b\034W\251\274\355\b\257\267Pl\2566_\234\006\236\273\235\352uO\267\273\341Bq\334\306\327\027\307U\003}\340\365\266\253n\344z\373:\221\353\355\263\033\321\253o\261\027\226\221iY\214\343\330\352\335X\244\245\356W\032j\326\331\252w\322}:\323\022\263\311I)\t\351\310\250\210hH(\b\350g\251\204\223\310\367\350\266\354\347g{\236g r\356\n\365\320\302\234\211z\265\222\227\25683_\361\246'\356\304\006\325\261\007\354\262\222\2224:O\232C\303$#=\361#'n\344\204\205\022l\222\213"
+	.ascii	"=_I\244\322\261\245\3219\321\222\276\265<\024\347BA\254\021a"
+	.ascii	"\222C\002o\031\b\356H\3769R`K\203\363\245\224\205\n\343QR\316"
+	.ascii	"\214de\024[Z\234\303\254\362*G\304\325\234\025a\025\250\355]"
+	.ascii	"\335\0134'\217\024\224\244\021q\244\213\251\371\313\002 Lr\310"
+	.ascii	"\224\006\0069\376\240\221I9\033\222\335hna\264\034\231Us\246"
+	.ascii	"\306B\355y6C\033\313\357^\234\300\334\"\225\221-\215\210\347"
+	.ascii	"#\2058\216;\227\241\245y?yw\026\353n#\335\3124\001c<\332\336"
+	.ascii	"o\363\340Jx\337s\2442WB\3055\201\020^\302'\331!\353\303\374\177"
+	.ascii	"\b\357|\316Ri\223\b&o\013\024hn\314/\036\033\332\261\206\313"
+	.ascii	"\374l\345\356\315X\316#\244\003\217\315\375i{\b\367\337\331>"
+	.ascii	"x\235\020V\212t\260^\254\rJ\251\377Vk\207w\255\037z~G\034\341"
+	.ascii	"\211'\220wr\020\363\007\200\363\306cC#c\177\332`\256\277\327"
+	.ascii	"\235\341X\316\323\335%\034\316\211Vno1\216\307\256\272[\203\033"
+	.ascii	"\242\210\340&\216c\007)\374\r\326Rno.\216\343+7\317\270\254v"
+	.ascii	"&*\\o\375\227\254\261\221\326\331\211\345F\327\201\307\346\343"
+	.ascii	"\177\332]\205f\227B\323\201\327\337\326\235\314-!\302\233\033"
+	.ascii	"\302\003\367\363np\305`\201\017z+P\346N\340k\274\021\034\360"
+	.ascii	"\252{\225\001\267s'\340m\274\247<\320[*\n\352\311\311\377\274"
+	.ascii	"\233\334\352\315\344z\336KL\245$$\337\342}\224\314m\244\314]"
+	.ascii	"\224s\023-s\017-s\013\271\031\357 \307\363\006R\346\376Q\346"
+	.ascii	"^\262\271\225\311\33402w\022\316\215t2\336/\234\373\310\346v"
+	.ascii	"\223\271[dn\366\315\375l\356\314\346\366\tN{\244knf_X\215\177"
+	.ascii	"4\356\211\007[\277'\336\306}\215\373\240{\240;\031w3\356\177"
+	.ascii	"\356~\356Vw=w<\367-\256\354\366k\303\201j\332\3314\274&\006"
+	.string	"\324\332\027\366\246i'\034\214\361\303m\317\306+\330\r\007\266\243\321\313\3532\246\275\214\237\t\335\317*\371\310\223.\202\334u\316[\251\021\004\357l\234\245S\274\322\371\355]\345\206\030)\337\331F\344\"'Z\3056O+\231\b\212\tjXK\3056s\312wA\317O\244L\244uv\257\266w\215R\324\347\036\n\341\310\254C\360\033Ie\002\337\375\254{b\361<\027\201\247\312\2308\366aDB\017\376\ra*gbz8\371p\026\222\374\2477\177C?m\246\177\360\336\347T\212b\204\220\037\304\002\225\221A)\025H\032V\n#oR\252\227\321q\344\037\025\003\241}t\2477\030\364\323\376\306F\267\340\036\337\357\370\260\200\\3f\261\007\217\343\013\200\003:\372\246\272\237\237Zp\273+\344\035\026Z\2711s:\310\220\3201sut,\335\234\003\254\225\003\304\220\307P\\e(\026\034\346/\2139]o\335o\345"
+	.ascii	"\031\355\2322\3207\370\356\f\033\262\227\265\222o\314`\216\017"
+	.ascii	"\353\366F\247\200\267\262\356\306\340}P\\\361\301z\253\3344x"
+	.ascii	"\017\343\002\302\374A\013\365\204\234)\223\314\007J&\375\221"
+	.ascii	"k\201\177\332p\036$;\347N\246\362%\245\fy>\3568\363\315\232E"
+	.ascii	"\"\275\3479\006\267\036d\326\354\207\236\364fKvw\202\354\267"
+	.ascii	"\357\335"
+	.string	"\034\\O\207\267=\3173.\353er\343\261\254Q\245u\036\367\027\347\227l\231\337\317\374f\217L\020nkd\326\367\277Y\226\371Jo\346{>\324\372\2427\373I\237\217\276\350\276\347\3109E'\257;\230\333,\233\364Ho\326]\300\227>\302\273\027\247R\314\273+\334\"E\376\264\335\225\001\355\242\252\271\245%\303\212\253kk\253K\205R\026Vv\267\276B\254h\302[_!d\270h\241\325\004C:\265hd\261\256\226\273p6\2750\324\340\312z\235#\232[Z\"\232*\270\232^M\026M/\240\025M\347\027\213\326m\025U\\]Z\316/\026X]^5ZX9\275\272\234\\M\247\025\227V\326\226\225\n/\247UUTw\301hzY\311\350\352\362\262\202\253b\376m\027\364$2&\212=\224\211i\340\337\260\211\312\247\246\336h\351\247=\365\006\336\355\352\n\243P\300\232\236s\371\t\n\244\354\004\310\257>"
+	.ascii	"\b\342b\035\261\334\370\314\2376}[\273\323\2675\3220\351\300"
+	.ascii	"\277!\021\2257\031\360&\344\235;C!JHQ\377\"=}P\323\037x\007\364"
+	.ascii	"v\355\n\236\250\264\350;31\321V\240\267\366\346s\275\315q\312"
+	.ascii	"\350\274\037\364E\317\242\211\232\031\372\252'z\217Na\275\317"
+	.ascii	"\270B?\364\036\225"
+	.string	"\002}!j\2355_\345\324\372\222~\332K+GW\3107F\251\023\225KA\261\214\321\250#\247\3673\376\356\301\323\307\251\255SOo&\365F.\235\336\t\262H?\355CFD#\006Q\017\365fN\350\310:\214\202F\013\276\331\242\247w\222\372\253w4\336\002R\255\321#\005\037\365\f~\006\025\317\323\377\374\202\3778Q\251\202_\376\317\263|\242R\334b@\240\222\225<\351`\305\353\342\264m\371@\320+\243_\202o\253g\005\357\204N\024'j\006ju\350\216\"\203q\334\023\032\033\021\307\342Xl\n\301'x\253/\321;\320\334x!#\211\221\265\274\305\361\230\203\2019\250q$%\025C\310\314\314\210H\222$\031\016!\005\004!H)3\017\021`)4P\215h\222$\215\001\371r\236\025j(I\020\244^\363Q#\007),\264\326q\251\251t\301\374_~\335#4\b\364\023\246\252\221\275.\244\217\b"
+	.string	"\027\033\345x\313\036\343r\340\216z{ZN\273\313\254w\354U\355\231\333\033\340\361\241\217\241\013\351\216\007O\242ut\362\022\305\220,\032\263\034L\321w\222\222\324\013;\206\"\200\325\266\\F\266\024$oA\t\273\221\366j\241\252\312f'3*\222HI(\315\352\3103\346c8\247o\237\254\n'c:\344\022\347\2753\304\031\255F\323\371\r\211"
+	.ascii	"z\234Z\301p_\364{'\242\270*\033n0>X\242m\201\003\t\300Ei%\353"
+	.ascii	"\031\262dJ\310\210H\236\267@\274\274\366\032\345\312"
+	.string	"L-\207\330t\376\213NX\350MW\262(=j6\264sH\304U6\310\312\261\337\017y\367\321\246o\332\372\360\033\373\257w\315|\257\021\257&b\342\206G\352\360-\025\\\302qR%\021*\024\316\311J\241\026\306(\n+\304W)Z\\\332\215'\326\024\251\263\202\262\366opA\345\302\023A\220=\232\231s\241:\212\353\264\233\345\257QU\200\025w\002L\253\252\364\333\360Kc\361\312\312\351BvJd\006:\201"
+	.ascii	"\237\206\021\0029\210c\315\343c\005\001\205s)\252Y\347\037MD"
+	.ascii	"\364B2k\332NkS\302\340\234/\275\210\025\215\327D\0324F\217Mc"
+	.ascii	"\337\246;\350\370\225\341\f\276\345\3746\b\007\263\226\005\237"
+	.ascii	"\247\252\214r!\022\026\005\025\020\267`\t\253P\300\200S\316X"
+	.ascii	"`\0255\210\233\361\3045,,C\325\017or\t\026\214\247:\331\323~"
+	.ascii	"\031%\030\3403.\213(\266\373\017\267\0361\331\324\210*\026Jk"
+	.ascii	"\277\375\021`}z\203\027\342f\256SW\223\321\370\321\254\362\330"
+	.ascii	"j}bY\244Jf\214\263\240\217\006P\237)m\354\033@\302\327\006P\377"
+	.ascii	"|\303\353\001\244D\357w{1\262\333\364z\362/\373V\350\377,|J3"
+	.ascii	"\313\210\203\220\013\013\252\254\250\354\261\"~\270\t2Ij^\272"
+	.ascii	"\"c\001s\326\334s\b\2205\017\315\3140\263\363\2741\203\322\002"
+	.ascii	"W\301\227y\200P\247\206#\276\351[U\263\004G\241-\255\261\374"
+	.ascii	"\203\276\300\3746\t\321\264\321\037_\210L\005"
+	.text
+	.section	.gnu.lto_gyroFusionHealthyMask.18.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"E\b"
+	.string	"6\220;7Po\322\001 \273$V\2209\343\\\323\355\243,.\267e\252\326\252\367\347\233\261\344\326'\031yq\002T4\277\235\231%\321\026\356G\245\0261\036\3309Ad\223\275S\n,"
+	.string	"*"
+	.string	"+"
+	.string	"\f\234A\257\034$\353\304\2221\342\262[%<\035\364\007\362\037\362\312\244K\031\225B\177"
+	.string	"\016\273\3537*i\334\360\266\021lkl\243\002KJ\275\254J,\361\260\315\331\030\333\357\331\3778\b\367\356\363\201]S\013\311nM\260\302\365\350\372\002\353\361:\201\365h\333\013\001\366v\221\212k\027C\343\243,<W\307\243\377\261\036!\f\350D/e\327\320\203\033\366\253\335]C\223\341\273\377U\002(+\r'\033\331\304\350\326\261\274\311d\023\243[\347aj\236\bI\265I3\016\225\031\006!!7\032\225\231\003\317\t\216&)\346\324$\246\356\r\241\201\b^8\b"
+	.ascii	"2\003\302\260\2268ld\354\3552\312\2441\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_gyroFusionNoiseVariance.19.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"\315\013"
+	.string	"\346\325OA O\225\016#\232A,\177\005(\030\272\374Ph&\262\216"
+	.string	"\025\265\005\200\033\341\2125l\303\241\274\216\020\324J\350\240\273\331"
+	.string	"\214+\302\246\363\t\343=Pty'\032\022\031\355mi\226\354\275wJ\001:"
+	.string	"?"
+	.string	"="
+	.string	"\016#\266}\017\377"
+	.string	"\332$f\210J=\305\n\222\253\305\356\326\312)\332\351\374\206v*9\034|\004\375\273NU\253W\311\004z\204 \330]\307\222\t\303-o\373\303v\002\373\n\002,N\034\230\355^\230\271X\0234\326\3016hKl\313\370\226K\314\311\2164d\200\355\256\305\006d\264\003\b"
+	.string	"\317\242\360\311\212PX \360h_\365\025\370\360s\215\335\223\n\330nh1\200\310i\033\017\231+<D\307\201\332\035\025\210p\020_dw4\340%\241CA\245>\332\251&1bQ^\236\364\"\024gv\b\212r\203\375\271\362d\317h\355\255\237>\374\347Y\177\224\321\207d\004\337\346\301L\217\206\001\267Q\315\231\013\327m_\247\301\202\316\233\340\240~^\367q\232\257r\033fS3\336W/\035\356 h\274\312\351:\257J\302\375\\y\322d%$E\266\315\371\210\255\312\354\007\027\021\026"
+	.string	"o\231\"\023O\302\321\264\004\360\031\3613\226L\314\363\013\031\023\217\200B\210^p (\327p\223-J\317\202\\\206\004|Z"
+	.ascii	"F\bT8\270\373\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_gyroFusionWeight.20.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`\020\005\245\037"
+	.string	"\346\270\306J\220\330Q:\013\340\252\306\222\272+\013zp\274\237\033\252\266\177\271\330\004m\027\313X\243\341\302\234{E\201\031Zos\342\244s\351\002y\224\b"
+	.string	"\200\361\004#\022L\026\240qJ\034\t8\033M=\325\247j\033!\204\220-w\222\001\257"
+	.string	"\247"
+	.string	"\265"
+	.string	"w\227\003\306\326\275\227\001W\350\312\374 \202\356FRp\337\373$6\341\225\371\300\027\321=\270\3429\367Bym\335\033d\300\016\316\223\034</\344Ct\314D\033\374\361\370\0261%$h\356\275\266\002\257\225'\355i\345\311\326\301\3666x.\253\356\247Y\222\266\321\252\343\037\3754/\\\035\305\202\345\033\203\243\311\351\246\265)R\325\270\351)Y\b\276a1\251\2262)\032'g\334\336\364X\330\002\367\336g\275.\365v\265O\032Gm\202'/\031\237b\362\331\232\225\034^~u\003W\230\234j5/\334{\271\272\3505\235egf)f\336\300Lv\267cE\316(\215!\325#s\360\250v\024\363o#\306\024\021n(\346\036\036\263r\315\254\274\363\341\231fV\3261+\347|\311\031\347V?\200\007\377\233\033\371m\314\312\263c\235e\350iV6/<\227]\231,+[\262r\223\225kW~"
+	.ascii	"\235\037V,\204\271\027\306Q\354\202\221\\>\276\344\037\376X\277"
+	.ascii	"\360\226\371\3040-|J\370ZC\243\337\246[\301\310\354x\241\341"
+	.ascii	"I\370Y<;\211\305]\347\021\323y\205\265\224\341<Y\231u\374+\236"
+	.ascii	"1\263\220\211\347\021\023\017\217\213\0131\367^\005'\031\303"
+	.ascii	"\331\365V\334eq\002_\226\247\3316\332g/1/\270\254{\372\300$U"
+	.ascii	"*\311\265F\233\247\353\032\336\323N3\361\265F[\303\223B|R\013"
+	.ascii	"\033`\367\262\205\343\021\314\356^\244\003\264\336i\nZ<3I\365"
+	.ascii	"\350\341_FU\213\371\347T\200>\366\363J/f\234\3620Z_\353\266\312"
+	.ascii	"\2110\r\327\260H\345d;\252\353\335\270(B\004~#\016%\035`|R3v"
+	.ascii	"?\353\b\262\b\253\200\355\033\026\245\272\243\370\347\"\225o"
+	.ascii	"\013-*k\1778\322eW\3250s\320\235\b\02102\263\2127I\005\374\356"
+	.ascii	"\335Q q\256\241\363\336\235\204\223|&\037n;?\036+\312\223\265"
+	.ascii	"Q\240M\277\177\025?>5\375P\021\007\023\"\204\322 #4\227\236\370"
+	.ascii	"\261'\202@\020\245d\311@\r\210ni\256(\204\317\r\207B\310\226"
+	.ascii	"\303\335rDA9\033Q\3723d\003\302\345l\r\f\360\255D\020\316f\342"
+	.ascii	"v\303\331f\301\373\206b\001U1\236L\035\364\306q\254\316x\326"
+	.ascii	"\265\223N[\242]\232:}\236\224\234.\333\254A\312\360\246p:\247"
+	.ascii	"mZ\214FUh\334\002\3643\306b\372\260\237\026/?\234>\361\026\210"
+	.ascii	"\325\320\354(\236\251!{\3164= \252\340\262^bK\236\347\227^\017"
+	.ascii	"\224\211\314\\\017\240\275$\003\036\371\262M\366\225\306\220"
+	.ascii	"\270\303\257\370\234\247m3\fI\032 R=\336\226YG\211\364\002b\250"
+	.ascii	"a4\204\214D\004\231\241@DJ\f\222\034\200\002\0311+\017\021\260"
+	.ascii	"\261cET\230\255\335\357\177\027bd1\264`e rA\301\265\352\f#qx"
+	.ascii	"\251\273K\306S9\247K\256iDu\202\277y\231\261*\236\271\270\234"
+	.ascii	"P\204\034\025\325?\237\322\275\314\224\223\351\331\254O\347i"
+	.ascii	"\004WP=@\360\307\\\247)a\026E\222\370\320\360\346h\266\210:&"
+	.ascii	"\235VC8\346sU\bN\221V\336\220\342\305\256r\320\317H\236\033\206"
+	.ascii	"\374D \006\204 I\355\222\312c\nm\240M#3\362\177\305\350\035\236"
+	.ascii	"s~E\335L\252\370\307\300-\240vR\026\331\312\220\247\346r&\033"
+	.ascii	"\024\036K\226\271\242(\004\222\260T+\031E\210]\234.\230Wb\372"
+	.ascii	"G\034\242\247q\344\273M\021\\\250\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"m\006"
+	.string	"\362\311%+p\255\016\374\237fe\353\344\3701yB\3648\354HoX$\021\300\237\253\377\377\277+\210b\2633F\261\200?\366d\260\033%\231R\273\221\354\215\241\210R}\235\314a\311\021\227\352\252dkd\202W\367\207uk\246"
+	.string	"\355\214\344-\375W\246M\261hO\374 q\304\347\t\376\377]\356\024q\005\263&\323\001yn\200\370\006\350\\\363\306\260\344\274"
+	.string	"\232\233\313\303\005\264\376\307\341X\367_i8\241:C\026\206gtw\253\257\365=\273\276K\022\231\377\377\027>\240\273\313\230\025"
+	.ascii	"B\t\3155\225o.\007j\007@\347\003\271\362K\317 \030.{\240\213"
+	.ascii	";\277KE\f\210UL\340t\242\335!\301\3042\f\016\b\340\006\360\314"
+	.ascii	"\331\233O"
+	.text
+	.section	.gnu.lto_.refs.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2efed84949c0ece3,"e",@progbits
+	.string	"(\265/\375`w\027\335m"
+	.string	"\332\261\f'Q@R\322\031\016\273#.>f\252\353\227\211]\365\272\277w\247\357\375\\\274[ZdS\374/\251\3245\221\244\270?\272\270agV\205@1\004M:\2301\f\255\377\257;H\354fD\214\210\0039n\346\003\266b\367\227\351\277*\304\252\277\335\310\336R\246\003\002_\002r\002d\377z}\355\326l\321lz\335\315,X\335\353w\312\277T\276v[e\325N\330\350\246\342A@\225\333\030\230g\367Zb\005M\262\213\016J\002\322\357\0235u\212\255\352\267\210\372\305R\277T*\316\346PS,\333\277\316\235r2nv#u\267"
+	.ascii	"\\\205\216\307\223\323-\353\371\256\345\370\232\242\326\276A"
+	.ascii	"\313\320\222\3568\3752\25140\250-6"
+	.string	"\307w\247\020+e\303v6\355\033\304\222]\006i\355/\032\344\323\230\025N\177\202\372\335\361\335\354\216\3574\324ts|\373d\241l\230\212=\373\226\255\223\367\220k\257|5\346\007/N\037\202\372U\341C\363\362V\205\357\033\2508\253\343\343\315\361\245\220\241\266X\035\337\372\260`\033\206b\201@\217Jnj\360\212\340\211\341\364\021\250\337\037nb\255a\234\204\372E\341\333\274E\341\273\215\032CU\277\202\255\216\357\337$\377\032Y\256\355B\223L\315\006\353^G\374\214\240U\201q\272]\274Hv\375v\355\221\273\200q\032\244\346\352^\267+\355F\356\036`\263{@\357L\b\322\313\227\236\325\257\253\343S7\307\347\001\013\321\201\242\371\331\006\337\3173,\214\247U@\307\326\330\034K\"\001\025\314\374\337\345\277\034\016\247\177Y0\267iy\203\351\177\002*\266\304\277K\337\371y\b\200\377~\376\371\317e\223\317s\240\364"
+	.string	"~\356\340\377\023\314\177-\377\267\320\375\367\362\005\204\233\370Y\351_\234\377u\237\373\277\2664\377\376\366\346\337\022^\370\267fYp\341\003\374\254\302\277-\374+\374\227\306\277\"\374\353\301\277\034\374+\343_\n\376u\340_\237\177y\376]\361o\212\177Q\374\253\363/"
+	.string	"\377\305\374\327\340_\023\377\317\376s\360\037\210\377'\220\374k\300\277\005\374{\342\337\001\376%\361o"
+	.ascii	"\377\346\374\317\340?\336\3771\377\357\376\257\377U\374O\373"
+	.ascii	"?\223\227\227\227\367\243u?\352\342\037!A\215\276\260\352\036"
+	.ascii	"2D\235J\204\f)\303S\364\267\272\217#z\355\246\344\027\3251\271"
+	.ascii	"d\2159bm\032\004\350/\253N\256T\314\264\331\334ko#Q1MH\256\315"
+	.ascii	"\246\344\332<\3424R\363\330\2752q\222`\310\343&\277\250\230\311"
+	.ascii	"\257&sD#\365\261\277\2204\250HMfR\255\311\304I~!\231I$*\346\b"
+	.ascii	"\034\206\270\202[\372B\245\266N\222H}C9\205l\302q&\327f\277u"
+	.ascii	"/XR7!\320=\325lzCBm\331\221\363\306\221\030\262\271kw\017\240"
+	.ascii	"<\252j6\2223\231\325\354\316:\022j\345\213\343\352l\033\326y"
+	.ascii	"\264\232j\246\244n\002\224\335\307mgw\037\273\373\3274\265vK"
+	.ascii	"\341$\261\224\312\356\250\022\312\236::I\352f0\2702f\362\253"
+	.ascii	"\252\331\343\204\311\027V+\255\307\305\3527\252&\365\353\230"
+	.ascii	"\244\231\272{\273\250XL\034\\8\265\361i\335\240\344\204\323\225"
+	.ascii	"k\271\274j\366\340\261E\256\210D\331\264\273%\330\fS3;t\324h"
+	.ascii	"\022v2\226!U\322L\202C\003W\327\004\254\212\324\016\237R\217"
+	.ascii	"\257*\234\356\340(1\325\206\2271v\234n\257\016\324S\017\007\264"
+	.ascii	"e\035\247bV\231#xQ\266\350`\373!Q\356Hr\016\306!b\211$\307\031"
+	.ascii	"\247N<0\253|\230\251\347f\302\343%\037\235l\235`\213\245u7\307"
+	.ascii	"7\270\211\225\033\306K\266q^\342\030x\311\3101\274\344\032\234"
+	.ascii	"$\022\263bE\211\025+\320\260\346\333\327Lzf\242\346\254[E\324"
+	.ascii	"s\362\347##\355\335L\f^M+N9\251\347\254\344\300\225U\017\234"
+	.ascii	"\242\254\203\232\323\fD=O\251\214\2659\276\235\325\311Cq\263"
+	.ascii	">)\255\360v\302\264\035mq\372\357\230\273\032)'J\037\234\212"
+	.ascii	")\321Kbb\032\343\364lC\365\262a\026\314\326\355\226}\256\334"
+	.ascii	"vY\272\345\262s\373e\303\326n\341\276Y6\356\351\332\215\304\365"
+	.ascii	"%\267\344\361\364\212\262j\353\004\253\200\013nn\t\023-=X\226"
+	.ascii	"\315\006i\355\243\217\332\222\307S\211\226\355\2629\256\275t"
+	.ascii	"\261e\311\343\331\304\005\214\265\333\261\025[g\224\003=\304"
+	.ascii	"\3151`\345\215\353\33767*XC\\Y6\033\231nd\025\254\356\356Y\273"
+	.ascii	"}[\266u\202\245ZS\346\272\373\033YZ\230\3508\345(\267\347\217"
+	.ascii	":\224J\025\033\035s\331\260\247q\227\25776fJ?\244\t\241\036\206"
+	.ascii	"}\232\217\267\234\247\230\361\360A\225\026\326&\003\226\031\226"
+	.ascii	"\037\013\307\255\222^\236\330\241\263\250=\273\243vj\236\034"
+	.ascii	"Y\013\223\345\034G\303\333\216\037\2342\334\311\306\222\274]"
+	.ascii	"\001Y;_Yc\267\336U\367Q\213\365\350m&\314\0220\267\266\263\333"
+	.ascii	"\317\234\232_\275s\263\304\344\313\021\247<\004\263\365t\250"
+	.ascii	"\034\345L%\n;yn\327\216j\036\351b<y\272I=;9\265\323\273\222\202"
+	.ascii	"DG\225\263\223\314\0078+O\310v\207\261\"a\234\262\332y\312/\363"
+	.ascii	"s\273\222\246d\212\312R\316i\277LO\006\034Y\262\242\b\001D\215"
+	.ascii	"\n\0273\365\251\030\032\032C\221\201\323GnwXB\035\314\2020RV"
+	.ascii	"\306Pd\036p\223\233\263\261\313\301j\314\2233\224:+@\3608e3."
+	.ascii	"\242\2059Y\261\031\262\036\275CZ\025\026\306c2|?\260H\325=!h"
+	.ascii	"{\222kr\036[\261T\b\017\272\246\030\315\222K\253K\f\210\231#"
+	.ascii	"@\300\232\253\315\222\033U\022\247O\225K\2260\230\333\222T\335"
+	.ascii	"\326\252E\305U\371p\006\223\233\3311\325\264\205Sf\302Y)^\\\022"
+	.ascii	"0cj\016h6\264\356\220\034\t{\251k/\227Mib\314\0252%g\257\037"
+	.ascii	"\263\006'\030N9\tg\315\224\345\3059q\312\353\212\311Py\351B\343"
+	.ascii	"\224\273x\006\237\235WW^\226\255-\346\212\313\"U\367\354\250"
+	.ascii	"\250\235_\034\224T\017#g.\237\027.&K8\345\036j\2604\307\3108"
+	.ascii	"\345\"+\206.\313\304d-Z\027\221\250\032\324r\310\201\265|(w8"
+	.ascii	"k\311-\222\356\210\222\263x8\202\252\312\"BS\007U\203\232\323"
+	.ascii	"\315\225\265\206\322\201m "
+	.string	"]M\325hr\303\r<\204\261~>xi\231\303\341<\204\354F\212\323\n\034\247,\344c7K\037N:~\226\352pbd\n\227z\246\342\252\263\325\2558\310F5\312&&U\267\325QM;\034\344r4\335\\\335}\"\325\022\002\207\022\247\354\203\201p\322\230\234\033\220\0376OfmC\214\fTX\231\030\247\347\032\026\216&\312\330\023\n\247\367\262j\377e~\316\202<9=\272\244\236\177_#\233\272\333\251\267v\323\021\315\267\267\273\363\327,\272\b\374O\003\306a\020\275\020\213\001\214?\"\210\206\202d.\304\202\3060Xd,\222\020\n\215\206C\342\360g\374\001\256\020,\372\214\300\342\020p\310w!\0263x\206\304\241!b\220\211\"\240Q\030\264\240\307HT\023DD$\372\031\006\215\302\240\321\b??E\241\020(H\310\b4\304S4\006G\3401\032\322X \005\243aP\270\300\013\237\037\237\030)\360"
+	.ascii	"I0\022\006\r\203<EE#\036\036\024\210EBF\342\3607\003\b(L\215"
+	.ascii	"\305!1\2507\303XdB\261g\024\242\021"
+	.string	"\004~\240\201"
+	.string	"2t\200F \022\210:\330"
+	.string	"\307\030\034b"
+	.string	"4\022=\260\031\002\005I"
+	.string	"f\200\363 \tn\036\024,\002\016\2014\324\277\360Y\300'F\n\277\307h\240E\003-|\217\321@OO\003>=\352}zP#\020Q8\243g,\241\b\224\201\210\342\017M\3217\f\002] #\302x\241\003N$\002\026\361\030\211\304\"\036\021*\b\031\205@@\241_\361g\003\013"
+	.string	"\360\251@F!\260\202\032`\320\020(X\004\344\001\260\030$\016kH"
+	.ascii	"\016i\004\205@?\240\220h\b\250Hc\3741\252\305\016\200CA\016\212"
+	.ascii	"F\304\340\t\300\"\"\033\343\217O\217\n\024\002\031\2133\306\241"
+	.ascii	"\021\221\002\243\320\bh\306\214\361'\206q\0304\372\275\247\207"
+	.ascii	"\202\024\035hp\201\032\304bH\f\026\215f\374\020\213T\240\301"
+	.ascii	"S,\"\026\207\300\"\3170\b4\304\023TT\344a\221B\205\"\242\261"
+	.ascii	"\030\024\372\t\025\201E3zB\"q\202\237\336\371\251'6\326u\204"
+	.ascii	"\322\272)b\027$\314S\020\231\270\271\250.\234r\235\335 \343:"
+	.ascii	",Cl"
+	.string	"\300\341\234\371!\217.\016u\032\222\345\024\003\020Ny\352\327\325\244cjE\227\260\306pA\227nF/mM8E\225/\232\335H\224\t\275qT\371\025U\336\334\335\354\036\300D\304p\340\371\226V\033*nmoC\324\365G\245E\345\304)\332h\243J2G\233,N.R\236\035\225c\347G\221G\225\320$\270\037gR8E\217P\244\r\373\031Z\343&\b/=\3128\275\317\206\232\302\357g>\364\270j\350\032\236\0200\275\274<\216#\202\334\312\303\273sv\345\331\300\251\334yN\216\357\3206\232>*\351\345\217,\312\026\254g'\243vD$\211!\211\0250\347\273\263\030\0270\256E\335\322jCr\312v\267\211\232b6\367\3440D||\361\340T\277\200\222'&\223S\376r-\034\201\376\250\321,f\234C\"2\"\"\222$I:\021\005\204\030%1\245\035\021 \255s\312\024\211$IR\332:\341"
+	.string	"\020\341\314<Xj\027\200\244#\rw\037\b\377\260\361\220\224X\032\317<\006\022j\222S>z\352z\bM2\344mt\217\022[\f\212\264\244\255\271\360\304u\237\347\331\274l\344\346\207+\3632\246\311\345\367'\f}/U\215\345\221\361k\fw\371/\302\235^v\312\030z-\b\\\007\346\355\225H;\210\022Y\277W\330\3644\034i:\277\031"
+	.ascii	"\030\373\247\322\352\023\250\213\273\001\214\3637\323\b\372i"
+	.ascii	"\224\356\030\341\312\261\317\333j\304\243`GQ\245\024^\243Ni\362"
+	.ascii	"\307\237\242G|\340\241`\2106:\272\272\312g\037\341E\244\235\304"
+	.ascii	"&\327V\263U\227\367\003\367\270#7UAa\362\0349}\217\3578X\355"
+	.ascii	">8\037\333!h\235\370:\363\206;K\314\314\026=\220\020\210\223"
+	.ascii	"Jl\020}[)\316%\243Bj\273\340\310\335\026#E J\024\243\fs\212d"
+	.ascii	"p\252\rX\356ig\317\350:Jh(Q\026)\327\334I\266 \032\202\361\201"
+	.ascii	"R\360\255h.4\321i\303\247\213x\024L\334\374\302s\036\217\b 9"
+	.ascii	"[7\030\357\212Z\344\025\371+\277\037\252D\211\332>'\234\r\036"
+	.ascii	"P\225,ALo\222\223\2478T\365 Q\377R\211\002\3247j\264\376t\305"
+	.ascii	"\007\213j\030\212\203\305\302\t\215x\263\315-\312\330d\022x\027"
+	.ascii	"6\347\2320\fX\032\007\005\210\002\253\277\200u\211\373\220\001"
+	.ascii	"aN\261\353>\356bV\305\332\215M\223}\t\r\270\307\366\200,\225"
+	.ascii	"\036\303J\321$\370\002\256V\342L;\004Uj\016g\317AhA\013\300r"
+	.ascii	"\034\336H\013y\003\253jEn"
+	.string	"\r\260A\"W\324\235\230\3527\272\263\202\265\260\237&'\235\006\003a:\340\354\324C\305\353\033\350\037\303 )j\234\245\212\316W}\2301I\017\244\206{\240-l\346K0\204\2602\311/\303\355$\356\222\233\224\2648\214&\002S-\371\251\261e>\177R.H\324]\376\367*\251+\340\356\307}\214T\354\216B\224\300\321\357\212\202J\377^\342\227\251L\363\251tY\377\272j\2378\b\027\035\223\327\022\351\232\020\337\301\b\327(hJ\252\336\330\023\222\350\200\273\344\024o4\346\r\345\271\241\223\320d\357\265\251\226VR\223\200-P\t\326\311\024\354\320\273\323\271\374\"I\001\360j\327d\013\320\312\254Um^\265\0175\221-\0242\272\265\351\r\312P\360.\256\3447`\362\246\032l\310\022?\177H\225\341\257\t\\\177|\331\332\340#\303%\204\240\306}y\215\366V\306\270\030\211\260\323\022\b\b\\\342\235H>\301\036"
+	.ascii	"d\200c\346\207\024o\t\277\004\035\325\347\200\364\325\230\233"
+	.ascii	"\200,;lg|\033\021\037\003\241\310\277\273?\302k>u\257\307\354"
+	.ascii	"\264\235\237b\250\324\303NMh\032\357v\007\260\206\274`\034\353"
+	.ascii	"j\\X'\277\336\235\347\021\252\317\347\275o\276NM\021n7\316\304"
+	.ascii	"-\3760\317c\230\216\372>\251\037\301\276\204\336\363\270Rz\206"
+	.ascii	"\367B\377+\372\344mj\341\227\002\217+\317\362F\347z\\\265}\210"
+	.ascii	"O\353\306\005\237\332w\225\365f?f\371\035\302\027j\304]YN]+\363"
+	.ascii	"\305\237\355\257O\030^\023\374\317\361E\371\001b\264\373\216"
+	.ascii	"\314\206k\354\272\177\302\2073g\234\337\322\357\360\006\244\327"
+	.ascii	"\016?8\007\336\217\207xw\007\231\357m\222\311u\337}\207\243\341"
+	.ascii	"\234\316\2639\324S\2019\353\r\037\016}\024\356F\232\217\237i"
+	.ascii	"\237aV\375\311\263\217\247\334S\207}\353-\243\031?\363m\271Y"
+	.ascii	"\375\344\270\305\337\325\013\365\317\202o\034l&\376\004\374\343"
+	.ascii	"\214\261\301G&wB\337\227\377x\371F\227\335\nF\005\223\243j\276"
+	.ascii	"\311U\001"
+	.text
+	.section	.gnu.lto_.symtab.2efed84949c0ece3,"e",@progbits
+	.string	"gyroFusionInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"gyroFusionSample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"gyroFusionUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"gyroFusionHealthyMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"gyroFusionNoiseVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"gyroFusionWeight"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2efed84949c0ece3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
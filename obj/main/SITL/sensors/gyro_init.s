@@ -0,0 +1,1518 @@
+	.file	"gyro_init.c"
+	.section	.gnu.lto_.profile.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\020"
+	.text
+	.section	.gnu.lto_.icf.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\225\001\325\n"
+	.string	"\302M570\221\322\030\350\332\251nP[\234\036+\3178M\205\205O\261\377LW\321\177\305A\007\316\206=\241\244\240\240\240\240\240\240\300\200N\357[\373\311&$\226H\262\311\336i\357\020b,.\025\037\301\336\321\370\201\272\020\rlL\351\264 \260\364\260\031I\005\314MEZ\275\204\326&$PL"
+	.ascii	"[\"\203\001\003\212\357\211w\235g<[zKY\257\323\240B\250R5\037"
+	.ascii	"HY-\032\222g\263\275{\347\336\227s\233\363|\327\n\264\020\023"
+	.ascii	"\013\325\221Zh3y!(xS\256Z\0077u\317\236ki\270\031u\260\246h\270"
+	.ascii	",\270\035\344T:\3310\327\214\003\t'\016\343t\352%\250|\"\213"
+	.ascii	"M'E\306F\304\224\307\271\374?\330\303K4:\016\277rt0\254@\020"
+	.ascii	"\374\013B\250\3415\261@\306\002\303Ba3\200\202RT\324\r\021\200"
+	.ascii	"5q\220-te3\030\002:\035\223+\242\315\312\346\220\254\016\201"
+	.ascii	"\030\006\226\353\001\b\362%\232c\306\300\0177=|(\377l\265G\372"
+	.ascii	"\204\333\034\355b\314\204\233\217\245\241\316Nj\364\310\370\245"
+	.ascii	"\354\211A\262\307\342\037aZ\360\254\203a\205\320\321)t\203Sv"
+	.ascii	"\304\233\261\323'\"C\312\237<\\\n\347\301\034c\377<+\025O\267"
+	.ascii	"\204\020-\351\251\236"
+	.text
+	.section	.gnu.lto_.ipa_sra.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\005\004"
+	.string	"\202E\017\026\2207\351\377\377\377\377\177\025$\254U\020\273\27355\006\007\221;\245\226\376.\303N\2630\t\373\203)p\002vQI\026\321:\216\242\303?\302\343\310(\352\270\353v\323\230\255Y\006<\005\034"
+	.string	"-\002C\30653Xf \020\nRV\020\327D\b\242\251K*\004\251\266v6\200\205\212 X\216\241+\353\210b&\006\225\230\026t\n\036|\300\305\360\305\302T\315"
+	.ascii	"w\200n@&\005\030\002"
+	.text
+	.section	.gnu.lto_.inline.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\033\005U\024"
+	.string	"F\233W@\020o\224t\205"
+	.string	"\346H\205U@m\223RF\345\266C!\n\221\030\024\024Uzy\2043\2323"
+	.string	"\357\027\370\257\310\201\np\013@\n*\322\245F6`\016\274\036z|\030\320S6\202\206\310\226;\005?"
+	.string	"B"
+	.string	"K"
+	.string	"\337q\272\277\021\307\351\251\3779\2508\235P\t\021\376\216\347\270NOg\306\022\252\310\314\240`\006\322+\023\205\240\177\244\232d\202tn\357\250z\022\226df\353\375\234\336\375J\315\314\f\360\234+M\035!tE*\365\302\300\226\307\260^\303\255\013\017\303\376\262\024ah>\370\320n\241+\311[\210\335n\036=\0319!\351\3552o\243\026\312\033\251B\365\201|\324\f\251\236Bf\242\376\242\321\303\277\323\373.\fpO\357p4u\301\233\323T\275\334FSh>*g"
+	.string	"\274\b\321\322\373,c\266\256\303\350\210u\016),6\\ng*\r\377\017\213\t-df\2021.\240\020P\310\326U\371\323TlQQ\220\020\341\201\325\204\213\026&\036\fo][\327\346\032T\237\236\306\253"
+	.ascii	"C\351\240d&\346\r\002X\225\200\230\007\377\017\226P\031\017\020"
+	.ascii	"\025\377\264(R\275\251\035.\234\030)\210>\232PC\210\022)G\262"
+	.ascii	"\200\021\236\261a\326\305\256G\017D\343K\025I\245R\034\254w\001"
+	.ascii	"\200\213\250aIS32R\330\032-\006`\002\031**\363\022\340\0255\t"
+	.ascii	"k&3\"\244\244\240\244P\253\275\003B`\210\255]\210]ep\262\302"
+	.ascii	"OI`}\013\363p<\024\025\231x^\311\256\244\201e\330vG\355\247T"
+	.ascii	"\375\321(\027jR+6v\300\221\035\221Q:\334\257\205\232K\237\255"
+	.ascii	"\377\001b\200^A\025P+\246r\236D\033?j\2360\322`m\2628<\036-\246"
+	.ascii	"\037!\005\216;\302X\212\217\213\317z\265\236\2437\334\251\033"
+	.ascii	"\234\322\2045\033'\221S\374+C\223\363\370\331\004J\374/\276\321"
+	.ascii	"\016\246\217\304\236\237\271\326Nr\320D\354D\372\355\354\206"
+	.ascii	"b\367\317\207BF\342\214\204\345\274\235\271\031\240\327\255k"
+	.ascii	"\306\202\3560\342`\363l\367\307\251\277\305z$\242k!\251\310z"
+	.ascii	"\355I\263($\320A\335\266M\231\227\367G'\226\211\214\030\220\300"
+	.ascii	"o\216/\026\211S\t\350\302-Y\021\240\376$\305\030\204\272\tq\344"
+	.ascii	"\2077r\346\\e\313\204\347:\342z<BY\201\205`\243>\250c\331V\365"
+	.ascii	"\253\037\242\232\200\205v\226\244M\220\007"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\224\005\245\016"
+	.string	"\346\222;2Po\322\00103\263\020\371\326iN\206<\002Q0%f\226db\314\315\314\332&\037cLGm\346l\226o_\020\370\330\0247L#w\233\311\235R\n("
+	.string	"0"
+	.string	"-"
+	.string	"\03616\363\336{f\211m/\302t\250\331\241v7\217W\215\227\333V\360\2346O?\333Fl?=\247g\306~\2476\214\267\0030D\004G\276\234%V\232p8nKk\203\345\320\212\265\371\340\312>>\305!\254\210V\f\333\013\211\245\262\367,\302\326\226h\257\220\034z\344-\301\257\20528l{\271p\365\303d8'=\335\300\211;\276\363sWZ\307\343\273fZ\201\272K\257{2\373\0307\361\023\355\327\334\001\255\237\251'\245\360MB\213\320\036\2242h)\026\225\217S,R#7\nb\036\243$GAmvX\351\321\312"
+	.string	"\f\313\336\377a%H+\326ZM]\250\241\275BT\222$%\225BcP\002\021\024R5\017\022"
+	.string	"\002)\004B\301\222\202\n\021\204\004\"U\022I@A\212\212r\f\027\016B\341\244ut\"\0244\301CC\355J\214\2130Tc\321"
+	.string	"\2412o&\362\235\030,\301\270n+\3123\b[\200\227\3670\361!D\231\021f\305o"
+	.string	"CA\231\030\300\221jR_}8\b\365Je\246\003\241\341\242\304\3274q\210l+\023\243Q\367{\001\370\236\225\303\262Z\315WH\001zGT\353\200"
+	.ascii	"\273F\360\272\023\366k\213\3436s\005a\226\227\271\035\242?6M"
+	.ascii	"\355\005\3054\345\277J\270\363v\314\230\326\207\326\247\211\243"
+	.ascii	"\2604.\204\211L\2603\350\307\252S\020\317\336\303\207'\031\n"
+	.ascii	"&[\375.j\226\325\274jXm\3552+\317\013@\362\236\242\277R\212\362"
+	.ascii	"\334'"
+	.text
+	.section	.gnu.lto_.pureconst.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\204\004\002\230\004\004\232\004\b\230\004\n\230\004\013\230"
+	.ascii	"\004\f\230\004\r\232\004\016\230\004\017\230\004\020\232\004"
+	.ascii	"\021\200\004\022\231\004\027\204\004\030\230\004\032\204\004"
+	.ascii	"\033\204\004\034\205\004\035\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\375\007"
+	.ascii	"\242\n\"*pI\223\016\034\367q\3779\321\257\343UU\261\377\377\377"
+	.ascii	"\377\217#\f\321\332\223CS@\023\365\026\221\r\215>\371m\377\333"
+	.ascii	"/e\n\237Tt\001*g:\233\226\n\t\217\360\313\301G\224\006/\306Z"
+	.ascii	"J[z\247&\346\353\024\305\353\b\246\371\235\222\230\367\247\b"
+	.ascii	"c\016\t\242\2145\"\250\267[\333C\221\231\256{&wX\254\247\312"
+	.ascii	"\0023\246\2449o(g\312\0330\300?\3249\345\016B\206\262\005\345"
+	.ascii	"M\371'-\211\372\300\234\0025 `\002\031e\345\001f!$\215\361\312"
+	.ascii	"]8\354\346\003\250\3448\267\027.w\304\222\201g\303Y\303\323\002"
+	.ascii	"\333\3408\206\305\001\256\200~\334\374i\267\177\b6nf\331]\005"
+	.ascii	"\261l\257\200\033\027!\311I`\3601\233`\335\302\035\253\354\316"
+	.ascii	",\336!\341\320\004_\310\3221F\003\232\346\013\336\316r\347\265"
+	.ascii	"jD~a\273\005\323,\224\335ea\321\344\272\177x\025`\b"
+	.text
+	.section	.gnu.lto_.lto.7f4ec07e4795bed6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_calculateNyquistAdjustedNotchHz.39.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\214\001\375\017"
+	.string	"6\336kE"
+	.string	"\261&\035@:\364K\376\375\214\254\342\321g\335\362#%\304H\n\315g\031\002\334\331.\004U)\3317\346Mql#\210\031\275\026\253-ZY\023\001\214\326~\020\214l"
+	.string	"\"\343h*\376\241n\204\220\275\245L)U"
+	.string	"S"
+	.string	"Y"
+	.string	"?/v?\004.\321\036m\3738W\301\342T~#d>B\240`\275v\354~\233\310\007`\217\371\021\354QE<\365\b5S~\002\032\037\230\226\352\361\243\345\341\020\244\345\222\032\322\332"
+	.string	"Iv\367\257gLk\225\231-\330]'L\253\303\215\335v\004\333\022\354\363\004\252\324\033\373p\325\306\016\375\373\265\273\376\354;\256\033\302\264\302t\302\364?2\0205\b\304\330\345\020\324c{\"\214\022\337\371m\026\377e\020\347\\\207\345;(M%\243\271X\341\344\330\375\016<\272\201\366H\002?\202}\251\024Y\227\025\215I\346])\307\335\232-\272\212z\023\322\t3:X@\207\252\235\216\fMU5\314\340`\001\345\356\252To\214i\252\005\035\032.\371\343LS!\314\370\260\200\256\005rj\316a\230\246\215\227\024+\247\274\005\247\355\256\211\277\342,T|\022\217\366Ny\230G\377\204=^\003\360\314\340\341j\311 \373\013&\217tRA=@\211J\243\223\312\250s `\345\004\005\2053\235\030"
+	.string	"X9\301 2q\245\314\242\022\023\251D\242\300u\250\013\233\327q^i\344m%R\205\224M\324y[\211\001s\031F\335f\342\270n\003\371\366p\325\306\n^\324Oa\177=d\342\304\r\030R\303\314\024j\214m\250!\254\017=\001\036"
+	.ascii	"F\305\251\325\301\2051\215\004b\213\314\326)\241-<\263\230%\200"
+	.ascii	"j\246\366\264A\207\317\202!B\324\220*l\327D\225\025\331M|gP<"
+	.ascii	"\371\207Y\215\033d\350\374j\005\020\031 \003\3126\342gF\230\215"
+	.ascii	"W%\350\232\247\267\253\224\001"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch1.40.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`8\003\335\027"
+	.string	"\206\256\236E\260\032Q:\270\321\357s\017N vX\260\235\360\241\222\367\374\303\032\246\226\315\336\247\361\254\347)zm\250>\bYx4\2406A\213y\206<o\f\217\274\211\321\334@\271\220\363\330\222\373rYC\204\220\275\245L2\206"
+	.string	"\202"
+	.string	"\214"
+	.string	"\362)U\235\234\237\360SwU\357\344Od\317\335\320\331=\344\013\226n\335\003\365\t?U\037\360}\356\005|\237*SEs\035R\203D\256\330\226\334tw\213\217(_\352\256se\377\246\344\225\351A\013IG`df\274\315\376IUw\357\334j\022Bw\277\t\307N&@.#\030\355\306\033\220\263d\300\313\302\346M\337\035\267\232\034\300C\311\370\244o\321\215\266\013Z\350n\335\361\346\343\n^UGU\375\240\312\"\002S]\210\373\361S/~\2376pW\306 D\333S\325\315\226\217T\3174^N\207r\021U\326\227\256=\317]W\317\375\252\353~\2363]Q\340\252\316\267\032\316Up\256~ru\312U)WyWwWO"
+	.string	"\354R\246\300\256\233G/N\223\231Z\226\234\351_\272\352w\372&M1)\227p\326#\234\242\364\324!<\024\275\024M}\352\225\036E\366%\032\341\254\007\253\210\310\030^w7\370T\f\341\347\201\374\246'\310\242\346M\216h{\314\335=\223\254\375\030d\325\021$\366c\317\212A~\215\367\261\r\\\257\306+ab\202\323kg\313\245|\376\300\265yw7\363\221\312\370&\243P:\203c\341\250d\346\311\273\306&\344X\316\303\222\245\034\233\023\3557\276\0253\207\300\245\2619\321\266\247\253=/\253\236"
+	.string	"\332\217+>\220\203g\252\342\345\333\346\360\360\271\002n\214m\216+H\001R7\321GU\025\267\362\002\360\324\335?z*\257\322B\237\344\001\261\327\f \t\342\253\261!E\nq(\306\205"
+	.ascii	"56\254p\r\211B\240\272|\206^B\257\023\"\214\206\212V\f&\306\204"
+	.ascii	"\202b-\241\027\220\213\226\013\026k\371\030P\361E\020\2545$\212"
+	.ascii	"\260VJ\327\347\"I\017w^\310\0201\355\343#M!\221,\236H\270\301"
+	.ascii	"Q\\\364\340(^#\227\323\301Q\314\34271\332\325\214\f\354\177\341"
+	.ascii	"\353\341\220A\326a\325\f\032\366\243\312\026\3023\325\213\201"
+	.ascii	"\261\243,\036\206\203\004\244\356\246\320\341`<,x\352\356\237"
+	.ascii	"\317/:\374{\001\021v\t\0037 \240\002\031\262\232\007!rj>(\263"
+	.ascii	"\3709\206Y\307\231\317.\254z\354\363\262\017Z\302\005Iaa\374"
+	.ascii	"/\300\026\t\237\241\310\202\253\"\007J\n\360X\240\020W]\024Y"
+	.ascii	"A+\324\3038\346\035\354\231\342\306^\232\331\341\t%d\003\226"
+	.ascii	"\006\304\n\022\223\272\241mn\004\024\213E\b\354y\033\344\234"
+	.ascii	"\260{\2348\274w\322\032\253\n\207\221\217[\300\224\352^~\b\360"
+	.ascii	"\262v\033YgC\231\325U\241"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch2.41.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`8\003\325\027"
+	.string	"\206n\236D\260\334(\0350\213\203q\256?\325t*\321\200T\b\250G\316g\234E\251\357w\005WL\001\320J\213\365\220\256\373l\222\225\207\016\266M\330\372\360\020\036\246\021V\2303(\334\331h\264I\335\r\021B\366\2262\311\206"
+	.string	"\203"
+	.string	"\214"
+	.ascii	"\362(\325]\035\240\360SwU\037\345Rf\327\335\320\331]d\314\226"
+	.ascii	"\356\335\003\375\t?S\037\360}\356\005|\237:Sm\363\235Q\203F\332"
+	.ascii	"\334\222\344t7\213\223(_\356\256sg\377\246\344\235\351A\013G"
+	.ascii	"G`tf\304\321\376\311Tw\363\340l\022Bw\177\t\307N'@.#\344z#\016"
+	.ascii	"\310Y2\340q\201\363\245\357\016\234M\016\340\301d\374\321\227"
+	.ascii	"\bW\333\005-t\267\356\210\363q\005\257\252\243\252~Pe\021\001"
+	.ascii	"S]\210\373\361S/~\2376rV\306 C\333S\335\321\226\213T\3175\236"
+	.ascii	"N\207\362\021\325\325\223\256>\327]U\327\375\251\357\376\236"
+	.ascii	"+]O\340\352\316\267\032\316Up\256~ru\312U)WyWwWO\340\024$M\201"
+	.ascii	"^7\217\036\235F3\2734\271\322\237t\325[\321/)JI\277\204\264\036"
+	.ascii	"\341\025\244^\207\360S\364U\024\365\251G:\225\331\223h\204\264"
+	.ascii	"\036+\"#M\274\356n\360\251\030\302\317\003\001\374\245'\350B"
+	.ascii	"\005\212nh{\314\335M\223\253\375\030d\325\021$\366\243\217\212"
+	.ascii	"A\276\215\367\261\215\\\034\033\257\204\211\tL.\036/\257\362"
+	.ascii	"\371#\347\346\335\335\314E*\343\233\214\002\211\r\216\235\243"
+	.ascii	"\222\231'\357\233\333\220oy\017K\226unL\265\337\370T\314\034"
+	.ascii	"\"\247\346\306T\333\236\252\366\274\254z\"h?\252\370@\016\246"
+	.ascii	"i\212\227\177k\352\341s\205\034\230[SKH\201Q\367\320GU\025\327"
+	.ascii	"\342\002\260\246\273\201\364X\236\245\205~\311\0031\327\214 "
+	.ascii	"\t\342\253\261!E\nQ\026\343B\200\032\033V\264d\342\013\324\326"
+	.ascii	"\217\314\365r\235\020a4T\260b01\366\022\212\261^\256 \027\254"
+	.ascii	"\026,\306\3721\240\342\013!\030K&\2120\026j\327\347#G\017\257"
+	.ascii	"\bA3\304\265\217\213\024\245D\256x*\341\006?1\321\203\237x\221"
+	.ascii	"\\N\007?\361\212\377$\327\263\0211\260\377\205\317\207C\006y"
+	.ascii	"\207U3h\330\217*{\b\323To\006\006\217\262x\031\016\022\214\272"
+	.ascii	"\233B\207\223\361\260`Mw\003}\216\331\341_\f\2100L\0307 \240"
+	.ascii	"\002\031\262\232\007!rj>(\263\3709\206Y\307\231\317.\254z\354"
+	.ascii	"\363\262\017Z\302\005Iaa\374/\300\026\t\237\241\310\202\253\""
+	.ascii	"\007J\n\360X\240\020W]\024YA+\324\3038\346\035\354\231\342\306"
+	.ascii	"^\232\331\341\t%d\003\226\006\304\n\022\223\272\241mn\004\024"
+	.ascii	"\213E\b\354y\033\344\234\260{\2348\274w\322\032\253\n\207\221"
+	.ascii	"\217[\300\224\352^~\b\360\262v\033YgC\231\325U\241"
+	.text
+	.section	.gnu.lto_gyroInitLowpassFilterLpf.42.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`1\b%."
+	.string	"\272Q\f\022F`\\N:\377F\345\371\020\314@\374\252\342\361=\0039F\346\224m<*\377U\017m\311\213\013\244b\255\332\367\236i\232\263 G\377\302\365\342\241\221>\374e\034\177xj\225\177\3128\261\265\255m#\204\020\262w\222\001\f\001\366"
+	.ascii	"\025\001\017\260\266!\333*\256\026\f\326]^\316O\025lRC\313b\336"
+	.ascii	"\302\212\363d\304\232\324\320\362\231\233\244pR\347\334\3139"
+	.ascii	"?\270\332\037\332\324K\216\264\230\227H\3100ly\032\325\271L\335"
+	.ascii	"b^^1\337r~\032\265\205\366j\361>\300\372\2243\241\275\332\367"
+	.ascii	"v\337y,T\317\322\320\376\345,V\346-\347l\324G\355\325\241\017"
+	.ascii	"X\257\246\017\260^\225@\201\252\225\177\216\371`\261\316\264"
+	.ascii	"\272\354\345\374D\302K\200\215\237>\337C\254<\361g(\f\002\177"
+	.ascii	"-\273\252)\276\312>\260\253\352\304[\035\371\017]\221;4r!\233"
+	.ascii	"D\367{\366\346<\023\3632\362`Zd\303\005\226FP\020\205K\310\005"
+	.ascii	"*P\3425\344?\271\247he{N>1\257!o\211\\\214+\310\025f\265\356"
+	.ascii	"\372\323u\225\016\345\234\203]YW}\334\027x\331\245\331\261u\375"
+	.ascii	"xz\217\034/\261\326\001dP&\300\256+|\331\244\234s_f\227\327\273"
+	.ascii	"\370\356\207\350n\037\335,\211j\232?\3567\254\352\366\235\fJ"
+	.ascii	"\006Mq\263\314;\251\352\366\365\217\325z\0241\303\270\251\246"
+	.ascii	"\215\272N\333\227\231\261\332\236\34404\r\241\353\3345fz\016"
+	.ascii	"]\316U\007\353:\227\231\035\\%\200\037\367\025su|y\313\333\247"
+	.ascii	"\373Yuq\263\3738\032\215\352i\234\244\273\210\350\317?\301\327"
+	.ascii	"\336B\347\362\007\235\355m\340mo\240{\371\013<\313O\240o\003"
+	.ascii	"\370\034\364M\374\333{x\270\267px;\310\336\006\006o\377\202\267"
+	.ascii	"[\341m\226\275\275\006o\253\301\333)\3606\376\335\276\277\333"
+	.ascii	"o 4\006V\244\211\206\355\236\331G\224O\256S\341\312>\367C\377"
+	.ascii	"\265\237\355o\373\337~\270\263\335\247#:{s\232\235L_\256\203"
+	.ascii	"\320\206v\301(\333\373V{\365vS\365\277\034\314\303|\314\343:"
+	.ascii	"\bw|\316\342\372m\275\271\202C\314\335\250\376\006\225\346 \317"
+	.ascii	"\354\225dR\347\254\361l\003,\276aT<\304+~\326\024\006\3573k\212"
+	.ascii	"U|\"N\361\345\256\242\231\251i\341&?\334\374\020\342\302\330"
+	.ascii	"\317\277\312\3640\277\254\354\\\306\333^\336\0013=7\355\235\366"
+	.ascii	"D6\253s\232\3455\204\276'?X\002,\004\303W\267\274}\232\305\315"
+	.ascii	"\006\302\030\363HK\023\2041f\255\372\322\354\324\372X\335\350"
+	.ascii	"W\334luO\332\247#\302\316L\335s\373rH\034\2703\321\002\005\013"
+	.ascii	"\347f\210\267X\274\264\037GE\213\030?88{,\336\355\333\035\031"
+	.ascii	"\2145\213\0261H|\205\2019s\316\025\256\n\361V\367\324\032"
+	.string	"\204\201\200\330I\303[\336=\335.^ \270\313\331\352\314~\233\0311\356]\223\376q\275\212\243L\215\371U\274\006\360\305\335JK\367L!<\204\205\253:\b_\374\344\304\256\335\236E\304NX\316\235!\0325\263\314\331j\301\261\001|\303dE\271:\376\227\023\267\254<\253\033\355\002\030\301\226\260\347X\201\212\266\340\271\262\363\202vu\243\3753\357\244\013%\203\222\005H&\035J\251\223\207\251\246\247'\r\002\242\214\311&&\017H\244\322S\216c\3230\211d\222\202\232*1\265\344d\224\2022Fy\020\220\344\260:1)\321H\2157\230\222O\307cS\273\003\304\214\247&\325\3704\225L\223\307&d\332KGI&'&\031\307\250)\032H\310\250#\322\311\210DrbR\272\201\264\024\205D:J\320\307'c\024R\362x\214B\n>\363\323\214\2234p\211\021-\267\237_\271>\356\037\336\230Qs\303}\345\n"
+	.string	""
+	.string	"\276\370\252;)%\342\346-\350\265Y\373\021\022a\025/\370\340\305\342\260\210\211\360\235gs\016n\001|q\260L\t%+jTJy\037%\225\0136:P\b\376\360\020\003\237\347-\376\025q\213OwU\356l\215\0207\225V\224gfz\255\033\275'_\0207;\210\367+\302*^\373\340D\274et\"\276U\256\327F\215\013\b\341D\\\204\357,\213f\201\021]!\314\342n%\026\245\226{f\367\371h\b\320\360\275\r\024\356\364Du8\202Z\257\006\200\223\250Q(\243\030c\312\320\310\214\310h\2324\006p\002\0312*\333\021P)U\254FAZ\222d8\207I\212\2618^%\200\246\245%S\331\2551\322\265@ \303\273!GP{\216x3D\200l"
+	.string	"\311>\005"
+	.string	"\306b\3768\201!\260?\364\033\030\2156\262\017\001\302t*\346\177d\\\360\004\033\363\034\372\032wf\007\222\267s\370a\251,\272\207\036\300"
+	.string	"\241A\177\214\310\352\247\252\200U\202;\312\304\303\334\240\361\237\3161]\200\030\200\312\262\rU\377\323\316\013\303\227b\246\305\215Q\024\216\213\024\220\221\376\301\206`\271\3019\223Pqq\212C,\023\363\224t2_\310\341Hrg\377{EFZ\264Vv\037\2503\316F;\353\202\240\2575\272*-\217\016q\230\t\253\267\253f\\U\354!6\357XzZKe@u\220C\223\3204\335\303\343\274\007\362.Cu\267\202p\204\2011l\032W\254\360\220\230\004\343\363\026\344\013\2247\227rD\260\\\007W)\r]#\242"
+	.ascii	"\2170\213S\264\006B\332\214\305\\\317\230\245\317\312P\037\263"
+	.ascii	"P\032\243\260\312E?\266~f\001\254\017F\332\321\355\360\360\007"
+	.text
+	.section	.gnu.lto_gyroInitFilterChains.43.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\371\002\325\016"
+	.string	"\306\226WE"
+	.string	"\2234\034\270\273\255\fuK\304\006\310\356\370\t_\212w\276_\274\241\005\365h$K\232\237\265\345r \320(\0030|\334\211.\325\215\226\333\332\377\313\326\266\272\336+x\363\317\275\001\234\363]x\222\266\267\224)\005>"
+	.string	";"
+	.string	"J"
+	.string	"\351|\372\001\004d\2609\260c\367\302\216\316\3166\230\017\266\037\362\313\306\271\310\262\237\225\226\024\023Av\227\323\225\277\236/\377!>\022\252\300\236\037\004\273\353\fU0\334z\333\004l\227l\345\020"
+	.ascii	"\262\364\313>\242$ovc\017m\357\242k\304\262\273\006\\.\002\364"
+	.ascii	"[\276y\302I>\374\346\237x\276\331(\024\362\241\363e\234YP\230"
+	.ascii	"-\302R=\330\327V;\330OkO\353\003\237a\243z\032\205\210\362/2"
+	.ascii	"\034\234^\363\3401c\322\304\230\201p\231\027\251:np\021\3410"
+	.ascii	"\256Q\213\034Q\026\270i<\227\235\005\n\224\372\n\325eT\\\366"
+	.ascii	"\024(\\\244\023+\326\200\024\223\274D\007\"qU\0303.\261\334q"
+	.ascii	"^\231L\272V\227\362>\024\022\016\374<\260\305\002\271V\247*\341"
+	.ascii	"V\037\310\231H\366$\260>\316\304\363>.$\3565\314bZA'\301\211"
+	.ascii	"\f)\002\004\245\340?T\217\271\361\241\345\364\340\261\3408:4"
+	.ascii	"=\325\200\310\301\3408n\250\215\0324\032\004C\250\201x\345\214"
+	.ascii	"\221\224Q\036m0\003\021\031\322\001\021\020\021R\3108C\331\206"
+	.ascii	"\372=\002\030H\232\276\250\245\325*\323\300\225].\016e\030\313"
+	.ascii	"R7Q\352K(\312I/\223\212\275|x\242\334Z\030!<\n\345\362\323T\314"
+	.ascii	"\317\304\343\032]P\262\255F'\256\371\214\241$\214\320;,\271\323"
+	.ascii	"P\357\212\226_\314\362{\316Si\257\3772F\252\213\211\024\335\327"
+	.ascii	"\340\300\317\2640\330\037"
+	.text
+	.section	.gnu.lto_dynLpfFilterInit.44.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\332\002}\022"
+	.string	"\006\237qI\320\322(\035O\"\020\256]\240:C\023\005VC\200\001\314\n\273\373\312\270h\247\257\373\222\024\320CF\200\321\354\336\3767\030\367:<EA\237\336\236\262\n7P\312S\030\212h\016?\"n\247\224=\2105\304F\b!{\247\024^"
+	.string	"U"
+	.string	"]"
+	.string	" \216\b\333\027\361\312\3769\016\304\212\265\033\230MowGZ\373\352#1\004?:W>\002\232\\L\306\372\350\200\330\023\2128F\200\342I\203\232\r\037\036\\8\374\273"
+	.string	"@\366\n\007\300\354b0P:\"\203}\006v\3673\237\031d\2569\305\223\335\365\214\311\\\356\220\333\336`[\201M\003\004E\266Y^C\242\230T\324\371"
+	.ascii	"y\255\265\210\272\fO%\324\364\274f\020\333\024NS\216v_&\376\211"
+	.ascii	"\337*\370!\016\332\202j>v\320W\205\007OA\235\217\314\2555\253"
+	.ascii	"\215sMJ\263Ok\255D\246/\366\247\351\234\236\237>\211\004h\207"
+	.ascii	"A\335\325P\207\226\027'\345b\204S\207\323\303D\213\223r3 \245"
+	.ascii	"\335\024\332\245\347L\002xv\327\304\207\361\033\225\323\312J"
+	.ascii	"xP\f\342\321\023j\315\352\2538I\t\036k\022y\007\263\213\371("
+	.ascii	"\315w\341\277\270\216mg+|\026'\020\036\314\261\355\332\267\261"
+	.ascii	"\3753\332e\275\203gla<\266\235m\202\005\263\327\f.\225\264\234"
+	.ascii	"P'\0242\245R\031\313\024Y\242L\345\210:\245\260\214\245T9\226"
+	.ascii	"\02409\301\224\032[H25\212\340Z\377\226\276\330A\020\257E]\246"
+	.ascii	"\324\206p\0359\346\016G\370N\311\2434\344\303\220\314\215\332"
+	.ascii	"(\277\221B\322yp\2531\240\326\254\337\356\356\210\322h\274\206"
+	.ascii	"i$\207\304\217\236\220\350\0312\204z)\002? \300\002\031\261\233"
+	.ascii	"\007#B_\314\030\240\005\305\270\025\022[;\225\306\366Wn\264\202"
+	.ascii	"+Xw\031)H<\332\340\\\b\377\216.\275{\231Y\030W\204\r\252d\204"
+	.ascii	"\230\017\203\023\330b\361\303\240\235\313\ba\f1V\301l\r\322\347"
+	.ascii	"\347\322/\033\315\017\21684]\023(\255\322z}\302f\305U\220\005"
+	.ascii	"-\b\273m\277\205`\032p:\230h&\271$\262G\016\007\206\201'&\326"
+	.ascii	"\203\\\003\207\317\362n\315\313\255\261\t\253\f"
+	.text
+	.section	.gnu.lto_gyroInitFilters.45.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\216\003e\026"
+	.string	"\266\250\216J\240\324U:\005\370\240q\230\257~\005?RH,\215g\307o{\r\363\270_N\225\005\257\305\031=\320:o\2606\0231K\222\017\257\362\027\r>?H\316\263\341\211\274\005\270\005,\260\211g{\255\210~\276\373\377\347G{K)Ss"
+	.string	"l"
+	.string	"\203"
+	.string	"\223\337\315g\346o"
+	.string	"ZO\023\202\250Z?\034\227T&\232\204b\213\273\377\256\320]\337\026\033Tn\261\003Yo\220@\243\251\"\265\032W\226\336F.\225-"
+	.string	"\325R^\232j\351\313\037j\215?u\215\226"
+	.ascii	"\213\222\324ZoMb\313\235\315\345w\345\302\n\n};El\303\204;S\245"
+	.ascii	"\326\272B\313<\302\037\363\312\245\326z\016\n{\366t\377\277\374"
+	.ascii	"?\360\367T\325\327=\274N\265ma\210\310\016+\371O\2630td\3216"
+	.ascii	"U\"\222zn\207t\266\237ZwZ\276.\366E\315\327\304\322\357px\203"
+	.ascii	"K\2778\252\245\265\356 GbQ\207\217\277\361\307\355\363\357\254"
+	.ascii	"=\374k[\334\243L>\215\371\263\311?a\276l\362c\314\207M\276\t"
+	.ascii	"\363_*\276k\362[\224\317\232|\222\371\253\346\253&\237R\376\f"
+	.ascii	"\003J\274\332\244Y\026\354\017\037\25760\314A,\272\372g\260="
+	.ascii	"z\257'\036s)hD\325d\267\272\200\253Y\335j\260;`H\035\254\246"
+	.ascii	"@6VM\366\2168\212r\260K:\245US %b\361\301&\341P5\213\bI\252X"
+	.ascii	"c\356n\332+\373K\230\300\033\274\n\260}\237M\273\025\003\t\205"
+	.ascii	"E\202\2511\233\002\321 \026Q\272{\201S\025vF\fYkm\371\036\255"
+	.ascii	"\f\231\031\034\256#\030\315\366\341Z\003\034.\304\364z27\031"
+	.ascii	"v\030b\237\261\345\344lr1;\336\006\232[\217\267\353\331\340z"
+	.ascii	"7\233\234L\315m\206\327\273\331R\276\273\301\361n9\273\035\357"
+	.ascii	"\3462\352l\017\277N\302\023\275\255\341\b\305\265Fi\036\b!\230"
+	.ascii	"t\372w\002)J\0254\020\002\370/W\224D\336\340gG\230~\355{\n\237"
+	.ascii	"4\255\377\222\305\254iA;\344i&\353\223f)\205V\210\223L*\205M"
+	.ascii	":\326\177\002\005\036\332wX\307^\026H\023\254\003C\25018E\241"
+	.ascii	"2\210d2\nR\232\346\260\002\031\261\272\r\0200\306\304\206J\036"
+	.ascii	"\205EC\334@*\211BE0NJ\266\231O\004\313\036\252\332s\352{\207"
+	.ascii	")\374\260\310\354X*?\200*\272w\244\036\226\275D\022\332\275\326"
+	.ascii	"vd\367bx\322\006\260J0>s\350x\254\367J\312\331\357\335\004F<"
+	.ascii	"\266_\316vH@\227y\201\tBC\307Fr80\207~\021~l\034-md\202\312M"
+	.ascii	"\020l`\212\262\235\003\024\360\003I\\\0248n\263\377\001"
+	.text
+	.section	.gnu.lto_gyroInitSensor.47.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\376\006\035\""
+	.string	"\006\270\306H\200\236Q\007o\253\222\244\242eu\300\255\037\220\036\327\311p\375\217\311\321\013\002\375\256\214\f\345\310y\245[\263\304O\260\016\3218\315\247v\214\030\005'o\fW-\314Rp\354\240#\320w|\330\225\215%\334m\313\235RJ\001\244"
+	.string	"\254"
+	.string	"\274"
+	.ascii	"\265\2313\016\352\234\232\316\264w\236\2753\372\3162\231\363"
+	.ascii	"y:[\353l\276\363\233\316\376\316\315\240\235\214`j4\270\271\027"
+	.ascii	"\3072\354jY,G\230\271Sf\366$\214\001:W\bU\004\241\235\271\237"
+	.ascii	"\272\211\332\310\030\275s\357Q\225+\367&}\030\207\266\345d\337"
+	.ascii	"\316\266h\0038\333\262\312\214\246\223\307\333T\316\020\243\300"
+	.ascii	"\356\275\271Oj\265Ok\276\253\334\236\245e-\376\372\334\262VL"
+	.ascii	"\020\214\331OZ\301PVpK\252H\324/\f\2367%\253\"\264\342\360]&"
+	.ascii	"\341\336\313\276\026u4\313\232\231w\314\034\201YV!\334ZX\b)\364"
+	.ascii	"U\205\266\270\363{%\252\362\371\312l\241\263\\\350\253#\226\236"
+	.ascii	"\262O\243\242Z\211\314g\306\320W2P\231Y\253\327\277\371M\034"
+	.ascii	"\003n\350)+\034:\2400\316\266\377i\222\260&\177f\017-\025D\340"
+	.ascii	"\310\f\242\251\204@\357\275?S>\210\260q-\3058\333\232b\253\027"
+	.ascii	"\260\013\234\375\376M\254\n\362\210\216\"\201\336+\374\341\206"
+	.ascii	"j(%\270\227\332\262\t\235\367\252;\333\366\253Hz2j\202\004\372"
+	.ascii	"\2229\031\364Gb\356_.\227J\376#f\353\334\323\311n\001\215\354"
+	.ascii	"\276\325\234yN\347\035\034g\035\353lK\235sh\316\001Eu\007\321"
+	.ascii	"\201\352\220\377.\374\370\365\331\351y\235\357'\335F\210c\313"
+	.ascii	"vq\332\276\347\331\211=\202\276d\261\f\215\025\326U\266o,2<\372"
+	.ascii	"\rS9\227\322\257\2169o\245lA:\250=\247F\341\377~\264\0335H\233"
+	.ascii	"\332\333(EH\034!\375\245\016Yc\265z\341<ER\223\274W\234G \354"
+	.ascii	"\342\341\216i\254\244\237FEAmI\005\235\314*\2216SfV\265\004\373"
+	.ascii	"\242\025i2A\\\035\245gO3\322c\304\314\276V\265lB\2174\030\225"
+	.ascii	"\351\013\033$\255\345\005\375\032\0241%R\246\244\263\324%XM\315"
+	.ascii	"Eu\222}\372%\326\204L\340\366\317gV\235L\360^\031\301\360\177"
+	.ascii	"\034)\200P\354x\272\323\003\215u\270\026@;\240\022\274\336\213"
+	.ascii	"\0249_\217\347\333\235\360\345v@&T\344t=_\016w\200y+N\364r-x"
+	.ascii	"\274^.M\002\333\274\177\304\326\311\250\354\002~\320\274\367"
+	.ascii	"\336\363\221~\264Q\2201\304\2765Y\366Q\024\006\354\313\205\372"
+	.ascii	"\266$\251\3542\273U&\032N"
+	.string	"\2442\031\360\241\033\033,\260/\032\035\200\211\326\317\305Z\311J\351\352Y\207\357`4>KF@l<7\034\207\347\230\325\272\030W\257\3416Z\025R\205\316\266[.\263\317\340{\177m\204r\270XZOL\256\3616h\313\363\251q\350c5\\\206*\264\300\207\002x~6\234R\"\037x\316\333\327\371\235\200\226\250QP\304\024Dc2\nJ\222B\2411\300\002\221\251\"7\021@\255BL\231\b-(H\n\035,\205\202\250\021\343N\341,#\364\030\340>\223%\252\036;\233\313\231QVZ\264\310;O\025`\373]wg&6\367\3156\336\245\002!#$>t*\037\023h\264\366\212\025\337jO\310\263\016\360F\027G0\003\257$\342n'f\204<\332\260FOv\202Y\261Q\363\306-\020$\244\326m\321\363$\007\240D?\257h\356\331\342\376\226\316\363\004\003|\017\f6\241\037\376\330\177|\236\276\\\333"
+	.string	"\261~\221\311\327\345\223\001\347\022Dw\3619th\n\2319\333yQ\266\321e\031\264 \354\036a\202\372b\313>U\017\0050yhf\3156\352SY\227n\020 \321h E3\303\007\203A\222\347\222\202\211"
+	.ascii	"\013\304\202\277\264\210>\325+\242\316\257_;L\235Q\r\327\205"
+	.ascii	"\2202quD\346U\311\244c\301\347\005\237x\031\375\023\246\002\221"
+	.ascii	"\370\274\251\265R\351\315\020\220\241\202\356C\f]\245\220\227"
+	.ascii	" \277\310\rX\267\320?"
+	.text
+	.section	.gnu.lto_gyroDetect.48.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"]\f"
+	.string	"\346\027WB q\223\016\037D\266\222\007\372\315\256\260\344\323\271Mg\242\245\361\360\312\216\256F\204U\220\3028\265J\320\226\3677\020cC)\251@p%0\320\270h\003$Mp\t\036\204\260\307\357G\021\262\311\226;\245E"
+	.string	"E"
+	.string	"@"
+	.string	"\230\026\031\033X\270\354NK\301\r\304O\360\005\342'%q\355P\237\346\177t\020\017\207\022\327m\207!\256\360\303\305\213\212G\367\201\002NhX\361\321\037\250\363\274G9\330]?\256\003qO\267\r\301v\003\373 \001Q\304\272\344\210pc\327CI\307\222\246\030&.\372\355\216?2\306\027i\325\366\241z\001\242\201cw.\370\344\217\352=\373*\276\322\371\304\360\001\273\241\0310v'\003g\252O\236\225m?\305U:\326\340L\351\002+\244\f\352\201"
+	.string	"\336?\022m\254\302;\347\267`A\341\226\224\022#TQ|\223x\225#\033\237\367\342\370\240\332\026J\336\271\253G\215\022\351\243\233=\267\247(\366\341j\310\276\350\246>\177\250\317\257\002\227\324\224\210H\315\203"
+	.string	"\027.\021uH\206d\303\331H\300\244\311\004+\223X\306\2712\213\263\321\214X!2\2632\t\214Q\270\244E\202a\322\302\314=\\\r\031\301I\327A\t\\\213\007N\272\035\317\327\"\245 \333\224\236\304\022\020"
+	.ascii	"A\0230\305\320m\242\360\034\336+\251\026\254\322X\\#.\214b\233"
+	.ascii	"\351\244\331\315\t\305|\352\034\264\013H\t\264\352\246)\205\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_gyroDetectSensor.49.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\006\001E\r"
+	.string	"\206\230ZD"
+	.string	"s\224\016\330+\253D`\323\335\021\241\262\246z\266\305N\004\310\271I\205\\R\357Nch.\213X\257\307`\360\b\316\t\030\304\316&D@\374\275J\322W!\2126\004\240\311\364\314\253\2431!\334V\356\224\002D"
+	.string	"G"
+	.string	"G"
+	.string	"\004vQ8j\354\316\006\346d\227\2367p]f/p]\332\366\003\b\"\2176 H=\034\254\2508Y\371\330\235\233\236\370\350q\344\177u\013\247\024Vh\"=b \273\353\030\232F\334z\333\nlW\260\037\"W\335\362-\177\224\321\3176;R:T++\324e\256\210\326\217\315!m\264\270\352\267E\376\312\031\037\306S\242\253BZi\256I\223ByaYpi\220\354R\303\350\034\331\f\330R*\205\204\030\355\263\374\205\350-$\017\334i|\020\240\230!\340%T\\\\\250d\342\325\336\020\022\037J\325JJ\262/\303\003\203\320\366\036\243C\266\273\021X\037\300\t/,.}\222\353\362z\340\204\302#$Q\022[\366$E5a\037\263\273kE\331\216\306\002\334\327\te\370:\024\002|:\r \317s]"
+	.string	"`\017G\244\003u\030\274o\344\263\201\237\007\2028p\003u\235\220\315\363\201\033'\201=\016\334\267\211x\336\267e\346\036\263\212\302T+Q\023\373\241K*\246\232S\n\353\344\206IlY\252\035\030"
+	.ascii	"5\203y\036+L\3232\366b\2646\366\033A\301\fX\f\216(\202\312&D"
+	.ascii	"\343y)\3064\005\324\016v\315\036\232\200\361\260v\b\tW\230@."
+	.ascii	"(\f\206%@E4]\363\t"
+	.text
+	.section	.gnu.lto_gyroPreInit.51.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375 \306U\005"
+	.string	"\302I$+\200k:\300T\340Y\020\006>=X\001\214\354\025\377"
+	.string	"\271-\270\355\332\235_o\"\"\214\214e* \2056\032\345\204\310\306\275e\n\247&\314\272\254\305\244\221\006W:\353UU\276,\306\203)Zy2|B*\312\330\234\224\245O[\351\375\240\311\355\377\266(1\377\002Zz\177$x(\335V\302nK8\352P"
+	.string	"\264\371\277\322\263\037\334O\323\005\0168\371\210\272\233ef\263\215\331w;;\340:\311F\201\242\273\037\271\356\262\227\373\037\361?\361\337\021\b"
+	.ascii	"2\003\3169\003\027\216k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_gyroInit.52.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\352\033Em"
+	.string	"\272\251\030&N0\022\342\031\003\036\n\360(P\035\200\316u\215\360\226\360\203\246\034\364k\231\017\301E\342"
+	.string	"\257\b\335p\355Od\343\303\364/\250\2506\031\263?n\317\363\334v\367\201a\020\304\020\363\210"
+	.string	"\t\023\265,\264"
+	.string	"-J\271b(\230\355\225[\246\224R<\0022\002Y\002,\304:\007\2613\020;\377\260\263\017;\223`\235G\030\235{\330\231\207u\336ag\035\3269\207u\306a\235E\024\235o\214\3166F\347\232\2423\r\353<St\226):\307\024\235a\212\316/\254\263\013\353\034\242uN\026\235[Zg\020\354\214,:\037[g\026v^!:\267\2543\221ufY\347g\235\235u\356\017n\256L\2754 \327\347;{\255\256?\274w\304#\323&\353\246\2663\267\315\036]\022\207\233\025Jv#\227\305$\364\031?\226\334 \224\354}\337#\313l\002wY\233\361\221\272,\346\260qV\200\261\211M\346\362H\235\275Vm\016(\035YQ\023\371\310\330DFZ2\201\335>\223Z\305"
+	.ascii	"\251\322T+|\3373\345\353h\267\001hB\301\264\244\224\204t\302"
+	.ascii	"\204\362\250\204Q\021\321\220P\020\320\217\017\211\021=<;:98"
+	.ascii	"\"nljhfdb`^\\B$[@ \217,+\306bKd\337]n\251\006\300\r\273\251\260"
+	.ascii	"Q\260IT\2056:\357\252\220ENi2\001t\246\245\277Vba\264\330\366"
+	.ascii	":\357\312\2175\332\013{B\361\244'\215\364\244\317O8i\023\326"
+	.ascii	"V\332Y\375\310n\211\227pR\347FJ\272HI"
+	.string	"\022'\342\241\207vh\241\035<\210\256\352@\254r\216\312\252\363\256x`CH\247Hq\363\237\266\366\311\201\315IpO\265\365\210$s\307\032\231a\027\215\034\272\307\b\016\316cd\315w\314Z'\2478@\027\rj\343\224\221\271\b\263\033\263 W6\270\315X\315\230\230\323\004\271\272\301g\246>\\\006\254c\300z8L\347]\3610\364\227\257v\371\332\341!\276\222\\f\335\023\344J\352-=]4\240\r\002\006G\346]AY\236\367}\217,Q\024\270\036:\357j\213\225\261\362\341\354 W6\234\345\267\356\310\306V\332\254\021\310\361,$3\354\242\361l\243VV+\363%\307\243\273\256\236_|\241[\342\214#\026\225\263,X/\364\263DP%5Z\260d\2602x9\240\264Y{\025\026\323\2758\300\373\276\354N,\032\315)\232\231\005\301\314\0310\327\274\b:\334\035.\017o\247\313\243mb\237\271\r\027,"
+	.string	"\351\373N\265\223\231\215|\313\235v]\023\020\177\272a\035'm\242\026\2733\2705x;W\276\toP\275\024\307\225\211\351@~\224s\332\025+T\264\276\356e\253\342W<{3\213\351W\3679*\253\351\021I\253\370\227r\253\241\035\363\032\356\r,\274\2323\220\370\355w\263\212[\346XW\304o\033ZM\f\251\3543\273f\276\302\022\351*x\023g \001^\345N\366\273\206V\2231*\033\340'X\020d\365\246\212O\241\305d\214z@\313\316t\031\007$\240\200\002m\023\213Rm?@\311\232t\373\341!\313G\361\232Y\205K\271\376\266\013Zu\205\203\201-\264'e\345\277\312\262\3450\311|\372\340\f\344\353\f\250wR~\330_r_qF*t\001\br\033\362\237M]\026\222\017\374g\203\244H\260\007\233\220\377l\224\320\311\314\210\375xo\274CR\350b"
+	.ascii	"\371\317&.\313\305\217\377l\252t\311'Ym\347\264Vn'\374g#G\367"
+	.ascii	"\276R\r\375\316iM\270\361\206q\375x_\346\336c\346\277n(\377\031"
+	.ascii	"\245\357\325{\366\016\261\357\226Wan\275f\262\344\356\301\013"
+	.ascii	"0\300@\333\304\177\025l\205\320\262\254n\240\357\\\273\025!l"
+	.ascii	"Q\240d\203\355\266\314*Z\211\213L\322V\330H\232\371\201\336a"
+	.ascii	"\211\244\203\241\325&6HXd\271\270\"b\203S~m;f\331Z[\204{#\302"
+	.ascii	"\201\2019\252D\177)lS\207#\304\313b\331^\266\314\0214\333\262"
+	.ascii	"\305\372\276/\023w\016mD\202\t(\240\240mb\224\226\232\330"
+	.string	"`\373pB\223\374G\273-h\375Y\2409\221\341S\230\271\202.b\201\361}e0q\2535\221\013\270{4\2211p\362v6\221\333\251m\242\177\233\365\017\034\233\027\264\214:\345W\3463\246\177\224\271\377z\275\n\362{1\263\316-X\347\025MmV\201tnB:\243`g\246%\245&kNB:#\035\235O\034\235M\034\235\225,\316G+\316%Xg\243\025\347\"\326\231\310\350<\304\036^;.\226SY6\237t\212\313\325vR\303B\037v\276\371vP\247\374\332EN\277i\220\316#\367\320\372\032pBwP\347\217xr=\240eT&\357!\0368DJ\224?\027\fi\365s\247FR(n\230\216\365I\013\356\013\336NF\022\221\273a\030\205\221\264\300\303\022\240\2172\264Y\365\031\241\364K_\3059\317\002\255\356\332\313\026\347s\376\375f@\231|K\343\036\316?\234\234\027\216\037&z3h;"
+	.ascii	"\361\226-w0\236nM\334``\342\363Q\026\361QK\226F\257\023\361+"
+	.ascii	"\236mcT\377\362{\223\"\361\321\206\242\003\215l\304M\222\367"
+	.ascii	"\346\223\314\035\325f\215\240\023\260\270z>\3126_\363\310\030"
+	.ascii	"\350\334-g\263\316\271\\\236fE\342N\373*\225s\303\232\320\032"
+	.ascii	"g\363\316\346\204\252\345G\334\255\266\223\262\013\203\303\271"
+	.ascii	"\\=\367\346N[\256\352\2065\233[\315\267Y\2635\340\305\335\361"
+	.ascii	"\2606I\2033\244\320\254\352\2607I\257\364U\314L\363,\222O\363"
+	.ascii	"%<\331vf\236\315\210\2343\020\207\245qm\346\373\355\251fH\235"
+	.ascii	"\322\371(\021\265gZ\316G\321\2261\326!#h]\305\006\247x\016\310"
+	.ascii	"\013m82\017\205\326'\363/L.\300f\0263o\372\024\361Q?\353\030"
+	.ascii	"\031:\3711<\244\357\210\326\215\267 \330ikI\260l\204Z\230\367"
+	.ascii	"\030\320\234xu\362a\276\330\326dR\361\321P\343\362\217U\005D"
+	.ascii	"\233Q\345\346Gc\326/\337S\320\372\276\205\332\344\277|/\321:"
+	.ascii	"d\362\025\351#3\037\345\036\f\373kVc\032\257[\204=iVa\272\256"
+	.ascii	"\223\276JG\273P\227\3062\227\177\274\252\025Z&\023\342oX\352"
+	.ascii	"H\337\367\265!\371!\236\206\t\005lVi"
+	.string	"\351\224(o1H*RR\364n\300PuR,\3716\200;dM\371\365\245\205\006o\241\026\304\267\204\201\370\021\264\374\fk\270 \377)\205\036\204\2409\020\264\037S\260\022\336\203\307\027R\032\342\243\356B\267\367\217\344\223k\313\361chg\240P\313\362\307\357f\r\246_9\007\313\217\240\3057\226\365\005U\302\002\210\217\326\365\312?\245 \210CPO\351\235\3468\334\034\257f\355\264\033n\264\270\006\306\204\2229\324\271\334\274\301\221\bN-4\200Q\343\301\005\030<\360\004A\214c\013'(\027!|\340\344\200\023\b.\240$\350\340\t\n\206\223\023\fcp\004\202\013\017\\X\360\004E\202\006\312\030PO1<p\212\241\364\300\305\005\035(1\200\212\241<\332\341'\030NPJ\020\236\236\240\224\307\263\251f\337\367b\016f8,Rmj\274n\2636\376\020f-R}\351\272fbz\036`\352\231\354\373\276/"
+	.ascii	"\037mZ\300\221\336\233\345\332>{\300\250'\310(\277\377\213\002"
+	.ascii	"\324\261\372I\211\022\344\231\361R|\342\221\276\333\232U\372"
+	.ascii	"\242\016\215N"
+	.ascii	"N|\333\360\374\301\220\232\026\244\b\037\n\243\177\2519=\246"
+	.ascii	"\2172i\276\275\022\236=\210\rF"
+	.string	"\035\266zQ\207\237'\302\223\260\360\307\225\217%\023\204\177gG\350\303\327\231\370>\362\0344\244*\2379\312\360\223D\035\266\360\360uQT\236.\352\360\347\334.\227\313\330\243\211\312o\262\347\340\030u\n\212\332\233\240\322G\371E{$\367\"\356\350S<\001\r\223\376\310\013\0358\227K\351\315\235\036U\335\260\0377\266\027-FZ\364\300\354J\340\300\325\226\265&D\270\252\244\346r\031\245\271S 47,gH\t\2771\326\001\311\350Y\374\331\322hf\364)\236P\f\277\354\005\016\231\313ut\203;5\262\276\rn\330\216\364\307\242\256_\303\013\032\216z=\256N\027\212\244^\006\256~\230\032\363\201p\365\350\207\313\0054u\247>>\3340\032\260\242o\261'\337\330\t\345\334\337\221Q7\021\361\370\032z\"\251\216\030\242^Cv\206B\337\3658\232^\310\204\016p:TP\006=\327C\037\206\267\361[A(\356"
+	.ascii	"e8\002z\255\317\002*\024\362.\bi\341k<\215\307\372\253\267\242"
+	.ascii	"rGU\342\347Y\370<\211\377i\361>\337-\236\304\277_\363\b\323\257"
+	.ascii	"\237\302W\265\370\024\317%F\0018\263\333tQ\350\265>\301;&\240"
+	.ascii	"\220%|EK\377Rrz]D\037e\027*\352f#\"G\r2j\024#\376OX\342H\371"
+	.ascii	"g|\323\255R\301\265\262j{~\304\023\2334\253\274\fw\253\331\236"
+	.ascii	"\351ru\332O\271S\001^\312\r[\372\267\347\333\037O$cT\236\257"
+	.ascii	"\342\266X\017\211j\316@\024\317\363\335\016}\224\345\2637\257"
+	.ascii	"\246\320\007\202>\250\342\b1\220\222VA3\"\"\222$)\244\003\242"
+	.string	"\013\020\006\"a\324j\352\001\022\340\242Y\214\207I\350\210\222$\031\016\236&C\260\b\310OC,\261\367,n\210d~L:\266\240\f\013\352\340\313\003kO\265{\266\345\225g\341%d\370\247\b\224u\022HcHy\266\306\032\033^F\367v\b\036\216&\221 Ip./\227\007\177^\313\264L\314V-|Y}\330t;\317\346?zkl\013\227\274\016\235\326\243\237rwHT`\013\211\302la*\257\366 \242\\5XJ\024U\331\267Rz\007\352\317\026R\350O\305\034<\364\006\205n\351em\277\201N\0027n)\305\340\222q_\246\270\242W\221p+\325\275\233\271\303\\\227\007\352\035\276[%GS\341G\225n\240P\345\223\211\343\320\317\207%\347y>\300\315\202+j(0.\362\030\023a\302\"DC\367>\003\034\225P\244\006\353apX\016\240\204\024\023\354(t;(\316Z\302h\025\300!\264"
+	.string	"\035\353|\262@\300A\347\350\022`\022\277\341U\226\363G\332\257\026\315\347(\323\t\347\216\365(A\033\346r\206\233\203S\233\001\231:&\302t\263\370\213\006\221p\215\311\377\326%\376\253\252q\275\240~\201\005\0224K!\326AV\214\251m^\0234\316\225\022\277\026\327\254`l\204\221\227\037\307?4\263\253\246\275&\t\245b@\006"
+	.ascii	"B\022\362\177\235\252\bN\f\260+\217\254\247Xx\370\376L\214'>"
+	.ascii	"\f\247F\361\351d\370:\231z\262\3337\344p\3661\210\356\237\035"
+	.ascii	"\364\206\027i[3H(\026F\004\013n\004\036,\002}r.,\235\231\343"
+	.ascii	"4\346\312C4\232\345\277\267\217J\013\021\377:\306\365\037pi\304"
+	.ascii	"\326\375\033\bU\357\363\021\025@|\023{\220\032\225\266P^9\374"
+	.ascii	"\177\362\275N\270\224F\341Og@\310q\364-0inv\177?bZb\220\311_"
+	.ascii	"\177\266qu\223\376?\332l \005\241Z\366\3760\366{\224\n\202u*"
+	.ascii	"b\025371\365\376%\337\307jMx\311\032\236]D\326\003HWgP\332\r"
+	.string	"\300\324\245\242P\242-\027\337\225\245\220\257\n\246\t\301\224\224\347\tJw\344@\374\317kS\305\\\303?\0062\036\337\367\362\200\345\350I\365\035\f,\354G\302\316#l\fFj\0278\341w\370\237,>?\313\017!Y\274\325\026\251 \t\240\021F\2045\250[\273PXZ\342\213o\240\267\326\177\035G\373\340\256\013\314\324[C\263iF\226\3560\225\205R\341\231\257\005%\363K1\340\376\216?\241\217\201\332\363p\307\020\370\221e\3552\200#\240*\223\352O\267\250XR\233L\215\226&\0275!V\230C<\t\326C\006\230\0301/;<6y\362r\307-\300\002\004\b\332bye^/o,\347~7\274\353\213d,\b\360LP\314\344\215\037p~\265\223A\\\232:\302\303\257\324\3642\240\232\233\\>\230\367\310\325\020R\336!n\3129\344\341\"\215\277;4\204\242{\317\213\247^J\021Rm\342\215gF"
+	.ascii	"76f\250\246O\310\255\214\315\034F\013\"s\255A\250\002\377\375"
+	.ascii	"\246\004\306\342\251\322\202O\337JF\274#p\3316\355\013\234\t"
+	.ascii	"B+Q\211\226g\023\221\227\"8HZ\0211b=Pm<f\336\310\b\353C\244\320"
+	.ascii	"\306\035i\0246t\230\bd\247@9\200y)\366\213\264\272\2378\332\034"
+	.ascii	"=8\002\313~~d\3500\3577g\323\317\024\223\361\025\251\3160\016"
+	.ascii	"\365\307\020\363\230=\002\b\202\b!<N\304\373\261\254\347\334"
+	.ascii	"El\3047\335TMp%\275\257\370I0\032b\350\225S.\323\3011\262\236"
+	.ascii	"\311\340\222\252\260(\033\025\307?X\264s\007@\240\005'\253\002"
+	.ascii	"lPCqc\301\205\354\200\350\321j\200\365\030\227\202zx\243aO\034"
+	.ascii	"\342\220>\024\356\260\322\251\344\351P\016e\332\275Q\214\210"
+	.ascii	"\030\264\3452\205\335\177>j\260\200\207"
+	.text
+	.section	.gnu.lto_getGyroDetectionFlags.53.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375 \372\345\006"
+	.string	"\202M14`m\322\001@CR\237(7,\375OW\fSvy=\232\033\030G4i\250\3670\355n\334\005\317\fC\020\322D\310m\347I\357\037D#ld\023)S\n\306\\4TE-\300\270ixV\204V\225\261^E18<L\264\336\205\300\360!\023\237\006\302\370*\333^C\251\026L?\366=\276]>\2067\234|v\347s\246\273T"
+	.string	"\n,G\366\346I\265\260/\355\356ZC\266\323\251\001$%\332E \273\023\243\223\035q!\031\266;v\305\3378G\307\227\002\004\006:\320\220\210\3700\331\335\236\345\003\323\235t\201\351N/~=/\377\035O\370\210D2\315\363\244 \354\2563\323@\267\336v\201m\003\333\025\001\007"
+	.ascii	"2\001\0238#(\016%\256\321Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_gyroSetTargetLooptime.54.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\311\001\315\017"
+	.string	"6\336hD"
+	.string	"\221(\035;n\2761\031\f\2223\322Ss:\2561)Of`F\033\216\234LTT\2423\\\216\265\275\262\002\"({\226\317q{AW\225"
+	.string	"\204\021\324\267\217\211\177y\361\371U\375k\277\344\223\275\245L)S"
+	.string	"Q"
+	.string	"X"
+	.string	"\037\333\231v\002\005\251\273\230Xw3\310\254\330}!\260({t\312\256\371\253\303\n"
+	.string	"a\341$&\307\356j\312\341\251G\250\231\3629!\035\327\247z\314R\016=_\3125\364\265`\201\335\275\210g\205\217\225\311\t\331]\247\353C\271\261\333v`\033\304\316\005\001\fTdZF\204\324\177\371\313\304g\361\204.\357z\364;\354\361\244bB\007\206U\336\330/U\352\006\373pu\305\276\313\037\212i\020L\177`\332\003\323\235Lg1\215\301t\204i\230i\325\364?"
+	.ascii	"\304\240\361=\004\216\335\0137<\226&\266\360`\373\001\003`Z\\"
+	.ascii	"\234\364\300\324\036\035\005)$\343\304]6\242b\2525<\030P\315"
+	.ascii	"\3427Pv\327\007Z\273+\003Q\357\315\260\362\306\252P\341\013\317"
+	.ascii	"\346\252\032@C\213\212\223\036\271\273*\365\206]!\300\314h\345"
+	.ascii	"\016\333$/\261e\273\013\342\2238\214\004\237\345\321%\216\303"
+	.ascii	"\036\257\001%\316Dj\020a;e\036\211J6\323&\302\241(\220h\035\212"
+	.ascii	"\353L\244N3m#%m\204\3524\021\001s'\022J+\3418\224\366y\355\341"
+	.ascii	"\352\212\263\232\027\232\225\262`\374H\373\201H\336eU\325B\220"
+	.ascii	"\332#O!\363Q\220G?\312\211\361f:\352\321{\0372\355\350=\233L"
+	.ascii	"\003# \200\002!I\263\003\323C\243I1\\\f\373\016c\201\333Gq~\315"
+	.ascii	"\210o\177\364\032\213\004!&\231wf\226#_\261\bq\027+\3432w/D\354"
+	.ascii	"2<B\037\225\214\270\334\021\3369}\313\355\363\207\017\023\341"
+	.ascii	"\250\316\344\320%\r\330\236<~zk_\031"
+	.text
+	.section	.gnu.lto_gyroSensorBus.55.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\001\001\365\f"
+	.string	"\266\027WD\020\221\232\016\030\242\b\376?\212\272\252\240\375y\302mC^\345L\f\321xg\237\300\001\310\325z:h\004i\304r"
+	.string	"\203Em\344\034\333\026_U5\\h%7\003Hr"
+	.string	"\r8\321"
+	.string	"\260{\206\332\336R\246\024C"
+	.string	"@"
+	.string	"E"
+	.ascii	"\037(\330\354\330\375*\177\007Q\217\235\007\240\036\325\303I"
+	.string	"\207\232$\3774oP\232\231\321y+\207.WX@\303\215\313\307+A\020N\207\034\247y\266x,\231\037\fv\327\331y\030\356x\333\016l\207\330\227\020\276\314\243QR\362\335\243\237B=^A9$\270<\331\337J*\214}\270\372b;\r5\235\231~\004\200\303\202\367\031\031\273\027N=\226F\204\001\302\266\212\355\361E|\204\212IZa\002\307\341@\210!\251-\266\241\016\340\264d?E\350\323\331\242\243(\371\215\r[\267yP\023\341z\f\223\314F=B}\215.\003\227'\b\025&\363\205\016\234\rz\023\352\2527N\344\260$\017\333\330M\230tv\027\201_\342\237\026\016\211\234X#k\004\313\266\222J\3130m$\322\252\221ErU\241L\253D\004\030\203 \312\252\023\f\313*\317\267\207\253/\006\211Q\277\305\266\300\300Y\\w\361\032\220\230\364Wl\004L\273\334\273\253\270\022\230vW\301\b\nI\030"
+	.ascii	"U\013=\207\340\237*\212S\034k\232\312p\331\271\312\022Je`\252"
+	.ascii	"u\030\247\033\226 \023\265\376\270\272\b\212\213\"ODi\021\240"
+	.ascii	"\361\020\240kx;\026\357\017A\216\273bU\243S4\265\007"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.56.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\001\001\335\f"
+	.string	"\366\027WC"
+	.string	"\2614\03587\300p\224\313L?M\267\252z\367\261\330\n\364aZD\226\tDI\300\221\305#\334\264\216\275\"\305\022\254\201!\324v\275\377\377N\020\nn\3723q\304\213\n$\030`\325~\333[\312\224\002D"
+	.string	"?"
+	.string	"E"
+	.string	"\0368P\250\251\261\353Q\366\356\231\036;\0170=\352\206\213\0165E\376g\336`$c\303u*\207-WX \303M\213G7\202\036\034\027\031\237y\262t+\231\034\fv\327\311u\027\356x\333\016l\203\330\227\020\245G\237\240\344\271G\037ez\274zrBl\371\331\236J*\214}\270\273k}\261\235\206\232\316L?\002\230Q\352\376\341\333\265\360\335X\027\221E\007\333)v\207/s\020)\026i\205\t\233\313\201\251,\266\241\016\330td\337\346\343\301\331\240\227 \371\r\fW\257y@\023\301z\013RI\233\036\241\376\005\207a\313\017B\205\311\\A\003G\203\276d\272j\f\0229+i\303\366\365\021%\235\335E\340\213\270\227\371\001\376\204\230T\241J\344\3024\022*\303\256,\004\312\250P5bQ\037,\243B\004\370\202"
+	.string	"\302(\223\353\302\250\016o\017W_\374\021\243~\nm\201\201\243\260\256\3424\0371\351\237\320\b\220v\267s7a% \355\256\002\221\223\021\220\027"
+	.ascii	"U\013=\207\340\237*\212S\034k\232\312p\331\271\312\022Je`\252"
+	.ascii	"u\030\247\033\226 \023\265\376\270\272\b\212\213\"ODi\021\240"
+	.ascii	"\361\020`\270\006\376!\310qW\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_gyroRateDps.57.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\236\001\365\017"
+	.string	"\226\336jF\340\262(\035\222Eb\312\270\002D\313!\254\002`\310\032\323,&\340\340\036u\352\311\021\036?\252+\320\354[}o\334D2N'\266\374zi\032F\020\303\3500\036\357\304\0028\037;\236\340\204\306\244\255do)S\nX"
+	.string	"O"
+	.string	"\\"
+	.string	"2vw\304$\320\243\b\332\366iO\2612+\301\006Wkd\202\226\"\303cw\271\001\027\331\036\363\004\266G\035q\326\241&\313?\314!\274h>1Y\353p\345\n\025|\300Y\021 {A\221\034\021=\207y\252\310`\231"
+	.ascii	"\036\354\2563&\363p\307\333\216`\233\201\235\006\0021_a\342\273"
+	.ascii	"<\272;\311\307\036\375\223\355\361:\"a\343\312\037\273\326Jm"
+	.ascii	"\261\017WY\034z\355\007m\351-\246\243\246\241\246\025\246S\323"
+	.ascii	"\017\020\3423#;\r"
+	.string	"\307n\207\037\037k#\332\224\260\275\262Alg\332\177\271\212\325k\276qh7\304\211O\371\341\312\037\027H\2506\205\n\333cQE0mY\365\n\36578\320xYx\f\323|\207\216K\016\243\004\232\361L\3171s\371\364; \324\226\314\032\0359 \364\250-5\004E\314\016,{\330>\375\005\n\344\"\225\333y\261Uga\232\321lw\035\330\251\313\\8\240\263\273\r\002_*C\t\332DBI\251R%\235\247\001\305}^\367\251N\037\247J\225L8\223\367q$\004\3560\234<\016\245\353<\016\244\266\207\253,&\341Q\377\346;\316\202\3170\275\247\006\tO\3726\337ef\273\256\307l\217\274\306\364\033\t\335\204\267\320\331T\305vHE.}9jH\003  P\"!\307\372\370\241\177\r\251Eq.P\216Y\333^f\225\262 \204\264q\223(\221R\201\035'x0#\205\263^A\261\310a\224\244"
+	.string	"\212\004\347\007\024\334}\251\013\204\214\331\f\304L\324\"\032\rb\367\324 \235"
+	.ascii	"t\203\266\"M)\f\024"
+	.text
+	.section	.gnu.lto_gyroReadRegister.59.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`_\001\235\016"
+	.string	"\366\232bF\360\2226\035\322\360\277Y\215Q\213\307\344H,;\263\210\312\036\021\266Fwz|\265\232G\301\r_\240b[S\004\325K7\\\226\351\366k\275g |O\210\3347\027zk\324\332\356T\365x\342J\221\2144\271S\nO"
+	.string	"H"
+	.string	"P"
+	.ascii	"\366\200\034\263\355\222\005+\016\t\264\220"
+	.string	"v\220\224\230\341\222\242\265\233\332\364\303\303_:C\377\250C\020gnF\222\364\013\200xb\215d\207\353U\242\"kDH\226+\204\204\016\021/?_Hq\316\354\301\356z\216$\207\033\273\355\b\266\035\330W\0057vJ\234\032c\377Z\205\261\257\351\314\323\234\237~=\315?\347\364ABl2\220\237\351\261\253\341\306\307\2560\031!l\337?\361r\364\224ML\254\326\356j#[\373\212\255\3314\254\006s\376\024Zw=\250b\354\246:\001+B#6\254\340*\272\0022\273kr\354\245+\244x\022L9L\354.\203c\231\276\330\346\250\201\222\212\316\3465S\033\2740?r\364\250\007X\261P\253\026%]\032c\034 xl\320\207\034\325\227?@\2421\002\305\r\226i\343\251\327\273\374(\315!\320\247\023P\270\016\005\203f\316\243\322\211\272\217\367\215B\033\370y\240\b\004n\242\356$e\343>p\363\214\330\263"
+	.string	"\3726\025\317\3736-U\372\265\nS\276\3463"
+	.string	"\006\327y\021B\320\271\213\216\204\202\251F\353\002\346\313\267\370\210\310\354\226>\276\364\311Yp\t@\017\034"
+	.string	"\323#\360\375\241\2417\360\335\004\r\214\001\370"
+	.ascii	"CK\341\220C\221&sk(\003bf3_A'\225@\327X(C \256\211\3456\261\203"
+	.ascii	"\006U\"\236\311\004\b\212\200q`\230\317h\325\3636\315F\363\b"
+	.ascii	"j\017"
+	.text
+	.section	.gnu.lto_gyroSetTargetLooptime.part.0.115.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"m\n"
+	.string	"\346\322D< \345*\035\240\220#\201\2114\004\3042\034\355\f\204\312\3340aq\b\213\260@\030G\367\021\306\361\217Y\022!R\242t/B"
+	.string	"\"\001\200Q\232,\tD\t\245\020\332\317\2106\331;\2451"
+	.string	"3"
+	.string	"4"
+	.string	">aX\264e\037=V\023bQ\021\233\355n=\235\035\027?\345&\372\037/\240Z\241>\007V\031\227\005\337\002\026v\327\234\306Mo\273c\333c_!\264\335\213\032m9h\013\310a\267Or\362Gg`\346tN\177\231\244fQ\001\020N=\245\315\351\210\177\231<w7TXv\307\204So\270\323\314\351G\354\256\330\355\320SPf\376\bc\177?\031\021\274\354\256\307/\271I\350\177\234:\242$\257:\365K\230\323\t\326\212\b\200\224\254\311\351\362\334\276\355l\331\233d\035\004\241\317\0031<t\"\316\237\r\251\363\272\206\017\224\200\250!\370\205\036(\254^\347\020\252\0370\254\033\003\177\"\020XI\337\007\326\214m\371mg\313\234\f\346\222\232\024\236s\006\027"
+	.string	"<+0\036\320\300f\224L0`\334S\034\240\335\250J@@\024\fs\205S4!\364\350\202\020\037;\343\025uC\247-\233y;-"
+	.ascii	"\327^L9-\247_[\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\342\004\235\022"
+	.string	"\006\\jH\320Vi:\220\233\330\030\032\265\025\310\334\314,\213\2566\261\027\201=\210\306N\n\342\013\276\013\213\006S\342\267\302\013G@\341\n\033g\234q\306%\220\360\376\343xcZ\276\376\307s\307\236\005T\204X\263\215\255\233\020\271e\nT"
+	.string	"Z"
+	.string	"U"
+	.string	"=\303R\303\260F\204\376RO+\200\320\t\350\203^Q\236\206\241;\375\037;\003\212\017\032:\375Bs\372E8\315\263\377iE\252\377\312\351\240w6\312M\307\330<\b\237\3479\245\246e|"
+	.string	"\344d\377\265\032\206\343\216\277\377\243q\261Zk\245i\027\372?s\005\037\242\242O$E\277\b\212~\222\023}%&\372BJ\364\215H\364\311\021} ;\236\"Z'D\237hG\020\375\326~h\034\352\241oh\207\266\341\3205\033\276$\323\3204\031\272\001\305\360\243\325\215d\374\257Ht\241%\263\360#\331R\205f@\241\027H\231\320\bh8\362\220\020@\230\307='\024\377\354\235\b\r\3358pbU\313\2115S#5\221\\\361G\325\261j1\003\035\307q\274\231\313\265V\031\004L\274\211\273\005L\274\341M\f\006\r\300\2703\367%\253\034Z\301X3\227\226\254\222\305\202\261\213~\351\323Oj\321G\302\242\217\264\242\003_qF"
+	.string	"\257\271\230L"
+	.string	"\336^KS*\334\344\236\314a\244\024\003r\214\360\003\031\006\271\177R\344RZ\201\374\242\265gb\243\211\353\003\031\024B\2014\251\207\016\034(\220\273\362\303<\321\345c\316|\371X\013\202\371\330\013;\217S/\352q\252\305y\334\001\231<\336^ZT\250A\030\005QNd\202\322\024\226\213\001\320\002!#j\003\021\200\030\314\030\206\004\304\220@d\204f\350\001 \357\025\216\267$\357-\022\204\013-\214\026\002=\233\007\034\362\215\375\214M\233\377\242\301\3173\306?\317\013\352#cx#\300\022]\n\210\371\225\221\214\366\342tM\020hU$\350\324'\3465\024RT\3378\206\356\202[\377\023R?\006\356\f-\t\352Ks\t\025\206\334\313\234\255'\232\337Z\230\025\333x\341\365\207\003b\305\213\355\034\201\335\344m*\033I\244\316\3216!\335\035I\224\005D"
+	.ascii	"\245a`iD\210U"
+	.text
+	.section	.gnu.lto_.refs.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\230\001-\f"
+	.string	"vU>6`M\222\306C\351\276\201m\245\347\"\b\340\316\313\251R:"
+	.string	""
+	.string	"\200PA\020\004A\020$\204\205r\324\210\006\267.\032\2555\262[\263\255\221\326\b!\215\020B\244L)'"
+	.string	"+"
+	.string	","
+	.ascii	"\2215\212\314\350\3351\377\307\243\005dR\036\247\331\2048\326"
+	.ascii	"@Ro\344\024\362N\257\364>\336\347\275\323O\213|]\215A\025\215"
+	.ascii	" \347)fHMN\314\251\345\264rZq:\231N\245\025:u$\020\355)s\222"
+	.ascii	"\366\261\t\355\243\315m\3326I\244Gj3:Xm\260.\270U\260&x\021\274"
+	.ascii	"\007V\003\267\005\226\022X;`)Febl\nX{\2614S\231\231\315\313["
+	.ascii	"\235\256\247\254\225\004^X4\231\363\fpR\266\016`L\343\313\313"
+	.ascii	"\232\002\305\t\023%H\214\350\350\020\021\002\004\007\307\007"
+	.ascii	"\017\0358l\320\220ac\003\303\005\313j\241\002\205\t\032\225\251"
+	.ascii	"\306\246\022\"\334\n\341A\306\332? \220\202\241*\242\007\006"
+	.ascii	"\022\021))\210\004P\200cL\330\255\001\205,-\247\036\fW {.\353"
+	.ascii	"\n\270',\363\no\017]v\271\002\357%YVk\005\336\373/k\205=\226"
+	.ascii	"\261\302\036\313\260\262\336\233\255r\317t\331\261\302\353e["
+	.ascii	"\231\335\253\332\353@\023\301$\bA\001 \024\210A\371\020\224\214"
+	.ascii	"@\326\004\354\303\260V\345`~\237O\205\r\303\237\262M ?q\323\330"
+	.ascii	"\265\035\205us\335\317W\270\225\327\201?|\363\fC\001"
+	.text
+	.section	.gnu.lto_.decls.7f4ec07e4795bed6,"e",@progbits
+	.string	"(\265/\375`\270iU\262\001z\300\276\232V LI:\215\001\334\326x\030f\242\242B\214"
+	.string	"\200\242\" \212\332 W&D\304\234\214\322\210"
+	.ascii	"\004@U\007\2231[\331\2254a\333\212a\3074:c\233Bv\2732\310b{\035"
+	.ascii	"\373\236Z\246V\247Ieu\2332_\256\352\363\024|\255g\331&\367\336"
+	.ascii	"RJ\231\002c\b\257\t\335\tj\232{+\217\243D\204\200{`\0266\315"
+	.ascii	"\322]\221\200\344\016\277\250\302VMa\2221\346\222`0\260\325\016"
+	.ascii	"p\357\246-I\334\003\313\300V\226N-\203\311\3312\270\007na\327"
+	.ascii	"v\316\275\263\310$\367V\342\027\307=0\025\236\332yR\356\2524"
+	.ascii	"J\225\227\232fN\324\231\"S\026\344\003\217\350\274f}\320\003"
+	.ascii	"\265\364\2017\364\201V\372\300'}\315\247\261\325\217\221\326"
+	.ascii	"\355mw\213\031\254\346\315\327x:\207\213\366\300\372\240\036"
+	.ascii	"\260\024\360I\311\223\3234\203\215\313\315\327W\364\265\023}"
+	.ascii	"m\246\257\277\264\007^z\004.}5\215\245}t\f}\035\245o\322\372"
+	.ascii	"\240\327L\332Gi\177\320+f}P\324\315\372\240i\260\232RJ\324\315"
+	.ascii	"\315\215\271\030\271a\345\346\247}\267\357\362\241H\362\234\220"
+	.ascii	"7?-\243\237\322i`\nE?M\242\201\310\264\207\276\301+s\255j\244"
+	.ascii	"u\335|\327\001"
+	.string	"u\341\344\206\335\315Oa\210\271c\354\362\222\271vd\356\334\005c\351\324Px#s\311\3340\227m\347I\271\231p\246\224}\314\346\336\273\303\207\017;]ZzWh>\nF\037}\323_\2002`gF\343\346\243i\372\026\216\213Y\262\313\335\222\204\351\345\326\331\345\355r\351\236\225{\253\001\307v\210A\241\371\350R\037\025\323G\213\350\243[\372h\f}\203\264>\350\321\255\177\236\3218{\213\306a\276\351\234]\246\177r\351\034\3469C\353\334#\277m\377-r\277.\333\215A\213\232\253\233\243\350(?\266\302n\376\271B\227aa\336=v\303\255L\314,K\020\031\226$\330\222\271,f`X\254[\330\333,\235\232MV\311\302\334{#y\333\016p\357+dn{\357\377W\355\246\335'\027\312er\235\334\265\213v\233\330\345]^%\277\312{\366\034t\2277\311\333v\236\224\033\310\003\260\330\250\322\334{\177"
+	.string	"\372\200s\345\026\025fC\376\371\244o\226\375A9\330\323\317z\3729O?\337\351g1\372\031\214~\256\323\317t\372YNk`}P\333$\350\367\bv\253\002\345w\363s\024\215\336Y\037T\207nL\357\344\036\272g[\037\324\013\350JQ\306`\344\346\347\032\372\037X2k\222f\227\207M\333a\352\331Nul\222{+\377_\037\267\307\375qc\270\\vy\273\356\326-\030k\367\020~+\246\313\216\361\263w]6\357F\215"
+	.string	"\205TaK\r\263\353\266\270Z#@!UpJ\303\334{\177\370"
+	.string	"\364\341\303\007MC\211\215\274\234\374L\245\237\231\364o\315\330\273\313\342\356\310\311\342\200\223Fy\266\354{B\277\332D\301\335\374\377b\335\034\027\307\325a\2277\313\356\375R]\344S\326}\3612Puq\037\374wgY\275{\303\005\332\334u\221u\245\322&[r7\353N\3315\254t\323+\320\2640?|\260l\2540\267\334\344k\003\330d\nL\233\233\217\231\267\306\275\3029r\346\214\333\245\361{\325\246S6\007#\352\346[ug4\221a#\343\346+\003\310\267\274Brs\214\215\023V\366\026\343\346c\273\013\343Z\345\254\360QeN\177\357m\377\201\366\b\333\330\223\233\255\322\376\240@\326\007=\256\242\217\333\364\361\023}7\373\203\036\243it\233\371\215\372m\031\213wW\344d\355\375\264\367\346"
+	.ascii	"\034\"\343*\354\346\013\245\246\n\b\330\315\307C\364\377\353"
+	.ascii	"t\237\354\362\252\260\177\277\3732\035H\271\367\332\336\373\037"
+	.ascii	"\374AW\205\325\263mF\200B\002\251\234\356\230{+o\313\376\240"
+	.ascii	"_D\bW\305m\262iX\231\334NuR\032\020\003\225,:\232{+\201>|\270"
+	.ascii	"I\303\222B\206\346_?m\267\375A{\302X6\026\013\354H\326\315\277"
+	.ascii	"R\364\355\322\372\255I\233\316\270h\242\346v\315/\"\204\343\345"
+	.ascii	"\354]\266\367\306\340<\323\232\362v\263Ec\323\374\007\246a\313"
+	.ascii	"/\272\233\177\233\3066O:\0364\230\334\334\247L\361\300\314\372"
+	.ascii	"n\3765\323\377\355\322\362\331=\345\006\332\301\201dO\271\371"
+	.ascii	"\327K\3333g\373\017\344\241\342\262\222q\363\367N\345?0\313\220"
+	.ascii	"B&w\363\357\226\266\314\240[3>(\362J\271\325\366\336<$x\361@"
+	.ascii	"r3\276\241\363\266?\350\225\326\007=\235\365A\177\221\372\367"
+	.ascii	"I[\246\276Q\332\037\324vY\0374C\226\365Ao\351\364m\025}\253\246"
+	.ascii	"\201\354\017z+D\333\271k\345\354\226\3339\253\345\"Bx\316\223"
+	.ascii	"\235\313{7Y\273\301\216\265\033\234T\2024\241\241\371\266K\337"
+	.ascii	"\302\320\036\354\017j\257\244i\\x\341r\363K\240-\025[\305.\255"
+	.ascii	"\225\337\276Y\270\347%Y{\271\267R\0077\315\220k\273\371\326\003"
+	.ascii	"\312\363\367\367\367g=\240G\322\032\330\0374[\037\364\"\320\247"
+	.ascii	"\263?\3505\2405\270Y\037\364L\373\203Z'\366\211]v`\241\3346\261"
+	.ascii	"f?\233\224[\271\267\222\347z\261q\202v\363K\350\333\016P\374"
+	.ascii	"\367g;@o\202\276\326\007\265gv\211]f`\231\\D\b\307LKv\331\336"
+	.ascii	"J\036\2356cm\326\334\374\006\350[\264[\260d\207p\037}\233\001"
+	.ascii	"j\377l\006\350\257\326@g}\320\036\373\203\3766\311o\311l\231"
+	.ascii	"\007\034%\225\265\325\366Vf\320I\003\306I\354\346+\355\017\252"
+	.ascii	"\255\017\312\304\312\027^Q\304#o\375w\341L4\216\016\254\377\376"
+	.ascii	"\270a~[\365\201\377\030\334\205\333&\3779\374\332\346\370/\326"
+	.ascii	"o\233\031G\232l\343\277R\377\025\341LN\300|\031\376\264\314\217"
+	.ascii	"\257\344\032\377Us\345\016%W\255\340\202\225!y\351\226?k\340"
+	.ascii	"\317W4\376;\346\2776\376\313\346"
+	.string	"\232\371\261\375\357\217\334\001\030J\200\267\344\031\377\235\302R\376,\003K\345\030?>!\303\370\361\377_\371\361\007\377\025\363c\003\374\030\304\217\253\262U\256\372\361\371\337\274\377\372\375\030m\300\217Q\340\202\265\202\225\376W\311\310/\026\370S(\267\177\312\004\247e)\027o;\177\312\365\347\020\376+\327\342\277\030\270,\374\227kr\234?\245\372\257\214\377N\345\022X\374\267\306\177\177\374w\003\377\275qg\344\tD\375W\353\277[?V\300\177\203 \340\277]\277\325\362c\365\317+\376\\\002\352\307\304?\253\370/\327o\341\376\353\003#\335\035\377\205\373\357\020,\302\217Q`\255\374w\201\003\377\013\220\237\376\334\364\3330'\234\204?=\373\361\222\314\364\343\033y3\340\307\036~L\226S\360c\022~|\200\3776\177\374\200\037{\360c\374c\036\031\0058\002\030tp(7\300\237\206\375\367\314\217!\360\3376\367\356?\023\274"
+	.string	"\354\200?\237\340\307T\331\004\3771\370_\200\373\374\351\002.\231\234KP&\007\375y\265H0\374\227\257"
+	.ascii	"\177^\262\007H\361[\240g\360\247+\376|\203\342\267Fa\231\347"
+	.ascii	"\304o\207\277U\177{\224\225\362z\371\376\313\374\361\212\274"
+	.ascii	"!)\037\377{ \033\363\021\024\256\177\370\323\n\340\374E\311\364"
+	.ascii	"g\f~\354D\202\337\226\260*\344\rI\271\370c\032\231h\201\376["
+	.ascii	"\346\267\026d\244\253\220\217\256\301\237.\375W\r\206\312#\370"
+	.ascii	"\337\301\237\207\370\3527\177\032\364g\243?\013\375"
+	.string	"\271\003\177\336\300\237U\3703\211?K\340\317#\374Y\204?\213\370s\007\177\016\300\2373\370\363\317\237{\376\214\363\347\363\317\377\261\337\217\371~l\346\307V~\234\367\343\273\037\217\371\261\335\217\277\374\270\313\217\351~\034\367c,?~\373q\223\037\243\375X\371c\263\037\227\3758\354\307C~\334\343\307\\?\306\3721\216\037_\375\270\352\267c\376\253\360_\017\3748\351\277\334o\261\374\326\202\037S\375\030\352\307S?\216\372/\225\377\332\375\267\312\177\373~[\344\277\177\377\325\373/\336\217\363oU\370/\231\337\"\3758\375o\335\217W\374\366"
+	.ascii	"?v\372\361\376\317\344\307(\370\257\334\177\027\376C\371\261"
+	.ascii	"\t~|\202\037\227\340\307(~|\342\177\211\037\037\177l\3741\t~"
+	.ascii	"\214\302\217O\3701\211\037O\340\307#~l\302\217%\360\343\233\037"
+	.ascii	"\003\377\227\3757\361?\356\377\206\277\277\277\277\037\030\343"
+	.ascii	"\367a\372K\300\b'\233s\314I\346\364\202F\235g\316\275\323\016"
+	.ascii	"u:\325\240*N0g\336\211\207\356\263\357\274;\315\234zg\363\fs"
+	.ascii	"\2469\371\316/\247\030\224\005\332\204>\235k\3166vy\372\235\\"
+	.ascii	"~v9\353\374\316-\347\334\027]\037\263\3716E\216\371\342\212\235"
+	.ascii	"\303\312d\232\266\025d\215\337m\203\277\360\031\222\002hcy\314"
+	.ascii	"$\030\026e\037\263y\211\030\271mV\036$\331}\314\246\0225\273"
+	.ascii	"f\351\272v\023\323\bR\334\356\220\233\274@F\200BR\240\216\f\232"
+	.ascii	"\275\253f\004($\260\205\223\2313aY\342\354\034\007J\230X\262"
+	.ascii	"\\\301\0227\306\354c6\335"
+	.string	"\244HI\232\321\273xjL6\2775L6?[\247\354c\336\355w\306\035\311\352c\226\361\303`\247\225\021\240\220\024@\033\342v\372])\267\r\237!+\340\264\345Z\361\273W\356\r\255\021\310\262\372\230M0\2773\313\221d\037\363\313O?\033\346\002A@\0227\274\004\n\033?\013d;Ci\177P\ra\254\017z\0161\3649\254\320\257\240\251O9 \23039\324n~\005y\372\025\320\351W`E\277\002(\372\025\234\351W\340C\237V~l\004\0379\253\344X\275I\241\271\231\n\223G\323\226\233_\001\016}\276a\26139\002\024\362\204\272\253\363\3554rJ\301g\310\n\324\325\200;\247\330\345\371v\022\371Y\344\374:\020P\352b\006\326\022\315n8Y\354\244r\334\374\nZ\3502\347\332\t%3mI\255\235a\247\032>C\236\260\345\202y\256\235N\260UPV\037S\254\355d;\243\330\345\271v>\371"
+	.string	"$"
+	.string	"\267\244R\347\377\250\321\377\t\243\377\343E\253\375\347\221\023\354lr\263\342\224\\\271\335\234v\343\347t\206\310\315\377\321\242\377\001\031\222\026u.\224\234\n>C\352\264-)f\331\330\211v*\317%\347\362db\227\347\331Y\3663\311i\346v\236\235boS\261D"
+	.ascii	"\021\")V\227+n9\371?W\264\315\262?\350\0067\375\037'\372?K\364"
+	.ascii	"\177\310\364\177\214\350\377$5\246\263?(\t<4\220\322\376\240"
+	.ascii	"8\312\372\240\377\241\241\233<S\304\374\204\334\234\235\236\264"
+	.ascii	"\254\030:\233\326\200\"vob\230Mn\262tjE\354\336\232]\254V\274"
+	.ascii	"\r\237!+\200\252S\302\334{c\2730\230\314\230\236\335[\363)\016"
+	.ascii	"\313\315%\267,\271;\255\262\nl\205\251T\301S`p\220\304\312\212"
+	.ascii	"\301u\030\214\025\002\310\232\354\336\2326J\222&\27371$?&+\263"
+	.ascii	"s\020\260\262{\023\333[y\233\205\213\235\343\200L\313\356\255"
+	.ascii	"i\3572\024\236\252\032a\254\311\356\255\211\225\234V\370\f?I"
+	.ascii	"\322\305\356\255\211\355\360\035N\203\317\220\300\027hlL\374"
+	.ascii	"\242In#!lI\b\377\375;\255N\027\247\224\245\273\332\273\n\004"
+	.ascii	"%E\354\336\232`Ur\234\226\335[\323z\301k?\255p\024<\005\237!"
+	.ascii	"U\330\032\303\304sovoM\267Le\013\001aE\260\022(d\254\030KG\246"
+	.ascii	"\247\264\312sg\013\020\302\232\354\336\232\247\025\036\333Lf"
+	.ascii	"@P\242e\367vZe\261\234V\227$\307\031\343\334:y\234Tg\326y\343"
+	.ascii	"\244q\3328c8_\2343N\037g\215\263\353\024rj\235@N\256\363\307"
+	.ascii	"\251\343\254:\221g\220s\310\331\343\334qz\235S'\214\023\353\274"
+	.ascii	":q\2342\354\362\264\272|f?\266S\203\325v\232z\366\223S\224\344"
+	.ascii	"\232\323\n\373a'\226\256k\357*\020\306\226\330\27551\331i\205"
+	.ascii	"\315\362\230V\314i\205\255\340,V\036$i\262{k\236V9*\207a\340"
+	.ascii	"\024\265\267\025\007a]\354\336\232{o\340\017\033}o$\362)\365"
+	.ascii	"[\246\345b\323\214Cj\244\335\374\r`\364\311"
+	.string	"\202\207G\217\246/7\177C\025\275%\203\301\312$\t\247\027L\025g\324\te\227\347\212\247sE\266\313kF\200B^\300i\212y\2568\237\256\005\003\247\250\335\264\303\003\"j\352f\344\264.,:t\376\206\033\3728\352L\007K\327\025\201\"P\340\232c\314\275\225kr\230\254\207\201S\224\005\256\254\355\235\312\016po-\265d\037\022>\017\226Nm\204[Y^\223\323\234\312\316S\317~\022\"\226\327d4\035v\232\224\033\211\372\370\241$\331<\231N\247\354w\356\334&\377\235M\231\215]\3465Y\315\231\306\244\271FC\276O\025}\2376}\237&\372>J\364}\300\364}\206\350\373\364\320\367\311af\215)\257\013\325\315\367\221\302\313yv\231\231y\214\230|\307\243L\222\231\313\344;\re\306\200Mib62h\230\240\371\032\240\350?\337e2m\222\344hss&\223\307\230\r\221\342q\3635|\351k"
+	.ascii	"\242\257\201K_\003\226\3763\227g0\177\326\222\345\362\027\021"
+	.ascii	"\234NX\304\255\2709\327e/\317_r\227\374\005\204\254\275\233\362"
+	.ascii	"\027\036\277\275\233x\254\335\300\332\r2\222\255!O\320|\r5t\246"
+	.ascii	"\013z\346\242\242K\312\352\346\016\254\017z\rV\372\032\246\364"
+	.ascii	"U\332\037\324\203\365As\226+\306#x;\372\260\\\301?\230b\222V"
+	.ascii	"\236\2570\221\201b\307\204\313S\336\200Gd8\271\313\002\367\006"
+	.ascii	"\004S\306\306'\345\371\r\357a\305\020\344\211\222+\031mp\231"
+	.ascii	"\315\032Y\223a,G\311kOi\226\314Ay^\373E\204`\347,\031^]\337\315"
+	.ascii	"\331I~\242\223TL*\236\334>\236+qml\250\001\315|\331\322\245\206"
+	.ascii	"\325\270\210\260\221\335\374\f^\272\f\b7y\032\273K\273\314L\362"
+	.ascii	"\230\032\223\214$\2439y\373\341\226\263Y\244\221\222\363\237"
+	.ascii	"\321\236\227\274x\301\214\2729\237\001\265\304\220\201\345\346"
+	.ascii	"\367\370\351?+\261\313\254\304\363\260\343\313\352\346\357e\263"
+	.ascii	"\377\300\333\343K\236\232\233\377l\366\234\004\271\233\324\270"
+	.ascii	"\271lWuYr\363{\306h\262<vw4y\251\272\371=v\372=T\364{\334\300"
+	.ascii	"\310$\241\221v\363{\226_\331\210]\346#y\352)\037\311,\262\224"
+	.ascii	"\0303G\362\213L\304\322]\365\354'<6\314\0176\255J\033=4ke!w\311"
+	.ascii	"d\036\222\213\330e&\362L$S\345\253\035\246\f{\307\340\227$\222"
+	.ascii	"k\344\254\235'\345\266B\363\230\3320;|\370\200#\305\225\203I"
+	.ascii	"\347\377\031H\016b\227YH\366\212!\377\260tW\312m\265\003eG\033"
+	.ascii	"f\263LH\336\312\\\0308E\2410\205\fS\303\375\230\342\003\315\357"
+	.ascii	"\021\323\177\376\341\203E\333\227]\217\334u#\343\212n\312\315"
+	.ascii	"\357\001\242{\334\276 \242\"\356\346\367l\351\333\345\313d\036"
+	.ascii	"\307\313^Zf$\271\371="
+	.ascii	"X\372=4\364{`\350\177\220\263\262\215\234\303\322\251"
+	.string	"\215\230\303\313:\362\016\273\314Y\031K-ged\226<\346\316\220/\262$h~\317\n\235\303\236\232\310e\034\371\306\326\321\301\313A\305\310\315\347a\243\317\303\247\317\243\247\377\347\031\231\206]\346\253,#_\345\252\034\003\003\247\250\024\260\324\344\253\214\264i8C\210\264a\246<\336\224\374@\363y\232\350?\307\3100jDE\361;\255\\y\t\222\255\362\324\230\026\033\357\346\363(\365y\304\364y\206\350\363\304\240\317c#\273h\242e&v\363y\220\271\005O\224>\317\223\376N\033\375\035<\375\235/\372;r\372\314\334\224\231\256\233\037\324\214\233q\033\374g\227\247\222\267\017+L>n\376\016\025\235b\357\275\355\251\240\351\251\240\337Y\242\277\023\246\355\216\227n\362\300\310\321$\352\346\357\314\320\377\300\t\347\3413\244~\322c\b\023\357\341>\273\304|\230\211\371\260\031\214\306\322\251\355&\030\034\3641\345\2115\367V~"
+	.string	"\372\240\363\244\271f\006\232\365\360\031\036\027AVx]\321\213\242\257#V\006\343]+&?\200\224\251\241\305\3401\266\216O\r\213\233\257\323B\214\316\326\026i}P/\370\013V\262a\351r\363s\364\274\344\200\321\317\321\242\237\303\246\237s\246\237#D?\007Kc-y\206\034\227\220\233\2373C?'\nc\341\241\023R\205\355\346\343\244\301Wp\356\364q\344\264MZ\037\024\316\032Q\241\304\310\315\307q\"\305.\361\033f\303o\270\r\273Y:\265\275\253\0200VEV\326\334{\003}\2607\342\234\266d7l\345&\306\352\310\315\307\001\242\217s\245\217\023\245\255[\237\306O~\374\002+\261\223\234f\026#`7;\371\361\022Ga5\233ZM9{\273\0313\301iv\331\0017\331<V\257\313\251\352\346\337\344i\024\354m;\240\366\357\317v@Q\353\203\342%A\307h"
+	.ascii	"\210BE\312\315i\235\306\333\376\240\226i}\320\337P"
+	.string	"\321\277i\242\177C\246o\323\376\240\277\361\322\277\331\322\"\202\216\303P\261);\322\334\374\233+\035\264\355\017\212\"\255\017Z$\254j\213\353\346\337\270\320\267Y\200\264\371\303C0\223\037\023\023\301Bp\022\007\261K<\004{\375\372]6\177C\360f3\004;\341\037;TD\274\3244\361\223\2540\313\233|\340\237>P\017\377\370\357\037n\302>n\\\240e\361\270\271\353\204\222\222b\273\371\300-\372?\326\3021`\036x\007\306\201\271\360\r\234\205\261\260\016\234\003o\331%\356\201i\034_\341\032e*\270x\251i\226q\201\247,\235\332\210\2621L\250\025e\230{+g`+\224\314\331>~\262a\347v\230\224\233\n\rb\306+i7k%6\255\251\207F\344fM\246\315r\312\224\021\3413KR\206N\354\b\034\260J\333\236\030]\206\331\362\022\311\023;\016\270\304\304\362\333\006?)%hl\225\2731\310\233?"
+	.string	"2F\214h0\240,|'e\006v\005\207\257\305\231\250#\327`xuJ\300\204\031\200\322\207\017]\204\213\005\252&\r\255I\344\272H\3526\345\n\335\315:\251\271\206J\222m7\353!\367\006\032><,7k!/S\346\244\343\352\346\357\351 s[uN7\353\037\332\313.\037\247\201\\\311\263\363\266\302I\334\315\037\300\230\276}\034\232\002\3738\364\003\340\322;\364\016\335\203I\224\215*M}v\305\311\226\030\256{\250\201!Gw\263\326\322\\\030\354H\024*\315\245y\354\246,l\274\266\366\362!D\214\336\272[\232,\f\211\325"
+	.string	"d\350\320q\203\271\367\225\207\033\037<\306P\271\371\003PA\203\206\316\001\244w\022\264)&nB\306\254\017\307u\016\235\034X\313\273\233\365\215\006<\305}\271Y\333\320\241S\316\230\272Y\3278\347\200p\231\315\270Y_\245:\236\370\355\245Ow\331\205\214\016\215\225\225\226\001\244w\222\272.\246\016\\\222.ib\\\313h\313;\302\324\350q\263\206\3616\266\2630^\002"
+	.string	"\243\247\364\224F\372\300\351\201\003\314\013Mu\215\304\343\021k\003E\306\315\372\205"
+	.string	"\256\350\025z\205v\201&\245\233<\301qC\267\270v\261D*K\232\2335\213\364\b\217\025\026J\330\334\254\243\336\226\257,\211\302\024\300R7\351&\255\202\2040\271\244\336\212\023\342\247\237\256U\330\264T\007\2230S7k'\233F&/\356\355\253M\033\275Sx\t#\303\2111V\347$\375\273\336X\r\004.`\b\240G\363\315\324\357f\355\275\241\366\022\2320!\314\013fM\315\210\337\032\236]\244\013\327\0325yT\314\263\346\032\262\276\034i0\323\t\026\02047_"
+	.string	"\3103gR> \350\036\f\340X\023\255\216/\335K\302e\326\266\227\242\311\351Rf\313\023\260/',<n\276"
+	.ascii	"\232\364\237\2321\003\307\354c\236j\336\264\354n\376\006yx\307"
+	.ascii	"K\363n\221BP3N:ySnTy\251\225\236\214\251\256\233\277\001\026"
+	.ascii	"\375\247w\313\364\016]\003\224\265\2556\260\222\362\342\263V"
+	.ascii	"\364\210\314\335\374\r\274\364\32306\035c\227\351\230\324\n"
+	.string	"\205\335\004\003\204#g\364\334\232\033\251<\3007\270\322\267\251\025\372\247v\313\324\316\246\001e1\351i\240'\325\303\257\271\367\225\003d6y`|\334|\r\320h/^\322/v\357=TG\335\032\\\323\323\315_\210|mI\221\351\322%ECs\324\341\360p\243\364\314\330\334|\r\266\310\311\245t6\007\\~cRfuS\272\2342!T3nN\3474p\213\213K\301\225\007\324\305\235\r47_\003\345\224\364\312\224\024\013\272\267UfQ!\261P\241\222Z\261\033\311\207\232\201\273\362`iXq{R\345\251\2257%\215\264\377\300s\213\357\256\355\346k\360C_\203)'w\222\276\275g\357\355\2647\026\016T\306\226\224\247osLh\372\276nN\243\244n\300\345\027\0279\267\264\315\005\234\n,T\244,\031[\262\235D\232\264l\360\245ki\2144Z\320\244k)\224\036?\304\2120\225:\340\272<A\251"
+	.string	"o\240\361\311\335\374"
+	.string	"\3701a\2226\261\016 C\323sk\246iO\233\340,8UX<\271j\2246b\334\374"
+	.string	"\230Y\362%)\232\336{3)7\225\022\232\236\233\330\367\236\242u1\"\344\211\026\2452I]"
+	.string	"\232\230\231\245a6r\354\230e\354n~"
+	.string	"\216\214\215\245e \214\235!{Z\206\223M1\306\334\234\"\311\"B$\r\253\201\003\006g'%\005{\032\226\023\325\264\227\344\346\264Hzd\313\211\230\031GR#Rxt5E\311\361\273\241g\367u\225`#ZH\350\002\340\302\307}\244Cl\217\322\251\316+\271\367\225\207\2356b\342v*\344\351\220\033&~\\w7\247?\322 \377\20190v4\333\202\244@\210\004yA\343\313\036\031\236\323\315\251\327\245+\363\"\317\357\346\003\300O\367\350q\257\354\222Me\353Z\\y8e\220A\215\271\313\312J\271\254\031\017\254\360x\312\325\364c\315\352\346tk\007\017\207\027'7\247Z\247\002#\013\316\307\315\351\216\233\2659$dn\376\3369\367\037\210\316Q\371\251\271\371"
+	.string	"\200\323\177\212u\273L\261R\244\207\254m\005\302\236\262\217\251Y\324qA9\263a#\305a\323\324\221eIa>\275\201\327\305J\314\276\371"
+	.ascii	"H\352\2470\322\030Oe<\225\221^\001\367\336\373j3\351q\020\006"
+	.ascii	"C\317\255\271\257\220\036\376\224\306\323\253"
+	.ascii	"\265\250\246)WnNg\210\340J\235\226]S\362u\025\303\315\317\200"
+	.ascii	"\251\177\373\373\243\273\t\271\367\266:\225\033\351\224\203\376"
+	.ascii	"\366\366\264\326\303\257c\261\025\300\377\374\022\024)\367\n"
+	.ascii	"9\277\275\267E\243\277\332\232nh\260\377\337\303\336Lv\357\215"
+	.ascii	"\214Zj1e\210Z6\355(&tU\031\242\226ZUQ\312\275\203\303^\362\330"
+	.ascii	"Q\312,\246\234\305\264\367f\272[\271\237\264\252\366S\026SR\224"
+	.ascii	"r#\2672\213\251g?U\365D)\233\230\242\226ZU6j\231U\025\265\314"
+	.ascii	"\252\312\260\2376\323~j\332\241\237\262\252\242\264dU\365D-\233"
+	.ascii	"\252\242\236\264\252\2542k[.pJ-&\250\275l\322\331{K)\223L9{7"
+	.ascii	"!7S\227;\265\265\230S\033k[\2721%\217\2757\223Z\230\255,\240"
+	.ascii	"\322i\323E\031\3112\202\332;\314\236\002\201\3112)\367\336+\266"
+	.ascii	"\023\223\335\033J\211\334\333)K\004W{\357\235e\275\254@n\235"
+	.ascii	"\375\324$\345\264\225\225\003\345\224\265b\033\331a\367\336\273"
+	.ascii	"*j\271\225\025$%m\231\334NJ&\033%\225\265\223;\214\026R/\231"
+	.ascii	"\354\031\235\245\327\225TZ\005tKj\355\335\374\f\236\350\224*"
+	.ascii	"\005k\343e\354\346g\220D\377i\013\273L[\244Sw\311f\332!\263\005"
+	.ascii	"\006\t\264k\223d\354\346t\352O]\244R)\013\253eL\024\255\233-"
+	.ascii	"\235\375A1\260>\3503\310\3229yr\311\030*n\227\251\212t\005\216"
+	.ascii	"\312\332U$\300\321]\035 \247\211\013,\345\315)\224\212\253&Q"
+	.ascii	"n~\0065\3643\210\221:\231!Sc\353\346g\300\2246\245L\351\276\321"
+	.ascii	"\3246\344\346+\226C\214\223\233\225eTT^YmP6\3001.+8\330$q\240"
+	.ascii	"\374\220\n\342\207\256\271c\270\330T\2449\272\346G\325\330,\326"
+	.ascii	"\312\212\326\220\233O\353\203\332\267\240\243i2\017>\252\"Mk"
+	.ascii	"\245\217\357\005\033W\311\233Q>to\231\266\306t\3631\270\323?"
+	.ascii	"\212&c9qPq\231:#F\317L\213>0"
+	.string	"l73\225O;\300\252\244\335|\f\260\350\33321\250\025\364\213\245\353\312smL\250'lpQl\032\024.lX\356\t\332\346$\231Y\330\264\035\2747\226Z2\017\305C\301\240a\3202\350\035J\006\035\203\332\331%*\006\245r\264\212\215\222em\215\351\206N\261tW$\210)a\006\241bP(X.\365\001\007\006\331\334[i\263\220\324um\310^p\02299\"7\037\003!\372?\332\005\345b\227h\035\212\345\350\226\235\246\236\275\177\3401\321:\364JF\"\206\211~\235i\253B\363\255Y\334]\022\235C\351P9\273D\267\374f\301je\222\350\026T\013V\273\t\362\325%\t\364\341\203\321\214k\215\316\307\300I\377\0026\372\027\244\321\277\300N\377\202:\375\013\340\364\216\365A\177\201R\243R\3207\273\004B\341\2728\275\300q\363/\030\323)\330\026\b\375\237\005B\177\301\227\376\005@\364/\340\322\277"
+	.string	"K\377\002\030\372\027\270\320\277\200I\377\250\023;\227\222U\331RS;\253\240]P\\\300\232\340+'Z\026$Mi\2775Z\300x\372B\231\334\330\271Rc\206\3272\003\036\345\214)\036h\350\021\"`OT7\377\203\033X\215K\rs\007\231\244\033\f*\346\276\372\213a\327^$\313t\340m\033k\2309\232\314\273k\264I~\221KJ\371Hb.a\356\266\252\301\024C\207\240F\320.\364\013M\242`\250\0225C\205\240^h\021T\t\212\004-C\227\240>P2\024\b\232\004%\202\236\241?\32004\b:f\227\350\021\224\353h\fh\217_\345\336O\027\354\005\326\005C\336`\336M\203E\326\035\263\312\246\331\331\270`S=\272d4\221bna1\311c\336=\003\253\255h\221\264\\\376 \364\b\252\305%\206\031\204\303\256\251H\223\334[\211\036A\251\316(\373\230\037>"
+	.string	"\321\241\221A\211\220\257\233\375A?X\037\364\026\240\321\267"
+	.ascii	"N\337\2023}\013\216\350[\300\245oA\f\375\016\177\372\035\300"
+	.ascii	"\350w\220\242\337AL\277C\227~\007\033\372\035\242\364\201\366"
+	.ascii	"\364\201\352\364\201\334\364\201\304\364\201x\350\003!\3659\374"
+	.ascii	"\351s\260\323\347\020\247\317\341\211>\207/}\016\\\372\034n\350"
+	.ascii	"\037u\321\201~\202\203Rv\363\217\266\260b&\247\343\346\374\204"
+	.ascii	"\354c6\203\\!\312>f\323*Q\302!\341\350\350\250T!K\3661\233eZ"
+	.ascii	"\230opt}~y\305\031\002\216\354>f\323\262\331)\026\013\f\020\244"
+	.ascii	"l-r\027oL\331\307lF\371-[\233]\303\200\262\217)v\322}\271\365"
+	.ascii	"1\233"
+	.string	"\\\272\270\3651\233\350\212\023\315\371w\226A\231N&\n\025\252\320\360\204:bI\002?\302\342\021\321\251\224\204tt$\0242Z\205H!P\024\215Fk\221\230\022\t\325\243\274\036\211E\241\223h%\016\215Gh\210\013J\\\200\205\025&0\001u\035\032Q\340\254Cb\nF\022,hp#\020B\304\245c\007\253\332\302\215@\f\031\205E\023\034\264`\301\215@\250/\b\211\202\037\324\027\204D;7\002!\024T\221\206+Q\311\030B\210hU[\270Y\203*\f\303#:4T\302:$\246\300\203\201U=\201\247\2078\024\236\260\016\211)\350\220X\301\307\250\256\307a\221\312\302\220P\3559&\215(qT\222\200\016R\221\250\216H*\026-04\\A=1\\\205\204\032NX\325\242\237\033\201\310\3408\244\016\361\024)\231P\207B\f\035\r\225L\250C\305\022\300uHLaHLA5\256\200\263s\344\371\361"
+	.string	"\304j\024&\201paU[h\241\347\346(\"\210\304\210\r$\216\216\224\210<DI\026X\207\304\0242\254Cb\n=\017"
+	.ascii	"\f(\030\t\255E\025\206\324\365\2504\202\241\022\326\343P\211"
+	.ascii	"\004K*\250\253\360HI\350H(\024\200\013\r\215*Q-\322\007A\204"
+	.ascii	"\004\2100B\212t]\022\032\215% \251\353q\251\005\f\326\242q\251"
+	.ascii	"(kP\203\307\"\341\021\211\365\204:T\224\004\264\336\b\304JT\221"
+	.ascii	"\216\216\212\306l$\264\016\223N\024\302%\254\024\314\200Bh\304"
+	.ascii	"% \025\327\243\222\020\017z\036\225$0L:\242EB\027\210G!\364\250"
+	.ascii	"$\001!\021\303\022\204D\fo\324"
+	.string	"\024x\f\026\r\211\210E\023\\X\211*\222z\242XB\203\243R\260\270\006a0\342\201\301\250'(HD\020\006\243\r\"\202DD\305UIh%*\036\201P\b\227\202\253z$\"*\362\274 \244\032\t\351dP\223\226\326`p\311\250\236(\n\251\306\fCGE\243\243j4Z\203(\204K\032\224Fp\b\022%\035\005\215\202)\204+Q\0252\252IA\243uh\210\202\003\tp`0\n\022\207H\301 qi\250\3478L!\f\026)\231P\207*\030R\217E\242!Q\020]\325\"\243p\335Y\203\">P\221\206kR\261h\201\035\"\023F\224p\304ARj\001HDQ\034\342\260\256E\304!q(DRY8\252GBKB<\307\240\tE\343RQ\006$\245#^\211A$|\f\236P\207\326cZ\242D\013CG\305 \022\332\002\n\225\030DB\215\302\023\330hbx$\024\3029\006sn\004\202"
+	.ascii	"F\365\350hH\242H4$\272Yy\202\351\215@\254BJ\306\365(\342\030"
+	.ascii	"L\241\256JH\031^\020*\036\005\203\350JT*\n\005\203\251Q%\242"
+	.ascii	"(\006\203\351\321\250\036\225\210\301\240\036\"\016_\b\006\321"
+	.ascii	"#"
+	.ascii	"q\230t\f\006Sbqx\034\036\251\301 p\r\256\307\341Q\317\215@\034"
+	.ascii	"\325\244\2455\001C\252QhtL@\210\343:4\021B\211X\224\200\024J"
+	.ascii	"\304\341Q\002@\020!(\302\b)B\250CJGB\304a"
+	.string	"\b\343Q)\304\002\326\024*\361HH4\252+q\030\034\022\252F\2435)\030\344pB5&\005\203\350z\034\036\005\203\250p\025\016\005\203\250Qh$\224U\030\206\307`\020}A\250x\224\327!1\205uH\034\376\020I\f\tU#j\\W\020\"*\221\020\256\302\021CB\225\205\242q\351\204\016D\022:7\0021\\S\250F\365h\210(Da\270\246P}V\"\321=\006\205T\026^\020\022\2328:\022\2320\\S\250\031\206k\n5\257\307\3400\251\005\"u\204\232\264\344B0\205\025Z\300Q\205\210\302\365H\034\3525x\201\0242q\270\002\361(\204\016\223\216\370\0304AD\n8&\210H\001\210\n\211\030\342\033\2018*\231\350p\f\226\030\3521\252\353Q\210\204\036\217\252qhH\230\252'\204G-(%!i\245\340\tu\350\250dB\037\203\252\320\360\204:\342\250d\002G\r\252IK.\034\225L"
+	.ascii	"\325\244\245\365\250d\"=*\231\300\352\221P\350x\362\024\215\252"
+	.ascii	"\007\212\306\245\"m\302\210\022\326\240\210\017V\3420]A\003\n"
+	.ascii	"!\013&\214(A5*\255B\243\232\204\244\2568\353\215@(%!\005\213"
+	.ascii	"\306\245\"!!a\210\243Q=14\016\031@\r\262\340A\b\036\210\240\224"
+	.ascii	"\204\344C,\016W\245\243\342Q5\336\034\203\033\324\240R\022\022"
+	.ascii	"\316z\244tTYPG(%!iP\203\301\035b\321\360\250\204\240\016\f(T"
+	.ascii	"@]\205,\024\215KE8KCB\225\005\341*\034\002\032\217DA\243\242"
+	.ascii	"\241Q\220(\351(\207(\351(\b\203\321\013\">0\322pL*\032G\030\325"
+	.ascii	"\241\341\211\341\b\245$$\2365X$t\2418L\213\204.\f\327\024\023"
+	.ascii	"X\211)(%!\351\250\301\035\325(D1d\024\242\260\263\036\215V!\022"
+	.ascii	"\222=\006\211\305\341*\\\213\306`\022\221O\212\241q\025\226X"
+	.ascii	"\211*\022OOz\304yA\250xd\302\220p=\252J$PY(\022\r\211t\206\324"
+	.ascii	"#\023B\342\004\212DC\"\234\"\321\220\210\347DZ4.\025\335\254"
+	.ascii	"/\034\205%p\216\301\234\365F \202\033,\031\255GB\325(=\006I\024"
+	.ascii	"\215KE\032P-\\\217\324\021:\252\020Q84\n5\2403\244\022\213\206"
+	.ascii	"G\302\364\230\263\006W}\314\200\2124t\341\250T\034\236P\215I"
+	.ascii	";G\353\221\222\220\350f\311X\\\217C\243\324\350\250\032\211N"
+	.ascii	"\2248\024\236\240\036\207E\"\020\207X\034\036\225\210\320\365"
+	.ascii	"\030<\241\2168\241\216h\001\205\320\270\341H\347g\275\021\b\013"
+	.ascii	"2(\005-P4.\025\371\254/\330c\020G]\205\353\361TW\341\332B\320"
+	.ascii	"\232\264\263\023\024\344#\"\347GD\005;\253\210\245{\f\016\t\225"
+	.ascii	"H04\261\343\201\211\033d\342\2120q\203\204W\204\360\006\245\270"
+	.ascii	"\"R\334\240\245+\202\2704\202\310#\342x\024&\241(\036\371\b\r"
+	.ascii	"W\341z\314\260\036\207)\204\300cP\307\270\256PB\317\032\324\307"
+	.ascii	"T\035\032\032\327#\252&-\255\371\210\2567"
+	.string	"\002\021\202XDB*\n]\360b\222j\f\261\026\213\306\0208\353\3218$\2729\006}\214\353\nD\022\025\250`=\006\325\"\341\332\002\221\006\"\211\245\243\244$azL\325\"\341z\274Y\211JE\023\216T\242Q}\001\2078\024\032\231`$\264\026U .\r\371\300\200\202\272\nYP\217\222\220\204-\b\t\ty\324c\006\212.\024\215KE@u\250X\202X\034\256B\352Z4\256p\201\243\020\205\242q\251\250\303Q\261(\201\340YD\034\026\235p$T\032\241\036\2256\254\301\024\352\020q\030<\n\r\221\204\304\245\241\340jT4<\"\342p\034\246(\241H\311\204:\242h\\*\3221\252\353\321\220D\016q(B\320J\034*\351\024\302\022DI\026 .\r\001\327\340\b+q\250\224>(\310\004\r2\240\302\tZ\b\304:$\016\203E\343RQ\210\243\261x$\252\307\020\304\241\020)\204\220\361\030\002\004"
+	.string	"^8\nK\034\207)J@Q<\"2\252'\212=\377\201\\:\f\332B\314\227\336\216\035\300\255\3674\221\241i`\350\271i\035\270\265w\355\260|y\335i\245\221&b`\200:t]\232\326d\263\002b\245\271\251\243\302K\002s"
+	.string	"q\210}\001Bu\263R\215I\034\223\212\0339,\207\315_\036\323\006\226\032\370\013\207\312,\006\225+m\305O\t\020\0274R:\314\243\253\351o\006\013\036\266\344\036\233\214\251\263\312\225(p1\336t\02523f\2000\254z\324\361\021\261\262iurRN7\003_"
+	.string	"_"
+	.string	"\221\026\211\f\341\265\005\006\331\334W1<\374@\252\003\221kdO\224X\005\210\323?p*m\202\205\212\206\223\233\225'\230\335\031\031\027`yy\227\206M\213%k\313\2570 \013\235\326\205E\215\274\233\355\024\213#]\300\025\232\315\305Z\023\013\fLX\206"
+	.string	"U"
+	.string	"\237\326\340\250\256\334\0169g\320P\231\342\204\247\\3$e\312\246\024-;\251\321\265\005dJq\344\260\2560>\340N\313\262d \351\361\307\005d\353\311\221\233\225\312\275\225<8nXNb\260I\221di\374n[\232\\\302\303j\215.\302\223\204\315\031\223\232\013$\263p\222\205I\232\036\250\212\245\223\270\246\213\264.Pc}\032\231\273\234Y\303\227\016\341Y\333A\365e\017\357\306\206\331\033\034\03208C\246\\\351\235\271er\020+h\246\350\345\330\331\322\242\003cF\313H\277\232\304\376\230iX\217\"sXyW\003"
+	.string	"\243J\202w\331r\0326V\300\226o\323wg\311\275wO\316\0304Q\324n~\001\250\350_\223IW\340!\213\240\335\254\334p\025\366\342\346/_t\030\240,&3\034\244\221\222'\026\002<5-\354\256\303(\233v`n\326`\322=`]\024\235\224\002\234\305]s\211\323u\351\024\240\355\364\264\261|\370\254\221\322{k\356(\034\036\212b\320\241\245\313u\235\226?&nZz\3135\335\017L\355\276\304-\271\371\005`\241\265\334\365\334\017<o\300 c\344\346\027\340I\377Z\313\017\314\351\3222\247w\363\t\320F\237"
+	.ascii	"}\032\213\306\222\242\241I)<>\261)Q`9\332\334\356\246\255\330"
+	.ascii	"%\233*\250\312K\215\030\006\0333\323T\345\332\n\272W\226\306"
+	.ascii	"\344f\375\246\251\210\311b\323T\364\02444b\320R\204\347K\227"
+	.ascii	"MC\303a\257'/\034*n\326Rl\032\225\333\032#\004P\252]M\263\331"
+	.ascii	"%\233\n\350\313\251K\262\251\203$L\013\026Q\256\331\236p\031"
+	.ascii	"\331r\263v\242\327\200XLi\\kP\372\312\334\332x\351\300\343\306"
+	.ascii	"F\013\362\t\212\245\003z&L\2208m\2266\343n\200\335|\002\350X"
+	.ascii	".u\032P\026\223\031\003XI\331\315\345\275:6L\256\323v\300t\244"
+	.ascii	"\355/H\220\350%\035pH\201A\246owP\246\364\331\365\222\234\036"
+	.ascii	"0\312<\335\254\225\332,\312^\223\207\223\2503\202\223\202P,\246"
+	.ascii	"0J:\205\220!\032\231\331\246\003s\025@0P@ \222M\206Mw\003\023"
+	.ascii	"@\303\313\013\224\241('\031SfhDD$\345\024\244\240\222\016m@|"
+	.ascii	"9I\261\030)\020>\242\342t\257{\032\\<f\036\202 @u\253C<"
+	.string	"\203)8/Q\246\236\357\237P%%\001\030\247U\317\030\325\234\244\2446C\0209H\214\314\244\234\376\317\211\317\362b\334t[\300R\266\216\205U\263\201\017\2762F\375\3545\320\353\363O\276\277\2672\336\340\360\325\341\f\233\201\300\367p~\374\243\344"
+	.string	"k\304J\302\001\n'X\372\200\364.\230\003Y\216\031\305\240\270\016\002\370\351]B:\364B'\204\234\216T\214\305\205\027\027u\332\257h~\206|\316\376\021\304\306'x\341\022\267K\265\341R\231}\367@\205'G\365\253\201\240\024\347\247H\346[k\3526)\022Us\r\177`wp.\302\r\203\315$\004\306\207\223\313s\252\016/;\355\334"
+	.string	"\017\254\315\255\364f\272\207\tcK\246]Tr\204C\250y\277\321\263\307\270^\177\344\211\2378\307\351K\304+N\302\256\240\250T\320\344a\272@B\255\231\027\257'\210\304\363\226\202*\3458\032\234\370"
+	.ascii	"\333>W\332\233\360\302\001\257\331\370\307\004\027O\n6\261s\324"
+	.ascii	"\001\204\313\222\207\274\264)\027TO\324\026\0017gQ\377\031+"
+	.string	"\372\016;\f\311\004\312\332\027Y\271G\354\036kT\334\246c\301\332\271Rh\264`1\023A\207\347#\205\026fd1\004\2705^\264#\247'\032\f\274@\365\r\023Q8\233\312=\035;ncN\305;\345Oq\033\244d\233\210\347\372\375\373a*\007\240?g\331g\267\322?!`U+\025\312R4\365j\022\024z\373\220T\202qw\304\227K\311\247\021\320NS\350\370\245\324\333<\326\3315 H\246z\037hV\257\2340\004A\271HQA\233#\202\363`\223\203e\310\247\203DN\307\253\034T\020\30341B\310V\313*\252I\2720i\\F\202\357\nB\362zi\342\023=@\005.\351qbp6\234\326K*\242\225\222\320\262\367j7H*M\021\336\0043,-!<8\206\024\277\271j\315\0065\274Wb\273\245\315fE\267\r\3570\022y\034\023\fO\221\352\300v\017&\224\203\033\253\032;^\274\211"
+	.string	"\021\nI|wUyz\b_\352\324=\341!\227\254g-\207\341\332\350\276\201\033\200\276\353\234L\244\205L1\240V\373\033\020\267\313?\216\022\321\264(\260\222\265\252\027\217\230-3\275\375\325$\002\360n\301\032%EnN\370.\005\270\250Z\2333\313\322 \"\004\217\326\005t\240\222\301\021\327[\307\021d\312\307]\036A\343*\315[\223\372\226\210\212[!@g\271<\247d\201 H\272\207\271`U\207\275\356\264\353\263\344v\024\216c[e\n0\344J\273\365?\355,\263\241\034\252o\253\352V\026\001 ~\007\367\246c\261\266\331\346m\033zX\266x\214\315\256Z\233\272jyER\274g\326\226{.x\0048P\177\031\017fF;\020\032\320"
+	.string	"`\354\362=\360\264|R\253\251\330\316lw\366\177\334\216#\240}^\247\376\307\\\264\035?\222\027\005a\241\275\3612\316\242\330\340z\374\251 \025\365l=\034$\n\307\016\020\241\260a\234\2735\224l+H\005kv\323\204\001\311&\202\005\312x\263\216\224\274^\320n\207\030rnN/s\222\340R\340\247\034\016\266\357\250\255\335\367!\356\0047\326\205\374\035\211\013\212\346\3652\363\003\247\265\300\022\246,ir\007"
+	.string	"\001\317\330e\360W\235\343\033\371~\311v\277h\013b-\322\207Y\250#\377\357\256\231\340\006\r\033Q\b\311\361\325\207{\337\376\231\034?+\352\216\022\003\236Z\272\272\016\266\344\303QF\320p\240D\335\227\367\233\323c\200\216W4\023?\024]\007\351g\324\002\034Z\235\206\311\304\206,\300\351z\020(\"~\324c\336'\312\013s\322SN\375-\330\202\225(y\037\233Xy\006\263\276dN\324\325\271\344\bs\357N\3116\352\241W\005\210e\300\376\317\027\257y\314\023#\305'f)iK\350M\beK\021\035k\013\330\276T\004\214\236\230\313\035\225D6\341T\005s\247p\235$g\361\306>\324\262\301\253!\332\267\006\317\374\004%\343\373\023)\276\366w\3760lZ\016p}\364\203\345$\005\347ZM\b\3367\376\230\340\372\362EQo\372"
+	.string	"u\2214\216\325\233\272\2737\237\337\354\217\005>j\240\260d\230!L\352Q\034N\006\307\342\361\327y\221Y\177\031p\263\320\366b\f\337\001\350\2166\033\211TS\216Z\224\224\212\2328\347\037~D*\302\337H\275xg\235\244\031\332\345\215\317\346\340Ec\234\022{\377\022\215\036\227_\224\2316\026\006\024\363\f\301\364S\314\257\362\005\371P\310\033^C\262E\336\223=\276/\272}\204\007\336\252=[\365g$6\035\203\336\002$a\301\023\263k\250\306\221\200\350n\2458QN\337>#\030\324\263RN\270\005"
+	.ascii	"\002\n\365\230\361N\273T[J:72\330\362^T^\035\0260'i\032g\215"
+	.ascii	"\032\375K\311\200{\272\356\305\326\311y\212tK\t\3776e\316\t\317"
+	.ascii	"\235\026\210\301&Zt_f\312"
+	.string	"z\222A\311a\210\006Ra\366\032\323\314\244\2047\004\205\246\007^\343\030\357\032S\272]\271/\206i\370p,VD\214\256\351\210\222s\037 \034`\231\273\255'\200\260\034\026\276\370\330L\263VJct\250\020}\321\374c\332f\032\377\247\300\031\t\240\323\304\301E\372\303\016\337\326f\342\237j\320\005tY\003\004\321\0371\220J\333$\340\336\335\310\335+\221\241\337U\320CL3\265\330\202\221\263\017\344y\301\327\330%ee\206S.\035\003\272\021B~K`'\\\036\025L\254\255\306$\353\320\037\023 s\243\336\037\253_\005*4P\377\261\355\024S\267.\214\016\274G\340\355\244\3702\307\013\3018\013\253?\f\304\340\316\370\364f\240\003~gp\013\263\337,Om0\226\333cY}\031|r\233\257\252\245K\031\377\256\355\266\376\320>|\267z\206b\226\275eQ\020\373\372\252\023\370<\222\2127s\207\220\027-a"
+	.ascii	"\245\244\037\317\026\237\344Q2xy\237\216C\360\342e{\240\013\r"
+	.ascii	"\020Rd\030\364F+\352\226\357\347Z\356\212\270\244\275n_\232K"
+	.ascii	"\363`\374\356\245\n@\232\027.F\t\f\267\230\270!~\345\217\340"
+	.ascii	"L\213\342\244\266`'\241\326m?\267\370\244\004\030=\212\313\311"
+	.ascii	"\373\002J\334G\016\003~\002\332\027W.6+\356\264\206U^\310\035"
+	.ascii	"\314\231\331\215\214\027\356v\250\265\353\207\266p\314\bY\311"
+	.ascii	"J\004\237\237\300\005Qt\306\001;\262-w\351gsp\260\007@k\016\177"
+	.ascii	"|\352L'u\0029\211mYeV\217\334c\3312&#\031+40\376W\315\326\333"
+	.ascii	"\257\200\274%\023\327U\212d\350+b0\366\343#\254\001\fa\370\227"
+	.ascii	"\037\353\366 \250\030\276\002.t\030m\335\312p\221\330\035\311"
+	.ascii	"\311\362\310y\035\006\354q\341\033\271\232\tz[[T\266\334\204"
+	.ascii	"\002H\215v\310l\350\236\210\336W\2634\216\2451$\241\251\372\371"
+	.ascii	"$G\232\\\252\034\222\330\030(.\3519]\372\002\374\201\354\\\330"
+	.ascii	"\327#\306\206\354\300\3113*J\bP\354\377\355\321\021\242\260I"
+	.ascii	"3\314\330O\270eD8\347\341\320\327\276\004\364E\242+gB\f6\222"
+	.ascii	"\243\270L\277\302&\330\027\320+L9M\t\354\272\027\302\030\273"
+	.ascii	"=\2152F+03\244T!e$\251\013M\372\3706b8#v0z\\l\241\372A#\353\354"
+	.ascii	"\213\020\013\227\006\350\025#k\352 \017h\216\002\306O\361\371"
+	.ascii	"\303\274\307#\311\311\276!\300iU\016\365e\n\314\272\320"
+	.ascii	"fv\351\342\313!E"
+	.string	"\007;f\0339\326}lI\310O\327\222\202E\371U\023D/\030#\013\245\322\021\223\205l\247.\341\207[\200\203\363\fp?\235\2517\223;Uf0\374\257\356\262\b\303\322\301K\031\320\252\013\232PU\016\312\021ZX\3455\245\205\246\004\240\372\267\310\243\036\3368\026\304>\327\241\017\032\030\bt\2729D\305\022\304\321\247\201\202\245>\243\262\202\024hD7\270\222B\263\272\261\356\317\304\262\322\240M\303\300\013\236\255_\177,\3021\232\260K\016I:\211\206\260z`8\225,b\361\267\353\234O:;\r\004S\365R\310\315\206\227\003\246\r[8]z\267\2053\241\367J\364\206?4\016\307\207\3125\347(\257\031\035J'\312lk4\265{NM\\\00540\232\027\217\243_\337\327\0061O\214B<\360\025\317l\264\3136A\321\225@\201\371\030\210\"b\272\330n+\212\324\004\235\207p\213\022X2C\005\334\302x"
+	.string	"U\340\320q\362O\314M\216Dk\367L\020\0056\336\216&\300\330\234\212@\223\376\0343\302t5$\212\372+G,\b\361\273V\221\363\03247h\027\353\322^\334\n,\231\3509\301\335+#\233\363\016\256\222]#~\307\320v\312y\343\234\322\276\365\220\033\250f\234\0376\035\035\214\314+\004\356\230Ejxi\005ZZ"
+	.string	"\345\367#\225\336\b%C\266M\201\001\2320\323b\225\210\220\254HX@\272\374\017\363(\206\214\024Q\201\177t>\241(\013J\267\177y%\346;5\240-\353\337\223\222\347\303G\254_@\260\037\321\272m\267\205\n\232l\200\307\334\251\312r\260\251(\227\342^\274\b.9\232\300\0021\335\241\334\347\201\265\020\214v;`2\254\341!,M3\370P\266\217\330\304\214K\204\240=&Y\246\322\357\f\344\002\b\272Af\325\270%\200\331\224^\256\2618\b9\026*P\260\365G\260\203\346\304\177\263\213-\027\233\032\3405L\240\343\274\023y\210 \215\020\252\026\220A< \3258\nt\343\365\004\302%\327\301A\327\3143\261"
+	.ascii	"\272Wi}h\332\360f\3700\204_H\036\255'\234\007J\364\244\r{\027"
+	.ascii	"\305 `\263\316]\251\005\277\326\216\304\206\247\273\354\347\254"
+	.ascii	"\217\341\357\356\005=TZb\270W\357\371.\373\243\232\340\002\371"
+	.ascii	"X\333\220eDd8\325\356\251\351\253[o\217\263\026\020\235\274\256"
+	.ascii	"\300\314K\177\234Y\327\343\224A_:;\240\367\315cw$\035t\200\307"
+	.ascii	"\361XJ\374\372,|\201\354\365\276YWS.\032\n{\220\360\031JR\226"
+	.ascii	"A\032\235x\244:j\376\007\025Y\016\315\337V]AL\260\007p\255\212"
+	.ascii	"\232\013\363\002\342N\025\245\320\266\005\036\312H>\201[\356"
+	.ascii	"\207\226%\007\226a\2531\236\315\264x\217\034X\026\326\022\034"
+	.ascii	"-=\254\310\032S\367\017Y\355\036\322i\344\307r\345\277\265\271"
+	.ascii	"\021\243\r\032tn\271\321\277\b\343\3445\300\205R\021O\2559J\b"
+	.ascii	">\372\340<^o\205n\347'Sx\336c\261\204Z\207\3530\360\2335\231"
+	.ascii	"\372\007\263M<]\013\213=R\224.\334$G\013+\"\212T\260Q\200d|;"
+	.ascii	"\354\241\232\206T\213Z\217\022\030\021\357h\366\274T\003!+\002"
+	.ascii	"\247\206\217\024-rB\020M\362\222\223\320\265;\313\315f\3743f"
+	.ascii	"7\242f\207\314\025\204\333\332\337\2137c\330\006\220hD\263 ="
+	.ascii	"\022\2049C\n\013\037\210\217\332\254\217\301\231\322\206\253"
+	.ascii	"\362s\350\306a\240O\243>\344\216b\301\302\177\245\235\226\"y"
+	.ascii	"\3367\343\232#\"{#\002\245^\207\346\307\354?\223\006)\327\257"
+	.ascii	"I\235\207\254v\300\305\313\303*\201\275\201\0038\034\004y\232"
+	.ascii	";\207\354\024gq.)}\262@\200@\225\244\235D\ty\274\313J\315\277"
+	.ascii	"\200V\220`\314h\3014\207cl\223(n\021\356\210\334\332\215\221"
+	.ascii	"[\241\312\272-\366\350\315N!I\024c\271\227\242\260\253\022b\217"
+	.ascii	">\037S\322E\201\250\007\276\257\206>\237\353@;\360\234=\034\340"
+	.ascii	"\316\367 b\316a3\233\221\334eCs\254\271\002\2559\242\001\376"
+	.ascii	"P\222,\303\337P*\023\004\230v/\004\235\265\372\327[\242\240O"
+	.ascii	"\016\263\200s#\311<\261\337\207^\300L0\004\006\320\274\261y\345"
+	.ascii	"\205\254 \263\354\3170\223\253\217\241\260\211\327\270\n\034"
+	.ascii	"g\305\006\200\235x\261\003\312\020\r\022\240\277\246c\226\305"
+	.ascii	"P\326\017%\270j\257.:\202\0248(\307\275A\307[lX+\016B\234!\307"
+	.ascii	"\267\030\327\235\214\016\346[\341\002\002\345v\316\337\307u\r"
+	.ascii	"B\371\023\340\017\372\325\027\236cc\005\301O\341\265'\304\020"
+	.ascii	"R\006\037\263\216\202\226\247\217\307F\252\221\233\2078)\231"
+	.ascii	"\343\330^)\327\345\257\322\355$\223Y0\360\2330\372\207\030O\236"
+	.ascii	"e\240\033\261t6\305\210ytb,QG\313\340c\031^=j8\207\017\313\270"
+	.ascii	"\360\016\275\001\310g\234\271\213\210\261\257274\371\\\013n\210"
+	.ascii	"1\340\254\205=\b\251}\006\203\342\243\330\321\007\034\350\001"
+	.ascii	"?\006\253\335\202\344\216 \314\342\210\212\375-\262w\3230w\367"
+	.ascii	"\346\315\245.\rB\2209\300\333e\bp\244o&\360\271\300\337\357T"
+	.ascii	"\254\200\f%7\342\305\226\004<V\036\330H\204=d\n~\236\177\367"
+	.ascii	"\003\f\274!\377[\nE\303\007\002+\320Y~a\354\034\330\0245Z\036"
+	.ascii	"\202\330#\277\325\322\177\222\203\231;\253\336\204V\372\033\237"
+	.ascii	"\006\347i\212\314\272?9uw\303J)\263\030\315\243~A\300p\37551"
+	.ascii	"\020\366\356\206\356\364\221H`\004\310\212\353\342\005\307\356"
+	.ascii	"F\221\271\236\325\252\255\353\303\357R\364r\224Mso\271\2623\312"
+	.ascii	"Ex\242\3035L\273\006\232\313Q\206\264\373\264n\024:i\213\357"
+	.ascii	"\3543w\006\212\"\333\204Q\201\022UH3\n|\004\360\260\b\217\373"
+	.ascii	"\017q\333\202\337\351\363z\220\326\t\351_P>K\257\236\310cp\\"
+	.string	"\377\\{\306\372\337@l\257\314\351I\350\211%C\374\b\022\275\360\345\"O\007_r\302\377\304\021\006\036\363?\373xw\213\374;z*\343]Sc\377\275j\376/\364^\256O\270\227\337x\335u\\\215\232\256\f\234\307\033\336\3220\276\361\236\3443\006\255\305\342\211\223\332\234\007\037t\335;\257{\316\371\353\227\325p\020\3447I\267\211dF\201\030d\366\034\t\233-\r\332z~\331\303\267\251d\332qo\226\263G\031\201\351\f%\031\036p\226\251F9~\333\374qA'e\303o\324\271\017j0\304:\304N\374\323\177~\201|\223|\367\222HN\371>\226`\377b\203\327\334v\322\371\206\373\327\277y\333\367\f|\276\243\203\013\t\037\016\365\237\353\235\331\030\333W\032\3549lse\002b\267\0317\324\353w\004\274|\315\361\003_\032\340H\334`\272G\321k8\314\266v\253\361\205\266-s\336\330\277x\300\331\221\314"
+	.string	"m\020\001V@\237\261\274Z\225\005[\256\034\256\232\236\267"
+	.ascii	"\2360\3732\366\227\372\225\rF@\277y|\332\363(s\210\260\201\367"
+	.ascii	"<Wv1G}A\276q\357\350\234\357\257_f/\260\257\364kb\231\377\355"
+	.ascii	"\375dB\374\336\245\236%\277*\373\263\276\004zR=\352\340\351\n"
+	.text
+	.section	.gnu.lto_.symtab.7f4ec07e4795bed6,"e",@progbits
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"gyroInitSensor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\003"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"gyroSetTargetLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"gyroReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\004"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\004"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\004"
+	.string	""
+	.string	"filterChainInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"filterChainAddStage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\004"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"buildSensorAlignmentMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"gyroFusionInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\004"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"mpuGyroReadRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7f4ec07e4795bed6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,662 @@
+	.file	"initialisation.c"
+	.section	.gnu.lto_.profile.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375 0m\001"
+	.string	"d\002$"
+	.string	"\004"
+	.string	"\304\225\207\302\002"
+	.string	"\001\237\340\370\345\016\004\002"
+	.string	"\002\001\002\002\002\003\005\247\243\326\333\005\006\247\243\326\333\005"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375 \"\325"
+	.string	""
+	.string	"\220\026"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375 \210\255\002"
+	.string	"\264\003|"
+	.string	"\002"
+	.string	""
+	.string	"\006\200\200\200\200\002h\001\201\200\200\200~d\002"
+	.string	""
+	.string	"\001\n"
+	.string	"\017\217\205\327\317\b\224\334\236\252\003d\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N\002\013\220N"
+	.string	"\002\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"O\004L\204\f\001d\262\032J\312\020\233\f\337|\032\246\360\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375 ]E\002"
+	.string	"\204\003Q"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"\004\0036"
+	.string	"wus"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002x"
+	.string	"\001\002\006q\001\001\006q\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001\377\003"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"<\005\f8\250\344\254\007.\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375 .\r\001"
+	.string	"\270\""
+	.string	"\002"
+	.string	"\001\002\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",A\200\2027\200\005"
+	.text
+	.section	.gnu.lto_.lto.a40faf99a0a011c4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsPreInit.43.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375 \372e\006"
+	.string	"\022\213*3pi\323\001\2002=\f\360\351\b0\370\252U\324\304\217\352\036)&!\302\2301\232\\\365wg*\242\376\037\275u\224o\255\2307\273!\002\331\267f\345\226)\227 9#\025\325\230\211\"\025e\204\225\316*\247\ne\2144P\242\025B\224\317\315D!5'\205\317\326\313\032&\343\b\370\002\350\002\226\202\337/0\360\026;$\202\273\330\3727\353\361\302\277\214f\355w*\006\221\212n\204\213\2569\007\242\341\377>\257\376\tI\301C\342\340\301\242\273!3l\265\257\372\256\303:\260\314\332\327\270t\367\037\226%\354y\377O\376[\376+\004\r"
+	.string	"3\001;8\243\306W\240\035\300\f\224"
+	.ascii	"\207\321l\314\205|\025l\277\214\033.\307\242\235d"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.44.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375`^\001\035\017"
+	.string	"\206\334fE\360\222(\035\262R\336\211\023uy\361|\306i\246\217\360\350xK\375N\237\247\b\300\273\376\331\b\314\347\267\375e\210V\371\001\2565G\331>\200\237%Z\004\323\237e\355\032\360\305bz\3438\027\305Eo\367\2262\245S"
+	.string	"O"
+	.string	"Q"
+	.string	"g\225HL\340T\231\224\300a!\270\264\202\354\322&\013X\\:(\243\372\313\3272\003gNP[\025/=\256\226\374\267\036a\230\310\371V\246G\022\337x |\001\031Y\245\242"
+	.ascii	"\025\213\357\255\253\313\n\245\n\240\301\234\323\372\255F\334"
+	.ascii	"\362\266'\330f"
+	.string	"`\337&'\315\271L\220P\307n\214_\352dK@\304\217\032\037)\r\342L\355\017\236\376\313\3660\027a,D\255\311\006Q\2721\366\343\\\030\373\254;\223\352\030\325\273jU\365EFR\2408\361\342\262=\300\251\312\0212arG\213\263~\233\305o\331\023v\005\013!\326\344\335\270\t.\334\006C6g\352\304\257q\033\0314\244\244t.w=4<bl\360\224\306\013\026\003\250\256\375\001\351?\223\244\326\344\257\356]-C\274\275F%\233s\236\3704\227\301\371+.\335!\244\377.\375P\347\362+_\256\330L\0346\022h#m\017\272\021\b\025\021\203JD\035G\372x\234\207\017G\342D\234\346\215:O\264y\232\210\373\2044\320\310\323J\f\270[\331F\032\251\353F\232\007<=\316\205\311v\345E\030\013O\213r\001\215\373\231\347p\2407s\236\376\331\020\216#\302\200\233\033wI\240\200\202\322\271\f\033"
+	.ascii	"2\241\237)\360\022(\336\365\002\330\f\004\006fY\3627\264\003"
+	.ascii	"\274\np\203l8,@Lc\243+M\354n^\270Q\251\232\306*\322\034s\211"
+	.ascii	"k\242\360,v\304\004H\024\321\241\"\216\273lU\243S4\265\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"5\005"
+	.string	"4\007_\001"
+	.string	""
+	.string	""
+	.string	"\002+\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002,\177\f\0051\r "
+	.string	""
+	.string	""
+	.string	"\0056\0165\005*\017\201\204\001)\020\001/\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\001.\177\022-\177\0234\177\0243\177\0252\177\0260\177\027\003"
+	.string	"\t$\003"
+	.string	"\bD\003"
+	.string	"\007d\003\001\r$\003\001\f\320\360\372\250\001\001\244\001\003\001\304\001\003\001\n\244\006"
+	.string	"\025"
+	.string	"W\207\226\264\262\002\203\200AZ\203X\254a\200z"
+	.string	"p"
+	.string	"p"
+	.string	"p"
+	.string	"p\370"
+	.ascii	"\351p\251\207\005\303\345\007\246\261\304\003\327T\332\016h\270"
+	.ascii	"\354\034\003"
+	.text
+	.section	.gnu.lto_.refs.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	"\003\007"
+	.string	"\002\004\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a40faf99a0a011c4,"e",@progbits
+	.string	"(\265/\375`\256E\2050\001\312\373\355oY \naI\035\202\030\230H\\M\n\327\365\023\037\372\007\177\227\356\372\237\313R\306P\370H\333\343\364>6\003\352\tU\016\3168\231\354`b\344\004\254\235on\003\240\024"
+	.ascii	"\2640\f7m\245\275_\325\025\355\202\210<<x\337\232\277\273\244"
+	.ascii	"\205\247\213\t,\217A\331\344\226R\312\024s\006\351\006\003\007"
+	.ascii	"K\226\\\2345\372k\220\370\357\340x\356\361\217\347\3621\363\250"
+	.ascii	"I\321\265\304\201uT\232\244\244$\206\365\357\264\360\377\317"
+	.ascii	"OYG\306\221o\344\0319G\226\221\227\271F\266\221id\250\353\314"
+	.ascii	";\362\213\317N\031F\226\t,AXD\277\244\310K\367\t\026\"\313\013"
+	.ascii	"4\351\304\027h\357M\027Y\271\331\270\372g\244\0307\215glv\246"
+	.ascii	"\r$L\020\026\321\336\233\237\221?\035\344\035\031\305\365\272"
+	.ascii	"O\247\006\030i\313*\232\262\362\310\205\311\"\215YdEV\362v\275"
+	.ascii	"\037\2570\363\216\334\"+\357\023L\027A\273_\362\216\254\302\r"
+	.ascii	"\343\245\275/\331\310\362\216\314\224\227xH\315\336\244k\322"
+	.ascii	"\024\204E\364\006)f\310\222\004\372wF\270\016\273\275\375\273"
+	.ascii	"\035\374wK\376\273\027\374w(\370\3633<+\377s\362\222\375\030"
+	.ascii	"\276\022\246F\024\353\347b\370\315\n\\\203\333\333\031d\245\035"
+	.ascii	"R3\347\346\350B\f\013\326\317\321\370s1\376\274\213?\267\342"
+	.ascii	"\0320\371\207\036\374\3018\024\357q\030\374\371\022\307\314\333"
+	.ascii	"\333\317\223x\257yw6\266\272\275\275\311\342\336L\006k:Ab\035"
+	.ascii	"\355\031\013\225\f)X\277N\016\303\3412\333\b\230\243$\326\257"
+	.ascii	"{\343\257\333\302w:2\376:$|\227\324\375\3405n_\260\022\206W\024"
+	.ascii	"\326m"
+	.string	"=;\205\022\031kX\277\316\251\013\366r\235\230\r\257\261\3414\274\302}\202\211P\306\206\3310\027,\306Cjv\243\315R\023..\332{\357\341\300\201\027\365\364\346\264\365o6\376[\n\337\302\223\201\265\255\027X\377f\302\377\232a\331bf\301W\264\240Z\260\332u\342,\370\371\272\331;\330\356\352\206U\322\326\277\225\360\337Z\374w\025\377\035\305\177\303\3405\311\333\333\277M\360O\243\334\246k\3416P)\374\246s\361O{\360\033\350\355\355Oep\234\216\211<\036\373\307C\360\024\026\303:\316\342\234\260n\302\233\364\200\252\302\372S%\236E\005\212\373\225\f\262,\253\255*>XT\230E\220\244U\331*B\005JV\365c\367\tv\231Q\252@{\357F~\214\267\353}\n\026Y\357\375\3771\030\366\302K0\023\234\004+\301a\270\013\177]'v\342#\217\233\230\353\3655\373\367\301N\254\365c<\244f\377\341"
+	.ascii	"*1\240\321\336;\007\036\0166NdH.\030\364\247(8^\336\235}A\034"
+	.ascii	"\177\r\307_\217\341\257\303\360\327n\3745\033\177\315\205\277"
+	.ascii	"\336\302_g\341\025\334\336\276_>\217\211d\262(IrX\277.\343\273"
+	.ascii	"\355\3666\316s\213\363\364\017\256\323oo\373\340\301N\232:\250"
+	.ascii	"\260~]\203\377\006\227\355\fs\013\343\270^<\243N?RC\303\354\275"
+	.ascii	"\371\377\230\007\336\201{`\0358\307u\342(\f\365w\205\273\366"
+	.ascii	"\035\374\337.Q\327\213\334m\213\272`0\362CR\322\002Pq\320(\254"
+	.ascii	"\002~\372\220\224\264\300\221\031h\357\235\003\007\036\016\034"
+	.ascii	"8\360\027Gb\200\271\321\257Y\360\327I\374\351\377\266a\024\370"
+	.ascii	"\306\315R\203\215\231&\227\023\016iO\245A\232a\375\377\270\006"
+	.ascii	"\246\201g`\033\327\211\227\227\314c&\234DZb\025\377%I\315\312"
+	.ascii	"\006\377\270/\357\033\226\221\242+\r\247Xb%\335\027\024\032^"
+	.ascii	"\342\245\033\226\233d\374D\327\031\224\003\207\213F\n\364J\215"
+	.ascii	"\3061v_K+\244\301\3723\031\f\003;\331\020\021#\206\f\277x\354"
+	.ascii	"4\206\223\225\266\002\2115n\302.\216lhZ`\375\217]<n\261+\343"
+	.ascii	"t2\2025\213nS\225U\306\002\353\317mx\005V\336\234\340\021E\215"
+	.ascii	"?\231\037\373\377\335%\"v\265\004\353\333\274;\233\347\366\366"
+	.ascii	"g+\374\363\023\376y\214"
+	.string	"?\331\335\331\237\301\370\356a\036#\377\357\227\353\206O\334,{G\352\275k\330\ti\341T\2055N\212k\372Q\004\353\317T\374\377\361\021F\272Nl\342\316=\356\330\370<\315\336\303z\357\277\301\277\0176q\337n\232\017I\311\035\323Q\033\264\367\346\337\254\177\237\377\237\016\260\t|\274^\271\311\354GjN\030\240\343,\306U\264\367&\017\007\0165^5\234`m\375\331\310o\277;[\347\313Esk\024!\262\304\372q\024\376\327y\345\316\350\216bR|\305\375=\363\377\323\301\273\335\364\236\325{\337\220r==)\303\372\216\271f\376\177\247\253rN=\261\376\277fn4}\342x\221\004k\270\246\316\255\310\026\034\326\217\273\370\377_\347-s\3114;\017o\206\221\376\004\353\307L~\305\274\330\377\357r\230r([`\375d\036\312\377\357t\013'XhX?\216\342\027\352\3637Lo'\235\232\035\254\367\236\323"
+	.ascii	"\0378\214`\235\227\\\367\273\263\277y{\373\237\267\267\037\267"
+	.ascii	"\340\217Q\360K\206\3274\357\316\276Q\267\267-,oo\377\335\302"
+	.ascii	"\377Z\341\177\233p\236\273\263\377N\361\233"
+	.string	"\206/\332\275\3627\355\236\375O\007\177\203t\323t\357\307{-\340\335kA\n\005\310\261k\353\277@\370_'\236\301\335\331w\212\316L\n-X\260\376\333\371\205r\243\\\347\225\362\177\313\256\331k$\313\356\354\275\211\223\217.\320\306\260\376\233\301\316\231\233\233\233\273\031\354'\362\n\356\316\326\267\267\177\345\377\274;\3739\300/\220\335\336~\350\335\331W\311]r\235\030\\&\177\277\356\326\247\307fo\366\336\314\301>\320(\351\302\372M\340\1771\330yn\356b\260_\004\216oo_\256\213\344:)\270I\376\247\203\317F$=\253\367f\016N\232\2534g\260~\b\360\277]?A\226\336\301\367\370_\n\366\235\273\024\354\307\374\302\363\366\266\316\335\331\377W\353\377b\335,\f2Ri\331\301zoZ\340HfL\262\260\376\346\335\331\374\366\366\177V\001d\243\306\177\266\340?\323\370\317\036\230\301B\306?\366\022\343?\177"
+	.ascii	"\306\177>\361\377\033\376\377\204\377/\300\243\375\177\005\377"
+	.ascii	"{\313\1776\n\235~\377\357+\377\371\305\177n\361\237\233\3763"
+	.ascii	"\323\1776\361\237\217\376\263\361?\217\340?\207\340?\223\370"
+	.ascii	"\317\355\177&\376\347\341\177\366\300\3773\371\317C\3779\350"
+	.ascii	"?\253\377y\375\317\031\370\317\004\370\3175\377y\367\377Y\377"
+	.ascii	"\317\363\377V\376?\317\315\315\315\375_\f\3779\371\337\203\023"
+	.ascii	"\001?\226\271\222\031\222\324\216@{\357y\215Kf\273z[;\213\"Y"
+	.ascii	"\311hi\314+H\332R\2456\221\225\031J\224\374d\305\005Z\312\333"
+	.ascii	"%\253\345\025\224\b\300:\256\235Eo\023\255\343\332\231\225\221"
+	.ascii	"\377\214\225u\323\036\240\\;\263\352\275\371\267\n\226\233v\001"
+	.ascii	"\326\323\332Y\364\266\351\244\274\324\364\341\352\270v\026\315"
+	.ascii	"GRe\346\312K\264\262\254\235E\363Zn\313f2Wr\247\242K\f\232U|"
+	.ascii	"\351\261\006T!\351\340\037\317\245\3124E\252t\237N\2757qpd\310"
+	.ascii	"\332Y\264H\024m\345i\355,z\265\344\260O\225\271I~\222\271\222"
+	.ascii	"\026\200\362\002\315iekgQ2\r\005\n\001UC\362\021&l\267\313}b"
+	.ascii	"\2755\225:-U\201\203\252\343\332Y4U\346\253n\f\303\301\221\247"
+	.ascii	"\265\263T\251\255\264\227\232\026\215\224E\n\225\342H\231\322"
+	.ascii	"e*#}"
+	.ascii	"\221\306Hu\244*R\027)\217\024F\032\225\006I\237\322\037i\216"
+	.ascii	"\264Gj#mJ\223)\220TH\272#\275\221\372H\227\322\025i\215\324)"
+	.ascii	"\235\221\266\270\316T\211\313l\375\347\265\270\f\306;\352t\244"
+	.ascii	"\243&\3143\2512\313e%\367\031\325{\023\007WH\326\316\242\031"
+	.ascii	"+U\346-0\320\333%Uf)\271\212R\003\255\343\332Y4Uj\244\256\332"
+	.ascii	"p\204\354]yAU\226\265\263h\357}\327#\006\\\031\b:U\372\277\320"
+	.ascii	"\213\345z\021\205\300\360\302\3721\260\361\024E\016\216\035\307"
+	.ascii	"-X?\006+\374\212^!7\231 \034\251\200\232H\221i\322u\246'\220"
+	.ascii	"\322\023zM\237\371\220\224\274\300\321\0224=\221\"\375\331\206"
+	.ascii	"#d?\336\320@*N\215\251\275\242\250\330\340\3721,\371g\244\230"
+	.ascii	"\236\373\214\202\300\020&f\321+h\357\3153\232\213~\333p\204\254"
+	.ascii	"\300\22402\017\205\267\353\375\t\214\tg\244L\006\367\t\026\202"
+	.ascii	",K\237\321f\036\n\017I\247#\005\261\322g\364\230\036\336\261"
+	.ascii	"\331\223\233G\217#F\376Scz\244\345\322\256\323\350\271\364\250"
+	.ascii	"\321\\\247>\243\343R\257$\3213\027\364\367\254\360\357=\341\337"
+	.ascii	"\013\343\337s\362\357a\361\357Q\361\357\375\340\337{\n\023f\004"
+	.ascii	"\223\205\t\353\3575\271i0\327\251\241\332K\027\335\206\343\013"
+	.ascii	"\023\252\277\350\266\013_\274\024I\213f1\2661I\266\376\013d\374"
+	.ascii	"_\267i\2664Z4\322`\255\331\264\227-!J8\260\376\013V\374/H\361"
+	.ascii	"\277\320\203\377\005(\376\257\261\274^\341_\237i4\275\245\003"
+	.ascii	"\251\022\024VN`\255\325\264\226\327[t\226\256\267p\260\354\375"
+	.ascii	"\250\267\344\310\365~\314\271\327\202{-\320F\240\204,\331\372"
+	.ascii	"/\324\340\372\351\363\032\213\211(%%\326\030\334\336\376\013"
+	.ascii	"/\370_Pr\334\274;;\203\333\333\272\312\024\"\021\267\033rT\246"
+	.ascii	"\344\036\320.L)\257\247\030\331\230\254\2211\323O\312vDZ(i\273"
+	.ascii	"bV\266[!K\254\214\223\327e\231L\r\035@\226\034qj16E\213]\252"
+	.ascii	"3\026\266t\023\035\206d\006I\032\223\327a\377?\035\334\264\213"
+	.ascii	"\345\246\006\207\265V\242\227p&\223\321\304\022\f\2273\305J\232"
+	.ascii	"\030`\2730[\256D\201e\260\034RbXX\277\005&\317\342\311_HW\330"
+	.ascii	"y\235:\211\276\002K\242\215\350.%e=\252\334t\024f\234h\375\257"
+	.ascii	"\273^#Q\241\002\212\304Zs\355\316X\264\240\202\365[0\362\177"
+	.ascii	"}\344:u\323-\203\033SJ\254\237\214\336\372\377\035\336\261\005"
+	.ascii	"L\034\326\377z\353\265V\262\177\301\300:\2537eA\202\365\353\200"
+	.ascii	"\341X\372\n\3378ji\302\372u\332\370\353T\341\257\003\245\b\233"
+	.ascii	"\326\013/\254_G\311\224\246\272NMD/!i\"\032\205V\352\022\206"
+	.ascii	"\210V\241\245\356\323I\247#\271\241\201r\270^Q\322\274m\375\244"
+	.ascii	"\203\2641\231Z\210\036r\235Z\352\265\224f\322N<\243\205\336u"
+	.ascii	"\3101\2454\f\275\344!5\273r\2031\246\211\353\341\300\301F)\007"
+	.ascii	"\r#\327\377\257\177h \327\251\203h\037:t\217\373tjv%\217\311"
+	.ascii	"\2154q\321\254 \032J\347\330p\204\024\341\t\033\224\233\365x"
+	.ascii	"\302c\353\327\321\342\377\272\307k\0368(\306\246\326v\350\250"
+	.ascii	"\232\026N\317'X\277\216\024\337\361W\205\224\t+X\277N\024\377"
+	.ascii	"\353\374/\032\307\273i\037g.\264\260~\035(\376:3\370\3538\361"
+	.ascii	"\337@/u\fM\343>\301B\244\271i\033\372\306u\352\245\256\001\246"
+	.ascii	"\227:Y\005\f\224'd\nKk\353\327Q\342\272\n\351\013M\317\3202:"
+	.ascii	"\016\216\033\r(TX\277\316\221\177\316\031\3769p\374\377\265\013"
+	.ascii	"\375\342:\265\223n\241\235t\223f\261\341\b9B\2158\355\244\223"
+	.ascii	"\327\313F\210T\2328\035\216\262#=\266\376\2340\376\257Y\350\025"
+	.ascii	"0\220M\344R)NZ\200h\245^\362\242Bw\303\372s\222\360\317\321\342"
+	.ascii	"\237C\305?\307\007\377\034\033:\305\327\323\226\025\326\237\323"
+	.ascii	"B\253\220\263\304?\007\005\377\234#\376<1\374y^\370\363\262\360"
+	.ascii	"\207\352\2436b2\271$\027X\3474y\356:\037\212\356<\244\030y`\375"
+	.ascii	"\274*\274D\357\275\337\207\262u\017e?\357\213?/\213_\036\223"
+	.ascii	"GsV\320\370Bb\375<\031\37478\312`2W\222/\331!\004\232\311d\270"
+	.ascii	"\353\314e24\227\311a\362\230\373\004\353\307\025"
+	.string	"\027\300\031\301\224E{or\340\341\200\263$z\306\305\326oYLN\n '|\240\275\225\361\307\321\372\222\335\2602I\017\251/5x\227\354\345\252\225\211C\201\365\3430u\3011\301o\362\366\266\226\274%7\305\250d\301\372o\340\264\334\260\361\277\301\302\377\306\214\377\215\027\377\233)\3767P<\237i\027h9\202`\37572\370\337,e*9\317 Q\304\260~\2334y\212M\030\3766Y\370e\336\3366\273T&\216Pa\3756bN\2563\227e\261\\\226\3072\331}\202\365\336\204\200\253&\254(\321\336;\017\207+\303\312\321\025M\226\225d]\224D\260~\033)\37664\370\333,\361K&\307\377s\327\347%\377YEnf%7\321*TE\260V\362\237\235\031\231\301\256N\371\204\253\f\353\234${]gO\376\312\271oQGMX\177\315\030.\202\336o\317\276ss\267g\357\333\333\031\211\317\347."
+	.ascii	"4\201\342\004k\035\027\236\373\335\331\267\246\n\377\2320\376"
+	.ascii	"5M\216\243wg\177\r\223\177M\024\377\361\371\\\265\255\236\334"
+	.ascii	"0\203\365\327\320\340>\375\356\354\235\274\275=\244\252\t*\007"
+	.ascii	"\326_\223\344\177\253\374H3\227\205d\243\0344K\345 \231\231\201"
+	.ascii	"\\g\026\222}<\226\303h\346\204\344\216FH>\312=xLRAXDs\033\310"
+	.ascii	"\324\226\221hO:\035\240\246O\251X\303\3727\350\340;\016oXbP\263"
+	.ascii	"4"
+	.string	"\343\202#\372;\356\177\233\271U\256R\312\223\020\254\323\333\333\267\314\347wT\343(\3034\244\314_\347.\263\3310\222n\3445Q\323\021\305H\325\r&\254\177\003\n\376\277\307\374u\3561\273KF.{S\003\314\234\016p\363\225\242F\023\353\337\200\024&\314~\303 \005\265\253\232\312q\365&5\005\245\204\365O\360\306\177\267\355/\277\335\336m\203\341\275wc\2633\335&f[F\242\335\311)\003\235\306+\205\362\311\374\006\223\205*\310\022\254\177\202-\376\377\367\361\377\356\307d\357]\2316{\362\350f\377\337\277\351\275\031\374\343\334|\005\360\377:\377\013I4{R\2311\275\367;\206O\215\035eT\320\323g\357HOF\b<5!=\275@:\237\232, \235O\335\210\024\304h!\331\237\214Hg\357\026\220\220\214!\226MH\347\261[@:{S7\221\245\351\366\346\223\261#-\273\205\216\324\217\335\271l\252"
+	.ascii	"\211\364\324\204t\036\233, \235OM\335\371\324u:\3221\211\002"
+	.ascii	"\251'-t\347S\230\356\\6\351 \235\313&\244\363\311\355j\245\300"
+	.ascii	"\232\341\202\314\030 l\267\t\211\324U,\3158&u\236\310\346\262"
+	.ascii	"s\351\375\202%\365d\177\366.\200\336g,\223\\\216/.\331\321S\305"
+	.ascii	"Q\330q\331\263t\004\265\354HO\343\355O$\325\262w\252\243\241"
+	.ascii	"\276\324{\357\034\030\233\317\316\343>\2158ft\245\244\336%\350"
+	.ascii	"\315\336\227z7\336\376\354\275\033{\357\272\344\214f\3571t\220"
+	.ascii	"\314\245\245\336\235x\226\372\f\243\223\244\3361\230\027\262"
+	.ascii	"&\244\023j\351\343\304\313\311\354'\232\306\213TZvf\347\362\224"
+	.ascii	"\344N#WW\352\275_1\234\331\264\342\rk/P\332\222\244a\375\023"
+	.ascii	"\234\340\233\213\t\247\257&X\377\004\235\377\357\265\217R\263"
+	.ascii	"\005\rk)\345\257sK\331[2\222w\244\2559h\357N\007\3001c$\207\024"
+	.ascii	"\326Z<p\203L\n\326/\201\031\376\227\254\2126\236a\356\035V\264"
+	.ascii	"\361>\301B\030\211\203\356+[mg\331\317\353\334X6\332\357)\233"
+	.ascii	"\312\306\262\317v\224\rGH\275e\006\332\266\261\3544m\024\322"
+	.ascii	"\245#J\252\203L\313\261F\277\004m\374%\330\302_\002,\374%\240"
+	.ascii	"\302_\002%|\277\004N(7R\266\320\030\261~\t\214\360\377\337J6"
+	.ascii	"\223M\266\233\354\261-\266\227l\263\035\266\313\266\223\353\334"
+	.ascii	"O6\217\337Gv\363y\260\246\354'[\213\207\332~\262\267t\225\261"
+	.ascii	"\206\007\324\0202)4\246\325fZa^U\031r\006\305\375\311\316\032"
+	.ascii	"\203Fm\346\206#\244\bS\322\240E\214\354\252\rGH\021\242P\331"
+	.ascii	";\366\223\315\265\301\304\f!kB\242\344\212G{\355\257$Z\222I\312"
+	.ascii	"\234\361J\202\363e%\306\321\371;\311M\231$\271%X\357\256|\005"
+	.ascii	"\215\216#\222\377\337\341l1\327\242 \321F!*\204\220\301\372{"
+	.ascii	"\302\360\264yw\366O\271\275\375=^\370\367\234\361\3571\343\337"
+	.ascii	"\263\204\177\017\027\377\236+\376=Cv\021\252!Z\313\026X\177\017"
+	.ascii	"\216MdS\361\036O>|\354\251\337T\033T\370\300\352\221\301\277"
+	.ascii	"g\305\026r\223\002)g\006\353\357A\332A6\020"
+	.string	"LE\306\211\325\376\361\033\b\026\363e\207\033\326Of\373\370\377]M\031e\224\031\037\277{\260a\321\022\305z\367\330<\276\216\307#\254\237'\216?\217\030\376d[\307^\276QQ\032\261~\234\202\251\013\024\013\2133\263\025hU\224\327+\215\331\"\243Ya\316\3304v\216-c\327\330O\033j\343\3307v\214m\343:\367r;\375\206q\233<\336\340\005\225\214l\272^W\230*2\032/\367^\303\313VZ\312hl{\271\223\020\310\342\002\365\331\313\355B\347\003JG\224h\357\315\375\224\246V\206G\363no?\017\027\177\036*\376<8\370\363\274\340\317s\202\277\2062\3745p\341\257!\n\177\r_\3745`\361\327\020\204\277\206%\177.;\005\005M\027K8\260\376\337*H\331B\263\201\265FJ\302\305E\201\340 M\270\270\350=\3224K\232=\237P\242`1\341\342\242Yg\3202\263'\234\234>\301\205"
+	.ascii	"\"\035..z\305\356\223Ke\005\007N\372\031\032v\273j\302\305E\233"
+	.ascii	"\374_\261\261\033\206\201&\\\234U\372\234\"\203\213\213b\311"
+	.ascii	"B\006\027\027\335'\3221\351\\\372e\033S\350NJ\321\244^R\266T"
+	.ascii	"\313F\246bR2\351\332>J\343\266\211t\205\024L\352\266{\n\227\266"
+	.ascii	"\245a\322\2674\232rI\315\244e\322-i\227\215b\0377Rz&Ms\235\251"
+	.ascii	"\\\212\345\323,\251\232\\z%M\233z\302\305E\313\236\240AU\244"
+	.ascii	"SnZn2u^P@\316\310\3414y*s%'\320u\005\006\312,B\245\t\027\027"
+	.ascii	"\305RTxL\251\201V\207\213\213\036\001\273a\367\031\325\217\306"
+	.ascii	"\017N\310\260\020\314\304?>$%'\240\3066\206\f\216\373\220\224"
+	.ascii	"\334\251p\024FLU\025+7\355\202#P*U\246P\261r\005\205\213\213"
+	.ascii	"\2229q\302\f\363"
+	.string	"\206\335\300\240brg\240brW\255\t\027\207\273\\j\205\310\022.\356\213\\.\222J\371\220\224\234@\227\020\262T\016;\301c\231+I\201\243+X\212\034\236\202e<}\300Z\302\305E\213\310\245U\2100\341\342\266|*w\271\340\037\b\320\"\313H\230\240\221\253\200\276.\232wg_\340r{\3735\300\340\257A\211\177\0064<E\333\255 \206\006\030\326\237a\f\377\f[\370g8\343\237\201\214\177\006/\376\031\202\360\377\\\365\251\224\377L\225\211\244Qn\224eJc\260\206\002\305q\274\202\365g\270\301\323\262l\2252?$%CPsJ\313R\252\324I\346JR@\r\206Y\372\344:\323\262T\352\323!\351\324\363\360\350R\270\250\341\334\232\314\246\312\232\022\r\254?\003\023\377\222\206\245L\264\021J),\255J\3012W2\004\250\024\3204,U\222\225>K\2708\253\261T,mr\235iX\272\204\003\217"
+	.string	"\310\230M\256\177g\216\377\316\027\376;]8\330\177J$-\222~\341\245\225#NdX{\325\310\035\211\221\302\372w\260\360\337"
+	.ascii	"\313\210\nj)\216<\224\314\225\344^PJ\320\254\253\264+m\246HR"
+	.ascii	"g\232\344:S\2564\353S\255t\213,\345J\255~\314\204\023\001RR\272"
+	.ascii	"\032Y\246\220\335\350\337A\343wyw6\006(\374w\304\370\357|\361"
+	.ascii	"\337i\362\337\271\342\277C\204\347\347\335\331\r\340\301y\232"
+	.ascii	"w"
+	.string	"gg\344\355\355\337\231\301\2439O\254\344\202`\255\217\220\236\272<\257\027\003\206\254\235Ye4\372x\237`C\326\316\242Y\224'\002-P8\302\017uX\203\353\357\347\023@\013\024\216\360\373\371t-P8\202M\373[\333\232\037\352\320\002\205\300\037\352@\001\353+\"\032\376xD\035\021@k\316\337{?%Z[\326HD\206!\321HH\003\r\333\342\007\026\376\202\026(\034a%\226\300\376\017H\\\205\253\020\177\016<H\200\007\037J\350\376\303\0024X\200\006\373?,\300\307g\001\036\370\360\367\300'\267\026\332v\257\304\"\313\256\304\022\330Mb\005\312m\360\203!\321\027\001\335\t\272\375\241\016\276\021\030\326\326\027,\376\202\276\337n\003\371V\242\n\264\n\201#\210\206?\234\266\310\215|\301\025H-*\362\266m\213j\273\n\025]\240\250\250\266D_\313\362\242\242n\r\201U}#vEE\265]\205\366\017u\b"
+	.string	"\253\n\001\203\204C\020\304\265]\211\200El\216\220\375\251\300\"6G\375\375"
+	.string	"u,\004\025\005U^p%\241\006\375l\204|\255\372\033\2567B\276V%\006\177%\324!\3217\002\207U\207D#\241\335\256BD_\313k\325\237\rV\"`[4\034V\200\027\004\"\304\007\254\rQQ\304N\230\302\020HC\333\n\t\201B\240\217h5\201]\203?\243_\016\253\202\030\022\215\204,\020\025\331\334\nU\242\314\252$V\240\226\325\221@\202\b\240\340P%\332\"RX\205*\321&\372Hd\342\b`\320\367\263a\325\233\037\352@"
+	.string	"\342\032\f\002A\030\006\001\203j\332\034U\367C\035\332_\221\330\262?\254Zbm\213D\026P\370\r\203\252\272[aq\370SU\035q\025\2460TU\035K\\\331\242PU9\220\020\210\202\252nV\b,bUU'\034\002Y`pU\325]\253\266,0\250\363C\035\330\265\310\250M"
+	.string	"\320J\364\r\261\t\360\300\266\300\021\036\212B\241\004\224(\n\201\301\004p\340\201\352\301\207\022\036V\240b\360'\004z \262E\017\nhK\254\302\240OH\\[!P\005\362\255\304\241\266HU5\220X\211E\252\272[\026\030T\325\355k}@\252\272\211\276\241\237^A"
+	.ascii	"dUu\243\360\033\006u\013\024\216\320\002\205\300\035!\b@\276"
+	.ascii	"\225\270\211m\t?a\021\004_\353\013\001\344[M\030\022\215B\350"
+	.ascii	"\021\202\200\363C\035\200m\211\225\270\006\201\204>\021\200m"
+	.ascii	"\211\265\327\n\2030\253\376V\023P\370\371F\004\203>\020\300\266"
+	.ascii	"\304j\001\330\226Xu\313\252\300\"\021Ak\210\265\310\350\004u"
+	.ascii	"\204\022D\330\254?\241\257e\205@\336\252\027\030A\013\201"
+	.string	"%\b\331\337\006\026\261\231UA\374\214`\003\342g\204\335\376\375"
+	.string	"\363\017u`\213#zX\225\004 \035\342\332\262>\242\315\262+\021\b\310\247[I\370\202\"\212ED\274\250\222X\201\330\342\b\316\252\353\017Hb\r\301\026G\330\254\352Zdt\002[\034\261[\213\214Z\2668B\307\026G\3445\350\373\261i\316\220\270n`H4\022\342 B|\320\252?\033\264B\240\256\204\013)\370L"
+	.string	"\021\342\203\225Xl}\304\265\210hmm\332\037\352P,\"R\207D#\241\337\317\347\201%\256$\200D \003\254\252\t\032t\240\201\007\305\"\242\236p\bl\213\301!\273\022kX\025\303\252\026\213\210l\332`\221]MXC\024\213\210.\254\252\312\023\n\001\203\037\2508 \020\201\002k\3533aH4\022\2621\002\362\255&\370Z\037\320\216\310\006\251CB\300!5\250(x\023T\024TA0\204\302\317\006C\027\330\242!1\004q\005\002\222"
+	.ascii	"\206(\026\021\345\264\252\220\357\204!P'\344;\001\330\226\220"
+	.ascii	"@+\034\241X"
+	.string	"D\204\263\252\274\225\350K\001\210\350\023\201\327\262C\255\217\210\350\262j;$\252EA\275\022@b\353#\241\025\256D9::\326\006\205\3370\b\002\310\327\262k\361\003\253\t\303 `\020\016\320\032\034\341\023J`\030\004\f\262\031\006\001\203rH\350\206D#\241\232\026\005\326G\202\r\253\336\264?\324A\265\300h\250\r\372\326!\035\253\2020$\032\t]\330\334\327\006\327\0208\353O\350\003\022}\032\300\001Z\205B\300\240O\307\336\264j\313\331\f\254D\300\023\330\342\020Hb%\026\361\202m\260\350\013\2521\"\016[\0268\244\033bWbP\272\205@_\b+\013\034\nw6\302!\220-\006\355\226UI\254!H\254!D\244\340#b\b\342\354\264?\324aH4\022\222\300BQ\255\300\220h$\324kQ\270\254j\263\266\276\226M\327\326\327\212\360i\213x<\037\237\336\317\315\316O\006^\373c\204Y\025\310W\374"
+	.ascii	"p\004O\203\021\330g\004\376\031\201}|\370\307\207}J\340\237\022"
+	.ascii	"\330\307\b\377\b\215B\bs~X\326W\224\3020\330\373\001[_\313Zh"
+	.ascii	"Y`\t\337\216Uq\210m\t\037\350\264*gu+\020\220\330\262{-2j5\273"
+	.ascii	"\333"
+	.string	"\037\352\340A8$\"\032\376&\370a\321J\364\320\016\207D\0176-K\004\006\325\260j\217\330\226 \004\201\002\031ZV]\205|\255\210\240\013B\020\214\202EE>\035\253[\205|-[\323\n\213C\020\301UH\\Q\260\021\002}C \206~\355\320\002B#\240\036\bDX[\237\tk\260\210\310'\342\367\363\345\254l\006\206'\f\211FB\273\025hH\202p\bl\177k;$\226p\001\326'\302\220h$\324\023\034\016#\240\246BB\240P\bA_1\304\312\0261\264j\211\025H\bT\331\037\220\310'4\002R\333!!`0H\003\013,\361\201Pq\304\032bH4\022\302!\256m\020\b\302\215\020\350\201O+\004\026y\t\037\tAE\025\020\032\001\355Z\365C+\004\026u\357\343\003\242\202\fX \004\376\353 \034\002[\037\013\f\372\200-P\b\364\300\022\207\254pe=\b\201>\"\017?\"\353\241\303"
+	.ascii	"P`}$\260\300\022\037\2440\f\006\021W\022C\235\377\327-\177K\017"
+	.ascii	"-\24716\230\2644q\262\201u3\213\211\311\307\222\306f\323+\274"
+	.ascii	"`(\315\320\265h{\306@\222\361\273\213[rH\027\326\177\235\272"
+	.ascii	"\030o\021xS\312\241\203\261\301(\201\021\005\205\365\213\027"
+	.ascii	"\373\215g\231\327\272\274Xi\253%]ggV\254\320\265\350`\312\rZ"
+	.ascii	"s\303\206"
+	.string	"\022'\035\213\327\265\330`TP\256a\375dn\330\377\357\364\221)'\035dMM\373m\305eb<\203t\2368\241c\272H.\340\345D\234N\305\353\230xTA\234da\255K\241[J\275T@y\351\226tJ5N\302\210\204\201\202\263\205m\t\251Sa\306\326\025\030\254u(t\234TR\013\353\247\240J\207\244\340\207\t\023\033\f\3172\257My\261\312ch \257\260~\n\372\321\221\017\324\032\013\253\336\2352\340)a\261%\261\376\rf:\243\316\270\301\\$\235\211GjE\0069Z3\272X\301\3727|\361\337h\356\236\233\333q\237{?za\352\204\034\275H\025\331qw\3139\267\334\216\273\315n\f\204\272\250\223\202#\222@\242\305(\214\004\025CF!\022\032\3426\243\024@Ph`(\222M\205M~\023\300\002\315\312\243\331P\0172\246ff\244 IQ\262\354\031\242\021\033q\375\371\t*\315\243"
+	.string	"^\234\212\251F\350\2044"
+	.string	"\217~\270\304\030p\250"
+	.string	"\250\251`\312%|?*8\001\244\303:\363\355`p\2269\372\225\366k\022u\213\326[\352}b\007P\252Yf\206M*b\246\356\272\017\313\304a\204\2012\202\222C_\207\314\334_\300\222\255\210\371\206\023c\340Ep\024\241\3101\306\362=i\007|\032~\331Y\rM8\022\220\201\252\001EAg\3038\006?p\347\177%\035\300\360\304\261\350\017\340\226J-\242c\300\241\232\355\362\311\205/\363%\244H\365\016\373P\027,C\241\357T\331\246<\251\313\370J\2665J\253\357\262\017\271\273\036\375uf\237\244J\271\200xDV\t\354e6\374\n\343\026P\370\020H\n\246(\304Dd\311\317\025\260\246\351Dl~\365\320?\026I}\371_f\025\b4\373+gU\020@\026)0\326\027Z"
+	.ascii	"^\232\320M\206\207\031\214\307\351\031\345fO\274\2006*\204\026"
+	.ascii	"\016,\nH\2230Q!\005ao'\301c\227F\325D\323\253\310P=\\\030D\203"
+	.ascii	"\347\007\351\"|:\016\363\217\354\314A\216\006\245\340\026Y\263"
+	.ascii	"d\325\3608\030\032\374F\245\265\214"
+	.string	"\035\334\375\304\020\216\201d\321+!\256$'\207\030\302szP\007;y\2209s\204X\274\360.]G\377M\250\022O$)\275\313\344\267C\b\254?\373\t\335\\\236pF\364\234\233\306\302\f(\004\314\257\257\312\220\034\230\006E\271\353~\026\333\331\347T\3162[\b\f%\324\002D\210\351Q\231\332\337\230 \032KO\323\330uscp\026\026\232V\363l\nW\013\313}b\254\355\204\350g\023\233,~I\347\f\302B\221\351C\253\270H\323[a\217;\002\273)\035@b\226\0204\025\020\032\310\3452\275r\031\340u\366v\271\344\25308\350\330\272;`VT!VT\343\361 wQj\260M8\253\21400w!v\224\263\206\026\240Eo\032\254\334\031\214\263\300*<\273\243\366\225?\341\245\233w\352mA\215\200S\272\263q\335y\353\336\310\375\257_vx\355\376\275K\350\270\237\r\344x{c\034=\367\340"
+	.string	"<b\316\237E\nmdv&\355Kg]\314\327_c\036b!\372\224\200\233\022\311\366e\374\030\231bh\304\261`\340,\306u\306\027KY{\253\217\351\352-\246\362\306$`\234^\320s\nI\215\bRD\372\263E\331\221\313E\030a]J\233ly\343\037\035\314\300\355\311\302c7x\005\337n\r\322\247\204)\375\375PjV\203\331\360\346~R@q=}\335\300\021F\354\332\333\302\372&\314\003\\k\360\372]OB\201\355\265\025\325\240\221\247\022\007.v<Hc\241\320\023\3315 Y\nr\310C\226\254\256*\216\026\216\347\327KbJ\213x\226\232\302ar\224\374\317"
+	.ascii	"\265\317\030\240\235\\Z\330\334"
+	.string	")f,,D\201\351\341\201\235\002\230\023\213\305\267Lh\247x\207\204\\\324\302\356\304<\343\r\220\231Q\234\\\346\234\016\nk\372\237\275\312\241\301\301wg\3551\377\332\315E'\313[\240\300\030\240@<\314 *\243\025J\302Z\341\316\206"
+	.ascii	"\230\365f\366\027t#\375U'\034\366g\206%\r\374\364w\006\223\""
+	.ascii	"'\342\213\235\030\245 \257\241'\372\365k\266\t\2379\025+\"\235"
+	.ascii	"I\331Zd\344\241\017/\230NS\004\336\226\004n\272\343r\207\301"
+	.ascii	"\354\361\350=\302@\026\227h\352c|\021?&$\0032\232\345 h\210\205"
+	.ascii	"w\254\005V\00652g\035\322\"\213\275\262/\013\2751\222\004\342"
+	.ascii	"f\367\364\216\002]w\261\360\257\216\261D\377\022\245\021\210"
+	.ascii	"c\334"
+	.string	"%\333\346\272E\232l&2\232\007\336\353b\250\376\r+\310Q\033\002\333\251\001\212(\236%\255X&?\222\366\377GM\304\3403\275q\277\315\324\244_;5\333`\tm\357\3229\fK\325X\3429\260_\020p\025\233\362\216\344\266t\257\355+&\263p\325\237G\036\311\313\332\261\037\373\032\013$\331`iP\034\317\301\331\267\004\317?\213\022\3548\030\025;\363\300\365\364\005UjK\325\215i>Sp+\241_\031\0067\361#}R\315\"\232\244\311\212<\324\352\244\036c\205\033\203\304\006\021/r\303p\276\323y\310 /\320\243n\241\215\313\3631=\231\335tk\335f\205\372\327\nO\2067\f\315\215\307\310\255\247z~3\376\253\373\334\354\2204T=[-\336\261\r\334\372\305\347e\203\357:@\\%\006!\372~\225b\033\332\263\031lt\215\033\241\037\003\021B\314ta\375\212\202\201\240W\t\227c\201\315\375U"
+	.ascii	"\334\201\007\210\334\037:N\322\020\2551\211#6Y"
+	.string	"\274\005O\200\023|\252\\3\3439Q\315\210\020$z\361UmY\b\273VK\317i2Q7d\024\353\bo\254\007\313\212\366\234\\{\265!s\305\301\305N\327\024\001\206&\225\234l\353\224^\312\020\222I\265\310\372?u\324+\231[\004H\230C\321\360\fA\352a\300h\326\221\332\013B\265\263meD\216&\300T,\341\t\031\345B/$\343\177\337H1\361\244\366\215\377\305\371\344\221JBw~-%@\215y s\326\245%Ew\323G\256_@\336\037\001d9\334\316\t:C\200\342\271\223x\313\331\255X>\362\275\260\r.K5\241\004\322\310\341\255\363\340\330\020\026\250=pR\320\247\303\205\233\306\361!q\0341\310~K\306A+\271\272L)\336a\261\013\320\333\r\bU\003\315\020\301\234r+\306\205E\310\342P\251\036\341\277\255\003\335\035\177\365\027\353\026{\360x\215\r\320T\004+N!\310{B."
+	.string	"T:\036)m8\346\272\361\212\r\341\303\365\215\241\375\312\303!\200\260\200\264\376s\332\2207\2030\334B\311\243z\302\203\203\262\027\330`q\201\262\004L\335yA\307\300\317\350\221\260\230A\227!\234\325I\370eP\320\362;5\311\375O\317-\327\037\302\001G\314\307[\r\235\024\021OY\267X\323\305+\216\215\0230Da\275\276Cf\276\212\2231\360h\032D\204t~\240W\345\261S\222\016\305\361\330<\326XKG\206/\335\220\036{\326\016V\252\241\370\216\2043\tz\334\013R\326\211a\236\243F\350Ul9\322&Y\275B\233P\021\310A\025"
+	.ascii	".\020;Tw4D!\304\257x(\020\366;n9\242(K\f\270\253\204<\305=\342"
+	.ascii	"Q:\341E\260\304\252\327\272d\234\337\317\331\247\002?\017\f8"
+	.ascii	"\357Ik|\352\374\317\370\242\006\341\017\324\240\027\216\236x"
+	.ascii	"M\246\205B\213\247P\034\231<\3771J\323D\357\240p\021w\247\341"
+	.ascii	"\025\r\204\271jar\007\3507\326\276\271}\200z\342\201e\006\366"
+	.ascii	"\204T\234m\023\2727\242\210\260-\325\006l\222\201\353\330\203"
+	.ascii	"\225\f\243v\360\025\305K\">e\366\200W\003PN\002\nrG:\221\234"
+	.ascii	"\210\210\240\271$d\030\336\267s[\226\037\216\331a\260\354\220"
+	.ascii	"\031\204$\211\373\253\217\030\243g\225\f\025%6\320\263%L\362"
+	.ascii	"n\306.\255\265{\203&\345\231r\225=;\024\307??\251\312\220\311"
+	.ascii	"\211e\304\365J\347\263\213\344 \337\314\036\214o\366\326\326"
+	.ascii	"\310C\024\332\374(\201\317\254,\345\001\005U'\222P\373\344\314"
+	.ascii	"\363p\021p\207\301\201)\271k\236~\3420 \336\177\301L\352\b\026"
+	.ascii	"\330\024(\346kg"
+	.string	"\016!_\236\254\340\023\030\310\002\t\251\r\322\312\034|\337\215\341qk\317\021\255\265\313\217m\205\313\316u+\032)r\332\266a\353p\202P,\273\365\3304xO\b\0272\323L\274\203\261\\\341\317\335p\350-\232\321*<#\032]=gL\033FE\226mA\246\346\256XA\242Q\376PB\317\031\352#:\267\373z\350\214\302\2670OI\314\304\377Dn\210Fr1g$\271y\366\373\026a\314\254'@Z-\221->/\210\312\231e_\031f>\365\221\205\363\027\274\273\342\034*\b\016\354\374\004\031\217\027B\2669<\257,f\221@\331b\334\341\021{\265\325\221\252 \262\034h:\273A\330\266\017J\"T@\314k1\227}\033\221\346\353*\005>\346\376\242W\361\372AQ\230\005\254o\277\2065\252zc\b_\221\204OS\357\211\037\001)\325\246j\207\277\345\312\030\340\325j\344l\236\314\247\300\036\366\346\374\027"
+	.ascii	"\374v\333\b\245\006\270C\032\3755\036\262Lm\340W\304R\0065\232"
+	.ascii	"}l\031\226^\321\3600X&\250.:\234\323WN\036Zi\007\006\202\273"
+	.ascii	"F\357\326.6\177\314\035\250|\302\006(\2178Tq/\320\214}\t1\373"
+	.ascii	"a\250\350\304\003Q\231\033K\322\336\032\325!\343\330\006\013"
+	.ascii	"b\253\317\331\213\332\003\211\177\272\371~\212\300\325L\346\201"
+	.ascii	"\330]\330\367\021$\302$\341\340\005e\303\356LN2\327\026k![\025"
+	.ascii	"~FaoFv;#\346\375\306\003S\276\177\230\202\"pAp+\224\024_\310"
+	.ascii	"\237c\247\262jE\234\301\036X\253/\374\364h\313{\003xO*\0224\315"
+	.ascii	"\224`\333\231\322\231\367\b\24661\252\212!#\327\244:5i3\270V"
+	.ascii	"\230\260\330\236N\257\310\326G\234C\270\253\025\324\330\r:3\305"
+	.ascii	"\354@YA\037\357E\321\033\241\0340@\320\212\275\200-\340\241\023"
+	.ascii	"\315\340\360\035\264I\345\210\270\203>\267$\352\243\030\331&"
+	.ascii	"\r=\323\242\320b\365\240\314I\031\350_C\006\226?\317\266\346"
+	.ascii	"\363%\314M\333\217\255\273k\337\\/2\371\327\3472\254>?3\321\241"
+	.ascii	"\"\b~\rHW"
+	.text
+	.section	.gnu.lto_.symtab.a40faf99a0a011c4,"e",@progbits
+	.string	"sensorsPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"requestedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a40faf99a0a011c4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
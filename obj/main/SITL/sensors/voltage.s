@@ -0,0 +1,1000 @@
+	.file	"voltage.c"
+	.section	.gnu.lto_.profile.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\215\006"
+	.string	"\364\t4\001"
+	.string	"\030"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\325\310\265\302\r\f\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\310\223\203\240\006\006\002\002\003\005\371\265\336\203\t"
+	.string	"\006\252\332\353\212\f\006\001\002\001\007\242\347\345\357\016\b\350\300\306\254\005\002\002\004\002\004\t\240\342\234\212\n\n\223\222\374\225\013\b\002\005\002\006\f\334\310\213\211\n\007\002\007\016\274\205\242\255\006"
+	.string	"\017\020\271\334\201\226\013\021\022\250\246\240\304\004\023\314\251\277\367\n\024\224\265\361\317\013\025\026\027\242\302\263\302\013\030\031\225\254\310\321\004"
+	.string	"\023"
+	.ascii	"A\211\245\3562\230\366'=je\336\305\230ST\206\353\fC\346(+D\240"
+	.ascii	"\tF\205+\006\216U\253\003\244\314\"\252\375W\020\313\rT\200!"
+	.text
+	.section	.gnu.lto_.ipa_sra.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375 uu\002"
+	.string	"\344\002i"
+	.string	"\016"
+	.string	"\001\001\002\004\005\003\006"
+	.string	"\001\007\002\001\b"
+	.string	"\003\n"
+	.string	"\001\001\f"
+	.string	"\001\016"
+	.string	"\001\017"
+	.string	"\001\020\001\021\022\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\r"
+	.string	"\270"
+	.ascii	" \240\3120p\342(s\250,L\325\214S\257\20080\230\312\264\227\340"
+	.ascii	"6\320\006"
+	.text
+	.section	.gnu.lto_.inline.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`\244\001E\t"
+	.ascii	"b\216-0`k\222\016\220\203\204\327NP&\006\275\276M\360\007qQ\336"
+	.ascii	"X\341\351\201\272\233\264\277K\b\352\032\206\341\004\310d\373"
+	.ascii	"\371\266u3\362\355\267-w\n?]\267\363e\227\021`\307\306\005\007"
+	.ascii	"N\231\352\343\217z\023\0275\341\n\236\250\b\343w)\304\002\303"
+	.ascii	"\003t%\200\0020\301`&\323\252`0\"\323\222\226\376~\374\266\322"
+	.ascii	"tI\234\247\353%4\300\315\246BC\240\217\007\315\260\220p\030\030"
+	.ascii	"\262\264\375\243\234\331\2773\205\211?\204\221\231\322\020\244"
+	.ascii	"h\255A\354G!3\255\217P\375aA\254\252qP\323\320\277K\344^\252"
+	.ascii	"\231\231\317We\375Y\357\373*l\2555\310On&/ P\"B\252\314\003\302"
+	.ascii	"\b\331\223p\003\326\306q\201\326\251h\203\3138\326\340\210\024"
+	.ascii	"\230\222\347\214\344\222]\306\302\215\201q\307F\224\\\273\301"
+	.ascii	"\262m\003\263f\331&\260\260s\204qC\354E\001\365\222\003\013\204"
+	.ascii	"@*\221C\253\321|\326\005\254\275\206\321\032\256\275\301\374"
+	.ascii	"\205\317\210R\260c\270\333\025\207\bi\304q\\O\350yC\355\376*"
+	.ascii	"\253i`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"-\006"
+	.string	"\222\n#+pK\222\016\374/\004\016$\240o\233\\\321w\001"
+	.string	"z_\334|\356\362\013U\025/\027\341\2003\242n\033\032jm\221\264Md\222\001$\257\177V\325\013\030\020P\275\245l\276\020\371\220\016\331D\321\324X%/\270\006c$\250\265\305Wl\027C,\343\210\r\310$\221\b\221H\307\203$9\020\324\356\307\372\307\352l\250M\334\246\311'\246P\340\022\\`\350\020'\320\344X'\312H\206TT\217\351=_"
+	.string	"r-\211\251*=\365t\370A\027"
+	.string	"J\220\003\330qG\254ap\227f;9\337T\305"
+	.string	"\302$I\230@\234\005*\350\002\371\202l\200\237\025(\370\214\002\027\217\nF\254!\002\\\006\246\251\\Y"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\007"
+	.ascii	"\232\004\b\204\004\n\270\004\f\231\004\016\200\004\017\200\004"
+	.ascii	"\020\232\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\004"
+	.string	"b\205\021\033\220)\3510\377\377k\353\256b\233\013\357\3053\006\032\241F0\370!#\255\312\224\002*\030\215\004\300\227%\350\2673b\027\222\2428\016\333\300\223-\260j\263,\260*D\353\350.\332\236\031\3664%\375\307\0224\372\"\036"
+	.ascii	"\220\005`3@Z1E\323\016\f\006\203(\031d\260\272\273\213\3013t"
+	.ascii	"\316\2135\211\245D{\t\261\213\361U\220\312\001\2647\013\240E"
+	.ascii	"\300`\206\207D\t\321S\202]\351\002e`g\307\316\301\272\314^F\036"
+	.ascii	"@\021"
+	.text
+	.section	.gnu.lto_.lto.9039143f549d1d2f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterSourceNames.32.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bU"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\265\001}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\270\265\005}\276'6\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_voltageMeterReset.35.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\355\b"
+	.string	"\306\220=8@\217\322\001[\350vK\3641\316\232\237\245\350\304\363AR\332)\037\300\3206\325F\220\035wd\204\036\f)b\223t\f\017\302W\347\202]\020\316Ax\207\b\331\335\366N)*"
+	.string	","
+	.string	"."
+	.string	"\004\364\323\236\275\362\220\264G\2252R\254\335\255\262\343\336\243\347_\344"
+	.string	"\242\321\367x5\354\256\243h\264q\313\333F\260\275`_ \226\240}\323\037)}Q1(\331\325h\271\354j\236|dl?\332\007y\210w\023\350\003\273 \212\311n\250\340\004\354\323\341\013\350'\366)\254\243nO<5YT\254\177\250]\361\221\017\266\273\f\376\311\342\"\200\344\361\351\203\350\347uR\225ZB\261e\207_\224\034\3661\273\273\001[\326e\235i\216&{\330t\021\032E\3456\215\363d\\\365@l:\225\263qUs`M\"\333j\247i[\315\204{\314J\320\016\255UHbp'\271\276\016"
+	.ascii	"2\241k\034\030\027\f\030\006RJ\250 \360\244(\371\024\331\220"
+	.ascii	"\261\254`\336%\200f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.38.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"%\t"
+	.string	"\306\221@:0%'\035\215\213'\026\325\3510\364@\013M2\243\203\031\003S\300\007\272P$\260m\350\326K\253\005\306"
+	.string	"S\r\365X\n\nT\021\211\311\232\225F\270\\\ff\233\265M\344N)/"
+	.string	"0"
+	.string	"-"
+	.string	"\253O\210+\345\002`7\234\016O\300\271\354|\200s\251#\367\036=\377)\307L\300\227Ouz\f\210\330]\307O\265\272\365\266\025l7\330\266\tQ\243/\005V4\007\257]\217W\200\235\2211%\266M\266\307\266F\333\341\301\364\326\206u\027\344\006f7d\360B\347\322\266\177r\024\223\275\202\020\f\3468\313E\002\270\273\020*_\351|\222Kc\224\342\277K\277\244\257\371>\242^1\231\224\013\025_vx\212*b\037[e\331\216\326\267\376\032\231\2046\222\026\201\262\211\020\211b\313\230\035\267uZ\326Mm\024\252\230\"\256\233 \003o\026\0317I\333\306MO\270\307VYV\004\224v\330o\361>\340g\007\013"
+	.ascii	"D\023Z'\306\345#\251\232Pl\202u^h/\241\272&RbA\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.42.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375 \241\265\004"
+	.string	"t\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\305\242\037\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\030us\250\374\007uq"
+	.string	"\005\001\006'\001\003\005\001\006\035\001'\001\202\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.43.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`'\001}\r"
+	.string	"\346Y[B q\223\016\fL\261\360@\221\312\200\271\232iJ\316`j\344\201\353Q\335\324"
+	.string	"\002\344\"\f*\367\035bk\230q_\303\"0\251R\215QA\200\006R\340c-\310P\236\302\235^d\350!\333\366\2262\245F"
+	.string	"H"
+	.string	"H"
+	.string	"1\336\221\354\277\016\033\276\032\273ki\b\377\260\273aj\217PS\3631\037\247\037(\241\261q\241G\250\331\335"
+	.string	"\\\006\250\311\021\027\222P\004\351\372\225+ Im\034\351\211\371\330]\347\306}\270/\267\215\331n`?\013\273#\251\033\313\022S\234d\336\263\377\275\363W\234y\264G\234\204v\317*\252\220\207\n\365\215\310\330]\216G3\250\0365\360\231\264\217\362\024\355*\030\n\bX\021\217\003\212\335n\201;\252Gw'py\254>\340\362h\315\016\273PM\250\233"
+	.string	"\2017y\t\013\023\262\305\305\256\206o\217>\352\002\210o\342W\270<&h\031\201\020e\312Q\257\377\356`E\tj\233!\312\224\252\232\354.\224Z\332\335\220\265d_\345\217\367\356|\372\030"
+	.string	"(-\020\320\b\236w8\237\r(\373x*s<:\0176 \b\027\005+\303\256\354\323\311\254\217g\023\301\342`\231\345a\300\227\204\016f\201\256\013\2632\335^K>\275:\221\302\"\322\020G5\031\303B;\2560rd\333\034O=!\235\274\027\"i\343p7\031"
+	.ascii	"2\003\376\031\322\340E?\256\304\212S\267q\272\b\316$s!\314b\\"
+	.ascii	"3\346G\224(.\013\241=U-\007rV\035\313\332\002MX%\020\0277D\224"
+	.ascii	"\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.46.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`f\001m\r"
+	.string	"\006\230XD"
+	.string	"Q5\0358\320F8\335YU\005\013\203\256F'?\207H3(\374\313Yh\204\017\340\020\320\342\020\277\205\033\"BD\370\016\t\"#(\273\033UUUo\331R\370\006\254,\277S\255\276\034\374\264\311\336)\005C"
+	.string	"C"
+	.string	"G"
+	.string	"\316qr\265/I4\224\262\335\345h\bk3|\325\350\f\375\326g\207\021\361U\303\354n\2001\203\2061\215\244\251\2258\235\036\366Y\202\203dCd<}R\030\354\256gi\344po\267\375\300\266\001\373 \001\004b!\262\035\2439\243\224\252lR\234swE\323\224\375\327}\n\2702\035\231\331\356\206Y\217\235QKH\374u\373\037w\3710[^}"
+	.string	"A\370\227\250\262,\212H\031\303d\227,\360\352L\345\365\026\207\016\030&\217k\273\273\032\204\303\360.(\326\310\013\023+^\336\376\334\205wA\255Z\260"
+	.string	""
+	.ascii	"\242Da\337\333\354\356!\336\005\225J`;s\0200\364P\343\203kw\025"
+	.ascii	"\244\270\212\t\376\210WW\2600_z\365/l\257\377x\236\233\243\351"
+	.ascii	"8\330\204\"t\0248\360\353@P\007\344@\236\315\207\343| \247\031"
+	.ascii	"\340NB\347\343B]\367q\026rOS\2557\210\355\211\311\210\222\\\251"
+	.ascii	"\312\013d\320_\264U\021\363$?5\371\242\355\364\260\01389!\306"
+	.ascii	"h\334\b  \300\002\0323:r\300\340c\304\030~\204\024\213d\204\020"
+	.ascii	"\300=,c7XDL\307\203\221\033\027\204\021\225\2541S\207\262f\207"
+	.ascii	"\007\026\323\271\263\356I#\023}\246\327xBtf\260S\243\335\207"
+	.ascii	"\337\310:\200\310\353:O"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.47.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`q\001e\r"
+	.string	"\006\030XC"
+	.string	"s\233\016\254\244C\204\020\004\300\323qy\256\345]!\272\330;(\335\003j\037\340O\376\001\321\365\025\n\201\203\377y:\240\306a\276\226pU\225\003\f\005\371\203\b\016\364TT_\277\r\0315\022!r\247\024B"
+	.string	"@"
+	.string	"I"
+	.string	"-\304\2138\370\332%\341Bc\227d\340\005\326\251\0047P\235\232N\240:e\321\346q\362\304~e\304\007\225\230\335\315\324\304\305O\321\177\312\257\221D\3443$\302\356z\216$!n\275m\005\2667\366K\001\263d\223\"SK\330\237vw\255&\366Q\376\352\242\177\322i\325\351\251\323\317\004\300\241\003B\216]\020% \373B\331@a\373\230\355I\336\205x\224\320\201\001\353!E\204\003\353\224I\353\323>\213\007S\355\3555\324\007\367\262\273Fe\f\313\214\251\327\250\374q\2659\227\321Y\217\001v\n\3548\t\271\214=|\3410:\254\244l`\033\364\225O@\n\026\025\273\373@\345/2\370'\247\034j\230\0377T\247\256XI\271B4\022 \367\341$"
+	.ascii	"\360p\236\247Y\330l\025\264\2147\r\307\321>\236\017\224\205\340"
+	.ascii	"\027z\\\230y\035\255\31360\3144\b\374a\340\300\354\363}`\206"
+	.ascii	"\221\373i\325\304\023Z^F\264\203Um\no\t\242\375Fw\301\220H#\325"
+	.ascii	"\013\206\024  \320\202\221*\363\226O(7\235\026\303\300\252\277"
+	.ascii	"@\214\355v\254|\305\366\030\305\036\323\030:\221F\226\267r\032"
+	.ascii	"\273\352\210\035\244\261\363\314\031\351H\262\240\371V\n\262"
+	.ascii	"\254Z\274E\347M\370\355\224\357\005\343)\260\313\213\026\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_isSagCompensationConfigured.48.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375 \350}\006"
+	.string	"\"L-3Pm\222\016\244\204\270\2327\210f]"
+	.string	"\004"
+	.string	"\200\267\221\346*{Kv\325\376\335\016\360\332\025\203\371\242\266\315\314Lq&\367\245\226\t\242\301Qc\232%[\246g.\023\003f\343\360\"\\E\275J3UN\323\200yp\031\252r\027\202\037\304D\271\315{\224\263`\331&\302V\360i\023_\220\206XWc\t\016\366\252t9"
+	.string	"\225\260\t\\|0{\314\203\r\343[\311&\372ql\003&%\n'\231\240,%I\244\021\216\277\363\226\021\022:[\3052@\035mP\210\240db\256\215j\025\255\333\217V:<\262+\344)\006,d\346x\205,z\353o\360\037\374\025\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.49.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`\364\003\335\031"
+	.string	"\006\357\242F\240\034Q:Dp\277\344s\035gj\361\340\207\023\202P\370v\235p{\033Rs@\226=\017B\245\230\032\037\277\255\214{\271t;~p\232\356\3636\254r\207\fA\363\207u\241\026i\242~\263\3457\322\366\336R&\031\221"
+	.string	"\207"
+	.string	"\217"
+	.string	"\367\001\211\325\210*\nS\222T\255@\004\237\233@\374\334]\261;~\362\270\266]5\007\376\250gR\322\242\t\234Zk\254},k\305\266}\305\022\3518e\263m\277\344\005zB\335.\350+\331A\246\246\213yQCF\350!\001\371O\210Yl\343\242\212B\217\"\243\323\\\221\215\217\022FDDw1/n\310\003RW\334\344x\312\270|\355p\222"
+	.string	"\360<\264c\301\375\337\247\217\2445;\212\214\316*\n\265\326e\335\256\350\333\372\356:\331]\005\273\335&JMSF7\036\256\213w\276^(\202\357\237\210`p\246\237\375\220\317\035Q\202\257\233\241\340\353\366\300\337\205p\367\224\353\240\036\203&\b\245\373h\027(\304\347\211\321C\332\346\355R^\030\345\325yM^\327}\337\326\344\035'/k\362\256$\257\330\274\252\311K'\357\234\274R\362v\363\362\016"
+	.string	"$a \200\251\225h(\247>M,E\356\373w\2774A\211\314{\017\2568\223\355,PH\265V\340\356\370\244\375\257\201\003[Dx\240\t\002'\f\207l\\=D\345:\215\343\210\223N?\310\303\264\367],py\323\005\371MC1d\020\300\256\236\275\253a\003_G\233"
+	.string	"\213\016Z\331+\274\216\025q\265\336\f\314~\316I\210\207\333-\373TrR\334\335o1\347\306\303\335\345\360+\035\304Zq\017\366\302[\361\360\001\004\b\372\311}-Q\276\033\017\345\354#\376\2326ax\262y\373\032\205u\r\034B\224\316\3408\316\356\245|Jm?d{d|\235\214~\302\372K7\020?_\331\002\037\021=)H\314T\304j\264Y\315\204O-f\342\247\247DLF\253\305\026\f\330\331\t\037Z,\305lF\213\215\300\333\233\267K.\n\223<\335Zh\365\273\3549\215\217\372J\361\325\255\036\272\231\267\372s\224\242p\034\347\277d\365\321Jp\242?\020\375\357\253\037o\252\360\036\210\276zh\317OA\246\b\305\345\341\261\367e\310\034*"
+	.string	"k\\\261\304^\365\323\250Z\254p0_T\355"
+	.ascii	"\006\324\224\217\227f\020\321\240}\264\377slI\202dl\336\262t"
+	.ascii	"\023b*L\250Q,\004\241B\204&\020\tDh$r5\200\002\241*1\017\021"
+	.ascii	"\200\271CD\026\244\225r1!\352:\301s\311\345\367\203\002#\261"
+	.ascii	"IA\322\267P\251x\363\003\324\037\337\305\3646U\354\363\031\245"
+	.ascii	"\304ae\211\201-=`\022\362\273#\231\221%\036\037\037\213\205\""
+	.ascii	"\364\307\037\230\030b\020\017z\001P\317\"\274\036\022\030\246"
+	.ascii	"\242c\210\026\f\303U]\037\020\t\326avY7\350.P\274\345q\200\300"
+	.ascii	"\256O\217O\210\005\252\177\025%S\211\264\303\336\322_\212\357"
+	.ascii	"\277f\367\271]\311\031\347M\177|\302\025]\333$\271\270m\335\233"
+	.ascii	"\335\220\303\324\211?"
+	.text
+	.section	.gnu.lto_voltageMeterGenericInit.50.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`\330\001\225\020"
+	.string	"V\036lG\340\262(\035\222+E\341\003\211\304\250\204\300\344~Z\277E\376\252\026\t\340i\223,l\\\265'\366\263\003h?\234n\341zz@L\263\312\t\207q\303\f\2252BS\274\224\374p?\223\352\236\310,\215\177o\"wJ\001V"
+	.string	"T"
+	.string	"X"
+	.string	"\362 \243\354\033\017C\354e1\\V\330v\267\323\032\353\271\360\236\021u\317\224\234F\224\177\363\330aG\313=\034"
+	.string	"\027\016\001\f\250\2123\204\204\314\245\207s\"`\006.\264\273 p\025\365\341\343\fG\214\226\003\312<z\032\354\256\343\013\310\341\006\271\355\030\333\017\354\353\004,W-\025ov\250\212\332\262\377U\032\373s\330\255\032\035c\364C\b\224`\315\324\310PZ\270\033n=\226\206\2041\342\260\337\2761\034\205uV3a\337\345\207\006]\376u\034\324a$\241U\270 \204\227\315e\333\r\r\\\372"
+	.string	"\310e\350\002\346%\367"
+	.ascii	"\363\001\273\034iF5\305l\254\342\216\355\321sH\013>\200`\271"
+	.ascii	"vW\t\236\302\276\360\026%\2713c\233\341\332]\005\262\263\230"
+	.ascii	"\340\333\\:\305\2430/\243\216\324\300I\305\233U\257\017_`VS\321"
+	.ascii	"d?tw[T[\337\364cW\361\3716\256\300\022\377r\351\263\314K\006"
+	.ascii	"\254Z>\021E(\255t\247\023R\tE\302\200\322m\"\032\221JN(\236\205"
+	.ascii	"\3563y\237\312\350\353TJ%)\235\211\351\353D#\366VF\246\356\344"
+	.ascii	"y\246\016\024\246\2564\366\315\035\370x\301#GJU\036m\371#B~T"
+	.ascii	"\236\210\206\271\316\271I2U?\372\230\327M\003K\025oQ\336\305"
+	.ascii	"GG\315\026n( p\0021\223\325\001\035bE\016\r|^\213\241C\311\276"
+	.ascii	"\243qob\301\017_\232}E\357\272H\335\242gctEi\234t\225E\013\264"
+	.ascii	"\261\213m\321\221\034\276x\321\t\013b\233\210\222\310\201\004"
+	.ascii	"|\022^\371+G\023\213c\204o\264\203\347M\305{\\\227\311\267ho"
+	.ascii	"B\335Y\373/a=\001"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.51.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375 \3025\005"
+	.string	"rI#+pm:\240{\375\f X\n\320`7\320\324p\343\325jl^\324v\312V\346\354\356\376w\025\n\303\274\275X\007\316D\275\267L\001\267(\271\2500\307\214p\245\263^\262\362\325\250\036l\321\312T\341\023\")csR\236\276\336\350\031$q\362\177\032\214\226\177\001\035\275\037\0224!E\247\233+\221\032\024\370d\376\357\364\354\027\355\207\351\365p\024\316\250\2739^6[\230}w\263\203\255\323\026\n\022\335}\270u\225}\334\377\207\377\210\377\214\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.52.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375 \302=\005"
+	.string	"r\211#+pm:\240\303\3271@\300\021\204e7\320^\027\221[j\261yQ\333)[\231\263\273\373\377\305j\001\347\375\303\033x\027\365\3362\005\277*\271\2602\307\214p\245\263b\2622\326\260\036|\321\312U\341\023\")gsR\246\276\336\350\031$q\362\177\033\214\230\177\001\035\275\037\022H\"\205\247\273r2u("
+	.string	"\332\374_\352\332?\332O\323\373\271P:\245\356\346\230Ym\241\366]\316\016\270n[(Ht\367!\327Y\366q\377\037\376#\3763\002\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.53.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"E\013"
+	.string	"\326\224ME\020\2538\035\020U\231\372\3277w4\001w}\037\357\025q\247\267\n\020\216\310v\202\353\236\262\372\340\177<B|i\007?\225l\353\227\030m$\"$\334\002\033\004\b&H\242\001\n*p*lp{\333em\247\0248"
+	.string	"8"
+	.string	":"
+	.string	"\035\342Y.\316vU\024*\354\216\033\326\320\234Z\2647|\\\355#$\200iP\356.\227\025\270\370)\372o=\302\204\032}f@v\327\323\204\022pg\267\235a;\304>'#\257\335"
+	.string	"\261\017\233\201Z8`\373\276\353d\350\f\\\362B\260\273\333\251\035\262\267\323o\266\263i_\301\027\210\037E\027\024\373\342\212\371\030o\241\235j^\241\235zN\233#\020~\322\365\022(\354ByP;\351\225?"
+	.string	"'V\273\353\341;h\001\371\006N}\221vz\362\223\005@\203\212\325\2014c\366X\232\031\001\373\020\233\r\260?\376S{\352T\302\002_\027v$\022_g\342\2018_\r\253\267\331\263\351N:aJe\341\300\257\202\237\016\344>(\035\217\363| \267\301pU\351>.\254\365\343\266\221\364\326ER'\017\034HY\311\373\204\314\bC\371\022"
+	.ascii	"\2473\241L\2130\f\262\2607\023\020\310\206\321I\252 \234\243"
+	.ascii	"&\t\2510t\r\347\320\304\0034\032*\334\006s\277T<p\347\026\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.54.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\025\n"
+	.string	"\346RE= \005)\035 W\306\267\241KC\344)\002;\031%\301l\232\004w\237f\005\b\013\034\244j?\266[V\265\001#\327hd\022PXA\332\325\304\3505\004A@'\320(\355g3\262S\n0"
+	.string	"3"
+	.string	"3"
+	.string	"&o\320\235\202\036\352N=\3329'c{\226\230\215\232mw+'\362\361s\364O\273\200\353\265\372\3748\354\256\247\353\345qs\267\215`\273\301\376B\263\013\301\324\214lv;n\001\226\206\276\220\370(/S'\r\241c\262\273\336\251\235\262\275\323{\266?\355\313~2~\246z\301.\f\307e\227Tp\002\3504\342W(\217\214\355\250\356\245/^C\021\304v\227\301O\321\310\360GN}Uw\372\362S\306q\003\"\353a\315\233M\266&\027b?`w\327\034\314\376\354\017\341w\372F\003.\211\276\b\322i\002\304\250b\b\212\246O\254&\t\022E-\205b\025\035\030\254\370\302z\002\301\260z$\353\264?|\224"
+	.string	"\330aq-\213\267|V3\266\253\374\245\003\020"
+	.ascii	"s\311\"\3236\030\001Y\200\232\t\bd\303\350$U\020\316Q\223\204"
+	.ascii	"T\030\326e\036S\241\001\025\255Y]\001\327\362B\230d"
+	.text
+	.section	.gnu.lto_voltageMeterRead.56.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`N\001=\016"
+	.string	"\206\232`F"
+	.string	"\223\223\016P\225nc\313\323\264%\360\006\314\224,&\360jx$\300\245\371i\352\354\201G~\306\266\365\366m\033\212`U\267\222O\025*C\203\356\252\252\006\257\372{r\250%'%\002h&\306 \226\354\275wJ\001L"
+	.string	"G"
+	.string	"M"
+	.ascii	"\356l\035\007]\3662\0360\304\334\354n\225%\336\235N\031;_uO\016"
+	.ascii	"Sk\345\221N\037~\304\206\252\265\362V>\261\225\313i\340"
+	.string	"\233\321!\200\2472=4$p\\\365\230\3013\305\330Y\260\273\216'\217\303}\335v\003\333\t\354\247\b\033rp\226Ec\240\260}?\346\341\311[x\300\013\353C\355nvj\237\330\331\3513\333\021<\213\356)\224\217\354\262\340T\354\324 \366h\037\365\025\335aR\034\262;B\306\314.\210\300\007\260\323\002\367\\\247\363\002\256\323?\201r\235>|Di\260\371P>J1'\302\370A#b^QJ\233\202\205\370\223\247$\375\345\364\261\244l\261\310S\256\313\247jH=Z7Tb\020\0334E\331b\177\356\356Z\262\330O\375\3620\377C>6\037\b\023\037d\r\270\001\2346\322B\324\001(\272\344\243= \031E\330*T\021\267\211L4Q5\001\221\204j\t'\252\037\002\336$h\\\035m\033W3\260t\325\031\250\b\001dGI\232(\3503\035R\215\273\370CC\370\013\312\203\306\315\267\353\241C\227\331"
+	.string	"\270\354\256\002\177ua\202\003\033"
+	.ascii	"2\003\3020\334\3026l@\244\355\035\214\r \033`\016\243\260s\324"
+	.ascii	"$H\305\261l\f\200\006\013%\265\250\213q\366\232\313l\204\006"
+	.ascii	"\026\303\275\300\376\246\246\300\275`j\312\270\233\301L\232\227"
+	.ascii	"\322\030\324\036"
+	.text
+	.section	.gnu.lto__reset_template_136.0.57.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.70.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`:\002U\021"
+	.string	"\326\336mI\340\262(\035P\342\001\021N\317\311\233\027_ \220?\373\227\331\3441F\031\322\372\351\323!pj\230\322A\2022\177\276\366Z\324\037\354\\\245 \310\004@pb\234g)\210,\202\300-\2021\215F4\314\004i\207l\262wJ\001U"
+	.string	"V"
+	.string	"Z"
+	.string	"6\251\007\330u\t\351\354\222\b^m\"z5y\222\356U\364\221\356\325\376\313\266\352\305+\333\307I\024\373\030$<\304\200v\027|\245'\276:\235\334\312\227\235\244G\313m\006\323\341\364\345Gznn3\230\020\237\002\316\001p\260\273\026\211\270\353m7\260\255\300\236\257;*\216\363\333\367e\274Ty\216M\202\264bvW\305>\214\317\354\317+\317q\201\024?\255\026\273\373\255L\337\205\312\227\371\263}\034\325c,\023\302\262F\224\274\232\336\374\305\3521\026{\273%|\022\210^\017p\237\347<\251\272M\212"
+	.ascii	"\271 ^<\247\375\232\303V\0175\302\001<\374\036\016#\237&\205"
+	.ascii	"\303\005\310K\223^\013?\023\264\005/\355\323\276\203\"\262b\006"
+	.ascii	"\213\335e\240s\032%\237\346\365\345\005\323\274\213\330i\350"
+	.ascii	"^O_~\332b\200Z50\326\034\232t\306\224;\267\324ew\323\\7MO\376"
+	.ascii	"\263\233\276Wb\023i\355~\030\022Z\231\032\026Js\fQ\241\251\232"
+	.ascii	"t\022\242\214P\030\304\r\340i\024O)\341\tL)\215L i<\201'\006"
+	.ascii	",f\bG\020%\212#\370\235[\352\262e\177\360\222\t\372\301\242-"
+	.ascii	"\246\224\316\330\346\"|\307\020\t\377\t\275\033\217\216\034\034"
+	.ascii	"\365n<t\302oP!\024n\013\275\032\r\310\206\017\245^\215\026\004"
+	.ascii	"s\205\0074 \300\002\031\233\223\007JR\fj\t\342\276!\215\031s"
+	.ascii	"0\375\2650\334\3311\3759\202`\224M\\\263\006\243\023km\031`\303"
+	.ascii	"\214*\343Y\306\\0W\331:\332\202s\003\241\326\006\262\026y>\302"
+	.ascii	"\213\001r\033P\324\360\202\336\270\214\267K{\253\f\221\351x\017"
+	.ascii	"\377\231\324cH\315P\204!\212\2278I\273\335\346\224\205\006@\355"
+	.ascii	"\t=IKOXc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`]\001}\t"
+	.string	"t\rY\002"
+	.string	""
+	.string	""
+	.string	"\002+\177\025\201\200\200\200\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\0059\026\200\204\001"
+	.string	""
+	.string	"\003\002\306"
+	.string	"\177\027\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005$\r\201"
+	.string	"\002#\177\030\272\200\002&\177\031.\177\032/\177\0330\177\034\005%\0351\177\036\270\275\224\034\005=\037\0022\177 \001>!3\177\"\004\0024\177#\0025\177$6\177%8\177&\0057'\005*(\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005')(*\"+!, -\001<\177.\377\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001;\177/:\1770\003\n\034\311\302\353\343\003\001$\003\n\033\244\006\003\n\032\304\006\003\n\033\227\217\226\304\002\001\244\n\003\n\032\304\n\003\022\002\340\236\212\256\001\001B"
+	.ascii	"% \240\002\241\262\342\0010\226ihu\370\250\207\013\f\266,DH\202"
+	.ascii	"q~\215&7\314\215\346F\360\214\205\032\\\332\341s\233/\347\323"
+	.ascii	"t_\333\020[$2\341#\257\030fB\006&#\006\305l\254\364\230\375q"
+	.ascii	"\006\360\310c\361\004Q\213\rO;\207\277\224B\033@<"
+	.text
+	.section	.gnu.lto_.refs.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375 u5\002"
+	.string	"B\306\016\022\240'\351\377\377\377?\363\277\217\366Io#\311IR\246:\303\n#\354\030y\241\032\tv\360,\212\226Q\3429\212nT\217 j\f\220}\271\245\026`C\216\365U\273\235T\352!\002"
+	.ascii	"E]\235\202\211\007"
+	.text
+	.section	.gnu.lto_.decls.9039143f549d1d2f,"e",@progbits
+	.string	"(\265/\375`\3509\255\356"
+	.string	"Jk\235PY0HQ:\215\001<t\377\0025\304\021\277q\356)\317\262\230y\303_\371f\006\306pm\317\277\300\315\336\361@X)~\330/\363\273\313\035\221*\f^v\310\t\006\206\"V'\310R\306\245i^q\300\r\004"
+	.ascii	"A\bA\317\276\314\374N\232$+\316M\264\237\304\266\245\2242\005"
+	.ascii	"w\004\362\004\035\005\237)\243\377\234\t\243?3\247?\243\246?"
+	.ascii	"\363\245}\260\364g\246\264\206\031\026\372\276=}\037\027m\367"
+	.ascii	"-r\253\212h\201\345)\201\232c\376\330\260d\366M\207\002\266\260"
+	.ascii	"<\177d\\\032\315\213\"\205\322\363\032\035\241\2618\333wixzE"
+	.ascii	"W\371\363v\227\226\365S\003\001ZY\236\267\352\266\270\313\337"
+	.ascii	"Qs;\375\312T,]\345\017\357m\243\314E21\347d\237\230\013\363."
+	.ascii	"-\35325\331\247\357\252y\227\206\0275\366\274K\303\273IW)\205"
+	.ascii	"\327\211\253\264o\313\255\354\242\001\020\250\2734\274\262[u"
+	.ascii	"o\2245\345\270XW\310\375q\255\356\216;\344^]\252\333\343\372"
+	.ascii	"\270A.\363\022\271@\256\nW\307\315\272<\254\363V]\251\337\251"
+	.ascii	"\213\343\033\374V\317\222\271\312\237Rg\033\3011m\335\252\273"
+	.ascii	"\342*g\256\320\356\322n\236\264\326\3544\344\013ey|\002\360u"
+	.ascii	"\351\373~\350\373\236\364}G\372(\026}t\312\214\373\204\363\026"
+	.ascii	"\203\316\271d\206\220\033\303.}\241\"r\363\321\033\372\272\270"
+	.ascii	"/\254\363\302xN\002\265\277\366n\342\340\"\030mg\032|9V\203\357"
+	.ascii	"\250\n\375\254\247\237\267\350\347(\272\203-\375\354C?L\206>"
+	.ascii	"Z6\322\307[\364\347\336\364\237b\372x\030\210\266e\354\236uF"
+	.ascii	"p7N\231\"e\362v\350\333\b|v\317F\340;^\352\t\354\205\274\br\232"
+	.ascii	"0\226p\214y\316\030Q\233\n\273\031\257\t\016\272\275\233\303"
+	.ascii	"\\\024\304X1\335||\202\316-\203,\226\354\207\356\r5\205\251\304"
+	.ascii	"\316bA@[\f\"x^\354\235\375b\301X\247\265\263Z\356\034\006\033"
+	.ascii	"X;[g\237?es3a@\027\203\b\315\232\f/S5\331>\257\345b\273\334>"
+	.ascii	"\355\226\233\243\246}fK\301\317Z\n\320'>\212\274\342\364\257"
+	.ascii	"\023\375\253D\377\016\321\277V\372\327\206\276\300\362\310U\240"
+	.ascii	"\217\232\214m]\211k\356\374\224\276\224)\271y\205\243\034\032"
+	.ascii	"O\230,o\376M\322\267^`\226\f7\321t\222W\335s\357\246\231]\373"
+	.ascii	"\035\351\354#\257,6\211\233m\263k\270\253\211\006\305\324\226"
+	.ascii	"\247U\002Eg\037\031aa\356\335\254b\341\254\025\373f\251X\247"
+	.ascii	"u\263Rn\331\354\224#\353f\243X\262_Qs7\315x\3211a\341\355\335"
+	.ascii	"\334\260a\303\006\237\r\033\276d\334\270\311\267n\332\372\330"
+	.ascii	"0}\013D\337\336\320j>\020\220\343\212q\363m\013}[\226\366\263"
+	.ascii	"\037\315\336P\270\230\031\3303[f\233X\264\237Apbo(O9Qa\226\250"
+	.ascii	"\200\267\367~b\235X\247mb\231<7\367\016\333{o\330\340CS$*\313"
+	.ascii	"\204/\237\250O\001}\023t\006AO`y|v\211\r\263\316\n\354\330\355"
+	.ascii	"\227Ur\264\250\271\233{7s.\0172b^7_\001\372\277\330\037\260\262"
+	.ascii	"7\270\003\372\266\002\037\336\333\263\025\370>\243u,\217\357"
+	.ascii	"\276Y\036\237\216\355\372\255\021\273e\233XI\005\324\016\333"
+	.ascii	"J\315\035{tE\226\344f\313e\221\3346\355\221c\260\301\2612\311"
+	.ascii	"\336\332{\333\246\006P{\027\331f\216\336\336E9\326R`-\005Yk\352"
+	.ascii	"\312\351\313\277\372M\313\343\323\366\202o\003\317\237!\360\333"
+	.ascii	"2\377\265\377\215 \001\005\210R\363\233?? \310k\376|E\225\243"
+	.ascii	"~\013\304\001\377\r\001\312]\373\357\317N\277\035\300\177w\374"
+	.ascii	"\027\355\354\277?\314~[\200\377N\240\254I&\302!\270\004\177>"
+	.ascii	"\221\377\254<\001\276\363g\f\374\267\362\337\355\177[\234\315"
+	.ascii	"\237/\360\337\261\377:\357\373\363\211\377.\375W\305\177Q\374"
+	.ascii	"\327\304\177\225\376\233\342\277Lb\377M\376\327\350\277G7\354"
+	.ascii	"\277\316\217Rpo^\202\3763\n\377\301\374\267\373\377\005\3573"
+	.ascii	"\177\246\300\177\243\376\273\344\277`\377\375\372\257\327\177"
+	.ascii	"\364G\031\360\337\256\377^\375\327\352\277R\377}\372\357\362"
+	.ascii	"\277/\376\333\342\277M\377\005\376\267\202\377J\340\277&\374"
+	.ascii	"\227\204\377\216\360_\021\376\333\200\377z\360_\020\377]\300"
+	.ascii	"\177\025\360\337\004\374\267\203\377n\360_\016\377\335\360_\t"
+	.ascii	"\376\353\300o\361\376\273\363\237\313\377\261\377a\376\257\360"
+	.ascii	"_\355\2779\377\305\371o\315\177g~\373\377\346\337\212\371m\007"
+	.ascii	"\377\307\374\027\363\037\357\377\225\377q\377\233\377\177\376"
+	.ascii	"\263\375\267\260\267\267\267\367g\f?\316\317_\200\026\001\367"
+	.ascii	"\355\242\246\2757\013\264\271\233\214n|\026\265V\303\217c\261"
+	.ascii	"\r\300\336\377\037\360As\037\205\321\373\242\203\234\025=}\202"
+	.ascii	"\375\277\355}$\245T\200\224\323\221T\f\245/\251\255<\372\241"
+	.ascii	"\334i\332RJ\245\257\275w\366\321\221\022\004\324\336Q\372\332"
+	.ascii	"N\033\311\212\223\335M)\345>\202\332;\373h\027M\240t$\345\244"
+	.ascii	"\364U\344\264\243\364%\345\264\277\244\266\316>*j:q\264\233v"
+	.ascii	"\366\227T\227\375\005\345\244\243\364\005\345\244\364%ef\335"
+	.ascii	"P\030y\272\270\323\333Qg\201(\035\355\025K4\212\232t\336\224"
+	.ascii	"\232P{no\033fb7\005`o\032PMsE1,\232\321\333\n#\262\"(\333\334"
+	.ascii	"{7\260d4\005\265\217\336\224\204@\355-\304Hh/i\240l\276\355\035"
+	.ascii	"\366M\211\203"
+	.string	"\306Vabo\007\226\366V\332\375\266\367V\356\275g\232h4\367\236\241\243\304\\Z\332{\351\263\264i(\231\230\330\373\206aAsR\372\232\202\372a\002\366\305\334IM\245e\3569\251&\375\245\354\332*\3544\323\251\205\227\233\263\023\333Y\324\331\023\22333\345%\r\315\255\374\031\215iZZ\220\233d\226o7\377\002\322\212%\034'\234\221+7?/\335\306]\257:\254 7\377\374<\253\260H\362\272\326Nd\024\270\007\013.I_\362\211\234t\271\2249!R%\233@\312GA=\334\302\334\234\215n\262\216\250\315\335|\013a\372\033\344m1\365\2140\367rQVZg\336\230\314\355O\336\270\314\324\221\030D\212_?\242t\276\205 \372\026f\350[h\322\267P4\006\213A\203d\025\365\270\031\257I\323\345)k\005\030\375\fv\217'nB\301\234\303N'\216,\231`a{Z\315\252\025Jr\344y\245"
+	.string	"[\242\204\225j<\361\322\322So\205\nf^\221\347\027\n0'b\236ww\214\326\323h\215\013\023\354\t\236\332m\253\233\343B\366L\262\241\245D\356D\230#G;\236Z\316PP\321\302\324\303*V\310uq2\325.\234\333S\0173\245"
+	.ascii	";\273M\220\306<\347\330\266\224\251\335\025\342\250h\031\251"
+	.ascii	"\232\201\221t$\321Iab\2112%\013\224\256$KO.\354\002O\341&\332"
+	.ascii	"\007F{\317\0234\236\330\310J\013\211\034\323\006_\220 \341\024"
+	.ascii	"T\313\273=\037r\367\03176ge\016s]\347%\303M\246\007J\310\330"
+	.ascii	"\205\201\225\351imU\311P\022\327\366T\303\\7\312e\333T[\230\031"
+	.ascii	"\200\341b\272U\350\260\360\023\354\205\277`2\354\005\243\341"
+	.ascii	"'\306\202\255`.\330\016\203\341/\\\004G\301t\370\n\226\303]8"
+	.ascii	"\016S\301Y\030\bF\202\227`6\254\206\223`\"\030\nn\202\3230\023"
+	.ascii	"\354\206{\3405\274\002\016\303S\260\026V\202\307p\023W\301>\260"
+	.ascii	"\021<"
+	.ascii	"\207\263\340+,\004\007\301b8\f>\202\313\360\033v\202\207`8\274"
+	.ascii	"\005\233a\025\260\023\267\341:\254\005K\301w\030\f>\303[\230"
+	.ascii	"\211\273\340\037\326\211\271\260\216\343\035\330\352\"\341\""
+	.ascii	"\0368\310x]1F\236r^\304\230]fyjnY\230\030\205\214+HS\230X\211"
+	.ascii	"M\334x^.2W\314[&\356\007\363ja\036rOL\2657,O*\275\247^\026\027"
+	.ascii	"\256\032\363\274w\\\027\217j\353y\3450\327\255Sbf\331\304L!\261"
+	.ascii	"\313\374\0357\255\321P\330\013\276\357\244\351\357x\351\357`"
+	.ascii	"\351\357L\351\3574\351\343\251\037\263\300-\260\224\205\242q"
+	.ascii	"\021%\315\354\346(\\\006\205\331\221\233\277s\002\333\3005\360"
+	.ascii	"\rL\303:1\024\226q<\303\316\375\306\270J\334d\316,\231\372\201"
+	.ascii	"\241\360S\326\023\306\025\206\302\313!iUh>\350\216\245\027\270"
+	.ascii	"\232|\235-\332'\247\257\023\247\257\003\247\257SE\333\263\237"
+	.ascii	"\343\027\031\307\035\023\326\315\327i\323V\002\2351}\235 \372"
+	.ascii	":U\372:K}\235$\375\2340\3729p\3729N\375\034-\375\234)\375\234"
+	.ascii	"\025\372?=\375_\235\376o\212\376oL\377\207\245/\370U\351\377"
+	.ascii	"\236\364\177&\364q\274\350\343L\321\307!\323\307\351\322\307"
+	.ascii	"\271\322\307\201\322\307q\322o\336\344\351\337h\321\277a\323"
+	.ascii	"\277\t\323\277\331\322\277\231\322\277I\241o#F\337\306M\337\306"
+	.ascii	"L\337fK\337\006\207\276\215\223~M\031}\264\032:\375\032'\372"
+	.ascii	"5I\364k\250\364k\226\364i\362\364i\246\350\323\210\351\323\b"
+	.ascii	"\321\247\201\322\207r\331n\327U\252W2\300n\266_?\277R0\232\232"
+	.ascii	"\t\275\233O3Cc&\3757\032\245\276\336\242/\332eb\235>7\315Z1Z"
+	.ascii	"ACNg`\357Y\037\337\365\231\276&\242\257}\350+vU\330f\005zn\254"
+	.ascii	"^\264p\273\331\032\371\371\035\273\340kZ6sr\340\316\300\374\270"
+	.ascii	"\371:J\323h\027:7\243\366\202\222\257\031QT(n>\372\365e\246\303"
+	.ascii	"\352y\363\205\362s\324\013\001<ph\335\f\344\350\020 h\027\276"
+	.ascii	"r\263\225I6\323\314\031\033\026\027\336VZj\260\351J\321Ue\353"
+	.ascii	"h\327\321&\006\033\274.\213\310\225\242\233Q$G\271\226mi\317"
+	.ascii	"#(\327OS\023\204\352K\205$}\003$\201\341\344t3j\344u\027R\247"
+	.ascii	"\242\313\315\250\326\237\334,\345\360\252\320\"T\246\340\214"
+	.ascii	"nF\211\240*X\347\331\320\254\377\322\222\304\034\330\372\031"
+	.ascii	"\260g\363\241A\216\n\371ih\322lPI\341\351\037\305\372if\234W"
+	.ascii	"\236\230v\372\rh\351\321\003\275\362\321\373\b\234\216'N\223"
+	.ascii	"#V\304\3748z\365\263\0345'\243\352f\324\307\317n\3265\307\203"
+	.ascii	"\212Fq\034\007je\223l&\353\265#\211\212\006\233*\032WV\240;\216"
+	.ascii	"Z\345d\225\031{q3J\205\352h\021\205w\246\243\n\003\361\261\""
+	.ascii	"\206\032\030#[\214\320\034\226I\335\n.zgC\314\2128\321\320\032"
+	.ascii	"h\rT\nU\312P\350\236\277\267\270'\274\250\231\036e\230b4m\226"
+	.ascii	"Je\\(\024z\343fC\027\031P\320\033\250\r#.r\364\240a\2227\344"
+	.ascii	"E\226>*\303\242OO\271\3156%\250c\302\312\3029:\022c\214\016\024"
+	.ascii	"\206E\227\3502O\201\3331\305\002\375E\b\217\006\226\264\265y"
+	.ascii	"\212\357G_\274\240\362\335yiR\321\242\177\224\205u\242,\320\026"
+	.ascii	"Vg\357)24\034'Qa\302\320\026G\025\330\273\247\346\313\005\226"
+	.ascii	"\031bU\236\271Xg\256\2026a\245\345vaA\\\212;\345I\344\352f\224"
+	.ascii	"i\246H\356J\224-}\273\345%\177\321\002&\313SL\316#\342v\227\355"
+	.ascii	"\266\260<\2252\031\024\311\276-u\366\221\031\336\023U\312xs("
+	.ascii	"\320\025\350\022\232\002MBO\240*"
+	.string	"\254\023U\312z\317\317\334\345>\266\fU\312a\350r\276\030Y\022C'{y\035\004FJ\r\340\332r\204\232\260N\024\351>H\271\fjd\337\226\315\315\302\246\314n\212\331\300\006\034/+\314=\371\362\217\032\241Ed\315*\273\233Q\345\3142\006\033\022\215=\353D7\230,&y\257\263Y\263\232\222\241\357\323B\337\307\204\316ct\334\263\006\225\233\357\263\365{\364\364{\300\350\367<\365{\346\364{\340\276d\273/)_\250\330]\345\205kSa\344\246\257\206,\271.o\371ir\264\320r\214\255\351g-\"X\271\215\335\234\355\237\3702\3353\226\237\346\262]1\227\322\364\263\\\236\373i~s?\304\272\234\372\371\312\330\336\027\0317\3478m\242g\253\202\232\032f7\236n~\216\373\363\n7\3116K\354\221\ts3\216\275\340\313V~\236\341l\250\250=\221\334|\323CC?\267\331\354\346\226\333\350\310\320\260"
+	.string	"\325\223\301\245\007I\347\266\333cT\301\265\033R\303H\2362\223\324\226\367\342\346\346\326\336\315\234\033&&\036Pl\312\n\354\275\225\363d{a\2739J\224M\307\306\204\225\325$\207\225\"rN\234\3445-\246\376\362\004\206\246\366\274&U\245\271o\316O\256\362\206\314\026f3\203YZZ\316\242\273\301\304\031;\241\204N\0054\264\234e\305\230j\322\230Q\262\334\374\fSN\353\314\316l\246\001j\263\320\300\316J\025Z\016V\022\214\261+\345\331\354\317c\231,\227Y\375bL\030\025\276'dpPnn\340iy|\330F\206\024aalX\254K\0316;\260[g\006\313,\032"
+	.ascii	"\265[L\020\004ji\301\215cs\326Q\371\372Z\242\205\252\340\222"
+	.ascii	"\207\344L\342\314I\354\323\032\3515-8\017\023\t\222\334l\200"
+	.ascii	"\262\312\007\216\002s4\326\264O\032 A\246T\270\320\322\312G\344"
+	.ascii	"f0ae\321\204\275\330\241e\353\371\210\266\202\263Bus6\222\225"
+	.ascii	",\024$:\310x\266\n*\344,3&,<\237\036\214%/7\347,\324\212\220"
+	.ascii	"\037N:&3\017\371M\225\241\241aFN\006\027!@\236\207d!8\204\340"
+	.ascii	"\201\t\tr\263\004\311\305\321\n\027KZ\0175,+\245f\216\271\345"
+	.ascii	"\307U\242SwZ\316\324z\274G\376aw\323\336\313\215\341\262\230"
+	.ascii	"\260\262rf@yc\372x\376\201\341\013*\353\200\312V>(\246\246\275"
+	.ascii	"l\322\360\347\035\317V8\316:\"`\242\242r\225V\216\315\270kn="
+	.ascii	"\262\344x\256\272O\250x\264\2709S\345\024:\315\005\2136\034\030"
+	.ascii	"\005\020&8pL\331p\202\013\223\2058\221\"\223\262Z|bvyaA\3641"
+	.string	"<\351\333\"6\323x~\3125\262\r\275\231&\304-\237\273\311\205\005)`\344\221\271\371\030\222\364/t\321\317-\262\213\347\027\177\221g\350\275\267U\262\264\\j\250\221\"\243BD\306\363\214o\271\331\020\330\224\261\233\002\223\227\377i\262\2200T.\2261l\344@\202%\033\241@\274\324\262nvf\030\230\314\377\215\263v\302\t\030\232\276\275\0176F\242\272&;\244C\242\242\320H\354\240&\211:d(\026\211\214\306\243qf\005\372F\034U\241\365h\234\001\n\246\305\274\246\311\241t\310\207\223L\016A\310\031\246\253zD\"\211\222\016\220@\036?L\020\200\365B\034\202\220\035\202\220\027\204F\"\033#\320E\223\300\233\025h\fB\242\306 $\026Z\203\214i\321\227\226 &s2\231\252\303ap\206\004\362(\314\352\212\304\303\324\030D,\006g\206i\222(\013\323\344\314U`\020\222\003\016\tuM\022\203R\022\200"
+	.string	"@\006C"
+	.string	"\001\302q\375"
+	.ascii	"\302C\215\035\246F\342\tC\307\017\303\340\003"
+	.string	"!\f\203>!\030\020\202\001$\202\252\352!\331\363\301P\b\f+\321\bB\262\201a\252\022}\b\n\206H\022\037\030\006/"
+	.string	"\245$|"
+	.string	"\341!\002k\032d\341\002\016\253\032Dr\030\006S\022z.\\\300\201\203\f~\220C\351\nT\201<@\243\007A\310\t.$\252\2511\r\322\327\200\003\003p\320A\n3\357\340"
+	.ascii	"\027\034\340\002\337;8\300\317\317\0018\370\321\347\340\007\257"
+	.ascii	"I\236\0248\004A'\005\256jJ,\"\211k\221h\350\003\b\017>i1(L\322"
+	.ascii	"\024\203\"D\020\207\311T\305Y\223\306\0249t\024\002\203\202I"
+	.ascii	" O\0228\302\220\210\274)!\004\374\225\020\002\352\224\020\022"
+	.ascii	"\022\256G\343z!\016C\"\262\303*\024D,\002\371x`\223@\240!\021"
+	.ascii	"\351\033\301\202`A\330!\021\211G@\022\r\215D\023zlF\004%@\024"
+	.ascii	"bHD\376\214\304\020V\017C\"Rg\025\246@@\027V5]\213\304\025h<"
+	.ascii	"\226 \252G!\037\022+QDP\375\200\270\032\2039%dP\217kPM1\2200"
+	.ascii	"\"Hb\247\230\n\205\036~\303 \235a\361(\224L\211G\344\232&}\322"
+	.ascii	"!\342ZC\"XL\2076\030.\2240T\203#\324\243\007\3034\005\342\311"
+	.ascii	"\251)!\004\304 \231\f\"G\034\213;$\324T\304Q\230\252@\241dP\025"
+	.ascii	"\376~<\353\361\247C\264\t\372$\211)\004\201AD'\244\303\236\235"
+	.ascii	"\344\020p\030L\205\202(\034\217E\240\232\032\211Au\005\036Ua"
+	.ascii	"\260\001\235\035\365\250\252i\217\020(\004&O\bZH\221$V \006\026"
+	.ascii	"J\b\001\215\304\022BCj\272\0161\244\303c\b%@\340\200\264\030"
+	.ascii	"d\364\320c$\006?\330Y\323dJ\202\232\006\005\021\325\022F\034"
+	.ascii	"\213E\017\305\243\272\032\217\037\204\204F\242`Q\002`\232$\262"
+	.ascii	"\220B\260\230\252\300\021A\022\300a\020\206\022D5\230\032\211"
+	.ascii	"\016X\223D\252\320z\0015\022\203A5\251\320\030\0241\f\016qV\""
+	.ascii	"\344Jt\004\252\307\3658d\301'\004\002\201\307\225(\330S\\\327"
+	.ascii	"\243*\264\022\223\306\240\272\372\254\311\343\361\004 \020\220"
+	.ascii	"N\207\202\"\244E\"\320QE\332\f!U\240\2218t3LSd\022\270\032\323"
+	.ascii	"\2415Id\201a\220\3077$\"\177i2\230\252B#1-\016\211;\310d\361"
+	.ascii	"\210T\323\325H\\\203*0\205\340\020\020\bhg%\016\021\213\300\024"
+	.ascii	"\005\"\362\247\036Wa\020\b(\264\036"
+	.string	"\217CI \020\220\316\021\231B\nLE\250DB \020\262\b4\222\030ZH\207\307!`*\f\252\300b*\"-\346\\\210C\022\030D\0042\036S\b\032\211C\026FdX\215i2U\221\353\321\330\200PD\021'\005\246@\f\251P%:\206X\215\251\252\022\t-\220X\211\302 2xB\316\032\\@\004\322$\021NrU\323\242\207\017i\222\b\2031\025\252\351\b\310!\242\244\361(\204 IL&I\b\375\212\305TX,\022\001]X\215D\307\017\305b\372\201\204\232\256kp\001\251P=\002\361`X\203'\020q\202\214D\243\0324!C1($\256D\365\203z\364\300x$\256A\225\bD\317\n\354`fx$\252\351\b@H\007\004\005C\254\301\023D\350\254\300\337\205\212\307\343\002\200(\020\320q%\372\020\201\021\307\242N\022\370\033\2469D5\303\324f}\004I\232$0\304\007\020\036\324tMC"
+	.ascii	"\221a\230\032!\260\263^\210\003P\007\343qh\350(|\340Gd\252vX"
+	.ascii	"\217G\265\203\r\n6\t\374Y\2216\351\032\\\223(\211`\021\231$\016"
+	.ascii	"qV \007?\253\221H\244\377\363\363a\002\b\210\360\201\026r\350"
+	.ascii	"\220T"
+	.string	"\217Ic\232\354`$\006\207:\b\325d\007\016\020\fS5]\213D\017\202\202!\322\240\340Z<\212\260\240\006\205\204Y\212\225\234\2301]h\024339284\355i\350\332-\024\355m\264\267\r\035\002X\272\320\360\243M\216\256\241j/\354\304\246\324\320's/V\374\300\003\241\356\310\232\023\254\003K\361\001\305\356O^01\322\226\203\211]\263\271r\262\364\202f\225\255\330\345\305\235\241W3A\212\262\366P\263\314\242\314\313\007\213[\326\365\206do\007Y\336(\322\226\227\271\261\b&\320eI\304\211\266\330\262\303i\005\261<#+\277\024a\t[b#\0076E\354ft\311\217\202].\2636%9\002\204\310\250\023c$r\236\n1\204\230b\nM\315h\222\244\003\203\024@@\210L*\034Ng=\037\023\300\020\310\023\0029\313B\206ff$I\212\n\265\206\355\036BAm^\234\030\316\024W\342\\\265"
+	.string	" \006.\205\347/\252l\220)\231\f\"\251W\007\020\364\266\321\320\224\246R&\325RN\320z\016\236\335\250?\0012\211s0\225Q9\036\032\247\370\003\020\205\213}|\342T\032\251\302\\\333\336\030\2643\243\253\242\365\362\302\035p52\024\207\204;R\275\235\363\005\221\033\261\177\r@\347\266\363\t\226h\201\242\246\241R\006[\226\355@\327\200@&g\213\032\306kA\b\205\311\\\177\311\370\210Q\005@t\206Tt\236\352\020p\260V\227\254\001\2037\310&\203\2659\305\016\2542(\306\3604 \322\357(O\334?\324\304\"\340N\031)a.\320\247"
+	.string	"\370q\316-\217*D?"
+	.string	"\03660U\313a\005\365\2120\260\304W\210\344\203\036U\320 \030\"\307 \317\244\311\313\327\266\f\217J\314rP-\362\320\034~g(\241\t\212\347\201\016)\345Q\034\017f\n_\022A\307H\0315\223\334\362\304\022\304u\2718\004;.{t\337\025\033\320\217\350\244-\245\311\025`+\224B\013\312\341U\003\3347Y\025w0{@\223\321\t>\323\355JL\037\270\312d\211\332k\006\213\244k\204\237&\250\367\270=ng\244\3367\252"
+	.string	"\257\313\321\335\201$\310Z\026\314\351\202\235O\253\314\223\020\305e\033\360\215\233\224\032\006\207)\212\024\373\342*\314\275\210\325y\263\336\237\224\217\242-\002\002+\027\273\006*p\340\220O_\2627\n0m'5l\005\206\036\005\350\341\001\333b\016Se\265\356\316\211\222?\002\035\322\352K\361%\007\306B\333\"\377\221H\3267^\323S\034\211 \316j\227@*s\006\251\371\332!p\243(\350\231Mf\265\017\253\036\230\215\360\343$o\313\036cc\264\333\267,\303\264\201\373\b\335\003&c\"\253\313\020\376\364\270Eh\212\360\330l\345\3171\004\233\316\332\257\025\026\303\304I\203\017\277\255\372\020{\265\bG'\265y\215\021\025R\016\030\324\223\311G\257)D\277uJ\230Agg\317\202\357y\212V\020d\213L\251B\346a"
+	.string	"/+{\017k\336\t\304a\232\3316\\\025g\177\232q\235\327\324~\361\377_\\\220\214B\235\371F\315nX\236\327\020\356\375\001\370\240K\346h\306\360'"
+	.string	"\311\253Rd\020\345\265\330(\233\235\335\223C\347|\262\002D"
+	.ascii	"\360\356\377\210;\034\340\224S\362\301fs\341_e\345\"3\235\267"
+	.ascii	"0&D\333v\016\006\216v\b\272\332w\007V\022\216\030\352\302\357"
+	.ascii	"\205\336\330\347Q\373|O\026\3516\002\b\326L\"\320o\"L\351\253"
+	.ascii	"S\271\277\027\256\343\217\343wC\002X\327a\b V\211q\342\255wt"
+	.ascii	"\031\330|\207\033Ec\030B#zh\316\245\265\033X\023\t\023\353\205"
+	.ascii	"\354TNTHR?\245\255\300\334\346\025f\226\251OQ\0250\237C\034#"
+	.ascii	"~\371\025\330\243A\300\374N\345\317\272\303"
+	.string	"3z\310Q\304[\226\207_\227\220\3613\334O\025\322\202%,?\200\242\344\310\354YU:[\030L\250b\307^\255\370dIX\300\3157\311L\207"
+	.ascii	"\343\016'\274\214\277\233\276z\233`\314\356\310\226\271d{\260"
+	.ascii	"Q=\"\355\334\341\t\206?\223\321\017\243\005\234\307\204\035F"
+	.ascii	"\311S\207\222T\356\301d\352\264\324\031.\025\343\233\233D\027"
+	.ascii	"\273\024I\021\367J\237\377\002\273\333\253\256\016\356\251"
+	.string	"\371\366\271\252\246Q:\225\251\316\231a\374\021\345*\262\027\340`\373\276\030\315@3\301.\263\"\217\320N\366\351p\311vdw2\227c\226\t\242\330\030\363\253r\034-d\272[RP\237\363\355w\330\227\220\r\232\244Z\004\304\377^\032F%\210\372\201\205Z4K\017y\344J<g2+\306\213\205V5>#\004\270\370'\022.\314^F[i\376L\007\355z\277\007\3578\244\267l\250\317\370\211g\326\351+@\356&\240\376\364\337\333\314\2448w\374\302\357\247\2605vq\231\177\344\334\023\"\242x\233\312\271\004Wr9\317I\367\370;\241T\225/#U\324b\205[E\t\347?m:\201\372]\361,#\3328\225\271\026T\270k\f\2379\202\316\235>\r\t\375k(i\304KmH+\"\336\354\263\022\304\017e\352\005r\024\213\214\264\b\301\n\317\237P\no\013\013:'\320peP.d\312$d\026\360\347"
+	.string	"\264\256\361\272\032\0073\250\037#W\032\231:?\0273t\003j\017\013\357j\"\375o[fk\332\342g\203\253r\335,\210\240\215>\232\273*\210@\021\025E\337S\240\371J\037p\265m"
+	.string	"\035\177\231\255@ \370\233q\025\221j\351\203\032#\005\020\3338d\212GJ\3026k\227o\317\301\213vh\271J\035sVu;\211\002A54\b\232\214\206\220\304aBBmq\352\321\252\003m\356\373\243\343\204\252\233\352J\257k\236[I\022\312\3721&\372s\362\305\022\2634f\334\347\226s\331pt\272\241\n\332\314Y`I\346\214h\360\215\262\205\r\021\203"
+	.string	"\373\252\004<\035\254\272\270\266#\355\037\025\271\377\236\215\351\313g5n\327x\020\335 \214ZN\330\0241>\247[\356NP\024\304\231\024\346\021\315\223\006x\374D6\023\365\326\342\020?6\241\277f\250~\303\t\224\236<\243F\323\252\030\345"
+	.string	"\327B\333\276U\024\360$\235\227\372\253\037\262\371\206\341\270\271\232\341\020\270\322\030\024`\221\333\362\211\247]\343\017\346\216\332Cr\350c\002\306\202\205\3269\277G\366\250\b\221\330\362]7+L\336H\255)Q\234\256\310\346\f[\345\200A\337\271\262\372C\343\205wG\216q#\350\243]C\334\")\245\236\252l\fY\372a\200\036\342\367\030#\240\036=h\030\351\330\236\027\"\315b\246\230\342\364\306\327\307\002\242K\204\304\275\247}*^JKa@\277:\023iI\377\330\027\n\374\365\224\270qL\333j&\001\003I\253I\326\323\200r\305&/\3368\236\030FO4\005g\0322#\340\227U\263ej"
+	.string	"X@p\247d\376\023SP$+\340\024D\301\223\343\3041\345[\365 \253\301uM\353#\027\244\f\251*\206\336\221\004z\250H\372\301Ra\213\247\325\177Z\346r\353y\331\375\202\b\235\0256\226\270\351\244\214vCS\274\226\247\021\n\304\004\307s\316\246.#\324UB\344\036\355\351N%\301:\332\204Y@\315\342\245X \340\007\206\203\013\357\314\r\2223\302\301.=WD\236\307"
+	.ascii	"\315}R9\377\364\002p\351\206\323\322fF\266\333\355\035m:\323"
+	.ascii	"\345\354\347\2047\241\304b\f\320\324 \272>\231\333\321\3452\220"
+	.ascii	"M\224E\351,7\001\bro\313\352\352\212\362$\200\222)\372\273]\343"
+	.ascii	",&\251\371\243{\245\364L\221p~H\311Z\036\260\214\020\211v\357"
+	.ascii	"\260&\fm\235\352D\030\340)\245\022R\242\254F!\230\210\303\254"
+	.ascii	"\345\240\353\346b\373\312\031\245Iw\005\177QjT\200L\nX\247\260"
+	.ascii	"\373\356zP\343!\004\222\202\"\245\375\r^\020\361\337\340Q\210"
+	.ascii	"\231\334\007\316\034\251m~Rjg\276\362\342j\204\t>\237\337\304"
+	.ascii	"\31426\003\016\347\"\320E"
+	.string	"gN\351\002\363\367!\030j\220\253r\320\315\036\223\rQ\210\301\025\034\3375d\271-,7+\253*\350\177P\206\354\022\177\224\025\255\002\363iW\250r\017\227N\3257\317\007\252\225\016z\323\317\324\031\3530\214\026\320ct\002T\316\307<\320u\361\211O&@\370\272\235T5\322\207\307\263k\b\320\322\264\020\257\345\305/6\006;j\2621\033\242\322h\231\037z#\t\314\232 \312\236\230\n\241\353]\305M\203\375\3158\337\020N\302\221\270\t~\337\002\177%\212\353\240\027\200H\245Mq\274\267VQwW\004\031gvf\"\\\252&\343\376\031\314\026\266\255\360A\230r\210\354\240\001\326\340r\220\357\241jL\026\001\343@\030F\207\007\226j4m\363\254\333\274)\273\326\025\205\210\366\375\306\252$\362\fpdg\200\226\351\270\314\312\2012F\302&\177\016'\275\344yZ\032\241\322\275\252\241\331\004\215/\0260\244\266m"
+	.string	"\356\004\033\327<\3513%{V\352)q\n\311\200\376\035\005)X\032%,0\202\243\323\032H\2530\034\360\337.k\227a\021\300\217\354\034!m\217{\017\016\364BJ\007\342\252\3048\3322d\326\347F\033\320/\312\"\241G\215\3723\211\204\"\324\370K\254\305Yt\f\355\331Cj\205\333+\254\313\307\367si\206\265\377\307\374\365\376nu\264\241-\276I>@~\220\251\0325?\236\370.\356\231\237\271\020\253\35676\003d\034\353\227\262\241\322\377\335\374\361\273\243'\267x\223?[\270N\311+\337[\276\316Q\334\200\331\336x\335 sf\3238\305\234\336\316h\367\017v1\017\315\235"
+	.ascii	"\371a\274\234?\351|\221X9\334/\371\255\335N/\364\314\202z\315"
+	.ascii	"\232XX\360\036v\016\340\205\331\357)\345\023\274\033_/\202\263"
+	.ascii	"\341\035x\365\330\377\363\347\341\306\342\351Kml\276\207\344"
+	.ascii	"lb\355u\tNE=_c\367-0\007\275^\365\005\313g\343\223\300\002\007"
+	.ascii	"\263+"
+	.text
+	.section	.gnu.lto_.symtab.9039143f549d1d2f,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"isSagCompensationConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"voltageMeterGenericInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"voltageSensorADCConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9039143f549d1d2f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
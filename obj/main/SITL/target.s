@@ -0,0 +1,2029 @@
+	.file	"target.c"
+	.section	.gnu.lto_.profile.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\001\002\245\r"
+	.string	"\364\023\365\002"
+	.string	"6"
+	.string	"\226\234\261\244\006\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\256\234\262\364\013"
+	.string	"\003\240\342\234\212\n\004\005\342\246\207\300\013\022\002\001\001\002\001\006\352\263\360\321\b\t\310\373\201\350\r\n\223\273\300\245\013\002\002\003\002\003\013\234\362\341N"
+	.string	"\f\r\251\306\315\231\b"
+	.string	"\016\325\206\273\207\002\002\002\004\002\004\017\020\021\022\023\024\025\247\333\250\364\n\026\324\240\313\347\002\006\002\005\027\351\241\340(\030\301\325\215\205\016"
+	.string	"\031\274\205\242\255\006"
+	.string	"\032\225\221\315\200\006"
+	.string	"\033\210\377\206\247\006"
+	.string	"\034\271\303\275\241\r\n\002\006\002\007\007\002\007\035\230\336\335\312\001\036\272\302\257\305\007@\002\b\002\t\002\b\002\b\t\002\n\002\n\013\002\013\037 #$\315\343\301\244\013%&\263\330\307\313'\261\213\233\205\b\n\005\002\005()*\264\251\257\307\f+,-\367\267\311\301\004"
+	.string	"./\222\321\201\352\t\b\007\002\0070\211\307\340\277\f\0021\314\345\244\232\005"
+	.string	"2\362\357\204\233\017"
+	.string	"3\202\220\306\317\004\0204\325\373\321\256\001\b\002\f\002\r5\351\361\317\236\016\0046\227\227\247\303\t\b7\341\274\276\362\017"
+	.string	"8\265\300\331\214\001"
+	.string	"9\240\342\234\212\n"
+	.string	"6 \220\002S56\007\231"
+	.string	"9\304P\na6\347\223\032\316\225\2716\344\026\350(F\017w,Z\241\366\025\333\275\0244\202\017\240\227\031\242\2723\320\016F\nS\323\225>\2031\002\233\031\246Z`\202\320"
+	.ascii	"\3147\005@)B\334\007p\217\313\016\214\367;\377\307+\036\235\r"
+	.ascii	"\336Q\030\030W\265C\030'h\027\t\273\237e\275\331d)\030\254\036"
+	.ascii	"$\262 Eq\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\303"
+	.string	"]\006"
+	.string	"\362\006\026\035pO\241\003\374\377\377\377\377\377\377\177% \325?u\250\tH5\230\240\037`\t\3312\245\256\357\201\352\343\271#\247\"}\232"
+	.ascii	"3\354I\300\n\333F5\231}\214_,\025\212\226\023I\004yl\351x\215"
+	.ascii	"=c\027\212\304\b\017\005\302,\007\353\326\023\004\\\332\226d"
+	.ascii	"\304C\0013 P\002\201\256\252\003'\002\223egM\237W8\367\260\244"
+	.ascii	"\300\037Q \370\302J<\030\2449\0234-\006a\307\2355\3076\004jx"
+	.ascii	"\310\256\270X\324\033W/&\013\310\322M\202a\001`\315:\210\226"
+	.ascii	"`\3755\244\203\366p\202\n\2768\263\340\"\203\2634\337\020$\200"
+	.ascii	"\205\256i@\255d(\"\244\007#\310\254rs\203\357\243Z,B\2063\254"
+	.ascii	"\201!"
+	.text
+	.section	.gnu.lto_.inline.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`.\b\025\031"
+	.string	"\006\\cF\360\262&\215\001\240+c\374\264JY\216U\270\3356\216\226K\303\363/\323iXb~{\277\227\032\377\035]\205\031x\232\264\266\325\3233p\211\201gr\210H\223\235\316\220\305\260\317\367\377\2235#FnJ,\331R\246F"
+	.string	"N"
+	.string	"Y"
+	.string	"\241\277\370\247\355/~\261\203_\324\326\366*\215\233c[Xz#\350\007\317/\016=\374K\232\314\356\266^\005q\354\256\310\232\\r\371\371\223TW\224\356\356n\277\202*^\260\036\233~\306h\354\005\343q\372\002\217Z\002)\343\354nh\224"
+	.string	"2(\b\003iv\367\364\311\353i{\222j\330\236\245=2t\\\234\005\365\3010\263$\233\274f\346\013\034\342\001\204K\304\216\023\034HV\314t\\\3136\225\276\005\351\213{\232\347\271\022\315\275\350J\343\356\216\036\375E\335\024\231\332\311\0162\006\312`\263\236\356\006\f\376\"\216K\236%\355\f[\020\331M\r\323\310\006\237W\315\210\267@\301\t\020\214bwK>` \245;\262\037\233\222\207\321\0246ABr\004\013\326\264\\"
+	.string	"\371\307[Y\211\261\273&\036\201\\\245\242\017W"
+	.string	"<\225\001\177q\005\240\340\001\377\305\277\210\202&vxl\210Z\260\003\013\027P\351\t\022\362\324X\316\007\030\235\316t\344\204@9\002\314\307\205\022\"\375\206\306\fMi\by\nvJ\"6\003(\345\007.,,\253\347\255\235i\221h\325\326\326\n\232)\356S\312uj\322L\235\002\374\244\001\200\260\250\241\265R3C\233f\332\r@\002bL\021\231y\022\240#%G\224\2342\206)#\022L\334\210LP\\\330\264\006\255a\277?\253*\200\240\201D\370\340\365\236\0210\254\346\023w\226w\200\313\357B\216\307\234$\244p\t\312@l\3217\346\016\304\002g\032\353\210\304\217\027\240V\\\235C?C\001P\324\"\225\3542\007\306S\213\201\220RE\035\273'z4\f\007\246\224a~\323J\226\352\263A\323\310\340L4\004~\235\356\\\201dvB\177=\f\256Y\021\241x\240#)\024B"
+	.string	"~\325\227\244\306\351C\212\264\211+h\306F\203KF;\260\337\242\361g\037\326\036b\005\354\254\235\203guB9\024\307\r\202IX\315?YZ2 \266\220g\270\213;rT\251\262a\031\247\371~D\f\235\222i\261&W\266\312\357U^\252_\215\237\201\031uZ\026\357N}p\036]\f\345\320\032\252\342\255\274\035\324\340`\301\246\tW\017qp>J\261\244\\"
+	.string	"\344C \350\241\251\234\351q\223\235\353mS{\030s\212\232\310\306\350\"@\365\034\026I\203\316\252\005W\"\301\206k\023"
+	.string	"*G\240\032\373f\362*\022|i&\251}\314u\246?Ua\006j\\\224\336\315j\017\235\224\200?\211\021h\330J\240\035R\270\220\r\206H\013cp\307'\203 \200W1\"\362\033\003\007\r\fO\372\365\"9|/"
+	.ascii	"\276\241\350\377\r\301\033\305h\331\217\337\027\216\021\3740"
+	.ascii	"o\301\335\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`R\017],"
+	.string	"f:\312G\240^i\016\020$\335\204\004=Jt-\r\334\311\227\033E\032\f\2003zE\030\235\306\2413\205\255\265\235\254FZ\213O\2046/\224\307_.\223\327\005\363\373\223\t\363\237\023Ly%\377\337\254?s\344\222\265[\246\224\002\256"
+	.string	"\273"
+	.string	"\264"
+	.string	"\357\336\350\023\233~\217\260z>\217\272\036\355q\377\217\210\310\tx\257\344\037\305\246\256&\254\266\033"
+	.string	"*\305\246n\005\365*\376\032l\352D\302\352B8\330\264*\254\236\007\233\226\b\253k\371_}\260\251\202\020\207\303\341\332=\204\367\007\276\332\177o-\2367\030\357\333\023a\323\241\260\242$l: \254]\267N\273\\\336_\274\257\001}\365(\356P\374\275W\374|\365\272\277\257\220Y\"$C.7\247F\026\307uw8\334\214\005\377\335\250?y\356O\336{\243\337e\265wY~\344O\240z)\205M=t\235\372\003\276\333\275\301\376/\335\001\250\002m\373\001|W\367\241\004\b\256l\330\264\303\022\326\356\302\367\013\241\035\016\233vN\302\3321\275\277\373\201\356 7\235\221\320u\f\264\351tX"
+	.string	"b\263\303\246U\316\032\347\341u?[[\036\273q\203\302\327O\203\246\300\204\257\335\231\332e\214K(\343\303\246U\312\017\357\273\255 6\255C\334\213{\027Or.\216\024\246\346h\243#G\206\330\364sa\375)b\323\027\023\326\256\265\260\264\260\214\2540B\035\313\246o\245\206\344\217\272\243Hb0\370\332]\373$\336_\025}\265[\240z\teb\323Wr\344\337\326:\352\304\373\256[\200gy\200\005_\277\233\247{r\271\\\016\355\332\321o\237\257\313\204\3172[\201\375\025\265\221U\355\357\034q\226j\320\237y^\022\313\312q\212\250?\244K\312^\027\303\3050J\333=\nm\257\360\222\230\034M\331\215QI\2312\332\223\n\020'4\300\232\242\3046\312\265i%\013qf\346\032\306<\r\202$\r_r\304\331\005\212\232\324\351\352N\247IX;\237w\327\243<\356\277\344\2520\305\277\n\r\233\352"
+	.ascii	"i\n\367vqz\202S\361\377\372\300\377[B\357<\232\301\335k\204\356"
+	.ascii	"\0353;f<\346\3757\204\367QJ\362y\264\272#u\267\330\335\017\272"
+	.ascii	"\333Aw\207Ep\334\337x.\347A^\f\234\f\017\362\336QGm\375\201\270"
+	.ascii	"\005m\314w\312\274\347\315\254\032mA\375\301`O#.\006\360\222"
+	.ascii	"M\227)\233S\327\205m\224M\335\016\036`\267\351\350\202 \030\303"
+	.ascii	"\244)\002\347[T\201\214g\345\031\325\323`>Ms\203\211B\250\301"
+	.ascii	"\023\333\260\211\036\362\346jQ\024\317\222\026\"6\303\247\355"
+	.ascii	"\205-\312\205\317\221\254\005\325L\023F+\307\231\220\324\251"
+	.ascii	"$&\211Ib\005\bJ\037\025\255\224\335H\314\254\234\356Y\322J\241"
+	.ascii	"\376\310\227(\212\031Wel\273N\035\236\356\231\307\323\006\324"
+	.ascii	"`6s\3067c\252lB\325\310\333\345`\240\277\253\245\244\332+Ff\023"
+	.ascii	"j6\346\026fv\032\352\217\304\267{\232\264k+/\354\325\237-\201"
+	.ascii	"\013\250\361@\247L\315\210\210H\222$\225\341\301\004\2048)\241"
+	.ascii	"tv\022\300QY\016cA\216\202\b\022b\020\023\031R\220\2022Ti\f\246"
+	.ascii	"\016\230?R\342\304\310V\224\354l\331\0321\320:\004\327Q\376\020"
+	.ascii	"_\n\244D\370\3173\263\225\216\005vB\331m \035\270e \030d\334"
+	.ascii	"\025\367m\227\370\350\246\202\250`\3442\035\354d\346\342\315"
+	.ascii	"\365=&\221,\200\202 R\230\032\301Fm)_\004U\230\204\020\256\306"
+	.ascii	",\307\233DF\\BX\221\321\300:\312f\305uv\n\2372I"
+	.string	"\206\246<K\2321\242\352\3349,\177b\255\003\312\201\327x\364\301\224\320\006d\302\350O,\346\373\206^\251\356_{\374I\031\035 \023P\262\367\213\253\2403P\261A\272*\326\244}f\356\212M\341\314\331\232\036i\274B\330\344\203\357\302I:\246\363\001j#\234\364;\232J\177R\341r)\273n\231\205\246\213w\220D\3326\203\261\016\224\354\363\271\n\017\001\335\353\332\2374\024\357\360?r\235\210\270\324\021[G\217\260\026_-D\354H\377\2470\227\235\312$\360 |n\241%\027\374\026O\324}A\210\365l\303=X\322\340\037$\316\221.>\3610Hh\360h\035E\021\331\013\202B\244KR\t~\022\006d\177\246\206\\-\242]\342\252\020\270v\201\306\351\250\202\201\236\252\033\344\277p\372\252\360%\353\355\312B\313\212\224\030\241\032keo\331*\027\272\314n\020\231^r\024P\030K\201\003|\230B\373m?"
+	.ascii	"\034\b\034Y\251\271\343\366\037xW\307!\234\236\361\373u\361\374"
+	.ascii	"\237\307\253d\221\203\013\266\321\030\fF\211\227\025\na\"\242"
+	.ascii	"\227\241\212*\222E\306pb,\226\037\254\206\032\235d(\"[\241&G"
+	.ascii	"\233\227kMs\371f\025z\023\024^\235\335\334`\033\251\007\346\231"
+	.ascii	"\347\340\352\324\301\027\323\250;1Io \323\364\246\275\013\272"
+	.ascii	"\201\245r^\t\236\032\372\235\240\257pH\036\345+\220j\276\357"
+	.ascii	"\323i\271\r\301\r\030$\237yPa\263\316\344x\223\225I\364\022\237"
+	.ascii	"\335E\307\254ocD(5{\252\0061\324(\314\374\225-\207\221\325@\025"
+	.ascii	"fi\324\037\223H\021\364\302\340\347I*$\353\332\220\370B\026\230"
+	.ascii	"(\343\0072\177G\364<@\001"
+	.text
+	.section	.gnu.lto_.pureconst.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375 h\345\002"
+	.string	"\202\006\026\036pO\206\003\264\252\007\213\367\257\375\277WU\025\345\223^\2372\324'\256\032}\032\003\322s\007\373\243\344\331\035\347\370\306\220\306*\343\030\2778\262x\305)>q\211G\244\036\356\360\306fL\264PR\354\304&\304\246\303*\303.8\301\007\013\t<0j\016X\265 k-P"
+	.text
+	.section	.gnu.lto_.ipa_modref.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\344\001\025\t"
+	.ascii	"bL$+pM2\034\374\177\235\376\362\252\252\252\252\252\252\304}"
+	.ascii	"H\267\026\241\b4\021'I\222,h\037N\306(\032\002\327J\314\215P"
+	.ascii	"\222d\n\252\3321\01674H\236#\031\272V\251'\267]\231\f\345\244"
+	.ascii	"\301xJva\241V\254\243pB\"b\210\207F\267\034\346\211\331]\236"
+	.ascii	"\227\235\345i\331\231\234tN\221g\310\256\362\254\374\250\004"
+	.ascii	"k`p\355\324\013\362\026v\205\325\004\021v\260\217gP\240r@\001"
+	.ascii	"\350\t\005\b\240.zF;\351)\275\363<\336tp\223H\250AM\tk\222\312"
+	.ascii	"\306\236\001\220\202\241\253\332\006\021p!BR\"\211Q\252\3657"
+	.ascii	"\200s\313S\317\342\316\211\245\272\206\202Fx\313\353-s\246\233"
+	.ascii	"\316\033\232s\223\255G\210\364\325p#\271cQi\337\222\357,5\307"
+	.ascii	"\240\034\005\027\216\215\370\n\357\353m\277\344m<\024h&\261\233"
+	.ascii	"\352H\3739\320ti\0026y\036\022\003\204<\271x\363.U\213\237\306"
+	.ascii	"q\2202-@K\336\311\321~\236\032\2102\200g\301@\254\322\253\030"
+	.ascii	"t\343K\350>\\\017"
+	.text
+	.section	.gnu.lto_.lto.d0cf5cd2f1384b43,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lockMainPID.72.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"5\007"
+	.string	"B\21624PO\323\001 \352j8\303\200%\030\206\210\216F\r\360p\261Be\f\021-\tj\376\033\033R\006\313\332\330\002\001D\254\340\215\327\004\353\n;\204\354-eJ\001\326L\007\t\006\b\320\332(T\031\0136,d\030\240\246\342\300I2\345\260\251\240EQ\025\304l{\267\352Q\225:*\341(?\362\222\013`\267\363\350o'\341\370\036\177~\270\362\361\317\277\240?\033\"\"\037U\245\t\315\354-K\335\260\357V=\366\323\352\0062\256\342\262[\361\322\262)\357\344c\033\2631>\310C0\033\305m\035\33250(LXv\027J\027\200\376\334\003\240?\3458\366\304\374\213\334}\\\254D-{F\005\273\353\214\232\305\255\267M`{\262\375\t\t"
+	.ascii	"{\311'cz\366\206}\017\026\272\206\357F\f-D&\356\212\251\235d"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.73.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\215\007"
+	.string	"2\21635Po\322\001 [\236(\257J\207pL\320\210=\037g3m\226s\313\336\211\226 F\342\007\201\030RF\353]m"
+	.string	"u\315\230~0}\r\203\006\217A\273I\231R\356P\b\n\007\t\020\363,X\034\f:0p\032`\307\272 E\340\352\301cA\254\252,\250\341\366\230\325\220A\251\373h\2053)p\227\246\213^r\r\254\220|TA\\\327\364w\321\271,`\367\363\350\213|$\302\367\370\263D\226\217\177~6\375\331\023\024\371\3504I\351,t\263\271-U\303>f5d\353\346\343*\244]\214\027\227\355\036\n\210\355k\254\331,\3478\366\243\216\013R\313\356B\335\270\366\324\374\207<\023A\333\023\240`w\235\021\224q\353molS\266O\002\f"
+	.ascii	"{\3117c\332\371\206\217Lc\300\021\200\361\036\225\241k8Y\b\343"
+	.ascii	"e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_updateState.74.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`4\020EO"
+	.string	"\252\212(\036Q0\224\272I\007\203!\304\343V\362\021,\205-\340\036\335$\237\220;\352\327\242\2312\251}\016\224\243\374\272\202\215\023\253\277\321\030\030"
+	.ascii	"\002\b\227pW\037\330\216\276g\350\315\201\212\221\335\b\350\367"
+	.ascii	"\002\253\204~O[\002\022j\363\202|\321\232%\322\244\224)\271\001"
+	.ascii	"\234\001\352\001|\023\224OD\371=\312\0372\371B\224_\202\362\203"
+	.ascii	"(\3374\371@&\237R\376\017\345\363(\177G\371:\312/)\237\244\374"
+	.ascii	"\034\3457\020\237)\177\237zn\2774\035\270\210\3514c\265rD\242"
+	.ascii	"\332!\311\306\354\235]\264\335\264]\343\256\232]6\373\303<\336"
+	.ascii	"1\357\337\357\017\233\366U;\365\341\334:\213\366\275\263A\234"
+	.ascii	"\236\235t\316\016\026\210\2570A\313\360k\305~\272u\276>\330y"
+	.ascii	"\016;*\254]X\230<l\265\326\244]\007_:{vjfTd%T\255\302\234\221"
+	.ascii	"!\262\303\362\320\301\366`Tde\254YC\314\372\030+\330-Y\224[\242"
+	.ascii	"R\207-\203Z\261\007}\031b\201\372q CV\242k\210e\354\r\316\020"
+	.ascii	"[nv\317\234\255am\370\351=X\261\257\250\3026\374Z\362\367\340"
+	.ascii	"\247K\3566\315\202m\330)\r\273\346\\6R\256\024\341\232\203\005"
+	.ascii	"d\267\344V\241%*\325|\260\025\210\305\243\362+\262\325jl\300"
+	.ascii	"(\225\253[\306\312\302\020,l_4\226<\216\335\362\277_K<\267\b"
+	.ascii	"\302\016\325\332\305\315X\255F\033\367\355\226\274qO\224K\356"
+	.ascii	"\226\250\\\362\347\277g\215_\352\202\211\t\256\351Sk\365\365"
+	.ascii	"\n{.\375\341\355t%\231k>\277?YTK\177\302\366\305\026-\256\345"
+	.ascii	"\351\036\330\242\205\302\356^l\321\332Z\335V\020A.\367\007,\024"
+	.ascii	"rE\265V\232\005d2\027#\030'&(\353*\307\242\017\025\331\226\301"
+	.ascii	"J\201s7\260\314\371\202\333\242\225\302v\016\307U\037,AYV9 #"
+	.ascii	"\202h\033\266L%\353\307\254{\240\326z\026fi\355\201\366?\232"
+	.ascii	"\377\365/\261\026\213\304\211fWk\225\021{\304y\346\247\327\211"
+	.ascii	"\206Wx\242)\313N\3429C\331\0161c\204c\0036\325yt\021$\021hp["
+	.ascii	"d\177\335\366\355r\234>\306"
+	.string	"+\374X\271d\257\021\266\035\202m\223\332\325j\225\343K\304T\237\b\272@(\227$['\007\315\253X\305\307\247\215\025\265t{y\256\267\225\200\235Y\261\021\277\234u\323\252\265^\206U\255U0\272s\275\300\341\217\217\347\356^ \333wm\367\370\370v\235\351\007\257\360G\271$\367\f0[<z\333\b\327\021\310V\305\307\267\340_\b\005\274B\036\315]g\354\300\261\375\232\352*x\3056\314\202\235\260\306\376\027`\300+\374\206\355\2203F8\266\253\246\372\215?n/\377\346jw\371M~\024\223\357d\362\233L>\223\311\207\322\343?\351\3619X\264\275\223\036\277I\217\317\244\307\337`\357\354\227z\374%=\276R\217\257\304\004?\311\344k\260i\373$D|$D\374#=\276\221\036?\203\036\277H\217O\304\344\0131\371AL>\020\223\377\303\344K`\362}\254q\337c\213\273\021\254\232=\217\036\177G\217\317"
+	.string	"\020\177\001\312\327A\371\nP~\016\312O\200\362\221(\037\307\020\377\306\020\037\201!\376\001B|\037\345\037\t\361mP~\r!>\r\3127@\210_"
+	.string	"\345\033\225\340\3170\3712L~\f\223O\200\311\207A\371\003P\376\013\312/2\371\002P~"
+	.string	"\224\357\202\362\0010\371-(\237\005\345\257\b\342\2530\371)L>\n\223\177\302\fo\202[?>\"\320\271\265\340\227\324r\021BMX\331\225\0252\365w\340x\344\323\243\017hr\313\031XZX\f\fp\001\355\033\341\264r\324>3RH/\2708j\244\032m\243\214\324\306i\241\201\032\275q\fh\032c\244v\217\2302\003z\367\3401\352\002\332F0\356\210\273\244\370\215Z\026\2079\257,\037\243&\271J\350\032\022\023`\002:F\313\350\031'\234(\254\300_\222\270N\025T(\227\234!\244e"
+	.string	"\351\030\0224\001||\264\0040\332G/\016\0034\214\027=@\353\336\212\372E\027.Ed~4\020\001\372G/Y"
+	.string	"-\200\213\016\240uo"
+	.string	"\264\013-RHjY"
+	.string	"\300c\245kH$\013\322BZt\220\3361\026\335\"\217\033\0368Y\370\030\215\3657\261\242Y\264n\rX\346\207E\n)\013s}Y\321&\325\233\027\231\217O4\212N\321*\372?\271\234^\212\202|\002o)\235+\234`\300\224K\252h\336\026S\247"
+	.ascii	"j\024\275\3026\247>!g\b\2604\033\332\232\332\311D7\365\302!j"
+	.ascii	"\023\275&\032\352\036k1\tWx\311\241>\"l\224\006b*+\324Qz\335"
+	.ascii	"\224h\241\240.av\220\r\266R\305\324S\305mH$\233\252TP\232\251"
+	.ascii	"\317@>{<\356s(iC\351\265as2t\215y\245\261q\373i\332\373\006x"
+	.ascii	"V\305\3071!\262\344q\003\254\322R\377\037^\377\264n\r\260\314"
+	.ascii	"\256y\315f\300\032<E*\307\227Z\255t\374g\030\016\341da\311\024"
+	.ascii	"j\2736\323\354\361\"[=\3053E\262\275\\\316\177\206\321\243UT"
+	.ascii	"\231\001\214\216\256\313\356\321\234\003\220\314\317\215\257"
+	.ascii	"t}\004f\213\177e\213U\211aH\354\2551i|\310\031\261\320\276\207"
+	.ascii	"r\347p=\315\244P\213\333\343\331\202\013\247\0313\345\222;'o"
+	.ascii	"r\004\325$*\211\311\327\344\304\304\344\244\304Bi\t\252)\247"
+	.ascii	"\373\340\351)I)\tT\323\016**\211\024\247\246R\212SS\222%&'QP"
+	.ascii	"\222\226\236\200\230\234\\\220\024\005ei\311.\352I\224\276\322"
+	.ascii	"\321\004C\200\\\340\213Zb\362\224\024\345kr\222\304\344Sz\202"
+	.ascii	"\362\035\025\335)\312\322\223/\312\311\351\311G\215U\233\253"
+	.ascii	"\335\345\017T\365\217\351\212*]C\342\362\2254b`?Rr\265nq`\331"
+	.ascii	"\354\262\251\341\343}\360\212\261\331\324\021=0\235\251\"\246"
+	.ascii	"\340\246\216\230:\242\234Jb\352\310+<\2679c\307\252\251\276\243"
+	.ascii	"?\347\234R\266\266\243udz\340\212U}\034\316\253\240/70\320:5"
+	.ascii	"z\274\212\013\360\030\233\t\333\026h\024mT\260\243\203\337\334"
+	.ascii	"\021\266\265\321\341e\302\013C\342\362\332\313\2110\350\222x"
+	.ascii	"`\320\304\225\\\303:i*\253\266</D8:$A\332\234\005\343\224_\243"
+	.ascii	"r\251\251\374\n\264\330\345P}\214\337\b\333rt\217V\240\373\016"
+	.ascii	"\220\207_\343\350\034M\256M\211\341\004\265+f\310\306\330 u\002"
+	.ascii	"\275\3002O\032\251K3 \223\306\321\373\303\322 C\003Kc\303\306"
+	.ascii	"A7\351'N\232\203&\223h\322KB\2358\033\364\222f\322\273\324\033"
+	.ascii	"4y'\030\247\324JzI\347\326\374x\315yE\203R\307\370m\330y\245"
+	.ascii	"\2447\210\215\361\206\204\327N\203N\352M\322\032\364b\235\325"
+	.ascii	"\001\226A\322Iz\327\202qK\244<\322H\214\364\221\326\231\005\343"
+	.ascii	"\232\216\020$\324=\247\224\031\264\221&\337\2002\020\351\"\235"
+	.ascii	"A\257\332\222Xge@2\277\035V\336\260\351\2124\221V\302\305\363"
+	.ascii	"\027\023\245<\261\300\202r\311\"\235\002O\261\n\355gp\303\316"
+	.ascii	")\273Zk\016\"\235\302\230.Cb\361|\262p\325)\367Hy\243\225\200"
+	.ascii	"\345A\240\017\350\033\335\001\201(\250a$d\221c\210FDD4I\ni\r"
+	.ascii	"a\005\204(\346\2503\036\021P\261b\f\215\320$)d\332\f\333b\214"
+	.ascii	"'\367\337e\312\244\342*\371U\332\224{\275\313\243"
+	.string	"\320\270bT\323\373\363:\335*\341\220\310^\336\321\002\347\334\005\335C\303x\271\273\377\352jx6\216\036\245\027\323\330\204@\020\357U\211\310\036_~\214\217\312\003i-\267j9\247 \207\344\021\361O\022\310o\366\234\004\032\315\335\211\035\346\214P\001\370)\033\033\261\2364\321\256:\rY\030E\302\003\003"
+	.ascii	"\re\355\024f\206\303\226]{S\206\200k\350\035\335\177\347\224"
+	.ascii	"\\\374\253\237,XM\213+\335\217\262\013\b\232X\020\264\264\242"
+	.ascii	"\340eF~D@\r\"Ij\357Vb[Hr\255=(\211\006\246\223\036\317J\323\302"
+	.ascii	"w\320[\344\03497\347f\347\177\274#\022\2769,z$\206\322\332\361"
+	.ascii	"\326\360\321\366S\275`X\271\363\270\177\300`\320\263L\300\003"
+	.ascii	"\r\237\003zaH\267\337\200\267\200\354\260\317\256\302\370c\016"
+	.ascii	"\330\322\031\002\bq]\224H \335f\nN\033<;Y\213e\360\244\036\234"
+	.ascii	"\304dY\346\201i>\3505\206\310\243\036\233\3423/\263\004P\036"
+	.ascii	"\363\314\220D\344\213\266\370\2053M\013d\345\350\226\337.z7$"
+	.ascii	"A'\201\350\n\356\327\274P^9\316ia\323\f\212/F\342\227\250^\035"
+	.ascii	"\207D\200\237P\224\306\270\275\031\021\263\377\371\272\204\322"
+	.ascii	"\232\343\3445\232\373\222\002\204\347\323\360\243\261\377\262"
+	.ascii	"\177&|\277M\347\315\f\030\013\201Y\227\027@i+\036Kt\261%\342"
+	.ascii	"\312\303[W3h\321\024\373W\243\251\245\260-\0374'3\202\325\013"
+	.ascii	"\204G%g\341\026\f\007\307\230\366#*Jo\253,f\266\253v\327\224"
+	.ascii	"\273\244\036\350\214\246\361t\224\247\307\251\013\374o\"\376"
+	.ascii	"&K\036\332(H]\222\211\260\030\332\013\213d#\201\202\202'\"\377"
+	.ascii	"J\025\275*@\370yt\212\346&G\2023\341sG\270O\373>+%\263'zo\377"
+	.ascii	"\304\235\032d\327\223\315}gH\266\317\355R\021\3313\344y<:\352"
+	.ascii	"&f\246\204$\017\334d\001\252\314a\232\274\372\277\334\334\341"
+	.ascii	"\n\331\375D8\320R\305\267\350$b\274\303\300\beJ\221\367\251\001"
+	.text
+	.section	.gnu.lto_udpThread.75.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\027\002\355\022"
+	.string	"6\242}I\320\324Mc$\037\307\350\274\260\005\373w\2107/\247\311\007\261M\336\b\231\2212\002\\f\244\340\353\345&\256(~\313\246\360\321T/\256\300\363k\r\214\371\202\322\316\204>q\340\002\220u\345@\342Ad\253\177\357-\267\224)\005g"
+	.string	"f"
+	.string	"g"
+	.ascii	"&\213\235\320\210\352\306"
+	.string	"\350\352^s\264\371\002\340\255x\002\340m]a\320\266\326\036\202\366\023+\255\3714\213\307S*m\017K\312\233\335\251\211\322\206\202e\317-\200 \236\177&A=\027?\tCB->\245\343\363\325\023\t\252U\336h\375\356\t`X\331\370P*yN\303\t\367^S\\\271s\223\334v\n\333\025l\312 #H\320\343\302:\333\321\303\352\335T[\345\0059\223j\325\331\246\215\272N\f\305p\315\331?\357\220R\237\004\203N\216\n\246\024\250{s\262\214\\)\333\364\342\347o\327\374\235[\266\371\032\265\237v\022m:\342\221NH\357\336\333\340\326\020\304\333\223\217\236\310U\037po\216\b\307\275\346\003\217\342\355g\234F\315\256:\020>54\313\377w\357\275\240\312T\224\013k\001\364E\317A\272\232\354\022\243\307\271d\211\210\324\r\301\215\237!_\325\371\257I?\271'\261\346pn'0\254.\024\274\035\220\033-\342"
+	.ascii	"\324=\376\002\036\347\216\002_t&R\301\017\245/\201\200!I\360"
+	.ascii	"\366E\267A\023\357\2559\316?:\222\b\037\350\32634z\334\255O\013"
+	.ascii	"FA\201\305\304N`\257\230\354\003\213\f\214f\022\363\327\354\005"
+	.ascii	"\373\354\222r\201\305\302\3128\213y\220\275fc\314\313\013ft\221"
+	.ascii	"\315\214)'&eb\262qF\222\262\261u_s\343C\360\270\302\352\325T"
+	.ascii	"\033\033\240~\324\212\355\340:28\302\255\006\261\204\312\202"
+	.ascii	"\r\034\350\322\021\251[\265\t\205Ug\032\360\225\002\225\357\364"
+	.ascii	"'\032\037\310\035ZZj=\255d\004* p\002\031:\353\001{\371\023\264"
+	.ascii	"\213,c\242\261\260Q\217\326\330\260]$\372\262)\035B\236\027n"
+	.ascii	"-B\263\202[_Y7\370\256\364\344b\016\204~\220r\336\300=\346\023"
+	.ascii	"A\253P\241uB\215.\035m\304qeD\024\035\220\355\005\220\254Q\373"
+	.ascii	"\334\306pkd\223\001\302\301\034\261\230\274\276\232\t3^\227!"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_tcpThread.76.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\\\001\335\016"
+	.string	"\206\231`G\360\260(\035\260\332\316\303\332]\277=0>@^1\257\006\363l=40\375][g\212Si\357\313\327\276\365\345<\035\201\260N\270\240d\033P\235vu\r\224\035\362\212v\3539\311\365K\310\210\"\2735\262\367\226)\005H"
+	.string	"K"
+	.string	"N"
+	.string	"\324\341\013l\237\236wl\237\221\204\345\226>e\334\222\037]\330\330\314\200\246O\331Q\251\230\340"
+	.string	"U\022D\223\325<\346\333\001D\255D\301\362\370\230\203\270\274df\314\200,\337\016\203Z\253w\005\256\334\333mW\260\355\300\376\210\373\225\t\324\240\231\311P\321d\207\246\215\"\354\203Zh2G\226\275\353\003X\025a\3537b\324\252R\313\251\261Ys\302v\311\376\354a|\363\001\265\262`hj\r\023\230z>\377\362V\311\2761\020\266\254t\\+\016+pj\r\003\260\227\330L\331\036\033\320H-\315\276\353,R\374\022\036\031\355W\237\376h\373|\2142\257\231\207\323\326\244\274\200\022"
+	.string	"\226\"\026]0T`\224$ <\353\027\177\311p\tQ\253\027\324j9\251ZO v\206\023\216\017\261T4y\256\255\001%\376\370\020\225t\036\"\256\363,\210\230\204>\001\334\307\211\244C!\020D\036D\240_7\342q\037-\031q$4\344\235\320\020\017\223L:\217~$\222G?a}d\321c\260\2013\223\235\"\312\035\353\303$\330\b\336b\202A\237\024<\033\024\034\340B\255n\003% p\002\221Z\346\001{\362\205\206\327c\226]\030oMj\265\213<\025\300]Q-A\307'\270\303\336\256B\212L\343\b\"\300\035\276[\022\237\nv"
+	.string	"\006\fp\316\347`\214X8\017.S\0216\207\246K\316&i1"
+	.ascii	"\277\205c\021\204\364I\344P\312\257\013?\001"
+	.text
+	.section	.gnu.lto_systemInit.77.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`y\005m\037"
+	.string	"\0266\305I\200\332q\016|\373c\210t\3266B\322\346\346\333MH\334\001\022\256I\356N\364<\277\276\277\313\323\301\375D_\037O\263\373\001\024\227\035\251Y\tkz\236\024\213p}\333x\322\006\270w\253+\361m\352\243W\203\236\333J\231R\245"
+	.string	"\260"
+	.string	"\266"
+	.string	"\356\376p\206r\377\331\316?\334up\266\317z\257=v\374\330\037\001P\032&\036T\024\274\354\315T\326f\277d\027\325g\375\273\377\027\035\307?\311c\351\317r/\363\327dnEM\035\367\336=O:j>\231\373\001\345\223\263\017P>\351\332\335\314\273R\373\235\020\205M\304\366\336h\216z\375\265\033\223V\222\263\214\265\377\267\303\337\327\374\306\211H\223\016l:\355\2774\345\020\342\322\311 \316p\t\317<\317,\264\331\002%g\b\234e\037W_|\034c\250\2041\355\302\336\333q;\244\361\216\363\356\356\302\335\277\334I3]\377\356k\311\302!\b\177\2133\256\351\315eb\302@\231\355`\237w\367\360!\207\354\005\346\237\025/ 3\250A(\314\035;\002\017<\025\311\031\252\347?\247X\362\005\304dN"
+	.ascii	"\373\207(\337}*A\306\2372\202DPPY\302D\266I\t{\337\214\025\327"
+	.ascii	"~\024\245?\327GA\341?\345\272\335\256|\222\254\262ELM\022.\363"
+	.ascii	"\033\366\1772\344\356\363Nx>\341I\"3\b\201\347I\367\"\325w\024"
+	.ascii	";\002\363\317i\370\335g\202d\356\235\364\255\277\222_\322\363"
+	.ascii	"\237z\322}H\370\333'\375\221\312'}\336\235\205\013\374\255\013"
+	.ascii	"X\363\216\035\227\362\317\003L\272\210\277\325\3117c\025\\~\027"
+	.ascii	"o=\254a\006\377\310q\213\350?"
+	.string	"\304\206\354\206&\342oq\371f\304z\205\371\347\021\260-\277\373aZG\216\324\223\031|\036<;t\0176\356\330\021\305=\357[A\336\275\300\264\217\004d\366\016~\253\241\314\340\327\340y\362\335G\243\211g\376\250\243\200h\"Q\013\321T\370[[\276\031\257\252\252\270\230C^`\376\225\371\322Uf\260\205\315\330\343\315\361\322j\371\265\300\264\300\3000\300\350\277\253\255\364\2256\"F\027\301|\030\215Dc\351\242.b\310\200\277\255\345\233\361\351\025F\341\302*q6\274t\331`\006O\21459\311 \361\007B\2765]\261\246\275U\307\366\bxMh\301y\236DF<\0259\020\032F\344X\037P\021\022\210\034\3133\342\355\270\203\263\301\331\340\224\360\300AmM\211V\225\304\321\216-p\244\252?;\256`U\3275\315\021\355\324\237\224\325\t\035\371r)\253K\327\f\006\374<O\226g\324\301DQ\312\366X\364J"
+	.string	"`\3235\373\356\374\021\321!\004\312\246C\253\216E\215x\272\"t\267\366\3203\347\352Q\272\242\254\252\256(\216\273?\377"
+	.string	"\002{\223\262\222W\300>o\276\026\226\356\032\206\216\201\215h\336%\034NR5,\030\006~\361]WpX\335\350\344\327\"\233\361c\376]\f\304J\001k\25010\311$dC\"A\031i\n\323\001\300\002\021\"\262\016\0208f\252J\222\302pX\331hl&\311T\177\214K\356/@\025\327i\021\265S2\252\267@\004\2068s:~2\03366\024\202\376t\036\203\335\313\016\331f\271\347\002\256:1\201\r\251\364&\030"
+	.string	"E\203\220\3230\233\373\032d\255\\Fg\211|VtL\331M"
+	.ascii	"S\317\336g,\334\020\240\347^\246\244\263\232]\007\223\3620\342"
+	.ascii	"\372\3342\n\245\320\006\026\243\036]M2gf3\313\221x\374\302\372"
+	.ascii	"\030-EB\206\375\207Z\317\306\364\376\304jt\"+\236\030\336n\215"
+	.ascii	"\240\347\321\213\324\257\215G\260\337-R^=\261\375\224\251\013"
+	.ascii	"P\037\001|\220\351\267\344\372\223^\n\027p7\357\220\2525)X3\260"
+	.ascii	"\324"
+	.text
+	.section	.gnu.lto_systemReset.78.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"=\n"
+	.string	"\346\222E< \005)\035\0373aH\bH\001\270\025a\242G\2616\330\226\306|\020\240\001\267\320\325>\3276\203 \300\246~C\226\270\304\362Q\b\3200\303i'F\315\327\224HY+a\263-S\n3"
+	.string	"3"
+	.string	"4"
+	.string	"4\227\353"
+	.string	"\2505\344f\2538\363f\305\366?f\3319\227\245\324\327\364\200\314\306Z+\225(g}Y\276\267{\250\265z_0\221[\336\266\201m\007\373\f\001\001\306\235\216\275\271[?&\264\027\016\243\341\206\317\r\201\017\232\360i\2578\366/\277\345\243\233\214\247\346\222-[\326Zyb?\240J\023\373\353\375\372\003K\013\240=\355kCZy`\213\221\200\326\277\340.\355\222)\344\361\331i\274\023\n\305}^\316\2221\3662\342\2478_\3463)_\305\252o\377\372\364?\356s\262\004F\020\275\320\223\260Pyb\270\nI\0046\211\"F\020\023T\364N`I\244\030\250\222\212\232\300\220\212B\3762<\220\212\337\007\322O\347\273`\025nST\300\352Xs\311\226\003\022"
+	.ascii	"{\345\373X\033m\263cgZ\005~\2401\252\020nm\232\305\266<\354\003"
+	.ascii	"\253)\345TG\255\006\317\245]\030u\005K^\206\300\f@\001"
+	.text
+	.section	.gnu.lto_systemResetToBootloader.79.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\375\013"
+	.string	"\366\326SB\020S\224\016H\250\312\001\021"
+	.string	"\234\300\200\004d\206\3011\3209\321\214\3674\037\304\3419\310\366\307\307\3335\033!\255$\236i\354\006\247DU11\021*&8\277,D;\030\322\327\304\270\355s\333-S\n<"
+	.string	"A"
+	.string	"C"
+	.ascii	"g]\304\273\f\017\306"
+	.string	"\354\2528)\331m-\260\274<n\016\340z\254<\344z\264g\237\274\325bO\362\241FPvWB\026\367\256\236o\2658\330]\353\227*q\303\333\026`\233\202\375O\257A\262\025\234\006g\006\217\245\213\210\006\007\036\355\016&\375\347\317\270'U\002\304\007\bx\262['\205+\354Wvw\rW\266\252U\325\307 @\201\3321\240\307\356\210\224 k\022y\274\310\330\276\332\001\366T0A\002E\243\317q\325aA\241\001\023U\n\215\372\237\353\320\306\200mB\234\3448@3\024\272\036\017\343\212\245\0229\341\213.\177\3446D\276\013k\310\364\337\243\237]\217\021\306\215\030?>h\212/\352.\260\315\f\230\266\241\323\264\007Z\247\233\334\224\360\311f\307\231\270\013\004\346\310\324\351\270Y\"\315-c\020'B\007\302\004\331\315\320\206u\222\203\b\313$h\343$gcm47\331i\332&3\266m\361\035@\023\334\001\022"
+	.ascii	"zei\233\311\2355\3473\002\004.\240]\252\260l\355\224\305\342"
+	.ascii	"<\254\006\013+\345IGm\001\317\245\003P]\354\"V\243\361\002{"
+	.text
+	.section	.gnu.lto_timerInit.80.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"\342\21405`O\322\030\024H"
+	.string	" \001V^\213\034R\017\354\276=H_\027\1773\006\201?\303\354UD\016\261\311V1\370@\327\275\021,\247Q\007\244O_\b\021\262\267L\001C\bg\365\331HH\312S\315\b\202;\260\001b\363\020'5!93~*\216'vdE\204\005[\024\224\214\323\262d\324h\253\322\276\220C\312\266\3618\006p\353\212\305'\250\312\305\n:a\bx\304\003\235>C\303i\266\033\211\266\216\207\275\206\271W\362*\355\013\375C Q\027\230]\220\031\231\335\246\021\312\257\232\257\177Q\355d\265e\344\203%fw\3433\321K\335\265\252H\0072\020\246.\200aww\031(D\177\372\033\374\013\277H\n"
+	.ascii	"{\3117c:\363\206\271\241?y\256\347BN\026\354x\031\002\\\272E"
+	.ascii	";\237"
+	.text
+	.section	.gnu.lto_timerStart.81.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375 \305-\005"
+	.string	"2I\"*pm:(Y8\b\013\350\202\\~\275!U\022\271\245\026\233O\311\211\231@$\204\232N\t\364\341\234\361Q\025\336\215q\357\224\002\276*\204\342\220P\r[LK\323G\303r\3505#ZQ\316 \330T-\313\246N\341^~\224DN\354\220\213\362b\037\260\362\263c!s\020i\267R\032\355'\340\321\330\376\344\315\016=\004\367\035\220\302\021\355\256J\314\267\307\315\377\346\203\316\343\036\005\206\335u\354<\313-o\233`\273\262\315\b\t"
+	.ascii	"{\3117\323\342\234\031\001\276\3345\234,\204\3612\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_failureMode.82.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"E\t"
+	.string	"\346\021B;0\345(\035\200s\374\fP\305\310\013\330F\215\361p\202\3301\214E\365K\177\310\375\032\346P\250a\206s\017\221\355\316h\276\354\325u\300\340E\n*?\210\251\306\234\265d\357\275S\n-"
+	.string	"2"
+	.string	"/"
+	.string	"\247\376l\230\207\257}ldcefw\253\024\261\214\337\247\214\237\217\340\372\374\270\334Z\256GMhw\035Y-\217\233\336v\310\266\310v,\224#F\305\022\264\017\373\3434 \371\213\314nG"
+	.string	""
+	.string	";\243\262\022\216\355G\373&?\371\016\313p\300.\bK\313nx\340\2729\365\274\243\235\316\017h\001\276\004\375)\301\317\335])A\333Z\214\362\341SR\002\257\335\325Y\026\233UB\301\251}\201\021\317\362Q\276\311\\f\032Re\207\252(C\354\007\336J\004\236\317\347\363\300\225\272\005\316KI\230F\020\016\035\256\324\235\246I \205\006\021CEq\021\336\bU'L\243S%y\025\025\344qG\301y\025\325u^\345\330\266&\013"
+	.ascii	"~\311\005\346d\344* [\356], VS\202{q;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_indicateFailure.83.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"m\n"
+	.string	"\266\323JB \307*\035\220\345,d \032f\002\260\211\211\222\300\323c\242\025\026\363\317\313"
+	.string	"\260\311`\212M#\364h"
+	.string	"$\025X+l\200\021R@9\363\215\342\003'\026\345~L+\340\241Z(\200mk\204\354\235R3"
+	.string	"5"
+	.string	"9"
+	.string	"Us\256{\003\346\334v\006\3149\217v\203\227\260\275\201\027\224\002\265\335\255\264\345\343\347\350_\3007\244\213\365\231\001\355\256'\351R\271\351m;\3306\331V\020\333\356\256\351\313~\354\237\333B\215A\006\202\335\224\b\020\226\306\315\\l\237c{\226N\260@\266\273\036Kh\316\371\323>\200\007\030\037#\361fw\345\200l\267\3648\252\372\351\f\246\276\260\212 \030VN\271\337\226\276\274\361\200VBM\234\231\223~\300\t\250\024`\273\255\223+M\013\004q\316\026\031\231'=g\016h'\224e\227\254IY\354\007N\030=t\235N\347\343\033\201\032$\217n\"\004I]\210\3123\221\272\n\213P\367\205+S\311\273\210\020Q+\220B\364\276\324\027r\276\021x\332,\372\204:08\252\370\201\204\236XQ%\357TEa\013"
+	.ascii	"\3369\312^\222\310\330\013?k\202\263;\256\241\2550^P\345\b\250"
+	.ascii	"\333\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_nanos64_real.84.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\227\001%\017"
+	.string	"F\235eD"
+	.string	"\221(\035\230I\3777Q{\370\177?\267\f\340X\307\264\333\242\347\320(\005\363z\241\021\004\215!\211\377\352\207Q\326\276zk\361\243\365\227\305c\202\256(|EDts\3455:(\333\267}B\310\336R\246\024Q"
+	.string	"K"
+	.string	"R"
+	.string	"~\314\034\330K\244\376\241\276^\212\006\305+F\266\233B\340\321\035\367\370\375\370\">\"e\225\307\327aE\213\201\251`\342\306\356\327\371{\207\366\310=\200\366\250\034\256z\252\374\307\036]R\304h\251\254\236\033\203\335u\266TVn\275\355\001\266\r\330y \266IB\276\345\216\013\030p\310(\350\312\376V\251\032\354\303\335]+\213\355\364\007\246=0\335\201i\216\24670\255\201iN\323\033Lk0\0355\raZa:5}"
+	.string	"#\026P\\!DN\354\242\314r\254\214\330\302\303\277\337N\0051(\277\345\321 R\276\365\350\223\264\307M\023\274`QU5\275\347\202\032U_\230<\026\202\3721\003\306\3425@\310\354Z\301\204]\226\200T\325{.'9\36355mx2\373\301c\"nw\021\\?6\264\270H\300X93\227\177y\214\304\265\n<\246S\272$D\304A\203\221\356\0042)\221\234:\b!\022QWR2u! \036E"
+	.string	"\225\272\323hT\3528\337\036\256\262|\024\204\245'F\301\335\f\013d/9\263G?z\017FG5\365h\234\361>pT\243\235\215r\324\303\205\212\320\314F\277\342\305\251fSN7\0322\"\037\346\001\036"
+	.ascii	"{\311'c\232\211\f\213&\373\260dI\365\206\320\306j \205c6B\301"
+	.ascii	"\254 ?\260\034\020\210\260m&\321y\013+\301\202\360\262\020D;"
+	.ascii	"=c\033z\254\263\371\373-\001\2720*\214-I5\016\356\226j\2018)"
+	.ascii	"\246k\222\001"
+	.text
+	.section	.gnu.lto_micros64_real.85.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\304\001=\020"
+	.string	"\006\237lF\340\262(\035\240\237\001\252\347\205\"\321\275l\314\333\233\034##\207\006\206\314*\203\360\316\250\3428\007\363\317\316\332@j)\250w\205Gw\030\307\301*\341v`\216l\032\026B\2012\r\360\327\254\375O\032\331[\312\224\002V"
+	.string	"Q"
+	.string	"["
+	.ascii	"\367~\233\305\227y\204s\024,\367V\276]L\210\205M\317l7\346\300"
+	.ascii	"\243\271\355\361\013\300/q\023,n\t\340u\230\321v\\P\320\341\261"
+	.ascii	"\353q\366\036\242=n\007\321\036\225\303[\236-\376e\207><=1\031"
+	.ascii	"\227'h\301\356:c23\267\336v\001\333\t\354L\005\371\234\313R\266"
+	.ascii	"\030\202\333*\021\3621\207`\330\036\263\t\352b{.\251\032\354"
+	.ascii	"\303\335]k\215\355\364\t\246M0]\202i\022L\217`Z\244\351\020L"
+	.ascii	"o\232\006\301\264\006\323\021\246\241\246\025\246S\323\0071\t"
+	.ascii	"\001CC\242d\307.\314\347ciD\237\017\001\272\251\310\317\n\226"
+	.ascii	"\257\342;+\276\207G\253R\362\261G?E{\004\351ul\242\246j4/0^a"
+	.ascii	"\304\005\033\026D\370\274X\233\344\373RH\330\205\r\200\032\365"
+	.ascii	"\335\315K~V\205\032e\240\\\266R%p\003\347\232\252:\272\231\355"
+	.ascii	"\3402\326\266\273\n\256\250\r5hN\340\300\362\363\026*\257\364"
+	.ascii	"\t\252\244\001\003\023\356\245Bq\245^\334\203U\212\305\235\270"
+	.ascii	"T8\324\210[\020T.\356\325j\271\270\221\267\207\2535'\035\201"
+	.ascii	"\351\213W\340n\006\222YN~6\351I\337\315\200\345\230\331]\033"
+	.ascii	"(\251I\223\247\273!\251\246%\325pt F\272)IE~D:\n\251H\005\374"
+	.ascii	"\340Y\265\b\351c\200\002! p\002\2312\332\003{\362\211M\327\321"
+	.ascii	"0\177\332\327\215\375\335\216V\35308\315\203E\321\257\274;~%"
+	.ascii	"$\210i\354F\346pit\261\25577Qt\344\300\217\207w\"\343N?\306W"
+	.ascii	"\315\235\267m\322\215Q \300\244\223}\262D\003DRL\327#\003"
+	.text
+	.section	.gnu.lto_millis64_real.86.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\304\001\035\020"
+	.string	"\306^kE\360\260(\035\260\363\200\3143\021\347]d\2353\222\206\366\220\336\363\f\367}\214\332c\021-\207\030;\310\271?c\346\343ST_-\026\370\031\222l\247\346\207b\033\f\325\225\243\321\n\317\345m\355\377\222O\366\2262\245U"
+	.string	"P"
+	.string	"Z"
+	.string	"\336o\247\3702\217j\236\"\345\036\312\267s\t\265\230\351\231\355\272\034x4\267=~\001\370&~\"\305*\002\274\0170\032N\f\01378v=\316\336?\264\307\355\036\332\243z\270\312S\305\277\354p'\347\213\275\254<A\013v\327\031{\201\271\365\266\r\330N`g*6\227\231l1\004\267O&\344c\376\320\340\223cVAWlo%\225\203}\270\273k\225\261\235>\301\264\t\246K0M\202\351\021L\2134\035\202\351M\323 \230\326`:\3024\324\264\302tj\372\036#:-1%\034\314\330m\371~\326'\356\204x <,X\376\212\343\240\370 \036\2552\311\307\036}\023\355\021\244\277\231\211\232\252\305\260\274\370\005\022\031h`\030\261\243\263\266\310\367\251\240\260\013#"
+	.string	"5\352;\032\226\374\254\n5\366\224\\\266R-P\243\346\232\2527\272\231\r\3412\326\266\273\n\256\250\016?1(j`\371y\313\007'\2574\t\252\301\003\006#\334KU\342J\275\270\b\253\024\213#q\235p\250\020\267$\250\\\334\253\325rq#o\017WeN\032\002S\026\243\300\335\r\"3\233\374l\322\223\276\223\001\323\341"
+	.string	"%5i\346t4$\325\264\244\232\215N\304H7%)\b\217HG!\025\351\200\0359+\027!=\f\220n\032\" p\202\2312\272\003\373\363\311L\327\3050\377\330\327\235\375\256\016\243\260j\035\006\253ytQ\264\225\363\216^\t\031\"\032\273\2219\\\032\266\330v\315M\024\0355\360\343\341\215\310\270\323\277\361us\347j\2334\306(\032`\322\311>Y\322"
+	.ascii	"\211\024\323e\310"
+	.text
+	.section	.gnu.lto_micros64.87.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`f\001\215\016"
+	.string	"\266[`C"
+	.string	"\221(\035\260\031\016\373\233\374\352d\020\007\250Pt\362aVc\367\254\336 \362m\3001\r\3508\303\376W\272\001\233Z\231\3247\242\365\237\301\n\352\227\364\207#\272\247\240S\2367Ak%\237l\222dJ\001L"
+	.string	"F"
+	.string	"K"
+	.ascii	"%5\253\035\257HN\256\303\306D\345\206+\263C\340\327M\363\253"
+	.ascii	"Y\270EII\005\272\022(\231J\214I\212Lf\267\265\363\200\314Os\200"
+	.ascii	"\314\357$L2\222j\263\214\255X"
+	.string	"Z\250\223\222Q\303 3\213\250\023\024\367n{\240m\202\0261FyN\300\003\r\230\323KmW\302\217h\215ef\366\252\266\330\217W\256\347a;\017\313\301\260\233\207\325\036V\363\260\331\303>\f\213a\330?,bX\003\340\260B\234x\320\312\344\360\232I\230\367\202\302+\037\021\337\00654\307k\367\n'\"\373\273\346\346T\234`8F](\264\245-\231_\366M\n\373\373W8\327\3579vs)N)\031~\0016R>\336\234\253v\341\027\244\332D1\200\320(\277\032\224\371\371\377\240cG\312\204\257j\330Z \301\027B#o\310\207\203\b\r l#\021\t\"\220\32162\001\004\264\205\210H\266\017\217\206*\210\210\266Q($\332:]\032\313\253>\3670\375\324\316?u\361i\003\210\027\231\030V\227\355\202\327\013\207\206L\223\001\316;\234+`iq.\317g\250fV\2446\227aT\216on.\037"
+	.ascii	"{\311'\323\264\0011\354\274\0269\007\r\033\3162\325\346\347\""
+	.ascii	"\254\fc.#\025\b\001\013\031\273\2255\004\302v\230\205F\024-b"
+	.ascii	"\030!\316\363b\\)\213 \0174\206\024>\027\333X\224\005\3205\247"
+	.ascii	"\017\001.j\005qM\233\204I\006"
+	.text
+	.section	.gnu.lto_millis64.88.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`f\001\235\016"
+	.string	"\266\333`C\360\222(\035B\265\367\310\367\035\027\" \365\r3\342+\223\006G\266\312\337\277\326\254=\243~{\200\367\266\036|\356/`\235\345AQX\364\367\033(\343\201\226\350-\0346\317Y:\354\266'\215l\222dJ\001M"
+	.string	"F"
+	.string	"K"
+	.string	")\365K=^\225\234\\\007\216\312\215\r\256\314\016\201_7\315\257v\341\027)-\025\350L\260d5\206\250\260~dv[;\017\310\3744\007\310\374^\302%c\251\366\213\261\225LMj\305d\3340\310\314bj\205\305\275\333\036h\233\240E\fN}N"
+	.string	"\204\007\032\324Mmg\302\273\264\30623\373\226\266X\220W\356\347a=\017\333\301\260\234\207\325\036v\363\260\331\303>\f\213a\330?,bX\003\350\354\020\201\342AM&\207\227\220\244y9Rx\345#\342\333:6\307k7\f7\"\373\373\346\346X\240f\230Fc(\264\325V\346\227\235\243\302\376~\030\316\365\177\216\335\234\n\024+\303/\200\207\312\307\233s\3250\034\243T\237(\206\020:\345W\2072?\377\037X@T'|U\303\326\002\n\006\027D'o\311\210\203\b\r l$\023\t#\022\322v2\201$\264\225\214P\266\021\221\212*\230\2146\222H4\332<]\032\313\267\200.r:\252\236\203\032c.D\017\0223AV\264\262]\360z\315h\310<\031\350\334\323\271\002\231\032\316\3659\016\027\031-T\234\333p\312\30797\027\037"
+	.ascii	"{\311'\323\264\0011\354\274\0269\007\r\033\3162\325\346\347\""
+	.ascii	"\254\fc.#\025\b\001\013\031\273\2255\004\302v\230\205F\024-b"
+	.ascii	"\030!\316\363b\\)\213 \0174\206\024>\027\333X\224\005\3205\247"
+	.ascii	"\017\001.j\005qM\233\204I\006"
+	.text
+	.section	.gnu.lto_micros.89.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\342\314.2pM\322\001\030\376?\317\213\034JX\33520\230A\243\0200\343\004\2655\202\214\032\222cf\002\322\232\210O\036\374\342\234\262A\364\273IK#{K\231R\276L\007\t\006\b\257\302(@K\365\032\026,\f\357\002\037\336$\231r\300\300WQ\024|Q\334k\247\251\244\321\215\257M\323\303I\321\344\307.m\210\210<v%\270\330\350e\307+\025\303~[\355\330N\267L\337\rX\334\304\263+\361A\331\022\027\262a;cG>\307;2\266Z\324\310 \020\n\316\307\311n|\322\003\240\273v"
+	.string	"\350N3n=-\377\036o#\"$Xv=+\005\273\353\304\262\211[o[\300\366d\273\"\t"
+	.ascii	"{\311'\323\342\2533\216\206\360\\\303\217#\\\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_millis.90.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\342\314.2pM\322\001\030\376?s(\202\022V\267\fv\200\021/C\344\234\240\266F\220QCr\314L@Z\023\361\311\203_\234S6\210~7Y\"\331[\312\224\002\256H\b\n\007\t\217\262,@\n\365\034\030(\r\257\002!\236\024yz\260\300GM\023|P\334\353\246i\204\321\214\257M\263\2439\301df\227v\204D\376\272\026\\d\324\262\243\225\212a\277\255nl\247[\246\357\b8'\351\354Nd&;\342@4l_l\310\3378\307\305U\213\034\354\371\260\320x\224\354\306\027]\340\271k\017x\3564\343\325\263\362\337\361&\022\222]\230\365\0040\330]\347\205Q\334z\333\003\266%\333\025\001\t"
+	.ascii	"{\311'\323\342\2533\216\206\360\\\303\217#\\\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_microsleep.91.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\266\001\275\020"
+	.string	"F\240qF\340\360&\035\302J\247\220\306\354\\\323kt\007\021\237]\234{^\212M\036'\200\031f=\302\225c>\230\177\246\177\253\256"
+	.string	"7i\366\0133\017\342\201S`\207\370B\003\302\213#\342dF<\355I\230?\333{K\231R\\"
+	.string	"W"
+	.string	"`"
+	.string	"[+\340\316\343p\344\001\342\341\273H<\264\313\246\361\032\316\236(GF\350\306\356v\352\301\232\256\303\3704]~j\300\335\224\206d\257\303\220\0215\2171\371\236\332N\340R2\230w\340\247\304\007\224\354%\365\267\017\340\301\301\224\206d5\317\216\004\273\353\214\3112\334\035\267m\301v\211}\247v\355\225J\263_\022\343(\307:\263\017\364\203\300t\214i\b\323\357\245U\323\251\351\247\034\300\230\261A\361"
+	.string	"\267;\363\344\264Hp\205\210\333~\373\277\031e\327\036\344\272\255\345\033C\363A\244\243\223\333\245!ph\003\036\207\337\220\247}\237\377\270\016t\301\037\2737=*6M;0}]\223f\330\206\236\322L\362\247\331s\223\361\2228\234\312\233\370M\345\021\263QR\362\261\247\251\r/\220`\364\225owW\225\246\266\204\337TR(\306\224\252z\231\034\035K\367Q\274\246>\206\004,\237\f\242W\b.j\310\344\370J\264W\277\255\350\322\356\226\b\b\261c\343c\303%\237\002,\255<Q\261Tx>!Y\320@\001\203\256\245Ba\231\264\272\t)&*\335\t\213\245#\031\361\212\202\212\325\265V+V\207\252\355uf\310\223k\312\271(\314-o\367\006A\316\246\003\225\346_St\230\265\210:\363\273\215bT\221 \246$\277\250e#\020\276Y\304\303\250\260\b\003\007"
+	.string	"iG0\211\217AE\341\004\037"
+	.ascii	"{\311\027\323\360R=\340\273\266va\f\013k\n\346\241\220\202\213"
+	.ascii	"S\003f!\t\026\343lu\031D\272a\327\210\b\263a\023a\210K\030\267"
+	.ascii	"\212A\317\313E\253E4H\351\251pp/\234\242\022\334\033\267?\020"
+	.ascii	"D\204A\007\315^\355|\002"
+	.text
+	.section	.gnu.lto_delayMicroseconds.92.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"\035\t"
+	.string	"VR@90\345(\035\200\013\267<-y\210J\330f\203\003\312\264\364\260@\374X\2066@\360\254\366\343\022\320\226K\316\370\273\216\203\313-\220RU\273\276!\201+\374\203\326\222M\244L)."
+	.string	"/"
+	.string	"/"
+	.string	"\027\310\016\261\007d\207\356\354\227\177\032{\223\216\t\022"
+	.string	"\273\0335\343\335\263\363\037r\315S\231\236\031\203\335uz\252\212[o{\300v\201}\007\272\262\317\372\241\246\261Lk\2463\323\327\020x\274\305e\227\342\025`]\020\205cc\373i\377\343 \335Y\021\326v/JZ\273\037\307Qs\270\005\252\230rR,\251W\325\247TP\027\371\210O\374\rC\270\225\367\016}\267\262\303T\315\002\352\325\263\222\222\2029\345\313\376L\251\030\366\261\335]\007\243R\032\324AP8H\210\244\320\002\367!E\007\206OC\004q\243\330\331,z\bq\221$\022qq\363\355ueO\214\353\244(g\022S{T\312{\336$\324\344\f"
+	.string	"{\311'c\361\214g"
+	.ascii	"\027\017\004J\252p`\206U`\300%\004b5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_delayMicroseconds_real.93.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\035\007"
+	.string	"\362\r24Po\322\001 Z\216\224`\001'<\345\324}\313\202"
+	.string	"\035\2636\212\326GD\022ce\022\021RF\353\035\227\007A\3150zhT4\025U\027\373d\357-S\n\237\211lg\243\300\220\260\020-\217C\305\261b\304\003\007\"v\252O\334hJIx\252hQT\0253\332\375\356Bm(m\027\016\243/\323\265\024\025\351\254\251\362\262e8\254\325\260t\036\255\337\377\327\205Z\217\354|\005$\257\244\374\033%\227o\020E$\323\326\331z\304\242\313#\213b\376\016\223\223_3h\f0\324x`2|\026\230\f{\265,\326@\356\022\221\006I\313\377\350>|9\257\332$c2\020\346\004@\370\337\314@\034\256s[\202\266\007mC\002\t"
+	.string	"{\311'c\032\366\f\217\263\256`\336%"
+	.ascii	"b5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_delay.94.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\020\001\025\r"
+	.string	"\346\330YC"
+	.string	"\2216\035\273\266\016\022\031Z\253\036\2048Dwa\267U\213\266\341C]5\204!\031\204[\342~<Z\233\322d`\022\347+bD\004Ao\311WP\201=h \033\200\357\f\036q~\332H\333[\312\224\002E"
+	.string	"F"
+	.string	"D"
+	.string	"\367Z\3660.@/7v\367R\021\206\251=BM\315O\322\211\353<\217\260\372\244\220\350\350>\020\304T\212\271\350\231\241\333\022\236P\271^t\210\2024\203\353T\236U\202\335ur\335\206\233\272\355\b\266\021\330\037\t\020b\354\246\234p\354\027cJ<\364\333\277\310\032\333;\013\355!\f_\024\r\026\b\346Ei\327+\360\350\003\231G{\231\247}\025_\241\335\245\304\326n\210\0212v=\003\2762\217\036\037@=\302\013\240\036\255\3315\002\036\276\r\356\356B++\032/\241lN\205<\347"
+	.string	"\243\017\337\211\266\030}:5\225\266\205\013y\256R\002\0358|\233zl\317\223\312b\037\244\305T\262\256\330w\371\255\207\356J\323\252\351\324\3645"
+	.string	"l\340H\021\031\266\311:\261C\222\016\371`\340`A\203+\023\221\200m\262k\302\310\206\344\n\301:\327\207\2079\024D\260+\343p\260K\343\355u\305\017@|&\272EeQ\005\244\2234\331RU\b\003\224\303$O\256\364\232\252/(&\266<];F\001\026"
+	.string	"{\311'\323\260\316&9\253H\236\016n"
+	.ascii	"&\263o\t\333\200,\222j\254(/\211Z\255[\002\321p\245\247\314A"
+	.ascii	"\273p\352\225@\\\334R\245j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_timeval_sub.95.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\263\003\205\030"
+	.string	"v\355\233G\260\326M:\025\2348\250\302\367\337p\200\231\347\371@\303\251\3071\324\325\204'f\206}/\021G\016\0137~\373\177\216\006\332\205\237\017\366?\351\201\361\3349_A\233=~\367QF\201%\017\375\360\215\2324BH\222)\005\211"
+	.string	"u"
+	.string	"\212"
+	.string	"\205E\335\314r\262\230[\302bj`\250\2330\310(\234\242\312j\022\343\316\200\277.\bk"
+	.string	"\005\220\305\334S\t\0054\250$p\266v\362\214\233w@\206\2111iJG\214\273\003\245\205\376\272\013\333\326M\216qk\255\274\335\211#/\005\031\262\021%\306H\233\231\006\364\347Y\006\364w\023\276\331{\336j\027\003\357*\253\b\321Q\220=$?v\224\363f1FK9\213\216p\231.\0061\306&\321\321\b\367s\333\007m'\264^,Ay\245\326^|R\353em\274\263\005\230\312\255q\r;\200i\330"
+	.string	"\f\345\3228\312\235\001\2632\231\215\311,Lfe\231}\311l,\263.\231m\311,,\263,\231}}\331\320\313\272\236\005\237\3752\353e\366\231\315\314\232\200W@yJq\201I\214\"\256T\211B>\036+LeC\331Q~\353\326SuUaT\265\272\261\204\244I\214\021B\350[}\303R\001\3261\315\274\345\037\221\241-\226\277\016\273gC\307\204\373\261\303\362\002\033\334c\207\302\353\226r\001\255*/<\327\303\273V`\315]\267\021V\226\216\005\370\232[\311\320\226\220\177\300\357\340\255#\341\375\273+\310\320\326\257\222 E\327\300\337\373\247\245\203\201\313+\365\363\277\253\374\031a\371\3201\3412\306\030\364+5\357gx\272\312\345\224\035\022\362"
+	.string	"\216\264\203s\324\022\3248(|\bc\214V\001\004\372\363\257\364D\212\223P^iw\0019:=<\236\353\307f\303\311\301\320\303\023\3768\204}8\200\350\321\261\201\315A\020\301\202\203\n4\037\035\r6\034\037\032\317\006\234\016\264\034[\017\r\301\2545\017:6\232O\255f\243\301v\321O\252\214\026\017_(\232\266\322CL\363\"W\371\245$\003\007\212\246%Y\337\2003/jk\363\231\320q\225\271\315\035s\230\313<\265\206\\\b\211\371"
+	.string	",\230\337j\353\205\223\354W5%DN^\036\273\214\346/\377\254\304n\244\254\034.\007\262\363\340\203\213\021\"DNZ\016\273\313\003E\250Q,\346\0302\206\261\022Q\234\2024\215\001\220\242\221+\363\021\240\235T\314D\nKm\354{\356/A\210\032\3101_\337\227Jb\206\221M\263\237\234\321\3254\003\232\274\364\234\222]\371\007\374\206c@\0237+,\246:)\303\322j\226+\217\313/HNO\\\346\245N\274\031\035\177\002(J\300\236\373%\207\241F\210\220R\367n\005I\215I\342l\325}\334\032\255\375\243&\233\331\347Eg\341\370%\261S6\"?o"
+	.string	"\021\230\306v\363^\277\233\254"
+	.ascii	"Zg\223JE\333KZ\267%\370\017"
+	.text
+	.section	.gnu.lto_pwmSimCompleteMotorUpdate.96.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\256\001\265\r"
+	.string	"\206WUA"
+	.string	"U\224\016\350\030^\353\227M\257\213i'_\004\200g\f\204K\217\364\254\316\330v\002\354)\257\355[\315$\316\006K\025\353Gf\242>q\207\037H\3758f\355\374\331d\323\201!\323\353\266\267\224)\005A"
+	.string	"="
+	.string	"G"
+	.string	"<T\330>\306'\273\310=\024\373\034\035X(Gv\027\323\023?\035j\236\374"
+	.ascii	"\035\352\360\022\342\n\025\264J\220\020\350TP\003\304\305\372"
+	.ascii	"\311\323C\267\312\004\360\331]'\327\201\270\343m;\260\355\261"
+	.ascii	"sA\217\326P\212~\311\362\250A8#\251|9\346\346\366\006\016y\356"
+	.ascii	"\372\223\277\304'\302\265R\224\355\241RM\354\303\325\226\235"
+	.ascii	"\351\3704|Z\237\316\247o \001\013!\026~\354~x%YW\f=\256\002\n"
+	.ascii	"ey.\263<\332\242Q\236\213*\340[\001\265\306w\350H\351\034j\346"
+	.ascii	"+\321\316q\334\260\221\267\212E5\363\221H\316g\240\310\340\244"
+	.ascii	"f\276\021\327\303p\n\202\006\366\205{\244\001Cv\227\201\213\277"
+	.ascii	"\320\374\024\001\016y Hx\020\0013e\242\rd\3020\214@$,\264\225"
+	.ascii	"0\217\306Z\206l\303L\232\266a\030o\257-\177R\252\202\007\322"
+	.ascii	"\236@!\317Y\277b\342EC\325d\363\250\025b\020Y\345\212\013\344"
+	.ascii	"[\334Gv\331M\235\363\003) \300\002\031\"\333\001\373\362IZ\254"
+	.ascii	"\032b{)7{\201\233\347\254\343b#\\\316F3\351Xq\037&l\r\334y\260"
+	.ascii	"H\320\270\267\210\301\314]\007S\301Y\324\\K\245\231\325\301\211"
+	.ascii	"\216\213rq~\257Io9,\220\246}\366--\315\305\026o\"\327\t\372k"
+	.ascii	"\b\351t\355M\323\300*\024"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.98.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"m\f"
+	.string	"6\026UD\360\2606\035:\tt\315P^\223\251\f\2731f\345\\\035E\341\023\263;\002-5\b\205B\320x\324L4\374\333=\220\331\273hk\320}\204|\311x\332{\003=5\362\274\353\315l^\376\331\342\277\033\2212\245A"
+	.string	";"
+	.string	"D"
+	.string	"\2571\201\202\221\263\273QK\334t\253\3224\371\237\257\273\345qy\245!d\234f\304\370\\\256\025\001\324\016\024\001>\226\252@Ngs\025O\016\337)\2633\332]\247\367\201\270\257\333~`\333\201\375\003\001*~\312\033R\362\336-?\345\272u=!\023\363B3b%C\033\354RI\330\3270\fC+\214\375t>\375N\342\2003\307Q\263\353!\324\2617\226M\n\333\007\331d\343\034\214\331\026\200\264GHT\273\323`q\303F\345\221\251\330\005\\\b\376\231\277\330~\363\222\332m\271\207\301\323\022\r\334\262Q2\344=c(\355ZhH\035 \223J\021`\207\017j\225\353J\301E\r\226\314a\237\346+\002\376dYH\003,A\b\253\360Q\262q'\232\206I !m\027LB&,"
+	.string	"Q\220}D\b\231$\312 0"
+	.string	"\211%\315\002'R\212&#\"%\221\304\241D\021\346\355D\343bi\333\270\b\002\367\n\343\321\212\236^\355\356\006\026"
+	.ascii	"{\3117\323b\2353pW\200\025\240\272t\265\006H\331\026\256\200"
+	.ascii	"&@\\\257\206\006+$\342\222\215xJ&|\273\214\3622\304\270t7\233"
+	.ascii	"\226\n\211\242VA\001"
+	.text
+	.section	.gnu.lto_FLASH_Lock.99.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\223\001\355\017"
+	.string	"\226\334iH\340\262(\035\260\234\336\240)\203\r\301\007\364G\344ck\264\021\353!\242\004#!(\251\277\243N\231n~\305\377\0338\347\372\275\250\207F0f\t\341{\267\323_K>\254\303`\232N\034u\220(\020K\r\313\310&R\246\024T"
+	.string	"P"
+	.string	"V"
+	.string	"\007Rd\316\021CB\223\207\354ia\373#\303l\037\307\321\314\327"
+	.string	"\202\2111d\316\t.\213\303.\275U\230\377\234\007\030k\261KQ\314\275\221Z\314\3273`\313\351\b\324f\236\003\335\r\212\347\\E\324^T\001@\230sZ\307Z\211\373\273m\013\266K\354\367\b82)>mp\337:\276\257\335\341\203~t\270\203g\027D\333\230\352nl7\326.\337\027e\007h\246D\354\353\374\205\213_c\020-\372\361\322o\371.\277\f\\\330\310\350\234\220\351\220\215\213\351\252\260\357\315\235\261\257\366\256\336\253/@\177\374\334\002?\027D4\222\322\345o\357\301@\373\230AD\003K&'>$vA!6\346\303\270\r\271B\b'H\001\365\326N\251f\2715!d7@wu\316;\307\367\247|\277\235\006\353"
+	.string	"\315\234\262\217\276\214\317X\3715\227Va\261\276K[\344\240\037M\202\331\330\316\356\203^Y\241\230Xb\213%\fG\036)\271\026\224H\033B\017)\027\351DE%\2364L@E8I0I`\225\351TB\202\002_aJ+\365\002WV)\026\250j\271@\023\311\"K\330\002_\242\330\002G\270\371\235\261\364\341\331\005\311\366E*P\233B\205\275-\247\263\361\020\350o\307\2012\005# p\202\231\262\344\001\373\363\311,\356\235A\302\261i/\270\013g]v\305!rl\227"
+	.ascii	"f\\B\303\306\332\2712\007~p\213k\202;CP\031#\001\027EO\202[\221"
+	.ascii	"\235\313\340m(\220(D\260\037\2401\334\352\204\377\217;I\267\266"
+	.ascii	"\323\214\244F\013\241"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.100.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\322\21525Po\322\001 \346\253\361\\h4s\370"
+	.string	"\277\306\n\032\240\032\244\356\036\332\"\270\207d\031l\260@ZV\313Mh(e\007I\341&\230\265[\2445\262\367\336)\005\327U\311N\347\240\241\362P\n\032s6\t\f\b\013\212U\036Ia\n\341@=(G^\272\231lETR1\313\222\232\231{\033^\223\246\211Ga\317\217{\032\366\341\276\220\355\324\342+,\273\027\243\226U\211'\035\2663;c\3339\373!\027\311>%\016\260\033J1\331\235\004V\314\243'\306\266\377q\220\314\032\234\034\333\245dTA\"\332\235:]@z\204\017\220\036\337\306\265;\315\377\310\241\207\b\005\264}\356.\006\273k\007\3320\356w\333\003\266\013lg\004\n"
+	.ascii	"{\311'\323\"\030\366\250\240\\\303O,Z\007&\036\3345R\255\230"
+	.ascii	"\204I\006"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.101.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\265\001\005\021"
+	.string	"\306\240tF\340\324$\035\2507\216\230\003w\216\330\343~\013\275\307\267\303RA\006\241\241\342=>^\270\202\177L\203b\323\230\004\177\213s\\\2174U\204O\216o\032)\304*]\321F\026 lF\021\024\374\347\266-\356\275\267L)^"
+	.string	"Y"
+	.string	"`"
+	.string	"\322\037\312\266\357\342/t\354\212\037\221g\222\003\304\317Q\323\356\247\245\2562/\343\t\314Kx\342\256O\031\241\272\374\313\036Y8\021\211y\257\317\023/\350\022\025\364\230\342\301P\274\036\205Q\005(E,\305\203E\005Et \271\354\372\301\343Q5y\260\273\326\230'\3426\271m\032\3331\366\203\004\336\300\322\307.}\326\274<t\320\224\344\347iGg\366\367R8d\037\316f\263\231\241\220\375\242\037\365\357\237R-\243Z\243\372'\362\210\222\201\243]\240\331\222]\222;T\330\326\261QlC}Q\007\003\3305\341\304@\325>\214\307\320\371\347\341\002v\205z \355~\013\254\241\036\t.\355M&\005\203/O(a\213S\222a\b!O@d"
+	.string	"E\301\t\355U\215>f\t_\266\221\021/\022Q\241\016\221)\335\310p#\"\032\267as\034L\273\333\340\262\206\356\336>\346\245\302\311\343\232\004\003Z\001\341\220'<\304 \373\321\243J\354\317`\035`\332\335y\314?\272\f\316Gq\031>A\240Z\335l]\212\206K\265r\270\024\316\n\314L\307Y\260\331\272\025\327Q\210\221\360\002\301%\302\205\025U\216\206\215\203\354ff\266h\031\026\227\n\023^\264\226j\325m-\355\246f\263\321d:\226\306\2222\207\243\352\264\026\307u\032\312\267\217\013\205\342]3\245D\213\245\035\310\023ww\347"
+	.ascii	"\225\360FG\202)@\264\353\363X\f\312\247%  \240\002\0312\365\273"
+	.ascii	"\363\3112\315\036\303\201\314\327\312\003e\310\203:\001+\bwx"
+	.ascii	"\301Q\032\212\317\2078\213\230}\026\013!?a\016\213\350|\330i"
+	.ascii	"\317\006\023dB\226\215\020\030\376\273\202\240AR\322\317\325"
+	.ascii	"\265\206\264\334\250\266\006\n"
+	.text
+	.section	.gnu.lto_pwmSimCompleteMotorUpdate.part.0.154.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\205\b"
+	.string	"\242O77Po\322\001 Z\036\263\005Z\222\343Y\377^i\003\006\266\352\365\374=\202`k(\217\360A,$\224x\306ll\201"
+	.string	"\330\254\021\216\240\223:UG\222X\262\267\334)\005\346d\b\n\007\t\263\353,p\233n60l<\223\303}fF`\315\241\303\315N\323\270\211\331\206W\2225\"\225\260>\356\356\252\226l_\020\340V\251~\272\3116\300R\362\224G\333\266\352\362\247\223x\326\256\b\365\221\217\377q\351\007\017~t\351{\325\245\r\021\001?\362M\277RBV&4\004\265d\215\217\253$[\005\n6v-b^\226C\242\200\3307\201l\f\273\274\210m\320\205?\273\345(\217\375I\005E\312ew\347\245v\374\273\302\370\371\241\353\205\221q\030\360\230\321\354\256-\215[\336\266\201\355\3146L\024"
+	.string	"\177\311\017\347\214\340\356\003\231\200\201\035\225?C\331\002\310\003#\\1\030L\004\234\021\213:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.part.0.155.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\223\006\355%"
+	.string	"\232B\220\016Gp\236Q:\343\335\027\211\370\236T\253\251\275D\b\255\n\035\251IG#\244\"\004\373\t\3246\275\374\230\035\251X\365Z\032\276\207>q\007\225Gb\367\314\302pg_}q\374\003\004\260\314\301\221\211\377%\237\020\"w\222\001\321"
+	.string	"\303"
+	.string	"\337"
+	.string	"J>\366#o\231\317\267\362#?\313\311\0307&&\006\340\n\275\200-\231\220\376DN\035\213\224E\020vs\\\205\375\312z,R\346\315\n\2739J\310A\003C\2737\214\350'\357\322\237\034\366\002\350\317\364\003\320\033\3177N1\343p?_\205\231\247\256xe\246\3630\257{/G\210bh\367\336\335\3176\362\3657[ZCO\263-n\345\337\260\202\277\t\331L5\251$\236\315\225\226\331\240H\220\2647\271\352a\323\2470`Sjl\256\262n$Z\264fdR\231\243\004K;kF\306\013\021\311\241u3\207ee\252\367\336\223\tm\233\315\025%\207547\354A\243\345\306[\032XU\326\n8\256ft\357\345S\3718\377\234\231\2550?"
+	.ascii	"\363\031%\335f[1b\237\003\32663\322\t\373b\267*\354 \223\261"
+	.ascii	"}\341\311\331\2261\213\200\265g2(\237\321\240of\024)\354\213"
+	.ascii	"|\262\247ff\226\244\235\r;\310\375^\232\265!\353\356b\346\030"
+	.ascii	"\350\033\301\0237\3108B\253\207\337\374/\007\023\203\377\305"
+	.ascii	"*\222N~\022\372\363x\212v\250\354\222\203\354\217\357\262\304"
+	.ascii	"K\207\035t?\177\374\226\246\364\336\341\213\275thA\327\342\311"
+	.ascii	"\276\370\276\361\266!fn\332\231U\007mwq\343\336\313\345r\311"
+	.ascii	"]\204\271-\007\245\226s5\313@\250\345\237\3232\256-\337\332\262"
+	.ascii	"\255-\247G\236km\031m\313\347\307\316\246i\271\333\262m\313\027"
+	.ascii	"\222\360&h\353^\034\313=W\310)&+\2205\210}\021\327\n\244(\211"
+	.ascii	"Z5R(h\2166\270\\\207p\245\303k\321\375\274\355\2715\003(m\266"
+	.ascii	"\214_\2650\267\365\317\326z\370\240],\217\255\027$\231(\255:"
+	.ascii	"\370\343\3574ixSg\355\"\340e$\035\336\307\215\177\215d\020\345"
+	.ascii	"0\201\017)hw\311q\362\243\3546\021&\262/;\235\246\217\315Y\221"
+	.ascii	"\374l\353+I:|\241c^\225\254L\340\254N\322\3562f\347\220=\233"
+	.ascii	"\233\375\262\273i:\231\327\313n\266F1\340\265NI\207\037tk\225"
+	.ascii	"\325\230K\352P\022\277\264c\207\313\354.\256\265\331\013\240"
+	.ascii	"p!\341\250\026m{\3579\211\376R\350\313\256<b\340u/U\232\253\341"
+	.ascii	"\300\377\372\311\035\216\216\320\017!\354\213\265V\211I\264\317"
+	.ascii	"15\t\354\331\314#H\2349\273w\244I\313\n|\213\032R1\360\200\275"
+	.ascii	"\037\f!\276=`\"\030\3157\240\022\357\267\004\201o>\240\312\304"
+	.ascii	"s\352)\261p\300\267\235\312\3444\244fPy2zQj\004]\324\220Ne\342"
+	.ascii	"1)\371\234T\025-\226|NP'\222@ q\020\341!E\021\023\375\232\241"
+	.ascii	"z+\212\236|?\027<\036\216'\243\207\344tB\235\227\212D\230\b\201"
+	.ascii	"\264\003\362\232~J\300\035TO\351i\267\364\213\332\025\251\354"
+	.ascii	"s\301\373\355\200>\337o\207cf{\363v\0216\242\352*\356\233\227"
+	.ascii	"\310\346\372G{c\245a#\035\376L\3673\310\322\bj[\326\005\013\204"
+	.ascii	"\265\352\260/\346Z\025\332\031,\230\314y\f\372\023\250sH3.Z\025"
+	.ascii	",\363\312c\355\201\276\370\323?u\222g\322\316\252~\334\034mk"
+	.ascii	"\216\353\0372\016\005k\353\257\271\265:J\255\220\003~\250\201"
+	.ascii	"(\306\220C\b\325\004\"\"I\222\244\003`\002\031\262*\333\021\200"
+	.ascii	"1T$#\263@\225\264\006P\227\nFS\330\013\261\260#n\022\f$4\217"
+	.ascii	"\266\300\203\227\304LD\247\322\203\2470\354\027\303\330\302\345"
+	.ascii	"\005Z\232j\312\t Y\373~\201\265\276\213x\023\262\372Y\205\361"
+	.ascii	"\233\302\357\245\215\036\032'M\342\221\026H24\2372bS\375&\362"
+	.ascii	"\032R\202#0[\304\316\323Y\313|\203\244Tl \031u+ \211\f\003\357"
+	.ascii	"\225\205\212L\337|\255\250\352\240b.\027\020\030A\267\254\331"
+	.ascii	"\321\363\321\201<)[\006g>\377\t\251\363P\202\016\310By\211<@"
+	.ascii	"p.P\n\347\017%\366V\333\321#\016\277\205\3335\f\203\256\367}"
+	.ascii	"\031I\365\261\215\305\201\262\324c\200\017\200N\313\247\331W"
+	.ascii	"\377\253\006\327\355\217\306sz\376\025#\217\016\326\021:\013"
+	.ascii	"\213\177\366xN\026\321\372\270!\255\341u&\333\320\r\327\026\211"
+	.ascii	"\346\017+v\271\034\236\232\263l\031\370L\333-B\340\3433/\244"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_FLASH_Lock.part.0.156.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"\025\n"
+	.string	"\266RE;0\345\2521\300s\373\t\002y\f\031!\030\242\247 \001h\006\224!N\346\214\301\331\252\253\003\354n\372\272\331\006\367\036\332\021\026$\334\262\312\032\022\255\334u\310P!a$rK\231R2"
+	.string	"3"
+	.string	"3"
+	.string	"+\016\263l\227\337D\356UX`)"
+	.string	"\356\275\365t\206\234\365);\226\177\3335c\254\365\271\211u\\\022\274\023h\270\367:\343q\323\333f\260\r\262\375\022\257\031C%?\236\372*\314\351\247\001I\213\314\366\341\22299i\236\335\273;g\266\224~\2470`@v\357FN\300\005\241+#\366m+\233\3039}\211\355\225c[\276\273s\346P"
+	.string	"\234kj\314I\263\255\221\237\007/\300,\374&G\261\307\311j\367\276>^d^5\341\324F\245\344G{\260\331\262\177\362[\206\003\336P\200\244\317Z\230R\236hM\036j\344\225lx\002AO\202\364Y\317\004\304\307\301\363\020B\360\327\361\200\">U\004+B\221XM#Q\251~!\252v<\333\023\030V\321\3320\021"
+	.string	"ze\271\033k\270]\352\013\344"
+	.ascii	"\362\300\bW\214\017\023\rg\360\242n\350\264e3o\247\005\340\332"
+	.ascii	"\213)\247\345\364k\313\030"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.part.0.157.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`3\001\005\016"
+	.string	"v\232_E\360\262&\035R\003\260Xd\214l';\214\343K>\301\217\024\331\367\035S\264\334\277\005(\364Vi\204 m\215\250=?\331\243\252\3530\323wkl\231\303\260\231\370\266\004\340U,\034\020]\204\243\222m{\313\235RG"
+	.string	"K"
+	.string	"K"
+	.string	"\327\2119\200\335\226\216\237\335\016\301\243%\366\350\356\004B\217\330\005\204\036\315\331=\336\355\212p\204\240\241\001\264\273RU\234\273>\310\3712\327\273\016_\004\371\254X$\376\002\034\212Pv\327X\211;\336\366\211m\n\366M\004/\037\233\"\346ha\3735\f\343\fD\207\303\252\331\355\016\330\206\001\331\037\033\024\362\321\276\213\263Gv\312\036\351{\017w\036\024\354\226\2452>#u\036\224Avm\202\024`\217\031\374\373\016w\235\030\003\335\216\250\361\237\375\234\307H\005>\277a\032\200\263\253\372j\303T\013J\036\355\r.\357+\213\354p\301C\2452V\365mx@\371,\374\227\320\343\310\212\023\327\247w\035\302"
+	.string	"z\321\374\230y\257\2477V\bww\255-\373=\277\306\347\367\235\377\242\002%9\273\"\002\016\351p\222\200$c\220\265\220X \315m\202I\233,\333\214p\341\201J\203\024\007\025FJ/\0314\016q\222H\032\364\212I\212\004\b*\362Tb\231\332Ij\300\240\231\344\312t\221&\231\267\226\322\224\247m\233rd\373\035\256\266\2142\243\037\254\2527\266C\236\006\032"
+	.ascii	"zeI]\326\360\266\357\300SA0\210\246]\200(\0306\227\253\303\250"
+	.ascii	"H\344f\030\033tS\n\323HN\301`X\b\277\b\244p\231\021&\347\274"
+	.ascii	"\303\235V\304\265l\224s4\205\276\253\340\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\021\013\335#"
+	.string	"&\370\305A`\252M\007\f\004\332\266\315\322\237z\230\016\301\230X\235\317E\376\375\262\007\370\203\244\"\n\233\023\230\313\206N\034R\212\005\272D\006\257\234\322=\306\317v\344\301z\3433\022\260/VZ\240\2255\311\224\002\264"
+	.string	"\260"
+	.string	"\257"
+	.ascii	"\267F\237\227\306\363\232\235\361\\\307\002-\b\271(\203\345\252"
+	.ascii	"\230\320\215\301\202`p\240\027\f\350\272x6k\361L\207\305\363"
+	.ascii	"\034\273\342Y\316\3052\244\252x\216\223\342Y\315\242xN;\361\f"
+	.ascii	"\3072s\233xFZ'+j\3168x>\263\f\330\370\200\325\037\263\221\342"
+	.ascii	"\343e\253\022\025\356\024\006\022\317o\354\210\347\262\005<f"
+	.ascii	"\207g\032\021\317d!\276\301,\210\357-\366C?\341\365\226\007\366"
+	.ascii	"\343\311d2\331\341[K\323\205\313\304n\022\234\303!\212\006\300"
+	.ascii	"y\236'\207o\242u\346F\317\r\334\3462sy\016\207\3050\346gFr5\025"
+	.ascii	"\230Gr\022\236\321,3\013\030\020\354>\f\354\304o*_\337N\262|"
+	.ascii	"\243^\317\203\260<\027\272\362l\310\312\363\241*\317I*\317\216"
+	.ascii	"\272\236\377p=#\232\362\274h\353Y\221\326s\242\254\347FR\236"
+	.ascii	"\341\242|cA\371\356\302\372\276z\362\315\345\344{\312\3253#\364"
+	.ascii	"[\253\311w\326\360[J[}G\351\363\033\312?\3071y~\264\344\031\222"
+	.ascii	"\222\347HI\236%!y\236\324\347y2#8\362<\327F\036"
+	.string	"\334\"\317oD\236\327!\317nB\236\333\202<\367\261@\236\371\374x\336\343\343YO\217\347<\026\330\306\026\206\3073\233\335\361\214\307\352x\276\223\243\233\340\350\341\215g;\326F[\005r\226\334\364\"\202\3417\246+\255\2144y^f\202\246+\241\273U\335\245G\323wd\310\350\3414\323u\253Nm^\226>A\323ugfj\030\216\351\345Z\252A\323K\264\254W\244\351\0354\275Q53\030\307,\016p\037\232\222\013\217;\327\300g\001\334\327\336\250\361z\253m\256\227\251z\275\\\333\223o\353\030\273\271\256Kukwrn\356\313.=^\337\251\315\323\022\306l\256+\251\335bL\264y\304,&\273n\252e\327\t\240f\327\t\250- N\214\307\256\373\032\300Y\264^\242A\366^)\2607\332>\266v\325U\201]h\201]\303\205\334k\373\326\333$7>R\361!\242\025\330\216\312Kc\367\027\032\334\230"
+	.string	"@/\323#\320{e\003z\247d@\027\266\205+\363\245\306F`\377Y3'w\247\254WQ\213\213\317\246\274l\353~\324%If\245\274L\245\274\327N\205><R^\025\345\031~Q\256"
+	.string	"*\3527\301\333\313O\202\227\250\031\227\375\356\374\240\"4\200"
+	.string	"\345\n\234\0320\360\"tz\036\304\370\324s\031i\235\236#@\327z^@\355\036$vF\214\355\3648.M\214\013\027{\236\341\251\367\344t<\340>>\362\fx\257\310&o\265\251\311{E\316a\n2y\253a\301%\257j\036\022\fQo\311M\220\261\214\003\200\305\250q\030\006\301%\"\244 I\2226\003\300\002\251!\332\346\021\260\030\263\f!\"\022\211H0$\332\003\221\374\347\307\343\035j@\357\020\021\344D\225t\347\205L\225\325D+s+\212\353'6\345\212\233L\331 ~\350\253\004T\0265\004\206\233gV\17725\031\013b(\243-\275\264\026\265 ,I\344\031E4a\242Q4\365$\n\215\277\027c\254\332\310\316'\322\375\240\204$p3\243I\264\006\251Uch\237\027_dN0\020\301\270C\204'\364\243=\217\0136HmH\224\314"
+	.ascii	"i\315\b\213\tq\222-\374\313\027\032M\357\316o@~\006\272B\311"
+	.ascii	"\324b\205\223+\311\177F\225?\240t\t\205o\021\363\265E\263i6\315"
+	.ascii	"\246\3314\233f\323l\232M\263i6\315\206*@St!\r4\375\273\373\367"
+	.ascii	"\243\377\257C\350{B\303\351\001\317\312\020\354\342\330{\216"
+	.ascii	"\202\305\335\334\345\030\005`\"\345\274\334\r\023\016LY\307\023"
+	.ascii	"\313\312['`\343R\373\f\303/wQj\230\bN\333\021\362v+\262Q\314"
+	.ascii	"Q\266\330$1\233K\2462gA\200\225\f\200#\317\020\021\036BOMP\311"
+	.ascii	"na\334\335\366\342\210\200\371\360\237 \232\246\f\036\022\367"
+	.ascii	"?\301\230\303\341\334\034u:\017\361\362Y\217z\310\340\205\006"
+	.ascii	"-\254\n"
+	.text
+	.section	.gnu.lto_.refs.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"\005\b"
+	.string	"\306\3248-p\305\311p\n\217\365\353\327\377\377\377\377\353\377\377\377\377#\200)C\355\315\020\273\3757\203\274G\324\324\335\335\255\221M\310&{\357-e\n)"
+	.string	"-"
+	.string	"."
+	.string	"\220\256\036\234\2166\030\235R\037\247\033\342\024\367\003O\237\270\2274\336p\377\236\036\265w\355Y\3736\262h\256N\325v\366\214\b\220\205\257\312\005\217#J\177\216w\216\t*\240f\323\253\310\227\fP/\276\312tJ:YO\223>M=\"\351\017\325\245\273\024\351N\352+\033\3764\374\301\374\332|5'0\204~"
+	.string	"H\037\300\305\205oQ\341WX\370\024\030\376\304\345\227\270<\304\301g\f\236a\371\267\372S=\252\360\257\236\316\247\017\3355\336\332\263\247\257\346\300V\356\331n\350\020\244\273\305\333\342k\361.2\260\213y\201K\035\3768\235/g\005\266\024\t"
+	.ascii	"o\021\305\234\234/L\r\240\204\3232P1Y\304n71\204\212\006\216"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.decls.d0cf5cd2f1384b43,"e",@progbits
+	.string	"(\265/\375`)a\365\237\001\032\305r\232U \016%\225t\274)\002T@"
+	.string	"T\004Q\005\021\025U\004\024\255flDp\"\024DQ\021\020"
+	.string	"\025Q\225 b]\316S\375b\2448+X\324\022\007\265\222\324\277\306\306\241\355\357\037f\237\232\2035.Z\033\017\243\177m\265\251\3750?\031\351\266\t!\233\310\235\002i\b\205\t\367\tZ\270\214\261j-\346.sN\033Ak)\357\3360_k\253\234\323r\316\033\340\025}f"
+	.ascii	"\301\370\366L%g2\352\366\364r\340\346\316\320\320\353/h\221\275"
+	.ascii	"\243\247\276G\273\274t\227\224\357*\252J\227\316\303aa\227\257"
+	.ascii	":\257\271\b\311l1c\244\357\321,\374\367\226\326\262\266\024\""
+	.ascii	"\243ogY\3320\005\321\232\352{\224\006\266}U\252|ai+}\327W\272"
+	.ascii	"\256\355\254Z\343\375M\245\351\220\224\215\327o\rG\345+\347\214"
+	.ascii	"\327soc\322\021\0277\367%\327nY\207\334W\0275^\267\265\033\b"
+	.ascii	"\245\247\234u\320\231bf{F\300P\026A\2264\341\334\237u\030+\245"
+	.ascii	"\340\237H\360\317\033\370\357)o\270\277\231:\312\r\2274\243\300"
+	.ascii	"\276-\245\347=E\002<p\024\351kZ\035\364g\023\356\334P\336n\177"
+	.ascii	"\2575\333\333l\254\314-\033iO\372Z1=o(\3271\331\244(\t\366\375"
+	.ascii	"\035\304viwP\236'\355\306bH\221\276\027\201I\233\005\340H\271"
+	.ascii	"\0010-\264V\263j\235\326N\336N}v\236e\316iiM\326Kl\235\3242G"
+	.ascii	"\325d\301e\211\301\323\201}"
+	.string	"\332\233\021\207^\233\355\016\372[\004w\023\247-&e\337_\037\370wG\227\335\006\311R\337\\\337_)\374\373\204\377VBe\212\220\261\242\276s\367\307\033\322\215%\2072Y\216\300\304:\211\023\275:\246\276m\244\217X5\016\215\344B\244e.\313y\231#\314\"\306\206Y\337_\025\370\226\003\232\303\001\375\273H\330Q\221\021\215\276\177\2075\330\215\214:A }\233\b\017\r\224\035\237\224\276\277F\270M\212\215\003\241\364$t\302:\302G\326\344o8H\0302\022\226YOG\375\rG\230\363U\227/@)\243\245>2\366\357\216\206\bK\201rs\266\312\235\021>&\026e\372~\313\304*i.[\346o\266\316,\003w3\376\236\321B\332\252\265:\253\207\264W_5\216\236j\254\336\321>\272G\003i\035]\325?\332Fo5\215\316\321_\315\243\273\232\252k\364\215\016b\325\232\313\272\275]\364\213\363,\231\232"
+	.ascii	"\371\254\030\013\246\271\354\030\006\230K6\274Df\243\223Z\251"
+	.ascii	"\217\224\326\314\262\375K\222@A\247V\256\020l\203b\337\216\220"
+	.ascii	"\340a\261[l\235\024\206\214D\266\365\005&\fO\223;*+g\305\336"
+	.ascii	"\201Pz\022\252\300\n\343\3139\367@\351Y3\353\304\256\221\211"
+	.ascii	"\361\331@k\2463\023Y\323\221\026\177_9/\213\220\372\b\204\322"
+	.ascii	"\223P\tk\005\227\337\342\375!\214\320\\6\317\362\231\313\257"
+	.ascii	"\224\311Q\025_\316\331\351\251\217p\2122\344\214c\357+\347\345"
+	.ascii	"E\370;\251\271ZE\037\005\340H\271\201\037f\370r^\336*\371-Ys"
+	.ascii	"5\214"
+	.string	"\226\302)Z\346\"\364\350\254J\220\277\234s\007<\035\234x\\\200n\022\270\177\313\260ev\tR\316y\003\034\271\254)N};F\317[\306uj\320\346\314x\365\325\031\3037K\273\203Z\270\"\370f\017|\323\n\337\214\302\030\314#\374\356\303\005\320\202\337r\030\204'\370\275\304_~\341[\265>\332\313\300\220\032]\372\276\261\360\331:\017b#\265(V\006\355\231\032\261#)\250\276o)\374n\201\337J\374:\253\203\2763\276\375\303~\317\241\313\321%\251\357-\037\276\305\303\347\203\303mu\320['\030C\227[\276?\204\021\354^\013y\203\027\220\216\006\373\332/V\357v\317zy\b#\334,R\222\217\344\234\355\336\007\253\234\215\354^\216`\316F9\326\032\300Z\003\334\"X^g\350\275-\303==\267]\256c\305\002\307\246\364\275-\202y\354\016\372\333-Z,\024 p[}\177\253v=\233\345\377m2"
+	.string	"n\312b\304 \353{\353\205o\267\260\315V\007\265u\366\212U;\025k\227s\3204\264\"H}o\253p\f\362\240=\025\364V\006\376m\025\272\0342V\260,\351,\225\024\217Om\251\357-\023\2765\302\366\311\352\240\277\215\2033\227X\304\320\002g\247\340\254Q\275I\351\373\025\277\210\177\373\026\245&\215*\313R\337\377V\315F\261n\313\314\223\303U'\007\326\367-\340\203"
+	.string	"[+\253\203>\003\330\236Y4\253\3669\373\344\350\223\3242\007\007\212\n's}?\001|\233v"
+	.string	"\\\345\021\276\203o?\207\306\300~\016=\016\266_V\007=\306\327\352\240\326\312\356\240\031X\035\324.\255\016Z"
+	.string	"\273\203\032\261G\254\230\251l\262\312f9/3\244F\244`\231\365\265bm\223\330\345\255\230E\362\020F\270\rR>\222\363\322\212\335\234\215\2545"
+	.string	"\216\265\0068\337z\030\221\241\367\215\277\264;(\266:h\f:\006EI5.\\06~\223\352\277+0\235n\361\2320\223\376[\302T\372/\320\337\253\372[&\307\373\363\233@\277Y\342\277>\277I\342\2220I\360_\342o\207\230%\370o\013\277\355\377#L"
+	.string	"\242\217\021\370\257\225\025\334)\303\337Ri\244\253\202\377\246\340\267b\017\262&\024\351\374\247\371[\0241\370o\376g\334\337\305K\001\024\334\023\374\335\302\007L\360\233N\313[\202K\202\337T\301\035\301\001\360\337\275c\326\177E\360\333\270\033\002\013\3427\377\245\373\273x)\200\202M\376\226\005\367"
+	.string	"#\376\217\350\025\274=\311\b\233\302m\376\263M\215D\335\2305\341\347\177\"\371;\356\262\360\367\330W\240\022\366_\020\334\017\374w"
+	.string	"\277Ma\205\2170\2015\341\032\376S\210\232\224\036\177g\335\017Q\216\376\347\326\232Z\215\277\307r|\005\263%5\377\311D\246B\353\003\177o\340'\310q\234\377LA\205\277\207\037\201\245\001\017\374m\002*\023n\377s\204\247\377\331S\002\013\337\340??0\003\377\026qSx\222^\341&\270\006\377\251\200\337\0043\303\376+\342o\004\334\016\374\315\201\003\377\335\200\351\002\270\377\242\360\367\207\270\377f\300lK\200\006\023\355\236\360w\t\030\270\0270\361\376\256"
+	.string	"\226\377Z\340\267&\330\t\214\370\004\376S"
+	.string	"\246\0063\203\r~\223\203\377V\340\357\342\245\3003\370/\013~3\347o\017\356\004\376\006\352\256k\302o\222i\016\\\tt\007~\377\215@\320y\376\253\201\253\200\233"
+	.string	"+\202\003\367\374/\372_\b\374\226\304\177K\370/\006\020\177\033\031\376w\203\007\374\035\326\302\177I\260\304;\302\337Y\367\303o\356\3756\205+\302\177\006\374\027\204\377'\270\007n\202\377+"
+	.ascii	"\331r=\334\006\2248\n\3779\374\315\004\374\326\353r\370-\217"
+	.ascii	"\313\200\273\200\323\374\347\206\337\364\372\033_\005\334\004"
+	.ascii	"(\377\343\377\314\360\233 \370/\002\376K\200\377\362\3747\303"
+	.ascii	"\177\321\337\034\374M\301\337\364\373M\276\337\304\362\233q\277"
+	.ascii	"\t\3457\307~3\3547\277~3\307oR\375\246\324o\266\370M\245\337"
+	.ascii	"t\301o\016\375f\211\337\364\371\315\341o\226\3407\025\360\233"
+	.ascii	"\001\370M\016~\223\34773\370M\r\277\211\3417\205\177\027\375"
+	.ascii	"\355\345o\027\3766\376\275\202\277\267\374]\367w\225\277\251"
+	.ascii	"\374-\367\267\224\277\243\374\335\366\367\332\337j\177\243\375"
+	.ascii	"m\366\367\222\277\311\376\036\373;\311"
+	.ascii	"\337F\376\016\373\233\310\337@\376\366\372[\353\357\034\177c"
+	.ascii	"\375M\3657\215\277\245\376\216\361w\324\337O\177;\375\335\364"
+	.ascii	"\267\362\357\244\277_\370{\375\033\371\367\361\357\023\177\003"
+	.ascii	"\375\367\300o\275~k\374\355\n\376\257\360\367\317o\201\376&\361"
+	.ascii	"\333\016\374\255\341\267 \376'\371\273\205\277\207\377G\374m"
+	.ascii	"\202\277E\3607\013\177\257\360\267\210\277;\360\367\006\376F"
+	.ascii	"\341\357\023\376\256\300\337%\374\r\342o\022\376\376\3607\b\177"
+	.ascii	"{\360w\007\177s\370;\001\177#\340o\001\374\255\363w\316\3376"
+	.ascii	"\177\013\177\033\203\337R\371m\334o\337~\313\366[\264\3372\371"
+	.ascii	"\377\344\267c\277\035\362[!\277\375\372-\327o\363oS\374\266\005"
+	.ascii	"\377\203~k\302oQ\374\366\204\337j\340\267\353\377\024~{\374\355"
+	.ascii	"\211\337\226\370\257\302oS\370\255\005~[\201\337R\340\267\023"
+	.ascii	"\370\317\302oK\370\277\374_\343\377\334\377\003\f\016\016\016"
+	.ascii	"\3766+\3747J\377\0060\020kp\036\230\201r9\242\364}\216\032>\235"
+	.ascii	"N\247\233\2073\221\217\253?\260\255%%EJ\226\226\316&\233\237"
+	.ascii	"r\2262\201\214\007_\226\222\342P\203\006\030C\212\021\2536\276"
+	.ascii	"\276LvQ\\r\337\347\374\300\247\212S\305\251\3049\003 c\302\265"
+	.ascii	"\0258\260~*\337\256\220<$>\372>'\007\340i\004x&\235H?\223L\260"
+	.ascii	"\251/,}\317\243\300\300\263\310\346\247\022\300\264\321xY\342"
+	.ascii	"%\320\314\317\2423\337\3008\033\223:s\007Q)\032Z~}\2373\343\314"
+	.ascii	"\025l\277\377\302\356\002Rc\256\357\373:\311\177!Z\245\205 `"
+	.ascii	"\337\347\250\300\307\321#s\377\310\370\371\321\335\310y\313\""
+	.ascii	"\213\321\3678w\3708m\370\277c\306t\030\217\222\034\025\202\031"
+	.ascii	"b\310\200\345\f\347\001M\334\f\027g\372\036'\b\376\345\2637L"
+	.ascii	"\230\0163\225\331\350F\tn`px\340\333\016C\277\334\275/zz\366"
+	.ascii	"\r\352\352\017,KIq\270a\221\206\206\327\3678T\3708Kx\313\355"
+	.ascii	"\262\345\346\2419\333\245U\213\247,\365\304\201\013\227\233\207"
+	.ascii	"\213r.Z\346\026\033\332\240\2448\340\230\335\301\025\365Y\265"
+	.ascii	"\233\247w\332\005\351:\353\373\033>\374\2335|\213\304\336,j7"
+	.ascii	"\213\025\343\311E`@\360\321\266\364\3407c\270\355\342\231\312"
+	.ascii	"&\253\261 9g\f\226J\212\f\255\276\277)\202\355hp\310E\021\323"
+	.ascii	"\3677>\256\330=;\243\035;\372\336\272\377V\271Vl\246\343j\353"
+	.ascii	"\333uv\007u\200\325A/\225\236_\272{D\213\237\230\276\036\300"
+	.ascii	"\375\316\3757\356\312\331\275\026\230,1\302\353k\265\354\016"
+	.ascii	"\272cuP[\326\363\013wF\212\323\326\333\225Bs\246\345E\222\276"
+	.ascii	"\277\301z\203r\335\3200Y\306T\337"
+	.string	"\3370A\271k\277m\177\377]\266\006l\255\2458\271\276\377{\322\363\273\206\007\007\335\266\372\342\250\375K\321\030\221\270\263[\265{v\321\204\312+e\220\317\034\214\362\022\322\3677H\370\277f\327\254\3238,\263\213\236\033W\177`e\360\177\231\\&>\300\350\341\377*\371]\362_\262[\326\2006d\371I\216\276\326\314\356\240\033\254\016\332k=\277J\334\242\224L\031[\242jRpd\365\275b\313\262\234\363\006\253g#\360\255\357m\344\360=BKr\217X\265\213\344\027\211Yw\215\340\024-3\024\272b\313\346\214J\205\n\364^#eO\264v\360\365-\322\200\230K\031\226\027\030\030\030\0336\374\337!C\256\013\236e\216\352\031\273\372\003\313Ol\036\334\206\t\376/\220_!\277\371\343\006\031\364\032\323\324\367lv\007\275?z~\201\324 \2758\353\352+\354\372\365\361_\257\373%\274\301\266T\353k\341\354\016\n"
+	.ascii	"\253\203\336\036=\277]6b\266\224\205\365\345\200\253\001s\216"
+	.ascii	"\221\0279\270v\334\035Q\034l\216\340\377\352\370\335\372\257"
+	.ascii	"\323\325\332\361\342\211__\013fw\320\233\243\347W\307\215\026"
+	.ascii	"\327\220\265\276\032\334\254\213\325\267\243N\257\357o\325\265"
+	.ascii	"\372\275\361{\343b\331\234s\226\312E`@\320\335\270\372\373\313"
+	.ascii	"RO\034\376{\365\213\365/6\001@\235pqu\365}\337\277\374\027\326"
+	.ascii	"L\331\201U\245\357m~\340\337\276\1774\033=\345\234\243\316e~"
+	.ascii	":\262A\177{{Z\313\341\277\261\246=@\006\021\264\314GLp\344\234"
+	.ascii	"\355\030\fd\315\250F\001\362Y\2273\322UQ\005\256\240\220\256"
+	.ascii	"d(\313\256\2402(\313\256r\021RWQ\206\247|U\244,\3139\003\022"
+	.ascii	"R\321\tVP\3122\243\234AY\226\241r\222\035\224\315\313\253\242"
+	.ascii	"\214d\2253d\244l\224\313\254\240\n\240D\272\202R\226\031AeP\226"
+	.ascii	"]A\345\262\253\214!#\031=\255@\312O\031r\331\025\230\\f\005\205"
+	.ascii	"AYf\005\245,\273\002\263[+\354\306\270X\202C\307\n\333\246D\312"
+	.ascii	"N,\246\214\2360\324)\227VyK\316\326L)?\345\272\234\017\220\363"
+	.ascii	"\224\325\323\026#\031\226\355\250\316\351(\315\310\312.s\316"
+	.ascii	"\033X\034aYe\244\272\"\233\353\224A\254r\016"
+	.string	"rd\"\263\3109\347\017E\313\272\274e\353\212pL\345&\245\2349\310\313\234Y\344\\ds]\316\271(\347\234>M-s\246\201A\371\305\202E\316R<,\362TQ\233R\316m\226\307\006\245,\303\262\352icR\366\225U,\213\254\262\311*\177\345-WO\270\254h,7\345\234\255\030\374\005\345\"\314\023\325\235\n*}\377k\343N\t\003\251\256\234\364\335\220\216Q\272\251\350{i\230uW\206\255\223\272_\2003n\r\253vi\\)\032i\2130\253\265\364\"\017\275\2579\203\377\033\343W\306^\013\371\2122\255\357\205\321\363\033\003-\353R\206\365}\300\205R\273P\327\205\251\314FX\037|\214\261yp\243B\200\365\024\327\3675c\360k\362\360\177[\374>\001\2321\203\366\326\367:\365\374\266\260\032B\004\253\357\006V\007\275M\017\310w_}_s\005_\246_%V7\246Q\f\272\265*jf\225\273\242"
+	.string	"@\256rC\016\016\035FX\372\276\246\r\327\231w\346\362\013\205#'>\244\253\342&Y\265\253t\225L<\023\020\204\322\223\nG,\370\256\322=:\225"
+	.ascii	"\034)\263\321\r\020|\224)\"\270\241\203\016.\023\255\270*|_\023"
+	.ascii	"\003\337\344\003\263\301\326iU\340\007\232_\030\240\211\305\334"
+	.ascii	"\013\300\221R\004\\\232\030\263/2\346\230>\016\266\316\354\004"
+	.ascii	"\266#&\240\371\327\005\306\007h\206\331\200n"
+	.string	"m\021\211\361w\36352\003\315A\323\214y\346\026\231\202V\315\0044\313\234L\226\374\005j\270\247i\303\2479\303\247Q\202OS\004\237\306\007~\235\335AO\263\003\237\346\n\237F\n\203`wP=\236.\332\263k\321\3674*\272\230^\254\232\371\305\324\302#B\026\223\313\227\257\234\227\346\0273\317\344\242\341\013\227\256\"\035\230O\272\214Y\202\336\013\231\340\337\344bn\2519\203\304\306\031s\213\251%\211W\023\216\276\027v\341\013u\340\013\255\360\2053\354n\336\375\246\232i\345t\262bNE_\363J\317M\273$\255\246\250\276\f\260:\350\205Q\270\227v\007\2750\t\377\346\334M\272\337\204bR!\032K2\330\267\265\354\016j\236\365\334\234\243Q.)\271\246\334\224\373M83.M\372\343\033\354\333J\273\203\032\300\352\240\315\324ss\n\036\243\342\206\344vS\312oF1\337l\324\374\276\274\372\366\227\335A\027"
+	.ascii	"\245\347\246[\323u\031U\365U\300\223\233m\277\271f\262\321\224"
+	.ascii	"\021\022\205H\3376\263;h\003"
+	.string	"\324zn>1\207\254\341\021\351\313\301\311\315\264\337<3\321P\030vd\376\372\266\225\335A\023`\326s\323\211P\205\022\360\251/\002\312n6\371\315%&\023\273W3\245e\246\252o\363\331\035\264\003Y\317\315\262\033 yLe}?"
+	.string	"\263j&\2309\306c\225\243\f\200\304\207\016\251\277\234\245<\260A\233\003\023x\304,b.\177\2249\362\325\327Db&\261j\0020\305\316\204\235\t\354{L\005\337\n"
+	.string	"\265\203V"
+	.ascii	"\250i\244\347\346\021\241\326\332\n\273\276vp\320\352\240\030"
+	.ascii	"r\266;h\347\334\206M\"\177K\261\\n\026U^\225\t\344\346\220\337"
+	.ascii	"\fb\n\t\241iKG\337\303\331\035\264\306\352\240\346\217\236\233"
+	.ascii	"@\300\224\201E\372\322X\035\3647\273\254\232\331e~\235\312l\364"
+	.ascii	"\343\203\217\"\323"
+	.string	"kI\005\324\230\276\307e\370\030\t\376M\243[5\323\310\344\022*sv\361\301\307\225\253\277\277\374\364\344\201\311C\270\346E\357\250\357q\024\276\b!\214`\3520\261\254\030N\3212\267@u,\007\331\376\230L\035f\322\020#=W^|\346\016s\313\3142s\2308L-\253f\352\370\315#\023\311I\205Ye\353\314D\360\2055\223\251\303T:\341G\021S\207y\303\254\302AZf\0278*\362 [\0078kU^\210\341\334\247Z\360S<\374\364\n\276\bR&\r\035{\277Ie\3320\247L+\253fV\2315\314*Si2\231\313/\341\222\026A%Uf\223\031e\216=a4\025e\300\374=7\253L\027\246\f\034\243e~\212\201\022\220\r,\347\245\331E\306\345\007\315}\3726#]\232\303\302\325\367\251\023\3744\t6_\2300\254\032\003\314\030?\215\226y\231\3632\307\254\213C\002\353\3734\b\276e"
+	.string	"j\016\016Z\006\240Oy\340\377&\224U3\243\314\24723\312da\266\300AZf\250\224\213\024 \333_\316K\236\016hjP\321\241\342\336\247Jl:\335\300\321\265\271\365=z\006\037\365\303G\365\360o.\335d\022@\013y\003!\\\027$c\372\232+zn.\r@\355\255\255o\212\005\037\255\303G\347\360Q)\330\\\332\035\024\204\325A\217>\301\277Yd\346\2411H\362\332\314\315\374\367\231\036\354/4\222\354\350k\371\354\016:"
+	.ascii	"\253\203\266`\317\333\fNX\221\215\256\276\002(\363\016\004l!"
+	.ascii	"\347\264\276\037q\202\313#9\347\034a[\240\020\030}\373\257\347"
+	.ascii	"]\346:g\3120\231\365\315\261:h\223\271L~B\250\364=Z\206\377\356"
+	.ascii	"\023\343\027CjK\337\026\323`:\2149\366$d\022}\3231\377by\240"
+	.ascii	"\211\261kpte\033\266\264<\345\242%\345\233\301\264\003\016\f"
+	.ascii	"\257X\316A}y\312\367t\317\306\213\036\231:=\354\326\006\004K"
+	.ascii	"\232\227z\271sr\200@\272\340\266\2512q}\277a\t\247[\004\347\236"
+	.ascii	"\322\315\245X\\\310\345\310\345H\033\264{\212\345)\236\235R\344"
+	.ascii	"tv\227^I\247\342\004k\244uF\250\276\276\324\245V\214\256 \t\253"
+	.ascii	"r\305\226\251\230\r\246\\%\245\302%J\2244\316\352\340\033d\303"
+	.ascii	"OInipO\343\336\\\320\353\232\353\233NA\261\240$)\202\3247\225"
+	.ascii	"r\271\226\246\266D\365M\337\376f\205\264\355\360\"\266\024\345"
+	.ascii	"Fu\205\354i\031Y\n\205\307\252\b\f\bbv\344\210\211eYy\362\024"
+	.ascii	"\312\323\266\233\030U]cl9WF/\344\372\246k\037\230ZF[\\)Z\252"
+	.ascii	"\026\310\027\205\226\023dH\017\272\264\353\242I\031\256%}S&\351"
+	.ascii	"\231\0311+\360l\232\344\005fq\222\2325\2512#f\003:\203\353\306"
+	.ascii	"\223&WJh\266$\315\256o\272\344f\375\027n\300u\246\211\036^\026"
+	.ascii	",$(F\236\212\031I\307t\242\330@\305\346\260\310\374e%\030\207"
+	.ascii	"\264n\t\316\312\362\351"
+	.string	"X\007\2229\023\202\344i\222_h\243\227\306\345\325\367<?pz\204\247G\372#\375\221\206Yq\273\032\362\227\003\250wd)\005{\032\326Y\376\262\002\373\246D.\213t\206\321V\321\020!8x\004\351\233\002I\203X\265\277\245BrN\316\224\276\252A\374\302\033\232\016\016\016\016n\300\247\365t+\325J\277R\030yg\370h\336\224t\271\350\361\364\353\251W\b#\374-n\214\251F\337\247]4@\262\312\210\364\345z*\003\345%\345A\225\345t\225'\031\0310w}w|\303M\0260K\272(I\255\322\0347I8\306\247\345G\326\323\034\237\253\311K\302u\3257\305\361\2750<\360\250\364M\261>'\306J\024e\337\364\352sr^<\004\373\276/\275\361_\370c\344\226\025Wt$\304\007\215\247S4R*\036\253\"0%\304\025\001\034\363\227\225R\034\3222@\245_j\343)U\037\265\251\265%Ikl"
+	.ascii	"\005\365T\006T*e\225\344\026\351\226\234\037\231\277\254\234"
+	.ascii	"\342`\223\245\210\023\037\251\324\243\344P\256\321\365Ma<"
+	.string	"\215\361\013\273\355\217\006\223\276\327\240\017\247.\236\276\370\205\302(\025^|\370O\243~\241\331\002+\211\255\3575\330\202\257\301\224T\231*\323\026\030^\360\344\243\271\031V\f\026/X)\213\247-\236:\2050\202]\263\251\201d\347\2262\245M\3020J\264\330\366\370\376\202\374\345\365M\227\322\025lg\316\244J\246\240M.\302\260<\352\222\344\013\007\356\205\222Y\232\237*=MJ\261\226H\004\373\246H(\231\223kJ0\251\357\323\243\033\263\026O\230\372\246Fh\230\030exg\372\246E\350\030\243\246\255\262\276\357`F+\315E_t\020\315\253\273\361\227\324\367\250\224\364\006\227W\224Y\2300\250\340Ua\227=aN\304\220\371c:\363\002C\314Q\301\243\201!\214\3607:\255'/}\3212( \352\244\245\310\223\276\250\037\372\367\013-\022\032hI}\257\301\030F\311\240ap\004\302\335\350\213\366}\360_\3306"
+	.string	"o\b\366=:F\313\256\207\220\276m\377\206\376r\335\034\361\322R\204\013\027\224\257\n\215\013\023C\346\317\f\304\013|\262w\224\317\256\t\347h \241\353\213~A\365b\030)\263\364\275U\373\227\353\345"
+	.ascii	"\361\002%I_\324\213]\333c3\202\324\027\355b\327\276\230uM\345"
+	.ascii	"Y\271\022\025X\323\346\265\326\245\3575\b\202\005\013\252\005"
+	.ascii	"U\2760\206\b\017>\341\223\213\0279\313Q-\203z\202Ez\\\271\202"
+	.ascii	"\336\241\312\0248\210P\361\321\\MUq\262;zw*/PY\372\241\201\016"
+	.ascii	"<\367\317\241Vn\"e\252)T\314\f\241Q\026$e\225\243V.\223\2639"
+	.ascii	"\275\276(\035\312V\005D\252\257/J\345T\372\214\312\022\016\r"
+	.ascii	"n`\035G\337t\240qVY\002\324\226\0302\227\016\317K\024\334\321"
+	.ascii	"8\224\215&\013\226\243\254\276\350\024T\312\231\025\2710R\262"
+	.ascii	"\206\310u\365\245\331BC\205__\224\007\032\005;i]\261\322\027"
+	.ascii	"\345B\335\304\310\004\345\372\3668\372\244\007\n\005\347,eU\004"
+	.ascii	"\006\004\272-1d\376r\240\232\254Pi;\n\345\r\255\023\004\324\201"
+	.ascii	"\262Y\261\020\254\302\206\256\235m8\230\360\232\310\224\245\r"
+	.ascii	"3}\3213T\215\206\214-\214X_\024\rM\303\001\f\203Q\326\367\032"
+	.ascii	"D1A\235lm\251\r\366E\233\240f8TV=\316\372^\203\025J\320%?\202"
+	.ascii	"Y\310\372\242dhY\217\271\375 c&\t:f\343'\006\306I_T\f]\n\305"
+	.ascii	"\214\370\212\220)\202\"\311\301\033\302\346\245/j\004=\302\204"
+	.ascii	"c-\254\357w\3640\0214,\215\013r\244\324"
+	.ascii	"\027\005Cut\251RS\366\005\202\016\261f\246\314q\365E\203\240"
+	.ascii	"B\254\331\227\n'x?rv(\357\254\372\036\375B}\374B\224\016/)\367"
+	.ascii	"\375\316\034F\273P/T\007\032\2316\267\357\244\341\177\240$\006"
+	.ascii	"\024T_t\353\350\216_XC\206f$\243\357w\310\360\217j\375\302\233"
+	.ascii	"!a\331L\337\357\034\301\337\031BE\205f\331\255\247A6\0136\367"
+	.ascii	"B\017\305q4\353M\006\034\237X_\324\n\305\372/\304mHv\024a\241"
+	.ascii	"WpI-\256L\036V\330p8\351\213\336@\253\276\367_x\2236\326g\327"
+	.ascii	"\252`\335\035uMM\335\274\246S\212\214\314\f\0344h\320\350?!I"
+	.ascii	"@\372~\247E\214\030\250T\215\257\234\2458\234\203c\312\264\220"
+	.ascii	"qTJ\357\246\317\315.\255\215H\323\234Z\231\027/n\236\305\260"
+	.ascii	"<\272c\361e\323\225E\231\365%*\352\346Y%\271\005\217\017\273"
+	.ascii	",r\1779Kq\270\241\032\203W\246\3573h\2022\035mB\237.S\316G ,"
+	.ascii	"\217\266\344,\305A\003(\177JX\034}:\332\"\204\021\376V\2013J"
+	.ascii	"\212\364\375Q\247_\330N\350\372\220\364}\006b\370}\227\353\277"
+	.ascii	"0\207H S\226\276\317\340\013?\003\036\370?\365\254\332\251\207"
+	.ascii	"\256\340\260\314E5]\306\246<\300q\253\301\003Ny\267\274\b\253"
+	.ascii	":\277\004Z\371\365EU\034U\262\261\242\022\222$\327\027M\222Z"
+	.ascii	"\322\373\353\373\fj\340\237b\306\230K\234\"\f\371\350\316\210"
+	.ascii	"\323\031si.\277\322&XH\3141\347\340\271w\206!;\302\227\363\362"
+	.ascii	"\034<\377NA\020JO\302%\262\236\301\263\357\364\263uR\271\b\314"
+	.ascii	"\007\"Wbg\376\320#\324\bEB3Zd\325\316\301\323\214p\016\353J\237"
+	.ascii	"\315\275\316\037\276\316\026\374\237\202g\340\232\330\213\267"
+	.ascii	"2'`\223\0177\250\276\327\241\202\313\350\300\341\223\314\215"
+	.ascii	"A\227\325\325\367:l\370:i\370:e\370fv\007=\301t\330\221\256\271"
+	.ascii	"\276\327\001r\362\351h\341\353\320\300g\336\231wz\2619[\0013"
+	.ascii	"\305\341\346\254\351\211\305\331\345\247\027,\265\345/\253\375"
+	.ascii	"\274\230E\305\365\275\316\222\235\335\271\305\346'\036t\351\213"
+	.ascii	"\263\244:-?\267\274\021\341\323\201\325\367\314bb\221\322\246"
+	.ascii	"\242\357\211\305\346\210\023\027<\274\223\f\222\037\017\274\273"
+	.ascii	"\r0\272\b\271k'\347YU\232\214\276\327p\246\256\356\224\353\342"
+	.ascii	"$\275\341$\347\364W\245\312)\207\344\213\351\210\331\216\276"
+	.ascii	"\327p\005\237TN*\247\034\316Dp\226\344\376\006\373^\303\032>"
+	.ascii	"\341N\270S\316\004\264\035\247\224#\031K\372\236r"
+	.string	"wbY\266h(\223\"\345\214\322\205\352\353F\317E\f2}\257\001\211\233\333\031\005\215\206\260L\027#MQ:I\036\221:\257\276\3270\244m\360\313\013\257=9\315x(\371\266\324\324\316\330(M9A\353{\rVgh\367\356f)\f\031\311I\227\257\032\370\032^\340&LN\263-/\032\236\3605,\341%K\316\034\326\306\215\253?\2601OgG}\257\241\b\237d'\331\231\243\0015\306\322\224\270\314\365}\0061\370\247\230=\307\306\336f*sR\233\004|\370\270\372\373\353\202\337f\033)g#\004\234EKp(Ar~\235I:\255\002I\312l\004\004\004\"P\031\356\3603\304\0311\322{M\240\324h)\347\312\372>\203\332\031\326]x\224\344(\034\035F<^\374\345\f\347\001\016\222\237YU\337g\220\201\177\006\261\347\020\"o\263Y\351I\203\263;/\276\374\224=x\006%>\006?\374\266\377\215"
+	.ascii	"\234\036F\250\270\372\376\374\262\347\217\257\023\310\275\263"
+	.ascii	"Y\351I\310\204\005\306\207\201\013>\2068|{\357\320\035;N/!W\320"
+	.ascii	"\033a\266\246t\375\364\242\333\003\373\353\373\276\263\307\177"
+	.ascii	"!\215\231,\277e\217\223\213\006\216\272\034\235e\231\352))\263"
+	.ascii	"\244/\217['\037IsjZZg\216\031WZ\355\212\226\013\261\254\2543"
+	.ascii	"G\347\234\363W\312\304\211\031\037F{qD\226\343\336\341\241a\351"
+	.ascii	"\362\303\312\352\304\002\373\312RR\034\256\215#>\264\253\237"
+	.ascii	"X\327M\212\332\213\276\347\r\0342}|[\177\2730\332\214\320]MM"
+	.ascii	"\235T<\276n\236^\374\250\262\361\223\252f\312\222\026J\246\374"
+	.ascii	"\027\232Z\240\270\214\364=\206\0304h`\310G\\\264\276\262\324"
+	.ascii	"\024\207\2662\345\005\252\35710II\335<\353b\354\352\017\f\356"
+	.ascii	"\314\025(}\217\241\b\237/\316\027g\f\234\241n\200q\260ujn=\372"
+	.ascii	"\376'\214\2371r\322\332\226r}\337w\243\374\027\246 \207\2206"
+	.ascii	".QQ<\203>\3008\320\240}\265p\352\373\034:\374\237Oj\347S'\271"
+	.ascii	"\313\f\205\0067\321!ib%\ny\340\300X$\"\2057\321A\250\230\034"
+	.ascii	"\016\205\\\030J\200\n\253\252\201\f\206T5H\270\252,\254C\022"
+	.ascii	"zVc1]U\026\210\204\212\036V\023%\212A@<+\221\350\003\352\017"
+	.ascii	"\321Z\\W\013\254*\013DBE\rD\031\030\213\307\025\330\240\360Q"
+	.ascii	"A0\364C\224\336D\006\353\360\247(T\205\212\353\252\226\030\236"
+	.ascii	"\3609\006\371\334hX\213\306\020C?D\251\272\022U\244\317Mt Q\f"
+	.ascii	"\3721\"\211V\025y4\342\265\370\202zo\242\003r\035\022\327 \365"
+	.ascii	"\204\023I\342\b5\210\350G5\341\223"
+	.string	"T\22187\321a\203\023>\307\240\024\310u\270S\302XD\256I\r\220G$RE\256k\322x\3649\201\210j\320u\341\2104\261\036\215\251\3171hx4\"\221\352p\210\001(]\211B\310#\020\n\264\032\213\310!\364\207\250\"\201\316\037c\321\005\025\211\006\005\251+\320yBU\223@\247\020QE\256I!UhhT\207\2168B\252\020\020V\213'\216G\237\032\243:t\374\001B?\220\220~ A\250\376t\200\325\240\"\320\220\320\232\252\311c\220\017\020\252\032\213A\306\342\321\210}\216AAD!\324\250\016\035\201\316\037\243\312\302\320\017Q\272\026\215Ea\020\021\005R]\215!N\370\024Gd\260\022\035U\241\342\210UM\356\324\334D\207\037b\212\037\022\305 \017\03560\272p\374Y\211L$\207?\304\024?7AADF\343\321\230&W\242\241\241\261\270\006\025\211H\f\2078\311\225h\350\2567\321\001"
+	.string	"+\321\320JtD\223\303\034 \365\004u(\305\210a\n!F\324\b\025Ws\035\226 \2168\026\323\022\304\325\fR\215F\242\t\237T\035\206"
+	.string	"C\262\0041\b\005\265\0041ID\243\"\211.\374 \211\033\270QK\020WP\223Dd\006rH\020%\207AD\024\252Pq\25595H\376\030\217>j\n)\210A\352O\206!U\r\242AQ\020z\360\r\241\303\232$\006\241+\321\321\024\241\303Jt<q1(\250(t\243\256D\020\b\025\223i\372\241CR\250\201\232\233\350\240\236 \002\r\217\310\024%||\210\036\222H\025E\021\371\323\201\005\324\023D \032\234\021:`\270!\241\203*T\\\327$1(G]\211+\0135H\237\242\320M\020QE\016?\220\220<\032\211F\033\024\324\225\350S\3741\026sjV$qe\001\251\n\025W\232\265h\f\201\274\300q\304\006\253\232TAPs\302\347\030\204\001\025y\304"
+	.ascii	"\0139k\321\030BH]\223)\2224?F5\231sB\210\025\214Eb\n'|\216A5"
+	.ascii	"I\242\225\270\262\220\341\007y\034\201\020\021Y\342\210\\\201"
+	.ascii	"\347\204\317Q\004\215\210\f7\321\341X\374Y\223;H\244\372\263"
+	.ascii	"&\321\037\024\260"
+	.string	"\315\t\237c\2201\004\303\r\260`\001\021(\350l"
+	.string	"\241\303\212$\016u\b\001\362\270\036SPW5hH\350\210\001\241\"\013B.\f\025\240\204\261h4\022\201\300\205\0335\210\004\321\361\007]\207\037HP\207\352\3171\005\025I\024T$\002\335\250Cu(\305\2105\251\022\261@\005\001R\375!\036\203\326\343\221\304\006\353\211\025\204~\200P$qM\322\234\3609\212PW\342\317\020\021\215\216\317\352\263\nO\030\213\"\324\225\270&\205#|\212H\325\250\226\300\377@\302\007$\200x!=\b\b\200"
+	.string	"\001\020\320\203\200@O\017\004H\350\301'\241\307\\\207\310u%\342\254B\244z\002y\034\301\320\017\221P\035\376\2048\221$\256x\3151\226(\006\021\207\303\364&:\204\220\034\276\240\256DB\031\206\350j$:\372\f\207)R5\272p\034\016\323$RM\022\031\207C\374c,\236\030\016\321\244\2618\224\034\016S\343\261\230,\006\251\303\241p\035\256\311b\020\206\233\350\360\301\217\212$\232H~P\302\372\202j\f\"\032\221\352j,\232X\207\206\303\rP\250\310\241\341\020\035\242CTmA19\034\242'|\216\"\206\216G\021\306\"Q\310\346&:\254\311\343\320\320x\024\022:\372\200X\215E\242\224\270\022O\020:\"\207T\225\346\210\002\251&m\326\023+\b\2710\204\336g\035\2360\026E\f\375\020\to\242\303\tc1h\350\207\310"
+	.ascii	"H\025\005Re!Y\304?@]L\266\2618D\376\374\020O\370\034\2235\353"
+	.ascii	"\220\230\254I\021T\024\"\002\r\215\305$\315:\024\256\310\343"
+	.ascii	"\320Mt0\026=\254\252\261\270\252F\016\322u(L\242\310\237\037"
+	.ascii	"\342\021\251\266`h,&1\n\037\025yW\344q\350\"\177~\210\367\204"
+	.ascii	"\261(B\310\205\241t\035\"\327\241\325X$\022\376\250\352Pr\210"
+	.ascii	"<\256G\241\232#2E\tar\210B=\301\307\207\210W\365\204\017qh(\364"
+	.ascii	"\003Ds\023\005\370qHEzX\217G\244\207\232b\3628d3$D\\\205)\206"
+	.ascii	"\220C$1\210\250\204\2218$\022*\362\264 \305\013H5H\365\361!\016"
+	.ascii	"\221D\325X\f\032\022\t\025\001\260\022\211X04\036\213+q5\252"
+	.ascii	"E\344qH$T\314\240\005)^\030\246X\213>\307 \025\205\315Mt\210"
+	.ascii	"\200\217:"
+	.string	"\224T\205\212+^\207\252Pq\035\016\261\217\232\034\242X\321uX\302x\fJ\016\203\202\210>\311\024\311\3410\203\217\2324\016Q\254\351:\fA\204\325X$\302\031\020\021\002\205{\023\035V\037\"\344\232\364\220T\207R\254\036\222k\221\204\007\"c\211\017^ 2\026\203>\370@\302\220\004\020/xP\177\210\202|\214E\017\310$\221\207\007\204\360\243&\211\214DC\214\"\327!\233\037\242\212\304A\256C7k\021\351\202\315\217Q\035\002\021\221P\223D\0227j\222Hb8Dt\302\207Hb\250B\210a\316\217Q\035\252(\210\311\241\n!\2066I\244z\002I\024\032bc\221h\302g\210\036\215jP\021h\230\206\220,A\f\002\032\246\3530\375\t:\016k\214BDAG\237!\222\310gX\243\006\221 \256(\2068H\242\t\237\013DDbE\036M$\207\302u\250B\210!\315\t\237c\320\360\\\207\037H"
+	.string	"\002:\016\207\302UM\002\001\035\207\251\n!\2065+\n\037\365\347\3503\304*\204\030\336\020W\342\317P\375)\2720\244\311\200\210\020(\fU\b1\304k\262\030t\003DDb\230T\221\252\212\004\032\332\254C\265\005\305$\372\236\036\f\024 \004\036\320"
+	.ascii	"\366\351 bD\b\026<\254j\t$q\365`,\022\205<\370 \223\036:\020"
+	.ascii	"`\204\037\342\320p\210\252?G\241\341\031t<^`x\376\307]\250\260"
+	.ascii	"X\344<SJ\214\256\273*.f\333M\3532\333\333b\246\345\200e\215\r"
+	.ascii	"\321"
+	.string	"\222*\341\004I\013\004\313b6\251\261:\352\241\005\013\312W\303EP\211\022\017\325r\004\020\357\013\276\273c\261WUdG\204\310\030\016\245+h\234\231\203\t\332\262\216\316\310I\0253V\316\244\235\2540 U\226}G\327tDg\016\261\031k\341\"\b\225{\305\312\252J\313\034\n\305&n\213Q\230\2349V\203\344\206$#.m!\214bFD\020\016\265\2625\345\351\313\024S\016m\362\222\226$%\315A\0036\2255\345\rc\245v5\232\024\211r\312\225y)cf\211#\245\345\f\030(\251\024\316\023\203v\324\206\253z\207U\216+l\267\316\306\t\020\037T\326\356\034\016\230\2147\263'\251\340\034\f3PjiXN\214,>\366\322\356\026\215.S\202\340\263c\264\313\245H\031\306\311\365\321I{\203E\314P\301\234\264#S\\M\256\220\232\244'*IL\322\270.Q\326\002\227\244P\\p9\201b\025"
+	.string	"\224\007[\221/L\226\216\335x5\251\262\242$\305r\003\303K\224*c\250\324\035\223\306\243my\363\234\314\320\302\022C\237n\226SR\240$\361\302Pd\264x \271h\201mg[\216\244~9~K\240\3500\202\225\212\250\341\310\352{\261\330X\331\205IY\013\203\202\342\243\352\007\006\303RP\244\366\274\372^,6Vh^bt\r\271wI5\366\300\b9sT5\251\260\013\222\362Mqi\335\350\213}\2301\030\034\034\034\024\314\331\b\373h\f\004\3778\366\361\234t\013\230\322\b\305<0\017\354e\237\236\3028`\312\035\021\260\277,\365\202\303\217\273\216\275N%/c\354\372\342\036\177\303\201N\304\360\372b\256\277\245sU\260\2528\260[\242Y\260\266p\3312\277h\210\224\261\"\245er\305 M\311\235\0164K\350g\3676\225\343\256\310\021\210\344(+\375jZ*#\322\367\306\217o`,-X@"
+	.ascii	"\377\350\314\356\236\\\035c\255a@)\211Q\337\367\231K,2^\326\372"
+	.ascii	"\236\003-\0324p\025\217U\021\230\036\0315v\300\275\340\206R\016"
+	.ascii	"S\035W\275\245^G1\256\364\3055\260\215\024+\207\022\rl\003O\335"
+	.ascii	"\320\001X\003\033\021\303\343L_*\027.\260\324U\315\212A\036w"
+	.ascii	"2\216\245P,;1\260\2768Fw9q\210\231\322\325\027\303xq\016\\(\225"
+	.ascii	"\030\212\307\312\324\022\206\307\0130\232\026JV9\236\216\241"
+	.ascii	"\262\004\236!\323\027\267\350=?0~G\372b'\334T\006\203\316F_\314"
+	.ascii	"\0027\t\307\254\3140\322\367}\270\351k\fWQ_\274\002/Y\265\r\230"
+	.ascii	")\347\3300ZGP}\317\001\023\206A\316v\003j\007\007\355\006\364"
+	.ascii	"\033\006q\021.\302J<@\\xM\241{Ml_p\322\261\322\334\223\276\276"
+	.ascii	"\276\030\351k`\\\256\314\364\305G_\033\313j\263\353\213\215\276"
+	.ascii	"\226\363dl\013\217\265'ag}\277\301\355\314\323\3013\351\227\217"
+	.ascii	"\"g\370\300\262R\212C\367\031Yb\3227I\231\277L*\350W\344\f_k"
+	.ascii	"\361\322\302-\360\251`\210\034J\244\276)\340uQ\206eNO\215K\305"
+	.ascii	"\220\246\276\337\340#\r\223\206I\375\362 [\224\2159%\231\247"
+	.ascii	"~o,\234\304\\\364M\373P\254\034\245\202E\206\306\250s\221SzP"
+	.ascii	"6\213a\024\r\"\206\020CD\263i\206\003c\026@@@@&\221\352\342\350"
+	.ascii	"\036\023\200\204\216\354cA\020S\214)B#\201\210\210(HR\224R:\004"
+	.ascii	"\251C\242{x\215~\275p\266\240\377\374\272\331\361I\357\220\362"
+	.ascii	"\217\021\277\006t\022o\3627\3231\b\200\235\261\374\022\242\023"
+	.ascii	"s\006\261\320\214\026"
+	.string	"H\302y\257\306\222+\365\007%Q\353\312\337\331\247\361\200G\021j\205\361\364\r@[\353/\027=\204\315i\365=\024\236\322\357\203\234\331\035B d\301\364\355\230\021'\332\265\022\353\326\216\356|\221\177\032\233i.$\032\033/\t\305\337\351_ ;\212!\325G6\363\0063\017\206vx\3445F}\340\240$\325\362\303uEg\266Wr\304\220\032\373\200\366x\221\007 \364\202\234f\250\030a\275!9E\243\232LcL\004\206!\222\310]y=\"\220X\251\211\t\037\276\323\370\251)\336\306\020\315\240h\256\332awi\346\335\236l_y'\3163\222\226\333O\277ep'\273\354b@\031\210\300\247=\215\201\266\272\351\333\247\365Da\320\210\002\344\356\305\336R\264\025\325y"
+	.string	"tR8\226N\037\371\240\222}mY\225j\004\215.b\322\300`\200\346M:\304\324\260{\225+v\313\232\246\312\234\327XU\345\204\022\234\033P\304.\320:\r\2225\020_,\236\253\240B\211\031\347\013X\215^\022\362\213\353\237Lt\261\245\376\353B\361vu\005(\b\224\311i-B<\n\347g\254H\277\350\345\3161Rs\210iak\220r\004n\342\025\033P\304#\227\314\254R\221:\367\262%8\343X\251#\214\262\250<\217D\243\272l>F\306N\265"
+	.string	"b/I\305Z\240p\317\245\340\342s\377\020\007\361\265\265\004qE\200\342\305?\211l/\351\t\360v\316\025\017\240\r\227\247F(\023\004\243\202\303S\230\302\251~\"\203\316\270\331\232\3016'\266{U\352\335n2\273l\030I&'AuK*>"
+	.string	"\005\232\"MK\026\240\356j\312\tj\302$\2241i\004\354Dkfw\022\211|\254\223\265\302H\262\350\3539\025\n\253n\"\035\242\311J\252\360\237\224:\214q`O\025\340J\f\b~\334M\371\030]\201\002\236\222<\225\2025\301\fb\b\235\325\355(5\002\364@\366\0256Q\212\3523\035\3666\205\233\\\223DyT\004\213\ff\302\312\301\245h\366F\364%@\023_<[s\242\375\270J\006\200\247\265\206\253R\021_\375?\360E^\313d\231\034\033"
+	.string	"\373\216\273\362\314\310!\317S\377=~\032\250\274PM'\0222\177\226\351\006\336\271\037p\037.\3235%\201\025\227\253L\310@\303x8\006\261\027\231\276D\247J\376\240\f\t\357\002\260\366\347[\272\307of\020\310\f\225)\312\256\265\215\277\370\264\214u\231\370\f>}-r\023s?)\206\025>\341O \200\216\240\n\205\330d:m\263=\263\030\253\222\024?v@\371\020\241b\021"
+	.string	"W\004(TS\317d\300\250F\317\236\266\244\241\230!\253\226q\323\215H[\361\241\223|\372\262\200\274\215\313U\205 \215f\333\251\034\007\252\336\272\024\363O\363\302s\034]\004rf\252\221\256 !M\271\261$\311\241\032\210h1\362\215G\023\316\256\273\343F\203\200\343Q{\356\214\226\0017\332\003\364\330T\360\331\265\302\317\2762\311bX9 \t\030\332\335'8@\021\237|\034\036}\227j\272\210\306\207\364\207v\270\022c&4\030\255\343\005EQW\007\225\221\2236m\314\005\261V\016\275\367\013\377\362~B\222\352\344\213\003L\220\260"
+	.string	"&\330\231\013 6_Tz\003\254\b(#\t\035\247\345b"
+	.ascii	"\313\022p\302X\"hy,\375_\332\227\364e\032\245l\274\016E1j\270"
+	.ascii	"\00385\031\226\374tP`\316m\366\361\266\315\023\237\301\352b>"
+	.ascii	"h\377@+\330H\231>L\244\016\203\227[\235\366c\216q\324\277\021"
+	.ascii	"|\227\202\235\317\227VY#UFF!pE\315\271\335'\352p1\332HN\026\023"
+	.ascii	"(\026\364Z\2616\330\253\226\231\300)r\366\321&\022Y\336\271d"
+	.ascii	"\333D\353\234L\240\376\3343\"=\001;,\001\232\364t\252K<\370\326"
+	.ascii	"s\243\310\371\3103N\277v\240\227\002d\314^\230["
+	.string	"\336\332bU\"\346\220\226\241\263rL0\366k\001\t\213\203\025\340\02355\267\263\340K\224 1v1\013\\\373\327@)4\005\370\253K\272\036E\270I\335\031\210\207g\371\342##j\2768\353U9\016Y_\323\002\346 Vy\234\363\237\tI\247)\213\201]\251:\013\274>]\222\226A\003L\"\333\225\030\244|\331\"\f\235wI(.p!\205\f\310\237\024\035L0\226k\303\366\334\023\277\331\274PP\234\366\364U\006\363\333\017\177H\214\205X5c\243\356DA\364\216|\233\267N\275\373d\b\360\367\236+\373\021\242\243\315_j\377\201?\0037\243\r!\016\376j\237^\026:\305\024\2237\223\277\316He\377f\261\f\335\270\r\031\303\213x\3336\202\013\227E#\314\235\314R$\r\032\366\001\013\322d\260A\340\2024\250\214\200\223\326\227\320M\203T\276\371\250/\275\363\216\310BH\222\300\224\264\210\020\231>"
+	.ascii	" n3\264\227\305\032\324\037\177/>sqK\030\357x_{4qN\001\313\337"
+	.ascii	"Q\300H\360U\310\223\253\231A\355K\346\262n\3771\263\370\233\214"
+	.ascii	"\020\373\037\253?\227\347X\020\255\\\034\233\031\275\252\333"
+	.ascii	",\307\307#A\267\250\023Y\315\b\f\013\376\311}n4\303[\243\362"
+	.ascii	"\bM>\357\\\356\001\330\250 \232\227(\205\007\275\273\313UJ\210"
+	.ascii	"\254\352aQ\324\007\204\260\257j\227\316\020cCNzW\322\271\222"
+	.ascii	"\031\204\351\257\1773\336K\310Q\206\376\340\f\r\227\2009\312"
+	.ascii	"\272\0024\215uB.\372\316PV\377\276vw\r\003sc\273\371\334\021"
+	.ascii	"\340Y\002h\327D|\b\346\"\302\272\365a{Bb\265\226\241\346#\351"
+	.ascii	"\320\326'\2760\027\020e3Pz\t\247\231\223) \326\252\316\325\013"
+	.ascii	"\253,p*\007\355\260\037\374\226\203\336\206H6\260\333\"z\234"
+	.ascii	"\245l-\3320\214\251w\317\225\220\335\317Y[\213\"\212\253\253"
+	.ascii	"U$0\031\377\343a\246'\205x\237L x\233\371;6s\220%\214\355z\""
+	.ascii	"\037\267\022\237\t\340\346\225~\362\013\234H\371\310\030$9\250"
+	.ascii	"\202w\263\301/\022W\334\301\007\372K\036-\371&\354'@\325\025"
+	.ascii	"\273y\237\376e\\0\254\210h\275\007x\003-\037tc\017\214\"\r\214"
+	.ascii	"4\223\277G\215\201cd\205L\001z\265\334\333\251\201\262(\243\246"
+	.ascii	"OZ%\243\037\f\b\034\2558\326&\302\342\240\337)\316\303t\035\241"
+	.ascii	"\226\313\225\007\203\314i+$\325n\356\030\271\354m\351\217\272"
+	.ascii	"\376\272d\326\215\25377 `\367\300\315o$X:\205@\355\236W\210k"
+	.ascii	"\210\267yY\260\234\214\2606L\233\002\330\"\327\f\360\031\272"
+	.ascii	"\205/\334|\272\340\314\372\005\362\035r\333H\311\326\001\306"
+	.ascii	"qr>\255Rb\223q\317\361ZI0X{P\346\301\205\322F(1\262s\275\264"
+	.ascii	"\224m0\025\\%\361f\227%P\200\205/i\366\205\273>\2049\254+\246"
+	.ascii	"\020\351\300v\300GD\266\021\377\206\276\320\333o\212*\203\204"
+	.ascii	"\207\370\033H:\030\227=\323p\177\265\247\264xPv\"P1n\332\034"
+	.ascii	"\306\033T\246\322UoVI\347X\273\032D\255Xu\351\247\2525MsC\352"
+	.ascii	"\026\251/\255(\213\375Q\326\215!\364}\246\361\037\232\337\035"
+	.ascii	"\266\r\177\215\252\363\037\276k,@\213\346\312\322,,\3531@\323"
+	.ascii	"\204S\3248\272\273j{(\003\026\201D\200*\1779\247N\nf\300\252"
+	.ascii	"\202\355\316\345\364\021\n!\342\020M\023lr\001\246\266\2061\323"
+	.ascii	"\022 \256\326Z\t\245\251A\370\247\246\001^\340&o\227\203F!\210"
+	.ascii	"?T\t\365L\205\335"
+	.ascii	"m\372\376\211\210\375\036\351\300N\276A\035\320t\217\316(\224"
+	.ascii	"\213b%\340\202X\355@\0053\020\313\233\375\366\265%L\002\031\277"
+	.ascii	"\013\336'\250\007c> \270!p\n\302\022\332\3014l\216\372\212\314"
+	.ascii	"B<z\r\034\322e\372\235:\347\301\204q\037\341L\305je\302\002\340"
+	.ascii	"f\356\177_\214\263P\362\254\204;\351y\272\032\253+d\321\340\344"
+	.ascii	"m\325\203\264\334\024\320i^\3204\266#cN\332\256w\303D\341\341"
+	.ascii	"\222a\204?\277\244\024\311\307\n*\002\264\206\006\251\017\340"
+	.ascii	"6\371VWX\254\226\037le\254\320\334\343H\235k\335\357\313&\004"
+	.ascii	"Q&\3568\257\264\312\352\333u\264\235\034\314\264\232q\n\2325"
+	.ascii	"\031\210\001\203\220\037\325\312/}\033\270h\202\223*\374\007"
+	.ascii	"\354\202\001|\0268\3046\313An\007\366\244\231\353"
+	.string	"B\252p\t\365}\343\211(z\350\221\222\220\237\300\210\031R\026<\323\3636\362*\f\272\216\n\307\344j3S\220 \035\246\264b\265\325=,\005k\323\322\350\364\373\363n\225\374\033\360=O\2141\006\205\263\017'\034\34646\241\207\267\005\345\260\347\332:0\201\232\342[`\324\304^\021\247o\317\203\241\2226\212\270r\270k\017\243B\305\320\222\236D\306'*I\224\202\256\376\227<&\307\t\003\2301\334\335\240@7\202\350\244BM\035d\235\222*}\225\3319;e1-\234u\375X\375\r\200T\245\320\002Z\245_\335\3647\301-\221\035Sh\265Q\342\2771A\364\271\264\277\275\206_\301\336\226\3205\276\320.\376\265\006\t:\324\f\253\002\365`{\262\333L`A\2312k\005\272\241[\n\002\320\252\017k\321\273\372\211\037B;\203\271\207c\324\2049\373\332b\272A\222\005\314W\034\337>\263(\234\371,\213\363"
+	.string	"]\274}U\231z\3065ImnL*x\332\213\313\372\363\020\303\323\212\315j\226~\371\3763\361\254\032k\303\373\362\032\333\367\240\363\312\250\216\233\005|\306\004\240\221\202}\021\031/\327\3218\366K\0272\331\373&\241X\330\367\261\355M7\006m\331?\237!\352\236c\034)\321\327\005\367\235\033\027\243\031\307\372\341\212\005\234\324\r7?\305\333d\233N\210E4\004<\324\\\330"
+	.string	"\355\330\260\262^g\304'\271\002\031`\027\205-\255r\226"
+	.string	"\210g\332D\025 \366\236\314\334\317\240\303\001?\212b\266\372\025\256\252\313\363\023\343\033\333D\250\220\001\020\205\254Q8\365J\3507Qiw@\brft\313\"\267\200\024\366I\241J\336\354k\200\032x\313\265\255\227\307\363\233\236:\030\fi\342\"Q\372\302^\366"
+	.string	"\325\033%\351AiC1\353vc\315\021\212n\326\361\320\231\264\352\356\177\374sg\365\275L?[\230\267K`\376Z\352e\253Ep\321#\246\257\333\200@\361MY\022%3q\311\3371\303\001\016\201.\222=\007\302g\270\214\031\350\257\271@\005p\\Fv\341\240]\021\350\367\272\b\223\337\337C\226wcZN\262\341\006V\204\327J\363\370+\265\242`\013\225..N6\357\023~\001\314u[\276\001\215R\004\353\001]\034jSo\257\016K\235\240iQ\374\370\250Y{\b\360\243k^H\317`}\251\177\344`\204sw*\256\216\332\241\200;\266\356\324\020[\026`z\025\321Oa\362\027\266\361\314O\334\232=3J_\306\314\223\211u\025\344\224gyn\274\256\262\347(\362\360\3221\016\325\337\365\327\243\260\236\203\233T3O!\325\177\257\271\f\371Eq\337"
+	.string	"\376\261\275\225\270\371\301\030\342\330x\327J\207H\273\020\220\035\243\311vH\376\005\343\335IYM\255\323\264\270>\310\375A\3030\023xp\362\367\331\274T\376P\3715\265o\017t\r\300\346\321\300K|+\346\177\373-I\363\317`NW\031\241v{\364\267\300\203\364\233q\022\314\303\370m\354\177\351'U\353\217\371\260\211\327\300eoL\b\215\227{\347\303\023M\312ct\317\0209\025\037\353\363}\212\200\232p\020u\333\177\023\374\377\256\337\317\037\375\375.\031\275$\236\325\247\013\251\013\216\327O`N\203\276\307\246<\265\3031>\357"
+	.string	"\350\367\372\340u7\003\253\336\031e\n\021\232\177^~S}\302\233\351\344g\210\201\211|\204\274\373\2444\213n\271\246\376\225\363\231(\274p\362\364\266$\326o\274B\375C\200\334\323\346_\201a.\303\"\357\363*\361\226\371A\220>\241\340\216\205\363\n\271\004\037'\221C\314\346N\"^v\263\032\226|\246\373\375\023\\:\372Jf\331\342\357JQ\213\222\336t\177Uw\227\323\233\337\312+\251/@\332\326\343:\025;!"
+	.ascii	"\267J?S}\252\242S\273\027F\030\214\330\341\325\342\240\360\267"
+	.ascii	"\275\243*\317\252\272\262\342\324\024\304\027\243\336\340\375"
+	.ascii	"p\347\031ow!\303\372h,0\2565}\263\277\260\274\026<\314\340W\316"
+	.ascii	"|\241\360\n\364\325\024\237\002\370\037x\205\237\"-\"\373t\005"
+	.text
+	.section	.gnu.lto_.symtab.d0cf5cd2f1384b43,"e",@progbits
+	.string	"lockMainPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"sendMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"nanos64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"updateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"millis64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"millis64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"microsleep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"timeval_sub"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"pwmSimCompleteMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"timerHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"dyad_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"pthread_mutex_trylock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\003"
+	.string	""
+	.string	"udpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\003"
+	.string	""
+	.string	"pthread_join"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\003"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\004"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\004"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\004"
+	.string	""
+	.string	"pwmSimGetMotorOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\004"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d0cf5cd2f1384b43,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
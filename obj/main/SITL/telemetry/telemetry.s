@@ -0,0 +1,619 @@
+	.file	"telemetry.c"
+	.section	.gnu.lto_.profile.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 i\r\003"
+	.string	"T\005]"
+	.string	"\f"
+	.string	"\236\352\207\307\t"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\376\262\204\322\007\002\002"
+	.string	"\002"
+	.string	"\004\241\234\233\266\016\002\002\001\002\002\005\006\354\301\314\336\005"
+	.string	"\007\346\273\301\227\n\003\b\240\342\234\212\n\t\352\263\360\321\b\n\371\262\376\364\003\013\374\374\321\314\003\f\240\342\234\212\n"
+	.string	"\003"
+	.string	"<\3037P\343m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 D\365\001"
+	.string	"$\0038"
+	.string	"\007"
+	.string	""
+	.string	"\003"
+	.string	"\002\001"
+	.string	"\001\002\001\003"
+	.string	"\002"
+	.string	""
+	.string	"\004\002\001\002\004\002\001"
+	.string	"\004\001\020\004\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	"\001\006\001\001\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"\017\025\343f\230\033h\003"
+	.text
+	.section	.gnu.lto_.inline.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"m\006"
+	.string	"r\213!%\220'I\007\177\251>\026/\365\256\216\237\246/d\203\203\352\370q\315H\334\355\373\037\344KT|\220\266\333&R\246'\212\372L\234C\354@\001\027Z\352R.\001\004[9!W\271Ki?*\371\347BH`\250\003,\005:p\006\033\333\232\370\231\215Y\013>&\243H\256B\364ki#\201a\201F\247S\377\321\322\300\2166w2]<4\032"
+	.string	"n\352\335\335\341\237\234o\352\035\334\235\342\373d\016\343\356\354\221\271\020\033"
+	.string	"\211\013\261+\230\016\027s\224\024\025K\356\311\244\b\354\031\221Y\301X\315\260\262\f\243\237`\004\262\271\203\2336\3002`\306"
+	.ascii	"c\226\252&\226\256\177C\bdP\021\004\226=\025F\267\334\346\"o"
+	.ascii	"bV\200!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 Y\355\001"
+	.string	"B\304\f\025\260%\351\207%\311\243\035\215B\030\006\227\267\3206!\233\310\224\002\n3\342\253\246Ot\0043\233\345G\007\336\0343\342\247\353t\312t\266\f \233Z\016\001\002"
+	.ascii	"\365i\336\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\001\200\004\002\230\004\004\205\004\005\200\004\006"
+	.ascii	"\200\004\007\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 _\035\002"
+	.string	"\324\002S"
+	.string	"\005"
+	.string	"\002\001\374\007"
+	.string	""
+	.string	"\001"
+	.string	"\004\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\013"
+	.string	"\001\002\004"
+	.string	"\001  \006\001\002\007\001\f\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	" \b\2442\266\212\006P\201\361\214"
+	.ascii	"B\004\245m\240\r"
+	.text
+	.section	.gnu.lto_.lto.486880a72fc492f7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetryConfig_Registry.36.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 \246\265\004"
+	.string	"T\bk"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\303\276\232\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\324\007us\250\347\006uq"
+	.string	"\005\001\006'\001,\005\001\006\035\001'\001\237\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/telemetry.c"
+	.string	"\005"
+	.string	"B\313\306O\331\005\223x\212\272o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetTemplate_telemetryConfig.38.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 x]\003"
+	.string	"\"F\027$\200K\322\0013\260\026\217\2379H\214\304[\034\306m\267\331m\232\315 \023\021\205V"
+	.string	"\003\324}\357\326H\222\001\205\322Q\307\020\316\024\326\030\316\303\231x\2438\027s\030w\032{\034\347\343\006\271E$\177\330\3052\350"
+	.string	"\374\236P\360\273\025*\374*)\255\257/\374\002\214-\300\257\330\026\021\004"
+	.ascii	"5S\200\346\274\254\201\0018"
+	.text
+	.section	.gnu.lto_telemetryInit.39.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 \3075\005"
+	.string	"\"\211\",pU\323\001"
+	.string	"\355W\340\257_7\227/\346\n,U\205c\304A\202\354s\262|?\tl\257\252\216T\003\366\360\201\n\035\337\332\275S\n\236$\310\274d%\031\362\322\006\265\250t\232\017\225\016\266\034r\352eYS#/{\354\fY\324lO\203\261b?\260\261\263ab\277P\341\263;\t"
+	.string	"X\217\240\223\261\375\310\230\r\272w\331o0\022\316\267\273\032-\307\0161\377\232\0236.r8P\354\256\341\306Q\356x\333\b\333j\233\n\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.40.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375`\201\001E\020"
+	.string	"\266\036nG"
+	.string	"\261&\035\363\220\002G\343\314\251\3643l|\033\030L\032\273\251\255\220\345\362\337\330\316\033&\311\246\311\324\230\266\226\351\017\266\034\264\212;z\004\315\245\277\364;\t\232\337-\350\201<\351~\231r\247\310\232%{o\271S\nZ"
+	.string	"U"
+	.string	"]"
+	.ascii	"\266Mz\2602\353\241\f\3540?/\034\237ZCnG\234u:\345F\226\377\330"
+	.ascii	"%\215L\215\017l\235\212@\226O\020\313\245T`C\007\307\bT\221\036"
+	.ascii	"\260\231o\003S\342J\007*>.#P\203\004\360\363\222\361\330\343"
+	.ascii	"\n\350\212Q\213Pku\374\300\r\267v\333\025lK\260\017#\276\254"
+	.ascii	"\265Vo\214"
+	.string	"\275\321\233\350\241\315O\347\303{7\372\001\n\320|p\201\311\261<a\205\315tT\331\3341\361\360\267W~\314\233\037\262>Za\205\221^d5\013>\r\001\024\243\375\232\253X\335\346\304\241ZC\364\344\324\0322p\003\320\347\307=\350\247<\001\372\031\257\226\273\370\213\316'\341\021\323\364M\3643n\210\005N\212\026\2248\303A\321\241\304\024E\373\224\212\377vw[\t8\300\334\220g\321\257w\323\243E\0017\241\366\005\f\361\337w\324b&K\331\226yrl@\254\001X\216\233\031)\361\307\377\t\245\253-\351\205\347\265\343\2123;l\305\025\341\"\035\t\205\022\252\323FP&\257da\202\312K\225l\016\001\311\340\251\272SG\322\2518\224\251t\342B<\023\016\004\201S%\235\307\251R)\217\333\302zY7\306\217=tBgf\212\326R\356\212\254\210\021\265\235\273b{\356\350\363 CY\027\335V\264\217}"
+	.string	"\215\327\216\377"
+	.string	"\215\273\255c\036"
+	.ascii	"i\355\213\231\351S\257}\253\355\235B\373\252+\241L|/\302\252"
+	.ascii	"\302h@O\241\241\025\253\rV-\247\325j@\212j\300\311\004H\346u"
+	.ascii	"\\\206\241b\030\254 (a\310\303Y-\230&21\301\212q\252\031\232"
+	.ascii	"B\277\272\317\250\203\212\002"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.41.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375`w\001m\017"
+	.string	"\306\335hE"
+	.string	"\261&\035x|\362t\210\373\2223={@\226\254\027IH\023\f\255\212\247J'"
+	.string	"\032$\325S<\355\330Z\007\214\233\026+\262\352\250\346X\004A\360\326\2774\2706df`\tc\007\020\300\263\223\266\311\2262\245U"
+	.string	"Q"
+	.string	"U"
+	.ascii	"\307\262\017\210\307l{\001\003\223O\377D\264\274\345\262B\303"
+	.ascii	"\263\373i\032\342\247G\fj\236|\324\243\346x\001C\203\205\007"
+	.ascii	"\342\030D\360\022c\3651\003\306\006\310\343\220\020\344\251R"
+	.ascii	"\003x\035 \310\356\376\365d\361R\231\237\221\335uz\360>\334\237"
+	.ascii	"\333\026\331\216`\277D\273V\226"
+	.string	"\375\231\377s\327\037\235\2060\2550\2350\375l\302\r\036\034\007nv[v\350X\031X\013\022\266M6\310\266~Ga\372L\tz\254\n\306\004\316n\212\020;\310\216\201\300L\373'.c\272+\345\002vY=8\273_\210\025d\307\374\375#\006\332r\202\231\032\030\230\262\374y)~\224\300\316+G\225=y\250\255\025.\270R-\220\363\334]\224\232\213\251\024^;\252\354\261\277s\361\232\n]\254\270\244\214\341*F\331\256\252\201O\323e\310b\216\371)\361\330u\304\252\306\213\214K%w\330\037*\265e\037\356\006\335V!\244\201\353$l\350LHB\3356\362\270\020\262 \342\036\220:\016\005\200KDJ\035i;\331L6\222&\n\221\234h%\335H\0231`\016e\3534\022\307u\032\350\333\303U\226\023\336\346\251\267y\324q\325\334\244\177\212\177\035\202NL\315\r\366\237\"T\026\333P=\242\242\251\030\035"
+	.ascii	"i\355\333\302tL\315B\235Y\002\214\013\312\024\354>\214\235\251"
+	.ascii	"\346f\006\006\246\201K\251\232\301B0VT1;D]\020\263;\227\254\365"
+	.ascii	"\335\205\320l\214\303\224\r\320\244i\212\r\026\3452\341*\260"
+	.ascii	"d\315{\333U\364"
+	.text
+	.section	.gnu.lto_telemetryCheckState.43.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 \307\025\005"
+	.string	"\"\211!)\200k:\300\234lj\324\\\363F\203:`d\257\026"
+	.string	"\377\267\245\335\260x\377\360\253##\212(c{\004\t\025\337\332\275S\n\236\244\307\274d%\025\362\322\005\225\250t\232\016\225\n\266\030r\352eYS\243n\0379\002$F\354.\203\261b\037\260\221\263ac\277\317\241\263;\t\201\226\023\330`l?2f{\336]\366\236F\342}\273\253\321r\354\020\363\237\371@\333\262C\001bw\r\265\215r\307\3336\330V\333T\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryProcess.44.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 \374\235\006"
+	.string	"\242\f.2pm\032\003\240}C\255\210\332\207\356\335\226\267\251\324+Z\022zf\250I\201 \262D\354\326\224\034\212\376\335[\020\246\211|\262\334l;H\223[\312\224\002\220\322(\310\r\214\361a\222:e8QB\n2@\3716\232\005\352M\321\341e\006Z5\300\370dU\305']w\003\025\023\321$\332\253\303\232E\353\350\377\333@-\343h\204N\016H~\212\024\224\227\270\221\f\251\255Y\353\rsLw@\364\362W\204\210\374WA\r"
+	.string	"\3540\026\250\330E\016\250\330u\266&\2760n\020k\342#\364\377\265\013O\263Y\333\303\027\313\3231\263$\374/\263<\037\267\271-A[\204\266\237\t"
+	.ascii	"i\331'\323b\242f\340\302\t\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_telemetryIsSensorEnabled.45.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"M\t"
+	.string	"\366\222B:0\345(\035\340A\376A^\216\341\302\016\\\322\021\312DZ\262\254\270\003\036\315\"7\302ml\005\007\324 \006\343\3164))(P22|\330\001\231\016\323\344\302\377\273\233\224)\0051"
+	.string	"1"
+	.string	"0"
+	.string	"\230\023\304C\333^` \271t\357#\365UJ\2072`\327\303t\365\322\263\344\237\344\320\305\372P\252\213g\306aw\235(U\306\255\267\215`\333c\373\025\255\037jZ5\235\232~f@\344\245A\300n\352{\255\013d\t\261M\2627\2663\355\263>Bz\313\302\002\273\034*+\273^\202\0254\207\234\027\304\303\247\374|M=\200n\303\332O&4\273\030\036\277\344&\234\017rh\212Q\036u\350\217\342\341\325 @\313\224\237\355\235R=\354cvw\255\035\216\017\233\306\2052.\372\323\251\330D\031(\213\310DX\b\342\001\204}6\016\353\034X\223\3106L\244i\033\266\361LwT\216IO\366AQ5\352;\027\324T\325\330\322i\004\n"
+	.ascii	"i\331'\323\"\f\273\207\263b\2328TMwA\345\252\366\017\035\314"
+	.ascii	"\230\332I\006"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.part.0.49.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\245\013"
+	.string	"\246TLB0\211*\035(\304\243\030\301\361+\240d\364\242\315Ix\fU\\o\331\321\036\n3\203z\202\263!\224\261\253x\004\005Xe\324\242b,\326B\330k\001\245\017\243\020\256\021..IN\n\240\266\211\334)\0057"
+	.string	";"
+	.string	"8"
+	.string	"\232R\211mg4&\213/[\251\027\230 2\223Pk\331\235\256\201\213\337\271\211\376\246\025a$O\337\317>G\022\300\247\345\033\245\242\326\352J\200\233\336\366\306\266\205\375\214\257X\3510\322\274\250(\001\264\235\366\313/0\035F\332\312J\376\201\2126q\352M\345\364r\207\311\351\366\206\211\311\177\231;\365\023\210\227SYS\031U\315%qj\212\312\351\0218\023\250\005\361\356\262lS&\303G\023\333\343c~\374>0 k!{\232\313\362n[\335\225=/\273O-\021\020jMU\240P\tP\007\007.\373c\267\257\240\344\313>3\027\034!\017\310\351\300\b\301O\304mx\037\rN\310\243\270\203!\201\241\007\362>^\330\205<\034P\327\001G\035\006\302\237\310\003\273\360\373\300\216\373Vw\345\273\032\220\314\357\334\021\333s\027\306\001\265\032"
+	.ascii	"i\331\267c\3435j\007]\215\f\310\003#\\\207K\226\021Q6\226`\024"
+	.ascii	"L$f\001\034\tv\210\313s\021\013'\223U\207\226%\257rj\325F\234"
+	.ascii	"\013\326DA\235\366`6\036S\316\273\312\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\305\005"
+	.string	"t\bM\001"
+	.string	""
+	.string	""
+	.string	"\0021\177\r\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 '\177\016\272\200\202\002(\177\017\0050\020)\177\021+\177\022\002,\177\023-\177\024!\025\201\204\005*\026&\027\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005$\030gistry"
+	.string	""
+	.string	"\005\"\031\001/\177\032\377\037"
+	.string	""
+	.string	"\200\200\200\001.\177\033\003"
+	.string	"$\003\002\016\240\276\320\347"
+	.string	"\001d\003\002"
+	.string	"\363\243\231\"\001\242\001"
+	.string	"\023"
+	.string	"/+\303>E\306\317\324o\004\303\345w\325\230\344\334\230\225\256g\254\f\177\324 "
+	.ascii	"\301\034\004\320\003\374\320\252\035\200\306N\226\200\033t0\235"
+	.text
+	.section	.gnu.lto_.refs.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\006"
+	.string	"\001\007"
+	.string	"\b\001"
+	.string	"\003\013\002\b\002\f\002\n"
+	.text
+	.section	.gnu.lto_.decls.486880a72fc492f7,"e",@progbits
+	.string	"(\265/\375`\366\035\325\213"
+	.ascii	"\372\343x2Q0\320\312I\007\021\363QH\341*\351\221\203\361B}-_"
+	.ascii	"W\246\311\206g\312\241\263\372\361\3215\265h\177\327\306\266"
+	.ascii	"M\034?a\221qi\033\354\377\020\333\032\f\034\327\002r,MW\212\210"
+	.ascii	"RE6\313\265\245\361A\0043QVCI\343\305F\262\245L\001\246\002'"
+	.ascii	"\003%\003\367^\007\224\232\t\025+s\b8\033\202s\211\375\031f{"
+	.ascii	"\206^\362Z\210\256\301q\306\250\264\372\374\331\303\306p/\207"
+	.ascii	"\360\361\336\036\207\360\375\\\332\3279\366U\215]\342$_#O88$"
+	.ascii	"\271\261\245/\032\347\001\312C\225\245\253\214\361\2349T\223"
+	.ascii	":\306\304\365\371\032\304\276f\331\267\035\3736c\337rV\211\347"
+	.ascii	"\374\234\307p\230\255\205{\003\210\300\314\325\216>Y\016\323"
+	.ascii	"Y\017\311\227\325\305\274EvoO\013\221>\211\322\354\353p\222\257"
+	.ascii	"\210\221|F\214\344\3435\314\206\327Fp\2333\032N\363\236$\363"
+	.ascii	"2\333H\036+T\372|\237\331\363\b_\335\333\343\021\2767\017k\304"
+	.ascii	"I\276\356\032V\004#\345\300f~\302\260aa\366\211\307T\"\252A\206"
+	.ascii	"M\025:\366L\206\307\260\030.\303u\274\306w\374\345\f\206\351"
+	.ascii	"~2\357U\276a\341,qTo\362\356\275\347)a\3560\323|\330\304x\240"
+	.ascii	"\340g\342;\326\302^jZ\226e\243\342&\257\315\n\263\021!\215.\025"
+	.ascii	"\236\235\262{\231g\264\237\351\237\300\002\276c7f\253\314\262"
+	.ascii	"K\2057\307\001\025\031\034\\\352\334\313Tr \350\315\220//D\347"
+	.ascii	"\031\212\275\035'\371\204x\210\345-\314\205\327\226\270\313\217"
+	.ascii	"\222y\233?g\344|\265\365y\376a\317K\276\242%\337Y\213\347\270"
+	.ascii	"\311F\004\006\313p\034\307k\374\366S\r\3546\357\275CAA\344\332"
+	.ascii	"\222}\312\360\341s\361\275hOF\362\211`\301~\004\3736N\362\261"
+	.ascii	"\032S\341\265\002\270\312'\260\340\025\251v\321\356e\026\r\365"
+	.ascii	"\360\244\207;}\036\205\375\337\274\001j\327\202\207\260\347\002"
+	.ascii	"|\274\307\005\370\336\366r_8\311\3673\016KCv\316P\235\365\371"
+	.ascii	"\263\224\237\2430Z\001ui\005v\333\356e\036\0251u\\\331\320\347"
+	.ascii	"\231\234\344\263\214\344\023c\377v\341o \357\277yh\215\371\371"
+	.ascii	"\373\352\177\225\263\237/\270\3739L\031\n\376\023\375\035u\376"
+	.ascii	"\373\205\237\005\370Y\351\347\242\237\221~\036\340g\243\237C"
+	.ascii	"\374\f\342\347\243\237\223~\016\340g\242\237?\374<\366\177\357"
+	.ascii	"\377\235\377z\377\217\376\332\342\347\270\237\265\374\234\345"
+	.ascii	"g\271\237\257\374\f\367\363\334\317\\\354~~\362\363\333\317n"
+	.ascii	"d\376\033\375\025\311\317u?\213\371\371\313\317]~&\362s\216\237"
+	.ascii	"Y\374\214\302\317$\374,\302\317*~\336\340g\023?g\360\363\211"
+	.ascii	"\237\037\370\217\367s\003?3\360\263\002\377\273\374\037\361\263"
+	.ascii	"\210\237\013\370\331\314\177)\377\321\376\023\360?\314\177\240"
+	.ascii	"\275\275\275\275\237\361\374\276\340\017\242*}\344gy\257\226"
+	.ascii	"\003o\344\262\272\036\350q\202\243M\351\006\007\327rv\344\372"
+	.ascii	"\013\017n\336\342\336r*\324\312\330\351\"v\214[\031\027%nn}\305"
+	.ascii	"^\027\300\342\320\235\365\250m)\323\354\267\367\025\274)g\320"
+	.ascii	"\260\027_\035\026\036\036\300\332\332:\212E\202i/<\366\230\364"
+	.ascii	"y\037+;eJW\021\341j\271Ag\360\350\315\255\275\253\234f\326\224"
+	.ascii	"c\372\354\264n~\t\023\242\245I\245\307\216NG\030\0363D\033\235"
+	.ascii	"V\237j\374e\2006K,}~N3\205j\364\220\247\252\310\315\017!tp\354"
+	.ascii	"\337R\326Z\n\263\261\332\305\002\252q\351d\251s\357\227\007\212"
+	.ascii	"\3504\3712\262f\241@\351(\366*1)\363Z\032\"\243a\247J\237Q\356"
+	.ascii	"\246\347\316,\211\317\211%k'd}\346\273\227\231`XY\267+k\351\377"
+	.ascii	"\234\367\331\217\222%bVH:\311\273l\255\313\272\211E\336\213d"
+	.ascii	"^\254\017S\300\342\320\325\271]]KDZC\234\320)y71\023\272\027"
+	.ascii	"\355\336K\300\320\023\032\356\224\364\331f\335K\232\311\333\254"
+	.ascii	"o\020R\266\331yo\222\031\001\"f\004z\270 IR\361\235\367a\331"
+	.ascii	"\317i }W\244\311\226g\337\343f\177\366\335d\326\275w\253\207"
+	.ascii	"y\263\250\204|\334\303\274\364\017q\345\004\376\237\267\376\003"
+	.ascii	"\244`^\244\0273zvI\\\322\307E\334\367\330\335\253\fCv\020\246"
+	.ascii	"\245\f\333\261l\206]\2442\t\362(\353\206!\227\315{\217\256R\211"
+	.ascii	"L\001v\217\226\315\253ui\334i\361e\206!\257\022\354\036]\345"
+	.ascii	"M\212X*\303\264\226\315\244\326\321\262\031\246u\233a\327\350"
+	.ascii	"*\223Y5\2247\353\3506\303\340\334&\230\226\321\262\t\246\265"
+	.ascii	"l\206\365`0\3135[\264\272\230\021;\302sK\345\305q\345\225\314"
+	.ascii	"2\262[2\301.\232{\271\255\352f%p\257\027X\026\232\344\016\226"
+	.ascii	"\243\262\303Au%\t\306\314{o\210+*1\260\253\264[\232\201\335k"
+	.ascii	"F\005u\257*@2\355.\021\266C\332\340u\255\252\356\025\340\352"
+	.ascii	"^$_\273{/\362\336\353\223\345\305\274\267\207\321\262\354\352"
+	.ascii	"\352\336.\245\253\353\205\234\253\272\267\333\324\310i-\233b"
+	.ascii	"`LsU\232ew\006&\222\313.\232\260,\333D\246]+9\266L\213+N\237"
+	.ascii	"F\224\032O\\\0162\\v\254\211\360\330\21537\033cAZ\310\375\001"
+	.ascii	"\353A%\331\347{\222A\302Z\214\331#f\013\271\303\234\260\006\363"
+	.ascii	"\231!2\247F\207\032\230\315\017]Np\364Ws\001\331\240\0037\227"
+	.ascii	"\246\016\0224\035\236P\300<\030\311;\303j\330Me\312\331\031\250"
+	.ascii	"\234\34515\215\032\362\350\356p\017nbE\232\352gj\345X\331\215"
+	.ascii	"\266A\2244\272J\252\2572:;$\311\273\227\351\243ytV\347h\257\326"
+	.ascii	"\352\036\275\243\267ZGw5V\323\300k\315\325V\357\253\306\201\326"
+	.ascii	"\\\274\327I8<\"y\0264\027\3339\362\246\2718\016\317!B\032\335"
+	.ascii	"+FV\226\246\271\272\252m\260\335\330M\"+Xbw\246G\235P\330DY3"
+	.ascii	"\245\2465!\223\207V\237\240\251\201\253T\352\033\333u\031]%\\"
+	.ascii	"\235<\270\212\003\263\261]\227\006P\320\310\325-UK\235\253Xj"
+	.ascii	"\\\315\302k\025\256\252\2756\251N\224o\025\256Ja7l7\326\001Z"
+	.ascii	"\232\"\275(l;\214\316\263\267!\200j)\002\016n\334\352\025^\253"
+	.ascii	"oWb\336\267\332\254V"
+	.string	"\330\256\213y\267\202\260\300\231\222#\204\003Cq\314\240\361\341\263\322Ft\2059DN\237\225\315\247kG\030\032]\326x\255V\261s\316\346\356\004i\261\017\302b\037\304\264\225is\310\373\252\203b\037\324\304>\210\314>\250\210}P\230}\320\227\375+\224\372\244I\247W\367\204\331\032o\214\025U\237\017\342a{\211\221|\365\206jV\004EN\310\333\022\023\212\220y\353\363T\322a\310\312\256\210\320$\261\222\326\347+Y\317\333\236\036\217>k\022[\025tc\004\320\027\\\r>\372|M\362\327\035\025\t\f{y\320\200az=\022T\327%oJ\034{~\302U\307\353X\325Q\211\234iL$\021Y\236\327\003AHpL\301\372!\203\004\f\253\317jC\025R\207\374??Z\254\360\274\324\330\327 @cwH\230\364\3315\354U\354\377\361A\313RZ\311\301\276\202U \377O\315#FK\2151\366\265\006\031\326"
+	.string	"y\322g\375a\253\200\340F\374\250Qkc\244\317\327\037?\313\251<\352W[\371\350z\323g\365Q\275^\277j\217[\277*"
+	.ascii	"\2737Y\277\212\360\334\233,bF\200\031\201\023"
+	.ascii	"\212\030\231\233\357<\220\025\373<N\362\325\035L\257]M\326\026"
+	.ascii	"&L\237C@D\354\353\026\327\034k5G\335\252\313\233\004\242\001"
+	.ascii	"\230\254/\017\364\314\220\303\016\222\006{\256[\276\277n\275"
+	.ascii	"j9)2\304K\2375\253\347\254lMG\237\007Z\332S \246\357\260\250"
+	.ascii	"\024\311{;\363\243\f/\207\032\312\314\214\345\255\361\221\267"
+	.ascii	"\205K\203\301\201\207\344M\307q\303\273r\203\265C\337\341\242"
+	.ascii	"\262\321ta\336\246\n\317\310\0336\354\205Hit\225b=\032\357\253"
+	.ascii	"\336F\323jNTe\375\334\300\363\352-\3652\026\262\2746<\222\325"
+	.ascii	"F\255\252X\325\252^U\034UY\251\352\215J\243\"\353\262\326\350"
+	.ascii	"\275:\003\257\325\333x\336y\272\207+\325\333r\232\016\333\265"
+	.ascii	"\335\344\226\b%idM\210\324\216\\1\0238}\327\356\247\356\016\017"
+	.ascii	"mil\324\2347\350\020Gf\247\353\370p\300\033\243\303b\377SE\257"
+	.ascii	"\347\024\355p\245w&\212^\223\206#d\266\205\225d,\357\007\314"
+	.ascii	"\376g\207\375\217\r{\233\307\336\352\251ISF\246\326\246O\273"
+	.ascii	"\"\241\036\242\340\001Yco\353\354\355\234\275m\332['V\002F\362"
+	.ascii	"u\231\223\206\026-c?\354N\306w'\345V\251{\223)B\002W\306\206"
+	.ascii	">{\f\273\331\203\023\303\345m\202\274\024\021\253\353\363\226"
+	.ascii	"\313\336*\355\231\214\344\353/vG\220d\0337\326K\227<I\352\352"
+	.ascii	"\364\371.w[in\031{\271w\226\363Zg\t)\021=\242F\024\204Ab\021"
+	.ascii	"\0050\2060m\362\340(\024q(\022\307_S\b\020TX\341\002\205\007"
+	.ascii	"?\020R\234P\302\017\005\213_\213\025G3\244\212(>\244R%"
+	.string	"\236\244\220\232\210S*R\364\030Dt\352\236\343O(\375\021\237\244z\210OR\025*}\"\242C\037\n\203\360x\036\217\2501\030\004\372\314\220*6\235\306T\252~h\2061=\n\237P\026\277 J|\022\016\201>A\3648u\242G\237\003S`\320\370{\222\"Ad\004B5\235C\251(\324E\212\036Q\026OR\007\244?\241\243\021\215!4\006\t8\376\204T0r\021\303\207\376\320`\261\004 4X\214:\321\337\tG\251\242\017\232\002YX\024\006a\013\233Z\243P\020\210\2120\024\002]\030Q'\247\251\017d\244B1\204h\023\312B\t\b\230\002S\3100\022\031S\024V$\301h\002\276\030\016\201(\320aP(\024\205\246\307\031-@\034W(\035\217hS\321\210\202\021R\020\225\301\002F\023\n\205B\200C\221h\372\241Q\302\2248e,\321\344t\300\361\t8T\361\004\\1\364\246a\261\370\301\257\307"
+	.string	"\tH\244F\240\024\t4\005\246D\020P\2420\312\210\246h\212\005\336$4\242D\364\311\276\002\023\021\2308!\303\347'0\220"
+	.string	"\003\t|?\201\001\023\023\006&\230\354M0\325\364g\321_p\205\214\342\013\037Tj\206\213\025X\264\020B\215@\250\026C\207B\340(\005\032\371\240\301\251T\370D,\222 C\250\242hB\020M\215h\f\242\020"
+	.string	"\031\350Pj*\205\323\020\b\005\204\376T\2408J\205\220\224\002\243\214E\247\037\232\002\211\302\240\261Xl\372\005\200\376R!1\205\240TH\234\002\"\026\205Ga\023j\224\372\035\201N1\214N\037\206\300\030F4%\256\b\022\247\212-\242\214\300\241\007iZ\204\002\341\342\350\301\021\235\032\002U\b\n\245>\240O\300tX\214\361\033\016\321\246_jD:\376f\3008\316\030:\021\245?\023L\306\342Q\030C\030\374=\021\205A \n\365;\002\177P\300\250\037\f\242p\030\003\030e\300\321X<\022\321\026At\370\002x\024\006\213\322C\221(Q\024\006\360\242\024j,\221\026\213\306\022A\001\034\177OB'b\021\005"
+	.ascii	"\351o\002\n,\214#\260\004bQ"
+	.string	"\2306\021\247\234\204\320\337\212\324XDa\b\024\032\321#\b#*t\022\246D4(\004\222:F\035\035\245\236\216\322\337\211\224(\234\3629\023\023\n\021)\230\020\202m\"1\303\230\242Q\350\020MK\020\205\300\250\022M\306c\t\022\"d\240A\342\n4\005\032\203S\300\027?\031\305\0270\232\200\303\027 \360\372\354\2038VA\356\304\300\201B\347H\231>R\331\334\335\341\262\253D\322\030\271R\353\263\256.\005%xfg\325\210\2168\274\246=\335+]\025\303jixfu\356\355Z\"\302\023b\343F\r\363*\246\315\250\230\034\3012d\350\254M\016<\272\276\324/}D\204<r'\025\027\275,}^\210\312\310+\023^\253Fj\227\272\354\272\\$\342\344\354\030.vC\372\344\342\223\324\341\f\030:\366\214vV\003\202P\250R\0015I\322\224BffHd$i\232\003\002\n\020\006\304y\032\311e\017\022"
+	.ascii	"\0255\312\302\216\031\231\021Q\220$\345\024\n\303\001\034\024"
+	.ascii	"\373\203\242\001\"\226[\216\351\342"
+	.string	"\270R\232<{DtH\364>\247y\276\246\266\335\321\370\r\206\t\320\300\353\"\261\013rF25\217\034\343\031\255\267S\246aNTfT\\\323*\260@\247\305\225\310\207\366(\035\334\362J\274>H\304c\020|\037\261\037\224\027\310_H\271\376\364\t[\375\032\001\nBK2\025\030\261,q\230\021\r\005\277\322\034\204\021\224&\341\312\016\021\006\347B\267D\271B\307\304\004\231\320\2415\0270\371\003\262\300\004Ve\256<\025\355L\t\242Z\022\273\206\270\021\357.BL\320\266\021\034Ff_$\016\032\252\331q\004\017@\305xj\037\213<60N\306\307\362qn\311\352\376x\0071\006\330Ac7\222Pp\351\235\202\320\237\n:\202\250\324\377\210\302\207\334\"\363`x\024\004\r\317\313\342\304D\252\036\"=\246^\261;h\006\307{\231\224\376F_\261f\305\377[\314\375\330i\237&\276\363\253\223\215p\271\375\300\232"
+	.string	"x\360X\302.\375<A\314\243\320\361\246\364\313p\374\271\021\326,t\2477\nL\312J\212\225\201\024\254\302s\025\247j&\263\361\330f\r\347\325\205\027\266\250}:\364c0J\3565\n\372\327L$\235\321-\307M\305\311A\007\300M\212\341^\2142\267\377\031\320\257\342\307\334g\244\201\017\n[\343"
+	.ascii	"\200\355\022\272\026\362\203\321v\270b{'\006\261\214\365\273"
+	.ascii	"\324\"2:A2\222`\257\366\273\202\375\300\021\251B\355X\315\310"
+	.ascii	"\243\365AI0c\320Ep.giC@\373\232<b&0\206;\3335\\\034,\252'\363"
+	.ascii	"!B\025<\211\327#a\244\324\036B\254\244\020\225\240g\343*q\340"
+	.ascii	"py\332G&\342=\177\037\332\276\tCr\235\037q\241K\342\346L\220"
+	.ascii	"#\021\211;8\036\277\262\202$t\034\022d4\350?\274\244\376E\264"
+	.ascii	"\341_\034paX8,D\0372v\024B\356\323V`\333\223\333\n\333\375\352"
+	.ascii	"\335\3763\310\322\266\361\313H\345\231\241\205R\375\30090\037"
+	.ascii	"\021\302\024^$s\225\302\0202\244\004\231\323\304W\027\030\232"
+	.ascii	"\216\202\337D\216\314\235\346\362u\326=U%\274\200rq\216P\037"
+	.ascii	"/\375\357\234\3707%\344\360}\\\323c\036\361\347\001\3234?\322"
+	.ascii	"\321\315\026V\"\200\004e\265\223\025\200\367\240\321\311\003"
+	.ascii	">\263X\250HsQbF\307\260\271\025\234\\\345\215\333\225R\346\241"
+	.ascii	"W\272\270hFm,\350\361\202h\277\246\227+\003\237\300\305\032\340"
+	.ascii	"S\013\271\b\025\n\217\020W)\320\024\213\261@\245\030(\302\037"
+	.ascii	"1\3274\341f?\261\332T\272\033d\027\023\200\300\206\355\301\340"
+	.ascii	"q\333\345\365'"
+	.string	"\353\3113\337F\251W1\242#8\357\3463\022`\031\270\020\370\273\fw\001\366,o\266h\1778\343\326\205\243-E"
+	.string	"\343\314\372&\3031\276\214\212\362\311\347$\351\346J\n\326\320\217,\247\370}\204\005\370\241\202\351\321\203\241\223i\252-\372%\326X`!\310=v\023?\314\3518\252`|Y\351$\361\363\263dA\357\314x\360\275\344\341\232-W\277\365\031\r\306k$\264K$H\003\003`\233\323Q-\033\373\037\"&\364\224H\262n\bF?\207\332\245\335i\307\022\334\345do[C\031\364"
+	.string	"}S\035\242\220\270\n\027\314\373m\224~\3747}w:\366\313\211\241\224\241\365\251U\366\352\231\274\243\224\021\356\222\226\034;\247iV1L\274f\211\347\205cG\360\204\212h\345\033'gWq\262\212\n%;s\317\220\337\234\312\332\253\301\207\306%QD7OO\217\201!\037\224\025\213\300\202\fA\202,\027Ht\250\323~{\342\377p\214O\313A\332\252\227d\275\002\331\247\031\354\243\242\320\005\253|,C\324u\206\206}\016\340\304\031\326>\257e*\204+\317nv\246\213\001\365\005\2741\347%\242` \037\255:\2136\216[cB\371(\367\340#f\373\021\245\"4\276\320\031\tB\0022\236\022"
+	.ascii	"\270j\255\231\004a\260\361*\325=\325/=\037g\357\006\037\320^"
+	.ascii	"\230\3542\365\360\004\324\350c\256K\261E5\377X\230\262&\341\020"
+	.ascii	"SY\242\324\034T\272\2054\274\370)\025\371\345\024\273\312_\342"
+	.ascii	"t\276vQq(\374X/\022F\234'\370\003f\260{\365Y@Y-\336c\313\221"
+	.ascii	"\347\017\304\035\374\253v\3546d8\2058j\267\2407d\315\301\352"
+	.ascii	"\347\002\302\203\240\303\306\312\373!\223\217\267\262|}\035\266"
+	.ascii	"\306\273@\331a\267:\212l8"
+	.text
+	.section	.gnu.lto_.symtab.486880a72fc492f7,"e",@progbits
+	.string	"telemetryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"telemetryIsSensorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"pgResetTemplate_telemetryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"telemetryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"telemetryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.486880a72fc492f7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,643 @@
+	.file	"telemetry_scheduler.c"
+	.section	.gnu.lto_.profile.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"%\006"
+	.string	"\224\006\247\001"
+	.string	"\t"
+	.string	"\227\307\366\361\007>\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\002\001\002\004\002\005\002\006\002\007\002\b\002\001\b\002\005\007\002\007\001\317\207\340\314\001\004\002\t\373\244\371\355\004\003\275\236\254\266\007\006\003\002\001\004\345\270\324\340\006\034"
+	.string	"\n\005\321\227\235\346\007\034\006\216\266\246\002*\007\370\201\257.\006\b\220\267\362\247\f\002\002\t\002\t"
+	.string	"( @\002E\322\331\001\033\362\252\002\002<hc\b,8 p\033\300\b\022o\221A\025\201\347"
+	.string	"\362\020\030@`<"
+	.ascii	"\366\263U\373\256Y\265v\265BH\00308S\320t\363d\013s\013C\013"
+	.ascii	"\254\260\211\2039\301\005\303\177\341]\030\027,\036\374\017\354"
+	.ascii	"2\367\002`\271\257pC"
+	.text
+	.section	.gnu.lto_.ipa_sra.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375 \224\305\002"
+	.string	"\304\003\210"
+	.string	"\t"
+	.string	"\001\001\001\003"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002\002"
+	.string	"\001"
+	.string	"\001\003\002"
+	.string	"\003\004\001"
+	.string	"\001\005\002"
+	.string	""
+	.string	"\003\006\005\003\007\001\b\001\003\003\001\200\004"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"\002"
+	.string	"\013"
+	.string	"d\340\270\250\002s<"
+	.ascii	"\242\301\320.e\200\254A\032`\374\305\216\r`\001"
+	.text
+	.section	.gnu.lto_.inline.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`-\003\365\021"
+	.string	"6\333]D\360\220(\351\340\373g\324\276n\3763x\216\277\177\027\331}Q\346F\r\207\b\021c\217\200h_\362\250\354\360\324dB\355\366\361\305\277\310\342p [&}\027/&M\205\263\364\031\260\301\036C\t\332'D\356\024I"
+	.string	"G"
+	.string	"L"
+	.string	"\303\255\021H\270` EA\301z0<\r5\303\013o\252\024`b&\371{\353,\306\350\356\273\246\306\030cC\234\007\026\b,:/\322\224\031\0072iA;\024\335\235\346\207`nN\363\236\"U1\202u2\313\307\033\277"
+	.string	"\001\035Z^\f\370=S\177\360wjJ\f\313\2047\\sa\236 \3068\362\033N\252\264O\021\244\\K\r\0313\216\335\245\326\333\234\326\315\233\222\343d1F\316\035\365P\016\276\352\343~O3\363Ty\316\337ZR\341E&1\343%\221\356\307htE\233:\350\202.Hc\f^+\362\316(\367\266\316\240\234\264\360dP!\221p\240cE\226\213\242\273\243\271v\256J\243\004\211J\2015\227Z\371\247_\016\177\037\372\202\211\201"
+	.string	"\360\253\316R0\274\bh+\267!_j]j}4\247vs0N,h\320\031\212FU\006:\265\t\323\235[[1F\2167\006F\325d\005\346B{\264\307&7\3035\362R\021\341r\021\220r/&b\304x\274\252\0274\224\270\2206\016\311`\240\346;C\232\"\204\002\326\034\3262`\250!=\306\320\214\b)hiR\030\306\220\242\032\"\363\021P\255D\226Qj,st4\274vLj\225\316\223\232\"`G\316\200\276\371\247\253l\334|h\223\025\325(\026j7\036\n\344\341&\273k\374\n\200\2437-=\266\201\262\321qvD \023"
+	.ascii	"t\302\346X|\006\033\337\356\003\306\243\270\240\363\362\024\003"
+	.ascii	"\327@0\001B<L$\376\210\206}_$\202\220\372)^P>#l\364\356\032\374"
+	.ascii	"\2070\252\334}\007Z\253\017\332m84L\240B\0077\274\332\036\264"
+	.ascii	"2\2233\220'\302\303\376\024*\240\273k|3\"\020\f\232\363\0377"
+	.ascii	"\003\247]\302T\b6\320s\020\210\206\016\323\f1\206%\336\325QF"
+	.ascii	"\235\200\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375 \370\035\004"
+	.string	"\242\307\025\034\260%\351\254h\246\031E\030\206\005&I\216\263\200s\240%ZS\326\266\326\366\226I\006\2339\347\034\266\326o\031>\341'@b\0306a\017\0261\316DAl-\232\"h\264\320\362\f\005\267\007s+K\331\245\274\327*\016v\326<iX\204\025p\205\237\236\245_`\207\020"
+	.string	"2\273\204X\214\314\317A2\202\033-o\207\3038;?{\013\266\201+R\\\005\003\241\260\316\3005/2\231\004n"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\001\205\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\b\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`k\001\205\b"
+	.string	"\222\212!'\220'I\007\360\235\366\017\213\330\240\371'\337w\251\337\275hwh\351/\374\202\355$\007\331f\274\201\0055B\b!r\247\033\034(\024\240\273$0,+bY\270~d\235:h\216T\337\263\023\r\224^\321\327A\317\300KxG\200\212\236\247d\355\201n\214\332\b2\367\264Qs\036$p\301\001\242M\326\245d\205*O\032\373$/\245\275\250\275!=\016\005Ox\216z\2474l\333\0015/\332_\300\0068}\021\002; `\202!Sx\007\354\204 \005r;@]>Oz(\332Ll\200B\331@cb\033\034\0352\250\316oV[\304\317\354\f[Y\3710\250\357o+\374\216\n\r\207\r@\200@4\001\003\200\272DVZ0\371nlX}pX#\241\327\2347\200\r\243\025x\301\265\033\221\013Bw\211n<|\305Od\024\274YD\336\005\304\006\211u\263\037VW"
+	.ascii	"\346`&G\232\021\343\026\336\\\201aqLUZ\311\2111\\8"
+	.text
+	.section	.gnu.lto_.lto.46c0dd2dfb572942,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetrySchedulerInit.13.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`\n\001E\r"
+	.string	"\266\031\\D"
+	.string	"\2216\035\330\\\371s\370_\001\246\346\320\267\314\372\004\361\206\274\242\361\276\317|\202!\n?\300\fD\204b(\213\2403\244\266\361YJ\3030/\253Z?\314\001\230\034\031\234@X\033\377\314\374I\333\335\344N)F"
+	.string	"F"
+	.string	"G"
+	.string	"\t\250C\373)\256\202{\214\312\013\354\216r\310\330\375\026\270\201\365\350\357\036\371h\335\200|4g\353@\260\001\200\r\016$\036\273{)\211s\207\234\377\231sD/\335a\365`w\rE/\036n\275m\005\266%\330\367\002\266BW'\335R\241\343e~\3521?\344\0048q\240\264\353r\323cMq\006\314I\267_:\013\237\306\235G\333\244\217\325u\260^\234p\354\330\375@\217\006\261\036\337\261\r\277\257\340.\223B\021\330\026\021.\020\254\307\217\237\371A\334\370\260\342\342R+\235`\343\235\242:h\371\376\221ROs\bc\343\241\370?\222\322\250/=\206\360j\274\023\013\274\261\204\332\342\256!A\207j\237d\200\027\331C\303\344ig\177\035\324\021\366\251\335]\353(\"!p\304$\303&\2106#\204\346\206BA"
+	.string	"\307\330\2076INFf\005,\024\202\242m\263d\222\314\3552\261 RraZ\350\372"
+	.string	"9\2730\265k\3132\355\352|{ju\024kL+\312\342J\355\3541R\254\335e\340\303\320\200a@\t\023*2\025"
+	.ascii	"0\213J\313>\231\246\2232<\364 \333\025\023k\023R\213\344\334"
+	.ascii	"08\327N\027\334:\313U\265\204\351kb\020\r\204\317\324(\270,M"
+	.ascii	"\215\016wx\321N2"
+	.text
+	.section	.gnu.lto_telemetrySchedulerAdd.14.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`H\001%\016"
+	.string	"\366\332`E"
+	.string	"\221(\035s\2122,T\n\303\220\253\345\204\247\271K\335\204\001\375\036jJ\226\245`\230\205k\264\3726\215\230\340\370\326\210x\244\032\310e_U\325\374\016<3\242a`\003\371\216\261\370_\177j\323do)S\nM"
+	.string	"G"
+	.string	"Q"
+	.string	"\235G\177\017\321\036;'\240=\3326\003\007&{\"\037\264\006\216*E\316\356\267i\211{\207\232\236\277rx\300E\243Ff\345r\205\tX1\\@V(\030BC\302\306a\317\226U*\363\243dw\235,\253\020w\274m\t\266'\330\207\t3\373[I}\261\017ww\255-\373\337\357\371\353\377p\032\306\264\302t\302\364?\036T\262\0029vA\314x\354\214\370\342\204m\223\375\261\255_I$\300\246b\256\b\231\366c\3562\375\245r\001\273\255\233\026\273\337\002C\b6\273\373\300\336p\231\320#"
+	.string	"\023\rnD\250j\304Q\365H]\201\300\346,7N9\363S)\270P5*X\250t\201\203f\204\352\213?O\321\256\027b2R\251\303\266\350(RH\374\030\312\250\263\273\207y\364U\264\307\353a\037"
+	.string	"#\206\345z\2352\245\216t\302E\217A#\035g\302\001\003\227\0014\252P\352H\\\2103\341H\333\211\006\013\241\r\324\215\266\021\005\026\241p\335F\022\211\272\355\363\355\341j\313$;d3\372{\332a\207\257\034\331L\372\236\006\265\3056T\227\234\024\005=j\273\303Y\224\f\004\031"
+	.ascii	"0\213Jk\337\320L\273k\366\235fohl`\004\203\213A\216\250\332\024"
+	.ascii	"\265\b\213M\021\233\024\\4*\244\0232\302\331u\213%\355\232\035"
+	.ascii	"3!\202\022\301H\002T0S\225\313s\251="
+	.text
+	.section	.gnu.lto_telemetrySchedulerAllocate.15.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`\222\022\205\\"
+	.string	"\312\227\320!O P\332I\007\013\241e\247\316\3777L\367\244n\265h\240B)\324\246t\313\333\325\272\315\347\02589\322\267\363(t`\025\226Y\211G\354`\f\246\351\255F\2654b\031\f&\253"
+	.string	"\264\267_q)f2S\214\020)Yv\326\266\021\"w\222\001\021\002\325\001\022\002@\312\306\336\244\035\313\360\317\034\215\b\3224f\276\256H\017\247D\n\361\244\206S2\374\3015\351\027\301\035la\276\360\303<\360bF\220J\001\314\262\342\344y\004\223u\f3;f\031\213a\332\266\321\207\375\265g7\326\374\352\016k\340{\341d\027\255\267N3\244\232tn\232\001\027\276\337\021'|\374-\247\201\223}\\j\213\026m\213\334H\233j\231@\001\366\031\274\312\240\326\264\324\035\266m\364j\217\223_\265p\037\233\023\253\343e\340\353\345q\037\223,\352!-Z\347B\333\266=\216_\213\227\036\357X8i\3451\200\375\312\027\223l\247%\203\033\342\244m\243\016\034\2772U\030N\005\354U\2020\311\242m\030\0134\302\005\216_\273-\361\350_"
+	.ascii	"\373\224\f\230a\3216\314\004\332\264n\351+\313\b\243\374e~\335"
+	.ascii	"\355\300~\247\301y\332\026\t\242\226\266\21521\324\361+G\017"
+	.ascii	"T\374z\274O\361+\2031\033>*\327\032\341<xR9l\333\326\251M@\n"
+	.ascii	"\332A\022\261\362j\364\254\032\301\236\204tdT\304$\032\022\n"
+	.ascii	"\002\372\361\351\341\331\321a\227\312\244R\016\362h,\256j_0\276"
+	.ascii	"Q\n\313\357Y\242t\360\312Y\330\223\356\n\241\\$\273\037\325\335"
+	.ascii	"\250Ne\242\211r\213\322\316\334\263r\211\350>dw\241&\202Jn\020"
+	.ascii	"\223\003-\371\317\022\301\023\256\017\223\367<1s!\311\345\231"
+	.ascii	"\373[\273;r\327a\003\315\216\264\335e\2155\302:7oE\216\\\251"
+	.ascii	"\216\230\356\265y\240\031\233\nT\306D\310\305\030\271\311\213"
+	.ascii	"\311]I\215\332\"B\331ix\207@3)\352URx\303\367\336\341\211Y\223"
+	.ascii	"\233\363@35?\347E\032\245J(\222\366#\332\215O\314\320T\246\337"
+	.ascii	"/\221\263\347-vx+B\367U5rP\306\204=\343@}z3\345\203\236\215]"
+	.ascii	"\025\205\020\336\327\373\335\223al\360\312Y\b\277F\251\266m\371"
+	.ascii	"\n9"
+	.string	"+r\356p\346\253\0023#a\336i\n\367\r\257]\354?\021\305\032\270d6\326\0061\367\247#h\036\250$\016\325W}\2764<g\233\332R\257\237\213F\210\232\251b\267\332\306\274'\037\216\333N\035\333\226,\005?\021\203\034Z\305\257\335Msq\264H0\3538\034\b\276~\220\273\235<\313\243\343\023\373WQ\310\361\276\200\b\333\266}j2dL[\035\033\261\233\330&\236p\321\356\270V\003\227\264\377*\316\350\343\340\2042\306<\236\303\327\261m\333\024\3746\033\214\241:\236\240A\361\353;\202!N\332\354\356\304n\"s4\354v\034\363\213#\260\211\201\033\t\363\325\004V\354\345\252\2479\367\310\271Lu5g\t~\346\314c\207\216w9?\220c\352`\3168\016x\276\361\300\263\215\032'sf\200\306\214\337\375\013\334\314YF\214\2179\303\270\r\347\027R.\316\345\334\"\212\305\265\234W<\357\f\245\342\251"
+	.string	"\366r\n\3662\n\366\362\211\344e\002\222\227M\f\260\274\\\"\347\262\023{\271\211\275\314\304^&\221\274\274\304^\036\301^\026 yY\004{9\004{9"
+	.string	"\345e\020\354\345\017\353e\017'\234\341\314Tb/'\261\227\221\330\313G\354e#\366r\221\3622\021{yhyYhy9(y\031hy\371'y\331g\275\334\363\2763\317\257\234w\330\313:\354e6yy\311^V\262\227\223\311\3139\354e\244\362\362q\275l\\^.*/\257\353e5y\271\215\227o\316\345W\240\003\247\315\b\234\220\036\214\266e\211p\3320+_\223\253\371\323\374f\3763?\341O\346\037\363\203\371\001\377\300\337\206\277\313\317\345\237\341\357\373\265\374y\377\224\277\312\177\345?\314\347$\363o\340\257\341\244\232/C-o\206\374i\232\203g\002LCw$\223\033\363\343\241\377\344\215\207\276\340C"
+	.string	"\032\356t\260\207\347\303\303\323J\re\036\025\275\323\320#\242E\351\331\221j\346\316S\017\320P&O\2306/\254\021S\206G'G\002\322(\317,JK\177\241\343\342"
+	.string	"8(\317,J\327y\251\206\262N\001\315\252\222\212~j\350\213.\341\343g\b\270F\f\0327'\207;\252Rj\006\234\3363\013{\331\316K\251v\241|B\236\241\323c\247\232\325\345S\027\360\242s\364\377\276vY\003\223E\247\343\330\253(\365:\332#s\310F\354\251\247\372H\214\323\311\215\306\373B\"\274A\320\r\332A\350@\005+l\337h\021D\224H\377\222\032\007O#uR\027\3759\241\034\265Q#\365\235O\306\216\232\250\357\211X\324CmD\324E}5\032~D*z\250\217f$\213P\337\350\026|\"\006\365O\013u1\017\250\203\320\374\200\232\305\234O\377\2100\345\347\323I\26717\004\255\313"
+	.ascii	"\202\013\033\235\004\004sK0+4[\252mm\277\335,\r\235\024e\307"
+	.ascii	"]\347{6\200\323\323\027\363K\367\301\264\315\216\257[h\337\364"
+	.ascii	"\222O\341FD\211\222\212\214j\236kv\236k\344\203\026\244\205r"
+	.ascii	"o\2469]\216;\324\024\3320\227\336\242\241\254\036Y\364i8R.\005"
+	.ascii	"C&\237\253\030\325\320\026]\342C\342\\m\333\266Ev\034\337\313"
+	.ascii	"\221gV`b\324\321\254\026\243\232EC[\364\216\265KZ\342=F\265N"
+	.ascii	"\353\350\376s\266\261\255l\235\036\302a\331l\331\262\257\227"
+	.ascii	"ld+\333H\305\371$\247\223}\005\356\007S9\355\242\360\330\310"
+	.ascii	"n\034\236\210b\013\\(\215\r\256\3448vr\257\217\356z\240u=\271"
+	.ascii	"\333\301\251\020>\320\367r&\267-n.\306\314\024+F\257\242\261"
+	.ascii	"\377&-#v\251\327\321\330\367{\b\267-"
+	.string	"t|\215\307\205\203\263b\30712\211Z\354\022_;\216\227j}\325]\346.\035\252\241Pw\322/d\001T<\356\221\013\307\017\252\013\266\232]XW9VXT@\232V\305\346\026\225\017\2565\310V\027Vs\005\342e\243\313\007\005W\315/\244U\223\002,*\037UF..*\013\324\253S\200u\325\334Bbe]uQUe\375\370A\225c\325\274\340G\026Ws\353\210\344\252\246\255\346\017/\253\246\217*.\036A\266\272\232@\232?\232]NXWT@\234\252\266\270\234\232\2268\313\202\346\226SWV\326\226S2\332^\312\324\315T\254\3078\203 j\333\276\271\300r\236\351\224\233\310I\035\307jG\0234\253B\035:FCct\211\333\244,\212\364P\244\351\221a\244\334\031Y!\345\244\020)\372\233\313hh\214\236\240_x\246\263\034\306\006\253\264\311h\346\030\267\205\257$9\026\f8\"<\340\256\200"
+	.string	"\220_\031\2336;4\261\233x\217\252\332\352F\306\004\361\214\211\211\211\211=\272\252\317\346Kgq\244\203U\330\244h\024\335\243[\320\t\205\252S\334\265\274'\342/\242(ASu\223\240\263\315\330\361\276.\236\234\004\3755\347\311a\216\275\024O4\2126\242!\240O\264\032\247\t\001\375\351\231"
+	.string	"\343\320\335\021\215\355\001\032\205\335Do-\211\232\350\325\r\216\233\273\303\253D\353U\222D\361\350\243\371\355RV\327f\307'-b6\022\326I2\004"
+	.ascii	"\333\023o]\372\212\241\001"
+	.ascii	"\372X~\200t\3103\313:\243U\254h\003\005\245\f\035\321\212\246"
+	.ascii	"\321\337\273\223\233\236t\260\312\2117\034\246C\035\3077g\351"
+	.ascii	"\227h\351/\374\361\320\3160h\351\035\032\312\027\3528\326Q\003"
+	.ascii	"\252\321k\231\236\245\303\200\201(\355q\226\021\013\3528\206"
+	.ascii	"\321"
+	.string	"5V5l\203@N\215\367\245$DMS;\265\372\367DTj\246nj$4N($zD3\265Q\336R\2230a\251?f\356N\200\016\321#\232\350\317\371DD\013\0207%\242\3377w\027@\177\350\020m\314\003\321\001\300\321\370\002\242\017\303\334\335N\177\350\253\261%>\021\337\\7\255o!\001\217\201~\201\210\250q0\006\025S\204dDD$I\2224\006\361\004\304\030J\245\274\016\021p)4\310F\222\024$\255\001\353\250\023\333\023\354\310\247e\n\267\317U6a\023\376S\331\342\307:+\243\220c\363\212Z\221\230\3778:*\267P\023J\347\345\310O\343\356\037\274 (\300\b\200$2e\216\270\026wPY\324\332$)/`QG\301\2379-\036\273\023\215-\302w\204\251ED\364\305\353\313!*\245 \200\t\345a\0201\250&\235\244Z\344\233\372(\024\235@y\\\n\2213\370\b\r\303\004\342"
+	.string	"\017*U\372d\251\242\375\030\262\n\273\377\311\237%\206\002\277\365\207\223\342\337\357L\206\3048\272\331\017\343]\"4\255\355\330\220f\330R@l\376\3561\027q\t\027\246\333\244\227\237m\341\2024\217\330\336~nN\2053\345^\227\240\322\366\031\003\262\252\242\034\230\364\354\230\254\233\035p\214G\3339b$g\332\003\335va\032\b\227\007\335\032\363\352M*\024\253-g\365\302\006%\351G\301\352h-\3532\252\322\3552\032g\0330\242s1\025Q\347\f\373\336#\n9\204\237rbrYzG}L\212\230)\302\032\363\377\026\360\302\374\300|r\346\372\310\273D\362\211g>|\35793{g\365U/\323I\363z\225\214\231\260\005#j\377S~\220\375\017{T\325\250\363\236\"u\274~\246@\360\335\317\206\005N\201\222\0043\253\370 \224\234]\013\307\001\310\002\264B{M\366\343@\236H"
+	.string	"u\007#\001\021\232\235\020C\333\276\201\277\252\337\325\265s\217F]\231J\367b\022\"9*N\217\343\025\210w\372LZ\256\366\017O5\314\200\270\215\027\260*Q$\002`\f\3471<+\353\024\365\276\335\024@\270@\025F\260\037\246(\266\330\367\204p\365\276 \320\026\017\361'\321\267\316{Y\251\247\002\214\312$\024R.\005\245 \320\003p\330\241\263C\2141\275\275H\364\255s\372\252d\200j\240hDd@\304\224~\030\022\331+\216\241\320\320\0202\360f"
+	.string	"P\020\262\241\213hT\342"
+	.ascii	"\235\274\243R\312N\233st*\304\313W\236\036o\322hAK\\\301\310"
+	.ascii	"\251\b% \241\302\271V\357\2621\266\021 \272\3044\025\016<\257"
+	.ascii	"\344\345\322'P\177<&\306I;&t\214\374\b\t\235\2620\260w\246S\217"
+	.ascii	"\032\f9\213\360\004NC'\222\\\366\3137\327U\363\331x\274\\.\370"
+	.ascii	"8V\031\370`\256\255\326\034\334,\303',\2210\214\220\264\036\236"
+	.ascii	"\352\370\231\036\224\223\302HC\257\313\326I/B\257\373\001\356"
+	.ascii	"\300\317\277\376}\177n\373\242\225\031\365\017\216\371\022%\036"
+	.ascii	"\332\242K\363*\271\201~\025c\022\234\302\013\354\341}%\375\254"
+	.ascii	"\230\340\2510li\246\242\306\274\2028h MIh\021b\0076\242\224\360"
+	.ascii	"\001\322\233C`\017\207\2723h\216&r\353&\325\3016\201\246\333"
+	.ascii	"\230\204a\205?=\213\327-#L\201/y\243\002"
+	.text
+	.section	.gnu.lto_telemetrySchedulerStart.16.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`\021\006e!"
+	.string	"&\273\317J\220\026R:"
+	.string	"+\257\024\027\333\353{6a\bC\367\301\247\316\236Zp\005/:K\026\n\3075\201N\"%\242\375\272\035\361\271\315\005\206E\273\2411_\001\220\200$L\"\031\t\344#nR\226\237;\252o\257\033!d\023\271\223\f\263"
+	.string	"\261"
+	.string	"\273"
+	.string	"#\322\333z,\276\361\241\334\252\367\253\243\364v\245LVMh\367\026wn\271CzkSk\361Nz\257B2m.\360\307\016\013\351\255\001\363\225\371K\316\244w\342\214\013\2707\252K\327\275\305\006\034!\275\345\342\007\234\267\351o\316[\3561{yqxoE\203\311Jy\357\3155\020\224kn\026\317f\367\236\242\2475\273\366\370X?\020dLP\230\364\364I\034;\216K\025\325\361\363\370:\305%(\324qk\242J7\206"
+	.ascii	"\020*\231<kh\310\033_\233\204\277j\032\311\361\276\361\013\206"
+	.ascii	"eAa\216Wt\302\275\227kP\350t\266\235\231\251\230\271\207\331"
+	.ascii	"\236\005\347mN?\314\024\321W\227(\376eT\267\206\367^\036\346"
+	.ascii	"\024\237\022\224\336{! {VT(fBf\234\267\357o\335\234\002u\245"
+	.ascii	"\206\364\325e7\226\230\222\260[\212\271\230Ty\206kh\334Q\314"
+	.ascii	":\327:\347\340\274\352\2779\361\2679\327\031\367\254s\315\355"
+	.ascii	"Wg\032[e[Z9\265UFm\225O[e\233V6\321\312}V\256\266\362\013\320"
+	.ascii	"T\271\242@\354\336\033\3132\227\314\"\211\234\353\327\372\263"
+	.ascii	"\376\253\233\314g~\027\363\355\230&\341H\261\254"
+	.string	"z\240I\341oi\275\370\r\336\3375+\033%\322G\341\033\371\226\305`\006\2006\027(U\243\310\2757\311#\025\226\236\025\274\341\274}\327\023@\035\325\236N\323\2745\r\315\320\213\3134;\355&f\002\325\246\2319x\250\017r5\"!\003v\022\33743\210'\221P\244\226\332S\210\223\361\246\260\320f\026\3611]\200!\226`\332\331\266\3216\303,\035\371\221x\025\335\331\017\264\020i\332\332\247\341\322\266\024\343x\264N\303\360\342\252;\257\351\246\033o\213\362\032\353\332\307z\252\364\"V\376\321y\353&\342\2231`]\343n\263\317t\306\347s*?i7\202\233\367\336k2\203\327\264N\337x\213\034\226-\371\370\325%\347\364\255k3\260\262$\346\007t\261\027\351\275@\b\3740\031\273\312e\024&|j\320w1\202<\300\370\021B\211@\354\204\202>\024\265\330\361xF@8\033\0039\340\355X\030\235\330\251"
+	.ascii	"\"\3629\342\025\355\204v,vE\271\026A?B9 \036Q\316\301\016\017"
+	.ascii	"\271\330\361rECC\274\334\255x\337Ql\264B\346\353_z\342to\261"
+	.ascii	";\307\341:Eq\215\323?\336\"\247\316\226|\374\222\324$]'\303\352"
+	.ascii	"]\"\303\256v\346\236\222\233Q\226!\003\005\246\004\343\273\356"
+	.ascii	"d\3561\271R\327I\2601b\252\300\250\300\330\232\271\327\344`t"
+	.ascii	"\235\374\222f\202\005\323(\034Mws\372R\236y\261\365\315\351K"
+	.ascii	"\215X\341]\220:\371E\305e\013z\344+\311\223\257./\334\f\251\223"
+	.ascii	"G%\363\211\227a\220`\226\341Y4\340\002n\250a0\304\2342\206\031"
+	.ascii	"\031\031\021i\n\332b\240\002\231\251*\036\021 \2713\214\221\004"
+	.ascii	"\313H\332\260\037S\223d\200\312-\3463\363yz.\017+\3058\245\002"
+	.ascii	"A\254\352\030\017\225\257y\244\272\031\310\231\304\220 \245R"
+	.ascii	"P\372\016\204\344\245\205\231\216-_ 1\340\302\265\316;\370K\204"
+	.ascii	"\306\301\302\257\341A=\"\3535\b\227c\316Ab+\334-\257\242\001"
+	.ascii	"\326\030\337\013b\237\344Mt\310n\216\335(S\227\344@\027\261P"
+	.ascii	" Q\235\r\203yW\202\365\306\224\013\343\320qI\313O\347\345\302"
+	.ascii	"9\272\257\305NOw<\304\224\225#k(IK\260D\\}\016\302\226\275\217"
+	.ascii	"\240b?v\345\331%Hs\027\3145\356t\375\331\315\005\213\205\034"
+	.ascii	"\205\301\363=\326\317_v\213\0275\241@\231{\313\317\377\201\357"
+	.ascii	"\301\2559\353\204\263\243\336\370\213\331AV\032"
+	.text
+	.section	.gnu.lto_telemetrySchedulerNext.17.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`*\t\2254"
+	.ascii	":\\0\024DP^R\007\217\244y\376|\230g\252w\222+\367\321\251\007"
+	.ascii	"\260\007:\016\314p4\224{Kw\353\342%,,\275I\267Y\351j\bp\032\203"
+	.ascii	" A\006\300\r\354\032\",0\216\362\323\255\033\3416\356\266\367"
+	.ascii	"N2\245/\001\037\001;\001\236\301\262\333@\213\2769e\361\267\356"
+	.ascii	"\267a8\226\016J\325D\3119\2770\272_g\327\356\253v6w\353\267\255"
+	.ascii	"\347\332\242q|9g\024kN\227\006\324uc\223\343\313\231zt\266C\270"
+	.ascii	"\030{\232\214\325\230\265\212\340\300\340\270\333\247\216v\345"
+	.ascii	"\324\031\376\2233Y\233-9S\231\032\202\353lS]\247\342U\256\272"
+	.ascii	"\347Vj\331\227G\247\\l}9g\345\221\007\265\316\256\016\324:\373"
+	.ascii	"Gz\350+\325{\210\257\334\350S$\016_a\320\005\266\354\372\370"
+	.ascii	"\252\235\206\033\205[x\340\214\201\225\271\317:\001\311\032<"
+	.ascii	"\022=\302\\\n\025\202\213n\007-\023\303\304\025\270\345u\346"
+	.ascii	"v\320 \353\003?\276\252W\267\360\020\311\b\030\020\177\213_\\"
+	.ascii	"\353Q\316\331\245\320\037X\310\204'\270*\351\266\274\334\016"
+	.ascii	"\352c5\226\371\301q:G\222B{`\327\261~8\020\202\02237\276xx\273"
+	.ascii	".\361q\251\343v\320\2605\310\353\354\206\323=1\213\201\370\252"
+	.ascii	"\303\177-\022\033\243\243\370\245\265&@S\344\215\2739\356\372"
+	.ascii	"\312\302\030H!\347\334\370\306\027\230\367\217w{\262\273\277"
+	.ascii	"\272\335\246Z\330\257\223\376\350\207\350p\375\371\033}\322\373"
+	.ascii	"\233\257O\356\370\320\270\332\230d\365\322\313\310H\200\227s"
+	.ascii	"v\320N\306B\013o\303K2\243u\326\337\335\\I\252F\312\024\013\357"
+	.ascii	"\351\246f\341\217v\373\2032?\276~\262n!\356\005-ne\222\311\275"
+	.ascii	"x#\375\213\367\021\210{\311\305x+\265\270\223\024<n\004\256\305"
+	.ascii	"\373\200\307y#\tq\037y\232\273\221S\335\r\f\020\342.r.\336DC"
+	.ascii	"\276\346-@(\250\305\035\240\305\r\324\342\006\320\342\376yq\033"
+	.ascii	"]\334>B\334\305 nb\213{\330\342~\203\270\205.\356 \020\267\353"
+	.ascii	"m\336@ \356\026\210\233mq\257-\356oq\343\026\2673x\363\2409\356"
+	.ascii	"\311\331kO\236|\206\255.q1\356^\334\277\270sq\327\342\036\347"
+	.ascii	"\276\346\336\346n7\230\366\272~\273;\256\353\214\331.;\264\316"
+	.ascii	"]\036_\0300\035L\333\353\363.\355sN\367\305*\232\307$g*\323\213"
+	.ascii	"U\334\226\033\250*\027760-\\\307\322\016\347r\375\3069\217\264"
+	.ascii	"\344\266\260p\235\325\342\f\316\365\207\245\301\3756\270~"
+	.string	"'\212\203\313l\235\025\276\203\274\251\035f\203\262n\017^\347\203\213\304{\342\030\235;\325\245?\002\261e\245_\372\bp\3179\356\267\257\364\005\310<\247\374\273\257D\207\353\317\350]\327\262\337~\322\334S\252|\366\275\3165T\317\344\270\376<\215\224\2767\341G\033No\2074\370Q3\276\340\007\r\224+r\322\214Q\376\202\365\215^\371\036\006\204\307\021\301`l\257\017\016\337\372\f\306\366\356\340&Gp\350q?\332\356x\316\257\206\036\260W\261\374c\356;\226\324\321\321Z\265\377M\265\274n\022\256g\305\216\351E\311Y\313Aww\3607%\234\355\201\tws\302'\355M_\033\013-:\305;\235'\030\323{7\272\255/\366\243\215\361\321\275\352k\335\363\217\316\344x\036#\314\337\267;[\005\337\205q\322Y\204\331\373\244\017\370\256\366\325\350\331\310\b\202\335\335\001\202\340\357\202\334\315],/\354\300#=\202\227"
+	.string	"\367\234\323\344i>\256\354\300\343\277\274i\322\343Gz\002z\236bN\216\306\351\272\370]\316W+vwHA\310\274\374S{\364sEJDN\2322\001\355\"\271\224\202\252RN1\245\244\230ODTT\313\251e\225S\224K\305B\271S\023^\321\204\327e\223\371$\242\212j\271\"HEb)\0055\242jj\331lZ=\021\203\375\224l.\243\254X,]<Q59\233UK\251e\324\262J9\005\345$\245|jR)\223\307f\276X6\225ULfS\371R\261\274\b\374^\211\300\340\0203S\237\244\027}Ww\027}S\300\372,\343G\033\031D\217\317\223u\200\007z?S\303\317"
+	.string	"\357c\314\246"
+	.string	"\376\347\201\276\325{J\263\254`-'\200\3675\263\351\377\\\241a\254\n*8\030_i\366\002g&r\217\221\317'1\253\026\327\241\320\003\217\016\3740\036n\324\314\020\253\316\344\343M~\257LO$\340{U\360C\337\325o\320\367\272\016x\241\357\"\372\342\373T\255\f\361\213\027\\O\006\242\322\330\033w_s\316y\370\321\256BfO\210\034z\001\337\345t\036,#SFH\364\275\002\205>\350\273\272\221N\364\311\367\252\263U%n8\307\213\374\241'\300\303\211\332\230\341\277\217\374g{J\263\234\355\361\207Ot\367\024\023\376\373\001\200\265\250q(\307\224R\n\321\210\210\202&I\206\003`\002\03113\326\001\021\300%CW\304 \231\306\255\b\rCUm\n\270\317T^qB\376\275\0325$0\b\350\306F\270\361p#G$\n\226N\370\035\213\r\357G\034\027\0131k\320\220"
+	.string	"\221\374\034\376\\\274\234n\210\345\274\362\211+\372"
+	.ascii	"\032(\307K!\257\020\276\261\206Z\210\272C\351\264\360\232\266"
+	.ascii	"c\201\025i\227F\356\330\316\340\026\027\372\3777\212\351\262"
+	.ascii	"\322\3671\263\334\t\326)\236\212\211R\222\243\354\t|?\373`\025"
+	.ascii	"<o\301\375\237?=,2\252\325\231s\300\006\357\350>\357\002\034"
+	.ascii	"\304\322W'\261\032\347T|\236\351\020x\222\207)\"\\\314F\021}"
+	.ascii	"$\255\302\316,\336\r\374\367\333U\3567{U-\367\221\027zM?\343"
+	.ascii	"78\332@\023\356\356\025\342Lm\356\231x=\246\265`\256\271\253"
+	.ascii	"\350f1\024\t\357<\330!2p\005n\037DR\256\\w@/\267\230w{\003a\332"
+	.ascii	"`\264%\311\264\373\240\013\340\203b='\025\221\326\021\035\013"
+	.ascii	"/\212\273\006>:\201\361Vw~!A=\007\006yMH\324\371\030\262I;\317"
+	.ascii	"\032\365\261P\224\r\372qv\023\274\021\321\327\"\244\316\226h"
+	.ascii	"P\354\262#\243V\222\251c\002A~\351-2\323\316\270\005R\302\236"
+	.ascii	"#\316;\006\375-\032\033\337\234\343\247\300\342\304,\\\244\002"
+	.ascii	"9\317\316\202\034\312\216\256\233L\211\236\032"
+	.text
+	.section	.gnu.lto_telemetrySchedulerSubmit.18.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`\301\nM3"
+	.ascii	"JXp\023EPdR\007#\344N\373)N\274R*>\217\356\"\331\214\207\017"
+	.ascii	"\302j\224\236@ >\330\210\212 >\3127)\240L\206\366\354gd\005$"
+	.ascii	"\360\212\357\032,\201\277p\001A\325\207w\013C\362\035\334m\357"
+	.ascii	"\235dJ\001\037\001\r\001)\001c\034\256=\256\3377\253\242\267"
+	.ascii	"5\313|6\2379\347b\373[\277Ew\253*\240\025\315^&\236\325g\325"
+	.ascii	"\206\353\354\332m\325.\355\267\273\331nx^v\375\204\254\205\325"
+	.ascii	"\3119\312\344l\317p[1G<\025_|\315\312\301\340\300BYKi\206\204"
+	.ascii	"\353\254\020^\273$\235l\370\250o\261r.=]\205\262\226\223\353"
+	.ascii	"-\347\334\324\025\\g\013\254\030w\373\323\323\254\034\272\303"
+	.ascii	"\207rVr\367\226s\264\251!\270\316v\324\213Zg]'j\235\355\356\206"
+	.ascii	"b`\325W\0365\013\342e@\266\274Ts\216\016\277\314\257<\b\004z"
+	.ascii	"\177~\256\257e\327\307W\355X\036\364E\255V\236l\300\244\261/"
+	.ascii	"\246\0031\245b\370\365E\215}\035\361\237#q\236t\326e\004\377"
+	.ascii	"$`\251{\342\215}5\335\365\263\2560\354[\227\232s`Em\234w\257"
+	.ascii	"\327\026n_\257%f\335t\025Y\013\344\234y\340\025\314\177Uj\343"
+	.ascii	"\274\013zi\255F\31590\227:\346\362Rb\354\213\31297\366\341\365"
+	.ascii	"\345\035\344\335\356\353\356\256\356\037ar\334\307\035\374\376"
+	.ascii	"\377X\317\262\251\034\341vI\037\035\025\016~$&%\274\356\370N"
+	.ascii	"i\225\356D\004\273\024\356f\005\320\311Vm\263\201\330\376\204"
+	.ascii	"E\353\254\377;\245x\320,\274\227\301\327\334\360.f9\347\007\335"
+	.ascii	"-\\\215\224\233sn\220f\003\321\201]\316\331\237\354h\235=\372"
+	.ascii	"616\3154\270,\274\327\035U\342'\353\3665\277\222\356\307\r\365"
+	.ascii	"\342~zq+xq\017_\334N\016\347\335\364\342N\360\342fz\334K/n%\007"
+	.ascii	"\343~\340q\033\360.\356I/n$\027\343.t6\357#\347\342N\300\241"
+	.ascii	"\356F\215\273\350\305\035\340\305M\364\342\006\360\270\207\036"
+	.ascii	"\267\320\343\016zq\007_\334\300\0277\320\213\373}q\377<\356\337"
+	.ascii	"\343v_\334\276\027w\373\342f\201p\257/\356\177q\343\027\267/"
+	.ascii	"\020\2325\305\312\202<5\232\203\354\361\311lX8"
+	.string	")\016\347\316\346h\316t\007\246\235\267u\313\275\220\266+9\347\251\227\351~\233\206\267\365\021\323\214F{q\302\336\246w\372\341\373r\212\262*\315n?N\337\364@\250\332\234\026\316\233\200\273\234\376\247v\207\226\340\231\276\351\361\233\345\231\022\256)` I\327\323$\370!\023\350\201gz\217s\004T\250j\3245\275\267c\004\253\371{\377\007\346\302>\334\223\355\317\277\377o\226M\013x+\371t\323\352\222\307\317?\335\024/\370F\217\316}\262^\372\337\303PS\343\263\363\236\266\356\377~@\232\345\331\372\356\020\317TI]C\372%\337\013\037\351\275\f\006\234u|\265)\306\302\371_m\212\006e\342\262&\347{\262N\372\366q\236Z\034\r\256\227|\212#S\355\303\247}\377\022\007{\373d\355\311\226}\227\303\301\361\222?'\231\352\036\366\225\034\347\234\261\330\017\355\372.\324\344t{\360<\037\334\234\265\032\264\343\271"
+	.ascii	"\302\275\361O\306\ft\025\3329>\235\333\225:t"
+	.string	"|N741\037\243\247\r\222\357\020\255\201w\251\017m\241b\341\241\233\323\302y\255\364\006^\200\236-=\341\377+\275\313\371Z\345M\235\264=_\246(\361^\377\337\035\3379'-\303\211X\234B\016\251\252\212\305*\251\001\307\021\310c\225T\253\303\210\244\"\262\307\021\304\342\224\b$\025\321h\304!\005<\022\221:\\\260H\252)\243\r#1\006\325\024\2147\007\361\005\325\024\373k)'#\261\006\216\027D\031RG\026:\214Hb\221X\203\210\034RM\265(\016\245\214\307\241\023SW\331 \032\207\310\252*\343\360\215f\371\232_I\267\3240kn@\367\253\326\245\216\201\372d\315\315m\277j\213\212\276\243\262^\031\f\360R\222FL>Q\240\364p\240\017\360(\262\354%}\267\006\354$i\304\2546a\242\\\203&Vv4b\346YB&u%<j\360\304\200D\357\034K\002\340\203O\364\353t\331\034z"
+	.ascii	"\357\256\320\017\275\221\236%\226\240\207z\241o\245\313)\301"
+	.ascii	"\017\3726\315\226^\326\225\026\334L\n\231wL\261`\223y\327L\203"
+	.ascii	">=\024\360\205\377\364\216\306\310\261\003\323\256H\030\360\335"
+	.ascii	"\214c6\246]3\r\232\005\364d\215\177\206\356\034\252\334\226\333"
+	.ascii	"\317\363\\\301s\3459\320\273\300D\222Bf]\3639\004l\305\f\261"
+	.ascii	"\272\346\023\310\231uM\246\202\377J\006\231\035\005\200\303\250"
+	.ascii	"Q8\205\220cJ\315\214hAAR(t\300\"\021\262\242\007\021\3600i\020"
+	.ascii	"3$\246 %M\232\003\304\236\177\240\270O;\204I\242_;f\231\275\207"
+	.ascii	"-\3747d\226\247\352\273*\006\002\033\243\3426\345\220s\370\032"
+	.ascii	"\016H\360\306\262$\r+\323\242A\020@\213\241\323<\007\215\270"
+	.ascii	"\374\004\205\315j\300\207\034O\241S\023M\342\202\206\303\260"
+	.ascii	"\\\027\n\316E\333\262\343:\372\217\210\277y\241?u\2701Z\330'"
+	.ascii	"\214\222\303\024\343\2440\336\001\354o\272\3549\323.<\263\210"
+	.ascii	"\243\033O\021\026\311(\210\233\022\227\253\205\321\006\232\001"
+	.ascii	"\315BZ_IR\223\220\030\021\354\021\262\343\032\332\240]\346\271"
+	.ascii	"\3447\337Rvp\246-v\213\367?\250\367\303po\013\260\241}c\201\214"
+	.ascii	"ed\261\034\017:\222@|\256g\322\266P\365\257\204\357\347\037\031"
+	.ascii	"\347\226\216d\315j\206fH\265)\200\330\257\317\024QX\034\247\213"
+	.ascii	"\376\317^/\246\"Hc\316?L(?\355\241OF\301N\371i\003=.\333-\007"
+	.ascii	"\272v\277\302\353\323Y\277o\364l\277>\310U\251\241\344\255sG"
+	.ascii	"\002o\221\362\363\252\223~#{v\224hC(C\263\013Z/p1\3505\267\211"
+	.ascii	"\007\260\264P\222\246E\315\226y\255o\256\223d\300w3\013\240\224"
+	.ascii	"\032\b\2042W\341\242\216/T-\321\243\"\227\365*]\031%\263]2q\207"
+	.ascii	"\021y\215 \005d\354CSb5*ev}7\245\311\177"
+	.text
+	.section	.gnu.lto_telemetrySchedulerConsume.19.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`\200\001\375\016"
+	.string	"6\234cD\360\222(\035\"\225\017Phn<\331\373\256d\023%\212\230\016w\3733\350\177\016H\304(\323\271N\373?\022\210?\236N\313\226;Q\307sYG\356\2237*\203p\256e\n\223+\031\201\027\335\237\354-eJ\001M"
+	.string	"N"
+	.string	"L"
+	.string	"\002vS<h\354v\006\214 \036\272;\001\3540~"
+	.string	"vh\316\346\361\016f\357\212q\242\371\261\273\231\2168\367\247\311\371\033\024\027\324\350\017"
+	.string	"\352\3035"
+	.string	"\312\364Jv\367\256\347\013\252\224\271A\331]\247\013\312\303\ro[\201m\007\366q\004\337\\\346\207X\372\301\264\302t\302\364;#17\022\370\330\345\360\022\2625\260\206\211\267~\373w\271\343\2638\r\367V\2068\352\020_\234f\364\330\355L\016\315 \036\226<\355\276\202\273\214\206$YSI\304\202xH\222O\373\253\253\340\316by\371z\356\356HU\345\250\252\"\254\031\033\246\004b\373s\030\252\234\231\035)R\257Q3GKL\311\240\273\330\342\356\036\360[\250\\\210%X4#\301\202z=\210\325\3534\204\224/\273\033\245\252\354\277\335]k\312\306\322\234\267\356x\326\003\333\003\321\006\362`\233&Z\221"
+	.ascii	"9\366\234\204\264\024\f\0234\n\236\r\302JH\244}\264\024M\224"
+	.ascii	"Y\250\020\341\223yB[vbb\220\212\026\312D P(\353t\373\267\232"
+	.ascii	"r\246\277a\"\253 \033\224\243O_\032\240\250!i\311Oe\214\300\024"
+	.ascii	"\320\021\202\224\257\367T\305\321\267\234(\005  P\202Ad\221\017"
+	.ascii	"\360\242R\366\rL\317\267\220\321$\247\025\215\rf\234\215\350"
+	.ascii	"2\002y\f\332Y\325Z\364Y\234\207\253mJv\323\214\035\243\345q\273"
+	.ascii	"\212\031\003\331\313A\363k\207\355Y\353\263\242\332X\232\241"
+	.ascii	"\0067\001\327\033.o\273\202\036"
+	.text
+	.section	.gnu.lto_telemetrySchedulerAchievedRateDeciHz.20.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`K\001\205\016"
+	.string	"F\033bD\340\224(\035X\355\250=\026\250\261"
+	.string	"\3719\0058\\!\026\217\022\022u\205\264\316\314y\036\300P\001\315\302\327\265\013vJ\265\325\255ii\001y"
+	.string	"A0\326\252\221\342\235v\304 \226\031\203\370A\374O\366\2262\245L"
+	.string	"M"
+	.string	"P"
+	.string	"\320\335\307\266\317\342-PNew\"D\366\322\361!Fl\267\323@?\311\016\363\004\262C\265y\352O3\345\003`\301\374}f\256\357@k\307\214"
+	.string	"\326\352\235\350\324"
+	.ascii	"\371\353)\303\3422=*"
+	.string	"\273\353\214a\211\270\341m;\260=\301\276M\236\343\374\360\335\377\262\264:\2350\375\017\n\026\033\302\240\307.\210\035$\313\003\336Ha\033e\233\330~9\033r@P\030w\241\216c\034\017\264\\\315\n\330\356\242\370\301\347\320\300\313\264\177\363\027\250w\036\n\200\226s\215\200\355v(^\360y^\t\345cT3\205I\033Eth\324-\331\265\202\353\007\227Fl\307\327hQ\"BT\330>\235\206\250\201\217]N\301\205\317\030\rX\005\211\355r\tdh(\371(\016\375\f\331\341\225D+\326rq\243\312\035\273[\245\232\260\377VK\330\317\371\003&\tq$\212p\"\305m{\t\005\340\020YH\"X\342P\312\026]^X\242\205\220\211B\207\355\024G\321%\2364\222he\244\2056\223\226\202\300%\fq\323N\245\322\246\231t\252?U\375\353%4G\222\244\237\312Rel\247ZE\245\253\007J\217B}\352\034"
+	.ascii	"0\213Jk\237\030,\302\260\222\026\262\304\254pTc \345F\334$\023"
+	.ascii	"\f\320\370v\023I+\226\222\025\276k\370\304-`\331\004\016TaP\227"
+	.ascii	"\301\210\022\342\006b\200+lj\034\334\005\244\032l\021\232\306"
+	.ascii	"\240\240"
+	.text
+	.section	.gnu.lto_telemetrySchedulerAchievedRateDeciHz.part.0.28.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`\007\006\005!"
+	.string	"V\271\310H\220\234Qc@\330\002\035\333\353"
+	.string	"V\347\377\r\250c{\275vYA\360\256\237\323\366\352I\r\321\346\037\357Nc\352\301\r$G8\334\364\215\260\237,\302\244\276CO\222\351\270(\377\325\231q\273J\0206\262\210\354-eJ\001\255"
+	.string	"\271"
+	.string	"\255"
+	.ascii	"<j\346\313'NR\313|NR\323\304\317d\242\344U\274\027\370\363\322"
+	.ascii	"\027\314#\373|i\273\254\247ZbT.1\302\242@\326O\361\200w\351g"
+	.ascii	"\022\311\223\034]\312B\262\347\372h<\005\357\275\022\314\227"
+	.ascii	"2\322\326\033\341\001/\323\317\266\332'r\340\321\213\214\030"
+	.ascii	"\320s}Gb\004\357\005&x\351\006\346K\003M\373Cx?\333\276\220C"
+	.ascii	"\035\031\251\002\235~\261)+JI\216\367\002i/{. \366\262>@\354"
+	.ascii	"\245m:\322m%\221\374\232b\311\304\355\205?\320\003\254G\244Z"
+	.ascii	"b\361\352s\322\006\302\275\327f\213\273\274m\007\266[\3301\004"
+	.ascii	"\001\377\327/\346ex\276\311|@\247%\005C\254\240\216\327w\177"
+	.ascii	"r\276\221@\247\245\020ZJ`\307{/\355e\216}?L\361c|~\315f2\037"
+	.ascii	"\320\300\013%PVb\032DmA\035\263\234\213\357\345_|z\r\2077vt\271"
+	.ascii	"J\257R\0347\270\272N\364\271e\370a\370\341)\250e\006\234\251"
+	.ascii	"hj\362*\236\313>_\345"
+	.string	"[\366\351\334\257\370F\247{\357\255N\305\267r-\237Y\303\333\360&\363\r\203\"\314\227X\274{e\341/\323=\212\037D/\305{\257\221\331\304>s\326o\302\363\241<\312\205>\247H)\252R\212~\223~7,\246\262\212\271\252`0\225\371z\256\257\311K\245\0132\3063Q6\326\264\027\336\247\353\3471k\363\225\305\330#J\201\2256f\007\030\225\326X\322\226\366['}t\025\211\374\220\342\321\253a\2663\374\214\206\240\236\021\210m\022?\n=\340r\257\217\301\320\315\324xza\216\367\372\026\200\225@\375\034E\366Z'\205=c\220\250\0235\254Z\033\266\344\311kk\3309\325<9\325;g\265\316\277\356\234\263\372<\253q\356u\337\274\3526\311j\033\262:vV\227\247\372\311\263\332~\352\2577\362\037\300\0010<2\356]\021\226\346\316(\243\354\370\224\277\352\177\362g\375X\377\226_\313\357\365w\t\366"
+	.ascii	"\204"
+	.string	"\336l;\032.w\273\345j\004\206\204*\007\241\212\356\206vi\231\006\355ph\005\264\206\263\245g\032D4\024B\207\356p6\2344\b\275\331,\354p\250NgT\323\021\201v\300\331\312\033\327\200t(\221Q\007\324C-\025\032\241\333\2417\224\b\335\321p\266\241\033\255\246Ki@?\316\201@u\264].\247\243\325\223\327\326\360\205\367\251;\226\307\252\260\315c\r\341\204\355Yk\303\266\216\335\211\200ej\215\r\013\323\261\005\216tI\2259-\311\245\343~\026\313\261\037\363\tLQ\304\244\247\177\026\303\261\247=\361\365\013\230\244\033kZ\034\273A\230\004\206\341j\322\303\240a<\246Asc\377\345\001{\250q<h\034#\"3##\322$\311p\240\"\251\262\252\003\022 \2269M\031\211\214\224S\242{\007\b\317\252`\"\217\276\036\210\274\0042\344\211f\232~]N\222u\264=]\177\370V?\\\221\270\034\342"
+	.string	"Pf\"\253\221}$\331\221\254\024\300\3219\371\336\003\332>\262\211c\201c?\023\273\2274\022R\313\264R\352,\375\354\003\336kh\364"
+	.string	"v \243\305!\006\022\366\202\350\034\342\334x\302\360\003\344\021|\234R\322\365A\177\217\340\362 Y\310\361\336B\353\n\220m\334\245r\235\242\363\356\277\315\227I5(\334\241\270\351\240\366j6Q\001\251\346<\nJcN\0328;7\260\353\336\253\206\312\307\331&<\376\001\331"
+	.ascii	"\034\361\032\355Nv\001A\202A{9_`\2750ud\367n{~kubs\206\301\242"
+	.ascii	"3`\204IY_\266\377\355\323\225nb\341\261\232\016.C\3631^\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"\245\004"
+	.string	"D\006\024\001"
+	.string	""
+	.string	""
+	.string	"\002\017\177\027\311\364\227\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006\034\177\030\200\200\200\200\004\204\202\202\200 \r\177\031\272\200\202\002\016\177\032\020\177\033\360\372\2508\021\177\034\022\177\035\023\177\036\024\177\037\001\025\177 \377\037"
+	.string	""
+	.string	"\200\200\200\003\002\t$\003\004"
+	.string	"\302\n\003\b\001\240\341\365\321\002\001b"
+	.string	"\023"
+	.string	"\006\023\244\211\031,\013\365\303e\270\354\001\332\355\374.\225\260{8\006\240\243\363"
+	.ascii	"\203\237\355|\001\270QU@\300\r\020t\317\342s0\307"
+	.text
+	.section	.gnu.lto_.refs.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.46c0dd2dfb572942,"e",@progbits
+	.string	"(\265/\375`\306\026Mg"
+	.ascii	"\032\251\340$S@\020\322I\007\257>w4\214\266\327\355 \242\350"
+	.ascii	"\304\024\371}\363\021\357\365\230D\035e1\373\367\204\203\324"
+	.ascii	"\343r\304<\312\332\266\003\214\273@\252\221\340\017:\374Q\220"
+	.ascii	"u\007+\371\f*\371=h\216\362d9\273S\236\177\320Rg(\262\207\221"
+	.ascii	"$\022\304J\231\002\346\001:\002O\002p\214\026g\024\007g\324\205"
+	.ascii	"\345\270p\351B\3073p\035\337\261\035\223a1|\306c\330y\006\303"
+	.ascii	"a\216\266\367\"\357\275g\26199n\177\326\262\205\321zr\356\345"
+	.ascii	"\362\342uo\373\024\277\321y\f\177a\271\020)\334\313\245\025\300"
+	.ascii	"\361\317\212\255\357\336\226\210\210\210(\210\210\210\310\347"
+	.ascii	"\214\224S\355\007=\317\251\034\202\321\3243\231\027\036\343\016"
+	.ascii	",`\032=\203\251\347#\352y\251\236\253\324\263Q=\r\365\307\315"
+	.ascii	"\350\374\306!Ub\265\327\347\246G\334\217#\215\356\fU\017\227"
+	.ascii	"=\244\275\306!\345+\214\205\317D\260\332Q\2548\260Xv\3056\374"
+	.ascii	"9\371c\323\350EP\317\"R~\262\210\364H\352c\250\307@e&O\341\263"
+	.ascii	"!n\236\311\270}\016\262\275\314{[\237\034:>\027\232\215>\002"
+	.ascii	"\365L\345\004p\335\025\357Q\317C\251\017"
+	.string	"\017\245o\025\350\345d\017\351\b\366\220\242\314!\005\266\314!\312\317PXl\b\230\304\261\274\315{[\240\rk\350\216a\215\276e\017\251\312\034\322\342\003\035\3766\341\347\006\246X\352\347!\240\277k4\3776\253\363+\nu8\306h'\214B\t\344\221\304\337E\376\317\360_\314\3771\377\355\352\376\3171\n\266\361\363\206\237\177~\336y\n\035\201\277\267\376\223\361\371\237\367\377\371s\377\\\343\177\357\340%\376\323\370\271\204\031A?\223(\340o\031?\003\375\234\376\334C\300\377\235\277Y\370\031\200!\373_\3509\177\243\3603\361g\007~N\372\331\203\237c\374\274\301\317\027\374\034\301\317\017\374\234\342?\336\317D?'\3603\372s\207\237\025\370\257\346\277\227\377!\376\307\370\257\366\277\371\263\320\317%~F\340\347\003~\036\361\363\315\317\003\374\f\342\347\017?{\370/\366\337\200\377q\377u\236\317\347\363\007\266\371\201D\376\037"
+	.ascii	"\002\313[w/7\245\256\222\304\275YKe\235\221\007\257\035\235U"
+	.ascii	"G+\306%\267\367\336\017T\307\256\345E:\223_\313{\277\216L\227"
+	.ascii	"JE\261u\336\"\354,\002\311\2728\244\356\005Auo\221\257\363\336"
+	.ascii	"[\274\367\342(\263\332{[\370IzQQ\335\213\025Du\263\212lR\367"
+	.ascii	"v\323n\355*\311\354Z\032\261Qaz\335\251\266\310^\267\216K\251"
+	.ascii	"2\213R.\216{/\363\251^W9\3164\332\356\254i\241\3510\322Ez\322"
+	.ascii	"\354zPiTG\016\fOx\264\021\341<3 m\252\f\021\022\027\345\257\331"
+	.ascii	"(^\213\364\311\362\214k\006\021\341\323\356\240\002\002\244k"
+	.ascii	"\307\357K\b\224F\273\376\346b)\275\365A{\211U5\033\345\371\261"
+	.ascii	"\205\003\345\255\253\331houk\365\362\275\325.\360 {\013\275\327"
+	.ascii	"\310l@\017\263\0017nH\214f)z\240\030\365\357,!\025)C\0251\037"
+	.ascii	"R9eb\030\343\243\205\036\351\232 zL\032\355\3617\217\306b\264"
+	.ascii	"\3661\273\343\221\243Q\340\211\336\301\202\016\021/\\\307Fu0"
+	.ascii	"\225!Pz\250\251\347\266J\336\036\025\357\365T\210c\362&\313n"
+	.ascii	"O,M\217\255\251\270\215\365\330\331D\377\356\366RP\261\025\274"
+	.ascii	"\275\261\276\301r}^]\3258\372\252s\264U+{\005>k\252N\276Sh\025"
+	.ascii	"\036\324rYS\261\031\243\261\263\371B\254\314\336\275-\016\023"
+	.ascii	"\215\031\231\037\364\30025\004\260\311\034\322\003\221\250=\365"
+	.ascii	"3\033\227i)\036\240\22080\255F\377\226z\243p\023\303\224\032"
+	.ascii	"\253F\033"
+	.string	"\3316{\250\212Y|\215\036\230C\375\212\032x\255\007x\257\026\032\212\025]d6\274\306N,\007\2364\367\376\370\331\267\217m\344\263.r\233w{o\223oMZKC\0253]d?\356\353\271\271wi%\325\202\007\027\306\203\036\230\202\372.\243\276\361\324\367\234\372\226S\031\r\247\3413!Vs>\303|\2771\266\267\355#~hfn\352Y(\005>\237,\224\276\323\324\037\346\220\236\35025=\353\375\234\205e\340\274^\nP\001\230\nk\215\342\005\201\340\263\312k\364MD=K\t<Xc\372\206\334\311u\315\035\033\355\272&\303g\217k\273\367d\231B\213KS\177\002?.\355\031\336tY\264\202p\225\251\177\213\371sp\322\350|xEQ\237\202\311\3115\030\265\030\264&\355\2024\342|\203\001\366u\001\311k\264\277\244\306\252;,}dK\260\204d\275\275u\027\022\234s_a<;\356\242\304\275\273"
+	.ascii	"\213Lx\\5\332p\255\344J\2300\270F\233\313\335\222\\\032\355-"
+	.ascii	"\214\206&\271e_\032m-\334\227\323f-o\244G6\266n{ \310\330^\023"
+	.ascii	"?\347\226\f\3576\267\306\242\247\247\325hg\301\263b\245\325\202"
+	.ascii	"\330\2248:\334\316\260\260\274\325R\245\023\273+\255\244Gj\312"
+	.ascii	"\321\331\306dv\032\222\265\001\346\370\216h\357\264\336j$p|;"
+	.ascii	"\032\355f+\001\3728\032\263\316v\314\234\214\261rF\005\207\205"
+	.ascii	"\275\251;\245\221=A\230g\226L\3416>c^vocd'\3532\265\275V\\eo"
+	.ascii	"\003\233\"S\274\244\274\313x\212\300\031yk\264\333V\222\263\003"
+	.ascii	"+I\023M\316\252M\rC\230t\024&-V\342^n\227VJ0\260\026\313\271"
+	.ascii	"\312!6^XC;SX\276\256@y\213q_\232|\241-\331h\207\365\223\024\271"
+	.ascii	"E\214\354\211\023\237\2770C\310\332\t\306\334\374\032\355&w\343"
+	.ascii	"\321\2723s\306rHnF\372\032\375\215Q=\372\246\276_h$o\030\016"
+	.ascii	"C/a\254[4\243B\211r\356\253\357b)\207\376\216\341\275\344z<\367"
+	.ascii	"\212\335{C\364\360X\362@\323J\3708\025dJ\211\327\024\035H\306"
+	.ascii	"t\250`VVT\032=\353$\235\344\311!\365U\246\321\243Vj\377\3515"
+	.ascii	"*"
+	.string	"\357\275+\334\264Wy\3449\337\360\006\0062\211\377\350\005\376\177\021v/Y\037\r\352\0225\243\217\217\270\017\273\267\bt\333\253L2\271\212\311)a\256\200\332\373C\200\313\004r\223-\327\025\272\274}\333\313\027\311uEB\262]*\223\355\262\370s\221\313\342\275\355\325O\262i,r\222\311u\225d.\257\200.\362\026/\323\370CE.\257\222]\226W?I\246\361*\211\344\272\002\032\353KR\346\206\2322?\376\221D\336*\252,\243\362\307\231l\003g2\261:\005\331\"\341\223\223\323\223\322\007\026)\211mZ_\354@9)\345\260H*X0\231\220!\f\016Yb\321\272\024\325\244$\f\026\r\211QE\00145E\t\205OB\034\026i\265\021$\246%<\r\231\330'!N\bIk\023\312\256D\247\325)]\235\242\210\302'\t\330\240\023\bQ0\202X\032\253\006\3540\211\205!\300\322\022\004\036\330\240\320\202"
+	.ascii	"\0208a\202\035&A\231\340`i\235\261\006\231\224 X\340J+\233\244"
+	.ascii	"\364\324\324\004\001\210+\005\207\253p\225\241^\005\013\006X"
+	.ascii	"\264\240\201\363\026.N\2708\221\276\205\013##\027,\214\324\263"
+	.ascii	"0\0026==E\200t\303\022\217V6i\t\352\210\207\210\324\201\315\200"
+	.ascii	"\211\270\016CX\2079D\244\t\226\202]\203\r\016\237\202C(u\265"
+	.ascii	"\021$\242,\022\013#\033\025\004\225\326\027+\2334\324!\256A\034"
+	.ascii	"\366L\013\374\tj\035"
+	.ascii	"\026\261OO\303\242\245\025\n*8\002\221\207\210\004\003\306\007"
+	.ascii	"\342\321\032\365\202\245\261\nsX$V%\036\261\302\025\006KLj\n"
+	.ascii	"\352\020\217\232\222f\fWVh\301*#i\270\316H\002b\205\301!\324"
+	.ascii	"p\225!\f\206\260\303\nWb\316\312&\261\304\033\026\251\005\016"
+	.ascii	"+\214z\222\240\306\220\025\256:\304\243\325)\030cek\200\240C"
+	.ascii	"<RY$\024)Xa0J\275\221\221\004#\2164\240@U21\\\233\242\226V&%"
+	.ascii	"\"R\215!\273:\255M+[$\f&9\025)\r\211E&\210\210G4\2222`\203K\353"
+	.string	"Pi')&EYf\326h\013\351i3\256}\361\"\346V\325\342p\201q\255\320h\2336\300cN\261\347\316Y\303X\337\305\322\361w\340\021h\364\261\033\342\366\004^>\273\033\260\350\243\005\315\026\316Q\245q\357\2758\317\347\363\311wK\333\217\345\200a\376\220\250Y\303f\t\006~oU\032m\305\254\254\216,\323\264\315\224\256\253\216L\243-\263\003V\223\2524:@\340\332\370\366\320\3609\311\236E\032\375\334{\314\\\363\001\351xn\261\354Z\341\250mIs\246\357&\261\206v\244\334\220\002F\357\315\367>\203b\305\363\32400:c\243m\346\275\207\345%\313^\243\3572\275\367\347\350,\t\302l\302\246\236\001\265l\307U\336\363\372+\017\207\231F\033\357n\001\201\330\250\321<\205\224#\"\"\"\"\"I\222\244\003!\005\204 %\255u\033\022 \026-O\"\307fF$J\262\354wh7\264\034\355\244\370"
+	.ascii	"1\213U\031u\211\235\021w\223q\207\036\032\302\212\017\302\326"
+	.ascii	"\326=)\033\272\025e\f\333\323\341\321Ti\257\001\030:\3663\206"
+	.ascii	"\333T\224\004\263Uvo\261a\236\316\305k=\361\366\036k\254\023"
+	.ascii	"\024\034\221\332\314\360\243;lI\227E\255\3764\343\215\237\232"
+	.ascii	"\245\315\213\0301\254\352e]+D~\n\2448\243h\363\031\236\310\370"
+	.ascii	"\251xpn\311\032!\030\215xa{\231\004\272v=p\256.\325\254>tCSE"
+	.ascii	"*\365\2113\310Jr\306\352t\\\233\023t\002$\242\177:q\375Q\306"
+	.ascii	"1\241\031\256\340\215\357\3413M\353\311\241\3544\230\206\362"
+	.ascii	"~\213"
+	.string	"\211Xa\331\326(\030e@O\310C\250s\036\221]\326\352\222\n\320\245@E\240\013\353\362\206_\016\242|d\314\321\205\324\235\210\004\335\006\005\262\266\240\300\320{\021.a%\220\234K\240O\021\260\336\235\t\227\036`\231\211\016\336\b\347\244U\227\004\207\300\227\233\216\300\240r\241\333>\262\344\267\001\204\301/5\376b\222\241\2022\374\372\2102\370\031\212\\\3658\243\247\2349\022X\023\265nw\361\322wF\222E\247\260O\265\250\247\247\002\274\352\2405\351\276\217\314e\242\340\314\264\373q?\306|\240:\326\027\216\005%\323\230\324\002$@\250-h\333\271q\214\026+\343\f\360d\232{J\b\350R\255\226\354\004Z\004M\354y\235\247\033\222\016\263Q\312\264\303O\371R\247Z\334n\211\352N'O\312I\310\224\312\031G(\001W\2272\277\241\345\261\351g\256C\375\231\346B \201Pi\205xMl\362\304BK\005\036"
+	.string	"\223\341\231 r\244\223\020wJ\2347\345\336#<\200\226G"
+	.string	"\025!\204\311#Q\211L\334tJu\327D\226\242\365`\212\316\337\364\233Q\221"
+	.string	"\371;\320\"\020\230\274\224\203\267\2654\255\352\326\377\352\201\003\227m\313b7\021BwO9\250+\307\003\205}\221\341,p\300X\275\315g$\202\216[+\256\247\264)\026\323\027\321\004\020\374\234\215\201Fb\332\364Y"
+	.ascii	"\006\276\013\200u\004\322S\2661B\343\026G\023^\214\007\266\255"
+	.ascii	"\311\027\275\002\314w\222\371\227ZB\337\323\343\377\316\376\343"
+	.ascii	"\341\376\177\t\033\0254<\325\251\232\356\364/{\027\324\220\025"
+	.ascii	"\006\265\331\237+v\304\243\222\270\245\331\360\274\201\363\355"
+	.ascii	"z\f\0320\340Wx\376E\270\270\026\333\tF\200y\344}HQ?\177\311\235"
+	.ascii	"\307\330X<b~\021w$\332Kx\272\302\331\373}\377\252\234\255,\202"
+	.ascii	"~T8\305ss\205\306\351\241\311\034\177\247\337\233\226\001\367"
+	.ascii	"\363wkp2s\217\255\231\266I\177:\234\351\013F\314\234\374\035"
+	.ascii	"\326x\213M\301\215\313oM\2718u\033\330\340u\303\177\210\203\330"
+	.ascii	"b\\?\277\364\254\030W\331\003A7q\273\220\336\323\2532\223\364"
+	.ascii	"A\272=`\357\351\237\265\037\321_\207\217l\307\360\215c\273\030"
+	.ascii	"\256X7O\274)\276&\217\325\001\323U\023WB\365\244m\220\356\207"
+	.ascii	"w\277=\222\207\354\336O4\276\274:#\007<\037\256\tr,\177\243\354"
+	.ascii	"\353x/x\034$\207s7\027z\330F\310Z\313\227\031#e\263s\330\036"
+	.ascii	"\022\177v\207\321:\310\313\013\3677\3735\360{\355a\003\242/\301"
+	.ascii	"7\356}\\\316=mM\226\235\200\237\206\205\271\tNF3\347\304\331"
+	.ascii	"Kq\324\213\001\256\336\003\335\232\026p\256\002"
+	.text
+	.section	.gnu.lto_.symtab.46c0dd2dfb572942,"e",@progbits
+	.string	"telemetrySchedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"telemetrySchedulerAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"telemetrySchedulerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"telemetrySchedulerNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"telemetrySchedulerSubmit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"telemetrySchedulerConsume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"telemetrySchedulerAchievedRateDeciHz"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.46c0dd2dfb572942,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
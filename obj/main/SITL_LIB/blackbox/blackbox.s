@@ -0,0 +1,4752 @@
+	.file	"blackbox.c"
+	.section	.gnu.lto_.profile.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\247\013\005)"
+	.string	"\226-\256FP\030S\007\223)5ag\330#\303\300J\255\225\206\370\227\300\277\334\334P\026*\3006PE\016\2604\026\214\367}\337\367U\327\325\004\212\337n\254\006)\345\347\305`\301D\013p!%\211\235\264\275d\273\211\334\222\310\016\222"
+	.string	"\222"
+	.string	"\240"
+	.ascii	"?\353\274"
+	.string	"N\3163\2472\366;\266\375\231\223c\270\304\311=g-W\261\037>=\313_\342\334\274M\315\367\247y\032\345\367\"\031\310W\225\255\251\2233\313\\\211\013\223\305\304\271\371\207\373~\370g\276\177\362\371#\277~\376\374\177\352=8%Y6\306\272\337\245\271u\325\320(g\222\310\232\3563\375t\237_\346\347\347\017?\374\362\313\277\263\341\274\350\274\362\221\317T\016\327\266\304\273g\271\200\335?>\217?\376\375\373\037~\343\303\257\344{SW_8\n\256\301\002K\264^\0240d\021\216\276\250\236\023\021\211\234Ax\200\364H\362#=\334\377\bI\226\307-\203\222\337\350\373\033\365\242O\312\331j\221!\324&\246\251\374\362\3361\374I(z{\366eQ\272D\364D\017}x?\364\017<\364\r@\207~\350\347\270\320\213\305Fw\201\315C\340\373\017\370\376\002\276\177\200\376B;\b\350{\357{\357\375\363|\356\363\361\315o"
+	.ascii	"\337{x~3\177\347\273\363\037J\255\345\333\222\023\nz\355W\215"
+	.ascii	"\013h~\336\374\376\315_6\237\031\205\212&J45%\275\177t\213RL"
+	.ascii	"\337\334\330,[\034\211\030Z\327Co\204\210\337}rv\202!\216\375"
+	.ascii	"\347\343\341\230u\017\304\007\017\035\202d\254]\325\033\207\376"
+	.ascii	"\375\371\316\237\376\364\225r\030\342\224,\0334,\337\355\255"
+	.ascii	"IW\324\3363\337\252~Ue\300\300\237\037\3471\335\253\331\005\351"
+	.ascii	"K?\372Qi4)U\007ji\245YXJ\356\2669\305m\005\n\035\031\bvG8!\372"
+	.ascii	"\321\350\303\257\364\361'}\374J\317?\351\371/k\265\260%"
+	.string	"G$8\370\270\301\303\f\336\271@A\202\236w>\021\2743p\317r\001\273F\252\247\362\322\245\3178U?\321\342z\215U\037 3/+\036\337\261\n\253h;b\031\257+\226\250\343\371\241\266,-\307\327U\260\254_\034<\313\b\327\352\206\215\371\213++\246F\354\303\272\346F#\206\343b\261\314\350\201\177A\2562b.\223\253m\f\372in\314\312U_@C\030G04<$/\344\272\3047>\027\361,\204\313\254\260\305\347\rZ\021d\361\335\317\211\366n\305\221\226bekS\361\364OO\335\357\220\360,E\235\275\016\032\242pz''\272lnl\355\004\365\251\324\347O'\241\013\201N\250\3615)\221)II\n\225\306\321\004N2\307\030\236\007\022\240\304\021\212u\204\214d\024$%)\250S\217\016o@\324\204\321od\357\274\020\3556h2\212\343ce\345\254\270\234\371\350\313\323\256\364\325\242\311\265"
+	.ascii	"\362\336\344\263\370I\333\375O\251\231\212\343#\301\254\373\361"
+	.ascii	"\203\313?\266\363\232\034\326\314\251\263\3201\264q\2118\332"
+	.ascii	"T\t\320\211\211\2037\272X\300\007\362\357\335\342F\354\212u\016"
+	.ascii	"\264lb\210gP\375\344\276\370}D\242\347\323\322sT\347]\322M\250"
+	.ascii	"6\374\n\207S\333#\254\337^?\277p\321(+,\212\340^b\b\005\205Q"
+	.ascii	"\204\336\0358\253\007\361\302\354\367\251\331\206^\344=bc|M\277"
+	.ascii	"Fr\274\236\371\213E=M\355\236U\216*\341\241D\360Ji\372\020f\035"
+	.ascii	"\323\332\276\373\024[u\305\024\321PE~4\361A\240\275=\273\333"
+	.ascii	"8\022\357\255\351\312Pz {\320/\225u\016\261K\262\213T\020\356"
+	.ascii	"\355\247\371&Oxzc\221\004\031\260>8L}\360p^\255\202\206\003\321"
+	.ascii	"\214\303f\326\003\324[\212\302\036\257\252\204\241\226\322\263"
+	.ascii	"\322\376\257\377\233\004v?\305\033\333V>Y\207\3130{\360[in\362"
+	.ascii	"w\222\304\032\377\365\266\030\300A\215Bi|Y\353\220\360JT\371"
+	.ascii	"\275\007\257M\007\342\261\"'\373K\2044\251\347N\374s<\324C\365"
+	.ascii	"\032\343\330\033F\264#\303\270=#~\316\332\2764\350!!H=\274\240"
+	.ascii	"LIH\254}\253\017\221R\200\025\341\020\257M\213\236\373^\307\007"
+	.ascii	"Zj\365q\241Pc\316\227\221\230_=R\272\034\351U\301\262\347\262"
+	.ascii	"\202\036#\304i\315$\026\321\243\343\215\354\374\376\362\217\031"
+	.ascii	"\034Nj\217\270\315\261c\017\325FZ[`\306\200\021\232\023\275\322"
+	.ascii	"\341\357\367|\307\232[\263D\262N\235\r5?0O|\202\346\317\327`"
+	.ascii	"\316d\255C\337\026\260jB\251\354,\341\304\336<\206\232\375\307"
+	.ascii	"\331\370)\253\031\323\367\005>\035\271\200}\3728`N\333\263W|"
+	.ascii	"\377N\f\201\f\303\323\221\224\267P\030\323\350\333:\322\271\207"
+	.ascii	"r\262\252\276.\230\271\376\307\371\365p\217\242\tJw\315\337\275"
+	.ascii	"\314\255\261P\003 \235m\313j\005\005\245\025\251rs\b\253\307"
+	.ascii	"\n\351\356?\246\357D\361\371K\006#\020F\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\026\003M\t"
+	.string	"2\311\033\037\020g\2451\347\340\356\031zQ\314M\236Q\326\310\337\""
+	.string	"*\240\325:\353\322#\353\211\334)\005n\301\021\234\003\247\300\031\240\003\030\0243\370LD{\271\2665\353\\\251N\211:\231J\230J\322\221(\004\372\343\331\216'g\2636\302\247\311\354c.Z\266\242Rt\242J\024r\341\240\265/{\354\267\346h0\364\\\354+6\241\237\235F\304\016\001_\250\260\024\215\222\016\240\002\242\"\342\006\022\340\204!\006\205TU%E6\n\373\261gjl\210k\020\254K\017\332W%\214\376Gd\022\210\346\302\332\241\322/\312\210de\224n\275Fn"
+	.string	"UWT=\332Q$f\363\375\244\247\204&[\272\r\302\332!\335i\033P\217"
+	.string	"\ndi)\037w\033\316/\216Y:/}\365J\323v\325\316\356\260\272"
+	.ascii	"q\0072\322 \025\004\220\254\\F\032\264\2275B/\307\004\351C\204"
+	.ascii	"\222_\200J\243\264\245\360q\212\314\377\323\216\320\023\220\030"
+	.ascii	"\235\211\205\302\354\360\314y:/\326\207\fKP\311\346\304\2435"
+	.ascii	"\033DR\344\234s0p\220\324T1"
+	.text
+	.section	.gnu.lto_.inline.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\037\027\3559"
+	.string	"\226?\332GpZN:\223\202\b\0312\333\305\240\363\214g\021\004\254M\372c\364\265\246\322E\350\0279\325\336XK\025\356\003\275f\334\215\315\275}k\373\323\036\b\354\227\366I\311nR?\t{.2\320\264\322}\337&C\032\331r\247\270"
+	.string	"\304"
+	.string	"\322"
+	.string	"\304\377Cl\335\226\330!\226Rb\2078\304\177\237\036\036\001;\001\210C"
+	.ascii	"\253N\016\020'im\325\230t\210\247\276\303\005\246$c\271\356\363"
+	.ascii	"\003/\222\2350\363\250\020\257X\035\232\253\365\002\376&\306"
+	.ascii	"bG$\211\203\247+&$-\007\203\017\377\243\245=\362\002\2358Iw\353"
+	.ascii	"\\\370\253?\316s\320\037\207\177T\275z\274k\361k\361F\313}F\373"
+	.ascii	"h\037\257\366\325N\342\257}\344mv\367O\247\177\243\277\377Bl"
+	.ascii	"\377\353\004s~7*\210\377\350\324\377k\253\360R!N\376w\333\304"
+	.ascii	"[\335\rt\033>/qw+\323\237\211\321\350\236Z@\374[&\326\243{j\361"
+	.ascii	"\374A\347\031\006\327\207\303g$;\257z\204\255N\034\006E\033\327"
+	.ascii	"\332\304*\230\314(\350\325\027uy7\324\247m\233\377\220\305qx"
+	.ascii	"dn\026K-bk}l\323\tl\357o\337l\021S\301\331\036\2462J{8\351\253"
+	.ascii	"\002\223\026q\322\376n\243\256Z\230\037l\177\376\347GK~\227\235"
+	.ascii	"q\205% bkm\030\330\224\257\0017`\201\027\352\266\330b\305$J1"
+	.ascii	"\2132\263\273\025U\213F\364\305\356\244&\360\250"
+	.string	"zT\375zd=\030O\274\204/\276h\274\321\366m\231s\305R\210\204\026\373\270\336\3307\332\356[\356>'\361\033\331[\247W\273\223.\333\226W\003\277v\037\331+mL3x\264\273\317\304D\037\356\363\371$\222\376U\177H^\314\3355x\272[rkq\005\336\341\266\361\245tw\200s\b.\273\373\367\r\327MH\032\016b\323U\033\263+2\274\206\337r\0269'\0313\243x\331\304J\214=\342 \203\322\205a6d\356\253Usf\317L\020W`K\201\255\275q(\250<\177\216\301r\017\261<\037B(~\002\005\310\214\340/\334\337\377\304W\335\035\344\326\335\t\212\026\242\030\313\212\026\024\313\224b\025wG\270\274\313\213\376\273\343\242[\311\243\022\toZw\023\201B\307\241\321\3357m\335\275^\302\377\247\273V\244\313\206\235\022\305ZmO-\226\354\021\354\355\331>\305\036\033[\035\206\2554g\317_Q"
+	.ascii	"!\265\371}\351\327\004\301r\266\232/\217\377\353t\321\340\361"
+	.ascii	"\330K\277\216 \227\342\363\023\\\272\373\200\031\023%\226\356"
+	.ascii	"I4G\\xc\305N\247\216\035\267\345\346\256\300\030\355T?Z*\367"
+	.ascii	"\344\326\342~O^5c\274\221\311\255\027\241z\371\252\302\264\371"
+	.ascii	"\224\022\013\007\2320\352\221\f\342KW\275T\224R\253\006V\323"
+	.ascii	"\370u\326\266\345\301\241\354\337\245g\246\267\243>\331=\271"
+	.ascii	"58!\217.dd\fQ'\373\3339+_\260\330\rU&\313m\\\325\242m\364\350"
+	.ascii	"\031E\262J\334\254\236"
+	.string	"\325\244\333\353y-\236\213\347\"\022\033\317\306\263Eu\376\033\261}\022Xu\2029ZR#N^\315jv\337\310\221\314gtc`\3261<&h\353\227|Wj\035p^bk\326\262\253L\360G{\006\210o\343\371T\263\340\036\2348\201\316\250\3411\032!)I\222B\2419\341\004\2041\346\230\203\346\001\022\340\0229\005\342$\306\020!\f\315\210\004\022\211\210$%\005I\n\222\016EK\354\206\200\006\3518\310\344\352\266\031(B!\025\224R\352\275\272,%\334#\357Qik\r|\305\262\274$\310#B\236\314\257p~\214\363\231O\350l2\026U\321\374+\244\227}^\003h\325\276\242\272\030M\235\212a\330zN\243\300]\b;\003=\276\023\336\032\344\204\026\320u1\006\311\\z\321\017\227\027\020\315'1\352l\210\001\r\302\302\023k\322\312\372\221r)N\217L\220eQ\361\233\201R\231*G\004n<\322"
+	.string	"\322eF\221\nV\212\312Q3\007\232\262Vk4$\303\326\213\271G\214\265ai\206\307\306\3141\312\357^\016\004v1 N\216\013\272,\037\333\374B\346\355\225a\t\312\002\030\007d\337us1\353\315\274\230\347\302\361\273B\tH\2311\250]\032\262&\205v"
+	.string	"\233\204%A\210\016z\035Wu+\274l\275Z\303\031\272G\240\031\315\270\224\004\331\306\250\347{\t\2120'\325\331fR\337\025\205\021\216\233\307\021\343I\020~2;\227\356\371'@\177E\251\033\333\371\375\231\0204\240\335\234\276wy\303\354$O\345q\236\025}\301\002:\3016\2020\275\343 E\327\251r"
+	.string	"\321R\016\007\367\2620,\335\007\246\307!Q\250\032'\307\241Gy\317\2630/\343\017`\271 \360\327\220\311\253\335\236m\341\254Wf|\331\275w\354}\374Y\005J\214a\336\205\341|O\307\340N<RB\331\371\361XW\313P\342\226F\336\365Z\217\006\f\b\\\351w]@\202Q\242\371\223\312qF\002\023\255?\312\006\305\376\177\2304\"45\200p~_\300\0344\250F\242\013\001&\266\267H\222\335\213\020\275\n\342\021\270\037$|\232&\0363=\213mp\340i\225\214\203B\023\302\360J\321x\335\246\177\371Q\003\320\245\244\222\302\266\240\352_\352\007\374\376\337\017`|\t\375\312\377x\021u\322%\315\321\004\220\371@\320\207D\030\362\206!\275\346\nM\003O\375Q\200\263]\324km|\227\236]@\241\2222\314O\275+\336=\005\333\212\252"
+	.string	"\\,\215(r\345\036X\026\034\360;$\241\205"
+	.string	"\247\220\330\224\375\355w\246\253\003\b\361\307\245\260.\241\266\035\243%\007\226\027\020\251\236\r\323\211\212|\265\026\006\022\302\276\007\211\023\340"
+	.ascii	"\200\004\334\2348\311\217f\3358\203\236\307+@+\260\267\307\020"
+	.ascii	"\252\374=>\211\026:\357\316~\344\256\223\227M\255\303F7\2435"
+	.ascii	"\3440\025\241\254\360N\200\254s\006\251eH\200\305f\036\302\331"
+	.ascii	"\035aL\300\202Y\360\007\310\t\261tr\211\307O\230x\221\333d`\231"
+	.ascii	"\n\233\267e\020L\334\207\330\331}\256\360\336\304Z\262Z4\274"
+	.ascii	"\250{\b\\X\235\262\300j\002(\365\300\271\275l\200\252w\330\331"
+	.ascii	"U=\200-;\270u P\311\3272\204\243\247C\225\257\307\341\350\324"
+	.ascii	"<\227\320\r\213M\210\210\262\375\026\243Pj\277\313}'\035O\223"
+	.ascii	"\365r\005\032\365\260\354\360\1776\247\225\365d\335\377z\235"
+	.ascii	"\356\035\rq\037\262\363\333\201\254r\344\377\300b\024O\271\364"
+	.ascii	"\367\253\375G\257F\331\355\312+v\252\365#\323\355\265k\321\337"
+	.ascii	"\272_\313\2749>pe\177\353\376z&\377\230\336\313\366\017\3519"
+	.ascii	"\212n\021\035\322\375\321\267:\276\373\351\f\314NTN\2300T\024"
+	.ascii	";}&3r\226\257\033\265\237\f\370\306\332Pd\340\206e4\303\177R"
+	.ascii	"%\017\210\355\363\363y\372\021\321\203hr\203\253\325\323\242"
+	.ascii	"\315\250\3032\317\353\205o5l\253\232\200\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\2135\205d"
+	.ascii	"\212vT\031<P\3566\007.\314C3\261\253\322\213\205\255\277\344"
+	.string	"\347\021_'\177r\217]$>Z\357\252\355\312@\326L\326\226\245g\275\017p\rn\337HM\235{\377\377\277\275\2315\261\265[J\231\002\217\001\213\001\177\001\232\254\255\321\305\032\231\032\230Z\225R\2235'50\"\246u*\365\246-\242\345\221\223\346\013-J\251I\232\022\032\221R\327L\351\342\336\204f\277\333R\244D\245\256\355?\245\256\251\331\357\306Sj\022\3579\033\315\316\262\227\314J\315*\031\232\32593\2732\013#M\255\331/\271\211\224D\372!\337\220]H%\243d\227JM\"j\263_\331\234R\223252+\245\256\311\302FR\343%I\343\2407\373\035\363\264\031\271\214S\306$\242t%\235(\316~\265\235RoMFO)5\251\303J\275\347\354W\023\311\234J\275\237\230)-\242\263\337<fg\2779\316\235\375\346-\271\t\250Gy\366\213\355\354\331/.\203\251\214\355\027\277B?\373=k"
+	.ascii	"\332/\013,h\277 \252\212EB\373\325\322EC\373=\240#\"\332\257"
+	.ascii	"\255\324\244\226\226\242\375\312p\021\317\301X\016\316\370\207"
+	.ascii	"\214\366\213K=b-\234s\255V \005\212\023\231H,\342\031\203\027"
+	.ascii	"\323\302\031\177\221\230G\023\231X \023\2530\316\013\020(\310"
+	.ascii	"\355=\216x\350(g<tD\346\\\302\300\203"
+	.string	"\007x\b\351\007\214\215\341b\325\224@\226\326XZ3E\020v@j\\U,b;\030\327\301\016\310\307\016\310\214u\261\370\"\353\277O\037\374\212\310L\304\243\330\177\376\307z++\374\220\310\374\217!\340L\304x8\211\314\370\201y\024{<\212\341o\2215\371$2Qc<\373\177\tOz\372\237\240$2\035hH\344\310\320H\2201\234G&\3633D2.\031&!q\230\027\2420z\f\347\025d\376\031\033\234_\357\321|\206L\306'C'\244\025~M$\226\351\035Y\230\265\036\2033.K\273a\377\211\304q\374\220\361\212\214k\030g\037\377\300\f\205\314\305\342\003\377W\365\377\367\377i\016\207\3531\2242\346\177\221\307\2141\217ql\263f\263&\023$@\377\377}\037#c<\254D\346\021\207\303COd\346e*L\245\306{\366|\310\277\242[!3\006\303`\343\377\237\377\277\305?+\013\353\3019\003"
+	.string	"\240\343?\307\377\337\370\267\36144\032\234\363\036w&\356q6\303z\364\374\377\371\203q\241B9Ch\324H\343\341%2\2233\2368\326\364\026\254\265\340\024*2\321\003\306X\313"
+	.ascii	"\3028th\f\302!\277\306\370E\004\f\341\305\211\274w\327\2325\371"
+	.ascii	"\377&\020!\302\203\203d\022\377_!\204\037?y\254*\236*\026\301"
+	.ascii	"\300\262\346R,bb\326\0210q\f\002&\344\023\227\257O]0\021\350"
+	.ascii	"a\230\207\231*Q\251I*@Tp\250\260P!\331Tj\222\313~o\212n\202\274"
+	.ascii	"\354\367\226\006\314~oR:d1\354\007\347|\013+K\225\232\374\204"
+	.ascii	"\311\021\237R\337lo\376\263-\215\315J\2517\005-d(\346q\231\037"
+	.ascii	"\222\031\232\3118\f\313\264m\312\022\233\020\"\250Z\246I\207"
+	.ascii	"JM\022\302`\377\271\b\030\330\220\0069\327\002\211\225\001\274"
+	.ascii	"\254\007\266f\357\201\002[\223\307\253\352\342?\223\307\303z"
+	.ascii	"\267]\327-\223\307\243\341\276\366T\317\305\275L\027\375\241"
+	.ascii	"\251\371\013\266'\n\274\242\375\251\362\255\223\367\323\344\342"
+	.ascii	"^T\217e\245z\235&\200,\013m\313\201\\kz\365?|\270?uZ\247\216"
+	.ascii	"|\036ou\203;\323\267sW\025\353\177\370L\0360\265\355v\234je\371"
+	.ascii	"\026\356;\313\271N\226\373\314\036\377Q\375\217\345\246\333\262"
+	.ascii	"(\317TW3\025\360W\237ra\233vU\345\276\235\251\256\250\313\323"
+	.ascii	"\025\310vWE\315\035k\340{\352\272+\353s\315\356r!\352\356\270"
+	.ascii	"\311\242\334\300\263\375D\205]l\312Q\266\267X\177\366\235\352"
+	.ascii	"\325\252A\263\267\301\253O\327\335\352\256,0\353\315\037\027"
+	.ascii	"\320dWw\375U}\017\246\\h\366\364DMw\365\265\347\325\367s\375"
+	.ascii	"\231\275\340V?m\337\362\316\243}\007z\271f\333]\316\332\276G"
+	.ascii	"\313\177\346\331\323-\336\242\247\331\362\002|\3733;\033t\201"
+	.ascii	"|g\256\254W\317\3527\264\272\334N\227;\323\216\222\310\231\250"
+	.ascii	"z\035\247\016\207\354O\235f\361\365\037\344\037H\212LL\361\343"
+	.ascii	"\377\265\0364\b\0177\2219,\353\361\023<\212\200\323\244\033i"
+	.ascii	"}\201\372\332T\241\202\242\257N\240\276<\031\311Z\203\301\031"
+	.ascii	"\247\305p\3169\037\372\n\365U\352k\0249\244\017\035\004\205\""
+	.ascii	"\334\276N\351A_\3051\303\377k\r\217\f\205\214\032p\337[\323\034"
+	.ascii	"o\315\235\352\b\233\313r\267\315\365V\025Y\317\353\354\306\372"
+	.ascii	"\026\355\342\001\236]\335\035\347\231\253\033\344\005\376\324"
+	.ascii	"\345\264N\335\354\333\216\200\355Bnv\261fOE}\356\272\376Zs\307"
+	.ascii	"\022PyOCP\220pA\002\0062\345q\267\203\260=hu\016r\270\026\025"
+	.ascii	"v\026\353\273\313\317\334\217EI\340\276\325\345Z\035\371\352"
+	.ascii	"\217]y*\232;Y\276\202\300\372\366\307\325\234\313\343l\210\023"
+	.ascii	"\266\234\013\333\2639\027[E\177\267.\376\273}\227\256\213\202"
+	.ascii	"\314\366n\020\350\006[\334\276D\205\331\007u\372{\312w\255i{"
+	.ascii	"\255\240\216\366\275\307\335t\025\246i\337\271|Kh\365\354\332"
+	.ascii	"\252=\206\253v\226\r\356p\337\177\250\013\\\327\224\366[\325"
+	.ascii	"~\232m\333w'\n\304\372\023\375m\326\347\322\236\366\256\212\256"
+	.ascii	"\300\036\274\263[&\007\272U\337\356X\332\257\300\256n\356\330"
+	.ascii	"\375-\371\355-]\331\355\333\271(\220\306\305\275fi\027\366\224"
+	.ascii	"\366\"N\270\350\361\337\354I\333\367\235\312\205'7U\364g\236"
+	.ascii	"\270\2533\200\005\266\273)\312\253\372\037\276\2523\353\201\301"
+	.ascii	"SE\271\250\376v\325\305\323\316\232?\266\273h\226\f\025]\341"
+	.ascii	"~8\323\325\327v\326\347\016\360rQ!g{&\352\252\034\353U\224\367"
+	.ascii	"\314te]u\335\231\355\026\277:{Y\217\266*g\335\001\264w}=\264"
+	.ascii	"s\231'\313\271\330\225w\366\036\202\340\250\302\002\241r\322"
+	.ascii	"\314\210\210H\222$\351\022\n\020\206\205q\032\327\032\365\022"
+	.ascii	"@\362h\212\3428\f\243\020!\204\030C\f\"\n\tDDDDFDd\332\001\372"
+	.ascii	"\031 \304s\326\201\b\211b\231+\t\262\300\256\002\222K\356\270"
+	.ascii	"H\201\034\240Y\311\013\315\353\316Lk\212\310r\363\350\311\345"
+	.ascii	"9h\261QD\351\217\244\354 \tR\325\207(\354\352J=\301\335St\344"
+	.ascii	"\272\021\373\003\3719\"\254\210\353nY\bK\006\004n\247\307M\262"
+	.ascii	"\020\242\025\037\330\203\005!\273\202\276\355,\340\250<O\356"
+	.ascii	"\216\204\026\200\022\002\020\356^\300\032\247\0316\326@\267\026"
+	.ascii	"\331\300\004\213\377\370\212I\013%^T \342Oip>n\b\246\200;\246"
+	.ascii	"D\t\276\\\024SR\2160\017\013\237\300\032\270T\277f\237\274(\214"
+	.ascii	"\356CN\316\341b\203\034}0.\3708j\243\336h\372\202k\332\342\021"
+	.ascii	"\244\352\025\005]\032\323`\214\035\263\023&x\231\200\275\337"
+	.ascii	"7~\302J\020m\001\274\302/,K\372;\235\204Nbz\360\362a<#\360\024"
+	.ascii	"\275bb'3\035\342s\241\210\240\360\200\266\315\211\230\22088@"
+	.ascii	"\022S)T\034\274\203\315\t\253\217\255saG\267\235S\314\314\367"
+	.ascii	"\005\353\026\342\241\255P\027>\220iqJi\363L\220\177<@z\234\242"
+	.ascii	"c{\224\252\376\002\005q35\371[:\005"
+	.string	"\342z\277y\310qr\246\262\3659\016`\036\262r\376?\375\002\200*\037\275\242x\267\225\304\254\213\363\2635\265\006\242s\242\350\370j\177g\315\262-0\002\310\235\251\322)\203\340\001K\320\367\320@\320>\230\033^\n\206\237\217H5\005\301\332\233oo\230\203\036\301\214[J\223 \363\2262\031\360\267\2417x\007D\200d/\345\333\331\361\225\352G\n<1\031K\304p:\260!\317\227\357\3473\365\204j\035\246\270>\327\023R\355L\326\306c\017.\222\207\217\024\267\345m/\207)}R\234&\347\207\006QA\bp\273\030\256^O\276,\036\356\324\002a\001\334s\352\313\3678\\\2610\274\361J\247fZ\222\017-|"
+	.string	"8<\227^\326q\371k\252;\203\223\350N\022G\001H*\027\342\023\\\003`\272\035\006\205\213\250\0205\035%\300B\257\323@\264\264\330\0368\013C\020\250\230\207\344\022\027\027 [\317\024\247\315\350\024\270\021\031\323-\250V\267<\315\221\315h\232+\371\217\237\213\361$v\312\345~\177\263s\340\020\337\033\b-\260\034"
+	.string	"\346\246\236\214%\312\210\366b[\345b>&\260\205\023'\021\256\213:\030\016\227\250o\2578\356\366v\272\363\362>d\277\312\342N\304Q\204\363H\026\336D\306\350\230\340+\"m\314\331\005{\013ML\335\277\371\361\262\001\270\202\365\362\311\310_\346\034{\341;A<\331\206'J(?\026|}Qr\177B\022\325^\220\207jT\213\276h[\233~\033\264\007?\375\202/\341\331\022\333\370)*]E\ni\377\b\203\020G\023\363D\352~%\354e\312O\241\026\371\213\230\266\274:@\233\317\031e\215\264\2340B&O\004\345\033\315k\023Fj6\366\021\034\343\270zxO\027wj\372\306\374\257\242\fU_\020\220\306\307#\217\241\310\342;\337k\033\200\027\030\243\352\363\345~"
+	.ascii	"WS8\270\"\324N6\013f3Zu\202\326B?\r\261:\031\222\230\311Mp\372"
+	.ascii	"\020\006\256\215.=\321dOil\f?\310\031\3221*\246\004(\220\013"
+	.ascii	"\004\314_\2100\237\262\2228\205M\200.\211V\322\231\343\227]\255"
+	.ascii	"\330\341o/\023\007t\031\177y\357m9s\2224\330\314"
+	.string	"\330\353\2135L\3516\241$@(\303\346\t\206M\273\227\246\302\241\210\301P\001y\222\276\323\325\350j*\006\330\216\200\206w\f\231PA0\317\252\307\267l!\224\317\231~\271F\272\372\231\352\203\315!\032\324y{\240u\2753\005\030\375\377uv+\232\324\347\314\233?N\316\206\245\227\360{\2705b\003\370\346\316\345O\215\321HM&\354\271\341Fu\260\357\026\240ML\n\351\345\337G\016\037=\034\255RC\033\372g\327\333J\212\207\216(\006\2205ZB\365\034\351+{\322\303\273H\330\363\330\347\221\013\263\372\346\tz!\222\t\315'\235Ga\251\321\3413\322\343~\201Nz\274\345\t\242\315k\367\221\376!;\2028\271#4A^a\307*\271HG\026%\354!$fzc\036\006\"\374E\251\251\027.\016\0317\265:A\322\362\372\240\363\333\357A\266\377\247\026\306EU4\337\326Z\177j\201PM^:\211N"
+	.ascii	"\365cq\037k\360\224\322\330\023\350\330z"
+	.string	"{F\222~\204\211rY\"\033b){\307,\370\240\255\346\3661\n\263\320@\023N\376\t\003zp\375X+\021\300\315\216\021\n\211\341&\365@\312\236\357\273|\231'G\360\265\317B\217I \222\203\005\027\\\261\304\r\304 \007\256<!Sw\020mU\257&\253\021\"\205C\305*\r^\200\001\227\270:\035\350\275\344\017ro\345A\031a\312\306\261\321\016\3071Y\315J\337\002\013\2566&X\t-\215\327\033\243Y\035\200;N\363~f\257\3359\243\034\203@m\212_\216\216\354e\201\223\207\200b\377\037\022\242J\350A\247\342\240`\002\r\276<\021\301\246\037\204\003\301R\221\237\374T\233|\247\206}\323\344\232\242\305\321\375\266\210l0\034e\272\020*j\271\277\025P8\236q\025w\342\274A\354\350q\030\320%_o\023\253x\267t\250}\301$-\300H\272\320 \016\2341\266L\244\bD\021\213\251\370\226a\026"
+	.string	"\021\304\262CO\271@\t\037\271\301\370\366\255\244\252>L\301Y"
+	.ascii	"\313\215S\367#\303\026\261\005\322\347\370\225\365n\036\301b"
+	.ascii	"PL\034\331\253:\323\\\366\370\021\t\225l\253\335\005s\031\022"
+	.ascii	"[4-$\312\305&\235\002\006\225\247\234\025r\271+\315\016y\337"
+	.ascii	"\226\347n\013\344\347\f\245\001\002>\341$\210\321\264\327\271"
+	.ascii	" \264\347\340\032"
+	.text
+	.section	.gnu.lto_.pureconst.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375 \217\225\003"
+	.string	"\362\210\033 P7\244\003!3C\265K\272\351\003\177\373\377\177\366w\300\277\020Nc\267EZn\020\301T@\221\267\365\261\276\325\247\372R\027uO\327tK\227\364\215\256\350\206.\350\374\\\317\355\214\234\273\271\232\23391\347\345Zn\345R\306\311(\271EN\310\3718\035\267q2\306\305\250\030\021\277\016\327p+\214\204;\030\0057p\001\037K0\306\\\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`e\005-\024"
+	.string	"\246\025H<\020S\224\341"
+	.string	"P\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P)"
+	.string	"\300\336\335\335\312\242\242=\215\343\b~\035\204\202\252\232\250\252Q\036`\331^\364\331\220\t$q\201\261'i\330B\t\004\201\373\204\304\022)S/"
+	.string	"9"
+	.string	"<"
+	.string	"e\366\277\200E\2422"
+	.string	"U\204:ERtj\345Z+"
+	.ascii	"\317GB\336sb\312\213\036P'\267\2553S\236A\321\211)\347\211V\033"
+	.ascii	"\230\362V\203\330\344\300\034\233d\223\246fY"
+	.string	"-\036d\360-\225*\231!k\301\332\310E\213J\301_\340\004\257\304\217\367\3363A]\026+zERkuUwuW\307\371\213\300\367Q; \027j\241\302\245\374RPI\341\267m\302K8\202\004\002e\365\230\342<>\035\375`\331\314\341\301Q\352\247P\363\374\206\215R\215\215\306\f\0311\n\243/@\034\320\007\346M\345\345\271\271\003[6\226M\247r\235m:\225j\313\203\016\202\352\317\223\304\365\256\327\021\377HD\b\020\317\017\357\201\035H\024\007j\303\032n\006M\271\003\244Q\030\306&s\223sY\347\351T6\200\266\250\200\024\221$I\322\030P\0021\250\312\312\003\021\260\225\"\220\025)HRPH\007`@eF\223\320\b)9\211\035>\266\027\256nk\261\316\t\027=)\342\243\023\240\272\035Pw!\"$*\254+\357Y\021V\026\0130\370z\371\003\354U}h\204\206\017ErX\3109i\306\017"
+	.string	"'\207\021\317//\360\007\n\350#\376\f\302\250\016\3376J\n\274\2018\227\212\314pB2\200aPHe5u\034\373\030m\031\213\306\001\213\247t\212\247Zu\336i\\\347\031\033\245\36464m\325\""
+	.string	"=RH\277\347P\n\025\330\245\216g\317(\2711\360\035\3561)\211\355\272\227\n\244\033M7\261\032~\300\232\361\272\036\002`\254x\320\254x\321\203\321\177\017\310\207\215W\346\035\031\376\342\340\224\257\035\242\224\221\242)\240<\312\007\221\204G\360x3\231m\221\216\016=\327\001t\247z]\031^np\221\232\007r\035\215\004%b\323\314<~\213}\023\205T,`\253"
+	.ascii	"\275B\203\203(\025\222\023\201\262+\362\344;*\343\212\276<\271"
+	.ascii	"=E\3377V\347\245}bL\253a\005\354HWL<\031\252\373cuQ\220\251\326"
+	.ascii	"\3355\206o\366\317T|)\221\361~l\217L\243\270\366\330\314L\272"
+	.ascii	"\322\323\211(\326(\244t\024\200\002"
+	.text
+	.section	.gnu.lto_.lto.6d1af7c3a32e65bf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.98.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375 \244\215\004"
+	.string	"\344\007k"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\303\336\341\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\205\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\006"
+	.string	"\310*\b\204#\236\262\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.100.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375 D\355\001"
+	.string	"\004\0037"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\001\320\017\005\001\006(\035\001\003\002?\202\210\2000\177}\277\001{\276\001y\275\001w\273\001u\274\001s\273\001"
+	.string	"\004"
+	.string	")2`\036O\261z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_blackboxHeader.101.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.102.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\300\250\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\270\377Qy\276\004\330\376\001}\301\003\230\376\001y\304\002\005\001'C\206\bw\375\001u\307'K\206\bs\230\375\001q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.103.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\004\r=("
+	.string	"F\275\341?@\246j\016\307\r\013\340\311E\305\307\340?\325\313nkq\326\306\237-a\347\246\206"
+	.string	"~:j\233\275)lka\331\030\372\200>\242\333\240\337\326\031g\234}\253\300\236\277l\3433\261\266M\231H\320"
+	.string	"\330"
+	.string	"\312"
+	.ascii	"/\f\264\315\246\n\376\376\310\317\007[p/\347\221\237/\276@8\230"
+	.ascii	"\277\017\306\240\b\311hQ\376>\026h\233\013P\344!D\307\376K\224"
+	.ascii	"\337/.\2252\354\361\035\333\257/\177\242v\rjz\307\026\024(\377"
+	.ascii	"\037\354\033\372\37096\336\237\374\177\361\037qX\253;\266\335"
+	.ascii	"\236\374\200G\035\350\360\304\371\001c\017op\307\216\273\223"
+	.ascii	"?\020\036\"9\225\251\255\261\035\273N[\376\3008\005\332&\222"
+	.ascii	"\371O"
+	.string	"cW\235Lnu\231\331\261\321\316\362\017\302\304\363\035\201\266i\236\037\032\301\233\253\036+6\222m\344V'\215\235\264\321p\216\035'\207\216&\353\372\362\032A\266#)-\215\360\213`W\327\333`mr\235\257\243mruS\003`\320\017\206m\226we\271\324\024\361\022\240\253N\352y^~\264&#\300O\037\365\331`&\273=\352\263\305\003\362\340Q\277\r&\020\207L\316\311\251\337\326Y\n\274\331\211z7\330@\033[\324\273\305\007\350\244E}\034\354s\256\272\254\330H7+\213\3728\026\347\333bh\233\b\022$\325\266z\214\fN\213\227{q\276\035\206\266\031@\201\267y\343F\352\347\340\030\347\313\205\266\271\324\244&\315\324\323\305\013\314\224\231\372:\230\001\0301a\246\276N\306\371\036\3216\223\032\364\241.\\\250\336.\013m\323\201_\271j:\317\202e\306\343\3054\316\267\006\332&\323\003*S\250>\017\206"
+	.ascii	"E\214\352\363\342\bL\340&T\257\007\247\347K\205\266\251@B\022"
+	.ascii	"$\352\353\305\023\302\212\250\277\007S\360 .\004L\375\275x=\003"
+	.ascii	"D\334\210\037q%\276\304\235\370\023\217\342R\274\212[q-\276\305"
+	.ascii	"\275\370\027\037\343d\374\214\243\3615\316\306\307\034\351q\\"
+	.ascii	"\216\2379\232\253\371\232\327q7\207\363;N\347\261\353\361:\347"
+	.ascii	"\343w\376\307\361<\220\013\362=\347\363Bn\310\377\034\320\031"
+	.ascii	"y#/\024\361^\337\343\337\007\362`/\344\213|\330#\371$\317\344"
+	.ascii	"\233\374\223\020\037\005\004\212aZ\222\016\312\213\251\360@\250"
+	.ascii	"\363m\270\344\336;yx\206\0136\333\022%\331\007\341?b$\373`|\224"
+	.ascii	"$2$;\241\331\007\371\312^\b\017\377\207\217\354\2051\322\333"
+	.ascii	"\363\370\256\374epR\220p0\177\031\201\300E\212\362\233\301\005"
+	.ascii	"\222\016%B\224\337,^\243\344\327\227\377\f\016@hP\376\263e\026"
+	.ascii	"Kt\323vu\241\264X\026K@\271\026\211\256Y\272\200:\221\302H\304"
+	.ascii	"\221\016K\253\254\264XdM\250mR\351f\021Y-w5\002p\323\252\033"
+	.ascii	"J\245k\\\335t\305\232\323v\325*\246L9-\"\225.\026\t\266MK\234"
+	.ascii	"%\321hl\315\322\304\t\022l\233#\237e\r\227e\213R\252\232&\225"
+	.ascii	"\331F\325j5,[\326e\213\303\222\275\321\256\306a\251:\341`\253"
+	.ascii	"\256\324\024\253\352)\213\230\026\237\324\326\370\344\024\241"
+	.ascii	"d\265\326\366\311e\331\366I\251t\325\025k\225jYW%Z\255\255\326"
+	.ascii	"\200\262\345\364\234Nk:\355\326vZ\256\347:O\353i>}\327\200:\257"
+	.ascii	"\0075\241.\324\206\032\260\003\273Q\013v\241wy\017\367\341@\374"
+	.ascii	"\313\207x\200\377\250\241lE\314R\230\362)d\031\003 #\021\031"
+	.ascii	"\233\016\021@4\207\fA\b\223\252\251 \307\315\247\254\023\251"
+	.ascii	"?\227\276zK\265\363x\203\351\370\227d\375\203@\026\311\3518\211"
+	.ascii	"\300\313\b\\\271S\001\217\013\320\323\201\373\270\224\216\231"
+	.ascii	"\020\260\347\341\255N_\026+\240/\264\022\301\201\004\272\342"
+	.ascii	"\b0\274>^%l\rh\225\032b\230\016\005\211\177u\321j7>CZ\003\333"
+	.ascii	"\035\203@\325\373k@\2152\340\211\342#\003\036G\201|\f\240\371"
+	.ascii	"V\255D\364\003\250\257\275\333/o\342\220\372Q\236\357\325/\262"
+	.ascii	"\005$\330v}\357\346|A\372A\324\337\356Y\320F\3711\005^8\276d"
+	.ascii	"\200&\260\200_ \300\025P\236\215\306\210\020\243\316\344w\255"
+	.ascii	"\234#/\016\347\374C\031\356=\330\213\354\250\374g\244v\026\305"
+	.ascii	"\376\217\361PO\n\271#\340y\206Y\362\237h\344\303.\304JL\034\367"
+	.ascii	"\036|R/\316\351q\365\n\327\376\217\373\007\351{\361\221zp^\277"
+	.ascii	"\253G\224\366\377\240q/!\020\233\353\336H\374\256\342\274i\177"
+	.ascii	"\334%\005\027C\363@\022\241\205\376\177\\\234\202\355]t\t\211"
+	.ascii	"\bq\375\211:\333-^\375\003#\204\320(\236'B\025\343\026\240\321"
+	.ascii	".\304\253\367`\222\003\272|\331\302\262\0259[A\250-\334\f\365"
+	.ascii	"\035<\206\260n\242V52\221[\210\250w\206O\033\327\210\f\370\013"
+	.ascii	"\325\270\266\351Zv_\210>"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.104.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`<\001\025\013"
+	.string	"\204\021\272\001"
+	.string	""
+	.string	"v"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\255\222\351\311\n}\276?\202\210\2000{y\277\001w\275\001u\273\001s\273\001q\274\001o\273\025\001\006\005\001'A\206\bm\230\316\004k\302\303\005\005\001'L\206\bi\330\315\004g\306\307\004\007\001\005\001'Z\315\004k\314\315\001w\313\001u\274\001s\312\001q\273\003"
+	.string	"\330\314\004k\321\322\001w\320\002\005\001'e\206\be\230\314\004c\325\326\035\001\026\n\005\001'q\206\ba\330\307\004_\332\333\331\3308]3\334\0014\327\001\324\001\323\001\317\001\316\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\022GPS_ground_course"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\nspeed"
+	.string	"\raltitudecoord"
+	.string	"\013numSat"
+	.string	"\005time"
+	.ascii	"! \360\"\022\233\007 \030\376pC\030!\002A\2242qO\264\363\030"
+	.ascii	"\343\363u\221VpK\"\335F\207\3148Oh\250\247dlBP\376\033\222\303"
+	.ascii	"4\306\261\333\255\374\267\3212\376g\270yf\277m\255S\326\305\320"
+	.ascii	"\203)\002"
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.105.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\330\312\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\230\325\004}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.106.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\361\313\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\330\336\004m\302\303\003\005\001'W\206\bk\230\336\004i\306\307\002\001\005\001'f\206\bg\230\335\004e\313\314\312r\206\bc\330\334\004a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222]\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureFields.107.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\375\b"
+	.string	"\244\r\237\001"
+	.string	""
+	.string	"E"
+	.string	"\005\001\006\035\001\006\001\005\001\006\030\001\002\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\360\315\n}\276\001"
+	.string	"\005\001?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\025\030\330\356\004}\303\304\001w\302\005"
+	.string	"\230\356\004}\310\311\001w\307\004\005\001'7\355\004}\314\315\003\230\355\004}\320\321\002\330\354\004}\324\325\035\006\030\001\177\005\001'@\206\bo\230\354\004m\331\332\001w\330\001u\327\2748k3\333\0014\326\001\323\001\322\001\317\001\316\001\313\001\312\001\306\001\305\001\301\001\300\001"
+	.string	"\bgyroADC"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.cRaw"
+	.string	"\005time"
+	.string	"\034"
+	.string	"X\r4Xu\254\326\th&a\243&Z\367\245\255,c\220"
+	.string	"\206V\225\331\307x\001\f\255*\263\222\361\002\fi\203\241A'\300P \031\020\004\350d+C\275\342"
+	.string	";\"4+\254\326N\021p"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.137.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375 \375\275\006"
+	.string	"\222L.4Pm\222\016$\207\250J\3316\267\324\335\310h\021N)\3122v\336\237}\373\267\205\206:*\270Y@\214\346\231\231E\024\321\207\013\2661\363g\265\266\265Md\nW\231\bk\223Pi\0246\217\001A\263\360\252\313\341e0[\r\007\327{\260\254\353]\266\354\210\001\037\004\335r*E\304\2066@\355\250\007\347f\f\321q\325J\335N\245T\021`\342\343J\277y\034Z|\247\304\212\337\215\316\335\t\243Q\202\205d\212J(IB\201\220~\354/\023\024`g\3350D%\211\204>N2\267\207\027\315\352\262[\216N&)#\332\310Sg1\310\314\2356\222\350\330_\340\037\370)\002\n"
+	.ascii	"`\251'3 \f3\205\273\021\312\022\327\304\307\210\274\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.140.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\037\027\365Y"
+	.ascii	"\252\225\314 P0\220\312I\007l\261\355\212j\275\251\253I\267\252"
+	.ascii	"K\005\345\336\225\251^\\\217\236\205*\261\331t\034\317\220\252"
+	.ascii	"?\212GO\302\212R\261\205Y\302\001\224\032\b\302\200 \204{\244"
+	.ascii	"lpo\251,z\252z\323Lu\376\3761M\325"
+	.string	"\377U\265~\211\225R\246\020\002\271\001\370\001\374 \016?\007\310\3079\037x\376\r\312\257\225\217\336\360\177(\277+\237Q\3762\260rzL3&|-\304[\332\243oMZ\207\352\300\344\377\322\265\260\204\013#\007&\313\332\227\233'\313-{]\210<,\271t\331!\314\236\226m\262\0343W\235\313\2745,\0344f%\217\311\026g\2664\342J\215%\233=8\346\262o-MS*[\005\204}\373F!\243\262\007\302\267\206\265A\204};\017\021\271&L6\021\376\340\242<\177\t\177\360?\363\277l\333V\302:G\370\365\244<\212|\345\220\246o(.\005\\4i\203\352\242\277\005\252\213\376\277\325U\tO\356[Z\217\233\036{^U\366\322\364m\252a\330\344b\255\270R\221\302\252\212jJ\n\305\321\030\005U|rjbZR:\221d\002\351\310\250D\021\021qH(h\b\364\343\323\303\263\243#\f\346\340"
+	.ascii	"o*\372kN~\267\026+\270\346\004l\305s\257\314<Y\205\231<NA\306"
+	.ascii	"\t\nVe\266\n\257\fS\341\221\341\2516R?,\2120?\3601\214\017lL"
+	.ascii	"\"\212\323\232{h\240n\334\205\221a\343+z\331\2479/\3544\227\205"
+	.ascii	"\233\316,\323p\257\t\006\315\322\t5\2618V\212\333\023jb8p\322"
+	.ascii	"\225\033\330\004\230^\323\013\222s\217\234l\324\306\306%dh\342"
+	.ascii	"P\024e\211\2420\021\312\032\017\3454iJ\021Z\262AKx\250$\t\003"
+	.ascii	"U1i\376$\3619\322\223\266<i\274s\306d\235!M34\302\r\253k\222"
+	.ascii	"\241\t.W\331\346$\251\211\2251N\013\300_\024\323\207\025\326"
+	.ascii	"Nl\371\013\022S$o\325\304\310\370\346&\313\307j\312\tzl|.\370"
+	.ascii	"8\263\025\310\302\242\3011%\377v\306L\370%\245i\272n\313)\214"
+	.ascii	"\361\340\246\003\323\303\027$G\204\230a\221s\223\302$\006\257"
+	.ascii	"\234\261\2563\265\341\302\314\326\005\261!~\370&+M\323\363\327"
+	.ascii	"\230\217=\213\375\177\035\374\307\372\201t\004)\217\025g2n\341"
+	.ascii	"\201o\222E\017A\004\274_\021\324E\225z\351\226\333\334d`\266"
+	.ascii	"9\271\270o\307lM\357\327hOj\356\035$S\350x0\022\337\346^\257"
+	.ascii	"6\\\334w\036\376sT\300\373\265\3157\330\t\251\353\352\255\357"
+	.ascii	"\230\335\276\272=\275-fc\264\206\246\256\201\234Y\370\223\250"
+	.ascii	"J\021\3738\377 rr\002\3678\213\021\3314\001;\253\360'\221\315"
+	.ascii	"r\210Q8\177\t\355\261\255\261\362\354\365'\261\3132\210\273\316"
+	.ascii	"<\376$r\3612\354\343\224\267|\200\230k\276l\376\\*yL\263\036"
+	.ascii	"\276/\022<&tX\035\333\232\021\337#\376$\232\321Q\363%\342O\242"
+	.ascii	"\020^\204z_4\301\033\314|\2379\273C\322&\224&e\276C\374I\224"
+	.ascii	"[\342\004\261B,\231?\201\013\004\326H\373\364\330\326\322!w_"
+	.ascii	" \376l\221\267#\324EW\314\377\347\312\001\3014K\323\255e>\371"
+	.ascii	"+\205Z4\251\351\210\350\301Lc\3406\377[\327\376\322F\373\367"
+	.ascii	"\227\246i\3726\362\347\360qT\376\215\312\267Q\3715*\237\306\371"
+	.ascii	"\013T\276V\345+P\3713*?\201\312\227Q\371\bT~\214\312?\240\362"
+	.ascii	"aT\276\001\225\377\242\362\0138\337E\345gU~\213\363\t\250\374"
+	.ascii	"\001\316\027\240\362\0038\037\200\312gq>\326\371W\347\247\250"
+	.ascii	"|\253\363\253*\237\352\374\251\312\227:\377X\371\306\363\243"
+	.ascii	"*\037\352\374\342\371O\225\357t>\323\371K\225\257\264\316\335"
+	.ascii	"$!\037I\310?\022\362\215\204\374\022B~\221\220O$\344\023\205"
+	.ascii	"\374!!_H\310\017\022\362\207\347\003\241\374\037\224\357s~O\220"
+	.ascii	"\317\023\344\357\344\360u\316\027\326[\254\007t\214\271#\231"
+	.ascii	"\313\226\003z\347\214\224T\234\026\246\211\201\265$\225\314q"
+	.ascii	"\016I&\311f\322\t\357W\322I]\024\007\025[\346Aq\246\331g\225"
+	.ascii	" 2.\023\217K$\366U\021\021\f\306\002\246\226\264\305j@\303\320"
+	.ascii	"r$\313\305\031\320\253\205\330h<e\201\315O~\300\346\267; g\266"
+	.ascii	"x7V7\024d\\\036\036wh\250\261\204\202^"
+	.string	"\264\034\330\0221j\356\360z\266X\013\350\027;\034\311V\252\024\320\273\303\260\3364\25351p\033\250\177\222\206$\024\336\257\233\3467\273#\352x\344\005\021\343\323\003\312j\027\277-\326\026\235\305\345Hvs\266\350\345\262\313\304sr\231\260\317\372i\264\001\232\200&\216\361\322\201\267X\003\350\001\272\034\311R\242\004\320\333\205\271|x\214\313;\307\025\022\352c\017\017\013$H\326\330,\276\034\311k4\030{\277\3544\332\223m\265\226IJa\031\222mKG\346\277\007\354$\351\366D&MS\026.X\355\0050M\323\025\213\236\233\037\300hJK\262A]\264\366\322\3419\373\372\372\316l\261&5\332\225\213\222yV\302K6\370&y\f\0312zWXn\341[r\265Y+?\352\370\364t\202\035\265\034\343\325\206\253\201\n\325\301>{\261\320\265\305j\325P`\216\344#iV\275`\222\020\346\030\227q\216\033\024\324"
+	.string	""
+	.ascii	"\203\303\031h\350\312i#,d\251\274\200\275@D\315\035\233\255T"
+	.string	"S\2059\222_@\223\352\r\323=\312\"\242\340\020\265\363\307\256M\021`\243\255V\355\336\261\233\362\317`\"Zg<\204\206\r\0348\352\242\375[\263\224\343sr\341\355\263n\032\355\214\032\227\177\307\035v\n\377\260\005\250\265\321\276\033\204\204K\032\332F\3767P\235z\335v\t\007\260\"5\250\271\303\003\246[\254J\355\324u\214\327\262\213\373\276tGr\231\003\3004\031\354\320\341\201\016\n2\330\221\003\3479\244B\3301\201\0059$\270`\202\251\ftH\200\301T\016\016:\230\2222\361\035\032T\300\301\224\007;vp0\025|\343\3326r,e3\313\212\245F\241l2\255\230\332Iy\366\224z\352\241\362\314\031\265@7)\317\302\240\212\315I\232f\274\346\212SMB\023\017n\216\211\247,\317)\313\234KU\275Y\224eaH)\332\311\n\331\222\242\253vR\006q\nau\005b\304\217\213\036*\201d\361!"
+	.ascii	"\b\263\347\330C\345\217,\302\250\336<\345\017f\020\200\336Ik"
+	.ascii	"\206y\315U\001b\234Y\0037\307\273\311\nt\240\346\356\372\332"
+	.ascii	"\355\263\272\257\257\317\006\254+\343\262\212\343\"!\365\322"
+	.ascii	"\212\2536RVq<\301\356\266\324\334u\212\243\327\206e\247\333\020"
+	.ascii	"f\233\n\255\372\323\035\245\007\263\321Z\363Cf\005\212s\205}"
+	.ascii	"V\212*\3432\325q\217\216\232\311\252\352F\017`vD~6\372F\225#"
+	.ascii	"\231o\317Fo\025\252\031\326\247\271\f\027\301F$\333\306\222?"
+	.ascii	"~\324E}\372\0032*|\313\261-\0061\205\302\270|<\256\221Q?I\241"
+	.ascii	"\250\341V\003\215\256\001w$\247AC\243\027\356\330\303=\315ow"
+	.ascii	"l8\354,\007\243V/\260\n\264\326\225#9o\b\005z\257\244\260\317"
+	.ascii	"\212\342\351\235.\366zm\351\"\303xI A\222dduQ\236\306Y\352\364"
+	.ascii	"\316\030\016\"Y\226\024\222<;\253\213\352\254\201\262<a\213w"
+	.ascii	"tuPO\306e\247\343\226(\321S\305\247\031q`R\210\250\271\333bM"
+	.ascii	"\240g\304\035"
+	.ascii	"\311"
+	.string	"vb\022\350\215s\0226/\231\342?Y$\211\306\373%\004S\327\265'\344\215O\257\251\321\352\226\351\204qY\351\270EE]\265\324h2\232\230`O\304\360\260\b\264\f,G\362\017a\020\350\305\202\323t\363\2414T\347#\310\2116\302\3024IGjN\017\221\200\201\277$\217x\3111\303W\204\211#\343\262\321q\211\210:\005\322Q\f3\260'[\001\201\310\250AP\003\031C2\"\"\201\210$\005I\322\001\021\006\204 \304X\225\007\021\300(\205(\203fd$I\262s\340\360\361ey\224\225\376\b\231\272\373\273\352*\2330\206\323_\204!\262\027\205k\324\365\030+\001\034Mn\276vC\354\026\310\311\026!\364]D\245\352\264X\177\220|\027n\234\336\027\3004\243\314d\357\030qf\324\3615G\322.\025G\366\022\331\321\350\tb\032\017RW\242;a;\031Q9\223\n\332\233\260\035;\331\363\250\320\272|"
+	.string	"L\032\310\274:g\035nY\263X\240\\Q\261\311\275\244o(\230\2464fJ\330\271\251,\245'>\240\034v\227\230\006#t\222\243mc\346X\347`\234\023\n\333_\257\303y\371[\270j1oU\356l\231-\216/zb\326\350\305\257r{(\341\216\350T\314\030\325]\034\260\366\210fG\343\337qB#r\233w,\267\204\347\202q\253\033\221z\342\371\220\3279#\223\317bcv\351\"vI\342\027q\232\362\363ZaFO\020\263f=\276\272&E\235\021?\253\016\"\203=\264q\335]\330\027"
+	.string	"6\032\315Y\247u\022\257H\320)\233\363\f\250\242A\314Q+l$\234\002\347\204\n)!u\033\201_\037R\207\241F('\371\004yF\236\n"
+	.string	"\221\026\236\013\260`\332\201\340\271\261\f\215\005\211s\312\222e\004\206u\\\272!\022\201\212c\251\005|\206\020\265x\232\300\302\323\007\027\305\013|c\366\216@v4t\002\021\361\341l\245\263\303\261\034=\333\nu\324F\355"
+	.string	"\234l!\344\001\f6\377z\274\034q\260\023\305)\303\002\256\303\271\332+\b\003\244%\327\307N\nI\021;\032\301#\030\303\001\347\264O\231\363\203O\236h\274K\233v\362/\025\352\261d@:Q\336\211\260\f\206\037\241\201z\266bIP7\352\264\f\361\372@\225\237\217\021L&\216o\0257\355&\321\020\234\2567\177\266\005\177\203\211\305\241\345c\213i(\256\374[\234\324\230\257\274\375bi2\244:;\242;\2317\033&e"
+	.string	"\266\024\206\276\233\210\324\006 \224<\200\261\017\251R\021\025\370y,$\270\245\255\3336\322\216\227d\273\353\237\n\364\365loL\261q\245\004\272\305.h'\326\345\326"
+	.string	"Z\355\030\253\214\314#\262\235\b\356Q@"
+	.string	"\237\265\321{b\341I\210\024\367\001g "
+	.string	"\036\300\301\bX\342\t(\274\364\033X"
+	.ascii	"\230 F\232$\030\017\330\366\211\354\274\035\360\235\005\017\240"
+	.ascii	"-\261\004\250\030\334\334\\\027$N<\272\033\330\031n*F\213N\t"
+	.ascii	"Q\350\027\002~7\214\3440^\004\2039c\n*AN\004*\263\375\263\255"
+	.ascii	"F\230\3302N\350J\214\0260\267\177\367\252\204g$6\036h\367x\327"
+	.ascii	"s\271\314z\234Y\317\245=\353\350\356\331u\037P\f\233\373\243"
+	.ascii	"\177\bQ\020\242 D p\203\303tkP\350g\332\213\037"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.141.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\255\001\365\017"
+	.string	"&\235gE"
+	.string	"\321$\035\323\313\320\271\217\265\300\245F\036\235\017\034#\322\004\325+\f!\225l_\252D\2118@\261@h\210\330\200\330\214\024K?\031\273\343\377\377\377;\002\315\341*p\375L\340\tW\265\226\032\333\336[\312\224\002S"
+	.string	"O"
+	.string	"V"
+	.string	":6+\026;v\367\322\017\216\231\372(\302\247\231\362w\376nXD\332\226}\364\222\3453d\332V\257\001\215\022\033\316=c6UF\020\0234\2073\177\246\355\345\211\354.isI=wx\303\362\3216\232\347\350\301\356:\265M\346\376\270m\030\333\013\354\333\b?\335Zq\354\322y\356\370\322\360\245\337K\253\2463\3237\005\300\361b{M\267\253\241+Z \b\203\304yn\037\205\317\231\364\024W\221:\017\313Wf\257\201\320\311\031\332\345\022\034z\344\343P\344\003\342\341\273\200xx\222S\266P\201\227\315\030\004-\236\"\310\351\220\252\372U\217\250\n\236J\340\2065\003\246H\225\335\211f8\356]\210WT\317\r\227\344a\220\214j\233`z\356!5\202b"
+	.ascii	"\271h\246B\"\262L\265\205\022\375\025\357A\361G8E%\257\035\372"
+	.ascii	"*\361p\245\346\347\204\216\226\354l.Km\331\017\t\020N\260\323"
+	.ascii	"\363id\005+\231p\"\241Pr\235H 1\271N\250\224k\344\200\261\n\021"
+	.ascii	"P\227\005\fC]$n\2578\366\316\237!H\006P\213\252F\332\262\003"
+	.ascii	"\r\226\024@\210t\214\001\017\177\273\273Q[g\211QK\212A\305\362"
+	.ascii	"\201\261Qe\227\020\252\213k9\236\252B\375\212C' @\002\243\220"
+	.ascii	"\252\033`\352\305\003\177O/\332\"&\325\257\217\271\264\0020\327"
+	.ascii	"\342\330\303\026K\260\240\344\022n\034\262\030\212\235\302\004"
+	.ascii	"\203-,!\020k\317\214>\253\232\r,k\305\213\235\202Z_\254\240\215"
+	.ascii	"\254\244\036\032\332B*\353\364\323Dw\f\205*R|\313\246eu\330\264"
+	.ascii	"o\022\314\023"
+	.text
+	.section	.gnu.lto_blackboxSetState.143.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\256\005%\035"
+	.string	"\206\257\252G\220\332M:\202\202\253"
+	.string	"Pae\326\216B!"
+	.string	"\fY\274h\3026Y\025+BO-k\220N\357\215A\2436\003\ne\243\233z\3153/\213f\252\005\004h$\002\033GQa\251;\357\263\253:c\233\264M\310\336)\005\222"
+	.string	"\216"
+	.string	"\232"
+	.string	"\323sN_\001\212!L5\200\277q\266\313T\224\263C\362\013\210\216\355O\373Y\327\342\375\310\221m\273R^\274v\205\022\274S\236tp\004\365\344x\003\365\244y\266\230\202\244\355Q\260\322Zb\202\266\2739\332\343\274\337le\255\222#\235<\377\201\017-?`\357\267\n2li\345XMM=\023\204\234\260%\310X\273\260\365\222\214\025\2246RNP\247\301\247%\245$\0307\240\257\226\273{\251&\250r\326.\354\256\347\017\350t\353\3346\025\333\026l\022GX\3027#\2352\252~\227\203\031\371?\314\242h\376w\322/\252'\357\024,sU\2064\213~\222W\254&46\275\231f\341\356R-\376\026\001\305+>\226"
+	.string	"o\252\252\370_"
+	.string	"\326H\371\224S\261\335\320T9\371\223C\031\313\357X+.U\\~\023\0325T\342/\231?\252'\243\272\262\256v\355#\261-V\356\366\236\343I\224\312+\353jw,\204\223\225\342\210ML968\347\330\302\336\244S\366\307\245<\354\037\371\3538=\316iJ\003q2h\350\351\251\0338\314\377\374.\242\331P\211\366|+\307\021\335\224\223\236u\020\372\221\231\005y\020\232\364B\202gXO^\307\021\301jn\310\314\242\034G\2642\254;\267?\234\215\261\214\211\275)8\206F\346jti\306\256\272\216#Z\rI:E\355\020G\243K`\021?3\342$\221\246\375\310\bL\233\204\017\035\273\210:\206>\332\263\257\253\366\317\307\350\020P\355\256\005?\314\305\230\360\177\234\364\t \240z\362E\220\030\341\376\227\203\t\332\t\t\325\223.\202f\320\230|r\005:\"\037\"\017F:\025\245\177vZ\354J"
+	.string	"\375\370\244(\221Sq\302'(\3673\304\"\267\323\300\273\025\272\241\034\321n7\224\323\021\356\307\245<\\\206\021\031\"Q\237G\352w\2314\214\212\024\315\264\037\331\225W:\322\002c|4Y\372\362\315\242+\365\374\315\031GX<#\363?\236\221z\022\004\024\327\233(\341qa6nt\306\230KS\211\322\261+\f8\364e9\216X\264\365\356\343m\361\264x\026\314y*\343mU\2778\227\267\205\201\207'\r\255\214\301\034p\203\325\b\277\360rz\016P\355\"\301y\200\203\250aD\254\224*!QPP\220\024$\007\320\002\021)\353\034\021 \271dlH\032C\271~\006\340\342GL\002\0236\305\032`\314\3503D/\231\372e\022'T\341%}\316*\022KR\203\005Z\021\250\335"
+	.string	"\353\261\2331\f\247\2071\022\004\265\264\351\f\030h\267\004\245\032\233\034*\r\262\372m\340"
+	.ascii	"^\337R\357\220K\005^\352\261\003\251O\005 \271\266\035E\017\343"
+	.ascii	"&\002\227\355\2367g\240\\2\245\004WU4\236\363\254\310g\302\317"
+	.ascii	"\t\210\0301|$,'\365!b\255J\nf\217\364\320\355\004\003\f\017L"
+	.ascii	"\244\206UH\007\256\344+5\016\336/Q\365\335\202J\377\031:\364"
+	.ascii	"\255\225\213\355\310\232\306)\001\255t\302)%<\227\235\372\335"
+	.ascii	"\203\356z:(\344e\323\210P\017\201\030\272\"\374\237\300oYd\355"
+	.ascii	"\300\0132qt\332\226K\211\227#)4\013E,\n\254[U"
+	.text
+	.section	.gnu.lto_writeIntraframe.144.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\333\027\315^"
+	.string	"\372\231\304!N0\220\322\351l\271-\256\302\021\331\227\367\253\30220\237\024C\2367\3207O\004\240\201\272\322(\001\201q\261\351\023\371|\203[\375\251\007\034\200\034\303\274\256\275\321s\035\207\343v\037\\G\216\207q]\263\212\0072\"\021E\2147\221\335RJ)\021\002\331\001\031\002\327\307\341\231\253\207\332)\351\301\3560\335\200\335_\272\273t\277\265en\346\026\344&d\343 \337\021.\271\367\256H\305\204\331\"\336\271\004\232\f.\271\367\211\"\365\343\016dc\223\031\376\374X"
+	.ascii	"3B'}_h \275\236\267i\303\3476\327fh\"\335\363\302)\312\362\f"
+	.ascii	"\365\270\363\232\313\332]\370\256o\330"
+	.string	"\355\035D\230<)\274\367\026\2206\212$\266\217\325\202E\206\276,xE\204wE6d\271R\224&\213\225)Y\352z\313\027\347\031\035\226*[\250p\221;~\031\273\367J\351)6\372\311G\2771\033\314\035\245W`62\216~\3627\273,q\266\335{\215\2152\343`66\312\323pl\354\266v[\373\215k\347\356\335n\0022q\026\336\373\004\321(K\245\215\362\263\201l\243i\373\330FW\346\301\241\0347Y\305\344\354k\212\341\275w\352M`fbS\261\210\344o\342\263\271H\\\373\311\251\211\tjI)\t\211t\324\301\350XD4$\024\004\364\343\323\303\263\243\223\203sc\264\251I\213\026%\276\257\334p\255t&\027\367\327B3\331Ou\355D\274\361C\241\254\367~\274@\244\"s\301\257\t]\360\246\242\211\022\302\350\232\251\273\350\032\212\210\254#\"\357\275Y|\251J+U\351k\301\223\210)\025b"
+	.ascii	"p\216,!l\256\221\212&\002{\311\r\20666\022\302\346\372\250"
+	.string	"\257\223\366~Ty\363\016nm\344\326\346G(]\004\345\211\023\261\365\020\233\023\027R\322AJ\2228\020\222\376A\242\346>G\272\347\210\021\347)\322;E\210\270N\220\316\t\342t\034 }\003\344\314\215fmc\226\264\366\243\314k\222H\b#\353\224\270\263\367c\214(\302\313\2136'\210\320V\254\321\234\346\322\330\314\341\304\326k\342ZY\236\362\257\205\246\b\375\304\017\205Vn\350\275\037dD \037I\230\r\327\016\326T\272\027M\334{\331\231\315\260f\017\315\374N\314L\0013\320\211\357t_ix\250\036\375\326\353\024L\334\221.K\247\262\211D\035'\370\027\361\220)\346\344!\372\237ye\2626\241\032!\207{i\300d^\331\\\271BI\033M\357\275\377E|F\3120\305\370y\357\375O\343-\333\342\307z\034\021B\206\017\214\227\343\300\304{\033\312\276\370\026\337_cJ?<\\\335^|ki\017Q\350"
+	.string	"\235nc\276\302\365\231-\267\342\316A\025s\200\024\0215.\333\250\177\321\235\foG\336\317\254\300\002\310.\323\206[\334j|\002\005\n\333h\177\321\035\331\030\2213\225\346;\313\314\200\003\336L\206\002cE\317\353\223QM\206\213"
+	.string	"\300{o"
+	.ascii	"\3344\364\030\025\334j\215\362\003\020x3!\260\215\236\370\242"
+	.ascii	"\220\030\f\235nv]~\310\374T\372\2471wG1\f\262\344\037\302\314"
+	.ascii	"\003\214\271C\307\3272\207\227\262+y\255\363j\235U\353\314e\235"
+	.ascii	";\260\3168\254\363\r\353l\303:\327\260"
+	.string	"\3164\2543\007\326yk\006\226u\226q\343\034\243\001\233/\350/\3150\254\363\013\353\334\"ufa\235'\260\316+\254s\004\326YE\n\353\334@\2775\237\350\301f\253\022\r\330\\\325]\232\251\332\231\204\217\363\b\037g\021=\316S=\316R=\316!z\234\243:L3\210v\376\220:{\340q\206\332q~J\235\235R\347&\2433S\352\274\224:+\031\235\223Rg\244\321\031I\307\371\310:w\310q6\312q>\3468\027\031\235\211l\234\207p\234\205p\234\203\2543\320\215\363O\352\354\203\343\334\223:\363X\347\235\033g\235\033\347\234\033g\034\033\347\033\353l4:\333\3308\327\024\235\323\324\271X\343lSg\264\350L,:\277uv\353\334\335\303H.\216O\n\023 \377\367\f\035\214\276\3037\335\222\313\361\213\336\350{\271D\t\350\201\\\307\255\306*!\277\300/\330F\217_\363E_\314[\026\372\255d"
+	.string	"\2504x\237J\246\212\350\273\257Q.f\177lvG:\310$\311\360\005>i\035o\373z\n\25368\237Z&\275\327\313\212\335\213\357\251fX\315AE\243\242\371\372\236\322\356\006\227\202\323\355\255\203\233\320C\\b\250\207\236\267\242\r\375\021\255\255\316h9fg9C\216o\271\243\020^\322\261\b\021\026y\021\246^W\224\337T\210\202`\270Rz\335\n\026\364G4(uL\261\241\256\301d\227\013\235\374\256\"\004\364\363@k\016\247\2626\177\276a0\303b\346-\250o\230\244\257\337\227\205\365\233\016\310\347\313\343|\236\204\031\035\333\217\352\267\303\365\352\223\353\273\316\247\307\355j\207\267\255`=\177Ds\362\307\024\353\351`/\305\361\035\260\341\370\266\302\303\323\303UX\221\334"
+	.string	"N\361<\211\262C3o;7\340\204\330\370\033(\330\370\276\242\263\023\343wx\016\017\373\311\352|\214g\377\032\313y\234\327y\"4\313%J?\364\341J\326f\316\267\224\3007Ws$k\363\2035\2045\004\333(\316\333\26724lc95\236 i|\215\"4\276\357pH8\361&M\004\037r\363G\264$r7\0344\211\322w\3539\020\262\365\215g<r\243\315\033\277\351\244\334\271\222\021"
+	.string	"dE\253\262\371\276\241L\320\214\035\t\017\3215@\326 e1\2048\331\212V\363G45B\233\006\326\370\251\342\033p1\025\3372\324\244\037\244yX\372\r\327\022\360\251\311\245\237\3065e6\305\243F\036DS=X\210\246\372\036\214k\277\367&\213\237F\365)\276\007\355\b\236\333O\363b\221\365\310\230\373X\221\374\360\252\304="
+	.ascii	"\240\370)\312\270\260\331\031\220\204\351D=\331\021<\221\036"
+	.ascii	"I\274L\360+>\002\347\261\342\235\212\214\261\370\t\276\355G5"
+	.ascii	"\213\357\275F\327\310\362\224\177,\234A\337\0063\266\260\262"
+	.ascii	"`\240Z.\2560\270R\221\205\245\345\302\202\027WY3t\264dla!\220"
+	.ascii	"\205\245\205\225\201M\215\326\222q\225\225\265\205\200\016\273"
+	.ascii	"\220\252\201\325\"\206\213\n0h1%\303\202\n2\230r\221\265\301"
+	.ascii	"\224\024\022c\315\270\312\232\322\302\302\312\2322>\273\372\207"
+	.ascii	"\360\002\315B3\205]\257\344n\225\316\362\007\371\021T\272:\325"
+	.ascii	"\212\025\333\350\21539'5<\220\263\021\317_FF\342{\231\202\026"
+	.ascii	"+\342G\254M\275\210\227\372\251'\272[\332\205x\251\037\022\\"
+	.ascii	":y4o\261Q\037\342{\271E\371\037\250x\351\275]\315\344o~\230z"
+	.ascii	"\345N\305\303\263Q/\3047\367\267TA\371\313\367\341A\216r\016"
+	.ascii	"\2179\346\303?\017\256 \"`?\2059\346wp\245\257\343\003\272v&"
+	.ascii	"\205\315\356\211\330T\342A<\030\210\026\323<s\20468}\032\217"
+	.ascii	"`2\315x\240%\2324P \332\352\301\232\260\333\311\302\241\007L"
+	.ascii	"X\337b\272CX\242\031\204\362d\227x0\023\332\352=I\034\230\377"
+	.ascii	"\"\206.J\223\325\317\370\026\312\267\303\245S\306\227x\254\177"
+	.ascii	"\301/\020<<\324\313\370c\337\362\214[\275\2077\262a\271\246\302"
+	.ascii	"\237\236Y\325\242\346y3\241\036\351\365J\026LD\230a\337\245v"
+	.ascii	"\351\273F\371\357'U/|j_\237m\364\351\233\260S(\341\344\230"
+	.string	"b\312B\2674L\237\306\335\254w\306G\034\324\017\341\221C\362\362@\003\366\275\302\322\2479i\riz\247oA\246o\3622n\346\317\r\321\346;\333(\323\367\030\263\032\224\230~\326\243L\024f\r;\276\377\222>\215\215F\220.x\324\310QTW\301\370\252-\304{\357EV\375\005\037\024\347\206\267tF\371\222\322#\177\351[0\351\225\276\277\322\320\260\2225\226B\225L\327%}c\t\264Cz\344\367*\346\203+\331"
+	.string	"\202%\220\276\003\033\035c&h\346\377yo\022\351a\274\347}\245A\341\314j\030U\320\233y\364\304'!\nz\312O\362\221\007\201\341\250qD%\221R3\"\"\n\222$\205\264\006\321\005\204\030\245\030\254z\021"
+	.ascii	"\035c\220\241\032\232\024\244X\f\377\306\200\0374B\237\206v7"
+	.ascii	"\320wSv\321\016\236K\022\232\241\367f\330\200\231\025\246=\315"
+	.ascii	"jY\021.[\212\374\263\210\036Ck\202"
+	.string	"\324\253\024\345G\323\231\023^P\231\236\371\220\332\320\"v\275\255\243\025\320\230\247a\245\026\301\240\343\364\334\374C\177!S\261,W\271\263\213\256\250\371\367l\023\307\352k\255\237\362\307t\t\311\0130\363f\250$\355\004\345g\375\275\2433\017\352\350\326\375\325\315k\267R\022\034'x\233\033\345\013FE\300ql\334A,9o\321\032d\361F\206p<Q\233\356\257\202\263\023eO^\024\024J\255M@2\277h\023\362aQ\22015\013L3\337\240\350\023\035\235\372(&\361\2270\305\272\203\005\275V\006m,<\251\215\251\246\220\262\024\212\021\240E\322s\221\236\347\343\006\216\255\275\2365\221\260s\312olN\350=4\362\305c\264\n\215\024\314\240\215q|\250G\304T\bg\255\250\306\325\351\016\344\221\241\237\322=\221hY,\024\262&\203^\244\215\302\020\005\367kZ\227A\207\342x\034(/\021\004\271\312\205AA"
+	.string	" \210\243\304\206\013\341+\231\001\312F\253\240`'\304\231\032\027\262O\274l\\\024p$\250\271\274<\b\035\211\351P5"
+	.string	"b\304D1\261S\241\224\363\206\342\372{\215\002\025h\347\304\224a(\022w\377"
+	.string	"\004\260zZ\262\211\266n*\246\200\002\271;\304\271\355\245\344\305\220\313\242V_\250\317\224\035\347j\324\346\020d"
+	.ascii	"\227\346\230\303\225\236,\b\357\033\036\251\217\331\304\314\264"
+	.ascii	"|F}'\273\257\f/\001~\364\260\250?\301U\032\232svH\354\032\206"
+	.ascii	"\"q\367\177\033\021\211`\302\334U\037'\366\236\346\216\314\375"
+	.ascii	"?\001\f\276\277\360\252\265\214\346\246f.\320\264|BZ\341\335"
+	.ascii	"\245}k;\241\241\312\215s\226&\213\332\230\265\332<t\263)\272"
+	.ascii	"\215(\257\223U\3614\344I6\252\275u\3351Si\035\362\367\002(h\036"
+	.ascii	"\033\3670mo\036-A1u\221\222 W*\0041\3603\265\246\321vV\230Q3"
+	.ascii	"\31709;\321\017<\001\273\177LV\233\241-\355#\021m\247\311\273"
+	.ascii	"\310\360D\234\323K\0274N{a\026rI\031\354@\007Y<\267o\2319\017"
+	.ascii	"{S\236y;\3311\031\300\207\355\344\355u\r\316L\205\312\321\033"
+	.ascii	"\217F\213lv$\177vL\212\001\037'~\255TJ\255\265\326:\n\257\355"
+	.ascii	"\224\376\342'\322\017\"\t\301E\324\3052\335\032\276\t\330\314"
+	.ascii	"\257x\fa\366\017\242+bWT\320\034\"\3328\326\245\243\b\222\036"
+	.ascii	"&\273 osc7\013\251lT\222\340\t@iC\262\341i\206\261\247\005\372"
+	.ascii	"\340V\"\025\251\244f\356\006g*\254N\026JX!\200ek\356\376w\345"
+	.ascii	"\250|\020\327\276\372Aq\342\200W\t\241[ |\252X\3639\234\004\227"
+	.ascii	"%\374\235h\267\3635\330\257a\221\347-\247\356\304\304\236L\214"
+	.ascii	"\263Kl\027\354\026t\313u\331r]\266\\\227-\327e\313u\331r]\266"
+	.ascii	"\\\227-\2676eK\334\300\371\022\330/o\251X\271v\273p\205\226\232"
+	.ascii	"6\232o\306\242\006"
+	.text
+	.section	.gnu.lto_blackboxWriteMainStateArrayUsingGroupPredictor.145.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`!\005\035!"
+	.string	"\346\275\325H\220\332M:\204\243\3651o\312\313rP\203\263\277Jg\271\334\b\205\217\367\270\233]x\230\026v\333s\354\233\257x\305z5J\332EF\222L\022D\221Q\004"
+	.string	"\335\263\201\223\346O\n\036;\347\240\371\266\266\215\020\"wJ\001\302"
+	.string	"\261"
+	.string	"\302"
+	.ascii	"\266\356&\275\330\227|\314"
+	.string	":\344\f\fJ\246\222\204)\034\200m\361\250p$OB\365\260)\235\332\245\276\205\032\030\215\264Z\217\006n:\302\361f\304L\003zt\024\"f\265V#/\270\335\364\251\375 \027B\365!(J\235z\305\345eV\353\321\310G\267\233C\017p\336,\317;o\232\312.\323\303\252U\013\300b\020\223\250\325Z}{\303\266d2\231|y\274MJ\365\323,\327F\251\374\252\237\245\r\213\205\216\235qX\"\255\245\235\335\311\0255{\274x\371\2613\340B6)\032a|o/n+\025`\251m\355\214\304\022g\215\370\345c\247YF!\245\266\244Z\253i\321\350\342\276\335\366\013\333M\266\331\023L\364E\246\363\346\367c7\317l\221\2619\263\242I\373(\244\333\025V\206\343\206\327\206\255\243.\322Q\023}\310/@\350O\356\240\033\371\201\036v\377\\\311\355s\344\335\373\361\357\271\331\315\243\324<\224z'G\255\263\324"
+	.string	"(\365\216R\347\344\250q\226ZG\251s9j\334R\337p\3246\034\365y\2436O\352\362\244^\0335=\251?`\247\203\211\361K\246\324\312\"\331\246n1\317v\374\311o\366\207\375J~\244\3753\037\212uO\244T\330"
+	.ascii	"\323\321\341v&\276\023\353\314\034\345\325E}\n50\257\264Z\353"
+	.ascii	"\006\262\227\331:\2338\023'\330j\2423\0212l\353\263\267\375\360"
+	.ascii	"Kx[9\317\265\355\207>x{\356\241\234\202\027\344\232]\261)X\306"
+	.ascii	"\322=\n\264?\353\263\2755\327\236P\201\276\350\262jm\225}1@\034"
+	.ascii	"\264\242\355\244\243Yx\030\032\230\207\271\200!C\206\363\246"
+	.ascii	"\271'\027R\254\bc\327\225\343\307n\227\177$\034ki6\rg\321j"
+	.string	"\255\270\301\005\215\2271Wt\315C\265\326\0238\211\266hO\324\022\236\313\273h\360\275\314AI\351\274I\264/{\201\"dh5\204h\225\373\203\345Z\262\320;\n\233]\037\243[\251\262\3734[e`gt\277\275\275\232\341\227\220&\335\263t)\031\342\033+\232<p*P\267Z+\222/\345S~\276\327M/\005A`\324\257\351\303R\360\t\327\364`P\352W\"HPb)\370dF9I\001\177\346T\020\030\005\325\344\300\351A\324\022\024\b\020\022\202A%\236')`\220\311\364\357\350\004\320\203\210\237\322\b\017>\247&%\022\276_\020\312w$\300\300\247\245\240/\n\b\f\372tG\253'Y\255\360\334.\343d\224B\273cl\006\316\333,\240\345\355\207\034\271rE\327^\326Z\253\271]\274\025\332;9\005.d\230a\215 \312\263\366\003\b\364E\017]m\225\203vgy\366dC\036:\273\323A\247\267"
+	.string	"\226\307\313\230\330\360\353W\276\333\240\245dC 9\233\333\335\226n\2065p6'\004\316\317\352\326T3\374\302mnO|cE\306)\302\315\313\237:o\342\366Y\001^\250a@\344\230\200\020D\206HDF\032C\032\003\220\002\2211\253\016\020pF4m5\310\023?\370\222\030T\027\f\323\377\3232>\273\316k\2304\001G\343TH\fy\312\220r\036\306@\022t\310\222(n\326\241\322\363\370\310\250\203\317#h\326\256\035N\243\366S\2060s\024\206\342\323\243\317\214\325l\t9\360w\216/\2301\035\277B\334\271GK\244\203\007R.?Es\t<\232\"\365\326=\246,\217e\267\375\222W\240\f3\253h6d\274\3258\034\262\005\004\027|\243\207vi\177\006+X$\234\013\024eB\204(]\227]bb\347\237P-xw\333\201\205\270#\300j\227\202\307\315[\224\270\007"
+	.ascii	"(*\235\036\032U\250\001"
+	.text
+	.section	.gnu.lto_writeInterframe.146.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\251\032\245j"
+	.ascii	"z\254\330%K \216[\031\016\245\214\224+e\207\223\334oi\206\310"
+	.ascii	"\3124\303c\335\205\fW\340\373\020$\025<\325%\315\325\363\330"
+	.ascii	"\303\354m\002KU\200E\252\300@` \0203\357\024\260\202\231\354"
+	.ascii	"~G$W\307\334\335\335o\310#{\223-e\222\001B\002 \002T\002G)\257"
+	.ascii	"\221\006\336\242\224\227\250\310;T\344\025*\362\006\025y\217"
+	.ascii	")\257\021\345\325\200\362\026\2337EyQ\224\227\210\362\236\315"
+	.ascii	"\333(/7\357\277\345\211\013`T\304\256B\340\272\202\035\316\260"
+	.ascii	"\316!\342}9\237?\360\307\3637\377"
+	.string	"\023~\024\3764\177\335\213\273\037\334\243\230:\301=\342\201A\214\331\036={\300\331a\230<{\304\223\201\032\034 \255\" \207@;,(\373\362Z\340\323\243\263\247\334\353kAoO\236\345\031\234\016\177\224o\002\t\335h\311;!\333\362l]W\274\263Y\"F8\346j\276f\367\270L~\267\275\002\341\337r\314\272\256\307\023w\231\354\036O,:\231\2339\335U\270\335\036\353\234\320\340\302`\007\\\263m]\345 (\242y\n\352\3238)Z\353\254\027\373\203##\270\256r\t\024O\\\271\342\231\317\251G\001\312\271\2429\341\340\264\005)\236\310Pr/\243\376\204\013\224\204pq\004\3275\254F\361\304\257E\3731\217S\337\334\274\257c\3531xAL\030\301u]\253N\334\023\305\023\241\256\204\236x\036\t=Q\335\335\3234e\335Z\0017\246k\016\206u]\257\332\203\356^:\317\223j\373\247\3347=\325\207"
+	.ascii	"!\025\005\365\301C\007\016\033\236\234\232\230\226\224\246\222"
+	.ascii	"\220\216\214\212\210\206\204\202\250\214\307b\212\022\317fu\237"
+	.ascii	"\322\220Z\266\331z\210\272\203\250s\013S\201\245\352\322pT\n"
+	.ascii	"\207J\001\r\177 s\017d\232\334!\356\034\342\306\360\0061\177"
+	.ascii	"\022c\002;\301\275\351\204\202;\241\354\3020\323Y\204\002\004"
+	.ascii	"^\n\341J\217\022\302\247\006\037U'\354\213\035'\261\035\211\355"
+	.ascii	"\003>\362r\243\023\312\313\t\265\256\353\032\027\251\235H-\013"
+	.ascii	"\017-/\264D\343\2403\310\357\r\313\353\204\235\235*\312\352\374"
+	.ascii	".\370(\2670,L\225\322\350`\354\356F\276\3731j\313\230\331\213"
+	.ascii	"gQ\2350\345\211B\n\247F\021\256\034%;qH,y\024\233\302\347\363"
+	.ascii	"\374t;\013d\306N\032\261+\357\263\204\340\n~^'\314\354T\002\013"
+	.ascii	"\301\353v\347/1.\346\224\306\272\256\313^bc_\021\337e<\273\273"
+	.ascii	"d\267)F\234\245)\324X|w\177\246\330\352Tj`T\270\243\351\263\302"
+	.ascii	"\234)\275\265Rl\365c\007\365\357N\247\3061\375\251dj\250\320"
+	.ascii	"\322\325[\273\\\246\224\013jb\241\027Y\024\262,\257]\033l\005"
+	.ascii	"\307\211\313+\262yl,>\273C/\262\250\2766\261n\346\nA\325\276"
+	.ascii	"\335YI\005L\231>|w\244p\f{\256\353G\240\337j\265\337\245\344"
+	.ascii	"\3420\026\023\262g[\035<\370^<\320\023\277\325\007<\2112v\177"
+	.ascii	"\3138\345\023\033{\027H\001P\032\332\330V]\201\212\215\266\206"
+	.ascii	"\336P\230\\n\200\244\330/\344\f\370\313\213OL\373\201\200\304"
+	.ascii	"\346F;\005\224l\343\342\303\345\013A\317&v\223^\322\215+\331"
+	.ascii	"\344\354\273\001\264b)\314\325\3756k\006\360\226\220\342\272"
+	.ascii	"\256-\226W\013\020(\2629AO\344\206\261\326\f\344\244\b\350}\027"
+	.ascii	"\316\362$\361\256\371\346\241\273\n,\300\367\332\021}\252\314"
+	.ascii	"\221\322[V7t\002C\r\006\007Z\353l\317\320\304\3758\211\361\267"
+	.ascii	"\256\353\213=\341\013\031\330\263\235\270\r\f\341{\rAOl\240\323"
+	.ascii	"\264>\030\226qxQ\370pW\216\213\233\351\367V\266f\273\313n\232"
+	.ascii	"\226,K\26433,e\312+dV8\030\023\013\003;\025\224\367[(\257\n%"
+	.ascii	"\345}\322\004\345eR\201\026\312\253\204\002\224\027\311\361|"
+	.ascii	"\215\240\274\021\240\274XO\363u\340u\337\006\202\234\317\027"
+	.ascii	"\310\017\037=\336\374\362x\363\273\343\315\257\216\007~s\034"
+	.ascii	"\317\027G\363\336\030\342\2651\304K\200\020o\r!^\032B\2743\204"
+	.ascii	"xe4o\214\346\205\221\362\016\220\362\n`\344\r \345}a\344u\221"
+	.ascii	"\362\266\b\342e\221\362\256HyU\034y\001HyS\034yQ\244\274W)\357"
+	.ascii	"\211\224\327*\3455\221\362V\031yK\244\274$\214\274#R^\021)/U"
+	.ascii	"\312;\225\362\206HyA\034y\245R\336\250#/T\312\373!\345\365`\344"
+	.ascii	"\355\220\362r0\362nHy\237R^'#oS\312\313d\344]*\362*\025y\223"
+	.ascii	"R^\244\2247G\\\342\330I.\363(\021\363\252\232D\233\350&@<Z\253"
+	.ascii	"\317\302\344\262DW\001\252i\227\363\247ViS\242/\007\020oD\223"
+	.ascii	"x\201\375\324\264\317\211q\237Z%\306\210\376\340s\220\241\371"
+	.ascii	"\031\276\254\316/\214\322Tw\331\333\375\314.0\201\220(\350=\217"
+	.ascii	"t\364\016+\203t\212V\372{I\"Z\220\252\247ZD;\315\231\270\216"
+	.ascii	"\246\240\317\274\344\222\213\216\272F\325w\263\326\264\302{\352"
+	.ascii	"\332T_\016\332\036R3w\252\013L\323\310\304\203\350\300P)\252"
+	.ascii	"\272\216\376\342 \260\f\007}:'*\351\224\\G!\372,\364\032\004"
+	.ascii	"\321Q\035\242\235\n\223mR\r\242\017\247)\325\227\263\006\325"
+	.ascii	"QM\234S\257\360\033\265L\016\252\32114=\303f\024>TQV\367g4\266"
+	.ascii	"\007j\254\215X\237\257\310\214j\366\206\350at\276\206\255p\260"
+	.ascii	"~\337\020\232\0376BXw\266V.\202\306\252\213\240o'\250\231{\301"
+	.ascii	"\213p\301x*\275\3471H\3478s\364\233\377\271\256\353J\225\243"
+	.ascii	"O\245\211\270\274\331K.?\230Q\327\230\332Cs\350\017\235\346u"
+	.ascii	"h\017h\324\264\347\321\325\251u\350\347mh\016sj\232\013\265,"
+	.ascii	"|\346\304\206~\034\264;C\274>\235\272F\304z^\203N\315\324O\215"
+	.ascii	"\352%\333\232\332\251\214\232\366;59\225y\246\251\177\267\206"
+	.ascii	"\267\324L\375\256@\203\334T\323\256\270p\234\312\244R[\3527\321"
+	.ascii	"\356\340\272\313\352\374D06s\231\253~\301\037\254\353\255Y\254"
+	.ascii	"z\220\376\332\037\375\224\315\231\222\324J`JP\032\301\003~K*"
+	.ascii	"\362\361\265\260Wl\346j\300\202\032i\242\227\256:\216\376\302"
+	.ascii	"\321\337c\346\216\024\216\341\357\262\"w&m&\2166\322G\\\324\004"
+	.ascii	"2\372\304HGm\324H\315v\3116\2566u\355{j_\236\367w\324\337[C\022"
+	.ascii	"2\b\352\332\317\254\372\001\263\271P3jt\354\354\320\020\317\004"
+	.ascii	"06\304fn\225#i5*d\230\264\222F\342EIS\255)\2374\223~Q\233\370"
+	.ascii	"\223\376\236\023\335\312\364\270\354\2400\003Q\0275\333u\005"
+	.ascii	"2\372\346\2418\232\250\237\347\305;f\324\374I.\271\372\332\302"
+	.ascii	"\336N\022\034\342\213*\302\336\034)B=\304e\313\220\226\254\342"
+	.ascii	"[M\256u\204H\222$Kl\020i)\031\362#\b\002T\311\020-#Dnh\035)\222"
+	.ascii	"\205D\213\210\222!\255#K\262l@`\204H\221\034F\206\034\311*\242"
+	.ascii	"\205$\353h\261N4\311z@\002\254!F\036\270:Rd\310\004WXI\224\\"
+	.ascii	"\235\370\260YH\210$\271\322\312\312Jru\224\213\362\356\262:\362"
+	.ascii	"\326\030\nFi\256\275\340\004(\347\272n\231!x\002\222\017\335"
+	.ascii	"\016\323pH>d\037\322\216\035\364\304'\3136a\bot\t$\330\350\355"
+	.ascii	"7\267\033\375\344\bpP\002\332F;\001J\272\325h\002\232F\327h\247"
+	.ascii	"\274$\336\214\246\321Mz\222K\r\276qP\031=\243\237\214\303\325"
+	.string	"lH=\305u\215r\257m/\375\001\022\020\017R\317\036\251\007\225\321L|w\334$K\210\321j\036\230hf\227\030\206x0\272\2678YR\353\2649\257\301\316\322K\030}\267%\013px!\006\020\240_\364"
+	.string	"}=\311\266"
+	.string	"Z"
+	.ascii	"3,H>v\177\001\270\350\027M\326J5\r\306\0372\260\257 \371\260"
+	.ascii	" \272\350\017.\355\216U\276\360\001\321\314M;\003"
+	.string	"\353\240LZW\321\322_#\203[\364\266\320\311\336Z\026\335\242\203\314\364\321\005\312\301\273\310B\344\037\276\027\213~!\035\233\325P\220K\252\231\233\005\214\013\235>|\200|\317\322h_\227\362l\026i\330\033 e(\256\253\224\026\333_\255\001\022\320.\362P\335R\267\320\023\277\354\2639\307\221\031a\031\327\214\3424\277\f\3472(4:Eh\311\263~\336\2074\217\241\212\207f\256\031\330\226\255\242Y\257X\372n:\310`\253\357\231\253S\320]\265K\315\340\017\2409I\016\315\214\013\364\004\245\367t\362\321?\372\253\3540\355,\213A\331\1773\305?\332\303\227\n\367\247p\303\212?\025\235\242W\264\323\234\217\206\002@\253\350\027\002\320w\203\242Sl\300}\32429\024\235B,p\3142\356\251\231F51q\272\32445\351=\231z\264\217+2\360z\245\017\307\351\352\316\211\266\352\253n\262\353\321M\002O\364\325"
+	.string	"6\301X\217\272&gE\224\203\266\007\256i\211G\357\231\264\243{\220\371)\"\353\3531)U\320J]pwSU\007\322_\037\374=\350\202\223\243\244\325{N\355h\036@\352\374\336\264,5\023HW\320\001\202\037\250\262H-\022R\207\034!\021\021\221&IZ\003\302\013\020\006\242Q+\265\365\022\200\0231\013\304\3161e\"I\222\244\335\240\306\021\237\027]\032HO\243\233\353\371\276=\177\001\026\r\307\245:\026\026\240\213D\303\242\rl;\017\234\036\344\032h\030\260ZDo\n\302\373}\347\276\236\307#\001b\3118B\240\375K\321\2673\370[(\r.n\367@\034h4\20352\005\277\031\201@\320\350\355\373\n-\036\"\\\364\240`@a\344\004Y\317Z^E&\310\261\336\237\261\336\211\316\324H\333\252Tt\322\304N\323\\\222\033"
+	.string	"yM%D\030\305\210c\267q#\325\315\022\320\347\323n\221g\004\003Jd.\241'\234\032m\001\213\251\227\007\353vF\354\214\232\211\"\323^\370\023\300.C\330\351?\305O\036\376\363\207<\nmm6\321a\376Ry\2376\367\206\333\230W\325\211\362\304"
+	.string	"1_\225V0\312a\364E\265\253\333b\326\302;\217{M\245\260\306\200\212\347\017\333\"\376\223\242A\301c\312\025"
+	.ascii	"s\362\033\326\246B\217\361\375bp\254\365\211q\"\021\006K\035"
+	.ascii	"\266\032\271?\273\360\250d\264{\210\324\271$-y\344O\334\223\304"
+	.ascii	"\037lL\202\211\360}7\342{\265\025\260&HzE\272\324\027w\300\030"
+	.ascii	"\025\261\320`\217\211\217\025S\203"
+	.string	"3\354\177&`\231/\366\310/-\362\233Gl\030\243\033\263\334\261\033qL\235\361\206\310\215\262\032\f\032\033\013\201f>`\b\034\321\310\310&P\366;\021\370\201U\333\245<\371\200V\275A\370[<\200\017\355A?\021j!\362Q\226-Z/\334]\263\260\177\336w\330\341o\264\016\307:\bj0Q\301\303\325m\325\037\371o\241\034\306\360\021IF\227[t4\336\"\313\243\275U\256{\346\332\245\033C\314A\316\255Q~\217\253Lp\\\237\321\251\211`\253|\033\206\320\013D-\331\227e\026\353\332\220\355d\244\346\263{`\232\235\232 \3231\314\223ne\364 \275\202\277K\3539\f`4\333x:\235+p\206\\\273d\316@f\255\272e}\366z\n\177\205\266\\\032\"t\363\274\315\0323\326\236\026\013\303\217\312\214\005\366\335<^[{\331\260\352\n\355\371\250\204\366a\212V\3376D\261\r\017d\243?6\035"
+	.string	"q"
+	.string	"\340\2110\375\340\036\274\236\216\222&\267s\306\223\177\311>3\373\360H\332{\023\224|\260z\213L\330\232\352\252\267\243\026\265\247\305\ba)\310\3113\313\367\200\036:f\2055)\316\313U\240\346\002cL\322x\265\274\302\f\373\226H\230\036!\350\312\272\221I\273\237d\f\371{\330\217\251\n\0313\t\033"
+	.ascii	"Mk51n\356\334q\2516\263o\030\"\325\331\263\006\372t\340\3024"
+	.ascii	"l\024\370\240+b\265\300:,A\215\354\210\214\334\017\226\003\254"
+	.ascii	"\206\355\300\217\253>\030(\030%\332s\256\333\242\222\263\266"
+	.ascii	"\277\001-&ER\032\220v\205l#\211\024\217K\207\305\353/\253U\362"
+	.ascii	"*z\221jKe\027\234\333\317\270(\356\201L\004\2422\275\203\244"
+	.ascii	"*p\370~\022y\364\335\237\r$\342R*\357(\201\327d\272\317$QW\267"
+	.ascii	"\031\317b\242\312Q\302\031H\f\026\002\032@X\320\342\272#A\016"
+	.ascii	" \026\310.\210\275\364Z\212VM\306Oe\306\237\345\247\253\323D"
+	.ascii	"\322\334;\261\251\315jD\302\033\f\256\325>)2\007}I\353\352\202"
+	.ascii	"\3529\21290`{|\346\300\341sO\032\325\250Y\225\246\001\036\355"
+	.ascii	"\237s\236\262I\353\325\276ifH\371\306\230\231\266s\274$G\316"
+	.ascii	"30\003Fsn#]\023\252\306\210\360#\023~\024!\221<\256\372o\211"
+	.ascii	"\275TD\001MD\340\033X\246\r"
+	.text
+	.section	.gnu.lto_writeSlowFrame.147.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\375\001%\020"
+	.string	"\026\235gF\320\026Q:\224\315.\256\004\206\031\304\017\361\224\215Y9\337\016v&\334C\2446\314\265\0136\2527`\310,\305u\324\301\326\303\246\307z\005\337\211\223\351\207\342\340Q|\036\300%\310ZL\004\003\bO\032\331[\312\224\002O"
+	.string	"L"
+	.string	"X"
+	.string	"1\207\212\307~\373\227\031\305\207q\330\352\261\032\270=\020\366bg\227\304\312\243E\335\243k7\300=\0028\001\356\321+\373\310\001\021\313j\201\275nx\226\354\256\247(\276z\256\374\313\036\372Z\254'\b\302\356:\277V\211[o{\201\355\026;q\0022\246\374\367\350\233\270\307k\312\017\0361\233\274\271K\353\270i\234\335!\225\377\254\302\304V\013\241,{\306J=a\037\356\356Zsl\230\016\305t\007\323\240\230\346`:j\032fZ5\235\231~\001\001,\212\264N\304gw\304\255\311\326\002!\345\234T8mG\367\003b\341\024\244\034\315\302q\320\334\340T\345\022\362\212E\265\315\340\262\227"
+	.ascii	"Cv\327\301\235|I\240F\375\205\333\250\001U\345\n\362\243\251"
+	.ascii	"\252,7Ol\f\247\221\241'\365;. \257\001y\265G$\005.\235GC\267"
+	.ascii	"\273\r|\031\237\021\343\353<:\251\022\315\314\350\003g\222Hu"
+	.ascii	"\202\221!\215f`\274\r1#\223GB\245<Q\002\2378\224P\236\207\323"
+	.ascii	"\t\345\241\314\366p5\247\263\265\250\331(\b\327\300]\023\017"
+	.ascii	"\220\304\310\233W\356\367\270\217\027_\307\021\\\\p\\F\\(A\220"
+	.ascii	"\237]&!%\305gO\240\240b[Q\013\251O>v\032+ \320\002\221\031\\"
+	.ascii	"\007\340\326\033CG\030\330\221<\225Dl\210\\\naL3\314\016\024"
+	.ascii	"1\215DF\376f\250N\226\211\254\204\231\200\223\022\031\333-\f"
+	.ascii	"\023r\b\330sB/\2531gdW9L\326\373\271`\201\220\265{\023\027\323"
+	.ascii	"`\005\332\365K# l\024\fI\374\215\306;\247\277\214i\013P\346E"
+	.ascii	"\233\311"
+	.text
+	.section	.gnu.lto_writeGyroCaptureFrame.149.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\261\004=\034"
+	.string	"\306\363\260G\260\326M:5\374\316\030O\372J.\316pQ\235=\350\305\323\300\274\023\337\257\023D\024\007|\032\037\272\032i\257\307\023H\013;\256\372\304\362\305w\241fc`\270\206\202q\350%>\374\377\311\307\372\033\262\204\220M\344N)\232"
+	.string	"\220"
+	.string	"\236"
+	.ascii	"T.\2767v,\023u\346k\327\006\317\247\031\214\237rw.\355#y\024"
+	.ascii	"\356R/pn6\3117\343\311n\257\307>\343\247{\027\020~\216\007\020"
+	.ascii	"~\3328;\f\216\322\036-\2102\023\303\nlwm\nD\264\036\354\335\240"
+	.ascii	"\342>\212\341\004U\342|\361\307\367\002NX\220\272~\273\243\217"
+	.ascii	"\340\315\026\033M\277%)\352x(\376\374n \314\247\333\351\370\004"
+	.ascii	"ov\227\266S\002\025H\246\035\222\004\213\340\270>\353\b\234\254"
+	.ascii	"|]\277\035\216K\361gw-u\273\033\267\354\266\253lC\260\301\247"
+	.ascii	"9\234\252\302\244rr\3142i\255[Jh\023\255\220\327Ybmq\205}%\351"
+	.ascii	"\221\335;\222\ne\377\253O\266NN(\215s\251?\300\225\334\265c\335"
+	.ascii	"\264)m3\245k@\351\331\224\246\001\245eSz\234\322\"(\035N\351"
+	.ascii	"\tJ\203*\255*-U\372\004`|\325\240\261\273\230\255\335\032cg\226"
+	.ascii	"kj\r\271\222\037\353\247\272\332\377\201"
+	.string	"\233Ua\252\211\310\253\374,\317|\253_\341\216e)\227\0016\305\364\265\273\017\306\317\035P\336\347\231\335{\022\334\003VTG\325K\362\234\246L=\247\351\245|^I\322\314A0\301i\252\243\265\037`[K=F\365e\250}\221YtdD\235:\352\264\nU\274\242\341W\274\335\265\262!\002\357\263J\250\277\n\242\005\352\324\307\020\313\311\261\240S\341p\200\267\233\344\300\356\360)\037>\007|\001\365Y\237MNWG\264rrLuw\217T\241l\003\220\2526\210\020;R\257\252=KD\220\242\210\030w\267\201\017\345Z@\026\272\311\353n*!\210]\342NL\214\273I\r\374&\036N\214B>\375\027\341\347\365\001-n\004\304b\350F\"\274\r\251@\001d\024Z\310\247\005Q\320\t!\240\241 [\n\023@(lBEF6\037\002&Rq+\262\261 \"*\262\315z\373\257>y\024\033\303\225S$\273"
+	.ascii	"w}H8\325\377E%\307\214\243\276\327\301\340\246\252\204n4\336"
+	.ascii	"nN\326t/\017F\276"
+	.string	"\020\177B\370\211\2434NT|]Kv\344\344\230\2211\314Q\365\232<\257\325\304\232\346h\355G\030\226\315\210\032\245Q\233\231\326x\351\302e&S\232\021\327B\341\\2\375\217IX8@\366\374U\367Y\320\341\351\354\013\030\356\373yb<\270\224\246BY\fZ\250!P\345\2242R$\"\201\310H\222\244\003\240\002\021\262*\017\021\300-CC\"2\f\222R{\006\240\321PD*\002\272\235b\245s!\325e\"\3325\275\201\352'\"}_N2\025\302G\201\031\206\200\017\016\357&\350=]CU\210\027\234\335\243\353A\357\255$R\230\354\332\030\232\317\020\354\370\225V+\301\266\337?\3641\0248\357]4\266\306\006Ar9\200\\\310s\004\307\017y|\255\001#\004gHO\241mT\277\235$\330\344\324N\357\304\022\003\215\273\304\341D\\\001x\354V\264>Wf\263\2614bZ\364\332\323\337\r\354\322y\342"
+	.ascii	"6\025\2139;\020\252\360\266\003\324\035\022@\340\013\\T"
+	.text
+	.section	.gnu.lto_writeQueuedGyroCaptureFrames.150.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\221\0015\017"
+	.string	"\006\334cE"
+	.string	"\221(\035\fo\367\234\315\2032\334l\006\364\0208\351\313\312\321\202\276\242V\r\027&\220\307;\027&e\254>\352\313z&9\234'mEH\206\356\322\277\333\334\273\267\013\022\375\177w\025\033[\277\021\262\267\224)\005P"
+	.string	"I"
+	.string	"P"
+	.string	">\307\"\273\206\200\322\034\201\274\2200\241\210\231sr\353\301QE\227qU\344k(c\005k\201\243\313\270\225N\037\002\200\245\350\221\305`\356r\275"
+	.ascii	"\2224\206H\371\336\345QD\350\"\301Z`\312u30\347\264~ \352\326"
+	.ascii	"n{\201m\002\366c\001\372\357\3227\321.uw\307\247A\263\337\263"
+	.ascii	"\b]+\030k\346Dg\313rQ\002wWl\325H\357a\221\305\274*\366\2527"
+	.ascii	"\253\326\254z\273Z\273Z^\035W\275\252\326\253\357!B\2350\200"
+	.ascii	"\317\361\232\3634\3231cH\030\020v\213\303\343n\241\311\325v\203"
+	.ascii	"aJ\rx\\\271\267\300\201\2443\357\306\275i\306_\375\304\210\337"
+	.ascii	"b\005 \375\007\322.w\377\"|\215H\001P]\233\304\323\177.\320\001"
+	.ascii	"eG\366U\024:3>\333\025\376\002\001\204e\316\351)q\023%~\313\245"
+	.ascii	"%\230\004\356>&x\"\f\272O\003\021\316\001\350C\302u\241\022\356"
+	.ascii	"\243c\357\301H\210\213\340y!\216\243\232_\025\0042\031db'K\222"
+	.ascii	"\273\262Y\315\036\240\201\242\262\025\t6\273I\251\320l\307\265"
+	.ascii	"!\025\347\2343\372\017\321\374\024o\205|\272N\273<*|\305\334"
+	.ascii	"\330\226\365\317\206\266\333\006% \200\002\241T\026\007\240\365"
+	.ascii	"\344\300\336\3405>\026\035\262\265S\356\313\230\223R\021\013"
+	.ascii	".\025/\243\202`\370\007<\227\2501\274\305\240\262;,\314\234\017"
+	.ascii	"\032\214Q\324 A\221\032xE\241\262\303\231\243\302G\335R\024\227"
+	.ascii	"\271XT\231\221M\240kO\374\bL\020e"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureSample.151.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"\225\n"
+	.string	"f\223IA \307*\035\367\303C\220sDY&\035\001\274\005B\036K\303%\316\316\216\222+\214\302J\300\3511\332Z\352\377\201\021\246x\034\013\211<\b"
+	.string	""
+	.string	"p\024B"
+	.string	"VM\030\220!\024\230l\215l\262eJ\0017"
+	.string	"6"
+	.string	"5"
+	.string	"6\226\r\025\005\265\326o\212\214;\276\233;\372\b$\352\035\346\365\331=\304\004\2742\244\252\323\020\3708p\333\267E\256v/\234Z\253\227Ev\334\364\266%lG\330\237\001\273\276w\031\314\325\"\317`\245VWnA\035@\001\3142\266\277\366MN\033_\323\360A\255\262"
+	.string	"-\265\226\020\336`N\033\256\361N\273+x\247\036m\004/G\352B3\216\351\223\367\351I1\260\332\233\375\223\243\234|\022c\230\366\254S\337\344\235~\336v\007\262A\201\030\r\226\332\234]\242v\206\330\177\202\222\327\315\023\304~\355\247\001#\212O\b4A\022}D\261\004&\030\334d\204\236\n\260c\341\371D\240N\350\003\305\321\267apx\361\021?R\030\212_\246\254\270sRS\205\353.K\247=*\355Y\356&\312\003\027\020"
+	.ascii	"`\251'30\034&\214\205\253\226\234\2410\241n\205yH\204\2507\004"
+	.ascii	"X0\345\022,\261\2322\356rK{40\265\007"
+	.text
+	.section	.gnu.lto_blackboxShouldStartGyroCapture.152.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`y\001\305\016"
+	.string	"\006\232aG\360\2606\035\300\315d\321\031\217W\352q'8o\252\r:\037b'\031\3168\313\361;X\270\031\255\035F$=\350\177\373\013\021Y\376&\243\222+\333mB7\221\025V\344\375\351\255\361\261\222\315$\247\330H\333[\356\224\002P"
+	.string	"J"
+	.string	"K"
+	.string	"\222\363I\377P\257\245\"\305\n\230:&\340+e\337I^\fZnXn\270\370:\234\316\003*4R\262O\303\034`\203E\207\211\234\357R\337\tR\211\340\311>\323\374\230\201s\372\352\022\365\225\244\304Bj\255\226\336\007\336"
+	.ascii	"n\033e\033\201}\023\001\005\300\231\034\025\230T'G\233E\222\033"
+	.ascii	"\332\337q\034G\257\312\2664\265\364\264\364Z\372\331Wz\240\240"
+	.ascii	"\300o\250Q+\312\330\2528\024\206\213\355\022;s\002\005%\346\b"
+	.ascii	"\230\220x|\330\2008\321\354\324\312\322\226\304\271\177\260\213"
+	.ascii	"\316\r\027w\311l\007[b\354\350tr\364\315\211XC7\214\371b\322"
+	.ascii	"\300G.\333\302\005yo7\200\347\241\362\344\230\226\364\236\021"
+	.ascii	"\24387\374\2129ZpXs\3277$\203\303${\354\303|\005\347\227p\006"
+	.ascii	"\022y\357\324'\271N\277_=\026\201`\330B\020D\"\021B\332\204\007"
+	.ascii	"\"\0224\321hD\003\001y\243\340`\244U\330\266\221\226\261\352"
+	.ascii	"W\345\006.\242\210}\346_\375\323\262\t!\276\330\307\234\356\211"
+	.ascii	"m\272\016\351\2664k\255\365\263!\013\031/:\013RP\354\300f\315"
+	.ascii	"\334\005iN\204\037^\272# \260\002\021\271=`\353a\027\260\347"
+	.ascii	"\363 .k\234(\270\353}\364\211\332\314Jf\300\2509\344\036\313"
+	.ascii	"\361N\2625\271\335?<\331\306\307\203\003\032\025\2738\330\"\031"
+	.ascii	"+\273\331}\356\354\331\216<\274\317^\343C\266A\022=\3516\307"
+	.ascii	"(2d("
+	.text
+	.section	.gnu.lto_blackboxStartGyroCapture.153.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`j\002\355\024"
+	.string	"\306\350\214H\300RRcr*\314\303`\366\276\201HU\027\r\335\220 \226w>utb\233\260\346p\b-\312\025\303)\373Mb\254\330\"G\374J\265\370D\304<\223\262\203\277\321\004\220\245?\342\024\240tW\2452\333\020\266\245\2242\245u"
+	.string	"l"
+	.string	"}"
+	.ascii	"\366\357,l\007\346\374\356\356wGLKR\367\212Pp\353\006\254[\377"
+	.ascii	"X\237\366\217\216d\273O\307\255{\203r\310\270\367\267\300)\254"
+	.ascii	"[\223\223\210\267\365\004\304[\333\354\250\003 \356\215\001\023"
+	.ascii	"R\217R\325\275\367EQ\334\366J\247\315\177\360-Rw{%qZK\206\200"
+	.ascii	"\254Ft\270jrc\330s\341\247\217.7\247\310\312\275\327\223\324"
+	.ascii	"\355n{\333-\266Y\354\331"
+	.string	"\024~\321\255ef\346\311[\177F\274=\375O\017j\205\217Em\232\007g\256\336\275W\345\246\247\303\252\304\316,\355\037nR\"\373\365\336{M\207\354:\355\022\231\036\357\373YuZ\254\323V\234\256\3424\265\323\263N\177@\001\025=v\367\001ro\2102\310\035\332\246\024\007\376\366}\245\013\355\3218O2\200\036\324xk\343\330\343\355\037\364\030\2671\201uoN\305\247\361\032\024*\270\270\210\267\223>x[\325\333a\345\373\214\250I^\224[\257\334\246\220j`>\351\301\227\223\030\t\213xG\244\200_\020}!\206\f\363\244-\275\375\352D\271D)\221\347OD\027\215\t>\345\346\225]eY\372\370\2118R\027=\017\017w\030\217\001\343\027Y\003\f&\336\216\364\302'\030\361\243\307C\3729\265c\224\212\234\262\354/f,\277\305]l\b\260\032,B\255Fv#k\331\274\310hd,\324jd4\232\207X"
+	.ascii	"\307R>\314bfb0\0161\257\032\031\030\315+F\263y\245\224x\326A"
+	.ascii	"F{\325f3\332k\374\355\274^:\344\226\020\320p\207\342\234S\357"
+	.ascii	"\rrp\340/\005\234\245M\346\310aD\373\001\004\024!\023\303\034"
+	.ascii	"\275Y\244>\216?\351\260\264\264\210\267\324\211\234\262T\244"
+	.ascii	"\326\211\207W\251\025\341q;\211\224V\212\200\212\307\b7KOJ\351"
+	.ascii	"{\206H\b) @\002C\210\231=\340\324\233B?\020#Q\305\023/\026\207"
+	.ascii	"\002.\317\\\r\303\037\003\026\240IatT\202\216Vw\256\321\246\341"
+	.ascii	"-X\205\005\005x\303\221\202\345u\226\265\267\312\234\265p\313"
+	.ascii	"I\205p\200\203\327@.\254NRD\301\225\330\331S\261\035\2367\021"
+	.ascii	"\301H\251Q\204\024\316\275pDExy\276\311)\232\331\003"
+	.text
+	.section	.gnu.lto_loadSlowState.154.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`H\001=\r"
+	.string	"&\331XC"
+	.string	"\2216\035\333T\211<\305\266(\306~\216E\325\203*u\035\005PPs\364|\377\351d\0073\302\243%tP\204;\003+<\3248b\302\241\331\002\200\240\026k\002\220\327D\013\355\207\321\344\t\221\275\245L)D"
+	.string	"A"
+	.string	"H"
+	.string	"\376\210\223\320\376b\362\316.\211\206\305\356w\300\237\352\321\337=\324c\365"
+	.string	"\324\2435\273\306"
+	.string	"\r\273%h\021\003%&\307\356Z\372\341\332S\363_\342\033Ne{z,\330]'\247\262r\353m\027\260\215\300\376\214\336?\314\202\001\227\335\321\271G_\244oI9m\3600\312\223\375m\251-\366\341\356\256\225d\307t\365\227\237\202\351\b\3230\323\252\351\314\364;\002DpXy\n\216\335\016'\035k\2123 8\266\237\016\252v\204\253HUU\031\224\035\235\264'\200\362\\\252\226:\027\246\023\335|\265\257\247\b\251vW\201\217\"\003\001@\343\231p51?\021\342{\026\te\210z\274Jp\271\021\202\245R\037&#\361\275\244\301r\230\233\300\340\007%\330\210\b\372\372d\300>B\027h\344\303\242 \002\"\261\256Ld}\b\030\253"
+	.string	"\222Y\0270,\2638\337\036\256\222\274\351J\246\221\2368\252\315\3403P\246ATX\352`@\265\035|E\211\312\340j<i?\200\220\347\240\252\215\356E\033"
+	.string	"`\251'\023Z\373\002\303\005\013P\004\300"
+	.ascii	"\203@\210Ze\006\242\302\265E\370\260\204\342\370\032\205b\205"
+	.ascii	"\200\270A\005l\325\360[\215\307U|\226\336\2100V=\030p\t\241Y"
+	.ascii	"M\001wy\321N2"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.155.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\342\002\r\025"
+	.string	"\206\245\204H\320\016)\035@\2511W\215J \323y\340\313Wg3\370d\334\201Y*\004\377L\003\365\311\301\314\231N\374oT\026n\334\277\317\241\037\354\032a\r\352e$H\324B\210c-)\007;\233\365\200C\244\343\023B\b\221;\245q"
+	.string	"i"
+	.string	"n"
+	.ascii	"\341m\026\237\307\253\357\3208\312\336\306\210\273\030\250\035"
+	.ascii	"\217\207\376 \037z\001\003\026\323\016\264\224N\034DR/AP\273"
+	.ascii	"=\226\342\234v\0259\212!\250\223\346\217 \020Zj\222p\271\362"
+	.ascii	"*\232\223,dh:B\310\350\346(v\334\314\350\036\272\370Z&\210\221"
+	.ascii	"\353"
+	.string	"p\325\310\335@\216\335=\317'L\3166\347\b\262\273\236\270\334\314\215q\3336\266\037\330\363)B\261\251\252\003=\b\203\257c\224\224y\334C?E|x\315p!$\345\201GW\233Sv\257\234\272\263\017\256~\2607\300i\325w\356Q\247U\247\247N_\200\202#\233\022\020\321\013m\321\333\230)\251\375\205E \356\363\357|\332\267\337\343\373\274\362G\274\307r\237\225\257\313>\367d\244\241iW\246A\357\005\304\207\344\007\210\017GR\361u\022\344\354.\005\361\241J\307\035M\022L\315C\335\331\343\252\262\037\246\333\214r\200I\336)\304\377\334\250\250\345\232\307\251~\211'\342\347\242\345\317}0\022\347\273\212g\003f\314\367|\bF\356\326J\334\304\212\257\363\320#0\230\370\320&1\231\307\371$x\034~7-\347\356\226\252;\255\r\341\374$\335f\224\247^G\375\211\227\036[\257Yk\026\242\022+\tQy\235"
+	.ascii	"x\315`\262\b\025JRb\026PVv}d\210\211\220\270Z%\"\254\023X\313"
+	.ascii	"\204\345\222\241\260>\0208v\341%c\315b1\031k\325\333\223?M48"
+	.ascii	"^\3057\024\306\366\206~\005\017\351WS\033\250\"0m\t\023\214~"
+	.ascii	"\266\336nI\352\3164qT\335\006\246\322IIGq\005\334\275qp\237\277"
+	.ascii	"\3117\247\254R\024#0\0039\2735\215\245\243? \240\002\031A[\007"
+	.ascii	"\240\365>\003\316\260e\030\330\223\354\246\265\"7\342\366q\024"
+	.ascii	"\202\344\242X\2156\270\276%V\016\317\026\263i\r\\\002\200&\244"
+	.ascii	"\3056\224f`M\013\307ytc(\b\243\241m\334\273\034\210\257\312\305"
+	.ascii	"K]\020\013\205&Y\"\231\303@\305\311\333\242\016\336Z\003qM)\355"
+	.ascii	"2x\370\370x\356\341\016\024\304i\300\202\021\26760e\372c\005"
+	.ascii	"7\337\227\032\007z\031\354\030\017\244^\313-\0305\037\303\016"
+	.ascii	"7\362\336\326v="
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.156.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\225\t"
+	.string	"\246\320@<\020\005+\035"
+	.string	"\200\371\230\006-!m\003o\200\242n\373{\350W\241N\\WV\220\224\256\267V~\345\367\203\026b\251\001\032\001"
+	.string	""
+	.string	"y\204\342\002&U\241\202\037\"P\255do\271S\n-"
+	.string	"."
+	.string	"0"
+	.string	"7]j4\371W9G\025z\\\016\204\254\2534\270\225\340:aJ2\210\324X\004!*\306\200\207\335uT\205\253{\3366\204\355\006\333\272\247\270\263g\250\250.\373r\265e?\372\263\240\006\267z\310n\027d\027`m\023\006\305\366;6\3314\237\301\026!\346\344\303%\267\273\237\276\00229\233\370rs#Qu\351\023\274\353\001m&\025u\266Ig\311\020\330M9\370+\227i\370&\237\346(\305\253>\375\222\367y\355\210\325"
+	.string	"\310\002\016y6@\320D\350C\001\372,$>\025_hD\372<\n\006/\"F\037\006\b\216\276\316\354t\271\332\342\274Fl'EIu\211<\232h\001\266\273-O\211\005\021"
+	.ascii	"`\2517\023\032\200\002cx\r\343w\004\321X\t\313@\270I\310\002"
+	.ascii	"\305\343\357\007\001]\303\355C\360\227q\305\245\213\331N\274"
+	.ascii	"0\241"
+	.text
+	.section	.gnu.lto_blackboxStart.159.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\314\001\375\020"
+	.string	"V\235mH\340\262\2521\220\326\002\023\230P\213\255.\200GV\336*\207ek9X$\217\326\275c\226\354\333\350\223'\254*\304\221{*\225\327\255\310\220K\340<cU\220a\0067\030\213A\353@lx\310\270\214\242n\032\221rK\231R\\"
+	.string	"Q"
+	.string	"]"
+	.string	"D\003b\256kA\220\206\330N\357\336+\322\021\255\331\372\310V\220\316\226\357\372\210dskR\2131\342\200Q\332\274\202$8 |a\211\001,@\203\027\273\355S\246\214\231`\251\2549\005Gj\210\340\021\22600\301\007\241\032"
+	.string	"\3458\347\310t\357\365$K\232\233t\333+\266\025\330\323@-\363d\213}\265\364\271\203E4!\337\3555\1776n\234Tf\377;\026\261\024\246868m\351\364\303\223"
+	.ascii	"\232\221\241\371\314\307\2753?!\227Wg\224\260}\037"
+	.string	"\367\334\313u\\\252\365\250x\261\277\3427\230\353\330\244\346\023\276\3320v\370:C\267\354D\244\331\335po.\202\327\337^\342\331\335\370~\270\346\020\357\310\320\343Fu\261\247(\235\016\221iKH\241\267=\300\256f\2027R\027He*\373Bu`v\357u\361\023\264\241^\0202D\217\244TFO\300Z*@\227\0036\213\374\234U\276\263\"\335\013c\340\353\336\242\202\237\363j\226N\225\\X\241T\251\323\004\224H!\345\244\"\246X,b\t\211W+\021X\242\205\325\212%\206\270\327M/:\216F\246\355\340\301<\351\333n\032\251k\b\005\207\037Ke>\367\201\036\344\002\341\344\304\276\2066h=$\220\243X\377\347;\024?\307\247T\312\2766\350\300\343\363\360\232?\031\001+ `\2021d\327\003`\352\311\003\302pea/\005\"o\357\027m9B\323\330\270-F&rh\265~\247\307\255\350eAu"
+	.ascii	"\303\300)I\353\212\r\332\254\251\333\222\370J\022\340\020*x\371"
+	.ascii	"\354\355U\226\245B\215\216\356\002\236%\312\341\276\215b\344"
+	.ascii	"\264\221\003\302\270\215|\334+\224\0377\017\207C\200t/\276}P"
+	.text
+	.section	.gnu.lto_blackboxFinish.160.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`e\001\345\r"
+	.string	"\306XYD"
+	.string	"\2216\035\344\204\016\234\351\206\312c,\275\335\034{\347\266\205\225R2\006!P\357\332\035\034\3623m\246\262\337\214\202\216\274Lw\235\304\330\312\245\371\336~T\372\275&W\360N\f\351Sz_\210h\223-S\nB"
+	.string	"C"
+	.string	"H"
+	.string	"\326\247}b[\237\267\374\261\305\203!\266@\b\003\203\211fw/\t\342\237OJ\352\307?\351"
+	.ascii	"\270N\373\3548\265\3516\\\206\266\252\343\013W6\335\005\251\033"
+	.ascii	"\234\335\265r]\312]\3356\210m\005\366[\004\366\301\213\310|\026"
+	.ascii	"W0\321s\237\276I\365y\t2\343\302\203\021\201t\264\301\220J\025"
+	.ascii	"\373r\034\307\031\226\037lU\177\343-\036\212\206\224\273\310"
+	.ascii	"\354\242\2144\3664W\270\330\276\017\363\322\311_\274`\3054\332"
+	.ascii	"\335\245s6\251\371&n\216\2465\376\205\037\013)Ul\373*,\"\250"
+	.ascii	"\021\021xV\2358\212\247\260\230 F\024`\200\351%.cQg^x\034\236"
+	.ascii	"=\253>\225[\217\223\260-r\354j\367\2669:\275\214\326\303z\034"
+	.ascii	"\330\264&\356|X\300D\036tB \210\\\021FBH\256\216\247\344\372"
+	.ascii	"0`LB\003\317E\001\303<\227\005\202N-\351\317\320\322\341\004"
+	.ascii	"\222!?\206\232\002\324v0\"G\374\2443\220\001\322\304\320\360"
+	.ascii	"\013Y\250\215\372$\325\307c\225_\232P\242\347\374# P\202QFU\017"
+	.ascii	"`\324\023\207\206K\304[\0028\\\370Q\306\304\207x]e\354vZ\024"
+	.ascii	"\025^\335\363\262=\263\305\373B\252\017\337N\201\335\031\215"
+	.ascii	"\237\006\016\257\3706h\315sKC[_h(\341g\017\013q\275b&]\264\235"
+	.ascii	"!\343\360\2523\3532E\006"
+	.text
+	.section	.gnu.lto_startInTestMode.162.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`g\001U\017"
+	.string	"\306\\hG\360\260(\035:R\302\376Q\337\372{\257 \341\n%\317\260\302\227C\337\241\234\366\276A\3162cn=\265\266O&\374Z\306X\307='\337\370\r\316\020\371\220z[\314x\305R{\313R\2044Ye&\232l\"wJ\001V"
+	.string	"O"
+	.string	"S"
+	.string	" \252\r\033\324\\+(pv\327S\0217\235\233\233J\223\037@\f\317u\036>7\003+9`\036\242jK\200\023\312tD\025\271m\013\\.:|Tm\037/B\334t\304\224\324\216\250\262!\330\335\307.YD\224\224\035\237\335\265\\\211\255\273\343\266GlG\260\357\022 \\1\037N2\307\036QR_\366\267\325\026\373\263\273Si\225\322\007pX\r\026K\353%rvY98\266f\312\300|v\373&\374\3611\227\231>K\021\2600\366\342M\315e\306\356\310\340\323\236\356\323\343?\270\317\356\004\270\317wl\262e\004\253N?\276"
+	.string	"\r\330L\215JC\327T,\022\233\276\254'q\252 -FJ\336\370\nR\267\233r\340\247\270\212\317\177\3714\206R\211\373T\3350\242\205\r\231\334\335P\365e\024\356\032\242\331\244\344\r\373'NC\361_\234\341D~\365\351\237\350cW\320\242\t&\3407\241\244$!\204\344\001\204\220\021\b\262P\002\261\310\243\341\013\215\210@\027B\036\211\b\210\344\211\300\222\3479\340\257d\004z&\337\007z\235\361tm\361\347\244(n\200\264)\200\344W~\354\037\224\206g!\343\020\316\024\256\323y\242\201\241\331x\310\177\304}\357\031\316\256 \"\037\033"
+	.ascii	"5\263\007K=\231\001\353\034\242\365\022\336\3666C[ \212\304\n"
+	.ascii	"A\210xP8\016\267\357om\033\"{$\310\271`\3430L\b\256\211(\231"
+	.ascii	"\320\272\260\227U\226\227&\200\273W\205\320-a\\P\341\267\253"
+	.ascii	"\224\001"
+	.text
+	.section	.gnu.lto_inMotorTestMode.164.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`y\001\225\017"
+	.string	"\326\234hG\340\320(\035\310\220\233\351\032g6\214\2527\275/\270\024U\321\365\364\222"
+	.string	"?!\360\274G\375\345lX\301\\\f\360\333\275\0170\356\331\260\bi6b\2141\306\020\212\201L\307\"Fy\274\002^\255\273\305\376\336[\312\224\002Z"
+	.string	"K"
+	.string	"U"
+	.string	"\366\207\023(`\361\212\200\013\313\006\002[\217\353\004\2169g\334z\370\3522\302\325\225\317\272T\241!\242\305\0054\267\230\030\265\227\206C(\"\264C\004\002#\302\373x\265\350B\220\237\230\031\244\227\013\024\211\261\310p\233\353\313\253S\035\221\3149\255\336\013\303=\272\355\023\333\007\354\363\0047\307\221\340\207p\312\212\336{\364W\344\343\3676\017\031r!\213\335\300Z\372\3313\226\356\214\375\375\276\357\363\312\330V\227VM\262z\004\325\022\252#TC\250^\253u\325\027\020RbF\3427x\346\204\371\212\246OTQ\243z\233%9\f(\234N\362Q{\274!\003\026\216\222\273p\367V!\326\351\347"
+	.string	"j;0\321{\273\nT\263\302\247[\226]\303D\013\030p%u\025\004-\b\200\332()\275\247{\016\262nY\327\235\333\217lw\3067I\222\307\013\032P\213\352\360o\222_\322Z]\260\356\001F\215LH\225\234\240N\017J8\b&'\024\016\245J\341F\n8\025\241\201\212SI\245T\334l~e|\0316\032.\235X*\262\005\345\350\300\177%G\373b{\264&im\007\347\234S\312\215[\332\273F\324\344\232>\300Zq\007\324v\244\310!\264\027p:l\210p}\024\017\037"
+	.string	"\263\312\371\256\213\253Nz\260\256A+N\310\315!"
+	.ascii	"\202;\004W\262`\306\202\005\260\2220\315aa\2259\257\314\354\003"
+	.ascii	"\253P\245\334U\013\\\230\\\231\316\257Z\026\245VY\\\030!\306"
+	.ascii	"H\360\366\252\240\0034\222)\227VW\263\254\271\007"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.165.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`7\001\265\013"
+	.string	"\206SIA \253j8@j \t,A\205\273\217|S\274kE\243'."
+	.string	"3\303\242\326\006\bu\343\037\203\221\235S\366\360L\273\355/\3679/\004 D\352"
+	.string	"l2\236l\302\271\2360\212\371\320mo)S\n3"
+	.string	"2"
+	.string	"8"
+	.string	"\273)c\207\245q2\226\355w.\331\031&N6\324\230PC\201m\330]O\007\274\364,\371?\360\213\210\n\237\017\035\273\353\024Q\251[o\373\302v\306~\205'Y\316]3F\n2S\216\336\322\261{f\261IJ\362\2421X5\332IC\333\025\246\n\260\277\255\252\354\247\267\247\365\351|\372\235D\200U\352\255\013\001\033\013\316\340\353x<\226sjA\324`\312QAL\365"
+	.string	"V0\016\2319\354\225\212y\251ty\265? \213\223\206\230#"
+	.ascii	"!v\227\303o\335\025\362W\347<\"\345\305s\016\3764# \347\363m"
+	.ascii	">8\036\210\307\006\344}\242\221\247\2510\030\322\021y\" (\362"
+	.ascii	":\327~[U\371R`\205fR\023o:\223\020\001\302\203-\201\001\231\252"
+	.ascii	"\003\220\202\2007o\020\212\300\260\273\001\" \260\002\031*\365"
+	.ascii	" \325\033\021\372\273\030F\002s\3674\030\207\230p@\001\224ql"
+	.ascii	"L\021\254<\202/\374-\204\266\347\215%\037\330d\366\334\301\274"
+	.ascii	"\211\217\264\356e\216\341\333\221z\220\360cA\207\204\2021\023"
+	.ascii	"\265~\320\357C\200\323-\332\365\004"
+	.text
+	.section	.gnu.lto_writeGPSFrame.166.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`U\005\245\034"
+	.string	"\226q\256G\220\232Q:\004\310Ku\2769\355_\347Y\222\350)\230g\001\342\322\312r\245\367\024\020\221\227\277\005\331?6\332\223t\257\356\266\236\273\271:\325"
+	.string	"\320$\317\363\353\312MX\207\357E\236z\360\305\300\336\332\376\336[J\231\002\217"
+	.string	"\213"
+	.string	"\240"
+	.ascii	"|*\371s\362\245\344\267\344s\363\267\b@\024\215\033K\345\252"
+	.ascii	"\326\247\342\234\3525\265\216|\241l\024\026k\365\005B-\264\235"
+	.ascii	"?\213\237\266si\377\227\377}\262S\343R\271\270\254\326\036V\262"
+	.ascii	"j\265\272\335(\266\263\300\332\350N\271At\347\307\177M\200\027"
+	.ascii	"\225\211A\227'')rj\255\270\006\262\343\312\346\361\273U+\003"
+	.ascii	"\006\231V\342\330\226\t\330`\211\323\023l\222\266'#\300\255Z"
+	.ascii	"\236\021\3741\303$\324Z\317\300\340\215\375\334\377\025\376C"
+	.ascii	"\370\347U>.n\220/6Y\375\035%\352\255Z\206\3121\204\307\0331g"
+	.ascii	"\232\370\353\\k\335\003t\250\211z\235\240~\\\374w\312^\355\276"
+	.ascii	"\302\213P\342\005\356\374*\321\235C\275Q\026\001\024\254\341"
+	.ascii	"\216)(\037\027?\343_\355\267\350\277\304\343\005\036A\224\022"
+	.ascii	"\257\246f\372\255~\334?\376\225\265}\374\222O$\371CK\265+\200"
+	.ascii	"\362m\224/4\371A\222\017\004\343\377H\276\017\214_\223\374\036"
+	.ascii	"\312\347\241\374\035\312\247Q\376\214\362e\224\037\243|\030\r"
+	.ascii	";FL\030\031\227\024U\021\307\372\037\227\214L`M;\326\267+"
+	.string	"X0\271\b\303\217R\373et\342 \b\327v\215Sc\325\204\tt'\254#\230\321\362QX/\271\242\341+l\227\243\241\341N.\264W\207p\013\321\306S\366\354\233S\035\237\205\335B\312\262Z.\034C\006^`\006\272S\366\346\020n\221\2226\356\3769t(\300-\240\273\027\013\006\222\237\207\315\3325\370^i\361!&\\Awr\257\0243T>.\336\026kE\254\326\372\340[e\255\200\370\nw>I\247\243;\267\251\r\341\026Q+'6\354\226\2244\240(\261\353\365R\350x\2563R\301\0131B\227D\"\004\256\204R\322\022N\327;\2013\"p\236\211]\017\207\202\307\353\341hV\276\225\265}\\\246$\350\345\353\337m7\256Ac\006\313\210\301N6\242P\363\213\334\200\037\3344:\251\r\371\247\206\0023\345\024p=*\032\026\205z\243\204`\244\250\202\200,\035\244\332pNw\001\335|!\021\203\276"
+	.string	"\3754\220\220\215\003\347\207\350Sk\037\"\353f,\022kS\353\222\352\341\351\236\331N\363\364\204\003\243\311\357\310\252\311\031HsD\204f\247w\207\220\213H\233\265\254i\3032dfc\222l\250aP\345\02036#IAQA\322\001\240\002\021\231\263n\021p\251Q\f\t\215l\314\032\240A\323+\002\031\230Q\026l\221j~\005Zl\226\270\261S\3412\3421\241\013\3439\323@+\003eB\202\334\275\245\341\202\316\317\333\273B\220~O\366\346~js\236{\tK\354R\177i\301\2618\344e\330\312\244/\347\025\243\317<c\266\311\022\260`:*'\206\373B\240}\364\332\217\371OO\257\345\023\177\207\n\351\274\r\023\356\333\363\240#h\253\001"
+	.ascii	"\026\316\261\245Y\003-\355\350D\325\203(\317\f\223\341\303\261"
+	.ascii	"\306M$C \300o\n\330;\\8\222E\033#d\371\222C\007A\337\233\023"
+	.ascii	"\352@8\357(T\033\363F!\325\266\206\351W\242'\246\372\345\221"
+	.ascii	"\346\"?\205\\j"
+	.text
+	.section	.gnu.lto_loadMainState.167.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`p\r\355;"
+	.string	"Zg\204\026?P\246N\007'\360\337\370\324\337\377\n\225$\006I\217F\177\251\252\364\036\237\302\017\311\016\375qUka\215\366\006\023\210h\232\350\211\026\3676\322\245\0363\331\017\337\217\234\020OH\310\336[\246\224RU\001=\001X\001Q\207\204\254\365\335\340\272\026\031t\264\346A\367\226\335\354\306\353f\323\255\246\333\256\233\331}\246U\346\326s\313#r\307\007d\215]\323p9\033ei4\334i\230h\307p\0309\355\244\0206\2126\231\256cb\2316s\373\f\017\246u\317\332j}N'\340\2722=0\205\355\2242{\364\272\2666\020G|K"
+	.ascii	"\327u\315j\224+\b\033e\346v\346\016"
+	.string	"\323bn\323\371\340\341\272F\271\323[Wf\003v lt\252\241\322Fm;\245\215^fB\002\312V\261\b\316\274\263:F\353\272j}\025f\241p\311ZK\374\177\241\2656\345o\313l\266\351\355\342\222R\022\021i(T\231R\264\311\276_\356\272\266\310:\177\216jb]\264jY\021,\275'\315\211\235\020\b\270\327zL|\251I+\351\265\345s\213\213\262\326\244\223\336\362\232JK\332\022'RQYsk$5C^[>\"qQ\326\334z\330f\037\334\235\271P\315@eMI\253=\246\244\231l\222\237-KzOZ\322Bh\273\363\323k\312<E\212C\322\250\020I7Y\246=iV\354\003GS\373\3416\316H\177\247i\024\211\367wT3\322\256fX\327\225\375\250\266\326\f\240\231\233\t3\253`N\372\n\335D\231hnO\210\210C\037R_\350\241\013\001\376\251\317t\320\207\026\204~\n\242\375"
+	.string	"\365\241\210\346\254\037\021\335\347\337\222h>{\364\374w\034\345\337\223\316\037O\t\253>f\023}\007\205\260Q\003}4\324\357o\005\315\356\244\350:\334\334\352\223k\276\025\021\222\316\246\303\202[\270\360>\272H\033\355\217\243\374\233\243\033\363\301\357d \240\336\363\203g~\321r\272\204\353\272J\340\216s\237xE%\225<\322Fu(\007=\337\306|\220A\277\341a\241o]\327\t\334{\355&\006\267\262Q\2261\303\373\330(\367\214\264Q\255\017S\nz\356\215\371 3S\314\037\311\334\023\222\201\200\374S\230Gt\340\322\200\241\231\315[M\327\375\240\3174ku\263yA\3435c5\233\346\253V\323l\325v\315U\252\263\202\241s\002\324\231\nu\236\032:K\251\316\b\254\363\001\241\263\001\325\271\200\352L u\036`\235\005X\347"
+	.ascii	"\252sT\352\fe\235\237Tg\247\324\031\200unR\235\231\254sQu^J\235"
+	.ascii	"\225\254s\222\352LL\235\221\254\363\020u\026Zg\025uN\2553\212"
+	.ascii	":[\353\374\250\263[\347&\021?E\326\354@~\"[\3271\005\001^\200"
+	.ascii	"\226\013\316|\313\356\231\3671\300w]C9\345\332\362\374x\261\341"
+	.ascii	"#Y\245\243r\375\3731e\365\325\225\360\352\271\276\210\234c\027"
+	.ascii	"\245\305\337\356\322*\031\304\335.\033\324G\275M\364\004E\301"
+	.ascii	"\257\206\334\"\336\307\247\357\273\206\"#\307\226\207\354\305"
+	.ascii	"T&\264\303\277_SV[=\032\303I\255\274\355\316O2\265\372\016_D"
+	.ascii	"6\3618=\222\273\264\352S\363#\227\r\300;\275\025l\002\300\305"
+	.ascii	"\327\270)\3644W\273G\222\334\266\266\264\321\246\3575\215jQ>"
+	.ascii	"\232\333\363\202>\222\273\351\247\260J\347G\374\373yVW=Z\203"
+	.ascii	"\256\372\2463\343G\346\201\255GJ \246}d\325\217\370\"\022\357"
+	.ascii	"\317\254\311\017\037d&\"n>\344n)>\323\333>h\334\214\300\304\217"
+	.ascii	"W\f\203>\007\342A\256\023(W\212\224\264\321\342\267\236r\321"
+	.ascii	"s\311\315\356\262*\211\3642\245_z\333'I\311\307\270\211\225\254"
+	.ascii	"\342bWL\204A_\257\225{\345\302y\037/\\\332h\322\367"
+	.string	"\233R\321\334\036\361\005\357\262*\256\035\335-HO|;\350\354\221\225\017\237\371z\271si\037\221~\212\354\305\370\311M\254\013\246\031]1[IE\275\350\216a\326\260\301\373\270!mt\370\0012:\314\206\027\030X\216\r\3050\0339\2766\200}\205}\325@\302\201\302\253\206\214\023a6\274\300\300rt)q\227\203\035_0ft\275\240\001C\313\206\214\0275\264\272\300ph9\220\342\257\033^`Za__`ZD\346\332\023\222\201\200\375Sx\350\245-\317\330\377`\005\237\346.\017\330\271\235\361/\352\005\275\214\327\231\3613\306?5F6l\322F\321F\025|\277\301\341y\356%\300s\346\333i&\370\007$\267\210\252\215\213\371DGCF7\016\246\204\317\371\027#\0349F\2473m\224\352[\t\034\234'\335\024\237{)1\250\004\036\243\036\357\343\324\333\247\\\033\251g6\362q.\306>QxGC!"
+	.ascii	"\031\003y\037\245\236\234rc\212\217\344\241\237\022\206\177\277"
+	.ascii	"\244\254^\260\365\013\352\330\245\005\217\341\235\352\234x\020"
+	.ascii	"|\334]J\031\007y\026\343\337\201G\360\326\216\331\035,\216\205"
+	.ascii	"\233J\2073\026:dLdL\2246z\340[/o\356\355\344\224\251)\031\370"
+	.ascii	"\255o\301\263G\\\316l|\032\033y\037\r8\351\221\353\222\204\244"
+	.ascii	"\341\337o\230\325X\217\346I\032\213\210\365\032\026\2315)\360"
+	.ascii	"V\356R\252\317(\350\311\313f\355dq*w9\305\221\227\3158x\305\304"
+	.ascii	"\322F\013|\3475\312\005\316\356\211D\300\201G\271K)(\227-j\300"
+	.ascii	"\023x\013G\300\200\201\004\250A4\004\025s\206DfD$I\222B\007\361"
+	.ascii	"\005\204\030\347\034\231\007\021\020\245t\016"
+	.string	"\315\0043RP\220\324\352!\246S\260B\005\202:\240\025\023\031\343\327\213$\311z%\f*\201Vp\221@\300\241\317N\255\202\201|u\207\307\315\320\311\206\004\214>\367\366\200<+iv\277\334#\371\320H\030\220\236\222\311o\037\\P)\004\354\033\370\374\023\303\363\3669_\263\3038\303K\2227\227\370u\373\270\320\215G\307\021\263&\034Z'\244f\005\341\036J\326exl\261\235\262\204\0264>+p\206\372B\364:\376\030\241\344\217l\354i\205\212\240?7\254\233\360\206\210\242\305\231JP\006\001\211\361\030\002\300W\261Vvq\224I\306`\346\325\025x\265\224\033\f\211\322\003\200pz\013|G\215\257\350\346\315^\243a\371:\t:\334\201\017L\355\342@\3618\360\303m\205\361P\311\021\350F\373\fG`>7\215;\354\231&\261\364g\214\003-\317\301!Vq\313\257\345\006k(\343\013=\362\002@\027\215\317"
+	.string	"\235k\226c\201\231\251\313\351[Yt9L\234\336\202{X\365\356y\356\277M\337\177X\365\356y\356o\220\277\377\260\352\335\363q\361sb\247`j\350A5"
+	.ascii	"\006\273\035@\026\250\370\372\330\347\005\372\005\033`!7x\242"
+	.ascii	"\032\312]#j\211\355\"L\222=\030\370\370[\376\267\252\360\"\r"
+	.ascii	"\002\001|\020\244\223\370\245\342\205\237\274;\0076D\260P;\260"
+	.ascii	"#\367GA\203\031FP\336\016:\274H\254\302aV\365\3125\226=\ny\253"
+	.ascii	"\325V v\t\334\305\243\2406Dz\235Xx\356\2030\222\352\202\203\320"
+	.ascii	"\272\033)\001\017\022 \b\313G\340D\242\351\023\221c\325\033p"
+	.ascii	"\200\2156u\013\025"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.168.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\206\022\005]"
+	.string	":\235\340\"N0\320\332\031\003\325\001|\301\fu\177U<\243v`M^f,\227M\246[`s\276\n?\253]\301X\0051\370o\365\306\\Bp\363\377\022\362\303\300xry\020\f)\275\365\\\007\007\243W\265\344\231\001"
+	.string	""
+	.ascii	"fB\377ko)eJ)\005\036\002\342\001&\002\3351tO\351\316k\034o\275"
+	.ascii	"n+Md\356\277*\267poS\342\272\217{\013\027\375\264\222`\322\267"
+	.ascii	"\207\3619\230'\r\344\333\253Q|\206\221\276Tb_\341\246r1\206-"
+	.ascii	"0Y\244\020\261t\026\346\"s\365\025\036\322\235A\342\224{\337"
+	.ascii	"\267\310\305\\l\366\231spS\351*\375BO\271h\245\002\344[}\033"
+	.ascii	"-\216\252f\314\023=\246\344\230\364=\273q\322\027('\250$\317"
+	.ascii	"+Jl\007\002\324\302\023\332\246x\255o\232\364E\033\222\005J\345"
+	.ascii	"B4\313\235\2067\245w\260Rp\204\220\243\237\264]\216\206\302S"
+	.ascii	"\266y\337\265\300.b\263\311\265w\332&,\346\352\3553$T4cf\254"
+	.ascii	"\316\334\322n!G\323\261\030 \344;Vw$\357}\245\"8\001i\367\264"
+	.ascii	"\315\022{\247\215\016\242xo9\r\370\337\327\351B\336\373\276\""
+	.ascii	"\370\211\330,\211\0239\330\005\"\003\253a\004u\220\351D\360}"
+	.ascii	"\245P_\002\033\271\333JIHGI\243\016EDCBA@?>=<;:9\310\243\221"
+	.ascii	"\003N\361\306\2068l\331\365\335\345\006k\245a\324\r[\237\\\r"
+	.ascii	"khx\235t\327HwR\374h-A&(\244\253\315\273\025\007\r\223K\3035"
+	.ascii	"\243x\262\253M(S57\"\001\215Iw\030F\025\3155\221\234\017-q\241"
+	.ascii	"9\270\246\022\017\232[\223[\2228P\264\177\252\315h\3035\337"
+	.string	"\334'\216\017\352=<Gzgm\032S\345LW\233nkO\017hY\3035\215\270\316\212b.\256\255\253M\023\326\247\263\303\222\323\326\31066?\362\365Q\265\031]\223\306\325\311K\nA\272\332t\256;@\360\274\364t\210sp&\215#\244\213G7\303\2505\264\020\332\246\332\f\002\304\211\035\206\327\303\264\342\031\323\333\325\250\310\220A\343\331rMR\375\230M\355#\270&\236\263k\223S\213\007]m\nY{\266\2140\003\231\257\036\364\033\317\304\326\344\373\276=m7;\033s\037F\275\357\313^v\206\326\274\324\314\216\306\334C\346\343\226n\243\202\313\202w\331\315'\245\336\346\207O0b\212\275\325\022_\352}\272t\016\237\370\303=&a\222\267\317\354.q\347\274\313\206\337iD\030{0\013\332\006\227\t\361}\307\006\340\036\3235\260X\245Z\264]\326\242m\266}\001\350\314\2709\347\364l\002\335\340\332\1772"
+	.string	"\277~W]\337\213\246a\213\030f\375\246\366\252\005Je0\032\346\205<ek\"\260\377\344b\225+\2776S\353sW%\352m3\265"
+	.string	"\274\331S\377_\325}a\206\321_x\352\303\234@\007N\365\260\275\357\033\200\227\006T\200\333\255Y^\200\312\273\214\252m\366\377\001(\225$\321\260\365\237Eu\200<\2765hY\374\207\2251R\007f\314\321\260\177\324\212W\361\376C]\002\355\226\375)\276\2730\t\303\274\220Q|\001\337\337\323f\321\034)\254\003|\262\202\230\0272K\305\374\237\314]"
+	.string	"s\312\031\177\021f\243s\226\321\031\313\350|et\266z\347\031U2\214\316\r\264\225\346\030\354L\325P\272\247\336\031\306;\277xg\027-\327\335\242ch\226\352h7\213\236\322\034\325R\272W4^\267\212\316kN\321t\335(\272Iw\001\357|\202\235M\264_s\211\336k&\321z\315"
+	.ascii	"\030\235G\030\235\241\214\316O\357,\342\235\235r\234C\274s\323"
+	.ascii	";\203xg\246w\376`t\366\360\316K=\316JG\347$\2433\022;\037\275"
+	.ascii	"s\362\235\215r\234;\3608\027\3618\017!\235\205\216\316AFg\240"
+	.ascii	"\035\347\037\035g\037\326\271\007\351\314\203t\336A:\353\274"
+	.ascii	"s\316;#\337\371\370\316\306\2433\216\321\271\230\343|\363\316"
+	.ascii	"6Fg\"\322yxtn\337\2315:\257\357\374\034\234\235\203s+\241\370"
+	.ascii	"\352\376\232P\323<\240\364\355Q\250\346\365c\365\336\332\257"
+	.ascii	"{/\305\247\340\rLB(A'\b?\377t\333\345\321*}\3031\035\211\313"
+	.ascii	"C\351)x{2H\200'q\340\366\240B!\351\373\2047'>HoP\244\037\256"
+	.ascii	"\251)\342\234\213\366\270\255\021\013\240\204\202e\302\274\260"
+	.ascii	"\355zl\211\302#\200;5O[f\327\207\373\201w\031{\224%7p\225\307"
+	.ascii	"\025\""
+	.string	";\377d?\353\243\022\216\236\001\350\232$i\311'\2117\372\344\bFo\263v\203\237s.\255\r\b\013`t\250g\216\3375Z#3\352\024\244\214'\361fg\272\303\367\032\211\016\357Q\226`\361\033{\260\234\242\227\301\266\003\355\320\027}\013\375\320\277\231 \241o\037\356\017W\013\200]\210\216+.\220\n\332f\203\276W\200\322\220\244\325\206\364\251!\375G\003}\257\325}\361 @\200\276\371z-\003\r3\030U\302$\272\344\270\325^}\222\037)\020!\363\007\306\352\033\370\253of\332\007\016\302V\b\256\232Z\333\254\325{hK\233\361\r|\377\274S\317\370\316\322,\034\220=1\300'j|\376\347\337G\fw\b\321\315\347\333,\b\317\257\370\236\037v\211z\235\347\371 3K81\327\313\262C\315\3308\332\025\377tgX\250\373\262\363(>\306w\230%\222\024\257\363;O\324e\t\327\364:/\364\240]\352"
+	.string	"\355\b\377O\006:(\034D(i\262\003\347\237\3547.^\351\016\213\323\346\305\237x\263\226\275\2077\335\t\\\"D\332fe@\371\342\312\344<\007\276\201\23395\362s\376\3278\017\337\341L\344?"
+	.ascii	"\335\033\214\036\237\254\313l\200\361\306?~/O\3600\027\253\301"
+	.ascii	"\355\306\356\b\356\323\335g\333\254\361\215\332\322\234\034\347"
+	.ascii	"O|k\361\327m#\276\357\262\313\\#\304e\323\360\301=\342\276y\227"
+	.ascii	"\301\370\344\362\301\326b\213w\3417,\376\305w\277\023\317\314"
+	.string	"\346{\253-\276\223P\3077\346hh\264\23248\377\200mza^8(X\374\034af\2708\347\242\355\\\032\b\304\1776O\225 3\f\377\351\242\320\336|W\035\030\017\001\234\265\364\034A\326R\025\313\004x-%\261\226\222I\004\216J\0346\254,`\225\\1\274\224_\030\\\341\334P~}iu9\2404\200+\206W\227\025\r,\244\004\312\254\357RfY)i\024\263\220\312,\255\256/*\244\324\361\346\353\006\016.\251\033\027Y7\270\260\224^=^7\270\264\276\264nhI\240< \313\206RK\002\244\325\227\re\226\261\313\212\206\224r\313\252\313\005\007\306z\272\200\353\252\006\226\225\215+\250\033ZV[PX]^POF\314E\201\262\013\352\213\213\253\013\252(\r\353/\302L*IT\037\001\324\316n\350n\335\324\266q\333c\263\243\302\372Y\2330\361\034\025\366b>\224\3769\342\251~\2352\343"
+	.ascii	"\267\210^F<\004o|I\377\344\302S\237\277\251\236j7\337\264\b\226"
+	.ascii	"\201z\277\255\036\266\276\356\255\366\351\241\376\315h\241>}"
+	.ascii	"\2147-I\242\002\370MG\211\366\211x,n\327h\235^\304\367\322i\305"
+	.ascii	"\3513x\303\222$m\214\037\023\351\237\034\342\035M\335\027\247"
+	.ascii	"\016\361&\356\314\344\r\216\031{\260\206\301\t\341\321?\271\345"
+	.ascii	"\366\2440\251\0305=\373f\354\003\375\220\201\b\231?\"\017\346"
+	.ascii	"\342\222S"
+	.ascii	"\337\364\016\255\3232\346h\252\360\364'0o\312"
+	.string	"'\220J\323\377|\211v\257\357\373\276F \\\340\251\n\274\251\024wL\017\342\201\326x\024\236\252p(S)\354\230\240\350\316\2609\347\242zN\226\bv\020\252z\007\252\372!\217v\321\035\031>\"\234\326j\211\356\310@\203\252\276\304\233}\370\256z\023\035i\224t\254!.}\254\304\177\370\233\347`!\2230\254\350\237\254\037\236\021\242/\222\225\324\301\017@02\177`\230Z\254\317\222b}\3775\210\026\\\bt\316\245\025[H\233\016i\265U\317\352\251!\303G3\230\241\n\375\223W\207\353?\2731\\\202\232K\263x\226N\215\0308\227s\2078\005\262\216B_\342\2025\353\201\255\352\211\276\350\025\026\026\026\366V\213\364\036\276\2674\261J6\210e\351\024\003r\362\245\357>\217s\305<\260\221\021\227M\310I\262\007c\245_\372\201s\250\221(\345\020C\n\221\214\210$I\222\346Q\005\304 &%$;\021"
+	.string	"5\210\240\232\0311I!\035\221\016J*1a\"\300q\\\342\275\246\233[_\006AG\371b\351\354TP\322\035h\360?x\020}\302\311\034P9\213\240~\214M5_%\311B\267\217\024!0\231\2502!\006\316\274\306R\223\324\b\nH\2407\016&\211Iy\257Y6\246\001\031D\345\230\375\r3hrD%\207s\274\035\270H\377\367\007P\270\201\361\025\037! 2\220{\rbx\364\320\214\204\360|\246\262\326\3062\370F{\214^\t\177=H\306\3757E\n\245w\016\212y\333\374f\210M\350\341\300^\311\310\027\005\212\315c\032\177?u\360JZ\f\023\2436\232[\016\372\022c\270\234*e\036"
+	.string	"."
+	.string	"\037\304\307\325\250%\272u\024\303A64 x\271\345Z?\327\343d\332\326\277&&g\302\032|Rj\347\304[\210\357R\320\200R,\344\357T\200\301/\266hV}\340\247|X\034\222\246\354%\276R\363Q\b\020.\241\273+\271\027\202\213z+x\315No\225I\b&\276\357ie\262KI\246d3)\377\024Y\254\341\326\370\252$\032\345@\240>p\340zZg67\334\027\304\361\220'\264C\325G\304\270?H\321c\206\343!\2321xv\206z\244z7\206d\007g\360hjk~\200\t\021C\037\277\374\316\200\375-\267\023\353\r\025\274\307\007\251V\220\001\2108\340\324,#bj(&r"
+	.string	"\305"
+	.string	"+#}\013\356n\236\336~\201\376\235\221y`\323W\300\323\320\nc\307\036V\r\346\221\264p\306n\\@}\266\003\226_\336U\245=)\2721\355\f4P(2\325\2038\352\321\355(P.\025.\265\225\212"
+	.ascii	"\371\003\315X\271Ah\227\276+\232?\244\352j\227J\374\002U\006"
+	.ascii	"\353\260\260\312y\312\233\nl\357,\210\262\370B\007\373Y\207N"
+	.ascii	"D\366\006'\275$T\nW\344\\\036\031\"\245\001\016\333\0044P\315"
+	.ascii	"\013=4\372\351N\342\373\327\274\271J`\024 \322\320%\242T\202"
+	.ascii	"\220\300m\354&\003j\2131\037\243\302\277IX\030\254\317\356\317"
+	.ascii	"\333\346\314\324\3440)\022\214\207\tHU\246p\343\356\033\022\001"
+	.ascii	"\b\343\t\205jxs~\006\261\224Z\n\212B\2654I$\017Q\233;\276P\017"
+	.ascii	"\314\360\246k\203FB\244\336o{F\003\017O\203Aat.8D Q\261\332\202"
+	.ascii	"\310\353\337\240\355^n\355\253\361\357&(ziFV|\367\370\\5\343"
+	.ascii	"\244\221\246\266\210\325\341\204\224\b\361\223F\314ux*r\331\027"
+	.ascii	"\321E?\314=9l\013\212\204\017\333WE]\260(s_\333\213\227{,\003"
+	.ascii	"\324_q\203\206\221\240!L\353\340\345\267\333\212C\r"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.170.6d1af7c3a32e65bf,"e",@progbits
+	.ascii	"(\265/\375`\326l\r>\001j\022\206tQ\020 Gi\215\001\037\356\271"
+	.ascii	")\243\243\035\017\300\344\343q\364\20091\031\201\207\302\303"
+	.ascii	"\331U\270\314\274\274\247\247\313\375_\3228 j\020\261\337\300"
+	.ascii	"^\357\n{\fh\276\2149\001Kc\206a\255\016%o\016\313\272\224C\022"
+	.ascii	"\213\260\370\333VF\221$\245\224\002\255\006\004\007w\007\316"
+	.ascii	"\344:\373\322\353\354;\\g\327\361:;\324uv\245\327\331s\270\316"
+	.ascii	"\236\364:;\222\353\3548^g?r\235\375\371:\367\240\353\334\202"
+	.ascii	"\257s\007\272\316\r\370:w\033\327\271\331\274\316\375\347:\367"
+	.ascii	"\232\327\271\375X\347V\303:w\337\353\334i\212\316\215\346u\356"
+	.ascii	"3E\3476\363:w\231\242s\363\275\316}-:\367\336\353\334d\212\316"
+	.ascii	"=\346un1E\347\326{\235\333\352:w\336\353\334xE\347\276{\235\333"
+	.ascii	"\256\350\334u\257s\207):7\230\327\271\277\270\316M\367:\367\234"
+	.ascii	"\353\334r\257s\307\271\316\r\367:\267\027\327\271\337^\347v+"
+	.ascii	":w\233\321\271\331^\347\256\026\235\273\213\321\271\327^\347"
+	.ascii	"\346Rtn5\243s\347\360:wZ\321\271\251F\347F{\235\373\314u\356"
+	.ascii	"-F\347\326\362:\267\231\353\334Y\214\316]\366:7\026\327\271\311"
+	.ascii	"\214\316}\345u\3561\327\271\247F\347\026{\235\333J\321\271\303"
+	.ascii	"^\347\006+:\367\327\353\334^E\347\3562:7\327\353\334[\256sW1"
+	.ascii	":\267\326\353\334T\\\347\236btn\034^\347\226\342:\367\rF\347"
+	.ascii	"\216\362:7\224\242s?1:w\326\353\334N\212\316\335\304\350\334"
+	.ascii	"X\257s3q\235\373"
+	.string	"\312\350\334\322\327\271\227\270\316m\203\321\271\255^\347V\342:w\022\243s#y\235\373\210\353\334UF\3476\362:7\225\353\334SF\347.\362:\267\224\353\334D\214\316\035\365:7T\321\271\207\030\235[\310\353\334OE\347\016btn\247\327\271\201\024\235\273\311\350\334?^\347\366Qt\356\250\321\271{\274\316\315\303un&\243s/\275\316\275\243\350\334:^\347\206\026\235[\311\350\3349^\347N*:7\222\321\271q\274\316}\344:\367\323\350\354|\235\233\2563\323\350l\364:\027\271\3165\030\235o\274\3164\270\3166^\347\032\2563\215\327y\351:\023\031\235\225\257\363\004\\\347!\243\263\320\353\034\344:\003\275\316?\256\363\f\257\263\004\\g\037\243\363\214\327Y\206\353\334\363:']g\236\327y\307u\216atF\276\316\021p\235\217\2573\004\\g\031^\347\007\270\316\0160:7\340uf\200\353\034\303\353\274"
+	.ascii	"\327Y\001\257s\002\\g\004\030\235ax\235\017Pt~\341uv\241\350"
+	.ascii	"\334\302\353l\200\242s\001^g\002\270\316,\274\316\003p\235Wx"
+	.ascii	"\235\005\340:\253\360:\247\340:\007\340uF\301u\326y\235Op\235"
+	.ascii	"Mx\235a\270\316/^\347\022\\g\027\257s\013\327\231\204\3279\247"
+	.ascii	"\350<\302\353\314\302u^\361:\253p\235Ex\235Cp\235Ax\235?p\235"
+	.ascii	"=\030:w\360:"
+	.string	"\247\360\340\214\342u\306\361\340|\002\2043\007\257\363\006Eg\r^\347\f\212\316\030\274\316\027\024\235M\f\235-x\235+p\235)x\235'(:\227x\235%x\235#\030:C\360:?Ptv\340un\240\350\314\300\353L\342u^\340\203\363\210\327Y\001\017\316\"^\347\020\037\234\215\2573\b\017\316\305\016\316\037:8{ :w :\023\211\316C\242\363;tv_\347\033\327\271\275qf[g!\353\374\255\263\263\316\375P\022\312\306\352\256\320\005~\236\225\247\217A\300\347\027\226\313\223\006\353\266\322\316\334l\243\247\334k\252\224\255y>\237D\356\261\276\302L\344\033=e\026\r\031\031*\257\347\363Il\226\371\0063\261Ygfr\207\265\030\023\255\024\t\237R\030t\203PLp\233\345\366\352/f\203\025\365s\351\331GP\314\350(\363|Z\341\240YF\3416\013\242G\264\315z\213h\233\345\017D`\262\023"
+	.string	"9\216\314t@\007\b%[\363|ZI\361K\332\331|\307v\\\307a\030\f\177a:\236c9\216c8\366\302o\354\306m\314\306U\356\302k\314\205\3258\007Nc*\243\361\031oa-l\306Y\270\214\2610\031_\3411\236\262\030[yQ\202\213\026$\344\214\300b\205\n\021B"
+	.string	"\341\003\017:H\201\002\347\004\007\033h\220\001\006\027\230\260\240\002\n&(!A\004\020<\340@\003\f"
+	.ascii	"\200\304\002#\024\020\021\302\b\242\370\301C\007\342\360uoZV"
+	.ascii	"\370\356\344>j\276S\321EV\227\247\245\311\251\331\216\016\254"
+	.ascii	"\216\216*\214\234 \030\273\250\334\365\013\032Un\216\216:'\007"
+	.ascii	"&'\027'G\005'\027\365\242\206\n\367\006\207\347\246&\n7\327"
+	.string	"\006Ge\353\213\302\201U\341\250\272\274]\327\336\300\270Dp\242O\0134MM.Z\215\346\340i\321\265kZ^tm\216\272FE[\243:\333\242\206\247\205LTm\316L\r,\213ZV\231 \2260<\262\273h\330\334\0252\3240\352XX\3264,*\366%\310V\276\256/\002\243_Y%\370E\277\250\\t\t\266\350\242\222\220&\332\225\225\343G\355\242\032\241K\211\305\334\212-0\025[Y\"lQ\205\240%\b\202\326\365\003-6\017\362\250Z\324\016\264\300Rhe\241p:\352\024A\034\352\224\271\023W\352\024*\007\324)Y\033L\241\322\300\216*\345\232A\323Q\245P1\220Bu\301\0365\312\325\204\367Q\243\200Y\340|\324(\321\n>-j\204\002\007\244\032\311\232`0:%X\342\311\242ST\t\246\300\"\300\213NeApG\235\242z\300\216:\025u@J\260\201\263\250\324\225\001c\225*5\007"
+	.string	"\022B\020r\254)\362"
+	.ascii	"\022\2443a\0076P\273\276\341\307\023_ \304`4\nl\204P\001\005"
+	.ascii	"\220$9k\021\302\r\312\250\251\3510?\232\bG\370\310Z\352\033~"
+	.ascii	"`y\bjtH\324\270\027}\272\202\230\243>\315\025\261|\230\213>\201"
+	.ascii	"y\240>eu\370\360$\204X\215>E\207lQ'\301\227/\3524\347\266\034"
+	.ascii	"\325\t\354\306\253Q\247\254\266\305\332\211X`&\n\232\026\004"
+	.ascii	"I\222\263f\267h1\313\022\006\366\345\325\305\265U\345I\226\223"
+	.ascii	"&XL\256\244F\250\246\212H\021\211\202\362\021\355\301\203ii\207"
+	.ascii	"\216A\301@\3006l\376\326\360]\367\310\214\021\243g\245\233\223"
+	.ascii	"\213\203\363\362\346\226FE;\333\242\305,K\030\330\227W\027\327"
+	.ascii	"V\225,'L\256\244F\250\246\212H\021\211jc`:j$?\240\240Jm\fLG\303"
+	.ascii	"\246\034m\fLG\n AB\223A\b\"\tZ\277p\003\252\270 \037\232\222"
+	.ascii	"\204#\300$!\323b\355LMH\35670\236\317'\373R\023\220\346\236f"
+	.ascii	"~\2710\2676\230e8\n,\216f\024\373d\217\232R<\3254b\244m\366\304"
+	.ascii	"\373 \3175)!\321\315$-\007\337\\czI\316\206\231\233G\204\201"
+	.ascii	"\315$\200\034\260E\252\344A\027\270\3403\370\r\3304\255^H\233"
+	.ascii	"K\\%\037\263\246y\205\345*\271\027\250?b\r~\003'\302\2764\032"
+	.ascii	"|\307\351a\360\031<\021\2361\203\301\367\340\225\211\277\340"
+	.ascii	"\275\032E\310\267'\2746\245\360\224\246\226V\333\254\211o\261"
+	.ascii	"f\201\252\312\335\037XR3\214\021\026<\263SK8\306\271\365T\253"
+	.ascii	"PL/\235\231k\367-x\022\252JTH>\350\256E\365R\240\202\357\251"
+	.ascii	"\320\352\304j@)\236\363\251\367\244T\n\276\202o`KX\247\003F"
+	.ascii	"\030\246\331\345>\237\317\257f\230X\333,\005\357W\275\216\372"
+	.ascii	"2\023\361Vp\355L\276\305\332\263\212d\201ASW\342\331\031\264"
+	.ascii	".}g\362\r\205B\222\023\3169\267\306\232ddm\263.\375\276\322\032"
+	.ascii	"\210\241Y\251\276\240\374(\304\004pN,\025\256\345\255Y\206cm"
+	.ascii	"\232\271J>-\361\023\274W\267\b\331\232hM&\345f\232\260\332T{"
+	.ascii	"!}>\237*\232e\341\232\260Ks\255\332lkk\233-\361Mv%h\306\030\301"
+	.ascii	"K\240\346lr!\365\2564\347\022\034k\226W\275\004~\344#x\257B\005"
+	.ascii	"\333\310\201\200\340\254\371\326\302\332\204s\225\\\252\305\371"
+	.ascii	"\204c\365\"/8\247\365\223\331\223\236"
+	.string	"O\034\02507\351\232`\274\227 \370\004T%\375\021\367\232n\2630p_\212\017\220\215\371p\340\037\250\023Z\ts\200m\253\357C\003_N\254\026]\316%8R\307\301\3007\360\216\326\274\023V)\022R\021j5\363\232z\3151c\332f\031\370\026\353\024\252T\251\376\201\235i\206\341\301\263ppb\251\260\336\320\334k\362\271J\375'\\\373\301\301\346jK\342=\353\331\241PH>\310\013\274\002O\342[\211\013\311\007y\304/\2205\342_\021\257@\023\021\337qW|\325\016!\230H\367\214\037B\211\320\252i\006M\263\257\257m\326Hf\215\b\342{*D\342\304j!m\275*\271\022J\177\304\305\007\361\r\025\024\026\021N5\375\270\233p\363\257\331\306\233m\332f\213zjC\026\022i\006z/q\007\302\250\346\340\221\023\311{I8\304\211\325B*|r>\341\250\265X\2070\013\023\366\005\257\031\306\353\341?"
+	.string	"q6\275\020\376h\260\034\037\276\004\322\037q\013gv\356p2y/yx\030\252\220\376\210\273\256\313%~\207\357\251\220\311\331\344\302\252%\334\341|\202#\225\226\200\n\225zt\020&\371 ~\321\272y\177\370=\025\342p65\235\223\253\324G\204O\347Sw\221\016q\225\372I\320\371\344\205\265\225"
+	.string	"\235QR\256\022\221\360\031\365G\177S\316$m/5;\374\027\352\325\274\237\323\210\260\233\260\363\2103I\233\244m\366}\005\364Z\256\333,\314\224/-\216\367\364\3238\227\364\225+W\251\347\214\023\313\205\325\211\253\024\003\203f{\372e\234Op\244\317\247R/9\243\270J0`\320,\263S\212s\212\367\022\303P\245\364G\334^\372\203\323\2175e\216<\360\325x\344`\337\352\311\360\357\3615'\320\rN\217_\f_s"
+	.string	"\335\274\340\361\347\275\361AyV\325\361\333\3615\307\017\312\355\277\360\203i\353\333\203\362\254\222\343\237\343k\216\032(6/\374pn\3256~7\276\346\364Au\351\302_u[S\343\347\302\327\2344P\\\250\374inj[\370\317\370\232\303\007\225C\026~\26342~,|\315\271R\247\374c|\315\331C\013\343\267\302\327\0342g^\374_|\315\311\333\262\305\317\305\327\234;-T\370\265\370\372lR\252\"fR\370q\340kN\227,P\370\243\3605'\r\252\314\t\177\226\033\026&\374X|\315\241B\221-\341\227\3625\347\354\212\022~+\267\261#\374H\370\232S\0065\245\3427\302\327\034,bR\374E\370\232C\346f\345\241\370\243\370\232C\006\365\342\211_H\t\203@\370\235\\\b\372\340\377\321\"\220\007\177\017\022"
+	.string	"w\360/\345\260y%~\350\bk\036\211?\211\005\337?\371\217V\\\003\331\005U\210a\303\336F\004=?\3665!\320\245a\357\003!\316\f\373\231\017\274\\\331\371<x\033\303N\246\0037+\273^\n\264;v<\024[\302\260\327\341h\241c\377r\302,\216]\216\203\2607v/\033\200\261\261\267i\360\265\306\336%\003\257\034\330\3250\350Bc\247^\300\245\205}\213\211'e\354Y,pr\205\235\254\202&b\354S\n\230\200\261\207Mp\325\305\356U\202\252\n\373\226\004E\246\260S\211 \352\006v)\020\240\211>a\207\362"
+	.string	"\032\246&\354N\034@\243\343\212\235I\003\2016\260/a\200M\022v%"
+	.string	"\340\253b?B\202\314\024;\325\002c\240<\253\234\b\273\324\b1>\204\035J\001=\017\302\376$\302\n\345Y\345M\354@B\320y\224\335\207q\316\231\330y\200\220s\035\354;\370\312\"\317\255\3509\330\225\370\312\342\316\355\203\343`G\342+\0139\017\203\354\317\016U"
+	.string	"\271\003\211Y\177\334l\206N\324p\373\361\225\005\033\324\213\206;\r_YT\3352\334fn\230\354q_\333+1\334cXi\036\267\225\257,\322\334\204v\334w?\005\206;\214K\315q\323uW=\315\020\201\362\254\202\343\216\343\253\333\316\255\266\331\316q\263#\213W\025\346~c\346\353;\265\255\241\362z>\217\232\212\231\314W_z>\237\317\247\006\315\272\277\200\025$0\027df\247V\2679\267\334\347\363\251\202\273\332l\316.\347\2273\314\031\3266\353\376\003\252\234m\265\177\3637wPA6\241\327t\334\3473I\005\267Zs\t"
+	.string	"w\223fY\205\025\270Wh\233m\177E\335\025/\252/0\034>\310l\005\251]\255\017\314\021\341[1s\367\003f\235\321\372\267b\026Z\366c\214\211Ir6\314\200\263\225\346j\313\334\302\013\336K\354\267Y\230!_\222\376\210\205\357G\376\231\027\300\200\266\227\204_\"\351\217\230\273\254\267p\032w\023\206\201\251\336K\315\376\367\rU\256lA\341\360A\366\367\252\367;\250 \016\037\344\021\336\317\274"
+	.string	"\006\264\275\344_\"\351\217\230\273\254\263p\032w\023v"
+	.ascii	"S\275\227\232\345fj\333l\177\2135\0078\006\001\251\276\240p\370"
+	.ascii	" \263\025\244\026>\237\317\247\277\025s\013\237\317\347\223_"
+	.ascii	"\t\363\353\354YCgg2tvi\2035\373\221\266\322\354U\354\354E\206"
+	.ascii	"\316.5tv\"\257\263G\025\235\035j\350\354C^g\027\342:\373\323"
+	.ascii	"\320\331\203\274\316\356\344:;\220\327\331\233\212\316\376\343"
+	.ascii	"uv\037Eg\217\276\316\336\303uv\036\257s\337i\037m\203B\332\367"
+	.ascii	"\324\035t\003\335/\352w\032\222\313\246\211fG]\203\366]e\372"
+	.ascii	"\3239S\343\304Z\341\246q\245l\371>\313\341\232\021\263\205O\313"
+	.ascii	"w\232\216\276\023\314\366\306\270UY\276\315\240\256\265\t5*\223"
+	.ascii	"\305\305+\373n\323\373\034\335fyfL\300\362=u\355\3340\356\017"
+	.ascii	"\262o,;\\:#5drW\276\331\036\007\035\2141\270\267\300\351\367"
+	.ascii	"\030\223\313\326\204\032\001N\273\210\r\312\275\360\372\006\373"
+	.ascii	"\266\362=u\2714\255\372\2125\007\275\016\373\266\202\326D\353"
+	.ascii	"\253\365\204{\306|\353\273-M\027\366}\325\373\372\0063k\242y"
+	.ascii	"\325\315\302|\3632k\031\231\364\353\275z\325\365\355\325\303"
+	.ascii	"%k\242\271\032\253{\205\371\346W\251;\306\224c.1\351<\317\332"
+	.ascii	"\365\256FO\214\353=\017\260Z\302V\330\227Z\225\357-\037.\327"
+	.ascii	"\217*n\025\255\357\271\277n\263\2745\027T\276\247.\025\027\207"
+	.ascii	"\233\257)\337T\232\334(B\246<\301\341;\356JMX\013)N\260n\260"
+	.ascii	"n\370\226\342\344J\233\320\"7\330\020\345\273\r\315\026\tP\224"
+	.ascii	" \271\201z\362\r\345\3115\322DC\362\304\235\312\372n+3%\307\311"
+	.ascii	"\367\324\225rb5\0267\2129$\312U\272y6\371v\"\345\n\2216q\203"
+	.ascii	"`}\317\355u\233\345I\031\201\311\367\324\005\342\376h\367\256"
+	.ascii	"\276\231L\271=\262\256\\&\351w\233\236\230(,\226|O\335\035.\024"
+	.ascii	"\316\206\357%F\334"
+	.string	"\244&\024\007\033\\\034V\337mWy\335fyR+\224|O\335\247`[\226\344[\311\221\2336M(W\222?$\337qv\335fyCT\034\361\353k\247T}\037Irs\246\t\265RU\306\310w\033\230n\263\274'\021\250\256N,\027\322\0332\255t\352\233\312\352F\257\t\3052\225W\344\273\213\336\\\267Y\236S\bR\337\323\233;'\226\013k\035s\t\363\312Uj\211\020\371\226\302\272\371\322\204\236\021\231\213\372\256^\301\r\202"
+	.string	"\025\347\245U\032\362\r\345\344\246\215\313\220\252\220\3578\267\300\017\236\326\324\324\004\371~zrCm\242\271\0059s\372f\253\266\361"
+	.ascii	"\310\367\364F\313M\026\026\257\351\033H\224\033\262\271\246\261"
+	.ascii	"\037\337l\\\376:\360!\026\266\026\375\366!\345\306\313.\312\325"
+	.ascii	"\343\273M/\315/\005\217*V*\314)L-W\211\rc\372\346\261u#\245\t"
+	.ascii	"\025\303\024e\351;\356\254\017\005\364{\307\367\364\346\211\263"
+	.ascii	"\251\311\254N\230]_\256\022{\005\325\361\275#\354\206I\032\035"
+	.ascii	"\337sz`J\337P\261\033i\032%\033r\274\227\231\321\341$}Oo\224"
+	.ascii	"8\261^X\2210\307\230d\256\022"
+	.string	";\004\351;\251\354\306H\023\215\311\006\351\337\233\251\306\361\335v\345X\272\315\360\340N\034}Oo\244n\242\330\244~~\037\231\335\by\3663\210\363\273m\354\215\203&\020'V\t\322\037\316'8Va\037\363\233[nz(1\377\005\273a2\372\256\352Y\251nP\364=\275\331\341\304jq\003u>\341X\205z5|\021\332MR\023\352\266RM\036L\272\032\376\005\273\301q\343\273\313\025\324W\267\031\336\232\006\313\257\3614|Oo\236\202al<\rm\232\320\216c\323\305\306w\334\025\215\257\261\246\tm@\251_\247\241\361\rH\364\313\276&\324\343\254\317\347\223\00533\255M\303T#\302\244\363*\321{\234\036\2273\312\367\352\025\024W\267\031\336W\006\023\370\236\266e\234X*\254W/C?\2011Mh\313\265\326V\f\363\255\273\350U1\351\232*\034\372\226\303\023\372\246jma \201\377\371 \27309"
+	.string	"}\020\335\234\034\320\f\377\003\347\345-k\006\237\227@\033\212\226\215\371\346w\325,&\235\323\371\274\363\255\315x\247\303A\312\005;\237|\031jM+\025m\2320K\317\3138kB\333N\272\205\371\326mV-\325\236o;\236OfiB\235\314Z\306|\353@)\226V\303\363N\026\343w\2564\241\2367\306|\363\271\251\027\223\316\343b\274\347YA\276\307E\2312\361\200\207\300G"
+	.ascii	"\254i\265\302\352"
+	.string	"\325\264\302\001;~\004\266\232\320\306\223Va\276u\234U\213Mz\374\306\223\341!0\245\t\3653+\016\314\267\036\224Ji@\031\336\317\364\034\360\017\210\322\204:\037\024\346\233\337Y\237ha\3229\235\324\001\357|N\032\360Nw\005\225\325m\2067\304\202\004\374\002\236\001\337\323\026\253\275\232\022\3033`\255\265\241\t\355;+\346[\307)\251\306\360}\247\200_@\265E\322\204z\331\021\346[\013V\265\237\002\336\313\020\360\thk\251\232P\337\233b\276\271\235\224\231pm\021\246\234\333J5\335\230t.gm\031\332f\021\360\276w\005\326B\265Q20\3010\353\230um\2630\274\313\351Aau\233\3415U`\200w\341\017\360=m\2054\255\\H\333 B\351\013\177\200\023mSQ\357Y\1770\363\232\004\232\2624\255\2176\372\302\367\236^\013\357B\313\243\310\343\230\230y.b\254,M\273\324\356h\341=\256"
+	.string	"o\200\026Z\364e\322\273V\211\231\347\022$)K\323\346h\223\n\360_v%mC\201"
+	.string	"~"
+	.string	"O\200\357i\213\243i\245\242}:\233p\254\302#,<\001\002u\332\016\320\251\314\332\206\r\013\337vW+\374"
+	.string	"\326\350\370\231\324\317\251\314\252\246o\205\3673\025^"
+	.string	"ht<\215U\217=\223\244\314j\246\214\n\357i\364\254\372&8\341Q\370\024\256M\253\025R2B\250"
+	.ascii	"|\nz:}g\265J)\363\312\303\013\300\367\235\316\243`\247\343\324"
+	.ascii	"\272\2612\2570`t\336\251W&\374\tt:\3567\206\235c\362\271\003"
+	.ascii	"ue^rq&\274\373]qABW\242\305\227\3600\276\247\254\227\246\325"
+	.ascii	"\212\250\2330\351\305\3038\301Vu\032\257\013\223\257I\214\255"
+	.ascii	"qy\361\215\347\342K\300as\320\3614k\032\223\317\215uT4\027\357"
+	.ascii	"iz$|\013f\313\330-:\036(}>\223X03\367X-L>\207\300\251\f\nk\226"
+	.ascii	"\305\233\253m\263$\274\007^q"
+	.string	"1\362&A\016\231\023\253\2041\246\031&\032W\351\323\214\3609}\254\225\242&1V\326$\fl\204\357\271\"m\021\260\360\342\022\263\342Y\370\261ZR*SVDU!P!%\312\027\021^\305\037\233\245\323#\352\312\2248i\"\302w\333\225\220\265\007B\370\236\262L\234X+\244\254\264\271\207c\3756\020>\204\367*\263\rk\245\323#\326\312\252\250\274\236\317$\025\215\205y\210U\302\f|\007\314\\A\023\343\365|>Y4\313,\0226\ts\360\250\211\224\243m\026\204o6=0'5\007>\370\236\262UN\254\276\302R9\243p\254o\304\203\377\200%\302J5\241;\232LLm\263\036\374\210+\250\037a\r\234\350\236\262PN\254\027RV\310G\023\340=\272\315\352\276\030\350\340{\312:9\261V\260MM+\034\353'17{\260Q\226\007\333\243\351\243\251\351\344\3246\333\301\217\270Z\3526\253\353\372\002"
+	.string	"\234O\361=e\227\234M-heu8\237\364\325\373P|\212'6G\022\212\3679\275\023\217\363\r\310\r\tL\004tL*i,\207\220;3\020!\201\216<\311\237\030H\"\037\236#\021\317O\322\247g\004\221\211\222J\032Kd\262\347\225A#F\222\207\310I\032?\310\032\307\344\017\217\317q)4\203\210\307X\344\037\241\035\241\245\220r\350\bdc\350(\202\201l\f\035y\222;A7\210\202h\034\223D4\214\254L\362\370\324\020R\016\035iP\376 }\224I\242\020\307\344\022Y\303g\271\203<&y\204\200\224>\310\006\230\350'\031\024\204\234\261sl\200\203\204|v\224F\006R\"\217K\"\245O\3171H\350\370\203\334Y@\006\022\310\003#c|\340\235\035\244\007\256a\306\261g\210\030\342\003\3270\303\250"
+	.ascii	"\3270\003D\317\320\3171\251D\332\340Q\"g\2048\332@\336\360\300"
+	.ascii	"<A\310\030<\310$\317\013D\203\210\307g\310\003\017wv\220\037"
+	.ascii	"xI$$\024\343\330\323\363\362\221\006$\320\f>CD\307\236\236\""
+	.ascii	"\017\021\035\223K\344\217\320\220\262\247'D\322\206\b\037\242"
+	.ascii	" \244ry\344Q\"m(\205zx\222\311\036\022l\003y\343\310\223\\\""
+	.ascii	"\2252\222\313 \237c\222\210\206\210#Q\f\244\221\347Gh\006QR9"
+	.ascii	"cI\202\223<B@\307\033K\237\032H\245\214\243\3172\b\031\002\001"
+	.ascii	"A>\005X\232\300\3433d\364\021ad\032\220?Ie\007\036\242\301\023"
+	.ascii	"\344c\303\307\003\367\364\b-i\354\314\330Y\n\005\025m o\024\271"
+	.ascii	"\206\031\307\017B| \202k\230q\f\272\3013\202k\230q$\"B\016\331"
+	.ascii	"\020\3721\036\225\311\345\217O\317\021H\231\\\362\204\340\344"
+	.ascii	"N\020\262\006\017\362\003\007\371 e\034\211\034\344\003t\344"
+	.ascii	"ie \201~\2225\222?6\2207n\030\205\025\\\230\261\263\364\031z"
+	.ascii	"\031\205\025\\\370\371\021R\272L\264"
+	.ascii	"\364\001\362\371\351\320\356(]\3461q\342e\242\035\345\313\313"
+	.ascii	" \037\241\241\031\220Ie\214#rhY\344\344\022\251<\"\207\226/\013"
+	.ascii	"\r\321\220<*g,_\346\361\001:*g,]\236\201\"\371\343\323#\244\034"
+	.ascii	":&\227H\345\217\220r\031$\264\223b\247\307\002\""
+	.string	"\242\344\216\220r\350\310\3433\024\202\201\204\202\222<\307\235\240\033 8\t\344\263\034\022\022\372yY)D\024\224\204a\031\224T*i\354|\340\0234L\274\234\224\201\\\376\b\325\370\371I\356,\2211j\200X\"c\324 2\r\023\317*xp\334\331A\3360\217\211\023<&Z\356\3004\230\240\241\003\226\223?\310\035\242\243\220\362\206\f\"\rH\240\016\234\374Y.\205\2243\226A>@\035X\310g\211T\226p\301u\201\310<&\236\177\2205\224\311e\220O\211\025\210\234\004B\006\225X\366 \225:D\016\022\362Y\"\201\224B=A>%x\224H\241\023Bp\313\311%\222\207;@\001\002\212\020Z\3442y\002\221\211L\224\320\200\310D\006%\210L\224 2\361\201\203\204|\210|j$\225!x9C\206\317OO\0202\371\243\323\201\211L<'\207n,K$\225H\033@J\237\024>,\203V\260!D"
+	.ascii	"\3432h\205\0312|\004\260\2441\264\244\321\202Rh)\004\024\202"
+	.ascii	"wP\320 \024c\206\035\344O\214\024A>H\240\024;J\242\024($`\241"
+	.ascii	"\241\2442\305RHH\231\202\310\314l\005G\277\022\356&}\203ei\302"
+	.ascii	"ng\333b\355\002\232\341Q\226\366\334\316\326\213<\0233{\221\367"
+	.ascii	"G\342vk\20618(\350\225t\251\247rn\025\245\304)'\362.\365O\224"
+	.ascii	"rn\271D\"N\344\277.NJU\262\326\306\343Q\337S\"\024QH\207<\250"
+	.ascii	"\367(3D\247\" \016\345\306\025\3707\246\031\306\316\220\357)"
+	.ascii	"\361\207\023\253\311\210\321\016jh\210LE\203\304\035"
+	.string	"\304\245\242\276\"\277\242\277\242\277\266Y\037\002\370g\215!\344{J\204\022s\220=\275\013)jC\304\241\323$\220\332\210G\304\347\323w\334\025\330]\267\331\030\272/H\017\362=\035\n\016\001;t\025\005\016\377\212\006\375\206k\214\216\220\214r\344h\233\365 U\270\374\266\302D\300\235\276\247\303\276!\232\016O\200\274;\r\313\030A\233L@\236\256\333l\f\334\227c\323\225L\207\251\037\357M;\206zE\326\037j\266\342\232a@\300}|O\207xC\273\016=\242\357>\230\206`\212\232\355\213\221Sw\241\363\250\027\256\2767\031\274\307\367t(7\204#\376\361x\357\321c\350\246\323qmFN\315\306\306\343\fW\337\026\333\003\230\272p!\346\371\322;\223\217a\232N\267Y\331\250iH5r\352\252\364\371L\2422D[\232\343J\363\267\346\200\035[\234X}ehF\354\242\343}\307\323\020\013\231\2164[94"
+	.ascii	":&\266\245\364\016\0352\004\373R\372Cc@\216\256-\252\244\367"
+	.ascii	"\034QC*S\222\370\266\264\304\200\364=\035Jqb\365\2314\212\221"
+	.ascii	"\224\321\224\253DD\302\361\216dd\230\345\004\307\365\257l\001"
+	.ascii	"~\364=\035b\r\257\206f\374\371~tdh\303P\311\320\312(\211\225"
+	.ascii	"\321\222%m\263\376\274n]Q\300\340\367t\210\304\211\325X\252\214"
+	.ascii	"\256\214\260\\\245\241\027\301\357A'\303)\251a\021\243'Q\214"
+	.ascii	"\244H\021,\303\265\367'\226\200\300\250!g\200\337\201S\206A\200"
+	.ascii	"\f\235\214\264\266\214\272\272\332f\033\220\314\037\030\002\332"
+	.ascii	"\374pb\225 \035F\277\330|\267y\257~\r\231t\206;\206KFabFccm\263"
+	.ascii	"\315&o\253\013\206\277\357\351\020:\3141|\262\346\373\357\275"
+	.ascii	"J6\304\2413<Z\223B\034\327\335_\225\003\370}O\337\3017p\230D"
+	.ascii	"\315\267\337{Ui.\255\263|\350\276o5\337J7 \371 w\232\357\276"
+	.ascii	"\177 P\251\f\232\3574\337e\357_\221\337\273\306\310l\213\021"
+	.ascii	"\032Z\333l\243\371\026k\241V\0226)\325\327\224\027\312|\237\351"
+	.ascii	"s6\365\0254\303\037f\276"
+	.string	"\317\244\275e\370\314|\263\361}\227Q{\367\310\360\261\341\352\262u\203\013d\276\257\337\323W\214\263\251\204\327:<\332\373\276\256\275wv{\337]\306|\223\251\276a\300\214Q\301\013W\332\223\026\304\320\311\275|z\337b\332^/Eoz\\\270\250\177M\232a\030\300\372=}\333\336\352\013\227\367m}{\271\350\250\345Q\267\256\232a\024\300\356\033\357{\372\246I\321\214\340\214\344\\\245\027\013\364\356\033\217\356\325Rdv\367\335\246W\367m\007\346-+\302R\247B\032\256\263?\033\232a\020 \314\367\364\275\342\304z\361N\337)`\276\303\324\275aE``r\340*\373K\302\302\027/.$t\337_\356^-*te[U\3150\0060\367=}qxox}\310}\317\345\275O\234\274YFzc\214\366\366\332f[\256\013\027\226\251f\030+\304a]\275Gp\337q|\257\rV\r\307\306E\366G\244\031\206"
+	.string	"\274|O\337$\357\021\277\267o/f^*\235\267\310;e\204\206\215\372\214\374\214\374\332f\373\355[\254S"
+	.string	"\343\"\333\002\033\322\fC\005\267\357\351K\344\205r\357\332\276\335\214\376\336\247&\232\021\227\266\327\211\355\273\355\352\203\f\246P\375\236\276M\257\017\267\255\313w\325\250\315\313\303\255\313\322\332w\365\252)0"
+	.string	"\\\276\247\257\016'V\213W\311(\320h\320Ur\317\324\276\271\034\275HM\2649\265\367(\207\207\204\250\263\340\246\211\204&gJ\221\210\210\210$I\222\326\243\033 \b\307q0L\241\331\006\023\300CG\347\304a<M\364 h\030\243H\227\221\016k\351\342\023\324\350\204\243\026|\341 \026Ng<\200\271vf\212\313\273(\001\362\230\240\322HS}=\335\255\341j\272\021\336\330g4\221\226\326\"3H\216\004C\r\374\242"
+	.ascii	"|`\310\022v\260\017\362N:1\2600\004\013\200\357\214Z\034\202"
+	.ascii	"\276 \004\270\354\0301\001\201\006\223#H\217tR~\270\321b\037"
+	.ascii	"\001\341%#\326}\007\363\205\260\373\312\366\366\230}\243\214"
+	.ascii	"\227\216\310\307\370\034\212^\367~\213\351\021Q\301E\210 \020"
+	.ascii	"0\332|\327w\204\350$\256\344\3038\f\370\246p\266\020\344\263"
+	.ascii	"\373\231\343|\342\025\3255\026D\200\303\177\305\3354\350\330"
+	.ascii	"\270\326\204E/\031F\323*Zb\326\317\366\tG}\n\372\210E\024]{\016"
+	.ascii	"\275\313E\253\t\350\341\366\376\027\"\241\313\\"
+	.string	"\022e\320\301p@\213\214Y\374H\355\322:Y\221\351\352\002\300\376\220h\321\275\330\247W\363\327=\033h\347\272H\353\\\267\277[\255o\206\312r\335\030\376\312i\335\211\356\360\354 \330\302s\262\217tZ\270N\324s\236#8M+V\345\270\332\032\331\\\354\354\327\220\273\335rL\225T\225Q+\017\3172\305\r*\001u\f\346\203\241\007\252\241\334\326[;\212\200h\272yW\227\227\276\020\216\342\311z\f\244\024TMz\216\370\370t0\303\266.{\346\362\351=fe|\031\203\225\344\302\227\317\273I-\2251\367o %;XCS\022L\2468l\037u\341B\245?;\bXlh\036w\fOI\005\337\022\255U_\027\354\b\rS\364\2159\264\344\220j\226\246\032_D\204iL<\232\233\266}F()\323\311\363\250]v!\323+gu\314.\034\362o=O\212\r\306\\\b\344\337z4f\232\261\315\325\304"
+	.ascii	"jCj\255\231`\211;.\020S}"
+	.string	"|V\017j&\255'\266\244c\325\b\244\343Vc\035\342j\225J\231ZK\027\232>\371\003\023\375\220\305\037s,l\250\\[\006$y:\306;\321v\341\324\320vi\304\350\320\r\f\212\222\324\374\317\235\322;\223\224\273\026\305~\326\2134\252\353\254\266K\277\001\301\360\021\350\364\346\033}\204\236\232e\313N\335?_;\330\020\230\025`\rI:\3023\205w\2759\017\350\233DM\357\321m\303-\223\366\036 \237C\235\256\b\244\303\3205\367\212\205\231\246\251\266\220\211\275\255\007\243\260QBCU\025f\fpo\353M\024\371dUV\001\032\370%{\025\007H\243a\377\340\260\266\205\304\346u5\0352\266\f\344\272qQ\236\322 \345\275\300\362/l\330\337'\254\343\202C\377\320\332fZ\216\323\031\321P\2640%\\\332\217:\330\303H\034\343\3055/"
+	.string	"\353\341\036\337\273\320jfM\231\273\320g\242\222\253j\332\332\343\241\ta#\272\346\232\216\026\357\324k\\)rD\n\212 \260\013\312#\300+\315l\244\222\221\243B\236\354\202l\333\303\304\272a"
+	.string	"v\375\216\306\212\312\021;\337\016\304E3\256\212\002\033\265\003\017\343"
+	.string	"\333=5]\333\304\332\003C<)\275('P@\371\b\301g\304\267\265\260\006\222\272\356e|\254\031\316A\007\361JT\031\247K\f#\341\336\247q.\\\362O\nU\376\007@\364\366\341s\024\270\032[\3501c\t\261\205\302:,\273\315a\372.\022\314\031t\356\374|\274\351<\224ee\201q\001}\253\307\027\235\266I5n\004\340?\"\253\254\355\001\271?O[\347\230$"
+	.string	"\255l}\307\177\357/c\307\r\360\033\215LV\035\274\323*\033\013\300\362\002\300vl\301\341z\240V\224\376;\266>\004:J=\tv\341\242\314\205aB0\260%\350\236\331\331zq\021`[;\216*Z\355\"\371\344\362\027S\364\251\313f\260{%\230'\267\257d9\276G,\022R;\316t\225L\306\001|\264\233[a\177\001\303=\243\252@\333\247\311\203\002\256V\002\226\n\360\217Is\005\340\215\242e,\346\021\334\237\0179#\020\377\260\304.\022\210\211-7\013\220\201\016\003\212"
+	.ascii	"]\355\023\217\337\335=F\3060|\203\351\035u"
+	.string	"0\251\277\304\332]\233\350Y[\nid\341\243v\304\276\254\315b\317\276\347c\rGq\0373*SOJ\0337N\377E\376RkW\315\353\326\3472\310\263\233\350\335I\257qJ\354\205\002\251\244\216\2007\026\f\026\023/\222\032\366\240X\365\256\177\330\3431\376\200\324A\371\036\030d\022\352\225b@\232\006O\213zL\357\020kkaH\277r\225 ^{\223I[\r\007\344d\b5)P,\001m\220\372\330&H.HOd\311C6\002\3445&\301\233\257\177 \3620\303\362e\034p\037\325 \322\254@\251\356\013\226\347\240\220K\372\375r/\370r\204@\366\030\001\356#\217\276\337c\013\316\206$Ev\023\n\227z\n\021\200s\206\t\347\224\316\351\032\200)\r\337\346\001\315c\211\270\3528\0205I\237%\034\344\364\275\276\3465\220i\005\201\304\257\211\265\321/\262\351\t\034\332K\266\220\277\375R#\001\"\001p"
+	.string	"\301\345y\003]\tPX\017\361\311|\345K\n\210p\205\204\221\301\231\237P@y\315H\253`\261\240\n\320\t\f\225\324\222O\255\031\224T\272e\343\370\030\276\345\370\270o\001\305)\337\230\221\207\267m\024\221\344\355\316f\262\224g\251\022\221\017\2549\373\203\266\240A\313\002\2118L\366\314\324a\274\016\n\351L\245\225B57\240\232"
+	.string	"\016D^\201\221\343\217\224j\354 u!\027\261Y\343d\032\334\333S\352Dj\352\354\254\0030#5\211*3\0366fO\304\310\033N[`\002L\356IkdaaF\016E\277\277\236-\266\233\022a\366\035\211\350(\250\264\242\372\364\334D.\235\246\255\3637\314\214\314\017\257\"\371\362\220PK\324\276\317uL\313\362A\002UsK;\322\204\332B\223\210Bq\300\"\314-i\340\302$\356MB\001\314Fh\343\213\300\302\335Q\207\035%c\261@\300Q"
+	.string	"c\220\263pt\006fOr@`\235k\360\221\312G\216\234\016M\326VXs\361\212\231\324\302o\207\244\320\273!\223\325\034\235U\025\207\336\357\034\205W\030\316@\002\2403\021\352\025\004\202\310Z"
+	.string	"\376\205!\021\037\244>\315\253\023\263\t\313l\204\207\315\232%\340&\205\324\3722\364nL\351\354\013\271'\336r\306c\315qt6N@|P8\321?\"\2209!0\217\374\341\t<l6E\274\004e\225\344b\327\r\177\360\020\222{\203\323\332^v\t\212\273\300\232\3616\330\312CO^\030\013\367\373\226\203E\377\036X\3368\026\374\255U{\201dk\252\255\315\322\255\335\202\213\201\2431Y3\244\347\333u\371\211\\f\371\375\377\264\203\236\035\241\001\346\006l\311\030\177u\340\264HW\3420:\346\352\"\245\273\3212\233Yf\030\244\231\350\036\275sc\242j$\254\260wP\341I\304\313\023\325A\252S\245\3661`\205\210b\354\001\303\345m\b\350?\375s*\033\020nd1d\314\242X(\206V\243;'u,sH"
+	.ascii	"\243\352\353\374\251g\2363\322\005zP\257\241\030\313M],\224d"
+	.ascii	"\252\245\b\363E\300s?o\265x\246Z/\373\3430\3761@\0221\301\003"
+	.ascii	"\3261T\362\305\332\235\323\020\037\346HSN\177\276\342\210\271"
+	.ascii	"\b4\351\001\001\254\013\225\234\027}E\024J\003\235\274\262+="
+	.ascii	"\306[\352\313\rdje`P\236\300\323I\020\211\236D\214\211\016\200"
+	.ascii	"\365h\021zr`0\211P\3601.\270\034\0043\304\377\245\b\2104\372"
+	.ascii	"\347,n\255\262\251BG\304\007\230\003\246\236\306\322\270\330"
+	.ascii	"\252b\207\246d\277\036;\352\307B\037E\364\274\"\026\313\327\341"
+	.ascii	"\005\177/\374R\244\3660\206\346\206h\206!\270\271\263\213\356"
+	.ascii	"\002\247}V{\340\373\221\212>\354\375"
+	.string	"O\351e\3074j\352<U\336P\032$\307g\024\372\316\361\031\205\276\363\370\311\301\301~\303~\206\375\f\373\331a\2774?\375-\360\333\020=\216a\350[\365\330\277\207!\325[}\202=\340\370:\023i\361\371E\344N\344\320J\003\243N0\263\237=\f\306\225b*\006\026\254\313l\223\374\320K\272\203Q\247\270A\227|F\306\222\340\204>\351\030ZJ\312\f\272\21432\226\tG\364I\307\300RR\346\320\311\234\221\261H8\242\237<\f\226\2222\205N\346\034\215J\302\021\275\344a\224&Z\220\022-\247\3016D--\2522{\030\214\312\323\025\271\210\313~\245X\n\0318\351\317H\256r4\006\375\354\236\001\316\016\306\320\035A\241\362\341r)I^\203\221\r\301J,Cp\322\367\343@#+\331-\302\246\233\2216\357\367\206J`\022h\304E\322d*\224h\350+\241\215\034\242R\242S\331N\020\016\376\231\265"
+	.string	"v\005\224\025z\033y\321Qsv\264\203\301>:\221N!d\245\200h\023\313\352&\"\222\215\240\352\242\336{#\277"
+	.ascii	"&O\305\2224\205\350mu*%\313}\225\311\025\235)\277S\005\336j\253"
+	.ascii	"\205\345f',S\024\362\004\037\251\330\003J\365J\006\262W\225]"
+	.ascii	"\225=\\\352\004l\356,\213\252?c\267V\224\322\2455S\013Ppl\371"
+	.ascii	"Y\222l\272n\213\322\367\\\317m\313m\224\024\013\242:S\306$P\001"
+	.ascii	"\030\"H\224\376\271\221\207d\320f\017\207"
+	.string	"G\004\250\274\3651<\361G\314 z\0164*GFE#\365\352a\225H,,1o*\346\036>\327\ft\035B=k\032'\353S\3024\315St\332\366c\f\275\201I\255\372`\b\0176\307.\332\004o*$\226Z\272\264\276f\3118:"
+	.ascii	"=\310\030\236C\326\203\367E\374\003\353\217\347E\240\035\312"
+	.ascii	"\027|\304\003\365\r>J\026Ut\301G\273\2507\2305\203\376\267\\"
+	.ascii	"0q\360\316\013H1\272;\325\263\022\357J\315\264rQ\335M\324\263"
+	.ascii	"\022\347Z\251s\206lZ\235\264\366\026\352Y\205;U\346Z\271\224"
+	.ascii	"v\026\352[\211;UfZ\273\250v\026\352\343k\326^!\344\362_$u\234"
+	.ascii	"."
+	.text
+	.section	.gnu.lto_blackboxWriteLiveSysinfo.171.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`~\fE9"
+	.string	"ja\244\025DP\346Q\007g\222\2259\302\314\022=y{\255S\215(9\352.\320.\202O=\205v\365Okw\004>Z\202\307\021\225\201\035P"
+	.ascii	"C$\200\252\002\001H\027s\334\202\t\335!\036\362\037\273\271\333"
+	.ascii	"n\"SJ\001G\001,\001N\001\027\356\310\332\312\250[\371M\032_U"
+	.ascii	"\353b\266\225M\025?s\017s\037\363\334\355\355g\374\254\035M\277"
+	.ascii	"f\250\216^\326k\023\265\272'\330\261\335L\277c\234\314\321\313"
+	.ascii	"L)-\245\261\322\265\252\303\342\240\306\3650.\246\373\355\033"
+	.ascii	"^\326-\242n\203\3428~}\355\276\321\375\372\372\335T\355bN\326"
+	.ascii	"\257\324\301P\371X\016\217\231q\013G\375\232\3061\026\206\326"
+	.ascii	"W\237\032p0\377B\345a:x\261\2264\016\3623\213\246\2019\360\265"
+	.ascii	"\227Z_[\352A\326\327\326\217X_{B\005\252\206\221\254\224}\"P"
+	.ascii	"\237\3150\203\342X\312\224\2438\354E\300\037\321\320\353\372"
+	.ascii	"\332\036\273\362\362\303\355J/\262\020\255k{+\223%\304\201@/"
+	.ascii	"j\334O\200\033u\215((GU\033\002f\241\316y\203\200\250q\334\237"
+	.string	"\033\025\216\317\201|Q\323\372\264\bz\274\006\3235\202\334\016\326\026/xE\305\371f5\237u27\242\360\026\035\004F\307$\310\226\257O%I\220\0341\242\305t\263\254X\026\213\2213g\202\005uy\276\204z\346\035p\262E\367\313\332\301S\222\303\326t2\377\036YU\377=\rq\034\367;\263\202x\033y\267\253\350v\004\335\356\240\336\032\224o\227T\205e\310\352\247\375\317\2358>\355S\2675\271\366=mjq\355y\354\314\301\323\376V'N[\273[\317\265l\356Kb*\034+\361\022\266\366:=wANkM\255\235N\317]pK\243\343M\254\257r\332\323z\356\302Z\232\303\351\356\271\tQA_q\254\364g\317\2753f\340k\316\236%F\362w\335j\336\304~\316\371\355\230\317\252\257vw\t\177\323\324\306ql\241\335\215\243\231h\367\362\265Q\244xw\246`}\375\354C\242k]\302\226_\355"
+	.ascii	"\337\255b\305\273\363@^\002B\265B7\255rB\\U2^~\342\031O\335\031"
+	.ascii	"=\271Y\260\236\237\310\362\354xB]\364-\365Fc\273\205\303w\247"
+	.ascii	"g\037h\002I\351\246;\262\262[Z\365\371I\267\347j\265J\355\354"
+	.ascii	"\244\273\375~\320~;\3600\357\003\375\235\324~#\265\337\003\334"
+	.ascii	"o\001\356w\320\367\035\300\375>\362}\003 \3726\032\372.r\277"
+	.ascii	"\201\357\367\317\375&z\277\207\334\357\367\375"
+	.string	"v\335o\337\373\335\272\337\275\367\233u\277W\3377\257\375\316\355\367\367\276]BL\377\372e`\262\320C\177p]\330\3367\023AI\332y\230d\265e\272\025'\260\262\252e\372\221fV\366P&\262z\256\241\354t\272\334\3746\177\313\315_vG\213\353S\002_q3(\325#\201y\364h\231\256l\263\357\307k\301W_D\003\234\345\245#\273Z\\\230\035w2|\260\260\371zD\240TB`!\020\340\210\264L\030l\356\345Gk\336-\033.\362X\260\2216\216wX\350\007\362W0\022X\t\274\265\305\372\312f's\020j\242r]\302\326\3325{\331\373\200\257\270\240\250w\302\\\276\007\332\244e\262P\342\3455{\363n\311\374&\374$\n\334\325\305\372\312\313\356&\316[\256\253\263^\023\373 SQ\342\207\353O\233R\354\013X\007\371A\366\246\326+\177\331\324\356\325\260\024x\n<\205\365\325Av1\316"
+	.string	"\314\031\334\363\213\326\362\253\355s\330\005\037\204\336\301W\274\fK\313T\241\300W/\363:X\013\004\2708f\272\023\346\3222?(\200\273\300Q\"@\250S\272)3+{\212\027\307L2L\307\276\332\bN\334\201=\301\274\314\311`\261\r\035^\354\311f\225\225]\340=\215\243\tq&b\304\273\263\035\215\273f\350\330<NMt!4\022m\b\235p\030\2116\244\220C!\001#\021)C*\312XD\016\205QNE\344\2240\251\241\022(=\200J\320\353cTT\02195\f\366Q\n\207\320\311\305\324\023\021\n\251\241j\344@:\035\235\206F"
+	.ascii	"=\225 w\024\321\210\024>\331h\373\230 7q\206\024\222\210\024"
+	.ascii	"B)!\215B\344Q\311E\221\304\021\022\352\243\246\236\262\020)\364"
+	.ascii	"\340\202\206\324\013d\2618\003\305\320\b\354\341\022\216\342"
+	.ascii	"S\214\241P\306\023\023\r)\341\f\246\241\361\310\264t\240\213"
+	.string	"5\210F&d\261hdz\245K\347\305\331I\273\027u\217Y\032\236;\314:\231\267u\324)fir;\314&\345\036\335\235\224[\3032Wu\2161\237\216\245\361\212\220\362Y\023\020z\306\235~\274\211\035\220\221rF{2?f@\316mkl\317/u\236g\276\200\002\304\300\225\301<\226\240\317\203y\347\3014Z\020\316\351@\005\344`\\\2376\277\243\034\024K\332\371\331\227\344\333\0224\031\3272].@\016\352y/\001\262\343\351\002\220\217\362\253\355\371/\370\t\200\374gqsbDE\331hK\322\316\315\262\260I\261\244\231\225|\376J\262\217Qv\267\256\260\344\237\257\222\fT\224?L\227\236\350\020p\n\234\224$\025\002]\033\200\352\250A@\303\034TFFDDD\222$I\007\340\002\021\241!\326\001\021 \255TL\215\fI\n\222\306\213A\340X\251S%\327\245\351\034h8\375\344,\253\031\3179M"
+	.ascii	"\314UP\034\324\244{YH\320\026e\246o\211\003\323\006T*\003\002"
+	.ascii	"Anw\016\217+v\034\370\366!\203K#\002\201\324\336\301\n>\253O"
+	.ascii	"\310\316`\256n\035b\024\031\365N\256\by\005v\021\365U\262\337"
+	.ascii	"*\177\222<\255\242.&\207\360#\227=\227G/\234\002\205\006\026"
+	.ascii	"\362a\341\260/\215|\021Ws'\262\364Nz\335\323\226J\323\226 \243"
+	.ascii	"\306Q[\033[\267\372\333\213\314!D_\344\025\035\312<[Eo~\364\206"
+	.ascii	"ju\355\360\234du\004\352 \237\223H4\327\205\230'd?k\336\024j"
+	.ascii	"\241\230\\og\330\250\n\252\023d\360{\326\363\036Qs\376\354\030"
+	.ascii	"\231\353\b\350!\036\233o\352\225k\304~\314\316\354\316\271b\261"
+	.ascii	"j\016\224d7\377\250@\344\312wn\r\363\271o\262\026\r\307\271\022"
+	.ascii	"f\315E\314G\034fJ\001\330\266\203K\314B&/\274\270\205\340\357"
+	.ascii	"2\017\003\204uB4\247\021\304jCp|\230N\352\307R\207\3777:\377"
+	.ascii	"X\353\372\271\240\223\377\240\205\035\362\334\242\302#\027\365"
+	.ascii	" \226\373TKC\365\b\262l\301\007\366\321\2362\177M~\245M\205L"
+	.ascii	"\nP\004\230\267?\246\305dY\367\03162~Z\024=.\f\027\215\030!\214"
+	.ascii	"\225\032%\320\356-\005\244\360\334\2179\345\314#EA^Q\3020\"\337"
+	.ascii	"JFD%\226\207z\300\325 \201@\235\275\344\22265bCJ1rn@\230\026"
+	.ascii	"\025\251\341\037"
+	.text
+	.section	.gnu.lto_blackboxWriteHeaderBlock.172.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\200\003\205\030"
+	.string	"\206\356\240I\300\026U:\350i\266\341\363C2\2109q\245\242\301\236*hGD\367\b\\\300Y`\027BDXD\321\266uy\272$\221j\363,\272\273\350>\004A\251>\222\355]\001\035U\205\271\367\231\232\366mQ\017K\b\331D\312$\003\214"
+	.string	"\202"
+	.string	"\214"
+	.string	"-\266\324Z\017\234n\003\263{\3771;\020\240\261\246\336`\2208\252\265\352\354\002\3634gd\336}\217\373\230\375\fqT\2551\260\034\325\332\323\331\035\363t{W\221\247\346o\310\323\335\335\004\013f\033$"
+	.string	"G\343\202`\211\205\316\007\246\326\036\253g<\350tl\016\332\337w\tV\256\034\331\361h\247*>\0028\361n\334\243\001\036a\202\377\235K\360p\343\352\207\263q\337y\004\317\306\\:\250\265.\357x'\276\344w\267\265\273\021v{H\n\204'M\277o\212\204Pt\304\032\027w{4n\031\273\037k\307\330]\336\325\317\037\247yU7\372\246J^\233\023}Q\007\362\323\224\2743\224W\206\362\236(o\f\3455\225\274f\311[2/I\362R\312;R\336\246\274Ly?\200"
+	.ascii	"\016\"(.\\R\253\211\242R\215B\221\344\270\321O\364\0131\002\252"
+	.ascii	"\251\275\250(\023JK5\036\274h\377\333=\235\362\356l\357\333\323"
+	.ascii	"\356\022}x=Q/Bh)\327\021kK\202\007\236J\206\3472!\241\3232\266"
+	.ascii	"\214#W\365\177/\020\304\313\215T\243Z\325:ErIOr \320^h-\360\360"
+	.ascii	"\220\247\251\276\220C \236\300\341\n\266\351]\327\213\277\333"
+	.ascii	"\377>\352xqk\332n\357\253\204D\265M\277\350\246\031:a1\227d;"
+	.ascii	"p\310\306Q\377\003\211\352\266%}\t\362\344\306a\266\033\325\214"
+	.ascii	"\244#r\277\273G/\271!\333\372\334\b\314\254\2652\330\023y\221"
+	.ascii	"\f{\241\323\335\020\343\357N\3671\362\224;=<\354\363\003{\311"
+	.ascii	"L\030<\370\374\2744\220\262\327\205\326\013\003\271\256\035\020"
+	.ascii	"\261\236\f\256\226\206\036\326\017\254\265\201\345\222u`\355"
+	.ascii	"\020\330\030\207\227\214\345!\026\223\261N\275\372]uN\255mK\323"
+	.ascii	"3\275j\212\244;ez\246_\245\n\025\231\276\357\243\322\351dx\322"
+	.ascii	"SO\201\005\240!%\246M}\352\347\\\330bzD\202\362\304\324\025\316"
+	.ascii	"\340\3604\333\311w]T]\266\331\317\r5)\373)\316 \217\025)V5\331"
+	.ascii	"\273\023(\344\340\232\266\264q\232\354g\311\355\260qq\307\246"
+	.ascii	"\035< \240\"!\243\353\232\b\f|=)\340\r\243\307\263Zx\013\266"
+	.ascii	"\013@\331#\344\330\346^+\306&\b\023\267\260\2373\222h\024<`\306"
+	.ascii	"\t\331-#+C`\327\266\022B\234\202\271\021\206vi\207Y\332\256m"
+	.ascii	"\034\326\310\026\377\204'2\274\341A\222\\\357sVejZ\016\271\357"
+	.ascii	"\212\303\nv\302\303\352a\026\3601\302\244k\021\323\202\323b\216"
+	.ascii	"\237\230\377\271Ek\237\323\305z\002\266\r\2320\r\3200ltK]Q\023"
+	.ascii	"\231\256\201\002"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.173.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\035\f"
+	.string	"6\327R@ q\223\016\270\220\242\020\322B\030pD\370D\002\202\312(\001#\325\227\223c\354\203b*W\265J\220\205\027\032F\2473\01666'\b \biE0\020m\"2\210\030=\327Z\221O\366\2262\245@"
+	.string	"A"
+	.string	"?"
+	.ascii	"\357\004\246Cc"
+	.string	"\366\215s\"\026\263\222\202\004%\307\356V\032\342\330\237&\346[\266\354\217\332p}\031\222\007\035\0016\321\323\310H!y\367,\331F\231\036\037\273\353\324\266\f7\274m\005\266\023\330_\020\245\037\276tj\372T\246\206\013\r\267\301b\027C\334\261)0\006\t\333\277\330N\356*\260\237P\300\f\330QW\202\200:4G=\355\2378\n\354\245\n\006\260\013\342\005\214]\356\2009\324\241\346\005\246\303\261\205\252\211\363\233)\265\323\315\030\245\212\005\304\030q|3]S\177\241\203\350(_\021\301\037a\221\221\27462\035^\337\375\225(\3210\301\301BF\233\313RM\354k\2141ZI\366O\376\351\001V\310b\360B!\037\t\037h\017g\302\325q\340\261\036t\252\220\006\026H\345\001\211T\234\214/\b\037P\025\272.Pu\341\366\357JR\221S[\003\376\310r\345ow\367YrR\2506\310\225\327\f5\273\312\207\025"
+	.ascii	"`\251'3\b\3200\242\030\003f\355\230i\006XI\264--\b\027\027N\322"
+	.ascii	"P\030&4t\r(\206\321@\370MM\201{\301\324\024q\227\233j\217\006"
+	.ascii	"\246\366"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.174.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\374\001\215\021"
+	.string	"V rF\340\322&\035\023\213+\270\224j\220z7S\247\"3\305\324\006\273\004$-U*\231\222a\3140\003\320\257\262h\034\026\260s\206.\340hl\003\342\030\232a\024\023\326\257\271\202\274\344\017T\022\020\346\370\302\222M\244L)["
+	.string	"X"
+	.string	"b"
+	.string	""
+	.string	"\036Qn\262=j/\331\036\355\032\233{<g\226\255D"
+	.string	"g[\t\302\022:F>v\267\323\021g}\213\232&\313\177\320C>\260\365-"
+	.ascii	"\330\341\221\303\265\021\360\3461\234T\r\345H\2463\002\346h'"
+	.ascii	"= ~<\350\211\001te\236Vv\327\371\201;\367\351\266[l/\260\323"
+	.ascii	"A\241Oi\313P\310\177\327\277h\302!si\313~\271R}\354k\253=\266"
+	.ascii	"\246E\2644\247i\325tj\372$'J16|vc7C\bde\261\006\212\277~\373"
+	.ascii	"\376\212\307j^d\004DH@\273\313]\310\207}\350D\254\277h\276;\373"
+	.ascii	"\357'<\261\264\253\341\300\243U\002\332S6\021M\305r\220\204a"
+	.ascii	"\310\343)\033\247\"\372\234\017\256\f\355\313\370\f\325\212\205"
+	.ascii	"e{\344\364\261k)\206t\250\340q\313a.&$vW\301\210\316,\374\230"
+	.ascii	"TahF\037\223\352a\037@\243\351\350\263\020\241\013U\037\247^"
+	.ascii	"S\261\244\233\234\331g\361\026.\376\217_\274\350{\333cj\201\035"
+	.ascii	"<6\031\250\031T\203\031\230U\205U\210U*\026\274\224\213\n%!\325"
+	.ascii	"\301\264\240^:U\214L\247rbo\302*\246\233\361\274\230\216{\331"
+	.ascii	"<\350\277\320\324Cf\243\256\215F\333\025\301\340\257\037v\001"
+	.ascii	"KE\031\332\260kl\245\374\326\300\243WZ\031$\226\344\213\016{"
+	.ascii	"\260\t\021!\001}>\204\315\217E@\345?G\317LxH\n* P\2021\246\220"
+	.ascii	"\007`\365\004\001?\274\231\260r\001\347\330;bo/{\370[\241\b\214"
+	.ascii	"\231\315M\027\027\262\252\205\306N\250\315\220d\024\023!pC\373"
+	.ascii	"p\256\367\004q\255i\211'\216X>g\232\342\260\030\357\017\304M"
+	.ascii	"4\bck\n\312\023\237\023V\2009x4\006\346H,\262\350}\033\345\002"
+	.ascii	"\316\305\273M\256f\017"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.175.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`x\002U\024"
+	.string	"\246\343~I\320\362&\035\214\227\215\032\020\033\021\b\002\240\254P\321\231Tw\327\217\335\303\177\232\300\004(>\254\307\027\346\374\321\232i\003\231\300\212\341\303{w[\220\333\344\002\365HJ)\367\001\2305\006\342\034\031\210\031\022g\214\275\311\336)\005e"
+	.string	"b"
+	.string	"q"
+	.string	"\273:(\247N\t9\365\355$\3654\344\003\352\251Mc\177\247\377,\263\235\n\330\354,\301h\204s\002jw\301\tt\331+\365\246\224\371 +\"\2418{U\211 N?\334\363J|z|\214\2105\236\311\322\016\347:\0339G\304\033\317dwOt\231#\326\244\004Y\331]\313P\334\271An\273\305\366\002[&\005\364EW\001\013\331\245=\364Q<E\213/tj\027\030\365a5\206A>\374<\322(\356n\346\314\276\325\344\374\261\357\355\364\261=\351\257J\253\250t\365\244\345\224\376H\311\216\034\036\376\243\307n\207QjwT\251\304o\277}\337\350:\232\347\254bk\372^\344\343~t\233\354\267\231\357\316~\307\304\210\364\024\363\233\277\031Q\213q\031\022&\260H\226z\252\232GL!`\310\034\367\262\212\255i\250\316\027\256\027\001"
+	.string	"7x\224\356B&\347\002\003\203vi\024\352i\235\025H\212F\216\b9\355\n\307\265H\202vW\301C\035-Z\276\220\234\307\335\213\2621\r\361\320\344(ww6\347\217Q\376\311\322\341\250\221Q\016 \275{\251\276\350I\257\025g\321r\275^\365\001\253\230U\203\230\027\227\006\227\210[)\033b,\227\326\312\002\013|iY\301\300\026L\0060\245\304\261\013.\0300&\026\203\001\277\033\355D?\207\261gG\233\265:\343\355\222`\200\273\200\247\234\034k8\311p\021\234ze&\247\250\001\371\334q\016\352\221\255\t*<\360\007\325\327A\210 \037\232\316\231\247tF\033\336\374\261\374I\375&K7c\034G\036?\251\252; @\002c\020:\356\240\352\t\006\304\260\005\302\312\r\350\336\336\310]0l\r\307\366\350\354\212\212"
+	.string	"\312@\023\022\"\333\201GZF\331\264%Y@\016\221\361\017\031\316UR\235\225k\244\3042\";"
+	.string	"\f\353\007!\006\021;<\313\030\016H\034P\223e\b|\361\223b\261\303"
+	.ascii	"Q\2036\215\024 \216\003\333\001\222\035\270C\351$\323e\266\301"
+	.ascii	":\321\"\212\2759\026=X?^#\354\004spmL\324\021\021\026n\317\226"
+	.ascii	"\332|s[\253\364"
+	.text
+	.section	.gnu.lto_blackboxShouldLogGpsHomeFrame.178.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\r\003\235\026"
+	.string	"6\251\220I\240\230Q:\nf\334a\251\317\t\016\374\265c\201\304\277E;\254"
+	.string	"\377 H\007\006Uq\037\330\343\250\253F\017\374\3510-\241\374\025\216\276tp^\232\215o\301FY\307\205\356\307\201\003#\347\005\325\262\360\243\021\2627\2212\311}"
+	.string	"q"
+	.string	"\200"
+	.ascii	"J"
+	.string	"(5\252U\324\210\364\301bw\277\367\375\347\363\247\025uP\365\305\345\256\317.\353\362\273?\273\254M\240\340gk\002\206\200\242\300T+\267\032S(\005\276Z\305k\037\305)\303\346\332\036\350\243\250\244V=QA\322\355.\336x\302PJ\345\021\022;Vn\210C!V\216\210;\f@\225\324\244\225\263\205\007xD\216\356t.\312\0211\2135\224\322e\\N\367]}ww\273;\263\333\016\002\\EJ\346Z\332\330m\314b\226PJih\274\206\216\206\235\235y\311\355bBp\031\262\221R\312`\017|\324l\337t\2714\036>\356r\3173/\337wzLR\225\302\363\371\b\342\272\013\264q\367v\337\265\326\272\255\264;y]&oky[B^V\310\313\322\274+\311;J^\261yg\310+\2337l\336n^n\336\2770\322\221\321\210\022\257\001T\202Sf\262\272\231l\275\314diV\377\266\263\t\301\251"
+	.string	"c\351\013\t\356"
+	.string	"\030\005\235\310\356\355\252gg\230\021\034{\305\0370\305\036\373D1l?\016\304\302\205\233\233y)\366\002&\331\263\177\273r\036\357\201\263oZ\f0>\0166/e_\007Ua\354\032\230\260\"\"\354\336\206\335\335HS\262\007Y\242c\366\251\245\034a?Hp\3468nt?\b\376+p<#\335\275\345~\347\314`\"\024\033s\201\240\345\310b\260\r9/\016;\260\331+\326\343\341\345\"\260\264\016:=\257\0174Z\317\213\005\fz+-\317S\235\345\251>\313\205\220\332\021\356k\363N\037\253j\225\332!\376\265\331\322E\273\333\322[\023\324\266\r)\245t\354\336O\264H\001El%\b\323\245\300\017E\215\212\202\344\205\336\300l\265K\317$\377m\204\027\2210R*D\263\037r\"\023(\330\330\314\313V\377w\366A\271\340\371~SO\002? \220\002\021\272\263\003\340\365:\005L"
+	.ascii	"\006\032\t\336\345/\3131\"3h\233w\216\003\243\001\031p\253\236"
+	.ascii	"\031ged\213\244\343\373'\306\360\304Z!\360\215\227\037X\243\363"
+	.ascii	"\222B\f\330%y\274\031\006\242\224\215\324\022\240\340D\005vA"
+	.ascii	"\177h\300D\271\261\037\371z.X\020\026:\337H\367D\027\002@\362"
+	.ascii	"\263\275\271H\030\307\223q,\224\322Z(\375\034\341\220u\024`\340"
+	.ascii	"\022\200\313\321_3-t\376\254\265\t\275.\004\034o\3238V%\320="
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.179.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\001\002\265\017"
+	.string	"f\232^C"
+	.string	"\221(\035;\374\220\211\254by\031a\234\300\377Fh\244\207\261(\364+\317\274\352p\217\350\277{E\333\313}O\035\351\350X7V$\263\363Ej\375\255\3574\246\034\367\313\304\202\307\2264\213\366\336R\246\024J"
+	.string	"B"
+	.string	"P"
+	.ascii	"\273\034^86\006\272\220\260\375\314$\233F\200\013[B\320m@\255"
+	.ascii	"\330\330]MC\234t\3704I~\007\310&\325\225\0165&\177Xgr\005\320"
+	.ascii	"\225<\002\273{\023O\r\335)\263\003dw\235\251\256\303\035o[\201"
+	.ascii	"m\003v\216\002\251\307\360\341\364\023G!\342\217\360\bI>u\350"
+	.ascii	"\223\304\303+\306j\225P\231\362e\247\224RW\366\337\352\211\255"
+	.ascii	"i\216\246\263\247\261\227\336<\255\321t\3244\314\364\313\264"
+	.ascii	">\235O\337\243\200\210\226\207gx\005%\325\025\246\032\365\250"
+	.ascii	"\310(\311\033\336(\246G\3450\265\374\305\203\316\266\305\303"
+	.ascii	"\215\n\230\241\322\350]\250\034Q]_\371D\250\221\305[| \200@\361"
+	.ascii	"\020\352\001\226k\346\351\212PT}*W\021\n\341\270x\250\232\240"
+	.ascii	"\005\243JM\361T\215_$^\003\336>F\234'\264u\"x4\t\240N\210\266"
+	.ascii	"\211F\264\217\001\346&|D\032\005\216\023iY\312\376\255\236\200"
+	.ascii	"x\2111\351\tz\244\275\200A>e\325\322>]\3018L\003\013\254\026"
+	.ascii	"\024\031\216\306p\361L9/\0162\035\261XfT\237\350R\201\305\202"
+	.ascii	"\"\223\273\0337 \300\002\0311\243\007\340\252'\"t\252\004|\374"
+	.ascii	"Q\342\334\313e\355G\232\022\b\r1f\023\205\242fe\210\345\224\231"
+	.ascii	"%\340\321')\306\371\262\361\330\210\203\006LV\376nHq\243gw\366"
+	.ascii	"\302\331\270\363ay\032\336b+o\223w\363,v\220\250\331\370\305"
+	.ascii	"\252k\227:\2201\334 Gm\361+S\263\2436\312R\226\230&\032\212\016"
+	.ascii	"\3615X(\023\r\330\236<\374\364\326\3222"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.180.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\255\006\225$"
+	.string	"\346<\334Ip\032R:\223\b\005"
+	.string	"\202\234\2703qSc\241\362\304/S\200\201\231\316\355,\345\222+\225\267h\303\302\177\264\3718+\253\302\230\320\273\003\202\032\334\225\266\016\342\320`\275H\306>0\374{I\221\323x\367\266\344\023B\366N2\304"
+	.string	"\275"
+	.string	"\313"
+	.string	"\335\375\333}\2623\3337ct.\347\254+i9;\031\264\020{\025x\236\365jz"
+	.ascii	"\353\325n\273\307\fX\312D\007\311/\246359\347 \356z{\035_N\217"
+	.ascii	"\207\263\323\345X\334\252\246\370\266}\034Q\356\230$^\307\267"
+	.ascii	"\314Iy\264(\303|\r\211\225\006]a\201\352\245\300+P\246\257!\257"
+	.ascii	"\322\237\026\326\333\303\220^\227\207#\302YC\342x\030\322\352"
+	.ascii	"\356\226UW\267L\201aH\252\233\003\312r\232:\033\206\224\272\270"
+	.ascii	"5\344T\n<c\272\353\313\016\224\345\264\274\032\365\264\227\\"
+	.ascii	"\332%\215\027\247<M=\216\275\244\2144\250\f\2244/\373\245\221"
+	.ascii	",\336\213#\3129\367=&\235\336;\357\276\204\356\216\320\275*\b"
+	.ascii	"Z`:\240\\-\204\210\242\242\365\252\017\377\371\333,\273S\226"
+	.ascii	"\232|\340\026\256=XJ\253\007\021\315\0266\343]\323\375&w\"\354"
+	.ascii	"\363h#\022\367G\022\353\325\036\374%G\260%\232\343\212)\245t"
+	.ascii	"\243\335\316\342\305[\335\307\321h4\332X\253{w\033\270\273\375"
+	.ascii	"\323\335\376\311\335\356y\363\337\321\335\366\345n\363\330\333"
+	.ascii	",{\033\307\336^\331\333*\356v\212\273\215\327\333"
+	.string	"w\275} \003kL\240~t\313\271)\332&CU5\260>\332\227$\335\331\r\236X\304\222\224\374\311\342\316\306\220\205\n\213$?sqgCx~Q\343\242\373Gn\366\342\316>\331\263M,\347\274\273\332\375\242{w5\335\005Ubp\276\366\213\237\325\202]|\321\224S\240;\274\325o\177\254\300+ZE\216\240\331\302\346\313O\260\3760\020\257]\230\244\2127\3327\353\026\310\275\264L6g\343P\237\313\273\264B\372<\256vK\244\035k\307\326\253?|\263_fY\220+fS\207\264\036\017\221\200)p\237\3372\327\356\266\214\002\276J)Pc\256B\223\254\354\267\241V\345|+S\304D6\312\177\300`\371\301\022\226R\230b^8\274\365\344<|\207 \261b\201\207\177v\005\3057a.Pe\220\202\026\357\265\246L\332\352s\2735l\270J(\001w\007ws\360\200\246|\202\0321\361\207\032\340v\177"
+	.ascii	"q\177\354\203\311r\003-bb\233\241\"Z\245!V\237UH\036\214P\224"
+	.ascii	"\350\260\"\205\321p\230$\344\265P\250\305\321\b\023\302\242\023"
+	.ascii	"#\202)J\024\241\b\n"
+	.string	"\207HA\241_\037\2510\032\006W\034\035\r\203;\247\322\323\214\265Z\307\025\005U\302\305\031A\\O9\347\254\323\0065b\242O\032\221\034>\026\343\030\334\342U\272D\226\306\243o\334\340\332\214\245mO\276rV\254\342\017\351\005g\323>Mx\320\335\326\370\232\266i\350m\305\023\226j\311\273\265O\007\274\272\215z\232\366\306\317\353j\233\212\017\365t{k\366\214\260\371\350\341\255N1\306oN\035\215\231\237i\253p\264XX\330\001\233\216\223i\225l\316y\250/\346c\332\255\256v\271\\\257b\f\343\3516\326T\272Q\002\\\316.^\273\303\212\317\027\232\262\n\224\247&\200\225\250\2010D\221SlD\202H\222\202\024\322\001\260\002\221)2n\020Hgl&I\032\003`\303\241Y\322\364\222\303\024\326\276\215K\037\204\260n\033\340!p\3727z\263\204\244\265K\360~J\205\340\256\034\327%s\023\026\b\200\033\222"
+	.string	"\351Q3\230\007\013\240{e\r\036\366\276\376\3121\202\270\255xA\204\340\203P\210"
+	.string	"\345e\225\274\261\036\2440\021\243PQ\305\004T\200\305\247*j\202{a\373\363\365\006\336\345\220uh9u\005y\374@=6\362gv\316\205m\306:S\237\032E\255\001.\375\342\307\216\206\262j\333\365\252\037\210}!4\326\007!\006\205\002p\233h:\303LW\355\265\366\017\362\307\376\233\337\321\"\024\366\007G\006s=\027\001\251\346\036\236"
+	.string	"\321LM\265\223T:\214\300\377\\\253\bV"
+	.ascii	"{PB#\225\220\204\034C\306\035 \342\244\304\342\277\350g\260\022"
+	.ascii	"\240\340:\206y\377\270[\304\001\241\326\246\304\317q\306Z\007"
+	.ascii	"\251\022\236\363\334\222\261S0\032]\330|\2236ER]]\r"
+	.text
+	.section	.gnu.lto_blackboxResumeLogging.181.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`c\002e\024"
+	.string	"\246e\205J\260\022R:pu;\272<\331\300pE\374\320\213)\311}\331\021\262Vo\320\376C\251\326\370\231\337\367\220\022j};\251\007\024\305\212T\237\031\375\013\371\305\315\207$\005\314y8\026k,\207T\374\201\007\305\377k\225l\262wJ\001l"
+	.string	"e"
+	.string	"x"
+	.ascii	"{\237\025?=\300\335\020(\257f\320z\365\256\365i\037\351I\266"
+	.ascii	"+u\260k\227\210\006\324\356.\201SZ\257&'\021_\303\013\020_m\263"
+	.ascii	"\257\bx\330\233\202\037\236\035&\037\273\033\243&n{H\247\315"
+	.ascii	"\177\357\256Rw{\bt\032\226\024\215\310\032\321\341B\023\252\252"
+	.ascii	"\235\373>A\350rs\206\250\354\256g\251\363\271\353m\257\330v`"
+	.ascii	"\317\247~\n\323j\363eM|=%\177NYA:3h\357p\223\032\331\017wwM\213"
+	.ascii	"\354:\375\n\231v\211\323\255+\375a\235~\200\003:x\200\036\264"
+	.ascii	"c\267"
+	.string	"'\bd\253\252\224\212\363~\373~\323\1777_2\313\323\324\215}\246\373l\230q\276\344\327\357\351hwa\2576\216\r{\235\357\031f\357\356\302v^\316\327'\247\2220\301\305\205\376w\024\235\214\243\251\253Y.\202W\253\334f\220p\300\374\322{\026N\222s\002\016!\225#\277 \372>\f\031\346KWz\373\017\022\301&J\215<\177\"\276\350K\317Fn\3760\200`0\310\343'\242\213\276\350?\f\341\240\036%\233\215\243\370\352\242\367\335\300O\217\023CIA!\2655\314\374b\264\020:\265a\336\213\021\311\261\273\013^b\035\306\235b\002#\315\206f$E\032\227\221\006C\241Ff$I\233\231\210g)\034j/13\331\206\227\230\f\214\214\026\233\2214\261\224\022\327fF2VS\253\2211\330N\347\341\322\"\277JDU\351P\234s\302]\242\006\347\375@\336\f\272\300\f\251\375`e\276\364{\177I\261"
+	.string	"f\001s\364f\237E\364q\334\212\005BK\213\370\n\263B\361\242\304\022\271L\274QA\204/K\250EkD\230\0212 \200\002\021;\252\003 \352\315C30\206:\t\350\2009%\n\033\311\336;\031~\255\t-\262XB\266\003\016\005\370\310-\356\234\35496v\231\225\231\220w\002T7\240"
+	.ascii	"n:R\263\314\315\262\326V\227\265V\312rJ)\234G\306b\326\271\262"
+	.ascii	"Z[\272>\226R\247\344\303\206\301\230\030\016F\224\306\272p\251"
+	.ascii	"\242\b\017\367^\270LE\272<\321\344\024M\354\001"
+	.text
+	.section	.gnu.lto_blackboxUpdate.182.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\264&\305\200"
+	.string	"\n\272\b*N0R\332\031\003W-\025\\\206Y\021BxV\364\257\326U"
+	.ascii	"\371\233\nV\257\353\362\204\275\340j\270\255\230\007\004N\235"
+	.ascii	"H}\325\305+\343.\016\204\021\004A\020\025\021A\020UU\315n\317"
+	.ascii	".\233r\351f"
+	.string	"E\360\343ED\215%\366\312-SJ)\230\002P\002\230\002\274\032\235\2072\316*\353\3742\316^t\356\246\312\200\016yg\326\304\365\\\306\336 \3231otX\245\213\350\315\334|\034@\325\232{\335\006}k\352\275]\311s\213*\235x-\024\257i\007\305\253\353\250\216\036\343\365\017\312\327\324\301L\367\206\247t\312]\020\006*n\350\004\207\247t\302\235\271a@\005\312J\226\346\373\276lN\246p\241\"c\n\230\264Vk\001\307\t\257\252\005)\ru\241\307\270\211\244\235\t\272\300\214\246nq*\247\336\367\205\322f0\364\030\177\033\027\030\230\373I\223\311\320c<l\343\303S:\337\3675\366\220Y\006fc\017o\332\231\333\331O\267\235\320\3002\357\273t\262\366\276c.\370E\261\207>\215\263\366P\355\021k\017\331e\366\3531\254\327D\323\226\222\231\340\373\276D\177\325n3\032\237\261\031C\3412&\343'<\326"
+	.string	"\003\013(0CF\002\b\034\020\303\200\002`\0200\200"
+	.string	"D/\\\004"
+	.string	"\300\220P\013\026+\202T"
+	.string	"\245\370\361A\321\303\263sB\307D\t\022987#D\204\260\001QC3cde\212\304u\250\276\273\334\256F\207\274\2032\035\233\321\316lp6\203BV\203s\331\017g2~\242\302H\022\234\232\021\243\204\227\263D\372p\036K\252>*\221%\262\2077"
+	.string	"\244\227K\323\025\347\210\233\326\315\022\031\344\031P\235\226VAz\201\235%2\b\241+P8\306g\240\311\030L@*\306\021\030\024\364\003\212[\242\244\276\3040\200\230\025\345\317\257\013\350\343s\030}=8\001{=\200\252\243\234s\n\322b\305\327_K]\\"
+	.ascii	"\275.N\264W\347/\304\326\\\004@,\002`N\316\207\250\264j\225\265"
+	.ascii	"F\327Bq\336\002\313\025g\201\205\212\257 \026M\220\365\214:\245"
+	.ascii	"Aj\255B\355k)\315\201\324\246x\212\037)\356c\005\205\230\367"
+	.ascii	"\270\361\330=}\007\356D\230\353\304\231\220+\001\326t\022]\236"
+	.ascii	"C\207\263\3457H|\204\235\210\301#\036\"\313m\362@\020\213\364"
+	.ascii	"\272\231j\224N\203\003\225\317|\375\330-M\271\221X\304\327@Y"
+	.ascii	"kN0\366\006\227\361)\2528Z\254\370\332n\t"
+	.string	"J\035R\3169\265X\377|-E9q\345\341\303\237\245\220\301V\325\241?\2660m\2674\250\342\004\341J\266X\373\017&$\177/Yx\200Fq\342\334\201K\013KJ)\211eB\256\352\373\276\275\\\032\264qb\321\373\276\354I&!\315\0254\363jdf\017\230\177*\bR\032\253\036\310\330\253.~/a8\363\320\256\324\332c\276\203[\244\370\276<\232\016\346R\2518\270E\326\"\253k\3452\275\223\305\277\251beI\372\227\364G\326A\203K\222!\376\360g\226eY\360\332\315Z\327'\376\316\026\036J\244O\257|\211\233\325s\314\256\226+q\267\032N\357}\337\030=dO\342_n\227\233\304U\342*Y{\270~\317u\trf\267\211\013\346\235\034\376\372T\205\374c\377\261\205)~\273\317U\375\2430\337r\237\305\367E\212\301\256\345H\\1n$=d\007 \200\340c\200B\001s\262\303\247\022\200"
+	.ascii	"\275\372\"\330CWuQ\342\216\267\264\231a\260\340*.\212\264\332"
+	.ascii	"X\377\217t\2349\003\r\274\223\377\275w\005\326\201\355U\302\274"
+	.ascii	"\244\303g2o\340F\304\3448\263\007 x'\271\367\214H\243\310?\262"
+	.ascii	"hpI*\317z\364>\224\355!\271\030\356\346Y\375\217\236]\t\n\351"
+	.ascii	"U^$\004\021F\030a\355\241?\013R\350\244\355C\213hR%\370wt\302"
+	.ascii	"\177\246S\261+AH\321s6o`\227\252\031\363\304\016EC\347\304>d"
+	.ascii	"F\215\211]\210Q\314\313m`\017\302>e\371\017\366\032d\300\306"
+	.ascii	"\234\315\036\354>\212]\177\236\304\316\203H\347;\330\221+\222"
+	.ascii	"\350\224\375\035\016qz\215\341&T\263\376\234M)\267\230\357\252"
+	.ascii	"c\223\027\2570\334?8\325\025g\363\255\002\344\006\303~\305n\022"
+	.ascii	"\222d\244\326\234B\375\205\231\375\324<0\307Vz\362\025R\337,"
+	.ascii	"/dn\277\366B\002"
+	.string	"7\022.\201\206w\222\306\332\303\376\016\324\360\224O\250\035>e\036C\3723\231\373\247\323\351 \177\016\314\254\263\016\031\347#\032\347\025f\234s\030\235\215h\234q\030\235o\030\235U0:\3330:\247`t\256at\016\241\235t\317(:\017\025\235\205\212\316-Xg\0262\316+X\347 \326Y\005\353\fdtNat\3761:\373\260\316(f\234{Xg\036\326y\307\350|\202u\326a\235M\260\316%Xg\022\254s\016\353\214\303:\337\024\235G\260\316\"X\347\020\254\263\r\353\f\202u\256a\235iX\347\031\326\331\310:\263\254\263\f\353\\4:\023\215\036?\"\330D|\357u5-\375\360\3473%\264\3624(d\n\235 \212\020VB\310E\221\\n@\002\227z~p\033>\320\r\360}\b\024\374?\267f\317\236<6\255\233\315\367\036WX\024\311\245$\t\370\356\360\355\301\351\3118\315!Q:\301\234"
+	.ascii	"\361"
+	.string	"9t\217}^+\267\245\317\364\356Z9-o\327\302\305\265rrU@|\017\323\3169U\252\213\352\374\034\023\226\216\353\240$mK\224\317\251\037WHX\201\206\267X\013\265\301E\225N\023o=\332\344\252\310\261\255\311\361\240&W\242\246\245s\233\274\346\207NpH\224O(\0224\237\354!Z{w\006\245\275#\373\262\266NK{wg\205\346{\230;L=\221\344\326r\236Iat`t\315&t:,\241\303\271\001\264\305d\242\302\337\210&\361R\341;z3\363\\[.\036I\313e\235\322\372,.\355\226\307\372\253\226KCA\371\214\020\255\332\276eU\333\247|\034\332.=\264}}h3\337\303T\242%\345\307\270\021\037\345;\376i\310\017\321z\247o\262c\367\351\231~\311\256\370\276\257\b\033N\346\227s\351\024\336\006\036\267\201\017\344kH\341\033\317\346}\337\020\306O6\267{\\\375{\264\200\257\324"
+	.string	"\326'\265\200\217|\244\326K\373\245\005\\[\300\265\207"
+	.string	"4G1~\017\263k\314`!\334\230M\241'\215\311\023\223'\025\314\013\023\230\327ja\224\227&1PK\016 "
+	.ascii	"\247_\364\274\350\371\365\265^\017{z\316\026\250\245\346I\327"
+	.ascii	"\370:\246\326\021\360\256\213\315\333-\326\020\276\306\257[\224"
+	.ascii	"\240\220{\334\006z^+\335\022\302\367^\373Sl\211\3629\264\352"
+	.ascii	"\201\214\206\215\300\373\355V\2722\267\203-\241w\222}\207\036"
+	.ascii	"\211\213\"\315\310\024y\217\271\226\250\373\3544\027^\347&\255"
+	.ascii	"SY\346\334\243\002\3206Av\221.\347>Y\350\005\340X\334\244\206"
+	.ascii	"\202\2725\337\027\t\201\036\306\255\0034\273\275\271?@`\265\271"
+	.ascii	"[C\301z_\0366\315}c^\305\375\261\346l\256\222\017\367\307\217"
+	.ascii	"5)\315n+\263\013\304\r\342\235\224\371\036\346\021\347{\303\037"
+	.ascii	"\217\210\rv\2135[\305J\324\370Lv)\016\265\3412\271Mn\323\332"
+	.ascii	"C\343]\026Z\322\2071\315\355\347h\037\334p&\235z\321C\334\214"
+	.ascii	"\335r\260\370\240\270[8Xe\275\024\345E\260\371\330}\36217\013"
+	.ascii	"\007K\254\215\362"
+	.string	"\322\004\263\303\247O\277\"\326\273\364V5_\263gaK\001\214\302\213\023n\324`\201\b\207\321\215\033F4L\350\360\340\204\0335:`\001\307\tGG-\320\240a\032/^02\301\006\215\022T0\201\bG\215\022n\020\3218\322A\364\002\005\033\3458\341\210\210\005#\243#\"\343\330\216\376\0348\311$0\272\343\221\254Ji.z)\2002a\013\261\254\223\233`\350{97\3643\250Q\221\252j\255$*\375\223"
+	.string	"\213\223\026^\023L\223\265L-\205k*\303|*#\320\361&\224\355\301\351\370&k !t\202\312\347\216\323\263\t\201\320\236\233P\332\003M\276\307D\212\255\253\317\201g\266\370\376*\353R\245\305\267\223\332\031\330\220\333\221\267\"\026\337\313!,\336\241L\236\324)\355L\204D\331\355\210\233V\003<\260J\205g\355\241\322KMc\267\222\362\341\245B3x\273\002\243\n\311\013\231\271}R\243\270O\025m\305\3138\361U1\360L\263^\222V\310\323\351t\272@\320\367\262,(\310\211\013\337\0231\263\236N\247\205\n\250x\023\242T\324`\205\252J\372\367\327\\ttB\302\031jX\003\252`hR \320\311"
+	.ascii	"\372\232\035\250\200\236\250$\201\024\357\363\357\327Q~>\305"
+	.ascii	"\357\230\251o\252\233\236\372\365\363\375\346\363=\255B\"\200"
+	.ascii	"\"\207\367\024i\255\274\223(\336\207\347{\276\271\230</#\355"
+	.ascii	"M:\325C_\007\204}\351\020\343\n\204/\257\022a\272\302\030\360"
+	.ascii	"EE\364\261\226,\300G\257\020\305\210U\221\254\025\276\2418M\254"
+	.ascii	"A\030;W;\377mxK\224O\002\230m\232Y\263\370\005\0253@\326\232"
+	.ascii	"Cidy\004\274\2533\372\034_\"P\251\360\304\317x\243o\265\006\342"
+	.ascii	"\352\n\202v\346\205T\213"
+	.string	"\250K\032\264\332\255\255\265\207'\276\333\272\b\240\363](\244\363\035Ed\202\312\304\313H\203\002\326E\030EF\365P\227\364\005\240\213$\355\023\357\312\022\200\222\270\232\367}\001(\361\315\245C\211&\"\204\320K\372\207\374\343\316\373\276C*\021'\325I\025B\245\3313\266*\251J\342i\234,5!\361M\227\345-r\376\277\324\244\316\371\376R\205\364\307f\201\363G*\020\033`n\023\316\313\230\002\006\f\212H\017u\205E\217N\270\"'\254\253IP\t>\343\231[\261\366IW\222(\322\037U<\223\271\333\262\025\307\034\023P\013\340]\027UI\355\321\226\231\265h\216\266\366\020\3077[\263\270\233V)\237P@7\"\370\210n\247\250\265T\274\22378D\275\251\207\272\244R\214x\037\244?\252;F\274\214)[\300\002\203,\250\002q-\315J\247fD\202H\222\202$\303\030\022\f\020\206\002I\b\275\353\001\022"
+	.string	"\3630I\204,\203J\215\314\310(HR\243\322\034b\021hpN\303\273D\325\234!\277\007\220\007Y\n\313/Wo,\t\276X\t\343\337YE\033B\241.C5\307\271\007t\236\206\177\232\001\267q\223\314\017\244\237\367n\343\323_\272\316IN\255\2505B\002\270\324\016\303:\225\357\312\364kD6aT\332\224\340\035\324X\004\2715\246'm\213I\377\322LZzh\"\207\230|\332\226_\3246\230\254^\206\340o\250\026\f\375\201\026K\352\353\335{\210\272/\242V\216\3513e\367\301\237O\364\032\300\200n\304\205\314\342\035\236+\236\\\001\335N\005\334\201\257\330\317A\317\3217\271f\r`\224\322x\002r\264@3;\223\277\fH\220\322\226{|*ql^\033\324\201\215\211\037c\322\313D\023HP\001=~3q"
+	.string	"B\312t\241\360\033m\2405\340\035\340n\345\362+}i\027\340\271\332\265\364\243\227\233\3608@\f\327(G\235U\344\3540\342\316\351\240\\p\202\r\352b\242\317"
+	.string	"P\212H\301\275!\313p\214q+8%\036F\\\214\3063\032\227\223S\377JX\243\t2\206/\212\366\222Ve\325\237\250\373\021\027\334\213\352\263\254\033V{(\257/:O"
+	.ascii	"\254XM\270p&p\255\355Y\361\200\312\r\376\263<\250\224\373H\001"
+	.string	"\3656CC{\264k6\n7\r\242\322\351w\350\230\322\274\227\352|\217\210\351\200u\343!0\025\361]v\302\362\256\b\350\017q[\267\023U\263'G\3241\225Tu\341g\363\252\2037\326\031\301\202\202J\331\2378$\315t\200>dtEQ\"LT-\027#\031\245\210\335\215\343\367\243\033\372s\232\177\021_@\353\030\320\274w\320p\336i\340Y%\206\247I8\034\367]\260\315\263\307\373\372S\361\361Y\337\325=\017|A\262P\007\024\257\177\023\3070\265\220\311\327\007-\362v\350\254\213\023\263\345\004|&\322\226\007\325\005\361X(\327\346d\347\274\311\006%\177\023\203\354\351q\202OJ\3234o<\202N\222\363+\255]'S.\355\377\244\361c\316\360\351\307\306S\023\2467\240R\314#\004\241\351Y\221\260c\262E\345z\343\f\341\252\271\366\346\031\336k\257\231;\363\336\222\213|P\202\207\312-\304\376\3006\272"
+	.string	"\241 #\204\270i\"'$\032\023\225fV\306\277\271u\244\257\247\337|\302w\325;\344g~K\036\325d\334g\352\377*\321\247\245\203\t;\263\232$\022%K\263\312\265\237\345\032\254zd\2415s\0220<"
+	.string	"\277&]W)W\273[\234&\337\357\005P]\240\r"
+	.string	"\244p\241ttu\372\343\024\007\276\225J\254\213\302h\001\346g%b#\250\023\356\247\306\037\303\224>\221$\\\3637\350\030\266\341\337\013K%\214\305$\367\364a\313\266\001o\001oE,\271\331\366\024\235\245\004B~\215\025\332Y\315\300\002\215U\336]\303\b\351\331\350\227\315\367\272\306\333-\260\223|\005F\033!z1aL\274\362s\"g\301c\204\333a6\233\f\261\213\007\272M\002b\016\214g\264\301w|\313\350\377\023\2043\007\316\333\244I\341Y\222Vu\220L_>\370\033o\013 \365O\373\346\371<N\034\007]0a\2542\273P\201.\361\006\270^%\204\230\026\262:y\206\334\301\355G\230W\202V\307\n;E-\277\005c)\200\272\030\273/\373\201Vl-SXk\350\006%\243"
+	.string	"\211K\b\020"
+	.string	"\221j^\224H\031\234\200JE\373e\220\001\3670\222\315\fo\237\243\\y.\002\"\352\324m=v\247\255\017Rq\325\334\032\274F\302\351H\375"
+	.string	"\243@$\235\0377g\251d\260\350\031mA\305\255\002\\\335\225\320\006%\353\316\024g#\362\b\323\206\007\n\330\2224\233h\002\nv\201b\354\375\214tv\r#\302\323,L\367i\277\226\262\022\375da\273\223\274\342\b\2308I<\372m\027\rmf{Z\366K\263\355v\250\335\360\3228\354\320\002\037\362\375\323\220t\256\347MY$\260%\323$P\223\370\305\303\327\022\340\244\270v\017.\213F\360&\240\334r\242\204,k\357e$_\307\202\274]\276\335\222\352\373\027\340}\001\005!\031\263\314\244\377r\006\251\314\260d3\235RS/\245s|\256\301\247\342\"\213xa\016\002x9\336-\364\254\236\020\302c\251\326@\032\373Gp%\347\207\024\230\226\253\2140T\013\021\r\004\234\212"
+	.ascii	"\231f\300\266\001<\277\020\234\177f7`\202\006\316\002\266\330"
+	.ascii	"\302\024\363\036\007\004\n{\033\007\357\217\027\02143\221'\345"
+	.ascii	"\036\264\004\265\222(]\030\203\346H\251l\n\347\b!CwB\316_B\364"
+	.ascii	"\210\313\3422\315{\374\335\036\253\277\334\364\177\206Mc\003"
+	.ascii	"\256"
+	.ascii	"'rmG\024\217\025\030\267\230\3228\323\266K\\\361\223\005H\005"
+	.ascii	"\231<\205\230\321.\007\334\024y\336\232I\235l\307s\023\207\222"
+	.ascii	"\0322\262'\311j\t\345V,\035\377\301\006|\274\243\327\274\177"
+	.ascii	"\367\375\215\320\311\336L.\243p\364\325L\t/p\207Wa\371\262\243"
+	.ascii	"\036\2403\235\007&`\255q\354.\030s8'\017\034\335YPt\334P\323"
+	.ascii	"\234nP\n\3258R\323\222T\204(\265\240QR\237\005\3751\312\344\020"
+	.text
+	.section	.gnu.lto_blackboxCalculatePDenom.183.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\325\t"
+	.string	"\246\322B;@\245*\035\365\345~6\376L\335\367F\377\251A\216p\021w0E`\377\256\347R\256\306\030Y.\026\330\346\031\001\244\260\016\253IXjFm\304$\372\2225\260m\033!\233H\231R2"
+	.string	"0"
+	.string	"."
+	.string	"\206i!\307\352\202\321J\275\n\354n\227\371e{\324N\260=\352\306\301'\350\177\344\013\0231\002\252U\351\311!\354\256S\265\252\270\365\2665\266\017\354_\002\361i}:3}\212F6\300\3421\331.\305\314\300\n\210"
+	.string	">l\203\266\305\016\003\030<\3572\314\225\335\f\223\223\335-\360\206\362h\333\027y\013tQSU\217\0029\345\314\327\324\247\016\234\344%#\337\303\021\244\274\212\264=^1\035\027\246\234\331a)U\303\276\266\312\262\237\346\036\376\333]\177 /\364I\250\200F\n\037\021\347\343\354\331Hx\235\006\017\307\241\323\205\0308\240\316\363At\033\214\275\207\317\327\211<\357\353,\341^[eq\2321\351\311\233\252r\032_\250\220\021"
+	.ascii	"+!\201\245\236L\350\f\n\\\374b\201\031\314\320S\004\306.\327"
+	.ascii	"p\020Z\300&\204\003\346@f`DP\001\007\240\362\230\332I\006"
+	.text
+	.section	.gnu.lto_blackboxGetRateDenom.184.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375 \373\325\006"
+	.string	"r\314.5@o\222\016\233B8\374l>&\264\246\233\222.\274"
+	.string	"l?o\251\035\233\330o\233\216\035QP\241\374\372\r\f\303\34394\017l9\334\236\363\036Tnv\023\231\002W\234\013\313\343Pu\036</\242\241\003\361\252k\342q\b\266$\030\256GaY\327\323lY$!\026\204\020\343\"bE1-\251I\305-m\361q\325J\335\017@\251\242\200G\310\235~\313\034\206|3\211\244\337\215\316\335\314\306\245\324Q\223J\346\306\t&Y\250\224\221\037\364\232\021\022@c\003\031Y\213\301\007\212\350\344%s{(R\254\016\273%\351\202\206iE\033eu\001\n\231\271\323F\034\035\373o\376\203\037$\n"
+	.ascii	"`\251'\0230\2013\3348T\204\272\3175<e\304[B\220p\347L\355|\002"
+	.text
+	.section	.gnu.lto_blackboxGetPRatio.185.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"\245\b"
+	.string	"\006\32096Po\322\001\203\276j\336 \354\360\2410\310!\264H4\263V\335\275\307\0064B\322li\026?\273qDA\377,\221rcj$\374\265E\367\206a\t\331[\312\224\002)"
+	.string	"+"
+	.string	"'"
+	.string	".sr1\340\003\324\241^\200:\\\215cW\314?\310\027LVJ\266Rv\255\024\346\234\326\255tq\357m\033\330N\260\375\022\352j\325p\325\357\251w\325\252\352g\240I\345-)sZt0\223\005\242p\330\026\331\032\337\343\037\"c\007\024Z\206`:!\221\004\336}\"\037\361|\244\374\352\236\024\363\220s\021\376\206A!\375v\350\207\250\303/"
+	.string	"\206\246\235\315e\272\031\366\337\334\223\355\2666\023\262\343\2618\016\235\370\320\300\371D\353\002\305\r\201%\004\303\025%\244\274\242\206\233\177sO\325\026h;2\334\352\255.\334Wt\214\264\013\020"
+	.string	"`\251'\023\372\377\201\221\026\220\"\220\005\226"
+	.ascii	"\213M\223S\306\332\246\322D\250\366\\\310A`\006\263`d\270VL\302"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_blackboxCalculateSampleRate.186.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\205\002u\024"
+	.string	"v(\210H\320\360(\035\245\333\001\037\327n\344\364>\372\t3\246\230\271\376S\025\210Vl`\036c\274\020I\223xh:~\021%\325TYPy\231\342\001h\361"
+	.string	"m\365\360\003\314<\370Q\306I\365\345E\373\253\375F\310\336$I\231\002v"
+	.string	"e"
+	.string	"t"
+	.string	"KsN\330\335\230-\242\n\017\266g\354\224\355\257\255!T\304\214\376@p\2343\203Q\2129q&>\0015\262\324%5\256\266\244F\3336\200`\3063\230\r\215\306"
+	.string	"\035\"\033\220\2159q\261o\320\231\312\350}g\326\017\005t!\241\b\306\r\207\246\262\202F\233p\275\034\375\n\247\346\225\3149u\204\356\rN\315\356\2072\347\364\336p(\250?\265-\263}\300\336\025\001Z\302\305\332\3012\230\325\233F+\314O\026D\256\217H6\035\315\356l\034m\337c\2537\347\234>\217\355\365\210\376\250\212|\r\363:D\256_r\355\222k\020\271n\311\365G\\{\3045+\256;\344z\025\327\034q\255\212\353T\\\243\342\372\024\327`\\\177q-\343:zk\317[\337[\257\267\326"
+	.ascii	"Q\247H_\004K\266\234\025\352\251\307\240\\\270\243\316\311\323"
+	.ascii	"Q\217A@\241\016v\360\247_FS\250\253\355\016&\337\363\212\347"
+	.ascii	"\361\336:\223\022\204\317\202:\223!\2779\241\340\265F\f\225\367"
+	.ascii	"\036\224q4\3359'\355;5\013\t^Q\3140aT\263L\376\016\276eH\376"
+	.ascii	"\273IS\274<\311\322M\311{<I\316\246\373\225i\252\213\364\016"
+	.ascii	"\240(\364\251\355\316{\375\257\341\207\232\222\b2\026\231\024"
+	.ascii	"\005/\322+'\017d*-+)\fTb\rXR\\b+1\016b'\002,{Y\020\023\223\221"
+	.ascii	"\311bb)\334\324H@?\"\016\036\b\033y\t\315kV }}\344\352\372\353"
+	.ascii	"\260#\220\273\236`\350\246\024\362\326A\376\013E\037_\275u\r"
+	.ascii	"w<\376\301z\004\217G!$!\3558\353_R.\334)\240\247w\374K\002\n"
+	.ascii	"u\034_=\n\345l:\325g\0328~\fG\241\217\246\256z\f\n. p\2422Ww"
+	.ascii	"`\352\2411 \023\207q\0201\353\020:t\253\322\200o\";\310\317\221"
+	.ascii	"\b.x\235\355\0238\247h\263\302\344\032-\217fc\267jw\266+\261"
+	.ascii	"\035R\372\003j\325\352\034\270\330\373L\262],TU2\200d\2665\312"
+	.ascii	"\206\377\301\t\b\327%\202\266\341^\2416\354\240\252\247\020\027"
+	.ascii	"\017T\231\345\213\031e5\266K\225\001"
+	.text
+	.section	.gnu.lto_blackboxInit.187.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\013\004E\031"
+	.string	"6\353\227H\260\030U:\b"
+	.string	"\037\232\217\306\353\255l\336\200bE\2644\257\232LC\302\346:\357f\202\016\220\214\213\032h\277\215\331\343\216\n\375\234nP\215\217\213\245f{\350\345Ok{\366\323\206\306\303\373\203\316\341f\311&D\356\224\002\177"
+	.string	"\200"
+	.string	"\203"
+	.ascii	"\265\232\030f\251B\343\220\031\266\357\357xN\304m.\355\254\364"
+	.ascii	"\210\260q\017x\364\376\363\333\210\333\214\200g\372h\217\260"
+	.ascii	"M\037\327\344\322.:N\247\002h\341\213\365\270Rk=\255\214\227"
+	.ascii	"'\351(\356,}2\206\307\313\r\001\315pN\336N\222\315V\234\2221"
+	.ascii	"\270\317\234\235k\bh\266\342#\214\304\024S|[f/q@\255\365\265"
+	.ascii	"\317\0223\327\234dL\255\325S6Cq\217n\373e\373\200->\b{X\016\327"
+	.ascii	"\034\232\210\312\302\352\373\332_\210\244\020\275\370a\361r_"
+	.ascii	"\310\207\\\300@C\223\2633\354\tR\343\"\354\035\310w)\326\216"
+	.ascii	"\260\307\206\372?\016d\223\341\346\206~t\t\366\256\242~\217\353"
+	.ascii	"T>\2177\254\346e+\372\361\271\023\370\005y\362\302V\2455\207"
+	.ascii	"6\3165\227f_\254\033\303\246\323&:]\032\247I\342\364\210\234"
+	.ascii	"&\3514\245\323\3438-\212\323\273\323s\247\037\240\200\f\236\024"
+	.ascii	"_\022\024Spfp|\003JZT\316g+x\023\"\322\262x<|n\342\322,C\231"
+	.ascii	"\200\330\t\257\314Z+\316.m\264\273\250\\\222\327\304brG\333\002"
+	.ascii	"%\310ILH\256\277\344A2\013ffd?\272\344\316\340\270\006Nw\225"
+	.ascii	"\300\262\210;\356cB\233\301\2234\030\325\372J\340\0379\022\007"
+	.ascii	">\317GC\210\020\201~\024\367\266]"
+	.string	"\020x\333\365\215\274'aB\205\n\364\343\f\312~sww\027\023\356\261\324\253\350\fN\301\204X\241T\251\032\r\250\023\207\233\232\r\247\024\313\303\tF\200W\035lX\247\017\253\025\353d\302\265.\326\215\341R\216\232Pk]6-\360B\r\232yY\275\213\320\322\232\3660\032\256\322x\203\247\3139\361!$\2276\345VL\345\366\353\370T\b\321\245\271\264A\375\242K)m\340(}|\350G\323\320\216\017\331\357e\215\372\276G)k\345O\251\243\324A?R\310\321\001]\264\346\360I\321H\247\236\2500\252\313\307\343^\322\t\201\001\f^\250a4\310\230!\b\022\022R\222$\205\306\240\002\221)\253y\021\320\255\222H\332j3\240\375B[\032i\203\013\257\301\343_C1l\243\310\366!\366\250\242:\331h\363\311Ox\337?\004\325e\3714\363\353\305P\212Mb\202V\320\"\n\222\367\370\"\224\275\225\034\326\341"
+	.string	"s\333\024.\272\326\363%B\252\022k3\020\230~R&\243\fR\355\371)p\314\236_5\3716\314\304\360\3274UB\302Ds\003\036\006\264\203^\234(\305\224\272\260$!\022\026\276\\\377Y\330\247"
+	.ascii	"a\b\372I\321\314\033l\247\247hn\343,<m%a\211!\263\t\355u\210"
+	.ascii	"\3542\177\003a\274\3777U\202\341S\232\233~\212\270\2671F\r"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.290.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\265\013"
+	.string	"\346\024K@ \213*\035H1\"$\004\220$\206ji\020/\302\257\tcXwi2\030W%~\271\234F\276\275|\f\001\307f\307@{g\230"
+	.string	"\243\006\260\020\211\005:\216\322+\036\013\341\3574\"{K\231R7"
+	.string	"6"
+	.string	":"
+	.string	"[\312\360NR\260\f\273\273=\352\201\223\0165#\311\247` :\257t\230\235'\340\032\341\241`\305\356\276\3654\361N\231\022\217\024\314\356\372a\300\255\335\266\206m\f\373\235*S\316RY\326x\270\272\2625\035a\032jZ3\235\231~%\277\013\n\273"
+	.string	"f\034\266@\214\260\300~kd[,\217o`{d\307\356B\260\001L\262c\023$\001\250\334`\250Q\237\222\231`\177\300\361p\234\366\b\325\"\201J5a)Y\352\353\035\272\013\377G\273\246\276\204\300)g\366\035\334\365\361\0258$\312w\217\276H{\274n|\0204\004\336\\B8\rg\223\351h6\217\216\214g\333\200B\333\205\302\334\007\007h\003\3418\320f\261\235\207\253+W\fL\260`\322\023T\226?\332'\362I`\200A\237\273[Re9\252\352\310\253B\036"
+	.ascii	"g\325\253\333\030D\004\2634\"\005+\020\002\006\007?$X\2073\006"
+	.ascii	"\232\300\302Yp\347\005\213OC`\261\2458\003U\026\002\242`\230"
+	.ascii	"+\334\035&\b\316\210E\235\013Lw\032\030\256\275\242pijJp\353"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureSample.part.0.373.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\257\004\225\035"
+	.string	"\0265\270H\240\330M:\003\016\233\007z\342K/L\370\345\360C\341a\366L\tK\301h\f)\312X\207\343\216e\342\260\337\326\265\0027\177\322\322\257\267\361%\267\321>\267[Co\244\247&\306\372\026\365\224u\375m\2334\262\211\334)\005\234"
+	.string	"\232"
+	.string	"\242"
+	.ascii	"%y\363\234/}\037\272\020\313\032d\362\234\366\207\234\310\357"
+	.ascii	"C\027\256\325\n\345\305\244\326\262\301\251m\310S\232\017\030"
+	.string	"O\305\013\030O\355\007\261\355c\362\317\006{\251\243\"\030n%Y\215\325Zw\247\233\303{\261\274\307\371;I\033\251\270\263\366\363mA\242\223\nh\"\200Zk.\230$:\2001\307\t\3441\343\364[\247Qfb\300\340\214\213c\224Y)\204\f\252\311\351+\336d\005\265r\301#\021\347\003\254\307\263>e\004\215\346\f\360\032\215B\255\325/\242q\333n{\207m\016\2668\025^\034\266\2566\235#\247q\264\351\231\332\364\215\234\266\321\246k\327\272\311\227?\215N\217\307\272\3518-\216\323;NO:}\002b\023%\335S\255Kge\325\006\345\242:\326\177\344\327\372\332\367\225<\211\277\245\3453\315Q]\342\256\327\246\372\030cC00\265\326\rd\221\373E|>\222g\371\206\345\233\007\276_\2550\rQY\227n\036\374~\265\342\025\251\016M\r\277,\220\247G|\267\032\232\005\312\332\304\344W\335\310\357VC"
+	.string	"*\225\372&\034C.`j-\031\234Z\002y\352\227\342\241&K\224\177}"
+	.ascii	"\021b\036\030b<\255\355\267.\226\t\305\310\270\266\326JDik\213"
+	.ascii	"\270\327\b\b\3020\b\266[\034\n\211\207\t\307Dp\362'%\374\251"
+	.ascii	"S\363t\206\306S\034a\030Y\215\375k\255U4\260D\246\306U](\357"
+	.ascii	"\025\224\241R\332\225\362\270ts\252\264\034M2]\275qq\204_\200"
+	.ascii	"8\211Kw~\351\356\256qW\\\332\222$\247\232\317\335=\322\223\321"
+	.ascii	"<\363w\356\223\314\374&\347:\341Oy\207g\036x\352\363\214\247"
+	.ascii	"\337g\235>\021\202\2219\025\315\263\271R\336\332o\224\241R\n"
+	.ascii	";7\301\353e\020b\321\363!{(R\364\360\202\306 \020\275\236\035"
+	.ascii	"\034!\237\036\020\220\n\035\234ulX\374\344\360\350\360P\344\354"
+	.ascii	"|vx=;\035\240\240\235M\002\377\244\350\001\355\204~~\200v\267"
+	.ascii	"S(Z#\222n\230g}\001\224\221\251\247!N\264\2252\315\213\352v\267"
+	.ascii	"\210\fN\256\214\006'\367D\252\266\354\305Zsru\253\2132\023Cz"
+	.ascii	"\312}\371\r\017\206a\202\260\354\207\227.\270\315\315\340\264"
+	.ascii	"Tx\026,3\373BX\006\204\353\266W, \270p+\030&\b\305\306\252P9"
+	.ascii	"P\214mo\273W\222\314\016\314\332\332\0328\214\007\332\226\346"
+	.ascii	"h\211|>\305[\tt\330\035\002b\250\201D\243\0202\006\r\t\211h\222"
+	.ascii	"\202\026\016\200\002\231\"\3446\021\240A5$Q2l\006\340C\036\252"
+	.ascii	"\016\351\304-\366\313\227\301L\002X\023I\322\325\333g\307\267"
+	.ascii	"\377Jzq\344\006\246\203\336\tI\277\325\277\246\2370\337\3557"
+	.ascii	"\365L\377:\333\352\313W\214iCq\250si\\.\217\214*\354\271\273"
+	.ascii	"\346\252\234\350ke\037\352\240\220\3722\206Q\352\214\204\031"
+	.ascii	"avB\023\tr\251\307E(/\216\n\231\212\200\315&\216\276<4zB\240"
+	.ascii	"\272\016\235\276\375>\242\206\257\256%\344PF\205y\346\226\314"
+	.ascii	"sH\374\253o\212\035\002x\201<\345a\316\236\303\200\354|\266Y"
+	.ascii	"\253\335\302\006\222p\344xgg,\202\215\337\326\032d:-\020\r\223"
+	.ascii	"D\212\335/\r"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.380.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375` \006\355\""
+	.string	"\366:\320H\200ZN:?]@~\333\267\017\356\354\263}\220\251\356\241\201^"
+	.string	"\033\252\231\372\027F\267\377\031\225\375\210\253\351\330v\266\236\033\274\204\024Y\250\351\216#\357an\317\243\365Y\267\006\245\343\225QeN\b\261YB\310\226I\006\265"
+	.string	"\271"
+	.string	"\270"
+	.string	"\367\347'\003\345~\366\374"
+	.ascii	"\372\323|\001\364Ff\256_1\372\221s\212[VF\314V\352\217-e\252"
+	.ascii	"\\+\306\217\374\200\255K\f*\317\232\361#\267\230R\3504\203?\345"
+	.ascii	"\310\032?r\b1(!\326\275\267\006\3127\0361\353\350\374\274\024"
+	.ascii	"f>bN;R\352\372`\313\234\226\340w{\023\222;pTq\273\367\352~\326"
+	.ascii	"(6o\"\317f\333\243\247Y\033g\371\300\336Q\255/h\352\362\231q"
+	.ascii	"\001\231~\232\001\312\250\232v\200?SB\020K\331\303\336J@_\233"
+	.ascii	"\235N\005y}\330\037\024\223Yf\\\300 o\002\307\341.\334{97\344"
+	.ascii	"\234;3\247\314,\201\031\r\nu\310jj\322\320\236\006M\237\223\250"
+	.ascii	"\327\231YY\204\227!S\334\342\217\tR\240\374\240\023s2\020\"F"
+	.ascii	"\214@!\034L\020\002\251{/\005\376\227\217\221(a\302\004\372s"
+	.ascii	"\347G\\\246LH\275\344\001m\340<\206\376\374\307s!\332\221\272"
+	.ascii	"\027)y1!~\223\237<D\324O\211P\024)\372)\337\370\034.-_oj7j\257"
+	.ascii	"\353\220+\256*)\243\n~qU\302\234\323\234\003\320\214\3135\243"
+	.ascii	"\271\346\023\327lV\264\271\017v>\0033\211&@x\357\322\362\315"
+	.ascii	"\205:\303\236\034\354g>\277\353G~\030\353\200\035qO\022\362\002"
+	.ascii	"}d\271\227\375\027'\177\177\334\347pK2Q\2737;\024\207\021\032"
+	.ascii	"\305276\364\267;b\207\247\231\002\214\376I\352\005\352M\355\254"
+	.ascii	"\334\267{\273$v8D\177\236]\020\332\347\226\2102\261N\372\351"
+	.ascii	"YO/QZ\224\016\232\217\264S\226\252\221?1\312\250\364\325\036"
+	.ascii	"\233\225\337\346nl\025\277\t\333(\366\312^\205I\327\026"
+	.string	"4\2635\332)\375\324\2547\236\300\231\"\231\322w\326!\013\340\252\265V\264\376\371\253R}\234,\264\244n\303\365\346\275\367\232u\370Z+\317\257HvC\350\353%\363tWf\f\031z\222j\217\371m/\002\234\335{m\234m\203\205\265\257\341\320\301C?\365\200\376\354\372\260k\030\026\315\352k\020K\331T\r.\214vE(N\036\002\222\261;\241bHh\305\t]\213\024B,tCE/t@<\274sAT\244\203\261\333\025\351t\230\271\177\001\251\372\320%kt\310\020\267\322\265\363\332Pn$\235\204\327\306c\303{\343\275Mm\201\"4:\3458\324\216\347\306\016\373Z\367\001f\221\022b\261\345\252\020\216}\332\3513D\272H;\2518\362\226\266\027\301\207\376\314\325\017\235,\225\232p5h\203?\373T\315\244k\025\232\331\352\260J\375\024g$\035S\276\251\375\234[H3Y\036K\026\bl\".\255\200"
+	.string	"\211\323K\007\n)\"\306\261\252B\371m\272\207\255\032b\257|\340t\261A\224;m%\033,b\237\236\320\237\317z\2035\2573!\026[\200\226\250\201<'\231\242\021\021\221$)H:\240\002\2211\253m\020@\251\250$\351\244\026\004\244I\200\247\254\255\004#\335\234(\307y\322\021\333\b\256\234\323\024? \367\354\3075\346\211\350\216\304\037\013S3\310\347\227o5\b\357sa\337\330\021\305M*\247\242\373\270\201\005\340\215\273\342|1\007\023P\007\343\0022\344\314\20040^\302\205\214j+\032A\347"
+	.string	"&\271\003?\217f{:\350 cp04|\320^\257cCJ\244\231\025Qb\372\330\003\354T\334\036\244\021l#\274\255\336\327\007\326\246\247\324D\242#\241\301\355\201t\264\t\025\307&s\016iQ\313e\256\b\206\366VDQzMZ\343\204\203"
+	.ascii	"t\037\304\344\023>h\326&\243\342?\t\235j6@\316\306\352\270\260"
+	.ascii	"\211\0362\330Cbcgx\376\321\n\371\310\275BX\326\301A\307\224*"
+	.ascii	"\033\230\016\\\035Se\260@\003\321\270\321Q?\212\217\345\245\336"
+	.ascii	"i+gG\275\bt\216w\340\260NB]D\245\363)\232\364\272\241\002"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.382.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\"\001\345\f"
+	.string	"v\327UB O\225\016\240V\\D\002p\224\300:r\245W\214\2117\302\"\001W\216\345\346(\0250]gP\274\255m\030k\007o1\200A\361\374\370\002\001\031 }\300\\\217t\205\002\360A^Z\020\"\233\354\235R<"
+	.string	"B"
+	.string	"I"
+	.string	"\333I\177f\262\273\356\364$l\233l\221\327\215mY\264E(\252=%\240\305*\200\324v\327;\235\034.~\312M\364O\237"
+	.string	"\\\030.\007|\223\\v\327\023\330Mo\033\201m\007\366\305\033\016\270`Q\210\325v\253w*\355\373\037\347\360A\334y\230\336A\222\224\272\257\326g\276G\275\t\361\035$\001\333b\357zA\3530\356\326\312\251-\223S\327\027\340N''\300\235\272t\016WT\254\330\r\334\351a\036X\204\200\201\222#\226H;\214 \277\362g\377\205\220\030\243\21415Or\312<\267o;5\354m\243\215\b\020\333e\215\314X\r4\005\210\177\374\204G\333f\250\033/\211L\304X\242\266\023j\245\344\321\264\240B\005\356\210\300\257A(d\260\001)X\260\341\200\230NH\261\306\"\341\313x4\030\b\031\017\364"
+	.string	"\363\3614`\350Y\f\370\013q@O\364}\240\327\331\226\237\032\276\240fjN\331=\234\037r\024\036\377\203?\237\374\352\324\377\002\033"
+	.string	"\\\tT\323y\262\350\207s\006~u\0234\366g\002\004D\3010W\270.+\004\004A\211\0214\005\"J\2058\352p)\003.S'Z\350&\b,\352\006`\272\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.383.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\225\b\225$"
+	.string	"\326=\327G\220\332M:\365\213\367\225=o\234nT\0172\224\217\253^^Vq\316h\367\342-\020&\276'\234\365\347\034:eD\370'P\022\210\001"
+	.string	""
+	.string	"B7\202\332\3143\031Kw\b~"
+	.string	"\201:\035\324\266\266f\304\022B\266L)\274"
+	.string	"\254"
+	.string	"\313"
+	.ascii	"~\030\224\215\303\231\356\301\240\204\225\005=\362\257\363HH"
+	.ascii	"\360\340\324\251/\024\006\314\223\026\232\273\027B=\3704\n+\326"
+	.ascii	"\225w\355\0339\360|\360\311\266Z\271\234@\251UX\340\244\201\314"
+	.ascii	"\223\275\003(O\216\337)O\332/b\033\352\312\247mv\241\216\312"
+	.ascii	"3\fV\201\261\251\265\376N\322\034?\237\303\335lf\255$G\272\272"
+	.ascii	"\323_+\254\250\347N-\334\251\3426\026\255l\002\314\032Qm\354"
+	.ascii	"y\271\2021\366j\2558\254\252-\313"
+	.string	"H\2501@\306\032Q\330\315/\303-g\270X\3108\2151\245e\"\213\352\206%U\232\265\326s]\3110W\347\272\032Q\255\325/1\343\336\335v\033\333\fl\363A\272)[f?\352V\365E\361\245\330\314\374S\t\305\324Q\257\276U\207b?\356\304\266\331P\223+\265F\235\206\375&kU}'O{\206\224\251YKtn)\355-\245\364a\377)\373\252\"\226\330\242_\374Sy\272\324[\005Cj\213\316\255\301n*\245\235\244\264\267\362\303\376\035h5\306\246h\324\322.S\335\307Zk5\305a\227k^\271\336)\327:\345:\207\\\343\220\353\033s\275\263\255u\344:g\256q\346\372V[\333\312\265Y\256k\345\272,\327\344\301\376\221\\\323q\275\027\376\377\331\340\217X\255+\212iu\213\224\342\303\366\035IJ8\232\243/\253\"\326+(o\024Gy\206T4\244\266\030\334(\005\007\266\026\365\334\350\253"
+	.string	"\323\274\350{\265\326\032\3552\210\322F\233\276\306L\355\202\017A\3704xZ\021\317F\257\005\\s6\345>4-\245\351\340g\017\316\006\202I\203\200j\304\356C\263B\326\"<\r\232\032\025B\203\205\267\245\204\237\231p3\024J\032\004D\343\365\345>\264\340\310[\222\332\025,\330\027^\206!g\033\275\314\221\017Y\255\025\001\031\021H~\217\223>\211\362$I\203\200fg@(?\032\221\261\250\035\232\336\302Z+\245]\266\030\237\211\315L\262\342\n0~\230"
+	.string	"_\206\\\272\370^p\306\212(\264\370[n\304\310`\361\263\354\256\024\251\370U\002\346\300\324\241\267\201\251\247a\251\001\316\310\311H\303\350\264\204$\002\211\364\021\320\b\246\fJGF\0352\374\226\222\214<\374\216\232B\374\200z\314\364\001\251\351\347\304\304\324\364\303}\254\024\307R)\277\311M4\346rK\340A\020\354\225,\327\331\""
+	.string	"Y\255T\267:_\230T\t~\316\2543\306\022\"\220\261\223\335G\254\201\343\315X\0323\316\033<:\224d\247\306j\331\330\254\363\306\016\r\n&\361\032\273\217\370\342\246\323\265.Z\234<t\350\020\222\234\034\313\342\334\261X'\017\037\262\034\032\024D\342u\345>\264\242\315\2678>N AV\305)$E\321\017\031\016\025\"f\335\354\350\215\325\211\335\360\314\034\260:j\237^g\221\323\310R\371\311nM\024\371\350\320Q\2414,\300\0229j\007\200\245\250AD$\235C$\"\201\210$IA\322\001"
+	.ascii	"\003\221\031\332\346\021\2604\307\250\241))l\263?\007 H\361m"
+	.ascii	"A\344\361>\222\007\221\033P\221\265\271\3221\213\306\306\234"
+	.ascii	"$r5\251\264F.\275\202\006\207\267\310=\022\356\005_\203&\021"
+	.ascii	"\202\021\002\250\216\"\317\244K\253|\267\264\376G\331\335:\340"
+	.ascii	"\217\t\230<\261q2\246\326>\230\222\203h\343\345o{\211!\030B;"
+	.ascii	"S\277\3670V\250\217\204\034\222\326\204\272-\305\226\316\335"
+	.ascii	"s\351\314M\323\326\275QJt\320\366\313\023m\325\243\3126\353g"
+	.ascii	"K\363?TJ\bq\f\017\241Q\336mR\204\"\302qP\206D?<Z\330\004\310"
+	.ascii	"\346\263\355.&\022E\256ya\325\237\353rU\374\367\245\225\242;"
+	.ascii	"\276\\t\347\354F\304\t\372_L=1\007\360\031Aw\203\204\030$\332"
+	.ascii	"-\334\035\207\366\356\256-\227`\006\252\016\021\201\033\230\352"
+	.ascii	"\263\342\t%\257\300Ln\224C\026\023\230\227}\366L;w\017\327\220"
+	.ascii	"\375z>\0201\240XL]\354t\t\222\006L\b\fn\200[t\244\272f\003i_"
+	.ascii	"\351d\2177\r\214'\323`\032"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.386.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375``\001\345\r"
+	.string	"\026\227UD\020o\225\016\364\017\251\376\021H\023\203\3057?e\030\202\306\t=\034 ]!~}\223\2472\370!\r\272\003\240\352\356\276R\327\034:\366M\022\314\246D"
+	.string	"@VW\024\3007("
+	.string	"\332\021\023\204\020\331d\313\224\002@"
+	.string	"D"
+	.string	"B"
+	.string	"\237\367`\3734\301(;\305\305\327\016(Q!\341\203\305\356v\237\022\303Q\227\252\241|\330UC\210Gl\274H]^\274b\210\254b\343E\205+\200k\025\315\356\332b\341\236\267}\300v\001\373(\002+\231\372\260h,\346\023\263\341\302\211\224\242\250\334\260\324\256\255t\331\232\372\025\315\004\353\322\332e\245\264X\215I\302\301\017q\217\322;\254&\257VF\311\007q\321\364\016K\n&\035Z\037v\327\244>\354ds\\\"/\321\3619\254\300\323\207\336\366\211"
+	.string	"\003d\226qy\321\337I|\004\210^\360\021\024\340\265\273\006D|D\310\347\370\264\b\324\207\340\366)Q\302\023\225\246\270\242\276H\202\240\017//\376.\220\221\235\311\002\3762\021@O\350\363\030x\272\006 O\324}#R\227!`\320\301g\324="
+	.string	"\301Q\307\331\326k+]\206\3352\256\220\315d*\271*\321\320\032)76\233?r\222M\002\016g\373\344b\031B\302\223\313;\233\037, p\202\231T;\007\347\253\007 c,9\307\370\233Y\335\361\025|\211\221,|\2638\374m\210\3518,FK\364\314\002\034\223B\266\003\223\030\242\226F\220\205\374\bP\032"
+	.ascii	"z\257\013\233F\024\206\371pt?p\246x\303AFb\247\221\354\227\306"
+	.ascii	"\206\022K\347\024\013\215\224%\003\300\366\306\244\250\375'\340"
+	.ascii	"1"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\351\034\205U"
+	.ascii	"\032\204,\034U\200\f\346\244\003\373\f\327\033\361\310\335?J"
+	.ascii	"\263g_>\340Zn9d\272\341\3754\262\020\316(\373O\245\376r\233\265"
+	.ascii	"\214\212\267p\264\331\217\375\255\335\027\221\232\206^O\3779"
+	.ascii	"\f\323}\f\323}\004P\324f\273\334\256cH*\276\267\013Z`q}\341["
+	.ascii	"\266\312\235d\242\001\247\001\272\001G\201\204z\350'u\350\217"
+	.ascii	"8\333\324\220\033\025\352\203\240=\262*\250\317\363k\356\221"
+	.ascii	"\320gA)P\177\305O?\212\372\364\241h\317sr<\375\242\235\246G\252"
+	.ascii	"\323\007\322\234+\361\250\257\351\033\005\313\322YAk\037\211"
+	.ascii	"\332l\032\316\016\301\321\336\036q\364\246\251\222z\245$Q?\224"
+	.ascii	"l\312v\\\343[\177\212\267\244)P\t%\221\344[n\375\322l\252\350"
+	.ascii	"\353H\372\035\350n\325h2\361#}!#\277i\353\1778[\237\210\256@"
+	.ascii	"?\024\241CF\332a\215\n\251Q\022\210P \\\032\375q\240\311M\355"
+	.ascii	"C\372&\250\220\276\021\255Y%h}\017\264Hup\034\236B\220\276\210"
+	.ascii	"\263]\202\003r\322l\327\036\343\bR\316\313\372A\364\\7#\377\321"
+	.ascii	"w\242\304\277\221]\211\217'\351q7\036G\262\343Gt\334\210\no\313"
+	.ascii	"q#\216\253\245\360\022\306\316&\366\025\206'\022\366%\033^\344"
+	.ascii	"\306\321l\274\b\366 _?C\341k5n\206\243\3612\334\214~\220\236"
+	.ascii	"\360\323\2045\303=\240SC\350^\375&\332\325\177\242\004\204\035"
+	.ascii	"\311s\365\201\350\326w\310\3306\363=\264\236\003'<\217\030\375"
+	.ascii	"\037\n\343:Y\337\301\352\207\240W\264\207+a\337\254V\rW\325g"
+	.ascii	"\242/\372%\250\213\373\250VH\213\343\260xO\202\327\025{dj\215"
+	.ascii	"H-\021\025\307J\261HLH\222$\037\325\377\321\2759\324\366@\261"
+	.ascii	"+<-\333\235\266\b\216w_\311\r6\t\357Aj\204\333\335\034\331\353"
+	.ascii	"\221/v{\267F\320\371x<\036\177\242/Ew7\201\262\3658\0342\336"
+	.ascii	"6\324\237\353G\346\225\241|\003G\216h\312\337\013\273\324/\221"
+	.ascii	"GL\3519/\334R\236VeaY\261\324\237\004R\017\022\273\372\334U\210"
+	.ascii	"\017'\341\205O\200^XW\037\300\331\223\324\203^Xg~S\370\321I\373"
+	.ascii	"\017\206\207\245\b~\035\b\003CpNs\272\271a\341q\315y\201\331"
+	.ascii	"\303\302-+\225\007\001\027k>\356\303\302\032~7\245#\327wV\330"
+	.ascii	"B\2713QNt\247\n\347\316\\\375\233\334\324\276\256\243\242\302"
+	.string	"/5\334\204\364\2450\314M\310\234\024F1O\314\252\343\237_\030$I\036G\307c}.\261~\327\260\357\025\326\237q\243\217\202\215\376\027X\037\354\253o\003\205\276\t5\3725h\364\265f4=:\241\177\303\204\376\230W_\254\253\037\306\325t\304VS\0202\232\2060\233\212\320jZ$l\372\213\3214\bF\177\230\325\324\003VS\242\253\2469%4\365\261j\272S\325\224\347E\323\036\027Mq\250\232\326\026M},\372\307\025M\311\251\2467R\375+\025}!)\372C\242\372iP} (\372\304\247\276\f\247\376\217`\337\307\211>YS\037\207\211\276\016\246\276\n%\3724\312\276p\251\037\003\3307\225\3720N\222\344\256KR?\353\024i}\340v?\340\300\201\r\006\027\034-\021\267K\001\007\024h\340\240\002\233\n8Lp\301\006\f\354\253\217\222\330\0237\242oE\251\021E\302\211\350W\025\365_\204\350\273"
+	.ascii	"\321\247\352`\321>\374\204\017\266(\302\236\3656\b\316\267@z"
+	.ascii	"\266\f"
+	.string	"\227\204\022\365[\fu>\246\336\227L\237\035\362\201=\202p\303v\310!0\355\220i\\\232\316\013&\206\252\337\215\373J\244z\2424\332!\243\324c(K!\364\023;d\235\351\333!k\310\331!\357\316\3736lW\002\005\325Ml\030\323\234\271\306|B\013\2666xW\236i\301\016\3060?\030\323(\235\300\365b\227\245\365\342\026\237\365\342\225\362\302Y\226*%\326\213-\230?\331\022\032\025\312\t\321z\261Nx\nc\353|\222\360\300\337\254\326v\361\t\322n\361M\r\273\30509\273\3059s\304jq\256\222X-~y\023\362h\265\270\315\257\017%?\255\020\3123\216\332\325\333\213f\030\204\372\002~P=6\346\031\006I\336\324\370\314pM\006\345\206j\301\231\301\244\251\n\234-\276\013)gJ\0251\303\273s\006\252\347\350\276\031\326\2259\243\031\276\371\2523\303\021\344\3140K\271b^P\251)ug\242\230"
+	.string	"(\375h\234B2\234+?\310\034\20035t\0202Z\017!\3030@2\314ihf\361\004b\366\203\230\205eUE\325bJ*\n\312\251\232(\227N\006\036\337J7#mE\214D\3164\023\255,V\263\363\207I,\263\252\325Ie\266(\247j\324\te:\225\301\312t.\231\024X\036k\222\323\3154R\266U\343I\304D;\213&\220\322\254\022O,\323\252\244\252R'\224\031d*\201#\200\340A\0076\034\316\345!Tn\310`\376EW^.\247\002g\313\331bv\210\341\026\226\025\225\024\013uWz\210\341]\035\212a\224\023\235y\006\373\361](\206\017\024\303/# \212\341\232\362W\363\241\243A\373,\342\t"
+	.string	"\366PaO,\341\003(qu\264jV\300\003"
+	.string	"\0265d\317*\340w\030\034:\255\330\224\271\344S\346uld\345WH\325\263\210\252o\341$,o@[T\333U8\365\256\343\371\352\331Y\022\236gc\251w^\016\342w\306\235\031\260w\004H\222\\Y#\217P~"
+	.string	"\340y9\326\310!\364\216[B\023.\332\032\031\204\272\263F\366@\330\301y\036\225\314\032\331\246\006\030\263F\256\251\031\b3(-\310\340\242"
+	.ascii	"Ko\345L\251R\302\2275\262\205\022\005x\026\2561\037\2065\236"
+	.ascii	"\250\201\265\035\307\305\032Y\247[#o\215\234\353-\331\032O\270"
+	.ascii	"\306|\257Z#\277\2676\f\016\237V\310\252\361{\177p\030\024\333"
+	.ascii	"\262Uc\232\325\261i8+\204u\300\342\242\241\261\212\212-r\n\361"
+	.ascii	",_TI@\225-\362\256w\001\216\030\rI\331\"\243\bK\251-\362IoH\\"
+	.ascii	"\340H\307\320v\001\203\364\366\2148\263\3051\337O\305zmq\327"
+	.ascii	"D\334\214\330\256-r\216\370]\022t<\267l\203$m\020\316\t\277n"
+	.ascii	"A\243\342\226\355\031\277\242\3303\326\021uk\306'vm\331\2321"
+	.ascii	"\214\t\231\2539]yRy\2732E=\217\347+SN\025\263\352\374\266\214"
+	.ascii	"/\224\361\211\377\027\326\316\315\022\367\3341\337/\305\243\366"
+	.ascii	"\344\227\233\220-\221s\300\335\261d\374z\250%c\230\272;\270h"
+	.ascii	"\206\231\212;\231K=^\251{\332\035\214r\242\330\035\234c\242\325"
+	.ascii	"\301'\304S\022\307\346\340 ,\245\242%\022\203\207\331qV\214\202"
+	.ascii	"\261\221%=\270b(\036\242\326\036\2024\250\262\310X\322\245\316"
+	.ascii	"\210\220H\222$\351\022\f\020\226E\251\203d\033\022`\263@\313"
+	.ascii	"bPJ\002\221@D\002\221\231\007`\240nH:\224\302=D\333(\364\265"
+	.ascii	"\206\005\235r\232\332\243-\236\007\007\357\202\020f\240\007\363"
+	.ascii	"hI\233\335\021\020C#\0202\332\202k\022XRs\302\301$\005\036\244"
+	.ascii	"\377s\372\3369\213z\013M\005\007\0365\007\364d\216oH\257?%\215"
+	.ascii	"\213l\260}\020\311\245\361\207\353\362\207\345F-\233\022\300"
+	.ascii	"\325U\313\027\322\350Xy4>\177\227\361\313Z\022F;\233\001\"@\201"
+	.ascii	"\305\220*G\337\263\251=20\022%\320\334\320\335Q\002\3631(\315"
+	.ascii	"\205N\033"
+	.string	"\300\335;\255\237\201\331}"
+	.string	"T\320\246\270\321\262_a\031\334\225"
+	.string	"\324\343\321|\205\004\365-\007I\220\027;\031\00246\230\265\306\334^\312;\320\334\362\321\236X\262hu\240\030~\347P\271N\344 \244\212\276]\321\231\b+N\251G\307\203\331!p\037\"\252\254\240\335c\235\033\032\230\241*\006\030\241\262\013\006\201\013k\320t\366\237\207AL\007>\250X\021xp\017\200K\024\320{\260\366m\304\340\031\332\257\033\364\353\344\274\026A\361\017>\231\201\232X\205\022?Gm3\255\327V\376\037O0\b\036\034,\224\314YM\256\034<\314\353\341\230\234\\4\035\214\335i\224@\301\213\242\346\321\030 \"\335\337\241\022\253J\034`Q)\023\250"
+	.string	"\343\227\302\272\321O\244\030\214B\207\344\335\357\216o\275V\n\237\271\217uj\277\227t{r\250R\341\202\005\222\252\373\350SQ\336\315I\307\362\202\377\370\354\326\342\033`\331\311A\006+\300j*\"\357\2110{\246\365\342r\310U\263\256\344Bt\255\235\3344\272\035\035\201:\002\002\t\231@N !\023\310\t$\304Ie/C\035\352\032\037\260P\0305\236\212\261,\204\354b\262\r\t%J8\013\244\270\241\314\306\201\242\021\001%;\306\340k\341\020?@\260\340"
+	.string	"x4\300\361\315\024\001\006\374\375\030g\2267\325\253\021\376\211y\365=\260Hc\303\205\277\321\327U\212EK:\274z\241[x\377\220\376G+N\237 \337\371{8'O\016\"\373J\3617\3318\026\217\003o&\267\247|\3009\212$\313Ns\305[\210\372+\260\363\304\267v\244<\274\324\303gq~o\257\317\345\364]\034\037\353\371w;~V\347\307r\370\256\257\277\345\361\265\036>\213\363{{}.\247\177\003\227\304\302\023\220J\016$\032YK\366\337\023\262-QMjP<_\305\365\325\324\267\246\001\272/P\250oP]I\225\345O\200\356<d\376\f\364\313J\2217\331\324k\373\2748\313\326\304]\333\260|z\274\313\016\250\327\347\263-*\b\\\303\347\241_\335V\366\311)n\020\345\212\316\023<\313\352+^l\315!\231\256m\252fb2\337\205:\276\327\006\240\371cp\377_"
+	.string	"\215\314aM\365\304\304\362\276\275\376\253]1\007\223FKF.e\314h\324\3723\301\024\316\332\345D&\337\303\264\305/%\\\"\213\367!\211*X\033\260j\224\344\325IzKB\242yB:\256\360\231\\\370\t-\342\004JZN\331\341\252\244s\036\b\006"
+	.ascii	"\001\320\305\247\303 \232bKm\304vY\fP\005\3710\340 \232\234\007"
+	.ascii	"\263\223\313\207\206<\232\305p@\216\032\260'H\024@\200\314\254"
+	.ascii	"~\343\244\235\357m\024\034/)\224\226d\240<<i\002\237\263S9\237"
+	.ascii	"\271V"
+	.text
+	.section	.gnu.lto_.refs.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375`\263\b\005,"
+	.string	"Zep\021C\200jM\032\003\215.\231\333\234 \372\312\226\360\340\305\247j\277\370Dg\007\377\355U\377o\275\351*s\265\251\260\227\302-\022\b\033&\360\317X\nC_\240\211\312\257\326\244\033Qw\267\266d\2334B\266L\001\353"
+	.ascii	"!\001\001\001\303\251\377\232\363\263\352O\210\332#D=\004r\277"
+	.ascii	"\"?A}\003\347?E\355\300\2727\325g\"\367\037\371H\002\276\tx\262"
+	.ascii	"~\255\016\305\264\257~\257\356\274\372&\271\357\310\277\325\267"
+	.ascii	"\221O\353\001l\333\316}<\177\317\005\020\376 A~\316\236~=cb\342"
+	.ascii	"?\007\370\277\351\032\377-\247\317\032\037\313\351\255\306\247"
+	.ascii	"\032\177j\374\250\361\201\343/5}o\374\335\3708\246\037\307\227"
+	.ascii	"\222\266\375\366\361\367\264\337\276J'\211\013\240;\224\357\003"
+	.ascii	"\320\035\200\357\237\350\016\364=\223\357\225|\177\372\336\244"
+	.ascii	"_\372>G\037\347{\322\367\264\336\323s\244r\222\356\266\375\032"
+	.ascii	"\335\307\335y\343L\346\376+\367\244\272\237\273\035I\267"
+	.string	"\363r\364\022\267\357n\237\253\373\255\356\265\356\266\272\217u\247\221{h\333\332\356r\374\034\355I\361k\341\323\350\213\373\224\376\356\333\236\314\022\341\\\277o]\201\276>l\373\366\340\201\3433\364\275\321\333\327Fo\377Q\3577\264\031\372\203\316\377\317)\005\347<O\254\363\257\316\017\236\217 \353\013\234\037u~\323\371\274\363k\347\207k\375\366\246\300tU\335\203\365O\t_f}\356|\261>a<\304S\367p\254~(&g\374\020N\325\207_X\037z=}\230\346L\2310T\037v\331\202\245\312\024\t\037>\211\360a\023\b\037*y\360\341\221 W\037\376\350\241\303\352\303\034\217\030%:4(\220\037\253\247|\3648xz\207N\2346j\320\224\001\243\305\312\024'K\220\f\001\302\243\351i\016G\213\f\t\372\303\247\254N\230\033/\2561^\260HYB\244\3517\b\220\037;tT\375\346x\324\210Q\242C\205\252"
+	.ascii	"U\231U\375d\r~;\3010\006\177\234/6^N\277\232\255\005\277\231"
+	.ascii	"\363'(\370 \325SQ\375\024\360\245\304\207\002>P\374\246\004\364"
+	.ascii	"\036\202?\017\274i\340\313\002\344\324\213\004~\245\036\360\240"
+	.ascii	"\337S\313\362\334!\367\355\220\177\030X\335\003e\224\236\030"
+	.ascii	"\257\225O\233\214l\023\341\272\317vr|\261|\032\274\204x8\376"
+	.ascii	"n6\t:\335lG\3546s\257\225{8\356;.B\334\311\334\233\312\235\311"
+	.ascii	"\266/]\266\377\336z\245\311v\037n\357\205\373I\333\221x\346o"
+	.ascii	"/\317\263\353\224\366[\326N\023\305\336\036\206\275\235RJC$\335"
+	.ascii	"\323\355\246.\370\271\032\004\333\307\335\257n\020\266y\341n"
+	.ascii	"\322\366\035\355u7qlLk\027C\334~\270m\013w\032\360\303p\337p"
+	.ascii	"\017\342u1\261}\247s\207\360m\302d\311\021#EzCz\234\343\231h"
+	.ascii	"K\013x\376\356\374\332\243\034\222\276\331\316\037{/\3666\320"
+	.ascii	"\306\351\376\266\373j\333\311\335.\356\300\250\206q\246\334\316"
+	.ascii	"\313\275-\367a\356\f\342s\375f7\177\365\327/\270\315;\315\346"
+	.ascii	"\223^\363H\n~\027|\034\271\327\217{ya\310]\357\332k\264\273\350"
+	.ascii	"\364\366\213\373\002m\023\267\347jM\274\353\351][\030\017\257"
+	.ascii	"\r\2728\350H\367Fx\323m\377\231\273R\271\373\314\275W\356\274"
+	.ascii	"\361M\340\256\003\356u|R\334\307\035=\r\267\213\341\036\322\306"
+	.ascii	"vk\224\323\035Mcg\320\027\270\214}\305c\354KF\314\227.\345/\227"
+	.ascii	"r\374\275\262\331\276V\266\n\225r\337(P\312\372\233\304\366;"
+	.ascii	"d\205\230\277A\314}\177|f:b\264\331y~B\217\375\201V\324\347l"
+	.ascii	"\217\236\322N\035\261\025\355\234\027\321\007\213S\256h\377\215"
+	.ascii	"\233\2576^J\2539\021}.s\177\253\334GS\367\317\324=k\034kDt\b"
+	.ascii	"\346\376\240\334\257\352nU\367\340\370\202\017\321\023\230;\202"
+	.ascii	"r?Pw\003u/`\356S\345N\240\356Ru\207\032\007n\210.\225\373\257"
+	.ascii	"\356Ju\357]\210\316\253t\206q\330\013\027-\350k\316b\337\362"
+	.ascii	"\025;\315\334\305\272*\302q\346~+\367\212\333\311\233\326)\306"
+	.ascii	"\003\320\201\364\235\350/\371\036\t\3705\374\02086\212\333\266"
+	.ascii	"\262l\253,\200\305\250QxEDJD"
+	.string	"F$\220 Z\220$m\360\242\232\321\326\001\020\310\223\244\335p\270\032\024Tl\360\t\031\342\017\257$\233r\031\261f\n\266-\267\244\\\311\314\233\007\013B\357\230\024\220_\212\236\243\033\325\331\234\362\006\304\b\341\021\301\306\243\005A\306\342M\220\t\t\305l\212K\361\332y\326\246\315\033\243\234l\351\337hF\351+^\255-)\236iF\225\317\230\242\267\213\370D\321\035);\333LoR\203^+a\020N\374\246\241|m\327\021\364&,\036F^\022#\347\345\217\027\313\377\r\315\243\351\t<\237\354\223\230\315\245y#\222\020[\202\003\310\322\222\363z\220\2205\3562S'\346qJY\373\037\021\315?\372\320\032K\252\t<FN\006MI\2472u(\350\334'\330\324\036U\305X\245\270\340\177\342\026&/\341\345\201\216\300\317\t]\022%.\276'p?d\023\255Y@\255\003\020\363\301z\013D~\232R\212(\234."
+	.ascii	"\330}\342\0354\361\003\3557\204\273\n$&\335;\200\253\242_\323"
+	.ascii	"j"
+	.text
+	.section	.gnu.lto_.decls.6d1af7c3a32e65bf,"e",@progbits
+	.string	"(\265/\375\240\3348\001"
+	.string	"\345\324\004\376Y\007 \032T\020(e%5\006d\217\236k\367p\r5\207\036 \237\207\026\020\204\375 \275z\004d\371\331,\324\242\203\007\366\265\337n\306\261\004\310hF\344;\270\272\r"
+	.string	"\b\267\024%\312K-F\001"
+	.ascii	"A2y\027\224&H\200\004B\342\370F\266f\204\354-wS6\271S\312\026"
+	.ascii	"\254\032\336\032\373\032\270\266o\013H\013;\352(\351F\326\276"
+	.ascii	"\037\372\006\227\254!Y_\203\217}\rV\373\032b\354g\260\333\317"
+	.ascii	"\300f\253L\252\316j|\333\317`e?\303\223\375\f`\373\031\202\354"
+	.ascii	"\337G\345\223*\203S\247$\353w\220$G\343\205\257\206\317\311\367"
+	.ascii	"\344\263\341c\362\345\360E\371p\370\240|7|M\276)5\352\223\362"
+	.ascii	")\335G\303\267t\025\351\f\034\030u1\350\2362\214\356\212\360"
+	.ascii	"\236\037\210\336<c8O\237\224o\306\007\237\224\357\310\347BH\004"
+	.ascii	"\215\211\326\264\032wT\326%@\204L\001\240U$Ug-\252\307\365\031"
+	.ascii	"\210\3661\240\331\307\320e\037\203\332>\006\262}\fC\3661X\355"
+	.ascii	"c\210\261}.\336SZ\221\216\256\216d}\035\273}\2354\373:]\366u"
+	.ascii	"\242\354\353t\355_\347\3518F\342\0301\311\032\016t\312T\207\032"
+	.ascii	"\214\254\257C\265\257\206\251\241!\215\343\370\203\276\323m\364"
+	.ascii	"T\343\3517\332N\215\352;\315F\203\276\323k\264\234\n\027\005"
+	.ascii	"\215k\270YI0\336\246\233\016\314\b\306\326zz\326B\034\207\255"
+	.ascii	"\305i\332\262\376\360\341\332\215:\206\027\315\222\365up\354"
+	.ascii	"\347\344\355\347\334\355\347\314\355_\247A\323\223!\266&-k(p"
+	.ascii	"ii\313JZ\327v=\221\351Bw]\367g-}F\313\001\2030"
+	.string	"\316\212\216\262\356\305\252\316\252\315|\270\246#\323T\305F\326>=\247\345\310<\251\334\344\312\200=\365\b\002\r\213\343x\330V\301Cb\203\214\206\340\334\033.oc\310\304h5%_O\360\262\276\332\345L\005#\364\305\261\025\0313\025\214\n\247\025\20109\351\007(:\n\0231_S\265L\254\t\222\022+L\322\212\304|M\267\274\324\263\017_\304|yI\321j\272\211~\"<K\343f\211z&\354\305qU\234\347\027\0231_\323\250jWWD\314\227\027T\265[\271\230\210\371B3K#\346k\252\226\201\315h\013#r%\346k\252\325\364\224\263\032b\276\246\372\212\356\242\275\3506\235Ec\321_\264\233\266\242\265\350-\032Ns\321q\372M\203\321k:\214fS\243ZM\247]S\321U\256\363V\327\222Z\246\325\364\030\313eE\314\3274\216\241\300\034_Y\324`\240\263\225\252\263V\240\036\327\347\210\355\347"
+	.ascii	"\331\317\201\332\317\211\367\217b\366\217lHtY\020\016\252\214"
+	.ascii	"\224\254\177l\262\177|j'\252\322\232\254$Y\377\230c\223\035\221"
+	.ascii	"\366\215\323}\243\334\276qm\337\350\265o\374\261o\264\261_\314"
+	.ascii	"\333/\312\355\027\335\366\213N\366\213B\366\213S\373\327I4\022"
+	.ascii	"_\223-_E\032\311{E7\270\244\035\321F\314\2345\275\311\372\327"
+	.ascii	"FzvY\246\354\210d\235\265$\210\364\356L\306\026Z\214\244\374"
+	.ascii	"fL\024\324\213\274\244\234G\343\013\036\321\f\250\236\013$-'"
+	.ascii	"T[R\224\266\314\222\236aJ\224H{E2\240n\330ey}I\217\242\352\236"
+	.ascii	"PPS\251):\035C\246\220\221U%\031\215\211\221\205DL\252\025\375"
+	.ascii	"!\325\261\225\366\314RTf\236[Qh\350xJyJ\365\256\262\272lM\231"
+	.ascii	"\001\325k\352\331pq\227\325z\264\t9\223\352a\205yK\312v>\244"
+	.ascii	"\302\230hI}hm\371\241\245\227\343\317:\200\260\315\365b%\351"
+	.ascii	"\007\273^\225^\227\036\224\312\b\243<\251\326\223)-(\020)\234"
+	.ascii	"8KO#c\317\255^YVT\226\230\020.3\032;\310@\331\365\220z4z\320"
+	.ascii	"g\tN\340H\263\216\"ePKo\2222\236\017\034Y\212\007\027i\317\256"
+	.ascii	"\207\243'%$\"\306q\326\221%\371\356\317RVe\244=:\315\324\213"
+	.ascii	"\243\2714\f-D\317\320[:KSi z\210&\352\345\365\326\350'\315C\357"
+	.ascii	"\320W\2757\332J\343\350\251\351\231\351\335\351\"}C7\365\340"
+	.ascii	"\364\320h'MC+\351$-\325\033\243kh\035\332HC\365\330\350X\277"
+	.ascii	"\350\341\351\251\036\231^\033\215\245{\364\344zu\2753\372H\027"
+	.ascii	"\351M5\222\316\241\227zR]\245\177\350\030\2754\332\205\216\322"
+	.ascii	"Z\332\207\266\241\211\350\247\226\321s\323\233\323Aze\324h\317"
+	.ascii	"\256\007\346\2750=1Zc[\037\340\340\344\254.0\251\016\"a\242d"
+	.ascii	"(&<\251^U\230\271\336\321\237\267\240\340\220\312r\341\366\324"
+	.ascii	"j\242C\232\341\200q=sV/,\314\220\247\233?'\345\351\230\034\317"
+	.ascii	"8\206\352\310\222\363\362\206\306\227\327\207\270;i\316\352\331"
+	.ascii	"\365\222d\205I\343\030\252\243g\327\013\342\004M\032\307P\rj"
+	.ascii	"\233\035\326\230\032\2457\025UgUe\250\307\365\305\245\375b\274"
+	.ascii	"O\254\333'\302\355\023\317\366\337\263\362^\227\277\227\326\243"
+	.ascii	"\322{S\333'-V\320\262\346\322\213#\003M,\353\023\237\354\377"
+	.ascii	"\275-=-\275\266\036\233\032\355\271\365\260<\177\2406DJ\326s"
+	.ascii	"\353e\361\272\302\365\354\271\365\326\3243!\0214^\372\300\n\326"
+	.ascii	"\227\227\357GT\2328W\237\270\265O"
+	.string	"\344\261O\274\332'Z\355\023\253\266\332\344\303{V4\2176KE\262>Qj\253RUg\025\200z\\OD\332\037J\367\207`\366\207k\373C\262\375\341\221\375\241\325\376\020\306\276\320\315\276\020n_h\266/T\262/\004\262/\304\261/D\332\017\326\355\007\301\354\007\331\366\203M\366\203\\\373A\034\373\301\030\373\3008\373@3\373@.\373@\264}\240\327>\360\307>0j\037\350b\377g\267\377\203\333\377\225\355\377\222\354\377\246\366\1773\366]\273}\327\313\276\213\266OF\325Y\357\202\355\273=\366\335\246\3756o\277\375\262\337J\331o\275\366[\034\373\355\213\375\215f\177s\331gSu\326\236\324\237\257\362\234z\326\344\302\361$\353\357,\373{\312\376^\262\277\267v\257F\317I\215j\350=}1\2421\225\3657\217=\202X\325\260>O\325\260~'\355\263j\366Y\271\375\367b\274G\343\357\301\310nzJ-"
+	.string	"\261\341\324%\353\336\214^\322{J=\031qO\311\003\2538.\352)\r\337\304q\321PU)PU\n\364\027\026\227\224U\237\r\263U\260\017\357\305\030\306\245\261\031\222\365Y-\273U\217\353\331)\373l\222\375\251\252\263\236\345\332g\255\366Y\032\373\353\233\375Un\177m\333\030H\331_\273v\b\252\316\372\325\307\376\332\264_\326\206\315J5\207\246)\353\377YM^\223\323d4j4\263\311R\025\032\307d]\350\266\346\314\004\221~pF\265\253"
+	.string	"\211U\235\333\264\203\314&\327\021\241\361"
+	.string	"\tS\235\3334\216\241\373\313\351\205\025W\337Gf\337\367\266\357\223\262\357+\262\357\303\332\032\262\\\026\303\336y\275q\211\311Y\262\227^\224I\002qe\244W\314<\261\310I\303d0\231L\216\313cr\0315\232\305\344/jY\026\223\253\234\351\362\253eVT0Ft\317\254\226\305\344\2659i\034C\203Xp\340\226\b\365}Mp\352\0173)kY\337g\264\377g.\331-\277\251\321\334%o\351@K[X\033V\356\222\331T'\f\200\216\t\363\212\343XC\006\031d"
+	.ascii	"\274\022\226\206j\353k2\373z\313\276\306\262\257\255\354k\264"
+	.ascii	"}\375"
+	.ascii	"d_\177\355KU\235\365Z\310\276\326\332\327;\366\237\251\244\t"
+	.ascii	"\315\344\264\266d\235\366\347\263\214\226\315\200\272\313G\214"
+	.ascii	"'Y\253PUg\3250%\233\271^n9\260\230I\351B\244I\232\254\243hh\311"
+	.ascii	"\264x\320\310\372Zi'\335\330\242\303\312,i)\333\210\267\270\220"
+	.ascii	"\371(\313Z@2\017"
+	.string	"\263%R_9G\256\022\026\021\343\243\271)\317\254\257\334#\333\020\026E!\242\004*Ju\262\225\366\334\022\222\207\364\242L#\266\302\244_\271\210\031W\033\027X\376\312\317<DxD\214\343\255\257g\333\237\265~\214u\345'\271,C\263\222\334$C\311^\231Iv\222\3012Y\036\313b9,G\363\0225\232\277\262\221\347#\031I\206\302a\206\326\301\237u|\345\035\231G\017J\245\205\261%E\032\307qR\376\312IT0\302\"h\314\304\232\311\301x\233\3061\264g\004\006\257F\005\372\032io8UgU\223\326\354\367\352\366{a\366{m\373\275*C\376\034DmS\235d \2257/nd\375\036\224\rT\217\353\004b\373\275#\233\203 \373\275\254}(\3263\2172\241\223\023/\251\254\363\325\207g\254\006l\361\370\312\272\247c\277\207c\237\n\325s\325\363\223j\225a\310\206\250LL\326y\352\3033\225"
+	.ascii	"\316\326\252d\315:\355\303\251\307\365=\244\375l\267/U\217\353"
+	.ascii	"3\232\235m\374Y)\323\310O\252U\006\266\206Z\324J\326\271)\327"
+	.ascii	"P\243\033\262S\032-\243\246\254\237\313l\021\304\261\272aU\363"
+	.ascii	"\362\324\r\253\372\366\341\231\251G\005\313\2137Y?\177\331\034"
+	.ascii	"\250:\353\252\036W5\3163d\240\021U5e\235e\344\030\232\211U\260"
+	.ascii	"\325\242C\tT\326\317j\373\317H\022\f\2417\224x\300P\3632\030"
+	.ascii	"\034?\234\262\376\363\213|$\246\005\313X\326W\311\3247j\236\n"
+	.ascii	"WF\002\235\2314\216\343\377\331E6R\243\371\350\032\232\217r\221"
+	.ascii	"*w\006&\215ch\006\0322\b\316m\271y\255\372\271l\307\371\232\220"
+	.ascii	"(\322<\025\216*'<\202\306M\356\231\024\030o\323\034g\"5\252\346"
+	.ascii	"\221m\370\2751\371\232\256\372Yl?\033\331\317D\360\354\300\260"
+	.ascii	"`\225e\255\332eu\252\336]\265S\335\034\304\007\007\036\251v:"
+	.ascii	"\216\213T\225\002\241\252R\340[\023R\324d\325\317[\373W\333\250"
+	.ascii	"Q\211\210\226\220\262\276\332\346\246\236\365\240O\026\nV\022"
+	.ascii	"\331\377\341\252\032U\214*\327\2132m(MbH\331\250hT\251\272F\255"
+	.ascii	"S\323\250QU\215Jw\265L=3\305L\003\276\362\244q\f\375pU\215\n"
+	.ascii	"\247\202\351A\251l\030MfH\343\030z5,L\234\214\017\376\017j\324"
+	.ascii	"9\365L\205\213\212{qH5\222x\30514\203\f4d\220A\006\031\260Q\264"
+	.ascii	"\2547B\255\306w\373\352\231}u\314V\307\250d\324(\006j\031\350"
+	.ascii	"\260\025\243\206\252,\353\253o\373*\006\353\020\203\365j\224"
+	.ascii	"}\225l\253^\324/j\364\0025\356\352\233\332\345\276\"h\f\215c"
+	.ascii	"\3500o\301\211\322$\353\253`\373\352\005k//O\275`\275\272\265"
+	.ascii	"\211\252\316\232\325\343z*\252\316z\025j\037N\325Y\177u\013\006"
+	.ascii	"A;1F^Z6\260]Ut\364`\273`\037]1\013\313\242\366\353\n\303\326"
+	.ascii	"\225\365;HS\237\b\217\210\361\221\331\231g\034\307\357\340W\313"
+	.ascii	"~\020\037\250jj\024\365LHD\214\215\346\246\3178\206\376W\327"
+	.ascii	"\324+*\0265\252\252\251T\256VQ\255\\C\343\370(\216\343\253a\377"
+	.ascii	"\0075\025M}\322\2132\305GM\326\030\340\305\r\224\256i\034\307"
+	.ascii	"\031d\240!\203\325i\211\230 [\253V\252\316\232\243\036\327_`"
+	.ascii	"_\205}\022\266*E5S\243\022\250S\016\342\203\367\210\230\304a"
+	.ascii	"q\f\035\006\343(\211\203\227\365\035\260\257J\260\252y\252\004"
+	.ascii	"\353Al\242z\\\177\025\312\223\036R\222U\\\026\307\320b\n2d\234"
+	.ascii	"\311\372W\305\256>Q\235d\2538\303\217\353\306\332\231\254\325"
+	.ascii	"%\352\230\032\375\232\312\344j\023\225\354\355\0214&\213\343"
+	.ascii	"x\250\376\310B\364#\353\t"
+	.string	"T\235U\253\307\365\031\354\253\320\033\257\342\017\2367\2138\216c\365k+\233\227\227\227\247~m\005\361\341\252\330\257\202\251a\307\225)\n\032\227\305q<\\\275\324v\330e}\250\252\263n\365\270\332\265F\343\005\177\333\203uY\342\317\n\331\343\277\306\255rn\210\337\025\361\377P\370W\272\177\2353\363\2639\377*\375W6?[\374W7k\234\237\035\376\354Y\0356\303S\260\340g5<\001\277\221=\303\201\337\t\273M\335\277\201F[\315\036\263\321\270\037\204.\227\333\341w=\374\277\022HH\300\3451u\221~$\374\273n\304_\354\362\257T\324\243\232\243\301\374\031\355e\256!\013i\337\226\313\222\001L\321\354\337\352\231,\324n\300\252\311\300\341\027\242\365`D\266\033\374\356\bX\320\300\375\215\026\310\320^\360?N\205\f\237BBCKA\210\2775\272\271(\374\256\n(~w\205\377'\302\317\342\375\030\320\006w"
+	.string	"6\032\243K\345Z\340\337N\354\215\250\177K\300R\375l\325\220\"G\376\253\031\341\317\0368\373E@\375\016A\355\007\201\337\003^\006\003.\226\313\302>\343n\340w\271\f\300\341\347\200\377\007\342\007\302\206\377,~c\007m\360\323\223\255A<\200\373W/vk\334\257}\037\300o\034\300\357\226\360\253,8\271\332>\262s\256\004~\366\350\327\301\277\267\264\277-t\271\300X97\004\031~ ~\034h\337\033\360\033\003\020\206=\263\307\2241\300\006\023\205U\303\236\371\232\006\024\354\334\377\3510K\207\2375"
+	.string	"\234\337]Y#v\004.\017\366\277\377"
+	.string	"\370\215\031~\033\364\324\270\035\374\256\007\377\017\001\277\332\256\355\377\234\337x\374[\365\027\260\032\262\321\367\267P\177\033\365\37740\3762\370O\266\025@t\376\353\n\377\357"
+	.string	"?\353\302\277\226\370W\f\374k\006\376\365\001\377\252\201\177M\300\377\303`\255\300j\342_/\360\377.XUX9\260\356?\013\265I\332*\255\225\377g\200\277]\373\177\026\374-\226\377WA\333\366+\300\332\200\177\375\340?\207\037\001\376\237"
+	.string	"V\236\177E~Z\274\340j4\336\277\0227\323O\202\334\344\317F\376\354\365\347\260?\223\375?\016\277\257\314\277\272\277\257\356\377\005`m\377U\375Y\267\037"
+	.ascii	"|_\377\226\361\333\360\373\216\374\373\305O\303\357\243\361\357"
+	.ascii	"\242_\206\337\327\374}\360\277E\360\303\360\373<\370}\037~\037"
+	.ascii	"\t\277/\304\357S\300\357\033\361\377t|%\374>\023~\037\211\337"
+	.ascii	"7\302\357\373\340\337/\374r~\337\360\367\005\377\255\342w\374"
+	.ascii	"\263\001\376\234\223\205\277Z\367\253q\376\214\200?\257\177v"
+	.ascii	"\177U\313\257\226\371\3254\177\336\360g\t\376\2371c\360\347\375"
+	.ascii	"\347\013~u\315\257\346\375\031C\346\340W\333\374\252\334\257"
+	.ascii	"\222\371U6\377\257\230\215\377\217\250J\177\365M\326\340\317"
+	.ascii	"\036\376<\301\237)\370U\274_\305\361\253Y~u\313\257\262\3517"
+	.ascii	"\377o\370\353\274_\303\371}\371\377\tu\234_\337\375\332\315\357"
+	.ascii	"\353\375\333\003\377n\376\202\277o\r\322p\275\r\374=\r\354\237"
+	.ascii	"\0370\363\374\031\305\237-\320C\361\367,\360\373\375\275\013"
+	.ascii	"\364\024\3203\341\357\211h\277\376\026\354\377\271\177v\362\347"
+	.ascii	"(\377\346\300\257\375\355%?\226\335\362[\3776\311\377\363\375"
+	.ascii	"\354\005\332\256\377\2473\223\211_o\253\260Q\b\221\241\025C\301"
+	.ascii	"\302/\377\356\321\236\200\272\177\"\324\357\342\345\027~"
+	.string	"\367.\177\340w\355\376\266\207;\315,\376\034\202\337\265W\256\233\277\245\372\333\252\277\325\361\273m\376\226\310\337\026\371]6\233\004w\215\372\f\354"
+	.string	"rd\345\377\013H\220\035\265\315/w\210\020?\021\306\257\216\260Jq\333\025\312\317\202q\325\270\277\337\005\376n\232\326"
+	.ascii	"\277+\374]4+\215uiG]\342\357\026\177W\352\346\374\256\316\357"
+	.ascii	"\326\2552\326\031+\214\237\375\342\236\351\235"
+	.string	"\360\263p.\235\b\327\314\337F\371\335\271_C\3713\332\032\257\"XG\360\237l\r\301\277\032\375\353\321\352\342e\f\240\001\205*\001\355\373\006\376\342\212\377V\376\253\375\252\317\257\246P5\360\253,\334\211\272\201\237_m\341WyX-\256\\\031\003H\300\367\016?\361\202\377k?\353t\313\230\371\377d\370\237\370\023\007\360\277\214\217\006\277\033\202\267\277\035\261\275|ZT\262\335\270\020\370\331\025d\354\376\337\271c\376\335\206\256=\376.\027\353\342\302\337hA\335\357r\375\316\005\341wC\360)kw\f\177\221\313\317\374Y\250\315`\364\360o\241\313\265\272C\376m\344g\205\\!'s\203\374G\261\225\350\374Eg[\307\312\271!h\331\374m\233\337\375\261\252@\342j\271>\\\036m\232\025\337\360\027\225?;u\261\376\226\375\335\253\377\322\237\025\243\376\356\216\2375\200k\365\263\022\260\356\257\341~\366\315\325\361\263\300\326"
+	.string	"m\376Ya\3533\376Z\031\355\214\337\255\372\335\247\304\004\374\333\370\357\271\337\245\3727p\272\345\376\357\277\270\366o\037\273\315\334\251]\305\315\261n\331hE\252\337\205\242\362\267f2\234L\315I\373]\251\227Y\321V+.\216\013\256\234\202\277\210c\r\262\266X\233\377\312\\\205\376\325\003\377\247\254\360\252b]qA\027S\225`gqm\374n\006\227"
+	.string	"\255\335\337\336\375\356\223\213\301\277bqr"
+	.string	"\211sX[\254k\377\232\345*\374E$\356"
+	.ascii	"~w\202\337\255qA\006\214'\323,\260\005\270\004\177\221\310"
+	.string	"\377\351\016\3426\375\355\027\227\351\337=\376\355\303]\372\325\021\324\022~U\0025\001\277*\302\257\212\370U\020~u\304\257\222\360\2539\277\n\201_\r\341\177\234K\343W\027\320\216\371[2\277\253\364\253!\324\007\374\255\b\334$\265\001\277\312\200\2775\363\267t\277;\343W#\360\253\033\250\016h_\374-\214\337\225\361o\034m\321\337\032\375n\214_MAU\341,\374[\307\357\"\375\347\340\302\370o\200\377\032\330\001\374G\361\013\334\027G\277*\201g\340/z\3707p\263\333\327\276\360\257Z\326-n\221\372\377y\277\252\333\237\277U\376.\321\257\346\377e\330<\2625\310\317\342\375\277C\301Jp\013\376\241\232\177\023\300\215\377\227qG\360\377\202\251\007D\345\3775\355\b4\352\223+\202\237\225sC\360g\r\374.\b\376\234\342w?\360o\004\270/\374-\r\267\305\257\262\375\237\362\253\\\376\334\376\352\333\257N\377}"
+	.string	"\241?\013\375\333"
+	.string	".\213\253\311\342\"\377\266"
+	.ascii	"\177\353\364\273+4\374\317\360\347\020\177\366\340\027\374\347"
+	.ascii	"\360\273*~\227\271\013\240\200\2378\342g%p\203~\265\375[\235"
+	.ascii	"\377\323\377\353o\324\340go\374\367\017=\374\354\024\320\317"
+	.ascii	"6\300\205\027\377!\003h\374,\323\317&\375l\323\317*\375\254\215"
+	.ascii	"\241\317\317\n\351\300\317\236\300f\375\254\217\237\305\372Y"
+	.ascii	"\255\237\345\341*o\374\207\033p\177\334\026\020\340\372\374\254"
+	.ascii	"\007=?\313\302\373\347#'?\333\344g\307~\226\354g\243?\373\344"
+	.ascii	"g\231\270<\027\300?\304\361o\022~w\307M\341&\177\326\304\357"
+	.ascii	"\266\360\253J\377\333\237\250\364\263j\377\325\177\270\365\177"
+	.ascii	"\315\177\351\377\272\377j\376\237\371\217\346o\027\360\237\375"
+	.ascii	"\215+\376V\003\177\333\302\337\"\377v\003\177\213\201\277e\341"
+	.ascii	"o9\360\267)~\226\315\337\276\277\213\374[\023\376\366\002\177"
+	.ascii	"k\201\277e\300\357r\340?\3617B\371\335\r\374.\013\277\213\201"
+	.ascii	"\337\265\300\357\256\360\273\024\370]\025~\027\205\337\235\300"
+	.ascii	"\357\226\360\273\"~7\002\277\013\302\357z\360\273\037~\327\303"
+	.ascii	"\357j\360\273\007\370]\002\374\356\004\277\233\341wu~\267\370"
+	.ascii	"\273\302\337\005\376n\373\273\354\337\336\375m\233\277E\363\267"
+	.ascii	"u\177K\367\267d\3766\356o\335\376\026\313\337Z\371\333(\177\033"
+	.ascii	"\375\333\261\277\005\373\333\256\277-\362\267>\376\026\353ou"
+	.ascii	"\374m\324\337:\375m\323\337.\375\355\214\277\205\361\267F\177"
+	.ascii	";\202\277\375\300\337*\377\366\375\333\235\277e\300\337z\370"
+	.ascii	"\333\r\376V\203\277\275\340o+\370[\n\376\226\303\337n\370\333"
+	.ascii	"\374\267\306\277\315\360o\271\277\325\371\333\343\337\016\377"
+	.ascii	"6\370\267\277\277m\377\226\375[\337\337\366\376\335\346\337v"
+	.ascii	"\377v\363\3573\377V\363o4\377\256\373\367\334\277\307\374\033"
+	.ascii	"\314\277\303\374\333\313\277\337\376\355\366\357-\377f\373\267"
+	.ascii	"\225\177\243\375{\312\277\235\374\233\354\337L\376\035\3757\364"
+	.ascii	"\337c\377\026\3737\330\277\225\374\273\353\337H\376}\344\337"
+	.ascii	"B\376\255\365o\034\377\206\372\267\215\177;\375\273\351\337J"
+	.ascii	"\377\236\361o\030\3776\372\367\b\376\375\201\177\257\370\267"
+	.ascii	"\363\337A\377v\341\337\312\177\277\377N\376\033\371o\026\376"
+	.ascii	"\215\201\177[\340\337+\374\373\304\277U\3707\n\377\236\300\277"
+	.ascii	"I\374\273\204\177\207\370\267\002\376\355\301\277A\374\233\203"
+	.ascii	"\177o\360\357\003\374\373\202\177\027\340\337\003\370\267\004"
+	.ascii	"\377\016\300\2777\374;\303\277u\376}\374\367\360\337\300\177"
+	.ascii	"\273\377f\377\355\373w\357\337\352\317\346\375,\234\237\305\373"
+	.ascii	"Y\273\237e\363\263j~\026\315\317\236\371Y3?;\367\263b~6\303\277"
+	.ascii	"j\371\3310\377j\345W%\370Y0\377J\343W\013\360\2572~\366\313\317"
+	.ascii	"\302\375\354\333\277\036\375\253\212\377)\374+\007~\326\355g"
+	.ascii	"\267\3749\004\377\343\374j\357\377\364g\265\374*\211_M\341g\263"
+	.ascii	"\374\352\361g\235\377\235\374\354\332\317B\177V\312\317\232\375"
+	.ascii	"\354\331\317N\371\331\"?{\344g\215\374l\217?\013\375l\220\237"
+	.ascii	"\025\362\263\\?;\344g\247~\266\352g\251~\366\306\317F\375,\324"
+	.ascii	"\317\272\370\331\243\2375\372\331\370gW\374,\374\263B?\273\374"
+	.ascii	"Y\027~\366\347g{~\366\375\331\235\237e\341g3\360\263\027\370"
+	.ascii	"\331\n\374\254\211\237-\361\347\243\237M\341gO\370Y\022?;\342"
+	.ascii	"gG\370\331\b\374l\003~U\351g5\370\331\005\374,\b?\353\301\317"
+	.ascii	"~\370Y\016\376\227\371Y\017\277\366\375,\002~\026\203\377q?k"
+	.ascii	"\200\237-\300\177\024\377\227\277\232\364\237\354g'\370Y\t~\226"
+	.ascii	"\303\317\006\340g\001\360\263\033~V\303\277n\371W\266_\263\360"
+	.ascii	"\257X\376U\355_\257\374\253\224\177\215\362\257K\377\232\364"
+	.ascii	"\2573\3765\306\277\272\370\327\026\377\312\342_W\374k\317\277"
+	.ascii	"\276\377\232\374\327\026\376\025\371\257\005\370\327\342\277"
+	.ascii	"\002\177_\330\357C\362\373j\374>\026\277o\002\277\357\370\373"
+	.ascii	"\326_\207\371{\310\277w\201\277\207\302\237\245\374y\352?\n\177"
+	.ascii	"\026\301\237=\360g\346\237;\360g\237?\367\374\371\375\363\007"
+	.ascii	"\177\006\361\347\016~u\350W\225\277*\201_U\341W'\360\253\356"
+	.ascii	"\257\262\277\272\376\252\357\377\335\1776\377\265\374g\373\237"
+	.ascii	"\345?\226\377O\376\237\370\325\013\374o\373\037B^^^\336_\001"
+	.ascii	"\007?\004\220\377\232\003\002\373\023`\333\177\260-\270e\356"
+	.ascii	"\n:f\215\233/Z\330\324)r0\236l\237\262o\234\311\030\313\362 "
+	.ascii	"\026#\256;'XT'\275\370\256\r\215\265 \332P\206\022&&j\301+b"
+	.ascii	"\\\236Y\262\266\342\336%U\025e\375\t\210\355\253\\\204D\005\321"
+	.ascii	"\202S\204,I\3438\016\242\345\"\252\234\360\350\214F\260J\220"
+	.ascii	"J0M\215\006\321\202g>\036rtp\266\376\004\256\366' \265\377\240"
+	.ascii	"\331s\225\227\274\032fR\240\270\3212\n\313ZG\r\325\211\260\215"
+	.ascii	"\343+\274|Cu\242\302"
+	.string	"\225\211\370\272\013:\tF\t\226\005\237\250\321 \224 \223\007\233\004\311\202P|Y\301(\007#$\275\304N*\b%\330\244:\371`\272\324u\304\327\203\n\230\"W\257d\324\343\372\t8A\201Y\226\300!\312\372\023\210\261\377\007\217\004\223\004\301\202^\301\257\240\222 \222\340\222`WP,\030\246F\203c\301\033\017:\005\237\256A\213-8\026\0042e#I\234ip,\270e\301S\234U\305\345\251\225\025\244\342\321\366\334\352\261E\207\233\224Kp,\370#-\313F\220\212\355m\313G\220\007\007#$\023\260h\221\352\b\216\005\203\004\215,\261\221$\3164\216\241\032\232\230DQ\242A\023\t\026y\202ar\322&\353K@\n\221g\020J\233T\021\327\203\3176/\336H\311:8\244\327\005N\217\"!\377\333\340\222\347\030,B\270hp\261\311\372\022\200\356K@\311\276\004\266\366%p\265/\001\034\373\022`\332\227"
+	.ascii	"\322\276\004\210\202X;\212\210Y\331\310\372$\324\004\257\202"
+	.ascii	";6\220\253\255\255\240\325\203;8\320\330\002#!\267O\342Kp\n8"
+	.ascii	"\003\351\215]\326'q%\230#(\225\217\260\251\342\025\304\361\240"
+	.ascii	"TVC\347\343L\326g\023\214\372\337\272mjh\331E\005\241\346\274"
+	.string	"\200\231f\035\204\n\336\200RTd\224\365ID\331'\301d\373\240\252\316z6\365\270\236D\221}\022Y\373\0172\005\2276\270\"\244G\326\301\245?o\005i<-[\205\221\232\322#\353\034T\312<TDE-\t&\005g\300\320A\326%\353\340\214\247\345\035\203\r\234\273\254\377\240\214`\f;9\036bA$5\032\214\021\204\021\214\221\227\324$K\301\250\022\2505\255OB\307\376\203/\202.\314|\244u\311:\350\"x\264\006\t\0214\353\240\021\027\231\030lY\237D\323\376\017\204\023$\002\346\005c`\0345\032,\002\342\265e)#S[\362\2742\326[{\232\360\210\030\317\200!\366\f\026\001\337 \300\356\n\353\013\315\024\2307\240>\t\245}\023\362\366\017\274\313C\234\310(\202\262[\223'\305\032\233\272\001B\331\342\246d\335\246F\223\032[\3267an\277\2035\3009UN\330\004\215\233X380\336\324"
+	.ascii	"\245@4\3004@6j\024\270\006h\006xF\205\306Heu1`\274M\345\342<"
+	.ascii	"\341\224\331\312\203\3616]\003$\243\332\tA\202\361\226\003\013"
+	.ascii	"\227\026P\337\204\265\375\003\351\376\326\345\342\006\3073\353"
+	.ascii	"\233\200\266o\302\327\276\t@\366M\320\261oB\323\276\t\361\376"
+	.ascii	"\201czJH\320\242z\3045\205\211\2300Bk\304\344\300\034\030&\323"
+	.ascii	"I-\001\22250\356\303\201`\204J\210\250\206d-\001\360\013P\f\350"
+	.ascii	"\005\230\004\b\327\305\030\267\266%\3537\037\235\031\032\226"
+	.ascii	"\254?\302\214o\n\022\240W\336\263M\t\320\253\027e\332V\342\342"
+	.ascii	"\240\205\001\307zQ\246\235\326\004\3177\305H\f\337\224#Hm@5`"
+	.ascii	"\017 \221^\224\311D\326\fi\032P\rX\344kY2\236fvY\200T\200l@,"
+	.ascii	"\300-@-@.@7`\025\340\025`\033"
+	.string	"\320\npM\215\002\325\200S\016<\003\242]\203\251\001\243@)\275(\223\nM\356|hj\300/8R(@5`V\024t-\223\322v\307A\177D\226\375\013S\217\353G4\331\037A\004(\345\367\241\001\241\300(\331\207vw\005J\326e\033\334\261\271\021Q\373\t\220\t\033\327\2132\2652\260\314H\201N\200P\324(\360\t\260\t\360\t\220\2145\243\223\34682\256\266\254\372#f\354\227\220f\277\0042\373%x\331m\254\352\254b\300%>%i\262\246\262~\teb%x\355\227\220\265_\002\323>\tk\200]\253R\222\270L\326'\001\0130\t\t\321}\022~\354\223\260\264/\342\315~\312E\341rd}\021p\373j\230\217.@\2557)\227 @ d\244B\200\\\300!\300-5\n\f\002\374\241\201AZ-6nq\310aA\271\372\"\334\366E@\367E|\355\213H\262/B\310\276\b\254\375\003y"
+	.string	"\247\214<q\203\272\201\343\031\245\364\204c#\207\223\2169\250%)p\n\210\0038\005|\372z\372R\304\nH\005\334\001\304\002\352"
+	.string	"^\001\253\324(p\n(u`\016\225K\257\315\230\025)Q\273\352q}\b8\373!\246\373!\322\354\2078\263\037\202\314~\b\270\375\020l\373!\252\354\037X\003\310\304\243J\222\267\254\201L@\032\252\334\364\t\214m\332\244F\201L\300%\rA,\253\030R\264~\b\036\373!\236\366\017T\272\341C\0134\353\253]\316\350\250X\351\002G\212z\226\335<\241\021\305\256w\264E=K\003\306?3\2771?:\340\321\257\356w\367\213\003D\372\221\001\022\001a"
+	.string	"c"
+	.string	"\215~s\300\244_\231\337\031\340\214\037\034\240\214\237\024X\364C\363\313\373\255\371\341\375\246\300\027?6?5\2774?\273\337\233_\233\237\334\317\215\032\005\272\370\201\371/\314O\f\223\030R\263\236\r\025.\252\001^ujewR-\240\213\337\022U\216\306\223\fK\233\0238U\272Ha#\373\360\346\003b\246\205\r\350\342\367\345\0277\366\204\213\362lC\223f\331\"u;{r\361\001\231Bc\315\355J[\223\2649\251ZTk,i\212\027\365\254L\272\005t\361C3\003\005\350\342\007]o<}1y\3051\264\025\003\206\f\330\t\272\007Uu\326\020\324\343\372\021\330\374\342\3243\326H\036\2154Y\177\204\272\375\021\270\354\217`\266?\002t\177\004\035\373#\274\330\027a\315\276\bl\373\"\230\355\213"
+	.string	"\335\027\341\310\276\bC\366E\310\332\027aj_\204\244\375\b\254\331\217\200\333~\004\242\354G\340\271\037\001\036\373\021\210\332\217"
+	.string	"\322>\004\322\354C@\314>\004\324\366!\360\265\017\201\034\373\0200\332\177\300\334\376\003\320\366\037\200d\377\0019\366\037\240\264\357"
+	.string	"8\373\0168\263\357\200\267}\0074\331\377O\354\027\3263K\023\213\372}\375\300\324\350/\354\247\004\3525\366\301/\354\327\365c\002\202\211\255\311X\365\035pd\337\001U\373\016H\332\377/\tVU\023\245\254\377A\0179,\2729\036f\256:\360\241\236\225\021\362\033\362\013\362\343\372\025\371\035\371\031\371m\375\220\374\210\250\321\337\363\247\365\337\217\037\020\032;\352~\317\237\016\023\332\330\375\236\277\247_\225\n\247\245\337\356\244wV> ]\236\277,,Kc\3024\226:-W0h\365\251\352\254\030\324\343\372\006\274\3557\200\312~\003\232\3547\240k\277\001Z\373\r\210\332o@\214}\006\300\331g\200t\237\001d\250zb\\\270\020\311\372\f\300\262\377\377r\374\244\324\350o\352g\343\277( g~S.Z\266\241\302i\351\2572\253\0215iM\253\276\332\305\314\017\352\207\343wC\215\376\242N\367\213*\262"
+	.ascii	"\313\022\030\225i\006\315%Yx[\237\001U\373\f\220\261\377\237"
+	.ascii	"\323O)\215\226\032DY_\345\362\246\214t\356G\344F\026\273y\352"
+	.ascii	"\331\333\263\310\007\344\027\343'\343W\343\207\364\233\361[\372"
+	.ascii	"1\375\232~4~0~Ij\364\247\364s\361\337\213\254"
+	.string	"\366\374;\322\362\214\323\345\211\347\003\"\347\336\371\200\374\224\\8d\244?\245\237\321\221\245\256\365\352-\256\215\006-T\217\353\027\300\266\277"
+	.string	"\263\375\005\200\355/`\310\376\002\252\366\027\240\264\257\200\274}\005\320\355+\340m_\001V\366\025\340d_\001]\373w\355V5e`h\264q\317\334\267\036\224\312F\303\242\222\266q\273\270uX\b0\322\004\257j:u\335\270k\\5.\0335\352\266q\323Lq\333\270h\2148\341UM}oF\214\340UM\333\270\322\016\260\360\252\202ZZ\316\254"
+	.string	"\365\025\260c_\0017\366\025\020\343L\231\224\027V_j\346\\3j\324\245s\341\3202\017\025N\313\204\2576i\034\307.\235[\305\225S\341\264L\210\343&\325H\330\214\261Yu\231\f\2241\025\313\372!h\031\343\206q\305\270`\324\250K\306\375R\026\227\366\214\343\230\314\331\323\013\332\323%\343Z\311O\037D-a\265\231\306q<\214qU\205\306\325\017\241\307~\b2\366Cx\261\237"
+	.string	"\351~\002\310p\331"
+	.ascii	"l\023#%\316\372\tP\333\377\3356w\213\032u\335\\*U\\-=(\225\235"
+	.ascii	"\206\225$u\335\\47\rk\306\323M"
+	.string	"\003Dj\325l\032\202>\254\220\350\310\372\t\b\333W\273\250\345\247\274\247\233\305]S\243.\026\367J\007X\\+\371I\205\323\212\365R\034^\225W\034\307\031h\310\240gG\306E\272\352' \311~\002\256\366\023@\265\237\200\033\373\t(r\323\310\234\340\312\340\310\372 \304\331\007an\377\356\024w\t\221$GKY\277\003\036\371)\353N\nd\n\312\022\331\016*\025\f\215g\230\026\026\236\264\307T\252\226]\305y\n\341bc\314\217\035%\243\226\345\200\202\303\215\272^\256\230K\304\rs\225\270cn\024\027\212\333\345\036q\301\3342\267\211\353\3045s\213\270d.\022\367\211\373\345Jq\215\270P7\211\313D\215\272K\334!w\271\334'T\325\026\216\034R\265\314*\306\0173Rc\244\266nhU\251`\240$I\203\370\250S\313t\344'\0302\236\037\334%\356\326\207,\273\347\226\273\304\215\022z\365\340\232\200\275"
+	.ascii	"Ag*\252\316\232\201z\\\017\302\333>\bb\373 l\355\203\240c\037"
+	.ascii	"\204\245\375\017\342\354\177Pf\377\003*\373\037\200\355\177p"
+	.ascii	"\265\377A\215\375\017\216\366=H\263\357A\227}\017\316\366=\370"
+	.ascii	"\332\367\340j\337\003\032\373\035\334\355wPf\277\203*\373\035"
+	.ascii	"8\331"
+	.string	"\357\340\310~\007T\373\035,\355w\340b\377\356\223\353\344\004l+\214[\303mr\227\\&\227\206\032u\235\\\245k3\031\316U$\367\213F\327s\032cj\206\324SF\216\247\353\344&\271Eht=\275\244$\031\263\003\250\017bm\037\304\224}\020c\373 \204\354\203\210\332\007a\264\177\027\206\373\202\t\2172C\262v]\374\214\272TYe\375\017u\373\035\250\231\223\366\244\204\2758.\242{\312\331\265w-\034\267\250u\323\346\265xn\334\306q\215\3327\355\324=R\243.Q\273\346-\233\266\315\263\2333u\322\017.Qk\306%j\353\364\227K\324\222i\313\250pZ:\354\215\024\r\335\030\265\314%\352!\365h\250pQ\372H\034i\034\307i\346\236.Q;\367\301\032\032C\216d\240!\210f\nL\020\016:3\251:+\001\324\343\372\017I\366?\f\331\377\220\265\377Aj\377C\215\375\0173\366?\270\330\347"
+	.ascii	"o\237\0033\373\034\260\355s\020-\243\202Q\207k\204\334\005\311"
+	.ascii	"\372\034$\331\347`\310\376[1J\322\304\262\262\316>\254$\341\271"
+	.ascii	"MW0a\242\320\244a\335\204\360\202\251\225a\004\346\f;M\302s\233"
+	.ascii	"\206\201-1C\327\3664\0161\342\230-\307J%\t\317m:}\013e\361\366"
+	.ascii	"\217^\224I\002M\224\260V\256$I\302s\233\372\250P}h\303\324\252"
+	.ascii	"5\214-\202\204\235B\346\031\307\361\031\032;\245\027e\232\200"
+	.ascii	"Q\027\251V\227j\327\203>\331'XB\244q\f=#\035\223\016\341b\205"
+	.ascii	"\304Xf\236q\034\263O\226\b+\244h\213\305\222\204\347\266\345"
+	.ascii	"\305\266z\371R\004\013[U\022\336\n\006\272\216Y\3458\304\210"
+	.ascii	"\343+1\227Im\355H\022\236\333\nf\025\343\336H\302s\203\356 m"
+	.ascii	"\222\020^0I\240\t\227\224\016L\035\333&\t\317m:\247\332\305I"
+	.ascii	"\302s\363Z\301\254fT;\034\354\2333uLIxn\323\026\332~\371\322"
+	.ascii	"r\254jIxn\323*\\V\351[\350\252\206\025\022\302\013&\t\304\321"
+	.ascii	"IY,Y\330)A\330g\022\236\333t\365\002]\343T0\034\\\304\261U\225"
+	.ascii	"+\225\204\3476\325\322B\331-\354\034\207\030q\\\244\204\215J"
+	.ascii	"\302s\233\266\320V\t\226$<\267)\233\006e\251\260S=(\2218\346"
+	.ascii	"1\204\rK\302s\233^i\311Z0mZ[\2455k\245\264g\355\227vJ\373\244"
+	.ascii	"\305\322\256\265[Z-m\264\205\322ri\251\264NZ+m\223\026\256\215"
+	.ascii	"\322fi"
+	.string	"\343\332\267\026\255ek\325Z&mY\033\246\355\322zi\333Z75\332B[\261\267K\3321\027\017\313\n\323\tZm2r\340c\237\203\250}\016b\354s\020\357{X\263\357An\337\203\225\375\253b\033\310\336j\221\200\321h\023\313\372\b\323\227\274\260\254\357\301\311\376\337\022i\213\250\321\326H[\343\255S\373t\324\032\331\\mS\b/\230F\304E\265FZ\033\355\263\027e\232@\034\016\251v\n\203\201d\325\\[\306$Qe}\017FvV\273\325\002Izn\265Q\255\217^\224i\004\326\207v\253\325zJ\302s\363\032\322\ni\203\250\321v\253\375q\224\201\006\002PyB\267\276\007\254}\017M\373\036\224\366\237\231\332\033-T\333#\373\332\306\242\250d\235\345\2761RC$\353{p\261\337\301T\016\031q3\252\236`%I\303\244\332\253VG\273\243\305jy\250\321\326\252\245jk\255Z\034OsA\206"
+	.ascii	"\"F\330\252/lT\200\372\036\210\366;\330\355wH\263\337an\277\003"
+	.ascii	"\230\375\016\\\366;h\331=8Ugm@\207\263\215\241\003t\263\371\361"
+	.ascii	"x\213\001\225u+c\227e\033\302\"hL\244\200&n\324\274r\322jF\215"
+	.ascii	"\0335\257V\306>\323\223R\341\242\342\270\311\2031#n\324\246\373"
+	.ascii	"y\244N\272\221\2642v\222\335\325\203R\031\201uf#\361ji\354"
+	.string	"\273\315f\273i\225\332\244m\327\316hc\3547\273M\273\264\363\332\027{M\353\242%\332qv\335\226n\274\235\246e\332j6\2346\336hZ\243\266\250\205\261\247-R{\244F[\031\254\232o!{\210o\312z\004\213\307&\003&\235\262\267\\5\240\353J\007K\342\270@\3253#\253\220M#\356K\252\265\266\305\215I[\031>6+\026\007#\2448\256QAW\317\307\216b\271Q\223\342Ks\2436M\332b> \036\200\305A\371\272\2009\271Q\233f\037\2764,7j\323\244V\206\357\212\230\223\033\265\251\224\22287jS\"cXn\324\246\033\311Z'\326\304\215\332\264\225\261\333v\\\003\272\232\3200b\344Fm\252d\207q f\344Fm\272\237E\306\234\334\250M[\031\233\001M\334\250y\2652v\224<\004\313L\252\225\261\241\344'\2543\251\331~QF\366\304(M\032\307\320V\306f\262\235\324@"
+	.ascii	"\230\221\020\213\2222,\021\372\035\220l3rM$gv\350\230\223\353"
+	.ascii	"\001\221\226y\226\371\226#\2323\033#f\217\t\323\"\261\021\305"
+	.ascii	"L\326"
+	.string	"\357\020C\314w\0301ahm\262\336azl\252z\by\033\213\262\221\226\365\376\242\036\301\333\240n{\331p\354\221\035\223\267\335\345\033N\005;\023\347&\353\315e\277\375o\367s\211\310\305~c\327\260\265\305\221rk\321\204\351\242\345\226E\004\r,\353o\340eS\321\320\203r\244d\263\251\321\255e\237i\330Z6\332\316r"
+	.string	")\2453S\3008\206]\025\255\377\235\345\033\013\r\032R\244\254\367Z\353\366dCK\326\337\240\310\376\367\0255\272\325\316`\260\303H\215\254\317f[\371\337f\037a\352\356\262\376\267\225]\205)\206\202#k*M_\230d\375\r\254v\332>\313;\212\3004e\375\r\250\3667\230\261\277\301\213}\004\264\331G"
+	.string	"\335>\002\266\354# m\037\001M\366\021\240\244\311&\353A\321\264|\311\372\b\330j\202"
+	.ascii	"\035\373\bh\332G\300\321\276\006h\3665\360\262\257\301\225\r"
+	.ascii	"6\204\033\202\005-\353k@\266\2774\350\332\327\240\307\356\312"
+	.ascii	"6T"
+	.string	"\253\351\226#I\262\276\006R[\325 i?\2038\373\031\244\331\317\340\313\316\361\226]\214U\23553\245m\004\304\252\316\352\203\252\307U\253\253\t++\353g\300d\263o\262\366U\034\366\315\316b\343\274\221n\037\233\307\356\261\261\324\350\316\332;\316\332\261w\354\233,\026\016\034i\034C\263|a\266\225\023\005m\224\270\330\246=)Vd\310\\\375\f\222\354g\360c[\375\354\0336o\353pg4\261\342\221u\225\357ER\022Z\326\317\340\306\376\277\243\366\324\226\332P\273\306\316\261\233\366\215\375\264ml\247\215C\215n\252\255\364Mc/]\307nJ\\l\323\254#\021ar\322;\":i\034C\223|i\033x1Y\360\246\304\3056\315\332T\273\310\214\026\222\257\210\314S\306\333s+\206\257\250\313sS\355\031\2764\025\256L'\341\"\315\332T\333h\356\271\2516\214\375\242I\001V\224\270\330\246@$5E\224"
+	.string	"\240\177"
+	.string	"3[OQ\217\353\017\240e\377"
+	.string	"V\366\017\020e\377"
+	.string	"`\373\007\020\262\177\200\254\375\003Dm\027\300\242\033h^\262\376\001\226\366\017\020\357c\300f\037\003\271}\f\276\354c\340\266\217\030X\331\307\340\311\316c\373\bUu\326\354\245\036\3275f\335\260m\312\240U\220\262f\323\363r$G\226\254\217\001\2225\254\232\365\253\316\210)\353c\260\265\217A\325\336\030\304\330\277"
+	.string	"oo\350\005av;'\227k\340x\242\225u\231\r\353\214(9\306d\375\013\252\210a\307\250Q\226\f\013\206\f\333\306\306\251pe&X\231c\311\260aX\263\032\037\330\222\360\334\246q\034o\310 \003\241\326U\232\250U\377\002\036\373\0270\355/+\214Y\002\225\365/8\332W\311\336\226<\273\260nb\254\027\026N\215\262]X.\255\222\035^/V\375\013\212\366\r\320f\337"
+	.string	"\322}\003x\3317\200\225\335B\227\354\033\200\310v\237T\373g"
+	.string	"\246\375{\336\355[\020\267\201V\352q\275\005j\033\370d2\302\036a\315r\017\267\273\250\254\245\3543 X]Y\337\002'\033L\213\324+\007\225\260\256%[>|i\331\032{\333\"\226D\213T-K\242>\261l\221*y\232\260\215c60*\254\023\266\t\013\205-c\231\260O\330(,\224%S\243l\224]\302F\331\260\247\251pe\261\213\250\003\212$-\2612\215\343\370\027E\005\211L\216\276\005L\366-0\262o\301s\337\002!\373\026"
+	.ascii	"\331\267\300\307\276\005<\366-\330\261oA\325\276\0059\366-\230"
+	.ascii	"\261W3\352q\r2\271\331\302\n\302\354\341S=\256A\252@{\034\311"
+	.ascii	"\372\025d\331\357`e\203\307f\301y\262@X-v\213\365\301\366P\243"
+	.ascii	"\354\017\226\307W4k\232k\360Ma\177\254k\260\336\374X\335\260"
+	.ascii	"I!\274`J\001\353N\372\203\245\301b\205\360\202)\005#;i\006\033"
+	.ascii	"jL\252\016\250_\301\331~\005c;K\261J\354\325\317\016\032%\203"
+	.ascii	"\263\032\211\203t\205\325\301V\261T\254\225\032ew\254x\317g\031"
+	.ascii	"\215m:]\b/\230\332\027qm\3228\206\262;\326);\025\302\013\246"
+	.ascii	"vF\2237)\273\203]\342\302\356`\231\334\244*\234,\322.\256\226"
+	.ascii	"bs\340h\241(\211\211\223\365+\030\"\305\342@\242F"
+	.string	"\r\225\254Y\034i\301\2607'\244\254\331\032,T\321\034\034\033,\024{\243\rY\324W\3266\342_W\230\225\247\254_A\026\373\304:\001a\374\300\222$\353W0\265\317\346i\377[\025\t\232\022)Y\277\202\247\375\n\224\366+@\332\257\200h\257\261\252\223\263\3266\354\f \227\215\250\256\254e\3345\005I\222\365\013@\267\377\2630X$5\312\306`]\2601\326){\024\302\013\246v\311\310\214\224\215\301\276\330\222\264\304\212\227\373\244\252\n\330\252_\200'\373\005(\302\032U%Ab\225\365\013\220c_\215\262E,Q\221\232\031P\262f\211|\321+5+Y\257wk\336\377\226\355\"3\002\227\027\007\216\007\224\223\254\341\260g\222,q\223\365\013\200\264\337\254x\302\251\257X-\353\023\200\315^\355\216\366\277\035.e\325\260\221\365\331|\355\177\253mT\001\343\222\365\t@\267O\2000[\307\252\316z\002l\331'"
+	.string	"\332>\001\276\266\253\245\036W\"\001\200\354\023\300j\237"
+	.string	"5\366)\230\356S\020\267\226a\355f\200\361\222\365)0[\311P \266O\301s\237\202\036\333\030\253\307\365\024L\355S0c\033\231V\270\265\3133N\203\313o+\0275\272vY\335\362\226\374$\365\\\273\254m\371i-\222\344\343\313\213\20563v\253\376\004j\373\023\240\355O"
+	.ascii	"e\377\253\226\225\315EX\0322Yg\201\316\270\201\007'\353O0d\377"
+	.ascii	"\203\2640*`\317++\226uM\215\256jk\225\243.j\253\025\365\214\203"
+	.ascii	"Q\034WQ\255wIWT\200\310\206\354\330\372\003\300\333\037\300\227"
+	.ascii	"\375\001\260\355\017@\312\376W\264\325L\013\301\301Vd5\313=|"
+	.ascii	"i\302#hL\264\322\251\301\253\232NY\315|gFxUS\326\263U\312\032"
+	.ascii	"E\215\256f\353\223\257P\326\262#\037\332j\346\243r\346\031\307"
+	.ascii	"\320\325\314\227\265:!b\317\256\340U\005s\324\211\331p\365/V"
+	.ascii	"uV\365\251\036\327\017`\307&\213#$\306\222\254?\200\250}\225"
+	.ascii	"\254\213\021\032\\zJ\030\\\271\342Fm\252\265v\371\324d\033=("
+	.ascii	"\225\021YQR-\037\030_\032,\f\2568\271Q\233f\371\256\370\266d"
+	.string	"\351xB\255]\353\021\337\026\247\n\326\214\334\250MW#O\353E\2310\274\b3#\253\313\007\347\213\353E\231\266\231\013)\351\332\345c\263b\205\360\202I\002Y4\326\304ED!TQ\343Fm\232\265v\371\336\2564q\2436\025\262\026i\342Fm\272.Y\307\326$+\223U\311\332d\r[\241kt\375Z\301V$\253\327*\246F\327\2565\353\276*>+Yk\227\257\315\347\246\302E\305ED\036\\\211s\2436\355Zy\254A8\030!\305EX\030T\271\342Fm\032\307P\237\017\"H\\\002\320\027\300\227}\001dy\256D\270\266\2200SjL\236\\qe1\231!_\271~f\225#\302r\007\266n\375xs\243\nW\326\027@\217}5\272\002\371\221\317\216\304\230\242\365\365\207\035\220\003\360\316\355\355)\353\263Y}\374o\205b\226\244]\311\372_}\364\020*}\211\257z\254Ym\0332p\300\262\276"
+	.ascii	"\250\366\005pc\275\312sbPO\262"
+	.string	"\276"
+	.string	"d\350X\255\324\350\272\303w\247a\335\341k\343\263c\313\250\331\341\303[\251T\270(b|t\006\216T}\202%N\232U\2574V)3\317\2515\307Z\245FW\252\307SV*\337\233\325\205\220\250\030\307=\336<\251\326\027k\222\360\b\032\327X\353\214\346\2446d\220\301/)\213\212h\353\377k\324\212C\215\256R+T\215\365\206\320\fkNj*\265.\255M\034\214\220LP\233\223\356+@\324~\254\372\022\304\331\377z\303F\2144#c\262^\237\\\033QpjY_\2024\373\277\032]\235\256\322 \342\242-\353KPf_\215\236ne\372\031\275\345vC,\353K"
+	.ascii	"f_\002.\373\022h\331\357`M"
+	.string	"R\347\326\030*\\\231\210\2673\353\214UI\215\256I\253\2145\311\007gK\235T\310e\004Ll\325\227\340l\353\256#(\\V\244\025F\034\f\236\241Z;\222\365%h\262/\301\330\376\277\032\255Gjtu\261\026\255.|qV\"\016FH$\252\356\244\253\013\037\234\037\227\2219\251i\034C5d\220\001\313\303\312\030\220U_\202\247\375\257Dk\214\003\351\354\r\324\227%\n\214\0205\352\313\363\335\305\032~r2\3423Y_\002\245}\t\\\354sx\263\317A\315>\2071\333\215o\n\345j\211W\326\347\300\305\r\207\265}\016U\3669H\331\347\320d\243\3210t\242\202\202\224\3659\f\331\357 \214\217L/\312\264\245\370\340:\343\223\252Q_\235\257\214\257\316'\347\243S\341\312\342\"\247\n\334\030}\211\232J\231\342\335X\365\234\317\314p\206\020\030[\322\2710\373\001\240\"\3067&\327p\002\204L\214\330~"
+	.string	"\200\370\276\304\265\271\213\221\365\003\340\363\022\200\032\373\001@\332\007"
+	.string	"\336>"
+	.string	"\316l\237\333\325\263\026\342\f\305-L:\306h9\342b\354H\326\007\300\225\375\337\227E\215\372\330|jl\2765\037\026\025\256,\216\233\020\240\304\311\210t\252\346h3\352\2425\226\373\3222\22525\220d}"
+	.string	"$\331\007\300\325>"
+	.string	"\234v\013UuV5J=\256\007\300\213\355K{Z\316]\320TM\263V\231\314l\325\312g\346\203\362\243\"\006\315\333\216\251\216;)\024_\025^\231/\212\357\211O\212\217\314\347D\215\372\240\370\242\3671\3615y\206\306\361Q\246ae'\365A\361e\371\240*\234\226v\213}P|Wu\355\225\247#>\204Z\205SuV\016\352q\375\206\267=&L3\305\352I\326\337p\266{\224Q\311\206\270\371 \363\364!\361i\371\266\204\2758\346\321\3459\307\325\366\334\002G\b\027\265\314\b\022_\2207i\227o\211/\314\007\346K\342\363\362\211\371\276|J|G\324\250\017\211\257\310}X>\036>$>\"N[#\216\210q\203A\177\203\216\375\r4\3667\020\355k\220\356kx\333\327\220\266\257!\032o\272d}\025m\204\b\311\341*2\00565\r\266\345"
+	.ascii	"\313\033\362\034\256\fyp\254T\260\345l\345l\r\347\224<\353\334"
+	.ascii	"\360\324\310\264\262\276\n(9<rx\344\374\260\200\221\021\251W"
+	.ascii	"\231\021\031\255\347\374\270\021\343\352*\353\034\037A!C1d\220"
+	.ascii	"\020\311:"
+	.string	"\247GP\210\026\220\251$Y\347d)\271\272:\336\325\240\272{\362zr\223D%\353\253\270\312\301\221\203#\307JM2\0056\345\325\316PsF-G\307s\254\350\236?\240\262\316\251:za\263\222%-\353\034\252\234\034_`Y\347L\345\344h\251\246N\320d\235#\225\223\003\254\216\255,g(f-Kl\306\220]\016T\016\324\221n\303\223\026\273+7\262\376\320\227\034\247\034\247\034\033Y\230`}y\261jWVCr\236\236c#M\212X\036\333\220Y\016S\016SN\223\030\264\316mM\222\322\233\246\250-\246\254?\364\225C#\207\206\321\007\030\0231_\3005H\2704e\375\241\253\234\03193r\222\304\212\210\371\022\272\241\373\272\221\223\244:q\261DKI\326\037b\312\211\221\023\303\350CJ\370$dBJr&\353\017!\275\3711\357M\016\214!\322\324\332\324>\305Y=\311\372\317)z\016\214\347\274"
+	.ascii	"\361\301\327\246\220yje\235\343\342\352\0175O\220\262~\316QK"
+	.ascii	"\304\314\2248Y\347\030m@u\267\343M\016\321\353\200[\252Lsd\235"
+	.ascii	"\023\277.8%\2525u\214\003g\210h:=\336\305\361)y\271\312b\367"
+	.ascii	"\343\235\236\343\302\306\n,W\246\314\261\315'`\247\252\304x\365"
+	.ascii	"f\354\250\021\246\315\221\215\333\233\333[\326\3075*\024I\002"
+	.ascii	"\207\251A\203\346\267D\203\025\261\001\315\372\260V]\335p\356"
+	.ascii	"G\205*o\n]\222Be}xIN\356H\027\366\314or\330H3\363#\035\260\315"
+	.ascii	"(\212(\353\343\\PH\333\246\310\232"
+	.string	"8k\302\2049\222\271s\207t\3312c\314\217d\240\274M\215d}\024\263\335t\226\266*q\226\267\267c\334\007G\246\300\246\246\2768D\2368\276\374\030W\274\002\232\201+\352r\364\362\342\312\016\214\027\270\2733vLz\230M\311\226d\335\245X\325\203\343\022\025\223\365\235]lg;\272e\005`\251\002\273\341\353B\212\203\341vl\243\201'\227\326v\334b\367$z\364\266\353\220\270\356\262>j\001N\261\213\0215\223\365\235LjjG,\354\323\323\227\"^=\2714;\342\254\375\210E\203\257\032dN\"3\263\243\225\225\355\351K\221h\322T\356X\345G+v\276#Yh4e}\244r\\b\306\213\306\221\254\317\346\230\366\277]\001\t\233\225\264#\232\0276U\236\262>\236M\265Q!\222\365\233m\366q\nPJ\353\240\202b\313\372\315/M~\204\322\344\030\205U\323\360\343\210WeDm\032#Ma\260"
+	.string	"4$`\312~\214r\2675\317\t\225\253\343\023vL\2306&Y\037\235\370r8\315\035!\373[\240\226\333[\232\254\337\f\262\337\314\212\376\321\343\030\261w\024W)y\276P\"v\225\365\233Qbb\3071\016k\252\270\246y\313\233\022\3648v\\\002\3656=.!!I\216\271\254\357\0019%J\216`\030\244\251\032\3425\375%I\241\253\361\365#\230*\367\342\253,N\326\036\360:r\344\330\245AJu\367$\324\3216v\226\344\307\256/`k\250\262>\"\321rXQ\316\230<\240\343\307\217B~\034\213\f\313\3248\216\2622:\212\253t"
+	.string	"\240\313\352\203\210\225\220\343\220\037\213\374H\004\304\007F5A\032kWm\262>>\217\\\307 \277%k/\342\262>n\251=h\300}\001\362\267@4An"
+	.ascii	"\311\372\036\220\332\367\200SV\326\321\207\032\006u\325\306K"
+	.ascii	"\335\022d.M\217\037}\254\251n\216\254\001\242\345\206]x3\304"
+	.ascii	"d}\241\274\343\216\343\216#V\316\333\220\210\023\326\224\343"
+	.ascii	"\325\217XkKmrbY_\313\005\303\270\306\274I\245\244\216:>\201\321"
+	.ascii	"Q\\5\266JA]\265\231n.]LCr\374\250\343X\365\303E\217\266\254\217"
+	.ascii	"Tl\322\220(q\326\027\262r\234\022\"b\303\3061j\303\027\324U\233"
+	.ascii	"\237\235\016\250\347\021\352\307\2503\301\247\2436)Y\037o\350"
+	.ascii	"4\301\274\273<2\241*''#\217\\\201\022\246:\267\0373\351\227\254"
+	.ascii	"/\304\324\3244\234\023FQ\345M]*Ii\256\314))\035\227\\\246\251"
+	.ascii	"/a^B\351\f\272,4~\\\n\262q\002\267$\356\030\343\030\3438\203"
+	.ascii	"\215\353u\303\310\233\251\266+\253AD\306\2173\206FH\202\234\t"
+	.ascii	"\237A/"
+	.ascii	"\27208\252\270pq"
+	.string	"\204\001S\335=\t\323\310\274\260^\374\bC\307\215\211!#\267\276-\275\271Sr$:\022\035\215T/\250\2536^q\034\205A\017G\225\2558\353\377X\244F\217F>0+P\2503\037V\0333iY\237\271\005\347\207c\314#\0221\211\2274\264\241\272{\022\336\350\001%H\234\033\363\244\304QA\226f\214s7\326\315\031\361zbT&\n\300\243j\263e\032#Ea\020\224z)sks#\336\215w >8\235W\0221EY\033\355.\214\342bE\232\365\215n\214\323\277u\215d\221ue\375\345\331\376\006Ln45emds\272#tIh\2626\256\371Z\324\230\251\217\254\317\306\250\346\177\333{\303\2123\312\332(5\242Q\243o3\2469t(\264\002#J[\326_>\331W\337\266\216@}\333j\244\273\361\314\337\266V\252\262\256\262\376r\311\376\215f\376\226\225\"&\3073\353/\225\354/\213"
+	.string	"\235\200N\30629\216\262\"Bs"
+	.ascii	"&\2524\030h\242%e\254\2626\2261\222\261\303a\005'k\343\030\236"
+	.ascii	",(jY\177Ic\377\3060\3060C\266\tb-b|\0247\245\0223Ei\300F\371"
+	.ascii	"\202d,\353\007\335\211\335Hftb|\242F\215b\3068\035\033!E\305"
+	.ascii	"N\031\304\211\t\357\242vP\262\376\302\026\215\021\243%\353\007"
+	.ascii	"\321\355\253aP\214Q\314\030\245\314I\317\214i*\234V\004\222t"
+	.ascii	"\221\372\340\030\313\302\344\332\214U\214l*\\\0241>B\233J\343"
+	.ascii	"86\266\031\247\220\341b\364b\2043\276\031\267\030\335\214]\324"
+	.ascii	"\250\261\315H\345F'\306'\327`l3\232\r\327\200A\201\"j#\224\323"
+	.ascii	"q0B2a\311\031\2511\213Q\213\0325\262\335\310\266\321\214X\024"
+	.ascii	"\360Fu&\315"
+	.string	"\206\f\202i\300\220\311\261\352\337\210\305\2706\005\352CM\326F\265(\2506\027Y?\350l\377F+j\324xe\263\361\252\202w\272,@\260\240\354\007}\031\321v\030)\325[\326\017:\262\037\364\334\017\372\261\037\304c?H\307\376\215Q\214ed[\326\274\225qI2\312\372A9v\206\252:+\006\352q5F\215M\206_Tz\230e}#\223\377m\n@\272\230e\255\241\271\215\353\251\224\365\215cB2C\242D\263\276q\211Y\336\032\034Y\013\317\366\213 \245\013\\*4\0359\262>\020\033#\221\033\277\214D\214`9>\212B\235\204FcS\032\374\326\224y\363\225\265\026\2036)\223\265\261\313\250d#\375m{%)n*\353\033\275\264\276\bA\222uV\277\266\032\221\334\230\344o\3310\246\243(Y\037H\272o4b<\362\267=8nWbd} 2\373\306\"\377\333\021\314\355P\222\2650m\277"
+	.string	"\322rA+\307\204n+\353\003}m#\227\221\213\270\264\343\r9\344\202Dm\242`\311\372@B\366o\024b\024\242\312Y \366\005\353\353\027\305\013\024\035Y\037(\307\217\037\306\25561f\\d\214@n\334\212\233\222\005Q\301\214\031\211\352\221\327\243\207\321G\231\034i\302/=\3060\361\001\306\335\212\276\330A\207\205e\344\221\255\342\030\372\"f\021&G\024\251\031\235\224\254\254\215<\316\3124y\211e}\027\330\266\261\312Xe\334aB\254\223#LU:k\022[\335\270c-\354\031%L\326F\035.@s\030\245\214S\302*5\256\021\2531\3128qI]\b\262\357\302\r\0348\234\2420P\241P\371\"%\353\273"
+	.ascii	"c\033\241\214P\304%\rW\206@YCeI\326\357\200t\333\2601\2343!V"
+	.ascii	"\271\264H\231=\265\262~\007\266\030\233\214N\306&\342\222\261"
+	.ascii	"\206\261\006qi\255N\332E\027\225\365;`\266\337\001$\306%\343"
+	.ascii	"\222\003\234\222\236:\214JF%\242\223\332$\004\306\233W\007d\030"
+	.ascii	"g\030g\344\211=\315\304\210A\\\312\373\201\266\177#\f#\214\375"
+	.ascii	"\202KL\251d\033]\030]\020\235\3248\256\"\246\264\3023\032\341"
+	.ascii	"\031\213\336\2741\026i\2003\306:\361\322f$\272\261\210\375\241"
+	.ascii	"\006\313-kc,\364\221\224\006\306-\3577fII\226\274b\034!F\314"
+	.ascii	"\304\200\2127l\255\251(7\340\b\2216h\272\034;\306\262\276ri\377"
+	.ascii	"\307\215\235\235j\247a\352\347\215M\321\r\2336m\252~\320\366"
+	.ascii	"\177\272\324\250\341\372\261*\242)\242\211\262\243+\326\321\235"
+	.ascii	"9\343\301Z\222\317\334\276\017\2262\305\2712D\2475\216U99\242"
+	.ascii	"\323&\3420\226\026\205\001\020\251\315lM\326\367\t\333\367\311"
+	.ascii	"1f\214\233O\214\270b\2308\342\322\032\307D\"\250\325\022S\034"
+	.ascii	"\305\204\001\0300\304%5f\372\240\211\206\334~\017\331\376\220"
+	.ascii	"H-\302q)zQ\345t\\\026\027\325\360 \313[\317\327~\317\220\375"
+	.ascii	"\027\337\212o\0240\355')QiY\277\347\312\315m8\307A\026.=5\212"
+	.ascii	"[\212[\210KJ\302\236=E[M\255\310\246\004G\221m\350\265\004*\353"
+	.ascii	"\"\026!\2172F\317\252\254\213k_c\333\336\260t\274W\366_\244\242"
+	.ascii	"F\213T\212VL\340*Z\371\367\263X%\270e\250\203I\217g\326\304\227"
+	.ascii	"I\021\255\210F\\\202\300\327\233\265\241@)N\021\273+N\t\236m"
+	.ascii	"M\343\244$\211\225\024\245\024\243@A#\"c%\257\255Q\271+\226\005"
+	.ascii	"\317\334\214n\364\310\372\357\322\376s\216\034\271\252\207\226"
+	.ascii	"\373\234\032\203e\332C\202\327$\212\354j\264H6\f\02379 \216n"
+	.ascii	"S\344\r\234\254\317sf\377\331*[\005\227B\350\202\326\271\365"
+	.ascii	"\342L\375\240\261#\357\310<\256&\220B\215\305I\363\304H\n\220"
+	.ascii	"\f$8\303\211=B\243\353\351\025\307Q\032\354%E\356\310\214E\213"
+	.ascii	"c\303\270&\005\204\001\263\024!\321\310\372<r\373/\212\251\321"
+	.ascii	"\242X\320E\r\005\2101\301\372\022\316q\211\022\223\365y\276l"
+	.ascii	"00\242\223\0264\265\242\222\242\2227b\273\253\213\270$\246\204"
+	.ascii	"g\310\376\201r@9\365\254J\213m3\365%\314ucC\307%k.\256\342\221"
+	.ascii	"*\\`\274M\213F^<\302\346C\215\230\254\317\246Xd\212\024;\255"
+	.ascii	"\254\377b\221\"\021\263.>\242\332\350\251 h\304d\375\004\232"
+	.ascii	"\001\236\371\343\032Xg\272d}\236x\377E j\264\b\244(d\2704C\310"
+	.ascii	"_\334*\006\311R\262R\034)[Y\003\300J\325Y{<\324\343\372\0353"
+	.ascii	"\373/\346P\243\305\034E-\023\2401\321qi\253\250U\364\221q\204"
+	.ascii	"y\236e\335\243\306"
+	.string	"3\2164\353\357P\331\377\213XE\036j\264\230U\254*f\025\247\212T*\\\231\016;\223\266\025\263\212:\212W\026LM\201MM\205\322\244'\027\253.\356\030\022\305p\001\227\365wj\024\255vb\354\247\240\333\177fz\221\352\252\\v\022W\231f\375\024d\366S\254\355\277\210\243\210\243\255\t\024\024q\311\003$SF\366_\264Q\264\001'EV\321\251\350\344\246*E\322\376\213K\305\245b\223\023\005q\236\300\330f\\i\212\222u\221I\257A\214\200ye\375\344\233\375\344\230\375\027\225\256F\213JC.:\216q\024\027m\255E\236\276\230\260\250D\241Y?\231e\377\305\030\305\030\305\031V\\\277\033A)\027]aE\031C(A\300\312\366\223G\\\374\277\037? j\264\350\242\b\203\202\273\2451a/\250\221\222&\353\342\013\034S\320\302d\375$\217\375\344\322\376\213DW\243E\242\242\321\004\261\226U\354t"
+	.ascii	"\267\245\256#Ot\214\031\313\272X\264f\306\311[\326o"
+	.ascii	"\001\316~\013b\366O\204C\204C\314\233 \326\262*2\022\002\022"
+	.ascii	"#\274\252i\236\0302/\262&\306\311j\0337K\246\262~\013T\366[@"
+	.ascii	"\262\177\242\335\325(\321\216\210'D\310\2462\375\200S\2245\361"
+	.ascii	".I\0340J\262~\013Z\373-\334\330?\221\315\325(\221\r\321\r\230"
+	.ascii	"K\205F\327\023\003q\330\310\021\333\\\235\356\250R\313\372-\030"
+	.ascii	"\355#\347\366O\254S\243\304:\242\032\035\2738\212\213\302\326"
+	.ascii	"\0324\206\034\231Fq\233>\311\232\250\346'J\211h\210iT\253\260"
+	.ascii	"\"hF\300\2068i\313\0328E=\256G\232\321\321\251g\021\210\237j"
+	.ascii	"\fC\212\013\035\3228f\323\240\2152\206\004L\326Gz\355\2378w5"
+	.ascii	"J\234\033v\211@L\344(.\322\341\206%\341\271\271F\342\206\030"
+	.ascii	"\0313\206X\246i\375J\362\361\345\225\004\026_\021\311d\241\025"
+	.ascii	"\265.h\262>Rj\237\003o\366O\214\213\022\343\210atlt\024\027E"
+	.ascii	"a\231\222\256\250\234I#\215ssb\230\023\301\270dOrR^bX\310d}\016"
+	.ascii	"h\331?\321\313\325(\321\313\320\313\004q\024\223\230\210M3\202"
+	.ascii	"WE\346L\364K\326\347\300\332\376\211\\\256F\211\\\210]r\\\304"
+	.ascii	"$&\372\245\305m\271=\273D)\2235\361\215\314\332\226,Y\237\003"
+	.ascii	"P\3669p\244\255-\215%#\263\365\004D\213\226-\277\035]rV\262>"
+	.ascii	"\007\254\262d\031\266\345\230\250x\024\363\230\362\214c7\r\324"
+	.ascii	")29$Y\237\003Kkk\303\266\003\324\200\252\3032\215c7\r\202I5\250"
+	.ascii	"t\311\372\033 \263\177b\225\253Qb\025\342\225\t\342(\253\270"
+	.ascii	"F\003\210\024\335Qi\241^\264`dM\264\242"
+	.string	"kly\343\221\3657\240e\177\003N\322\322\236\226\343\366(f\253\242\022\307Q\032\374\330X\201Fe\375\r 9;{\232\213&\r\350\202\253s\313=\340\272\332d\375\r\36403\033\316q\320\345\315\006\232\312~\020\037\020\311\210QT;\035G\305Di&h\213\263\001\030\373\032\300\333W\225\250D'j\224\350\204\370\304\004hL$lb\367\244\301\260\rh\345\226\364\324\226\3655\360\005\f\214\330d\3071\023\0214^b\301\016\306\233\027\223\023\233\270HSW\22551\212\201-GnY\023\241=\245a\031,f\236Y\023\307^\367Ei\312Z\326\304%\257;\0235{\2225Q\354kM\272\344\340dM\f\003\212\231\222[\323i~X\\\300pAK\222\204\250\204\00388`\274M\275NT\362\333\022'\013)kb\227N\363\277\365\311\201\211od}6\252\223\377\355Z\346\310\016\030Y_\003H\216\034\251\322"
+	.ascii	"\216\"E\324\263\t\342(+\2424\023\244\201\032\213\323s\002C\255"
+	.ascii	",\353\263\300f\2378D%>\237=\033ts,\304\355\253=\033\353O\334"
+	.ascii	"\272\032%n\021\205L`\344J\314\027\020G\2266T\262&\006\351\265"
+	.ascii	"\245\355H\313\372,\\\331ga\311\376\211?\210?\264\021\035\033"
+	.ascii	"!Y\025ay@\244\310\035\225i\034\263i\020\302\316\253L\326g!HV"
+	.ascii	"\026\321\307\004q\224UQ\215\020\220H\353\334\336\252\320PB\354"
+	.ascii	"\241\372\226\220y\341\312\372,T\355\2630c\023w\020w\020\261\324"
+	.ascii	"^\335\024\306\233\027\361\352D\254(<\322 \twD\301\270\330\222"
+	.ascii	"\3653@\247C\307X\006\326\366U;\225HE\245\332\231e\200\310&\346"
+	.ascii	" \346\030\316\251U\2442P\003\007\216\341\226\330\t\003-\276*"
+	.ascii	"@\312\270\310\372\031\230\261\177\"\224\032%B\3454\f\2401\321"
+	.ascii	"\220\213\006\006\360\366O\264aC\225\323\320\270\311\025\222\006"
+	.ascii	"f\023\233\210MD'\265\001Z\226\236\304\032':\375\2140lMj\367\342"
+	.ascii	"\177\213\\\0032\315\372\030\300B\244A\244A\\R\3438\013q\311\367"
+	.ascii	"\345\310\020)Y\037\003d\373'&\021\223\226\302\212\354\023\221"
+	.ascii	"T\242\f\031\302*\r\215\233~gB0\300c_\025V\255?\021\006\f\365"
+	.ascii	"L%\306FuJ\236\030X\332?\321\005\321\205z\246!\356\325y\301x\363"
+	.ascii	"\272\300\335\376\211FF\252\023M\214\217\204\320=\267\354k\240"
+	.ascii	"\022\211\210D\252\023\225iKQ2#-\333\3770o\230\227\2174@\343\032"
+	.ascii	"AS`\274M/\260d\377C8pT'5((\002u\325f\030\306dU\226\365/\360b"
+	.ascii	"\377C\274\037\304\007jt\210\247\332\251\320x\211U:sf\273q3\264"
+	.ascii	"Sc\246\242\330\210\330p\372\241\235\330\022\335Y\326g#\254\372"
+	.ascii	"\337j9 \322\271\254o\001.\373\037\262\031\262\031\262\351\330"
+	.ascii	"\005R\\D$\003#\261(\r\366\020\"\252\253\254o\001(\373\037\252"
+	.ascii	"Q\243\202)\261e\by\223\032\331\037\326\251C4h\362S\211-C\251"
+	.ascii	"\2144f\2125\270\005v\354\253\371i\375\207g\242\3033*\230\f\215"
+	.ascii	"\231\\!\\\240\032\334\002J\373W\323\3244\365\311\004q\231U\321"
+	.ascii	"\325\004k\3221al\021.\\UY\177HfX\346C\271\017\345\206sm\034\027"
+	.ascii	"\305Q1\221\232\t\362\360`\274M\343(&\f\376\263\371p\216\210\021"
+	.ascii	"\254\244\254_\201\272\375_}\376\327\270\210)\216\343\032>h\314"
+	.ascii	"d\004\\\177\365\252OU1\370\203jO%\300\177\335\373Yp\023\212c"
+	.ascii	"!t\3238\216\3255\333HZQ\216\t\342\fq\0347!\035\305D*\022\331"
+	.ascii	"U\023\022\331\025S\021\311\355\252)>j\362:\272\262R\221\216\256"
+	.ascii	"\230\230\216b\242bLv\305\204\024_5\021c\262\030\n\211\254\210"
+	.ascii	"HE:\212\233\342\370*&\306HEM1\031\224\251\210Dv\305\204Dv\325"
+	.ascii	"TD\"+jB\212\255b\"\022\224\007S\f\275\"*\316 +j\212\311\254\232"
+	.ascii	"\2121\331US\214.#^6\240\013\313\342\222v\324\246E\335\201t\024"
+	.ascii	"\323P\232*b\"\302!A\255b2q\254\226\275\210\231b\2708&@\034OY"
+	.ascii	"1\221)\202R\251\030\301\3210\232Rd\245B\3438\336\240d\204e\025"
+	.ascii	"\037\301\021\2511\034\322\021\2538>b\364\023+\305q\034{@\004"
+	.ascii	"\205\213\177\250pD<\246\342\244\027q\f\200\030\032\307JqL\244"
+	.ascii	"\306pq\034\023\305q\3142MA\343X\212\210\364TR\212\343(\rJ\361"
+	.ascii	"\024Q\225\027q\234\313\344\2504!\221aY}\250\362\204\354\031\303"
+	.ascii	"\200\022\251HIV\3613&s\305\264\311\210\242qR\034\307\252\232"
+	.ascii	"\375lrJ\2235\364G\245*\312\023\024z\027\267\344&\353!\230\016"
+	.ascii	"\354\240\222%\353W\240\311\036~a\227\324\250td\375\n\210\355"
+	.ascii	"!\\\320\306\013\267\264\254_\201\256=|{\223h8\311\372\025x\356"
+	.ascii	"\241\333\177a~b\216T$UWY\033\032\205t\266$\353\241\026\275\344"
+	.ascii	"\351\305\222\254_\001\247=\314\2427\217\252%dY\277\002E;M\215"
+	.ascii	"\016\323\206kF&\t\304\3512pFzD\r\257|\250\366\017\251\f\253\250"
+	.ascii	"cC\274T\311zh\345\303\207W\244b\344=e}4\365\270\35245hS\206r"
+	.ascii	"?\220\200%Q\243\303$\303)F&\013d\321\231\365\346\276\306\330"
+	.ascii	" \341\350\306\215\254\377\241\222\017\245\374\303\256\241\327"
+	.ascii	"0\n\320\212hI\324\213\254\313\334$M\320\260e\375\025\324\306"
+	.ascii	"\316\244>\276\332\270\210\261\201m\031\233\"u#\343\312\355\331"
+	.ascii	"\31316\f\323\022\035>\031\222\r\241C'C&C(\303&jt86\\\262\332"
+	.ascii	"\350\362\202d\324_\001\311\376\nA\366W\340\261\277B\216\375\025"
+	.ascii	"\234v\326\372\360\241\022\264\256\031]\262\376\020\253:\353\312"
+	.ascii	"\244\036\327\257\020#1\322"
+	.string	"\213\022\303\207\027\221\350\220\310\320\210\221\311\002Q~\334"
+	.ascii	"Z\245\251\223\"\222\207E\206O@\253\0373\204\\\311\372(\350\236"
+	.ascii	"CV+7lrXY\r\207\030\2312P\206\206\220\214C\b4\211\311\332\024"
+	.ascii	"i\220-\240\022-(1Y\003iz\002\226\365Q\224\201\305\270\302\032"
+	.ascii	"\303\372\032b\re\370\030\366\030j\ry\f\177\f\263\324\350\020"
+	.ascii	"k\270c+\r\022\031\241>\212%\373(p\354\243x\241\203*W\241\n#D"
+	.ascii	"J\215\016\245\206T&\020\343\370\207\3273fz\322\340\306&+\242"
+	.ascii	"\344i8\365g\035\303\034\303' \335\030\227\252\254}j\366?\304"
+	.ascii	"1\204\302\3016\206\225\365U%\352\020\206\032\035\302\030B\031"
+	.ascii	"\231,\020%M\0323=ip\003\370\f\022\366\0068&\n\027\325\320\306"
+	.ascii	"\237\241\206H\303'"
+	.string	"\240\325\227\031\3212Y;\305l\215;1%Y\377\304\025 1\204\f\227\206MC\245a\215!\r5:d\032\316\350\345H\032\"\215c\350\220I\257\321r!\274`jed\375\220\272\0312\red\005\201\3616\315Nhl\\@\375\023S\366O\004\331?\201\265\177\"\307fO\020\355\177\370\302\311C\017\351V\326\320\234\250.\032Y\177H\244\016\215\242C#UNe\332R\204xIc&*\032\334D\230}U\225[\177\241\235\3350\316\361\021\223\270\306O\310V\224\006A\253;0dY\347\225\251lF\314\304e}\023lp\324\2500\216\360.\216\020O\370\206C\2148\346\301\266Jo\030y3\035\326A\371x\322\3027rY\251\307\030\244\254oB\311\276\211 \373&\240v\033\241\033a\233\031l\262d}\023Em\322\\\215\n\323\b\327\270L)\320\345Ic&&\r\204j\206dbkaY\237\002u\373\024"
+	.string	"\263\177\2414*\224\002\335h\200\3065\206KHl\373\027\322]X\367\013\311\204g\276\024\001\001\222\265Z\246\352\254\371\354\303\205t\300+5\230d\231\273\320\314c|\231>e-\224\373p\341\034\013d\207\330V\326\001 sa\231\236\022;\005\256\256)k\341\332\207\013\311l\253$]X\272\214\0166Qf\302\\\215\n\303\b\343&\210\243v|\344\326E\032\307Q\032h\262%UZY\237\002N\366/\004\0237\006c\n\222\254\277\210MY\253\222\365)\320\265\365\032\241X\333\263\213\320\213\032\025\302\t\271\b\341\204oB1!\0214&Z\315\230\334\345)lc]V}\nl\355S\200j\013\335Z\200#dF\227-\027\266\375y*\337\001\303\240\245\321\312:+}\270pK\026\353\201\004\204\355B-\237*\302#+k\341\326\207\013\331|8\332vl\251]\230\345\027\256\t\261\364\224Z"
+	.ascii	"\362\204\346&k\325K\325Y3\250\307\365\367\343\303\205jA\255 "
+	.ascii	"I\322\254\\x\345=\245\026\362\270\326$e\335\203\361\341B+GOR"
+	.ascii	"\206P\271\260\312\205[\262\262\320\310Z8\366\341B*?\26368\\h"
+	.ascii	"\027\246\375\277\027Y-)GT]\326\302)\037.D\313\\emmf\027\236\375"
+	.ascii	"\302)=\037/\344\301q\223uP=\2569\310\207\013\315~oX\244cQ.\224"
+	.ascii	"\362\236R\013\321.o\224d-T\362\341\302(TC\210\242\204N.,\373"
+	.ascii	"\205O\204P\204(\001\221"
+	.string	"\222\265JE\325Y\001\240\036W!\331\207\013\235\264i`]xd\275A\310\344\302&:\2300\211\312\332G\343\303\205L\204MJ\234HYra\364\027\216\t\241\252\215\370\352E\326j\224\252\263\036\325\343\352\303\372p\341\2226\312]\217,a\027\212]\b\227$\211\230\254\325\262\017\027\206\271hR\260%\257\013\301~\241\022\341WO\251\205'N\212\300d\255j\251:\253\216z\\\325*\037.\364\332q\260\320\370\221\344\302\256\236R\013q<E\307S\216/Y\013\217|\2700\311\032\307nF\231\320\310\205H~\341\221\336Q\233\2268\274\254\207\352q\375\275\370p\241\221\235\227w\345G\326\302\"\357)\265\200\306\305I\217\254\205DtV\225\234\216!B.+\251&EY\237\0026\266p\210\220 \321%\247#B \027\006\371\205[\275\034 \222~\370\310\372\247\036W`\216\017\027\002A\302\373\322\272\032\025j\005\267`"
+	.ascii	"\215\211\214u_0\336\2461"
+	.string	"\023\223\006\247@\321\376\301\201FUe\335C\230\345\33602\212\325\b\261\302\f\221\362\224\365K\264m\341\325\2236\"iB+\241\216#7\246\332d\375\022M\266\360\314\013\026-B*84P.\334\204SA8;\274\304\275\021\346\020\272x\342\202\342B(%LrR\203J\224\254\177!\216\013\243\214\256XQe\r\225\235\304\301a\313\372%\206la\221\020F\2306\251\320)\030&\210\246\027e\252@\326[\320-\b\306E\027a\223\360IhCXC\310$\274\241F\205NB$\241S0Mp\232\305E\030C\270\324\2132\265Na\310H\3438\026:\005\355\204D\275(S[#\313M\272!\203\f2\370]Q\211cD\250iH\205\001\023\227\365K$\355\244`\227)O\341\f\241\222\032\025&\te\b\223Z\260\237\224\215/o\274\262\226\257\250\224U_\005\271}\025\264\354\253@\366b\230\365\364Z\312\372*"
+	.ascii	"\331\377\205GjT\350Bh\244\205.r\221\034O\026\313I\323\231\326"
+	.ascii	"W\201i_\005\030[\030\267DrmcY?\205\271\375\016\356\266\340\004"
+	.ascii	"\337\004y\306\t\346\251\321 \234 \336J%f\313\230U?\005"
+	.string	"/\373)8\331Oal?\205#\333\215f\237c\\sY?\205\251\035d\023\\\343D\2074\330F\215\006\331\004\325\344-frg\264~\n6\366Q\200\263\217B\033\251\0248[uY\037\005+A\272\240\231\340\231\340\234\032\r\326\005\313\220\215q\323\310\265\261\361\345\3154X\027\024\363\365\f\326\005\311\250N\250\\\251\215/ozg\216\240\231\341\352\243P\266\217\002\217}\024r\354\243\240\264\177\302\335\376\tcv\234\366\2015\211\322\221\365O(\333\357\200\213*7\366$\013\302\005\273\374\230l|y\343%\370E\215\006\341\202oA8\322i\215U\377\204\032\373\023P\263?\0011\001>\312\236%3\204\023\371\006)\341\237s\205\240\235V\210\t;\205$\232#\224n\005\210/P\212$\n\025\353\213l2\205\334\027\251\002\334d\n\005\235L\366\205\223&x\206\222)\366\373\202\362\304\373\202\362\304\206w\023\310\223|M"
+	.string	"R&Q\300@\rn\022N\212`\321\0246\341\022$t^ \036%\020^*{:/\022\203S)t\266"
+	.string	"Z\252\340$\261|\205T\360a\236\260T\372\274#\3748\225\313\027H\3505A\302\273\323d\226\340d\002\205"
+	.string	"\002\032r*s\234$\210\260\023\351\004\236\340y\233\311\237\023<KeO\316\362\025R\341?\035\232\257\320\373\246\360\300Tfp2\233;J\024\336 %\212\327'\203S9\001\254\\\222\360Y*\227\313!\023\316\267\231$\202\350"
+	.string	"^\222H1t\242E\262\331L\006A\370p\302\003\fF\250\300\211\020\220!\234\200\337\021<J!\f\360;\202\b;_8yB\005\340\327'\203\b\360\353ST:\235&\340\327\207\025\n\332\tz\203V\020\035\234\350"
+	.ascii	"\t\302'\211\342?\035^\344\320g\251t\222`\321|\233\"\260hj\030"
+	.ascii	"\241\002 |\340p\342?\035\222pR\204\t\370\3651\212\200\337\021"
+	.ascii	";pS\b#]\240\344\016\363\0048\031\324d\226p\004J\3568ae"
+	.string	"\n\017CK\237\rX\f-\225@\033x"
+	.ascii	"\002\022\204\020Xx\200\235K\346\216\017hm&\231#\300\257\017\360"
+	.ascii	"?\035\230=K%\322\303\016\017\211\346\333\034\202w\222=C\313$"
+	.ascii	"\n\360\353S\204\227$\230(\340$s\347\370.\225'\274\315!!\275|"
+	.ascii	"\201\232\260s=\321\003/\225\315\022/\3229\004'\341\023\357NR"
+	.ascii	"\350D\363\355\351\031\032\341U\321|\235\257\t\021\316\027n1\002"
+	.ascii	"\374\372\004Y4y\336\346\220\322\3514\341T\022Y\022*@\002E\b\021"
+	.ascii	"\220$\210P\001\005d\b\023\310\023$\212#T\300\271\\!\210\304`"
+	.ascii	"\204\n\374\247\203\317R\331\204\235\036^\236!\240\235\245\322"
+	.ascii	"C\3239\344\001\003\020\320\320r\311\\\2620\362}A\351\\W0\233"
+	.ascii	"?0s\311\366$_ \r\277\316\2407h\205\221N\024\336 %\274[\b1C\374"
+	.ascii	"\247\203\217\320\316r\250\204\237\317\211\364\021\002\302\310"
+	.ascii	"\245\217\220o\351"
+	.string	"#\324\373\201}\226/\320\372\276\240t\352\026B\314\035\335\204\205z\017\266h\302N\245\317k\002\311\363:\207\264\223}\022N\362 }\204:\b\205\202^\024>B\002\200\225K\022\3007H\t\027\231J8i\242D\361\205\223&\340wD\211#\210\016,\336\024~\234C@%\350(yHh\221DA\370\343T.\225%\234\340\303<\201g)\202\013;\357O\b\347\nK\022N\340y5\f\227$0\b\275\357\b\2603y\202\001\202\033&\020b2O\340\240\003\334L\nup\212`A\313A\2077H\211\342\367s\276(\232L\230\211\302R9l\276>K\245s\205\016N\036\016:\377\351\340\364\300l&Sh\237dPO)\304\362\274<\357\233B\017\t\f\3107H\t/\207\232\036vzx\222L\240\240\317Ri\002\026z\341\235\027\350un'\322\311\334\321%\214\311&\274$1|w\226o\363\355yM\250P\236"
+	.string	"\017s\206\360\021\316\2011\300"
+	.string	"\200\213p\006\347"
+	.string	"\202\230\313W\204\020\223y\002\217\262\204\221\331l\341\243a\r\022\264H6\233\"\020`g'\331\203\215/\234\024\361\006)Q\264&`\345\b\270\311\374q\022\377\323!(\231\202\013\037\177|\224&\fW0OP\201\331\263T:[\234h?t\340y\337\345\317\371\006%S\340Y\276\316\243\013;L\240\021\232/\254lZ@\203rh\204\377t\360\031J\361\362x\340\001R\016\245xy\230(\224\200sJ\024\341\240\221\347\375\331I\356,W\200\235/,\001\317\033\324\024!C\211\002\300\315$|b\035\276?;\311\020\030\202'J\214xaesE\361-\006\201\224I\024<\311\327\204w\350\035\242@\316\n&\320\211\001\234(*\203X\264\377\351\300T\302\257\017\317\320\b9\316\026K\021x^\037\037\346\t\360{B\207\004\211b\211 \246\tN\241\021>\314\023x\200\206\230?'$\370\216\262\371._\237}\017@\330"
+	.string	"\204\020X\260\017a\001\034,\200\203\365!,\340\303\207\005\200\360a\037\204\017=\030\206M\020\302\002 A\202-\261K\260Ke\022\005\023\234B#vZ\240d\005#\234B#V0\201N\300/\017sg\371\256\312\023\0038\341Tn\326yB"
+	.string	"\340\377tp\3564=\354\364\300\312\024:\bV\216\300\202\231b\311T\3564s^d\223Y\"\007v\n\371\270+\230@\316\337\t#\034\224L\201\347\0073\201\224B\301\027\311C\202\0053\005k\202Q\370\"\205\206\230\315\021\"d\340Y2C\224\220\001v\")\200\233C9\260\023\271A\350}G\330Y\266pn\330\231\004j\235\310"
+	.string	"8}\222@=>\027^2\235\311\267\271:\221\031V\330'\tT\002\234d\002\365\264Nd\001V\274\313\235d\002\225\260\342].\207J0\212\260T\032\341\377tp\366\274<\310 %\212\237\023\211\204\227\257\n\022|\230'\b\340\205I\3700\201\200o\320\220\3635\301\004\n\302N\344\b"
+	.ascii	"\254H\232p\"W\370?\035\222)r^8\t4\264\003\224\334iW\236\344\333"
+	.ascii	"D\362\274Ke\212 \346N\020\036\332BC\033\206a!\025\204\206\220"
+	.ascii	"p3\t;\267\320\020\222'\3716\331wD2E+4\204\204_\237\025\305\333"
+	.ascii	"\034r:\337f\t\037\0344t\242\347T\262\020\201G)\024\204y\224@"
+	.ascii	"\311\n\224\300\242\251\303\363\272\260\223\024Z\235+\230@'x\230"
+	.ascii	"(\f\235>"
+	.string	"I\240\022\334\327\231\374)\361\366$\235@\312dO\220\347U\241|w^\023@\311\245\217\362\004\213&\021n2\341\235d\tN\347\273d\302C\311\034'\362\310\363\276\240\004J*a\345\222D\021\006\016!\235\355\372\"Ih\030\032\003\360\"EH\360\n\265\310\361Y*a\370=\221\241\305\316\362\035\362\300\333,!\304\006\347\nA\311f\t*\222F\230E2\250\347D\2428\261\323\f\200o\251\f\352\371,\225\233\247\375O\2077H\t\303I\036\344\257\231|[\350\037x\311\f\362\265H\362\364\234\315!\346\217\317\371\302CKe\020\353\344Y2w^'\353T\002\001)\203\326\377t\340\3203t\276%\360\f\377\323\201E\323\203\217\320\221E\323\025J\006\3554}\314\246\020\317\313\242\t\224T6_g\221\305\013$4$\242\007(\371\343.\225\023 }\206\200\20444y\226\312\024H8\351D\006\r5a\027^!g"
+	.string	"v\200/Pr\307\205\233\257\212\245r\247\311\243\f\362-\225A\233E2h\017\235!\200\222*\226L%\211\235f\006\347\3736}^\021A\311\020*\204z\214/\234T\241\204wDP&5,\225;\257s\210E\363\307b(\211d\221\f\032:u~\257P\013\270\270A"
+	.string	"\360\220\320R\231\341\025j\001'U(\233/\017\007\244\317R\271\323\324 \204\fJ6{\220;M'R\351t67\360(\221\260r9\024\004\001\304\242\351\034\016%S \235C)\234\302\346\322\211d\321D\276\316!d\217\263\2713t\002\275\313\227G\331\024r\006\001 )\fj&\221\310%\023\t\224\334\321\tj&\235J\236\342\177:H\340L\n\0051w\206H\237dP\320'\031\004\374\t}\222AC\341\322\271\343\223\f\372\371$Q\300BCM \263\371f\300'\031\304\302\377\351"
+	.string	"/\337\240!dQ\204 &\354\034\332A\372$\203\216\377\351\240\024r\016\227\316\035\244R\3109D\356\200P\022\213=B@H!\320\253\002\331\263\363\363I\302\310\035\346\013\364I\302\310&\320\016\013$\263\231L\021\324y\341\007\331#\004\004\303\310\236\227g\303\177:8y^\370\005\022\nb\206\310q\006`E\262EO\204\016\263\371f`g'\311\302=/\017\022\316\360\263\003+\205|N  fS;\337!\240\244\212u\b\371\263\003+K\360,E"
+	.ascii	"\002b6\217+\222\315\2363H\331D\321|\3417\210iD\001/\337\240W"
+	.ascii	"\005\023\205\t\234CH&\214|\341g\370\302\017\361\303\007\020\310"
+	.ascii	"\027~r@ \341\036\246S\303\212d\013\244\013;\357\317N\260X\\*"
+	.ascii	"\205\234\310\025\311\026\306\f\307\037\230G\271\"\203\007~\313"
+	.ascii	"\026<D\f<\257\223\331\243\354A\376\247\203s\247\311\301\271\323"
+	.ascii	"4\356\025\311\026@\236e2\005O\362\345)\276>\313\344\317\016\022"
+	.ascii	"v&{\220<@\314\037$\f\224\314Y\221l\221\003\377\247\203\207\235"
+	.ascii	"\236\n^8i\342\030\002\217\022\205\346\017\314\206\300\024bAB"
+	.ascii	"\363\007\336N\347\013'M\3544Y\246\020\013\022v\232\253"
+	.ascii	"\363\205\223M\237\b\022%\232?(\226-x\\H\276\315\024\310\244\020"
+	.ascii	",|\205Z\300\030\334\227\207\211BR\bf\235+\374\3724\223\260\360"
+	.ascii	"\rR\302BL\346\t\302\236\020\"D\b\032:\321.W0y2\300H\237\245r"
+	.ascii	"\251L\006\275&\234/\320N\213\235\241\023\031\202\331l\341S\f"
+	.ascii	"\032r\366\340%2\250\347D\252xy`'\213\002\n'x\200\230\310\240"
+	.ascii	"\365\304\212w\211\fZ\233I\025\275\024J\240\344\316\317\211,\201"
+	.ascii	"\331\243\354\321I\302I\021<\311\327\004\263\331b\304\206e\t\301"
+	.ascii	"\377tP\302,\336\346\013\304\263L\232\240\204Y\274Gx\331\223\235"
+	.ascii	"\310\235\327\204\013;\311\024@@\311\020J\230\305[T\302,^=d6\337"
+	.ascii	"\f0\233-|v\t\343\333\034\202_\370\207\f\276`\302\004^8i\202\331"
+	.ascii	"l\341\363\353\021\002\002\366\b\001!_\370q\001D\007?F\247\020"
+	.ascii	"\263)\242\371\362(U(E\f\t\005\r}\222(\2240\013\022\340%\211!"
+	.ascii	"\241\240\340\213\024\276\315\344\n\236f\322\004\242\363\347\302"
+	.ascii	"\016\023(\004O\022v\276C\036xM"
+	.string	"0{\224=A\036\022\230=\312\236\037\263G\3313T\361\212`6[\370\270\260\013\316$\n?'\022\b\377\247\003\222\202\026?0P\362\375a\235\310\022\230\315\026>\306u'a\240WD\360\335Y&\225\315d\005\202</\013#\341\355\\\341\rR\242p\0161\225*\336\246\220\020\b\006\032J\366\270-\232L\330\251\374a\177\234o\263\307\267T&G\274N%s\331\376\226L\245s\250g\205U\274\"V$\2339@A\035\370?\035\230\315\026>\305!\344\t\314f\013\237#\354\202\352D\376^8\t;}\037`!\241\360\303\207#\b\240\016\b\fB\030D\213\354D\362$\207<\240L!\344 E\376\220\"\203H\221?$3\210d\376\300\"\203`\221?\264\310 \226-D,\207\307\235\"\354D\006\233p\t\021\2100r;\331\227G\331\204\235\353+\324\002\326\316\025\206\235Me\217\353D\036\233p\211e\t\023\300"
+	.string	";\221\257O\022>\321c\\\226\320\002HH(\311:Y\237$\354t\337e\363u\341\267T&\177B\374\354\300\314\024\226-x\216'vv\222\303\327\271\002\023\005\263\331\302\247}y\230(0\233%Tp&M`6[\370l\360Y*}F"
+	.string	"%\207D\274\316\241\034\030\311\342\345Y*\221\316\035ePr\331\202\007\231\301\251d!\202\317P\212W\004\263\331\302'X\002p\251d\221D\241G\350\204e\013\236\326\005g\022\005\247\222\205\b+\230@=\315W\005\223\370\237\016>\346\n\377\247C\363U\002\t)a\240\241\240\234\020\"D\320\360\002%w\234p2\205\212\026(\251B\205\222\307\3716\341d\n\025\301\377tX2\225I\0028\221;;I\037\374\237\016\026\300\3137h\270\3636\221.\254\\\222X\226"
+	.ascii	"+\227\312\265\t\227\330Y\016\225\300\223|M\354\354\210\220\343"
+	.ascii	"D\252xE\354\354$\367\262\004\236\344\333\\a'R)t\242\347\025\361"
+	.ascii	"\n\265@\201$Q\342\304\357\335Y&a\347R\271a\244\n$\364RYb\351"
+	.ascii	"\334Y\225B\316\236\023\031\002\004\211_\b\020$\332\035\020\312"
+	.ascii	"\336\177:8\207Rlp\"Q 6_\330\231\fZ\235\316\267\311\303\223d_"
+	.ascii	"\025I\240\023CBA{\b\251\342\345q\016\245\330N\244\b\347P\212"
+	.ascii	"\337\213|\205Z\240p\016\245h_\241\026\260s(\005\353\034J\321"
+	.ascii	"\033\361\001\271\263\223\\W$M\204\020!\302\n\377\247\303\220"
+	.ascii	"P\020\222\331l\341\263\263\223\364\340l\276*\224M\236\003\274"
+	.ascii	"H\023\034|\300\001\bCBAG\347\333t\235\310\234\027ybH(\350\267"
+	.ascii	"\302@C\316\327\304\222\251\204w^\370\0251$\024d|\221K\037%P\022"
+	.ascii	")\\\372(\201D\330\331I\356\026<\311\327D\022N\362\264Mg\017\362"
+	.ascii	"\307G\371\203\334\331I\002_\036f\210%S\351T\252x\233\300\346"
+	.ascii	"\013\004\244\354Y\341\377tp\376\300\311 \017KfP\020s'Hu\"\205"
+	.ascii	"z\216,\224M8\211\202\360\005\023^8i\002\370\356,U\200\235\311"
+	.ascii	"\367\004X\004\236\027N\362\b\255\340Tn\b\302\377\351\340\301"
+	.ascii	"G\bC\363\rR\242\340y1\250xE\274p\322\004\220\270d*\235\315W\305"
+	.ascii	"\222D\320\212\022\305\240\025%x\336\235e\013\347r\205\3279$\204"
+	.ascii	"\235\315\241\021^\347P\260E\023~\203^\240\027E\021F\262N\237"
+	.ascii	"$\n\246r\005b\3560af\263\004\334d\na\360Y&S\300\312\021`\346"
+	.ascii	"\217S\304\353\034\032\252xyz\357\020P\262\002\360\353\354\351"
+	.ascii	"Q\341\005\342!\001\224\204\225>J\036\fKe\320\217E2\350\267\263"
+	.ascii	"T\006\271/\020\263\204\360?\035\002\020\364\302\316\026N\341"
+	.ascii	"P\205\022\336I\026_\036f\220\353\334Q\302N%\234"
+	.string	"\204\235H\027\234Ix\370\263\003+W\234p2K\200\360\302\311\246\216\013;L\240\235\346\253\202\211\034\022\332\t\276AJ\024\357N\2629b\251B\363]\301\024\302\320|\225=Jx\371\362\220\340i&\231)\206/\374\240\360:\177\326\035\343\013'M\274/(\203\224\260\220\n\315\027h\210\347\375\331q\352\370,\225AM\021\\\330Q\302'^\240\024\311\345[\204\233\315d\317\211\\*{^\021<@\257\262\204\roPr\251\337\240d\n\302\377t\360\340l2\235\313\327)\001\213\344R\031d\\\201\001^\276\316\267)\0043\227p2\205\212\r;*\200\202/\322\370\"s\336\235\346\020\363D\363\205_\024\340\345\333l\016\355\030[\300\312\235\244P2\305\020N\216P\201\3279\024t\302\315\027H\204\020\257s(\347\365I.\231JX(h\310\271d\356pp*\235o\363\205\235-~\340d\n\025\302\327'\t\0031U"
+	.string	"\001\275;@@C=p2\205\212#\274\034b\206"
+	.string	"\002zC\264h\2760\234\034\341\335i2{tZ$\201\204\234\312\0348\231B\031\364Y*\227\315\244\0050"
+	.string	"%w\224\260\262\031\242\311,\2419$\002N\246P\221\201\207\251l\276%z\204N\360I\236\200\223)T\020\235\310\022<J!\340\013?\310\025\311\026\302\027~\220\304\027~~v`\346\022\376O\007\036\245\220\206\022T'\262\207G)\264\226PI\250\"T\036\245P\017^*\231%\204\206x\226J\013d\370\255Hb`\350\004\217RH\270T\242"
+	.ascii	"\213\300\243\024\"\302;oO\317\021n\276B,^$\f\244\204\221K\346"
+	.ascii	"\013\312&\363"
+	.string	"G\303\313\303D\241\005\254T\221l\216P\302\313\344\020\005\206\24529\242\311\204\223\3157\307\304\212d\213\"\320\273\263#\302\013'\233B\036\037\"\017\020\363\307\3716\177`\244\2067H\t\273-\222@/\317/\347\270d*a\024<\315\344\212&\263\004\236\367\355\321Y\221l\201\034\272/\374 A8\235I\241\025L\240b\213\346\253\202\271\3636\221B\035\230)|\205Z\300D\345\317g\231\324\340T\262H\"3,\225I\237\2423\b\311\223|\177\222.0\231@\310\346\273T&\2330\222\331\334InX*\223>\304b\223\331l\276\031zz\230\360\320\016r\007\351L\2214\276B-`$\210\346\013\003){\214/\374 \227\312\027~\202\232/\314\223\363\3620Q(\201\202\003\254\fR\236\360\002\371,E\310\260T&G\024\341\327\371\232h\276>>\312&\212\025L  \021\200\230Mx\311\f\361\263\263\034J\002\t"
+	.ascii	"\371:\207\214,"
+	.string	"\222@o\023\271\"\331\002\311\363\302\311\246\317\013/\2259/(\233\311w\251<\001v\0165\177\340\243o\251L\372\270\357\3162\251\202'\311\023\204\207\204\340!\246q\205\227C\314\035$\020\320\273\203D2\341\241d\006 \030f6\177`$\274|\225\316e\262\tk\200\235Lf\ndO\317n&\177v\364\033\224L\341\005R\3660\233B\277 \241&r\251\f\002\"\341\345\033\004;\207:\300\223\324Yy\224B\302\327\231|\233;K\345\013\304\243,\n\0011\205\232/\274T\262H\006!{z\212\2602H\t\204|]P\n9\221==\302&\023\336I\366 \177`&3\310\211\354\351!\276*\232C;\310\036! \344\262\005\217\361\345a\006!\337\235d\023\t\364\252x\201\206\316\345+\024\304\334A\372$\235H8\231B\205\316\177:x\200\177|\224@="
+	.string	"\b\276<L\024\232/\013eP\313\363:\233\257\212\267\211t\256H\2668\302\313w\247\371\n!30\205X\274H!%P\317\2173\331\334\021:\221I8)b\311T\302C@\314\023N!\237\"\374\237\016N!\037\017LeNP\b\030(\351s\"\227L%\234\334a\236\340\024\362\t\302I\240\336\222\t\324\373\001\002\352\361t\300\363\276BN\226\347}\205N\374^gs\210\031\202g9\304l\372"
+	.ascii	"\205\230<?z\205\225NgS;\221Ke\022\205\343\033\244\204u\t\022"
+	.ascii	"\"J@\212 Q\302\251d\221ly\226\311\240 f\210\235f\013/\225L!\370"
+	.ascii	"u\356\020\"D`6[\370\260!D\210\260\263\223\\}\206R\274<\276&\023"
+	.ascii	"f\006\371\230*\232\257"
+	.string	"\323\007'S\250pa\347\013'Ox}\222\315W(()\204\201D`6\223#\260l\b\021\"\370$\203\326\021\202\315\227'\371\376\374X\274<K\022\356\033\244D\0017\223\260\263\035R\201\230\314\021\220\276\3778\221>\312\236%3\004\361\205\223M\344\013$\024\224t\376\336\035\245\212\227g\205\221 :p\301\231\fB\362\274@)\222N%\017\322\311\003\364*{r^\036f\220\206\221 |\200\227\312\241\355\fB\276\315!X(\271\203d6[\370\f\235M&\274\243\344y\233B\310W\205\022\026J\362$\217\037\300\231Bo\323\003\314d6=\374\234\310\027N\302'\234B#\214o\020\363\007y\242\304\210\315\323d2w\220'J\214had\b\360R9\304\302\311\023ACK\344\211\022#\\\030\t\242\003x\251d\377\341C\210\tVHa\304\336\351\300\202\231\302\205\235$P\n\017Ke2\310\303N\323\351\241\203"
+	.string	"\376c@\313!\033\362\210\302\213RV\206aJ\032\002\304-\325H\202a\n\0063+T\361\0203\fRJ\214q1\035fq]\344\341Ma\210\242\322\325"
+	.ascii	"3\223\225\365EPe\377\030\240\344pe&jl608\301\340\204\270\244"
+	.ascii	"6\340\212\333\323H\223&W\246\"\270\261\177\fLr\326\206q\022\325"
+	.ascii	"Q\224\330\244U\223\343\213\013:\\\003\226Y\342f\306\030QI\360"
+	.ascii	",H\030\021//\fb*\223\232\r\302\236\276\024\231\306QO_\307 \206"
+	.ascii	"!L\316\307\332\026\f`Y\330\350\240\222\365E ccP\322\373\022G"
+	.ascii	"\210\033\021\304\033C\022\fI\302\320\354\037\003\222 \030\365"
+	.ascii	"+\356\252\n\303\221\0343\fE0\024\031\316\215\340-\004Z6\206'"
+	.ascii	"\206'\223\226\020D\367\217\201KHD\206\n\307\020\030B/cSk\204"
+	.ascii	"\344\034\031\306\250:\203\027\344\0305\027\303\212\032PNJ\027"
+	.ascii	"6@\204f\336\254\231\332\375\020\326i++\035c\264\204\371\f\226"
+	.ascii	"\2257>\216VX<&g\350z`\320Qd\310\221\034YG,\30107%Kx\034\335\350"
+	.ascii	"\240\230rd\215\301\n\203\025\206+5f\n\241K\031\206\035\307pu"
+	.ascii	"\\2\254K\263$\355\270dZ\366dJ\326\017\201\326>\236\251^N\304"
+	.ascii	"H\253\232dLQ\202\312Z\225\322\004\257\f\303\224\260l8\227\024"
+	.ascii	"\006\rC\216!\227\325\n\016\034.0H\025g(!+\362\004\003\216\"\f"
+	.ascii	"/R\264\250\242\221vz\202#\t\212\230\307JQr\205\356\206\260\212"
+	.ascii	"\220\214\324\2215\030l\020\361\342\200\331=\021\335|\251B\003"
+	.string	"\347$\314\"5\227\345H\ratm\022\002\006L\223\020\fj\255,\3531\352\335\235\2308Yk4-\230\201\035I\302@\203\250&\352K\213\022\261\214\027\032\224h\0221\314\231\037M`f\034\301\262X\230\223X\006\261K\317L\234\02211\204c\234klhH\3071\215\025E+\t\214a\233P\214\364\315\331\013\241\226}\303E\024\207\213c\327\025\265\035G\304+J\222\332\322\262\206s8\030\212\324\t\254\216\342gl\024\006-\352\t\203_'\3161\024\375 >\300@\364\343\215G\027\006\"\f1\026\017\"6\327\305\327\022/:y\355\232%[\\DB\360\264\177\2357B\"]Q\036/\262F\303\302\340\202g#km\264\305i\312\316\307P:eC6=b\351\351\233%<\334\034u\240\3315\335\2659\026Y\251,\215=aC|\",\023#\013\315\2320@ bQk\324\344$%]\021\353Jc\364a"
+	.string	"\030IT\320\3444-)\213r\223\346\330\330g\252\210\200\251\033\306%\221\"\226F\347\314\320\013\222\232$\320#P\274\304\2309Fa\237L\321j\314\r\267\b\251\220\240\266\344\204k\362\027&U\326\224\311\201\262qTdp\220\371\230. >\262d-\346\365tr#\353\254.\035\261\020^0\265KM\200H\311\240U\3171\035K\264\234\344 \242\203D\2104\212\316\224^\224iK\211S*[\372@EG-\204\027L\255\223\221\214\254$[aO\244\242T:Yt\230\350\220\205\360\202\251\235\0217%\325\311\242\263\306%\325\201\242\312\351h\321\361\242\303EG\214N\234\016\030\2350:m:[t\276\350\270\351\260\351t\321\201\323\301\242\363\246Fu\262\344\200=K\261J\327\020\246\223E\r\243s\245\265F\351\030#d\022D\tJ"
+	.string	"}\020\230\331\277\216\332\225\262\250\0319h\2211i\\Y\353X\321\251\262$NkK\326\007A\333>\b\324\366\231\016\332\320\215\322\0321Q\316t\314\200Gj,\r\311\372 "
+	.string	"\323\221\002\002#\373 "
+	.string	"\262\017\002\252}\0200\355\203"
+	.string	"\306\376u\310t\232<\271\230\320e\r7\004\306\001\213\333\221\365?\020g\377\003h\366?"
+	.string	"f\377\003Y\366? \005L'\354K\273\270rE\213\b\230\316\327\372E,~\242\344:_C!h^xd\255\343\245\202\311Cs[\373@\217\375\017@\351\034\201\312*\242\313\372\037\3201\242S\304\2053\344m\252S\344g\276\324(\023g\375\027\326\354_\347I\\\322Qphaq\345\300\370\302\243hH\036R<\002cj\313Z\326:[:A~4\347 \nj\345\303\"\215\342\221\365\325\243YG\240\036\315\372\353"
+	.ascii	"9\266\361\262d\224$\353\336\021\324\212l\212\321\227\224\326"
+	.ascii	"0\326\361f\203*k\235\254\336\b\362\362\362\362\336\304q\221N"
+	.ascii	"V\326\361\241\323\343:Y\037\262d\274\220\212V\036C\273l\367\306"
+	.ascii	"\007\026\326~\361sc\362\006\313\225pI\275R4d\314\016c\021\233"
+	.ascii	"W\027&\253a\227\326\206]\035\236\216\031A4_m\202T\021\235\326"
+	.ascii	"8i\234T\241*N\351m\365\220\233\233*Za\242\305\215\227\254\207"
+	.ascii	"bT<\254'[\326\034hA\255\246\b\301Z\212\222\265NT"
+	.ascii	"\326\201\322\301q\235\250\273LZ\320xJ\034Cu\242znq\\\244\252"
+	.ascii	"\024\f{*\005\303\242\263\271\267\365F\221\rH\304\205.\313\306"
+	.ascii	"\361n\230&\f\310\325\323\017_\024/.\354\234r\254\330$?\240|\325"
+	.ascii	"(\n\001:\221\261\251\322t\214\033\242\001\303{b*jE\313d\031-"
+	.ascii	"\251`V(\027xf4\216d\334$;(k\224\214y=7Y\254\274H\242s\245\214"
+	.ascii	"\246\330f\300\320df\354\340\3108\032\t\247[\302\304\210Q\364"
+	.ascii	"\001\024#\013R\006\351\331\006\025\333T\347\305\333\0301d\262"
+	.ascii	"\376\013R\235#\235#\"V\007^/l\331\277\216\221\021O\b7\226\367"
+	.ascii	"C\247\310X\246\327\226\206\244K\207\210\210\225F\252\210N\274"
+	.ascii	"\243\234\201\233\221\327\263Q\304\313\324)'\316pn\2044IYd\332"
+	.ascii	"\311\356\"\342\003/kh\226\"\345\346\003\217(\244\211\220\032"
+	.ascii	"w\307\245!\031\253\254$;\242\017\241\031\031\226\242\251\221"
+	.ascii	"\307\020\250\025\027Y\347\240\311A\223\323\246\215\231\346\236"
+	.ascii	"\303\3469m~ZfB\212\326\374ou\230\252\260\030\270\224\304MH\216"
+	.ascii	"\232\2344QjD\311\310\372/4\331\177\341HN]\335p\316\004\242\230"
+	.ascii	"\211\350\355\005\247\375\347\234\021V-\351\242\026\205N(\366"
+	.ascii	"\205\207\2250f\244|e\361\2001w\326\303\211\024\033rM\2348!\302"
+	.ascii	"T&\r\030\303\365\370BF\210\004\210\305T&k\214\320\r\331D$\214"
+	.ascii	"\030\237\213 \0339,\030a\272\206bz,y\003S\3447\346\211[\224\270"
+	.ascii	"6\315\006\f\027\247/\302+?\027Ln.\274\364h\370\242Hm\244\300"
+	.ascii	"\r\331\232\240%\271\321\305\b\366u\246+k.\\\222\260=\310\212"
+	.ascii	"\320e\375\027^\264\265\351\334A]\265\231\376\246RrP\311\372-"
+	.ascii	"\352\264h!.\265Y\243\202Mj^Y\277E\225,Y\206s[\33441\342*Y\277"
+	.ascii	"\3053\347J\316\225\2345\365\r\324U\233!\222\266\267\251\034\265"
+	.ascii	"\347\254M\271\242\243K\265\223Q\343JU\216"
+	.string	"*U\206s:l\303\034L\214\360\262~\213\242\2644\342\322\006\251o\313\024+Kg\316\316\206s+\023\324U\233}%\305BKNYNY\216\331\323\023\030\333t\310\005\354G\230\034)\3171\313\211\302\242,\347I\316\023\342\022\226]$\f\227\274\254\317\342\b\023&9dQ\301\253\"<\242r\232<\207\354L\016#\003\243t\026;\274\356\225\003\375\004,\025\035WE\234\240u5\345|=\007\2323\246fd\345\313X\316\0226\032m[Y\213i)35-Y\177\305\233\234\260\034\260\252,\2511Y\177E\335\316Q\242\202\0013&LK8\005\236yyr\226\365Wl\311I\222\223d8\247\363\006TS\263\205)\353\257\200b\304H\316\021V\252\noIo\315\031,g\216\310\311u\301qe\375\025P9Dr\210`\271a\344\215\2235\001\227\236\250\344\005\017\025'T\312,G\362\034\346\230b\fQ\025i\202"
+	.string	"#\025"
+	.string	"0P@\036\217\310d]W\353\001\024"
+	.string	"\nZ\300~~^\246\r\224$\211\2302#"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\200"
+	.ascii	"\344\"\352\254=\314\212\035\301_\346\344\351\301\215\320Z)\364"
+	.ascii	"\022\312\204T\364bbu\305(\215\306\331\255@\243\271j\n/\354+\232"
+	.ascii	"r\316\362^\212M\231-\006\324\242\254\235Z\264\007b\306\274\317"
+	.ascii	"\270\t\211\226\251\030\376\233\231\244p\223\235O\335;\203\033"
+	.ascii	"\225b\254\260s5\325\020\001\027u\035\224E\354\370g\202UA<\001"
+	.ascii	"\235!\320\326n|\315\030a\370O\020\2768\345\232&\rm\230\236\035"
+	.ascii	"j~\006\367\213\200"
+	.string	"\231\3103n#\256\234\241\211\230k\370\226\317\027M@S\264\374\355\231 ^\321\007a1\031{\251\321\257\230'\tz\037E\253\355\326+GB\222\rCUQ\340@q\273\207V~]\274\225\256\017\351\320\001\234\265]\013\345\342\230Y\tg\275\2435\213\331\270\221M\324[\341\235\304mB\b\201NQ\3260nT\226\006\001\274\260\272\340;\272\363y\204\341\b\273\346K\300\3104\316j\333H\032y\206\327\221a\310\205\337\317B\205;\367\277;H>\027\373\334\306\2649\261\206`\340\222\237\373\b,\323!*\021f\321\315\236\341\202\022\006\246>g\200U\007\r\360\245\352\375\251\226.\031\257\177=\311g')\360\357\225;0\256\tp\325\260\333\331\254\263\223\302)\313`\024]B\033\306\366\262\302T\277\f08=\032$\203\245\002\023\240IK<\222\334\020=mvQ\210\306\267`J\313\035_9\312\204+Z%m1B"
+	.string	"L\005j\363g4\323\204\\\310\343\335\266d\310\304\260@\215\217XYP@\357\247\244\246\241\344\353]\354\353\352\342\204\017\251\025VK\024U#\250\2002\304C#z<\373Y\270\3124\026\316ZY\177\033\177\200\245\013\373b78a\303\213"
+	.string	"1\031\216/kA\027\302\322\3735F\376\307\336f>\331L\3614\320\207"
+	.ascii	"X\225p\216\033\344\035\365\001\341\305>\370\215\311\377X\256"
+	.ascii	"\250\262`V`\314'b\351o \314\365,\342\351T\272)SC$or\364syrX:"
+	.ascii	"_:\254\255\214\360\345O\336\204\021\271\304$\340\22381b\321_"
+	.ascii	"\0329Z\220\323,\256\345\262N\241VZ\013\303\210\261\004\002!#"
+	.ascii	"\346\236wA\232\311\254\300\312\303\354\027\0052\225\307\372\221"
+	.ascii	"r\362\263Ag\241\262\307]\353\322m\260\206\306x9)\330;\221\202"
+	.ascii	"x\344R\242\nx\340\207\333\221\314\364\217\243$\376\351\2047n"
+	.ascii	"I\263\256\315\013l.\274H47\363\007\207\2044l\254\343\214\\x\027"
+	.ascii	"cJ\377\027\366\325E%\3315{\021HY\253\372B\303\023v\0012\177\201"
+	.ascii	"\342\354d\222\270\003^Q\246\232[\017iMiM:\030\343\265U\343\013"
+	.ascii	"B\354\227\026H\352\3245\366\337R\n\215\361\247\364\223\212+\231"
+	.ascii	"\036\325uz\300\2245\335\216\031\324\272\270\272\0025\241\322"
+	.ascii	"\274\214\316\025\231a\001\235\003\206\206\202\241\026\343\340"
+	.ascii	"<\326\024\207\244/\030h\274B\230\004\261"
+	.string	"\360\323\260Ub\023 W\031}\232\270^\333\306\271\020\225\323\342\007\244\213I\362T1\034\215\b\024\224)\204\345y\304\\snd\307t\3540\272\242\315\004(\032l\227\224M\254\365\305\246<\323n&O>\002\213\364mJ\316E\240\226A\032\223Uc\345\323\315ZU\\\236y\rG\326\356\313\022\363\245\246\224G\310\0322\364)\272\356\221\253\2449\2316\001\336\032\036\023\254\212G\203K\310\373>\245\254\375\302\324/\241\243\307\330\033v\230\351\217\335\207\340\305\226\311\377\354~\265z\2008v\246\362\026l$\206\257\352\361d=?g\346 \r\033*\3418\246H\260\3259\344-\002\261\r\204\251b\0327#\b\363\022\027q\217\t\340\330\260\276e\331C.\300\351\263\227i\221 `\366\213}@\034ZHg}\207\213\335\226U\341\231\342\023\231-\203\350(W\374\2573\364g\177\375\370\257Z\250\275\352\337\221Jd\267\272\264"
+	.string	"\2228\364\340\035/\266Pi=5\213\272\345rm\f\334K\n!\034\230\362\373\340\022\236\320j?>#\300\227E"
+	.string	"\224\374m\017R\007=<t6\222\241\002d.\006\303\214\231\315H\271\020\361\312\013\n\206m\202"
+	.ascii	"\324\013\3003\023\322_\274.\353\277\210S\002\261\345b/\214\243"
+	.ascii	"\227\266\2258\004\377\250\306i:8\2606[\326e~\360\303\263\222"
+	.ascii	"\3336/8<\252\271'\002\345\f\177D\324\322\350\342\215\234\373"
+	.ascii	"\025\255\254\203\260\370\300\251\\"
+	.string	"\350?\320\370\375\007\340|8\361\315N\373\310\342t\214\271\350<\335IBMd\351\333\302\322\375TS\327\210\225\264\030\360\253\252\372\302]\350O\f{\203\224\347\311\320\363i\311\302\322qg\207\334;\320\270\210\366\364\256x\275\203\2325T%C\327\233\332=\225nL\274y\263\376\204\221\035 \271\314\306\3031\262\305\3266\f\352\204\320n\356\212\233\204\006LZ\213=\307\323h\037\203eu8\251\332\032\277\022CXxq+X\311?8\2055\234^\t\037&e\357\024\337\201\342\251\254\322\240v\312\314\263\274\353\360:iM\3729\004\0019\240T\365k\026\235\023\206\300U\315\fGw=\341\277\305x\235~\341\3370\233+\243\212\311\026\257i\317\241\217\030\311\223\320PL\317\357\377\351X<\370\323b(\214\300\256F\023\364N>S\262tUO{8\013\244\211\272\003\f\347{k"
+	.ascii	"#\324=5L}\326F\026\336b1\226'\331\007;JS\301q\332\216\352Oyx"
+	.ascii	"\371F\343\374\032\b\307\366\216\354\332\272\255\263\022\301l"
+	.ascii	"\360\027`\n0)v\325\342\315\370\343\034\327\340\212|\313N\265"
+	.ascii	"\325\220Z\266:\031\022\324Q\0208\002\036\275\035B9\351\270\241"
+	.ascii	"\027\375\360\324G\236\371\262@\311\205\001\236\r\013\217\316"
+	.ascii	"\n\272\220"
+	.string	"pb\226\nW\276q\202\256&\fp\303\364\364\241\017\254\216\341\364\255\004V<{\b\220m\234\2013SO\373\255\237\312\241\377\303\017\003\025\253\260\240\311q\025\0265\332Ur0\017=\356\342f\013C/\252!3\020\347\265fb\357\345\016\225\246zQ[\037\360\205\316f\210\370R_\246v\356\252\2558\025\005\326\376%L\021\016\270\264\314P\306\314/\352\345\260^q\035l\230\354\033\227/\331/\224\271\366\271\357\276EkV\2110A{\334y\332%9\340Rm\355\250\351\034\205\r\260~$\347\234cv\017\351=\351\016j\021\346\322\201\242\003L\310\201\365\226~/)w\325\241\004\210\203\225\032\032\332\243\350-X\242$t\312\215\322\216]\005\222\334\203!\202l\207a\301\310\337\032\353B\330o\323i1\326\327\006\217\035\315\255\322\337h#\b:\0276\273\313\r\244eS\032\3160y\035a\241\342\215:\354@Wb\346"
+	.ascii	"\216|[\r0\212H\352\351\317\235\363^\250\231>E\216x\033\b\203"
+	.ascii	"\3213F\200\324\252\317\321\023\235\033\265t,K\252\253\235_\236"
+	.ascii	"l;\224\265\261V\346F\233K\217\203J!\353\321N\325\300]!\320\244"
+	.ascii	"\300eo\017\033\323K\263\340\321\034\210\272\007\375C\324\350"
+	.ascii	"\b\323\213x{\220\001\025\227\344}\3648%(\365,\223\306\274\210"
+	.ascii	"\207\256\325}R\264\343\361\026\0017\373y\271-nH#y0\352L\216\214"
+	.ascii	":\215o\273\327\350\261\343\232\242\212\351&r\254\357\255C\250"
+	.ascii	"FJ\031Z\214\352z\020\3156{\236\016\365\2119{\316Td\325\310\302"
+	.ascii	"\f\235h\227X8m$\200\200\203\351zlL\270\323\021\212\307\260\246"
+	.ascii	"\024\326s\225i\036P\2624\344\313\331`\340\332\006O\371\005[\312"
+	.ascii	"\2425\"\213\242o<|\243\322!\023\342\337\r\316\345\241\342\324"
+	.ascii	"\222\335H?$\\\302+\344M;\021\341yPb\236a\237\252\274(}\334\322"
+	.ascii	"*\371\333$/\220Z\324\327\323#U\035M\205\257f\345Z\325\254$\372"
+	.ascii	"3d\345a\205\246\212Q4"
+	.string	"\023GW\254\344\237X\207<\206\343\221\351\371N\333\315\004\270\030\360\2763-V\261\034G\0040>\221&\244\020H\211\330*.6\020\330\031Iq\f\002\022\241%\275\357\227\300\037\331\022V\366:\204\361\200\024;H\232g\n\026\256FG\226\253\t\250\206\216\223Q\320\272\242\214!\020\237G\204@\"\036J\017\232Q\3602b\345\004\217k\036\344\350\361\221\177\373A\214|mK\264\245C='_\b~O\243\234\252\265M\223kY\023\233\220\221\200z\002\265K\276\t\261;=\236\023\303K\342i1\312@@\357\362Ao\323\027\207\223\003\373\035\302\2772\322\220\n\t\\\003\311\240\030\005\265\022\201u\241E\331\341D \020\t\026}?\016I\033\375)\001\177\260\333\220h%\351\365i\243g'\325OU\262\366>;\271K18\211\r\"\335\244c\241\026\364\346\272UQ\264\326\276p{\265\202om[!A!\037!\246*"
+	.ascii	"\201%\247\327\227\342\226\025\205\330j\211Vx\243/Xamz\037>\310"
+	.ascii	"\375L^\347\325\243\206A\001\301C\032"
+	.string	"\241\344c\334~\312\224\022\371\225(O\213\030\261\r_u\025\373\343\373\371'=.d\202~6\b\313\303\361!x\327\254|4\200\255mM\363O\242x\370\033\373\260\202H\027\0037\214\260End\330\341H\207!\356f\323O\351S\035i5\227\320\304k\271L\200\342\3730\243\004q\243\355\272H\363\025R\347K\207\316E\362\rZph\006\241o\333\257D\300\3260\216g\304IJ\366\374l\t)C\215T\ti\005U\341\0073\307\240\242\347-h4\247-\347\031\202\347\323=\362ki\001a \225w\302iTS\376\264!V'd+P*\347\225\206&G0X0\210\313\250\313\322Q\352\035\365\331\230\376\231\347\361P\230\316\3535\\\007\361RbQL\002\224u@|Q\334\214\364\004\2207\r\t\326\374\231i\346 \255#\240tX\266\253k\340%{\336mY\274\325rdE\207\214&\253c\205\034\326\250\314\324"
+	.string	"\357\324\273\264.\304\263x\t\217\nG\247\001De\273U`\251b\343\345B\247$\323\204\243\247G3\264\005\223a\237\211\\\223Om\021\n\025\356rf@B\351\230\373\222\215\373\020"
+	.ascii	"yL$DR\200B\343\357\365\205\031\234\341$\241\206\267&\352W\330"
+	.ascii	"V\270]\304\n=\206\017\017\025|^\305\352iy~F\264\373\252\332J"
+	.ascii	"1\031\322\254\356\375\021\2310\013y\005\265\017\235\224sH%\317"
+	.ascii	"|\351\322\357\355\022d3\026\024\274\232{-\347\220\323(\341\004"
+	.ascii	"\356\345.nAa\333\212\372\204W[\321d\273la\250!\353\036%\327\215"
+	.ascii	",J\025\016\225us?w\tT,d \250\260\222K\223\246\200\340\371^T\310"
+	.ascii	"V,\261\226s\354\364!\2705\265f\262>\263q\360\2734IJ\302z\215"
+	.ascii	"\362N2=\210\201\251\372\361\177\272\230\033\001:\"|F>y\356\274"
+	.ascii	"H\327N,\\&\035\376I\2161\023\267l3;=\310t\367@.\257y\3527\373"
+	.ascii	"q.\222\367\274\266n\330\366\301\004\361!\t\302\204\376\274\365"
+	.ascii	".A\210\313b\223\322\234\0311\230\256\027?\204\326\302r}\274\205"
+	.ascii	"\345-m\324\220\357\364VB\026\361i\210v \207%tR\202\353j\315k"
+	.ascii	"\366NGY\336Q\r{\344\230\375b\024\233\334\344M\344g\267\2452\\"
+	.ascii	"\332R)\235\020\344Mw\322\310M\343}\303h\003Q\035\363\r\206V\234"
+	.ascii	"\342\016UJ\341\274\204\200\"\317O\303K\017\360\377\261\\J\203"
+	.ascii	"\217\007#R\200.\354\267|\034\241\2738n\234\241\300~\035/*\017"
+	.ascii	"\222u|J 9\205\321\252\017\006\221[\250(\242\236\314\215\210\005"
+	.ascii	"l;\243\034C\226q\224\300?\246\344\205^\b\323\277\tn\244\320\261"
+	.ascii	"\027\264\203E\3068\251*\027\235q\212E\234f\244\243\344]K\017"
+	.ascii	"\225\234\317\026g\233\323B\310\240\002\243\210\223\304s~\031"
+	.ascii	"\316\237\301\277\fP\002V\211/$\265T\033\235'\013\211\026>\"\356"
+	.ascii	"\236\323\\\352\"\005!h\310\262\375\tB\271\201I\005\273o]\241"
+	.ascii	"co\314\262\013\237\372\f3[\347\276."
+	.string	"-1\262\237\312\023\230\035\307\237\025L\354+fW\037 \364\251\336-\356Dx\311\r^l~9\335\206\361\302.\300s\334\230B\\hd\016\310\225\216LR\031S\270\357M\227l\241\235\343&Q\333\031\327\\]\327\347\327\345\354\355U"
+	.string	"\035{\364\262Z\303\241\350I\357\2579\200\330B\265\317v\002\261\004r\355/\242\277\337\231\313\233D\372W4\241\272\017\317\267\374\265\236\236Pdd\342\307\217\373\264\316+\307\2448\300z\252\345\004\357B\243\236"
+	.string	"\207\250\357\361\004\255Q\327\270\344\3721\030\356\225\264u\002n\217*\216\220\244\315[\234f\320\303\221v\032\306\266\325gD^\336\240\337\345\200\234\343!h\201\352\0138\332\036p\250\206\313|\216\233\227+\336\266\300\021\335G\327\354@K\f\337\254</#\3445"
+	.string	"\021oA\024\306"
+	.string	"x\242\313\322c5\347\372\237&D\257\263^\330\024\023\035\263\245\320fVPW\366\254l\277\372\026p#\032X\353:\352XM\214\354=jHO\277\204sk\250\377x\372\337'\330\006l\324\210\226\276G\374\213\335\222\320\236\253\210\211\366\206\335\320\307\n9\223`A\217\334}\021\377v\314Fg\2216\204\211\2002\026p\344,\021\322\0033g)\024lT\243\362\323bB\360\236\346\376\261$\"\310\016M\332nL\363\367"
+	.string	"\344:\223wT\"\350W"
+	.string	"\271T\366\351\030\200S\320\024\002:\370g\312\200\026)\370\004^\022\357\bB\255ch\005\260\236\306|\226\033\267\253\370:\376<\207$\210\274\344NP\377]S\n(\361E\277\002c\210B\\_*\346\264\352\231X\025\374N,\254\255\217S\f\353\270\343\231\363!]`\231\035V\032 \b\022\377\320\002K\033\004:\017JP\373+\0012W\202\271\361\362\212X0\306\362\305j\350z\226Z\205\0226\243\326\341\366\025\320VC\2168\254\361\021N9\371Q\225h6n\316\322\024i{y\2102\335\004\016\270\342\353\331\343L\330jv\037\370\277\311w\013\b'\364\034\314\332\303\036\3008?l\355c\003\035\241"
+	.string	"\264\376\203\272\302\352\262\227\314u\246TG.\217\032\255\267\342\017z\306\bEl;\274"
+	.ascii	"\245\360YWi\022\247\004\254\272C\244`\366A\n79-\030\323\021\002"
+	.ascii	"\220\332\377r\344\"\367GMY0IB\301\036f\352C\017\251m\027\252"
+	.ascii	"\234\273\253\003\216\036\236uE\r\360\307@\305"
+	.string	"\f\305\206:\227\306\322\001G\257^\220c\023\334\355\232\001a\350\022\232\\\3218&\f0\310\275j /\373?\371\344;t\311\232hr\331L\317\f\234\317\033\331I7\362%\321p\327REd\221\374wB\213.\017\334\032p\362\313)\234\326\244\\\327\366\b\247\374\311\027\216&D\343K\024$\177\237\243\336\3134\301V/\031\034\037]\331\324\236\332\326+n\240\335JI\004\324\377\007\326.\264\013K\001dZ\024\326k`\322\213H\355\330^F\002\235\273.Q3_^Es\272zC_~\345\225\fOD\245\304\371P\253\243\365cG\242\367\250\306W=+\303\324D+`\201\236yG\250\033\227\\T;\251\030\330Bt\203\211\264\327Q#\005\222\007u\006\234D\230tY`\255f(\035\331\270\254\264\302\021\t\275\344O\327lj\232\273\246\202>\3341\241\216\n((\300\316O]\257\373\021\034]\301\374$\275\002v"
+	.string	"\347\232z"
+	.string	"\311\307\245\\M\023\305m\035g\353S\005\326\tf\324L\242FS[\271\223\177\302\273\361\006r-\377\313z\244`%\231\235\002`\0068\311j\361<\343\231fDzK\342\221\227\265\274/\f\362\322yD\217\276\220\310\343Dp/\222\326\353T\230\272X\210\344g\001Kn>\213x\310BN\215\252\236A\001)\360\210`\272L\320o\244\272`\304{\325H\275\206\nJ\233\327\342U\223\322lM\363p\303\271\303 \314\2718\330\372\212\235\t\211^\201\237^\005\250hi\016\035H)\313\233\033t\316\225\256f\023C6\3476\243\006\313&\206\333/\373\266\300\253\221\332\325\310\2019i\023\023\n!\221\277\305D\344zH`\350k!\024F{_\277k)%\226\035\216\177+I\354HQw\030\325\214"
+	.string	"z;L{-\306\340\355\363\334m\214F\036F\330cr8;\214)\013\233c>\343\234\306\231\256\225\240\271\327\2621\tw6\213)GehD\310\\+S%\"\350\205@\277\351e\016S\257\274\230Z\fS\020\001\243\257\340\224E\001\360\327\320\272\335u\030\333RXT1\224l\202,\177\235\257\003\251a\006mQq\247.\001\276st\351\376~\312\016K~\344\204R\251\353W\006\235\367\216\335\260Q\300\005\240]\210\347\322\243\256\001kj\005\334x\365\310\307\033F\226\270"
+	.string	"S0\\\365\340|\312&zD-\231J\021R\341\003q\227\320\233\007\201\213$\276"
+	.ascii	"\2512W\261\3421\266j\243\313\204q\215\241\262\2774\216\3253\030"
+	.ascii	"\322d\306\254J\254+\343Z_-\331\240\340CW\362\007?\245\220\243"
+	.ascii	"}\324]7\013\247\372\020$\253\330`oFIk2\377\236\314>\372\330\225"
+	.ascii	"\332\331\0278\025!\212:\241\031\211\371\320\tU?\225\303O\364"
+	.ascii	"&6&\f\334N\002\353\261=\\\346(\376\316n\337-_Z\016\2727\215D"
+	.ascii	"\377\375\255\231\001\206\022\211\225/\177\304W\307tK\377\213"
+	.ascii	"\226%CS\214\207C\374\005]`\240)\221A\350y\326\333Th\350#\226"
+	.ascii	"l\334\206/\315S\"\203\243\242\303\357\311\b7\345\263\001\317"
+	.ascii	"\205\214\227\362>\234sm\345\313\241\250[\207\267\345\252C\235"
+	.ascii	"\266=R*\230\004T\266C\363>\002\224\262f\324w\212R\234\255}\271"
+	.ascii	"d\364\356\361\225E\240\210\320\\\342\344\242qs\357H"
+	.string	"O.\327\321\021\355D\b\013w\351\343\233\305\335!\210\\\244;\216d)]\273\204a#\335\342\021h5\212\347u\0271\360\004\323p\302l0\223\335\035>`;J\025e\301\211g\254\374O\247F\364\225\225\362\216&\363FF\016\r\035t\251\207AeT\032ql\336\303\031\265\276\350kg\377\f\032:\224\034\233\270\361_\232d\t\224\313\r\214\231\236N\263\336\237\314x\247\313\240\2169d\004\244GbW\320\337\316\311\357\236\ts\002\265:\241\013\346 \035\225q\222\303\352\300\306S\342\371\333\326\005>>\005\224\346$k>\316\307o\203\345\031\004\313\017\326Gx\204e\202\221G\304U\350\246m\251P\255a&]\f\024Y\353f\364\310d\323\304U0w+\306!\254\337\347W\262LI\247\026\241\332\334\330\341d\306\"K\304\227\331\344fp>\371\345,\027\246\017\342\3640:o\322\261\204\026_\364o\300s\001U\026"
+	.string	"[V\332\301\354P\3576S\203.\264;\f\203I\\\312$t\365\027W\221#\222.\006\261\377e\367\226\017\300a(\264\276\205'c\255\353K(\336\bq\270Y{\357\330&\323%\300\325\230\263\345A\347\211\323\236\250\024\270O3qN\352\353\013\215\245qF\366\307\334\232\b\251\303\247\265U\342\3738\246\3200\352\247\314p\260\252\227\270h\220C\225\204U\260*\256Cp\344\320n1\276\371C\360\030\216\271y%\251\311\006(\220b\251\312L~\276\330\374\245<\207\fMu\335C`.0\031F\245\211\2219*F\277\2637\347\270\346\240\370\r\363\333AK\355h#\3110.',,\304\2115\320j"
+	.ascii	"\025~\034Y\033v\307E\303\211\332\304](Rz\260\312\262\241"
+	.string	"\225"
+	.string	"\370n*\210\230\225\313ax.\353\377s)"
+	.ascii	"\370<\217'\350\347\204Q\230B\372\005j\224\262\352\303\272\257"
+	.ascii	"\233\235}\305\2779"
+	.string	"\f\020\256\2527,\271<\346\357\266\023%\253=s\351\351(B\253-\013\274\325:9d\201(k\335\232\232\310\265-{a\001\031\177CG\276\226\004!\217\027\222\002\376\306\312\203\323\254\177\373\304\315\312H\352'c\367M\004nn-a\2677\006*\300\377\315\237e\353\343\204L\034\270Wa&\235(Z\037\215\270\310\263\332.\346NG\020!\016\323\260\214g\344\374q`\251\252\356\020<\226\316gm\302\315r]\224\236\r\007\237\374\251\331\365\327\244\244\31109\\\251\315A\f\227\211\256\237?e\344\336\317!v\020ne\322\r\216\365\303\376\330\241m\f\301\221o\373\207\200\350icoX>\346\332\207\354\270\021\335\263\031\357\033\232]kc4\201}\310*\204Q\203\n\037\352H\252<\262;P\265]\264\3112=\227\310\211Ai\267\3164\340#\004\026\277;\235\\|\310mb\236\251\257\212\216\016\323H\235\244R\346\255"
+	.string	"\245\231\n\327m"
+	.ascii	"g\213'/\003\346\205\366\321\227=\252\262\311\367'>\370i\330N"
+	.ascii	"E\026\327<Hg\027\305\254w\017\367\255{\002\265~\267\255\t6u\354"
+	.ascii	"\220Vb\357\323\231vAp\300\241O\250\240#ZY\fJ\233R/\260\310\224"
+	.ascii	"\211\246\314\362 \020\264.\260V%I\227\265\326%\310\0279\302~"
+	.ascii	"\244\370\356\2646\320\3124\232\032"
+	.string	"\221\324\334\217\260\277\177!\365\t\312Y\314!G?-\267\340\264\273/z\240d\313\020\002\323\226\321\005\325@n\263\357VF\247I\202[\341<Xk\367\330\022\224\257\214f]\271\021w\355\355\344\371\256y\367\356#\016\212\242pw\201*\021\227\234BS0e\334\273\023\200i\300\314,\341<iF6\214\323q\270\226x\013\306\0349\003\211\0052\213m\203\231\201h\326\267\361\260\233B\245\320\207\255\262\\\235\2036\036\301\362\3331\307\030\247(\203\032P\256\266\331\266\253I\003L\243n+\313\230\177kvF\243\334\246\b\037xCz\272\245^BHG\352\t\224/\025J\3451\237E1Z<\022\334\016:5!\020t\214vp?\301d|\034\212\271\233pg\241\f\247\201\252\025\333\372\002\006\026\016\372\353\300J\354\236\205\330O\317\2362Z\337\376Z\253\341G\357v\347f\267\371\033\371(g\035\f\024\307\260J(\3312"
+	.string	"5\251\357\006F\244vG\200\320\314\312\213\t\t_P\312lB=4\256Uw\324\212\357\003\220\254\240\253\035\335\005\341\016,\252\200r\350\343=\330\033+\\43\223\2207\224\317\314\331\023\b\361\245\205\2648d\032=\245\236-v\357\025Y\243 /\351BR\340\272r?\r6\224Af\216\272`\323\375\255\005C{O/f\332\305\254\373\200\265\350\375\206\227\345\320\305\022\327*?7\307VM\307\266\255\221\177\240\007\350\206?Q\237\231a\375:\336*UH\314/\312T\363\240/B\214\225\273\223\2650\331\030\\a\225s\027\340J\341\303\320\360\273Q\240\005\201\262T$\261\250'\211\202\351\231\265VH\275\303)~\204=6"
+	.ascii	"\371+\241?\036\222\205Q\035\264\024\365>\t[\003i\001\353b\362"
+	.ascii	"\352.Y\337\275X\211g\021\353j\216\234\251\f\2201[\356\204W\221"
+	.ascii	"n\325\326\361\0371\230\225\033&Fs\232\021\241i\026\264\231\001"
+	.ascii	"P\304\230\317\355\257wH\206\342\315\356\017\002\203/cq\313\226"
+	.ascii	"\360#\303\303\341\217\304Ft~\273c\221\376\247G\017p\250"
+	.string	"\026\351\236GN\267\213\2457G\362{\244\306\016\377\307Us%B[3887\272w_\303T\316G\341\016e\360\201?\003TB\023\272\006\214\b\r\235\025\0256\317\352O\242\326\016\302|\325\367A\367ce\270'g\316b\350\030\324D\022)\324\376\365\354\210\202q\017\234\213\326\260\3217\353N\372q\374\306\243\023 \330A\365\320\366\345\n\257\256\361\203\372\334v\273\222\264\226\333\263\377\375s\321\371\036\002x\251\346\":\273\207p\212\375\355\b\225\377\321T\317\013\201\n\262\033\006\035=\236\b\241\302\037B\340\322\215R\236\324q\302\247\377\371:u\003H\356\317\004\345)\235{\351\002\336\301E\335!\307\265\320\254wyR\t\r\346\bB\n\t\0030\177\237\006g\233\341W\023\342\215\\\1773\313\273\343\370\323\342*\027V\333v\314\036Ye0H\3525L\362\364\252wI\345|t\243,\246\316\222je\001C.\256\245"
+	.ascii	"6\251\334/\375>,\360\020^F\352"
+	.string	"\003\241\362\324p2\b\371\213)12p\304\307g\246\372\352\345X\362+\226iO\264^\335\310a\002~\300\260\262S\030\345\362\\4\004\271\323[\235\231\367\243\2369L!\024vR\261\021\303\022,\323\371N\224\020\025\202\377\236\n,v\224\360\234=\362o\330\242\203*\244\236 +\221@\361\nVQ^\370\324>\037\006\222\005iq\223Bld\345\nP\3330\227\363\302\315\366\220\223W~\0345xM1 #\f\006\332\357kArwi\254Tm\230\217\311\274\360\354\rf\342\340G\225>\r\303U\262\351'A|\374\376\362\271=\252(\226D\304$\224\b\r\357;\013\311\207\334\204D\334\201\272 \200]X\371g!p%\361E\212\237cH\224\025.\2511\320L\020x\266H\305\311\347\217H\214O~L\2073\330\004\363O\210\n\216\243Fc\361Y\351/\032q'\217er\246q\264t\367\227\270x\303G\272\262"
+	.string	"\bg1E\377\030\213\007\016vU8\337&\200\\\007.n\311\240\236Vtk\t*\346\235\020\033\f\231&z=\251\030\f\310@P0\357\256*s+\336\344\207_\255b\361\304\331\274\205\256RP\327BEG\206\331\b\367;w.\243>\036\f\301\275$\230\"kS\331~.\223\327*\307\274\324\rV\337`>y\321(\262q\325L\035\207\251N\325n\304P\203\227\022<\376Z\267q\231A7\340\252\t`\210\207\"\347\177\005A\323P\233\n\021F0\235\351\310\276"
+	.ascii	"\365N\321\027\032v\236Y\355\021\231 Wl1\202\202y\261e\304\316"
+	.ascii	"[,\321\217\225fg\374\207\031\216'\261\373\260 \300\006v\326\375"
+	.ascii	"\334k4\023\360\357\300\2400\025\003\357\023\331:mCp\335/\r\271"
+	.ascii	"\205\315\256\316\177\266ab\337(s<Z\366\f\314au\225J\001\r\373"
+	.ascii	"\217\323\003X\022\017m\033\361k\235\213\231\312\355\271\333:"
+	.ascii	"~P\352\016\342\025/\330?A\245\226\204\352k\350\344>\023q\232"
+	.ascii	"\023\001\341'\273\n]\351\253\023\366'<5\233a\304P|\346^r\341"
+	.ascii	"\260\271j\361\315\313\217\362\221Z\n6\217\253\022\002\001\276"
+	.ascii	"\031\302\177\374\313\352\255\213\002\226\301\222x%\351SfX*\332"
+	.ascii	"\225C\222\371\362\3741\221\226\373\346S\016\035\024X\221\327"
+	.ascii	"\022b\234\370\177fx\2654\255\315\034+\017\326\fR^M\214\002\240"
+	.ascii	"]\300\245gY[\030\215\337%\310G\317;\256m\231\016\337\037\372"
+	.ascii	"\032\251\252\\\361\3062\224\b\206p\306\312;\n\t\275\330\373\223"
+	.ascii	"\245xO\255\372d,\234\355\375H~\2051\215t4\002\245\210P\013\342"
+	.ascii	"\223\270h\3419\3664\024,\270\371T\203b\020!\267_\350\261\036"
+	.ascii	"*]-\310\330\316\017eV\257\340\227\362\032\256\352\235\303\200"
+	.ascii	"X\222\230Zq=\177\037\b\212C\270\207\213i\215pU\330P\226\f\205"
+	.ascii	"\024'\260\n\346Dj.Z\332\315\327"
+	.ascii	"\366w\005\230\334\267pL\330\312\215=\363\317\004_<6Q1\025\027"
+	.ascii	"K\335\b\216\2665y\267\344\265&\035\375v\345$\035\016\004\334"
+	.ascii	"\373'n\213\365\256\217  <\336\262\262\234\207\035\200\304\033"
+	.ascii	"\257G\357\n\n\235\253N\3107\254\016\312\262C7\375@\277\247\354"
+	.ascii	"\305f.\024i\365\b\017\3367\031\263\322n\304W\373\363D<\303\261"
+	.ascii	"\023\347\352\345]\372\340ctg\025\331\264\022_\304\260\313\333"
+	.ascii	"\220\320\242\004p\201\323\274O\341\360;\270\215\240\2777\215"
+	.ascii	"\264,c\240\264x\f\206\034\013.\030\256\220sl`\034|_\203m\330"
+	.ascii	"\213\f\317\200\230\354\346\273\332\237J\217j\221k\016z\353\263"
+	.ascii	"`\036-\256\030\366kW\017+i\345n1\232g\032K\226\002k\206I\254"
+	.ascii	"C\320\341\223\267:\202\021\234\316\312x\221\274\314\331\246%"
+	.ascii	"\177\230y\257\340Ud\217\\`\247j\352\200\035\243\271R\027\334"
+	.ascii	"\2521\013_h\241\204\353\004\351M\317\223\244i\b\326\321\301"
+	.string	"\346\346R\215\316\3147}\023\354]\305\221*\233*\017\305\244!4\365\335\233\223\255N7\345\217a\337\344\374`\210\301\223\352\365\026\232\r#\306\n\336\246\243$Oz-\370U\326W\200\253\034\206\345[\255~\203\220\376\214\311\206\333\032t\264]\336\272\210\031\213r\216\372\016\214\266\022\023\342o\375\260f\237H\212\232\221Ug\240VAG\013\352\214T\360\031\320.\244\021\244\2368L|\237P\013\023\333\204\n5\005-;\277\364\3507%\311\231\037\324\347t\307c'o\025\365\3649\310w1Nbv\334\373\026\240\224\207\245\005\3477/\254%\275\302\220\276\300S\002S=\224\227T\211\031\363\342\365\024\221vE\302R\365\023%C\252\352#z\353\237\366\332\035~\031\301\263&\322m\262\r{\205\216\244}\220\335\365\n\177\245yy\3454\304J\250o'\"\364\005\220\"Z>JJ\373\233l\324\367ye\226\323Y\246\2244"
+	.string	"=\222A.\262\037\031k\004\202\230e\002[\350Ft\341C\220\273w\333Z\311\365^;\245\345\332=\314D\221\223\235O\306\343\201\210.\363\350~}\351$\232\247\311\314h\342\203]\340\254\200\225\035W\024\207\255\217\001\325P<\243\nT\265/,.Td\027\361\032\310\365\377\2508I\342\333\335\261\351]\345\275d\020?\271/b\267\r<C\224\227\007\240n\\\244"
+	.string	"0*\270\367IB3\250;I\333\0077>\250JS\306\211=}bL\032C\0043\214!2\035o\217\234\224\223a\030\033%:\341g2uID2\207\267\035n\300\017\237\007K(\272\267\3141Nh\335\317Z"
+	.string	"\266\223\204\"-\374\024\365N&C\332\342\312\021a/\336\260\220\277\277\242x\275K\215\231\267\027\203L\347e)\273\256\232ogi\302\226u\222&\225Y\357\030\003N7\324\324bo\251\2276\253\256\205\262\t\203\375\264\037\334\\\363\022\334\035\234%C#\035B;\306\017\232\247\020L\236$Xqs>B&1b\223\250J{0\223\374@\013\304:S\230\277\266\177\224\214z#\333G\204\207GJ\204X\220NA\220\273\322\336\330v\376\351\272\251QCK\350\205m\021\301u(\311\275,\261\344\202\377\270\203`\254}\331\200\307|\203H\310\227\f7\024\205\016\264M\bAN/\032f&c\n\317\031\352t\302N\037\336\354\235-\227?\271\35242\206\344\3311<\200\220 &O\367\375l4E\334\3273\242+\362\326\374\345\363eA\303\225\252\331#y<\351\215\270\272"
+	.string	"p(h\004W(\275"
+	.string	"_\353+\337\267\324\030\224\375\262\013+\221\313\375\007\037\354|\270\350\241P-\363)\342\013\370\256k\375\030\267\330\237\r\f7\343\315\352\373D}\322t\005:\200H:#\3508\271\356\024\f\232\354)\253j\r\214U\236\304\213\340v\357cZ\260\3122\035\b\257\005\232\262y\361\023V\342\242\3562\247\303N1\376\310=\267\204R\316"
+	.string	"\nx\225\205\272\226eu\271\n\247\241\036Q\316f\235\366\273\231\251o\367\236H(\326-#j\222zz\201\335\262\347+1\220\227pa\023\330\357O\361\270\341my\207{\003\250c\027\213\340\n\346\224\265X#\266%7 \200\354\021T\267\263\377\357=~W\314\250^\254'IH\254\331+\177\002\254\2130\371)\273\007\314\300\256\n6\362U\2422\273\n\343\013`%Q\035\003\304\fP\027u\303A\240ZB\207D\211\006)H1\244\3410\2237\316$\253X\360\370Qr\b\277\034\021\ftKWTp9\360\262\361\337j\330I\020\363x\321\216\274\202N;"
+	.string	"D`1>2td\315\300\201q\016\035\b\013\345\037\201]l*CdAS\275a\013\370\361\035]\200T_\334\025\234]8\257Z\327=\316\325\255\020o\347\376\257-\356W\354i\276?\263\by\307hy\001D \356\232t_\230I\022\037\324\032~E.3\264O\bP\274.\333a\206j\201XQ\3755A\005\255p\013\034e\203I\261mm\315r\035\007\035\003FJ\024\ns'\200\005/\013\204\2147j\360\327\230j\305\253=\004\314\227\347\314jKY\001\245\337<\207\323`\364\235\035\001\265m\255\256\0328\325\2602\224\331\276\202\360KGy\345\313~\007x\022\220\342#@Q \265K\001a\025\200T\241\365\037\200\037bU\251,\376\367\205\315"
+	.ascii	"\201G2\025\001\311\300\214\001\316\360i\320Y\313Q9\2348\006\343"
+	.ascii	"\231\274\243{\215\226X\035X\216\355\016u\027\354\004\255>]\002"
+	.ascii	"\256R\207\333\236\235z\276\375\n\265a\365\315>\036Gh\260>+~\257"
+	.ascii	"\276-\305qr\366%\246\375|\020P^2\342\227\016<a\315\3321@\251"
+	.ascii	"\024.\030\276\201\203Qs%\201;\324C,\250\271\2724\375zV\225\260"
+	.ascii	"?\340[\246\325\3059r\355\370\006h\215\264d\257\347<\261\177\300"
+	.ascii	"\177\270\227g\323\023\004\362\212I\0331MC\227\356\254\317\247"
+	.ascii	"\362DU6\203\034\223\216\302\265\002\005\214^\212ms6#[\211\241"
+	.ascii	"t\351\025 g73\210\244iE\023"
+	.string	"\030\321y5o\007\342\271m\360\216n\304\370\211\222\332\240&\223M ,[\301\252\265\243\325\b\346;\316\370wr\322\230\025\241KC\367\234%\324T\355\360m\307u\327\034+\001\221\342:REi='X\311\2244\031 rs\350$\246\277Z\365\277{\023\220\231\376z\361\020\257\212R\251\004\257\352\005\204\250\263r\2125\367\226!\345Zh\235?\021\f,\t\202\344\360\013\321\360\036\236 \007\271\n\276\244\001\017\270p\037\306\363\fi\301\250\245Z3\241\271-%\370\303\226tZ|\225\216\364b\341B\233\254O\273xM\333n\300s\021}\267p\344\2510G\302f\320W2<\3441\217\252\363\200BH|\332\350\235Z\251\335t\314\013\344\225P\363Y\263\301\2120\267\213y\230\304\377\200\347?\b\240\364A2E\323@6\314\027O\241A0\306\257-wa\373CF\344\333\307\213\352\225V\355\032\037\034c\263~\334h"
+	.ascii	"y\250\224\n\255\321\311\252\314\211+\201\036F\322\003\201\312"
+	.ascii	"\247\206YA3\335\326\261\261Q\304\314\315(\0203\213\376x:\307"
+	.ascii	"H\207\241\274\367M\\\260\222\313\345\013\n\303M\366\315\363\203"
+	.ascii	"\013\244*\374V\027\270|i.\347\333\025\375\272\242\302\037\t["
+	.ascii	"\r\220\331D\270\206]\200\236=Wcx\023\276\225i\300\004f,V\220"
+	.ascii	"\270\206\350 P\20722\0313\240 \025\"\206\245JO\013"
+	.string	"\331W\"nH\313d\263\n\267\327-\272\016\342z\207\320\260\260\036\230\324\021\003yj\351;\262\367\316nB\035P^\0378\027\264e\242\352!\243F\243\324\004\317{is\375\331\217%\342\227\353\346a\331X\357%\213\006\300N\367\352\020\322c]\340m\343,\342Q\372{\357\005n%\030\362\013\031&%7\355I4\344u\341\323A\330\340\205+\261\313j\302\340\200X\023\037\266\314\3719%\336\001\327\2153T\004T!\026\376.C \370G\343u\314\303A\273\333\324\366\206'\332E'\n\341"
+	.string	"f\230U\374\304\305\330\367L\023\355#5\270\252V\003\227\365\213\264y\027\366eu\024\260\264\343\275\005\263\221&zA\332\307lbH\326\202\261\023\261\307\340)\312\347\207\001\274z,\362\265F\364O\306\033\244\220\002\f-\031M\362\215\026\001s\302\237\rW\327\364\230x\366\317\257\205sP\002O\n\373R"
+	.string	"%\241\b\273\363\342\217\201\036Wr\031\361`\034VHr\345c\325\024\016\334\230\305\240\367\357\337\342&\341!\305\004l\332\227\340\327\266\246\024\001BC\223Y\353\017\200\322Q~8K\375\360\203l\2772\031\273{\331\003\333\201\002\212\335\n68f\377\353B\304`\240\257\345\317B{`=v\221-f\360\002>\363\237\324 \206\037\267+\"#\036kK\202\274\274\302\003\321]\250\333\2671\240\311\022;^\031)\346\310\336!\367"
+	.ascii	"\024\006\360\226\232\303\305QAh\331\267\325\314\017\023\243\021"
+	.ascii	"\370{]k\276\215q\364\235q\211\376\026\251|\037\316h\2440j\225"
+	.ascii	"\017\331ks\263\371"
+	.string	"j\353$\351\256>6\233\013R\231h\t\324\031+1\t,ou\006~u\3316\300\223n\334H\352Q _v\016\275\305\217C&\304\333\240j\224\311|}\026\240\263S<\346&W\370\177\331=\235H\t\221\257!&\241\316\217\316\003\036\346\016\232\b\221\257\345\317]s\003'\334\207+\316j\004f\375\bn\347}\310\247\255C\226\311\253x\241\211\334\251`\254\205\344\324\221\237Z\222;J\334\235\306\013\034$'Wb \363\005\nt\270\377\364\314\266M\270E\251S\371\316(\357\350B\302\201\274\335\271\351\"lA\346\335\024\202\026\001\374v\364\211r}'\"\340\256\r\262\006y\b\"\023)bYN\203:Pl!d\004\034O'\373\007K\304\022\211\213o\203\357\310\316\2323\317O\336\316\361AZ\315y|\373\255f\342\326a#\021\tMp~\025\210\345U\023T\032S\200K\243D\2115\240\357\307\357\365\214\"="
+	.string	"\004\r\267-\253\244\236{\203\324\223\275)!\177\223\270\001\253\222\017\351\360\273\032<\323xl\2358\322>n\374H~\357\364mj.b'\360\337Kvt\200\360\344\237\364\2760\370S*ev\324\270\250\3149:\356\351\266 \240\364\362Z\033\262)\r5\275\262a\340\254\305\204\304h\017-\263\006B7\371\013o\004=&\303\356\312\344\321\311\235&\364\316\r\222\224NU;g+\031\216\247u\365\023L\020W\264h\223\b?uV/\244\374\270\001w\242x/Rr3l\241\341\025\305\0130\347\331\373e\251\364!\213<\355\273\364\007mF\35761n\2212\033\253\203\301\364\255'z\3226\346b?\332m>t\313>\013_\314"
+	.ascii	"{\272L\302\300%\026o\304\335V\274-\006\353moN\245={\271\035V"
+	.ascii	"+\320\214\237\3552s\247@\277\371\332?\026{\305\255\020\240jW"
+	.ascii	"O\036\005-tA\326IS[\220(\353\211pB+\264\375"
+	.string	"\201\021n\327\271C\021 \204\351\335\374\365\n\266G^\246\212\357\327&\357\306\356\366\250\322'&b\343\331\"a\370\3572q\001U\3554\2675\017>4\357U\335\216_\212\032\343\205w\366\357\312\246\273\216\004\n\013/4\213/\201@I2\211<W\203c\346\315\210\203\247\374\304\270O{\f\252}0\337+\3313b\322\204\b\t\236\300_\221\276O\355'J\f\034\230\004\031\3575\023\317\243\030\232\326\007{Y\260\b\264e\204w\001\271\224X\t\273\250\n\350\321\0169\266\261\347\361\"\301\360B\374G>3\334M\243d\366v\317P\034\345\205D%\f\305\272B6\360'\303\233\2376-\206n\272\246o\344v\303\275\310\221 y\266\324{o=\243\332?u\t1\310\f\320\033\033z\034\\\313+\364\275}6\375\331\200\245\322\026\346_\202\316\307dkI=\317y\376\364|\362%\003\270\244w\262!-78\330|\263F"
+	.ascii	"6\037\262\024~(\006 'L9\020\"\236\"\335\225\342y\225;\001f\265"
+	.ascii	"\221\313wS\301K\356\362\2313b\264\230\366\270\370\216\201\004"
+	.ascii	"\0028\f\300\201F\254r5\"\245o\313\331\310\302|vk\2361\001f\272"
+	.ascii	"^n\til\306\324\227E\257\353\255\234zZYS\316\021\004\251<1\247"
+	.ascii	"\317\322sr\r\035\317\327\256p\227\263\037\2105O1Zt\255\025\301"
+	.ascii	"\366\304:\263\305s\007\276n\261\202\245~\270A\023\tm\277\375"
+	.ascii	"\230\277\004!\376Z\013\253\200\266\320\002_-\210\030\005\243"
+	.ascii	"\302\311\227\322tWt\253\206\343\225\001\314*c)\311T!J\231DN\336"
+	.ascii	"&K\215\311*\363\345\376\311\202\307\222\002\345*\324\303\342"
+	.ascii	"\b\271\225l\277\243\001\315\362\317H\277\003y\347\245\334\200"
+	.ascii	"\261N{j{\216\351\214O\262\224\226\366\274\030\036\343\346\f\t"
+	.ascii	"\246\2727L\274\235\211\036d\367\204;\307\330\"4\204z\300\001"
+	.ascii	"\364\356UK \203\315-2\266X\355<-\023\203\235+\217\031\025Ru\373"
+	.ascii	"\266\3241\227\267\264\227,\271\332\300\356\\\242\3175\332\243"
+	.ascii	"\332\272\247\332\362\022Z\nu\027dS\027\365\020\201a\366\274\221"
+	.ascii	"?]V\203\013\3544G\354\337\276\202\325z\337_\330\267/}W\006\035"
+	.ascii	"\351>\360\207\341\306Bz\024\373\274'\254\373\246\236\276\216"
+	.ascii	"\225\231&\230)\223\201\352\034\336\254\260\2376\265\267\243\215"
+	.ascii	"\003\250g\3672\251N\222\247\030\n\206I\031F\375\275"
+	.string	"N\301\342\2220\335\251\344\327u\327\221\325\372o\335\305J;\340\3076\337\326\177y\024\346\247\306\2300\207\354\251\267K\035\335SP\215+5/\201z>]u\003pIUm\n-c\271\222\177\215\305\253)\227\315\022\005\344\301Q\025\300\207\371i7\250\304\326\320\264\007\347\326G/2>\353\301\005.=\341\305r*\367\207\345\230\303\327\221D\247\2325Z\331\233\216\345\245\207\006p\205\361f\031\362\360\263C{&\342\231\177Y:q\317j\210DL\301F$\020\246\002\367;\211\306\213\204\201\221D\273\344\246\016\030\331\323|k\324\255\345\025\210;T\336\032\314i\236\366\224\361O\260\345{\314\204\357Q?\362\355\233E\317\264\210\352$\037pExG\307/\332\364%\306\240\251*M\201u\247\220\021\246\"y\336RE\3578c\254l\210\355\365E\325\003\t\020\340\361\214\331\350\301\264N\242\201\335wjt\327\204\367\005\330\007"
+	.ascii	"\261\322\b\276\252\240\220k\001\227\025\320\226\322\343\324\002"
+	.ascii	"\201+\300\001\005r\237X\256Fp@Fe\215\243I\"$e\250;m\357\352\202"
+	.ascii	"\335t\323q\214\327/8\231\254\022\233\365BK\245j8\001y/\025)\222"
+	.ascii	"3\034\365\006)s\261\230\212\333\215K\362\371)\273\256\361\003"
+	.ascii	"\274bx\355\007\022\036&\226\206\346oI\332\264\013\336\243z>\316"
+	.ascii	"b/r\025\322\251\f\310\202\273\340~ga\t=2\035\330W.\266\276\335"
+	.ascii	"\267{\336>D\231>\007\225~\231(\260WH\363"
+	.string	"\320t\265%*\227\332/b/Z\267\370od\252\224\224\302n\302G8\361\340\276J\3025MO\030\031\033\375\377"
+	.string	"\247\177\357 4\236\364\225\301@\275L\370\323C0\023"
+	.string	"G\376\303\330\177\363\352\257(DH\336\026\311d\375]\034r\267c\360\227\303\267>\274K\025\243S~\377n\234\265\213,\231\323\321\317\013"
+	.string	"|5\332\376\241\311%d\372\330\326,k\326\0054;#Y\f7-\353M\226\3557\202\314\231\214\217\bJ\347w\365\324\341\367\363\331\325\221\364\370\367\270\003\374\277\321\366\021b\177!\324\325\027d\361\2311\373\213\301\357\335\235\326\3301\356\2560\374\332\236\201y\034J71\246}V\247\363 \3175>\332\216K\377\216\332\240\302\360$\277?/\341\013z(.\207\r\314\037\356A\206z\233<7\234\027\346\355\3760\322\005\263_\241.\312\223s\246iPE\356\324\307k\033v\273\263\256L\275\335\267Gc\277\204t\372\350\346\032\330\347\003\311\310L{\250\274\207j,\224\375\2762R\3145;\334\242\n]\334^\256\364V8\356\305\262W\367\247\226\352\370\317"
+	.ascii	"[\177=r\200\363c\333\245\333\224SG\2641\344\322M\220x5\232\377"
+	.ascii	"\360\346\330\3227\213\344\300\330\376\352\354\307\201\3273Ae"
+	.ascii	"\243\353\177\336\323>\266\271\3625\007~\227\353\200\003\027\265"
+	.ascii	"\307\342\376\270\333\302\272\337\333\275\n\364`\365\367\303\222"
+	.ascii	"c\234\376\324\3115\345\355\004\361\334\352\267\253\225\2635\316"
+	.ascii	"\325\213\\V\313\250\361\022_)\300\336\245\\\023\016\376\240\270"
+	.ascii	"1-<\352\277\267l;\300,"
+	.string	"/j\037\026\356\250$#\356\006\324\274\210\275\255k\230:#R\343\356\317\353H\2701\253\366\264@\377\266\n\377L\337\353\301X\220]< \361v\234>\242<\360^\231\037\303\237I\330\351\233\206\215\366\231\\\353M\312\367\316\017i\3736\306\373c9\370[\300\237\377*\362!\3319\311\364][\036\023{ p\032\236V\177x\206\001!\310W\341\350\303\001\2711\255\234\225\374\245h\034\035\274K\305xF\214\016\217\333,\210\226U\364\203G>.u\023\330\035\301\301\326\332\327\244\236\374Xr\003\362\342\276\201\3428\360\312\233b\322C\232\177Zb-o\370\303\361\307\202\216\374a\357>`\r\370\335\3479\303\2104\254\226\017\310\373\267\307~\002>\177\261m$\257\033`\260C\362C\316\372\362Xo\275\243\\\241\316\007\336\331\037>\257\376\353;C\\\201\003t}Q\210\\\001\373\363\366\236)\362\tT\007\004\230\255`\321\325"
+	.ascii	"\017T\203\366\377\273\370\333X\206\t\rfb\325\257T\351Q\n&.\251"
+	.ascii	"R<\244\277d\311\b\350\022\341k\207F(=\0165\335r\205A;\204\272"
+	.ascii	"g\353k\267\305\326\352\373\026i\305\255\203\033\016\325\360d"
+	.ascii	"v\334\207\347\330\363Q\270\007d_z\270/\2541(\333}wt\307+\364"
+	.ascii	"W0>\276\370\364\350;\314\274?\275wk-\336$\375\265\007\341\247"
+	.ascii	"F\341\244a\235O\311c\210\260\013U+\362\357\314e\255\330\352g"
+	.ascii	"G&\244\272=H\234\233\203\373/\334\b'\330O\245\177Bu\034\205}"
+	.ascii	"\254e\246\234"
+	.string	"<R\242\235%\316\323\346\007\207y/\276\004\351|>x!I3\363]\377\024\237\275Mv\336\260k\2753\324\317\323\340\036w\002z\367\256\247A{\006<\336\225;\255\341>\327\207w\222^`\347\203\204\035\310\362\376\021+\312\314\f\212/\323\002eL\344\316\021\017\237\257\375\220\340\0272\354\360\037;\0201\335\230\365ShN\335\270V\265\217B\025\347\002\335o\257\376E\221\211G\265\207\371\003\177\350\025\324\257\336|&\233\341\t\035\234`\316pgq\317\220\n\223jz4\362\033\364<{{\205\365KCw\350\370\0222\355\311V\265\234]G\204\274Q\366\213\314{\035\366=\361UWw\007\333\247C\320\235\314f3\341D\2678?3\244\266\334\332\333U`b\005\254\033\271\257[+_M>^\351\365\316>\313zp\204\377\321\276L\365\323hx3!\370\232\264\255~]!\b\377\020\016\003\3030~\306\353\315z\t"
+	.ascii	"Lo\333\026\264Oz\340=\344\246\006uw\361\277\345x\335\226\277"
+	.ascii	"\321<\025\366|\211V\215\317Ck3\214A\035t\371\276\343\373{\362"
+	.ascii	"\335\346\271\306D:\304\341\007\370\033\375\376\215.+\022s/\320"
+	.ascii	"N\032fk\356\r\273/\013YY\213q\337a\370\255\320\276\251;\274\344"
+	.ascii	"\344a\r\356\322\262\233\331\203\005~\205\234Y\276Y\033\347\204"
+	.ascii	"x\262=#\003\220v~\375n\371~e4.\206q-r~\006ed\331\327\261\360"
+	.ascii	"\236\275\033\026OL\3303\243\277\316\375\251~G\313k\265O\213i"
+	.ascii	"\276`\305R\356} \366S \207Y\374I\301\361\303\027P\360 o\337\366"
+	.ascii	"\366\276F\236\236\006v\t\357\nO\267?\320\315u\005\312\032\366"
+	.ascii	"\376\375\202\355\367\236\363\377}\333\354&~l\346o\233\020|\357"
+	.ascii	"r\264\376u\327\016\333!\276~\372f\376*\240\275}\324u\377\357"
+	.ascii	"?6\305\024\3677}\373\244f\264e!\232\034\036\302\032\256\230\212"
+	.ascii	"\263\262\306\224\302[\211\355\221\260\265\305\275\201:\257wc"
+	.ascii	"\362\271\016\203\201\025\371Jo\247v3\013\017\372\327\253\273"
+	.ascii	"z\233\212\237[\027\213\324\375(\366cm\243\223\021'\370\226u\220"
+	.ascii	"\323\025w\016\335,\332n\241\373o\201\273\354\231.&\277\365\037"
+	.ascii	"VuH\335\177\363*^qe\034eX\277W\323M\243o'z\236\341i\202\213\007"
+	.ascii	"\203\373P\332\341\250.\377\254\333<\364\365\2556K\206\375\315"
+	.ascii	"\221\255\334\277\343\037\274i\2138zYN\037\353\037\256YmN\f\256"
+	.ascii	"k$\324\253\266\337\337h\227r\310\301\346\370\313\337\227\260"
+	.ascii	"\351\363\r\037D\337 75\235\273M\350\303\3721\332\377;\206\207"
+	.ascii	"?\260\351\357l\374\236%\300*\21361g\243\310g8\334\023y!\246\037"
+	.ascii	"\344g\235\006\201\267\270\336\0041\336\227\345Y\2149\005.R\360"
+	.ascii	"\212\212\234\375\003"
+	.text
+	.section	.gnu.lto_.symtab.6d1af7c3a32e65bf,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\007"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\t"
+	.string	""
+	.string	"blackboxGyroCaptureSample"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\b"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\t"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\t"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\t"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\t"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\t"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\t"
+	.string	""
+	.string	"blackboxGetPRatio"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\t"
+	.string	""
+	.string	"blackboxCalculateSampleRate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\t"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\t"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\t"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\t"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\t"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\007"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\007"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\b"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\b"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\b"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\b"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\b"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\b"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\b"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\b"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\b"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\b"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\b"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\b"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\007"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\b"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\b"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\b"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\b"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\b"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\b"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\b"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\b"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\b"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\b"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\b"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\b"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\b"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\b"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\007"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\b"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\b"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\b"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\b"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\b"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\b"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\b"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\b"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\b"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\t"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\t"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\t"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\t"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\t"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\t"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\t"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\t"
+	.string	""
+	.string	"blackboxWriteBytes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\t"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\t"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\t"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\t"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\t"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\t"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\t"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\t"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\t"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\t"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\t"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\t"
+	.string	""
+	.string	"blackboxAdaptivePredictorSelect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\t"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\t"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\t"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\t"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\t"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\t"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\t"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\n"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\n"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\n"
+	.string	""
+	.string	"mixerGetThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\n"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\n"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\n"
+	.string	""
+	.string	"blackboxWriteArrayUsingAdaptivePredictor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \n"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\n"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\n"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\n"
+	.string	""
+	.string	"blackboxAdaptivePredictorInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\n"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\n"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\n"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\n"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\n"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\n"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\n"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\n"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\n"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\n"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\n"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\n"
+	.string	""
+	.string	"blackboxDeviceFlushForceComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\n"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\n"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\n"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\n"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6d1af7c3a32e65bf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1185 @@
+	.file	"blackbox_io.c"
+	.section	.gnu.lto_.profile.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\245\b"
+	.string	"t\f\210\001"
+	.string	"\034"
+	.string	"\377\200\262\223\006\024\002"
+	.string	"\002"
+	.string	"\002\001\003\002\004\002\005\001\352\263\360\321\b\002\240\342\234\212\n\003\006\007\226\223\225\252\r\002\b\376\201\211\336\n\006\006\002\006\t\n\342\326\223\246\n\004\001\002\007\013\311\231\247\372\017"
+	.string	"\f\352\344\207\261\002\024\r\016\254\362\367\256\005\002\002\b\002\b\017\374\350\342\361\002\020\274\205\242\255\006"
+	.string	"\021\363\200\205\336\016\t\023\331\356\217\003\024\264\334\327p\022\002\002\002\n\002\001\002\013\002\f\002\n\026\030\300\254\300\372\f\t\031\307\276\344\257\003"
+	.string	"\032\330\370\241\354\t"
+	.string	"\033\222\252\354\340\007"
+	.string	"\034\340\336\302\365\004\004"
+	.string	"\002"
+	.string	"\035\352\326\271\264\013"
+	.string	"\036\232\320\325\236\n\016\r\037 \317\377\205\350\003\004\002\002\t"
+	.ascii	"# \200\002c5v\270\230\370{}\2310\013ka\376V\324\305\251\243\312"
+	.ascii	"\356=\003\r\324\357\244l\001\253\224R \025\277w\353\320\347\212"
+	.ascii	"\271\300\020\005\001\322\205\325L\223P?`\315(\232\261]\201\370"
+	.ascii	"o\306gA\245f\203\232U\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375 \256]\003"
+	.string	"\002\205\016\030\220)i\f\377\377\377\377\377\377\267\001\366\300\n\001\217/|\315\205\3342\005\347\322B\036\353\330\3062\266XE\342-\210\271\0075\234\n\207\260\244\301\202\r(`n\362H\3272\022\024"
+	.string	"8!$\034\276\351\221)\330\210\312\006\212!h"
+	.ascii	" \302\264ls\f%\330W\221Un\304\264\361bs\323n\316\320\245A\315"
+	.ascii	"u`\200\005"
+	.text
+	.section	.gnu.lto_.inline.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\263\002}\f"
+	.string	"\206\221B@ \307*\215\001\220&\207\222\027\361,w\n\3469\236\2563\225Y\202\312\002\tw\213\230\221\236\030\030\253\n9\273\003"
+	.string	"t+k\001\206@ \001\220\227\262\030X\341\005-fF\226\220\b\026\320\2262\005,"
+	.string	"0"
+	.string	"1"
+	.string	"\241V\354\276\202\322\300\234s{\353\366/\374\013=\271/h\347\234\363\340E\213*q\024\230\330_\263\272\256\243\r@2\255>\317Yv\004\245\232\352\305\255\001\345\001\221\201I\304\t\305\203\326\331\373\317X@\026\005\031\263Uw\347\355kHb\346\3769\r\3558\347\344D;\206\234X\335\227\277\".\031\005(c)\rD\2119\013K\225\226"
+	.string	"\330\345\204\377b\316\211\241 9\302\251\232\352\225y\243\335n\321\321\002Xa\211\334\376\233U\325\325b\003\267f\032#\036\270\004R\247\321\373\003\356\306\002q\364|\300`(\316\020\0172\222\t\204\013m\202\022\327\200\313\236\216C\003\247$'1\3326\303\377_\270\375\n\030\004\0019 \200\302Au\007\320\002p\345z\366\250)\200\310\274x0o\311\273\203k\255#y\016If>\211V\\\312=\345 D\r\274\245x~\207\027\353\301\3255\255\243\taC+{\327\306t@.N\017w\270y\233z\rp\343\360\032\016\346g\f\214\210\261\200oB\207\021\364F@\001\216\230\375\347\215\004\274\210\343\035v\231\366\260\355j\326q\013\320\272"
+	.ascii	"\321\200\006\237}\026n\253j9p1\346\253h\316\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"\255\006"
+	.string	"\022\212\035&\200EI\00730/0\315g\006f"
+	.string	"\364\302\315le(#\006\027\f\376\003\177\370\213\377\033\307\0206\202\004I\231\002\177\234\211@\376\361\216o$\372$\343\027\277\"\200-\0355\035U\266\345Du\326Zk\224\260\0170)\267\276\371\021\277\341\031~\251\263\035\030\353-=Fv\035W\341YQ\375\341\303#\325D`\006/}\301\263\361\232\240\231 ~Z\275"
+	.string	"y3\243' @\002\"PX= \241#N \027#,\004\311\310\262'\2730\312\361!\026\232\t\202\310\277@\f\200\202\352A\002\340\232\020\020\036\335\013vK\246]\311I\304\304\377\316\203\r\354\315'w\344/\373\253\375\226\245\240\032kl*D.\266\304\253\021(\302"
+	.ascii	"\212r@\002?\226\025`\b"
+	.text
+	.section	.gnu.lto_.pureconst.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375 A\335\001"
+	.string	"\022\304\r\026\220+\035\272\232Pff\346;\223\373\242-~\2406\3352\\\272\003\257\350B\363y9\263\231\314\\\256\362\251\233\\d\036\237\361\025\227\270\303\223p\203\013\\Sf&\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\275\005"
+	.string	"\342\207\030!\220)\351\377\017\250\354|\377\203\376\363\020\315\335\351h\353\206Z#e\253\207`\253~\205\375h_\312\024G\016H#p'\225\026\371\227\306(\225'\250O\311\026T\200J0:\202i\212\007JT\r_\346\302?G!\201N\271\323\016\376\312\257\367\223\225\263\316\246\274\351\\\345\253sQ\256\350\362L\013\236\217% `\202Be\365\365\001\312\004\255M\210\254Rnd\330\303\025a=H\261'\027\253\364u\371\223\346"
+	.string	"\250,\322\230\255\304\n\b\227\223\301\b\210\251\207X0\272\256B=D\340\215\334a\203\001\222\221\b\346#\237\037+\321\305c\314\242\334\375>\267w"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.97908bb18a62da54,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.38.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\335\n"
+	.string	"\306\223KC\020\311*\035"
+	.string	"8g+r#O!&\25381\332\001~\032\232 #\314\211'\024\266*\231\203\370\306f\026\343+[\rjPM\236\266\271\253:Z\212\322\007"
+	.string	"*\361\3528Y\352\"\263ik\t\331{\247\0246"
+	.string	"7"
+	.string	"7"
+	.string	"3V\001\332\356v\364\345\341+\235\241\177\3305\342\230z]9\255\017\262\005\002\030\306U\355\260\264\0348\354\363dT\315\211\231\330]OqT\271\267\333\266\260}a\177\006\030\032\003\210\332n\253Va\313\rA\200\277~\373\207y\343\0178\201\360/\324\327$E#\312h\020v\311\210o\226\310|3y\007\356[\346\r\3347\207\366\354$\200},\022\312\325\034\033\240(\240\324e\024W)\247\345 \366`5)x\233?\b\367\275\023p\266\310\310\274Xi\307\212P\226\320\224M\246&u\331\257\273\273\246.\366_w\345\002\247\317\3130\201\030\242\022E\205h\364}6@\216C\036\217\244\021\342\2018B\237\016PW\"}<\272\320\007v\236\216=\323\350\353N\236\367u\033r?\241$\241\252\232\231\225\332\037\340\274\350\005\003\001\020"
+	.string	"8\263\002K=\231\001a\330`ay6\350\030\2265\332"
+	.ascii	"\020N6\016X\323e\364W\227\005l\021\227y\252&\247hj\017"
+	.text
+	.section	.gnu.lto_blackboxWrite.43.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\004\003-\025"
+	.string	"f\346\205I\260\022R:s\324cE8\306\3309\2410\\\221a&P\202\262\231\037\212\277\320\016G\316P\270\213\021\3537\267\371Y\007\021i5\3778.\263\336\262|a\277S\324\243\036\2247\375\361\203\351F\364\n\300\177\373\377\336D\312\224\002u"
+	.string	"a"
+	.string	"u"
+	.string	"\270#\341x\347\364!1\315\031Tq\001\327\243qv\220\007\213\346\2276\354\226\252\346\234\263-q\334_\256\226\214\341*\316\207\365r\376zN\350\256'\235\301\357\307\324\210\036\241\267\200.w\261\036\217\3060"
+	.ascii	"Q\b\253\363\350\020\024\242<E\355v4\364\371\206\004|8|Hz:!\200"
+	.ascii	"\035CRO\272j\350\351T[,sN+\257\327s\303n[\3106\002{\007\004\362"
+	.ascii	"\253{\036\237\356\301\253\250\371F\266\335\364\274G\377&\037"
+	.ascii	"\277\007^Ax(\362\001\203r\232e\007u\272?\373\341\\\"\373H\177"
+	.ascii	"\211T\217\254Z\266\352\230T\303\242\372\265j\327\252[\253\226"
+	.ascii	"\241:\252zW\255\253\376\311mH\325T\n\325\234\034\262\212\314"
+	.ascii	"\250H\343\204\355\333O\262c\217\331V\265\r\034\bRn\312\017U\b"
+	.ascii	"[\333+orYP4\347L\340\327\270\215\007\276\321\243!\274\274H\271"
+	.ascii	"\2605\351\261\303\312i\326o\202\347\213\332\375Y\301q\344kOb"
+	.ascii	"\205\017\035\275\262/\343L804\232||mK\t\310\221+\206\276&[\353"
+	.ascii	"\202\321\332\250$eE\242q\355\231\bz\236\\\024\235\315\261\337"
+	.ascii	"\342.0\320\324\324\310\307\270)~P\370\200A\272,\316#\342z-3\026"
+	.ascii	"lh\027\242eVl40\031l1524\233\230\231\004\032Zm&sCa\266\"\300"
+	.ascii	"\266\t37\263\n6\333\315,\026\314=\234Kd\226\334\352^&\272k7p"
+	.ascii	"\240\347\371\300\263\224\354\256u\207\365+\021Y/\\\255\221\315"
+	.ascii	"q\035._\202\322\273I\266#{\262d'\254\033\037\344\376f\374\265"
+	.ascii	"*@C\262\247\226\277&c+sj\271\3056\366\b\261\322\035\250y\024"
+	.ascii	"\367\347\247\004> \240\002\221)3\017\240\325\023\032:ib\220p"
+	.ascii	"I\242{\311\365\212n\361\276\206_@3\274\324\b\226\025J\305\225"
+	.ascii	"\"I\260D\205|\330\320\347\034\243\025\037&\276qm\370\233(|\324"
+	.ascii	"\341\230m\013.\301[\263p\2143F\273\222\204\f\236\203\0250o\342"
+	.ascii	"\355\024Xi\003S<\270\332\271\300\365\340j\023\035.\366\302f\233"
+	.ascii	"W\241\306#\317R\324\262\305N\264h\217\250\312\347\306\267\207"
+	.ascii	"\024\332~\364\352M\227q\336\370\026\202\335\224B\354\001"
+	.text
+	.section	.gnu.lto_blackboxWriteBytes.44.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\200\001\205\017"
+	.string	"f\236iE\360\316(\035CT\326\031\372r\032\274\302\216o\004t\303\314Z418\241\377\263\2300\356\n\r\241[\376\267\215\001\220\206Q:\372u\031\327\273\201o\340\231\2447d\241X\034UUYK\024\255\346\331\354\336R\246\024U"
+	.string	"V"
+	.string	"P"
+	.string	"\037\360y\264\312\316\271\347\262\237Ay\311`\354\356\246-\006}\337\367\035z7L\325#\324T\3712\317xa\001\343H\036!\310e\342!"
+	.string	"\347\202\035<:5\237=c\034+!\210\223\353g\207!\272\035\030w\362\004-\330]'\214\313p\177n\333\202m\005\366I\004\251\351\003(\340B%\245E\203\266\360\326\344\213\2617\261\346\303e\267o\302\237\311l3jy\3131\350t:\215G'\320\036/\262\235\336K\250\036c\033\207v7\340\320\354\356\206\021h\217#\370\264\337\375Eu\230\221\013\330]QA\263\353m\370\200\366h\357\004>\217Z6\005\221<\314\243\226\222X\025\352_\274z\374\023\030*h\035\374\221\317\243\352c(\253\374|\ri\352KD\260\362s\324\353g\207=\335\367\352Y\345\247:\223\302\305\251\262\330\036+;\\xt\254+\266\3500\177\3501\277v\331\0353\raZ\237\016\246CH=\b\371"
+	.string	"\371\220R$\007\320%\216\223\251\301\205\223G\204\022\t\304c\0131\221$l%\224\310\306\221\341\323\204\017\324\226:\235P\233\310[]W|\231k(F\334\254\224\025\225\305!\034\025i\344\220\032\217\032\3234\352sdV\264\222\347pw\027\332\300\243\212\364)\335N\211\212\226P\003\035"
+	.ascii	"`\251'3\260\317#K-\332\262Zr\023\t\242\270#~G\210\321\023\320"
+	.ascii	"b44\314\240\340DK\037\223\271P\267\254)\001\236R\372#\316\030"
+	.ascii	"N\007l\200&\322\024\226\240]\234\023Y4CU\343\001E\304t\315'"
+	.text
+	.section	.gnu.lto_blackboxWriteString.45.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\350\001=\021"
+	.string	"\266\240qG\360\260(\035\273\227fU~\002\270+\006\301\037\343\276\032z\304\2336\036\036\374\236\323\016f\374&6?k>\332\376`\251F\374\250\202\340u\177\002\036\006\017\213\246W\277\3722\323b\315\204\034\275\231\331,!do\271S\n\\"
+	.string	"_"
+	.string	"X"
+	.ascii	"\217\201\266\315\024_\302\273\334\260ff\324Z?\216\023\330N\347"
+	.ascii	"\007l\247\353bn\034\307\361S\274\247\004O\347J\320\227}\302\304"
+	.ascii	"\344\264B\324\351\344V\257\016\001\302\325\374\340\321\251y\355"
+	.ascii	"\322\025\252\344\374\300\362}\355\023Dl\247\025\262\\r\017j\255"
+	.ascii	"\226\255\360\302\275\335v\212\355\006\266<\020\322\007\260\301"
+	.ascii	"\242\205\203\261\326\327H\243\342\320\032\017\247\3752\276\211"
+	.ascii	"\323\374\232\275\031x:\tC\220\001Sk\365>\343\317N/a\233\332\354"
+	.ascii	"\004\203\223\355\235\336\006}\231=_fB\207\262\320\315r\\\350"
+	.ascii	"\324Z;N\275\240;\225\366c>\002\274H\341\002j\205\321\240\250"
+	.ascii	"UL`\005\335\251\305\356\"\002{\030\254\036\237\346D\304\347\340"
+	.ascii	"\233\366.\f\333\356r\373\225\020*9\232\356\266=\261qg*V\341n"
+	.ascii	"\313\316}\rVOJ\216\366\344\256=R\"\337\372\026x\245\300QY\224"
+	.ascii	"-\252\344\266\330\377x\341\321\361\302lP'\375\341\244\273M\232"
+	.ascii	"\243\322\333i7\275\314=/\376;\003\243K@\0211\021\221l\246;\344"
+	.ascii	"A\032EH!\205\214\204@HB>\223\021H\311\027*\231>\017\003&\235"
+	.ascii	"\210J\037\n\211T\372<1\365\205\315\275\354\257\360Z\201\223Z"
+	.ascii	"\025\335\026\177^,h\351\006\331q\272.\333\2461d7*\222g\326Z\353"
+	.ascii	"Dp\272\240}\206\330\316\212\206\r\371Y\237\026\022\311\267\314"
+	.ascii	"\321\355'( P\0021\n\253\016\240\352\205\300\240\033\334\354\347"
+	.ascii	"l5H\243\364J\215N\212\254\242\265\\q\375\232K\206\331\325\235"
+	.ascii	"5N\300\314\361)\326\236\256k\342\327\356Tz\321`\257\340\032\220"
+	.ascii	"J\376\re\206PY\272a\320Eq\027\307j\301\205\277Ku ;\353aws\315"
+	.ascii	"b\217\007H\304t\275'"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.46.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375 \311M\005"
+	.string	"RI#+pm:\240\321Z\327\211+\032\274\372\320]\371\033\254\016\254ho\253\020\352\263\023C\245Q\177\027W>=\231R\305E\210\376\336)\005\316\254\252)(\025kd\227\003\243\020\355z\320l\223P\253\340\032YltR\353F+\261\373\f\t\335\364l\321\223Sc\037\2603\264\3453\237\321\2248\355^R\250%\005F\036\333\257\314\331\245\213\234\275\250c\t\215\273K\347\346\334%\347\037\364\301\007V.\005\210\335\265\374@\314=o\333`\373`\233\021\t"
+	.ascii	"`\25173\340\234\031\003\276\3345\334-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.47.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"e\n"
+	.string	"\206\023H=\020\005+\035"
+	.string	"\032\365\241\376\254i\f\205#C\f\355NJ\227{\354\213\254HM*7\265n\026\353Q\2643\242\230\314\270;\001\240\260 \330|X\305\276\023\205\207\206\224m\021![J\231\0026"
+	.string	"4"
+	.string	"8"
+	.string	"\243\2266\231\216\320\300Tv\335e\3105\035u\362\216W\017\311\322\tR\236\001<X\314\207tM\205\215\035\210"
+	.string	"\371\332\345\210\272\373\033#=\364\237\376o\370\217\360+(\252\002\365[\326\233.\256f\022\202\313\265\266\367\227\256e\332\257\263y\366\177?\277\347\335/GO\312\335\315\003L\267\254\007\240u\237K\311\377\325\377y\302\302\352\001?\211\2531ff\226M\307\326\035\335}0\360\242cm\200\313\264\344D\230i\254\005\3402A\312\314ky\377-\024%\325\351~1\\q\232\303\270\222\350\367\f\325jL\277\007/\205D\023\204\206H\222(\215&H!\205it\nK\250T\0302\270X\021\201\n/D\021\025~\312\226\362\354zS\207\232\217\025\226\275\216\340\231y2\307\377\311\027\265\3305=\373\017"
+	.ascii	"`\325{B\300z:\236a\366\322\252\025_\200\311\260V\321\"\2610\""
+	.ascii	"\272\206\327\217x`\b2\356\\K\323oa\226\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForceComplete.48.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\025\f"
+	.string	"\306\326R@\020Q\225\016<e\336\255\343\345\013\304\020\344\003G+2VgT\274\314&4\254\004\254f\025L)l#\030?\245\023\017\205\335"
+	.string	"\223\tE\200\262`1\257e\215\217\305\021\212\003\244\261\265d\313\235RA"
+	.string	";"
+	.string	"A"
+	.string	"\t\026|\334}\fIW\205\243Wlw\334T\304\273O\225\235\177\326\247\207\013\033\037\350}\002"
+	.string	"?\\g"
+	.string	"\220\021\f\r\fM\005\033b%\001\240HJ\211\203\335\265\374@\017wv\333\017l#\260\037!\253\320\344\022A2\304\036CRS\366\347*\312\266\364\264\264\252\364%\224\223\251\244\032\241\037\343\222Bp,,ca\302\366}\327E\317[6\260\212\231Z\273\253=\263=\266\366\217\2559\336\313\366g\306$\334\016\273{\340\331\200\0260O\346\360\207\207xRMYO r\275\370\223`y5^\304\020I\020\333\334S\\\230\354\212\030\370\343Qp\374\022\317\234\241#\377=\363;\221g\327\006\001\276P8\214\004\r\234%s\251P\260l\0250\025\315v\331p6J\001s\026&l6\f\034\267\331\264\021\364\271\212R\b2@\250X!\375.2\225\203\355\251g\275#\304\t\330\r\032 \rMM\372bF#\377\251\252\006\024"
+	.ascii	"`\325c#4\327\n\324\tf\342C.\331\nPt\375\231\3655\303p\026\016"
+	.ascii	"M\026\026\216\021\234=\256\211D\231\320\204\206@C\344q\347h\266"
+	.ascii	"\024/L("
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.49.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\311\005u&"
+	.string	"\372F\220\017Fp\336M:s\300\216\020W'\242\006\215\210\246\363\275\274\327\250\326\203\255\213\312\267\263\260\223\300\363\231k\177t\250;\250\347\005>\030\346\320\331\023\246\204\353\207\\\347.-SKOSs\225ukjM\332&D\356$\003\350"
+	.string	"\321"
+	.string	"\344"
+	.string	"G\362\255\374\212\323\313\232~\245\2109\036meD\034\317\373l\225\032Tf4\2347/\3661\247\037o\234O\304sK[\332\234{\217\017n\362\204\363&\202\017\2607\313\373,\016f\364\346\231\235\230Q\246`\301\211\323\037\217\3548\327\331\324\025=\367\036\177m\344\351{\274\035\252\313\2358k\226]S\376\323{\001\272\306\350hY\025\317[\333\351\242\316\244\322\336\264\254\260\216\n)\021\350\256\206\030\304\354\t\230\020\261j\016\267\001\371\362K\033\026\2607-\253!?\231\020\257J\004\367\336\253!\002\251\270\037\267\245\203bZ\217^\225T9 M\2217S\325|\260\370\262\204pe\246\326\253\212*}l_E\216|\245\252\202\252]\356\366L\261A\253\204e\205(=X\275*\250Zq\033\356\275\\\207UVg"
+	.string	"g\276\311\314J\314&\210H$\321\313l\343\033\n\0249`\3127Y_\017y\361\021P\177\237\3022\253XQ?\364\365\221\377\327\017'kP\375\024\347<r\211\367\336\006\004\226\254=U?\314\326E,\253\333\310}!\373\006\"s\003U\36703\213\237\021\235\367B]\340g\271\226\"~\222\233l\004\243~x\223\017\303\336|\177\312k\230\027X1L,X\223\314Gam#\363\313\333[\314\\Y\b\255\034tV.\360*g\240\227\235}\\\271\367\343\231g+\357\320\312\350YYwV\316\235\225O]e\\\256\262=+\233\266r\211\253\334\266\362\017`"
+	.string	"+bqmi\266\343\335\221\354s\327\314/J~\374\253\374eo\346\363\303n\206\343X8\311\311\233\"\330\275\367`|*'\013Y\267A\257\214\333Z\256\215\307\247F,\377\315\341\244F\220\244\\\\\366&\257,\r\312\235`M6\241-y\233\263`\r\226\037g\033\371ce\226\177\303\336m\314\313\254\277ayM5d\013\b\325"
+	.string	"$\223\311;\037\262@]\240\271J\025\2055\311\270\346\263y\033\031iW\252$Ubo6\332\260\016\203\312\353\372\264\2115\373w~\352\304\336\313m3\247O\322(\365C\\\003\350q\203\244S\216&\r\263\315CK\342\332\370\033\"\324a{\213{9\356\3231k\366\265\270\304\323\322\261\f\37427\303\241\354\340\301z\2607\315\306\031\361\274})\033\250[m\352\017\177\370\0300(B\234\367\336\262snnob\335|\264\213\021\301O\302#H\2208\033\326!P\357\345\276f6q\242~\330]\273\302\262\336\346D\365S\034C\002\215\030LDH\277$ \022\022\260\310"
+	.ascii	"\214\243\027I\300\016:\033F.\222B\0301\021\225p\321D\324\202"
+	.ascii	"G#\tx\304\244D\202i\t\250\204r\221\004\340\021\013\033\300\026"
+	.ascii	"2\212\210f\264\370%\035\021!\375\212\226h\374$(`\240\222\321"
+	.ascii	"\322\217\t\b\\\372\241\301\227\267\2678@\327\330\024\027\236"
+	.ascii	"\21064H.%?\265\275\246j\336\020la\257\215,\303\342Z\250\201\017"
+	.ascii	"4dl\3100B^\0339\205\030\024\355\024_:>\236\321\354\315\236\313"
+	.ascii	"\"Cl\343\222\203\360\240\246b\336u\236\017\353\004\365.B\231"
+	.ascii	"\032\031\033r\327F\224-\213\r\332[\314CV\327B>\270\310\316@\325"
+	.ascii	"=\004\266PA\352\332\310\017\216\366\315^\257|d\005\261\263\306"
+	.ascii	"\215\256\321\266nS\177\202wr\255\353\240+RR\204O\211\330\263"
+	.ascii	"s})&\302\323y\235\224H\221\324hl\013_joW\301\232\fd\250Q\034"
+	.ascii	"C1\203\020sdh$E\211\306P\002!\244\314\356\021\240A$F\223T\206"
+	.ascii	"\003\213\334\264\262\004n\362\343\237\247G%\\N\262\224\357Y1"
+	.ascii	"\335\323\313E\241\322 \001\237D@!\034.\311\023\007\324\033\235"
+	.ascii	",\253pff2\341U\254\030i\270\033\3542R\274\300.\034\240y\354\207"
+	.ascii	"\265tUCo!\036\252S\t\350\306\252\241d\346\214\033g\340\310\217"
+	.ascii	"\321p$\244S\205\246GLc\026\b!\342\244\366\360\262s|\334\332\222"
+	.ascii	"\033\0257\fW\360\245\205\374\270\344\211_p\321\217J\270S\300"
+	.ascii	"\240Y\314\226\030a\026&ReL\314\265\324C\240\017\244ZM\210ba\f"
+	.ascii	"\260\306\203vO\226s\262?\307\271\372%\233\017\037h/\251O\350"
+	.ascii	"\325\216H\233N\2252\276\234\025s\263#\214x\246\032q\177\302\376"
+	.ascii	"\022\347;\254c\324"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.50.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\335\t"
+	.string	"\366QC; \345*\035\200\326\025\340A\300\214\001\200Y]\b\251\261\204\316\253\343\372\022\322`\217U\377\177\262Q\201w\230\240\226\324n4\200 \220\t\312\004T\025\221\001A\320ZW\337\b\221;\2451"
+	.string	"1"
+	.string	"1"
+	.string	"\344\356v\032r\3237\235&\377$\327\200\341\367\255\340\272\t\314T,\233\020\265-p\220\037\003aj\316\200\207\335\365\004C\217\233\273m\007\333\n\366\t\002%\314\271k\203H\003\021a\247Y\263G\324T\227\375m\265e\177\372\334K\031\t\240\024`\267\243F\333\030\2472b\373\033\233\354\227\217\257=\212\250:\t\240U\277\314kW\273\313AX\305\276Y\272%\005\306Ru\351\0170W\003\023\227\324\234\331&\275\004#\263\233b\360\305\3032|\221s\336(\315\203\347\374\016u<\221G\303\003E\204>\022\240\216B\364\231\350B#R\327I\260W\0011\352.<o\324m\306\323\267\325\226g%vR\024k9/GR\366\315r\323L\333\263\230\017\020"
+	.ascii	"`\2517\023\272\202\002\263\370*[\221\037\314\262Y\333g\262\250"
+	.ascii	"\242\020\006\376p\217k\242{\b\371e\bq\351b\266\363\026f\031"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.51.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375 \321\355\005"
+	.string	"$\nm"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\376\231\276\004\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\355\263\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367\236\001\221\216\217\220j\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001"
+	.string	"\244\003\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\t"
+	.ascii	"`\325\273B\300<\207l\025\274k\270`\304hB\344p\347`\355,\003"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.52.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375 \365\325\006"
+	.string	"b\214/5Po\322\030 v\202\202\313\205\240\021c\341\243\372\306\357W\302\202\250\324\262\265o\271\250\265\207\013\267\004;\004\317,\243.E\260_\207Ot'\366\203\243\221\275e\n\021\360\341sU\240N\034\330\332\300\013\302\002r<V%\301y\237\253\232xV\254x\233\203!E'>\020\204\361i\246H]i\225"
+	.string	"\006\"7\3729j\316\343\225ZW\372\346\331\30022\rI\331\305b`v%\203\"\362\207^\363\267\246&Y\240/'\223\312\356LXA@3\377\013\f\241\245N\020\214`\204\203dr\332\235\317}\250\324&W%Q\252\244\243\205\305\345$\273\320\026\340\260\2737\214LCw\372#\374\r?)\t"
+	.ascii	"`\325\223C\300<\207l\025\274k\270z\3048CH\341y\033\326N="
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.53.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375 \307U\005"
+	.string	"BI#+pm:\240\ft\327\2634C\001\376\"\251~\206$\272\310\377\366\321\221\374\231m\214o\324\377[+u;\305\003D\207\272\265[\312\024\317\254\2511&\023\333\262\213\303\344C\273\0342\353\"\322:|B\032\235\224\314\331\311\252V\226\n8~\177\3758n\376\005t\324\374\274\225@L\270\036S7\230B5)0\372\374\367\376\352\t\205w\272\265\003\026@\"K\350\324]e\344,]\246_BHY\036,\272\373|\t3\373\270\377\r\377\021\377\271\n"
+	.ascii	"`\251'3 \0306*lV\341\270\206{E\f\"D\016w\356\266\305\t"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceWorking.54.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\225\013"
+	.string	"\246\325O@ Q\224\016?"
+	.string	"\340h\220Y\231H-\374\311EP%\026\247Q\251\0259@e\0318\312\301}\365I,\256q\237]\2753[\345l\272\004\200M\246d4\256\332%\200\371\207\233\3755\331[\312\224\002?"
+	.string	"7"
+	.string	"A"
+	.string	"\331\273\220\323"
+	.string	"\022^i\005\216\335\356R\021\317\01653\177tx\325\241\207\3726\032-8\217+$0#\204\r\n\267\301\004\0371<\002p\244L"
+	.string	"\226\335u\232\270\016w\274\355\007\266\025\330w\020y\323\243\017\262\036\257W=Q;>\220h\371\331\335\226\232\262\017WAl\247\243\323\252\351\314\364\255\316\211\323\006\356#2vO_\216]\305\027#\266E6\305\013\030\210\034\333K\256\"\344\213x\303\341X\217\251\030P\237\t\017Z~7&!\313aw\021l\274\325(u|\204\351c\245\232\322\033\260\256\005Jj\220\322\263\215=\005\205\311.\251\201\217\342$\037_\344\321\026@\001\316T0\r\204\013\030f\223\271H\300\\\035\315\205se<\237\253r\300\330\204\b\236\253\002\206y.J\247\035\256\2028C\t\020,\\\244\237YW]\200FU\325\240\266h\272AM9d\245F}\tF\022"
+	.ascii	"`\325\213#\364\245\215VG(,[\2625\206\212Z/\r\251\270\005R6u\212"
+	.ascii	"\213\202\303\264\350B.\210Yi\203\345q\315Q\245CQ\253\240"
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.55.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375 \334E\006"
+	.string	"\324\nz"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\307\273\203J\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\200\200\200\370\305\207\237\267$\221\202\205H\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307\272\001\221\314\356\r\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\177\244\003\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\t"
+	.ascii	"`\251'3`\236\031\007\016\3115\2745bd!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.56.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\275\002\205\025"
+	.string	"\246(\220K\260\324Q:Y\303\302[-\354\027(\274\367\320!\006\001\252\361\357\272\372\327\036\314\270\361'S\305;\243?\026\334\275\333\266\377\317.0\004NR}\374\314\341b\355\007\375\217=\301\320\3320l\301\276\202\334\006\225\240&\204l\"e\222\001}"
+	.string	"o"
+	.string	"}"
+	.string	"\367\345\274\362\324k\220\352\275"
+	.string	"Rk}9]\004\346i\313W\310\323\361*\344\351\316v}\034\bT\007\364\222pES\265\326U\233\370\354%I\307\346\331\336EG\f\016\221N\235\227>'\001\234>\247\343\201\035T\217\311y\033W\242H\360P\235;<\376\367q\205\256Gm\210t\366\274\307"
+	.string	"Dp:TgmL\2603\005\302\344\2641\227\016j\255\313\271\223\347k~wqv\267\301.\027\t\247\373\033\362\364]6\335\020\332\r\371h\\\334\005\326\270y\273\037k\255u\273\304.\345M\241\274('\372\236\224\334\3675)oIyI\346\245\314;\216\274\335\274\314\274Wa!\006s\264\350)\365\020X;\024\215T!\205\221\342D\277\357\274\373\335\263\330\007\211\326i\254G\225\366a\025\374\035\tM10Ow\017\334U\235\376\277U\355\205>4\0132AtF\216\"\267\023\322\346\355\002\0378#~\371\203zO\270\245.i\2637\324\220c\267\230\226\306.O\034\302\261y]\322l\003G<a\356]\327\213\237\353n\261\265\316\356\223\256\204\263\017Z\n0\030y\312\035A\307c\310\017\215\213&P\365Pk5\020S!\324\341#;d\362\211\350\346m\237"
+	.ascii	"\371\026\020\334ac\"\273Ks\243\032\263V\233\202}\321]\304\366"
+	.ascii	"A\247{\341\206\237\013-\026\277\\36\017^/\331\004\222u\301\304"
+	.ascii	"`\254\f\261\026\215k\246Bke\0016S\263r\311nV0.\033\263y\311V"
+	.ascii	"\030b1\331J\005\244\375G\021!\255k\245\t\305r\344\351\207\233"
+	.ascii	"\204D\215 S\272\306\177\177\210\023\\\277N$J\247\364\201/\300"
+	.ascii	"\301\351&Uk\263Q:\247\307M\252\306\305-\233\354\223\246\021r"
+	.ascii	"\333\325f\234F\016\204\230\030\362\264l\022\332d\037G|\214\313"
+	.ascii	"\220\221\300b\221\247\264\037|. \260\002\221\271\252\007`\327"
+	.ascii	"\023\002\252\341\t\031V\027\n\347=\033K\020\rNJ\305\301\303Z"
+	.ascii	",\032\303\324\332bfa\222\027p3\r\205fx\210F\300d\317w\275\005"
+	.ascii	"\216\013\367\320\233m\0234\313Eg\034m\302x\025\234tY)\222))\036"
+	.ascii	"\013\030{r\237|\240A\244?\365m\252\317\210\256-\301LzI\207\242"
+	.ascii	"\306\3475E\255\200\002"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.57.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`)\001\035\016"
+	.string	"&\033bE\340\262(\035\222\221 \020\020\241\343\b3!\360 \316%\263\3640\230+\273\036\300UD\004\315\245\321\350}\373_C<\007\340#\235\253\242\271\312\0307\314q<\216`r\300\036C\367\002v\005I\254\332\261\367\2262\245O"
+	.string	"J"
+	.string	"P"
+	.string	"5%Z7>vg\332\310C\361\360\235@<\324\021?\035>\315\223\017\240C\035\206\376\236\201W\006\033\240n\365Ff\364\360\340t\351X\251O\301LNL\200N\365B;48.{\266t\254\314\020\223\335u\272\272\rw\274\355\007\266K\354\303\0043)dR\331c\317T\251/\373oU\204\375\330\037a\3729\255/\235\232~\b\307\363\342\322\335\005\316\356K\317\217\325\2012L\330f\261A\2663\037[y\003vE#\003cw\027\230\301\347\320\266\177\342(X|r\300J\3014\b\tL;tP\t\344\257\017;8O_ \246\212\330\334p\204\267(}vW%>\213\337\240\370\260C\247l[<L\305"
+	.string	"\"\247&\2261x\354\204P}9\352UdCc\225<\366U|\305\212\017s\005.\357:\364\271xx\275\354\bt\324\200\005\034I\345\202\bzD\262\225 X\330D(\243\023\t\"mB\351$E\033\2318\215\344\2007\n$\223\246\262m&\r4K\375\275\247\"\255\016A4\177\212\227\3751-\016/\322?E\325\026\265IJUP@F\265G\244\274\353\351ST\216\017\211\325\260\273\001\025"
+	.ascii	"`\325\333B@\030V\303F\256\"@\246Y\201\253^|\001n\203\025\032"
+	.ascii	"\204\302I\234\0208\210<\215 Y$\023\266k\342\231\026\232d\202"
+	.ascii	"$~flizTA\235\001"
+	.text
+	.section	.gnu.lto_blackboxWrite.part.0.76.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`#\005\375\037"
+	.string	"\2469\307F\220\234M:\005\337\221\231\231\241\377R\272\204\354~\020\t\220\002\267\262\347(\033\370.\214\t\335\332\231\266\271\357\261\325\357\f\350\366\300\b!\250\305\002x\3379\235\376jH\177d\251\304\330!d\244\304\022id\023\271S\n\255"
+	.string	"\257"
+	.string	"\255"
+	.string	"Gr\261\335\307\242\210\250\2005K\202\217\262\260\263Z\201E\247~0\236\022]\200x\032^H<-\275\363F\334\300\201\356E\244\016\254WX\336i7p\260{\021)o\255[ae\265\002\027\234\232\301xj\237\210m\035\226w\366\232\003\275\352\2031~\301\263Z\353\355ty|wr\254\2114\334i\333\371\266\254\251\223\265#.\0316>\026\340\222\241\365Z\231\365\233\242\226o\322i\225E\343a\230`K\313\f\237\254\252P\200\027\035inF5\367\013\226\215\220\250\326\372\340'\214\254\336\234"
+	.string	"n\253\035\325Z}\336\215\273\274m/\333(l:\003a\335\035v9\035\3043\rTN\377\330\246}z\310i\036r\272$\247m\3444IN\217\344t\215\234\026\311iz\262;\034\247w\247\347\215\374\037p\340\352g\253\326\2534;5\0075\363q\262\277\311?\345Vt^q\324{Q\025>\361*\023vV\251\200ET^\005\312+\366E\025\217\313"
+	.string	"\230+\337\355\324\300\361B\366}(f.\247\350^\346d\"\036\260bE\271\224\335\313\234\306Z6Z\005\357\264A\032O\201\346\205\304/y\022\337I\023]e\342*\036\276\332\204E"
+	.string	"B=\211\007\320\b\262\025Vk-\327\007\352\374\240K2\335\307\242\214\025\0326l\020O}\266\306K\003\343\331\236\235U~h`^.\317\016\335\261-\271\345R9\276!\033\256mE5\276\037\364I\342\270\344R(\266'\211\265\035\367> ^\376%\211C\207\016\342imov\004bht\366\263\326:\265\333eq\303]\032\343B5\353\330a\036%\322\025\367\276\255\336L\263\277\345\\\242>\200"
+	.string	"!\236\322\255\231\241\201\005\230v\b\021\363V\341>\370\327\200!\247Ko\247\0344\347\356\332#\224\346\255LT\265S\366\261<K\316\3772\023n\336\n'\236\356\222Z\337\271w\362pH\0172?4\336L\233\333\345\265=&aD"
+	.ascii	"\367\244\344aiI\304\341\23228\341\236\\Xh\361TF\345R,\016\352"
+	.ascii	"\204\022\013j&\243\\\211\021-rK&\230\224N,\335R\224PBqcjr\272"
+	.ascii	"\031\031pN\005\256\351\366\224\3135\335J\333\363G\274\355y\037"
+	.ascii	"\222\333\225$\236\321^\022!q\302\235\023\034\203\026<N\005\n"
+	.ascii	"p\202vH\314\017\255HL\t\226Z\231\373,\002\034<\306\314\364\254"
+	.ascii	"\033\n\207\fL\353\265\326*\002"
+	.string	"m\3176\215qYs6N\273\"\273#\273#\342)\320R\2614\372\263\266\025<M\205\t^\265V\b\376\231\243\271\340\177\235\032\003\022\222xz\2537?;\024\374\241\371J\325\325\217P\302\245D\237e1f\346cNF*k\250q<\245\220Sf\246$H\320\202\0244\035\220\002\221\"\254\007\021p\305uZ\320f\377\f\034F\245\344@)f\301<-\215e\030\221\270\240\027T\013\250\007\304\374E$k\201 \367\301\007b\327\276\035~\004\220)\177\347\0074+\200\\\0050\030\255\237\343'\006#\220\267E\365\311\234f^\216yXu\305\352\366\204\276F\016@\346\035\256\343\366\020\205\251\226%\340\237\022\243\003T\371\3312\031\246\212&\243\262F\360\350G\342P\321\345\311*\241sH\354A\340b\204\016\273\273\001@kz\250'o\357O\373+\333q@s\005\241!\356D\250\270\231\350L\351\226u\0072\355\314\276"
+	.ascii	"\264\022\360_n\274Z6M\314j\315\314\200\204m\254[\330\fn\344b"
+	.ascii	"\221\2419`E%\211\203j\366\371\222X\370\374"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.81.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"\365\013"
+	.string	"\366\025O= 1T:\f\201\221(\214rD\273%l\016\037\b\201\346\242~\331J\200Vf\036\334n\004\252n)d\243\336\234\321\223\376\002@Z"
+	.string	"V\f\n#\271j\005\027\210n\275\237\277\211\224)\005<"
+	.string	"B"
+	.string	";"
+	.string	"(l\271x)\333\266\\D\036=t\241N\"G\206\027\262\335\220{\324\021\037]S\033\371yR\221\256\007\217\340\213\265\300\361RuxN\256\001\300\354\256#\036\356x\333\nl/\260\357 \001B\354\242>x\254\210\b3\301\3023\bc\322\200A{\311\230\221B\266_H\t\277\"d\020\201\320\305A\362a5\2039\374"
+	.string	"\310c\344\002 \277CWa\255\261\343\304\356n\367A\317\336l\221\275=>\006>%\331\207\361\030\026\374\022\246\360\311\237\036\375\217\306/6[\225\362\303\205mOG\304\265\251\335M\360x\360\022\0326n\220\262Gj\313\252][e\331N\253\323\031\323\207P@\004~P)\340M\245\3430\270\320i l2\0214\234\004N\246\303m<\037\256r\300\335\204\006\036\256B\327y\270\355\332*\313\007?\311T\325\r\266U\215)\251I\265e[\222W\273\323\345O\251\001\031"
+	.ascii	"F1\003V\275\234\305\250\267\241\321\016*@\0139\207\3605\315\360"
+	.ascii	"\bo\3462@\024\fs\205\273h\"\377\f\221\347\026\006[\375\320\251"
+	.ascii	"\216\267\031\347\2025QP\247}IMQ\363\376k\313\030"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.86.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\237\001\325\016"
+	.string	"\306\331^E\360\222(\035(\205\255\3278/x\375\240\361\353\226\267\253@#\243\3331\f\271\221e[\322T\\pa\265\242W\036\322\364\326\307\n$\177\373Kq(Y,\203\342\230\223>\235o>\n;\263\037\235 \262\267\224)\005G"
+	.string	"K"
+	.string	"K"
+	.ascii	"'l\2276\330d\363\370W\263\247\341\301\264\200\355\356\366\250"
+	.ascii	"\"n:\324\214&\377\336\001t\252\323av\252\016W\270\340\005\026"
+	.ascii	"\202D\225\202\001p`p\334{fP\2412\t<\212\234\354\2565\017wv\333"
+	.ascii	"\rl;\260\017$vL'L_\333z\b\220\331\325\220#dW\261EBE\311,'(\f"
+	.ascii	"/0F\220\033\024\260M}\n\276\247h1\213\201\257\206\303\310\207"
+	.ascii	"\230X\013\266\373m\217\376^\222=j/\220=\336\276[\316\262\332"
+	.ascii	"pu\356{%\273\323y|\276\214\317\b=\020\211\262\307T\006\254\033"
+	.ascii	"\031\357+\031\214h\243\303\304\217\221\274\332*\\\2763\202\224"
+	.ascii	"\236\354\273\370\213\025\177\204+\220\362\335\243OR\005\221#"
+	.ascii	"\026\343\2229,l\227L4\223\307\222\330\306|\234rH*\2155\036\256"
+	.ascii	"\316\004\206\3409`\220\207\023\241\\\340R\"\200>\022R\266\t\242"
+	.ascii	"\217\312\006\032\2216O\002s\024B\243\315\002\307\215\266\016"
+	.ascii	"\\\2351\212\353\345\242\250\326j\225\256\033/8 \355\017(\337"
+	.ascii	"\231\304U\342\205\322\223\365\266\251\301Z\251\3228\037\312R"
+	.ascii	"G+v\244\022\307\001( p\202\031\263\363\346\230\001\257g\377\303"
+	.ascii	"\376\3310e\225u\343\030#\302f$n\274\210\023\207\202\031p\365"
+	.ascii	"\354)f\036\\\007\326\265\260\247\313N{\323\332\306\307M\273Y"
+	.ascii	"\2201G\036\214\360c,%\3067D\376\326\031u\t\260dY\2346@[\312\212"
+	.ascii	"\201P{3\342\320j\334\273\360\030"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.94.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\355\001\215\021"
+	.string	"\006atG\320\224M:W\306=\215\"\0221\005\251\203q\236"
+	.string	"\253!\221E\261\261\253hF\005\346,\rO\360v\355-\024\032\326&\307X\334\263&\254\034z\004\027^bQ\034\274#m\244\223~\230C)\2048\3216\262\267\224)\005`"
+	.string	"b"
+	.string	"Z"
+	.string	"3\370\341\274\035\333>\214\023\321xF\001\307f\304\204!\0275#\246\335o\365\230r\003\335#|\201\356Q[|\366\b5\273\231\2379^\315\243\005\037\245\234\021$\257\304!|"
+	.ascii	"\302\307-\300\022\213\037*\217\226*\300\303\201)\273\373\242"
+	.ascii	"\247\216w\223I\340\035\212ew\235\352\271Q\267\315\262]\301N\225"
+	.ascii	"\351\354\322G\301!'\224\237]\021M\2326E\354!TC\346\030\270\266"
+	.ascii	"\017\307\203R\004\351\210\210ii\337\002\243\323\220q\f\202\017"
+	.ascii	"\307\003\240\307\266D\210\277\324\355[\3469K\360\001\362bwU\367"
+	.ascii	"\213d\266\312\246\261U\326\374'\373\326\333\261\346g\314\300"
+	.ascii	"\001K[a\333\261\273\r\036\355 \365h?\206\314\001\317\335\255"
+	.ascii	"Q\275\331vu\251\260\334\021Z2\261\335\272\016Wjw!\3709>`\360"
+	.ascii	"\203b\335c\352\211\214\3378\216\230\037d\227\227|\316\243\377"
+	.ascii	"\2420\037\245!\233M6\261a[\226$\205\333\235\335Uy|\321\217S\262"
+	.ascii	"4\244&\235Ro\326\356p\025\310>I\307\177?L\245\025\025\316\260"
+	.ascii	"\222 \346\202\231aE\267V^.\027<\274X/\255\026\r\254\025\007\227"
+	.ascii	"\226\r\253\026,\266ZQ\340W\007\027l\005\363z\301V*\333y\270\n"
+	.ascii	"\344\0035\023O0?\353R\317\343$j'~\362\237uQulG5\213\215\336X"
+	.ascii	"#\203\020BMG\253*\254\217\220\204\002\t\324\033T\325$\222\013"
+	.ascii	"\222\252\332%\325\2364' `\002!\347\350\034\354\354\237\252^4"
+	.ascii	"\305B\2740\322\214\360s\301\216\3137&\267_+\353\304\213/\225"
+	.ascii	"\320dH?\341K\230\261\b\210\334F\242\036f\034.\031\n}#D\377\205"
+	.ascii	"\264\232\251k\210\030\323\271mS\233e7\257kd\353\306)\221xa;\032"
+	.ascii	"Xs\265j\262\033x\002\306\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\177\003E\016"
+	.string	"f\024OB"
+	.string	"oL:\304U\273\203\231\213\252\033\324\353\357\fTW\n\222\313z\007\207\031\007\204M\304\213\214\234\323\364\377\037WUU\t|\373\355\377I\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\300\0078\"\375\037\234\025\244h\273\311-S9"
+	.string	"<"
+	.string	"?"
+	.ascii	"$\221\034}\024\275\311A\364O\350^\321y$\350N\021?7\212\350\t"
+	.ascii	"q\266N\215\003\332trm\375\246\206\223\2665\323\363\276\r\366"
+	.ascii	"m\023\032*\231s\316\314]\"\332\226D\bs\332\231\260\300oz{,Z\202"
+	.ascii	"\255#k\207\321\376\232\335%{+v\026\354\253\370\272*\272\f\"["
+	.ascii	"\034\311\262\b\271z*\252\216\212)\177\220\250\237\342\351&\323"
+	.ascii	"K\260\f#/J'\005\031\0327D(\250\370T\226\253p\224\325\026j\027"
+	.ascii	"':X\360P:\223\315\330x\365\343x!\334\037\017\356\020\016n\260"
+	.ascii	"\301\355\301\340\264p\301e\241\202\317\022\334$\020\334#\016"
+	.ascii	"\334 \f\334\036t\006V\017U\f\025X\204`hV;:\002\224\001;\021a"
+	.ascii	"V?\324 \250\241a\204Y\375H\030\001\253\336$\300\252\310e\271"
+	.ascii	"\320e\225C\027\f\231\260a\001\260\025\016\325\221\013!\210-\253"
+	.ascii	"\035\235e\003A\250a\f\006\2043('\205i\r\220\002\241+\342\006"
+	.ascii	"\021p\024H+B\204D4&R\266\035 \276\017\321\207\3337\205\242wL"
+	.ascii	"\2141S\003G\343\306\002\322W\237~{\b\024\016\205?\365\240/\206"
+	.ascii	"\357\376\025\201Cn|\266|\017\325\355\356\004\334\b\\8]\033\304"
+	.ascii	"\345\235\230\230\230;\243L\224X\325\332\230\315\017w\005\373"
+	.ascii	"\375\223\342U\036{j\205M_\224%\020v=0xH\340\334I\006\202fP\247"
+	.ascii	"N\027E~ gS\005"
+	.text
+	.section	.gnu.lto_.refs.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375 \325}\004"
+	.string	"\202\n\034\037\240\245i\f\377\377\377\377\377\377\377\003\360\367\377\317\377\366\255\375\335n\364\315\227\364\246M\344N)zKo\"\034\227\266J\333\243\251j\264X\036\244\202SX\203f\031\001e\315&\257b4\031\007$\266/\227eh\025d\001\020=\320\032K\234\336\355\347\241\324\"C\207/\316\263i\tn\007\316\026\3202\3042B\027\332d\320\342\024\035=\253R\023\002\013"
+	.ascii	"-\001f\0023\034\001\004\366\250\030 \232\251\300O\270\274\323"
+	.ascii	"|LC\026\253@\001"
+	.text
+	.section	.gnu.lto_.decls.97908bb18a62da54,"e",@progbits
+	.string	"(\265/\375`\327+U\272"
+	.string	"J\037\271?Y0JAJ\035\366Zi+\245\252\317\266\213k\365?%rw\313\365\361\272?\037\200\261\265_\243\350\030\237\271\202\377\271\325\260T\r\353Ib\333`\025\326\022ij\b\005\007\024\220\226e\033\306\3608F\257\206\311\033?\257%x}\266\352\234\370\324\362\207\253YD\366{H\231R\nl\003\332\003\022\004K\334\226\344\2640\311\371|\361\272\030F.\222(i.Hn:\260\370Z\016r'#\251j4\021\320\355h-\330\200F\235\212\277\215@J\322\274p\203\362.\217\272\030\317\273ms\006\214J\313\243t\373\225,\276v\275\222*\330\027\r\271\234[\343\267\370\243\207\361/^\351\227\336\350\217\357\342\221\237\237\305'\371\230G\362\326\243n\327~\347x\335\323\346\214\3149\267\027\351\366\361\250\313\271\227\353\225\314H+#"
+	.ascii	"\216\2668\331\325\345\334f\320\223A\016\222\035K\355\007\234"
+	.ascii	"1B\306\340\221\251iv\riC\337Y\027&\314kK\226\026\373\200{\242"
+	.ascii	"E\347`\272sOj\304\355*\355\207\332\277\343\005"
+	.string	"\237\323\t\263\364\345\215\205\027\240<\356\006H\023S\026\f\347\322\030\t\023\347\036\235\330\236<\356GR\333\363\324v9\265\335M\335I{k+2M-$\\\036{\025w\363\226\203\273p\215H\240:7c\210\270\261P\246\266sH=\352\034\322v1\265\203\027Q\333\265\324\366)\325\247x\232\267 \\\255\035\212Gi\032d\233\2354o^l\204=n\247\241\266\203Hu\034D\332\256\244vp\r)v\f\351\006P\327@\346eO|dfv\365\270\213d\317\264JWV\342O\332\237:<\306\250T=\3660\037\213\216\255\241=v1_\342-\006\316\244\275\211;i\231c\233\333\234[\235\327\221'\366\365x\3075\244\217\001\265\035\203\364F\243\216A\332`\232\213M\224\034Tm\217\273\247\366\t\265[\307\220\372\227\372du\344\362\270=P\333[G\322\355D\274\210{\335$%f\016\313\271\345\251\311\313j\253;"
+	.string	"\007\035w\223s\221\234s\0058U\232\260\344\307\335}\244'\230\312\034\264\216\372l]C\252:\206\264\333/R\t:\335W\202\247;y\037\0132O\367\365n\027\373\r\302\274\210\017\321\355_o\200no\277"
+	.string	"\003x\r\236"
+	.string	"\037\272\337\254\333[<"
+	.ascii	"\034)I\303\177(\241\373\016Sp\037w\365\335\356{\201\357\276\024"
+	.ascii	"\350\366\016\274\207\256\351\376\350\225\333\375\003\272\177"
+	.ascii	"\252\333\251\336\202n/\361\034\272\337\277\202\356\227\241\340"
+	.ascii	"\004\005\270\005?Aw\307u\277\004\033t_\007\334t\337\005t\273"
+	.ascii	"\n\317\323\355\031\374\216M\367\203i\357\276\034x\227\327\261"
+	.ascii	"\300\347\364N\367\365\021\352\320\020\020\240\333\203\376\206"
+	.ascii	"}\233ng\373\232\247\351\356\236\356\256\2401\350\r\335O\326\355"
+	.ascii	"g\257v\373\224\237i\232\356KA\367\247\335\377\335~\327\355r\335"
+	.ascii	"\336\326"
+	.string	"\355i\335\216\326\355\317n\037\353\366%\335\356\354v\257nw\321\355B\272}\253\333\203t\273\217nov{V\267\347\350v\017t\373U\267\337\350\366\252ngv{T\267Cu\273\006\272\275F\267/\273]F\2673u\273P\267/u\373\213n?v{\356\366\rt\273\212ng\273\235\330\355D\335.\354\366`\267\003\273]\204n\367u\273N\267\367\374\002\335\355\244\333'\350v\n\272\335\002\335=\327\335e\335\216B\267O\240\333K\350\356\023\272[Lw\243\350v\022\272=\002\335>B\267\373t\273\207n\337\351\366\013\272\235C\267W\320\355\031\272\035C\267C\320\355<\335MBw\253u\267\206h4\032\355NAt\317T\351\266\240+Y\006\231\253\270\2329/5\3609%FK\234\314\265?\347y\237\215H2S\r\213$\036\224\272\234\245hp\223\2608\233\301\222\223\3635\034mN\305\265\037\367m\"\344cS"
+	.ascii	"\310\262\f\265?\213\377\026o\177\313+oR>N\215\350\001M\266\032"
+	.ascii	"\364\f\013\265\375\225\251\225\307b\345\257\2449{\313dJ\346e"
+	.ascii	"\022D\277\333\273\320\377\366o\177E5\346d\017\3313\314\262./"
+	.ascii	"\227 t\316z\304\301\301y\373Wd\210\224\265O\217\033\214\347\311"
+	.ascii	"P\321my\002E\355\324K\3554\037\2239\347&\2316'\215nR\227q\007"
+	.ascii	"\321\215\343\327?t7\316\231\0039\033\341\230_\324\037O\216+t"
+	.ascii	"\310-\003\315\0319el\300\224\0229\365\224\344\234\312Fd\226\221"
+	.ascii	"'\231\247\214I\316\234y2\022i\004\201\231y\222\234Y\231\217\252"
+	.ascii	"(=\267S\306\214df\236\214\314\307\016I\310)e\222\363\250\344"
+	.ascii	"IrN)\263s*\357d\3441\331\002\231\223<\3319\365Bv2\225;IN\246"
+	.ascii	"2\3119\005\345aI^|(\337\230TL\334+\t\231a,A\035\223;\320\244"
+	.ascii	"\226\231\257\344\354aH9\371!g(f\362\312\361\311\237FP\030FM\216"
+	.ascii	"L\337\260dD\305\314Hh\022\020f\316@\214\204\362R\002\214-4c9"
+	.ascii	"\324X\005\225\225\220r\236`)g\243gh\316\331\230s\236IB\2659\327"
+	.ascii	"\330Ij.-\345\274\354Y\312PF2\244\234?,\313S\231\344\244b\372"
+	.ascii	"\220)q63\213\326\350\315|e*\251:\215^Y\311\213\332T\306\230{"
+	.ascii	"L\245G\255\2122\342|\334\351\013\251o!u\001\213,K\336\263\375"
+	.ascii	"\254\300\316\276\250\257\366\237\366k\375j?\345\006\371j8\347"
+	.ascii	"\243\273\207\034w\0172h<\216_qR\242\020\221qc\007\r\031^\220"
+	.ascii	"\031\217\377\354\321\372\241\274Y~(\t`\346||(:br>\352\270{p\367"
+	.ascii	"\200\207Pi-Iq\313`y\262\034\272\027`\242\234\251\317F\3731\254"
+	.ascii	"(F\254\307-\323\304\311\0204%\227\027\2320\3711!\\D\0367\223"
+	.ascii	"^{f2#S+O$\333\0221\03250'\355\343\2606\247E\013[\224<n\031!j"
+	.ascii	"\222w>\222\367z%\377\345\355\203\275\221\376#~\3268\212\213\371"
+	.ascii	"\"O\214\272\310\375\217\026\257Y\005\344\356\301\276+N\356\203"
+	.ascii	"|\300\256\t\366[\f\310Z\232\270rn{2\310\300\246\013\016\033Q"
+	.ascii	"rp\313\264Po0\235\332\030\313\023q'\030\026\336\343\306e\352"
+	.ascii	"s\275\020o\177H\306\261\261z\206\035\037\257\230i\264\264q\253"
+	.ascii	"6\316R;\f?\251-\3055\370\320r\243\221)\351\214J\311\347\265\376"
+	.ascii	"F\213\036\317\343w|\363u|\226\267\257\365X\355W>G\3436\347&\b"
+	.ascii	"\270\362<\207.?\030\022\375\252\327z+\037\273\355Se\361\365\302"
+	.ascii	"\345v\262\221\233\213&\007\335>\257\3658</\307\330f\246\031\252"
+	.ascii	"$\251\266\236\031\2571+19\330\363\233\3327M\355k\246\3665\242"
+	.ascii	"\366\315R\373yk\250\335?\305\302u\321\365\345\311\2677LL:\230"
+	.ascii	"\314\227\372J\033r|\374RQ\030\250H3&El@\251X.\215<\356\207\372"
+	.ascii	"\025\234\231%\310\211\221\204\253\306\343_>\ro7|\r\237\2732R"
+	.ascii	"6\251\035\310\3317\244\036\215\372\206\364\235|\372\2370\244"
+	.ascii	"\311e\233u>\320Q5\344\361u\f36\314l\221I\335\220\301A\247uZ\252"
+	.ascii	"\212\001\002\307\356\315\210\253I\231\023\207D\213\361\225\375"
+	.ascii	"\311\255\0348\242<~\246\036\031\256f\022\247\307}\217\324$`n"
+	.ascii	"\306\364\225C.J[T\023\215M\252)\345\nn\005\271.#\356\204\341"
+	.ascii	"\306\303\317\272}\266x\2278c1e\031L\347\205\0301\370\b\325\322"
+	.ascii	"\304\345R\321\2601\306\306\307\207\252`WB"
+	.string	"\340\036\337<\234\177\310Y=y|\243\3204\247\251\260\rai\3121o\204\002.IN\350\346\346\356\035\nrZ\232\2700]V\036c\327\367.\207\020\245 \217o\335\027\231\tS\325B\230/\353$Uc?\036_:7\323\301\3122$\351\361\005\323\\\220U=\324\036\337/\276V$\252l\312\343\353\305\2754\336\363\255E\227\253\004\313\212\0218h\3377\350\225\273sj6\"Y"
+	.string	"\232\035\335\263.'-A\2448z0y\300\365\225\353\253\345"
+	.ascii	"\034\334.0\320\246\350\036\337-\227\213\267\255v\343:\247\214"
+	.ascii	"\205\230\232\230\332\036\360VKo\226\316Y\262\225\335+\027\313"
+	.ascii	"\017+\347\226\227\332\006P\2218)\225\327\205\276V\214\240!\271"
+	.ascii	"\tQo\225\276n\3354~\003\006\264\n\020*/\354p\312\241\245v\316"
+	.ascii	"\325\332\332mK\223,\315\254\320u\007\203\255o\233\257\335X\271"
+	.ascii	"\355\240r\212\022\345\246}^2\215/|\320%\223dlK9\245o\332=\202"
+	.ascii	"\317\214\312\252<\276R|\314\005\270\"W_\346\204\212\022'\217"
+	.ascii	";\307XVv\321v\214;\255\221\225\254f\031\r3\252\263\276h\030\313"
+	.ascii	"Q\213\030f5oY\360\240f]GwiN*\317\347G)@\026\267\344\262\001\343"
+	.ascii	"*\213\343\321\244\311\035\353Q\313Z\232j\330\240<\244\234\364"
+	.ascii	"\035\253\271\261\202\261\b\r\224\216.\314\206\022%w\211[A=5e"
+	.ascii	"\242\321\266 b"
+	.string	"}\227\340<\235r\214\335\260\233\326\230\343\302\300h\346\266hA\346\030\255\320\304\361\270q\214__\327\231\212\031\341\240\260\321\b\026\346u\266\331\321`\346\265\240\022i\"\327k\307\223\274xj\326\345\274\004\361iryF\333W\265R'\246\305\343[\344\036y\035gO?\216\\#R`\250\351x\246\\\203\311\331\224\333\345v7QV5\340\314\204\b\371'\035rX>*\003\320\243M.5P\235\311:%#[[\037\245K\355\2327\232p\221\301\004\002\344\006\351\235L#\365\"\027fYg\223\245|A\271A\376Izd\344J\310\343\276y\341\303\307\337\211\220\266\300\f\263\344\302fT\270\242\2744\233\1777\345\211\225\355Z\\\233zw\334\0357K\315\251Y2\314\222\353B\241R\312]\036}\263\276\211\231\324\226\332\215\213&\263(\261\0349\376\316s>\346e6\202I\273\3221GX\246\370\270\272\362\265c\223"
+	.ascii	"\272\250\f\231\263\021\243\002&\365\270mX\334\2707<\257'\033"
+	.ascii	"\347:\364H\326\27005u\253:\3440fn\372\340\307SKS]\316P\032\334"
+	.ascii	"X\r\251\032s\251\\I\373u\366\270\315\260\334\202\221\306d\272"
+	.ascii	"\220g\230%W\312\342Ji\005,*\352\3574\004\3114\321;'\0337\240"
+	.ascii	"\332\333\013\365U>#\221\344\0309TLRmu\032`\261\366\345q\327$"
+	.ascii	"k\324\3300\343\t\005\"G\251\307\214'1NNw\251\346\fx\320\033\037"
+	.ascii	"\\\362\354\236\372.\321<\f\220/9^\212\316\026\336\213\267+\352"
+	.ascii	"U^\345\225\341\205\231z\331\322\005.F_\0312\220jK\036\337\246"
+	.ascii	"\237\302\211\336E\235"
+	.string	"\215\206g\220\021aCcb\3625O\252K\254\\\310\3218Q\357\322]\372\250\232{\272\2407rlo\307\366\"\357\213\213\274.\006p\217\372\036]\027\355\311cf\032\345\034udfF\362\327\232b5.R_\027\267\005\306:\272\241\366\370&\315(e\211\345\251\313\342\237\244X\200\260\300\342q\323\030\325V\247\250\335\367x\217\017\035\321CNM\222ws\336G\307\214\371\350\2060O\235;\034t3\242U\200d-y\334j\017\265U'\265\356\361\352\376\316\316\356\3574\330`\342d9ry\002\323\177\367j4=~P)\345\251=\303F\347\355\323\371\030\210|<\006\200,i\366\345\313C}A\300\024\302a\211\234\265W\323B!\212B\254oH\204p844\004\022\002}D\266(\034\002\321\260B\340]\205\300!\342\312\256\277\f\302\225h\230\323B!\212\"\326_Q\020H\b\024A,\026\211\210\200\355\255\032"
+	.string	"\026\323`\260H(\034\ng20$\n\261C\341L\n\337\032\304+\261\210\b\013\327 \221-\246\353J\fa\305\t<\277\365'\004\246\310\360K1B\321\267\006W\023.\350\021\025\207\212+\353\003\032\006\203\016 *\016E\200\002HG\005\226h\350\001,p\250(\364\021O@Q\004R\320B!&(\002\203A\340Pj\303\256A\277\"\241\"P\270\006\211V\023\210\353\317PQ\tAC\022\330\025\002B`\n\304!\n\022\004\203E!\220(\002\177\302\007\004\rI\020\002\203V\022? \221\bV(\b\030L\321\263\016\rI\370\001O\260k\020\321\307\362\370\210+;\002q=A\\W\370L|(\322\254\354\260\304\320\312\026U@\241\201EQ\\Y\025H@P$\032\022A\370\371\231\021\256D\022X{\305\"\326\307\242\340\320\301G\204bUA\\\213\253\t\030\234\300P\034\006KL\320\003D\034\206 T,\n\206"
+	.string	"\302\005+|&~~hdZ(\204\210_\020X\264!\250\350g\375\321\024Y \211\237\237\264h\202\350[\203@l\321G\302\317\017\316M\177\300\331 \004K\364\021\205XY \021\205\f\r\004$\256\3025H\355\004t`\200\016F\254\230\351\021\036l\340\301\006i\217\360\300\307\307\203\016|\324\356\300\347\262\275 !\220\350\023B\301\366\212&\326! \253\006\207C\022=\031\242O\b\b\257\275\0202@0\004J\240\002\221]\207\326\340\312J"
+	.string	"A\nE\237\t aQ\212\233\2657B\004D\305\241\"Q\020\317\212\365'\034\241\027A\013\205\270\240\330\013\002\246\020\016K\354\254\254\217\330[\203DC\276\242\315\n\004T\261\376\322\024\212\276\241\336\257\b\374\365\212\277\340\nL\221\2418\324[\211E,\221\017\2507$\252\020\244S$\016Y \340o%\022\365V\025@\226\310\367\363a\230a[(\204\210\"qU\001$\376*\350!\321J\024\301\016\207D\0216\304\025\230\002\310\n\327\037\260\246\330\273\251"
+	.string	"K\034\236\330Y\203?\276\023T\244ko\375\rM\324\254\277\341\020^{\022`\211C\"\234\242p\bd\211\2063+\3533\341W\344\373QW\r"
+	.string	"Q\250lo\304\f\253\022o~\276U\004\266w"
+	.string	"\004\004\201\276\023\210k\212\024E$V\2607*\200+\320jB\017\333\353\300\207\025\002\213\324\032\037\353\003a\0051\207\310\236\030!\350\003\022\327\242\206\366\361)\321\201\002%@@\005\n1\004\366V\f\177R"
+	.string	"\362\005\177D\b\201\276!\021@\304\242\210\020\036R"
+	.ascii	"\362\375\004\203\276\022k\360\007\274\3611f\025\267\326\354\261"
+	.ascii	"D\265C\223a\327\364\261\364\351\b\217\211\326\267]-*w\306\254"
+	.ascii	"\353T{\022d\213\307\365\312\001\023\265uc\007\326\341eH\334\326"
+	.ascii	"c*m\223\256\366\013\213\225\025\306\372\340\306$\325\206\261"
+	.ascii	"\360\325\227\331\310YW\030\307\t\270\243:*5GQ<(|\343\261\232"
+	.ascii	"\210l\261:\253\272.\354\224wT\377D\013\206\026\230\307SQ1\032"
+	.ascii	"WT,\334y\311`;>ng\274\272<\317\244n\325M\024\326\321[\324CU\256"
+	.ascii	"\263d\231\r|\304\372\032\342\304P\030i\216\306\020)\217q\r\033"
+	.ascii	".:\310\254\3040\r\034\003\307\300O\236L\316\025 \n\025\274\""
+	.ascii	"uy)\003D7vj\374\204\206\264\345K\225\307xF\243\341\211\035q\341"
+	.ascii	"1\226\321h3jmTRUM\177GbN"
+	.string	"\311J\371Ul\276\306>\340\224\224K\237LG\224`\0309mpoW\230j7^\372+9uiVZ(y\336\273\261)\031\275\270m\313\274,6\027kbq\320\027\217[\240\231\210zz\301Iin6\256\320x\214\221\030\211\221pnzf1fE\207\\\315\016,Y\242\370\2501R\203\304\250B\351D\211\002\2351C#\"2\222$I\007\242\n\020\004\203i\022\351\255\035\022\240\024I\rK\310Df$I\222\366;\231\tC\216j\234%\300\204r<\\7"
+	.string	"F\315\321x\314q\273\006=\253\253`?V\353\001\355\022\321\261\243]\234W\250\370o\227\257\306I\007\253\342_t\\\363A~u\023o\376\210V(\240\251\ft,[\243\340("
+	.string	"\036l\213\206\"\332\033\330"
+	.ascii	"\013\376\005\225\360\224,\330\033\275`\213\020\270\237`\317\203"
+	.ascii	"\221.\346\036\021\020F_-\230]\221\034\254\003#\003$>g\200\032"
+	.ascii	"\375\254\017L\355)*o,\214\037\205\004j\340.\354\021\232\232M"
+	.ascii	"\267.\005\371\2208\362\024\024\370\3560Dl\211\"\266\207i\252"
+	.ascii	"\374\372Q\326\361\231\252\302;\350\225\364\364\025rnI\006\311"
+	.ascii	"\343R\205W\340\226L\373Z\214CW=\342HA4#\270,W\220JX\257\300\215"
+	.ascii	"1\267\303\250\bO\354\215\236\025\207(h\231\274\034\270\242\360"
+	.ascii	"\264\206wO\213\rM\3617\355o\205\252\222\223T\210=3E#\3540\th"
+	.ascii	"\270\225\204\251\277\201iRS\337\361\365\017_\267)\271\026\032"
+	.ascii	"K\273w\376T\221\302\023\202\274\374\340\344J\357\207\264\351"
+	.ascii	"\341\3356\"\312\357\003\202r\216 (\\\257\342g\372V\020\223\231"
+	.ascii	"\027\231wA\026q>\300\362z\224\026>dFA\250\321\241\r\037\265\330"
+	.ascii	"n\300\366\313\352\257\357\371\251\355\343\333\372\005\203\231"
+	.ascii	"\0211\302\361\314\273\275\226\371(\354\362U\311\003\352\023\227"
+	.ascii	"\364\345PP\2513'\035B\272;\001\304\321\221\371\024V\365D\360"
+	.ascii	"\030\317M\310\204\227{d\007\024D\312\304&K2>\3105\211Q\257\031"
+	.ascii	"d\257\375\371\352\376s\026y;\034\274\226\273\273_9(\325\f\375"
+	.ascii	"\016\207\254\323\0312N\353J\260n\034<#\031\"\257\035\t\362X"
+	.string	"L\277O\317\037\357[\370s\024\357\357\20753h\201\0324\241\001\021\005\301\240w\364\314d\300\2511\371\322\306}\373\023\356\313\365\243\321\270\016\326C\217\325S}\013\364\262f\241\344\301\206\337\201\260\260R\270&E\302\235[\264n\355\"\205\222\204\202\323\277r\235\327\005\021\340\026b\351\245Gx9\272\006n6\240\331\276\277b\266\017\275'\027\303\020a\241$@\2714g\372M\300\322<\277j\262\274r\375B\251\\\024\235\311ZP\257\322\275Y\036\242\254?\245oO\013_I\fk\242\236\261+\265\361`z\260I\256o\267c\352\212\360B\357\357A\025\332\232\274ni\255<\250\006\313\226\207\026\235:I\230\326?4\320\212zL,.\272\272\3246\036P\365\031\031&\016\t\027s\315\324\316\252\265 x\246d\233\270T\271A\370\304\036\264\324ER`\033H*\312=a\324\216\013\226\013\0259\377\261\030a(\313\265>"
+	.ascii	"c\242\n\311\372@u\370\226\022\373\373A\255\232]\322\215\017\\"
+	.ascii	"\272o)y\317\263\251\201\2776t\200\363\270\257(\264>t|\310b\267"
+	.ascii	"[\263\311\204Z\247%\370up\022}J8\304\264\260\013d\235\217\357"
+	.ascii	"\303\203\245\335\331Mv\217)f\220y\037\320\325\327\224\232\316"
+	.ascii	"\ry:\201\023\365l\303\324\201\005\221\317\220\tm:\313\177f\372"
+	.ascii	"kh]\356[g\005\2273\262\f\2447^\017\026\265N\004G\334.\354\225"
+	.ascii	"\r\203M\207M.\203\244$\335\333V\217%g\330r\240h\261\306m\"\032"
+	.ascii	"&\214o\b\374\270\300\264\250/<n\242\200\"\013_\354\2307luL\210"
+	.ascii	"\203uy\021\373\356\254 \\\177\274S\341\2468n \356\321c\022\024"
+	.ascii	"\025]<iB\223\2034\002\271(Q\245Do\315\224_\343J\304\225'?k\031"
+	.ascii	"\220\204Z0%\311\262\217W.F~%I\n\330ob.\227\374\367\017\211\353"
+	.ascii	"6z\247\205\356\3643\3167\235\202K\217\323\373\324\201\016J \332"
+	.ascii	"\367k\312\221z?\263\314\330\302\022\266\214T\356\242\031\241"
+	.ascii	"D\210\332H\364\002\305\360\2771 \037\204\254\262\357\312\376"
+	.ascii	"h@p\277\003\f5\027*\007\243D\264\3777>R\373\227.\210Nb\233\232"
+	.ascii	"\3530I\037N\002\210[i\017s\326\220bn\234\256\024\210\231Vr\020"
+	.ascii	"4g\311qV\351i\273\347\f\332\222.\b\006\225\r\022q\377\234\374"
+	.ascii	"\215=\344\206\252X5\220\223\035'[\221\236\025\225\272\345\341"
+	.ascii	":D\241\250\270]\264t(0\312\331\263Zz0\345\034\365\006\252%"
+	.string	"\317\337,\221\340 \370u\316\320I\210\035\203Y:\242\366\035\333\266\246\301\230\376\355\016\275\214\203\223zr\320\345ZU\342M\263\024N\226'\261REK\006\207\304\030ZT\025\253\320M<SiE\346(\202B\225\327\223\026\303\200\3503e\337\177h\242\244\367)\347\270J\002\267q\241/7a\252\361\234\033\232f_\001\316\224\347FE\347\037p\237\221F\033-!2\302}\302\260\033\237\206\031\354b\323\271H\324h\3750^R\331\300\220F\220\267m\346\227\216'\315m\213_\371\036!C\322o\030_\340[\021\341\033\225\275\204n\373\363\277\275\305\001Q\347\217\253\243\210\220\035)\334\r\304\374\3236\305\207\314y\230\204\030\020\002\202j\302\272[zd\222\215\364\307L\245\373\271T\376\304@\341z,*\255\013\252AK\367/\274\325Z\357\265\225\306\200pzE;\374m:\233\006\371\326\246\345L\227\266\n\262\f\013d\027"
+	.string	"\231\007Vq03\334\326MO\221\341\216\344\360\334\376\2247\256\345\351\0307\333\0060\205\356\203\256\200\326\257\272\266\tI\366\225\331\263<z\200\363\330Qf7\024?\244\345YoEpK\2071\375\035"
+	.ascii	"\266T\360B&\234c\200'A.\356\240\303`\017\225J\361G\263\177\346"
+	.ascii	"\254\035\333\244\312\276e\007U\017\024\327\365C&\361\372\r\211"
+	.ascii	"\263\3639d\b'p\315\232?\365\234\342\207l~\362\310\024wK_\206"
+	.ascii	"MS8\207_\235Jyz&P<\373(\t\350\237\220\260\253\233\021\006z<\322"
+	.ascii	"c\264\264>\236\267\350#`\362\032\256@\273\365\302zQ\312N1{\005"
+	.ascii	"\200)\254~\202\327\204\307\376\2407\362\340\241\360\242\342\236"
+	.ascii	"\"&\0027L'\332\f-\257\021\366\024>7\350t\202\274\367\0265\230"
+	.ascii	"\252\273\272\213\200\376C\327\334\327\305\023\363\226\351\017"
+	.ascii	"\244\351\023w,\370\t\360\n\034\211\235\274\342Q\344\303\201\013"
+	.ascii	"O\373\031\004\017\021mI5\306r\272\263\323\343\033\324f\036\277"
+	.ascii	"\337xL\034\204@\357t\3067+\367\002td\3165\347\304\233X\333V\376"
+	.ascii	"L\332B\355\233\201\310\252\216f^\376\001\316%\355c<\246\203?"
+	.ascii	"\250\\\001\344\303u%rg\020g\335\356\342\376 l\357\"\303I\266"
+	.ascii	"\267\363\004\177\331\3647\341\277\370WE\356\317`\345\3552|Lw"
+	.ascii	"\360\337d>f\036\367g\366 \276<\355\337\304Eh\274\004=0>\254F"
+	.ascii	"\207\206\214;\344\212rwgG\241\302\317\367\225\375\263\277E|H"
+	.ascii	"{\363\352Hs\201\360\326\326f\r\033\377\376\307\211\346#\363\210"
+	.ascii	"w\374\347l\025>\363P\273\032\203\330\301\3037?B\377('\210\226"
+	.ascii	"`\016MZ\001"
+	.text
+	.section	.gnu.lto_.symtab.97908bb18a62da54,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"blackboxWriteBytes"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"blackboxDeviceFlushForceComplete"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"isBlackboxDeviceWorking"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.97908bb18a62da54,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,368 @@
+	.file	"blackbox_predictor.c"
+	.section	.gnu.lto_.profile.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375 \215m\002"
+	.string	"t\003\201"
+	.string	"\005"
+	.string	"\326\201\354\324\r"
+	.string	"\001\336\353\312\307\013\004\002"
+	.string	"\002\001\002\002\002\001\002\321\357\336\205\016\f\003\232\230\315\260\013"
+	.string	"\004\307\302\346\363\006\036\002\003"
+	.string	"\002\001\002\002\001"
+	.string	"\b"
+	.string	"9\002^"
+	.ascii	"n.\260\023C\316\330\225\016\224Y\334\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375 n\355\001"
+	.string	"\024\002b"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001"
+	.string	"\002\003\003\003\004\005"
+	.string	"\001\001\003\201\204\f"
+	.string	"\002\201\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	"\240\210\225m;\202\240\002"
+	.ascii	"\2112mP\252\006\346\275\224d*Vn\240\r"
+	.text
+	.section	.gnu.lto_.inline.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\275\006"
+	.string	"\022L'-Pm\222\016`H4\215X\312\242\361\017D\3140"
+	.string	"E*\250DK\f\260\365M\f\305\220\312N\253\252i&\322\200\016u\303\244m\"w\n\257d\002\374\206\317\2424\222\t\261\220\374\0033\233\216\216\202\242\235m\020\334\\\200h\016\276\177\2102\304p\037\345\f\276\005\r\237\274*\324S\274\342\377\320\216\346a\307\b\233PG\211\237\255B\216\006\207Cr\2620\243\305\254\277\260\323\266\340\2226\332\022\314\n\006\372(\340\243-\300v\002\206\375+\375s:\250\267\260m'|\213(\322v\340\237\r!\027"
+	.ascii	"\254\205\003v\212\0277\344\315Vc\260\001Z~\201\246\202\351\312"
+	.ascii	"0\003Y\2755\004\247\232]\207\030\254\320/&\004 \301QV\202\024"
+	.ascii	"\300\0244\006T\210aiX\003n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375 \272%\003"
+	.string	"\322\005\022\033\260\247\320\001H\"\315\001\356\006@\222dk\031r\222d\032\206\354\b\331{\313$\003;\361\210?\274\341)E\200\f\216\262\b \204\24708\215ag\217rQ\261\305\022\013\370g8;\377:%\233\222\267\225X\234\277Z!\n"
+	.string	"S\311\005\310"
+	.ascii	"\354\370\351CeO\021\f\326\021\207\013\001*\203l\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\001\232\004\002\232\004\003\200\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375 \305\315\002"
+	.string	"\202\304\r\027\300%\035\357\3723g\371\377\377\377\177\363\241\310\030BZk\222H\231\002\377\247.\334\233L\262\3416\244AD\003\320o\217\361\253>\345\247~\357B.p\007\304v/\002\r"
+	.string	" SE"
+	.ascii	"\344\021\265\215%N\210\305\212\031\b\036\302`\217j\304\345\002"
+	.ascii	"\260\017\224\266\2016"
+	.text
+	.section	.gnu.lto_.lto.494953e1f282dbcf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxAdaptivePredictorInit.3.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375`T\001%\016"
+	.string	"\226Y[C"
+	.string	"\261&\0358\377\231\345\3466n1q\375.\357\021\232\356Uw\255r\034(W\363`\300\321\270\242\372\267\024\234l\210b\005X\200\376&\253\252\252\226\021\b\bc\036\023\350\255\217\371\345\273\314\220F\366\226;\245F"
+	.string	"G"
+	.string	"G"
+	.string	"\261[\233#\344%\200\215\0167<\377\261,\3214\354\\\3706G\230o\253Y\370\211\250q\342J\216\020\344\277"
+	.string	"\356\005&\200\341L\017\236\210q\332\306o\265s\342b\374>\013\376\367\2358\020\256\345\266Z\333\006\255C\004V\271\276@$B8\376\017==\236\023i\324X\345\326]m\323\302.6\253\272\202\307q\200\272\241\343\277\210c\031\\\216\006\240?\332\372\265Fy\305\346\024K\b\310]T\036f\374\335HK.\307v\016Y\216\227\tX\016*\035\227\307\303\020\026\201\235\237\004\335\354p\030az=\255W\254\266\033\214\263R\200\346\177I{\30102\\\377\025\274\260\240!Dc\302\261f\261\034Q5)v\264\274\236\314\377\245\314\231\266+=\377\177S\246\3758e\303#\003\250\210D\313TD#\b(Z\312\003\f\331I\004\221\211\204\023\214\302\310d\002&\322H\030\311\201f)(\032\246\222e\032\366\321\335~\3124\256rZ\322\324g\222\325V\260\f\322"
+	.string	"\025(xb\316\024\024#?\231:O\304N\230\021;\235\n# `\202Q\254\312\016\240\242\300\352MB\257\032c\304\330"
+	.ascii	"\007l7\350\007\303\355$\272@\013\260\206\347\374\264wk\031?\255"
+	.ascii	"\016\332\247\220\225\030\333\b\\\264(\234F5\326\2515,\230\276"
+	.ascii	"\006E\254\3576\273\025.,\032\"\274\227\372`\335\254\237D:\327"
+	.ascii	"z\002"
+	.text
+	.section	.gnu.lto_blackboxAdaptivePredictorSelect.4.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375`4\003\225\025"
+	.string	"V%\203I\320\322(\035\212x!G\324\205\232Y=@\350~mD\\13\n\216~v@\220\001\331\2209+ua\244o\233\006o0\003(Y\222\223\307\244\360\305\003\354\231\236&\342\257\301\321\304\244-\r4\315[\373\2374\262\267\224I\006o"
+	.string	"h"
+	.string	"p"
+	.string	"*\223b\317-\202\017\233\240\245n\021\366\372\210\367)\037\300\373\344\022\237\362\245x\365Xv\324wJyS\362\312\364??p4\332n4G\205\020\262\331\357\224B\002G\347\247\317t\236\222.\036\036DH\00577\332z\251\0259\237\037.[7\016\362\325\335\252[m\371@_\034\243\355\226\363=\245t\267\256\355\206sU]Us\250\352\003U^\0054\373f\036UWKWW\027\177\325\203\256\336w\327)W%\257\262\\]^=\200\0055\002\206tw\030\233z\3074J\361\240\177w\241\027\252{D\223\212\273\320\003\251J\277\323\033\262\207 \344~"
+	.ascii	"\351n\222Ou\360}\256\352\214\252JUwU\257\273\317\314E\031\002"
+	.ascii	"\256\256\355L\314\350\026K\024\345\373T\361{\213\347f\002%\237"
+	.ascii	"|\335N\251\266L\227\335\335^\202Ov1Kh\254\331\241\355\270S%\323"
+	.ascii	"\220\335\026d\262d\024\210\"\233\"\027\273[2\216\317\341NGm\231"
+	.ascii	"6\274\b<A\222Q\202\304|\222d\344\362\030\262o\271A\222n\266c"
+	.ascii	"\314\211@\003=\335\215\242\212\3410`\276\356f0D!\303\200\236"
+	.ascii	"\023\237z\031\357\363\234\313\2610\232\355\310\335M\303\214S"
+	.ascii	"\025\003-Gi\314$\004cb-\023X\302\027\t\032\300\225\n1\025\013"
+	.ascii	"+\260\013-*.\260X\b\0033A\240\340\013K\b\213\001\301\020\246"
+	.ascii	"\022\373o\346Y\361k\306\264\243\025\377\347\213\302\207\210n"
+	.ascii	"\266#\212q\312\":\265\230\225R$\367\274\317\343\026\263^\364"
+	.ascii	"\250\331\241\035\364T5\274\r\260@\215\221\234nI\310lG>1N\377"
+	.ascii	"7\363(\213h\272\230\225\226\344\223o\002I\250\201,\205\fDH\231"
+	.ascii	"\231\031MAJ\215\001\200\002\231\262\242\007\021\220\261TfJR("
+	.ascii	"4\007`r\300\243\214O\345\315\266o\347\303\232ed\245\334\237o"
+	.ascii	"\016\2503p\305\265\241)e\3749W<>\204\021\265D;\367\276\302\222"
+	.ascii	"\232\365w\257\331\n\310\265\236\364U\331\202q3f\261\315\257p"
+	.ascii	"N\200\214\2116\023\330\364c\226]\264\037'\260Z\\\030\363\324"
+	.ascii	"g\2531k/\303\345(\203s\347\301\2675\257f\363\216\205\002i\331"
+	.ascii	"^\020\016\001\237WZM\202P\224\216w\353\204!9{\201@<\234\335\350"
+	.ascii	"\314\353\017"
+	.text
+	.section	.gnu.lto_blackboxPredict.5.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375`\323\001\005\020"
+	.string	"f\235fD"
+	.string	"\221(\035\253\324!\371\027_f$\0329\270\006\325!\334I\336A\305\337\224&-\243\030\232\217\202{\272\r\324Ch\"\224V\3734\366\237\031\270+\021\254@#\224\201\037\223\370\235\214\232\355\326\366\367\336R\246\024S"
+	.string	"N"
+	.string	"S"
+	.string	" d\320\354v\037>\3209\264\355\2378\n\024\227^'b\025WT\027dl\354\256\346\361\216x\370. \036j\210\227\016\237f\3117\035n\340j\336c\376jp3\252U\207\353\311B\354h\305F|V(MN\310\356:U+\016w\274m\006\266\025\330I \217\371\007\306\331\2402\207\335\231R[\354\353l6\273ae\261\235\3568\3159\314\037\337\375\360/\377sZ5\235\232\376'\272\314\030P\263\2332\303\2616\360\005\t\333(6"
+	.ascii	"\033\346C\002w\245\027`Q+\030h"
+	.string	"v\367\303\b2\377rb\317n.Q\241\2466\340jR*)\236\260\227\315\213z\345\250\306R\256|)B\275.\340fR&N9\363W\334\303\2247o\305Z0\224\205\337\302\262\316S\\\313\232\361UXvX\214\237\304\303T-\3502\266ew\341a\327t\025\3332\247jO\234kY\013\n\006LD\033\t\0260\021m$\350q\bd\033\225\204H\036\2106\222\203\n\243\021\b!\221\b#\332\004\022\021\tZh\243\240\201\200<\"\2116\255d4\332\264n\377VY\234\254\327\313\353\350i\2744(\307\303*!K\250\252\031l=\371\260;\304\2247\017j\313\035\213\251\035}2\251* \200\002\031\3021\017`E\315\227\013m\247\301\210\255\220Zz\252yC\2331\261\016\243\245\2725\271\005\310\211\374C\0206\330\320\361\256mk\027\216~\331\212N\\\3714\017}\304b2\274\245v\321\234d\215A\r\177\314\231"
+	.ascii	"5\362\270\2071\bT\005\017\215x\312\021a\031\3213d\\\367M\317"
+	.ascii	"\267\313\336\023"
+	.text
+	.section	.gnu.lto_signedVBLength.6.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375`i\001}\016"
+	.string	"V\\bC"
+	.string	"\261&\035\037\n\252\nh(#\t\236\320\355\023g\244\374S\357P}J\260\204\211\212\255\302&\232T\217\236\037A\b@e\232\335\310\376\377\357s\245\323>\004PY\356\352\253(\360:\302ZB\310\336R\246\024M"
+	.string	"L"
+	.string	"N"
+	.string	"\273\253\300\013\256G\333\276\211\247R\\\202\236K\327\031\341rB1c\327\303@\027P=\302\007\250\036\225\304K\207\232%\337\002q"
+	.ascii	"\003\302\005\252\333\016?\\=\035\007A\273\373\230\347Jg\312\264"
+	.ascii	"@v"
+	.string	"\327\211\352<\334\361\266\037\330n`\177&,\376\334\273=\207\371;b\272\023\323\234\230\276`\332\212\351*\246#L\303\230\326\230N\230>\200\252\346E\201\231]\016_\215\275\211,^\356\375v\212\037c\016\333\336\311\265u\270Tp%d\354z\b\036\315 \3630\031\314\331\025Q\263\"\252\225Z2P#\324\0016\247TGSU\241\215\206\020\\~\276\246\376tC%?\373\273\306\030\247\024\227\037\204\332\222\271\273\233~?\251<\352\261\341\345D\013S\322\360\225\035jW(\311\243<\352\221\202\346\306\244\233\355m\251-\366\341\356\2565\"!\024\021\022J5\2620\022\272\020-\372\3202\023\021)\302H#\201\200!\013\221 \n\215\204`\024H\241\t\230H+\301>\0168#\031i\230I\226i\030\207\267\207\253,NMp\205\221y\323T\035]\261\375Q\220\212r\346\350\347\322J9J\300\206\245\227\245\006d\242\006\032"
+	.string	"`\325\243Z\350\253Wp<\t\007c\240\332"
+	.string	"\020\002\006\007c\236\332\300\251,\307\264C\352\350F(\2225\212\210"
+	.ascii	"\327\230\360\270F\225=\302\360L\220\212\"V\250\321\212\2379\""
+	.ascii	"5NQ5\266\253\224\001"
+	.text
+	.section	.gnu.lto_blackboxWriteArrayUsingAdaptivePredictor.7.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375`T\bu+"
+	.string	"\032N\240\020Dp\234J:\003\265\266@\026}\252KUp\235\024\201\240\026%\373\211\335X\222\031\264 \240\371vD\270\320\355o\257.\254c\355\300\340#\235g3\244Ps\007\356\377\253_\336\337\210z\021-6B\b!r\247\024\371"
+	.string	"\330"
+	.string	""
+	.ascii	"\001\217r\274\026\277s0LLp\212O\345v\277\342\240\025$WU\262\216"
+	.ascii	"\210=)QG\233\232\020\255\313\212\022&\211\024z(>\235\203\226"
+	.ascii	"\342;\224\013\f\235\203;\322\227\246)\323K{p\013;\370\362A\333"
+	.ascii	"+\367\271\255;\361\035\331\223\022\321\224PI\323\264\311\032"
+	.ascii	"\320\227G\344}\314&q=20\221s\241\276\271"
+	.string	"\230b\341\325\276\222/\331\272\333\213\240\236\224\bWF%M\337\232\034\205\276\364\333\177\314\227\350}\314\227\336\262\371\376\226\226\036.H\214\2707i\232:-\017\237\307\343\361x\362\355>\353\326\321\323,\311\255[\376\223#\225\345\031\303\270\216\222'\f\032A\016\006\354\006\031\025\247\317\356t\257_a^\365\034\"v\023l,\257\304;\311fl\316\030f\343$Q'\254h\376\370\270\373\001c\367t_\"\2333\206\211\275\236\025\3224u5\206\325\270\201\267]\304\266\226\215\016\005'P \276\213\375\027\216\256U\260\273/\022\2517\027\363[\367\3055\257z4\322~\177\345\245\031Y]\214\277\256z\334\235\303\002\243\306.\232\375\346U\037\225\026g\317\273c\302VK\330\352\b[\r!j\253\241\320\352\007h\365\323\335\376\006hu\323\337~\246\327\335K\257r+\275\311\277\340V\356\2443\371\025\334\311\237\340Rn\244\255F"
+	.string	"\254>\332j\243\263\372\300V\027\235\325D[=tV\013\241\325\006\320\352\240\255\006\332\352\002g\365\017ZM"
+	.string	"\255\366\331\352\001[-\340\254\356A\253\003\240\325"
+	.string	"\266\232g\253w\316\352`\255\326\331j\340V\243g\365Y\253\315\255.\317j\262V\257Y]\315\352S8m|\021:\246)\215\343\234T\257\264\023\362\272\277\312o\345\227r\322\276\003\307\363\347\330\346;\335\2154\345\272\231}9hZ\n\306\347jL\275\306\324\322\263T\351x\327\221\033\323#\326?\333\036\016G\212\301\336\343\216\026\350v`\215\264\016\254\220\027\242-\332\222\216h\207\316\b\355\220\320\336FY\235\201e\263\346\301\006\255\2015\375\316\345i\372\202\200\036,m\201\005\332\363\356g\013\374\254\331Fv$\260f\312<\255\317\022\330\323K\323\307\354\371\fxRZ\001;`\3176=+\240gM;27_8\002\254\23007\252iZ"
+	.string	"\033`\3156\f\376\345\003Q\224\035\342zSPy[9\204?i/\314\227"
+	.string	"\226\250\207\035O\345Y\233DU\275\261i\217\210\313\345\244\335Y\236=\351\202\273c\"\310\264:k\036!CS$\362-\007\356R[\322\242\013\334\033!\313+\232\241[\256\322V\277\242\332\271\350~x.Xs\317\273;3i\313\275\032\031\226\342\032\271I[\375\354k\321\n+\262\254\252XP\r\257P*\025U\030\260J\220\250\232\032b\255\330\241\"15\244b1uV\035KE\226\225\260t\360\304\202jxU\016\207YB\022ha\203\241\025\226\260j\004\325\360*\204\226\225\210\023\302)\024\"\234TTM\245p\022\016W85P\262\325\025\325\320\t\313\312j\350\024|\353\372\356\260\237\034\235\023\323\353Z\257>t\321\f\304aF\355\222\251LG\332\257\004\213\264Bd\204\201\353B\254qN\236\213\346z\306\346VJ\330\357\261\315 !"
+	.ascii	"\317\206\360\255\321N\330/\244\215\332\323\275\254A6W4\003\252"
+	.ascii	"\b\326\326\300\241\336\350\t;\264\b\310\265\262\272\242\332\337"
+	.ascii	"]a\314\214\260\022\226\214+\266\031m\321FX\020cyE39\257rlze\321"
+	.ascii	"B-\204\335\273\242Z\007\323h\241v\303\330\\q\255\353G\\\325\317"
+	.ascii	"\027S\003\204\215\\4<W/W\242\371\320_\312\254]4\324\322\263\243"
+	.ascii	"kj\276\313e\271\224\371W\215\001\200\236\250Q@\246\230Q\306\206"
+	.ascii	"d\244 )(f\r\260\002\021\252\242\266\001\021\200\255DE3\232\222"
+	.ascii	"Bik\fi\214@\230\016\266\017\265\373Z\265\207\022[\373\240Z\324"
+	.ascii	"\t\242\355\317f\262\241H\013\to\351pNy\322\240\021\227\003<\354"
+	.ascii	"\030\275\235\340~\221\032\022\331Ke\233\017{\024B\324\3375\013"
+	.ascii	")w\231\340\200\262\374&\001\024 H\035X\207$\376\316\245\235\361"
+	.ascii	"\r=\033\330:\035\364\036\305\240\202a\013i\2513K\023\244\237"
+	.ascii	"!\244\303\321 \253\256\263\222d8\252\251\202=\345\345\322\204"
+	.ascii	"\230J\te\\\260\022\374e\313\307\307\021\311\0332\240\376\364"
+	.ascii	"Q\177\003\002\251\374gF\021hp\357\201+w\037\222\007\332\023\265"
+	.ascii	"\247\020\270\307\213g\264o\242\260)\002\300]*\240|\375X\227\337"
+	.ascii	"\256\254\003\200\243<\026\034\250c\"\346HY\260d\237\375b\231"
+	.ascii	"Q\"\005;\330`\215\f\375 \274\325>\262\327\2453P+\017\031\235"
+	.ascii	"3\271\251\b\356\217\253\207qww\320\347\371\272+b4Vg*\320\351"
+	.ascii	"f\351%a\360\320\375\220\006 <\356jp\003\234\372\2651Y\200E\212"
+	.ascii	"u\277\246\207\020i\323 \266\342\255\363\227\2503/*"
+	.text
+	.section	.gnu.lto_.symbol_nodes.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375 \353=\004"
+	.string	"R\006\030\"\220+\035\033Lr\210\310\210v\333\345O\210z\223x\370\377\377W\247\333(\376$PY\3246\221r\313\024=,\036\n/\272@\371@\354(\026\206\243x\tC\247gp\300\376\267\210\025Y`\212\310&\003\031pk-M\301\016\301\230\332\246\374\304\006>\365\314KZ\267\225\206\341\377?V\251m1\001\017"
+	.ascii	"@\024P0W\251?\004\303\247H\211\231\376\024\f\317\257D\266d \f"
+	.ascii	"@\370\316\357\200\030\bG\0073\017"
+	.text
+	.section	.gnu.lto_.refs.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.494953e1f282dbcf,"e",@progbits
+	.string	"(\265/\375`\363\t\2054"
+	.ascii	"\232\\$\024E`\346Q\007S\241\305\272\003\332\263\375|\345\367"
+	.string	"\370\375g\355@\273\340=\255\215\303r\352\347\245\001\265d\257\207\202f\371\003E\"\216\217\341\275\036\227\340\005\375\372\241\025\036\377\n\276\331\032\017\276\231\002u\263C\022\231R\020\001)\0014\001dnV\340\352\237I\345(\214\013\027=q\377oR\203\006DoX:\250\322\354\317\242\365\212*\212sG\251^\3269\314\035\322\261<\324\310p\356\024\252\277#\245=\rj\273\227n\317\342W|\f\273\377\310\377\027\200\265\3743\016g\327\342[\334\351\363.\355X\374\355 \344\373\315\377\267(\210\r\016\210\023\347\266\240\266s\351\001\354S\350\235\332\356K\213\334\227\272\330\257\275y\224&\227\357\027\351\312\316\252\372\340\214\261\312\363\243\024\201#\2459\352HV\272\375\313\301|\272\026\313}\347\377k4$\307v\234\202s\277\216\224\252~\224v{Z\324(\272\235(\251\033\353\272\333\315\220\013u\273\032\324\355\317\334\355pd\335\275"
+	.ascii	"@\267\273\351n31\335=\246v\373Z\267\357\272]\327\355\336\335"
+	.ascii	"r\335\r\327\335t\272\273\255\273\325\272\273Kw\237u7\211\356"
+	.ascii	"V\323\335\317\356F\323\335d\272\033\255\273\301\272\333\250\273"
+	.ascii	"\315tw:777\327\355$\272q\202\356\3350\275G\272\353\377\253\354"
+	.ascii	"\265Nv\365\266\311T\266MWi\364\310_\277\311\016Q\221\256\262"
+	.ascii	"=\343*{m\223U\266H\246\322(H\327\221\264+;\314/\177\266\310\327"
+	.ascii	"\312\342b\223\275h\373\272\337\366\357\316\252O*\370\347r\223"
+	.ascii	"ml\017/;F\265\216_X\327\337\377W\312:\022q\037\031m\243\270\377"
+	.ascii	"Q\216R\2375a}\243\237\304\243k\027\327cU\375\017\370\367?\353"
+	.ascii	"\177\365\217\376\377\372\377\273$\327\373\357\243\327zee\375"
+	.ascii	"/\223\262\236k}V\375c'\2342e\333$\342\376\236[\232^o\365\256"
+	.ascii	"\356\365m\314\244\332\\\263<\026\234\352\245\314a\007g\217z\032"
+	.ascii	"w6\324\325x\022\2645\tT\225\261k\350\032\032\207\026\261r\003"
+	.ascii	"gOs3\356T\3623\355b\256\326@\354\373\276D{\326l\351\301\271\347"
+	.ascii	"`\324\032\377\256\224\372\334\234+\225)\003\022K\253\302b2\216"
+	.ascii	"\306\263\322\\\362\006\347\263$\214\303\353\317\033\316\355N"
+	.ascii	"T1>\306\235\016\365/\355`<L\347\367\037)\241\373\007\3650\367"
+	.ascii	"\342Qg\006\003\363\366\377\355W\272\177\016\365fhd8\373\037\325"
+	.ascii	"k\253\312\027\316\356'\bH\234\226:8{\037_\333}\321!\343lh\336"
+	.ascii	"\361\374R\303\271uWx\360\270\034~\027\371^\273-Dl\274\375\222"
+	.ascii	"\313\267#\233\222\366\214k\227[\203\235P}5\301\331\365\270\331"
+	.ascii	"\220\033\232U\027\316\236\307\327l\275v\336\344\352t\035\207"
+	.ascii	"\363\177\366\227\027\322\334R>jg\332\330i\207s3\236\234(\273"
+	.ascii	"V\006\016\034\247\323\373\243\0343o\277\\\372tf\272\034\3611"
+	.ascii	"\247\235N\317\0210\347\307u\253b\312\261q\223\223\356\231#\027"
+	.ascii	"v&\344%\256y\005\3478\376E\027U\313\302\366\245\266\263\3616"
+	.ascii	"\355lNg\3636\365?\271\276\277\005\200\b\022\034fq\277L\372\274"
+	.ascii	"\255;\002\005\037\343\375\203\375\177\001\241\034`K\374\340\334"
+	.ascii	"x|Mw\007\245o\242\f\261\302\2711\2536\356N\237M\376?"
+	.string	"\016\240\367\223G^;\220\273\257{\310u\256\340u\007\330\374\013\351\272\243B!c\177\340\334\335\b\276\273\333\247\374\257F\377~\262m2\327V\213\032\245\321\373C\004|\263\353\333\227\251\314\356\343\177\337\037\311T\276h_7\331\276\356\032,\210D\rN@#\220Z\352A\324P\030\\\032\022[\264 \002\r\004\241\210\300!\207\250'\032QB\032\274\250\241p\252\304\214\247b1C\320(,\236\360\025\2158`\024\016=\030h\240\2241j\030\374\240\301\004Tp\030%\234\"j\240\260\030\034\006\243\324\236\300\344\200\251\202\214]Wh\202\320\004!\355\nM\277_\023\323Om\246\237\216\351g\034\nw\306\226b\320D\027\301\342\222\221H,.\t\005\217\240\202F`\220EpJ\235r\n\021\214!4\272x\202\312@\300\350\024A\202q(\204\241\366\357\267\001A\t\020\035T\340\203\"\321\b\024B\005\213.\234d\020U\254"
+	.string	">\261P\2614\024>\265X\002\026\247\226\036\370\214SD`Nb+\235\0364\263\252\227\007gl\r\017\326jS\343\221\206\003g\214\205\361\r\234\325\030\013\333\340!_\214\225\377Y\367\004D\356\t\200\240LX\2614w\346R\337"
+	.ascii	"K)Z8SQa+\374KW'\347K\310\031\021\017#\\\226T5\266\362\261_.\321"
+	.ascii	"\251\251\370\210\217\336\326[\303~kB\225\037\177\342\376\227"
+	.ascii	">\fDI\017!O\370\360\301+\006\261&\"n\344(\203\277\361\252\272"
+	.ascii	"y%\351\201\263\317\271\033\217L\200\270\250\321,\245\2243\"3"
+	.ascii	"#\"\222$I:\220\002\0211\263:\022\300F1n\211\215\210L\220\024"
+	.ascii	"\224\244\260l\007\302G\274\243^?@\\\260\303\312y\354P>k\367c"
+	.ascii	"\266\002|\264\\,\367\253hlZB\033\227GK\260\223\\\376\200\030"
+	.ascii	"\274\021\220\003\232\231h\310U\236\247\361\032 \257T\201U\017"
+	.ascii	"\312\237\272\260Pk\002K\273\211\316\311\270\255\260\225\f+F\265"
+	.ascii	"+\360\030\n\200#2\215\317\333u\036E\346\377\344\023<\007\323"
+	.ascii	"\026\205\331\201\202\341\367\334\236(R\031&#\260\245\306YVP\357"
+	.ascii	"\273\266\276\321\315b\0036\200;\3563`R\002\032Xe\214`\\\221\300"
+	.ascii	"\344k\204\201\260@\223\266\276\263\263\340B\177\274\267J\003"
+	.ascii	"\246\267\314\205\321\263\272\2322\213,?'\323\360\211~\035\303"
+	.ascii	"4\244\002r\322\210\030\361\340\301mt\211 \361\306\223]\362\004"
+	.ascii	"\005b\2061\0218\325\322Sk\335\251\304\352\026\201\324\211\325"
+	.ascii	"\355U\017\343\235x3\217K.\016m\355\311|\325\315}\027]\377^\013"
+	.ascii	"X\346E\267HC\004\322\230\263\307jL\371\001\335\003s\016\364\t"
+	.ascii	"\221f\240,\212R\002t\250E\201<>O\005bP\347\036\364\354\256\213"
+	.ascii	"x[\323F$\007,7/?\217lk\007\342{i\241\267\20361\307<\213W\230"
+	.ascii	"\241\177\3268\022\263\336\3657o\336\005{\023<\0313\344\\\376"
+	.ascii	"\333.\307\236\366\205\311\300\337\366i\255r\210W\025"
+	.text
+	.section	.gnu.lto_.symtab.494953e1f282dbcf,"e",@progbits
+	.string	"blackboxAdaptivePredictorInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357"
+	.string	""
+	.string	""
+	.string	"blackboxAdaptivePredictorSelect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"blackboxPredict"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"blackboxWriteArrayUsingAdaptivePredictor"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.494953e1f282dbcf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
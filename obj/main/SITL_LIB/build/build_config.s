@@ -0,0 +1,191 @@
+	.file	"build_config.c"
+	.section	.gnu.lto_.profile.f200daccc414d7f6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f200daccc414d7f6,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\222\252\354\340\007"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.f200daccc414d7f6,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.f200daccc414d7f6,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f200daccc414d7f6,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.f200daccc414d7f6,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f200daccc414d7f6,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.f200daccc414d7f6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getMcuTypeId.3.f200daccc414d7f6,"e",@progbits
+	.string	"(\265/\375 \331=\006"
+	.string	"\324\nx"
+	.string	""
+	.string	""
+	.string	"."
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\303\255\234\002\001\275\001\001"
+	.string	"\177\002\001\177\001\247\003\005\001\006\023\001\004\005\001\006\025\001 /\300\200\200\370\305\207\330:\221\250\300\004\177"
+	.string	"}\274\001\273\001"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\317\025\307\207\236\003\002"
+	.string	""
+	.string	"\244\003"
+	.string	"\200\200\200\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	" ./src/main/build_config.c"
+	.string	"\t"
+	.ascii	"\245\214\223\031\020\f\037\025\026\253\200\350\232\227\205 \302"
+	.ascii	"]y\265\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f200daccc414d7f6,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.f200daccc414d7f6,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f200daccc414d7f6,"e",@progbits
+	.string	"(\265/\375`\f\002=\023"
+	.string	"\366%\206J\340\320(\035\360`\375`\327\322\235\006a+>9F\020\026\333\306\374\216\b\r\314\220a\277\214(\037\230\276\3530&m\177]a\350\241'\334f\243\n\302Z\340\205\253\031\357\211\343Z<\210\036\243\336\332\234\005\224\351\025\231\004iD\312j"
+	.string	"k"
+	.string	"n"
+	.ascii	"v\247\374wb\027~\024zqO\3218\232C\273\214\3467\360\373\317~\332"
+	.ascii	"\307\375\247\377AF\332\375I\224lm6\373o\b\314N\243F4\1777T\243"
+	.ascii	"\210\264'N\2312\022:k\357pi[Y\371\332\217\314\021<)\320e\377"
+	.ascii	";\007X#C\340\350\274 \346\376\300\3147fnf\206\301\314].\227\313"
+	.ascii	"1\263\211\231E0w+\001\036N\223\374m6?s\036\3764\177\261|W\177"
+	.ascii	"O\226.\232$x\353\r{\3131\374\255\343\305\222\366\315\321\016"
+	.ascii	"U\032\332\323\244\241\275&y\361\264\255h\273\025K2\344\271\346"
+	.ascii	"h\317J\226\354i\222\265\333\f\031\t\254\370\232\031\255\216%"
+	.ascii	"\234\275\345\217\376\036\242\371X\362\323\312\361\250\332tQ\f"
+	.ascii	"W"
+	.string	"\023sQ\313\276\377\013\314b8\345E\\B\"\177\317\377\003\336\216\005\222u^\007\001\240Qd\003E\347\361\004\260o\003\365O\237\314m\353\026\354\331\312\237\377\035!\325\0211\210:\317\324\002>\257\003|\334\247\217\244O\037\263`\f\365Oa\024\220\025\200\314\375\275\216\377A|\334\2171\221\257?\272O\314#M\352\022f\366Nb\222{\312\243\003\324!\252%:\357\034\363W\362\367c\030\006l\342WL\013\206\222y\275`\250\220\026\313K\b\247R\rL\022 \254\200,\023\027\227\005\230\027\213\245%\203k\246\002\n\306E\341\005\305\202i@\231 hq\320\212\341\020a\206\365@\246\345\"\302,\027\254\005\323r\001\031E\265@\245\262\001\204UV'\253\223\217UV\251\324J\225\002Y\225\"1\367\212\356\341\366\371i\237\276q\351/c\377\t\023\003(\217\233N\217\337\320N$\025</\354\016\356\0333\203\224\016\034"
+	.string	"Dh\225U\3442\251\211r\354\\\\\323\206Qo\263\242\275\245\227\315:Sb(\\)\315EIQ3\322"
+	.ascii	"E\005\201g!Z\343hkXj\r\247` \251i\214\320CE-\331\241\273\227"
+	.ascii	"\302\346\2466\256=W\314t\306['\031"
+	.text
+	.section	.gnu.lto_.symtab.f200daccc414d7f6,"e",@progbits
+	.string	"getMcuTypeId"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f200daccc414d7f6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,272 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.4f94db43bcbe9888,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4f94db43bcbe9888,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\242\375\331\303\002\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.4f94db43bcbe9888,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.4f94db43bcbe9888,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4f94db43bcbe9888,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.4f94db43bcbe9888,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.4f94db43bcbe9888,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.4f94db43bcbe9888,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.6.4f94db43bcbe9888,"e",@progbits
+	.string	"(\265/\375`\312\n\3655"
+	.string	"\252b\200\02560li\016\0030l\266\375\2766\022\006a\254`\225z\205P\200v\013"
+	.string	"C\005"
+	.ascii	"\030b\2737%6\322\245\300\320\267\355n\351\317;\n@g\327\367\333"
+	.ascii	"\252\251\331\224dJ\001W\001H\001T\204>\350\335\322\244=S\210"
+	.ascii	"b\234\343\210\334:\344q\253\222\366\\\341\235\3209\242\255F\332"
+	.ascii	"\263\205%\245'r\355\264g\215\244\364D/\035\355\371\302\321X\347"
+	.ascii	"\212\\<\344q\213\214\366\214a\210Q\217+\342C\036\267\244h\317"
+	.ascii	"\031\036H\351w\256I\036\267\212h\317\032f\235~\367\246\221\307"
+	.ascii	"\227\245=o\200\245\303\361>\224\366\314\241\025\352xk\344\361"
+	.ascii	"\365\264g2UB\317S\311\343\033\322\236\313N\311y\336\003\322\236"
+	.ascii	";\220bs\275\225<\276\207Pq\256\367h\264\347\017\236\212\376\310"
+	.ascii	"u\265g\020\233\212\376\350m#\217\177\324\236\3150\275\371$\267"
+	.ascii	"\005y\364O\332\363Y%\027>\351m\311\243\337i\317!&\275\360=7\006"
+	.ascii	"yt9\332\263\bHp\276\367\316 \217\316F{\036\241G\303)\2715\310"
+	.ascii	"\243S\321\236I8\212sJ\257\022\355\271\304\2428\257\204\203<z"
+	.ascii	"\020\355\331D\"\035^\351\315\241=\2370\244\3035\271<"
+	.string	"\310c\253=\243\030D\347\232\336\255=\247\260\233\363Mi\332\263\n?r\276\351\365A\036W\364\3313\347\234\334\037\344\361\314\217\027\370y\306\216\207\256K\213'V]d\001\001r\364$\236\215\344\361\265g\274E\005c\022C_\347\355\374\235\307\363z~\317\367y?\017\350\355^\320\017\372Bo\350\021}\242\277\373E\337\350\035}\336\353\375\373\220^\322OzJ_\351/=\246\327\364\233\276\323\331\177zP/\352G}\2517\365\250>\325\257zV\357\352_},\263\237\005\302\030\007\301\" G\204\250\300/\013\316\202\013\340\t\2549\013/\200ouj\367\267\245\212M\277\276Sl\033\334_&un\370\345i\317\277Pt\034\334\037!\355\031\200\247\"\207\367GGs\232#K\243=se\022\222\375\272h\317]\226\346\312~S\264g\257=\271\262\367\307D{\376\212d\2543sgi\317`\217\214uf\357(\3559"
+	.ascii	"^\334Y\030#\343\234\2637S\322\236\305\024\305\205p\361\264\347"
+	.ascii	"\261Cq!^\001\204J\021n\036\355y@\240R\304\233\t\374\211;\341"
+	.ascii	"f1\332s\001>l'\336LE{6\220\307X\207\302\315\007\352\214u(|\b"
+	.ascii	"\350\024S\3702i\317\t\342\300\245x\367\264g\005n\344T\270>=\355"
+	.ascii	"y\301\032:\025\276B\3323\203G\203\272\235\353k\360e\342\334\316"
+	.ascii	"\347@L\351\201|Z\264\347\007\377E\207\007z}\020\236\013\234\013"
+	.ascii	"r}\021\262\030\353\\\320\273J{\226\340\032\347\370 S\332\363"
+	.ascii	"\204\017ii\266iY\004\216\341u\253{\237\255\220\270[VU[\201c\230"
+	.ascii	"Xd\200w\0331\001\036\266\251\300v5QvE\331\222]\333\265\341\272"
+	.ascii	"M\005X\335%Z\306@\224\330\236)\313\252[\215m\317\242\271\236"
+	.ascii	"\273]\211i\b\360\231\002\321v\370\006\344\302,*D\3236\030\344"
+	.ascii	"\302\300\223-S\225\270Ov\210\266\301\240\030f\213D\266\250\266"
+	.ascii	"n*\332\232Y\246hb\370L\211\302rM\033\242B\224m\335v\027\016\022"
+	.ascii	"\323\026\370\303Da\271\331\326\215e\321\205c\220\315\220\203"
+	.ascii	"\001'\243L\206\r\032r0\312n\320x\021W\026c\007\2172\262\004\030"
+	.ascii	"G\016"
+	.string	"\270\035e=p\340\330Q\346\205\207*\272\026\203\255\272\337\322\276\260\347q=\316\307\373\370\037\007\344\201\\\220\023\362B~\310\021\271\"\277sF\336\310\361<\317\037\371\353\221\\\222\3579%\267\344\227<\223krN\336\311?9(\027\345\243\274\224\233rT\236\312W9+w\345\257<\226\313rZ^\353\203\274\220'\362E\336\310\037\371$\257\344\231|\223\177\362P^\312O\371*o\345\257<\226\327\362[\276\313{y0\037\346\307<\2317\363g>\315\253y6\337\346\337<\234\227\363s\002\370\034\252\303|\246\346\233\331\205\337\366\311\262%\032\211\201g\200S\250\3563=M\242\252\246@\224H~\231{\354L\323\206e\027\366\302\373L\213\300S\315\\\273\360\232Y\262\353\017\013\211\233(d[s=\303\360\t,\262(\233\226\\\230\r\006}\370\024\242,\333\271\203-\033\fr\275\255\255;\270\256jA0.\334V\356"
+	.string	"8\030D\201a8\f\257\231jj\20683\023\341V\n\307\360ZD[3f\267J\f\376\360WZ\026\331\332}\002\207h\360L\033\226\233"
+	.string	"\016\262\355.\201h\312\205\323rh\002\203\352\271V\262\355[\331V\016\213[l\315x\253\353\360\\[vx\356]4\3030\332Z\364a\025\005\026Kv\227\302\325\013\253\261\333\207\335\312\364\334\255p\237,\372\205\3679D\313\315\266\3526K0\f\206\327UM\333\264\034\246\241a\370d\313\335\246\rQ5VU\205kkn\001\370\215EY\224;\255E\331a\t\206\203\304\224\304(qm\205\305\315\256\235\304\265u\333b\370m\263\247\360LO\226"
+	.string	"\336'\233\242A/<D\205-\360\207\207*\312\232\347\336\252\331\232e"
+	.string	"l\226\001\200\274\250A(\203\254\226D,))H\222,c\260\")\032*\017\021\300\220\202\215\240\326\236\001j#t\202\005\223i5\024\250E\017.zAP[\262\016<\031/\227\357\036\331qg\231Uff\364\375X\027\376\256v(\202\237a\300Ey\327\021@)\245;m\334\35495\205\375\021\232\321\023\256S\r\\\262\277?t65\325 \002\267\004\256\307\"\0249\265\244\030{\267Rx7\201\370T\307\246\252\222\222PFG\302\243\233JV\234\216\026]\327\367@\240;\303f\211\230\372b\204\016P\037\030\200\322S\037\310i\275\321\2655\034\203\235\255\002'\212\001\002H\315\364\024\222\265\021_\030c\373\023~\006\276"
+	.ascii	"\221j=S\266\350^r\346>\377\326\333\331\234\363\002\377\026\301"
+	.ascii	"!\033x\214HP\315\234q\315\353\212\333yc\305\331E\302\302\331"
+	.ascii	"\245\206\320\0058\235\303}\352\353a\261K\277}\314\263_\316P\333"
+	.ascii	"H\244\022*\024M\"\211:\232\316=\320!\221A'\313R\327\323_\300"
+	.ascii	"l\035\221\201\0012e\230\214\362n\256R\250pl\002h\331S\235\336"
+	.ascii	"\277\314\334\214\253\277z\374\215\024d\034I\345\034N\240\031"
+	.ascii	"\236\005\017]\202\216\b/\237\311CS\271H\353\257t\226\004\243"
+	.ascii	"\307\245CQP\231+\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4f94db43bcbe9888,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	"\201\204\001\005\001\004\002\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.4f94db43bcbe9888,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4f94db43bcbe9888,"e",@progbits
+	.string	"(\265/\375`o\n\3352"
+	.string	"J_\304\023B`\346M:S\030\224~\203.\335\333\214\207\216\264\351\201\303N\373\324\302\033\221\207\017+\022\311\tR|\215\341\272&\312t\366\016\336\035\311V\260\212\214\236Z\205\360\243\364O\026\332,\352o\330B\336A\246\024\367"
+	.string	"/\0015\001e\276,\365\333\354\247\335\313\307\374\214\265J\325Z\017\004\261d\201\305-\265?\346J"
+	.ascii	"SD#r@\020\355*l\n2\355\b\315\241,XK\277v1>\333\303\270I\203\001"
+	.ascii	"\370P\253i\265\326\263e0\326\032u\266 \242Z\243\202\377\203\377"
+	.ascii	"\001\355\342E\326fRc\350\035y\372`\354'\257\226d\026\265\220"
+	.ascii	"UYk\rR5^UwK\215\274\320\354%\237d\372_l@\255j\360\200\336\203"
+	.ascii	"z\241I\213O2\275=\333d\354\233\260_\302>\t\373#\354\207\260\017"
+	.ascii	"\302\376\007\373\036\354w\260\317\301\276\006\373\031\3543\331"
+	.ascii	"\267`\277\202}\n\366#\330\207`\177\311\276\003\373\t\354+\331"
+	.ascii	"7`_h_\200\375\240\375\237}\237}\323~\221\375\265\177\333y\266"
+	.ascii	"\023\331\276\263]\310v\235\355@\266%\330Wb\333\217m;\266\347"
+	.ascii	"\330v\263Mm\303\331\336\345r\271\264\215\264me\007\370\005\275"
+	.ascii	", I%K\375:\373t\017t\266\026\265J!1)\373\002[j\271\013\315\337"
+	.ascii	"\237\323\007T\244\004\256kl\251\317\277s\374\235\373\331\352"
+	.ascii	"c@\255_hV\264\270\316\024\362\323\347\306Z\225@\2535.[K\217\347"
+	.ascii	"y~T\272\036\177\317\371\270(\nY\221\257\213\362\203j\251\200"
+	.ascii	"\013\315=\261\327\243\326+\231_.\257d\372A\342\354&\r?>\356v"
+	.ascii	"\226\252\226\207\2624\272Z|S\001)\371c\213\240\245\227{\235\037"
+	.ascii	"\031|\016)\357,\357\320R\367\350\371\f\314/\317\300\364\260g"
+	.ascii	"\377\355\370\267\317\241fG\272Z\324\252p0uC\f-\365\347\3307\363"
+	.ascii	"3\227\263\213GL\346-\365\345\330_s6\207[c\255n\346\0266X\312"
+	.ascii	"\226\276\315\335"
+	.string	"\3748\341o|8\217\343#)d\rS+2x\204GP\023\345\322%\032=\177\202\031\374\004\363\002\236d>\315\351\253\3610\366\325e)\200'\231M\247\217\306\344\262\246\013o\351.\255\350\371g?\332\361hw\243u\310T\255Ug\026\361J\240\273ZdR\241\227\345O\237\"d~M\f\305!\"}ZS\001@9-Z\360,\375\324\205\346\2005\247\367I\2007:4$]kDdw\207\267\324k\264\327\311r\371\206\314\335]-\375\002&\247\267\211\221X\227\227\261\245\n\226lQ\243\221+\317R\357\226\275U\253d.JLl\351\227\310\351\325\372\251\251Rs\223$\253\017\361\316\333Ro\226\275W\213\265T\214\210\265-}\202\252\323kud\006-\356k\251\322Rm1\217\0309c\226z\213\366\r-\222\2679kaK'\3009\275G\276\b!)3B\334?^i\020-\365\022\355%\262E\214\334\344"
+	.string	"Q-=\362B\023\301\223\314\235:\275CzF-[\274\226\036X!A\212\222S\204\332\226z\203\330\267[ gk\361\023\303\262R^h>yz\245\202v\314\f\252\262?6\nO\330\027:K\275QnG\\WK\346N\257\0173\017\257\210rip\231\2074\210\217\227\220\245~\236}DO4%\365\304l\351\205\013M\323\320\351\037\002\240\207\n\r\326\322\"\274;\037\220\242\034 K\375;\373\204^\310\\\222\331\021\227\372\314\205f"
+	.ascii	"\273\323\037\344\223\272j\253\262\364HP]C\026\033\316\341\215"
+	.ascii	"'\243\242!\013\016FGC\026M\030\2067\236v\364t8\331xJq\003\352"
+	.ascii	"i\b\303I\307\317J\206\302\341\224\203i\b\005\225\203\311\227"
+	.ascii	"\303\305\f\030\324\347)bI\005\212\022=\030\026\230b\324x\332"
+	.ascii	"\361\202\351\306\223\013\033L0r\350`\262\200@\207\223\r\027("
+	.ascii	"\234b@\235\220\261\343\205S\f\340\030\345V\027\030\221U:\314"
+	.ascii	"[\0241:61^\305=+\306\336\272k?88v\356\244\234\3360\313\245\032"
+	.ascii	")`\324\326\326\256\024\227z\325\354En\022\310\245\246\246\265"
+	.ascii	"\364\305\013M\002^\247\367\b\244:[k\373\342%l\255\rk\251\327"
+	.ascii	"\213\275P6\215\3072Q\241\245\326Cwz\321\350\264\241;v9cAue\317"
+	.ascii	"\330Z$\242R$n\351n9\275\\\032\224a\203f\251\221\226,@=[fvK\275"
+	.ascii	"Y\354\305\262f\3008`n\216,\275\361B\263\300\225\323[\346#\003"
+	.ascii	"\227\210li\222\025\262$\022+\263\245^2\373\177\266J\023Q\n\224"
+	.ascii	"\245~C\350\364R\3412u\250\313\224\261_\225\013\233[\352\035\263"
+	.ascii	"W\312\212-q\211\026\240\245\246\273\320\004B9\275Q\226L\t\007"
+	.ascii	"\267\024)\fl\356+\315\235\245^0{\275\366+\200\266\25014E\024"
+	.ascii	"$\214\013Dd$)H\262\034\240\"\021+\"7\021p\241\222D\3202\262u"
+	.ascii	"\003el\346.\352\2354\333R\031\3243\253\020\273\002\204\\\310"
+	.ascii	"\033M\n\002QcL\002\030\017\205\360\300\\\272 \212'E\377Z:[*\036"
+	.ascii	"\211\004\230\317\311a-\263\306\316\226>\340\004d.\034.8=\267"
+	.ascii	"C`\033\250\305\313\343\004\357\rb\202\261\255\321d)\226\333\211"
+	.ascii	"d\232\3638\255\260=\306\214I\031#\212\201\366\341\372\224b\026"
+	.ascii	"\337\242A\374\327\264aw\2341f\264\374\030V\332\214.\2263\223"
+	.ascii	"%\006E,\300\237\177Wq\226\275c\027\024!\352\030Q\2066\204\251"
+	.ascii	"\303\\\030\376\204\024\241\314\343\307\204b$\n\202\026K\315\341"
+	.ascii	"G\023#\307Q\307h4\t\300}\246\030[u$\257\017\356\313x\207^\"j"
+	.ascii	"6no\337F\302T\250*\207\032}\020\020\037\324JH\177\354\006\316"
+	.ascii	"E\264\276f#J\353K\361\026\247\025\266\307\230\261T\032\262\024"
+	.ascii	"eK62\246\313{|Mk\032\212&\314u\254\271\267\202\251\314\2344%"
+	.ascii	"\212\254g\362s\354c\207U\311MJi\357EE\334\204\371\372\350\372"
+	.ascii	"G\240/z+:\340\205be\334GOA\320\241?\020\364^e\211\275\272 >q"
+	.ascii	"+\331Q\363I~\031\350\360W\371\212#\016\212\270\003U"
+	.text
+	.section	.gnu.lto_.symtab.4f94db43bcbe9888,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"sectionTimes"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4f94db43bcbe9888,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
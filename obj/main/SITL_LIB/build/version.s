@@ -0,0 +1,256 @@
+	.file	"version.c"
+	.section	.gnu.lto_.profile.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\204\322\205\374\017\001\264\370\365\230\f\002\274\222\266\373\007\003\373\226\307\203\r"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.cd82f3263a095589,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_targetName.3.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 U\251\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\234\360\310\223\t}\273\001"
+	.string	""
+	.string	"\tSITL_LIB"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_shortGitRevision.4.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 W\271\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\236\364\320\363\t}\273\001"
+	.string	""
+	.string	"\013norevision"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildDate.5.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 X\301\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\237\366\330\203\t}\273\001"
+	.string	""
+	.string	"\fOct 19 2026"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildTime.6.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 U\251\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\234\360\340\203\t}\273\001"
+	.string	""
+	.string	"\t04:26:05"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	"\201\204\001\005\001\004\002\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.cd82f3263a095589,"e",@progbits
+	.string	"(\265/\375`h\002\375\021"
+	.string	"\346\037vL\300Tq:P\315\263\337\r\241l\022\236\206\270\\+\360\301]\320\033\353\001\200\222JDL%\212\033\001G~\207\226\224js\2657M@\365\252\310`V)\206\376\177+\364\001"
+	.string	"\b\002\"q\274k\t\2353~-\355\257\032\t6\3332\005P"
+	.string	"e"
+	.string	"f"
+	.ascii	"\266\0036\335-\266\211G\272[\"\363\t\363\311\225\335\254\310"
+	.ascii	"\201\367)\341\331\347\250\037\275\362S\370\225S`\310(\3606\334"
+	.ascii	"\360\337\327\341?\357?\021\354\377\356\277\320\177\373s\354\277"
+	.ascii	"\356\177\356?\356\377\355\377\375\337\373O\372\375~\277\377\r"
+	.ascii	"\376\267~k!&\200\354\275\013\016\3077\3332&"
+	.string	"\33583\0267\204\316\020#\366\336Ax\356a\236\301\340\031\337n_pukD\212\321+\247g\3243>\003v\006\017\217\233\325T\343\242\341c\357\3171~\246\361\013\006\"q\275l\032\327\275\232\2103\017$R\254biw\344\002f/\327\370\347l\343\365*+'\221\371iZws\"P\024\361N5\0164;\366\236y?\0171\221\312K\247\204\275/\342\024h\272A\236q\200<\256#\231\275%g\033;R\315U$g\357y\367s\020\013\261\355A7\206\356\026p:\001\243\351a\357q\234\002K\214\002\231F\236k\240\300\231\232\265E\021H\020\021\025\366\352t=Av4\b\261\367\025r9\231\250\223\021\346\252lQM\227\264TK\316\030S\201z\262\250)\372\302\n`\252e\002\002G'\230\351\250\242h:\232\322\362EuO\222\b\n0ha\tU(0\350\311J\315\230q\2049\313\325\250JY#\312"
+	.string	"su.\210 \341\244"
+	.string	"\241\264\303\027~\310P\213\331{\366\375\254\203{"
+	.string	"@\264\300\311\261\367>8\005\236\206\310s\016R\254\027. "
+	.ascii	"\003\t\344N\007-\302z\311@\361\260\017Bi0\303\231Y\351\215l\033"
+	.ascii	"\227\367ki\362SA\301\314\002\315\362\265\345\350MZ:\375\303g"
+	.ascii	"\261\241\356\236\b8\330`%\274\361\211\233\254\t}\013;\342!\313"
+	.ascii	"-\366\312\206`T\002\035\326\210lp\241\355\357\227\001\203\275"
+	.ascii	"\225DX\363\326\241\r3\237\236\fB\001"
+	.text
+	.section	.gnu.lto_.symtab.cd82f3263a095589,"e",@progbits
+	.string	"buildTime"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	""
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312"
+	.string	""
+	.string	""
+	.string	"targetName"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cd82f3263a095589,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,343 @@
+	.file	"bitarray.c"
+	.section	.gnu.lto_.profile.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375 lM\002"
+	.string	"4\003`"
+	.string	"\006"
+	.string	"\227\346\274\270\b\004\002"
+	.string	"\001\346\223\345\213\006\002\277\330\227\230\003\003\330\313\241\243\016\004"
+	.string	"\002"
+	.string	"\004\343\304\327\323\002\006\002\001\005\320\272\226\256\013\006"
+	.string	"\b"
+	.ascii	"\200@P\301\3446\201fz\252\226\331L\016\243\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375 g\225\001"
+	.string	"\370["
+	.string	"\006"
+	.string	"\002"
+	.string	"\001\001\003\002\001\003\004\004\001\005\003"
+	.string	"\001\002\001\200\004"
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.string	"\300\020 "
+	.string	"\020\f6\006\005\273\024\f2\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"]\005"
+	.string	"R\310\032$\200\265I\007s\342$\2512`b\304\t\356\210L`\363h\215\220\t\221\021]c\213\212\337\261\271Y\262\345N\001\317H3\022\017q\"\342\205\035\206\362\020\022\336\266\340\243\215\016#\337\274\f\242\243\242&\003\177\204f\266A\004\250\250i\360\272\243\262\004/7\344\353\207\215\266\2019\035\276sm\233\254\377h\244\0317\005\003\332.\237lT\030"
+	.string	"o\033\"m\305"
+	.ascii	"Qn\002| :\b\274\313\371\213\\;\260N++\324\0047\305\036X\252\006"
+	.ascii	"\025@t\340c0\355+\201\001(I\220\200\247\340\252\216\f\312\026"
+	.ascii	"\226^y\256\245\201!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375 \201u\002"
+	.string	"b\304\f\025\260%\351\f\303\200\226$!\264%\211\3430\340\0245\"\267L2\222\230\231Y+\245\216Cs\254Ur\353"
+	.string	"\277\004\t\317?)\333\312\267\312*~\n\024\b\n"
+	.string	"\315\244\361r\233\322\230T\022 ,0\2223"
+	.ascii	"04\227\3617\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\001\205\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375 \312M\002"
+	.string	"\264\002\276"
+	.string	"\006"
+	.string	"\002\020\001\002\006"
+	.string	"\001\002\300\005\300\007"
+	.string	""
+	.string	"\002\003\004\004\270\006\274\006\024\024"
+	.string	""
+	.string	""
+	.string	"\001\002\002"
+	.string	"\003"
+	.string	"\005\003"
+	.string	"\274\006"
+	.string	"\013"
+	.ascii	"G\\%\f\003/\217\350\204\034\252\271[5#'b/\035\354f\300\fd\003"
+	.ascii	"X"
+	.text
+	.section	.gnu.lto_.lto.9d3416ed2c3383db,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bitArrayGet.3.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"]\f"
+	.string	"6YV@ \217\223\0168B"
+	.string	"\030D\2610\2448\020\004\243rY\340\212=\275\021p\271\345\\\315\3721\204\372\342\371F~\221u)\031\037\020\020\210\300\366\324|*\303\240\233\220\003\262\271mD\332\336;\311\224\002F"
+	.string	">"
+	.string	"B"
+	.string	"^\251\013\003\310LQ1\221\231-(\007e\327\314\003\236\035\345"
+	.string	"\317\256m=>D\035\021(9\213\020&\022023\353\032<2\216j\217p\363\340R\302\344d\304\230a\220\231E\223\223\n\356\335VA\333\217\326%\001\336\230\305\326\034[\035K=l\346\330w\254s\330\326\260oX<\326\031U\006\001-\231\024N0\251\302\235\340\320\326mE\355\246\3553\213\020\231e\243U\346\205\024\036\224\235FCl\r\302*\242\007V\230P\334\022A\204\332PCxv\356\236`\341\337\274\335\245\017\315E\361\360\377c\224:\220\360T\037oS\f\t\236\352\334\227\247\271\337^\224bHxj\263\021<\206\326-3\263Oi\213\345x\305\001\241\017\310]=\035\022:\030\326\t}@\254\220\013\004\272<V\310\247\003\262<\330\003\253\003A/\007\r0+t]\230\265\311\322\345\\\203\344\244\326\"\257:\3476\271Pw\257^\240\205\t%s\352\235\303\231\033x)\301$\360\306\323\374=\022"
+	.string	"c\221\"34\030\361g.(e\035\354 \003!\255\221\2568\315\262,1e\007hZ"
+	.ascii	"]\346d*\374\246F\301e\210S\023M\327|\002"
+	.text
+	.section	.gnu.lto_bitArraySet.4.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"E\f"
+	.string	"\006XS?\020Q\234\016Q\323\261[M*Pt\245\235\342\200B\373\247 \222\3660\223V\360+J\001\261\036!\355\311a\232}C\344\207\031"
+	.string	""
+	.string	"@\021d)F\243\275\352\276\036\323\240h$Bv7)S\n@"
+	.string	"<"
+	.string	"@"
+	.ascii	"O\261\275\344\032\017\260K"
+	.string	":\361b\327c\340Juh\357\004\342au\001\361\320\233mcb\301\303E\307b\307\356b\032\342\333s\363\277\342\226h\364yR\017v\327)\032i\270\365\266\027\330v`\377B~\351\2772-\371\307oe\272\3124\005\3231\3230\323\323\224VM\247\246\017\300\3121\340\306n\206OdA \f\022\266\177\331N\357*\266\177Pl\355~\220\321\240:T0=\355\243\b\n\325@H\307\341-&t\252\335\375\b_\202\036C\207\324KU\317\231\230\356\031\361\232z\256D(?K\364\372n\004\224\237\341\035#Z*Q\252\202\016n$\224\237\355}RA\330\237vw\255$\007\036\rF\2413\026\n\027M\273x4\030\214\223m6Y\006\343h.\033,\243u0\013\002g\021 h\230'\3134\354\362\366\323*\311\320\003\bHC\256\364\200\210\213pP:i\245\223\220nCTJ+\217Z\200\006'\222\340\224h\005\026"
+	.ascii	"c\221\"\023\357\304\321\360\350M\034f\242\007\025\026\301\032"
+	.ascii	"c\320\243\325\222+\3723\315\222\245\366\300\314\005\221\013\237"
+	.ascii	"1\314\313T\370M\215\202\313\344\324\350p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_bitArrayClr.5.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\235\f"
+	.string	"\306\230U@\020\2176\035h$\263\022\200\240\302\221\253@.[u\315:Kf\227~\021\241\210Y\301\036G?B\332(\332dN\270\365\301\036"
+	.string	""
+	.string	""
+	.string	"D\200r)A\253X\327\007\022\353`\215\236\232\320&I\246\024B"
+	.string	">"
+	.string	"B"
+	.string	"\365\007\203\330|\322\025\007\310\024u(\221\331%hG\345\327\316\031\223_e\001\223_\267\266\205\006\tF\005\227\002#3\261_\360f\334j\213\260\005*\0211R\f2\263\b*\241\340\336m\021\264]\320:\024\242\326'6\006\261\227Q\354\013b-\304V\017K=\354\204\330\207XI\302\376X<\326"
+	.string	"\256\021\031(2'\214XR\345\231\320\320\326W[\354\034b3\nG\255\314\n)\024T~\007$c\003\006\3141]\376> \006\0272\t\b!Uf:C\375\340\226`\202\307\374\367\207\203\344\256\230|\274?\033<8\352u\337\\\313\b\216\372\334\023\323\345\327)\022\026\237\026\017\216\332N\004o\241\265\224\231\331\007\235\315\307_5\036\0212\232\226\351l>0\220\214\303\3114\030\310&\303\3014Z\b\346Q\240\231\203\006\032\326\3112\r\273\272\264\224\027\365yP\031\271\247\326\t`0\310Eu\351\3265^p!\352\325t\352\033)\234\311;<}c\345\303\022\027"
+	.ascii	"c\221\"\023o\306\321\360\350Y\034\306B\017\236\213`\2157\036"
+	.ascii	"\037\203\034\255\221\\q\037j\214,e\007fZ\250\\\343\214a^\246"
+	.ascii	"\302oj\024\\&\247F\207;\274h'\031"
+	.text
+	.section	.gnu.lto_bitArrayXor.6.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375`\335\001e\020"
+	.string	"&\336jF"
+	.string	"\257(\035\300\\w\262V\24610q\027C\0375\357\035\350q%\006\256t\357\\ \335\003N'XU\036\35157\265\376\272\223\320\356\321\243\252\252^\222\212L\320\016p\235\001\230\341\305\026\372w\0035B\366\2262\245U"
+	.string	"U"
+	.string	"W"
+	.string	"\007<\227\006\317\261]z>`\273t\313\206\321\361\002\255H\231\311\230sv\233\241\245\021\274\243\266.\343j\313\237]YX\300>\223\313\310\275T8"
+	.ascii	"\370^1dG\247&\366\2714zX\371\236vE\021\302\276\225+'2\347\264"
+	.ascii	"\302\276\013\367v\333(\333\rl5\020\340\277\361\360\346\242z["
+	.ascii	"\265\214\352\270\352\215j]\365\003\204^8js\252\324f\314\033Y"
+	.ascii	"\323\341\341\355\227\360i!K\304e\341A\r\216\316\234\240\307\245"
+	.ascii	"\031x.\377\261ef,x\214s\\(P\220E\003r\265/\342#Z\207q\316\005"
+	.ascii	"\314)\003q"
+	.string	"bN\020\201\003/!\n\206m\375\231\025\t\001\234\303b\304\325\335vsRX\\\241\225\2734\022\"hw;T\330\237\241@\342\331\340\227l\227\272\217\265\234h\315\334~\366{\332=Z\230@\371\340\322\332nh\363\372v]l\320DC4\354\350xe\266\3500\177\3502?\3501\377\347\001\246'@y\013\202\362\2664\301\244\212+U)B4\351\243d\224J\215V&\b\335\210w:y\244n\3044:u\244\224\252\373(`\017UJu+\317Ku\037p~e\366\354\016lnN\326%\327\305\032!V\264\262E\035\333Xn\377\202D\212\n\272\3638\347\234\321?k\343V\264\032\001, \260\202\231\312m\241\300-\247\217\266\234\226\372\204\307V2\n\006\213\310\224\225\235X\217\331\362\212\242\\9\263\365\3027\275u\230}p%\313-\357\b\0063f\233\276\205\211=6Y\214\346f\366H\341\006j\334{XA"
+	.ascii	"\n]\366\b\205\242\320k\030Ys\006+G\364\303{Q\356\\\342\t"
+	.text
+	.section	.gnu.lto_bitArrayCopy.7.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375`x\002\245\023"
+	.string	"F&\200G\340\356(\035\312\016V\275\026N2<\204\0248\032?\016\322\203p\251\204;\343\242\006\356\3640\352F\355m6\246\302d\007\2631\257Af)\214\030cc\334\330\224F\022\017;\351\304j_\365\224:\252m\204l\"eJ\001k"
+	.string	"b"
+	.string	"n"
+	.string	"\263\343\204\330\264K\241\304\201\322#H\367\264os\016\263\337\230\350\251]\232\r@\2739\003\026)=:w\226\367X\272\312{\364\314^\321\001s\"\262\355\034\355\356K-|\366\330i\316\374\017\346Bq\303\265<\226d\336}\260\236\257^\334p2W"
+	.ascii	"\270\227\016dw\277\363\214\301\3212?\330\356:o\270\b\267w\333"
+	.ascii	"\tl#\260\363D\256L\267\2764+\323\253L\253\2744GL\247bz#\323\250"
+	.ascii	"Lkd\372\364\245\301Lgd\332\344\245K1\375\305\264w\235?f\272;"
+	.ascii	"\316\257\277\371\363\003\305\3232\332\205\220\204\264Bq\004\006"
+	.ascii	"\333\367A\334g\345<&!\261b\203\037\336\303r\036{\330h\330]\360"
+	.ascii	"\321f\261\301\307\004m\235#\222\314\335C\3579\201\027\243\334"
+	.ascii	"\335\026u\350i\350w\236\312\351\220\243\342%]\370\244&\325P\017"
+	.ascii	"\"\333\f\250\247\f\0259\250\037A5\244\001\017\361T34\300\220"
+	.ascii	"m\346?(\241\177"
+	.string	"\301O\361\036M\372\230\t\237\246\226\364\265\f\267\t\317\323O\025F\255\246SOo\213\341\222I\216w\220\247\332\351}^ \305O-\006-\223\354\034-\265\202\375nw\327J\343\241J\306BY\203.\332d\204\245D&+Q9Y\360B\tc\261\320\344\205rR\022{\231\310R^#\002\034>` {\251\204\241\354\005\346\\\336\255\3228\266\020rQZ\027\301\214\232j;\210\345o\376\316a0\332\262\235K\177c\321R\225\272\264\243\310&\201\245\255\225\212\234\245\036C5$\240G]\351G\221\002UJS9.\342\033\232\322\327jP\272\361\020\217\212\3222 \200\002\021J\263\003#J\031\023\217\\\302}\t\350\211v#\032\273\342Q\033F\366\203_\2645.\036\202\013v\261\023A\210\350\026\204\024\006i\362\333\222}\273\212h\343\326\205\240\216\034\t\326\005F&\311\246\033g\221\006V\366\251E\220-\241D`b"
+	.ascii	"\213\006\340\216\346\300\203yD9.f\370\315\321.\223;\243\245\233"
+	.ascii	"\247cKM\321\027g\273p\031"
+	.text
+	.section	.gnu.lto_bitArrayCopy.part.0.11.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375`?\002\275\022"
+	.string	"\306\"wG\360\320&\035R\270\302\253:\315L\307\232\253c\370\210\270\037\022\004a\234\361\341\203\305|\243\230\275\034S\307kG\323#\307i\243\244AU\030\r\213\303\207\203\013\265\277\313\371I\023\253\344K\213\361\331\324\2324\262\211\224)\005]"
+	.string	"d"
+	.string	"`"
+	.ascii	"\213A\306\231\366q\216\302\365\034\327\036`\327\306\004\320n"
+	.ascii	"\210\340\321$\335\243\303{p\217\335\007p\217\366O\330n\331E\017"
+	.ascii	"A\254\214]v\321G\f\252&\243\035\355\356\367\250\037\356\272\346"
+	.ascii	"\346\362{N\200h6\003s\375\317=\210f3\031\236\002\276\225\032"
+	.ascii	"\354\256;\rw\274\355\005\266\025\330\231\023',\263\274c\006\233"
+	.ascii	"\221c\264\033~\217\347\271\037t\027\254\3738\301\013V\213\003"
+	.ascii	"\271\334\307\fhv\327\305>\213\377\330\236_\356c\020\234\022\273"
+	.ascii	"\353\275\250\277\242\345\367\330\263}\236\235T>\330\327\206\221"
+	.ascii	"\307\235\241\223\356\321\263\346i\255\353\244\266pg4\305U\270"
+	.ascii	"\256\223\262i\327\303\221I\367(\262e>l}\204\001\217\221\330n"
+	.ascii	"\030\234\352\246\217\215HU\275,\307+"
+	.string	"\223\204\270k\352\177~ &F,\007,\223Ro\254\333\267U\033\2434\355\235\322\247S\332\244\351N\323%S\232{\370\307.\275ui\325t\236\366\037\300C8\354^HB\332\0161H\204\220MNZf\021\201\351\230\301h\324\214\266B8b\333&\001*p%a\003[2:\245\204\002\312j\205\322\242\002\341[\001U*0\345[QAQ})+\326Wb\300\340\204\b\253\257\005\004W_\276\347\016n\310x)L\365\3066J?\253\341iIQ\372aCFsR\317\244'\005\241\311j:%\271IAj1\244\220\247\270k\247\005p\310h\374\241\225\212\037\302Wq\217%\275\205\232\227F\34546 \220\002\231\233\353\006\242Ia6\210\347\270\035\341D\201\343Lx5\r&\2201\254\006\370\301A\005\232\215\344\034\f\030|$\3228\201\002)\254\210\3060\233p\t2\\\323(63\016]4\336\001J\204\346"
+	.ascii	"\333\241\323c\272\201%8\210j(wh;\230\343`\003(Y=\306\310^\326"
+	.ascii	"\"Q0\260\377\210t\227!OrLa\257Y[\204\266\202\226\217R\244\365"
+	.ascii	"'\2301"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375 \242\245\002"
+	.string	"\264\003\236"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \003\177\b\272\200\202\002\004\177\t\005\177\n\006\177\013\360\372\2508\007\177\f\003\005"
+	.string	"\002\001\242\013"
+	.string	"\t"
+	.ascii	"\023\023\f\240\243\304\003dx\r\370\006\370\261\323\"\340\006"
+	.ascii	"\035L'"
+	.text
+	.section	.gnu.lto_.refs.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9d3416ed2c3383db,"e",@progbits
+	.string	"(\265/\375`F\006\r%"
+	.string	"jD\304\016G\220\\q\341\260\025`\t7\243JS0"
+	.string	"p\004\275a>\357\370\233.\200i\327x\377-\202\276\367\361]\263\275\032m\264\032J\261\n\313\251\344\2721n\371}\375\206"
+	.string	"Z9W\370\3316\003v\273\343\b\006\235\224\032\221)\276"
+	.string	"\324"
+	.string	"\325"
+	.ascii	"\347Y\360\247\250D\221\3061\273\034Y2\024Oaw\210\205\177 \341"
+	.ascii	"-\024J\007\201\356(\271S\207,?;\317C&g\361\220\224\237\227p\220"
+	.ascii	"\337\226\272k[\330\355\302\316\2505\305\027d\311L\270\t\2731"
+	.ascii	"~r\206\302Q\336\243s\373\355v\203z\320\274\321!$\313\004<\300"
+	.ascii	",c\347\331\311\203\314\264\204\223\3479f\006q\314\274\313\003"
+	.ascii	"\314\223\005\230\305#\021\311\3770n\214??\017\371/\374/\364?"
+	.ascii	"\312\374\331x\354\262\344\372y\330\001D\361\377\371\363\224\377"
+	.ascii	"^\376\267\371\177\374o\365\337\370\237\370?\312\377+\377\231"
+	.ascii	"\376/\375g\360?\352\377\373\037\350\377\324\177WVVV\326\317\025"
+	.ascii	"\376W\375<\260\356\217-[\224l\267\271u?\326\204\352\266\253\352"
+	.ascii	"\266\350\253u-\332\355\262/U\230\242\254\276?V}[\026\326\272"
+	.ascii	"F\373My\234\272\226U\305\264\354K}SV\325\375X\330\016\350\244"
+	.ascii	"C5\246=FU]\303\340\371\322\365UT\335\266\255\272Y\330\242\327"
+	.ascii	"\005\335\276v\265Jo\260\226\\\021F\316J\332\262\333\335\006x"
+	.ascii	"9\247\266uE\365H\333}$7\242y\021P\267\330?\270\210\366\360\365"
+	.ascii	"\256E\367\201v\273y\335(w\261\273\321\356v\255>\267\033\307K"
+	.ascii	"\005\362x\335\275\002\274\366\241\303\026\335\244\360\250\205"
+	.ascii	"U_\247v6\204z\201\355\302E\031\330V\277\365|\321'\275\353n~s"
+	.ascii	"\002\331\031n\310\222\253\260\025v?\305Wn\256=\267\205\001\244"
+	.ascii	"\\DM\221\345)\004C!T\310\222\251H.\262\2313\025\227\371\321\271"
+	.ascii	"LUv\247\314\n\0020+\340\3512$\215b\226\347\340\311c\316\246\224"
+	.ascii	"\363Cw\004\236C\3762d\242\331"
+	.string	"\315n\033c\355\336\032\3739\314\231\350jb\022\204%K\006\363+\223\352\351i\bga-g)\227\245\330\013\367\232v\257Q9\b~]\232t\320\351^/V>\251\272\"Y\262\227\257\371\351\016v\267\020P\021\0371x\220%s\371\325\004)(\031d\311[N\341\216\247\037Y>N\354\177OP\023\224\234\034Y^\305y\332y\3627;]\273[\006\217\333k\356\347\314\303\034\373\201\270\305\013\376\227\335\302\352\346\001\341\234F\262\2449\310\362\177\202N\322\215\302\332\355U}\177\250*\305\f\013s\233\007\201~{\264\0327\333\207\333\022\006\034\215\303\222\315v\001\211\007G\313\340\363\241\333J\320n2\234\315v\223\371\3748 \302\335\222J\020\251(a\303`\001W\013!\340J\265\033\215\211&\342|\204\242\006EF)\\7:rp\344\300\274\321\321lvT4;_4k\341\220h+j'L\034\222\221\013\207\364"
+	.string	"\002\216\251\206\342\374l\206!\201\207\r\031N%\"\025I\267[\022\256\026B\306d#A\302\246$c\252%\221\220)\335N\310\210\204\336\020\253`\020aC\226j\324p\233\263\311"
+	.ascii	"\001\324y\3014a\235\333\314\t\006k\220%\263i\235Yww\310\222\327"
+	.ascii	"0\026 \266L\235,d\311"
+	.string	"W\277rQ\301q%\365\371\002\304\211\f\361xlu\357\b\0034\20589\362\005KU\025[\235j\254`\271\316\320\360\331Hs\266B\003E\314\305\260Q\003\332+\372\352\334\321\t\026\231d\306\031;d\316F\246R\022m\250\201@e\2204\"\"3\"\201\214\244)6p\002\231\2513n\021\260\245\242f\204\024\224$\225L\007`\322c'\345\235\332r\236h\265\357\nQ\376\003\321{\370\323\311(\275\353\310\032$\032O\376\300\262\353\002s\363\005>\322\276&m\037\250\215R\\[B\2623(\375QO\303Xy\2236\017?>/\252\016\023\315\204\225\027\231\307MY\366\206;\356\253\3476z\264\336\035\035\r\270\3537\246k\236\357\362\314X\022<\035!vUk\376h\3367\324E3\257\254\227h{\200\240\020\307\023\262\352K\001\342x:\201\250%\364\033!\316\r\253\371\034)\353\241p\215Vd^\224\020Y<w"
+	.ascii	"\366\320L\027\034!S\306:N\r\225?\3717\325\026N\227\203\233\340"
+	.ascii	"\021\031t\360\003\031\315\256\007\217(8~z\205\206\202i6\324/"
+	.ascii	"a\263\321\320*"
+	.text
+	.section	.gnu.lto_.symtab.9d3416ed2c3383db,"e",@progbits
+	.string	"bitArrayGet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"bitArrayCopy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9d3416ed2c3383db,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
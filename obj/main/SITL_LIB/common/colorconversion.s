@@ -0,0 +1,233 @@
+	.file	"colorconversion.c"
+	.section	.gnu.lto_.profile.ae19d78a6bf9b7be,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ae19d78a6bf9b7be,"e",@progbits
+	.string	"(\265/\375 {%\001"
+	.string	"\320o"
+	.string	"\002"
+	.string	"\322\206\312\366\f0\002"
+	.string	"\002\001\002\002\001\002\003\001\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"\237Cz'\322\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.ae19d78a6bf9b7be,"e",@progbits
+	.string	"(\265/\375 *\r\001"
+	.string	"\270\036"
+	.string	"\001"
+	.string	"\001\003\002\004\002\002"
+	.string	"\002\001\002\005\003\001\001\020\004\006\003"
+	.string	"\003"
+	.ascii	"*\002\244\204\277\001,"
+	.text
+	.section	.gnu.lto_.inline.ae19d78a6bf9b7be,"e",@progbits
+	.string	"(\265/\375`\302\001m\t"
+	.string	"\"\317-+\200)I\007\246\205\211M\306h\203\017\240\004\351\254*\202\216\225\004\227dX\206\034\001++\217\201\235\206\324\205O\017\357F,!{\247\377\253\225\223\33220e\214\235\214i\2551mZ\323\234\315\335-\3471\r\221i\017\265\324"
+	.string	"%\024\021\007<U\037i\202q\361\260\316\326\023\202\023-\024p.=\035u\262\236\020\336\032\353\2204\321V\031Y\307\354\331\361"
+	.ascii	"\333\366\306\321IQ\024e\254Wh\013\275\300\247\025{I7\360\032"
+	.ascii	"*\241\304\335\3009\326\211\005w\372\034K\301\347\213\270\203"
+	.ascii	"\270\205\t_t\317:\005\t\022\027\220\245\357Y\013\237\001>\004"
+	.ascii	"l\210H*\266\370\033'\001: \320\002\241\354\034r\200\237\231["
+	.ascii	"\241P\350o\360\035\b\021\322\236\260\r\227u\020\201\205n\315"
+	.ascii	"\305\265@1\24306\254\223\334\330.d]\310A\bb\234L\210\201\020"
+	.ascii	"\2300\222\001\361\204\200\240\340\250d\023\304\232;*G;\033#\212"
+	.ascii	"H\006\266\b\363\204\203\316\244\321$^\313\270\334\033\005\365"
+	.ascii	"k\357\016\303\2703{J\001\001\356\"\017w\214\345\0043\250\265"
+	.ascii	"\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ae19d78a6bf9b7be,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.ae19d78a6bf9b7be,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ae19d78a6bf9b7be,"e",@progbits
+	.string	"(\265/\375 8\205\001"
+	.string	"T\002,"
+	.string	"\001"
+	.string	"\001T"
+	.string	""
+	.string	""
+	.string	"\001\002\t"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\020\b\020\002\004"
+	.string	"\020\020"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\2730[n\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.ae19d78a6bf9b7be,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_hsvToRgb24.3.ae19d78a6bf9b7be,"e",@progbits
+	.string	"(\265/\375`\017\r\2254"
+	.string	"*]\334\023>P\344J\007F\343}1\201\2112\314r\337\032\320\316}\257\247\244\255N\255\033\020\016\177\f\372(\330\t5\002\006\241\307\342\327(\330B\271V\t0~\256ukV\243\b\030\223{\313MRJ)!\001\016\0013\001\002\2543\224u\016\220:?\245\316N\250s\223uf\262\316"
+	.ascii	"\252\363RuV\252\316I\326\031\311:\037Yg#\353\\d\235\211Pg\233"
+	.ascii	":\247\2513\232:\327\324\371L\235\215\250\363Wg\257\316\375\341"
+	.ascii	"\013\331$xo\216\246\241\033\347D\363\244\001\273\003\273\301"
+	.ascii	"\364\351Ff\030\334\\\372K\207\341\"0-\246\316{\215\220\351+K"
+	.ascii	"\273\264\027\030\035\310b\312\336\253W\246/,\355s\312\270\354"
+	.ascii	"-0\032\260\205\361\362\231e\021\344s\3572\253O\356J\373T\362"
+	.ascii	"f\252\356\375\347\242\227\356\335+4s\357R\213\271\322>\231\231"
+	.ascii	"\033Kg\201\301rPK\276;\r`\222^\004\335\273<\362\262\235j\237"
+	.ascii	"i3\325>_I\313u\021\221M\321z\032\337\345\270\301\362\232J\273"
+	.ascii	"\271.bB4\304\346H\277\006\352\002JE\315\214~\211}\316< \255\247"
+	.ascii	"\003/\211$\262\233Q\355\335^\030\246\322\323\021\0045\242fzw"
+	.ascii	"A\372\221\354d\030\247\356\275\035\246\335\206]\235;jv\357eW"
+	.ascii	"\332\3355\03353\277a\3463f\243:\001J\305~f\016=\230\226\304\334"
+	.ascii	"\241\327\254\035\361\335{\275\322\264\032\017\314*\344\274\225"
+	.ascii	"r\265\317\263\307\240R\321\357\275s\377H\030\360\220\313\035"
+	.ascii	"\031N\210\231\331\372L\333\223\035\264\277b\363\337\315nQ/|/"
+	.ascii	"\"\373\352\274\311\376\377\235d\272u\231&}\372\217%\031\364G"
+	.ascii	"\347Mf\016\321cF\244\367\312\360\342\026\023\203\017\211\364"
+	.ascii	"\336\333M\372\344vQ\373\354\327Jr\345\217\316\233\314\313\271"
+	.ascii	"6\336{\257?\022\3466\336{/\377\036s\0076ch\300f\264\006\323|"
+	.ascii	"\241\377\272-T\347\n\325\231\202u\236`\235\317\254\263Y\352,"
+	.ascii	"!u.C\235#Xg2\353<V\235\305\252sXu\006\253\316_\326\331\313:w"
+	.ascii	"Yg\b\2503\227u~`\235\035T\347\006\325\371h\235\267\254\263\226"
+	.ascii	"uf\220:g\245\316\013Pg,\353\254\300:_Ug\253\352\234\240:WYg\004"
+	.ascii	"\326\371\200u\246B\235\247\254\263\001\353\\\240:KUg\002\325"
+	.ascii	"9\252:\017\260\316\0017\322\234\334\306Z\222+\007\005\t8\rO:"
+	.ascii	"2\352\007<\201(\001?\340\241\310\024j\250\027\360(!\322/\300"
+	.ascii	"3=\324\033\027\221Q\236>\200\323\223=\375i\210\354kz\247\226"
+	.ascii	"\323h\337\364\225\020\211\246\016\3003\001x\364\360K\222i\247"
+	.ascii	"U\024V%\257Ksr\272\265$\237[\263g\251\311<\344\210JE\245O\372"
+	.ascii	"\245o$\021\245o\244O\372JH\326,\352\321#\375\211\210\3643\372"
+	.ascii	"\242?B{\2437.bx\242/\372F\366\021=Z\3470\311$\224\3464h-I\320"
+	.ascii	"\032\303\3564q\346\374\020\363r\256\253\302\334\355\235\217d"
+	.ascii	"\221\033\320YD\221\333\217\021\310\036n>\317\256\274u6\364p#"
+	.ascii	"\372\241;\334xZ\311\314\335\323w\215\324\341>\344\304\364\336"
+	.ascii	"\271&\302}U\331\310\365\303\303\347\336\213\325t\2309\261\233"
+	.ascii	"\b3sb\312wu\334\345\305\352\323~\235r\361\234\311d}U\321\336"
+	.ascii	"\376\271F\020\351W\367\030\276\027\223\314\024\375\364\215\206"
+	.ascii	"Hf\375\363\321od\224\272\372\217\230d\032YM=\277/\274\361O\303"
+	.ascii	"f\222i\314\320\205p\b\0177\264\2336l\n\003)\330\342\336-\216"
+	.ascii	"\r\204\321M\205\210okn\333:\3616\"\016\316m\305\211\2676\270"
+	.ascii	"\267\022o&L\274\265\035O\214`3ql\203\213;nU\361\033\n7\270c\212"
+	.ascii	"\2677\270c\321\362\366\357\261s\221K\357\245k% \022\2620\016"
+	.ascii	"\335\327q\317\351\376f\263y\250\250\302R\313\037\205\027\373"
+	.ascii	"\n\023\236\302\331O0{\262?\223\360fe\022\"|Y\204\257\204cO6\366"
+	.ascii	"/\362\006\223L\261,X\374\304^-O\320\255T\241\222\367E\251\370"
+	.ascii	"\247\221\002\265\020M\221\022\345\020\254\357\211\0235 \205a"
+	.ascii	"M\230,\001\373\257\017\003\363\372\257G\325t\275\327WC\b\377"
+	.ascii	"\340\273\270\036\002\327\237\210\016\376\201\203\177\001d\260"
+	.ascii	"O#\005J\261\315\247$\211\032^\240\006{G\364\216o\365\r\266\376"
+	.ascii	"\370Pd\264~\353"
+	.string	"QB\006\257\340\265\262\236\301\202w\031\235\205\365\013\260\276\022^\275\202\253\177\201\267'\311\2642R\204\210\325\253\341\035&6R\340\2174\201\220 yU/\365\t\020|\325\243j\016<\202\257\206To\340\017L=\325\324\237\210\005\336@\201\177\201\367%\311\304\373\341\243)\305c\307]+\025\351\244\376\034\f\224\247U\024B\243\\G\232\223\347XKr\034\203\203\036\200\370\250AT\345\034S#\243\240\240\240\240 \3110\006\020\003\221\231\215\033\021\260,\207\240aLPS(\f\007\351\310)\370\263\335\335\033\003\233SC\022\3700HU\177\246\b\331\002\0013\342\265\366\213q\257\033P\263D\232\200\344\215\331\277v\271\214\217^\361\324Yn\211\343\325/\262%\337C\360\2078\037\301\237\352\335\342H\361\0255:\352\202}\237\244\207\342\224\222{\373\247<\307\367\206\376\t\317\344\354\273#Y\003 \376J\002\262\254\270\353C)"
+	.string	"\300'\022\242\306\351\362\006\3248\274\361\340yAx\332\352S1d\001\375\277+\345L\340\025\021\031\274\323C\212\277\0270\356\234\246S\002p\307\230@\016\025\265\004r\200\317 ;\247C-\275\321\216;\257\037\301\223\342K\344}h\226\225K\226W\003\215\327\266\245P\300\035c\0029\340d\3405<\207\036k}Q'\244\337\350,\222\r{\340E<\266\306\230\215\022\r:f\305ja\326a~\024\326\237\357\252\025\262\256E\035\202\356?\267\031\310\033\242\345;\273XtG\252wiE\267\351o\224\210"
+	.ascii	"N&\024\216\265\316x/\204\030\020\2135w2\033\235\334\353\027\335"
+	.ascii	"fl\020$\302G\364K\254\326\224\376Z\217\310\365#`\0033\267\020"
+	.ascii	"?\244\232aUO\252\341Y\220\277\344\325)\034\311\334\314\374\033"
+	.ascii	"w\225\233Y2!?4\026\374\020\345\247\002\001\210\001@8\360\352"
+	.ascii	"\027\001\360\240\032\230\312\215\220\007\357\343\025O\331\336"
+	.ascii	"\t\255\346l\356\371\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ae19d78a6bf9b7be,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\004\f\200\204\001"
+	.string	""
+	.string	"\003"
+	.text
+	.section	.gnu.lto_.refs.ae19d78a6bf9b7be,"e",@progbits
+	.string	"(\265/\375 hE\002"
+	.ascii	"\002E\016\031\300g:\031\321\023\307\374\377\377\347\277\025\354"
+	.ascii	"\273D\325Pw>{\204v\222\001UdR\220\207\243\301X(\256\304\035\316"
+	.ascii	"p\205#\334\340\004\0278\300=\327\034s\313)\347T\210\006\004\001"
+	.ascii	"@\300\001\006\004\234\200r\006"
+	.text
+	.section	.gnu.lto_.decls.ae19d78a6bf9b7be,"e",@progbits
+	.string	"(\265/\375`\377\006}*"
+	.string	"ZO\f\021Gp\236\316p\267\021\207\037\250}P#4\036\345A\177\370ao\037\025\227\243\355#\212X$F\302\230\b\221)&\360J\235\212;\223\002G\311:UiLt\363\030\371\317\211\004\327\202\260i\f?\030\335\236\355\376\335\266L\001\334"
+	.string	"\006\001\373"
+	.ascii	"Vx\215\325\370\3454\236r\246\302U~\272\335"
+	.string	"ow\363x<\"4\216K\214NE\237AM\300C)jAe3\216\302\357\021\237\235\241\260\330u\202n\273\247\2179fON\364\023\324\363Q\272k6\371(\275\004\365d\241\224\233\260\023~\215x\354KM\337\255N:\254\333\375\361\251CR\027\347D\337S\317ON \330MG\325\263Q\312M6J\177\252@<\224\022\361P\372\363\222\237\225p\230\321\216e\321vY\267\033\364\343\306\030~\235\350]\036JU\026J\377\203\371\037\346\377\333\377\261\377p\377\335\322\324\376\257\035\375\337\320\214\363\277\300\317r\377\341\374g\376?\363\377\312\377\006\377\317\376\037\370_\346?\231\377\313\377X\376\263\375\017\373\357\363\237\313\377\263\331l6\377\177\375<\340O%\004ee\320\212\354\233\243\355\245\221\275\311F\341\256\234\354%\222\250\276k\223f\321\335<\247&\213.\326\360\231\242\23611\332\226^\252\033\326\323\325\345\243=Q7"
+	.ascii	"\332\r\263\027d\226\001V\bYb<Q8\036\303//\337\305\2102\253\304"
+	.ascii	"u\367\222\267p[0K\262\273\213x<\236\"\302\267\031)\372\246/Q"
+	.ascii	"\222J\263\244\033\213\3410\374\362\033\2039\273g\2617\366r\226"
+	.ascii	"\354vy<\"\036O\027\022\241\232\212\236\213\352\271K=\017\325"
+	.ascii	"\363\n\365\214B=\267\375\254\205\2310Y\207naw\027\370\005\231"
+	.ascii	"Av\242\f\245w\346\"\224\022\215n\377\354\320\330\266\344\234"
+	.ascii	"\350YK\335\261P\226#U\270v\026v\242?ca\266\236\035=\334~\234"
+	.ascii	"\350\025\227H\347K\215\255!'z\023\352\231\t\032\223\t\330u\337"
+	.ascii	"\200\223d\261\245&Nc\227\311Xi\244\220\344M\\\204\277wN\3432"
+	.ascii	"\226r\340Dw{\003\301\352\205l\215\331\355\006\030l\304\3712\267"
+	.ascii	"\306'\005Z\233\225+\356\017\022L\033%'\372\262\034O\371\337\273"
+	.ascii	"&\025\031Z\330\324\237\177\332Abw\267\320q\233\250\325s\326a"
+	.ascii	"F\372}x\307\n\376\243\275\243\353>\202\321\251D\252\004k\234"
+	.ascii	"\350\377\004\375#\335kP\273Md_\344\312\216\271\025\203\334\366"
+	.ascii	"*\320\357W\263.\262"
+	.string	"\210\266\353\331ns\013\221E\021\254\333\022Y\267]\201Z\330\256\335n\021\210-\013\256\314\276\310\"\373\266\305\240\026\366\332o\320K\025\266E\266\255-\002\261o\260\310\n\221\305 \031`:\352R(A\002\341\"+l\256\3411H\004R\262n\333\313n.\333j\242\202\356cK\\\006e0\232\226\222KKJ\260ew\250\225\243m\241\222\005k\273\301\264\254z\310\264\272\312\346\301\312\365\353\330,\266\272\r\f\273Wnew\257\335\275C<\272\3354\200\330\344p\330m$\032\366qM\333\352>\003\300\250\245\b\020\222~\2733`Z\222\252\322\340\3330u\365\243\302\242\252R\317\344\364\300\351\311\304\316\237\240 @AH\377\004\325\353A9\365\324;\365v\300\254\250\020!\244\230\226\244\252~??\256b)\226\252\372\355Jx\370\355\200\267J2p_\b\252\237\022\320\347\373)\005 \301YQ?\337\007_\005\022YV"
+	.string	"\200QN=\325\212\201QO@\254\253\021;\357\365*$\340\200\341\202:\225\204\345\273\312\372Q\221\300\362M\375|\037| @\370\246\224\260\256<\200P\232\372e)%-\310\342\363\034\256\343\027\211\233<B\267_\036\2709\033e'\372S\205zFJ\177\030I\016\232\0355&\212 p\336\260\222\321\240mD\231Q\342\232Ht\360sK=\247a5\347\270\3071S\355&\256nwm(\353j\301l\243\021\211\305\2160\352\350\316L7=\335a\335}@"
+	.string	"\031!8p\270i\003@\r\021#^l\370L\027q\233D\216\213\315\213|\340\344\306\314\234\350\331\360\334\177\236u\250q8\206\b4\310\004\"\022\214\314\214\264\311\001\200\002\021*\243z\021p5\242FN\222$m\006\322!\002\007z\0177\032\326\354\307\264\220\0237\347\224\203\321\212\361\t\033\326J\026\314mqM\201\205\007\225\336\231\022N+dJ\367\3647$\244Jb\337\357\307R0\356\360t)\241\200\007\256\263p\033l\003\213Vth\354\242\325\n\033\\\344\316\016\221\344\031\201\b1\232\264KE/n\020\242\220@\252z)\3457LI"
+	.string	"T\0228\241\3214q\277\nP\366\243\337\246`<\330\324# \373z\311\247i\021\370\320\236\330?a~#\262\333c\303H\242\307\275X~\020\177\220\215e\212e+WW:\304WKG\024\312F\224\016.\315\202\265W\344\200\254#SC\3625\003D\322\351\326M\227\216\177\312o\177\320}\313\334\035\241\346 \236\217\245\234\262\264\024>/XT]\245N\272k?\030\330\201\2378\302^\362"
+	.ascii	"\001\331=\246\n"
+	.text
+	.section	.gnu.lto_.symtab.ae19d78a6bf9b7be,"e",@progbits
+	.string	"hsvToRgb24"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ae19d78a6bf9b7be,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,204 @@
+	.file	"encoding.c"
+	.section	.gnu.lto_.profile.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\350\335\352\372\n"
+	.string	"\001\277\261\216\273\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\003\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002"
+	.string	"/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375 nM\002"
+	.string	"$\003b"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	"\001"
+	.string	"\001\002\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\300\002e\001"
+	.string	""
+	.string	""
+	.string	"\003\003d"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"Y\t"
+	.ascii	"P\355\024\216\231=6\327\365\211\036O\2736\200\005"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\001\003\177\001\003\177\002\001"
+	.string	"\002"
+	.string	")\241l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.3f287d7ad4df09a1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_castFloatBytesToInt.3.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\007"
+	.string	"\222N45`m\322\001@\203"
+	.string	"\005\025d\235y\350\264ilev\tL)+\211\2336K\376\363S\376~\f\252\245A\0200C\217o+\310Y\361\034\001\337\242%D\356\224\002\017\356\245\201\3108\016\361\31260\213\030\026/\230q\0320xi\022PS\320\030\261\321\340D\214\032\264\272\233z\2062\2152:}\262\242\356(\022.\377\02721\"\217\223\317[i;\317\313\215\326\3243\324\346k\232d?\312\322\0300\375\030+*?U%\035m;\255\325\366=\223:\322\200\337D\204\344\177\246\230\213\253\266\365\207A:\335\250\216\203S(]\204\244\374\03540\201\305\025e\001\213\253\024y\363\333j\227\214`a\002q\036?"
+	.string	"\206\377} .\303M\267=h\233i;\n\b"
+	.string	"2\241k\037\030"
+	.ascii	"\023\236k\370\r\013W\207p\001Pi:\355$\003"
+	.text
+	.section	.gnu.lto_zigzagEncode.4.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\275\b"
+	.string	"\266\320<8@\305(\035\235j~\240s^fZ\310\2359\354`\035\321\337%l3\301=Q\333\253{\317(\037K\345\340g\242(\212\341\fqVI<S#\027\243\031\355\337[\312\224\002,"
+	.string	","
+	.string	"+"
+	.string	"\r*'\221"
+	.string	"\273\033\314\274\300\362\347N`\371\323\216\213\236\"\377\254'\214\244\240R\243\347\305aw\235\250T\306\255\267\255`\233\301v+NM\3772pb\320\332\305\210\275\026\345\225|\330\016\331\030\333\231_]X`w\203E\262\273\013\326\004\374\331\366A\036\022\262\310m\036\251w\235`\244\2149\325\271N\032\b\267\211\305i\352[1\3014wzU"
+	.string	"\246W)c\3666J\345\260\357VU~_\375N\323\252\031\235\212\b\216\305s\266\201\320<\0171\323:P\213\237O\314\240\346\341|`\006\232\200\233\003G\211\016\bR\304\b\202\230m\357VUO3$-Y\365i\f"
+	.ascii	"2\241\307\037\230\313\004#*4\232\361\307\f\3135\034c\002\227"
+	.ascii	"j<:\204\003~\246\351\264\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375 65\001"
+	.string	"\3602"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\003"
+	.string	"\002"
+	.ascii	"\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3f287d7ad4df09a1,"e",@progbits
+	.string	"(\265/\375`\311\002\205\027"
+	.string	"f\356\242G\300\030q\341pY\334\356u+^\0344\207\207\257_Tm\340I\331\250\251y\355,\003\350\341\346b\320\027\360{;\231\263\2323\036a\340\323\032\202\210\b\350\004\267'\250DTGv\006\035\b\317\215\025d\024h\"}\"S\202"
+	.string	"\211"
+	.string	"\215"
+	.ascii	"w\201*q\265\332\337\202@\355\266q\211\316\357\351\250(9K\225"
+	.ascii	"\006\332Z2D\305}'\035\267\344A\217\373\321\315\f\325q\350<\377"
+	.ascii	"\367J\210;WX\361\276\365\261A+d\243\005\342Mw\310/\264\364\352"
+	.ascii	"\377\323\3760\031\177\274O\265\003\300o\005\200^\205\336\037"
+	.ascii	">E\371#\330\013K\374\177im\004\332\346 \303"
+	.string	"\366\202\"\353c\273\3106\221\355!\333\033l\177\266\235\330&\255\353\272\332\326`\333\206\355\345\002\227\220\232\247\245\350\210\372\223\233Y\322H\023u\365cy\364\252R%U<\275\235\2512\275\235\245z;Q\245\212\216?z\256\231\222cI\273\371\240J\225<\257\336\306T\251\342\030\022\3125a\261cI{O\315F\232\250]\231\242?\372W\247sS\301oC\315#\322g\225\314v=\263#$\272\351\377\002\265\031\r\364\264]\t\204\376@3\020\257A\030\323\335\177v7\326\260\235G\3477\360\364\257\375\343~\367\177\374_2m\351\003\336\234\320\346\226\310\250\037\235\3751\\\234\240\254;FZ\336\302\266\202\371\221\321SzC\274D\266\203\bk\304\364\007\375?\260:=t]\274o\211\254n\205V[$=\275H\271\002C\347}\206\205\336\025xZ\327u\335\025\350,/\253#\t\017#\336\347\016\241g\203'\315\377*"
+	.string	"\2447g&\320^/\200\335\225\035`I\253\340\267M2U\371ypX\302\034E\344\013O\365\230W@\315\323\31035\242TMTnw\2428i\246\312\364\001\257\017\242+f\301\246\346\204\r\354\204\311\b,\212x\341\260d\242\210\303\202!\021\312b\031D\0169/\231\211\t\262\0321\304\005YN\215K\200]0\234W\354e\023\032\202\f\003\231\231\022%\317\3204\240i"
+	.ascii	"z\206\246\325\242\221i\205\226i\221d\036\034<\220\305`%\267Z"
+	.ascii	"\024T\0356`\b]161\330\007\321\025{\261b\342\315\215\350b\305"
+	.ascii	"`57,\027N\016+\346\200\221 \331\242\3607\3074\001\225\235-;B"
+	.ascii	"\037-ZR$\361\026\301\254\b\272\301\305\373\234e\203\200S\200"
+	.ascii	"f\354x\237\327\026z\205\254\032' @\002C\212!y\377\354\325\342"
+	.ascii	"\371\230\005\255R\301\264-\371J\374\006X\270\240\222\205E\001"
+	.ascii	"\361\272\017\253\310\035a\316R\026\204|\003`,G@#\307\346n\340"
+	.ascii	"6\002+\0024\305@|\251lf\201\r\3104\263D\313M\326)\2470\t7\007"
+	.ascii	"{|\357\225\345\273\215\245\005\266\320A\026ww\275\230*\003"
+	.text
+	.section	.gnu.lto_.symtab.3f287d7ad4df09a1,"e",@progbits
+	.string	"castFloatBytesToInt"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313"
+	.string	""
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3f287d7ad4df09a1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
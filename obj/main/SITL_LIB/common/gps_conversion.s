@@ -0,0 +1,229 @@
+	.file	"gps_conversion.c"
+	.section	.gnu.lto_.profile.47c5b5462494c4fa,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.47c5b5462494c4fa,"e",@progbits
+	.string	"(\265/\375 %\255"
+	.string	""
+	.string	"h\031"
+	.string	"\001"
+	.string	"\311\301\254\210\013\b\002"
+	.string	""
+	.string	"\002"
+	.ascii	"9\211`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.47c5b5462494c4fa,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.47c5b5462494c4fa,"e",@progbits
+	.string	"(\265/\375 C\365\001"
+	.string	"T\0037"
+	.string	"\001"
+	.string	""
+	.string	"2\264\341\347\261\002j\001"
+	.string	"\001"
+	.string	"\001\002\003\\\342\350\236\235\002j"
+	.string	""
+	.string	"\006\204\200\200\200\002d\002"
+	.string	"\002"
+	.string	"\002\232\212\217\211\002f"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"x\206\265\001,"
+	.text
+	.section	.gnu.lto_.jmpfuncs.47c5b5462494c4fa,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.47c5b5462494c4fa,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\265\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.47c5b5462494c4fa,"e",@progbits
+	.string	"(\265/\375 \032\265"
+	.string	""
+	.string	"\200\016"
+	.string	"\001"
+	.string	"\001\300\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.47c5b5462494c4fa,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_GPS_coord_to_degrees.3.47c5b5462494c4fa,"e",@progbits
+	.string	"(\265/\375`n\t\3055"
+	.string	"\252_\340\024Gp\334Q:!\304\241\251\275}\340\323\267\f\005vV\034\004)[\007 ^\237!\0253\223.O|\324\037~M\240\203?\370Q\312Qo\330b\263\034\222D"
+	.ascii	"\3642Ek\023\003\n\352\267\377\355\212\376O\b!$m)\003J\001#\001"
+	.ascii	"4\001C1\220t\313\262\275x\302\252\301a\307\032\235\024k.\206"
+	.ascii	"\336\266\314 [L\260jv\264\220\270\322hV\215\205\005\332\036y"
+	.ascii	"\232\302\366\201\355\324w\231\t\202U\233\271@\333.\247(mt\332"
+	.ascii	"\326\311\240S\326\300\336\313\334U\332\212U;_\364\257m\277\304"
+	.ascii	"li[g\0223\261\235\262\223m)=\305\212\257P\347\221\255\007jYh"
+	.ascii	"y\332\326I\034\352\241\332)\332A\265\323\033A{\310|u{\254\343"
+	.ascii	"^\243\316\3464\275\352 \240\2410\b\374\371z\274\037\237\235."
+	.ascii	"\307\256j\212\376^q\307\350  \221\033u\206p\2115\020\352\303"
+	.ascii	"\246\211\227\003\037ll\222\334!X\013\227tp\t:\244\344\002\231"
+	.ascii	"\236u\206p\201\365\017]\300\034\263\243\321h\205\241\3033D\340"
+	.ascii	"4\231\026\222\353;\002\344\366\2044\217\331?\314 \327GH\357\320"
+	.ascii	"\225F\216\260F\243\365\003\235\240\207\016\227\254\253[\237\212"
+	.ascii	"pyu\316G\263h\264|\240CDdZ]w%\032\302\345\325*z\26340\274-%\352"
+	.ascii	"D\005\n\222\345\026\326M\307x4\212:\265m\313\333\232\201\242"
+	.ascii	"dZb\367\375\326\027.\315\306\026\217\276\353S\333\266|mlq5\013"
+	.ascii	"5s\217af\034\314k\236\313\\#\251\3515<\237\317-\215\244\242O"
+	.ascii	"\337J\346\217>\275\377\3258Yq2\356\223\271\271\\M\231b\227p\277"
+	.ascii	"\270\320\232\245\227\214\373l\264m\3336]j\242?\275\t-\355\242"
+	.ascii	"\261\261)C\337d\242\367\223gdf\\=\334\353\240J|\277\337:\211"
+	.ascii	"\306\233\262\f\353>\237\346\215\231\332\337dv\306\270\024\232"
+	.ascii	"\370`\343\1771?a`/_\260\340T\201\275L\241i\002_\226\020\001\002"
+	.ascii	"{\371\201\003\246\245vv\023\371\262R\2335'5`\320X\232\027(@:"
+	.ascii	"J\200\340\200Q\021\321zyhw\331\300\356r\201\335e\002\273\313"
+	.ascii	"\003v\227\005\354.\007X/\003X/\013\365Zs\220\3562\020{y\330n"
+	.ascii	"\315\302fk\016\256\227\201\353\345\237z\331\227^\356\245\227"
+	.ascii	"y\352\345\037\366\262Ozy\327j\315\272\334\345\234z\231e/\257"
+	.ascii	"\351eu\275\234\256\227Q\365"
+	.string	"\362\323\313\367^\356\fKl\204om\233\343\271\2475\223r\021k\263n,\335j\335k\335l\335n\255273[q\237uZgi-\335\326o\274s{\021^\032\370\036rF\246\273\364\357@\337\177\275\373\376\266\262\336\233I\327\333\322K\327,T\006g:\214\2564%Y\202\"\3139@\341\227\216z\340Q\226\345\262\230\355\371\365\024\\\247\324S*\357}\206\347\254\215O\f\007\257\302yY\252\354\226\375\326!\304p\360\232\316\350.x\243/\215.\374\305<\351\305\375L8\243>\r\327HH\377y\005\n\377\3510\355s\n\273\373@\331\031\275\35190i\2747\277\264\202Ox\372\345\371\363&\\+\220\342\243;z\320\227\214\352\212\036\334\275\311:\260\260\034\206\257H\252\250\r\327G_\006\301\302r\026\276S\342\246\022_\364%7\217Qs\277qge\212.|\356+\332S\351\344\266m\033C\367&\367[w"
+	.ascii	"c\262Ngtm\270N\220\340\3541\\8\373\333\226\025\007\242\031N]"
+	.ascii	"\177\341)\232\222\251~}GQ\177\343,\275\226\272\350\026\236\373"
+	.ascii	"\002&\367\246\323\323/"
+	.string	"oJ2\256s\347\314\027\373&\273P\217~i\210\234\271\231q\365\364\212\246D\027~\271\264\226\336\363\276d\356\036\260\203\n\024\365MnZC\237\276z]\342\211\036Id\025T\022*E1\204\324\211\242\261\004o\352h,&{TT\305\344TQ\n\305JU\254Rq4z8\001uD\032\253\242\240\222%~-\212RG\016U\306)\243\224n\352hLV\205(VA\035\215RI$2\312\307QJG\244\221*Y\\qDF\215\240J1E<\"Q\240@F\021\217F(\024\304\250$\025Q\311\210\221)\212Ib\025\022\231$\356\230\231\235m\377\213\357\327X\031 \t_\206\235\373JU\372\362\367XmAC\006_\263\270\371\332L7\030:\200K0\360\241\243mj\201\033x\2008\312(\004.\340\005\276\242)\231\254f\300\t4\370\200\003\2600\303\331,F\rp\001\272\007x\272\006E\003\326\366\225*t"
+	.ascii	"o%\031\326}r\320\205.\242k\016\320\233\334\263!\214\360A,\356"
+	.ascii	"\327p\235\264`C\026\267\037\013\017\234'&\347\267t\004_\246Z"
+	.ascii	"\236M\234\343\006g\370&\337%caA\b\357=c8\200L_\260\2032\026\026"
+	.ascii	"tpF\201\b~\300\205\232\364\b\357e=\225L\341\233\007:\204\007"
+	.ascii	"\007:Jf\370\007_\333\224L\254\341\321;Yq\b\356\340=\246\013\214"
+	.ascii	"\262,\250\203F\236\340\233\334\001\200\277\250a0#\rT\204jFD\222"
+	.ascii	"\202$\031\016\220\002\231\251*z\020`GS\223\326\300\233\360\016"
+	.ascii	"2gTS\273\225(B\b\275T\371&\261\215\321\250Lb\345t?\301=\202\013"
+	.ascii	"\3248\"*\r\302\020&\226\235\205\254q~\270\032\255\251Q\233\306"
+	.ascii	"k\335!\004\271\001\006\252\220\221\275hSR\201_\335+\235wp\210"
+	.ascii	"(\314Y\344,\367V5\233\304\303;\fz\335\007\312\375vP\251\320q"
+	.ascii	"\232\363\200\320=r\222\202-\226\257d\231\006?\023\301\005\274"
+	.ascii	"p$j@sQ/\202\224$\016\305\213\211\366\255\224dYwQ\354-\025?\345"
+	.ascii	"\034\227O\225(\202\2351#\256<Z\237C\350b\346\031\377\r\312\336"
+	.ascii	"c\025\236rA\312\335\320\355\fq\267QP\235c\213\324\001\206\223"
+	.ascii	"\303\313\241\275\203\301\365?\332\020\326\013S\365;\"-;\034P"
+	.ascii	"\224`\203o*\334^3\205\030\353=\241\340\007\t\253G\027\321\370"
+	.ascii	"\265\206\235REcoe\262\001\225\227\202m\030\001\263XD\0200\207"
+	.ascii	"\213\365\262@%:\343,\340\360a\001\323?\254!\031\310\200\225\345"
+	.ascii	"\233PR\337j\037\314\224X-\363&\237\r\346Q\253\224\0301\r\200"
+	.ascii	"\267ax\016\3447~\242\320\300\205\341\300\263\033\231\354\221"
+	.ascii	"\f6=A\262\274\031\374\034\373\030Emq\247W\026t\251\2571\312z"
+	.ascii	"\272R\336\r\030\371\223\304\272\227\005\334m\271\336f\335\241"
+	.ascii	"\224\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.47c5b5462494c4fa,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\001\314\231\263:\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.47c5b5462494c4fa,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.47c5b5462494c4fa,"e",@progbits
+	.string	"(\265/\375`#\003\025\032"
+	.string	"\2065\270J\260Vq:\224\202\260\374\305\353.\342\306\227\231Fw[\272\303\312c\3470\336y]\r\313\0329\260\3105\364h$\237B7|\211\3643"
+	.string	"K\330rk\271\322\005\274\3571\270<\213X\032*\016\356\247\237\302\357\200P(\b\021\231\002\226"
+	.string	"\237"
+	.string	"\242"
+	.string	"^\244\234V]B]PK\324]\233\270$\357:*5E\225d\352\2441\342\356\\!\346\003\177N\3623\021.\302L)\233\2046\257\373\256TDX\330\310qU8Ph~\264\370@>\302H\316\227\215\034H\350)2I\027\351n\276Ahw\311W\225\246\273T1+`V"
+	.ascii	"\016Y\332\321$\004\377\211\277\274\023\212< \374\177\377o\370"
+	.ascii	"\317\340?\207\377\031\376\377\374O\360\037\311\377,\377\251@"
+	.ascii	"\371\237\3633\215\377O\377\231\376k\371\377\255\353\272\376\277"
+	.ascii	"\360\037\310\237\312\tl\325n{\273A\034\331\235\232m\325\264W"
+	.ascii	"]\202\313\331\027=\271qh\333[\366g\342\312se\325\362\264jz\256"
+	.ascii	"ZM\333vI\352\234\300\265ioz\206h\025=-.5WVMc\234\330-\361\ba"
+	.ascii	"q\235\"\247+M\235\236\275hGu3\017\251M\237"
+	.string	"n\035jF\225/X\312\255\227\342\366\244D\371v\367\201\334m\tm\\\317\372@\273}\334>t\007\221\267\3277\270G\326\320u\022R7\202\276\335\271n\222\273\327\335dw\337\230\272\333\rC\307\356r\271n%\003\271\326\221PH\335\037/\254\204\325s\223\0237\361\023\263\331\215\336\272g\300\020P6\231\330r\246\225\224X*3jZ|\341\235\237~ !\216\022\240;\201\004\027W\304| 3\341&\354\304b'\347'\f\3458\270\333j\367U\341t\031#\203\367\201=\274\023\202G\342\231\025\252\326u]\231\025\276\314qTA\320\240\350\302K^+\273\205>A|\003\361\3779\354\322\354n\0256\267\315[\200\360\347\263\r3\353\317\341\024\373\374\007;u\001\275&\301\220\021{<\2251>\360\177O?\f\230\222\335\350\271*`\325\224q:H\313\35336\330\313e\203\r\335|\301G\0202Z\3136\216\264\026"
+	.string	"\033\f(\202mf$B\274\313E\241G\203\205\nb\354\301l4\252\321d#fc\fV\003Q\324\232\215GGc\25453\352p\324\212\321j\255\007>5\231\214V$\363"
+	.string	"\033m0\017\264q\214\3010\\\250@\3401#\232l&+\022\037\364r\360\032\"q\363!\"\bD\020\302\017\021\271\\D/\227\370\227+E\353\360!\006\236\253\260\025v\372\341+g,\234\3456\345\355\373\341P\303D\311\007\352\360N\370\261\016\361\374\023\246\326\225\177B\206\342)\354\304\303Tr\326\bY\203\346\003\3176\3043O\310+\363\204\017$ @\002c\024\263\251\003\3042x\003l!\300%D\262:\264'\025"
+	.ascii	"\347p/>\207\201\372OE\266\b\302\005\273\330U\277!\263F\006\027"
+	.ascii	"\331b\"\331~\241u\241\027E_\245\377{\334\202\206\213\200\\\006"
+	.ascii	"\016\214\034#.5\\[0\324\306Y\215\271\r\002\202K\013b\266\260"
+	.ascii	"\366`.f\3151"
+	.text
+	.section	.gnu.lto_.symtab.47c5b5462494c4fa,"e",@progbits
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.47c5b5462494c4fa,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,276 @@
+	.file	"huffman.c"
+	.section	.gnu.lto_.profile.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375 \210m\002"
+	.string	"\024\003|"
+	.string	"\002"
+	.string	"\374\230\247\260\003\016\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\003"
+	.string	"\002"
+	.string	"\001\361\212\334\223\003(\002\005\002\006\002\005\004\002\006"
+	.string	"\002"
+	.string	""
+	.string	"\013"
+	.string	"\373\r\022\002\200|;\212\225"
+	.ascii	"?\363\001\"Pj\364&\003\314\024c\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375 8\255"
+	.string	""
+	.string	"`,"
+	.string	"\002"
+	.string	"\005"
+	.string	"\003\001\004"
+	.string	"\003"
+	.string	"\003\020"
+	.ascii	"\035Id\303\002"
+	.text
+	.section	.gnu.lto_.inline.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375 \2555\004"
+	.string	"b\b\035)pU\222\016\234\312\320\363\013\226\221\037\233\341\221\323y~]=\272\373iH\023\177:U\364\276\377~\177\263\373\335\020\t\2212\005K\\\232Q\315e\300\322n\267\233\340\275\216R.*`\360\017V]\037\n!\370Y\262\033\330\227\263\t\351Y\234Na\276\242ww7\336nt\223\221X\275wQ\314\335E?\025 R\205\016\354\217J\3069U"
+	.string	"T\361\020\276O\002\005"
+	.ascii	"e(\365U\271!\256OH\030f\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375 :=\001"
+	.string	"\310."
+	.string	"\002"
+	.string	"\005\001\377\007\177\002"
+	.string	"\177\002\007\177\002\001\003\001\004\001\177\002\006"
+	.string	"\005"
+	.ascii	"7\213\350\274\221\322\036,\002\003,"
+	.text
+	.section	.gnu.lto_.pureconst.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375 8\035\001"
+	.string	"\270,"
+	.string	"\002"
+	.string	"\005P\374\007\374\005"
+	.string	""
+	.string	"\001"
+	.string	"\b\b"
+	.string	"\001\004P"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	":\271\311\345\330Y\276\001,"
+	.text
+	.section	.gnu.lto_.lto.cbff727fd219252f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_huffmanEncodeBuf.3.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375`Z\b\2150"
+	.string	"\032V\334\022E`\\R\007q\336q\260\242]\001\321\025s)#\374c `\201\001\267W\203`[}"
+	.ascii	"c!\311\r\177\314\312\234\265e\303`\2238\260{\020\n1\273\036\256"
+	.ascii	"\b\252"
+	.string	"\274\350a\377\332W\210Z[\302\335\366\336I\246\024\"\001\f\001\032\001Y\304\026\027PQ\031\025\242\250}p\235M\340\004\365\264\347\232\277\036<\341\242\227\363\031\322\331\346\340\256YV\324U\270\322ok1c\375\030\022\365UX\004\0253\026u\353\001\306\216\326o\r\3149\214\256-\347\254\324\t\034w\273\231O\201\372\231\0137\346\fdJ[\316gJ\215t\235\3553\027\212G\201v\277U\210\261\022\231\222ee/\347\234\034\340?\255\263\253\373\264\316\276\020wa\377\252\325j\325\3273o\342C\335X\344!\016\205o\020\350\376Zv}\fm\017v\275p\343\230\027\327\237\273\037m\034\217klE\002\013c\303\331\206`\036\037nQL\004\363\341\372hX\342\034\217\253\307\372@\212\2231,,\f\342\305\303\337\025\002\231\226\017\rs\356\274\214k\f\007\313\270t`\340\016\002e\\9\260K \314\353\313\177x\\_\353"
+	.string	"<\355\312\302-\016g\211]\322u@\316\371\355\212\201W;_\313\352\340\204y\361\360w7Gb\203\023\346\005\346\370\007\225sn\254\325\345\345\335\343\335\276\354n\255\356\237\207\355\217\337\263\372\234\f\210\021.\213w:G\232\3012\325\021"
+	.ascii	"\211\020\264\177\261g\333>\006\372\344\211\323\030iw\321:\353"
+	.ascii	"l\216\301\2028\221\003\003W\273\317^\340\027\353v<\207m\257\037"
+	.ascii	"H\267\223\243\271/P\320\304\224TJr9o\244\317y#y\026\367#\004"
+	.ascii	"F~\305\375\200Wq7\340g\356\0050\356\"\257\363&r8\357!\357\342"
+	.ascii	"-\024\004\004\340\347\350\323c,z\025o\036\214\233\210q\017\201"
+	.ascii	"\270\205@\334\357\213;\350i\336@\337\342\355\376|\315\273\005"
+	.ascii	"\342fW\334k\020\367\007qc n\177j\202;b\311\271F\365N\036\303"
+	.ascii	"\272!\361:w8w9\3679\367.\356i\356[\334\327\334\355\016\323n\327"
+	.ascii	"o\335\227:\227\341zi\217s0N7\327\204\223k!\227B\017\314\325\027"
+	.ascii	"\177\203:\334\325\232\207@}\2413\341:[\304\336\326\356\326\257"
+	.ascii	"\263]\242\260\221p\235\365nh\273\232sq\266~\273{\255\337\326"
+	.ascii	"\234EB\231\026\275\234\003\276\346\234\263\220\350\235\376\265"
+	.ascii	"\222\367xmrT^\242'\376\227!=\361\205\254\340\336\343\323s\013"
+	.ascii	"\276X\013\375\3601\021\252\335\222\037\370\341\017\263\3048\360"
+	.ascii	"\305\232\270e\367\363\354\317\366\3352k\231\036\200\322\231_"
+	.ascii	"\323\361}~\352vn\001"
+	.string	"\t\215\237\202\357\2655~\361\247\335\335\013\276\370\230\232G\025\203\205\371\334$7\276\202\377Q\245`Q\\m\177\323\341yt\007M\366\3444\371\361\233\236\305QG\312$\372\363;gzL]BU\223\344@\317\364\354\0251\322\276$\037\372\344\263pq\322\276V\370G\25580p\265\201\376}\341\377[\226\215\350\230\016O\367}\366F\325\341\314\271\023c\215\332\340{\030u\r\026\346k\344\017}\360\335\316\r\334\250\223\365\025}2l\320\322\326&\347\371\244\377\033qR&Q)W\223\202A\022\371\r\214\330a\037\351q]O9\232\021Oir\306zj?\243B\271\344l\373\212\326Y\366\237\324\230\375\037\375\372.e\262z\323\265\370\377Y7\322\262(\256\006%J`\246\022\303\253\024\321\214\340:\227Q\316+\245\363\267\\b\247\322\352\225N\026?\347Ry\"\204\324\006!S\211\201\271d\251\236Q\314%\313Tb"
+	.string	"R=\243\234\317f\333SKL\251**\252'\211$\263YU\325\234J2\227RU\311)\253\253\344RQ7Q(\255\222\316f\323*\371\236e_y~n\031%dE\243\f5\326\202K^T\364\r\005\343\243\306\027\353\337\033\255e_q\355\\K\362\212\304\240G@\354\371\337O\363\034\001\376\232\361c\316\214\033\236\027k \221\241\022\005-}\030\351B\3001;\354y\036\344R\320b\206\013\374\317\260}g\363#\034\030\351=?u:\237P\204l\230\364\275b\003\317s\340\205\200g\004hm%!\n\201\036\370\323\026\036\337\375i\257B\343\267?\025z\245w7?\002R-\262!\305\311\360\305\372M{\235>\250f\367H'\272p\204\354MZP3{\234\263_\265C"
+	.ascii	"\276?\350\201|\276\377\347\217?\355\267\370\275~\317\033\177"
+	.ascii	"\212\364D\357t\250a\2600_\200\257\250A8\245\220b\310\320\214"
+	.ascii	"L \243IZ8\200\002\23193m\020X\210f\223\244\003\274\244K\001\334"
+	.ascii	"\026e\321\316\020\322u\342\"U\364\230\2504'+\225D\006\031\277"
+	.ascii	"|\224&#Z<\212\307SAd\232(\316b+`j\225-a\260\232\003!\027\213"
+	.ascii	"\254\f\305\306\276\365\230\352\214\211\022\001D\254\266\030\243"
+	.ascii	"\275\\_\326\030\355\007\341&a\242\301\030\234\361V\316\t\261"
+	.ascii	"\372\370\307:\035\021z\037\203L^\244N \003>\305\216\026\310\354"
+	.ascii	"\013\224\373\020\277\020U\342\271YV2+\213\370\250!\326\257\314"
+	.ascii	"\255v\004\201\341\007\027\2060\030p\367vS\tO\354\352\361]m\276"
+	.ascii	"t\240\342SF\026\373\r\nb\024\267\007\001\371\324\027\327_\367"
+	.ascii	"\3655\247iX\002\326\351\2775~`,?\203\303\253!0\274p\345\024\001"
+	.ascii	"\\j\207\247\227\357\351\342{\365\315k$Z\337\022\317\022\323\204"
+	.ascii	"M(\3225h\006\233g\313\201iQ\337`\024\345r\367\b\335\336\254\r"
+	.ascii	"\224'm/e9\017\344\t\344Z\016~>1\314\273bN\301E\343p\233&@\232"
+	.ascii	"d\023\337T\004\223\360\220:(U^\016=G\037\344\323\374\007\373"
+	.ascii	"z\323_\211\23137\332P\241\344\003\257\177\271\025\2123\004C\275"
+	.ascii	"\356\254\376\007"
+	.text
+	.section	.gnu.lto_huffmanEncodeBufStreaming.4.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375`\344\b\2650"
+	.ascii	"\352U\350\022F`\234N\007s\352!\037\306`j\325L\210\254\302G\003"
+	.ascii	"\341\355\307\200\201\325\231ClI\3564\346\2434\231\274\206\243"
+	.ascii	"\330\002\005\362/\254_\316\257A\034\237~\277\234+\026\004\342"
+	.ascii	"\007\221(l\"\302\216\266\367\336;\311\224\002\034\001\007\001"
+	.ascii	" \001\353\233\324\215=\036(\\_\275\373\331N\305\335\372\355\356"
+	.ascii	"6\246g\350V\360\212\355\313\203\353\353\322\202\247Oq\272\331"
+	.ascii	"H+\205\f,M\316\322\243\257]\301U\243\274\300{\360\330\237\264"
+	.ascii	"\234j\314Vdg\323\234s\202n\200\235H\005\031\263\025[\r%\307\335"
+	.ascii	"\036\365&O\227\306p\235\234\313\270Ls\226&\350\243\353kK]&\276"
+	.ascii	"\366\354\226S\245g\\N\246u\005\305/\347\214\034r\037\326W\325"
+	.ascii	"yX_\037\210\007\372\360\211U\251w\361\237n,\022\207\3027'\350"
+	.ascii	"\266\354\252>~\266O\271\361lZ\205\213bN\364\262\025f\205\207"
+	.ascii	"D?\272z\270\260\215P\345\3267\326u\346\257\n\201\b\226X\0066"
+	.ascii	"z9\352\2038\035Z\356e\013L\305B\370\372\034mk\007\016\362 B\333"
+	.ascii	"\372\302.\321X\227\227\267^\266\274\324!\234\305u\205Y\035\276"
+	.ascii	"\022\271\240\352P\316\371\345\222\201\325;\247@\026\244o\254"
+	.ascii	"\253\207\277O}%\343\3217\326%\346\270\215\220sn\214\305\325\345"
+	.ascii	"\255\343\335\216\241\273mt\267\177\001\004\336\301\027]\026X"
+	.ascii	"39\027\246\233sf\320\236\367"
+	.string	"\2146\031\0303$\006\353+\321\273\233\027\351Uy\023\245\302\201\335\322)\374f\335.\214\242u\244\277\254{\351x\300\347\274\221\274\316\373\310\243\270\033\3607o#\177\342^\300\235\270\027\371\024o\002\336\346M\344R\367\241\307-\344v\336A\036\347\r\344p\336?\217\333\007\343\356\031\342\346\031\342\336\031\342\326\031\3426\262\270\213,n\342\213{\370\342\026\276\270\337\027w\316\213;\310\342v\207\270\333\0277\253\342^\205\270U!\356\177q\343\034\334\256\240E\323\023\222\222\263V \234\334e\305R\304\355\334\343\334\347\334\353\334\337\334\341\334\247\270\267\271\333\275\245\375\256_\273\226c\013B\303\275\322.\347t\256\245\337\272'wj\313m\333\353\221&\347|\314sK\033Ua/\\_\033\213gyz\034\224\233\247.\026\233\330\322\365\325\210\275J\273\025\237\366\353+\234\324\320\224\332t\205\353\001jQ*W\347\273;`*\250"
+	.ascii	"\356P\254\361u\302:x \224\361\333\251<6\336\256G\"\310\205\347"
+	.ascii	"\267\246\370p\230\001\224\234\370\305\307o\3204&\377c\022\277"
+	.ascii	"\235\302S\213zv'\353\006\250\355\273\363[\323\276Y\273\223\035"
+	.ascii	">R\215=6\276\341\257q\372\2349\226\032\341\017\377\361\240\200"
+	.ascii	"j\204\277\372\240{\023E\340@\177|\020`n\240\200\354\373=Xjr>"
+	.ascii	"\370\357\253oW8\252<8\032g\316#\340\213*\235\301\307oe\\\367"
+	.ascii	"\327>\2717Q*o3\255[[\217\330\366}\214\215\214\025\376k\244\007"
+	.ascii	"\372\366\375\316U,`tW^Uo\306\207\021?\365\315\372\203\363-\031"
+	.ascii	" \221\276\235\202S\213\262\177\364\030\357\n0\204\213\031\261"
+	.ascii	"`L\316V\f\332\3034E$\275`}e\177\001_\224\352\r\374\372\016MS"
+	.ascii	"\275\355\330\177\365W3P4\374\377\276\247a\204+\365\256\305\327"
+	.ascii	"\265/4Y`\002\272r@\377\315\276\350\215^\215\003M\253\302\201"
+	.ascii	"]\340\375\347\276\304\\\001\272\336s\315)\340\254\235\311\372"
+	.ascii	"\032*T`e\322\302\2334\261\234\3406\235$4\231\311f\313\\\266x"
+	.ascii	"\023\312\344G51\024\223M\030\022\232\316\013&\222.\230\230\302"
+	.ascii	"$\213\022L\034\204\312\244\005\245\323z\302)A\351\264&\233LM"
+	.ascii	"\346\332MIJ\246\247\023'\234)\220\312\345\323\323\262\t\251t"
+	.ascii	"bzB6E1\221I\001z\331\"\031\205l.\227Q\310W\232\375\313\332\335"
+	.ascii	"\334M\303\304F\361\350]\324\242o\222\013\t}G\240\372*4\343\233"
+	.ascii	"\265\322\037\361\300\267`\270\350\177\214\376\347\205c\003\312"
+	.ascii	"\362\324\212J\376\363"
+	.string	"\007\336\247N!\354K\f4m'\017n\006\361\315\372m\023.\275\237%\t\373\243\007}\226\337y0-\311\031\3411x\206\004\360q\316\016\305\002}\326\321\007\275\267a\273\263\302\177\256\346\234\363\020\201\007\375\322\273\0220\270\3273C\306OH\340}\200Q\363z\221@\t|\203\336\347\205g\222\374\350}\036@\034hX\025\016\304f\336\310\226\344\374|\317\177\030\266\274\247\363\260F\337\363Aq<\370f\315\363;\\\2727`(\317'\361E\255\240v~\325\373\022\200\251\250A$\310\224S\b\t\215\314h\222B\2061\220\002\0219+n\021\0209\350 \232MRn\334D\357\303\017nb\300ESa\234\034\220\372\210\b\374\204\016\230j*+!!\027\371\007\004\236\274\005+\220\247\3362\003\210\204/\267;d\2676\313Z\327\214(\033p\277FI\205aD\243#6\031E\n\003%\005\274P\326\324\f\024\324`$\367"
+	.string	"\255\302\002\np1T \230\211<,\351\242\002L\020\256\373`\001\034)\235(\360\f\237\250\271\004\314)m\374\254\246\035B\364\256eQ\241\f\310\231A^\327h\251\206\233ji5E\"}\360\221\025\030\251\034\036\352\006\030\207\251\232\222A\036\372\205\232\b\2633\213\200\232\007\363 7\305J\210\005i\020\t\032\341\177K\335\3061\"C\022lL1\235\360e(B\346we\213"
+	.ascii	"88\345s\200t%\347\344\352?D\r\202\023\353Gd\250E\036\320W\202"
+	.ascii	"\256\323p\305\007\030\036\327\363\177\311\254\271\331\360\320"
+	.ascii	"\341(5\314\2713\345\240\344a\327\350\013\370\204\352\\q\b\002"
+	.ascii	"\240\231\324\255\275\265\237\246\310+c\332\300\n\2207\021\263"
+	.ascii	"\315h\22204C\327<\267g~\370o\n\342x\336\335\r\020\346A\360\312"
+	.ascii	"W\335\300\224\233\214\2624q\346\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375 4U\001"
+	.string	"\024\0020"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\b\370\317\365\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\t\261\217\306\f"
+	.string	"\002"
+	.ascii	"\240Mj\3151"
+	.text
+	.section	.gnu.lto_.refs.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.cbff727fd219252f,"e",@progbits
+	.string	"(\265/\375`\300\007\205,"
+	.string	"\352Q\244\021Hp\032R:\003\272\222\f\303\376\360\022\b\252\020\223\362\342;\023\335-\\\006"
+	.string	"\0069#2\323\334\017s\346}kh\022\275\241R\030\241\264\301=\321/\377"
+	.string	"\372\355W:\353{$f"
+	.string	"\217LZ@v\336\022\021\021\031\261D\246\350"
+	.string	"\005\001\007\001XW<]\330\244\256\314u\337\237\241\241\3249u\246MM\031\nG\341+\304fg2\036;N\360\366E\177\270)\013C\323{X\317B\252\356\371d!\365\033V\005L@M+\254'ZQ\036\240\362\230\200\372\363\222\240\236k\203\310%\266\324\305\360\212\213rwUU?\220h\330\317HX\311`\272\226\n\331d\335\327\007]\333B%DS\366\342$|\203\370\353\021(\\\307\202\265\262\373\366\004xs\344\r\0334\275\320zV\362\036\260\246pt=\007\251\374\344 \365\227\t\250+\017P\377\253\375\357\362\237\315\313\177\267\013"
+	.string	"\023Q\340g)\377\317\3763\377\207\375g\360\277\304\177\240\237\323\237\377\337\354\377\027\357\3470\377\345\376\213\370\357\374o\345\177\225\377T\376\213\375_\376\007\373\017\340\177\226\377\272\347\363\371\374\337\374\371\302\257\026\003MD\230\242\211\023\330\333l\037\334d\271\216M%\325}\200\330\315r7\273\233\355\356\234\342\361v\347\340\265I\"\261\333\352\207\330G\366L\252\033%\003cfl\227[\310\336\331\222e\262a\\\226\223\355\324*\256K\366\253\251\272\233\317\254I#\r\270/N\0354mm\0254u\333y\tA\303_\353Y\371\367\330X\013\207\001\t\333\016\3122\036c\343.\f\306M+\013]M\274\360\032\267\261\032_f\343\2643\027n\376\347v\017\273\233\261da\222d\343-|\306\203\323\215$Kv\337\241\241\237\241!v\262;\316"
+	.string	"\244\347\256\225\177\370\307z\306Z\3176\3263\325\312\343\001W\302p\226X\342\322\254\b\255\303)M\224U\250"
+	.ascii	"\220\262\205\230\206\246\314\373\023 \213M\216\036h\372\027\353"
+	.ascii	"\024\226\302\227\321\230\311\271\t;9z\273\227\335}\036c4~\302"
+	.ascii	"g\334\354qA\251|\353\276\227\360\367\376\b\024\030\215\313\030"
+	.ascii	"\fH\330\035rg\356\272\225\335\r\204s\224C\243\206\246|\206\303"
+	.ascii	"p\314X]1\321\224\341\316D\347\262\244b\240)\233a\261\335\025"
+	.ascii	"$8\206h\312og2\\\022\"chz9.\363_G'\b\020/[e\310\354\212\300\305"
+	.ascii	"\2711\257fIf1\321\224\3070\023\235)\2562b\344\326\243\277\332"
+	.ascii	"\301bw\317\300\271]\024\356T\306an\360\007`\035/\370\237"
+	.string	"\266\356\t\336\272\261\222q\353\220(A\035h\372_A\337H7\353\323\267\213\355R\213m\305\324\214>\267\263\n\364\222\253\333\253eL\221\215\366m\356\241\226\221E{\221\305\366\"Y^\017\221l\3675\362Z\262 \313\355R\313\330.\221F\237\0366\333\313`\326:D\032[-H#\257]\006\215\355P\313\350s\225\344\3415\025&\330\305l;l\031\304c\260\310k\266\027\331\316n&\223\352\342\202\356#\262\350\f\336`3aS\206\320I\020\311\267\273\r\020\205[\310\0366[\"\310\016\300\037\223\016\305\217\251)\311\367\004\fa\340JKQ\030~\032xWbz\362\375|(\326O(rPd\324\"\347FG\020\216 \2507:\352\365\216\212z\353\213z: \220I\205B\362\001\223\200!\200@\246'\022P>\240\013\023;\037\320E\316\317\367a)\n\0030\312I\007\370\024@wZ\341{\"\002:9=\021\355"
+	.ascii	"\221\212zk\n\205\344Sa\"I\004\317\317\367\301w\302I)\007\210"
+	.ascii	"d\004\3741E\345\274\327\313\240`\004\b\016\253\322\203_R\323"
+	.ascii	"\322RT\n\242\237SS\223\223\022\321\217)\251\211H\351\t\212\350"
+	.ascii	"\001\202\243AT\310\367Lt\2503\274=<inmN\257\265E\316\363\371"
+	.ascii	"|\362\231\352\3351\303*\253\201\246i\236\206\237kw\221\345\265"
+	.ascii	"p\255*\251\276Q\016\235o\316\317\235%"
+	.string	"N.\031\232\362\032v\223\203v\024b\305M\033\365\255\353\312\351\326;E\326\332$l8\rM\336\230j\203\246\254f\016\335Z\317`8\314Y\314\305\260\034w\007\333\252u`\224\3148\316\265\225U\203\235Y\025\030\217\270s\200\207\250\221H\205\2143#\"$\201\310H\222\244\003p\002\221*+;\021\220\261\201DN\244IAj5\006\321\203\305O\301\332A\364\203p\224\307;\023y\237\242\026,):\207\374\263\232>d`\276uS%J\374@\242\r\002F\354R\274\212\334\013\221\250\227a\361\001x\240\362v\344x\006Q\213\243/\244\3021y\321\002\263j\206\032x\027Ic\236\242\003\336\016\221\207v\205\375M@\314\372\314-\255\233\362\334\210\265\237\034%\214_]0\220x\377Ml\3265\312YBD\374c\030x\322y2\200B\230\361L\004R-\325\264\321zL\371L%R\365(\215H\237\207\n\034\211\337\262"
+	.ascii	".:\313\357\364\362\036\317\230\224!\247\204\005\3005N\320\273"
+	.ascii	"[\363/,\306K\374\036\256\032\261\341\314>\232\313U\203\006\301"
+	.ascii	"\374\022\250\345iL\177\206\223\\\332\263\354\245e\022P\361S\272"
+	.ascii	"\204\375Oi\373E\204B3\256\007\256kM\025\360\241\231\333\324&"
+	.ascii	"\243<\230\\\b\217\357\323\023\353\222\247\375R7\355\361\272u"
+	.ascii	"\214\354\333\t5"
+	.text
+	.section	.gnu.lto_.symtab.cbff727fd219252f,"e",@progbits
+	.string	"huffmanEncodeBuf"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"huffmanEncodeBufStreaming"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cbff727fd219252f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,464 @@
+	.file	"printf.c"
+	.section	.gnu.lto_.profile.1f312921037a518,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1f312921037a518,"e",@progbits
+	.string	"(\265/\375 \261M\003"
+	.string	"\244\004\245"
+	.string	"\007"
+	.string	"\343\214\373\264\003\004\002"
+	.string	"\001\312\334\346\233\004\006\002\001\261\316\222\345\017&\002\003\002\003\002\004\002\004\005\002\005\003\306\261\236\222\002\004\002\006\002\006\002\007\002\007\004\240\342\234\212\n\005\006\252\335\206\331\006"
+	.string	"\002"
+	.string	"\002\b\002\b"
+	.string	"\f"
+	.string	"\0043\245\224;K\221\035\025\004\216\301\013\001V\316\340\302t\006"
+	.ascii	"\362\311\r\264\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.1f312921037a518,"e",@progbits
+	.string	"(\265/\375 \357=\002"
+	.string	"\004\002\343"
+	.string	"\004"
+	.string	"\005"
+	.string	""
+	.string	"\003\002\001\200\004"
+	.string	""
+	.string	"\001\001\001\002"
+	.string	"\001\002\004\003\005"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\017"
+	.ascii	",\263\211K\001\2131\360|\236\244\263\206\334\001L\025x+4@\022"
+	.ascii	"\316\202\313\200]\300\340\302\356\352\r`\001"
+	.text
+	.section	.gnu.lto_.inline.1f312921037a518,"e",@progbits
+	.string	"(\265/\375`\033\001%\b"
+	.string	"B\215(,`M\222\016\344\032\232TG\020\b\224\001\\\"ZWT\240K\200+\246>\266\272#\260\016\3030t\202\347hmV\273\241F\b\331R\246s>9\246\337Y\234'\334\bc\2142\260~\266\256T}\001\027tV\237\223KO\212\202\032\037jPS\317\207\371\021\312\321\361p\221d@xT\220\365i\251\210\005\210\003\333s:\272\273\351\032\360rt\351\357\3139+\307L\250\335|\364)\240>\372\341"
+	.ascii	"\263t\357A\031c\r\353\025\032\201\021\262Q )\3737\345\375\\X"
+	.ascii	"M\031\356\246\345$&4(\b^]'* \200\002)\253\261\003\367b\364\003"
+	.ascii	"\bl\034\271\200s\373\037\251g\217\004\304\201\215\341\200A)\341"
+	.ascii	"\0278pA%sm\205`\002\305\016\271Y\be@3\r.\003Xu\247a\242\300\215"
+	.ascii	"R\\\340\206f@x\207YA\004\007\361\214\235\3132\215x\034f\353j"
+	.ascii	"X\335\235:\256p\273)XO\273C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1f312921037a518,"e",@progbits
+	.string	"(\265/\375`v\003\305\t"
+	.string	"\242\314$(\220'I\007\313\374\037\373\001\276\037\177\273\273;^\\9\254\331F\356\245\3145\264<\024\370\344\346\310\022b[\333v7\231vy\003\277\201\300\024\351uk\246/.\310bq\340\274\241\276\331\003\326``\205'\334\tF\016\nB\312\267\360\n\377\334\033\236\341nY\201\235\031\346"
+	.string	"\254-k\255\265\222;\360\035\330Wh\277s\317C"
+	.string	"\315KR\223\037\327D35\227\357\315\214\0256+\354\214f\313{\217}\317f\226w\326L4QS\321\2466y\2140\204]AA\250\241E)#)(P\266\016p\"\241\272\333\001\022`\0229\002\222\252I\201R\306\030\321\304\324L0\301d\247\266\032m\005\210v\262\373\013\331\312s\006\327\230\255(k\222\006\213\367\336vF\024kw\211\253\003\231Y@\226\231\320\245\367H\320\263\363\210\221\344\004\257\002c\345\314\310v\274$\210\276\002\325\245\261(2h!s\301\334D&l\f\017\376\230\203+\254\027\311I\350\264\372LHD\211#\222v<\207M\327\266\013ui\203\006&\374u\\\317_\\iN\326%[\220JP\207"
+	.ascii	"\356\333\272a\002\236"
+	.text
+	.section	.gnu.lto_.pureconst.1f312921037a518,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\231\004\001\232\004\002\272\004\003\230\004\006\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1f312921037a518,"e",@progbits
+	.string	"(\265/\375 ~\245\002"
+	.string	"R\004\016\030\300%\035\240\377\377\376\377g\3356\256\377\266\006n\354]t\357\335\232\224)\017\006B\324\305\223\245\274t\232r\323>\260\035:\350\374|J\241\234\177\\\272t\350\272\266?\t\n"
+	.ascii	"\330P\341%<\250\260I\335\342\262\252\323\206]\342\025\033\200"
+	.ascii	"\255\003\200\003"
+	.text
+	.section	.gnu.lto_.lto.1f312921037a518,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_putchw.16.1f312921037a518,"e",@progbits
+	.string	"(\265/\375`\327\004M\036"
+	.string	"v7\277H\240TN:\272\344\252X\\\2734\307^\bk\265\354\331}\377)\360\204\241\341\2536\340\210\021\332\224\325@\325\332uA\344\233\033\374y}y^\216\227#N\270\b\3517\304X\204\361DV\253\376\353\276\232\265\204\020\262\323N2\260"
+	.string	"\246"
+	.string	"\246"
+	.string	"\033\3051\265^\335 \2535x`\013\224\0267X\032\207s\364v\313h0\353\007\204\026\345e\245\326\252\3431\315h\221Zf\264x\025-\267%\207\303\341\3204\350\035i\317.-\270\334\315V\222\243H?{k *4\251\337\222]N\224\230-XS&\2143\341\034%\237>\300\260\022\020V\024H--\b\211y\023\2005Ue\333\323,\315Te\222~\353\313,\367\213\242\016t\330Xa\241\005\310"
+	.string	"A5G\255\021\026\311\240\0015\320\244~#LE\370\271_\023\345\251\265Z\350\351\3739\315I\006\325ZwJ\375\246\274/\336\265\204\335\225\260K\037\004\273;:98\016\3327\336\262m,\346\255\241\231\221\211q\227\rc0\373%\347\036\266\013\235{s\230\327Vz\314K\032\314;\212\356\362\322\317\375\347N:\327\001\0224\261\371\252\365\303p\255\"\021\203\304p\230-f\217\371\273\336\335\336\372\207\201X\270\270\335\035\3332Z\301 \310\270\022$\306\243\225\312\301\f,i\265\326\007aJAM\035&\320XK\2535\330cq\033\224\"\230\322\rLu\342\352"
+	.string	"\364\263\240\347\036\274}\255Vh\f>\335\265ek\2535\305\021\262Z\353\201U0\2678"
+	.string	"\321y\356z\207y\364\034\f\377\241\372\212\312\302\204#\304\323\232\355\300\036\323[h\033\026\327\231\323T\363\227@\331\n+\313\036\357\330\343\235\373\266\244_:\322\347\356\333\026\344\201K\n\317\304\230\217hc\364\345\266\373,t\004\241\024Q\346K)\314\351}d\366\215\345!\031x\245\213\265\322h\3217\023_\025\323\034n\002\333\036\363;A\203\232Ak\255u\\\037\323\313\234\244\002e\3254\207{\037'\256\210\210\007\356<\217y\343\234\b\314\033o\367-\335\340\022=p\002\320zQv\336\350r\013\201\302\365\304i\252\355\006\227\346\201\273f\240\304\b\213\375UF\027\222\222\210v<\022\203\320D\362\220\205\271\301F\036BJRB\242+\3443\224dD\264C\322\031\035\025\025\035\t\351\214\210*\024\351\204v\032t>"
+	.ascii	"\366\b\351\302N\227"
+	.string	"tt\264\323\341\202\325\277\332\245-\345ut\236\203*\201\204\351M.\007\356\300\341\220/\t\024\301\321|i\356\345c\315w;\036MV\315\247\327x\232S\2402k)\217\363\232\377?TGp\007\256s\277Z\013}C\241\345\301\226\263s\362\276\"\266\231/%s\027\357\023\357\024\\g>\026?\363\233\r\355O\251\222$\353f\300\344sN\275\3069\177\363\265\371\362<}io\237\001^\250a<\343\fR\006\031\231\221\200HA\242\016p\002\231\301\262:\021`5FhA2\354oE\024_\306Kc\376\3431g\214U!3\006\305\325/\267\342\347h\222K\022\003\361\220a\340\301\324\220b\211\3655\003\314\243\222\021\325\344\226k\037\276\232\213\245\275\331\314\330\036Fa\210\214\026\352^\022i'\261b\317'\b\001uQ0\217\217\212\211\301\2142\224\035p\203/\r\367\204@\270\027\200_\252\251\244#\325\214n;\260"
+	.ascii	"\017\321.l\200\334\216\376\311\\oO\363\247@\303w8j\030\007\270"
+	.ascii	"\334Q\017\3577\224\353F\263\257\3527\005\252%C\252\nU\036.\362"
+	.ascii	"g\365\301\236\001Wx\017g\361\034\223\343\274\005g\266\200\275"
+	.ascii	"M\301j"
+	.text
+	.section	.gnu.lto_tfp_format.17.1f312921037a518,"e",@progbits
+	.string	"(\265/\375`h\017\345J"
+	.string	"\312|\270\033=0\242J:\277C\301R$3&\277\241\322k\322\023bQKTh\035c\203\376\016\263\321\250\201\237\355\205B\004\32091\242\262\252\035\210D\334\246\"\"\"\"V\021Y#\2044\"w\332\001\257\001\223\001\244\001\205YV\270\214\207y[R\270g\036c(>\233\2739\342\027q\022N<\034\350\025\177\270\257\337\206\302:\312\367\215;\361\250\3647\230\321\215\306\271j\362\354(C(`"
+	.string	"}\033\265gt\360]\262\200N2P\354L\374\001\360\320\037\342\311\277\031\313`\240\345\231X\003^3~\3250HU\323k\244\020\311\005\367j0n\236\211\311\032\315\220@\211\357\233h"
+	.ascii	"/\310\204E\016\307\2361\276\340\315@?\210\005\335\351}\365\264"
+	.ascii	"$\276\357\240\001\034\346\236\211\007\335\223y \024c\306u\220"
+	.ascii	"O\356yt\3224\226\357\373\216=/\305\236\271\036\212=\263\253\340"
+	.ascii	"g\206\276\353\311\265\245\225\205ueUE5%\025\005\365\344\324\304"
+	.ascii	"\344\\RJBj\272-\313\\;C\361\311\260 N\345\242\357Z\233\260\332"
+	.ascii	"\350\365GHO\334\232UB\231?+_d\313O\2679\303sm}M\360Za\211e\236"
+	.ascii	"\305\274\343\202\365xE\3000\020\320J\221\2172PQ\025\325\337\247"
+	.ascii	"\266h\311R\371nN `\024T\337\237\260\254\317.qW\262\223\343WG"
+	.ascii	"\252\241\340\233\230\370\356\324\023w\267>\337\367\245\346\245"
+	.ascii	"5W\2122&\320\n`\0262vl\013g\007x\274\2702\315\244\272#]O\\\035"
+	.ascii	"\224\334\354\302\233\243\273\273\206Q\302At=qt\253\324\022-\323"
+	.ascii	";\276\253K\334\223\334:9\353\224\223\336\361\371M\316-3\361\346"
+	.ascii	"\314|]\245\362\344\005r\312\265\255aT;M\222\344\214\344\376\342"
+	.ascii	"\3270t\226\201\212\360\346\f\237[\013\357\373\342<\225\233;\006"
+	.ascii	"p\214s\032\3068\006"
+	.string	"\306KG\002Wc\305\372\355~b\264\260\023\332\201\0333B\203\365\033\306gl\333\307+\274c$/:c\331n\373nT\260f\033H\335 \351\243V\b\f\252\t\235#\231\315l u\215n_\330\034$\322\303\302\"\270\032\033\241\301\224\364)\364s<\320/0\244\370\372\360\207\260gF\350\234\346\rJ\367\321\374\323B\371P\254\200\356~QWu\373\"v\307{\3115Z\032\272\336`\235=\314\002\377j\034\275F\272Q\331\362%f\312o\016\215;4~\266u\024\223\365\033\002\024D\351\243\265|\231\315\\\341\023\271\366\036\366\272\032K\3269\242\204 \377\030\311\213\032\022\020\341\232\356=\214\007\243\371\300\037\234\035\334z\030\233\341\240!\243\315\270\214E\2126c\024#\332\214E\200h3\376p\302\277\303\007\177\0167\3741\\\2500!\002\331\033\217\013\234\316\261X\030\201\2679\006\373\032\320\031{u\306\002\234\031\007"
+	.ascii	"\320f\334\265\224\361\263\315\230\213\231\361V\233\261V\233q"
+	.ascii	"V\2331\026R\306Wm\306VJ\031W53\246j3\236R\312X\252\3158\252\315"
+	.ascii	"\030\252\315\370))c\247f\306Mm\306Lm\306N\244\214\227\232\031"
+	.ascii	"+\375\315qRg\214\324\0317\333\214]7\343\326\315\230\355\214\231"
+	.ascii	"\235q\267\031_\007\n)\226\204\254\032\337w\311e\243\367qU\334"
+	.ascii	"r\306\277\361\247\363\267\371\337\374\212g1>\306\217\203/\347"
+	.ascii	"s\356\210\223\350\250=\243M/\033$\026\277\027\215j\356\353\327"
+	.ascii	"\036\006}\240\002PR\373\234\032c(\031h\231\374iS;uVad5K\217\241"
+	.ascii	"1n\352\226dt\246\022\362i\211\230\302?\226wV\033\235>\364W\203"
+	.ascii	"\350\026\344F}\272\316f\352\016\370B\206\374\351\207^\337'\214"
+	.ascii	"g\352\346\223\265v\366\343\250\325&\255\266\314\323/5\306\034"
+	.ascii	"<\344#\307\007\261\324\017\340.\231\254\026G(\371Q\373\304\216"
+	.ascii	"t0V\2511.a\"\177\212\277\207\037\204\305?\301bh\214\225\372\001"
+	.ascii	"\\e\341\021\267\2166\345$\3438{\017\223\301\r*\374\223\243\207"
+	.ascii	"\253zYZ\223\276\032@\277\341\367\305\253p\3067)\t\r\021\331\255"
+	.ascii	"y\033\017\177\362\316\352\335c4;z\312\203\303\247\364\005P\020"
+	.ascii	"\351\221?\037\030<\315\357y\201~\273\343A\260\035J\021\221.4"
+	.ascii	"^\233\004:,\267\341I&CT;\313\253\261y\rg\266CQ\f/q~+\255$6\302"
+	.ascii	"w4yeP\021\376\242=\3249\210\360\023\341I\027\222O"
+	.string	"J%\276!<\371\313's\230w\204\360\355X\221\f\374{\245\f\302\217\304\223\256K\342\265\263\f\374\023\2041\236\224\352\243\332\275o\364T<\231\247\357\033\326\227\254\264\363\326\345GI;.t\216DJ\360f#\365\335\276\034\315\233\335r\211\004\264[Cr|\363O\314\244[\241\361\332\2025\201~\013t5\226@\203\301UiF\345\327\271\034\034\007\351\230\221}\235\247Q\341N\335\306\230\205\213\374i\205~J;\212\301\332\355\026u\211\032\350\325\271\343\366\036\276\237\030A\366Wc\317\007F\220\211\003Dv\344\033=vt\220\333\220\221{\324HK3C\013\322\342\230\221\323\320\316d\2241\313\200\344\0315|\374x\336@+s\323x\330h\033>\322\324|\254x\306\001\033i=\314\320|\214\3658\343\301\343l\306X\017\2632\036c3\320~\214\035\300\302g>j\240\215\245\235\235\241\215%\r\276\217\177~5^\225"
+	.ascii	"\264\0316k\347\264\362q\255\331\360\017\305\237\222\360\360k"
+	.ascii	"\343\253\2102\232\035=v-\336\335\343\345M\026;^\271\222\372\253"
+	.ascii	"\337\310\032\255\360O\030\030Rd\235\323x\th/\001^\204\020\025"
+	.ascii	"\331}}n\r\350/\336\004\233\025)\342\212\243\223\376\206S%\244"
+	.ascii	"\307\245\365\325SmT)\"\026\215\376\236E\301\253\021\315\265\367"
+	.ascii	"D\212h\305\242\235{J\244\210U2\272\027I\253Q)\232)OR\212\330"
+	.ascii	"\004\242\0078eGsQ\246\203[\017tl\341\027P\305K\324\372j\234\233"
+	.ascii	"@\3770\343\365\250}}\231\217\232eK\200\316k\256L\251\204dt\347"
+	.ascii	"!\234,\032\315L\343\025uX\346\261\215\362i\213\211\212(\261D"
+	.ascii	"\364W\217\350v\363l\261w\211\350\202ra\237-\241\311\240\302G"
+	.ascii	"w\036\202\271b\321\024\n#\325pm5Wg7R\255\336\352-\266\310*\023"
+	.ascii	"\255^\351P\211VB\036q;t\347\341\235UY\177\265\214n7X\235U\226"
+	.ascii	"\205\325B\370\006UYu\246\373U\222\253\252\266\252\352\025|}\250"
+	.ascii	"$\247\272\351`,\025Ug\220\352\251\276\364\321Z\345\303Z\252W"
+	.ascii	"\360!J\025\331\362\345T\201&y\205\356\2542\222B\321_\235\002"
+	.ascii	"\252\243PDA\365\343\356\032\245Q\003\262\241'0P1m8\316S?X\022"
+	.ascii	"\201D\250q@\305\2203C#\"\"\222$I\032\003\201\005\304 \346$3\017"
+	.ascii	"\021\0205TL\315LI%\303\001\005x\bG,$\241\212\216\033,^/-#\320"
+	.ascii	"Q\201D\221\\\257Qb[\351\377\241\310~\370\344\236\272\205\327"
+	.ascii	"A\021\036\373\324\365=\002\226\256\312\224cP\262\227\222\263"
+	.ascii	"~\323G6JA\266\346\271\023\374\312Y\266\210(\376\257&\302,U\207"
+	.ascii	"2<\246\0269\364\240*vVgM\030\271\\\372D\031\227\225Ts\331*\317"
+	.ascii	"\272Ip5\244\257\2320\321{:$\222A0\206\t\020\261\234\036\301\377"
+	.ascii	"\211\327\205\243u\272U\216%\227\037\317D2\273\345\tY\206\327"
+	.ascii	"\266\3063\024\351\303\201f\025\211D\206\360'7\205\340G\254v\356"
+	.ascii	"j\221\351\203\374\244\255\325\"t"
+	.string	"\371\273\241$\3220$m\223Z03\324\0330q\017zA\265\337mc\253#4\311\212\300\371A\236B\365\007SPD\357{\336\316(#\025e\312\311b\204\367hOs\2578\303\205y\330\2158\034\033\fe\211\213\"\277P8\006\371\331\266Q\247L?e\227\345\263!U\326 \241\323>3\024#E\251\325\037\237\037\240WV\364\006I\216\342 \311Q\034$\t\031S\366\002Q\260\304lI\003\363{u\334\346\343T\325\226@tk\031\225\0278\252L\023\"\2405\226\260\274pTe\367\037\007\227\376U2\020K\370C.\325p\322\r\013\207\234\274\323\376\365}\304\374\272\217\375o\351\325@\257*ta\025\223\226\343\347-gHS\307\374\373dFl\276\361!\367J\304\002\305\n'4\341\320\037K_\347\3630nZQ\002\256\331\332Q"
+	.string	"\rG\300h\204@\221\361\3612\fB\023\020\203L$\003\017\252\360\003\206=\276\002\364X\373\021\022\261D\207\230\306C\202\262\233\330\372\325\321[\225\001\346\237\225\256\242\036\261\302\304\305\324\320{\221Q\312\273\355\255~cz\002\340\315M\034\030\357I\002|5\243@\3577)\017g\371\257q\252\341\225\206F\320\327\022\317\037,\354\214\240\304HD\364\350\3473F\031n7\241s ?q\311\266\341\004\367\333\270"
+	.ascii	"O\326\177h\361\340\227_'\236\204\323'O8\311!39D\023\2344syr\025"
+	.ascii	"\322\306\024\315\341\325\254dgkb\2372P'X\347\375\001"
+	.text
+	.section	.gnu.lto_init_printf.18.1f312921037a518,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"\025\t"
+	.string	"FQ>:@\3056\035\340\245\373\203\354\037\240T\031\033\3568\3137\242\207\276\341V\347f\203^\n[S\372\331\210 \245\336+!0E\205\025\026<\267$)\013\013;\300d\254\355\275wJ\001+"
+	.string	"."
+	.string	"-"
+	.string	"\226\023P\237\376l\225W\215\375(D1\002\260\2734f\374;\374\374\203\\\240\343\331\034\0060\354\256a\307\363\271\343m\037\330^\260\357\365\207Te\221\222\260\262[q\n\260\245y\302a\373\225mX%J\350\241\375\320?\276\213l\372\300.\250\303d\267*\030\301\362\351\372\002\3523#'\261\t\202\343\250OHB\201\321\017\271\210\347o8B\003\337\321P\237\363C\362\270\340\300\223]70b\330\227\273\273\216 \373\242_>\230\316\323\244\326y\232\264u\301tXf\323(\226]WfQ,\343pQk\343\350\305\300\231\366\260\321.\3136Z\325\275\334\br\203\247\304\211\023\226\321\017\017"
+	.ascii	"2\241\th\340\270X `\242\322,\332\313\033\326\262\013\227+\214"
+	.ascii	"\007T5p\005\314UPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_putcp.19.1f312921037a518,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\325\t"
+	.string	"\026\323C:@\345h8\340\245Y|\320\231I\246\177\356$\204m\330\237\213\232D\373D\220\"\261$mV\201\236\bY\316\335Xdq\206G=wy|\353)\235\260\243\256\301v\333{K\231R1"
+	.string	"3"
+	.string	"2"
+	.string	"\233\307\033p\337\272\027p\337,\3321\037?6\323R\2718\021\260\273\236z\\|\212\376K.\220R\231\236\231\206\335u\246T\032\267\3366\202\355\216\375M~\247Y\265pXv3f\0036\266\255\200\330\276\306\266\246\275\300 ~,Yw;R`\273\3331\347i\177\344$\342_\2069\301.K\004\266;v\234\320=\034\251*{\n\200\302\257\251\031\300\"\004u\023\nR\347\362'\270o\327\001\227\013\306\352\2243{4\245\266\354k\273\273V\226\375\361\347\376\3725-\235Z\006\337E\367\347\211\030\205>\241\310\013\201 \020\370y\241\317\003\310\373B\t\317s`P\004\021z#\020\f=\315\270\327VYv\330\210\235\024eN}\224\212R\312H\334\267\315K\017"
+	.ascii	"2\2413\0348.,\257\322\3404LT\303C\311h*\374O\350\312\027\230"
+	.ascii	"\271\006\274\n3\024Thp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_tfp_sprintf.20.1f312921037a518,"e",@progbits
+	.string	"(\265/\375`t\001m\017"
+	.string	"\246]iG"
+	.string	"\257(\035\220i\254\366\0257.{\257\372~N\255\354\332\317$\303\004\251\246\273\016\177\217\377\377\335\351i\256\366\243C0\372W\377\026\265\233\306\276\252\026\250J\247\220n8\037\246\202\302\214:\376\005m\224\303n\262wJ\001O"
+	.string	"X"
+	.string	"V"
+	.string	" ^pi\277\304M\204\257&\347\330]q\221\355\312@\254\200;u\345l\373$\316\n\355\231\255\262\244\256Z\201\002s\263\273\236\307;8\247\333\005pN\347\210\207\227\241\177\330\267\227UML\231.5 \354\256\245\230\352p\317\333N`[\304\226\\\237\033\003B\250\244\250\\\314\232\272\033j3N4\224\205\313]\377\313\217\271\214\335\271\364\230\251\007\031*\254\335\355Jvwz;\364a\016s\207\342)\302\277J\266\375P\327$\262zqp\300\235\236\300]\236\3618\251\233j\260\242a\335\354\356\307\251\031p\262\205A\205l\267\006\324"
+	.string	"\214\224\327s\3632\2271^\240jb@\234d\315"
+	.string	"\2447\347c\245\t\0356\273\247\213\217\375\204\007\001\013\005P^\244\363-\263J\033Q\246\311\234\374\370c\207U8\240A\264G\026\344E\007\230\275\320\306\f\323dW\224\234*\373\333\356\256\347\212\271\273n\372\326\003\235\013\3623B\"yD%\r\022H2G\367\027BB\372xD!\357\003\002A\320\347}<\035\320\373D#/\244\200A\241\021\221G\002\201D^WO\267\351\f\315F\332x\232(\227l\273\"\036\374\365\217-Y3\207\224\3209\354\021f6\264\361\344\037\307o\361\371\374\026\337\204\363\034"
+	.string	"2\003\3020\303&\310 \255a,)\314\3366\327\375J\b<\007\303h\272U\3132\256\251cZ\020&;\321\b\026"
+	.ascii	"\003@\210\251\202\302\3407\206\355F5\023\356\005\205\301q\201"
+	.ascii	"2\007\355>))\246k\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1f312921037a518,"e",@progbits
+	.string	"(\265/\375`\013\001M\b"
+	.string	"\364\013\007\002"
+	.string	""
+	.string	""
+	.string	"\002\020\177\021\252\333\3426\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006\023\177\020\200\200\200\200\004\270\300\021\177\022\334\216\270.\272\200\202\022\177\023\005\016\024\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\017\025\002\024\177\026\232\001\027\177\027\377\037"
+	.string	""
+	.string	"\200\200\200\001\026\177\030\031\177\031\030\177\032\025\177\033\033\177\034\032\177\035\004"
+	.string	"\374\205\223\273\003\001\265\007\225\013\003\002\013\335\333\2446\001\344\n\003\002\b\324\350\221\t\001\204\023\003\002\007\304\023\003\002"
+	.string	"\250\321\243\022\001\242\026\003\002\n\344\027\003\002\t\244\032\202\033\344\036\344\037\302bg\004\002\345\346\252\277\002\001u\004\002\225fj\003\006\r$\003\006\002B\003\006\f\244\001"
+	.ascii	"! \320\002)+\307\030\244b\020\272\f\302\021\336\270)\271\340"
+	.ascii	"\004\237\340\037\301\b\353\264P\253A\340\"\272z\004\016\340\030"
+	.ascii	"\034\200\303\013\004\354\322\220\b\006\371e\020\r\207p#w\031"
+	.ascii	"\240\270\321p\007K\214\004\267\211\317\001\033\003"
+	.text
+	.section	.gnu.lto_.refs.1f312921037a518,"e",@progbits
+	.string	"(\265/\375 \025\251"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	""
+	.string	"\002\003\001\004\001"
+	.string	"\001\005\002"
+	.string	"\001\006\002\001\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1f312921037a518,"e",@progbits
+	.string	"(\265/\375`\227\016eI"
+	.string	":\177\310\033DP\\R:\013H\252\222\002\220HH\b\203\250\336\377~\223\024\354\006\304\360\t\020\201\\Z=\343\325\376\353v+2q\004\274\223t\b$\024b\255B\001\006\006B9\352'\200\313\270\220\020U7 \355\304o\231\002k\001\242\001\277\001i\352\350\204\215\004/\214\356\312>\253v\256d\316\327\373\031u/8\032\244\372\341\271,\217y_\221\235(`].\373>Lt\375\362\316\220\211\231k\273\256\332\276.{\236\373Y\216\3030\325F7\263\273\r\034\211\251\225\231]\366{L`h\304\003\206\034\307t\0063`\350\364\232v\234\360K\r\023)\227%\362"
+	.string	"8+\363\241)\311\263\276!u9\322d\312\024\211\210\016\020\026$\227\375\271\352v\024f\215\336\271\354Y\312^\370\013S\205\232Y\320\216\353\236&\245\310\022f\347\262<\345\2663\225\331\336\264\341BIjK\273\233\251\032\240\335J\246\"\005\352V\"1?`~\300r!;\223\033\262\227\320~\312\004\206-\017\030\236\273\034)\332\033~/\264\370\303,~\326\260\"\357\002\376\233\024\365\263\033\253h\177\036\3749\005'@\361s\203\023\377\371\330\304\317"
+	.ascii	"J\374L\342g\002#~\026\361\263\204\020\377\253\f\342\377\214\377"
+	.ascii	"\023\376\313\370\271C\030\n?\367\371O\346?u\350\3472?o\370y\351"
+	.ascii	"\347\t?;\370Y\301\317\005~F\372\271\375Y\350g\376?\370_\360?"
+	.ascii	"\235\377m\376_\377\257\371\217\367?\315\377\250\3770\376\267"
+	.ascii	"\375\277\373_\367\237\356\377\334\377\267\377\326\377/\376\273"
+	.ascii	"\375\247\376g\360_\315\377\341\340\340\340\340\317w~\216\372"
+	.ascii	"\215\226\002\314w\246c\207tUDz\347\262<\347}Dlj\203\236\\\226"
+	.ascii	"\3450\036\221\315\017\025\"\227\3458\267\023\364\244{^\226\341"
+	.ascii	"0\265\235\202)\317\270\031\005\306Y\347\262\3323\033\336;\267"
+	.ascii	"\341+;`6Z/\337\3245\265\361\t\362\025\330^N\245\327h\357?l\245"
+	.ascii	"\263\273\215\b\247\355\\\032\235\205\314J\377\021\0131\204\377"
+	.ascii	"l\367\177\241\243+\335Y|\370\264V\310(\303.\373\337A\013\367"
+	.ascii	"\272\255*\273\247\321'3\232$\251Y\355\333\314S>\235\035M&5\273"
+	.ascii	"\237mS\331]\205"
+	.string	"\366\263Y\355'\261\032M\3664\232l\247\375lf+\241IMf\364\331\254F\237\334\254\266\263\231J\247\200fC\237]\215\346\341\3464\352lV\241\317\244\346\233\340\023\356J0\t?\233\314.\242%\246t\006\330kN\241\315\327\315qX\355\204\320-\006u\362)\223\360u\271Wd9\247\204\362\264\273\021h-\311\240\315\334k^\201v_Y\356\350\326\220\234\3565\024\336K\226\211u\026Vw\202\236vku'\271\367\272;\331\335CN\261i7X\200&\232\226V\267\327\001\255\026K\322au\337\270:\327g\263J\006e\242\263V\321:\3104\311h\315\027u\266\325d[g\355i\321\236\\z\364\326\020\003\305\314i\316#~-\301\353\273\354\231\324\\OhP\032\026&\234\346\n\310\025V\347\262\257\200\346N\330'\020\320\213\031\226\362\335\317v|\346zF\320\2421\\]R.\313\007x\300\220\211\351l\206\331"
+	.string	"\265\335]\366}7\331\246%M~\2350\365m\320\316\355\262\327\214\251w\213\324\f\353\262\267\214\341\252{\316\312\\\366\222\335N\230GJWw3Ce\202\232V5%J.\224\013\021\0258\324\345\222_(\213g\366\247u\331;\366<b\325\n *^^7L\032fI\262\t\366\033&\264\003\214n]\366~Ay>oW"
+	.ascii	"!f\217mAc\305\342\030\031\203\344\267\313O\356\n\030\275\354"
+	.ascii	"=r5\303\27348C.{\271\214\\\262\366\016\031r\267n{A\205\356t\331"
+	.ascii	"\032\024\330\355\245\204@0\214\222\"\277[~Fje\270"
+	.string	"\316.{\265\224\346\252\320\005^\366f)\r\215\271\261./{\211\334n(i\027fO\360^\335\253\333l{jF\206\350\244J\337\337\r\362\333\264c\205\254\325\301]\366b\261\333\320\032\021\271=\227\375\221\364l\216\236\337r\371\276\333\311\244\3562;hl%0n\352\246\375oRz\223\214\307\366\262\331\354\230:N4\025\330\326\222\206\346L\240@<\310o\322 \327@\0262%\360n\320y\360\032(o\317eY\320\373\212\326\302\236L\2724h\216p\221\263c\207\005\271[\331^!\310\276\376\332\313K\251H\216\222\267\346s\026<\377\201s\266\361\362\303\201?\021c\245ua\342\326r\037\006\304\242s\266v\331_\3662\201\250\314W\337`\021\032\240)U.\313{\336g\304\374\302\246\344\262\254\207\351\212\312\350\risY\316\303V\346\230\234/\177\3027:5\200\177x\214\332\\\r*r\331\343\341;\354\367\377"
+	.ascii	"\361ok\360\331w-\373\2632\245=\217\265g\2567o\230N\333\355LN"
+	.ascii	"{\313\003\236 \327\007Q\307\243\t'!\222\252\210\254\022\340\343"
+	.ascii	"H\265\003y\224\032\312Q\204\212bqHAI\031\221QF\253\033NN\001"
+	.ascii	"\214ME\266\330d\024*6\031\243\254\204\337qA\352h\254\242\202"
+	.ascii	"\352!u|\202\232\002\202\214Pl2Z\261U\304)\253)'\244\325\021\007"
+	.ascii	"\262\212\350\2044J\031\211UUPOO\305!\r\246\031\031j\b\035\030"
+	.ascii	"o\024\235zT\001\251\n\240\243\210trr:B\026yP\035s8M\345@\026"
+	.ascii	"\371\3301\274\202\037\247\240\250\226\220\307#\325\022q\352O"
+	.ascii	"F*()(\035\3555p\260\300\301\303\217\241{\370\200\341\003\206"
+	.ascii	"\341=|`b\372\300\201\251=\007&!d\2251\312\251\330c(\307\023\322"
+	.ascii	"jJHU\334\361\304\236\211\351\204\203\030.V\264O\027r \245\214"
+	.ascii	"TSKRG\036<\216OKR\306\"\217\245'\252\252\245\013\t\344\356Y\373"
+	.ascii	"f\314\n\0340,\230\204\217\2247q\027\313\220\t\027 0\027\016O"
+	.ascii	"\217\235\231\221k5\303\206\007\214\224\267\033\326&Q\253SW\275"
+	.ascii	"\320\270;\253\033\323\001`\246G\215\f\365n\355I\333r\273mJG\177"
+	.ascii	"\344,\327\246\267\013I-\217\030\030\333\325\250"
+	.string	"\3311\231|\271N\364\310\2645\271\354\225\336\333\345z\371\225^.FL)\013\200\371\201\320\216\212\322m\310\376\316i\357\332\275Z\356\226\337\265O\247w\255A\240n%\363\003$\2600h\324\206l\332\257\225\264\213E\370E\250\313\252\207w\345\027\013\200:z\222\313\313\236x\366\245\214\315e\257\232\031(\277T\240\3343\241\227\356%\206\351\222\257\233^JC\200|\234\304\251\362{Flf\261j\271R~\247\324\215\231E\347\242\310\311\tC\273\354/\\\373\233%\032\275N\274\\\277)\223;\001\201.\250\2010G\230DdfHD\222$)\f\007\221\005\204\030\347(\354\006\021 \261\224Fj$IR\250\263\034\203\354G\316<\034G\222\n\216\210'\262\362\223\336W\216\242u\222\357&{\035\261\374\344\254\256#[\224A\321\312\331\265\203\001\025\205b~\316\364\371\356x\262\326\301\267\234wQF\250F\352\345O\300\272"
+	.ascii	"7$\323|t\323\016\307\2013\300S*\256\212\026\362\324\242\032\266"
+	.ascii	"P0\222-G\316\t\232\360h\0251L\036\325\244w,\\\366\263:\332\247"
+	.ascii	"O\022\376\030z\003H\346\366\274\271\025PnI\r\361\2355_\226\013"
+	.ascii	"q\330p\002)+\244\252\375\226\f\247vaH\0356\275\255b\230\256z"
+	.ascii	"o\333}\356\265\342[}^\032\353W\373\005p;"
+	.string	"p\234#\031\007-\267T\"\002).8\335\001\032\227\336\020X_F\216\3108L\034\225|f|\371\317\326\313\3000\3546\273!\212\225i\334\276D )\227t\330$>D\303\275,T\243p\336\032\264d)\314\266\264\340\007\022\313\217b<\rQ\227\3343\243qb5#\330$h\365wa0kRD\241:\016\206O2v\bMB\226\316\f\302\236\210\24029\332\247Y\336\300\261\003\251z\316\001*Q\020.AW\336\2324\377\b\361a\247\323\277\212\352\240\300CD\2629\373T\300\001\216t\351d\243\002\373(f\005&u\251h\003;P\273j\017\006\215\002@0e6\rnv\201_pNmH\330\355\032\233\233A\234s\203\022\202\244\3758s\267\317}\234\320\274\"\373\323\225\024\266\346\324S-\254\356\r\355\205GI\313\315\025\240\256\2244t\300\204\177"
+	.ascii	"\303\343\222\222\t\017DUb\373]\251\325&\312\013%$5\204Z-\210"
+	.ascii	"\027\033k\366\257\234\346\372\301\260=\207\177L~r\255\235\315"
+	.ascii	"G9+\206\026h1d_\247;l\006\343l<<\261\334\344\2318\374 \177\241"
+	.ascii	"\354A\364\237\247\327\r\307-|\227\266\333\237\357b4\177\2364"
+	.ascii	"\030\264\220\256F\340P\261\031\272T\0066#\227\034x\3601~\005"
+	.ascii	"N\302l\302 \363G\245\n"
+	.text
+	.section	.gnu.lto_.symtab.1f312921037a518,"e",@progbits
+	.string	"tfp_format"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"stdout_putf"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"stdout_putp"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"uli2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"i2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"li2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"a2i"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1f312921037a518,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
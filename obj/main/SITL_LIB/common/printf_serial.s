@@ -0,0 +1,415 @@
+	.file	"printf_serial.c"
+	.section	.gnu.lto_.profile.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"D\003;"
+	.string	"\005"
+	.string	"\254\277\363\246\017\002\002"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\226\266\306,\003\376\220\273\353\017\b\002\001\002\001\002"
+	.string	"\002"
+	.string	"\002\003\002\003\006\361\201\277\304\t"
+	.string	""
+	.string	"\003"
+	.ascii	"\270Hg\336\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375 /=\001"
+	.string	"\350#"
+	.string	"\003"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\002\001\001\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"D\005o\ti\003X"
+	.text
+	.section	.gnu.lto_.inline.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375 \347\375\003"
+	.string	"2\306\024\037\220)\351\017\211\020\227\210BC\375WP\201\342\355\254\2554\035\273\273\213\232\374]7E\266\224)\237h\253x\376\232j\354\374\203eo\224\366;\024\204\341\250\004\020|L\026\021BaL\2359J\243$(Nfy\003\333\226\374\017\267\275\246(m\001\177\226\004\020"
+	.ascii	"Q3`\n\327\211i\340# \307s:!\240x\016~\231+\270\321\312\342S\305"
+	.ascii	"\370\271\007\250\305T-2\213p\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375 \364\275\003"
+	.string	"\002F\022\034\260%\351\f\3400\005/\017\303J\205\212\034{I\222\005\226\024\027\254m\273I\"\223\f\253\013}9\004H\266\002\t\263\033m\017fO<\342*\2406\364\206\370\f<8\237\020\213<\367\342b\317\356ykY\006'x\256S\004\021"
+	.string	"\020\023\204\314bj\022\224\223\0308d\004f"
+	.ascii	"`0S\020\206\215\bs@\347\376\230\026L\005\360g\t\230i!\312\216"
+	.ascii	"\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\230\004\003\270\004\006\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375 g%\002"
+	.string	"\244\002U"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\004"
+	.string	"\002\002\001\002\006\001"
+	.string	"\003\003\002\013"
+	.string	"\001\002\013\001"
+	.string	"\002\005"
+	.string	"\001\002\005\001"
+	.string	"\202\f\006\005.cO "
+	.string	"\n"
+	.ascii	"8\001\340\216W\331\322\f\356\346E\315\273\027c;s,6\017\240\b"
+	.text
+	.section	.gnu.lto_.lto.51886d0cf7e1f696,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.23.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\265\007"
+	.string	"B\21766Pm\323\001$\203\310\312\352V\251\226#\242\201T\3218\250\204\2011J\227Bk\332<\277v\347o\013\347k\006U]\263\221b\257\257E\303\223:\031\265\337\233\354\235R[\245\f\001\276\254\007\fV3\233\006\207M\303\252fj4\313\35055\f\223\315\253n\246e`\252\311\324\271QZg\365\355\247\215\236%\007\351\023#\f\243\037r\221\216\237a\b\016|w\351s\250KK\243\303\342\003K\366\347\201\361\302\376\264\273\353\350\331\027\375p\252B\027\222]\212R\312\222\244\311Fe\373\320\276\307?\270\213:\037\330\365F%\273\037\202\023,\227\376~\241.-'\240.\315\331'\005\022\002\243\211\021\224\335\235\021\343\334!\347\037\344"
+	.string	"\035\310sXY\330]\303\016Tq\307\333>\260\255`;\024\t"
+	.ascii	"\3202P&\264\356\005&.\024\202!\227`\233\325\224p\207\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_tfp_printf.24.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375`\337\001e\021"
+	.string	"\326 tG\360\262&\035P\341'T\025\355\367\261\273A_\315\272\205m\222V-\353\3403\247\236\324\252\320\264\201Fk#\332j\261\254\006\017R\315`\356\275\312t\272\304\233\235\315{\177\342\\)\375\3317\255\253\352\264\023D\366\2262\245a"
+	.string	"]"
+	.string	"`"
+	.ascii	"\0270\347\213\007\307\2340\005^\300]\032\306\375\305yT6\020\204"
+	.ascii	"VL\321\303\306\207\310\234\263;\271\311v\031O`\273\\\024^U=\312"
+	.ascii	"U\225/\033\022\272V\217\001X\340\\\306\221\326\215\n\022\027"
+	.ascii	"+\256\020\325~J\\-\335\317\216\342BH\350\302\271\216\264\314"
+	.ascii	"9\255\241K\304\275\3356\3116\213\255\f\002\255]\331\260\225n"
+	.ascii	"\216\375\025\035\242\232\367e?v\217\016\373\271M\035\245z\243"
+	.ascii	"ZW\375\222\317fV`6\347MQ\021\032!\371\263\342\261_\246\362{>"
+	.ascii	"3\211=\343>\252\313fZj<L\224 Z\b\007\334\345\r<f\2408i3\236\030"
+	.ascii	"\241\203'\345\322\r\270K\265\037\3432T\207u\b',\240\007i\230"
+	.ascii	"\340\342\262]\356\036H\213\3079\347\\\233(\205\n\264\241\032"
+	.ascii	"kW\036\240\017|p\373\325\265-\274\350\303\321\236\330\334\306"
+	.ascii	"o8\b\251T\332.u\001\3704^\303\344\357\370\202\247\017/}o\273"
+	.ascii	"\374\352\216\235\0220H\320h\221G\232\362\323>;!\370\020\332_"
+	.ascii	"\006}\350\203\320\031\252\005\244\r\2122\245R\036\310a$u\202"
+	.ascii	"Y\227T0\220<\320$\363\002\223By`L\207\372N\247\257\324\241<\322"
+	.ascii	"\251+\2012\235J\002\1771&\260K}\037\330\221\300\346\3675\332"
+	.ascii	"\363\020\242\331\032\317\3049M\260\\\366\327bZ\0247\307\377\316"
+	.ascii	"r\264\\r_\226\331\342\202=?XJ\344\003\272kG\220\240\017\343\006"
+	.ascii	"& \240\002\021\301\344\001\321\300\312\033\355mC!\245:\325`\273"
+	.ascii	"\313Z\234|\226\316\275Y\024\033\301\200\304\211\360\324p\025"
+	.ascii	"YgQ\fX\220\306\306\273\274J\353z\225=\031Kb\321IC\031w\n\312"
+	.ascii	"\301\322\303\212\250\357\024<X\370w'\035\324\304z\fS\332\204"
+	.ascii	"kZ\347\352O"
+	.text
+	.section	.gnu.lto__putc.25.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"m\t"
+	.string	"v\023C70\221\322\001\003\023\222\237\252\026\304Z\206:\306\371\"\204mS\301\232\256\313\260fI\b\243Af$\301\367\321\364`D0\260)\376\230\213\245\207\310\t\266\332o\233H\231R1"
+	.string	"4"
+	.string	"0"
+	.string	"\235G\207'\330<v>\260y\364g\303<\374X\007\031UJ\314\356f\352\361\357\371\3717\271\007\\\241\236\234\207\335u\202+\215[o\033\3016\203\375NN,}N"
+	.string	"KA\313n\306\213f]q%\304\366?\2665m\205\206\357\241\205u\227C\245\265\273 /<\355\217\234\344{\211_.\260\313\022i\355\206 '\004\007m\200\241(\373'G\251\360AL\341\345Ao\363\250\352\331\270\246\036\323+\204\213\252&\225/;D\245v\330\307vw\255,\373\341\217\305\264j\006\332M\267\026\232\020\221\272\221\027!q*\221:SV\342\266\215\323\262\022I\264eZ\347e\241\003s\246Q\227\2358\256\313>\341\036[e9\316\270Rza\200LU\2657.\003\013"
+	.ascii	"2\241\031h`\341Q\022&\242Kx_F%\327\330Wa\260\202\n=\356\360\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_printfSerialInit.26.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375 \353}\006"
+	.string	"R\f.3`m\322\001"
+	.string	"VX\013(`V\310\345\033~\275\234?\310\221\377\233\025D\226\340\003W\315*\273y{,\352\203 \020\330\177\366lYM\351\327g\211\334)\005\235,\f\027\nb4\n\013\033\213\202\031g\275\252z\223\263\250K\345&\250q\226\202\276\f\006\272\315{\320U\262;=\225@\237Q\210\223\021\2454{48\004\374\034G\347\366\001\2429v"
+	.string	"\2041\nI$\326fX\313\214\326\322\3777=m\"|D%\004!\277\305\211\311G(\"\034m]\351\325\2228\333\270?(&@D\377]j\370r\273jwX v07\200\204\377m\261s\341\246\333\032\264=h[\021\007"
+	.ascii	"2\003\346j\006q\241\324e\220\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"e\005"
+	.string	"\302\207\035'\200k:\034\216*\003\320v"
+	.string	"\001#\321t\210\300\207\031@\2140\346\266\201e\340\330\254Ml\333\346Zj\321\215\310-S\335P\372\177\213J\004\0052QS\t2\267A&v\200&f\312e\b\303\223\2053\2055\374\337f\243\204+\210\360\343\035$\232!2e,\033Q\250\340\306\343\336!\030{\331bw\353\232\332R\3478\017\247u\373\301\240\364\377\225\035\257-^\002\025"
+	.string	"K\215\202c\233fY\215\260Mh\236\031\006\250\007"
+	.string	"\007"
+	.string	"\007"
+	.ascii	"\207\017\020\002\227\026X0<{@\240\254b,\204E:\361\355\212\214"
+	.ascii	"W\001\2419T\031"
+	.text
+	.section	.gnu.lto_.refs.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\001\002\001\001\001"
+	.string	"\003\003"
+	.string	"\004\002"
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\006\002"
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.51886d0cf7e1f696,"e",@progbits
+	.string	"(\265/\375`\244\022=["
+	.ascii	"J\231\030\"P@\020\332\032\003\253~mE*\003\001a\277x\302\224\364"
+	.ascii	"8\205>\243\243K!\212\b\224\352\261\004\377\250\242\263\255\267"
+	.ascii	"\265\211\356\240vL2\312\344\232\340@j\361\034\365=o\302\356#"
+	.ascii	"\202\324\007\247\177\336Q\035P{\372\241\b\353\260\007_\236P\266"
+	.ascii	"\224R\336\001\007\002\016\0024\n\304\204e\035\275#`\376r\370"
+	.ascii	"\253\202\326\n\277g\204,\347T?\036\310\300\362\356^V\207\235"
+	.ascii	"\021\255\276\346{\237F\370Eg\303mG\313\236\025\245\367dx8\232"
+	.ascii	"RG\025E\252\365\206[JI9\220\272\312l\230\024\006\330dJb"
+	.string	"\304Yv\243\226\373J\313mm\271\351Z\242[\313\334uM\202S\255\260\252\263=\327t\375\026\320L\200\31409\231\341\337\017:\252#-w\001\302\276v\001B\356!mMw\265\334Z-wU\333m\355\326\257M\277q\357\320k\334\342|\237\332R'E\006\231\263\334O-\267\215P\246m\204\334/\332\232\236\021\262\rBhB\256g\320\372\310\031[\224\226f\303Y^\242\361\231p\316\353\307\234en#\334g28\314\226\314p\266\311\332\354j\006\247\346l\017i\"\375\222\350\"\334e\255\003\007\233\357\277\377\257\214c]\031\"\346,\261g\204\276B\313MB\b\274^\233\204\220\371\270\312\314-/k7\254\342\234\345b\313)Z~\033\204\260\305\332\246\253f\325Y\326i\271\337\016c\356\037\335\325`\300\347\013\351\223\375\277\037\\\256\344\210\363s\026\214\271\201\007Xo\370\337\365\377\004\300\314)=yg\271\201\360"
+	.string	"U\377"
+	.string	"\313\264\354-\237\275=#l\033\204\220\271[x\201\205\314\036\003sW\320\202\t`f\025\374\302\354!0w\007.\2240\304\334=B.s\373,\231{\203\0038\004\263\267\300,\263#\231[\311\334?\314\255\002s\233\300\334\0360\267\005\314=\001sG\300\334:\314\235\303\334'\230\233\001\346^\200\271\005`\356\004\230\033\001\346\036\301\334Df\366a\356\031\346\256a\356\020\314="
+	.string	"s\177`f\032f~c\346\340\365z\27527\007\314\300\026f\231\t\002\321\017\357|\346S\233T\255S\032}\302I\243\304'\265\031}:\253\242\037xd\341\200s\241c\016\257\243<\235\217t$\325\204\022\345\236\257\364\235\3747\231\321CG\374KI\241N\232M}F$\207DT\326\224\266"
+	.ascii	"GDV\322w\312=\267\244\377[D,\376\350\004\363\225{\033Z\2169C"
+	.ascii	"\352_\030\375\017p\364\317\354\227\373\177\346\377\263@\245\336"
+	.ascii	"\177(\342szt\364\357Ds\364RL4\243\177'\273;\213>\251VR\034\264"
+	.ascii	"1\352\364ex\231=}'U\320\226\312\004\373\027\377\337R\332iti\217"
+	.ascii	"\306\325\213\237\016v\3573\002xy\252\301\255\332dU%\363\003\006"
+	.ascii	"\215\254\267\253\005\255\n\0161\250\244|~}^2\372u)\263Oy\r\034"
+	.ascii	"7\224\006\340b\266\304\204\345l\3234\b!\016\016\273\f\020B\250"
+	.ascii	"\323\3732\r\244\n\330\232\024W\235\t\326\243-\312\241>\206[\324"
+	.ascii	"\353POl\224\212w\346\304\376t\r\323\203\342\2547q\325\005\357"
+	.ascii	"\006\324\017g\231\317\231\\\017n\007+g\035\206\307`g\362\245"
+	.ascii	"w\246\023\322\377\2463\311X\371o\312t\213\350\026\301\372\260"
+	.ascii	"\322\"\"d\031\250\3242\273R4F/\f\217\351Qvh\217\0335\326\234"
+	.ascii	"\365$\232 \3274\b\223\263\f,j\203\b\351\264$\261\033\326\265"
+	.ascii	"\270\251\251Z\222\032\246l6\354\242\254^_ME\242\303\321H\230"
+	.ascii	"q\362\032\n\021\272#+^\222\025gJ\373-\021\321\020d\214\253Ft"
+	.ascii	"XO\032.\306I|\247\025\324\324\001\346VS\"C\356\332K\272.\307"
+	.ascii	"\b\332\342\202N\252\275\372\332V\372\n\360\235\262\b\261\322"
+	.ascii	"\3525\346vr\327p@0h+D\354\311\372\3772\2633}\006/r$w\341/\374"
+	.ascii	"\310\211\274\3514\270\323\337e\360g\377\271Q\277}m*\334=t\025"
+	.ascii	"\246y\377\235\377\317\335\305\214\323\327\266\266\024 \030\364"
+	.ascii	"\235WL\003\212\362\230\250\370\375\277\n\004iq4,q\326\343Z\347"
+	.ascii	"T\335WZ{\306\216\344\314\337\202^\377D&^\"'\377t\262a\351\233"
+	.ascii	"R\243\211\033\373\333\313\223\307X\217\266`\020\264\267\2766"
+	.ascii	"\266\341\222\242?$g\331\\\315\327^\254I\327\350\016g3\254;\302"
+	.ascii	"Z\016n\265~\204=\355\310\324UU\026\032s\013\013\221\272\250\251"
+	.ascii	"\263\034\254\321r\220il\314\315\210\314\260O\352+\251\246\251"
+	.ascii	"_\360z\215\303a\b\273\231\227\2351\3350s\326\313\334\213\270"
+	.ascii	"\016\354eNd\350|\275\214\375ov\213\210\351\026\021T\303\321\024"
+	.ascii	"\023\262\034\204\266\314\347d\303\227\371zdBZ\366\362\360\234"
+	.ascii	"1DQ\323\032SZ\006c0\247\372;I\201M\\4M\271\376\235l\334\315\372"
+	.ascii	"1\304\330\251m\023?+38\353a\256\303\261\2204\355\350+A\253\276"
+	.ascii	"<#N\276\276\034H\213=\247\266\374Z)Sk\031\363\261\003\321\013"
+	.ascii	"\316m\345 \262\326\325\305\325\232w\"\276N1%\323\026#Nx\316\""
+	.ascii	">|x\026\373DOi\223*\347\207\034\335\227\337?\333"
+	.string	"\002,U\254jTV<x8W\373\357\235\222\276\303a\257\251\007;\227\2320\351\355\316\313\n\246K\313.\316IK\313\267\210O\224\307f}''\233\240\333\334\334\323\016\366-\027\032Q\314.\035-r}}d:\370\006 \033\322\033\226'=T\021$m>m*\303\251+(;g\231u\342\340~\035\207Gi\336W:\301\f\372.\300@)\255c=\365-E\335U[\366\032n\203\335\006f\266\301\237\332\177(\363\375$\035*S[~\357\004\265a \265eg\026~\023\372\377J\301\367\241DC\356`\267\r3L\003{\304\003!\310\373\357\2215\245\335a\244\031U\363\314\365\317\374\360\357C\237\324*\3463\310\\\364\303\373T\001<u\306?\337\252(+}\377\367\373\235U\321\026\236\257\024\372|\245L\342;\245\314\3777J|\2225\231\375\244VE\237Ti=.\020R\031Tt\221@\310\027Wit\227"
+	.ascii	",\227\307\235\035\243\020\005\034\023\034H!\350\032\177\224\311"
+	.ascii	"\236\032\344\ncqh\371\302\222\250\202\321-\026a\\H*Y\270I \226"
+	.ascii	"\036\343\321\207\345\001:\026\215CE \244\353\203\024ZQ,\022}"
+	.ascii	"\222I\n\212\301\027\334\240\237\013\\\344\317\022\310\250T\261"
+	.ascii	"D\2068\272H%\t/.\022H\203 fQ\"D\217+\224\344q\227/\305\240\036"
+	.ascii	"\327%\205{\\\202\b\201\330\023\344\021;\256PP1\310;H\345\021"
+	.ascii	"\350\250B\313'P0\200\"\247\005\013\347\350\230\3201!\344\034"
+	.ascii	"\035\034\034\035\0248-\243\300\001\272K\244O\3218\304\2424\262"
+	.ascii	"\330a]fQ\342f\251<\016!\225<\004p2\350\250\274q\223I\345\315"
+	.ascii	"\213\362\210\354A\272@G\036\244\313\2628\034\301U&S\020\217>"
+	.ascii	"+\214*\206\204\307\342\221'\331\201\313\221'\371\303\036\213"
+	.ascii	"\037\270\312d\020\314\022(\211t\203\222,G\327\b\002\217\220q"
+	.ascii	"E{\204\001\031B\353\026sX\334V9\3441\0363p\213\r8\340\2034\252"
+	.ascii	"P\036{z\204(h\341\016\207\220\307\235#\b4n\021\005\216\013\204"
+	.ascii	"\024j]\214\256\321\202\026\312\030\245\233B\203\031\306\301\251"
+	.ascii	"\240F\004\0170hwJ\370\030\221\312\343\262\330\343\002!\225A7"
+	.ascii	"@\311\237\237\344\316\r\020\322\370s\263\243\\\336\224\020\301"
+	.ascii	"\302\216q"
+	.string	"\205\217\217\261\202\243\017\017r\330\303\336\220\372\346\020B\205\032\3037\325\203\206\237YKE\r\006\025\036\336Z\272\251\035L\372\354\232\246`\321\361e\355\251])M\361*\325R\225!\316Ba\206\342{\376N\355{\211=\261v[\321\237\fQ\330\367\254\300Iq\326\255\\u\341\212\212:\241\332\330`\370\370{\302\216\367\304\253\301/ \323X\234\233\347\261Wc\356\366\230D\316j}\315P\342\254\337\341%I\342v\022\274t_\\0\177dKEK\330\355\330\353\204@\22781\361&\314-mt\303\017*&\255\3179\235\321\023-\256`\034\211\226\264\247\352\325eZ%+\207\263.\307\325\241\363\013\210\fg]\211C\271\004\201{\250\2010\246\030E\"\"\"\"\"I\222\244\003a\005\204 g\2413\017\022 \2055\315A\350df\222\0242\354w\260\245}"
+	.string	"p\263FD\264\226\003jUz"
+	.string	"\354\3033}J\352\225\340\324@\201di\342*\2709\254\276c\305@\337\337\245e\261'\260y\221\377\310\225\206\236\260\341\020F6\317\363\022"
+	.string	"`\246\b8\205\340z\360rO\r\240\205y\232\034\024\251\261\371\237\303\353W`\3409\032\204\270Y\350P\016w?\202\177\357\342\257\277\360\357]\344\327\215\020K\343\260\363\304\221"
+	.ascii	"\246\2732\222[oRfE\306o\032\\]J7C\267z$\031\f-;\220K\201\336"
+	.ascii	"\004:\326\274(\017\334\244\205Pm,$\256)\352K\311\342\322\364"
+	.ascii	"o![)\f\3264\223\376R\272\327\"\004m\220\f\024/\255]\020\237\034"
+	.ascii	"\260\372]v\343\3743'\232\300\255\\\317\016!\242\334\214U\323"
+	.ascii	"\f\\M\353\004C\211\n\267\272Y\2237\330\003\254dEr\266S\225\313"
+	.ascii	"\025#\2055\270!<{\354fL1\332\231\353\230\257\340\204\027\301"
+	.ascii	"\025\007H\217\244&\374\302Ys\253{`\224\b\237\361q\r\313\356\325"
+	.ascii	"\017\360\320\214/\234\024\316^t\357\317\006\177\231A\233b\254"
+	.ascii	"I\231H\035\231\366\2077IO<\034\t}\340\335\005\376\005\267\034"
+	.ascii	"O\342\256\271U\013\t\3660\335\233\013\371K\027o\211\226\020\310"
+	.ascii	"\315\240\301]@k\"\236\324\250\2303\025C;\016\007\211\226\227"
+	.ascii	"v\035@\212\350\367gS:"
+	.string	"I\342d\272\"j\006\022J@\325RH\222\211<\215Z\246\211\2349\357\377/2\225\306>\274\177N\277\236\037\362\310\3316L\275\260\025\322\202?b^\031\303\035l\222`\360d\323\272\245\264\264\332\035\301#\025+\357R*\006Q=(\264f\365\036\305\373\276\243\245L![\221\237\365\266\023T@\2378\345Uc\027\022\254\255\354/\303I[\207\204\352\324`\004`f\355&\266\n\266\016\240;4-\223\223\2665\224\361\275\235qsO\200P\203\223Rq\352\006\\\354P\355;\200\334\300\274\200O\360\005\032o\020\205h\243\353nW\320w\\77!\354,\327E\205#a(\177+\224\005d\276\331\265!\301\rP\215\251\n\013tR\357&\306=\313lx\306\344\005\nl;\207\250\"=\364p\3720x\336\006\272*;\026\025X\246\030G\036qI\003<w\304'\313N\245\322i\334\341\346A*\257%k\330\\\212v"
+	.string	"\2221(\253\223\245\360\007\210F\001\213\004\035\216K\212=B<\004]I\355\234\336\251I\372\300\336dk\231\235\242\335\220Y\333\033\200\315\353\377\346\314\271"
+	.ascii	"\360\336\034\300[\246\374\247\235\3215\211\005\357\220\315\311"
+	.ascii	"\013\303\n\256Y\251\002"
+	.text
+	.section	.gnu.lto_.symtab.51886d0cf7e1f696,"e",@progbits
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"stdout_putf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"stdout_putp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.51886d0cf7e1f696,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
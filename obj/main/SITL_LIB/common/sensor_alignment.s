@@ -0,0 +1,280 @@
+	.file	"sensor_alignment.c"
+	.section	.gnu.lto_.profile.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375 Cu\001"
+	.string	"\024\0027"
+	.string	"\003"
+	.string	"\373\355\275\203\005\002\002"
+	.string	"\002"
+	.string	"\001\374\314\370\214\017\016\002\001\002\001\002\316\304\261\210\017"
+	.string	""
+	.string	"\004"
+	.ascii	" \200\025\004\20006\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375 \\-\002"
+	.string	"\364\002P"
+	.string	"\003"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001\001\002\003\002\003\002\001"
+	.string	"\002\001\002\004\002\001\020\006\006"
+	.string	"\020"
+	.string	"\007\001\001\201\004"
+	.string	""
+	.string	"\001\002\002\002\001\200\001"
+	.string	""
+	.string	"\t"
+	.string	"\b"
+	.string	"5cf\036\250i\374\251\346U\020\263\330\0042\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\325\004"
+	.string	"\242\b\032 \220)\351\357\213\244\315\244D\200\217G4\237\327>\213\027\273\273\b\277\266\264\375\376\"\262\215\354\275S\277\332\2539\332:\317HHeB\031\214\257\366L*\225\022\232-#\032\025x\370,\333\026\220N\250\361\316\263\221\221\266\006\346\376~5\002\372\005>m\005\343\310\362i\235\3007\370h{\310\037\341\335}MJ\332\">\277B\024"
+	.string	"C\030"
+	.ascii	"\016\260\3071N\263\364D\020\322\204\003\233\201-`\337\234\035"
+	.ascii	"\"n\276Y\314\302\"Xn\202|+\303\244\204P*\\\020\025v\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375 \252\335\002"
+	.string	"b\205\017\030\260%\351\f3\rp\311q(\235\347&IB\034\310\031J\354&\233L2\333\250\252zj/\236Si2O\206/\300u \361|\346\r\206\333\200\271\021[v\313{\324)i\244\361\2340A\n"
+	.ascii	"H(\006\360\302qiT\220\213\351\223!,\005\302h^\t\231\204l\240"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.pureconst.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375 X\r\002"
+	.string	"\324\002F"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\003"
+	.string	"\002\270\001\002\007"
+	.string	"\001"
+	.string	""
+	.string	"\020\177"
+	.string	"\260\204\200\370\267\004\001\002\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002\b0\002"
+	.string	"\0051cO3"
+	.string	"\007"
+	.ascii	"\270B\233\301@]\033\214\266\033\343%\223\001\024\001"
+	.text
+	.section	.gnu.lto_.lto.b36a73d82218a285,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_buildRotationMatrixFromAlignment.5.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375`I\002\215\020"
+	.string	"\026\037mE\360\320&\035\350\030\370\355\246\2618/\2275Ifi\321\221\207\225B\243\202\233\332>!\013v\267\300ke\200xj\342\031\201\277\216{+?j\360D\354?k=\b#f\346\307\004h\236\354\241k\322\310\336R\246\024Y"
+	.string	"R"
+	.string	"\\"
+	.ascii	"8)pu\340\317N\320\256\206\003\217f\340\362\310\226\205\236"
+	.string	"\005O\373%nb\365\032\025R\200u\271\301\240b\267\205\300\t\262G\267>\302\036\263\017\300\036\275\262\201H/\036'.|6vWS\020_=W\376\277\213X1+\317\220\202\335u\262b6\334z\333 \266\033\330\371\005\327\251\220\355\272\210\344HHe\"T\260\307\353\311\fM\rK\276\354\326J\352\214}\270\273k\225\261\337\372?^\363w\304\264(\2463\230\016\3054\026\323\021\246aLkL'L_\200\250\006\201\234\335\f/\034\353\212?#\216\363\333\377\347\016\337\3467\253\007jGx\013\315\221\251(\244\231\222xJ\316bEH'|\240\301\324.\375\207'*\0065*i\206\351>=PQfn\250\332\247\247\260O\201\020\266\311?\324H\306\356\212<\302\217E\303\3471^\300\330\365\310\353\005\344\262\313\002\222\252z\030\022-\371\3625\225\344\002&\310'\337\331\354.\251\023\212\tG\302u(UI\325y"
+	.ascii	"6/I>l\nQq\247\2153A\241\224J\274.\305\235R\032\327m[g\3228Ti"
+	.ascii	"\323L^J\0131\340\216\302\311\323T]\347i\035\255=\\\225q\354\340"
+	.ascii	"b\321\026\247\300]\017#A6\371\362(?\364(\3769`\331\017 \344Y"
+	.ascii	"\036qp\275\350\212E\001) \340\202\031\242q\003v\"\346j\340<\264"
+	.ascii	"\343\030Zd|\f2TFW\243`\356\370\2127\341\313\353\255\251\357;"
+	.ascii	"x\345\033\303\267`\257\027\335\336a\2058\262sq\016k\323N\361"
+	.ascii	"pA\025\214\233ha)\347\030B_\0066\230P;\346ch\333\304x\003\324"
+	.ascii	"J\254\341\205\340\311"
+	.text
+	.section	.gnu.lto_buildAlignmentFromStandardAlignment.6.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"\225\013"
+	.string	"V\025M>\020Q\234\016<\226\341\232#\324\224\007*\004\200@\020oC\205\"3\"S\"k0\255}\321\023\362\377!\246\271A\345\340#\001\200\002\n\267F(\b\256\376\250)\312\375\260w\032\354\266\245L)<"
+	.string	"="
+	.string	"7"
+	.string	"\2247\333#\001H@\212n#\306\356Z:b\313\355Ps\363\003x\334a%\272B\005#\0202\bx\0368Q\321\321\375\364\344\340}2\001Xv\327\031\362<\334\324m?\260\035\301~\203\351C\006\300\220\260\330\355\360Ac;(\016\022\266\037\261\235\337Ol7u\240\201\375\204 A\250NM\340\323\276\211\223\266\2274\374\300\356\250\006\212\335o\201\031T\247\374]\022OUG\020\037\352\fQu\302\351\305'g8\365\252\nWt\"\247\306\r\310;1\352\365\247SJ\264\3508<\371a\177\\\252\b\373\t\362p\361\301:\262_\372\253\233\376\250i\325tj\020\007\005\214\251p\260\314\205Q\320T\270H\320\262\r\226\331XXv]\031\306\3024\227\313\302h\033\253Bqf!\243Y\234,\323\254\310\267\267lP\017\214\031\265R\373\002\206|\310\224r\337].\030"
+	.ascii	"@\025\261I\356\334\034(3 \f[L\330\254\201\350\2607Qm\201\324"
+	.ascii	"\024q\013L0\210;\363\2227GK\327\200b\030\r\204\317\324(\270,"
+	.ascii	"M\215\006w\271\251\366h`j\017"
+	.text
+	.section	.gnu.lto_buildAlignmentFromStandardAlignment.part.0.9.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375`L\003\215\030"
+	.string	"&0\240G\320VM:\325+\240\261\013\326\022L\235O\021\235\270cA#\305F8X\004G\201\362\312M\356b\360\3555&,\316{\240\355\201\202l\323\003\374\321,\0028\034\365\246\2167\f\334\f'\275\275\231\2315b\367&r\247\024\210"
+	.string	"\206"
+	.string	"\213"
+	.string	"\307a{\016\020\235kyP\320\230\340]\302t1>\254\335F\216K\270$|\034\243}\032\257a\273\215\234\257\354\246`\372\261\033\312\\z\201w\351\360"
+	.string	"\346\245\367\226yi_\206\355\232\315\344\341\212\365\261\315f\342\022b5\004\024\222\262\273\257KUa}\027\336]\264]v\032\247\315\307\351\\v\256\335m\341Bt\tD\340vb\027{^\374\\\177\364\030\004I\017\356\347\221\345\363\004aw\355\225\270O\267\355\301\366\005[5\004f9E\257\234\242]3ZeF\267f4kF\257f\264\352FwjF\243\036\376\336\213\356\223\214\2362Z\312\350NF\253\214\216\027\372\357\362\227\245\335\021MK{B\002i\361\242\337\350\321\276\337\343<\374#\243\232ax\326\207\221\272%\2320C\211\223\335\255\340\r\335\037\252\371;\254\262\375\"+`P;\021\3150:\341\216\360Q\300\300v\"Z\267@\017b$q\262\033\306\\\232\202w\251\272\214\027\252\205\213\323\033\001\267\226\252\350"
+	.ascii	"(_\216\245(m\251K\022\b\264R\231\2634@\221o)\310U\272\322\027"
+	.ascii	"\246\017FJ\343\2154U*\200\351sqR\224\376\350\335\013\035M\300"
+	.ascii	"\334MwWG5\310\266*\316\233\310\214\271\247\266\006X|\217\001"
+	.ascii	" \031\371T\307S;=\351\227\200?\336iS\352\324\203@\277\201\251"
+	.ascii	"*\365%\351[\322\323\246j\2473\t\004j:mFU\375gb'6\371\032\365"
+	.ascii	";\036Sb\b\314\335bS\324 \353\374j\n\273\305\213\0013\233\017"
+	.ascii	"3\335\f\307F\002\013\025A\3054\bpb5\260\030\006\233\r3\026nd"
+	.ascii	"\263X\315\354\025\223\301`2\232W\314f\006\366\242\271\231\275"
+	.ascii	"\020\024\260\214C\315\315\013G&\273y\305C\270\351\216\365\227"
+	.ascii	"\032d\224\222\266\250*\305\230\247T\204\314S\372(8\224x\342\024"
+	.ascii	"\353\273\335\335\356\300S\332\242\250#H>\023,j;\303\211\314\020"
+	.ascii	"H\262\273\016l\232\017\251\031\260bw\033\b\211a\360Y\\\3729\363"
+	.ascii	"\362=OV\224E\017\346n<\3570]\272\242\377`\250\250K\273$0\027"
+	.ascii	"? p\002\231cW\007\255\bH9\2230\2717\273OA\356\034\253\"\020\004"
+	.ascii	"\277`,\032\022\254\332\371\245\267\2610\240j1\335fo\362\3311"
+	.ascii	"\334\016\262\020\216 \304\370\222C\375\342\212p\233\031\235Q"
+	.ascii	"\307\226}\217Q\0307&\327R\213\260\2144\212}\275k\036\303\367"
+	.ascii	"`\004\215\322\247\017\334r\254%-W\276\020ra\025\305\355\b\267"
+	.ascii	"\023\251\035\347b\370\005\244\277\314xr~\207\227\006\250\005"
+	.ascii	"\2561\212/\264\303\022\242\332\254\217\247\214\235\177m\030\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375 \247e\003"
+	.string	"\222\005\024\037\240\031\322\001\217\301\375\345\337\006\370\332\307\333\332\023k\377\377\377\017\030\346\326\366\244\374\226\354-S\323A\266M\\v 4\206F\ni\233\341\016\333\376\341R8\001ka\2514\b\027\250T\211\031\034\240~DSRD\376~\302 \333\026\035\252\377G\n"
+	.ascii	"\2560h\b\206\317\"V\231FA0\\\366@\307\2356\001\261u0\311"
+	.text
+	.section	.gnu.lto_.refs.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b36a73d82218a285,"e",@progbits
+	.string	"(\265/\375`;\r\265D"
+	.string	"\272yt\032DP^N:\373\246\321\017\361\215\276\033\220\307\035N\305-\216\350\034\034\017?3\324^{X\353\206\266\305G@\355\230\214\274X:+\034V\303\326\344\220\226\264"
+	.string	"C\320\367\265"
+	.ascii	"\021\306\335 \323\023\223\311\220\266e\n_\001\236\001\227\001"
+	.ascii	"h\336\310|\235i\207\376\360\224\241\273\352\317g\330\214\220"
+	.ascii	"\331\005m\221\326/}_b\256Z\267$\324rw'\345\252\347/\226\216\311"
+	.ascii	"\260\224\3130\230\263\\\221\362\250\233\t\035\2772\274\306_x"
+	.ascii	"J\246\246\361\371u\367RS\323z\366\007\347\\\325\263\0271s\342"
+	.ascii	"x\216\341X\312r\277m\367\222"
+	.string	"\303\274\261[\021P7\264\317\254\273_\341\207:\313\361\030v;p\243\033Zf\240\315\234.\201\200\335\335\244\324\324t\3342\026\310\252W\301\336\004\373\022l\002\016\354\371\313\317Zx\013\2731\264{\331\335\005\202x\320\261\315]\225\333\230\013K\227\270\313\271e/\007R\266\335\362\0352-\347U\217x\300z\013\3549z\002n\372\302W\266F\367\340 /\255\334B\235\331~\316\302jIk\363\331\266[w\033\t\343\352\266\374\\\365^v\002\017X\327\226\007\254,'\255\377\275\374\237\373\357\306\f6\260\206\377(\376\037\370\031\003\322\317+W\370\031\352A\3775\372\031\202\323\3776\377\341\376O\377\313\375w\363\177\357\377\233\377c\310\374,\241\304\177\245\377\201'\360_\007?G\370\271\301\317A?\013\370\231\375\177\346\177\335\177?\377\371\374\257\363?\316\177\276\377h\376\233\371_\364\337\356\277:888\370\363\321\177\243~"
+	.string	"p\002\335\255\363\210\351\246L23*\346dF\241N\244^v\262\243\312#\354\022\352d\252\201:\217\230Q\245\223\271\024s\")1+\273\313q\246|\343$s\331;\274\302\224\315\243)\263\205\366^7\273musAw\030\264\271\247\f\302qZ\323\035ZoJ(\267^ZH\240\275\2342\321\240\335hZT\355e!\331N\273\214\247\311$a\335\265\325m\300\253;\311=\355\356dw\0075\303\332\356!GL3/\257\356\247\222W\207%\345\266\272\257[\2348'3\212\004\n%\327%j\326\\m\222\315zO\254\311F\223l\335\325\335\374\307\2329{\334\371\343'"
+	.ascii	"\234\276\347\327U9p\211h\251\367\305\346\243\017\237\273%M\255"
+	.ascii	"\275* \243\335XC\273\352o\263zX\312{\370o\017\343\341<B\266f"
+	.ascii	"\b\274/~M\ff\247\305F\315\363\263\035\276\303yBq|<\250\b\262"
+	.ascii	"\3478\354\205\362\200\265\001'\255\\\207\361\364\364\301a\307"
+	.ascii	"\362\034\356c)\323\271\332\006\355hwK$T\002\271\203cZ\215\230"
+	.ascii	"im\213\372\340}\355\271q\364\214\344\376L!s\325;\206"
+	.string	"#dk\216\300\323\342\307z\274\306y\215D\215\217\367X\312z_b\327\376\234\320U\315;\334\275l\354\024\001\274\352\033\245 2{\316\222b\330W\030\003E\355\355\250uh]1[\303ax\312b\016W\264l\333\311\212\027E\007\235\033n\303x,\345)\2639\333\261\232\253MMJ<XG\216\032\253\236\311X\225\217\260\237\362\200u\210\323\004\277O\0377\2110o\250\231l\353/\016\177\330\370\001l\346\223\211\310\257\215\233\032#\277I~\221P\270\360>\366J\225<\345U\257\330\213\236ws~W\375\205\336#\277\020\200\263\261\250\025=\354%\260m@\234\316\253\336\"\357\273h}]v\256z\211\274\314S\017pI\230p\r\022<\255\253^!w\bKow\301\336\032\025\315q}\261\253\303\336\006\337n\275@~\203\314\025\031\023\323c\377\373\003L\036\230\231\033\366B\273\034\317qy\260\335Maw\22153"
+	.ascii	"R<X\336\234\277<\300\214\241\261\271\352\335q\233BE\222]\306"
+	.ascii	"\232_{\324\342\004\353Z\243\270?j\232\327+\b\320\016\254\212"
+	.ascii	"W\027\3337\275B\005P\250\016.\017\237\016\376SR\243i`\364\256"
+	.ascii	"za\032\333\227\331\227k\355\346\026\372\325\354g\223\351,\310"
+	.ascii	"\203\277\311'/\027wS\331\317\026\316I3\344\f`?\237L7\216\026"
+	.ascii	":.[\277\\?\205\013\2473\324\255\326\335\007\204\226<\323\004"
+	.ascii	"^\365*\357\215!*b\270\310\356"
+	.string	"\215\273To\244u\351\325\261`iA\362\256*\275Z\ff\375\333{bw\325\347a\277\377B\035\304\340\340\360c\177\245\354\357\277\266\262\331\335<\200\332nj\r\235\201\230\231~\"\026\362\202\026\376\201_\367\0223<\354\031\234\022\354\252\377\023\364\257t'\221\272\355&3*\226dJ\3358\221\332>R\240\243I\232\331\2129Uh\337n\233{)\346\204\301l\241Mf\013M\036\365\022\232\fH\251\f\310bUV\220\225\321\370A\n(\351TN.\212UG$\326\023\221E\226\325T\261\352\351\210\225\365D\300\312*\253X4\026\203\220RD\032UXk\f\343\221\ni,\006\265\030\022\255T$\021\353\212x\265\232H\360)\006\023\234\220\307\341\013\247\343\220Eq\210<qe<\206`aU\225\265\242\351SUGb\221\350\202\275\205(\tQ\031d\004=\203\206\t\032&\254\317\240\001\nJC\024\024\373((!2"
+	.ascii	"\362\212\261\244dT\035\221C\022Ec\025r\2104\036\245^\264H\"J"
+	.ascii	"\025\265 \262\220\":\225\023\026\025rxe@\352E\013!,\242\225\213"
+	.ascii	"\342pE\236\312\301\215/\210\307'\244\321x|\n`ee<\252TS\310\252"
+	.ascii	"\027@1\2063\204YR\036\220\220RQP\310bU\320\241\240@$HQB\004;"
+	.ascii	"\345\204,\022\257\212.\252\254\206RG#V\221\210\365T4^]\031\247"
+	.ascii	"\236\212U\303\253\247\251#\326\223S\203\030\303\243P-I\321tm"
+	.ascii	"\260\354\252\027\313M\373\315\362,\367f\021\016\016\372\351V"
+	.ascii	"\0321+`V\260jy\343eU/\225[\205\245\b\256\025a\262\255\325\210"
+	.ascii	"\004\261\b\006Fa\317\bV\036d\004\353\177\321.\027\035\037\235"
+	.ascii	"1W\275S\356\225r\317~\247\\\263\241e{\247\250\335Jf\005E\314"
+	.ascii	"\n\200\312<QrY\325\253eQ\234\020\201\001Y\303\345\252J,\324\214"
+	.ascii	"\331\337U\225\\\311ur\304\\\372\236L@w\232=\3464\371u\242:\005"
+	.ascii	"\003\267\256z\227\\&jW\033\2219&eI\200^c\3108\260\bll,\007\331"
+	.ascii	"\233(\317\216T\216\372\203\275>\002\200\352\250\221,\206\220"
+	.ascii	"C\212\314\214\210\214$I\322\001`\002\221)3\233\003\022\34055"
+	.ascii	"\016\"\211jH\322\324\330\317\353IU\343\365\233\253:\330\314^"
+	.ascii	"\027\264,\367\355\260\fq\301\366\312\37582\352F\251\205:\223"
+	.ascii	"YQT\223\265\3349\231\350\0306\266\207\205P\201$9,\377\244\270"
+	.ascii	"\242+\033P\031vI%\257\254\203lr\207]\216\251\350\360R\024U4\356"
+	.ascii	">\322\033p 4\357H\203J`\245\003\227DU\"8\3459\320m\231\023\314"
+	.ascii	"\345\240me\002m9-\250\232\301<?\001Z\364\236N \022'\001\030<"
+	.ascii	"P?\332K\266\270\021\320\211B4xu\350\277\242W\257I\247\337\207"
+	.ascii	"<}\350\337>-\3417\376>p\027\0353\305\335\004\f\307\263\314\215"
+	.ascii	"\215\322\345\227\b\230\337\236k\206-\n\204\320\370%j?\3073\235"
+	.ascii	"\330\342L\004\254\271$\350IU\355M\016\002mP\217#\270D;\203\222"
+	.ascii	"\r\262w\226\031Jg\307\245\022-#l*,\321IjQ\0268\302\023\001\251"
+	.ascii	"H\202>\031\255\253/G\222\022\026Y-r\002Y\200"
+	.string	"\212\216\340n\346\302kgL\0010~\033?\201`\303@\022\363<%\223\256\023\337oP5.\220\264^\0176\234\031\260\350\301\235\007\216\337\370\217\350\217\272\212\230\bhI\0049{\230\325\263\360\017\217\213\n\225_\3530j\256\003"
+	.ascii	"\325Y:\332\311&\253\002v\262Mf\013\023^\350\250\b\375\033\025"
+	.ascii	"\330\201\022\357\262\240d\351$\264\210[\2416\273\310\013\354"
+	.ascii	"\223\301\206~D\314\237\f7`\376\275\f\213\"\244\211h\353f\331"
+	.ascii	"\201\320\034\250\374r\201\273\347C\347\026\350\331\344]\371\001"
+	.ascii	"\345\236\372|\360\221E\274\346\237L\001z39\214\222\254\212\250"
+	.ascii	"\303\355\373\247\272\227\232,\252\303p*\256\365O\3307\343I\277"
+	.ascii	"\356\325\256\332<\271\375u[\256w\310\257\332Fq\025"
+	.text
+	.section	.gnu.lto_.symtab.b36a73d82218a285,"e",@progbits
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"buildAlignmentFromStandardAlignment"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b36a73d82218a285,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,781 @@
+	.file	"streambuf.c"
+	.section	.gnu.lto_.profile.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"E\006"
+	.string	"T\b\306\001"
+	.string	"\023"
+	.string	"\271\352\202\310\n\004\002"
+	.string	"\002\001\001\331\205\355\260\004\006\002\252\337\376\202\003\f\003\332\333\323\265\005\030\004\217\273\217\234\013\005\234\225\205\264\f\006\347\301\343\350\b\006"
+	.string	"\002\001\007\311\244\360\314\013\b\221\344\270\264\005\t\365\250\256\225\004\n\275\227\373\\\002\002\002\013\275\240\345\300\007\n\002\002\002\f\207\236\200\376\r\022\r\366\264\360\365\001\016\257\241\227\210\017\276\237\344\233\016\002\020\003\021\226\210\313\347\b\022\345\362\340\204"
+	.string	"\034"
+	.ascii	"f#5R\332\\\352B0\200k\265\314V3\037\030\025\001\b *\306\027\003"
+	.ascii	"\234\005\240\240\2556\r\216\002\216b\363\034P\030!*YX\n\200@"
+	.ascii	"(`/1\260y\205\013W&\231]H\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"5\004"
+	.string	"R\305\017\025\240'\351\377\377\243\377\377\221\267\277\377\237\374F6\331\204\310\235d,\020Z\364\327z\320\272\333L0I\367\213\335F7p"
+	.ascii	"\2350\266\341)\n\217l\216\202\224\311{\213\214\322\244\313\322"
+	.ascii	"\300\017\001\" \360\"\013\256\033`\213\213\354,m\340.[\372{\212"
+	.ascii	"\001\242\301\271\312\305\366\013\367\177\276\3426\031LM#h\204"
+	.ascii	"\270\2318o\323\323m9\201\031\006Hy\307l\355i\226\303\220\201"
+	.ascii	"Bx\r\342\216\024\211\026\206"
+	.text
+	.section	.gnu.lto_.inline.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\314\004e\f"
+	.string	"BN)(\220'I\007\277_yE~\237|\362\205(\371!#k[\003^U}w\373CTD\310Z\333\232\265\215\264\326\366\226;\005\377\001\267\203\225"
+	.ascii	"\034\343\177\354E\343`\335b\300H1B\333\204w\346\365!\005\r#\b"
+	.ascii	"\221@\230r\260\230\271\241\320\330]\304\036\332*N)\035\227\272"
+	.ascii	"\241`\277s\214\031\317]b-,\032C\333\304\212\222\244t?x\217)\220"
+	.ascii	"\363\220\001%\302\206\266\004\333)\031\363\020\027\3322\t\253"
+	.ascii	"xA\350\320\266\2317o:X\214~\330\275M\326uA\313\305\371X\372\007"
+	.ascii	"\371\005\261m\223\0278\211\002l\250\200V\215$Ia9\200\002\221"
+	.ascii	"\031\263\335\022\300\243\035\305q@\303\bS\301\004\022c\243\244"
+	.ascii	"\240\254Bc\217\b\b\261\225N\252\005\"\264\330|\037JW\367\t\326"
+	.ascii	"\355e1\356{(- iy\373\007P\0263\326\275\027\356d\307k\030g\235"
+	.ascii	"]\221\t\">dc\322Y\035Tr\274\342cB\325\361i\351\370\"\346W\313"
+	.ascii	"\311=t\226\232\377\002\270\b\326\230\354\2251\375\2305;>\217"
+	.ascii	"R\314O\riH:\324\314\351\353S7\256y(\027\244H\004\241\242\276"
+	.ascii	"\361\007\336\347=E<\034c~\242\362\250N+\263\f)\231\277\254\200"
+	.ascii	"\336o\024\240\0258i\354\220\212\211\214\370\212\334I\351\004"
+	.ascii	"\363eE\230/j\013\241\273X\246D\n\f\205e\3068 \350\025\253aP\336"
+	.ascii	"s\217\344\377\314\f2\206ftD\\4x\026\300\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\005\001\275\005"
+	.string	"\322H\032 \240'\351\330\377\266\375 o"
+	.string	""
+	.string	"b\214SU\365\317\027\3775\263\377\375\366\267\326H\333\204l\231v\326\002B\270\001s\355^\260X"
+	.ascii	"\260\334\274W\222\242\322\336\\\276i\306/\376<I\277\211@\024"
+	.ascii	"k\255\225\224Rjs\340m\331\327\326\300\303\375u\3664\366i6C\244"
+	.ascii	"\231\020\021:x\250\211\371\336f\2337\023\377\231\301~\004! \240"
+	.ascii	"\242\252Q\017\240`\345\ns\231<\242NbA\234!y\204\001\004q\bV\377"
+	.ascii	"\312\306\025\003kd(C\"\002\370\007\030r@73\207a8&\217\261\314"
+	.ascii	"\005\271\224\204~ \2036\273\0227\266\340\nF\301v\341\341\262"
+	.ascii	"\202\017\001"
+	.text
+	.section	.gnu.lto_.pureconst.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\b\232\004\t\232\004\n\232\004"
+	.ascii	"\013\232\004\f\232\004\r\231\004\016\205\004\017\205\004\020"
+	.ascii	"\205\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\034\002%\006"
+	.string	"B\307\031$\220)\351\260\327\335\335\242\233\205rw\027u\247u0)\027l7M\364\347\265\017~\333\376G\2154B\310\226)'\034\222\202\035A\355\210!Al\203\303\302\302\356\270se\t},;X\017\312\233L\277D\036\3454\202o4"
+	.ascii	"@H\230N\252-\324\302\226\302\317\323a\357\353\353;\277w\304\336"
+	.ascii	"`o\020\365\341\347\261\022( \260\"\031\235m1\001_K.8Yn/\034N"
+	.ascii	"<\030\343\004z\302(\225g\276\266\307s\306\302d/\221Vt\207\231"
+	.ascii	"\235\236\274\331\273Y\242\31491\300\177\035\\\032T\036\230\034"
+	.ascii	"\250\r\2224(z\200\303\201\026M2I\001y\035\b\301\005\b\260\324"
+	.ascii	"\301@\343\251-p\031^\021"
+	.text
+	.section	.gnu.lto_.lto.a4dde660b785a8ef,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sbufInit.3.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\275\t"
+	.string	"\346\321A;0\305*\035"
+	.string	"\276\374\021\205?\204\267 E\374\"{\336\030\220f$\215\225I\037\254\214\265\030\325;7\223\201\204\361\233\332a`\240\001GA\315CZ\231\270~hhE\335M\356\224\0020"
+	.string	"0"
+	.string	"/"
+	.string	"\006\223\343\325\211U\320\002\354N\351\371\002\313#\346\032\313\243n\374;\374\374\213<a\244\244\345Z\035^\032v\327\260\345z\335z\333\n\266\031\354/\004\227\375\360\"p\241\261\355Z\334\006l-\242x\330\276m\225\235\261g6\017\234\251\224\016\274\354;\301.\f\344dwn\274\301<\332\366C\036S\371\013\024\216j\243n\"@\325\2168I\n\263\273\036\2376!1"
+	.string	"\240\343\321\377,\217\b\031\037\030,x\263\347\n\252\206\375\312*\314\376\354\217\237\277\006\016$\221z\247\222\216P S\305!\316\b\005\342>\"\357d\222\244\216\343\272\220$=|8\031\362L\222s\340\256$\362\344\251\353<\231\231\373\312*\f*\204\253\306\322\023"
+	.ascii	"2\241\033\f\354\376\2025\312\001\330\305\264\231\261Y\314\205"
+	.ascii	"\374Mc\0130\002\306\201a \bP\b.\003#@\335\013~\346\351\264\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_sbufWriteU8.4.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"e\n"
+	.string	"v\323F= \005)\035 \027\013!@3VH\302\301K\f\340\362\320\002I\2267\004y2O\025\265\037\267\311\377\255!\220\334\260\033\335 \200 \020\200}\264`\252"
+	.string	"\002%C\221\316\223A\b\221;\2453"
+	.string	"4"
+	.string	"5"
+	.string	"\006y\347\\\276\240;\347\235\240;g\322\2661\270\360\270d\254\004\330\335OCN~\222\376Q\316\201\305Z\237\002\017\273\353\t\213m\334z\333\t\266\031\354+\004\357>\373\267mzn\323\36782\237\231]\215\332\200\245q1#\266\337\261\255\323^h _\256\254\273\036/\242O\373&?!?c}`WV\002\263[\202\002\335\271O\r\307T\026\017\315a7\242_\247\036"
+	.string	"\006\311\313\343UT\336\356:\370))\224'\302\352\316]\017@\004\314\\\263f\227\255\251\037\366\267\335]\253\314~\371\024\243\224\236\306\b5)$\201\202"
+	.string	"G%\3614~\246\020\004C\322g\232\030\201\037I\034\277\020\202\303\212\222\370\235\302P\374:\345~[\225\231\353\240\271\364\345N\375\026\213\325\364U\001\022"
+	.ascii	"2\241c\034\030.\254\244\346\024\025\b\002\213\3124\250\322ee"
+	.ascii	"\323R\003F3\261\016v\225k@T\030\f\346\006\250(\341\016/\332I"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_sbufWriteU16.5.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`v\001-\016"
+	.string	"\206\332\\C \217\223\016a\026 y\026a4<\225\310g\264\0137J\004g\002\326\2705\005\360\200!\367\023/\267\2013\030\236\326lA\300N\034\030+\005"
+	.string	"\234"
+	.string	"\b\032\211L"
+	.string	"\221\"\360\336tH\255\221M6\2212\245G"
+	.string	"D"
+	.string	"L"
+	.string	"\330!\200|\332\017q\021\336M&\017\260\253\002\002\305\356\3071\007;\364w\217\353\020;\307uh\317v!`\202F\f\251%\306\356j\252\341\336\323\363\177\272\246\204\"\341\031\017\354\256\263\204R\341\326\333&`\273\200\235\034\001vLobZ\023\323XL\307\233\376\353,\277\005\323z\245\023\246\277\221\241<\\v)\254f\254\f|\341`\373)NL\313Q%'a\270\301\303\356f\207v\211\235\035ff[\277\217\360\316\022\301p\367\302\n\220'*\365]D\034\370+\376\347:\354\230I\331\350\211\217F\213\227^\200\\\243\033=\214\223\016\243\\\371(o7\361\301v\327\200_\242\343\374\025\223\353P\243G=-d\220a\262\364\232@\005I%\312\225\375\215R1\330\267vw\255*\001\"\035\b\032\002-P{>\030<P\260uB\272\020H\033\341\266\215\363h#\r:\233\346\351@\332\307"
+	.string	"s$!\235\026\342\270N\313>\321OG\360AF\244#+I\307L\212\246\210\212\245\274\375\345\203E}*U\365$\025v\303\\\226\246\376\364\204a\021! p\002\031R\326\001b\300\031>\221\260\\\nD\\\0031\340w\257-\203u\f\340\035^\022\311`>\262\005A\3028\332se\247\f\355\362\243\260U\216\253&\006F-\303Sg\303N\305"
+	.ascii	"\030M\3744\355g\217~Y\032\034\035:\274h;\031"
+	.text
+	.section	.gnu.lto_sbufWriteU32.6.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\306\002\245\021"
+	.string	"\026\340nE"
+	.string	"\261&\035\320\013l\375g\006\246\311\031\377(\375\017\345\177\253\323\256\337\222\353\205P\314\315\204\210\030\331Q\215\311\234&V\322=\257\312\226\340_\372\273\004(\365H2\376\315\345\365P033+=\222\2667\2212\245X"
+	.string	"S"
+	.string	"^"
+	.ascii	"\334\241\306\331\316\330O\274n\203\301\037\273\037|H\266C\002"
+	.ascii	"\332\323~\211\233x\275F\345\247\335\030\022+vc)\247\266C\307"
+	.ascii	"\036\022\017\267\007\210\207~\3318D4\210~Zpv\354n\247!\376z\276"
+	.ascii	"\374\337\374\303\345%\3033\224`w\235./\034n\275\355\002\266K"
+	.ascii	"l]\005\327vw\2551vL\243b\372\024\323\246\230.\3054)\246G1-\212"
+	.ascii	"i\356"
+	.string	"5?\200\333\374\233\226\016\301t\324\322\020\2465-\2550\235Z\372\002F\262\220\331\356\206Y\217\005\202-D\330\376N\217\316\201\0169%=8\227\245\034\205!\315\210\335\345\016\355\024;9\366\016\343\333J\372\234T\325TK\320\375\"n\232\372\233\033\220\341a\tR\337\005\003\226?\343\177\361\020\344\006\fJY|\"\033w\311A\362\223\242\364:XhVr\346\313\354\235\347\333v\027\201\257BB\005\177F%\036\236\364\262\247\007\031\0365\233^\027\244h\t\202\345\314\216\255\244\202\260\003\023T\027\324\365\231\250W#\017,8`\251NZ\256\257C\361X,o\325\241DP\261\272U\353\353F\006\330\243p\322\352\\\236\327\352\270\030\354\332j\214\177s\005>@0]q\b\202Hkp*\332\261w\032\234~'jH$\316\200&$\375\031)I\307\336e\214\364:\232B\223\026C\033\200\334\2001iOIM\001: "
+	.ascii	"\003\2211:\006rB\237M\201\031\311p\r3|/\326:\360\213\262=\220"
+	.ascii	"3\330!\347\022\230\001k\317%\262\003\254#rOr\007;\344\\\202\031"
+	.ascii	"\030\256r\264\347\022\266\203Q\330\204\227D2h\034V\026\004\027"
+	.ascii	"\306\326^\333\354(C{\374P\311*\207\253\246\206\3212E\356\213"
+	.ascii	" o\206N\235\036vB\f`\321D\247\301~vt\227\245\261\321\221\207"
+	.ascii	"\027\255'\003"
+	.text
+	.section	.gnu.lto_sbufWriteU16BigEndian.7.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`v\001-\016"
+	.string	"\226Z]C\020\257&\035A\335f\332\316\023\220\260\226\177j5\013\373\247\352Q\325"
+	.string	";<\252\003Y\033\306\352\35760\3474\327\232\r$\300\310\210~\240"
+	.string	""
+	.string	"*X\320 \022K\002E4q\2445\321\232%{\267\2252\245G"
+	.string	"F"
+	.string	"K"
+	.string	"\037\327\037\200|\332gy\b\356\250\222\007\330My\201\331\355:\334q\375\271\273"
+	.ascii	"\370w}\003\376\231\263i\b\\\310\2401\271\274\330]L;\234{r\376"
+	.ascii	"S\347\234N,<\343\202\335u\236N2\334z\333\006l#\260s#\232b\307"
+	.ascii	"t'\24691}\305t<\352\207o\37170\2550\235/}\r\r\225\001\255]\f"
+	.ascii	"\255\030+\363b<\330\376J\201\n\227\253H>\302\217\005\304\356"
+	.ascii	"z\376l\022\333\363\227\036\333\332]\004\367\226\n~\273\033Z\004"
+	.ascii	"_\361C\360\217c\006\245\243&B\031,~r\361q\216v\3645&\037J*g\177"
+	.ascii	"\t]\273\233\300/\261i\376J\t\374\343\350UO\r*0P\327\324\233X"
+	.ascii	"\244l\371\272S\300\215^\033\2200a\225\262ew\245T\016\3667\273"
+	.ascii	"\273\016!\037\n:\022=P\203< Lp\220}@\266\221\b\023\321\262L\003"
+	.ascii	"a\"\021>\031\006\332D\230G\001k# \0336\322\264\r\363t\244\247"
+	.ascii	"\316\240F\206\244%\353\b\307\f\212\242\210z\255\234=&tE\375j"
+	.ascii	"\243\252O\375\300\212\023&V\252\017\023\"\301\001! \200\002\221"
+	.ascii	"\312\353b@\035>\311\260\\\005\032\327\376\230/w\357\226i\035"
+	.ascii	"/xG\220D0H5\016\303\325\236Bv\226a\300~\333\206\232\255\032,"
+	.ascii	"O\f4\260\002M\230F\230\214\0014\232\370i\331\317\036\365\262"
+	.ascii	"\2645:rx\321\0322"
+	.text
+	.section	.gnu.lto_sbufWriteU32BigEndian.8.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\314\002\005\022"
+	.string	"\246 qF\360\320&\0353\330\262\360`\351,\306i5\260m\247\373hR\377\031/\r\246\211Njk\210dH!]\f\220\242\"\261\022Y\350\277\374y\016\213\303\244\303\343\217\350\007\205%\377\230\027kkk\342\237\330\275\211\224)\005Y"
+	.string	"U"
+	.string	"_"
+	.string	"6w\250q\266\023\366\023\256\343`\260\307\356\207\031\"\333\241\001\355i\237\304K\270~\263\362\324\356\214\354g\027\266\362j;4\354\002\342\341\366"
+	.ascii	"\361\320.\233\006\210\006\022\221\313\216\216\335\355\264\346"
+	.ascii	"\256\247\313\177\316=^`2<G\fv\327\371\002\303\341\326\333>`;"
+	.ascii	"\201\255'\001 \354k\273\273\326\031;\246U1\235\212iTL\237b\332"
+	.ascii	"\024\323\245\230&\3054\367\233\037\300q\376\r\246G0\035\2654"
+	.ascii	"\204iMK+L\247\226>\001\021\232\0015v7\314\210V\b\002\205\260"
+	.ascii	"}YP\317ubx\026\004\355<\246r\035C\023#v\227;\264U\002\212\342"
+	.ascii	"\261\367\025\337v\322\363\250j(\325\347\034A\315,\325O\321\200"
+	.ascii	"\345\333\370_<\374\030\222Q)\320G\222\361\027\033\"O\251J\217"
+	.ascii	"\243E\304+f\357?\337\266\273\n|\037\t\025|\233\225x\230\322\307"
+	.ascii	"\236\036hv\334\\SW.E,93\310\255\"nz\035\325\344h)z\345\314\206"
+	.ascii	"\275R\003\023F.h\312W\242&\t\201`\341\001k\304\244\225\362u("
+	.ascii	"\036\213\345\221t('#\254\216\244\365u!\005\354Q0iu)\236\327\352"
+	.ascii	"8\030\313\265\325\031?\347[\254\203\020\213\276<\212@\322\030"
+	.ascii	"\234\222d\366\016\203\323\3136\035\265\210\361q)\212%&}QRS\217"
+	.ascii	"\275\273(\351{\240\306\rj7bPh\016>\206d\224\305): \340\002\021"
+	.ascii	"\262r\frB\267M\2011\236\201\335\266\366\\b;\300\332\210\334\330"
+	.ascii	"qh+\265,K\034\210\370\024X\353\300\017\224\357A\356\303\016C"
+	.ascii	">\f!\f\214\001q\367\266L\3261\n\357\260$\300\351\273\022b\376"
+	.ascii	"\301\204\341h\257Wv\224a\204\375\306\r\317W\341\256O\r\r+\354"
+	.ascii	"\303f\2118\336\002O\230\21009\006\300h\342\323h?k\224\313\322"
+	.ascii	"\364\350\330\341E\233\311"
+	.text
+	.section	.gnu.lto_sbufFill.9.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\f\001\205\f"
+	.string	"\206\030UA o\233\016#\374D\b\210\"P\030\254\r\0070&e%\366\200e\357Q\007C\222\003\232R\205\210P\322@Px\365\033\253Z~"
+	.string	"\202\300P\f\376\220\205\370)`\024\330\001\365\366\337\237\354-eJ\001@"
+	.string	"A"
+	.string	"?"
+	.string	"\027\241=\344q"
+	.string	"\273]\211\312\256\267\361Fz\264w\001\321\243\364"
+	.string	"\321\2435\273\305=\222\275\311\004\021\224\030\273;\351\206kO\315?\312/\334\310\366\264,\330]'7R\341\326\3336`[\201\375.'\177\024\3231\246aL\253\246\023\246\257\211:\254\030"
+	.string	"c\227\302'cW\"\212\022\333\317\330\326\0217\321~\342\024\276\354fP\241\262\273\033w\244\307\002P\323F\220@\273'\301\272{!\345\300\323~\210 0yMU\265++\3179\203!D7\333\021^\242C\332\335\216O\202\003\2238xD\217\252\032,B\026M}\244W\214\205Od\306G~\266\267\245j\260\017ww\255\235\375\320\177\271\367[\036\240\017\207R\031\265\0013lC\355\3418\350hPQ\237+\303&\220UU\226g\002=\240\252\311sa\023\207\200-\b\237k\312,\353\2322\336\036\256vf\340a\345CA\034\365\204\206\344\234\213+\324\250\177\021\362\001$?\023PuK\t\027"
+	.ascii	"2\241\037/0.\020\302U\203\301P\345@\225=h\031\327\204\007\342"
+	.ascii	"\b\307\232@\032;.V\2039\366p\r\343\207y\201\300p\005$\214\005"
+	.ascii	"s\003T\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_sbufWriteData.10.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\035\f"
+	.string	"F\227Q@ o\233\016#|\231\242A\034\006\322\201^\263 \264.E*\240D\024\037dC\036-\030y!\"\3244\004En}\003e\363\017@\020\030\212\301\237C\267r\325\n\006o\202d\326\237\354-eJ\001="
+	.string	"="
+	.string	"="
+	.string	"\033\017\260\373\0211\331\375.\276H\217\376> z\224. z\364f\263\370\027\262\037\251\360Q\362bw)\315\360\355\271\371/y\245\003\341\236\024\005\273\353\354@$\334z\333\007l'\260?!\336O9\311\037c\032\306\264\306t\302\364\247\310KA@\305n\204\020\214=\211&6\330\376d[A|d;\211O\270\262{\001d\262\273\027g\244G\0030?\203P x\332\027\271\207\355^\252\312\225\350`\311\253\244\251\266u\345;O\026<\224\263\r\341\"4\244\335\315\370!<\231\244a#zL\005\260\302\213z\265P"
+	.string	"}\304\340\310\220\375q\251\030\354\303\335]\353\307\376\367K\017\035\316\003\255\264j\003\265l\243\326`\032h0\260*\016\246eT\347\262\254KCu\034T\026\245\3012\nS\300\227\207\203Q\332ua\324\364\355\341\352\307\013>\234ph\207\241\222\310\by\327\342\252\n\365.<8tdhD\030"
+	.string	"2\241\037/0.\020\302U\203\301P\345@\225=h\031\327\204\007\342\b\304\232\340\031;`\332\035\\\303\004\314\274@`\270\262\204q\203\252\001\367\300\260"
+	.ascii	"\025\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_sbufWriteString.11.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\026\001\275\f"
+	.string	"\366\330V@\020q\233\016+\330<FH4p\022W\255\261\362q\220rRy\260\266U\006\305@:.4\267\337(\341Ou\0247r;\374\377\023@\001"
+	.string	"\024\301i\202p\273UH\033\006\332M\215\354nR\246\024B"
+	.string	"?"
+	.string	"D"
+	.ascii	"\037q\022\334=\"\027\260[\342i\261\373Yl\231\016\375\235@<"
+	.string	"\234> \036\232\263m\3743\331\243t\0301\221cw-\345p\356\311\371?9\345\221tO\211\301\356:=\022\f\267\336\366\001\333\013\354\203\b\321\356\256\265\304\216i*\246\247\230\226\242t\274\347\207\377\376\b\2463J\277\022a\314(\220\262{!\244cA\320\305\007\333\367Q\376\ty\t7xQ\035\332!vu\370\312v~\025d$x\332\001\032\251\244\376\007\003\222\367\\i\350h\347\177\234y\nm\332]\005>\212-\202\357A$\036J\032\200\206'5\352?\317\f5\256\251\226\221\035\233\f\231\312HmlB\336\273\"\350\244\200,hg\177\234\324\r\366\003 \232L\266iq\323\036\250/\036\020(8\270>0\331\246Y\032\354\272\260\213\245\311|\\\326%\323,\017\003\306$`2k\303\260\314\252\276\315O>\235\210\001\332(\307\224\256\320*&\367nD\235\224\322\343\350\204\340dH\305\244\332\261\020\001 c\027"
+	.ascii	"2\003\302p\331\302^l\2443\\\304)\031\244b\0170\266\025\302}="
+	.ascii	"]5&}\332>0~q\031\0034`\035A\255p\037\250\006\256\200\271\001"
+	.ascii	"*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_sbufWriteStringWithZeroTerminator.12.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`9\001\255\r"
+	.string	"v\233^B q\223\016\254\260O\b\203e\216\350a\220{WWTJNi\201\256\204\300\b/\247\211\255\330\255u\206\022\276\031}$\t-\336t\032P0\240`r\021\350@\306 \221q\273\202\324\032!{\023)S\nJ"
+	.string	"D"
+	.string	"L"
+	.string	"\001\366\3444A\301\323~\210\213"
+	.ascii	"\335dr\001\273)0V\354z\031g\256C{'\020\017\257\017\210\207\006"
+	.ascii	"\3313\356\251\354O\034J$n\354n\246\032\016z"
+	.string	"\202\374\257\374\322\241\204\236V\203\335uv(\025n\275m\004\266\031\330o\021\366\253\335]k\212m\2451+\215\261\322\227*}\335\364[\367\376\030\323\025L+Lg\225>\200\310\362\302\300\267K\341\303\261)\310\242\203\355\373\247\243J>\302\016\\|\330]\354\320.\261\261\303c\266\323\223P \371\316\030\006\222\206|\224C~b\344\332\335\005\276\t\021\216\277\301$\036^\324#\206\251\322K\217zZ\220\241Zi\246\324\":ILU=\351\302(?_Sa\216R\213(?c2\252\255m\371\356\232\200D#u\242!\333\033\245f\b!\035\016\367\361\304\217\007\202Z\363\021\201\344\201\006\262\341>\236\254\263i\332\246\311:\034\020-\323p\236\354\343\2007\221\r\227}\266\215\3130O\364\225_%j\244D:2\246)F:T\336\261\\\212QLo\203\344a\224\037\n\214jH\005\b\217\2744\352E}\224f\023\026"
+	.ascii	"2\003\3020\300\206\325\331Hg\270\210S2H\305\036`l+\204\373z\032"
+	.ascii	"oL\316\264=\251\341\"3\300\3442\007\320\020V\270\017\224\bF\004"
+	.ascii	"\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_sbufReadU8.13.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\325\t"
+	.string	"\246\022D<@\305(\035\320\251\330\255/\324g\346\367\351/\241\020\366\205\310\315\312\256~x\233\223 \211\331\206\262\372\210\377)J\026\226\215\245(\212\216\352S\214\214<\304\211\256\0259\223\277\273\311\235R2"
+	.string	"1"
+	.string	"4"
+	.string	"'\230\227\266\275\300p2\370\360\305\232\034$\027*\005v\303M=\016>\202\376M\216\031\331\030\260j\241\0363\016\273\353\270je\334z\333\b\266\023\354s\002\217\375\030\215\216\032\375\314\224\275\024\004\330e\315d\353\"[Bl\237l\215\355\030\355\303^rz\314\364\201]\027\214e7\354\270\243]:<g^j\001"
+	.string	"04\242\246l^_\021P\3705j\024`!\2422\351(%mw\033\374\223\t\n\r\344\3227\315\313\353\346#\226\2123;DE\355\260\217\331\335\265\272<\003\334'Rs\036\b\322C\367\001}#\321\026\362\272\316\343\266P\304\247\333\270O\264y\f\354I\200\276m\344y\337\246\t\367\236z\220R\225\375\225\nP\363K\363r\352\003\017"
+	.ascii	"2\003\302\260\027s\212\251NE-\202\305\242\212\r*wX\355\244tA"
+	.ascii	"\226Y\267\013*E\265\207\352`\306\324N2"
+	.text
+	.section	.gnu.lto_sbufReadU16.14.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\232\0015\017"
+	.string	"\006\336eD"
+	.string	"\2576\0353\031\003!\232\007\n\324\277o\r\323\370\340\033\255Y\267\001\332*4\020}\244\370\016o\260\3046\274\027\024\330T&T\302\332\236PUU\325/\211s\310\3479\250\202\266\377\007\377}lB\233H\231RP"
+	.string	"O"
+	.string	"T"
+	.ascii	"\217\356\3102\355\237.\"\364p\344\001vON/\273\341\2067\262G\207"
+	.ascii	"\231m\037\304C\204,\312\020\245"
+	.string	"\302\225Z\201+2\273\341\246\361\002\327c~\300\365\250\033.z\212\374\247n\251\230\\\224LH\236\030\203\335u\226L,\334z\333\tl{\330\351\021WZ\303\322\233+\235q\324\235Yi\354\341\177\305\264\025\323\032\323i\245\257\201\231T\030p\331\245P3\2630\361\004\207\243~\373\253\021,T\276r\225\255Y\344$\254\035bdvW\023\261\265\307\264C~\312\232\217\022e\373\222\201)\226\027\273\241\202\334M|\270\246\031\372\325\005\334\305\001\004?\305\377\256\307\216>f\002\006\216\266|\004P^\202\321qM9\232-J<\220\262\306W\231{\211/\333\335\005>\213\327\371)#\327\243\246W\035\001I\212\030\247Q\326\330!)U\203}kw\327zbc\351\316\225\346\004\240\217\247\036\357S{8@$4\340>>\036\350\333B:\216\353<[\310\203\017n\363x\337\306q\300]\204\217\267\201\272\316\333\264pt;S"
+	.string	"`\006\230\221\222li\246\232j\351\301\013\035U=\246\251o\001i\262\033\305u\305TcJf6z}\352iZ\001\322\214@6\016\037"
+	.string	"2\003\302\260,+\324\235$\227\n\357eb\253\361uLx\030v\204 \240"
+	.ascii	"\322\200\232x\260\205a\022\006\316\301\302P\326\236j\263S2\264"
+	.ascii	"\225_\210Y\234\271\240\001V\2002\350$\003\242]\034\\\314\247"
+	.ascii	"\316A\273FJ\212\351\232d"
+	.text
+	.section	.gnu.lto_sbufReadU32.15.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\312\002u\022"
+	.string	"\346bwF\340\360&\035\352/N\237k\345\312\004<\0132\013\307WeF's\203r\314\213QWu@R\225}\017\276G\211bGL>\257\261\037\030\202\f3\254A\036\226\311M(`\025\210\353;\262\033M\254I\333{K\231Ra"
+	.string	"]"
+	.string	"h"
+	.ascii	"\227y\363y`\332\213\005\355\204\254\210\306\234\037\202G\227"
+	.ascii	"h\252\366u\276\343\362\257\345\2529mt\206\346\374F<\242=\372"
+	.ascii	"\323l\373#N\302\3050\370\335\320H\031Q\254gi\316\217+p\226|\204"
+	.ascii	"_\311\307\355p\330\025\346_v\230S3\233\241y\271\232\026\3149"
+	.ascii	"\25534\027\356\275\355\003\266\023\330{\0226T\213@5K\252WQ\035"
+	.ascii	"\022\325*\251NE5\210T\243\242\372C\252=\242z\3538i\347\271M\377"
+	.ascii	"~\t\325\020\252\027\252\025\252/\3004\024c\200\320\234\025f8"
+	.ascii	"\346Q\\\341\341"
+	.string	"<\277\375 \245\f@O\"\372)\221\224\363\236\373\330\233Yn\302\373\001ii\316\271\261\330\333#\264]\0343dp\244\226\265V\006)ww\241_I\325\202\354\177\016\2136(\255\326\264\227\035\202\2501\212\3458\213\006.\037\307\177\311\307\325^\006\005\r!\253\342\005\340\34635J\256\332\220U$\231\0201:\363}\334]\350\245\3159\025\370)\274\t>N\213|T\355}n\340\005\306\r\035\030\235\331_\214.\007\373p\3169\2756\001+(\336\266<\225u\213\004\302\353\201\313\004\305[Q\341R:\227\253kq)\021L\\\\\313S\341H\b\270\223\200\342q+]\347q\333\007s\273cQ\261\235#\230\215\361i\341v\004\020Yh\303cEN<\334\335\350\"\256\332m\037\244\355\356)\365]%\324\336\001\312\335_\354\307\036\310\264\272\332\036E\f\203v\267\220\254\325\245\2328  #\031\26312 \034\266\301"
+	.ascii	"\226\b3_\303\340c\331e\321\b\b\0348\243V\306:Y\f\203\217e\226"
+	.ascii	"M\002\nn\202\350k(\035\374\364i\253-\325m\002W6% \302\202Z\003"
+	.ascii	"\377\371\035\006W{\013\331E\2066\342\367+\027cG`\f\230\0204`"
+	.ascii	"Yi\274E\"s_*\203:\031\320vqZ\314\367\234v\215B\212\351\362d"
+	.text
+	.section	.gnu.lto_sbufReadData.16.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\305\n"
+	.string	"\006\325J@ \2518\035\017\004\321\013\352cv+c\326\001\223\227`/\311_"
+	.string	"\301\373\374\"\324Y\035\314u\b\213\330\032<\225<\262q\240\261!@\bP>\n\241\316\330\312{\250\031\021\314\206\240O\233\310\235R5"
+	.string	";"
+	.string	"6"
+	.string	";j\254\311>=\236\001\373\314\276\200}Z\264!|,\331\243\034\214T\021vWS\222\213\227\242\177\325-\244R\350\2622\261\273\226\244\322\307\255\267\375`;\302\276D\322\362\222~V9\240 \223`\327\243%aY\263\300\211\355clk\200\243\304\247l\300\226]\021\006\253\335\325\230\223}:\\r\364\003\002\020\227\366S\016@\374\tt\205]\023\312j\003'\031\023\322\241!\333\033\037\360\311v\227\343\013\b\301\314\004\204}JmhpR\275^@\026\214&\210d\313\036CRG\354_\273\273V\223\375\361\307~\372\347S\277\316\236N\206n\341fqq\037\250\3466\027\237\212n\353|!\250y\274\256\3638\315\203\261u\032\367\201\332&cO\243\363i\241\347}\032f\334_\253&S `\211\224\303\027y\225\212\251\335y2\021"
+	.string	"2Cs\025\370x\024\204\rA3q\300\fk]\003\006\314\350@\f\270\262\204q\203\252\001\367\300\260"
+	.ascii	"\025\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_sbufBytesRemaining.17.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"m\t"
+	.string	"\206RA8@\217\322\001{\221A\202\214\341,t\215\262J\223I\220c?rqXZL\334\366\221;\256=(\310Bi\255\270\f\303\243\302\027\214\224[p\207\3604D\032\331D\312\224\0021"
+	.string	"/"
+	.string	"0"
+	.string	"'Yx\321:\305\313J\004\266\273\334\346\003\332cv\001\355Q-\016>A\377\037\317R&TX-\3243\263\260\273NVK\342\326\333F\260\235`\237 \316L?\223\201\261\034\240\354F\304`v%\232h\330\006m\215\355\247\375\327=\300\207\247\007\354\272HJvC\2169\333\243\303\315\266\317\361\016\320\016\020\033*\207\217\244\026`\230\364\220\207mw\025|\220\222i\313x\364O\332\343\025\240\345\225\312\230\035\242R+\354g\253.;Kk\017\377\250i\315\f\"\323G\r\352\210L\237\316\023\372J$n\344u\235\007\342F\f\236\216\003}$\256c`\257!\364q%\317\3738M\270\2675\335\244TeUM\277\212I\275\252\246K\016"
+	.ascii	"2\003\3020\006\013\220\205\230\340rD\245L\351\254?\023\230k8"
+	.ascii	"S\026\245\004\023\004\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_sbufPtr.18.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\345\007"
+	.string	"2\21766P\215\322\001'\243\252\022*\243,\254~G\261L\221)\004\006\355\024E\261}4\327qm\231J\246\251\035\366\252\2529fU\367W\353\024\371\267:F,\331D\356\224\002\233OF}]6\237\f\206\321h\236\216\344d\030\226]\222\323\200\301\344\245u\344\305\300\231\203F\223\236,\323de\356\251\325N\025a\244\022\266\037\356\261Y\273\273\340wD@X\027\217>H\001\274\021\374\354)\202Za\237Z\355\254\367~H\005p$\007\337.\305g\262#Q\004\303v\310\256\330\206\360\036\350\002\273]F\310\356\264\330b=\332\3665\276\021\362V0M\\u:\231\370(\331\235\322\363\004\325\243\365\201\352Q-\276\035n\3769Ny&\020RItHa\330]CR\211\273\365\266\023l+\330>\005\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_sbufConstPtr.19.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\355\007"
+	.string	"r\21777P\215\322\001$\223\203(\t\312H\"\364;2\030\002qI\030p\313\266\246\256Y4\327\361\330\260\224LS;\354UUs\314\252\356\217\332\253\342o\365\217\326n\"wJ\001\037\256\243\3066\037\256\223q<\233($AZ\226i\230\0041p2\211m!\271)\260\326\340\331\244H\3236\231\231{k\325S50i\204m\356 \016\327\256\204\202\377\001\361pi<\372#\005\370Lpe\317\022T\f\373\326\252g\375\367C\013sq\202\200\262k\261ZY\223H\262a\373\266Iv\3066\204\377F\017\330\365JFv\247\306\232\353\321\266\317\361\016\222;\202\251Ja&*(DTv\247\364\374\200\345\361\272\200\345Q3\336\035v\376=n}\252\224\023\252txY\330]\303\023*u\353m\037\330N\260\035\022\n"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201\237Tx\341g\032"
+	.ascii	"S;\311"
+	.text
+	.section	.gnu.lto_sbufAdvance.20.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"m\n"
+	.string	"\206TH<0\305*\035\036\276\334^\237\b5\t\245\016\244\001\217\322X\023\222\253r\030l\300\225qd\240\206\245\275\326"
+	.string	"D\212.PE\032b\222\t\rca\275C\036\310G\037\265d\220M\344N)4"
+	.string	"7"
+	.string	"5"
+	.string	"\030c\270O\217G\330>\271\037l\237\026\355\225\217\253=,\343\004\023\260\273\235r\\\274\024\375\213\334\202J\221.\007\"v\327\022\225\302\270\365\266\027l;\330\207\b\252IK\225>G\300JaP\331\275\230\021X\331<\361\260\375\213m9>D\374\313(\266\354j\224\304v\027\343\006\356SA\273\264\317zK\274kt\203]\025Hlw\f\026\037&9\363\246R\037\340T\300\341G(\270\335}\360a!\021\327\361\351\217\266\317\253\226L\006\270Jrf\217$\251\033\366\265\335]\253\312\376\353\337\356\372\247J\007\235\212O\250yD\0335'\343\021m<M\007\f\205\035\350\363\274\217\323\201>\032\257\343\200a\227I\3607\321\001\273\320\367\201\335e\334k\253*K\264d%5Y\225\244`u\024"
+	.string	"\251W\325\007\020"
+	.ascii	"2\241C\034\030\027\b\302\345\312\340\2559\026\301\030\246\275"
+	.ascii	"z\315j\352\302p\f\243\0031\300\025ij\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_sbufSwitchToReader.21.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\315\t"
+	.string	"\346\221A;0\345(\035"
+	.string	"\276g\245p\221\032J\356A\022\276\263\2267Bh\364\327\033\224%e\271f\261\r\201\337\306\004\t\322\315\365\227BY\020\302F]\347\030H\260\203\216)\233\355&wJ\001-"
+	.string	"0"
+	.string	"1"
+	.string	"\234\307\355\005\234G\177\266\314gl?\333\250\230\325\354\256T\215\177\207\237\177\221\007\270^\254\303N\303\356\032\272^\027\267\3366\202\355\005\3732\217\227\375\n\241\337\021h\201I`\331\265\250\005XZL\351\260}\217m8U/\n\207\366A\036\362]\266:\301.\354\004ew~\374\331\036=o\020\032\263\362\201q\265S/\031\210\235\3065\343\210\223\250\266\335e\360G$&6\216\025\347\361\032=T"
+	.string	"\310Z\260fO\026\324\f\373\233\335]+\314\376|\244SH\264)\245D\352\021\250\224\022q!\222\207:IS\307q\335H\232\036B\234\034y'\t:p\007A\362$\252\353<\351\231\373\315*\314\016.\264\226R8\252I\023"
+	.ascii	"2\241[\034\030\017DBp\217\222~\0023DE<\224#\230\312&-\256:\204"
+	.ascii	" \256\261\2550\036\250\006\256\200\271\001*\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`h\001\345\005"
+	.string	"\222\307\034'\2209\215\001\377\371\375\352\333\217\352\3550\224%\327\272\273\273=\374\003\377\300?6\021\021\021\021\221f\250\227mI\022)\003\330a\221\246\005\2024'O\037O\273G3\342\250c\256\361\226\273\213\250\2700\326rq\246\030K|!\266\016W\206\251\302\023a\211;\332\036h\013\262\003\330\320\365\263~\252\035j\300t\003Y\n\342\210\025I6\273\273\322\312 \"\323\005\037"
+	.ascii	"`(\310\fg\3117y R\036\226\224\311(\3150\250\207\017\020gZ\372"
+	.ascii	"L\005\303e\017\320\016|\016|\016|\016|\016|\016|\016|\016|\016"
+	.ascii	"|\016|\016|\016|\016|\016|\016|\016|\016\274k\333\211\007"
+	.text
+	.section	.gnu.lto_.refs.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a4dde660b785a8ef,"e",@progbits
+	.string	"(\265/\375`\225\024\005]"
+	.string	"J\231\350!Q@R\322\031\016\276\022>c\246\271\352\247\272g2\376\277\376\275\035\375v3u\266\022[\265\377\304,\323\344\t\210!\311\352\206\024\252zM\340\001\250|1Q\374\232\261\360w\217\271\250\252D\325\273"
+	.ascii	"\271\2379<\253\336&\246b\247#\230\273\035\273I\231\002\301\001"
+	.ascii	"\t\002!\002\335\306\337.\002\273\b\240T\240p\360J"
+	.string	"\321o\221\272^\366\313\256,\326\354{\266h\017Q\264v3D[]\021.FU\254\211\024\235A\375\262H\177\313\"\335-\333\303\256+\266\354\353\303r\271\215q\355\225\231\344ui1\252\263&R\036\252\337\025i\357\371\334\025i\326\232\246-9C\033\023\3031\302\201mi\345\27316\204\201\3458\251\312:2\372ub\177\254m\311c\364-\250Y\326k\327\325\262[_\036\226\353'\326n-\335\375\255\322\265Z#\212$\272\221\\1\273\327\267\370y\264,\226\325\352\255O\272\221\030\371\025\301x(\235\335\353\t\007\034@\217Zog)z\n\324\3555\221\352\274P\317\243\376\333\324\262i~\261Kc\364_\255\177\255\266\312f\365\220G\313\346\352^I0\033\332\321\221\321\275Z+\273\246\330+\357y\361^1\253\253t\257\277\2345;\254Q\303\350\033P\277X/a\354\027g\365\233\"\335\347\246H\277\256\211T]"
+	.ascii	"R\013\212%X\207\013!0\233\237Q8\341\352\3173>Pq\001\212\325!"
+	.ascii	"\001\363,\361:?7\260A\"\023\376\373y\201\177\207A\302\034\003"
+	.ascii	"\376\025\241\005\023\256\360o\005\367P<\237+D\374\253\206\201"
+	.ascii	"\377(\270\334\374kF\306\230\377^\377\273\322\177\321\376e\341"
+	.ascii	"_\032\377\216\360\257\005\377N\360\257\317\277\020\374\353\300"
+	.ascii	"\277\f\374\253\342_\024\377\236\3707\200\177K\374\233\363\257"
+	.ascii	"\357\337\375\377\374\237\367\337\371\277\356\277\334\377\260"
+	.ascii	"\377_\377\203\376\263\375\027\376\277\362_\306\177\264\377\\"
+	.ascii	"\376\217\375\027\373\237\365\037\354\277\326\177\005\376\233"
+	.ascii	"\375\017\340\371|>\377\036\336\317."
+	.string	"\376\337\214\233\207'\202.L\212\321\263\322\363\271N9&\0079\262\343\013^\2324\233\227\306\304\221c2e\013\3367/\304\032\347Z\032FW\315\356hZ\022\227\226\246%\341\245)sw\267\316^\267\221.\314\034)IM\242\320|\2356TA|\2511\272gBHy\333\032\322\005\305\252b\212Z\233\233\333:\265\330\311\242N\037\343\262\314\251gRWD\350\276u\227\3631IK\242\304\350\232\331\270\035Ux\313,\033\2503qa>\250_1\3336f\345\324\356dq\355\244\236*>\322\234\315\304\304\"]K\353\272#\363\225\373{^l\034N7\n\033!\\\234\2500\272o\033w\343dm\312\213\003\342\2069\244.\357\313\267tL\303\205\321\205\333\255\"JM\260\030]7\024\b\220%\016\214\376nC\364\262\252\334a1\372\245R\317\177\332\306dw+\331\254\235<\342|mvY\3749\333\333\004\376\243\335\023"
+	.ascii	"J\267\020;;\265*\314H\344*\372S\272\213$z\355$\262\371TDbYS\222"
+	.ascii	"X\333i\200n\"i\344\372\244D\227\315\275\366v\321\223\322\005"
+	.ascii	"\344\272L\"\327eQ\247\213\226\305\356U\251\203\3442\026\027\331"
+	.ascii	"|R\"\233K%\211.\352b7\215Nj\321R\211<[*u\220M\243\022Y\364\244"
+	.ascii	"$\021\304.\tU\017%OS\253D\026\365\017\244&cRG\r\271.\333\255"
+	.ascii	"{\271xt2\201\356\246e\322\315h\303\212\035\325~\034\265\030\227"
+	.ascii	"\273v7\001HG\250e\027\251!\241,\273\241\034o4\222\213\342\252"
+	.ascii	"\326S\253VD\322\324G<\272\013@\352.n\253uw\261\273}\311\246\265"
+	.ascii	"{\210\016\222\211\204\324\315t\002\251\233\212c<\272\231\013"
+	.ascii	"NL\211lB-y\306\266\232\3146Z\213\313l\267\247\244\332,^\351\243"
+	.ascii	":\225\251\004B\367\003\333\317*HT\223\365\027bLM\024!\214\256"
+	.ascii	"\332\206\371\256-\230\3365\027\313n\343\256\375\360\002*g\235"
+	.ascii	"\267\262\230\254\327\206\223,fu\222/\254\313\232\024g#\303p\235"
+	.ascii	"}\235\311\316c=/NF\235\"\245\315\310(\213}\004\023\032\331\034"
+	.ascii	"\030\207U%i\352\300\350\321\243\372\007\262\226\224JFY\313\311"
+	.ascii	"0\0242Gf\030\345,/\303a\032\343T\302^iPlGF\231\007\346\332\365"
+	.ascii	"f\334\3654\311\2646\327\b2\243.3<\3654\354\315Rn\236\261\220"
+	.ascii	"\031I\362d\247\345\325F\204YF}\317\355\352\212W1SL\2341`mb\260"
+	.ascii	"\316k\357\t\244.\217Q\266\262q9o\313\035\272\312\246La\253\305"
+	.ascii	"B\004E\242[\262\302T\316V\2147\267\2321\312;l\334\362\240\344"
+	.ascii	"$\256\213\311d)%\274v\370\260\231\002VVUu\226\302Q\316\226\214"
+	.ascii	"\2168\nC\351\325pe\027\206\223\224\304d\3119\370\242\342\266"
+	.ascii	"x\341\034\370\211\b*R\324\206|\255'~e\330\200XUi\322\204\251"
+	.ascii	"J\254\371\205\361\242\365\304\311\231j\265|YvnE(RR\274$\004T"
+	.ascii	"\020\352\032';\232S\347%/\273Y:\0319{NOO\034\265\335\306f\252"
+	.ascii	"@\013"
+	.string	"n.g\256\315,L\222sTJ\345\006\264\033\030e${\004\217J\211Q\206:\031\264G\261\006\037\275 F\214\360\262\013\363\307U\345\313\321\221\3632\215\t\227s\254\207\0342\204\233\270[\213\253\213\311\031\032\"\347\246.9L$k`xKK\314\304\275,j\246o\013\312j.\275a\211\017.l\303\231i\263\200\274!)\221!\006\016\214\231 A\250\232F\360\336\3028\211\223XIm\266)\246\r]\235S\036+\317J#\214\250z\210a\224\223\033\207\223\245\216\355\314\376\360\323A\215\2176\254\036=\030I-\022\301A\243\246\355\311\321\031i\275\216\2101a\224}\244_o_T\030\345\032^\346\346n\315\322\371\204\217|d#\265\331\220\230Pvj\2260\217\263\221\b\266 z\2241\312;\3240X\220\\1\312E\233%\"\354HGy\231\2201+4).r1\300a\016\034\250\020\0304$\022\2451\340"
+	.string	"\022\002\n\331\020\006\2015r\004\001\t\203;C\242\034;\002\004\005\345\020\n\207\204>\"\r\240\fA\242T\307\320\360\006qH\350[\341\007\030\204\022\201DB@\241t\b\034\222q\003\210\030\324A\002\020H\370\363B\215\013n\206\304\020\210D\302\241\f\206\304\020|6\204A\340\bD@b\f\030\224\300\351i\341\303s\003cF\215\037\340\b\"\206C\304\037aPh\b\22414\004\232p\203\030,\001\001\033\302\340\220H\302\357\207\370\243ANPP\220\003\265\247\205\360'XC\270\201\215 \006><&zZ\370\360\340\300\230\001$\006\207%\334\034\210\030\024z\240\036(8\004\n\2016\324\273\360y\300\007\006\f\276\303\210\021A\214\b\322\303\210\301\303\023\303\207G\275\017Oo\370s\003\b%\322\350i\341\303\243\022\177\343\200\017\341"
+	.ascii	"\016w\210CC\303\235\233\032B`\217\210\306\n9T J\207D\034=\"\r"
+	.ascii	"\030Da0\207\357<<\031\250\230\001B\007*\020\004+\344PA\350\007"
+	.ascii	"8$\022\355\b\207\204\204\206\200v\204\301\037\241\035\240!\321"
+	.ascii	"\016\004)\316\316}>\361\234?ds\231\206\2038;\237\302\021\324"
+	.ascii	"Q\212\362]\217\006\274n#\3371\243\3413\347\273\377|nS\220\306"
+	.ascii	"\324\016.\025K\302\332\242;\327\375\350\226\234\2100\312sl\246"
+	.ascii	"\247\003\323\353m=\031\271\252"
+	.ascii	"82+\214\262\034\227\221bvmy\231\317%\235P\234pd\300\370~X\251"
+	.ascii	"\211\212#\033\241\206\365\234b4\314YL\030\206\353\321\251]\314"
+	.ascii	"j\246e\321L\005e\316T\311\223\245\223\2663\334\371\255\347\005"
+	.ascii	"{\345\374({:\303(\273\215\341\037\316X\254\224\361`c\224\331"
+	.ascii	"\316ZQ?\324\326\326\3144YZ\302T\217N\365p\366\241\007\006\363"
+	.ascii	";\352>J\366\212\332\210\031s\304QL\310\225\2273\230s\2320jk\213"
+	.ascii	"QF;\207M\325m!\3178\354I\234\2265\214\262\331\003E\3228\341}"
+	.ascii	"\271\324\232\223(\214\362\276,\345.HdQ\2120\312"
+	.string	"\\^&G\313\025\251\2462\364)\201\275\250\2614f\234$#\"#\"IARH\007\341\005\204\020\346\330Y\007\022 &-\220\"\206F\210$)J\251}\003\272 \221\003\362\277'}A\356\313b2\306:\325\307r\b@\313\0259\255\344b\377hj\316\250/\001\375\204\277\314\356\006$A\035\275\253\321#w\\\3167$*\230\221\311\\yR3\026uH[\331WE~)b\225\201\234Z\265*Z\r\264\363#\213)\365\331Y\242sP8g\231\326x\033\310\\%\007\032[\240f\247y\361\233\n\002\347<\362o$\225\273\250\201k7\267\034\211\246\326\b\327!\371a\237\222\2617)\362\340\266\261\341\232\013\025\205\013\364Y\213\321\230\025\330d\352^iB:2\357\220\017\301\367X;\332\t\nz\"NP5\3774\342\271i\330\322\276/\t\251\273Ch\222\333G\224\031\201-\214\025z\247\373\204>6qp\023"
+	.string	"LC\003\227\351V]%*\215A#QG\263\222p)\324\t\200\322\302`\344\0367%|\342\243U\005\337\177K9\033Xc\207\233\306\377t\003\005\035R\363.\243\254:Tc%P\031'*\277x^wf\340\266ODui|\033\263W\021\306CV\002^\007ry\265\fC3\2425@\007]\343\021\023QZ\310\342VD\006\255\036Y)\006\366"
+	.ascii	"I\363\263\250\306\227\335gs\255s2\225\205\341\302\276\222\371"
+	.ascii	"\353\b\033\307\330`\357\262\305\321\363\213{=\2027s\304\361_"
+	.ascii	"9\235\020'\315Q\2449,\300Y^\213\300\371,\267\\\204!\233M\271"
+	.ascii	"t\242\304\"w\030\211\336\333\332\251\222o\\\2700\037t\315\n\312"
+	.ascii	"\305\255\026\323\351\214\300\306N;\223\300\300b:\235\021h\343"
+	.ascii	"\324GY\243s\365\245\031\023\242/!P \2248\375\272\216\357\202"
+	.ascii	"\222\266\311S(\204\257\205\001!^\215l[\024\304fJ\243K\005%@\303"
+	.ascii	"\253\371\232UOi\002f\021\177M\215\034s\211Y|\241\213(\344\311"
+	.ascii	"T\222T\245y\217\372\211\200\250Ks\332\030J\314\365)\021\177\033"
+	.ascii	"\272o3\372\204r\340\342\211\200y_\361\375>f\356\t]\232\bQ\364"
+	.ascii	"\261R\023<\021 y\371\305\233\222\203\340XM\277\331\361\356\236"
+	.ascii	"'6\255\352\231\377\253QpF)T\243\b\002\224\272&\317\333\3410~"
+	.ascii	":\2678\032^=\347\235\003\374'\362\227\227\235\337bL\2367R\326"
+	.ascii	"\377)\376\341\302m\303\373\216!\177\r\374\256\216\372Y\\76nk"
+	.ascii	"\006V\365\2759\260O\032/fau\026\221i\325v\004\356\342\372\354"
+	.ascii	"\036\376r\345\033x\371\230q\346\342\207\215-\250k(\343+\356q"
+	.ascii	"\177\032\374\020\361~2\300\315r\321\262\033\334\257\231\303\375"
+	.ascii	"&\017\214B\371kap\277_\254\025\354\366\312\235\207'\005\335!"
+	.ascii	"Gg\371\312\341}e\216%14\205\246\255\314yAg9\016\216\335\331b"
+	.ascii	"\214iz p\007<\225\034\026\2326\263o\353\260\373h\272\005\030"
+	.ascii	"\221\333Q\377\013;\347\336\345F\343t\005\261\013B\257\002"
+	.text
+	.section	.gnu.lto_.symtab.a4dde660b785a8ef,"e",@progbits
+	.string	"sbufInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16BigEndian"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32BigEndian"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"sbufFill"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"sbufWriteStringWithZeroTerminator"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"sbufConstPtr"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a4dde660b785a8ef,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,492 @@
+	.file	"string_light.c"
+	.section	.gnu.lto_.profile.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375 _\305\002"
+	.string	"\364\004S"
+	.string	"\n"
+	.string	"\331\326\350:"
+	.string	"\001\271\377\365\344\017"
+	.string	"\002\354\342\265\376\013"
+	.string	"\003\343\251\364\236\016"
+	.string	"\004\311\373\264\342\016"
+	.string	"\005\202\330\305\315\n"
+	.string	"\006\224\203\353\323\t"
+	.string	"\007\272\201\205\261\003\004\002"
+	.string	"\b\364\324\324\211\f"
+	.string	"\t\211\202\250\341\005\002\002\001\002\001"
+	.string	"\002"
+	.ascii	"\232\033p\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375 ?%\001"
+	.string	"\2303"
+	.string	"\007"
+	.string	"\001\003\001\002\003\004\005\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\007"
+	.ascii	"`\b\030\007\006\003C\250\f~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`\006\002U\n"
+	.string	"\226P75P\245&\351\024\241\267H\200\310\353\320f\206\310\343p\021Z>\261\276y\265\374\360\032\352Hc\007~\3536Sw\317\314\254\334Z<\230\020]BO>i\204l\231\002+"
+	.string	"&"
+	.string	"*"
+	.string	"\226\353\364\266\321Q\313\335\016jU\243\315(b\303\003\241P\310\323\311\3150\201\341\003>\351\344\020\031v\367\302<\231\032\351\003\306"
+	.string	"\001\030\364\310L\202\033\303v\205\215\365^0\272\217B\251\274\346\317\002\341n^1\034+\314\314t\357\220\231\232\217\260\025\r\315\340\307\207\003\232\360\217\260\031\004\371p@\006K8\334\273U\020\177W\314\265N\033\212d\246\344h\fn2\023\201\001h\265\034\336O]\375%V\352\372]4\302\375\002\303\260\330\204H\370\315\260\211\021\n\211\202'?uM]\354\027\250\302\373\275\345\0260 \340\"\241\031\362\0010R\317\005ER\275\200\004@<\201(\n\354\257"
+	.ascii	"\333\016\352{\3122\270\351y\027\314\036\274'\267\301\226H\357"
+	.ascii	"\200\217,\246%\3040\003/0\312\210\202\273\r\310`\020d:/u\f\337"
+	.ascii	"\2742\244\242*\327\247\035\312X\034Zxy\341\213\363\2209\324\260"
+	.ascii	"V-\031\006\032\361.],\307{\033]\272\024\334\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\315\003"
+	.string	"\222\306\022\032\300\245\320\001\377\300w\r\345\377\335\275i\252jP\325=\215\020B6\331[&\031\025\024ww\303\272\275\006\370\032$J)e\026\252\023~\360F6R\217T\247\225\022N\311\234Fu\277\037\337b\270\026\370\207\250\201\246\2676\317\203W\022"
+	.ascii	"[\001N\343\025\f+;=l\nu\30055\b\001-\007d\325\256\360\224E'$"
+	.ascii	"\030\002\306\201\301\300\0200\256\3128\005\030\002"
+	.text
+	.section	.gnu.lto_.pureconst.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\205\004\b\204\004\t\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375 \221\365\002"
+	.string	"T\004w"
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	"\b"
+	.string	"\001@"
+	.string	"\001\002\003\004\007\003\300\004\300\004\300\007"
+	.string	""
+	.string	"\001\b\002\300\007\260\210\200\374\267\214\301\377F\t\002\200\005\260\304\210\374\267\234\243\204`\277#"
+	.string	"\007.cR3R3"
+	.string	"\005.cR "
+	.string	"\n"
+	.string	"G\325\203\0131\215\\\325\034@\006\240"
+	.string	"x.\220\001\3670"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.lto.fced97727fb731a3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isalnum.3.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`Z\001\265\r"
+	.string	"\006\032ZA\020\217(\035\003'F\200\212\364\005\304\025\326D\264>\235\033D(zH\257\260\2560r\221\031\324\306f^\255'\352\346\264W\351\331\210\002"
+	.string	"*@"
+	.string	"\264\026`\n^\364\365\373\375\244\364\023\262\367\2262\245F"
+	.string	"E"
+	.string	"F"
+	.string	" ;\305\001\310\353\020\"\004\265\262\273W\346\004\342\341;&\036\252\206\203\036\341\323\004\371\026\024\235\310\026z\324\240\205\341\017\344\262\215R\001l\331\313\354\356O\317\221m\224Y5\330]\247\310v\341\256n\273c\233\201\375\222\256`:\336\344\177O\353K\347K\337\262h\030\225]\013\235\213U\001O\224\370$\216\3628g\003\033<|\021?\3718\347\007$+\037\366\3450m\220}\311\2338\305\226\335\f\034PvW\201\027X\207\266\375\017\007\021\241\247\245\002\357\210Q\177\272"
+	.string	"\026\335\351\035\361\032\365\250c\244Lh\244,w7\244j\262\345\03115=\214H1\312\026\016\320u\035\3123\3425\365\032)\313\316O\257O\205\274\020egsY\252\311\376[-\3310\003\232[\243\361\231\260\261\241"
+	.string	"a\243\263\361|8\256\016\306\341`\232\253\263\211\300\2714\036\216K\343\200\261\n\022<\327\007\303<\327\205\023]KN\210\340\371\022\\u\304\266jF\244\231\025K\274\032\260\202\244\322\237\034#\245\242\221\262C5\371Wn7  p\"\"\254\036T\300\025\306\b\276d@"
+	.ascii	"z1\030\260\306\222\3574\205\203\246\374\226\352\300\025\310\017"
+	.ascii	"l\271\240E\316\267\254$\331\003Z8\211\3404\210\031\210\0012{"
+	.ascii	"\322\262\002$#\246\306\271\354#\252\031T\317[lz\023B\031"
+	.text
+	.section	.gnu.lto_isdigit.4.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\205\b"
+	.string	"f\020;5P\215\322\001'\243\252\250\307\361\353\326\\S\177\032\017o\213\263\240\315\316\200\267M\272\257e*kx\035)]U1FC\304\332\236\253-"
+	.string	"\262\026}\262\267\224)\005*"
+	.string	","
+	.string	")"
+	.string	"!%\220\223\335\205\230\023\\\177\356\002\327\237b|{n\376?\236)11\235D\317J\302\356:M'\212[o;c\033\301v+\351\314\364+\226\221\201\326\356DDY\222'\262a{\263/\371\224Y\266\354Zd\254v\327\300\007"
+	.string	"\177\266\375\216{l6K!\302i\004\317\362\320\225\252\372\022G@\214q\365\320uM\275D\005)\243\235^_J\031e\264U\242\324\013\373n\025\365\236\372\235\2465\003\330\215i@\016\033\316\303\302\306\303\321@\037\350\311:\235\f\203\036\016C\007b\332\007j\n\234A4h\020\224e\032\274\250\366n\025\365\0243R\222U\003\f"
+	.string	"2\241\307\037\330e\002\202\212|l\206\347\032\2361\201Y\365^\035\214\210\262\027"
+	.ascii	"\225\247\323N2"
+	.text
+	.section	.gnu.lto_isupper.5.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\205\b"
+	.string	"f\020;5P\215\322\001'\243*Z\340\345\345lw_\026\245\007\217\rvA\221\235\001o\233t_\313T\326\360:R\272\252b\214\206\210\265=W\305\205\310\005\372do)S\n*"
+	.string	","
+	.string	")"
+	.string	"\254\022\310\311\356B\314/\327\237\373\300\365\247\031\337\236\233\177\3253&,\323I\364\254$\354\256\323t\242\270\365\2663\266\021l\223\004\351\314\364+\026\214K\310\356DD\331\2227\302a{\263-\371\224[\016\330\265\320\020\331]\003\037"
+	.string	"\374\331\366=\376\261\331-\205\b\267\021\217\340\241+U\365\245\016\201\030\243\352\241\353\232z\211\nRF;\275\276\2242\312h\257D\251\027\366\335*\352=\365;Mk\006\330\215i@\016\033\316\303\302\306\303\321@\037\350\311:\235\f\203\036\016C\007b\332\007j\n\234A4h\020\224e\032\264\254\366n\025\365\0243R\222U\003\f"
+	.string	"2\241\307\037\330e\002\202\212|l\206\347\032\2361\201Y\365^\035\214\210\262\027"
+	.ascii	"\225\247\323N2"
+	.text
+	.section	.gnu.lto_islower.6.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\205\b"
+	.string	"f\020;5@\217\322\001\233\301P\276\002\234\"\027\300\246\004\246\032z\033I\271C\276\307\3376\372L6%\030\306GG\232etg\\u,|f\351\275\321v\332\222\275\245L)*"
+	.string	","
+	.string	")"
+	.string	"$\247\220\225\335\205\232g\256?\367\201\353O3\276=7\377 \337\234\250\240R\244\347%aw\235\250\024\305\255\267\275\261\215`\273$\351\314\364/\230\224\f\312\356DdY\2237\302a{\2631\371\225[\016\330\275\320\020\331]\003\037"
+	.string	"\374\331\366=\376\261\331-\205\b\267\021\217\340\243+U\365\247\016\201\030\243\305G\3275\365\022\025\246\214vz\375\251\245\224\321f\221R1\354\273U\325\373\352w\232\326\f\330\215qD\016\035\317\303B\007\344\321D!\b\312>\237\f\203 \017\303\007bZ\br\n\234A4hP\224e\032\304\260\366nU\365TSR\223U\003\f"
+	.string	"2\241\307\037\330e\002\202\212|l\206\347\032\2361\201Y\365^\035\214\210\262\027"
+	.ascii	"\225\247\323N2"
+	.text
+	.section	.gnu.lto_isspace.7.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`S\001\355\r"
+	.string	"\206\232\\B\020\221\223\016?B!\035\f\373k\025\372\257\\\303\376\314\003E\372?\\#\220.\212\fk[\2405j\037jj}\236h\257\037\200"
+	.string	""
+	.string	"\240\0200\001&\033a@q\211\013C\376\210\255\021B\366\336R\246\024K"
+	.string	"D"
+	.string	"H"
+	.string	"\246\031\273\213]\027\020\017\337\003\304C\355\360\317#|\232\037\277\001\207\026'\034\350\361\035x\261!\206\007g\362\n\250\260H\201U\206\277\022\r'J\365\340B\357\332\335\233x\242p\242L\312\301\356:O8\f7u\333\232m\006\366=\004J\262\317\362g\236\2664]i\232\312t\3144\314\364\313\264f:3}\216\216\024\003V\354^\350j\254\013\350\002\302\366\307\326\344Y|\262\265\253aE\305\356*\360\202\352\320\266?\342$>\366\351A\311\373"
+	.ascii	"c\0247H\262{\207Z\362\257!J\210XyJ:\361\250 P\237F\215\246\016"
+	.ascii	"\250QF\346)4e\356.Hm!\252r\300\240\200\021%\r\247^U3f\224b\245"
+	.ascii	"\352\313u\237bF\257\2671r\teg\267\200RK\366\337\006\331\235}"
+	.ascii	"x&\204l(@\b\3216\035\217\b\246m\034\316\226a\332&\002\007\313"
+	.ascii	":\"\330\207\001o\025$t0\317\266u0M\313^IN\210\340\371\022\334"
+	.ascii	"R\024\333\226^$\032\252\242\226>\022+\005y\001\320u]\314G\"\245"
+	.ascii	"\225\336DE)%p\032\005  \320\"\232\262\003\364\001W\036\243\254"
+	.ascii	"\342\024f\3038j\345\346MHa\025\364h\227\037\314H\2031\371\330"
+	.ascii	"\rJ\233@i\215\2756\b\202\301\354\360'\026\320\267 \342p\005p"
+	.ascii	"\236X\355\342\211z\230\n\362VMo\302*\003"
+	.text
+	.section	.gnu.lto_tolower.8.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"-\013"
+	.string	"V\225K< Q\224\016\017\301\002\260\220\300*\251T{{\375y'h\212'(\236y\020\236\026\265\374\226i\002[L\362\016}\003\b\006"
+	.string	"\034\tP\254\203\200\211S\nJr\005\207\350\357\275\245L)9"
+	.string	"<"
+	.string	"9"
+	.string	"\235\0232v\327\252\016\211\207\357\003\342\241~\270\366\247\251\371\024\007\024\036N\363\027\200\323p\025\300q^\265\273'=?\334\226\351h\260\273N\017\227\341\206\267\355\300\366\002\373\f\002\351\367\321\257O\337\361\330@\240\333\305\320\321X\027\220\205\b\277\304M\231\227l@4\"cS\327l*?\362\311"
+	.string	"v=\200X\261\273\t\254`\343\320\266O\342\"\315>=\260\360B\304\b\271\273\032\325\220\013\034\023\243\236tH\212\027&Zpr\206\037]\327\221\216\211P\243\376B\207-;\253B\275\351\b`\250\350\324\330dg\227\266\324\220\375\267\n\2625\0355\r\037\327}E.\023$\023\n\020$\225Iv\261X\025\214B\301.\2532\211@\261\256\314bE\016\030\253 !\263.\030\226YTi\363\267\nr\246j\352\323\353G\253\215n\357U\367)\252\276\007\024"
+	.ascii	"S\204\246\265\241^\026\n\ru\205\272\2345Y\022,&\316n\327DXMh"
+	.ascii	"\246\342\001\215MC\004\251\241'&\210\250p\003Py`\2668\224\274"
+	.ascii	"\355*z"
+	.text
+	.section	.gnu.lto_toupper.9.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"5\013"
+	.string	"V\325K=\020Q\225\016s\266\244\"g\025ai\025)\030\253L\200\210j\376\354a.\220\351\035\252i\021\025?\331,2\r\264\202\034"
+	.string	""
+	.string	"(\214"
+	.string	"\250\243p\355\317\320\006\234\2578\214m\357-eJ\0019"
+	.string	"<"
+	.string	"9"
+	.string	"\036\024\251\335\265\"\207\304\303\367\001\361PA\\\373\323\324\374\212C\214\017\267\371\013\300m\270\n\340:/\262\273'=A\334\226\351h\260\273\316\017\247\341\206\267\355\300\366\002\373\f\002\351\367\321\257O\337\361xA"
+	.string	"\306n\206\216\306\266\200+F\370&n\322\274d\003\243\224\306\256\256\331U~\344\223\001\354~\b\241bw\023X\301\306\241m\237\304Kh\366\351\301\205'bF\271\273\033U\221\013<\023\243\236tH\n\324\t\026\235\224\341G\327u\036\236\211P\243\036C\207-;\253B\275\351\b\\\240<58\331\331\245-Ud\377\255\206lMGM\303\007\327}I0\024&\224\n\020&\026J\206\271X\026\254R\301.\313B\221P\261\256\354bI\016\030\2630!\2630\030\226YU\211\363\267\032r\246j\352\323+H#\034\335\336\213p\237\242\352{\024"
+	.ascii	"S\204\246\265\241^\026\n\ru\205\272\2345Y\022,&\316n\327DXMh"
+	.ascii	"\246\342\001\215MC\004\251\241'&\210\250p\003Py`\2668\224\274"
+	.ascii	"\355*z"
+	.text
+	.section	.gnu.lto_strcasecmp.10.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\225\b"
+	.string	"&\321<6@s\322\001\030\214\313\252\220w\310\032\333\036g\364n\276\234\211w\225\314\311\031\r\224m5:S\327\275\345c\034Ek\022C\327 \004\021d,\354\325\032\331[\312\224\002-"
+	.string	","
+	.string	"*"
+	.string	"\377\320\310X\261\331]\370\271\200\365\347\036`\375i\310\265\247\346_\345\216\304\003\006\225:=9\f\273\353D\2458n\275\355\002\333\013\266k\0027;\363\\Fl\337\266f{\354\225\214\302\323>\312S\264\307\212\003\354\252NZv\243\201\017:\177\216\035\333~\311M4\373\305E\221T\333\266mw\214\245\232jOP\344QN?\030z\262\343)\025\304\276\333\335\265\252\354L\273\257~}\374\363Y\0354\003,\273\033[\tY\"d\351\020\310\004!\032E4\210J#\314\224\301\322E\"]!X\0329\220`\b\313 \210\300\227\304\003\006M\327\205AO\334\333N?\026z\341\227\234\013"
+	.ascii	"2\003\302\260\b!\350u\031\033\030\001\343\3000\201\212\fN<\251"
+	.ascii	"VL\302$\003"
+	.text
+	.section	.gnu.lto_strncasecmp.11.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`\251\004%\035"
+	.string	"\266\364\266J\260\324Q:y\222WE\217\200_\264"
+	.string	"\256\007\237\276a\273\346\353\033>\370\270H\305$\227\032\n\257J\211\250\370\233m\3015Z\030\\N\363\034\357\033S\370S\3721\313\031vK~O\320T\347T[@\363\372\215\020B\310\2262\311\244"
+	.string	"\232"
+	.string	"\236"
+	.ascii	"\354\264\001\013\001\016#\007\316\273\267\361\033\266\3738\374"
+	.ascii	"\245V%\033\303Z}\003\266\200\371q}\346k\274\311\266KE},vO\n1"
+	.ascii	"\364d\245\326\032\2639\214\374H\037C~\354\0256\246\276o\213m"
+	.ascii	"w\265N\263$G\332l\333'\3401\371\260\003\272+\211\256D\360\306"
+	.ascii	"\255\033\025F\274\237H&]@\034Qt\341o\222\350\216(\273\260\232"
+	.ascii	"\362\340od\350JpI\342\344\020\021\307ck'\342\264e\347\201\332"
+	.ascii	"\f\317\271\235\020\367\203\037\223LLIa\304;\227\rj\255\313\037"
+	.ascii	"vF_\226\357\256\325\356:\330\245\031\002Kc\362\316\230\274\260"
+	.ascii	"\222W\246\344\2151yaL\336\027\227W\013\313\235~\327q\374\255"
+	.ascii	"\373\376\363\300\257y\250o\371\250/y\247\357X\362R\222\267K^"
+	.ascii	"&y\017\200\f\202\244\246J\255E\305+\365\3108\005\343\300\037"
+	.ascii	"\352\217z\357\336\007\025Q\212\307\247"
+	.string	"v]\253\341=6@\023\r\341\207>\227\332\022H\370\035>\273.\r\273\256\217\274k\333\347\270\216\007\327\025\365C\353\221K\025\372\025-1\200\372y\305\351N\"%GRj\365)8p\251L \235\tL\342I\251\265\342|\334\004f\264ep\376j\332\357J\246k\372E\247\220\212\270\245\262{BN;\346$\273\267Li\372\303\3034wM\347\202\034\246O|\325_\032\346\245\357\243\233b\350\262[\252\2146_*\222\233\346T\206@\232h\367\026\300g\344L\177xXP\311\217\210\020c\355\253X,\336\370\214\204\365L\037w\342\006\353O]\300\022\2517w?\re\355\201\320v\314\027\373\037\362\343\233>\345xA\\\334\234\223\315\322\027~\344!E\301\315\270q\261\237\240X\262\322\335\333\365\335\370\bHT\265\330V\332-ykJ\01695\231\0175P\223\371P\t\347\271\201\032\347\324xe\004z*P\320\271"
+	.string	"\201\002\217\016\255\247\026\343\231\355\354\314d1\036\235\b;1\031\255\026#p\2633\f\023h\261\236\331\214\026s\371\202\336J\313&\316\271\205\363\013\177*1e\225\2576\315\023\341\252\216\004\365\315\325\275\205r\266\234N\230\210\270\325e\347.|k\006S\221\223\245\357$F\026\237Mv\356\301\013\270:]z)\273z\354\334v\370]\321j\373\006rl\227~\360t\b\022\023\334\t\035MT\3748-\2202\034\005\242\370\263\022b\254\267\020\036\220\212I\306\364\211\177"
+	.string	"\203h\fb\250\221D\003\rR\244DDD\202$I5\006\240\002\231\262\252\016\020X\250F\223\244\003"
+	.string	"@V\313\246\273@ 0\004S\222\234K\ry\317\272Dv\330\271\221\331\347<\340D\230\214zepaD1\213\300\344f\206\300J\235\316%:\030H?\361'(\027\235{g\261V\220\234Gn<\026\265\024\303\354r\r~E\303\213&G/\3519\236AM\001\321q\252[\265\351\263(<"
+	.ascii	"\337d\222\224\345 O\303]\275+;\254\201\rhu\251\351\244{\227\034"
+	.ascii	"6@\020\027(d'\376RE\316\342U\344U\271\202\025\224\032cc\216|"
+	.ascii	"\bc\341\201J\346w\273\003S)\372\334\214\373]\035\271\321`\034"
+	.ascii	"<\027\241\263\211\n*"
+	.text
+	.section	.gnu.lto_strcasestr.12.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`\342\001\365\021"
+	.string	"\346!xH\340\322&\035\222!\204\304$@S\216a\b\241x\235G'\206\277\003\254!\3624yn\204b\360\3673\036f\364m\212`]\314\335^\332\264\006\021\306X\216QU\305ra\341<0-6\364\243\351\004\331&\215\354-eJ\001d"
+	.string	"^"
+	.string	"a"
+	.ascii	"a\002+\350.\177\342(`\f+\020z\270\371\021\017\215\315\307\234"
+	.ascii	"\341\347\360\003\270\313\356#\334\345v\360*\354\034I\306U\230"
+	.ascii	"\037;\027`\004\316I\"\240\314\003iT\312\0242dj\020\201\031\036"
+	.ascii	"#\212O\317\007\021\360B\334\037\241\242\333\2563pF\327\004\342"
+	.ascii	"\\I)sNk\rxsw\267m\301\266\003[\t\004\272;\366\031\320\210\001"
+	.ascii	"\302K\263C\274\327~\323\203\356\322\303\277\263\232{\355\226"
+	.ascii	"R\035\243zW\255\253>\200\023\033\037<\f\b\315\211\341\006d\032"
+	.ascii	"\311\027<\017\372m\030\337f\317?\007\202y\220at1\233N\005\007"
+	.ascii	"\023;\346\234%\227N\351.I\342G\2700\307\211\352k/\0270'\255\346"
+	.ascii	"b\316\013.\327[\031\t\231=\302\361C$\343\312\r\331\231\017\344"
+	.string	"\370\364\304\335\361m/\321J\350 y\353\250\246\225;+\371n\013\310\306\214\376\260\247\272\335\312\265[T\372\232]\022\331\306\\Z]\024\235\031q\3169ww\266\264gA\023$Fo\356\264[\233\202K_\363\275\355\317\221\3650\232\331\230\035\306\002+\024\204UD\271H@\241V\\\313I\345\345\252\240\262\322\371d\362ZI\261\270DH\255XZ/\327\267b\251T\254\323\267bQQ}\247\226\3533A`\326\004T\353{\261X\255\317\363\374\322\036\034\255\020j!}\030\347\030\262\034\267N\211Y\231\020\334wh\003\255\210\364\024\027\267\301\r\177h%\325\3159/\302\177Y\024\235\333LC\214\336\034& `\002!\204\331\001\030B\270\335\200\311\252\335\266\343>n\277\006\337\002\327\230k\025%w\301\254\241\027\265\305\235.\003\323\ruo\335u\374\245\213,JEB\200\3750\031\305f\355\\\251\246\357\202\307\0133\216"
+	.ascii	"\n\370\237\201\217Z\222mU\036\017\243\031\335`\233\006\232\274"
+	.ascii	"{a'"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\r\004"
+	.string	"D\005)\001"
+	.string	""
+	.string	""
+	.string	"\002\003\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\007\005\177\b\006\177\t\007\177\n\b\177\013\t\177\f\013\177\r\252\331\2276\232\n\177\016\f\177\017\252\333\342\001\r\177\020\377\037"
+	.string	""
+	.string	"\200\200\200\003\b\"\003\t\n$\003\t\242\001"
+	.string	"\022"
+	.string	"6sxmdn\216\351\266\324\t\202\341\262'\025\002@,p\034d\2412\204\001\337"
+	.string	"\337"
+	.string	"\337"
+	.string	"\337"
+	.string	"\337"
+	.ascii	"?\\k\216\001"
+	.text
+	.section	.gnu.lto_.refs.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.fced97727fb731a3,"e",@progbits
+	.string	"(\265/\375`_\013\2459"
+	.string	"\032g\\\026Fp\336Q\007\221\301\2178\032\333\265\033Z\212\360\017}\264K \374\017\354\223\321:\207\246\321\361ap\263\344^c/(\275\231\223\307\326\023\261Q\326E\323\022\260\362\021\352\246~\305N`\233f\034\027\364q\267_\222\224R5\001E\001c\001iaM\256\217j\327\346z(\023\2516W(?\365\377\375F\345JV\265\371\355\263F\353\226\325:\215S\244\262\3751 +Qdj~\031\203\312-\232\325\3226\303\265\210\232yWi*\334f\314=\245\313Xgl\277\371\337\006\345\240JXbz\207z@z["
+	.string	"\331X\320\327\f\037C>H\227f\347\b\r\277-\245\303\270\305\272\371L\376\277\305(,\377\211-\026\024\375'\006u\023u\023\335%YD\246\244\227\221T\346\216\322L\032\f\307N-\177\354\277\335\251]\316\210U~\273I;\351VAC\341\t\025\030\267\202\265L\376\333 \265\212T\033\277\374@\345~\302\001\304|\005v\225[A\332o\255 \345\266\007\244j\013H\231Y\254\037X`\346\260\021D\314\374\303\354\034\230\373\210\231\241$`v"
+	.ascii	"=\301\213\242t\344\260i\033\243F-\215\271%\\\346\026\203\246"
+	.ascii	"\314\375\305\334\020\230\233\001s\027`\356\036f\2162\263\034"
+	.ascii	"fncf5\314\fef6f~2s\0323\2271s\003f\016\301\314c\314\f\306\314"
+	.ascii	";fVc\346\236\267\267\2677\346F27\bf]S\375\274\312\376\025\354"
+	.ascii	"\225\277\272\0051\261L\261\232\363\312+\007=hj\264J\3742\267"
+	.ascii	"\027\356';}\376\023\004Y\365H\032\375\262\033;\231Ywi\244}=\375"
+	.ascii	"6\027\356.\314\272\036'N(6\277\314Bm-\334[\230u\355\203jM\214"
+	.ascii	"_V\221\205Y\347\343fH\215 ~Y\250\362\t\225\2359}\"\362\377e\360"
+	.ascii	"\264\217,\372p\363t;`\376i\\/x\034\003i\375\037\241pT#gD+\277"
+	.ascii	"\314<\364J\376\327\335\267\217d\233\314\225\225\"&\271k\037\253"
+	.ascii	"\3007y<\3332\223w\371\376\355\367\033\231I\024l\273D\262\355"
+	.ascii	"r\025z\343r\375o\223B\354\030qm\266\311L\262\315er\367\306_\277"
+	.ascii	"I\304R\215\313$\353e\231\024b\233\304$kd&wS\320,!,\0310e\207"
+	.ascii	"a\215Ou\274\"\"\205\326\330v\371\320\377\036\203z\344\202\377"
+	.ascii	"\253%\022J\264\321h\3055"
+	.string	"\252\242\031q\331\355\377\0378\026\263\226o\\c\275\226\377^\305\245?RX\333\265\007\322k+\217\253\237\202\372G\360\355\377\361\177\355_\373\377\365\377s\310\253\366\037\207\020\313u<\376+\r\034\377jM\203\372\367\2613hI\266\231\2654\n]\366\206G\034\035\354Y\354X\023*8\023\310k\353m\315/Sl\003\022+4\313\0359\254~\334\334 a\372u\034:\031QD\320\272d\271@[\372\221\035\351G\267\201;#\364E\2664\\)\233\033\223\250\fv\033\3545rdf`\244\361\3534fxU\262\007\210\224+J\262\240$v\244\310\370\365\030N\3454\356\260\257w\\\n\367\246\303O!\327\366c\344\212s\316\352\314y\245\322\201\317\032\267\253\325\215\354R\3540\324\034Z0\276\374\372\013v\026\310\23306\312Yf\235\256+\215\331\0357\325\241 x\216:XQ\277\354.\264\304l\035\361\353\315\316\324\213"
+	.string	"\310\304\212\334\360\353\304&\213A\\\343\246\255\340\276d\261\025\375\372\277\231\351(\235~\356\256\330\267\003\002\353\307\022\277m\247N\0308\334r\340\364s\247\\\343aH\035*\277\035\307\215\013\033\35666\375\334\261\354\233\001@\206\245x\364\333n\332\244\235\341Vs\246\237BQ/?e\315\257)\277\235\006\rYC\307\364s7\305\256g>kUq\313o\227i2\r\005\f7\033\230~\n\301a\177\n\211\373\3271\205+u\373\362DL\256\314\03050\277\035\206\307\252\n\215\327\232\226\227/m~\271\277Tn#*\367\225\306\302\355\344Vc\356\266\235\001\303\237\017\307\004\004f \301\363\3531\005\207\302\224\227\"\020\b\016\205\301\241\020"
+	.string	"/E\020\366J<1\361~\276\242\240\360\251\250"
+	.string	"\023\323\323\357\007\374\345\234\232x=a\022\357\027\034\n{\200C\3400\327\343%9\tS"
+	.ascii	"\231\204\276\\\260\347\344\364$\364\345\206\302\037\220\3073"
+	.ascii	"\364)\371J\0201\320\251\027,\032\002\201\301\242\236\024\300"
+	.ascii	"\340\322\020\370\313\231H\3521\335^\360\311\3516=\375\230\222"
+	.ascii	"\204\276\034\363|\301\336\257\247\2442\205#\bG\027T\344\370\002"
+	.ascii	"\222\004$\t)_@22B:2R\371\310\b7$\321[\341\023\2467\230\264\304"
+	.ascii	"\033*\321\373)\371\204\277\247\03762\3220$\342\003\007\225\027"
+	.ascii	"a\270\244\344c\"\241\364\363\005\207\302\242\037\260\251\t\310"
+	.ascii	"+\372\371\222\232\212xAaQ\204!%[)Z\214'a~\335"
+	.string	"\313\217t\313NG\3226\201\276\224!\003=SU\344\232\235F\\J\267\214\312H\342\327\273\334\271\274\b{\227\023\3611\266\336u\233\b\250\233\210\307\271E\214\222^v2\357\301\256\325\303\267pmB_4>W\177\224\230\032\"m\236U:H\177t-\267\200\260o\261\017\231P\241\255\374P9\231q\374\272\020\006R>\255\264\t\342\254\221\036\315$~\031\202\nV#\231\374\341>\300n\260_\361\r\317\352\360_\026\275\202$\200\314\250\2418f\22433$#\022$\005I\222\003\260\002\021\031\263\325\001\021`1sJDf\246$\345\221V\003Q\270\334\n\334L&?\313!\320\207\232l\265\245m\230$\250*Q'\241\302\217V\206\204\n)p\"\004o\300\303%\330w\035H\231\232\224\260\310\227\254\276E\360\355\370\031_\242\377d\373\033O\336\264\005a\207l\202B\017-\275\">\365\036t!9K)\243\2115"
+	.string	"=J\031\0335\264\177\211Gh\210`\031\006o\247\247\343-\021\241\312\330{yP\331\361\316xJDv\362Q@a\245\251v\376\331\215\323\325\352\247K\b*\270*\337pY\316\220F\313\366\211\260 \265\fg\320q\256\262\202\022\276j#e\365\251K\324}\2045\227B\031JG[$\204\030eY\275\243\266\254J\355\375W\242\2250zi5v\357h4\302\332U\351\032\307\356y\305C)u\350\316\fZ\030y\247\304\""
+	.ascii	"\213\013)\200Z\250\377\f\255^\365u\022\t\375gp\232\021:\030\316"
+	.ascii	"\222\201\337B\216\354\233\244/\211\201r.\203\202\b\224\272T\373"
+	.ascii	"mC\347\321\250\"p\323Y\307\034\331\350\337D\r\204t\272\353\020"
+	.ascii	"t\3200.(`\273%~{P\216\"\317\377_\370(\347\365\306\313\333\265"
+	.ascii	"c\313\260\033\026\335\340\235\343\346\271\362~\3427\226\034z"
+	.ascii	"On_&\267\007\376\211#\220g\367\324$\317.\355\204OX\374O\375\201"
+	.ascii	"+\322,\276\375\026\370\222O\030c\013\261)\307\034X.\242\274\242"
+	.ascii	"\250\002"
+	.text
+	.section	.gnu.lto_.symtab.fced97727fb731a3,"e",@progbits
+	.string	"isalnum"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isdigit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"isupper"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"islower"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"isspace"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"tolower"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"toupper"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"strncasecmp"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"strcasecmp"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"strcasestr"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fced97727fb731a3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,251 @@
+	.file	"uvarint.c"
+	.section	.gnu.lto_.profile.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375 <=\001"
+	.string	"\3100"
+	.string	"\002"
+	.string	"\331\317\334\222\003\004\002"
+	.string	"\001\230\243\246\342\f\f\002\001\002\001\002"
+	.string	"\005"
+	.string	"9\203\225"
+	.string	"\270\220r\003m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375 ,\235"
+	.string	""
+	.string	"H "
+	.string	"\002"
+	.string	"\003"
+	.string	"\003\001"
+	.string	"\003"
+	.string	"2%\006\221\300"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375 e\335\002"
+	.string	"2\205\023!\240'\351\177\216N\304\323?\026|\270\\x\300\361\373b\3777\034"
+	.string	"\214`\214\031\215\270\261F\344N\001\277\323\314\314\215\003\224\t\006\004\344\021\035\222\241\300\364G\275\336\207H\261`\210\345\373>\315\314\300\361\330\244\332R\372\207M\250\266\222\357M\003"
+	.ascii	"v*\336C\005\267\001,"
+	.text
+	.section	.gnu.lto_.jmpfuncs.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375 ,\035\001"
+	.string	"\330 "
+	.string	"\002"
+	.string	"\003\001\001\001?\177\002\004\177\002"
+	.string	"\177\002\003\001\001\177\002\002\177\002\003"
+	.string	"\002"
+	.ascii	"e\346\265\001,"
+	.text
+	.section	.gnu.lto_.pureconst.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375 ]\255\001"
+	.string	"\340Q"
+	.string	"\002"
+	.string	"\003"
+	.string	"\370\007\374\007"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001\003PT\002\002\004"
+	.string	"\001  "
+	.string	"\n"
+	.ascii	":\t\314\334\340e\320\250\b\273@7\351\346\274\254\033\006\202"
+	.ascii	"\334@\033"
+	.text
+	.section	.gnu.lto_.lto.93f97b4b639ed52f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_uvarintEncode.3.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375`\313\002\215\026"
+	.string	"\306\351\222K\260\322U:\370\"P\207\373m\034\347\017\"\271[\310\231\244\033\246\203F%\033J\322\316v\271\314\252\316\341(\335\366\215\247\303g\223;\260\351\346i\320?\224^\034:\016\002\222CMof\305<\275\263\351Dks\b\021B\266\224I\006\177"
+	.string	"y"
+	.string	"{"
+	.ascii	"{\376\320\314\252j\335\tjQ+\360\300\242\244>\376\304\203j\273"
+	.ascii	"K\0212\320\036\024:#\037\265V\030\201\273\310\217\364-\362c\203"
+	.ascii	"\330\221kO\225\344H\233k{\232\247\0324\355\330\261\311yI\035"
+	.ascii	"\364\334\300\301\352\351\350\004\0179$\253\227\373y\346\365n"
+	.ascii	"<\222\3009\245\f\204\200xX=\034\355\340\311\364\022\034r\270"
+	.ascii	"\177\276\300\017\323\256\207s.Sj\255\313\273\236\315W\365\335"
+	.ascii	"\355\260\273\013vy\0308'\035\321\306\305\256!\f&u\377v\2014\234"
+	.ascii	"\200\206\214\236m\337n\tI\311\353z\360o\275\350\037\371\320/"
+	.ascii	"R\362\206\254L\222\027d\344U1o\352C\337\222\362\222#\357\310"
+	.ascii	"\274\364G\337\036y\231\362^\200\331#\300Y\353\206\342\217:ct"
+	.ascii	"1\342G\377nm\177\256\271\273G'\264\252x\020\204\244\243V \312"
+	.ascii	"\307U\320E\027\206\b\030\370\024\265\007e\016\240V_\f\0300\025"
+	.ascii	"&7B@d\377\226\024j\240%]\"\351\360\362~\036\002\017\221\222\364"
+	.ascii	"R\026i\263y\273;C\232\315A\037\242&\034G\321Zk\035\373\367\023"
+	.ascii	"r\325%\335&\316\234N\371]\"\315&\351~Q\314\021\307\336'\305\314"
+	.ascii	"X!D\354e\310\217\314b\367d\253\237\221\334cS#\335\315\273\325"
+	.ascii	"\264o#\367s\343\342\232\315\255\302A!}\360\301\240\375\333\221"
+	.ascii	"~\323\210\234p\034\265\253~\377\274\201\261\030\263`\210\275"
+	.ascii	"P\032\214KWP\211\351]y\301\310b4\225\030\0130\331\254\245e\266"
+	.ascii	"\002\223\305TZ`+\264\027\330\313dg.,4\030\314lF\203\231\300\372"
+	.ascii	"\366\255Y\243\324\257\227\302a\351\352\237\227P\243D\276\036"
+	.ascii	"\022\322\233b\353\233OjA\332\325\327\021W\274\033\244\233\007"
+	.ascii	"TNG%\233\255\276{\262\265\252\237\203\354V\247\\\302\334\317"
+	.ascii	"m\300\260xS\216\253\356\346-\035\315.\233G6\005\"\247n\262\333"
+	.ascii	"\210)9 p\002\021\203F\017\253\002+\353\206\263m+\356\261\307"
+	.ascii	"\305\031&^\260\t\016\334\311\271\017z\206\243C\fZ'\265\236V\241"
+	.ascii	"?Zb0\177\337\320\3337\214ES\225\270\273\240\213P\320\307a\221"
+	.ascii	"Hd\244\321\300\23603\212\001\036\235M49\343B\212\241\034\002"
+	.ascii	"\020\205q\"\310\253\bH\031\202\205]\366\bH\\\205\177XKHw\t\265"
+	.ascii	"\361\361\240\346\027\211`\235W\307vq\"\232o4\355\224~\255#\320"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_uvarintDecode.4.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375`u\004\035\037"
+	.string	"6\372\311H\220\332\321p\005\201("
+	.string	"\b\202\005\302\223\317\\Dc\221\260\177\252\037V=4\306|m\233\200\346\f>\317\321K\232\307\017\354\260$\347\0213\362\334\004\352\265\232\211\364<\311\372\355\005Y8\316\026\210\2676\273\367\336[\312$\003\274"
+	.string	"\250"
+	.string	"\264"
+	.string	"\267\275\226\201R]b\301\252\f\214\252\026\023\334\\\bi'YJ\323\200\263Ll\341\235w\217u$\300\027Q<\247\252SWOT\265\250`\023\2447\267\230\376\310\255\200\273_\030V\224U[V%gTU\345\375\\\347\274Y\036\300y\263q"
+	.ascii	"\271,~S\006\276\226\242\247Y6\003\367*^\023\203\021u\256 \247"
+	.ascii	"\003n<\021\217vH\023\246\306S\324\317\222\302\024\250+\234\223"
+	.ascii	"\260\274\2152\243YV\250\322B\206sZQr\210\"^\b\214(.K\tWEt\340"
+	.ascii	"\234\326\262\263\216`G\236\207NM\334\347:\002/aj<\021\317\350"
+	.ascii	"\220\252\252\313-\234\236\276\266\357\256\221\335\245\260[\376"
+	.ascii	"\002T\275s\357dC\217\311x\354Q\2347\177<\313 R\204\f\023'w\213"
+	.ascii	"*\270\251v\377@LJ\325\366\324nP\215\027\350\307\347]\337\335"
+	.ascii	"\263\376\036\335\223\374<;/\376\002l\274:5\336\234o}s\327\372"
+	.ascii	"\342\240\2747(/\016\345\265AykR\336[\312kCyk(o\212\362\242(\357"
+	.ascii	"y\362\232'oy\362\266\311\313\314{\002\013\264\002\200\251\352"
+	.ascii	"\213$\032\325\212\351\365\343]\377\326\257\365\336\375\356\231"
+	.ascii	"\354\221{[\006\016\200\357R\372iU\225\372\002d\302\227\354\271"
+	.ascii	"\366\266\2654\024d\201\301\313K\204\364\346w\201\373\343\006"
+	.ascii	"\350\255\201\372k\032\223\357\264\365\255/\224\322\265\255\315"
+	.ascii	"3\2635\255\3268\262\267\020\223\366\331\265\346\257\025j\247"
+	.ascii	"\321N\273\244\"D\023\324hs\2315-=\273\301\306v\306\204\3208\221"
+	.ascii	"N\263/f\344Rv\267\331e\226\225x\2453\250\3136\221\253U\220\223"
+	.ascii	"{(\327u7zv\\\275\202\234|\325\230\321l\252=\362\031z|\351]\007"
+	.ascii	"\365p;\327\272\036n\3318\275\323C\363K\247\256\331\210\305\030"
+	.ascii	"\326\304h<Mf\214)G\234\334?c\225&F\333]s\267\231\344\232v\257"
+	.ascii	"\023 zr\2308o\356\232\221C\031\271\356\351\367\221/ <\023\016"
+	.ascii	"\t6\226\262,\256\356\036\336\3531\322?\224\350!\225\277$\021"
+	.ascii	"\035\202\210Do\221P\322Q\357GDb\004\357\310gd\344+\342\035\365"
+	.ascii	"\210\214xE?$\236P\317\372D|\370\361\222|\276\037\357"
+	.string	"VT\337S[\376\312\177|\n&\bV*\364\233Y\330\t\244\341\205\0173\305\367\353\314\311\351\035b\352\340\216ZSm\215\013\232\241G\030\357\360\310\247]\202\270@}\372\307_@b\361\016y:\327\027c\234\322\304h/UUU\323\246\372\322\231\353\237>\327\017h1Co\340\304i\237~@<\n\245njp]\3237\3752+\024N\3334\256M%B4:m\223\363\225\274\322\271k\235^^\211\301\232\356\030I\336\2321\025%V\250Q,\245\b3\206\031F\204f\302La3\006`\002\021cX\017\020X\214\266\245\003\375\212a\220\273\257\371]1N}\312\240\364\201P\207\302\020\341\005\262MY\200\236\214\315\343@\026\303#\022\206\234k\347H\275\2146\265\305#hy\200\230z\b\340\001\364\211%\023\330\341-\361)\320)\021>\033pO\360\326\230\037y\365\360\005lm\006\007Z\220(\"\342\207\3613M"
+	.ascii	"\227tk\223\236\225\260\346\240\313G\276i]\261\024P\235+P\245"
+	.ascii	"\002\203;\254\365~\310\323\026u\\\355q\271\252\362\025\340\364"
+	.ascii	"N\nZ\320\211\331a\204\250\210\f\326=V\327l\316\377\013ASU\235"
+	.ascii	"\214\377"
+	.text
+	.section	.gnu.lto_.symbol_nodes.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375 4-\001"
+	.string	"\3500"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\005\252\333\3426\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\006"
+	.string	"\002"
+	.ascii	" G\032\3141"
+	.text
+	.section	.gnu.lto_.refs.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.93f97b4b639ed52f,"e",@progbits
+	.string	"(\265/\375`\205\004\275\037"
+	.string	"\366\374\322J\240\230Nc\200\310\003\036p\207\203\"\036!\207\341\231\300\036\303_\2655\322\372q\275\346&-[\021\314+\343\034'd\337\303\3652%\240\204\300$8\016~i\341\311\037\206\207\324&\034qxC\001\320Z "
+	.string	"u\270\331\274\311\226)\255"
+	.string	"\275"
+	.string	"\273"
+	.ascii	"M.DD4\326\221\264\357\224\224)\325\244Xb$o{{\\\266\346F\371\372"
+	.ascii	"\270D\267\374\330\267-cP\\\020Gr\346\n(I\234\351[S\326nMi_\250"
+	.ascii	"\333t\237f\351\320z\342\317\336\306\260\256!\337H^\035w\307e"
+	.ascii	"e\256\223mp<;\237\336\364\263\265\227+8\256T\031I'0}y\270\366"
+	.ascii	"t\034\217\246\257Ly\313\256Li\366\n(\315\033\240\264=\205$\314"
+	.ascii	"\266\327\213}s\330v\262]\301v\002\3331\266/\264\330\327\206\355"
+	.ascii	".\333Z\266\211\266\253l\377\260-e\373\3116\3156\227\355YYYY\231"
+	.ascii	"m\325v\222M:\b\303\363\226~}\372[O\330\316\016\317\264\007\330"
+	.ascii	"y{\273\006Sv\030\274\245``,\212Q*V\\'\351\357&\200F\250j+\246"
+	.ascii	"\354z\262\377\022\203\256\"\370\215V\225\f]q\255|E\023>*t\275"
+	.ascii	"\354\377\002@\337\321\372_1]Z\377%\337\206\003oN\266\370\031"
+	.ascii	"\267x\3060\372P\320o\340\354\017\374\317\373\342\377\363?M5b"
+	.ascii	"\377\026\266T\t\b\374\205\004\2007:\257\202\376\221\270\304*"
+	.ascii	"\230\266Gk\356*\252U\272\020{^\245\223\rU\263=\235>\364\377B"
+	.ascii	"1\225\202(\236\214\344\005r\203\\\326\\\267\312\245*dO\204\021"
+	.ascii	"\"$\3055\222\3261=\342\232\213\352\307\214\204\216(Ul#y\271\356"
+	.ascii	"\224Y\344dJ\221K\005\243\344\313B\272E\246\357\325\025\342\213"
+	.ascii	"\305^\254\253u\177\364\302\237Rj_eBYT"
+	.string	".\024\326\320j,yY\021\361\325\262mp\234\345\3627\375\217q!Q\"\311i$o\326\225\"SH)b\032\311;\344B\261P!Ja\214\244\245\\\253\331\221\2430\337H:\2039\332\345Q\365\377\t\026\366\252\317\305\227\345\336\032\373\345\316.\002\333\344\317\344\007\326\210b\336\250B\213F\322\366\314\001\260\377-\375\375|\333\016\325\264M\n\336\216\336\230~\303\365-\032\264\331\324\337\317\224\3750\230~\370\001i\213\236o\321\337\376\341\323\377X\325\226\266\303`\332\006\034x\274\007<,\272\b1\346u\320\001\341z<\036\020\016\200.\003\257g'\341\305=>@\272\235N\203\351\233\034\0059:!h\326\331a\260\303\240\264\316N.\267\223\2233\235\223\233\365xt\"|<\224=\036\233\006f\217G\247\267\363\371@s.\007a\306\002\205\tf\317\202\336\316\007\b\003\210\017\270\035\357\347\207\327\203\333\371`\370\301\365"
+	.string	"y\300-8\340;6\033ael\274d7\211\357\230\357\245\241\2211\245hI^\261\361\206]$\276b\027\314\345\307^1\022\346^\032\226,$\024\252$}g\230\267x\263z\335/\337\242\3317\025kV~\364^\232\332\2754\343\r*\024WJrk\353v\231\277:\373_(Qj!z!\3042\342\333\005\203$\343k+K\250\261\030BH\021E\004\310\231\211\204$\020\025:p\002\0212\235\016\021\200\036\302\240\005\205\345\372\006"
+	.ascii	"\351\372\365\257\020\023\363g\241\345\240c=H\206\37565\313\022"
+	.ascii	"\373\235u|]\274\031\226zpr\367s4\227qn\314\205\367Gt<E\221\206"
+	.ascii	"\345\207\3120\226\242\235X\362\030,n\001\301Z)5\325\2014\342"
+	.ascii	"\323\265\234.*S8'+\005\252%\365F3\207\256U1\333\316^\312q\244"
+	.ascii	"%y\274\220C\034\376\361\373mAR \033\301o@m\036\252$\035\351\232"
+	.ascii	"a\341\315\322$\274\001\247}\332\361C\337b\361\321c\2324"
+	.text
+	.section	.gnu.lto_.symtab.93f97b4b639ed52f,"e",@progbits
+	.string	"uvarintEncode"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"uvarintDecode"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.93f97b4b639ed52f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2646 @@
+	.file	"config.c"
+	.section	.gnu.lto_.profile.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\036\002U\f"
+	.string	"\004\021\022\003"
+	.string	"!"
+	.string	"\246\274\335\377\005\016\002"
+	.string	"\002\001\002"
+	.string	"\002\002\003"
+	.string	"\002\004\002\005\002\004\001\240\342\234\212\n\004\007\321\211\300\200\b\350\223\272\372\005\t\240\270\375\251\005\002\002\005\002\002\n\262\374\202\245\005"
+	.string	"\013\252\213\336\345\016X\002\006\005\002\007\b\t\002\n\013\005"
+	.string	"\002\f\r\001\003\002\003\016\273\203\325\342\t\021\322\377\355\254\r\224\017\002\020\002\017"
+	.string	"\002\021\022\002\023\002\024\002\025\026\027\002\030\031\002"
+	.string	"\002\032\033\002\034"
+	.string	"\002\035\016\002\036\037\036 \002\035\013\002\013\035\323\307\351\365\016"
+	.string	"\036\235\357\220\225\013\002\037 \202\312\321\202\003"
+	.string	"!\267\333\375\360\007\"\227\316\342\246\007"
+	.string	"#\312\302\204\263\006"
+	.string	"$\377\354\255\233\013%\236\376\250\313\b&\350\300\306\254\005'\216\345\326\013\004(\365\336\333\371\r\b\002!\001\002\"\002\")\334\237\214_*\261\340\353\213\002+\352\263\360\321\b,-\277\265\220\001.\244\237\270*/0\240\301\276\347\0171\271\230\252\375\00623\240\342\234\212\n"
+	.ascii	"6 `\202dC\343\006U\362?}\275\2035\320\n\202\202:\350\360*Ys)"
+	.ascii	"T\254+\237[\301%\f\013\271\267!\315\226\013\\\341\314DOW\303"
+	.ascii	"\n\031g\001p\206\251\005}\036H\033\334\270\227~rd\237\301\275"
+	.ascii	"\035\224\363\316\306a\213\341\035\337R\016FP\030,\363]\347al"
+	.ascii	"\335\\\026\246<a6z\336\251\215K\341\032rL\024\243\256AE|c\323"
+	.ascii	"r\327 VQ\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"\335\003"
+	.string	"\364\003\003\001"
+	.string	"\025"
+	.string	""
+	.string	"\001\007"
+	.string	"\003\b"
+	.string	"\003\t"
+	.string	"\003\n\013"
+	.string	""
+	.string	""
+	.string	"\001\021"
+	.string	"\001"
+	.string	"\035"
+	.string	"\003\002"
+	.string	"\001\036\001 !\"#"
+	.string	""
+	.string	"$%"
+	.string	"\001&"
+	.string	"\003'\001\001()"
+	.string	"\003*"
+	.string	"\001"
+	.string	"\001,"
+	.string	"\003"
+	.string	"\031"
+	.ascii	"6\ta\006\266I\226\250`\224\242\231\031\327\324ET}(\213\261\340"
+	.ascii	"\006\263d\234e\226\312\240+\016 ;\220\030\310\262\017T!\200\334"
+	.ascii	"\001\236\"Ea\026\324\332s\212\024`\b"
+	.text
+	.section	.gnu.lto_.inline.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\326\004\245\r"
+	.ascii	"\202\316570q\323\001\200(r\f\226v\215b\254}\024\230\"\226\346"
+	.ascii	"u\340\016\031\260\202\255\017\314\207 @j\315\273\017\243\272"
+	.ascii	"00\020\205\332)\336\365\301\202\343=!\261[&\231\002\2168\201"
+	.ascii	"\240\370>\2104\fC\234\312\326t\345\224\221\222x\202.\034 \037"
+	.ascii	";D\3078\361\026\233T)\323h\033{Z\214T\3309\337IR\223H\214\307"
+	.ascii	"\200\033\030\026:\205\354%\037(\3202\226PB ]fw;\006i\377v\327"
+	.ascii	"\362\201\2467\273{\371c?\271k\220\274\300D\026N7>/EC\222`{\367"
+	.ascii	"\2350\322\273\255\333=\025\032\224\301\364T\354\356\205=\272"
+	.ascii	"\002,\321\237i4@\332\366<\3249\324\335\266\200^y?\373\356ne\217"
+	.ascii	"n2\323Qcp;7\305\311A1\201\354\002w\274]\250\021\266\242HH\223"
+	.ascii	"\032\205\326P\"2TW\036\022\300\323(\311d\bIA&\022\210\004\024"
+	.ascii	"JPQ\301Be\030\003v\340\243\370\242e\261\234\235B\253\362 \374"
+	.ascii	"\214M2!\030Ro\013\2430[\032\206f\221%\253\312\267\fE\213\004"
+	.ascii	"Z]\227\276\214\034\346<\\\327\035\0034\216?\375\221\277\374\371"
+	.ascii	"\343\005\227\271\272\306/\247\323\243\316i\265Y\217Y\351r8Z\361"
+	.ascii	",\214\221f6/\024\236 \306Vd\230p\2155\377\360\321S2\236\"\230"
+	.ascii	"\006\320\017\\+Q\230\250\362\034\006i\201\003(\227\352\201\250"
+	.ascii	"\351P\353\252\320\237\032(\264\351i\005\355\263\234B2\206\226"
+	.ascii	"\276\360\200\2646\005\250}!A\006\017j\316q\357\261\311\334\251"
+	.ascii	"\214i\345x\031#\227\013\343'\252\224\031\3120\233\352\200="
+	.text
+	.section	.gnu.lto_.jmpfuncs.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\321\004}\020"
+	.string	"\206SA=0\307&\351\300"
+	.string	"\357\240\273w\367\374~U\356\356\375\255\356\254\256X\264@-\361\204\305\323B\243`\370\b\226\252\301\300\300"
+	.string	"/#\"\324\355\307\3633~\270xX\301*c\276%\255\265\235d,"
+	.string	"/"
+	.string	"4"
+	.string	"Mh7\255\246\237\330\346\243\366\243\206w\003\177\031&Y:\252\331\222.8\307\330uWm\314\302\366Z\357}e\375\312n\257\207b\001\002\247I\303\206\367\336\373\2726\233\3478N\263fE\347\320\271\363\244!>3"
+	.ascii	"\207<Q\332\005\341w\231\2179\343,STr\305\272\332\205\266\n\r"
+	.ascii	"\016\272\201/p\206\314 O\025u\005/H\221\216\032k"
+	.string	"\216$\t\303Y\322R*\001'x@\251\224\231T\031\311\245H\316\324q\235\367\247\365O\303\177O`\215&mC\035\r\324b|\366`Z\177\321Z\264\025m\210\302\323\202\236h+\321i\004\204\006\212\320:=\362\003#\216`\304B8B\236>\022\204sW\017\032\034~\250\201\301c4\224\024\025\264t\200\002\221*\033=\022\340\3420\216\263\224\303\316\211\220\250\262\263\237\001\210(\207\b^I\306\341\310=Q\210VPQ\226\230l+\377\203:\276\365\006\207v\001\002h\362\3320R\375\021\030\223\240\274\0264[/\024\272\317i\311\240E\003\372]\022\334\233\2007\354DE\244\344\355\377Y\236(H\276j\335\301\"?\253\246\033\375\026~\001\256\324\246@\211\277#,\363|\031\210]D4b\207\263KML^\221\354#\221\020\210\313\335\363\343B@-1X9\264[\001Qx\201\344&\035-\356\036i\355B\310\225\373"
+	.ascii	"~\1776\3257\202\271\r\222G@\374\357\001Ty\351tu]\361X\264\305"
+	.ascii	"]\252\026\252\r]\3446i\2058\213\20125\342\372\341\361rp|s`\263"
+	.ascii	"\276\374\311\302\276\272\351\306(\240\237\006\263\021\260aa\234"
+	.ascii	"_\0269\023\322\213C\"*\223d\025\237\377\333\250\212\267\210\223"
+	.ascii	"\037\220\001"
+	.text
+	.section	.gnu.lto_.pureconst.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 D\375\001"
+	.string	"B\304\016\031\220U\215\001\377\307\373\034\350\356\356\256\277}\234\347y\376\210W\017M\303]2^\345\2247\031\220<\362 \177\334\361\306\031_\\\361\304\021\227\341*\234\360\006O\360\002\267\303\314"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`B\001-\b"
+	.string	"\362\212 &pM+\007\374\377\377\377\377\377\037\221\262\333Idqdqdag\036\036\f\203\221$\3058\267\332Z\267\246\225$Sj\303\303\260\327\363\032D\022\262\205UA\235\004\204\003\237\001T@\360<\007\024p&\353i\355\252g\265\373\330y<;v\034\273\r\215g\306\216zR\016\343y\261\263xV\354\246/"
+	.string	"\222\243\330MH\034\261\223\236\322\214\245\002\361\214(\2231\352\334\303\256y6\273h\007\0351\300\035\002< \240\002\022\272\342\001\243N>\016\022\356\333\n\212!\260Pm\031\267\275\024\306s\251d\013\3526\n\330\031\006\f\007}\211\220\316\360\206\020\235\021^\2149\313\036\023\366*\321\220"
+	.string	"\033\303\305H\210!*\004\314\353e#B\002\022\344M\303\356sf\376\027\212\023.\323\026\311r\3319\352+4H\360I\254\376"
+	.ascii	"\306\214\017\033\017\005\343\031\226\r\306\353 \261;\032\221"
+	.ascii	"\216\253 t\023a\tf\300E\031\002"
+	.text
+	.section	.gnu.lto_.lto.a6f2ee45e073ce3c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pilotConfig_Registry.137.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 \237\225\004"
+	.string	"\024\bj"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\303\356\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\006us\250\305\006uq"
+	.string	"\005\001\006'\001\"\005\001\006\035\001'\001\257 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/config.c"
+	.string	"\005"
+	.ascii	"\256\222\360Sv\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pilotConfig.139.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 (%\001"
+	.string	"\340\030"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200\020}{\274\001y\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\243\f\240\b"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.143.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 \240\225\004"
+	.string	"\024\bk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\203\366\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\021\005\001\006\035\001'\001\222\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/config.c"
+	.string	"\005"
+	.ascii	"\257\222\320Sv\301,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.145.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 ]\245\002"
+	.string	"t\004J"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"\005\001\006\035\001\002\005\001'\002\206\b\177\005\001?\202\210\200\340\001}{\273\001y\273\001w\273\001u\277\001s\273\001q\273\001o\276\001m\275\001k\273\001i\273\001g\274\001e\273\001"
+	.string	"\005SITL"
+	.string	"\004"
+	.ascii	"@\204\315\313S\206\036@\021"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.146.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"b\f.4Pm\222\016\244\034\240*\247\352fm\323O\013\333\314\362\264\226\177\353\035\220\033\332\355hC\357\234\212/\215BTUE\024/f\027\020b\fz\210\303\332'[\246S\031\b\315\303\246\242\336F\323\020\361(\213\3632\004W\022\016\326\233\250*\353a4\254N\264+\300\334\347\347t\204\" \023c\341\212\264Tq=:m\321\301f\235n\347\322\t\235@\t\303\355\265\017\272\321\327\222N\364\343\350\006@N\016R2A\333J\232L%\037\277\3471'(x\276\252\221@\227\221F\006\211J\246\366\\G\257\342u\033R\013\ni\313B\027E"
+	.string	"\206\314\034\263\320Fw\375\r~\204\237#\t"
+	.ascii	"\252\322\t\314b#\206\024\024\002t\r\377\213\030K\210\034\356"
+	.ascii	"\234\251\235O"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.148.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 \363\265\006"
+	.string	"b\214.5@o\222\016\230>E\267\325\001\341\003\334(F|La\376\313\320v\227\013\271\215\315\236u\264\234\026xQ\203\217axT\311s:\220u<\202\326\240\265\366\311\226)W\233\007\216C\307\252^\207\303"
+	.string	"\361\252\313\3636\003[\021\r\327\223\260\254\353i\266\254\216\264#\310\\\350\367td\002 \363B\341\212\324Dq?J]\361\301j\245\356\007S\n]\200)\303\323o!t\245\357%\035\351\307\321\t\240\250\034\224d\212N-\231B\235\200\374\240\327\214\220"
+	.string	"\032\353\326!\302\22460HX2\267\3478\212\025\261\333\220^V<L\264\221E1\263\220\231\2436\312\350\256\177\301o\360k\004\t"
+	.ascii	"\252\322\t\314b#\206\024\024\002t\r\377\213\030K\210\034\356"
+	.ascii	"\234\251\235O"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.149.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\025\007"
+	.string	"\"\31506@o\222\016\230E@\217\302\f\f\210F\241b\222\333#\225\035\207\215\337^\34466{\326\321rZ\340E\r>\206\341Q\341\322\034\tNNIw\036\254\221F\210L\001W\233\b\016D\307\252b\207\343 \021\253\313\0237\007[\023\017W\244\260\254+j\266\254S\276\321\017!{\241\337\323\224\212\200\314\f\206\213\322\315\342\222\n\277\370\270j\205\367\363\004N27\363[\310=\217\357\224o\364\273\335\033XiYp\311\334\230\221I\026\2502\362\203^sIZ\002\032s[\b\007U\"i\224b2\267HP\003\252\320\265\200*| \305\352\260[\223N/\"0\232\b\243\016\240!3w\232\250\243\277\376\t\277\302\377\021\n"
+	.ascii	"\252\322\t\314\264\312l\034\n{d\260\3105\3746bd!\362pWL\355$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_resetConfig.150.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 \324\265\005"
+	.string	"\"\212&1pi\323\030H\031\020\340\362W$\b\236\336/\032\222Z\214z\207\026!\302\305\210\2336\2663\n\363\335\377[\267\376Ee\203\266~K\366\353[\271e\nG\020F\272L1\202\223T\311\300\210\332@\350q\324X(\310\211\221\202\317\266\251\032%\353\004\364Z\337w\002^b\277\006\211\356R\3537\353\351\301\347bU{}\n $\017\273\004\025\024\3331\034\024\376|\256>\"\267\204Mna\200\233\330]\250\bY\345\253\316dH\007\226Y\371\032\223\335\375a\231A\256\371C\376\310\017\020\t"
+	.ascii	"\252\244\233iq\323\031T\341:\327p\262\020\306\313\020\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_activateConfig.151.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\237\003\305\030"
+	.string	"\246\252\227G\260\030U:\322\226CwP\233~\275\026\240\330R\364\002\352OJ/\020\222\t\341\264\316!\366\354W$\304\266\366\335\217\327\\\322%\212e\241\340\216\260\257T\320=\233S\254\345g\203O\023\372^t\375\211\032\331[J\231\002}"
+	.string	"z"
+	.string	"\213"
+	.string	"\315_\00287\245\236/\265\276\0306\325\340\264\"\344\377~\231l\022\213\355\375t\003*\251\265.\322\362\376\025\273\344\027\204+~\026\177j\347\246N\377\245\355\351\352)\367s\341dM\255ul\037KW\234\262\231~w\267"
+	.string	"j\266\330\212\250\031;wj\255)\333\020\313\026)\033\215[&\310\321%\006\216m&UJ\2703\273[&\262\r1\237\032\324Z\3175\333m\177\332\377\257\377\017\376\026\006b|C~\263\213\376\022\271\005\b}e8l\224\027\017u\357\260P<p\323\230'\373c\201h\265\304\235\334<4:\023\023\356\212d\b\\%\215\022\217\336\227\270}\323\306G\206\306l\376\273\326\311\013U+\315\347\353\333&$\276@v\036v\202\267vB\334\271\235\272\t\217\220d<\374{3\356\334\277\262v\321\337|\325\344\353H~\316\344\243&\377$\362\305\311\237\315\227\222\337\315\347H\250\320$K\016p\367Ow\224\311\016\255c\367\322\315K6j\310xHyG\034\374\f1\300\177\204\237\335m"
+	.string	"(8\202\263\216=\247\277[\226\213\212/\220K"
+	.string	"\002\342-\002&\340L\314\217)i\265\250\220Rt\265\f\233e\202\f\243\253\265.\270\262X*X\b\342\255\005\211;sz\223v\302\300M!\362\361\233\241j\235n).\332,\357\030\266\n\025U/o\307\036\300#\035F\365\257a\003o\355\251\035\264\216\241\304\316}w\003\027\261\372\34021\246\020\321r\215\b1\340\254U\313\025\242\004\2145\226py 1\262\204P\214\253\002\207\231"
+	.string	"!4\246\200\301\204\306TO\266\262v\321Y\362,7\317\3364q\001\316\236E5\021\005\030AY\317lk|x\366I\006\2451\324\261\213}\262\261K\364\006\032\261WFH\262g+\300\261f^\250%\263e\250\016\036\024Gq\342N\331\f\212\2509\312i\351\341\257\220\032\201\3310\364\007\rB\205\310=\032\221\022\241F\260\004i\035\013Y\250q,d\224t\210L&JS\220\244\003p\002\241!\264\016\020P\312\030&\313\032\357=\324I\241\363cbQ\232Op \225\232\365\377\240\335\332\"Sw\336\260\243\317<\360\033;\366<\250D\177-u\355\313}y\375\347\307$y\351\361\\\366UU\274\030(nG"
+	.ascii	"\211\215u\336\257\272\322!\335\364\037\3660\241a\224m\371W9\025"
+	.ascii	"\202\344Bl\360\005\345*\222G\3021'oN\310\317\242W{z\357\376\016"
+	.ascii	"~\374\262g\206\353\266\341\356o\232\001\220\023\363Y\344\203"
+	.ascii	"`\354G\210\272\323I\220\272\0063\375\026\206\366\177kQ\177\312"
+	.ascii	"\200Q\305\376\310_\2317\363V\231\256\006"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.153.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\234;\375\325"
+	.string	"zE\235HI\020\020\246\355\214\0017\374\270=[\b\217\263\020%$E\316\302\025L\313\216\340\r\267_\221\334\3456\220\356\310.W\016\f?t\212\371\034\242\232\356v\221/?\263W|t/\364\205cb a 7V\006\036\265\2242\245\224\002v\004\"\004\226\004J\346\346&\257\302\375&\353\317\2518\025\234\024j\2323)yRaPq\274\t\346/]\344\026\242(\223\346\303-\013YnU\356GB\306\353\367\312\333S\310\322PQ|\337\227IW9H\026\033\225\232\034\304Rkj=\214!\n\217\332\310\214\214\247c\372\346\f\017?\236\236\305\303;\374x\210\324D8;|\212l\241\035~<B\352\324\203>\265\033\321\325\215^\035fU\250\223\343.$D\002z\262\002\222\223j)\n\001j\026\214,\220\352\247\207\214\217\332r:\217Y\210\001\320r|!\n"
+	.string	"\376\2016\222\335\361\241\356\210b}d\233\236\033\326\233\336:\207\345\244\345\370\343\310!\343v\343\216c\241f\341\220.@\243r@B\273\361w\375Q\331\204v\343\243.\324\255\263\025\215\326k\335\306Bl\032\312l6\024J@\251\275WA\326\264\231"
+	.ascii	"\250\331\022k?;"
+	.string	"\215\331j)\254/\226\332{\305={\243\366C\255\213\332f\201\232C\333,\313\250\301\354\263e\211'\265\267\252\355\232\322\346\214\372\276o\222\232\345\026@\3152\231\023[\r\354\375\371\332\"\325F}\337W\351\277\220\242\323\303\377O$\"\"jl\333V\221\210\210\210P\317\216\345\370{Ukv\201\201\331\254\207\033\231\221\3630\036^dGV\344;\234\310\210|\310vx\312R\216\262!S\271\312{\370\221\353p!\023\362 \0132\035\016d@\376c?\356\3439\314\307{\254\307y,\207\3618\016\3371\034\266\3437\\\307n\230\216\347X\216\343\030\216\333\360\033\273q\033\2631\224\331\360\032\253\3610`\207\216\0348\n \340\206\215\0324f\310\030 \206\022\214\027.\222Z\260@Z!\200\212\024(N\230(Ab\204\210\020 >\034y\350`TD\304a\203\206!e\006\f\027\204\222A@?-\273\2763\271\273\264"
+	.ascii	"\247\256\236\232\365$:\225\324\271\221\361\2609\317\241\035g"
+	.ascii	"<!\270\232\207Ne\352\274\210\330\354\270\006]\261[\013\301\325"
+	.ascii	"\274\263\332@\fKk\252\033g\305;R~"
+	.string	"\316\211\177\315\210\336\234\343|\330\327l'r\317y*\330\305\327,\005\\c<\3269G\365\232\r\365\232\251|\315\325\276\346=\177\315\217{\332\241f\265\035jRW\256\363\323\203\332I\2673VT\340\352\2126\027\256\037\205\252\025\202\253I\267\352`Ls&\234k\036\224k\026\224\243\003\027\347\034\270\226\220[K4\266q\006D1\327\374\367l\366{\2429\367qu\2355\3171\342j\232\361\205\340j\256i;s\336+[\024s\326\313#k\226\263X\226\005o\261\314\214s\234\305\2622\316wd\302\234\341\214I\004s\266{#\246\271.\213\233\3041F\\\315-g\272.^\234\347\326\241\030\323-\316rD\202qC]\\\232\341\246ZFm\214\270\232XZ\\\315,\347\267\252f\267\020\\\315*+\316mU\232\331\252Pq\206R5\263\241\232r^[U\340\352\232\322\254\026\202\2539e\315\302\325\224\342<\"\333"
+	.ascii	"A\253HH\337\321\247u\360\361\034\217\216c\217\027\320G\320\252"
+	.ascii	"\352\004\364\241\372\215;m\343N\rD\032\207\211>\303N\313\260"
+	.ascii	"3\365\001\354\264I=F\264\225\242\200\016c\235\021\205\252\325"
+	.ascii	"\202V\321\365\302\036)"
+	.string	"\302n\373\363\027~qc\334E_'\315\351\026k\321\234\265E\034\237\263X\207\366\326\030t\216\364\323#\314\025\275^Q\327\002\324\025\272q\025z\235b\256Q\254*\346\326\017'\342\342\344\334\004\\\227\200#\221\326\306G<[\304\023\315C\2345\210\26383\377\260\246\217\326\004\226\271\007\262\356@\346'\346Fa]\024\306g\306\211\3124\2072yd|\203\367\265\0061=\264\3228\274\332\"\204%\261N\243\261\002s\245\240\225\030/\236a\2531\254\"\006\377\306Nh\201\221k4V]\374\302\332b\253O\205\026\264\332Z\213\350t\035\242\261\322r!.\235\\[(\332\351i4V\\\326\242\252\260\251nk\023\202V[<\310\004\327\225\254\006Bc\205\345?R\336fivuQ'\315\026\016Ysu\204\256\242\370\232\341*J\350\n\312_\320*k-\361\276o\267\265S]5\335\177z\274\357\313>uu\245Y"
+	.string	"\315\234\214cf;\346\030\215\001C\337uR<\256\024\210\227@\301\305;\256\b\3306\253\374\216k\026]|\312\236\037\336yhgz\224G\307\243j"
+	.ascii	"\r\353\344}\007z \034\024\354\3007\350\201,\364\001\376\361}"
+	.ascii	"\373\031\365\225\331\233\303W\324\177\205\256Wf/ON\377}\363\021"
+	.ascii	"\275\363M\307\271\203\363y\336\312\264R\274q\275\341\360N&\361"
+	.ascii	"\245]i\2736\b&\317\340\037\273\206^\347J\231\274\200m\2355\036"
+	.ascii	"3\022w\343\332Y\217\272\352\232{\316\336\367\235s:\027\221\335"
+	.ascii	";\356\242\273y\374\276\363\032\005\0267\250\241\334\026#\177"
+	.ascii	"\341Ox\346IA2\234\2256/\033\336\311\236\301\343\332\207<\256"
+	.ascii	";\256\203\312<B*\271\221Z\035O\305\255\301\207\367\333\256c\313"
+	.ascii	"\354V\335G#\217jUE\257\22386\264\326\275\365'l\031B\245CS\212"
+	.ascii	"l\224j-\364\036\266\322\240\32377\241g\241\207\031\016\360\344"
+	.ascii	"3\273\221\314\247\031_\240\376\251\351Pf\0246K6L\251\344\007"
+	.ascii	"\245\251S\266\266P\305\206!\205v\332@^v[\027\230Tm\320\023\231"
+	.ascii	"\342iL* G\363'\263J\025\363\352\252m6\350Yha\365i\303\275\231"
+	.ascii	"+\264\314L-\314\254\255\367\303\352\227\252\242\320;\275\337"
+	.ascii	"\274\214\371\365 \004\311\2720\275xO\361\0057}\200\242\220\201"
+	.ascii	"I.\333\237\357\265;`\362\f*y\267q5\314//\202\343\326\214;{_("
+	.ascii	"=\305\216\306\3230\273\330\311\374\362\257\226)\206I\306{\352"
+	.ascii	"\3471Xy\f\204\372\247 \017af\204\356\372\310\200\332wA3N\206"
+	.ascii	"\231\326l\3211L\261\033``.\206yfe\246a\2161\307\332f\333o6\351"
+	.ascii	"OV\263-x\030f\032\t\347\001E^\354\377\f\346U\333\016\275\324"
+	.ascii	"\202YJ\021\375\"\244\213\232\2553\306\226>\216a\223\264\353\373"
+	.ascii	"\024*-\363.L3\036Z\007\324\340\262>\0171\315j\315n\251\024\311"
+	.ascii	"\326w23\255\375w\202N\241|\017\232c1\323H\200\275/\224\rf^\272"
+	.ascii	"q-\007\024E\337\027\212\200f\331W\360,\t\254>~\264?\332f\377"
+	.ascii	"\177\006\345\224]\320\022\250\370\357do\244\326\237\b\364\017"
+	.ascii	"\312\367\260222R\332H\355\313X\003\030\265\325\364H\356o\254"
+	.ascii	"w:)Hn\300\257\226\200\336\367\265\301^\345V\017p\227i\226#\230"
+	.ascii	"\300{\252Y\356\t\332f\373\231\272xm\241=\241x$\263Z\323\337\311"
+	.ascii	"\334\036\304\326\002\371\275\230\233\261\025;\332\205M\330\202"
+	.ascii	"\035\370\347\327}|\2757\344\334y\275\326\3176k\265\346\336j\266"
+	.ascii	"\346\306R:\227\340SQ\315M\034J3\223\206l^\322{\232Eh\307\346"
+	.ascii	"\020\230\224$ii3\222&l>bD\310\271\210\2203\021\245\363\020\245"
+	.ascii	"3\bJ\347\017\204\234=\020r\026\"\344\334\201\322\231\003\245"
+	.ascii	"\363\006Ig\r\214\2343H:c\240t\276 "
+	.ascii	"\351lA\322\271\002\2453\005I\347 I\347\t\224\316\022$\235#H:"
+	.ascii	"C\240t~ \351\354@\0236/%\235\201(\235\0330rf\240\235"
+	.string	"\177\0309/`\344\354\243\235\025(rN \351\214@;\367hg\036Jg\003\222\316;\032\256YG;\347P:\343H:\027\240t&\240\235o(\235m$\235k\264\264\231F;\317H:\313h\347\001\3329F;+\2653\214v~\321\210\315.\3329I\351\334\242\235Y\264b3R;\257hg\025D\316)\210\234Q\0209\237\340\340l\"\351\\\202\2033\211\244\363\b\016\316\"\222\316!\206\234A$\235?\f9\037%\235=lp\356\220t6J:\027ip&J:s\030r\3360\344\254a\310yh\310Y\251t\316\240t\276\200\301Y(\203s\022\203sP\347i\006j\347\237\244s\233tf/8\257I\347\027r\366\244sw\265\335\224\331\322\372\342\362\206joU$\2377\220\205#\346S\355Q\355P\272!\273\367t;v\347\351V\354F\354\226v\023v\303u\237u\253u\263u\021\270\370$I\332\370"
+	.string	"\356M\220\344\373\371\255\345\227\027\265\325ls\2454\300\324V6\350\241\"3sje\263\346\315xm\2635\242I\036\307\343\360\003\244\201\366&(\201\003\211\035\204f\026\006\201\307\265\013\riZ\364D\340\257\025\226\006A\027\360\r\204\231A\247gf\005<\333fX}\340\306\215\256\242\245\213\003\323f1\005\322f\317k\0034\036\t\222w\25650'\237%$\337f\337Z}oQ[M2WZ\003\354\305\332\302"
+	.string	"\300\020\307V5x\205d\216\370\266\242q\2454\\\254g\\\271\025+\013n\035\2200\257Cf\346\225Ul\r\263\001\306\210\344m<\216\276\272\207\324B\003\362c\332AheV\030\360\270\24614fJZ\003_\343=\fT\272\204[\3110\323\306\324x%1O\006flq\346%\335\262\316{j\3063\265\240XUl\376X\332\255_K\"\300\3028\377\310\030\027\220q\267z-\001\255\\k\327\022/o\271\267\3276+\343\177\234yU\037O/\232\002\003P\r\360Fk\022x\312B FU\2147\312r\300\2536E\316U\017\245+\245\347"
+	.string	"\311c\350IM\312]\325"
+	.string	"\030Od\255\3220\236\203\236\035\353U3/\347\270\217\034\024\267\340\351x\361H^\274P\336\032\031\226#\351\211\352\274o\322'\313\236\025\253\264\301\301\3421@\002\261\370\237\025\334\357\346@\013X\361/\330+\276\035\233\200\261V\361D\240\323\276rV\003\\\322\361\236R\361\030\356"
+	.string	"\003\241n\274sY\3302/\007W)\313B\033RKC\245\250\245T\200(3\3244R\031\213\304\300\261\331H\361\001\370\372\262\2636W(\353\323\372\246x!\302\306\262g\215\2576\212G\341\253\013\361!\373\360yDQ\245\261\330\236x\"\313;O].*\201\3612\317;.\033WD\227\216\257gY%\001\306\370\215\313\307e\237e\3442\262m\366\304\013\0212\232x~<\213w^1C\2117q8};\031J|\016\257D\022\317\037u\261x\224\335\2477tW"
+	.string	"*\374:n\263\335\300\242\214x\022R/\310L\373\300\247\343N\241r\253T\265\315\216\370\034^\210eO\023\\\304\363\377\271X\276\357\375\334\025\206\232\021[-nV\211(\377\304!^\304\277\340\362{\314\264\274\327s\273xq\301\200i\233\r\361\005\020\036\226=\2338\263\353t\277\374\216K`\363\237f\274\363\316\225\252"
+	.string	"{\337\027\216+fD\324\016\003T!\231\214\017\004\361\027\320\220y7\256X\373\201\321\271c-g\016\304\267\237\230\001>\3041\323F\200\301\271c\035\242m>\374\017\033a\214wF\333\\i\n6!\302?\252\233\3519*\275\223\177\f\333\025k\217\336\t\352g\346\327\\1 \265\243\377\361\372+\363\341%.\300i\f\\\035\317\334\201\261zp\317\274\0313MD\224\3354\277\306\035\353"
+	.ascii	"\326,?\331\227\271-\224\271ffm\263\036\276\333z\205\232\276\027"
+	.ascii	"\357\3441I\255\370\274j\320\361F\236\212\315\340a:\317\250H\027"
+	.ascii	"\357,\323F\276\025\177\307c\222\213\366\003X\002\342danL\215"
+	.ascii	"\322KN\214/vm-\334\265\266\203\233\366g\334\265\027{\026\\h\233"
+	.ascii	"\373\366\3266\333a\005\033^\225\305;_\360\255h\306\3475\305\322"
+	.ascii	"\037y*\3665\320\351\267{\255Q\241\017\322;\033\251=\362\315\370"
+	.ascii	"\315\007g\350+\236J\223\031C5\024\003\306VG\306\210\210gxG\200"
+	.ascii	"w\262\321\027}s\301}\230\245\316\213:]\271\216\343\322\275\227"
+	.ascii	"[\367Z\322..\243\357<\351S\315\177Y\202\021ev\355\336\213{\007"
+	.ascii	"\201\027#\333\321\255.E/\024\307M\025N\317!S\347\247\342Da\007"
+	.ascii	"\241aq\203\302\343z)\305\226@\272,,\26692\306\031m\202\177(\230"
+	.ascii	"\027\270\240}'\200\332\315k\211\360^\0057\017\210\327\231\033"
+	.ascii	",\177\205\350\327\267=\023\357\244j\253% ^,"
+	.string	"\324UY\301\300\350F\306hc\232\307\261\304;\371\365@\245$\b{\251\345\360N\320\275\237Z\002\342U\346\315\224\227\302\341\327\266\275\021\037\305\307.\312C)\261D\212\330\360\032\336\t\3727\347\241\270\322\007\363B\275cF\362O\377n\370\216#\306\317!\251p\372\360\321\360\037\231\025\342\235\210\275\2070N\225\212!\r\037*#\210w\362\320+\337\t\n\250\307\225\276\227\301F\306\254\004\306\221%LH\232\234F\370\340\310\223!NK\232\234\2364i*\222\202\225\300pr\304H\023\223\017\2128)\0259b%0\2140\215\240\364DI\022\246%H<\260\022\030N\224\232\230:8a:a\310\312\324G\2144=\340t\344\004&&AK\20609\035\241\300\311\bI\202\2364)q\242\300\222\246\"MO\232\234$pjz\322\364\200\221#N$\204\340\"0\2220!i\322TD\251\t\323\020&JE\234\234(\301"
+	.string	"\301M#\034qRz\322\324\344\244$\244\006\245\337\313PK \224o\362r}_.\036m\255A\221\215G\226\360N\376\231>\351\275\377\251\tI\335\364T\206\317\225\204\246\357\275w\252F\301e\360I\221\207\263|\"\301\332\021y!_\344\177\374\244\260\206<\021\020~\310\226\017\336E\203\360\036\360\242\370\254\033\374\007\337d\220Kd\324V\223\341\340\251C\307\311S\353\301\273\220\357\340=\370\243B)\254\246G6Y:\327\221\235\023\362\335'}r\360\035l\360.\232\203o\361\242\370h\360\033|Ga\343\230i\312+\2706\032\274\016i;\013\351\3308!e\360Nl\333\322\311>\321Q\335\n\263\373\205ec\241\031\274S\351\365M\026`\031"
+	.ascii	"Lx/\016\032\323\324\205\317\2569\342q\035\302S!\265!\214q\213"
+	.ascii	"j\216\020\302wa\020(\326[\023\223\356{v\232BR7i\362.\325\244"
+	.ascii	"\311w\237#\006\237\366\244;\233B;+\3411x\227\022\353\013\276"
+	.ascii	"\004\013\376\002.vM\331\331\024\262\026,x\227\312c\"B\007>;\r"
+	.ascii	"@R3a\362\336\\\302\344;\360G@\267\274U\360j\322\320yy\024\232"
+	.ascii	"3\004|\005\357\315nC\301\023\020\344)\360b\303\314\320yE)C&\310"
+	.ascii	"{3\216\bL-\370\354\024\205\244^\022\031\302\222o\301\037\001"
+	.ascii	"\315\312\233\340\301\276\016\035J\030g\213\237\340;\222\305j"
+	.ascii	"\t\276E\004/A\030\266\213\353\320\237\300|\211\340"
+	.ascii	";\222\216\351\235\254\034\223\244\t\237\235\236\220\324\"<\025"
+	.ascii	"\267\b\311\304V\"\3027\341\217\200b\031FmA\360]\226lD\265\334"
+	.ascii	";!:\220\\\266\364\024\236\f\017A\207B)\302\007>\303\263G1:\360"
+	.ascii	"\017\374O\243\024$\030\253e\251\023\301\226Rl\026\367\256\217"
+	.ascii	"\354\346\324\364YA\005\007\276\037"
+	.string	"\373\007Y\226[\025\316\233<[\222H9a\n\205*\335\001x\247Us\217'\357\303\335)\332\354\246\244\360Nf\257\230\275\302\211GrV+\314Vq\342Q\335S1K\205\023\217\346\274E\264\315\262S\2309\361\250M\357}\237z\313\247^\0263\276Dq\310)\254\324\222\020\235\271=\314\356!\033\265\244bA\320ak\363c\241\330(\313*U\313+,m\263@B\370\006\276\251\275\302\311b\203\032\276A\366\225,l]H\306\274\335\032m\251\005h\212\331\247eV\f\366u\307\270,\273\270a\371RU\364\261\277b#\334:{\372\373\276$\006\360\222\330\302\322$\262@\016\375\001\311y\237#\266\326\027\222\325\364T\201\370\013\364\321mm\201\037\013G\336\271bZ\244\243\317\253\007@\317\364TL\337\317\365}\337\327\310;\233\351;\372\315\330+\237i^W\021\006\236\202\302\2453\204\2613\302A\006\036C\230\274\352"
+	.string	"\022\265\224!\362\343\375\351\303\313\217\357\261\2562V\265\031\362N^\373z\001)\2305p\351t1F\006\370\267\300\263nye\317<Q/V 8[\037\357\324\265\316Y:\221\306\324l\23592\273eV\276\345\327Z\264\350\030\205\314\252\267\356-\305\220Y\232\021k\233\365\361\335\330*\242\344T\237o\370\346\t\346\003!I\335\214\rT\305\013\353 \251\201\236\212\333\203/_\361\322,\3072\360\235\t\024\242\300;y\371O/\313\314\226h\336S\n<\tv\212UE\250\016\336\371\305\023x\346\345\332\022\212\300'\360\037V8\253\035\002\337\215\322'\007=\336\3538\\\367\3706\333\200\307_\330\363O\036T\362\034\003\2414Xl\026S\fz\355y\275"
+	.string	"\351\225(1 \260o-\003%\337k\337Z\177\206O\245m\245[\002\"\246&\0173\023\312:'\247\344\rx\034\177w\224\244\264\235\301 \310b\007\241\241\271\261\300\343\032I\251\247\305\352\202\263\336\361JN\366\253\205(\013\312\364\216?\022#S\301\263w|\003b]pmv<\213\307HA\216\034vA\022\233\305T\202~>\257\001\204\330\250\323q5\331dTsR142\242)H\222\341\243\027@PH,,\324\345@|\003\023"
+	.ascii	"\021\350\"\331T\217rP1\"\321I\322Bag\016\315\250\205Y\366r\232"
+	.ascii	"\260\205\313\325s\032\267M\305=\364k5IU\272\213s\202u\313:\245"
+	.ascii	"rpY\376\352\t\263#\371\335X\016&T\023\2651y\242\211\321\032G"
+	.ascii	"\"\2213\262\201\b_\213A\3178\376]\004\222\346\355U\305P\306\306"
+	.ascii	"\314\327\246\340\363h=\317v\274\371\211B\334\341w.O\204\235\252"
+	.ascii	"\tc\2450\375j\363#}\245\277\025\\"
+	.string	")\"3\215\314\204\030\371\021\347\355\316\353\f\232T\n\256?\353\234\367\222R\361\021\004\222\020\337\021\325\273g\327KA\017\274<\361F\366/\210fI>9\213\230\020\301pr\206\006jgv#\037v\2224<\333#i|s\307\211\306\222W\366\035\307<\330\331,\3471A\007y\316\241\206\223_\"q\340\\\245-ur\246\260KH\376\242Wv\"!N\016\303\332\211\226a\341/\342d\314\263X==k\330\234\305\341\022\213x\363\031$t\220\357\204\233\033A\023\035\352O\314~\b\333f\004\367i\2342\007e)[\323\245Wm\363j\3712\337d\211I\344\262U_K\033\016jz\202\203;\035E\336\240\t\376\221J\352\344A\353\212\016v\204\tt\372\0075\341? \024}X\267B\220dB\220\036\356\307.^\001\3538\222\355'\177\231\213G\374\2619D\301\231\314\254W\372\007M^4P,\372\301\023G\347"
+	.string	"\0047Q\364b\232\346\315\032\036zS\023k\344\265-\021\335\204z\324\204,\247\246\345)/rBNV$aUkN\267\265\306\017~\322lR\242>\t>\026\324Q\223U\311\337\027mJ\323\341\243\310\216\350\201\276j\346B\301\032\277\352wFz\216\001;\016\343#[t\245\017@\255\272Ve\377\252\307\n\334!\231\342c,\016\366\225\177\356\265\311T\306\035\327\2720j\232\331\355\226\305\024\262T\rz\224`uf?P\213\324\310\260N\214\271\246\215vB\036\253%y\312\004C\036\207A\212\306\264\252"
+	.ascii	"0O\330\250\361\356#>\215\321{I\020F\303\275\241\333\006l\f\337"
+	.ascii	":@[\3600\277\225\3231\237oVg\256m\312'\246\034\rtI\202il\265"
+	.ascii	"\353\342[\b\331\374\335\332\356j\2101\256sI`\351L\257\367\006"
+	.ascii	"\336F\322=\032\342&\327\2077\242\225p\225\031\330\252\032;\211"
+	.ascii	"\264j\277G\330\244\304|\376\224I\311\220F\255gJ\365\334\373E"
+	.ascii	"\020\022w@\035!\256R\352\236\354\351y\373\032\242^p\241\350\341"
+	.ascii	"%\312\260\033\030n5\353\277\343D9\320\035\370\\o\332\314\362"
+	.ascii	"L\202\273\356*J\t\3563FYv\252\202\347P9\031\303\312\237a\214"
+	.ascii	"*\236\361\362%\361?\306#|\355"
+	.string	"\273rPVC5#\335\351\r\376iV\323\261\037\020p\350o\252\020X\327\024i\334\no P\310\375!r\274\240\020\244J#/\337J\306V++\032\210\310/\fJn\274?\314\314F,\351\271\274\335\004\300\215\006\246\001#\354.\r\325\250\333\225\263Eq\255\302\0026\036\232n\335\b\021\013\3207Bq\3746\332\334\252\372\3616\306\236\311{\352\317\3013\236\347\274\233D\024\214\267w\020V\364N\271n\354 \202\340\202\240 \372&\322\272}\332\275\243\244S\350\306\226E\212H!\034\307]m\265cwC)$G\346\222G\031\225,U\322\225\340`\333\316\261\034m\355C\222\"0\373.\2576xs\276\310\351\031\316a\026\t\307\037\365\311\016\031>UX\f\017\215\t\367E\217\245\257U\n\003\\\213\211d\267&\326@-\245(\332\304'\334\314V(+r\247\024\303K\tiG\003\024\354\270a\236\326h\327?"
+	.string	"|s\022qj\347\305R\320\224\314\353\274\207\337\254\352\007\362"
+	.string	"\211.t\275=\374>\303M\313[\235\376]\244\036!\030\363\255D\027\365\242#aY\345W\177\201P\250<R\225H\200Fb\342\246|\204N-\3515:\025\361\230\013\210\214\322\336\270\251\225\316%\274:\342\273wfR\342L\021kQ\274\246Lgl\2770~\216\345\376\341\320\223\217\256\251\326\210\271\314:\337\372N/\016?\201I\320"
+	.ascii	"\216=$\240\271\bE,@Tn\250\304>\256,\031#L\276\341\b\326^\250"
+	.ascii	"\325\274\t\354\\;\001\013\366\356\373&q\217%\214\211\240\344"
+	.ascii	"\001>@'Q\030\\\322\236\273\034\245\346\177\216\1773\001\221?"
+	.ascii	"\367\337\020\035\177\344c\332\364\375Uc\177\375e\342P[\006\022"
+	.ascii	"\302\016~\277\np\264\007\031\231\224\374h\262\355a^r5\236\026"
+	.ascii	"\031\264\332\264-\343\272\3568\363`P\224\325[\034\272\3115\267"
+	.ascii	"i\2670\001\357\335\325\022\326\275>G0\225\345\206\202,\024ux"
+	.ascii	"\226#\270\273a=\3050^)\234\2075C\324jA\202\301r\023e\205\034"
+	.ascii	"\367\355.,\301\223\2063\370\024\354\271\214\271\020o_o\202\b"
+	.ascii	"'_:\351`\021"
+	.string	"\376\013\2459\221\002\212\3738\301\377n\340\207\025O]\234b\004X\240\207\345Mp\275(G\244\226\244\262\354\247\225\017\353\261\346\320;\272\226@\t%-\325XS\002\020\3274\207\253\"+B\253\345\005O\325\036H=\320\225\355\314\035\304\210\2559/\373H\326Fn\250>\021\3761S\220\207\265]K\025\211\337\263xV#r\265\200^fE\350\255\370\212\305X\b\304\fx&\240Q\031z\271\236(\206\034#\265\325MR\234\257V\210\352\033\320;\352V\361\003\322\030\360\247\317\271\351\3406rT\257\314\252\341\334/\006(\331\240<\027\342\375\026\346\260\3627}\217\237(\201\231\306\222\310<\004AL\367\021l\220\023Yt\240\036\343u\\\334\323\313\252\352\323"
+	.string	"!\374\\\276\214>\244\346\317\351-+;\177\351\034\344}EK)h\324O\277a\315\251\321n\373\234\024\302\331SZ\367\3010\242\265\333\273\223l\350\364\210\363\225\212:\033\001{\013\253\315\372L\261\347\267\351s\211\257\341!\362\277\237\371\376\017K\350\223\"*\223\214\213F\016\235\004\341\022\220g\323\274\232\003\325\254\372!:\037"
+	.string	"\364r\\\301*\210:G_`\200\321A06,!\304)9&\262\016\205\226I\300\027\263\325\266Z@\354G\307\320\322H'\350Y\235\017&\227\311\005\005\364q\3645\266,\317\3179]\216\235\304\374\313\266\001B\t\024\223\240\35406\312\3143\260}K\226Y\255\234\215ks\2149A%o\2032\304B>b6_\335\241Fg\350\222\357&5\022\305c\030\034^\240V\007\335\232\233"
+	.string	"\276\370\245\251\330\r?\301\333\254\333\210\252l\255\277\0231\022\371W\023\246\022\\=V\200\022\354\311\345\323dS\316\317h(\230\306+\312\211V\364\300\022\350\357=\261\3134\261-\021hz$\357\262\026\211\032M\364\316.sb3w6\233,\311B4\024=\326YX\342n\210\\C\232\025\022Y\2766x[\354[ygJU\264h\222\220b\352\016\245\217i\025\371\327"
+	.string	"'a\312Ly\020,\001e\351\200"
+	.string	"\355\037\324\f\245a\202\031\f\331\025\003\277\001\376\326s\3178B\017;*\370\023\336~\206vw\300\360\367\0041\241\211&\264\265\377'\006\275I\365\203\027\275\006\357\326\366\311\2160Gy\370\342+\3463\033\312+\237\216\264\234\217G\030 \350\277P\363\023\250\367\244\033\331[0{\021a\354Y\376"
+	.ascii	"\341^\033\2642\001I\255\265\373A\272\234\231\036B\2507\263\246"
+	.ascii	"\033\270\264\031K\2703\312\357\316f\302\212\375\"\322\211\230"
+	.ascii	"<\227ae\243\351\3704\316\310 \330\2035m\005\233\242\302`\371"
+	.ascii	"B`\003.\262\314\226(\231\216\274ll\245\254\374+\211\334\323M"
+	.ascii	"\031)\367z\372\211>\345\325\235\016\362\177yT\351'\221\373\370"
+	.ascii	"\2208\201\313a\226\216\021!\030vzv5\225\240\261\254AZ\336\272"
+	.ascii	"\202\2100\231s\007\003\244XR\233\267W\246\277\351\226\233(EX"
+	.ascii	"\234g\320\267#\3215H\306\020\362i\330\315\256\231\013\304\253"
+	.ascii	"O|\003\335k\377\341\314\035\226\027\245\005H\3274\347^\310W\232"
+	.ascii	"\330\025(1O?O\234\022\245\352%\347\276\366>e$v\245\013"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.154.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\002\025\005Z"
+	.string	"j\220\204 K \222\322\351{\3120\017\005\342\003\343\361\316=]\253\347\005\221\005\334y,\326\201\351\250\035\230\373\f\260\322\373Ln"
+	.string	" \242\036\0353\027q\311a\347\031lk\023\021\367M\025\361\bip\317\373\026\021\021\335.\355\206\222\277\367N)\245\372\001\320\001\355\001\204 \364\027\356!bb\016\273p\017zY\252\027l\305\022>%<\004\003\231\\\004\227@)\001\004\346c\026\356?>\372\265\226\266\267\\\345d\021\2719>\376\226\324I\357\225\023\241\330k\2167\017{\205\033K_\b\312-\271\373\265\343<;\224\363\240\n7_"
+	.ascii	"\003\264me\004e\226\334\365a,;\343s;\274W\n\005\305v\343\346"
+	.ascii	"\241\367\370\250\307y\352\255k%jS%/\212\275\266\224\236\3226"
+	.ascii	"\025\316\353\373\343\372_\020K\240\322{\257\211^\271\251\330"
+	.ascii	"\253\262{\330^\325\346a\361\306\200E\341\263\023\003V\307G\027"
+	.ascii	"\024\006\354\336;\327MJ\300\023\344\022\230\337:\207\023Z\216"
+	.ascii	"\017\b\"m\270\216c6\241\335\270\002?%dn\367^\023\230O`>\366j"
+	.ascii	"<r\313,\246\345\314.\220\332\035\227\223\303{\257\323\317\320"
+	.ascii	"m\2438a\242\251\004\211\021\"\230\226\224\222\220\224GFEDCBA"
+	.ascii	"@?>=!xvtrpn\222\310\243\321\246X\303\256\352{\313]\343\302\006"
+	.ascii	"\372\225\325(\374\372\204_\0267\201\245\233\260\364y\211+M\342"
+	.ascii	"\n\237\217\310k\021yL\360\234i\251\306E\221\037QZIm\"\313\022"
+	.ascii	"\244\001\275\240\250=\\\312\3004a\024O\262k$\273\301\035\\yW"
+	.ascii	"\347Gqm\024\007\347EE~\3345\221[\017\2711q\2414/7>\034<Hm\222"
+	.ascii	"N9\323\200^oj\217\017$\320\336ks\240\037gk\237\035\257$\252R"
+	.ascii	"\t\350\205\304{\004\033\t\320\353\016\315C\034i\236#g\276CC\353"
+	.ascii	"\320`\304s\314\032\307\214\311\013~C\326I2<\027\0349\244\217"
+	.ascii	"C\242\214\271Q\254m\304\354\032)\315+\314\213HE~\200u\r\240\027"
+	.ascii	"X\035\227\263Bz}\322\361p5H\377\315\327\226\252\274\367v\223"
+	.ascii	"\366\256/\247{\215\213{/;\364\353Gs\212f~\025\314\f\205Y\207"
+	.ascii	"L5\217c\256\207-G\023\3474@\025\315\334\310\213\005`\300`{\255"
+	.ascii	"y\025a\323\0202D\365\302\322\260\031\362|\224\331_\035\360\262"
+	.ascii	"\"\354\257\200\300\211\274\260\376\215\260 \020w\\\030r\346P"
+	.ascii	"G\375\217\341ba\352\004\336\202\220\277\021v\246-'\b\224\221"
+	.ascii	"\331\275\027HW\t3\303f\210\363\3758\346\266\260\f\377\362\362"
+	.ascii	"oA\b\307\025\370\nW\305{\267\b`O\301U\240\301}\244W\033l\257"
+	.ascii	"\375\315\244\231\246\344\305@\366\006w\343\267\241\311\033\316"
+	.ascii	"\345(\334\334\370\306C\3628\332p-w\"m|G1~\024\212\235\332\324"
+	.ascii	"\b\242\323\030k|\333\025\321\324@\375\320\207E\250\357:\326\314"
+	.ascii	"J\243\260\313\2604\276\351ZMc\033\323\245~TLK\277\314\223\266"
+	.ascii	"!~\357\315\372\217\362\021\221\206b\237\036\307\234\226-G\303"
+	.ascii	"\334`:\f\024\367\021\276\300\2067\264W\2651`{}\372n\322J@\350"
+	.ascii	"\346\006\241\210i\371\224Y\316\331\352\375(s\253\367c`6:\337"
+	.ascii	"0:\3330:\3270:C\031\235i\030\235\237\216\3163\222\3162t\234c"
+	.ascii	"\364\226\346\b\272\257\371\201\243\363\002Gg\005r\234_\270H\200"
+	.ascii	"\305\212\016lV\321z\315\005\264\227\346%\245\244\2443R\322Y\231"
+	.ascii	"t>J:\033%\235\213\216\316DH\347\241\243\263\020\3229(\351\f\204"
+	.ascii	"t\3769:\373$\235{\214\316!p\234yn\234w\220\316:I\347\034\034"
+	.ascii	"\325\371&\351\234L:#\223\316G\244\263\361\350l\323T\232\213F"
+	.ascii	"\347\032\2433kt^\215\316\252"
+	.string	"\321\371\215\316nt\356\f\206\252\314\0056Q\303\373A\271\353c\032\304\375[\251$i/\335\201\335[\272\373\272\255tS\351\326\353\032\346f\356/\r\330\001?\364\375\224\262x\2417\nD\313\343J\fz\026Z\224\336\370A\337\203]\f,C{\242\374(\267`\367\221\347\025-F+\236\325\242\244W\372.\025\257\364kV\225\270#5\351W\274\217\363\310\230g\232s\217K\031\030#\240.\317\202\245\017\310K\033\\\001\377\363*\376\357\236i>\377\363l\227\247\264\347}\276Up\276V\255\212[i}|\265@\200\260\275\366|\013v\003?\304\272 \302i\365\231\016O\370\212FP\357-\322BG\252\003Q\210\347\001\n\005\225\226\005\021_\356\275S\032Z\030\343C\3748\341J|\340y>\306\367\3230\202\347y\004\234p%\266\340yW\256g\206\327\256\371\335]\004\337\177\355\200TL\260\rn\347\037x\325\tW\242"
+	.string	"\256\363\314\355X\353\002\333\320\235Wn}\026'\351|c\351\013\312\316\246\317>\347\320G=\256s\336\023wh\325\232\316\254\256]k\361\345I\333\226\363Mg\004N\350\243.\3277\337E\332J\337\374\223\330\22660"
+	.string	"\274\2574_\013C\021\312\336\244-\003\300\347\3325n\243\355\f\336P\276\241\263\"\207(\345\361Y\314=\002\313\327L_{`\310\334\f\265|\312zolfA>\305g\365\007\347\223\276\213\273Uc\223oe\304\341Z\265\243\267v\255\310-9\202\314\336\027\2627 \016\234\215\363\330"
+	.ascii	"\366\033|\255=S\321\332$l\022\266W\234o*?\037\315kg\217\261\277"
+	.ascii	"\026\323\251`\361I\320\362\251Co\211\3664\334\335>]\304\"\377"
+	.ascii	"\375\216\217|vh\241\226Okp%\255\032\323\027n\227x\222v\355\310"
+	.ascii	"\254Wv4G\322\266\265L\332\267\366\215\355\365\370-D\314\t\"\234"
+	.ascii	"\3619\257\331\267\356\325R*\340;\315\263\317\351S\266y\343\253"
+	.ascii	"~Oi\315\333|\357u\215\262\027\246\\\211=\001\254#E\016\252\035"
+	.ascii	"NX::\240\372\200\003 \326\221\342J\007V\324\322\251\212\271\\"
+	.ascii	"\n-\231US\f\\]MI1\255f\344\240\232QE\265\334\231ZRa\355`2%\310"
+	.ascii	"A\265\343\030\265\201OaE=I]\301 !ji\304b\352\270b\340\003\246"
+	.ascii	"\024\023\213i5c\202\034SV!\020M-\251,\350\240\212\352\203\035"
+	.ascii	"\313\250+d\025\223\nK\212\312\n\353j\352i\n+*\307\016(+&\026"
+	.ascii	"s\351\303R):\240\342\240\212)\345TE\025\265t\222\262\272rJ1\304"
+	.ascii	"\314\035SVNXL\246\225\323QN\253\325\3731p3\351\"\235\031)\210"
+	.ascii	"R\255w\362\213\347\357\372\0246h\0166\t\t\343\232\251\020\317"
+	.ascii	"9hW\230\303\367\330@\2753k\036>\nM\037\324.\006\364\312\377|"
+	.ascii	"\256f\230\346\230&\231&\031\266\327\027\3379\364\223\rmR\277"
+	.ascii	"5;!2~\201\377;\256\304\216\333r\312\370\216kG\023DJ\366\206\242"
+	.ascii	"\314g\375\2252\266\307vbL#5\313xb\032\244\327`L\017\021\016\206"
+	.ascii	"37\177h\"\222\020\023\367\347\374,\023h\226G\210zcx\207M\253"
+	.ascii	"\262\t\204\2371t3\3154\315i\233\225\305\366\252|\r\306\360J|"
+	.ascii	"\324\207.\\\212 \203\303\330\223C\022~$\246U\013s\364VcN\332"
+	.ascii	"F|t\311\366\260\\\"L\023\233\262\031\"\201\222\375\211\370(\267"
+	.ascii	"\321\343\230#\334r4N\367\"\350]Z\036\\m\217\036l\257F#\276\254"
+	.ascii	"\030\222\275\3011}\224m\334\240\244\200\r\221+_H|$\235\350\031"
+	.ascii	"E\017\270d\3422\330>i\240\205.\276\347\213\276{h\0334"
+	.string	"\201h?<\317\314x\0274\234K9\315{,\321+\360\354OC\003\356.\236\322Gy\004\035\0268\244\004l\004\227\360q\345)Y\374\322w\231h\242o\302v0!D\316\346\002\t\227\236\350y\346\320\306p%j%}\264\227,\213O\340y\002\321\266<\311\234>m\222N9\203\364Q\036J\023\n\201\262\250\2010\203\031BC#\"\"I\222\024:\301\005\304\030%a\3256\021\020\245C\214\251\231\031I\n\222=\326.xn\203R1\310"
+	.string	"\007\377\025\215\244v\245\257\224\216\206o;\371\226\267\253t\331\tp*\354DE\302\300n\017\241B\205N\275\353EP\223\344\211a\304\236\346\025|\322\360\r\321\201\346|\3442.\233D\261\276\264[\003\"\337\210<\226\377g\204\030\352\261w\003\342\240^\314#\022!\201\357\331\"\0050\222\273\217\206\210w0q}\037p\013AJG\311\214\206\022\234\340P\234\330|\006\277\354s\303C\003\027A@\213\211\216\032O%\r\200\3043a\227P\303\353\362\221\263\2639\224dh%\311HF\031\306\216\022\300]\327r\016\037\n\250v\233\202\226\037\371\347GFU\220\234"
+	.string	"\347)\342\263\351d\005l\213\026w\350D}\247h~\003\226\300\331\234\177\377a\006)\301\311\365\360\266\264\271\205\313\366\3357\232Z\307\013\277r`R{\367;GW{{~F\b\250\036lb\225"
+	.string	"\202\263\334\tM\266\253\016\212\266\254\325\201R\336\004UX\314\221\0029\331\026\361\021\253\340Pb\006\217\300}u\032D\244\314\346\304s\370\301\024j\224\317\3455\225\016\222\375\001\030f,r\001\272\034oW\340\224\271\033\235t `_\256\3621\275Ch\342\333\203\017\200\025\004\3678j\rM\031\363a ^\370\205c\020\261\017\220\365\007\363\337rTe\257\351\np\211\006I,,VsR"
+	.string	"\322\353\231D!O\246\211\2339\f\031R-wj\312#\347*g\004\037\017\177\013H\242PL\224\364\037\227,\013\363\234\241f\302\237\223\214\245\214\376\301j\256\336\261\004\232\250\350\022\033 \265\307\bW\261\337\245woI\224\360\221\005@\330\224L]\215\336i~\235\nr\017\341\313\241v.r\302\270\203\354\363\230\302\360L\r1\323C\265\272W\233\r\r\302\302\302Va\302\357:\273\372T\304\326eL\"\351\203\352S\021[\227\214\250\bz\020\324\330\251K\325\337\222\227m\250\r\251\223\327\275\221+\321\2541@\2360\246\211\204\265XKS\256\3569\211\271v9\354&#\017\223VCQr\217\202\"|b\35428Eq\262\004\022\252\025\004j\304\252f\320\013\214f\031\021HG\335\004\235\216\370]\337j\017\233r"
+	.ascii	"\253\021\243\234\315t:pD\030\3407?\260\373bq\314\b\215Y\027D"
+	.ascii	"\214\2331\201H\340\347y\353\347\177\rJW?\252)\2708\340\321\243"
+	.ascii	"\036a\335\246\b|\336\265qZ\302o\337\375gDB(@$a\254z\006\247\361"
+	.ascii	"q\256o\2572\375\273\243\244\016\007\001\335\325g\347l\314\256"
+	.ascii	"\323\316\2626\241\327)\356&\362/\"4BT4\003Pd\375\353\222\377"
+	.ascii	"\241s\243\2027\222\233\201\007\214X<\260P@\353\267\253\376\273"
+	.ascii	"*\377FS\3179\357\272s\323\325\233M\356\257US\320\310p\327\006"
+	.ascii	"G\247\313\232\267u\337\037"
+	.text
+	.section	.gnu.lto_readEEPROM.155.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"\325\b"
+	.string	"bO97`o\032\003lC\3409,\031\001\360\374u\206\320\003\"S\017\206tH+\261l\217m\373\2156\216\241\364\033\230\314\020\244\r\3625\230\2678\201\202\032\232x\217-\245L)\232\306\271\256\217f\371\332@`\017\036zM\017\346\320\231W\246\315\215\306T\202\223\315\tJ\263\231\261\365\262F\222\214\277)\033\327\"v\230FDF\207\212.5@q\271\026\264\265\017\274'\343"
+	.string	"*e%\264)*\340=CTJ\304\242\322E\316\266\034\214\035\366e\215$\373\337-1\232\023\021\223\021\023H<\2615\364\322RoUR\372\367\333 \377\344\314\277\215\200\2635\004\300\021r?\204W>\bxe\205\005\220\267\333\217\220\200\251tA\262R\253\235\321\343\333\341\346\377\364\206\356Ky#\356\320b\250\265\032z#\214;\336v\201\355\004\373\230\025"
+	.ascii	"\252\244\2231\335@\206\311\317\020\264\003\230\201\"`\034(F\363"
+	.ascii	":@B\251#p\332\372\346\020\256\211SX\0207\004\270(\372C\005\017"
+	.ascii	"w\316\324\316'"
+	.text
+	.section	.gnu.lto_writeUnmodifiedConfigToEEPROM.156.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\245\007"
+	.string	"b\21526Po\322\001\214M\221=s+X\351\366\020\3051\2002\223\020\027QN\b|\317\315\022D`E\206\215m\2723(\215Lz\304\020\272U\314Bhc\255\021\"eJ\001\2766\013\034\205\016\274^\207\203\200\275+\373\274\215\200!CB\366\032 \314\236\246\333W\253#\203\027\022\352\004\322\220}\f\343\207\\\004\3633\f=\371x\313\367`n\035T\254p\250\2002\365)9\200<\300\016\223\246\r\021\221\217N\222\026\022\352\024\322\315\356\266T\013\373\325\352\310\316\300\022\321\004\367\017\223]Q\312eMVI\303\3665\326\354\224w\030\033\260q\"1\302\262\273O/\256=5\377\036\007\210\334\366\314\024\354\2563r\024\267\336\366\200m\002\333(\001\020"
+	.ascii	"\252\244\2331\355}\303\234\231V\200\0200\016\024\006\206\200"
+	.ascii	"\2724o\274i\233k\370\\\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_writeEEPROM.157.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"-\007"
+	.string	"\242M25`m\322\001\303\265\r\256\314%\200 \036N\236Z\2561'\226'\232\323\324'\221\206\372j *\343\247*\3261"
+	.string	""
+	.string	"!\355P\004\244j\260~\003\266F6\3312\245\2562\r\032\206\215\254\342F\243\340\020+\213\0233\003\226\017\013V\214\220\322\212\030\016\373\264\017t\021\245t\330\313|Q\033\202\243\2376\020\235t\331\373X\337\241l\211\207t\bB\273\213\340\203|\233\3607\016M\341\321\317C\337C\035~\303\030\221P0-\331\\\246/\303\376\264\017dO\001+#\332\267\321\256EIe;H\302a\373\030_\266\311\271\320\nx\224T\210\220v7>\215_\327\313\377\307\001\246\366\271Z\022v\327:\265\213\373\335v\201\355\003\333\035\001\t"
+	.ascii	"\252\244\2331m{Cha\332qat\013\026\277\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_resetEEPROM.158.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\r\t"
+	.string	"\226\320>:@\255\322\001\360"
+	.string	"r\300\004>\316b\262\264\002C\262\177\035N2\223\t\241\250\220\036\255!\211\303\004\201\026o\002\003!\031\303\021\320`\374\007\235\255\260_\352;X\305O\310\336)\005."
+	.string	"*"
+	.string	"0"
+	.string	"\n!\217\257\033&\002\217\231EHl\267\322\251\361\361r\364\337\272\326\221*IQ\0319\211.\001\030v\327\262t\302\270\347m\037\330^\260\375\n\213\262\231p\330\276\357z\005\035\304\231\024\311\307\356r \233\373v;ds\266\245<k,8\013\214\365\332\255\tF\b\370f\333\231\250\227\f6\232$S\264\376\200Z\305.\322\257b\205|\311\257\2078Y\311`\244)\262+I\316\f\373\332N\225\255\201,\323\305\351\256\225]S\313,\341GB\324l<\207\316\367\t\305\006/\024\007\334a\"8\033\317\327Q\017G\323\241\035\030R\214\201\277\t\017\244\237\357\003\251\353\350\332N\225?^\004D\002\r"
+	.ascii	"\251\322\235\314\n\327l\264\301RN\213\301\024u\336\341\232\210"
+	.ascii	"\214\t\022TPN\205\025\236\267a\355\324\003"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.159.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\345\007"
+	.string	"R\31646@\217\322\001\360\036.\213L\236Q\240\247\370\234\303=\255:I{"
+	.string	"\357\333\370\306\225\337BnFL\t>sFl\024E7\262\200\333z\004&\277\t\376omK\231R\276:\f\237\005\020vA\320\007\241\001^Y\bv\006\2149(d\360\001\3032\310\351F\367\214t{\232\264C\020y\316z\026G\253D=\221\271&\204\254\220\222\345\227v\204D\236\273>\365W\220dl\254Z6\025\331\335\226\332a\377\355\356ZO\366\323\317d*&\213x\223\223]S\353eU\030\224\017\333\347X\263Y\336\241V"
+	.string	"\004U\032q\331]\250\036\327\37645\037 \212\3766\030\327Gp\322X\005\304\355\025\244\250JO=)\")S\343\331]'\027/n\314m\037\3306\260-\022\017"
+	.ascii	"\252\244\223i\021\206\363\020\266j\240+\354\005\252y\340\245"
+	.ascii	"u\357\267\260\336\\py\031B\\\272\246\232\246\201)("
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.160.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"=\t"
+	.string	"\346\021A90\221\322\001\200\230\354\0078\304@\024\"\323A\312\361\376\203\373r3\304\241\246k\360\3146l\213S}\006\311\232\351C\214\210 0\207 w9zQ\035\324'F\317m\367N)-"
+	.string	"2"
+	.string	"0"
+	.string	"&\331\332\3515\177\366\313E\325\032\224\2648R`\273[\347\310\277\313\317\277\353\035\020U\272\004x\330]K\020\345q\317\333N\260\275`\337\001\f2.\257\220W\215I\306l\361$\247\210}\316\356\256g\312\316\bX+\324UVv;b7;R\026\226\355\373&\017I\177Y"
+	.string	"\244\245\265\273\332\251\003w\035\342\203\004\026\323\221~\330]\310\203V\200\241\031O\263dyQ\366\320\241\243\210\020T\273\353\340\213?\311\360W\247\326\030\311\203\247\376(;}\370\336<\023\234\004\250\333*\210\213\250\250\233\027\252\236\003w\026\037\257bt\235W5\321t\316\316\224\003flF\323<\271@6\334\336>\036l\334\230%\017H\233\243\b\f"
+	.ascii	"\252\244\2231M@\r\307\331B\323\276Nc\307\246=s\031=\250\020/"
+	.ascii	"W\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_setConfigDirty.161.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 \355\205\006"
+	.string	"\262\013-5`M\323\001"
+	.string	"WE\204 \247M\310\367\007\314I\250\352hX\252R?B\030B\210?\006\023~W\374\330"
+	.string	"\202"
+	.string	"(D\013\026\022\004d\001Ab\301\266m\367N)\226\"\201)\200\252\022\245\246\316"
+	.string	"\225*\213F\030W\002\200\212\026\324ZQ\b\334\313\217\323\360`2\262\311\003\377\327\343g\\\343\362'l\200\305s\237>\366|\316\212\220\317\001\203d\213\241\rjQB\330\247\254\374li-t\t\336=:v\273\360dA\346\007\205\355C\316l\221\203\022{\261\330@\340(\331]*#\236=f\376/n\341<\355\261\262\331]G\316S\270\345mglkl3\004\t"
+	.ascii	"\252\244\233\261x\300\031\342\342\013]\303\347B\030/C\200K\267"
+	.ascii	"h\347\023"
+	.text
+	.section	.gnu.lto_isConfigDirty.162.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 \350]\006"
+	.string	"\262\313+3`M\222\016\300\216\fE\"\023\372W\211C\220\307y\002\004\272\331\332\253\261\326n\254\217c\353(\325\300X\001\300%\310\353\252\204Y\212\b\307\330@\033{\313\024K\230\210\f\204f\222\232&\343 \321$\212\242a\f\236&\036\250V1MT\273`Y\f\035\036x\360\363\035)Iu=\266\330\\\255Fw\023\320\350p@\303s-\217u\0167\276"
+	.string	"\211\241\377>$"
+	.string	"A\271\232\245d\202ZX\362$2\371\3709\177Ya\201sU\254\003T\020\222]\224\254db\r9Z\365\252[\2216|2\025\353\352\364\004\0302\363\263\256\214\216\375\021\376\204\037#\t"
+	.ascii	"\252\244\223iq\326\031AC(\256\211\205\021y\t\221\303\2353\265"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_changePidProfileFromCellCount.163.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\203\004m "
+	.string	"v\274\325H\220XR\007Dt\004\252\355q\204\234\030\306\306\311\331+\210{<\357{\212-\013\307v\320<a\236'\336q\213C\316\363(\352TIW\"2@rG3\n\0040 Z\317?"
+	.string	"l\t\211M\377d\233\335{o)SJ)\305"
+	.string	"\261"
+	.string	"\303"
+	.ascii	"m\231\331\235\271\301\203\243\336R\301\177\357\224\331\221{\223"
+	.ascii	"\f8\001\332\226\217\230\267t\362\306\335e1!\016\031s\357\345"
+	.ascii	"\275\r\266\371Q\347p7[\212\236\246\255\357G\3346#R\347h<\035"
+	.ascii	"\033Ww\262\312,i\264\342\261\352\020Y\312\321WE)\277\241\025"
+	.ascii	"\243Z\331\356d\\r\233\201\032O2:-p\357\215\341h'\305\350\263"
+	.ascii	"\356\234Qe\321\031\211Ug\312\354E_\025\241\334\254\022~`\341"
+	.ascii	"\320\031\231\352wy\225\365U1\312-0\313\212\027\032O2\272\326"
+	.ascii	"\004Sf/tF\245zsF\225\245\27760b\f\323\031\2075\347c\313U+\333"
+	.ascii	"\300U\361\350~N\270\367\2627\031\237\232u\315\314b\2309\310\\"
+	.ascii	"\001\004_)F\240V&\314\266\376)W\023i/\023\334V<$\364nj\313-4"
+	.ascii	"\333\366\267\262+\030)-d\240\222|\21599\364GZ\271X\214\374U\314"
+	.ascii	";w\316\301\351\255\356\033\233\232N6\323tW\263\356t\316\235\316"
+	.ascii	"8w\276Yg\233;\247\356\214\272\363\351\316\246\351l\335\271\272"
+	.ascii	"\363[g\257\316\255\243Ccal\260\262{]\254\231\271P\354\030\217"
+	.ascii	"Nvw\26537\243h!\034AJ\r\353\336{\353\016\322J\276u\361\214\311"
+	.ascii	"z\322\345\336d\005\264-7W\0039\352$\223\365}\272\275"
+	.string	"BJV\225.\367^\005m\331\001\332\266@\337\230mk\0070\003\270\017\240\024+K3\230\266\3670\255\245\305\003\t}$w;\026 `0\316\257b\005]\363\266G\232\226\322\354\277\216Ud\346\355\353\027\331\376\246$Cz\226vcj\253\2070\003;\211\006'@%6\334\261u\357\205\200\244\3076p\350\340\301lk{\0048\270t\237\376I\025VF\\~\024,]_\026}\234o5\006}>\372;'Lc\013\332\374\363O5\246\251\241\257\261}\363C\213\201@\357U\362\341\006\353\260\037\356\371\274\233|f[\373\215%\305\205\f\227\017Z\023\253\372H\376\231\376\270\032=\266D\026\371Gr\375\377\020J+J^\206o\276\2769\205\270\364\377o\342\222\203\332\310\017\275\367\372p\007,\324#\342G\3043\022\n\372\001\201vD\270\023>\021\301\n>\340\017HX\204!(\370\023\352\031\375\f\t0\n\226\020R"
+	.string	"\002}\275\224{=A?\240\240\260\307\013\376~\206x\275\"\022\274\236\001,$\362\025\361\214\204\302\"\336-\231\324\023\222~X\314\351x\3163[\270\340\335dS\344\313\031(J\217\304\275\326Lf\332|\316\237PC_\3031[B\202\263\325\374\016\361\310e\323\267y'\233\003Hib\224O\224\274\214\216[Mi\036\347ulQ{\272\346\235r\2103v\244\273\247!F-+\316\353\336I\367\271o*\312+\366s\217\243\f\023\253W\331\215$\036\227h\372\\\317\232\247y'\346o\036\023\367\273w5\246\261n\036S\367\001O\250a\030\206\220rF!##\321\b\311lsP\0021\nZy\020pg\223\346\313\244 \204L\245Q\\jT\016\227\347\215\231%\267\267:LI\0042\351\273\266V&\240\310\365}U=\217y\360\306\320h\331"
+	.string	"0\307\254D\177l\230\021\240\251\034\3040\363&\b\007\360\201c7\230YA07\020\n\340\313P\260\246E\357Wo\214\200F"
+	.ascii	"j\b\351\223Ln\341\246\027\377\317B\200\002\340\250%\220J\307"
+	.ascii	"\307\tcH\007\262@B\334\234\363y\025)D\377\303\224K\003\230o\020"
+	.ascii	"P\301n0\321\001\245s\021\033\030a\013\3657 \021\177\270\225\246"
+	.ascii	"5\361\221\352\375\001"
+	.text
+	.section	.gnu.lto_changePidProfile.164.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\320\001\215\021"
+	.string	"\366_sF\360\360f8:9\375\032\331\024\227\233.\320~\026\004,\345n\226\237e>h\227\312^\351\f\250\267|\201\265\rh`\2310\274\t\2771\024v\345L8L.\223\007/)\035\364\035\037\347\271\234R\313\230J\366\2262\245X"
+	.string	"["
+	.string	"b"
+	.string	"\236\261W\367\276\262\235i\2278\200}\210\306\272\313S\204\333\255\215X\344\343\236a\266\216\327h\033\"4\332\274\330\261\273\237\376\034\366N\023\346\237\350\001\306Y\354\235\316\265\023\311\315\200\002\231\311:\0028(\306\023=ofb&"
+	.ascii	"\t\273\353\034g9\267w\333\023lg\260\263A\252{\307\355\034E\231"
+	.ascii	"\250\311\251\323\244r8=\215\252S\215\345\b\262\335\220\245\224"
+	.ascii	"]\023SO\330\357V}lU\232\225\351\325\207\376.\323\351\245\017"
+	.ascii	"\242L5dB7\352T[\234)\036\333\344\321Ha\373~\321m3w\341\b:9\236"
+	.ascii	"\241\335}\355F\266\314[\270d\347\306bwe\034\346\320!?\372D\377"
+	.ascii	"\210[\320F\345d\0323K\375\245\343`| {011\372\202'%\321\t\351"
+	.ascii	"\351\266'\301tI\264Q\3452Z\035\016\bH\217\341J\001A\325=\226"
+	.ascii	"\336v\217D\317\022\316\017R\211\225\336\350\fr\224D\247[\217"
+	.ascii	"N\355\017\207A\223\200\266\273\017\374\243\337X|\240{\016_\362"
+	.ascii	"\343KV!9\001]\276\030\225\024p\005%$\204\353\244\205\202k\005"
+	.ascii	"D\t_\027N@\027\001n\221\244\200(-a\353k\001MX\276\326\013\346"
+	.ascii	"#A\340\320\305\365\372b\302\360\365\255j5\357V}\374\001e\243"
+	.ascii	"\251FE\037\310T\273\202\005\005\327\324\021\233\036W\003=LK\""
+	.ascii	"x\304\234\3520\254(\220\266\206\r T4\211\032\363\200d\251\003"
+	.ascii	") `\202Afe\007\336\rSO'\232\366\231\341\314\326\303\356\032\263"
+	.ascii	"\003\032\030Y\341!Y\006\230\231\033\003\005\261\313\315U\350"
+	.ascii	"B\322=\013\227\355\266L\335\205\017W\230\213\034\343M\362*'M"
+	.ascii	"\035N\244\361\271\"1`T\033\214\211\025o\354\201A\213\200\262"
+	.ascii	"\2308\261\267\243:q\242s\363v\246h\036\n"
+	.text
+	.section	.gnu.lto_isSystemConfigured.165.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"\262\r25`m\322\001\310\217\254\\\206"
+	.string	""
+	.string	"\036N\037*R\222\204\327\210\246i[a@>:vh\004\377\247*\32616"
+	.string	"\204\364?\025\201\235\021\021n\241\033\331D\312\224\002\256.\020\230\207L\254`\006\323\020\001+\353\202\227\001G\t\007\013R\304hAK\227}Z\365\250\026d\2529\177QW\325\227\302\031i\236\370\307\005\260\213\241\340{\\T\341\177\376l\241\311o\177\276\206\372\273\022t\210\262,\331\235\226\252a\177Z\365\330Nk\246?\005\214\220p'\225\354vJ(\033\362F \333\033\333b\204\204\215\261w\034\035\201\320\207\003r\262\333A\3358\366\304\374\207\316 B2\331\270\213geaw\235\033\227q\353m\033\330>\260\r\n\n"
+	.ascii	"\252\244\2231={\303\024\306\330\241\262\30551e\004YB\344p\347"
+	.ascii	"L\355|\002"
+	.text
+	.section	.gnu.lto_setRebootRequired.166.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"%\007"
+	.string	"r\r26@o\222\016"
+	.string	"\202f,V\352Y\335$sJ\341\270\\BX~\256\267w\226\303\260\177\363\361\237\231\234\026xQ\203\217axT]\3208\254\376\270\037\207m\255\021\"Sc\033\005NB'\303b\207s\260\0201\315\0237\003g\f\bZl\3102-j\272l\225\260\004\300\002\203\022A\2113\257\231Y\317\365\016\020\257\334o\204\243sQ\231\200\241\333\317u?\n\362\271\033G\200^\271Z\027t\325\262BPN.<VD/\365]\350A\214o\225\260\364\325\303\313\250\202T\223\222\314Q*&Q\026\211\351\257\346\355S\332i\244\300\251\203B\244%3#\314\350\326\267\335\236\032\300\221B}\031\203\314\374q$\213\016\373\023\374\005\277)\t"
+	.ascii	"\252\244\233i:\307\220A\274v\\\030\347\202\305/C\200K\267h\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_getRebootRequired.167.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 \350]\006"
+	.string	"\262\313+3Pm\222\016$\307\250\3629\025#\007[\016JC\020F\321j\264[)\254\331\277\333\341\265\202\251\370\322(DUY\020\261\362vA\210\005\203\243\306-\356-SO\227\b\fD\206\232Z\006\343 \321\246\212\242]\f\246&\036\252VAQU\263dY\004\035\036t\320\363\005i\210u=\266\320\\\257JW\023P\351p@\243s\243\3178\207\033_\200D\320\177\037\022\244\224`\025\221d~F+\211\"\235|\374\233\267\254\260\260\331j\326\361)\b\211\\\214\250df\r9j\365\254\333P\033<\"\223\013\343\364\004\0302\363\273\260\214\216\375\021\376\204\037#\t"
+	.ascii	"\252\244\223iq\326\031AC(\256\211\205\021y\t\221\303\2353\265"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_CSWTCH.81.270.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.part.0.332.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\005\t"
+	.string	"\362N78@\217\322\001x\021(\361\262\324\377\372\352\223\341<61\301\247\236\306.m\211\3611;>\262~l\034\026|\346\f{ l\t\205\0058v\021,\222\013\355\220\335[\356\224\002\3168\017\036\207\217\226\315\217\207\001bf\333\304\344\034X\213h\330&\205\246m\023\263\r\037WS\356\\(IUe{\022\336\025L\254\327\006\372_\205\005|\311\377\276\300\302\232\221!\351\b\252\312\032\037WSv\214-\017\002\324nF\r\315rH\225\017\277\344_\350&\326\356\245\005%\262\273w\335\003\235\304\002\247\025P\350\376\210\310\306\260\313\207\330\026i\230\263c\356Z\255Ak\205q\362\332\335y\251\035\347\2560r>,u\243\353\275G\220S\212\013\fJg:,x\004\350\354\256\0036ny\333\t\266\021\354\017\004\033"
+	.string	"U\345\003Y\206qM{\3654\020\030L\241\3636@\024\fs\205\343\262\270Z\304[\204\370-\201H\035\233B\300\312\275\235\311f\266X\2248\235\001\332L\331i"
+	.ascii	"\270\366\224\302\302fSO(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`q\n\365\036"
+	.string	"\2261\260Dp\350\315p"
+	.string	"@@H\003\001\205\002\374\017$q=^\343\376\306\"z0Y\337\001\210\224\350vS\243/\216\006\277\317\334\370\266$A\240q1\241\370+'\302\201\020|\237m\013~\324\334\342E\234\373I\223;\311\236"
+	.string	"\231"
+	.string	"\236"
+	.string	"'\235.\025}#\305~J\354\207\225U}\260\024\375\"T}\"S\375!R}!\345i4\242gQ]\256\225\214\342/vP\375 O} \245\323\327N|L\323\331\032<\314\320\3010=\271\364/D\367\242\3642\023'Kz\227\002O\322\336 \365\177\2248\224\243?9I\2247F|\211\210\217\355B\364\277@\364{|\350\363\360\320\337Q\032O\264\016\375\034%\207\243Qp1\033~\324\360(A\241\213\035u\221\3416v\273\353s\032\215\347\331n\357\262\341\270\356<\317\023C\337\253\334]_T\375)B\372T\202\364\253"
+	.string	"\351\233}\365\317~\364\321|\364\255x\365\261\364\350k\341\321\337\262\243\237EG?-G\237KW_\305\321WC\366\257\334\3503\341\3527\261\321WR\243O\206F\337\311\214~\233\214\276[\214\376\033\214>\334\261\037\207\366\345^\364\313\030\373f~\236\347.\202\271\273\350\237\371\317\307\350\303\330\372\214\026\257\301\342\\\273]\254\252\"\321\251I\353\310\335.R\021I\251\270D\\\252:j\242b\260G\217Y\357\332a\365\223\2548\272\273\352#\261\352\037\3319\001W\350\205sc\352\367\016W\322\n}\t\247FM%~1y\n\225J\241\302\230\374\004\307g2\223z]\236(v~\326\227r\352TY.&\373\326\353\312\220\352\2121\271\247\256\231"
+	.string	"\216f`;\306d\336\272l&O\255>>\260~"
+	.string	"r\214\306n\361\261\201\364\033\207\305Ll\323|,\264\320\343\037uh\371'u\260\354C\211\226{\353\203\345\236\na\271\227FX\356\241E\313<U\3022/\235\260\314C),\177\255\260|\244\357&\355\2631\322o\023\326_\003\326WS\244\237\206H_\312\220{f\001\0130\236\300\232\243\333P\210}\326!\373\240e\206\374u\315\f/\266\347N[\321PN\310I?\241\220\223\376=`s\311`P\\\020\020P\202 _"
+	.string	"\006\371(\020\016\310Fo@\006\002\362U2?~\330\217o4\177\254\324\366c#\267\037\013\257;\337~\3748h\232\232\302AW5\325\202\256j\232\005]\255\034M\375\311\352x5)[\277z\360 \223\253\232|\262Tm\355b\362\247\250^T)g\202\036I\332j\322\344-u\013]\265R-4K\315J\257\326+\365\001\276\344\026\214\311\001\200\267\250A$F\321\034I\222J\2461 \003\241\331\246\003\021p(\311\bSH \221\004\"R\221<\007K#\323\\\334w\204\232UY\023\257\215wRE\335~7\2243\315\307zH\026\236\201%&\347f"
+	.string	"\312\245\217f\220\355\376\037\3668W\372\304t\262\210\353IXa\377\314\341\315\326\254\215\362\214\007\335\335\201\321?\220\305\313\367\377;;9\214\367\207\351l\240,\257,\246V\263\332,\212\021\232\t\203\375\342o\331\037\270;\306\017\272\271\230\261&a\2340[s^\360\326\363\346\334\251\2045_\255V\253\365j\265bu]\227\272]\376\310R\212Y\312\220\245\024\362\224\"K)d9\205\234R\310Rn"
+	.string	"(\327P24\322].\026\254\236OR\2431\320\305\361\244\323U\207:\230\270\203\310\304o(\351,\034\240\344\r\251T\307sK\303u\256i"
+	.ascii	"~\334A\230\341\313\021\270G\351C\204^\016\006\336u|\326\341\247"
+	.ascii	"\n\311\nPy\177\203*)\254\301\244\323\214\034-\236\034\035\276"
+	.ascii	"\253\257\002"
+	.text
+	.section	.gnu.lto_.refs.a6f2ee45e073ce3c,"e",@progbits
+	.string	"(\265/\375`\270\001\035\016"
+	.string	"\346b`@ \217S\350C\222\250\244\213hG\231\362\345\370>c\304\007"
+	.string	"\347\006\246F\034\006\001\025\252"
+	.string	"\204"
+	.string	"\204"
+	.string	"\204\262\237\032\377\212\rz7c\217\325p\266\332\023v\267}R,\375\356\233\241m\204\354-SF"
+	.string	"N"
+	.string	"O"
+	.string	"&\317\227\262\223\362C\362\267\354\243|Q~(\373G\276\226\237e\377\344c\331=\371\231\275\223\317\311\276\311\327d\267\3621{s\216\324\2759\033\335t\221\346A\232\327\256\033\263\236\303\352\035\2747\372\326}\373\234\277\r\001\001\260\213\340\003\300^\302\037\205^\013\275\007\350\306@wG\326\363\343;\332s\262\276\321\376\322\276\331\036\257\274\013\253\337\002\357gdV\304\264\017\323\037\305\213\211O\337\345\363\267`\375\016\367\016\260gp=\345\376\300\375\352n\325=\252\343O\367\001\330\373\240\306\326\247\261\3753W\237\205\212\024\327\017s\342\005\344\276\004\310\3572\272'1\372G\260\210X\271>\210\017\367\253`\237\203\350\033`_\200\257"
+	.string	"?\005{\002|\004\330Q\360W\330O\360U\370&\330S\370(\374\022\354$\370#\330O\370\001\0278\003\207r+4\271\223\353\251\360\246&\320\233*\352\222\356\301\337\364k="
+	.string	"\277\254n\341}-\t^\323#\275\246\n8\365\266\"\3752\265\324\017\302\326;CF\f\030/db^ZXH\275!<\220\276*wWC\006\f!\337\013\331\327B\005\n\023\266\257\204\b\001\" "
+	.ascii	"\243\266\r\272F\221q\342l\242v\2371&\355\030\303\244lWXi\336"
+	.ascii	"\030\332l\202\335\262\202\254([v\301*\273\313\306\302\016\031"
+	.ascii	"k\203\0350\304\004\273\314\033\213\024C\231nL\253\324\003"
+	.text
+	.section	.gnu.lto_.decls.a6f2ee45e073ce3c,"e",@progbits
+	.ascii	"(\265/\375`E\304u\022\003.\313\304\021\021T \ni:\215\001\203"
+	.ascii	"\364\244\021\324?\021\204\f0\320\024\002\354\004\351E:j\005\231"
+	.ascii	"v\211\244\376\007<\f\355\235\347\177\037w\315\024\031Cc\330n"
+	.ascii	"]6\202eYf\377\362\036%d\271\352\256\327\225^ o\326bg\372\334"
+	.ascii	"\334\031\210\312MD\204\310\275W6)S^\017q\021\244\021xm\fo\241"
+	.ascii	"Ak\276\357\253\343c\204\275\367=\273R\366\276\357\3773\353\034"
+	.ascii	"r\0329\217\234Xg\221\023\311\031\344$\202\231\247\220\263\307"
+	.ascii	"O\037\347\217\353\345\3736\235B\316\253\217\0216-_&)\235\033"
+	.ascii	"vM\271\367}\177WeOn\030\3649x\331\031\013\017\241\030`!\364\034"
+	.ascii	"\274\3669T\331\347\300\265\317\001\312>\007'\373\034\226\354"
+	.ascii	"sH\262\317\301\310>\007\"\373\034nl\264\016\026B\203Tv[\370\326"
+	.ascii	"\331@[X\b}\312d\226G\270\262\376\006\265\375\016\304\300\361"
+	.ascii	"s*\375\331:\235\316\246s\306\311t.a\346)\343|\257\307\264\227"
+	.ascii	"o\320`N\031:LV\335)C\217\321rH8Q\245\220E\327<eh7}G\302\211*"
+	.ascii	"\005\246\271\346\336\221\245\007\036\240\376\0063\373\033\270"
+	.ascii	"\354\273?\213\3516m\007\304\322\360\233[\206\211\241\221b\367"
+	.ascii	"TF\373\321tzN\327a\246\376\243\315\\\327\321v\276\201\316\355"
+	.ascii	"\220p\242\3529\301Y\323\374\243\311h9\022NT=\033L5\021\372\217"
+	.ascii	"~\313b\243\377hfZ\023\377I\323l\343\323|t\237\270^\227(9vY\177"
+	.ascii	"\303\024>q\277)ppe{\256\343\306\004\277\324p<e\255\357h\270%"
+	.ascii	":\177td\255\247\307G\354\312+\353<\357\257\312\227Y\216\254\277"
+	.ascii	"\201IS\343\001\316P\202\206J\326\337\220\265\037\3671\377{x\n"
+	.ascii	"\231\225/Y\343%\036B7`!\364\033|\354o\310\261\277aj\177\303\323"
+	.ascii	"F_]v-\347\317q4\231\216\003|\242\343\252J"
+	.string	"\326ltUL\250d}\r{\366\177\355F\277\301L\rG\253\035\203\3516\337\260|\3370\357\373\276\003\rG\223\321lH8Q\365\246\230\3524\341\3505\274E\250\264|\247\024`f\327\364q\tB\346\n\252\257A\314\306\032\254\3504\034\204\312\024\254\254\257\201\310>f\3525\032m\t\316F\0275\327h\277\003|;\234aD\314\230e\255\313\350\263\377\275\264\212\230\224\265\254\177}\226\346\\+\262cK\326h6\244w\250\200\365\311\372\032\246\366\177\314\324g\264\231\377\307\313\367}\177x\275f\262~\206\272\255\315N\366\277\0074e\344\206\216\254\037\327\323:\310\\a\223\3653\354\331\271\213\210\353\262\020\226\024\361\312\372\031\352l\375\342!\364\031\334\354g8\2631V\330\366-\361\020\212\223`!4(\003\224\375\fH\3663\360\330\037\272\333:,\353\245\326r\035\246\263|\304\007\0076\3510\375\276K\030\007@\210q"
+	.ascii	"\3163M\226\230\250\376\320\334\376\020\233\376J\347l\260\271"
+	.ascii	"\311\372Ca\266\266\242\2750S_\271\326\202\365\212\275\3572\310"
+	.ascii	"[\262b3&\353c\017(\320\335\335\335\035\366\200~\bl\177\b\312"
+	.ascii	"\376\020\222}a\b\310\376\020\324\276@\245\241\350\254 \024*M"
+	.ascii	"SY?i&#tM):[\030\214W\327e\nM\306\035\334\037L'\005\265\234\341"
+	.ascii	"\247YC\256\211\301\234\354\266n\260\331\212S\262E\345\206\301"
+	.ascii	"\374\360\320G4\020MD[\351!:\210.\242\235h&\372\207\346\241\261"
+	.ascii	"t\023\235Dk\351-\275C+\321=\364\022-D?\321W\332\210\366\241\221"
+	.ascii	"`\246\316\3228\256sh\035}\202\314\315\371hb\260&$4\310\242\352"
+	.ascii	"\320\265\365\230\343\361I\322\264\353\002U\245\006g\003O\023"
+	.ascii	"\203\335i\246\0315t\226\236\022\241i\314\315\351,\236\334\222"
+	.ascii	"\022\t8-mfr\357\273\334\300[c^q\002A\3472<\204~\300B\3501\260"
+	.ascii	"\355c`\356c\200\262\217!k\037\303\216}\f3\366\205\370\354\013"
+	.ascii	"\271\331\027\032\333\027\222\262/\324c_\250\306\376\205\272\375"
+	.ascii	"\013s\366/\244\331\277\260e\353W+a&\007\275\244'\tSU\326\277"
+	.ascii	"\200e\203\340}1\007\024\337\335a\016\350/h\355_\270\261o\301"
+	.ascii	"n\337\302\234}\013j\366-\204\355[\230\262o\241\310\276\205\250"
+	.ascii	"\375\240\273\375\240\270\375\363\366\320\241;d\370\001\003\227"
+	.ascii	"\301n*\003\346KO\036\315&\313\333yM\036\036\314\344\345\341\335"
+	.ascii	"9O\006F{^\276\257\230\b^\036^\235\261&/\017\317\316\253g\350"
+	.ascii	"9b\327\005\274\213\362\325\005\325\017\022\333\017\322\332\017"
+	.ascii	"\242\332?\217\316\034\020\326\254\264\262\376ysxo)\222<JLY\273"
+	.ascii	"\241g\302\3009\313\372AL;\016\036&\3150o\2159\236\022\r\255&"
+	.ascii	"mW\\T\356\264\236HY\371\201b\203k\312S\263\017\220\271?QsvP["
+	.ascii	"_s\2544\243\324\340\3222\027\347\315\253\271\005\317\026\027"
+	.ascii	"SN,\214\0354ja\320\370\004\321\222\322F#\216\034,\315&\234\222"
+	.ascii	"&\2325c\266\262\230\230:[suR[hk_\266\304\314\214\264\231\273"
+	.ascii	"\263\301\205%\207\311\240k\242I\263\206\215\030\2612j_Kz4\233"
+	.ascii	"{\2224\317\320\324\250\311`\376\214\006\355,m+\252)\302\t\257"
+	.ascii	"\211\207\203\267,3\201\351\256\331\224\373\321\324\243\225\235"
+	.ascii	"L\301\311\2625\347\307\310U\234;M\332\200!#\343\306\305s\222"
+	.ascii	"\273\262\027o\271U\302\226?\031\315\2331\256+uZL\220\360\310"
+	.ascii	"bf\3304\305xN\362X\376\"T\nz_#w\266\336\367E\223\331\342\200"
+	.ascii	"\205){\343\021\341m\341I\341\261\361\276xoxK\336\032\017\215"
+	.ascii	"g\306k\303\203\303\243\302\343\342)\341y\341\251\341\241\341"
+	.ascii	"\245\341A\341\235\341\221\361\222\360\206\360\236\360\252\360"
+	.ascii	"\300\360\270\360\242\360\216\360\306xL\236\026^\030o\f\357\007"
+	.ascii	"\257\013\317\f\257\213\027\206\247\305\233\302\273\302\333\342"
+	.ascii	"\221\341\001\341-\341\235\361\326\360\204\360\212\360\262xVx"
+	.ascii	"m\274&<,\2742\236\030\317\b\257\fO\215\007\306C\302\363\342\211"
+	.ascii	"\341\261\341\245\361\276\360\344\360\342\360\262\360\230\360"
+	.ascii	"\260xnxA0\223\347\204wu\036\017^\217f\236%\"x9\230\376d.\177"
+	.ascii	"\216\343v\245\211\306\215\227\314\365\345G\214\214N\236\243\343"
+	.ascii	"\221\305\362\031L'\\\nz\233d\244m5\343\2044\317\352<\331\312"
+	.ascii	"q\262\2358N\262\222?k9\341\371h\363\261%6\306\310\034\035udt"
+	.ascii	"\272\232Nx;\350\2329\216\223\334f\344\253\231\3218\311i[\310"
+	.ascii	"\232\357\273\304k\346\262\262\340+} ;{\227\341!\024\327\300B"
+	.ascii	"\350\201\326\366\201\310\354\003-\367\201\240\354\003\005\331"
+	.ascii	"?\317\351<\034?o\211\307\304\273\201\261z9\324\230\221e]\305"
+	.ascii	"\263\253A\206%\353\003\355\330\377yR\274(\336\024\017\n3yT\274"
+	.ascii	"\032\037<\341-\274\345V\332%\313I\223G\305\263\201\351x\313\262"
+	.ascii	"=\203\331\325\234\201\267\b\225\202^&8OxT\274W)\217\007S\310"
+	.ascii	"\364\251\223{\337\345\206\017\037>|8\225\\\351\201\343\323\027"
+	.ascii	"\326\355\013\343\366\205p\373\302<\373B<\233'C\304yN\272\b\237"
+	.ascii	"\251(Yk:\0337\361\020J\001\026B/T\263/\f\333\027N\331\027\036"
+	.ascii	"\331\027\352\330\027\312\330\017\346\331\017\236\355\n\260\020"
+	.ascii	"\372\340\330~\020\312~\360\307~\260\306>\320\317>p\316>P\315"
+	.ascii	">p\2719\300B\350\201S\366\201J\366\2019\366\201\357\376o\316"
+	.ascii	"\376\017m\3777f\377\207e\377\347d\377'"
+	.ascii	"d\177\211\205\320\377h\354\373\350\366}o\373>4\373\276/\373>"
+	.ascii	"(\373>\036\373\276\031\373=;\373\275\264\375\336\227\375^\224"
+	.ascii	"\375\236\220\375\036\324~\031\026B\277\373\354\3577\373\273l"
+	.ascii	"\177K\331\337>\3667\215\375t\316~\232f?\325\262\237:\331?\363"
+	.ascii	"\362\374\345\317]p\032\336\242|\302\203K\3268N\304\263\22724"
+	.ascii	"NuY?M\262yX\b\375\032\036B\237\002\331_\303B\350\323\251}\264"
+	.ascii	"ng\260\234\00537\344%\020~\303$\365#\353\243q;\004/\336\200\376"
+	.ascii	"\016o@\217\262\331G\305\366\321+\373\317V\236\275\376\\%+\001"
+	.ascii	"j\351\300\321&k|E\304\263\025 8c\342\234d}\364\311\356\021\331"
+	.ascii	"G\241\366\233X\b=*c\377\344\263\177\262\355\237f\373\347r\377"
+	.ascii	"\204\262\177b\355\237Q\373\372\317\306/\026B?\226\223\344\"\277"
+	.ascii	"29y\324\262>F\253\303t\302\363}\261\344\276\370\3205\337w\tV"
+	.ascii	"\004\357\361c$\037\311Y\031I\036\222\211`f.\222\203<\013\311"
+	.ascii	"X\317\313\367m\"\3633\327|\337e.\222\337\f\004\257%\321iw\232"
+	.ascii	"\357\373b\260\"\370\017\246\303kID\370\302\323|\337\345\207\017"
+	.ascii	"\27529\270\220\b5^\303Ch\007,\204^\343\331?6\b\365\204\301\342"
+	.ascii	"\222\365\265\332VzC\263\221\266\344\266u#3\345'!\357}\213\264"
+	.ascii	"\331J\203Z\023\205vV\203\r\006\243\31272\r\265f\316\221}d\036"
+	.ascii	"\371*\343\310:r\217\274#[\345*\314\3147\362\324\261\035\276{"
+	.ascii	"\356\340\027\361|#Ka:\341\322\362\245J\301P\311\t\"\367\276\313"
+	.ascii	"\017\033>\230\300%\247O\006}\275\265\257\205\354\353\033\373"
+	.ascii	"Zi\237\207g\237\267\266\3173\333\347-\367\237e<?\345\031\032"
+	.ascii	"x5\354\253&(\253\254\263\223\266bc\304I\326\347u\355\334$\342"
+	.ascii	"Y\006\005b\316\220\311:\305B\350yP\366y=\366y5\366yN\033S\341"
+	.ascii	"!\364\002\236\375\fg?\247\331\270\017\226\303\314\f\360\334q"
+	.ascii	"\034V\373\271\264|\227\357\273\004"
+	.string	"\312K\376xaf\375L\266\2173@yww8\003\364\231\2713\026B\237\271\366\313\360\020\372c=\030\217o\354\017\036+Y\277\0037s\310\322\310\375\270\r\273\3417<\007\307\301Ml\007\337\301u0\035,\007\347\301L\214\007\2779\206\203\331\216\227\307hk\356\234\251\301\223\306\306\216Z\233:_\300\320\215y\361\203\271\374\"\272\324u\360c\260,x\213\220\367\276A\376l\275\357\362\037\374\"\376\021\037`<x\ro\301kW!x\321i\276\357\3628\314/\002\017\036\203\321t`z\337\245\036\024\024I\273aE\356}\337\017\0376|@\301\264\232\310E\240\361\023\036B-`!\364\370\317>\266\263\217\327\354\343\262\035\264\334\033\264v\005?\266\007<\204\036\313\330?&s\214\346\307b0\031>\243\201\367mz\337W\003\372\324D\204+k\\\006\2339>\203\315^|\306\003\254\367]\302g\200\352\336w\t\b\343"
+	.string	"`\034"
+	.string	"\355\225\365\344\013\252\217\337\215\313D\034\223\021B\251\256\226\357\330\373\276@<\267*2:\262>\261\020\372\344\346"
+	.string	"\017\241(\026BI\340!\364\354\276\033\036B/\201\375&\036B/\302\276\034\036B\361\022\207a\346\004X\354#>8OI\313\373\365\276K\240\240\235\025;?Y\237\304>\326r\ro\336\017\216a\037O\200\342;<\001\372\274\203\260\020\372c,?\276\202\277&\340=Aa\275c\357\273\264"
+	.string	"\264\264\212*\222\365\227x\b\335X\bU\032\325\034\377\300\017\374h\223S0\370\247\354\217\362\306\232\226\316\024\211\276A\234\026S\017\314\241\036H\273\234h\232\\C\312E\354\022\374\300?Y\204<\350\013;?\332\001-?JL\227\240.\360\315H\\\242B\232\037%B\225\373\007\306\371\321\n\322\244\330{?\220\215\221\004\320\n\322\344}?P\314\237J"
+	.string	"=\201\022\227`\240x\340\017\364\362\346\343\350\017~4(\r\323\005\370Qa\272L\263\200a\016\177v\373\321\005\340\241?Ej\370Q`\212\345\317\005\370\263\006\177\366\360\347\f\177\376\360g\016\351\327\217\341\360\333\005\236\302\007\220^\371S+?\272\323\032$\200\034\370yq\3779\343?\233\374'\230\377\354\202j \225\222fH\243@9\235\374\347\222?\335\372Q\013\374\350\005\322')\005N\376\324\202\377<\322\344O5`\362\343\262\037G\375'\214\037%.\371O\345\177F\375h\207T+\204\222_\303\3759\377\232\217\316\363k=\277n\376i\222_\367\371S$\3779\302\tG"
+	.string	"\377\351!M\300\237\036\371\365\233\221\377\f\376\347\034\224\004\356\360\343\240\037\013`\b\017\3715ZZ\344\307P?\256\3721\330\217o\374x\353\307(~<\366c\021~|\366c(?6\202\227\374X\310\217\265~\274\366\177.\215\340?\337d\375)\003\210\374Z\211\336\221\016\371\323\022\376\263\211\365\247)\204\374)\213\377\274K\203"
+	.ascii	"\371\365\361GQ\370\321\024\351\217_\257\3705\004\376\324\307"
+	.ascii	"\257Y\234\360\243(\322\036\277\036\001\275\220\362\370\317\""
+	.ascii	"\177\232\301\377\r?\257\203_;\371\257A\363\370\265\373k\342\377"
+	.ascii	"\f\256\376\264"
+	.string	"\352Ok\2442\376t\351O\t\220E\370\362\007\322\220\223\206\340\307w0\236\037MS\020\334\371\323\017\244\036\370\321<si\007~\264\256\202\247I<'\203t\205\234\364\343\013?\016\300\177\272y\333\007\360\277\305;\374i\214?}q\022?\320\304\217V\220\374Q\020\200G?\036\300\311\346s\354\3778\"\210)\362\202\020\300\341\1779\377\333\376\273\375\177\373\317\366\037\317\377:\377\355\374\247\363\177\316\3778\377\233?\232\343\377\231\377\302?\250\301\005\351Q\307\237\036\205\340G\311~\264\354G\315~\024\314\177\375\007\221\374h\327\217~\375\350\225\037\265\362\243S~\264\312\217z\375(\330\332\237\032\177\264\310\217r\375\250\224\037-\363\247*\374\017\372\203U\376t\003\177J\364\247\305?u\361\247\032\370\323\f\374)\006\376\324\002\177J\201?\225\300\237\266\370\323\024\376\324\204?\025\341OC\370S\017\376t\304\237r\360\247\033\374\251"
+	.string	"\376\364\202?\005\300\237J\360\247\032\376\024\350O\317?\345\375\351\177\324\356G\353~\224\356G\341~4\317\217\342\371\321\267\037m\373\3217?\272\366\243j?\272\346G\313\374h\330\217f\371Q\035?\352\364\243M?\272\364\243\357\217\202\340G=\360\2431~\364\305\217\272?\252\302\217*\177\364\370\243\306\0375\372Q\242\037-\376\250\372\243\030\370\321\026?\272\342GU\374h\n?\332\200\037-\341GO\374\350\b?*\302\217.\340GC\370Q\004\374(\211\037\005\341G=\370Q\021?\032\342G7\370\321\017?\352\341G/\370\321"
+	.ascii	"\374\347\231\0377\371O2\377\271\365\243\035~4\202\377<\373O\017"
+	.ascii	"\3779\347G9\374\350\206\037\273\375h\206_3\371\321\241\037\305"
+	.ascii	"\360\243\027~4\350G\205?\n\374Q\337\377\271\037\335?\232\376"
+	.ascii	"'\233\037=\177\224\367\243\377\317\346\177\332\371O:\3779\200"
+	.ascii	"_\277\375'\234\377t\373O9\377\311\366\237G\376\363\315\237E\370"
+	.ascii	"O7\377\271\366\237j\277\366\363\237k\376S\315\177\261\377D\363"
+	.ascii	"\237f\376\263\314\177\232\375'\224\377\314\361\237'\376\363\303"
+	.ascii	"\177\022\340?/\374\232\315\257\237\374\370\355\327M~\335\343"
+	.ascii	"\327W\277F\372u\373\353\342\257)\360k\023~\035\302\257A\374\372"
+	.ascii	"\202_[\360?\305\257\003"
+	.string	"\360g\016~\f\367c=?\316\363\3439?\316\340\177\236\377_\377\217\374_\363_\202\273\273\273\273\037\330\341\337@\317\017\225A\373\b(\263\217"
+	.string	"+\373\bX\262\217"
+	.string	"\037\373\b\200\332?@\335\376\001\334\354\337\267\005\205\033c\223\322\342c\342\263\302[\226m\262, M->\257^]\007\031\357[\344\n\3325u\004LN\314\307\364-}Y|a\230\351\323\342\003;\006\323m\302\370\264\370\260\240Q\322\256P\231:\002&\247\346\323\342\373\352\321\f&Q#\306\f\250\177"
+	.string	"0\373\007X\356\037@\312\376\001\216\354\037 H\227\330\0329_\336\254\177\200\032\233\212o\nf\372\252\370\234\334\361q\361\226e{L\026\224\257Jo\315\327$\313\306\226O\217V\017TK\331\020D\2025EH\326'\241g\037\253\335\371\242\370\2660\323\007\305\367\304\007\245n\352\b\030oN\214M\023\325'qe\237\004\022_\223\213\341X{\343\221\365I\344\330\277oI\266\222j\202\223\365\357\323\362)\251\321G\016Y\326I\360\020*h\270d}\022J{\210\017\310\230\034d;\300\\\345\031_\266xx\371`\bj6\206\304w\304\027\304\207\3453\342+\342\313\362\021\361\t\301L\337\020\237\217\373~\340\2613+\274%L\263G\016\303kW!tei\016\361\351\3103zH\335mu\275\357\362\003\306\362\202\223\004\203\276\001\316\266\020\013\2417\300\226}\003d\3317@\327\276\001\240\354\033@k\337"
+	.string	"B\366\r\260c\337"
+	.ascii	"Q\373\367\341\310\n\302\214\312\372\0370\315A{\225\356:h\362"
+	.ascii	"\325\360\331\360\321\360A\371\246|U>*\337\223\357\206O\n3}Q>"
+	.ascii	"\031\3679\371f\220\331\345\031x\232\276\250\036\235^\035^Kr\002"
+	.ascii	"\2379_T\257Mo\016^"
+	.string	"K\242\325\350\302\364\376\344\031\276(\337\022\336\202F\252\017X\327\006\215\006\217\2322\0314\336\302Ch\006,\204\036\2046\373 \220\331\007Al\037\204\256}\020\224\354\203\300c\037\204\032\373\037\330\355\177\220\307\017\007\340\027',\2575r\2759\314\354\321\365\354\254\365\352\340\265$'x\255i\366\350zwz}\360Z\222\023\354\322\364\224\270,q\250\346\223\2015\344\260d\375\017\302\366\364\364\364\340zy0\263\027\327\303\223\311\342z\3151qb\266\342\310\342\224>\270\222\242c%\367\276/\020\r\"A\362\370\364?\220\332\367@\317\276\007t\366=8\323\253\203\2614\bql\351\352!\346\215\003\017\013\0336P\262\276\007W\332zr0\263\347\326s\363\036\233p)\350}\265\3564{n\2755\264\007^K\242\275\336\232\250\024\2701U\250>VC\253\323\203\323\213\323{\203\231=\266\263\321LvD\260\3555\232iI"
+	.ascii	"h\244\336\240\311)\301\214\370\331\372\0360\355wp\267\337\001"
+	.ascii	"\235\375\367\324\302\b\255xq\361\223\365\261Z\027\267-s\232\""
+	.ascii	"\302z\3143)0/\271*OM.RzH\201y\311}5\243\374\220\002\363\352\022"
+	.ascii	"\353\205\351a\351-\t\240\326e\267\305uEv\005\363\221\002\363"
+	.ascii	"\352\n\343\245\303\004 \327\301\030\230\024\230\227\334\024\033"
+	.ascii	"[T\320\034R`^r\2750=.\0070\223\002\363\222\003\323K\323S\323"
+	.ascii	"+\323\033\323#\353\241\365\314\364\276\364\310\364\314zg\275"
+	.ascii	"3\2755=4\275\264\236\230\036\233^\031f\366\302\364\274\314A\231"
+	.ascii	"\302`\2750=+\037\320I\201y\311\275\357\022\350\303+\r\234\007"
+	.ascii	"\375\016\260\354w\240\265\337\301\216\375\016\336\375\021r\366"
+	.ascii	"G\234=\351i\t\256\355x\373\222\365G0\367Gl\365\262D\3551B%\353"
+	.ascii	"\217\360\261\301F<\355\213\220\333\0271g_\304\231}\021]\373\""
+	.ascii	"\224\354\213\320\261\317\301\335>\007s\3669H\333\347`\313>\007"
+	.ascii	"M\3669\370\261\377\336V\357I\357I\317I\257\311\232.b\226Y3i\242"
+	.ascii	"\321\246\016\227\254\317\001\215\375\277\247\244\227\244w\244"
+	.ascii	"g\244\247\325C\202\231\275%\275,!\275!\2740\252=\206\tO\023L"
+	.ascii	"\021\270\037t\315\336\222\036\221;@\346\266zKzA\232Qwf?<H\200"
+	.ascii	"\244\021\352\207P\263\037\202\313~\b+\273\207\205\305\272(\361"
+	.ascii	"\223\365C\020\331\017\261c?\204\214}\020p\373 \322\366\337\363"
+	.ascii	"\321\343L\225\235<\275\036\377\031)\033[\352\361\350QyI\363\325"
+	.ascii	"&\353w`\243\027\005\347\311\327\034\226-\273+\315\367]\322\355"
+	.ascii	"?Y_\315}\327[\202\343\325\224\003k\316\350\325`\352\352Q\355"
+	.ascii	">Y\232\275\252\036\216\336\216\236\216\236U/Go\252w\243w\205"
+	.ascii	"\231=\252\236T\217\252\307\324sj\202\352\211\342\223\371@\021"
+	.ascii	"3\004\203>\210+\273\007\225\305\205\005$\353\203h\262\017\242"
+	.ascii	"\310S\217\306n\262%\215\013\217'\252\236\214\"./Z\262>\210w\367"
+	.ascii	"\232\342zJ'\233\232.g\332z\257\332~\001\306v]\032\255<;\262~"
+	.ascii	"\001\276\266\237\0024\331/\200\216\375\0024\355o\020\267\377"
+	.ascii	"\315g\3071\321\274\226\262\336q{\340zbE\224h\300\351\311Yi\272"
+	.ascii	"\230\311:O\306\242\364\024\227\3657p\333\307_\373\316v\333v\262"
+	.ascii	"\3264\367\235-\207+JNWs\343\301\314}g\267m,/S`P\375o;u\352\200"
+	.ascii	"\324\350\312\232N\357\310\221\2667\353o\220e\316~\323dS\257\222"
+	.ascii	"\254\277A\224\375\r\232\354o\200\265\277A\325\376w\034\266%n"
+	.ascii	"H\342l\266\r\207\013L\034\225\254\307,\315\3124\243\262~\007"
+	.ascii	"i4\266v\233\255\266\327\366\033\314\334n\266\2300kjl\261\371"
+	.ascii	"\030aS\320k\203\tjK\304v\263\3212\233\036jP>\375\r\242\3667h"
+	.ascii	"\332\327\340n_\203\271\375o5\373\214.\213\237(Y\237\375\377N"
+	.ascii	"\003\304\242z\233\364\264\275m\311\032\r\232\204\317\023S\326"
+	.ascii	"\327 \317\376\277\315v\231m\0063\367\231\rf\303\027\037[\373"
+	.ascii	"\314\366\362c\237\331a6\031+\250W\224"
+	.string	"\327\036!\326\035/q\266\3767\231]ff\247'O\326c\226(W\022=e\262\276\006l\233l\213\301\361\246\344N\326\327 \315\276\006d\3665\360\262\257\001\330\276\006S\366\277\307v\027 t\362T\355-\233\313\026\333L\314\334]\266\026\261,K\266\300\2304?X\242f\242\274\366\310u\320e\207\231Ey\355\351\332^8\234\314|\372\032@\355k\260\264\377\341\316\376\0074\373\037\272\354\177c\331^JJSOY?s\331\202jn\257-%\345C\243\371\265\273v\225}eS\331V0s{\355)\232\313\353n{m(6\232\033\216\210\355\205\302\301[\250\242\244\004\351J\303\310\214\324\t\365?X\355\177\250\261O\200\270}\0024\367\t\260\266O\2000\373\337O\276\2270ay\371\311\372\035$Q\322\334K\366\221%H\264\266\264v\223\315d;\301\314\275d+\331K\266\221\270\260>ur'\030\037\257\224O\237"
+	.string	"\313}\0028\331'"
+	.ascii	"\216}\017z\366=\220\355\177\027\321aW\320d\215e\235o`Q<\236\262"
+	.ascii	"\3767\221me\f\026#\250\230\033mfrz\n\025-c\312\3163$\234\250"
+	.ascii	"z5\230\276\232[\262hi3\223\373\332\243\347\013\230(h\331\307"
+	.ascii	"\310\b\333`\312RZw\252Ak\360\302\250\032\300\264rnA\211\322f"
+	.ascii	"&\227\312\001\331\022\221\366I\371\220\220\362\346\224\252:\265"
+	.ascii	"\334\266\336\367]\302\344\324\342\205Q9\200\251M\263\331\324"
+	.ascii	"a\274\345V\312%\253I\363}\227a\310\2624k\3308i\274Yu\266\336"
+	.ascii	"\367=\241\316\250\223F\007\246\247\367"
+	.string	"\275\261\001\226(mfsy\264\264\231\311\351(R\312\3348\271\250X\321\323f&7%\255\323]\032\013\016\017\310,E\221B\244\315LO\321U\310Di3\253C\243R<$\234\250\032\300|\322L\023\373\323|\337\345\024.Y\242\264\231\311\235\201\3510\006\350i3\353\322S4S\207a\220\345M\0301Ku)\334\3716\205\310\0236M\335\345i\235\376r\322 \341D\325"
+	.ascii	"8v\232'\327\224S\353\006\007W\226\332\314t\224\264Ns\2211k3\223"
+	.ascii	"\253\222\326\235]\247\027\034\030X\321\322f6\227\326\245z\242"
+	.ascii	"\264\231\311\235M\352N'Z\216\b\211+o\332\314\344\366\324~7\326"
+	.ascii	"\266\261\243\366\214\355\264i\354 \373i/\355\033\273j[m\035\351"
+	.ascii	"\237\315\264yl\250\255\264\245\322\273\375c\313\3308\266\220"
+	.ascii	"\335c\327\33096Uj\267\233\366\220\355c\003\331;\366\025f\246"
+	.ascii	"u\351\334S\272\324\217\317O\226\031\025\n\032W-\361\020z\341"
+	.ascii	"\n\013\241\367\320e\337\203\327\276\207%i\\O\016\034\220\261"
+	.ascii	"\254\357\201\310\276\007\034\373\036j\354"
+	.string	"g`\267\237\301\236\375\f\322\366\217J=\305\363\2436P\250\364\0160xEj\r\226\254\355P\275\271\373\312\372\031\214\331\377\3239)\035\314L\353\244^\236~I\3014\245u\320\252t\214\204\023\225\tp\256\246\236\326I\303\244o\2740*\007\300\341\241q|\315\230\202j7\2646( Y?\003,;\016[\n\007\005#l\nz\233\262\240\330\3221\351\032/\214\312\204,\033\315\367}\331R7\347\233\b\"mf]m\251\2344\016f\246l\351\233\017\033,(\333Zn\375\f\232\354g\340c?\203\035\351\332\237\212I\311\3226\347\232,WeY\253\371\352\230\340\240d\375\f\246\366;(cV\003\216\2154?\303\013\243\332\\\262\240\232d\3225\351Y\212\226\246\245l03U\223\232yz&Es\235\252I\313>F\206\330\006P\244\244A\336\234\225\001\3653\260\2611\026\036B1`!\364\0310\355\017\240n\177"
+	.string	"q\373\003\270\263?\200\266\375\001\300\331\2745<\204\2060\2004;\303"
+	.string	"\276\3542\277\"j4vd\235\206\241\\\320\036\302\245\345\253\224^A\301]uii&\030\024\334U\027z#\rK\215\344/\035\230\336w\tH\312\007\n\356J\016\275a\205\247\211\356H\303P\036\250\017\336\262\314\204\254;\350\216\037t\322-)\224\224I\352$\025K\231\351V\252%]\246R\322&)\227\224J\212%]\222~\245]\351\224\364H\212$\215\222*I\273\244Z)WZ%M\222z\245VR\260\364I\232%\275\202\231i\330I\346\350\024J\325\244\301"
+	.string	"1\303#\rrE)\235z\202\322u\260\004\016\233&T\240\340\256\344\204\244EH8Q\365\244\340x\225}\f/\214*\203\023\234,\3154\f%\223\276KJ\320\272/\232\212\253\003\262\033\257\226V\236\361\305\345$\n\024\334\225\234\230\363m\311G\232#\rC\215\240E:\320x\337%+\251\031\024\334\225\234\030Z\005\025\353@\343}\213x\245?p\340-@\322=PpWr\350\016\315\005\323u\220\361\276XA\322\2634,\245J\257xK(\357[$\013*G\246\243\t\005w%w\004U\302$-Co\344\320a\035\230\3367\b\217T\017\024\334\225\\\032\2062I\273\240\340\256\272\3220\264\013\032F\330\024\364\276Y`\266\336\367M\303\320-Yb\232\357\373\2169\343ta\216\241IA\251\360\302\2506\030\2461\315\314\225\206\241O\320(K\322-(\270+\271\367]\n\321X\031\313:\241?"
+	.string	"\036i\226r\312\235!Y\177"
+	.string	"LD\322!Z\315\267\255\254\323!Jt\300\264\325\375H\201\370\350M\321\341\245\216\234\037O}\310\371\"\343\223u\352\203\027\027\344H\023\034Y\256t\214i\223\356\340\362\003W\226\365\005\260%\265Ju4\315iQ\313\361TG\030\276r\007N\237\254\323\033)\216\2755\245$\003\207\331\331\032\273\036U\275<q\332$\251\322LF\240\220]\311\372\002\250\262el\340ui\262\222Faf*\225.\215\245R)S\n\325\003j\216\234\034\360\2451GF\353?\205zjCJ\252\371\224uZ\243\227\226C\207\232\254/\200\247\375\247O\230\231\322\270\343a\210\224\033Y?.\235\361\277\227\221\304\301C\227\365\237\316x\352D\365v\341\221\265\214\267\352\215\226\254\217\001\237\2356\245Ky\310\022[U\326\307"
+	.string	"n\037\0037\373\030\244\335\321\301\262\203K\326\307\240\254\016\375\203\231\250\035\212\346\272\216\266c\207\232\241g\252\024\020\304\016M\203\322\341\265\253\240\267\351\316\237\346\007\314\005\215\235\036T\323A\373\324\331\232C\345P?\230\211\322\035\245C\317P7B%\013\357{\244n\213\016}\203\276\341\265\261wiH\001\232PY\2568|\370\360\2032\002Di\353\377h\034\312\0073\321>\350\036<(\\\007\246\247w)\213"
+	.string	"\\PY\256\344\372\240u\320;\035\230\236N0C\247\271\313h\231Q\202\352c \006\247'Hc\214\224\266&\232\307\247\343j\315L\326\307\240k7\217\245\240\310X\223\3651x\262\217\231\267\203\332\371\235%iVX\262>\006Z\373\030d\355c \344\r\205\203\312\301kc'\324\334\3209\230\211\276\241mco\250\0324<M\341\023)W\260\240\372\030\340\330\272JS\0276h\034\224\355\r\006\357"
+	.ascii	"9\303\225\3651\240\261\217\301\322\376"
+	.string	"\005vm\3205\314D\335\240j\250\033\024\re\323\201\351\tE\020:\324\r\252F\317\007|\240\262\\\245E\314\262h\241\372\027\224\331?\312\006M\343\361$\246\356Ls\305\326\004]\203\242\231S\343\275\223\365/\b\263\177\201\330\376\005W\366/\210\262\177\301\221]\0065\323\205\bXW\326\277\340G\231\013r\354_@\265\177A\215}\013\350\366-\310\263o\301\333\016\203\202\311euNVY\243c\250\027\314\374\031\364\213\2224JJ\262\276\005nv\214\367}_\3743h\3723\350- \333\267\200\271oA\225\315\004\302\001\244\313S\326\267\200\310~\007\247\032\352\305\013\243\332_\220<i\242KT\013f\242a\350\22514\f\375B\263t\240\361\276D\254\b\233PO\232\033>\004\277\310\371\261B5\026\024\f\310F\223\031K\330\260\250\331\017\200X\027j%\337\330\242\325\325e\204\013\235\202\341\360\241\243\221\365\003`\305\025"
+	.string	"\250-\024\noI\246\346\215\335\226\236\375\n\334\366+X\263_\301\330~\005]\373\025h\241I\200\326\234\240!\313\372\025\370@\221T \265\017\200\273,\314%#\013W\326\007"
+	.string	"\235\375\037\035\202\231(\0214\bJ\004\025\202b\341\265\261\367\255\332\300\n\016\2732\271\367}7|\300>\3260\265\321Xoeo7\246d}"
+	.string	"\220\355\003\300k\037"
+	.string	"Z\373"
+	.ascii	"\340\201\372\370s\023\275B{`,94.*Y\243=\256\231pz\303L\230Y\326"
+	.ascii	"\007@\324\346\275x\b\305ew\373\024\344\331\247 \316>\005gv\246"
+	.ascii	"@\314\266\360\342!4Sa!t\204\210\243Rh\227\231!sY\237\002-{\203"
+	.ascii	"\027\017\241\347\022\013\2414\252Te\031\311\372\024L\331\307"
+	.ascii	"g(\223\335\211\206:\235iuM\364\t\225\201\316@\2330\023uB\227"
+	.ascii	"~\2469\317N4\324\351\\\363\307\351TC\225\204SR\360\004\221\343"
+	.ascii	"}\301r\023\363\351S\240d\237\202\037\033U\372O\264\223\r\372"
+	.ascii	"\372l0\261\212d}"
+	.string	"\267\341t\202\202\"\313\372\024\320\230;\377\234~N\271\023\356\254;\365\234}\316\270\223\317\271\347\244\303\314\323\356\274\363\023\317\331\274\376j\003\007O\020\2718p\3168xm\354\304\327\034;\315\367]\3329\337P:L<A\344\224\344\321ah\0238<A\344\342\234v\247\233:M\267\363m\311m\213\216\332\326\334\234\363M\330{\337\2456[\247\335Y\347|\303kc\232\n\233\346\373\276\247\335\371\206\316\226\335)\347\214#lZ\276U\251\030\034x\202\310\001\237\340\242DE\240?A\233\255\303\204\331\237`\313\376\004_\373\0238\331\237"
+	.ascii	"k\277\375g[\346\3621\271M\236 rY\177\202\253\r\304B\350'\260"
+	.ascii	"\341\341d\3535-\201\200KVdn\262\376\004K\373\035\340\366;\270"
+	.ascii	"\355w`\263\337\341\314~\2071\373\035\306\266P\007\260\375\016"
+	.ascii	"Qv\356\260d\013-\361\020\232\273\260\020\212\276\347\231\323"
+	.ascii	"\folI\346)\3532<7\\>\322d\375\016CN\263\223\f\352\205\207\211"
+	.ascii	"*\353w\330\261\337\241\306\336\022\304\355K\320\266\367R\002"
+	.ascii	"2\273\347e,\337\340\301%I\326]8\2406\274\370h\313\372\022`\331"
+	.ascii	"\377O\261s\013f\236\\N-'\227\323\312\031\206\327\306N0\243\323"
+	.ascii	"<\271\234\314S\211\260i\371*\375\242^\016\037>\b\223\020\321"
+	.ascii	"s\205\352K\260d_\202\035{\271!\002m`;\262\276\0046\3661\332\027"
+	.ascii	"\330\026\226\323\013K3\313\t\206\231'\226\363\312X\317\312\220"
+	.ascii	".'T_\002\032\373\021\374\331\217\240\317~\004n\373\021\250\331"
+	.ascii	"\275\345\226\375\b\272\266o+\202\"\373\207\025\301\216\375\213"
+	.ascii	"@i\237\303\234\r\304Z\263\201[X\350\324\372\317\251\223\352T"
+	.ascii	"\222\217\244\321]e\235d\213\321\312\252\222\3659\204\331;\324"
+	.ascii	"41X\016\037e\370\013\007\030\232\b+5[s@\324\320xPQ\223\271\334"
+	.ascii	"\370\230K>\n\270\021\352\321#\344\363\013K_\036\256rx\370\205"
+	.ascii	"p\027\362\021\306\231)\271{\023\306\t\367\370p\274m9s*\361\203"
+	.ascii	"#\f\005\310\366/\314\003\034\302#IV\326\313\257\251\251%Xx\200"
+	.ascii	"N>+Pk\306\334\321Qw$\312\231\320NP-\313\2140S\352\004\313\b\261"
+	.ascii	"\322\363\225\265\233\233p\016\225\035Y_]x\213\223\250\034o\027"
+	.ascii	"\316\271s\263%\r\330$\205\210\f\270\254O\201\037B9B9\300!d[i"
+	.ascii	"\0268ty\262>\005l\b\331\204l[Q^{\200\340\344\2549C\367\346\r"
+	.ascii	"\260.\265\262\272\313\361ss&\246\310\227\2655:\0058e\261\311"
+	.ascii	"\372\023\220\242\246\006\034\002\002\253>?\262\022*\262%Y\177"
+	.ascii	"\002B\322\322\320\254\340\370\310\005\323p\025y\223\365'@C\210"
+	.ascii	"&D\003\262a\250\263\352\363Cn\331G\306\222\254/\2015\3023\341"
+	.ascii	"\031z\303\n\354\254\313\013V\233>c\320\240\001\016\021\246Y\301"
+	.ascii	"\361\221s\222\323\222'\353K\340HY\231\320\214\017,\352\316L\016"
+	.ascii	"\307\001{CS\346B3'\0305e\310\204f\231\016\236\035lB3!\031\266"
+	.ascii	"6@\276v\022\256)\t\334\360\342EH\346\323\023ug&\367\203\363&"
+	.ascii	"M\227\230\013\311\226\324\300\002%\f\343\203\212\016[\0300F\261"
+	.ascii	"\346\331\335~2\262\347\352\313o.h\345\344\325\305\217\226k\021"
+	.ascii	"vy\005LMo\220+>4Qwfr>&os\356\204\314\013\273\b\271\230\275]\204"
+	.ascii	"\\\204[\320\254\2100\3410\206V%\326\313\222\300\316\223\230<"
+	.ascii	"b\334p\021#\007\fL\270\364uE\335\231\t\333t)3%\313\205K\257,"
+	.ascii	"2<\262~\\o\310\377\236\005\031JO\262~\004\316\b\251\b\251\b\277"
+	.ascii	"\320(Ro\320\316\032X\250H]\271\360\013\311\025\232\237\254\205"
+	.ascii	"U\204^\300)bf$\361\262\242exA\265\275m\037^;\344\b\273znP8\267"
+	.ascii	"&k\262~\034J\345\177\217\001D\342\320\310\372\021\200\302\305"
+	.ascii	"ue\005v&\347+\202f\351\224\365#\320C\030E\030\005\310fF\350\003"
+	.ascii	"J\355M\326\217\200\320\211\320\211p\313\312\n\354\254\213'\003"
+	.ascii	"\f\016\273'\027n\005\343\266\254\201\265\310#D\"D\"d\222\026"
+	.ascii	"\345\265\247+\312"
+	.string	"\024S\312\222\013\231\244\\vxy\312\372qB-\273?QcY\013\225pM\025Q\223\365[\304\021&\331a\250\231'e\300\312\214\030\021f\241\231\272\003\353\332\262\247\256M\326o\361d\310\020aV~\257\366\213\305\b\223f\332c\t\027.\"\027f\0011Ma\"\246\305\324\006\002D(\304\2076u\007\326\265\365L\3059\022\344B!i\235\225,\\~H\202]v\342\360\310\303\203\207\320\007\037\264\207\025\330\231\0346b\267e\254\307\205>\340d\221\343\226\362A\325\246\352\350\276\252^%\334\221\337+,\2458T\315\352\n\225\234\357\215\255\312\034\241\325\205;tX\357N\031\326\221\254\2057\204:\234\204\225\221\323!\314a\306\254\213\351\207\020H\036)Y\2048\362Toj\313\207\\\326\217\333E\376\367\316&\313\032|\262>\013\247\031\027F\315\020N\245f6`15\275A\224\b\371\261\242\222&\367>\375\360\200"
+	.ascii	"\262)lB\251\013\247\322\320\273-eD\262\026\332\270\020\352\357"
+	.ascii	"\245mq\326h\311\372+\310\266\220\306\2055\376\336\351\003\007"
+	.ascii	"\035\256\254\277\302\313\376\205O\177\017\230$MMO\326_\301\334"
+	.ascii	"_\361%\224!\224!\374\241\003O\231\256\302\342c%\353\257\200\202"
+	.ascii	"\273\340.B&a\024\253(`A\031q8v\b\227.d\322J\352\350\240#|\205"
+	.ascii	"o\217\034Q\312xY"
+	.string	"v\330\304d}\b\310\331\331\001\207\200Y=\271B\243`\001\202&\353C\240L]]zf\265\004M\260M,\352L\326\207\300U\\\\\220.\003VH\366\234Ve\240\270\346\036\244\3535\211\223\323\n\312\251\365\270\341&\327\307M\207\224\0237\024v\260\244\t\362\341]\24159\203\323\003\007\367\373\262:\202\246\257\314\314\220\342\222'Oz\303*k\213\347\005'\353N\326W\321\203\316\351\004\361\004)\005-\231\340\\\331z\337+\017B,Un\300\356<\210G\327)\371!&\230Z\271C\245\304N\235&\036,\313\254\203uzv8\2447\326\322\314\310\372*d\274\275\001\207\240rSG\300r\325\02368\370\260\261\005\333p\235\016;\272\256\367\275\362\3203\243sW'(\347\301\266\337q\3633\204L\326\3018\230\356\177O\b\304K\227\216\007\224\355\377\017\276y\003\034\022\244\244\345\235\342@E\207\2374\271\367\275\362"
+	.ascii	"\244\364&M\033#kkjN(\2547\315\254\377\200\034\373\017\262\371"
+	.ascii	"\331\004\325*x\307\246\320\032Os\342\200X\302\234!\223\365\037"
+	.ascii	"\240t\346\3015g\202Y\360\373\276q\352ea\262i\276T?4\b\022y\342"
+	.ascii	"\221\226uPM\020-x\226\006M\nu\230\017z\371\205\375\264`f\220"
+	.ascii	"\031,\323$\005\253\203J##k\263\023.\t\035)Y?\005\265\375%\030"
+	.ascii	"f\315\326\033\034\023$\203\231\301\262\240\230`Y\220,\030F\250"
+	.ascii	"\264|\225<H\273\321\314a\316\262\264A\365S0\333OAl\377A0\017"
+	.ascii	"\206\271p\215\n\0259Yc0\021\017\202\361\2215\257Le\375\024\262"
+	.ascii	"\354`\227\340X\220KpKP,\205\254\375\007\303\202a@\247\n\336$"
+	.ascii	"A\357\233\245V\366R]i\020\304\262\252\252\313\372)T\355x\020"
+	.ascii	"+8$H\0043\203;\202Y\366\353D\265\365\"\211J\317\260\227%8\232"
+	.ascii	"\262\006K\227\332\344\250\311\372)4\355\343\257\254\240"
+	.string	"\221:\315\340\021:M%\301%x-\211\bT\332\240j\202E:0=\235\3605\247J\260I\220\213L\256\031\254\022L\342f%\210%\370\025\364\nR\tv\005\257`f\260J\220\311\203C\202D\320\202U\202H\336\232@{\256t\331\021\244\203Y\267\323\201\351\351\004\260;\315\240\224\340\024\314\fr\235+e\nF\301kW\313\367\006V\323\201\247\214\303\207\240\03667\037\250\376\203Q\202P\302,\221\300e\035\334J\257v\254\221\221\365S\260\355?\350\0043\203Ov\\\027\031?Y?\256\367K\243\225\245\266\237\202LPk\307i\002Q\313\372)\300\354\247\350\262\237b\271\237\342\312~\n*\373\017\032\t\026\021C\333\243V\004\016\033(\246\254\237\"\312\316K<\204z\300Bh\020HP\b\220W\331\0210Y?\030\344\177/\005\2556`\262\326?\362\232'[QY?\350C\350\346\304KX\326\017\366"
+	.ascii	"s\267\207G\326A\036\333)E\221\f|@\310\204\370\270z\220\307\037"
+	.ascii	"\244\201\277\254p\367\247O\326g\233\210\007\257\324\3204\263"
+	.ascii	"d\375\024R\301\247\007s\004\237\202:\364+\203\351]r\222\246\375"
+	.ascii	"\320\2007\306f,\353&O=\324\262\016V\005q\234n\177\257W\006\n"
+	.ascii	"\316\217\254\037\274\361\277\347K\362\246\311\224\2543\376\031"
+	.ascii	"48\365 \325\337K\277\250\232\274d\375\0244\366\203QA\251\277"
+	.ascii	"\307\373\223V\206F\326O\241\264\037\204\372\337\013\001\235!"
+	.ascii	"V\262\016\332\330N(\350\311\2407G\213\235%Y\377\301\032\017\332"
+	.ascii	"8>\243"
+	.string	"\001(\037Wx\262\016\322\020\361`\215\374dl\315\232\254\203X\b=\ng\202NA'\020\354\202ed\376Te}\024\230\373:\f\007\233\202Mu(p\005\227\202K\300!i\262$\341\222\365Q \022|\203/\bg{j)k.\353\2430eg\007\254S\263\265sD]\331\312\372\016\310CG\007\254\313gWj4\201\276\206\264I\361\203\231\300\272+f\313\035Y?\016o\371\337;\263\370\324\031\263&w9 \3331U\007WTl\374P\223\365\035`\306\207O\bV\262lu\251K\313\221\365\035\300\334{\366\274M\036cWqY\337\001Ov\263\t\324C&\204\034\206\263\343\306\314@=9L\031!U\262~\234\016\373\337\003\326\270Q&H\326w@\326\235;T!\320r\300\225u\t\355\314\271{\313\372\016\3301\007Xg\016p\b\372\276x\2115E\365^Qy\240CgiDYjE\006H[\326o"
+	.string	"\335~\003\320\354\037\350\306\004\272\3510\336\373\006\371\201\312-5x\003\306\344\310\001\016y\220\233\020Q\200U\204 \261\221\365\033\240\005\007\016\220\355Ad@\250\375\264\236\310"
+	.ascii	"\302\006EJ\026T\326o\200\220\375\003\3250\023\250\006t\263\364"
+	.ascii	"\205\336\310\021\245,\350%M\216\013&s\240\233\037\330\006\270"
+	.ascii	"\3663\303\372+\n\231\224\254\201kx\b\305a\356\366\017D\203\231"
+	.ascii	"@4\300\264/i\332\324\035\330\217\312\220\345\024 \332\201i?0"
+	.ascii	"\r\360\f\270&\247;\332\232\250\321r\344\272\304\262\006\252\021"
+	.ascii	"q \332\017\314\232?O\262\026\302B(\206\214\002m\377@3\307L\240"
+	.ascii	"\031 \220%h\224)\272:\240\254\262\260e\326G\361e\377@\263c&\320"
+	.ascii	"\f\310\243\013\345\222\002\363\002\362H\303\247,\353\243\230"
+	.ascii	"\262\177`\031\260\f\250c\211I\232#\212O\020\271 O]nE\302\204"
+	.ascii	"\001\222\211\360Biz\227\256\244_Qr\272\344\336\367\207\006\233"
+	.ascii	"\211\226\246\t(&\335\303f\214\037\035\365\246\004*\353\243\270"
+	.ascii	"\332?pl\f\370\245\202\367*h\371f]\331z\337\037\032\370\346\350"
+	.ascii	"i{\002z9\207\300\375a\262\001\b\345\203\354L\326GQ\305\205\013"
+	.ascii	"\020\207~\231\232^\"NP\265(\257=\247\032\031)+Y\377\004;11!\327"
+	.ascii	"\to\373\007j\001j\001V\351\227F\323{\304\n\032$JJ\220\031i{\262"
+	.ascii	"\376\te\366\017\\2\201K\340\024\007qy\372\324\005m\224\341\261"
+	.ascii	"\225\365O\320\262\217\255` \3301\023\bv\276\241T5\336\254\252"
+	.ascii	"\017VN\032\374\204\256\375\003\277\216\231\300/`\324~\235\272"
+	.ascii	"\304\t\342\223\002\307I\236\254\177\202\224\375\003\275\216\231"
+	.ascii	"@/\240\2158-mfTJ\376,\r\351\352\002\016\301\357\273\364^\275"
+	.ascii	"Jy2\350\221\003\256\254\253\347\345\355\205\222\365Ox\242B\005"
+	.ascii	"8\004\277TK\357\225\002\266Xi\276WW\036r\0272H\352\244H\001r"
+	.ascii	"]x\337\246w+\345\262\205IS\313P\273\363\204\213\316\267$\314"
+	.ascii	"i\210\034(P\200ONx_*![\357\325\225\007\275gI\227[\3267A\314\211"
+	.ascii	"\023\340\223c\252\367\305\362\365\270\272\362\200.\347 a\212"
+	.ascii	";\360\t\336\362{\253\352\302\222\365M\320\332?\220\3111\023\310"
+	.ascii	"\004\370\264\224c\003(Z\216\330\361\346\370\220\321\312\372&"
+	.ascii	"\324\330?P\213\t\324\342\315\021\341\205\362\276E\204\244Tg\032"
+	.ascii	"\374\272\2101\315e\375\022\344\366\0174\202\231@#\300$7<\200"
+	.ascii	"s\323\247\016\3278s\007N\326\300$?\360\b\020\t\357\ro\035t}\240"
+	.ascii	"\262\346\320\304C(/\b\026B_\302\332\376\201Y\307L`\026\320i\277"
+	.ascii	"5\250\3367\253GzFu\245A\256\262\272\363\221\365K\b\263\017\f"
+	.ascii	"\002\024r \326\201X\300!\017z_\254_\216\034per\357\025\225\207"
+	.ascii	"\377q\230\t\034\362\206\313\311\227\254_\302\220\375\343\347"
+	.ascii	"\037}\227\250\336\367\275q._*& \372\343\343\023c\017\177\020"
+	.ascii	"\363\260\005\3775\357g\001F\204\367U\022\007\353}_\274gK\031"
+	.ascii	"\263\344\243\202\367\377\257\341}\337\252\247\246W\t?\211\021"
+	.ascii	"\251z\022#Be\341)\215H\325\333T\325\325D\004\013?5\021\241\242"
+	.ascii	"jz\225,\274bD\250\236^\"UA\257\330\273\343IlI\t?5\275U\357K\344"
+	.ascii	"\rz\237\226\252^\261%\225\205'1\"TObD\252,<\211-U=\275Xo\320"
+	.ascii	"\323\262\b\325\273$\242d\301\206\330R\325+\206Ue\341\025#RE\003"
+	.ascii	"I\225\022\001\330\330\214\374\020k*\223\005\207=5\275RQ?\226"
+	.ascii	"\250\202\326\236\226X\257\333\373\3421\247\227\352]{_\013\336"
+	.ascii	"\367\007\026\225\333\322\016\\\306\264&\305\024f\t\013/\337\367"
+	.ascii	"\345"
+	.string	"\020\305\224\205\3656\255)\341w\355\211\013\353}\271\230\214\336\250\367}_\017\224\226k\257\022\274\246T\344\307\013\345\364\276\021\274\313\367\215z_%\374\256\275\357\253\364\276oJ\365c\371\276=\202\236\266\242\242\336\367jC\324\373C\211\214\323\373\346\2619eUObYX\"\310p\021\333zg,\225\360\023\024\326\273\365\272\021\241\332bJa/\324\373\276\030noU\341\320\2235\360G\023\236\022\204\310r3Y\275!\223\365\227\036iH\262\006^\255\0313dL\326'\301\3152\r\303Sf&\353\345\016\257<S\262\006\346@\363\347\b\216\254O\302\231\r\274\201O017O\262>\t]6\220J\357\"A\300\304\262>\tT6P*\b\206\r\263L\326'Ak\003\241V(\251-Y\237\204\254\r\254\221R\261c\263\222\365I\260Z\376\312\202x\311\001\234\321\353j\202\003I\326?\341g\003e\350\033hjE\352"
+	.ascii	"\2316\2349#k\262\376\2114\300%=\307\314\237\036\340+\202\022"
+	.ascii	"\025~_0q\240\232\357{\245\201N\223#MF\326w\2770oT\272d\375\023"
+	.ascii	"c~~\177~u\230\371\263\373\315\375\007\367\333#\366\263\373\305"
+	.ascii	"=5\337w\371"
+	.ascii	"\263\373\361\371\311\361\302\250R`\272\313bv?:\337\215\250;\263"
+	.ascii	"\340K\003km\353\237\250\262\177\"\311O\356\327\207\013\2337y"
+	.ascii	"\330\202\330\251\222\365O\374\330?\341\264Q,<\204\236\r\013\241"
+	.ascii	"7\241\347\327\024\362\261\021\227&\353\233`\263\177x~v\216\231"
+	.ascii	"?;?:\001\240\223\352\003\266\002\334\027=Y\337\304\330\376\177"
+	.ascii	"u~t\3344\311\262\376\315\341\021\206,N\3267\321\265\377\237\233"
+	.ascii	"\333ON\005o\022\254\027G\001\270\244\356\266\336\260\331\310"
+	.ascii	"\221\365M\370h\223\203\346LL\231\254\177r~l8m\216\030\"\2778"
+	.ascii	"?6 \262\2558 \0366[9\262^b\270\252\"\225\365\027\246\237\261"
+	.ascii	"\265c\346o\355\247\226\337%-\257\322o\314\232\234 \351V\033/"
+	.ascii	"oY\337\304\323\376\177m~ju\340X\221\223\365\217\215\333\031\264"
+	.ascii	"4Y\177\004\272\375\377\326\0343\177k~j\364+\243\351=\002\206"
+	.ascii	"\226]i\360\273\223\343\346\224\365Gh\263\377\037\332O\315\027"
+	.ascii	"+e\354d\375;\313\230O\037\260\037Y\177\004/\373\377\245\371\241"
+	.ascii	"9\245t-1\351\345\361\321%uf\003\235:6jf<\314\311a\352\312\372"
+	.ascii	"\377\2251\363\355\341Z2\2255\231+N\266\254\311\372#L\331\357"
+	.ascii	" K\332W\376\262d\347\003*[~\\~^~d?\346\017\314\257"
+	.string	"\313/\314\357\313o\314o\354'\366+\303\314\237\230\337\362\277\260\237\226g%^?1\277\256\237\230\337\225\374\005\257]i\257\237\230\037\327o\n^K\242\277\352\232X\352X\221\362\023\223\273\262\027^\273\322\\v\315\367}\301\360\026:?1\277*x\313\236\034Q\3126\004\363\374`c\322Ag*<\204Z\200\205\320\227\250\333/\261g\277\004\235\375\022k\373%\316\366K\220\331/\001f\277D\330~\211(\373%\202\354\227\230\261\177S\3500\320\236&tL\262\276\bu\373\"\354\331\377/\312\017\n[\004\212\225\254\267|u\324x=\311\372\"\240\355wP\344\207\244\315V\223_\226\033\223\337\222\237\326\317\311\357\tf\376\232\374\222(\371!\311\242\323\3745\371Y\375x\314i\376\232\374z\374\210\360\226[\333\006\323\033\312\364\001G\fP_\0042\373\"T1\362;\322\303\352\301\\\312\372\"<1\"B\222}\021\256\206"
+	.string	"\255\264\344\261\312\372\"\374\204\374\202`\346\017\353\367\003/\337\177"
+	.ascii	"d\315\326\017\353\347#\345\232\272\003;\231]8\356P}\006\264\355"
+	.ascii	"3\340l\237\001d\373\f\030\373]\345\2726mP\262>\003\276~;\030"
+	.ascii	"\020e\377?\035\330\n\211\232\345\031;\\\316\336\320\332\230\221"
+	.ascii	"\221\231\343\362f\314\357\311\267\307"
+	.string	"\207\307\027\367\203\362\365\371-\375\234~T\276\346\217\306o\352W\365\263\341\203\373\345\360\345\361\361\371\341\370\311\370\335\360\311\375j\370\346~3|u?\246\337\373\223\362\375\361\371\361\321\375\224~M>;\237\036\337\035f\376\242|u\356\263\343\273s\375\345\013\215f\031<iet\315\346/\312\307%\345#\265\205\246\266F\314\0375mx\313\007kj\300\204\311`\344\344\031n\316\266~Q\2769>:Y\266\334\340\340-djm\320\232\"\330\304l\305\3113\302\220\261Ik\256Q\003\223\206Ns\314K\027\250\25543os\277(\037\232:\315\2571\277(\337\230\325\024]\235\334\373.{r\330\334\256\240\240yK<\204\222\300B\350\031\200\303G\007oI\245\334I\351\311\372\f\210\332_\200\237\375\005\274\355/@m\177\001X\366\027Pd\177\0017\366\025\300g_\001o\373\nP\333W\200\331\276\002\302\354+\200\271\257"
+	.string	"\257}\005h\355+\340\306~\bt\373!\264\355\207@\266\037\202\226\375\020\250\354\207pd?\004\252\375\020\232\366\023\240g?\001g\373\t\260\262\237\200!\373\t\240\261\217\200:\001\355jd\211\220J\025*\322Ht\036YU\331\213`\203\313\036\261(X"
+	.string	"\026U\244Q\270\032]\250.R\212\0137\0021\\\217X\367\210T,\341\256\255\205\266x$\201\330\222\340\262G\024\3125\006\333&\327u\204#\345\232\\W\027\032Z6C\361\270&[\244v\350F \216\220\312\344\272\016\221F\237\313\036\1771\224F\365X\304\2628J\2528\202\241\"\306\212\365\b\251]\225\030X\264\254\320\360\230\201E\361\310\022ap\225H\025+\202\224j\361\250\272,\216\220\312\022\212F\026\311\305\005\031Z\024,\210J\f\305\026\205\320:\374\025\035\331\t\024\327\030l\t-\n\f**@\241e\001\260\276@\036\255\312\tn\004\"\304\352\252lq=:B\261\022iH\301\301\250\022[\227u\021\002\351XT\200\030HG\326X"
+	.string	"\017@\030\202@\"F\210\265\210d$\036\331\020\312\026)D\b\030H\245\221\213<\246D\352j\324n{D\022O\"\367\310*\215\250\321X\302w#\020E\025i\314p#\020EGV\005q\305\215@\264"
+	.string	"(\261Fp#\020.{d\207E6\311\036Q\024\331dz#\020m\007\227=\242h\211J\341\215@\254DjkdU\242\340\021\311\272k\213\241%\022U\341\215@ \035\261!V%\022\322\021\013\274\021\210\030\310\020\311\366\250\210\"\006r\204\325e\217lPR\022i\"\350\002\0067\205\342\257\035\006\327#\365\250\221F6)AR\022i\302\202{#\020EI\342\021\251\204\337\331\016\213\222@wx,J\236\307\242$\317\310-:\256Ft]\201muR\022I\324J7\311{0I\351\266l\321\272b\250\270\266H\272M\257\272jqX\224\004!L\036\255-\212\222\035\212,(\205\305U\311\"q`]\261\302U\"\261h\331\013GHe\t\023\254EG\325\210\030\304\006\205ID\254\213L\241x,\361Bm\205~\0358"
+	.string	"\341*\325$\210\"kT%\320\242X\225H.\021I\351\262X\225H\355q\275 \311U\262'Z\024Ad\213\225%b\213\310\243c\004V\227U\302\230 \305\003V\250 \201\204\242\272*}"
+	.string	"\300"
+	.string	"\bCP\373k\321\013\030\206\202D\220"
+	.string	"q\202\211\026\023`a\242\207T&\025i\013&\304`K(\036K\254\256Zd\215\352\213\r\277\024C&\002`\302]\2138"
+	.string	"@\205\205V\203\320\205'\262\312\365\270\026\355{"
+	.string	"B\001@ \021#=\t\004p\200"
+	.string	"\016\320\223@\200\b\021\b"
+	.ascii	"A\304>\b\"x\256\353\272\256\353\272\256\273\016\333\"\325X\302"
+	.ascii	"\t\025\203\253\\]\242\252T\215\210C\027\211t\261*\203Za\233\374"
+	.ascii	"\255`4t\325b\022i8$\264\016K\300\200\301MR\225\312\022\035XD"
+	.ascii	"\340\2727\002\201\301\352\252+\204H\024\331\024J#7%\201L\306"
+	.ascii	" Ai\344\356vu\325\025De\212L\306 \201\250D\333\325U\225\347\t"
+	.ascii	"\024*\224F-\216I\305\236\n\352\252t1T\223n\006\337ZD\246P\223"
+	.ascii	"n\352\"[\024W\025\216\254q\267l\361\2104qD\262G\034\326a\021"
+	.ascii	"E\f\244\213\264\210b-\"\217\320\030H*\220KT\206 \022%W\227E\361"
+	.ascii	"\270\246\355p-:\252+\204\311\325e\341*U\267\355\255EGUy\256\303"
+	.ascii	"\037\221-B\242\260\026\221G\275\033\201\210\241\fQ\224\024R\372"
+	.ascii	"\222\352\021Qy\026\327\030J\0131Vc\022\351\004\221Q5\362\035"
+	.ascii	"\331\n\206EH\306\344\006e\361\310\272\030\272j;<BR\272*\254\311"
+	.ascii	"V\002\340jT\211>W\271\2768\262De\221=:\217\354\321\216\241\036"
+	.ascii	"m\240\326\204Q}qD\262(\210J"
+	.ascii	"\r\355\272*\213\326\023G\252\211\027I\242\013%Xu\303\221%\256"
+	.ascii	"-R\f\345/\006\222:\214\241\036\001\265C\2775\231\344Z\340@\201"
+	.ascii	"\213\224<\262\032\326d\222\253\276`\225k\261\303\260\350\310"
+	.ascii	"\022\225\033\222\303#UI4$*\333!\333\266J\016Ev\350\262G\244\340"
+	.ascii	"\bc\fe\013\344\266*\321\020\311E+T\036\333a\f%Q\253$\002\265"
+	.ascii	"\306\365xT\215\210\303\265\310*\223\355Q\004C+\030\021\211\252"
+	.ascii	"\217HT\201H\345j\001\"QM]\242\2658t5\334\b\304\021\311\252\026"
+	.ascii	"\264HC#\242\313\252(\036K\030\215H\245\220ru\327#\244z\301}\261"
+	.ascii	"\026\213\222@'\316\026i\0046\331\242Ej\213cKD[\244\021\210#\330"
+	.ascii	"\022\304\021\254oM{7\0021A\253&\217\220D\240a\221z\024\034\026"
+	.ascii	"\251G\300\237pH\034\301\016\213\324# \341\261%\016\331d;,R\217"
+	.ascii	"~Ej\0137\211\244\004\272\356\220h-r\270\021\210\266\270\272\253"
+	.ascii	"1y\2044\201\241\225\240E\221\206\355\021\253lqb\b\251\\-P\244"
+	.ascii	"\036\245\356\215@\270\307\365\bih\001\206\252\344\2258B\272-"
+	.ascii	"\022qX\244\036\t\335\b\304\0041\324#{t\001F\006\367\270\266\253"
+	.ascii	"2\351\"\217\256\352\342\005\007\342\013cp\035^X\207\030V\242"
+	.ascii	"\022\t\311B\271\272k\n\367\270*\225H\304\013I.KT\223\252\013"
+	.ascii	" W\035A\002k\213\024l]\345j,abm\2210\254E\352\021\311\272\311"
+	.ascii	"#\244\366\210$vh\331vU\256n\233d\344\252.^\b\327\"\3255\"_\030"
+	.ascii	"\215+\321hD\"rU\027/\204\214\253\211$\345\352\272\352\b+Q\211"
+	.ascii	"$\032JR\215\311\226\305\340\252.\330`\321\221=*\325\td0\252D"
+	.ascii	"\326e\225&\224\310\022\\\325\305"
+	.string	"\013\rE$\253\\U\020%Q(RY\270\252\213\027A\356\215@\204@\262\032\\\r\027Th\325\024G$\"\340:t\225H\025F\225U\256m\006\326\227l\217\332d\221\005WU\026\221T\027\303\f7\002\321&\213B Y\fm\262\350\267\016U\264\311\242 R\231\334\353\320\267\026\221)Z\325E\273\327!\020\322ER}\353\260D\233,\n\026\221\324\021\220.\222\272\221\253\2215\252E\303\265E\032Z\207k\021\231\342\027\003it!\\\211G\344p=B\032\r\335\265\035\266\311\"\r\305\016\206k\2134l\223EAI.\333\252.Z\241{#\020\255\013\\\215HJ\335\016\333\325\210\264\002\210\264\002\371B\271\266B\030j\022o\033\215H\2456\"\272l\362t\201)\316v\230\372\220/\224+\213\265E\3327\002\021\"\202\340ZD\246P\2561\330\243^qm\225\353\213U9la\250IB\032\222\254\221\350F "
+	.string	"\020\003\351B\005\242jt\021\244B\253\036\r[\2668l\213\306\225%\302\260\026\221G\272=\032\256J$7\251\022[%\322%\262\305U\231\034\256/X7\251\026U\241\"\233\374\035!\217kq\330\266+\021\251L\016\213l\322\302\021\311\272\307\365\305\252LFP\301pu\325\2658$\"B\256*\250\3560I\205\241\036\221\224\027\264\250\273\026)UW\350\016Gt\260\036\261n\022\211DAHd\342D\211\366w\204\304\242w\204\201,jp\335\242#{d\325\243uE\273\032\211ID\240vh\341\b\251\345\271\307\341\021\257\035\276X\213n\233\246H\301\242hD\016\217P\0260\326\343\360\bU\252/x\304_;\004\336\b\204"
+	.string	"\224\253\321\310\226\200$b\211|.{D\341\262Gv\350XBQ]\225\250\322UA<\"\225\240\272\352\211\242\272\256@*\223L\340p,!x#\020\254\033cU\256\306\342Q=\201uc\254B\356\221(\267C\342\272B\005\242\352\302hTM\260n\214\325\002\353\306X\265\333\016\331$\013\242\365\304\232Lj1D\241\202\305o%\036U\267=\262\333\035>"
+	.string	"\205>\262*\216-\021e\223-\257\035\232\030\201\342gb\004\212\036J\034\301\362n\004\242Er\301\241\035\246(\006)W\267U\217\320\266]\225\305\242\232\256/T#\013\244\344\321F\032\276X\213-\222\213\335\016W\"\373b=\321\"\271\370\255\3035\231\324\242Er\321[\223In\213\344\"m\221\\\360V\243JlO \244r\265"
+	.string	"R\231T\264M\234(\341\016Gt\340\036\331T\305\005\030\352\n\023'J\254J$WU\256\311\243\325\375\2717\002\201\224<\032\"\225IED\242\032\242U\256/Xe\221"
+	.string	"\353p\005\007\037p"
+	.string	"\002R\362\b\311\210lW\245\257\035bX\207H\311\243\237kDj\327\025G$\213\224<\272\260\016\207\302c\021k,1\\\341\004\007\254\256\272\"\251\250\256+TW-\366\210\222F Q\3228\\\301H\205\021\035\\h\223H\345\t\345Zd_\260'\220\222G@Ej\013\326\215A\202{D\201\224<\n\256C\341\tB\2675r\325\243#\334\016\223DB1X\245\253\246p\217\353\021P\373S\201\2104\232(\252n\273\"q`]\201$b\211\202E\022\220D,\321\017I\304\022\001\245HeR\221\317U\241US\374\332!\320\275\021\210a"
+	.string	"\222\214\\\243\272\032\245\355\260\004t\253\256q=\021\\\211G\225U\252\022\b\026\327c\021kT\323\026\350\016\335\335F`=b[\264HH\366\305\252L\n\215\256\021I%\362%)\221n\313\032\245F\355\252$:\321#\253\232\260\266,\362\330\373\035\221l\213D\204\272\355\360\305z\342\305z\202\005\fU\211\301\030\034r- \rQ@*\223\212\204\\\025p;\374\255\256\352\266\247\b7)\024\212\020!4\00284\"\203\320\035\221\224\333aQE\342"
+	.string	"\353B\310\201\213,\302E\036\341\"\213P\363\b5\213\210\221G\304\310\"\222\362\210c\322\211#\220\020\321\202\333\2621\324^;\f*]\025%\202\334\341n\323\265\310*\335\026]\223I\256nQ\367F B\034\221GGn\253d\211|\355PH\351\2528\226\340\200\fn;\\\213T\227\005\321\205c\tI\306dRM\333\264Hu[\343zT\256*\374\216\254jd\302\210\350\"S8\301\230<RY\020\211*\320\332F"
+	.ascii	"\331b-\"S\270H\245\212V=\001\251L*\342`D\"G\030\236EG\266\310"
+	.ascii	"\004\243\212tbm\2210\270\303\030k\361\310\016[\"{\244\036\223"
+	.ascii	"\212C\r-\033\243D\021\222\213\365D\t\300#\033CMA\224D\341\230"
+	.ascii	"T\354\251\320\252)Z6F\td\320\215@ \225IE!Z%\262=\256-\260\205"
+	.ascii	"{\\\217\326\027\310\024HeRQ\005DI\343pU\2520\212J\325\310\202"
+	.ascii	"\262%\032\032\025\261F\303\265E\032\"\335\337\nF@+\030\005\211"
+	.ascii	"\0201b\270\202\021\206\021C\227\b\331n\200\241&\r\221@0\220F"
+	.ascii	"\"\345\372\342\001*\020W#b\320\302\232Lr/XH\217l\262\035\302"
+	.ascii	"P\223.\234p\301\032U\023HeR\221\006\241\344\320\310-\26204p\340"
+	.ascii	"wL*\006\271\306\f\305\325%\256\356z\242E*\223\212\202H\"\226"
+	.ascii	"h\210T&\025\365n\004bU\"\211!\210C&\"X\221\214\352\213\341\021"
+	.ascii	"\311\272\304U\251D\0229\270\355qM\036!\211\303\"\265\035\272"
+	.ascii	"\252\213\027C\355\020\270\202\321\020\206\232$\\\301h\030\264"
+	.ascii	"\202\221\021\321E\036\335\033\201(\262\311\020\256Q\021k$\332"
+	.ascii	"P\002n\207DE6\211\252\300(\360\t\\d\223<\367\310\"U$\221\212"
+	.ascii	"Gv\002\032~0\324\n \261(\262I\341\221M\341\226(\262\311 \227"
+	.ascii	"\270\022\021\t\271\3125\031c\035\272F\326\035\036\221+\260J\244"
+	.ascii	"\321\206\265\210L\221\344\262/T\245\t\254{T\201Zd8\262\252\t"
+	.ascii	"J\244\253*W\f+`\250I\026\214+\221XbuU\245\260X\024T4\"\215\332"
+	.ascii	"\225E&\335\265\335\260\036\261\256/I5\256\305\037\006\241#\222"
+	.ascii	"u\331\242R\205\241D\226P\\W\242!\030j\322\020\310\267\202\321"
+	.ascii	"pD\333\252I\030H\243\205$\345\372\002I\\\225C\243VU\022\205\302"
+	.ascii	"!\027)\\\223In\020\373+:\252\033Z6\206\252\341\310\252E\026\332"
+	.ascii	"\243aQ]\215T\025\220H\343P\271\036YU\351\016\221J\242\312\341"
+	.ascii	"\310\252EA\026\224H\245r\325@D\204t\221\210C\342\260u\241^X\223"
+	.ascii	"I\356p\204ru\215,\321\205\025\214\206Gv\005\243#\345\352\026"
+	.ascii	"1\254Ed\212\343JT\256*Ztp\331#\026\205\325Xt,\241\341\310\252"
+	.ascii	"&Xp\327"
+	.string	"v]\241\\\213\212Xe\013\030H\243\261\204\021\251t\217H\023F\304#\222j\244`\270\266H\027b\250\306U9\204\241&\r\213\253\253*\213V\367\310bX\201U\252\353\221E\301m\221\224F\256\320yd\325\"\337J<\252/\212j1\350\"%]$\344\360\002\352\036\221\220\304\241\321\270\022\207C\244\213\244j\030\272\307\225m\217\252\322\335\340\266H\244\213!\021\321^\217\324\024\222\277\243\244rxd\217\200\305uM\266C\367\270\036\271-\322\006\212\352\020Zd\223\302\265UW%\361\310\256\306\"k!\331\016WW5\"\223\312\325=\262\256\252\034\306P\217\206DD\026\\\366\2105\016W\025\330d;$\"\022*\221.Q%\032\032\271H\344Q;$\"\nB&c\254\303\365\205\022\2118$J\032\207\307\244\342\205\225\250*\207\306\365\305j\004\n\2727\002\021\242(\231A\271\036\261-\212k\206\027\353\211\325UW"
+	.ascii	"\203\216H\266U\256/\216(\216`\250\260p\004CEq%\036\223\332c\004"
+	.ascii	"\326\026I\350\266J\244\021\326\026)\230\244t\327\243\325\270"
+	.ascii	"\266\260\340\016\323\266Hm\201dQ#\222\210t\221J\025\256\022\231"
+	.ascii	"l\217\252\262E\206\242\243\352\302eGp\221F\355\211\265E\002z"
+	.ascii	"\261\026y+\222Q\225\200\273\266DD\017X\215E\024F\325e\213\330"
+	.ascii	"b\206#{\364[\215\256\213T\032\2711\324\243\237;\004A\204{d\221"
+	.ascii	"v\361\250\036\035!\211G\366\310\347\036\221\220&V#R\205\022\351"
+	.ascii	"\"\217\2047\222\340\310\344\252\f\341\"\221\312\020\277vh\342"
+	.ascii	"hu\333\244V\030c-\036Q\024\331$\320\013\326%"
+	.string	"\252\026\326\"\362hX\204\344b-\372Z\"\353\266\254\253\272\355P\205Vu\201\214\210.\013\203E\213T\001\302jd\211\220J\025\253\253*\207T \"\215D\345\372\0029DJ\022\203\353\021\333b%\252J\023\216\017P\2560\220\311\fJ\325\210\250\225+K\304\272\307\265\210\242\250T\221.\200V0J\261\266F\350\352\252.\213#\222uU%\322\205\325UW\254+\260G\254\233|\200r5\"\025W#b;\344\016I\270G\026)\275\b\021&*\210@\n&l\"\210\"\226\350\210$\2068\262\352Q\b\242\262\r\001\"\202\242#{\244,\241\002\221uY\254F\027\352q\265\360\037\310\213p\216\323\227=Y3\241\341\370\2215\220\030\220\030\020\227$\030\300\271\351S\267\345@\\\202r:\340\274d\265\355\037\210\t\254\023\312\241\305\241\241\245\212IF\305*\f8\205#\211\024.K\256.]r\262\b\247\270\310\221\335"
+	.string	"\003F\351\230\303\343\007\213\r\273+s\314\217\001\272\022\266\365\276o\020p\316\0361cY\277\002n\200\246"
+	.string	"M\001\262\202\251\250\364l\220\006\216]Y\327\201\254\374\314\351Tg\317\233\254\201\252\374\214\037/Y\330\262\006\242\3623k\324\262\204\244\331?\020\227\233\224\312\225\227\032 )o\260D)\022E\270#JT\023\\\326\302&RJ\200"
+	.string	"m\001\323~wK\3660\201\236\b\205\374\214\224\315\265\001r\"\314\n\346\361\342\303\004\250\211\220\211\326\224\224\220\254\217\231@L\200l#\350\2012\002\264\004\b\0045\343\301C\006\220\226p\313\r\313\bT\326/\220\220\016\316T\237\\%\fG\016$\2759^\354L\211\001:\362\365v\207\314\b\217,\206\331\344F\021\037Z\254\316\334\237\254\345^\333R\207\t\021\035\2779Tz\304\f\351\302\323\303\303\353\fK\350\246.\311\033 !\300\367\3056\312\360\201\n\"4\203\342\250C\007\r\020 \331\231\0346u\226>0\246'k||I\263\365\325\003\210\003\214\030\232\245\254q\340"
+	.string	"\272z\003\313q\240\253\035B\255*;\306vX\375h2\303\211\214\214&89@:~K\260%O\240|AA\001UA\001E\035\250\n\210\252*\213\0363Y\377@T@S=\272P\371\262\205\215\244\231q\003H\352\227\004S\365\301\021\247\002Y@3\200f"
+	.string	"\325x\320\222\320\n\210\306\201j,_9hY\003=\361\366"
+	.string	"\271\350\240\341\205\351\262H\271:R\325\324\004$\243\247\364R\315\225\311\020\232\255\271\262\354\223\365+\320\004\244\004\244\004\264\204+\300jz\267^\2466\037\276\253\250;3\240\2450-\210P!\223\365)\320\334?\320\033l\343Q\371\372\241\343\016\370\004\374b\306\317\224]\257\316\307\203j\007\222?x\200\276\300)\003\253\013\322\345 {\350\344\374"
+	.string	"\223\004\311\332\302\300\021\322\t\231\230\354\260#$k\241\234P.\216L\250d\245\021\322\3463\272$\205\342$\310a\3149\204\214h\034"
+	.string	"\023\025"
+	.string	"0pL\034\220\nuQs\r\024\200\013U\260\222|T%O\344\244T\b!\021"
+	.string	"\031"
+	.string	" "
+	.string	"\001"
+	.string	"\002\004\024@\332.\253\302\322i\340\t=2\217\331\2110\350\313\275\340\246\003\003\005\004\t\252\214x\270\222\325\025\372%H\226#\326\256\021\336\251H\371\275\315g\262I\353\025\375\204m+\030k$\215'y\311%\313q\363rA\2351\235\351\313\301(5\356;?\336\206S\002\335.X-\231\266=\270\310\0250\016i"
+	.string	"\210d>A\344S\373/,"
+	.string	"\037\3460,\204\027l^.\231\364\372\f\322\264\307\252\206q \005\030e4!{\203f0@kGCy\227\317p\346c\352\030Z\257\232\274b\301\223\323\376\234\020\t\025vl\017\356\334\346t\347\265\310]?\226\265P\356\260\242|\301\213"
+	.string	"\232Ij\204\274\247\360\351F\273\\\321\301=b\332M\333\345=ETh\3741m\330\026\341\207\021\305\016+\231q$\220\245\221z\211\223[\225Y\355\2354t\304\320\267}(\037\2339\232\343e\025\003$\210|\031\244\026,D\367<\276\323y\225F>\374Et\205H\207\340\274\256\256s\273J\330-\323?\351\2422T\225\2576\260\261:w\203\246k\327\341\nQo2\224x\333IW\375[\262\250\325v\274m\005R\276:8E\375pny\355\223\201+\277\207\003)\256\304VL"
+	.ascii	"b\262)>S\252\346\026\231\346\367\365p\223v\250\206<\264\205\021"
+	.ascii	"\343\237@dU6\262\202\237U\035np\to\264\303!\203\372\033\204p"
+	.ascii	"\201\253\362n\321\341!\r_\315\217T\214\337\f\002\346P\301=\203"
+	.ascii	"+pM\301IE\372\005.\343\230\376\253z\272\203\271\233 7\314\027"
+	.ascii	"\200Z\214\016\266Mr\214<\035KB\265YjK;\017\235\220\202\311"
+	.ascii	"\022\266\354\002\"'\302Z\373g\242=\006\320\270r\022\324\211\324"
+	.ascii	"\234\212=\234\027\330\2123d\276\361\316\377\030X;\247_\206Q\342"
+	.ascii	"\304\026\0206\235N\362b\347\322\327\247r4Z\356\333\373\341\313"
+	.ascii	"\231\324\340TXG\273\227\345\002\\\262\"Q\223(\021h\200i\016\325"
+	.ascii	"\224\2724\350\361\323\205\256\240X!F{\257\303\2605\357\003S\271"
+	.ascii	"\264]\235\223\035F$\f.\004\037\\"
+	.string	"\365\035~C\036\260\335\247c\027\310\320\021g\270\334i\263\360\212\265\264H\222W\035\240\305\305\232\310\335\n\371tg\034\202\261\263\352\250\233\315\f\342\254*0\224J\216\333=\347f+r\301\340k:5\227\237H_SR\332\0303ei\342`\276e\233\221\367\256\021\003\3654f\fn\251\277=\324o\233t\322\2126\236\304\254\t\266\272\026\271*\335/bX\340\330*\241\0016q}o\273(C\301\211\023\225\244\335|\266\314mk\013\242LuA\200\331e\332\2006\360#R3\370\036\357\341]T\210`H\tYRQ+h\037\r\313)\225\250\357\222\214 ,\245$=\241SL\0231\212`\273\204\n\260\266,\226\215K|\225\312\006\332\324\266Z\235\022\227\221ad\206z\374\321\331\2102\272\353\372\363!\361\031\f\211\232\356\003\033MG\256}\340\213\205\242,#\271\373\320\327\210\213\304Xh\252{\301\241h}'\330"
+	.string	"v\205)\277i\373\fT\027\275\324F\365\260\037\214\025BLezr\001\315A\276\341\tXm\354\354]\246\302E6\371\327\025\312\341:\311\207\027o5\356\307\tL\303/`\211W \224\036}\306\007\nsH\004=ff*\341Z3\273X\235\211\200M\3478\241\345)\311\324\342i\030"
+	.ascii	"\223\240m\371\224\331G\022\177\323\373\371\223\005\344\013\356"
+	.ascii	"$}\326\034n\377"
+	.string	"u'\221/\326\222\f\273ve3\303u\t\252e\026eHk\365_\230\220li\271\361\270\371\352\361\022\f\211\371\002\227xyu\335\264\261\306\371\027\007\366\255\366\2749\361\241\006\0033\016;\352\345~\323\2410\346+J~\344\207\276\273\3209\270\227\\\331\213y\212G\344\231.\221\020\217%\254\340zp\264\373\336\311\t\021#\333\316\232=\255\303\206\334V<\203\363\263\311\"{.h\002\2739\nQ\271X\227iA\270\346\305;\341\0214\355I\027\211\221\264\021\366\313\303\323d\021\b\343g\203@\036Cf\006 \340L\303\017\307\217~\334\002\314\333F\303\266c\257\370\230\374y\0362I\302r%t\316\303S\034\364\261\033\220\331\275\321\202\367\363\260\\I\321L\340V\325\0078:Ob5\314;\375\023V\024\266'\210\003xF@\023\022-\233x\261\246\304\2650\206%r\272\002*\264\016\330\020\003\217D\351Q\361\020\235"
+	.string	"R\3122Fe\365\374\246\325\005\277\026\222\256\005\304\353\213\335G\213\261\273%\023\314\231N\\%\303l\031<\347T?\317\f\205\030x\355X\246-P\203(<\255\210\271(I\203\371v\023\212\265\245\031T\357\367*~\360\017t\321U\211W\022\251\021\370\342j\030\rx\343|eH\250\345{.\300\253\370Dxu\237\240\245\335\275\247\222h\241\256\257\303\202^.\234\366\231\246\302.B\250\357\336p\201\236\024\224\264,\375F\367\033s\261h.\324\002\244\336\212\re#\3324F\3335H\244\341\203j'\252S\213\002\365\027\275\315E\t\377\275\301\237\211\333"
+	.ascii	"\242\256\362\312\203G\2278\201\211\201\372\017\257\237\256\270"
+	.ascii	"\270\374^!\227!\271g\255l\314\352\242DQ\370\357\371h\334\256"
+	.ascii	"r\313\342\205\366<\341Rn_\005\324\320-\217p\2312\333\315\324"
+	.ascii	"d;\251A\304~\272$$\227K\243\002A\341\210^\313\205\317\336\331"
+	.ascii	";\221\311,\333s!\363\371r\254\316\201\222-\213\025\263l\324q"
+	.ascii	"X\027 *\266\017\315P:Y\226U\267\256[\207\001*\240z\240\254\300"
+	.ascii	"bN\316\340\035m_e\033\340}N\277jXT\301\301Y\305\262y\330\340"
+	.ascii	"\335\024\260\254\313\226i\300X\364\221!\312`%\235\226\353\345"
+	.ascii	"R\235k\355\346\321\004\237\350\201\250c\tQ\326\350\037\3176\n"
+	.ascii	"\026\007\020\n\247;\350\016Ly\241E\277\n\202J6\020\317\201\350"
+	.ascii	"\236\302K\356e\240\230\211hO\222\330\037\307M\363\233\r\b\362"
+	.ascii	"1\300\300\236\214}\352\373\233\033\234\301\241\250t>\356\245"
+	.ascii	"\361\247\361s\212\223q\367`HND\274\302\031CM\365v\354\032\373"
+	.ascii	"OF$\366OF1,\274\364A\001vqX\265v#O\225\307\242u\334\311<\320"
+	.ascii	"hD+\211\016A\030`\333\307\305\366\222\231\n\255\301\300}X\375"
+	.ascii	"+\034T\304/\245[M\247\013\3647\fM\2121l\231\200\231\250aK\352"
+	.ascii	"\251\263\226\223f\021\220g\312\025\317\310\007=\313\343S\221"
+	.ascii	"{\371\017\225\310\265\3033U,%\241\217\237\022\f\257\r\237\035"
+	.ascii	"J4\202^\252\343\277\324\221\255L\277,\322\033\340?>U\222\034"
+	.ascii	"\363Th\250<W\3621W\216\372@\250\254\037\212\b3\251\333\211?A"
+	.ascii	"p\3568q\360\025\334\226\313\"z\225\303\246\233\\\025\245\201"
+	.ascii	"\004,B>\321\305\fI\331&\251\344#\370\261\242)\330\312j\205<\235"
+	.ascii	"l\237\3052u\023\r\241\271X>5\302>\262\347\342\210\263M\031U\r"
+	.ascii	"\"d~v\274E`3c\254O\n!k0\313\256)\022'$\177\027\3738\275\230\274"
+	.ascii	"h\272v*\310\335F\031\023bm\270LeHO\345\230\313|\262Q\300G\354"
+	.ascii	"Hny\275I\030B\003\252X\366KK3+\246\364\273\353\300L?\320:\340"
+	.ascii	"\027c"
+	.string	"huC\304\231\230=\0208b\245+[\211p\f\003\036\024xE\301\3774>U^\007\30213\257\200\375\204^\206\246\035\220\225\200\205\256\305\\U\214F\317r\365Q\257@Riu \260\323y;\327\366\361Ta\006!\225\341\002|\240\241\371\270\371\224\217\236\004\257\201\200\265\374\360\304\302i\032\232\250\016\363\300\255\2374\261\256\006\274\2310+\331hhC\300\342\3101!\3619\365p\216\200s\021Z!e\273oR\311A\270A\f\276\032\270\177\251dg\210\320\224\017\004\214\303\205p\303\307r\314%\221>\003b\020&j\"\027\256=\376!\007\247\323En\361\373Hk\343\323)\0211Q\"\366\273\253\243\243\321^1U\226\252\005w\273\371\r\004,\367rh\0079,\206#\347c\251\257 \"z\234n\002\302\241\365z\t\2341-u\255\235\250\275\255\273x\316\306\267\216>RAXN\r9J[QH}?\362"
+	.ascii	"\233s\020*Q\263W4\362\035\207*+\330\240h\\\360\332\3275JL\353"
+	.ascii	"z\255\300\344\024\002Yp\345dr\367\257\272\203m\027\3134\367\273"
+	.ascii	"61{.\033ct4\244#\237\334\377\365\234\320\n\203\033\204\300dO"
+	.ascii	"b\"\243\n!G\345\307<\016FZ3\331\277\353p\301ys(\002\215\f:~\274"
+	.ascii	"#,\231\303:w\320\315)\271m^\365\\\243\247\005>\346 \304\235\006"
+	.ascii	"\375u\372\200I\033^\3210x~h\346o\334;x:\275\247\247H\037a\332"
+	.ascii	"\337\t\225m\207\306f\265\032\007Q\246CV\357\215\206>\273}n\375"
+	.ascii	"\222\270\222\375\220\0068\317\324t\3776\270\214j\301\367\027"
+	.ascii	"<\212\362\252\372\257\267\002N/\324\335\215\177\267/\253\034"
+	.ascii	"\351xiA\326C8\354\233F\242)\311\346\263S\221\302pI\337\024\243"
+	.ascii	"G\2412\036?\f\214\327V\2539\262\"\307\336\274>:g\327\b\025E%"
+	.ascii	"\260\315\036B\314\026\r4e"
+	.string	"]p\330\n$\377\331\277\3131\213\250R\353\217\3706(\035a7\35459A\026\271\334\036\232CS\373\305\347\271k\366\002\364;r\347\0236\303\247Q\325Nyo?\001$\234\023&\207\235\35018Oa\303\320D5\270\262\372K\017\206N\350\031\227\27131\002\314T\340\347\203\007\333\320\024OxB\037q\247j\320@\312\213\237s\"\0070\231,{+\t\370V~/\001\253+/lc]\263\035\310g\377\302\340\3703\363\001\204\222\235\227\256 =\347\223\347\027\246\337sXg\354)Y\026b\312\337\356R\253m[>]A+8\202\361\352\312\310\016)\177\304\211P#\\\351\031\006\340%\371Pj\001\303\316\377x\210KE\330P\351fd9\2546/\347\226+8,"
+	.string	"E\026\017voe\037\303\354m\337\256\251\271;\323\317\326\320\221T\304\f\202}\377\334\252I\353\177\025@o\221~\357\305\207\333\022\224\007\370\305\\&\035\245\304\371Cw"
+	.string	"\373\330*\226\021Q\266\374F\214\252w>\bn%\30625\330\244\340\275\324\362|\021\344\262|\"q}5\300\0365\027\374\376C\2446\227r\251+a.1\021\300\342\217\314\241\303\331\021\020\252\334\303\3365\335%@(\027\315]\312\0270\331\341\"\326\024/\276%,\335J\337\2500xV3\210\375\347\345\274*1\005\257\317\210\363\207\275\bn\306p\003\267\302\2359#P\017\024p\201\005)\232a\360j\257s\202\3623?\371\324\305\374p\205\333Q\273\376W\315\203}\211\277\036\364\360u\303\2310\366oM\360\370\030p\274\371\377\330Qv\350\272\305/\327\007\035\277\203q\345\333\344<\243\351\r\327\223\313\034\233)\f1vv\2403\025\227<@\262\205\365\251\232\301\270\373\377\316\304\362\321\234"
+	.string	"\251\267\342 \310NP\3656\352\233\207^\337\307U\310\\cq\0037|,\0166\201\377\240\271\001TA\020\375Z\224\314\222\035`'f\323\017\242\325\037a>xj\013\353jVJ\224\025\023\264\265!\2261BR\366\242+1\373\342\260\342\234J\222\2729Nj\325\0312\017\251\223*;\330b\367?q\311\375K\367xF6\301\347\236}\\\036Y\237\035\rz\224\371X\341E\026\254S\323J\221)C\334\357\367\321U+\247\217\353J\271\371\3730P\315\261\364a\224%D\f\307\324\364\275\317\315Z\251]\235aj\211\242p\026\212\233z\262g0\036k\313\252xt\002pH\372\324\353\213c\333oZ\267<9\246"
+	.ascii	"nI<\226\267\243\315s\332>\363\312\033\214#\t^0c\226\021\353."
+	.ascii	"\\\217m\275\245\256\361X\251\360\235\027\017\217\202\351\362"
+	.ascii	"\332\377\n\333\3376\200\252N\371|\200\335\251bsd\225\334\226"
+	.ascii	"!#T\025\211\2702\264+\021\227"
+	.string	"\216\"\027\215\001}\360\342#\0207`\235\234\243\355\274\b\225\346<\3523IP\271\242\375\307\300\230kRc\375\305\007\367\214\374\202\212S\275\321\236\246\251*\252\n\300bf\323t:MGL\304\231%/\256I\345\336G\327\335\217\255c*\212\334\\\n4\233\211+\335\323l2X\360\"\"Q\016\034O\357h\342e\017\325\371\004R\267T\322\333\372y\231sI\030)\253\301R\002\232\246\317]\021\374\376\373\264y\323D\331\204\336I\373`\251\006B\304d\220\201r\207\f+\305\030\307N\270v\361\210|y\211\007\355\254]SG\031\317\306\350\211\023{\303\3326\331Q\334\243o\222#o\337\376'\r\013\035\312\262\276\373\316)\340\345\266&\362\2155\0234\301\226p\326{VrLMq)\330\360\341+\311\037\023/\3306\003y\bR\023Cu\204 \203\372\370\027\215\254u\250\225\001\302\0032y\005T\266\232\027YG1"
+	.string	"\257\350\371l\363o\003Yc\230\272\227\031\202\003\034\017\331|\313\345\323<\211|\347#h\016\214p\306e\n\025\300\005\317\36164X\b\252\221\207\035\331x\2636>\260\312\341\364R\017\242\202\271d\265_Q("
+	.ascii	"@;\030>\0338\036w\235\311\325x\242Zs\321\363\t\324\016\374\236"
+	.ascii	"[\360\262\271V?\233\357\231av\300\311\316q\001\234M\366\034\321"
+	.ascii	"-\2177hv\371\214v\365\344L\003\373\034\267>G\336\214\343\235"
+	.ascii	"\333\367P\372\035\314(\311t\252\330\017\263\324\274\316\324\301"
+	.ascii	"x\023:d-\001\2270\225\315\355\3759\205h\304\252\304\267/\351"
+	.ascii	"\276@\242\333{\271U\244ul1,\270\337\203\252u;`\324K\356\354\343"
+	.ascii	"\316\211\224$\357Z\225\216\177\016\022m\347\260\003\360P\"i\243"
+	.ascii	"\335\024c\231\215\002\322Ij\235\343\210\303\200\205\026a\324"
+	.ascii	"j\214S\253\326*\227ii\315\331\371PK\236\023\361\267\242b\342"
+	.ascii	"\022\337\216LJ\t\230\222\243<\263\265\337:\213\025e\265\226\326"
+	.ascii	"\354Hd\0342\367B\265\3302\263\323\245\373\250\372\024o\364\354"
+	.ascii	"\371\"\233\221*\017\347iev\223\327\223o\004oG\365\302\307\201"
+	.ascii	"\025\331\023@J{\224\350t\335\375\275\244\273\221\265\216*lN\325"
+	.ascii	"\034&\300\0353v\013w=\242:\303Q?\310\235\321)\022G\267o$\036"
+	.ascii	"K\336\312\270\321\036O\253>\020\306\204\024\376\370t'\034Y\177"
+	.ascii	"}\237\262\341F6?Df\276(\004\271\363\005\255n\322\364F\363(5\213"
+	.ascii	"n\371\212\263\322\275\342B\320\266\253\367\261\nw\367\005\353"
+	.ascii	"\346\266\354W\336t\340w7\204-\036\204\336\226\242\302>\300\024"
+	.ascii	"\317\t\304\231\331A2"
+	.string	"\027@\315z\243 \342\236\002\035\274\221\306\270\004+\217(~>\006\245\353b\354\323\263%T0\341\210\227,\315A\356\307\370\025e\341\302>\326\242\206\261\2106\237\264\254\004\265\326\\\275\334\320\210\212\035(\254L8kQ\351\305T\250!\370\377\223\345\362\235\241<\r\272\326+t\363\311\267\204\024\360\231Q.r\230\2643|\323\345\322h\376=\236\315(6\265\210:I\251-\305\327O\246\n|\236\353\267\354\rS\241\363\333\231J\221i(ar\351\241\032z<\347\271\210\236\n\3576.\206\343\375\270A\332\377\310?sR]\361\270\317\357\303\360\022}\254L\211Q\021\261n\331P\353\300-+\372L:.\313<\242\003E\312JzS\261\264\343\305\211\224e\357E\342\032\177\205\201\037\277c|]\342p\266\022\337\263\3043p\314^~\374\316\221\353\272\351\327y\f\344\340o\347\030\305h=t\242A\\u\021r\313\244\016"
+	.string	"Q\214\rL\200\351\253@\325,:bZKxD\tn3C\315:uk\313\366o\252oB&\372~f\023\360_cJ\265\025Q\235\275\255\352\276\217\r]F$]\252\035\345\345\323\330\345yi\266\023\370\004\356\353F7D\243\263\372\003\330\007\202h\256\237\326!a\006\2432!\322j\230yB\251\177N\210e"
+	.string	"\325\250\366~\201\201n\316\236C\235W\262\232U4\350\022\2507\312^\027\255\177\301\343\022V\261>\316\201\271A\353\005J)I\344#\030\302?DA\321^\254l5\270X hl\304~x\373\266\314w\333G's\303\315\225\270\342\200\213\232C<\023GA!ap\001\224,\236\253\220\247\237i\006\2526w\320\301\351\036\337i\331|\201\323\301\026C*\267JY\t\035\356\330\251R%\200\366"
+	.ascii	"G\356\351er\201; \217\340\336\262\2239\361\302\3715\335_K\030"
+	.ascii	"\232Y\264\3572\370I\212\342wr\3458\361`\377\206&\022\232WJ\037"
+	.ascii	"c\235[\336\020m{\273\350\254\351@\366\017\\ap\344\347\233\261"
+	.ascii	"4r"
+	.string	"\204p\313\342\224\0056\203\365:\217\357\245Tq\333\220\226\272\355\251P \342\026#0\233\301\302\277\035ss\037D\361\231\235\377\272\207\035\322\217;\207*\302R\200\254\301\310\205s\362\330\n\374\346*\n\204\\\303\2272S\3219n|]\020\246\357\210\377\210\331\225\304\212\315I\350k\007V\034\242u\363\237\346\364\277\272\037MR0\027H\230\353\250\232[\0337\t7\224\325\204\215\241B\2239\234xi\307J.\351\\S\261\340(\324\202\201.\2714<\340"
+	.string	"]\345\233\021\266`8\362~\354IM$\375T0\364g\224\371&\022\307\273\254?3\312\241\373\377\201g.\262oQ\325\212\r\r-\232+\306\331.\240w\326\264\006\020\237\357\027HXs\230\377\025J\312\224\271\231\223\233\317\030m\354\005y\024\352\026\346\317\330\357\320\222#c\376\206\222f\007\372\311d\306\367\334\315\316K\365\253\244,\177o\031\023\364\200\215\023\222\222"
+	.string	"\\\022N7| l\2117\030\302\241\376\351\314\220\337\232\fq?\236\"l\224\260\372\221\257\224\331\022\031\2012|\272\036\266(\377\004\374\020\371-Jp\234\013\350+t\020\300\377@\361\026\3160Gs\233\"/e\031\342\373YN\366w\201DY^I\302tF\036Yv0\004\371\250\001H\317G@\3078\246N\3453\311:H"
+	.ascii	"\004\022+\363\200\021\210a\177\036\333\333\267\262\303\303\207"
+	.ascii	"w[1Kq\025HO\3227\207A\226\341e\221\033"
+	.string	"a\350\252%\204X^\271\254\223\314\367\360zlX1'\\/\271F\024>\020y\354\3642\260\035\027\267\271\203X2\262\032\371s.U\223\371{\004\353\316\204,1=\233\264\032K\262>\002\2508\224\325\270@\t\374\303I\354\261\366{\"\244\335\220\205l\302\031\256R\240m&\212]\212\2564\322\315\023Ob+\207\322\310w2X\240\3736\203\256\313\020\275\031OC\306\2409\036\006\355\003e@\265=\272\237\031\307\347\375\230\217\230\317\355\344\323\273\200`\354\227\251\362\"\211\017\337\2655\276\371\355\331K1X\366\372\333\371\201\034\320\212\3621\346w\306f\220p\216Z\230\236\242\241\377\215?\223\342\250\314M\351d\227@\335\222\357%\006\224C4\332<Z\331<X\337s\246oi\225\270\271[\236\331\301\356\230\f:^H\262\270?_\346\357\003\257@\205\235\006\212{\257]G\006\316uW\216r\267\256\030\027/\205X\201"
+	.string	"`\005\"\022\211\373\346\362\244J^\233&\215\254\032$<&k\021S\204Bz\034\212_\323NVm\025\017x\362\236\230\002j\025pJ\024^K{\223Q\343T\007&\215au\313\024\001V\212\n\210\361c\3164@\3573(\340e7\224\\B\017\006p!G\217W\026\376\274+\264m\213aL2\355\334\n\206s\277\350\0243\266s\021\355\216\201\343jN{\210Z\365\220U\322\356\330\335\213\276\352V\351\242z\234R\352\212\023a\341\030\306\332\253|)I\367\324\371\"5[\263\356-Q\267\033\240T\312\202\026Z\236\250\322Ic/&\325\225zH\360\216MB\355\007\323t\302\032\226\342\243)\232c\252`\217\264\256\026\322{\036\0316\366\200^\203\205\244\370\022\254\343\354\263T\250\314C\323\370#\213a\370\177+t\360\025\213\b\214v\314"
+	.string	"\266\211\260\t\250\312\362\315\340)\247\n>\360\255l\325H\240\220\004\202\210\204\243\257\260\365\226\013\356\001\376?\016\240>q\213Tv\212\256Y\362\24498P\264\354\321p\212\275\tIa?6\337Gj[p\251\234\303\265\335\315\221\312\033\220Q\r\341I\300}[\236\275\362%\212\251\277\f\240N\213!\3070\275\025$\300\f01\255\254\031o\273"
+	.string	"q\221\315\206\355E\223\265\310`\t1 6\265S\n\006vT\265\234;\230d;A\034%\310\037(5\303q\222\270m\004\3772=\234X;\361Hk\271\275\350\265\313\350\2303\351\007\260\351\fq\342\264e(\205\224\271\021$\033\032\301l\n\255\340?\315\223D6\327\024\205e\332\247\321\037>\027\274\251\334z\314.3v~-\374\b\310wq\330\2338Uj\345\321\364\274a\312\337\335\330+}\3578\005U\276g\360\317G\305DE\202\232%:\366\265\2258\326\341~:\276}\354\227\337pt\256\341\256\263\274T\257\216\2023+\243`\275\346\300\272\231Z\214\271f\251\234SHs.R?\252"
+	.string	"\337g9\016\231/\212\312\b\307,c\210\016F\270\315C={\254\022y!\224\373\311|Y\350!l\267\207c\360@L\304r\321\234@|@\263\230h\2518\260\310\304\240\020#\3358\344\226(\026\005+\231]\016\366Y\240\324\031\004\327\233\237\001\313\212l\321\022P\2306\004w\255\0359{?h\027\363\344.Bn^\302\324\030V\334\234\f\333\030$g\371\310\352iO\317\364\\\250L\234\345\360\020\217tb\371\330\222\036\265\235\332\213\2550\205\300\210~y\363\222 \233&e\355>3sa\003:w\326\321|\302\342u\257T\341\031\034\002\321 s`o-\024\352\026e=\234\330^Y\260"
+	.ascii	"J\017\225l\210\337]\225\306Z\325*&\022|Zs\346\0276\004\352R\245"
+	.ascii	"\207\324\374\f\366\344\247\305@2\370}\234\334\273\344\025\302"
+	.ascii	"I\303$_Ii\205G(d\331\325Y\367`\324\250r\365Zc\r5\254S\353\310"
+	.ascii	"'W\345\243F\362\320\310\272\367Hw2\343\275V\234\345\332A}\370"
+	.ascii	"\363]N=M\231\031\n-L\321\243\236t\001\207\341\372O\242\260,\337"
+	.ascii	"p\266\371\376d\324\304I\177\243`\221\316\213\277\237\237\\"
+	.string	"a\231!\026\001\327\264\024\305b:v\242\314\"\241t\314\376Q\370\364\233\211o\270\255+\270\247\337\234\313\312\225\030\242b\025\370c\201\357h\361\324O\363\022\023g<)\206\021M\037B\352\37591\302\263\017\272\201\216eY\345\364D\244\256Q#\r\323\330\304:\271\375\270V\027<K\361]<\340{\016L\276P\343'\fE\371\024\304\033X\313\001\241\244\304\240F\2656\225\351\017\277\345\310\037\177e\263\202\301\222\366\205\326\255\344\350\276%6\177zD\tq\006\022\213\022\320\242\024\305#\361/\342\005[\006\"B\031\017U\031t=>\217\020\305\217\2148\222\347\016\347\234\347}\373\026\003'4\246\207\016b:f\335\225Bll\n\320~\233V\344n\360\001\227\013P\267\004\334\272^mG\304'm\t\266\346\003y\037\357\365s\233(V\013\273fk\337&\016\367s\003\213\247\303\016\232\2069\346>\216\342?\335m\350a"
+	.ascii	"\277\360\200\252\007\301\242\207\301\f\226\\\373fT`<\270D\200"
+	.ascii	"P\327\313\037x\316\363<\303 \233x)\233#\370,\315S\232\236(2\001"
+	.ascii	"\251U]\rL\322\021T\344\202\3418\225J*/\f\351\246{0\031e\303\360"
+	.ascii	"Y5g\202\231\264\210\364@\017\300U\033\363\032\222\241\232.\212"
+	.ascii	"\357\305-kl-\323\354\f\240\361\302v\252\231\004\3248V(ihT\023"
+	.ascii	"\360\023]H\fA\200Q\240z\\\254\326-\205\310\337:\374\310\256\024"
+	.ascii	"\332c\004K\026\246$Y]\250\323\315}%\257\241\207\301\002\252\310"
+	.ascii	"\213\252\326O8Ak\356E\023\224\002=\351.\004\272Q\304\271\263"
+	.ascii	"Ri9\023\371 +&\324\306\224pa\216@igL\371@\331a\262\375\370B\273"
+	.ascii	"`\242\246\016GqXDnx\373n\3508\n\322*9\0300rhs\203'E33\027\034"
+	.ascii	"kg\347\363\231\300\1778\b\304"
+	.ascii	"\303\325\315\022j<\027\024\374\341\024\222\t\344\214\0249h\237"
+	.ascii	"`*\333\261\253\023z\323\321\276\nb\217\364\215kI\035\272!\220"
+	.ascii	"\211gT\"J\304\354\365\321l\232q\311\"PE+\031\273^\037\217\236"
+	.ascii	"DC\351\2136\222$\232\215\033>\311?\330\215\373N\250\344\320\257"
+	.ascii	"\f\275\207\177\257\304\375,\211\367Ln\020\313%\233\220\200*\261"
+	.ascii	"\205U\362)L\331P3tl9\362\313\036G\357p\034\n\306x\235\231\206"
+	.ascii	"(\302\313G\033P\226\244\347\223\210KA\2402\233\207\210\023\363"
+	.ascii	"\022&L|\375\340Z\353\231\350gw\377\262\252\305\315O\206\345\202"
+	.ascii	"\3418\234OH\013\260H\313"
+	.string	"h>\r.K\366\224Lbds\303\360X!\306X\002\375K\f`B#\342c\250H2\213r(Y\324B\267\302\031\357],\327\"\302\220\236\021\202]\024rg\250\363T\346\271F\271\005\025\262\270<\214\2214jZ\216\265\325\2616\351R]Nn\t\275Tc,\320\305\207\206\356\251\277\274\305\271\363Bia\2538\377W\020!\023\370\254?l0\236\024\0346 c\225\374\355\312Q\327\342\314(I\321\341\374\200\314\227\f\340\330x&\003`C>\177$\221\247\360\370~\313\311\343\315Z\213\343\245!\001\306\341)\007\255\377%g\254>\1771tG\222<\220\236\222\025DN\240\233\262\347\235H\232\f\206=\230=\037y8\372\206J\032\366\001Q\205\203\236\277cb\332\244F1=|\017\266\347\n\214j\007(\262C\300\003;n/\230@J|a\021\260\303\210\200\377\203\2049/t\206\332u-e\276\220b/\357\247"
+	.string	"ZD\272v<\366\307\216i\223\304\030\025\227\227\333V\271J\"7\3719\304x]\326\007\b\200\343\245?\027\227\020\270?\204\265*w\373\356\0332L/\334,\002 \212\327/\354\024\305e\307O1\016\203\217\304\321\240\364\274\355\2002\324\260 \217n\231\356\335\264\275\275\356\004\177gs%m\026\210\021"
+	.ascii	"\267E\345\366\335\301\336bG\207U\016g\241\267\3117\347\337I\033"
+	.ascii	">\022s)\331\237\241\370\227\250U\023\3216K(\013\267Oxt}\323\263"
+	.ascii	"jT\006\313@\206\345^i\001N3FY>\276\366\306\306\003\271\352\331"
+	.ascii	"!\0272\266nOI\272\212A\226\262\253\320\303\203C\244)\260\035"
+	.ascii	"1\351#6\345z>6L3E\336\031\247\313\277\217\346\355\216-!w\337"
+	.ascii	"\227p;\310\232\375\351\316@\022\233\265\204\205\267L\025\316"
+	.ascii	"$2\217\225\243\354m\332\347\202\016>T\035\357\356W\2045\262\343"
+	.ascii	"\032\260\216\245\f\361\324\205\353\234+:\244\241\r=\371\021\f"
+	.ascii	"\331\341\334\325\025\331\353J\334\267\261\215h\274\306\322\334"
+	.ascii	"\370\247/\275.NF\254\224\243\344 N\\\237A\213\315\307>\360-\355"
+	.ascii	"\036\266\303\232W\276\343\023b\223\n\372\237\357\206\226\373"
+	.ascii	"l\212\362I$w\001'\271\227\265'\330\372\363\311U'\263g|Cms\264"
+	.ascii	"\254_\rk?\324\356s\357\016\016\177t\337X\237\350\356\345\370"
+	.ascii	"w\206\352I\331?Lxly2\216s\034\274c\3100J\377F\267\030\271\356"
+	.ascii	"\371\253\301\234\n{\376\367C%\335\201\252\217\321\001\027\230"
+	.ascii	"\177\243\237\357]\307x\336\210\257\331\353\362\30036\244\341"
+	.ascii	"_(\272~\344\223\352\313\37288s\b\373=>\333Uu\347bn\253\302u\214"
+	.ascii	",/'o\271\231.\364\207G\310\334i \337\026\242K\374|\035~\206\302"
+	.ascii	"I\017\221s\317\317\035VzD)\234\217\277\016,\305\330\316\3776"
+	.ascii	"\366\204c\343\325\006\204\357k\360\261\307\317&\177~{\350\372"
+	.ascii	"\230Q\371\2311d\352r6\207>L.\315\345\342\1771\037s\344Sy\335"
+	.ascii	"T\331?\t\350\016\222\265\232y1\317i\324.\0328]\231K\332Y1\224"
+	.ascii	"\033Y\215\030\3467\353|\r\330\347\031#\373\225\337\360\371\364"
+	.ascii	"!\362\233\n\232{\032\231k\303\366\364\272\356>}\035\027\323\345"
+	.ascii	"\276^\023h\032>\016\021\311\330,0U\276i\240\342&8\373\257\313"
+	.ascii	"\355\205}\277t\3752>\247PN\324\302\301\215\372S\254b\rs\013\316"
+	.ascii	"Y\264\r\023\315\331s\223|k0?\200nS\312!)\332\323\356\314I8\375"
+	.ascii	"N\276o\315\262qv\210\317\2760\235\247\353\356\275\374\361tsl"
+	.ascii	"\264\317=\037N\335'\306\317&s\232\273I\356A7\231\336e\375\367"
+	.ascii	"\363\217m\025\274\352\252\306wW\210\341x\3131\021\273\332p\305"
+	.ascii	"N\377"
+	.text
+	.section	.gnu.lto_.symtab.a6f2ee45e073ce3c,"e",@progbits
+	.string	"systemConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\006"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\006"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\006"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\006"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\006"
+	.string	""
+	.string	"resetConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\006"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\006"
+	.string	""
+	.string	"writeUnmodifiedConfigToEEPROM"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\006"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\006"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\006"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\006"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\006"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\006"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\006"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\006"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\006"
+	.string	""
+	.string	"isSystemConfigured"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\006"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\006"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\006"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\006"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\006"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\006"
+	.string	""
+	.string	"pgResetTemplate_pilotConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\006"
+	.string	""
+	.string	"pilotConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\006"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\005"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\006"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\005"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\006"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\006"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\006"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\006"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\006"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\006"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\006"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\006"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\005"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\005"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\006"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\006"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\006"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\006"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\006"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\006"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\006"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\006"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\006"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\006"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\006"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\007"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\007"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\007"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\007"
+	.string	""
+	.string	"featureDisableImmediate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\007"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\007"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\007"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\007"
+	.string	""
+	.string	"mixerModeIsFixedWing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\007"
+	.string	""
+	.string	"featureIsConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\007"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\007"
+	.string	""
+	.string	"featureEnableImmediate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\007"
+	.string	""
+	.string	"buildAlignmentFromStandardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\007"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\007"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\007"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\007"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\007"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\007"
+	.string	""
+	.string	"featureInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\007"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\007"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\007"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\007"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\007"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\007"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\007"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\007"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a6f2ee45e073ce3c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,742 @@
+	.file	"config_eeprom.c"
+	.section	.gnu.lto_.profile.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375 \307\235\004"
+	.string	"\222\007\034&\220+\303\0015\373(\250\245\030\232\200\207_\001a\\\251\354D\330\277\332\335\335\335\335b\234I#\233\354\275\367\336i\313\255D\260t\016"
+	.string	"v\035dT\206KTg\025\252\317\354\375h\342\240T\2409Hh\024\262rN\225\305\211\320\355\245\306\303s\301B\314\346B\274\270\333-\227\367\036\337\303\366\334\355\300[P\231\310\354\366\235\335e\244$\202\251\263\220\r"
+	.ascii	"\320\230\370?\006\346p \027;\316\234\372\363\004h\263s\267\242"
+	.ascii	"\331\347X\273SV\332\202\001\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375 hm\002"
+	.string	"\204\003\\"
+	.string	"\t"
+	.string	"\002\001\002\n\002"
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"\004\003\002"
+	.string	"\003"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001\005"
+	.string	"\001\006"
+	.string	"\003\007\t"
+	.string	"\003\n"
+	.string	"\003\013"
+	.string	"\003"
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"H\005\236\352\016\327\200Q\002\332u\242\323\252\r`\001"
+	.text
+	.section	.gnu.lto_.inline.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375`\200\001\335\t"
+	.string	"b\315/50\217\222\016\2131\007\246\332\362r\341o\360\320\255\227\003\354~pz\225\306\246a!h\022\"\365\240\016UR\021CA\201\222\222I\265\327\335\021\372\227\344\223-w\n\377Hr\337\220\034#2%\002\022\n\027\323\300\035\254\200\033\257V\270\027\365\002\325R}\036\232:\231\t)\370\342,\264\331\336\374X\206\016=ul\254\016D-a\221Z\020\006"
+	.string	"e\250\"N\342\2757\361\271\346\021\313\306=\r\307\262\374\0034\357i\327w\3627\261\240R\024\372\bQ\225\026\b\306\254\204\266\031\022\346\305$&o\273\241\2562VP\360^P\337{\317\375\250\247\222\206\312\240}\316)\216\343\250\036\037)\213\317onD5 `\002!F\265\007I\201i"
+	.string	"Y2"
+	.string	"\367p\206a\t\034(b~\252\020\244\300d\272H\354i\035\345\344\025"
+	.string	"\321\b\346\t\223\266\034\277\321\205\303l\3716\334ZX\277"
+	.string	"F\203\340\034 \372.\234\330(\254\275\277\321\216"
+	.string	"\314\037c1\242\335\211\210>O:\306e\301M`<"
+	.ascii	"@\001\261\301b\002\272\021\r\307-\214\210\273\332\200^8!#\331"
+	.ascii	"\356>\035^\261\335\205s\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375`>\003\005\n"
+	.string	"BL#'\220)\031\016\273\377\270\324\201\222\264\352\246\357\356\212`k\261\"]\211\335\225S)ew,<D\373%_\022\262e\222\001\3336E9\241\344&\260\275P&\327\301\374\n\206\323ial\001\333\202\200Hb\026U\001\024:\016\035'\375(\372 \344\310\302p\2071\234\250j\023e\237\202\3360\3746\342#7\352\246\273)o\324\033\364\r\3607\344\304\241\252G\256P6t\210\1778\355\350;\312\367`\362\354\344y\343F\006\0239\346\271\305\022\204M\250\241\301Ar\232Ba\3303\200\"!:\353\001\022"
+	.string	"3-\001F\004\021\024\"\201\231\200hf\002\363\273\325\267$\371\277\3726\261R\372\236\r\364q\025\002\201Uf\366\314:\b\311\nk"
+	.ascii	"\271\205\334\206\224\203\256-\200\230\300\330]\337I5\260\256"
+	.ascii	"uc\202\255\027\343O\f\241\316\0041\336\230\241\214\260n\336\275"
+	.ascii	"\207\262CV\361=\f\220\255\036<i\231B\320M\023G\003\262\274\220"
+	.ascii	"T\006\274\215%\264\345$\236\355x\262\226\302\370*\237\034\346"
+	.ascii	"\375\257\224\350\200\3306~D\334\016\267\006Rj\353\331m\002\021"
+	.ascii	"\037~A\0207\321a\207\350\350[_\351\223\f"
+	.text
+	.section	.gnu.lto_.pureconst.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\265\004\002\231\004\005\200\004\006\205\004\007\271\004\t\204"
+	.ascii	"\004\n\200\004\013\231\004\f\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375 \237\365\002"
+	.string	"BE\016\027\260'\303\030\fsH\222$I\222\305\232\335\333\302\3666k1\2212\005?\341L\203/\330*L\365l\021S`\035VeeX\321\230\214Y\265L\215\325\331N\016\300\261d\"\016"
+	.ascii	"\020D\020f\240\004d&\233\235\021\250\214\304\030\036\330\006"
+	.ascii	"\2313Pb\270\031\353T\200r^\267\001,"
+	.text
+	.section	.gnu.lto_.lto.2e390bef5311a16e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initEEPROM.14.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375 \311U\005"
+	.string	"r\311#-pU\323\001"
+	.string	"\215\337\f\257\357\rt\300\367\205[\374\0249FL\240\346+\262\2467\001\215\224\020"
+	.string	"8\004\020v2\021\200 D\026\355\235R\246\246\213\326\254\252\026\016\253\201Qjb\026\343\232T\205\314\311`\232UuF(\255S\372\366\322+H\344\304\376\266(1\366\003+=;\376\002\206\242\304h\267\022"
+	.string	"\260\240\340\263\261}\311\232\035\372\247\331{@\224N\270\273Sf\256=j\3769'p\335\3668P\354\256#\327Yny\333\007\333\b\333\217\t"
+	.ascii	"\252\244\233iq\316\214\001_\356\032\356\026\302x\031\002\\\272"
+	.ascii	"E;\237"
+	.text
+	.section	.gnu.lto_isEEPROMVersionValid.15.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\375\t"
+	.string	"\306\022E< \345*\035\3408\b6\200\005\"\253\304\211=\240!\374\311\202\351 Vh7B\233dM\007p\263\330\324$\232\026L\241\336#!\001\232\313\310P\311Q\001\221@\300\346jD\b\221;\2452"
+	.string	"2"
+	.string	"4"
+	.string	"\257\n\224r\227\374\264\343\3429\235\242o:\247\266\026\216\227\224\361\342*0\246\270\201\335}\354s5\242\346\314pv\327S5Z\334\335m+\330.\260]\006\277\013\246\221!;\315\233M\232\246\272\354s\273\273\326\226\355\3519\247\317\035c\243\214Y\240\355\262n\001\326\245S\021\261]\262568(Y<\371b\335#\346\234\024\305\251k\356\256IA>\362\256\016'0\251\t\3006x\223Q\300n\n\301/\271\214\2446\226\362\343\235%&2\260\225\221\335\323U\357|\n\357\335\365\261\356l@`(\362x\030 >\017!\260\363\205>\r\240\257\023\222\276\r\201A\221'\374\"@0\3744\344\236[m\331\253\221\314h\363\027\275\307\236P\013\231\321\324\027\275\251+\r\017"
+	.ascii	"\252\322Ea:8\314A\314\0267v\204\321\305\306\002\031l_hf\225\272"
+	.ascii	"P\267\301\362\270\346\250\322\201TC\233P\312"
+	.text
+	.section	.gnu.lto_isEEPROMStructureValid.16.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375`\303\004\225\037"
+	.string	"&y\310I\200\030R:\2450\324\361-\305\357f\253\251\203\373\257\347\033jFD\237\006\343\237\254[\025|nx\345+rxC\251M\0259\265+\335\372\275\332\357u\033m\027o\036\360|N\214\025z\344\245\335\376\024\325\366\244\221M\344N2\266"
+	.string	"\254"
+	.string	"\265"
+	.string	"7\362\224u|\344\217\034}k\205y\243\220\027\252C\023\265\006\350-#\321c=\353\350ZF>%\344}\212\340\344\f+\301-/@oy\027p\336\326\0038o\231A\203#F:\022\207\323sd\021\221\250\335\213\374\365\r\266\025\3519\034z;\255\331\025\211\237\364\\\0060$\326\232\r\250\251\343\236\236@\027\263!\031\223\0370\216ry\212\272\355\214D\235qXOS\002\225\030NO\276\27602\231\325j9\346\351\007"
+	.string	"y\222\2526g\204q\363JSoS\200\023\217\246\235q\311Dp&\305\314\323\327\242qX\353m\302\275\227k\223\021\352\254;3#\231\031\210\331<\022 D\3247\345\364\220\324\331\332\031S'\001\311"
+	.ascii	"\323a\366\221o$2\205E\367Q\353\300\363M\"\005\263T\3170\363\210"
+	.ascii	"+\001\242\367.\001\361\223\234K\250\321\274\f\331q\313&\202\267"
+	.ascii	"\2531\265{\225\336t\313?q\336\276iT\341\230\221\245\245T\333"
+	.ascii	"\230\221I\265\217\314?\225\224\r\027\334T\314\\\371\307\347\323"
+	.ascii	"\303\263\243\223\303\225{8<[\371\006Wy\207V\266A+\327\234\225"
+	.ascii	"u\266r\016\255\214\273UF\257u>\273\262=+\233\337:\267\255\\\315"
+	.ascii	"\312'\360 Ojc,\244\335\353\324\306v\265\330\256\036\327\372\267"
+	.ascii	"^\231\317\374$\037q\215k\235\366\3414\256OL\243\204v\243\245"
+	.ascii	"-)\253\362B\373\310\266\347\206U*\266T\317t\330T\022371\013\005"
+	.ascii	"\312\256\034\313\005\003e\367^\007\267a\365\336s\330yk[\230\216"
+	.ascii	"\231\315k\333G\303t5\254m\\\333l\213\206\226\222q\245i\263\032"
+	.ascii	">\326\316>\362\223\017Z\212!*Q\235\003J\"\227\231\3238]|\362"
+	.ascii	"\024\226kD%\272\323O\3373\237\374W\360V\245\305\312\275\330\354"
+	.ascii	"\274\345uQ\303Y[\230.1|\212\206\256\020\033\320s8ok[U\241\231"
+	.ascii	"\367\336k\003\324z\017'_\031\204pd\233\201\305\177r(\037\270"
+	.ascii	"\006\317\333nk;W9\231\003E\007\n\201\315@\005CD\302\""
+	.string	"!!\021&\202%P\020\001\177(\202#\206~@a\212\237\202\037&*\022\022\376T\020\021\t\177:\276o*\316\025\243\210J\334O?}\320\262\t\227\262\371Hg\217{]{\230\2638}v\221M\313\353\356\"\363\003\247\033\235>\375\323\031\300\270\210]7\315_\036\214\021\177\007\007U\250\025\232\310\354\372\246k\031b\232\223\005}\312\276\370z\327*\276\3040\t9\200\263\333\327\273\257\261\236\266\361\341i\233\006\372\362z\221w\367\364N\231\306t5|\224w\327\360\234]\243\fC\354eQ\266\300\351\232\327;}\261\\\353\266\344\332&\331\326\002T\264y\001\\\250Q<\002\215R\310\021\tdDF\322f8\200\002\221\251\262z\021`EEU[h3\013\203\260@\033\307\240\021\312n\023\356\245\237\334\311\030r\277w\222\bd\216\213}\253\352\2638h\271Vw\027!X:`L\363\007\034\021\367\351\2368\301$w"
+	.ascii	"_\250\313\032\n2G\221\234\206\017Q\204Y\316\246\236\213a\002"
+	.ascii	"\270\031;\360\353X\270\017\327t\364\362\253\242\244\035~}\tr"
+	.ascii	"\210!h\240\361R\0307\305\nY\243\2223\"\303`_!\020\321\307\251"
+	.ascii	"\340\266\304\350^G\f\340WY|zkgP\270\2440\330\032\003^\204\266"
+	.ascii	"\276\270Z+\243\367BNj]mT\336\263^\231(9k\252C\256\246\300E\320"
+	.ascii	"L\353C\247''\177E\036\241\006"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.17.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"\342L/3Po\322\001 \233\236\265"
+	.string	"\246.\235\1776\177\003\006?:\375\206jV4k\215\263\350N[n\375\004\002\317\314t\246'Z!\f\n\236\355\311v[)S\n\2362\033\367:\024\305\360\240q\340\270\251q4\r\2336=\210\2269\260\353P\257E8\367\032&\356u\224j\020\322\t\373#\217\320\367\260\204'_}\371\036\366\225\032\200\021\312\222\035A\251\033\366/\253#\333\351\324\002R\312\202\312nE\251eQ\226\311\207\355\217\215\361CN\372\030f\354\260`%\032\024$,\273\261\t\234\200}\345\007\330\227r\034>\241\177\221_@NV*\021\350\t\240\260\273\316Jtq\353m#\330N\260\235\021\t"
+	.ascii	"\252\244\223iq\326\0311C(\256\211\267\0218\013\221\207\273bj"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_getEEPROMStorageSize.18.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375 \335\r\006"
+	.string	"B\013*/p-L\007\240\375\277/\360\202\205*\211\273f\320\324c\2454\206\232\330~hkz\003\372\033\307N?W\033l\245\330\217\334\316\030\333\332\336)\005v\232H\316\351y\030\036 \007I:Q\202\032\242\350L\210\330\034XN\317\214\021R\316\310\324\375\313\334\356)4\230x\024v\255\334\303\260\257\354\356\372e\266#\330J\026Bv/NL\226d\021\321\260M\331\214\317\361\016\312\264\240j\030\264\320*>\266\335\032]?"
+	.string	"\277\004\\"
+	.string	"~y\031\247w\324\277\307\225\215\021\020\353\252\356"
+	.string	"\024v\327\316\272\260\373\3356\202\355\004\333\022\001\b"
+	.ascii	"\252\244\223i\261\317\f\007\016j\256yZ\bB\334\025S;\311"
+	.text
+	.section	.gnu.lto_findEEPROM.19.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375`\317\003\365\032"
+	.string	"6\362\256H\240\230Q:\300c\332'\311\246\257\266|\261\275\341\303em\266\350k\034\r\222\253\340\355\021\241\321uf\347\217\3505\n\227\323^J\372+\237\200\327\344Ii\360=\236\210_(\215\002\326\f\341\213\306\207\321>\211%\233\310\235R\236"
+	.string	"\213"
+	.string	"\236"
+	.string	"5\270\340\324\0246x!A\037\202B\274\251D7~\016\310S\002\242\347<0\305qjm2\203\244\326 \0037 O\017\344QA\026\022\020tR\262\271\252\332\r\303\324\032\2249\370"
+	.string	"\343)\371\234\361tqX\234B\207\225\344k\244\342N!_\305a\033\244d\211\022cC\t\306KQ\302_LRT\320\213\262T\223\244\023\003@!1\315\327n,\242\242\204^\224\245S}\036%\255\020o\345\306\326\207/"
+	.string	"\205\004c\212\r\226\276\260\244\245\317\327\204Z\253\247Q\222\322\035\273\355+\333<\366\316\bYb\200C\263\313\277Xk\255\342\372<_\273\247:\271\005\b\027rw\\\236\375\257\022!*\300\354\372\354\240n\236\001\360L\013o\223=N\343|\310\1773N\333\034\370\327\220\3234\236\206\225d9\375\372\324=\222\323t\234\026\305\351}M\317q\372"
+	.string	"dN\275\0309\2546+X]t\225\251U\250\022\035\237\372\355\373T\257\262c\006z\021\353\374\266zQ\265\326\023\261c@v\354\364v\220?t\314\366\324\211\327\"\244\222\307\273\352R\003\307\342\201\362\201\203\377\224b<\265\331W\375"
+	.string	"\013)\341\221\024\320\311\027#d^\3533\325\371e\t\245\020\3151Wd\030A\215~\322\001\201\323\222;\361\220\300\251\326\n\201\311\233\314\033\321\306\323Y\353\215\265&\204T\346\226\273;\233\024\361\320\355L\340\333\322eQ\235\031\232]\353\205\313J\r\272>\177x"
+	.string	"\363D\236\204\006\204\305\207\177\344Hz<\243E\370=\r\335\350t\336[\304\035\267\\\236m\3437'\324\"\232cl\327n\304F\326J\364\300\277\032!\202\254\265\376\351\324\027\032O\277\264G\016\261S\303\311j\270\034\334}n\266\022=3\033\b\333\317O\317\210YM\215\226[\317vH\334r8\032\315C\315\006\302\3476\223\371\330zH\310f\271\037\331\216\001\337p\264\234\254\304\355\226\223\305<\364m\362\034o\365Io\365\017_A\213\026\325\021\361VwI.\f\266su0\221,\227\\\236\305\035WE\345\315\276\326\204P\213f_9fvg\366:#]\232\365\3341\351l\341U.\320\245\\\\~\234\306\321\n,r}\306Y\021\303\247\360\2103\310o\253'\005\034\320\365\f\243\315\342\254"
+	.string	"\256\035S\2255\004F\250!,\302\030D\210\021\022\251h(H\\\r`\002\031\232<\017\020p9\323d\330\f\330\264\264\354e\301+\351\240;9\262\361R0\3510\314\214\272T\2463|r.\220E\370\360=\b\261(\fW\3224\271z\374+\303\241\201\200W\223\352X\f!\020\256?@\2311\255\355\037\313n\005\211\371\221\027M\021\344\\Z_\233\362:"
+	.ascii	"F/\032@9\026\267\2542@h\2742\270\212\342\237^K\215\n0\356\224"
+	.ascii	"qy\377I>:iFQ:\"\023\276\350vu\250`\367\322\335\301\375\"\203"
+	.ascii	"\2730\244\001"
+	.text
+	.section	.gnu.lto_loadEEPROM.20.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375`b\003-\032"
+	.string	"F\361\255H\240\232M:\022\213)\364\244\377g6zV}\320\264\277t\370\272\312\374\320\325\276\313\bV\275s\030x\352\200c\372^|\346\256\322\327\323\025O\030\264\266uP\341\200c`\355\035\241\204\017\315\250_u\333 d\357-e\222\001\233"
+	.string	"\215"
+	.string	"\236"
+	.string	"@{\247\215\375\2073\220\033kQ\004\255'?\006\237\013A\374\334\b\023\200\026\367Q\251\350KfvTkj\035g=di\323\221\325V\323\221\025\327\345\370\025\031\367\0331\244S6\343\366NG\320\304J\212\253\252\227\373\215\f\205\212\216\334\013\216#i\301\013\210\365\250 \026\205\030\371\036\302z:NE\036\237\261\336N\032\250\265\002\350\t\261\224:GV["
+	.ascii	"zC\262\301VS\217S\235\211z:\356G}\201V\326\257\013\210\221\357"
+	.ascii	"\034f\250\265.\363zF_\330w7jw3\354v\210\274\357\241\262\336e"
+	.ascii	"\341\303\347\345\364\251\016S\302d\354\002\nu\256\235`\021\352"
+	.ascii	"u'\355\2169\266\240\344Uf;\310\256\200O}sp\016\365\225\305\376"
+	.ascii	"\373\302\226W\024y\303\311KC\336\031\362J\312\333\223\227%\357"
+	.ascii	"w$\204A\362\261\264\246\271\306Z\024\374\252\\&\026\323\247~"
+	.ascii	"\250\377\367\336\375\356\245\366T\033\233\222!\253\017\247\352"
+	.ascii	"\242|!\301 \376i\037\265\261\317=\223\217@\207\232!\253o\254"
+	.ascii	"F4\264\262.\214\337\241\237\342u\350\347w\003Kt\260\221\342j"
+	.ascii	"\222$\210\203\234#$\300\037@\360y\033\203\n\222.\240\256s\267"
+	.ascii	"\221\345\006\021\332Ig%\037\224-\023G\305>\220\001\314M;l\021"
+	.ascii	"#\370<\261E\374\330un\367Sl\347\355\222\370U\211\317\260\245"
+	.ascii	"\024\336\216\331\264\331\312\256M\200`0\350\365\027T\366l*e\b"
+	.ascii	")\210\203\333-\373\273\023\267B\321\355\200\310\323\233{'\b\214"
+	.ascii	"\2236\233\342U4\261V\035\205=\024\0235\261\310\347\273\227\230"
+	.ascii	"\276\220\234\236jp\220\237\276\322\210\221\235\2642hN\027`R#"
+	.ascii	"5F\307^+\013\264\332\255W\324n\375\363S\243\321b\374\204K{\340"
+	.ascii	"c\273\271\250\325P\254\350Q\321\302F\233\265\350I\3413\243\335"
+	.ascii	"~f\017\016\254\315E\3556\203a\263\335f\261\261\002/\305X\343"
+	.ascii	"\340\364\235.\236\251\202\243\013X\243\203\2007\235\264\025z"
+	.ascii	"\204\t\274x5\360x`\"\203\364\2235\321\312\020\326w\372\206\245"
+	.ascii	"\256\335\025\3778\032\313\342\021k\035:o\177\345X8\310\355\300"
+	.ascii	"C\317\373\334\363\320O\031\373\252\332tA\363E\213\216\275.k\255"
+	.ascii	"U\2242\346\301\210\215\335\325<\326aM\264\253\340:T\326\002\372"
+	.ascii	"Q\227\001; P\002A\b\3176\252th\f;\303A2-\322ME\310\343\021\304"
+	.ascii	"K_s2`T\253\323\264\n\243\030\354g\256qb\211\325\250\035\257U"
+	.ascii	"b\212\216\346\203e\316\325\005\315\360\346\307b48\200\013Cu\345"
+	.ascii	"\005wH\030f9\222k\320\016\264\275\320j\325`!\265\266\321\340"
+	.ascii	"\243h\242\222#\030\245\211z`0\017f\236\313f\255\337d\367\272"
+	.ascii	"s\003#R\032\017\016\334\206\263\033x\034l\343\nCi\364\357\325"
+	.ascii	"\007\207ls\357\325\232'"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.21.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375`\034\b\275."
+	.string	"\372R0\022F`\\N:w>\350#\242c6\361J\317\243l\222\034\231\262\3559\034\307A\001\365\267\3506*\251\327\303\360\372<\255\236\255\331%\372\177\351\005\304.\003F\032E\314X8~cttX\360\252*\224X\"m\357$\003\r\001\376"
+	.ascii	"\024\001\007s\270\356a/\377\326<K\346\256\344\234\207m\375i\017"
+	.ascii	"\311\274\314\325\335^\260YL\004\027Y\024{5\302\372\265\376\230"
+	.ascii	"0\027su\266(\236.\274,\312({\240u\331=\274\212\273\257\372d\337"
+	.ascii	"\362\263w9\332\325z\350\345_\256\236\006\343\331\351\005\002"
+	.ascii	"o\310\n\366\352\315C\007Z\245Tl\026c\267\270\234\350\345\354"
+	.ascii	"\205\202\213\025\233\331\330'\030,z9GK\230\311\030\302\372\311"
+	.ascii	"Z\\qb9{\211x\331\265\\=:c(+\232\275N\304\201ccb\257\376\234\300"
+	.ascii	"z\365\036h\275\3721\032CX\321\334u"
+	.string	"!/:\366\340j#\261W[\002\205\253n\037\r\353\022r\005yv\351\3139j\304Lz\245\362c\255\r\225\037kv\017F\337\301\333^\r\342\333\366\325N$\375k\332\245}a]\r\nktE!~\325\b.\371\351\265m}5op\312\216\343\217\371\235\312\235\331\245}\355\370\025f\3109\367\205~\345x\257\357\356\254\356~v\263\302>g\370\030\334\373\026\313\372\265\243\265Y\222\334\264d\255\226{FN\235\023c\365\3134\260\207\362\004k7\207\243u\350\243*u\353\233\203\340\336\234\337n\353\361\007\020\303\"\316\257!q\f\3139\353\320~\232\253\t\321\177r\265G\220\270\207\222X\257\036\273P{\002f\335\300.p\277v\265\022,\264\333\004\212{h\023 \243gGO\013cuG\233\027+\351\376R\230\237^\343$\335\304\333M\304\333L\304\333K\304\333J\307$$\b\304\333\016\004\3346\372\330\233H\350"
+	.string	"\361v\320\331\336?\347\362.\026o\023\211\267}\210\267{\210\267\207\305\333"
+	.ascii	"\212\267y\212\267\331\342ma\200\333k\200\333\352\317\355`\361"
+	.ascii	"6&\336\276>\267_\341tb}r\224y9w\005\336\311uj\233\224\273\375"
+	.ascii	"l\377\330\037\375\315~.\277\364O;\333\375\276\334\347\240\376"
+	.ascii	"\326B\347\232+Pg\036\247\374[\253R\272>ew\335\362\200\266=\326"
+	.ascii	"\253?\270g\311\031\032\255\353\367`\316"
+	.string	"9\007\215\016\264\376\340#\376\230{\330\203C\347\254\362\"\230\363\021\fzfA\274ba\022\022\026\342\377m\255x\270\344\016KY\020\253\370o\023\272\375q\237-\030\373\344\252\212\217\336\2245\341 \226p\027Xto\363\0240\022\036*b\214/\334\325y\0022\270\353\333\247\255\220\343[O\034X]\002\"\237\032\031\371\264\203\003l\204\377\004\354Q\302\016\360\347\036\234\302\244\216\fM\n\270\204\344\323VI\037?}\221s\356\314.m/\213\316\225\360\022\016\342\213\353\226\311\375\332&J\370q'\262Avqw\353\344S\253>N\301\311\203\356\255/Z\233\360\305\237\376\201\224\256i'\035\322\274\201\255 \360V+\023n\302\006\334\236>\232p\335B9\337\f6g\255c\177N\212VJ\377I\324z\225\t\037\356D[egwdeY7\020\243\275\325\370\302]t\237wc\030\016\f|\273\255\335-\225\326\312=\364"
+	.string	"\016\335\342\bj\312\b5\005\364\304\\\"\223\314\025*\311\304\314d\224S\222YE\3052\223ON\311\026+\222\211\304\314d\325r\311bE29H9)\237\244:@)7<%\253\230\311\030R\312\001TTI$\322\212J\330\310\243\250%s*\231T\001\245d!\265D\032\245\224NQF$\223\312x\264\240\227SI\246\261j\271d\032\207\321\254\007\203E\f\201\b\023\301\370\352\262p\263gDe\230QIa\244=8\021\023\341\377=\333,\334f{\343\036J\304gC\227-\334g{C\256N\013cmi\267\264\314\370\340G\177\350\036\366\301\227\315\023H\020\036\342\036\236\347\016"
+	.ascii	"8\b\367}\002\202]\b\017q\020\030' \313\203\001\340;\357\ba\036"
+	.ascii	"|:q\350\214\254\020\004\314\342c\034\264\263\226+NK\335\213\326"
+	.ascii	"\356\266\353gV}\274\332\033H\361T\254\244\225\200\024\371\335"
+	.ascii	"n\277\332\036<m\344\372~\360\326\247g\377\342p\340$|\265\263"
+	.ascii	"xoQ\356\001\\\304[}s\264=\330\234\235^\367\253\325\021\f\200"
+	.ascii	"\236\250QD\303\020RH\211\210\214\310l\232\326\220\002\021\252"
+	.ascii	"*z\021\220\255t3\242\260I\2450\315\001Nz\256R\367\367"
+	.string	"/|\336\025\325\343G\n\225\t\307Ml\231v\200\274M\354\207\022i\005\234\002\0278\337\002F\020\204\304=\\\211.&\304C\273?\302\223\217\327\035AF\"\212\234N\302\213\r\330\300v(d)8\245\336K\021\244K\0037\275\370_\231\t\351I\"\262a\020M^\226\343\343f}\220\3732a8\315\237\221\300_\r\341\314k\361\024\376\f\300M\301~gY\310$\347\253A\007[PE\253\301\317\334\006[\0168\035\330\002u*\317\270q\313\230\007\3445\375\255\017\260[z\363\330O\215\212E\3729\235\243\351\222u\3139O\354\252\260E\341{#\030;HV\342\343\234\350b\370>:\360Ip\2355\2074\251Z\352\304\314\243\237\247\324\330>92z\317r\025\342\266\325\213\337\364\310b\f\224\220\306\"M\352a\326\n\017\206{\0204\210/\310\307\3522\227\230\003\304\r\262\374o\265(hPL2sd\364\001\314"
+	.ascii	"\020f\030`\321\003\320\217\333\3238\211\324p80\301\022\0037u"
+	.ascii	"Ej\032\r\200\357\205\0305"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.22.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375`a\002\365\023"
+	.string	"\306\344\200H\340\360&\035\336\222]\35212\"\366$\304;\322\003\242\030\300\232\023\344}G\207!\t\355\265\023~\252\255\273c?\335#\030\330U7&\252\206\355!\206\031\346\023x\251\030x\235\035yK\302\200\322=\005\rB\b\331R\246\024o"
+	.string	"e"
+	.string	"h"
+	.string	"n\372(b\376\305\323lH7\347Lm\217\367r\274\245\306\356\021\202\237'Wc\376\207M\274\207\001\02058\017%I\316\f\233$\035\246\243\240\301Q\020\3046\323O\212\314\220\240\235\006\315\215$\271\001\303\3518\031\365\244\2009'"
+	.ascii	"\033\006\231\240f\223\251<a\363}\320U\006\013!%\0276\233+\210"
+	.ascii	"2\347\264\322l5\367\307m\247\260\215b\253\204sC\330\250\220\003"
+	.ascii	"\335\341o7x\365w\265w\265\274z\257\326\253?\300\301-\247\203"
+	.ascii	"\317\216U\032\347\314N\307D\362b\2248\320\177\273\332\267\257"
+	.ascii	"\302\017\372\212\217\261\003\231h$f\234\266\006\272\026\223A"
+	.ascii	"xo\344\"\337=y\002\337\275\037g\020\237,\210\375\3662\"\216s"
+	.ascii	"\346\304\206\356\246\233s,\271g\005\341=\307\034\037p\324\270"
+	.ascii	"\267;\016\360\263\250\b\271\f\263\234\226<\334\232\345~\217;"
+	.ascii	"\004\237\335,\247\037:\270\265\227O\356\203\245\030\315\341]"
+	.ascii	"\3714\273\001w\327#\232q\200\321\235\365&\372\302\325\225F\263"
+	.ascii	"\037\231\356.\347\234S\032\301\303E\355\235t9\231\034\231\356"
+	.ascii	",\325\276\340\242\247}\037\364k8\332\200$[q\347\234\342\356\216"
+	.ascii	"=\212\3720\026\326\n\006K\001_\257\225J\325\362\002\2552a\265"
+	.ascii	"\\,\253\325\204\n*\024VZ\252\324\212J\n+\245r\275R&\007\334b"
+	.ascii	"Y\271R\260V\313\225\002\031\247x\024\230\225\211\036\037\352"
+	.ascii	"\235\365\331-\013z\232\365\310\b)fE;\231\030Q\024~\253M\257o"
+	.ascii	"\217\323\002<c\017\270;\366\366<B-.z\232'\213<\310V4Q\222\016"
+	.ascii	"\323'%\270![\033z\bJh)6 p\002\031\303\362\252tB\303\320\250\230"
+	.ascii	"\rs\026\261\275b%j\255\214\320lr\257\314\250\272]\003-\367IE"
+	.ascii	"\330\202\264.\253\253 \305\2630\217nXY\0357x\257\214\345+X\216"
+	.ascii	"}\364B\323\375\315m\3459\366\340\226\214\327h\374\367\022\354"
+	.ascii	"\035m\235{\007\257\210\263+\272\004\227\313\035\243\356F\204"
+	.ascii	"\345\273z|\370\343\334\357\300\314\300\326Lr\375\336\351\200"
+	.ascii	"G^\302z\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375`\346\001\215\013"
+	.string	"\224\021\342\002"
+	.string	""
+	.string	""
+	.string	"\002\023\177\027\214\376\276-\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\027\020`\025\177\030\360\372\2508\034\031\005\031\032\016\177\033\200\200\200\200\004\272\220\202\002\017\177\034\020\177\035\215\242\231\244\001\005\r\036\300\204\001"
+	.string	""
+	.string	"\003\002\021\177\037\022\177 \024\177!\356\026\177\"\001\001\"\177#\377\037"
+	.string	""
+	.string	"\200\220\200\001!\177$ \177%\030\177&\037\177'\036\177(\033\177)\032\177*\035\177+\003\002\022$\003\002\021d\003\002\017\304\001\003\002\020\344\001\003\002\017\221\205\327\307\003\001\344\n\003\002\020\244\013\204\016\344\016\344\022\244\023\244\027\003\002\016\304\027\003\002\r\344\027\003\007\020\252\331\2276\001d\003\007\020\327\246\350\311\003\001\304\007\003\007\020\210\317\336\022\204\016\003\013"
+	.string	"\"\003\013\024\351\366\374\276\002\001\304\006\003\013\023\251\216\332\210\001\001\204\007\003\f\002\201\200\200\200\003\001\"\003\f\006\354\243\341\325"
+	.string	"\001\342\006\003\f\007\247\300\246\034\001\242\007\003\f\025\331\254\260\366"
+	.string	"\001\344\007"
+	.string	"( "
+	.ascii	"\003\031\033=~\017\3553\2242\247i\n}\t>\202\207\004\273\340\234"
+	.ascii	"\202\371Y\346ih\204G\b\363k\250Gp\004Gp\004Gp\f\034> 6Yz#\202"
+	.ascii	"1{\264\200\235\201\020\260\302 \353\337\300\177\177\035_\376"
+	.ascii	"\020\336\222\245\211+7Xx\335hX\350\t"
+	.text
+	.section	.gnu.lto_.refs.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375 M\305\001"
+	.string	"\002\004\013\020\220+\035\377\177\302"
+	.string	"\325\022P#\004\356-S\n:\324$h\302\374\b\254q\266x\006\317z\3223\305\267\354Q\023\241\221\34695\t\003"
+	.ascii	")Q[.o9."
+	.text
+	.section	.gnu.lto_.decls.2e390bef5311a16e,"e",@progbits
+	.string	"(\265/\375`\023\036\345\206"
+	.ascii	"\332\324\034/Q0R\312I\007\356\273\252\366\252\272\252\272\377"
+	.ascii	"\237\352\337\252\377s\306\210\361(\223Tm\355\373W\231\321\263"
+	.ascii	"\333\377[Wml\353>gN\232\206j\364\216E5\315]\307\314\245\212\250"
+	.ascii	"\252\"\252\252\210\252N+\344\210*\244\b\310\262\363\177\307\220"
+	.ascii	"H$[\312\024\177\002\331\002\370\002@fX\f\223a:\251\365\336\260"
+	.ascii	"\301\216)o\005\001+t\306d\251\233B\311\214\331q\262f\221\351"
+	.ascii	"\223\227\360IE\301\321X\263c&\337]L\316\275\005\244f\276\326"
+	.ascii	"\314<\214\t*ZVsP\322\363Y\332?\274$=w\245\347!\3519k\213\026"
+	.ascii	"\033\346[\231\271\326R\326X\344\224\214\254\322\036\366AU\260"
+	.ascii	"\217\025\2463\021F\213JM\237\\\345,\205\217\311\024!A\372<\343"
+	.ascii	"H\317G\254\\f\327\245\317\314ji\202$\230\3152\227)\022\223\344"
+	.ascii	"\235\231\004\025\260\033\237q\331\216\261\347\032a\261\261d1"
+	.ascii	"7\236\302J\330uY\202U\323\335\275\027\350\354\306MX\3152\227"
+	.ascii	"\027id$\001 e\314\246\360\356]\341x\216\343\370\215\345\230\311"
+	.ascii	"n\347(,\205\305\316\353M\256H\201r\325\211\211\345\234g%~\034"
+	.ascii	"\356E\336{\007\270\201\203\"w\325\347\201\316T|P'\251\365\362"
+	.ascii	"\340d\265\361\370\322\347sH\321\266"
+	.string	"\377\006G\016\315\216e\237\257a\255\267\366\320\230\364y\027\351UH\331\t?af\003\f\345\234\306h\2679\256wM\265\334Q\315\365\371\022\322s\003\250m6\271\001\364!\244\315>h\217\006\251\nF\2012\022<\306L\003\230\354\022Tpk\034\273`\367\256<:k\214X\243\327\347'H\005\030\273\025<M\317\006\240\334d\003\320w\372\303(\320\b\030\005\312`\r\330\244\222\362\236\335\273\236H\221mM\300\372\374\312(\320\224}\210p2\303\317Mn\342\3570A\244\375|\366s\316\363\314\240\374\314Q\031\331\r&\353`\362\277\200\027\306\304~\016\373Y\203\237\227\374W\302_\036\374\235\344\206\"~\346\341\3653\220$\377\337~\356\202\213\001\311\317G~\346:\340\357.\377\345\356\246\307D\b\370\273\b\361\177\377\255\345\347\337pB\376g\211c%\021\202\374lS\303\377\027\3767\360\237\001#\003\376F\177>r\326\013"
+	.ascii	"\340\377\315\337O\032\355g\254\237\253~\236\3729\352g\250\237"
+	.ascii	"\227~F\372y\210\237\205\370\231\207\237\325\237\213?\313\370"
+	.ascii	"Y\207\237a\374\374\342g\241\237\201?\377~\246\341g\031~\246\340"
+	.ascii	"g\024~>\341\177\363\177\225\237M\370y\204\377d\377\327~\356\340"
+	.ascii	"\347\r~\306\340g\013~\256\340g\t~\336\371\257\345\347\233\237"
+	.ascii	"\323\237\371\347\377\247\373\017\366\377\201\377p\377q\232\315"
+	.ascii	"f\363\267`\377\231\376\003x\020:\367^\245ui\314\271\367\350t"
+	.ascii	"\215Wz\351V\335-]\037\227\351\214X\257\356\275\367\032\317\352"
+	.ascii	"\254\2247\253\321\245Kv)a\034\335[w\227(0\262\021\351\032\031"
+	.ascii	"\371\336\243\325\351^#%\016RJ\316\202\344tu.\362\250dd\245\314"
+	.ascii	"92R\"\335. \374\224dZ)\201\326\312\230\313k\264\032yy\353\252"
+	.ascii	"\234R\246\221\311\3500\267\244\224VtN+Nn\315D\022>\320p\364i"
+	.ascii	"\326g8i\\p\210\365\371S\207\331\312\354\265\311\372\032\307\256"
+	.ascii	"\021'i\356\307\033\336\275R\016\330\272:\264\244>\337d\177#\321"
+	.ascii	"c\310\235#i\300\226}6\023\2407\363&\210Z\215+}r\263y/\243@\373"
+	.ascii	"^\353E\354f\013\031\2523+a`\034\b\361q\373\\\222\342\206\314"
+	.ascii	"\230\021\024\2656\"'\356\013\325\226%\3755\246\\u\354Q\207\234"
+	.ascii	"Z\237\353z\357\312cC\304\252\211\306+\t\317\025\021g\212t\327"
+	.ascii	"\272\223tu&i\b\022\256\234-Sek}6\027\327\265\020\261\270(/K3"
+	.ascii	"\035\227\262sso\325\227%\030'q);\3105\001\271(\257/\"\275l#="
+	.ascii	"\244\213\364\021f6Wk\235\257\364\026W;5\224\004`\242\274\360"
+	.ascii	"Z\212\253w\264\325\016\262\347\"\271\272\254H\201\254E\262v\316"
+	.ascii	"\276\226G\332X\235\305\314\303u\220\237Ih\222\304\365y\353\224"
+	.ascii	"~\b>\034\312\243}0\335\331\bJ\352\200\332\252\177t\325\223\213"
+	.ascii	"*Q^x\367^\"\372\212\231m\365s\275\227I\300\016\331\02315\364"
+	.ascii	"|W\235\251#&\312J\244\317V\002\275\201l\260u\245\244O\333]"
+	.string	"\322\236\352\036\314\374i\252w\0166\373\rr\275L\023Rj\210\201#K\317?(O\263\331l\362\017\372f\222\276\301\322\323\265\021\351;Iz\262\017\332P\3357\032\307\033\252\237r\220\ru\336{dF`\207\031\001\033)D\216L\320\363]$}c51\235E\204\205\221[bf3\275\225\232\251\223z\334\351\364X\312\262;\247l\270\235OF\250\346jt\322\n\326\024\263>\217\032\211\231\235|\323X\221\\\266c\357\365\221fYA'\333h\275M\031\344!\261\245X\261\3027\246\204\227\205\236\215\224\236\327\244\177\037\r\340Yu,]\265\261\257\317\r\212\314]\237\315\365\310e\213\333\022\351\031,\013o\021\003\203\205\313\027\257*\f\366\003\325\261\0260/|\005\217\303\260\031\246\223\352\271H(xwhx\334\205\313\230Nj\003%uy\274\206\367X\217\321p\032V\303L\306c/\347/\f\006i\206\307tA>"
+	.ascii	"\353r\267\"\305\n\2362K\314\242z\316,\017S\200Q\322\00411w\367"
+	.ascii	"\256e\370\f3\331\314S\254\367\236M\360\007oW<\372\264>.\305\007"
+	.ascii	"7g\365#\311\216\035v\212\313\016\246\274/\235d\032\261!<n\247"
+	.ascii	"X\255\216\211\206\315\347\246\\\322A$G\016\033e\267\264\031\363"
+	.ascii	"\266\324\262:n\243\304\340\244Q\302FR\3126\331&\013\005&M\224"
+	.ascii	"\027g9%\343n\334B\235GY\270\326\364i\237Z\317\232Ea&\351\323"
+	.ascii	":\265\220t\212\007R\323\245\2349\326\226\310\365y\337\261F\r"
+	.ascii	"\273\324c\034\273M\250\231\022\315\021\274\241\033i\320\254\322"
+	.ascii	"\355\222\036U\215>m\022\263\3310\177\274\345\365im\334NE~\031"
+	.ascii	"1\305\032\255\321\"\345-u\344\230\330\236\354\321-\222N]\332"
+	.ascii	"\335\217>-\215\326\343a\352\262%\246O{\264\310\234-h\234x\261"
+	.ascii	"Hkdm\204\225Q\353s\005\313ij\332R\036\201\3165\251\311[\233\315"
+	.ascii	"\336\353\261\310\353Co\211^f\033\226V\212w\274\336\353+\245\264"
+	.ascii	"^\366\242\274~v\342\220F\322\324\274\367\244\224\021\241\202"
+	.ascii	"\324\3536\271\244%\275<\272'#\327\222\2533\246gu\323\264V\032"
+	.ascii	"\245\b\027T\237G\241\316\234y\262\207\304\206\227\316ai\303\321"
+	.ascii	",S\246\337\322-;\236\257++`\312\330\331\365\230^\372\312\222"
+	.ascii	"\202\334\331\210\201r\314\352s\314\022:\324\204,\365y\267\303"
+	.ascii	"\206\204\006\027&\275\215\022`\300t\030\264\311\024\327\031\222"
+	.ascii	"e\237a\230\rg\013\211# L/\314\366\302l\275^'\027qN\253\003\267"
+	.ascii	"ARW\327o|\357\361J]\333%\f\211\355\313w#\307\027\256\036[\266"
+	.ascii	"\364\233\tB\202H\375\340$u\345Q\365y\033$,X:K\312faz\374X\257"
+	.ascii	"\264\243\245>\231\331Y.\346J\027W\232\032+Vz\326k5\265\344y\222"
+	.ascii	"f\006V\027\027\327UT\\\251\261k\334\301\322\243\207\003\276)"
+	.ascii	"U\272\322\356\r\036\016,a}\316].G\351t\221\350Z\016\254#}6[\315"
+	.ascii	"\314\206q\212\233[\277\245\276\245\0367\363~\203\2721\202\304"
+	.ascii	"JiM"
+	.ascii	"\337N\372\311\033\312\2414\025>\273\327\211\247\t\232\224\323"
+	.ascii	"\317\337mo*Sl\270,\201C\307\024)8=\230\320\264\270\nG9"
+	.string	"\333\231\013Rv&\3129J\322\346\251\314\310\224>[\255\331|InaXl\275VC\310\230\273\346\332g\224\370j\353\363\235\004{\371\277c\306\354\313\217V\242\343\243\353\f2Iz\364\336\0336\353u2\312A\331\206\371\347\327a\313\t\330\377)\210\3565\226-\313\244H\324\216SWq\177\3565:%\231U\306\023I\346\361&\311\350\236N$\327\013d\200\313\274\272\311Ui<\225\306\276\353EV=]\244\322HL\256\327\351\256Jc\317E>\365$\327\2431\311\254z\342$S\371t\342\"\257\361\"\217@R\244\362)\031\247|\352I2\217OId\325\023\337Uy\331J\333Ze<\272\314cDCaQ1\030\303\020\361\206\210\252\303!\t+\f\021\355a\260\220\021T\213~(j!,\n\025`B\b8La\210\210\372\0028\f\026A\305\240\026)\202*P\2108\343\247\252\302\240\240\237\005@A\305 "
+	.string	"f\304@\001\243HH$|!\200\017p\030\003G\375\241\301!`q\250\272\020@p\310'\b\204\320\205\236`q\206\0324\243\250\272 \200\2200\0060\206\"a"
+	.string	"\252\220H\210\243\026\201j\221\217\020Q\260\370\033\"\376~'\206/\024\r\021\tU5\350BP\025\026{@\241\002\013.Z\030a\004!\"\341\013\234\007\t\213A\242\340Pz\n,\200\300\202\013|\360\005\177A\241\241\n\301\342\214\030B\340\013\235\303`\241\026\r\211?\242\241\f\031\303\240\026jp\250\bTU"
+	.string	"U\240\b8\352O\202\t\324\340\217\004\037\365W\f\n\001\203&\024\235P\177E\225xs\030,\026\310\201\325_\220\370\2030\006\360\367+\006e"
+	.string	"\203E\265\350\247@\017\\\f\276x1#\007T\005v\261\030\2641\206C\020~6\303\030D3\322\342P\005\022\te\024\203*N\f!\370\004s\370\005\t\207\2002R\3650X\f\021[\f\021}\202\210f\220\240\006\213L\020\275h5X\024,\332\024\375~(\252E\302\241\240\213!b\016\fu\210(\030\003-*\n\026\205\204\200\276\037\210\303\240\263\250\022\255\372\023*\016\203\202.v\236\300\207\304`\261\205:\034\026[\230\030\"\266Pp\207  \021U\177\026"
+	.ascii	"\245A \204E\247\372#\032\"\332\020\r\021-\321PXT\f\362\340S\177"
+	.ascii	"\027\250D\302\031\276\003\001\205\240\002\206\025JH\203X\310"
+	.ascii	"\030\026\211\301\340oH\370\202h\030\324\202H\b\224\321\"\250"
+	.ascii	"X\324\202\005\002EC\300\030/l\236X,\233/W\226\030q\322o \214"
+	.ascii	"Q\"\242\311\336\211TSE#\255\323n\226MO\246\240-a{\303quf\217"
+	.ascii	"@\351\332\272(\231\201\351P\361:\262R\206\204eeK\213\314B\335"
+	.ascii	"\354\351\215\2051\243\252\300\210Q\365\272\332\261\033'\247\343"
+	.ascii	"\225\332`N\315\035\022\267ce:F\216A\354\232)\022\307,ku\322a"
+	.ascii	"a{K"
+	.string	"\037^\232\356\330r\243\262JZ)\007\254\007\227\333%\335A\275\206 \255}u\025\023i\300\210\325\0251us\365\325\265g\275l\025\234\333][\257>6*K0u5\025\353\345\353\350\207=\322\266&\245\252\255\221}K\242F\221>m\021;\204\232{\217\266H[#vy[\344\314\b0#\300\343\253\373J\036\321\323n\331-K\344\004#Q\217)\317\016\271%b\335x \035\321\222\376V\213\r\215\242\241\327\304\n\261KQ\230j\253\rB\206lCF\365yue\261\324\3265K\274\326\242!\004\212\210[,\023T\310\232\306\032\315ry\032\262\004\214\212\312Vq\226\022S\036\336M\032\225\334\031 \267UJ\273%\\\237V\331lD\312,\303\372\264?n\307X\002\202\236\250\"\0019E\"\2352\b\321\210\210H\232$\035\242\n\020\004#a\036\313e\007\022@5=\022*\310Df$I\322\336\001*\t_"
+	.string	"\322[\317\302Dw<\325\340\333\305\013\370\234\267\037\" \005pp\025\331\335\256\t\353=\243\203+\321\036\271\016\334[\013\204\026\026\215\032\006f9t\024\206\215\2508\332\253\233\320\203\202\371\377x\305ti\232G\224R\206V\202\236|Sc\210YU2\235\202C\344\336\214Jc#;\004\303\b\212\3256\210\331x\215<\3268\370\370\266H\333\n\250\304\026\232\235fi2_\031\203}\r\366%u\302\267\303\331h'\002\342\201\354\335"
+	.string	"\033rG\211!S\360\257\331\341\330\351u\220\334N\265\240v\\\335f\302\315\300\3772\252a\201\336\177\r\0044y\004\300\230\363\201\352\002\243\343\306\323\372\201\224\362m\267\312\002\022y#\t\255`\f\204zzo\212H\277\372C\263\201&\235)\264Y\0228\277k',V\267>\036\034\340\231\351"
+	.string	"v^\002\245\243e\026\002\f\251N\362\246\313\335\033A\027\034\3614Z\025\213\251\221\234\030\032\002x\323\222\217\306\230r\332\234@\027\356\240!\267\177AX83\323\223\267\n\216\21209}\220\212!\230\300\202\343\331?\345\234bS\225$\303hH\200x\030\\\253\231\324 B\2250\240&\256\034\315\2718\245\307\236\340\206T\274\331\244+\301\276V\trT\355?{\367\332\344\375\233\251v\023i2\3039\377\"\2056\313\250\305\373%\311\004\262\227r*\272~g-\210\345\244|S\252\202l\321\361Y\262\215\344of\240\241z\263\357\271?\350\223\t\273s\311\365\255!\244\020\202\212\030\td\213\364Z\003#\242\326{\002\310\367\273t"
+	.string	"\375\031\331\247j\357l\327..1C"
+	.string	"\204Fo\316\234\005\037\rW\256\334\222\343\tT\366S\243\254\311,~\276dU\265\333\020\255#\\,:\332\274\r\220s\302\f\231N\315\240\276\016H\206JY\352\210\257\2549\352fl\270<\220\210\360\311<\004\312\270\370g\232\311\230U\337\275\332\254\262\322\361\3049\260\374\211\233x\020\334\332\226\r\340\377\2249e#\214\254\264\007\344\022\032( u\250h\tn\374\253z"
+	.string	"\311\227\327\264\025\217\243\331\260V\247X8\310\335/\261&J\351\314a\236S\367I\001kc \260T\276\231\276d\371\365\250\022]u\272\270V\252Sl\327Xjb\021\245\033\316=j\3760\377AGQp\307\031\311r\276\237D(v\b\214\312\374\275\211\bx\rW\032\2755\262\303\016\343\364xeC\201$Fqf.y\335\003\020\2179\312\372\350'b\353\235"
+	.string	"[\216*0\245\226\234\301/R\242\221\017\3429\203y\2533\252\343:\211T\365\013\020\202\263\233>Of5RC!X`\242\377\201\202\002J\355\035\220t\343\376\261\f\036s^\"_+\035\024\013\223\326\3661#\020E'=\372\350\002\206:\320E\354\345\334\343\353\303\001\005\236o\373\233@\n\342\343\241\311e\235\224\004su\005\364\\H\320\326T\370|\320B\200\017\212\007\033J\337\3035\334.\t\204~^\325-\264\f~\217\216W\277U\326\341\326"
+	.string	"\255^\356_\375\200\334v?\023z\031\362\035\263:\354y/\f\rb\371\310v"
+	.ascii	"\271G\202\n\327\324a\213\323\306\336\230\025\026\260\271\205"
+	.ascii	"G\3534i\016y\330\357\357\005\253y\023\025\243*sv\314(\177}8\017"
+	.ascii	"\300hu\217\273z\232\327\236\271\214\331\201\300\004\362s\221"
+	.ascii	"\253\306j>\037Q_\361S5\033\023\306\270\037\267\211\236\020*J"
+	.ascii	"\241S\360\177\364"
+	.ascii	"t\002\027~\334S\201|v\330k\356\217\016Q$8\203\267\021\276Q-\212"
+	.ascii	"\355S\202\253\311\302\275\342\341\2132 \023\366Y-\250\200\n["
+	.ascii	"\224\356\212u\356\331\bz\n\264SB\370\243\001\307\231\221\237"
+	.ascii	"\314p\353\335\342\300\016\032\2207?\221\037\364I&\372\365\377"
+	.ascii	"\222V\316\211\031?\374\271[\2310\037\335so\031\252\020\376\210"
+	.ascii	" \310\346\300\260\200\211\2147\276\216\312\350=\247\202\3520"
+	.ascii	"\277tx:\344\264\374&\304\034Ma\340d>\033?+\335w\236V\022\276"
+	.ascii	"\365\005\206\376\333|\247\353\270\243]\264n\335u\217\320\r\334"
+	.ascii	"\022\177J\275=;\262}\213un\236\216\2353\230\036wA6\262\177\n"
+	.ascii	"\210]\230\247\f\232!\362\336]\335\316M\257\007\374\301\267\276"
+	.ascii	"\006{Z9\361\330\353>\350{\201\361\357\364^\277\031\244\\\376"
+	.ascii	"\367\235\207s\237O/\266\003\272_\3762\373=\f\316\030b\"\371\177"
+	.ascii	"\336u'%\016\302\233\206\315c\352q\357\274\270\326 `V\201;\312"
+	.ascii	"e\327\017e\262\275\027\322\264\261\356\004\334\236\3278\033\304"
+	.ascii	"?\374\300\316\220\362\302\253\017\256\352%\310^\272\341C\332"
+	.ascii	" Y\357g&=\200xC\372E\355\033Y\017T8]\343o+"
+	.text
+	.section	.gnu.lto_.symtab.2e390bef5311a16e,"e",@progbits
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"getEEPROMStorageSize"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2e390bef5311a16e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
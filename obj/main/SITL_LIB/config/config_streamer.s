@@ -0,0 +1,466 @@
+	.file	"config_streamer.c"
+	.section	.gnu.lto_.profile.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375 \270\325\003"
+	.string	"t\005\254"
+	.string	"\t"
+	.string	"\250\315\347\271\007\f\002"
+	.string	"\002\001\001\240\342\234\212\n\002\241\224\201\263\003\002\002\003\002\001\003\367\346\266\265\005"
+	.string	"\004\345\367\212\303\017\n\003\002\001\002\004\003\002\001\005\372\203\243\344\n\016\005\002\005\002\006\006\265\234\352\241\r\002\007\235\220\277\362\b\b\b\273\322\311\227\b\006"
+	.string	"\016"
+	.string	"[`{\261@PldZ\003\031\274\244\202\016.\013\355\234\336*\34133"
+	.ascii	"\002\273\2336\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375 \217]\002"
+	.string	"rD\f\022\260%\351\300\207a\030\006P5\325\332&\244m\271S\nN\365\332\311\036\272\340\221\240Dy\277A\t\260RyF,\007\325Tl\310<\263s,\003\001\t"
+	.ascii	":y\\\330\3202\017q!\270\020}\025\351\331\f\017d\262\001,"
+	.text
+	.section	.gnu.lto_.inline.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`\r\002\215\013"
+	.string	"\246\32183Pm\222\016\253\266\013\301\260\244:\017\205`}\b\004\254\234S\013\333\236\3000\\S|\026\177~{f\357\316\314\306\315,\224\036\275\354\375F\272Y\262\345N\001&"
+	.string	"*"
+	.string	"-"
+	.string	"\375\373\001\030\333\323\312e\227\323\314\314\273\327\203\244\314\254\036\204$\231\231a\217\267\336\367\0314\303a\302#\340\333x\001w0U\2752\3232\263\256\036\222\231\324\270um]\235\2656\275Bf.<\233\352\375\215p\340\250\"\334\357\203\026\033\037\f\226\003\354\276\374iD\t\005GAm\250\2008\271|\250\032Yz\320\340\177\275J\317\322+~!L\351\220\020i\256<\333\364n\255\2038U$<\377c0\3550\256*\300Qf\266\333Y\227"
+	.string	"k\263MK&\"\243\222Z&\214\337\007QF.D\231)Nz\220=\021\200\364\257\323\003; `\242AB\327\003(\263\005X\005\260F\360)\002:\274\034\025a\364CF\214\034\305"
+	.string	"`\200q\027|H"
+	.string	".\360\005!\\\340}\377\346\2260\217\215kWbQ\005\343F\244\353qW;\3171\3303\260B\223\240\031\2105\033r\2540a\230\"\373\241j\315\261a!\213\250[\203\024"
+	.string	"\354\206<;l7\r\305\007\t\244\307 i[\307\035\026\330x\021\024\"\254\033[\336\035\314\334\244\215Z\374\234\341\262\203(\024\344\264"
+	.ascii	"\213;\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\265\004"
+	.string	"RI\030\034\260%\351\fl\224\300\303\260PoE\211`8\247\230\005R\202\265\230\264\335\366\226I\006\274GoF\\t\217\336\270\244\267\017o\270'\206\274*@\257(\214\236!\374TD\020\273\367\351+\362:\257\352\350\367\343[\366\234\2363\023V\362\301\275\025{\305:\223\326\302k\231\201\222\035\275{\202/\r/\004\023"
+	.string	"'+\220\242\007\314L\006'\320\200\254\2406s\340\024\363#\263\332\365mO\254[B`5$v)\204\317<\346T\264x\306\260y=v\222R"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\002\231\004\003\230\004\004\232\004\005\232\004\006"
+	.ascii	"\205\004\007\232\004\b\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\235\005"
+	.string	"2\210\031\"\240'\351\340j\\\305.\005\270\353\374\027\342\252%\310f\241/\315R\021\331\261\177\234\266Ik\204l\231\002\027\f\b\002\362\212==@\263\252T\312&\217\267#\260\023\333\330\352\301,\204\274\2633\342y\267\025\272k*\247\006J\211\3614\211\205\243\b\261\n\325\177\033\334\305\372b\347\371\275\237\365\200\331\317,\373N\276\207\037"
+	.string	"_#"
+	.string	"\356i\035\242\n\016\0243W\t\204\326d\b\370\002=}T\217"
+	.ascii	"\356\345C!\252\256A^\301,\220\031{\255lH5\240\212\f\371\270+"
+	.ascii	"\204#\320nT\350\311\360\343\346\" w\347\305E\241hI\200\236\366"
+	.ascii	"\r\240\b"
+	.text
+	.section	.gnu.lto_.lto.1519dc7d7cd05f8e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.10.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\007"
+	.string	"\242N45@o\323\001\230\002\344\003\200.\225\304\233\3271\363\213\006\301Uq\206\266\277b'\016\270\215\264\343\355 b\255\243\224]\374\034\006}\220\340\016\036\333\230u#[\246\024\226kq\262\353\323\2712Q\310\001\302\363"
+	.string	"\302\254\b\362t>\321\312B\221sP,\342\312\242\b\303\262\270\361\356\351\260k\303\313W\001-:e\201\233R!8a+1\221\346\232&-\337\005\334ZoK\270\321z\372\377\302\2565\311\316\251rY!(\375\031\245\230\177\024\312\307\246\255\263u\210E4\223(\034\360w*'\277\227P\005\215\251z\036\250Li,P\231\252\326\262\330\353\270I<0J`\376G\310a\315\251\325\0361"
+	.string	"7\332\234\031\206\377Mn\244\341B\2675h\273\320\026$\t"
+	.ascii	"\252\244\2231\215{\206\215\263\257`\336%\200f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_config_streamer_start.11.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`m\001\335\r"
+	.string	"\006YZD"
+	.string	"\2216\035Py\320`\276\356\030\271\r\201\255-Z\365\240X\307j'}\205\314`\341\221\224}\350\344\017\364J\247\3029\210\213\200\377\240!\262\377]c\214\351\347#\020\2650\367o0\3138\264\240F\366\226;\245B"
+	.string	"F"
+	.string	"F"
+	.ascii	"\327\247\303\023\250>\257\017\250>\r\3324\036\222\366\247\023"
+	.ascii	"\032XR\273\233i\210\203\227\032A\337\372\3408\ty.Q\256X\350#"
+	.ascii	";v\367,\217\240\220I\214\326\307\356:\236\204:\334\363\266\037"
+	.ascii	"\330v`\377E+\277\365\360\2377\375RF\037\213@\"U\243@\214]\016"
+	.ascii	"32\0133]F\330>f[Q\374\004~\305(\031`? @-\273\253q\203\353\263"
+	.ascii	"C\306pDf\301\243\375\322U\300\233H.`w\364\322\262\033j\254 q"
+	.ascii	"w=\352\257\272\202\234f|\342\r\333\334Y|\327UK\3000a\262\324"
+	.ascii	"\266\360\025F\251\213\027\033Sm\357*F\256\335e\340\247\300pA"
+	.ascii	"I\"H\252O\004\033R\"\225\017%q\306\016=QS\354\313\335]\353\310"
+	.ascii	"~[\006\216'7o\003\"\265[\363\350\266\316f\353D<\t\0248\023B8"
+	.ascii	"-\013\341l:\231\326y\231\307\001s\025\266.\023\341\270.\303\302"
+	.ascii	"\275\\\035\031\202\007\230\0225q\202\333\235\273\030\245\006"
+	.ascii	"PH\242R\214\324\224\177U\213\017\200\006$CT\212\t\" \240\002"
+	.ascii	"\031A\273\001\312\244\033\232^c\203\255\335\367\315!\212\262"
+	.ascii	"\033\2741\b\002\266\231\032\201\022\244,Da\3036\357\253N\203"
+	.ascii	"\266\316!\t\227\2179\262\233\264v\241; \240\321\025\203+J\343"
+	.ascii	"Z\3702\214\b\020Q\300\2274`\331r\333e\364"
+	.text
+	.section	.gnu.lto_write_word.12.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\025\f"
+	.string	"6\027SA Q\233\016\234Q\322\027\300\034(^"
+	.string	"\027\005\b\245=\030\325\206Q9z\204\303C5\034\276\026\221i\231*@\024g\315yOJj\242E\b@U\321!7\315\306\t\340\377\001\261\361\333\215l)S\nA"
+	.string	"A"
+	.string	">"
+	.string	"!:+T\312`b\332\335\313\300-\325)x\002\325)\005\301%w\250\311\371"
+	.string	"\272\317a$\271B\004\242\030$\001:\021h\231\361\241\306\277g\250\003eZ\230\335u\216t\033n\352\266\037\330v`\037B\2574\r5}\312s\2300\331\210p\332\325p\302\2612\250\027%lsv\305v\226\\( `A\237\b\006O\373\245\257\340\356\201|\300\356\b\206\213]O\201\027\304S\366\242m\037\305Sp\366\t\364\002\371\221\250\224~vwUIN\360\253\346\243\001\312\033\266?\336\302'\r|\223\315B\334\335\217"
+	.string	"\251N]9\220\360 RQ\n\311\223\355}RI\366\317\302\324\001\203udk:\276\344\267\356=[\266\331|h*\354\306.[\326\311d\233\207G\302\004\316\246C\303\256\016N\246sa\233\347\272\034\260F!\333.\017M\333\256\212\267\327Q\324\177\247\220N\210\362\n5d\033\2521!*\002cZZ\251]\301\023\024"
+	.ascii	"\252\322y\301\342\246ft\023\006\214W(\332\202\023p\307Yh\031"
+	.ascii	"%\230\301yc\377\272\006\366L\340\2400\030&P\221\301\tI\252\301"
+	.ascii	"\026\241i\f\n\n"
+	.text
+	.section	.gnu.lto_config_streamer_write.13.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`2\003]\027"
+	.string	"\326\252\225I\300VQ:Ec:w\226\257\315\200h\bN\f\201i \344\202\231\224a\264U\336\273\376\213\363n\300n\377\333\360\360\034h[y\006\363l\033\300\206\004"
+	.string	""
+	.string	"\240|\267\005dH_\252ev\3211\361\225\330!\204\354-e\222\001\200"
+	.string	"|"
+	.string	"\203"
+	.string	"\244\211\017\2505\347\304H\255d\203\205\020\236.\031\236\307{\310v{\223\324\215\027\302\202\333u\251\265\252h\236\372N\347\t|\247-C\306\223\374~,;\370\321\331,\333\357>w\224\2458\362\034\234\240\315\207\306i\304M\033%$\243\027\235{F\032\177\001j"
+	.ascii	"\235\262\370\234\020l]\\\234F\333\024\240\204\223b\032k\334/"
+	.ascii	"\372\202\245R\034\201\316\240\205Z\353\2628\252\370\206\337]"
+	.ascii	"\237\335\255\260\333\031\002T\276\350\030\232q\331\274#\333\330"
+	.ascii	"\035\264K\362\260\215N\ti;\267\233\232\274\250\223\377\351@~"
+	.ascii	"\230\377\370M\347}\303\220\027\004y\277\311K?\336Iy{\362\362"
+	.ascii	"\344\275\314\207\237('\270\324\352S~\251P\250\221\320y\337}\220"
+	.ascii	"}\021o\347\365\366\003 \205P\026\244Z\311\232\323\245\020\236"
+	.ascii	"~W\266k\332\335\346\003\0311cj-\206\213\t\374c\247@L\255\021"
+	.ascii	"\241\210p\336\375\320}\310\036(\236\"&\245x\366\251w1h\340\213"
+	.ascii	"\264il\315\263{%\261\031\235\270\273\341G\035TI\024\314\346P"
+	.ascii	">\021\201\226\311\013\033\271\331A;\277\275\217\333\200\217+"
+	.ascii	"DUj\254\264\335\273[\342H<\310\350j\2556\273\253\033\261R\272"
+	.ascii	"\326\217\2048\205\351-b\322\354Ep\\\341~\247\347\256\247\005"
+	.ascii	"7\221\031\335\305$\006\177sw\357\006\203\306\345\356\212\370"
+	.ascii	"\220\355\205\265V\t{!\037n\302\031&\276\323\367\213\236 :\253"
+	.ascii	"\234n\221p\305f\316Y_\226\003X\353f\325\202\351\304<\204p\201"
+	.ascii	"\300y\261T8\256\325\215\212\005\213\251\034 \330WN\013\246\322"
+	.ascii	"y\275`*\023Y\3379T\323\314\232\266OP\375\335\017\034\225^\206"
+	.ascii	"f\\\202\035\264\017D\232j\260\005\233:\354\236\260\301\346\035"
+	.ascii	"DV\27665\330\277\335\200\351\257?,\270\245\031\227\237\265\326"
+	.ascii	"\372=x\330\251\376~\226\312\333\r\032\227\274\202\326\274\t\305"
+	.ascii	"\261\224C\013\355\335\013_\262\2750@\250a<\207\f#\b\225\004#"
+	.ascii	"\021IA\272\032p\002\021B\253\003\021\320A\"d\220l\035*0\316\001"
+	.ascii	"wG\036\274,\214W\355\366\214\201\305\203\312\206(?\020\251 \266"
+	.ascii	"p%J\255F\254O(\352\231\362d>\245\337\367/*}\237's\335\3147%\001"
+	.ascii	"\006\252\345\363\313\225\260z4h\032N\233\t2,'\2168\360A]g|\310"
+	.ascii	"A\232z\203D\366-\375\026b\235\344n\016\261)\024\372\255 \023"
+	.ascii	"\237\0366\330D\365`\202\213\244\314R\225\361\250S??"
+	.text
+	.section	.gnu.lto_config_streamer_status.14.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\035\b"
+	.string	"\362\01787@\215\222\016<\214s*y\202r\273+d\317\237\375*3\316\317\017\240P\\|\264Nt\266\032V\021\260v\377\206\341\001\377\315\227\nQ\033\252\025\312\301o\375\255\021\"S[\3374\035\307\263\341t!\320CD\007\342\303m\332\247\263\361h[\007\3224\007s\022\234N\013q\\\247a\276\354\307\230!E\213\177\242$\263\262\314d\270#\025\024\231\252\330\025\305\200\025\t\266\3747\202Q\343{eL=\204\307~-\274\004P\252SK\255L\214\026\226L\301N:~\3571\177\341w\325\020\257\237\250\003\231\251\226I\346\227\260BV\354/\373\357GA\274g]\037\307\251\300\303tQ\262\222\231Z\246\006\227bW\t.\305\342F\275B\357V\244\016\250\222\212\3514*\004h\310\314\241\351\224\321c\177\204\177\341G\t\f"
+	.ascii	"\252\244\223i\021\206\315D`\232\005\344\230\320]\303\365\261"
+	.ascii	"x%\230xp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_config_streamer_flush.15.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`\350\001\265\020"
+	.string	"\226^lG\340\222*\035R\267E\243\370\004\022\005\345\305Us\300\205}\262\"\024Y"
+	.string	"\207\201Y\004\21652c0_)Fo-\363$\253\223\213:o\026"
+	.string	"e\030\235C\243x\330`\016*\3065!\006~\004\241c\021\331[\312\224\002V"
+	.string	"R"
+	.string	"Z"
+	.string	"3$\361\202\317\245\303\217m\177\305Y\260\354\\\fk\240\350D\354\345\366c\316\351\221>\352.\343\013t\227\033s\326\343*\313\377\314!\300\300||`\3531\3047*\320\301\351!"
+	.string	"t\211\243\030\211\3573\327\017\240K\325\363`\316i\375@\020\267\274\355\b\266Ml\265\020\f|[\006\016\237\021\227>Kw\3715\221\325"
+	.string	"\221i\321\035;l\351\322\354\307\2713[\325\241\207?H\325\236N\335I\265\214\352\270\352]\265\252\372\003"
+	.string	"\304\350"
+	.string	"\017\243\2313\266#d\342\2202J\330f\331\"j_\346-X\017YN`\316\231\215\233\0315\tj\335\202l\260\033!\335\035\271\\\273d\322\177&\275\266\265r\217{\241p\035F\007Q\355\263S\376\342d G\303iP\227\242\234\270z\373D\350\306\273F\267{\334\313\204Kw\374\325="
+	.ascii	"\003\243\3612\344\265 :7\2734\217\374{\301\226\303E\203\330N"
+	.ascii	"\335\205s\2379g\245\273T\2422\241PL\252\225\325I\312\t\203J\252"
+	.ascii	"\344\251\234PP^I\265\362J\0208\265\301\244\362VR)\225'\022\316"
+	.ascii	"\307\271\263\320\222Z\326\345\\h\033\310b\250\210K\233\341@f"
+	.ascii	"\223\202\207gm\t\307q\356\023@o\337\016\221v\013Z{\002\005\375"
+	.ascii	"\347Y\222\207m\331\267Y\215*\034wBR\013( P\002!c\322\016j\322"
+	.ascii	"\211\246\033lX\r\263n\353\276\211.u\310\211\221\200\016\301E"
+	.ascii	"}}hx\202A\355N?\351\372\032x\020\260\340`\323\\\220\016{\fnR"
+	.ascii	"hD\304\201\001(\fBvX\254\3410/\243\255\221\324\217\302\315\253"
+	.ascii	"q\t\017\243\177a\033\265\345 \314\337n\244\013\264\3364\245\350"
+	.ascii	"P"
+	.text
+	.section	.gnu.lto_config_streamer_finish.16.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"m\013"
+	.string	"\366\224LB \251*\035(\027H`"
+	.string	"\235\200\003\275\351wa\226\317\302\007m\250\005Z\251\3450A\030/M\370(Z\303\230\304\021\245\032Y\224\332\031\004\b\200m\204\f\222\301\350\262\300D\252\330\0053b\311\336{\247\0247"
+	.string	":"
+	.string	"8"
+	.string	"\273\333]\016\261\275\322;l\2573\345\341\351\224\241_\311X\240\214\324N\342\350\324\344\223A4\321\313\356\036\301\245\210X\222\262\222\331]\313\223Xr\327\333\276\260Ma\037#~\305\023\200\"\021\177r\260\213\252UX\b\265A"
+	.string	"\333\241m\261}i\377\365\003\341G\321\033vU\017\030\354\216\022\236\340^=r\266\375\002w\2056\215\216,\361a"
+	.string	"\200\220\330\204\022\344\356\216\246C\333\247\006,\202IR\260\355\361\004!nw+|\330\007\b\327z\365E\333\353\347<\211\265R\006^$Y\263\307\221\234+\373t\247\312\236\322\333\307\237J\031\336\355a\300MG\263\001A\237\f\016\316\206\347\363:\017G\323\351<\360\323a\"\374ul\300\016\364}`g\031\367\3666/\244Y\262\375\371\002\323\2669g2\027\235\253\330\025,\260\352LF \345\n\026"
+	.string	"\252\244\223i\021\206QZ"
+	.ascii	"\370\360\240\300\240\343*\032\004Q\204\301D\310\006\250\230\210"
+	.ascii	"\213\035\341\002\2320\\\023\217\264 E\231 \340\304$\325 R\370"
+	.ascii	"\024Uc\273J\031"
+	.text
+	.section	.gnu.lto_write_word.part.0.18.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`F\004\305\033"
+	.string	"\026s\260I\240XU:\302\237\026\360jp`\201\362/\026\206\344ISH\271\200\217\234\013Zy\2343\016!\364\030k\251&\357\371,:\320\242T\250\376\177\233'\306K9\366X&\017{b\213\0362mr:\244\343\330\326\022\262\311\226;\311\230"
+	.string	"\233"
+	.string	"\235"
+	.ascii	"\271\347\3001 l\022=;\347\356q\\\250{\016\234\003\350\366)\242"
+	.ascii	"\324-dpq\037\220\027WH\356\376F\256\3476\036\244\333\035R!\020"
+	.ascii	"p\374\t\365\206\234\272\333u\021\301\t\324\213\364\002\352Ev"
+	.ascii	"\261|*\374\212Swr\254\"\345\211\322\355sN\2163\027x\232\246\264"
+	.ascii	" q\342c\213\206\211W\332\352n\026\260G\033t7o\212)\240\211\323"
+	.ascii	"\351\003\2268\323\007#\234V\260\200;t\205\245\307\344J\237?\240"
+	.ascii	"\316\234\001\216\032g\272{\277C\361M}w\177v7\303.\245\020[&\377"
+	.ascii	",\243\336\354\263\373\241\2775\316}\251sYu\256\313\352E_U\235"
+	.ascii	"\233B\221\343\215\276\365I_\261\316\245u.\327\271\363:\376\027"
+	.ascii	"pAy\tv\363l\311\322,\304 2\236\364\033\375E\347\335\357\276G"
+	.ascii	"n\357\343GWZU\022\022\322\215\366\211V\357\034\251\230\201\301"
+	.ascii	"\350\307m\376\270\275y=\250^\224\025R,\220\027\213\326\201L\356"
+	.ascii	"D\270\355q \243;\021\016A\216\260y$0=\tr\352\026\302\\\334\t"
+	.ascii	"\244nWuq~\210\007\b\346\001\302@\253wv\274\220\231\363:\002U"
+	.ascii	"\305+\276i\032\302\013\246x\277\244f6\361Q\371\222R\303\036\306"
+	.ascii	"\376V/\246xZ\371\245\330\221\214\342yt\241W\036YDS\022\257\206"
+	.ascii	"\016\025)\213\374\247$\224U\274\243+\024\300\234\335_#\025\346"
+	.ascii	"\007\362#\264\001F\366\005\233\367\355\252\b\r%<\316Y\376\201"
+	.ascii	"*<D\314?\273<y\303\016\246\235\211e\367Db\n\200\272w\367\355"
+	.ascii	"\356\202\017\301\305<\351\356\b\303\013\231q\240\315\373h<\233"
+	.ascii	"\364\264\354v\370R\215\354n\b\373 !l{\030\027\3678\365\342\344"
+	.ascii	"\0245\202\2027\204v3\245L\006{\335\330\314d\250R&\203\275b\245"
+	.ascii	"\r\371a&\253\241\275p\266\022U\316hhn\033j\354\033\213)g5\330"
+	.ascii	"\254\274\261yq\240\321\324\330b\256\032\032\254\346\212\2256"
+	.ascii	"\256\230\004k\3630+]76[\351\232W:9\345)\306\b\363\027\376\355"
+	.ascii	"\356\013\357\314\216u\226\177\222\305M5\006\272\217\n}\255\272"
+	.ascii	"0\213\347\020/\250\343\304\205+\016\237\221\273;\247\262\317"
+	.ascii	"\236i\030\243\256\370\266\204\204\322\337\237\206\301:rn\t\211"
+	.ascii	"\266\270\362\357?\303`EqnI\210\212L\362\357\270\272\342\nM\337"
+	.ascii	"r\\T\250QH\203\030SDH&\030\tD(l\256\001\240\002\231\272u\003"
+	.ascii	"\021\200\265\2043\024\024\246\365\f\311\366,n\372\325\341\375"
+	.ascii	"2A\\\033\363\017\232\275\357A\207\253p\347[\356\331LI\374\036"
+	.ascii	"\343&\223R\020\323I*\246\036\215y\235;\001\373\263\354\211I,"
+	.ascii	"\024?\0064SH\305\233,\f\234\b\356\036\nr\303\177*\272E57\271"
+	.ascii	"\206%u8\"\005\003\226\n$nV_\275\233\217\315l\373\244\245\221"
+	.ascii	"\nM\255\026e\325Yhgg\325\302\245\377\213\204\370\230\231f.\222"
+	.ascii	"\035\"\007y\t\034\327\013\267\n\371\260a\262\227<\234\345p\210"
+	.ascii	"'<\300\322&\317@\343\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"\245\005"
+	.string	"\204\b(\001"
+	.string	""
+	.string	""
+	.string	"\002\022\177\021\200\200\200\200\001\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\t\f\301\204\f\177\022\206\237\370\301\006"
+	.string	""
+	.string	""
+	.string	"\002\n\177\023\004\272\220\202\002\013\177\024\r\177\025\360\372\2508\016\177\026\017\177\027\020\177\030\001\021\177\031\377\037"
+	.string	""
+	.string	"\200\220\200\003"
+	.string	"\t\310\217\364\031\001\204\001\003\002"
+	.string	"\001\001b\003\003\t\004\001$\003\005\002\244\262\235\334"
+	.string	"\001\202\006\003\007\t\320\360\372\250\001\001\344\001\003\007\002\242\006"
+	.string	"\021"
+	.ascii	"\270\214kEqE\374\212\205\236\3412\\\366\200vb\370\034\370.\225"
+	.ascii	"X&\020\006\374\330i\t\350\002!\340@\032\032A=\001"
+	.text
+	.section	.gnu.lto_.refs.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002\001\002"
+	.string	"\002\001\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1519dc7d7cd05f8e,"e",@progbits
+	.string	"(\265/\375`\351\r\325E"
+	.string	"\252x@\032EP\036R:\367\203\213\207\216vp\006Y,\314\206[\301b\b6h'\265\025\232=;\3030\365\376oz\201\337`\307\267\351\306\255\255\265\032\200\207\202\001`\302\024:\330*\353\330\305\020\341\341]\3266\266L\332\226)Z\001\233\001\227\001=\246\335\312Ld\231\273\313\371=\206_I\255\311t\032\003f\316^K\016\300\361\023Fl/\347\234\246\253m\326j__$\244\004B_\312l9\003\256\357\2647\232\213\234\017\f\355\324^'x\355\263>\323f\r\032\315\2274\374\347\222\345\261!\037\026\276>x}\221}_7"
+	.string	"v\031\245\267\031\002@\250\326\233\005\200"
+	.string	"3\222\005\257\277&\266\301t\2306;j1\357\267\271<\330|35\347W@\200\252\016\2735\274^\004\373.\373\002\262\254\341\003\330\367\021P@\037\001?\304>\310\336\255\213\200\007\262\307\354\332\004\200F]\004\034j-\177\213\365\330\327~N,i.\313\371%Z\243T\233]x\375\333E@\266\t"
+	.string	"\373\303\377?-\002\020\370\361\201\003\375\370\004]\324\337\036\376\267\270\201\037\223p BX\375/\346?\232\377j\377\321\376\303\335\371O\327\035\376\017`\240\347\007~\314\341\357`k\320\373\361\334\1779\377\345\376\317\271\360\307\024\376^\312p"
+	.ascii	"?\306\360w\204\277\037\374\355\340\357\005\177\027\375-\340o"
+	.ascii	"\341\337\001\376\247\375\267\363\277\316\377\276\377|\377\365"
+	.ascii	"\376\353\371\037g\305\177<\377\363\376\343\375W\361\377\356\177"
+	.ascii	"\335\377\261\377\n\376\257\375\017\366\365\365\365\375\270\304"
+	.ascii	"\217%\374\302\031\001n\034\234\225\275\356\2622Wn7,\257\221\234"
+	.ascii	"s\316n\331\334\2274\3702\263\233s\212\024\212*\347\271\234\225"
+	.ascii	"\301m\367\3159We\246\3339S\275\320\234\231R\027Z\322\206\253"
+	.ascii	"\202\346an.\261\230_\322 *\246\264*O\351\352\250\223\372%UB\003"
+	.ascii	"\206:\315\314\327\355i\236\363\202\262T\267\363\206T0-,\234\371"
+	.ascii	"\232i\315 {\314"
+	.string	"zO\363\031\345\2627\273Kbx\f\331\313P-\n\3023\"\317\034x}\363\375\315\247\3734\205\242\354\031\233\342\265\375(\275\377\004\225\234\351\210\203\327\356\353k\002\300\241\214s\346\2637&\b\017\210\037\027\257z\202qyD\312\360\362\250\005\320B\2453\006O\336\317J\013\236\263w,\350\371\004\223\336y\003\022K\363U\206\361\356\2029\266\354\340\341\325\216\320H\033\265\2749\366o\273\256\013\261\204+\343\265\016\202`\036\031\323L\232\226\3535\315\306\200\351D\261\205\215l\316\224K\227W\205\2029{\321\231\252yU\250\371Bh\253\272s%\256\351zN\313\351\271\246\323f-\327mo7\375\346\b\336\234\233=\366\367\226\177IC\313\265[\277\t\271o~.\325\251\272\263\327^\344\232\332jB\315\241\334\f\243\273CBB\200\204\304v\275O\222\b\255\375\206;N\303\275\337\032NP\263\337\326\234\227\335\017\204\272\037"
+	.ascii	"\250:Yz\001\256\3573\354;\f\213s\027\001\215\232\n\333l\272M"
+	.ascii	"\233}\255\327\276^\351Qa\303\353\033\214=\216\376\032\360\375"
+	.ascii	"\305\276\271\330/\001\270H?\355\350\316\272\246D\210\340\"\301"
+	.ascii	"\234\227Y\013\004\024\253\351\332f\215\t\027\327q\221*\013\306"
+	.ascii	"\211\232\346OH\220 x\353I\035\217!{B7\313\253,C\216\267\252\303"
+	.ascii	"91wE\360\212\205`\247\200\035t`vx\305Z\215'(N\217\314\234\326"
+	.ascii	"\003\272y\372\341\203\327\377\230\321G\361\0176g\250;\224\231"
+	.ascii	"ob\323\325JK\033\251\217\343\037+\025\\\030\037^q\217_\0305*"
+	.ascii	"\025\274b\036\315\2665\244\352\371\352\372\003\215X[\035\233"
+	.ascii	"\225\205\237ln/aZG,\2219\266\035\307O;\341\2365VN\354\304imW"
+	.ascii	"YkX&\276bb+`\316C\356+}B\261\213\227\307\3157\261\025\353f(\320"
+	.ascii	"\325\026-\350\321\217u\034[\275\032\2243\003\033W\326\226x\305"
+	.ascii	"9\260\223\025\243\3533\346\304UB\267\250\033VgH\326\347+\343"
+	.ascii	"\325\fSu\333\233Y\265'a=\360\372<\2757\234\256I{\342\365\270"
+	.ascii	"\f{,\306\376\370\007\346\314\003\300\233\241"
+	.string	"\314\2407\200\356\243\177\330\277\206\360\177\375MP\2223\2229<\254\224\263\345\026^\377\033\345\243\234]\250\223\352\345\0229\251\313\354\374\342\026%r\276\271\353@\246\032\311\316W\352\256R\027\34777\275\242\271)u\245\234o\206\346W\352\016\345ft\310\371.]'\325+\332N\2524J\224\233\331\315\315e\027\333\224F\235l\322\350\220\223\272\214:\233^\321\316\25747\234\264\327\313\245\312\324\3450\347\214\365N\335\240\234\227\320\034I\"T\223\221S\361\b\303\250<N\r\017e\001\306\321\230l\225IE\247\251\250\246\2431)\251\234J2\020\0255u<\"\217@-\023\220\0062\t\325\"\217@O\304b\324\332\026\2252\2122\200PJ\343\321\370\004\245\234\212zRN\265\304Vi Il\225E\255\361h, \274`\241M\022\245,8%\2214\230\212\2551I\203\350M\306d\361X\204\301>\303\206\n\033:\324"
+	.string	"z\023\261%\226\220\201LJ\025\213\302\226i\tC\206\rl\033\205D\216`\002\340T\214\321\204\214:N\261J\242\226)\331J\005\225\312b\322\311\211\bT\274aT\256\207\222p\244T1\231\324\"\221\311\244"
+	.string	"-S\207\366h\234\002z\321-SQ\312F\313t\204a\214\"21E\270\222\022\t#\026)N\260M\026\222E\031\304b\262U2\3010>\035\221MIG#QFRSR\231d!\002\215N\026\237\236\246^"
+	.ascii	"[\"N&\213?14\374\326\206\305\314\222\326nW\212L1\026|\205ms\266"
+	.ascii	"\354\201\255\260f\256\356\360\3725H\025\253\256\035dpT\244\b"
+	.ascii	"\271q\351[\202W|\344x\311\021,\345\027\027\004u\311\362\023\350"
+	.ascii	"lM\034\350^vj\035\r\357\340\224\261\205\035K9\216\262\244\341"
+	.ascii	"uW\252\304A\271\220V\033\332\335\023<\375\203B)G\250V\366\330"
+	.ascii	"W \003\022\215\342\025;y\035\236R\207\205\207W\334\344U-\271"
+	.ascii	"\275$`n\276\336\230\230\211\020Z\225\331\032\036\213\223\034"
+	.ascii	"+\371\203A4\256#^t\354\217\221\374A 1q"
+	.string	"[S8\366\277\266\257\257%S\245\037`z`\272\272\002\201\025\250\241(f\024DFdHFD\222\244\351a\005\204((\251\363\022\200\0265\222\031hDFh\222\322^\007[\005\006;\200\271\231\370I\2679\321\rBP\301k\270\020\243<\2342\225\201+\f$\350\311\233\221\264w\250V\2234C\353\b\273\244\261i\271\022\003\340\365\267f\305\257\351\237,k\033\003\036\376\001Zl\273\304\235\025\036\237\341i\224\246.\212\355obiV\306\226\030\234\003\230\221\207\273\345\0077\307\354d\"\f\026\305:\276:2\004 \266\266\217\317`\260+\225\3208\322\334\274\350\027\353G\264d\246\264\01377\300=\t9\320\305\231\026\364\264\227\221\223tvL\033\f\t\347\235\351m\267\274\314\351\243\303\002\210\032\261\267H\245\260\362\331\204\357\333\356\345\310;\261@g0\004.f\245\264\227\251\316\246\356\260i\244\035=W\306o\227\305"
+	.string	"\340V\370/n0hyr\365\347\244e{j\330)\\\375\237'\303\021\007\241\203\330\245\204\366\215G\234s\230\2712\310\245\321\370\323J\371o\344\371\373\204N\241\360\177(\017\371\214F\346Ca\265I\331"
+	.ascii	"[\376"
+	.string	"\310\365\234\224tS\356\344cf\r\263:\214{h;\366\242\306:\313\311\220"
+	.ascii	"@\365\301w \330&\242\227\363Y\027\200\032\002\002*\205\262\376"
+	.ascii	"\007\231\327\3512=fz\025:G\370\"x\231\340\337\217+\214b\017z"
+	.ascii	"\006h:\376\211\303\225\026\036tB\324\327\377\006\3505$\307\244"
+	.ascii	"\353Cw\215\352\206\026P\227tW\230\345B\be\362E\222\\\277\351"
+	.ascii	"\230\354!4S\355\336\257\215t\247!e\301\025\003ud@\"v\371\274"
+	.ascii	"H.\317\024\331\207|\217\362\357\211s\346\234\340\037{\277\301"
+	.ascii	">\354\265\214\337\024\2417\243\311\340xC\257c\355Q\375s\360I"
+	.ascii	"\240\335\351\217\270\006\306o\f\220\354\201\314G\340\327\t\350"
+	.ascii	"\213\315\251\263v$z+z\351\332\203\276\253o\\\216.\375A\373\356"
+	.ascii	"\314\254\275\377\036\035-\356\365\274_\377\341\307\374\255\360"
+	.ascii	"\001\\\227Y\320!K0\263*\0275Q\003"
+	.text
+	.section	.gnu.lto_.symtab.1519dc7d7cd05f8e,"e",@progbits
+	.string	"eepromData"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1519dc7d7cd05f8e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,538 @@
+	.file	"feature.c"
+	.section	.gnu.lto_.profile.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375 \250\265\003"
+	.string	"\264\005\234"
+	.string	"\r"
+	.string	"\227\247\344\313\017\004\002"
+	.string	"\002\001\002"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\203\313\255\261\f\002\004\312\251\326\231\r\001\005\335\374\335\212\013\b\002"
+	.string	"\006\364\327\362\364\r\007\347\364\313\323\006\004\b\306\272\236\261\001\t\222\200\241\200\n\217\204\314\271\002\013\255\363\313\362\b\f\240\342\234\212\n"
+	.string	"\n"
+	.ascii	"Z\030Zf)\2000:g\345\360\305\321q\211\2423\314\224\3336\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375 BE\001"
+	.string	"\2706"
+	.string	"\b"
+	.string	""
+	.string	"\001\003\001\003\004\005\001\006\007\b\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\007"
+	.ascii	"`\b\030\027\f\202\313T\246\311\fp\003m"
+	.text
+	.section	.gnu.lto_.inline.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\305\003"
+	.string	"\002\005\017\027\260%\351\fE\223\202QJ#j \222$l\264\021B6![\356\024\377\374B\366A\227\254l\312\377\230\240\261.@\333\340KBq&\303.`\377\234\367h\360+\261m\311\233k\b\030"
+	.string	"Q9\260\203\212\305\272\020X\006Bp\301\260\325` \031\341&\b\354\224\254\300\260>j5\200\007\307\2260\261\205v"
+	.ascii	"\362\3000\300\344(\2743\033gA\302\245U\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375 BM\001"
+	.string	"\3206"
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	"\003\001\001\003\177\002\003\004\005\006\007\b\t\001\001\003\177\002\003"
+	.string	"\006"
+	.ascii	"`\b\030\007\006\003C\250\214\264\001,"
+	.text
+	.section	.gnu.lto_.pureconst.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\003\204\004\004\204\004\005\232\004\006\232\004\007"
+	.ascii	"\232\004\b\232\004\t\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375 \312]\002"
+	.string	"\224\002\276"
+	.string	"\b"
+	.string	"\001\002\004"
+	.string	"\001\002\003\001"
+	.string	""
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\003\001\300\007"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\006\007\b\t\004"
+	.string	""
+	.string	"\016"
+	.ascii	"\2202\005\003`\035X\030X\244\347:`\204\244\216NE\302Mb\324\274"
+	.ascii	"c\027\037\004\274\001,"
+	.text
+	.section	.gnu.lto_.lto.8ed2be0314e253ef,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureConfig_Registry.18.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375 \236\255\004"
+	.string	"t\bh"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\244\354\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\376\006us\250\326\006uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\023?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/config/feature.c"
+	.string	"\004"
+	.string	"\237\n\013&q\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_featureConfig.20.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001\200\211\201\202\003?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_featureInit.22.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"E\007"
+	.string	"\022\01635`m\322\001@\337\r\024\260u\234\367\262\200)\306\220<@\r\325\212\224P\227\f\3271\320\266\327b\241\205\201\240\362\b\002Aq\321\227\360\354\360\244\377H6\221;\245\306\256Lr6\224\254\002\031,\025L\304 \306B\271@Lj\340e\340\330\220I\270\211QB\213\264\235Z\005\275\r\323\246\036_\375\217\203\\\374\220c&S\375ii\226Xs\017N\300nD\202\337\361\221\203\037\372\363C\307}\376\371\235\352\357\272\200!\032m\356d\223<N-\354S\273\273V\220}\347S\226\006A\310.\305\351dMO$\303\366-k6I\201\304\300\310D\311dw\241^\\\273\323\374s\\`~ \356"
+	.string	"\024v\327n~*n\275\355\003\333\b\266E\001\t"
+	.ascii	"3\241{\037x\305\\\366Tr\210\252\301\273\340\177\0317\\\216E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_featureIsEnabled.25.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\235\b"
+	.string	"FQ>90\345(\035\3003\004\027\f\232\0275i\250.vx\244FB\037\360h\003\177\344m\375,\017\255\001\004\333\234#A\204\202\202\002\210\"x\270\212t\033\004iKH\223M\244L)-"
+	.string	"/"
+	.string	"*"
+	.string	"\207\266\335\340\360yt@\241-"
+	.string	"N#/\273\254\250\032\037=G\376?\256\340\302\202J\221\236\001\017\273\353D\245,n\275\355\004\333\321vJNM\037\033@1P\331\255h\005\330\025h\302a\373\2633\2663\355w\334\343\373j\302\230\335\013\222\222]\021\006/\b\034j^\200\035^'\300\002\331\362\245\327\324\237T\246\203<\304\3637\034\022\345Q\207\276\b;\274bT\245l\331,Rj\206\375kw\327\212a\370\325\177i\006\021^\346\271\254m\266.\004\3126N\204\350p>\234\026?\235\314\023\265\316\213\033\004s\022[\027A\034\327\305\fko\250\232\222\232\354{X*\324\237NL\001\b"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313\250@\215o\342\020\246"
+	.ascii	"sM2"
+	.text
+	.section	.gnu.lto_featureIsConfigured.26.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\r\t"
+	.string	"v\322A:0\345(\035\200\213\0073\177\025(\027jhe\re\203E\232X\t\236\255o@\206\001?\364o\006m\007\005\333\234kz\035\f\f\bai/JY\235\207\256\334-#\233H\231R0"
+	.string	"1"
+	.string	"/"
+	.string	"\004\332\241m34\244\254\372\327\321z\206\307B\021\260\373E\345\270\352\251\362?r\b\362\202\361\\\024O\201\207\335uz.\213[o;\301v\264\r \260?\323tj\372\232v\361b\320\262\333\212\rX\027\250\362a;eklg\332\017\271H\3520\224\007v1XRvO\026\254\2209\334\274@;\314\036zM\205\001X\257\316\0237Aev+\034|\222\227\220|\217C\233Ny\357\320?i\207W\204\030\330*c\366\327\245n\330\317vw\255\032\206\017\021\244\216(\263\207\363\341L\245\316\007\024!B\240\321\346\211\243PG\024=\034)r\016\274I|\270X\3326.j\276\325\ru\263\322\316\376\246\245B=k\245\313\230\263\b"
+	.ascii	"2\003\3020\275\341\310\241\262\272\313(E\215\177\350\020\306"
+	.ascii	"tM2"
+	.text
+	.section	.gnu.lto_featureEnableImmediate.27.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"5\013"
+	.string	"\366\023IA \251*\035X0\260\\\340"
+	.string	"\006\346\240\207a9\374\205\265\023\300\300H\201\373\234\200\200(\r\220@\013\375\f/\005\024\225l\204l\271+\004(\022\t\" \366\250;\220\201"
+	.string	"\200@\2031\262\211\334)\0053"
+	.string	"7"
+	.string	"5"
+	.string	"\216X\270|\370e\273\324\316\260]\372\263\033<4\331\273BN\002 \354\356\324\222\177\217\237\177\326- j\343Qabw\035A\224\307\255\267\ra{\332\027\005\326\276\372U\243\243eSY\320\200`\267c&a\025\310\003\252\327\r\200<\300[\244\207\256\210q\2276\311\346.#g\373\321\376\312\001|_i\330\262+\222@\266\373\222\b\251M\013\034| Uu\323O8}\230>\340\0042\374\023\203D\361\340h\273\224\372\326/*\027\003X\252\024gvh\212Jb_\333\335\265\216\330\032\275i\264\324\030\027\240\214G\263\006\263\361D\241\314\2063-:\234O\247\231\237N\30635\036hb\034\334al\274\031\352:ora\351\254S\244\310\"8(\251\311\232\306T\243j\260n\024\365\257\037\205#\033"
+	.ascii	"2\003\302\360\317\302\"\233x\0208\251\314\002\327$T\200\270\340"
+	.ascii	"\360P}z.\202\225%\305\356*\233\223\232\002\007\333\3125 \204"
+	.ascii	"\b\020. #g\022\240V\256`\211X\265\002N\362\342\232d"
+	.text
+	.section	.gnu.lto_featureDisableImmediate.28.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"}\013"
+	.string	"\266\024K?0O\224\016\254x\201#C\343\253\252\006\037x\230\033y\223\221\344\025\2765\260\t\306\003\035\017\264\212\265\031\264\035Vls\256\351u\310E\262j\300\016\375A! \206E4\023YD\310&R\246\0246"
+	.string	"8"
+	.string	"7"
+	.string	"{\n`"
+	.string	"\031\207\036\217\\\207\3267\256Cs\366\212\177\023\366\035(\200<\270\330\335\250\022\316=9\377\245C\274\220\202'&`w\235^\310\301\255\267\375a;\332_\020\232\206\232\266N\372U\323\251q\231H\301Qb\267\301\n\306\242\200#.\234NBt\0167y\376\231\200*;\264=vv\230\231\355\247}\r\337\300\235\224\300\220\335\007'R\033^\213K\241b\372\030 Q\227+\253^\232*\320?\034\004\002\277\2025\234\274\327\271\016\241\336\364H\206N\005j\364\311\225\375u\251\021\354[\273\273V\b\266\2461M_\001\0064\023\214e\212\244\262q6\223\212%\026\270X2\032%f.\023L\244l\232(\351\260v\240\262\305\215\246m1\373>/}"
+	.string	"\206\324\013\026\037\355l\251\210T\013\245uR\177\372-0\030a\032\342\001\033"
+	.string	"2\003\302\360\322\302\242\233x\0208\251\314\202\234$("
+	.string	"\273\240\341\241\344\364\f\004\001\253\312\356\020\354\235t\024:\204\226\256\001!D\200p\001\0319\223"
+	.ascii	"\265r\005K\304\252\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_featureConfigSet.29.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\245\t"
+	.string	"\206RC<0\345(\035\200\277\236\277fl2\035.\235R\271\377\006\336\206,\005\006\216\025_,]\345\360\2060V@\333A\3016\347\232^\207\226d\243\241\302p\207\032\346\txb6\310&r\247\024."
+	.string	"3"
+	.string	"/"
+	.string	"\327l\227\332\r\266K\1776\314\303\217\375k$\025\013\260\273S=\376=~\376[\317\200*\213\307\201\206\335u\004U\030\267\336\266\202\355i\277 \003\\\016Xv/f\004\266E\252\254|\223\273L\017\375\260\"\262\273\334\245m\262\271\313s\266\037\355\223\274\344;\253\302\231\335\215\024\331.\214\301\013\004\227\t\001\251\f\324a\217M\370 \036\225\342\301K\237b\273\214z\3275\253\327\013\212\306)\316\354\020\025\265\303\276\266\273k\345\2605Z;\353W\215\216\333\026\021#NHsg\343\361J$\216\3473!@\037Q\327\231\"\020'4;\336hn\020\334Ix\274I\352:or\341\351\255;\204\310\004\304\234\024eMO\016\002P\215\252\351\013\004\016"
+	.ascii	"2\003\302p\036aYL<\bXR\354\256\262\211\244\254\256\313h\246\342"
+	.ascii	"\001*\004\261:\r\256\345\2050\311"
+	.text
+	.section	.gnu.lto_featureConfigClear.30.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\375\t"
+	.string	"f\323E=@\305(\035\340\265^\254\253\273T\007\230\200\373$\246\375\007kL`%\344\246\334e3\324O\305\327\240W]{\230\262\341\304_\371a\r\005\2149\017\261la\314\365!\026\255m\"wJ\0012"
+	.string	"4"
+	.string	"1"
+	.string	"\004\227\006\337`.\265\027`.\355\331\001\036r\354KNT1\002\273;u\343\336\243\347\337u\r\270\242x\314,\354\256#\270\262\270\365\266\021lO\373\007\001W\215\216\231\f\313\205\303\262[13\260-2\305\303'\371\013\365\320\r/ \273\273]\332({\273\374f\373\321\276\310G\274\267&\254\331\305X\221\355\302\024\234\020_\234YU\323\250\242:\354\261\b\277\303\245S<x\351K`.\243\376\365\315\307\007"
+	.string	"\205\225\2123;\374\242j\330\327vw\255\031\266FK\215\326\336z\017%\317H\363\247\003\352N&\017(4\035D!\022\367\231$\221g4?]iv8\346 @\3354q\\7\2670u\327\031Bd\005\004\244\364\263T\223\203\0034\215*\365\007T\027\001\016"
+	.ascii	"2\003\302p\301\3022\231x\020\260\252\354\016\301^$5t\270\314"
+	.ascii	"f*\036\240B\020\253\323\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_featureConfigReplace.31.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"=\b"
+	.string	"\006\220;9@o\323\001x\255\301\216\223\371bl \306zc )\020\177\214u\004\206\266%\267\201x\226\275\255\224\332\264\fB\216c@\364\213\035\f:\030\337\006\006df\277\355\275wJ\001("
+	.string	"-"
+	.string	")"
+	.string	"\324\236\355\362\020c\237J\211\030y\331\335*/\356=z\376?\276\001M\020\217\031\204\335u\004M\023\267\274m\002\333\3256IG\375qf6V8(\273\022\253\230U\321\023\215\313\366\243\375\216{xG=x\263[\241R\262+b\340\002\315\351\300\003\254\323y"
+	.string	"\353\001\356\236\032qXv\367\300\007yH\203\237qj\007R<x\352\223\254\323\313\244\005\206\342\213+;,Eia\177\356\356Z\236\354\013\035\006\232\316:\0327\022a\232\247*|<\241-\253\241\017\006\252\031\327\325\216\2007\006\215\253\242m\343\352\025~\237+ON\340P}\262\344(\035\b"
+	.ascii	"2\241\231/\360\342\002,\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"%\004"
+	.string	"\224\006\b\001"
+	.string	""
+	.string	""
+	.string	"\002\026\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\005\017\007\301\204\005\025\b\300\003\002\031\177\t\002\032\177\n\033\177\013\034\177\f\035\177\r\036\177\016\037\177\017\005\024\020\305\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\022\021gistry"
+	.string	""
+	.string	"\005\020\022\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\345\334\006\240\035\370\034\370\034\370\034\370\334\316/7E\232"
+	.ascii	"\205\211\310\252\236"
+	.text
+	.section	.gnu.lto_.refs.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375 a\345\001"
+	.string	"R\304\n\020\260'\215\001\f\3030\221\231YK\366\2262\245\024\t&\354\003I\r\b8\031n\330\3045c\032\333\\\242b\306<\2617\255\253B\005"
+	.ascii	"?\t\001#\2519*%\260\tf\023"
+	.text
+	.section	.gnu.lto_.decls.8ed2be0314e253ef,"e",@progbits
+	.string	"(\265/\375`h\016\275I"
+	.string	"z\201\034\034TP\324\345\244\003\372q \367\214|\bzF8\032P'\246}\216\020;S\277\364\327I\240\226\217\244\261{\211\023\266\352G\252\315Z\024#\202\035[-\303\376e\224\\\224v\013"
+	.ascii	"\360*5\001\360A\200\337\272R\273\223\370\212\307\243\361x\350"
+	.ascii	"\207BK\236\330\266R\246x\001\252\001\264\0011\335\277a\237d|"
+	.ascii	"\324JiG\035\244\367H\004e\352\356\356S\353l\311\210C\201}\024"
+	.ascii	"B\031q\024u\237\365\021\215sO\264\273s4\360\334\356\"t\330\r"
+	.ascii	"4\222P4nY\216a\313t\360g\004\\2\306\024\001\2159\032*i\211\302"
+	.ascii	"t\311\250\003\226\225>5\020=\367\251\317\224\206ez\242\275Rd"
+	.ascii	"\322\246\242\021W\257\026\244\016>\024!B\003(\006\321BWV\271"
+	.ascii	"\025\345\270\203\353\277\\\253\305\004\006\304\030\327/\360\353"
+	.ascii	"|\265\026\335,\027:\272\225\202\024p\216\025\201Y\351F\277\351"
+	.ascii	"j\355\221\212v\313h!\263d\324\301U\353m\224[\265V\233\342,\326"
+	.ascii	"\227j\215\034\027D;\355FipfR\200hq}\003\345\367\352,\254\232"
+	.ascii	"\201\003P~qH\232\305!\317%\214]A\326\265!\267\310N\341\330\204"
+	.ascii	"F\306\326\352FU\310La\006\214\342ztW\220\345\332\220X]Gd\200"
+	.ascii	"V\304\005\345\277`\031\230y\355\005[G\334\277U7.\377\n\361\233"
+	.ascii	"\227\177k\370\257\365\357\376\347\237o\3772\360\357\003\377:"
+	.ascii	"\360o\215\177\025\370\227\306\277\r\374\013\201\215\177\007\370"
+	.ascii	"W\347\337\004\226\202\3775?\023\375;\301\277\021\374\313\377"
+	.ascii	"\241\374G\373\177\366\337\354\177\331\377\343\377\261\377L\376"
+	.ascii	"/\371\237\344?\326\177\257\377]\377\271\376o\375\237\372o\363"
+	.ascii	"?\354?\314\332\332\332\332\277Y~v\341\177\361\n=E\205\206\261"
+	.ascii	"\373\267Th\262t\377hvc\354\306\250RKN\\d\275\r\251|\332\256 "
+	.ascii	"g\326\206\\(t\276i6\344\260H\303NZaa\\ex\013\024(G\300\240E\031"
+	.ascii	"\201:\201\206\306\365\002\266\345\343\210\311\331\231\324\223"
+	.ascii	"N-*\30523\333\262\262{x\3264\320\t\016OjUeK\f!#\3332\t\256z\244"
+	.ascii	"\221;\2108(Y'\337\262\352\304\210\331\031W\236\341x\3341\234"
+	.ascii	"\023\026v E\271T\311R\342\304\365\374k\322d\307phW\304\264R2"
+	.ascii	"\256;\266b2jXG*\256+\306\033\266I|\305\026\211\230 \272b\265"
+	.ascii	"\373\267\033cf7\306\255\210!\277+\262~\263\224W\333,r\314\205"
+	.ascii	",W\2360a\262Y\032X\220\344+\255\207H\016\3706Y\222\356\222\375"
+	.ascii	"\262q\016\313,)\255\264\036\026\017\230\321A\252\210\fW\345\227"
+	.ascii	"\210E\362\005K\027l\223l\367\257\213m\203\322d\007\222\225.\026"
+	.ascii	"qb\254\206L_j\337$\277\002\f<JL\367Tw\273\270\221A\355\300\305"
+	.ascii	"\365\353\243\374\377%\273_\270\241=\004\306\220\377~o\2738\277"
+	.ascii	"\314\332\326\200\377\265\373\277m\005Sw\feSJ\037\210\370\375"
+	.ascii	"\340\372\037F\343t\237Ca\252t\252\020\246\277\026b\035\211*\204"
+	.ascii	"h'\261\350\224\251\205\250\361\254\306\223\033\355\240\022\261"
+	.ascii	"\203\306s'D{\330\250\361\254\351 \261F\210\376Na\252D\\aj$\252"
+	.ascii	"\350`\237\035\374%\225A#Q(f$\326\b\323\037Q\030T\"n\243\306\336"
+	.ascii	"%\224\240JgQ\247?\231\3566B\237\316,\305D8\b\366\201\177\340"
+	.ascii	"\250M\031\212\205\234\207L|\013\364k\204\241\230\006^\332\243"
+	.ascii	"\020\033SN\310h!\203fJ\221#<jj\f\177\302\005P\250\001U\224\264"
+	.ascii	"n\364\211{\330\224yx\013\264y\340\034\330i\217E\264_\200\361"
+	.ascii	"J3+\312\030@\206\214\024eg?H\247\035f\206@o\220\302\225\207\270"
+	.ascii	"\024y\204\255\020\325\264)\353P\252E\201a\341z\265?\001cD\016"
+	.ascii	"K?\224\257N\345\253\222\r%\023i@\306\220\312\327b\371J,\331\310"
+	.ascii	"I\233\336\260\322\031\b\007\371\355\2076\312MZ\266\256\270\276"
+	.ascii	"\n\313\357\ri[[\333\033\362\025X\326`)o\243R\376\354\243\307"
+	.ascii	"-Eb\312\030\367\340\";I\302\b\310\225e\340\0316}\301<d\266\020"
+	.ascii	"\331\202%J\371}A\356\332\276 oC+k\326\206\204\201\2636$\033q"
+	.ascii	"\0134RHl\350:\352 \007%\272\270V\336\301aNOG,\314\234\355\260"
+	.ascii	"U\245\343\326\2656\245\007W\026\226E6\261\233\027 _4\374\340"
+	.ascii	"z\026\376\013\005\347HaMK\025\256?\333\025$\257\240s.\202\031"
+	.ascii	"c\222f\204k\214\r\253\374\022\331\215r>\243\360\217;X\205\022"
+	.ascii	"G\340\032\"\035P\315"
+	.string	"\252x\361@q3\b\321\322\304u\265\354\032\367\217\303)1r\202$D\371\335\362\"\204l\310\017\\y_\004\271Xp.S\303\340VT\371\235b\257\3748\233\0261%:\270\336\366T~\255\374\307\251\360$\211\b\327\255R\026\331\222nphVO4q\375V\3717\212\225b\251\220\320,\330\350G\021\n\256;e\325\276TV\212\355\264\n\274\234\t\024\3433?x!\332\t\335\3309\216\031>\273\034\237\235\r\217n\b\003\237\331\203\321\231\300\267\336N\214oG\347\263\273\351|v6\034>\037\235\tD\372vj\350\230)\374\364j\257g\362zzr.D;!\236\352\333q\300\205\347\333\331.C\304\363\365~|L\017vt>?@9\227\036\2637TuB?>\036\263\347\362\234/\327\303\333\361\331\315\230\341\345p\360\324\035\323\227\003\332\005\231 \370\314\236\351\201\317\356\205\311\223\003\332\231\036\360r&\320\r"
+	.string	"|\346\0075\275\037\013X\230\276\334O\217\031\024\264\201"
+	.string	"=&o\310\006HH\250\202\235\333\005\275\232\023z9\016\314\240\037\237n\210\007@\220\351\353\021}\020\300y|?\272\r`\316\363\3033u\246Oy\0325\020\250\341"
+	.ascii	"\n.\276\343pq\241\235\311\313\361\t\t\361r`z;7h|;\n,\340\323"
+	.ascii	"\375\f\225\327\321\271\001#\204\0162(yf\230\220\343\363c\202"
+	.ascii	"N\210'G\367\223\013\312\341\341\365rf\020\3203yC\276\234\211"
+	.ascii	"A\217\tTBNg\322\374\310\021\306*\317\036\332\272\203\240=\335"
+	.ascii	"\200l\305V\214\265=\374u1\002\251$\322\2728\304\3719=c\035\267"
+	.ascii	"\245\013\245\201+_m\326\no0\236\333%BY\323\025+U\373UY\030\342"
+	.ascii	"\210\007\243?\033\021Z\246\340b*\246\332/\356`M\007\227\236 "
+	.ascii	"!\255\254\254,a\202\203g\0276\345 O\301\350b\025z\316Di\355\n"
+	.ascii	"eH\234\340Z\004\r\272\374\2320;\242I\371\235\212\201}PA\201\341"
+	.ascii	"\307\223\032\370\006 \224\330\251_\007\211{L\241-\360\363\013"
+	.ascii	"P\214\003\363\260\307bM\007\277\254\244q\220_\207\241\230\211"
+	.ascii	"\213{,F u\006D\201\023\250\221@g\0244\"2\"\"\222$I:!\005\204"
+	.ascii	"(\t-4\017\021p\241\243jF$I\n*Y\016\201\2570\226\b\032d\235O\250"
+	.ascii	"\360\311\257\206\255\003\006N\377\224Z\221\2561\020k~\353`\340"
+	.ascii	"B\266\276\206\035\204\344\251\364\f\246F\330x$\033R\252\202\r"
+	.ascii	"t\212\036G\005\032P}\005\312\n\263\337\374\3757)\270s\323|\320"
+	.ascii	"\244\231nI\367\337\240\365\005fg\316\035s\"j\017\372s\322Js{"
+	.ascii	"!$ael\226\002\314?&\372\254\3350\007\263\177\320ezQ\326\306\261"
+	.ascii	"\202y\322\316!\324\271\006\324n2\341\037\315t:,\266\026.\372"
+	.ascii	"\205\355c\034]b\017\3316\305Q"
+	.string	"\241\263\260\230k\224\346\356\221\257\232gV\314q\363~Y\002\341\256h:=\001Q\355"
+	.string	"\230\256X\016\251u\246\001\033\2310\333\250\244\004\211<\314\323\213\261\271\267\022\334\356\005\264\321\350.\225/m"
+	.string	"4\022\023\230AQ\017)O\222\212\262\345\004!m$\231As\375Vx\334\035n\232\002\354e\222S?\327"
+	.string	"8E\235\216\361\263o$\311\347&n\276\233\373\315\331\207Go\024\211\363\006O\376\315\303\204\032n\346\260\256\306\201hq\263\317\341\315\326\236\2529lTasU<v\230\270/\311\303\020\326A\313\222G@m\177<\256\221\231,\214\212\237\032\370JZ\345\003E$\345\034\242\231U\350#u\227\025\247'\336\312\313\t\372\323\375RI02KP\034\371\230"
+	.string	"\362]\267\013O\234\315\t:V\342c\276\243\373\005NL5\211,\302\311\3219\002\003\200\376q\"&\216\004X\231\373\233\264\343\245*\313\377\212\373\373\231@\342\3141z\024\304\310\037\205\206\257\033\002I\017\311\n@v\226:\221\221M\310\246\330tP\271\351\337Jf+m,\374@>8\257\034l\016\366\344\360\372\026c\317\317)\032\330U^u`\260R\230y\230\260\217\351\001\344S\234"
+	.ascii	"\233\305\370>I~'~\002\013\347\364\247\362b\f/Np\013x\021\026"
+	.ascii	"\003\236\335\325%\3275\327\223\030\311\273\034U"
+	.text
+	.section	.gnu.lto_.symtab.8ed2be0314e253ef,"e",@progbits
+	.string	"featureInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322"
+	.string	""
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.string	"featureIsConfigured"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"featureEnableImmediate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"featureDisableImmediate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"featureConfigSet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"featureConfigClear"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"featureConfigReplace"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_featureConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"featureConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8ed2be0314e253ef,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
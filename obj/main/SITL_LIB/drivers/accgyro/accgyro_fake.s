@@ -0,0 +1,627 @@
+	.file	"accgyro_fake.c"
+	.section	.gnu.lto_.profile.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\305\006"
+	.string	"2\013)1`M\323\0300$\024J\3604p\354\220\315\026\374\232\275\2627\323\360\247\237\037\r\r\202 \b\202\00622@-5\353&\264\324h\223\275WZK{\007o\247\336\247w\351\270\022\034\3056\331\241\234\224D\333F\250\217\376\372C\377\363\224\016\231\00665\316u\"\204\030XH\013$tDD\025z>N\247\363\346ye;\256\341r\206\026\307\200\bm\342\362\370\016\257"
+	.string	"\030\2015\207\030\332\303&\343o&V(T\027\313,/\377\006\bD\266\274'<>2\246\005\013\035\003|\370\373\035\237\222\352\340z\224\007\003\002\025"
+	.ascii	" \2044\223\376\262\247\205\035r;G\210\002w\251\306\216 \b\200"
+	.ascii	"\314*\227\201!\303T\230U\327\265\342\013\230\341lw'\250\2357"
+	.ascii	"\354,(\200\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375 \260\r\003"
+	.string	"t\003\244"
+	.string	"\r"
+	.string	"\001\001\002\002"
+	.string	"\b"
+	.string	"\007\003\003\005\003\007\001\001\200\004"
+	.string	""
+	.string	"\002\b\n\001\001\002\023\002\001D\001\001\b\001\006\n\013\017|\020\004\001\021\022\023\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\021"
+	.string	"A\275X1\0070\001\347\330\002\013\301aC\215|\025"
+	.ascii	"\030\330\317\374q\016\016\006U.\2539m\027\373%\214\r`\001"
+	.text
+	.section	.gnu.lto_.inline.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`\"\002=\013"
+	.string	"\342\31754P\215\322\030$S\004\321\212\352\365>\304\334$\366\002\007 T`\016\337\320\241\240\224\250\"\n5B\255\242\334\231\231\231i\240\261\375c\371\266\021B\b\331R\312\024\377\232\345\233_\263\275|\344t\003~\313\321\205\003\b\263i\225\022\024\247\210\2013\027\352B\345\210\310($\033"
+	.string	"\347|\364\367\332{\006iJ\221t\330\321\222)u\262X\031\221\"\007jI(\345\204`\313\303\256N\354u\277N\307\002k\223\t\347\350\321\tQ\b%\273\302\345\316%\311\223\335\356V\306\346|\360\277\250\007\204\005\bF7\03040\264/\217\226:*>4\b\331"
+	.string	"z0\271\\u2\365\255\377*\354\356\302\270\345\371~\347A\342yn\327wtwW\337\231\f}\2238\216\\\222v\327zm\025\b< `\002!R\225<\210\\\270\352R\360\2747\"\230\206\323\334=\203\214/:\252\t\227\030\020\023\254-\326rx\200\"\242\310#\027\203\304\254qX\007\353\230h\005q}\307\005\264\027\003H\232[\260\232\270\002\033\350\bdA`\260%\213\313nK3\300\333\375\363a\023bz\250\200j\016\314e1\017\214\301A\351\356\235\306\006\260k\260?\332x\334\r\3161\242\025\354\354\204p[\335\343j\232r\305\220;\274\334\342\253\322\367(\001\273\257"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\255\004"
+	.string	"\202\207\026\036\240'\351\304\177\354_lZu\376\277\222\375\252*\250\252\213\366\377\267\026\337\211\335\233\020\231d\254\236\371B\021:\240\331\342\025\337\212\275b\235\b3\364\332\373\361\177\004MR\203\223a=q\214$\2201U7\037(D^\317\302\3172\347\235\002ZeR\331\222\337\266g\236\b?\004\030"
+	.ascii	"P\304\032\n\341bk\033\371\032;\211\tf\206\341\345Hja(\3500\205"
+	.ascii	"y\327 \003%@\230\n\250)\023\340\323\252\005\020.\230\234P\"\200"
+	.ascii	"i*\327\324lW\003n"
+	.text
+	.section	.gnu.lto_.pureconst.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\232\004\002\200\004\003\230\004\005\230\004\007\230\004\b\232"
+	.ascii	"\004\n\231\004\013\232\004\017\231\004\020\232\004\021\232\004"
+	.ascii	"\022\232\004\023\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"\205\006"
+	.string	"\202\b\033%\2205I\007\377\340\273\317\207RuG\215=\327\335\335\335I\025w\231\375\377\357\267\277\333Zz\354\330\366\033!R\246\0371\222~\364sT\375470-\303\307{^\bR\327`\304\350\267\350\367\255\350*,"
+	.ascii	"\004\n\036\302\250\210S\263%\351\017\235\362D\031@\373\227\021"
+	.ascii	"\245\242\224\253Nf\3144[\336v3F\232\363\246\374P>\230\223- \200"
+	.ascii	"\002)+;$M\245\203\370\354\336\306\350D\312\260\240\320\200-\372"
+	.ascii	"b\001\261\200\262\016\270\310\355\233\350\231\322\273k\030&\344"
+	.ascii	"\007\340>\3236`\f\343\307e\f\270\004\371\022\f\306\345a\355\303"
+	.ascii	"\330[ \312Q\030GX\245'\261\217\341\030';\360[8\243\332\035\177"
+	.ascii	"\f.\310\213\310\211\001kZq\003"
+	.text
+	.section	.gnu.lto_.lto.3b569303dbbc20bb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroIndex.21.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`\364\001\355\021"
+	.string	"fbxH\340\322&\035\240\3220'\217\3159\035\352&\037D\035\2562F\317\331\022\273_\357R\360\"hy\302\317w\340\365\241;\247G\031\354%9\031\f\20292\314\031\245D)g\240C/y\204b\306\003XjM\032\331[\312\224\002e"
+	.string	"a"
+	.string	"d"
+	.ascii	"3ALsN\257\344$\333e\374\310v\271&^\326\307\360\336\366u\016\265"
+	.ascii	"\311\270\372\362U \314\271\307\330\034\025IrV\354\210\2003\321"
+	.ascii	"\244Vd$\003et\333\251\271t\300\024\344\206\306\3461&\350q\201"
+	.ascii	"B\004\344\020\367g\306\215\016\204\351\036\350\212\264\024\003"
+	.ascii	"k\256\250\2249\2475\006\322\334\251\333\256\261\275\300\326\221"
+	.ascii	"\235\352\341\237R\265Tu|\320\275\247\335z\365\001\034(1\340\307"
+	.ascii	"\234 \236\206\314\035\362(\305\203~\232PIj\316\033!*\376\343"
+	.ascii	"\003\271\363i\256\3059\304\200\307\007\2209\347\352\322\n\270"
+	.ascii	"K\265_v\247\366}\036\343\365\360\345\001\346\304)\2521gh\300"
+	.ascii	"\b\270K\207\334a\234\347e\327bx\002DQ\n\265M\367>\264$\230:="
+	.ascii	"\3169\347V\340\272\335\036\350\004\220\226:\210\220\321'\325"
+	.ascii	"\037\"\035$d\\]\325\312,\200\307\007\244\2703\247\366\373\321"
+	.ascii	"z\300\324\311\2667\234\306\0137\347D\361\207N\204\301\327\271"
+	.ascii	"\264\006\227>v\351\273\266\313\357\213\026MG1\372\2445\035\245"
+	.ascii	"\246\335\231\035\302\350{X\214\310\341\305\261\003-o}.\226h\326"
+	.ascii	"\311\212\004\225\b\017Z\237\213\205\305R\361\\\276\225\f-\037"
+	.ascii	"\004\217B\213\312\004\217\365\271x'&nUX\371\274\013\255\326\347"
+	.ascii	"u\236_\034\033%\327Q\265qevJ\314\312p;\363\205\336\300\310g["
+	.ascii	"}9M\255m\301E\037\223{\031O\201-\314sl\204\360\200\332\231Q8"
+	.ascii	"d\267\233\244\253\353\312\364\016& P\002AL\243\007X\250\354\f"
+	.ascii	"\202\321\254\213\004mn\025\2121P\335hn%\027\244)V\r\230\0351"
+	.ascii	"\352E\tc\333+\266\301-\201\327j\304\366\202~AE`\270\320\316\002"
+	.ascii	"|\037x\325rA\205\177\207v c\353aw\2410\375j\244\t|x>\312\not"
+	.ascii	"ZL\006"
+	.text
+	.section	.gnu.lto_fakeGyroInit.22.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\255\t"
+	.string	"f\322B:0%'\035\200\377\243=H~hy\326.V&\221\253\bn\260v\016\227\f*\004\264\rm\005\250\264\373\203b\330-M\036\006\2120\325\342X\303aP\344\275D\021K6\331;\245/"
+	.string	"0"
+	.string	"4"
+	.string	"/\310>\265\023d\237\366l\232\207&\313\031\371\360`\335\354.\225%\367\036=\377\253\007|\247\322#\247aw\035\277S\310-o\373\3006\203\375N\222\304>\266\273k\211\262\017\3762F?\313@\031\203\232]\220\027\200u\315\230\223\216\355G\373(O\361\016\222>\260\213ry\331\r\023\274\240}:\fo\t\314\304"
+	.string	"\237\215Ggqh\273\253\340\263l`h)R\366y\311\201iQ\201R\372*_!\371)kt\361\337\247\337e\237\363\324R\211\230\342\313\016K1\\\355B\2307\017H\342\023\361\300\325.\264m\037:\252\240\fQ\205\240\024\242\317\004\335\352\210z\020\314U\200*\275\340\270J;\341\036[\211\262\303\312e\222\035\276\264-\002\017"
+	.ascii	"_\241'\023:\301\201\341B%\312\264\241\2319\321\2334{\217Z\337"
+	.ascii	"\242\326\013\300r\261\266YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_fakeGyroSet.23.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`V\003=\030"
+	.string	"\266\253\231J\260\226Q:4P\340\244>`\243c%\347|5Sc|\036\024Z\357_C\275\237\235\013\317,M\300\220\371moE \316\254h\341\"\370\324G\031N\023\226\366\200}S+\267\272X^\330@\363b\311\"7\003\371d\023\271\223\f\200"
+	.string	"\201"
+	.string	"\205"
+	.ascii	"\256\326\345F4\330Q\225\303\347s\330\256#ik\267\013\252_w\327"
+	.ascii	",\203\362\325EOw\217\343N\266?\2058\200n&\247_\367Y\2638\345"
+	.ascii	"\353\236\227!_\313\007 _\327\266[\365\263\327\367\305X\3421\354"
+	.ascii	"\356\027\303\270\355udj\333\257r^\314\335\355\025\305\307\221"
+	.ascii	"F\b\314\"S\202\206\311\332\351(\307\354D\2143\335}!\247$v9JW"
+	.ascii	"9\335\275\324\334\235\370\222\337\335\013\273\253\263\313/\002"
+	.ascii	"\013Th1S\340hqY\264\344]\241!z\023\206\217\303\306\217(\324\361"
+	.ascii	"m\367\314Q\346\355~lf\332}\217\337\365\035\177\314u\374\255C"
+	.ascii	"}Y\217\372\302\374\351/K\272\225\351\216+\272\274\242KI\272\227"
+	.ascii	"\3019\207V\006Lu\227(r\351%U\252\306\241\376\250\377\307\205"
+	.ascii	",k\017\344Al\217\372P\336L\224>\232\314\020v7\204\362uf\2042"
+	.ascii	"z+\231xY\362\321\020v\237\b^\327\301\366H\242\001g\376pE\025"
+	.ascii	"\245\0269Z\334%\342t\24372oW\347!)\277\312\207\204\tO\271W\362"
+	.ascii	"%\025,\364\320\233=\374\212\"\205\243\305\323\356\2761\363\266"
+	.ascii	"F\2363\370\244\350\350\226\335\305\360#\265\233=\025\221O\031"
+	.ascii	"\202|=30I\323\223\213\367FFb\f\357\247\350\221\246\026\357\213"
+	.ascii	"lHj\311\330\033\221\257\234c\212\310b?d&\240g\356.\207K\301\f"
+	.ascii	"\004\273[\301\357\300\330^\306\353\312\200\350M \362\225\305"
+	.ascii	"\001G\262\037\242\240\032\373\2011\210#\375\350\343\306ldB0\r"
+	.ascii	">3\032\022P,\006{\325h\262\242 \332\317\213(\b6\364\212\321j"
+	.ascii	"/\033\232\235u\220\321^\036f3\332\213u\342>63\215M'Q\210\343"
+	.ascii	"\334\3765r\367\301\205\255\nt2\304\202\243\305\312\274\335%@"
+	.ascii	"\311/\025\311\342\312\273\021$\320\233\233\300\205\322\251\314"
+	.ascii	"\312\242O\201\035\bJ\321)\320\013>\312\004\n;;\344k\345\021\211"
+	.ascii	"\231\202\362\310\253'K]\230\241\360\334\004\237\334\274\022I"
+	.ascii	"\250q0e\224R\304\241\221\tDd\024\2449\006\220\002\031\2522\017"
+	.ascii	"\020xW\242\264\006\270p\237\245\260o\264\031\252T\317\\p\022"
+	.ascii	"\210\364\367\251.:\260\006i`0h\314\331\353\330\306\274\377\206"
+	.ascii	"\235\274\255\302\n\355\217\2456\021 g\326\307\006\255\273m\260"
+	.ascii	"\335\f\251\232C\262\035'k5\276^x\003\n\252\327\247:\025F:\020"
+	.ascii	"(\270y\203\266\363\245i\023qj\276m\323\234\242\235\267m\327F"
+	.ascii	"C\242\2413\324N`\377\341\023D\023@\0011\331\f&\200S\232X\005"
+	.ascii	"\340\217vA\327J\266l\250"
+	.text
+	.section	.gnu.lto_fakeGyroRead.24.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"=\013"
+	.string	"\266\225N? Q\224\016\034\242BGK\027\270L\210\r\224\001'\0226\260(\275pk$`\202\313\233T\371-\266u\377\f\247`)\2576K@\002 \354Ou"
+	.string	"G\212#+\260\001\317OB\310\336R\246\024>"
+	.string	"9"
+	.string	":"
+	.string	"\013\030t\274\335;A\n\300\301\b\265\020\331\365.5\361\355Ps\363\001t\236C\013\304\025\032(\215\320!\3518x"
+	.string	"$$t\217\347\250\003eV\224\335u\212\272\017w\274\355\b\266\037\330G\020%\373\247\277r:\246oA\300!\222\243\300\267K\372vlH\234\221\302v\307\226\330\316\264\257\342\246\316O\234\013\330-\331\220\261\353)\260\003\353\321\336\tP\217\326\007P\217\266\035Y\251\255\331\220\027\245B\365|\204\304\367B\275QW\n\0377@9b\273\303Yl\r\374\025\231\215\265\273G\361\350s\250\307k\210Q\r\021\246\323'?\333\343RK\330\207\273\273\326\231\266\271@c\023\313\205\212\205\t\231\266\271`X\345\322h\026\016\030\255\302\225\001S\301pa\232\346\232$p\226\261h\227\206,\323.\211\3679\324\324{\\\002\r\020\0271\362\037\217\352\301vTS>\312\301*\020"
+	.ascii	"_\321\363B@\030\226\311B~\303\nC\265\005RO\304\275\207XZ\321"
+	.ascii	"\030M\370\271\314\230\237\220 \306bSM\323\300\024\024"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.25.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\r\b"
+	.string	"2\31777@s\322\001\033\262=\330\231|\016\244=\357\3016\270;\\\025\327\355\247\350\260\b\370\253Ln\221\246\352g'\227l_\027\217I<\217:$\215\314\261s\263\204\220\275S\nR\223\020\223fh\222\316\020hj\001\2251\317\274\220\025\023\031\035Y`\230\214\":5>\224\"b|$(bT\024=\t\316B\223F-\313ht\335W\013;\237\273\n8`\207]I\017\216\330\257vw\r;\373I\240R4\b0\273\245\233\232EY/&\2667\033\3006\254#\033\207\367\354\237\034e{\312\306\005v\273\030\227\335\252\340\206\316-\327\023\\\267:\037\270n\331\366\002\303f\356\265\244\304\361"
+	.string	"\371XI\355\326\bI\316\375q\376Unpb\221\231i1\221\3768\017\273\353\027b\022\271\341m\037\330\216\260}\n\f"
+	.string	"8\303\361\212\036\025Ql&FV\301\3235ob\002\007\205\34020\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.26.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"-\013"
+	.string	"v\224MC\020O5\035"
+	.string	"wt@\362\377\003"
+	.string	"\n\301\037)\203\346T"
+	.string	"\272\0323\f\2401v\372o\034-t\346n\350\263\231\3004\306N\t\"\031"
+	.string	"@w\305.(\255\236\351Dq\004c\272F\f\323\377\335\330vJ\0017"
+	.string	"7"
+	.string	"?"
+	.string	"\327\320N'\317\320Nm;\004"
+	.string	"\310\340\305\024\351\250\n\023Z\344\256\270e\030\016~\202\376Y\257px]\200\271J\241OI\201\335\365\034\225Lwv\333\035\266\007\330\307\004\266\030\232\031\312~dw\327\331\311\376\352\237\222\003\033H\025\036\343.\251l\261(\250\t\r\266A6\305\366\234\366=\374\003\350\253\3171vO\254\022\273\"\210\005LN-\006\033V\354\313Gx\244\246\261\003\311u\0341\357\"2U\005\323l8o}\006T'F\f:\033\251\335\360#\333\301C@\230\354n"
+	.string	"\037D\004\317E,\303\251\377\321N\251\005\022\"\230\213B8\313_\365d\"\356,\336\206Cp\371\252'\323u\334\326\251\336\003M\305l\n4\034g\353jg\263|\370[\340\325\255\301\367\325\215\"\356\355\037\324\022\274R+R\204\231\310\036\317\302\004\312\222\224\260\001\022"
+	.string	"_\241'3 \f\0337ax\254Qs\001\220\017\334\f2\002\322"
+	.ascii	"\031\203\202<\225\310Wg\034\231 \342\032\r\331!\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeAccInit.29.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\325\007"
+	.string	"\202\21777Po\322\001 [\374\252\252%\305V\235\335\360\242\364\353\264\231\356\252\312\2410i\250\365\347\206-\220\023?\304N\252\"\242\216\310a\230\tY\"K\202\266\215l\262wJ\001s^\320s\203=\\\r\013\031\3658\314y\311\016\305(8\224AFp.\b9iGn\b\234I`TNd\031\225V\335S\013;+h\2306X\341\007}\222\227\200|\017{>\357\334\243\377\251\036\343\246\002\262\261\275\223]C\017\216\354S\273\273\206\235\375\322\377(+c\245\240e\367\342\364\262\246\230\362a\331\376\263O\272\210\366\022\350"
+	.string	"\273\335\t\312n5\360A\346\321\365\002\325c\346\001\325\2435\233\345\265c1#\222\205\211\313\356J\310q\355O\363?r\r'\n\375a\022v\327\217\023a\334\360\266\007l#\330\016\t\t"
+	.ascii	"_\241'\023\372\367\002\027\027J\301\220K\260\315j\n\270\313\213"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_fakeAccSet.30.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`;\001\355\f"
+	.string	"\366VTD"
+	.string	"oL:\333%\002\360:Q\270\227\356\032\252V\215\001\302\036K\376F\024\233\f\"\314?j\002\266\007\376TC|8\345\021\2461\201\n"
+	.string	""
+	.string	"\240\255\2126S\n\342\333\n\001 2G&\216\r\221\310\376{\247\024<"
+	.string	"?"
+	.string	"E"
+	.string	"\357\330Eu\230\355\226\030\227x\257.\017\322\275z\367\350^M\332\266\227\251\375K\026\341u\333\335\217f8\371I\372\007\361\214\322\t\302g\005\300\356z\226N\023nz\333!\266\005\330\217\005\024e\037\366W\356\372\353[?=\353\237\032\003L7\027\227\334\256\204\034\214EQi\032l\337b\303b\004p\2518\241\345?\220o\205\\w/\230\230\355.\306&\336+\307\374\264\357\341+\362,Q%@\0136R*Q\307b\303\213\n\235\235F\302\265\316\306\241b.\033Q[+p\224\332\276\\D\350#\265\273$~\210\307:\276\352\325\r<\363%O\367z\241\220\302\302\252\302h\346\354\2224)\006\373\224\335]\007\240\177\376\340a\bR\207\031\r\002\320"
+	.ascii	"\001q\374\034\bC\360\353\214\032\007\233\261\300\227`\003r\276"
+	.ascii	"p\354|\031\021\213\n4\343\307@\024\307\317R\216NY\2122\345\204"
+	.ascii	"\t\327bDI\376\305\316\346\274&z\273;\342\007! \340\002\221\301"
+	.ascii	"u\237\320\023B7c\034\341\244\211+\031\370b\204\017\374<L\306"
+	.ascii	"\325\343\200\321F\303\232]\316X\270$A\265\274\301\035VZ\003r"
+	.ascii	"\214a\216\301\016B\336\230\201\032I\036\0276\206W\244\305)\260"
+	.ascii	"\227\027-$\003"
+	.text
+	.section	.gnu.lto_fakeAccRead.31.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"-\013"
+	.string	"\246\025N>\020Q\225\016\030e\241\302C\307S\204\307\302\273T\320\360\253!\3453\016\211\260\016\253aTx\373\030\273\223\377\031\020%\366\237$\003"
+	.string	" \022\021\262> <\355\252z\353\274/\371do)S\n>"
+	.string	"9"
+	.string	";"
+	.string	"\005\fp\334\375\033!\202d\260\241A\305j\367\303T\304\273C\315\316\007\340u\016\257\321\025NH1F\021\357\003%\036 n<\365\344\340\2012!\225\335u\206\274\016w\274m\005\266\023\330\037\020&\373\250?:\255\351_\025J+\034\024\032\273\242\217\035+#\302(a\233cGlg\332?\361\023\347\250\315\003\354\232X\270\330\375\b\030\301\365\350\357\022\353\361\272"
+	.string	"\353\321\266\003\306X\310\207R\241v\362E\016\217\222\272\263\256\rT5@\251\3036\206\247\350\016\370(2\232kwO\342\321\337X\217\327\247\236\037<\230 \235P\236\374\260\277Oj\b\373pw\327\032\232\226\2515\212%B\366\200\301\306i hZ\206a8\313\205\013\347"
+	.string	"\233p\311$`\032\207\301(\023o\024,\034\226\3316\016\213|\236C\315\0053V+Z\344UW\335`[\325\025\217~ $\243:\020"
+	.ascii	"_\321\363B@\030f\262p\366\b\342\r+\f\325\026H=\021\367\036b\275"
+	.ascii	"%\274\\f\314OH\020c\261\245i\032\230\202\002"
+	.text
+	.section	.gnu.lto_fakeAccDetect.32.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\035\n"
+	.string	"f\023H>\020\005+\035"
+	.string	"p/k\223"
+	.string	"W."
+	.string	"\214\251x\320\303\342\377\250\356\310\276Ba\333\361\315\352\350c\\\245\375\001\006\203.\333$\t\003\240\b"
+	.string	"\205o#\r\230\373\001 Yef\0317\";\2454"
+	.string	"3"
+	.string	":"
+	.string	"\265s\003\357\325\266\031\032L6\177\276Vw\205\200\314p\273\347\327\271n\236\232\376Y~\240R\243\261\321X\247S\001\211\3355U\261D\356\356\266\023lG\330G\b\273\353\256e_\366S\2574\301\001x\260\331]\345\006\354L\225I\261}\333&{\3006\245\366W\0363]Vz\301n+\026\263{.\030\242\363\352\363\036\357\001\026\017\003\252\267\032,@H4\372l\234\200\345T\032\245\247f\027u\225\315q\027\217\316\356:\370-\037$\202\027\312\253_\362^\353\310K\312F#A\321\234}\236hwb\237\263\001a\bv\016?\242\b\264\240\030I\022(\f\301\257$\305\216\020Y\361a\204\300\321\027\222\345\367Q\360\230!\222\337\3068\222\237\317=g\273\226oz\027\267\022\0017\250.e\037\3449\f"
+	.ascii	"^\321\033[\024\204\305\2004A\003\251\301\305\240 O%\362\325\031"
+	.ascii	"G&\210\336e\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeGyroIndex.part.0.34.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`_\002\r\023"
+	.string	"&\343yG\340\362$\035\240\006\210\300\25501\260\374\366{0\237\250\370\247I\314[\320\035\255[\025\b\002\210jt\255\2347\346[MN^H\270\204\207ZF\t3\3140\212U%\210\001\274\022\2035G\336\"%\317\b!{K\231Rf"
+	.string	"c"
+	.string	"d"
+	.string	"9\217\361 \230]\213\341\t\020E\252\303\221\2179\247wI\362\221\3552~\300v\271&\254\217\341-\025\366M\306U\016\346\203\033\276\305\221\024,\200B\300\232XR\243-\311\250T\033 \020\217R\326\303\006\f\361\215\f\204\\\240\b\001i\342\306dN\247]o\300\031\325\221s\\\312\234\323\235\210\273\273m\016\266\037\330\212\023A\346\216lR\361\331\257t\265\357+\321\222\222`$"
+	.ascii	"\346\344\001\262\342\263\037\371H\276\354e\022\232p\2029F\276"
+	.ascii	"\3543\\\213s\006!\210\307\324\234\323\344\322\016\272K\365\215"
+	.ascii	"^\366\312\206\331\253K}\354u\"W\201p~\310\261\252}\031\017a'"
+	.ascii	"r]d\316\036\032\323\234\241\202K/\350.\035v\366\205^\001\263"
+	.ascii	"\271<\336\265\375\362\232\313\200\216\032\r\206\250F\b\310\341"
+	.ascii	"\301\306\256\217m\327\246\373\025\355\240\321\037\266\255\341"
+	.ascii	"4\\\335\234\023\305_:\223\213\377s\351\f0z\033\230\355R\367\264"
+	.ascii	"+\214\241\027M2Z\345\275\326~\244\250t}\274\334/\324b\007\207"
+	.ascii	"\267\307^\365&\343c\377\252Z\257t?\200\310\201\2479q\252\002"
+	.ascii	"-o}1,\321\254\223\025\n*\023\"\264\276\030\026\026K\305s\371"
+	.ascii	"V^Z>\t\236\205\026\225\n\036\353s\361NJ\334\272\260\362y\030"
+	.ascii	"Z\255\317[}{|\243wS@:\322\344\336\270\333\266N\221\331\031\357"
+	.ascii	"\026\305\231\234\273\021\345~o\364\256m\337\017\025E\355\343"
+	.ascii	"t\202\177%\002'\250\032\235\231\030\022T\211\030\365\033\367"
+	.ascii	"\306&@\342)5 \200\002\031B\273\030\337\351\215\003\250\236`\276"
+	.ascii	"\022\277\021\342\"\025\036\236\320\202\024\025@\020\345\241`"
+	.ascii	"\030M\242\340\020\267\210$\021\210\020\237\025s\331<#\030\243"
+	.ascii	"\002C(\214b\020\017\367|\374G6Z\221\\\203IH#ac\337\327R\026\030"
+	.ascii	"$4{\201\033\324cX\214\364\235,\366l\027@h\356\241\223\031\263"
+	.ascii	"m\336>\2217na\351\001i\354\264\0035w\371\265\017\017"
+	.text
+	.section	.gnu.lto_fakeAccRead.part.0.38.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`\316\001\325\016"
+	.string	"v[`D"
+	.string	"\223\223\016\233\323\026U\223@\273\233\354\r\306P\003\265\361\023\204\240=\031\026\032"
+	.string	"{\252x\304\367\377\037\210\336\304a\030h\332Z\3026\t\021\240\262\nk\377dG\305[L\373;\377+\331\371\304\222\275\245L)L"
+	.string	"F"
+	.string	"R"
+	.string	"\321\r\262G\177/\200=f\037\200=\332W\341\022\223\322\212m\227\230\230\354\375[\251p>\350"
+	.ascii	"1\343c\367\323\036\325\304\275kB\317\317\023K\207\353Y?\200B"
+	.ascii	"\346\306M\213e\304S\300!\347dw\235\221\270\343m;\260\375\300"
+	.ascii	"N\t\001=R\362\225\352b\205\207\253*\333\351\b\323\020\246\025"
+	.ascii	"\246\363\337\377\016\202\023\200\324\256\312\013\310\226\210"
+	.ascii	"\256\023\266o\237U\262;\266\311\356X\363_\3511$\003\337\242V"
+	.ascii	"\254i\037\346,L\217!=\300\256\252U\263\373\215<!\250W\nU\031"
+	.ascii	"\256\221\327\320\250\206\240\202\374H\215\021\"\2602\3500D\217"
+	.ascii	"\211\343\304\303V\360V(\333]\006\276\213\277\020q(\371\023\n"
+	.ascii	"\366\230\032\241eG\n\306\345{\230=\372\214'\262\332\335\005\276"
+	.ascii	"\f\007\r\376\313\243O\302\036\317z\276\264\344H\255\b\333\346"
+	.ascii	"Qo$\237\220\247\302\004\256#Y\3306\2176\352>\033@\035\005\355"
+	.ascii	"\002\310#\322\266n\244\221$0\207\341\323i\0318\256\323:\207\253"
+	.ascii	"*\237u\b7!Z\320\344\357aQE\330\216\352\223\024\365`Uu\261\r\325"
+	.ascii	"F\215\333\234\306\214\274m\260G\250\001$ p\2421y\333_\320\023"
+	.ascii	"\2251\376\222\301\27598b00D\017A\203\257q\371\271\004!.\303\020"
+	.ascii	"\212!|9d\031\025\f;\362\3224\006\306\226K\322\332\272\241~Yj"
+	.ascii	"\214-\2217#\25414H@\304\241\363wh\265P\035F%\220\324\201\353"
+	.ascii	"\357\2776\214\001"
+	.text
+	.section	.gnu.lto_fakeGyroRead.part.0.42.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`3\004u\033"
+	.string	"&q\253F\240\234Mc\214\204\350\232t\021\3278\261\261ZrD\330\320\206\247C\027\245\234hV\200\365\255 \345\353;1\232md\022\001Q\336\266\024\236\037\n\216\316}\2065\223A\322\016\315\310\213\3630B\350\323&Rn)S\n\221"
+	.string	"\216"
+	.string	"\235"
+	.string	"?\341\355Q^\035%xe\024\203W[\020\207\354\230\351|\031t)\240\002\345\325\241d:\3553y\223\241K\001=\300\275M\276*\367\226\016^]A|u\371\001\366U\374\216}\265\017e\b\022\202\224l\033\202\204!\217/\237\222fFSp<qsoI{\245B>\276\206t\332\321'z}\357\t\216\004\203\220\351\355x<\234\344n\307i\270\340\207\2655\333\035\205\003\222\212\220\357}\"\355\214\346\024p\373\272p\357\265\270t\277n\233\307v\007;$\n\\\277#Jd\177\264\266\317\257F\231\357\336;\301\227\"\264\302\037\362\352\003\331W\"9\200LQ\300\242\031\234\324\311\324>\274\264\311\366\264\016lZ\006\233\216\301\246sNu\303\304iQ\234~\275\246\355k\272\332\351\320\323\364V\367|\371\277@\202 "
+	.ascii	"\246{\223\202o\356\217j\305\310\255~\252\333w\022\344?y\3171"
+	.ascii	"\253\240G\221a\004G\345\335)\335{\241\274j\350Qd\210DJb\225V"
+	.ascii	"\326\357\336\233A|E\020~\307\236j\352g2\230\n\274*r)\244N5+\246"
+	.ascii	"v\340I\013\006dK\t\260\310\356\3600\265\231\317\006S\026\271"
+	.ascii	"\306\300\264\364EEj{\3700O:\302\217\033`@\374K\b\361U\244s\f"
+	.ascii	"\271t/\271\223]Bl9\027\021#H\220\260\257/Z\341\220K\366\366b"
+	.ascii	"+\265\364W7\220\030\315\240CZ\351q\304)\232\301\032\317R\023"
+	.ascii	"\357\275\024\374+\307b\342\004\317<\311c#\354\332,\261B\377\247"
+	.ascii	"\256_\025J\235\354)\247\024\305\224\231\243\331e\333v\254Q\244"
+	.ascii	"\224b\001\271\232\314\346\251\215S1ON\372(\250_4p=.|\352\255"
+	.ascii	"\307FC\337\036\340V\330R\360\344t@*n7\033\r\206\0167\303G\327"
+	.ascii	"Cs"
+	.string	"\341ckA\273\351`\320\036,p\356\005NG\213\221\313\351h\261\207\2276\371\275s\320\212SE%\374G\253C\221l\353P_(\242FUF\335\274\213k\336Y\354V(\243B\274\254\230\203\003\331\250\2311*\304\323\202\344#\207\332n\3604c\022\002>{\\r4\243\224\314wE\2569\303b\204\362\207\370?\3665\207\n\361\250 \3710329\360Tf\224R\340#s\037\006k\3300On\260\2570Z\"T\250A \007\225DFf\204D$\214\302\266\330`\242Q\352\316\003\021\200\271463m\235\275\003\030p\237\222(\223\367_\0358\0171\016A\230F\0045lW=t\016'\325\253\024O\357J%F\317\3679\340\022\207\356\372\006\257\373\3516\241\273!\322\346\246\302N\304\227w\037\"y\356X\302\301\001C\245\377\375\003\":%\001Z\021}\264\215\256\266\022*k\267a\317\301\374\237\336\317 d"
+	.ascii	"\264\036\344\373iuE\376\2738\204>ta\0307\2752\024\251\245\033"
+	.ascii	"\nT\320u#A:\326\032c:_\005\177\362\211Sv`\035\230<\001\211T\242"
+	.ascii	"\243\305T\260Y\021\022\232\\\300\246\365\376\325\263\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"-\b"
+	.string	"\204\013\357\001"
+	.string	""
+	.string	""
+	.string	"\002\026\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\024 \301\204\031\177!\002\035\177\"\034#\"\177$\336\240\266\275\001\271\220\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\020%\300\003\002\025\177&\002&\177'\033(\037\177)\002*\177*\023+\005\022,\005\021-\002\030\177.\027\177/\272\220\202\002\032\1770\036\1771 \1772\001!\1773\377\037"
+	.string	""
+	.string	"\200\220\200\003\007\005\210\223\323\252\001\001\202\006\003\n\b\240\341\365\321\002\001b\003\013\024\320\360\372\250\001\001\304\006\003\013\007B\003\017\013\310\377\241\372\001\001b\003\020\"\003\020\024\250\270\275\324"
+	.string	"\001\304\007"
+	.string	"\037"
+	.string	"7\371\357\366\363\314\b\205Y\227\341\262\007h\007\276\357$,\334 Z\001\2013R\330"
+	.string	"V\207\260\3060\2301` \020\266\320sh\370\n`\324\031\220\021\210-\214qd0\001"
+	.string	"\256\031e? \0342\f\204\232"
+	.ascii	"\0354\227z\002"
+	.text
+	.section	.gnu.lto_.refs.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375 y\215\002"
+	.string	"\022\207\021\024\240'\351\377\377\377\377\201\267\377\277\021jv\333'\215l\231R\272\300\234f\230T\273\332\353\002I\233\023\314\035\201<g\032Fwl@<\3074f\2133\t\243A,\245\244teA\200%e/\022s2\355\357\352!\002"
+	.ascii	"\250\031\205\006%\017"
+	.text
+	.section	.gnu.lto_.decls.3b569303dbbc20bb,"e",@progbits
+	.string	"(\265/\375`\t+m\272"
+	.string	"\n\037\311?W JQ:\035\025\364_\204)\316\363\346\250\227\337q=O\314>\256\375\315\271\376\321\262\354\322\210\3438I\n\342&T\271@\223\323\273\370\300F@\341\332'G"
+	.string	""
+	.string	"\332\266\250E\031F!D."
+	.string	"\301@0\214\200g\345\276h\230\202\021\374\375\346\017\300\206${H\231R\ns\003\355\003\373\003\216\001\017\273\216\335\316\017\251Y.\235\315I\301=c\206{&\t\356\031.\334\253\347\244?\365A\036\215L\321\322\337\377\361R\016m\266\007\002$Zs\330\217'\312\037\177{\346\n\247\360k\266\264g\236\270\321fh\340\236q\201\033\3155\244O:8J8\306\232]po\260\3645\354\227\023+\361A\025\315y\355\356\327\361N\016\375\347\333 s\264n\020\377\374\246\317\341rdy\251\204\001\230\\\005k/\347\225G\207\307F\311\336\230\245\364\336x\03480\246Z"
+	.ascii	"\311\272\001\004\367]\302,<\323'A\245\356\013\026.\023\267\215"
+	.ascii	"\342\226\363\234\024\351\223\234\356\213\030\027s\217\364\344"
+	.ascii	"\217\326\263(T\312\336\310v\341\266W\270-\017\334wL\270\243\226"
+	.ascii	"\005\356\350\336{\301\257\274Kp<\204h\301\375Sp?\324\313\340"
+	.ascii	"\310\ti;\313\302.\306\3078\324\311t\373\236\243\365\005{\346"
+	.ascii	"\260\234W\033\273\\\202k\262\223\342\370N\332\377\003\337\267"
+	.ascii	"\201={N\332E\307\261X"
+	.string	"xa\375\355/\302\355P\347\342Z\372\256\275A7\b.\236\347[\354\2273g(\253\020PZ\316\372\366r\316:<\336\364\306\234r\2678\236G\037\210v%\211H\324\357\272\311\377\224-9\366\376\326\300\341\3662\334\276\205\377\351\032R\f\236r\036\205\333\231p\267\303Eq7\257\253\331s\303\312\372\333\355qS\374\314\351\374\2313Q\316y\202_\222\223/\265\277.\347s\016\335\340T\274\205(&\322\337v'\006A\316\276!\365\276>\337\220\246i \332\343,Z[\021\231\277.\005D;\\\267s\371\221\234\324\311\264f\262\2343N\005L\330\322\376\376\234\b\333\354\032\322\017h\236\223\272\023gsh\006\336\326\236\346j=\263\\\363\372@\312\224%\371\333\037\300\355\031\244\266\257\3173H;\bcp\r\351{NjA\020\1770{_\342L\332\315\\I\r\221\233\335\234\227\356\027\334\270_0\3036\265L\222\336\336"
+	.string	"\356\022\260\007\256!u0O\342P\n\\\254Cp\320V\t\226\217\344\274\342\330\360m\361\215\371\333!\340\366\260\036\3002s\320\021\340v\nR\357s\n\322~\254\343\032R\3539\351g2\327\220\366\352\032R\3549\251cu{\324sx\325\253\335\315\001\003t\337\022\335N\327:5\335\227\001\277\356\213\200n\257\353\366\257'=\335\356\366\200\356\033\202\356\017\300p\001\335n\327\027\272\357\0076t\273\217\024\335~#\210\260\333\243:\310\320}\203\372v_\233\356'@\007\356\b\335\376\324\375\301\rtw]\367#@\003\335-\326\355G^\001\031\310i\016\217\201\257\240\373\022\273\275F\26775\356\266}\335\037\001\212F\321\300\356\233A\367\237\350\376\007t\277\003\272\277\203\356\027\321\375\005\350~\r\272\237\247\373\017\320\375\030t\277"
+	.string	"\272\277\202\356\347\320\3759\335\017\200\356\227\240\373o\272\277\246\373\323\356\367n\357\353\366\263n_\353n\nt\373\262\333\233\335~\324\355V\272\233\256\333\261t{VwS\351\356%\335\016\246\333\277t\273\227\356.\241\333\273t;\227no\241\333U\350\366-\335\256\327\355y\335\256\245\333\263t\373]\267\343u\373\225n/\322\355[\335\256\325\335\"\272\373\255\273o\372\372\372\372\272m]w\032\245\373\202\017\002:\376\206"
+	.ascii	"\321\366H\252\345\304)\314\226\0217\373q\265A\221miy\235\322"
+	.ascii	"\022M\253\213\340\265.\273\271\2776\213fG\234\013\026\3766\220"
+	.ascii	"\n\267\243Y\252\357\341u7\3135+\031\240\346}[\244\206hy\227\245"
+	.ascii	"\262IV)#\211\360\262B[\323\213B\261T\376\346vvE\033\001*/\352"
+	.ascii	"V\374I\022<{euX\033\366\206\035b\255l\016[e\205X'\333d\261\354"
+	.ascii	"\016\013\304\326\260R\266\207\205\2623,\r\373\264,X\"\226\311"
+	.ascii	">Y\036v\311FY\0376\210\305a\247\354\017\207Z\252'\323\326i\221"
+	.ascii	"\256d!\262.\270\260\374\336\323\007E\3226`b\310L:\270\252\026"
+	.ascii	"M\037\263\002a_X\031\036\0249\201GtF\260\272\211\375r\002\240"
+	.ascii	"\210\316+\232s&\322\226\352\265\376JN\302\240\310\273x\341T\305"
+	.ascii	"A\376\245\b\2569\026\017\203k\025B\345\321\214\244\200-'K\345"
+	.ascii	"`\334KV\302\240\013\351\216\306CA\355l\315I\r\331;\362\345c\""
+	.ascii	"\274\234\324\272\035\212W\361'.\027\225\227J\017\2726\240\372"
+	.ascii	"0\226\311\201\331\314K\250\017\212|\2355\361/\036\306\371>t)"
+	.ascii	"\235\254\333\221x\231\233\271\034SVn\301\300\013Ij\310\336\023"
+	.ascii	"Y"
+	.string	"\252/j\300\227\324\020-\037\226\352\243~\352\206\bC\316PK\252~G\367\317hK\365<\234\316\256h\270\005\024\223\350\235\325_\215%!Cs\276\322\022f\223\350\263\260T\037\343e$)\200K)5\204G\207\347\246m\213\f\212\204U\352v/_}\254\003G\252\032b|8CvzNjd\217b\034\211\3449\335\031\305\260R\321+U0\332\306P\342-\2612\327\3026\213\200Dh\224eY\322\242\bX\345\310\331\027\313\242m\221\365\222\243\307\024\237{1\321h\022f\227Xc\270\240IY\245\315?\2420`q}m\263\2339W\036\035\230\277?\346\371p\225\f%\013\276/\203\003\345\215\317\306\3372O&5\242\307t>q{y1\300-vS\242\3048\035\017\2533\256\277\215\223p\236\216\035#\332\372\373\305\241\017\346\361\310\300|\226\367R\206\326\027\267W\223]\204I\273^\272\370\321Q\264\371\367\271"
+	.ascii	"\245\314\240\021\205n\213C\277\205\316\253\311\231\303\216\323"
+	.ascii	"U\322\337\366\362\321\367a\247'\346\243\375z\316<V\343o\336/"
+	.ascii	"\017\211\nX\032\326\362xN\313:\2443\334\277#\270\177E\356\036"
+	.ascii	"\257\213\0051 \330\356\2538\364\255\274W\177\326\027i\235\325"
+	.ascii	"\312s=\022\244\337\225\250\225_\237\316\345\2300d\242\2742Q\036"
+	.ascii	"\036\027k\343k!\275N^.KU\316\231\312\317}\235C\237\256\237\356"
+	.ascii	"\277^\311\2152C\316=\310T\321\375\222W\273!ZsR\252\227\271\360"
+	.ascii	"\361l\340\341\241\211\301\003\207\022\337\270\237\342\320\227"
+	.ascii	"{8(/\305\345\230\326\234t\263\344\311\205oO\356\331\376\t\007"
+	.ascii	"f\223\004'xQ\274&\345\344Gz\373\247CJ\377\233\215\213&WV\242"
+	.ascii	"\274\333\005\032LrN\224p\224\366#+\026o/p;\264\265|[\347] R\226"
+	.ascii	"\272\376\366\217\005\356\224\017w*F\355\315\276\211\313\221\221"
+	.ascii	"\210\313\213\346\234\323~\315\241\257\366hj.\307\364\201\233"
+	.ascii	"^\364\206\352\212\253+\017\337\"Dcp\177\366L\262\215M\036\016"
+	.ascii	"6\254:\334)\034\3564\n&\3732\207\276\222\037\353\337z#\255\263"
+	.ascii	"\346l\246\344\223\274\030\007f\263D\0161~$\004\007\257\344\301"
+	.ascii	"|\354F\271f\0314TU\\\370txx~;\324\274\244\322\333\251\020\334"
+	.ascii	"\375b\375P\333\214\361\\3\330\032M&d\326\231'LuS\177\241\037"
+	.ascii	"\366^k\316\231\006\313\213\234\367\267S\037\270S\035\270\323"
+	.ascii	"%\334\251\021\356T\371]8cOH\264\300\034\231\321\303\001\266\f"
+	.ascii	"\215\f"
+	.ascii	"\273*T\177\257\225\323\3310\032p"
+	.string	"8\376\336*\247\373\232R\203\313\351\252\272\004Q\336\005\201\336 w\312\245Ly]j\306\007%OJ\024\364F]\251\233!\347\345\224\252+u\177\270\235\343'\026\\]\376\246\271\246I\017\350\355a\273|\315\316\013F\312\254/{5]\317\273\343y\241\234\234.\024\027\013\266\346\236\372B\r\300l)\256\nw\315\215\034\016\2759\274n'\347$\013\236 9s\002\272\306\311to0\335\246\0325n\223g\347\0078+\033}\233\036\206R\356RC\204\233f\313\222C\357\222\305\233iN\240\355-\232\235\316\0044M\235\363\316p^\2454g\f\312\365)\303\211\204t\225\260\362g\224\324W\211m\002\0375\220\320\264\341\246\371::\262Wp.r\002\213\354\214\334TIB\346K\326m\336\346\215\361\344\302\350\033\343*\205\254\265\335\027`F|]\356\213\353\302\357\242a\242\254dy\263\343\222\272\314\276\314[\204svZ"
+	.string	")\353\213Vf\232\261\323}Y\364\3653h]\213\277\227\310\226\271a\264`\275\375MRB\257\322j\335\314l\222\240\205%\232\235P\022@\303\fkB\371\3334E\270m\030+\246\355\230\356\036c\373<\347e\266\372\312\372\262\227\231\234;\335\226\257m\337\005&#\261\2562J\253\215\031e\310\220\255i\315\277el\226\235\303jzr\206\273\277;\3159if\315NfM\332\355\3553\356;\3356n\235"
+	.ascii	"9w\267\006\"\254yi\245K\027|\325d\331\364\026\344\235\234\225"
+	.ascii	"\316f\330\2232C3l\231\233P9\244\f\3155;M\220\303v\344\346\372"
+	.ascii	"T\336\247\362\363\232\211\236\2202\321S)\324\\\2633\257O%\206"
+	.ascii	"L\204\204\241\271.\225\315\260'$o\206=\2212d\242\254\314DK'L"
+	.ascii	"\364DjJy\"ah\206-\221\232DOH\236\327g\366\271\265\365IY\224\303"
+	.ascii	"\22669\347\030k\225\262&\347\2453+\251\274Q~\212\032\345\034"
+	.ascii	"\331\345\266\326\035Y'\347\254$\273\203z\002Wf\226kb=\177\212"
+	.ascii	"r\276\313F\"\224\256l\221\231J\317\271hu\346\314|v\200\351\351"
+	.ascii	"u-\234\331&\023-c0\241\2365E\314g\213\214\345\344H\3150\250'"
+	.ascii	"\2104\261\260\252\314\\\225^\225\357\236\2348L\271f2.6a@\230"
+	.ascii	"b\374\335\003\013!\253\t\017\f\223G\303\243\002\366E\355G\345"
+	.ascii	"\244\215\315K+\251d1\262f\273\330\026d\310\350\222p1\272!c\316"
+	.ascii	"\250\205-l<\272`\254\353\215\030:\031`\242\266k\246\350\013\207"
+	.ascii	"\224\036\0058\353\222\321\216\274\366:\034P\366\264l(\222\246"
+	.ascii	"\243G\026<\2321e\300T\371\213g\265j\2369\233\335\3041\315p`\271"
+	.ascii	"R\224C\314\013{\305\336\265\340\272Z\376\265\002\344\233r\201"
+	.ascii	"\004\353aX!\261`;kiRC\366\242\270Y1\257\343\301\024\215\342\266"
+	.ascii	"&\304\215\207\216*\026nl"
+	.string	"lv0\242B\334,\224\205\215\350\226\233\007E\316\b\3608\2122\226\266Ej\310\236M\342f\303\326^X'_RC\366\346,\025\033\305\332Y)\266\212\235b\351l\235\205\263q\026\212}\263r\016\265n\226\254m\233}\322:N\346f\271l\327R)bm\313\315\022\331&\034\230\315\264\264\031\037VM\252\n.pe\272\360\303\256\245M\331\335p\362\267/\314PK{:\262|\207\3266-\305\242l\023c\317\314\310,\245Q\36511{&X.\314\226\2645\253\021#%n\206UrS\005I\2235\253\304\226\335\030Q\311O\266\314\222\001\277\334\225\341\372\202\033\250\207\033x\207\0338\0057P\r\357\254\366\253-\230\365\262`\"\2369/-\030\016\231\234\2278\356\027\270_p\215@Q)Io\003\231\340\006\256\270m\327\232\301\315\031\311\"\321\366O\007\025E\3421\211\364\240\366\f\001\r\213D\017G\344\220\007"
+	.string	""
+	.string	"\001\r\025\213\306\342/\031TW \"S\024\214\307\237\244\261\370\363\021\252@W\005\241a\220\032\224\332$\325\0237I\365\004\315\b\022 \030}\210\"d\250\311\241\211"
+	.ascii	"\271B%a\363\241C\362(\024\352\220\202\332S,!\001\b\027PL\260"
+	.ascii	"B%A\323<5=$\036\325\242\252\002\267\210\0164\350\300\203\024"
+	.ascii	"~\311\241z\f\016\207 H0\002\2104\035\016\205x8\024\326\034\205"
+	.ascii	"?\303\253\366\030G\024\215Dd\215O\232\354\237\016\0068\252@@"
+	.ascii	"D\021.\224H\022\213D\rE\021z\204\3521=&M\030\026\207D\020&\205"
+	.ascii	"$z\204\352\b\033\220\301\025*\211\242\b6\375\323\341\250\002"
+	.ascii	"\365\024\205$\344$\213>\217\f\016U\023'\f\205)\200\200\204#2"
+	.ascii	"\020\223)\2507\211\f\022\205N\370\250$\202%L8A\243\016\213\302"
+	.ascii	"$\262H\304\311`\005J\334\"\321\204\"r\230\022\205\220\026\031"
+	.ascii	"\034\021\242\004\315\210\020%\200\3510\004\321\016\245\330\200"
+	.ascii	"\f\226\320\203\341\250&\221\302\240\024\211T\217==\302\237\272"
+	.ascii	"B\b\204\207\202+\324\036\344P\n\214\f\252C\342\n\225\004r(\005"
+	.ascii	"\215\032T\205T@\201\034J\001T\205TH\"\207R\374\220C)\254\n$\034"
+	.ascii	"\"g\222\301$F^@\r\"\242\3001\036U\016\340_2\030b\203"
+	.string	"!#q\205z4!\002\024\204&F\220\270\240\036\207\222\302\243*\024\244&i\222\375\323aH(H\r\232\370\300\301\207\016\206\204\202r\206\200\214H\365x\001\031\224@=1$\024D\223&\201\206\220\252\t5\0025\030<\032\221E\025y\003\002P\r\332\254@\202\004hT\350\021\252&\204Ia\017\360\210\364\t\376\250 \376\004m|\204\200j|\204\200\202+\374\234\020b\203\340O\004H!\343\221\304Q\355!\256 \222\030\022\n\302I\006U\bQ\030\211?\025B\024\304d\n!$\213%\206\204\202l\206j\322x4\001\005#\220\317Q]Q\001\344\0065x\243\036\205(\364\034\205$\324\334$\373\247\003\362')\f\362P4\006\005\031\207\001h\243\220z\364\2204\032\217\036h\202\034\031,\032\211Ia\322x\f\n\371\344\244@<&\205%$\213jPQ\005\021H\210\203a\005\022\324\244\320\304p(\304\371!;"
+	.ascii	"\201O\030\032\201F\364\b{\324$R\035\362\200j\302\006\310h\204"
+	.ascii	"@p\246G\005J!,\206@\223\fz\220,\022\207~\r\002\304\b\013.@\201"
+	.ascii	"\021\360\260\203z\202\320'h<\252\240b8\024z@\036\325\025\304"
+	.ascii	"c\217\207\"Q\030\344axDz\350\200\200dq\3108B\005\022\n\022\236"
+	.ascii	"0\372\020}p\252\270\035\360\t\246Tw\355n\214\232\274\031_}\267"
+	.ascii	"\3566\341.T|N\227\356\026\315\314I\275=\271T\372~0Y\345;w\241"
+	.ascii	"f|em\231\322W\016\247\205%\247\246\277\027\356\306\025\251Rr"
+	.ascii	"\345o\336U\0265$\177\357\333\225\202\023UU\266\326z\035u\356"
+	.ascii	"a\355aq[\373\035q\215\351\021E\352\202Y\020\242+(S\351\325\225"
+	.ascii	"-\257\333\266\206\305Y\251r\327\306v\225\230x]\371\352\013\375"
+	.ascii	"\272k\226\256\306\251\004\3132~K\266\360\370\366r\223i\347\206"
+	.ascii	"\211F\243\313\254\357Z_\265\020\034\264\226b\0171\261\2777\255"
+	.ascii	"\375\007\027\261f\223\213f\225\305\214\257\b\276g\032\340\020"
+	.ascii	"\343D\206\311\205(*SD\376\2767[z\227\264\2267R#\242\244\365\314"
+	.ascii	"\276\242n\224\305A\3211\377^\261;\346\320~\273d}\243\326\242"
+	.ascii	"\354\255\nw\b\274\337\322\233\244o\230Z\016\036OQ`\335\300\237"
+	.ascii	"\222"
+	.ascii	"*MUP\270mnxy\335&\t\266|\335\\\251\252Qt\244\245u\273t\242\314"
+	.ascii	"\355Xq\252r\244oW\n\003G\013h\177/\327}a\243'\203\006\334\337"
+	.ascii	"kd\313\206\231\225u\241$X{=\032em].\325\245\272X\016H\362#\232"
+	.ascii	"\231\230vf\324\272\262\034]\365\305\262fK\267\"\177\357\220\203"
+	.ascii	"\261\250\202\341<\312\342\n\031\022\022\021\031I\222\244\003"
+	.ascii	"r\n\020\006\303Y\036\330\326\016\022\240\004=\317:\310\314\314"
+	.ascii	"\210HR\222Tj\264g|\260}\350\202\322\314Hq\266\036\241\262p\213"
+	.ascii	"a\241\004\220\322\210\026\016X\362\036\330X\272\313\305E\373"
+	.ascii	"\0306\3109z\231C\343\034f\276\036A\337\262%\201\370\b\\*\236"
+	.ascii	"\222\217\245\n<t\3546\200L\031\203\252\227[JxX\216\250\022\320"
+	.ascii	"\351\b\351Z4\036\316\254\270\252\002\261J\253%\250\220\302P\205"
+	.ascii	"\222\335\227\017\006f\350`\221\320\271\036\0351\225U\021f~\b"
+	.ascii	"\370\326\003#&d\201\232\004\3210\211zF\242\0329z!><}\234YeJ\200"
+	.ascii	"\013\034\250o\331B-p\240\b!\253&\t$\276\225c\002\217\"\350\254"
+	.ascii	"\rU\350\241\366\241*p\270k%\365\317\231\370\233\271\235\007g"
+	.ascii	"lCU\346\016\243Sy\324\212\354\304\277Oz\005:\244\236\257\001"
+	.ascii	"2\247%\216\366e\366\272\021\327\300\236\216mo#\252\260iZC&\345"
+	.ascii	"v\t\221\t\336\0345T\003D$\271Xo\312Q)\024\003[Y\324\035W\341"
+	.ascii	"a-\253\214V\306\265\250\320\236\003\310nC@\027(5\247\026N\035"
+	.ascii	"\301\203\266\236\212\316\346\201\375\320 \241\255Z\202z!J\265"
+	.ascii	"\256\272a\366\270\222\221\245\335\361c\273\325\235\354\212\332"
+	.ascii	"\004\261h\245\177\0056Z`\257$`\024I\240\252\031\217 0\030_\352"
+	.ascii	"j1aZ\340\3263\252\275\342\226\017\372x\314d;Y81"
+	.string	"`\367^\022\300\322B\031n\202\373\336\350\236_\220a\001j\037Mm7I\225\272\002a,\212q\256\352\341\200h\274S!(\t\223\351\240\2545\017\022\235\306\266.\301\327oM\322\201\t\263\2030\027\316B\304\007\304\033e\240\231\217\267\364\370\317\221\246\204\354\313\021k\241\244\343\250)\2660\320F\250]\023\320)\372\033\025\354\352\240\r\246\027.\360\352\202,\007\276\013\201\222\273s\271W\342( \216\212\215\f\357\023\n\254\351\346X\300\234B\306\334\362\330\177\325\211\274\\\253\303\216\002\222\253\234\361\273\300\264\213\204`\272\313\203\330\322\t\0278W_oY%\t\2152\220\002\357n\f\276\207\347\n\266\"\202\340\346\251\314+\323\325\0305\357Y 2\236\313@\374\237(k\f\007\213\365P\0069\311I\264(\212w\207c&VRTi\246\031/\356UO\370U\355\276\330\0256\300*e\313>\225\273\320\001;ZO\266\375"
+	.ascii	"\263\237\236\024e\301T\317G\253\331\272\323\301\346\017U\257"
+	.ascii	"7\254Jy\243\316\377Y\035@i\240\205Z\370,\376\225 \324;\204\303"
+	.ascii	"\312&\\[*,\206)E\243s\264\231\302\351\007m\225}B\025g5P\032\032"
+	.ascii	"\25517\003\320\b1\n\271\264\t\020K\251\303\034J\0021F\322\312"
+	.ascii	"y87+\022l\177qB\365b\r\223\213H\\\017\261\243\362\204\"E\375"
+	.ascii	"=\304(\346\375\304\220\266~\022\177\256\016\250\236r5n\340\003"
+	.ascii	"\226\214J\224\324\226;k!1d\334\213\202\243e\343\025\016\234\227"
+	.ascii	"\342\340\021\372\365c(JwY\203bR\030\272\270b@\257Y\251\370\266"
+	.ascii	"\322\275\252\274n:;\341K\003y\\)g:r\325\036D&\210^_\317\350\305"
+	.ascii	"\241\025^\346JO\275\377\nr\367\027e\310o\315\216\274_\367tvC"
+	.ascii	"\305\221\335\337\354a\363\314\t\035\310\316\304\301"
+	.string	"h~\252\242\260\347\0059'\223\236\221[\333\222\0136\337U\202\351V\315+\215G\256e\324x\022\367\233[P\325F\036\227x\350\013\212\221\325\251V\252\020\372\330j_2\253\310\342Q\226\236\270\277\240\344\263\3311 \f\310Y}\243\355\323'\270\b\037\027\b\270,\262\304\244P8\374\272\357Q\365\211\002\200_\374\247\204\r\215\265Q\030e( \\\327\246\266~\206g\212\273\005m\270h\374+,S\261\034\240'+\260\317\302B\254xV\255\315\2709t\305\332\023C\250\215_[{'\005\357X\277\023M\352,\341\372\216\177\242\364s\306\326\303\332)<^\363\361\212\323\256\240-oD\242\245`\023\206\367]\353\343=\t\375\203FG\020\3142\2441\251\022}9L\003O[\263m\f`A\304hd\033\r5\026\253'A\037rU\331\263J\034Ke\302\031;N*\277\322\377\030\200J\253I\277\231\"\003\274\026\361_"
+	.string	"f\227\020\355\226\\\2004\020\212NM2\355#Wa\323\257\241W}@\333\302\306\314"
+	.string	"n\021\234\236\235\321N^\304\177\354"
+	.string	"D$&\244\34178$-x\225\361\336\t\310a\300<\343dZe\031\340\245\261\345/42d\267\250\256N~\037\236\033\027'\361f\261\305\340\273\032\313<\315\303t\237*L\220\372fz^b\001\357<\262ku\3623\266\205\006z\222\0245\267+\031\273\324GS\301'\232:\274\2710\301\0071\233\203\227\236&'\277Iw\204K\030\337\251\200\2322z\252\274f\266l\377\260\270\035\314\003\341\266\037\025\345A\"\254\361\00389\366\333\004\270\222\247t\177\260m\303\206H_\262\335\325\263$\261\"\037\036\225\222\032\f\263p\240\241{8\263e\361`Cv\212\210\260}\2135h\333\211\350\277\034\376\367\206\376\322\216\330I\216V\312\336t _\227)qbIW\350\305P\"f\027\360G\n\325\206\223\313\220E\211J\225\237\233\355\354\036\016Xa\251O\346\333T4\234\255\267Z\215\306\230\365\260\225vEe"
+	.string	"-A\252\004\027hi\001x\222P\341\366\021\177\021\376'Do1\360\206\371O\300\315E\300\267"
+	.string	"\327g\373\216\240\372\214^qC\346\241\"\024d\235\253\3175\021\031p\253\227g\352Y\372\227Q\004ce\346D\307\254S\347\300e\207\261\215\250\205M\\\250\361\303\bl\220aQW\276\235\353\353@3\242\360v\006\246\030R&\035\344\260I\n\267^\261tr\020\026Q\212\324\375\211Sx>\003\272l\356\027Em\212\r\313\216\367CV#'\2664\303;\345\024e#\365\223\317N\224Y\246Z\311\250\372\033\350\031\347U0\364H\244]\275\251\"S\234A8\261r;\364\370\006\303i/\0067\240U\021Pe\273\240\204\246\322M\266\207\240H\225{\336\0207(\241\266\260"
+	.ascii	"\325\0168\013\t\003\260S]\036\335\352\251;3\222]\2101\031\365"
+	.ascii	"\326/\366\356\005\366;!\232O4\270\235\303\007\342\002wC\342e"
+	.ascii	"\2651u\212\220\331\324\177]{\271\300E9\201\267'\367+\2164I\027"
+	.ascii	"X_\262\365\204\372)\350\237\235\"\374\307\337\021\006V\354~\300"
+	.ascii	",\203\377\324\236\374\005\365\305\306\233y\r\372\234\364 v|\275"
+	.ascii	"\260\365\244\306^\363\021y\327\277\341\261be\366\315\351\323"
+	.ascii	"\351\330l`=\344\222}\372\177\360\332\254\033~9X\336\351\343R"
+	.ascii	"]!\353\t\317\207\333\177~\232\016\235\373r%\367\255,\362\334"
+	.ascii	"\342V\373\t0\225\233\356.\221\017\357\276.\362#\2213W\366o\242"
+	.ascii	"\3506\234\347\257\024~\206\177\004\275\370L\344\r\253\327b.0"
+	.ascii	"\234\301\313\344K\004r\255\327\362ACo\005"
+	.text
+	.section	.gnu.lto_.symtab.3b569303dbbc20bb,"e",@progbits
+	.string	"fakeGyroDev"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3b569303dbbc20bb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-f"
+	.string	"no-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,265 @@
+	.file	"accgyro_fifo.c"
+	.section	.gnu.lto_.profile.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375 V\215\001"
+	.string	"$\002J"
+	.string	"\003"
+	.string	"\372\303\247\205\007\002\002"
+	.string	"\002\001\001\231\323\374\330\n\002\213\305\243\371\013\030\002\003\004\003\002\003"
+	.string	"\005"
+	.string	"\271N"
+	.ascii	"\202\\^\201\035\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375 ,\265"
+	.string	""
+	.string	"P "
+	.string	"\002"
+	.string	"\001\003\002\005\003"
+	.string	"\004"
+	.ascii	"9\003l\326x\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375 \264\r\004"
+	.string	"\302\006\031&\200K\322\001]^\203F\232)D`\027\370\320u"
+	.string	"\233:\305\244\340\343\037\006\226OaD\216\022q\025\262\t\221;\005\377\267\033BQ6\226)\360z%\352I\211\003MX\321\017D\232"
+	.string	"Q%\227\307d\200\231b\016\313\370\357\032\f\273\030\277\250\035\215#\"\270\353^\003\373B\325\217\275\357;43\023\277W\002\013"
+	.ascii	"p\330\013\023 \034\310ls,,\341^\205{\2234\313\0215[\203\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375 -=\001"
+	.string	"\370!"
+	.string	"\002"
+	.string	"\001\001\003\177\002\005\002\005\001\377\007\177\002\005\177\002\002\177\002\006\177\002\007\177\002\b"
+	.string	"\002"
+	.ascii	" \370\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375 6M\001"
+	.string	"\370*"
+	.string	"\002"
+	.string	"\001@"
+	.string	"\002\005\374\007T\374\007\370\005\374\007"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002\t\003"
+	.string	""
+	.string	"\002"
+	.string	"\003"
+	.ascii	"w#\200\3746\320\006"
+	.text
+	.section	.gnu.lto_.lto.62c08ec7445d31cd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroFifoFrames.3.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375 z\305\002"
+	.string	"\364\003m"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\006\005\001?\202\210\200\030}{\275\001y\274\001w\273\001\005\001\006\025\001\002\001\b\302\001y\301\001w\300\001\300u3\304\0014\303\001\277\001\276\001"
+	.string	"\t"
+	.string	"L\030\322\325"
+	.ascii	"4\0133U\030\214\201c0\325p\212\353\030(\002"
+	.text
+	.section	.gnu.lto_gyroFifoFrameSize.4.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\325\b"
+	.string	"&\321>8@\217\322\001\230\265(~\222\225]M\036P\306|}\225\005;\301\f\250\b\374W\027\036Q\033\213\354\0139hINQ\024\277}R\330\213\321\020@\022.\2243D6\331;\245."
+	.string	"/"
+	.string	"."
+	.string	"\322\266A\b%\233\376\265T\240\027\016\025\231\335oF\220\233\016M\376K^\300z\245V\247C\200\206\3355L\255:\356x\333\036\333\f\266[\002w\375\020\023\330\340\304\354\252^3\013#YDl\227\354\215m\b\355\217\234\244t\027\2065\273\036.+\273\337\201\027\002.;\347d\227\330\007\262\007\364)\023\236\004\333\027G\361\bZ\273\032\n&?\241\300\036ri\013R\366\324\245O\312.c\324\270P\360e\177'\030Y\366\261\335]\307\017\307#MT)\227y\373P\256\343\034h%Al\2336\275\032\252\350\352\303\214\3504\321\334\2527?\006\246\022\241:G\224\326\271\371\366\216\261\203\212\031\266\003\n"
+	.ascii	"_\241'3 \f\033\206\253a\232\222M\373\270\214\ni\fG\016\021;\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_gyroFifoParse.5.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375`{\t}5"
+	.string	"Z_\300\024BP\346Q\007\013AZ6\020\255\252\241s\006O\244\217\354\330\223Kl\254\r\300PAf\374\004\202\275\331\270#\311D\201\t\210\236\2501\362\001\323\323\317\377\017"
+	.string	"\377,\005DdO\266\331\022\356\266\367N)\245A\001!\0015\001-3\237I\2467\314B\027@\201\356}F\265\312Rl\253\314\254z\227I\266\360*\361\374!\261\216\311\"\343A\025\323h\\\235f\303\205\267K\251d\003\333\252\320\377\331`\270:\314V\222\360vA{d`[\345'\353\316\334f\355\205\253\317p0\357\336\2617m\367>\023\360\004\266U\247.\256\255\246M\\[m"
+	.ascii	"\201\213\223\375\204\"\344\201\234\027\232\241{\237\307\177\362"
+	.ascii	"\235>\233}L\374d\027\217\210C#a\020\370\363\265=\036\273[\325"
+	.ascii	"\364=\311\375`\242\312\2702M\035]l\233J?J\373\355kJza\255\314"
+	.ascii	"\211Rzh\364\364\366\025E\b\305\203W\276\22480=\360\366\025%-"
+	.ascii	"\266\211\371/\025&I"
+	.string	"\027\270\205\271\317\t\030\222n\237z\273\fc`G\232\367\366e$ubS\304Y\267\346\300\004\310\334\030\030\222\336\211X47\006F\326k\272\304%m\tT\032\027;ms\351jzAL\316\220 M\036i\337a\"\327k\375t\345k\212\247\251R\035-\203\200M\257\264\300\2221\314nkg6\273\374{\255\275\315\0303\27210)\355\273\f\367^v\037M\260f\244fn-\314\274\305\314b\bl\265\372\367\030TN\277\277\257y\325\365\233\344\231\024[\306\275\265\266\332\257\266\251\3034\262\303\027q\2407:)\351;\271\033\307z\340\273\255U\200\231\303\303\247\313\0175\030:^\314\177'\363S\207\003\313\016\005\342o\302La\202\204\240s\204\2403\204\2166?p\320sn\320l\315\fzL\367\202.\323}\354\264\356\004\035\246\033\001\353\034\325g\335\007\202\316\005ZM3\224\221@\2475?u\230f'\240\363"
+	.ascii	"\326\271\251\347\314\364s\026\360s^\3729+\355\234\003\264\316"
+	.ascii	"I\2553\200\2373\022\353\\\3749\037\251\316D\325y\310:\033\375"
+	.ascii	"\234\205\254s\360\347\fT\235\177\252\263\217un}\316\275\2363"
+	.ascii	"Ouf[\347]\353\274\366\234U\3269\3553\315\317sv\326\271+\274\024"
+	.ascii	"/5$@\367\nY\224\350\332Q\325P\351h\267\232n\266\3563\2352\257"
+	.ascii	"\341f\303mtK\2102\310\2144\334nj8\352\324%\274]L\200T\271\367"
+	.ascii	"\302`\033\rw\033\267l3\372.\277x>\240?\250\330V\233\231\213{"
+	.ascii	"\215\003\r\365\314\004\r\345d~h\361\324\367N\366\036\004\336"
+	.ascii	"\036+u\274\b_\340\231\314\b\032\352%|\273\265\212%\f\320R\254"
+	.ascii	"\300s\317y@\026\367\314X[e\212\022\226\364\f>\300\267\003\370"
+	.ascii	"$\250\007\360>'m\221\376\350!\024\037\251\370\006\340\210\177"
+	.ascii	"\364K~\272O\017\237\370MpF?\2243\372&4\357\t\037\370\021\376"
+	.ascii	"\243^C\202/\374\226K\022\351\340+\rb\032\371=\360UE\254\357\177"
+	.ascii	"\2374h\231\250}\3377\221\366\223\242\375\274W\007\257\305\332"
+	.ascii	"\373\356\003\355\303\f\242\343B\360\232jz\340z\317k\252\321\235"
+	.ascii	"5x\247\177@\204[b\341\275\372\r\236})\306>\317\233\243+\324\263"
+	.ascii	"\337lZu\023VhyE\371\367\336\035\354\356\027<\203\367\350\022"
+	.ascii	"\313\332\034g]\177\367\275\274\242\364El\374\365{HX\\\372\352"
+	.ascii	"7\217\350;R\355\\W\004fN\222\265\235\022/\264l\271\267K\002\235"
+	.ascii	"\256c\"\355\262V\371\004\212\265}\264\312\235\342\33394\272\263"
+	.ascii	"\035}\357\275\273T\354\376X_H\363\243\307\312\264F\265tP>N\315"
+	.ascii	"\264\366G=\273W\230\322O\264\016\212\372\316H-\244\206\254\252"
+	.ascii	"\033H6\253\352\0062]\265b\320\270\232RG\334@Z\365\262\250`\310"
+	.ascii	"\260Bf\355\\h\265\210A\005cEj!W\244ZH+\254+\026+O)\270bQ\305"
+	.ascii	"B\352\nk\253\305\324\024\362"
+	.string	"\230\205EU\243\nk\3051F\025\322\3528\205\225uTp\200\257dPa\035\265\256\256\260\216\355\363\366\221\361\231h|\026\032\237\323\324\370\377\314\227\221e\t]\240\035\257,\276\223\217o<r\213\203\312Q;\322\304\314Q:$\360\273)u\316i\0268C\n\t\376\351\231\275\326\307>\303\t\317\251#x\247g>\375\200w2\350\234\246\037\360\241\025IU0K\204\250\211\030'\217\230\227\2633reG\210\357\344n\353\016P%^lF\016\236\323\325\370\004\006\374\323Sx%?\313*L\357\364\023~7h\211\245\351\231\276\327\332\030\304\f\032\247Vw\366\305J\331\360\235\235\\\215\357\340\377\016\0334.Ml\321\037g\023#\001\017$3\224\n\370\366\363\252\362\220\231PP/\275\357\215\220/}\257\201\302\231q \\\035\236\340;9\307\275\215\\\225\336\353\240|z.\211\004\251\364;\264\2500jn\200\356H~"
+	.string	"\202\376\336\311-Y+\341U\262]T\200\300\250A<\342\024T\n\315\210\310\004IA\222\306\200\002\221)+\326\001\021\220-TV\244\240\031\326l\330\3008\376\017(\240\315kw\223\021\t\022\350`b*\374&n\003n\005l\326e\006\310,\307\316\205IH\204\227\200=\317\231v\024*y\207\235\343\376\307\356\270\235\366~\274y\210\036\007O\224=\253?+T\337\275\3559\372\202]{/\236-\323\203\t\351'\340`\344\0131\341[\273w\227U\0315\2469KS\t\031mZ\315\307\320\357\215^\033\264+\250P\246\266j\340\333\304`\265\037\253\210 \235\351\016:\235'\022\247Za!!\206\003\205_\226\346\021w({\273\310H\321\223z\305\260}\213\002Z\236\207\374p\310\351\350\030\243\215=\244)\036\301\036\377\f\210\t\306\330\031\317\2053\275\255\346\340\3263\237\236\275\217\234"
+	.ascii	"y\354+\225\036gI\343\013\376\n\"\017x@0\261\223n\004\017\002"
+	.ascii	"\024DJ\\\020\355\002\022\375\204K\013|Q\002\265`2\204\332\266"
+	.ascii	"\223\201\021\214\214\266\035\370\322\353\326\210+\215me!\211"
+	.ascii	"\355\023\274\267e]\00150\003\313\3044\230\2312e\204\301\355\356"
+	.ascii	"\n\300\366s\0366c\201e\204\232\216\374k\207\350\251z9\366\245"
+	.ascii	"bP\336\323\007\356~K\345\363\326\354\235I\365&\033\371\206j\343"
+	.ascii	"h)h\034Dd\\\233\203\033\215)5\376\370|!P\257\344Q\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375 >\275\001"
+	.string	"\364\002:"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004\177\n\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\003\013\200\204\001"
+	.string	""
+	.string	"\003\002\005\177\f\360\372\254\016"
+	.string	"\001"
+	.ascii	"\036\235*\003"
+	.text
+	.section	.gnu.lto_.refs.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	"\003\002"
+	.string	"\001\b"
+	.string	""
+	.string	"\001\021"
+	.string	""
+	.string	"\0018"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.62c08ec7445d31cd,"e",@progbits
+	.string	"(\265/\375`\250\007\345-"
+	.string	"\312S<\022E`\246N\007\247\2517\202\367\364\005\351\342<Mp,\302C\257\227[\0069\363U/\300\023\272\003\371{\235'\234\016\016\250\314"
+	.string	"\261s;/\267w\t\3013\251\317l\232@c\252EqCA\021\377\306M\233\310\224\002\366"
+	.ascii	"\026\001\n\001E\253\236\223\354\316\177^:ZZ\302pwo\304T\324\333"
+	.ascii	"\260\263y\227\3666_\003Bz\033\372\317\272'\020rO\360{C\302\236"
+	.ascii	"\245h[\251=B=r\243\324\267Am\r\2527\035\213;\223\374\331\022"
+	.ascii	"\234\332\267\232}\331\177\006\006\355I\331\323\203\321\246\240"
+	.ascii	"\266g\351\002t\357\324Aj{R\352\257'\245\215\325!7J\373\351F\351"
+	.ascii	"\217\027\245^%\330n\245(Uz\345\007\372\330\276d\351a\024{\021"
+	.ascii	"\225n'\363\262$_\273\345\376\363?\023\001sWR\f\243\235\335(U"
+	.ascii	"\275("
+	.string	"u\037\271\005\335}$\242\273\005t\373\257\273\r\200 \320\215\177b\334\367\323\355q\272\033Oww\351\356\267\356v\353\356\270\356f\353\356\264\333\361\272\035ww\236\356\316\353n3\335\375\354\3569\335\375\246\273\331t7]w\313\301uwYw\007u\367\230\356F\337\367}\273[\257\333\033t\247\306\313\266\031\304\r\266ei\216\275V^}\354\353\230J\265\271^\371\255\377w:\352\3302\307\335\335\234\342\2170w\346\270\034\247s\327\007\207\227+]0\032\301\215\322\264\215\273q'\003\177\203\215\354A;\333\242\2663H}\357\353\fRg\003\264eg\213M\231\352h<\215;\275\256\333\325\370\232F\315\334o\376\347 \037\333%\267\206Q\004n\224\242\256\224\002\337\367}]\351\f\035*D\t\0272\214z\031\237s'\222\233i\257\342f\375c\363g\277#\202\265l\242\312\370w\244\324\337\327\221\310\310\001\021qC\363\346"
+	.string	"b\266(\261\0217\306W\203J\2355\214f ..#\256\030\207K\357\272\350xa\264\035\256\333\263_\3610$\006\b\371\b+\023\006\243`\216R\256\031=\306`\264]Lm\2473G\023\362\375\203\245\215\375g7\377\342^\334\351o\236\326\256\346[\332\363?\362\377{\202\026G\023Z\363sEi\321\272k7\353\016vKp\3627\347\342m\006\260\376\301x\004\216\347t<\317S\377\225\022\344\274\276\224\324\264\263=B\354\264\347\241\001\375\227\375\277\001\247\002\306D\202\321\306s;"
+	.ascii	"J25#z\324\306\335\351\263\312\377\307\361\313\257\304\002j\377"
+	.ascii	"\271+u\007\271\317\025\274\257\017\020\371\007\253\253\2432Y"
+	.ascii	"c}`\264\273\021|G"
+	.string	"\371_\211>\277\262m2\327\026\013\335\222(\177\330\200o\212}\233\231K\324}\374\371\375\221\314\345\2126\273\3126\273\353\320#\335\365?/\207\332'\273z\333d.\333\246\273$z\344\257\337d\303T\244\273l\343\334\345P\333d\227-\222\271$\372Q7$\215\006\034\263)n\246E\376\215\344\027\253\034\232k\263\373u\377\376\314z\245\202\377/WY\307\356p6\254\271\033Xj\254\373HI\254 \356#\347\332&\356\177\023\254\023\237lZ\363\334\027\361\271U\354\353\267\262\376\t$\377W\377\271\377_\377\337G\371\225\377{\f\265c\311\344\277\327Q\362\277\326\266\254\177\374\264c\013Bcq\312C\220QH\bc\370\201\250\251\206E\341\225\320J\355\246\247\007OP.|\032**BT\204\264\241\242\202\301\250\247\240\332OA\237*\224:N\245(\022\207\216RO\301\343\325\320\347\330KMT!,2\035\211\304\"S"
+	.ascii	"\024Db\005\251\337\325\324\320\304\325\005\253a\211\037\243\224"
+	.ascii	"0\305T\021\003\261j\210\001(\20414\242G)\250\343\325\220\205"
+	.ascii	"O\007\203\026\020\204\340\220A\245\202@\254\032VIQQM1\031\213"
+	.ascii	"\302\026\303\242\t\246\253\341T\n&\252\242\221\tB\203\243\320"
+	.ascii	"XU\325\201X|a\005\240\263P\372\344\210V\033FqV\223\373\317\342"
+	.ascii	"\031X\253qVg\234\005\324\003\272'\300L\324r\354\245\310<j\022"
+	.ascii	";,n\030\325\323\303l\223\033/%\347R\303\t\027^\033\263iX3\254"
+	.ascii	"\013\243\370\335\356\007H\215\033Q0\352\257\307\371\022&O \030"
+	.ascii	"\365=\207\003\204B\366\346a\324\367\370]\312\364\362dC\373\005"
+	.ascii	"\261\343f\355Km\227\342\216\307\351x<\317Q\3765\306\232R\207"
+	.ascii	"\0039u\311\003\307\026F\033'\325v:^\247\003\200\206\250\2218"
+	.ascii	"D\f$\006\221\241\031\021\221$Q\007p\002\22113z\022\300'\241h"
+	.ascii	"\006%HQek\177\003\362\213\327)v\031\026r\032\026\204\213\266"
+	.ascii	"\367\324vh\360\372o[v\253\2140\006\034\226\226\252\203$%\351"
+	.ascii	"\277\017,T\246\243\3359\330\002\023\350;\261\276Y!\371%\340\262"
+	.ascii	"\246t\b \216\026\257$\002\003*+\\=+\300\300]\020\t\345\367l7"
+	.ascii	"\241\300\342\0130\341*\301D\270$b\252EF\024#\314\3223Q\tt6;\211"
+	.ascii	"\230$\255\034p<=\201T\244t\262\"n}\254\224|\302\224\032)\255"
+	.ascii	"\244?\346\224a7Y\304\356\245\225,\315k\322\22280\257\342z9\312"
+	.ascii	"\033V\3330\301w\006-\361\343A\003\353[\317\001h\217\002#\020"
+	.ascii	"t\222x6\327\265g\302\317\027\030\245\344\217\214\254]u \350\336"
+	.ascii	"\253V\240L\326>R\203\300\352&\254>s\f\3004\007}`KD\336\037R\004"
+	.ascii	"V\256\230\362y7)\271\"'\324#\340\377\303E\360\300\036\034\237"
+	.ascii	"\004\360\345x\273[\271\344!\310`\235\332[\b\315oUF\214\375"
+	.text
+	.section	.gnu.lto_.symtab.62c08ec7445d31cd,"e",@progbits
+	.string	"gyroFifoFrameSize"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"gyroFifoParse"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.62c08ec7445d31cd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
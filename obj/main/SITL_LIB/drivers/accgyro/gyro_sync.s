@@ -0,0 +1,291 @@
+	.file	"gyro_sync.c"
+	.section	.gnu.lto_.profile.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375 H\245\001"
+	.string	"t\002<"
+	.string	"\002"
+	.string	"\366\341\247\227\001\004\002"
+	.string	"\002\001\001\274\253\370\241\004\022\002\002\002\001\002\003\002\001\002\004\004\002\001\002\005\002\001"
+	.string	"\004"
+	.string	"\200\203+\271v6m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\003\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002"
+	.string	"/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\275\007"
+	.string	"RM'(\200K2\034\234\251\331\t\314P403P3\305]\001\017h38l[\232+2!\023\362\234\022\361H\334\333\237\020)S\377\317A\213\034}\2215 \006\304D\264\227\036\320b#\003\332\315\243i:\033\307\352\021Bm\t\346\252\262>\201\315\001\334\fG\261\305\347\225\206\2621\244Egb\212\r\022S\\X\304\024\237\001\201\323Da\346$Eg\346)\360\242m\301[\3462\027\004\311^C\030\265\005\230k>6'\204m\233\376\241\255\344S\342^M\224\347\220\022\237\371\"\234\264U\317W\021( p\242\243j\035E\200\331\2008\312'\320\256,\347d\266\333\302"
+	.ascii	"d8r\371\233l\nA(@\3341p\f@]@\f\204\206\302-\366\222\030\333f"
+	.ascii	":\234\\\232\221W\202kA\006\227\374X\fm\2156\\\275\035\221qu\374"
+	.ascii	"\272\032@!\022\263\\\023Q\221\213\353\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\001\001\003\177\002\001\001\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375 \200\215\002"
+	.string	"\204\003t"
+	.string	"\002"
+	.string	"\001\370\005"
+	.string	""
+	.string	""
+	.string	"\001\002\013"
+	.string	"\001\002\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\340\007\b\b"
+	.string	"\001\001P\002\002\n\006  "
+	.string	"\360\003\002\f\300\007\200\b\b\b\002\r\220\r\020\020"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"I\211\342\2230\270\003\350Zu\t\030\203\251\214@\323\217\r\264"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.lto.c26cb0be0c93ed9c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSyncCheckUpdate.16.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"U\f"
+	.string	"\226\227TB q\223\016L\006\3341\"\242\007\"-c\355O\241\266e|"
+	.string	"\277B\376\251\364"
+	.string	"PI\027\205\037\021\264#\350\264\235\032\250\030\321\246\210\021\022"
+	.string	"\261;\331X:\357"
+	.string	"M\036Ix\374!\226\354-wJ\001@"
+	.string	"A"
+	.string	"A"
+	.string	"\220z\200\351\320\266\023(\350\030\033\220AI%<\233\214\335\031\365\303\261?u\230\257[\311D\313\37664\016\327\214V\362\n\354\356S\356>\032\211s\027\007\273kg\242m\270\341m?\260\335\300>\204?\374\274\235\235\177!\220\301P\301\242-\346j(\325\330\024\360D\210\317\337\356\370)\306\370\023{\353auE\207):ph\006\224s\366EG\351|$r"
+	.string	"\273 \022&v'\002wP\207\236\0270=$OC\333W2.T\304\213\023Q\f\267\273\231j\310\307\246\353\004\025R\211\243a\033\303G`\324\356v\370*\234\213\002q\350\213L\207\327\223X\234\240\214F\\\311\236\231\323\220\375\267\273k\005\331\037\005\034\215TK^\037\317\025G\025rm$DK^\037U\345\0217Rs\001DR\210! \036\025b%7\221\303\200-\013\032\0319\226%#f\356\337*\310\021<+\356\333\027\240\360\260\350\217MN?z\371\264\314h\031\321\024"
+	.string	"@E\261#\236\207\205\270[\220"
+	.ascii	"\263n+k`\005\021\006\017\221\313\022\210\213\237Cn\3540\327\354"
+	.ascii	"\231\205\355D\246%X%O5\003\225\304\241\356mm\321\003"
+	.text
+	.section	.gnu.lto_gyroSetSampleRate.17.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375` \004\035\031"
+	.string	"\326\352\231I\260\032Q:`\233?D\266F\227\252L*%5\366\343\327R\013P\341\356\226z\335j\337\370V\366\013B\311a\233\034\300\243\277\215J\370\033\256\375\243>/4'\3645\240na\373\357\324\327\013\204Y\220Zk\204l\262\367N2\203"
+	.string	"~"
+	.string	"\211"
+	.string	"\335AFG\335\247\002~0>\344sdf\276\217\023\361\260IO\034\013\007X||\301\356\223T\335\346>\244\027p\037\326\0347\217:\215\342\rm\245&?\302\214\037\255&;\252\3728\325\320\215\242\270j\021\343\327&\240\201\344b\246\346cm\244\334\310r\337\351OM\005\r?\213q+\256|/\340\304\n\255\346\3425\005\252\326\363\342\252\272\3736X\300\260T\\u7SZ\255\3059uf\346\301\314\033\230\355\r5\255\342\206\320R\333\032A\312\226\202\216af\235\017y\031Pb\016q!\261\261\273\037\374vF\324(\351x\310?q\037\276b\350\301\264\233\321&\346SF\353\215\371\266k\020\363\317\177<\357l\337;WK\231V\312WI"
+	.string	"\272\001v\257h\n\323I\241\022\241\363\376\336)3\017?\310}\234\352\231\004\302n[\226\334\205\363L\333\270\025\221\226\245\356\023\347!O\030)e\376\356@x~\236x\200@\213\n\247 \021\271L\021\360t\245\324\210]\220\f\031\271LQ\217\321\311\201\277!\026+\322\315I\327\303\341\375\236\334\273.\255\267\021\344\n\n\372\205\231[\207\342\032iU"
+	.string	"\204i\247\344-0a\275\375L~\f\341l\275\335\303e\316y\023\017\025\210\202^f\264\211o\364/%\311\250\230w\275\361\022>\223\0311\271\266\035\361\223"
+	.string	"P\035u0\327}\204\217\004\365\327}\310\224\326=2r/\302\314[\306n\331i03o\241\001*\023\026Z\"X\031Z\037@\350\2604\224%\213\306r\271\240\334)\021\343@\276`%\\e\311\"c\260\026\211\034X\007r'\207\245C\226\260\030\271\340"
+	.string	"\277@\264`\244\210\327\013F\246\316~\rb\b8N\242R\225q\244r\3636"
+	.string	"\272\347r\032\241\235\275\266\233\327\326\037\b@'\n\347\315\373 \217(#\027\341n^\212\323\355\270\fh\214v\330\001}\363\326\372Sg|jI\263\332\303\2662\263\216\305dzq\327e.o\305%\243\013Z\250qD\247\024\"3%\"\"\232\202$9\220\"\"\253\362\021 I\005\031\315\024\230\346\264A\354\002\203\004\360\253.S\366=\231\257xL\215\202N\242\324\224:i\0247\323\247RT\265a\031;\224N\210\226{\265\002XC\262\321]\257\300\301\376\225\250\226G\222\303\035\306{\317x|\nD\272"
+	.string	"e\017\327i\n\265\327\265\333n|\222\335\212\274\254S\245\373\373Qk\265H&\351\370\200\266\273\264\036\024"
+	.ascii	"\355;?7\302\200\267\337A\031qR\323\306\215\017\325(\240\327S"
+	.ascii	"E\304\332H\324Gy^GW\340\006\327\241e)\327\301_\002_(b[/\f>R\314"
+	.ascii	"\032\021\024s7T"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375 65\001"
+	.string	"\3602"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\021\177\017"
+	.string	"\002"
+	.ascii	"\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c26cb0be0c93ed9c,"e",@progbits
+	.string	"(\265/\375`e\031\355v"
+	.string	"\212\3010+O0N;\352R\255'\324zhP\242\250.g\331\017\272\237T\334\246d\272\352\007\340\341\321\002\363P\375r\255c\364\236\235,~HR\372\027\3212\316\233\273\377\217\255AO\206\213"
+	.ascii	"\320\307P\002J\327r\245\217w\231\204\002\tX%w\3332\245\024_\002"
+	.ascii	"\243\002\241\002\357L\357j\250s\371\217\263^cfr.\337\362\026"
+	.ascii	":z\366\307\034\034\360|\233 r\377\316\245\244%!\250\334\236"
+	.string	",5\005\342A\210XHB\003I\023 F.\2479\256\226\367p,\030\276R\032Z\351_\2662\\\216\366\221\212\3459Z\315\035=5\3168V\027\307\341\334\"&M\231_\331)\227m\363\262\355\272\354\266\3432\234=^\206\223\3639\327\217i\226\231!J\336\\\3662\227\335J\367!\212*\371\262\245\311\355=\315\247\241=\003s\347\3515N\2550\377\371\357\024\262\307,3i\036T\242\366\240\262\023\271\251\363\270\375}\244\332Ij\260\031c`\236\262S]:\r\355:\375\306\251\223G03\325i9=\307\222)\377\275\230\210\360\212s\225G\356\377\223\226\372\007\031*4\351\034\346\206\323q:\316\177\324\334`9\211cn\270v\303i\356h\342\202\310y\0324\346r\227]\356'\327\231\215\244r\350#\265\231\321\036r\271w\\\3566\314=\246\3114\233 \2711`O<\345f\303\334\321N\3535\315\374G\376\377"
+	.ascii	";\254.d\\<\355\266N\323P\245V\323s\214P-=\345\266\272+\374\267"
+	.ascii	"\222\332ss\255\244\252\\\230\270\321X\265/U|<m3L\334g\216T\245"
+	.ascii	"\226\363\211\f\320\342e\315\323]\037\251\334\306k\277\221\324"
+	.ascii	"\020j}\244\266\227\376\322\320\016\r\206\233K\263\261\356\350"
+	.ascii	"|\247#\231\001\313\025O9\306\345\356\240\332\271\271\356\240"
+	.ascii	"r\t\267\250\221T\357#\025\201\021n\210\025\367D#\251m\326g\r"
+	.ascii	"-\240\321\254\321\n\221P\037)}\366x\312).7\026> \315\227\340"
+	.ascii	"\244\313]\200\332s]\200\312\367&5\222j\373H\365?k$\262\246\322"
+	.ascii	"c6y\203\371g\377N\243]\330\027\2573O{\314\273J;\271\307Z\214"
+	.ascii	"E\224\340 \344S\371w\366X\372\177\354N`\250;\001\235\227$\307"
+	.ascii	"+j\312~\331\331H\352\355#\225\271\20307\022\346\376j\035\t4\223"
+	.ascii	"\271\027\260K\346\366b\035\263\255\301\334g\314\375df0\314M\304"
+	.ascii	"\334P\230[\211\231\321\230y\003s\017\300\314U\230\233\ns\207"
+	.ascii	"1\367\024\346\226\302\334Q\230\331\311\314E\314L\206\231\355"
+	.ascii	"\334\334\334\03437\231u\036\230\003P!W\026\207\225\320\311\033"
+	.ascii	"\027\233++\373\005\347\246y\203\255\225\021\016Z\fg\222\266\006"
+	.ascii	"\215\037';\260\3049K\322\370iCe\313\235*\2664\254\235 D\222\314"
+	.ascii	"\365\230\326\21642K\005\266\207\216Z\021{\264Fd\036+g\354\263"
+	.ascii	"5\366X\207\275\251\301\343\251\363\361\271\333\304a\2341\347"
+	.ascii	"}\210\302\220\351\343\303\323>>\203:E\016\225\022\310e;\276\347"
+	.ascii	"'\216\r\032#{z\315\020&[\302<\345\213\343\312I\262fH)\236\342"
+	.ascii	"i\250\313y\23439\227\301\357`Q\233\013#\027\3645\362\254\245"
+	.ascii	"w\354\364\325\025\\\322S\257\363SF\307\0161\3219\ru:\374\026"
+	.ascii	"\364\277\301\003W\023,O\331\016\377x\0216r\364x\034;\234\362"
+	.ascii	"\315zx*g\367\266Lce\313}\3638\\\3075K\264\313;)\227w`n\034\216"
+	.ascii	"\030\2172#\267\215\307\320Pws';\024\217\302IN7\247\342c\313\235"
+	.ascii	"\03387'\3635\035\325*z\344\333\fpKK]\366\245\317\0345\365\342"
+	.ascii	"mq\232\377\257\306\3238\233\206\372\032\3665n\305\321\206\214"
+	.ascii	"F\377D\3704\327x\026g\033B:\037K\225\363t\344\226\224\226\226"
+	.ascii	"\200n\f\001b\274)\032\2176\324\333\374\214\0307\323Q-\347c\r"
+	.ascii	"\2411\351\310\311\265\371\027\017\263\201*\231\242\013\034\270"
+	.ascii	"\313\366\325\345\210\232\362n\313\f{\031\241\032iMb\030\343d"
+	.ascii	"4\354\320\212vQ\3361\334WLf\220\241q\271\241,\203\203\341\267"
+	.ascii	"\024I\231,1Oyw\274\254\356\271\254\342as-\256\326\321\263\246"
+	.ascii	"3op\377\317\305\2734\324\331|\215\255\243Z\025\214\221\0037\264"
+	.ascii	"\244I\230\030\234\233BA\232\231\3614\337\362BBo@\274\200\265"
+	.ascii	"]V\307\\V\277\\,\016m\250\243\371\031\373\024\017\343$\347\177"
+	.ascii	"\0264\177\272\331\006\252\244\212 z\232\212\210\022\216\346W"
+	.ascii	":\313\220\321\3718\200\2264\351\310%--\355\204p\031\373RSV\221"
+	.ascii	"\\f7\3632\333#\251\205\217S\007FkM\022O\241\016\203;\331\371"
+	.ascii	"\377@ol\374\233\247\254\n\271\254n]Vs\\Vm\\\326\365\361*Df]U"
+	.ascii	"\242\324\021\323\305\271]\344v;)\315\365\340M\202\216Y[\332\304"
+	.ascii	"\\\326a\271\254s^\326E9R]\211'q5>UY\236\372\227#i({q\027~\220"
+	.ascii	"\316\177\036\001c<\342)\353\2327\306\216\275\250\254\003rYM\207"
+	.ascii	"uYWuY\255\221T\257$\242\034@\314\222q\227G\360p\037\226Ly\241"
+	.ascii	"E\226\300}\314Bm[\001fN\377\231\371\201\020\376\217e\334\352"
+	.ascii	"\334&i\307\037\216\3003G\377\221]F\013\272\226\310.\036\311g"
+	.ascii	"\327\033\221J\214F\312\3572&\237\377F\217D\032\233\230o\224|"
+	.ascii	"\376\362g\244Y\366;\273\214\217d\276\321#\377\210@\022\331\265"
+	.ascii	"L>\217K\243\344\263k\371\317\256/z\344QY\003\371J\243\177v\305"
+	.ascii	"\375\223\271,J>\231\313\344\263\353\253\365\324P\222\205\005"
+	.ascii	"\306m\210\222nK\"\377\312j\353\250,\212&\235\314w\373\357\263"
+	.ascii	"\252W*\360\277\305T\272\035y\264\032U\364\212*\313\221\251dE"
+	.ascii	"\345\305|d4"
+	.string	"\t\306\374\007\243\202z+\022Fg\364\217t\324(d\353oT\375\023\360\316\177\253\177c\177\364\377\215\377\277Sn9\377}\024%\233VV\377ZIV\277e\\\253\372\367\2637j\313\344\323\213\311\264V\366l>\r\247\261\233\357\326\245\274O#\331\337\240s\233\313\034s\304:\\$\033\032\025*\005\0209\263\254\204\204]Mq-\335\2251S\216R8\312e\023c\323\346\251\205\002$\344L\r\036\236\362\217\013\227{\3156\275H\263\031::\337(\001\333\307}mEi+\266isX\035\277$1\306d\255\213\03481\266\331e\272\215u\252m\340\365\006\327n\035\346\n\0340\313\264?,\020\333\304\276`[\260L\354\022\333e\267\254\023;\304\272`}X$\266\210\025bw\330,\313e\265\354\023\333\303zY\"\226\207=b\215\330$6\210Ub\277\032j\233>\003\333\245\305z#\303\fk#\f\216\347\351\252"
+	.string	"\312\332\bd\321S\2511\323L\326\350,L\230,\013Vy\242J\371s\245f\212\023N\263dJ\001\252\324\214=a\333t)\376\346\2618@q\033,p1)at*\022amU~#\314\271\244\331q\277\204@\n\227m\266\\\337\371\034\034\304\226n\262\\\210\227\007)m_[rT\312:\013\2111.6\346\026\3231t\230\216\032\371\243\361\204\330\210\246\353\261\310\rT\311?zU"
+	.ascii	"\205,M\255\361\264\236\236\013!fl-\314}\245\267\364XG\265\336"
+	.ascii	"\030\307al\371\265%\3473l\323iP@\366\265\025\305\210m\372\021"
+	.ascii	"W2\204,\372\367Bk\372\020f\337\301\266\351Dz\215u\252]\032^Z"
+	.ascii	"\340\334\274"
+	.ascii	"\340`fW\316\326\226\256\303\222)/\032U\032\234W\331\246[\271"
+	.ascii	"\022\013\2020\343\327\326R\322\322\320\027"
+	.string	")g^M\251\325\3210t\026\022\204Kz\224\355\271F\257\354#5\304\265\205\021wX\211=\247\251\020L\360\255P(|@\031-\216\330\367\023\256\300\365\305e\022&\"0q\"\306\216OL\020b\202\020*\237\230\200\211i\002\023L\227M0Y\342\017C}`@\270FE\3754\320\240\202\370\003\376\220\200\0328\365V\241*$\256\360\001\213\032\364\210\275&\247\336\272\201\322\220\007cm\002j \304P\037\204k\224\023\260\227\342\210\b|\362!\317\267\2620\301\327s\021\025\325Ca\364#\306XS\342\220\367\233j\361\2646\361T\254h\001\264\372\200=\342\020\370\273D\336\007*R\340o\005p\350S\177SC;\344\241\020\241\002\b\205\b\025?\252O\304\317\026](\ry\0358\025\tW\342\260'\245\016\207\253\320\311\251\267[a\364\242n\221\007cu\032\026]\334!o\365\375`\254M\303\242\013\240\225\267N\311"
+	.string	"aXt\361\263N\311 \016\213.v\303\242\013\273F\365|C\035\221G\274\303\020V\251\037\bDA\341*\302\335\021y\"F\024\203?\030\253p\005"
+	.string	"(\364X\240h\322\260\n\213\304\236p\235\222Z\211@D\206\372P\234\222\3429\260\362X\204(\021\302DqJ\352\250\030\025\034\256B\rC^"
+	.string	"k\213\342\224\024\220J\214*\016W\026+"
+	.string	"+\217'\f\016\201\353p\350\202\237\225'\224B\n\016\200d8\365V\026=b\317\351G8|\342A\275\370A\361\204\236\246\242\202\236\246\242x)@\231 b\004\017\n\200\341TP\330$\\\235~0~M\305))\"\"\357E\017\204\340o\367\242\007\302\217\030#\003\"PEqJJ\310\267\022\203\302\025(\004\243\236\204+\214\017\206J+oh\025\366Pp\022\366R\004\r\021\031\352\303\020\212\330\223\002\001\fJI\005}\004ppj\025\202 \006\203B\020@R=\344\001\203?b\217\030\024\362\246\236\216b\374\204\304^\007D\340*\005|\361\213\352\021\025\245\220b%\366X\370|=\242\335\320\004\3235\301\027\214B\341\324#\016\327\342\t+\013!\2475\312E\017\230\001\020\221w\202\b\374\025w\314\304\204\002\201\020<\330\340\372>\370\2002\206<\020A\241\214\027>_\017\304P\270\302\370\t\235@"
+	.string	"\177=)\020>\341\020\304\207\006\210\300b\020\305\0325%\325k\021|\372=\021E\005\203\030\360t\\Vf\317T-\\\032\354\\\331\223f\306\366,\314\320\223\026\312^\003\217\313\266\212\035c\353\264\317\373\257\354#mK\252\310\275\226\226\007!\033F\356x]a\373< K\326\031k%\207\323\207\016+dg\316\265\244\247},\024\333\006\366\003\f\231\313\354\314\352\037\225\377\217\245s\276\222*\210[\327\355!\201\370\250\241 \307\030D$2\"\"\222$I:\021\005\304 \b\035\204\365\022"
+	.string	"\025A\313:\307L\315H\222\224$\355\337\001xL@pj\3438\001+\245{\260)a\206s&\210c\017\251\034\024\301\370u\032f  5\200\364\251y\351!\223\2063:\252:`\373\370\220\311\"\266\352\031\007\243\202}\266\260F\341<\320\b\351Is\211\254`eS\306\027%T\303&\243\364\340\252\312y\216'f\265\023\327\304\346\356e\f\342\205\207Z\353p\007\031\374X\314\261+\252k\361\251\t\375k\270H2\324\334?:\231zI\266}\240\334?\362\b\226\342\030V\261\367\216m\374\215\341\223\233: %`\266H\366\r8:O1$\352\234\020\273:$\355\342\307\206\317@\347x\"\373\340\311\373\247e\341\017\254\302g\033"
+	.string	""
+	.ascii	"\024\270\335j\214\373`\360/\266A\220\324\222\323*\033\237\310"
+	.ascii	"\337'5\320\256\215\027\305H"
+	.string	"G\222d\177C\332\032\231\024%m-\037\201\315X\351\310tc<\373\337\354\364\230^\352\032s\3525\315F\262\304\232\020\350?GT$m\357\020\361\032\r9\233\373*\346\2506>gg\2574\264\367\013B\256\225\214\300\021\267\215\020\326\255AF\301&S\013R\332\232\232\363\331\331\032wn\332\227\243\261Y\021\304\240eE=\\\246Z\026\256\261r\260\036\266\331\236\235\036\013{\246\003\265\371h\217\356t\314\013\253d\352~\004\006\037J\305\025.\377\n\336\341TV=\301\233\300\342\277\255\266\370\230\251j\005\212\b\265\024\347\360L\360\035\326\327\023$\370\006\035\257#|S\004f\242C\372R\231\324\225n\177\302q\306\002\266\324\223\343\033FX\232t\031\343\001\325\023l\272\235\307\032\231Xh;f\224\243\354\177\330\002%\333\004s&\204\200\t\212\210}hs\016\304\030$3M\032\013\205]\223r~lBa\266_yo"
+	.string	"\364[\b\255\321`5\206Zy\026\n\273\305\025\337\363"
+	.ascii	"\274\034\023R\370\r\277\223\006\342v\003L\021\322k\334]v\310"
+	.ascii	"\340o\232\f\302\263\001\377\307\036{I&u\372\365\340\252q\362"
+	.ascii	"\032v\025\237\342F\252\350p|\257\207\002\241&\024\t{@VD\"\tq"
+	.ascii	"\325\374&\333:n5\261\225J\365TR\220\335\326K\027\356zwP|\200"
+	.ascii	"F\007\266Lly\241\237r\366\372bF\017\202'\030\270\026\343\207"
+	.ascii	"]Q\013\334\243\343\033\b'\222\037D\260c\033\352H-Be\240\t\"{"
+	.ascii	"+\300\214\357\337\246An\226v\346E\033V\341\r$\221\005p\326\200"
+	.ascii	"h\231U\335U(\317\360\034\003\263\272s\036[\243gr\311\fL\374\374"
+	.ascii	"\2557\365\274)\321oL\3711\013\2356\217\024g\216\332?\265\251"
+	.ascii	"\232|\016]\004\274%\306\322\303&\025fp~cXj\34352\210\2464X%\026"
+	.ascii	"\215\320\377\001\207\254/E\347\2452\225\354\275\026\323\255\f"
+	.ascii	"\304x\366(\221\266^\035 uH\202\\0\202\026\341+\261n\270\177\340"
+	.ascii	"\207\336?\356\334'\020\020\325\002\022\351\254\355\255\326\307"
+	.ascii	"\342'\352\217F\353\021\204\244\b\225\244\321)\220\215\257\301"
+	.ascii	"r\206\341\025X\024z\264x\201@UAq\254\3132\321\261\352\034!pn"
+	.ascii	"\225\370\343\376\262Yt5=f\354\214]\326\206z\217\250\224\007}"
+	.ascii	"c\b\215\350\314\316\\FV\024\234\355s\246\332\r\034\004\266\303"
+	.ascii	"t\230r\201\224\341\212*V\261\376x2'C\255I\333\206%h'\020\347"
+	.ascii	"Yp\243\002\315\276<\200\236\3527\0223)\323\t:\247\247\207\337"
+	.ascii	"=\027\310\232\356\322Cq\b\325\322\353&a\313\265\254U\331\350"
+	.ascii	"O\355\004\220\274\b\360Q\016!\201\236]O<\340\200\n\374\271o\t"
+	.ascii	"\242@[(:\230\300\372P\202\244\205t\361\354ZW\253-\250\031\340"
+	.ascii	"\234\364u4l\214\351l\200:\337\356T|\205\373\317\027\237]\234"
+	.ascii	"qk\364\243;>+N\206\\\005"
+	.text
+	.section	.gnu.lto_.symtab.c26cb0be0c93ed9c,"e",@progbits
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c26cb0be0c93ed9c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
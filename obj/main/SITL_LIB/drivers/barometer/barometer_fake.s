@@ -0,0 +1,284 @@
+	.file	"barometer_fake.c"
+	.section	.gnu.lto_.profile.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375 \205\005\003"
+	.string	"\204\004y"
+	.string	"\007"
+	.string	"\374\255\365\254\f"
+	.string	"\001\342\215\236\254\t"
+	.string	"\002\273\214\205\235\r\b\002"
+	.string	"\002"
+	.string	"\002\001\002\001\003\240\342\234\212\n\004\005\314\234\243\362\003\004"
+	.string	"\002"
+	.string	"\006\227\301\232\263\r\030\002\002\002\003\002\004\002\003\002\005\006\006\007\002\003"
+	.string	"\t"
+	.string	" "
+	.string	"\31073\263]\3562\t\371<\223\322\214+\317\301"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375 9%\001"
+	.string	"\300-"
+	.string	"\005"
+	.string	"\001"
+	.string	"\b"
+	.string	"\007\001\001\003\002\002\001\005\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.ascii	".\033\367\244\241r\317\006\260"
+	.text
+	.section	.gnu.lto_.inline.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\215\004"
+	.string	"\222\307\027 \220)\351\177\274\t\257\375\\\257*\267\317\326\037t\264\375\336\335\335Uk|\035L\036!\233H\231\002\377\367&\257\004\372\\\320\343\356\004+%\235\326]\353E\260k\205>N\023\341\266\031\272x\034\006:\331V\035d\031\"\024\313lsi\003y\032\200\313\257\372\304\335)\276\317C\357\356\320\2479\b\024"
+	.string	",C\270\\\n\035\256@"
+	.string	"\342\302\r\230i\004\274\001\357V\024\21630a\003=\025\214\224v[R\244!\b\216\"gs\tn\342Q"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375 9u\001"
+	.string	"4\002-"
+	.string	"\005"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\003\001\002\002\001\001\017\177\002\001\177\002\001\005\b\177\002\b\006\001\001\003\177\002\003"
+	.string	"\003"
+	.ascii	".#\251\214\263\001,"
+	.text
+	.section	.gnu.lto_.pureconst.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\200\004\001\200\004\002\232\004\005\230\004\006\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375 \336\375\003"
+	.string	"\002\006\022\032\300\025\322\001\377\246\265\031\366\377\337\377\377\377\3776\320Zk\255\355Fv\333R\246?7W\263*\016\221C\347\373J\f\005\020\362\365\n5\004\023\204V\361\346|PZ\320\036XpLO\263\347\235U\376\243\214\322\362rZ\021\026"
+	.ascii	";\201\027|\243\323.L\303Z5\262,\023j\301\234\322X\242\t\2157"
+	.ascii	"\205\203]\032\270\371\315\346\372\245\240\265\nGJ\273\026\275"
+	.ascii	";\233.\373\202\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.3869e30b1174bf56,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeBaroStart.5.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\265\006"
+	.string	"\342\314.2`m\322\001@c\003\207\024t=p\312$%\321\007(\177G4<\2628\341\265\nX\307\fY\264yAp\272B\2327\001\366\260\206q\337\266I\333;\2450\253L\245\032\352=T\016\f\371<\217\003\263\312\270N>\211M68\210M\305q\232\3548\212*\214x\351<\020\246\233\342\335\256\026P\264\2126~X\333h]\371\377\266\253e\223\306\300\350\277\030\245\334D*\361\230\332\232\265\3760\210\345\220\t\007\374\227\210\344\217\007M\300Xj4\201\305\022\306\002\026K\265\332\023\307\216#\210,FP\376\273\306a\313\314\252-b"
+	.string	"P\350cvQ\370_\006\ne\270\315m\r\332.\264\305\b\t"
+	.ascii	"i\331\"\3236\242\306\341\202\034L\272\204\325\254F\217;\274h"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_fakeBaroReadGet.6.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"%\007"
+	.string	"\"\01635`m\322\030@\203\240\320\t\345\233\241{\317\244\224\276O\340@\355\332R\265Ex\224\254\251P\217\037\264aa\004\301\373\231\021\227\r\301\264:Eqk\204\220\275e\n\230\2744\323\033+B\\\016\f2~b\007\223\227\006zd\234\340\310\006\030\301\271:p#=\320\262\306$\242\204\037\f\223\360\271:\355\333V\255\032\250x\026?A\356m\274N\273\273\277\355\335Ch$S\332\025\265\260l\nuB\372\263\007\370\235{\365\320\217LA(4`w+1\331\235\005'`\224zj\246R\n\243\002\225R\377\006\007\331\232\316\016\021\002JHdew\302\307\241\232:m\325\020u\032$\225\022\311\b\244\356\242\260\273\273\213\021\206\376\364'\370\027\376\214\007"
+	.ascii	"hm\231\302\340\305\230\303\312\316\271\206<u\210\370\272\346"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_fakeBaroCalculate.7.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375`F\001\305\f"
+	.string	"\266\226SB\020q\233\016\360\030\244\013"
+	.string	"\305\036\n\260S\272\233\030\tF[\2256\217\274\362~\344\310\354\033:\006\n\233s\304<\271\373\324\276\366\326\277\001"
+	.string	"\002(\345.\002"
+	.string	"\030"
+	.string	"\200\360\267+\333\004}\332d\313\224\002B"
+	.string	"="
+	.string	"A"
+	.string	" V\201\312\205\0245v\327\202\037\276}\212\022\324\315?\312;\270\016\344\023\207G\022\013*m8\2240%+F\002\272\021\t\301H\344\341(W\f\235\210\252\205\301\356Z\271N\303m\271\355\215m\007\366+\004\367~\352'\177T\265\252\372"
+	.string	"\006\220\030\200\261\233a%\307\246D\027!l\377b{8\032\\\355\227\270\211\355'\237\023\330\005\275`\261\353%\360\002\352\321\336\013L\217\3241\323\2437[\306\275\325\210\bC'N\301\177$$\030\202\376\247}\004\210ar\216\306\277\243\370\360ML\341\243\347\036\017\017\210\260\321!DWt$*i\001\375\231\"\374'\372TF\364\206\355\201(\f\331\227vw\rAvrz\264k\312\016Gj\0279=Y&g\207r\246\222\233K\302\203)5\311\301\346\005\301\312\246\234\240\231\021,\017\315\305\26123\263\252\312XGNK\303\260i]\274\275\264\020\024g\244\204@\221I=Tx\024\006\037"
+	.ascii	"i\3312co\361\326\264\320 \200\002\344@\300@\n\270\027\006\022"
+	.ascii	"\206>`0b\364(\302\270\337\030\311g\033@\340\320\020\234\020V"
+	.ascii	"\271\006\264\302\030`\016\f\006F\004\250(\343\227\253\320$\320"
+	.ascii	"\016d\001\314\230R(("
+	.text
+	.section	.gnu.lto_fakeBaroSet.8.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"]\t"
+	.string	"f\021@:@\345&\035`\037m\220\230\323\234`\316xABj}32\273|\317tqB\333\220\356\307\337\310vS>\235\026\013\037\bv\007J\371\026\345CN\250\2726e?\331d\357\224\002."
+	.string	"."
+	.string	"0"
+	.string	"\005\330\345u\002\354\322\235\035s\220!P\243\2412\263\2733\202\274;\354\374\237\234\223R\235\016\003\030v\3270\245\342\270\343m'\330v\260-\023\376\367_\367~\210\r\300\030\274\354n\264"
+	.string	",K\266\210\330~\307\376\\\0326\227>\264_r\223\356\236\311\234]\017\022\226\335\365xas\211\360\263\363\355\257\215+\313"
+	.string	",T\304\360\265b\341\361h`\364Q\236b\362C|Q\202O\225\260K\005o\244\003\005[\366w\202\361\303\376\265\273\353\270r\264\222\270\254\322\221\210r\035ZI\333F\353hc\320\207Nd\022\017\225rT\244\325\fbn\225V\204j\304\244\be\242\t\252\333\374|\254\215h\235\234\246\325\020"
+	.ascii	"i\331\"c\317\376\254\341L\202&@\\\2373\022\275\245\r\266\326"
+	.ascii	"5t\025\206\003F\300\270\005jJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_fakeBaroDetect.9.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375`\007\002\325\016"
+	.string	"\266YaH\360\262&\035\220\3358\265\323I@\250\302\f\334x\220\3757\304\321W\275'\303\031h\300\265\343@k\240\270\367\r!*UI\3555\022C\305&5\204Y\325n\313\202\257\267\210\202\032\205g7\020\361\271\233\261\215{\023\262S\nH"
+	.string	"H"
+	.string	"R"
+	.string	"\277y\271\200\335\025\216\216\335Q\201\033\204>=~"
+	.string	"\375\f\275\204~\332\366\202\023\223\303\217,\231\273H\201\302%\333\0359\r\306\303\313\320?\316\r\310\210\375"
+	.string	"\321A\301\\\2168\330]K\021\265\342\326n\373\200\355\007\266d\021;\\2\332b\347\216Q?\3475J\37056\341\"/~\372.\364\023A\f\213\246\025t\2223{\204\221\332\013\373\333\356\256\265\225\375\233\177\013p2\312\204\024\200\355\312\314\212\254\317\354\211a\333d\223\330\226\322~\3534L\001;\2671\274\3077sxdA\0328\230\260:<\226\222A\305\003\250{\317\005\025l\344\021`\355\236.\332 \016#\241\250^b\212G\305?j\257<\307\227 \246E\323\372Cj\203\307\021\206v\227\201\177\243\205\004"
+	.ascii	"\240\232\027\3729\202z\331\224\330p\225f`\355T6\217D\336J\367"
+	.ascii	"!\245z,\336\007\326N\205+U\257\205T=p\"H\335\307\215j\211\023"
+	.ascii	"\211\f\216\360*\307\002\202\225\363\270\337V[Y\347!f\330\020"
+	.ascii	"\tr\322N\330\020\"\230H\370\317\204\r3\024\356CB\231yU\370\217"
+	.ascii	"\231\230\262p\037C\304T$ \340\"\221\243n\350n\221\222\006c\311"
+	.ascii	"\334\033mM\344NH\260\t\t\"\031\367\006\2532\016\031\324tT]|\352"
+	.ascii	".\231\021i\330w6\244\303\253[\327\363\201\270\246J>\217'\322"
+	.ascii	"5\241\310\370\320\360\307\020\202`\310\326\271%\336h\310\326"
+	.ascii	"\021_\227x\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375 \226\225\002"
+	.string	"\022D\017\031\300\2471U`\373\007\362A\344\345\377\377\177\272\233\210\310\273\221-\367\226;\005\377\267\254%)\334\262\206dp\207\302\364Hi\214\204E\002D\256\245\273\017\363\371\016CJUuH\274\377%\007"
+	.ascii	"p#\214\200\214\341\020\226!\001e\200\0324;\235"
+	.text
+	.section	.gnu.lto_.refs.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375 ?\371\001"
+	.string	";"
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	"\003\002"
+	.string	""
+	.string	"\004\005"
+	.string	"\002\005\001\003\001"
+	.string	"\001\004\002"
+	.string	"\t\006\001\003\001"
+	.string	"\001\004\002"
+	.string	"\002\001\005"
+	.string	"\002\001\006"
+	.string	"\002"
+	.string	"\007"
+	.string	"\002"
+	.string	"\t"
+	.string	"\002\001\n"
+	.string	"\002\001\013"
+	.string	"\002\002\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3869e30b1174bf56,"e",@progbits
+	.string	"(\265/\375`\253\017\265M"
+	.ascii	"\312\202\260\034TPR\336\244\003nE0\373\341\006\216P\315e\025"
+	.ascii	" \211\356\222"
+	.string	"\324^\375\214&&Qq\270V\326c\357\\-\225\320\b\343\327\232\245`\024\022\210\246\326\203!TR`\360rZ\016\330\373\347\177\360\356\f3\270\246\255\350\376\365\323\006D*3|\374\263E\2204)S\177\001\264\001\276\001k\304\226\331\352b\217\370\222Y\"n\303\253]\273k\017W\241qIa\361\213\003\375\272\030kii\353b\374JQ\237]1\362\252\030}\206\273b\374B\321o\017\332b\231\306\366\213\330^99\241X\374\ncb\024\311TUU\020_\261\223\261\360Q\225\245D\033@a\273\354\270\360S#\002\365\342\202e\266\305\207-_.?\021\214\025\356t\263`4gp c\361f\253\345?NN\032 F\236`\361_-]kf\f\2313\026\267k\263\324\376\331-\036\257\307\3429\240\247A_\265|\253\bo\262\300\212\bY\\!\357\326r}\205K\345D0\276\343k\255\356\272B\261\233\267{"
+	.ascii	"\317\356\0016_IxRF\361\027\320\177\247\374\233\265Z\033\254\375"
+	.ascii	"\234\316\026v\327\024\254\304\207\0223\026\327\311>\331\372\257"
+	.ascii	"\005\342\033e\245\034\307W;\330\335={$\314<\302b\213]1\212\021"
+	.ascii	"\320/\224\023\300\353\206q\246+tw\337\354\277\306\327]1\322U"
+	.ascii	"1.\360\257\320\016\375\033\343_\007\376\215\240\204\177\033\330"
+	.ascii	"\007H\370\027\306\022-\004#\260\370y\207\333\374\274\344 \374"
+	.ascii	"\\\303k?\317p\3769\310\277#\374+\302\277E\377z\360o\007\377n"
+	.ascii	"\360o\215\177_\374\377\362\277\313\377#\376o]\312\277\027\374"
+	.ascii	"k\301\277\025\374K\301\277\023\374\347\372\037\374_\364?\200"
+	.ascii	"\377c\377\307\264\264\264\264\177%\370\231\352\337\311\nj\252"
+	.ascii	"\260\310Hjb\320n\340M\261=\2612\002\f\t\265\251^V\305\3106\260"
+	.ascii	"\031'0P\221\232\342\"[\231j\317\276d\253\204\257\273\251\226"
+	.ascii	"\211u\002HA\027\325>\301\347\016\243|\332G\206V\026\024\264T"
+	.ascii	"\300\32601\212\f\344!IX\261\024\023\331\312\347\371\\(\270\211"
+	.ascii	"\307L\321}\203\032\253\223\177\374\203\307W\033H\214\263\016"
+	.ascii	"\032 (H\307\311\206!&\025g`\032\266\362\020\226\001\212c\330"
+	.ascii	"aTm \245X\220.gC\030\b\277\300\242\367\323\240\213\2312\352\205"
+	.ascii	"\244\313\221Q|\rH\f\347([\013]L\214\020\3020\344@E\r\273\260"
+	.ascii	"\370\032\023\025r\037Kv\214\241\375\f\0079\231X\365E\210\223"
+	.ascii	"3z^\202\236\317P\376\301-\260\323\016\2053\302\220\225u\267\017"
+	.ascii	"~\332\312?\270\307\305\332-\\)?v\030%\201\230\022A?A<J\230d9"
+	.ascii	"\031C\305\036|[`\330\005\346\3216\033\331\220/\2540z\326B\317"
+	.ascii	"W\350\016f\332\312M\354\373\016\261K\374\247v_\351\356;\360\017"
+	.ascii	"5qs\217E\357WC\n\212\262\356\372\325\372\207\270i\243\3304\026"
+	.ascii	"\275n\251$\006\2201\0132\344\254\273\376\004\005\335Pq\201\202"
+	.ascii	"d\024\317P\364\347\336\231W\213\341\207EM\265\t\213\"\223\204"
+	.ascii	"\315=\323A\202G\223\371\240\253f\321\266\026\260kjf\224\326\262"
+	.ascii	"\255i\262&\n\026\317L\364[\300\270i[\300\370]C\277f\364\233\004"
+	.ascii	"\375\0167M\317\326\324\023\037\300\350\242\331&\266\256\331\305"
+	.ascii	"(g\265\325xB\300t\001\215=@\3437\013\335\336\242\373\323\204"
+	.ascii	"~\255\350\265\354\2121\\:PG\200Q\274U\333\301D\354\344-\246\222"
+	.ascii	"\263\345"
+	.string	"\312\016K\260\226\215\b3=~,^\364\361\035\273\201\330\324~\352\355|mv\201~\333\326\026\201\377b\367\f\254n(M4A\231t\361fx\213\006\3526\237~\301)3\305/\310\353\337\224!0\305\2576\021\001:H\325\277z\232\342ir\327\366M\001\333w\232K\277\332O]O\323\247}@\237_\345\231\277\340\024p\177\301\023\230\242}m\266\217G\204\372N\340\357\313\t\364\371\005y\300\237o\n\270]\317\3361^u\312d\352 \317\326\335N\325\312\334\351\346=\265)\004\367\350\251\262\036-\325;lR\251\272\273\333\024\226)r\342\324^\017\177Xg\nL\335e\272\307\003\346\232M\3353\267\233\251>u\367N\023\242\316%\323\364\324\266\366\361\234zE\316\035\246\336\331\324XD\026\370\013\0269\207\266P\tZu\257\232k\325e\246\236h\320\254-Dc\013VE9E\341${VD\221\035@\214\365\374"
+	.string	"\005\355\211\352\265RWfiP\\P\237\227\025\255'w\222C\004\230\254\223E\326\372\331\t{\202f\242\241V|\305=0\026\363\300;\360\022\376\201\231p\023\366a+gm\2263\016lD\210\"\274\f\221\265gV\310c\326\376A\224E\352\212\263\266\214o0?\250\"uu\005\f\214UX\230\375\242\032\263\0223\024\013\363\362\305\3149k\223X$vh\304\002\255\256\262\275\202e\277\274\204\021\223\265c\026\fX\020eV\262\370\b+\021#u\025T\003F\341j\362#\262\016d\236\246\244\301\342$\234\203mkL\006\036W\235s\330I\303\024\245\021Y\2223xJ\262H\207\314\355J\\\216\\\312A\202@\346v6vR\224$\215#\034\371A\317_\024)\345p\030\330n\204\224#\223H\024\350\037\210\301@\f\bV\270)\237\302\213\004d"
+	.ascii	"@\2268\034;#\0348#\234RwCZ*"
+	.string	":\201\234q\253a\243H\2074J\302\225\272$$Z\336:\250!&!\331H\322\031\215HK\272\232\356&\203\250\206\216\f\242\0328\243\021\021R\355)\274\320\355\006\270\322\022\231\023*\225\224rB:\272\333\006G>9\262\324\341r\214\345\r\202\033\235\216\314\035\035\341nH\0358\034E\273\245\034tw\243\272\033i\204\244\203\234\241\333\335\320!o\344\022\013 \350v7p\310%\026J\335\356\306\215\016\362H\267\2731\336\216\310$\244\0339\224\214l\345\216\226\267\030Ce\022\322\216\262\200\303A\036\335\226v\264,\313\245\016l9\\\251\243K\273\333\021\216\314\335\344J\033FI\273\fJ\222\006\217\356\246\203\234\201\263\264\273\225$\n#\016%%\fn6\345\215\310\2012\t\351\346CC2Z\204\300\001\rj\364\202T\001w\302-G\226d\016\245\034\356\206\220.G\352@\312\035\t%!\341r\b\031\345tB/\030"
+	.string	"\303eC\013\302\251\314\027,9\247\2610,\212\2111\026"
+	.string	"\226\364\215\030\033\256\212\020\362\365\305^\266+\nH\034\223\201\013\022ag/=P\225\007\032\213\f\266\301\361Ge\242,8\036\201E\244\211\305\333\360\360\362\332\340q\272\247\254XA\261e+o\331\240X\033\230\323\302\371\324\n\\<\323\325\3059$9\237\200.\216Y\261\302X\\\260\272r\306\222\023F\210\221*\242\025z\226\302\301\363\224\377S\230\213v?\335\034\031\nqv\326Q/"
+	.ascii	"\375,<\007\201@\250\221,\251\0244\"3\"\"\222$I:Q\005\204\030"
+	.ascii	")!\254\016\022\240%=\217:jd&I\241\306\264\035^\024\317\344|:"
+	.ascii	"\230\252\264\013\347:\n\001\233v\350\303\255;U\320D\2676\352"
+	.ascii	"\316\354\201\300iNC\302h\253C\fi\370\035\244\035}z4,\222ztWy"
+	.ascii	"\232@3\340\223T\324d\022)\324(\250\307\bRu\233\023>\201\262\030"
+	.ascii	"\376n7\3371W\236\252W\334 \360\2551\261\260g\375\267\0167)$\001"
+	.ascii	"V\203\346\351\220km\306\325\273Q>#"
+	.string	"\020\262\252\273\b\034%y^\372\326w\214&a\003\236\273\370>"
+	.string	"0\315b5\024E5C\305\255\215\347\203\346MNQX\242\332\277=\367\016k\331\253S\020\340\020\252\344\332\266\342\324\204\2768\312\312LU\230\325\\\206\031\235\370AT\027\277\234\b\022\307\274T\222\376~\354\230\251J\377\237s}bz\244.\246N~g3\324\033\"2\324h[\024"
+	.string	"\342\232O\315\032\004\265\246x\233\263=l\301\262\357\240\20169\234j\355\320\201\237\376`\027\250\232\237\350\341\313\024\273\304e&\247\302\262>\017\031\372 @\nM\202\343\247S(\277\0020CeM\204\376\262;\333\340\274\342\332\350r\344\021,"
+	.ascii	"\225m\177\345\201\0324?\f;6\320\231\367\235\220Q\261\3204v\213"
+	.ascii	"\247FN\374\363C\030\021\243\b\343P\251tF@\212\230*\n\005\245"
+	.ascii	"2^\t\327 \200\025\214g\241\232u\334I\212\330\026\250\304A\002"
+	.ascii	"\264\354\206b+LJ\367I\037l\315\215\342\217\300D\302P$\315\354"
+	.ascii	"\332\241\320\262\326\352\r\223\2329\333\340\270\231muz\374Wy"
+	.ascii	"\305\304\306\232))\365\t\236s\255\225\005\322\0260w)\311<$\335"
+	.ascii	"\022{p-?N&e1t\324\215o\317\265\022\316IR\262\2079\255\\\024>"
+	.ascii	"\322E#}\214\006\200\262\303\362\200C2\026\b0\213Qyfc\204F\326"
+	.ascii	"\241k`FrZ\013J\237\274\023\234(<aE\032\\ \232\276-VI\321\321"
+	.ascii	"\342n\004\024O\331\322\227\346\202P\037\253\325\0055\2011\305"
+	.ascii	"U\023\214&\2075\366\263gy\267\3147\022\316L\276\350{;\256\226"
+	.ascii	"\006\001\310\260x\032T\016\"\256\337<\035\370L}\347\366\367\317"
+	.ascii	"\275\273` `\004\346&\205\327\304\363\355\n\353\302=\351w\242"
+	.ascii	"%}H\030nx\270\272\226\353\202\005\274\205\002;\257\352{\342\251"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symtab.3869e30b1174bf56,"e",@progbits
+	.string	"fakeBaroSet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"fakeBaroDetect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3869e30b1174bf56,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
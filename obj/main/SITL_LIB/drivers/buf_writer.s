@@ -0,0 +1,258 @@
+	.file	"buf_writer.c"
+	.section	.gnu.lto_.profile.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.text
+	.section	.gnu.lto_.icf.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375 _\265\001"
+	.string	"$\002S"
+	.string	"\003"
+	.string	"\264\374\222\305\003\b\002"
+	.string	"\002\001\002\002\002\001\002\003\001\215\257\275\277\013\016\356\254\210\376\004\b"
+	.string	"\007"
+	.ascii	":\rTu\225R\034@\0012\211\261\033a\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375 7\005\001"
+	.string	"\270+"
+	.string	"\003"
+	.string	"\004"
+	.string	"\003\001\002"
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\003\020"
+	.ascii	"\031\351d\303\002"
+	.text
+	.section	.gnu.lto_.inline.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"=\007"
+	.string	"\262\213\"'\200)I\007\230\t\231\315aB\256\001j\b\322\035P \"+\372"
+	.string	"\234\347\212\201\f\027\020JXhQ\263\244m\"e\n3\314\254\345r\244e\226#1!\372\206\266\351\027\221A,y\ng\242M\002\363\203\207s\375"
+	.ascii	"Z\327Y\214\253Q\214Y\215\202\227\027\345&\001Le\"\2549\r\230"
+	.ascii	"9+\034\267\242#\356\r\202Nh\260E\316\203\240\204\f\243\267@\207"
+	.ascii	"6\021\274O\340\234\217\3057l\333:\177q\333{\234\210\266\312\237"
+	.ascii	"'\021( \220\002\251\243\371D>`8\220\273m>^)\203E\210W\210\031"
+	.ascii	"\335\rf\261F\304:\213\231Y\207\227\226\212i4W48\360r\330\307"
+	.ascii	"\311_t)R\343|] SZn\272\003\204q5s[\236Xa5\021\017\320\r\234\235"
+	.ascii	"\033\343(Jn\217\314\260\335\312T\270\"\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375 \251\315\002"
+	.string	"\342\005\021\032\260%\351\f\243\034\300\216\345\341,9|t\030\350N\003A\331\266\2157\221I\006\033\331\206/<\341\331\361\034\331\347\035J0\377\334K})\276\225d6\231\267*v6\360\274`\t\226X"
+	.string	"\373\371\247\215\r\002\006"
+	.ascii	"E\310\200hQ\036\201\265\234\0052L^6\320\006"
+	.text
+	.section	.gnu.lto_.pureconst.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375 \321\335\002"
+	.string	"T\003\305"
+	.string	"\003"
+	.string	"\004\270\007"
+	.string	"\001\002\013"
+	.string	"\003\002\007"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\300"
+	.string	"\300"
+	.string	"\002\b\300"
+	.string	""
+	.string	"\200\001\b\020\220\001\220\001\210\001\b\177\b"
+	.string	"\002\210\001\b\b\b"
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\241$I\350c%\023\323\2711\202 \202\205\240 h\345\300\212\214"
+	.ascii	"\241\216\274\364\270,\360E\004\220\341\006\332"
+	.text
+	.section	.gnu.lto_.lto.59613ff78378fc2a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bufWriterInit.3.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375`>\001M\r"
+	.string	"\266\230YD"
+	.string	"\261&\035\233Q\304\325\211g\023\207{\376\354\357{D\\\017\334\251\221\232\231m\024\311\356V\245|\215t\337\036'\236\236\243\206\243h\274\336\245\377;\205\025\304,3n\3360\200n\373\240\2315bw[\271S\nC"
+	.string	"E"
+	.string	"H"
+	.string	"\007\260\253Za\263\333\201X^\207\266}\231\223@\231\363\350b^DdZN\330\330\355\244\273\007\210\207\327G\361P=\234\373\343\374\327\234\300*F\312%\345\317\223`w\375R./\267\336v\001\333\013\354\327\004\277\347\253\037~\346\327\370\374\342\363E\037\326H\306.\206\026\216\305\2017!l\243\354\220m\310r\316\007\005\235\325\311\243cYL\\\020\321g\277{\t\324i\354\302\237]\016/lv\027\304\007\256\303\217\216\337\373L\205\0266\254\274\226Az\375\260\264h\311\361R\264\263\263(\tP\211\250\341Q\373\344*\2343"
+	.string	"\346\006T[{\212\323\265\273\b|\024\023PD1 \016}.\036\032\200\031\241A\345\265\354.\345i\007\373\235U\225}\232\037tV&\223\244\021\243\220\231F\034\2206m\003\221\334%!\023\333\262y\032i\020\201D\232&&!\233\f\344\203\214t\"K\246I\206|X\203\200M\271i\332\224\241no\253\242d\300Q\321\025?\265M~\363`\244h|\306K\361\372\364\001\032"
+	.ascii	"\253s\240\314\2000L\326\004\026(W\004\033u\020$\310|Tp\214\312"
+	.ascii	"\201\3511\033\3132\327p)\330\200Z\013\034\r5\340\036\030\006"
+	.ascii	"T\020\2400\fS\t\221\341D\021\332\004?\235\351\b\223\f"
+	.text
+	.section	.gnu.lto_bufWriterAppend.4.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375`E\002\345\021"
+	.string	"\366`qE\360\262h8x\321f[\347q\327\301s\322\235\005\221F\2763\275\304\031\351\251\266\206\276\247\260\335C\177\277!\310\341D\324`\212\021\207&\306]\317\300s\222\235g\266z\t\266pH5I\243Y+\332\266\367\2262\245\\"
+	.string	"T"
+	.string	"`"
+	.ascii	"\27305\030<\355\243x\212\327k*?\355\306\270\320\331\025\027\370"
+	.ascii	"\023\235\263\370\001\3359\321\003t\347\374\262w\024\340@\202"
+	.ascii	"\341\262\302\307\356~*\342\257w\233\346\313\017\205\214d3\330"
+	.ascii	"\273\227o#K\252i\326\262\241v\3676\317\016\263Xf(dw\235\262\331"
+	.ascii	"\207;t\333\023l;\260\223\026\212`\246\246\266\222A\266\030K\225"
+	.ascii	"\261\277\355\356ZclQ\332\024J\2274M\352\322\336\305\177\364\332"
+	.ascii	"\037\342\322\233\246\225K'\227\376\311\303\021\020\264\353!\350"
+	.ascii	"\307\366p;%l\337\277\371\350\272\n\033 A\263\273\3369\333e{\347"
+	.ascii	"\356\331\326\264\033<x]\f\255\001;*{z\300\204\317\267\260K\375"
+	.ascii	"x/\304M\016\226\374\311\335\205\251\312x\323\324\324\215\r\226"
+	.ascii	"\374\261\275z\214M\025\314\370\324Fj{\303sB\023mw#\330$\177\301"
+	.ascii	":\247\004F\200P\325\344q\001Jm\001\200v\031\217?\354\256\251"
+	.ascii	"\311\323\002\023s\311Y\204\242\335\205\340\343\234\230\210fT"
+	.ascii	"\272s\017\026T\231\272U \340*\205\005\272D*dH}(\340J\003\013"
+	.ascii	"\244\360]`\215\230|*\020\345\003A\271u\262\002\277\224V\013\374"
+	.ascii	"<q\3456\227P\323\263\242\261Net\376\321%\247\021\226h\tN\320"
+	.ascii	"\3648%IKjR{jT\213\302D>\303:LJ\302Q;\017\006\331G\223\\FI\365"
+	.ascii	"\206\354\205\244\317q\001\032=\3622 `\002\021it\007R\300\033"
+	.ascii	"\336Na9\201\327jG\220\345'BP\363\342,m\211\360n\315s\206M\327"
+	.ascii	"~\022\360\334\205\231)4n\005c\357\270\325\027\323\013)t@O\246"
+	.ascii	"\260\266y\266.\n\263\004\030l\324\241\033\363\\,\2738P`S\323"
+	.ascii	"\344tw\366\255\333\336\310\356\025\261+\331\030 C\240\276\367"
+	.ascii	"\021\001&\212\354\346\003n\026\256\210\310\300\306&\2502"
+	.text
+	.section	.gnu.lto_bufWriterFlush.5.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375`6\001\005\r"
+	.string	"\346\027UA q\232\016O\006\ro\023\272@\251\305\301\030\216\327\"\\\237\2561\013>\300\261\300\315\343\002\0375jy\207\b\301\215Q\353v\344\007\020\244\260BE^;\220\321\036\333\324\306\031\226\315oK\366\2262\245@"
+	.string	">"
+	.string	"E"
+	.string	"\207\356\336\221\016\247\017\220\016\215\3317\nT\330\304Xy\311\261\273Q9\034\373\323\304\374L\310\207\266e\177\032\256"
+	.string	"6\225\367\331\335\233x^\330R23!\273\353\324\266\f7\274m\005\266\021\330\007\021-#8\224\034\331]\226\312b\377\355\356ZE\366\271\177\222\322\020\246\337K\253\2463\323\327pRtF\273\030F<6\006\276\370\240\261\375\264O\342%\260s'\027\260+\202q\261\333\035p\234\002\207\261\215\315\f\002\035\240nhp_a\242\331\324U<8|\2522\264\rW\325\267X\351\341\352/\020R=-:rw3\265%]A.5Tr\207m\221\243\260\246\335M\340\237\030\2210y8\364O\244\303\253'\240;\004rQ%\325Ea\201\003\023P$\271\250\t\325\325 \216T\fDb\350\"\211 \037[\021\250+\226X\326\0255\335\376\255\212\fa\304\240h\312S\026\227\263\260&\216\201\020\"p\004H\325\247P\235\352\217\005\315l\207\002\035"
+	.ascii	"3\241\005\037\303k\2414\354\016\245\031\236\032;\240\334\253"
+	.ascii	"D4#\214\217)\r\252|]\233K\230\3549\\8\352\225;\202\257q\351!"
+	.ascii	"x\rUI\304e\217p\254&4\004\003.!4\253)\341n\006\003\026Un\273"
+	.ascii	"\212\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375 b\375\001"
+	.string	"\024\003^"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\r\005\177\016\004\001\001\001\265\007\004\002\201\200\200\200\002\001\365\001"
+	.string	"\004"
+	.ascii	"I\b0\240\007\370\341Zs\f"
+	.text
+	.section	.gnu.lto_.refs.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.59613ff78378fc2a,"e",@progbits
+	.string	"(\265/\375`+\007\245)"
+	.string	"*JL\020I\200\332Q:\231:u\374\244E\267R\211K\310[\271\244}\244\274}\3610\f\222\302\246\340\033\301\\\253p\200j?\272\334g\373\261\325y.\273\351\226W\355q\210eOQ\313\034\222\231\3550\373\024\017\261}a\251\r\322\266L\001\323"
+	.string	"\366"
+	.string	"\357"
+	.string	"\367\220>C\372\013\351\207R\316b-\276\002\342*6\025\253\325\345\3464\231#\347\242\207\220\236\201n\274\306@\267;HwL\340\266\343\002\267\237\227Qpk\310\204f.z\276\342(?W\261\025c\331\326&\266\263\272\333\036]\326\030\216+\027\375Yy\306\372%T\370\031O\267Uw\377\240bJ8J.\312mZ\244\211\216\032\027e(\177\322Pk\330\270\350\325v\320'\257\252\260\213\236\237|"
+	.string	"VW\370M\337r\201[\312\004n \304v?\247\371\257\344\372\362\237\013\326\200\237\307\376{\371\377\305\004\221\373\331\315\377\264\377g\377\303\376;\377\213\371\237\342?\327\377*\377\177\376\203\370\337\374\037\346\277\330\377(\377u\377\301\374G\327\326\326\326~\376\371\271\347\3279\013M\354V\271\233\335\255v7\200bT\333\335c\267&\211\304n(\037bG\251^2\272oVY\227q]\"Y\236\327\224e\262g\264*'\233\354XL\227\252\262\233\272\233\323\322\2441\307\2321_6\"\306\034\253\223\267\306\2045\t\305"
+	.string	"\351Z\035D\251\346\237WU.\361r\303\\,\247<\016\321\272h\230\317u\226yz\222#\375\004,\334\325U%\205\311[\370K\200\255;\b%9\301\noq\023\312\202\223'l\365\363\230|\345\317\037\341\312A\211\025Zw\013\206\273\360\027\366\302`|\305L\366:ga-\367i_\341\347)\314d*\274\365#\354\006\362C\247T\233\361\343Mw\033\024\024\024\344\023\224S\2532\343\342A\317_[#\272\207\335m`\007\f\2260\251\213\236w\346r\002\267\"T\333\272"
+	.string	"C\264\364@s\321\367R\366\t\2212\027\326\016\025\224\030\307\213\0067\234\320\260\027n\306\221'\345E\371\f;\221S\306/\027e\262sA\257\250<\225]\224\307\270k\007\te\003\307\023\327\305\bRl\231\376\376\267\016\026\273\033\207N\333E!\317Y\207\271\301\237c\0333h\333\r\230u\357@\302&M\302\025\364q\321\377\013\232I\267\332\323m\027\327\345Q]\2458\215=m\0071\320K\251^\333\243\021e\373v\333\334\303\243\221\305\332\262\305\265e\325]\017Y\265\2735\356\326\254\240\312\353\362h\\\227\254\261\247\207\255\3662\030$\035\262\306\025\2145\356\326e\320\270\016\217\306\036\035H\204\200\321\230r\036a5\353\260\235\210Q\301\342\256\271\266l\223us\226\214.2\350\216b\213d\301\035\334%l:\t\255\004Yn\273\373"
+	.string	"Q\210d{\330\\\251\330n*!\212&RP\333f\027\341\246*\025\325M2\272\021t\333\001(\226\230Rh\020P\"\tII\t\203\356G@_R\207\334\217|?\244$\244\023\351)\f=\030\"z\001\340DE\021\212\"\334NT\304\343\025\r\361\322\017\361l\300\243X\360\025JH?!\340\212\025?!\\\017\330+\201.\031\375p@#\021&\230H\004\270\235\370\365l0\200\276\243\236R\357(\005\032\021\001\223|L"
+	.string	"\200\275{\036/\303\202\020\0376\244G\020~H@\337\317\205\221\t&\022BK?\244\026\276_\t\241$_O\205\320\321oI\b\202\202\253\251\261\233T\355\242\255\033\210Xr\207J\f\347\2306g78#<\230SO\035X\034\341\221\213\376\n\321\3208m\327B3,h\314$c\352\232s\232\262\254\013{QV\303O\334\324\330\024\036\274\245\203lc\306u\321sZz&\303e\316fn\206\317\322\356\242\332&"
+	.ascii	"\342\264\205\331PP\rx\326\024\265\264\312\316g\374\274R\220U"
+	.ascii	"\222O3\224\352I\035\206\345\220e\001\200\216\250\3014\206\024"
+	.ascii	"D\"2\"#)h!k\240\002\021\261\3346\021\2205sF\212$\251\354\317"
+	.ascii	"\001\302\375\331\177t\005\236\262?H\352\316Q\215\215n\302\206"
+	.ascii	"\306\245\207?a\343\274i'\0224\343\031mJ\2438\314P\370H\031\t"
+	.ascii	"Nx\377\031\267\274r\240\246\304\016\370\222ql&\301\032\314f0"
+	.ascii	"\324\013\2771*P\222\006\336\276\3413\003\221\033\213\374\212"
+	.ascii	"\001\263#\316\033\215\312\0331\215\377-\021g\tiP\347\311\351"
+	.ascii	"\244\233Rc\243O\004\244.=m\031:\035w\325\314~9\230\372\001\036"
+	.ascii	"\243\336\314\221\360\004\006\021\020d\320\253\333\240\340\207"
+	.ascii	"\2379V\022&\330\212\232\207K\3320Fm\257\026\333\357\335/\321"
+	.ascii	"c\304\017\2743\t>H\272\2246P8\222\316\017\300\377\037x\003\234"
+	.ascii	"\230f\254\3769C\370\252\220)\035\0352\372\302a.\254#\241W\345"
+	.ascii	"\241\374\3245\353%\302Qml\376n\"\007k\223G\344`~{l\274\305\177"
+	.ascii	"=c\007\376>\345\257\3626\356\261\200\336\202E\275\375\006\037"
+	.ascii	"\250\306\350j"
+	.text
+	.section	.gnu.lto_.symtab.59613ff78378fc2a,"e",@progbits
+	.string	"bufWriterInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.59613ff78378fc2a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,495 @@
+	.file	"bus.c"
+	.section	.gnu.lto_.profile.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375 [\335\001"
+	.string	"t\002O"
+	.string	"\013"
+	.string	"\265\230\240\355\006"
+	.string	"\001\002\003\004\374\337\303\241\005"
+	.string	"\005\006\007\b\267\335\335\337\n"
+	.string	"\t\n\354\301\314\336\005"
+	.string	""
+	.string	"\b"
+	.string	"`0\030\f\f\001\006\203\301\300\020*\343l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375 \2635\002"
+	.string	"\204\002\247"
+	.string	"\013"
+	.string	"\003"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\001\002\003\004\004\003\005\006\007\b\002\020"
+	.string	"\007\003\t\002\003\n\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\f"
+	.ascii	"AQ\001\027\002\217\001O\330\364\270\222\003(\020\310\f\310B\246"
+	.ascii	"\340\035\3630\300\002"
+	.text
+	.section	.gnu.lto_.inline.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"U\002"
+	.string	"\224\002\216\001"
+	.string	"\013"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t\n"
+	.string	"\r"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344\001$s\0249\233Kp\023\217\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375 \263=\002"
+	.string	"\304\002\247"
+	.string	"\013"
+	.string	"\003\001\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\002\001"
+	.string	"\002\001\001\002\003\004\004\001\002"
+	.string	"\002\001\005\006\007\b\002\003\t\001\n\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\n"
+	.ascii	"\256\202\233@ \360\030\360\204MO\317\344\006\310\007dV\246\004"
+	.ascii	"0h\003"
+	.text
+	.section	.gnu.lto_.pureconst.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004\n\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375 \235\245\001"
+	.string	"\270\221"
+	.string	"\013"
+	.string	"\003\002\002\002"
+	.string	"\001\002\003\004\004\002\005\006\007\b\t\n\001"
+	.string	"\f"
+	.ascii	".\005_\f\313\312\020p\0348\0308\"\2461\200;\3001\230\\\200l6"
+	.ascii	"\200\005"
+	.text
+	.section	.gnu.lto_.lto.513a75df5531529d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_busRawWriteRegister.7.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"-\b"
+	.string	"\302O87P\215\322\001`D\264\204\330X\243)\365mC`&\232\nQ\271{\2779M#\320/\263m\231pg\234\264vDUE\200\315|\275\235\374\3348R\266E\262\311\336)\005W\347\302\252\207\214\306O\206m\036\215\345Mf\363h\346F\263\017\207b3\202sA\314\r\335f\246\300\232DFgG\323\350\264\324\320;\313 \024=\273z0f\330\257vw\035M\366\277\277z\375\341O\377\245\303\b\344\222\332\255H\241\326D\216l\330\346l\213}\002=`\275\223\013\205\n\276\202\034w1P\023B\373\034\357\340\376M\\`\327T\"\262[\021|P\271t\375\200uY\371\305\272\264\355\204\005\316\035\201(\242|\243\217\224\335:\243\306\273\303\316\277\3071\242\020R\211\342\020\240aw\rI%\213;\3366\3066\203m\222\r"
+	.ascii	"2\003\202\341\243a\215\020\220\270\006\242L(\2400\030\346\023"
+	.ascii	"\355\300W\202\221\003\2500\235k\222\001"
+	.text
+	.section	.gnu.lto_busWriteRegister.8.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"%\b"
+	.string	"RO88Po\322\001\240\363%\0068"
+	.string	"\345\250\263\353\273\213\020\r\314z-\003\242\362\232\266(\337m\267\266\f\266|H\324\256\314L9\216\315_'P\006\"O\n\266\232\020\"wJ\001\232H\333.\bN*\211\333\274\321'3\310\343\215>\321\223\034)$\267(\021\322\"\"Hz\321S\340n\202\223Q\324u2r\346\376\313\f*\024e\317\023T\017\373\327\356\256ue\237\365CU\214TI'fW\243\206fY\260\024\020\333&\233c\217\224\036\260\250\226\f\206\013~\226\254\273\0343\021B\373!\0271\235Eq\201\335\225\n\312\356Tp\302\346\230\347;\331\261\315\007\262c\266\275\320`\362G`\241/+\251\226\314\356\214\372\361\357\360\363O\362\003\230V\207\213\211\352t\b\360\260\273\206\027\252\215[o\033\301\266\203\355\223\r"
+	.ascii	"2\003\202\341\243\302v\025P\\ST&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\334\001T\234\3275\311"
+	.text
+	.section	.gnu.lto_busRawWriteRegisterStart.9.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"5\b"
+	.string	"\242O87@\217\322\001X\360\344\tp\235\022\274\331\354\302v\030PA\357nc14\334\"\004y\376\326\326\341\367\361HKUE\361\004\376\004X\306\032\240\344\332g-\222\275\367N)\227\347\302\342CF!(\303\266\317\3062'\263}6s\243\031\250C\261\031\321\271 &\207n3c`M\"\243\323\243itbj\350\235u\020\202\"\273\212\036\354\260\037ww\rM\366O\177|\375\337Q\377\245&D\305R\260\332%\255Z6E\236\200\330\346l\214\215\332`\210\357u\342\001+R\271\230\357\331\027\371\b\367\023\305\005vM+\251\335\252\340\204\313\245\353\t\254\313\313\007\254K\333^\320p\356^?H\347\300\260(Q\355\326\t=\336\375u\376I\036S\032&\243R\305\037\200\303\356\372\215J\0317\274m\004\333\r\266Q\002\016"
+	.string	"2\003\202\341\243a\217\020\320\270\006\256L(P\016\f\006F\370\004>\360=0\227"
+	.ascii	"\025\307tM2"
+	.text
+	.section	.gnu.lto_busWriteRegisterStart.10.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"-\b"
+	.string	"r\21788Po\322\001#vm\036t\\\217O\235\2707\200\211\276\341?\0020l#lX\004\321m\267\266\f\266|H\324\256\314L\361\346\"~\235@i\b\017jM4\331d\357\224\002\231'\323,\211\215F\320\246u\237\315e\216\246\373lfG7P\207j\223\242\223ML\016\355\246\246\300\\\305F\247\207\343\350\314\324\375w\035\\\304\221]E0v\330\267vw\035O\366Q?\214\020u\2452p\331%\305\274\254\212D\t\261\355\331\031\233$\364\200\035\255l4X\3605\344\270\313\0013!\264/\362\021\357(\213\013\354\236RR\273u\301\n\330\245\353\t\256K\354\003\327\245m38x\376^?H7\201`\230\254v\353\214\036\377\016?\377%GP\265\230XNJ\242C\200\210\3355\314(i\334\361\266\023l?\330N\005\r"
+	.ascii	"2\003\202\341\243\302v\025P\\SX&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\\\002T\234\3275\311"
+	.text
+	.section	.gnu.lto_busRawReadRegisterBuffer.11.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"=\t"
+	.string	"\006\021?8@\255\322\0010\360Hx\377\\2\376\273\332\374\275\n\303\216)\277\006\303\002\r\354@\370\257\255Q\375\177h\240!\314Qt\211s:\377\214\204\277\016h\226@\250\356M\366N)-"
+	.string	"0"
+	.string	"*"
+	.string	"\366BC\311\337+H\352\035'\032\261\331n\245\361\343\337\341\347?\366M\266*A\2510\016\001\"v\327\020\245\342\270\343m#\330~\260M\013\260\226\203|\215\b0\233A\262b\330\340\253\3051{J\331\240\020\332\037y\253t\327\305\003vY*\262\335\252\340\004\313\245\353\007\346\245\345\002\363\322\016\361d\327\023\214\036\366\267\335]G\226\375\327/\357\372\267\327\037\036\366\177B\210\314V\fj\273\251\032mQ\244I\210\355\222}\261\003\022\"\017\210\233\230\032\221\246\263y\270.\222\270\2167\332Ls2\336hC\275\216#}\272\016\005}4\024\224\323y4S\340P\005\327QQ(\324\321K5\375\233\007\246\021"
+	.string	"2\003\202\341\243a\231\020\020\272\006\"M(P\016\f\006F@\270[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\306tM2"
+	.text
+	.section	.gnu.lto_busReadRegisterBuffer.12.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"-\t"
+	.string	"\206\020?90\221\322\001+\370\345L\303\013\035o\351\242\336\033\237c\300\361\231\2446\216\233\326\217\355\321\265\3370\345\256\177\254m\031\f\0064p;\275O\256ir}\323\3212B\310\336)\005-"
+	.string	"."
+	.string	"."
+	.string	"\016+\207\257\"\256\177\324h\310j\273u\312\220\207\217\241\177\331\021dXh/*/\326#@\304\356:n\2748ny\333\t\266!l\303\004(\002\317f\240t4l\361Ue\271\353a3c\264_r\223\325c\027\017\330\205\265\314v\353\202\0258\347\\?\320\235\343\\\240;g\333\f\001\007\030\262eWV\224 \366\267\335]K\230\375\330\037\245\304\254\026c0\263\353\272\241Y\027ne\304\366\312\356\330)\252{\266E#y\340N\002\023\247Q\351\243\350\274\223'\332F\037\225\251O\004\242@\235C\037\020\005\232 \375R$*\232%\222W1C\024\234\237\002\233,>:O&\023\235\235\272\017\273\020"
+	.ascii	"2\003\202\341\243\302v\025P\\S\222&@P\"\030\001\341nU\030\f\363"
+	.ascii	"\211v\340+\301H\002T\230\3275\311"
+	.text
+	.section	.gnu.lto_busRawReadRegisterBufferStart.13.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"M\t"
+	.string	"\006\221?:0\305*\035@\b\340g\210&\312\310\201-\332\3612\224\"\3233\fh\331\373^\321\300x\370\355\003\302W\377\345Q\0131\"\202\304\3204\336\220J\026-o\020\250\255{\223\275S\n-"
+	.string	"0"
+	.string	"*"
+	.string	"6\203\303\310\337\353\307\351*\326\006L\266[i\364\370w\370\371\207]\213\255LL\250\214\303\200\210\33554\241:\356x\333\b\266!l\317\002/\222\007\351\n\025\\VCd\325\240\301\327\213_\266\204\302A!\264\017\362\220\321[\030\027\330M\245\304v\353\202\023*\227\256'\230\227\225\017\314K;\261d\327\022\214*\373\332\356\256c\312\276\353\227o\375\332\353\017\377\372?%\252\f\200\302\310\356)\300lOd\t\313\366\310\266\330\001\023 \216\207\243\230\033h\333h\034\256\213\"n\343\2052\323\032\214\027\312P\257\343D\235nC=\235\255\202j:\217b\f\374\261\340:\n\372|:j\251\244\177\363\200\024\021"
+	.string	"2\003\202\341\243a\231\020\020\272\006\"M(P\016\f\006F@\270[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\306tM2"
+	.text
+	.section	.gnu.lto_busReadRegisterBufferStart.14.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\025\t"
+	.string	"&\320=9@\217\322\001X\360\223\355\226\036G,\270\217\265\004\217\216P\030~\"V\273\373\306\032\362\275o\033\013t\240\372\205\264TU\024?\354\203\222\225n\216\373{\352R-\022B\366N),"
+	.string	"-"
+	.string	"-"
+	.string	"(\207\257\037\253\273T2`\262\335:\245\307\303\307\320?\354\0072\263\230K\n+\365\b\360\260\273\216\032\254\216[\3366\202m\007\3330\001\234\3050\001Y\320\342k\3059\253\212m\314\030\355\213|\004\365\227\305\003v[/+\273\265\343\004\3157\327\017p\3374\027\340\276\331\266\002C\0179\203\013\251\262k*J\227}mw\327\262e\377\365GI\301!\213\351\240\354\256f3\333\262\261\204\330F\331\033\373\204\244a+1\021\004\020\245\320\350\213\340\272R\347i\241\217\312\323\347\201\246\017g\220\0074}&H\277\223\210zs$\352$&\210\202\323S`\322\304Gg\211D\242sS7\021"
+	.string	"2\003\202\341\243\302v\025P\\S\222&@P\004\214\003\303@\020[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_busBusy.15.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\225\007"
+	.string	"\262N55`o\032\003TN\020'\210\007@\203\345\322~\200\301]\244\025h\2149\030j\333\"\302\310/\366\266\003,u \b\210Z\027\245\267\242\211\002\004\277\215I$eJ\001\022\223\362\202\242\353\223\205:V=\234,\324\211\231\274D \371\211\022 \210\210\350\221Y\344\024\024\233\270d\244\3000\0317\363\336,\003\214\227\321\316\221{\247\326"
+	.string	"\377\337gj\255\262\335\253\370\n\306\301\345'\315\310\234\005\246\204\264\325\332M\3337-\336\206;\275\244V\242s\255S\036\321\254\272\260\300o2A\371\247B\0234\206\235&\260\f5\036\260\f\333v\241A\353\346\tB2\252C\243d\365\317\370P\336\354\266\332$>\210Q\371h9)\215\354\002\036\376\327q\224<\334\347\266\bm\031\332\212\004\n"
+	.ascii	"2\003\202\341\243\302v\025P\\S&&DP\022\234$@\231y\265\223\f"
+	.text
+	.section	.gnu.lto_busReadRegister.16.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"e\007"
+	.string	"\022\01634`o\032\003\340\232\213\n]\020\333\034\\\375l\2648\325'\360\222\203\315F\223\026\304\221_\354m\375\260\324\201  5\002\255\267\242\211\002\004\277\r\355!eJ\001\020Vt \253\203}6\257\034\r\366\331@,Z O\354@\t\317C\004\344D\fj\nzMX\021R\\W\204\231y\313gp\3410\332\031j\256\2435\300\377\327\221\332VaB\2714\234~\321K\352+U\312G\333\254\315\264u\315S\326\375\034)\330Z\353\021\223d.\261\260\300OR1\375S\241\t\030W\235&x\2560\036x\256\312\220Uzz\210^I$\343\004\365O\350J\226n\262\266\211\017BN,-(\243\220[\200\303\3776\215\321\206\353\334\026\241\355B[\220\013"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\"\026\347\b\367\300\\\001"
+	.ascii	"\215\262\021\002\277\256I\006"
+	.text
+	.section	.gnu.lto_busDeviceRegister.17.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375 \365\215\006"
+	.string	"\322\f.1pm\032\003\240}C\361\200~\270\207\345\265\036H\306\343\267\310-\265\330$,\220O#\313P\330\256UU\201\277A\027l\240\345\303=\357\270\262I\231R\232\352\0223\225\250\026*f*/\302J\203\201\227\347\200ahx\026\030\037UP\353\241\202\017\302\262\340\233\346\335\256\032H\264\211vnX\303hM\371\377\266\253\265\307fM\202B%\n\237\277\342\304\344#.dcjk\326\232\303\035\322\236\b\013\374\227\b\350\237\tE\220\354:M\020\331I\036\210\354*[\022O\215\373\003B\361\021\372\377Z\206\245\231\254\355\341"
+	.string	"Ngc\006\260\360\277\214\323\261p\233\333\036\264\245\332^\004\b"
+	.string	"2\003&j\006.\034\203y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\245\002"
+	.string	"\224\003\n\001"
+	.string	""
+	.string	""
+	.string	"\002\007\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\005\t\177\006\n\177\007\013\177\b\f\177\t\r\177\n\016\177\013\017\177\f\020\177\r\021\177\016"
+	.string	"\013"
+	.ascii	"\200\036\340\033\340\033\340\033\340\033\340\033\340\033\340"
+	.ascii	"\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.513a75df5531529d,"e",@progbits
+	.string	"(\265/\375`l\f\375="
+	.ascii	"\372k\354\027DP\244N\007\267\tm`\237\037\034\30223\025\2619\266"
+	.ascii	"\025YH\363'\031\b\330*\207e\325\243\tY^\243\324\bE\026\302\303"
+	.ascii	"*/\037/\t\327\0251[\207\026\002\241o\030`\321\274\017@\324v\333"
+	.ascii	"v\223)\005J\001h\001l\001Ym/co\374\364\231\265\235\214m\207\262"
+	.ascii	"i\\\215K]\316\321\264k\361-\215\024\377\263\375\177O\350n\222"
+	.ascii	"s3\036\227\244\204\241\300\364\364\375\307\355Y\272\233\272\235"
+	.ascii	"*\270\234\223\361\267$\345?X\031\002;\266\035\201\200\3771\322"
+	.ascii	"\322\322\217\330\033\227%\253\3321\330n\217\353v,\236\305\317"
+	.ascii	"\f\341\255\347\253\375\307GC\"\360\230=\261\017\032'^YV\245\016"
+	.ascii	"\347k\361#\t\351i=_V\273\212\3656/\343\322\003\356\326N\025z"
+	.ascii	"\370z\371,\3771\221\210\320\n\241`V\273\005\333~`\365B?\260v"
+	.ascii	"\n\266C\260\315\201u\244'O#\246A\267\240e\265\037\260\356\305"
+	.ascii	"\277\270\324\301t;\027\217[\365\362\374\350\177L4L\n\251k\313"
+	.ascii	"j{\264\001\330}\205\016b\333\225V\242+\255\235Y\005.`U=\300\352"
+	.ascii	"\357\002V\243\330\005\254\254\007X;wg\026&\032\250\335\371\003"
+	.ascii	"\002\rI\027\nT@Z\273s\323Q\003b\002\"\003\335\235\242\013\273"
+	.ascii	"\333\247;\017\350\366\007\335\256\324\355\r\272\035A\267'u{\201"
+	.ascii	"nG\352\366\243n'v;Q\267\013u\273w\367\236\356v\353n\301\356&"
+	.ascii	"v\367\\w\017\025\026\026\026v\373\215\356\274\324\rt%b^\277\245"
+	.ascii	"\343\277\300\307\377\\\377\257\377\364\377\337\377\377az\305"
+	.ascii	"\377E\214`3.\256\177'\022\327{\275n:\376\263\232^\231&\034\r"
+	.ascii	"{6\271\201\211\232\375\216\370u\263\317\2032\331\350\333\345"
+	.ascii	"\267\354\260f\315.\277\234\314\377\203%.L-\253\371\263\027\346"
+	.ascii	"\267\363;\341\3202\277\372\237t_P\344\276\300\347LY\362\313\252"
+	.ascii	"v\376\301\267\273\272-\245\357\021\314F\222mO\262\252'^f\264"
+	.ascii	"\2578kw\3628\240K=\320\327\332\303\270\230\345\377\007z\027W"
+	.ascii	"knh\013t6\377\363\251\323\350\227|\203}KK\016&\216\320oU\337"
+	.ascii	"\270\237\034\263;n\307\361\270\324\377\332\377|\214\313\025\275"
+	.ascii	"G\377d{\314\376|\316\361\212\226\361\377x\002\374%\002KKB[c_"
+	.ascii	"/\253\366y\035\227\272\237\323\321s>\237:\343\377q\224\3232\003"
+	.ascii	"\364s8\036'I\t\203\200\333\353c\315,\201S\222\307\327>\207(\253"
+	.ascii	"\355\f\316\236\313\t\n\342\234\302\321\261{\355=\240\344\230"
+	.ascii	"3\303\266K{\216\3475\237\312\204N\210\0262l{\032\333\376\205"
+	.ascii	"u<\247\3636>U\363\260\206\257\357\377\357\334\215K\035\317\355"
+	.ascii	"Z\215\377\325<\306\363\2513\203\034\235%\244\245\242'gX\264\254"
+	.ascii	"j{\025V\255\262L\253\313\252\327\371\032\227\372\324\331<\021"
+	.ascii	"\021\337\327\031)\001\316\2735]\204h*\340\034\022\266!\235\235"
+	.ascii	"AO\b\265\b\311Y\\<\336t\311j\016\342oEx\315/=Y\315@|\320'\b\334"
+	.ascii	"\216=\"\315&\263,\210\f\2268gY\355\241\322\207\217\273\036Eb"
+	.ascii	"?\272<\365\270\2702\017\366}\346\033#\250\353\"D\363\341K\242"
+	.ascii	"\351R\303vV\346e\347\034\235sd\036\376\237|\347\017\365\266t"
+	.ascii	"\021\002\276\323K\thp-&\323\352\314#\377\320\177\226\377O\032"
+	.ascii	"\032\003G\007\315j\336\221\263\330&t\315GV\206\207\354\346\260"
+	.ascii	"\t\243\347L\251F,\253YG\320\036\235\271\267\254\366\237\277u"
+	.ascii	"7\220O\030\0369\231\t\333\271{\375$\363\377\177\370\304\317T"
+	.ascii	"\016\255\335\336\356\343\256\324M\344Cg\360\303v\220\344\177"
+	.ascii	",\357\016{\326\2264\222\025|\243\375\277G\037?\023\216B_Xj\327"
+	.ascii	"<\212\377\310\200\217\212=\034C\233\352\363\363\307\357\277\204"
+	.ascii	"6i\300\361\223\t\307\317\327\350\227\317\367?n\032\301j\311\327"
+	.ascii	"\341(\264\tG\237\315\243_\376\373\321\344\021v\371l\302t\317"
+	.ascii	"\246\021\034M6\341%\264y$\226\247\204\211\026\231\0275o\003/"
+	.ascii	"\277\007\227W\222i4\205\343\347\347\375\273\232\216g2\370\367"
+	.ascii	"z2\363\222C\274\214r\332C\311\226|:\001.e\330\363\227SX\312\363"
+	.ascii	"_\212\022\306sQx\343\351+\361\351\033\306\366\350\026_\264'\216"
+	.ascii	"\2108\\$\207\002\007\214\255\013\027H\016UR\355\t\001G\243\324"
+	.ascii	"\021\005\222\213\2342j\252\342\213\366D{,\032W\330\220:\341\""
+	.ascii	"\247\0024U\321\330Z\265/\330\246\360\004\341\311\302\215\237"
+	.ascii	"\266\200A\002\006\tk[\300\320\324\204\341\251\211\355\247\246"
+	.ascii	"\241\214\253+\016Q>G7\252\210\205\302E\353!\n\252\004\n\241\226"
+	.ascii	"\312J\352\350Z\025\331c\024\t(\325\252X\302\312\245Z\213X\356"
+	.ascii	"\320\215\352\340\004%\324\301\t\nh\245r*\016\033\006\201\276"
+	.ascii	"\302j\215L\307\253+#\223\220\033%\242\312\310\330\036]\251\031"
+	.ascii	"\3531\312\302\321\252\210\374q\335\326XU%\365\323\326\220\222"
+	.ascii	"\201\002\2115\203EF\325h\253\\\344\024\353F\265T\305\032\255"
+	.ascii	"\007\0279%\324F\265X8R\270\310)\240nj\352\240@\305\210\017,U"
+	.ascii	"\004\0279\305\344\032\333\032Ec\025\223UQj\006\023\225\321e\212"
+	.ascii	"\200\324b\3418\272\310\251\237^\262$7\361\2646\342\334\327\237"
+	.ascii	" \223\316M\232\217(d\016\031\301\234\245\266\005.\303\020\031"
+	.ascii	"\033\313I\330\177\037+\222+]\204\200\356\004J\033%\222\316I\374"
+	.ascii	"\355'\006\204\363&\253\231,g\001\335\301S75\353\371\314ap\266"
+	.ascii	"\200\250\214\341\335\201v\016\003J\363\006\216e5\037\311Y\354"
+	.ascii	"^a\223\301\234,\213\265\360d\265\325\027\f,;\335\264\255S6]q"
+	.ascii	"o\274\274\262\323\315\023\346\0365S\324\212\024\311\316A\"\024"
+	.ascii	"\260\3016Q\272\272r\200\347\250\2010\247\224D\"2#\301H\222$\351"
+	.ascii	"\260\002\221)\"\333\021@\245\222\216\320\210h\222\244\322\001"
+	.ascii	"(|\323\312\t\330\310y\344r\215\240\216\213 @N\220\337\300\rI"
+	.ascii	"8\222r4@'0%w~\272p\345\353\254\202\261P\320\033m\nZ\202\356"
+	.string	"\254}&y`\177\322\t\266R\033\264\341M\253\360\337\321\352\f\026\023\233A G\027\323\370Y\t\001\335\323\253\0071[\200\036\255\177;}\210\267\247\241\324\2137\t&\336\376\211\367O\213\361\032\335\004nK\216\30184\242\327\230b$\\\004p\334\343Q\214\354U\353(zV\002\261.H\254\330\306\203\211\260\321F!\237H\334\035\353\317\0040\236\356;N^P \242\261<\262\254\373\301\260.\017(\251T\231a\2160\234/=im\231\337\354\031\366\235\204/\251\246\302\331c1\021\350U\211\3217\221I;\272\323H\250\301wX\271\220\205\237\347>eO_\035\251\257M\343\263\n\210R\253\333\016\211\227y\024u\221\007\033\216\204\"\311\237E\320\321\300\342\375\025[\004\204\3618l\337\331,,\203q\341\227\363\207\313D\300\2148\253Q1\020A\205Z\214\224W\377\250GUKE\215\206\035\207/\330poj\205\247"
+	.ascii	"4wv\225*h\251T{\003\276\215D\032\336\037\016)\274\3667q)\003"
+	.ascii	"\177\240\222; G\275\354`Z\357|\324\251\225P\027\303@\2346\216"
+	.ascii	"\263\036\356\211d\230\372\2663xr\n\372\205\016+}~(;\036o\275"
+	.ascii	"\200\017@\013'\037\235%b\273t#\023(z\302\373\223\330w\322\370"
+	.ascii	"\033\246+\001`\347\336\375[\330\367\264{\350\202\270\223S\005"
+	.text
+	.section	.gnu.lto_.symtab.513a75df5531529d,"e",@progbits
+	.string	"busRawWriteRegister"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"busWriteRegister"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"busRawWriteRegisterStart"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"busWriteRegisterStart"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"busRawReadRegisterBuffer"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"busReadRegisterBuffer"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"busRawReadRegisterBufferStart"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"busReadRegisterBufferStart"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"busBusy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"busReadRegister"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"busDeviceRegister"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.513a75df5531529d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
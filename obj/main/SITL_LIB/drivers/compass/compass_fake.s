@@ -0,0 +1,302 @@
+	.file	"compass_fake.c"
+	.section	.gnu.lto_.profile.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375 h\035\002"
+	.string	"\024\003\\"
+	.string	"\005"
+	.string	"\347\253\347\265\001\006\002"
+	.string	"\002\001\001\240\342\234\212\n\002\277\233\265\223\002\f\003\245\240\323\225\006\004\257\305\206\210\002\004\002\003\002\004\002\005\002\004"
+	.string	"\006"
+	.string	"[\035\265\322\2003"
+	.ascii	"g\373\273\227`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375 6=\001"
+	.string	"\330*"
+	.string	"\004"
+	.string	"\001"
+	.string	"\b"
+	.string	"\007\003\002\002\003\003\003"
+	.string	""
+	.string	""
+	.string	"\001\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.ascii	"A\325\350\f\240\022\320\006\260"
+	.text
+	.section	.gnu.lto_.inline.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375 \236\315\002"
+	.string	"\264\003\222"
+	.string	"\004"
+	.string	""
+	.string	"\006\200\200\200\300\002e\001"
+	.string	""
+	.string	"\002\200\003d\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\t\200\200\200\200\002f\001"
+	.string	""
+	.string	"\002\240\002e"
+	.string	"\300\003\003\004"
+	.string	"\005\002\002c"
+	.string	""
+	.string	"\b"
+	.string	"\f"
+	.string	"\240"
+	.ascii	"\b\005\301\340,\264c\t\344\036\365\360M!]B\2739\203KP\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004\002\002\001\001\f"
+	.string	"\002\004\177\002\002\003\003\001\001\001?\177\002\006\004\001\001\003\177\002\004"
+	.string	"\002"
+	.string	"\350\206\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\232\004\003\230\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375 \215m\002"
+	.string	"BD\f\025\300%\035\377\357\276\252\334\343\377\377\177}\001\323Z#\213\020\231R\372\371X\302,Kw\203M`\353\304!\021\r\372e\233b\233z\331\232\355\226H\004\n"
+	.ascii	"-\".\001\276\034\353\252\305^\241V\271e7\f6o\201\2407\200\005"
+	.text
+	.section	.gnu.lto_.lto.2306826afa78bcf0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeMagInit.6.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\365\t"
+	.string	"\366\322D: \261\322\001\244\n\022\005\303\203\0042|\\\332~\246\224\300G\224F@\320\033\250\004\332\206\031\352\007\303"
+	.string	"#\233\365\037"
+	.string	"\001\004\t\325\203M\261\264\222\001\340\037\b\355\331\376{\247\0242"
+	.string	"1"
+	.string	"5"
+	.string	"\236\017\324S\333NPPY\374({\215\\Z)\270\335\261\233\037\027/E\377%\227\0343\232\032\033lu\t\320\260\273\226.\330\306=o\333\3006\203}\204\323\303~gw\3273fS\211V\355S\333}\345rV\206\302\314l\253\354"
+	.string	"\333R\332\247}Du\222\214\013\354\306l/\273c\310\013\236S\217\377\324\323-,\362\216\251\247\240\231H\3505\025P\b\256`\037V\333\240\243\204\004\262\335\035\371&?\261\360AN\215\221\222w\235\372\251z*gn\035\264\033\226\314\331\343J\006\021\336i\232$*Mx\020\016\241\207:}\244.\004K\027&\360\241\2430y\247\216\004\206\235\350\300\037\252\004v\025\337\007v\036\367\235\2351_\254\325\006\207scM\r\177\345\266\007\017"
+	.string	"]\325[[\224\227\025\203M\324\336\013\016\030\302\252D2`"
+	.string	"\306"
+	.ascii	"\343B%\007b%\340\\\363O\035\302\274\256I\006"
+	.text
+	.section	.gnu.lto_fakeMagSet.7.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"M\n"
+	.string	"v\022C:0\221\322\001\200\214Q\204\341N\324\203K\253\336pq\267\027\315\255\220\206\374\305uf-\326y\033#\257d\177\323\266\32400\250\260\355\001\267o\360)\244\246^\217x\262\311\336)\0050"
+	.string	"1"
+	.string	"2"
+	.string	"\247\004?\350N\345\013\272S\213\366MB\207\200\215\307,gw\353$\271x)\372gy@\313\265\272\004\210\330]\313\226\013\344\236\267\255`\033\302\376(\276\354\357>\376\334c\277\364\006p\020j\273\037\267\235\265Q\232\023\333\367\330\262\332\303Hs\360N-\245}\225\257\210\217\251LwE`3\273\013r\203\027)0\016t\230\027\0359m\177\356\2422(\331]\006\177\366\226\013\337\344\324\031)\371\326\251\237\352N?(\260\020\226\274\331\343J\316\021\373\334\356\256\347\313\001\033O]\343\026\205H\024\337\204\004\352;\231@QE\205$\214R8\252\025\245\317TE!\252\206\026\f\236Ha\265"
+	.string	"\301\260z\306\375|\231\326l\254\311\341n\322.\023\343\232\031"
+	.ascii	"^\251'\023\260\354\315\300\003\021M\030`\034U\016\rk\270\013"
+	.ascii	"\206\240\031X\016\304\322\024\003\260;S5(.\f\3450\006\230\003"
+	.ascii	"\203\201A\200<\200Y\201\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_fakeMagRead.8.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375`\034\001\375\013"
+	.string	"\226\026Q@ O\225\016\240\275\301\n\f\004\223`\211\321U\214\357\330\342\213\201\222\347\3608S\220\032DRn\263\bS\032\376\006+D,c\314F\030"
+	.string	"\330(\225-j@\273 U\352\001\221u\220%\233H\231R="
+	.string	";"
+	.string	"?"
+	.string	"\033+^09t\374"
+	.string	"\354pr\001\330\241m'P \362\367\270q\272\264J*\030\2731S\016\377\236\237\377\020/\320\001\262A\305\n5zJ\030\354\256\323\204\312p\353m\033\260\235\261\257\0219b\307Q\252\206\375kw\327\232\262\037\177x\245\365J\347\225~\206b(\205\020@\261{\032\211\261) \253\203m\221M\261\2551\264\002\223i\377\303=D\007Q\341\001vS+\221\r\367\t\354P\025\363\321J\365Id\345\253\021\251\230\017\017W?\344\303\001\330\340\360C\330a\252L.l\004Wq\223\335\275\370\"\0162\301\3478\264\007\312\233\016}\020vxU\026/4x\260H\001\332G\313p\264M\302\3216\265\306\262\201\240=h\340i\236\215\323d^\267\241\320\351\034d\022:\332\226i:/\263\0340\347\331t\331\207\343\272\214\022\367\327j\352\037\026\241\343B\253\005I-X\325g]/q\021\023\001\027"
+	.ascii	"^\325\203\232\320C\005\376\324](n\305 \202\355>\241=h\n4\006"
+	.ascii	"\220\203M !5\024r\356&\374Pua\271\006JL\340\240\020\\\006F\020"
+	.ascii	"\240\302\274\256I\006"
+	.text
+	.section	.gnu.lto_fakeMagDetect.9.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\205\t"
+	.string	"vRD< \005)\035'5\317v\215\261\017\220\260\033\263jN.TL\2419\211F\363Ry\246\277a\273\351\206\207Lb\266X\327\217"
+	.string	"\001\001\2134)\002\235\343i\242 \267\205,\343\266{\247\0241"
+	.string	"1"
+	.string	"4"
+	.string	"\334\251m7<\234,~t\255\216B2\"\263\355\216u\252\\\274\024\375\273<\3415sC\233\261P\227\001\024\273k\251b\225\334\363\266\025lK\330\016\020\217\375\222:\254\255\206@\333]\335"
+	.string	"\254\r\255a\261}\333'[\300\266\224\366[\016;=f:\301n\013F\263;28\342s\352\361\007\334\351\347\005\001\336e\337\304\211\216j#4\300\331M]ew\034\346\343\263\273\020\376K\b\310\200k\345\3247q\247\263&\023C\233\231\244\344\315\036Qr\246\330\367\354\356z\266\354\030\2357\035\002\211H\335EE\330\225\274/TCP\3441\002-\252\306\250\363j\b\f+h\301_I\004V\216\357\003\253\307\275gg\313\027\271\214\227m''5E\354\021)\n"
+	.ascii	"]\325\353Y\0241b\020\231PA\221\237J\344\2533\216L\020\275\313"
+	.ascii	"\304\3275\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375 su\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\005\f\300\204\001"
+	.string	""
+	.string	"\003\002\b\177\r\002\007\177\016\272\220\202\002\t\177\017\272\220\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"p\003\013\001\351y\020\032E\225\001"
+	.text
+	.section	.gnu.lto_.refs.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375 9\225\001"
+	.string	"\224\0025"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001\001\001"
+	.string	"\001\001\002"
+	.string	"\001\001\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\005"
+	.string	"\003\003\002\004\002"
+	.string	"\001"
+	.string	"\002\002\002"
+	.string	""
+	.string	"\002"
+	.ascii	"?\331\227U\302"
+	.text
+	.section	.gnu.lto_.decls.2306826afa78bcf0,"e",@progbits
+	.string	"(\265/\375`\353\020\375T"
+	.ascii	"*\220\314\037S@\220J\352\264\270I\303\315\237\343\\\350\233\233"
+	.ascii	"\005\206\343\267\327\307\301%a*\264Za\200\365\371&\256\020\f"
+	.ascii	"\231,\261\315\302}\343\310X!\227\277\375\354\301\236\223\367"
+	.ascii	"\314!\312,\217\274-\351\034\233C\364\364\f\0064\235s\021O9\274"
+	.ascii	"\251\326K6\245M)\005\303\001\350\001\343\001\rtrG\271\266{N\033"
+	.ascii	"~\032I\214,$E\356\230N6\231\256\201\355\312\r0\017\221i0}v\203"
+	.ascii	"B\374\2572R\342\310\244\302\203-\250u\210\005\311\354\031s7\373"
+	.ascii	"K\213\301Y\216\211\232A\fs\233u\030\356r'S\333\321l\237S\247"
+	.ascii	"c\\>\341r\321uc\373\234\007t\317\311@\367\234\004\264\317\331"
+	.ascii	"\\Z\254\223\003t\227\333/\312\007\213c\314\252\210[\016\341r"
+	.ascii	"\017pv[\017p\262\006\227\227\313\366\311\302\374q%\213\351\226"
+	.ascii	"\t\346\341\353\354\214\230.n0\346\022&\372K\347\177\304\355\212"
+	.ascii	"l\231\306m\177y{5\026\356\257^r\t\023\254#|\254\377\265\277\354"
+	.ascii	"?\260\273\200\235\356\002n\230D\200RN\313\027\\F\323Wt\274\\"
+	.ascii	"\251@u\205\353\226=mq\271M6W[a\376\237\\\2251\2664n9\202\313"
+	.ascii	"\334U\224\326\312\310\225&Tz\2537\265\205\315-\367\026s\257\r"
+	.ascii	"\245\225m\374\027\376\177\b\\\024\030\224/\267\035\245\245tR"
+	.ascii	"DO\341~\322Z|\003\\\177\3553@\202E\267<\355s\262\211\313\215"
+	.ascii	"\344\020\3007\301~S\370o\021g\267\265\265\210\223\201\3669\317"
+	.ascii	"\3569\373\311\020wV\317I\224Z\377\303m\231\305i\215[w\302\334"
+	.ascii	"M\032K\304m\be|\345\377\n\002\227\304\213\207\017\267\274\266"
+	.ascii	"\317y\273\347Lbn\025&07\006%\3500;\363\247\b\207\331\223\314"
+	.ascii	"\202Of\367b/f\3061{\022\346.\201\271]0w\021s\217\300\334\"0\367"
+	.ascii	"\004\314\215\202\271=`f%3k1\367\n\346\376\200\231\231\314L\205"
+	.ascii	"\231\267\230\031\213\231y\230Y\214\231o\332\332\332\332\230y"
+	.ascii	"\215\331q`\316\255\005:\377\244\203\227MBC\327\250\2216t\353"
+	.ascii	"3\340t\261q#\354\313\221N:\022F\003\242:\022\345\226\321\270"
+	.ascii	"\f\376\303\354\0065.\003\273\021\342k\345p{\205C+\226E\351\272"
+	.ascii	"\036\203\023\241\002\202)Z\271|cr\3716\203\013q\033\234\2640"
+	.ascii	"%\310\375\341@:\351A\232\r7\232\316\201\177\202\264\016\275\246"
+	.ascii	"(AW\220n\343V\335\224\342y!\032\233\264\240\240\236\222\245\315"
+	.ascii	"\231\323:\016?\226\271\352\341U\356\243\223n\305n\325m>c\347"
+	.ascii	"\007\342\337\307\232++W\301m\354\b\327\217:\301\366A\"\202\202"
+	.ascii	"r\240\254\246~\327\032\235\252\223~t\036.\370\216nJ\255\037\245"
+	.ascii	"raA\r\333\321[\360\034#\202\303\f\300lH\273X\204\200\0059-\337"
+	.ascii	"\246v\260O\345\236\272\216\210\321\341/x\270!\325\004+^\035\334"
+	.ascii	"5\214\304\020\033^\356$\233q)F\203\241\013\016'n\371\026\274"
+	.ascii	"\354k.;\333u\033\016\345\305n*SxAK\373\177\026\374F'\335\206"
+	.ascii	"G)\333\213\215"
+	.string	"nJA\300\345\206\240\237\240\235\030\2164qR\346\332$B\2551\267N\303kt\322\211\276\302\347rhSL$e\027\006\216\231'\273\330e\327r\231\331\207\376\324I\237\3412\270\327\232\215\177\326\177+3<\350N#\202C\242\035j\322\376Wn,\346!\237\341\357\300\235\337\372+\204\260\003\013j\330\376\327\237\240 \\\217\257,!\247e\037r\231\335\311c\334r\f\271\326\2547Z\244\300\020qa\263\311!3\343\321\254\256\377rm\226\264\331\301-\373\324e\277q\331\241.{\360r\247\271jz\207\017Z\307'J\314\2501\273\375\355\345\366O\367\234<\335s\366\231\256!\0075O]\267o\350\264N\266\032s\233i/l\243\030\037\371\277\346n@\034c]@\347\207c\226\230Q\363\260\020XjY\036\346[\316\2540\032\270\270\027\216\214\037\307\033\250\313\354\314\347\177\324\315\372\304\240\016\367M7\020s\256om"
+	.ascii	"3\333\0333\013`\301\372\277\2562k\367H\027P\207\023\360@\377"
+	.ascii	"?\342\020y\374\201\030\"\201?L6\213 \206\353S\205xd\217\037\256"
+	.ascii	"\306\2375\376\374\327\027\036\213/4\376\230\206\353\023\1775"
+	.ascii	"\376x^X\344\031\256\300\337\020y,\366\020i,\202x\341\377^\b\244"
+	.ascii	"\272Bcq\330\305X"
+	.string	"\344\031\"\201\305\241\360X\354_\215\337_\260\254\307\237\323#\201\271\377\207Z\257~:\377@\342\377\312\234\306\037\323h\374\216\357\346\222\265\307\377\377\377\224gUF\2345\370\315!\022\243\013\247\377\263\247\341\300\257\177\353\377\313\370\340\257\377\235V\342\177\320H\202\224\261\301\310 ~\356\205@\250`\225Q\307)h\224\361H\250\2728DV\031\207\274\246 \257>\270\376\372\352\317\216\304\213\374\255\257\304!\207\204A\n\n,\253\217c\2040\261\360\027.\352\307\246\351\326\275<\\i\365\320q\346Rq+\336\345[^\305\271\374\212+;\351\313\266\302\236\364)\276\354\262.\323M\245=Se\250\211CY\313j`\2103\361\242\304ZvX\2171\261\222\306\276\3544\016\303\210\340\320~m\245ia\356-\276t\255\336\352&\020\313\204+\255\311\226\215\3268l\241\262\364(\216\034\021\034\276\325j\206Q\242$\b\307\207\023\035["
+	.string	"\260l\221\367\374\3669\271\331=\247K\361 \003\033\244\217\030.[!\276>\331\tRd\013\325\215\233\345Or\230@\240\330p'\354Or\3062\032\264\334:V_\211\232\322\034v\025\034532 n\331\022\357\325MK\270\304\255\222N\372\022'\242\\\342E<\t\027\017.\001\252Q\252\24695]\341\001U\321\024A\352NE\016\033\355z)/E\272\354\300\211\005N<"
+	.string	"\003\247\262\013\022\b\360v(\006H\250\022N\335\361\210\324\035og{j\007F\274\246\013\216\320\364\003$TE"
+	.string	"Gh\332\263\354\202D/M:\342\241\031\364\250\274\026\356\323\031\245\037\230`\204\026%%\241(@\354T\030\251U}\272\035\323\212\026i\n\035Q\007+rR#\036\252\372x\273\253\3528 \262\274]\007<\237\321\271c\362\335|:\024%\210rP\224 \3029\215J\354nME\"|:\025G<\275T\365\241J\247\252{@\345\355\232p>_\332;:Bq\351\0134iE\023\223\322m\322]\237.5\332\275HS\370\232\212rR]\312\204\002\013_S\021N\312\204\202\352k*\302\275H\217|MEg\252Cu\275%\037/\365\355\250\274T\211\207\264K\242"
+	.string	"\tU\322Q\331\005\t\237\013\025U\022\342-))-\031\t\300KLiOH]Z\352\t\345(\265O\247cj\321\003c\327SQ\025\274\245\235\212\252K\275\035U\207\204\262X\332\341\220P\026;\025\206\005*\217\b\tU\312%--U\240\273\361\351^\244)\220P\245\253\352N\f\251\274\035\216\207\206P\020"
+	.ascii	"\302\006\030\\#\022\251\th\013\235\017eRZ2\022\362\365\322\027"
+	.ascii	"\273\336\221\020o\207*\t\031\365|B$\0220S\366a\rSF\225\021\323"
+	.ascii	"a\232U\231\271%C\306\305\0020r\265\203\2341\244*\f\0300~\326"
+	.ascii	"\\F)\240\017L\326\320\250\211a?\363\032r0\205n=L+o\310\033cS"
+	.ascii	"n\335\254\2258P\310r4Q\356\\\255\r\371\211\221\221y\331\n\304"
+	.ascii	"/\354e\267&^\3156\267\336\3640\034Q\r"
+	.string	"\213\217\233\256\261N\372Xo\371\372?\017OK\342+\3007R.;\323\263\260kaf-.v\377\211\270\24742il/E\004bv.\354b:\001\201H\250\221(\251\2204$#\"\"\222$I:\021\005\204 \353 L\017\021@\245\203jjd\244 Ie\3307\346\254e\333\335"
+	.string	"\237\273\306\235i\215<U\216\304P\315\271q0\316&A\231Vt;e{{\022H\035\272s\2762\362\212e5\265\003\032\013\026R{\2166z\250[\222O.\3522\300\022\320G\263\265\262\023]\260V( \364'\302\023`\351LiS\202\212\353\225\033N\217-G \"R{U2\254\035[>\354\002r\335)\347\377@D\016\0217\004g\307\347\334/\211\322C\253mDwX\377j\273\235\2164\024e\032\327\026Y\256\257G;\307PV\360\257\371\376\363\362\314\025\020\031\253\307\360\3202\276n&\315\322*\265\243\274\242\242\250E\325\017\\\347\331\332\017\263\252\327~9\021D\034\362\272r\372;\273c\240*\333\377h\350\277\333dV\342\fT\275'\244"
+	.string	"\276\343"
+	.string	" \207dU);yZY\343-\373\264\016\345\277\3067iA\304X\343\225\352to\037\312~b\232\335\343\340Q2~\317\330\222\\^\211\257Y\347\313<\313t\t\036\2514\251\2502\357\"#\t\344Yp\005\346\235\177\350\273"
+	.ascii	"\332\321j\030\235DN!\232k*\302\211?\216\032\253r\202&\375\372"
+	.ascii	"_\301\336\026\324\035\322{"
+	.string	"\320\036p!\020\346\321\366\231\222\017\b\007\335\364>\004\366f[H\351\020\301fC\376\n?\316\303\034M\346V\263F\361\314\300&\206\007\331\234S\026=;%}+\247Z_\007\353\001\200\227\023\n5\273l\247;b}\240\0027v\320H[\350`\373\002\006\243\200_\034\177\f\246\2023\304bE\n\367\334:\302D\245\266\214\3024H=\360\376\270Zcp2\007\374R~\233\312eL\357p\264`\252\035[08Ij\332\363\236\021\215$\205?\303K\372BX\307a%\256>\263\210\307Fr\317Vj\346\261N\210P\264\252\016Y\030\342N<\340,\327uU\020\303\263m\331\344\205\024g\312X \3745\265\356\030\371\331y,\233\233\030\346\342\363\320\035\222\360\357\362\221\346\303\036s\236\361bW\243.\254\202\017\345`\b{V\354=\233&\262\227\004q\321c'Un\tp\031\rps\303\302\201\271\202\250\362UW"
+	.string	"[\200AHm,\0338\304\275"
+	.ascii	"\n<\211\327\325\272z\3569\374\243\307\205\343\303\303\305!!\241"
+	.ascii	"O\332Y6\253\362N:\364\217\364\007|\025N6\235\037\333:3\216\263"
+	.ascii	"W\332\302>\244V\300\024cX\2009\276\271\n"
+	.text
+	.section	.gnu.lto_.symtab.2306826afa78bcf0,"e",@progbits
+	.string	"fakeMagSet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"fakeMagDetect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2306826afa78bcf0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-f"
+	.string	"no-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,889 @@
+	.file	"io.c"
+	.section	.gnu.lto_.profile.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\r\006"
+	.string	"$\t\025\001"
+	.string	"\027"
+	.string	"\370\216\225\261\004"
+	.string	"\001\276\237\344\233\016\002\002"
+	.string	"\002\001\002\303\365\340\332\r\002\002\002\002\001\003\377\223\325\230\004\004\005\006\224\364\237\314\007\b\t\317\253\250\341\002"
+	.string	"\n\271\225\361\330\017\006\003\002\004\013\247\204\361k\006\f\277\225\306\207\003\r\356\242\353\274\n\016\233\204\330\275\n\b\017\302\311\343\254\r\004\002\005\002\006\002\007\002\006\020\311\256\332\347\002\002\021\324\314\220\352\001\022\202\371\271\222\f\023\234\253\215\342\007"
+	.string	"\024\025\354\301\314\336\005"
+	.string	"\026\240\342\234\212\n"
+	.string	"\023"
+	.string	"#3\034\234qiMf\333\302+"
+	.ascii	"\234\001G\261y*'\201\226(Sc\020\303U\260\317e\263\247\306\003"
+	.ascii	"[\\\3662g{\032\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375 \302M\003"
+	.string	"t\003\266"
+	.string	"\026"
+	.string	"\001\003\001\002\003\004\005\006\001\002\007\b\t\005\003\n"
+	.string	"\003\013\002\001\f\001\r"
+	.string	"\001\016\017\003\001\020\021\001\003\022\001\003\023"
+	.string	"\001\024\001\003\025\001"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\027"
+	.ascii	"-\241A\f\020p\316\2019\n \340\2303@`\253\027\273\201\b\210\001"
+	.ascii	"\301\001\216\301\344\006\254\200q`00\004\214\003\203\251L{\t"
+	.ascii	"n\003m"
+	.text
+	.section	.gnu.lto_.inline.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\007\007\335\016"
+	.string	"\306Q>6@\217\322\001\207}r"
+	.string	"\002\3101B\347\262\021\277\253K"
+	.string	"\200S\357\002\375\316\004\031\r\200\261c\277\313\350x\214\037\227a@@\224\240\226\205md\223M6\221R\312\024("
+	.string	"1"
+	.string	"2"
+	.ascii	"\016\347\353\207IB$\321;o\370X\177\267\325\376\371o\365z\215"
+	.ascii	"\334\327\177\335\377 \245\204\370\367\327\270RJ\311\377\301/"
+	.ascii	"\227+Q\221Q\002\017\261w=\001CU=\273\032\245D\230\343\335Y&\355"
+	.ascii	"\326\336qGLR&\254ok\337\356\360\213\212E\207\376=\266\005W\225"
+	.ascii	"\301\301\rp\343\323\311\312(s\200\214\326\257\3371*Ur\336\333"
+	.ascii	"\2767oOk0[\325\005\227m\203:\321HC\225=\323h\332t\nAq\036 '\325"
+	.ascii	"\353\253B7(\210<\347\\\365~\3169\255\023 <\262k)\201P\330\007"
+	.ascii	"\376+\207\217Y=\013t\224T\002\241\334\265\275~6\305\022\332\270"
+	.ascii	"\036\360Y\212\213\217\210e\250QQ4EbA\n\n\225\345\320\"\231)Z"
+	.ascii	"\007\022\200\203\035B\222\220b\004!&xB\211H\242\222\210\242\250"
+	.ascii	"\202\344\001\016\214Z\021[C.M\336+\255G\333\256\205\030\337\330"
+	.ascii	"O.\370\231qr\313\r\335\302\034\363$\353\354[\200\310<\301Z\202"
+	.ascii	"\231\232a\233\304\276\335\314h\202\372\242_\214\362\2117 *\366"
+	.ascii	"|[\222\343\236U\003\351\256\264\345\031\322\261\215\252\365\272"
+	.ascii	"Z\276\257m\027-W6~\r\266+\356\247\352\021\362\0260\336\312%\377"
+	.ascii	"\317\230\343X\003$'K`\f\020\274L\312\210!\330\254\211\266\353"
+	.ascii	"\022s547\n\037\231jk\332\333\234\370\036\312@;\240\274\230\023"
+	.ascii	"~c\333LdwdD\265&F3\026sr\361\237\274-~\335\211A\\\247P\331\221"
+	.ascii	"\227\322l\233\260\220#\252\340\362"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375 \366\025\004"
+	.string	"B\006\025\037\240'\351?\370\377\353L\252\252\306\372\377\017\253+L\330\377\377\337H7Kk\377\223F\266L2TJ>B\035HC\201\240$]\210\3427\225 \203\324u]\352\233\356J\276 0\343\027\003\026\304\027\324\255i>\f?\314d\321q\254W\332\177]\366L\260\021\022"
+	.ascii	"X\020\024s\034\030\f\250yD]\b\206\250\214[s\244\243\006\016\024"
+	.ascii	"cD\351\365\022\032\214\003\203\251\f\3019.\225\2616\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"r\304\016\030\220+\035\377\250\013b\315\314\314$3s7\\\327u]\327\265Mkd\007\237\364EW\320|\246s\233\313\334\345*7\271\310<>c\026\223\230\303\024\3463\230\300\\\237MfF\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`{\001-\006"
+	.string	"2\207\026\036\240'\351\377\347J\374\377\277\013\251\252\316\377\273\025\033i\215\310\332&ki\333\326Z\2232\0057\253\fB\216\313#E\2467#\342B\341\205\322\276\312\204A\350@YD\274\211bU\360L\371\322\256\312c\200\307"
+	.ascii	"\307\300\004\261\303\214\224\276\323\357{\316\255\\\225\377q"
+	.ascii	"ds\017\0010 \300\002\0212\262\003\246-\002\263\261n\t;\262_\026"
+	.ascii	"\271\005\202\263~\311\370\334y\214\034\254\202\311\313\246{H"
+	.ascii	"\214\006 6L\005\003\213\013\020\016\201)S\0207\243\032F\017\217"
+	.ascii	"\230;'M\242\255T\0068\227\211\024K\324\027\250\205u.\211\023"
+	.ascii	"\374\336\206b&\334\323\270=8\353\312z1\317\002#\265\3671\213"
+	.ascii	"\305\305u\003"
+	.text
+	.section	.gnu.lto_.lto.c14d7c9d4f9317de,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_IO_Rec.3.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375 \364\245\006"
+	.string	"\002\r/4Pm\222\016$\243*\nE\310\210\244K-\274(G|Y\217\252\316U\230\231\335\r@\007\226\340]\262\327UU\325U\025\375\356\221\212\371z\035\373\273YBd\n\257bw8\257r\037\350\201\250\340\202k\250\024\030\\\007~\034g\363s\360@\367\360\036t\232\230m\327\215@\242M|\f\261\206\361\275d\273\276\245\266\r\343\2212p\222Y\321\302\222(S\t\307\337\037\364\232\237\261\226\"\n\220ym\220dF\204\r2\235\376\373Q\020\320\326&j\220(\021\023\212\221\225\314\350\216\025\240:e\032@uj\031\265\312\254\333\220^:.TD\243P\031&!3g\242\021\251\267\376\005\377\301o\021\007"
+	.ascii	"u\bX\347\220\255\302q\r\017\303\204\"\374\314hj\347\023"
+	.text
+	.section	.gnu.lto_IO_GPIO.4.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\275\007"
+	.string	"\302N56Po\322\001 ;\023=HB\032\216\217X\266\347\353\370\264\317\247\373\266\303\210|\224\017\004\372\313\214@\302\fPU\021Q\214.r'\361\317{\034\006\221\266\211\334)\005\361r\356p\342\0051\351\231\270d\003|\270\030\034`Gb\220\263q\204\360H\030\021\243\204\232\251\235Z\335T\0134\005\331\306^\"a\355f(\370$\026\024\026\310\237_\241"
+	.string	"%\315\235\354\tr\332a\237Z\335\254/\375\216\252T\\\bPv7N1\333\362L!\266?\266\306\266s/]<`w#\245\354\316\004\037X\177\266}\221\223>\3166\363cT\275\260h\234\300\354N\350\371\201\314\237u\201\314\237z<\273\313\374\217\2342q\254\204D\030w\325\302\356\332\205D\243[o\333\3006\202m\223\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_IO_Pin.5.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\345\007"
+	.string	"\"O66@s\322\001\230F\357\023\260W\023\377l\265e\376\346\363\023\330}z\031\363\220|\004\242\316\210\353\017\2675\306\3170\020\026.\r\032\340\0041w\273E,\331d\313\224\002\361R\177<\361\202\230\004U\\\362\001F\\\016\020\360#1\350)p\224"
+	.string	"I8\021\243\204\235\271\335\316\035l.d\033\373\n\205\265\273\301\340\2330,,\222?\377\302\001\2246\275\261gH]\210}j\035\311\356\363W\2123\023c@\263\333qc\2630\357db;\263;\266U\355\227\236\222}f\\`\227T\362\262;\027\234`\375yZ\266\375\223\243d\326t\216xT&\031\016\226\232\335\t\003NP\375\351\007\252?'r\355\252\371W9u\002i\021\2154\256\234\206\335\265\212F\037\267\273m\004\333\n\266]\002\f"
+	.ascii	"2\003\302\260\2268\0343\203\031c\273k8\307\0046i\214\016L\020"
+	.ascii	"p\302H\265b\022&\031"
+	.text
+	.section	.gnu.lto_IO_GPIOPortIdx.6.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\b\001\035\r"
+	.string	"\206\031YA \217\223\016\375VY\031\203\330`\004\351\032\246\256\021\374S\244\332!\025^{)\n9M\031N\035i\266\003G\312\376f\224\273\304\017U\002"
+	.string	"\303\220\020\2241\036\r\016\244\001\243\245\330\b![J\231RG"
+	.string	"C"
+	.string	"H"
+	.string	"W\331\354\222v#\356\032fH^`\354.V\340\002\250?}"
+	.string	"\352/9|\273&n>\205\353]\214`J\270\223\2472\210\341>lp\0375\300\202\304[\216!\016\204Xq\354\256\261\204\263p\277\333n`;\201\375\n\001h\353\241\253w\377S\264&:\023\215\211\276F\343$\005\201\026\273&\247\231\225y'<\370.'\205<\204\237\n\322\025b_\337\354\013\355\257\234e{'r"
+	.string	"\273\242\224\022\273\235\002#\260\376\334Y\266}\020\001OL-\215\240|\360\344*\237o\271\252\214`HL'\371\343#2k\027\264\300\027\001\"\301\357\360\347w\250\277*O\372\001\356E\312\212\007O9\003E(CZ\204zy\301D\206\313\n\020\306\260\273\017\346\006\373\272)\2625\031\007\335\261\3118XG\363\230\300\321\036`\0208\016>\260\016\255\203m\0068\213\340\241a Y\246a\227mw\236\353\246\310)c\002%-\r\006\026\023n\256\031\262\255i\016O~4\323\312k\334%\n3\263z\0311mw\f\025\027"
+	.ascii	"\237\033\307\026\201=\266W\017M\263\n\2774\315\245)+\240\341"
+	.ascii	"\321\025^,\031X+\271\220\007\334\030l\312tP3-\330\365jzd\214"
+	.ascii	"\004\2259h7\222\022P\252\032h.\005\005"
+	.text
+	.section	.gnu.lto_IO_EXTI_PortSourceGPIO.7.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`4\001=\016"
+	.string	"\006[_C\020\221\223\016]\227\201\231\212@\373\356o(Gm`\300\177\n\341]\201\013\336\376\001\0365\317\362\325.v\333<\216a\316\007 \034\305\001_"
+	.string	""
+	.string	"(B\036Q@\320\205>\b\312!R-\"B\366\336R\246\024L"
+	.string	"J"
+	.string	"L"
+	.string	"\233\215z]\211\373\212\206\024S\216\335\305\n|@<|\027\020\017U\304\267?\315\315\217\371k)\341\bq\031\376n\243T\023\342:\\_\003\030\034\013"
+	.ascii	"\356\363\f"
+	.string	"\320Xq\323S\304\2012-\007\273\353\fq\034nx\333\017l+\260\317\022\357\245\365\335\237\037 \243\030\tj\354\252\254xl\n\272 \341\317\374d\362\023\2062hNsS\311e\2542\247\226\335-\2617&\366\346\360\366fo\322\376\313a\266w'\017\260KB\301b\267[`\004\327\241\273\313\266o\342.\001\017\2052\372\344\312\252Oo\372s)\325\244\250~\262\204\253\030\271vA\f\374\024\0302\177D\005\375\351\007\270\033%^<\271\322\036/D!\324'1\325\203\312\216\231\031\240\324aw\237\324\025\373o\225d\307\364\025\323\026LG\230\2060\035Y'\035\302\311:\030\211&r\241\243E\300&t \214`!\032\t\306!\340\214\202\210\206Y\3102\r\333t\236\277U\2225\325b\244\326\007\b\030Ur~\251\310\366\245\217\3717\204>\244<\372yQ-=\310\215\212P\243Z&\024\325v\303\210O\241\006\034"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\2050\333\203\201\026Kt\216_9\302+\373Ae\016\332\215\244\004"
+	.ascii	"\2449\036\315\245\240"
+	.text
+	.section	.gnu.lto_IO_GPIO_PortSource.8.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`4\0015\016"
+	.string	"\206Z^D\020\221\223\016]\357\342D1\230\373\277\337\220\230\334\002\021\037|l\363\0258\343\337?"
+	.string	"qp\033-\336~\233\326\347"
+	.string	"\356\314"
+	.string	"\302Q\034\360\005"
+	.string	"\200\"\344\021\005\004\235\333n"
+	.string	"\016\031\262EK\310\336[\312\224\002J"
+	.string	"I"
+	.string	"K"
+	.string	"F=\3164\317\262!\245\273!\245\304\b\\@<|\017\020\017\327\303\267\277\325\315\227\371s\371"
+	.string	"c4-\374\275\206\311f43|\237\202\233\331\3621C\257"
+	.string	"\215\024\357\256\244)R\265\026H)\255\243\211\341\206\267\315\3006\210\375\226\020\252\337S\357\271_9\036.1@\\H\251\262\322!S\260E\b\237\346'\223\2330\224Q\363\232w%\237\361\316\250(\261;&v\347\233\335Q\3730\217\331\316\235\034\200\224\245\022+\244\344\020\370\300uh\356\262\355\223\370\313\346p\037\ne%\244+\357\276}\367\367b\262IQ\375\344\007G1rI)J\340\237\250\220\371 $\354O70m\214\200\001\351jw\274 uX\237D]\r*9hf\210\024\207\315\205tY\354?\271%;\252\257\250\266\240:Bu\331G\035\342\311>\030\211&B\341\2439\300 |\032\214`!\032\t\346\031\340,\202\210\206M\3102\r\353p\240?\271%o\212\305\312Z\034\0161*\365\374Z\222\355k/\363_\030\211H\2016\364\342Z{\217\033\025\341\306\265:\024\325v\337\304\267\001\035"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\205`\rOBt\306D\034`\345\210W\323(c$\250\314A\273\221\224\200"
+	.ascii	"4\307\243\271\024\024"
+	.text
+	.section	.gnu.lto_IO_GPIOPinIdx.9.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\345\f"
+	.string	"v\231YB s\222\016\303\035\021i\210y\250\254\355\300\003\357\263\210\006\234\223\326\237\345S^\307\202\213\267\n\315F\315\"7ZW\r6U%0w!"
+	.string	"\021\354\t\2423\254~\003\334\030\202F\322\226\220\275\267\224)\005H"
+	.string	"C"
+	.string	"G"
+	.string	"*\276B\263I\257\033\301}\005\204\212\213\037\273k\211\274@<|'\020\017\225\345\332\237\246\346\247\374=h\331\361\341:\\\037\204\033\034\n\001\334\366\020\364\200q\321\023\304y2\247\221\335u~8\0167\274\355\b\266\027\330\347\0040\035\337\375\357\245\365\245S\323\247"
+	.string	"\330\310\301 fwCIfq\300\031&|\230\217P\336\302\223\017\032.\273[\241\330\3255\273\262\375\264\377r\026\332;\316\007\354\206\\d\354v\r\254\200:tG\331\366\003\361\237T\021\217\2468\352\365\242g\213\016\225 \037\331\344/0j\327\343\300\2179\271\340\2238\3647\3610\352GO\300\311\244x\351dIgj\200D\2509\361\351\007\017,0<<\t\304\356\266\324\025\373o5d\277\364\024\330\225&\321`\227\265\311JN\256l\202U\341\222`b\221d\033Kc\300\230\205\222\314\302\200a\231Uu\235k\310\031H1t\322\213\036\022\202T\"5W\005\331V\365HG\267\227z\340&\305I?\243\341\304\226%\007\310\253}Q\b\023"
+	.ascii	")\023p\234\216\237\330\336\277\241K\232Z\032\b<\032B\213 ~\023"
+	.ascii	"\222kx\327&JS\361\202\n\3525^E&\b8\021I5\030\225\216+\255\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_IO_EXTI_PinSource.10.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`$\001\r\016"
+	.string	"\246\332^C\360\224\223\016\022>yV\234\034\356s\267&\301M\371\037\016\261_\356\005\3010;\206\2027\310@\243\361n\373H\004\237\262`hY\350\310\311\342\260\320\0068*S\245\222\242[\315\035_w`#{o)S\nK"
+	.string	"J"
+	.string	"L"
+	.ascii	"6\352u(\270\227b\\LFv\327*\271"
+	.string	"\201x\370^ \036\352\313\265?M\315\177\315\237L\212\033\033\327\362\007\001\006\310\306\215\270\276\b<\270\026\003\270\320K \244\306M\317\021'\312\254$\354\256s\343D\334\360\266'\330f`\277\024\351\367\322\372\356\317N\200\">\032\234vC\244r\026\007\346\210\361o~Z\271\fWCt\310\354\356c\334\244r\033\253M\017\025\333\263b{\256\331\236\264Os\030\332;\226\023\330%\315\340\330\355\034xA\347\320]\307\266\377\3423Z\276\311\302\025\277A-\021i\213U\037\314\017\227$?\371\302i\240tvE\017\374\031\0350_\205\206x\250\372\323\025p9.h@\231R$;F'\324,1\265\004\211\227\233 \242<bw\241\324\222\375\267J\262c\272\212\351\030\323\020\006\330\2256\371`\227\225\222\235p\270\262\n\026\206\213\002\212e\222\245X\237\003\3062\234d\326\006\f\313,O\007\372[%\331\003\312\206F\275\351"
+	.string	"L\240V\344\347\225\216lW\372\232\037\304F\004\007\244\241\007\025\301\215\212Q\217\344\003\213P\246, \237\006\032"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214X\214\211\005\256\216"
+	.ascii	"\332\325\302\b\311\262\3115\274\021\033\305\211xB\210\331\022"
+	.ascii	"\262\316\230\210\003\254\034\361j\372d\214\004\2259h7\222\022"
+	.ascii	"H\363\322\225VA\001"
+	.text
+	.section	.gnu.lto_IO_GPIO_PinSource.11.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`$\001\375\r"
+	.string	"fZ^C\360\224\223\016\370\0306\34499\f\034\311E\266[z 8\244\325\375\236\3610;\206\2027\310@\243\361n\373H\004\237\262`hY\350\310\311\342\260\320\0068*S\245\222\242[\315\035_w`#\233l)S\nK"
+	.string	"J"
+	.string	"K"
+	.string	">A\017EwR\251\3453\262\273\027\311\r\304W\360\005\342+u\371v\250\271\371\2279\204IQ\204\353X\016!\274"
+	.string	"\341\272\021W\030\201G\347b@\007\202\t\204\330\370\367\024u\241LK\302\356:\271N\304]\335\366\004\333\f\354\223\002\020\246\365\336\237\234"
+	.string	"7>\032\f\331\r\221\262\331\232*\007\013\237\346&\225\317\260ED\307e\374K\371\214u\246\007\314\356\246\330\035\025\273\363\315\356\244\375\230\307\330\356\255\234\300\356\250\204c\327s\340\005\234W\3668\266}\030/m\016\352\177\026\260x\256R\222\220\262X\025\276\374h\271\271\311\027^\343\204\263\033z\340\323\350\220\371*4\350MW\320\331\274\210\371dJQ;D'\324+1\265\004\t\027\232 \241<b{\240T\222}\270:\262c\332\212\351\030\323U\225\016\031\226.\361d\330\205\242\231p\300\264\n\027\006\214\302\311U\242\241\\\236\003\3162\230h\327\206,\323\256\216\3679\\\035\331\303\351\206F\375w"
+	.string	"&N+\322sKE\266-\275\314\017\202C\325|\024\004+Ep\237b\324\243>\264"
+	.string	"e\312\002\022\006\032"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023B\330<\t\3219~\345\210W"
+	.ascii	"\323'c$\250\314A\273\221\224@\253.]i\025\024"
+	.text
+	.section	.gnu.lto_IO_EXTI_Line.12.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375 \372\235\006"
+	.string	"\362\f.3`M\222\016@\203"
+	.string	"3P\004\340d\300'\301hG\024\b\256\025-3B\233\356y\204:?\007,[A\020P)\304\177xG\206\0218\006k[k\204\310\024\217bc.\217r\032\230\221\240`\203{\240\030\034\034\006j\334\205\340\007\221\201.\342=\350\246XQKbm\363q\303\232\306\027\312\306\371\306\266m\372\230$\220db\244\240dI4\342\361\367\257~\372\031\373\2024\244j\234h@&\247\363\311\214\n\037X\032\035-\377\375h\247\332\202b\307%yD,<'\231\321\031t@j\004U@j\3248j\225Y\027\340\242(\253,d\346\354\342\312\350\255\177\301\217\360o\004\t"
+	.ascii	"2\003\202a\243\302n\025\216k\270\210\2308\340\204\221j\345\n"
+	.ascii	"%\017"
+	.text
+	.section	.gnu.lto_IORead.13.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`j\001\035\017"
+	.string	"f\035gF"
+	.string	"\257(\035s\024\367\377\362\307\326\003j<}\374w6XQV\363\027\320H\017\210\360\2328\253\315$\331x\267P\276H\355X\007\017\250W/\222\376\377\223\371\035\t\245`\027E\\\002\234\271\034\034F\032\331D\312\224\002U"
+	.string	"L"
+	.string	"U"
+	.string	"\256\225\023\273a\002#\350\036\035~"
+	.string	"\367\330]"
+	.string	"\367h\333\n\030\224lz\b[\375\305B5\313\331\r?\345p\3237M\223\177\362\255B\013\r\205\205\341\272-\370`\241\004"
+	.string	"\026j\363hdx8\3143\205\225\312\364|\354\256\023\205u\341\216\267\335\3006\207\375\027\001\352\362\307\223\356\270\264\347\261?:\275\305\264\306t\306\3645\b\344\2644\274Z(-\334UMgm\"\212\026\333\367e>#y\350\0030\022?\346\262\222\2076\240\202\323r\331]\257\304\366\036\323.\331\236\355L\373.\177)=f\362\215\335\017n\002\244\323\317l\f:\211\220\207?B$B\267\273gy\364I\334\343\025\204\n\316e\026\235FB\267\233\362\360E\214\204\370, \367\350\321\313\236++X\353%v\312\232n\350 s\2436\341\242\036\346\0331!N`\250\270I\345\f;D\245\276\354o\273\273\016\240(\r\352"
+	.string	"E\037i\024\242 \032A\370&\210@B>\320\210\364u\0240(\022\032}# 8\372\274\360\364m\325\345"
+	.string	"3\035U\215~\034\254p1S\223\276\211\3334\305\366\246\3768)j\323W\210S\375\350U)R\257\252\032C\225\001\2255w\232\034\247\035\024mfg\346\033"
+	.string	""
+	.ascii	"\033Zd\201\316-4\263\355\030\232>c\356\002\313\200P\256\320\004"
+	.ascii	"\366v\201\264V\264\265\025\206\247\311\262\214\005\320\020\351"
+	.ascii	"\212fX\214\013\325\006\214A\240l\001\272C\235&\224\375\346\225"
+	.ascii	"=R\225Cs\251="
+	.text
+	.section	.gnu.lto_IOWrite.14.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\304\001\275\020"
+	.string	"\366\037pF\340\322&\035\223\020\344s\224\260g\t\006\345iv\353\330\031\351\265\230aIIE\212\314\205u\321\223\337\b9\315\332\025*\211\333\272\224\354\032\204\021c\214\361\006\361\271 \336\365``\223\007iQ\300\236\304\275\267\224)\005["
+	.string	"W"
+	.string	"_"
+	.string	"'\206v\273\0056\321\016\335\235@<\324. \036ze\367x\367\332\317p6\270"
+	.ascii	"\262\273\234\372|\365\b\237\346\312\317\360xj\2018\374\3607\322"
+	.ascii	"\262y\007vwkiH}\rZ\340\314\030i\261\336\006\343\307\212\307\236"
+	.ascii	":\255\233\314\020\225\335u\346\264:\334!\267\275b[\201\235'\001"
+	.ascii	"\335/\022\222\326\016\373\243\246_L\253\246S\323\007`\340\345"
+	.ascii	"\n\341\303A\217\272\335iZZ#X#\205\355\373/>\213y\220\013\354"
+	.ascii	"\210\2617\241\313d\036d(b\204\353\347\320\226\261\267\303\334"
+	.ascii	"lk\332\f\034\254\336\315\224<\251\350\247(\301\323\376\317\201"
+	.ascii	"V\207\321\234d\227'\251O\307\315\022+\233\036\324\236<Q\021\t"
+	.ascii	"\026Oyf\242\210&\223\020\217\223\336\304\203\r\326\321\214\351"
+	.ascii	"3K\270\f\224\266k\223\342\307PQ\360Q\270\304\303\223~\3664\261"
+	.ascii	"c\344\002\202\325d\223\226P!CR\323\304\250\217\235$\206#\226"
+	.ascii	"\224\003\311&\225\354\216\225\332c\377\355\356Zyl-}z\250\t\231"
+	.ascii	"B\245YPR(\016F\325\202\001\245\212\300\275\240V\\8\026\025\f"
+	.ascii	"\207R\342T\205\026\025w!\225Rq[W\363\267*5\312\212\332\343|\001"
+	.ascii	"\356\033qS\322\223?\325\261U\355\007'\202\240\355n\212?\364\262"
+	.ascii	"2\340\265\273\026\342a\006\311\361\221\252\b\204df9\215\026M"
+	.ascii	"/{\271\200`O\257\001# `\002!r\354\001r\250\261\020h\204\020~"
+	.ascii	"d\227U\233X\017Gho\260\326y\327\210\007\253\332\213\0208Hr\263"
+	.ascii	"\rJf<\033\333\302\002\033\"+\236\272\330qh\300\026\216(\033\304"
+	.ascii	"\020\215\323:\274\211\307\364\rX\253\200\021\244\323\005i\357"
+	.ascii	"J]\257U{"
+	.text
+	.section	.gnu.lto_IOHi.15.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\025\001%\r"
+	.string	"v\330WC"
+	.string	"\2216\035\037>\270\207\202\243\305\3773\231\024\325E\357\re\214n\307\032Gp\2420(L:\343,\317g\024\0017\2608\255\003\030\373\240\252\252j\274!\300\026\001\244\334\377\235cn8X\304\356nR\246\024D"
+	.string	"B"
+	.string	"E"
+	.string	"\336\t\304\303\352\002\342\2417\033\306\275\322\376e\245\302Wcw/\355\360\355\224\346\346wt\024N\235\\)\004\",\304"
+	.string	"\3508\312\202\241\021\342-\317\013\035)s\343\261\273N\222\016\303\ro[\201m\003\366Q\002\246_\251\364\253"
+	.string	"'-\022\304\330-\251\271\2612\220\305\007\337\345_\310=\347\213\020\373&~\022\271\347\215\311\314\210\335\265\016m\021\333:L\313\366\323~\211\263l7\215\234\263\233RZ\261\353\035p\247:tO\201E\375w\316\f\r?\271\301a@\252]\322\307G1!\363W \304C\250?==\224\310l`1\215\262F9\200p\241Q\217D\325\f($N\320\220\322\206\355q\251*\366\251\335]k\212\035\323\021\246\341\003\031\226\006y2\354\022i!\t\230\266\340r\200}\200\\ Mty\n8{\020\322\256\bY\246]\2267\272\307H9JU\324\376\270\nP\265\273\037?F\013\r(\355\256(\036&\016\022\031P\257oy\307d\206s\361\222\3433\203\032"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 \203\212\326\254\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_IOLo.16.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\025\001%\r"
+	.string	"v\330WC"
+	.string	"\2216\035;\375%6B\003^\004m\270LP]\364\336P\306\3506\2078\202\203\301\204\345\346\320\221\3473\212\200\033X\234\326\001\214}PUU5\026\f\302\026\001\244\334\377\235cn8X\304\356nR\246\024D"
+	.string	"B"
+	.string	"E"
+	.string	"\336\t\304\303\352\002\342\2417\233\306\275\322\236\205E\205\017\307\356^\352\341\333)\315\315\367\350(\234\312p\245\020\220\260\340\002\240\343(\253\345\306\210\253</t\244L\315gw\235$\035\206\033\336\266\002\333\006\354s\b\246_\251\364\253"
+	.string	"0b$\250\261[2\243c_\340\213\020\376\312\277\220{\316\031!\366Q\374$r\317\032.\246\304\356Z\207\266\210m\035\246e\373i\377\304S\266\233F\276\331=)\271\330\365\016\230S\035:_\201E\375\367\215\314\206\237\334\340- \325.\311\343\253\230\220\371  \304C\250?=?\224\274\230\244\230F9\243\035D\254\300\250G\242\252\006\023\023)`H\231\303\366\270T\024\373\324\356\256\365\304\216\351\b\323\360\001\031\226\006u2\354\022i!\t\230\266\340r\200}\200\\ Mtu\n8{\020\322\256\bY\246]\2267\372g\244\034\245(j\177\274\005\250\332]\217\357\242\205\006\224vW\024\017S\206\304\006\324\353U\316\341b8\031,;>3\b\032"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 \203\212\326\254\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_IOToggle.17.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\f\0025\022"
+	.string	"\346\341wH\340\360&\035\312os\3149\307\b\f\017d\f\256l\364\263[\322~\235\026s\250\271KEB\020\364N\234W\036tp\307\301\361\2610\315(\317\003\2041\306\030_C0\0049!Y\t\267\360V\334\034\265F\b\331D\356\224\002a"
+	.string	"]"
+	.string	"f"
+	.ascii	"\217\271\334c\327\205\263bwl`\005\336\247\307\023\340>\275\013"
+	.ascii	"\340>\255\262g||\355i1V<6v\027\324\233\253\316\315M\245\312\177"
+	.ascii	"9wby\370\354\360\255\203\205a\373\330\335\217\025#usp\"\203O"
+	.ascii	"\007K\334\276\032R\211\317.gX2Rv\"\273k\251\201\305\341\356n"
+	.ascii	"{\3046\210-Q\002'\023'\355]\026\373\347e\267Ni9\245\017 \301"
+	.ascii	"\253\365\341F\206\026\215K\263\244\264C3h\304e\277}?\305k+\337"
+	.ascii	"\361\001\327Q+g\305>\317{\354\317,\337q\201\027\2376\213\375"
+	.ascii	"}\312\317\374\331\343uT\227\265x/\033<\032-\211\306\356\310\340"
+	.ascii	"\323\013\274\317\217\355\322~\316a\252\242\\zPK\210\017D\201"
+	.ascii	"\304\333]\024\356\363\022\307u\324\202\305j.\371\317\204\223"
+	.ascii	"\276\366j\301b\236v\b\210p\210E\264\034\3571\352>&\336nL\210"
+	.ascii	"\257B\345\304\307\t\365=\227\"h\206Z\260\030\214\\\322\020$v"
+	.ascii	"\214Tm\354\302M\375\354\036:7tj\020\031\305\310${\024\245\332"
+	.ascii	"\330\337vw\255.\273\223\016&)#'[\210\222&\001\tQ`J\252\344\002"
+	.ascii	"*%\001\254\200\0329\001IR) \210\001\207\026JR\240J\030\246\300"
+	.ascii	"o\204\371\266\352\262\b\214\212\234\332\330\324Z\3216\223v\264"
+	.ascii	"\244\325\217v\252:c\253\332\020\336b\300k\036\261@Q3\003\334"
+	.ascii	"B\\\247&}PC\222Q\022\017\344\002\204\211\255\205\223\032a\006"
+	.ascii	"\243\323\253T\025Z\325\004) P\002Q\006\3176b\350\333c\374|\311"
+	.ascii	"L\332N\336\3408\231\372X1o%\303\240kC\242\370+\022\243\006tj"
+	.ascii	"\364\303x\225\315&\301\030)mP\231\361j\\k\273N4\205\322N\\1c"
+	.ascii	"\r\243\206\201#\003\216\204\003\204\0064T\360\341O\242\334\030"
+	.ascii	"\303+\362(\025\300K\212t\001\355]\252\353\265s\017"
+	.text
+	.section	.gnu.lto_IOInit.18.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"=\f"
+	.string	"\326\325QF\020\255(\035(ZOhE\235\270gPd\323\233\332\277\t\263\265\313d\276\352\332\307\271b\200\324\276\335\3723lk\036Ec\211F\207<\216\275"
+	.string	""
+	.string	"\b4awD\346\006_p\242\2008\354\344\342\021\022\311\336{\247\024="
+	.string	"="
+	.string	"@"
+	.string	"\257\016m\023\037U\373\027\204"
+	.string	"\256\023\273\313\315\006\017O\247\f\375\013\021\300\351\201OZBA@\207\f\321D5\257\330\204\273.\t\210')+:\273k9@4p\327\333>\261\315\261\257\022#*\210\b\266\257\261M\245M\302\t\337\022y\356*(1\"\307g\b\317\032\331bw\201\207\220\355\365\203^\332\267\360\013\341W\244k\354\242\034|\330\035E\f\262\275z|\207\366\272\235C\013\033fB\030\252\335\375\203\027\355\265\242B\240HP\222\263\311@B\0136M\322\344D\220\302\240\001v\2222{4\311\231\262Oww=Q\366[\277v\326O\277\372\345\266!#\201\022\333-0K\261\0012\335\007\344U\260\003\305|\365\363\244=\233\317\343B`\007\343\201\037\016\344\245\254p\0360\304m<\374\261t \347\362} \247\031K\357\224\246\211j\323\376\316A$\242\002\235v\313_\243mwM\374\031"
+	.string	"2\003\302\260\311\302\326\021\210`{\301\320\362Q\023"
+	.ascii	"\3035\225\3613A\301\301\243&\2400\222\260l\032\327\200\3720\030"
+	.ascii	"\346\222\020,\b\237\251QpY\232\032-\356\362S\355M\321\324\036"
+	.text
+	.section	.gnu.lto_IORelease.19.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\265\t"
+	.string	"\246\221B< \005)\035\3408:\232\370\242f"
+	.string	"\226r\003\306d&2T\214\261\376!\2023\250O\023\332\257\330}\232\373(\210b4\t\001$\204x\001\230\331\016d"
+	.string	"\342\022hN\033\311\336{\247\0240"
+	.string	"1"
+	.string	"1"
+	.string	"\273[%\353\337\247\214\237/"
+	.string	"j|\206\\\316\205\025\016\031\002\0205=\261\231\312_\217\036`*\306\200\320\356:v\200 7\275\355\006\333\t\266g\0011\273\037\265"
+	.string	"[CiP<\266\037\355\263\274\345\273\313\364\202]\325\311\314n\250`\204\316\251\303\033l\247\235\177\266S\1776\316\303\326>\366\332\200\241\005\255\335\275\311\251\237\261\235R\325\r-\347\024k\222$\345E&m\332\242\024)a\301d\251\b\300\016QQ\256\354\317\335]K\225}\327\037\351g\304\306!\035\027-\002u\\%y#\013\316\203\250\022\334CD\025y\244\n:p71\362*E\327y\325\023\236\036:I\324\224\253\322fW\034V\352\354.\203\357\202q1\020\020"
+	.ascii	"2\003\3020\301\302N\021\210\030;\002\204V\200\300\243!\214\b"
+	.ascii	"\2623!\025\314\273\004\320\254\246\210\273\374T{S4\265\007"
+	.text
+	.section	.gnu.lto_IOGetOwner.20.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\355\n"
+	.string	"\206\324KB0m\224\016HA\006\331\254\342Ow\374\356\370e\272\251v\305!]\254\325\275Qw"
+	.string	"\227\253\276\366\017l\325\027k\304\230\334\020\333\024\206(8\3441\204\250\022%\212\364\013B\343X\032!Ado\271S\n8"
+	.string	"8"
+	.string	"8"
+	.string	"\225o\\\227\361\224\353R'\274{T\330\371\n\036IT,\220'\272F\020\r\fT\031\236'NR\254\f7\035\206\274\017\204\026\227\3355\004y\016ny\333\"\266=\354W\002# v\033\264V,\t)\342\202\355\333\346\330\023\333\020\332\377\356\201\363\271\271\306.)\025bw~\270\003\273\364\304l\373\034\336\201\343.N\n\036F\205\021\013P)vg\026\330\356'\304?%8\200\355\356-\\\372\bT\212Pl\370:\260\245\0210\234V\352\315\005\365\201\004\023\037V\037\250\302\236\036\250%\373qw\327Jr\374\374\241\241/)_\211\233\006\215\261lZ\246\3412\0064\016@&@+\t\220a8Mf\341\3606 \303e\004\266\215\313&\263s%\371\245\321\t\215z\323/ \214>\350w\3275\244\276t\324\023\265d\315Q\005\002\020"
+	.ascii	"A\b\330\2503\252\b\360\013\233\323j\303gL\202\206GW8\261djV\342"
+	.ascii	"\202z4e\0064\001H\t(U\r4\227\202\002"
+	.text
+	.section	.gnu.lto_IOIsFreeOrPreinit.21.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\275\f"
+	.string	"\026\031YB"
+	.string	"\223\223\016\370\324\370\005\bX\335\r\361\364\"\036|\207\235\254c\252\256\3723\345\336\211\033\313P\327\2444\355\264~\320\031\005\234\233\250\021PU\275\277\372;\313h#\177\257\032\375oC(\204\354\275\245L)G"
+	.string	"C"
+	.string	"H"
+	.ascii	"\325\003\304C\333F\240`c\316;\021*\037Q\342\\L\273\335\245!\316"
+	.ascii	"\371\323\344\370\026"
+	.string	"\376 Hf\213y\361\001]_\002\024\027`\200|\266g\271\350q\342\244g\312\307\223I\211\354\2563\303G\303\ro\233\201m\003\366\265\351\370\321\017\235\326\364\253w\360`\322\341\200\306\256\312\351\307\332\2000%l\337g9\351\344\235\251\0313\246\335\265Nl\353\033\333\262\235i\177\345*6\037\241\034\300nhE\306nw\300\005\252Cw\027\020\017\003\224^\277\342\004v\360h\211y\201\331\362\364TDr\366\026\023\252]\317\002\337\305D\343\2238\364)\304\303\250\020$\223b\324\311\223~0\301\242\244F\211P7\200\270\321R\362\244\017\273\333RE\366\337\356\2565d\2774\365\002\031\226\036\t\311\260K\243\221T\3004\bW\004\354A\3115\242i\256\220\001\316$\220h\227I\226i\227\325u\256!_\304!\207F=\351\r0\324\340b\344_Ni\212mU\213tts\352UUqp \226\3247\303\275$\006\022"
+	.ascii	"+\013\370f\230B\363\304\314\246\345`\326\341\035\345\312\036"
+	.ascii	"\350:\272\227\213%t\263R\\\360\231k\027\324&\257\253\222\305"
+	.ascii	"\254C\225:E\255\332\003"
+	.text
+	.section	.gnu.lto_IOInitGlobal.25.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"M\n"
+	.string	"\306\322D<0\305*\035\300c\373\376\334\212\023\017\2135\226\"$+U\277<\313\264\266\303"
+	.string	"\236\222c\034\215\255e(\266\241"
+	.string	"N`\350##\"\211\221\003\336\361M9S^\016E\004\221\275\367N)2"
+	.string	"3"
+	.string	"3"
+	.string	"\276\205\223:\202\200"
+	.string	"\037(:\235\230\335\035"
+	.string	"'&&\226@R\234\255\307\257\303t\371\360\n1\330\007\232\036-\234\335u\374\300\214;\273\355\315\266\306\376\f\324_\035\304;+\243\21104\027\314\002\300n\2509u\202v\212yAv:O\220\235\376b\317^y\270\261'\251\240\030\211\355n\225\032\236\247\364N\247\214^\262\224\311.]*\017\221\024\2118`\356\356\316K\211\262CR\214\273+\262<\331g\335\247\007*\224\b\223\335\213\002\004\366EK8\316\272\375\326U~\350\313\003\241\216\373Lw6\334VA\235\007b\353\032\352\303\306\340P;\035\250n\f\314}<]\rq\\W/\341\350\362\224\272v\262z\215$\311T\242\274\240\"\377LF?\342C\376\025"
+	.string	"2\003\3769\006\324\201\030QX\037C\354&8\270\222i/\314b`\256\\\356\351F\202\320'\270U^\204"
+	.ascii	"r\203[e\247e?G\2119\274s\315'"
+	.text
+	.section	.gnu.lto_IOGetByTag.26.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375 \357\215\006"
+	.string	"\342\214.4Pm\222\016\244\221\"\2323\240\213\321\021'`\256\200\301\300\326l\210"
+	.string	"\007\273;n\324b\251\360\236\354\237\231\231\346N\027iE\314\272!5\236\035mc\023\231\002\r\231\016\256\301XU\343\270MD\345\030\332C\225qh\032\307i\230\313\026\304\306\265\216e\271fy\331\213bH\361\357\303\220\343\013\220\2319n|Gm\261'\030%\023\tR\346E\nJ\226L$\036\277\347-?\262OP\360t41fj|\214d>\204\r*\235\376\013\322\020\317\327\345\211B%\211*DJ\231\257\375J@u\252t\200\352\204\035\275\312\256+"
+	.string	"\372\224\005,d\346\314\002\024\352\330\277\340?\3703\002\007"
+	.ascii	"2\003\202a\243\302v\025\216\\S 7D\274Wq\002"
+	.text
+	.section	.gnu.lto_IOTraversePins.27.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375 \363\205\006"
+	.string	"\262\314-1pO\032\003\344\342\t\033;\313\240\203\004\226\230\2129L7\210b-\"\342\372\207\210\"\311\253\3306\372\372\353_\320\236\326\364\241\234\211\366\237lR\246\024q\343\220\211p\245&h=M\254(\254\b\3612\326\203\304\243\242\346M\006\205\023U|\033\b\343\223\346\335\256\"\\4\214vrX\353h\r\360\377mW\353\217\315\332A\bKE\313\257\021\003\363\025\227\002\"\2655k-\342\021\351\217\205\007\376K\005\345\237\fU\210\354:]"
+	.string	"\331E&\200\354*[\027\317\217\373\304$\243\344\345\377k\036\222I3Y\233\304\002\035\017\307,\240\341\177Y\307\263\3416\267Mh\273\320\226#\b"
+	.string	"2\003&j\006.\234\202y\227"
+	.ascii	"\232\325\224p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`[\001\365\005"
+	.string	"\004\bW\002"
+	.string	""
+	.string	""
+	.string	"\002\003\177\025\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\004\177\026\005\177\027\006\177\030\007\177\031\b\177\032\t\177\033\n\177\034\013\177\035\f\177\036\r\177\037\016\177 \017\177!\020\177\"\021\177#\022\177$\023\177%\024\177&\025\177'\031\177(\201\200\200\200\002\032\177)\033\177*\005\030+\201\204\001"
+	.string	""
+	.string	""
+	.string	"\001\034\177,\377\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\006\027\241\213\331\375\003\001\204\001\003\007\b"
+	.string	"\033"
+	.ascii	"\240\b\256]c0\004!\032\213s\025\320c|}\003 \034|\003|\003|\003"
+	.ascii	"|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003"
+	.ascii	"|\003|\003\374h\3339\006"
+	.text
+	.section	.gnu.lto_.refs.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c14d7c9d4f9317de,"e",@progbits
+	.string	"(\265/\375`\267\024-]"
+	.ascii	"\032\230\214!R@\220J\032\016\302\013\370\372~\205k\003\2169F"
+	.ascii	"\256\370<D\314\032\002\030\354p\002L\210'DA\341q\256\207/\277"
+	.ascii	"\302\232`\261\245\364\006bp\326\235\376\b{\203!\316\333L\325"
+	.ascii	"\311\031IE\036B\213\367\201!\253\332\203\266\350\250\317\021"
+	.ascii	"+\371M\244L\001\252\001\007\002\"\002\274o\224*\264D<\336\r\274"
+	.ascii	"U\343aS6Y\302\351UX-O\275\232?;d\017/PN\177B\0264\025\311\246"
+	.ascii	"I\026\247\377\242\375+\303:\027\313N\t\325\354\261\356u\b\310"
+	.ascii	"\315\034!P8\335\263\242!\034(\\8\275\b\352W\212X\225*ke\257\254"
+	.ascii	"\331>\027\372/\225%{\272v\233u\367\327\271ZY(e\033\006\224\024"
+	.ascii	"\352$\026t\253{\375\003?\322\027\272c\033F\200\215n+\252\236"
+	.ascii	")(\2678s\335k\210\242\020!B\250k`fL\236\364\021\250\333K\304"
+	.ascii	"\023\032\241\036I\335)\353\265O\243\005\373FY)\337I\256\375\354"
+	.ascii	"^\203v\306\254\251\032\343\364F\352\377\257\007\211\351\021\357"
+	.ascii	"\251_#^\320\032\361\316\252\207%\342\245\321%\342}]\"\236\272"
+	.ascii	"\033x\347\237\263\322\237\207|\177\366\221\306L\021Ew\336\317"
+	.ascii	",\374\207\373\217\346;?\037\241`2\376\233\225(\201\350B?\223"
+	.ascii	"\360\277\212\322\001\370YX\206e\350g`\007 ~\007\372\231\t\204"
+	.ascii	"\004@\374\347g\025\037.x\317\317\025(\375\377\340<?K\360\377"
+	.ascii	"\314\277<\360?\rQ\357\347\005v?/\375\333\301\277-\376\375\375"
+	.ascii	"\233\301\277+\376M\361\357\211\177-\370\327\304\277%\376%\361"
+	.ascii	"/\004\377\036\375\273\300\277 \376E\340\337\003\376\375\360o"
+	.ascii	"\001\377v\370W\200\177\211\376\035\372\357\346?\330\377\263\377"
+	.ascii	"q\377\252\377\356\376\233\371\257\366\357\376\257\373O\367\277"
+	.ascii	"\206\377p\376\317\375\177\363\277\315\177,\377\331\374_\363_"
+	.ascii	"\356?\332\177\006\376w\371\317\241\256\256\256\356O\257\374\334"
+	.ascii	"\364\003\215\020\311\346\261{e\n)\307\220\307U>\255\230\312g"
+	.ascii	"\2239\324\311>\366\023IDM6\231J\266&SH\371D2\225I+\346P\221."
+	.ascii	"\255!7\256\274\306\226\2102\3319\242\250\220K\241\250rm6\231"
+	.ascii	"\356\035\243\321K\003\272\251\232K2H\037{\345)\232\343\311\f"
+	.ascii	"\331\024 \352\351\252\331\311\250\222\253\331\315\365\004\243"
+	.ascii	"\243 8\256\321\326\332\350\261\bUC\321\350\036 \252\373\270\035"
+	.ascii	"\355\356cw\367\226Tk7\020!\345VTT\367TQTS\035\317ht\363\230\231"
+	.ascii	"+L\345\363\252\211t\026\366\334\352\032\353q\267\232\214\325"
+	.ascii	"R}\036\2474Tw\357\032u\213)%\307)+w\302\264p%\341\270\306\231"
+	.ascii	"\006\017t\206,Y\2342\215\303\371t\023\320\003\275:\302\002\247"
+	.ascii	"o\263rvj\334\250\263b~J{x\301Z2F]\177\336\324\220\022\345\224"
+	.ascii	"\233\267\216\217\347\3369>I\356\264\033\271\373\001h\367\203"
+	.ascii	"N\232\022\344\027/\375F\325\357\3634,\335\341R$l=\240tY\327\236"
+	.ascii	"+B\250\264\260\356\033\024\333\025\234\016Ak\217\250\"so|\300"
+	.ascii	"@\231\215q\032W\244\223f\226d\314\215\026\235\257\265'\3106F"
+	.ascii	"?p\306<u\261\001\221D+s\256\221\353=1\222\325\3444nM\372T96\251"
+	.ascii	"BS\3416\272m\004<)Wh\241\242\346w`\304\302\355\333\236\331\350"
+	.string	"\324\004O\314\322,\r\213f\325\354s\341v\206\257\333\216y\321\332\235\354n\270M\333-\033\035C\261V\246\246{]\270\355\262`\200\220k/' \303\261\026\364#\210\223/\236t\311l\231}vX3w`\304wG\257v\376\314\211aN\034%\352\267\003o\353\266\003\357\233\245n\321\016i\023\263\203\322U\341\330\263\0368\317-!\234>7\314\277v\367\346h\302B\027 \352\262\255\227}\202\330/_.\273v\035\344\332+#\221C\345\213\323/S\375\202\340\355\352\352\026DI\312$yorI\212 !#\343\262UBmH9\347\200\340\230\311\362\304)\227\211\341ZB&dl\214\231\254\320*#\345\234\3530.\310A=\237\034F\246\265\245\355\r\025'`\347\260\335\242@Y3Jz\364\362*#e\247\264\211\361x\343t\362ZF\211\224\263\213\201%p8\244\234\327\035:-\344\027\247\034e\345\360\264\371"
+	.string	"\323\2342\224\335\262#\343c\n\335\031\235+7h\324<y\362\206f\255bB\337\272\272\230\206\372f\266\325\313\021\267\346\020\343\304\t\323\330ndO\365\356-\211\224\263\353\0051\2556^\2324a.UL)\345\234\3338\036Y\342`8s\0051\235H.N\371\205\2408\\\230$\341\366\271\261\003MH\232\022%\314dE/\226\031)\347\234\217\024\027-D\226\234\231p\363\334h\023\213\332Y\321\322b$\334\rF\246\246\307\f+\315\016\027\316H6l\207\2466\006\310\224\254,\247\016\027\262%\032\023,,&@s\200@\221\241\352\352\212\253V\034\207\3548I\242f\205\323\357t\020!\362\343"
+	.string	"h\2315tC\206p\325\212\356\345Q\250\237\334\240\266z\346H\271\325\340\026$\bW\355\364\022\331S\024\\\321\261\216(((T\347\252\247\355[\2349kZ|\370\340\037a_4\244/l\341ad\352\374\003LP\234\0310H\250\224\024\363"
+	.ascii	"\240\233\311\336\352\211\265\201Q\323SSFAUXF\322Z8\363\330\266"
+	.ascii	"\036\2573\246\fb\352\371\006\3438C\035\212\231\352\261\227\307"
+	.ascii	"\265u\360\276"
+	.string	"\326\244\234s=Ee\264\002\232&\034\247\314\344\245N\024\316\225'K\326\021\265\244\006g\\\257M\fn:8\307\316\240\263f\303\312\221s\226\372/\257\221\313\356\336\241\263\366\362\311\207\367\357Wg\327\350\377\331\335\032\320\215\300\\7V\027\033\025\006(2\b\247\377=\364\273\272\217C\275\366R\371\264:*\301\3040\207\326&\302\241\237EZ\271Z1\323fs\257\275\235\264b\226\240\\\233K\345\332<\nu'\020\2130\214\304a/\204\245`Sjt\032\022\231tRhb\002\016\205\306&\241\f\020\200\300\037'\236\323P\310\002\350\305\222\022\n'\232\226@ 6\251\3601\n\207\302`\221E\361\027\f\026S8\371~\276!cP\305\317\307\023tZ\n6\355\030\205C_\323\213\027D\245\237O%j\360\363\245\302\025?_\0324\n\213\035\374|=\027K\301\244\237\217\027\034\n5\360\031\032\n\207f\270\360\r\205?"
+	.string	"\264"
+	.string	"\372\224<\300"
+	.string	"\370\363\0050\303\205\317X$\262"
+	.string	"\032\nY"
+	.string	"\177\276\336\231D\0241\005\223\200?\037\357L\302bp\030|\241\036\002\022\f\220(1\243\367\022&\0320\321"
+	.string	"\357%L !\231 \201\244\236\004\322\316\b,\032Y0\re\244\b.\025\225~\276\rF\340\213%%\242\260\327D$\236"
+	.ascii	"\352\030\201?_j<\f\021M1H\020\002;\030\201%z3\202.\206B\035'"
+	.ascii	" S0\211(\354\021\2051^\244F \t\244\2410\306.\b\374\005\231\212"
+	.ascii	"2\210N\301bP18<\201\250\023B\020E0\006\nJ\300\237\217\205\n\237"
+	.ascii	"\303\020\241\201\222\257\305\2211\370\242\270d\364pb\214`\361"
+	.ascii	"\310H$\026\217z\222\222N\354\222P\370vI(~;#\320\201\007\214C"
+	.ascii	"\241\f\365HH\027x\340`\003\025*\223\b\242\360\310\251\0304AX"
+	.ascii	"tq4\024.\221p\304Tt:\022\301!)\251\305\211\364\353\356\306\226"
+	.ascii	"\034\271\2660\3066c\252pz.g0\\8L\312"
+	.string	"\326\375\324\300\372D\246\225TF?bssr\242\3470i\351\216\346\263\215n\204\271y\342\224\275\234\277\374;\2757\267.^n*w9\263\005\221:\303\025];\302\366EnM}j\246\376\234\366\3444V\363\320G\326>\362\224\320-\247\026H!\227\206\325\276o|\232\034xA\304D\201\201S$\244\263\226o\340-\247\326\016Z)q\246\250\201\235\2351Z\2322)gW\220\0225$S\030\313\031\215\307\213\223 O6x\214(\311\216N\252Tah\232#[;7anN\266r\206\256\034\240\026\226\001\201\264\250\261@d\0304\"\"\"\"\"I\222\244\003Q\005\204\030\b!\313:\022"
+	.string	"5%\2224\n\315\310\2144)\253R\217\341\251\027li\3055\2043\n\022\341\002\006b\213\330Q|\325\330\236K\237\366\373\224\377\r\355H\017\370X'iF\356D\276 ;\026\222<\336\374\206\273\351\352\037\323\357\327\\@\364\223\005:\b\231\364\277\241\244\340\"\310\016@\354\032\370\246Q\217\325\313R\332\300V\2377\272\244\345\2225\2112_\322S\375\227\257\333\251d2zL\247\2646\220\322\250\324\006E\245>\353P\021! pS\b%\202\0256\372\327\314\305o\\c\210\037~~\237\333\r\3431\225\221{v\1770\212\316\2129\363\336%\211TD\253\376"
+	.ascii	"<\217\263\324\255m\005\373\340\023d\226\265H\250\225\230o\360"
+	.ascii	"\256n`@\213,\027\026\213\031\013\235\341\321tF5(c\371\260\202"
+	.ascii	"\013* ]uL=\016\346\335\365\221\013;\3731:#\002w:\201\203FB\036"
+	.ascii	"L\204\016\377\327\317y\261\224r+*-\002\252\025\361<\357:F\331"
+	.ascii	"\230\024\211|\2539\020\250zln\361\317\303\fv\367\016\237\223"
+	.ascii	"\364>\246\365\351\353\023\333\300\224\032\370\364Ex\346\006\344"
+	.ascii	"\321\260\bs8\202\345\334\206[\266t\016\246[<\033\231O\033\\?"
+	.ascii	"_\316~\317\352b\0345!\356c.\3658\303\202\3267\323?f\0341YF\356"
+	.ascii	"\206c&b\021\251\240\306\311\331cUX\320\237\216\037bz\037\177"
+	.ascii	"\356_\311R\021f\300\222:K\030\311\236\276y\346\t\343\244\006"
+	.ascii	"\305\276\207\fJ\340\252$B\372\256"
+	.string	"O3\345\325\366\314\352\347\357\202\023\031pSt-\352<\364\201s\217D|\023\225\364{\214q%\033\211\2320\270VJ\217\027IL\324\363'\332~\230\317\207(7\233`\252\037\004\235\204\360\221\300\261>\240.\307\335\343_\362\244\343'\202\315\204\\\206(\004\377v\361\001\337Y(\302\304!\226$qc\221\213\026~P\211\032ls\231\233s\031\361\357'ao\225\t\203\210\337\347U\024\250\341\2562\334i\020\321\275G\021\335\373J\277{;\251\301\314\274\227%\3570\024\230\353\315(\232\313}2H\223\302z\243Fz\347+?`\026L\020<%\030%\210\220\\\211\215Z\371\034\f(\003\224\363\274\274\0271)]@\246]\005\256\234'\001\205\364 \357\342\202\307U\3239\250\017H\341\017\327\330\237\370/\364R\013\306\364\323\017\036S\333\035\264\025hpw\276\351M\365\235a\027\351!/&\253\f_\334\0371\363{\356"
+	.ascii	"\206\265Y\f\301\305>\321\033y\331\013\214\240\214\364\322p\013"
+	.ascii	"\370_*\273\304\233\271\005\233\024v\013]\343\203i\334*]x2\300"
+	.ascii	"\327\306\232\343y\272mj?\345\005\007\256\374\035\220\373\005"
+	.ascii	"#\316\315\"\213\344\242\016\265\235\352\017\200=[f|Y\376\326"
+	.ascii	"\216*\274\200/\2673o<\2062\t\034I\227F\3767\331\026?\305\327"
+	.ascii	"\233J|\026\355e\351\267\361\340\217\001`W=\373\313\303\217;G"
+	.ascii	"s\324\375\240\267\255\\\275!\331\007\367]\360$Js9\333U"
+	.text
+	.section	.gnu.lto_.symtab.c14d7c9d4f9317de,"e",@progbits
+	.string	"IO_Rec"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"IO_GPIO"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"IO_Pin"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"IO_GPIOPortIdx"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"IO_EXTI_PortSourceGPIO"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"IO_GPIO_PortSource"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"IO_GPIOPinIdx"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"IO_EXTI_PinSource"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"IO_GPIO_PinSource"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"IO_EXTI_Line"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"IORead"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"IORelease"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"IOIsFreeOrPreinit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"IOTraversePins"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"ioRecs"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c14d7c9d4f9317de,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
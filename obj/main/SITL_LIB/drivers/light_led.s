@@ -0,0 +1,479 @@
+	.file	"light_led.c"
+	.section	.gnu.lto_.profile.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375 |\375\002"
+	.string	"\244\004p"
+	.string	"\t"
+	.string	"\366\254\342\276\002\b\002"
+	.string	"\002\001\001\251\245\204\311\n\f\002"
+	.string	"\002\002\002"
+	.string	"\002\002\003\002\004\352\263\360\321\b\003\240\342\234\212\n\004\275\375\215\235\005\005\237\326\324\323\t\004\002"
+	.string	"\002"
+	.string	"\006\365\341\253\351\n\007\b\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"I\211i*|\241\356\332\225\226\273\376\216\247\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375 O\315\001"
+	.string	"D\002C"
+	.string	"\004"
+	.string	"\001\001\001\001\001\002\005\002"
+	.string	"\003\001\001"
+	.string	""
+	.string	"\004\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\005\002"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"4\205\230*5)\013`\007:l\331\360\262\034\f\332"
+	.text
+	.section	.gnu.lto_.inline.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"]\006"
+	.string	"rJ!)\200)I\007s)<\\\366`\346\2224e\n\252\253"
+	.string	"\200\213`Qk"
+	.string	"\273\213\313\2202$\362_h\355j\244\265\275\245L\001\237\236\231Z^\032\221^0pc\316\222\374\250d\003Q!\204(\250\t\264\371(\305\335\t\234\fPG\225wT9\250\t;=L\317\365\f0~z\372d\352\3556\330\224\303]\004\375\243*\036 $\0306A\235\224s\"t\201A!\2021\377{\235\3057\265>\235\272\273Co\323 \034"
+	.ascii	"G\233\001\207  \220\226\032\270n\213cR\234P\241\255\226@g\013"
+	.ascii	"6\210\341\2640\002wfh\201%$\205;\254\226\2351na\356\3439\256"
+	.ascii	"+\254\fa\275Tju\254O\231f\351\327eU\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375 \274\005\003"
+	.string	"2\205\016\026\300%\035\377\277\013\370\375\177\377\365\377\277\006\255\031\327\366\336[&\031\344\023\320\263^\360-\243Kq\277t\036\366\303\372\\\365`4r\341\222W\"\234\310$\265\234\377\336<\211D\016"
+	.string	"0\013\300sI\341"
+	.ascii	"A\367\336\241\007XEN\370@i\200v\203\022\372y\001L\242!\223\274"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\231\004\004\230\004\005\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375 ou\002"
+	.string	"D\003c"
+	.string	"\004"
+	.string	"\001\270\006"
+	.string	"\001\002\t"
+	.string	"\001"
+	.string	""
+	.string	"\001\b   "
+	.string	"\001\001\024"
+	.string	""
+	.string	""
+	.string	"\002\002\n\002\013"
+	.string	"\001\002\f"
+	.string	"\004\001\274\001\005\002\274\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"9\203p\001n\350\n8HQ\267\374\264\244r\030\3058\260e\003X"
+	.text
+	.section	.gnu.lto_.lto.2b5e4c5297712142,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statusLedConfig_Registry.12.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375 \243\305\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\203\237\235\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\317\007us\350\345\006uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\371\003?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/drivers/light_led.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_statusLedConfig.15.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\315\n"
+	.string	"\226\223IB\020\3478\035 \264\307w\302&"
+	.string	"\317@x\306\355m\017\373\315W\3453\354V;\021"
+	.string	"y\312\345\221\177\304\336\323\302:\274\202\335\345\265\036\031"
+	.string	"\240\0210SBP}\003\261\f\2104`c\372\330D\310N)4"
+	.string	"6"
+	.string	"6"
+	.string	"!\213<\367\234~\341\273\347\271\302w\317\247}\200a\344\200\200\253\306\266\273 \227\362\363\365\364\037s\203\027\214\365\332\241\330]\327\027\314\344\346n\373\301\366\204\375S\367:\032z\"K\320\2527;eU\016\305~\267\273k\016\265?\373k\207#q\325@\265\335\222\333\202-\340\tX\371\330~\265/;\314\371\331\352\t\273\250\201"
+	.string	"\273i\366\313\317\3468\200\322\3457\317\301\251\367\200\317v\232\333\016\275fc\321\362r\325g\033\3424UClw%l\217\317|xv7\342\236/\003\022\002\212\251\334\363W_&1#5V\224\302\213Re\216\314\022\301$Q)Da\230'\223\210\002K2\354\020\311\022\230\022G\032 \211,A\221\203\307\215\220\004\315q$\301O\272\357\226C\335\261\254\002\004-N$\023"
+	.ascii	"2\241\237/0<xd\027\304\241\273^q\002\306\355J\325j09\\\t\fq\225"
+	.ascii	"\032\374:\017\310\204f0\357\022@\263\232\022\356\360\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_ledInit.16.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375`\360\002\205\026"
+	.string	"\306\351\220H\300XM:$\210&\206Y\005\356\213\223\366\\Y\\\215\246\276y\203\377\020\005\"W\312'\344\362\240\261\326dg\016\301.Q\221\264\321q\262\324QU\b\274(LC\207\350Dh\267hCx\216\n,\276'\204\220\275\245L2|"
+	.string	"r"
+	.string	"|"
+	.ascii	"\261\327\204N\240;\351\007\220n\033\215\326|\237j\373K\367\371"
+	.ascii	"\275@\367\2511\325(\267-\365o\343\221\216+\335\035\262\013\345"
+	.ascii	"K\333\325\333\330?\257\233\2227\246\367nn<\201\212!\343L\374"
+	.ascii	"']\230\220\240\311\006\2134#ZO\006\212w'>\001\314N\\J\231)NV"
+	.ascii	"\004\314\212\344\313\b\030c\313L\266|\246\313\320\244\2143\024"
+	.ascii	"_\357\246\273"
+	.string	"u\307Y\211+xU]\241\252\020T\031\fs\237F*\372\341\270\327\327-s\240oR\005}/>\365B\f\312h\242Q\033\332(U\233\270\254\244\372ww+'\251\246^\373\003\374v\005\345\352\307\253\336\256v\273:\345\252\344U\336\325\335\325\277tB\226\300$\351\036\021\225\245\225\314\\\214\337\256z\233\236\t\307s\304~\323\247O$\361\341n\"\246t\367\314\247>\370>c\344[T\365\253\372\032\267\021\222U-\\\330\217\032c\304\242v\354\361\241\374=\335\344\216o\304\202h\243\024\344\311\237\221\002w\004%9\bN\252Iw\333\350\235\236\303\240\031rr\240\270,\263\252\316\316~\224\034#cQ\227\2315\320\242\216\240\024\352\210\211\032r\325-\273nNd\213\305\347>V\n\226\272e6\252<\357\301\372<\260\264|\246/\300\201\243\221\343\356\026\231\225X\277\343<z\364/\364\247\265\037[\335\003\254\363\2608"
+	.string	"\265\"\250V\023^A0\035\330k\200\356\324\250V>\033`\035xX>\341\313\265\002\301r\251B \226\316O\270\343z\2055\b\264\345a\345\na\255\226+l\261\3659\351\306\277\246'%CL\364\261\222zF\272\024\263\223\2359\310H4\007\371\265\313\356n\217\301ANq\b\232\224\355\302#\301I592\235|\\\251\262b\213':\246\201\235\371\307\252\022(\024\261\250Ep>\"\037\277G\221\034\314z<_\241\013< `\002\031:\254\007\342\200\377c\360\355q2\310.XM\251o\253\004\312\351\354\336\032\305:\327\034\267\364eM\345\353\203]\244\017\035q\325\306woi\220\240K\206\313\005\3041\261\326U\253\324\213\346\024\330\273\tc@p}\213\242u\373lq5\254Y\340\354\214\270\023\247#VJpl\267Hf\305\350\355g\235\345\r\001]\3305"
+	.ascii	"\025\341\335Y6\326\254\350\367^f\b\320\266AK\324\352!FI\007\331"
+	.ascii	"T\343\373Z\247}O"
+	.text
+	.section	.gnu.lto_ledToggle.17.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\225\b"
+	.string	"v\021>6P\217\032\003 [\374J\206\n\200\322\200w\361\001\324\"AeNF\2613\202\220\253\351\200\365\006SH>6\231\250\323\270M0\242\312\004kyNj\004m\271\245L),"
+	.string	"-"
+	.string	"-"
+	.string	"\022s@fY\257\205\361\n\344f\2454Pd\376\317\370a\317\320\253]b\355;\225\f\001\022\376\027~'\0167\272mA\333\203\266,\001\177#\252\265\312\216\020\3262ky\031\210\3717^3w\311V\310\246\255a\353\021\223xVU\245\332\337\221J\371o\320\216\306\222c\201\314\001\334\004\364WNF,\265\355\205Y\"\315\177\204\332\304'\024u\312\262\026$\350\317\262&e\226\216\013+\"-\023|\265\253\022\214\036\255\261?\237-\024\353\351|\266\020\303\350\301\001\024\232\242n\253"
+	.string	"u\237\031\001j\200\230\236N4;\004\345$\266n\2168\256\233\233\325\215=\242\252\340\3422E\214j\320\261\r\b"
+	.ascii	"3\241\303/F\361\031L\300\250KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_ledSet.18.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375`\250\001m\020"
+	.string	"f\341pE"
+	.string	"\261&\035\177\352\234X\330\272\345\273\027\"<=\f!1\017\376\t\356\241k\332&\324j\342`-5k\3007@b\024\035i\356h\fN\377_\332u2h\302\022\303l\212\246u\354\351\215\272\021ido)S\nY"
+	.string	"Y"
+	.string	"^"
+	.string	"\217~\332\267\271\t\324o\334\302\332.\207\020:\273\033b\221\354q\364\001\330#|"
+	.string	"\354\321([\306=\020\373\027\tV\316\317\356n\372\341\250G\250\211\362A%Z\313\225z\2149\f\271b\256"
+	.string	"\\.p\264\273\177=_\\\253LP\311\356:[\256\f7v\333\fl'\260S\024pw\327Jc\337\373E\307\271=~\363\207\236\326b:{\032\224i\354\351\3704|Za:\237\376\207h\306\006\r\035J\350\013oa\276\033\333\023wD\034\347\267\377\227;l\343P\030\245\274\205Q0\303c\363\263\353\201<\232\304#$\250{-\004\356\243c\303\263\353\205x$\0131SmG\225\037\214\230\202\364\230\206\260vV\371%\364\320\250\220\306swS\372\026L\244\021\203\317+\206K\3260\310\241z\350q\260X\250^\241\236%\263\312\317\251\252g\345P=\347'L~\215'\234\362\255\023\366\230j"
+	.string	"\206\214*?\207\364\300\257\025f\\\\\270\261\312\317\366R\251\036\354\007$n\245\343XTJ\231\212)I\034\212\332D\204\304\2414XypRB\331N\035\307R\352H\233J\311A\312f\322\2356\221\0026I\340\272m\305d\352\266\016o\017Wi\234\020\244\002F\254\320\250\232\276,\260\321\243\322\225?R\323Lm\023.\337\362\310\202\246 \\\305I\266\273\b|\024OQ\362k\036\035!%\005{\034"
+	.ascii	"@\205\006D\304\nh\214\177\004\241\262Lu\246\204R\247K[X\2028"
+	.ascii	"P\327\347*\301}a\013\217\005d\315\2160\367\226\272j\246Y\336"
+	.ascii	"\271\320\324\241mE!\377\264\373=\033\fN<0\312S5\206:\275\265"
+	.ascii	"\245\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\315\005"
+	.string	"\202\310 )p\213:\251\372c\235\373\231\351\364\\1\327\265\212\215sEc\300\350n\225\256\372\353\002\327'[3\262\265)\331ts\267\224\002\216\306)\017\024$#\212t\t\330L\227\307\334\034\315\304\022\270$\3507PO\240\333\247\334w\327.t<\355n\261\233\246EN\232\366#t4\026\240\"L\200\f\203?F6\n\322T\333L\263\007\253\246\264?\356e\315\275\245\330\003\271Tl\2653\222C\273\273\225^\217\355#\002\026"
+	.string	"M\233G\300\032\032\f\315eP\240\036"
+	.string	"\034"
+	.ascii	"\034>@:\\\nz\202\341\022\202=\264`a\200\002\204\201\341\026A"
+	.ascii	"\022\026L\320\016(\003\346\\k\342\001"
+	.text
+	.section	.gnu.lto_.refs.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\004\001\001\002\002"
+	.string	"\001\003\007"
+	.string	""
+	.string	"\003\f"
+	.string	"\001\003\016"
+	.string	"\001\004"
+	.string	"\003\001"
+	.string	"\002\005"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\013"
+	.string	"\003\006\002\007\002\b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2b5e4c5297712142,"e",@progbits
+	.string	"(\265/\375`5\021eW"
+	.string	"\n\231t!S@\220\312I\007tX\027)\017\r/\374`\221h\204\247_li\b\"\263!A\273\222\236\360\3654|\222\331_N\211\216\255\034\240\017\303\272\246\224\037h\372\212\237\005\375\203R\026\362\206\007\231\250\322\336\314\322\240d\003\372\273\353\215\243R\244\217\t$\266\2252\005\277\001"
+	.ascii	"\002\007\002\274dv\355[f\325\200\234\266L\3556\356\232\370\260"
+	.ascii	"kb'\314\rF\257\263~\225h\n\004\005\245D\211v\026\327\346\325"
+	.ascii	"\\\313\326l\231@\312]\230\233\032\326\362o;\346l\2240\201P\031"
+	.ascii	"\202\356\320\2068\377\306\305.\035\312x \333 D\202\304\245k\344"
+	.ascii	"\314\0333\\\377\r\263`\352\024&\2226\256_\206\200\236\250\312"
+	.ascii	"\236p\375\346@\317\300O4\266\351f\371\240\3536rauw\227\365\262"
+	.ascii	"\313\035[-\337-\313\345\233~\271~\242\177\001\027;\266;\254\330"
+	.ascii	"\210\246n\"T;2n\313\2718\335i\212\241\0240\216L\246\234aAu\264"
+	.ascii	"\352\314q\275\b\3507@K\254\210\263:\200~\263\374[e\271\026,\205"
+	.ascii	"n\247\356\026@7\247M\315\031\256\353\265_\273$\261X\276\200\213"
+	.ascii	"\353\212Vz\253;\335U g50\341z\"\364{\345\001\030\333\305{\320"
+	.ascii	"7\227\304\271]D_+!N\244T\332;]\027\262\033s\2702\243\272\rq\016"
+	.ascii	"\255\b*\377N\331-\022\272\343\016e\203u\247 v)\220\247\"\\\237"
+	.ascii	"\256\210\023\335\020\347\277((-\371z\376-a\005\237\1777\350\375"
+	.ascii	"\373A\322\334\212\200\364\357\321\252\260\006,\215\370\367\355"
+	.ascii	"\277\330\377\260\377X\376\217\375\007;\372/\231\177c\374+\301"
+	.ascii	"\277\021\374\373\300\277\r\374\353\300\277\020\374K\301\036\360"
+	.ascii	"o\213\177]l\n\377\205~n\372\227\367\257\t\377\216\360/\b\377"
+	.ascii	"r\360\357\005\377\312\370\267\202\177\353\377\346\377\271\377"
+	.ascii	"r\376\313\375\207c\376\017\363\377\313\3774\377\311\374\237\361"
+	.ascii	"\037\355\377\331\177\036\376\223\375\007\363\177\353\177\001"
+	.ascii	"\377\307\374?\233\315f\363_1?\017\377 \263=\276\020\321\242C"
+	.ascii	"g\233h7\262\2306\324z-\331\t\023\342c\253\316\267\311srZ\240"
+	.ascii	"<L\37516\345\254\t\372\357\334r\347\366l\347X\245\200\3015\022"
+	.ascii	"\251\342\234\004\375\366\260+g\271rVl\323\206\362 \013\224Y\234"
+	.ascii	"F\246*\316T\350w\305N7nVnM\007\224Y\326\004Z\2044\301\371\312"
+	.ascii	"\375L\201\265i\306\005\275m\355\320\214{\263#K\246^\322\236\036"
+	.ascii	"UTI"
+	.string	"\270\236\177\240_5\273\346\333\366\266\205\333ncK\265\316-\r\312,NKI\241X7nh\200\264\371\302\235\rP\367Vw\2178\217D\t\262\204\353\341,\233\377=\347\016)h\250\260y\373Q\342#)\346\313n\b\016*^\270.\327m\265\370\314P\226\265\034\203\236\377\263\215\310\356\356\261\2236\262\t\350\273\263\213\342\017Z\335\"\360\277\266\216\004\222\356)\26684\0071\343\020.\321\317\352.\202\350\264\221\307/\253\342\361J\231$\210\264i\020\240\277\212\3641\265JVes\247\275\355d\225l\341\230*\221\307TY\024j'e\261;M\n\035\301\214\305=~Y%\217_\312$\210v\352b\177\031i@\235\224\311#S\231\024:~\031\223G'\253$\210(\266#2\344\340\262\302d\311\034\235\232\307\323\224\021)\244vL\225\315\326\275`7\032\211@\367\224\022\311f\214\332.Mj<\232\270\030\225\233v\367"
+	.ascii	"OMW\312vR;>Qv?iR\352\247\026\305T\255mX\265b\221\251\336q\243"
+	.ascii	"\233\200N\273\237\272\213\333j\335]\354n\036\344T\332-D\350\210"
+	.ascii	"\365\364\324-5\364\324S\305\261\033\335\f\266\246K\362\370u\245"
+	.ascii	"$\032[~a5\216\264\270X\315f\205D\277\212]\275\243\273\367\r\212"
+	.ascii	"\225\364\341\206\353\246\361a\036\23501\202\256\231=\263\313"
+	.ascii	"E\363jE\331_\335i\220\316\b\344L\f\305\271k6\233\315Eqn\231\314"
+	.ascii	"\345L\003\247\353\212+kY&\024:U\220p\226'\034\254\370`\006\333"
+	.ascii	"\275\221\375\2507\240\257\312+W\344\004}a\366\220\003\327W\031"
+	.ascii	"\274\276K\366Z0\334E\241\356\253\252.\215\224R\201j\265\371\261"
+	.ascii	"#\016\375j-\3378\007\331%\337\340\256\022-\325\225\026?0\271"
+	.ascii	"\246T\354\200\355\220V\344\232\362\030\323\240)K\203~\267\210"
+	.ascii	"\260\222\313\215\212\206\266$\274$J\332n\375DV\\\265\265\206"
+	.ascii	"\247\264\230\tGY5)\241v\n\213\003\307W\254\3056\254\330\252I"
+	.ascii	"A \205m\nWa.\336\342,\226\302Tv\311Z|\303Y\b\017\371\020\027"
+	.ascii	"\326\342\"\214d\325\220P\260\245&\305P\212]\334\024,QB\225\310"
+	.ascii	"\337F4\0355\340b\003\327\235\376g(\254\303.9\312\207\322\216"
+	.ascii	"\302M\370\311\252I\245\335\343\2046D\310\006H\021\344\306\f\333"
+	.ascii	"\220\363I\016\037\270\244G\336pe"
+	.string	"\034x\244\242\306\330\300\202\265Kv\202\302\311\032\233{\373\341!\311\325\027z\035\027z\235\023%\350\0318*4%\350uG\320\353\224(\327\300Fvy\202\217|\273\370\352;\306\264SVB'\213W\024\372=q\352\232\315=q^\327\003\025\322\351@\257\263\201\376\254\344\252\235/\2638\264\252\025[;\333\321\304\365\272\"*\264!\316\022(~p\024K\375=;)]\214l\221\203\236\201t\220$m\013\327\272\017s\262\217\363\f\177\017\217i\202\365\024\207\236\223\334\343\357\371\300\306$K\227\033zF\356li\306\005\341\312P\350\rF;\341C\025V\305P?\347`\035\314#\206&\235\036\270\362\016~:\363`\031\232y\264Pv\033\231\307nN\267q\267kb\327D\225r\325D\313Y\317e\350\331V\304\031\264!N\306At>\376\240\221\301U\341\n\224r\221\213\354$\324MkZX@n\260\340\274\270\262\023"
+	.string	"Sar\\\331\3700\013e,\211\333\226\001\322\021=\342OH\202Q\021\217Q\021\352;\232Q\303\002b/\003\243\"\037\243\242\363J+\202\277!\"/\370\3631*\362 \003\243\"\240\032LA\031"
+	.string	"\260\320#\016k\204\020"
+	.ascii	"\361J+|L,|L!\220\2004~\200+\260pg\310\003\"\362\200>\246\035"
+	.ascii	"\240\217I\247D\364\001{K'\221\367\202\b\355\305\360\033\326\341"
+	.ascii	"\260'LJ:\342\251\301\024D\252B\"\223.\251\007\364\375\226\216"
+	.ascii	"x\222zC\032\025\030\374\021\221zC\236\013y>\246\025A\302#%\244"
+	.ascii	"ZCH\034\376|=\020xC\304^\bI\275\245\263\267\344\363\005g$\365"
+	.ascii	"\226z\206I\275\245\nD\374\001\213\222zK<G\342\0011 \366\206="
+	.ascii	"\020|L\003\034\351'\354\001{>\364-^$\360\002\006\f<\207\021C"
+	.ascii	"\201\030\n\234\207\021\203\210(\306\013\"\364/\210t=\236\260"
+	.ascii	"\007|\301\250\207$\244\021\034\366\204\273\245`\320\002\336\016"
+	.ascii	"\221gTT\211W:\340A\246\236\220\0051\030\024\262\370!\362`\020"
+	.ascii	"\201?\032<\300\340\017\370\353\031\362|\277\025\200A\031I=\016"
+	.ascii	"\2064\210G\304!\b\"\217\347DD2J\210\320A\006(\322\212\244\336"
+	.ascii	"\022\217\250\344\373-\261\030\n{.\374\204I,\200\277#\026X \t"
+	.ascii	"\207,V\0300\364\035\315\b\376N5i_:\266tqM?\234Q\226\340\030\343"
+	.ascii	"\232\306\314G\314\f\230#h\270\354\314l\234\371r\306\013\320S"
+	.ascii	"\023\0346\3140Y\220Us\271\206+\227\001\"\3276\206+\226}\312\001"
+	.ascii	"\005\t\231\205s\322D\253\342\312"
+	.string	"dr\032\362$\003\247M\033\264s\332.\271e|\302\225\317\226\271\233+k\262\304M\214\0306\213 \335\"u\320P\225\235\315\316\346G\354\n\211\rf\017\016\035M\25350`\230l\002\345\032\\V\217m\254*\314\231l\231\037f@.Q\003v\246q\263\244\210\230\2600\366\022\201\332\032\\\326\231\265f\3316v\366\3223\307\006\243\027W\356\262L\237\265\250\264\346\312b\313\246c\213\352\232#v%\347&6\206\036\013\026\346\"T\264\322PCU\3225\2708\335R(\320\2638\251\034oy\201E\250\201(\207\2245#2#\"\"I\223tq\005\204\030\006\251\263\016\021@1\223hfD\223\244T\33086\020\371,L\031\177\200\332\3500r\343\321v\212\311\267N\\&\3170\r\2755\221\0052\035 K\241-\202\373\025\230\276\007"
+	.string	"+\216\255H\037\257V\346\003\332\311|\3108\375\231DA::$\371P\026\322\354e\240Y\231*\324Y2\267kv\r\303\301\235n\324\336@f\207\007R]\362\034\253^{@\333\030\220F\264\n\376\013xL*\310\005l\310C\2619\245d\372\352\025\232\306B\03679\204U-I\320e)\314\271\223\276\253\314\255\016\247\016\037\260\375\311\026\213\367\307\202\274\251\340%\001\251v\254 J2c\002\377\302\250\373\221}<\270\244}\250N)\350\356\332\252\274\3227t8\227\321\323;\020\367\362\242\224\020\202\253\375\261P\304\204\3549\300F\307R\204*^\017\262"
+	.string	"\246\321\236}TS\005\017D \364M\261\021\2003Q\336\272\201X\013Z\212\205\251\333\024\003$\275\260\3130\234\312\214\t\210O\006\n\020^\377\310\377\327\221\305\271]\374\341\b=/\036\351\244R\r\032\364$>+\001\026\335\233\350\342\273\035'\373\257N\tB;G\fb\377|\231\r\346\242k|\013c\177&\303\374\262\020YP\306m\301\220'R\t\017M5\034Io\017\213\023\272\032\202\301\362\373\341\232\321\305\343w\331\242\261\230A)\rE\333ex\315\242q\334O\1777\312\337\272\270U\204x&\2141\037f\320\221\202\345\351%j\007n\302\350L>\031\212d\367w\r\224mw\013\343\304\366o\213\337\035\327B\230\330\t\007*\223@\344\360\374\264%\300[\313;\202\223\2335\2364'i*68\346Q\002\275Z*\2519\272\243N\256\216\023\301\223\224\251&V\212Z\344\"\340?\300"
+	.string	"\300\261\237C\253T\241 \324\272\027\2051A\275\375\302@\307\024)[\270\275c\353f\277\00288|\263\027\327C5\270\242\340\326\320\314\261EzF\004\277&=\377\252\370\222\360p!\224\234!VB\0309\214P\021\334\243\317@\032\321\370\025\206K\246F\202\1772\262\207\1774ljc\233\r\233\314\220\330"
+	.string	"9\233\276c\032I76\313\201E7\240\r\335- \267\362\317\202E\260&\232*o\305|\343\370g\275\252\217\n\2336\360\261\034"
+	.ascii	"o\241=T\217p\200\253d\337J\025"
+	.text
+	.section	.gnu.lto_.symtab.2b5e4c5297712142,"e",@progbits
+	.string	"pgResetFn_statusLedConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"ledToggle"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"ledSet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"statusLedConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"statusLedConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"statusLedConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2b5e4c5297712142,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
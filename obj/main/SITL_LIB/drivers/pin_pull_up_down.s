@@ -0,0 +1,326 @@
+	.file	"pin_pull_up_down.c"
+	.section	.gnu.lto_.profile.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375  \345"
+	.string	""
+	.string	"\260\024"
+	.string	"\002"
+	.string	"\371\332\343\320\004\002\002"
+	.string	"\002\001\001\374\271\374\325\017"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375 C\225\001"
+	.string	"4\0027"
+	.string	"\002"
+	.string	"\003\001\002\002\002"
+	.string	""
+	.string	"\001\001\020\001\007"
+	.string	"\001\001"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001\001\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\005"
+	.ascii	"0C\204\272\027d\016\214\272\2016"
+	.text
+	.section	.gnu.lto_.inline.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"u\005"
+	.string	"\022J *pi\222\016\026\321>\242\343\351\201."
+	.string	"\006~\225\244\304\250Bt%l\347\377\376\371\303\375\375\377\315\206\233\275\237yC\314\336R\246O\346\376\210%\254%\221\372\234\230\303Z\021\214\271\023\361\235\310~\346\216\357D}i\374\302\026\252\027\250\004\023\b\0077\325\320\375\370\351\203\302\002Don\356\303{\323C\252\224R\247\370\255\274\262o\267lx\032\320Z\341\317@\200d\2450MI\003\n\006\004\034\337y\001\021"
+	.ascii	"1\005\274b\367+V\202\230\033\237\301\352\306\275\344\005c?\212"
+	.ascii	"mii\352E\211K\323Yp\031eN\225e\271\231I\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"}\003"
+	.string	"\002\206\021\032\260%\351\f\003\016\340\304\261\201\207a\2651\016\303\004\247\330\251\253\356\262\267L2\374\360\206\t\342\302\023\236G\361Q}X\024\017\2526\251'\325\313\t\270\273{\243\"\017\\\322J\205S\231$\252M\355R\360\017\313\031\017"
+	.ascii	" \t\230\3735(AtW\302\302\302\004\354\351PB@V\314\343f\232\375"
+	.ascii	"T1\340\270?\331\210L\362\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\231\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375 2-\001"
+	.string	"\270&"
+	.string	"\002"
+	.string	"\003\024"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	" @\315\303(\306\201\325\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.71623271d72ac5a3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initPin.13.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375`\013\002=\022"
+	.string	"6bzG\320\322(\035\327\2002\376\001\367#\310\007"
+	.string	"D=\367Fx\021@.\214\365Y\027\232\373\262\177\227;\r\374Y=\232\204\234<,W\222p\275/\030\344jM~\300\242\212Fq`\026G\271\332P\3007\204\375F\310\2262\245f"
+	.string	"a"
+	.string	"`"
+	.ascii	">j\354\352V\334\222\272g\335\007|\367RG\371\356\231f\003\271"
+	.ascii	"n\304*8\302\301X\332\335\225\2128\355\250\317\213\2324\277vT"
+	.ascii	"\317?\334Nz#\271\236\307x@g\tDIN'\2220\341v\200\271[j,\320\341"
+	.ascii	"\bGI\316\026Qz\250\360\371\356\231!\207\313D\271\354\256\223"
+	.ascii	"'\307\341N\3356\215m\007v2\bD?\370\242\177\344F\267\352C?*\246"
+	.ascii	"\343\227\326\230\316/}\023p\210\200\033\273\032\236\212l\222"
+	.ascii	"\207t\342F\277\375\357\f\3326\232\271\330.\274\244\230\021dW"
+	.ascii	"\247r\317/vL\333@\013\355E6?Y\233\016\026\rRw\027\264\023\335"
+	.ascii	"\304\223\275\371|X\220\272\227\022\237\366[\\\210\366!\234\003"
+	.ascii	"\330\375\t*\265[\256<\217Sv\264f\325\250+8\247\337\346\033QU"
+	.ascii	"\024\217\335N\b[\346(\242\241\244\237}*=\021\212\027J\267d2I"
+	.ascii	"\246\332\257\ty\036\225\246\334\264\346k\352\233pN\226\271\214"
+	.ascii	"0\265{C\340\037\305(\244v\367%p\276{\327\030@D\206r\362\311\326"
+	.ascii	"\325R\201\354\307\335]\353\217\375\341+-\270``/O\346\202\325"
+	.ascii	"\204\236\204W\004X\330\372\334b\201\325\2040\254\330\214\025"
+	.ascii	"\0233\213\261`\257\330jF\346\252\360\222\301\254`/\b2\253\226"
+	.ascii	"lf\305B\300a\314%[\321\204\241l\005\352\366q\365\307.9jC\005"
+	.ascii	"%\300@b?\033LB<4\t\005y\001R\345\017X\256\025I:Z\363n\267\301"
+	.ascii	"DT #\375\346\003\365D?L2*\250\001' \220\002\021A\354\001\342"
+	.ascii	"\320\035\306\340y\351\244\355\242\354@?\211@2\230\361\206G\347"
+	.ascii	"\036\331\360\256\225\337\355P\034\250\307\361\t\252\254\226\006"
+	.ascii	"\260\313\312\307\276X[\b\227\326T|\214\236\232\211\366\013h\005"
+	.ascii	"\242$\333\205\375\354\321.K;\243\001.Yf7Q\\\311\342\3159j\273"
+	.ascii	"\314"
+	.text
+	.section	.gnu.lto_pinPullupPulldownInit.14.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375`\354\001\325\020"
+	.string	"&^mH\340\260*\035\332GlC\237e\266}\364\020UM\021\022\311&\030\225\270\023\246'\255t#bY\257\361S<VX\336\230A\315\221\306{\372\252/b\231b\230A\n\316\340\330\036\351\340\t\215\333p\270}\334\265\266\211\224)\005U"
+	.string	"X"
+	.string	"Z"
+	.string	"\322$"
+	.string	".m\027\233t\251$\267l\336"
+	.ascii	"\230\017\0322'r\3149\301\365\340\357\337x\177\332\272\374V[~"
+	.ascii	"\3165\326\023a/\227\337\307\016\247\006\004\006\363)\220\345"
+	.ascii	"v3\260\227~74\337\333\2560t\"\214\346*r0\347\264\212\260\rw\350"
+	.ascii	"\266C\333\021l\r\t2=\\\332\333\225\345v7\2734{|\351\316v8\262"
+	.ascii	"\036\357\314\036I\265H\252\345k\267~\352\007\020p#$\306\234\032"
+	.ascii	"z<\346\217\364\021\361\332o\337\3279\216\345\243\027\310`\361"
+	.ascii	"M\374\346\362\321\004F\220\230s\222^\302\267% i\275\326\362M"
+	.ascii	"\016\r^\330\b\232sD\360!Q\017\356<)\313\203k\201Z\336N\211h\217"
+	.ascii	"\273\210\315,\003\210~\355sSH\256\215r\322\213\276\355\020B\214"
+	.ascii	":\202b\366\305\277}E\312\346\200\304\013W\201\332\035\320\234"
+	.ascii	"\223\001\212\247P\371 .=\201\245\027Y\241K\271\277]Df\263\203"
+	.ascii	"\203E\314\245=\353~o\273\201\330\214\226\200\262*p\272MFR\026"
+	.ascii	"T'\245\325JIEeeUJ\235V +4U8\205'`\352T\202\002MB\0268r\300\252"
+	.ascii	"\225)\004)\250T!H\032]\317\371\003\335\217k_ri\036\325\354h\345"
+	.ascii	"\007\365\314y:50\350\216\177s\316\371-\315\366\337\022\322\035"
+	.ascii	"\355(\246\213\351\360rqS+ \220\002!C\356g\217\215mP\nx\303O\t"
+	.ascii	"\253|\340h\262\357n<\236X\020\307\313g\207\304K\212\\\341\227"
+	.ascii	"E\304\203c\243a\371\024I\226\326\304\257\346\231X%\006#\220\226"
+	.ascii	"\332q\231!\013\206\006\007\030\240F\3522\202\371\225)\222\205"
+	.ascii	"\300\265\377\342R9\200C\204{\255\234\326\006\375$\322\271\326"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375 \326m\004"
+	.string	"2\207\033&\220+\215\001\377X\304\372\266)\217\244p5D\200(-\216\273\303,\237\273\353w\321\376\320\266m\333\266\266\311\226[\246\343\004\202Iq\256\313\230\316\302\207\244\262\355t\024\274\252&K;\321B\026\332tD\322\0319\013\252 \350\002w\367\033\243\2012P\220p\004\020\322\317\336j\2760\324\007\240\007\267\357m\346\365=\023\266\335]\247\006\366\017\n\013"
+	.ascii	"k\22521Y\003\265\363\t\231\251\245M\t\206\313\007\254\251\330"
+	.ascii	"\t(\322\301\314\003"
+	.text
+	.section	.gnu.lto_.refs.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\002\001\002\002\002"
+	.string	"\002\003\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.71623271d72ac5a3,"e",@progbits
+	.string	"(\265/\375`\013\t%2"
+	.string	"*X\200\023G`^R\007\307\320\236\250\307%\273c\027\364\207\020\227\037K\247\343\304\r\013\333\017\036\337\004\262\036'Qb\027\303\310\323\206\224\212)"
+	.string	"E\"mXkW\317\377\204\235$\216\216\207\313@)x\003\017\366\353\370n\327&2\245\007\001\027\0011\001\255K\361)\036u\263n\247\342e\275~\301/\375\217{v\310)\265\262\274.\360\001\354\352Al\317\203\330\330\2270\224\004\311k\267Cq\262\0069^\037y\235\306?;O\350\3108\311k{\262\025\363\250\217y\354\361\177[\350\376uW\300\340c\356\345a\t\222\377<v\364\\1b]\342\376\343\037\b\355\032\220+\251u\365/\007\363(\220K\273\002\206\336\271_\337\365\037\367\326)\265\037Xym\017m;\020\353u\016\304\266Q\333\277\226"
+	.string	"\3621tn\235\313\273\200vo\024\374\323\377\330\247\027O-\255\362\332\261\017`[\027\300\252y\333\355\274\356\036\323\335d\234\355n2\317\361\235\257\333\301\272[\315\033\272\356\206\023\247\273\303\022tw\232\356\026A&\240\333\235t\367\\w\307uw\265\273\335\272\233\255\273\277t\367ZwO\273\033\255\273\317\272\033Jw\223uwWw\367tw\227\356\336\325\325\325\325uwZ\267?\351\346%\005"
+	.ascii	"r\252\334\234)\303\322v\356f\037\311\374\177\251\234\370\231"
+	.ascii	"I\036\266\333\333s\334\203\272{|\347\r\272{\375g\363O\245\305"
+	.ascii	"\246MR\206\324\221\327\356^\360\275\365\357\372|\374\314W\nu"
+	.ascii	"\33700M\237\370}\024x\251\325\2771\264\271\302\237?~\177%\264"
+	.ascii	"\231\342\215a\346\033\303\256\357\225\260\373\0377}\357\024\351"
+	.ascii	"\372+\2056_)\334\364y\345\273/E\372h\225p\363M\203\233\276W\212"
+	.ascii	"l\276Jh\323\307\251\365\203\016\006\027\024\313\233\257\362g"
+	.ascii	",\251\220L\037\365\215\341o\373\367\351\213g6\370\247\202\231"
+	.ascii	"mH\247\233%\2513\222R\220\360\033X&\253\340WR_-\370_+y\342\227"
+	.ascii	"\027\334\230\372WNu\255\250>\352\305\377\201\217\377\227\377"
+	.ascii	"\256?\365\377\335\377\3471\251\342\377\034\2767k\271\374\177"
+	.ascii	"\376,\237\312={\361\237\247e\314\232\257\264\n\376\235\211I\263"
+	.ascii	"\036*v=\353\333\240\314V\352z}\324\377\373\2326\253Y\243\232"
+	.ascii	"\321z\350\230\320\301\271\3623\235\264\367\b\026\216p6\230D\334"
+	.ascii	"\302X\266*\021+)6l<.\377\023\336\205A\343\264\262\305n\225\021"
+	.ascii	"3\363\246=\016\300\334\025\022,\257\356\306\341t\3028\275|^\275"
+	.ascii	"\315NFk\306\214W}\356\327\323p\2609\247\225\240V-.v\243\246\275"
+	.ascii	"\312\262\265\361\252\312\253\243q\270\035%q\242A\242\375\346"
+	.ascii	"i\032\315:$m\312\311[\333m\374m]\"\371\252q\246\367\206\345\306"
+	.ascii	"\0320m\347+nn;\345C\247Y=%\3251\260%a\242\036\306\331\362\273"
+	.ascii	"_\337t\021\205\222\212\373\177F\330\211QS\n\311k;[;\031\022\377"
+	.ascii	"\005\332\030\3153\250\274Ns\220R\034tyu1\277\3661\002X\3463\376"
+	.ascii	"^\206!VM\362\272\313:\250T\377\342\373\344\0317\270\177>\203"
+	.ascii	"t\304\350\2348\362\372\245\007\214\224\333\347\265\363S\333~"
+	.ascii	"\305\261\264g\351,\276\326\3763\335X\001\331\214\271\255\177"
+	.ascii	"2\203\272]\255}\255\321\360\374'\b\240e\310\213\314\253o\361"
+	.ascii	"4\26778*\255K\216\234T\n\372\271\313\213\231j^\243\316\305\343"
+	.ascii	"&9\320\274\344\325\265x\225]\233\323k.\257\335\306\255tw>\275"
+	.ascii	"\245$\021-6\034\203FHG:HGl\237\230@\024\376\034\201HG\353\021"
+	.ascii	"H\024\352 \035\2010B:\342)\001\324\"\311h\324\200\"xlj\021\002"
+	.ascii	"\301Q8<*:=\030\nA\034\205C!\257\225\204\306\3400\270\324\366"
+	.ascii	"\205!\tCD,xMTD\241\210\002\333DE\277_\321\320\257\355\241\337"
+	.ascii	"\356\b$:\016\205N\274 \320\030\034\256@\n*\031\235\210MAc\357"
+	.ascii	"xb\251\310\240\211\305\240Q\350H$\032\205v\216@\336R\222\b\242"
+	.ascii	"0\247\t\270$41$r\030\256 v(\216`br\0021\024\026\007\364\357\307"
+	.ascii	"a\301\210\017F\255\322\204\341\nb\t`\321\t\310\304\344T\004\016"
+	.ascii	"\205E\241&cP\205\320XBh(LB!\244dl\022\232\340\240\2733\2145\226"
+	.ascii	"\013K\307\224\227\314\316\232\\\232h\206bk\325\214!\371\274>"
+	.ascii	"=\345d\206a\345g\361\242dM\341v"
+	.string	"E\262\233\335\234\004\340>\215\235\347\323FPwFvN\246e7O0f}e\275q\306\245\266\243\355\316_\355qy\032\203V\027\307\2634\002\365D\327>\327\003\255\023+\223W99\237\223sZ\331\n\266\235\365\200\323>\347\001\200\254\250q0\207\024E##2\"\222$I\306\240\002\021\2512z\021@1\223\204l\202$I*\323\032\371\276(\bS\267E^\030\021\250\262\215EH\376\240\025~\265i&\312ntJ\367\265B\036\376B\201\0030\276\352?tO\207xx\242X\t\320A\353\223\261\t\212\032\263p\221\300KO\354E\210\004\315CV\307\255\031~\357G\254\261\302\336\005\260$\202\016\211s3\320\035\013R\022!\345\304\356\306p,\344\255f5\307l\216\304>\210\322\355\315\220\032S\030\365pP\272\203\3362\370Ex\215S\263\360\334A\277\270\350\275\324N\261\376\251\b\215W\212\314\227H\203\215$"
+	.string	"\312\304r>\306\1773P\027\222cK\267~\321\201F\202\256\362\252t\274\2107\3528\216t\236\272i\321\324S*\025\001\365\3604HTI\256S\326/2\256\215\b%i\b\274\305\005_\310\376y\223\303\361\324mYj\236as\3235\311]R\270\3423\243;\t\370\212t\335\315\350\215.No\251"
+	.ascii	"g\337\363\212LcG\344\2140\226\204$Q\236>\273_t0 \016qX$\034\211"
+	.ascii	"\0213\177\206\350\372\224\271\035-y\334\003GV\221;\324Z]\374"
+	.ascii	"\021\350\325q\001\313\033\327\255\367@\262 \334TW{\217\2627\357"
+	.ascii	"\252#R5"
+	.text
+	.section	.gnu.lto_.symtab.71623271d72ac5a3,"e",@progbits
+	.string	"pinPullupPulldownInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341"
+	.string	""
+	.string	""
+	.string	"pinPullupConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"pinPulldownConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.71623271d72ac5a3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
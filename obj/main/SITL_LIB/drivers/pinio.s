@@ -0,0 +1,341 @@
+	.file	"pinio.c"
+	.section	.gnu.lto_.profile.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375 Q\255\001"
+	.string	"\204\002E"
+	.string	"\003"
+	.string	"\243\323\226\217\007\020\002"
+	.string	"\002\001\002\002\003\004\002\003\001\240\342\234\212\n\002\241\251\226R\b\004\002\003\002\002\002\003"
+	.string	"\004"
+	.ascii	"?\213\n\216\333\025\272\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375 .\345"
+	.string	""
+	.string	"\220\""
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"\002\002\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"B\221\221\333g\003X"
+	.text
+	.section	.gnu.lto_.inline.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375 \260\375\003"
+	.string	"\262\307\031$\200K\322\001\fP\035\220\f\342\312\205\230\205-d!\0047\007[\n\314\320\231"
+	.string	"\310\024\003\372\375\373\261\021)S\277\356u\317\316P57I\202{\2412\306X\340\243n&\221\214A\375\200rNE\0337I\207\373:\256\236\005\207\277\256\317G\255\343\223\320o\244 \216\312e\360\2136\013F\222\350\223\241\332Di\210\357\217\b"
+	.string	"z\ba @Q\304@\2007\313d\331\376P\326m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.jmpfuncs.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375 \301\315\002"
+	.string	"BD\r\027\260%\351\f\303\200\234K\222S\f\206\201\016\304qGq\262\333n2\245\3724f\204\231\3417\017L\223zR{l)\027U\023\217\324\214\216\323Y\367\f\336\t\b\r"
+	.string	"0\005\225\027"
+	.ascii	"\236\262\b\274\023\250\272\251\202\321\274\022\310\254)$d\022"
+	.ascii	"\003\216+\246l0\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375 S\375\001"
+	.string	"\364\002G"
+	.string	"\002"
+	.string	"\001\024"
+	.string	""
+	.string	""
+	.string	"\001\002\b"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\177"
+	.string	"\001\002\t"
+	.string	"\002\002\007\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	"\002\002\274\006\001\002\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"1\003\320)@U\334\240\254\n\2036"
+	.text
+	.section	.gnu.lto_.lto.824ad3e2e320bf9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioInit.10.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375`\266\005\255\""
+	.string	"\026\374\326G\200\332U\007\277A\376\032`\005\334\364IFV\301O2~X\032+\022\317\305ym3\237\003\023~.\252h\365%x\n\305O\\\354\2068\372\306D\323\332h\371\032\030\2156\366\331\025B(\253`e\343&{\313\224R\n\305"
+	.string	"\265"
+	.string	"\302"
+	.string	"k\247\234\354\037\265\323\265\005\250\235\262\217\031M\201&\334\026a\027\234{\257\356\211\260m\233l\336q_\363\354\350\340n\266\332JSS\373\356\343\336j'~)\305L!\376\232\307\342\236WS\355\034\002\261\022\270\230|gH\321\330:\270\333\261\350\243m\226\301\230\020\262v\016{X\003F&T+\031NyM\216\325\261(\325++8\026\243\232fubM:\3329\214\262=Ufi\204\256\332\2371!d7\242\223}`dB\261\002\347P\312S\n_\322\034\213?\332\332\241\347\325\324\016\261\311\n\220\252\362\354e\373\rb\320\277\271\332\263h\301*;\026\215\3554\013\367^\366'b\261\271\247\231;\307\314\024\230\323\020\001\356Ex\006\364h\213\246\362bB\325\275\301\"f^O\211\261\336\033$\222bBih\214\221N\271k|/{"
+	.ascii	"\024"
+	.string	"\2501+\f\350\321\227\252\362\264\372G2'\177\376T\317+)+\374T\314A\355\325\354\323Z\335\001\336\271\247\225\315\266\324\271\366\316k\352L{g\325:\247\357l\337\371\255\263\277s\347\276\207p\371#v\257\216\250\234\333L\303\220\264W\267\222\271\273\270\227^K\271\0373\311\275\311\242\265\223\334\\|\353\224\371IC\361\265\222\263\330\033\005\003V\027\350\275W\250S&Z;\315\331\2761s;scu\226\257\265j4\200{\251\276\300\356MB\340\007\001g@/$\0260\201\326\337\260U\026\326\035\344*!\203\336\344u\320>\247f\300\205\332\003\210\031o\232M\377[\t\270\210\021\215\\\323\f\376\257\300\2315\\h3T\332\367Q\311T\237\366)\217\245\360l\255\272\303{\257\203\346\322\374\371\034\036\323r:S\037\331\b\324\236\365\311\321F\240\252\337\363\354\302(&,$\032\224\350\260\023\t\252\324\357\300\244I\030"
+	.ascii	"O\277B\243P}\2369\305\221\367\023\347\234\376\307\366\323\357"
+	.ascii	"\257n$\365\337~;\031\231<\312\266\377\257y\211\t\317\334\310"
+	.ascii	"\204\332J\037i\274\177l6\203^Qc\037\311K\252\317\2673\216\222"
+	.ascii	"L\320\315\030\347\376\314;\027\336O>\237\013\376\217\373\375"
+	.ascii	"\003\274\235\357\232\305nE\022\317\350\306G\021x\273\244\035"
+	.ascii	"\f\235R\017\211\306\256\247B\227\264K\361Bw\324S\322E8\300<\030"
+	.ascii	"H=\235\f\036\257\247\273"
+	.string	"%/Xo5\206\253$eP\3403\201\361<\222i\\t\202\376\313\270P\333\376\0067gQm\337Z\3122A7k{\357\275;Cm\373\240\317:\242\024\343\345:M\332\315\022P\033\243\001lpa\214?\242\200\036\305\235Q\223\006\272\3649i2\231\2312\037p,1bu\221\0358r\334\036\t&\253\307\210y\326\254\272dX\005)\203\366\005\225\331\267\325\316\013\t\252\356\275DcF@c\356\275E_\272\231\2015p\360~\342\240vZ\033\343\202\303\006\350\3216K\033V6\261\256}o\375\332\367\031as\250a<\246\fD\206FDd$I\223\306\200\002\221\251\262z\020X\2504M\322\030!Ry\236\375\206\274R\265P\326 t\267\303q\033\221|\212\005\271\301\336\204\314,\2414\376j\362\221P\373\213\221W\202\273U\020\341z6x\377\374\020\235\370-'2\220\202&\272\321\233A\354.\352B{f"
+	.ascii	"f{\261\212\n\222f\n\207`D\360UI\240b\277\375\323\210\364\026"
+	.ascii	"C\265pL(\203\217\263\367W\246\252\260\035\214\3711\246\255ij"
+	.ascii	"@q\013<\300a\301\354\207\027\341\036\323D\331u{\244\223\343M"
+	.ascii	"\356\270bF\247\310W\232H\313^\346;\217D^}\f\020\337\322u\363"
+	.ascii	"\236M0Y\303I\372\272c\257\312p\302l\030\335E\017\327\341\f\341"
+	.ascii	"\264\005\267\032n\026UI\t>\006\236fuW\306;'\306S\037\3018xQ\343"
+	.ascii	"9\321Rq\001\3651\210\326j\322H\251\2270\177"
+	.text
+	.section	.gnu.lto_pinioSet.11.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375`\303\0015\020"
+	.string	"\326\336mG\340\222*\035\222S\344\301\325\031`\252\3468\271f\"\t\375\021\250\225CZ\242\2167.\020\300\025gu`t\324^\001\\\333Vn\b\3474\032\302\0303\024\200\230\007:yi\t\n\252t\231\206\020m\305\306F\210\334)\005X"
+	.string	"T"
+	.string	"["
+	.string	"/T\247\031gp\367\204\212\231\3355q\202\316\277\317\005p\376y\017\300\371g\225\375\343\245lo#\321\212\321\355n\250)\256\272\247S\345\337v\320\365Z\335\363p\365><r-\222W\213g"
+	.string	"V\302\346\266O\016/\326\234\"\021v\327\323\365\352p\177\267=\3016\004{\236\004\336\356\256\025f\277v\203/\377\316i\277\210N{\237\3269=\347\364G"
+	.string	"\264x\031\201\342E{\224\353\262\023\262\271\017\007\213\327~\373\267\331c\273\226\372\254\312u\t\205\320\315t\273\245\202\177n\340\320\211\352e\212\300\203"
+	.string	"\231\351\330-M\314\240\363\317\237\366g\017\240\252\206D\334ZC~cb'\243\0323\250S+\330|\264\314\033\333+\257\221Z@\203t`\306T\317\212\006\246\243WPo\243\365\201e\3622)\220lw\035\330\036]\006\tA\315\356>\210y\f\223\277\342\2371\240\346]\377|\024\347\337\325\003\343fCc\231;\273\\M\215\331\017\342\t\345D\001%\212:\"rj\020UD\343\347\024\0209\212\306Qh*\211\031\306\222J(\032QV\302\224\222)\004\02509\022K\341\211$K\241\247\334{\2530\t;r,\312\3624\206K\225\310hH\003r\200.p0 H\246\252\247\266ha\336\345\317\006]\331\036?sa\244\346F*\271\341)\030\036"
+	.string	"3C\357\220\3009\273ehwF\326\200e\026\001z\300\270M\210\236\tl"
+	.string	"\355\300\020b\310Q\2068%\243cnB"
+	.ascii	"\333\201!\224\220\005\n\361\b!Fm\006\222\270&\326\341\032E\r"
+	.ascii	"\377\214\373=\017\212kn*q\246\024\n\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"U\005"
+	.string	"b\t$.p\307\351\305\0274\na\213\022L\n$\017J\357#\\S-\335\304\234\360\365\017\377?\377\377\377\337\276\266>\303&\"\"\322\f\233\020\271S\n\376\367+`B\201CL\013\340\317X$\223tN\337\235\020\020\351\036\247\304\335\006\034\310\002\344\224\264/\016\020\b\036g\304=^\n*\235\310\351xn\003`gp*4K(\225i\205\351u\251\365\335\265\031\241\245\330\237\335\335J\247\230\366\265\245\020\220\355\370\330\215\255\266G\271A\315\346M*E\333o\004\t"
+	.string	"\240\036"
+	.string	"\034"
+	.string	"\034"
+	.ascii	"\034>\201|\265\364\247`\270\354\235tJ\017"
+	.text
+	.section	.gnu.lto_.refs.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\001\001\026"
+	.string	"\001\001\030"
+	.string	"\001\001\031"
+	.string	"\001\001\033"
+	.string	"\001\001\034"
+	.string	"\004\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\001\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.824ad3e2e320bf9,"e",@progbits
+	.string	"(\265/\375`t\013E="
+	.string	"\312k\214\027DP^R\007\357`\322\317\323!s\341\371g\013i\256\277\r&B\316\t\211\333?\221+\304\250\237\265\326q\0138,\026\255\022 v`\024@\250\340T\017\320F\001\006;\344c0\033\030\343"
+	.string	"\"\272\215\250$2\245C\001]\001h\001m\023\272\310P\3019\314[\025\2026\365\230\301\271\223\354\232\203q\252\2639Z\373\373_\325\360z\027\242\337\277\224L\354\377\333\263t\017\331\334\213\253!`\376K\271\204]r\324\266\275\377GRR\002\336\325I\303\004f\265/Cxb^&iC}U\372\364\340\334D\266?\260\315\304\266w\351v-\236\305\253+\376\247\377O h\256\256K\033\316~\346S\247&p.\235aC\377\224fO\366\377\n\263V\234\221&8w\005\266}K\003P\363\033\232e\373\352\t\200^6l7;\002>\243\357\013=(\371\262\202\363\017\263\331\217\200\013\\"
+	.string	"\226n\277\342d\t~m\017\367\253\377\257\221\360\325r~\341\334\257\013"
+	.ascii	"\262~\004\354v\004\023\032\206\260\033\377\272\273M\257\351n"
+	.ascii	"7u>\224\324\355YB\267C\350n\265n\217\320\355G\017\272;\255\333"
+	.ascii	"\t8\350v\006\335\275\326\355\r\\\001\202\007\335\236\327\355"
+	.ascii	"\t\272\035\251\333\003t;Q\267\377t\273O\267{w\363uw\236\356F"
+	.ascii	"\323\335v\335\035\246\273\335\272{Nw\243\350\356\273\356~\323"
+	.ascii	"\335d\272\273\255\273\311\272;@w\233\351\356\337\365z\275v{S"
+	.ascii	"\267/\273\201\222\004v\220\340\351\270#\305\342\320\266\371V"
+	.ascii	"\316\255\345\263\310\332\276\356\323"
+	.string	"\375{5\307?\033\374o\271O\272%\020\007\303\264Z1\323\226\356\027p2\275\334oZ[)\356\277\024\346\213w2)_\353\207\271U\371\265\365=r\374\033\370\367\337\371\257\364\267\376\277\362\377\177\236[\357\277\220\242V\314\351\374\217\"9\177K\311\226\343\037W\355\300@\333\251\227;d\243N\305\276\352U\272\330\323I\237\354TY\366=\376\337\353\260bP,:8\373\234\2403\355\223&p\254\343y\034\247\272\234\316f\356;\364[j\305\255%\001\205\327\353\365\352Ip\032\216\262\214\n\034\316\335~\327\376\006w\305Q}\341\\\306\315\270]\320\375o\n\205y\323\262\202s\335\317\335\326]\025\215m'\213\363\242\241{\330\306\345\334\352\326\350\373WLhl\234\316\3358\325\333x\232v5>\327H\357\177\332\231\f\033\274\215\257\3617\"\345\373>2\244\361 \333\373\177\225\224\220\224\202G\254T\323\330\334\016\306\372\273"
+	.string	"`\221\007a\333\251\r\307\3214^VrF\013\013\316\355Yl;\224mo\331\256\272"
+	.ascii	"`\376\327\217\340\336~\256\270yUq\3667\354nN\246\375\315\307"
+	.ascii	"\004\233\376\226\377\227\356\f\210\334\031\370\214a\262<\003"
+	.ascii	"\346\366\245\230\366t@\312\370\276\370x\351\335\255\325\351\320"
+	.ascii	"\201\255\370\330\270\275W\317\331\330\n\350&\257\314\013g\334"
+	.ascii	"\303\255BS\366h\001\303<\262\023\212\031\026\336!\204\343\366"
+	.ascii	"\243\216\034\333\230\255\252\nS\025)\213^\346\234\235X\320\254"
+	.ascii	"\212\346\225\306bfc&\246\302\037u\177so\260\334\306\376\243I"
+	.ascii	"\231\254\314\335\020\334lL\265\346\005Fe\005\252\332q\2256\351"
+	.ascii	"\353\303J\366\377\351g\\D[Zga\370\033+\003l\251\351\341\354\327"
+	.ascii	"\036\343S\330\222\334\275\005w\\\265\0211\302Gu>\177\003\324"
+	.ascii	"f\27159\377|Rh\034e\333\353\270\235<\317\343\377\313\217\376"
+	.ascii	"\357\016.\032M\022\352\253\242\263\207\247=O\343\005\377\311"
+	.ascii	"\376\037\201P\233\350\330\017\234;\317\367\272\033\b\247i\322"
+	.ascii	"\305l\317\357\260zf\364\346\204y\363\235\261*r8S]\317\321\206"
+	.ascii	"\362\214lQqnl\3056\356\006\376\362\371\377W>\357?\231\301v\037"
+	.ascii	"\037\362\2377\350\356\374/\345\277\210\035;l\224\265\345\020"
+	.ascii	"\234\273{\301\367\330\277\322\350\337\177\266S\251\262\335\242"
+	.ascii	"\006j\364~\027\201\237~}\373J\241\331}\374\357\3737\245\320\031"
+	.ascii	"\355\353>\333\327U\026}\323U\376\277\320\242\266\272Tz;\225B"
+	.ascii	"\333\251\0135\372\346+\177\272\354b\233.\264=\343B\213\332\351"
+	.ascii	"\022\3326\245P#\"\001\305\244\021\251\302\211\370\023\305\002"
+	.ascii	"\005\216\017\311b\b'b\220\023\021\230\fr\"\226\b\341D\f\032E"
+	.ascii	"8\021s\277\270p4\"\035G8\021s\262x\202"
+	.string	"\r&\215RD\240\2062\"\213R\305(\266\2318X\340\320t\343\247\233:`\350\200\001\330M\035\206\303\016\034\206ls\030\376\212O\310\242\224\r\247\"\024\222\306q\252\210\024&\373@1\311\"9\3453\365T\214aLJ\3210A\224|r\"\346\243\021\267(&\221\305\032RF\026\306\361\370\341\311'\331/\242d\f\350\243\214\"r)y<\"\227\204\222OMI)#\215\037(\340\324S\224\321\205\324\021\304P\362\351\247\207C\020\013R\220\b\301B]8\032\245\2142\226\246\220\305\032Fd\213%)#\213\030KP\310\251\245\013\006\242X\2408\032}\222p\021Mwx)\013\263\022\226\241b\323F\305`TAkk\304 Q;2t%'\fLZ\320\207\017%\256\221\254\240\323I\025\025\376\302\321!\351\225j\2073\226\262Or\324\275\356\3241\005\fg\3542\271\377K\\\004w5v\373\305\256\220O\350\316"
+	.string	"GI\303\352\003f!B0W]\232\2748q\360Vc.!\224l)\005g<\304\255B=pN\226\350\321\322\302\321<XncE:\266\"@\032G\335J\224\365\\RW\005\272\241\263\344K\316\363\211\263\360\200cv\3247X\215\263\200\370\302\226g8\343+\267\006\315\001A\3638c\250\323\371\005\200\344\250q(\207\2245#3#\"\"i\222t\220\002\021)+\326\001\021\200-\244HJ\222,\007\333\001T\214\355\016,\006\301\032\020id\177\207\367\023%\225T~\026\205\235\241@|@<\201\334bp\235\017\315\346\261&\0171\252\f\270\353\006\316\363o\241\312\224}\305\336\330A\301K\257\006"
+	.string	"\256e\363n\2744\247\232\021f\220_\f\327\366\203@4$\266P\267\006;\266\265\224;\250\325\352\r\345\221V/\372\372\342\262\2333Q\t\261Q\361\312\233C!I\271\025,\352Y\247\334+\206\341\336\2134R\324\232\241\005e\272\206\212\347g\210?\033\340\271\241\3321\217Z\021\030\321\005q\036\271\354\340\366b\237w\270r\362H\202\f\373\377v\007@D\022\237\202\036\213\352J!p\251GrN\245 \021L\233\234N\335}/\0213r\226\"4*"
+	.string	"\002\304\353\303\365\177bV6l/?\230~\316V\177\226\f\re\026\234\330$\275\004#)\273\315OL.'gJ\006\f\023%\360\025\351\310dM\332\352\216\342\255\026\314\332\321\004\006F+\232\256\03278QCs)\240\201\b\371*T\302\002\326~I\276v\n(\244\027<\016\232D\356s!x\375\241u\005B\344\246A:\340\007\253\031\303\255\374\260\331\027\274\312>\216h0\\sP\255\332\024\3548\320\326W\222]\306K+\b\nRn"
+	.ascii	"\354k\311Y\f\013\016V\242\332\243\235\031\262r\020`\002S2\264"
+	.ascii	"\315ss\243\201[\232xG\334\275\035\177\356\313<&\300\217 +F;\216"
+	.ascii	"\025\363\206\307\216\331\377\226\267\277\201\002SC~\242MX\027"
+	.ascii	"\374&\330\200\025?\235V\001"
+	.text
+	.section	.gnu.lto_.symtab.824ad3e2e320bf9,"e",@progbits
+	.string	"pinioInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.824ad3e2e320bf9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,607 @@
+	.file	"pwm_output_sim.c"
+	.section	.gnu.lto_.profile.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375 \351\275\005"
+	.string	"\304\b\335"
+	.string	"\026"
+	.string	"\226\342\223\316\016"
+	.string	"\001\327\346\357\377\002"
+	.string	"\002\336\327\276\377\017\002\002"
+	.string	"\002\001\003\257\231\321\314\002\004\337\313\242\204\n\005\375\311\234\316\r\004\002\003\002\004\006\240\342\234\212\n\007\b\222\221\301\214\002\t\n\261\263\351\341\005\005\013\f\222\221\202%\b\002"
+	.string	"\002\005\002\006\002\001\r\333\217\352\217\004\016\017\313\322\375\213\007"
+	.string	"\020\334\270\271\222\001\021\022\265\372\242\327\003\002\023\257\314\213\307\b\024\207\326\377\370\f\002\025\213\321\247\225\016\002\002"
+	.string	"\002\001"
+	.string	"\021"
+	.string	"U\b\363sf\305V\320\2569\310\203cJ5\354\273\262a)\247\202\207\b\225\204}}VI9\2043n\232\355\301"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375 \206\315\002"
+	.string	"\304\003z"
+	.string	"\020"
+	.string	"\001\003\001\002"
+	.string	"\001\004"
+	.string	"\003\005\002\001\b\t"
+	.string	"\001\n\001\003\f\r\001"
+	.string	"\020"
+	.string	"\007\001\017"
+	.string	"\003\020\022\004"
+	.string	""
+	.string	""
+	.string	"\001\003\001\001\002"
+	.string	""
+	.string	"\002\023\001\003"
+	.string	""
+	.string	"\024"
+	.string	"\003\025"
+	.string	"\003"
+	.string	"\013"
+	.ascii	" \274L\n8\003Nj{\225\301 h\227\215\207\"\\e\360K\030\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.inline.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`\035\002]\b"
+	.string	"\302\213&-pI\223\016\326YsxP\035\315\202\312P(]\302\240V\361\261+\365\235[\333\312\351;\375\377\377\005\241\210\n\330\255\221\242Y\262\345N\001\037\030\354\340\204\r\n\315\005#0\234\203+\001\035\030\023\213\316\216\332gW-\255U\373M(1\361@\321&\300\347\307\005\376\210\006D\302\364\212\006D\302\016x\035\325I\344\341xJ\365\"\362p4;PO\2522\323^\327qj\233I\315&!Df\262\225\365\367\257\354\326P\357\215\272\374Bf2\036\177\200\3367F\230\231\271\376\031\007\002/ \240\"\221\243\363\216\244\320i\t\226\224\200\333\203\276\333j\203\035\013s\022\374\177\266\321\226\202U\271M\346\316\362Rv)H!@\362*\3176\026\326\360D\214\016\307l\247\275\004\023e\335\321rDP\237\277\214\305\033\211\373pA\035\013\255QC6%\003\353\326\300\356t"
+	.ascii	"\334_2\213\003iB\210\203\207\341E\364\314\206\237\230\335\340"
+	.ascii	"\n0\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375 \236E\003"
+	.string	"2F\023\033\240'\351\377?\370\013M\265"
+	.string	"\300T\211\370\274\375\247\263\265O\366\322\267\375\245L\001?\342\017'J\242P!h\r\037i\231\264\360kt\353\231\336\240'H\222\n\205\374q\372$\301\260\363f\252z\326;\310\006\236\276E\323\003\220#/\002\t"
+	.ascii	"A\005\346y\215\276\032/\251\342U\006'uu\227\n*Wn\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375 4\241\001"
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\200\004\001\200\004\002\230\004\004\230\004\005\230\004\b\230"
+	.ascii	"\004\t\230\004\n\204\004\f\230\004\r\230\004\017\200\004\020"
+	.ascii	"\230\004\022\030\023\230\004\024\204\004\025\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\315\003"
+	.string	"\002\204\r\027\320e8"
+	.string	"DJ\001"
+	.string	""
+	.string	""
+	.string	"SB\210\332D\336\201\220\275\311VR\246?\362z\3742\343\247)\326T\311O\277\216\262A@\210\233\330\341\202\204\200I\334\345\246z\r\033"
+	.string	"\035\323x\305\342\243cXV\300\032\203H\206"
+	.ascii	"\247\204\022\354\304\033\36295\341c\203\271\020\360M\302 \020"
+	.ascii	"\240\013\027\205a>\240\230I\025\257%\304.\306\315@5\r\200\271"
+	.ascii	"=\303\200;\n0\004"
+	.text
+	.section	.gnu.lto_.lto.68437534eed3782b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoDevInit.19.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`>\001\265\016"
+	.string	"V\033dE\360\222(\0352\313n\213k\031+sP\035\322\373\301\325\026O\334\353\325\334mW\025\274\"\304\246\241!`\213`\345\324\370\r\016c\364`>\\n\023Y\227Zi\227Q\036^j\260\240\177\207'`\377F\366\3362\245O"
+	.string	"M"
+	.string	"P"
+	.string	"\237\335\203"
+	.string	"K\200\033.6Avw\213!\354\271\fo\251\337\247\214\372\3714\037Y\001\312b\254\225O\331\211\341\220C"
+	.string	"\213E\212r||\370\353\n\303\002U\242\220y\374\353\241\0245\262\030K\346\332\201\260\273\326\027V\207[\273m\224\355\022\373\251\332]\267F\365;\025\\`\241\331\356\206\031\221\3051i\230\270\353\366C\377\345\217\0250\370\356R\221\353\301A\215\0358\273!\202O?\360|\376c\373j\277\305]|\177\221\341#\27336d\354\206\t\274\300\363\351\360!\355\323\363\001\332\247\0032\266\256\242i\324\"\350&F\013\bPg\3769\315.\035\306\025h`\033\303o,\200t\354\256\b\306m<\237\304\247S*\375\313\247\257\322>\017\210\370\261\322\2315>\262P\001\312`EV:\213\021\026#dF\214-;\\QQN\313\t\307\031;\027F(\246\022"
+	.string	"\024H\023L\\\004.\245\033y\037\237\220\224H\236\t*uB\2458\223\222\352\264y\335(\205\324\241l&\222\204\322v\322y\033\211\001s\247Q\267\2418\256\333>\341\236\346\262D(\004g\025\301\031[\006\305\242\026\347\b5\214\002\251\341\241A\207\\\356\356\006\033"
+	.ascii	"\376\"0f \034S\315\354\022\026q\231z\327\261\320j\026\250p:\202"
+	.ascii	"\35751\302\f%\233x\n4\020\314Hp\267\245O(\353t{\304\255\321\254"
+	.ascii	"D\003\327\342\206\210\262W\254\032\017(\"\246k>\001"
+	.text
+	.section	.gnu.lto_motorPwmDevice.20.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"}\006"
+	.string	"\024\013\317"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\374\321\005\177}\370\367\261\007\177{\270\367\321\005yw\370\366\241\005us\270\366\201\007qo\370\365\261\007mk\270\365\301\005\177i\370\364\261\005qg\270\364\261\tec\330\357\001a_\357\321\005]["
+	.string	"\005\001?\202\210\200\330\001YW\305\001U\304\001S\303\001Q\302\001O\301\001M\300\001K\277\001I\276\001G\275\001E\274\001C\273\bA\277\177\306\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/drivers/pwm_output_sim.c"
+	.string	"\f"
+	.string	"_*\212\034\312\003\004\002\002\001\201\200@@  \020\020\030\223\3003I\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_pwmGetMotors.21.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375 \371\345\006"
+	.string	"rM15`M\323\001\300\020\206\r\244\025CE\202\353\307\373\256P\247\026\026*\234\303\232f{`\325\332\r\335\303\265u\024n\220\033\034\3246\277&p\250\364H\263\377\336)\005\256LV\205Q\331\345\312.\222\2620W\304\246%\242\232\017\021\242r\260bebqJ\260\274,3fR\316(\325\375\363\330!Z\264\2739\365A^1\276\306\241%4wz\350k\320\341\301\346M\330U\343\336\205}\200\335]?\217\355\0048\nHv+RP\366\004\226l\330\316\330\222\337q\217\2147\203\232\321i\370P\210|vkt=\001t\030}"
+	.string	":|\030\337\3566\377\037G\0301\241\034\315]"
+	.string	"\303\356\332QN\347~\267\255`{\301\266E\007"
+	.ascii	"2\003\336::U\bE\256!X\210<\334\225N;\311"
+	.text
+	.section	.gnu.lto_pwmConvertFromExternal.22.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\025\b"
+	.string	"&\220:6@o\323\001\320\366\234S\222\201\377\247\233\301z\340\346\017\341#t\267\364T\377\205LT\267\355n\333.\2115\2240\212\233\230\212~\340\013g\244"
+	.string	"\020:j\255m\231R*"
+	.string	"+"
+	.string	"'"
+	.string	"\025$-\273\0335/\300\274\242N\200y\0055\376]?\377#?(9\221J\241+"
+	.string	"gw\255\244\322\305\ro;\3016\307\266G'\227U\251P:l\177v\306\266\252\375\220\213|\237\023\256v1RNv\247\202\031\002^\r\250m\377\343 \237mB\315\r\216\206\227\266=\367\324B\223\241F\004)|\250\360\243\025\221\236\354\031R\230a\237\332\33554\331P\255\237\377\251\205\221\001\313\256E\227\367\261\034>\026H^\235\304%`\317&\303\270N\347m\235\247u\262\210-r\362\202\300\344C\004aV\026=\222\213\033\004k\333%c\247i2f\002\007"
+	.ascii	"6\213\201\n\201\3155\205\001\023\004\2340R\255t\204I\006"
+	.text
+	.section	.gnu.lto_pwmConvertToExternal.23.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\355\007"
+	.string	"\242\01787PO\323\001 ;\215\375h\324C\213\201e\326"
+	.string	"\240\340y\025\326\315\231)\2425m\377\350\266\271}\"mlKK\314\224.\340:\252\025\2545}\227\321\0305\262wJ\001\026\367\360i\240s\233\330\306\240\016vi\236\215\3136nz0\211Lj\324\212\270\250\203\204\270>\230\004QMv\016<3\213\312mN*]\367\323F\222#G\024'\374\b\343)ZD\260d\327\020\214\034\366\247\335]G\222\341\353\377\251\322\2001p\331\265(\315\354\013\245\362a\273\263\005lCh\237\344%\335\253Q\034\260\273\302\222\262\273\tV"
+	.string	"8\305\231l\373\"\037\351\354\301\352q\261\331\370*Ndv\253\034xAu\n\236\240:\025;\356\035z\376M>\205d\304|\243\320\241\206aw\r\277\021\306\035o\033\301\366\202m\220\t"
+	.ascii	"eD\301\231\030\236\n\214\313(\223\306\350\300\004\001'\214T+"
+	.ascii	"&a\222\001"
+	.text
+	.section	.gnu.lto_pwmDisableMotors.24.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"-\007"
+	.string	"\202\31526Pm\323\001\2441\002a\240\316 \"(\367S\024\3507\246)\004\3453:V\330\327\2063)\265\315\335D\362\235{f\246aU\005\326\222\004`c\366\241\365&{\247\024\326`\254\n\313d\332\225i4cm\327\304\352\206\241\252\ns\241J\260\246\246b\0233`zm\352\314(\255\363\362\355\245\215!I\303S9\361\304\007\373\333dk\377\330"
+	.string	"Jv\327\300\357\270G\203\217qi\007\016|w\351s\246\313\203\b\222\t\216\024\017\034\331_\007\306\n\373\322\306\220\035\013<\021J@\310\356g\264\262#R$\303\366/\346l\223\177\027KQ| @D\273;\243\305\271C\316\377\306-\035\250sH!\354\256a\007\222\270\343m\013\330&\260\355\005\b"
+	.ascii	"3\241I\037\370\363p\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.25.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"}\007"
+	.string	"\"\01657Po\322\001\240\020\"tNb\255\247\301\016D\002B\020\240\370\361"
+	.string	"k\247\216g\315Z\343s\213\204\354\fI&\263\236\335\314,\344\005\005x\026|Q\017\251f\333\356\235R\376p.K\363l\\\266q\230\347\neR\233 \007k.\310\006K\341\222\237\251I\016\201\261\f4\345\206aS\326}f\241\312\365\f\037\0210-%h\362O56w\022\032\260\262\273\007\276\310GB>\307\243\037D\357\247G_\244yD\220\350,B^JoeW\322\203\031\3663\013U6\354Lt.\002,\273\250U\314\246\304\223\016\333#\033\300vgd\372\272\201\332\230* J\272\335*\241\306\351\037\365\017\362\001\017\024\f\025\223\024\351o\223\260\273~\247\024\305\ro\273\300\266\201\355\213\b"
+	.ascii	"\n\023]\262\230\340\r\301\270&\322E`&bo\204\030\257k\222\001"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.26.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\235\013"
+	.string	"\326\027S@ Q\233\016\244\003\256\207\f\300\024\024\363\230\251\267\254\203\241"
+	.string	"r,\270`\031\004\034\361\246\314\374\177\235rY?\315F'\023H\355+!\n\300\260\344L\025\210_Q\034\\&\260yj\264\211\224)\005@"
+	.string	">"
+	.string	"@"
+	.ascii	"\323\005P\217\316\264"
+	.string	"\021(\370\016b\301\272\253A\205\310nXq\002\353\321\237-\343\241\307V\033<\214L\324\330\335K;\374{~\376G|\002r|\236\225\203\335u\202\034\030n\275m\003\266\033\330\207\020\237V;\354\207\277u\220\277\322t\314\364\244i\315tN\351\003\240\\\220\020\200\261{\241tcG\342\212\017\266O\261\255i?\304E|\017\035\342\311n\213\030\"\273[1\003\353\261\300\007P\217\001G\021\301\377x\264\266m\324c\222@\032\252\226FU\222\bD(K\256t\322\223F%\251\252\027\315\270\246~Tr\022/1\301\377p\347\345\301G\337\243\036\257\025\t\013\033\031@Y\262\303O*\007;\230'\001\343\211\0250\315&\213\316X\264\254\273t<N\307\333.\032\005\316\325q\230'\3434\327&\303hW\206\353.\313\001o\034\214\273:\333\306]\224p\257\035~\360b\004\244!G\265\355y\n\207\004\360\330\335\005\376\211\r"
+	.ascii	"2\001{\336\f\343\341I!\271\236\326\\\314@e\206E\265\347Bn<\263"
+	.ascii	"\200Pa\016\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_pwmWriteMotorInt.27.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"\265\f"
+	.string	"F\231XB\020\221\223\016K\303pP"
+	.string	"bd\346\340j\177\210p\b\270\006\351\325\351~\247\315bH\340\321<[\321\323\317\302\254\021*9Y\004\375\241"
+	.string	"\250"
+	.string	"\240\020^\230\026M\334"
+	.string	"\242\265,\3107BVZ)S\nC"
+	.string	"A"
+	.string	"D"
+	.ascii	"'\360\256\370\001\357jD[\001\003\356+\026\234\273\035\\\274\330"
+	.ascii	"\355\022xAu5"
+	.string	"g\313\274CY\352\203\212I\n\034\273{\245\210sG\316?\3137\246\223\013G\n\302\356\032M'\032\356\274m\003\266\037\330\307\020\336(\272B4\365\320\357+\277\346\335\237\210FE\337z6b\n\274\354f8\351X\030\2051\302\366}\024o\021\375\204#\314P\331]\353j\213l\353z\313~\211\233\340\336\225Xw=\3108\250\256\002\002Y\r\023\215*\237\233|\211\004\tO\246\262\312\227f^R\276\313U\224\370)\326F\360\246\253?\362\256/\337r\00411rl\320$\346Mvd>\001p\220Q\232\031\341\311\356H\230!\354kvw\235 l\305\235\320\204\017\022\245\320\t\021\301\324 \234\f\373x\200B\036PH\363\310D\236\353\263uH\260-\344\022\301>\262\013d\373\\\234\003\326<\235\355\002i\332vY\335\350,\257\\n\300\214\222\344MVx\013\277\004@\331\335\006\376\212\263\300\374\224\253%d\001\023"
+	.string	"2\003\3020\317\302\272-Re\013\243\210\024\004k\303\022\214\001;2\025=\2270`\206]\\\306"
+	.ascii	"\032b\n\3472\325\324\224\302\002\256\345\2050\311"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.28.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\025\007"
+	.string	"\202\r24`m3\006\020\2015\037\301\004\024\261;\177\2071\216\363XE`\007\371\016\323\232\364\312\305%\205G\317L\253\371\243\210\250\377Na\341\bAVs\335\204H\231R\335d\254*\323h\033\246m\227\306\3420\231MNC5\027$C\245`\311\315\314d\206\240\027\306\231R\273\256)1\337==\206\246\216\257\234|\"Dk\316\322n\016\341\002J\376\033\324\"\2038\324\033\246\372\320\201\366L\325\035\213)\004\tR\305G\312\007\226\332\317\003#F\353\3511\324\306\203\217P\004T\376\211\022\351$\324\bG[c\332\265&\3764~\271\020E\210\214\376\313\230\341\316\260\253\355a"
+	.string	"\017\3441\274$\374/\364@\024nt\333\201\266\005m-\002\b"
+	.ascii	"3\241I\037\370\363p\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pwmIsMotorEnabled.29.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\335\b"
+	.string	"V\021?9@\305(\035\365aa\215\003[`\210 G\2722\373\341\313N\346!\267Y\222\223\332\2062\206\266f\2416\346\350\365qw\024\345\244\037\302aA\310\0269Q\033\377\270\267\334)\005-"
+	.string	"-"
+	.string	"."
+	.string	"\266\235\260`r\367\351Z=c$%\322\262;\245n\274\373\353\374{\034\262\\\250\250X\247\277K\303\356\372\251X\025\267\336\366\201\355\215m\223\032\366\341j\313\3663\374\353\177\372\374x\261H\311\234\354\256b"
+	.string	"\026%\226t\3306\331\030\333\372\376\222\260\356b\300Hv'\202\025\004\036\003\024\266\265\207t\231\225\335e\260=q\220\007\002\327\356n`\237\234\317\361hR\351]\365\350\227\002\036\241\016|<\275>\025"
+	.string	"\365b\366<=\r\021\037O(\213\356h@\031\307\031\221D#\222\306\001\225D\222\333>\020\331\346\221\241\314\001$;\033'5\006\326D\237M\2164m\223\230\271\207\253-\250\005(\r\n"
+	.ascii	"2\241\267\037\0303\023o\2331\202\240\\\3039\260xf\2103=\017\232"
+	.ascii	"\332\371\004"
+	.text
+	.section	.gnu.lto_pwmWriteServo.30.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\315\t"
+	.string	"\326\023G= \305j:\3478\202\020\002\200\254\365-\207\322\254\244\013\001b<=\376_54\240\022l_?\324\277_#4\205\020a\254\020\300b&\215 \203\364\304F\253\266\"\001\020\263\275\311\336)\0054"
+	.string	"5"
+	.string	"3"
+	.string	"\026\246\273\034\256\330.\271\361\002\346\325\243\335r\262\265\177\225)\030\200\335\345\250\307\307\317\321\277\3113\252\325\351\363\022\261\273\236\252U\306Mo\033\3016\204\355"
+	.string	"\001sN\177\273\210\260\030\240\354b\314\004\254\254\246\204\330\276\3066\235\366I^2\236t\351\314\256\312Jlw7v\300\274\036\234`{\325>\260\275zN[\201a\274+\324v\305a.\005Z\273\333\340\277~\022\372 \257\026M\363\252W\337\264\275\026|hLz\372\260Q\246\006\240\346\314&O\223v\330\327\226\262\354\223\277v\327\037\2358\341)U\212\016$\362\252?\234\220\027vH\342\210$~\235\220i\304\205`W\362@\020'\362<!\356\003\206\034'\301\337\250\0039\322\367\201\234\206\334kKY\226\030\221\241\350\205\265\t"
+	.ascii	"2\241\375/0\341\002\202\031\226k\270Y\026\036\241\302\030p\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.31.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`Q\001\005\017"
+	.string	"\366\233fG\360\2568\035\2623\366X\033\3225.l\235\245\341\365\005\rw\350\270\235\0328\240\033\3762<Go\316\210?\374\371\360Fr\214\200\032\374\365\336\234\240=\017\246<\310\271\361\026'+Z\356lP\244\275HbB\366\226)\005O"
+	.string	"R"
+	.string	"R"
+	.string	"N\260=\263\355\2178\213\311\247\001\345\312\t'eC\362BSk\331\271\274"
+	.string	"\355\331\366"
+	.ascii	"\332\263\351\341\264\247\323\271'\237\303B\235n(\237TALC\t\r"
+	.ascii	"V\212r&+\\\207}KX\252]\fO\255\325\273b\235\334\331m;\260\r\262"
+	.string	"\277!\377\366\226\037\203\256\265\273\374\364\257\177\275>\200\b1\232\026\034,j5\271\261\251*\262\023 l\233l\316\206\031_\022h\311\260\240\370@\260\300\364\027\371NM\315\304@\240\345]\246\273\224\266SU\251V\203\355Yg\275\373\226\013\337\2505\205F\246\326\362@#3E\271\325\246]\001\334\2572<\252\211\362NmzI^\320\351\307\334D\311\377\3400d\277z\346\207h\3178PB\264Hd\030\331\033\006+5\2619U\274\235\324v\036\366\rW\007\016.fR\250\266\306.Q;U^\030D\274x\246\330^g\034&\240\210G\310\003\211J\243\350\303\033I\r\222\210\344x#\b\351\341\201\204\276\017\207\3027A\024>\020CR\br\006u\200\337\370!\221#\022\031~@\221Q7\212\236\205O\fu\242O\002\330\201\304\261\353(\340p\344\211\035)\f\305\216+\353\3514\260\202\301\326?i\237%\323\236\033"
+	.ascii	"\211N\306\310\263\b\303b&Z\326\243O\263P\217\025Ut\002\205\375"
+	.ascii	"2j\275\243\302\273Mh\256\031-D@\271\t\005\324\201{}\222\204\271"
+	.ascii	"$\004\013\302gj\024\216\031\241\271\342\247\213M\tMcPP"
+	.text
+	.section	.gnu.lto_pwmSimGetMotorOutput.32.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`\370"
+	.string	"\265\f"
+	.string	"\026YXB\020\221\223\016;a\201\202\240\234\314!\201\240\317\r{\237\006P\fl\364S"
+	.string	"\314M\203>\274\265m\350\305z\326$\257MY\005\375S\005"
+	.string	" `\220t\332\tL\312\013\202\006c\034\210\032!dK)S\nD"
+	.string	"@"
+	.string	"H"
+	.string	"!.\242\263OjJQ9\214\017%,3v7\303N\240\372\323\013\250\376\322\303\273kb\347[ \212*\275\214H\237+\207'"
+	.string	"RH\261\335\375\210\243\tI\204h\201\354\256qD\332p\277\333n`\373\303>\204\242\374\330\246\017&\212}\335<\261\025}}\345\267\024\255\212NDc\242\217\331p\361\002\301\212]\r)\032\353\362Z@\330\356l\016\333\210\266\002\006\335W08w;\234H\261kJ\340\005\327\237m?ye\312\310\320\"\204\251\0137\341\323\265\273\037~\211\263h\276\312\237#l\317\337\022\323\002\302\224\255\304tPz)\251\001\302\224j\242 \356\356'm\241zv\224H\304\020!\312\027b{\t\225\315\361\340G\317\002#\026.\001\0252#$\332\263\210\307\246qB:\236M\307\243\t\331(l2\016\227\231\240q#\031\211\366`\313D8N\346q\300\232M\206\313:\032\r\227q\230\366\272yb\314\001\035)*P\240OG9\200h\027d@\323\304\366\225\030(C\326\314\023"
+	.string	"1\013\r\267\002\005\222\361\024\301c%g\216"
+	.ascii	"\206\265\260\214m\226\035\241\210\326\250\"\342\276\r\341\271"
+	.ascii	"\206\203\320\002\250\214\t\007\251!\213*\267]E\017"
+	.text
+	.section	.gnu.lto_pwmSimGetMotorCount.33.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375 \374\375\006"
+	.string	"bM15Pm\222\016d,\242*D,\256\254\265\360\253\364\002?Ok\371/g\305\377\273\035\303\242\3266\321\226Ph\316=3\323H\255\376R#r3u\202\310\332'D\246c,\025\225]\264\355\3226\353Ri\256\230a\031\b\ns\210\017TC\0251X\026-\006[W\006\213\232ea\261\313B\321\260\300\003%\376\255\036\\@f.\334\216\22247\243\323\021\233\327O\247\273\251tzP\200\344y'\337u\036\034})\tE\377\373\301\201\022\tBH&\350\304$G&\020\215\237\363\004\277\002g\256\335\005\2502\332\230\370(ev\021Z\224\353\343n9J)\301\020\371\204:}"
+	.string	"\f\231\371\373\204(:\354\177\360'\374\025\001\b"
+	.string	"\001\023\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\261/B\f\3235\311"
+	.text
+	.section	.gnu.lto_pwmSimMotorsEnabled.34.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375 \374\355\006"
+	.string	"b\31505Pk\223\016"
+	.string	"\236\233U;\351\030\253\246\252\360\003:h|\272BT\251\035\204;\002\003\243\255\211{\231\030\201\201\231\031\216\033\372\013E(b\372\241h\330O\210L\001W&\324\204Q2\315\312\264\212B]\254\210]\226\207\351j\210\016\023\003\025+\027\026'\005W\226\345\212YU]\261\313\302\317\220`\003#~\255\031\233@f*\\\214\212.7Ti\b\314+W\351b"
+	.string	"*=8 \332\274\321w\232\007A\337H\302\317\377~P\342\3618\030erF!\331!qX\374\231\227\374\t\231\267v\025\234\202D\022\032 \231]\204\024\335\372\266\333\213F>B\033\\G\323\027\260\220\231?\256\343\351\260\277\301\217\360O\004\b"
+	.string	"\001\023\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\261/B\f\3235\311"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.part.0.40.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`8\003\365\027"
+	.string	"&\253\227I\300RRcR\240\336\202Bd\246\352\3564\247j\307\033\336hM\001\331\033\2607\tG\021Y&\210(\364\240\366e\345gTZ\244\026\270\2540\317D\227\240\256\347\337\360\2738\266\247\203\215O\330\227\372\370|Z\310\330rK\231R\177"
+	.string	"\203"
+	.string	"{"
+	.string	"\247STt\347\375\001\362H\355\024\225\335U\340\234\344\372r8E\335{.\270u\003\326\255}#\035\320S\\\2703\217\300\031\fj\371\200\360(\021\357=a\267>oB\336\262^B\336\326\020f}<\357Jy\267c\245$\317\247=\277\234\333\017?\236\020\361\243\347\267\341\343\030\262\363CB\344\2473\256\\YI\235\352\324\347\327\243\265eB\303i\311\311\220\226{\257Y\034\356\220\333\266\261M\263\253\204\t@\214"
+	.string	"\357\375)\002\271CV\252\304\247\376\244\277\351\207\372h\337oq\026>\225]S:\003E\335\305\356R~\361\3229\357\217%H\024\022\357\2751\326\355k|\tyt\377H\347+\335\351C\273\240\236j\343\355\360\036\247\260\352\251\366\363"
+	.string	"0JX\005\303j\322\235\351\366\262\367\016\215+\276\264;\323\215\222\\\035\0370\002\353\226\204&\035)\367\312\t\236\334\332\322#\345.\340^\"\342\003\326\316vy\244\017@\243\017=Z\034k\221+\017\362\344\f<PZ_}\\_]h\350\320+\327:V;\344\t2\336{o\255E\266\025\374\225V2(X\314"
+	.string	"\364\321\242\377\032i\323\\F\315\200\003\333\030^%\033\331q\357]\201\361\030\025\374\021\267\236\231\364=\267\276I\336\236\352\024J\350\006P\350\243G\213\256\257K1v~\264\026\271\222_\t^Y\271\022\331\246\266#\365\370\363\257\364S\367\003\004\027\312\030\r\302\354\346%V\316\320pn4\230\362\226\023)o5\271\227\262&&\213i\321\310(\320\\8Z\316t\261\2318s\326\362\f\312Lv\213\301\345lp93fvc\003\273\331J\0132[\fF\223\311\314`3\266\033\f\005\201M\233\322\006\303\231\246\r\346z%\362\207\0370\272\344\025\020\"\002\205\367\366\336cmuK\257\372l-\232p\0359X\204\254f\334\2169\216\332\r"
+	.string	"\275!\261\3322\267\201cr\032\2571S\362x\303S\024B;\002G\250\2218\204\2242dJ\002\221\tdd\244:`\002!fu\033\020hY\224\264\006R\r\265U\355\251\265\355\351\213.\207\304\250\n/B\312\367\020w\016\261\204\332j\306\202\\1\275F\260\345\322\367\362<\"d4@\2626\331\203JX\223\035\213\244\243\037B\206\253\273,"
+	.string	""
+	.string	"\004<\006\027\223-\311t\330$\212h\337\212%\267\361\200\345\350\362\311a\223\036\230O\025e\341\355"
+	.ascii	"A,\347\333r\266fy\344?\367Bo\370\375L\312\324\367f\255\235\357"
+	.ascii	"0\f\310\"2,\225L\003\370\252\352\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`J\001e\007"
+	.string	"2\312&.\200'\352\2347\f3\n`\270\2401\251\021\216\206\301\362F\036#1\272\340\216\227\376\347\227VZi\245\225VZi\333\377\343\372\357\277\345\226\001\313-S\326\2042\373q\317\361\356;'{\354\335\253\241\361Mz\327\270{\306\334\261=\030\b\021\266_ZB\263[\334\330\033\236}-Z\\\b(\260\276`]+h"
+	.ascii	"!`P\250\376\361\002P\nZGqz\305\322\251\350\023C\f\372(\324\271"
+	.ascii	"\324<\342\271+\301f\030\272\034R\376 \272\3261\334\375n\202\200"
+	.ascii	"<tw'wxw9\022\" \300\002\021#\363\237)\t\3206\b\327<\016\016\037"
+	.ascii	"\310gK\265R0\232\275\035\235\2514\231\036@\2347\033\233\322\205"
+	.ascii	"\333\021\215lpb\314\252<\024:t<\013\302\226`\\\016\2022\022]"
+	.ascii	"\t\211\007`\030P\006\255\372W\206k\320\254p\002"
+	.text
+	.section	.gnu.lto_.refs.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375 \211\355\002"
+	.ascii	"\322\007\024\027\220)\351\377\377\377\377\377\267f\300?\360\017"
+	.ascii	"\364[#\204\020\322\266L)z\231\330K\304\226\343ag6\354\n\0236"
+	.ascii	"\330\t\016l\252\211jO\255\251=\031P\\\"r\332s\266\214h\232\263"
+	.ascii	"\033\313\216\323\030C+[\f\331v\3549\305*\361z\253\215\003\004"
+	.ascii	"\001\375\371\364l\f\352\t"
+	.text
+	.section	.gnu.lto_.decls.68437534eed3782b,"e",@progbits
+	.string	"(\265/\375`W\036\355\207"
+	.string	"z\324\374.T@\022\"\245\003\366]*\375R|A\226!)\344\353:@+\273/\032\236H\0022op\252sQ\224G\230*\350z\206\263\212\365\031\210\200\b\326\363\366a3F\272\263\357\240\212\350\332vn\362\271\353\033\230@\3513\232\336}\245\0239\250\207\322\312\332O\266\224)y\002\327\002\347\002d\236\367\256\016"
+	.ascii	"9\240[\302\243\211\026\020\372\236J\337\304\364\374L\377\276"
+	.ascii	"sflO4\332\234\347N\226\223%\013\231\220.l\326\034pu\304\n\020"
+	.ascii	"\3475\334fe-\f\227fz\016K}\226\310\235\311\331\342\346l\262\231"
+	.ascii	"\363\231\235\263\035]W|\246\313B\023\206l+5\341\214\313\240\f"
+	.ascii	"\224V\034\203\335\0249\222\005\245\024\023&\207\271\025\352\207"
+	.ascii	"s\030\226{\362\"k\224\301\364\216\225\206\363d\234C\225$\314"
+	.ascii	"#M\301!|p\3538\032^R\374\345\354\206\003\246\006* \032e/|f\247"
+	.ascii	"\312\326p5z9nC\301\216 \2014\312j\314\205\233\r\360\332\271\013"
+	.ascii	"\263]\327\264\336\265q\bBJX\243><b\327L\225\236\033\330\331\271"
+	.ascii	"9n`w6\246?\247\241"
+	.string	"\241Rv\004\311j\364\277\334\031\355ct\356-@\307\3065\244\331\350W\b\261\2730\325\255X8\304\216w`+\334,\301W,\321\311\365\332i\223\244\315\232F\237Bz.\261\3439.\261;R\372\022\322\213\301H_\306#v\034\205\305\270\031\304cg&?\371Mq\275\314{\327\036$\255(W\032\275\213\364,\345\0078\271\023|\200\364\034\264\353\231\233\233\233\343\240\335\323\324\004\217\330\241ek<\242\311\317K\330\213\301\254\021Jy\305\356]\177xKx\310\022k\224\301\232\231\360z\006\343\257G0\301u\212\327\353\336\225\301\320{\233\230\021\340aF@w&\244)l\207\276\323\257<b\227r\210\035\003Y\220\365[\027`0\374<\342\253\205\246\231\222\245\237\261\312\230`\320u\336o}U\307\233\337\" UB\347\267\002\220\375g \347\267;$\252|\367[\276\375;\b\"\364o5UT\376\353~\333\3739"
+	.ascii	"\235\237y~F\177\306\371y\367s\316\317\366\347\233\237y?\247?"
+	.ascii	"\373L\371\334\327\374\314\343\036\346n\b\374V\367\263\005C?\267"
+	.ascii	"8\321q~+\302\317c?C\371\231\371\263\223\237\301~\376\372Y\311"
+	.ascii	"\317\312\237\273~\346\372\331\310\317[?\337\360s\326\317U?\037"
+	.ascii	"\177\226\372\031\352\347\032?\033\177~\372\271\370s\323\317\367"
+	.ascii	"\347\027~v\341\347\026?\037\360\263\n?\317\370\317\344g\365g"
+	.ascii	"\021\376_\371\357\301\177\266\2377\370Y\203\237M\374\357\340"
+	.ascii	"g\002~\036\340\377\372\377\201\377h\377\001\230\233\233\233\373"
+	.ascii	"-\226_"
+	.string	"\227\302OB\027Bp\235\306g\274\206\254@\211\332\017]\246\235\035\327`:L\223\3511-\246\337\270\331p\355\345\375\245\335\340\272\215\333x-\310Em\034\343\272\\p\271\245!\201^w%\345#\217\330\001\240\013K\257\353J\257\323J\257\263J\201t\305\364(\2324\310K\232\202G\354XPI\377D\277x8\213\002\362\324\350\2255\325\262\205\234a+\275\n)\334f\327\262T\2060\032N\263\236\322dv]\336\310\220e\303\271C\227\265\025n\266Y7\337c\354\344\315\326f-\306m<M\353=\362\302j\350\216=\276\250\245d]\305\204{\305Rd\021*G\243M\005\315\261EkH\243G\177\244G{\244:(Tz\273&\275\035\023\245\304\232#\352GCy?\301\221\303\201\353\355\311\337X\235\325L\035>\3460\303\325h\207\241j\2344\312\250\245W\001\344d\274&\306\313\256\037\234\367\336^;HwY\225"
+	.string	"\006\254\231\264W\177\265\223n\302\315^\377\326\241\221\220Y;I/\341\212sr\2251W\311'kk\235lkE\230\253\244\327\332?\"\020s\225t"
+	.string	"\210\271\224\301Q\206\007\025\323J>\006\207\264\034_Y\322[\036\322\016\342\020\273\316\241\317\342\266\334\242\244F\372\b7\233\253k\230\242\302\206\336rn\341j!]\204H\355*\t\344\200\0038@hA3\333\025Y2\031\330\215\263F\233H\016T\021+T<\322\367\220\365\336\313REb@\313\261\3258\214!\331\330h\264oX\353\321i=\361\361l\3646*\275\245\221\336\022Sn4\351\033L\372NKE\254>\224\020X\021\002\244\321\267\262i8Y+\003\330}\3411\005H\243}{\b\275g\b\261;\"\327\333c"
+	.ascii	"\2253\263Fy\357d\003i\321\312\230W_5\216\036\033rlj8i\034\f\205"
+	.ascii	"\247\360\024\327K\305\013\203\262B>\311\312jX!\237\215\203\261"
+	.ascii	"4\025\021\247\315h\205|2\225*\f\306C\\\357\024N\230\r+\3443\254"
+	.ascii	"q\260\031\237\331u\311\213\222"
+	.string	"E\303\311\243u\364\216\316\321Hn6\216\256z[\365\r \035\034\230.ht\320\335]\353*\351\021\250\207\r\224\020\267F\337kz\366\322\302i<\304\237{\177<\227\367vTOu\fm\243eh\250.\366S\327hc\323\340fKu\323\231\007\356\341@\353\275\305{oX;q\232\032+\344\223L\031\226\013c\205|\276\301\261\030\026c\254\220\3174\254\206\331\224\3019\233\310i\0058\0319@\302\305)\024D_\n\336\336\306\260S\f{\375\234\346\311\316[\265\002\214\025\362\231e\013\373\300k\310u\2018+$\222{\327\253\370\231LK1\032N\263k\221{\177$\007\360\342V\025r>\bA#\322a;<\344\260j\322\250%\222\312mm\365\223\033#\352\304\342L\307X-\253eo\340\261\265\233\037\240\244\371\2626\334\336\260\323\261&\253\207\r\222c\306I\207 Al\r\\e\340\266\256\254;aSjd"
+	.string	"\322M]\233\226/b]nX\0377l\326\356^^\225S\307[\254\333\254\233%M\304\304p\340\260\3122&\300V]\032\230\2514\233\274UZ\032\226t\271-i\230\301\262-\301\274\236\267\347\b\021/\311\036]\325\203&\007\246\244Q\213\264WP\270"
+	.ascii	"a\264W\226\307\225\035\2208\231Yyz\2209\002\326\350\216\366r"
+	.ascii	"3\265\274z6jup[s\201\362\346\245Q\233#m#\265\243\310`:5\252\254"
+	.ascii	"\314`\226>UR\305M[\325OL\\1\033\234G\344\0037m\220x\271:b\217"
+	.ascii	"\366\310g8\020\221D\211\fB\243|!\223\326\350S\037V\312J1\232"
+	.ascii	"\317uj\373Z\246NPP\354\306\367\352p\313\324\340\246\255\321\312"
+	.ascii	"\033#\352\245\305\371\226\376\326\310Mk\344\266^\357\021\007"
+	.ascii	"\207\365\270>p\236\332\323\023\207\341{\224 \207eY\261\310q|"
+	.ascii	"o\323E^\"\231\024G\3264\311g\022\266M\347\246mj57\306{\253X,"
+	.ascii	"Y\217\307\007\316+b\257\275\2146\345\274\310c\320y\3126mxM/y"
+	.ascii	"\315\254\032N\236\215\364\rD\257y\2639\033\236K\357=\362\310"
+	.ascii	"\312\322$\237\027y#\350;\262\264\377\335m:\336{\253t\353=:\351"
+	.ascii	"\234u\314A\377\016[N\340\336\227pq/\321\207\347\231\364\bY\323"
+	.ascii	"\225\211\373\257\335[\304\"^\200EU\304\322adb]bq\b\361\347x\261"
+	.ascii	"\210F\346\275?\267X$\266P\336\037#\363R\335\030\330\250\370\256"
+	.ascii	"X\304[T\336\237[\274M&\214E,*#\263\211\352\307\310\304\242\272"
+	.ascii	"L\254\353s\213MG\032\305{\374\271L,2\227\251\244\36212\225TF"
+	.ascii	"&V\222\325\214f\324\250\334\236YT\330\207\261x"
+	.string	"\245\242\222MG\2375\343\252\274o\367\262\330\323=&poRy|k\322\301eNkRNS\232\224\002D9e)oq\315\310\245\274\227\313I\306\215\222\200\270\256]\033x\215\370#y\241\236\356\035 \352^\"\337\265{/\361\336\313;&\327{y\370\030\227QQ\367\"\201\242n\222h\366to\213\201)\24322\263\224BfP\230\313+\303J\344\345}\303:\246Lb\223\013u\357e3\351\222\312\252L\243\317\243\224d\016\311\264\321\254L\021H\035\244\254\344\316\234\3712\362\243Q3\334\f[#\326\350wM\351U\364"
+	.string	"\267\344\222\326X~\241,o\313\326\002\367\203\313\262\327\272\2401\033\233\226\336\362\013\251m\231\300\007>\343\261\367\316"
+	.ascii	"f\331h\177\227q\002\305Q\001/z\302%\325\250\027\303\3472:\020"
+	.ascii	"@\004\021IIK\036 \001\227\202C!|!\374\230`\334\204\240\366\\"
+	.ascii	"\374\230\224t\206;\235\236\024'T\241\221\322\t\022\273\027?&"
+	.ascii	"\245\237aR\022\006\302\340\006\303\020~LJ%T\340\013\237\037\023"
+	.ascii	"\214\341M/\t\311wC\302\217Ii\207g\330\342\307\244\344#\342\013"
+	.ascii	"\374\202\302\r\206~LJ$~\344\023\366\200=\024\322K\260\002\202"
+	.ascii	"\025,T\340\235\005"
+	.string	"\005)(H\261;\013\n\204\204(X!\224~\205\220U#P\341\203\202\022\t!R\217\204\216\0170\350\033\276\3701\301\3701\301@\352\035\001W\030\002E\350\r\227x\324\241p)\203\336pig\005\241\332\373\365\222zD?I\301\243\240\032\024\302P\205A\245!\320HHD\002\005\240\321\t\252/\0035(c\330\2427\\\352Q\325\"\336\020\005#\242\240o7,B\301\027\003\030\034\232\321k\001C\330S\201\275!\237\236j\004\302\217\tFp\206\2607\324Q\213Ta\020\306\007?&\245\036\265\350\203\027h\320\327j\321\220\220\3472N\230\210\321k\321SZ\201\250\250\203\027D9?\237j\325\"\020\206\206\204GG6\251\007\004\032\3118\342\365\222\214\216B\300Q{\303\0301>\350\r\223\226\224r\230\202I1\204\275\031\037\364\216\204\301\030;\303\242\336\221oF\257\305e\234 \340A\245\236\020\205\032\f\nQ\344"
+	.ascii	"\231\202H\352\222\214a:,\"\032aG\365\001_\250\303\240R\032$J"
+	.ascii	"2\002\n{\252\n\032\004\211Tao\0060xDb7\364!\361\220:\030\372"
+	.ascii	"xT\241\221\032B\216N-Z!\224\252\300\027=\325'dJ{j/I\351\027\034"
+	.ascii	"\352"
+	.string	"\251FHJK<D3vj\021\013\025\350[\342\251\300\245\340\221\016\251\307\202/\311\310\247\372\200\276\034\244\036O-R\323\013\t\r\231\020\301\003\027\351\321\211\237oX\244.)\251K\301\242\037\223\022\212\241\2607\303'DB\001\364\031\375P\034\t\207(N(0\354\240\367\363\021\365\222N0\002j \f\252\301\337OR0\230A\221n\207\261\2367\245\026\224\231\315\342%\223\264a)\343\266\235\216\030\326\214\221\251\331\331a\310U\226*\315\354q\263\232kR\261N\202\030\242\366lTL\314\216\211(\342\243\313\253g\313\022\033\276\330\346\355\330\216\334\2235&RvjSl\200h\364\306\315L\017\234/(P\030-\n\031#N;$\t\366\325\206\311\344\270\254\035L\"PM\270\264\311\233X'>D'w\212\303\246\220Am\344-)\325\350\235\260U\301\335\036\300\3008\216\003\021=\360\210\344\360\242\022\346\345e\277"
+	.ascii	"\200\242\225\304\271F\304L\020_|\006G\205\344\213\b\022$VI\001"
+	.ascii	"g\307\016\322e\354\332$\267JN6\364\304\244\211GWW+9X/\2217\266"
+	.ascii	"L\223|\336\034\271\2708\fP\022'\247\261\351\320\321\350o\232"
+	.ascii	"\206\f\261Fp\310n2\250\347i\355\311\303\032\261EB\324\220\272"
+	.ascii	"Qd\031\202\247\250r\341@\210\362\230\"3##2\222&I\007b\n\020\204"
+	.ascii	"\242q\2448\315\003\022\2004A\0223\310dd$))\224\206\315F\211t"
+	.ascii	"\321l\350u?P+\235\0014\"\237<\034\350S\024\0277\017\317\267\217"
+	.ascii	"\330\177\230*K\373\303\324\020\2512\"\256G%.\n\033\213B\254U"
+	.ascii	"\2653;\3268\276X\327^\246\2612&\234\346n\257\247\025\353_9\320"
+	.ascii	"\227d\025%\375\356\373P\251\3544EH\314]*W,\r\200\337\305..\327"
+	.ascii	"\215\"L\313_\t\237\206\356/\033\017K\032\235\001\214\306_H\333"
+	.ascii	"\274\021\256\342\031!\215\251\006\324\270;\207\324\365\305K]"
+	.ascii	"\332\206\234V"
+	.string	"\247P;\323\335\312\321\315.\330\274\251\376M\240\227\017u\367%s\232\3513\314\200A8\333\23134(\360G-`\n\260\2324\207\263\213\002\3553\001\234,\356@CW\034~\310$e\307?U7f\330\332t\233\214\225\352W\344\252\265N\311\235(b\243\362\0377h\017\035ME\303\320\b\251D%\261\214&\205\0360\030\364\363Q~\240R\017\027/\377\321\013/\001`P\350-\211\r\273\321^\324\305\022s\033\314m]kj7\357\026A\222\245\214\026\237\274 M1\216\205-\306Z\332Q\226\207\030\n\235\026\207\226\362\255F:\n\275-\220\303\263UPV\2103\305\223r0\237\327\266\257\325\347\b3T\374\237\337;\344\365\266\363\312\360WI`l\026T\254^\320\310\037\264\241E\255\357\224u\3045nB\321[\305\315\263\315\212a\227]\020\253\016\217\351oc\275\225\350\375O\362\0224\363\236S\223\f\263\304Q"
+	.string	"\270\006\273^$\360\301\373\262\n\203\302h|3\255\300\267[8\360\313\"K\354<\263;\324+\302`\3170\323\311\240\340\234\303\267)U\023\351\201\023\022\320\326T8u\330\232\200\315D|e\2648\"\370\215\207\320yW\246W\t*\275b\324IgY\271K\252n\345\002\253\226\rD*\006\302\236\226\260b\254\363 \271DdQ\034y\320\256\202lr\242\325\3160\r\217\250\373F\217\2022/\2109\352\006z\033\203\204\212\241\002\364#\343\301\270\270T\331lF\311\367\233\026\255s\225\260\317\241\371\240\275^\320\330_\304\t\250"
+	.ascii	"=\300\332\240EL!(\031d\301E\336=\347jI \357\037\271l$/\202L2"
+	.ascii	"\223\027>\f%\272v\033\373\f\246\333\225%H\251\337Tt\271k\267"
+	.ascii	"\237\306:\031\275\266k\302\bW3v\022Bw\361\265\273\206m\244\364"
+	.ascii	"\320\002\241\030=Dw\301\222\301\013U\241\322\232\375\332n`\212"
+	.ascii	"1\273\344\003\035\262\305\275J]Q\212\263\237"
+	.string	"\276\372\260\321\031'\365 \034%\347XW.%S\246\275\316$F97\n\234\362\263\227\371\220H_\353\256\315\307,\025Pa\332c\245\007l@b\216X\302j\370bPU\303\204\r\204/n\2074n\242\0328FP\365\253\307V#\020\036\234\212\330\036\217\354\265\273\255[\375A\340O\201|\207\2637\327I\333\033\237\377\355S\200VV\203]\232\272\242\300\247G\n\r\022\003\345\032\0066\030\003\240\340\016aQ\206)b-\352q\203\245-@\205\253\230\326\2753\375\177UP\245P\n\324(\026\301\270\370\374\245\007\\\312\374\203Q\276\004\237\227T]\342\035\0345\207\020:\231q$\206L\340\221\264R]\b\360C\301\214T\331\335E\251\352\221\256\004\206\"\037$\033@*\035\245\022\t\370>hb\310E`f\023\007\037~,\004\025P\224\006\\{I\023\367\203\023\310\313\275jQ\030G\220\204 \316^\\\253\n\317\374"
+	.ascii	"\364\027\355\005\325\266\246`\034\324\210\305\245"
+	.string	"\005T\274M9\301\244\2323G\333\320\200\213\334\360\213\003\225)n2R6\264X\3030~]\3343b\230\261\274\251\221\311\261l`\036\036E\220v\226n\224#"
+	.string	"E\230!\344\261\025\257\033D\001\001\265Q\330\b\207\020\321\272\264\234>\203\222;)'m\264!j\b\2156\357\366(\034\347\341'\306T\370\323\222\274\036\316\360\230\004\302\377z\231\253\370d<}\271\213\252\324z\n9a1\304TM=\242\373\213\273\371\334&\236K\260kb@#|U\253)U\223k\t\246b2\247\022w\260mzP\242!6\345\023\214\277C\004\334bD\3276M\341\256\236\256;\306=\330\013\277E\302O\264\203\311\031\255\307\221\247\343\361\227\316\275o\037\245c\316\275\330?\367c\377\007\301\201l\333.:\374,r\345\230bf\365~\302\337mW\350\277y\371\037uh\347\013\345\347\203U\235\246\214\367z\360\"\352\241\274o\215\374OC\207\303\305\215\275\003x\016\370\205.P\317"
+	.ascii	"\335\2326\226\207\206\375\363\003\362\237\336R\266\351\f\336"
+	.ascii	"Kp\223\364\221r\216\022o\204G\262\207\236\026\013\366J\356J\255"
+	.ascii	"S\337M\002\356\013\224\025\357\234\004\223\f\307\267\256\251"
+	.ascii	"\241\342q\310\210\310Y\377\364z\022~\331\016(\346\235p\362\371"
+	.ascii	"\004\230\0256&\023\352\346\374\032[+"
+	.text
+	.section	.gnu.lto_.symtab.68437534eed3782b,"e",@progbits
+	.string	"pwmIsMotorEnabled"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"motors"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"motorPwmDevInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"pwmSimGetMotorOutput"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"pwmSimGetMotorCount"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"pwmSimMotorsEnabled"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"motorPostInitNull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"motorUpdateStartNull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"pwmSimCompleteMotorUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.68437534eed3782b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,189 @@
+	.file	"resource.c"
+	.section	.gnu.lto_.profile.8753f592594bfef6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8753f592594bfef6,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\316\307\311\223\r"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.8753f592594bfef6,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.8753f592594bfef6,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8753f592594bfef6,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.8753f592594bfef6,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.8753f592594bfef6,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.8753f592594bfef6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.3.8753f592594bfef6,"e",@progbits
+	.string	"(\265/\375`Q\r\205;"
+	.ascii	"zg\374\02670lM\007\0030\3145\377v\360?\233$\351B\250\221\355"
+	.ascii	"\3569\202\277?\274\252`\301} \265\367\366\367R)\316\257\315\305"
+	.ascii	"\324W\303\271\002`\354\304\332\266\226D\246$\003d\001m\001\\"
+	.ascii	"\001\333\365\0079\255\333\275\275%\333\365\327\033\244\337\271"
+	.ascii	"=!\3335\030\0336\277c\265]\207\2459\272\241\374i\273\0263\303"
+	.ascii	"\346\206\306\306\270\371!77\332\256A<\030\244\037zs\210\357\322"
+	.ascii	":\"7\007\332\256\311^\313\232#z\263\210wQ\307;+\223\031\315v"
+	.ascii	"=\342\253\2609^&!e\350ynZ&\263\223\355\272\304\0234\317{\363"
+	.ascii	"\221\355\332\004\223\2437ram\327'>\211\2337z\037\325v\215\"\211"
+	.ascii	"\346\216\3262\371\241\266\353\024O\344\350\216T|\034\234Kr\037"
+	.ascii	"m\327+f\035]\322\373w~`\255\371$\367\375\374i\325\372\2447\255"
+	.ascii	"L\276\034 UG\247\344~\232@\247^8\245\027F\231\374*s\244bx%\327"
+	.ascii	"X&\275\026]\250\031^\351\245Q&\335S\235'\244kr\235\222\335\246"
+	.ascii	"\243kz\025\t\302t\364M\356\334\240JG\337\364\312\021\222"
+	.string	"ttNi\n=ZsN\257w\271kt\364Nn\024C\214\216\336\311\213\034JttQ\256\017D\206\216.\352\265Q&o$\"\264\346\243\\\034eR\206\";6\037\365\266\225\311u\321\234\233\223rw\224\3113F\177\220N\352\365Q&\201x|~x)\027H\231\034\313s\004>\327\330\363\300\241\225\242\223\223\025\027\227t%\256\203\224\311\337\256qF\2031\327\226]\362\227\f&\213!\313dr\231|&\243\311j\362\232\334&\273\311pr\234<'\323\311r!\362\035\020f\003SqH\206\254\300\331\316\t\301\254L\376\306\354:p\020^/\333\365\313\201\213\340f\331\256\363\033\264\b\357\224\355\272\307\006M\202\373\323i\340$\274G\266k\237\031\270\013\356\357\347\b|c\220\027^W;\f\022\303\226\227\026\303\313\265\005\231\301\215\264]waa\313\360&\332\256\275\262\025\266\355\243\333\256\001LA\333/\237\355:"
+	.string	"\0244\017>\001\271\311\017\017\2763\333\365"
+	.ascii	"%k\037|[\266k"
+	.string	"\002\371\210\333\007_\201\"\355\227\3533\220\205 \277^\337\001ZH\260V\3335\202X-\230&\265]'p\325\206\320\233\266k\005\253\334B\350\005\250Z2\274\355\232A)$\331\333@T+\302\375\263];\370\324\212x\355l\327\0178\265#\\7\3335\204L\355\b]f\273\216`\211\r\205\326\262]K\230\364\003\305\253\231l\327\023 !S\270z\310vM\301Q\233\342}\265]W\300kU\270\246\266k\013\212\334T\\8\304\266b\322v\215\241\220\333\212\274\355:\203 6\237s{\204\266\353M\207\364\271W\003 \324\351zq\266\353\r}\340\234\356e\263]s\320\263\346un\017\314v\335\341\216\233\327\275=,\333\265\207:pn\327\243\022bbbabc R\324\013\257\346\330Y\231\021-\256h]X\025\232j\306T\005\226q\341b\373\303\304\2644(\024\266\305-lF\004\226\261h\231\221M[\254\301"
+	.string	"\230\306\327\221\306\033\262m\307\361\rl\307\333\261\307\332[\r\260\034k3\330\300h\274\355"
+	.ascii	"\373\212\200\333t\034\337\300x\264\265\275\201u\341`\332\332"
+	.ascii	"\303\256\307\367x\037\367\343\200<\220\323y\235\013\362A^\310"
+	.ascii	"\357\374\220#rE\276\310\361<\317\035\371\353\220<\222OrJn\311"
+	.ascii	"/y&\327\344\234\274\223\177rP.\312Gy)7\345\250<\225\257rV\356"
+	.ascii	"\312_y,\227\345\264\274\326\013\371!_\344\215\374\221G\362J~"
+	.ascii	"\3117y'\017\345\243\374\224\247\362V\376\312c\371,\277\345\271"
+	.ascii	"\274\227\377\362a^\314\223\3712\177\346\321\274\232_\363m\336"
+	.ascii	"\315\303\3718?\347\351\274\334\333y"
+	.string	"<\237\347\367<\237\367\363\177>\320\317}\335\333\375\240'\364wo\350\021}\242_\364\214>\357\033\375\373\217>\322KzJ_\351/=\246\327\364\233\276\323{zP\037\352G=\2517\365\247>\325\253zV\337\352_=\254\227\365\263\276V\216\313C2\221l$'3\222\234$/\311L\262\223\374$G\311R2\225\\%_\311n\316\222\265d.9\370<U\026\032\017\323\212=<,\026{XM\331t\350\303\251\013\365\\}=l\006\201=\314\262\3002UmMV\355,1\272\256\252\321\f\002\267\260\032\253\246\032\271\260Y[v\006\315\314P\225\r\200\323\026\346iT\201\304t\355\302\303\223]_\254%NW\024]\323\341\026\026\232\300\340j4\307\320\022\377\360\231\031\034\232[8Ll\fD\320\230\242\301\225+\250\002\315\340\032\240\305\n\024\262\330\302\253Y\342\325,\203k\372\303+\027^\177/\314\270\260\231\236["
+	.ascii	"p\331\332\3660k\236\354\031\354\302\352Y<\317\262\037\016"
+	.string	"\256i\017\227X=Y\365tAD\267p\021U\331\325\030<\205\\iq%\002U\326\013\253gZZ\344\302\253\371\303@\026\030\334Rc]\224x5\215\353\n,\016S\263\013\233\265\302\242QM\005\200\205@T=Ws=\271\2600UYbj\032\201\3529\004\232\002p\261\035\242\254\017\253g\220\210\2628\315\210@\325\013\377p\212\022\321\242\017\023\321\242\321\\\207\306\262\265\365\302\2519\354\341 \021-\013\236\302.\314\242D\364T\213%FY\265\323K\215=\200\211\247\021H\024\"\300\302s5\262D\2401,\214l\3144\215jj\002|&4\267\304\304\002\201\017\250A(\303\254\207\"\022\024$IA\262\254\001\001\206\2121d\353\001\021\340\220r\215\230:\006C\b^\260X\013w\211\366H;=\030Uf\345\231\207\265~\032\n\273\024 \004\314\342\034\025]\306\375\256ei E\032\267q\305l\t9\251\323|\225"
+	.string	"X\202\227\347\272\020\031P\200\341[\217A\336\352k$\243\201*\037\244r\325\025\256\021\032\261\316F\323\341\376\352)\341/\204\346B\013#\003\"\257\212\350&\0317\024AN\305\023\003\2326\024!T\361+\024km\321\243[{\216gR\3217\327\327\340\273X\343\3068\373\3415\331Tvm\300D\375\026\313\306b\363qF\254.\260wQ>\224Q\2723\215\\\034\350\251\n\fq/f\361\275\r\306\340\f\226\002\031\367\366\037>\344\376\366K\276ro\350\333\360\033\362\fG+b\330\272\337\204'\220\3411\364(/js\325\205\027\247A\311\356M\021v\325\331\"!\217\322\245y\036M\b\0133\206\337T;O\235\252(\207\225\215\373O@{\334"
+	.string	"\030\365\271h\226\277\"\366\233\347{G\031f?\374\354\350\323\1770 \2677\316\206\224\345\212\357)\024\360\017\020V\0364\247<`3\356_&\316\365\252D\206\351\f\247N\271\037\004|\236\305\325\027\024\005Z\222(\257\363l\267\261\301\245\276\007&au/\245\020r\207\270VPPv\222W\363\005i\005\033t\266\242P\334\335\001\304W\244B\032\200\031"
+	.ascii	"\320)\332\307\022\177\n\001|\002\"\347I\352\216@$HA`4\013! \""
+	.ascii	"=\372\222\202\370\265\331\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8753f592594bfef6,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.8753f592594bfef6,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8753f592594bfef6,"e",@progbits
+	.string	"(\265/\375`\373\006\225\""
+	.string	":A\250\rH\220\224N:>D1\257\005E\300o\216\273\207\223P\274\367Z?-9\004\377\267\006\351\350\247Q\360\211\372\235\001\226r\360\345h\325-\311W\001\210\231y7\217D\325\300\276\222\022\tf6\242\310\b\351\345H\254=i#\231R\244"
+	.string	"\322"
+	.string	"\312"
+	.string	"V\251\331\221R\245iz,\bEijs,\240]\232\332"
+	.string	"\177\005\277\202*e\364\244eVC\350\375\210\372<\354#\277\343\305\344\021:\246\3114M\201\277\232\026u<\266\372\370\323\354\201\331:\f\203\226FpK\217A\372\323\344A\375\305\364\366lo\331'`\037\306\376\213}\001\366\201\366]\354\263\330_\261\317\263_\355\257\375;\333v\266\351lC\261\rg\333\211m7\333Kl\267\331f\263\235f\033\315v\231m2\333c\266\305l\177\331\366\262\215\300\376\220m\037\266o[i{\227\313\345\322\366\217m\031\333\214\013\022~\232"
+	.string	"\314P\377,GR\221i\253Y\244\214\207,\316im\365\313\354+O\366c\002\3621\333\352\344Os\005\211\372D\200i@\344\234\206\214\375\322\263$\264\255\376\230\375\260\213\335\254\261\205P\223\255~\373i\272\bA}\260}J*\225[[\036\344\213\305\013\244\234\255\376\227\375\256{\035+C\232\366X\341Rbz\333\232\340\247Y\377b\236\013\365\201Lh:\222\332\252r\034\377T\325\247\356\243\246'\212i\252\302\001\234\321\306\023\272\224\207\210A\001-9\234\255\037T\023\321\323\321'T\374\241c\253\257e\237\3529\236\365+J\323\2334M\t\360\210U_X\233\365\244J\321Xt\f"
+	.ascii	"\234\372I\222q\244Z\361\252\263\001\264\365V\277\362\261\336"
+	.ascii	"\303\017\"\004kc_\312\326\270\020A\022\323\331\372\242%\352M"
+	.ascii	"}[\312\273\247\255/S\356\\n\004\201%\267\372w\366\343nwee\243"
+	.ascii	"\266\365J?\315KA\375\272\336\2240\235\245\255\003\242\320I!\035"
+	.ascii	"\341l\365\351\354\317\035\212\017if\207c\353\241~\2320q\250/"
+	.ascii	"\007t\341T#\264\365|\002\327[AD\016m\365\341\354\277\335I\013"
+	.ascii	"Q\215#\244\255>\373i\376\224\240~\023\336\220\362E\023\0237\344"
+	.ascii	"\216O\324V\337\315\276\222/y`\\\212\261\325c?M\337\021\324Ob"
+	.ascii	"\336(\326I!i\363\021y\310\210[\3756\373G\316f.\237\342\214[\335"
+	.ascii	"\365\323dQ\242\376\232\357\346G\313I-\255\312\251\225\371l\365"
+	.ascii	"\323\354\0339\332\032\027\234\322\326>\340\231\017\302a\020\304"
+	.ascii	"\314\3140\350\033\306l\220\251FQ\n\t.X\250\320\223i \224\031"
+	.ascii	"\206\230\241\021\016\2034C\241\b\016C\rA\017\034b:\004e\2064"
+	.ascii	"\301\006\006h\204\035b,\f\205\036F\314\260\330^\241 \266+\262"
+	.ascii	"\254\255\336 {qv\305\217\253\314*i\353\202.\324\013T\217\346"
+	.ascii	"vj\354\317\372$Yi\001m\365\372\330\027\262*H,\357\240lu\333\033"
+	.ascii	"\352\355\361\025\t{\253Z\236\3351\342A\262;\366\246X\235\237"
+	.ascii	"rHZ\335V\323\3754\201a\250\327\270\\\006YB\2619-rI\2146\307\276"
+	.ascii	"\331\236(\336\300\210\332\352\340\247\2718\250\267\250\322\326"
+	.ascii	"\343\005\264\225\267&\210\030zh\254m\365\022\223w3P\230m\275"
+	.ascii	"\021\324{s\340\007\230W\211\265ic\021\025\267\325\001{\25014"
+	.ascii	"G\f%\314\223 QA\241\260\031\260\002\221\340\216\333\021`!s\002"
+	.ascii	"I\226\021\257\237\001\311\326n\r.g\n\200}=\031.\237\025>&0Pw"
+	.ascii	"\354:V\020\247\222\274\314\200\355/\353\300$\207\337C\003\346"
+	.ascii	"\0011\371\227O\262\016\325\310P\336\343<\3157\376\273\343\321"
+	.ascii	"\326\246\226Q\226\3019\001J\206\002n\214\235}\270%\r%:\227 \250"
+	.ascii	"O\335\355\22231\226\252\037x\215 \314\222c\335\005\341\343\001"
+	.ascii	"\351\215\301JD\022\224y,\270%\215\005^\002\242\311L\240\374\242"
+	.ascii	"\2675:\250.\354\374K\001g\251c\357\200\341\322\021\034HS\216"
+	.ascii	"u=S\355\030\352ka=\347k\313,\361\303\214d\321\215\203\"\246\205"
+	.ascii	"\367D\353\364\327O\022\363k@\314\002d.A\334_\305\206\322\342"
+	.ascii	"\212\312\356\024hm7\241V\001"
+	.text
+	.section	.gnu.lto_.symtab.8753f592594bfef6,"e",@progbits
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8753f592594bfef6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,713 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\016"
+	.string	"\017"
+	.text
+	.section	.gnu.lto_.icf.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\035\006"
+	.string	"\024\n\364"
+	.string	"\020"
+	.string	"\345\270\263\204\t\n\002"
+	.string	"\002\001\002\002\002\003\002\004\002\004\002"
+	.string	"\002\005\002\006\002\003\001\376\310\332\342\r\006\002\007\002\007\002\371\204\261\234\003\002\002\b\002\005\003\365\311\226G\004\223\220\260\362\005\004\t\002\003\005\332\326\203\320\004\004\006\255\302\302\203\017\007\273\352\374\254\004\005\002\n\002\003\b\357\342\376\200\006\013\002\003\t\254\234\255\305\f\001\002\f\002\003\n\231\366\336\334\r\005\002\r\002\003\013\351\305\300\264\t\016\002\003\f\362\261\204\342\002\017\002\003\r\370\231\323\233\007"
+	.string	"\016\230\257\232\210\020\002\003\017\240\354\315\034"
+	.string	"\016"
+	.ascii	"1\013\2273W0$\230\tb\202 \301L\020\240L\201\031\246\016\256\361"
+	.ascii	"Ta\223I\336\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\335\004"
+	.string	"\362\205\021\030\240'\351\377\377\007\336\252\252\252\252\272|\333\377\377\377\033i\204\220-S\n^x\302!HP\031\030\226@Q\002\003\034;\033ft\330\027\035\021\321\234\372\350h\217\310\220\232\324\231a\277\335\353\017\361\253D%\313\027\001$ \220\"\261+;(\001\231a\270Q\343X!\203\021;N\325\346_6\367*>Or\356-\313\306I\221\344j(\334@%4O@6\203!!\334\300H\212\030`F\221x\"r\255\020\264"
+	.ascii	"\330\321a\003\330\346\222\021\023\341L\220\013\017\202^T\204"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.inline.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\261\003\255\t"
+	.string	"\022\216.2Pm\222\016H\243\0011A\266\007\314\231\247\233s\022S\025\327\351\210\217X\221950\321-2fWUUU\025`\350y\375\306m\366\267\326\310\336;\005\007\\&*>#\324\226\203\004i;]\001H\211\361\t\351TS\025\312$\247CL\204\221\2668\371W\354Jv\"\355\246\315,N\213\220\375\031\274\373<\361\020\260\243m\345|6\022\334\205\3223\264\335<\373\232\267\357J6\276A6\220hx\246\327\344C\013A%d),J,\337\026g\212\007\376\265\350\223\270\307\026}\001\266\355\354\306Q\203\037\236\210\214\311+ \207\003(\224\301_"
+	.string	"\017\357[\310\rP\2503\360\227\331E2 \240\"\021B\323\001\347\210\004\224\334\033\200\221\354\025\036p\035\201\312\261\327T\321\343\220.\256\240\300:\004\033Y\016YL\350\335Y#\226\324\265\021eH\022\344;g\214\216\353b\205\310\t\274\\p]\302#\203\341\306\306\304\363\030\340\350o\bW\242\2131\314\362\300y\005\230\221\0040}\035\305\022[k\375i\372\315xo\013^\320\263y\312u\314\017#`\254d\006S"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\351\001%\006"
+	.ascii	"R\311\033#\2205I\007\377\017\276\013bff\246\230\231\231\205U"
+	.ascii	"KT\213=\326o_\277\365\333\357\267\277\021\262\211L;\246\030>"
+	.ascii	"\276pG\001\361\006\341\2053\036\311b P5e\255\265\356\035\202"
+	.ascii	"#\236<\003\bI\252\234\237G\252V\366\356\245\025\007\321\316S"
+	.ascii	"\3655\223\236I\034Yy\256j\257O\325\254\274\306\276f3\3531\301"
+	.ascii	"\036\213H\200\377\330\301\030\020\" \220\302Af\036\375E\270\272"
+	.ascii	"\334\205\013\326b\350d\341!\037\b[\t\326\001\222\200\013\363"
+	.ascii	"9\220\177\347\\0\324K\272\334\\\b\241\244\360u\033\313\340\""
+	.ascii	"\250i\304\254oC\340\030I\344X\221P\304\202p.\366\243]\227\023"
+	.ascii	"\004,\007i\200\006z\305\035\002"
+	.text
+	.section	.gnu.lto_.pureconst.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\271\004\001\271\004\002\205\004\003\231\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\007\231\004\b\231\004\t\231\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\230\004\016\231\004\017\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"\255\004"
+	.ascii	"\222E\024!\240)\303\001\377\274\376\377\277UUU\025\371\266\377"
+	.ascii	"\267\375\357c\275\375\237\020B\b!d\223\275\245L\001\377O\007"
+	.ascii	"p\021\344x\032\016\243Y0mQ(+1(G$\007\265\241\274\320\337\357"
+	.ascii	"\324\324\032\037s.('\224\277z,\273\354/\b;\035\230\221# `\203"
+	.ascii	"\266\315\001\021\205\370\324\300~\222\025\004\206\033\0305\230"
+	.ascii	"\r\302\336a\234R\213\231A\354\301\230\025\214\335\002\r\354\016"
+	.ascii	"\026\023]\rV\203(m1 ~\307\370[\240{w[\355\372\364\025\247xC"
+	.text
+	.section	.gnu.lto_.lto.39e314b778b2af43,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.9.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\256\001\235\020"
+	.string	"\006\340oF\360\262&\035\222\312\231\377\r\016\2311\361\330<\002\n\320Q\025:\243R\030b\r\255Ur\263\246\236\332\356\257\214\274\277\002\225L8G\nc\3253\360\f\274\336\314V4\216#L\270\365;\376\035\220n\204\220M\244L)Z"
+	.string	"W"
+	.string	"^"
+	.ascii	"\273\241\002\217p\217\016?@{\344.\242=:e\013\025X\001\320\231"
+	.ascii	"\341\341\261\273\236\212p\226\251\307L3\345g3X \314c\266\255"
+	.ascii	"jJ\204\200\253l\004\033\002\372\353I\003\2522\353y\336\330`\235"
+	.ascii	"\260\271\376u\004(b,\320\346\271E\330]'\013\344pk\267=\301\366"
+	.ascii	"\003;3\277\350;7\267=\374\343\303[\265t\306\364\003\210B\210"
+	.ascii	"\344\330\255\211\371\330\240\bd\342;\277}\237\347=vg\226\267"
+	.ascii	"\260\201\226\212\335\355X\354\356\361\177\2713\003\007\251\357"
+	.ascii	"\264d\333\001\302\n\327\320n8\362\350\221\235\241\213P\203\247"
+	.ascii	"}\235\263H\335\365r\001\273\255\037\031\001\272\351_O\260#\266"
+	.ascii	"!\205*[\207\344U\244\356\324\035\210\225\302\230\016\203\002"
+	.ascii	"\267+S\342\277\260pR\321\036;%p\303\365\036_\270\013\025nwK\374"
+	.ascii	"\037\223\023?\347E{\004\321\017$z\2708\275\252\215\317\314\217"
+	.ascii	"\230\214\251O\215\025\250\212c\207\252\374h\004l\310\332\262"
+	.ascii	"\271t\267\245A\356\n\025J\371\255\240\324TB!\255\240PN\234K$"
+	.ascii	"&\244\323gBy\250\317\224\341\364I\360PN\244\023\257\364\241<"
+	.ascii	"\222\003N\301`\372\274\225\224\224\317\353\302\230k+\336\004"
+	.ascii	"\305\250**\216a\272\251\263\214\252J\343\267h\234^\307\013\207"
+	.ascii	"L\302\234\312i\362\314\374\360ch =\307w\321\036S\223\006\215"
+	.ascii	"\207\005\327# \240\202\221:\333\001\242\300\352\215\305\255\310"
+	.ascii	"QBz\373\245b\314g\232\rS2\330\352#\373rf\371\332\242U\310y\350"
+	.ascii	"3\246\246\0250\215\310\022\334\262\\p\270n\003\306\303\324\037"
+	.ascii	"\004G\023\206q\241\2275\"\200(\364Z\\Z\241ea\357\264\353\t"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.10.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\r\b"
+	.string	"\222\21777Po\322\001\2408\211Y<\207\366]XZ\006\323\202D2U\203j\304bk\b9\007\203\266\214`3\203\020\202\252\212\210\224\240\026\257\365j\343!f\274\303n\262wJ\001V\205Q\035\r\273\244+N\003uQK\233\032\265 .\3120\261\213r\230\025\325&\247\300\331\203Eg'\313\350\314\324\275!\324\200 \205\355\210\2238\271\273\n~\310\204\204\334x\364=\0203\002\275\222]?\017b\330\237\026\212\f_\3777aT\006Rv-J-\213\022M8lov\306\366{\366G\377\330^=\017\330\025\235\224\354\326\003\033\310GWi\333\357\270\307fn\252\032]\302H\205\b\313n\235\232\023\\\036\247\013\\\036a\306\271?\316?\3107\244\225P\367\371\003X\330]\277Pwq\303\333\336\330F\260M\022\f"
+	.ascii	"2\003\302\260\2268\3742\203\027c\273kx\306\004\016i\214\006L"
+	.ascii	"\020p\242G\265\322\021&\031"
+	.text
+	.section	.gnu.lto_serialWrite.11.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"U\n"
+	.string	"V\224H= \3458\035'\027\003,\341\006D\356\002\217\262\3008\315\021m\242T\254D\202\332\006\343;\321\353\247xi\345^\216o@\311\n@\b\024\240\241F\375"
+	.string	"\212\313\344\036\224\224n\306m\345N)5"
+	.string	"5"
+	.string	"9"
+	.string	"\273#\307\020\331\247\307o\260\317\354\b\330\247E{\200\302\311"
+	.string	""
+	.string	"\312\205\300\356nJr\361R\364\277\362\202\224\252tI@\261\273\226)U\310\255\267\355`\333c\377!\376\370cg\375S\245uJK\215\3643\255\265\231\331\005y\031X\327\2249\261}\315\266J;bB\374\310a\335\025\021 qi?\345*\342Y\244\037\354\256`b\002'-\031SU\016\352\300\305_@\331\356\207\307ou|#\354SjB"
+	.string	"k\274e\224\355\256\307g\021\205Y\t\t\373\2742\230\024`\231\344\313\036KRG\354kvw\255+\007\026\234\354\270\320G\024\206\274\314\\\007\343\343\201]\270\205`\267\341\201\025[\310\373\2006\016\f\267\316\202\277\214\016\334D\337\007n\332\270\327\254\256<Q\\&\365\260&U\247Z\252\033\002\016"
+	.ascii	"2\241O\034X\\p\300PJmn\351\254\322\342\316CX\351\032\020\025"
+	.ascii	"\006\203\271\001*J\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.12.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\204\001\275\017"
+	.string	"\366\335jF"
+	.string	"\221(\035\277:8\210[\212\204\377\016 \375\237(\376\007n\223\230e\340\337\221\215\246\365W \374n\326\032\022\242\364Y\351\321~\345\231\230\271\264W\004v\307\317\004"
+	.string	"\026\201\235\330\227\223t\f\341[\244\222\275\345N)U"
+	.string	"U"
+	.string	"W"
+	.string	"13\273\341\210E\270O\207/\260}r\007\331>\r\3325\020l\b\020\243\003\r\307\356vZ\002\004\025\374\224\032A\377\264wZ\257\324'\267r\351y\255\\%\b\213\013\033\217\027K.\260A!\342\264G\327k\025#"
+	.ascii	"\320\356:\266^!\356\355\266%\330\006\331\267\t?\367\332=?\273"
+	.ascii	"\345\214\2162"
+	.string	"\372\002\006\274\030\250\355\202\310\311\2615\023\206\313k\267\377\342\303\324R@+\017\020ph\330\330\rE>\355\200\373\374\307\266\262\270\f\374\3144\362cY$>\314\354\356\210\033p\237\td\fSr0x\264\257\342+\300\307TN`\027\026\237\350\321\216r\352\250\366hj8h\352c\304\016\231\236\264E\235 \233\301\2128\266+\\\206\304\355\262J\374\027\032L(\333g\324\020\031\276\360\030\024nwK\374\026\245\023gBe\373\274*Hq\023S\305\034;\\Em\261\177\200E\307\r+\314\376\354\367<\374;\217\005'G\2250\230D3\204\n\231HOT\n\241N\245\021g\021\211\205\320\350\363N\335\351\3632\214>\223\2564\n\221:\321w\352HBl:\361\276\016e2}\335'T]a\264?\270\251Q\351jj\213\017\363\b'dbG\247\272,\243G\245\272l\017{\024\342[\3364\365\r'\307E\006\036"
+	.ascii	"1\003\367\334Q\343\340\033_\031E\321\004\361\020u\026\372\337"
+	.ascii	"XK\316,\247\024\344\226\342\276\254\335Yc+\264\264\321\255M*"
+	.ascii	"B9\210\001\314\351\200\rh\242\004|A!\270\f\214\bPQ\304]\336\331"
+	.ascii	"dS\230k\264\n\n"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.13.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\215\t"
+	.string	"V\222B:0\345(\035\236\213\247\302C)\301\244\034\326\275\322\031X\364\310?\022\005\233Jfk\246\377\370l4\210\301l\024\304f\302\300@\023\b\217}\2702\354 \324B\364\223\277\367\336;\2452"
+	.string	"0"
+	.string	"2"
+	.string	"6\305J\262z\030\300\361\022`\267R\316\013\346e<\301\274\204#7\375\231\374\263<\242\200\270T\253\323\237Fbw\375T+\217\033\336\266\202m\007\373\002\0011>?\370|M\303\307\301k\267\343%`g\244\314\211\355\222\275\261\375\236\375\326WJ\257\244\017\354\262"
+	.string	"\304\354V\006/`\227\256\230m?\345*\245!)x\262Mq\027\bFc\313\230\227\017&\370\342.\035\266\233\202\360[F\030\230\311\245O\232\227\207\006%-\324{\331\365\364\240\210\375\270\220\345\371\372\007\331'\344\021u!\r\363\247S\341\321\270\254\243\035\227\2154n\202\2064\017\210~\270\216v\020\274Yd\034\025m\033G7u\357\t9(\270\341\315\213\320\017N\030\021\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\q\3062\327p\221\t"
+	.ascii	"\034\250\361*0\361\340n\217j\305$L2"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.14.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\255\t"
+	.string	"v\222C<0\345(\035\200\213\307V\035\376\266\213:x3\367W:\003\213\036\371\027a`M%Z\264\372\373\\c\rb0\033\005\261\23100\320\004\242N\213R\026%\340\324\263\034i{\357\275S\n2"
+	.string	"1"
+	.string	"1"
+	.string	"\246XIV\323\305\261\341B`\267R\316\r\346e|\301\274\204#7\375\231\374\263<\242|\fP\255N\177\232\210\335\365S\255<nx\333\013\266\035\354\017\004\317\017>_3A"
+	.string	" \004\330\355x\025\330\031)sb\273dol\277g\277\365\225\322+\351\004\273,\0011\273\265\301\f\330\245+f\333O\271J\311\001\360d{\3420\240\227\214\rc^>\250`\213\267t\330n\352\301w\215.0\223K\2374/\017\017JZ\250\367\262\353\351A\021\373q!\313\363\365\2171\331'\344\021u!\r\363\247C\341\321\270\254\243\035\227\2154N\202\2064\017\210~\270\216v\022\274Ud\034\025m\033G7u\357\t9(\250\341\315\213\320\017N\b\021\222\n\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\u\3062\327p\222\t"
+	.ascii	"\254\250\361:0\361\340\256\221j\305$L2"
+	.text
+	.section	.gnu.lto_serialRead.15.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"u\t"
+	.string	"\346\322C:0\345(\035\200\213'\205hR\300.O\036\"\256\231\016\033\033\356I\312u\364\327\252\325\337\357\265\330 \006\343\025\304f\302\300@\023\330\270\023\363e9\232\204\271\352\311\337\233l\231R2"
+	.string	"1"
+	.string	"2"
+	.string	"\332\007\346\245m7<\230|z\030\302\232\036\033\0310"
+	.string	"\273\341\026A~\272\236\374\247<3\341\210Y\265PWM\304\356ZW-\215;\336\266\202m\007\373\016\236\177\375Y\246\326\250\276f\226\314\030\270\354\262b\001VF\302\220\3306\331\033\333\252\366O\216b\372\253t\201]W\313\313n\310\340\005\355\322\341\t\346e(\333\240\303<mW\325\361Y.*H\363R#\202\301\257\220\264\335\355\370*#\013m\344\322/\315\313\307\002\221WJcv\210\322\370a?\333\335ut\005\334'\344\021\201\241N\363\2073\341\351>\016\334\300\217\033u\237\304\026\352<\240\355\363\201\033\347\300\036\005\367m\"\317\373\266M\270\367\214\t\251\210\341"
+	.string	"\315\2425\316\b\321\241\212\001\n"
+	.ascii	"2\003\302\260\013\314%`oJse\031\313\270\214R\324x\250\016aL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_serialSetBaudRate.16.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\265\n"
+	.string	"\266\024KA0\251(\035\210.\177\006)\245g"
+	.string	"\355!Y\366\256\3053\030:\354\250S.\\\305\306r\036\304o8\213\354\332O\216\321>\002\3206A%\025fB.\024\257\270j\345W\022\332\177t\177\262\311\336)\0055"
+	.string	"8"
+	.string	"9"
+	.string	"a\205)\350\247\303;d\237\364\r\331\247A[\302C\002\373\324\t\211\212\302\356V9\340\340#\350?\365\n\251$z\244`\354\256#\251dr\313\333\236\260}a\277\006G\375\363\247\037\303\242\243\214>%[A\200\230\260[\362\252\260\255\371\300\200\355[l\307\360\t\300\243>\\\331\r\340\262\240\237\022\330\243\375\003G"
+	.string	"\376\024:\303\256\251\301j7\322\026"
+	.string	"#Rd{s\006\035\335\025\301\370\013@<@\331g\224\017\021\374]\001\210\356.\306W}<\264@(\373\274\224,\007\256\323(\276\354P\024\245"
+	.string	"\373\330\356\256\245\311\016[G\323\320x\264\r\272e8Z\347\343p\324\231\013\207\306y\333W?o\373p\236\246r8mS3\336W/\021\356:6\257v\272\316\253\226p\217\25549\203\325\032\311\020/\304)1\351\030\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.17.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"m\t"
+	.string	"vRC<0\345(\035\200\213\007\323\253\007\315\321\245\024\213:\334T\310\245c\303\375\2502\345\020\215\355\365\037\237\215\0061\230\215\202\330L\030\030h\002\2059\017W\006J\302\351\t\217\264\275\311\226)\0051"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 H.\375#Q=\304\244\303E`\367\233p\344\245k\311?\313\261\224\017\001\251\225\351\252\231\330]kj\345q\303\333^\260\375`\337\001?\206\251\025\252\257\2212\001\016fvU\257\002\013 \306\240\330&\331\033\333\252\366U\276Bzk\364\201]\326"
+	.string	"\230\335\257\301\f\331\243\277\027\310\307\354\001\320d\273\342\256\317\313\006\247!\037\025&\030\343.^\266\213\212\360[D\031\331\311\243?\222\217\207\006%\255\223\276\354\317\244P\304>\266\273k\310\262|+\232\007\324\ty\240-\263\207c\321\331:\315\233^\247\211\266\216b\202\266\316gz:or\020\314]h\335\fq\\77\337\336\022*\234 \2077\212A+\224P\002\004\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_serialSetMode.18.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"u\n"
+	.string	"v\024I=0\345(\035"
+	.string	"\276\334{z\271\224S\200\234p\251oQSj\270A\374\022\2066\260&\2525\334\3077\335 \006\343\025\224\354\206\201\001\f\264\026\322\242E\232\314\350\b\035O\032\331d\357\224\0024"
+	.string	"7"
+	.string	"8"
+	.string	"\f^\340N=\276`;\345N\260\235Z\264c>\206\354a-\215X\200\335\255\023\344\342\245\350\037\366\215j\205\272\324<\354\256\245j\305q\317\333V\260\355`\277\006?\275\353\3274i9\245\257\331f^\016Nv7f\003VF[Z\266\317\261-\307\227\210\177Ux\263\353!\323\300\235&h\227\366GN\"\336u\372\300.Keew\f\035\031\023e[\364\224\217\333\305\360\370(\026\023\246\355TN\003\030\20771q\273\353\361c%\nN\344\264\235~N\026\027\001\256\224\234\331#J\316\017\373\332\356\256'\313\376+]\350\023i\035h\364!\205#\2173\250\023\361\361\300.\254!\330\225<0TG\336GTA`X;\b\376$:\260\222\276\017\254\234q\257\355d\031\002\200,5/, \351\324\246\3454'\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_serialSetCtrlLineStateCb.19.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\n\001\265\f"
+	.string	"F\327TA\020q\233\016\030\0020}_\354I\200\374\301\3030\205\316.)\200\003\356'B\340\257\215@\251\321\210L\017\371\335Q\0247\362\265]T\"\240"
+	.string	"\n-\310\0330\347"
+	.string	"\200/\036E\361\177O\2156\2212\245?"
+	.string	"B"
+	.string	"@"
+	.string	"\323\243;;\307A\023\3730E\303\312\216\335\265\264\304\273K\232\235\377\360\227\222\017t\t\304U\312\230\300\030\t\370<i\301\be\304\303'\207\217$\223\342\354\256\263\344\363p\307\333v`\233c\377\023\237\036\372cL\247\224\376\205\nQ\343\200\216\335\016-=V\024g\240\260}\214mU1\016\226\006\t^00`\275p\303\346i?\345+\272\207DN`\367\204F\214]\220\201\025T\217\006_`z\254\236\tS*H\310\342%\017\333\021\376\302S\355z\033\337\005\206\3543=\246&\270a\ng\361\251vw\343\257p[uBdz\274\306\0246T\204F\262\305\006A\251$\354K\273\273\326\023\373*?u\360\001\234\005\214\013\311.\n\344JN\313\036"
+	.string	"\360\245\221\360\321\321\260\315\3324\254BG\203`\205t><\326\245m\226\006\201\263\t\230fqY\246Y\030p/B4\242$\022&)\2354\252S\035\240\305\007Q\006\005\345\b\305D\206\332\023\032"
+	.ascii	"j\231\"34\030\271Y\200\330\rJ1\313\032\325,\b\214#\304\"\023"
+	.ascii	"\206R;b:@n!pL\b\353\032\233\016\343yU\016\\\001s 0P\"\030\021"
+	.ascii	"\240\242\210\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialSetBaudRateCb.20.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\t\001\255\f"
+	.string	"\366VTB\020q\233\016\3600"
+	.string	"\027\344\222\037Tp\315\223\212\036[\271\323E\262\360\222H\313\013\262\262\231(\320\353\3459cQ\0247X\316.*\021P"
+	.string	"\205\026\364\034\2160"
+	.string	"\240+\017qf|\373n\264\211\224)\005?"
+	.string	"B"
+	.string	"?"
+	.string	"\217\356\354\031\007;\354\303\025\025Zj\354\256\245\034\336]\322\354\374\207\307\240|\240K\031\256\322&E\305\b\300\347I\007F+\032\036>-|'\231\324\307\356:Q>\fw\274m\005\266?\354\223\004\007\377\351\241?J\351\324\3641\224\b\030\034\032\273\027^r\254(\272\370\240\261}\226\017\201"
+	.string	"\353\205.\t\022\224\200\243\363\264O\342%\272\207>\027\260\253\362\202\305.\210\300\006\252G\203\0370=V\337L\001\316\246\324\220P\206\2277l\213<EV\355z\035\037\305\204\007%\323cj\201\030\336n\242\244\332\335\216\337\302A\250<|\246\307k\004\341b#d\222/6\bJ\335`_\332\335\265\252\330g\371\251\\\004\214\033\311.*\344JN\313\026d|y4"
+	.string	"\361h\330fm\032F\342\321\030X#\036\020\021\353\3226\313\203\343\314\001\246Y\\\226i\226\006\334\217\020\231\350\211\224IJ'\215\352Tw\234\b!\242\240\240\034\255\244\264\320\033"
+	.string	"j\231\"34\030\271Y"
+	.ascii	"\330\rJ1\313\032\325,\b\214#\304\"\023\206R;b: n!lL\b\007f]a"
+	.ascii	"\315a<P\"\030\001\341\202Bp\031\030\021\240\242\210\273<U\223"
+	.ascii	"S4\265\007"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.21.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"}\t"
+	.string	"v\022B:@\3056\035\340\005]\363\317@\327\022\3202\307\277#\t&}D\277\200\321\215y/9GS\3428F)\245\300\245\2048\216\202\373\312\235\0175}\031\340\027\214?n#m\313\235R."
+	.string	"2"
+	.string	"/"
+	.string	"7\250NY/\250N9\264\005|\f\331\203V6D\246\335\275\024\344\341e\350_t\001\261\303\271\264<\354\256\245\330\351\270\365\266\025l;\330\327\024I\304\366/\266\325\344\240\360!\253\314\201\315\360\020G\273\213q\203u*a\312\321\302\304pi\177\344$\341?\016p\202]O\311hw\304x\301:\3451\212\341JNU\225jo*\344E\313\023\224\222\206r\354\221#\365\303\376\334\335\265z\354\207\376\371\361\327\177~YYH"
+	.string	"\020N\273\034\247\001[\n \267\3512\n\0031\315\3242\016\003?n\263\234e\"\260\315\323\276\353\3634\212\315\323\\\334\206I\\\231\367]\231\003w\023\232w\201]\347]\227q?W=\206H)]\004\016"
+	.ascii	"2\241\017h\340\341\302\033\327\200\001\033\235\022b\300\225%"
+	.ascii	"\214\013T!\270\f\214PPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serialBeginWrite.22.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"E\013"
+	.string	"6\025NB\020mj:(<\202\360|\211\005\370\f4\316\345\241a2p\224.c:\257~\273\247K6?\203L\027^\374!Asz\353\034<"
+	.string	""
+	.string	"p\005\024"
+	.string	"p\210p\036"
+	.string	"\f\004\213\302AD\310\322&[\246\024:"
+	.string	"8"
+	.string	";"
+	.string	"\037\035\354S#\016\250L\354\256&\033\034\374%\025\364\217\272D$~~-\270\274(\243\013,\0131\2746X&\006G]\021\210!\325\210\307\356ZE\242\202{\336\366\207\355\016\373\226kI\262\177\372\247T\253\252\037\211t\370\220\001b7A+\305\256\346\006\b\023\333W\373\021.\001\374\311\363\213]\022\206\f\273#\2075\262O\217\307\300>\263S\260O\2036\211\336`*AR\"BEa\273\273j\223\355\206\027\277\202\201\257\203}\252\254\204\360\200S\350d\273{\361'p\nd\017>}\017\366y9\305\022'N m\331\343Ge\311\376\265\273\001[F\203\341|\032.s\306\002"
+	.string	"\303y\333\247}\336F\200\363B4\r\207\t\240e\274O\263T\334\t\330<\215\323u\2366\031\367\036V \031\272$:\245U\272\302\002\207U(?\3122\2154HY\262\003\021"
+	.ascii	"2\003\302\360\314\302\242mP\210YVh\253q\310\034c\002VjGL\007"
+	.ascii	"l\231 \nF]\302jV\243\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_serialEndWrite.23.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"-\013"
+	.string	"6UM@ M5\035\334\332\006\210\001MZ\004O\020\\4w\002\0031'L\344\022\314[\007\302/\002\205>\215\323\243\215\025\003\001\022\023\020\220\310\302\265\234\347\2064\377\f\350\253|`=>\267\245M\266L):"
+	.string	"8"
+	.string	":"
+	.string	"\037#\354O+\005(\022\273\253I\b\007\177I\005\375\233\016\001\211\235_\016./Ih\203\252B\f/\r\025\351\301M\327\005\342G\365\321\261\273V\220\330\340\236\267\r\3006\207}Jk)\262_\372\247T\253\252\377x\260@`|\330e\3202\261\251\351aB\304\366\325>\205W"
+	.string	"_\342\334bW\244\201\303\356\270\341\214\354\323\343/\260\317\354\022\354\323\240=\"\316`*\003\234D\204\312\262\335\035\225\311v\303\212\217!\301\267\301>UNB\330\300/l\262\335\255\370\0264\b2\t\237>\007\373\274\234\342\211U\311\243-{\354\250\034\331\277v7\333\005c\321|\030.\363\2052\300\302y\333\247}\336v\200\363\004h\030\316B@\273x\237F\231\270+\260y\232\246\353<-2\356K\244<\362sAtJ\2534E\206U*\224\035U\221B\035\244\034\331\001\021"
+	.ascii	"2\003\302\360\314\302\242mP\210YVh\253q\310\034c\002VjGL\007"
+	.ascii	"l\231 \nF]\302jV\243\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.27.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\345\003=\033"
+	.string	"\2462\256H\260XQ:\320\001\030O!0$2\305U$%;@\002\305Z>\034\371\207\332\242,\024Q\343\023v[Z\\OI|\365\301\016\230\217\352Xh]h\275qc(R\271\013\374\203\303\370\364\214\003\330[k\204\220M\344N)\223"
+	.string	"\237"
+	.string	"\224"
+	.ascii	"Hl\213\304f\306\301\234\367\335n\004\350\306W_\020yN\373E\236"
+	.ascii	"\204\273\021\240\003\250\325hI\260V_\316\251[\345\251}'0\236"
+	.ascii	"\226\0270\236\332\037b\373f\207\271OG%2\316\016s\263cA\r%!Sk"
+	.ascii	"u\235n\016\257\311\341p8\274\350\273\307\305\235\034\251\270"
+	.ascii	"\263\304\371\007>\305\242\027tr(7G\325\217\030\2476?`\\\024\311"
+	.ascii	"\235\213\0365\275\235\030A\030\325\364\340'\257\247\233+\340"
+	.ascii	"\263\300K\262B\255\325\317\311\270S\267}\303\366\005{\305\004"
+	.ascii	"\363\276\377\003\256\200F\255.\206fj\021m\362q\246S\261\fGg\303"
+	.ascii	"B\207\004\025Uu\276\226\355c\331\211\006\254P\372\361\\\247\207"
+	.ascii	"\362\265\357K\371\223\317\2378'\210\020\037{\305\344N?\177\342"
+	.ascii	"GA@\344P\334\340\301\355M4\234 \233*\364\005\252\301\203\237"
+	.ascii	"7\321n&D\231b\241<\365\231\276\304\017\336I\023\333l\001}'Ml"
+	.ascii	"\025\204Vd\020~\211\252\325\327:5\205\362g\372\300\233\275ZY"
+	.ascii	"\234_\272\371j\217\310b\222+\341\256\304N\242M\325\341h\021\254"
+	.ascii	"\265J(Oq\304\235\377\005<\246$\215K\356\301\f\235\361\263\324"
+	.ascii	":\370H\276m<\0357\025\204\2117#7\207t\225H\331\365D\313Fq\037"
+	.ascii	"|\200,C~^tSh\002\363\353]q%\024\3516\310\303\261|\200B\001\242"
+	.ascii	"g<\335M\260\343O\016q+\"\312Zu\020\374*)^>\022l<\235\373\247"
+	.ascii	"/8\242T&)7\207\336\213\265\326\272{\344}\004\035\302\250\271"
+	.ascii	"F\336r\024\016}x\215\354\377\376\232/\3754\254\325\227n\025\315"
+	.ascii	"t*5]\212\323$kz\244\253iQ5\275\251\351$`\323\304k\261\037\031"
+	.ascii	"\214\276"
+	.string	"j\257\021\342\016,\366\252\321b<\245a:%^<\263\035\232\2136\3339\3013\033\341\212\361\274z\\\260\031\315\245s\3002\023;3WM&\233\271V\266\347\327\bx\fe\260\344V\210\334#\223T\312\032\027\220\262\226.\317bI\2634B\272Z\325\362ZW\355\034\363\273\262\247\200Chc\334#\333\fN\227\265\244\026\025@t\256\332U\316\030.*j\b\315\241\rLr\277N\255WE\273\r\322\360.\033b R[\300\213\223C|KOYk\205\340kI\301\001h\357\364\007Q\250Q4\246\034\"\304\231\t$\222\231\031\247\003p\002\231\272\272\r\020hH6\035k\372\201P\002\207]\364A\311\\M\212TV\234\300\217\n(0\nF\267\210\265_\222\007\303\002\22784\320\240 \276\231c\220\240mZ<\201F\335cA\3420H\2773.\323\202\t#\326\003k\031\326\030\220P\037E\211\242l\201\220N"
+	.string	"\225\237"
+	.string	"\224.E\203KA\264D\b4\322\342\322,\357\327\214\304W\204\210/%\316d\360\025{Q\210\374t\221\224\330\234"
+	.string	"\317;\345qx\277p\003\302+\032\215\016\266y\326ku\206v"
+	.ascii	"\323<5b+P\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`&\001\335\006"
+	.string	"\004\t\"\002"
+	.string	""
+	.string	""
+	.string	"\002\033\177&\257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \t\177'\360\372\2508\272\200\202\n\177(\200\200\200\200\004\013\177)\f\177*\362\375\231\027\r\177+\016\177,\017\177-\020\177.\021\177/\022\1770\023\1771\024\1772\025\1773\026\1774\027\1775\004"
+	.string	"\265\006\004"
+	.string	"u\004\001\221\205\327\307\003\001\225\001\004\003\225\001\003\004"
+	.string	"\342\001\004\004\303\376\236\020\005u\004\006\007\b\t\n\013\321\231\263\346\002\f\003\r\004\"\004\016\004\017"
+	.ascii	"\" \360\242)\235\003\025\3017\031\234\307T\350\016B!\2270\"\302"
+	.ascii	"\220\313\223q.\340\340\247\271\232\301\361\225;\344\314\205\241"
+	.ascii	"\207o\374\206o\374\206o\360\033\3637\354\033\242o\370\r\0311"
+	.ascii	"\377\263\021@O|\276\303d\346\340\214\001"
+	.text
+	.section	.gnu.lto_.refs.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.39e314b778b2af43,"e",@progbits
+	.string	"(\265/\375`\b\034\225u"
+	.ascii	"\272\274H)R0R\312I\007\252\372\377b?\027&\233~nf\342\357\366"
+	.ascii	"\367N%eU_+\377U\371\361|\334;\033\315@MM\337\314\372\214\230"
+	.ascii	"\270\241$>\341u\305tww\317\003\357\276CU\211DT\204YuF@mUZY!]"
+	.ascii	"\375s\306\35166\2212\005!\002|\002\225\002=\374\343\353"
+	.string	"\035\324\363\t_\032\215\362\t\337\361N\227eH\026[\333\027\251\023xa\323\211s\302C\263vf\333\311\222R\347l\313]\340\232\264\\\265e*\314\305L\024S\027.j\351\221#3i\313Y\355\006Z\245\f\254-ka\261\03346\265\271,>6\2474g\332r\020\\\205W \266r\276\302X\216s\\\357\363\336\225\007\007\316\316\212\254m\t\376\361\331!\365\f\344\343\211F\243Q\006\362\255\240\376\214vv3\267\245\0246\345|\306\023G\207\205\244-\233\261\230M\223\036\305\266,\345u\"\360\3264\367~\305\352\240\362\265\326\366%\250_\317dc9Zc\2728\241\234\307~\n.\370\230\337\275`\367^\0229[<\210`m\217w\034\234\266\274<\262\266?\213\375\374\305`\374L\221M\315Kv\357\352\223j\311\301\205\253m\230\335!\305\312\226\266\357@\345'\354d\275#~=\264v\204i{\n\3243\020\037"
+	.string	"\353^p\035\365\255>m\345\037\237\312\001\370b8\320\302I\374?\3014\340O\177\026\340z\361\037\312\317&>\366\234?m\261\364\233?E\341\377\332\317\n\260\251]\261\370?\346g\022u\035\374\317\373\031\001=;+\r~\346\237\023\350G1\370\277\345g\003.\370Y\304\317\r\374D\374i\005\0160\203~\346\371\371\200\236\b~F\022\371?\345g\006~6t\236?\r\340\277?}q\233?=\361s\f?\377\374|\202\005\036"
+	.ascii	"\206\367\374i\002?s\375,\344g ?_\375\354\343g\253\237y\374\274"
+	.ascii	"\343g\252\237\231?K\375\274\364s\324\317P?;\375\214\343\347\373"
+	.ascii	"\363\016?\353\360s\016?\343\360\363\r?\333\360s\r?\303\370\331"
+	.ascii	"\306\3174\374\f\3643\321\177\265\377E\377\345\376\333\375\234"
+	.ascii	"\363\337\305\3173\374\307\362s\215\237\207?#\375,\374Y\206\237"
+	.ascii	"i\374|\364\263\321\3173~.\372Y\306\317\300\237\207~~\340g\241"
+	.ascii	"\237[\370\031\202\377)\376s\371\357\023\215F\243\277-\372\323"
+	.ascii	"\030\377\017\004\001sq\366H\0304#-\245\231\276&oA\324\216\250"
+	.ascii	"\267]=\366K\362\344T\304GC\261S\352m\016\365\226\250>\275S\237"
+	.ascii	"\312\255\007\302\306i\344\t]\033\317o\315\327\333\225\233\372"
+	.ascii	"\364\212\372\224L}\372\245>-\242\276\215\177|=\264\022/\233T"
+	.ascii	"\245J\020\035=\264\227\317\215\311\205\322I\336^]gB\374h\333"
+	.ascii	"HXL\364\254\313\225\266)\016\365\215\246\215tMi\025\351\300\250"
+	.ascii	"\347\265\213t\251)\302\326\345\3664\304\325\302\325C\226\\\201"
+	.ascii	"\001\323CZ\210\222\031\226\246\266\353Q\307y\227\206\252mPC\365"
+	.ascii	"\324\032\264s\364\022\207Q\f\264\223Z\251\223oqQ\030M\215\223"
+	.ascii	"I\363`21dY\032{\3416f\317=\206\241q2i\302d7\214Q\350\337?\032"
+	.ascii	"\253\265:\253\255\332G7\273\252\267\032H\367\350 \274\366U3\337"
+	.ascii	"T\275\343#\326{\217\367\3363\330\2316\252PR\342(\275\325A\333"
+	.ascii	"\230\f\357\335\030\315\004=\365\222\333\230\353}\3121z\201\312"
+	.ascii	"\333c\260\237\333X\b\206\2220\"\257\r;\003\225\347\303\275\353"
+	.ascii	"+\370\331\314U\037\231\213\n%\345=\2069\321\340\207\232*@\354"
+	.ascii	"\335\273B0\002\0025\2518\006V\200}o\251\276\313?\276\267\265"
+	.ascii	"\216\251\226\332\301\353\241d\253u\274\245T0{i\226\332v\024\213"
+	.ascii	"5\227\225)$\315\224\2257\327K\352\371n\331J\246\232\"kNo%g\371"
+	.ascii	"i\275\021\311j\353\226\354&\n\340\234\311\276\361nj\246\250-"
+	.ascii	"O\266\3326\262\227x=\240q\244\304'\027Lg\315\2225h\324\324\363"
+	.ascii	"\001>\216\362\001>4\265\207\231\250\177\033\273\250\232\271\022"
+	.ascii	"eF\315\273\330W'Mj\310Y\333\276\315\321&\276/\257\371\035\327"
+	.ascii	"\276\366\336\"\263\211\035f\0236W\272\212a>{V\242\036\217\323"
+	.ascii	"\374V\342\035\223\006\rN\2319\271\343\272c\344\341\004\302C-"
+	.ascii	"\261\247\247s\326\343\b\220\274\263\236%&\255\251i\313x<rI'\325"
+	.ascii	"\335S\226\264e[\266\343\321K\336\301)U.s\373\244\251\223\026"
+	.ascii	"\245\326\320\332\236\221\320:\021N\226MT\306\234\353\254\222"
+	.ascii	"\020\\V\3322]\216X\030\216h[v\3439;\250\272\346\234\334o\007"
+	.ascii	"W\336\226\270\263\\[]\246c[\036\342t6B\236\210vb,\020H\230[m"
+	.ascii	"\371\215\277\360z\202\301\234\3418\314m\212\353]\233KMYX\333"
+	.ascii	"g\242O\233\243z;F\375\373\367\335\242\362\336\373d\263^\245\361"
+	.ascii	"w\266a\006\372u8e\005\376\333\233\376'@\306z\211S\356\356T$h"
+	.ascii	"E\036%\356\337v\357\021\213\350\001\326\362\2105\205|b]\342\261"
+	.ascii	"\b\321Gy\261\210\310\347\275>\367x$~\320\274>\310\347]\336$\267"
+	.ascii	"%\337\025\213x\217\315\353s\217\267X\002y\304Z\"\237\305\245"
+	.ascii	"\017\362\211\265\274O\254\333s\217E\345\322\361*}\356\023\213"
+	.ascii	"\314}6\227=\310gs\211|bQ\261\025\022\256\313\322\354.\213\212"
+	.ascii	"\227\310\343\315\221\254**{\332\220k\363\212\271\227\311\224"
+	.ascii	"\256R\201{\253\232J1\305)N3\266\3450\232\025\233L@\322\230\325"
+	.ascii	"\274\3076d\222\346\275I\214/\334\244\005\304\265\355\n\3416\342"
+	.ascii	"\217\252\333\244to\001\311{\211|\333\356\275\304{\357\215\262"
+	.ascii	"j\275wG\017\322\231L\336\313\034\221\274UD*J\3676Y\\\332\022"
+	.ascii	"\371\314j\006Q\201\362t\336\033+\221\235W\f\226R}\022\235\334"
+	.ascii	"\246{/\333\251\316%T\031\262\261T)\326d\365\302\246\372\340r"
+	.ascii	"\363\202\326\375\364\360\264\346\332\002\235\304\"m\237T[A|\307"
+	.ascii	".(\255\266M+\216\262\r\216m\251\\\261\314\206\210\266\275\301"
+	.ascii	"[\257\220SR8P2/-C\204\254\"\232\334e\225<2\2405\253+x^\372\207"
+	.ascii	"\034^\336\0354\347\213\262\231d\307{<[P\274\2622mT\223\307*."
+	.ascii	"2\314\205\252J\030=h'\243[Lu\214\346\3632C2\006H\307\f\234\321"
+	.ascii	"\007\2729\236\257\250"
+	.string	"-\"\227\007\207\n\032/\035m{\210\216{\313\265\230\333r\0264\357-\266\034O\232{\213<\314&\230M\330\037\262\214D\361\331\333g\230\251\034&\315\257)80V\311\020 YF\330\370\340\024\223\372\362\206\203\311\035\332\372sr\342j\272-\347\216h\211j!\272\315j-Ck\033&\3426![k[v\244}p\n\033\002\305\002\326\303\371\345\303\371C\020'<\240D\332\231\343\255\253\227\374AbM\026\345-\371t\n\212\322S\240\2148\312x8\035\027\330\023\316\262s\354\271\307\254\035N&Vf\322\272I\257LoU\320\264>k\246tu\336\214e\031\201b\t\343,\251\023\245:\026F\025D\2535\226\366\322]z\255\331\332JWi.}\245\251\264\226\336\322h\235\205\327Nc'\235\326e|\267s\\\3572\307\330\264\363\204HrU\300\336.\231bF\346$\300aP\370\202\310\b\204\0253\202/\264"
+	.string	" \006\213"
+	.ascii	"F\264\320q\341\203\004\034\326\260\302\206\n\"\030\005\205)|"
+	.ascii	"hg\002\t\206B!\032\022\310\250\261\342\347CA!\320"
+	.string	"\b\350\202z\013RD\220B\205\215\233\253\310`\202\f&\360]E\006AA\031\244\bR\237\"(\025\n\2750d\205\300\240\214\340\320\bH\024\314\231\301\007$:\232a\2010P\320A2:\n\016i\034\335\304P\2016\004[\250CU\370#\022\002\216P\024\024rac\370\233!\b\034\032\221#4\024\372\300\206pG8L\201\204\237\030\206\204b\024\025\t\261"
+	.string	"\026\021\005\177\177\201\304\217h"
+	.string	"\205(\206GGB\024\"\210\214\200*\260(\206\220\013\026zD\270`\024\034\006\205^\330PA"
+	.string	" P\030\202\r\027EB\303#\027C\030*n\210\204\200*\344\264\360)::Z\001\303\246\206!\215\031 \b\2012d\324X1\f\316@2\022\022\272h\201\0244"
+	.string	"\bCxD#\007Htd\302\020\210t3\204\221\"h\330\002h\024,\241H8d1\004\"\0010\204AA\005C\243`\r5\006\013\340PH\005\242\032B+\206@$\035\0315V\320\240\016\221`\f\205G)\374\036\024\304\242\304\n'\210\240\016IP$\024\024\002\221P \t\2013\004\205D(\214\202B3P\f\t\221PH`"
+	.string	"p\030\024\2760\n\272"
+	.ascii	"\214\221\323\225.\221\231\351\320\343\342\3421\365\232\321\343"
+	.ascii	"AF\306\212\020!<&\267\263d\212\361\030\226\225\225\002asj0\366"
+	.ascii	"\205\271\365\024\310\215XRMT\333T\353t?\254\033zk\332\246?\234"
+	.ascii	"WW\3146\305\206\351\266\244I\225\352\303\007\327\251\027\314"
+	.ascii	"\251\246\312\356\207\266\367\031\325\324*\265b=#\320\237\230"
+	.ascii	"\326\223\032\236\312g\370L\027\325+\200W3\016\313\036[\231.N"
+	.ascii	"m\373\330GV\343 \314\312\367\003/\354\253\255\222R7\365\275\307"
+	.ascii	"\353\274\201\222\305\3440]_emSf\312l\345\033\223\223\307\315"
+	.ascii	"\313\017\2567UJ"
+	.string	"\252\225\274\006jdb\035\317\324\206j\250\226\352\271\306\271-\351\2321dn\333\3452\205\302\271\267x\231\033$1\203\346$!CdK\372\364\024\n\007\b\\\262\251-X\323\233R'\365^ezo\0170\247N\020h\305\2734\307S'\245\324\032\245m\232d\261\237\224\261\250[\323\361(A\303\004\347T\217)\216c\272\344\273\227\327\246\223\3622\225@O\213\251\361i\322\232&\245K*\361*\211\353ub)\3208,{\227\311\004\332\361\212\"\336\024\371ti\313L\020Vm\323\033,\226\343\204\007\207\244m\252\324_t\242\001\202W\250b\3718\307\362\030\"D$\"\"#I\222\016b\013\020\004\203i\332j\347\001\022`\023E\221\202\222\231!\022\021I\222\202\244\244T\350\323\024Ju\304pv_\210\307A1\270Ay'\311\220\235\331\002\201u\230u\344\352,\240\001\273\255R\005\315\266d\373\334\33374\313\261"
+	.string	"\225KD\262\273\\"
+	.string	"\240\004a\370\374\334\314\306\273\325x\331"
+	.string	"`\013Ao\332\307\222H\224:N\264\261\345\314DjN\214`\364\272\331\233\027\004\330\377\\n\342A4RW\260p\306\200\231\216{\207\330\202P\230\203\257\t1\306\300n3\312w|\342\3177A\213\370;\2149{xkF\025r\225\326\037!\221\324"
+	.string	".\364+\216F\220\253\233\030\370\255\t5\341\tM\033Q=\341X\234\215\313\256,S\032\202\024`]\001\n\320|#\177\373\026\017K\356\020d\256D\261F\030\354\376\324R-\324\261\020\315i\270\256\n:\242\272\276\224,\243^\f\257\274\230]\353\355mcG\247\257\264o\341N\273A\007J\177\002SCnB\231\ff4x\365\373$\255p\2021\331\335\t>:\205\016\335\243(\246\233#YU\214\216\374\306\234\fZ$Z\311\024\265X\2505%;Y\352\"\356\236sh\245\302w!\277l\300\330R\3358\231\334\323!\337#rNo\023\320\031\023\017\214{\336\005\324w\356\316\245\370n+\203\353C\356\300`\344.\260\2577\017\202\001\177\031\267bz\263\2502\237\206*z4uB\274\b\025?\222\312y\251\340\267\267"
+	.string	"}p/\031~\367&q/!\r%"
+	.ascii	"{\263\201~Q\301\007\311z]\307\200\002X\027\023B\214?\255\026"
+	.ascii	"\3467\214\272\372b\2136I\376\216\211\251\316\314G\374|58\033"
+	.ascii	"\327)\265\223\255CLH\254\377GZd$\013y\375\214\322\206\300\276"
+	.ascii	"\331j\007k\337\333ff_W\337\221\302\300\013\327\266\360p%\202"
+	.ascii	"\317\354\230\t[\002\216\263\217\354\342vx\207Y\340\320"
+	.string	"\202C\\\223C\370}\013\336\3334\274\373\267zA\251\230\224\301\034\266\370|V\3164\037C\332\270\226\261\236\366h>\317\331\024\001p\004\353\357v\177o#\003\254\334\306\370a\224\200\317\262r\f\206\001&dX\034\234\017\001L\f\024v\004\266\317\341\341\217\251\323\331\301g\337C\341\274\r\334\317\231\241\2666\202\200][ \232\350Yp\341\016\206\315Aq\247\004\204\317\327fy\310-3\006[\335\007\322I\2328~H\0374\b(a\t\002\237\331\323\241\244O\363\377\2777w`\202\3406\021\017\270\345\\c\300j\"\222\001\024\311&-\2612X\202\270\005m?\230A\364\036\222e\0018\003\016\226]\243#B\366OB\227\306f,\376\350\211\366\2467\237V\004Ev\025,0\224lf\023\2322wNL=\321E\320\217\251\242Y8\036\276\247\345\374\001\257u.\003\210\312\314\235\301\204P\345\211\021\270\307?\001\374\035"
+	.string	"~\270\303b5\325T\364++\211\024\271Y1\314\346\310\r\247\204 8\263\2448\334\364\002\037\370\336Q\204\366D\026\205y\350_\300\230\305\361|R\f'\346ko\006z\240\314d4\201\313\275\335\036@\231;\017\333\314:\364!\231\354\227\232M<+\226\031\306D2LT\221\204"
+	.ascii	"\020\313M8ZD\001vw\r\350!\213`u\025\b\313\201\322L-,\002\243"
+	.ascii	"[\f\327\356\263\263\230X\211\307\304\254 \356c\207\233\033\274"
+	.ascii	"N\240\344Q\271\353}>(\255\341\313IN[~\022\253\325\3540\230\216"
+	.ascii	"-\372\237\360Xc\367\374\261z\360\251\377\3211\f\307\230\345\030"
+	.ascii	"\353\352:\376\375\240\215\343\355\324\341g\353\211\2636\276\374"
+	.ascii	"O?\303\235\374\271\3453\202:$\210\357\2115\275\273\024\235\257"
+	.ascii	"\272;(\312\nk\034@\243\275\007BL\\\270zU/j\247\360u\314\337\354"
+	.ascii	"\353\220\257\311\315>;&\203Y\307\3275\002\212o\372[\301\256\347"
+	.ascii	"\311\242\306\276\273\227\307\006\033p\233\035~{\330\340?s\314"
+	.ascii	"Q\311>\364k^\336\326\226T?\335\261\310\255\371\362\f\372\347"
+	.ascii	"\232G\347\221\027\316\276O\302\037]\316\353V)\237\352\017\341"
+	.ascii	"\023\334\264\373\350\217\313\275\025"
+	.text
+	.section	.gnu.lto_.symtab.39e314b778b2af43,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.39e314b778b2af43,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,526 @@
+	.file	"serial_sim.c"
+	.section	.gnu.lto_.profile.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.text
+	.section	.gnu.lto_.icf.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\265\005"
+	.string	"\004\bC\001"
+	.string	"\016"
+	.string	"\242\251\235:\006\002"
+	.string	"\002\001\001\342\321\355\227\b\b\365\236\247)\004\003\341\276\353\330\016\n\002\002\002\003\002"
+	.string	"\002\003\002\004\002\004\233\261\346n\f\002\005\330\370\237\370\004\002\006\212\334\340\211\007\002\002\005\002\003\007\374\334\317\216\013\024\002\003\006\002\006\003\002\003\b\240\342\234\212\n\t\322\324\273\311\005\020\007\002\007\n\263\215\216\241\004\036\002\b\013\262\337\324\216\007\f\344\374\302\241\b\002\002\t\002\n\r"
+	.string	"\026"
+	.ascii	"\\\266\360\334\021\257\204eU;\317\266hvU\274ps\001x\340E\017"
+	.ascii	"\271d:\255\025\265\267\322B\314W/\002\370\f!&yP\254Lbv\304\027"
+	.ascii	"`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375 \372\225\003"
+	.string	"RD\017\032\2405\351\377\377\377\377\317\253\252*\310\\Rm\"\334\031Y\333F\273m\271e\n\033\365\3057"
+	.string	"\371\233\321\351\021\003o\315\005,+\333\023R\261\226\204\260w\020MIh\307UT\3719\020\027"
+	.string	"A\257\257\0036M\r\230;!\246\201i\n\001\006\300C"
+	.string	"\231\0134\216\255j\007\027Vq\256"
+	.ascii	"x\201\0350\016\f\006\206\3709\030\fS\ts\003m"
+	.text
+	.section	.gnu.lto_.inline.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`\020\0045\020"
+	.string	"\206\026P@ q\232\306\007|\301h\004\036\264[s\371\277\362k`\377\b^h\\-\367\037\016\210m\273W\376x\260Y\301\202\357IN\215\013B\240\003"
+	.string	"\003\n\321Ny\362\020IBD\310\260\211\220-\345N\0017"
+	.string	"7"
+	.string	"E"
+	.string	"\230"
+	.string	"g9vb\347&?:dhxWo\371A\305\n\030\321\323t\302\341\231\275\363\334rw7\372\007\273\033\341\251_\206uu*\337\372\343R\344$F\t\365\325\020\f4V\324:\243\016_\214\360E\n\211\3125\0240\227\021\3034U\3515\325KU\345\352\220\223!v\227Z_Ki\215\335S\22013\315\270\273\033\244~\261\213\335\356^\277)\nxBJx\006\374\261\246\263\246\003"
+	.ascii	"zZ\2205\272\034\"WH\364\f\264\203\007\026\034\022\350V\203l\241"
+	.ascii	"\300c\006\202\245\350\317\177\233B\007\316\362\314\23197Z\362"
+	.ascii	"\031\271\361\306h\252\"RH\\$\b\023\001o\300!\341\344\332Z\323"
+	.ascii	"\321\341_\020\206\324tG\313\307F\004\362H<N+\250\240\270p]\301"
+	.ascii	"\t\0169\035Aa1!\360\364\006\241\257\204\360\226\236\026Y\351"
+	.ascii	"\200\243-PXL\f|Q\013'@<\325\204\021=V\002^\250\321P\210\030I"
+	.ascii	"\205\005\2116\016\300\242\022!\363\022@e5\346QFD\204\"\221JR"
+	.ascii	"F9\311t\234>\b\371ZZAv\b\366\317lr\262\266B\202\273\246xY\334"
+	.ascii	"\253\033T\004;\233\216\244\376<\036\252\247N\004\314\004\003"
+	.ascii	",\\\323\023\355\314kO\362\272\nd\241\035\204\267S\002\247\377"
+	.ascii	"\022\272U\305\316\343+0H\200\241/P\304\2126d[\017\035\261X\205"
+	.ascii	"\035\202Gc\234\200\tmi^\275\360s\023Z\373y\306\212yA\353Z\323"
+	.ascii	"\035\216T\327,P/\2162\206\236\022\314\362r,\312\322\201W\021"
+	.ascii	"\005k!\210\\D).B\244\222\210q\252\277\260\343\370k\253\214\332"
+	.ascii	"6\274=8Mm\340\2529o\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"]\004"
+	.string	"B\b\030\037\240%I\007\377\377\017VU\325\244\252\252@\340\0371Cx\tkm\313\304\261\202l\273\267L;T\016k_\243N\265;\374\370a\001\214\2015X\303\026X\002\"\371\033\034\266\b\022%*O>\216>\216\237l\bm\310Dv\330c\017\033\360W1\316\004\n\266\330\342i\305\326\027\237TO\206>\004\020"
+	.ascii	"C\224 lW(\317\027,\220!\006\204Kq\032\212\211#\001cKV\333@g)"
+	.ascii	"\240\264.\305\202!T\306)\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\205\004\001\205\004\002\205\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\t\232\004\n\232\004\f\230\004"
+	.ascii	"\r\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\215\005"
+	.ascii	"b\b\030\036\240'\351\340\377\377=\257\306U\331\305U\227\370\377"
+	.ascii	"\257j\354o\005g\243\367\005\331\215\020)S\017\336P^HIy\022\260"
+	.ascii	">\321\002-\0030\"\375\321B\240e\320\337aS1E\r{~_\357\364R{\364"
+	.ascii	"\230RfI\345H\371\201\346\247q\354\035\225\3422\377\224Q\346]"
+	.ascii	"PN(\377s<\315D% \260\"\032\245\007e\3061\235\221\375\333W\200"
+	.ascii	"t\233b\033\221\341aq@\234\304e$\030\247\243v=\255K\2305\016\033"
+	.ascii	"4\320\232\304\003PBY\036\216\333x^C=\203\005\213\213\254G@\n"
+	.ascii	"\217\b\245\334\r\315G\306L.\260\262\257(C"
+	.text
+	.section	.gnu.lto_.lto.3474624caba0cce8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_simVTable.9.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375 \341\235\005"
+	.string	"\224\t\247"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}{y\212\001\202\200\200\374\342\303\354\202\005wu\270\354\302\tsq\370\347\242\007om\270\347\262\005ki\370\346\242\007ge\270\346\322\007gc\370\345\302\005a_"
+	.string	"?\202\210\200\340\001][\305\001Y\304\001W\303\001U\302\001S\301\001Q\300\001O\277\001M\276\001K\275\001I\274\001G\273\001E\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_sim.c"
+	.string	"\013"
+	.ascii	"\200\024@\n \005\220\022\223\0243\351A0p\002\372\246,\215\201"
+	.ascii	"\""
+	.text
+	.section	.gnu.lto_serSimOpen.11.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`\267\006=\036"
+	.string	"\226\263\273H\200\234Q:\037\312\357\316\256\256O%\212+\265r{\373\357\003\331\004\342\226\025"
+	.string	"\356\326\331\367\345\260\337|\304\006\212S\037#u{\032Kc\375%FP\273uL\337m,p\322\335n;\342%}~L_\263\233\220\275e\n\237"
+	.string	"\237"
+	.string	"\261"
+	.ascii	"u\362\027\263\312\221\377L\177\317\377Y\327\212\253\036$n\024"
+	.ascii	"^\b\023J\257\f\220\177A\246l(\267.& @\376iQ\025\331\332N\\\264"
+	.ascii	"O\316Vt\276rN\016]\001\255\315\327\372\367\261\221L\235<\330"
+	.ascii	"yr\006r\374\3129\017\335Fk\323@\371\377\315\244\213L?\005$\203"
+	.ascii	"R\021\260@=IsN\332\236l\240\333&\255\177n\233\026\253\317.m="
+	.ascii	"\337M]6\310\341\205\002o\264-\027\260\241B\326\200\276\262'*"
+	.ascii	"L\223\226\322U\006\360W\353LB\316\371\025\005J\365\315\376\177"
+	.ascii	"\341?\376ge!zK\357\200\031-\270H\230\005KNH\034\353+FA\301\234"
+	.ascii	"\237\032}[i0\021\345\b\243\333\250\321-\321U\214j\301\337DS\301"
+	.ascii	"W\t1\347\314`\327_\267\021G\210S\332\013\367.\322\346O\344j\243"
+	.ascii	"m\276Q\3346\023(\361\205uMY\254\2464d\266u\267\355\221V\227_"
+	.ascii	"\235\363k\333\006\215\370\302\270\3568\325\262?\331T\355\325"
+	.ascii	"\337e\3169\337"
+	.string	"Z\375\257\027\352\256\356\001\r\245;\250\243t\003\365V\367O;\351\366\351d\367}}\311Soy\352+\255\276\tX\024\212\013\310+\347\250\262G\036;\210\216@K\252\016^\016|\2158\246\020\030\177\230\324\033\027\263\201\257\221(\005\204`\\\342c\254Q.j\340[\2441\243A\221\214\207\265\377\211\254h\215\201\3570\2550*T}1\241\37628\030\246\325W\235\354\354\251\f\235\252\366\247P\263\2052|\207w\354T8t\224\204\2029\347F\177\f='\203\203!\221,\255v\366$\007\235j\323\277\206\216\003\007\337\254t\354\r-sh6\275Zp\r\276YD5b\017\262\210\035:\r\032|\205\351\0313\036\272\f\031\\$L\307\210I\307\232K\377 \032L\257\026\374\202\257\227.\026\fu\323\273\177\274\024\272\334\222\n\335\f\207\244S*qK\370\003R\017\037\321\360\022\256PCq\303GII\230B\213\035"
+	.string	"\244\\\375\215H)\3073\221\204s;\034\317\306\333\341X\344vH\266\0249\254d\273\355x6\"\003\327\251\300\355lK:\335\316\326\223\314]fk\365\231/\006\224\227\025\262-\245\313\343\026.\257\372>oie\374/\355%8Y_i\257n\344\254\025\301\005fXU\025\211\334\314\256\264\2528D\310\332&[Za]}&\271\377\211\244b\235I.2\31593\020rE"
+	.string	"\231\216\r\020\326 +\200\340{\374\341c\350\0304\254U=*|\003~\250AL\251\240\"\"IAI\212Rl0#\221\241m\003\021\360\030#\b9\206\306\311\260\031l\277b\226\340\265(\307\304\0221Y28\"\200\200\335\002\2400\317\2205s\264\354\232\332N\001$\267\307\242rw\213\276\370\231"
+	.string	"\313\346\241\260\334\274\202*^\033\201\352\243/#\001\262\350\231wN\024\262\334\203\005\004\262@l\334t\177\320\025\021\252\017\342Na\270=\364\344\340\033l\235(\2138q\345\217\037\177\354\251\362\312\030z\334SO\313\377`D\373\214mg\032\255\263\336\331\2063K\257s`\243c\367\252\016%\264\330\303/i\315f\362\375\034,\fsblB-{\252&\320\334\263U\325\001\330 \202\233\357<o\360\333"
+	.ascii	"\033\272$\241B\0064\252r\b\240\321\306\037"
+	.text
+	.section	.gnu.lto_simTotalRxBytesWaiting.12.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`E\001\305\r"
+	.string	"\206\331[C\020\221\223\016\023Z\254\225\003-\273\017\3409\033\326\030\342\200]^\252\020\276\370U\320\205\025\230\327kaE\317Z\035\255\br\324z\204}o\002E"
+	.string	""
+	.string	"\00548QS\221\202R"
+	.string	"ca\353\335\310\336R\246\024J"
+	.string	"@"
+	.string	"L"
+	.string	"\257\333\260qT$D(!\263\333]\037\367\260\016\337\005X\207\252\341\243\303\2479\362O\016e0\250x\347.\254N\233\205\353+\300\271\250"
+	.string	"`+=\017\225\312\214\247\236)\033)S#\262\273\316\323F\341\266n\033\201\355\003\366Y\002\253(o\234\216\357~\215\323P\323O\323\252\351\324\3649\026\b\325"
+	.string	"\032\273\023V3\033\003[t\260-\262;lg\332\177\371\b\321;\223\007\330E\315\254\330\355@|\305Cw\321\266/\342.\"\217\002\372^\2308R\350(Ta*\305\215daC\225\341\351\312FM-\244s8q1\252W\00500J\211\303v\203\233H\005\221a\355$\034\304\335\222\001\037\206\004Bd9\364M\254\303\353S'\260\235\b\361\202\222+\273;I]\261\377\002\037\017\250S\242\201\260hO\310\b\246%`\320\301\262\217vi\331\347\001\226-\270@Xg\344\362d\332\025\362\341\020\311'\273JB\241\354\352\350\366o\025e\255\361\201{\221\343\342!\207n\024j\212m\250\026AQ\022|\032U\023\303\324\242z}\001\033"
+	.ascii	"+\013M\2668\312\0268k\373F!y\214y\301\267#\214T\026\246p\242"
+	.ascii	"\211\217\226\035\220\305\206\001u\260*Q){:K\266\t\3035\221l\321"
+	.ascii	"$\210\330\235\231 \340D m0\bz\200\231\230q\363\\\n\n"
+	.text
+	.section	.gnu.lto_simTotalTxBytesFree.13.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`\274\001\265\017"
+	.string	"\346\035iE"
+	.string	"\221(\0358<\211\241\241\365\025\332\266\356\341B\340\b\253d\317\025\24105wS\3714k\333Y\275\265z-\3631\013\344?r0\252\311\313p\006\370e1\033\236\270\221De\023b\377\315\032\"\204\354-wJ\001S"
+	.string	"Q"
+	.string	"Y"
+	.string	"\037\336\264O\203\232m_\304G\220\\\222\240\207O\263AC\005\230\034\273\340\326y\001\354S\236"
+	.string	"\366\251\035^\372\224\032K~\0262A\254\324@\371L\237*\227\232O\345\032\340K\311\316\356\376\365\230\362\241b\314Bv\327\021\345\313pc\267-b\233\201\035\017\004\246\250,\366\345*\313\234\215\346\340\357\361\227;\323hL\243\247FK\215V\215\216\032}"
+	.string	"\330\213\031\006n\354^\bw\254\214\311\342\303_~\233\344\277\274\361_J\232\t\203\026\363Z\341\330\005\021|z\201\026\243}\327I\220\016\236|\300.kf\305.\030S1\235)T-\024S\247\214\013\227)U\243\021\206\252\245z\225:i\250V(\321O\250f2-\\\\'\251,\033m\260\022\243j\241\342\356\232T\257#\257\030\251\250\3036\204\233\210\372a\303\336KD\320vS\n|\230\222\tZ\313\247\177\202}^\347\247b\306u\212\241\r\006$\234'\342q#\n#\036\334'\344\031y!\220\346\017\210\t\310sP\342\001u\234\267y\035'\001\324\221l!\220\307d\373t\336\006\322\261\350\001\327m#\221\250\3336\266\r\356\345*\313\t8H\215\276%\204\005\335h\246)\2669\3329)\312\002\3020\f_\3020\345\350U\253L\003\037"
+	.ascii	"\013YQ@h X\024\t\254\232\024Qp\036\263|\340\205\001\206\204\007"
+	.ascii	"\305\307P\231CV\032\006\310\301\252D\245\214\351\254\003+4\327"
+	.ascii	"\360\213\r\\\207@\224`\331\212M\265\2609\241\230O\235\203v\007"
+	.ascii	")\001\245\032\347\251\032C\235\336\332R\006"
+	.text
+	.section	.gnu.lto_isSimTransmitBufferEmpty.14.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"\r\t"
+	.string	"\326\021@7P\215\322\001$\373DUXz\0012\302!\322\200\2463\360\302\\\323\206\367\203\376\327\267\217\241\006\252\355I\216l!fFS\020:\217[\262\215\361z(b\271\255\224)\005/"
+	.string	"/"
+	.string	"0"
+	.string	"\207\266}\20002\351_\206\352rj\241DTv\277\250\030'=I\376=\016+,HR\253\322\363\262\260\273\316\324\212\342\326\333.\260\255`\033\026\351\324\364\263,\005\205`dW\025[\331\023\370j\331\036\331\030\333\231\3669\3361\272Kt\200]\026\254d\3673p\324\016\375] ;\324\036\220\005P-&\250\327\t\342!\251\321\336A\"\264\335\211\004\377#$\241m\034\372\242\354\360:\240\3412e\314\376J\251\027\366-\273\273V\226\341]\277E\003\033\307\263\001y\036N3G\323\341<\006\207\r\327m^\364\272-\304u\r\321\303m:\221\323yQ\223\361\347a\353\"\350\363\351\"\346\333\033j\306\244'\247^\003\013"
+	.ascii	"2\003\302\260{8\013ZGTr\224&\3102\366v\031\245\250\361P\035\302"
+	.ascii	"\230\256I\006"
+	.text
+	.section	.gnu.lto_simRead.15.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`.\001}\r"
+	.string	"\326Z^D\020\221\223\016+$p\302\217\361\177(\001p\336\017-d5\226c'\230\376\315{S\260+\027\327:B\255\367o\342}`n\345Xr\275g"
+	.string	""
+	.string	""
+	.string	"\2404((M\261J\205\303\020\202\020[#\204l\"eJ\001I"
+	.string	"E"
+	.string	"M"
+	.string	"\276\313A\210\236:9\200\335\225\024*v\343\2073\354\320\361\002\254C\354\001\254C\333>\020\"\362\350\221%\205\343\271\230F\324\330\215\231j\370\3509\362\377\362\312\203\005\022'\024\351y-\330]\347\t\245r\353m\027\260\255\300>L\221\224\232\301~\265\273k]\261\037o\316S\377\006\246/\230\266`\032V\351\312J+Lg\225~\307\245\342b\200\214\335\224\317\306\322@\231\r\217\277-\362_\314\341G\t\330r\270L\274H\315\330\215\006\016\235"
+	.string	"\313t\377f\245B=\213\n_\351\202\367\022%\332\007\313.\206\267\370&\326!Gsf\002\005\230\374\254z\255\024\256(u\360\362s\252\352M7D\036\263\245\206\3248t\021&\330\356\"\360C\214D\300Z\016\375\023\353\360\272!\265\370\220B\311\317\016\017<\371\361\200:$\035H\303\354\001\331\264\216\301HG\343>]\326q\237\022\215k\220\201\264\316\226y\270.\003!\340\020\204\017\227\221\204B\\\306\021\3676G=L(\032\024\365|\251-r\024\233G\f\205q\242a)\324K\257\231\222\214\347\340',}LM\023"
+	.ascii	"2\003\3020\f\033.\317\354\026U\346\251\314C;\330H\215b\256\002"
+	.ascii	"Vv\203!\023\345\t\246\263\232Mh\3065\246bacBr\362T3&a\222\001"
+	.text
+	.section	.gnu.lto_simWrite.16.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`\322\001e\020"
+	.string	"6\037nF\340\322&\035V\006"
+	.string	"\345\272W\215a(\261\330Yi\0261\234\344\006\034\264Y\005\302\240\360+m\220\207:\266vJ\322Q\237.\0308'z01\3068G\336\341H\244\344<\260\036\227\357\343\034\216K\b\331[\312\224\002Y"
+	.string	"R"
+	.string	"\\"
+	.string	"\033#\264\340i\177\305Y\250~\263r\001\27320f\354~\007\274i\217\376N"
+	.string	"{\324>"
+	.ascii	"{\264\312\026\372Wb\263\021</.\036\273\273)\211\253\0165U>Hk"
+	.ascii	"u\bs\205&/Z1DZ,\b \205\320\211\273\236\033Z-"
+	.string	"\231\331\311\356:5\264>\334\361n`\347I>\334\335\265\312\330\377\376\220\353\334\243\337\374 X:\313\322\030\226\2161\rcZc:c\372\0012\0256\f\374\354v(\362\2615\242\217\211\353\374\366\357\362\310\307y\216\352:\027\264\225\007\215\207\325\243c\367#y4\003\355q\004j\332&\tT\3772X7.(X\212)t\275\374`\341.\303\213\252\257 \033\205yq\330\241:\343\221B\205\220\223\243%{\330\216\360\036\250\331\353\307F5u\244y\303\305\247;\217\352wh~\023vM\305\210\\bX\246p\027&\005\376\316\004\224\266\273\257Y\301\036\257w\235d\205c\350\206%\213\354o\225:\343($\316\201\n\006\356\244I(%W:\221T\274S\247\271Tb\352\274\007\025H]\212\3636/\305Y\350R(\333\251#\231\266R\312\333JF\214J\341R\233\n\n\225\332F\337\036\256\312\370\204EYPgh\210"
+	.string	"e-\202\206@\204\250\377J)\025"
+	.ascii	"\332\025\361\032\337\303\036\021\320\204\300\311\"c\0325\323"
+	.ascii	"$\n! P\2022\222\210\017\343\320/\n\314\\\235\323\016$\r\256\313"
+	.ascii	"\267\210\263]\033\273/\304\342\245\020\210\260/.\324Qp\260hY"
+	.ascii	"\246/z\030\265\324~\367\237\233.,%\222e\311\217\021\370r\314"
+	.ascii	"\334\355R\372V\274\001\260\"\267\374\020\357%\205<p8"
+	.text
+	.section	.gnu.lto_simSetBaudRate.17.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"m\t"
+	.string	"\026\022B9@\217\322\001\320\236\240\311;\023i\231\303|\303|\267\351\311e,\243\031\332\246j\r\231QDmt\264\250\035\264\305-Og\353B\032\f\254\016H\303\235\315\266\244m\262wJ\001/"
+	.string	"1"
+	.string	"1"
+	.string	"\003\231Oz\201\314\247A\233\345a\307j\032)\025\256\227\335\255\222\343\340#\350\237\344\232\224\352\364\250yv\3271\245\272\270\345m\027\330\366\330n\t/\025\202\330\256E\ffa\363\365a\373\033\3331\374\b\370V\311\232\335\214\030\004\372\311\311\036\355\207\\\004<\313\364\200\335\025\212\311nh\340J?\035>N8\201\241$\205\245\264#^R\242\273{\340\273&$"
+	.string	"V<L\231O\355\344\002\202\201\2121;<E\271a?\333\335\265\\\331o\375\362\254?N-\034iS"
+	.string	"=l\f\224\373\2106\322'\352\250?\235P\367-4l\235\307}\365\3638\210\316\003UQ\267\205\352\307\373j\207\343\221\003\347U\322h\344\325M\270\317V\256\002\r"
+	.ascii	"2C'\025\030<\374iq\355!,\273F\021\303\274 |\246F\301eij4\270"
+	.ascii	"\313\213v\222\001"
+	.text
+	.section	.gnu.lto_simSetMode.18.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"e\t"
+	.string	"\326\321A;0\345(\035"
+	.string	"\360\r&\262 \2512`\205\345Y\263\307\0178\245\241\3744`IY\256YlU*\321\f\200\347\001\210M\326\300\200AW\r{-\203u1\360\371S~\273\311\336)\005."
+	.string	"1"
+	.string	"1"
+	.string	"\231K\355\003\231K\177v\313k\307j4X*^0\273;#\307\277\303\317\277\3107)\325\351P\263\260\273\206)\325\305\035o\333\300\266\202m\227\005*\273\026\261"
+	.string	"\013\223&\037\266\317\261\r\353[\337]%ov3"
+	.string	"$h\227\235\354\320>\310C\276\263L\027\330]\221\224\354\326\003O\355\322\365\004\0010T\244p\214v\304GJ\332\356\"\370\257\t\211\200\025\017S\346R\266^b0P0f\327\023\214\033\366\263\335]\307\225}\327\037\317\372\241\324\234\244\004[\250\023e\033h\364!y#N3\310#\342\274\006\207\017G7ozt\203\340hh\216\270\217h\202\2507=\035w\017\033\235\244\256\243\223S\367\331\306\225\031P\002\r"
+	.ascii	"2C'\025\030<\374iq\355!,\273F\021\303\274 |\246F\301eij4\270"
+	.ascii	"\313\213v\222\001"
+	.text
+	.section	.gnu.lto_serSimDataIn.19.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`\231\001e\020"
+	.string	"\366\337oF\360\262&\035\"\225\237\032\200k\033i\275\303\372`WG\376\030\324\035\003we-v\324\274K\344\345\003\271~\203\220\375\036\255\350\224K\243\005\007\347\2628LC=\202{ 4\021\241\212\274v\205\270:D\223\275\245L)Z"
+	.string	"U"
+	.string	"a"
+	.string	"#xf\273\233bn{\264\355\253\370\212\226-\004\277\022\336u\206\334\004\005\331]\016\345'\332#\374"
+	.string	"\355QI\264\262\365\b5[~\211\347z\334<\034\222\274\032\023\317&\025\032\bQ\243\203\211G\003O\212tz\\\366\304\361l2GXv\327\371\3628\334\332m;\260\335\300>\220\276\317_:\320Oz\317\277=\255=v\307\247\025\246S\323\007P2+\"\200cW\303\021\221\275\021g\234x\354\267[\276\314$\3331\013m\256\r[\f\366\372\261\273\246G/"
+	.string	"\342\221 \323\376\367\026\255\373`x\200\335\235\241\331\356\227\342\003\337\346\347{,d\222\335/UM]\005\202P\344@\031-\365F?;jR\210m\227\307\220YA`\373\3450T*9vW\201\213\277\240\340\233x4+&\377\212\321\036SWt\364\314\344\321\375\271\316 \005\321\007U\230GnA\273B\370\261Q\223B\274\351\365\262\303\231\b\0377Ef\362\310\376\\\2510\242\f \206\254;\0160/1\252\226\230\272\320\261\340\t\346\204\202\250.\335\242\342\322\261\036H8u\253\024\213c\255R\025\272\025\212{\351N.\\\313\212\305\251\240X5!\265\342`T\252\025G\372\366\272\343\313. M7\204J\222\303\302HM\327\254\251Yf\224\206FT\230Q2x\324\364\2508v)IZ\322M\355.B>\035"
+	.ascii	"p\b\030\325\251D\023\221h\210\314\231\"p\357\205\331e\253C\230"
+	.ascii	"\253\330l\r\201\026G\360\026q\241\033\220\260(\261\366t\203b"
+	.ascii	"\r\327\200a\220e\ts\003*\206S!p\367\bm\016\240\234\371J\274\252"
+	.ascii	"&\203\033U\355\204\002"
+	.text
+	.section	.gnu.lto_serSimDataOut.20.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`\232\001]\020"
+	.string	"\026\240oE\360\320&\035\332_\324\337\217#\377\3033\206\223\307\346\342u~\347\t\262<\313\372p\034E"
+	.string	"\331\264\247C\033\024\377\021H\234\236\260Ju\3548\361\034\026\375fF\320;\336\3461\220u\347#\3179\211do)S\n["
+	.string	"V"
+	.string	"`"
+	.string	"\253!\007hwG\274e\217\266\375\021'\241\262_\360\353\340\235\345A\306\247hw\267\220\203`\217\360\004\260G\345\240J\325#\324T\371"
+	.string	"\274\325cv\341P\363`>\274\230T(\202a\205\205\017\357\005\202\fm\220q\327\223\306\213\311\3448\331]\347\214gsc\267\255\300v\002\373E\0017\366w~\217\367\374\332u\376\354i\354\255;>\2550\235\232~"
+	.ascii	"\255f"
+	.string	"H\304\305n\205\243\032\313\"\006\345\274\365\333*\337e\315v\313\257lU\223\265X\"h\354.\351\321\bz\204\fd\332\377^B\365\035\n\027\260{\363\003\264\373\215\270\300\227\371y\035\277\334\261\001\237Q\305te\223\026*p`\013\226z\"\236\0300id;\345(ZJLl\253\374\007E\362bw\017\230\370\t\b\376\207G\247X\3623,\330cj\t\f\035\227<\272\277\325\035t\203\345\243\3122\307%`W\006<B0i\344L\257w\035\002\341\314\220\271\341\222G\366\267Je\331\020\nQc\r+*,(\224x\232\300\245`i\245d\202&.\215B\222\302\245\0268(q\335)\265\245\272S\004\2563m*\\)eC\351R\033I\210Q\017N\335\266\202Bu\233\366\355\365\306w}@\222n\b\265#\303\213HI\307\214\251O\\\364\305&*\313\246\024 \224\364\2504\266Gj\352\241\231\332\\\203\f\035"
+	.ascii	"p\b\030\325\251E\023\221h\210\325Y\021/\342\277\b\333l]\b\323"
+	.ascii	"\024\033\253&\220\341\b\236%\256q\003\022\021%6\234nP\254\341"
+	.ascii	"\0320\f\262,an@\305p*\004\356\036\241\315\001\2243_\211W\325"
+	.ascii	"dp\243\252\235P"
+	.text
+	.section	.gnu.lto_serSimDataIn.part.0.21.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`#\006\275\""
+	.string	"\306~\332J\200VR:\303\261\323:\200,q\001<>,\257-\0307_\027RC\003O\016\2651\327\n\034ek\274\314k-\361\215\252@\360J)u\033\237\270\337\030\224\302r\337\001.A\265I\315&"
+	.string	"\323\356\376\214\366\033!\204\020\271\223\f\301"
+	.string	"\270"
+	.string	"\311"
+	.string	"=G9\002\221\26006\007m\177T\372WR"
+	.string	"\343\245\022r[\346w\335k\351_I\257\271Wk\211\362^#\003\343\312\326\336\370!w(dk?\204\231\234\2737\253\206\362\336\253\340(\363\326\243\314\017\242$\374\217\003Ybf\236\306\255\341c|\211:\276\335{yGy\236\223\036=\177\223\036m\031\2546\233\315\346O\343Y\265K_\325\024=\333\346\226\370L_\241\b\253\224A\253\352n\264xj\3213B\220\"\227\212\341\323\331]aeW\236"
+	.string	"\016a\225=!lu\221\032\262x\237\002\322\314v\314\f\235\316\002V0\304\316\274\235\0326Y\273\363\234*\341\336\313\017\2728\353\316\314;\2309\003sz\023G\371H\351Q\333g\336"
+	.string	"\025X\017!A\333\344~\247\261u\025\261M\344\316\375\3001\007\026\267\026\357\234\310\257\223\223\263\214\263\263|\263Z\266\331Y\256i\313"
+	.ascii	"V\3134:\3133';\313\350,\307\350,\357t\226u\326r.gym\313\352\217"
+	.ascii	"\177\272ZF\217<\237\252\345N-\333\033\377\017\260A`u\357\212"
+	.ascii	"&\230\213\205.m\034\311\217\374\311\336\314\347/\237\204\317"
+	.ascii	"\344\035\331\330\321\330\321\312$\\\223OU\024\220\314\273\243"
+	.ascii	"\347#\225\370G\256\344\035\222$\222\355I\"\375B\tsRj)\334\356"
+	.ascii	"5NX\217\212)1\217\323\022_\214wF\230\2712\tW0\242\224\333\275"
+	.ascii	"7gk<\320&\362L\3134\320\213\312\205k\371Q\227\310\267,X\334f"
+	.ascii	"Z]\"\341bz\3272\335G\250%\206_\371Y\220\205,\266Ya\213\351\037"
+	.ascii	"\271\376\237T\327\273N\303@]5\331\346\327~vAdq\212\0245]\357"
+	.ascii	"\202\310\036G\023\232a\235MD\213auu;\213ulw\256\3316\363<5\023"
+	.ascii	"\257\235\353\267=\215H\003\237\006?\251?\365\002\355\264\325"
+	.ascii	">\224\216&\333\344\263\321>\231Qq\314\033\216\306m\275\004{{"
+	.ascii	"rf\326\335K08\033d\022\205\253"
+	.string	"\233\310\314\036R\333@\257*N\326\0133wx\023\017(\025X\221\371\303\231\204\360Y\273\3676@\361%\275\035\325W\361\336\373\240\354J\200\3704\216\262O\204\275TA=_\005#\023>\241\325\b8Dt\032\t\035\r\001\241\276\023\277\242\263g\324\013:\203~\226\201|H\374\212B\214\350\375\200\276\"^\021\320W\342\007\f\342\t\375z$x@\300\"\236\017\017\017\021\371\200<\243\241! \317\276\265\330\252\347\3526\026w\236\275\263\323,!\330M\334?p\314\001cm\"\007%\251\221\353\271\352%\315\351\263\247t\372\354\317\360r\322?\357\275WM\360\263s\372\312\237q[gPWM]\346\003\211\226\3124s\006{\177z\231|k\306\205Q\273\222pU8\315\377\302\201\002\201_z\024U\223\312\322\005\002\247S\346\324\013\233\256\351\233\266atm\323\255f\341o\277^&\213]\270l\251\351\031*Bh:m"
+	.ascii	"4}2\256)Qqd\001w\250aL\242\fb\346\214\310\004\221$i\206\003\200"
+	.ascii	"\002\2219\253:\021\2001sN$\351\334\016P\204H\261\026\2200\365"
+	.ascii	"\341=L\032T\370\032\030\304\225\022\027\222\252\311\223\007\222"
+	.ascii	"\310\335\327\036\211\004\317\370\234\2202\360\024\026\370\221"
+	.ascii	"\335\006*&\345\302\377\004\271\034\273l7\272\b-\304\276)0\350"
+	.ascii	"y\316$Y\353\345\037\\\300\216k\366Ss\r\243\311/?\372\f\207\354"
+	.ascii	"\232Vo{\256}\227\005\035\030\246\335\f\033\247\271P\362\313\350"
+	.ascii	"\n\264\026\016M?\036HLV&\347\364\267\2368O\373O\243\357\037\263"
+	.ascii	"\362\200+\013\013\300\017\005\212\317i\342\222\221\335\232\313"
+	.ascii	"\032\247\004\033\263\033\373?9\223~\376\362\312\002\371\352\346"
+	.ascii	"^\255\277sJ^\210\270\021*Z\332\006\354\250&\344nD\344\360\030"
+	.ascii	"\036~\366Z\233\023\017\265S|)]j\240)C0\025"
+	.text
+	.section	.gnu.lto_serSimDataOut.part.0.22.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`\243\004\205\033"
+	.string	"\006r\255H\260\226Q:6\307\f\323\230\200\371\255\027\263|\231\f\211|\272\245\201\231s\221\223mxa\353\355Y\351\372\262\377-0\3033\223\013^\333\241\347X\276\243\376 _Xo\367\027\333\374}\305\377\361\214\314\270\361I\333\233\310\235R\222"
+	.string	"\222"
+	.string	"\235"
+	.string	">\200\b"
+	.string	"+\211\236W\332O\272R\356>\200^SkQ\323S\255\300\004\300\321R\036\370\036\325\327\263\224\357a(\273jmA\343\251\326\212\340\323\260\361\323>\217\240\336u|G\316\206\022\201/|\377\311\020\261\264\245\326\n\373\274\271"
+	.string	"\372)>"
+	.ascii	"\375\\\027n\r\207\303\341E\340\2752\367)\256\2449_\362| >_>\235"
+	.ascii	"\024\305Mb\212\232\361\205\020\033\3608\202\361\247K\"\337\220"
+	.ascii	"\\\230\032%.\003\234\266\036\324Z=\236\270[\267\rd;\202-J\005"
+	.ascii	"\177\272\201\240\020\007\222N\016\275\337 *\212\244\344\376\274"
+	.ascii	"\364:UJbx\213lC\245k\016\344\007@\245i\250\364\f\225\226\241"
+	.ascii	"\3221\243\364k\245a\276\364\273Z\322\343\233\232n:\245gKZ\244"
+	.ascii	"\322;\245\345\201\377\007\330$HQ\353\210\241\227\312b\006i\274"
+	.ascii	"\310\337t\373MA>\221?\371U\304\351G\3428\375\274\356z.\236\325"
+	.ascii	"\321U\255@\b\343\347\220 \337\f\345\374!~\t1\324\b\2427\376\370"
+	.ascii	"\345\270\252\265\342|\272\001\020&&\241\202\225_\nzO\326\212"
+	.ascii	"\2075\2632K\2634k\027\234p\253\030M\260\t\223\252\231u\020\345"
+	.ascii	"\217\321\230\225Y\n\265[!D\341Kb.\033\302"
+	.string	"-B\252\251\230u\331\020rAz\255\237\004C\005\003e\361\260.\205\263P\340F\276\017\375|\255\230E\204\"I\016=\256ka\366Uv7\350\216\373\003\247\333ZI\265[!$\207\026W\356\\1kwCh\305\235V\"\276\330\262#\361i\005\205G\366\316\241f9Pj\255:\037~\344\302\213\304\324Q\255uA\360Fh\276\321\2473\364\310\363>\375\037\372)78[\215\203\210\333\340S\333\2313\017\264\233(\303\311xD\036\232\364NN\017\355fA\203\214f\233\335`7\333\254\003\315\306\003\333@\223\365\300vl7X\316\215k\034f6\030\256V\263\301^\266\345\267\310R\244\343U\324\227\245kc\263~\240[!\357u\252\224\310\230\373s\315\356\336\211\222\024[\302\265\304d\252\262`a\251Y\0050\220\256\304\\:*+U\250\254KG\305\205\311\224$!\342\376\314\0235\203\342\374FQN\262\265t\211"
+	.string	",]\006&\256(M\r\311.\336\213\265\326\272\373\263M\263Rb\033\005J\\\250a`\242\2202B#\301\210\004)\250\322\001\260\002\031*\263\003\021\3001R%\"A\316\355\351\364[\221|\365\001=\324\250E,\227\201FeV\335\347R\022M\217~\331\247Q \231`\302\336\313,\027\215\205\360\267%Rrt\361:\346|\310T\370\2253K.\251\230\022N=\013\2575\376\250\316\305\340\2111\227=,;X\252^FI-\214Th\336\217\371\273\363y\253"
+	.ascii	"\036rEo\241\265\240U\3618yp~\210#\230s\005\027\317\243+\256\317"
+	.ascii	"\002\363\263\271\372\315,\262\236\313\241\214\006\312u\261\240"
+	.ascii	"\304\225+\252\350\265\354\240\2159\027r\367\004\r^Io\377^\322"
+	.ascii	"\375"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"m\005"
+	.string	"4\bb\001"
+	.string	""
+	.string	""
+	.string	"\002\f\177\031\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\r\177\032\016\177\033\017\177\034\020\177\035\021\177\036\022\177\037\025\177 \240\263\305(\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\n!\200\204\001"
+	.string	""
+	.string	"\003\002\026\177\"\252\333\3426\002\013\177#\272\200\202\002\t$\023\177%\331\234\211\335"
+	.string	"\002\024\177&\220\261\336\375\004\007\251\344\332\202\002\001\225\006\003\f\007\302\001\003\r\t\252\333\3426\001\302\001"
+	.string	"\020"
+	.ascii	"\030#\374\235\210\211\312\301+\302A\342\256\026\301\302A,:\007"
+	.ascii	"\316\274\033\324\003\324\003\324\003\324\003\324\003\324\240"
+	.ascii	"\331\351\004"
+	.text
+	.section	.gnu.lto_.refs.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375 \247M\003"
+	.string	"r\311\026\031\220\245I\007\377\377\377\377\377\377\177\t\352\333[{\263F\266%\242\326\310\226)j\366\230f\215\235\252\032\312\324\312\022*!\007\227\313T\236\3113\360D\236q\231\236\305%\361\374\211\236\3479<\205\247I\245y\305\242\262&\353\361L+A\034\001\236\202\025Y\215\265X\315\272EH\r\b\003"
+	.ascii	"\317 \353\273\272\220aPO"
+	.text
+	.section	.gnu.lto_.decls.3474624caba0cce8,"e",@progbits
+	.string	"(\265/\375`\216\033\345x"
+	.string	"z\301<*R0R\312I\007\357~\373\366\357\267\353{\377m\272\375\356\371\372cb\3343<\373\237\237\037\315L\367\\>#\315L\335\314\372\340\375\363o\227G1\313\240$\201\370\375\333\302\036\016U%\002\020\001\210Y\265JTFTYY]z\376\334q\250[#D\312\024!\002\222\002\241\002\352\362G\233Y\257\357&{\376c\317w\3549\013{\203\205\375\231\213\\P\232\365e\327+\307\261\026\3662\200\267\250\312\2577\033b\340\223\270!g\354\331"
+	.string	"!O\331"
+	.ascii	"\341Y\214%\301N\3303\026{\216\262"
+	.string	"\274\003\257\261W\tf;\353\300X\036\323loX\214\234^\220\261^\317J\354\271\204\320\206K\b\317;X\022,B\2702\216\020\305\033\213\310\201\253\240\255BU\252\024\351\365.\344p4!\034\327\215\322gg4\033,*Y\210\364\312R\330lJ\205\315J\257\214\003\223\261\227\003<\345\\\306T\036\\\266\267\275\267\265\351+@)`\275\336\260\ba\327`\317\016\b\325\351\224\035\020\376\313\355ft\260\212r\353\365)\260\027\201}\3138B\016c\225\244\226v\275^\005{\366b0\376\222\001<\342\326\327\353\327?\201\005\277#\336\273u\357\035A\003\207\324\303\355\365\177{\001\340\256\005\267a\337\354\317\030\207\353\347'\274UBu\026E\357\330\275-\b\032?9&\223^\337\262\b!\3138\302\234\007\360w\226\263\217@\243q\003\376.\373\031\250\206\234 \036~\356\321\"\323S\201\353\301\277\225\310}\307\346\357\252o9"
+	.string	"\001\234\346o!\037\234\375\273\307\314\006D\217\371;\307\317\017\260?\017\377\007\376\034\374\271\346\347\376\031\202\237eJ\374\214\300\317\353\317\377\231\370\363\314\317\352\3174\302\237\225\374\034A\222\235\227\370[\357\347\253\237\253~6\362\263\325\317D~\236\372\231\352\347\250\237\261~>\362\263\324\317Y?K\207<9\345`R\372\331\307\317D?7\177\236\341\377\001\277:\343\347\240\237\213?#\3719\206\237m\374\\\343g\032?\253\360\363\t?\357\374\354\342\347\017~\336\340\347\026?7\360\263\005?\233\370\031\347\347\233\377x\377}\376W\371\257\367\037\360g\025\377w\376\263\375|\301\317)~F\361\363\211\237s~\026\340g\021\377\345~\016\3613"
+	.ascii	"?\203\370\277\365\337\201\377k\377k\246\323\351\364_Q\370U!\177"
+	.ascii	"\bfS\226Q\036\300\210\031\025\275\3157\247V\364^-f\215kT\201"
+	.ascii	"\262}\273U\374\246$\342t\213\206\356%\300\350^%\337\267{\257"
+	.ascii	"\362\336;|:\265\3676\3358\245FF\367.\345\030]'%\332\320\275="
+	.ascii	"Fw\006u\206EEu\320\242\204Io\216V\311\322;\007\365d\303\224^"
+	.ascii	"\267\350\336\313z\254\024\332\303K\257\335D\245a:\235N\303\334"
+	.ascii	"\273\354&\335O\332\311\273\311\231\023`N\300f8\307\304\271\024"
+	.ascii	"\256m\330\275\255M\210%\033x\330\260dz\207\260\365\372^\362\267"
+	.ascii	"V\327\320Y\304(\215\324\217'Z\257\254\026\017u\022\235\267\222"
+	.ascii	"\003\312\254\240\365:DB5|r%jL\332Y5cI\317i\257}\344\022\247\330"
+	.ascii	"\2520\275X\253\276\352\2526\302^\215\3657TG5V\017\351\244\021"
+	.ascii	"L\347\232\306\225w\357m p7t\023V\023i\252\243\t\306\200<\373"
+	.ascii	"\376\032\213\347:Z\243l\257rE\027\220g_\214\337\032\325\224\314"
+	.ascii	"\332T\335S]\344M\325R\304fS\255\367.\231\023\250aN h\005k\t&"
+	.ascii	"\\\2576\261W}\260<t3\247>\331w\364o\247\016\302\201+\b\320dj"
+	.ascii	">\230\364\332O:o!8\302\347R{ml\262\214\312\312z\035N\333{\031"
+	.ascii	"G\310\336\274\275\2318\260\343\332\212\230K\255\244\356\340\332"
+	.ascii	"3\353\226xtt\025\375\341%\b\266\203\223\245\217\244\325\006+"
+	.ascii	"*\035r\202L\244P~\364\340\302\345\027\310\327H\r%\006i\245\230"
+	.ascii	"\365\332\317\2669s\273\306\332z\275\312d\243\214q\332\021\230"
+	.ascii	"U\036\026\036\236\244W\334\204H\325\212\314\001\311\353\272\201"
+	.ascii	"\241\360\210\303b+\277\216\035\347\341\020g\224\327\345(O\347"
+	.ascii	"\013\373\365`\356\210\"v\273\241\270+:n\253i\336\334fT\223\224"
+	.ascii	"\202\237\257\274\005\311\322\227\341\230\213\212\241g\fQ\234"
+	.ascii	"\023w\365e@\016T[\351P,*\213\261\374\334C\035\267\251^OV\f\214"
+	.ascii	")\357\336\366\177/{G\017\365Q\027\265Q\363\350f3\233\250\205"
+	.ascii	"Z\331\316\326\301\323\316\301^}\031\314\371\217\303<\247\275"
+	.ascii	"\267y\357=o\375:}\331\007\336S\275\236\267)\245\\@\210\313\217"
+	.ascii	"/}\367\266\020\344@P\363e\304\250U\200&\260I\340\237\031+\274"
+	.ascii	",B\370\267\376\362\353\033\363\352B\327\256I\270\230e\375\300"
+	.ascii	"|7G\330\025Wd\007$\354\333\312\013\353\331\374`\264''\304K\023"
+	.ascii	"\343\021\265\220\216\216\024\361\335\327\257(Ml\252S-IsIH\270"
+	.ascii	"d\177UHm\016\273L\r\201\251\314\253M:;(%\275\252\313.\353zZ\366"
+	.ascii	"\252*\2177\363%0\332\3477\r\224\221\272c\223\002\276\003\247"
+	.ascii	"\200(\267\356\330\007\265\260^\274\264\037{\207u\027\316I\337"
+	.ascii	"Ph\214k\331\367\366\3532\2315-`\317^\373\207\025\314\224-\250"
+	.ascii	"^\233\217\323l\252\350\2348{\355/\267k\022A\262\326k\357q\233"
+	.ascii	"\315\326S\016j\275\266\036\357\361\337\231\234\016\316S\243T"
+	.ascii	"m\351R\243\353<\272\306\253{]\343\261\312\373\faE\n\347\244o"
+	.ascii	"Xf\267\005u\367\306\213\331\352\201EH\257m7\304\341N\250\250"
+	.ascii	"\327\356\322LFH\226bd\354\203K\346\330\253\347z\211\007\355U"
+	.ascii	"\326\350x{>#x\220\352\255\345\336z\213\360^n\243G\317,Yz\013"
+	.ascii	"\337\347\362.a\020\365\227w\227\226J\004\001\245\352xhyo\271"
+	.ascii	"\225\031\246\275;-\275v\034\013\310\264$\260\327\206\353%\232"
+	.ascii	")\230i\330\255\254>\320\236\264\365\372`\023\373\340\320\332"
+	.ascii	"Z\273\325I\333\336n\253R\250\r\260\327f\263\2513\2222\361\336"
+	.ascii	"\020I\2073\350\337\225+\255\306\272I\261\274\325\206yU\244l\365"
+	.ascii	"\332:\f\315\334v\350\322&t;\n\003\246\013\032Z\247\221\345Uy"
+	.ascii	"\247\261[\372\302\350\350\265s\350\262\276JSR\302\201\301(\276"
+	.ascii	".fqddm\326\322!\016\314\255<*o\263@\231$\265\257\251\262\230"
+	.ascii	"7>\276\261\262)*\026\036kWk\023Y\232\332\232\230XK\361\001E\r"
+	.ascii	"yco)MEs\366\303\212\312\372\005\005J\203yp\357Sys\231qN\322\365"
+	.ascii	"\b\373\336j\256w\327\273\032,\346\336\345]\272J/\f i\341\234"
+	.ascii	"\364\335\245\347\327\033\214\333\210RqF\242z\375\227\366\"\266"
+	.ascii	"\312{\347\325\306x\351R\327\354g\r\023\210\224\252o`0ORM\\\370"
+	.ascii	"\330\367/\274\313\347\275\027)\330\336'\223(\344 \323\260\312"
+	.ascii	"\n\374_\257\232\301\336\275]Z{\254\022\263%\220\223\270gr\257"
+	.ascii	"\022\304m\357\323\031\006\245tB\201\203\202h\357\020\001n\030"
+	.ascii	"\221\353l\241\240k\364\366m/\337&\024\324\005g\033}:\333\250"
+	.ascii	"\362\3466\243\312{[\350\215sl\251dg\030\024\324\031\026\205\202"
+	.ascii	"\270\315\253\274a\313!l3\nu\262E\2417\316\260%\324\331\204\202"
+	.ascii	"\202\340\322\312\352\"\252\203\002\303Pg\363\3620rZ>o\336\234"
+	.ascii	"m\364\316\335\313cC\367\251\300\275N\321\347\334R\211\317\230"
+	.ascii	"o<\230\001\305\244\361hB\017Pq\006\307\213\0208v@ \215\005 \207"
+	.ascii	"2"
+	.ascii	"Z\024\223<I\030E #\b>\307d\213d\021\t\200\214\026H\032\0327X"
+	.ascii	"\300\300\002\031Y(\312\220\3711\"c\200\2126\\\310$o\270\240I"
+	.ascii	"\336p\021\002YCDa\"y\344\261a\002\350\203\037#\214c\021\211#"
+	.ascii	"\303\"YSL\032\217&\374\030\221l\017O\361\305\217\0219\214!i\343"
+	.ascii	"g\203\244\361\007\t\304s\334\3711\302@\032s"
+	.string	"\212\305#\007;8\237\301\002\2201i\3441\001YL\306\300\002\307\013\037\236d\320\316\217\021\031\300g\030\217E\240\"\013\354+H!A\n\0258\206W\261\002\305\n\024\302\253X\241\243\263\"\205\016\373\024:*\214\037#\322\3465H\370\004\005\261\210\021\004*\332\bZ\327\344k\230\030\361 \033\305\343\211dP\320\361\304\314\261h\244aL\002\025{\2142\310\030\304\022\222\307\240\021n\212>2xv^\020\026c\024{\202B\220)\366\004\375\254\305\030.\222\307 \0334H\240 c\322F\320\260\230\344y\321s\203G\006[\224\301\b\203M\306P1L\262Gb\017O\321\203d\214\t(\3601\362\354\034\2134h\334`\201#I|\301X\234Q|\221\223\214\221B'\td\274\301\312\360$y4\300q\2549&G\370@\304utZ\220 A\204\016\330\031&~\214\310\030><\306c\021y\002y,\276`<\366\234"
+	.ascii	"2\362\374\234\230qD\2360\201@\0133xd\370\370\360\264(\372\364"
+	.ascii	"\030\211K\360\262\254\232^j\r[\374\230\374\252h\251H\206\246"
+	.ascii	"\\)R\322Q\243\277(\274&\334\177g\257\376S\221\3048\357MR\241"
+	.ascii	"\026M\212\200F\272\027\206\251Wu\210\n\325\226\327\203\372\244"
+	.ascii	"\n\331\301\234\313\353\301I\r\022G\247\344\324\307[W\025\002"
+	.ascii	"\224F\365\024\2123\312\220Z\304oK7\267\t\366'\3550=\315\301\234"
+	.ascii	"\032Q\255T,\365J\225R\251\324\"*\021\365\210\232\245N\251R\366"
+	.ascii	"R\253\230/\013\223\332\204\227wEI]\362\323\211\252Bd\230<(9\365"
+	.ascii	"\031\251?F0\235w\005\003\243\344\304D\255R\201\250N~[j/\322\220"
+	.ascii	"i\247\344\004\001+\264\024\333\"`\375P\t*\355\313\223\rC\"\366"
+	.ascii	"B>\026l\t\360H\233\226 f\023\310I\215\324\330\013\305\232\336"
+	.ascii	"R\374\254$\371]-\265\033\225\247$TQ?|\314xA\213\320\222\256\372"
+	.ascii	"X\207\262\\\245\365\252\366\220\201\002\266c\332\253\312CE\322"
+	.ascii	"\353\201\027E\202\022\233\256\370\324\236W\241\035\344\0225{"
+	.ascii	"U\217"
+	.string	"n\027\254BR\352\231\335\240di\252\327g\221JDCw\364\345O\335q\225\350\256&\212\fO\332\253\252\243\313\344\212\260\f\351U\315\241:g\374\222\210\002\202W\250\262\341<\210\302\f\021\232\022\021\031I\222\244\003\262\n\020\004\202y\036\331\356\006\022@\365<\217B\307dFDZP\222:\205i\f\241\223\332<\320\rJw\263\224\256#\020\020\344\306\034\201\260q\006\320\275\217\213MX\210\032\230n\361\001\210i|\205\211\211\r\214V8\177\251\364\202\376\247z7\266\260|\205=z\255\240+@\303\023\342\316\246\253\3000\321C\220S\006\262\356\016\364a\224\270\252\240V\341\037 \3764L\267\333e\222\217\003\2148\223\350\\\360\254\207X7\361\302\2151\325B\376\035Y\266\361!\220W'\344\022Mb\177<\344\362L*\312\357E\363 \376\bcB\374f*`\2749]\343\340\274\315\225T\210$\270\005\b\317\016\373"
+	.string	"\321|a\001\231\020\275SP\333\343I0\021\016[\246S^\337\017"
+	.string	"r\007\367r\361f\016\006\265{\032I>\370\0272\365`/\312\021t-\026F\330\202\003q\244S8\033\013\365U&\202\270\2342afD\365cDs\260\006\205T\262\177\266I\nwx\210\263u[\273\361\320\002t\342\036\313[wG\350\001\266k>\\#\013\006o\"\002\371\320\367#\323(c)\257\2163\013i\305\327\304\033\n\0075)\360.\235\235\367\036\221\254q\331~\250B\001cu\315\220\364\301\351+\310q\326\306p\"\213\001\207\242\371i\345\347\265\237h\270K\370Ge\222\325Uy9\330{\207\303\215\007t\333%Y\036\212\306\035\003G\220\231\216Ub&"
+	.string	"\035\253\315\344\244)\034\336\341\201\353.Jd\303\252w\307\336\260\323z\345\215\003\271\326"
+	.ascii	"Y\032\343\330\240+*\203\024X\332\305a\352cI\2128\235I_\341\f"
+	.ascii	"-&\316\353\233\300"
+	.string	"{\242>\337p[\220\364\372\212)\254>\221\276\210l\003L\234!\212\232Xd\f\022\244]\337\240*\275\323\342\335\003\273)\f\035m\270\251\245\353\215\022\\B`((\366\t\320\245\0225\t\244\251x\006\222'\232/\b\262\263\0164\341\252!\313\231Q\177\216\200\204C\233\342\221a\202(\355\352\206\374\315\304\350\032q\345\006R\221n\371\030Ii\033A\361\004\350\001,\035p\372\235\275\321\205\f\033\023\222In\224<b\250\241\t\304\332\022'\234UH-\211\327*p\222\016\367\301\367 \204\326\364\263\333(\223\245\362\336^\367\203\027T\tl,$\374N&H\324\023\024\023\"@e\n\2524\f\346\307\216c\363\241C\020\225Z X)\027\252\nQ+\"\017Ko\373}a\330\366\265vb\315)I \206\277U\221\f<D-\333\354\003\211\363-\201\344>F\204\277\213A\006\247\023!\361R\255H\r\005>W\304\016"
+	.ascii	"V4`#\243^\177\246\003V\257\027Z\377\033\336Zvg\023l1\026[\365"
+	.ascii	"z\263\334h\227\031\206\312\177\324\231,\330\341\3526\270\334"
+	.ascii	"\023\\\351\007n\037\334\230l|\006o\002\232P\207\266_\310\374"
+	.ascii	"\341+\003\n\\\023<\230\306\035q\003[Z\016C\271\305\204\271\230"
+	.ascii	"Z\t\027\362T\322m\340\204\224\024O\367)\350\326\256\033\036A"
+	.ascii	"\013Z\256\215\026\016bB\3618\224\032\022\213\254\347\021\334"
+	.ascii	"\354\317x\254\025\002`\2372\211\344\333\231\f\017\036Y{\261T"
+	.ascii	"\376\t\250\274\030>\033\265f\274\021\317\214*7\333\"\334\201"
+	.ascii	"\342?+D\374\033h\316\016;d\024':\2045\275A\230}\215G\235\206"
+	.ascii	"\315\267\356\240\306\016\273\312 i\3529tVU\0207\223\375`\344"
+	.ascii	"\366\0222\001~\023.N\302C\305\360\362i\343\f\362Myeso\265g\342"
+	.ascii	"N\330lx\377\343}\350\273+\214\005{1\376\240sqg\322>\226\007\230"
+	.ascii	"=\313#\252\007\257}q\272\0273\026\370\363\2516\366\376o\317\037"
+	.ascii	"6\256c|\256\241\350\247\177\256Y\360\232\335/C\347\343\347\366"
+	.ascii	"=\333\315:\007a\207]\212\254j\350\217\025\330Y\262\330\237h]"
+	.ascii	"\221\026\304\215\362\177\256\364\215*\001C\236/o\027\005\016"
+	.ascii	"\222{\245\364\311\363 :\r\246\271\027V\027\036\216\376\031|<"
+	.ascii	"\357\023\322\376\302wk\341x\310\362\370\233\305W=\033\347b\335"
+	.ascii	"\271E?\306\357\261i\321\375\017\177\266X_\233\243E\321\307\237"
+	.ascii	"\306\264\017\341\201\362\277\230*W\376_\214\017\220\367\361\237"
+	.ascii	"]\330\345\355\362\2610\272\001z\026wy\363\253\361m\"q1\322\350"
+	.ascii	"\277\367Z\001"
+	.text
+	.section	.gnu.lto_.symtab.3474624caba0cce8,"e",@progbits
+	.string	"serSimOpen"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"serSimDataIn"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"serSimDataOut"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3474624caba0cce8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
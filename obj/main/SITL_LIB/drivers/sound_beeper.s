@@ -0,0 +1,227 @@
+	.file	"sound_beeper.c"
+	.section	.gnu.lto_.profile.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\354\301\314\336\005"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 \037\315"
+	.string	""
+	.string	"\210\023"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001"
+	.string	"\002"
+	.string	"(\201o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 $\235"
+	.string	""
+	.string	"H\030"
+	.string	"\002"
+	.string	"\001\002"
+	.string	"\002"
+	.string	"\003"
+	.ascii	".[\200\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.811d26975be3169a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_systemBeep.14.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 \350}\006"
+	.string	"\362\213-4Pm\222\016dR.\206\311\026G\250\340\013i\372(\002\305d-\250\350g\177\003A\217$,}\273\214n\250\230\231V\274\203!ML8\"\352\245!\315\022\"S\034\016\244\340\264&\023\237\347\275\210\207\rE\001+W\305W\321\211\033Gu $\234&V.c0\364\274\350& \214\016se\333\250\340\242\201\376\372\260\266\361\275d\033=k"
+	.string	")\245\020\254df\264\260\244\311D\362\361\027\3633\366\n\013VI\026\003U9!\225d^\b'\004t\332z\224^\035Y\021\017\214\221Rf\272\306Q\253\314\272\r\251@H\364)\003p\310\314YH\244\321[\377\203\237\341\007\005\b"
+	.ascii	"3\003\316\231\341\341\313]\303\243C\030%5\031\334\345E;\311"
+	.text
+	.section	.gnu.lto_systemBeepToggle.15.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 \310}\005"
+	.string	"\322\211%/`e\323\001@\365\n\332$$`\023\332\345\206\302\023\006\204\002\027\257\333\002\205\275\241\247\272\260-\n"
+	.string	" \002\261\324\307B\203*\234\027\321\3362\005\257\250:\2639\035\f\013\213P\215\265:%W\265\030\273\032\017\256\252\306\324\3414\233\225!\224V\236\300^\371\031&\222\362\203\\\224\231\177\003-\277?*.!\251P\352\266\004"
+	.string	"\264H\020\342\374\337\351\333?Zp\323\353\001U>aw\263\324\354\266q\373ng\t\235\307m\034,\272\373\261\3630{\271\377\021\377\023\377\257\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_beeperInit.16.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 \371\305\006"
+	.string	"\022\315/2pO\032\003$\372`wGY"
+	.string	"X\211\314\331g\233\356\007O\261\026\221\t=\266R\021\315w\323\222i}\375\357 \036\331\205\356\321\035\317\033m7)S\n\023\225\204\025)\251\324F\302\016\204\021\017\034\313\"^\357\222\360\242\222\234gU\020\024\217\222\327\333 4v\240|\0251\312\247\231\267\313z\220\3414\332\351i\016\2445\300\377\327ems\350\b\305\030\270\374\03432o\211VF4m\335Z\223\270\004\263\t\206\007\376\214E\345\237\n]\230\034u\272@r4\231@rT\254\205\361\024\271Q^6RB\377\237\0131\346\206\325>\261\300\007\344q\013h\370\337\366\001y\270\316m\023\3322\264\375\b\b"
+	.string	"2\003&j\006.\234\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\016\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\017\177\003\020\177\004"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.811d26975be3169a,"e",@progbits
+	.string	"(\265/\375`=\005\r$"
+	.string	"JD\030\017F\200jQcM\241\321\361\302&\215\027\262\276\006&5\206\377\272<)`[{7\214\210A`\316z\211\332BH~Q\035\355 \364]\0207\242#\272\266\325J\211s\364\364\273G.$\335\03311\302\326\315\335\266L\001\321"
+	.string	"\325"
+	.string	"\326"
+	.string	"\f\234~ ?\bt\205\331\222\322\363\267DDD\b\210fM.\306\t\220y\301\3340\327\b\341\212\361\255r\263,\363\265oK$|\264\262J\3232P_\bg,\231\274\020N\357P\nW\350<o\201\323'\266\230<\322\020QR\2326\201z\004j\017\350\265r\257\\\343\320\325\212\251U\b\b\350\003\245\317\236\322t\006tA\225\027\331"
+	.string	"\352;t\336\344\035:\215\242\264+t\226\267\300\331\340\n\235n\257\320\211\336\002\347\275*\257\325\305\362\275\272R\\\241\310\263\337\255\376\366^\231\277\357^\007\003\356u \0233\345\313:M\227hi_4\327\276[l\223\210\331\027\213m9\266\277l{\331Nc\333\312\266\3146\032\333f2\231L\332\026a_\t\266I\025\3278\343\301\007\377\220\r\202\371z\\.'$\016'->\366\266\377\023"
+	.string	"\235\204\260\377!\327*\366\257rZq\340\005\265E\376\310E\252C\206\2771\343W"
+	.string	"\374\325{\344\177\365\377Op\330\376>h+\025\020\370G!"
+	.ascii	"~\250z\231\361\227F8\\\302\265(\204\265y\271R\244:\215V\275T"
+	.ascii	"\007#\006\321\242J\3457\376\337;(\2250\207\235\322\264\257\032"
+	.ascii	"\373N\271\355M\023[o\2607\376m\3209&\352H\2434\217-\002\331\361"
+	.ascii	"\307\244Ii\372N\241\266\240\345r\031\020\373\201\\Q\025e\271"
+	.ascii	"[\027\031\205!\n\326\245r\313\334/w\314E\032\321`e\244\363\267"
+	.ascii	"\266\257\231K\346\236\271h\256\361\226\271]|\271\256\027\227"
+	.ascii	"\355\377\373\357\233e\333\354\nE\267\314-\336\255\262\2577\\"
+	.ascii	"Z\316\343\373%\353\252R\262U\232.\241P\3375\027\351\313\306x"
+	.ascii	"\331\\/\364\017\252\355\237n\326\324\023\226\236G\r#\224>\210"
+	.ascii	"RR]"
+	.string	"\276^\2363\373\255\37630\217\304\331\021V\232\316s\257l\003\230\331\200\002\003\244\rj\237\367\005\377C\311\332\007\235f\347\225\335\033\301\026pc\367\301\357\2418\377\217$x\320&]|R\245i\273\301\375\344W\203\336>\270\026\211\352j\245K\030\324>\310\201\027\207|m\211B\223U\313\267\277\377\021\205.\326\226\r\256-\253\322\376c\325\277\025\322V\243O\275k\221(\\\213\2540\350\277\253/\372\202\240?V\270\036Y!m-\372\204\353\217(\f\032&)2\254\321\325\265\344\326Y\177\307\001\034\372\2024\344\332\262\007\373\003=\\\356\003P\312biIG\202\346\007Li\272\241E\332\343\305\340\0019\t\267Ks\351\022\352\013F\022\214\216`\374\370\b\211\002\022\205\323GH6\033\222\221\r\265\221-\326\363\212\tM\251\322\255\266\304\264\300:\246tW\353\351t\273Z\200\336\315\310\206\306H\312\245/\\\244;\025"
+	.ascii	"x\267%\234\212\234\216CS"
+	.string	"\332!\250w\373YBAB\207\223)\245\275]\332\224\373\300\303\001\365nG\275\034\356\305\217m6\016\rJ\200\360\200&M\330\245Li\232\342\246\224{\241\343\325x\273\264\t\267S\252\345p(Z\324\222v\274\332\004\0079\034\212]\207\\\312\024\202\207\013\300B\247\333p\223\031\f\354\312\t{\302z\362s\224\n\312\211\343+\347j\265:\370\204\005\340\242\0035\025\006gV\247\210\2170\307v\206e\204\316\2614\337\334.\004\302\252\256\264B\334\270\271_\367\367=\3521\257-OXO\002O\250\2010\244\f%F0#\023\214\214\204\321\024x\220\002\221\261#\017\021\260\271I2\265\240\2056\003\007\264\210\222\354M\r\t\237\022\204:\301\261\f\200\r\020`\013\223XF\022J\344,sA\265H\340/V\320\257i\351\307\030`W\232\250=\3702\371\220kPW4\352}h\351\214\210*\2042\005-\224}\234\237\270\002"
+	.ascii	"\033\020\353\366\177\223U\267/H,\221\336n%y,\361U\361+z\215\376"
+	.ascii	"\020\370\272d\250\201\221\233v6u\242%`~0x\246hc\213`e\177\323"
+	.ascii	"\003\347\256\373\263\301/zK+\234B\266e\016\217\030S\340\177\234"
+	.ascii	"\267\326#\034$\250\313{\032"
+	.text
+	.section	.gnu.lto_.symtab.811d26975be3169a,"e",@progbits
+	.string	"systemBeep"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"systemBeepToggle"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"beeperInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.811d26975be3169a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,235 @@
+	.file	"stack_check.c"
+	.section	.gnu.lto_.profile.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\302\252\341\340\002"
+	.string	"\002\302\252\341\340\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	"\003\002"
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375 VE\001"
+	.string	"\270J"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\006"
+	.string	"G9\354\f\260\031\356\315\3410\257\337"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.5ed04af154dd02a6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_stackTotalSize.10.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\007"
+	.string	"\322N44Pm\323\001'\243*\310\251j\272\240\246E\301F|\264\274\242k\f\371-\022\323l\226\3627\357\2616vrdf\226\235Z\317XtU\210\312\206%{K\231R\2360\233\211J\230\0166S\206s\305\313\242\0344\026B\\\320d\024\342d]\0213\340\212\201\262\"\247\252\254h\351\366o\025d\275h\n\341k\352M\356\201\021\204v\265o\276\350]\203\177q\350\007,\277\035\372\230tx\375'E\313\221\335yR+\354\277U\220\355tf\372\2572Q\"\020\262\0331BY\0228\202a\273c[\374\215st\234\275.\304I\037\242\017\310\311n\027/\017\220\016\337\001\244C\265x\366\314\374w\374iP\210l\234\347Y1\330]\347\306I\334z\333\005\266\243\355\214\t"
+	.ascii	"\023\013\275\263\030]\b\351P\345\342\232x\034\221\263\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_stackHighMem.11.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"}\007"
+	.string	"\322\21644Pm\323\001\247D\f\202\215\252\213\304zD\301F|\264\334\210i\f\371-\022\323l\226\3627\357\2616vrdf\226\235Z\317XtU\210\312\206%{K\231R\2362\234\211J\230\0168\223\246s\305\313\242\0346\026B\\\330h\024\342d]13\340\212\201\262b\247\252\254x\351\366o5d\305h\n\341k\352M\376\201\021\210v\265o\276\307\273\006\377\342\320\017X~;\3641\351\360z\320\212\226#\273\373\244V\330\177\253!\333\351\314\364\237\205\242D\340d7b\244\262$p\004\303\266\307\276\370\033\347\3608{\235\210\223@D@!)\273]\304<@:|\007\220\016\325\342\3313\363\337\361\2471\201\262q\237\247\305`w\235\033'q\353m\027\330\216\2663\002\t"
+	.ascii	"\023\013\275\263\030]\b\351P\345\342\232x\034\221\263\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375 D\245\001"
+	.string	"\264\002@"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\f\001 \013\177\002\r\003 "
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\340G\204\245\236"
+	.text
+	.section	.gnu.lto_.refs.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\001"
+	.string	"\001\002\002\003\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5ed04af154dd02a6,"e",@progbits
+	.string	"(\265/\375`*\003\215\031"
+	.string	"\246\362\257I\260X\325p\260B\202=\364\001\342\360Q\250@\205J\323~\336lP,1\214o\277\267\2202\360>\223\200S\376m\237\276\261\225\240I$G\230\201\357\023\036\2077?ME\032\344\344\246\034\032\3755\316v\024\345{{\233l\231\002\214"
+	.string	"\224"
+	.string	"\233"
+	.ascii	"@\013\254\005M\324~f\272\352\377\003\267\232Pz[\360\244\221\376"
+	.ascii	"4j7?M\251\006\017c\203e\213\334}x~\004W\377\333_\356\203\377"
+	.ascii	"\313\377-hN\375S\274\234\273\333\355\0172p{\256\024\302\363\207"
+	.ascii	"\276&@\334\271\n\245+!\275u\367\036\265\334\323'\375\356Lt(\271"
+	.ascii	"\226=\356\363\177\243\220;\034\n(\241\bLZa\033\211\210\355\f"
+	.ascii	"\253\355\321\336\233m\240\355$\333?\333=\333\242\355#\266MKK"
+	.ascii	"KK\2665\330V\355\360J8I\376\032\263H+ \035\332\343M\364\377\t"
+	.ascii	"\026\365h\315\305\313\262\233\262\005\254ien:\251/qH!g\0041U"
+	.ascii	"\2040\267\355\005\361\233\270\253GQ\250\022\253\016\367\363\200"
+	.ascii	"\276\2668\352\253\356\267\245\017\315\253\307\275\334\246\303"
+	.ascii	"\221\252\371\344TS\024u\325DoK\313"
+	.string	"\275\016=}f\211:W]\211:U\035\356\266\227{\332x?m)\016\205C\325\241\347j\342^\316U\207\333\375H\202$\346\264\335\304-g\242/\301SM\317\344_\037\317Q\231?\227\242L\314\241\350\215A\332\353+Z\337\376\302\227\274\377\264~=JU\376\240\005\243\322Q\215\032\241\270G\213\344\375-\020\317\324\330T\362N\364\243I\177s\177'+\277y\332\215\331\215\021u\b\3118\032E\357\013\322\013Dz\207\226\310\273\243hwlo\305\357^S\302B\205\204\312\217\031U\036\224K\311\f\375\030M\361\366\354\231\232\365\341\362\023\375O`jr#(#\024W\335\036[\224Z\236\327hW\003\260\251_\177\365\004`I\224\025\276P\204\331\002\243\270\004Fo \275\251\361\264\251\321<\0348\260\027m'\346j\371\020\243p\323A6\301e\366\272\201\211.\013\256\034\031\005\327\3111\326\001\021\233\251h::3U"
+	.ascii	"\232k\346\001-G\026\202\364j\005\001\006C\005\t$\254\001\016"
+	.ascii	",v\003s\251vf1\021\262\031\007U\216\354\365A\005\233\355\250"
+	.ascii	"\032\300\304H\310,xx\321t.\340\300^\264\235\001\206\311f\261"
+	.ascii	"\234X\007\3224,\006,\233\021-\266i9h9\030m\323Z\255Z\254\025"
+	.ascii	"i\326\312T\304\336!Kd\177&\337\257\242\"\330P\341$\024\255n\201"
+	.ascii	"\221\\\002@ R\350\304\307\020/GR\322\366\310\037-\325\377\214"
+	.ascii	"F\277\036%\026S\211\013#\001, P\002\021\024t\344\001\346R4qq"
+	.ascii	"\007\374\302\370\22121h\275\036\233,\234\325J\363Q\230F>I+&W"
+	.ascii	"syD\253m@\364\002\b}\016\207\021\036vt\220ETXb0\266\320an\227"
+	.ascii	"\311\356\337\262\254\254\025\270\240\261\232\310kb\266;yAri\f"
+	.ascii	"d\250\020dGc/\035\271-\342\332\n\321\3140bh\364Y\326\365\231"
+	.ascii	"\202\002"
+	.text
+	.section	.gnu.lto_.symtab.5ed04af154dd02a6,"e",@progbits
+	.string	"stackTotalSize"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"_estack"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5ed04af154dd02a6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
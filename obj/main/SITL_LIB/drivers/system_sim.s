@@ -0,0 +1,338 @@
+	.file	"system_sim.c"
+	.section	.gnu.lto_.profile.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 =\265\001"
+	.string	"\324\0021"
+	.string	"\007"
+	.string	"\317\253\250\341\002"
+	.string	"\001\002\232\372\246\216\007"
+	.string	"\003\354\301\314\336\005"
+	.string	"\004\274\205\242\255\006"
+	.string	"\005\240\342\234\212\n\006\240\342\234\212\n"
+	.string	"\002"
+	.string	"*\343l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 1=\001"
+	.string	"\350%"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001\002\002"
+	.string	""
+	.string	""
+	.string	"\005\001\003\001"
+	.string	"\020"
+	.string	"\007\001\004"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"5CQ\031g\003X"
+	.text
+	.section	.gnu.lto_.inline.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 \302\265\001"
+	.string	"$\002\266"
+	.string	"\005"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004"
+	.string	"\007"
+	.string	""
+	.string	")"
+	.string	"y"
+	.ascii	"\311\034E\316\346\022\334\304c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 1\035\001"
+	.string	"\270%"
+	.string	"\005"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\002\002\001"
+	.string	"\002\002\003\003\004"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"-\242e^\2542\316\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 ;\355"
+	.string	""
+	.string	"\200/"
+	.string	"\004"
+	.string	"\001\002"
+	.string	"\001\002\002\002\002"
+	.string	"\003\001"
+	.string	"\005"
+	.ascii	"\240\f\220\311e_\220\365\006\260"
+	.text
+	.section	.gnu.lto_.lto.ddeb107e8591ed46,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adcGetChannel.18.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 \370\345\006"
+	.string	"2\31504PO\323\030 \233n\254\177X\317\362\026\035\215J\340D\350xC\024\r\323\310Eg\357\221\230.R\342\210\252\252\0308\016\214J*M\271X\314h\264\270\267L\001\017\324uq\034&\314\323\306\252$\203Eu\244\204\2042R\021Ul\200W\305\261\340\024%\334h\306 \250\b;\030\026\2414W\265HC\361*~z\334\343x\005\330\267\361NZ\311\244\354^\274\270\254\nt\362\361g/\375\317\375AB\246\"\023\277]\215\022\223\335i0\fP\350_A4$[s\323\003\003\001\305\202\244ewB\001\315D\n9\035\210\024z\035\252\251\323V\035Q\002\022\226\317\346Q\207Y\330\335\335g\313\320\237\376\005\277\302\277\005\b"
+	.ascii	"2\003\202\341\243\302Z\025\220k\370\200\211\0201\025\261s\315"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_adcGetChannelOversampled.19.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 \370\345\006"
+	.string	"rM14`O\322\030\024\302\304\203\2678\224\317\007\341\231\024\225\bn\202c\035\266!t\306\323\216!\202\253\013IV"
+	.string	"\200\"\314\273\262s\202\025\276\021e\030\rb\367\226)\022\324uu\"\246\314\023\307\252\344\203Eyd\205\2042R\024U\204\200W\325\261\340\024%\344l\306&\250\b=\030\026\241f\256j\322\346\342a\374\374\270\367\361\n\260\273\373\363x'\0202@\331\325\210\201\331\226HE\344\317^\363?\367\n\f\231\226X\374v;VRvg\3020@\243\177\035Q\222l\315\315\220\215\005\227\214\223\227\335\t\007\264@\322\310)\201\244\321\003QM\235\266\252\211\036\204X@\333G]\306aww\240\215C\177\372#\374\r\377\026\007"
+	.ascii	"2\003\202\341\243\302Z\025\320.\343\021Sa:\327$\003"
+	.text
+	.section	.gnu.lto_IOConfigGPIO.22.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"%\007"
+	.string	"\022N23`o\032\003\304\0255tl\315D\035r\245\306\3422M\001\204\343q,\221\207\347\0202\357\231\215\264\027\310 tP\237\247\35300B\241\253\357F\233H\231R\017\016\224\303\254V\352sYq\341\252Dq\"\276\b+\t\0136<\b\213\341z\024\214\357\343)\026Q\301'\3020\370:\363\316\334e\365X\270\213v\216\232\353h\235\371\377\272\254m\002,\006*\277F\f\314W\246\024\220\266\356\264u\255\005\205\244'E\335\317q\002rk-\342\021i\222\n\017\374Y\b\312?\023\3728\236:]\240\361\3041\201\306Se\333r\200\021\360\222a\342\362\3779\017K7Y\273\304"
+	.string	"\244\322\310m\243\360\277\215T\332p\235\333\"\264\r\265\375\b\t"
+	.ascii	"2\241[/0.\234\271\306C\205\301`n\200\212\022\356\360\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_spektrumBind.23.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 \370\275\006"
+	.string	"\002\215/3pM\322\001\240{\375\f\320j\312\230\325\303\242A\245\311\360\032\n\375\377\206\264\307\323NY\222\242/\242\270\252\310\345\272\240\211/\202L`\035\b\202\374\275S\n\020\325\303\346Z\230xS5\031\253\202\f\026\305\201\0240\341\243$\252\347\220\233\252\301J\315\203\231\301\364\212\240^r\256\353\345%\336.+\306\302]\264\261\323\034Gk\200\377\257\313\332&m\244\030\224\374\032-,G\211N>.m\335Z\2038\004\263H\205\007\376,d\362G\204\346\344\250\321\005\222\243\311\004\222\243b\255\212\243\307=\222\201A\262\362?]\20717\254v\310\002\236O\307-@\341\177\233\347\003r\235\333\036\264Mh\013\n\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_unusedPinsInit.24.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 \305M\005"
+	.string	"\242\t$+pm:\240l\341b\200s\210\340\273:\244\204c\003?\206\232\330\t\320NM\t\203\204\247\376\377\312\\\343J\005T"
+	.string	"Aq\357\224\002\266\252\f\253\210\354\332\352\243\316J/\007F\025\223\201%\262i\321:+\312Z\343\242s\3234:\247p/A\n\"#v\330Ey\261\017X\t\332Q`\001\025D\273\224\022i?\001\217\306\366'sv\350af\317\231H:\243\335\235\022s\356\221\363\2779\301\373\272\307\301aw\035\275\257r\313\3336\330\256l/\002\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 \220E\002"
+	.string	"\224\003\214"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\022\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\023\177\005\026\177\006\027\177\007\030\177\b\005\025\t\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\024\n\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\200\036\340\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ddeb107e8591ed46,"e",@progbits
+	.string	"(\265/\375`\f\017\265J"
+	.string	"\272\201\304\034UP\3202\352\253L\354\002x\346\331\034\2768F\244s#@B8O\365\214\006iX"
+	.ascii	"\b\320\354\020V\245<7C\317oD-\330\305h{{d\363\361\026\273&\354"
+	.ascii	"\257\207\251Hv\360\201\240.LN/\317\203\257,+L\372[e\001\300\035"
+	.ascii	"gA\222\273\333&\231\002\223\001\304\001\300\001\275A\370~rC\032"
+	.ascii	"/\"Rn\366\251\224\033\003\2354\ft\266,N\216\tu\345v\035\370\265"
+	.ascii	"\340A\314\234\204%u\271\3519j\355\303\3569\211J\357K\021P\005"
+	.ascii	"\246"
+	.string	"\213\2333\331\232\33421\271eR\271eM\271eK\331\337\374Q\006\t\0237[\306An\363+\267\251&\267Y\225\333|s\233Pr\233Jr\233L\271M!\271\315bn\023\230;\246&w\254K\356\230S\356\030\222\334\261 y\007\367\234x\rf\203\235F`\256\306.`e\313\202\357\277\276$\216\226(7;F\314\215G\234\261\2600<\342\354\2300\273\273\311;f\262\317\026>\203\235|0\232\247\341\255\243\244%7\333S\310\031|\030\3669\333\247r\273\224\f\344A.\341\237\205\224\271\361Un)'\271\257\204\344\316\302\237[\213\315\255\034\312\275\244\221\177\340\340\017g\267\310&\3569K\340\236\363\007\1778\257\320\330`u\340\345f\013\345\306N\315\006C5\266\202\243\232+6\344a|\251\377\227\307\\B\346G\223\233\375\342\017g\306=g\237\310\230\n\256\202\235D\340\2476\221\242c@+_\345\377\245u"
+	.string	"\223\002\366\345f'\220\273\273\251\001\260\362)\332sc\021'\016\303\"\316\306\335n\244\275\333\207 \035uw\215\346\352n\263\3333\350\306\025tc\n\272\361\214n\034\243\033C\320\215Yt\343\006\272\361\002\335}\245\273\243\272\373\251\273s\272{Lw\237aaaa\335\275\324\035\003\353\316\031\n\304\003\376\227\214De\020\b\276:\322J:\242\n\032\361\373\377!\220\216\230\214/\324\032>1\376?9*z$\024\300W\353\225`-\340\221\245\347\201\343?"
+	.ascii	"\244\177 ~\255\377\007\376\377\214\270\364\376\013\331\031\""
+	.ascii	"\221\220\376\225|\220~\t\330\005\307\277K\271pU\034&\231\214"
+	.ascii	"\265.X\222\310\317\361\0021\362\225Gb"
+	.string	"N\002\241\236\307\377c\257\214,\372\350\362)\355RN/A\202\334p3\212\017\206R\344\230\204\312\215\225j\330,\273\324 \227nTPA\013\016\222*L\r\3102ff\250\325`\265\304\201\370\006\256\344$\270\020G\342J\334\211\373p\021\274\211?q&\376\303Op\016<\210\233\340I\034\212\017\361\021|\311Cp\017\374\003g\362\022\334\350E\234\210\037q\020\334\210w\340G\354\344H\337\321\256\201\363h\363\375\027^u\301o\354E\316\2620\351\240Z\001\263\020\245\3152*\2062c\310\320\260t\244#y\321\203p\347\205LI\310,p\306,\261R\210\263\364Rb\035mIAC\030L\205\301\340\027\f\243\320]\363\240\003\247\276\262j\216t\034\256\343\310\023\362\377\033g\271P\013\2278\370\345\242\234A\314\362\252\273\006VU\013s U\031\031\310d\2751\203\364\202\277\204-axa\311\305j\007Rj\013~="
+	.ascii	"w\376\350\f\017d\232\026\270\2205\277\201_\254\245\304\300\024"
+	.ascii	"\251\023\216\304/\3406X+\211\003U\326,\243\304\340\327C\354\277"
+	.ascii	"\310\027\362\377m<\325\215\251\272M\244p$\256\302\357\354\265"
+	.ascii	">G\026&\rbUJ/\037p\376_\004|\020\330\220\006\215\222J\004\246"
+	.ascii	"'y\017\354\004\344\304\306"
+	.string	"Zp\226\274\026\274\225\203\213\312\200a\272\250\220\273[}\263\256\325Z\374L \301\213l#\241[[T\247\272\355\005mP\313\252F+{\013\332\255\251.\310\306\266A$\n\310\312j\343b\214X\201\"\203\027'\367\342X\376D\245\004t\276\306\344\320\341\246\243\340`\332\261\374\213c\2410\376\007\035\213V\303\177\220\206\261\001\030\033`Na\"a\313i\366\254+\367l\313\312\312\257\220f=\242x\021\337`'\277\222m=a\262\345\213\224\224W\235\031\"\207ov\304\241j\257\332`B\0219\364\251YS\226)\307\251-1%4WM\242\230H0'\224qS\213\357\3201*\335(\261DE9\226\235?ZC\303\322\211r\006*W\332\2614\327\331\302\033(&7=\211\2239P\342<%\301b\"5\261\342C\n\024\024\007#R\361\0037{f\314\355T\274J{\223\2237\371S\376'\002\337\357qN\031e"
+	.ascii	"\203\363JK@4\260e\362\313\251\375\t\267\321\371\001f;\266^ n"
+	.ascii	"\366\033\374v\367\006\031S\fk\254`\310\335\370\374 \361\3777"
+	.ascii	"\220\275O<\3229\261\fc\240\356\0168\206\017\370X\267\210\334"
+	.ascii	"?\220\313\350"
+	.string	"&;\261\n\016q\263\273\177\276eZ\377\302#\320\201cQx\0042L\036\037(d\002\344!\376\0218L\376\363\274P\bta|\236a\362\213\177c\253\210\377=\002_h|\236\027~\360g(<\026\207\311`\221g\230<\026?y\374\235\027\006\211:\204O\344\371\344\021\206O\032\213;\303\244\2618L\036\211\340$\303\030\272\212l\214La0\324P\370IHKA\342\216\326\3605\276\362\037K\341\3706l\251\333\252\350\214M\213l\246\212\301J\003\265aK]\032\350n\215\201\322\334u\007\243\335\2553nj\353\333\371<\334v\353\003:2`\314x!\003\206\316M\315\365t\251\f\237\376q\325\027\266[\332\241m+\253\356T\242\334(T(\240B\3507k\241\025%V\2248[hE\255\266BE-\267\212Z\314\355\"\022?6\210\250\327\323\274\236\312\006\271<\036\033\224\343\242&N\330hS\035\332\366Z]"
+	.string	"\355\217\345\320Ku6V\306\252\267\325\210\307\366n\352\217\315\245+\253\266<?5\327\363\271\300\345\322\"\016\352meY\325\210\207\356\326\037\027\235\021\2455x+J\344\313\365|x\\\265U\331\333n\035B\335\264Eu>\326\265\241\366Z\001t\324\\j\343\340\262\252\321n\265\261\267U'\333\255\272l\303\246\026\331~\251.\323\332\026\271\324h\307[\3354\307\353\261\252\273\203acA\264\252\312\022\251.\324\034\321\216\205.ma\324\303\001p\313\361\212Z\225-\252\241\2726\026\352\215\027\203]S\237\335\352\242*j\331\246\266>\364\307\346\344\324\335.-\262\241?_\212\376R\035\255ey,\253~8]\265\305\341x9<!p8\236\353\263\021\320\256\277\024%\362\r\2517\327\327\333\255 \324\336\005.\252\032\255nj\264\262\352m"
+	.string	"\226\347\332R\034\312s})J\264[\213\\\036O\327\2426\326\347\306[Y\265\207\342z9T\325\245,\016\265\261-\272\266-\033\342\266\242\356\272\363u0\221\373\261-\315mS\034z\363\245Ch\353\033j=\260\273\026\375\261\250\332\372P\\\313\332h.J\264\342v\001\201\035\250qP\246\2242#\"\"\"\222$I:\221\005\3040\007\235u\003\022"
+	.ascii	"\264=\327)\307\2444)d\237\3753-A\243T\n\355\b\222\223\004x\267"
+	.ascii	"\232\267\025\224\375\322`\275\313\\.\212F*\236\325\021\367\232"
+	.ascii	"\220J\022&\013\312\246-\t\327\031lcZ%i\377\311\355\246fj\303"
+	.ascii	"\203M\213\275\260\326\341d\261\307?1be](\376\267w\371(\003\255"
+	.ascii	"\035\265G\206w\335\345\276\363\312W\t\262)g\245\322Cf\027v\273"
+	.ascii	"Dq\200BZ.\266a"
+	.string	"\346\3203\352\244\207D\207\345\207$\321\301\tI\362-\237\327\217?ZL!S\230\f\0338\013\227a\251\346\225zx\020\216U\005~\2129\213\225\221#R\021"
+	.ascii	"\376}G=\315+\370;Q\037\006>\225\262\314\325\261\177\227b\205"
+	.ascii	"lF\274\346\360)\267\310\2110\2404{\254\236\315\035f\343\347\036"
+	.ascii	"\001\025Q$i\020\305\026\021\305\331\016\2654\321\321\314\n\204"
+	.ascii	"\217\223\234\207D\035\244u$\244\260*\322\374\347\034\325RO[\020"
+	.ascii	"J\374O\3125\377*\225\277\023\373\315\001*0\034\337-\304\"sSx"
+	.ascii	"\337\237\030\355\023\247\232A,\211\362\367\311[\327\272\264\311"
+	.ascii	"\253\276\246\373\227\226\f\363\373\205\"\001\355F\2226'*\336"
+	.ascii	"\241x\254\362\361\220\376\206\\\371Nu\316\004\346\"\206U\037"
+	.ascii	"\205\3500J\275\324\026X;^_i\263\263C\212W\031\231\225\364JB\204"
+	.ascii	"\233\274\325\234\323v\357/\367|$q\032\252\227\242\200\206\263"
+	.ascii	"\347\251\221+)t\217\212\232\223\264\240\205\034\222\001 \033"
+	.ascii	"5\305\246\201g\024\t\372\373/NgS\231K\247{\3524XW\261\246\346"
+	.ascii	"\236w\255\022xi;\262\376\020\327\341N\277\035?\200)\212!MK\025"
+	.ascii	"W\331\0306\006\002\321\035\206\203\331\221\256\310\323\332\337"
+	.ascii	"7\304U\202\261gt'\264\346\350\235\375\211\331\330\270\3702\031"
+	.ascii	"\325:\272GG\375\315\177\367\365\217)\246\303\034W\"<\004\317"
+	.ascii	"_\2357\"\214\3153\341'\262O\201\335`\262\245\345\323\200\264"
+	.ascii	"\200a\025"
+	.text
+	.section	.gnu.lto_.symtab.ddeb107e8591ed46,"e",@progbits
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"adcGetChannelOversampled"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"unusedPinsInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ddeb107e8591ed46,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,234 @@
+	.file	"timer_common.c"
+	.section	.gnu.lto_.profile.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\317\253\250\341\002"
+	.string	"\001\265\230\240\355\006"
+	.string	"\002\267\335\335\337\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375 /\345"
+	.string	""
+	.string	"\200#"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001\003\003\002\002"
+	.string	"\004"
+	.string	".ev\004T\002\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375 /=\001"
+	.string	"\370#"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\001"
+	.string	"\002\001"
+	.string	"\002\002\002\002\001\001"
+	.string	""
+	.string	"\002\003"
+	.string	"\002\002"
+	.string	"\002"
+	.string	",\303o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375 2\315"
+	.string	""
+	.string	"h&"
+	.string	"\003"
+	.string	"\001\002"
+	.string	"\001\003\002\002\002"
+	.string	"\004"
+	.ascii	"/F\300,\004d\275\001,"
+	.text
+	.section	.gnu.lto_.lto.cf8ea6107abf6934,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_timerGetByTag.7.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375 \376\035\007"
+	.string	"\222\21525Po\322\030 n\203\2400\025fK\362\026\035\024(\201\223"
+	.string	"\321\213\243\342h\b~\200\265\205{\316\030A}\2667\313\240"
+	.string	"\006\353\004\035\314\002T\2671H\334[\246\025\036\211\210Q[\235O\314\262hM\310+\303B\020$\257\013LR\300\017\346\311\240%A\260sp\264\270$\f\305(!g\256n\225A\306\323\370)r/\344\025`\037\310\273\b\323iF\001f\267\243\206fM\224\013\311\257=\347\177\356\033\0344E\301\370\355~\274\264\354\316\205\0316J\375\253\211\236ho\005s\244$\2601\342P9\355N\370T\202J\251\215\016TJ=\021\335\324m\253\246(B\tK\214\314\nI\244."
+	.string	"bww#RI\177\372'\374\017\277G\b"
+	.ascii	"2\003\202\341\243\302b\025\220k8\007\213\001\331!\342\353\232"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_timerAllocate.8.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"]\t"
+	.string	"V\321A=0\345(\035\200\213\307\326\231\207\2175\204e\344\225\315\206bYp\275<\320c\2724\372\017$#^\333\356\242\r\200(\222}\3514\200\342=P\324\313\224u$\200\266\332i\261m\262IJ\001/"
+	.string	"2"
+	.string	"/"
+	.string	"\006\037-\220\327\200\335p:<\002\347\262\363\003\316e<9x\f\364\377z\266\202\"@\265\352860\261\273\306T+\326\035o{\301v\205\355\232\251"
+	.string	")\022\031f?\274\313\367\227S\366Y\017\222\220\210\316%(s\304\354\007\210\357.\016\307\335\021\033\231\335\260\301\016\235K\333>\313[>\203\ta\213\025%J\353\364\204\250\203\034\020*\246\3540\205E\023\373\331\356\256c\211}\327\377H@\003\200!fW\244"
+	.string	"\201\275\2213*\266?\333c\303\230\376\331\033\333\310\243\330\264j\242\244\255\026\324\315;Q\211!\262\240\234\264\026\362h\327Q\355\242n\035W\232\244\272ipu4=N\324M\255\222fH\3014c\2533\r"
+	.ascii	"2\003\202\341\243\302r\025\020\\Sr&@P\"\214p\204\020\224\232"
+	.ascii	"\007'\n\021\2321\t\223\f"
+	.text
+	.section	.gnu.lto_timerioTagGetByUsage.9.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\365\007"
+	.string	"R\21788@o\323\001X\340\311\006 \037R\327\357\315\377{\363\r\241\214wf\320\226V_#\201\205\177\215\315\336v\235\360o\030\036\340\034\031\335\240\330\320$@`\364G\275\244\355\224\002\023\231\207\323\344\347z`\310>\227\027\2211\306\341\272m\3530\007\232m\032hz4\223\320\250gr\332\265M\214z\223C\340\016\"\243\023\324utj\352\036\2646\026\224\310\256\241H\225\354W\273\273\2466\354\330\220qj1H\331\035\275\270\354\212D1\331\376l\215\355*\276R<`E,\341\002\346\3221\332\017\271\310\367\221\ngv5TNv\353\201\0210\227\233\017X\227\325\005\254K\333NP\370\f\276v\214\254\022\310E\311i\267N\212\343\340#\350\237\344\325\207\207IH\n=\002tv\3271$a\334\324m\027\330\356\3306\005\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\036\026\307\b\367\032\240"
+	.ascii	"\306\230\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\005\t\177\006"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.cf8ea6107abf6934,"e",@progbits
+	.string	"(\265/\375`\213\006m("
+	.string	"\252I\\\020H\200\334\321pO\005\243\352\267 2E\001\237\210\027p\207A\367\222\321\2014\261\370J\275\261\256_\321\2134B&\227-\341\215\361p\377\205\227\3020\255\031\243?Z\335\377p\b\265h\233\226\240\004n\360A\244\333\336\333m\313\024\332"
+	.string	"\354"
+	.string	"\367"
+	.ascii	"\375\344\324m\240\337nc7\313\335\354n\266\273o\307\344\333-\225"
+	.ascii	"k\227Fcw\324\217\261\223,\024\247\356\223\253\013\030\262e*]"
+	.ascii	"\035\224-\346\262Y\274,\267On/\033\215\352\2502\331\254~\352"
+	.ascii	"nNS\227\310\030eN\224\t{\235VW@\306N\364\035\230p\355\274\261"
+	.ascii	"z\303\346D\177\201\267\002\\i\253\210T\316b-\306b%?'a\346Q-\267"
+	.ascii	"\231\335\357\216m8\203\354\353D\201\330'E\271'=\013\2458\026"
+	.ascii	"J\331\b_1V\002Fr\bD\267\261Z}\325\375\342\320\031d:\200\234\350"
+	.ascii	"\033\250=\303&\372\251\236\023\244\274\306\tR\234\237\227\244"
+	.ascii	"?\037\371\217\244\346\347\252\377f\377\261\374\257\362\337\353"
+	.ascii	"?\327\377\255\377"
+	.string	"H\376\337\376\217\375G\327\326\326\326\376\253\370\231\303\217\023$<\002\232J\212\f9Q)/n\212\225(cS*\026Ga\261\267\373\007%k\023V\206T\377\262O\252\252\361\373\037@zV\346G\216\023=\023\325\237\177\332\303cw\303\300y\373H\3249\3430\013\375;l\343\240\266\035\207\326\375b\207\0315\310\327\320\306\211\376\007j\"\335,O\277}l\231Tl\253\244\f\311\363\366\024\201f\346\350\366\245B\242.{\366\333\334E*d\211\366u\217\355\353\262\271.\272l\367\213\314\265\\C\226[&\025\262e\272H\236.6\333\314\341\224Zt\221\355\025\027\231k\231Cd[\244B\362@\355P\216\265e\264lp\226\266\330P\306\344\360\230k\266\257\333h\335\314\345\324\307\240\356\244{D\033\322`0b\023\212\330d\350\362\333\335\005\214D\245\333\305f+\304\355\026B\034\321F\t\354\333l\036\334ds$\003\257"
+	.ascii	"\366\355\0277e\221\030ai\272_4|\206\323\260\031Vc,Nc\261\363"
+	.ascii	"\030&\363\237"
+	.string	"\267\233\301\017\2001e\0265\035\364g\017\225\177\270GL\030\376B\"C\312\2112\230\234\247*1\344\r\365\313\031\252j\305)\245\376\234\241\376\204R\317\305>\351O\242\372&\373\2449\356I\233M6;\273\213\275\274m\351\260\032\243 \252F\261\354l\366\346\004\221*\233:Q\316\302Mp2\216l\222a\254Xa,\334=\354\250\266i\331\341b\r\021Fs3E\212\354\214\305\326E\211\343\352D\371\n\277:>\300\332l9Q\036\343%64\032YmN\364j\334\205\243<\363\345\253\251\236\235\360\223\363\327\277\270\n\003\025{\331\304\263a\220\326\033/\2614\035\225\024R\307\272\324\256\300\316U~\bDLE\247\373\252\273\021\0040;\363\206\235T~\206\302a<\305\326>\271\315\325\375\006\037\341\340\200\260\211\204\260\t\230\212X-\254$R \355:l@\312Y\362\tmI<\241Mi\375\375x#z7\246\246"
+	.string	"\003V!\257\007TR\232\020t \21158$\004\002\203C9B\246\335\032\344\235\b\021\344i\300%\361\220RP\020\256\031v\336\363\005\327\337\232\244^BQ\203\"#\024\267\033\035=8z\220\336\350H\247;*\322\251/\322\331\326]\022O\t\303\232\304c\002\221\023\356\214\204?_\323m\335\005\327\337\211\017k/\330\004dZ\2038\341.\211\207\004\364\335\256\323U"
+	.string	"\002\341!\203\332s\360\003.-\001{\273\340\272\344\023\0161\005W\023\276`\210\241\237\217\2674\324\0132\r9X\260FM:\364B\344\354D\245\274?8`\330\270h\320\270p\227"
+	.string	"6\327D3#K\326R\206\273l\357\362\266Dyd\313\257\3434>\343&\266\254\243\352\225\344*\302\257Kc/,\306\310\351\b\240E\022\2531\034\366\353\322\270\013\007p\250\221(f\2243\206\320\220\f\005)h\222\034\200\002\021\252\253y\021\200\265\241L&MKRj\337\275\247IC\357\n\2307\222\030\324@7\347\373\312\307\347\370\232\310\3633{\353\0329\\\"\344\311t|9\344\r#*\377\272\325\276(\234\257\200\226I\340\033i\002#\310\350\335\225\362\336\256\357\222\374\200\224\r\"%\345\263$\371\206\333\330\206QlAM\022^l\347\320\032c\225\204lV\244\005\221\006/\0357\365\t\362C\372\345\310\2304\241B\006<\2107H\256\006+|\341\211\300\005\037\247>{\341\273X\213\240k\204yN\253\265Xl#\220\t\330R\205@\354\na\233\\T@J\271\f\243\023"
+	.ascii	"u\351\372&sJU\324O>%\264\362G\363\362\3665\214Qx\2665\251\021"
+	.ascii	"\021\333\312\367\b\177\371\bm\016\200\017\372\3422\251\302\316"
+	.ascii	"\346\257#\370\035\342\017"
+	.text
+	.section	.gnu.lto_.symtab.cf8ea6107abf6934,"e",@progbits
+	.string	"timerGetByTag"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"timerAllocate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cf8ea6107abf6934,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,470 @@
+	.file	"vtx_table.c"
+	.section	.gnu.lto_.profile.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375 n\365\002"
+	.string	"\324\004b"
+	.string	"\f"
+	.string	"\313\352\314\217\001\n\002"
+	.string	"\002\001\002\002\002\003\002\004\002\005\002\006\002\006\001\240\342\234\212\n\002\003\004\005\253\312\246\312\f\002\006\257\375\341\340\006\007\234\250\314f\b\206\353\217\201\b\t\203\345\327\214\t\n\243\356\273\372\007\013\301\354\227)"
+	.string	"\006"
+	.ascii	"F\205\201;\320X\212lf\206\261\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375 \030\245"
+	.string	""
+	.string	"p\f"
+	.string	"\002"
+	.string	""
+	.string	"\001\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375 V%\002"
+	.string	"\204\003J"
+	.string	"\002"
+	.string	""
+	.string	"\025\265\307\365\367\002i\001"
+	.string	""
+	.string	"\002$\265\307\365\357\002i"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	""
+	.string	"\005"
+	.string	"\b\306\333\363\317\003g\001"
+	.string	""
+	.string	"\002\n\306\333\363\257\003g"
+	.string	"\003"
+	.string	"\216\302\366P\301m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375 \030\245"
+	.string	""
+	.string	"p\f"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\005\001\001\003\177\002\007"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\005\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375 J\325\001"
+	.string	"\324\002>"
+	.string	"\002"
+	.string	"\004\002\b"
+	.string	"\001\002\007\001"
+	.string	"\002\t"
+	.string	"\001\002\n\001"
+	.string	"\002\013"
+	.string	"\001\002\f\001"
+	.string	"\002\r"
+	.string	"\001\002\r\001"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"M\221(\270\017\f\274\001,"
+	.text
+	.section	.gnu.lto_.lto.1c6ddbfd23f277c8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vtxTableFrequency.12.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375`\035\001\215\t"
+	.string	"F\22097PuZ\003\244\275n\006\3302\226/\371\323\221\030\220;g \225/[\322\006\274,\303-\001\320E\357yRJUUUU\325\016K\1777{O\225>g\334f\220\264\003,"
+	.string	"+"
+	.string	"("
+	.string	"\323I\3277\266s|\357\220{x\016\246]\b\3649\203\017o\243\016\374"
+	.string	"\022\002,\262\223\026_\002\023hg\034\304\233v\206\215a\235\201\247\310UJ\030P\002.\344p\f\334\004\227!z\376\2617\310\364\220\353\"\333G\276\223\310M\256\256\201b\232\336\2765\236\213\366\036\005*\226\347-{\253\246\273\\\177\331\016\363=F.\263zE\205\030q\021mL\305\226\311\363\323\336'\323Q\327Q\266\247\276\001\330\245\353%\333W\276\317\310]\036\203\202.\004\372\374=_\355M3\275\346\272\315v\326\367\226\374&\262\"\212T\341\200"
+	.ascii	"q`0 \300\223\344\213\033bv\310\270a\327\266\006\316F\346>\334"
+	.ascii	"\020Yk\245\335\206\215,&#\232\353pCd\255\225v\0336\362fd\234"
+	.ascii	"\301\206\240q\3253y\212\273\370\212I\273\202/\033\2717\314\225"
+	.ascii	"\271c\257\265 \376\260\212"
+	.text
+	.section	.gnu.lto_vtxTableBandNames.13.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"-\007"
+	.string	"t\f\266"
+	.string	""
+	.string	""
+	.string	"i"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\360\230\022\001}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\330\306\001}\276\004\005\001'B\230\306\001}\301\003\005\001'L\330\305\001}\304\002\005\001'V\230\305\001}\307'`\304\001}\311\001"
+	.string	"?\202\210\2000{3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tRACEBAND"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/drivers/vtx_table.c"
+	.string	"\tFATSHARK"
+	.string	"\tBOSCAM EBA"
+	.string	"\t--------"
+	.string	"\f"
+	.string	"\240\b\333*&\r\326@x`?\220\037\330\017\344\007\366\363\231\337\204\332d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_vtxTableChannelNames.15.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\025\007"
+	.string	"R\214/5@S\323\001\3030\fC\240x?Z\336\342P\3302\f#\0050\212\205C\361\233h\346\203%\237\334r\317@4B\\\240\240(\331u\3420\024\315#\206\260&S\n.H[i\203\364\225\306\322Y\372 \255\2457\0257\021\261y\020\027\236\007v\"\347\341D\tX\301\331(\340&v`E\340\316\202\213\320\353\272\b\005\214\220~H\366\221\223\334\344'O\271\312Y\036\272\313_.z\314g\260\327\\\030\017}\034\032\013>\215\303\3124\3545a\030\366*\265(\354\025`%a\257\212\242\355u*\301\366\032\360\201\351\352\213|(k\257>\310G\362\020m|\214\276\017\364\216k\006\005\312\275\372\301\366(\017"
+	.string	"\023\303\b,\006\370\003\231"
+	.string	"\\A\306"
+	.string	"\177 \023\200+\310\030\340\017d\002O^\331\271\363"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_vtxTableInit.20.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375`\310\003\035\030"
+	.string	"\246)\224J\3000'\035\332\241\341e\350\374\244;\214\331\250d\373\256\316V\373\374\200\004\250\017\023\022\276\211\021\372\336\007~\001\262\366\376\261\335w\314\251\245\0271\216\242(\n\333\\s\377h\202\r[\227G\274)R\350hdm\033!D\356\224\002\201"
+	.string	"z"
+	.string	"|"
+	.string	"6v\371q\313\033\233\306\203\300za\321\016\212\034\265\326\333\202\230\221\036/\006oQ\2749m&\213\221c).\275\361\227N}=,\234\266\341\351#H>\032\350l\344\303\217\320eO\247\300\252S\251\303\217\320c"
+	.string	"|;S\027(I;\n\372(\013z)\322\206T+\016\303\207\203XR\204t\324\343\343Q\361\b\350\373\250S\0266\204^S>\240\323\030\203Z\253)\217\357\347\256\335~\315\366\002{]\002[t\225\001\303\356\317\016\362\350\022\r\215f\344\360\022\331\037\027\336\265rv\251\233\036\352~"
+	.string	"\220\032\346\220\207\020\353\025\254\2750\036\265k\264\022q\341/\365C}\355OI\0250\301\316\244\022\331\351G\271\204R`j\035\220}\364O\\\350?\271t\272\261\371\351\2617\303<k\255g\362\235|\023o\262y\320C\221\234`\365%"
+	.string	"V\235\266\217&\221}\024\371"
+	.ascii	"\362\243x\001\344G;=\256:]\032\203\244;\333\203\2318tL\036n\013"
+	.ascii	"\227u\255\b9\025\025\362c\351\343\221d\177\205\302\261V\bX\375"
+	.ascii	"J\347\362\362B~\334\352\235\343\376\374r\211<\373\332r\367\213"
+	.ascii	"\332\376\355\031\357!\371\375\r\341W\016\335q\261\326ZE\033\370"
+	.ascii	"\267\334\017\231\\:&\217\206\371\217!mW\270\212\230\020`\255"
+	.ascii	"\025\201\237\342T3\276\321GO\250\241\347\251!?R\365F\230g\r\034"
+	.ascii	"\032\266\0014\270\024\026\007;\334\214\256\205\226\302br\"\346"
+	.ascii	"n\024\022\234\204\023\023"
+	.string	"\230\007402\267\227\035N&\267K\271\261\344LVn(\273\227\033I\210u-\270\335\rF\247\333\335\312 \316\227\336\240\251J\007\030\316\362h\373s\254\204\354c\267E\314\366ZmO\302\263\332~\254\f0K\307\344\305\220\027\332\020\336\3055\005dd2\r\311\366\347\273\370\013\017}#\243\030\313XK\247J=\031\346\031\333\237Ax\306\331\356Wi;\335T\250a8\305\030c\202\231\221\tf4)\244\003\260\002\231\261\271\r\021\200%\206\206\246 I\2151\002\317;\241@\303-\344\246)H\313E\335\336\343Q\330#-o\264\017Ynu\206\013\303\035\\\030\360\204\241Z\b\277\253y\213\213\251\301\037\225h]*\373\265[1$\346I\251\205\004\354\037\245\023\374\2348\332V4& \262\300fM\370\205\037\024\262\020\003I\243\355\225b\305\0030\312\024$\325\263\214\347\267\374\273\374n&h\220\0014\365O\234\327"
+	.ascii	"\331S\331\325\030\336\202\246\361b\230\036\361\030\213\304\266"
+	.ascii	"\226\335\225\255\321\205\300\351\361\205s\375\362\304\037"
+	.text
+	.section	.gnu.lto_vtxTableSetFactoryBands.21.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375`\023\001\235\r"
+	.string	"&\232^D"
+	.string	"s\224\016\270\211P&\204F\030\002\307"
+	.string	"\301\205\033\330\200w\024<%B\360\326t\231\230\f6\n\314uE\037\241\330\255\377\3707@\265{jUU\275^Y\302,\363\211d\377\320\007\352\251-\310'{\313\235RI"
+	.string	"K"
+	.string	"I"
+	.string	"\340\276\365\301Ckfw5U\341y\031\3362v\237Rc\347\277\274"
+	.ascii	"\b\304\373L\237r\343\262\001\003\340\343 MXX\270\234\365\250"
+	.ascii	"\362\235\242tY"
+	.string	"\271\236u\004`\214\367\255<j\032\354\256\243\367\215\270\261\333\346l3\260\377 \233\022<\f\300\354\206x\025Y\231\211c\305W\267\377\302g\231\343\303x\330}eWf\022\221\321HyAv\267\344\323'\331'\201\013\300>\345\003`\237\347\330\216\321^`\322]\2052\340Bn\250t\354\206\n\334\311>\335\331?\036\006\273\273\322\t~\305\224\004\306t@q\212/K\265\255\3413PH\300\335=\361e\274u\301o\3714\206R\274\367\351\227X?\220\2425\344DJ|\251\262\344 \001B5e\207\246\250(W\213\217\031+\312\376J\365\313\257\356k\002\333K\\h\364\3618\020m#\376t@\023\"xF\0202\214H\232\210\003\2216N\202Va\363P\320>\234H\353\2208d\001\304i\243P\210\3238\341^Q/\317j\230\220I\321\323\324\2245.\024S\335\021K~U\231\267\013\273\276E\214\036\033\"\221\313\025"
+	.ascii	"2\003\376\031\343\374\343|\330.>c\025\fV\025\266#\306&LK]\306"
+	.ascii	"M\215\t\302\212\254G\217\024\242\224\324\345\240]\034\026Q\366"
+	.ascii	"BU\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375 \220\335\002"
+	.string	"\024\004\214"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\024\177\016\370\354\254\325"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\020\017\201\204\001\022\020\023\021\021\022\002\025\177\023\017\024\016\025\r\026\f\027\005\013\030\n\031\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"c\310\003\f\f2\006\031\203\f\177\365\t\030\030d\f\022\217Vy\002"
+	.text
+	.section	.gnu.lto_.refs.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\001\001\001"
+	.string	"\001\002\005"
+	.string	"\001\003\006"
+	.string	"\001\004\n"
+	.string	"\001\001\013"
+	.string	"\001\005\001\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1c6ddbfd23f277c8,"e",@progbits
+	.string	"(\265/\375`Y\t\3655"
+	.string	"\212b8\025E`\250Q\007\253\022 \020\240\356\032\200RK\303\325\260\214\037\001 \001\200\224\343\266\241\210\332sB\304\356\305\360\343\321T\341\341\331Fyf\342\345\362\370\350\307?\267l\007\207E\363sqe\342r\205vl\312&S\n\034\001B\001C\001>\306\311\370\363\310\315\264\207\271X\347\332\367\337\377W\207\235\b\n\303\304y\347\276\024'\251\355e\272\207\366\026ZU\333\217R\334\333\233\037\245\035\346\276\024\200\363H5\216\215\341\002\003Vt\003\332\244\n\316\355`\335\336\364/\336\265\342\337\370\377\006\004l\301\322\021\004\347\007\356Ks\336K\375\353\327\316\354\245H\253\367u\371\b\033\017*8g\357yu;\027\347\362.\234;\245|\347\377\313\023\342\222&\313\211\263wa\367\342o{\227wi\n\026\232\310\370\\\377\257w\345\377\326\275\201"
+	.ascii	"\367\0069(\224\226\231\346\306j\277\356KU\357\245'\272=\315,"
+	.ascii	"\032\246\273\331\272\275@\267\373\326|@w\343\272]\355v\241\356"
+	.ascii	"\306\335\270\327\355\272n'\352\366\241\356~\353nA\335\355\247"
+	.ascii	"\273\363t\267Zw\323\351\356hw\317\351\3568\335}\242\273\327t"
+	.ascii	"\367\233\356\026\353\3563\335\375\245\273\275t\267\211\3566\353"
+	.ascii	"\356\262\356\036\353n0\335\r\326\335ow'\350n6\335\235\276\275"
+	.ascii	"\275\275u\373\256\333\277[HK\306g\277\331\\\"\335f\224$\357["
+	.ascii	"^\026\343R\371\3156\271\333!\215\317\272\357/\223\356/\337\200"
+	.ascii	"\333l\331o\266\317\373_\276\373\306\027\271s\233\313\244\333"
+	.ascii	"\\\262<\367\225\357\032\225T\273\177\227\254\373\005\215\345"
+	.ascii	"}S\231t\337e\222\347\242}\005!\003\363\001\304\341\270\306\337"
+	.ascii	"q\274j\221\2733\367U~\364\337\235Q\217t\360\177\245DF[ \036V"
+	.ascii	"<\333Q$\323*\375\375\177\004\307b\226\362\215g\356\226\362\177"
+	.ascii	"\253\370\342\217\025\330\367\354\231\370\031{\344\352\247\242"
+	.ascii	"\376\023\034\377Y\377\263\377g\377_\by\365\376\013\331\271Z\307"
+	.ascii	"\343\277\325\201\343_\261bQ\377\330I',\3516\263\224?1\260\246"
+	.ascii	"\326K\275\254k}t\211T\233\254\327O\355Q\265\222=\364\234\231"
+	.ascii	"\ra\361\0215\303\271\335\254\333\335\370\033/#*\222*\323\032"
+	.ascii	"q\306\275\373\322\244\346\257\275\r.\232\024\253bS\346Q-\"m\312"
+	.ascii	"\326\350\270\370H\362\344\345\032\022s\263R\205\263\247q5\355"
+	.ascii	"d\016\305\261_\357d\025\224\377\255\223\351\002\375\267:\367"
+	.ascii	"\006\356\r\362\226,)b\322\334\030\324nG3\226[Ny)\031s1~\306\225"
+	.ascii	"Y\212Z\361\t\316\001\255\027\333\215+j\273\233\273\240\247\013"
+	.ascii	"r7\243\267\3121\255\212\2528\335\264\341\334x\251\272\033\306"
+	.ascii	"C\216\004\224\361\261R\346\326\355\177\034\220\223\245\256q\271"
+	.ascii	"\205s\222\373\322\324\265\270\357y\372\036\367c\364\316\367Y"
+	.ascii	"!f\020\251\2666\035\224\035j@pn\367\323\355|\274\017\2062Q\312"
+	.ascii	"\301\331\271\374\332\331tif\372D\3019\277N\034\265\266\346yT"
+	.ascii	"\366\221\354\373<\374\213+\3256d\006M\333\342x\332\363d&v\252"
+	.ascii	"\352\340\334}\274\253\273\207\210rP\215a\335\261\323\355_\256"
+	.ascii	"\346O\267\323P\243wz\310\"\262"
+	.string	"\304\205\203\n\316F\356K\333\313\350<\235\216\233\251O\205\374\300,\342N\254\2614`\321\247G}L\375(\344\022\023+\300\033;\357\026*s\236>\307\3014\274\326\207\264+<\217\264\212@\"\371U\304\271\375Jm\207\343h\355iOO\3638\275\373W\026\377\261\340@\360\032$%\326\366VV\017\362\213D\016\234>\355q\372\016\321+\310\241mE\021\203s3\251\335\335\236~\213\374\177\252\334\373\310\"Q{\316\375Aw\221\343\334Aw\347\377\242\350\377q\t\037\265\212\231v\b\316\335m\364\001\336\177\236\033\304 \224\260\0031\b%\354@\300\006Sp\205\222\261\016\227xO\303\225H\\C\224X\362\300a\203\204\364i\205\001\024\341\264\006\203\300\027\035\b<\021W\023\006\236\234\326\031\253\323\312\002\030\342i\205r\002\246\030\2564\204#z-\202@\0166\206B\"\023p\351\311\327\fZ\030c\035\"\021\205\302!R"
+	.ascii	"bS\020\304\211\032\304\031D\315\3244\\\203\253\013\265+(IP\272"
+	.ascii	"PC\250/dH\312\220\224\366\205\f\277_"
+	.string	"\006\245\237\332J?\334\020\370\202)\023U(\375\210\301&(\265\177\277\016F(D|P\231&\254N,\200D\0255\2103\220\236\206\353\214\246a\013\244`\023\020\006\022\323\360\ti\302\002'\241\220\203\212\034\220\037)\2301\246\026\316\215\177\364k\304\013\n\024g\n\277\306Ui\0264F\376\370\300=\274\\61\270G7Nb*'[\321\244\252\207\323}\351\320\3211\017\036C\377\3135\2555E\262\343\232\232\3039\034O\341\251\206\3427\356\336\330\244\r'\204\312\021\2662U\365\206b\326\237\230\3058\362\343p\363\326\037\334\0205\246\031\306\321\215[\\\304\256\023)y\222\245\305\271\261\333\215\243\260\024\231)n\210\244\301\331w\336K\261\361\327\370\306\2022P1\234\205\274\227\346>\314\251\276\275\271\272\200\250\250\201(e\214DD\021!\"\t#I\222tP\002!c\352\310\r\021\2001\202lh\n\222f\177\003\220"
+	.string	"\n\306\025\024\216\254\264A\353\370B"
+	.string	"\216\3652\223ap[\223\353\003H\377br\366\200\303\334\357<M%\257(\204\251\327\346L\240\317s\356p\330"
+	.string	"v\371\203~\017X\023\240t?\323\334RY\317\366\367\377bE\b\2564\224v\357\320\325\225Y\255\b\336\222\266\261\366\002\256\244\t\\\263\366\234\004M\274\0356\226\341\237\363\331\243\007\203\337\206\017lqu\234\351$*\f\265l\212]\032\237\243\264\321)G\b\022q\224\022\202\032,\374\246a\304\253\345\207\243\003x\366\\}\266\231\021\312\247\020\215\017=\016W\0307\224?u\0201?\302\225\361\232z\323\263\214\325\344\356X!\337\366X\243\375\250\200\220\rg\256\266\351\003'\226\270\352.\352\024T\034\022s\372\255\300\252K\310o?B\177>/\321G\341\276]"
+	.string	""
+	.string	"Q\003\346f\223x\301M\231\377\340\240w\376\372\315\244v7r\"\270\206\320?f\300\261\354\221w<\267\\\211Rp,E\216\257\273\035b\t\027\372\341p\003\244\213GQ\374z\313\320$\375\211\346\fZb.}"
+	.ascii	"\366\376n\310\277|O\026\234\332o\343\b\270q\356\311\327\343\250"
+	.ascii	"r\0266\bq\311|\342\277\305\310b`U"
+	.text
+	.section	.gnu.lto_.symtab.1c6ddbfd23f277c8,"e",@progbits
+	.string	"vtxTableInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"vtxTableIsFactoryBand"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"vtxTablePowerValues"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"vtxTablePowerLabels"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"vtxTablePowerLevels"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"vtxTableSetFactoryBands"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"vtxTableChannelNames"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"vtxTableBandLetters"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"vtxTableBandNames"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"vtxTableFrequency"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"vtxTableChannelCount"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"vtxTableBandCount"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1c6ddbfd23f277c8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,504 @@
+	.file	"controlrate_profile.c"
+	.section	.gnu.lto_.profile.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375 `\235\002"
+	.string	"T\004T"
+	.string	"\n"
+	.string	"\206\214\261\346\016"
+	.string	"\001\265\376\273(\002\363\341\340\230\f"
+	.string	"\003\240\342\234\212\n\004\235\205\271\212\n\004\002"
+	.string	"\002\001\002\002\002\002\006\007\200\242\234\020\006\b\273\305\341\276\004"
+	.string	"\t\315\326\216h\n\240\342\234\212\n"
+	.string	"\004"
+	.ascii	";\023\334lE8E\331@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375 ]\325\001"
+	.string	"D\002Q"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\002\001\001\004"
+	.string	"\001\007\001"
+	.string	"\001\b\002\001\002\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"6\303\250\212\364\313% #\317\r)V\333,h\003X"
+	.text
+	.section	.gnu.lto_.inline.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\205\005"
+	.string	"\362\311\035$\2207\351\177\365;~\306n=p\273\273\022\035\224\025y\257\270\215\335\317\306\363\356\356\024l,Rkd\023\271S\377P?TWs417|Pv\367QA*\347\366\317\334\243`\352\r\331\035\024\254\341~R\023\231\tx\201\260\177\021\033\037\221\231\323\367\177\365\256\037aE2s\271\177\377P\353\317\301\377^\250\231\231\312Kk\"a(\230\376\025\326\242r4\232g_ \027"
+	.string	"\251\020S\210\001\002i\325d\314u\2002\200\005\346\272\231\250O\205k\ty\223\b\254\004D\260K\r\002W\205\327u\005\214\246\","
+	.ascii	"\354\n\301\263\2412N\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375 \260\335\002"
+	.string	"\262\204\016\027\300\245\320\001?X\275\351\037\374\364\365\377\203^,\246\221M\366\226)\005Z?"
+	.string	"\207\320\231\360d%\253\300o\026\305\026h\265Ao\320V@\023\255\315\341s\2544\254\344\035\034\004\f"
+	.string	"BH"
+	.ascii	"\366\240\260!\326\345\241e\254b\2029@\201%\205b\227O\021\222"
+	.ascii	"Y\360\006\332"
+	.text
+	.section	.gnu.lto_.pureconst.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\230\004\004\230\004\007\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375 sM\002"
+	.string	"\324\002_"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\005"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002\002\004\001\002\b\001\005"
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\007\002\b\0071cO313"
+	.string	"\013"
+	.ascii	"\270\001\020\256\347\306O{s.J1\222i\257f\0164\013\007\243\f\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.lto.307695b95b638c35,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.29.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375 \252\335\004"
+	.string	"\244\bl"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\255\250\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\314\030us\326\007uq"
+	.string	"\005\001\006'\001\314\035\001\006\214\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\005"
+	.ascii	"0e(\025<\314\242S\024y\003(\002"
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.30.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375`\205\001\365\017"
+	.string	"\266_nF\360\260(\035\272|\270\334\327\001q\006c\373\030(\bC\322\217\332/\277\342\t\361\331\023|\224\231\327\252}\255\026\353\350\341\361c\035v\326\265\237\214\303\344a\334\311\201*&\230upw\320\264\271jS\355'{\313\235RY"
+	.string	"V"
+	.string	"\\"
+	.string	"\237\006/\332>?\037\260}ze\327 p\022\300\006%F\307\356r\032\302\333%x\313\270\372\224\032W\376\354\361\233\toj>\326\247\004\255\270\200\021\360\235\310\0064H\314N{L\371ZQ\272\260\\O\273(\326\272\251\371X\036=\016v\327\361\365\255\334\333m\227\330\216`_\0264\0358l\260\302l\320e\277\347\341-\037\255\032\0355\372"
+	.string	"T\005eFdcWe\207\307\316\230/b1>\264\037s\320\2479\364i\303\\\305\352\241krW\210\274\310\310\331]\220OC\370|\032\220\017\331~\264\377\362\024\253\3132\374c\027\246\323b\027\\`\006\237OP\313\341\372\360\211\227\371e\316\"U"
+	.string	"\207\210]\327_>\315k,\310\217\3704\206\324\366\327\247\237\332>U\355\222\013\361/\233j \\\312rT\217\252\252\207\232\353\304\201;\306v\215zW\211V\334\261\324\353c.M\330\304\302\233\231\036&qG\025\005\316\215\035\252-6\310\212\n\013\247S8\231P\335\203\222j$\341\303\244\220\322\310\311\324y$\023J\252\2217\322y*TG\342H&\016u\032U\340H^\212\013A\340\216\244\344q\252\256\363\270\020\270W\230?\273\210K\216N\216\211\266\246\266\330\003CA\2528\021\344RSl\3276\251\227\2058\032\342\216\313\335]i\005\227\n\322\323\002\032"
+	.string	"\2423\341L\213\201\032\3224xL[v\277,\201\025\022\263z8\301\342f\332\203i\223k\206\020\342\260\025\005\212\313Ah?Uk"
+	.string	"\021\253\3566\253V"
+	.ascii	"aqCD\331KW\215\007\024\021\3235\237"
+	.text
+	.section	.gnu.lto_loadControlRateProfile.31.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\r\013"
+	.string	"\006TJA \247j:\227\305"
+	.string	"t1\200\b~\023\310<\365\345\215\017\327I?\324\005\201\r\207*\022\001O\374\332\013*\267.6\232\205&<\267tF \001!D\362\317,\020#\334\272\005\34080\243M\366N)2"
+	.string	"5"
+	.string	"="
+	.string	"\256\240J\356\325\036\331\334\3539\223l\005'U\373\026\310\351\345`w;:r\322'\311?\353\025\021\265\361\2310\261\273\236\"\312\343\246\267\315`\273\302\276D\376\204\346\305W?\264\275\236>\204\224\017\306\322\234\331\244iR\021\373\332\322\224\255Mktz\316\351o\333\211l\001\301n\307\f\302\306\352\001\022\333\367\001|\034=%\254;0([\t`\r\306\023\020U\003*Q\343\003\276\272@\265\273\021\256\277.2\032\315\366\252\321\217\257%2Wi\002\3738\235T+O\021\314\271"
+	.string	"Pa\227\003\302'\037 \303_\275\006\306\360,\337&\203\001C\217\305\007\272\204\0330\004u@\257\3630]'s\341t^\370\351,\r\006=_\330\201@0\3548\262tmi\312\024(\261\0225Y\243~\201\303D\376\312\027\317\013\025"
+	.ascii	"\020)\2022\253\t\274\030n5\370M\330:K\210\tl\334\232\to3\020"
+	.ascii	"\0308\021rye<\244j\320\205<\004c%(\333NY\276\264\013\316\271"
+	.ascii	"\2050\237"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.32.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375`\264\001\035\020"
+	.string	"\226]jG\340\262(\035\322\246\207\016\034\216\325\204\366\367_\362\2255J7\346\352\034a\211\273\261\247|\377H\243\212\352\377\372\276\361\270\225\310\330\331F\214\214\236X7\344\214y0\b\207^2#\2461 \n\320e\304od\223-S\nP"
+	.string	"T"
+	.string	"["
+	.string	"\006}\036d[\325^\320@\365X\312r\267\305v\263+S`\006\237O\253\354\033\227\301\354\307\026\026\026<v\327\223&\256:'U\345{F@\304\327\352\\\210\313"
+	.string	"/\027w`w?s\355\360j\251zFv\327*\276@\334\363\266#\330\006\355\353\004\335'"
+	.ascii	"\227\030;$Xz\323\335]I\t\233Ou*\tx(1\322pi\017[\326R\t\263\317"
+	.ascii	"\255|\261;\365G\325\236\251\346\036\3735\244\323Q\243\300m\367"
+	.ascii	"\303\315\307\346L\234\023\266\357\253\370\270\362\025\006y\325"
+	.ascii	".\373\314V9\215)\310H\261\273*\366\212\003\335\347gO\220\243"
+	.ascii	"6\332\240\351\214\2779M\333E\323m\242\211\343A\355/F_II\367\371"
+	.ascii	"\221\037o!6\302F\006\005M\004'=\222\253\261\374\370\314&wA\372"
+	.ascii	"\354\272h\234\374\354\234\214Km\207\206\2457N\302\244mr\233\224"
+	.ascii	"\001\230\335u\340\327\274\005\212\037\363i0E/\246\004\336\300"
+	.ascii	"\341\323P\2220\341C\211*\f\360H\344;!\221\200\241)\364\241D\341"
+	.ascii	"\t\030\242J\340\310\033\221x%\222\b\305\033\205'O\004\201A\323"
+	.ascii	"\027z(\020\f=\220\214un\345\213!\354\310a\311\226\005\250}\001"
+	.ascii	"\203^\364g\036R3#\247%W\376H\037\3470N~\2143\204\364b($ P\202"
+	.ascii	"a\314\314\003\200\211\316`-\312\2042\323\331\0306\263\262\322"
+	.ascii	"\324u\227\311\2131\262e`\257u\221c\234\320\\\317x\254\271[VX"
+	.ascii	"*Q0\324\212\335\241+\215\205\303\355\006k\242\321\204\016\036"
+	.ascii	"\233&B\215\022\r\374\335\331\216\312\305\001\336\367Q\nklW(\003"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.33.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375`0\001E\r"
+	.string	"\206XXB\020q\233\0163\030\200V\301\225Qw\013!\271\312Lx\r\204\026\247\260\271\336\323\006Sz\037\006}\363\357;\271\321a6\275>\350\324\004\245!\264\202\026\0204#\211T\300'\r\005$\266\337\233l)S\nD"
+	.string	"A"
+	.string	"D"
+	.ascii	"\266\214\227J\354UH\036\013\032\273{)\211\177NA\315\217_e0\242"
+	.ascii	"\017t"
+	.string	"\352br\b=XL^\201\321\210\032\326G\222\n\340+\201\036\273\373\224\247\206\257\313\2542\273\353\024}\036\356x\333\021lS\260\277\t>\\\035\331\231\306\034\345\257N\372c\246\241\246U\323\251\351[0\305\t\002+\273\034N8\326D\271@a\373\226\215\342y\200\355^\230p\220i#P\3609\311c\335\025\301\322bw\305\001'\270\234\362'\nr\245P\253\250\030uz9ByrK\207\023\fXi\324\001\033n\344\356\202TOlg\210\252\023Tb\220\244\r\247^U\251\025\357\303K\2574U@\013uO\214z=\210\0203<\025]\236\354R\227z\342\330\326\351\300\220m8\r\036d\234\006\302\002\256\263\3510\366\221\211\204\200h\333\210\204\214\323l\"\332\306q4\354\302@.N\210\246\302\205m\235\353\303\200\265\221l\2738M\333.\253\024:\\\035\231\201\211)\244\035\025\023\332\302\205\274\310Oy\246$\034"
+	.ascii	">\353\341\211\265\365\0348\023\272\223bT\030*\365{\271\320CP"
+	.ascii	"\213\275\210\007\267\200\264\240\r@!>\302\004\223\031\316\232"
+	.ascii	"\203\271\206\033\314\002,\302\030\2400\030\246\317\300\301]\002"
+	.ascii	"\006\254jd\315\220\333U\364"
+	.text
+	.section	.gnu.lto__reset_template_47.0.35.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375 \250\235\004"
+	.string	"\"\b\037*pe\322\030\200\323\363\r\300Q\326\b\206\252\252X\264\220\003\020\b\004\002\201\n\300U\025p\257\237By\361l\177\003\246T{'\031\226e=U}UU=U\247w\026{\030\203\032\207\034\317\307\"\310\243\310$\311\245\311\033\345YyZ6]0\007\\\031F!\216p\020\220o\306\355\024l\252"
+	.string	"G\355\317\232b-\2419\\\031F\275n\003|\t\247%|?\302w\343\234|\265\240\252\234\b"
+	.string	" D\352,\tva6\004\302\236\272,\241l\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.part.0.40.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375`h\002\r\022"
+	.string	"\026auH\320\362&\035\243\307S\331\352\231o{\252\272\220\311f1\334 \\a\355\031\325\0316\367\237[\214\tr|\0332\215\275\217\2214-\034BW\310\336x\200\311r\350\220\365(\315+\357C\033\276\341\250\332\227\274!\262\211\334)\005["
+	.string	"d"
+	.string	"b"
+	.string	"\002V\326\203\205\212\312\007\331\004\345u \232\213\233\243c\225\266\t\n\354@4\326\335\023K5v\207\030|\372$\365i\337\307\366K\3070\373\307E\332~\374\271!\202\332\335\356SU\034v\225\033\314\377\370\221\331N\354\n`\307\303%\201o\")\273\353\324\207{\3366\212\355\016\266$\021\252\322\362B\377G\006\230\360\330\315\031\"dQL\245\026I-\031\267x:\032/\273Rd86\033R\t\246\037\250\325 .\260\355\3178\322\214]\212cS\223\342d\344p\363\002jW\354>-\376"
+	.ascii	"\367\231z\001\316\367\217^\223\371\220\r\320d|\242\027\315|\310"
+	.ascii	"'\261&\030\273;#\375\361e\253TB\242H\363\255\231D\253\331\341"
+	.ascii	"u\260\346\023-\007\247\257}\302\317\246S?^A\254I\346\303(\252"
+	.ascii	"\3508Z\232\3444\313\360\033,}r\332\335\0066\256t\301_\361\351"
+	.ascii	"\227O~\366q\237\252/\272J\320\210#\037\0212B\\\245r.L\030\335"
+	.ascii	"D\325\310!R{\254\333\267\335]+\217-\"\315\251\364|\320\277q\322"
+	.ascii	"\001\266\260\002]$\030<\026\030\b\021\274pE\202\203\320\305B"
+	.ascii	"\342U\211\347\302j\371\300\030\n^\270\002\272|`\b\363\255\272"
+	.ascii	"UK\007\303Zy\351V\240\253+I\340/\306\003\273\360\373\300Ne[~"
+	.ascii	"[\345\361\003\020L5*\263\252\366\330\016 \021\334K\234*\247\266"
+	.ascii	"WA~\346\217O5\305\330 @6h\314\257}G0 \300\002\231$\316\001\274"
+	.ascii	"H\340\324\303`\335\315\003=$0\035\216\341\217b\364m\354\252\334"
+	.ascii	"\272\207jib\007R\334\032\3033\030\265\203\001\006\341'\352\303"
+	.ascii	"\306c\023Dv\321\241\200Z\213/.r\036\034j\006h\013\335;-0\337"
+	.ascii	"\033\233\221\230\340I\252A\273[6E\223P\215\325,\274\225\267\331"
+	.ascii	"\002\250\275p9\245\323\257\245c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\005\006"
+	.string	"D\t\036\001"
+	.string	""
+	.string	""
+	.string	"\002\036\177\t\210\214\225\311"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005#\006\200\204\001"
+	.string	""
+	.string	"\003\002(\177\n\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\032\013\201"
+	.string	"\002\037\177\f\272\200$\r\031\016 \177\017\002!\177\020\035\021\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\033\022\001\"\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\001%\177\024\003"
+	.string	"\013\372\363\352\266\003\001\204\001\003\002\013\244\001\003\007\344\001\003\b\002\344\377\220\375"
+	.string	"\001\202\006"
+	.string	"\020"
+	.ascii	"D\313D\036\006\345S\004\370LAF0<\277y\f\031\202\260f8\b\240\003"
+	.ascii	"8\274T\340#\f\030\234fT\370'\204*\003"
+	.text
+	.section	.gnu.lto_.refs.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\004"
+	.string	"\002\002\002\003\002"
+	.string	"\002\003\004"
+	.string	"\003\004"
+	.string	"\005\001"
+	.string	"\002\003\003"
+	.string	"\001\006\004"
+	.string	"\004\007\001\005\002"
+	.string	""
+	.string	"\005\003"
+	.string	"\002\003\005"
+	.string	"\001\006\006"
+	.string	"\003\t\002\003\002\n\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.307695b95b638c35,"e",@progbits
+	.string	"(\265/\375`R\030%v"
+	.string	"\312\306\260+R0\222:J\007\224\210\n\226\230\016\004~\032\361\232=*<5\346\327\342E\363F\035\004^Fo\375\013\f\364y\264\331\320^\346\377\246H&[\251\370j\023\263\372\\\307\300\334\247\270\353\356&\316\374N\276\363\336\235\363\377\233\2264]\262&c\337\020!R\246S\002\250\002\277\002g8L}2D\254\321\237D\354yN\3317\317\242}\263\331w\031{\326\223\207\223Av\234\340i\322(\377\300x\230\251"
+	.string	"\303\235}`\264\373\020\227w\331L\364ha6\372.\263g\005rg\\\034+\220c\037\216\316oec\240\3624\332a\366m\305\376\2141Q\035^\0031\246g\215J\243w \r\034/;\274\365\300i\374\206\341p\033fc5\236\303r8\016\273a:\314\3445Vs^\303l\316\313\263\231\2639d\312\254\235\341A\r\r\215\234-dx\306\264\300\261\330\177\224C\036\007~\276\202\003\207\001\235\367\026\321\303\005\243\001\030\274\306M\016\343&r\002\2578l\367.\317\\\376\2435\376\302cN<\335K\244\241"
+	.string	",6a\316\336\356\275,X\024\261\310]\321r\3626"
+	.string	"\312F&\312\r5\224=\337\261g6\366\\\306\ni\261ERl\nFbWp\017{\036\363s\027\366\302f)\334[\274\367\n\2203\026\225]\215\262\016,\346l\306a.\233=\220\274\227\310fAy\356%\0061\253`V\201z]=\331\222C\317:,\227\035\235\301\220\310\035\221\313\033t\246I\201\t\322\250\217\223}\301D\271\034\223\310\311P\355\323v\366lL\224{\007\366oL\224\343%ca&\n\006{\0030~\016\263\334\257{\227A#\366P\331\003\327\350-\260\347,/\200xa<"
+	.ascii	"{F\221\3438F\221{"
+	.string	"[!+?W\341/\024\247\221G\362\216\335\273\034\nZ\n\211\302j\364K&\312Y&\221K\301O\202\376\006\340g\022?\227\370\231\200\237\205~.\3729\200\237M\374,\300\317D?\017\375\214\002\375\237\347\347\240\377C\177\357~\216`\311\317J\256\373\373\002\254\023M\305\006\374L\301\333\\\221\360\377\304\317\312\034?\027\371\331\005\362\377\t\377\371\333\204\237[\370\371\306\317N?\273\360\263\360\347\246\237_\370\031\006\252\237S\3709\3703\013B\376\013\375\r\367s\220\237\247~\226\341\347\030~\236\361\263\007?o\360s\006?\323\370\271\202\237%\370y\201\237\033\370\371\305\317F?\247\370\017\366\363\001?\253\370O\347\377\327\177\242\377g\377m\\\\\\\334\337\013\374\250\230\037\200\013\002M.>p]]\245\253\275r\367\3622\351\343x\221\307\0255\324\320^vX4\005\335\242\342\306\204\312\333\013e\0037\303\227F{J\337"
+	.ascii	"\"\316\332Y\030\033\256\356\310\371\322(\033{\0371\333Q\320\037"
+	.ascii	"f\320\260\246\330\277\241<\311e\301z\263\325\350\231\n7\326\333"
+	.ascii	"Io\365\223\nt\030}\272\320\260\335#\220\026F\226\305'4E\222\215"
+	.ascii	"\336\007\313\276\221t\222\267\222+\351&\366\336\343py}0\331\262"
+	.ascii	"\207=o\027\211\\\221\304v\344\215\311\273\311\347\210\270'"
+	.string	"|r|q\221\322\350\335Z\353\377\217\017\235\254\035G\255%l\345$\007\224\221\0208\212mn\032evV\357\270\302\344\t\2244\366\357?w\211\307{\357\017\237\345=>\2118\3730\257\370G\360\311\007\374G\357\371\233@\341\336a\227\244\035+\345\013\261\252S\334\3734\357-*\207\025(\245\212J*#\230\362\016\213[\303\241\343U\016\215`\367\016\335bq\210A\362\016\031\301\256\324\305\241F\212\357R9\274\305\344\035\272\305KLa,*\245\214`D\251!#\230R\352\202)\257\320-\022\217:\212\3678t\301\224t.XRJ\310\b\226\2242\202)\207\260\321\350&\212\024\227\344\225\017\306b,\336\036QV\304\243P\323\270L\336\264{y\f\352\036\017\270\327*yL#Rq\331S\263\307\023\027b\222\227\367^\023QOW\311[l\032\273\222\367v=)\335\250\007\206\313\346]\302\315!\226\325\345\001u\357"
+	.ascii	"Q\367\016\3716\357\275\303{\257\356h\265\274\227\006!#WT\324"
+	.ascii	"\275\310\242\250k5\004\003uo\217\301)\2232\202]%\217\300\210"
+	.ascii	"\201q\335\034\313!s\3354\345\321\202\r\261\\\036m\226Kj\252\216"
+	.ascii	"\022\273\374\022\341\303\007\223\244\362H\253\211u\351\320G:"
+	.ascii	"i\247\213\211\217F\215\024\201\250\262\025v\326\350\321){\007"
+	.ascii	"f8\223\243q\020\325\270\366\300\365T\003i\252\266j\251\036\322"
+	.ascii	"A\232\206F6\221\026\322?\272\b3\273\252w\274yt\324\273\255\270"
+	.ascii	"6\326U}9\0177\263*\370\372\201\255\253\032\252qx\315\351*\276"
+	.ascii	"\303z\270\231\205~\345aC3\366\220\370\345\246\207\255\255\253"
+	.ascii	"\272G\037\271\211D\273\366\260\335{[G\234\256\3428\016\003\032"
+	.ascii	".\013\300c\344\353\206{\227,X\260(b1\202\216\025\233&'\320\367"
+	.ascii	"\361g;\334\306f\"\264\202L\241i\224\253\034\275}\004\255\371"
+	.ascii	"\342\266\245\306\366\221\211r\007x\261?\305\354O+\366g\024\373"
+	.ascii	"S\313\376\274j\034\177?q\247\221\240:B\216T5zZ\235D\246pmy\303"
+	.ascii	"\274\332\034)r\302\\i\364\244\341\254\n\312\342\322\242\303\327"
+	.ascii	"\316v\fz\353z\2033\344\234\352Q\005.\tr\251\263\001\351U\206"
+	.ascii	"\252\tj\203\017Vm\215\006\371\2034Sh\230\205\216\326\r+rQ\254"
+	.ascii	"\020\031\003g?\374\211\343\034\236S\347\032\021\307a\226\353"
+	.ascii	"CGFE\t\362\355\032\221+\200\236\312\202X9y\374\234\372\371\243"
+	.ascii	"\001\030W\373%\021\023k\364\224:/i\0233\3728\217P\344p\331s\306"
+	.ascii	"\236=\030 \202\347H\236\250,5Njh\264\317\035W\353\25005\020i"
+	.ascii	"\364\234\341k#\270`\311\262:u\234hWk\236\032=\241\316\034\314"
+	.ascii	"\374\331i<P\230\034Z\316\314\354e\340\237\345\316\247\237\305"
+	.ascii	"\377\347'L\021$\312.\366?\211\377\217n\213\233*\2561{\213%.\256"
+	.ascii	"\227)\356\230\320\275H\214\224\241b\316\246\310\\\331.\3573f"
+	.ascii	"v\227\326\203\336'#\362NQ\260#i\325\002}\223\244\3546\232GG\354"
+	.ascii	"\301M"
+	.string	"\231Fo\205\330\363\027\232N#\207MM\0347\235f\003\032\266\2435\335\374\202\323hn\r\247\353p\023)t\213^\336\216\334\272M\232\017\r\327x\372\255\355\364\235\376\201\231\355\326o\336g\232\207\027\231qk6o\330\202\354T\311\201J\bEs\265\023OF\016\256\314a\243\323m\314\354:/Z\336\243\256\323q\232\215\233]\350(\201\274\231`1\242\016\233\264\252\034\333\032\020\227\245\222\266F{\216\016Iu\206\343\216\034f\266\232u\273\001\314\325B\354\240u\325f\257S\263\3275m\367`\333\260\021A3c\257\033c\257\373b\257\333b\257\313b\257\263\222\246\233>`f\354\24059l\r\017<\236\250\330\024+v\3502m\346\377\t\362*KB\006\305\276\311\200\240\205\206\254Q\224o\226k\263\367\230\377\247\317\236pE5\261o\035Z\314\377\003\224\266\245\005K\243\327\205!\213\2633\244\321\006c\241tB\024"
+	.ascii	"A\304\213\221\252F\337`\376.\343-7\342\364\370\320\350\b&\221"
+	.ascii	"k/G\357/!\320\306\260\341\320\250\210\334\017Z\2644\231\275\315"
+	.ascii	"S\210\032\024Yoy\223U\t\263\244\342\260f\016\314\316\241\217"
+	.ascii	"\244\270\310\345\375\021\202\354\222i\221\303\302\222\007\210"
+	.ascii	"X\330\231\331a-\245"
+	.string	"\3570\313\035\206Xc\234\372\361v/\262\305\3172MV\216(6K\226fJ9\352\312|\271A\271\333\233\251\246kkK\243\317UYaf[\351%zu\030\357\225j\021'yD\266"
+	.string	"\332\223\005%\246\321^\376}\245q\350$\372\025\305\213\224FE\004\302t\311g\003\250\326X\002\002/\330\371\254M\037\fp%\027=\325\250g#\351\347\023\n\323\036P\255\321\023a\365\375|B?\237\272\n\215R\244\246\245\336\317g\244\n\233\214J,-5\375~\300\237n\335\345\\"
+	.string	"\376t6x\351\022\352\024\3541\245L9\247 \220F\320()H\242\367k\n\361\263\321>\302\235\210u\367K\n\372\374\222\202\247\322\232\364K\227r\351\r\237\020\025\nS\025\t\211\247s\n\002{\250\272\006O\244\364\227\344[\342\351\220Ra\023\332K\205\272\253\273\244\240\213\021N\352*\364%\245\"\234H\223~<\245^\321\372KU\265\251g\202\004\022\017\270T\302\211\247\252\026\214\2603\240\304\013\027\253\312\013\272\240\341\024\004\366P\254"
+	.string	"\274'\334\3754\020!)\210\342=\237\232\376\322$\373\007b0\020C\306\013\272\313\230\361b\306\213\334e\3148:\232\021\343\310>\306\321\371\302\005\004\017,\005\231\322u\267\246\302T\335\005\260^)\201\224\211\007\002\t\031H\276\017T\245U'CUZ\255P\330Su\300\340\013\031\364\324\234\320\007\203\016j\250J$\374\234\220~\326\237\017\030\\\201\227\252*\354x\301\025(\r:\255$\326_\332S\323\340ni]\201\252\322Zb\335\3058\262\253\217\311\267\264\003\221\"\001?\340\005W\335\225\\\020p`0U\215V P5\n!\334\321`JW\241\223\020\350\205\024\351\327\001\222/\030\324\202o\355\361\206R$ \323.\251I\205\024\t\204\260\347[\205\276\225\267\nw+\byk\220Ro\365\2710\202\020X#F\r\242\025z\300\245\236\232\266"
+	.string	"\3345\005{#R&\037\ti\217\247n\360\013AM]"
+	.string	"\006K\250<\245\036\252\246>\033\276\365\227\"u\200\244\362\200*\004\335P\372 \025*\345\322\225\267\216\360\003\372V\236\332\224\344\263\361\003\366"
+	.string	"HW\236\b\351\r\037\223o\r\206\240\246KMH\251ROH\264\356d\254?_\223\356GG4R\224"
+	.string	"\302\006\266\347\"]\362\331"
+	.ascii	"\252\301]\272\362\324%\240\272\376\200=\243\236\r\243\237\217"
+	.ascii	"\307d\324S\205F.\020H\372\371\230T\013V\350\371\326\021\322%"
+	.ascii	"\025x\277t\350L\230\234O~\206\3678\024\272Om\274\2245\371\371"
+	.string	"\344\334\342%hXS\316\255\323I\356\nkH\206{x]I\203E\313\353\247\255\307\225\263F\317\254>\225\234K~f\235ID\024\227g\026\312*\200\230U\370\2309!2s\350\177\252 a\242Z\206d]\235XR\250\3608\373\322\350\231L\236J>\036\211\027y\207v\214\230:\214|\275]$\220\025\377y\344\247\262\265\200\264\246P\215\231\241A\300T\341\241\321\377$\213<\201\321\250\241(\247\2243#3\"\"2\222$I\007\001\005\204 \007)t\345\001\022 %5\2231\250DdDf\024$%\205\302r\261B\327\202\t\001\364&\033\301\207rw\214\207\270\034)\214\337J\202\245\210\031\216\333\347\033&~L\367\310\210`\017(\301\362B\343\f\204\347\300\2502\233\033#\3519N\374\\\017stC\377$\204p8\332\211\262\217\026\252\001\310\t\312: :o\357\325O\024\003\301\206\\hwwC\223\335\206"
+	.ascii	"5\310\300}\205\336C\342\370\260\275U\275t\243\214Wk\276\023J"
+	.ascii	"\364\261\022\006\301\203.\260\020I\004\263\261\206V\343\330&"
+	.ascii	"\023\031\213\2401N\225\305\357DL\234v\001h\r\310\037I@\016\030"
+	.ascii	"\354\336\241\201\343\2255e\302\003\3265\177\332\367ZV\251\230"
+	.ascii	"h\341c\252j\241\031\341FH\327\016\f\271F\020\3670\243\030\351"
+	.ascii	"\314G\bceZ\352\003dSf\210\232L\210{\177\274\335W\004\007\323"
+	.ascii	">\332\320\t\236\b\343\366\254\023\200\213\264\275\373f\232\260"
+	.ascii	"=\3231Y\034\365D\265\275f\354\001\251\\\t:5\316@p\273$f\t\341"
+	.ascii	"\244\312v\242\f\256\356\277\253sG\260\322\246$\347\366\241\302"
+	.ascii	"\rys\256"
+	.string	"U\t@\336\003\210T\316\036\227r\b\004G!\335\276\32417\224.?\264\205\3040\227\361\245\334\360G6+O~\257\006B{\177Jk/\230\201\021\321\t\277(\234\027\230\260\366\345\004\2649\305\214\315\303;\337EQ\025\272\325\364p\"?b>\320U\225\004\226\212\332\006>\351\364W\004\336\035Q\006{\210\202m\027Q\030\2170\231:\377b7\261\300u\3221\247\3101\234%T1\347fv\345\320\007\353O\330\275:\275\252\276\306`\301$\200P8\212\310F\020\371\273\005\303,B\f\255OSs\271\264\023\223\304\336\210:\233{\371\304\334\365\224\245P/rz\361<;\235\325S\213w,\215\002\231))\324s\270q\025\324\234\222\273}\312\n\375\2641\r\f\263\354\314\3253]\327!Q\244\231m\222\231\347\216\372\263=\003\321\003Q\234pc.\f\363\320[\262`\330\203\004\357\245<z\207\262B\263\376\025\325F"
+	.string	"t\257#{\336\314\325\216i\355rw\243\305\227J\314'&\3152\217\233\024\335I\032\222\373\267\201\374\024\266\265\250\034l\343\222hZ\242<<\315S\344S\214 \001\030N0\n \2372\367\321\204\013Id\326\031\366\364\034\256.A\337n\335\314\315g\331\375\347\350\227\266\274\\,\342\344|\346\223\233\375\013\220;\300\230\031\357\270E\321\016\217\253\353c\002\256\353\313\213\230\367\226\225\022\350\341\232vb\334\021\246^\246-"
+	.ascii	",\333\017!\271\342\202\244\327\024\t# x}\345\253\370yQ\242\334"
+	.ascii	"1\327'\235\250\317\271\227\352\356\237\024\255;\312S\016\213"
+	.ascii	"\bi\362Z\347n\037\311\004Y\302M\321\355\224<\b:\211\3322#SP\235"
+	.ascii	"@\334{\251.\211\226\304,H\024\242#\322\213\363Wbz\332\312\363"
+	.ascii	"\2132t\031\272\306P\323e!se\221\036\365\364\361\347$\241Hn\t"
+	.ascii	"\2271\257\241\266TE\271Z\201f\275\206\332R\025\345j\005\"\323"
+	.ascii	"\301\357\277\3609n\240\315\251\254H\2240P\200\201\314x|M\264"
+	.ascii	"\026F\220>\260\247\256G\177([\003\372\303\324e\203\256$D\331"
+	.ascii	"*\370X\334~\346\207\274_\347r\033\206\033\231I\205S6}G\376\274"
+	.ascii	"\364\030\340w\270#\2761[o_\340\361\351~\201\036\2729Em\356\204"
+	.ascii	"x\020\177\260}\007\336@^\3116\200u\340\275\2309\037\336\333\363"
+	.ascii	"\236\023q\335\230Q\270/\305.3\340A\312C\276\036\266\347\277\323"
+	.ascii	"\251\001"
+	.text
+	.section	.gnu.lto_.symtab.307695b95b638c35,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.307695b95b638c35,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
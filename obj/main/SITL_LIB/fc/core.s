@@ -0,0 +1,3736 @@
+	.file	"core.c"
+	.section	.gnu.lto_.profile.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`w\004\335\025"
+	.string	"t\032k\005"
+	.string	"B"
+	.string	"\336\224\344V\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\210\301\237\216\017\026\002\006\002\007\b\002\b\002"
+	.string	"\002\t\n\002\n\002\001\002\013\r\240\342\234\212\n\020\253\306\274\244\016"
+	.string	"\021\306\254\357\313\f\004\022\350\326\320\274\b\b\001\002\f\002\001\002\r\025\271\345\223\310\007\020\016\002\016\002\002\002\017\002\002\017\027\032\353\312\237\224\r\001\002\002\002\017\035\261\356\305\342\r\016\002\001\002\021"
+	.string	"\001\002\022\002\001\002\023\037 #\204\210\201\320\013\016\002\024\020\024\002\024$%\250\200\234\374\004"
+	.string	"&\267\226\235\323\002\017'\206\361\336\202\002\002(\322\261\355\375\007\"\025\002\025\002\026\001\027\016\002\016)*+,/012\233\304\365\321\002\0023\214\233\312\236\002\0024\326\353\241\235\017\006\0015\234\275\245\363\f0\001\002\030"
+	.string	"\002\006\002\03178:\311\202\342\200\017\022;\376\336\373\325\016\n<\266\231\367\251\004\b\002\001\002\t=\315\347\335\233\n"
+	.string	">\304\306\257\225\005\f\001\002\023\001\002\023?\227\254\370\323\004\244\001\005\004\002\030\032\002\032\001\001"
+	.string	"\025\002\025@ACD\234\361\365\241\r"
+	.string	"E\350\300\306\254\005F\214\331\320\334\n\025\002\025G\212\312\215\322\016\004HI\377\264\301\240\006\nJL\276\276\271\247\fM\277\270\330\226\rN\314\345\244\232\005"
+	.string	"O\305\271\300\245\016PQ\354\206\342\366\006\002R\342\201\222\246\004ST\252\257\370\340\n\002U\202\321\330\342\013V\346\270\272\264\006WXY\264\264\266\260\r"
+	.string	"\200\210\250\2219!$e\223$\231\306P\2021%u\346\001\021\340P\244 \243\232\3124\007)\302\240h\020\021\320\035jbi|\371\271p\231\"\027\223hpk\310\240\304\003\017d(de$\213=\350\221\323\005\036\313\317\311+\242MB\021\273\030\002\361\376\262\226/\177\022G/=\207\210\330_\375\337\373TI\\{\324\374\374\305\261\236\374\206\177\234VU\342\217\335[\233\356(\002\006\305T\211g\013\204\336b\276*\205\2046Nv\360\266\350\266\371\220u!\032S~\277C\037\217~\322W\003^*?\315DY=\241(\0226\no\"t|\226\317\024\251\314\264\375\354\325\"\350\235\323\230\265\362Sh\031\3662:\211\254\035Cg\320%\306\314\023g90\322\204*37\nZ"
+	.ascii	"I\237\022\353\257\026\374a\013\366\372\354\352\200\004\371C~"
+	.ascii	"N\373q\227.\277\363eL`\261k\370\237\274\236\026\333Gt\335\367"
+	.ascii	"jv$\200\235-@\023/\215/\206\20396|\375\202.\036"
+	.text
+	.section	.gnu.lto_.ipa_sra.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\303\001\365\006"
+	.string	"b\207\025\036\200M\206\00330\00330\363v\013"
+	.ascii	"b\237>\002&\236\004\332lP\356\311o\321\345N)N\317v&gn\246F\317"
+	.ascii	"`\346eZ\266\262OQU{2%\312\031\361A\036;fc\031\373\342\025{\002"
+	.ascii	"\261\207\r\005\302z\360\013\324\200:@\177RiF\320\272T\237P\250"
+	.ascii	"\360R\244\351\260\002\251\252\252\003\0208E\306\3066\315\001"
+	.ascii	"1nX$:\356@Hr#\244;:\253\n\267\r\226;$8\035\275\334\261\342\f"
+	.ascii	"F]v\016\3444+O\337\204\302\245\rd\272\372\353\241S-\b|\220HK"
+	.ascii	"\316\352\347\007\364\254;\303g\243\257\322(\304\251\365;\251"
+	.ascii	"\204\254\203N\233\307\323g\022\341\362M^\260\247\020\264\233"
+	.ascii	"u#\262V\313R\214u\306\244&dj\006vn\033i\326H\005\236\263\276"
+	.ascii	"\030"
+	.text
+	.section	.gnu.lto_.inline.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`{\013\315\035"
+	.string	"v^tJ\240\324U:\254\237-\373\346\033\007\355p\003\211~\203\332\331\022\322/n\315\022\264\243\003`dr\321\210{\002,\327\330\2439^\216;\003o\352\027\360[\244g&0\344\335)\374\373$\210a\317\263I\330TJ\245K\267\274\267\224)`"
+	.string	"`"
+	.string	"_"
+	.ascii	"\tf\347v\362\307\313Y\371!R\341\003\273\001\327\326h\3567<\212"
+	.ascii	"%A\r\255@\360\023\032\365\365vI\036\350\226F_\313\t\230lJ\001"
+	.ascii	"\335Xp\243DU:I\226\233\004\340\030\335\035\303?\2651\214\356"
+	.ascii	"\226\275\265K\371L\343\356\356\325O\202\342X6\365`\370_\033-"
+	.ascii	"B\366\354\034\374*/1\021\246"
+	.string	"\200G\250\261\230\206\020\331\303z\013\215\326C\260Q =\252 38\352\364C\016\037\274LwS\344L\341\245`1\210\301Y>\202\203+\377\236\370\001\\\345\337\345\351\356\024\034\347|Q\305Wm\260\377\326\254\376\033\003\241~\370X\034\032\346\201D\252jw\374\365\246\300\251\024N1\256\342YB\001{2+\024.q>\245\241I!\345\2212U\013\224GD\210\004!\2048\025\345\362\027\005[\343\256p\243BG\242\361\305\350H4\302N\241\200\215n\323\344\023\376]S\2060\207\021\331\220\247\324\211\335\345\263\223\277\365!X\330=\223m\f\364Q!-\016\375\217\302\373=\275\261\221RP\361\312K8\t\377\340\201?\323\201\303\213\224v\220\016p\217\233\251\344\353\033>;gL\335]rvw\353\032\\\317`\343\027C\335=\3402\335\302fG\347\362a\001\364\323:\206\375\326\024\207\234Gb:\200O>Y\215\271"
+	.ascii	"c\363\331\271\337Z\253\b>Z6\345\324\263N\343\334\352\307\321"
+	.ascii	"\031\303\335SM\2525\\\0047\200\350\250\021\262\021\031)I\222"
+	.ascii	"Ra8`\"\"Uc\365\022\200!\201\004)!\n2G\034)##3\"%I\n3\006@o\221"
+	.ascii	"\326\252\3049\241\312\237T\340\220\266"
+	.string	"vI\313Y\0312\333\304n\027\\\264\216\3174\232\203\316\350F\300\351\342\030c\315\251\254\270FM\211\325\231\261\363D\277z\331%W\204\224y\337\340\b\033\025\211\241'\240\240\234\244\\V\272~6\004oT\312GQ\266i\3544l\035~\023\203\320\006\213g\260\021i\024X\233\305\341Ip\277\261\177'\t\304\224Q\352[\204\nmA\207\302\214\277\306\255\270T|7\035\235\235\342\255s\332\244\207\375\202\350Gx\372\367\275\335>\215(\252\304\202\223\3372D(\340\037\343q\273\256\277\261~1\263\376\026\376^\213\325Jt{W\216YnE4v\240\213u\332m\212vYC\002xJ\351;U\035\204\026\025\013\225f\037\254\020o\265\"^\006\317xa\324\032\253g\034$\0354\007\204:\336/R\252\202r\235I\307\372F\244\323f\322@\215n\031\251\243Hx\320\b6\033B#\222\355B\206\215\257\313\225\252%E\024"
+	.ascii	"*\354\032\320\032\200\216\314\220\257\205j\304\036:2\016-\261"
+	.ascii	"\256\257G\233\203\327\330\351\376(\312\201\307\377(\223m\377"
+	.ascii	"\177\260_\022\273\375\255\202\f\376\030\224\302\207\271Dh\255"
+	.ascii	"\231\352O?\314b\223@\270LV\273\251J\254\327^\036\256\376\271"
+	.ascii	"\026<\fg\273D\212f\347\225\030\037\362\212\201\241+-_@\212\207"
+	.ascii	"\370\030\204{\370W\372$\253h2n\350BB\322\016*\274w(nd\"a\\\210"
+	.ascii	"\377\226\331\340\256\3771\020\212\254\353\013!\327JM\234jj\305"
+	.ascii	"\005\310\260\236\377\017\310\031kM\370\026\370\036\n\275\273"
+	.ascii	"\344\257\221)A\0170\354U\001\301\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\202\n\225\033"
+	.string	"v\035^@ s\222\016\207\205C!\241b\2075\353\275_$\245\344<a*\0230"
+	.string	"0\243\202\334\3745"
+	.string	" \001`D\244\0201\255\365\036aA\003\022\274ii\247\205\203\355\330@a\255\375\336V\266\335RJ\001G"
+	.string	"L"
+	.string	"O"
+	.string	"\216qb1M\231~+\374)(F\177\362\035\313r&\374\013h+\215F\243Qa{}\233j[9\300C\376k\377!!\"\".\341\353\3020?"
+	.ascii	"\366\337\232s\2260\265\325\264n\031\211[\346\222\370\345\337"
+	.ascii	"\366\352\006D\031d\261\213\261\266\0056\233\013\256\344oC\022"
+	.ascii	"y7\304\341;\340v%\311\020\224o=9\304\330\004\332N6\f\2121R\224"
+	.ascii	"_B\226f\231?iY\316Y\206\377\030\243?\036\217\203\341\234\210"
+	.ascii	"\303\361\313\027\226\3252Mv\341\030\253\312\257E\215\307\357"
+	.ascii	"\227\247x\261J\376\017\251\360\357\211\341\177\207\377i\372\261"
+	.ascii	"L\222t\264pD\376\025\212k8\002\004\316\203\221\021\007\265\334"
+	.ascii	"\311\272\2237\212\3376h\013\337Z\347@p\300\235A\303'\362\257"
+	.ascii	"\030\234,h\253\240M"
+	.string	"\320L\306\304$\223#2P,m?\264\036\332\016-\207vC)\352\0322\264\030\332\013\255,\264\202q\3307\354\322\032\3466\205\366\265\235\020\243s%%\017](\374;\210\177Ir\016\bT\311d\340\212F\343\227\376\341\377e\363\321\032\006\343\327\222\322\222\222=\374&\022\211\310\007\201+\2501mF\304 \311\260\031\301\005\204(\306\024\232\007\022\340A\272\020\246\0202\310L\321\314\246T\330\230\003N[\237;Mht\361:F\244@\027t\230\207KK7t!\325\t6\335<q\250\240r\370>;\336\342\320\034d\016\003\030/\241N\023J\313\253\276u\274e\3600\0213\255\351\331(q\023~\303\240O(H\306\350\225\215!D\321j\235G&w\r\377\023\234\225\340\021\031*\351X\242\206\211C\212\317\026\315\356\341\224\020\016\251U\362\235;\342\316\371\036\\\373\310'}\330A\360fs]\326\375[-\2555\263"
+	.string	""
+	.string	"|r\317&\\1>d=!\243\250s\212\305\277\345\337\377\312\210\367\024]\376\2119\271\226\273H\372!\313\245\206\"\211\324\013\375\210wM\367m\005\037\f9\306\254#k\225\233.wJ\200\270R\256D#\t\016\035P\233\217( \324\370\326hxf\236\245\020E,G/A\360s\033\310\217[\312(t\324D\364q9~\213\002\300\364\376C2t\355SdV\351\241\2106\253\253\3562\252(\253\262\216\334\327+w\027m(\220\t\327\023\372s\r\377\213\312\246\315\324\301P\3619\330\247\026\203\024\367M\336\234d9\312&}?\373\320a \371\017\365\031\250#\037!\021Mj\334\265\377\3236\335\004\006\214\304\205\001\306\367\252\271\270\351\365\225\327\277\3438\025b\315j\203\202zZ\232"
+	.string	"*\233\356\374^#\nJ\356(\224\344\331\270\363o\317edb\204\351\033\210\232E\353/\2117k\312v7\377\\\223\242+\216J[\355 C\244\213\033\322X\230T\024\266a\360\304\020rh?\314\373F\316\240)c\354@\2734&\306\254L\007\372E\216P"
+	.ascii	"d_:\222k\003'\360\245'\257\304\340c\350$\222\260\336\330uU\020"
+	.ascii	"\272o\0247\273\321V\266z))W\273\007"
+	.text
+	.section	.gnu.lto_.pureconst.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 t\275\002"
+	.string	"B\307\024\032p9\f\007\250C\377_U\214]\036Tt\036\356M\305?RCH\013x\330\001N\344!\007r\037\347\361\216s\334\306i<\343\030\2778\213W\\\024\237\270\304E\034\342\017wx\303\031\276p\205'\034\341\312\017n\360\202\023|\340\022x\300\005\360\244RJ\243"
+	.text
+	.section	.gnu.lto_.ipa_modref.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\233\001]\b"
+	.string	"\002\314 \"`wi\fH\020\004\001\001"
+	.string	""
+	.string	""
+	.string	"\350\362\304\3276\354z(i\206\240\033JC\337\350?\264\336\337R\246\2770\246\030('\233\274d\222\021\221! \377\350qa\351\030\240\"\216\372\314\362\313\2126jdd\246\031\212KXL#\026*L@X\007\232\251\246\302`\212\325\304Jb\032\0011"
+	.ascii	"\025|\004\007~Xa\246\230\225\303\364\263\362L=\253\316\264S\r"
+	.ascii	"S\206]^\340\342L9\253\315t\263-\315\245\004< p\0022te\007\263"
+	.ascii	"AD\355<z\322\221\205r*h\330pY\223-\243\273n\373\235D\343\356"
+	.ascii	"_\302E\b\312\221\227\037\311\212\027\301\213RF\264r5\340P\020"
+	.ascii	"\004\375F_w4\276@\267\227[\002\272\016\364\003D\233[#\302\305"
+	.ascii	"\360!hC!\031\246\343\352\026v1\bQ\b)\013(\222\001\271\246a\177"
+	.ascii	"x'Y\270J\203\204\341k\347\310\330\322)\307\346\320\352\211'd"
+	.ascii	"\313\242\220\350\3738\240\236\207[\360!"
+	.text
+	.section	.gnu.lto_.lto.5590fa06429a361c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_osdLaunchControlModeNames.133.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bX"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\255\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'*\206\b{\270\355Ry\276'5\206\bw\330\354\002u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005FULL"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\nPITCHONLY"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.137.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\bi"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\303\357\322\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\355\030us\367\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001'?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.139.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_isCalibrating.140.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`g\002\215\020"
+	.string	"6\335fE"
+	.string	"\2216\035sd\233\314:\263#\244;J\201c\363rU\211\021\241z\025\217D'\217\330=\"\326 c4\373\357)\b\337\262\211\202 \226IwUUQD\340\033\263j\326B\004\353\030i\333n\"B\266\2242\005W"
+	.string	"M"
+	.string	"R"
+	.string	"\031vY\221\327s\305<\"*\004\313\027~4#M[$\360\242\005\206\276\200\246\310QZ\371\024\005jX\r\005\222d/ I"
+	.string	"\024\230a1\005\225\3505\262F#\033e(\262\260\314\205\242\330\321\335*B\227\024\206v1\217\356\376~\341\005\375\206\376_\361_\300\277\t\002\2372\247\202Y\211\370\363\247>\313\247_y\3169\317(\377\367\232\335\313\357\267\357\265\357\263\357\261\357\255\357\343^\001p\030\\6\263\2734i\364\312J\361\341\277\310/\177"
+	.string	"\201\310=\232\362P\302F\\\214L\304\350Nu\334A=\232\221\233\026\031\353\006\260\2733,b\314\251f\254Iwc|\322U\265\304\270\\\026o\n\003\213\325d\022\342\217j\252\273\255\310 \033\231S\305twG>\215\320\345U\321\366\367 \254~\313\003H0\253\220\362=\227\262\246\344\244\004\013\321\312\370\265\252\023\256\237B\205\325\347l>:\036\247\343\200t\016B\0244\3508\235\b\335\206\343\336\203\217N'\301\363:\235L\265\306f\224\257,\240{\031P\311\244\377\032\356"
+	.string	"q\350\2225\254'F5@;\257\230Q\020+\037\007\271\361\246,\330XMg9iAb\3232\2159\024\241\252\230sj\031\257JH8 "
+	.ascii	"\003!)\323\001\20624\307\214WqI20\354\f\333iY\233\227\272\357"
+	.ascii	"f\355w*\320N\226\261\371\326\233\335\242\255i\027\027\004c\323"
+	.ascii	"\366\236\354\324\226{\017r\335z\36565\243\260\307\316\2431\035"
+	.ascii	"\023\347a\037\330\017T\276\206 \215\204\334JnX~\267\230\334\212"
+	.ascii	"\025f\035sS\356h\f\221\242\031\332\314\316(\322\225o\237c\320"
+	.ascii	"F\357\306&\3002"
+	.text
+	.section	.gnu.lto_canUseLaunchControl.141.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\013\002\335\020"
+	.string	"\206^nH\360\260(\035\270w\227s9\030\305U\327\027\354+\355\277&-x\217\237\260\005E3\374\326\260\345\247\33116\275\375\177\251\032\371\235\350\276\276\325H\310m\"sI\\\261R,\01777X\213N\214\211|B\310\336[J\231\002["
+	.string	"R"
+	.string	"`"
+	.string	"\243\355x\035G\247l\036}I\333\221\037,.4x`t\260\2610\254\025\366N*\334\201\343\t\206\325b\356\033Q\322\243\326\2721X-\246`\312\210\201\347\226VV\202\343\005n\371aK\221\343\033O\322\263zImlY5\232\230\271\220Z\35395f\330\177\373\237\304\177\003?\027\b'\316\371\344\277\202\005\336\324\366\306\266\233aSql\246&\3752\022\267\353_Y\273\345?\337c~w>w>=\177\236/\317\357\363\227"
+	.string	"\005\326\r\216\005\267ZW7\035\2656U|\370\217\362\177G\220"
+	.string	"\345\243\225\275V\353\242B\225\270\251U\026\266\313\006\036\347Q\271\006i#"
+	.string	"\310"
+	.string	"\201\352h\367\013\t\355}\301\301\324\244\365TN\260\340&\310\002\026D\377\007%\274\251\331\001T\"\006\3006\300\250\354P\207\017\254\t\375E\t\274)\331\240*D\355\244\240v\0036\333\265\275\203\246\305\n\331\256\230\355\016\235t\2034Xm_96\024\375\021\335v S#\377\200\200D\342'\374\204B\b%$&\341Gt\022\202x.F"
+	.ascii	"\211\302\t\242(\n?Y]Y\273\345\264\3465\233\221\033\263\033[\006"
+	.ascii	"5,\263\031owD\275N\371\357\365CJm\352\264\353\"\264\353\220\f"
+	.ascii	"\215\357lM\210|=\274\301\310\374\216\320\235]s44\234V\211o\247"
+	.ascii	"6-S+ \300\002\2311\343\006\305\b\355(\031\236\237\2334&\320H"
+	.ascii	"\204\216 \274oa\332\230\255-\272|\223\366\222\264\323\352\233"
+	.ascii	"\211X\333\362\006l\207~\334\337\334\003{\030\3522\252\205\"\230"
+	.ascii	"\017a\372\3033\r\3070\003\216[\220\322\367\221\024?`\371\246"
+	.ascii	"h\324\035&\243\355)\355*j{\230\256:\004\024"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.142.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 \341\035\006"
+	.string	"\362\n*4`k\323\001\320:\276 \224\316@-(\020.\337\240\370\242\006\004\365,\326\2024\036\034\267\377\376\221&\267"
+	.string	"\016\260"
+	.string	"\300\301Y\341\310a)d\320O\376\336)\005\236\322T\351\2243#9\032\314F\316\n %\211ig\2522\200\322*#n\037\265\013\205g\305\001S\3563\274\301\021\376f\001w\360\327\037\337\335\343\017d!\241\220a\301\317\346*\030\r\354;6jv\214LTT0v\261oc\275\007\"\301\366#S\366\3059\204\375\303F\340\240\261\2732\036\234:\244\374/\034re\325!d\331]\303++\270\343'\266\261\t"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270tc\266\266\353"
+	.ascii	"\264"
+	.text
+	.section	.gnu.lto_accNeedsCalibration.143.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`i\003\355\025"
+	.string	"\246\246\213K\300\322Q:\210$\225\365\375\217\372\373x\240\241\233\317\203\343\003\373\274\370\tah7\033B\346+X`\237\231\306rk\373S\013\333*$\314\315\246\277\235\030S\024\034\205\240\250P~I\362\277Y\206\267X(\233\221F\b!\204H)S|"
+	.string	"i"
+	.string	"~"
+	.ascii	"\265\366X}ba;\222\256Th\3524Kr\024\233a\337\330\216\210':\034"
+	.ascii	" r\224\360\261A\270\034NMj\255:^\251\034\300\210z!\334\261\311"
+	.ascii	"Y\224Dj\304"
+	.string	")\302\\\035\270\233\262FrX\336\022\b\302\341\360\2702\235\025\305\001<:\3024\267A4Q\002\326\320\034\215[<\t\036\tIs4\221\344\366c[\336rMn\306\\\246\324Z\317\266\234\315\036\300\376[\362\277\300\337%\001\235\332\030\002g\353\003\0254\352\303\310m\t1z\320\030\352%\363\276\220?\206\f\274\266\355\345\255\311cHO\030\244u\354\357\305\270{\376\025k\363\374\347\253\232\2172?u\376y\276y~y>y\376x\276x~\363W\300~\300=\001a\300T\353m\030U\201\343\017\350\377\376\247\371\321'P@s\330\366|ne\315EM\306S\302 \r\027b\267\372\021\322\214\016\252#\036\355\006jv\214.\210\001\263S\037\217MD\265H\225-\243\373\261*;\365\t\211J\274\333I\266\006\235S\212\354\324\307\342\374\321\230\231c\313\350\232\312\261S\337\n`\200\245%\247R\354\030\335\016\026;\365\251"
+	.ascii	"\322:\266\b\200p<\220\235\362.\013\371Sh\341\265u\303\020\251"
+	.ascii	"\377\325\310\211\215\335\263\375\263\023z\022\273gh\271_)\376"
+	.ascii	"]\\\2746\016o\241\260\274\\-Vk\002\313B\313\212\013\253\365z"
+	.ascii	"a\241\220\334u\201\345\305\202q\271^,\264WW\254\315\363\222\211"
+	.ascii	"\210H\265\274m\320TD\344\023whU]\363_\325O\221\365ldUH\264U;"
+	.ascii	"\377\203ER1k\255\013\276\277\n\020\314\335\f\271#\332\347\220"
+	.ascii	"\214\207\377\372\326h\346\273{\204\225\361\273B\356\230\352M"
+	.ascii	"Bq#\343\341\276\250&)=\373u\340l\230\")\002H\250QD\201A\036I"
+	.ascii	"\325\344HiA\216\001\340\002\021)\252\016\020@Tc\363\303\310\216"
+	.ascii	"\203\210Io\023,U\200\347\177\211\367\205\033\001L\005j\253N`"
+	.ascii	"?\364\3403\351\335\325 \324\342 \032!\r^\203\363\366B[\371\001"
+	.ascii	"\302\336\331M\035]bk7\2005\005A]\313\241\247)j\017\255\273R\342"
+	.ascii	"K\2553\243\232)\2640\211\005\3713\342\332\333\004K\202\234X\314"
+	.ascii	"\354\363Y\\\261\275\240\362\310\222H4h\271e`$\344\207\016\273"
+	.ascii	"N\025"
+	.text
+	.section	.gnu.lto_updateArmingStatus.144.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\035\t"
+	.string	"v\021?7P\215\322\001\004\353\350N\277\213\201jj\304\020\223\226\235\004\342jA\316&\035\304-\236\315\024\307\016\026!\370a\003\241\252<\022\252\333\001@\273-\323[\263d\023)S\n."
+	.string	"."
+	.string	"/"
+	.string	"\377\374\322\374\370G\035\300\373@\277.\023\327+C\312\360\002\276\356\032"
+	.string	"AR\216zF|\242L\013\301\356:\275O\342\216\267]`[\3006I\252.\325\302\276\206a\030ZM\366\323\361\351c_\201,\024\203\223]R\270\262\"1D\303\3661\376\330&W\235\366\036\024\243\016\326\356fz\021?\265\300\017\265\006\213z\324/#\034%\242l\371\327`\327\250\316Q\251{\352\033\017>\206!<y\357\321\367`\217\327\215\211U\221*\2052\264\003\3266\034n\3232\r![H8P\3104\256\223m2\336\0308\\\326\260m\\\206Q\205~\255\232\034W\240\n\030\322\356\332\335\275,iw\034\362\236UA\001\016"
+	.ascii	"3\241\335/FV\301\301\025@\265\017RX\304\205\017\341jTxv\031\345"
+	.ascii	"e\bq\351\242j\207\006\246\240"
+	.text
+	.section	.gnu.lto_disarm.145.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`E\001-\r"
+	.string	"f\030UA0o\223\016\004\3030N\370[[\f5\362w\306\211\262}\224aPYM\245\b\246\3234\034\216ad\033\356\b\320o\374\"T\362\026\005,\f\fa\244\020\347\303\031-zbV\322\324\332\336[\312\224\002A"
+	.string	"?"
+	.string	"D"
+	.ascii	"\266\312#\311>E\205\b\004\313\356R\252\341\330\341s\232\230\177"
+	.ascii	"\331H\332\3669\024\360W\341n\332\034\304g"
+	.string	"\204-\224\n`{\3408v\367\243'\204-\313\274lv\327\251m\023\356\313m#\260]\300>IV\fv\2463?\371\245L?M\273L\177\372Jdq\3219\261+\241e\306\242x%6\330\217\366\364\311\366\323\276\207\233`?i`i\367B\n\211\335h\300\0040\177\034\327\200\177\356\001\340\237\261!.B\304\372\370\320\307\0170\001\243C\356\356G\275\0013\372\3211)PV\204R\206\377\rx\315\250S4\222\375\303Q<~\211\031\204\344\265??\004\376]5\034J,\230\214\200\262\305\216Yj\006\373nw7\035\313\323\301\271\240+\r\347\262*\252:@u\022txP\325\345\2414\032\266\026p.\n\304\262.j\212\240\257\304\030-@\232\301)%\265\025x\3445\177\364MH?\357\351\210k/\362)\210\n\013\021\205\354N\004:\275\374! \220\002\231\261\363\001B\3009\334\221\260\336`x\354ml\001("
+	.ascii	"\b\026\260P\354X6\221\337\030g\033\2260\244\265\302\024\003j"
+	.ascii	"J\326\305\306\nb\205 \261p5\033\336\331\006\026\203\023\237+"
+	.ascii	"\202F\216p\270\271\215:o.\t\343\326>="
+	.text
+	.section	.gnu.lto_tryArm.146.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\375\003\375\032"
+	.string	"\026\360\250I\240XU:\200v}X\270<\377"
+	.string	"\374\302H\271~5\350\301\246,-\246\320"
+	.string	"i\226Y\365\350\237\b\331\276\013h\274I1\255\265\262\206m\266\342\372\364\321\365\274\034\274\310ZAdm_Z\203\253\271M\262\255\204\355M\244L2\225"
+	.string	"\210"
+	.string	"\227"
+	.string	"\373\243\007S\034\270\315SD\212\017Xk]}\356\246\330]}\216\253\245\355V\271\360F\375R\020\227\244\245\326\372\352\240\323\016\263R\245\310\027:\307f\332^\265\3439LM\r\237\336WD]\217H'\203U\303\032\242.\006\247^\353\235\034\t"
+	.string	"\315\210:Q\307\033]NJ\334}\274\206H\327\343\027\"\335O\213\035\216)\214O\231\235\212#\255\340\361\305{D"
+	.string	"\305\224Efw\033[=9r7:\263\330\331\230_lj\255\313\271\235\3177\346\273[\356\256\203\335f\022'\"\202\254\365\306`/\344Cr\3668>WV\202\237+A?\271ot\026\n\322\360\035\005k\\\334\025\332\270\177\273\357b\261X\334\006\332\245\2743\315\333\272\322\227\325\2741\224WEyS\223\227\034yi\363\316\221\267\233\227\233\367\002nd\310\327\023\352\321Q\204\265\247\310\245\2263\211\320\225\376\341\256\366@\236D\273\322:\271n\302\272S\331\370)\201\t>\267"
+	.string	"\371\351z\213~\216\007@\017\274\360H(\016\334\031\034B\261\001or'\353Ta\233\266\211~>x\003>O<|@,5.\246\326\302\206\033\335\306\026\244\004\312\220\354_\222\237\274\302\364\331_2\373>~ (J\024\257\306E^\242\242g\350\345\004\355\031\336\305\220\201\237krJT\031\005ek\036\032\200\367H\0326\364\244\2411$\361\247\241\255\216\351e\034\317\366\245#\341\260\307\261\035`0\372\331\352#\235s"
+	.string	"i\361\035\361F\031V\360\335X\b~na\236\270(o\315\363\033[\240\220t\377V\004\345\366\360\203\312\215\267\354.N:\262\035X\354\302\207\330\b\017\260\035\234\b!tprf\260"
+	.ascii	"{\263 6\223\335\274n@\274tp`9\257\233\331\316kAke$b\263\227\t"
+	.ascii	"\231l\366Z\tk\267\251\265m\254\265V\230\002<\323\273\264\"\232"
+	.ascii	"\321\360"
+	.string	"\254 OL%\253gz9w\205\325\304\357\370Y*\032@C\b\264\352\037\253U\375\032%\355h\233T\375\035?G\242x.N\365\356\003\b\3649V\273\310N\365L\302u\241\341]\t\023\3709\262?|\253|**\033\224Vt\250\372\347t\3323\n\364=+t\f%\370\006U\250a\034%\225S\314\314H0\022\204$i\341p\002\031\2713\017\020P\347f[h\f\362\240>\216[\002\333\020/g\262H z\220\337\277N\275\371Cs\327\025\001Oy$\250@:Ab1\370\034s\203D\270\b\310\251F\232\206\357+\363\301\271!H\251\323\306\213@O\317\240\303\323\365\023G]\241cZ\237\031\237\246\342\216\022H\347\333]\326\376\307w=\331\271\371\001 \037\214\257i\366T\235\334\226\376\336\330\204\031_\n\360<\002#\177\021!\347\262\307Q\2221\036\322h\370\261\r\243\263M\375\270(1\265\020\300\330\206\262"
+	.ascii	"\370\201.\214\217\231\345\247e\243\377,x\2125j"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.152.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`M\001\355\f"
+	.string	"\306\225O@0O\224\016"
+	.string	"\032D\260\027\207k9\264Q;\030\344\226\201\3358k\265B\210\360\360\032b\260\256\313<\330\377\311\366ap\034Vls\306\312<\f\f\3622\270\224)\237\362$8\254\237\020\262\245L):"
+	.string	";"
+	.string	"B"
+	.string	"!\273\233\251\206w~Y\025\324\354\370W\005\200\027\273_\226%\243W\023\260(!a\2008\272\n\210 X`w\017\342I!~2\257\312\356:\275h\341\226\334v\306\266\001\373\033\001\336+\177c\275\272j4!B\3720<9b\233\272\324\222}\270\232a?\r\237\316\247\217)\370 \252\020\237\301\305\256hDdS\325\t\016\266\217\271c\263\270Ic\tx\370B#\002\252'\024\007\324\022p\205\327\"\025\352C\030H<H\325\210\332 }\030PK\347X\036\020\260\023J\203\024\002\344\"~z\307\005\024! \271\273\235\232c]\021x\250"
+	.ascii	"\345\013\373\337;8\376\006G\330\344\003\326(\026n\3232-A\226"
+	.ascii	"\271\034\300d\032\247\311(\003\2741\260p\231\203m\3432\314\264"
+	.ascii	"\207\327\f\373\203#\345\321\017\274&9\371\305\262\027`\236\342"
+	.ascii	"\243C\n\264\226$\355\006\232\274g\325\356\225\226`+ \240\202"
+	.ascii	"\241\301\036b\020\201\320@Q\336e,\335\275\260\n\250\210E\225"
+	.ascii	"\367\330\031\346\274\331B\332\"k\260\200\235s6f\032dGctLB\235"
+	.ascii	"\233\fgH\367\n\306\214\306\030\\\036/R\025\306\025\367\003\364"
+	.ascii	"\303\177G\370\357\270\303\374\222F\245\352\372\325\227dg{\343"
+	.ascii	"\362\266\213\352\001"
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.153.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`f\004U\031"
+	.string	"f\352\226K\260\022R:\342\305\177\206\033\322_3\016^nc\312\351h7Km\257\371Q\300O\f\242R\257\303\224\245\317\267\372\266\177\304\037p\332\322\017q6\231\200d\007\272\243\342/k~d\277\247O\024\226\305<\265\355Y\373\311&D\312$\003\207"
+	.string	"q"
+	.string	"\201"
+	.ascii	"\265fK\253\342(\241L\354\356\317\235\331\255\022@Sq\bN\330\340"
+	.ascii	"\265\300\252\265\322\232\304g\0162\223\305N\330\313e\322\222"
+	.ascii	"l\236\331\277z>\334AfA\226\365\360p\314D!\361\271\351\371I\342"
+	.ascii	"s\243sX\016\277\206lt\200\354\322a\263C2d\363cS\304)\357\003"
+	.ascii	"\227d\211\325\323Q\244\246D\357\364\3210y\372v\3343\037\217$"
+	.ascii	"Pk}\321\031\204O\307l\242\324Z\227{\276\233/\200\357^dw\r\354"
+	.ascii	"\222\005\002\375\242\303P\374#\224;\244\227y?\335\225\276\002"
+	.ascii	"\003\214\315F_r\237\024\317\265V\\\257\f}\263\020\251v\354c\367"
+	.ascii	"\303\037\311\354\203vC\f\277\367r\037C_\276\333\027C+8\374\345"
+	.ascii	"xk7I\307-\334=Y\373g\227yC\230Wv\336\330y\317\363\302\316\373"
+	.ascii	":\257\213\3445K^\312\274%\311K6o3/\237\367\003\\\2165!|\347\271"
+	.ascii	"\252\001\273"
+	.string	"\306\231-\234\361\034\240\021\353\300S\350^\306\237R\036\250\250\320\227\035\200F\"#m\341\036\351\256\236U\021\251\002\360\036\002\335\215 \201\337s\265\2114b\327\270.\tF\341\224-\\\263\311\216\371\020\245v\354ci\233\023\336D\301U\353\356d\377\3420*XXY\241/i\177\n\350\250\233\354\363~\344vM\356\242\346\252\265&\330/\235\251e\037\364r]^^\350\313\3567\025\241r\274\305'GhH[3i\271\331j\264\332\005Z\206\227\025\030Z\355\026C3\021Y\233\206\226\033\215\203\315v\243\235I\271\367\017\003$\241,\253\\\353@Zx\343=\026(9M\005\215\2149\336\342q\004\324\"\232\265\220\305\313S\005\261H\274\254\313\035\262>SQ\026k\0179b]\342\234\214\202\303_\3542T\352;\300+\"\343\331B\250G\035\007x\3042nR\255\025v6W\325hp6\r\350\005\353\033\r\007\260V"
+	.ascii	"<\246X\327\253Yd\257\216-\r\205\262\254\002f\250q<d\221r\202"
+	.ascii	"*)H\212R\351\240\002\03113\017\020Xd4b\230\326C\271\t\223\322"
+	.ascii	"\273\236\317I\tC\304#\322\363\016t\310\220\b\0319\305\274\237"
+	.ascii	"2\204EPiE!\310\200z\323\330\362\022\035\301\240\220\205\272J"
+	.ascii	"\302h{\230\206g\274\373\207ji-\256\245SH\300\203\031&\217\354"
+	.ascii	"i\217\323\223Hb\364k\025\265\252\016\257\202/\350\326\373,\251"
+	.ascii	"\332E\021\271\343\261\242\331j+\257\002i\202\272\345\370|\373"
+	.ascii	"~t$\321ZF\016\312\262g\227\202\255\216\031)\226!\374\013\n\347"
+	.ascii	"S\360A4\230\332\364)\364\356]Z\270>\275\360\316\253\353\230\351"
+	.ascii	"\307xs S;\036\245l\261{d@\326oG\037(q\001<+Zq3\375\017"
+	.text
+	.section	.gnu.lto_updateMagHold.154.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\372\005\255#"
+	.string	"j@\274\rH\220XR\007E\362\n\213`\235\237\"\007Y}\f+wx\276\301\222i,\251\222\246\341\005\260\234\253E|\bs\245"
+	.string	"@3\301\333\336\001\232\313\033[\223\021\020\\c\3420\326\272\347\317P\327CI\3076\273\367\226r\247\224R\277"
+	.string	"\275"
+	.string	"\314"
+	.string	"\325\031W\235o\357l\253\316hu>Kg\263:\333\322\271\226\316\345;\277;\273;w\200\034\216\025\303\256\261v/\21353\267\2542\321\321^\315\334A\270\217|\343\026\322]i{\365\372\noGU\365P\221v\357\025\320\225\217\316\2566\275c\273z\347\330\256}\343\224\031\315'\305\215\"\240\245\026,2\346\336\273{\034\235v\016w\263\241\247ik\371\236r\233L\250p\030\3259\223\tG\243o4d\270\255\330h\f"
+	.ascii	"Y-\212~\002\260\341\202\330&\361\030t\013\243+\315\020xL\341"
+	.ascii	"\345m(\345o\245\305\214\262\350\336\333\\\355S\303\237\273\311"
+	.ascii	"t\357e\027\016]4\323"
+	.string	"43\2431\263\022s\205\022f\367\336\002\311Vr!\203\006\r\266k\371}\354\272\243\370E\246\253\313V\262\266o\256\266e!\317\312V\262\377\266g\017\022\177}\244\221l\340\306\342&''\333\365\037\301\025\321\347k\355\367\336\250\177+\016\3534>\245\356\365\031\371s@\216Iy\031\356\367\357$p\214\317\327\232H\027\341\260\363\336{\200\033\331_\037\270\261\272\362S\boaW\356\020\374\344I\024\277\266\230\370|\215\371\370\363\267b\356\362~\025s\022\322\221\221\351\\D\324^\315\272\322y\250t\026r\347 w\0062\235\177Lg\037\323\271\007u\3469\235wLg\035w\316\261\3168\325\371\246:\333T\347\032\353LS\235s\0015\177\363\r\314\"z\233\242\257y\363\206QLi{+G\277\212\373\330\375\002Ll\212\211\364\\Z\335\023\375\024\227\2604\3376\220g\314\240\307\032\234\367J\025\340\216\322R\034<\200"
+	.string	"\301v\245\371.\026\215lu\371|\355\314=\322\237!\366\t\213\373\3347\220J\367\270\177c\227\240\232\317|+\266b>\352\321\353\200\211Q\225F\257\373\251\326\352\236\325i!\247Hy\231\266|\373#7\353\023\026\375\333\333n\030\251"
+	.ascii	"\251~|\274\367V\024\311\356Y\243\377!Nr \307\3207zO\006\325\316"
+	.ascii	"\267\217~\003w\230\1776i'\275\b\022\274\205\022lW\363Qb}\373"
+	.ascii	"\035T\263\365\217-\277\276\315\002\004\362\243\320Kz\003\214"
+	.ascii	"\314\025:\314\302Q\036\236:<7-9A\361\232vM\036v#\2366\210\330"
+	.ascii	"5A\225\330-\3550\217\204\023\324\316\004\217\007\265\273\035"
+	.ascii	"}]\336\257\342\363"
+	.string	"l\253\314\367\277\334\320\207i\261\026\372\241\367$\230^\322\027\013\2724\241J,&\311t=.\350\3218\254\307\350\245\205`\200>\347\203~\036\350?\0130\315\347\363?\357s\006\b\244\347u\336\347K2\236\357\371\346\321g\251V\203ii.i\217\004f]\231\323\037m\226n\235[&\244\\\006\214\367\336\306\3425?\261]y\276\301\256\272\2564\026^*$\365J\275l\327\2357pELz\235/\311\202jU\312r\036C1\311\355\255\330\321\245\326\001\212\241\235\003\272\350\247\310\032\347\241\210\234Y\301\002o!\316\203\240*\373}\024\337|\222\315\007~\250a,\004\225R\206!\231\241 IA\241\325\220\002!\0213z\020pF\303IcC\344\003hI{\372$\320mC\254)c!\224\237p\303\333`\373\0247\001G<nZ\356\240\235[?\232\234\247QLE\345\237\030\206A\235\t\024B\376\240K.\244*"
+	.string	"G\224%mIXfKt\204c\340y\026\326\332\007#\317\276x\314\373\303\001\276=\204\374[`\345\227n\343@3\302(\311e\264G\347f\246::\004\224\365\\\f0\032)\273\r^\225Y\022\347eR\3710\347\026N\030\016D\003J\261n=D\304\243\255\305c\342\r\330,Q\031\022\215\354\2060\302\213,x\323~\264\253Y\372\272\302\021\236[\344\273E\261W\007\001bo\221\306\"\207\007\033 q\333\207,\016\307\013\233\362\200Yb\364\300~\0039@u\0306>?\334\262\277\366\330"
+	.ascii	"m\366!\313\360\240\234<i\317\037j[@\214RGo\376"
+	.text
+	.section	.gnu.lto_areSticksActive.155.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\024\005u!"
+	.string	"6\276\326G\220\\Q:"
+	.string	"\272\341\032\001\305\324[\343\210\331\033\032J\024\033\006s\346:\205xE1\267\340\325\231b\303\356#/$; \274]\220\225\023&\243.\302\364\252\373-h\366\376\002\220A\036\205\266\377m\237\020BH\332I\006\307"
+	.string	"\257"
+	.string	"\304"
+	.ascii	"\276Z"
+	.string	"-Wa5\2148SUnj\255\bL.\204\323$\001\003\225&G\377\224&\275\333b7FMu\264\257\265\251\252J\255C\005k\3404\351\340A\213E\362P\310\222mJ\211R1N\255C\334\203\354=\016\2753\212d\332L\026\203\275N\263$\307S\244\265\013\323F\236\246\221\301\217\316\200\byX6N\250:2\304b\230v\214\307r\262\325Dc\005`:r\320\227I\301\207P\207O1L8\244\230nP\223\026T\032\t\024]@\212I\007-k\230\204\005kx\034\033d\365\260C\013\276\030iQ`~.\232\312\b&\321\033\313\344\017\"h\250\344\370\020\36205)\324Z\227\306\b\n\2755\357\272\266\273\025vG\251[\202G\035\303\344\232W\232\034\372\313\312G\273\026\213S\022\341\370\247\245^\255\322v\027}\340\215\026\035b\232$:\347\265V\027\377\323\356\360GMc\251H\214\275\323\356\315Tv\021\321"
+	.string	"\223\356\220IW\300\322\0252\351\006\231\211\027\310W^\333\351\376\234\256\317\351\366\234.\317\351\326N\227v\272\263\323\225\235n\354ta\247\373:\335\363t\315\323-K\272\344\351\216$\335\223t\351H\327\004HP-\315\b\232\310\231Z\227\272\352\3240\344\025#fb_\231\356z\327\304u\221\311\221+\260\262p\232Z\342\246\326\241\204\323Vk\254\215\231\\/\361\260ED?\327\354\261\323.\200\013\230D\366\331\213\264jUd\037\342\002F\375\310\300\036{"
+	.string	";@)\363\257\303\016\300\0130\252\374\370\327\205\306@\235\001F\375\302\324Z\317?\355\371\361\366a\276\374\031t\363\245\027\362\345\215\301[\032N-c\341\340\341\303\207\322$y\005i\254|\343\017\305E\351\216\207\265V\363OK\233l\261\031\207\036t\031\246\031\253(\377\036\361\313\343\330\260\212\222\3767\260\351G\273\326\247\037\313(\335\361\321\256\f\266\002\342\254\265FXg\271J\210\234NW\232\3647\344 \203\344\212\217v\215\345\bOA\3415B\244\b\270P\032:\204K\261\r\271s\024\024n\202\246\326$\b\353'\206Bb\re2\262\024\273\025!F\243]\211\235\005#\023\272\\Ow\201Dng\224\242gs\013t=^\016\227\023\2013\261\013Q\002\227\353\245\300-"
+	.ascii	"Z\336\t]\017g\304\343\365p\261\241\317wZW\371\\3\345\305I"
+	.string	"\326l\215T\272\350\027\324\324\026'Y1\033\251\024\022\372R\360\375G\373\323\316\222\310n\277\032\212\3006\005\266\235\026!\252I\242s<\326Z\353,\201m\277\335X\3560\206H\033\252\306\215\0259\262?\355\r\250\205\rl\300mM\266\356\274\326G\345\r\250\205\312It\"\240\226\246r\311\370\250\004\272\214\242\003\375WX\316\020\301\370b?\037\340\363\236\377\254\270Q\273\317\213\270\262\230\347=\343k\347\371m\f\024\034\0065+b\227\332\213\210Pm^\264\007`\250a$\306\bt\310\214\005\"2a\n\222f\fp\002\241\261\3329\020P\307\210S\030\016\252^\257\247E\007\t\201Fn2\234*o\226E\306\r\035\210b\312\321\244\327\177,\362\375\320\310;\t\341\313(\203g\200\fM3\003P\003z\021v\222:E\304\003\037\355rP\260\232\300\351\342\207\321JO(\3243\246m!c\321\301%\211\304\301\034\020\b"
+	.ascii	"\367^\204.\216W\371\353\016\316\250$j\344\001`\346\336=\357\\"
+	.ascii	"TO\324nHav\300\177\224\363\360\324\203\333\354n0\252\b\355\002"
+	.ascii	"\215\032/Pn\304\2748\350\bJ^r_\332&@d\002=\317\354\350p-{2\237"
+	.ascii	"f\013F|q\302\362K\210\370\211\030\261.\026\325\311#\324\307c"
+	.ascii	"\235\260e\250"
+	.text
+	.section	.gnu.lto_runawayTakeoffTemporaryDisable.156.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\325\007"
+	.string	"r\21777Po\322\001\240<\001\351\253\275\210'z\204\313\371X\035\006\370\020tTB\266\2725\344\260\007E\204\331\372\237@N\314,n\332:\254*\276J\240O\307\206m+eJ\001\021\327\247!\3738\\ \317\203e\254\223m\032\0261\2108\341\271$\"\266\201b\207\300\032E\266\305\nM\333\242\365\3555\253&sZVR#%\371\352\177'\271\360?l\021\312w\207~hs\370\016ft\203M\352u\200\345\024SJ!\345\312\376D\251\034\3665\253&\373\250?5}( \242\362~z\331\315X\315l\n\242\200\330\276e;\323VX\340\216\302\260\356n\250\234\354~\tF\340\034\232\263]\376ylA\210\252d\"\263\273Q;\316=9\377#\017\350<\321\023\200aw\235\235\247q\353m\037\330\216\266K\002\t"
+	.ascii	"2\241\217/\260q\361\324\f\3145|\177\bO\245\306\201;\267h\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.157.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\003\006e$"
+	.string	":Ct\016G\220\332M:\206\0300\315\215\247\245\265\336,\254P^>P\034\214M\374@\277.]\357\267\340X\344rts1\240D^h\034e\211A \020\b\252M$\307\214L\003N`Wa\271\247\0025{\333A\b\355\226\266L\001\324"
+	.string	"\275"
+	.string	"\331"
+	.ascii	"\266qZ\207N\217\343\264(N\207\341t-\234>\235\236\265\351=\200"
+	.ascii	"+\023$k\207\270\251UF)\247r\241fC\326\310z\217l\230}\363\212"
+	.ascii	"\0053\203\037Y\221\025\366m\351\332.\274_\276\255\221\026[\311"
+	.ascii	"\252\202\r\221\022M\255aLK\2554.5\202\004.<%\004\343E\232\035"
+	.ascii	"\2214+%oj\255\274\377\330\251\315\341vn6\235Q\fi\355"
+	.string	"s\312+6\220\340\013\206\271\312z\2619\234\016\036sg\307\274-\025pm\265%4Q\332\354\031\226\216\232N\206\220\253\375Z\244.\254\337\324A\032\2018\246(6\3501\003\270\241\0259\351\331-\013\306\254u\345\262\252\346\317\260r\324v\265\326\375\332\031#\3137\247\330\240\326\352y\2255c\315\263\366R\333\017l\312\025\034\346^\325\276b\316\334\330\357\211\360\367 F\246j\306q\317\334\325\355\020\332OPs\257\376\375Z\037&gjp\251\372\013\213b\200\036\364\260\r\017\2245\225p\036\350\236$\033\337,\275\237\237iVsl\247M\002b\254\265.\360\"Y1\021\336 KM\"j\356\325RoT\270t\277\300_\022/3\252Y\332a\276\371-{_\226e\351\373\260=m\200\327\304\264\264F\326J\342tR8M \234F\242\323;:=\200N\013\240\323Gt\332h\234.\242\323Dtz\210N\013\321\351"
+	.string	"t:\210N\353\3504\020\235\006@\247\177\350\264\017\235\356\241\323<t:G\247qtz\207N\337\350tFSG6\013\226\242o\225\037\231\027\330\221\262,u\210\2764t\241\023\335\b\215\f\252\300\241\373\320\233\262\220\300\251\035\001.\364\231\205\354\362\3152\300G\370\274\312zj\255\243\356+DL\213\356EZ^KD\2373}>\351y\356>72C\006y\336\363\002OV\311\362\374\350\013\356\271\027\241\221]\266\357\034\367\320\f\3115>\350;\377\321*R\222\\\276\360[\016\372\355=1,\266\217\277\235\242\221@\235\333\034\254\225\bUt\276I\200\200\211\037\277\020vJ\004\263\225\"a\002\005\n\341R\361\273\343\267\304a\265V\372-[\b\303\177\020\033cW\3302\013c\255U\n\274O\226\354\002\206\f\031\302\245\341Y\374\306\274\300\250fYk\255\265o5\331\332?"
+	.ascii	"M\335j\b\355\r\001\016\341t\"\004\212\016Q\274\022RQQROD(\240"
+	.ascii	"z\367\223\023TO\352\211\367\364\201WBD\207(\336S\357\004\317"
+	.ascii	"Ig)\023P=\036\n)\251\036\357\026F\265\265z\037\016\321l\340x"
+	.ascii	"\017\323\264\t\231\0164\266\0068.=\\3fkznl\313\034\321\333\""
+	.ascii	"Tz\f"
+	.string	"\333\006\276\243\272\317J7p\321\027\fc5\247V\233\316\273M+XF\252Q\212\203&\n\356[P6\351)\304\310\234Y\350\222\364\305\372\225\301q\023\264.Z;\004\236b\235,\201\317\2603_4\312 \031\273}k\377\203!C\210\r\351\275e\262H/\021\004\360\246\377\310|^\2260\355\317\001\334\223l\263\373\3177l\223\314\300\304\260\032c3\340\002\276\373\246\221A\243\001\037B#\271\366\312\036]\300\3054\243\007\375\350\2654\222\253\350\001r\250a$\344\020s\312\214I \"\222$i\306\260\002\2211\"z\020`dT\2335\357\231y\3551p\261\002\242\346\230\254\201%\204\245\016\030\237\252\332\273cv\007\322\375`X\346\217>\231\035\257\345\345\021KOJ\376\"\261W\230\326\216\254\013\376\217\344\003!'\005\20470\251\"W\362sf\251\261c\201\004\226\372\201\205%\336\261\307K$x#u\034\340U\223"
+	.string	"\342\222\021\003\bm\t\303\177\202!\3761M\314Ko4\035\210\236\003\264\020\332F\210\301\r\357\350\345qR\243\315\203\300#\363A'*\240a\340\226\241g }"
+	.ascii	"zq\364%n\376\254\2135LC\005Un\337g~\215\320\253m\365\f^pU\363"
+	.ascii	"\207\b4\274\237M\244\214\n7>X;\303k+\r\212\342\236X(\321\210"
+	.ascii	"\363*\006\303\210}\355\205\033\265Q\372Qt*"
+	.text
+	.section	.gnu.lto_calculateThrottlePercentAbs.158.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\235\007"
+	.string	"\202N560q\323\001 \370\305\242hz4B&\265\305\211\214\201o\024\353L\234\341\002!o\0335fG\b\3042\226\360%\002\27488\325\356b\r\003\201O\003V\262\245L)\033\020i\213\323\301.+Z\022\261b\"\202\"Z\330E\344\030\370\262\350`\021\343\272\260X\221\366\366\365\336\241L\350\243 C\275\"\270x\320|\362d\200\26434\362\033\324\217\356\320\205@\252\331$-\225\304>\\\035\261\377\335P\323\247\006^T\270{)\273!\247\2325Q,\242\177\267\217\342\217\\\375\343(X\323\022\200\230t'0\273\253p\312\033\201S\267=v\345\005\006\217\263\203\016-f\323\211>J3\273\244\250%\317\236\231\177\357\017-\336\312\306i\317\200\206\335un\234\310\255O\260]\n\n"
+	.ascii	"2\003\3020YB\330\256\211\222\230 \272 _\212r\270\313\322lx\327"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_isAirmodeActivated.160.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 \342M\006"
+	.string	"\302\313+3Pm\222\016$\307\2502\252\256[7\214\fF4\022\213\266\214n<\2055\373w;\274Vp#\b[\210\252\262 b\345\255"
+	.string	"A\025\242O\215ivo\231\002K\226\0135IMrh\021\017\r\020M\242&\232\245\340I\342B5\212i\242Z\005\313\242\347\320`\203\234/HC\325\375\\\201\271Z\215.\006\240\321\241@\306\346\262\3074\207\032_J\242\347\277\017\007J>WAYf';I\222h\244\343\317|\345\004\205\314U1\216\016\201G\310\"\304$\023k\270\321\252W\335\202\312\300\371\020\261.M/`!3?\353\302\350\330\037\341?\370/\002\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_processRx.161.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`,\004\275\034"
+	.string	"\206\266\275F\220\334Mc\016\377\036-\253\361\312\264\212\304\002w\005\027/\200!\335-Z\177IXH\002v\201\275[\320\314\334\2638$\013\335\223F\001\340}\322\026\247\016\324\335rL\n\350\372^\267\r\314\036i\266\333\336R\312\224\002\255"
+	.string	"\234"
+	.string	"\253"
+	.ascii	"A[\220\252\262&e\367\336\006\027\035\201\244\324~\223W%\335*"
+	.ascii	"\206q\356\225R\342u\257\371\300\n\310\213?\317\215\027\355\007"
+	.ascii	"\214\027m;\002\205$\373n\016q\302\t\273\232\262\312\3565uU\310"
+	.ascii	"}\277\331p\310\332(\332J}\276-\250\364\033\215\272\r\201\224"
+	.ascii	"\r\035\307I\022\366\224\203\222\226\001\031\0256\017{\322asN"
+	.ascii	"F\312'y\202\2425\3533\345\303\354\026l\262?\\\300\232><\202\260"
+	.ascii	"\247(:\342\270\310$\203\332\033\257\226A\217.7\004\004\227l\016"
+	.ascii	"L\2203\037\236\316\b\002)\255a\270\367\232\226A\0337\200\333"
+	.ascii	"vb\033\204ms\001\266\321c}HD\336{_\332E/\350"
+	.string	"\313\234\372\341?\305\344\206\314\214l\251*\331&\220V*\373\365<\3174\327)\367\334\352\347\031\251s\337\272q#\365\316\263n\235\233w\216\251IS\327L=\232Z\024\251\355H]Ejj\251\357\263\340\315P\fK\250\245\2161\257\323\211v\301\304\257#\337\372\263~\363\277\272\265\317e/\327\375\005%\210Yy\371X\276\226oY\276\222\363\373quj\204\021\226!\363@^\244v\222\377\344C\337\256\220\354\345\332 \364\202\344\336\247\013&\322\317\222y\003\245\251\326y\317\200\234Z\265Je\337(V\025C38\312Sm\023'\350K\261\006`J3G\373\340Y\260\344\252\365:\256\346\336\365Zq\365@\032\323\022\340\325k=\327u\320\210@\375\304O\371k\001\032gO\324\210\331JUm;\270\025\024\023\206\334{+\370_\257\222\302/r\321A\273]\231f\247R!P\314\326\233\237\247N\335\251\004\200b\264\326"
+	.string	"\357+cN\325\251\327:\345!\205i\t\220\236\277\221\262\307\227Z\251l\341\274\361UhXf\211\236\331\217r)<\277\210W\f\321\227\027\375\241\361\342k\211\2505fP?z\006A)\250\021\020oE\006\233\021P\320\021\013\336\006\036QPO\b\200\021\020\217h\210\304Q\013^\257\007c\027\300;\b\274^\321N\267\023\322\265\030\n\"\322\355zF:\b9\027\271\340\365tGEE=\335\315\374\335^k\353\251\037\236D\023\242\331\352\032\277\345d\235a\233\254\306\360\253@#\331{\245.\374\352'\273\242\247\275\367\336\033\316'\354\251\326\226\200\332\373\230\214\266\257\312\347\344d\306\334\030\370aN\341\324j\317\207\372\032F\233C\007\372\262VO6f\006\266T\225\374\005e\307%+\325\226\217\006\350\317\375\207\321\016!\202\276\034\353\271\306\332\200\361\214"
+	.ascii	"\242\017E\250q,C\r3\004\021\022\032\021\t\263\2400\035\240\""
+	.ascii	"\031\243\365\020Xg\243i\226\003\016\242&Z\221\222\267\276\"\265"
+	.ascii	"\t\301(m+\207esY\330\0020]\3774\212\001\324A\013hB\225\262\311"
+	.ascii	"\005\007\017H\272\342K\2303\215\361\240\261\360'\0338,\373-B"
+	.ascii	"\252\t\313 u\373r\2202\210o\271\016\324\350R\344\365(\361\370"
+	.ascii	"\312\236^\236a\365y>\266\254$*\037#.\\\347\205-\307-\266#\bz"
+	.ascii	"BDC\314 \203L\217\034\265\372V<)\022R\214\374\214\370\242\257"
+	.ascii	"\345)hQ\001"
+	.text
+	.section	.gnu.lto_subTaskPidController.162.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`<\f-9"
+	.ascii	"Ja@\025D`\246N\007\023A\200\211\3534\247\356O\353\243_<j\031"
+	.ascii	"\364Q8nLWx\332\035\033X>[\353\237\335\310\271\231\375\004}\030"
+	.ascii	"\356\263\201K\3077(\251\303\3473\004\240\275\221\263<\246\211"
+	.ascii	"\320&r\357\224R\nC\001!\001H\001\276\353|\257s\232:\243\357\374"
+	.ascii	"\250\263\277sO\350$s^8\302ZL\013\313z=\373\260ti\234Y\257u3w"
+	.ascii	"\263q\220\231\327`4\033\3066\215\27515\362Xvm@\247L\245\2663"
+	.ascii	"w\225N[[M\006\377X\326H\2320,\273V\200\001\250\235\036{x;E\333"
+	.ascii	"\350v\312+s\035\"\027\233\205@\3143\351\266\307\262\354\324'"
+	.ascii	"\351\265\243\240\236\216\306\242S\023\323\222\0221\tixdTD4$\024"
+	.ascii	"\004$\f\002\177\252\357\246\350\373\312\315\326?%XVGAu\341\342"
+	.ascii	"Oo}|\333\342\306.]\354\242\346Ni\335\204\n\030S\243\243\353\276"
+	.ascii	"\322\320\241\233#t\232\255\237\316\276\2528\323\322\223\022Z"
+	.ascii	"\323\211>\bF\302\320:i\212\231#Q\03169bR\346FT\212\224\020\265"
+	.ascii	"K|\250N\250\356k\310\331\027\231\007\215\2219\320\331\227\020"
+	.ascii	"\027\006\361 \020\007\376\360\237\025\037\256\236}YA\217,\313"
+	.ascii	"v\335\227\230\373P\001yb\364t\335\227\025t\350U\246L\372\345"
+	.ascii	"\321i\027\227\243:\372\321\003\\{A\202\300\266P\341\236\344\233"
+	.ascii	"fk\267\001\206t\367A`Y\226]\t\026\326\f\240\231\275\b3;`\006"
+	.ascii	"j\bbH\177\312Q0\361{\020-\234\363\252\317\314\005:\316\302\024"
+	.ascii	"\031\313\262\f\270\303\264\230\013\334L:e\f\0312\334N/\034\345"
+	.ascii	"\035\337\253\367\323\367}w9A\372\223\243\376~\243\237>\321-\371"
+	.ascii	"G\313\237\350_'\023\b]\372KN\240|R\366\006^H\371d\314\271a\334"
+	.ascii	"\250\267\301n\375_\302\313\177\2076\213\023\311\251\336\237y"
+	.ascii	"\003\007o%\037\271>\213\271\267\364\333"
+	.string	"\013\017\037>\334N\375\201m\226&J\344\314\"Fx+\r|\223!\202\374\254\346\2730jD\376\227\234v\325\355'\321\206\267\345{\230\273\255\261Tq3a+\023\336\312N\271M\334N\373\3233/dcibZ\376d^C\372/\231\373\237\317\347\223\037\t\363\317yA\253uS\031xg\251^k\216zg(\237\363\223\352|L\235\215\357\\L\235\235R\347\246\2373\323\317y\351\347\254\024t&\006\235\223\202\316HA\347a\320\371(\350l\004t.R\235\211T\347\241\237\263\220\352\034\244:\003\251\316\302w\016\252\316\300w\376\371\234\325\353\034\357\"\351\211\357p\177\232O\373Y\301\214}\274\231\314\3554\251L\223\263\304\225)Bz\027\303Gz\207\333c0\001\342\020h\275\025\314\250g\370=\326\3169o,\313\210~\311`\232\007\313|\264\305\262ZQG\217\325\326\306\350\217\276\375t\355i\361\352\325x\030L"
+	.ascii	"\005wV\260b^\333Ys\354X{\364\270\235\032}\007i\347\232j\035g"
+	.ascii	"\247\306\220\217[\364B;*!\353\020oe\321_4\3475d\023\221\340\t"
+	.ascii	"\021\375\227\255E\210\276\327\360\233\227\271\240!)\037\352u"
+	.ascii	"y\231\327$k\353\255\034\372\266\303$C\267\325\006\251\006\024"
+	.ascii	"\340.\260k\303\033b;\300\025\372\005v}\267.i\262\232\231\335"
+	.ascii	"N\205>F+\347L\217\314\271\"\fz\363$\350\031\264rM\240\2262\\"
+	.ascii	"A\240:(@N\340/\315\264\260\3334\335\325\032e\225\262J\271\235"
+	.ascii	"\n\237A\013\246)\366\373%\367\212v\203\314k\263\325\254h*\313"
+	.ascii	"n)\340F\323i\326\264\325J\204\b\267\323\340\207h\2778\325\264"
+	.ascii	"\374\311riS\310\324\253\013\374\022Eg\2260\301[\t\374\306c6\351"
+	.ascii	"\220\237\305M\266'/\214\317\351J}\263\265Z\327&\247\333\351\376"
+	.ascii	"^\352\331\223\001V(Nh`\2015\202\305\212\337\212\rV(Nh`\221\302"
+	.ascii	"\n\013\253E\025\020WIYa]UMU\225\230Jqb\004\212\251*\254\025S"
+	.ascii	"RC\276Ra\2055\305\342\352\nk*\270\246\325\217\204+\2449q\346"
+	.ascii	"i=\022\215\372\345\262\311\222@A\335=1\222#\335\344\212\033\216"
+	.ascii	"#T\021\250W\321\322i\016\tk\357\366\362\374i\202C\317\370\344"
+	.ascii	"B\202\020\335\216\377d\374\343wR\356\207\361\333\256\025+\352"
+	.ascii	"\350\342\177\334\027)N\277l\013\227\231\tx\017\013\017\234Gc"
+	.ascii	"!\313\243\345\317\326r&\256\351\227l\354\252[|\027\236\243\370"
+	.ascii	"*Z\273\246\030\323/i4X\377h\341L\311C O\317\222\004\277=C\357"
+	.ascii	"2\317p\316\340\323\314?\021\374\3303\236Y+\322\337\230~\230\236"
+	.ascii	"8\225\276\351\323;pzmj\266|\017\321\351m\244p\312;\350\333^\313"
+	.ascii	"\270T\357\364\305%\220\273\2561\344\030\266FR\313\270M\337F\332"
+	.ascii	"\360\274\313\2232\270\326"
+	.string	"d\362v\332\364}\326\256q\2121\331\034HTL\337\314\336\303\204\307\310\213\307\360\227\354Y\275\364\315\034\260\364\216\307\264\323@o\356\350\227,\324\353\222\253\364.\332\3308p\002\315\274\332Xox+\225\336\3050\333\320m}\226\231\0266F\304\200\357\250a8D\025cfDDD\222$)4\006\260\002\021!\262j\003\021\320,\206,c5M\241>\315\001CaMR\366\026W\260\312\374\232\0248|\314<\352\217t\311\333%u\263;j\222\276\312\245\367&\261\265\n\232\020%C\2329>R\177}N\322s\376\252\216\300\031\336\306\245\231\206\363\340P\242m\251,\326\331\307<\304\006\204\251P.\006\236\240h\022\303\304)\373Y\262\247\304`\275\321\371\230*\240\0012\225\024\313\254\222[Ce\267\204B\032\335Th\370\006\335\225\307\200\333\220\235f\225\f\254\206\t\213\223\037\036\330\360$\217\320\005l{\360|5\261"
+	.string	"_\b\r\342f\375#\323\367B\261\357\272\376\016\226\373\335\317\f\n?\366\321\350\333m\356\274\361y(\244\233\037\240\f[#O\252\204\025\337\242\021\0021r\r\343\r\030\301\376\376\250?nL\265\242\210\231\275\257e\300\006\272\311-#7\306\023\214g\274\030\324\234\314\020\226\022&\345\256&q\260\303U+\t~1\226G\355\375\333z}\016-\001`\252\335\212\313\033 w\tJ\345\343\207\022\204\332\215B\315HG\212y\247\256\362-\277\201\255\203\331\3620\343\270@\303\360\370\235\2757\203\022%\216\353\356\316\322\242\357\230SJ\222\022\221\304\245\364OZ\247\r\2474\203\2044\363#\220\201\026\036\"\212\317j\356\245-\266+\367\237g\235\340\262\376\306*\244\212\222\204\370\207{\376"
+	.ascii	"\356\273IF\214\242\270\201\311%\021\366\253\231\271\366\364\254"
+	.ascii	"\337\2046qut\261\323\367\200#\212\241\022\031;\222\310\317n\304"
+	.ascii	"7\212S\005\230\243\t\304\r\305\370>%\247>\"ZB\273\017\020\200"
+	.ascii	";\023\330pG\377\177\r\2312.5"
+	.text
+	.section	.gnu.lto_subTaskPidSubprocesses.163.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\211\003\305\030"
+	.string	"\006\356\237H\300XM:\300\2532\311\373\226\"\327\364\362\t\020\370\177\2336\320\226\361Ab\240p\006bT\177\366J\337\314\332\372\362\030O5\225+\364\322\242\003\337\033\301\262/\233)\230x\262\\\f!\226\362;2b\t!{o)\223\f\217"
+	.string	"\177"
+	.string	"\213"
+	.string	"\271\005{\340\373\234\271\212~\312\017\240\237+\333\265\262\322\2513\007KUx\220\236j\255b\007]\366T\210\002?\217N\331,\333{\022\300\0217{\352\347\341\233n?4C\267\031\214\242\261\321\343sP&\300\202d\313\233n>R\345\202\307\370\241\233\f\376\206n>4M\267\030\354\3018\345\tq;<\001\340t\344L\255u\207\345\213\267l\240\363\364\003"
+	.string	"g\223\251.<Pntn\201\2531{\022j\255\313#\256\347\033\363\335e\332\335\b\273\335\nGN6\356\262\373\243\0231\261\337\261/\030\177\374\334\303\350\347\333\203\216/Ab\320x\267\233\253q\003\355^\326\276\261\373\242\177%\363\3347\345\361\206\224\027EyA\312\373M^\257yi\363N\311+%oK^n\336\027P\341\240\322s\032\\ju\261\373Ru3I\217\347\376\335\337h\303\335\315\345\274\366\324\263xZ\272\202\245\326\234\202\317e\360\235w/\344D\262\027\255X\260V\033LJ\265\006B{\341J0|\265\332\036\354\223|)\303~\307\347j\330\260\201~\316F\340TD\343\035\177\362\310\225Tt\370\360\201~\312N\200\304\304\033\300\273!D\360\307}R\020\230\246\r\264Oz\367\267|\335\322\350\\k\235\315\006Z\002E\206\320h\231\0160\022\205\341}\016Mu\213\275\n\312=\342h\212"
+	.ascii	"\236y\016\335\265a\361G\356'\005y\321\331z&cx\267\204\213?\312"
+	.ascii	"4;\005i\321\325z\266R\224\212jt\003\355\274\t\372\036\021\255"
+	.ascii	"\227\213\003N\314\006\347\006\274\351\320z\2718\340\234h\305"
+	.ascii	"b)X1\313\252i\305`,\221EB<\341\262y\211\254\330\215X\243Z\030"
+	.ascii	"\212VL\304\201\301bb\230\243\275o,(\364CG\353Z*\354\335\2559"
+	.ascii	"\223\214H\314Qk\205\260or'\262!\023(P\240\2374\312\230\005\325"
+	.ascii	"!\330_\243\372;>j\274\333T\203}\257\277^!\361\204\241\361\316"
+	.ascii	"\353?\251Q\353\331C\244\323&\261\2046\b!#AP\006x\325\273\025"
+	.ascii	",\b\311\320\331V\t\021\220\034\3401\320\331\017D\250a,\303\234"
+	.ascii	"aJ\261@$\220h\264)l\003\240\002!)\273\003\020H\307\210\346\030"
+	.ascii	"3\275\272\356\360 \322\2272/v\\\033D\273\360\357\003kh\327\331"
+	.ascii	"c\001\246\341\253R\214\245\224\270\003\355=\364J\256\202\306"
+	.ascii	"D\201:My4\332\"\254\343\325 \347\301\360\020H\320J\231R\236\201"
+	.ascii	"\023Lc8\306;'%W\324$\271\2311\330',\244\356f\"\223\013\272\342"
+	.ascii	"\352\360A\016\0344\2013\273\335\214\216HN\261B2\002\370\213u"
+	.ascii	"\205\255\366h\377\263\006\304)_\374\001"
+	.text
+	.section	.gnu.lto_subTaskTelemetryPollSensors.164.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\017\001]\r"
+	.string	"f\331[C\020\221\223\016;U\031\224"
+	.string	"\215M[\301\3470\204\270\210Y\321\n0[\321\377\237Y\347U\352\203q\323\2036X\374\225g\313gR1\013\t\002\204\203\002A\021@\376t\322H\344\250=M{\352\332\366\2262\245G"
+	.string	"C"
+	.string	"L"
+	.string	"\006\356\321<\302\023\320<\272d\277\370\227\262\037\025\007\221\026\032\273k)\312K\207\232%\377\251s\272\023\310a\206+L\020\223b\306\200S\b\364\220\240\272\247\236\027N\\&\200\005\273\353\354N%w\274m\006\266\033\330\357\b\326\023;\24670\035\277\362C\230>\307\203\302Pr\017\305.\311\214\215]E\025*\232\267\357\2278\213\307?sx\252\316\243\355aw\036\337\261\375\264?\342$J_\3710g\267\003\314\313\356\247\300\b6\217\0010+NA\236\"\023\363\242!FR\357\320l\324D\203\327\"\206\013\026!)\343\250\033\375\310\020\271q\205\032\365,?\200R\031A9\001\202\273\211\267|\370\037la\224\357\036\375\221\346\361\312\341\251j\230\230r\306\376\270T\017\366\341\356n\226"
+	.string	"\302\262\020\311\022iY\246]\005F\017\260,\344\200$\302\266\215\302%\300\027\b\333\264\313\272\"X\242\020\204\314\272\266\221\005\362X\233\200m\026I\3236\253\363\231\016WO\314\361`\254L\312A\250.\025\274\025\"6\004H;\323\362\235\357\342\005\026"
+	.ascii	"q\224\301\231\320w\024#\303`\254\337\033\204FXY\036\374,\301"
+	.ascii	",4\270\261\013i\033\307\254\265\263Z\300\242\026q\027\334Am_"
+	.ascii	"\301\022\261jE\234\344\251\256\234R\250="
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.165.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`S\004\355\033"
+	.string	"\026\362\256I\260\226Q:e^#h\035@s\364U\206g\327lB\362\312\221+\334\013\001\233\246\340\220\324n\332\333/<\374\2617YA2dx\236\335kFy\214+\257-\374]A\265\337\361c\234\315>\333\335\f\366\023B\310&r\247\024\232"
+	.string	"\211"
+	.string	"\237"
+	.ascii	"UW\377\342\n\270TUko\301\251\033\220\237\366\211|\t\350L-\\\326"
+	.ascii	"\232C\n\252\326\036\003# O\013\274F<\r\037@<5\220\275\0056Tk"
+	.ascii	"\017\200CnNW\265\326\330\3568\320[%9\2124\334\t\344\337\367\022"
+	.ascii	"\227\253\275E\343\345\247\212h\030\370Q4c\222\006r\350v\037C"
+	.ascii	"\005UM\272|\252h\027\326\020\365\300\335\246ht\352\302\225\033"
+	.ascii	"\232a+g\364\r\035\f]\325\230\311\t\2051X7+\367}\306\310\331\346"
+	.ascii	"\034%\324Z=q9\335\355\272m%\333\030\354\020C\373\022\342w\304"
+	.ascii	"\217Jhb\3317\362#%\374$\353\230\230\307\235\372&\304\323/\375"
+	.ascii	"\001"
+	.string	"\274\272\261\264\013\232a\354^m\356\221\375\260\256\016\373L\377\200\377\356\033\230\315{7\3158\375\"\247g\310i\031r:F\234v\321\351V9]\216\323$9=\222\323\2428M\311\351p\234^qz\322\351#8\357\013\221\f\335yYj%\n\363\245\006\251\023\245\377\036\316\367\276\366\355\027\361\233~,`\004\201O\021\310\323\337g\227\355\336\317\003\177\342\r\201\315\001kk\3300\217s\002\036\220\240\320\326D\233\235T<\033N\236\004\217Pz\337\017XA\t\262;%_\225\020\266Q\256C\302\"dG\256m\234C\001N \316j\\R\334p\307=]q\177\313\nz\322\201n\271\0137\300Q\022\225[\326\356\2227\361\360\342Qk\205\34039\324\007?\351\324 B\204\270\2018\253\233\335m9%E\335\262\346\302\366f\327\311\205\017\333\223\\\311\317\n\021\"\304\323\271\227\202d\305\313k\332\262\331<\016\266o:"
+	.ascii	"*\2440A\333\326\234\005\212\tG\263\035\035\0169>'f\024hh9>=e"
+	.ascii	"O\207\331\216\016\007\037\0243\032M\205L\3062\234\031\215G\026"
+	.ascii	"\223\221\210\241\320\311\331\211\311h=1\234\032\363\244\230\321"
+	.ascii	"b><<\264\230\253W\277:\\\362\300\004\203\326\326za\361\020\273"
+	.ascii	"\"^\231\331\227\314\306\354\f\315\312\2706faN\256=\025\034\266"
+	.ascii	"\255\275\224zkIL\265\226\026\211\3422\301\0020h#\tL\273\202\205"
+	.ascii	"?\361\226\316\003\253\nj\334#\333 \221\332BmN\204\213\232\022"
+	.ascii	"\372?\342\233~#$QY\013[\232\215a\357\210\345\216\370i\0210\355"
+	.ascii	"\013\031\346q\345\006Y\250a \347\224r\n\215L$\0234-H\033\200"
+	.ascii	"\002\231)+\017\020H\250\2066\351k\210\372\243\343\310\355\241"
+	.ascii	"EW\370\3454ZT\342\327\321 \\\341:\016\332\201\222\026\366\367"
+	.ascii	"\013\347$\275\333<\311]\225\330d\275\307\333\032\021X\202w\200"
+	.ascii	"h\004\315\b\t\331\360\027m\317m}\207&\352\r4\205P\235:Y\246\203"
+	.ascii	"\3211\244\254o\3135tx\201O\303ho\003\2324BGh\364\336q\004\246"
+	.ascii	"&\005N\274\007\202K\005-\302\026j\373W\021\312\006 \034\340Z"
+	.ascii	"A\330l\020\277\257\323\005V\332\024\363\356\037\335\361\347\b"
+	.ascii	"\361\254\036n\201\"\231\352\232\032r%\307\024\220\270\347\017"
+	.ascii	"xN\371\355\257!\262\032"
+	.text
+	.section	.gnu.lto_subTaskRcCommand.166.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\236\002U\024"
+	.string	"vc\200I\300\224Q:\350&r`\020\340\211\302\202\3302\332\340\3701\326F\362\301\016\237+\206\177\343\344_\336\220\375^\354\377\372L\007A\237\343%,\017\177/\304\030l\220HLjQ\343\201\002\322\225=7\303\272\333\232%{o)e\nn"
+	.string	"_"
+	.string	"j"
+	.string	"\362\262\177H"
+	.ascii	"\234\236-\330A\342V\204\244\273[\334Bej\242J\205SF^\3315dQ\341"
+	.ascii	"t351\300\263\323QULi\002\336\n\364\354DiP\016\305\2464(\227\263"
+	.ascii	"\341\274\255\214\254\037+\204\240\350F\304\004)\234N\254t8\033"
+	.ascii	"W:\3332\220\234NL\351n\255\241[BW\333\rY\272\373\213\323\355"
+	.ascii	"\364+\375\337\373\257\340_\025\0013~\210\251\274\301\007e\333"
+	.ascii	"$W\355\017\373\260\212SV$\236\f`\215g\177\257\266\354\363k\354"
+	.ascii	"\356>\367\374s\037\316\375\214{)\3671\356\231\367\273{=a\005"
+	.ascii	"\001\332\251\220R\267\211\240\222\006\312_\214\325\177\335_i"
+	.ascii	"\350\220L\211D\\\325\315\243\224\243\273\247\362\003)\225)\312"
+	.ascii	"\232*\243\002\230\032l\344:\206\204\\H\366Q\2279YY\370\240\376"
+	.ascii	"\n\232\344rCq\274\\\200\201\231*'k\316OR\024\021m\203\032\331"
+	.ascii	"\347\222\231\027\206\317\207m\223<\262\304\240H\031R\3356\006"
+	.ascii	"W#=\322\020\343r\261\026=\021-3\353m\tm\203+Z\364Juw\203\253"
+	.ascii	"Omt\270\002\251\274\314\214\274\316"
+	.string	"L\225\313*O?\332\006u\273;6//\032\031\01375\257X\f\204\353\344\256\225W\f\346j\2718\264jdbhZ\256\230Mk\205u\230\207W\254u\003\203\305Z\253\036Mcs\317U\274& \215k\017\020\360xD\023\002\373C\210\260\212\273\"\361\230\006\374f?\252\324:E9X*b\224B\221;\247#o\"2\243G\3502C\326 \337\223\004eZ\322\337\004\n--Se\310\032|\301G;\271\244) > \220\002\231A\353\006CC\347L\f\3470\356\222{\312\013\222\213`?\344\324w\0037\3351\021\341\036\357\307\0241\215DP\2664Y\270cHH\003\277\312\213\261k\323\034\023\223\376\367\254\264\306\305\340\201\264\345L6\260\rY\211m\361\354\022\326\253\346\303\032n\375)\336d\332\032\352\267fcK\253Z\273j\261\317k\300\206@\274\246\030.\371\200\030\233y\275\346v\204-\220\"\224V"
+	.ascii	"\330\273\250c\326R\217\330+\003"
+	.text
+	.section	.gnu.lto_taskGyroSample.167.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`2\001%\r"
+	.string	"\346XWA\020q\233\016\030\256\371\026\021\264\227TV\346^*\373\237S\013"
+	.string	"x\266'\300\r\320S\340\302\022\311\372\023zj\346\315\253\223!'`\250\342\b\n"
+	.string	"\"\300!\221\251\240\r\020e1\274\321\222\275\245L)C"
+	.string	"A"
+	.string	"E"
+	.ascii	"\0046\036=~\221\036\341\003H\217\336l\030\007\201X\001-<\027"
+	.ascii	"N"
+	.string	"\210v\227\322\017\337\01657\337\0022y\037w\250\341\n\340\333@\217\335\275\311\023\303\327eZ@v\327\351}#w\274m\004\266\017\330\357\004\236\013td\204:\345l\020\227Zb\037\356\356ZI\354\177\376)\3231\3230\323\232\351\314\364;.+(#\037\221b7\303\250\306\206b\212\207\303\366\323>\211\227\330\376\261\340i\327\203\t\213]\220\001\007\031\216\212(\206&G\271\273\234z\200\244\332\340\344\305&i8\365\252z\221\224\016\305\203\324\311?\271\211\313\017a\bX\336{\3641\351\361\372\017GE\004\007M\216\274\221\223\332\0220\357\210B\033\345\034\323\246P!\037\030\005\026v%\310\204X\2326\241\352p\365aiYEU\016\250\220\213\001FU\032\206\372\2708\213`iT&\3134\212\003\264\207\253$\236<\033B\032\355\034u\305\275\225\377\222\240F\275H\207.GF\201\272\200\343b\006\324\222KR\021\034"
+	.ascii	"3\241\255)F\343\005\202\340*\305\203SV\201%\244r]\314\202\236"
+	.ascii	"\331!U#\254,\f\034\241!\304V,\232\305\300\035\020\214\347\270"
+	.ascii	"\031u\272\2326/\230u\t\213X\215\006\356\0220`Q\345\266\253\350"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_gyroFilterReady.168.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\035\n"
+	.string	"\206\022E@0\251(\0350\304\207\352d\325\023\233\371\374d\025\306`\276^+\321p\360\322f\264\200\363^\377\211h\373\004\373\0234\246\031\027\217&\016?,d\260X@k\2041e\272\212N\247\264&dK\231R2"
+	.string	"1"
+	.string	"4"
+	.string	"(\007(\354\206\232\266\334{\324\364\374\3571\003"
+	.string	"\204\006\016\020\200*W\007\360\023'v\367\250\247\b\004e.dv\327\031\002I7v\333\032\266)\354?\004\371\262\303/\325d?\256\226l\247c\2465\323\231\351g?\t\030\245\220N \302\356\350\345Z\006\030\353d\273c_lq\321\261\027a\362I\300h%\b\031\217~\242\232rw?\225\310T;\f<"
+	.string	"e\005\247^U\177\302\372\204\233\324\206\247^\200\304\017\340\022N>t\314\347d\307\256G\275b\302\202\001,\251\025O\3360\232\216\333\264\315C\013\371\340"
+	.string	"\321\266n\243a \314\211h:m\204\343:\355\022\356\343j\311\033\nT*\365\275\354\2503\270Z+\325*\177/\213*\262\035\325\001\021"
+	.ascii	"Q\204>\316\206\267\307\0167Z\345! \307\004\006y\2401\236\330"
+	.ascii	"E\251\241]\023\027\261\320m\210<\356:\252j uhkK\031"
+	.text
+	.section	.gnu.lto_pidLoopReady.169.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\245\n"
+	.string	"\366SJB \251*\035\007\307\245\245A\326?\254{\314\023\252\241\3777\350\225V\032^\t\321\242\fBX\222\312j\035eC\331F\232#\325\270\221\200\316\005\020d\001O\024\355)6\300\f\030\b\240N\351\177\262\245L)9"
+	.string	"5"
+	.string	"8"
+	.string	"\bL\nT\230s\344\266\345\340\345*\350\213.1\\&\260,\200\211)_\311\201\211\006\036D\222t\020"
+	.string	"!\300[\327\223\030\252f:sN\253IL\335\333mg\330\236\260/\021.\225\221\326\354Q\244\273\262/\347\252l\2537UKU\257\252U\325\317\234u"
+	.string	"u\222\272\213\302\234\250\032m*\330d,\333![c\216E\310`D\211(\302\305,+?"
+	.string	" \001eW%ww\203@\003\222Z0\305u\345\276t!\324\232u\277\273/\311\302\361\243\333p\327\007\214\370/&\001\351M\337|\020\346\333\367\255W\244\022\320V\002\3566\236\317\353\270\216\203\003\351\320\370\340\272\357\303m \354\205x>N\304\363>N3\316\257\312\0363\007\257\230\372 \346\2553\320f\f^\261\375A\314\266'\333\333\2723\332Pn\017"
+	.ascii	"S\b8VG1\330\272<ZT\316\b\002R@\273<\361\210R\243\270&\276b\241"
+	.ascii	"\333\020y\334uT\325Pt)("
+	.text
+	.section	.gnu.lto_taskFiltering.170.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\222\31633`O3\006W\020%\262\t\004 \017\322\021\360\330l\031t`7\266\032D\360\353\330V1\310a\003\001\004\006`\001?\325\236Ue\001\304&\303\332\226R\246\024\236\206\212\263a\370t\2529#(\201R\232jZ\224\244\036dg\343\300\221\324\364H\315T\013\242\232\362cYSf\270;\036nT\322T\272\nh\321\370\036l%&\236\263\"h'\335\005\304Z\016{\220\243u\374\377\302\215\326\233\375\342\344\362\021\362\266\362g\274\264\274\213J\264L[\277\326 \016\271\274QT\37256\222\237K\350A\200\243\002O\030G\321\003\030G\275\332\024s\036'0A\301\030a\371/a\207/\277\253\266\210\245\f\204\371\001,\374\357\313@!\027\272\255A[\205\266Z\b"
+	.ascii	"2\241g/0p\341\035\314\273\004@\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.171.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`j\002m\022"
+	.string	"\026bwG\340\322&\035\223\331\312\240\004\027JG\373\2531\t\217F\327\322m'\254@\037\027#Mt\230\236<\262\007\333\243/\006;\276\261\351\362i:\230,c.)\217\3208\342d\271g\244\260\317{\031w7\221H\366\336R\246\024d"
+	.string	"X"
+	.string	"d"
+	.ascii	"?!\334\315yB\210hN\233\002\037\030y4p\024\371\b\177\"\037\355"
+	.ascii	"\262\211\334\3463\t\0345\311\202\224\346\234\336\242\270\353"
+	.ascii	"\234\214p\325\345\037\350\3357{\235\033)q)C\315n4\312l\024\222"
+	.ascii	"\370B\0066J&\002\314b\260\204I\026\344@W\0213\230*\367`\316i"
+	.ascii	"\375f9\367\310m\203\260\275\300\326\025\001H1e\262?\3434V>\315"
+	.ascii	",\031\375\367\350\313\310\307o\006\032\216\027:5\372d\333^\272"
+	.ascii	"=\366\341\234szy\354\377\374&\252FE5\211Tw\252\346\242ZBu\204"
+	.ascii	"j\b\325\273jU\365S^3\302\031\221s\240\"s\342<5\315[\334\221\002"
+	.ascii	"e\373j?\306e\270\036\034rp{\2016\264T\001\306\212\013\f\257\265"
+	.ascii	"8Q\223\2655l\320\177F"
+	.string	"Pcq\213\355\013\312\265\235\340B,\236\317\234\323\201o\3437Z|\332\243S*\225|\224B\276\244\270\022\356n\334\337\250\200\351\223M\026\356uwS\202dN%j\277t\320\177\272\007\262\003\333\327=\204\350gg\267\307\361+\371u\251\0213+\252\325\213\005\032\030U\253\345!\005\300)\025U\213\225\362R.\036\314K\313\312K\265f<\025\024\263bT-\217\206\305jy(\333\374\362\270\253\035\335j\026\306\025P\033B\204\335\327\0054\375\360!\207\216\332\017F\250\215\241\025-\351\220\024\2614\340\361/\251[\222\345z\310\234\006(\312%H{\002\005\375\327-\207T\323q\213\305\177%\271\r1 \320\002!!\262\003\203\200\221d\310\035l{_\324\305AK$\264t\342S\302L\021\274\254e\017G!\322&\343b\276\2622\374\312\266\3556\210kB\013\362\311\f#\3635\326\317=\264\r\273\226\023(\032\240\271"
+	.ascii	"\234;\257a\341\205\013\243\212f\007mq\300\356(\023^\b\304~J\240"
+	.ascii	"#\345\232\274\340\344dw{;\2018\246h\025\n"
+	.text
+	.section	.gnu.lto_isFlipOverAfterCrashActive.172.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 \342U\006"
+	.string	"\302\013,3PO\222\016\240\234\252\206\251\203FJM\004{\274\005o\274\212\355\230>K[\273\265\206\306\315\347\210\331\225\2319J\264\270g\005*\346\255\351Ejho\231\002O\027LEMmzh\022\020\016\021m\252(\332\245`j\002S\265\n\212\252\232\204e\021tx\300\301\213oIM\254\013\262E\346z5\272\231\200F\207\003\034\234\313\036\333\034v|\001\022A\377}h \242\361ih%\263\223\265\244J\2042\362k^ZaA\263U\354\243C\220\022\222q\302\222\2115\364\250\325\263nI\332\200\021\312.\317\246'\300\220\231\337\345\371t\354\237\360#\374\033\001\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getLastDisarmTimeUs.173.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 \360\215\006"
+	.string	"\222\f.4Pm\222\016$\243*J\206\242u\326\246\247\350\265f\001\325\024\235W\323\013\233\335\355\360Z\301\215 l!\252*\t\242\006n\001WN\031\264!\214&\226l\231\002O\230LEMoZx\016\f\n\ro\252 \036\3062\365\220\251^\004EU\257\222e\307v\271\332\304\367\243\231uAKh\260X\335\325Hu\330\002,.\034}\306\301\226\361\245d\303\370ql\003!\320\247\242\221\314\212\321I\222\270\220\320\277\371\312\345h\307f+\241sy\fD6(@L2\263w\251E\252\243T@\252k\032\265\212\326\255G\021:\242\022\314\303)\002\034d\346\210y>\275\365/\370\t\376\213\b"
+	.ascii	"2\003\3020\021\341j\327\304\336\210\234\205\310\303]1\265\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_isTryingToArm.174.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 \366\255\006"
+	.string	"\302L.4Pm\222\016$\243\252,`\364\270\364k\313\025(\312\216\261\222\272\377}\177\366\355\337\rZ\027\337\b\302\026\242*\252\210Xy\251\215\200\f\001O\035\266\265Md\nS\027\214UQ\217rx\021\017\r\020\217\262&\336e\340J\002c=\212\252\262\236%\313b\b\261`\203\234\021ZDlg\343\324\243\037\227\\\215+\336\\\261N\367\255\322\251\030`\261q\243\3174\016E_)1\364\273\321\271+\021ph\240j\"\231\236QJ\236L$\033\177\346-'(d\276\232ex\004L@:!(\231\331C\214^u\327mG\031D\332\b\366\321\324\001,d\346\016\373\200:\366?\370\r\376\213\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_resetTryingToArm.175.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 \3445\006"
+	.string	"\"\213*3pK\323\001\220y\240!\317L\255`?P\370\n\302\261\244U\177\320\212\030A\032oG\313\337\330\222LH\364\277\376\341Vl\374\263\227_'\306l\263{\247\024\236PT\351\2243@\022\b"
+	.string	"\f\310Y\r$41-\210\252<\240\264\312g\333G\314\321\030<*&\370r\177\342\024\276\3603#\270\203\257\336\370\356\"o2YFD\007\005?{\233`l\260\017\331\210\331\221\242i\\\3478v\027\276\217\365\032\013\b\333\177,\331\033\337\036\266\202\301)Tx\354\256\214\016\227\016%\377\022w*k:\224`v\327\260\262\256;\336b\373\n\t"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\306lm\327i\001"
+	.text
+	.section	.gnu.lto_isLaunchControlActive.176.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375 \365\245\006"
+	.string	"\242L.4Pm\222\016$\243\212H\340\364\007\227G5\332\246\230\335L\036\374\257\373\263o\377n\031j\255\340F\020\026\2141c\021E\367\255"
+	.string	"\301\024\300\317j\255\375Md\n?L\306\252\236{\f\356\241a\301\301=+\302a\004\256 2\226\223\250*\313]\262\354\210\004\036\374\334j*E\304\202J\237~\024Ds7\236\330\264b\245\356\246R\252\bP\341i\247\317:\r1\276\224\304\213\277\215\255]\312@\007\305\250$\221\314\320\351$G\250\022\307\317\371\313\007\b\234\257f\032\241"
+	.string	"\223\t\024b\222\2319\314\350\325v\335zT\201\204T\202\211:m\226\204\314\274a\242Q\307\376\006\177\301o\021\t"
+	.ascii	"2\003\3020S\270\033\241,qML\031A\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.292.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\247\022EN"
+	.string	"Zw\034\033?0bR\007O\007\331\312\024%'!h\202\n\371u\225~\322Ul\201?\206\376\031\365\246"
+	.string	"\357\344T5"
+	.string	")"
+	.string	"0\216\020z\204\376\377\035_\356vww\273?"
+	.string	"iF\266f\204\354\275\245L)\255\001|\001\242\001`\006t\374\0272O\0033 \377\027\262g\331\336,\304D\337\026\257p\236\367\274\036\366+\342\347\345x=G@\004\216\335<\317\307\327?O\207\373\361\370\360\337\271\273\2164\227\335\003\375^\224\371\315,9\023S8\3173\364\341\r\345\345\207\360\300A\003\006\013\024$@p\300@\001\002`\003\004@\277\002"
+	.string	"\360\352\342\332\322\312\302\272\262\252\242zNIEA=951-9\233JIHG\314\2452\211<\032\213\304a\f\277[\373\236\354?\214P\005\250kU+{\b\335\177\340\240\3217`\264H3X\240(\221V"
+	.string	"\243\f\036\227\353\232\242O\300-\324\b\270\204\372"
+	.string	"7\22060\bH\027\370\243\t"
+	.ascii	"z\260A?z\300\240\240\026\340o\326\347\241\201}\364W\240\035\035"
+	.ascii	"\240\316\003\250CG{\245Q\004\250\273\262\317\225\235\243\267"
+	.ascii	"\264\344|\226\2324\032\313\357\257\374\372\264U\225QNN\320u\r"
+	.ascii	"\315S\2351\243\237g\312\350)4^\264T\224\336C\345\341\351'\247"
+	.ascii	"\273o\352\302E3-\r\345\320\004]\327\354\336Y\205\212nV\301\223"
+	.ascii	"6E+%\315=\222\234\024}\304\214\373%\236\264(\3573\357\251\350"
+	.ascii	"\322\336\264r\030\341\272\346\366I*$\035\236\264%\372\330\246"
+	.ascii	"D\033=\370\255\301\343^\327\332\276\230D\023\361\244\261\321"
+	.ascii	"\245!\321C\2724\266\3679\317\363\2179\323\361\323\245\271\005"
+	.ascii	"Q\343\241amU+\362\357Q\255\252\367\333\265esH\251\266\343m\n"
+	.ascii	"\241b\375\274\327>\324\250Z#\275\357\r#\314\363\354\314&h\357"
+	.ascii	"\022\336\3755sw\037\356\312 \001\361\336\022\303\203\356\335"
+	.ascii	"\360\376\263F\356\032^\273\2018\317\325\003\376v>\220\203\377"
+	.ascii	"\334\303\336\341\203~\353\207\370\341w?\037A=3\335\365\246v\017"
+	.ascii	"!B\277u\357\370\016\356\243$\332\252\331\033\353\356[\261\336"
+	.ascii	"R\276\301\252N\344\357\374[\361o\275_CgH\250\272\353H\332\275"
+	.ascii	"\304\t\375\326\337dE\340\270[\352.\323\033\353;\302\357n\267"
+	.ascii	"\313\310\267\023\367W{\327\253\235\353\325\276\225\324\256\225"
+	.ascii	"\324\236\225\324\216\365j\277:j\2672j\257Bj\247z\265?_\355SG"
+	.ascii	"\355RF\355QH\355P\257\366\247W\273\323\253\275\351\325\316\364"
+	.ascii	"j_Bjw\"\2657_\355J\257\366\244W;\322R\373\321\253\235\371j_*"
+	.ascii	"\265+_\355\311W;\362\325~|\265\033_\314{\361\325N<j\037&\265"
+	.ascii	"\307I\3550R\373{\324\276\217\332\265Q\373\223\005\b\\\272\315"
+	.ascii	"\263\220\356\242\031\016nS\345\305\374\203\371\367\373?\363r"
+	.ascii	"b\344\360\030M\320\316\326\374Ekx\224\311\003,\2327:\234F\004"
+	.ascii	"*\332\216\267\317\214\026\257p\256\356yy\233wc\303il\264\035"
+	.ascii	"f\327*=x<\376"
+	.string	"\240\017\373\3367\343\207\211\237\024?<t\177\257\361j\374A\335\234\215W\343_uy\334\360\374\313\240\3714~}c}c\203r.\23413ff\314\303`\241\202\337{=\177\276\037\343G1a\302H\365i\361\354\300\210\017\203\361@\230\366R#\2548\210\256\226\246\226\266\r/p\334m\325\352\310;\263T?#k\252\376\342`M\311\316TQ\261\323\230\210O\360\243\342\346vn\327gH\250zM\017\221\205\250\311C\344!\361\303\315\rAP\020[\331\222\247\322\376\253\026\362J[\351\017\316T\322\226B\025I\332\3166\332\252\324\017\274\250'\027-\024\322\021\244\355\324\362\244\321\234V\234\230\177mM\033\353y^N\022\037m)\237\035\2606\371M\277\365h;\331\2304\325Id\313\201!#gI\377\251i\253\273,\212\223\271\177\360\211\271u\3005\227L\226{9\244\253\304\250P[\375\244\331\020\322\313Mbe"
+	.string	"(r\234~\253r'\r\322R\217\n?\211\016\223\251t3\347\227\311-\215\223\373\363\376\203\270\211\243\255v\225\305]\b\316R\210K\362\267\357n\341\356\210\356\320 \022\371\201\036\271\377\b\\\265"
+	.ascii	"\235\353\365\270\261\376\177\276\270\241O\b\337\356`\017\031"
+	.ascii	"\211_AN\311M]1\311\231l\361\270\277\021\037\227\366\227\253\304"
+	.ascii	"\356\362\025\031\213~\353qc\r\271\362\264\335\222%\222\305\305"
+	.ascii	"Ma\277\277\311\263\20324n\235\310O\235"
+	.string	"qsxb\347\226\207\304Lw\267\024\367\217y#\223${\334m\274\261|\236h\245\335\345;9O\277\225\270\311\222\300q\267\376c\261\277\236\3373\346?\347\262\027\t\022\342\207\213N\002\013\013mXJ\277\363W\210\335-`\320oue\033D\332*\002-!\226wc\207{o\344\036\276\300x\017\207}\336\341\304\360\016\316\342kE\013\0252\242aO\316\342\253\006\214\250TLF4\354D\230\024**%\263`L\001CL,*e\001\"\2054*cE\013%\016\017)n\240`\021\277\bC1\001\207\007\261\250\005\261\0326\\$=\354+\2054\032\006\rS\001\225\321\002E\fh\230\264\006\364\253\351\321\031)\244P\261hT\n=\376;o'#\274h\3156\025\002\237)!\022\360\356\201\340\2240\213\203\f\200\246\204\200W\364<\317e\r\272\266\264\013\360mf\240\367\200G\b\310Y\303.\340\332\257\307\265\241"
+	.string	"\213h\253\277d\215!/\n\230Ok\3108Ek\t\266\366?\331\332N%j\b6\326\275^K\307\325u\2636\326\326\"Bm;P"
+	.string	"\300\177\\\034*`^\237u\265\377:\025t\265\225\262\212\264T\003V\373\2454\252\332V\033fT\265\227\262\206\264\324\002\232\312S\tN\ti;-z\313\324\320\024\321\224;\345\306\017S\355\342\036:\\=3\335%\340\204\212\217&`\317\375R\232\317\375\\\342\314\334mu\300\306\272\206z\275q\312\334\231\232/"
+	.string	"\217\265}L\355\256:?|\203\023\364s\376)\243\330}\332\225\313\364[\247\266\216\203\263\345n\327\b"
+	.string	"b\265;\004\005|\251\375O\370\004\227\204\335\300\356o\305Q[j\303Q\273\004\034\365kC\f\265\271\352\260P\365\024-\247\347\344\035\362\231\334\243G\3740\324&Q7\347\226\027\300\367\234\364\224\262w"
+	.string	"\236\366_\237\366\247\371/\302\266E[\365rr\332K\266\272\256\354\033W\223\217\246\275dk\323R\267\336\336\211\210\326\234U\313b\n\201\227\250q<g\0253\"\"\"\222$\005)\f\007q\005\304 \307\2404\017\021\240 \0061cD\222\244\220\341\302="
+	.ascii	"\314F\002\222\207d\322\340\353i\227\223\253k\234\\\241\323\032"
+	.ascii	"\017q\350\234\276$8\005wPw\032E\203\256|\354\217C\366\224\f\216"
+	.ascii	"`\006\340\275t\f\312\3539T]\344\374rZd&\215o\3573S\355\206\330"
+	.ascii	"\275\2077\261\332\3768\027\305\240\037\036?\306\313]\020\201"
+	.ascii	"\001\366\330\205\221\027\022\374[\034V\335\005\246\311\3533~"
+	.ascii	"\302C\366\343b\026)\017\232w2H\230\261\353\006o\330\032\262Y"
+	.ascii	"\355>\2039\321\305\313\222tN\034\236\202\031\351\264lB\205\b"
+	.ascii	"\334\021\352;f\3342\343*$\r\224U\303\3529\252\272\362N3J\351"
+	.ascii	"ae\001\013\336\343'a\006\223\r\363G\374\272F\204m1.\260Z-\311"
+	.ascii	"]2\222\214\250\221;C\343\220E\027\273K}\253\277\376\2248."
+	.string	"\345w\023\021\211\236\326Um\203\333\035\002s\030\360h\203\245/\325\306Z+\272\221\222\007\230\223\032.8t\360%\235\2758\002yp\032\200J\231HZ\236\343\244\327\020\032\360\025\365\206\034C@\214\344Bk\017\312|\336N'\265\350\231\2245\373\322\246G\243\033\356\354:\t\272H\f\036e\034\220t\005\342\022j\214\365%\301T\277o\271\214\004\267\bO\263\351\013\373\202\"z\016\336\371\355\006EPi\370c\321\325]2\031\031\363CTR_\316\322$\026A``\335\n\247\016\244;\344\032}L/\247&\037\322\322'Z\2066\241<\245\235\261\326\241\022\204[\207\251g\263`\021\032\265\205\272\355#(\205\270\277\306\377@\256[I\220\2200\201&\321\361\325|}\220[\344\3703\270\244j\265\311\204\r\306\2613,\312\277\325\325"
+	.string	"TSg\201Z\2161\307"
+	.string	"\013\204T\347\027\262,8d\0230J\373Q\022G\212R~\024!\243/\336Or\336\247!dd\250ZX\034C\212\243\376\376\023\032\016\223\212\024\305\245\234\212t\034\021\212q\036\377Q\304\020\2704\022\n\240z\341\030\b\332\325;\272\372\361P`F\201ir\356\260BH&\340\003\320\\\200\200\246d\216\355\f\353C\250\236C\340\343\347y\247F\\s\310\344S\252"
+	.ascii	"k\031\321?fO\034\240\264{\207\2641\244\202\274\220\342\275Y\250"
+	.ascii	"p\013\263}g\353\367\242\004\266\\\005\310\237#\320\327\376U\022"
+	.ascii	"\225D\025J\334n\244\242\227[\237\235B\334\273*\310\007\345\004"
+	.ascii	"\346\207\214\365\225\016\316\212\b\bV\255\256\246\254\325\373"
+	.ascii	"5\232Wj\343G\210<V\200\251\306\023\241\230\020f\265\315\201\b"
+	.ascii	"\021\001\241\256\335Cf\354\357uJ0 \314\032\357\340U\270\240T"
+	.ascii	"\021;d\f,\227\346 \3241K]\201o\212BN\017>\347\256\266Da\222\r"
+	.ascii	"\353`\361\224\027\232\201\020\353W\3524\016\b\025"
+	.text
+	.section	.gnu.lto_disarm.part.0.294.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\337\003\275\032"
+	.string	"\266\260\250I\260\226Q:t"
+	.string	"5\260\347\234A\253\213q\216~8\036\255\017\222\214\363\246\241\306\310\021\361Q7\236\r?4\033\241\321\230\034\2714\360>\273\217\217\344\024n@*\361\274?\354\2161>\304\301\255B\027\003[\215\220M\310\226)\005\217"
+	.string	"\217"
+	.string	"\222"
+	.string	"M,\300\262\352r\336\265o\344L\344\233X\230U\353\221\224\222ZK\006\017\235`|\370\372\f}\b~"
+	.ascii	"}h_\311\266O\316\244\235\345\345\256^jJ\b\252\252\326\n{8u\234"
+	.ascii	"\374(\322\020\234\313\"}\247\263p\272\237\217\342\315\321P\321"
+	.ascii	"E\242SP\001\325\222/.\235\0208\003\343\007\256\305\206\213\323"
+	.ascii	"\3058\b\276\244\374\204\016\344\270a\325\322\335v\272tA\340\253"
+	.ascii	"\326\372\336\367\205\316\266+\340,\361\246\326\352\003\315\270"
+	.ascii	"\001\334\366\220\355\f\366\304\022:\364\341\347{\337\037IKFF"
+	.ascii	"\212\200\366j'\222'\353`\2359lq=\216k\221\256)]\207/\177P\\O"
+	.ascii	"\272^\272>\001\330\222\214Q\2550\256\302T\034!\023 \347}sR>F"
+	.ascii	"qcs\021\004&\311r+k\214\344IT\030E\201r7\004@F\221U\224\252Z"
+	.ascii	"K\330C\227\343\264\357\262\242\342Qn\021\361Z\376\221?\371=\267"
+	.ascii	"\316\203\352\361\353\006\325\363\272\225U\367\241\252\250\245"
+	.ascii	"\252Zs5\017]3:\255\357\344c\267Z\336}\351\363\224\316-\022\341"
+	.ascii	"U\250\320\351`\212\351[k\375\231\023\3116\016\rg\355\351\312"
+	.ascii	"m\301\330\236\360\037\316X\353\255\201\357\373\024\n~\217\207"
+	.ascii	"\256`\301\002}\030N\361\t\317\212\251\300>\352\275\013\227\332"
+	.ascii	"\341d\216\201\332\0326\354q\016\340#\372\005\315\037\203\323"
+	.ascii	"\346\360^\207\231]\255\265\201\203\235\221\215\032s\372O\016"
+	.ascii	"\305\303\207X\314\211k\355\231\210=nN\0034\264\374l\363\307;"
+	.ascii	"\233\034\267\345c\236C"
+	.string	"?w^\250\310\266W\366\225|I\216\337\303$t\366\270\207~\036a\263\202\006\202\204,V\002\304\201\030OL\002\317\316,\305\214\265C;\021\233\325\250e6\263\032M\006\223\205\200\355\344\304t`\262\332\t\230\315\214i&f5\030\017\215V\203\265\356\217>\253\037\320\264\215=`\255G\017\316\373\251\234\304\005\013\236\334Am\222\007\351\203\313\357\366\035\030*%\224\206\216\263\3664\365;\r\025\3478A14AH!{\2348e|Cf^J+*\237L\242\276\225O\221I$\021R\211T\242\017Y:\232Tu\t\021\254M6Ap\371l\314[L\356\252\n8\221\274\307\tR\250a<\303\f#\006\031\243\2214A\222\246\003`\002\021cW\036\020P\2526I:\224eRB\033@<W\022E5'\267\007\235\033Py\364!B_\346\030#\177Nq\342r\027\202\2419\300\364\335&\3675E\343\304='j"
+	.ascii	"\001J\301y\264\232\214F\021v\223M\340\303\203Nu\240&\211\310"
+	.ascii	"\375\344\233z0\"L\332\341\3623\315\321>w\255\357\254\353\324"
+	.ascii	"\\Rp\373%\3718EL\220\316{F\213\267\346\020\203\025\240\227\314"
+	.ascii	"\2414\317\001\346o+L\024\334\231\362\274>\372O\357\331\226\366"
+	.ascii	"~\203\241\314\031\276U^\225\231\257\355\317t)\316\347\231PS"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.296.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\375\006"
+	.string	"rL-3`M\222\016@c\017\212\002q\022\244\242\026\006Z\034\0374\250\214\356\217\0321\206\335\030\027\306\326K\327\355\n"
+	.string	"@PsT\310\201\306\367\006Y#B6\221)K\230\f5IORx\r\013\t\fO\242\036\036\206\340\311!C=\210i\242^\364\263\266\304\316\227\320\b\210\002+\020=\277cQ#"
+	.string	"^b\202\325\272)!\016\220\005n\030z\306\326\226\330yl\037\024\201\216L\214\026\226\364p'!\337K\363QTW\222_\223q\365*-\001\311\202\317ua\262\222\231\257\016?Z\025Y\253\256\305\331\024{\225Y\034\215\262\201\266"
+	.string	"\204\314\374\262\321]\377\203\337\340\027\t\020"
+	.ascii	"=\023\030\0278G\021\007\210\202a\256p\032&.\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k\317\005u\314v\236P\306"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.part.0.322.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\r\013"
+	.string	"\246\324JA \213*\035\247\002\226 "
+	.string	"\352T\204\243\3226\371\247\233@\326\205\224ZD"
+	.string	"\220\326\023\240\325\337b\f\003(U\b\3652\2227\200\027\200\200\256x\313\035&t<d\312\2660\356P\373\204\354-wJ\0016"
+	.string	"9"
+	.string	"8"
+	.string	"\224\3173\260\375\t`\320\306\360\020\265\023.\330\210\245aw\267OEp\360\032%\350\177\365\t\251\004\272:\224\004<F\\j\034\273k\311\200{\3366\206\355\013\373\033\001\273"
+	.string	"b\26050',\270\352\366\033|\374\225)\252\317CO\354\330\020\201\326nh\361\351\030\355;\370\003\360\241\307\223\335\003\022Z\273\241\345\323\025\222O\212W\262Oy\211\3543\032>\353\020D|\005\237\316x\323\367\262O\255\002)\3035\352G\033B1f-\332\233N<\351\252]HQx\211\024\024\365d\225\227\253&[FG\215~&-$\200(\020\233\217.\203\361\340h\272\357\353p\017\346.\335\347q\033\027\262i0 \231\215\3736\333\245bo\244\3736\216\347}\033\345r\325\344I\312\365\n\251H\365d;\252m\313#`2P\273\033\025"
+	.ascii	"Gc\034\255\300x\340\373\002\275\243\302\013\202\003D\3010W\270"
+	.ascii	"\275&\262\036\035\205`\313\363vQ\355t.h\323e\347\002\300\311"
+	.ascii	"\213y\247\245\351'\2241"
+	.text
+	.section	.gnu.lto_tryArm.part.0.328.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\006\b\365,"
+	.string	"\032L\310\020Fp\336M:\363\316\222*\017,'lU\265\334\227\236\366\033\340\331\270\177\212\303t#\2669\335\026b\327\376h2{\034\345\024\217\376\364"
+	.string	"\256X4\231\336l\326\346hC\365\231wP\031\037^\206,Q\267F\b\3312\311\364"
+	.string	"\350"
+	.string	"\372"
+	.ascii	"h\274\233b\026\307\354J\376Y\026\251cy\301E+\277\262\036\313"
+	.ascii	"\013\002C\262\213\325\202\217\0301\270{\311\030\374d\004\272"
+	.ascii	"\237\004n\204\3764O\204~\214\031\306\225\034@\271\305\247\362"
+	.ascii	"\262\030W\362\251\\\022\203/\345d3\256d;\205\326&)v\357\235\201"
+	.ascii	"\362\307\244\230U\365\347\2430\263T\221W\3469'\363\272\347\242"
+	.ascii	"\264\252\002w\357\365\375\264E\276>\b\250\367\303S\323\235.\207"
+	.ascii	"\236\246m\241\225?\365\240\261\027\3402z\035\250\367\223K\032"
+	.ascii	"\302D\016\035.#\220\363\300\212>Z\375\001V\324\352\024M1\331"
+	.ascii	"\243w\005\270\214\310\353\320\024\221?{\001\260\342\261sM\304"
+	.ascii	"\342q\324\252\252OsA\222LV\357\214\2208f\017kh\022\270\367\252"
+	.ascii	"XTm\315\005\313\264;*\226\225it\225\204\370\263w\016,a\367\320"
+	.ascii	"\205rI\367^~\360\353<t\346'`\346\037s\016\030\266\225E\315\034"
+	.ascii	"BD\237h\355\237l\335+\317\262\213\265]\314\354\002m\013,{3\354"
+	.ascii	"<\314\037s2.\370G\230D\211>\261\004\372\263\255M\253\262\225"
+	.ascii	"\034;\006;\216\201\232\371\307\324'\336\376\354\351\031=K\360"
+	.ascii	",\205v\252m\027[\241\233\327\016aN\233\215\322\346\242\264\231"
+	.ascii	"(\327<\304k\026R\233\203\324f \265\271\247k\376I\233yj\263\232"
+	.ascii	"6\247i\363.\327\254K\233si3\272k>u\315f\256\331\346\232\373Y"
+	.ascii	"\316G2\233\034\001J\336{\025\267\347n\235^\224<\313\357\345\r"
+	.ascii	"\200\314\313X\f#\305PIB\032T&\232\236\245\030\334\035\2221X;"
+	.ascii	"\030\030\feiP\005\203P\350:\253J\372~2\231\356D\314\347{\371"
+	.ascii	"\302j\232\324\323X\355\302k\277\306\373\032C\232\370X\336{\037"
+	.ascii	"\350\266\240\361\203#[\330\2757A\326\\\253J\n\323\376f\274\367"
+	.ascii	"2+\030\336\033<\320\263@\366U`?\266g\001"
+	.string	"\330\251Z\362\354\217\275U\237`\307)9\237\225\211\356\336a\004\276\236\357Y\233\360\217\374\344\325\311\372d}\202\376\344Y\b_J\253\332\2412\034f\252\226\301\216[\241\210\270\342\246\325&\264S\273\024\316\374\021\272\263\251\235\235\215:\252\301\323:\235\201\026\360u\fe^\245T\350\023u\366m\334v\264\r\355\024\017h\346\013\030\372D\376\331\177\303\214\307\222\301\227\337\362\004\3065aI\261\267\234\235sb\235\377\bEm\316\336*K\330q\314\177s8J\0314h@\177\242v\304\261\f\224\234\355\372\006\224\315\217\307\265\2607\tZ\356\026\364\033\320\323\236\313\355i6p\360\340\001\375y\332\037\217jx\350\364\230\372q\332\256\0067-\217H\231\233\266\237\3415\020\254\306j\366jn\354Ym,\314\313|\231\333\254\002\tj\305\0230\312\351\351W\342\007\024\340\364\004\265\304\324\341\004\323\n\023KPM\026R85\261"
+	.ascii	".\025A\201`b\321\364!\312\211\t\b|\361\373\341\037\022\023\360"
+	.ascii	"\351\347\373\241\36095-\261\360\375\200P>$#~j\301\004\364E=="
+	.ascii	"\001}*3\367\223\202V\030\364ChDZ\201k\344\265\250z \255\204\275"
+	.ascii	"\005\327/\364\270~Y\255H\220fpo\003j`X\243\003\350|\0337;m\303"
+	.ascii	"\036\200\037[\333\260m\034\333d\375Lh\364+\216\253\025\253"
+	.string	"\257\270\2159\213S\304\007\317v\261y%\324\310\366\23326^ut\016%\335\2757\002\367\215\306\261\356\340\261\"\221\350O#\013\301\215\03289t\250Gh\321\216\253\177\204\022\331\"\313mul\032JZDV\306\361\016\2240TWK\322!\007\375\373\025H\220UH\2378\024\246\013CZ[\013y\255H\326q\016\334\233\220\345\276=\265~\255FV$H\320 +d{\255\212\315\2526\200\266\250\201$%\225b\212fD$I\n\222\306\200\002\021\252\262n\021\260\261\204'\205\264\031\nW-#\245\274\207^\211\223\337\344\21550\304\320(\314,\205V\034\353\327\304\326\223W\244Zz\327\210\334\313)\252\212\200\"\357\211\226\374\351w\252\203\267\021Y\261,\025\271\355no#\\T\214BZA\306k\305\317k\261\270T|s]\007\273iJJ,G\214g\036zp\305&T\213u\306L\212m\235\r\036\004%"
+	.string	"\255\347\230\004\223\315<O`/\r\317\230\2714Y\212\351\366\200\232\352m:\213@\320\357\320\312\264\213\270A\305\"\242(_\344\24093^Z\032\2521\316uj]\203\021%]j\257a\373w\203\304\f?\372+LK\tD\301\b,\0170\205N1\364!\204\301}l\203-|\255\366\276\214MB\360(I\333\"\345j\n\020\223\362\0266\032\277\325V(\365\364W\005\f\331\240\004\245\243\326\024(\246\307\376#\234\224\337\367f\241\261\b)f\214U\035\233k4\3000\337r$"
+	.ascii	"\230\323\215\261E`\2011\351\247\246\304\247f\033da\036k\"|\237"
+	.ascii	"N\243\222F\215\330i\373\256\022\243R8\206s}\351\340 \362\247"
+	.ascii	"CAi\302D\006\220\336\205\303h{]f\263LB\224\2300\032\311I\343"
+	.ascii	"(\353f\233\377,\304T"
+	.text
+	.section	.gnu.lto_processRx.part.0.336.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\n;u\345"
+	.string	"zV=LI\020\020gm\215\001\253\201\022J\220O\366Z\311\311\217gS[V\236l\363\013\033\310\235\337W\032i\372\251Mk=\245\274\013\276\262`\304/\313\325\275\3473\307\334k\253\327gO\023\325\004#\240G\307\031c\277\233\337FRJ)\237\004I\004\343\004a\333BB\030\177lwj[9\275\307=\330uX)\030\2305Q\215S\333\243\243d\016\347\025Io\274\\[\324\366T\360!\303-\310\312@\316;\276qo\025\227\2141\266\024|"
+	.ascii	"\033\016\263\222\227\002\227\230\225m\332\r\367\037+\265Mxo"
+	.string	"\264V\265>n-+\233\332\217\351\370~\275\320;'\306\302\3045\n>M\314\312F\262\220\336c\f\3207\206N\275\307\357\006\347\215Um\204\336c%\324\316\242U-C ?\365\036\007]\307\220Y\3256p\223Q\302-\327e\332\256]\350\274N\323z\254\034\243\344M\t\2323Qg\242\372\355z\233\t!\232\026a\027\336]\221\273\"?\177r\331\256\25233ef\252\347O\356\016\212n\316\b\027I\347\214(\243~[\036\035\327pOn\270g\0214\373j%\307\266w\331\t\232\334o=\206\225-\0349\276q\r\200\351\333\362\276[6\304\034)\222f_\256\237\261\265\255\332\366}_\244F\362\013\037~\357\254\222nKr\314\276\\[\374\316\334k\315\326\354\266$\214\341}\257gw\357\233u\321HF\341\323\310\242\006\221l\344\261=$\033\311\334a\370E\f%[\357\233Ubf~\021\243\311\317\316\222i}"
+	.string	"cw5f\373\276Y\245F\276\n\375\354~\322^\335\325\\\275\325Z\355\244\263\272Ic5\265\231\364\222\276j\253\236\266\264\243]\325\320~\271\313\215\314\310\213\254\310\211\314\345-#\362!\347aC\306\303\205|\207\t\331\016\327\341A\246\303sX\016\013r \307a8\f\310o\370\217\335p\033\326\262\037\3671\033\346\3435\374\002\253\341=\326\3434\234\307h\370\f\273\300x|\307v\\\307f\270\f\323\361\034\313q\034\3031\031\036\303-\360\033\213a7\316\332H"
+	.string	"\201\032\007\030P"
+	.string	"\215\0312b\020"
+	.string	"\343\305"
+	.ascii	"\002(%\271h\201\304\"\200\025G*R\2408a\302\250\210\2109$TbIb"
+	.ascii	"\204\210\020 >x\350\300aC\020\220\206\f\312\037\f>=I\344\361"
+	.ascii	"\275\241<\271\241\335Oznph\201\267\b\227\245\333\013Kw\027\026"
+	.ascii	"\256++xo\221uk\221\211y;!\263zgU\273\233\204U\275\261\246aS*"
+	.ascii	"\336T&\310\"\2745\354\224\356%S\300\274\257\246S\246_\336VZS"
+	.ascii	"\255,o\351\264\311\324\211wt\332d\212\345]\345`\323)S\2527\024"
+	.ascii	"\313\244\373\2352\t\321=\302\230n\303\204\256\321\3561C\342\325"
+	.ascii	"\233\351\022\347F\306\306\346E\306EgE"
+	.string	"\305\346D\305Dg\256\"\327y\213\270m>\334\326q\316cg\320\331\020\017\235\346B:r\234\357\314\021t&T\264\343\027\350\\\247\257y\260\217\2153\235>>\3479r\3264\013\276\240\30690\316^3\234\275:g@;3\316o\354\3128\377\3215\2739A\327\334F\256Y+\027\347\354\327\346\3347\307f\215\315\231O\255yM\030\347\027\324\322\234\325\2405\357\241\2359\353\2315\2471\013\273F\2658\347\2419S\206\305\331\005\274\025\2568\337\331\225\2119\327\2319\266X\013\273\262{r\035+k.S\rs\246\253Rq\236\263Nq\226#\003s\216\373r\206\323r&\343\304yL\b\241k4\313\271\205\020\327h\023\347\267,\307(\327(\226\263\230\017n\234\rq\215R\205\256\321%n\243\353\t0it\004\216O\256c\324\256\261\350\007\b]\243TE7\2001\321\013\240\261\365\031vZ\206\035\275:\036\203"
+	.string	".\035\2071\247_\314\221\343\003p["
+	.string	"nb\240+\371u\222\233-\277.[}\356B\220\215\267\350\271\201\264\246Y\254\351\304\027<"
+	.ascii	"\276^\301\267\347Gv\255\302\256\316S\230i\024f\234\253\214\237"
+	.ascii	"\240k\023tsn$\347EqN\324\346L5Cl.\264\246\346%\334J\3152-\214"
+	.ascii	"\223\350\262\205\226\330Fn\266\302\370\2103\027a\346!\2648\210"
+	.ascii	"\3012\3770\230\305=\fb\361\016\0346\254\320Adb\016t,Z\243\275"
+	.ascii	"\"JA\214\333]\266\254\256\341J\3253\270\331\272\322zm\324e+\314"
+	.ascii	"\225=7~\214\256]T\032\003\225.[`\356s\004\321f\214\016\013+\337"
+	.ascii	"\223\356\262\365\345=J\256+O\272\331\232r,z\337\327\312\221N"
+	.ascii	"\345\202\322G%\020\227\324\377\310\202\020\357\020\210kz\004"
+	.ascii	"\241\245\205\332z\355X\\Q\367\016\335Pzn\274\357\313\033\260"
+	.ascii	"e\315\035\245\231\225c\230\333\312\234D%b:\371\337\210E\f\034"
+	.ascii	"\032\r\312w7or\354\224\357B\360\313\365\246ZW2D%\377G8\301\342"
+	.ascii	"\206\347OP\352\211\312\307\226\351q\003L\301\252f\370X\304\300"
+	.ascii	"\331\375<6\311\036\347r\317\350s:M6\262\267\302\354\316\fYX\371"
+	.ascii	"\2740<\226\177\036\371Ro~\314\317+'S\304\347}\2452\330[\3601"
+	.ascii	"O&\334Y\032\311O\254gVV\262\221?\337_\302\352\270lU\336E\263"
+	.ascii	"vf\305\347\261\375\204\222L\376\263}s\267\333e\354\031Jb\300"
+	.ascii	"P\330=\224\364y\f\317~\365\025\365.\263\263y\033\016\255'\027"
+	.ascii	"\327']\371\252\362n\267\333ML~\351\236\377\341\325\363\255\327"
+	.ascii	"\335\004\316+\313%d"
+	.string	"O\3630O(\334Y\370)\345\t\346M}\202%\033\231\374\206\323G\205p\b\255k_\307G>\023\320*\261\312\273\374\302\271\335<\253O1o\352\361\373\2579\230!\203\270\305%T\032{b\275\251\377\310\300B1m\364\241*<\313V\024R\321F\221HX\236eq\205R\2643\264v\272\034\237I\177\257\363&g\2053?\271<\275xS\375\273\255J\364\241\374\335d\211\204e\376\261\314\\\242d;I\262\377\241o\260\274\365I=\221Sx?\363\023\314\023\315\233\312\255\327?p\\/\227P\372P\177,\177C\351\357v\273y\370S`\316j\202Ee\262d\351\334WB\316m5\225F\331\271\253\330\271\241\354\334\357\322\371\271tv\262s\223\235OX:+ag\023\3309\t;#1r>b\344\\\002;\033!r\246\"r\2362r\2262r.\302\316$\260s\024;C-\235\237\226\316D\226\316#\2603"
+	.string	"\214\234\235\214\234\207\0309\0131r\016\322q\315M\354\f\304\310\231\311\310\371\007;/\261\263\b\354\354\303\204s\b\354\334\203\235y\2603\b\354\374\001\323\331\003v\356\200\2359`:o\300t\336\301\316:\214\234s\0309k\300\3168\3309\003v\306\200\235/X:[\260t\256\240\351\232)(r\236\240\310Y\002!\347\b\226\316\020\260\363\003Kg\007J87@\302\231\201\245\363\002%\234\025X:\337X:\333X:'@\344\214"
+	.string	"\323\271\006\323\371"
+	.string	"\246\263\001L\347\002\226\3164\210\234g0\235e0\235c,\235\t`:\303`:\277`:\017\300t\026\200\351\254\304tN\022rv!\344\334\002\211\351\314\202\351\034"
+	.ascii	"\323y\005\323\371H\205o5\247`:\243`:\237\030r61\344l4\344\\4"
+	.ascii	"\344L4\344\314\034r\036bg!\257j.!\344\274\024r&!\344<\302\247"
+	.ascii	"\315\"\3309\004;\203`\347\017\354\354\201\235;\2603\207\245\363"
+	.ascii	"\206\245s\320\322\031h"
+	.string	"\351\254\241\204s\006vV.\235\177\226\316\030\226\316>\354\334C\30299\302\371\330h\232\237\235\275\263\335\355(\034\361\030\203\254\357\253\325]|\253 ]0\3534\335y\335h\272\361\272\353\272\351\272\343\272\007\273\351t\343\351.\354\346\266O\333\253\332\267\332\277z\313\363\370~M\377Om\253v\266\304\317\021\323\0074\023\247v\246\205q\024A\263dZ\214#9\226\266Uk7\235%\207\020\316\001c\flJ"
+	.ascii	"\256p^\017\346\274\037@6)wVvX\331\341\304;d\300\231E\351\343"
+	.ascii	"\255W\372^\231\214\353E\362\301G\216Y2\256\022\372\274\022\225"
+	.ascii	"\032Y\205\203\021\230\203\004\260t^[>\"K\326\265UU\302\036\034"
+	.ascii	"\337\257,YW\217\251I\263HL\305\303\236\330\203_2\255B\341\200"
+	.ascii	"\250Y\327\024\316\3720\231\233=J\357\261\203\261\362\313\245"
+	.ascii	"\270\024,VvN\027\367\226j\231m\037\272\227w\261\216\252\2357"
+	.ascii	"\341\332R\342Z p\226;i\272\026\bEU\331wK\371\246&Nm\273\306\247"
+	.ascii	"\221\033\274=$\235\211S{\370\025\013!\356\365`v\362+V\"\363\267"
+	.ascii	"\025\331\243n\305\312\251TZ\344\370~\325@\253\263e\316\307\253"
+	.ascii	"\034Z\304\241E\200\376\352\266h\210\314\215w\3254g\207\275\350"
+	.ascii	"\243\025\271=@\007\r\021\023Y\311\335>\267\317\261:\355\n\254"
+	.ascii	"\364\301\254\274\203\247\r\t\003\\4\375B\243\316i\b\2703\204"
+	.ascii	"#\026W\260\340K\236\253(\326\2723C%\356\355\304\312rjy`\"\030"
+	.ascii	"\255\264\007\213\254\202\307\362\216\357\367\303\267\276;I\234"
+	.ascii	"\\N\267\035o\003\304\332\031\005F\222\024<\322\3150N\321\225"
+	.ascii	"\013\023 \241\206\177Y-\254\004:^\312K\307k\225\213\340\261\334"
+	.ascii	"G\311\034p\336\0047\274}\224\324\340s\274\234\237\003\002\024"
+	.ascii	"\247\024)\311Fj\360'X\311\274\324\f\027\0048>\b\016\260$\223"
+	.ascii	")(<\220A\321\233\201\024m\007/P\2748"
+	.string	"\200\001\006\337\201\211P\032\270\340\203\370`_\360\255M\364b\300\202\n\336\202\277\n\236\207\265\005\264\257\t\236\202w@\253>\2746\354Z!\301O\020\301K\360$\362\254\b!\370\b\276\301^\373}\357\347\244Ru\212\211%\033\t\3017_\265\313e[\340\205\346C\334\232Q@\315W\365\020HK\ni7\036\370\fZ\242\374\250\235cX\247\n\336\324\007>)VE\372P\033\256\327\016\\\371\274C\007\3164\360\375\244\232\207\233@]3\200\307\300\367V\325\016\332\027\002N,\3172D0\316\236\366f\252\203g\206B|q\2065\036\273\300#\337\255\274\365\225=\235s\321\211\270\300\313)\360]\346\212\336TK\313\001nu\332\f\270a\343o<\234\215\347Q\215\203V\300\230\026h<^\035\025f<6K\213q\232!\340\326Bg)\234;\223\221\300\227\320\226\300\221\260\372\006m\321m\273\030\003\2015\265\032\217\300\217"
+	.string	"\274j4\353\003\276\306#\001Z\245\031\360\005\374\001ih\006\034\333\360\006\ra|\177\001\337\213\004\320@\204\321`\002\360\202\306\027\032\217\244\332\2076\300\214\357\302E\306\317\370\021\200I\2221^\306\267U\232\226\030\337\200\202_\002<\226_\205&\340\221\\\203s\224\036\3534Kbq\232\331\340\277\362+8\271xq\262\340d\201\f\231a\225w\351\344t%=\226\211\032G\222\200o+o\005\007\230'\027\001\217\244\312\307\375\252\362\213\262\271\200\361Ro\202)\300\370!>\260\026\217\275\266m\251\352\235\031\"\275\250\202F-\034\340\005\370\027V\264\001\360\006\267(}\277"
+	.string	"\337\215v\323),\224\276\257aJHn\203Y\254T\026\002\230\373)\235V\265\333\032V\255x,\243\200\363R\247B\305\213\270\362bM\221\342\221\036+\351\352\342\223\276{\002[\274\013\244o\361Dc\256\032\003\370\025\317\342\333\312\032\365\256\024\264"
+	.string	"\216\\\356\3209\372\376\025\357^}d\001\360\216\230\036\231-P\216^G\325\356\350\261\235\342U|\20715q\254\032\243*\346\272H\222\216\2350\337\345\\\213\361\\)\236G\265\f\227-\205\326Y\025\016\305c\237I\243\370\276f\241x\347j\344Y\025\016\355\304c\031\253\357\302\272\334\260\240\3061\023\235$y\342\273\313\233\340_\375\222$mN7\267d#O\274\006h\234\255um\221\214\221\t\2437\361R\266s\341x>\372UF\2146\270YEED_\324e;\027\201-\274\221\221\350;"
+	.ascii	"a\214hl\205`D\217e\273\216c \351\373V\235`~[y\343\033z\346\373"
+	.ascii	"\240\325\366\315\023\331.\211\214\331\205s\235cR\320@\364\255"
+	.ascii	"\023N\316IG\227l\344\320\367Y\330\342\233.\314\307r\211G\276"
+	.ascii	"\006+o~\336e\2536$\364\017\307\003\017j\316\263s\342yS\205\276"
+	.ascii	"\271U\244e\356\310\204\036\313\"\036\371"
+	.string	"Hh\234\2777\277\345\227x\213\003GG\342\227\357\324>\246e\301[\273\"c\350\315y\311\021O\342\333\252\213\210\037\361\"\336\352\272W\215U\336=\343w\212\324\b$\024\361n\325\307\3030D4\260*w%\314\364\177\0068re\322,C\374k\361\n\361\315\306\013\f\013\t\020;|C;\365\3248\327xSA|'vk]U\357\330\254\024G|\370 N6\037\276\003\361\204\321F\177\340\364\246\"<\310\361\363\3604\302\352\240\021u\273\335\020\035\002\333t\340\332\350v\273 8|\0208O\347\337s\312\341i\204\r\2425~\350\"\311\r\037\344M\216\023\320\377\332\270\033g\034\247\240s\316\234d#7|\bat\270l\212\036\036\353n\035\344\343\306\263\r\364A~@\217l\003Gk]C\354\340j\272G\212vK\250\200#)fyR\367\204\003K\035n\220\300\273\235v\222\314\316;N<\201\205x\264\322"
+	.string	"\362\354\335\tj\034I\r/\365&\307\231\307\323\340\360y\337W\006{^\020'\"w\026\t\222\215\324\360\030\330\252\\\3603\0228\271NE\247b\262\221\031\276\247\r\240\326\272\246\200\267hfg\367\t\365\323J\037zf\016\0277@\001<$\t\211\224\222\020\022<\f\241Zz\342!I@\234H\030\301C\222\232\236\234\250\224\240\242\236\236\242\230H\360\220\244)&\037LRJLB<$I\252\t\211\323\223\3222\211\024U\323S\023\221&\035TRQ\031"
+	.string	"i\222Z\032\222\003\252\211D\222%\252\245\245& AG\242\210l\240rzr\252@\007\020\247\247\rTC\2048\021y\240\211\310\217%\252\034PN@?|\370\222\017G\342\303\247\214P-Q\345"
+	.ascii	"\242\202jb\222j\312\240\211\b\025U\224\324\020\252\240\246\022"
+	.ascii	"\234\250\230\024 \022%E\005\025\305\300\020&(#KD<L\355H\262D"
+	.ascii	"\244\251\201'\251\245)\247\006\242\250\214,qh\002\022e\001T\224"
+	.ascii	"\tNRQ\0214M\355\200Zb\3420\265\243I\210\002?S;\226\250\21045"
+	.ascii	"\320\364\264$\025$\303\324\216\246''\035TPMRRF\23040SR\223T\024"
+	.ascii	"\223\022S\020%(\247\245'%&\251)\245$\020\034EB\223\224\022UT"
+	.ascii	"\224\224\222\362S`:\355\225\365XY\3177\252>\312G\216\357{\265"
+	.ascii	"\321i\272\t\305x\367IW\213\016\222\323\\H\335M\036\213\233\240"
+	.ascii	"\340\245\246\273\260\376\023\033\213\213\352\323f,\217vK\204"
+	.ascii	"\334\030\033\255\324Kk1y\2672\366\364\342\177\024\034[\243\215"
+	.ascii	":y,{7Aj\033\324\252\265\261Zt[=V/\351\253"
+	.ascii	"\357%\310h_=\017\262Cn[a\237Pe\025\351\361\315\332\353&\323\377"
+	.ascii	"\304\236\3365\226\364?1\205\324J\255nq\t\273M\375\302\b\250\302"
+	.ascii	"X\327\025\260\227\231x\310\326L\270[\310\372\266\206W\236e\207"
+	.ascii	"M,\3172\2409)U\270\204Q\300m\236^\022}\006\362D_Y8fk]c\023X'"
+	.ascii	"N_U\275\263\341i\226U}\177!\343\343vA\003\333\n\372!\3404\364"
+	.ascii	"\225hU\250U^z\332\357\007\245\rv\277\337\223\247\na\031!\264"
+	.ascii	"\245\317,9\316\177\332q~\017\206u\264\371AiAM\263\346;Xw\331"
+	.ascii	"\234\224\227Kh\327U'\370\274'|_\373\032\252\247W\250\006gL\277"
+	.ascii	"@\317\366_fnl\236>]$\251\344\177p9\3029\2769\0026\275\260\320"
+	.ascii	"\004\003&"
+	.string	"\331H%\317\203,\017\315\331\346\312\326|\345\256a\264'\230\360?\220&|\313]\321\224\374\3645,\360\f\031\023\222|_\233hI\336\345\256T\264\321$H0 \371\276~!\321\023\274B9\302\331n\tG8\333G\311\022\376\b\232\022\272hF\214\034\215\3743\221\212L7\0177\362=\t3E\365|\254;\3329\315\3024\327\326\222?M\"9\365T\377f\254\322\242\315\266#\235\323\254\351v\234k\276\251\bl$\037\343\216r\3151M\270\246\234\\\262\221S\337gb\210\334c\227\215V\312h\360d\363HIa\270\276\t\036%\213\274\324[\221\357(b\207\\\207\216\315y+B\302K=\t\337\201]5\332F\022\242\276}\242\276\271\252H\033\243\240\376\307\261\332P\337q\335<F\250\247Wk\305\306\221\034\341\237^\371\306\210x\365\025\355>\021\371a;\366Pr\204'r<\033\341g\b\022y,\003@\b"
+	.string	"\337w\3350#p\335\326\221K?\277"
+	.ascii	"`\212\007\335%\273i\306\256\211\327\025\323N\031\235\234\216"
+	.ascii	"\222C\336I\313\220W\242\320\270\305\272\366\2458\004K\243\237"
+	.ascii	"\023\300F?!\256&E\331\013o\020!\336G\311 /\204,\310;\305\362"
+	.ascii	"\032\317\334\231\002\245\322\364X\306@+N\033<\177Y\200<\226\201"
+	.ascii	"\264Q\257\354~\370\\7\2356'WvK\376\245\233\036\013\210\003y'"
+	.ascii	"\233\226\313t\2746s\363LsM#\232\266\255\333U\374\261\004\305"
+	.ascii	"\273\233zj\232k:\260Q\013\265*\302c\177\260\231|\n\337\004\217"
+	.ascii	"\222?\236\351(\366\343{\356,j\273\255\333e\364\261\364\177\310"
+	.ascii	"\345\336M\277$s\263M\363\317\233\272\364I\257\020DxOk\002\212"
+	.ascii	"\360\355\245\207\217\377\321>^\303\325\235,\227\220G\023\017"
+	.ascii	"\341\231\233\202\3159E\322c\224\243\224g\230\301\246\035oj\323"
+	.ascii	"N\262\221!\374\013k\227\013B\217\357\025\216M\272\307\367\250"
+	.ascii	"\"\375\200\207W\363\016\217\177.\304\255u\255\211Gq\r\242\007"
+	.ascii	"y\236ey\035\200\360?\216 \274\022\0278x\254\224\333TT\\\323F"
+	.ascii	"7\370\340\177\020}\360}\247\350e\207\007G\252{\360\375\304\032"
+	.ascii	"\247\261\333\246L\307\227%\200q\212^@Q\360rt\360\3156\355\340"
+	.ascii	"{\240\207UX$\336\321\340\030uZ\375\266\217\330\036\227\310\370"
+	.ascii	"\344\013\216\025Zf(\340\371\313\340\370\362\2355\031\237e~sS"
+	.ascii	"0\340\340\273\013#\007\377\201U\017\355k\203W\374<j!\005\337"
+	.ascii	"\277\301\367\027k\232h\0342\027\314\005\205\013\250S\222d\361"
+	.ascii	"|\244\346 BC\"\"\222$I:\243\025@@`P.\237\315r\315\007\023\200"
+	.ascii	"M\tcA=\226Z\347\214\220H\222\244PcZ\003\230\0218\233I\335CU1"
+	.ascii	"0Z&A\231\002\225Q\375Kh\003\243GD\020=F\253\034T\021?\356\372"
+	.ascii	"\211\2133\311\013\207\3067\216\2673\331\375\367\311\3270\300"
+	.ascii	" \f\256d-g<,\n9\022\024\333\302\177\250`\373\211L\367\236\267"
+	.ascii	"z\3675T[>Za\005\353\320\363U\\2\220\321\"d\250l\257\204\213\301"
+	.ascii	"\265\333\265\342\270?I\t\264\203!\2425\220"
+	.string	")\321\355\037xdv\252\365z\375\370\362k\242\253[C\372\023\020\373\363\351bk,k&\225x\242\237\201\201\003\274\030\205J\342\245A\264\026\240\323Xz\204\237\032\030=\212\252j\275\253t\336\203J\240\350\223\265<\026o\376\366\347\202\243\022\016\030\374W\204\365\202\263\262\323\246\t\rp\200\370\354\023\002E\3529\016\207\b\345\300\355\352\r\205\270s\245\207+\210m\301K,T\230\037\266BG\372\245d\376\367B~\355X\355\002Qt\261\036M\305m#\031\311\232t\351<Zi\300(\250\327\243\376W\214\001\274\2649f\037\244(\371D\263\201\355m\017\0164\310\244U\330\244]\006q\204\022\210g>\203\230\343\316\212B\020\027\314\242\2507\002\332\2577\302\274\224\f8\364-\214F\242\232\222\346\334\250\267_\322\336\017\272\322{g\177\312\262\226\264\331(\251\336\365u\305|\335\270\236\276Q\237a\200Wb\356\004\006J\207"
+	.string	"H\217#\215\032\201+\005\270\265WU\003\330X\003\304\253S\234\035\305\350\242\030Y\340\b\350\320e\fqN\346\254\276\211C"
+	.string	"\267\210\213C\230\035\001\353N5\320\273\202\017\347\243\004\020\314\270\226\315%H\231\240,8\326\237\313\242\003\273\247\204\006\376\2520\322P\203\301Q\276l^\305\330\330PF\335\207G\274B\316\333\313 1>\2316\031]\204\311\352w\367\256\341\321S\212\344\340\224\244\307\\$\237K\331\327>\351\220\215\300U\353B\265\376\022\3743(\245\260d{\264 \001\0333\256\n\3272"
+	.string	"\206\312-\265Y8\223\220BI\203\364\325Z\370\212\036:\372\0222H\213W&<R\215 \2374-\026K\fh\311;\n\374\271\216,\352\021\353\023Z\223A2\0160\022\273\225\213}\016\327\247f)\026/,\365\235\013-\023\257\230xfB\023\\\331/\017s\262\363\035hC!\364=zvd\330\352\317\237\"\206\203p7\375@j\005\207\226\034\372\246\376\333\205A Gi\331z\376\217\352/\r\371\301/\223\371\251\327~\246\336\001`\271\314\352\322(\275\373'B\377\343p\347\272\205F\232\254>\226\003\242\303\307\032\274\033\026{\337\217\276\351\037RF\360\275\rC+h\314hM\0364\370\366^\352e\031\214\270)b\023SX\300WX\031\fu\0354C\304\2208;\246\271\224\372C\360\342\315q7\355\013C\273\007\345\026\262\fU\227\247\025\225l\005\314"
+	.ascii	"\3259\037\240/\316\301\360\220U\353\363J\226\200\317%\331\"x"
+	.ascii	"\354\2015\005L\003\212\020DjS1\342VCb(\233\314\252\312\352r:"
+	.ascii	".X\203\355\360\016\300\311\355\f\267\276\030\214\261s$\272\005"
+	.ascii	"\276_QG;H\2523\231\361A\255\024\207\212\353\223\302\034#\325"
+	.ascii	"\354\256\376\006\245gt\256\006\240\304R\357d\344\322\354in\265"
+	.ascii	"\230[\247\361\377?\202\276C\377\203\205\003H\216\333\034:\222"
+	.ascii	"\bm&q\247\230\253;\235g\300\235\316\2245lO\234\023a\235\316q"
+	.ascii	"c57\013\235\212\002\006\273\001\f\002\220\r\230\254\200\212\346"
+	.ascii	"\256\032\210\217xL\263\246R\231\203.p\335\177\331\tT\315\264"
+	.ascii	"3\367\210\332Lc*\224J\205\342\325D#\030\270\363\310\375\372\251"
+	.ascii	"(\034\251\355\030\036\207\222\322R\324\260n$G\365*\241\232y\001"
+	.ascii	"\264\227\377qu\221\366\367o\2528\216\2406rNQ\263c\324\243N\023"
+	.ascii	"\001r\206\346\304\303\263#\243\276\243\340^*\024l\230=$u\215"
+	.ascii	"5.6v]\f\370N3\361\002\234\257\030\230\0056\006 \266"
+	.string	"\023\217\234\350%c\314"
+	.string	"\353\320\230Cs\262O\370\315Um\257!\354MW\272f5\302\030IA\224d+\026\236\027\226\320f,\244\356\260Eu\307{\013\363em\360\221r\n\030]\313\022\274e\177\246\"dO\262\352c\270\317:\204\036\346V\344-\327\245{\001\316\251*\025\264~\337\310\301\022\316I\363T9\034\034\236\213\212\326\340uQ\254\201\200\036\265\256Z\325\b`\001\234\f"
+	.ascii	"C\213\274\274\222\240z\306=\030\324f\314\223\363\373\320\242"
+	.ascii	"-q\251M!OV1\262\035\200\203\273\340\302@\017\301\340\265\301"
+	.ascii	"t\2700\320\345\340\327\235\370\026\005\215\342\216\274\246~\212"
+	.ascii	"\2040\334\366C\021:;\023R\211\222d\2636\037\265T\320\355\252"
+	.ascii	"t\307\"\027\376\2068\005\350\356N|G(M#\001%\305*\305\233X\312"
+	.ascii	"e\r\365\270\304\347G\236\237L\330t\270\001{\314g+\355\231q\315"
+	.ascii	"jk/\243\314\334\304\212\3708\253i\363Q\023\b\374\370\215\245"
+	.ascii	"\374\2375\255X\242\f\034\260t\260\225~}\350Pm\255/`\240\240r"
+	.ascii	"[54c\n\334y\315\373\335On\364-\265\220i\225H\206\0250\306\314"
+	.ascii	";\241\377\341\341\336\177\025\f\223\262[?M\325\275{\312\035\337"
+	.ascii	"\004\003!Z\005z\036\370\243\222\252@\016\364R<\326=\322\025X"
+	.ascii	"\212w\331#\223\001\302\376X\362w\275}\002BVI\007y\262\006\267"
+	.ascii	"BDz\370S\317\221\354\262[k\342^j\205\2126iY\355\347\251\032|"
+	.ascii	"\001\2170\227\033ok1\013\023\350nw\271:\023 \324d\003<;:\260"
+	.ascii	"\372\n\211\255\300?)J+\347\3658\020f\027\352nBB\231\021\317\217"
+	.ascii	"/\262\357\307\267\006\377\303\220\350q(W\033[\354\311h\222\364"
+	.ascii	"\031\246,\275\377\003\341\274\243\377}p\247\300\250PdE\026\357"
+	.ascii	"\235\007\036\025\317c \240Rb\272?s\222\325\353\340;c\212\361"
+	.ascii	"\bx\3449\273\025\261\264\377E\035\344\342C\320\201\f\221\260"
+	.ascii	"h\204\224x\023\002\250O\266Q\223p\352\350\013\274C\310\235\013"
+	.ascii	"+\235aJ\371\216\316\216q\002R\301\301\205\030\340J\220\027k\244"
+	.ascii	"+\232p\035\020\325\205t\257vO\2343\025\267 .s$y9\247#\223\022"
+	.ascii	"\002o\3706\355\"\311D#\211\230\246\302\346y\313\311\216\227n"
+	.ascii	"|\016\340L\226\317\353]\337\353\206\310\001\331\256\327p\302"
+	.ascii	"\364r\343\r\312Aa(0\327\3343\373i\311Dg\002@(\002\340\r?\236"
+	.ascii	"'\242K\343\224\243\370Ja\214\355\241\206\227\017\373Q\017y\367"
+	.ascii	"|\300\b\214\311\346\310\034Q\217-=\306\353K\020\004\266\231\346"
+	.ascii	"\203o&\277@\305o\370%\250\3305\031\302\233\301\314\374\362Z\232"
+	.ascii	"\331\302\331\252\321\265\206\225W\\$Qy\013\251\340\177\236=\332"
+	.ascii	"\2736f\276\225\335*\237\363}\016\274\020\023\343\213\312\f8\300"
+	.ascii	"\007\226\3148bmO\201\217\250\363\355\252\255\20062\037\016\334"
+	.ascii	"\270\0172\271\322>\275%\270}\253\300\320O\nM\007[\266\326\007"
+	.ascii	"\0134\"f\337\bP\222m\245'{\341\rQ4\346\3037\202#^\355\233\003"
+	.ascii	"*\031\344\313\thk\026\272\035\200\350\317u\226\316%\251\232#"
+	.ascii	"\255\262\034\311;\331\376\321m\311\307\207\207\300H\301\306_"
+	.ascii	"\305\227LdC;\342$}\304"
+	.string	"@\tK\222$_\020x\316B\322\216\245\201\342;wR\320\313\342\366\216!Cf\255\221L\t\261\344\033X\257\237\352x\n\362\306\235\035F\007Q\357\335\250\244\246\030;\325\275\266\311\033q\367D\366\331M\235f\355\nj\255\327\027)\243k\2544\362\004\322q\224^@8l#\013d\210\276Z\313(\304\246\265\214\220\305\036\005\242j\300\021\251\375\202\344:\272\334\365]\377\344\246\273H'.\0346_R6\320\217\362\201\221\202P\344\263;\023th\243\365\247\250[\"\332\245\\:I\033\004\356W&\204O\035oj~\333\244\305\207\277\200C\313\312\240\377)\222\002tk\367\314Ca\227\342\205\313\276O\364\002\223\253\251R\357p\020:>\211\035\307\025\374\265\r^p\342HN\022b\352S\177&\023\237\334\356|\001\37024D\006\323\200\361\234\t\336^\004\244\200\257$\220\247\211\352}\243k\264\324\224\277p \202\346\212"
+	.string	"*\212i\312\257x\036\026\251\234\212\026[\333\206\256\036\005\n\270+\022\366\267\bW\364q1\377'\025$0S\253=LC\303\253"
+	.string	"a:\302W\330\2518+$\234\363\255*k{\311r\230\n\275\273\225\273\367\222\207kgz\310\201\215&\304\367\316+\231\265\240\226>@b\235\027\350`q\236\232\306\254"
+	.ascii	"w)|X\226\261n\001\020\325\016FyLu\007'T\3325\353hV\2311E\fc\035"
+	.ascii	"8\026h\335\254Ef\316\360/\035\027\210\323\2476\224i_hN\364\323"
+	.ascii	"&\264\f\370\\Wr0\321\366\367\017xs&@\351\266\204\r\231\376\235"
+	.ascii	"\013\341\024\253\0258C&?\244\242\f\027\237\347BvN\343\336R\352"
+	.ascii	"\032\203\244>\365\320\013\365yy\256\334\220\372c-\361K2.\002"
+	.ascii	"\001\330\320\216+!\272D\245\\\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`u\030\265M"
+	.string	"*z0\0329 \246J:?"
+	.string	"\302\254\243\311p\272\271\304\2201\303\377Y\211p\310\003\272\311\211\311m\334\342\264\330\235u\326\0213\0240?"
+	.ascii	"@\006\371+.w-Y\224\006A\333\216\334i\007\221\001\222\001\234"
+	.ascii	"\001kq\031\263\235\3118\f\\~!3\371we2\366B&\343/o\371\203\306"
+	.ascii	"\344\363q\313\367k\313\007$&?P\230\374?l\371\202\326\362\365"
+	.ascii	"\356t:\357mp\265|\274\247}\f\355Z\016\346Y\220\367N\371r\002"
+	.ascii	"Vd\310\331\271 \357\365\341\304\207\227\223 `A\276x\faR\341^"
+	.ascii	"\035\273\331\313\220_\362\337x\311\267\353\222_W\226\357\206"
+	.ascii	",\277\r\227|\272-\371l\264\344\257\301Y\362\347\360\3070\031"
+	.ascii	"R\275"
+	.string	"\241\304\362\325\374\211\263 \037\226\277\336\231\177&\347\303a\311/s\345\216H+\367T\345\233\250\334\214\342\224\214\001\245\344\223\211\222\377\3665\263:2(\371c\236\344\213q\222\217\206\301\256\351\353bM\036\306\004\253K\362\343\224\344\203I\222\177\206$\377\013>\362\247\221;\213\334(\221\013\"\207\274\221\220\333\030\3442\"\275\256\"\201\334\307\037\031\377\301O\347\035\037\371^zd\274\207yd<\207w\\G\035\031\247\3019\016\210\343\1777\236\307\306]\254\361>\244\363\371T\035id\274\342\031O$\343\2121\362\345`\340\264\027\227\204l\247\013\214\326\342\206,\362\321\254\300f*\360\0302E~\032\214\"\337\fw4\032\215\236\310\357\202M\234P\211\027\222\270\240F\274Q\304\347\204\300m \362\335\360\207\257y\270Z\207\263\245\017\323\365H\034N\350`\303\351\\\r\323\3604\344\2757\351|>\235v\356\315\367\022:;"
+	.string	"\247\323\351\344\312o\303\367^\005M\002Pf\177\261\267\260\b\r\315\315\304\354/Ef\203\255\236\230\r\306~b6\030(f/W%\373{HO\235\271{x\325\311\270w\200\253\260\257W\355u\325\004\326\250IV\035\265R\262\352e[\311\252\227\254\245\033h\bR\237\327\357$\300<\270+\311\252\227j\244*f`\030\335m\253\f\253z\271\376ga\332\\B\234\246\261\316%\244\002\320\b\217\331%\244\n\020\bH\354\022R\025\030\034<\274\204TM\2731^.!\325\r\f\364\026v\t\251\346\026\021\001o!Uk\035\300 \325\355\223;\334\273\202S\255\\\177E?s4\325\311\365\030\316\351t\276\375\367<\232\352\257o\257\037\322Tk\275\357\340TK\261\177\243"
+	.ascii	"\255l\223\355)\224\021T\273\320\333\2172\356\342(\343\262\301"
+	.ascii	"\214\267\bf\314\245Q\306Z\240\371-\243\374I\213\362))"
+	.string	"\312X,Q\306OD\031\207\035\312\330i(?\032\230\377X(\237\0210\177\361/?\024\241|P\203\362?\t\312O\f\224\337\tP>'\277|\304?\371\231\372\3621\361\345_\362\223\177\310\346[\352\223_i/_\021\237|G{\362\037\351\345C\312\313\370LO\306`\362\344\017\342\311\207\336\311gd'\177Q\235|8t\362\345\314\311G$'\377P\234|Cx\371\201w\371|p\362\375\274\311g\355\362\373\324\345\307q\223\277\327&\177\017]~\036\233|=k\362\361\314\345\337Q\223o'M~\0354\031\213Y3V\223\3138\355\333n0m|7F}c\033\323\306xi\3439k\332\230\216J&}\332\341\036\337\205v\265\336\333\256\376\232\330\325\311F\r\207\240a\001\334\236\365c\\\275l\237\205\253\227\353%\256V\266Z\270Z\031\367\253I\024\251\257\311\325IE\256~!\327\267p5\326\336\205\255\306Z\277"
+	.ascii	"N\250\213\270U\300\214\355b[\031>%B\300\376v}\216.\266\325U\355"
+	.ascii	"\023\254\225\356\246\255\353'(\321u\334\372#\261\274\233\270"
+	.ascii	"\365\270\325\311\365\354[\335j\257\255N>\217\263.0-\264V"
+	.string	"\263\377\224\320l\345\2156{I\330\354\250\325\331l\251\266\331Ujb\363\006\272\244\346\35566q\231\030Jjk\263\017\260\1776\007Hz\243%\271:J\250\302[\303\273\211\022\372\022\f\037%p\212\320\b\241\257J\312\352\207\312j\245\372\353x\026m\357bV+\031\263Zy)\253\227lcVk]\305\304\354$\253t\274\206\314Vjb\366\222\375\002D:\320(5\212\375\005\301\2708\002\352\251\356<Y\"\300\276\245\244\24461\273J\255Z\377*\266\021\263\013\250\177\201\002\355\233n\257o\321\001\225\023\263\017\034@0\305l\004\b\256TBf_\261\013Z,\365\027\033\304\006\210\265b\265\r\236o*f7`\033\264\377\017\265\023\263\177\260?\332w\324\220\331@\326? \255*\244\035\322&2\333\310z\f\2204\341\035Y\037\240\r\020\364^b\266\222%\353!\270\201:\227\264\027\260\206\021\355\"2\373K\375\337"
+	.ascii	"\025\365n7\352y\003\215\203\214\"\264Gs\377Z\371\274*\264\332"
+	.ascii	"\333\272\177\235\214\253\272\177\355u\377\326K\250C\304]\277"
+	.ascii	"\326\222\273~\375\365\314\355\353\250\275\364\362uT\334\205\326"
+	.ascii	"y\241\353M\274|_<\023\345{\231\313\327J\326\314\345;\334\345"
+	.ascii	"\353\007]\227m-.i{\t:Y\332_\313R\305wI\373\233\322N>\273\322"
+	.ascii	"N\266\32715t\b\247Pj\235\240\270h\223T\353%\355*\365\335F\215"
+	.ascii	"\220\332\277\244\215@\375\262O\321\330}L;/\013\343ML\237\326"
+	.ascii	"F\207\025\367\013\002\234\333\220\366\343\324\233\245}9\366\f"
+	.ascii	"\004\377$\262a\023\325\373\230\366\351\330:\365I.ng"
+	.string	"\256c\332\267[\177g\031\277k\230\366\357\n\257,\233\273\220\366\361\326'hd3\247\375\022\220\033\035\366Vjq\356\260'\300V\350gi\037\017\233\247\036\314\372\274B\365hi_\257\035t\241wOK\373\205\237.T-\355Gj\027\357\240\372\264\216\214\314\244\365X/\032e\234\324\206\262\304\376nr\013\033s6\366\260}\1771||\224\251U\3770i_\323\312x\241j'\366\277'\365\323\272\270.\262\214\355\357\241N{\024\277\246\262\255\307\177l\177\037\005\325\360\334\271~\002%C|\217B\325\265\264q\334\343\372s\312#\311\317\331\322\306r\254c\032u\375Et\203\030v\t\323\306j\332C {\342]\350*&mL\307>\201!(E\265m=\326\242\247\274\273\245\215\353\002\201\302\250q\034\0075D$\"\222$\005\205t\201\005\2049\347\034u\016\021\320\244\223\214\314\210H$\221\310\210\036 \310\227u*"
+	.string	"~]p\312\300\030\3263\335\255\375\227p\275\374\0249\254\377\202\246\353\3729^\226\341\303\323\211ZO\3003R(j|\205\tGS\354I~\254\220\327:\331\0032RU\373\240\276\260\301t\352\214\342\225\341NS}g\340\275\214\365\364\247\024\207\370\235M7\320\306\265\253\274\002\340U,\235\252\347\361tsv\255$\340\316\303\t\376\254\r\200\226x\0200\340QL\300\210!!,\363E\f\322\231\3530\336\237\331,\222\353\020\363,|\377\225\305\326\323V\023\004\220'$\3077@\275\242]\020\344\221\203\202\335,\031\222\013E\370[?\200\321\341e\201\326y\274\326xW|!\320X\374\232A\035.\t\232m\020-\0176,q\301/\005\303n\027\300\313\002\363p\005"
+	.string	"\256\202t"
+	.ascii	"\0223\337\235\277\265\342_\352\204Dl\327\032en\315\177\276\226"
+	.ascii	"V!\325H!\236^\2118\236\234Q\376\027\360\"\344\214\327>\245M2"
+	.ascii	"%\"\211\210\266Q\211!\r\316\222\210"
+	.string	"\t\215\315\326K8\255\021\347j\244\354\024\371N\200T\367\332Y\204\261tx\\H*\342\252"
+	.string	"\230hv\251\004\017\3762s\341\244~XV\267\033k\033\361\342&\231^_\323Fy\032\210k\263B\347\316\344\\h\305\243\b>\266\353\267n:i{qD\321\341\022\033Z\333X\365\267\002\331\235\271\260\223\201\364A\021r@\303\377~3\206\016\274i#`\355\234\311\257\263s\303\256<\347\355f\224\013\265Q1\253dM\016\027\213v\367\002\371dp\320\276c\217\371y\337\001\334\223\227\340p\263\375j\347\316H\251RgB \276\004\244\204\213\237\241\351\242#\316\207y\241\344\026\270.p\347JM\375\037e?\341\331\354G\\!\364\241\262e\357c1b\251tL\355\034\212\bP\236\256p\324\356<x\304\3759"
+	.string	"q\027\315\360\\ \3329&\026BR{\237XB\254K\240t\376\004\024?!JD\t\334\375'Q\025R\205*\241*\244\nUBUH\025\252\204\252\220*T\tU!U\250\022\252B\252P%T\205T\241J\250\n\251B\225P\025R\205*\241*\244\nUBUH\025\252\204\252\220*T!\200\026e\317\325#\352\241c\233\3607x\036!\353i\317\316\317\206I\023\006M\r\302\244g*\312\220e\355\004b@\323\202\227P\2101W\225\236\311\330s\303\222\232\333\302@\025\366z<\217\246\032\362\361k\246%\030\246}h]\377@"
+	.string	"\341Q\005\365\032\337\303\032;V\361\b;5\366\016*\367U\3308a\026!\264!\330\371\201c\215\370\326\310b\332p?pqDb\305<\240P\363\332\332h\361\243K\371z=j\337e\231\366g\001k"
+	.string	"\b\022D\241\024\021qq\t\344@\270\f\256d65\345\206\013\376|\017\336S\342h6"
+	.ascii	"\205\216P\n\027\203\315\340\313zj"
+	.text
+	.section	.gnu.lto_.refs.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`E\003%\026"
+	.string	"f\264\217@\340\030\027Z\003\300\334\211\322\n\251#\322\f\201M+\032\314\013\255u\004\221\230\261\202\204`\2141\306\030c\230NU"
+	.string	"\201\021\266T\226k\303q\026\300'\374\243\021\252\301O\227\236m\324D\204l\231\002w"
+	.string	"|"
+	.string	"\177"
+	.string	"\213\364\034\b\317\f\3326;\327\265\363*vM:sP_\260\353z\r\203\263*\300\215\251\016\354\326\274n\325\\\026\354\276\330\214\202\335R\315\367\n uEsjfSi\022\251L\351\214k\314\235\261\256\f\346\037\325\355q\275\243\272\246\265\2125\n\346\322\352S}Q\315I]\034\324\265i\327\240~\235."
+	.ascii	"\323\235A\035s\272u\227e\272\251\322'\322\244\366\335\255K\025"
+	.ascii	"\002=^\347!t\357\200\335FBO\200\335\b\257!\b]\"\241\313@h\240"
+	.ascii	"\242\r\024=\240h\234\3257\016\206\305~\021M3\264\013vQ\257M\256"
+	.ascii	"\006\260\250vK\261\fH\013\356\315N\301= tg\t.P\320\035\200\340"
+	.ascii	"\236\003\353\314n\016\320\255\341\231\246]\231v\353\347\262\332"
+	.ascii	"]\265U\262\233\222}\372\271\305\032\210\311Z-pI\260#pY\261\253"
+	.ascii	"\3029\205\263\311\347\222\332\275V\300i\357\"\273\271\270\276"
+	.ascii	"\245]K\226+V\250L\211\002\345\211\223&L\226\004\335J\022\334"
+	.ascii	"I\220\034!\272\211$\370\220 C?\372\341#(\350:\212\246Pt\204\242"
+	.ascii	"\027\f-s\260\201\330\004\210\366\031\232\247}\343\372\325h\232"
+	.ascii	"\231F7&\205B\316z\216\225f\365\274*\375\322\363\221N8m\016N\302"
+	.ascii	"U\2256\265n\255\021JQwMw)uI\250{\250\020L_\263K3S\265K<\037\234"
+	.ascii	"\006\342#\033i\221\264G\232\b\322\223\rq \356\375\374p\317\247"
+	.ascii	"\207{\261\035\256\314\353\030\330e\275N\301\216\203iC\333\356"
+	.ascii	"Q\r\255*\365h\324\243[\032d\322\243\031LO\177\334\373#\206\326"
+	.ascii	"^/\220^\243\026ns\321\202\305\035\267\255Pq\307\rE\273\221\230"
+	.ascii	"\371\260Ta\335\243\002\363Iq\302\004I\021 9\352\370p\334\260"
+	.ascii	"Q\203\306\f\031s|1\200\356\301x1\307=\027@_\213\024(x\276\023"
+	.ascii	"&d\367J\214\220\005; \220\242c\264\361\215\343\251R\300w\211"
+	.ascii	"\333x:\373\231k\300\315t\005-11\343-\261\371\2011Ki\002f\247"
+	.ascii	"1\264\tF\315Z\305\316dlMj\271\360\030\335hH\350\264\2040r\024"
+	.ascii	"8J\315\006\233\342\016f\210q\005+\3442.\200\301 !\032\307G0S"
+	.ascii	"\314C8\274\030E\334~`\331\021\020\2102\b \021^i}[\362\303\274"
+	.ascii	"b\307\302`\210x\304K\343\374~(kxT\207IRi\207\024"
+	.text
+	.section	.gnu.lto_.decls.5590fa06429a361c,"e",@progbits
+	.string	"(\265/\375`\336\227\245a\002J\315\217\326Q\020(\244\251f\f\377\355fH\026\346\262{\321\354E\027X\330\r\231\313\226\356=\373\036\320e*\367\273\276\337\016\243Yn\320j5\002dd\227\274n\001"
+	.ascii	"\\5\260\261W\223C\271\035\f\342\353M\"#\245a\312\232d\024B\246"
+	.ascii	"\302\266\026\332$I\222\024\236\013\276\r\026\016\372\026t\354"
+	.ascii	"\377\247\2263\313\271\345\304b\262\235k\247\332\007U\222\234"
+	.ascii	"k\347\225\334t*\3356\r+eK*j\306\316\265\323\212\0230c\177h\221"
+	.ascii	"\255<5B}\241\277}\241\275}\241:\373Bt\366\205\346l\023N\304O"
+	.ascii	"\245\026\302W\265$\353\013\335msi\022\245\025\230C\351\205\312"
+	.ascii	"\354\013Q\331\027r\262/4d_(\307\276\020\324~\020\235\375 2\373"
+	.ascii	"AZ\366\203\224\354\007q\355\007\331\330\007\302\263\017\004g"
+	.ascii	"\037\250\314>\220r\037\310\311>P\221}\240\254}\240x\377\007\316"
+	.ascii	"\376O\334\376O\333\376\317\224\375\237$\373??\366\225\346P\372"
+	.ascii	"\237\032\373>~\373>o\366}\304\354\373\254\355\373("
+	.string	"\331\367\331\261\357Cc\277\002\336~\0053\373\025\326\366+,\331\257\360c\277\202\324\276\2339\224\276\307\316~O\232\375\036\267\375\036&\373==\366{j\354\013\341\354\013\307\354\013\253\354\013\223\3543\352\317YL<&\235;\266\003K\326\027\206\355\013}\354\327\231C\351\205U\373\301\277\375\340\232\375 \333~\260\312\376\263\337s\340\237\373L\274\f\250\201\nFr\340\240\313:\377\345<\317\200\031O\006\f\200W\0347e@\240\2778n\0022M\013L\323\002m\026dl-\325\017N\331\246\024\021\317~@j\332\366\222d\375\240\222\035\024\262\037\244\332_\232C\351\2034\366w\337\376n\263\277\303\354\357*\373\233\311\376\376\332\337U\373j\340\276\372f\233\361\033\273+R\304\330d\375?\273\311m\362\232\314&\2531\331\262]F\363\234\306\324\273i\306L\313\340\315\r\260\254\357\f\027\035\017\26296=\354r]\314D'"
+	.ascii	"oV\200e}q\254,R\327\236\270\001RA\243\346Pz5\312\276J\266\257"
+	.ascii	"\006\331W\257\366\323\277\375\324\315\376\263\\\231\2365\262"
+	.ascii	":^\262\356\222\337~\232\202\3428\211\3342.\2231\331r\231\\&\303"
+	.ascii	"\3451f]\2306\353\262\214\343\370C\206\017z\255/H\\\252\377,\346"
+	.ascii	"y\214\212\025\206\n\230\254\315.\"\236\305\234nbf\374e\375T\315"
+	.ascii	"\276\351\245\255\314\237\301\3440\371\213\311\226\337\376\314"
+	.ascii	"\305\314{~\363b\266\375\240q\354\025G\026\307\361[v3\333~\232"
+	.ascii	"\224\261\225P,\346k\322\027\307\361\207\242\017\037\\40<[?\275"
+	.ascii	"\262\237\246\355\247R\366\323&;e[Ki\374P\243\313\372\317Z\236"
+	.ascii	"\327\376\354\224\267\274-{\3051\2278\2161\354\032{y\374\2626"
+	.ascii	"c\223(\315YD<k\tAL\210Y\326g\306\242E\244\2142\353\233^~\023"
+	.ascii	"\215\231\007/;e\2507d\331)\323\240\323\333\353#3\321\230r\376"
+	.ascii	"\310\362\352\334\021Q\325\366\347(\031,{\345!yJ\016\313L2\224"
+	.ascii	"L%\003\311fY\231\253\344\263,$_\311_\231HV\313O\262\225\\$K\311"
+	.ascii	"FrYF\222\233d%9-'\311G\262X^\222\235\344\261\034$\223\231l\031"
+	.ascii	"-\373x\356\312?\256\225q\374\304\246\215Iw*\311\324,Aj\274\361"
+	.ascii	"\231~f\335V\bes\226g5\316,\351\370-3\232)\306\214\373y\n\212"
+	.ascii	"\237\202P\221\275\335\220[\232h\3148y\262S\236aw\247\265\366"
+	.ascii	"\301\237\235\362T\031\023\215\t\307\244\0034\337\374\"r\344,"
+	.ascii	"6*2\"2Z\336\221\271~\3168\026\222F\026\307\361M<\035[\324X\231"
+	.ascii	"t^\274H\305-\331\374\"\256\272\210\310X9\213K\236\r3K\274?;\345"
+	.ascii	"\250927\277\211\306\264\013\314N\371\351n\251\3467\321\254\261"
+	.ascii	"A\026F\316\244\373a\n\212\235\324H\221\341\371\223C&\"o\231t"
+	.ascii	"f\335V\bfZHd4\02307\231ua\"\234\305Y\236\3151\351~\3168\356\302"
+	.ascii	"C\026\307\312\233u\277\211\346\037\361AF3\323\230tj\\\027\323"
+	.ascii	"\310\022\344\306\311E"
+	.string	"\231W\246/\216\225\037\212>\004\333\254\261\223r\202>\225&Q\nB\215\375\347\036\317\\t\032\2101\250L\002\251\362\262\316<D<\367\250\240\013\334\227\254Us(}\352\264\217\322\331G\351\366\3210\373(\223\235qh\2553`I\262>*\266\217b\355\243\361\276^\263\257\307\354k.\373Z\271\257\315\366\265\222}\035\266\257\267\366u\274\177\332\355\237p\373\347\331\376I\266\203\314\241\324\f\314\261\311\326!3)\201\262X\236-V\262\376Id\337\354\220\236\201\201f\207\364g\217\375\363\306~\336\333Ev\314>\223\255\310\274\223\306\211\212+\353g9;\004\261Y\224>\320,J\237\323\354g\267\355\341\311\366\300$J\237ul\020\002\367M7\373Z\326\366\335\224\354\223\321\261_g\022\2457k\354\333\231D\351e\354/M\242\364\033\330\033\314\241\364}&Qj\2321\317\230l\024\230s\037\361\301O\246*@>\200Q"
+	.string	"\361d\375\026\373&\005\251\031hR\220^\3056\307\230dL6\017f\231\233p\346\333\203O\312X-\216\225@\3016u|h\311\372(\366M\017)P```\240\351!\275\321\326\346P\352\2019\224n0\211\322\337\004\323a?\275\261\235}q3\225^Q\362dm\272\375&\0263\213\331fz\305\361S\034\307\030L(9S~Y\233Z\314-&[\006\223\313\315.\246\227\243M\312X\031\3071\220\231\027\346t\225u\220I\224fs(=\207}s\355@_\361\007\337\033\004qlfH\315\300@3C\232\275L\2424\003s(5\325D\334\2742\224Zm)c-q\034\003\375\\E\271\262\226\265\2209\224\376\246\225\f*\224/?\206T\241"
+	.string	"H\2515%$\353\337\244\362\233R\31433\355\214\222\362\212\265\304\261RH\225\"&\210\226\254\315\264l\242\231\312\233i\346\224\217\370\340\025\236\342\2638V\232i:\216\233L\323\202\037\323\264"
+	.ascii	"\205C\322d%\325\317\373J\223(\335\346Pz\256e-D\323\371O\037\224"
+	.ascii	"\207\335\177\n\321\035i\320\255<G\237\201\203\352\370u\231\363"
+	.ascii	"\212\236@\206\221\317SE\226\362\237D\250\002\316%\250\326\237"
+	.ascii	"\313\274\262\231\016\363\237*\232\343\317D\277\331FcA=\230&\272"
+	.ascii	"\332\272\240\033\266\310y\212\006l@\017\200f\375(\226\025Z\200"
+	.ascii	"\023\017\245\372\321\250\246\037\365\300\217vHAI\366\253L:,#"
+	.ascii	"\371\317\035h\007\376S\353\314\302\3120~\264\203\220\257\037"
+	.ascii	"\315\300\004\272!\005V\n?\212t#\001\277\212!\3239\235\324\236"
+	.ascii	"\020\230G\323r\200\306\241\263~T\306\237\255\362\036\032\343"
+	.ascii	"G_\374\347S\350\340O\367\242~4\203\034\225c\350\020\374g\t\347"
+	.ascii	"\t\355\201_\177\340G\223\277\036\001\326n2s \tE\376\332\305\257"
+	.ascii	"\215?z<\007\026\357\200*\375\250\213\037m\177\024\351G\327\377"
+	.ascii	"h\250\005\212)\333\177R\200B\340\317XG\223\273\033\363\237S\247"
+	.ascii	"\335\027T\001\231N\227\377t\241&\313\177>\241,~\324\302\177\372"
+	.ascii	"\254H\201\002\035\201\205\223\252\376'\212\021\320\\\265B\227"
+	.ascii	"\366\237re\316\374G\223\362\237reP\214\200\372h\030\243\216\375"
+	.ascii	"\232\205\216@\036\341?3\240*\376\334\001\003\372\200\337\034"
+	.ascii	"\300i\002E[@\216__@g\300\004\272A"
+	.string	"\267\240"
+	.string	"\232BC\356\373\206?\005\362\237\026d\200*\240\003\352\200?\323y\317\257\202\351bn\200\006\320\005\\\371\2016\341h\277\340O\241 5\374\243(P\005\374Z\f5\341\317j\177f\3733\227\377\034\3231~-\003-\341\327]'\022\261l\026\206\222pr\320M\320\023lP\023\372\305\177\016E\0354\320y\t\277\312\200\030\250\006'\nt\204\377D+\221I\310%\250@\323\037\325\"h9g\332\177\264\020\374g\225\323M\005\362\237Q\320\004\374\350\001\376\337\371\234\332#\327\370M\016r\324\004\250\001\316\001-\300\377\271\337\371o\301\257.\375'\022\264\271\247\277\212\374M\016\314\026\277Y<\007\026L\"\370U\244\337\274\302\366\233v~\223\313\b\346\021\032"
+	.string	"\224\304o>\3407)\360\233*\376\023\b\035a\2420\027p\026\250\b\016\367r\017\177\352\3024Q\f\314\001\240Fo\273\333\231\001\207\027\375\327\360\n\376\224\204_\367\320\\?\332A|f\200v\237?\r\374\317'(\007(\b\364\303\257\217\320\r~m\305\004\272AcA=\3749\306\217v\370O\016\240\034\366\376\243\235w\327\340W\211\3763\006\252\301\225h\031\317+\374i\235\377\264"
+	.string	"\315\340\377\234\266\360_\303\367\237n\371\3159f\233lA\212\037\265@\205\206\263\204\013\177:\365\237Y\317\277j\302o\232(\006N\177\356C/\370u\002\376\254\207Z\360\353\tx\235\303\177\322\030\372U\240\005\234&\320\r\2776\341\177\031\024"
+	.ascii	"\347\211\377h\377}\376\264\306\257\377\237\201\277>\377\237\377"
+	.ascii	"\016\376z\203_w\360k\016~\375\341\327\034~\355\341\327 ~\035"
+	.ascii	"\342\327$~\375\301\217V\360\353\241_k\360\353\f~\255\177\224"
+	.ascii	"\202\377A\377^\177m\200\037\325\360\243\023\374h\206\037-\372"
+	.ascii	"Q\242\037\275\360_\375\267\214\037\035\372Q\240\037\365\371\321"
+	.ascii	"\236\037\r\376\250\372\243\371G\377k\300_\377\375\332\357\327"
+	.ascii	"}\277\346\373\265\336\257\363~}\367\3537\277f\363k5\277>\363"
+	.ascii	"k\271_\227\371\365\230_\303\375\372\313\257\333~\335\345\327"
+	.ascii	"l\277\336\362\353,\277\266\362k*\277\206\362k'\277>\362\353\260"
+	.ascii	"_\017\371\265\220_\177\375\332\353\327]\277\346\372\365\326\257"
+	.ascii	"\265~\235\365k\251_\333\370u\324\257g\374\372\351\327!\370\365"
+	.ascii	"\007~\235\302\257\341_\273\277N"
+	.string	"\376\332\370k\244_\027\177\335\342\327\032\370u\006~}\201_W\340\327\023\370u\004~\315\342\327*~\235\342\327\r\370\365\t\277^\300\257\025\360\353\023\277\036\341\327\"\374:\204_\177\360k\022\277\366\340\327\372?\361\376\363\356?\355\376\263\315\177\252\371O\247\377D\363\237t\377y\346?\345\376\263\314\177\216\371O\270\377\004\363\237i\377\351\366\237]\376s\355?\263\374\347\225\377\254\362\237\312\3774\373O(\377\311\344?C\360\2376\376s\354?\221\374\247\330\177\026\371O\260\377\224\361\237\305\377\f\362\237@\376\363\307\177\372\370O\036\377\251\365\237Y\377\211\365\237V\3779\365\2377\376\223\306\177B\375g\374\237\036\370\317\024\376\023\376O\367?\217\377\351\342?\333\377d\377s\375O\f\374\247\005\376\223\002\377)\201\377\204\300\177\252\370\317\024\377\331\200\377<\341?\027\360\237%\374\347\211\377,\361\237\t\370\317\003\374\247\001\376\223"
+	.ascii	"\3779\200\377\374\340?I\374\247\210\377\f\361\237\035\374\347"
+	.ascii	"\207\377\364\360\237\034\3763\203\377\274\340?)\370\317\t\376"
+	.ascii	"\263\3703\t\377\231\341?1\374'\321\177^\370\337\366\233m\376"
+	.ascii	"\323\302\177\n\375\367\362\237@\377\033\360\233(\376\243\375"
+	.ascii	"\246\371\237>\377)\374O\365?\365\177\232\177\006\3743\236?\367"
+	.ascii	"\375\331\316\3772\177\326\373?\367g:\177\236\363\347.\177\236"
+	.ascii	"\362\347%\177\306\361\177\305\237\257\376,\365\347\024\376\374"
+	.ascii	"\376\031\002\177.\341\317'\376"
+	.string	"l\342\317\034\374y\303\237-\370\315\244\337\254\300o.\340?\n\277I\302\377/\377\335\376W\371O\345\277\362\177\335\177\271\377\033\004\006\006\006\376C\313\377\002\026\177\013\033\001\252\226I\247c\247\247\270+L\345\023\232\331\303;\223\3657\030\263\017\302T\263\262\016gZ\355,PQ\226h\373W\261T\2549'\373*\225\251Z\251Vi\327\224\036\256\r\276\366\315\264+=\bS\235R\247\016\027\214\343/.!_\f\342\033h\2515\324\033j\r\325\206j\203\257\202\277]55c*\353oP\265\277\001\323Vi\2504R53\216\367~\270|j8\241\341e}\017xj\223\372\2446\251P*\224\352\244:\245ky!\372r\232]\222\255\254\357\341\314\276\007,\200j\f\030\030\230~=\250\t\r\007?\240\245\224\035\255\254\357\341\307~\007:\177\177h^0\216\277\212\b\365\352\370R?\276\364\216\035;\351\235\t\300\bw"
+	.ascii	"!\333\352{z\347\374b\365\246\315\337\377`\017\230\252\263&Y\277"
+	.ascii	"C\231\375\016l\373O\365n\262\245z)\227\b\261\233\031\307^\300"
+	.ascii	"\316\226>\\8\236\370e\375\016N\226\3134\257\251)\2042d\200e>"
+	.ascii	"<\240\240\234\245t\212\200\262\034\221\302&\353w\030\262\337"
+	.ascii	"\001\013\357\037\361A\312&\225c\246\211\340\024\307]eCZ\035\244"
+	.ascii	"\366;<\335\335\231ig\034wq\t\3438\334\355?us\223-u\223\276\331"
+	.ascii	"\020oy\305X!(q\372B\013*\321\204\321\310:\265\323XqsB\262>\007"
+	.ascii	"3\373\034\264\250I\331\250I\277\32286\225^UV\361\226\225\207"
+	.ascii	"5k\254\370,\224my\250@\327\267\245G\326\347\340d\237C\017:\272"
+	.ascii	"\024\r\223\f\224\344\345\231I\201\206\031\275\254\323:.B\272"
+	.ascii	"\320\324\262>\007\033\373\032\350\2359c\246\321\361 OJ\316\237"
+	.ascii	"p\013,\307\234\254\257\201\0309\271\016q\032\244\225)c\306ai"
+	.ascii	"0%\315"
+	.string	"\330_\317\0264Y~d}\r\220\214\031\243\261l\210\303\274\232\2766,\245\332\360\365\231yX\234\326\262\276\006D\302\244_R83n3Y\305OD\260@X)A\\\203\252\375\f\366\300\200\331\220'\325\206\357\274B#\214\226\254\237\301\0277\267t\r\314\007\276\f\320\274xIy<\340\013\316\362\274\"\207j.\353g \266\377\224\313M\266\224K\272\265!\336\362j\302\002\301I\036\232\025:\367\205*J\326\317`K\213\226t\r\214\221U\272\366s\006\267\274\223\365\367\320\274\377\301!\234\221\276\254\237\001\r,XR\265\035\307VL\312\270\352G\017\203:V\254\244j\017\212c/\2478\356\342\3521#E\344\257\357\251\232\231\026T\302$\210T\326\307\200\315\376S\266\224\212\006\242c\247(\257\246 \001P\302\344\013\315\304\235\2627Y\037\203\267\375\247i7\331\322\264\024kC\274\345\325\201\f\260\214L\034o\201\240"
+	.ascii	"\340\036\234\254\217\201\224\375\247S\246\230m:\206\212c\257"
+	.ascii	"\035B\267-\020\347\027\332\r4Y\037\003&\373O\245\260\245RR+ "
+	.ascii	"\266%_\0235\t\2177VY\037\003#\373O\243D\311M:\206z\212\275\212"
+	.ascii	"\244\200Vw\254\314\262>\006<\266\311\226B\311kMJ@\220\342\005"
+	.ascii	"X\266\321\226\370\331e}\f\254\2348I\277L\035\223\305Nj\276t\370"
+	.ascii	"\223\"\362\327\207A\023\023&yB+Q\234\262\376\005tJ\224\230i\033"
+	.ascii	"8,\255\310\2000\271\360\240C\227\365/\21026\246\327\344\215\022"
+	.ascii	"\274\254\177\001\327~*f\246HL\266\024In\022!v\213\237\234\200"
+	.ascii	"p\340\013\252\035Y\232e\375\013h\354\233\271)\375S#7\331R#i\216"
+	.ascii	"\r"
+	.ascii	"\261\026\257\030\213\003&Vu\254\372\342x\013\004P\0207*\312\254"
+	.ascii	"o\201\235\375\247ali\230\351\226\343\246*1S:'5\246U\026\307["
+	.ascii	" \32043y\230d}\013\314\354?\0352\304\244\333\020oy1\345Y`%%\326"
+	.ascii	"\327\027\307d@\354\254\265\255\266\254o\001\331\276\231f\246"
+	.ascii	"B\376\021\037\230l\251\0203M\307Nq\334\365\205\303\234\024\221"
+	.ascii	"\277\276\330\212\f\210\016\344\302\360\262\276\005Y\373\351\217"
+	.ascii	"\324\353)\020\266\024H\372e\306qS\274\0253\321\351`&E\344\257"
+	.ascii	",\336\262\362\360\177\317dK\277.\247B\254"
+	.string	"\001M\323$\311Z\326\337@\267\315\337|\376\323\270\311*\216c,T\031[9UH\177\363&j\232\036~\037\3634/\370\257\343\370\"x$\343x\213K_\034\307\246\336f\322\326\324cC\214!\216\343\253\250\247\230\311\214R\373\272\212R\373\262\022\2122\363u\025?]\225=}y\231QO_VVO1\223P\254\366e\025\025\177]\005\305j\261\216(\265&&3\352)\276\212\343\2578(\216j\272\212\325\224VBQj_VQj_WBQjMWQ\261W\034\024\245\024b\025+\277\230\204n\2505]\305j^WB\261\332\327UT\232\037h\212\270\234\005\211\n|RRe\002\211z\212\251\246\270\232\254\202\352\242\224^\261]\034\233Zf\304Vq]\034_\020\307\\^VvM:L7\247:*'.M^\2462\216\343\fSNA\274\342\247:&3\256\213j\342\025\307M\234\222\342\2518\216\343"
+	.string	"0)\353\342\"f\035\223\020\256XjF\034K\020+\343x*\216\231\314\270.\216c\2468\216U+.e\034\363\b\212\"\233\232\212\343\255\242\251\230\213\351\313\2148\316Z\340\270]E\251\005\361\022\361\005\213\032YLC\311dFIy\305d\261\335\227\325Vc\242\022K\305ql\326\331dW8\362R\037j\020<_\262d\375\r`;\355\241\"\351\"f\231\3657d\355tG\356a\242\002F&\353o\230\261S\035&\212\246\206f,\353\003\240o+{\334\272\266de\235f9\351\372R\313\372"
+	.string	"\300\333\312\2638V\376\244O\216\320\370\222^\371\364\001\351\n\223\365\001\020\267\323\252\f\3026\266\255\253\254\017"
+	.ascii	"\265-\225N\r VC&E\252Fj\243\302T\231,l\212\324\230\221\322\350"
+	.ascii	"\242"
+	.string	"\305\246\354jF\372\224u\334X\202\225\365\001\360\264S\247\264)e\032s3\206$\3534.R\311\322\306\356\262~\005qvO\036\345V\027 \232G\250\345\344\024g\375\n\316l?\024\217Y'v\222\272\342\247\274\260\005\205\212\017\265\263\325\334\001\223#\343C\365\202^<\2544e\375\n\302v\035\224N\205&-/h\262~\005?\366\217.\347d<,M\336\346\240r\364\232\210Ue\215'\224\222\344\212\\\326\257\340\306>\t9<d\316\250\2373\216\233\360\310\300\240A\323\240lP8(\035\352\006U\203\332\241m\320;t\rZ\207\3061\331\3207\250\231\243g\320\271g<1sD\240o\3200w\226\350\033t\314\031e\326mi\263\030}\203\272\241_\314\2720}\366\267,\003\327\226\007}\223\357\344@\263nK7\001\\\306\335\241o\3207u,\310\034\256>\037:\\k\216h\320\331\312$J/0\207\322S"
+	.string	"f\237\202\265}\n\250\354S\360d\237\202$\373\024\020\331\247"
+	.ascii	"\310>\005:\366)\210\332\327\240\267\257\341\314\376\322d\002"
+	.ascii	"\351!\361;\222\3655\200\331\327\260\266\177\324K\027\315F\244"
+	.ascii	"\215.k\264\313\217\246\241J\224K\326s\302\244\314\232m\217\331"
+	.ascii	"\325 \223\3655\234]A\267\240YP-(\026"
+	.string	"\223\r]C\251\034\255\202ZqsE\313[\0254*idk\247\225\267\335\2401e\rU{\333I\305*\202\031n\326\226q\034\027U\240\303\265f\256\202\276\206\262mz\231D\351\005s(\275\006#\373\2543\211\322\020P4\263\240\223\227\031\236\254O\002J\021\324\fu\222El\371\304H\024\364\f\225\202N1\331P3\264\354\r5C\233\354U\031\373\353C\331z\304TB}\r]\373\032\244\366'\240\263?\201\333\376\004G\366\2172A\307\374\312\346\306\262F\307P\036h\330I\305j\001j\336,u\304q\263\003\3162\t\212\004U\202\036A\311\320%&\033:\206\0269j\004\025\313N\350\030\232C\216\223\026\336\030\272e\345\316'H\236:\264\037m*M\242\264\310\034J?\001\017\"\272\b\333\032\\\326\237@\n\025\202\006A\301L6t\b\nD\223\360\222;\373B\177\234!\033\202\366@\177\230uZ\342\246\253"
+	.ascii	"H\261\002e\256/\216\343\242\017\037>Tx;\313\363\261\365%\240"
+	.ascii	"\263/\201\232}\t\3506\312\205\3720\331\016\207v\025\031\303T"
+	.ascii	"$\353K0f\307\210\34386\017\227\252\207K/\301\333\276\004m\373"
+	.ascii	"\022d\331\227@\312\276\004I\366%(\262/\301\327\376\321,\034\250"
+	.ascii	"\2258\263\246\254Q\034\327U\274|\316&\2553mY\377(\226\325\217"
+	.ascii	"\0224Q\313\254O\002\265B\251\314\270\237'e|\265\242\316\330\262"
+	.ascii	"\354\312dC\255\320*\265\034\307\006G\216\326\317P\267\237\241"
+	.ascii	"\314"
+	.string	"\376\321)t\006\336\035\023S\326'\321\364\206\306H\362\002\223,\321\031\372/J\23622\r8\206\326@\243P\032\250\r\364\006\n\205J\231l\350\f\324\351\350\223\251\006\235\2012\251jrn|\t\322?\346P\372\fZ\3663D\331\317Pd?\303\217\375\f7\366\213\002\367\213\362\366\213\322\340\361;\331\332\246l\365\351;&\233\366\323v\224|~z\217\0021`YY\005)S\340l\244\372Eo\373ES\366\213\304\364\350\b\265\344\231\023%\353\223X\003'o\356\215\206\243\357t\034\355F\347\3519z\251\345h<m\247\353\230l\232\216fsSM\267\251\223\243G7\007\017\032</i\342\260\211\363SS\206\214\323\030:Z\315\235\246\243\345\364\231\037&e\314\224\266\341\370B\373P\224\242\031A\322'\2016\243L\242\364E\361>\206\345>\206\271}\fo\373\030\254\354c@\262\217\341\307>\206\250\375k3\327g"
+	.string	"5\220F=}5\311:\247\021qm\306\356\352K\216\254\037A\337~\004t\366#\230\333\217@\313~\004O\366\257\305\3507&\246\252\250\254o\272\321\"\245\3374\233\031wR\261\332Y\254\324\200\323_\264\233\016\243\3334\030\223M\277i/Zy\022]\336\364\226\033\313\2657\315\305\244\373aR\306U\"\232\362\314\224Q\361\002\366\367\243\037\001\324>\321\235}\242\274}\2423\373Dd\366\211\264\354\0235\331\277\316\202\345\305\326\026\232\306\322fz\375\340\270R\306\343\212\007\237;m\234\312\324\252\360\320\302c%\353\233j\306\202"
+	.string	"\3524mES\321J\223MW\321hn\252h\262<\272\212^\242\247\234J7\006X\371[\326U\321I\322\362\340\024}\370\360\341\247\310\237\230\224P\237\310\306>3\367\304\224"
+	.ascii	"f\375\013w\366I4\251\241\243\350'\032\312\251$\013\322\brc\251"
+	.ascii	"\315t\231\226b\262\351(\332\311\265\022\323\215\216\242\231\304"
+	.ascii	"ML (\371j\263\354\213c\345\207\017E\037P+\037l\346\266\326Pr"
+	.ascii	"\326\336z\222\322\312\372\027\276\354_P\356_\030\333\277\360"
+	.ascii	"\265\177\241kW0\207\322_\270\261?tg\177Hn\377\032\211>\222\372"
+	.ascii	"\270\243s\245\215h1]D\207\231l\372\210&b*\343X\315\213\0205b"
+	.ascii	"A\216"
+	.string	",?"
+	.ascii	"s\362\205f\325\247\217\350!XhV\333\f\307\f0B\375\241%\373Ca\373"
+	.ascii	"CY\373\026\376\366-\340\355_\177i q\272\\\375e\375k \247\233"
+	.ascii	"1\\w\224d\375u\344\310r)\305\006\232\263\032dyr\266\310\366\262"
+	.ascii	"\235@8K*\021nV\360\344\335 \313{|Qf\030&>\226eSQ\244\276\210"
+	.ascii	"D\371\240\216\215=\247;\313\257!fK\250\031s\310\366\236\372\240"
+	.ascii	"j\340\341\350\301\345mIW\206\223\365\334\3248\277\202L\t3Vd\211"
+	.ascii	"c\253\355\204\262\021\207\314D\003\205\n\207\2175\262\023\352"
+	.ascii	"\254\002\243Ccv#\357\235M\246\037\224\337\362\304\221%\307\243"
+	.ascii	"\313\te5G\226\341\3448Dx\234\221\205-\331\344\210\323:q\350 "
+	.ascii	"\203\207\316\324\322\315\231vv9\225n&8\005.\3438n\302\265\f\223"
+	.ascii	"\304\310Ro\216\233*\2574\262\363\t\330\326\227\030\022.\266<"
+	.ascii	"*\273\274w\272\311wr\340\251$+\341J\236e\034\3078~h\311{\361"
+	.ascii	"_\206\223\361\210\3548\241\256\316,\241N7'\2153\352\207)(\216"
+	.ascii	"\301\344\2348N l\320\226So\226\247\334\tx\306\321>\316=\335\343"
+	.ascii	"\274\243wh\034\372\206\336\322\\\347\234\023\357L\243\2334\226"
+	.ascii	"\256\322V'\034M\245i\234h\316\270\323\356\\\352\2473\360\274"
+	.ascii	";\3514\323\371w\3429\375t\324\t\247c=u\322\321P"
+	.string	"\247\232S\316\251w\276\3216N1\347\032}\245\263N2\347\231\323\314\231\247\275\3166'\237\256q\3469\347\264\224\326q\3329\353\316:z\206\326\3229\264\223\376\241\273\316\276\223\315YF\3638\307\230l\247\233\023\314\317\2673L\030$b\"\2748\3459\277\300\244,O\034][\310\362\036\023\236\023\352\306\235\223\035'\024Vn\372i\n\212\237\240\314\220\231a\224\374X\352\025\031#{3\222\204\fN\276s\323\203\fJ\n\fN\333_^X\331\362\213\337\362\374rs\n\001;[\2368\334\234;\256xY\306\261\362C\221)w'H\232\271\245\267\233I\224\2326\314\241\364\026\352\366-|\331\267\240\334\267\240d\337B\327\376O\3459\345D;\271\004\263\312\200\361\2225[\321\th\303\313\224\034q\3022B\214\260\031K\355\204eb\334\240\b\311h6\301\261\271%\200\373\027\212\351\372\371\252\362\213\003\247B\205\021\342"
+	.string	"\201%\354\215\007\212\245r\rL\272\245&\246)\1771\343\366\0269u7\270p\021\266\231VVM\361V\314T\247\203\263\254\264-/\027\266\001\301!\002\027\227\265\260\313\231\006\020\211\035\023q\373\027\262\245hz\254xy\242\265\266\227?l3\326\364\266\240y=f\252\374\211\321\022<\222\321j\220Y\223e\373U\210\347\240aa)r\342\bc\202\345J\320\211\020\f\357K\225\232\332\306\264\023\022\345\206\225\265\0240\357\312\227*j\332\0062\304\357\211\212\220\206\206\303\263\246\214R5\303j\323\006*k!Z\026N\021\246]\210v\245\020\r"
+	.string	"\177@\246i\001\020\01762K\322\263\224K\031EM,k\341\023\341\023\241\331-4\211\t\377\262\244"
+	.ascii	"\366\305[Y\036~a\224\013\315\340\320\031q\364\322d-,;\034\236"
+	.ascii	"-ik\262\026B9\234\334\\\220\037&\234\354_\350\004"
+	.string	"+\247\351\242S\327D\203)\361\"\205Ij\365\241oH\225\254\205dB%\027.\271pI\026.9\003\003\323)k\262\244\372\027\216\2459R0;v@\t\223\004\271\260@\271\323\"D\242B\351\213cSCyvg\247I,H\345\254\n_\227\221\355F5\223C\271\244H0\313\021\035x?\262\256\252\022\363\"\222\346EQ[\202eHz'\003\262\325Y\003\226~\351-;\302\202\b\311M:\240\360\260\005\t>})\351\230\361\035\311\372&\233\020H\2526B\236\024\230\227\026 ;/0\251\037L*\254\205\301S%\354\332OG\322\330}\371\340\322{k\316\340\020\366\270\220\353\317<\314%\033/yaYg.\".\354\221\247\f\2112\302c\007\224\225\031(\035\027\356\370\205[\346]\340\230\236T\326Bs(\315}\".\324\361\224\265\226DK\230\303\r\0263[\262\026\346\360r\346\312\220\254\257\256\2048z"
+	.ascii	"\253\206\370\365\301m\271Z\303\272\020\007j\305v\345L\326\337"
+	.ascii	"\013\302\205ir\227\365M|\t\253\204U\351\232\23312\237.'J\274"
+	.ascii	"d}\023Y\302)\341T\372\365cf\312N\226\017\2652n\262\276\211\032"
+	.ascii	"\302\033\302\033yyf\312\204c\314\332\332\262\376\bs\2045\204"
+	.ascii	"5~\372\246\354d\365\t\273\3200s'\353\217 '|\022>\ti\370\370\321"
+	.ascii	"\223\032\323\272@\227%X\302\031\027\322\b\316\351\341S\373\242"
+	.ascii	"&\204\252\"F\210T\326\277\020*8\247\215\232X\326\037\201M\330"
+	.ascii	"$lR\323\300H\215i\005\373\262\236p\311\372#\f\021\306\3028]3"
+	.ascii	"\371\250\362\370\312\200\332\374\260;\313\372#`\001\002\006\263"
+	.ascii	"|\2512\366W\301\020=:<\177\177\251\032Q\034U\036_\337\311\204"
+	.ascii	"\314iJ\031?\277`\026\363K\323\330\237\271\005\350\205J\326/Q"
+	.ascii	"\245\257/.k\310\262'K\031\0309Y\277\204\030\037\237V\226\221"
+	.ascii	"%e;\310\306\\e}\021\366\364\364\346\262\206,\313\366\0242\"r"
+	.ascii	"Y_\004&xx\301\274\036\277\252!~})\035?'\036t\036\314k\323\007"
+	.ascii	"\206'\353\3402\245\372\037Tw4\025a\232\343D\210X\223\254\203"
+	.ascii	"r\200\306\354\375p\313\372\"\020\331\027a\353\356.\370\006\220"
+	.ascii	"lk\314\232\234\254/\302\f7n\202oT?)\261>\341\\\325V\235\335\203"
+	.ascii	"o\262\021\270\266"
+	.string	"\272\364\306\335\327\2154Y?\001{l\330\220U\315\211\353\373\231\032\003\003$\353'`\r\035]P\215\n\246\np\253\302\025\2707\2634\017\252\021R\341qr%\210\006.M\r\232`\035\225(O\264d]\207\232\021\242\211\215)\311\372\t\030;s&\375\022\206\241B\363\353\302\2223$\353'\200\207\234\234zg\001+\300\262\262\033\\Wq\326O@S\2312\351\027V\225\024\256\037$vqyY\037\001zc\306\334\341!\273#S\345\246\315\333[\020.\255\312\330_\331\017\233V\033\2740\017\302\371\314\340\242\246$\215\002\242\022\026D,\353#\300\355\313\227`\026s\314\222\261\27748\244\316d}\004\244\265\265q!\313kOajd}\004\210u\351\222~\251ZUs\342\374\256\f\t\222\365\021\200\203\215M\355\252\232\023\327\247bqBDK\326?@]pKpK\272\206%5\246U\346\023WUV\226\365\017"
+	.ascii	"\027\274\022\274\022\314\362\2237e'\253\357\354jS\005\206\345"
+	.ascii	"\301,\272H\234\034wi6\260\336\272\262\376\001\224V\254\374\350"
+	.ascii	"\245H\320\3205\311\372\007\340\212\362`Z\224 \225\2418E^\\\252"
+	.ascii	"\222*8[}q\024\227\007SL\316\216\226\362A*\207\003\352\001v\365"
+	.ascii	"\024\234\362 \332\037T\335\260\221\253\222\365C\370\333A)\017"
+	.ascii	"\236\375A\264\007\216\273&Y?\004;\373\017\232\375\301\naf\346"
+	.ascii	"\362\262~\bt\366C\300\203\002E\205\242nUI\341*\343j\023&.I\222"
+	.ascii	"\240\223\";_c\177}@_\356\256\220i\362\240\0234eZ\362d\035\034"
+	.ascii	"\0132\371\037\334no\342\3200\t.\261\313A\225$\353\240\022%\n"
+	.ascii	"\274)c\262~\b]6\331\t\246\350\214CB\246N\biA#A#\301#@VSv\262"
+	.ascii	"x\340A\202#(\366\340\021\215\2467\006"
+	.string	"\n\356\177P\347\370\"\345L\326\017\201,,,\375r\253\314\310\352r\004Be\375\020\300\206\f\241\263\002e.\355[\203G\226\365C\230\022\"$U\273\300d\311\327d\b\224\232\271\254o"
+	.string	"9\301\257\340W\372\225!-o\354\257o#\251\003\326\227\365\r \027\364\nz\035 \017\315J\005{*\263\223\365\r\320\026\354\nv\245jhB\033hfY\320x\360\br\251VUR\270\312P&]P`\202=\036\344\002\234A\207-\353\357\245P\377\203\036\300\021K\222\365\r\360#\270\025\334\202\253\314\310\312r\340\0309m~ZZ\351W\020S\220\322I\315\030\331\022*Zf\262~\001\356\202TA\252`\326W\236\2312\025\316\f\261\266 \216\007\263P1\312\330H\326A,40\212U\216\265\253\377A \3007 Q\256\202Vb\272\332\224\311\332*X\245\2143h\274\036@\322\262~\001\304\354\027\340\212\224\224\031\331\246\203\245c,\353\027\240I\320F\320F\031Y\0210T\262~\001\276\202Q\301\250\364\253\210\257j\tV\237\311\346\013\2341Y\237"
+	.string	"t\2023\2023R\265\324LD\323\016\250\254O\200\272 S\220)\370\224fU%\321\002:#\245\b\233\240\323\203O\301&\002,\t\fL\325\366\322\274*#f|\236\230!S$\353\203\020\370\367\267\363\360\370yR5\304O\203\315P2\225'7\211Q\231\001$\353\203@\205\217o\373\345y\220\213\001\313\202;\302\306\270\361\273#\354A\306EJ\326\273\257B\240\0335iY\037\004\262m\007\204-=\275'Rb}}\346\225$SYY\037\204\031yy\251Z\017\232\324\230V\237\226\262$\2072\353\017 O\216\234\275\344K\313\244\304\372\222t\351\2233\347{y9f \232+f\372\376\007+0\371\202\252\223\365\0070\367\346\315\216\263\201\025\025\237\236fB{\343\025g\337\335\331\341\225g\303)\202e\t\223\365\007"
+	.string	"\267?"
+	.string	"/m\332l7\337\340\364\024w%I\317\244\304\372\3148$}h\266\233>9stqek\326\244k$\300\344\231\001\252\023\007K\\\2214i\32250Q\362\234\215e\375\001x\325\325\245j9\336\332\361\0240\036\313\275d\271fF\326\037\300\324\334\334\212%p\226e*\231\034\032h\262\376"
+	.string	"\230\314\230I\277\212\244\344\241Y\005\303\304\300\305{qqj\233\354\341\217\212O\257\357\307\213,\212W\326\027\300\033\0312\027\344\310"
+	.string	"\313\372\362\217\370\314M\326\027\300\231\0301\351W\320\371\024w\315\221\001\311\321\343\272\223\365\0050\026&L\372\225\201\214*\217o(M\240Y\326\027\200\r0`\3228*8sA+I\370\356\366\334\334\266R(\206\n\315OxE\357\217.\353\177\020\306\213\227\037\276);Y=O\354\370xd\375\017\314\270pI\325R2Tp\346N;'c\342"
+	.string	"\327\326\264\250\332\b\003\337\202\314P\303\202ek\t\262\222\022\353\373Y\336\300\033\263\263|k\331\273R\207\026\367?\230\316U\375\371\235\251\251\245[Ti\376\320\264\246\031PY?"
+	.ascii	"LU\252\244jALU\342\252\017\274\370\232\224\305\361\226\207\236"
+	.ascii	"\271>\251\257\254O\302\316F\333h[\231\343-/\246=a\031\025\232"
+	.ascii	"__\034oy\320w\264`)I\373V\002999\322e\357\177\320\247\f\217\315"
+	.ascii	"\216\254O\202\r\312\206\262\317vl\303\212\001Pd\226\261\025\027"
+	.ascii	"\b\225\214\333\0331R*\034\001\254\322\241\354\331\212\352\202"
+	.ascii	"\266\315v\224\n\037\350\354 \023e\227I\311\032rDy\026\3071P\360"
+	.ascii	"\013\036'9\2248q\002\026\347\226\206\013\352F\326'\201c\377{"
+	.ascii	"\311^\262\231\344\270)(~\n2\347\026[m\201H\235p\310\365\310\301"
+	.ascii	"2$8\210d\375\021u\366\214\357\252m\265\257L\266=c\223\355x\206"
+	.ascii	"\025Y\\$J\017\2320\366Ks%\3531e\223\2336e\262\376\2106\333\t"
+	.ascii	"kg\305Y\346\270\333\261{\230ua\"<\241[\212\320\332848E)\340\f"
+	.ascii	"\316\022M\330\366\261\301\314\272\255\240\370\311K\337r\207m"
+	.ascii	";#;\311F\262\3056\221]d\0371\331v\330\346\372\266\332WOo;l\353"
+	.ascii	"x\003\244'%\213\216 \215u<\rNQ\n@\223\263\334B\366\020\223m\203"
+	.ascii	"\275H\031\307Z6\330\356\332A48E\305M_\004\230\243z\022&\303\007"
+	.ascii	"\237\2745v=R\375\357 \373\213\213\222H\235\2547\020uK\207\034"
+	.ascii	"T\326\037\201e\377\373\207\311\266\275\366^\331\027<\307\033"
+	.ascii	"c$\210\225\375\021S\366G\220\355\315c\263Y\372\230\313\372#\214"
+	.ascii	"\354\217\030\262?\342\307\376\b\036\373#\260\366GL\355\177o\265"
+	.ascii	"8\2759\034j\316H9e\375\0215vV\232D\251\007s(\335R\233\n\310\314"
+	.ascii	"m\b[\326\337S\377\203\r0B\307\226\265\3367\262\334\030\331T\326"
+	.ascii	"\3376~\354\222l\241\222\365w\r\266@\275\035Y\357\250=C\004\236"
+	.ascii	"\016B\037^~\364\310\372\3374\276\243~ui\262\311\200)\004\346"
+	.ascii	"\261\223\265V\"\342\233F\317\234\230eZ\326\027Qf\337\214b\252"
+	.ascii	"s\256\376\315\331O:\206r\212\277\326z\300p\201Ho\244\311\361"
+	.ascii	"\225\365vR\252\275\221\375\260\312\372\"\320\366\377\315\264"
+	.string	"c\223m7\251\200y7\251\201\273I\315\003H%F\326\027\270\344,K\252/\202j\337\203:\373\036\224\331j\237\352\247\342\371\203\3017)5\\Y\337\203/\373\352\235\377AaX\032$N\262\316|W\355\374A\365\314\352iK\326\367\200\313\276\252\247\356\375\3013\217\231\267\032Y\337\003\265}\265\316\377`\b\356\200D\311Z\315\3333<p\322!\b\247\n\236\030\235\253yY\252\307\326\234\254\325\245\210\253t\362\230\0269\271\254}\314\241\364\036H\341\3415\221X\342\346\352\016U\326\017\301\007\007\216z\227c\257\247\230L%S\206K\220\234\221\263;\2374Xob6vv\252\033\240\016\263\003\326e\f\0336j\233\354eW\306liF\025\207H\326j\0334O\307\021\023\370gE\215\232T\355\246U\ffD\234\237\235&\261\254\037\"l\243A\023\307\231[_iE\262~\b\036*\235J\227\252\005\363Bly0"
+	.string	"\232\034W\326\0171u\346L\252\026\324y!\266~\276\240A;\223GN\316\244\3131S\225\270J\2106e'\253,\216\311\200\bnIs\322\266\177\265L\031\223\356\214\343\2560\241\030#\2641c\362\214\346\324(6w\326d}\243\2610\352\233\n\207\346\2311Vl\326h\002Wdi\304\265oDC\005\243\202I\327\322|@K\203\007x\226\365;\270kkS\335\214\376z\270\272\260l\271\352\306'\246\353/\353w@\206\313\271\250]\314\rOWF\371\317.\016\231.t=o\256\312\246d\375\016\316\266\254=\351"
+	.ascii	"\310~\007O\373W\263\250Y\3209s\270R,sU\266d}\016\340\250\375"
+	.ascii	"#>P\225\352\0253m\307d\261\023\033\246\020K\314\354s\300e\377"
+	.ascii	"j\225*f\232\007\261\223\032*F}\034DQ\317T\245z\246\246M\231\242"
+	.ascii	"\246=\250)DW\260\r\2213QhW\323\202\200f\240\360\340`l\237\203"
+	.ascii	"\256(QT\263\rq\254\234\021\307\250s\222g\031omyH\267\324p\313"
+	.ascii	"\221\265\231\337n\333\363\342\226\3659\200r\342D\205\362 4 \310"
+	.ascii	"\370\330\345A\345=1\331T(\250\0240J\035m\224(Q\231\334\264\212"
+	.ascii	"c\257\017|\\\332\346\336\262\376\325%W\231\370\300\355x"
+	.string	"\322#\353\357\231t\377\203h\020\2768mY\037\204\230\375\253c&\233:\206v!\300\224*c\177?wg\266\332d}\020^\220 1\323Le\\\325\223\005\342\210*&f\246\235V \254\366\257\022Q\211\250E6\304a^1\226\007{yc\177}7\336v\220e\255\206\261\235\261\362\226\365A<\355\177\250\243\202\251`\030"
+	.ascii	"~\230\013\022$\375\342\373!c\206g\227#\353\177X\003\002\004\315"
+	.ascii	"\323\312\370\252\007K\212\310_\331\222\037?\320<\035\024?\201"
+	.ascii	"\245\221}\320\332W{\230\252\017\037\177x\366M4/\375\325\255\233"
+	.ascii	"l\352\226\312\003\207\2072u\240\314}1\362\006*ku\307SF\313\232"
+	.ascii	"\201\226\3657x\263\277A\232\375\253Z\001H\355\321\021i\"\206"
+	.ascii	"\273"
+	.string	"\203=\025~*\020\223\340U)\304\021\251\244\204$\036\333\325\r\272xW\0260\213d\001\351\330\372 ]\031H\302\f.\233TbY\024WV\005\322\225\2014\264\272%\300\254\t1\\\240\022\216%b\250\310\200\205W\025I/\353\036\261*\210*\206\214k\013\267G\024+\210n\004/\354\"S\260\360JD\032\215%\"x\222\021<\364$\243a\362U\n\221|\225^\330]\301\276+kdU\254H\276J\031\300\303\0256\262'X\245\026\356q\361\256,X\367\247(TB\020\373\276%.\274l\021\211\302\205\027\003K<\262\306v\205O\261M\372\020)\271,\214\002fW\024\333d\320\020\206'\031\205@:\266.\022n\217H\024^\024\354\321\372\032\333\365\350\002\212\025+T\b\221\256\f\244\013H\307\366x\\RqD\266HW\206\tn[\302\333b\360$\243\027\351\330\272\360\033\202-.\031\211\3076\204\373.\205\300"
+	.ascii	"\003\351&\301\310\243z\264\262F\r\277G$\021}\217\216\3167\311"
+	.ascii	"\262#H\300\002\234<\301\302\253\212\267E\t\244+\003\351\347M"
+	.ascii	"\016Y%d\322pE\n\0230\300\354\n\007\260\254{T\\Y\005\034\221\355"
+	.ascii	"\321e\341u\351\001KJm\005p{D\301\002\351\022"
+	.string	"K\024\333\244\005\244c+\201\"\033\243-\341m{\202\236d\024\002\331bhA<\212\340\350\200\027^\341\327'\351m\217m\tK\027\202\204Vb[<\266o\bd\233\364\256\306\022\212\354\tH\307\366\350\2560\200\212o\033\364$\243\020\032^\024\254\273\004\257\354Q\320\223\214&0\"\211H\030\351\246h#x\222\221\005\305\025y\002\213\264\272\354\213\0220\2134\001;\f\302 d\\\217H\355\n\244c\373\242e\211\254\212\027E\fw\350\2704\004\017_\024\336\326hl\225R$\242\037\326\330be\021\243U\332.\033\243E\341m-\274\310\027.\273\342e\341\326\205\321\363$#V\251\205_\244Kl\225R\027Y\302\353\202\330\276\020x\333\b\3366F\t\030+\005`\366e\335\"{d\331\021\336U\001D\342z\001>\262/\353\246(\276\355\006\031H\031\236dtD\266\353\005D\342Z\364$#\227\205Y%\244\273\266"
+	.string	""
+	.string	"\322][dP\237dD\001\013\263\306\244\022\322\004\212\367]\223JH\242\0068\t\251u\223\020x\333\340\223\214^\266\210T\"!\002(X\230(1$\341\204\003P\030\232P1\\\201B\350-\"Q(\276\310\f2\222H\023\024"
+	.string	""
+	.string	"~\222\021R2\004R\222x\\*\241\347x\224\321w\210\224\254"
+	.string	"\017\217HI\364\210\224<\223`\244#kL\331\024\332W\277/\353\026\213\253*#\211$j\027N\236\367\221\341\302o\213\304\252\260"
+	.ascii	"~\322\222q}\361\016% f(\262G\244\326\270\252E\366]\322\257\372"
+	.ascii	"\025^\213C\244\244\321\317\021\331\302D\326u\221&\214I%\226\005"
+	.ascii	"R\322\003\373\266DA,\336\326\347\004\230E\032*\341m%@:\266."
+	.string	"\336\025\366IV\220Q\\Y\025%<\311\b\351\312@\n\361*!\217\354\t\326\202\313\302\307%\244\211b\233\fZ\201te\230\340\342]\341\037\013\"\214\222J,\013\244+\303\004\370]\215\027^\027\371\036\331\025F#2\305\004%\336\326\302\333\242\304\004\022\2140*\222 \303\205Y%\326\310\262\200]d\212\"\353\256I\257\006\023\031|H\030\035\0350\002P\361E\301\026\221Jn\273Z\b\306P\021D4\256\304\242\n^w\005Z\341\365D\261M\2522\214\255\273\272\310\244\022\313\302\202\242\013\"\233d\002\016rY\343\205\241\027\002\030^\b\024Yx5.)-\021\211%&x!p\202\205\004p\n\257\360+,\226\200\337\325X\004\227\330\026\224\334\022H\026H\307V\206\013\367\224\220\341\302>'\260/\004\216+q\b\350\330\256(\270xW8\002\016\310\024.\210\255\261x\\\223:`\001\277\2531(\365!\202\207\320"
+	.ascii	"\030\305PQ\\\223"
+	.string	"\324\244wuM\270,|T\302e_8 \331\032\217\212\340!\013\036\030\301\356\2324z\227\340\025^\221\001&z\222Qk$\206h\215\304\"\022\205\326HT_\266\305\322\212b\233\"\002V\251\205\223H\344\t\3056\005\314\"\271+,\204b\360\300\210UjY\274K\310\366\005\353&3<\311\bi\251\005[\fQ4\266K-2\260E$\nA\b\270H\030\211\202\005\013*\\\274+\213\026Ko\320\021Yd\331\006\020\211\353\020\322\361m}R\300G\326u\227\210B\030\224\324\rT<\256JJH\023D7X4\"\025\200\264\242\340\243\204tS\220@\002\022f_\254+.`\217\310\023\360\221Ub\335\245weQ\320@C\t\244#\361\302\n\240\030\356\n\257'\210n:d\225Z\370\270\344\206 \036\365\024Y%\267\004\221Xb\202\023\215X\227\250Ek\\M\034Q\260\360ZL.Upb\353\262G\026i?"
+	.string	"\002\350@"
+	.ascii	" \304P\017B\001<(\200\007\351A(\200\b\021\005\020\200\210}\001"
+	.ascii	"\2108\331\341\005\030\206ax\370\272\254q\211\004\266\270\004"
+	.ascii	"\2670\274\022\261\303\"\n\027\357\n\357\"\022\005!v\370\266\306"
+	.ascii	"\266\305\n\257(\266I\f\3540\311\262-*\300%\374\260C\025'\330"
+	.ascii	"\341\213\264\032K8q\201\035\026Q\304@\266P\341\341\013\001V\251"
+	.ascii	"\2057\374$\243\fXxU1\004B\261E\301M\202U\020\220\311\030$\270"
+	.ascii	"I\360~_\026^U\020]\025\231\214A\002\321M_\026^]\364\004\212\024"
+	.ascii	"n\022\213\243\214b\320\305\312\272-\206k\022\216@\310\026\221"
+	.ascii	"(\254IX\205\225\226V\234o\033\243D\261M\372\024\333d\217"
+	.string	"\022\362\310\026\207\357\313\022\221nrXl\223BGd\013\037\331\027\254\233\224`\003\013\257lqxt\204d]\254\360P\306\nc=.\271\030\274\303\025^O\034\221-\274dD\256x\223HB\360\223\214\336$R\bd\253d\0026\256\350;$\"Ox\223H>\360j<\325#\322x&\031\215g\221\204Zd\331\344\212\036\366u\227\220&\212\307%\244\213T!\211,&ix]\241\264tL\237d\364\036\261\305\341\006/|d_\220\200\204<\001\303\021\371\256\254\233\236 \021\004\003i\374IBj\223\200\212$\214\253\013/\261\307\340\260Hb\b\006\322\330\223\204\324&\r\213$*\024I\024\331\027h\375Qr\327!\374\272\355\321\360\210\034\032\211\224\334\365m\213BO2\232@\211\205_\031\357O\f\266xD\001\364\242\205\211\253\020[D*\t_b\013\277-\274\302\357\320\305\273\302@ID\270\205\261\342E\246\020"
+	.ascii	"\013\257.\221\013\"\322H\\J\022}X\245\226\005K\\]\023"
+	.string	"\216\016pY\030\310d\004.\333\036\265\360\221-\242(\272+\262\005P\nI(\260oR\312\302+\274\302]\"Z`\341U\005\233B\253\324\302I\007\270\254q\251\310&\021_\"\244c\253\344\226pAl\341\025\254\261\305zd\205\236d\004"
+	.ascii	"d\013\027\304\325\330\"\2105&\225\326\267\207%\266/\330bZd\215"
+	.ascii	"-\326\267-\016\337\242\221m\217.\260E\244\222~\225\206\254\273"
+	.ascii	"\004'W\342\020\351\312@\002z]$Ll\213\254\233L\256\305u\350IF"
+	.ascii	"\357\004>\360\223\214\224`$C\274.\373\242u\213\033\336\364\005"
+	.ascii	"{\3425.\245pY\370\310\232\bb\341U\205\022\214\024\025^\260\305"
+	.ascii	"\223\003\254{d\001\371\302e\337a\221Ur\327\343\322\260ua!\330"
+	.ascii	"]\341\025H\307\226\202'\031I\340\303\306h\225\202/\214U\306P"
+	.ascii	"\022C\2625\036\275\303\024\3056Y!\205\244!\214U\306O\nI\303\240"
+	.ascii	"\024\222\222\2100\362\b?\311\250\330&K0\337\341Q\261M\246)L\024"
+	.ascii	"\346\t\263\330&O\370\330\"S$\227\212\307V\002\030z`\254\024X"
+	.ascii	"ZQl\223?\307\026\005\270D\261M\006\301D\366\350h\bv\331d\fv\b"
+	.ascii	"\033[xxD\246\320\272\310\244\"\266\210DA\006\334\276X]\023Z\370"
+	.ascii	"\270\002EplW\023\\$\274\272\354\005\0250V\031BF\226H,\301\302"
+	.ascii	"\253\373SD\nj\221I\230}\213X\245\026\026\312X\215l\261\347\302"
+	.ascii	"\320"
+	.string	"\021\331\302,\212\356\n\303E\226Pd\331#\"\030\253\214!\2200\205\244\341\210\367]\2230\220F!\031.\373\002Id\335a\322\273\272\304\237\037\"\030\371\303&e\300Am\017\322q-\302plW$\241WiX\\\331\244\325\005\022i\034\272\354\261]]x\210t\211k\206c\273\"\005\tax[\254\026F\270,ll\217,\244\2204<\266)$)\271,\\\274\300\026\221(\034Y\242\313\246`\241\001n\225\332\0230\034\333\325\004\025.\213\204\324\272,` \215\306\022I\304\343\322j\254`\310\276K\026b\254F\326\035\302Xe\f\213,\274\272H,|l/\244\320\272+{lO\200\337%7\t\036B\217\355\212$d\211\307\365Eq-\372\300KIx\t9t\2210R\311\002|\\B\022\207F#K\034b0\3020\322M\202\207\360\221m\337\343\352\302E\360\213D\266\030\036\035mwM\"jVim"
+	.ascii	"kl\217\220n\262G)\351\016\217\255R\205\"\313&\337!|d\225\340"
+	.ascii	"wi\003\305\225(-\266\311\037\366]Y\227xlYc\261\025J\276C\266"
+	.ascii	"\205W\367\350H\bn\225Z\343\220u\321&\337\341\321\321\317\321"
+	.ascii	"Q\0202\031\203\035\262/\334%\342QF\321\002[D*\rY\342\352\016"
+	.ascii	"\215\354\013\326\b\364\036\331\244\022\2228DZ\337!\274\266xA"
+	.ascii	"\364$\243\227\350\206 jxM\020]\013\033\306*\243B\361\270\266"
+	.ascii	"(\256lQ\210E2\"\223\206\260q\275Pd_\227}\301\272C#\322\205\217"
+	.ascii	"H\342\020\306*\343\002\214\325=\237d\264\244\324\206\200\223"
+	.ascii	"\220Z\343Q\221\321\210tu\022\021n\223(\214U\306\371\262K\306"
+	.ascii	"\365E\372$\243\030n\b\244\344\320\221I\326\r\001#\221n\210\236"
+	.ascii	"w\210\324\036\035\221&b\270\302\344\252DtQ\227-\266/\220n\262"
+	.ascii	"\310\306p\215k\353\262\257P\f\326\230\\:qd\\\223\204\307v\003"
+	.ascii	"<T\221V\026\310v\210\264dL\026\t\301\354\313\272\305c\333b\b"
+	.ascii	"\257\357Pi\311\205]\260\311w\202\n\254q%\na\227}ql\211n\261U"
+	.ascii	"B\217\255\322vAd\223\2101V\245\r\364\2320"
+	.string	"\256/\216\310\026^\215\310\244\313\302G\024D\027\303\313\262.\022{\2025\"\035K(\255&^$\217,\024\215\310\244\227u\223X\260\360\372\242\205\211%\330\"\022\005\267]\213\216-<\024\200\b\"\373.\rc\254J\303\030nO\214\245u\030cU\002z]\244\353\262D)\314\276GG\310\0366)\003\026\312pt\204\204\227\210\025\274m\214u\210\264\324\202-\302K\311c\213\201M\312\200\207\354\213\026^_\264.[\324\340\"a\342z4D\302K\353\020\351\330&\301H\244\322;$\272EEd\353\262\311\341Q\3228d\225V\367hHt\337a\373\276n\206b;\204\333\343\222\317\bc\f\367\005\202\337\365hX\\Z[\f\337\245\026\357\017<\004\001>\266K\252{|\2071\334!\373.\r\217^\227\b\004\017G\220\200\217\355\322v\361\256J\303\327\310\036\217k\022q\310\026[\327e_ \207\311WI\002x("
+	.string	"\021\360\261U/B\204\211\r\020h\200\t\233h\304\272Hb\b\342Q\210c\273*\205 \272o\b\243\013F$r\204!\372\277\247G0\017H\253\215\2229=<\336\374h\371\250\313\321\263#\250Fe\013#\007\256gK\275\023\346I2\327\247Cer\246\315r\255G+\bW\346\311\322K\216\254$q\246X\221q\243\303\201\265\025\230\246\254\002\330\223\231:W=Vty\366\236\2626\205H\324\360L\311\332\206\215\036*\256"
+	.ascii	"0\261\252cE\3253uv\244G\217\236\251\036)(P\320\250I\263\212\252"
+	.ascii	"0\351\352\271"
+	.string	"\221}T\360\262\323\263\343\322\363\324\363\324\023\345\303\303^\336\330_OT\017\r?1v_zh\364\3140\262#O\0245,E\363\313C\325\003\205\226\331\301q%M\326?Qe\003\002\3664uy\340$\017\315\252\247\251\207)\265s\246v\244\207\251'\276\200\331\f\274\300T\307\230\2258\032\201\232\210\2062u\003K\326?\361d+\335\360Pm\371Sy\370\210\322!v\006G\345\027\314jr\243j\312\235\276:fr\240(\271\304q\\Ta\212\322\312\233\254\363\362\204|J\362\362\314\360\355\201\361\021'\331\023\352\245p\003\325W'\255\023B\005\342\341\252\243\275\244XR\342\200e\375\023D\366/\244\223\207\003\r)\267e\372F\030EJ\256m\316\216#\327\346\004\212\034!\336\337\220%d~\220D\361\230\213#\274\323B3'\217\222\016\240\0260p\204o\222\264A\022$\353\236\031C\360\364\251\271\032\241\233\f\236"
+	.string	"\301\330\226n\332"
+	.string	"\251\003\330\245\r\233`\336W\035\2365)\035\037\2505'`k\264\035uI\0352y<\316\234\021\242\t\343`\214\022\260\fM]\306\241VfH\035]z\307\326\205\310\\\332#8EI\034e\016uB\345\200\351\241$\353\237\270\261\307\214\021\312\375\310@\211\323\027\232PN\030\307#\017\02509\213`\250D\004\023\325\346S\272 \2062!\344\230r\n\rM\215\202"
+	.string	"\003\026"
+	.string	"0P4\032\220\n\306al\024"
+	.string	"\013Z\316\244zF\236\354QP*\245\020\210\f"
+	.string	""
+	.string	""
+	.string	"\004\202\240\001\301$\021\002\033\bT\335/'\335\271NdyF\251\2153\252#zE\005\0207+\031\314\237\024hJ\037e\355\251\305\276\200\325P\271]\2108\251T\254\355\212\206{\300\333\252\304\323Z\346\205\225\002\310n\311\343\303\021I\366\230w\345\305\\\362\204\301M*\332EaT"
+	.string	"\315\211\"\355\254\244a\345\356"
+	.ascii	"f\273+\246\376\005\270\233<\306\205\034O\021<\3664\304\374\201"
+	.ascii	"V\320}\341\024\273H\275\243\325\200)\tO\003\0172\033\023&\366"
+	.ascii	"Q\031\017Hk\346I\321\022g\345rZzGYF\f)%\fRdj\023\256k\270\007"
+	.ascii	"\270\303\003\273\261\340\\\t_\334)\360\237\302'\360\301\333\221"
+	.ascii	"\310y\264K\323\233\324D\255\361F"
+	.string	"i\243\030]\354\376[\270M \210}\244+y\360/[R\201\003\236\352\337\215\260\007\003\334@EbT\210\006B\201\275\335\346\350Of&\316\035\366\207M#\336\206\310\272\020\210:\005 P^\256\b=hZ+N\306\346\273no\330\325\300#\037\205C\322\271\300\251m@\252\3569\360z\n\204g\025\316K\245\226\371\376?c\371\20631\031\216\177\312\343\217\257\037\343\007\"r\013\357\221\020\307\200E!=[X,\"\025\224oAj\301W:\331L\237\020\227\362\314\\rV\314\273\2759e\216\013\210\2420\033\201\331(\037\374"
+	.string	"\002\336\202\260 \356g2\200\272\264V\240!\027$S\231\333\033\004\315\357\210V~(\333\002s\241q\215\024\272.\227\306(v\301\330<.=\210]C$\032\322i\365\257\3008\001\305Y\002\335Q\030\201\366\302\177\013Q\275Q\277\200R\003\205\004\356G\034\354\3359m\345"
+	.string	"x\017\315\016\352\003\033"
+	.ascii	"\001\033\221\f\300\247\335x\223\323\331\243XK\315\235\337\301"
+	.ascii	"J\217\026Kch\206<\0029\022=\340\005\304\354\302\246\246\216\212"
+	.ascii	"%\002:\n\340\023!\0161\304\221\260'\033\033\215\302\322\0277"
+	.ascii	"\026\302K\200\036X\243nR\312\205D\341\222E\f\rK\333QH\024)SB"
+	.ascii	"\237\203\007\261\310\004')Xz\372\274\202\234\274H#\220\302[\335"
+	.ascii	"\363\377 \214N6dQ\226M\033\252\311qf\f\240\245\202\342\024\t"
+	.ascii	"\022\204\210\351(C\325\250H]KW\223\033\363\277\217\026\235_\346"
+	.ascii	"G@\205\327\226\240\341\343\303)]\275\303\323\346\317\033\n\254"
+	.ascii	"\325\336\177\344\242\0361\244\005\3232\366\370\204g/A\327\307"
+	.ascii	"B=\211\272)\214I=_\372\204%\353\277\364 *\203\177\263C\002R\305"
+	.ascii	"\250\310\034h)\n\331PI\004\362\364\274n\215\300&Em\222\326Me"
+	.ascii	"\2353C2\271 \220\235d=\367\033\311\216\264\333}O7f\t\315\377"
+	.ascii	"\263f\312\311\031~-p\210\017\226\026\216\255q*\267\315\331\344"
+	.ascii	"\020\200\312\r@i\363g\31119\376\005\372'd\367\034\017i\326/w"
+	.ascii	",\354\375\004\032nw\320\032:\206\t\212\211mB\216X&\001\310\352"
+	.ascii	"\n\245o(\265\347\340\tD\013|\235\300\205\245\177QA/\007Lz6/"
+	.string	"\331\033\002\335\253\004\004\026\225\006\363n\240\004\032R\336\274q\0132-\357K\315\001\276!\007\253\242\255\357f\223\247\020\231I\b\236T\206Uc)\034\237\376\350_\352J\362\334svW$\314\"\225\036\201\271hf\343\2309h\007\357\353\037\205\202B\006\024\210;\322\217#f\366\023\rX\305\371\004\227U0\207\326P\271X\374\345]\270\357\227\233\313\357\263\2446~\374\321\377\244\377e\261#?~\325\3438$',*C\366\f\002\bU\341=\200~P\355X\302\362\217\231\305\363\3534\034\323\343W[\031JV\2565a\240%!ZYV\354x\001\310\2161\215\362U\2110H\254\025z\033(>\262\311\211\303AzQ\326\033#\033@\266\"\203\225\227)s[\243E\305\017O\232E\372\240\364\344\024\210\337\267\234\343\033`\222Om8\016`0Lr\216B\243\302Q-2\2025\243\202\241\224\250&P|\306@5U"
+	.string	"<H\027v8\2532\327;U\016\007[\314\017\253)Q7\245!<\257pYJW\301p\003P\236*U\0300\363\365\021\2774\355\301\366\345'\334\221\264\340Z\306I\236T\204\335\007\217E\031\177\312\213\277\245\274\343\230\032\001\242\240\326\225I! \252\345\351W\b\304\f\324\277\206F\205qE<)\017\345\337\3063=\t\240\345"
+	.ascii	"\206&\023\325S\336\333r]j2\345\242\226"
+	.string	"\210\002\340\320`\031\252\332y|\036H\206\222\025\020P\365\256\2761\213h\003\304\024\027\016$e\277*\301 \361 0't\007\335\366\244\337_u\310\266\312l@\366\345\252^\f0\rGs=9\344\234\007e\314\033\250\225\301\244Ai\034u\306\3007\026da,\241\364\342\330\334t&\026\n\377\303wFj\217=q\257y\037\203\275d\201\301\226cP\273@\n\230\263\026R\006rB$\216uEU\201\347~\221m\355\320c@\311\037\002\001\031\0069\356\260\325\312\246\325\310\2046@\212\004k4\312B\333\346\227B\336?\223\035=\023Y\240%\013$&)\364H\306\300\211\242%\350\2502\3026\244\276+\213\340\006\304\n\212\264\256g\301\351\256\206\223.\021\354\021\262!\256\215\021\363M\0218\366\346\237\353\215\317\253m\316TI\003\260\245\360\027\201\256\017\270\366\213z\326}\360o\367\032\t\353\313\300\241]_X\032\215"
+	.string	"\312&\375Q\036\213\305a\230"
+	.string	"\003\037r\230m\337\212\344\360\341s`\322\031%To\335\2354>\210d\210:\355^3 /\254\345\bh\236`\372~T\333\260\342\016\276\025\004'\271#\020\266i\177oc\004t\030\244\332Lr\324\031\204#\324\214C\2419\315\226\r\210Jy#\210$LBj|\034\324\345b7\203\312"
+	.string	"\225 \270\321\3474\3746\013\2512c\373 \364\227\343v*n0\336\260\005\314T\240%9\035&\322\373\277{[\255*H\216l\300T\206\255\220\320\205]\267\203\365\006\251\240\237\360\244%\247\367e\005kI\353\345\3722\344\3522\357\320o\004\314\242\304\027\022\376*\224\023\237)\214\361"
+	.ascii	"y\355\352\311k~\245\326\0026\302\031\336`\215TS\301c\354B\026"
+	.ascii	"\315\005\327>\033\031\263po?\320/\205\177\003UM\007\004VB\307"
+	.ascii	"Z1\337\310&C \216\206\236\251\b#?\303\365\376?\255R\333\2275"
+	.ascii	"\222\223\024\265\270\266\020\271\375j\t\025A\337rH\232e\271#"
+	.ascii	"\246\325\025\243\304\\n6C\0018\356\212*t>\rvA\201\344\325\254"
+	.ascii	"S\245\3515d\0213x53(KO\266 \314i\233\024@=\231\212\377\016\356"
+	.ascii	"\037\334a\310b\357\037\240sS|m\375\243<\2730\374\200\266+\250"
+	.ascii	"\346\005\270\377\275-4y\212\246Rw\355G\036\371\ne\312MS\214J"
+	.ascii	"\232o\313\2250\306W\227\"\226D$\324\301(\211n\307Y\246>\240\263"
+	.ascii	"\3517\0325\313\037}\177\271\201"
+	.string	"\233\006\365_\321\231\002\310\350@\006\265\267QL}\250\343`\225J\013\342\250\021\273\211]\331\225\256R\270B\240\250\205\377\305\2268b\242\2572\207u\371\377n5\252\3716\343/\323\360%rI^;\236\324t\204a\224\207]\021\327\356\277\326~\272\232\332\227KGl\027Z9\305\340\372\272\264 \340\373\352kx\017\252\3173\302\215>#\b\b4\341\271T\0308\363\305|\250s\230\226\307\013\004\224\267\001\310\325H\356\257\330\030\312\260m \034Vuq\250\341\247\303B\247\263\032\361,;\360\177\005hQ\025\375\261J*X`\375fT\026c\341\254~\203\263\263I/\264=\034\020k\354s\002\024\262uv\236\227D\013\361O]\t\347@\325\356N\365\002$PC\335\030\377\254!\006Q6#\253ID(\365\204M\312\017\230-\t\211\347c\313^\023\237B\327jn\026\257\376\367i\007S\257C\275\241\361\354Y\232\371"
+	.ascii	"\246\325K\"\320w\214\021\016\235\210E9\263\213|{$\213\346\025"
+	.ascii	"\304L\277\246@\021\210q\2032^\304 K\360\241\210\346c&\215_\325"
+	.ascii	"\2242O\217\005\344kad\345\016\252\201|\024\234\250J\260\264m"
+	.ascii	"%\275m\226\215.\217;\205\031\201\031\331D\372\204\023\246bd\270"
+	.ascii	"J\302<-\212\352*\225,z\274\177s"
+	.string	"\bw\327\201z\300l\277\271\316n\027_\022\231\302\340\003\301\255o\251|1\211X\2730\016\211\362\3423\322\255\263\375A\345\223\317\316%\227\032\255\325\310\233Mn\236\3730}:_\356\210\240\026\024\202\243\rG\t\"_\210\2701\352\300\255\326X\274\356I\375\346`\223T\271\034A\321\370\372\337\374\020\361n\332\217\337\234\305\241S\004ej\337\2221\303\267i\2079\350\232\240\205\215\225\257:x6cy\20688\373Wu\021\215\270\376\245<4s\303\333\006:\211[\313\325\365"
+	.string	"\204\177F\005\001\310\370\177&e\027v\013\215?\341fF\327\271D%\332\002\250\241\030\342I/\3228~v\022\033\215\372x\340\201\366w"
+	.ascii	"\347]a>\315N\300\372mR\215\032\025\221O9\245\241\031\324z\305"
+	.ascii	"*1\227K\365\004_8\372\256d:-.\246\370\0039\245\234\323qw\304"
+	.ascii	"\337=V\347\\\226\274n\202r\b\030gd>r\302z\375nb\373\212\t\215"
+	.ascii	"\202\316\367\332\273\377\221\333J\222\220\361\317Q\253\007\006"
+	.ascii	"\262P\"\202Y\210\024h&\277\321\377|(\242\371\003LF"
+	.string	"\240|\bF\377\375(`\227\303LtD\371G\254\034\352\247^#\260#\203\270o\222[\342\205\rR\215\376\024\322\006\267V\034U\347\035C\202\327\255\322\246(\274\200aR?\302<;M@O\022\340\013(\302\257()/\376\240\3764R\212\024;Sx\324\003'\031\216\220\214\205\024#\017\331;\375\353\f\027\312\312\316\324\207zS\362\205\3652\321\2068\035~%*\001\313\261\315\374\002\nhE\277\306\332\273\021\370%\252\303(q\301\256\324`\242pm\0242\253O\262\363\022]G\321\214QX\306\233\333=u\233\021\270]\212\205]>\260N\271\302\241\265pzP1\241\177p\263\370$\231\270\032S\\\231Lqb2\336`\340\2267F\310\200u\354\2549\031qa\302~V\343\360\374\0022k^T\026\344\\\312T\215\345\325\257\002\232\225\344\232k\316\330c\004\210\022\025u\302\021\301U\246B\236\315\207\265O\2378"
+	.string	"\340\246$\277\026]\350[\310\303\007\2634Y\274\236\275zJ\274\222Z\366\320\310\203\3626|\222\2042\325\2205\327\006\253\343.jn<\317l\310\275\311(\364\006\345\002\2567\007\354\211\366\231\371\240U\230\202\305a\300\345\370\367d{\3035"
+	.string	"x\033\363!"
+	.string	"\023\346\037\f\363\366\276\214\276\254\177\375\f%\r\205\227M\316\325I{4"
+	.ascii	"\225\327^2\2129\223\264\001\\\215\013\221\337\270\02760e\215"
+	.ascii	"a\341\266\tU\236PE\335\347\223\200NfGWm2\371\201\245\2032\304"
+	.ascii	"\313p\250\025\245\203\310\204\262{)I\35431\024\030~\233\033D"
+	.ascii	"\275\354@\310\344\264lo\271\202\335)}\007\232\211\330\325\254"
+	.ascii	"t\304\255\320B\273\272\346bT9\026)\236V\221\323h\200C\220\017"
+	.ascii	"\030\363\272\237\267\300h\213ob\335>\245\016A\330Pv&\022\306"
+	.ascii	"\256e\b\201Jh\227\f&\340!\323\007\303*\213@(H@\206\375\230\260"
+	.ascii	"\233\206Oa\332TE+K\027\304\274\370\230\277S\372\266<'Y\254\217"
+	.ascii	"\007f\034Q\233\310\017 0m\030\243T@\336`t\324&\356\202L\017G"
+	.ascii	"\270\375\r\307\257\310\271G(V\360\216\355\f\\\332q \221\013\026"
+	.ascii	"\r\231\214\300\227\273\360\244\217~\246:\b0b\203bn\244(\226\325"
+	.ascii	"\273\037\350\317\327_\252P\211.?\272\273\270!\206\216g\276\226"
+	.ascii	"T\276\255\332G\226\366c\372Sy\361Q\251r\271\303\037\311I\030"
+	.ascii	"\357)\023<J\215\337T\\5\200\024Li\214{\321\250\334\223\004\345"
+	.ascii	"\215\336P\342}\256=\375\315\212\005Y3\333\314\341\001\f\266:"
+	.ascii	"\374\032\207\232\200P\027\031\260\210+\256\317G\"\215Z\202\032"
+	.ascii	"\t\207\002P\013\024\035kX\235q\001\303[\205\263\361]e~\363$\232"
+	.ascii	"\035\032U\220N\377h\255\232\316\216\365Q\315b\352i\024\250$\257"
+	.ascii	">#\267\306\2008\343\3053\0171a`n.\353\261\205\323\021\257\232"
+	.ascii	"\3224\240\263\375*\350e#\200\177^\250\367\354\367\376p\312@r"
+	.ascii	"\366*\311\233{a\003\023\023\266\004\304\354D\355&\260L!@f\366"
+	.ascii	"x\235|9\241\355\207\265H\3077,\025:\362K%\216\225\f\337\370\266"
+	.ascii	"O\322\255\263\006\356\372\f\217S\314QX2\3168\242\221\225\344"
+	.ascii	"\234\213*;\312a\214\350\233"
+	.string	"6\033\027\374\331D\341\227\335\236y$rx$\005x\330L\364T\234\375!\026i\276\f\254\0133\020\222G\253g\207\263\177\221KwQO\343L\037\212:O\211\221\213Z\031\271\351^\004\263e\276\331A?\353L\314\177\220\204\024\346.\017\207\272\275\352\202>\360Y\022\203\331\373R6R\375\376L\214\260\366u^\220&\270UOIuO\357?\250\320\306$(\362\323\342\fx\26759q\177\307H\334J\034\305\205\372F\357\365<U\030\356k\0268\255V4KP!\332\206M`\270}\225(J<\f\323\265\236\006\355\007\272=\312\345\354\242a3^\017\274{\3033D%\206\265Ao\032\262\234V\340;HS\277\356Ny[u\302\273'e=\352\253q\373Q\207ylg\253\373\3222\353\360\2224{\201!\273\202\310(\034\230\004\315\003p\024%{\235%R\300P>\021\315+\224\226n,\251\201\3347\332\227\206"
+	.ascii	";b\037V\030:\313P\273)\024\265\004\324O\bt\371\351\327H\"\364"
+	.ascii	",\260\2452\017\306W\205\251\r\262\3470\371\013\323\376\025\310"
+	.ascii	"X\370\333\270[D\363r.v\204\215\021V\364\336\333C\267\305\031"
+	.ascii	"\030\017\311\307\0225\240\240\037},Bd\276\367'\350\004\030\017"
+	.ascii	"Q\2034\223\261k\2507@\257\177\260\341\023\320V\013\367\320\217"
+	.ascii	"k\304#\n\351\232\367\363\241L\214E\263\200r\304\303\263\246\032"
+	.ascii	"\374\244{\335\211\\$m\036\177u"
+	.string	"\316n\023\037\332\205\327\017\031x2tq\312\365\303\230U\202\332\267\r\301(\306\206:\347\372\275\207`0\344\242G9\243;\310\321\240BB\r\fbB\b\225S6^p\220\006\036\373\371\337\214\260\240\321\235ff\275\365\247\351H\244\275\017\222]g&\267x#U^\"\213g\235\344\332\245\234\211\013Q\274\257\206\326\253\3706rHC\257\020V\220\314:\255\031\2442\b}\216g\201\252\341#r\016<\r\332\272\230\"\367\024\323\205yb\225\311\3247LhYN\032\bbwq\321\204\017Z(\246\366Y,X\260\004\234\236\323\005x!\367>(5\215\006\231\326\324\304f\221\006<k\034\347\351\303j\225^~0\210(\254\020\240t\2470_\205\023*CI\024\ty\377#*\374\237\225w\023.\035\034\337\036Z\262\260\252m@%y\346\366}\376\201\272@9JL\353\321\023G[\204L\230\364\030\224\311\374vC\352"
+	.ascii	"\345n9\312\b\342D\255\230\034u2i?\244\361\275\n)\213\310\264"
+	.ascii	"\207d\377M\004B\307&aR\242\374u\303\027#\231Eh\254\234\260\204"
+	.ascii	"\275\360\026\337\220\370\375\335Z Sumli\b\027\245\271h\322\204"
+	.ascii	"|\025\323\234\274Lh\021\262N\037l\250\306\210\002\316\220\231"
+	.ascii	"\022\016s%\206\243\222:\331\205jZ\333\255nI\355\2323g\216[X^"
+	.ascii	"<\213[\230\006\"\017X\365\204a\243i\321\270\017\235q\216[;\313"
+	.ascii	"\bq\304\353\026\017\016OK\242\340\201\254\017\313Xy\303]\342"
+	.ascii	"\344A\203\360\331\350\242Ch7\301\361b\352\371X\336\017\243j\033"
+	.ascii	"\220\023^\255&\217\256\250\235\0259\334"
+	.ascii	"R\027pD>x\250\326\365\032$m\373kt\3512\344\253\024m"
+	.string	"\204\311\307\206\002_\336\242HwA\302\244HKN\345\372eI\035\361\222\214\251\200/\324\2361=\016\022R\262\005\226\r\306\263\006\271\336\347\027c\312\204>\342\314@(Z\355\032\312\246\320\t\205F\307\220?\302\351\007\202NwX\375t\335%\226zZ\007\255\337\244\214\005\322\"\300\362\372\227\211\034\311\270\315|t\372|\254\254\325\210\265\244G\340\311[\031,Fm\r\016\"\310Pi\017\307\312$\034\200\227\312\254\367'/\214\271\344\221\321\271\352O\021R{r^\242zd\2318/\327\372\242\321\021\241\345r<\330\241\205*\027\336-mk\032 \226Z\177\036\211\036\"Z\233\363\316\244\bJ\354l\352 \273i\237\301\200\t\260z|\274Jn\370{\232\002=\366\372\016\373&\034\322+z\245\003\242y\270\312\021!/!, H\270-\241\302T\337VOu1\332\252\245%x.\205\374\033`\344j\344\177u\333\270\243"
+	.string	"\2643\227\005\302>\016\350\2361\225s\376\345v\265\345\b8+_}M\035\313\304M\326m(\0356%-\"C\222\350h\213\207\322\006\026\255{\317\377\0058\275\343\023;\203D\030\261\205\321\205`\033^\241y\374z\201\275\364\320\220&\317\277k\301\212\311u|\3468\"\377\3755\277}ov\311M:\243,\271>\302wU1\024nG\2437G\206\037\f\342\356\002\320\rD\025,O#C+\356}\263\202\354(\177\255"
+	.ascii	"w\306T\263b\203\030\003\305\230\206\026\335\0050\232\274k\037"
+	.ascii	"\322{~\354\266\217d'\215\023\266\305\037\351\223\002M\032N\263"
+	.ascii	"N\375\264r\250\307^k\211:\310\354\342\001@\343\305\035\277|\376"
+	.ascii	"\354&\361)Q\034\177\317\371\242e@\017\256S\224\333\351\354D\206"
+	.ascii	"\375\370\247\210\357\325_v\201\035\035\215|[\222\310!\2466\316"
+	.ascii	"YZ\335\200~\221\233\217\220<\373\225\267\263U\246\241\324\347"
+	.ascii	"\324\347a\001\tk\246Yu\352)\206l\021\323\024\026;:&\212(\262"
+	.ascii	"\024\345!\230])\270\337\031\"a4\372\334F\002\236*\320\234\033"
+	.ascii	"[\356\227\227\271\224\226\026\030\254(N\266P\221\276A\222|u8"
+	.ascii	"5\356\024[s\267e\243\0266\375\3018\033\360\"\2770\335\244\263"
+	.ascii	"\233\247O\321\001\034%\262\2406\344\023\252\016\237\315\235\335"
+	.ascii	"\326\3267*\367M\rY-?\316P\254\200\301\255\004W\224w\030\301\326"
+	.ascii	"\240Z\302\365\330\370\257\222\355\3011\222\212\371[G\212\353"
+	.ascii	"\221\335\340\211\375\r,\222\363j\216\267Qt(\334,\001\333vj\347"
+	.ascii	"\340\207\356\227\243v\335\377%h\003\255p"
+	.string	"\017\301|\222~w\327:b\223\261\017\201m?\260\372\033\250\267\364\250\303`6\002\342|\200\373V\b\275\b\226)\021\362\001\370\314\017\214\306.\206\357`{\"KX\341j>\261\343\325\007\232Y_]\210I\227\204\340=\340od3t\351X\017\201\346}D\333\221\247}\024\365\026\236\322`\2723\342\2713\326\341\336\234_K\253_\021\3353\006\235\265\252\037\027\310-\201_\332>X\202#<\3563\372\3014\315hMS]G\353\234\2450\026\344 2\374\207\226\365\3664\201\227.S\307\223\037 \2567\312\374\007\223&\367}eY\036\350F)\347\252\222_\233\247\305\2350\233\347kl\020'\022cx\013jK\320<V^\303*\321\177\004\351\255\255\231\2408\205\037VHa\004M\031\320\206\2137\0318\271$>\263\212\245E|m\271sK\335\377\366\224\023\256\236.\305o\246z\361Z\353\357\327\003\242\363\260\337a"
+	.string	"\323\216n\202\347U\227\317o\360\311P\274s\n|\317\361\355\376K\203=\276\342\221\255\376\223p\213\224_\210\256\177"
+	.ascii	"\356\027\206\377\314\022~\204\345'\177\307&\267C\224\330Up\217"
+	.ascii	"\261\334\226#3\f\3617\316|\267\r\266q!\351\323Xm\206\034\020"
+	.ascii	"\324\322\030\270/\230\226\241\354\362\206\177\3439>\376\333\234"
+	.ascii	"\236c\347F}\300\351\357x\374\315H\275Q=\246\262\321aJ\367?X\303"
+	.ascii	"q\340a\357\374\013\314R\007\206\316a\255\315\fu\202\311\037\215"
+	.ascii	"\032\357)\371\255\241!\350=kZ\215\026\245\327+\356\366\264'\005"
+	.ascii	"{\025\301\026\226\246\303\240\036\204\257r\350\267M\372C\237"
+	.ascii	"\365\375\207\3242\347}z8\362\365\036\364\327'|\351\f\r\301>6"
+	.ascii	"\230\207\241\365\263\f\276V\363\007X\313\306Y\254\352K@/jK=\321"
+	.ascii	"\3374\033\031\344\"\315\370\004\355\345p\376\b\007\314\316{\317"
+	.ascii	"&\352\327\003\3665\241\335g\357\241\253\237\324\307\335\003\024"
+	.ascii	"\304\263\264\233\341nT;\256\340;\370\362FBge<\340\233\024\366"
+	.ascii	"\247\361\032\365\\\\\353\352\223\007T\244\337\2579\332n\262\267"
+	.ascii	"\177\302>W\376\365\0073\326QO}\277\030\036\241\330Rj\313\237"
+	.ascii	"6\226K2\343\037\202=3\347|\306\3678q\335\355\332\267\254B\376"
+	.ascii	"\231\207\237\216\203g|\277F\375\372\"\017l\036\203\245=\317\270"
+	.ascii	"\310L\327\\\257\335\017\263\222\335\222H/\2145&\376\257t1\277"
+	.ascii	"9X\323\355\277\356`\277\235\363\016\306\232\260\353\344YAxQ\343"
+	.ascii	"\003\317\205\332\276v\233\247u\030mvW\260\270\255\343`S\277\035"
+	.ascii	"\336\345u~p\037\251\336\352!\200\251\302l6l\035\330tP\353\201"
+	.ascii	"\353\255pa^\230\245\271\276!g'\301\016]\377\271\362\213T?\253"
+	.ascii	"\351\221\315\005\206|\322\260u\233\311k|\017\237'\022S\225w\365"
+	.ascii	"\\\214~{\373\201C?\r\rr\177<,\275i\025|\262v\310\200=\021\257"
+	.ascii	"K\371\256y\247\375\371}\370B{h/\276\377=\316\360|\332\303I\277"
+	.ascii	"\363\246\n7\237\207\367\017"
+	.text
+	.section	.gnu.lto_.symtab.5590fa06429a361c,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"canUseLaunchControl"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"areSticksActive"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.string	"calculateThrottlePercent"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"calculateThrottlePercentAbs"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\003"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\003"
+	.string	""
+	.string	"taskGyroSample"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"gyroFilterReady"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"pidLoopReady"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"taskFiltering"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"getLastDisarmTimeUs"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"throttleCorrectionConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"osdLaunchControlModeNames"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"isUpright"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"compassIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"gyroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\004"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\004"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\004"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\004"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\004"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\004"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\004"
+	.string	""
+	.string	"isMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\004"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\004"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\004"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\004"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\004"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\004"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\004"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\004"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\004"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\004"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\004"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\004"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\004"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\004"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\004"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\004"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\004"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\004"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\004"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\004"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\004"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\004"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\004"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\004"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\004"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\004"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\004"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\004"
+	.string	""
+	.string	"updateRcRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\005"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\005"
+	.string	""
+	.string	"blackboxGyroCaptureSample"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\005"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\005"
+	.string	""
+	.string	"gyroFiltering"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\005"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5590fa06429a361c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,349 @@
+	.file	"dispatch.c"
+	.section	.gnu.lto_.profile.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375 r\305\002"
+	.string	"\364\003f"
+	.string	"\006"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\236\376\250\313\b\003\200\276\204\276\004\f\002\001\002\002\002\003\002\002\002\004\002\004\002"
+	.string	"\002\002\002\005\004\005\255\302\354\351\001\016\004\002\004"
+	.string	"\t"
+	.string	" `%"
+	.ascii	"T\004D\005\340y6U\273\275\340\200f\3030h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375 *\365"
+	.string	""
+	.string	"\240\036"
+	.string	"\004"
+	.string	""
+	.string	"\003\002"
+	.string	"\001\003\001\001"
+	.string	"\001\005\002\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	">I\327\fg\003X"
+	.text
+	.section	.gnu.lto_.inline.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375 \264\225\003"
+	.string	"R\006\027$\200K\322\001+\255px\001\201\b\r\263\206,\342c\353^$\243I\225G\320\004=\374/\350\242\244\221-w\n\377\007P\202yL"
+	.string	"\277\272iO\304\320?\365\356\276\205MC\271\020v>8\356O\200\026\351\023\310\032\017+(\260b\3110\006c\377{UzD\333?\205\231\231\350\321\220\007"
+	.string	"\374CQ"
+	.ascii	"O`IG\021\311\"\257K\250\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375 7\245\001"
+	.string	"\324\002+"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\003\001\001\003\177\002\007\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\177 \005\002\001\001\017\177\002\002\177\002\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\003\232\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375 \272\005\003"
+	.string	"b\304\f\025\260%\351\200\035\rs\220$I\022\352T4B6i\255\221$S\236c\221-k\205!Z9\267\250py\335\317w\304\316\354\310\303\362\020\330\360\3213\020\020\021"
+	.string	"T\025"
+	.ascii	"+&0\033\003\025\226B0\254\033\200h\363\205\035;\213,\330a[~\360"
+	.ascii	"\\\363MD\230\307v\346\200m\033h\003"
+	.text
+	.section	.gnu.lto_.lto.48e88d0711e88036,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dispatchIsEnabled.23.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375 \340M\006"
+	.string	"\242\313+3Pm\222\016\244\204\265`\316 \212\022\227\004  kk.\270k\2678Z\273\333ag\367t!c\243m33\3136Q\274(\215\034\364j/6\315\356-SS\231\007\312\243\341t6\f\215rh\021\033\rD\243\254N\313\020\\q\032\254\346\251*\253a\262,\222\016\013D8\361\375(\310u9\226\370\\\261N\367\003\320\351\360\222!\272\322g\241C\215\257%\221\364\337\207\027\024\201\223\314\213\322J\226L$\035?\3501'(\200\276\006(\320d\244BD%3k\270\321\253w\335z\324 $\005\033\205z\001\013\231\371a#\214\216\375\017~\204\337\"\b"
+	.ascii	"2\003\316:#e\b\3055\321-\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_dispatchEnable.24.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375 \343]\006"
+	.string	"\202K,4PM\324\001\244\034\360\"\346\362\210XT\246\275\245w\270\211"
+	.string	"\b\271\250H\fk\373\261i8a\217;\200\231i3\246?\334tf\177^g\222\377\337\310\337;\245\256\221A\305\244\352\232\006h-\240\b\223t@\253u\321(c\252\"\260(FQ\026\205\304\375\f\001D\222\220n*\370\317\036\337\342\027\231/\341\004M\376\273\343k\317\035\351\361\361P!\322\311\321\02699!\354Ov\206\366\024\3602.\033\273\rc\311v8\032\023\266\017y\263A0\013\026\016\017cdw\351\214\370v\271\371\247x\345\003\271KJ\300\356Z~\240\303=o[c{c\233!\b"
+	.ascii	"3\001\0078\003R|\241k8V\b\343e\210p9\026\355$\003"
+	.text
+	.section	.gnu.lto_dispatchProcess.25.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375` \002}\022"
+	.string	"\006!xH\300\224Q:h\243\344\016\0011v\220\241\235\267>\253j\346\321\257Y \232\260\202(Fq\361{0\244\314\024\372\267\341=\300~\361\347\364\364\007\357_I0\334v\237\253\312t\220'\323!EZ\323\205F\201\221O\310\2262\245a"
+	.string	"\\"
+	.string	"g"
+	.ascii	"\b\300{'_}\367\344\003|\367l\377\030\240!\205\243\346\250\310"
+	.ascii	"\2343\\\022\366t\366\317\223\2533\177\350*\240\"&\335(\363\317"
+	.ascii	"d\244!\272n\030k\352\245\300\271\224\f\202~J\034w\275\031g\344"
+	.ascii	"\342r4P#\215\356\211\276\362\2511\351F\234\353\251\301\234\323"
+	.ascii	"j3~\270O\267=\263\r\301\326\007\001\307]\325d\013\021$D\323\335"
+	.ascii	".5\341t\273:\366\255\246O\321a\303\204\327f\237\324\251U\203"
+	.ascii	"\027\372O\237Zz\352\225j]\365K2\324\344V\2739;\354\220\314\034"
+	.ascii	"\236R\217Ot#\230\027\331\200\017\3567\033\005c\243\356\035e\373"
+	.ascii	"j\037\350A\263\013\305\030\300\234#\206b\314yS\340\273\227\001"
+	.ascii	"t\361\263U\236$\202\002\026\260\370\031\242\353\2778\214\230"
+	.ascii	"\317c\326\212\336"
+	.string	"fe\207M\020Z\353:\f \250\233`\205\221\026 l5\244+|\251\337\344\210\020\262tcF\217\030\334\324\236\210\324$\371\236\026\334\033]\252\030}p\310!\241\250\351\316\266\353\271\030\023\036s\316\024\037\351\302\353\300\016\317=?\366\335\373\006fA\211Yh\311^\302\226\227\313\365\022\013\260\\\255\b\262\026\026\f\366\"\242,\242\260\2102\025\227XkB(R\b[Z*\256P\204\305B\024\002~\271\260`\241\354\365\202\205\250\033\355k\033\272\354\361`\004\bmk'\276\3259\272\\\007=f\310M\362\2511\271\310\241\351\356r\3169=\225\312\365\256OfV\306\266\204+\275\224\354\254\002. \200\002\221\262;\007\223d0\f\254;\376\r\264&B\326L\315\r`p\033\210\361\214\fie\353\215\321\227\201h0\004-\3275\"ob\027wB\220\265W\331\013k\313\357\373\360M\350\262\221\262\005\034\314t\003\231"
+	.ascii	"\032\345\"\256\b\350\027Z\032e\026\340\216K\244\3563sl+-\r+\264"
+	.ascii	"?\223\361\361w\264\203kC\303tu2"
+	.text
+	.section	.gnu.lto_dispatchAdd.26.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375`\205\003%\032"
+	.string	"\026o\247I\260\226Q:\025 \306\325\030Q\327|\025i.G#\333\3002\200\207\274\350-R5m\t\264\034\n\246\n\035\275\321\207\354\250\233\021/\263\317\257\333<\207\030\363\337\240\376Q\367\227\230P\377\324\257\r=\261\207k\021B\366\226;\311\215"
+	.string	"\213"
+	.string	"\225"
+	.string	"\273\023x \267'\255\222\005\320-C\312\251\273\035,\r\371\252\200~\356\336\307\217nG\372\271\253\233\210\210S7\320\301. _\027x\031\361\225<\001\361uo\273U\f\220\020\320E\267d\325\335%\323X:o\037\305J\231\234\267}\017\350#\213\213\254^nV\312IB\250V\257\004\215pdd\203\304\244\001\212\202\316d\320I\312@(*\350PR\370\250\314\223\031T.\374\344\365ts\216\022\272{\347\256\247\342\013\340\273\233bw7\354\362.B\2719\\\030\236L\253tW\2709\334"
+	.ascii	"s\027\2076\277;_x\013:\234\266\\\3111\320.07\371\367t\365[Z&"
+	.ascii	"\232q\211sc\216\364\017x\360\333z\322\017C\212s\307\317\025?"
+	.ascii	"\267^\351K\307\271,\316\235\342\334\027\340\027:a\201(\335(\206"
+	.ascii	"^\332I}\322q\245?\270\037r\246]\326\366\\\310\326\241\240Qw\263"
+	.ascii	"zvY\257\377\322\205\313\332\335\240\017m!\023||y\240d\223\220"
+	.ascii	"3QA\352\352J7\260\301\353\276\002g:\005\0361\234\212\240\202"
+	.ascii	";v5\034\312G\246Fw\277\022\214\\\207\202=\220psx\236\232\222"
+	.ascii	"\304T\371\2677ER\354\342\312\205\334\r6\b?\214\272q\337\221\314"
+	.ascii	"kze\021O2\373!\3676\361\265\362\003_\024\236\013\332\335M\371"
+	.ascii	"\367T\323\242\332\355\302\216$V\244&\223\251\341\342\227\317"
+	.ascii	"\312n\005n\016yH\f\242%\314\277\375_P\232\334 \257#2w\b\"e\304"
+	.ascii	"\344\262\273\037nD\347\265/\302AFv\367s\374\210\257\314Wj\201"
+	.ascii	"4\371\334\342W\225\b\013\202\206\347FV\353)g4\034\034\032\f\301"
+	.ascii	"\215\2546\303`\023\023\220s\036\f\266\232\233\230\315h\333\251"
+	.ascii	"\315bua4 `\265\232\034\036\231M\t\363P\316d58%l\207\247\2449"
+	.ascii	"\260\264\234\330NY\243\321vJ\026\020w\316\005\307J\362RJ2e\336"
+	.ascii	"\254\225\307\334\t\335\021\372\246\213\314\333\035\300\373$!"
+	.ascii	"~&\225\201\023TBG0~\035QJ\247\0165Yi\211\362\031{M=|\"3\211\301"
+	.ascii	"\\\360\rwXps\210C\314 \316\270\254\246\200\262LE\305\360\f\217"
+	.ascii	"U\272\253\026\217\034\303\001E\250q\030\310\020#J\221\221\221"
+	.ascii	"@\210\026\024\246\003P\002!\204\224y\021\36054\266)\354\006\332"
+	.ascii	"\300\327A\t)\212\232ICLF/r{\266't5\025\036\235\271\240\354\363"
+	.ascii	"\216\001\305\234K~\275G\246\254@\277>\002\3657\231\227\307U\033"
+	.ascii	"@\336<c!\2219L\22619?\360\003K\216\253\203\336\307x\306\"\034"
+	.ascii	"\307O\316\354\b\263\202\002\004\371t\210R\r5\246\372g\262\035"
+	.ascii	"\307Ym\"\364w\242)\262K\205\203\371\356\020&\353\b\214\031\375"
+	.ascii	"\350\ri%\2715\002/A\016\"LR\345\003\332}_$\357U"
+	.text
+	.section	.gnu.lto_.symbol_nodes.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375 \246\215\003"
+	.string	"\304\005\242"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\027\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\026\r\200\204\001"
+	.string	""
+	.string	"\003\002\030\177\016\002\031\177\017\252\333\3426\025\020\032\177\021\305\245\376\322"
+	.string	"\001\033\177\022\377\037"
+	.string	""
+	.string	"\200\200\200\004\003\330\244\235\311\003\001\265\006\003\005\006\305\245\376\322"
+	.string	"\001$"
+	.string	"\007"
+	.ascii	"w\b\375y\031.{\240G\220\265\255\220(B+="
+	.text
+	.section	.gnu.lto_.refs.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	"\001\002\001\001\001"
+	.string	"\002\003\001\004\006"
+	.string	""
+	.string	"\004\n"
+	.string	"\001\005\002\004\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.48e88d0711e88036,"e",@progbits
+	.string	"(\265/\375`*\t\2752"
+	.string	"*Z\270\023Gp\334U\007\301t,\315&\264\375\341\366\2020\025\204\020\271\026\305\312\365\244\260\270L\2024h\340\005\225\264\325\0077\215l\245\224kO\305\217\t\221WXC\231\030\0075\025#\b\315\365-\235$=HB$\331o$S\n\n\001+\001)\001\356\364.}\366\363\177"
+	.ascii	"\200\034$F\240\230\3559\376\325\335\267\0243\332\274\230m\246"
+	.ascii	"\354X<\213;s\256\245\335\212_\351\333\361\375\346\377\033t+\213"
+	.ascii	"\223\343\211\331\356\220\333s\266 \317\331zB.\362\0016\366\353"
+	.ascii	"\351\3232\250\024\314:\375\351U\336'\3621\332h]`\266u\271\235"
+	.ascii	"J\013\360z\t\r\224;g!\257\034P\2352#\027\226\322\355O\274\313"
+	.ascii	"\231<.\325\362\237\377\357P\317\2230\036O\314:\023{\024\177\333"
+	.ascii	"\231\016\245\221$\364\317\361\273\376_g\262\377E\367\0048\367"
+	.ascii	"\004\265(\221\342\024\033\3338\367\353\003l\331\005\330\246\336"
+	.ascii	"\356\343u\272\333Kw\213u7\031\317\335=fA\267\003\b\320\355h\316"
+	.ascii	"\310\260\335\336\245\333\275\273\255\335=\247\273\321\272\373"
+	.ascii	"\254\273\331t\267\232\356\216v\367Xw\233\351\356(\335\255\245"
+	.ascii	"\273Ct\367\231\356&\353\356iwK\273[Jw\277\335-\240\273\305tw"
+	.ascii	"\355z\275^\273\275A\267\303\350\356\341\005K\246C\034\216{\374"
+	.ascii	"*$V1)$u\337\345S\377\3759\365I\005\377X\313$\265h\345P\243\264"
+	.ascii	"\312\bV\\\372\373\377\005\220F\036\313?J]%\313\177%\306\247G"
+	.ascii	"Fh_\351\007qi\253\205\365TS\377\006\376\375G\376\267\376\322"
+	.ascii	"\377o\377\277'\211\365\376\337\020r\267\220\310\377+\"\344c\265"
+	.ascii	"[\246\376\361s\rT\3516y,w[\234\315\255o\361\266\276\365\324\254"
+	.ascii	"dn\266R\236\352\377=N\336R\316@C\023\206{.G\3363c\031\314T\032"
+	.ascii	"\222l\212\223Hu\310\230\336\274\274\300\270\214Iq\023&\321$f"
+	.ascii	"\315\020\005\021\231f\371\300l\273Un\357B\222\340b\036\306\231"
+	.ascii	"\270\366\375\030HQZ\244U\275\313\305\034\314\241.}^\350\352\362"
+	.ascii	")M\377:`t7\244Ay\003\241{'\346[<\214\347=\362\257%\0047v\247"
+	.ascii	"J\227\352\377[\306\3078\031\027\343N\027\363*\355_\034L\023\275"
+	.ascii	"\377\307\3777222\"\002\n\233\242i\001`\333D\306\357\003lEaQ\234"
+	.ascii	"\033\032D\200`\326\2758\234\262(\f\314\266\210\334\355\\\002"
+	.ascii	"n\005\312\302\325\345\212Y\257zZfau\002M\253\203{\203,N\231\241"
+	.ascii	"\272jy\321Q\266\306\226'd\206\344\3668\356s\234>\307\307\210"
+	.ascii	"\336\227!\374\2022h\374#\267\373\230\355\315\033G\313\377\311"
+	.ascii	"\366EP\246\312\312\365C\303J\034&\234v4\226\214YF\205\332\312"
+	.ascii	"\304\260\246Y\265i\343gn\026\306'\313\273U\346\2546UR\304\nf"
+	.ascii	"\033\273\271\235\351\316\306\351l\234\351\357\307P\262\222|\031"
+	.ascii	"\264Ws{\231\247i\2476\325\325\334\376\213\177\365<k\300\252\254"
+	.ascii	"\325\277\272\312\331\2508\232\270\301\254\253a\336\216$\341A"
+	.ascii	"\005\226\033w\333\276\230\374\177\031\265\367\223\306\037\233"
+	.ascii	"\327\334s\335@\316\343\n\272\233}\236>0\344\337\312LNN\242\245"
+	.ascii	"\210\003\263\335]\364\315\365\337\016\375\373I\267\231\325\272"
+	.ascii	"T\246\312\241\367w\020\370\246\326\273o\226\222]>\376\367\375"
+	.ascii	"\217YJ\024\356\273L\272\357\262\025\372\343\262\375\177\225B"
+	.ascii	"\356\263\330\272\333\314R\272\315\245r\350\217\337~\263\270#"
+	.ascii	"\037\227Jw\314R)\3446\213J\367\230\245\034\262a\326\303\314E"
+	.ascii	"\375t4\204\372\021\245t\300`TT\220\327\203\004\341D\024\257\326"
+	.ascii	"OG\272\241\320\227\342'\354\031 6\r\231|Q?b\036\006\205\274_"
+	.ascii	"\224\255\327\243\340\323s\362=\261\303\241\217\027\024~\300\361"
+	.ascii	"z>\250\021N@\fC\016C\315\373\t}@_\211\334\021\222\034$)\251\350"
+	.ascii	"i\245\245\007K\017l\255\264\264\333-%\355r'\355x\210O\005:x\302"
+	.ascii	"'\324\021\203A\241\316\307'\005\002\370\253\361\200R\031~2\261"
+	.ascii	"\t\t\002\021\370\223\312P?\"\220\251\347[\341\004\345\353\375"
+	.ascii	"\f\233V\b\211@\fA\275\333Y(b\362\240!\363\216\236xD\247\023\303"
+	.ascii	"_O\307#\241\003\376\234\242t<\341PwDDT\341\003\262P\301`\205"
+	.ascii	"\246Zwc*\334R\265\232\300\300,6b#~qk?\351C&f\305\245\372W4r\335"
+	.ascii	"\230E\343\027.\360\361\353\352\013\263x\n\267pgG\261\373A\036"
+	.ascii	"\344K\033DMV\321\323Q\033>:\364FvcM\032\262|\347\016n\205Z\257"
+	.ascii	"\217\021!\212\215\255\352\377U\016\267\334j\262\304-~\263\260"
+	.ascii	"\253\025\263\327\237\242\215,c\314\334\230\213\016\035\267\332"
+	.ascii	"\251\262V}\316\224\2001c\247\003\200\253\250\2618f\0204#\"#\""
+	.ascii	"2\222$\205\003\220\002\221)\263m\0210)\223\320\324H\223\312t"
+	.ascii	"L\n"
+	.string	"|\364\372\273I\255\013\305\022\213\224=\342goq\277?H\3669\036\311:\345\236\275\346\2253\255\3239\347C\365NSf\240I2\023\231R;\310\234\217g\023\362%\030b\311\277\0030\345t\2121\366'\204\024Z\367\360+fO\034\201!\355\226b\n\024v\334'\251\362\333\001\335\2454(\245E\266x\\)\025S\213@I\212oE\231\363dmr\374\202\265\245v\323P\22060\276\"\304\300\334\232=\237B\027\223\017\201\324V\032\201\244\337\223\356\016\001\210\322\353\n\376\345\003\331\364w\310\r\245\004\317\227L\204gw\363\305\223\341\311#\005lFw\022\270j\351\247M\322\316*\242~\305Q\001\302$\301\n!c\007\017\214H\372.\237\360\373\346<\221\321\255\364\341\361\324;\252\263A\200u\277q\347M\223\\\371O(\360\311\243YF\211M\342\314G\350\377@\003?R\n\3708K8\270l,\367\215\325\2267"
+	.ascii	"\016\374\f\364\367\037Hq\364\340k\206\253\277\335\370?\340\370"
+	.ascii	"Q\230\255]7\177\215G\342\323&X\354\2729\212\235\341t\206\235"
+	.ascii	"\332 \\ \\\316A\336\252\013\377v\3003y\035\317\373\332\213\301"
+	.ascii	"\355\005i\025"
+	.text
+	.section	.gnu.lto_.symtab.48e88d0711e88036,"e",@progbits
+	.string	"dispatchIsEnabled"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.48e88d0711e88036,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
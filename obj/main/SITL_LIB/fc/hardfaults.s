@@ -0,0 +1,254 @@
+	.file	"hardfaults.c"
+	.section	.gnu.lto_.profile.5a3d034f5428002e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5a3d034f5428002e,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\223\344\350\214\003\002\002"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.5a3d034f5428002e,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.5a3d034f5428002e,"e",@progbits
+	.string	"(\265/\375 @\335\001"
+	.string	"\024\0034"
+	.string	"\001"
+	.string	""
+	.string	"\t\372\341\240\227\002m\001"
+	.string	""
+	.string	"\002\b\200\200\200\200\002e"
+	.string	""
+	.string	"\004"
+	.string	"\201\200\200\200~\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\001\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"hJ\224\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5a3d034f5428002e,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002\002\006}\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.5a3d034f5428002e,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5a3d034f5428002e,"e",@progbits
+	.string	"(\265/\375 \030\225"
+	.string	""
+	.string	"P\f"
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002"
+	.string	"-Al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.5a3d034f5428002e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_HardFault_Handler.19.5a3d034f5428002e,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"=\n"
+	.string	"\366\022E: \261\322\001\037\202\242\033\032\211\t\240\027|Hj\342\252\206G\362\b\377\027\200\212\327-V\\\333\266\021&\f\305\306\271\027E\300\200\202\3203\260\007\020)Xf\253O\266\377\226)\0053"
+	.string	"5"
+	.string	"3"
+	.string	"\246\253zG\247\\\225o\300\361\016@\3548\025\370\334\270\334 \264F\217"
+	.string	"\261\265\361\340\\.?\371^\210\341n\227Pk\365\276\304\214\233s\333!\333\005\3667\0373X\305\346l\332je\210\375i!\243b\031\263\277\336\257\317Y\240\2153\004\271Z1r4\3256[Ll\277c\225\035s\332H}\255\306\2652\326Z=)\022\265\322\331\255]:\355_\366\260\200\330B\271zH\"\223)_\031\252\301\260\026\347y\024\275\\y\027,\374\354((\277\304\024\251\375\353\323O\321\317\313\027\rY\026}J\246\210\023h\304"
+	.string	"\202\034<\321\310\223x"
+	.string	"\221<\021X\362>\003\376&\032@\317\364}\240\327\261/c\356d\314vg\017\016Am\322\247p\033o,\271\372\277\2515\023"
+	.ascii	"G\b\232Q\271@\265\035X\203:\274{(YpZ\205\205x\260\206R\033g\306"
+	.ascii	">[Zy\301\"\310\fn?K#-\242\233\272cJ\241\240"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5a3d034f5428002e,"e",@progbits
+	.string	"(\265/\375 o\225\002"
+	.string	"\202\304\020\036\2405\351\017V5s\344|\341\213\201sH\264&\354\355\377\377\037eD3~\005!{\313\024\023@\324\266\265\261!\231\200\300\266tF\265}\344\200\356\340\237X\221~.\035\374}\341ar\f\204:\242\376\225\004"
+	.ascii	"\240\206OVF\211\213\f\224\001"
+	.text
+	.section	.gnu.lto_.refs.5a3d034f5428002e,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5a3d034f5428002e,"e",@progbits
+	.string	"(\265/\375`\336\003e\035"
+	.string	"v8\310I\240\232QcMmb\345\021\316?\312X\n\247\220\245\333\243\233\035\254\fj&\256\3457\223\244e\020\020l8I\273\313\361\3016\306\307b"
+	.string	"\276\264\261\300\231|\3649\320\201W\206^\215\351\3658\330\314\306\200Vo\b\266\3352\005\243"
+	.string	"\254"
+	.string	"\263"
+	.string	"\237\001K\231~\277?\251\300\357J\250\224\321?\016\273@\001\246\355\322Z\223J\3222\035\005\213^\246c\005\325\262E\205?\372\177\307\224L\300\026bF\362\026\271F\256Pv\241|\217\334\326"
+	.ascii	"|\354\333\237\305\271\341P\022e$wn\316\213\\P\372\262\306\t>"
+	.ascii	"\202\307\322W\366\302\271\262\227}\211\330w\310}\322q\245G\353"
+	.ascii	"\207?\033\303aa\374n\214\244\331\233\363*/\201\251+\333C)\266"
+	.ascii	"\237X\331N`c\337\026\266\253lS\331\216\262M\264\335\332~\262"
+	.ascii	"\375\262]\305\366\270\265\265\265e\373\203m-\333u\006=\310\224"
+	.ascii	"A\242x4F\322\366\316g\257\260\252\367\361\2001\021i\253\302\220"
+	.ascii	"\024\201)\316Sc)\373O`\325\373\330\025\205\335JPM}<\025\366\366"
+	.ascii	"h\372\365;i\313cq6\b\214\245l\020\230\266A ,mW\364_\201Weyh\352"
+	.ascii	"\013\306\200\245-\017\3706\210\306\322\326\007\220\"'\254^\334"
+	.ascii	"0\251\357H?%\236\n+\246\354z\254\377\016\215\256*\370\225V\025"
+	.ascii	"\213\027\343B\351\025\221zMx\353e\377\033\370\365\226\326\373"
+	.ascii	"\212i\323\3727\365r\377A@\331\342w\334\"zC\351GF\377\201\263"
+	.ascii	"\377\357G\357\213\377\321\3775\252\022\373\343\223V\327\227'"
+	.ascii	"\025g\262\376$\231M\026\017#6\356\224/U\200.'\210\303\221t\231"
+	.ascii	"\213\3046\200\001T\204@.N\245}\231\\\341er\243\306\243P_\261"
+	.ascii	"a\250\302E\326\177\305\200\306\312\224\225\227\221\274M\256\223"
+	.ascii	"+\324\271O\\(\324\237n\264\204h\231\031I\337\031\245\257\316"
+	.ascii	"\353n]\235\227/R\351\233\344*\361\035\n\357\360\022\r\373\327"
+	.ascii	"\336o#\213\004a\031\0245\262\236\344$\253!b\225cH\031_\242\375"
+	.ascii	" \202\301\330\374O\377\023\320hi\372\261d$\335\241\034\355\327"
+	.ascii	"y\352\177\0264\354\325\236\215/\315\2752\373\346\272\256\002"
+	.ascii	"\333\344o\333\365\345?\n\316\315L\\\t\335\020\355\314\201\320"
+	.ascii	"\t\005\355\314\242\263(C\210\242s\027\300\271\031mg\342H\350"
+	.ascii	"\314\233\t\233\020\356F\343\334\354\324\021\351r\316\237\236"
+	.ascii	"\223H7\242\006w\332N\016C\270sgb'\300\b\\\024\002g\322\316\242"
+	.ascii	"\"\223&\300\304\t\335\210l\030~,\334L\033\206\230\201t&\216\b"
+	.ascii	"\007\2424\004\236\006<=%j\334\343\343\300\307\301\313=>\265\232"
+	.ascii	"\017O\2554O\315u\376\3542\340\206tg\351Z\215\302\216\007\r\027"
+	.ascii	"J\240\331\356\024\032a\013\272\231\266\034\r(\210F\244\263\r"
+	.ascii	"\321\200\314\035mv`\n\325\r\253%\304\313\025\221$\312\320\261"
+	.ascii	"$\345F\215[\256\034\365F\262\252\352\022\267`Y\221\344TC\303"
+	.ascii	"\f\033dJ)%u\251\0029 `\002\0211j\035IV\256[\334\317\3347\227"
+	.ascii	"\333yc\354\220MAK\354.P/XY\200V\335j\f\243\340vQ\2735F\347,\217"
+	.ascii	"\031\357\022\321\242+\254\220\rK\213)\f\001\227\026\332\327\355"
+	.ascii	"jHh=\221\342\220\375:0\0310\023+q\213f\016\350\3234\243\332W"
+	.ascii	"\333\260\302@\263\r\344N\2055\013v@\366\232\2457\267n;%\367("
+	.ascii	"\315n\346\325\270@v\375\213\354\257\355\216m\270\310\3720\353"
+	.ascii	"\361\262\316\315\002\024"
+	.text
+	.section	.gnu.lto_.symtab.5a3d034f5428002e,"e",@progbits
+	.string	"HardFault_Handler"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"systemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5a3d034f5428002e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
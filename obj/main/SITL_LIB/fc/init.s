@@ -0,0 +1,1668 @@
+	.file	"init.c"
+	.section	.gnu.lto_.profile.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375 x\255\002"
+	.string	"4\004l"
+	.string	"\005"
+	.string	"\323\245\377\300\b"
+	.string	"\001\233\364\343\336\006"
+	.string	"\002\365\203\335\343\t"
+	.string	"\003\345\305\206\300\007$\002"
+	.string	"\001\002\002\003\002\004\002\003\002\005\002"
+	.string	"\002\004\006\002"
+	.string	"\002\006\002\007\002\007\002"
+	.string	"\002\002\005\352\263\360\321\b"
+	.string	"\006"
+	.ascii	"A\221\007;\b\252\374Jf\347J\336@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375 \242\275\001"
+	.string	"\240\226"
+	.string	"\004"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\002\001\003\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017"
+	.string	"@"
+	.string	"\307"
+	.string	"\210\253\2520\220\345e"
+	.ascii	"p\\R>\264\032 7\340e\007\313\242\024\001 \230\r`\001"
+	.text
+	.section	.gnu.lto_.inline.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375`\200\001]\006"
+	.string	"\002\006\025 \220)\351o\233\036}w8\321\032\007\215`\335\367\320\322\206\037vw\247\017\002zx\200\032\331R\246\027\030\236\326wT\242\n\270(DQ$\007F\233\312E\370\330\352\270;5m\362\323\032\030\377\323\262\237p.\002\360\211\336\335\005\372T\330e\322X\f\177n#2 @\002\202\030L\036\227\007F;\300\005\272\004\2122pW*\243@?\001\314\003P@p<\202+\016XK\253\016\200\253CS\235\242\033R\t\020=\320cx\233A\275\205\220\017\322\013\242\0250\256\241\002]\200\213\270\210%\\r"
+	.string	"\020\027\366W\235\305\356\301\300"
+	.string	"p\026G\f\036\r\363"
+	.ascii	"\035\311;\202\032*\340G\303\b\022\230\203C\264\352\2409(\201"
+	.ascii	"\213\353\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375`\002\002\205\t"
+	.string	"\"L'-`M\222\0160\264"
+	.string	"\3125\216\001\332\022P"
+	.string	""
+	.string	"T\025\234\217Lc\0305\305\022\031\236b\013\2003E\220P5\t*\320\306&\204\310$\003Tp\250X\024\251\324\034\271\"0\032\027\240C\026\251$,"
+	.ascii	"L\222[!6\266\265f\270\362\364\363\344\370\344z\233\346\347\001"
+	.ascii	"i\260<\034\006A;\235+\3045\221?g\360\340\217\b\316A\211\211\276"
+	.ascii	"\261B\345\355=\036X_\356/\327\271*PT\ne\212g\030\303\2568&\226"
+	.ascii	"\330\026\327\022\005\334\361\321\340\222\216\363\305\225\\M\215"
+	.ascii	"\2476\023\217lIF\250QAU36\245,s\240\002\221\253\242\007\022`"
+	.ascii	"R\312\nRf\306j*\255Y\377\016-\372pf\bX\024\246\332\266d\025\336"
+	.ascii	">\022\221\236\t2\243\203\212\374\372L\313\037\323\331\335\367"
+	.ascii	"\b\207t\2354\345\244A\003\307M\223\221\354\224F\242\374\367\365"
+	.ascii	"\001\217Z\025B8\0177\351B7\214\370\256w\037\002[\344\030\335"
+	.ascii	"\240\036z\030\257:\324\313\030\344\020w\337\244\304\250\351<"
+	.ascii	"\205I\337c\246\013\351PP\216\355@.\260\023?E\267\022\353.tp\006"
+	.text
+	.section	.gnu.lto_.pureconst.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\001\200\004\002\200\004\003\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375 #}"
+	.string	""
+	.string	"0\027"
+	.string	"\002"
+	.ascii	"\002\001\003@\00207(\033\b"
+	.text
+	.section	.gnu.lto_.lto.2a14bf723de79f6c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.171.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375 \273\355\004"
+	.string	"\222\210 )\200k:@\344d\0222\005)\240\266V\005\001\333\265"
+	.string	"\370\277\275\331\241a\017\377H&\261\302\212\250\036\017\260\341[$wJ\001\236\244+RQ'\205R\021\261\320\311r\250Dp\305HXzU\225\245Q\267O\256\360H\210\335e0)\366\001\233\234\r\033\231\317\243\233]I\b\264\234\200\346b\373\2211\273\363\316\262\367>\021\357\333]\315\312\261C\314?\346\003m\313\016\005\207\3355\324\266\311\2357\330\216\001\t"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K7fk\273N\013"
+	.text
+	.section	.gnu.lto_requiresSpiLeadingEdge.172.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375 \361\305\006"
+	.string	"\002M06@o\222\016X\032\357\005\2358\346\350\312]DJ\003\306\023f\023\260\234\214`\177S~\260*Z\340\026\232hQ\024\r_w\230\031V\336\204f\312\314X\023K\210L\001\025eMT\016\323T\347cy\254H=D\217\325"
+	.string	"\021)L\"v6_\021\025\026?\327\205E\315\226\325&N\305\263\370\r\344^\3077\223\231\371\343x\227\221J-\013/\231\241\030\230$A\025\220?{\315\357\334W\244#YI(\026\310\334@I\311L\204\013\002\n9\335L\205\231\016L\205\377\t\n\331Z7\217PG\037\027&\245\314-\276Q\265:\355\266\244\004!.+,'\"P\035"
+	.string	"Cf\3560D\031\375\3657\370\017~\215\007"
+	.ascii	"2\003\202\341\243\302b\025\020]\363O\035\302\274\256I\006"
+	.text
+	.section	.gnu.lto_swdPinsInit.174.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375`-\001%\f"
+	.string	"\026VP@0O\233\016D\020\0053\271\234\005,B\f\236\271\262\0221\307V\342P#\230\324p\304\206\274&b\306a\352\027*\304:\315\376\271<\035\262\305\001/\203\225\315\177\n\360;\374\261\315\254\365&R\246\024;"
+	.string	"@"
+	.string	"<"
+	.string	"\273{)\206k\237\242\244\251\371Tfw\357}\302u\237O\027\036\267\b)Y\270J\004F!.(\035H\262ph\340\356='t\033\231Tfw\235\\G\341\246n{c{\200\375\216\231\351S*(V\024(\261\313\021\003\306\206\361\304\206\213~\373\367\\\371\037\016\242]\364\340\273uL6\022*F\273\337\345\321\002$\217\376n\231\036%\257L\217\326\354\026\377>\226\312\220B\302\210\027\001\240\207p\373\307\310\310\204j\310\234\351\212 \004\013P\216X\222\224\332\f2\362\334\325\002;\304\274\334n\340 \317Q\032"
+	.string	"\344\020\202\364c\177\237\324\220}iw\327\352aW\027\335T\246\003\031\226\326`4\260\016vi\024\\\035\354"
+	.string	"\347\322x2.\214\305\331\202\004\236K#\313<W\365\355\245U\017\003\"!\004\335\230.\342UH\324\020\210g\225j\201^\245"
+	.string	"*\200H\226\3109\023\266\311s\266\002\033"
+	.string	"3\2411)\360\200o\301\276r(\004\306\245\203\034"
+	.ascii	"\017\330\027\020\032\020\255\203dMED!H\325\340\227\310\347\204"
+	.ascii	"\231\001\316\213\271\f(J\220\257.\013\330b\\\326\2408\220\005"
+	.ascii	"0cJ\241\240"
+	.text
+	.section	.gnu.lto_init.175.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375`\237\016\375F"
+	.ascii	"\032u0\032@0\346Q\007\270p*\262Q\\&Q\265\204\230<\251\221\327"
+	.ascii	"\213\351\222\273\3563\346\202t\207\335\233\264\357\357\320\242"
+	.ascii	"\202\322YG\310;<-\237b\252S\312\275\231\2337\013.\300,\331{\357"
+	.ascii	"-eJ\001\205\001w\001\227\001\355\253\235}\265\257\257\366\355"
+	.ascii	"j\327Z\373si5\211\234gY\024\355\274\250\274\244o\222<\263t\274"
+	.ascii	"\274\233\177\350\177\364\267\373\273\277\361\240?\335\267\211"
+	.ascii	"\337\215\337\031&\243\362\230+\235\2233\274\317\016\327g\363"
+	.ascii	"r\356A\367\032\223S\306\275\334\203\317\272\217O\343o'\306y\006"
+	.ascii	"\344\3238\320\214R\031\027\362i|\353\375Qs\276\261\217\346\343"
+	.ascii	"<8\241B\374Q\"\303cT^2a\321\214\365>\353\377\366p\361C\215\303"
+	.ascii	"\257\250\314t\245\315\2717\252,G\035<\353\b\336g\237^\330>\253"
+	.ascii	"_\252}\326c\367E\037U\223\237.Q\330\032\252,\313Y\033\213\003"
+	.ascii	"\177\215\276?\351\370\253\250\204SRQPONMLKA\340\357u[v\335:\366"
+	.ascii	"w;\034P\203#\315k3v\374*/O\265RPR\317\036\217\351e]\212\024&"
+	.ascii	"\250\213\026\256\375\324\032\027-\265\345\243\266h\321P+[\250"
+	.ascii	"\216\334\3431\263\254\031\240pq\3737R\364\323\0252\265wr;\274"
+	.ascii	"y\266\312\334\334[5\215L\355\233\234\317\204\307t\242\351\245"
+	.ascii	"\263\017\256\r\246u\220\036\f\363l\025.\351\262\304c\232i`\224"
+	.ascii	"\377\255\r\234vM\036\217\031e\025\002\252\222\350\343\376\n\f"
+	.ascii	"\263\251\337\2534\262\262w\361\230ebca\272}\362,\230R\257\311"
+	.ascii	"\2461\245\336\3011\344:\224e\371\343^+\031Sj\355v\220e\331\365"
+	.ascii	"r\214\354\035\300\273\377\032w\207\342\316t!1Z\353n\367XJLe\250"
+	.ascii	"\334Go\267\273!\204U\302\322\036\375\370\331\272\307X\342,\372"
+	.ascii	"\227\355\236\002c\373R\235&\343-l\314\346\352\224=\264F\311\313"
+	.ascii	"\027\212\331^YNZ\360"
+	.string	"'\364yq\230\022\355\263\354\346\360&\310\t\007]\267\240_6\372\267j\367^\367\2075A\352>\367\237\037P\334\346\317\305c2\261\233\376e\354\326>\2737\0032T'\\\331\227\356k\017h\007\357\036\303\305h\226\372\360\315\311\005vsz\354~\272\203\327{_1\240\331\367>\355\247y;\017\257,\203\375\362\303\013\246A\001\237\020z~\217\b\177.\317\372\210\022\254\373\256\2505\201B\377R\357\3373\005l\037=X\207E\311\272\237v\376\367\233Q\361\333\307\024\344>~UZ\234\263\275\237N\244\225\260\001\220A$=\224\324\221X\350>\177\246\264\273\213\027\372\227\022\366\303\335E\253\323\030\003\354\3142\376N\246NgD\322\222r43i\367\033D\375K\027\242M\253S\344>\272G\221z?\335\037k\315Y\031\337V\334\213\033\036\372\256\341\243\357\022\336\315\373\325\360\241\357\006^\355\005^\355V\257v\002Z\373"
+	.string	"\255]\200\326\036"
+	.ascii	"\250\035\200\253\275\352\325N\345j\027\276\332\247^\355R\257"
+	.ascii	"\366(\255\035\352\325\376\364jwr\2657\271\332\231^\355K\257\366"
+	.ascii	"\240\326\016\374i\377\275\332_W\273\253\265\007\360\232\3535"
+	.ascii	"\335%\007\354\005fck\237\005\260\007\b\332S\026\246R\025\325"
+	.ascii	"\256\312\242F\345\307\rn+6\252\241\205\333\035v\203\317Lm!\f"
+	.ascii	"\247\255\3504]\005F\023\007K\245\355\263S\373\317\314\362\270"
+	.ascii	"I\351)\372\255\332\250-\245\321\242v\n\263;\325\262\245\030\372"
+	.ascii	"\037\226\243\203\335\314-\252s\241\365\373\235\366\037\226\323"
+	.ascii	"\272\303up\235&6{su\252\334\3075=#\301\375\374q\t\343\f\223\363"
+	.ascii	"\3637\266\276\276\006\366p\213AM\335\201\332L`z\323\025\372\327"
+	.ascii	"\350&\360\035K\367D.\337"
+	.string	"d\371\213L3\201\367\364\201\357\356\332?0\240\270\007\2417\207\372rp \242\334\257\350\233\253\323'\255d}\253\326i?i1\247\235\242\211\247ZVB3\355\246\355\372\b\234\027A\033\201\371\0346\004#\032\356\246\375K\233I\204v\207\031\301z\372\227K\273\235Ch\317\214\334G\340~:\0312\243\366\333V\\\310&\f\324\335\260\235\300\3028[\r\333\300\026[?fk\203\233\206\324PRG\332\323\310\230\315\312\341G\372\013\346\253R\343\323\307\340\376\321\214S\205\276p\365\373bd\002J_\t\226\004S\202\373\340\276\366\331\r\273E\023\216\013\3344\260\364P\006\356\237#\3246'\367\361\370\325\030\251\240\020\337SceX|\344H\373\254\206\255\241\371\246\n\375\322}bD\033\316\031\203\376-\211\307\222\373\350\357\3761\371=\275o\024;\211\241\304\315f\373\354\273\2034\345\334\240\023t\374\001\216\003+\b\027\215"
+	.string	"\216\003\213\213X$\362\310\272\301\203\312q`\365(n\355(\336 \352\230Q\243k\006\027\215,\257..\257\342\226\027\002'\261B\204\n\226\370^^[ZZ>T\324\230\261\325\025\334\362\322\341\343\304\226\216\032\304\237ka\365 \026\211YZ6\262\212\304\031;\262\264\272\274\262\260\204\316\305c\253+\253\007\027WWV0\372\365\333\212\377\322\310\314_\033\351\005t!\371\255Z\253]`\220\325N\241\006\307-\356\213\364l\r\261L\216H\026\323\301\3124\346\034C\257\262\3337\207:M\272\261\203\303G\016\235\272!f\346:u\246\334A3S\363\270d\346P\247\317\304\330\307x\267"
+	.ascii	"\022\337\\\365\207\bI\357\327\346\247J\265\237\316\022\320tt"
+	.ascii	"\035\201\r\003-O\025j\004D\324rm_\252S\2440\320\036\333\324\200"
+	.ascii	"w\300v\233S\3524)5\210\330\350\321\214\214\022\360\002\366\317"
+	.ascii	"5\332\233\223yvFC]z\214\210\200rN\246T\247P\373\351\356!\247"
+	.ascii	"\342\336\207\232\034\374\325\026\273\332\017\375U\226e\371"
+	.string	"\351\301_\355\342.r\246F\232\307\306\371G\364\20472j\335\215z\306\2757\377H\344\230D\367\2563\023\210\316i?\225\372\325\3504FI,\235\024i\245\250\2163\362\031\253FIFIFJ\306>G1\022VR\232\213\350\227\35278\t+\305\nR\216\031}\006>\"\006'I\322.\201\307\354\3140\023\342\002FpM>\264\35310\2246\270\t\233\301hR`*\214\334\346$\323~z\200*\001\366\3171j{\202\301\302\365%\207\006\260%\2018\250a,G\225RJDDD4I\n\031\016\201\005\304(\005\031\236\007\021\3604\312\230\252\231$\225\345\232\337\024\351I\203\253\253\244\245\005*\236\\\226P\251Y}\364\221U\033\330t\277\360C\3013\312T\351R\314\334\357\321\326KWy\216\037\224'\336<\177\233\253\357\n_\324\034RD82tB}tp\345\362E\251d\226\321\301^w!w\217\006"
+	.ascii	"]\fj\013\246]\305\270,' \253\354\373\032J.\224\234}\203\006\355"
+	.ascii	"\354Zg^\231\235\006[\204\276[{#f\207]xn\2271\245\017\013\001"
+	.ascii	"r1\332\263-\306N~t\215\252M\354\027\375\365\201\215\375TD\353"
+	.ascii	"\303\307\306\b\230\312zPtxTD (5\357\3205\006\260)\367\020\303"
+	.ascii	"4\331\244M?\241\202\257\236\243\025\275 \306\020I\356\033\034"
+	.ascii	"\016\\\016\347;v\322\363\305\214\365\365{j\324.\227u\201\277"
+	.ascii	"\232\311\017\364\276EM1vpE\357\243v\"r\242a\356\360\251\003\367"
+	.ascii	"6\006\025\303zW\252{h\230!\210He\2359\260\035\221 \ng\005\274"
+	.ascii	"\353\322\320@h\003S^\3508\027\210\\?\253`"
+	.string	"(\024\272\030\342-\355\336}#'\237\341\367,\225\\\033=\205\345\340\006U\216\273\323r)\007\220\233\270\357a\201\303\266\330PI\214\3526\227\326_\221J\255\024\364\210\"\324Vo\351y\305\270\006\313]\363\204\341\337\250\344\006\324-\304\r\2070\225E\314y\243\225\356\207\210\376D\334\201\032\0315\212?W<O\352\355\270\370\032+rp\377\356F\236\005\305t\272L"
+	.string	"cI: \347\367\242\224E'\002^F\312\366\bT\221\001(\3366\315K\226\324\233\227\326V8\025 \267H\227L\262\332\275\001\316\330]\023\342\261\200\310qM\251\305is\241\260t\321\242\313\275\017\224F{\275\201P\264q\023\026\244A\"\"a\024\277\363\217\b\223\024\002\252\256\326\251\004\250^\024W\350\253\006\207I\220\322%\f\004L\021\025G)\233\250\347\376\032GO\241@(\231\024vI\364+\3278Sa\270\271\343\366\365,\260"
+	.ascii	"\370\340\022\353\277\214\205\032!\331h\322\331\376$\375v\272"
+	.ascii	"\213\261JaQ\3416#\177"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375`\250\b=\026"
+	.string	"6)\213@\200\032k\r0<\361\217F\321\237\314%\204\270`\025[\"\222J\302\\\355\226S\252\377X\250xw\304\027\266\313=\016:U\007\246\222\310%r\376\023RB\013-\264\210\215\341\327B\\\n#\351'\031\201"
+	.string	"y"
+	.string	"v"
+	.string	"\205r\365\376Y\275Q\252^@\252W\312\324;E\352\245\022\365V\201z\357\236\336@\247\367lz\2550\275W\226\336A\2457L\213m\305q$\226Iz\305t@\301\340\364KN\275 u\357\250]x\312\305\250Yz\252\245\250\202D\225+I7T\0304\3438\242\360)\026\032\250;78\241\267\006\361\2251\303\326&\027\364\306\020\026\331\330\332\342\306\361\343\310\327V"
+	.string	"\305b\261\b\364\322\230\031\307\261\246\f\257\r\023\357\215\022/\016\022o\216\021\257\016\021\357[\210w\007\210\227\307\207\027\316\303\033\327\341\355\301\341\375\261\341\005\242\341\r\222\341\235\303\360\322]x\267Xx\353*\274v\024^s\302\233'\341\305\213\360\352Ax\205<x\2078x\2114x\213\210\275|\f^#\013\336>\005\257_\202\367H\330\213\004\354M\362\365*\361z\227t\275L\270^\037[o\023\255\327I\326\373\004\353\001\016\372\261\262\177\312*{x\016\355\241Y\234\031\203+\256\354!\211e\367\234Yv\217\226\275cn\331:'\227\215scv\3317\245\227mc~\3316d\221-"
+	.ascii	"\314\016PV\351Oo0\314\026\236\265\361s\301b\234\263\205e\207"
+	.ascii	"-\370\334F:\273g\235]\323\316ni\332%\357\354\024x\266X\236m4"
+	.ascii	"\352\331\302\232-K\266/\310\b\366\021\030-\2263\332Hg\364\211"
+	.ascii	"\243\212\035{\215\307^\253\033\355\265\002\366Z\217\2556\264"
+	.ascii	"\325\f\330j\007l5\037;\355\374\261\323L\004vZ\td\247\221A6\032"
+	.ascii	"\321F3[\363\0068F\310>;\207\3543\223\310>#O#\333\2544#\217\354"
+	.ascii	"\262\023\311.3\223l2\263\366\223\013\334S\262\311\312%\233\214"
+	.ascii	"d\262\307\316&{\314t\262\307\312'\233xB\331D3\312&\226R6\221"
+	.ascii	"\234\262\203\250\034\200\207\250!\b\203\221b\005E\225l\034\200"
+	.ascii	"\203\246i\r\0210PJ\210!B\"\036\021\310\007\317\032N\257\302\312"
+	.ascii	"!\217\263\023\271\342\362\263\214nC\373\245=9\b\217)\214t\251"
+	.ascii	"A><|v\251}w\032\344\335\347\346\302:\217\"I\033\233\347O\304"
+	.ascii	"\360^\321\360M\030\022\262a\020\b\004aQ\203\340\344\263\003J"
+	.ascii	"\201* \th\002\026\001IDR\240\b\250\002\232(\336\"drR \257\225"
+	.ascii	"j\b\314Q\231C'\017qeD\350\003\024m\n\360\254\035\206\001J\200"
+	.ascii	"\363\325\252\001"
+	.text
+	.section	.gnu.lto_.refs.2a14bf723de79f6c,"e",@progbits
+	.string	"(\265/\375 m\315\002"
+	.string	"\322F\025 \220+\255\001o\267\2431333\243\330\335a{\340\273&\204W\035m\333\272\366G\276\210\225;\005\377\\\332s\357D\347\034\354\215\301\326\024,\206\360emYW.\245\334\223\201\225\\\032\271!\312>\324\016\301\r\365\"Z\021H\023\320\210K\r\367\202\f\300x&"
+	.text
+	.section	.gnu.lto_.decls.2a14bf723de79f6c,"e",@progbits
+	.ascii	"(\265/\375`/PMR\001\2123\352{V La+\215\001\216\222\232e&G\rV"
+	.ascii	"\027\212\027tC\033\021K<\210\237\t\232._\270\360[\333x\026bd"
+	.ascii	"\227(2\331lN\266G\340c\264\215t\233B0\374\272\320\225U\002\205"
+	.ascii	"\322\244p\374\314F\3239\337\264\276*J\327U\005\031\336\342\210"
+	.ascii	"\214{K)e\n\321\006\273\007L\b\344\211\312\364\211|\350\023m\351"
+	.ascii	"\023\255\320\037\322\243?tF\177(M\177\250\005\375!\034\372C/"
+	.ascii	"\364\205\364\350\013\241\321\027\302\242/\304D_\315\"\221\027"
+	.ascii	"\342\241/t\245\037T\247\037\224F?\250\212~P\231~\220\r\375\240"
+	.ascii	")} :\372@e\364\303\300\375\352\371/\036K\306\242\251ClH\271\371"
+	.ascii	"N\205\370\205S\37325w\363\201\300h|E\377\214E\"\017d\246\017"
+	.ascii	"\004D_9w\216%r\270\305\"\233&*\006\216\233\017\024\246O\260-"
+	.ascii	"\007\362u\226\003y\240*\375\037;\372?n\364\177\333\374\272\371"
+	.ascii	"\257\333\r#\364cF\226\231\233-\223\020\277m\212\332\262\274\215"
+	.ascii	"\335\374\0376\375\243E\377\207\211~\321\"\221\3779\242\377\263"
+	.ascii	"C\377'K\377\347I_\317\321\327g\364u\026}\335D_\007\321\3274\264"
+	.ascii	"\335\026\211|\032\030.?Q^K\344n\276\b\265\036>\212l\\.\226)@"
+	.ascii	"\212Y\334~l\271^n\227\373\305\022/\227\253\345\227\313u\341\211"
+	.ascii	"\016\002\336\206uqp\243\225\033;\006P\276\017\035}\0373\372>"
+	.ascii	"g\372>`\372d\235\376\357\025\2648o\236\236n\276\b(@\236\b\301"
+	.ascii	"bv_\340\241\232f\2016V\274K\320.\223\035J\232\2249\271/\210\240"
+	.ascii	"\214\266\324\212!diw\312\225r\251\334*\367\354Z\261\304\213v"
+	.ascii	"\243\374\022m\332/\033\332\035\2520\314\243U\266\367\320\347"
+	.ascii	"L\316\013-F\231\310\"\221'\265\350\223Q\364\311\"\372\244\230"
+	.ascii	">\251\245OR\351\217r\372\343\033\3753J\220\004\251\275@\207\355"
+	.ascii	"\346\3335\030\367\005\321\270\267\027\\\023\026qW\352\267fH\356"
+	.ascii	"\n\271\026n\222{\344\226\335\"\327\210%^$w\310/\331%\362;\334"
+	.ascii	"[\nK\225\236\342\336\303\213\344^\3351{F,\223\221S\264fHn\214"
+	.ascii	"\373\302\236\021\223@\2239\305\275\207\037>\374p\321:\322\203"
+	.ascii	"(\33336\211\264\300\"\221\037\313h!\034\210\352\\\361\222r\363"
+	.ascii	"\307+\032\253\315\032\0162Yl\310\300\256\326\265A\204\367\016"
+	.ascii	"3CF&\307\230\256\26507\312X3\026.\330\345b+\336\0357\310\375"
+	.ascii	"q}\334\260\313\343\002\271b\267\307\375\262\304\013v\275~e\\"
+	.ascii	"\253_\021\177\210_\260\253\343\276 \202\032n+\037+Vo\326\340"
+	.ascii	"\366\036"
+	.string	"~\340\360\301\204#/\344\321\220?v\351\2170\364\307\255\237\347\350\3472\372\031\213~\036\352\3471}ml\201`o\320[RU4n\27652\2152;\306n~\346\241\357\214\020\27740p\301\213\226\233},\022\371\254C?S\351c8}|G[+\233Db(\243\217\265\350c4}\251n\013K\364\340\272\370\235\262l\037\241\206{\270\367\260\350\002\241\243B\274\371\270\211\276\365\200\304uu\326\003\362\230\210\276\026\211<\376\322W\263I\344\177\243<\320R\\\2544\271\371\277P\367\211\314\361\206\316\325\315\377m\335\335v\217\245\263\304\373d\345n\347\354\332\031\333\035\213F\364d\264\243\332\200\330\261hxH\3463\005,H\021\2047\013G\3644\3342H\260\037\\]p\"\356\223\215\333\270\315\007WW\331\336C\016\037>|\370\240\227dMm\001\312\331\"\221\277z\364\357\034m\341\256\315c\365\334\302Y<\377"
+	.ascii	"\204\013IY\270\2747\224\265\032\020Y\253\301\350E\b\024\221\314"
+	.ascii	"\277m\364\257\027\375\353D\377\216\351\337\326\261s\200\322\350"
+	.ascii	"\346(\271"
+	.string	"\371\"\320\270\301\002\006\356\267n\226\215mc\335\3305\266h\343X9\026\216}c_\260t,\321\316\261in\333\254\232\333\341\355\332\0309a\304\314!S&\016\233\0318U\254\304\245Q\221\263R\376\020S\346D\374\326\354\211E#\302{w\321\221\355=<\b\177\210\377\003\020\354\034{\306\242\3313[\017X\362\246\270\367\360\366\312\037b\216\315b\277X\020\2657\024\027\006a^\260r\300\355\275?|\340\360\2014\373!\004\256\202l\251l\022yd\221\310\333<\372\326M\337z\321\267U\264\321\022\315!Lg`\223\310[\032\332\203M\"\177\002\375[-\267_~\353\202\305b\275\200`o\251\275\367\006\222J\352\353\310\315\226\213\355r\353\305n\331\326\013\002\274\366\206\262^\212\346\366\206*\262V\003k5\310K\300\206T!\363Uh\253\026\342V\013\022i\2655\334i{\357\"\314\346J\313\214\233G\213D>\004\372"
+	.string	"6\211$-\022\271"
+	.string	"\233D\236\247\317\306&\221\037\241_\264I\344\033\240\017g\223H;\264P,\361\002{\366\017@8~\212\262\233\354=,\032\332\243d\217\334\315\377@\337F\271\206\257\r\3023\350\333\013H[g/ \177\265\221u\362[&\266\311\005\230\252\312k\247\355=<*\032\322\200\021v\363\2076\211\324\026\211\374\357\217\022\020Q\342\004\212\024<\303J\2270e\376\333\001k\375W\315\177A\340,\214\365_2|\365\3378\377\205"
+	.string	"\266\3022\360\3748\006\2061\207G\\\245\203^\374V\205\377\316\300.\376{\344\277\033\340\026?\306\360\337\016P\001\340\277>\314b\252\303\217WH\375x"
+	.ascii	"Q\277\355\360\333\017\354\322\177\2570\324o\023\360\343\247\377"
+	.ascii	"\256\360\301\376?\367_\030\370\004?V\300\177U\023\374W\313\177"
+	.ascii	";\300%\370q\003\356\346\307$\370\357\372\377\f\217\340\307\020"
+	.ascii	"P\361\343\024~\234B\004\212\037k\340\3529\361c\017\224\227\004"
+	.ascii	"&\376\233\341\307J\377-\370\237\302\217\205?\016\376\030\370"
+	.ascii	"c'\013t\257\177\f\372\257\016\354\003\303M\377\355\201\231\376"
+	.ascii	"\313\341\2779>\364g\271\377\006\340y\376\343\177\364\271\375"
+	.ascii	"s\335\217\315\037\363~\\\376x\367c\017\374\270\003?\346"
+	.string	"\300\2175\360c\025~\034\201\0377\340\307\013\370\261\210\037\027\340\307\037~\354\301\2171\370\261\005?N\3721\322\217\211~,\364c\375c\362\277{\376;\367\337\270\377\346\371o\361\277r\376\353\366\3375\377e\373\357\332\177\303\374\367\313\177\273\374w\313\177]\370\257\225\377R\371\357\224\377\022\377\013\345\277O\376\353\344\277L\376\253\344\277I\376\213\344\277D\376;\366\337 \377\375\361_\261\377\206\375\327\353\277[\377\245\361_\254\377\306\370\257\213\377R\375w\305\177\243\376{\202\377\226\340\277(\376\373\301\177O\374W\370_\365\277\351\177\321\377\376\376{\376\267\003\377\335\300\1775\360_\025\376\033\201\377\212\370\357\001\376\333\341\277\035\374w\203\377\006\340\277\025\3747\351\267\031\370-\005~\273\200\337\336\337\332\377t\3767\371\017\202\377c\376\217uuuu\177\006\376\031\206\277\002\346\004c\325X5\306\270\n\"\016\341\352\202\333{\213"
+	.string	"#\233\226\030JF\030\243\331\031\232!7\237\0028}\n\326\350\177t\341\302\242\311"
+	.string	"b\2215\326\002\334\336a\b\200\321XtI\273\371\024@\321\037\247\354HE\034\251,Z\006\035\230\261\nC"
+	.ascii	"rjK\313\276\371\024 \321\267\026\215\\\261\"\323Q\220\203\270"
+	.ascii	"\345A\310\215\013\313\214l|\032\237\306\250\fo\\4\223<abn\376"
+	.ascii	"G\250\217Q\026\316*!V\301q\363\337\262\327\377\037\037\270)\""
+	.ascii	"9l\324\325e:"
+	.ascii	"\275\267\325\323p\313\340`\006\f\207\207q\017\f%Gn>\005-\364"
+	.ascii	"s\\\226{\236#\346\271Lg\367\206\332[\373\211\016\b7\242z|\201"
+	.ascii	"\333[V\036\376\277Yb\246\273\034\241m\301\230\346\310X\225\233"
+	.ascii	"\317\301M\377\366\367'7\224\325\336\033k\034n\253(!\362\267\267"
+	.ascii	"\243\265\036\376!\213\355\006\3773\376\271\333{\312\205\262\275"
+	.ascii	"\267\275\243\215d\201\272\221\301\376\177\017{?\331\275\267\025"
+	.ascii	"\325\331\327\323\021\325\031\324\246B;suDu\366uE5\334,l\330g"
+	.ascii	"a\233j\350\365\224\275\236\366\336Ow\017\267\324\327\325\226"
+	.ascii	"\362z\002R\r\267\325\036z=\031m\251+#\252!\324\023\325\331\327"
+	.ascii	"\225\245:\363\272\242:\363\272:\332R\373iKA\261\240\245\274\256"
+	.ascii	"\250\310x]\031Q\235A]QI}]\331\241\327\266h\270\f\277\236\246"
+	.ascii	"\366\031\324\320\336\273jH\366$\2647\224\325~"
+	.string	"Jsa\354\257\"\214\335\265\355\031%\3030\016{\357\24746`^?\303\250}\206\352\210\227ojo6\033\006\002\236\354\323p\357\315bG=\331\275\247\206V{Gy\201`k\357\275\275\254\032\026V{hKAUE\201y\tMEy\261\330GX\260{\357}Eu\006\346\025B\213\2243\262\0355|\262TU^\233l\263\371\262\322gOCkg\350\f\310V\325\315Y\317o\325,\2262h<\362\334\022s\236\374v\367S\224\375\024\324F\205\325\005n\210F\214\305\315\347\020E\377\031O~SR5&\313\315\371N\306Zc\0133\222\353\330\263)>\344n>\007\034\232\316\203v\250\245A\335l\253\020\345\322\344\334\022\263\234\f\347n\250(\373)(\313\2317kp>df\250\264\271\371\034Z\304\201\203\341\264)y\341\346\374\346\262\361\262\006\346\346o\220\323\177.sK\314er\233\fv\232\336Ru\252"
+	.ascii	"\331\231J\002\343f6Ev\250\254\260\271\371\033\334\3505YM~\301"
+	.ascii	"\022\263[N\223\3218i\322\226\317\020\375\354\375\365\304-\263"
+	.ascii	"\3453DRi\366p}\320J\356\224\201\242\3637,\321\337\340C\177C\016"
+	.ascii	"}/\331\214\0170O>n\376\206\031\372\033\250\3645\324Y\313c\200"
+	.ascii	"\252\270i\231\335|\rj\326\206z-\310V\027\230[b\006\223\275H`"
+	.ascii	"\253\331\275\255\240\271\300hrb\260\335|\rZ\276xY*\016\253\334"
+	.ascii	"\334%\350\t\312\21607_\003Q\337\246\r\301\366\344,\231K\326\222"
+	.string	"\325,1o\311Wn\315\262\013w\311\226\f\205.o\271W\331\n\036\252Q\2008W\224\222\267d,O\352\330!\3621\007\244\n(_C\013m\267M\"\237$\247\253\3307 D\366\334\374$7\372\"Z\024\327\362\224\253um\340!\331\017\013\260\027\305\275\367\377\234\226\245d*\226\230\247d\264\347(wI\210<%\0237\324\323\002\210|\311)\002\267\367\320*\307\0326\235\237T\246\237\324C?\211K\013Y$\362I,\3643\274\351?#!f$\331,\215L\332m\361\205G\226\233\235\244\3413Td\266\333\222\314\304\022s\223\\v;\334;\255\205\234\204\b\357\375\325\204\254IV\262\345\005\265\017$\034;h\242\310\374\fT\36430\321I\356\026P[\033*\\n~\006$\372\031\276\364\237\217\0301\023\205\216\316\315\271\310\315\203F\006\326\360G\213\034\222\031b\304,\226\3112\330[z\237\325yR\334{\213"
+	.ascii	"?S6\\P\335<\204\303\217[Z\224\0307?\303\225\376\237\205Xb\036"
+	.ascii	"\313>\362X\376\221\203\020=\r\367\225O\217(O\330\340\366\336"
+	.ascii	"\034>\f\351\261\332Zr\3763\220\347 \267h \330\033\206\344t\031"
+	.ascii	"\n\271\371\342\t\361\f\344\001@\302\226\334|\2447\372Hk\372H"
+	.ascii	"g<vo\307\224.L<\344\260\037\251\341\360l\357aQ\206\255$1n>R\021"
+	.ascii	"\315B\376\322mzv\214\311\301\002Q\230\037C\261\2333\216\234\303"
+	.ascii	"\022\263\216\334\265\207\310/hR/\334|\244,\215b\357\275\355\275"
+	.ascii	"\220>\367Bf. 2TD\306n>R\224\3165\362\226%f\033\317Q\274\366\331"
+	.ascii	"\336\303!\fE\243L\226\233o=\220Euuuu\326\003\371g\032y\006\034"
+	.ascii	"\027\256\346n\376\363\f<\306\007\f\016=Dn\326\352\nR\024\303"
+	.ascii	"C\\\210a\262\026W\314-\343\266u\325\334\027\352\304\230\211q"
+	.ascii	"&\207\346\005\231\232\273\246\007\225\016\0369\304p\020\030b"
+	.ascii	"B\252l()\246qq\325\334:z\264\266\226\024\337\346\220\251\271"
+	.ascii	"v\340\356\235+\027g\005\214+\305\035]b\332\334Zh\315p\242\343"
+	.ascii	"\313G\021\257\300.\262\220\335;w\016\016\231\030\220\030dk2\252"
+	.ascii	"\220\335\301O;\314\210\215\275P\023\347\322Y\021W\\\201\247\306"
+	.ascii	"T\271p\007\212\255\311\030.0\261\"\21352*17\356\307+p\2130d\316"
+	.ascii	"\300(\206\030\203\215`(x\250fBT]QG\017\034E\035,\374(Z6\031d"
+	.ascii	"XO\310\304\360\217\035[9\204\304\260\202\005o6W\r\036s\331\\"
+	.ascii	"7xHV\002\032]\021\257\270J\273j\356\233926\356\235\2502\305{"
+	.ascii	"\007\217\271y\256\036\242'\243\275w\310!\303+p\326\032\263+u"
+	.ascii	"mp\026\\\007\237\311W\270M\226\201\343d\030\231\005\256\313U"
+	.ascii	"\331\n\267a4\370\013\306\223\247rT\226\302l\031\n\313a/\030\013"
+	.ascii	"&\203\325`8l\007\233\301\\\360\033.\3429X\016\236\303T\360\235"
+	.ascii	"\374\204\327`=\030\fN\203\331\3402x\017\256\202\303\344\025\231"
+	.ascii	"\n_\301Z\260\032~!k\3415\354\006\323a:xK\336\371\005~\203\273"
+	.ascii	"`7\034\227]\344\0268O\316\312X\030\016\026\203]\3101\260\025"
+	.ascii	"K\304c\260\224\343)8M\207\027\220\020Q\242\350\310\260V\r&E\274"
+	.ascii	"\302j\r\225\253\346\302\221\273s\351\336`1\0376\356\035)2d:\302"
+	.ascii	"t\024\303\334\030B\206\2650\2165cb\326n\220\335;c\356\236\035"
+	.ascii	"n\210sX\270\312\320\342\212X\013\217\3014\232\024\361\n<\006"
+	.ascii	"\277\300R\334{h\307\350\001{b\267\262V\263I\244u\201G\037\203"
+	.ascii	"\233>\206/\372\030\246\350c8\242\177|\344\030\312\217\211\340"
+	.ascii	"\"xh\275~\264\304l\301r\363\023\274\307\005\026'7\037\203\020"
+	.ascii	"\375\0377\301L\260\023\274\304\022\261\031.\003\241\005\260\261"
+	.ascii	"5l\206\225\020\313\220\f!\303f8\211\020\262\321\307V\2356\240"
+	.ascii	"|\f@\3641\204\351c\370\322\307\340\245\217\241K\333\271\020\307"
+	.ascii	"Gr\030\036\031En>\006.m\2136\211\304\300\"\221\307@\245\177T"
+	.ascii	"\324?R\243\177\344E\377\350L\377\350\210\376\221\227\376\021"
+	.ascii	"\013\235\201E\"o\224G\337\350\214\276\221\025}#%\372F?\364\215"
+	.ascii	"l\350\033Q\351\027\315\321\007\260H\344\213\324\350\027\205\321"
+	.ascii	"/\"\352\027\r\321/\262\241_\324B\237h\217>\021\034}\2422\372"
+	.ascii	"DX\364\207\026)S\202\324\210\243\303g\306\31064\334\243\344\215"
+	.ascii	"\217\026\031IG\006\307\n\237\254q\215\217\235\260\"h>XD\200\350"
+	.ascii	"\306\330\340\256\314F06\204\240Y\311\361)B\207F\224\214,&[\201"
+	.ascii	"\301c*\306\230\247\250\311\234\27170\310\251\333u'\016\256\212"
+	.ascii	"\254\202[[\323\342\305H\003g\211\031\221\342\002\311T\225;-\262"
+	.ascii	"\202j\300iiC\225\333\220C\234\314H\343\303\002\307\016,-k|\246"
+	.ascii	"r\021\350\216\223\"a>+z\020U\271\231!\303G\212\37416\334\262"
+	.ascii	"\302'j\304\032*9\003r\363p\270\367\260(H\255\213\212\226\317"
+	.ascii	"\223"
+	.string	"\221\237-0e@|v\f\"+g_\240\352\3102\233\305\243\206\325\236q\013\033\257\035U7\017\205d\310"
+	.string	"\3425g\321n[\231\252(9\322\254hW\345\220\212\313z\334\244\220\241\242\207\364\3425\207\225\004n\214\023\241N\325\0162O\246\243bC\f\354f\362\215|\263B@\335"
+	.string	"~\324\251C\332\301m\276\366p\225\331!\271\204\200\330\270c\346\306\2349d\261\316\006nu\236\260\025\3076\013'\r\030\261\233?\200*\322\r\351\206\214c\255\254\034\320\002\352\0055\270\275\245\345!\016\t\207\205\0174:$\251\361\214\301C\307I\2362%l7\177"
+	.string	"[\377d\033/!\030CX\254 \331\204\325m\301\300\3436\212\r}\325Iqs3\271\206\\\003\204\301#\216\2741\246\313\305\315\367p\205l#\333\300\314\272\312\260\236'TVP\320\240\271@V\02225?\334\252n\276\207#f\314\300\300\352R6TE\212\316\310\315\367\340\203,C\226!r\025\311#ifX\334|\017Uc\306\214q\026L\006V\0278\2621z\212\334|\017\244\030RL\246c\253\252\343\2023\"G\312\314\315\367@\r\f\2301.\003\\\225\334\222=\254\342\343\346{\2605<)eHz)\272b\367\336\362\212\222\332]8|\350T\305Y\301m\252-\017B\\\232\260\341\202\345\244\227\223]>"
+	.ascii	"\341^t\0161\027Ln&\271\334\372\260#\205\352\346\223Z\310-\377"
+	.ascii	"\317\017\0218W\366\334\374\016p\232T3\300\377\237\233#\216\205"
+	.ascii	"\271\233Of\021K#\004\311\315\327\336\013I\272@^\2412\245\210"
+	.ascii	"\215\233I+\344\025\031Pr\350\\\311E\212"
+	.string	"\230h\361\bR\205\r\254-\352fr\n\231f\211\037CR\371\260\210h\013\013*cn~\007:\372\366c\310\023\330\217!\311\263\223h\377O\220\231\227\251\266\233\337\241\215&\243\234$\376?\226G\2143in~\0075\372'\241\374?Bt\202\320\370q\363;\230\321\357\300\205lB6!\315,X\f\254.rk4\356\220NN\232\335+\\t$\3510\205\\B.\211\252C\246lI\327\220\241\023$H\3102\243\026\252\354p\025\021)*\211C&9Y\006\224\245\314\f\314\315d\013c\225+:\316\354\374\3779Z\3614\344\346w\340\"\307\3101\322H[\026\262(od\266\0249i\204\234\033v\301 \262\207\016F\332\315$Y\321\021\031\035bhr\210\215#\273\f\341bv\363;H\221A\310 \3045\256.\270+'\215\226\2669>|\220?H0*\\]>+\3054\344\017\213\026\324\346\252\314\311\315\027"
+	.ascii	"\032\322\213\364\"{py\242v\277\300\322\236x\234\3541\244\316"
+	.ascii	"\022\260\233\311/r\307\377\037\006\370h\343\332\021f\227ha"
+	.string	"\241\343\303\306-l\016\354z\375\310 \273\001w3\311\302}\221\203J\331\f\001t\351\352\312tn\226\260!\211C\253Q\203\304a\255@\355\341\002\201\030\230\034y\343$\216\"\032n3\220\220\\Z\354i\206\026\222\213\264q\005\253l\214\215\231\025/Sn\336\312i\262\306\302$\271\371\002(B\316 g\214q\031\212Un\226\fqi\301\310\r9++2k\216\021\263.\265-VGH\254\223Y\231\313\027\027\264n&\2572\031<oE\0377\377\355^\376\377\344\031Z\230\224\271\371\035\274!c\2201\332r`u\031\333\356X\251mq\341\202\254Z\253\322\300\3413tz\314ya\211d\025\223-\303\032\0354!\251H\252L\247\242*\r\034\256\303\305\302\217\233\337A\025\271\311MN=i2\322\340Ru\204\\qr\352G\310\033\334\017R\212\215\013\213\r)EF\215lf\304\030\273\231\204Z\212\343\004\314\315\347"
+	.ascii	"\215&\237\260\024\274&$\214\235\233\317\201\030\275\347{2\235"
+	.ascii	"\321\223\3210j\215\030\331\r\302\265\261\334|\016\260\314\315"
+	.ascii	"\351\355\004MGQ(\314\212\205.7\237\003%z\364\214q\031\270|\331"
+	.ascii	"\351\322E\212j\246\376\3661\216\210\021\260\252\233\317\001\217"
+	.ascii	":u\306<!\322\310)\002\024&\006\334\025<\037\363\2205\344\300"
+	.ascii	"r\274\375\377\t\262\023\225Dl|\033\357\034\251\323&H\225!\242"
+	.ascii	"\f=,\354d\264\266\2655i7\237\003\033\305\242\nXv\204\270\252"
+	.ascii	"\320\305\335|\016\250\332\264\031\345\320\250JRf\337\340\274"
+	.ascii	"\221\211"
+	.string	"\363Q\016\321\232<h\302\300!\331\254}\335\201\363\006M\020*\242\276\212S\262\346&\227\r\275\355\300!\345\346o\220\306\315m$b\202*#x\3104 s\306n\376\006;\316\234\031\327|\240\252H\013\371K\316\230.j>\256)ba\n\013[\3066:\265)Um\037\323\004y2%l\310\377\3416\2732$\307\315h\262\217\341\036\241\320l<\335|\r\366\220!3\262\241\250\032BC\b\016\310\223\2562\037\331\200\334\254\240\222\326\343\377\017\321\032\224+57_\2032kk$W\325\330V\233-Tqn\276\006M\302\204\3711\227\203t\241\235\335|\r\256\276|\tZR\325#\256\314\247\354\312\0349<]\272d:<AkU=\260\340\200\254\270\271\3317?\0031Y\262\214[\356\336\362zz#\265\252\300\340\340\3120\361\261F\313\307-Cohg\314F56\031sq7\207\375\274`'G\332\315\317"
+	.string	"\210\013.\370XU}\025\031\322\001\203\272\371\001\220\263b%\323\355\301#\304\203\n\016\0327?"
+	.ascii	"X\250P\221k\301GnI\026\220\233\037\200\032hh\343\224\023Yy\340"
+	.ascii	"p\327\0132vH\3718%\373\2003\343\215\205s\201\305\245\313\215"
+	.ascii	"H\fA\304\323E\005\214\231-7\037\203"
+	.string	"\"P\240\330\254\254:d\210r\240\321\251\335|\f^<y\0026gIP\0357Wlh\2348y\003&\207\306\227\271$dn\376\005-0a\262\306\216\0332l\213Y\326\315\277`\206\022%!\262\334\366\024\305\321`\263$O\222$\231N\005\260\027\356\f \253\f\312\025#FF$F\332\312\312,\332\030\f\255#\037\221\324\241A#\003\366\377G\310\310\327\n;7\337\002.2\262\221\210\b\342\023\265\037)\026i\350n&2\224\006\253\315\276\371\026T\215\215)\200\370D\355\246]\311#\245&H\220L\007B\233Y\327\030\245\205\225\\\331\217\037\231\356\356-/\354\226\305\004\253l\357-\017\026\206\0300U5x\360\030\305\236\200\231l\264\350\350\361Ql\354\"\322\262\n\322\346n\221nu\202\204U}}\215ay\223\331\315\242\n\030\\q\216\205\216\026\300>\206\345\033\003\260\342ev\363\337~X\270\250\373\272\371"
+	.ascii	"x\032\271\270F/\243\247([\006\007'mI\310\340\366\336\362@\226"
+	.ascii	"\271\221\362F\307G\257\2379\037P\304\233G\034c\327\377\037\240"
+	.ascii	"\266\032f\366\315\267\304\307\031s\\N\006B\206\206\223\233_A"
+	.ascii	"\233\036o\344\033\377\1770\233\032P\346n\376\233E\373\3773\202"
+	.ascii	"\341\201\223\345\346W@F\377\343\326\270\225gd\260\267\242l\254"
+	.ascii	"\"\260\027X]F\320S\326\346\346WPE\377\243\026q\324\032i`\035"
+	.ascii	"\340\255X\027\367\202\213\r\262\233\307\031CV\312\020\271\334"
+	.ascii	"\374\n\314\364+\020\242\377\321\352\2268Z\215X\031l1\257\235"
+	.ascii	"\325\001\230a\036\255!\034Y-\304\335<^\371\bq\341K\361\346W\200"
+	.ascii	"C\277\202)\375\007K#H\364J\341\005zh\bK#H\230\032\210\210\202"
+	.ascii	"@\240\251\223S\312\333\200iEO\025h\264\236\350\022\320\257,\221"
+	.ascii	"\376L\020:\321\023"
+	.ascii	"\210'TW\022\246*\f\242\246\005"
+	.string	"\275\322T\231\320s\307crRS&t\311)U\201\246\271\353\235\2772\003\031\b\236\031\356S\n6\241\247\272\006A\230=\341\217\207\236 \324\240\020\304\206\337O\210\242)\352\263\356L\025g\220<\221\252\2765E}\230J\363\227MU\b\314@'\236\031,y\250\272\006\203N@\001\003#&0\201\325\f\232\352\017\210\364\334\020\004\nZOt)\303\212\nOX\315\246\241\365D\227\204\324\021D\"\254'zb\b\236\277\362\\O\364\\y\346j\366\322U\030\302Q\t\346Z\362\316\036z\026\251)L@q\226\320CC0\327\262w\376J\023\3004\255\300j6\251e\n\253I\")US4\005\325\024ME\367\355z'\320\007\b\005S\025f \321\204\236A\025T\023\305yB\360\304\260\236\350\222\320z\242K%\004Ot\351\347>%\364D\332\333\001\205\273\337O\b\334\241'\260\303z\242K\350\211\264\367\373\tG"
+	.string	"\205\277\237p\004z\002\223\322s=\321%\241\373\224L\247s\035\357S\022:\235'\272$t:}\356S\002a2\225\301\337Y2\t\335\247\204B\005\201BER\311\373\224\202\300&\020\351\231\001\330\344s\237\022\210^p\311T\205ki2\031\335\247\244\301z\242K\353\320}J\353\211.\241HK\254\300+\177%\204\356SB\323\263\334\200\307+\221\356SJ\325\024M\025\244hZM\247T-q\376\312\021R\265,\221\341>%\325t:W\240\373\224R\250\346\272\226%J\336\016Dz^\260\236\350R\217\247\n\335\247\264\226k\360\347>%`\320\311\347>\245\0350\350\004\002\030t\"\001\f:\r\355L\247sE\205*\b\036S"
+	.string	"z!\254f\360h=\321\2455\230\216\030\232@\320}J\026\230A!*$\272OI\303\n\301r\375i*SH!\302j\232\200\302\022\320}J\351\271\356PX\312\353\211.\241\260D\216XQSU\205\274\2435i\305p\237R\223\260\204\331\003\321\373\235\302\022f/=\341'h=\3213\233M\275\t4\241g\2574+p\002I\004M\365\024\212\300T5\254\300+K"
+	.string	"\323\264\002EOZOt)\210\236#z'\202A\347\235\252\211\232M\372\bH\200\001\022\260"
+	.string	"\024>H\253\271[\325t\304\257<U3\250\341>\245\022DPM\203\250\031\354\340D\231\002(h\364\373\245j\220O\3204\325&\223\004\037o=\201Bh\323\371\013!\311\334\231\275\364\004S\025\376\316\222i\b\303z\237Rp\204U-W\022M\350\3713Q\264\364\361.\b\356\206\326\373\224\234N"
+	.ascii	"A\004U\323\304\251\3662\b\376\204#TsE\315\021\204D`\252L\030"
+	.ascii	"R\023\252\031\334\365L'\265D\205\273S]\217\326\373\224\310\340"
+	.ascii	"\320\210a\275O\tEZ\002D\023\220\202\336\322\212\232h\351\244"
+	.ascii	"\232\300\240\240\021\t\024\251\b\351\211\236\300\244u\027<\301"
+	.ascii	"t:W\275\356>\020a\356\202M\345\257\004\363W\242\f\236$\224\031"
+	.ascii	"L\336i\302$ai\004\211\037s\247\232\350\t\024L\236*L\203\246Z"
+	.ascii	"\024\334\t\251\360\355N\224)\210T\370vF*|>\336\232\242k\t6\270"
+	.ascii	"c\352\235@r\204]\262$\330\336\t\304+z\246#\200\302\036zj`C\320"
+	.ascii	"\211\222\003B\022\275\023H\204\236'\254!\364N\240\321\3123\231"
+	.ascii	"\230\220V\325\004\2420w\353\357\\wh\252\342TS\037\007\263\227"
+	.ascii	"\236\220b=M\224\252\t\347\212\226E)h@\317\322\0045]K\325\314"
+	.ascii	"\200\201\023e\212\243\237\311\343\205`\256\245J\324k2\352\375"
+	.ascii	"R_\320<S\340j\0069\230N\347\n\024\224\001\tM\317\365\354\251"
+	.ascii	"\345\t5-\241g\232LI'\312\024\273\" \025\276\335\007\301`\t<\221"
+	.ascii	"\376\216R\250\246\211\224g\252;\242\2445%2\201)V\2433\250\t-"
+	.ascii	"9\004O\024\345\006\364,\233\216\202N\273^i\372\312\025\322\364"
+	.ascii	"\267SM\364,\325u\227\252\274\222\002\364,\233\214\216\324TU\315"
+	.ascii	"\rLL\351*\344\355\202%J\f&0\305\272\373@5\327\337\311\204A\205"
+	.ascii	"o\207\236*|N\252\271\3662\230\275\364\204\021)X\260\236Ng\005"
+	.ascii	"\314_\023\032\302\006\364,M8Z\315\240\211\001\325lj:\325\024"
+	.ascii	"N\244\277_\b#\370x\250\260\374a\2603\203B\f(\312\237\251\356"
+	.ascii	"N\224)v=s-\325&sE\317\f*N\2654\321\263\002kP\250\372V\244\021"
+	.ascii	"=\313& \223\207\226&zeoh\025\002Wa\272\303@\256\2500\345\355"
+	.ascii	"~?\223\267\333\245\253\260\334\260\242\346\031DKu\345\260\006"
+	.ascii	"\323\264\304\216\211I\233N\245\005\200AN@u\207\236NB=\323\004"
+	.ascii	"\006w+j:\255Aa\bze\022\331;\201Df\2604U\036z\232\277\336y\004"
+	.ascii	"\f\356\314\265\374\245@\325\\\321s-\325\035\212\322i\307\304"
+	.ascii	"t\2643W8\201\301\035\023\023\221\232\256\274\222i\347[\323\324"
+	.ascii	")\270cb22M\250B\336\216\t\370\333\241)z\030L^\251\356~\246\t"
+	.ascii	"\363W\024DM\240S\312\3335\225\301\335Z\2260\221t\237R\357\004"
+	.ascii	"r\350\235\300 \247\0245{\273`\320\344\245*p\327;\201Ghz\256\250"
+	.ascii	"i\302T\201\025\244(\177f/\003s-\315\336\216\211)5W(\327]\212"
+	.ascii	"\362D\211\nU\016\356S\n\376RuES\336\216\247\202\3401Y@\202\b"
+	.ascii	"\243\023\351\217\310\327t\372\212z\"~\245\272\nM\364g\327\023"
+	.ascii	"\321C\313\022\275\322\354!\235H\177A\276\246\323\267\353\211"
+	.ascii	"XO\247\363'\324\023\3213\203EC\353}J \232\200\032T\323\351L\241"
+	.ascii	"gj0a\222`\256%\006\204\214\320\364\f\252\246\tt\311\351\304\210"
+	.ascii	"#\247\023#z&\017M\021DU0\203B\2425\250\nE0\203\302\241\024\352"
+	.ascii	"j:\231?3\205\243u\347\023l*SHO\362\227\362\3225UG\254j\n\f\242"
+	.ascii	"\245\232\202\206&\264,\261\236\"\254\251/H\202\031\024\026\231"
+	.ascii	"0{\330\024\376\312\f\254f\220\211\t\005\363\327[\372\225\353"
+	.ascii	"\331t\3664\240\247S\220\371[\327T\365\255(J\247\240u\227\200"
+	.ascii	"\020+z\nu\017-\235\234R\036z:\001\255\2500\035\301\374\245#\210"
+	.ascii	"\356S\002\261\372\232\316\037S\005Cf/=A5Q\234N?\2774\025a7\366"
+	.ascii	"\314\240j\232"
+	.string	"0\325]\360D\231\002iEM\236j\002wj\272\246N\033R \ns\007<\177L\276`\251\362\210\356S\002\300S\240\251\202X\323T\005\021\024\334\215\340d\256\301\024A\"\024f\017]\352\235\300\"\023\347\312+\217\314^\352\264k\022\2260{@A\336\271\006\317\265\\\203\273\025\202\345Z\344\343\255\347\t\022\301tD\002\314\337\311\224\252#\314\265T\223V\340\245?\236j\232HwB o\310t:S0y\245j\002\212\202j\236H\201\032\324\322\307\313\252y2\235+j\366\226zj\231\226(R\341;\301\f\372Hs-W\022hz\256\245*l:\231\320\224\207\301\\K\f\230*N\247s\005\242\240\232?a\317\364\361\202I\353n\001+z\n}\036\"\304\b\031\250`\001\0234Oi=\321\023\004\217\t\004z\226N xj\020\204R\206&\364tRCX\201w\256$\314_\211\0225\217\376\373\320\030\003\206"
+	.ascii	"\250\343\241\244rL\326Q\210Ie\f2D32\234t\223\026@@`D \020\266"
+	.ascii	"M\353\003\023\300C\rL\365a\"\206N\021I\222\202\242d\3307]tNZ"
+	.ascii	"\020?"
+	.string	"{-\262)8\204i\006\021\306\300T\236\006\002\267\232\002\266\035\216\274\333\217H>\257\005\227\273\030\017\032\324\003\022\206\217(`I#Dc\357\242\355)!\271"
+	.string	"\200yB\375\230\242\357\334\370\005\271\225\214\216m\316\b\261z\270u\314X\335\034\234\353gX)"
+	.ascii	"\372\005@\220\003l\243h=+\257\317\371C^6\340\225\321\022\307"
+	.ascii	"T \b!3\321\322\370$\216\r'\"\245\023\t\314\002P\036\b@_\277\270"
+	.ascii	"L\1777h\276\300\273\207\201\r\325\025\314\232\003K\213UVfP['"
+	.ascii	"TNI\246O\311\2227\234\361m\200\035\347\307\\,\340\206\230\366"
+	.ascii	"\341\335o\317\f\325@I \344M\211\342+\235\370\247i9@Z\271\223"
+	.ascii	",\335\310\244X\206y\201@\376rB\357\204\354l\214\271\273G\037"
+	.ascii	"\220\013\3751F\3337\360\2024\356?f\321\235\346\272\b\223\341"
+	.ascii	"\364v8\353\021\027\273\211V\212\0334\263)\201\220\037\260H\245"
+	.ascii	"\225\204\002\355\t\200{z'\323`FI\311\264\022\b\002\026G\017\220"
+	.ascii	"\017V2\225\330eYl\203+\017\251\233~Z\225A\264\264\207F9\313m"
+	.ascii	"f\204\352=\337\2738Jh\3044\370\276Zz\371PdL$lJ\377\223\213\002"
+	.ascii	"Iu\313\272\361\336\256\240\3424%&\330\340\037\234\263\376\310"
+	.ascii	"n\334(D\301\341)%\006{\233\263\275\026\366\336:a\\\263\332\201"
+	.ascii	"\245\0029b<\006i\314W\264&IW\372\031\220\250\273\017R\267;\\"
+	.ascii	"V\035\222U\024\242\327Ui\302\020\200\17704jN\215\312\375:\250"
+	.ascii	"\347*\374\0266X\343\033\307\217Y\362\017\316\264\234\0050\204"
+	.ascii	"92\234v{~'\363\365\006\257FG\266ly@p\3019\322\341@\351\016tn"
+	.ascii	"\255Qr\366\022W\363\3620\250\255\347r/\231\261\254$\201\266\363"
+	.ascii	"\330\003\225k\255\244\323\263bZ\302i\340\0339\330vX+\177M\356"
+	.ascii	"d\364E\022\210\201\037\003i\347\265\246\205\177\226\037\037S"
+	.ascii	"\306\322\217\033\032\267\3070f\262\222D\365[\316W\005\257\034"
+	.ascii	"\377E\034<\303\037<\203\033\304.O\017F\251\312(\264g\212\240"
+	.ascii	"gTn\230\254%k\036AXy\313\217a\004b\264\210\216T.}i\333\277:k"
+	.ascii	"4\313\363\243\373d \325\337\021\343\203f)\031\243a*\312\363\257"
+	.ascii	" \364QS\031mj\205\226XG\365\177\263\340\303cr\340C\337=\304A"
+	.ascii	"\t/\216/o\250\327\334\006\321Z6\372<\263\214\322$.C\312\200\305"
+	.ascii	"F\024\177`o2\345N+I\353z\201+\022\252}\213\360\317/\004S\221"
+	.ascii	"\355\\\244\250\265\007\n\325[\002\257\253(@\r=\363\260\361n\201"
+	.ascii	"\324fX\236\2031\233'j/\201\027\tAJ\206\247\231\263\332\375\223"
+	.ascii	"]\256\"\374\030\375\375\321a\362\004\253\240\340\251X!c\321\231"
+	.ascii	"\230>G\362W\227`\241\365\227\204\237\350P\002\241\030\344\344"
+	.ascii	"\307"
+	.string	"\001\222\023\261;\f\201\240\330\251\2010@#N\023\003>e\305\314\227\306\030\341\tJ\225\034\370\326\224\205u!\020\275\363\230\265\344p\231f\350\352\003\367\270\317P\t\037\210\300\006\346n\270\005\344/\363W\261\241\365\336\200a\013K\216\035_O\031\316\244{\241\340\247\342J\267\022\355\265\323n\267@\004>GYy\227WV\251\341PV\371\034\374-@~\325\332\313\216#C\272\332\211\247\351\367\237\226\326P7\3326\215\326%I\264\023\276N'\376V\213\270\013\256\333z/\226/\257=\321Q\367\344\241\\\365\300\263\306C\207\245\333)\017\204\365\361\005\371\253b\203\376\210k\t+6y\036\001y\326\030\006:X\356=~\265\334v\301\240\037kf\021\200\005\210\r\356\302\364N \200\334G\004h\0201\323y\217:\021\b!\f\220\217[\251\250\341D\312\375\212\261\377!\2013\202\210\364\304\370Wn\241\307\250\360J\232\225"
+	.ascii	"\270\\\207\214bp\032\370\232!\322iK\334\024\022\271\201\367\374"
+	.ascii	"S\300\354i:$W\334<pH\341\311d\367\"}t!\033\261I\213\302\357C"
+	.ascii	"to\344\362\3444z\n\036s\377/\230\311\016M\350I\267i\2312$\223"
+	.ascii	"T2\357s\340k\027\272-\266\333\352#\004u\020gb\225X$\347\212\351"
+	.ascii	"*\255\217\257\ff!\177\343\205\204w}\2747dd\2560\356\323\366\353"
+	.ascii	"\343\315\250}\2368^\332\253\303@\207]\377\207D\351\312E\345N"
+	.ascii	"\345\344\324\262@\221a!`\3773\214\332\213g\352K\236\331\243\326"
+	.ascii	"+\t\336\264\236'\256#\216\314\005\024_\020m\026\\\323\001<\334"
+	.ascii	"\377N\355b2 i\270(\316\360(9\037h/\225\024\254\007\227C\230\t"
+	.ascii	"\241\204"
+	.string	"\342\237+\3046+\262\030/\t(\244\224\r\333\377\366\314\257\n\266\342\257\200\236\236\201\331\"]\326\213q2v\026\335\273\237\234c\021\323\3348C\242\221\273!N\337EE\221\207\314\033\313\227\374\003\360\273\234\227\307s\355~)\272\363\303\272\371%\211;\013\310U{\372D^\326\327\340\201P\237\343\200\375Fah\254#k\275\354\250\347\351^\234Y\334\310\213&r\357ZK\360\256\305<\353\n\322\271\254\262\243\237X\217O\352\225\343\004C\336\227K\3149\0354\311\277\240*Ca\351\021\265\253\350\032\013%|\267\245\222\354\303\276x=D\301M\276\263\233\324\220\377\336T\230\351#\271\355\322=\031\247\250\007)\020\365\255sT\303nx;\031#N\227L\236v\003X+\374\310\301\215\246\375\007SuU* \333\244N;-|;G\375=\377\203\305\240\013\221}S\211\351\333g\234\224M\305\300\312?\332\277g\202\350\262"
+	.string	"7\233\337X\216\212\376\263\f\357\251\213\235i\337\027-\335\262\352\004z\241\026\364a\"\242Yk\b8\334`\004\314tb\332\224\253\352\316~\3735\003 \240\034\266\024*^\270\377\\\337\035\372sT\266\226\3676\377\377\202\033\366=\037\212\236^\2456\226\361\270\245\202\260\204\352P\361\311\233\256\016\3076c\325\207\202n\027\223y>w\214X\311\212\005\370\3549\247\372\337\307\241\3257\253]\356\336\376I\366\270\276o\372:\376P\233|\307QK\004\fDGd\270\302;/\343I\220\013\365\303\357P\320\345\205^\0160'"
+	.ascii	"\224\373\347\271\206\006\365O\2653\257U\344\n\030E\243s\f\356"
+	.ascii	"\230w!\312\323\365\350\n\367\354\253E7\365\321\253\232\373\257"
+	.ascii	"HT\2336\356$\037:\3057KN\366\254\336c\365E\330+:yg\027\003W\002"
+	.ascii	"\361\020\340\031B}\365\265\3724A\223\274\255\203h\027\032\315"
+	.ascii	"?\311V\235Q\374*\3111;6\362B\206\200z\177\\\025\234'\217\330"
+	.ascii	"\007\226\334\332\220\276@\262\\\203\036\372q\377!\330\335\332"
+	.ascii	"\261lCG\211\253C\233\3273\212\364\331\001\232v\204.\027\202\274"
+	.ascii	"\362\332\212\030W(\001\177\227\373\367\204T\363\324\311\356a"
+	.ascii	"\245\270\036\252\372\206}Q\236]\366\335,\246\360\220\337\257"
+	.ascii	"\231>\017\344\302\335ss\215\021\036\302\305\313\364cp\363P{\343"
+	.ascii	"+\030\360\253\n\320\245\323r\024'$N\023\265,\006\351\302\032"
+	.ascii	"\352\331K\373\321,\367T{\025\202\243ed;\221\227G\274x\177\317"
+	.ascii	"\376\261\251I\354($\336%^p\221\013\226\016\030\303h\326\235\346"
+	.ascii	"rx\320\241A\020\004\301SY\304\310%t\313u\345j4\202\032;\331|"
+	.ascii	"i\252\371\353\307AQ\241\366H|\361\326\342\033\235\230|N-b\307"
+	.ascii	"D\241y\316\023\273\243\311\026\243\203\302S\234\361rg\005\260"
+	.ascii	"\250\343\377I\324F\3509\013\334\223\333\354\002\224\273\034\223"
+	.ascii	"\222\305f["
+	.string	"\030\2713\242<\216\322\260\221"
+	.string	"r\221\001\344\234\002=s\344k\322\350\003\373\006k\311\267\001\306\351\b0\365\267\"\2449qB\316\345\332\345T\206\347\251\b\005\230\262tH\b\202\345\345\262\324\346\351L\265\204\216H\022\227\251\345P\0261-\225N&\230\351\350\022r\376z\212\213\264\304\017T\321\255\001\305Z\257\214\305\022#\275\254\017\304\257_|\242\r\334T\251uX$\251-\030\0311\3612C\034rxF\300\361\304\374\003\220>\264\205\371/R\230+r\356\375#\331<\356'\277@\263+4e\371\202\034\\}\026\216\020\247$\217T\272\337\022CA\264\337\303y\336\n\356G$\332\363\370y\020C\330\341&\344Q\2250\357F\306a\226?\267"
+	.string	"\023\020\230t\026YT\f\232\366\b]0l\246=\340\271\235;\034:\232\275\360\0062\365\274xbVw\036^H\022C\301!5\231e+\213Y\303\374\313\222]\227\024\330\324\233(\225\375.\321_\252r\345I\276\364"
+	.string	"\372\\|\276\355$X\230\311\245\316\363\231\325\222\026<W\3148\201\260\237\347\303\270\342\021W\217@\242\350\271\331\004\f\b\211\316\321\341,\303\0228\357\036\324\024\220\356\364\351\340M\353jP\037\351/\0326\035\f\361\311:\324\313!B\300\200\357\333nX4"
+	.string	"\255\273\016\277jM\221\220\3224s\252bA\271\003b\347O\361\017\330d\354`c\"\t\230\307\340Ag\213\340*\270.\202nv(\233\271\232\234\372a\b\356\201\262\343Z\207\006\261\264\322\017)\214L\330x\371SU}\245I\202?\376\356\270g\317\354\224~\325\001)\245\304\317\232B\r\371\214e\223\352($\016y\224\257I\235A\006\232\374e\271X\275S\206[\331\003\241\004\023\340\320Z\363(8\240\306I\311\312\212)`eR\025\326j\332\374Q\020\240\005\317\231m\374a\337\223\201\227\211\3015rG\222"
+	.string	"\367!\244y"
+	.ascii	"\222\200\036\221{Xp\"K\312\264\336\2444>\2401hkJ6\027\212\317"
+	.ascii	"\255H\300\3530\004@\307\373\006\f\227\225\003\371N\035\361o\020"
+	.ascii	"\306;JO\257\316}x\377\230Uq_\031\371[\t\n\316\234\030\302\254"
+	.ascii	"_#v\200\312h[\206\371\023@nGg\bp\007\226\006\272\321J\001\270"
+	.ascii	"\214H\376\366<]3\235\256\253\345`\274\301\261Qp\243\203\025_"
+	.ascii	"\026A\356\026\201\347G\373\216~\t\306\367\267ptY\317\307\205"
+	.ascii	")\221\301\233\305\033Q\346\n\307\337\220\002y\032\0357\234\234"
+	.ascii	"p\351\315\304\255\320\006\\\240w\017\334$0\340\347#\251\331\315"
+	.ascii	"\323\\\223\263\006[\316\345\030\233}\325~)\337\316\344\223\306"
+	.ascii	"\027\231\374`\304o+\257\343\336\266$\223\375\277\2706+\245km"
+	.ascii	"/1Z\224\263\307\342\rs\357\n\324\023\265\273$\202\317|\334\304"
+	.ascii	"lB\374\001_\337\270\337\375\215\307u\272\031\303\201\274\t\326"
+	.ascii	"\2668\375\303\372\320*{\261]\001\177WZ~\265j\003\272:\237b\023"
+	.ascii	"\344u\034xN`\255\3455\3302\367\r\310'\037\312\246\200\215\202"
+	.ascii	"\263\t;X\257|t\022\361\005!n0\361A\b\211N\250Bt\005"
+	.text
+	.section	.gnu.lto_.symtab.2a14bf723de79f6c,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"requiresSpiLeadingEdge"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"tasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"unusedPinsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"motorEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"motorPostInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"baroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"pinioBoxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"pinPullupPulldownInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"pinioInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"gyroSetTargetLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"sensorsPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"initBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2a14bf723de79f6c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-f"
+	.string	"no-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2753 @@
+	.file	"rc.c"
+	.section	.gnu.lto_.profile.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\0031"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"M"
+	.text
+	.section	.gnu.lto_.icf.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`_\006M\032"
+	.string	"\264\034S\007"
+	.string	"F"
+	.string	"\331\342\211\330\013\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\251\317\374\337\b\003\210\242\345\320\t\004\255\260\270\007\005\250\263\360\200\r\f\002\003\002\003\002\004\006\240\342\234\212\n\007\244\254\342\337\017\026\002\004\002\005\006\002\004\002\006\007\002\002\001\002\001\002\b\002\t\t\370\326\276\261\016\n\013\f\r\020\354\330\323\206\t\n\001\002\002\021\262\320\372\304\003\034\002\004\002\n\013\007\f\002\r\022\023\253\371\220\363\b\034\002\016\002\016\002\007\002\017\013\b\002\020\001\002\017\025\026\027\236\307\314\315\0046\002\001\002\021\002\007\002\007\f\002\f\002\022\002\022\002\b\002\b\005\b\002\t\b\002\t\031\032\352\263\360\321\b\034\035\036\037 \237\325\371\277\t\030\004\006!\"\315\343\301\244\013#$\245\331\372\241\016"
+	.string	"%\363\330\236\330\r&\354\206\342\366\006\002'(\377\341\234\356\013)*+\004\002\004,-./01\210\235\247\230\t\002\002\023\002\02323\261\205\367\303\001\n\002\004\002\024\004\002\0244\220\300\337=\0045\330\277\200\376\006\013\002\01367\347\273\234\355\f\0028\215\317\243\217\013"
+	.string	"9\201\255\340\307\001B\n\002\001\025\002\f\001\f\026\002\r\001\002\r\026\001\007\002\n:\317\211\341\254\b\b\007;\312\271\257\224\003\r<\326\316\210\243\003\242\001\002\f\021\025\001\004\007\001\002\001=>?@A\205\307\204\306\b&\f\002\fBD\364\217\372\322\017h\002\b\002\027\007\030\001\002\030\002\f\f\002\031\002\001\002\031\002\b\002\032\001\002\033\004\002\034\034\005GIJK\232\214\265\246\f\006L\350\300\306\254\005\002M\273\233\345\352\f4\001\023\002\023N\264\323\204\275\016\021O\313\322\375\213\007"
+	.string	"P\247\226\246\235\017\f\002\r"
+	.string	"\200\324\250\001:\241\021!I\222tp\2021D\305y\021 A\305$\232M\222\266\003\251\227\b\250}\201\272\235\346\305\t\370o\215h\214\321}\251Y\003\022+>\367\177\364\001\316\324\037C\221p\360g\025\023\3163n&g\330[\263\223\r\004\017d\310sx\267\303u\336y\\\002 \270\223\036\263\334~\346\364k.u\275\257h)\002e\216\352G!2\275aI\177,\f$\322t\312\320\210qS\026\234\224y\007\004k H\336sW\372@3R\313"
+	.string	"\226\223\372\006\316\265\221\037f\365\024\306\200\232\313\246\255\325\035\350\316\272\025\ne\225y\223a\002\264jH\247\230\306\016z\306%q\017y\332gr\201\027\356x\271Q\314f\274\353\246-\372\021\324J<\333c\003M\330Q\234lt\346\001\224\265\227\332\373\240\357\b\366\375&\013\017\314\312c\210d^}\234\363QIq\006\332\257\016\373l \204\266S\211W\004|\370<\016M?3j\300\315A\2658\0167\033q\333^\214e\324k\331\251H\330\301\370\346\236\205\253Bqv\n\326v\222,\354\020\353\267\303\253\245\345\016q~\006P\3022F\271y|V\037\215'\2126\377\376\250rGh\230\3567\201o/\231\370\233\307)\255\343\016\204^#)L\263\364\374"
+	.ascii	"\211S\002B\224\030\366\377\236\226\325\334\027\3275\216v-\221"
+	.ascii	"\202V\315\252\221\2562]\324\356\364"
+	.text
+	.section	.gnu.lto_.ipa_sra.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\r\006"
+	.string	"\262\007\027 \200M\241\00330\0033\300\f\231P\007\005=dZ"
+	.string	"\b"
+	.ascii	"\b \360X\020\243\020$$m\231\002\356g=\333\341\354fjT\315(F\275"
+	.ascii	"\224k\231\025\267QJ\353\311J\"\203\250\217\3729\032\214](\022"
+	.ascii	"#v\332Ci\004\252\275\031\264@p\016\266KP\006t\003H\321\265;\271"
+	.ascii	"P0 \260\002\"#\333H\0214\356\344\2325\367\221[A\r\036\260\341"
+	.ascii	"+\300\300\247i\361*x\036Kq0Tc\237A9\020\300\254\215K\210\203"
+	.ascii	"P\222$yx-\352\fdS5\210\261\307`\324H\r\246L\263\\P\n\340m.\366"
+	.ascii	"\036dp>\304\214%\2553\221\021B`Q\231\225e\362\025$\036\2116\207"
+	.text
+	.section	.gnu.lto_.inline.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\035\013}'"
+	.string	"V6\267H\240\330M\032\003\220\023\372\355\331\313\214Snx\223(\034\2573\230\350\365\177\365\347\035h\017w\314\003\341\340u\260\305\267"
+	.string	"\320\221\036\354\356\332x\n\343\215\210\367\370\302\373K\347\375{X\343\2661\300\357\013k[\333\266\267\334)\230"
+	.string	"\250"
+	.string	"\247"
+	.string	"\342&\311\247\324\304Ez*\20511\t\332v+\232PcM\262\366\245/\335m\215-T<v:\365\255\024\225\360\353f\242{\363\266\230\3737@\254\326\312\340\366Sq\345Q\376\365\331Y\024\362\256\032\335\244\245\201\201\032\323\2320m\032\331\002\013\016\321\351e\013,\3703=\332\027[`A\b+>o\367\352\216\265\326\036\272O\243\002\257\316\273\3756\017H\247\367\346\276\275\255\265\326\332\033M\253-\260 \007\332\277\263R\376\bV\356\177`\345\363y\2647\240\306\264\204>h\033\234\322i\177\036\355\225(R6\006\233\300\353\306\232\375M\035WUB8\360X1])qp\316\272QN\026\367&\225pH\266\243"
+	.ascii	"q\321\2061]e\355\036\210\210\336\004\363\246\224\222\223XmQ\314"
+	.ascii	"\335\333\246\340\322\224\355\315\331\314\253u\267\322\267H\250"
+	.ascii	"\204]\001\3367\315\250\204]98\327<M\315yj\352\024i\304\34643"
+	.ascii	"T\302\257\240q\006@\177\257Z\253\320\224U\265\326\235s\362u\343"
+	.ascii	"\272q\3767\301%\251\261\366-\367m\267_d\254\370X\337<#\373\022"
+	.ascii	"S;\267o\346\260\002\365\345\3467\241\220}\231\2115\271D\006\270"
+	.ascii	"\2479P\r\227\017\316k\3163\345\225"
+	.string	"\354Y\244\247\311\232\343\262\346\322E\222\332\317\"\215{\226\230S\206X\252.\373\302\272\221.\235\013\244\270)\246\313\337\224\021uVF\363\220\264 \007\0320\2329\264\202\321\336(\005\3358q\314\337\034[\212\t,\3531F\202\212\035\317\212\034\211\360\204uc\216m\276\2247Gx\320`.\020R \372\226v\002\336no\006\375\276\315\002\242:S\336R\235\334\277\025\273\265x\333\337\263R\356\263r](\251\365l\222\244\317\243\334?f\270\260\306\f\021\031\317d\001Z\034\006V\230,T\002\003\241\306\234\340\036\361\257\210\265y\252\025\210[\367\272%\033\265?1\231\304h\n\"\237NL.1\232\206\\\345\020 z\265\017&VF\027/\245\2652\003\032\031\312\341\035\226\337\320\2264r\235\206NQ+r\3540\233Z\312\033j\336\022\023\310\r\257\250\035\232\330\0314\312\312H\2565\214C8\324\"\340\267Z`\301\245"
+	.string	"g\360\321|o\351\264\215\341\2666S\002\240\353F\335X\337\205\241\275\267\372\222\300\222SZ\247<J\351n\316\227n}i\221\254/-\332,Q\224\276\351\344\252\352\207\316\2230\246#G\271\237\213\001\200\366\250\0219\347\b\315\314h\212\222\024\032\003p\242\231)\262z\022"
+	.ascii	"\365(\210\302\230q\312\f\211\004\024\024$)*e3 \016\003\213\314"
+	.ascii	"\373\020\346\013-r\201\332H\277\263\250\006 q\236)~\277\224S"
+	.ascii	"*\n\007\346j\2008\3148\274J\376\b\343\336\211\307\007&\2430\321"
+	.ascii	"\376H^OQ\272c\261:IH\016Vy\323\264\007\322\250A3P\375\263\243"
+	.ascii	"\374JY\222R.\213\023d@\001\205\200y\211GA)\263\244t;\321\331"
+	.ascii	"N{\273\035\221j\244\037\233\224\327\224\345\240\274fb\276\212"
+	.ascii	"\036?.b\331\215B\256a\262\t\243\026\006Z\016\302\273qQ\224j\236"
+	.ascii	"\203u\266.\267\353\240\365\253N\200\017C\"n\037\365^E\274W\232"
+	.ascii	"W\224\370\260\244R~\\\201\004A\017\230\007\206\252\213\376\363"
+	.ascii	"\353T/\3042?D5\271g\324f\230\t\351\345\205FS\313\357\004\316"
+	.ascii	"(\223K\302\030\211\357\320\330\351-\277`\005w\3604\304sc\031"
+	.ascii	"\313`PsA\230\311\306`\032\242V\202kC\215R\313W\266\260\301\322"
+	.ascii	"S&\274\256|`\252\367TV/q\005\035a(\365waE]bm]I[\246\035\273\021"
+	.ascii	"k\002\355\301\356\t \017e\256W\245PC\215\003`\216\273,\332\223"
+	.ascii	"\002 1C\375\202\367\364p\222\021\274\312\315Tx\336\026X\236\021"
+	.ascii	"\234\314r\3228\027\306\024\002;\317S\266\340\252\r\272[rH\b\260"
+	.ascii	"\271\303$\332)\2216m\213S\017NN9\372\312\006\343Z\277\277\223"
+	.ascii	"\255\272\3600\307w\322a\003\311\247\330\234\271L\306\034^\236"
+	.ascii	"V\244\n\234FX)\363\004qp\177\n\323\230\005\302:pZ\360\227\242"
+	.ascii	"\256C\233\004\236\b\007\032\202\242\326\340\247W\2669\370\214"
+	.ascii	"\002\326\215\317\267@\331\020\242Dc\322\341\036z3}\236K\242\303"
+	.ascii	"&\362\024\346\017\237\213$/\363S^\323\004\225\270\271@\216\001"
+	.ascii	"\207\211*k\0225\2053-7\246\361K\213j\207\237\220\271\252\305"
+	.ascii	"\335\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\332\004e\017"
+	.string	"\026R92Po\322\0010S9\323X\355\0346^l<\242\252*\216\031\311\225\304\224\354zP\231\320i\360\251(;\232m\374\320\007\245\321\237gqe\262\211\334)\245)"
+	.string	"-"
+	.string	","
+	.ascii	"\032\373\001\235&7\306\211\b\320\212\334%\265\267\306Q\215#\267"
+	.ascii	"Ml\356\311l\n\335\204\354\005O\203'\301\363\3026\253\247\023"
+	.ascii	")\376\203\313\220-\337\314\255up\t\202\316\330o`\b\265\326\002"
+	.ascii	"\310}ZO\253\320DHp\035p\227\273\234(\355/L\347?\020\270{V\317"
+	.ascii	"m\345p\234&\355\030\307\220\203\316D\026m+(\032"
+	.string	"\242\346\275\227\3673{\317\325\204D\033a\026{\305\377@\244\235'\355\256\350vw\345m?Z\217\266\303\345\213}\265/\271.\222\316\377\326&G\273\321jX\305\177]\214\233\215[|\252D\225\336t\216X\031N\361\033x\250aMHLH\322\312\262\006P\0021\212\231q\003\022\300S1\204\301\244s\f\032\n2I\322:\225\2151!$\322'Y\004\347\033\251@\037\336\231\"e1\363\252\221\374\344!g\024\027\350\026U\034Z\3253A~\341j\207c\255\355\326\237{\3374\224\262\322\203\t\003\213\320*\244\364e\367r\261\007>{\233I\302\261\204\003A\263R7I\245\241\003\213\326\255\373|\226\200\260\216e\025\245np\003sJNxh\222'\321Y\005\022\270\177\337\275\340\243@\311\333\224f\331e\241\225\260\247\305\222\343\033\260\223\341\326\033\333$8\032\221\024\266/\340\225\361\377\352\2632X\226w@\034}\314"
+	.string	"c\031G\271 \314\341\375P\230k\310\f\036i\351FN\353\326\f\037os\262"
+	.string	"\213\344\363-S\034\347RrIH\323\357\370\361\341\341rfg\242G\255L\310\0055\271X-b\201<~\250\213\032\013\r\035!\226\240Z"
+	.ascii	"z"
+	.text
+	.section	.gnu.lto_.pureconst.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375 w\005\003"
+	.string	"r\007\027\034`7\244\003\363SJ\314\006\3510\fPp\372\322\323t\244\374\361D\224\220a\033\337\016W\264\n]\320\371\271\236\261sr\306\315\251\3712/\314\353\262\262\334\312H\271\223Q2F.\344>\256\3436.\343.n\272\212UbD\214\207\323\360*\234\204s\360\022|\177\201\017\360Y2\263Q"
+	.text
+	.section	.gnu.lto_.ipa_modref.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`F\003\245\r"
+	.string	"\346\32161`\2132\034P\020\344\0322\360 #\203\227 H\020EQ\314\212\312\351\302\b\264g\355\333\177e\355\025\264\005D\362\301vW\027\0258\316h\311\2262\005&"
+	.string	"*"
+	.string	","
+	.ascii	"\356Rn\351\254\360\tH\375{\317\003\032tR\332)\245\307\031\r2"
+	.ascii	"\265N\207\316\226\267\375)\021%\242H\355\353)\013?L\347Cg\244"
+	.ascii	"<R\310\0170\342\300\227.U\244y\333\330\325\347,\rI\337\263D\257"
+	.ascii	"\357U\245\3714VbT`4\365\321\002s\347\002:0\317\223#\351\244|"
+	.ascii	"\242i\206Sb6\345\033\314Ba\003\303\002I\234hJ\205\211\225\t\207"
+	.ascii	"n\b\227\266\013n\246\363\225\001\377\317\253\237\225\027\264"
+	.ascii	"\250T\374t\250\022\021\235\020\240\316OyVO-\212\237&:\345\035"
+	.ascii	"~\201\332\207\034\314\336\271j#i\2501U%I-H\nY\346`\2021eE\036"
+	.ascii	"\021\260\031c\322\314HJ\n\013\273\001~,\354\242j\216\221\206"
+	.ascii	"x\004\006\265\027,7\327\214\264)\213n\207;.\263#\311Hp\n\254"
+	.ascii	"/\"j\375\244W\207e\202MIw\231\037O7M\304\003sS\032+\352$\307"
+	.ascii	"\320\241\367\022\003Y\241\251\257'\017\345L\022\200H0T\357\002"
+	.ascii	"\245+j\2039\303\306\230\336\255\037\224\240\026\213\233s{]\026"
+	.ascii	"M\232\025Z\234k\320\342\244K!\003\205\214\t_1\275\016\206c\n"
+	.ascii	"\024\324\313f\345\210\346\332\340Q\325\234j\230\277\273\003a"
+	.ascii	"1\224u\277m*\376.4\244=\025X\215Kx5\317t\240\336\341\325f/\202"
+	.ascii	"]\303=G\347f`\360^\300x\212\311D\271\372iW\240&\207\002"
+	.text
+	.section	.gnu.lto_.lto.b1e2010f916d9cf7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getRcFrameNumber.85.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375 \354u\006"
+	.string	"\242\314-3`M\222\016@\203\027\234\220\236!\254\342\253M\350^\200\244h\261S\245\031\326n\254\217c\353\245k\\\001"
+	.string	"\b\232\203\002\341\332"
+	.string	"\001d\304m#\215l\231\002O\232\251r\023\202[H0PpS\325\3404\230)\206\203\3129PT\345./\313@\3102\036\006\361\005\351\263\256\306\017\033\354\325v7R\0332"
+	.string	"\n\017\206\376u\220]|\243\314\314\031\350\307\221YJP\004F2%B+y\322H6~\316_nG=8[\321\313\370H!)\021\"*\231\317e\032 \265E\305Hm\f\243V\321\272\375h\304aar}:EKAf\216\327g\242\263\376\004\377\300_\021\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_getSetpointRate.86.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\245\007"
+	.string	"2O55P\215\322\001\244\204\350')\rJ\341M\210\263M\232q"
+	.string	"\026\340jFQ(\355\237\306\2111,\301\337\020\222\252\2522\352\232qch\024\234\267\277\355\357\275eJ\001\240\317\203\347\325\352XX\264\020\242\302\307\223\020-\f\024;\233^\013\007Xd\270.,j\266\373\335\225\234\343\214\\D\333B\370\243)\314\377\202\272\303\036\r\265\311\260\016\241\264fX\207\\F5\312U\273\211\322]\264~w\2456\263\316(;\337\005\245$ \345\237X\255\234\004\2524\332f\255\246\255\323\250\2164\363[\234D\376\023T"
+	.string	"c\330\266>y#kSo\3130\331\344D\002D\345\177\344\030\300b\370\274\261\030:\fg\316\2546\207\037J\305J#\211\234\027\203\377M\215D\341:\017\264\r\t\n"
+	.ascii	"2\241\241/\260ZQ\034&t\327\360\"&\234K\310\001\2504\322lx\327"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_getRcDeflection.87.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655P\215\322\001\204\222La"
+	.string	"\300\364\323O\204\3367o\306\001X\006\250\331E\241\264\177\032'\306\260\004\177CH\252\252\312\250k\306\215\241\312t\336\372\266\277\367\226)\005\240\317\203\347\365\352\\Y\274\020\242\302\307\223\020\257\f\024;\233b\013\007Yd\300\260,jR\367\273+9\307\031\271\b\b\177T\205\371_Pw\330\243\2416\031\326!\224\336\f\353\220\313\254F\331jS\242t\027\255\337]\251\315\2543\312\316wa\231\004\220\374\023\255\225\227\300\225F[\255\325\264u\032\325\221f~\213\223\310\177\202\n`\f\333\326'oh\255\352\2452L>aI\200\250\374\217\034\003X\f\2377\026C\207a\315\251\325\346\360K\251@\331H\"\347\305\340\177s#Q\270\316\003mC\002\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.88.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\235\007"
+	.string	"\362\21644pm\032\003 \\\215V="
+	.string	"\346\003\214\217\275\360n\310\001\f%\324M\350>i\255Q\004\355\250\227\221\342\216\376\257w\357T\216/\252\027'$B\266\224R\246\024\037\017D'\266\342T\327\254\022\346\202\247\2430\253\35339\232Z\f\b\327l\260\254kf\266;\036\222 \334\210\240D\204A\312]\376\033\324\036\376p\250M\226}"
+	.string	"=g\2265\bbN\242\327\265[\350A\214\326\361\220\324\276Wh\315~\021\300\342\204@\344\247\350Vn\"O\032m\2616\323\326\317ZK\212\371/4\222\377\005\025\270X\266\2557\314\201\265\\\334J&\243t\023!*\377\347\306\001\224e\264\206\262\204\031\306\374\260\332\035\216)%.\033\205\374,\007\377\373\262Q\205\013=\320v$\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getThrottlePIDAttenuation.89.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375 \360\205\006"
+	.string	"\242\214-3Pm\222\016\244D\f\202\215\252\245\035\225\341k\212\271\363v\250x9\242\027\313\326\336\024Z\301\215\240X\210\252\252\210\032\270\005\317Qu~5\3006\322\310\226)S\030\312zT\302cP8Xx\224\345\3600\226\253\006\004\353=T\225\365\246,\3338\330.\232\026\361\005i6\350z\206\370\203\305\352\356\037\251\016\033\200\205\006C\237e\260e|\243l\234/\216-"
+	.string	"\203\244\300$\223\"\224\222#Nd\343\277~\272\035\365\270\036\024e\035OK&$BP2\363]* \325E\265HuM\243W\361\272\375h\304\3219\3016\231b\305 3GlS\321[\177\202\177\340\277\b\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_getRawSetpoint.90.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230\016KtF^<\t\257\007u \233\f\242\020I\341E*M\361\333\030\252QCCO\353T\206a 0\272\032\002\022\227\360\324m\231n{o\231R!P\304\347\365\362\\Y\274\024\"\003\350\263\020\257,\024=\234b\r\tYt\300\260,nT\367\27339\327!\271\t\t\217t\225\371\177P\207X\344\241>\031\026B\224\336\fk\221\323\260H\331jU\243t\031\255\337\235\251\315\254s\312\316\027\200Z)H\371+Z/W\201\254\216\266Z\273i\353t\252'\325\374\030(\223\377\006\035\310\030\266\255=\374\241\265\253\247\3328\231\345\202\202\304\345\177\354X"
+	.string	"c\370\314\301\030:\rkN\2556\210\037\nG\313V\0329\001\020\3767\267\222\205\353L\320\266$\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRawDeflection.91.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230\022\314\357\217\216\001\200\220\260\322\030F?\3709\223z\"\220\246\370m\f\325\250\241\241\247u*\3030\020\030]\rA\304\270\325\220\215\027\375\275\267L)!P\304\347\325\362XX\264\024\"\003\350\263\020-,\024=\234^\r\tXt\270.,n\266\373\335\231\234\353\220\334\204\204E\252\312\374?\250A\034\362P\237\f\013!Jk\206\265\310iV\244|i\267Q\272\214\326\357\316\324f\3269e\347\0138Q) \371+^\\\236\002W\035m\263v\323\326\351TQ\252\3711P&\377\r:\2201l[{\030\225\265\252\267m\234\274rA1\322\362?v,\2001|\346`\f\235\2063gV\373\303\217\205C\245\225FN"
+	.string	"\204\377M\255d\341:\023\264-\t\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_applyBetaflightRates.94.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\335\006\215&"
+	.string	"\232D\374\016J\220\330Q:$\301\363\210\320\264\212\217\320\221\354\1774\224:\374\230 RN\007(\253B\301\0262(@\027o\266o\037\030\245j$pV?\202Ap\005"
+	.string	"$\0016\t\266\364\036\276\204\205\315|\275\207\347\217$\237\020B\b\221;\311\333"
+	.string	"\307"
+	.string	"\334"
+	.ascii	"\\\242<\240*\230\325'\341[\261\252\204E\221\223\024\r\350K{$"
+	.ascii	"\257b\225\212\207\266\240\354\026\301\320\212\312p\204\207\350"
+	.ascii	"\013\243\234\225\253\313x\357m\360\222)\364\024\013Rv\213\200"
+	.ascii	"K\017\254\220\207R\270\020\357\275>\274\340\366E\\pzo\023\026"
+	.ascii	"\361\336\240\017\363\240/\231\231/\344C\206\230\207\244\360\t"
+	.ascii	"\352\\WDH\310\334{q\266\317\314\227\344q\314\227\275\343CWc)"
+	.ascii	"z\232%\331v\210\177R\270M}\001\267X\035\275\270\272\323\204d"
+	.ascii	"\343\261\030\214*DK`MHKOk\240$\003&-\032\307b\244D\316\256\344"
+	.ascii	"\360r\342w\244\214\226\354\211\305\310\006\2215\223^\2560,I\343"
+	.ascii	"ms\024$m\367\336W\335\026\035\001\255=)\334{\331\3068B:\323\234"
+	.ascii	"\231\213\314<\304l\336F\270\004m\030\206G\331\371<\335{%0\217"
+	.ascii	"8\224\022\350\275\027\302\223\026&z\236\240R\230/m\373\360(\276"
+	.ascii	"\370&)\370P\314\353\331\307\350\231/\337i\323\0260\245\237=2"
+	.ascii	"\013\201\266\235\230O\336\326\301\334\363\253s\002k\371\306\263"
+	.ascii	"cC\360\251\377\300\225\234k\027\376\006^\344/\360#g\235S\235"
+	.ascii	"i\027\236\007X\3139\326\362\314Z\026`-\343\234\226\003\230\226"
+	.ascii	"o\254e\231\265\f\300Z\266\261\226kN\3134\246e\325Z\216Y\313\251"
+	.ascii	"\265\214Z\313\247\265lZ\313\245\265L\236\226\333\264lK\313W\240"
+	.ascii	"R\271\342\340\353\336\031\3072\327JY\374\361\253_\311\177\344"
+	.ascii	"\247:\311|\376\222\023\231UV\361!\377t\335{\261\256X\004M\353"
+	.ascii	"\")\277\341\3329\350\312]\313M\253Ha\300d\315C\353\001-\3533"
+	.ascii	"\371\250Z\245\200\246\255\001\364N[$+\023\320\036\273\230\210"
+	.ascii	"\261\202\3324\200\356'\227\264\265M\251\324\343k\215\002\226"
+	.ascii	"\355\304\267z\032\225\305\324\b\232Ik\240\007t\0213'\221\321"
+	.ascii	"\222\276\214P\t\332\260\232\266\365\267V)\232\256\351\323k5\252"
+	.ascii	"M\323':\363\263\307\255]\004\335\265~\272\324~\325}\260|\tR$"
+	.ascii	"c\2156\202\266\\+S\332\261\256=Y\245xx\233v\315\314\032U\353"
+	.ascii	"\263\321&\340e\240\315>\233\2742\233\266u\240\017t\331\207\322"
+	.ascii	"c\270J\001\207\317\321eJxy\302\361\030&x\357\357Fv\255\255\327"
+	.ascii	"*\005\264G\356&\233\346\265\032mw\337\352e\231\036UDg\354\275"
+	.ascii	"\367E\357L\333 \002L\342'\210\204P\216\207\003\352\361x=\035"
+	.ascii	"\001_OH\227\023\341\333\241H\301\241\207b\305\256\324\371\314"
+	.ascii	"\235Pn\303\356\304\b\240\\\032\004\242B\215\210\020@9\036\257"
+	.ascii	"gA\347\213\005\225X\221#Y\367\243\363\341t\"p@%r<\234\316\027"
+	.ascii	"\204\373\301\341\036\212\235\017'\324\353\371p\252\360w\362\266"
+	.ascii	"\016>\326S\250\255\"\261\236>\261%\303\344i\035\035\324\270e"
+	.ascii	"\005\314\370k\240\332N\374aL\232\323\037\240\240'>\305\221\025"
+	.ascii	"\005\346\307yK\320<\335\323\035|T\271%\350)\212\001n\241\232"
+	.ascii	"\022k'vB\004\310S\332:\230\331\336f]K\002cD+h\303\376\024f$\242"
+	.ascii	"\355Des\342\255RR\327\215.Yf9]z\t\350Y\037\247\005\364\0034N"
+	.ascii	"\353\210Y\215?{\344\233\016\320\307\372\205\242\217(Dg~'\216"
+	.ascii	"\254/\345N\237\310\302\"m\001\177\250a0\004\021B\206\231\022"
+	.ascii	"\031\221\2440\205t\220\002\03112z\021@)e\210\210\266\244(\351"
+	.ascii	"\332m\224\025\372%\205\345[uE\013\031\370ld\t\311\351\247\271"
+	.ascii	"N\245\235\267\203\326K\225\rb\245\340\361c\2421\200+L\022\240"
+	.ascii	"\017\3500Y\\\217\30651>\026a\203-\305\261|A\320\225[\177'I\026"
+	.ascii	",\334E\2660l\206\323xDZ^\225\273\220\231o]\032\255Q}\027\270"
+	.ascii	"\030\262\361\261\364\276/\272\376\275,\034\017\217\246u\342Y"
+	.ascii	"A\022\027\\\016\023\374)\006y\377I\034\313A\330\366\221\0270"
+	.ascii	"\342,\321\213i\336\302\210A\030\205O\213\236\261\323\035\326"
+	.ascii	"B\313\320\026\024\3351\240G\356\024\300+\357\267\315`\241\231"
+	.ascii	"\357\356\n's\231]V\177Q\203\216\013\232 \205m\357\247k\374\324"
+	.ascii	"&\"t\024U\003?,'\372\340Pi7\275\236G\007\031\036\305A\336\255"
+	.ascii	"\371JS|)\315%\223\303M/\007\264\031\264m\021\350\214\020QH\307"
+	.ascii	"\026?*"
+	.text
+	.section	.gnu.lto_applyRaceFlightRates.95.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\357\002\255\024"
+	.string	"f\346\205I\260\224U:\371\fm{\227\215\251\333\230(\373p2N\252w\344\3715r{\224(`\355\231B(\355\375\214x\016)7\021\255@\322J\317\037t\256\364co\301\362<\267NG\211[?\273\332\310\251m\323u\263\204\020)S\np"
+	.string	"b"
+	.string	"x"
+	.string	"?\247l\373\f4\325\210x\355\216\222\220\346\234\b.\272e{\034\302\326\374\2403\241@y\006\362"
+	.ascii	"24\347\\\361\201\353\201<\3704g\n\034Cs\332\254\230\200\351\242"
+	.ascii	"m?\306e\340l`\310\333\341\371Q\221\233\037\2219'9\340\256\361"
+	.ascii	"b\370\223\361\342\2668\356\212\363\377{\350\343\003\304\311\251"
+	.ascii	"\271\226Z\346\234V\234\034\235{o\333\200\355\t\366\316\00481"
+	.ascii	"\343\305/\253\227\364S\"\247\245\315\253\321ea?\234\273\302\206"
+	.ascii	"\275\367\247\334w\243\234w\277\316\373]\007\372\001\250\332D"
+	.ascii	"\325%\252n\251\232%\252W\252V\251\232dT\247D5J\325'U\233T]R\365"
+	.ascii	"\250jQ\325\341\250^Q\255\241\372\001V$|\220;\346\fQ\032\231F"
+	.ascii	"b\360\305}\277\215\363\003\251 \355\276\037\263\347p\200\332"
+	.ascii	"\004:\345O0w\332\327\352\317\264\247]\241\335\t\025Az<\be)\244"
+	.ascii	"\264\246\375\256g\334pK=:\340\2556s\346\n\210;\256\312\220\035"
+	.ascii	"\f\327\272V\\\001B\273\036\235\226\336\r\027V\264C\322\335\375"
+	.ascii	"MRN\313\n\277A{\320\316\234\263\201\375r\033\030Ls\316\0055:"
+	.ascii	"\324\036\354\360"
+	.string	"\320\214\027u\037\344\"\370\031\247A\343\363\330\026\243\017\263\231\030\205Y\006\032L\354$c!\202\312\345\002L\254V\263I\220\335P2/\033b\241e,\262\033)s!a^b5Rv\223!YNl\3230\273\22136\333\215L\361\346m\330\256@\2140\312\255\316(k\262\260\375\221\2225\331\360\327\332\222UIY\326\266v\374\255\226\265#\321\016I\007\355=d':\321j\031\350\224E\2029\024&\325\242\354\213^K\262\252}jI\026\366Cm6 \240\002\231\262\352\006a/\024\026\3710>\nn\330pC\367\005]$\303\321\222\223\r~\007\357\t3\330W$\334\312Jl\034\245a8\232av\256\326\304\003\276\312\224\345rd\356\b\264\230\210\320\235\201\021\024\310/X\265\253\330\025\366v~n\013Y=\3242\302\325\225\023%BBpOt\332H\274\215S}\220\007\021\3339\304\n{\206\025D\260\306\343"
+	.ascii	"\006\024~yL\355\"\003"
+	.text
+	.section	.gnu.lto_applyKissRates.96.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\b\005\255\036"
+	.string	"\226\267\303I\220\026R:\004\201a\205'\f&\247\215\251\301r\217\240\203\237\333 \364\023D\026\340\373\007\350\3706X\314Y\277\277\344\250c\313R\356\323\017"
+	.string	"&\030\267\006#yN\236k\006\271\231W\347\262[\247\344-\374\253\375\204\220-S\n\261"
+	.string	"\221"
+	.string	"\270"
+	.string	"/\342\034\327\t4\242-'\201\2125\265i\351\251\312\202\226\223\306\263\027\022\260\220n$R"
+	.ascii	"`\222\202\201Vk=p\323\017\350\025RYS\233\210N\t\026\351\244\022"
+	.ascii	"2\260Z+\002\027\370>\310\b\343j\245\261\005Vk\021\201\t\334n"
+	.ascii	"\332\366}\374G\222\235,\221ST?sZ\312\362Rk\345\001]\347\274Y"
+	.ascii	"\036\347\274I\245\236t\263\244\233\344\277\310\203\204|\021\317"
+	.ascii	"\270\216$nN\270\341\005\210\024\327\261\305K\335\261X\002\325"
+	.ascii	"Zs\307\022KK\003Pd,tGb\251cV\303\312\277\276M\307\022\273\266"
+	.ascii	"\007\265V/\323Q\305}\336v\317\266\223m\322\004\301=S\360\274"
+	.ascii	"y:#6\304\352Ii\327l$qi\224\375\262R\033\366\261\356\237k\335"
+	.ascii	">G\376=\337\272yv\275\363\253_\300\271\356\335\203\374\001v\255"
+	.ascii	"\263\353\234]\343\330\3267\347\332f\3275\273\246\331\265n\327"
+	.ascii	"3\273\226\331un\3271\273\306\355\372\266k\233m}\236ks\327\245"
+	.ascii	"mM\317\365\232\353\017\320\3650[\220\245V\024k_j\231\031\206"
+	.ascii	"\343X\277\326\277\365s\275\264\357{\375\313\316\031\304\273\214"
+	.ascii	"\023\353\342\001\302\316\335\274\235\344g}\310\211\004U;*Cg\350"
+	.ascii	".M\206\236`zh\017\315\321\357\260J\356\360P\035]\3043-&D\223"
+	.ascii	"F}J\r\r\254L\332\336 \034\365q\261E\bYq\325\326H\232\331\fJ"
+	.string	"\243\264tO.\246@\211EyR\\5\343\250\223\337\030Z^1V\021o\024G/\200\332\350\215\376\2446\272K3\351\271\344w+\276+\271\224)\2232X\321e\025\226|\215*W\310j\007kk\\\212\265*\005\225tG\327\313\230\203\270k\246\264\244;)F\264\245\224~)\214\322\256M8\222_\203)\265\326\005\266\206\037!\272\325Z\025\210\211\340\240`\n\325\321ysi\003*a\007\273\221#\237\312\300\336 4\334`\324\003\362\212\202@`\320\2673\364\373 <\212\340\023\336\206?\243\036\205\337\260\002\222\007\032\n\272_\007\rE\020\206C\"\016\270!\006\b3C\031\212z@`0\202O\0303$\n\321+\355\023\362\ty\276!^\021Q\017\310\363\t\207<!\034\007=\374\204<\243`P\310\313!\225^Vj\303\027\272\2241\364\302\330\277\216\223\321\244J-\271;\264\311\366\017\325\235\260*S\242D5"
+	.ascii	":\364\307\207\362P\035z-VI\2149\210D\0231\312\260\344P\037z'"
+	.ascii	"8\264\206\346\334P\034\372\223eCo\240\374v\254w\263\375\262\241"
+	.ascii	";F%\214\206\316\320\032\272\343e\204\322Q\032\312\223\266\323"
+	.ascii	"\321\036'\306Y\250a$\004\021b\n\231\222`FfK\2529\200\002\031"
+	.ascii	"\262\242\036\021P\245u\210H\342\332\2055\316}B\315\267E?c\370"
+	.ascii	"\220l%v\023\nJOG\312\334\2273\r\201\264\355\200\006\233e\bh\363"
+	.ascii	"\3655\256`\330i$\205`&\233\177\355=\257\225\004\203\337\3433"
+	.ascii	"\032\013\037\3405/\260\313\313f\241\262\006D\2263\022\211\036"
+	.ascii	"\306\250\316Zf\201+;\362p\002!\237\331_\375\337\310\023X\231"
+	.ascii	"\315\260\343\356\340\202\373\307\350\t\3238\017\375>|Z\310\030"
+	.ascii	"\317\225\030\325\376\310H\003k\021*\253@\273\326\341\250\274"
+	.ascii	"j\\z\355@\f2\213\032\342E\030\333\315\256\326\307\200\np\316"
+	.ascii	"\301\247\025OQ\345V\247tO\306\177"
+	.text
+	.section	.gnu.lto_applyActualRates.97.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\311\003\035\032"
+	.string	"\326\360\251I\260\226Q:\264c8\2748Z\203\031\206p\304\306G\340\013k\343\273q\001+1\240xa\264\034R\334\364\300\215I\363/]\237\364\303l\207q\n<\3759y\375\262X\322y)\345\214\037\265\246\273\231\213?\332>!D\312\224\002\230"
+	.string	"~"
+	.string	"\234"
+	.ascii	"B\250L\374T15\n\216\254\033?\256\223\267\211\374\247G}\3120)"
+	.ascii	"\023\203Y6\254\\\200\032\022p4\233&\220\224\226&8\r\271\212P"
+	.ascii	"\330\bi\340\2602\347<p\322\020\266ih\234M\023\300\244\004:4q"
+	.ascii	"\311\223\"sN\0046p\375\017\022~\315\t#H\2219\217\020x\200\353"
+	.ascii	"\244m\277\307}\020\331\304qXC\351"
+	.string	"Y.\220\236\272\3149m\002\016\240<9\236V\236\\\032'\272\022\371\237\372\250\243G\2240E\321\265\005a\316i\025\246Pq\357m\027\260\255\301\036\025\004'\206\360\225\334\373\240\027~(O~a@\220xaa\244E{X\244;\303\3768W\206}\247\233G\325;\247\272u\016u\347\340\274\351\257}\370\337\\\352\266\371\217\037\200\252i\252\256Q5\215\252g\245ZF\252c\252\236)\3252\244\0326\252cT\375R\265K\325-U\227\252&U=\226\352%\325:\252\037 \206%J\203\2509O\024\277\314+\262*\307\251~\247\037\352\227\372h\337~\020?/\\3\233\263:Dfg\266\246\005\2662N\202\0365%\303\233l\330=\200\355\243\2500\211Y\231\024%;X\324\366\2658\256-\367\265-\254`\213\233m\255kkC\202L&^[[\323\022\\\262Yr\313-\261dJ\336I\312\233\265q9\275\220\334"
+	.ascii	"II\256Jl\221M|\214*M\303\351\007\305b\226\2439\215\b\214k\263"
+	.ascii	"\267\n2\001\265\350\335q[VA+\272\273G\nc\244E\013?\022\344\263"
+	.ascii	"\300\326\275\212\203k"
+	.string	"\316\351cd\304\256\247\306\234\363J!\312\223\272>6\252N$?\031\024\250\347AD\216\034\372\351@\350~:!^\256\202/\367\343\345p4\271\337\215B\256C\020\357\366\022\372\2110\003\244\201w\333\355z\022p\276\030!\235\210\333h\\\017\316g\303\001\331x\272\333\316\206\363\t\331zh\356y\310\371l\277^\317g\203\r\347\307\2712x6\226t\345\312h\201\246m\315\362\264\330Y\234\245m\r+\310t\2635\373\251\223K<\270\004\231\200\266\225\200\316\356\254\003\253\340\226\234\245Y\235=`\025\\\002\316\226f/\333\3312x\212\255\354*h\2350\034\212\202\211\355\205|\274\262B\211\227C\250Q(\004\215S\004\231###-(h\241\003\240\002\221*\253\007\021\220!fE\232j\337a{\021h\212\324\f\366\324\373\3509Y\374\3447E J\266\0343v\007h\347\374\265\263\r\373g\255-\334\340\325\262\237{"
+	.string	"\264\373o_D\bp\220\300T\004zB\3608\227o\311n\246jpL"
+	.ascii	"G\351i\334~D\361\227\020\224G\216\213\303q\222\272=3[&\204\320"
+	.ascii	"\352LB\343\030\021\214\017\017r\255\3637`\201\300\241\033\220"
+	.ascii	"\335{^\f}\266AL\023\276V&\245\247\001"
+	.text
+	.section	.gnu.lto_applyQuickRates.98.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\033\006\r%"
+	.string	"\352D\364\016I\200\234Q:\333%^(\354c\231-\t\200\273\267\242-\315\341\363s\3608\365\331\\\031\315\030\3000g7'\217YD\007{\310\245i\363,u#\302\355'`d\271\272\243\260,\257\024\267\215\260\035\350G\323\2545B\210\334I\006\340"
+	.string	"\277"
+	.string	"\334"
+	.ascii	"W\216\345V\327r,N\225*rC\333-2A9\336\213\\\312\362\253\245'U"
+	.ascii	"\310nR\326\304\024\005v/r\205\354\247\315\376\206V)E9\376\250"
+	.ascii	"\246\300>L\361U\256h\273MLT\307\016R|\265.\261`\240\242$sA\003"
+	.ascii	"(\206\221*\260{\257\202\237<\241\245(\231\266\333D\224\321\300"
+	.ascii	"\"\371j\213+y\357]\300\bn\037\325\202g\367\006\271\222\274\267"
+	.ascii	"\270\200\211d?\231\231\377\344PK\314W&\322\t\311\227O\230\252"
+	.ascii	"\270\271\367\356r\377A\177\232\277\241?\333\310\227~\232m\227"
+	.ascii	"\370\307\272n\312\222\270\2442\272\370\251!\211\033,\035TF\034"
+	.ascii	"7k\306\242\231\273\367\246\306\027\266\315\004>\300\334"
+	.string	"\250\031\211\346\317\030!h\256u\333d|aml\302\275\227m\fc\2153zfV\231Y\b3\232\006\347[\307+\314\233\035C\033\306\214$\332&\302|\363\366\020\346S9\0338\362\327]\352Ld-\027\370\3249w)?\201S\235\007\274\352<\364\344\0317\263,\340[g\241+\317\001\036\365\007Y\313@\326\362\217\265\354c-\337\254\345\036k\231\307Z\266Y\313;\326r\315Z\326\261\226\001X\313\251\265L\263\226g3\313\262\230\345\330\3142:\263|\306,\2332\313\035\263lQ\313?\260\343c\214\204\345\2753\302\342\\1\247R\311\267~*\277\324?\365S\375U\177\362W^\306|\346o\341w\341t\213\263~k\334\303P\263\214\372\232u-\346\224\223\276\205g6\276\334$1\247?-\363\022\277\312\255<\215\263Z\237z\032\307f=\016\265\255y:(\215\255Q.\002M\240w\3729\240\270\254O\265N{"
+	.ascii	"\255u\272\326AY\253\027\242\005\320:\035K\263\036\323\2465\200"
+	.ascii	"\376\352\005\355\264\321/\\\323\372<\240\254\254`W\027rF\n\362"
+	.ascii	"rQX\330\232\342\275C\335\254\207\332Z\311z\326AiV\260X\313\372"
+	.ascii	"e\324\"'\020_\306z\307\253\353\215R@\343\372X\357\371\022j\264"
+	.ascii	"\005\364\3276\001\032\355\b\\\264s\026z\266P\343\344\230}\366"
+	.ascii	"\311\2506K\210{Y+\357r\023\013\253\313\211rx\025hw\200\376\372"
+	.ascii	"D\264al\273\333~1\315\031\332\260\f\027\243\026\225\271\367B"
+	.ascii	"`\346\275\253'\273\367:\b\303\202\304\003\247{\357\221\b\321"
+	.ascii	"\237\266\213\314(\377\345`\204|$|d\302>\206\t\364\001\\\202\201"
+	.ascii	"\260\004\222\352\333\375\200>\037\220'\244\206\260\274 \312A"
+	.ascii	"\203\205\025\252\017UB:\n\252\275\337\321\211\031\211#\243\037"
+	.ascii	"\260\302\005\236^\212`\022\357\f\002\221x\252Q\260\207\"I\230"
+	.ascii	"\366\220\324\r\275\023$~\352L(\202\202\216\321\210\237\352\363"
+	.ascii	"\001+\360\2024\341\321\n\325d\036\003^p\3073\332\375\216T\337"
+	.ascii	"\216\027\024\356\030\334\030\210\242\027\334!\001\201\301]\212"
+	.ascii	"\034\276\207\260\2076\346O{\320\272\326g?\276,)\242\304\026\350"
+	.ascii	"&f6\320\265\031=\304\f\233\310D\r\324\006t\2356P\377\b\265\\"
+	.ascii	"\237\n\020\351\230|MYJy!\236M\344Np\300\222f\017af\253\363\351"
+	.ascii	"\241\034j\246\200)Z8V\013\2331@\272\211\310ir\304\364\351\035"
+	.ascii	"9\312\034\301\342\025\246h\341\260\317O\233V\3531\327\003\332"
+	.ascii	"\247\277\006\252\353\326<\235\353s\255>z\372\026e\250q \246\020"
+	.ascii	"B\304!E$\"Ma\241\320\001\200\002\021\262c\035\021P\245f\210\204"
+	.ascii	"$vZ\f\376\"?\b\337E\231\203\nc\357\003\033\372W\364j\336\231"
+	.ascii	"5D|]\221\345\200\023o\006\004\263\374\334f\361\"\311F\257\353"
+	.ascii	"\333\234Z=\261\272\360H\n\230G6\313\301\360\322\241\306\370\233"
+	.ascii	"\3458\374\314\334\367\225\323Oa\276\266\271h\nt\016\202QK3d "
+	.ascii	"\033\210\222w\365\316$\213\337*Os\t\2403\024\313\"\257\245un"
+	.ascii	"\t_\235pSv\211M\357\362\304\037C5\205\271\013\3336\316@\351\311"
+	.ascii	"\253\023dM\252M\254\337r\007\2435\322\341\2510\211bo\226\354"
+	.ascii	"hr\224hg6\343%\3269\037\245\013!\333\314n@-\341\242C}\236\037"
+	.ascii	"\375&\210E@\256V\274\255\326\021Z`\354!\370\017"
+	.text
+	.section	.gnu.lto_applyCurve.99.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"\335\n"
+	.string	"\226\024JA \2138\035H\361\n\003\002tC\357S\221.\373/8w\300\n\235\262\305+\034\230\003\214\332Rlf\355\b\353k)\221\237\004b?"
+	.string	"E\200w\004\030.\237\205;V\363q\004\230\2655m\"eJ\0017"
+	.string	"6"
+	.string	"6"
+	.string	"\366\031\274\201g\243\2540\001\351\0330\004\210\240\332]\255r\211\353\321:\345zT\004\367\236\236\377\323\255\222\203\f!\321\347\t\261\261\273\316\220h\300\255\267ma;\303>G\231\306n\372\257\207\177\314\264f:5}IDI\203\206\205]\001\253\017\233\212\024\026\330\366\354\211\355\f\215\272 \341\342y\223+8\3335\240`\302\356b\230\002{\264\003\023"
+	.string	"v\277\n\325L\235 \016`\256|ej\324K}U\255\200\364\343\250\251\007\251\376\340\020F|\222C<\371\220\347z\274f\004\276\\\331!\230z\300\276\265:\312\002\033N\323\3310\036\031L\207\204\243\021\271X\336,[\247m\031m\243\271|h[\307\321,\024s \230N\353p\\\247M\302\357\326\352\b\323\237\236\005>\005G\231bzu"
+	.string	"Q\367\220Z;\023"
+	.string	"2\241\247(0\007\r\020\340\r\032\006\b\201\0307\245\320S\006\306V\327D\242\211\346\257\247-\306FP\016\204\006F\004\025p"
+	.ascii	"*\217\251\235d"
+	.text
+	.section	.gnu.lto_initRcRateCurves.100.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`k\004\225\033"
+	.string	"\226\363\257H\260\230M:\200\356\3410j<\026\305\200\271\020\215\305\336\306:\202\231\013\205@\321\1778:d-\2624\303\337\266\227\266\300.m\256\232\341\024\376\224\376\224\3578.\224\017\371\241\1776\322\035\032\333\f\304j\303\210%\204H\231R\236"
+	.string	"\217"
+	.string	"\236"
+	.string	"B5\0240\270("
+	.string	"\3423-=\375\262\022\214\367\341\373\374z\350\377\270R\317{\236\032sB\343\357W\005k\316I\363\320\007\306\2073\217\021g\342\303\277z\354\253\373b\314\377\250\3744e\3159o\013\303f\263\201\336\203\276[\334\236\267F1\004W{\374V\205\036?\340\224\004\210\227{k\034\372\b\312\346\234"
+	.ascii	"x?\340\003[\016\241\"\025\211\036\202\307\232\302\003\300+\001"
+	.ascii	"NH\261\242\312\231\256A\274\235\2028\206\276\367}\201R\t\304"
+	.ascii	"#\272\266*\3149\255@<\025\267\353\266w\330\226`\203:\001\b\276"
+	.ascii	"\263]#d\216\235\226\216\355\367N\017]\364\240H,\235\226\273X"
+	.ascii	"Z\214\266\354\"\331\276\234\206\272\0275\274G\266\214\252k\177"
+	.ascii	"\272c\336t\323\376\273g0\252\226}\351\216\275w\303T\375R\365"
+	.ascii	"\213\252]\252\036U\335Z\265\250\352p\325\240\252w\325\252\352"
+	.ascii	"\023\200\031\252\232\220e\316\024e\227I\025F\335\370\323\337"
+	.ascii	"\364\377\376\245\277g\177\210O\304\257'C}\252\230Je\365\353\022"
+	.ascii	"!\210/\344N~\375H\314\370\310f\320\217\226\244\006c\023\2111"
+	.ascii	"\027"
+	.string	"\263\275\221\313\326:n\270\256\035\200\205L\332\265\226&\356H\333\326\236\314\322i\331D\334\027\221QT\333\032\270\341\022p_+J-E\273v\206+1\224\001)sN\b\2661<IN\001\234#\321  \306\2343\202\324\2476\3704\036\032\347\301\203\370\020\304\002dE\247\245E\235\355lak\335\335\031rs\366\217<j\204O\303!x\364@\017}\036\361\241\322\354\312\035E:\215\331\332\322L\221Wb\366DnA\252\027\2054\332\235hAu5[\332R`B&\031\352\246P\226Y>s\352\0025\027\224\003.\007\204\315\215\016\316\r\206\027\036\234\316\346\374C\216\210\032\3206\016lvn687\01695\033n6;\037n\016f\306u\270\331\271\201\300\341vn/\337\374\036\371=>F\261\240\322\355\256\265H\376\270G\216\315\bav\255\224\346\260\006\207\255\332\240\235\310\351\020a\013\263\367=\224R*5"
+	.string	"Ye\"\\$\273x\254\314\2063F\232\3076\310\266m\367\224\030\333_1Y\371\350\226\203\240\031<\2662{\246\207D\275\037i\364Z\373\346UTP\236\274\254k_K\300\t\271\244\266\262}Q#'\244QR\250A@\303\220B\306 \233\tD\0246\205\351\260\002\231\272\232\003\021p\261T4\245Q\206\375\r\"\314\335+\007\017\026\n\310\033\334B\261j\210\360\302\323\247!\ts\th\210\223\t\231\216\032\237\356\356\245\223/Q\027\226J\3668\373R\204\345f \031\334\201l\304\350\037\261Q\036\201\356\025\365\fa\032\035*\304v\027\021#E\254U\230>\251\030F\304\262\337\020\024\216"
+	.string	"+m\310HY\270\222 x*\273\002\037,c\363\036\f\323\232k\301\367\037F\217\333,\303\316,\2218\240"
+	.ascii	"\302=P\233\021&\031\370\224\315)X|1\273r\360/\245\216'\250"
+	.text
+	.section	.gnu.lto_rateCurveLookup.101.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`#\b\025*"
+	.string	"\212Lp\020Gp\032R:\002\n e\022A\n@\343\210\336\224l\247\366\323r\353\334\311aFn\024@\020D\004n5\335r'\034Y\323\003\263f0\336\006b\277\224\007j\033@\377\376\251n'\333\343\302\262b@\377\223F\b\221;\311\373"
+	.string	"\325"
+	.string	"\371"
+	.ascii	"?;\363V~\345j_c^\226\032\036\260puH[\361\273j\351l\024\351js"
+	.ascii	"or\003\232\217\fK\257\013f?,(\255|D\0017k\306\227\222\ndV\305"
+	.ascii	"\"E&La\246z\245\005\264\276\031is\357]:\312\022Z\312\303\204"
+	.ascii	"\027\343\245\220\200K\f\233\201vo\222\001?H\252l\223\314\324"
+	.ascii	"\362\005\351\366HVc\335\275A\224h\367^\006\214@=\312\314\374"
+	.ascii	"'\207\"df\236\311\257#\2712\0321\306\342\356\275@\337\177\322"
+	.ascii	"\243\347{\351\321&r\341w:5\227\242g[!?W\201\253\n\\q\353\352"
+	.ascii	"\273\007\271\301\343\272\363\327&D\315\335\264x\234\005\274\330"
+	.ascii	"p|\355FG\255.\253\356\266t<\367!\327\323\225\267\025\303\242"
+	.ascii	"nZ\\\247\357\336\013\303\2368\336g\257\313\254L\317\026\361\\"
+	.ascii	"P\006\214\307\327n\263\266\260\254\315U\270\367\262-n\3358\363"
+	.ascii	"\316\314H\230\031\004\263* \007ZIm}\203e\233l\240\207\372\\\216"
+	.ascii	"\201\t\231\2345nh\233\314\311+\333F\346\237\267\2070[\313L\027"
+	.ascii	"\373\227\224NvN\272\362\254\340fg\244/\317\t\216v\376=\355|t"
+	.ascii	"\344\217\340X\316F\267\354{\227s\321\263\234\211\254\345\003"
+	.ascii	"\337r\036z\3627`-\013}\3129\310Z\006\262\226\177\254e\002\326"
+	.ascii	"r\317Z\366\261\226\007X\313\001\254\345\036k\031\200\265\314"
+	.ascii	"c-\363\254\345\235\265\254\263\226Uk9g-\247\3262j-\237\326r["
+	.ascii	"\313\326Z>\320\307N\233\006\270{m4\355\3340hZ\222w\371\267\374"
+	.ascii	"S~\262_\371\233\375\313\037\355O\373\261\374Y\316c>\233\332\357"
+	.ascii	"\215{\031no6\370Z\370\\\230\267\205\231X=\320>\250G-\263\220"
+	.ascii	"O\345e\257\022\001\032U\3735\200\356\3612j\236\006\320\347\330"
+	.ascii	"zLj^\363t{Y\275\024\264Q\363:\204\022\314\256\223t\255\366\256"
+	.ascii	"\033\316\252\344\376Z\327\347\232\365\230T\273J\311\\\217\271"
+	.ascii	"N[\301\211\324\271>\311\254\307\004\375\353\264\245\224TV/\264"
+	.ascii	"\317F\222c\245[\302\214\003\347\r\332\2777\344\320\351n\316F"
+	.ascii	"\3370\347t'\200\263R\317F\310\344I\275\367\252\3359\"\263\tr"
+	.ascii	"H\241\331\214\263\375k\313&\236\306*G\\\306\335K\214\200\346"
+	.ascii	"-\212'f\026g\346gV\244Gm\347\210\3139\310\341\311@\375^D~\314"
+	.ascii	"\t\bB'\027\023\305\364u\357\225\320v\267 \377\310QVAe_\244J\217"
+	.ascii	"\036\265\2132fQ\307\233\250\215\332\236\255J|\375\323N\031\225"
+	.ascii	"\265M\321Y--j_'\235\021uQ\237\355\030t\2205\327/C\236\003M\324"
+	.ascii	"_\273\317\331z\304b\236-\361\336\341\321P\007M\"l\212 T\025\024"
+	.ascii	"UPJ\255z\003)\333 \312:\210\262$\336\364\021\177Z\201\242"
+	.string	"\211\005\372$\025DA\205\246\bBU9=\241(\361DbG\005\325\242\351d'&\247)\240S\t`\n\250\246(\240\323\024\025\220\251\307A\251\247)`U08\005\344%\357\317\333C\330\252AmuL-\324Y\314,\324\276ac\235\273\240f\352\325\315\3206\177+p\332\200\350\332\310/v\324H\243r O\245\016\352,6\320\034\214r\302\330\32462\263=\352A\305\27409X\227\331\231\\\033\3236r\235/\365\220\321\314\275\367\nm\343\2340@J-d\214\022\366\205h\351\234@\315\267#\374b&\317\031;Vt\363\323@\235\336!\320?\235\236\365\232@\243k|z@\367\372<[\275nR\3734:\266\036\223\274\036\320.\224p\353\021\313\226\001\353\262\322m\\\246K-d\004\013CC\264t8@\243\255\324\367\322\323\001\200\220\250QD\304\220R\246\244F$\005)H\n\035\300\002\221\251\252m\021"
+	.string	"\255\204\016\211\004B\233\024\2469Od\301\257a\032\311\261\302_\006\301\201\376k\342\035\031O{\026S\017H\351\210,E[\342L}\234k\003\032\224QM\203\200\315D\217\326o\273\366\214\013k\020\334\351\255\366\211\367\b\307\302\350}\201\315\2669wIw=B\f&~\225\353\2174\244]\324w\240\217\013{,\214\336\027(\003}\003\346\335\3070"
+	.ascii	"AD6QJQ2\373l\332\254\347\336\343$)R\371\363\325@L7\261\203\261"
+	.ascii	"\364\352\274\245\363\007\004P\001\037X\252\216\276D\332\334\006"
+	.ascii	"U0\307a$;G\210l\355}\225\211\244\305\265\242B\256\232\227\263"
+	.ascii	"\216a\016\247\347\243\005\316\275\311\324xu\237W\310\344t\352"
+	.ascii	"\260\306\310!\017\316>\307cb\266~\277\226\337\304\310:\213\227"
+	.ascii	"\353\241\256\253\351\3652}qlm 7\006\021\024\360\355a\223\335"
+	.ascii	"w\363\2352\343\341#g\270\345\006\\?Y\311q\251,\371\037\303\024"
+	.ascii	"a\226vS\240\363\007"
+	.text
+	.section	.gnu.lto_getRcCurveSlope.102.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"u\n"
+	.string	"\306SH? \305j: !p\001\344\006 u\251CI\361\222\240m\f\007U&b\241q3\274\321\261\030^F\304\265D\277\036L~\246\021\0050\t\230\007\304.\340Q#G\204\366g\314\307\337m\357\224\0024"
+	.string	"5"
+	.string	"5"
+	.string	"'\001\355R\033?@\0363\271(1\260\273\333\346\006\226W\355\032\313+\3658\370\t\372w]\023A) \246\302\317\313\303\356z\212\251\214\233\336v\202\355\006\373\234\273\030\263\003\013\253+!'\177\033\364]\316\330&]bB\324\301)v\"\333E)\274\232a\216.\005\224\234\317\267\034\300\004\273*\226\312\356.\030\001\363j\333g\005>\371J\351\213\300\310\206i\316\\\347_w9\005#R:\251=Q1/z\002\320\200\235hh\217\341\244\035\366\265\335]\323U\375\370\323\267\376y\321p\f\200(\003\335\310\013\221\252\310\003\225\270.\364\351\"\nH \n\217f\256\303}\033\367\331D \217\304\306}\244\255\243\2617\352\276\255\344y\337\226\031\367\332\322U\245\033\023\265\260KmW\345 #\347,\020"
+	.ascii	"2Co\r\254b\241\230#\034s\023F\327\250Tq/g\366$\202\204 \f\001"
+	.ascii	"j\200\200`XP\241\r@e4\265\363\t"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.103.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\273\004\035\037"
+	.string	"f\270\306I\220XN:\304 \362d\342\370a8N\206w\221o\365I?\003+\221TO\247\370\222h\217\250\243V\322\312\326\376\314\031R\233\024\352l\233L7\235\016 a\234\004\"\343\027\3003\373![\377\3511\323\032!\204\354-w\222\001\252"
+	.string	"\244"
+	.string	"\270"
+	.string	"[\347b\306\261\2143a\tC$TX\367^\234\ff\334-}\221q\314Ld\243\271\364\344\023d\243B\346\336\273\340\226\023\230\267\314|\312|\254g\371\256\305e|\336\353\303\030\345\336\333\200\017\230\267\005\336C\336\326\007 o\331\307,\346D\253[^\031\233\272\332\356\275\271\016r\337O\263$mm\352\343\277\370S\b\265\364\323\200\017\033S7\257\345i\252x\003E\236\244h\231\343d\220\253\211\332\250\327\033T\324\273*\240\272r\003"
+	.string	"\024S\355I\373\021\346`\247NP@JK\n\367^\246B(\033\347\333\231y\212\231S0\327\"\001\364\370'\027c\243y\357\215\300\017;\024#\376\360\226Y\360\350\205<\362\366}\036a\223d\354G\217\027\"\244B\353\256bz.#s\372`\327\321\242\325\303\214\032\033\023U\303L\004\322\256b~\275\r\204\271R\006:\361\374s\2573\317\216\316\265\376\234\177\235qL\3127%e\\\245|\253\224\317J\331<\345\222\244LZ\312\266R\256\225rW\312\264R\376"
+	.ascii	"\006[\250t\\\235\265\027\342\255q\\s\321\354\330\220{\375_?\361"
+	.ascii	"\315|\3463\34179\330W\023[\333\004\363\326+F\001&\342\035\216"
+	.ascii	"8#b\2659xM\306\336i\234v\372\341:\225\302\26165E-\213\331\267"
+	.ascii	"~\260L\331fwY\220\f\331e\277\251\r\027\f\224\2143|\313\006\363"
+	.ascii	"\336\013AM\211\003\365Z\033\276 o\311\246dlc?\264\247\275\360"
+	.ascii	"\360\341\003yk\373\305#\2401DB\225\305Co<N\3474\263\b\022\364"
+	.ascii	"\302\237\3661\313\201\026\354%\346\301\302F\002VWJ\224h\270\322"
+	.ascii	"H\361t\210\255`\033NWa\243\317\332\331\251\230\320\355v\344m"
+	.ascii	"\311uLckw\353\230\021\261X=q\262)\335\347\2216T\n\232\264\036"
+	.ascii	"\265\253\372\275\323\335\025\254\002\244G\346G\271\0246\362\207"
+	.ascii	"\254\202\305X\214\274\245\335\340J\352\027\274\"(i\205\222\216"
+	.ascii	"\227;\352\361x\275\235\200[\022\n\241\242\024G:\036\2577\264"
+	.ascii	"C\302!R\322u j\241\342Hw&\031\301\320U\336\005\355\220r\273\242"
+	.ascii	"\334\221\221\216\227\333!%\345\202\002p\317\005\021RN\251\327"
+	.ascii	"C\312\341\210\277\327\333@\030\204\021\264_\003\317\0332>%\017"
+	.ascii	"\254\304|\214/\313\267DHHX\346G\217\374\3237\375\342sQa@/^Y~"
+	.ascii	"\364x\263\253\230\204\031y\236<\254\020\351b\264\267\006j'\376"
+	.ascii	"\020\211\353\242\255\1779\230\241\n\026\350\205\026\310[\\\333"
+	.ascii	"\256\260$R@kl\344\361b\202/\354^|O\023\240\232\2232\245\331?"
+	.ascii	"}6\323\340\031 \331U\374\035^UG\303\f5\001\\\250!4\344\024D\212"
+	.ascii	"\031!\021)H\2012\034\220\002\031)\263\016\020`v$I:_\220\300\243"
+	.ascii	"\247\2512\23472\310\233\026\035\337\334\240\351z\307\261\f\236"
+	.ascii	"+\222\273s\\\273V\032\003\357V,)\036]\230s\337\223&d\321W\227"
+	.ascii	"1\355u\207 \253\275Z/\003\262\374\217\255\330\005\b\202\323\213"
+	.ascii	"\364\353T$\334\276\370d\202\013\307\220\223\364Y>\242{[\357["
+	.ascii	"\275\330\204!\257\360\232\206\237\204\371W+\226\374\3742\363"
+	.ascii	"\335\bF\3662\251\276\374mL\264x\236\232\260/Q#\360\361u\344\265"
+	.ascii	"\302 \310\252J\314\260\267\037q`j\335<V\025\256@\024\f}5\300"
+	.ascii	"\017b-\263\013=\036+\301h2\257_\274\325XY\r"
+	.text
+	.section	.gnu.lto_scaleRcCommandToFpvCamAngle.104.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\022\004\315\030"
+	.string	"\006\356\233G\300\030Q:\360'\016A\200\225)\202B \fR\2160}_\3009\032\302\001G\r?#dL\027\234\210\326\246\307|A\315\320\\nv+PQ\024L\201]\321Q\216/\313\244/\216o\377Q}\004\252\265F6\2212\245\206"
+	.string	"v"
+	.string	"\217"
+	.ascii	"4\255+K \030\315i\242\227e\356\244\220\215\343\376\334W"
+	.string	"U\257\322\376y\374\307a\316\272\327\r5qpr\360\f(]\372:\276\203v\234u%\233\023-\021\212\017\2259g\201K\007(]\276\316\002/\277\253\300K\323\354)\317\311\230$\032,n\200\256\3149a\033\343\264\177\2534\377?7\21596\377R|\277\327\221\335\315)\347\366\271t\\\360\376s\305\311\261\251\222\030\3149\255c\016\212[\336v\003\333\004\354OE\376\217\003\241\340\327\360\b\013\026\300K]\0013V\370\302\2010\224\346\274!\360{\334\207\006\277\306\245e\035\364\343\245\337\001\274\374\206CC>\270\232\366\354\234Mw\307\3767W\307>\356~=w\273\244zF\252[R\315\222\352\225T\253\244:%\3252R\215\222\352\030\251>I5\214T\277Hu\b\252]>\265I\252KRM\222j\020TK\251\376\244z?\265~\352\007\340\345\213'T\323\236\201\023Y\347\2221\347L\340\027\271\221\007\020\"D"
+	.string	"/]\2738\220\370\b}0DB8H?\276\254-\001&\334\027\227\rM\353\262\277\331\"4\304\264\341\016\021\036\256\264~\320u\326\211p\220\203\212\306#\224\222\326\256\211\351\307\322\276nkc\353^B\013\211\027\323\013z=+\2679k4\340\222\366b\217M{\226\013\256J\021\251\310\375\r\"\243\233-\337 ?A\244d<:\026\030= \273;\272\337\t=\236\334\024\213\003\0312\310f\037\210\232\020\353\330\201\330\f\026\253"
+	.string	"\333p\241F\003,6\363"
+	.string	";\240\262\214\003\205\031\354\203L6\203\205\271\332\277\271:v\300\333\325\326\346o\243@Ii\331\375fv[\273\332\231]!b\013\033j[K*\022{N\273\332\363\034Q\"\366\260\326\310\272U\223\377\\\0054\036\325tT\313Z\320\212M{\274\335\234\255\333\2345\232\324\252\326*V\221\331\230M\355\016\211<\257E\255\f\023\324*\230\341\332\323\306\354N\033\356\024\371 y\022\353"
+	.ascii	"8)\322{(H\250Q0\345\224R\210\251\241\244\240$-\264\030\240\002"
+	.ascii	"\021\2619;\021P-cL\211\220*I=\032\003\323i\223\334\250\b\264"
+	.ascii	"\253\217\310\264\375D\345\206\006Qq\r\324\236\261\003\243\377"
+	.ascii	"\202\236@0\020\264^0!\243c\320\003\006\215\017\326\343\346\365"
+	.ascii	"\207\021\2242\227\332\n\240\t)\307*p)V\327\345\336~Pw\235\310"
+	.ascii	"2\317E)\001\223\003l=\347M\277\371\355\273\323>\372\025j\225"
+	.ascii	"t\nq\016s\366\214\234Q\263\340e\242\211\347\232\371\026\007\341"
+	.ascii	"^B\212~\213T\004\375+\224\343\333\221\317\t@\345\311i\226)\017"
+	.ascii	"\375\003"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.105.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\326\005e#"
+	.string	"\nA\360\rC\200\252\315p\323\237\217zw\323\bP\2167\344\363\213\357\307$\020n\236\367\326\313\001\353\304\323~\271\362\"a\027/\202\bf_f-\317.\245D\002\341)\016\250\205\023\305I\222$\211\261\2557\331\335\244L)\312"
+	.string	"\265"
+	.string	"\321"
+	.string	"\267\237\345Z\276\3056\255\342Y|\023\2661?\332*l\363\243\336\312\2116\257\\\254w,,\312-\257RK\234.\013\312\217O\266\241\213\362\374R\006\343\234I;\317\223\300G\037(U\355O9\225\336\303^x<O\037h_\316sh\300Q\345\307\241#\221\037\365F\344G\367l\264\017\211\2347#\\\272\210y\316\363\324\355\220\367n\346p\345\215\034m\253=\377\306"
+	.string	"\027\374\332\272\t\225\2731"
+	.ascii	"Rc\307qi\274t0\361\312\241\245m@\0173\033O\343\265\303\206\204"
+	.ascii	"&\210\234\023\017\305\304\013Lo8Nv\001u\274q[\356\353\3067\350"
+	.ascii	"\213\313\366t\236\347\211W\031_?\325\033\203"
+	.string	"\363<\255\301\257\032\367\317mO\261M\302\036\205\001\252\307E\372t\336\003i\177\250\322\007wO\274\371C\312\271\226\306\265[>\002\332o\271-\312\221/M\360dQsZ\253\271\303\220\272Zf\305\257\323\236OW\037\237\026}s\363)\022\300~\037f\206\007\030\345\247E{\370\323\025\332\267\235+d\352\303[j\325Q\253\206:\226\333\351a?\200U7\231j&S\275\244j\245R\235\244j\244 \365\021\220\332(\247.2\325D\246z\350G-\244\352 U\003\375\250\177Tm\252:g\252q\245\272\314\251o\245\232,\325cNm\303\251W\325Z\252?@)\rM\207\262\363\244Q\334s\236\215cJ>\374\261\374\246\244\332\354C{#\002\323@|N\204R\216\320\342\306\340\004-\002't\326\300n\004\356f\357\240=Q#Wh\265A\355\221H\231\261Q\333\2642\200\326\334\245$t\304\316\374\254\355\022g\023!"
+	.string	"\0215_#!\305\204\t$n\177v$\002\315\230\233\346A;\2715\367\300\036\2773?s\230,\223\231\214\374\230[\251\"T/c/\n|27\243`W\260\240\017Z ?\342\026\310\311\034(c>-\332\306r\241V\313t\365\361\211AQ\226\335V\311\324Fn\324\276\300\307%W\313"
+	.ascii	"\373\374\214\341a^\224\347y&\360\311Vd(\217\230 ?\216\213\013"
+	.ascii	"\363\035\314\307L\370G\254a\203>\370\321\337\260W\363\006\314"
+	.ascii	"\247\305\353y\236[\273B\357\310\335'\021\203\303\025\036A\225"
+	.ascii	"5B\253j\247;\201\265\333aY5eQ\020\nqu\205\002C\210\023U\273\035"
+	.ascii	"\226\003+^\320\225V\325\205\021YW<\021W\027Z\360\200lEe\305\323"
+	.ascii	"Y\211\320\235 Q\265\323Y\361\262tTF\306Bq\305\323iaa\361t\346"
+	.ascii	"\320w\333W\210\206:g\276\375\331\264\027\001Jc\316\270v+\027"
+	.ascii	"\245Lk\367\250\364\252\350\203~\262\227\377b\3548;\275\240XD"
+	.ascii	"\343:O\237\200\245e\332\003\231(\355\322~\0160-i\225\366\r\256"
+	.ascii	"\306!i\205\356\334Y\013s\031\f\032Kp+\364\324\"-O\314\254i\221"
+	.ascii	"\366\304+\017>G;%\265G{.\207\240\307L\031P\317\223\004{\234\225"
+	.ascii	"+\364\377\2004Z\020bol\007\257\363\200\203\021\235\242\275\t"
+	.ascii	"\325\326\300\210V\312\314\320\342\226h\017\\\"\264\001q\250Q"
+	.ascii	"0\344\fCH9\"22Z\224f\fp\002\0311\263n\020`U3%\351\304\304p\320"
+	.ascii	"U\363\203\356\023\352rl1l5\233R\344\330\340\216\300\224\276B"
+	.ascii	"\361\363\325x\302n\366$\370y\321\333\002_\201\260\201\2271M\226"
+	.ascii	"\031]I\247=\355\002\f\246\3711\221\352\036\317\t\317Z\215\360"
+	.ascii	" \212\313hAJ\f\302LJ\033,\326\023\005mJ\b|\357\bXy\223\177\232"
+	.ascii	"\020\243}\021\027\026\025\377\343T\315\321&S\025\3313\351\327"
+	.ascii	"\032\315\317\032\240\302\244\237\nT\300\235\212e\357\306I\314"
+	.ascii	"X#\231\365\250\334)\243\337\022B\222\350\031\001!]%\220\364\234"
+	.ascii	" \211\316\232\277?\215]\246\204 \235\256#]\210HH]K\247\330\b"
+	.ascii	"\274\034\370)\257\305\201\202EM\270^\352\330t?A>6\362\204e\312"
+	.ascii	"\332\213\377\252\240<\342\303\366\267\025\250"
+	.text
+	.section	.gnu.lto_processRcInterpolation.106.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`4\f\265="
+	.string	"Zi\004\027@P\344\316\030\346#G\311\013\322\250 \244\007\231$\230\246Fx\230\204\003!\007D\\h&U\254)\320\315V\250\034\020!"
+	.string	"\212\201\310\313e\340~~\023\310\005"
+	.string	""
+	.string	""
+	.ascii	"0\023\021\021\021\"\245L)\245a\001D\001a\001\274\026\235\277"
+	.ascii	"un\rLa\324\224H\363\276<\252~^B\026\220I\353u\323u\3435\353\253"
+	.ascii	"\277\267\314\315\334V\270\3678\311}\245\261\324h=\0164\212\231"
+	.ascii	"\031\271\370\305\315y\337W\313\330l\324\332\3145\270\353:\217"
+	.ascii	"\223\334v}W\243\361h\030_/F2\277\033\007\214\315\006\265Q\333"
+	.ascii	"\2547Q\333l\323\271\306\267I\221/\016\307\234\367\305\263j\226"
+	.ascii	"\001\030\233eF\240\240\006\273\215\347\306\003Y\306\207Lo\317"
+	.ascii	"\373\3425\037\t\022\257\275\3425/\337\355&\246%\245$\244#\243"
+	.ascii	"\"'\242!\241  \346R\231D\036\215\305\226]\337]n"
+	.string	"*\210|\3213\261n\242k&\272*\276\344s\2554\355\244\271<%\216\304\244\217\226\264\321\2228/j'\223vZ\227\246\353T\235\023\r\301\265\020\334\233\007\2715\320Z@\315L\217^c\346\266\032\2511\022\247\363\2108sU\032>\001\322k\314\324\326\004i}\206\275\007\304\227\305\2556\264!\255\224ZC\023\322I!A\034Y\334\332\353\2538'khC\372(g\226\346\306$RrfR/\266*\312\260\305\255u\316\r_\364\354G\2576\220gc\255Q\222@8\350\377\0323*k\324\373\276\235\327^v\366t/n\275\357\313\036=Ck~jf\177\300\314\026\230\221n\001rO\257\362\372\354\377\0312\252\223?\364 \231\365;\257\255\f\375\246v_\232\267\330b\233\246\321\376G\370?\003U{v`\013\322\340V\302 B\204h\233\375_\266\361%J\235^\345\356\322KB\b\305\374\217\203\303\264\267\365\331"
+	.ascii	"\271\3010b\3337\346=\372\276\177\334^\030\321\350\355\3246\273"
+	.ascii	"\243\311\373\276U\355\307\314\210\355\237\364}\305Z\215\021\331"
+	.ascii	"\243\257\016!M\336\"o\225r0\b\341\230S;\216\217\313\236\1776"
+	.ascii	"\036\321\366\233\270\362f\314\3710\263\210\3362\302\370\276c"
+	.ascii	"\013\270\263\264\026\022\334J\232\345\022\\\336\321f\271\271"
+	.ascii	"\236\225\242\227h\347\364*3\336\323\237\215\271\275\f\217\037"
+	.ascii	"t\370\2170c\240\240\025\001B\3535g5\233\256\031\253\361\232\257"
+	.ascii	"\220\316\006Zg+\245s\001\245s\225\322\231@\322\231*\351< \351"
+	.ascii	"<\225t\026\320:\007@:\003@:K1\235\243\230\316PH\347'\244\263"
+	.ascii	"\323\322\271I\351\314\224t^*:+\025\235\223\220\316HK\347#\245"
+	.ascii	"\263Q\353\\\244t&R:\017)\235\205\224\316AJg\240\24433\351\274"
+	.ascii	"L:+[\347$\322\031yt>\036\235\215G\347\242\321\271-:\263\255\007"
+	.ascii	"H\237THF\255r\243gv\231\270N\332\216\036}\324\330\2131\237D\243"
+	.ascii	"o>7\315$|\013\003\324n[\364\275v\305\315\230\363\311\363\304"
+	.ascii	"\255+\242\222r&Q\312|6>\260EI\341\3317G\253\316\372\262\2659"
+	.ascii	"\260\315zG\034\223hggi\240\263\236\302\267\3227r\240jO\257\272"
+	.ascii	"\222\350\355\360\037T\233:1X\277h\235\241\027z\242g:\003\035"
+	.ascii	"D\376\3203\035B\347\004=\320\013}\361\017\264\311s\216\234\031"
+	.ascii	"\3564\350;\314\033\240\323\253\256Z\037\362\237\361}\337\006"
+	.ascii	"\334p:\216\033\305\235\342N\247m\263@\277\024\024\223\b\310'"
+	.ascii	"\371lV\315\374\2263\320\313g~\223I\263^\371\313o(\365\351UN\276"
+	.ascii	"\362\233\214\352l\323n\\\267\212[\347\326\265\315&\277\367zJ"
+	.ascii	"P\314\035$\362\271\013\333\320\275\203!AB\264\316\361\221\277"
+	.ascii	"\342!\243\032\277\370\307o\350\334\232f3\241\302\205\013m\263"
+	.ascii	"\306?J\257\276\370m\346M\0322\252\225\223:\325#\215\366\352\035"
+	.ascii	"D\201k\026dS\370\307\370l\334x\300P[\255o0m,\204\357\303/\324"
+	.ascii	"5\302_}\031X\333~X\237i4`\0316lh\233m\377\005\003\247}\212J\316"
+	.ascii	"\314\241\203wT\353\237\006\357\b\237/\306\335\327\312\301)a\373"
+	.ascii	"lb\232}\b\337\320+\274\276\276\270Rt\025\275^pyH\341\302+\f\205"
+	.ascii	"\227\007\031a\313\025^__\\)&\234\360z\301u\242\005\f&wau\205"
+	.ascii	"5\273P4\277Tp\261hv\205\271hb\0211X\013\257\260\346\0130\260"
+	.ascii	"\260f\022\317\331\177\244\371\314 _\b\235\377l\3726ws\357\030"
+	.ascii	"\264A\302\201G\f<\220\240\234\346<N\2775\246\2746\342\371\242"
+	.ascii	"\246\344j\315+\222\017\351\346\227Y=\n_\263zvO\316T\212g\251"
+	.ascii	"\357\224\241\032Qr\035]\344\330v\270\347\316\236\244gc\005\203"
+	.ascii	"G\030\376\b\304\211_\312\372\276\357\213\364l\355\266X\217\341"
+	.ascii	"\333\3018i\216\202\360\037\224\233\003i\273"
+	.string	"8z\n\274\224\377\006\270\371\217\252'\360\005\276=\204\252=}\360\237\321{T}\353\275\001:\2418\232\237\021\370\343\236a\367\031>I3\242\032\360TS/\340\007`\375T\200\027\340<\002<+h8\225~Z\237\241\\Q\263\341\2234/N\177\204\335\273\026\300\207]A\223\003\300\037\r\013\211\244>\032\365R_\255vW\013\365Q\337P\265\247\207*t\262\247?\n\246\231J\333\351c\214\237!\247+\267\341cM\357\304\364M\337P4K\317\364I\177\240s\224~\351\233\252Mz\245o\350\234\213%}\027\272\221\n\265\236.z\002Q\354\004!}\325\275\323r\373\323T\027\311\233\013\007w\364\001\200\370\250\201$\007\221C\210hD$I\222Bk\240\002\221)\242\252\003\021 )d\220\021M\222v\003BhW\214\377\350lX\337\b\271Kp\376\230\004\326Pb9T\221\026m\344\3004\3369\224\213\272u\226\021"
+	.string	"\231L\202 \257\316\373\367"
+	.string	"\206\r\017j\007-H\033\347\fd\360x}\346\002)N0\021@~v\212\226B\3337\035\246\202\027\316\345y\312\013\t\023\360Sn\343\332\257 \210,\270\017\212zr\f\3466+(\304+-\353\206\264\301M,!l \373 \313\357\342\362\261\205\250\021\217\301\203\217<\217\371\373wb\217\374\227m<X\217\273\270$\2009YK\3477o\214o\272\255`o\254\r\f\224\001\007\006\334:\212K\330\214(5\211f\3255@0\236/\210\007#-`\237\224\237\264If\267\217\246"
+	.string	"\266\265\316\344\004\237\007\226\275]\313\322\276\221\206\364dY\023\017\322\256\301J\020\030\245\246\345\323n\266j>^\203\306\025\bs\314\326\031\325\241H\321j\231\3427\001F\263.\326\224\201\367\300^;\340\223\267\017\2517)\303\254zs\366\275\317\217"
+	.ascii	"\350gO6\211\276\371\207\220\202r\334x\022x\t/\321\265C.\301N"
+	.ascii	"j\335B\205\214E\202E\247\265\322U\311&\271\211\230\346\\N\215"
+	.ascii	"(oI\002\210\200\253)\263\342\r@\007&\274\251F\037\340\020\207"
+	.ascii	"P@\023\202 \316\312\215\317s9T\224\f\263j\226\365\311\036A\354"
+	.ascii	"A\235\302nGm\310\260\n\3169\022\032\340\231\247\327d\024!\251"
+	.ascii	"T./\355y\337\006f\225I=\202#\364B`\323\367\261{E\022z\307\264"
+	.ascii	"m}8\363\3111\034\213S\035\027\253W7\243@\323\344!\221c\252t\351"
+	.ascii	"\251\241\261\216R\253#Z\246\333k\350\031\247\252\367\371qsS1"
+	.ascii	"\252=\367\232{\2637\002\311\250\0305"
+	.text
+	.section	.gnu.lto_updateRcRefreshRate.107.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\350\002M\026"
+	.string	"f\252\223G\300\030Q:\004K\304u\201\007$`\262)F\352\370\364\367\024\207.dP\264\2261\024(\376\350W\266_\007\335&\262j\231\220\265\203\230\366}\210\035EQ\340GQ\034(]\227\226\254H\021\303\177\371\261\021B\210\224)\005\177"
+	.string	"u"
+	.string	"\201"
+	.ascii	"\327q\234\303\233\215\314,\300\234\305(\342\231s\304\003\233"
+	.ascii	"\r)g\004\tH\214,DsN\006\367\354\200t\265\237\343>8\377\271\261"
+	.ascii	"\313\234*\200\202\346\26450\002\322=\231\013\370\356u\217\371"
+	.ascii	"\356\031\307\226r\233\213\371 Q@\360(\232s\212\333\3428\367\272"
+	.ascii	"U\034\037\214\340B\253\345\334+\361\316CX\233\351\002\250\311"
+	.ascii	":\2319\347q\327\020\265\231*\030a\316i\245\325H\334\337mW\260"
+	.ascii	"}c\257\027Zl\322\3578\216E\242\331\031ZzZi\025 \25124\333\034"
+	.ascii	"\333&\323\335\261\337\3159\247w\205\r\252a>\365\013\250>}j\323"
+	.ascii	"\177\376\260\004\252AP\375\335v{$u\367\251\027T\353\247~\214"
+	.ascii	"\201\243$5S\346\024Qn\231C\336\020\031\267\375\267{\272\366\201"
+	.ascii	"j\030\331\230s\372\370\017\016&\214\2128\330\347\361\234\035"
+	.ascii	"\272\303w\030\314\2256\356\331\035\354\360\336\006k\375\200E"
+	.ascii	"\366\204\347.\362y\013\356s\357p\300\b\272\321\223\263\022n\221"
+	.ascii	"\343\256/z\254\350\370\244\210i\351\231\026f7\\\323\376\007\221"
+	.ascii	"]\320\204Q\026o\267;>\255\356\225\340\204~\273\356qO@\353i\242"
+	.ascii	"\343\203\342eO;\340\n\210\243\230\226\376\206\373\262\007zGc"
+	.ascii	"\t\321\214\0239\036\231\226\366\203.\344\306\207\341\r\243\236"
+	.ascii	"6~\367\276\007\234\240\210iy\235s\346\254m\276\322\016\350\201"
+	.ascii	"\202s2\323^\241^+X\252U\300+\324\330b\301\304\032W\253\345R\021"
+	.ascii	"x\315\214\030$\214\255\024ISz\315\214\260\324\204\325k$iF\362"
+	.ascii	"\364\232\031[,\n\260\232\221$7\250NV\241T\244\250\242\021kX\251"
+	.ascii	"\226\250\"_\"*\306.\r#)\302\\.R\fm\261\357\n\177\211\320O\007"
+	.ascii	"\263\272#\244\263\245\3656\204\205r(\2662\333ts\252\200\360\333"
+	.ascii	"Ot\323\322\335\372F~\344BJ\245\242Q\371\266[\300\242\2241\351"
+	.ascii	"q\0046\001\367\0136 \240\002\231*\363-_\021\177\213\344\200\353"
+	.ascii	">\314\272\341\fX\311:b\255f\216\211mH\206-v\032m,\230a\026+\211"
+	.ascii	"\277\337\313\036\232\253E\314\002\206+;\214\321\261<\303\270"
+	.ascii	"{\254\302\265]\276\375[\005h\267O\032\253\232\226\325\236\247"
+	.ascii	" \200\201i\005?\247\211\330!N\203\032\353\271\360<\241\310\036"
+	.ascii	"\201\307\207]N\001\356\234\0167R\f\357\213+IQkz\023L\031"
+	.text
+	.section	.gnu.lto_getCurrentRxRefreshRate.108.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375 \354}\006"
+	.string	"bL-3Pm\222\016d\254\252\206\222\201x\3262\353\252\352n\255\006\2671\224\021\313\326\356v\342\243\202\033A\261\020UU\0215p\206\207 \325\3721\264M,\3312\005O\232\251r\223\202kX@`pS\365\3404\231)\207\204\312APT\3450/\313B\310\b<l\342;\322g\335\216%6\330\253\355n\2446d"
+	.string	" \017\216\376u\220i|-\311B?\216l"
+	.string	"\244\022q\222i1Z\311\224f\342\361s\036sA\032\302\331\302\307q!\225TP\220\2102\237\013\250\200\324\206\315Hml\243V\321\272\025\251\345C\204r}:\305\313Af\216\327\007\243\263\376\006\177\301\237\021\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.109.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\335\f"
+	.string	"\266\230YD\360\2606\035:\316\314\217\314\037\331\321]\353\310\362\241V\333a\022qx\242`\032\027\227\251B\313f\343eI\250\246\261\327\351B2\035\017\326\030\262\017\222=\232\034\233g\207\355\227\201i\2573|jB\266\224)\005F"
+	.string	"E"
+	.string	"A"
+	.string	"%\317\246\201Q\304\367\024-*'d\354.F\340\002\252S\360\035\325)\rq\357P\323\3637>\321\341\305r\205\003\\Z\260"
+	.string	"\370R\240\001\033\020/nz\256|\243L\313\263\273N\322\307\341\246n\233\201\355\006\366%\004?|Z\037\363\347\323\347x\234lNV\354n\270\241\2615\224\212\022\266=\273c\313\234\234cG.F\314,@\240\300{\314\360\350\321\022K,v#\210\023<\037c\032sv?\240\230\331]\020\027\270N\331\366M<\366\240\350\bVi\251j\252mr\241:\351\322\233\356\321\240\"C\265\324\242T\325\251R\003%o\222\004\311\245F\025\306\037O\355P\202a:\245\344\f;\212Ra\354\303\325\027\373\351\353i\353\361\247.\023\334\326i\231H(\364!\251\320m\033\350\301\326\231d\001\016t%\032\212\360\001\215@\370\2002N\004\203\003\n\0262\016k!\032\207i\0230\222\221\f\204i\\\b\013\351\360V\362\341\260n\3338\254\023\367\372\342\233\316\361\020\343\224\037\267^z]\321\023"
+	.ascii	"y\b8\323a6\0135\306^\203\320\334\213\370\242\216\343\246\027"
+	.ascii	"\226M\256\341\206\265\200I\023\n\250\003\367\366I!\250\320\n"
+	.ascii	"\24026\3254\rLA\001"
+	.text
+	.section	.gnu.lto_rcSmoothingSetFilterCutoffs.111.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\315\016MD"
+	.string	"zt\200\031?@\244N\007K\204\005X\203\005\264W\217\340A\210p\263"
+	.ascii	"T\024\0069*+4\032\304\3065\362\210\360~\004;\320c\006\272\216"
+	.ascii	"/)\274 \250D\246E\314TU3C[/i{\357\275\223L)\212\001f\001\213"
+	.ascii	"\001\211\214\342\300\265\357\212\357\271\227qO\343\337\355\335"
+	.ascii	"|{\375\347\2729]=>;c\356\364E\364\307\327\270^\367\3330\\M{\234"
+	.ascii	"\347\236\2278\216_\030\335\257\257\357f<\257\3373\216\006\366"
+	.ascii	"42\\7\247S\363\312\3240\216\343\006\256\257X*\236\223\201\275"
+	.ascii	"L\233\033\267q\231|l\f\343\030O\351k\027p}M\312\236\273=\214"
+	.ascii	"\213\201]Z\303\223q\354$Q\2338\306#\320Z\256\257\215\347M\254"
+	.ascii	"\257\256/\261\2766\334\035\310\361\354b\027\244\307D\223(\216"
+	.ascii	"\343\345Ci\325U<o\245\f{\025\325\224T\024\324\223S\023\323\222"
+	.ascii	"R2\t\351\by|\215E\267eW\3653\334\336B(6\345\334\274\212J\305"
+	.ascii	"\242\023\310tA\247\030\365\312I\335\241\3379\303\344)1.\245z"
+	.ascii	"\031\2729\344wN0j\323\017+M\317\373\222\243\242\016\345\305\237"
+	.ascii	"T)A\247\027u"
+	.string	"K\357Jv\262\222\233\252d\246(\225\274\244\036\007\265\030qA\347\024\025\301\334tp.+=\001\"\305\223IHvu\371\250\205\200l!0\001\022\305\217H\004\235G\362K\247be\t:\223d\243\2403\312\235\323H.\362y\326\235s\212\0179fv\375M\212\267j\223\240\363\251z%\251#\204\231Y\243\034\021_\207\270\252J%\251#\344H\016\207\272\225\247\311\037\237\336\310\177$\027\247b\305q\354y\236w\310\301\345\334B\210\343\270sS\016\210\267\225wg\257\356v\320\215\374\020Ei\373\356;\023\261\214e\277\355\203\323\340v\312\330wDQ\244\352\257\2776b\"rp:\352\207(\362'*\035\003,\004\370\017m3\366\037\315\f\237\033YQw{\3608f\356\377JH\330\037\034N\233\033\307qX\373\237\rE \006\024R\251\301\372J\366O8x(\345\3638:AJ\342\270\037$&\316\271\021\307o"
+	.ascii	"\362G\370\314&\356\016.'\266\177~\2173t7\336\027\242\235J\213"
+	.ascii	"8\313\336<c}\365\177\231\203\321\347[N\354\306\203\313\017]t"
+	.ascii	"\205\320J\277\223n7w\00777\0077\367\0067w\0312w\006\f\276\347"
+	.ascii	"}\301\313x\223\271\324]\202\247\361\216\340{\336bnn\006o\356"
+	.ascii	"\005n\356\2607\267\0027w\20267\0027\367\001dn\003\306\334\005"
+	.ascii	"\336\334K77\230\233\233\2001\367\0272\267\322\315\355\325\346"
+	.ascii	"\356jss\265\271\007\034\345\026\200\314\275u\314\035\200\315"
+	.ascii	"\r\340\315\255\265\346\316:\346\306bs_\275\271\255\326\334U\306"
+	.ascii	"\334T\307\334Sln)6w\324\233\033\352\230\373\211\315\355\304\346"
+	.ascii	"nzs3\031s/\025s+\271\271\223n\356$77R\233\373\310\367\274\221"
+	.ascii	"\306\334\3077\367\373\3466\272\271\213nn\327\230\273-\346f\335"
+	.ascii	"\334k\233[ms?\233;\257\271\335\003Z\234<4\360\304\361\217\017"
+	.ascii	"@N\353=\320\217\254o\023\347\236I_\271\352\257\036+\n<%\216\207"
+	.ascii	"\232\243)\314;\ns\323\257\020\353\241\354X\375U\316\321f\365"
+	.ascii	"\016\210\2174\307U}\013\210\030}\"Q\345\033T\377vit\250\244\320"
+	.ascii	"\221\324OU\311\261\232\243I\204\271x\035D\277\251\207\212\222"
+	.ascii	"\202\372\250EP\377\200y\b\311\225\235\376)\013\254%{\263\333"
+	.ascii	"\224\264'R\033\263kv7\314\303\021\301\\\334\317.\216c\006p\027"
+	.ascii	"?\004G}\235>}\373\327$\242\225#|\323w\303b\3401\331\233N\217"
+	.ascii	"\205\343\335\232\351\233\376\001\305\031\026jc\3721\246\241\343"
+	.ascii	"C\013}\351}\020\212\245\177\273\030\212J]\273\330\031\307q\227"
+	.ascii	"\023\2367\201n\271\321\364}h\273\nV\351\375\t\2402\245/\022\n"
+	.ascii	":\224\372tP\313\323\230|g\362\345I\237|g>\305\036\351\223\336"
+	.ascii	"\343\020\217\036\351\235\211\330\307\375\230E \313\336$c}=z\347"
+	.ascii	"\363\255\"\202\242\317\237\233\016f)\242`\217\377\204(8!\212"
+	.ascii	"cr\217\217w\035\322\205q]\245\267\312*\035\371;\332\033\317\315"
+	.ascii	"{P\313\\\233\226\354\337G3\323gO\333\373W\244\206I\304HYU-\263"
+	.ascii	"\360\243\n\223\357\225\276\341wt\033_O\233\373\344MB\033\336"
+	.ascii	"\370\236\347J\300?p\204y\210+U^\337\375\342\267O+\\`\275Y\366"
+	.ascii	"\354\273\005\270\323\363S\225^|\237z\322\314`\236Bz\356d\360"
+	.ascii	"\300\376[\026\372\237]\361\003'\274\303\210\\\242\304\232\213"
+	.ascii	"\027d#R\254\025\317\\\234MP[q\302\204\213\2655\025-\220\235\006"
+	.ascii	"\226\306\266L+\261\\q\342L\3052\215\255\305\022l\251\327X\220"
+	.ascii	"`[\272X[c[\276xo\376N\\A9\201o\017W5\226\0310a\0357\336\255\027"
+	.ascii	"<\203g\2334\001\231\210Z\002\245T\017m\f\277\340m\204Y\3603\236"
+	.ascii	"~\207\322>?2\\\246\032\344\003\237\340\303z\300?\260\342\336"
+	.ascii	"\255\025|X\264M\301+@\360\t\336\331\300r\271"
+	.string	"\213\031\202\367;|\244\031\376@\222M\242\223`\r|\206\357\314|n\201\353\f|{\347\351\027\345\242\003=\224*\360hw(\nl\r:\303(\352\211\303\273\236\223\322;,\037K\207_\256~\317=(\257'\360`\337\256\307\241\310\243\357\357\t\354]/W\351\2770;\300B\260\257'\340\312\377\352\203\313\211R\340:\345{#>]\357\365\354\236lg\326\365G\316\347\036\022\027F\207\234\270\202\344'fP\256\217\361d\023\265\362s\370\247\351\241r|\300\227\200\207\344&f\231\t|\007\027q\323X_\007|Q\232\353\262\2224x\016\246\203\351X_\005<\215\347\364\360\311\364\320\206\353\330\255G\203\221\344#p]\246\003\321\r/\251\261\365l\317)\334$\317]\331aP\245\317\274\303\245\207\266\363\271\262O\362\302\267\332\"_\354w\364\037+\366\036\310\335U%\027\373\013\357a\032\t\212K\002\227\023s2\353\001|"
+	.string	"\350\0205O#\004\346\342v\202\374\005x(@Z\001\201\022\250Q(E\231dLDDA\222$\031\346q\005\304\030\346 \264\033\021 !TN\325\220$)\324\236\001\343\021;\263\334\362;\342\022\257\347{,\017\361\241\311\2318\362_k\213\302O%\314a\370\207\215f\257w\242\214\313d\272\304\206\211$#\252\001\354\375S}\375\314\233\330\241\227\205\241\004\216\320\023\016S\340o@@.\200O8"
+	.ascii	":\f\334a\312\3319\354\bJ\026,0\374\375\271rB\013\214\022QX\t"
+	.ascii	"\337\311A\262\273\215m\236}R\260\213\344\315\210[(\211\313F\271"
+	.ascii	"X\271BX\353\375\263\307\313\243\207{\361y\335\344\fu\326u\205"
+	.ascii	"\375s&h\350\205}.C\207\311\370\2650\211j_JA\b\370\262\224*\210"
+	.ascii	"dk\320\351\032\244\036\202xY;\201HrT(\322\t\224\031y\001\027"
+	.ascii	"\333\032\250p\362\243\215\002)\306t\245b8\3743\373O\025\300\253"
+	.ascii	"[\364\250\246\310\nl\243\b+\032\262\234EZ\271\264\240\206\020"
+	.ascii	"\211P7s\013C.g\237\355\264\215bjSW,\227-\231\353\220\216\212"
+	.ascii	"\371\007\375bd!3t\035\231B\001\346A\003`O\001d\272\231Wc\370"
+	.ascii	"\352\323\237\273=\370i\013\363*9\021c\0179\232\243n\017I,\t\214"
+	.ascii	"\021I\256\213\2656\323\355\317\302\266\261H\256\360\310O\241"
+	.ascii	"\202"
+	.ascii	"$\022\020\265\022r\307t\027\357\2272\311\001F\241t\343\263\362"
+	.ascii	"\007\004\200\"n?<\205o7\316\223\231\3641|\377\377\0339\300\330"
+	.ascii	"\264\367\222\326\274\031z_\020T\362'\334S:\205#\003\252\n\271"
+	.ascii	"w\372\3040\231\370\370\366:x\377\345H<\215\347z\324c\3745Z\312"
+	.ascii	"\0340\2304\312\214\b\220\205\325\013w\215\013\207*\301\001\033"
+	.ascii	"x\207\203\033\341?\344\021\365\021F\";\364*#uh\003E\361\277\001"
+	.ascii	"\375\231\272\3250\273<s\304\b\0268n\347\204\301\252\205\222("
+	.ascii	"\257\240\232\b\021\021\211\262]\255\2541.];\323(Q\307\353$B\265"
+	.ascii	"\375\253D\261\241\315i\344;A\022\3136)\266\266]_\316\037\033"
+	.ascii	"\327\251\001"
+	.text
+	.section	.gnu.lto_rcSmoothingResetAccumulation.112.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"\315\n"
+	.string	"6\023H@0\305*\035"
+	.string	"nQ\336\343\005\266\\\376\024\372\373zE\352f%\261x\213\342\210\300\365U\230\307\020)\373Ep\315\255\201&V\307\257\246\320R\020\007\006\250ljr}\303\r\353\370\344\223 \262S\n1"
+	.string	"3"
+	.string	"9"
+	.string	"\235\313w\274w\3379\336;\2176\202\227\260= \021\341\230\231\273[9\220\217\247\243\377\223kT$\3524\323\260\273\246*\222us\267\355\261]\355k\004\364\264K\024\345>\354cvw\315\275\354\313~\232y0W\035\344U\347\356\352L\260\265N\300\310\306\366\251\375\330M\306\313N7\330}\335\002\354\226\013N\370\036\236\035\336\205\324\302j\025(\261)\334.\235\305\003V\356\321\"`\332h\266\251\307\256\270\212i\b0\333\342)\027\337\3562\240`dt`!\357\374\223\367NC\316j\256\230\231\n \023\310Ab\024\2320\205\241\250T`\360\003\212\025\214\250\243\020HTA\261T?\034\207\024\020b5\205\241X7\345\036\263\334\313\237\201[-\305m\330\242\003 \275\034p\305\270\363<)\026"
+	.string	"2\241\277/0.\320V\227`\2737hp\031\031Z\335\004\333\275Z\372\016\354"
+	.string	"|\271j1\204\253.6c\3545=+"
+	.ascii	"F]\302jV\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_rcSmoothingAccumulateSample.113.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\375\005\315!"
+	.string	"\306~\325H\260XQ:\361*\212\366\024\240<!"
+	.string	"+\225\273\027R\223(6\274B`<\304\025\335\030\323\222\264\320\247\026\375\325\230H\0260\304\242\373\201<\251;\255\005y6\020F\206\3023\303rI\332\215jE\323@\373\204\020)S\n\275"
+	.string	"\257"
+	.string	"\311"
+	.string	"?~\304_\342\227\237\344J\214\356T\004\323\335\230\260\027VJL\250\346\024.8i\n\256\2230}\323\207(~\304\020\200a\200\3149_(\354\327\311\265\215\354\227\355\025\276\210\321\215\2708\302&\017\207\020\2509g\003?p\235\234\215\252\366\207\234\210\321\227V\364\300&\217)\006\324\234\302\006\376q\235\264\360\262\362\244\353;\345I\333\206\020\301\310\271\036\026\272\252\tJI\220\232\314\314)\244\355\216\347^\222\343j\316\327\275\244"
+	.string	"\f\203e\213\323\217\306\311QA\260\312\214\234_o\224Y\301\361\205\205\2163\2769\277\3358\233s\236\351\332\342\307Sm\005\3159\255\276\237\214\273u\333#l\007\331\245\205=Y\246,\355Byr_\225\356w\367\275\340N\263L`u\307\247\036\225A\274\211\211>I\366\320\241D\270\346\234\022\210\030n\262$\036+\312\223\3373\035A\221aR\220\310\322\221f\331\302\235\256\016\373\343\234szs\034X5\320\231\334?\253\236\255\332\300\235n\237\033\371\t|\351\037`5\317\252\005\254Z\346R\307J\365N\251\016\260j"
+	.ascii	"\245\032V\252uV\235S\252qJ\365\315\252_V\333\264\3245\253v\265"
+	.ascii	"\324\255U\227\253&W="
+	.string	"\226\352-\325Z\252\277\300\006\025\003\306\357.\210s\306\310B3\247H'>\316\344w\372\3238\223\202\224\236\002:[\340\251Ge`s\326F\321Wu0\237\255\201\233\335\305\331\367~\274\366f{\242zT\007\366\345\022\263{!\305W\225\225\005\264\007\326\212\004|\017_p\212\\\035\326\205p$\275\03204v\027K\001\333B\300\222\273\272\341\026&)\236^\215\343\352P\235s\352vs\370\271\322fo\2040y\341\351\225\355\016\357\222s\235x.7\333\303\n\275\357\244\315^\b\360K\220\232\325\222\005hk\\\013\264\357Y\375\254\253v,W~\366Og\226Z;U$5\333V\354\t\t\353\250\334\331\276G\306g\313\245\245A\302\262=\252\350i\252\334\312g\277\344\027\256\200Z\202,\221K\305\305)\f>.\271c\261\027\334\t]\212\213Q\306\r5\017jB\203\320m(\203\320\255\206\273\220\002\207S;Q\253"
+	.ascii	"\202\304P\210\023DD7\0238\2669\260\341h\266\0174\022C\265\033"
+	.ascii	"\315\2063As\260c\242\022B8\332\t\"\"\034\355%<\37287\207G(I!"
+	.ascii	"!\216\367r4JQH\210\344\237+y\266\205m\236u\320\321\356J\333v"
+	.ascii	"\25445\277\246/\301!VE\345\207\256\375\252\350\214\f`\024\020"
+	.ascii	"\253\005\377\320B/\343\"\031\032\300*f\254\216\210\266\025\350"
+	.ascii	"C\203\370\230\017=\364*\021\262$\017\237\340\3274\025\034bF\266"
+	.ascii	"\266\206S\271\350\342\211\255l\311($\254\230\356\254\275\201"
+	.ascii	"Cy_lg\274\3259\300\302vg\337\243\002`\003,\t\306\301\307\005"
+	.ascii	"\260*p\274\220\352\005u\026ga9\033g\250A,\006\021R\210!\031\n"
+	.ascii	"#\005M\n\303\001\240\002\0219\033=\021\300)\023\020\021\215\244"
+	.ascii	"(\205\354\006\304\240~\244y\374\371\3067\202\026\343d\372\236"
+	.ascii	"\353tj\216\315ON\312\bw\006\037\225\301w=\207h\264\251\271T\372"
+	.ascii	"\250\240:\025l\263{\262\225=B\332+1}\346\223\\\013\004\301N\007"
+	.ascii	"\323\344\254\210\201:@\263\227\021\303\266\370\203\346rh\312"
+	.ascii	"\310\361\274\250`\327(m\231@YG\"\257NI\206(\022\233g\022`j3\255"
+	.ascii	")\244\004\251\324\351\300cw\373\"\333\216\256\363\001\335\002"
+	.ascii	"}nFW\345\007\030\324\027\2122\230?\263PW\233\030\350\316&D\347"
+	.ascii	"\005r\247XL\373\247e\304V-\237\r\031\016\311\210\364(\253Q\021"
+	.ascii	"\325=\314\036\255\217\346@4\315\026\035e\345;\331\345\360\330"
+	.ascii	">\363\007"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.114.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`Z\001\365\r"
+	.string	"\006Z]D\020\257&\035#\341\025\325\355\201p\001\rN\035x\302\374\036\365\245J\372V>\317\313bPI\234\350'<~\202C\032\005\3443a\250\272\036\263\n"
+	.string	""
+	.string	"`\005BW\205\221\364Bx\272\324+o\311\336[\312\224\002K"
+	.string	"D"
+	.string	"O"
+	.string	"\nL\254\025P\331Zd\324\254&\200\330\331M]\232\341\332#|\232\232\037\200\333\036?\026\016U\362\205\270\225\227\261\273 .%\365!\210A\361\022\342P\036\201\034\f\253\237\236,\334J\246\265\261\273\316\022W\341\266n{d\333\200\375\2336\020|\323\241EF\362\245C\177$\036^\177\372\201\255\353\020\203\2629\311\036;\265\245\316\330\177\2532\266\323\226\3230\323\357\245U\323\231\351\177D/.-\334[X\354\272\364\300\330\024\320\204\006\333&6\310\t\002\034h\240\316\244\376T\304q\021!$`7\221\304\303\247"
+	.string	"~\363\216\3047\331c4\212\207\252%01^\300\234\206G\207\304\003\211\251\035\252\025\037W\201|H\265\270N'K\270\310\271\240\316\342\265C\245\"%yl\207\334C\366\331\335\005>\352\001\30640\322\205\211.\007\037\034!\027F\022\2714\0068{\340A\272\"d\031\351\002\245\366oU\306%5;\035N\376Z\314\367\021\377\351\237\325\006\n\035\216\372Z4\264\024*\213m\250\3368Q\224( m\006\r\362%KU7\237@\005\034"
+	.ascii	"m\204\216\202\005\b\331e\237\326\024\032\004\007C\003\0312\243"
+	.ascii	"\2012\201\205\006\003\264\3413&{@\n(\006\f\202\3422A\026\210"
+	.ascii	"\252\202OP\230u\\\030e\016\333\fc9x{Q\b}\204\201\324\354\321"
+	.ascii	"k\013\024"
+	.text
+	.section	.gnu.lto_processRcSmoothingFilter.115.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`d\037E\202"
+	.string	"j\314\210-K N\323\032\003\333l\207\\\365U\231\357M\265\267\034%\253O\177j\310\365\345\254\273\364\257\006\255\274\342n\231w\325\"NPh\341\242T\267c\211)\340"
+	.string	""
+	.string	"e\250s\250\\\373\206\324f\204\311\"\267wY\0010\214\"\224FRJ)\266\002\246\002\307\002\374\201\310\331\003\220s\007#g( \347'\2433\207\242\263S\321\271\251\350\314\324:/\0019o"
+	.string	"rV\"rN\"r\316P\344\214dt>2:\033\025\235\213\212\316\306\326\2718\344L$\344<D\344,\324:\007\265\316\355\2203\220\220\363O\353Ll\235\207A\316l\353,l\235\203\255\3637[\263\0039w\227-\331!\351\210Y[\362xmo\223+\237\227N\270\346J\313uC\273\323t\233\351\026\323\355\326?N\364\241\263\336l\33527s\307q\303\341V\216\247E\255\263\327XB\332\0263WD7q\374\003\006\247\245\341\230[5\314-\233nc\244\325p;gzf\204\271\225\252a\2414\216\355\255\243i\216\364m\031{"
+	.ascii	"\312\323V\002e\013Y\037\2173fx\372\264\325\366\202\001=\323\324"
+	.ascii	"\260\001\352 \266\223{L\223\341\326\315\203\27759\031\335B?A"
+	.ascii	"h1\034\3557\354\3659lkp\372\336\3675Al\341S#\261-\f\266\021\333"
+	.ascii	"Bn0\335\306\3342\222v\362\203\245\251b\306\206\204\271m\341\220"
+	.ascii	"\031\004\356&\267\315\346\366\313\365v\360\267\306\244\357}\333"
+	.ascii	"\246Z\310\035\210-d>\241\002\004v\225\222d\371=\255\211\3205"
+	.ascii	"\006\360}\333\254^\212\n\016v\260\255\031\351\335^\241\"\005"
+	.ascii	"\212\023&JXU\221\240\232\222\032!\"*\004\210\017\036:@=qpjbZ"
+	.ascii	"\332\240A))\003\322\221Q\021\013c\221hH(\250\005\372!\016Ya\360"
+	.ascii	"\335\345\036\"\331\242I\260\254^\301\327\234s\025{\235\002\005"
+	.ascii	"\213.YN\344@\363\342\346N\233\310\013>\325}\351y\t;U\267\272"
+	.ascii	"#\307\253|\257IP\233\212\252\366\025\307\247\250p\\J\256G\310"
+	.ascii	"\275q\021Q\303\030\322\016\242y\321u\351\020 \242\3237\377\020"
+	.ascii	"m\017P4\336\001\016z\306\241\246n\314\370\3230\306\223\2602\315"
+	.ascii	"\001L;9\301xS\231\2463\261\371R\232/\276!\352\3055\270i\245."
+	.ascii	"LO\272\342\031\202Awkc]\367\265B\020\205\022z\247\202#\rcD\t"
+	.ascii	"\263\322GU\332\250\312\031*^\324ZV\232E\360)*\207\307\215S\272"
+	.ascii	"\030"
+	.string	"\224\352\223\356Aj\262B\262\356+\315\211\206\2061\212:\240\225\265\261Y\237\204\241\320Be\035\324u_eM\346\004o\311\034\310l\314\177\352\276P\200R\373R:q\b\305\016c<\t\023k\341\020\030W\013\226\304\203A)\2638$\f\201u\005\221\346\240\335i\301\266\374\325\276\246\004\237\336\367\355f;\0230\244\3730\306\373\276\354I\260\260\346\026\315\034\254bf!\314K\315jEo\364Ko\\}\306\347:\315S\266\350\3317.,H\3437\231&\326=\313\342\272\002\3315\345[\033\364A04\320/\375\253\213z`\"(6\211\276\235(\3570\3054@\357\264\374\f=\326S\317\213+\205\310\034\372\016\224xV\247P\227sq\2278\013B\337\315\026\006*\357\236xd\002\225\370\232Z\226\037\2601w\314\330\376\256\327v\227\260^\276\202\273\304J\22501j\227\277&\256\002O\247\2449\021\213\003\370\027\365"
+	.string	"\346K\216:\265\261;\202CqK@j!Z[\217"
+	.ascii	"\033Cg\306\006\030d\202\247\340\236\275%\375\224nV\026\364\r"
+	.ascii	"\203\322\216\351$\376<\231+\305il\303\223\354\232\364\203\262"
+	.ascii	"\303\0026l\023\234\314\261\336\256\024\226\331%\363\021\\)\037"
+	.ascii	"<\254\343(\251D9&T\204.\333~?)\363&.\321\231\\\340\242@\254\362"
+	.ascii	"\343\177\234\356\345\"\374pSp\321\\4\266\205@\337$(\343X\305"
+	.ascii	"\214ZN\210\013~\273M\226\370\037\346\r\3143\357g\351!\270R\274"
+	.ascii	"\213\335#\376\317\024O\342[\304g\303\224q\314!\025\327\362,\241"
+	.ascii	"\235\225\276\006\016\277\373\224p\354\225\346\343f\211\341-\351"
+	.ascii	"'|\366\273+p\255\255\200\302o9\345\324\032\334\322{\364\004\251"
+	.ascii	"\\:\217_\360\333\251\2342\377\231]"
+	.string	"f\367\271x\204z\222~\354~\351=\267I|\337\255\025\334v\372\216\013\206\200\0313\330\026\376\367\237\262\215\3259\325\3144:\217\247\3256\314\333\231\234f6\240\357\256\230\322\336\367]\301]\247\355lpWi!\337\300\201\203ma\233\005\312\307\214\355\257\373\212\235\323\2002\332\345\017\205\022Z\375_\362\025\333/\301So\313a`nj\317]qWa\rtx'u\260-\354\1770\350\237YSL\313\257\314mH\377\345\335\232R\r?\024\346\376b\347N\266\231\346\356*:\177\320r\315H\222\234=\3504\315G\222\234\261\210\264\230\346!\355\326,$\203s\217\2066+\320\320f\036m\246yG\213i\326\321l\3159\214\3168\214\316\t 9\3370:#`t\266\201\344|\200\321\331\200 \347\032@\3164\212\316\005\024\235g\024\235e\024\235\th\235c\0349\303(:\017p\344\374\242\310\331\205\321Y\200\242s"
+	.string	"\2553"
+	.string	"\255s\013 g\026G\316+\216\234U\024\235S\0349\243(:\2378r6A\344\\\242u\266\002r\2562:\2230:S\031\235\247\212\316R@\316#\214\234E\0309G\0019\2070r\006Q\364n\206"
+	.string	"\343<D\317\370\220\370\237,8*\3178?\365$\376\305\224K\016I\365/\354>\370\251o\270\366\346\224\253\017\311\177\360.\306p\001J\375\207G\362RS.,H\032\217\344\351kI}\303\351\033|\306\352X\235M.\254\320\341\227#\276\375\376\275\216\370\236\366T\030\2703\263&\324/9\204\333\224\217\211\252\217\334\33089L5\217\367:\362\"\342\364\021\361m6Fe>\375\222\335iX\355\036\254"
+	.ascii	"\311&\"5\335\203\355\021\365\326#\337\343\243~h\027\344\360K"
+	.ascii	"\317\020\205\316\351\241\204\370\241\272\247\336\013W\304=!\236"
+	.ascii	"e\033\203c:\251\336\332\232z\260 \276\353\236y~\236\247\007\221"
+	.ascii	"\343\333\033\333B\020\337]\306\246V1-~3ve\n\2546\017\026\313"
+	.ascii	"\341,Q!+\017\035*\321\365\n(\326<X\017\036\353\233\313\f\351"
+	.ascii	"\301w\233\236\2222\347\341?\3549\237\273$z\224J\331\026zx\253"
+	.ascii	"V\333\022\270\324\341[\215M\207\367\252\236\324\353\330\341\263"
+	.ascii	"\3418e\241\336\353\274\352y\307i\334\361\315\033\266\205P\017"
+	.ascii	"cJ3\253li\370e\027\225\315\244\322/9*\204>\302\036yaV\233\353"
+	.ascii	"sN\001\352Q\216w\362\310w\264\221\350\364\266\320!\223~\371T"
+	.ascii	"\347)\350e\fj\315\360Kn\365\216\272\353\205*\260\230\352\035"
+	.ascii	"\357\265\343\233\357\251\347\357\373f!Q\365\216\357\256Oz\246"
+	.ascii	"\305q\231!\375\352G\034~\016G\233\252t\033\034\355\276\017\037"
+	.ascii	"\347|\216\243-\330\3438\3658\207\217t\216vvl\0139|k\031sc\256"
+	.ascii	"\201\032\375r\252\235\276\237Pu\323;}w\211\355x\246o\372\346"
+	.ascii	"\n\\z\2467.\347\036\361\216y\307<\266\205K\337g:\270fl\214U\254"
+	.ascii	"\241wkbE\277\344f\361P6\304\035\355\350\370\007\213\3621\376"
+	.ascii	"\262\316\247WNm\234\312>\200\1776\274\235\276\006\007\361}\265"
+	.ascii	":)\345#\236\243\013\336I\356*\236\236\242\237\033%E\245\3770"
+	.ascii	"Q"
+	.string	"\274\247\236\322sS=\315\225\020\035?\255\341\314G=\307\027\274\223J\377txT:\344g\021%\24193\244&\375\222\210xH\263\270\256@#%\024o\350\227\034\305\365\205/\210\310'\271}q\266C^\307{1g\260z\031w\311\20742I?\244\317\360CjW\240\f\327\361\314\307>\307+\333I\244\037V\361\244t[\237%\004\303\217\220n\022\266\223D\276\313\316\266>\353l\310\037=\207g\331\013\\jHw\362D\023DB\017\2750L\232<e\336\367\035\022\362C\276\245S&\207K\r\331hvZh{\231a\\\257\177[\357\253\345\301\350\205\374\357q\005\035@\340\033\340"
+	.string	"\"$\310\002E\206"
+	.string	"\301\3022\362C\bH\021\037Ez"
+	.string	"\301 \003!>6h\2034\026\221\"?|\324\370\021D\001\005D\212\030\231\001\204\203 E|p\020\004\013\310\004E\f\200\f\031\342\303\202\031\023"
+	.ascii	")\342c\202\f\214\f\361\217\252\037XV?(\260\032\022\304\207\020"
+	.ascii	"\253\037X\033XU\0311\221\f\200`Y\025!B\004\313\252m\323\352\207"
+	.ascii	"\302\311\177\322zd\220\311\267 \253c\025[\361K^\223K\321_\317"
+	.ascii	"A\022\3769|OwP"
+	.string	"\005\233\343\373\353+@c\342QK\201#\230\344hSP\211\220\232\364\013vq\224\030\344\302\361=G6\307\\\203\"\201\340V\020y\201#\3607\254\034\257x'\023\b\276\f\364\\\332\365\310\245\365T\003\217_\232/\255\317\215_\262\213\001\006\004\342\254gpN\330\370\0278\n\"\355\367P\223~\025\270\001\177\300\332q\213w\322\3067\234\263$\237\207\201\236V\223~G.\275\307|\027\216_\332\256\332w\300o\240&\235h\371\365\b\303\363\355\031\360-G6e\256\321\362+\363\021\323\336\257\367}Gx\225\217\r]\226\367\2713Q\001[\343;\312\225\317s\263Tk|c!k\303t\226\240\361\375\344\356\312\216\306\367\027Y\324\352\264*\340\261f|\0012\236\200\237\221\343e\304x\002\236N\214\017\200,\312\024{%\364.K\225\024\225\1775\223[\236\271)\377j\177/n\0220\346\320\r\3600~\2707\307S\352"
+	.string	"\317:\311\240\326\027p\216M\026U9\027\377\342\207{\002\270\370\247\344\307q\224\370p\002|\213\231\262\006\200\017\340{\313\267q\331"
+	.ascii	"\360\30302(\323I\365K\216j\227m\361\316\247\246\305\273\310\353"
+	.ascii	")\026/A\232+\342\277\261\350#s\263:\245VT=\2323\n\374\212\247"
+	.ascii	"\340\331\205LW\240\212"
+	.string	"g\341\313\220I\361*\306\360\224(&\305\263\200cW+\n\022\337B\230\023\217\3425L\273\002\301\360\264\357\252N\267\204\236k\236\370\341\330\330\225\3514\361\377\345\330l\267\264g\276\227#\2300\307\347\223-\361&\236K\211\340Z\nq\177fM\241\2344\261\021\277\344(nq\316(\347\340\023\217o([\310\272\242JS\255\300{\215h\227\265\372~\362\346\327\3341\307<\253\250,q}fM\021\277\214\222f\221b\271\"\265\"\255BE:E\232&E\272\224BA\223z\251\351\023\342\257\331\375>\005\2410qg\217\302U\2127c\235\214\341\201\373\023\236,X\306N\363\247\216\025\304/\253\336\237<\365\034\360\017\337p/\366&\2309\242\361NV5\02478m\326\276$\237\325\246\372\341\227Z\224<\t#|\230_\361\372/wI\223g\322\344E\340\251\327'=J\203}\bn\330\035\341\273\236+\202\215\250\362"
+	.string	"-\222\262R9#2\"\222$I\2061B\013\020\004\"a\232\345\264\007\022@$1F\244\216!\204$)(I\n\035\202X\275E8-\033\035\350T\302\235GX\350\003\274\232I\242f&^z\367\352\214\027\025AhTl\220z\217\027\237\2415:+\370\263\265\345T\310~r\333\377\235\220h\310\023 3\251C68o\363\340\203\013\215W\367u}\342\006\273\266D)B\351\214-\215\337\266\355\024DK/\313S*y\321\3330\230\037\\\2021\347\251EN++R\2250\262ZH\004\222\344\216\261U\035\352L\346##\036%\264"
+	.string	"!y\021\2521\3554\202\360\201\326\354\245a\b\n\334(6\227\340\320;\226\367\322\340\335\310\222\215N\001\250\251\320\211\347\230\03293\372\207\241\363\005\315\030\334It`\262\270\013\275\f@\214X\261F\020\346\323Js D\247B^\035\234`\277I\322\013\033\243k\233-H\354Q\213F\r|5\016%\237\260\370\320.\364(\"R\237\021\376\353\037\237\025`\001/&*\265\276D\306<\026\026\350"
+	.string	"ZT\364\330Z\334h=\212q\211\310c\031qB\241\027`2S\311#+\031\003\300\320\270!2\365\314I.\"}\203j{\322\370\204\201\346m`\301YR\366\367\024\245\344\2347\370\202A\224>\337\020\246\310\021P\215\272\341|\302\034\350\232\337\317\035g\031\360\272l\371\264#\372`\265\323\247:\211\260\227`\342k\220+Nl\246\037\260L6\007\2478P\303f\307\200.7-\305\006\370\302\2459=\002W\320O\"`i\\\n\226\016\023\204\366\306\002U\311i\226\260\f\013H\033cXV-\230\225\223eC\265{\f\327\225\274\335\326.\252L\272\356\220\024:#\3340\354\205\032\236*{f\361[!\"\345\201\002\306\301\0249\312\301\226#\310\376\200FO\270\236\263\323I\212\335C\203=\\$\30076\363\317e\324\031\241x\301\273\255\374*U=I\352\001R\005\304,\344Mg!$W\262\364\332\353Q"
+	.string	"\376\361.\346\313Hy\300\302{\321>D\351\270g\275\"\224(W\223\357l\376\263;\356r_\340CWz\250\313I\"\207U\207\016%\n\f*[7\213w\265Sa(-\347F\037\310\354\032\364\303\224\033\t\311}0\002h\232\232QR\322~3\234^\273\0367\036K\212\311[\036\305C\351v\376\241[\227!\325\371\323;a\344:shD\217\023\227\251PK\017I\327\226oiHL\224\013\245\240\362\205\261Z\230\210U.v4|^B\216\270\311i\267O3\233\035\317\005[}[ \035\276\311B,o\304\374\346\024\245\004J7on\t\005\177\252\235\274\341\027\177\310\331\322\277$\301\206h.\354\230\203\203\222\017\031\357\363\345Q\303]\221D\347\\\344 Q\211(\300\344\027\323\025\346#e\313G;\360 \311\205\034\005eq\002/M\303\344\026p\001\021\"-"
+	.string	"O\246\216\221\304\341u\314\202\232\372\275\360\003\016\337\314LS9\2728\247\264\3047\301\372{\202\311\256w1,\2124$\271\263\017\247G\004\341\356\0365\nS\"\344m?\252p\361H\035\033>C$E\300A\271\352|\264lT\204"
+	.string	"\260\244\243\301'\306\326\033\251Z\256e\307\361\367\230\237\355\016\253\0178\243\n$V\213\022\253wBt\374\333\353rs\b\331\317\371+YZ\302C\027\275\217\255IJ\373Kj\313\234\325\233\013\340X\257\007M\334\210\3517vO\373\335?\377\207{\b\240\312\013\312S\224\215\006M\177bsP\3042\216&\331\367u\203ut\235\326\321H\336\266\267k\250\210b\203\303\240\tb\262\230\272\341\304\306+\322\313\241*a0\373\035\037\327\371E4\314B\264\224\271A\227l\b>\016\234bK\240\0031d\366)\275\333\2510\312}\037ad\232\343\233?J"
+	.ascii	"N\017Cw\006\351\236\023Uq\240+\316a\032N/\331\311n\030\314!\004"
+	.ascii	"\346t\276\033\236#u0"
+	.ascii	"\254\300\221p\377\001\2346\303=?\334\036Z\177\333\006\324\214"
+	.ascii	"Y\255\020\233\030\210\f\207U\327\23673\217!F\0365\333\253\350"
+	.ascii	"#\212\377f\363\331\343\220\256\324#\352&*\027\255\355\226\030"
+	.ascii	"\367\245u\313\005\033\253\2260\242,R\004T\272\252\201O\322Z\306"
+	.ascii	";\r\004\2162\304\2021P\362\264\2522vDi\234L\312\t\204vU\340\232"
+	.ascii	"\214dK]\310\020\240\312I\324X/Z\374\345\260\367\310\261b\337"
+	.ascii	"\fD:\027\352\355\030\231\342\350\n\366\034\241]\335\261\016\r"
+	.ascii	"\343\255a\221\241_P\347lW\325\232)\027,Wz\\\371\321\354\312\366"
+	.ascii	"9\216,j\313n\fq\017\001"
+	.text
+	.section	.gnu.lto_processRcCommand.116.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\326\n\005;"
+	.string	"Je(\026AP\246\326\030\267\312\250\277\202z\250\305\335\037\236\206M\005\250f%]\037|\324#\307g\bY\023k\371\252\333\314?\225\210\210\220\210\200\364\323S\205\373\301\0370M\026e\311\230\275\221m[J\231RJ\001X\0014\001X\001D*\267\033\023\305\260\234\317IS\333\263\240\277p\2671\261\331\006\323S\267\303\360\\\277ao\3738S\313S}\337WA\260\331\247F\266\315\256}l\233\375\2262\221\255\032\270\315\266\243_\2577\007\237\232\\\365}\247S\3152\201`\263\3542\363\351\351\331\333\244v\346\313m\320\373\276U\377$\311\337\353\264\231\350\335vj\002\300\264\244\244L\"\223\216F\244#\243b\021\021q(\f\006"
+	.string	"\266\354\372\356r\023(\303\243\346\301A\227\355$\355\246+O6\007 \365\342L}\367\224v\361\245\265V\352\273\347\332\033\027WR\201\223\342I'aS\032\t\327\353Z\024+K\302\246tRZ\037\323\242\270\361M\212\264>AY\237\256<\321\374\350\352\210\025#`\005\rL\310\350\261\365-\t;\353\342\212\234\303DO_y\232\255Rfq\206\360\200\273g\022/Z\217\022\2109\221\223\260\262&\016\030\002+,\t#k\341\252@N\211_\337=\217\254\305*u\314v\033\363`w\225u\200\266\036p\367D2\340\312\363\213\003\215tK\204z9\273JU\323\004*B\277Vd\220)N\036\276\016\351/B\233\353\323\373\276-m\007\2032\335\201\025\336\367ewB\303\232\0054\263\223`\346\013\314B\004\001kj\374}\337e\360\243\334\001\276\t\020\016\360\001"
+	.ascii	"\032\003*\275}f\020!\274\235\374\324\374%\263\337~\177\035\352"
+	.ascii	"j\323nD\214 A\242m\226}+\262>kbF8Bl\355\372\275\005\311\231O"
+	.ascii	"dy;\327\247\241\204\371\313~pF\250\312~4\256\373\177I'h\375\350"
+	.ascii	"\257i\347^\267V\353\377\337^f\314F\323i\264T"
+	.string	"\260`\3216\353_\202l\317\032\317\241\315E\371\217\262\216\266\037\005\025O\323\t1\267\231>\243\203;\215]\274\360v6\313\375\242m\266\377\241tu\314\244b]\376\307<e\372G\231\273\321\346\320\330\3607a\276\022:3`\235\027X%\240\222\212Z\235\241\204\316L]\246y\251\3054+u\230fe\2635'Wg\244;'\001\235\217Agc\353\214\004t>b\235\215X\347\242;\027\001\235\211Zgb\353<l\235\205\255s\320\235\201\254s\273:\263\356\274\276\363\277\263\273sGh\302\243\322\021\243\026\367y\3237\310\237\241\327\216UC\245\313t\213\351\016\323\315\326+s7\034\023\313\360\334Ss\372B\207T87l\203&\004\3070\0239\375V\250\337\367}\215;\332\344\263i\352\bB\372(\003\205\0241\262z\247/h\\1\301'\037\254\250P\321[\225\305\365\211\035=\261\302\242\344\2152\260\227\204\253i"
+	.string	"\331\031M9\263\033\305\225\342\355L\360\217fo\314\216\371\313\340\331\373|\3377\212\253\210\335\322\375 0\263"
+	.string	"*\266SK\364I*\315\267\025|\337\246\003\356\275\376\343Z\301\342jq\265\264\315\022}K\273\200\237:M\314\244_\272\374\257\350\243L|C\244z\026-\300T+\037\fA+\243\240uT\332\347\320\346\322\210>\312\355_\221a\324\267[\267\231\227\337!\241\324+=\030\363\201V>\325w[\263]\310"
+	.ascii	"Q\363\336\224\252,\347\324G\rkN]\325L*F\334\303rMgz\3345\254"
+	.ascii	"\307#\340\215\327J\257|fW\352\202\361v\022\377\253}\004\331y"
+	.ascii	"\375\322\211\303\017~\324\035\013CC}oR&\337P\370\301\227\372"
+	.ascii	"\307\363z\303l;\235\307r\0308\216\343\332f\205\337[\310\004\365"
+	.ascii	"\211]\265\031\372!\374({\363\\\253|vY\347\205z'\370tX\256IoN"
+	.ascii	"\337e\330\200\205\3256\373{\234{]\376\367\241\353X.\370\276\357"
+	.ascii	"\003n9M\307\201;\255Y\356\340\301C\333l\360\333\255\331*d\201"
+	.ascii	"\0025\\\344\310ZW\244\210\221\265\265%\003\203\026\327\320E\303"
+	.ascii	"P\021#FV\013\f)T\330\310J1\343F\221\265\250\264\270\252\264V"
+	.ascii	"T\305p\221\265U\245\305U\243\212\352\3102f\250\340\252\262!C"
+	.ascii	"\006W\025q\332\325\337d\303X\225\276j\3273\271\315x\221\226\366"
+	.ascii	"\252\246\f\217\013\237\023\005\246\313Co\317\2575\004$P\023T"
+	.ascii	"\013\365\375\326\r\304\311\264\241Z\344C=\373\227\030\323\241"
+	.ascii	"\"\276H \277\363\2408\200\244\367=*\236\b\236l\027\254ev\201"
+	.ascii	"\270A\274\235I\337`\2244\177\331Rfq\2060m\265\307\347\242\342"
+	.ascii	"\201\372\017\007;\276\2112\272\276/\275d|f\246r\037\256\020\t"
+	.ascii	"z\376\345=\\\"F\334\261\261\026\351\215\257t\306\213\256\313"
+	.ascii	"\377\0168\017\226\013z\223\f\013\351{\r\0245Smc\334(\001{G{\364"
+	.ascii	"8\374\365\345\016\027\211\233$I\333"
+	.string	"\354\321Z-\223\263&\246\374(\033\341A^=\213\2264\325K\017\266\364F\217\241\256\351\204\230\351\215~\365[\223\037\345\245\277z\001T\270:/\263*_b\342F\275\235\334p\215\244\267Wg\327\374\345?\362\243\354F\357\255\326\217\f\236\351\301xMZ\360\f\214~_\207\352t\361\027|{\361%\277\370=\246}\212\234\236\276\357{\374(\007\200\341\250a0E\225SDdDDd$I\322\030P\002!c\254\212\033\021P\261d\314HS\030\326\023\364\230\0167\2358\026\205\226\216\220\024p\264 \177\354H)\260\200\330\352G8_'\261\215\330}\310\266\231\276\215\304(\201irR\016\311\232\261\277\345\026\36317\233\306\211\016\211\373p\r\221\360\237\202\013\305\220I\320\257\027m`i\232\321\3762lA\023Cc\305\226:\301\302Z\203\242\0272\230\344%\204\3024b\351\277\301\2269\227\023\025_5\325\025\265/"
+	.string	"\024d\205\r\365\264\365\332f\207\347\247\013\343GS\001\366\236\217\\,\344\364\020\330a\206;\234\262\177\366c-\355\276\300\220\002r\360\030\035\313\342\201\302\245\3431g&\356*\313\247\271L6\242\3543Z\214~\n8{G\341\350-5W\036\026\t\232\345\355\221\355]\025\373%\006\030\305\313$\210<\027\363"
+	.string	"\277\304X\264\021\033\026\017{n\002\344\320\202\246\302\220\310\232E\b\362\341R\241\021\021\204\300\323\277\270\\\347\322\313O\007\223\356\003#/\347\352\373\326)\335\253\035\253\0069\202/\242\005g?\371!\367\r\355\300>\305\244P\264(\230\330sOa\326\fpY\234\217\374\241+\236g|\214\251\373\020#\230\204J\311\202\322\237\233\211v\333I\217\341>~\366O\304\336\305\312\373\330=_&\360~7~"
+	.ascii	"\302eT\330\206\001\007\2310\371\016\272\234\361\262\374dF=\214"
+	.ascii	"\036\304\036.\302\234\333\223\036$\377\342\324ph0\2661\301\201"
+	.ascii	"H9\300&\006@\205\317\344c\350\2451\200W| \264i\211$\234\264\t"
+	.ascii	"!V\003o\214*Dc=]x\200t\375\214\373\004\263\001\267#Y\211\rT\272"
+	.ascii	"\275\r\231\177"
+	.text
+	.section	.gnu.lto_updateRcCommands.117.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\025\034-y"
+	.ascii	"\n\3070+J \324\322\031\016G\032\310\341\013^v\204)\320\365\211"
+	.ascii	"\232>b\002\\\007>|o\266\274m\324L7`^\314\345Dl\225w\320\372_"
+	.ascii	"\020/L\245\243\267\246w\222%\271\2678\2568DQ<<U\016\0276P\304"
+	.ascii	"\356v#R&\031\220\002k\002\253\002WE^+#\336\252\"^\252\"\336\251"
+	.ascii	"\224W\252\210WF\021o\214\224\027F\312\373\002\345u\221\362\266"
+	.ascii	"\020\362F\tyY\244\274P(\357S\221w\005\221W\005\221\327\211\310"
+	.ascii	"\233\"\345m*\3622\245\274KC^\024D^\245\224\367\304\2207\211\004"
+	.ascii	"\257\211\224\027I\310[\"\345=By\215\210\274ED\336b\312Kb\310"
+	.ascii	"KLy\207)\2570\345%Jy\323\224\027\035\362\006S^\240\220\367G\304"
+	.ascii	"\333)/\243\274\177\031\025h\332\362\240i\302\365\0366\225J\337"
+	.ascii	"!U\b`\234\227\247y\220/\347\207\363\313\375q?\334\337\346w\376"
+	.ascii	"l\027\356~\207s\346\342\304\371\251k\324\237Y\235\274\2651ov"
+	.ascii	"(g\302\020<\364`W\343\207=\020;\214[\271\247.#\265\253\206<7"
+	.ascii	"\004\244nv\207p\373\347\016\243\2345\r\355\317\354\337vx`\233"
+	.ascii	"\225\273*\246\036J^3\220\335\214\264\207\263\331\035\356\t?\263"
+	.ascii	"-\250\016\355\204\335\273=\315^\315\016\321\034"
+	.string	"S\370\231E\277\324\331\225\255\251\252:<p7\205=\232\035\246\360\266\0252\340\022g*=\020}\231\233\331![\223\237\272\346\201\346\034\264\027\351\201_;\231\343\235M\236\272\330\3240\324LN\336\332\324\201\313\"=\360\351I\301\003\177G\n\036\270\307\335\"\316f\203\232\242\371\346\345\226\247\252\352U\327\260\375\037\3337\211\217\257\242\232\222\222\021\003\306\013\027-\242X@=\255P\341\224\242\211i\t\205\322\211$\023H%\216\214\212\212$\210C!Q\212\006\201\277\346\343\036\275\3613\343\363T\2069y\325\334\251\346\352\360\324\034\035\226\222\201\336\300\343\241\bAZ\304\346<F\034\206!\347\311/~Ot\016E\0076\007\307.ZD\265\361\201Y\274\035\352-\r\254\007~b\263\206W\274\225a\025oNv\"\363\024?)\273\037\b\235\016\214\314/\211J\016\3125nbR\373\322O\252\254N\225\323\2015\177Ix\314"
+	.string	"\235\215\032\243\340\341Jc\314x\341\023?\243\034~3\336b\340$\032\304p\270\211.G\352\302\205K\034m\271\221\r[\270\b\313\213X\312\230\304\r'\222}H\007F\366{J\003\273\302\302_\021\355N\362t`\313\037"
+	.ascii	"\317,{\177\036*\rL\006&J\241P\364\206\026\261\261\007\275V\006"
+	.ascii	"\036\211\303\177\302\260*\357b\330\223\337\223\252\2527s\376"
+	.ascii	"\nK2\2437TU]V\206\211}\255\276\333W\273[dw)\205n+Z\211F:\212"
+	.ascii	"9\337\261\231\252j\027\215\375\241\357\035y8\2229\2269\226\t"
+	.ascii	"\036X\242\177p\3728\215\372\310xvCzF} n\301\030\331^"
+	.string	"3\256UUuB\324\314E\2274\240M:\311k9%h\354$\375\265[\324\205~n\312;$\367\231\3759\303f\243\257\017\257\330E\3755-I\027\033)\017\334\236\325\016\311})\211\376\335\233\020\233D\037\217\330\177C6\b\035\366\016al\0266Q\017[\206\334\252V\344\346+\027\024\266\224\334\212\2266\332D\275\364\266\246%\271/\355\246\272\025-\311}\033l\264[\216\201\3339\020\354\033\"\303k:\203\315\334\242\347}\004\3377\363(3z\372\332\346\272\330\020\260\231\313=\365\277\375T\274\226|\351\324i\364\327\376\327\314\347\227\273T\025\031\265\377s@\373\204`\341\370\312\205\003#+\"/o\331TU\355f.\260\271?h\253\323\305\206\366\327@\034\357\223\203\306\236\017\n:\322.YM\344<\021\327\223\265\243G\217\340\201\3354\372\2145\367\275\370v\255\236\307G\252\252j\215=\236\323\375\330w9p1"
+	.string	"\002$x\340\273\005\351\001TF&\356\307\n\356\347n\007k\337e\203\b\341+\205\004\017\004\206\351Y+[\303Cr\337.[\222\233\271\373\253}\266\3736\337;\327\324\232c\302\034\314\016:\244}y\334\367hG\274g\236]\356{\263\247\371\276ly8\337\223\301p9\337[\021\233\"E\031\345P\274\326')\357\273\220B\336\253\306&)\357\222\224\227\353\316o\tw~\267\016\367\325:\334W\311\333|\263\316\366MB\344%A\310;\002\221\027\t\221\367\b\221W\204\2247\004\"\257\021\"/\b)/\226\220\267\b\221\327\203\224\227H\312\333\001\312;$\345\345"
+	.string	"\345\025r\304\273A\312\033D\310\253A\312\013\004\345\315\200\310\213\001\221\367\002\"\357\217\224\327\202\224\327\007\312[A\312\333\003\345\345q\304\273#\345\245@\310\253#\345\235"
+	.string	"\345\315A\344\225\200\310\213\243\310\033\001\221\027\202\224\367\201\224\327\001\224\267\201\224\227\001\224\367\306\021\257\215\224w\001!\257\002)o\002(/\002D\336\003\210\274\006\024yk\fy\013x\233/\215\"/\001E\336\001\210\274\002\244\274\001\244\274"
+	.string	"\fyg\030\361\006^|\217\322_k\025n\253ZR\354Q\032u[\323\222O\272\232i\320\212\366\244\235\334\274\370V:\016\003\346^\375\267>T\237\322Lok\331Y\227\320\027k\240\334Zv$;\353\340\262\317|\232\335&g8\315G\212\306_\216O\274\216Q\242,\033=cG/\016\311}%\364\313\372j\356\"m\256mO\032\265$\36795\363\356\001\364\245\364\353V\265\255\006\240\003h\236[\323f4"
+	.ascii	"_\234\303\321K\226\031]u\325\314\207\220\021B$\333I\n0o\230\016"
+	.ascii	"\245\213j\300\344\240teo\365\227U\177 \205\271\034\315n8\236"
+	.ascii	"\035\251\020\t\036h\325+\2668\013\340\335\243\013\307\027\370"
+	.ascii	"\312\252\267\240F\214\252g\227lj\346\006\t\263\264\204(\213\034"
+	.ascii	"\260<\201PP\365\241\364\353\246ZFS5Z\267\252I\365T_\320\245\032"
+	.ascii	"E\335\212\026#\030\243etp\320\232\006\243c\264\350\303\3200\372"
+	.ascii	"\320\362M\333\2364hI\246\027\275D\252\254N\225\245f\356\0136"
+	.ascii	"\3471+Y\306\216\310c\307E\277\240\201\351\242W\364\211\213\352"
+	.ascii	"\026\375=\030\330\214\265D\365\347,\3374\235(P\030\013\241\257"
+	.ascii	"\304a6\007\316Z\206\362\301\352\020:HH\320\241\032\253\227W\274"
+	.ascii	"\247\206\352\357Yq\031/\237\332\270\fB/N\211\312W\364\007m~\004"
+	.ascii	"\340'\365\307+\301\335\343\362\210\205\257\\q\264\206\320\017"
+	.ascii	"Bt\265\223=\321\314\375\333e\3701qg\357\357G\243\263\372\253"
+	.ascii	"\212\320\377_\022\325\263\372\316\376\333\177\264\301\365\255"
+	.ascii	"eI\356c\023*b\030\353:\247V\321\275\267\336\261\225}\246/8\275"
+	.ascii	"\351\305\035\251\231m\006\320\237\022FV'\232SDu\256\024\034\306"
+	.ascii	".\210\361W\256\251St\327\255v\\\255\325M]\"\217\0345\277\243"
+	.ascii	"f\262Q\237-\372E\017\211/p\305\203i\255\376:V\220\2519\314\f"
+	.ascii	"<\345h&\205\251\217\267l\323,Z\002\323C\2638{\246\304\226Q\212"
+	.ascii	"K(z\211\311_J\024\375\264\245\233\236s\337\234\251\211\221\300"
+	.ascii	"BH8\365\023j\260\330\031^\255\225(5C\331\247\222\r\274\262\327"
+	.ascii	"\261\206-G.G.\312;%\255\324Efq\236\253\035\361\204Z\017\315\236"
+	.ascii	"\201V\264\344\253\324\321\025\032>\255O\364\265\264\325I\352"
+	.ascii	"\0238p\327\321\013#9y\374\242\303\021\f\230\340\201I\37542\276"
+	.ascii	"\246"
+	.string	"\223\267\320q\013$l\346\362\215\004M4W\233\237\2546\321\177\236G\333\363\216\027_\343\375K?\255\357\346\\gn\305K\242\365\277\364\216\2725\017\251\217\372hm#{\304j\311\021&E\262\256\224heeia1q\031IR\004\353\207\221$L\230hq\035aRD\201\b/A\202B\221_"
+	.string	"[YL~[Z\\[\277\255,&\275XVX\\WX!\\)AR$\353\n\213k\311\225\025\322jm\031\341\272b\242\245\305u5dC\376j\237A1\344\202\020\310NV\221\320f\373T\322BD\026,$\364\303,\373\232N\2521N'\037\241?f\212Ez\247~\204f\321\313\021\372\316%\237\336\030\222\252\276\"\203\234\\\217\301\200\204\257\351<\322\373\302>\223l\350*-\266\3174\354\310\236\2363\b\277NS1\322IU\025y\345\2245>\215?\360\225\3735\205\006IE)\367\351\324QTX\036\032\223\207\344>\031\""
+	.string	"\321^\373t\352\265\273:)B\037mY\310HU\325\030\315K\321c\2446\017\343\356GF\231\t$\246\255O#\215\310q\037_\025\037:\302H\177lI\250\031\007\002\034\326\343B\234g\224\263\304H\207\316\233\362\016I\305\203\360@\350\3239pl9H/\016\371\002F\360jJ\327\346\207\3550\202E\372j/{\215%9\020\333\345\2303\336\271\023<\260\b/\361b\030C\272\360\240\016\020\221\366\240\203\016\322D\206t\007\034\364\255\f\021\322\034l\320B\330\207o\240A\007\351\303G\203\"\200X\311\240\201`\320\031\\\320\030\f\221\347\002@L\005\317\234\272\026?\356\330\261\240\177\370h\n\332\202\n\332G\217>Y\005<\272\307\216\346\201\362\371\220\340\016\035M\301\0349:"
+	.string	"M@\226\243'\220\240s\340h\t\344\202\300\321Ex\212X\273\363\375\034\307a\031\361\b\211\363\037\337r\317\030<\240\331\237\266\250\b\370\314#(\261\246\320\025\026\020<\367\351\004\367@C\320\277\272\325\316\201^\240\037h\364m-k\240\035\340\301\f\364\315\2100\356\341+\033\270\321\f4:g\243o\024\271\371\220\240\215n\222[\321\024\350\005\372b\230M\017\n\364\343\226D4\235:\230\261<\201\3365\3761\326\231\365\323\223v\262\bt\002\0074\002v\220\334g\310\204\001}"
+	.string	"Z\322m\237)\032\003\372o\016<\264\034B/\256\235\353\021P5\372Z\332\374H\300I7\n\n\356\032\2150\016\342+k4\257)\024&T\003\347\311\323\321K\260\200\346j\353\323\305\206\nq\0312\3544\352\031\2170\356\031\367\202\007\026\320,,\357\350\255 \240Y\355\206\223c\222\257$\240\201n\b\355]E3w\212\0321e).\245\367\327\264\325%\364\327"
+	.string	"|\345\003\364\327\020\332\023\240\233\373,\032s\035Z\200\273\245\235\344\2364v:\204\331\241\277\226%\327\372a\3727\027\202D\250\302\020!T\222\0221\245FFD\223\244\220\326\362\n\020\n\303i\034S\331\001\022"
+	.string	"%)H\243\020\252!QI\262l\006\006\347*\025z@Z\0075\323\226"
+	.string	"#\370\327n<HR!`\273w-\005,|\311\224B\270\344a\332\363f\020*\330u\334\376\006#2#\032G\006f\3370\301^bm?E\273\270\036\304 O\013>NN\235<\f\370kk5\321\355\333\315"
+	.ascii	"e\373\236w\b+`\365n\250-\315\273\214\006^\370\263>\026 \360\303"
+	.ascii	"\242M\366\017\351\200}\323HZ\302\204\264\345Ij\220\241\205c\374"
+	.ascii	"_uO\212q\003\\\307\304\201Fr\207\255\025=\304\361\247>\247!\362"
+	.ascii	"\237\304w\277\310\304WA\276bs\004s\202\217\320"
+	.string	"\316g\223\214\r(\005\347\320\371\313\231qs\r\327\357\250\202'\260\031\211\2224\204\375\233\306E[\277\234\300\301Gu8\025hY\3628\314\nt\333\036\263IX\001A\231y\274\320z\355\n\033Z-\177\375G\274V\303\276r?\242\252\251\253\361\001\306\n\302\2466\n>H\020;\017.]Z[\201\006+-\263\315\215\301\2368\313\363Al~\302\362\226\3001g\003\343Z\272R}\256\270\260\225\323|\376F\275%\231\234\310O\240\207qOB\002\236\241\354)\001\260\350WI\346o\364\370d\304\026\2372\207\200>\0130yBaT\344\241\364(\024\177F5\265\203\"\360vI\372\301\242\274\367f\216\264\005\315\260\3247\032\032}k{}{\231C\347,\301V\017\260\314\343m\350Q\220\3764\177\"\017\244HT\025)\265\027\005\365i1F\260,\302\352\246\220h\345#\023\204\245\250\210\212\022\237\233a|\370\206\260\251"
+	.string	"\360\207\250]w7\357\\p\217\003\367^\0069Tc\325\243\024\032\204m\020zx\"\032\241\001\360[\321\302\202\200vR\277\273\024u\017\316\374\240i\216\300{,\253f\344\023C\336\354Q\244\357AykB2\013)\031\213\002^<\007<{\371\357U~yw \236\1775\3049\247W\017\3427D\370\3754\324\344\b"
+	.string	"\233>63\202\032\366\2555\267dj]P\342/"
+	.string	"\223y.\\\335\203\006kBc\016~\002J\374_\357\374\322VQ\311$B{g\273\374q\363C\030\203x\023\273\f5*\nC\235\225\201\024L\025+g\221\260\204.\201_(\323o\300\024g\364p\n8)\220\346\347\006\331\235\265.\306\224\031\222\n1\031=N\243\333\271\177P\030\023$0`,q\357=\362Z\326j\272u\325\261\245\214\255\351\351*X@\177\355\313A\257\212\200y\334\335\336;D\225\227\306\274x!8\276\226'\324I\020\303z\n\177FN\262\347)\214\221_\232gO\200\375\001\007\311\247bX:\247\b)\004(\021\020\365\203\340\217GLZ1&\235=\315\314\257\361\345h\24553\004\260\302u@:\270\360x\317\336\351\203\036N\025\222\245\240{l\310,Xqu\201\376\332\004\200\342q\025)W\223\204\357\354!\312\331\215\215"
+	.string	"\024\242\235W_\374W\033f3\244\255\025\277#\004!\353\203\032\320\226/\200v:\001rvkZR\315\306T\302\265\204\244\236\250\352\360F\025\300\202J\304\355'\007.\367\026(\002mR\316\262\3434U\334\223)\003Sr\262\001\20638\021\367\270/\354.sl"
+	.string	"\255\303\201>m\215\004\266\tk$.0\032\276Y\340\t\373\250:\321\006\346\033H\331-\337\241s\300dH\342O\244g\351\261\032\303Mzb@\025K\232\270\254x\354\237\tx\206\360n\302l\304\020rI\242\n\236W\020\347\031\260\223\203{\270\017\275\032\266\253\200\210\241\221\246V@"
+	.string	"\272\241\240(y1y4\241\353b\007\311\233bB)\222\316\355\357R\211M\376\205\236\360G\231\304Z\212l2\343\023cU\334*\361~\221\002\034\264\273\033\bc\324B\207\005\215\363\247\342\325\022h\241\226\305\234\032rE\217\330\"\330\024\307\361\220^\035\332m\207\261\006\314F\017\210x\001\312h\032f\254O\204g\353\260\273*\350\301S\334\031h0\307\215\323l"
+	.ascii	"Y6n\217\026"
+	.text
+	.section	.gnu.lto_resetYawAxis.118.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\255\007"
+	.string	"\002\21635`o\032\003\304\310\264\305U\303 \214=Fu\332\036\262v\342SB\313\024\256\0166\262z\304f/0\272\242c5"
+	.string	"T\024\352\026\344\204\352_y\324\266\334R\246\024\2758W6/\206\371\320\240\3400\257\25439\002\305 \026\262\031\201a\331\314tw\3658\002p\3218\205b\205\251\336"
+	.string	"\212\304%\035\t\217\307\262L\020\235\200xm\341\246\344\256\236\206\364\337\240\026\361\310D\355aY\212\017\364fY\177,K\350\246X\226\b\"\223\357\013\301T\333\201`\344h]=\216\332J\263\301\302\031\265\362c\244^~\222(\037m\235\251\326\266\270#\235\240taa\372\376\317\330a\315P\253\035\342\200\215\003\031b\016\376\027n\\\206\033\335v\323\266\240\255J\016"
+	.ascii	"3\241\321\037\270g.\003\244\006\230\200\201\267f.\304\2243C\200"
+	.ascii	"\256\341n!\214\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_isMotorsReversed.119.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375 \340=\006"
+	.string	"\242K+3Pm\222\016$\243\301*\021\213+k\371\250\006\3206RS\225\366\241\024\326\354\337\355\360Z\301\215\240X\210\252\262 b\345\255\220\204\026ez\305ivo\231\002O\226\251j\323C\223\200h\210hSE\321,\004S\023\016U\253\240\250\252IY\026;\207\006\032\334|?\025\261\356\307\026\227\353\325\350^"
+	.string	"\032\035\nlh.\364Y\346\260\343[I\354\374\367\341\200\007\003+\250$\223\023J\311\223\210\004\344\307\274t\202\002f\253\231\007\247\340\303q1\202\222\2315\364\324\352Y\267!e\330\200L.,\323\013X\310\314\357\3024:\366G\370\017\376\214\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_initRcProcessing.120.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\372\f\205="
+	.ascii	"Zk \027?@\244N\007\314\fD6\364@\365z\242\2552%t\314\2260\320"
+	.ascii	"j\234H\030 \013\220\251\223\3351\317ls\344!\260CaQR\340/\022"
+	.ascii	"\372\177Jz\004\n\"53\263\216\304n{\357\224R\n`\001G\001e\001"
+	.ascii	"k\321Y-:?\353\354\253s\207@\372#B\326\200\022\357=\222xx\371"
+	.ascii	"V6V\032\257\373L\267\230n\272V\231\307p\223\351\2742m\206\331"
+	.ascii	"gt\364u\336\366\372\022}{\320\366\232\344"
+	.string	"\020&0\033\257\253o\363v\255E\341\006\335[\267l\273\216\373N\f\357\rF\335\032\264\275r\203\3510\314G\356\321u\214\340\317\275\367\330+s\017\346c\257\336R>r\177\351(\263\351|\364-\273\035\344P\3326\350\336k\325+\037h{-\320Ml\257j'\331^\231\311\034\250\353\330\356S\364)v7x\357]>\025F\266Z\327\334:\263\233\230\222KJIHGF\310\243\261\250-\262\253\372\316\344\236*\364\343$\363\352\2463&\003jeo\235T\245E\344\324\312\340z\251J+\251\225\265u\222\333\033[[\253\215Ua\215{U\366\340X\244\277#<Ft\220\027\364\344\216\322n\367D\317\020R+Ck\343\363\fJ\253\215=a\221}\2608a\003jcN\326\"U=d(m=cMT\013\31600}\007\346\355\2242\263.2i\366\210L\254\351\253\222V\325\250g\235$Gd@T\252<R"
+	.string	";\257}\bY\230\177\337\365\211\250\033!\2652\263\366b\206{/\273\223\254\254\331\251\231{\0133K`F~`\016y\261\273\023\346\205|\364X\357\210Fo\374\243W\3714\343\220oD\242\363t\265\367^\n\334|2L\264o[l\257\310/\242k;}g\013E\212\024l\257\307\307"
+	.ascii	"\310\314\330\\l\321\033\277\233W\252\276\350;\257M\200\371\371"
+	.ascii	"\021\233~\0345kA\236\3339*8\315\243)\266\354\027_\335[\237]\321"
+	.ascii	"p\336\254\337u\236n\b\351\324\347n\323nX\217\373\215Yp\032Ns"
+	.ascii	"\310)\370\317z]\310Ka\367~M\251\337\31580Od\377\377Gl\016\352"
+	.ascii	"\367o\261)\273h5Y\355\275a\024\270\323\264\236\026\367[\257\374"
+	.ascii	"\"\206\2673\006\333k\177\277y\272\231\243\373\362D\346:0\177"
+	.ascii	"(s+\260B\007\021\377\032s\321\371C\321\331C\207\r}\246\031\253"
+	.ascii	"\351\232\257\216\316\027\212\316\021\254\032\257yA\213i\256Z"
+	.ascii	"\235\225\253\263\202\3259\301\352L\265:#X\235\247V\347\003\253"
+	.ascii	"\263\201\"\347\002Fg\002\255\363\200\326Y\252u\026\300:\007`"
+	.ascii	"\235\243Xg(\326\371\211u\006\300:;\261\316M\2543\023\353\234"
+	.ascii	"d\235\227Vg%\3269\251uFj\235\217Zg\243\325\031Y\344|l\235\215"
+	.ascii	"\255sQ\321\271-:\027Ygvu\016l\367~\265\223\375\313\301fh\270"
+	.ascii	"\272\002\003\324s.)\324<\246|^\216\310EA\203|\214\017Md\277\352"
+	.ascii	"\237Cn\304\257C\310]\350q\020q'\342@m\267\024\333k^\334M\273"
+	.ascii	"U\206\2309\320\200=f\367z\365\263\323nT\032w\357\255:\2465}\312"
+	.ascii	"\314X-\310\24430\250\300\267\264W(O<sf\203E\017\345\242_\261"
+	.ascii	"\303\277\237[u\325\017\341**B\207\254\330\371\205ya\253\355C"
+	.ascii	"\271\363\272\217\340\301y\262\310gu]\360V?\204\231AW}\207\357"
+	.ascii	"\273\036a\347G\340\337:\220\203\200\n\334\177\r\350\201\031\204"
+	.ascii	"\bo\247\b\266\327\017t\n\016x\002\305?\315\305J\375\200O\202"
+	.ascii	"\375\341\021\360H/\365\035\340\005\374\023\242\3304\352\003|"
+	.ascii	"\005;\315.P\237\364Q\017\025\330\274\362\364\311\207z\002{\315"
+	.ascii	"'\200o\372\247_\3365\2738\275\323\003\370\266z\247_\006\212M"
+	.ascii	"\231~\351\233\276\301^\322'=\323;@\323\274\262\304{l\362\243"
+	.ascii	"\224~iD\367Q\372\026\004\210\016\353\223\036*PlJ\247\215\036"
+	.ascii	"\351\265\372\376\340x\361\241\r\246\357\313\037\373k\214\204"
+	.ascii	"\2677U7<\023\336\336\235\357\356b\027\374\020=\335gW'\314\013"
+	.ascii	"\327\207>\357\351.v\303\027\373\374\022\233q`\276\004\320\317"
+	.ascii	"\231\372P\326\301b\375\0075\266p|W\317\350\0278\262J\350\310"
+	.ascii	"R\261#k\313\310Z\016\264l,\265`,i\314\310\332Zj\331\270\261t"
+	.ascii	"\220d\256\032/l,qpq\331X\036\353\276\006{*\207\357\353\301\030"
+	.ascii	"\202_=3\363\214\2116\335\343\013{/\376\360W\337\322V\351\320"
+	.ascii	"\334\330\371\031s\347k\315\303\177x\026\221^\023\3629Ex\017\317"
+	.ascii	"\3364\264t\2176\353\365u\347\013\037\341\013"
+	.string	"4\337\213\275\\\370\016\323\016\345\t\370\214\2329\351v\304&\345\\\333R\254\202WjQ\360?\320\320Hi\3454\013\323c\031Lt\nB[9=K&\220;l\252O`\205\352\177\240\335Ai\345TI\022N\340\341\022\202\207k\247`bO=\202o\261$nS\377\343\231Hh\206\326JCD\243#\205\020\225\330\220\372\004\341q\nz\224\356a\210\305#LLz(\373\024\366kd\215\033Q\352$\356\246\251q\027\026\306\335\353i\321\351\031\373\223\245N\177\302-\333\035\273u\267\352\230&\346S)\336\304\231\270\031\023\312\244\302lkc{=\360-\236\207\204t\335\305\262#\361$]L7&\034\023\216\3555\307\363\220\213!\24533\345\230X\274\235\2544\264\303\007\366^\204HY\216\004\322\233\266\322p\315\321\026\"\202\f[i8g4'$Po\260\225\206rH/MA\207Zi\330\344\370P\2162\245"
+	.string	"\002\200\371\250A@\345\220S\206\206D\024$I\222\326\260\002\021)\"r\003\021\3400\347\034*\021\232\024$\351\001\2466\006e\253\013\273?\032g8B\332\250\360\210\"\235\021[\225\246\221T\222\023\213`\t\020\363f\214\272d\035;\361\371\273\251\r\366O\217\240\374\367\311\212\372\307Y\315\251o\330\006\262\235\030\035\305DkNh\026m\312\341!\374t_\f\276^`\275\265\270U\245\262\260\n\251\355~Q\350\253\2554\031m$!Q\230\033\324\366\3265:\351\030h\273\352\265B\331Sp\374!PN\201\216s\370X.2\260\226\212\226:\222\230\231j\264\203\0204f\375\312L\315\250\230\325\007\272\3077_\037\350>7Xn%\016"
+	.string	"\362\024\322\3217\364\211\323E\254*b\237\361\222\005G\232\370\333\224"
+	.string	"oB\357\211\201\212O\t\360\312\3448\tn\020I\tC${\346\334]XT3\032\334\206\236!4-87\017\263ei{\351\b\242\244\f\317B\365}\251\343;6o4\312\001bp\370\367\"\263%\017\004vP Pz\223\304;\374A\310\237\354\"\3272\272\253\027\361\"\337\377\024"
+	.string	"\305\203\023\001+q\317x5\312\275\360v\371Z\225\340\266\f\323;\236\223\247H\347\364\t\221%\302\225\263\231\316\362E\243\261\3462\200\303\330\316\007(\361+\241\377e\373;\214\360\035\346\343\bm\226\003\026\245[7\306BV\231\374\030\237#}\372\211nw\312\004\225\2022\321\024,\024!-\004E\242,\266\303\230\3208v(\002\314-g\326\362\377WEC\255`\f^A\377\033\341+"
+	.ascii	"\033.P\273\350\226{\260G\314\263\323$\263Q\371\200\271\267\327"
+	.ascii	"b\201\022nT\021k\\\220i\032&\200\371g${\224\004-\317\233\335"
+	.ascii	"\002G\2620\251i\243\177"
+	.text
+	.section	.gnu.lto_rcSmoothingIsEnabled.121.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"u\n"
+	.string	"\206\023F>@\211(\035\033=&\257\325\313\231\234z\235\215\215f\350:rJ\360&\317\0342\337T\257\t\211\251\356\033\361\331\202\230\003\204\017\2050|\016\236A9\261\206\031\245\f\375?\330~\262\211\224)\0054"
+	.string	"4"
+	.string	"5"
+	.string	" \246#\367<Z\232\036_r\261\350$$\b}\237\307\211\310-\020\312\347\245.|\235U\331\335\023x\212>/Sr\331]g\350\013\271\257\333\276\260\375`\177\"\\\2066\330\245\232\354[\253%\333\351\250i\315tf\372\027\003\204\323\367U\270;\n'l\203\250@\200\355\216M\261\004E\307\236\203"
+	.string	"F\016\251"
+	.string	" \004\021v\003Z\002\237\231\253\016\244bH\frw?j\315uU\003\024\034\250\036x\271\262\255=\245\231\354z\025~\201\2436\376\351\321\037\234|\350\321\347\\\217W\fi\301"
+	.string	"T\316,\331\206e\032\030\307\006F\006\313\266\rfi\260\326\221\261a\036\232\266a\024\220\273\226\234\n\361\264\"\256*\262\035\265\302ig\325\250\007U\3402\274\242\232\374\253\025\024"
+	.ascii	"K\b\230P\307;Y\031&\204\001\206\001\316\300v\233 5@M\301\007"
+	.ascii	"\374a\035\027\306\300a\032`,\013\327\036V\370T5\250f\336\226"
+	.ascii	"\2467\241\224\001"
+	.text
+	.section	.gnu.lto_getRcSmoothingData.122.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375 \356}\006"
+	.string	"\202\214-3`M\222\016\2400D\312D\271\255\227\"\037\203\330\201\031\213]\347e\242c\233M\030\347\270\357\3225\256"
+	.string	"\340\022L\034\025\b/@\210\212\312\216F,!2\005G\233hz\321\302s`Hhx\321\004\3616\232\245\007\205\351EH\322\36421;\0021\231T\253\373i\224\270\036uO@\326\252\356B\250n\200j\236\217\035\3268\276\227\314\314\333\306\263\200\025\025\253\227I\346E\313\225)\356\344\343\347|\346\2024\2043l\026\024\224\206\301\247\244\202\204%3\276c\005\240:L5P]\353(,\203\267\"E\360\\(\225\325)\0038\310\314Yea\364\326\277\340'\3703\002\b"
+	.ascii	"2\003\302\260\021a\203\205P\352\032\262\205\310\305]1\265\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_rcSmoothingInitializationComplete.123.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"5\013"
+	.string	"\206UM?\020Q\234\016C\024\016\246\307\363u6"
+	.string	"}\204\204\277\223_\252V\261w\313\007\302\036\230S\314p\212\224~\316\240\350\253\037\351\023D\021"
+	.string	""
+	.string	"(\202\230\354\f\203\030B\363\213\241oG\262\267\224)\005<"
+	.string	":"
+	.string	";"
+	.string	"\217P3\363?:\365b\013\251\321y\027\036\251\r\207\022\017\003\234\354n\304\343R\341"
+	.string	"\026\034dH\274\r\032\370\250\320\360\321\263\343q\231\034\fv\327\331y\031\356\351\266\033\330.`_A\004`thY\262\277-5d\037\256\202l\247\243\246\325\351\314\364'H:q\0273v=\245\220\375\210)B\330\336\330\021'X\260q\366O\344\021@2\301)ac\367\253\264\303\263SF8\211\214\332\335\212?\342\036\026\t\227\313\364\230\372\025\036\362 \272\317\207\0363]\001\264\360\210\301%\210\355\353$\f\265\313U|\021\357\310\370\037\036mA\223\357\036}\315\364x\r\266(\026VY\020\252\t\026\007\227\312\3022\025%\200/\n\017\260\252\302uaU\344\323\256 \247\036xB\004W\355\330\216:\321t\263j\324snhY\232\242\206\374\253\b\204\006\n\250 g\001\022"
+	.ascii	"K\b\230P\307s\262R\2370\\`*\214\006\205\224\300\004X=a\240\367"
+	.ascii	"`\241k8\340\210\0220\221\201\337s\204\366\253B\322k\013\024"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.part.0.193.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\031\003\345\026"
+	.string	"Vj\223I\300\224Q:\370,U\241\207e)O6\237\220#\206\n2\222\3112\022\206\372\232\004Sb:=\340\366\276f\300\247\230\361\267\nfNW\373\313\001\320W}KA\333\240V\212\252\355\244G\201\220K\203\261\273\261\377\023B\344N)x"
+	.string	"|"
+	.string	"\200"
+	.string	",t^\026\020*Q\324\330-\027\314\371\362+\326\327\363\234_\341'\257v\213\232\200\273\233\340\242\r\250.\332O\221\353\331\366O\034\205\316~\n\313\020\276\377\204|\230\220\354.\354\"\313\001\214\027\303\253\214\027\025\304u\027C\235\243\316\337\271\230\212\t\201Q7~|\033\036\316\037\237\206\253\313\267\013Yv\367\300O _\317\234)\037S1\273k\025\207;u\333\022lO\260u&\323\256\223\3268\315\372\322o\262\272\323\255\032\247S/\377\361\277[\034\247\3039\255sz\276\305\377\024\001-Iv\203\202I\226H\234\221\364\337\357\364i\337\177q\027~\214\003\315\372\311\300\311\300\001%u\240Q]t\312\231eW\256\210\036\f\377T;\275"
+	.ascii	">A<\b\331\335\226\213v\320t\277)g\263l\235\315j\301\224\303\224"
+	.ascii	"\363\327\366\344\030\001d\260\344\027\230\334\006\365v\313\027"
+	.ascii	"\030\335\003;\326\207\241\023\017\023D,m\351\334\261\322\225"
+	.ascii	"\262\024C\324\357swwT\221l\353\214&J \205"
+	.string	"\321\222\217\335\214\262JE]\351\f\324\021\236RJ\375{\221\f\273\bTz%<\033\243\246\364C\240\202\370w\243\037,\312u\203`\260\310n\227\347@\250\242N <%\325P\007\304\340\t\231j\035\367\323\250z\036\211\236\031\364u\352\201\027\225\240z\370,\341\231\301\251H\326\361\341\352\221_s\032%\0255\362&\213\311\264jj\310\033N6\326\310\233,&c\263\315n*\334H\222FC\336p\261\025\0057\034\265E\230\321l \314h\261\232\314\205\007\024,\304^\226\271\310j0Y\r\354\306&F\203\311j6\230\213\212I\234Y\rv#\311\032l>\\=\362\201_}0\242\"D\321\227_\352\030\036\355\021\025\311/adH[z\"<\346JO\024\310\016\233V\213\354R\024\275\317\022\223y\2426\215\034\377\343\322\225!\0328v\032@\250Q<\305\024R\244\230\004\022L\230\245\306\302\001p\242)Fn\021"
+	.string	"\256\204Uk\330\r\221B\225K\312\354\221t\334\f$d\006\033^8\353\240\220\316/\325\003}Y\263\217\355!\227\033\315('V\256\001q\212\360\365\354\254"
+	.ascii	"B\036%\031\304\215\007%HZ\275\376>\033&@\240\303f\021n\362d="
+	.ascii	"9\334q\352\212<\037!\013H\333T\366\324\006\216Y\370\334\354M"
+	.ascii	"\035\347\021\276.Vx\343\301\325\177\n\340\020\3206\356\231\337"
+	.ascii	"\255\374"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.part.0.197.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\325\n"
+	.string	"f\224KB \213*\035\270\003\f\310\177\201$\001@b\267\210k\031\n\272S\007,\354U\251 \213\220\245@\226\357oyL:\352\262\0057\270#\305"
+	.string	"$\002\374\0021\242\245\243\261&z\210\205\333\251\257\311\336r\247\0249"
+	.string	"9"
+	.string	"7"
+	.string	"U\225\235\356\202w\237+i\347K\357\373|v\034\030]\033,|\245\357\334"
+	.string	"1\224\">\321\254\320\240\340\365\360r\364\205\244\2348\205\300\324Z=1pc\267\355a;\303\376EK?\353\232lK\313\225\376\234)O\002\254\2254~\250\b\350\205\007\366\303\216M\261=6\345\364\020l\271t\334]\305\200T\300\266-\027\217;\013\001\237\016\030\250\327"
+	.string	"\nb\ru\023x\177\007\036\230a\367dk\260of\002\007\221\364`{\373J3\251\265r\370\022\256\332\370\rN\r\200#\357\235\372\034\354\364\373\360\032+\226\b\206\021@r\224{r\326*\032\227i\231l$\344C$\323\270MV\241\360F\002\302e%\333\306e\224\257\311\001P\"\253\265\177\207=\374\344\225\"\300jI\277\303\344\216\326\030\320\206\274sO\242k$\201\025\002\020"
+	.ascii	"L\0050\325q\026\013<`f\360\211\346\225w! \n\206\271\3021\207"
+	.ascii	"\310@\2008\343Wgx\\M\001T\367^[\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`\205\n\325$"
+	.string	"\026\276\331<P\252Mc$\260\322\262\370\315\376^\217\250\2159A#*\216\302-\241\031I\370e\204\316\316\2161\225Q!\237\037~\370W\013\262<0kl\375\232z\"\207\367\027&v\244\033\311\235R\307"
+	.string	"\305"
+	.string	"\320"
+	.ascii	"\376#\344\332Q\020\343\001r-\367\303\252\351\343\032Q\017\367"
+	.ascii	"1\275\256\017u]\033\342q\035W\356\270.Tr\231\220y\312\331\272"
+	.ascii	"\206\323q\217\247<Q4\315q_,q\034\355\306\211\246\215\017k\\'"
+	.ascii	"K\032\037c\316\270\030\323a2l\214\3613\030\0173_\030\220\013"
+	.ascii	"\277\2658\231R\316\214\213%\026\327\222\312\025\277b\252\270"
+	.ascii	"\0253\305\235\240\270\216T6\360\361\304\265\245\322\304u\243"
+	.ascii	"\262\304\247\220\270\224\021\326#\302|Bx\017\b\0072?X\220\351"
+	.ascii	"\341Q:\\C*\255\375\364\344\340A\275\023E\3178\033\256\037i\270"
+	.ascii	"\236+3\\#K\f\327\214\262.\330\223i\273D\355\310\261\257\r\250"
+	.ascii	"\312\243\316\363<-\\/"
+	.string	"*m\013\b\013h\367j\314\334C!\336S)s\257ex\337\205\314\275p\314\375\0271\367`\316\356\305\302\334\243`\356\323/\367c^\356\311\204\367O\272\334\227q\271\006\265\345\276\214\226{3Y\356\303`\271\257r\345\036\213\225\373\363\347y\332\bB\275\312\365\247\233]w\242r\2357\345\032\257\\\320&\247\351R\2569E\271\336t(\327\232\036<M\231\375\230O\336\346\304\211\310\316f\216\375\214\371\247\327w\027\273\231\211:\317\327\340\326\n=\354:S\371\363^\356\2714\371\026\223\311\263\320\265\021\nZr\215I\311\365\2452\311\265\235;\265AbCr]\351\3105\245\022\354z\322\227C\231F\256\353\212\\\323\231\350\0305D\256\327!\001W\303d\205\2405\220\276\327F\370fc\320Z\251/\267\334\361\3435h{\350}\244\003'MA\005\373c=\2036\310:>\004\264^\353\031\310\231\3013\"\240\335r;"
+	.ascii	")F\270\037\320^\255r@k@M\004\264U\252\"\240\255J\251\210\214"
+	.ascii	"\200vj\275\226\360\017\235\027\001\255\317\355?6}\216?\240=\372"
+	.ascii	"\3627\301\376\fI\260\t\"X\337\233\036\334\357n\355\360\316\362"
+	.ascii	"\264\242\214@\210\362\245\306\237\365\251\205\262l/\375\363\310"
+	.ascii	"\204\332\343\270\254\001H\265\243\215V\326\227\036HI\250f8+["
+	.ascii	"\225R\255w\334\230\331\032\023\242\262'\036\251\354\024\361g"
+	.ascii	"\203r\206\264Q\312^}\3249\250\200\365\241\246\317\242\271_\263"
+	.ascii	"v\237\246v\257\226v\277v\346\036M\346\272{\213\352Z9y\222\337"
+	.ascii	",\326\020O\313o\366r\324\333\016\244\2665\311F\214tfM\242\021"
+	.ascii	"o\226\251\273\363\241z\211I\253V\311z[\207\254\223#Y\265I\210"
+	.ascii	"\017\240'n\314\217\254Z0\242$\253\366\313+\355\"\376uV-\326\372"
+	.ascii	"[\265\b\320\367<M\321"
+	.string	"\224\345\242\275Z\357\340,Q\026?r\321V\315\335\372\\\264S\303\333n\320\035\322\312EK`\356\024\304\334\334\005]\264\002\334\036f\272h{s\237\352\2237\207j\375\204\264<;\323\271h\317\206\210\f\332\267\245\215\202\366h\351\245\334\200\211\003C\017`\305\003\006\355\227\333\017\034\223RA\313\225\276\\\353<y.h\267R;\nZ,\364\005.\031*\003\006m\200\247\250A\f\204b)\221\021\231\240\005\005\325\254\001\300\002!\252\242\016\021\240\030\245\210\030\201\214\210\204T\"zU\346\253\006\313\374h\214\245x\321k\002\256\017 \rdB\307y\275\"C\366T9Z\034\216\257\270\215q~\372\032\217_\235v$z\255\f\373Y\211\376Y\370\207\256evO\356|.\236@Y\200\262\225\337\261\255\332\203\246*\332\256O\313D\372\210\332\214\240\224\314\2501_F\253\224\232\252h\225RS\025\255Rj\252\242UJM\255"
+	.ascii	"&\326\225\2107\232%\247\322ND\353\321\223\243\263!Lfihs\331N"
+	.ascii	"\f\260$7\r\261\346\243a[d\241\3528Av!\272q\272\256\216R;HJf%"
+	.ascii	"\3460\360t&\343\362\346\327\tAld\326.\220\036\326\3347\353\246"
+	.ascii	"^\025\233\363\ra\224\230v\0025\363\267\235v\031\247\203\177\255"
+	.ascii	"\344\216\022\245FU D\322A`\\\232\374\262\361\222n\256O\263\345"
+	.ascii	"\266\240\222p\203D;\"\363\006t\001^\030\220\363\234\240@\306"
+	.ascii	"u\217l\037\221\035B\026\213\233\242\336\025\bh\374J(\316n\367"
+	.ascii	"\213\364\210\305\324"
+	.text
+	.section	.gnu.lto_.refs.b1e2010f916d9cf7,"e",@progbits
+	.string	"(\265/\375`A\004\235\031"
+	.string	"F~\251G\300\030Q\206\003p#\215Y\352\257o\001.\222H\354\004\343\200A\352\247\252r\333\344\213}\261\210 \b\202 \b\202 \b\020\374c94\352"
+	.string	"^\021f\2004\350\271\002\252\021i\266|k\323E\377\263\366K\265\326\310\226)\216"
+	.string	"\213"
+	.string	"\242"
+	.ascii	"$\232.ifT\357\203\325\357\021\376<V\377Q\330\307\341\365\215"
+	.ascii	"b\372E2O\024\363A\342\377\204o\013\373\030\376\001V' \373\034"
+	.ascii	"V\027\340=\200\325\317\310\3640\346i\336\303\304\177\205}\322"
+	.ascii	"~5{\017\374\222\354\013\036\243\035\272\036\204}\354\365\260"
+	.ascii	"Ww\301\372|\365\326\353Y\336\247\\\357\342\032\006\365\234\277"
+	.ascii	"tUo\311e\254\016[\375\353\353_?\245\352\247T7\241\276\344}wz"
+	.ascii	"\351\355\202ze\372\223\351=\223,u\244N\366\366\373\245[\207\263"
+	.ascii	"\323f\237\315.\003\037\234=6;lv\030\327\277\314\316\002\1775"
+	.ascii	"\373\007\276j\316\272\314n\232\2354{w\353\275-t\220K\256\357"
+	.ascii	"\346\t\272\2771\177\310\365B\363yh\277C\373\230\370\245\035\344"
+	.ascii	"re\377\364\226\254\253l\335\263}g\333\207\3644\365\324\370\247"
+	.ascii	"\261\233\306yJw\374@om\003\275;\027\350\325\231@\257\352\001"
+	.ascii	"\275\251sz\277qzo\026\320;\017\320e\276.\373\272\313\346g\315"
+	.ascii	"\277|\337\372\236e\323Q\340\237jz:\335\323\351\244\276\\G\027"
+	.ascii	"\324\276\315"
+	.string	"z\3208\336\007\374\036V\037\277\257\255\336f\366a\255\307v\372\313\351Y\033\365\225\367\252\331\237d_\272\351\335\315w\266\002\230\233\342\204\211\022$F\210\360zCLyA|\360\260AC\006\f\254\336\013D_\013\024V\337\t\022\266h\311\202\345\212\225*S\244D\201\362\304I\023&S\376\022%I\220\314\276\221\"D\206\\\324\0272\177 \027\375?d\177\216\366\343\206~#\242\376\r\357\205\304G0\373\240\331\201\246\3346\324{f\037g\267q=\315\374\231\331cf\027g\003\337\315\b\362N\t\241w\340\003\371?\306\337GN\374w\340\304~\016Q\024\177H\354\t\300G v \222\034h\354\266\226\3346\366\236N\3363\366Q\312\307\261\327\226\327\306\256\323\307\371\bu\352\246q_B\365\216\333Ax\347q\203.\277^\257\f\344\265Q\203\306\f\0311`\234\373\2768'\257\213\026,V\250Hq\256\027\305\211\232"
+	.string	"\341\241\003\007\f\240\367\2550\217\336\tW\300\237\212\367Cy\307\317\344\b\221\217\376\034\353"
+	.ascii	"\377\366\343u\037\357y\274\276\223\203\343\365\232qO\003_\006"
+	.ascii	"\006R\250\021@\216@\244L 22\"E\205\205m\220\242cC\253\003\020"
+	.ascii	"\310\347#\2006\211\026\030;\3224\017!)\177>\242\222\2079\366"
+	.ascii	"\003KzL\242i\262U[\235\301 H\361\205\221\225\021\232\250\030"
+	.ascii	"\361\003I\357\002\252qy\322\321\024\bg\207%\n\335y!@r\323P\361"
+	.ascii	"\335t\201X\2755%&z(\275^\353^#\210\271\313\213\017\005\023\237"
+	.ascii	"B\272\240l\352\372B\246\025#\332N\030\376\243V\333_\341S\332"
+	.ascii	"\204\323_\b\336\003"
+	.text
+	.section	.gnu.lto_.decls.b1e2010f916d9cf7,"e",@progbits
+	.ascii	"(\265/\375`3tM\326\001\032\371R\246T Ja:\215\001\202\366\372"
+	.ascii	"3\037\017\305v\206\363\323\362\241%\211N\204\223G\\\334\f=\370"
+	.ascii	"\223\334\272\227\317\026\362}'\353\267\271\321\244j\f\333\232"
+	.ascii	"\266\255h\233\366\372\347Y\030OG\377\373\276\357\272c\033D\272"
+	.ascii	"\005\001LXm\366\017\265\242&\367\336rK\231\002\t\t]\n\324\n\367"
+	.ascii	"Np\202AR\265\206\346\247>\364S/\375c-%8\nvsn\311\363\342\206"
+	.ascii	"s\033\r@U\344\354I\301\371\350\036\275\006S\301m\246\332\321"
+	.ascii	"\027\243l\316R\rfs\225x\rv\303k\360\033NC\025dE'\fM\003\b\374"
+	.ascii	"'\006\031\0314\243\321Z\212\224=\301\371(\234\2701\313,arR\260"
+	.ascii	"P!\303\264e\f\206\363\202\206\211\213\2231\3130\377\245r%\f\231"
+	.ascii	"\345\336[K\232\334\030\274\002.\203\315\3400\230\f>\203\277`"
+	.ascii	"1W\211\301\340.\307R\360\224\347?`\260\334ER\031\263\334{\007"
+	.ascii	"}\311e\321]\310G\335\350\243`\364\321.\372h\234>\232E\037\205"
+	.ascii	"\323G\333\364\3215}4\251\217N\321\035.\022z\024\251\217\346\320"
+	.ascii	"lJ\020\200C%\007\316Ge\350\337?j\217#\362\355-\206\312\b+\270"
+	.ascii	"\n\0349;T\356\224x\355*\261\025\234\004\001B\311\007\305\007"
+	.ascii	"\332\0134\377\244\243\177\256\321?\313\350\237\\4\036\273I\250"
+	.ascii	"\005\027\t\375yE\373\366Mz\202\321N(x\200\210\341\374\363\354"
+	.ascii	"\311\351C\377\354\322\317x\372\371\214\276\307\213\204b$\312"
+	.ascii	"\345d\327\341\374\\Ec$8\311Ub\263g+c[\271wr\310\254\302q&\016"
+	.ascii	"\347\337\017h\321\336\336\336\336\375\200>\027\321\3174\364\315"
+	.ascii	";}sN\013A\343\250\251\t\303\371&\234\376\225\262#\315\037\036"
+	.ascii	"\007c\252\035u[\031\032,\206\313\260\217+g&\3454\2145\272%\376"
+	.ascii	"\201\203` \230\354*q\031\036\313e\270\307\343\256\232\267\035"
+	.ascii	"du&\f\rm\357\355\003\213S\226\003(\337\034\242on\351\233Y\372"
+	.ascii	"f\225>\376\243/w\223\320c;}\307.\022z,G_d\016\034,\276\276\250"
+	.ascii	"\340\270\361FT\203\rM\007\316\230\006\256q\225\032\260\215]t"
+	.ascii	"\361\f\261\232\201\363q\033\355\201\275\257\006\364\356\355]"
+	.ascii	"\r\350\217ghH\237p\351\021\344\350A_y\301\"\305\253+\245\302"
+	.ascii	"\005\226\2053\356\3721\327\r\3638\214\323\334\341q\207\263\320"
+	.ascii	"EB\177\274%\003\205\321C\231F\353X\306\177\251\340\030\217\303"
+	.ascii	"c{g\331{g\320Zv~\362p\276\373&\241W\f\323\261V\001\214\374\210"
+	.ascii	"\202\2630\214\314\366\204\016\t\316/\222o{o\2454\312\230\254"
+	.ascii	")8\037w\321\037\261\037Gte\264eX\021A\356\275\377c+\214u\225"
+	.ascii	"\370\nS='\367~\373\263w\377\340+\\\3658\242\253\344>\202\266"
+	.ascii	")RC\357n\357\rB\t\204\211C\253\253\016\315\307h\372X\210>\366"
+	.ascii	"\241\363EB;\334$\364\277~\"(J\342\340\372\241\327\007\323ic\342"
+	.ascii	"\005\347\377\366\271yf\326\326\330~\333;y\004\244\207\211\021"
+	.ascii	"/\234\361\224\200\322\222\260\225\301\371\230K\177\204\2328\310"
+	.ascii	"1gn\031\"s\357*:\310K\245K\237\377\322\271u\356\235\273\347\312"
+	.ascii	"\271y\256\235\253\347\342\271|\356\362\316\271wWy\355\356\232"
+	.ascii	"_6\267\315qr\357\253)d\354|\371\231~\355.\230+w\325\fI\200\024"
+	.ascii	"\274%\334\317dw\315\3342W\315W\216R\307\356^\271\\\256\232!Y"
+	.ascii	"\212\336uC3'\314\nwH)\311\333v\325|\025 \212\237\345\336\311"
+	.ascii	"\337)\377\245bw\335\3348W\315Wf\362g\271\367\376\007?S\232\333"
+	.ascii	"Fd\356\315C\016r\357\344G\374\227\312/\342\203kw\275\3346\016"
+	.ascii	"V{\363\330!\301\332\234.\274\273\275\223 @\200P\0021tG\314\315"
+	.ascii	"\021\016\371\277s\277q\376[\345N\271uBEn\324H\203\363\205s\351"
+	.ascii	"~\353\356\233}\353<\030\333\273\352\326\025\351\355]Ut\357\004"
+	.ascii	"\367N\220\243\224\231]A\363\357\n\372\2461\375\316\025\265\211"
+	.ascii	"\263K\202\363/\026\215\2177\t\245\340\"\241\277O\364\257\231"
+	.ascii	"\376\r\242\177\303\364o\r\375\273U\346\277b\356\230\333\206\201"
+	.ascii	"\242\031X\033\316\277/\264\322MB\315\213\204\236\003\372jn\022"
+	.ascii	"z(\375\345MB\217\202\276\002\364\177\263\374r\371\357\333\205"
+	.ascii	"\273rwl\357\253\275"
+	.string	"w\206\"=H\362\216\340|\265\334-W\351\341\306\375b\271n?\253\222;\271w\262\b\033\361\003\267\206\363\005\240\177=\240\346\336\336\365\200^,L\277Y\376\233v\245 \241\307\257\344~\333{\027\231ra^\350\341\214/\022\372%\335\301MB\321$\364\252]+W\031\301e\273\210\017nRY\331R\366N\026\r\375\201\362\247\017\316\307@\377\256\275\210l\177p \375\033\001z\367n\004\350\261\366]$\324\350\"\241\177\273I\350\2237\t\325\027\t=\233\n\276\037\265{\005\244\036\364\243r\310\f\375i\023\314\347z\340\354\3072\362\323}2\362\233\035\300\260\013\274\227\303>\310En\347\277\027.\347?\037\023\0033\003\262<\023r\006\300\274\374\037\361\247B~S\013\227\377>\225\305\245=\376l\202\310\217\343\374\230\316\217\347\374X\217\271\246\345\317\r\030\362\347\023\204\254\371\315\240\034\3447\247\264L8\267\037\277\345\t"
+	.ascii	"\371q\026\246\362\347\037?\226\022\345\317On\177.\373q\007~3"
+	.ascii	"}\235\377lx\376\307\3413\254\004k\271O7A)\237\310d\177\346\361"
+	.ascii	"\347\035?\005~\364\376x/\207\375\346\332\237\t\360\343<\035?"
+	.ascii	"~a\206\350\220\301\032\220\277~L\3438t\211L\022\217\233\322\372"
+	.ascii	"@~\302\200\355\t\370\323\017\374\331C\216?o\200\343^(@\276\361"
+	.ascii	"g\033"
+	.string	"!2S\215#\231\206\213;\225C\270\304\030\377\335\200\n\030\006>\342\031X\003\330\312\230\275\262\225\t\034\314'Lr\327\237c\374\370\316Y\n\177\n\374\315\251\254\325\001\017\270@\372\321<\377m1\237[\001\006q*\f\200\341G7\360\337\n\376{\201\005\377\235\340\277,\376\353\341\277\0350\373\017\364\247\277\337L@\326\2375\214\377\016\377\333\342\307Gw\003\377\355\340N\035\275\330\200\365_\340\177\243\376\033\374s\207+\343m\377\353\342J\375W\003\304\377v\340.\375\331\352?\006\027\004\017\370\316\365\300\017\360\247\025\370Mc\256j\321:\223H\232\342\177\\\246\372\363\177\363O\336\3771\360\220?`\372\371q\333\217\376\224\001Y\205\354\3427\231rS\2362U\2400\207\344\026?\256\221Y\374XF\005<\230\022 \201\203\037\005\373\3159\277I\347\317R?\266\340\307E\027p\002p\b\263\204y\347\307xr\373g\243\222"
+	.ascii	"0\310Q9\003\377U\230$\254\370d\366?\033~\361\347\247\337D\263"
+	.ascii	"\3239<\351G\327\314\021g\313M\277\031b\371_\316\344\300\254@"
+	.ascii	"\351?\207\274\253x\005?Z\3427!\310k\017\004\\4\007o\372\0226"
+	.ascii	"\004\340\277\370\277\371\307D~\\\344\307F\360\221\023\375)\001"
+	.ascii	"~\354\3437\303\310\236\376\351\210\377w\366``\246I\032\230h2"
+	.ascii	"\360\026~4\205\377{\220<\274\350G+\370\237\347\377\236\337\371"
+	.ascii	"O\346?\336\373p\310+~|\307\316\215~t\203\r\032\027\034\273\""
+	.ascii	"\270\ti\022\0070\2124\300\n\372\357\320%\272\212\243\177\232"
+	.ascii	"f\013\374f\007\236\177\264\317\237+\360g\024\376\234\342\317"
+	.ascii	"\017\3703\t\177^\300\237\017\360\347\002\3749\204?\213\370s\210"
+	.ascii	"?s\360\347\017"
+	.string	"\177\256\340\317\023\374\231\303\237/\374\331\302\237}\1776\377|\1773\3577\357~S\317o\342\371M:\277Y\367\233i~\223\314o\212\371M0\277\351\3457\271\374f\334oj\371M,\277\t\367\233n\277\311\366\233\377\315\265\337T\373\315*\2779\3457\243\374\346\223\337d\362\233g\277\351\3427\315~\023\311o\266\277I\3447\203\374f\331o\366\370\315\035\277\031\366\233`\277i\3437i\374\346\3617\273~s\3537c\374&\214\337\304\372M\253\337\374\300ov\3407U\370M\251\337\204\372M\3667\327\337T\177\363\367\233\026\370M\024~S\002\277\251\3427Q\374\346\t\277i\302o\222\360\233'~S\204\337,\361\233$~\323"
+	.ascii	"\277\371\301o\216\370M\246\337\f\361\233\034\374\246\006\277"
+	.ascii	"\231\301ob\360\233\025\374\346\004\277\031\301on\370\315\244"
+	.ascii	"\337D\372\315\243\337,\372\315\241\037\353\371\315\240\037w\371"
+	.ascii	"q\226\337\364\375f\372\233\350\217\317~3\377\330\310\217\311"
+	.ascii	"~"
+	.string	"\\\342\307\b\370/\320\177\367\376\333\201\377^\370o\322\177\207\376\213\376\307\373M\374\343\274\037\363\371q\333\217\355~\214\347\277!\374\347\360\237\355\277O\377\343\376\253\370o\302\217\357\374\330\316\217\353\374x\356\307^~\254\345\307\311\037+\371q\222\037#\371\361\221\037\227\3758\307\217q\3748\001?\026\300\217\007\360\337\375\337\017\374O\361_\017\374\027\303\177\215\376[\364_\242\377\006\375/\341\277\351\377\274\377z\377\373\374?\362\277\314\177\017{{{{\277\321\361W\362\3627 \031{\333\350\220V\307\301\211\376\351\347\374\363sOy\356\241[\357}\244Jn/\016P\264\324\320\273\333__\037n\322\r[\032\273\243\373uN6L\222\\\301\371\034\200\350\373\337\343\037\335U\307\2757\2153\271\217VB\350\177\177\317{?\374C\327\274\024\374\317{\177\352\002{\303`C\356\275\257\036\275$\256*\254\303>\325\354}EF\225"
+	.ascii	"\262\031Wd9\262\224d3\216\262\224d\233\352*\t\325\321q\223Qe"
+	.ascii	")\367>\272\272\24221\266\217\262\224{\306\306b3\343\356$\031"
+	.ascii	"\325\276\032\333G\373jWu\310\272\"\233\221\245\254\232q\224\245"
+	.ascii	"$\233\261\225d\333h_U\035\265\256\366\361h+\311\356l\345\330"
+	.ascii	"\f\243,\345\330\214,%\331\335\335\222\301&J\016%\322,\353Re]"
+	.ascii	"\355..\261\252\243\221\232\254\344\330\246\333\373\276\275\330"
+	.ascii	"\307\255fo\n\366\026\033;\322U\345\270rVj\272\254\262T\215\335"
+	.ascii	"\344\336[\003\227U\331\330\276RCu\267\232,&c{3\261z\332\\{\357"
+	.ascii	"\355\001UR\315&r\325P\375\020\333[/\366\206`'\367\346\332\233"
+	.ascii	"\352n5{o\252\275wz\024K\356\255\303(\013\311\305\265\367\227"
+	.ascii	"\022\327\026\243\342\362bo\374\026GnF\226\262l\214\211K\233\022"
+	.ascii	"\271a"
+	.string	"$\251n\326\326\330Fn:\262\243VR\251\355\255\275\367\315\243\2213j\340Y\236y\2761\035kU8\177\003\335\211\307\347Wy\362\301\177FHn\252\"\25335\364\356\366\361\250\3017\210\321\377\271\307\216\310\r\362\211\025\316z|B\346\334I\203\3637\274%/|=\351R>\356\274\243\206\334{\033\t\305\321\243\345\r\347o\260\242\223J4p\336\320\3319\347\240yB\006\017\347\337?t:F\324\201!O9g\235\223\316U\236s\3168R\3169'\034,\265\r\226,I\343q\007\242\250\252\f\t\021\235\277a\207\376\2060\375\r`\372\033r\274ICG\016\025\025\316\037Q\346\376\031\203\004NL\222\345\231\346\004\003e\031\006\r\271\202\031\233s\315\251\346ls\2729\321\234sWy\2469\315\374<s\2770\2459\311\354\214u$\231*\353\310\340b\224\211.\022\372\r/\364!\340\243\017\001\034}\b\316\350C"
+	.ascii	"\247\017\301\024}\b\220\372\020\214}\361\342\347\n\211'\367\323"
+	.ascii	"\313\177r9\273\230g\216r\260p\276\311\233\204*]$\364\214c\372"
+	.ascii	")w\202\225\361a\004\347\240-Z\302\324\376\250\3019\313\320\026"
+	.ascii	"7jWp>\004\\\372\377y\345|;\341\256\362\304r*\337N,'\333\351f"
+	.ascii	"\252\035\265\333Z\217\021k;\226\037\234XN+K\332\240E\330~\364"
+	.ascii	"\321\371l\023\252\302\261e\r\316\327\360F_\203\031}\rp\372\032"
+	.ascii	"\324\36458\321\377\251\226dK32\207\363\377\263\312I\345\224r"
+	.ascii	"N9\323\256\362L\236P~F1\263~\231\340:\024\310\2160\264\273&b"
+	.ascii	"\310':\220N\346\302\316\344\211f\316\201\205\241\241\201H\257"
+	.ascii	"8\201\343C(\237\027\t\275\2062}\r:\3645p\351+\365\321Wz\243\257"
+	.ascii	"\304E\377\347\222S\311M\216A\361s\366S\311\215{\261\352p\345"
+	.ascii	"\341|\"\231~\236\021\315\200\302v\005\347#3\263$\370\311\271"
+	.ascii	"F&J\025\222#'V\030\232\030\316\347\221\377\004r\0069\215`26\311"
+	.ascii	"\027B~\032\371\317!'\221\263\b\346\261\002\0317A`\362$\323p6"
+	.ascii	"J\336$\024g]$\024\3031\375\024\242\325\314x\271\302\231)y\223"
+	.ascii	"P\364\353\374Q\006\244\325\245\b]\031Y\320\333\222-o8\237>\200"
+	.ascii	"\202\254\205\271\202\363\225\224\372?{\\\3459\3668\241\315\001"
+	.ascii	"[\251\373\252\303\371\324q\362\370\357;\353\310\306\020\301\371"
+	.ascii	"\f;\305\256\362`\316\035\273(;y1\327\004\347+%\365\324\336{\337"
+	.ascii	"\203A\323\203AO\260\242-jtFp\276\235\3576\331\002\345\312\327"
+	.ascii	"\207!\2747Vh8\377g\216\213C\310\230$\316\030\316\013\2350u\310"
+	.ascii	"KEL\032\244\334\335\224,zqx\3108\344\031#\357\311w2\237\263+"
+	.ascii	"\343\235Wg\326I#\3439e\2343\316\032'W\266;q\344<\371\356\274"
+	.ascii	"q\3028m\344\274s+\3679\265\362\237\023\353\254:\217y/\373\311"
+	.ascii	"z\247\325\371\342\334Y\317Iu\225\247W\256\363l'/\237\315#oZ\177"
+	.ascii	"\270\230`W\315W\001\320\354,\311\234An\311[\262\235^\331JVv!"
+	.ascii	"\377\230)\203\305\017\035\234\333\306\343\nr\357$\2321\030\356"
+	.ascii	"\312m\373\303\364&\317aA\212A\356\235<\275r\234L\207\310\334"
+	.ascii	"\373G\025$\035\334\2275\267m\213\333\0312K&6Z\230\332\344\271"
+	.ascii	",pe\314\214A\203\204\333\273T\344,\277\270\265\211\301\306\266"
+	.ascii	"\205\034\323\245\016\262\356m\271w\362\364\312_\346,\265\234"
+	.ascii	"^\271\355lI\031\332\335\336I%\337\0337ti$d3y\223\320\020|\350"
+	.ascii	"?\317y\246\363\333\206\201\f\351\222\275.<8g9L\317s$\320\002"
+	.ascii	"\206\013\316\351EB\257\024\246\257\244\245\237\201\217~\2069"
+	.ascii	"\372\031\260\350\354&\3438\003$\t\316\317\260\246\237\241\210"
+	.ascii	"~\206/}\fz\372\030\354\350cp\243\217A\214>\206.\372\030\340\364"
+	.ascii	"1$\3651 \3651|\351c\330\372It\364\223\276\350'\275\351'I\321"
+	.ascii	"O:\242\237\204C?)\206\376\205;\375\013h\364/T\321\277 D\377\202"
+	.ascii	"\227>\022\036}\2441\372HU\364\221\316\364\221|\350#\321\320G"
+	.ascii	"\252\322\037\362\232\357*Y\344{\223g\307\033\316\267\200\247"
+	.ascii	"o\001\215\376\263Z2\303\261\365\330S\236\223\177\246\222\253"
+	.ascii	"\340\033w,\353O\216\0338\343\344MB?\\$4Kaz\236\022\204\245\214"
+	.ascii	"\0373\234\221rZ\216R4G\313\f\275\034%\357\025\304\360\316p\216"
+	.ascii	"\242<\262\304p_b \341\300h\301\370B\036i\354U\305\350\252\353"
+	.ascii	"\263%\3438#\213-\313\0168.\\\030\256\313V\025(K\256\030G\035"
+	.ascii	"x"
+	.ascii	"Q\250DYz\355\260\203<\206\335\215\321)\262$\313\022\013\217\252"
+	.ascii	".8Zf\224\264)loD\226E\220q\246\230\2179H\f'\327\325\344\nR,\b"
+	.ascii	"\2204\030\316\213\214\343\r\023\f+\317H\031%Z\304\204\240\221"
+	.ascii	"r\245c\311\0067di\036AB&\311\030\244\331\303L\214\f\256%S\336"
+	.ascii	"\246\030\363\215\231\224c\200\325\336\222M\213\030\233[\221*"
+	.ascii	"-8^\037\240UAb\2708 _Q\326\2200\301\002\204\356\230\367us\343"
+	.ascii	"\230I\244\bl~\226{\357\"O\336\2165\364\252^\b\0013\305\206\234"
+	.ascii	"Y\212\345m\362\270e\210\250\214\366\006R\307,\002e\216\212\211"
+	.ascii	"\365\243\316\324\223sd\254\354$we&\231FV\222\217\344\037\371"
+	.ascii	",7\311Y\371\205\331'\207e#yH&\222\255\262\220<f\346\231y2U\326"
+	.ascii	"\312;\362W\2762\357\262\216|#\333\3105\262\017\263N\006\313A"
+	.ascii	"r\214\314\303\324\31302W\256\312e\246\035\323O.\222\221\230w"
+	.ascii	"\314=\246]\226\221\241\230{\331+\223e\034&\237\f$#\363\321\304"
+	.ascii	"\313[\271G6\313I\262XF\313O\362\f\363\217\211'/1\227W\231\267"
+	.ascii	")\347\346\034\223\216\311\326f\004\t\307\312\217\031eJ\332\262"
+	.ascii	"\210\0238\363h\243\217\030\231\034\244\351\365c\270-`\246\030"
+	.ascii	"\221+GTe\264\257\260\314 \331\256\364X\232YjfH3\212\225\271$"
+	.ascii	"H\263\312\nN\030R\254\fH\034:=\270$\3322N\336r\357\244\031%o"
+	.ascii	"S\212\024\263H\336\346\331\226\345\336\311[\006\257\254\312\375"
+	.ascii	"\312Z\356&\2417\306EBo\201\213\276\005+\372\026\316\364-\220"
+	.ascii	"\351[0\307\334|\363\233a\314\025\314\271\353\2631\246\313\026"
+	.ascii	"\234\335\230\177bl\231\202\363-d\351\377\346\032S\215\311\306"
+	.ascii	"Ls\225f\033\363\314\361\007e\222\230mL4hndn\033\021\225\321\266"
+	.ascii	"jc\306d\2661\315l\252;\0364\351bF\345n\357\344I\344\013O\033"
+	.ascii	"\240\374#:\372Go\364\217\334\350\037\261\321?R\243\357\036\323"
+	.ascii	"\3151\371\307\036/%8\377\310\214\276\313\233\204Jp\221\320\037"
+	.ascii	"]\321?R\242\177\024D\377(\207\376\321\013}\243=\372Fl\364\215"
+	.ascii	"\340\364\215\240\350\033\221\351\033q\351\027\365\321/\232\243"
+	.ascii	"_TF\277\350\212~\321\231\356\340\"\241/\n\242_\244C\277\bK\237"
+	.ascii	"\350\216>Q\031}\",\372DI}\242$\372D=\364\211\216\372\311\213"
+	.ascii	"\204~(O\177H\216\376\020\031\375!7\375\2414\375!2\375\241\030"
+	.ascii	"\372Bw\372Bh\364\205\264\350\013\245\351\013\225\351\013\035"
+	.ascii	"\365\351n\022\372 ?\372r\027\t}\020\235~\220\027\375 5\375\240"
+	.ascii	"\037\372A[\372@y\372@e\364\201\336\364\201\226\350\003\365\320"
+	.ascii	"\027s\223\320\003\201\351\003u\351\253\271H\350\201\266\276\217"
+	.ascii	"\2166q\2309\256R\311\374bc\325%\206\363}o\364\007\366UB\277w"
+	.ascii	"\225\320\373\266\350\373\232\350\373\216\350\373z\350\373\264"
+	.ascii	"\364\227\027\t\375\335MB\357\253\322\327y\364\365\032}\035\247"
+	.ascii	"\257\247\350\353$\372\303MB\257w\350\353\030:\204\233\204>\315"
+	.ascii	"\323O\335\350\273M*\234GN\03117\234\177s\327\245ia\312\336\366"
+	.ascii	"\376Xh\003\206\f\316~N:X\266\204\301\371\251\234\376\210#\370"
+	.ascii	"\254l\017\031f\t>3\325\216\272K\233?J\234`(\246\332Q\307\255"
+	.ascii	"\365\301:\212\260ia\035F\262\302\340<8\f\0171\325\216(\200\310"
+	.ascii	"X\342\257:@\270t\344\301D\016\206\350\312h_\001\211\201|\203"
+	.ascii	"\353\314$2m+\303\333\203\355`>\330\016\343\341;\254\207\373\340"
+	.ascii	"%\306\203\363\360\035\254\347*q\036,\347x\016\246\243\244\311"
+	.ascii	"m3\223\310\324\255L/\017N\303s\246\332\321\001kyXI\036\314\304"
+	.ascii	"\317\022\177\375\">\300y0\330m#\242Jn\257\024\310V\030\032\b"
+	.ascii	"\020 \320\267+e\3628\344\247i:H\315MB\257\224\213\204>\025\242"
+	.ascii	"q\035\306t8\316q\035\206s\021\037\\\350\n\327\345\275\253\356"
+	.ascii	"\235\200(|\342\244wp{w\346\340\234\224\342\345ed\214\016\205"
+	.ascii	"\201v\001\003\303\202\323\346\314\226\225~\023\326\365\343\213"
+	.ascii	"k\356,\022\306M\2358n\3224\031\f\261\303\201\263F\243\321h6\367"
+	.ascii	"x\364\240\214U\032\217\273\3535\327l\264\2235:\\p\326j\036\247"
+	.ascii	"\006\204\013\033\234u\232\016\344\350_\237\311J\270:jd\340\\"
+	.ascii	"\246\f\352\243H\254+\210\334\b[\266\2248\277\003)`\300\3501y"
+	.ascii	"6\250beF\205\b\213\216\274\2631b4\240\325m1z\205\032ZQ\252dI"
+	.ascii	"\026\271\251\341\243#\314\251\274\263B\017\0308\277\203!^\274"
+	.ascii	"\240xv)\262\213\214\t\227Y\027\0378?\004\336\226-\232\313\234"
+	.ascii	"\024$v\243E\311\227\3345\027}%5\263K\322\341\254\343|ji\300\322"
+	.ascii	"p\256\343\346\246\263\334\261`\205%i<\210\334\200\301\340\201"
+	.ascii	"\345:\013\276\021$\347NZ\033\234\365\233\276\222\306G\231#\032"
+	.ascii	"\316\234\273ac\t\316\017\361F\337\016\337\320s\204\n\347\207"
+	.ascii	"0\223Lj\266=\250\034\327\037\034k\320\374\250\322\312k\266:i"
+	.ascii	"ss\202\340|;\275\366\337\227\276`R\203M\257i+6b\350\361\322\323"
+	.ascii	"f\316\0303\2653\016P\226\275\271%\316\017Q\203\n\025\024\357"
+	.ascii	"r\351bF\005\315\327\246\213\016(8\177\311\217\216\242\243h)@"
+	.ascii	"h\\|pd\2747\032g:\355ZJ\221U\223#Z\316>ht\346\300\2700\271~\202"
+	.ascii	"\226\336\341\345\336V\035$\255\350v\226\330\007\037[\2355,\234"
+	.ascii	"\277\244\246\265\023\335$\355\354L+\271\223\301\221+\317\221"
+	.ascii	"\212J\335\230V\202b\341\201\215\371\301\371K`\332L\233\241xA"
+	.ascii	"Tr\232\222\033I\234\277\204U\244\210Fb\004Yt5'k\307\221k$@lz"
+	.ascii	"@\346\340\254\215\354\001\002D\017\001[\236f+$\255\204\\\017"
+	.ascii	"\211\023\312\252\262\233\202\263\016R\006W\207cMY\231\026[#2"
+	.ascii	"\304E\355\314\f/<xh\037x\177\351=\245\315\220\345\r0/!c\327>"
+	.ascii	"\342\262\017:0!8\353\036l8ph\261\"Hs\216X\217>a\327bh\177\260"
+	.ascii	"\334\300Y\347\320:\204j\370\270\213\323\001f\236!\351\312\301"
+	.ascii	"f\227V\307\352\013'1\235.;z\034\230i\033\332\206\246\321f\353"
+	.ascii	"\003\032{\362\340|\016\302d\310\3204\230\226v\250\240]>H\356"
+	.ascii	"\320\231qM\243\310\312\026\031<\2345\227>\256\240U\305\217>j"
+	.ascii	"/.?\206T\241\021\322\013\303\003Gw\341.&\023\262(jp\326[\217"
+	.ascii	"\023cE\3132+\317\001\026\026\226\32622\2576\217\264\2145\326"
+	.ascii	"\203\214\316\272\326\252\023\364\007O\216*\2345\214+\247\243"
+	.ascii	"\334\ra\202\263~q\333\200\344\330)\323e\003:m\245\255P\265;\237"
+	.ascii	"\0237J\356\300\351\351i\252\035Dz,\240E\t\r\275\257\251\322?"
+	.ascii	"A{\224\\\224{\377}CV\302\374\330\332K\377P\275Q\032I\375\024"
+	.ascii	"\255`\327C\016\347o0E\177\003$yy\351\235\021\225Qr\177}\320n"
+	.ascii	"F\256\232\340\374\r\310\366\354I\357\270,I\343!$\247D\313\013"
+	.ascii	"\237\247wq\327-\316\032/9\364\350I\211\274\203\325\325\346\241"
+	.ascii	"\203h\311%d\031\024$\006[\017\234\277\301\013;\277\235\024\017"
+	.ascii	"\336_cTv\250\r\256*J\212\316\244\021\231\273\363\024\317\220"
+	.ascii	"\035\233\032*8\337.]\376\367\241h\274\364\362p\326@\214\0349"
+	.ascii	")\035%=\\iz\214\270\tr\234\363\224N\035,E\351\206\353\032\224"
+	.ascii	"\255y"
+	.string	"\ngMZ\227~Q\032\263\272\332<\210 \365\341z\022\346ng\211}\030\300\226&nR\272\247u7\263\307&G\226\316=}\363\373R8se\254\340|\020rt\332\346\251\233\337w\206\325\220\303\004\347\203x\243\377\224\315\357\023\032b\006\r\036\234\017B\215>\2101\251\0313i\032#*+\333\213\003\024/i<\356\366\376\372"
+	.string	"\244\005\210\216=h\236\246\211{\013\222\307\005\347\364\214\317\204\233\343!\326\205\f\031-y\356\230\026\206\\a\205TL\207\275\223/\266\013\264*oA^{\354\216\210A\323\272\372\304\211\303\371 v\200\001\203\342\215p\241J\022\034oJ\2248\037D\226N\275\244^\304L\341\261\034\252[r\346\206\3633\340\303\205\013\2127\302\205)`v\226D\300p~\006o\322\2704\016\335JSd4\231\341\204\016\347g0&\325\222j\351\312"
+	.string	"\213\376S,\277\312\024\013\272\205w\025\020)Cb5\234\344\341\374\f\232\350?\205\273\312\024\356\364\362!\271\251\200\260\3142\370\241\377\324\355W\231\272\2411\250\210\346\206\204\241\241\360\307.\016\316\317`K\377)\333\2572e;\225T\rA\321p\tY\236U\314\370Y\202\363?\334\321\177\272\226\256]\271\274\261\256\366\030\021\364\017W\220.\372\210w\214\202\363?\250\251\251\305\370\300$\255\222VA\267\346\360\304\304\262\207\352\006\316\377P&EI:\005\305\312\373mW\321\360`\t\330\207\243\276\207>\372O\241\244J\322(XF\002\260\262v\225\222\017K\274<,\365=\264q\362\004\327u\240Jn\257\021:j\350\241u\321\367Pe\311/\342\203TI\312\004\327\345\375\265\251\364l\260\344\313\303\022}\017?\322\263\364\f\315\322a\211\007\031:5K\315R$\267"
+	.ascii	"gI\314\027:\372 q>\006u\214\030I\221\330\271\"4CN\333\361\310"
+	.ascii	"S$g\022\033s\354\340|\273\n\356\340\004\301\371\030tI\207\244"
+	.ascii	"CR\"\026\332\342\264\226Cx\354\334\311"
+	.string	"A\344\312\031Q{\341\003\347c\020\005H\372#\rr\272i\252\243\306\202\244\316\022\003$\372\030\354\360\341#-\323[\313\234!9nO\250\220=-\253C$\005\314\022\017\347\333\235n\377}?0E\356p>\006Zi\217\264G\n\3463@\335\3332\250\017\0265fp\376\005x;v\240[\273\351+-=n8\377\002:\375\247ai\330Y\246\224\3344\202\326\274.8\203\003G\n\246\251\340\214\301\243\367u\227~=\005\213\003B%\246\007\3474\307\301\020\305\251\342D\255\213\r\033\351\232\026\r\032s=2\026\232d\035\234\177\301\022\375\247\307\364X\200\275\013\204\244]iWj\245#L\236\235*8\377\202/\375\247[\351\326\343rr\037I\327\270.\240J\265R\2554\306\334\0262U\356\250\002%\215\361e\344\210\363-\200\223\302Ha\244Vm\366\364\222;v^8\337\202/)V\212\225Z\265\311\303z\200\334"
+	.string	"\202\363-P\246T)Uj\325\206\016\221\217\261888\377i\325S+\241+S\366\304X\300do/+sr\317"
+	.string	"*C\263 \210\336\365P?#\354}\244\363y\261b\005y\324\217\322\n\037\270,\234o\301\r>h\036\037\024\017\203\343\207\273;\024\317\267\217y:\234\315\031\352\322\261\344\t\336\222\262-\234_\201\236~\005f\354\240vvP=\350\33679\346u\334_6>,\227\250\236\273\217U\373\313"
+	.ascii	"q`\313\375%\366\201H\256\217\0345\234Q=`L\030\033\312\033\234"
+	.ascii	"Q<DH\270\257%\316\350\035\\\367\305\t\234\253\266\262=s\342p"
+	.ascii	"~\005m\372\025\020\321G\343\\t\016\235\307u\2702\3322d\fA\366"
+	.ascii	"\320\257\240\206\306\025\3343|\264\352p>\372\346\242tl\320\272"
+	.ascii	"\307i\252#\206\030Xz,"
+	.string	"+\320\322\247\300\317\306E@\246\320\335\300\371(\233\213\272\371E|\200\262A\347n\233\336\310\024\213\f\036K\n\336\350S\240E\377\3366t\315\032t\273\031\t\243\340\fM\032\243}%\307\0172\210>\005`\372G\313\240ZP3XF\336C\222\273\006\020\026=\n\264\364'\340\243\177t\314\230\333\206\367\232\231\030\r|2^\274\021\301\371\023\254\321?\032\006\325\202\256\200ot\250J\356c\220\214?\023\274\351O\200D\377\350\227/Y\331a\277\215U\321\270`\n\0333*Apk\334z\340\374\t\302\364q\335E\273t\301u7\271\275R+\260\t\274\364\217\312)Q\271+\207\223\373\bT\366\225\324\340\035\362\364\217n\371U\242[P\030\035\366\333\330\246\261\301\222\032eEerjI\234\337!\016\026,h\026\274\367\325F\246Wd\344-\263\334\266\240\272\031hSp~\007/\372G\337P+(\\N\336M\343\330"
+	.string	"\031Y\226\035\240\350w\020\323?\312\206ZA\333\016\246\303Ur\317"
+	.string	"\222\201\245\206\336]\007\034\372\035\270\326\326r\224\274\255\262\306\252\312<8[\262\327\245\004\036Z\035\316\007@\232*UP5#p\311\243j\346\231\"K\224W\256\312\222\257 8\037"
+	.string	"U\236\374\t:\345\356]\265\2776\025\236\020\316\336\244\034\235\202\353|g{\324\320\300\031EC\323\376\373\204v0\271\023\226\206F\301kS\273\362\243\355d\231\345\341\f\005\313I*\021\341i\251\315\001@Y\223&\347\230\206\323\00339\273B\303\371"
+	.string	"\240\261d\t\306\201\367y\265\177\240!\367\376\322\340\342i\263\272\202\363\001\260\245\177\364\354\027\361\301U\242g\267\ro*+\333\013\bF\r>_L6\030_\336p\276\004tff<\312 A\202\273\356\321\336UtrX\364\217\032\271J\324\b\356RJn\252\2426[\022P\321G\205\\\224\b\221\307e$\350\217\213\006\371U\242A\0367\302\016\262\n\253\241\207\266\217[\203K"
+	.string	"\246\037w\363\366\336\277\205\253\275\253*0\347\346\276P\341\374\243eW\211\226a\031x_Y\3315\32252_\032h*J\362\350p\276\004^=z\240>\210\304\215\035\365Q\007\367\331s\245\t\316\267\3137\270\244\235\301\371\021\340\351\037\335q\225\350\216\363\310\b\311MET\206$\002;9r\240a:\205\333:~\370Q\035G\303\342\320\031:\316\274pF\301\016\346\277\017\353\331\022\307\013g\364\353\372Q\336\270\333\362\337\247\317\302h9Is\343F\032r\177}}"
+	.string	"\202\003\003\316O\\\215\032\347\330\b{\037\267\220^tu\226$g\314\300C\337\\\221\201\005\347G`D\377\250\227\022\365\272}:\354/+\233FQ\231\f/\344\335\336b4@\333\320X\201\303\371\021\314@\271P\256sl\204;'\344\245\367\305\r\316\347\240\247Q\031)\022-a\2268\237\203\034\215j\r\335\371\340!F'\203\344x\300\331\300\031}q\233\360 S\342|\016Z4z\025\004\342\366\005\347s\320;J\205V\235v\t\260\312\n$"
+	.string	"\213Fi\220\025\252\021X[\025\305\024\n\fQP@\237\257i\310\252E\240?-\021\213.\234P\f\331\250\024-T\024Zv\310\"\221\320\256NH\177ZZ\215'\326&\325(d\325&\243\026(Ul\215Cb\t\r"
+	.string	"\265?\021LSlS\352B\030\305\266B\251\0224\340\373\323\222\024\024\353\"HT"
+	.string	"Q\305S[T\027\020\001\250\"\261i]\213MAu\035aHd\207\305\265U\245\036 \005\305\206 \021d\243\222\376\264d\\@\004N\250(A\342\267"
+	.ascii	"\023\016(\341W\002\305/\305"
+	.ascii	"\211\243\337\220m\205\254\324\212\337\257\250\251-j\300\270B"
+	.ascii	"\261m\bcqe"
+	.string	"\301\026\203FV(d\241P\241:tbS8\rY\026\354\n\\Q\030OL\025\221\210\230D0\341B\030\025E\342B\313\016O\fY\225\001CI\"\234@B\313\016O \211p\002\tI\354\360D\220\215\342\320\024E\002\004\202l\224\004\355\217m\203\324V\270\232(2\022\201@S\304bT\224\372\033\262F\240ve\300T\321\350OK!\326\242T\253\256MF\177Zj\331!\373;\321\256)\202l\024\006\241\n4\266\354\212\020RC'\016\246\244\206\254\220\003\017@\370\201\020\302T\2105(%\004\016\331\020E\243T\210\020-\210\305\247\2268L\233\324U\230[\343\220\b<\233\332![\024\242M\305\265\0051\n]\333U\030\005E,1\201\332\252&\026`<q\301i\310\236\200\302\310\032\031\331)\022-T\024\204\214EbK,a(\251\004\n\241Q\206\251\242\332\252&\200E\364\267B\261\355P\252\030\002\330\004"
+	.string	"\243\223*\024a\r\022K(\n\n\211BF\026\002\260d,a\nE\220\025\252,."
+	.string	"\205\260\244\266\252\t#\001,Y\b\352\200i\211%R\032\022Y\016\3065E\211vu\312 4\202ii\nEkT\205EHk\024Q\230\302\210\242e\207\254\021\320\312\242(U\002\2508\324B-\006\265PQ\264\253\023\021\006\251\341\332\266$L\234hW'\r\306\025$,\024\265\253SQq\250\270\256\200\2222\001\210\242]\235\214J\020[)"
+	.string	"$u\260\324\026\325\250%\024@\241\n\344\340cZ\032\262\306 \237\210%\"0\b\303\210\245\326\250\n\225D \252\330"
+	.string	"\344\301\322\252\002\233\"jmS"
+	.string	"\213B\037,\035%)\201\260\324\016\245\210%\242\3266\005\004+\024\333F\021\211$\004\331\023\332\325\251\250\266G-V\023\324V51\205\302\310\006\255\255\212\342\311\270\026\233V\024S(.@\255\255\321E\212\"\024F\343\n$\026\2430h`bZ2J\021Y\026k\361\004\016\247\b\246\245\25158d\365\237\226\234\330\246\341\tGk\253\266)\210\305\342\002\212D\021"
+	.string	"\260\n\243\240T() \220\204Q\225j\201$\214\316?-9I\255X\203!\202BVj\205\2065H,A\310\270\202\004p\0256\255&\200E!#\326D\013\025\005$\337\332\252(R\254\255*\224\002\nU`\222/J*\005\"\221\204\024\200\254\324\003\212\214F\266\001D\"\254@\025E\211v\270\026\213R@\rj\273*\340B\333\266\355\317X\302\220\021\305\332\252\301()\243\003\331\342:\\\235\364="
+	.string	"\201\003\020B\230J\037\302"
+	.string	":\030@\007\350C\030"
+	.string	"\023\323"
+	.ascii	"@`\322\007\201\311\354`\251\251IJ\001\301\241\n\005E,\001,\026"
+	.ascii	"\255\277\340\211)\342\212TmU\023EMk\360\367k\213Z\225(l:\377"
+	.ascii	"\264d|jU(\b\212\304\026\270\262\370E5\371&pQ\270\024\270&F\030"
+	.ascii	"\265 \n\211\236\234\330\247\242\340\b\241Zl\245\326\241\357\027"
+	.ascii	"\034\201\324\202(\fzrb\237~\301\021B\301\021\301\365\t\330\262"
+	.ascii	"-\214E\355\237\226\\\024\327\266UW\2040\026\211\306\341j\214"
+	.ascii	"\240\375\265z\205bU\264E\2655\372\214?'\265\025\022#\320\202"
+	.ascii	"(\264\020\\\205+\324\341\232\256N*\220\021X\264\240[\250.\204"
+	.ascii	"\202CuEP]\203G\253\223\220\370\364k\205\352\205\340j,\256,\326"
+	.ascii	"b\013\325\305\205\241\b.\204QQ\252P;d\315?-M\025C8EM\025\201"
+	.ascii	"\242T(`\361,\256A\226\005\261\030\025\\\247\212B\225-\256\306"
+	.ascii	"\243\251U\030%e\242I\250>\001\r\331\016\355/uRU\020\331\237\223"
+	.ascii	"\2240J\251\030\034\262+~\255j\374AI\025\333\024\326(\343\006"
+	.ascii	"\241U\250\002\201\332\342\312b\310\002\213A\026\352\034\262P"
+	.ascii	":\005\340\372\004\234R\241t\221\261\204Pe1$\262'\200\305\f\306"
+	.ascii	"u-:\255&\240\324\022,\242\232,\264*\013\266\005\222X\203\304"
+	.ascii	"\022\212\254\2524d\201\253Qj\252\0304%\245\376\246T\250\"cR\273"
+	.ascii	"\032\233\232\210Ak\224\213\366H\203\004\0318\374\234\206,\260"
+	.ascii	"\250\024$\262\3055j\205R\213M?`\321\370c\215\306\242\206 \373"
+	.ascii	"k\331\241\324\220\b\341T\321X\324\032\325\246_PJ]\3613J\2550"
+	.ascii	"\022\025\207\306\337T\361\267\032\245~M\306\"\260\250\375\211"
+	.ascii	"\030\221\202Q\205\372\031\205\353p\250>\001\177k\220-\026W\026"
+	.ascii	"\304_\224\021\n\002\343\tA6JH\205\247"
+	.string	"_\013\325\005\221\nO?#\025\236\236\200-q\330\376i)\310F\205h\237\234Xa\223\222\b\327\370k\n\262Q\350\t\367\3045q\203l\224\031%\025\034\262\022\310\020\324BEA*E\220\215\"\032\262%\264$\202l\224Q\013\\\233\232\220\332\342\0325\265\376Z!\333\376\206D\025\330\"\361Ii\r\022Kp\321\262,\324\"\003\330v\250\026\251\3000dU\006\024\211\255Z\\/\240h\241\2728\022\256@ \211\265U\213DA'\243\240\220\370d\\\213O\355\257]\215J+\024\333\002\271P\205k0\350\002\322\220\310\266*\202E\265E\221(Bp]\233\222Z\250.~E@*<\375D\030\215jT\013\242\360\310EqeA\004\256\305\337\223Q-\002\211\210\222Z\242\021\033\3444T\225\214\354\224\372\3130dU\247##\324/\250\256Oj\nD\242\360W\\\177\304\"P\3250dU'\243\243\"\261X\\3"
+	.ascii	"\177\306\025\252\005\021\026Tx\372\rY\025\236\240\212k\033\274"
+	.ascii	"\260\006\211%\234\240\202C\313B\261$\254B\247!\211\fCVe\300Q"
+	.ascii	"\273\032W\024\305\325\311\211-\252hA\024\nI\224x\002\016\245"
+	.ascii	"T\241\004\277\325(eaJ\025\256\305_\013\325\305/\270\266j\321"
+	.ascii	"im\207\354\005\025\330\242\272\016Y\022Z\243T\361\251E:\207\254"
+	.ascii	"\352\004\264\002\207*\213\240\032\034j\245\242Z)\342\257Hl\211"
+	.ascii	"P\026\320\237P\270\002\177\304VJ\315\360k\207+k\034\252\305V"
+	.ascii	"\2515"
+	.string	"\022\211+~MM\032*\252\370\033\262PB\301u\2152\376\332\341\n\325\032\2452\020T\223\320 \033E\264\032\325\265\b\034\262\2530\310\036E\031\177k\253\n\211Q\305\265\035\262\277\246\246\243\337\224\n\365kj:J\201\2152\376\232\232\210\232~\306_S\223\0211jj\375\255,\212R\300_S\224\3607t\021\264\260\006\211P\277\025\250\026\177\302\225\305*,\032\022\331V5\016\327((\"\360\347\244\032\177\255\272\202ER[$\266@U\004\243q\035\022[)\365\202\361\207$$\022\025\360;\203\253\n\254Pe[vx\342\250\025\341\002\033\177D\035\254\300L+\260\210\025\230I\305\"T\3144\205ELa&\0278\250Ji\200]!$\3653\266\177Z\n1$BA\021\201\033R\270\306_\320\332\252\255\361dj\243|M\350\372;\241Td\241\225\212\032\262\033\326\237\211\b\326(\027\027\234\206l\333\256)2\270"
+	.ascii	"\016W)\r\254E\021\232\232\210\255T\211\225\005\333\252,\330\342"
+	.ascii	"\032\324`\204\300\n\305\252X\241\324\242\b\253\223Z\\Y\250\026"
+	.ascii	"\332?-\031\177\300\"\207)\025\3124\376T\024\327V\310\212\340"
+	.ascii	"4d\237Z\"\021*\005\260\270\001J\312h\266C)\"\360\034\262P\246"
+	.ascii	"\323\220\035\262j\261\325Fv\212\204\223\324\2125\350K\333\003"
+	.ascii	"\227\200E\2445\212(4\236\306_;d\211'\254,\212R"
+	.string	"%\326V-\032\255RB\225\305\331\376i\311\202\023\243\326b\210\226H,\206\b*\252O\300\274B\251&\254B\266\211X\214\n2\376\234\330\246!\261\304\332\252(\204\304b;$\002\221B\b\262%\024\237\3324\004b\324\324\002\212O\2556\032\327VE\001,\246\304\250\251\005"
+	.ascii	"\213\250qm\325\342i\342\304\t\305'\025C\027A_;d\211Q)\250kq\305"
+	.ascii	"O\215j\211\326(\027-R;\\\201\3055\352'l[b\361\251\305\320\376"
+	.ascii	"@`j\207\254\224nY(V\370[[\265\b\324\376Bh\207\254Tz&\246\022"
+	.ascii	"\035 `\002\0034p\tX\f\001l\n1dU\250\020\300\2421\304\222\205"
+	.ascii	"5"
+	.string	"H,A\215j\323\377>#\347\030\031\275\036fE4\233\276Q\004\f\035\"Y\3229=:`C4\227\313G\307\2142![i\022\212\322H\2201iF\300l\341L\204:9\002\203\213\357\007\032\203\r\217;jp\366\215\371\306|d#P\001aA\361\371\270\217\354\206\357\013\236\234-\037\217:&>`\340|\2465\237P\234+i\354|;.\221\025\250\210\340|\2464\375\373\304\320\r6\244,L\312\320\235({\216\350@}\f\231\271\365H\003\226%(I\262\013\326\227\036\242\205(A\303#\007\222\242,>\274\346|8\320)J\374\214\335@\261\314\326\344Q\371lh%f\231\270&O|5\22049\022$\r\316\276\243\371\201\275\275\275=\275\275\253|G\354\243\341\233q\337\361E)\035ZV\025\232}[\276-_WP\\Z\r=\037\327}]|\222p9\303\364C_Q\242$\303\371W\351\213\201\342)"
+	.string	"\317\026\020-T\355\004\203\205jH\226\226)\007\207\252\b\f\032ml^@y!\226\331\344\3513\207\245}\244K\252\320\366\256\260\033&p\200D\361Y\241z\272\3504q\343\253:\335\202\314X\321\013\343\243\322T`\372\270\031\243\247\247\367\362p \245\253\b\223?\327{Eq\204\200!\203\263\366s\272\261\371\203\204\017\323\326I&nho\362\352\322\266\273-4\3602\220\263-iwD0\200\261%\307\347\312\2419\260\372`\331C\347\307W\0378\273\024\017\335\030\220-\2345\036\235\347Z\317\265\036\254\365\230{{\350\0247nh\326s\364\034\275\304ccsT\226v\256\227`\316\027s\364\260\301Y\3279\230>pU\334\340\254\351\034LZ\006MY\217\016\366\350\2746^\001\210\224\2504DS\325\345C\252$\310\362(\005\035c\b\021\021q\002\203\025"
+	.string	"@p8\036\222\211\346\3315\024\200\fV\256\262\200F\242\215\224$U\n\r"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\032 "
+	.ascii	"$H\004\321\303\336\205\305\006\322\\2\253B\314X\207\027\006\210"
+	.ascii	"C\273\311\306\270\031\020\276$\226\372\205\254?\363\007S\264"
+	.ascii	"\221^\3516\270\327fK\241\320\260\"\340\267\225\022\225n\326I"
+	.ascii	"\022\342:\253E\364c\276\301\247\007\341\346\013\314\005\255\315"
+	.ascii	"\331Kn+d\222\357\371JV\333\317\323\231\204\251#\262\221\220\021"
+	.ascii	"\002\2014\356\260"
+	.string	"\226\t\212t5h\253\340IZ\3403,\224\345\f#M?\313\306\"$\343\006\"\327\337\263wgB\2123\310\253>{\336\356Yt2\340sev\367\242\347_\031\330Z\314\004\275\202\330v\262\267\362Z\002\006%\0224\343A)\371\342\320T}\225&\233\032r\366\267\321\026 q#\3138\364\2047xF\005\031c\367\033\344\001\321\367\316n,\316x\244\314\020\344;\\\313QU\315\262\362i2\rQ \224\200\210\251\301\240\016ev~2\335\027\004\227\352\037\2105\334\013A&\03390Fz'&\255\211\031#e\3509)\377r\334H\316R.!\027NQ\206fX\034aF\027\232\332\257w\265KT\242\224)\216Z#a\334\b\340\3373\351L8\0057\343z1\200\274\fD$\332\004\031\303z\333\344\361- \020\253\347\306\331\300G\376\202\240[=y\315t[\201\006\277>\3234\0237\256\214\323!\375r6"
+	.string	"\310S\226r\224^V\rZH\271h\222|\251T\216\035\216\200\211\\\317\004\210\341nK\316D\026\204*\f(\227\204q\225\021\030\026\0246\246\223DExL\002\344\031M;\270\222\003\252\273\232\211\233\234\2211\304\242v.\272\351)\356\230\323\033\017\200\204jx\241\\\316DE\331/\n\270\346\336\351\3546&\201l\r\346!\264\036\36082\361\225d\245Zv\034\033Y$1\002\350;n\001\272\231\343\376\371\013\324a\216\227\214('\376\244\027T\375\206\260\357\212\"yG\210l\233G\262l,\321\320\327\221\204\221\035\315\200T\361\004\372\f\fP\034NnD\353\360\265\035\251u\004\215\"\215\020\034\355\351\304s\301\265\221\246\001Z`m\317\210\344\251\334.\365\342U~\223\355}\005\366256\311\371Y\031\220\371.\030\267\214\2533|\325\020U\201U\030\f\234\314u\3422Q\314`b\246\365\333\257\267\253\311"
+	.string	"\362fU\317\036\366\316\255X\243:\340\341\2542&\253<v\214\265\235:]R\350\221J;-B|xd\350\246\347\364A\277\020\333&\362\332\b\344l\376[\272\234\362\327\343\374o\344\332\337\212f\303e\177\245LDg(\271H\b\203\255\360\212\032pJ\033~\205OE\247Q:|\003\022H\037"
+	.string	"\320R0|\b\371\361\211B\312@l%\021\225\213\345\340\376@y\246\036\270\005Y\220\236<\256\3001\227\310\320n\270\3347\373\210g\004\\\330\325\321\235\216\221\375+p>\0322]\304\237\206{\205"
+	.string	"i\341\332\200\362ERu$\261\341\204\306'\323\265\\\341\312\037\037V\2249P\341@k\332\302tv\207\003\b~\030[\275\315\355\325\276\275\224\304\026\003\271:`\361l\246\f'\250\346\002\354\343O3\352\300c-\214\332\252y\307\037\305\275F%\371\251\222\231])\327Z\335r\361A\331\353\250\272\213\021l\277b\347~\362\311\342)\007\327\253\0302\334\200\200qa\"\b\313\007ud\241\247\221\233LS\264@rab\307\224\2113UJ\006D\366{\307!>\373J\013D\263P\2316\241F;#\230\335\"\327\273"
+	.string	"\327C\207\354\306\363_)\235\002\355\304\351\3664\022E'\242\021\3416\005\271I\262\365o\332\322\017\335\240\377\005\311I\025\253\277#U\347HA\203\3502\344\313;\27190(e5\340hGM\013\025K\035\324-\242\027\031\236\215\326W\244C\tp\356\036\302\312x\357$p\367\257\202G\233\265\225\253\204J\030\302\204?\277\346\\\201\332mU\257\337\tY2\2032\300\277\301\r\3075\342]o\244\211\330 cO#\214g\315~\007r\243\215$\301\276\325\257T}\t!\300\265\336L\215\322\255\326\356\013\357\037hEU.z\327\013\205\367\264*@\260\363R\212\205\242aS\231\274\177\033\346\005\027"
+	.ascii	"\007\206\224'1~\343\343O\002P3\344\224\331\027\340:H\344a3k\334"
+	.ascii	"\340\031u5\317\352\237\347\246\355_\333+\350\207\243\346`\240"
+	.ascii	"\220\273,X\205\251\350\\\340\235\214\230\210.hIk*EA\376i\372"
+	.ascii	"\231ot\255\216'+\223E}\263\331\326\301\005\002\251\204@\0018"
+	.ascii	"\257\240\361\347\200\006\335\270\270\037\006\364\354BD\370\025"
+	.ascii	"\376\274\250\204\250\305\226\2346\371{IO\n\245,&T\265j/\016\307"
+	.ascii	"\377N\211^#\344}\236F&%v\016]\034\003\n\377\267\023^\001\231"
+	.ascii	"3P\301I\212&:\300A\001\262\234\030AV"
+	.string	"\270H"
+	.ascii	"u\254\325\330\310\236\210\310\023\016\372{\021\345B\217\f\304"
+	.ascii	"\356S\205*\343\326\240@\220\252\200]\023d\226\ba>\201o\005\236"
+	.ascii	"\313\326|'\357\017\307\322\210\313\353\215\271u@\337r\244\312"
+	.ascii	"cRr@\213\024\355\3501\306\337R\207\023\257\330\216,^\023\033"
+	.ascii	"\327]\350\323\344\352b\244,\026"
+	.string	"\277\246\016L\330\355\242\266\253\207C|\234\264\205-\373\355\343\"\363\201\f}*\350\n\270\346 \312R\\N\232|\357\224w \007\307h\305(\354\340\303\361\0311\226:u\217H\225D\315\005\351\250P\nzL!\311\300\250i+\035\357\030qR\333\3424}\272\202w#'\nT\300\375m\3056\2052W\345\371\3306\245QDx\016\261{\316Y\b|\n\241\3211\317JPd\270CCR\323JHu\215=\020\245_\267v\361\025\361\346\235\354\254\246\343\236\001\027\334\307\252FX\332\323\340\235DD;\211\037:\002\357\254\340\271|r\024\2466\337\310\223>#\004\222\304\301NP\0356\330\376\316\373\034\001\366c\274\316\224\213A\223\302EO\307\032b\330\270\233\345\317\357\026\256\304d\207]\305\202k\203\"r\022Jz\321\377\377T\215bJ\343bp\220\376\217\253\022\177\003\256}[\246-~\255\362&U\370\342\250/"
+	.string	"\335\221\2323\235Sv\027[\240\024UEM\203\276K\023\nl\375j\207\244\343)*4M\316c\n\246\350\244\317\202\362Q\302d\353\n\350\271z\246\202\305dg\b \222\032kC\273\240\230\002~\337)\333\372\255\242\357d\177\2661\033\241\277\360+\342\334\2066\036\207W2\342(\230\346&\206\215\264\310u\036\242QsYC\3371\252\217,/\376$\357\032\320\177\224\"W~**\217\301s0R\350\252\003\357F\236\217\f\316\304\302\304\004\236\374W\343e**\337\307c\005\bV\245\224\005&9\240\352\212\021w\017\224\355'\333\023Lz\275\t\244\276\335B\017#\"u\317\3645k\361H\276\303\301\260i\257%\315#\247X\017\031\200\303\331V+\345\001\234>\355\325\270\373\342\r\020\210\373\230\022\341\266\373\264\005\354\013\005\001\032\213\366"
+	.string	":\301\346\207\026\024\322\030%\235\0317\002g\231j\001\3541j\333.L\251*GB(\221O\355_\265\314\fuEn\355y9(\267=f4\301\354%\345\321\241\374\372A#\225@m,U\221\224\022\217\305\331h\264\344*+<h\254!\355\213N\020\3437s\371cz\246\221\236_\r"
+	.string	"\340\031<)\353)u\271\246c1\220^\013Z\320BPs>\243,V\272\336\375\331cH\272\376\236'\3333\246(`<\236:'\266\337\244\365\205\347\026\360\230\341\267\360\026\203(\330\t\277;\"\311\313M\0264'|\017\301\337\244\024\304\033\313\n\265v_wV)EI\\^\"\206zG9*\200\234j\341\341 \274\256\334,J1KB\335\327*M*Z\273efg\231)\347.\324\220\0031S\032\250\220\r\026=\226\334~\312\021\213\032\2502\216"
+	.string	"\371\370\007\225?\316\346Q5Ms\244\t4\233\353~-\365\236$\033\273\337 \230\371\227\210\321\252S\274k\263W\375\207\220,\212A\270\321\026\216=\246\354=\317\226\023 z2\033\345C\214u?5K\366\345\336\037\tM\224T\345\274\346\034|\3557b\205\302\227\004\\cj\223B,\002\360\276\316\351\250\351\b\r\213Y\r\336\333t\016\367i\220\"_\210\232\201e\001\230M0\206Q\016\372\332\206!\362\324\245\207\310\235Xb\255\202\240\220\264d\356\n\177\331=\343So\032)\340\215X\362r\347\263\320\003#\347\360u\330\036\373\30589\343I$\216\355v"
+	.string	"\246$\275\205[\350V~\346\307:wbvR\376\025\2169\317\345\255o\204\364\321\231\320\316K\373\t\304\213[\017<\320\325\235,m\371'\314@L\\\377\033\357\254W\346t\345\365\233]\362\317 Q\017\251\244\374\335 \306j\373\326\373\035\037P\355\225\311&\256\2373?\351\213\274l8Q&\b\\0T\332\207\231D\206\337\337^\361k\201r\275n\207\262>\316\214"
+	.string	"\023\016\326s\274\244m\\\333\255|\352\274\267\225\304\220\304])=c^i\2175?,"
+	.ascii	">\273\035*\223\322\037$a\005\307\005-_\306<\302c\005H\346c\006"
+	.ascii	"g\224\245\252\373\342\313\301j\313[)\250\207A\232(\nT\220\034"
+	.ascii	"\240\b\227Y\034\266\315\247\n?p*\030\241\223U\021\360\356\021"
+	.ascii	"\344aP\232/ \035\264\356\237\371\037\322\t\025Y\332 <]\222\025"
+	.ascii	"c~\347KW\226f\r\024)\026k^\214]o6\035\360\025\343.\304\305D\373"
+	.ascii	"3+\\(\364d\302\006A\3719\254m\032I\202'\266p`\b\241\373\307\016"
+	.string	"xz\265!\204\262;s\200\363\375\304\331\033v\"\241\320\364\020 \233J\2406?/\261^\023*(\272X\035\204\3547\\GQ\334\241W\020\277\265\321\220\344\311\032\250\n\374\035HP\306\247+o\344|\256}\275N\270H?\22588I\2443/\232\262\276\261\271\325\273N\360\003\177;`\266\263\304\345Z\334J\270.\355Q%\370A\376\\\340\314\326\305\"\311)\221\301?*\247\247\235K]7)\013\353_\005\233L\b%v\271\001\236\031i\316\fM|V7\342\301C\017\001\3454\212o#uFU\375t\277\273g\3736\352 \27352\206\235\375\270\212#\371PW\303e\222\370\312Q\312\306G\224\t\247\272\261\322x\r\326\267\311P\314O\343\"\0060@\306@\201%\027!\372\344\267\245\336\233\0022\360\337\\IX\215\372\267\t\315\246\026Q[\274V\226\274#\340\221\332bY\303\\]^2\270\213\277I\275\276"
+	.string	"\021@]\343_Y\333\b\213\216;\214i\016\203\030\277\"\343\020\243\326\007\2232\355\2070\201\204\022\311\324\331\262\377\305#\240\254|\037\345\300\365\216\215\250q>\275@ \217\334\202\256\253\260_\2667?\177\"o\004\030\306\202\233\214\347\261\267\213\211\bF\305\007\240\251\021\\,o\244\363P\256;\313H\372\355K\013\302\303\3765\354\b9-q\020\327\366\322\350-\210\374S\273\300s\331\311\027\342\332\342\324\304\323\033\007YG\207@Y\313r}\022\254\215\322\t\f\3303]\265\346YO\332\352\255\274Cc\242\026\375W`\252\327\215&\256\260\341\370 \341\004\221\224$\006\256\250\222\257\352A\rZ\363\214\366\336\204\323\\\277\250\340^\253\300\033C"
+	.ascii	"v\023\235\2075B\217\207\260\344\034\241%y\037<\244\320\341\361"
+	.ascii	"m S3R6\261r=\365\266\202\220\247$\232 =E\226\\v\255L#\215\225"
+	.ascii	"Xv\307\363\2367\277\200P\022\330\007\371sA\226\306sg\3330\235"
+	.ascii	"O\036$\306uX\350\367T.u[7\315^3\016\272\272^:\003\261O\013\261"
+	.ascii	"\016\267\370[O\377$\002\335C\201\024OuFp\037\324\275\234\324"
+	.ascii	"\355\022`\270\266\020v\320\325\305\340M\2256|x\026\370\344\256"
+	.ascii	"\236D\373S\030\022\317\231\251\027.\304\217\002\353yEy\257\327"
+	.ascii	"\024E\377\213\355.\377T\333\225!\355\371\034\326a\322\002\004"
+	.ascii	"\277m\202)\304p\200\276c\262\244N[\274Ud\"V\352\262\3407\350"
+	.ascii	"\240\214\260X=)h\320\276\n\234\2308\205\343\332s\214\003_tfQ"
+	.ascii	"\343\332\320\375\033C~\315Q\025\342\036\357\f\215b\204v\227\t"
+	.ascii	"\251s\200\256\350%\372\023k\007\322\332\311\373\201z\300]\273"
+	.ascii	"QQ$FH\237\364"
+	.string	"\366\252\004\276\303\227\210\006\277w\202\363\273\320\314\035\017[\375\201\213R\027e\340\\\210\371f\226\356]z\226\362\362\244\324^A\"l\204\357Bk#L$\002\210\034gLy`\260z\225u\254\312v\2719f\025\344\03588#\317\330\001$LZ\2239\335\350\022q)5k\221%\240H\265\3415E\213\3720\370\330\254\027\241\351\357&,X Q\344U\366\n?\236?\344\037\345\"\246\257\375\006\017\260#\020xK\021&\307Nk\016\225\365/t\212\027\201\222\024\217\265/-\006L"
+	.string	"\"\003\264\242:\310\204q\306\2761\031\037\2217y\303DN5%w\\\356e[\r\031\322K)h\272\313\215Zm\376\274ll\263<\207:Mg\337v,9[\320n\255\203\263\364\302\372\317\301V2\326x\243E\352\355\026Jl\333,pS\276o\341Q\216\247P\211j\266\"\301\035;\260\250'\017q\031\217\367\3577Ao0\033\220\032\261OH\205\b{\223'\306\254\264PU\201\016\273\310\020\333\220\206\373>\0315\370 \tw\365O\342\367V\013\342\220)\235\204r\360\021B\345!\212W\"\003V\262M\017VE\354\247\316\354.b\275\343"
+	.string	"&Vxf\344\006\204\007\240\353}\257\300\017\354^\024\224:o5\230<Dm/\020\032$\364\362n\310x\327o\243\367\225AcN(\306\353\f\213\1771)\246V\235\317F\316\344\027\177CsI\003\033\247\244;I\347\371\207\227[\327\243x\346\026q\226\373\031y\365i#\370!^\210\3236FKr{\005:\242\362w&\016\252\261\267\215\035o\367J\304+\0071e\252\327;\346\021\211\\N\250\306'\307Pmf\311|\362\311\336\230\034\211\375\225\277\377\224fc\3729Y\366\200T\237e\322\215,\346\374\322]\267\364"
+	.string	"*\017\257pv\317\200?\331\234\340bpw\237T\246\327\322]\364\271\255\r\314\375\213\367\251\225'\367\232*\345\273\022g*\307\335\200\303A_\033\225\343\220\347\003\377*\315\245\347\356}y\311\303%\227\370\022\204\002\210\336\216\305\361NX\213s\326\212\2159\356\226_\333\352\247iw^"
+	.ascii	"\332t\224"
+	.string	"Uw-*:\307\340\367\2015\0278xN/\304\237H\035\223\246\3421\272}(\004\227\341\035\346\312\3079q\377\346S\215\365\201W\223\317q\317d%\304\233~a\323\210\027)\016B\212\235T\342MRt\r\313\345k^\277\271\316\376[\275\343\315\023\013}\2227\254\252gO\334\033\352d}\344\307y\354\236\352\365%1\036\245r^\3219\233G\364e\021Q\217\340\223\225\034\313\230\214\330\357v\254\366\335n\355\361\030\246\215\271\0321h`\235\242\377\350\216Y\235\341\031.\335\341<\367\020\274(\330\001_6^\376\302\260\304\025R\243\320\\\013\276,\351W\276\375\325\324\246x\337az~tO\241\373[\030\237\210\356!4y\342\271\320\263cY7\320\021\311S?\255kt~\214\364\255\362\036\334/(\235='\364\237+0\325\374\343\337.\225\370\305O\236\255\177\264\0379Nly|\260\251u\213\367\314\377\033\306\253"
+	.ascii	"\275\361\233\235`v\331vg\340q\322\211\346\3375\333\261l\234\241"
+	.ascii	"\036\2036\305\371$N\255\f\377\350\307cm=\205k\001\341\324\343"
+	.ascii	"\223:\357\302\343\205\260\031'\314\t?\334u\304\213v\260\326E"
+	.ascii	"\371\242\220\337C\004]\203h1\326\033\262b\237@N\003\326\034\342"
+	.ascii	"\371\250\346\337\373e^Gr6\235\343D\036\257P\037\346\034\305\221"
+	.ascii	"\213\356\363\205\320B R\377-\356!\374\224\177\236\364\217\260"
+	.ascii	"7\234\307\253t\276\251\367_F\256 \354M\366\t\307\362%\371V\302"
+	.ascii	"\3715i\372\245\236\342*\321cp\027/H\016\377=\036\232;z\304\262"
+	.ascii	"\017\303\354z9\307\250\270\221\177'\317\234\030\307\240d\204"
+	.ascii	"\033\334[\276\206,\372:\374\343a\317AV\254\266\214\302\253|_"
+	.ascii	"6j&\317\025\316|i\347\223z\372\007"
+	.text
+	.section	.gnu.lto_.symtab.b1e2010f916d9cf7,"e",@progbits
+	.string	"applyBetaflightRates"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"applyRaceFlightRates"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"applyKissRates"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"applyQuickRates"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"applyActualRates"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"interpolationChannels"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"getRcFrameNumber"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"getRawDeflection"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"initRcRateCurves"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"getRcCurveSlope"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"updateRcRefreshRate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"calcRcSmoothingCutoff"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"rcSmoothingSetFilterCutoffs"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"rcSmoothingResetAccumulation"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\003"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\004"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\004"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\004"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\004"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\004"
+	.string	""
+	.string	"initYawSpinRecovery"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b1e2010f916d9cf7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1332 @@
+	.file	"rc_adjustments.c"
+	.section	.gnu.lto_.profile.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`\307\002\275\t"
+	.string	"\304\n\273\003"
+	.string	"\024"
+	.string	"\212\221\215\347\016 \002"
+	.string	"\001\003\004\005\002\005\002\006\002\006\001\353\252\315\223\t\002\240\342\234\212\n\003\004\354\275\370\376\b\005\006\007\b\243\274\344\244\007\b\002\007\002\b\002"
+	.string	"\002\b\002\005\002\b\t\365\347\255\326\003\236\001\002\007\002\t\n\013\002\013\002\007\002\f\r\002\f\f\277\362\357\313\f(\016\002\017\002\r\002\020\002"
+	.string	"\002"
+	.string	"\017\333\324\324\357\002r\r\r\020\367\203\242i\021\223\316\224\216\003.\007\002\021\002\022\001\022\016\002\017"
+	.string	"\002"
+	.string	"\022\024\341\276\210\271\001\002\025\206\271\335\257\r\026\313\331\240\372\b\027\321\316\352\310\n\030\240\342\234\212\n"
+	.string	"? p\202S$R=\226\024\2020)s\311\322]#\022\200\371\312\254\3633\331>\210)rx)\004\377\022po\003\314Kg\251-\224\302\240\032K\361\314\031\271I\240\252\004. \340\277\tm\335\340\006\241\007\002d\266\2613p`a\020\024"
+	.ascii	"'\374&\321\001\301\\\230\006\310 \271\006^k\3061\314\030\366"
+	.ascii	"\300\221y,\200\3638\370\203\004\216kr\347\335L\203\2056\211\344"
+	.ascii	"^g\304\306\351\356/J\274\303\007\013t\267:\244\225!"
+	.text
+	.section	.gnu.lto_.ipa_sra.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"m\003"
+	.string	"D\0033\001"
+	.string	"\t"
+	.string	""
+	.string	"\001\b\002\001"
+	.string	"\001\t\003"
+	.string	"\003"
+	.string	"\001\f\002"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001\003\001\200\004\001"
+	.string	""
+	.string	"\b\017\020"
+	.string	"\021\001"
+	.string	"\001\b\024\001\001\002\b\025"
+	.string	"\001"
+	.string	"\027"
+	.ascii	"`\004\240\263\302\231\271\354\253i tk\333\300\214\b\230\201\202"
+	.ascii	"\261Y\031\204&h7 I\216r\257\260\004\006\302\260A\004\253\234"
+	.ascii	"3\003D\001\006`G\314540\004"
+	.text
+	.section	.gnu.lto_.inline.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`\312\n-#"
+	.string	"\266*\215H\340\322&\035p bk\325i0\334IP`L\221\272po\213HKI\030\b\276\204\364\n\n\212r%A:\240\254>v\325!\006^#\241!\216g)\021\232A\341\205h\030\317}\234\033\333&u\2645I\t\332;\311\024{"
+	.string	"u"
+	.string	"z"
+	.string	".RD\272\021Y0\262V\253\251\330l\t\037w\367\002\212\355\0318)@`\200\200"
+	.string	"/WI\213E\322\215\254DR\250\023\007`\013\231\362\252\0166\327m\324F\240%\247\360\023\353\314K\f\245\300q\032>\251m\225\264crww\273\355\326U\346\342\356\236T\234Z\332\026\231\266\332,\242\264u\025r?\366\335\345\331\354\032\211\023b\350\207\301m\235 A\220\350P\224"
+	.ascii	"\345\223S,\0028@\256a\225Y\304\324;or+a\347}g\021\355\253\250"
+	.ascii	"\250\354\316\374nw6\352\270+\372\337\256\350\331\363|\317r\307"
+	.ascii	"\227\203F@\202V\276\224;F\270\317\214\037{\353\216\243\256\325"
+	.ascii	"\327\024p\235\002z\202+\341z%4\027Z\305\231\273Y\267\356\274"
+	.ascii	"\265\367\255\277\243\260\261\242i\345\277\345I:={o\341\366r\031"
+	.ascii	"0z\024\261\374\360\341\216\034DA/s\346\002~\327\271\243\265\250"
+	.ascii	"u\244\271H\035\241\246\246\224\377\321h\376h.'\362\261\024d\304"
+	.ascii	"\377\374\357\363g\226\354\262\365e\346 \350.,e)\025Tpw\316\235"
+	.ascii	"\273k\001\305\326%my\017\266\326m\364"
+	.string	"\304\007\310s\363\036\217\370\026\231,\242\246\256(\345\314\315|'\306\211\234\005\356\034#\213x(\001\315\f\233Ms\244\232\t#\005\323\366\353z\244\257W\320\006\333\3536*\2555Oj\021\206\371cr\332\025\203\272wv\2204t.QIi\032\371\343\342\005\007\035q\363\004\205\037\314d\022O\225U/r\266A\251gzz\236\260\023\035\325\204\356\351\ts\037\035?#*v\246\244\033I/s\2369\227\033\375\030\211\210]\025n6\206\335\225\331\256\253\232xZe\356a\314\3219\340.\354.c\311\270\316S\005%8\347o\223\335\220\023w\367!\f\006\333\235y\236\267;\353\002\201P\250\301\271\"\022\021I\nR\220\264\006\201\005FA\305\220\215\017\022\300\345@\307\252D\267i\377\277\003\210\253\003\220\004\317\330\2316<X\312\002\374\301\357>\375tLj\347\246B\216\253\222\214\025\024\221\300\275\"m\177\350Q\374,"
+	.ascii	"l5\276\267\310\310\246\312\001R\325\036<\264\236+\nm\232\207"
+	.ascii	"8\327\237F\251*%\375\0274\255\334\244\222\347\265am\257\004%"
+	.ascii	"}\372\rP\321%\316\020uz\243\022\264\207\331\352\311\332\360'"
+	.ascii	"\262(\303\345\364&\024R\032}Q\301\305\307\223\026\210\033\022"
+	.ascii	"\233\231M4}H?\0023\271J\323\2366\032=fi\220\017\245J\315^\001"
+	.ascii	"\032\265$)\375\261\322$\260\002\343\355\363\364P\364N\350\371"
+	.ascii	"\220}\301\275|Hv\3137\332-\026\260\275<\"\314\030\332A\030\034"
+	.ascii	"\320\030\264\037\223H\177\3243\227\276Z\372|"
+	.string	"\3700\267\207\301\f\272o\250\375\004\230\321j\314\210(%0%5\317\313\201/X\344\360\223N\306\316@z\335\003\037\3113\242e\353\337\017x\346\231\tB0\251W\203\236\247\352\f\275\315$\265\256\225\237\225\235b\227\252\177\215\216d\347\225\376\214\234S\365\022\377\213\312au\235/.\003\333\221\361[}G\371\354\363|-&\225ur\262H\004\223|\214\372\0378\212\302\244\231]+%\020G\2719;\026\tM\256\230S2\313\t\361\325\2454\212\256\341\353\037\271\243\005#\211#\266(\307a\016p^\244f\264DP\203\222\344]\264\303\033L\003m\245\212\334X\325\243\314\247\243\240lC\252G\3363\250\022$\177rAh:\275\212b\274\030\335\312\034\210\357KT\022^\356|G\222\261\345\272#\317 \322F\375\301h^\316\350\202\222\265\372\017L\032\275\325U\322S\007\364\240x\352\310\016\366 \037\316\340\335\247U8"
+	.ascii	"\373\036\265\212\001RKb\263\r\253k\201ih~\b\352\025\013]&\307"
+	.ascii	"\316\362\270\372\271>m\357n\230\177\313=Z\356\321r\217\226{\264"
+	.ascii	"\334\243\345\236\250S_\240z\244^\244ih\322\347?\314\313\270\352"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`\354\007U\021"
+	.string	"\326\024H<0M\233t!w\244\242\303F\215\206\034G\354`\374\225\222s\316\262\024\024\024\020RTL\350RPP\302-\243\007\233\221\242\325%~\f\374\376-\302\314\336\032Y?\262\"\020\266&\323\0160"
+	.string	"9"
+	.string	"6"
+	.string	"\356"
+	.string	"Y\217M\2547\243\350\001\256\017\326X5\302/\305\013n\346\231!\350\f\341\272\202Op\034\303=\206\353\231\321G\313\037\355L\227\231/)D\004\221$i<\036\020J$\323TU\024eY\357\rAo\206@\336\276.\213e\007_.\220#s\207\030L\2168;\234f\333\302b\002\256\217\325x5\276F"
+	.string	"\277\363\nt\001\001oc34a3D\302}\256\b\026\b\227\007c\032<\203+\230\261\031\007z|;>\261Y\261\364\215\364\013\367\027\256;w2\321d\231\226\024\212vV*k\3518Q\231ye\346?}m\337\242\324\351\226\237@P\302\200\t\022\033p\333\266W*\023\211`\030\210k\232|\310<h(\035\264\254t\234\016\207h\203\244A\343\221\001rH0L\027*\013T\005\213B\200\266\250\261\2707R\220\242R\032\003P\243\224$\017\022"
+	.string	"B\242\n\244\224!\002C\264\260fb0\\\357\32771\2133I\213\357Ox\221\237l\t\031\007\004\224N,0z@\256\3777^\333\311\353\370\313F\331\027\355\037\262\324\016\3305\365\235\230F\275u\361\3060\021 \016\304"
+	.ascii	"$\036\032\360\222\2625\310\020=\203,7Cg\025\022\311L\312#s\301"
+	.ascii	"\"\223,\221\314\020\230%\263S\243v\230\232\375jRu\263\323\203"
+	.ascii	"\204\316\231\221\267\"\272)\236\321\271\240'|\327'~o5\337\034"
+	.ascii	"\342\f\207\262\202a\346cIq\200{\201\264\250\300t\213+\210L\201"
+	.ascii	"vLWFM\300\001\340*W\237~r\275`\217\332Nqj\344\243\021\301|\367"
+	.ascii	"\234\326\303>0\327Z\034\277\373\312\226\332gF\250X\207\314\316"
+	.ascii	"\346\244\324\304(\3045\312v\337\225`\245\361\205~\177 \311\315"
+	.ascii	"\223O\211\252\330}\370%\374?dA,\021\224\236B\265\b)"
+	.text
+	.section	.gnu.lto_.pureconst.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\b\230\004\t\232\004\f\232\004\017\232\004\020\232\004"
+	.ascii	"\021\232\004\024\230\004\025\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"=\007"
+	.string	"\202\f&+pK3\034\344\303\005"
+	.string	"ya\020\b\376\003"
+	.string	"\027\007\324\353\017\326\026"
+	.string	"%=\234x<\327\177'Ph\"\020\033\364\222\266dK\231\002S\022\027\304c\312\242\254\353A!x\331x\024\026\031\366*~\376\025\233#\262N\345Sg\203\343\300l\002]\351h\001\b\307{\330{\223\241|\241S\241<!\371\023\214\252\314\367\211\320\311\2243\235\007u\316\315\035w\306\334\3019\363\366\334\240\310\023m\331\025`\027\317\247\374\351\224\312\245\316\250<*\362l\312\233N\250\034j_\006xj\004\036"
+	.string	"@\t \303\324#=\304=\006A\240\203\031\tK\030\3072\004)[ c\351\222\314M\252\035\310\b\201\025_V\213\035\214\264\013cl\005\233U\311\t\215\004[\230W\031\t\bS>T\020\372T\024\260\262\270\347\266|"
+	.string	"\253a"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.lto.7bec5dcbf36173cc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.71.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375 \227u\004"
+	.string	"\004\b^"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\321\035\006yw\250\306\006yu"
+	.string	"\005\001\006'\001\254\002\005\001\006\035\001\036\245\300"
+	.string	"8sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\004"
+	.string	"D\210\021\346\r\240I\310"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.80.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`L\004\315\r"
+	.string	"\224\023?\005"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\005\001?\202\210\200\b\177}\273\001\005\001\006{\001y\001\"\030wu\276\001s\275\001q\274\025\001\035y\001!\302\301\034\001o\305"
+	.ascii	" \310"
+	.string	"\001s\307\001q\306\033y\001\037\314\313\032\036\320\317\031\007}\323y\030wu\325\324\030\377}\330y\332\331\027\027\336\335\026\026\342\341\025\025\346\345\024\024\352\351\023\023\356\355\022\022\362\361\021\021\366\365\020\020\372\371\017\017\376\375\016\016\202\002\201\002\r\r\206\002\205\002\f\f\212\002\211\002\013\013\216\002\215\002\n\n\222\002\221\002\t\t\226\002\225\002\b\231\230\007\007\235\234\006\006\241\240\005\005\245\244\004\004\251\250\003\003\255\254\002\002\261\260\001\264\263\002\360\003m3\265\0024\262\002\257\002\256\002\253\002\252\002\247\002\246\002\243\002\242\002\237\002\236\002\233\002\232\0025\227\002\224\002\223\002\220\002\217\002\214\002\213\002\210\002\207\002\204\002\203\002\200\002\377\001\374\001\373\001\370\001\367\001\364\001\363\001\360\001\357\001\354\001\353\001\350\001\347\001\344\001\343\001\340\001\337\001\334\001\333\001\327\001\326\001\322\001\321\001\316\001\315\001\312\001\311\001\304\001\303\001\300\001\277\001"
+	.string	"\200\201\250A\3048\205,\373\006\200\2234\315\001\020 \350d2\353\0015\350\263\242k4"
+	.ascii	"r\352U!\245C\272\231\004xgm\rDd{\215\215\201\223\210|\340\201"
+	.ascii	"\230\357G]u\200@\330\256\020@\233C \307\022\001\352O\306 \300"
+	.ascii	"\033\006\333[_H\343\215\330\260 \324\266\215\271\206]\322\306"
+	.ascii	"\273\313\016\216\202\314\262d_\357\243\035\303\253\326\375Sn"
+	.ascii	"b\031N\374\"\237\243\024\315\227\257D\240\002"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.81.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`62\305\216"
+	.string	"\032\344"
+	.string	"2H \216[\031\016?b\275\230\217\310q\202\356_T\335E\222\277\"\314\323\273\017f\241\345\016\370\337\2761\300h8/\001"
+	.ascii	"\324}l\355\256\025gw\334q"
+	.string	"\366\3259\367F\244b\205\352\"!{:\300&a d\357\235\244\224\001\025\003\304\002\031\003\275/\336\353\342\275L\357m\241\366\2620\366\256P{U\2747\305{\227\324^\024j\357\211\367*\275\327\204\332[B\355%\361\336\021\357\025\241\366\206P{\223\336\013\342\275\037\324^\017j/\322{\217\336k\244\366vP{\213\336\313\341\275Dj\357\006\265W\303{\217\3575\252\275\252\332\233\276\027}\357\325\336\346B&\364\376\210\020ZW\260\305C+\236TN\030v2\357r\232\037\363J\037\363\214O\225@\263\347!\025\302\3031B)\0302\305\246(\202\311\035:\374\232cz\3111\271\352\016\267\334\034>\271\353%\234\306\242\263\230\227\bh\310\017\221\017\223P s\020 A\317@\206\207\200\006\035\022\216-2\375\314)2\007\347\016\371\310\035\356q\303\324C\307\374{s\350Ww\310\207g\347n\357\016\035:x{\230s"
+	.ascii	"\231v|\340\004\272\341\272&\314fO\366l\262K\004\003\267\331%"
+	.ascii	"Z\022\230\315\246NB\346\272\256D$"
+	.string	"\354\022q\352\264\253\\\246[\242\335u.\336\021+\354\350\354\302,\\\327\265\211\323E\036\337,\267x\350\321\232\245E/\316\272\256O\373\300{\267\006\016%\257I\362\321\272\324\263\026\204{\227\323\360\233\222\341L`\244u\335B\030g]\341\236\026\352\310\351\302\035ww\331\f\237Q\356\342\241pkbF\256\026\266\346\016\327u\215J\301I*\247(\177P9\375\n\254\344\245[\347\316\255\334\306\355\232U\263p@\246~\370\350\301c\207\216\034R8n\330\250AcF\024\324\223S\223\214\0300^\270`j\301b\205\212\024K(N(\231(Ab\204\210\020I >x@:2\352P\304\201h\203\206\243QM\321\267r\231\371\364\353\022\303\342\245sF\341\235\213R\367\325+\027\347\305\273\306\313\256\253W\315\302\241S\262hA\201\201(eY\242\200\267\330S\212?\022\331G\342\336\241\356\301\243\020\357(\304\207\330:r"
+	.ascii	"b)@\177\317\306q\343\017\333\370\303{\374t\r\032\203<cpP\260"
+	.ascii	"\243\240\372\370\251\217\220\257\235\3564\331a\031v8P\235\216"
+	.ascii	"\001C\217_\350\361 8\355\342\rS\035\267\250cD7\315bE\033V\321"
+	.ascii	"\206\023a\350\024l\226\336\030\305\033V\232>\241t\206M\234yb"
+	.ascii	"\246K\220h\362\210&\027\263E\204\t\001\206\223\300|\265\320 "
+	.ascii	">\260\300\036X\020\363\322HGkl\2646v\245;\240\025\2351\20733"
+	.ascii	"+M\304\002\2147\250\310\"E\005\326\300y\302T8c\025.\204\231\365"
+	.ascii	"\021\225\201vg\n\347\t+C\223P\262,K\2606Ra\025\225Qhg\330Al\013"
+	.ascii	"M\002\003\323\325iZ\235r)\242\225A1tx\347\r\2330"
+	.string	"\204}\374\366b@\343\366\245\013g\t\253\262A\354\211\332\200di \262,\301D\240S\370h\t\264;S:\210-Q\246?-\177\230\216\333K,\253\333\030d]\327\355.1)\274\005\360n\232ewK\330}\342\020\273\031P5wQ\251\234\262\326\233Q^@C\223&}b\222\351\320\t\356\222\301\t\227\247g:n\272\353\213\343C\347\304\\x\346\362m-C^D\317\205\357+\214\272}\211\323\\\3019\303\262\027\367\204\377\350{\217\026\332\362\377\007m):\351E\247FLN\t\256\353\252c\267\252\017\215\034\327u\225\342t\233\220\ty<\220Z\373b\202\312i\337\350\256\257)\307I/n\253\261\207\031\360`u\342\206Hs\001\205\364j\333wb\0363\354\346\305S\233\334\253\005m\317\220\302M\341v\240}\252~K\317}\252yz(\374l\377\331':HOip\237(a\231\211\300m>\373D\003K"
+	.ascii	"\356\023\345#\361\267\235G\304^\337\266_\210/v\266\357$]\021"
+	.ascii	"\263b\321\333\336\333g\232\250\007\002o;o\237\351\263\354\203"
+	.ascii	"\234\3559\373L\373\364<\304\331g:\250\f\211\223\352\233}\246"
+	.ascii	"{\2168\251\272\331g\212g\304I\025\206\3556\373L\335\224u\240"
+	.ascii	"\333'\272\250W\304IUn{\216H\0055\333k6|\245\331~\323\360\205"
+	.ascii	"\202\231\3553\307A\346v\323\330\206m\273M\365\342\3026\231\324"
+	.ascii	"\353,\314\266\030T\361\313v\013?\354\262\355\245\367\304\254"
+	.ascii	"X\270l\257\260\317#sR\345t\273k\345r\023\323O\025P\331\272b1"
+	.ascii	"\332>\273k\215\301)/\337`\276\254o\255\270D\335\344\273!$i\356"
+	.ascii	"\332\024"
+	.string	"Y\307B\321\2535\333\r\372\303\362o\331&>\341\251\332[\\_V\027\332\205[\366\325v\031]\277e\267\360\371\247\217` `\036<}w\352\350\345\341\275\245As\306\214[\223Y\246\215\215\214\030/k\\\324\264\244aA\263R\305\214\312\330\024)a`\f\307\314Q\240x\275\227\271\336\313[j/k\275\227\263x\r3/\337\313\353{\225,\307|\302{\233\260\223\367J\355e\362\336%\357\035\341\275\"\250\275V\306^%\307\336$\357E\362\336\020\336\013\302\261\367\210\261\367\203c\257\007\357\355\340\275F\336\313\301\261\267\312\330\273\301\261\227\352\275\032\2747\203\367bp\354\275\300\330k\201\332[\301{)x/R\355\235@\355\225\340\275E\336\033\301{!P{\0370\366:\240\3666\360^\006\336\273\300{\025P{\0230\366\"\240\366\036\360^\"\3575\340\275\005\250\275\004\030{\007P{\005x\357\220\367\nyo"
+	.string	"j/"
+	.ascii	"\306\336 j/\220\367N\275\367\307{}\250\275=\214\275<\324\336"
+	.ascii	"\035\357\325\361\336\034\357\225R{q\030{o\250\2756\336[\343\275"
+	.ascii	"4\336;C\355\2152\366B\251\275O\357uzo\323{e\250\2751\214\275"
+	.ascii	"0\324\034HF[\240E\242gV\332\316\201\200\\\005\324\f-\353\332"
+	.ascii	":\020\303\345\326\217\263\336\031\220\217\377\350q\037dP2t\f"
+	.ascii	"\235\322\325\003\225\302\343Es\203\020\335\320\204\305\200\301"
+	.ascii	"\365\017\203^"
+	.string	"\260\rZ$\032\005\375b;\017\332q/\264\013\345\"\343\372\016@K\256\034\347:gAR\317\201\343Rl\350\026\252\205>!\303\201.o\274h\356\211x\347\242N\320\037\023\224\0371b\0132\214\270\310/*\2229#\332\370\241\344\223\241BY\240\334\006^ \024\032\347;gB3N#\3523\330~H\3100K\324\fP/\232\013l\226\225iba\261\"\354\0368Q\205\030N\\\344\013\001\2119'>\021&\235\376(\233K~\302\376\344\027\027V\207\233\316}gC2\336\024\3432\006\223<'(\310\007L\214\363\334\340\036\030/\232\363k\226\331\245\210\341\211\265$\345FX(\274`-\362\177x\274\274\261^\274/\371\304\247l.\335y\201\227\027'\205\3310\235\361\234\027[\234\211\305[(\313|/\311\3165=e\323\207\322\314\351(\321<O\351\246|\033A\345\224\305\331\331%\215\223\317\371\335\b\313_\026"
+	.ascii	"!BTNW\274h.\257Y\366\002\033\226\023JcO\237\230X{\262\310\303"
+	.ascii	"y\263\366~\242\342nb\030\273\n58qy\316c)\316y\336\313\245\247"
+	.ascii	"@\361\2456<\flP\334\210\rNS\316\0302qJ\220\240\362\016\\#\324"
+	.ascii	"\270\026y\2718\2657\327\211\253\201\243\362\023luK\300"
+	.string	"3\025\2453\340{\313\304\225J\334D\232\344\0174%n\304\346\206\215\bg\236\020f/\372J\302\362\265\3107\231X\336_$\336\226l\301FbN.\360l6\342\034\370\366\022\361\021!.\202L\362\207"
+	.string	"w!\304\215\330\344\232r\300\340\001\361\301\312/\346\241\212\330\"\017\246\0051\245\3365\340"
+	.string	"\016s\b\341Y\036k\223\356\305\312\223b\334%.\005\317V@\234\005\337`\037\016\302\303?$\360\265\344\321\303\213\344\016!\246a\341\312\212t\204v\2451\243)c\213\374\026-cHO\303\202tg\030\327\347\214\366\024\370\350\334\347\235\202\321\217:\334\b-9u\326\341Fr\206\315>\035\004\313\250)J\273\t3\016`f\213\274Y\031\330\333\254\350dI\246\261\264\027\311=\227M\314\177\316i\013\310\341\374\347M\205\350\0346\234\310\351R\222Sk\013\\l\303\215\344\b\021\3458Yc\246\343\b\252\204!\026bu\"\321\3256hy\2113\016e2\370i\270\332\2350{\235-\362_P\3164\274\353\\\032"
+	.ascii	"\371,\237g-]\210\217\347\347\273\212\361G\365\306\247o%\247\256"
+	.ascii	"%\245\336\350.\020Q\216\223=\314-\020\025\343\034\257\266z\230"
+	.ascii	"\227Hy\302\374\t\3223\230\325\205\214\"\232\271\234\004?\240"
+	.ascii	"n\247E Az\2545~\341\262E\275\332r\005*k}\203\270>\235\266\310"
+	.ascii	"cUp\\\327,\251\355\305\257\027\004\373\001\024\223\017\256\250"
+	.ascii	"\222D)\261J\222\304\252\252\204\221&H\250\212\220`D\311\221\352"
+	.ascii	"\n\211\021\016R%VG\256\252\2244\031\300\203\007G:Pb%\304\310"
+	.ascii	"\025\225\003H\254\226\\)\261\252B\332*(&WJ\214$\271b\322\004"
+	.ascii	"\004\016\2502\250Z\022U\325A\224\222#TI\242\252\2260\211\202"
+	.ascii	"ZZ+\021\214,\211\272\262\262Z\022E\004\347\204\277e\271\213\035"
+	.ascii	"E\024\212\331\016\227\001\220\234\367\362\204hp\336\323"
+	.string	"\nR\344\214\027\370\203\310\031O\213\307\220\363\234\266\034:\316v\2017\234\316vd4x=\2779\2418\353\214\246\255\211\267\316f\362`0\327\271\351db(\3472\201+8\354\314\346\\b)g2\201J<v&CF\202\251\234\307h\205`\263\363\025\262\017l\345|\346<\252\322V\304ig\263\274\r\254\345<\206\312\033#s\371\325\275v\367\352\030\210O\fb\241\223/\267\265\360\006\371\342\342\242\031\002\006@r\021u\002\274\325-2=\263\362v\256cr\025\220\234\311\023\027B\274#\031\341\214wn#\302G\260\272\b-\244e\311c\026\345\333\321\352\032R2%'2$\304c'l\210\020\r\236\302.\2004v\213L\245\210\2459\333%9\230r\214\323Z\224\364\013\214\006O\322\306g\271\344\032\204\360%g8 <\204#\007!\365R\216\231\022L\273R.0G>\225n}p\"\303@\3042\031\366\340"
+	.ascii	"\bR\344Kx@\320\340-2]\246N\320\234\361<x\272*\3078\t.*\272\025"
+	.ascii	"\271\007N\300\016^\004%d#\357\340<\207\203\033\251:\007\207\224"
+	.ascii	"c\200\254\031*\344Vu ]\01678\221! \240)B=`~\0209\212=\037g\366"
+	.ascii	"\026\211\316 \350\314y\217\352\201\224c\236\326\n\0019\211\234"
+	.ascii	"*\217\016\003'b\024'\2033p\246\203\3013\270\340\030\234\303\240"
+	.ascii	"\177\224c\200\b\372Q6\245\326\3728\225oQ\202\027\034\310 *h\301"
+	.ascii	"\211\f\3514\313\370\360\340z\360\030\362$\276\035f\370\026\211"
+	.string	"\002\3521s\346\253\340\177I&<C^\201\363.n\352C(\370\324\331\016\362\024Lp$\332\227\234\252B\371&\270Q\336]SN\235B\0359t\234\350O\312\355o\221\350\236\236\333\371O\202\347\341\335\325\321q\t\336,k\\G\004\257q\366\203\340\021<p\b\344\330\305\251\363\300\033\007^\344\254C\214\233\203\005\307\r\247o\330c\243\271g\221h\033\030\232\347=\r\234\3169\027\350\364\006\350\342\\\334i\201\2738\353Q\340\013$p\005\342\326\250\tL\340\r\201\0279\351\232pqj\320X\257ap\006sp\221\250\0317\346y\360\2003\223Ne\332dX\177@\333\334Ry^\r\270\362\314\247\200\033@\300\013@_H\362\334\032J\306\205\023d \340<'f\200\0279\345\320\330\255QPY\007A\370T\206p\221\350\027\026\312\234\t\005x\227\244\323\232\262\271\264B\326\005\230S\214\313\022r\316;\373\t\340B"
+	.string	"x"
+	.string	"j\350\026T\313\t\212"
+	.ascii	"\240iA^4\247H\307\t\216!5M[G\n\203\356\250r\230=U2\245DDD$IA"
+	.ascii	"*i\f\342\r\b1\3100\211\254\016\022 \0029\b\307\201T"
+	.string	"*\007EHS\250\321\030\\\037\216'\263\274h\243\323\220\\L\213\361h\017\207x_\030\276qh\205\2769\252\304G\207^\205}\263_\330\033\001\230J\256\255\222\221\034\300K\216A\022(\035\231\023\201,\302\322\202\346\022\364\325\023\037tX\026f\307o\213\250\303\301\241\203\307\013\305\245\234\362\\K\317IH\303x0un\235\302\177\234\032\017\030.\267\206\352T\342\265\003\301\343\263&\253\211N\345O\367\026\310\302\326LQ\331K,\363\202\036h\304$A\017\230\265,\230\003\245n\371\252\036\320z\240=yV\003\302\354?#\362\330\233\031\024_of\241\330\003\2318\377\361\332\326\2519'\343K_P\030\375\3536?\230\230\316\203\301\304\021\016\3273\022J\232!\246\032Ei\273H\300\213\275\215I&\202\323\n\221\004\201\371\300\322 \025\323\317\200\256\200\002\225\310\365\274\004\005yy@\214t9a\311\314B\356\006Gt"
+	.string	"\223\220\311P\020$\2444P\346$\031\005QNk@\220\367\207\304K\227\023\226\364\314D!r\025;\370\342\003\b\005\032\207\202 !\245\201rC\004X\277*\214\374\007\320\222\032]\274?#\220\246Q\374\2041\267\"T0$"
+	.string	"(\340Ha\276\342\333\312`\211s\224\2246\\\3171\217#\213%\305\\\0216o\240a#zo\303\013\202\027\322\206\006"
+	.string	"\b\2619\310\331Cp\371\034\376<\352?C\n8b9\332\253(1\351\257\213\220i\356\006V\231#\265\335hm]\302\242\350p\354\267\004sM\234\022\364\177`d\005\202\367W\343&)\032\233\by\246H\312<\230Y\027\270(:\034\373-`^y\013\257d|w\215\341u\220y\344\323k\360n\030\303/@\216\265\033\200Y\f\f\247\2565iY\207-\2169\313\215\310/*#\215[\333\367\364\360\307#\025\003\356\233C\020\352\355&\211\347\364v\024h\003[\032l\200\013\264\371\253\272\2134\231\236"
+	.string	"\370I}\370\351\3541\016\004\3365\025\026d\303Y\263\363\235\267\363\364\317\223"
+	.string	"4\212 \336>9\337\f\255\277\302p*+\214\350\363\270\236\002a\020\251\223\t1j\337\250p\275\214\272\332\363\026\256]4\257\215\342L!\021\347\013p\234\242\247KD#\2708:\365"
+	.string	"$M\350*\001\366\221\237&\246\200\341\223\003I\204\375\037L\252e\234\025\377"
+	.string	"\263\250\t3hVJ\017U1m\254\266\017\372\313\302z\374N\377o*\331N\362\r\320%;\232\364\001:T\311\027\336\354\264\253\2407 \244-\003\352\004\305\"\377\01741\n"
+	.ascii	"\213\2551\034\007I\242Z5_\251\365(\026O\204\327\232'P\342f0\236"
+	.ascii	"PiN\207\255U$%\314\242j\037e\256\177C\"k\025$Q\013HL\"+VA\315"
+	.ascii	"\262\343\260\210\367\t"
+	.string	"(\355\352\310r*\235\242\034D\361T\243\b\005d\340/8\353.\252XR\314\025\201i0\254\370BI\227'#\235\n!\270\334\240\006K\022\261O\366Sv\365\214\2675o\260R\2638\272\034F\247EL\f\250\007\026\351\360\272\233Q\321u\246\363\023\230\216B\307c\r<h\315\335v\204\274\222\215\276\371hz\240#\322\025\351I\374x>\177\177\007:\276\252\250\371-\314E/\216h5\242\2737T*\312\236Lf\316\361#\r\330\336\2610\234\374\034M~\306\323\220\220\372rt"
+	.string	"\215\240\337A\360{\322\204\251\255AX\246\362\264\206\251SV\374\030\272\317\326\274\231T\231^o%w\274\024\023\235;\211z\334'\317\300\360\\\21294\005\376i\363\3078\304\207\ns#\252\213\302"
+	.ascii	"\216:\244\370\202\372\007\305\366{\235\211\340L\247"
+	.string	"\271C\2330\327\206J0\030\022G\367/M-q9&rvb\001\336\253s\023^FI1w\236!\005\363\2612\256'\265\331\250\f\030[\220#\320\333\311\3702$\\\326<\030@\361\\\301\212\3655'\256\373\347\237{\347\335\375\203\207\376v\377\317\271\367\217\273\373\377\374\240?\377\363n\275\372\217\353\356\256\377\350\305\237^\3463\037K\220\367\3527\334)\272C\330Mu=\325\322\257\265u\266x\273\245\331\337*[\357\333\342\216v\264^b2\027\311\004\347^\243\264\315\267\237[;\235\376\265\247m\375&\266\260#\3532J\212\263U\223X\315F\311\276\245\250\2220\f<\210\3204\245\240\231\354C\177\361]\376\257\360\234\253O\240\246A\370\224s\353\223L \0305\377\256\002OIsO\343\345\322J\371!q#-FoY\276\017\032\232\347[\320\301\221*[ubG{\343\375+\360\336\023\352\231\337\3446 u"
+	.string	"\025\336\002\262c\323\223v\205\200\\"
+	.ascii	"\321^\321GzW\200l\340\366\347\273G)prft\302.\330\321Y\006\266"
+	.ascii	"\203\b\3629-\334\234\n\352\001\274\236\361Ba2\227\237i\276\347"
+	.ascii	" \f\270\002C\035\307\331\024\001\016.$\005\226\016\252\202[G"
+	.ascii	"]\203\372K\250g\352\364\275\247\2042\264"
+	.text
+	.section	.gnu.lto_applyAbsoluteAdjustment.82.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`\022(\355p"
+	.string	"\252\271\274(H NSI\007?\257z\363@\023\261\357A\314\b\245\246fn\2463\371\364\262\377\337\227,\245:\344b\030\017\t9\004"
+	.string	"=\233-\024\233\013\312\364YPB\371\267\266\035|\377y[n\250W\321\317\024\302'Z\333\215H)S\240\002 \002\177\002|\256\374]\023\216\344\001\334JD\321+\211\217\320>E\025\314,s\367_5\263\304\246\bL\304&\232]\227\2723;\313\020\360\226[\370\262\3545\313\370\\\361[\216\0056\251"
+	.string	"j\206\245\313)\203\313(\214\030\354\020\177u\b\215\022\013\017\347\034\025\353\022\r\353\232\215\230MB\026\026\331I\304\267<\264\267\034\374k\026\342\323\034\024h)\030\270\f4\324\374#\330\004<\264\374K\227~\204z\030\341Q>\342S6\322\243k\2560\327\314\263\263S\267DQ\324n\357\234,\235\2778\303s\362#\241\260u~\244w\260t\376\343\354\016\251\203\037i\213Q\277\327\267\356H\377\231\327;~\221\035\231d\232\210P\024e\261\305Wp\354\271\353\241R\217\200y\347t\235\034P(#\240@c\371\3378+\307k\343>X%\024e3\274\203\242qRoq\334\342\343\216\377\277o\026\216\327\257w\306\271\225\031\307\322)tM\024E\247J,S\335\342\271\036\352\026;\314z\355\351>w\271\317\371\t\217C\340\352"
+	.string	"\003\254f\024P%#\006\025\0010^\f\340b\252\205T\024\213\025*\004\b"
+	.string	"\200\024(\240N\230(\361Db\204\210\020NMH\020\037\230\226<tP\342\260!IC\006$\f\027\216\306Z<\233\275\276[\2678\300\270\b\212\225}\355\351\346\252\354\345\252\334Q\341\317\371\t\247\226\265\021\302\366q\"\326\300\302\362@`\004\256\020\367"
+	.string	"D\275C6\340\221\225\243\235\341\bO\013\\@Use4\375\016q\f\252\301%`\020\320\020\303xAh\007 \264\201\203\330\305\324\337\266\370\033\304\207\245\242\366,\213=\203zxE\036\025xV"
+	.string	"<\233\250\217\003"
+	.string	""
+	.ascii	"oS\340-\341\035\243\260\203JaO\244\260\206u\330D\t:\373Dg\017"
+	.ascii	"\3450\2118#\340V\004\334\027\034\016\341\344f\233\334Di\303H"
+	.ascii	"\020f\366\203\231\2602\314Df\351m=\274\215\215\341\016J$,\007"
+	.ascii	"\022\312\334xCR\332jH\333\202\306\031\326\017\231\027\244.\213"
+	.ascii	"\241\313\331\232HC\306\205/@\215\355\321\304\032\026\345\032"
+	.ascii	"\327\017\231\022m\n\327sE\332\036-IeRN&\300\021\fm\335\236fk"
+	.ascii	"`c\\\334\262\347\271\002Q^aRY\224\223\351J\0311V[\246R\006\205"
+	.ascii	";\361\221\027)b\206i\036\2738d\n\t\362\263\203\302\233\245\030"
+	.ascii	"\021v\215\354\fC\031Xe@fjKk`c \330H\003E\321\263X\031\226\375"
+	.ascii	"\002\373\027;\370\357\301\017\345!\253\246\263\372,\245p\023"
+	.ascii	"\367zu\252WM\263\b{\272y\273\323&\f\223\021\030'\236\331\366"
+	.ascii	"4\276\370\360\203Z\032\020\272\301\234\025\235\027=mb\366\225"
+	.ascii	"8tF\364\264i\356i\360)\262\221\222\304vUB\347BO\215{J\021\202"
+	.ascii	"\372BlW\r<\007zjd\3669\375yZ\021\225M\333U\373\234\001\2376\335"
+	.ascii	")A\370\235\371<E\026\366}\310s\326\363\024\311H\311\304w\356"
+	.ascii	"{\212\344\243\\b\341\254\367\024\211\327\347!\357\254\302Sc\242"
+	.ascii	"\262\203\235>\245\355\252wO\221L\016\333USxj,\334\260]\225\316"
+	.ascii	"\031\205\247FC}I\314\247F@J\r\333U\345\316sO\221\203}Hq\347\023"
+	.ascii	"\236\"\005\225\030\340\316q\236\"\001\365]ps~\363\024\251\247"
+	.ascii	"<\2629/\237\"\351\214j\316k\236\032\t\373*\232s\232\247\306C"
+	.ascii	"\312b\231\263\231\247\306\277s\314\371\355\251qO_\273\235Ixj"
+	.ascii	"\274S2\230s\333\323z\270\333U\267\310#\374O\233\354\364\241\350"
+	.ascii	"\327\246=e1T\305\026\245\232E\234=\250\034F\374\343\300\270\301"
+	.ascii	"\374{"
+	.string	"\242\315\366\253Is\246\314\233\030\2676\266\265/i^\270(\315\264`!k\376Zi\376Vi\376\212U>\223\312_R\371J*\177\203\312\347\252\374\255\312\327\252\374$\225\257A\345gP\371H\232\237U\371G\232_\244\371C*\037\253\371B\232\037\244\371@\232\377\243\362)h\276\217\312\227\240\371=*\037\202\346\363h\376\216\312w\240\371:\232\237\243\362q4\377F\363m4\277F\345\323h\376\325\306\355\032\320|\253\312\237\321\374\252\312\227\321|\252\346\303\250\374\027\315w\261s\273S;gWj\231{\024\225\017e\344\2378\362M\030\371%\216\374'#\237\304\221?\302\310\027Q\371!*\337\311\310o\252|\244\221\017\242\362?\030\371L\225\277d\344{\250\374\016F\276R\345s0\3627T~\222\221\257\241\3623\030\371H\225\217\301\310\277P\371\307\3127V~\255\374b\345\237\225\3375j\274t\016/\275\207\332\004"
+	.string	"\200\216f\026\366K\230\002\t\341\223\255'\017\222^B\016}|{\027\350h\016]\fda\303\243\264\326\261h\005\024v+\345\245J\333\027\324\216f\273\375\032\2368\262\206Ov\336\235#\275\206Io\032\357\316\256\310\216N\352\342`\035\r\313/\275\343Ko#\023L\224\340\321\234\267\337\303'\254=|\262\353\230X\275\207\031\346\262\242\004\311\315\301\340\006\217\316\320\305\3008\244"
+	.ascii	"\324\346\276\244\301)\327\232G\247Y\353ut\207D\035D\265\021="
+	.ascii	"\232\353\354\371K\004\005_O6\034\034\n\232\2770\364\357\005\327"
+	.ascii	"n\262\244\334\332x\311y\252\321K\033\315&\311\r%=\032C\027\007"
+	.ascii	"\247 \276\325\364\032%\337\267\343`\200\201\272\305\013\354F"
+	.ascii	"\3162\rN\311\326=\350\260\365&\226\020\302\311G3\232=Gi\222 "
+	.ascii	"\312\223}\306\214\004\315Q\216=\246\311\274\261\217>\206a\324"
+	.ascii	"\326>\332\232\301\316 A\374h\246\263\347\260\017\020\204=\331"
+	.ascii	"na h\0163\202a\373\321F6\203rn\375\303\255yJ\035\023\335\242"
+	.ascii	"% \315t{\036\363\340\300\330\223\255\366\305\201\346\261\232"
+	.ascii	"\226\205BP\003\215\006\244k]\240\230\006\"\246\231\n\231\016"
+	.ascii	"JA\232\307\354\271\214\003\216\262'\233\313\031\216\346\262&"
+	.ascii	"\376y@\220\201\217a\037\260\376z\261\377\b\332,+H\027U\360\371"
+	.ascii	"\311\275u\220\267\346+b6$\ti&\264\347-\032hly\262\263`\241\321"
+	.ascii	"\274\345$\273\"\244O>>0\026\273eZHK)\323\234eP\006AA@\244!\315"
+	.ascii	"\202{>\3030\343\354\311\256BeF\363YGuXV\n7\037\r\302\220\356"
+	.ascii	":<\2713=\344\200\3164\207\020\346B\2039\026i\016\3343Z\006\245"
+	.ascii	"\242?c\203\341\303\225\201\366dCi0\031\315h,\325_\215\n\326\311"
+	.ascii	"\245\351\"\214v\2527Ms\027@\273(\f\021\357T?+\245\364\307\317"
+	.ascii	"\327\242?\203\240p\013\305%\316j\366\263g\265\n,\340\025{\261"
+	.ascii	"\277\214oml\247\220\372\242\207\310\021\202\302-\234\325\236"
+	.ascii	"\344GB\216(\n%\306\271\005v\204u\"Fx\305\214\324-\276hV[ncEM"
+	.ascii	"\032\\\234'\375?\212\233Y)\004\241(Z\365#\341F\032\034Q\024\215"
+	.ascii	"Q\350%Ek\204\333\333\007u\213+\246(\253\267\267nY\354%\202\t"
+	.ascii	"\326!>\341\304Gm\307\240\005\023\f\232`iMmqiiq\021q\232\240\003"
+	.ascii	"#[G#N\222`qP\334\342B\322\204\310\226\223\005:d!9\262\305e\303"
+	.ascii	"H\023\254\036I\270\226"
+	.ascii	"4\331\342\"\242t\"-\2304\3312\242\325\204\211\223\f\212`\t!\262"
+	.ascii	"d\212\310\221\251-$XZSD\2260\231j\361t\256\r\214,\231j\302\305"
+	.ascii	"\265d\n)\356\3116\333\231\244\254\261\302-\266\226`\202\002."
+	.ascii	"\272\242\tT\003FW4fWT]\321\n\255\252\272\242\231UY"
+	.string	"u\355\302\244\272\352zV\370\242F\327\263\266)\033]C\330\213\272\321u\013SE\216\256Y\002\001\240\243k\331\036\324\216\336\304\302\022<z\017\367F\364\350uT\350\344\243\327Q\033\210\037\275\206fK@z\033\265)\005\351%\334K\022\322\273\210\2114\2447Q\240c\221^4\177|\212Y\215\242\251\374G\261V\244\254\2113D\364\244\301\316k\235\230\230\370\346\206\002.\232\373\354\367\316\006\223\273'\3177n\230\364\336A\225p.\263\216n\\4TW=\023N J\203S\212\265\013\261\336:\177\t\324\200\321\254h\277y4\226\344=y\226\220fIo\236\2113^l\314\234e\274\342\300h\023]\364{+\001\247J\303\250\322k'\021\002WT\315\207\366\253w\200\022\275'O\022\334\224\364\352=\265y\2619\301\234l\tP\365\323\271F\302\316\315JS\235fVzWH\r0\024\007\320\252\252\331\320~\361\314\330"
+	.string	"\317\223\247\bg\332\006\275xF\2549\275x\2619\273pY\240\252GtqP)\242\256\017YWm\270C\326\313\267\247\200*\253\346<\373\365\223\301\265~O\236Z\316,\\\275~!\316\262\254\024HN2\253\016Q\\*\t\301\260\264\025\226^=xbP]5\313\355\027\220\200-\300'\317\261*[\275\200NmN\2613\354\004\301\201\253v:\24541\322\322WZz\377\346\300xQ\2439n\277\201\003h\005>y\202\235O\264z\003\221oN4\021\361\201\032\215\354\242\337#\020\314>f]\303\254\367\217\034\027S6\232\341\366;\250E\222AO\266a3I\357\240\017\205YQn\204\214$\260\321\037\272\350\247\210\211\371\246l\033\312^A8RQ7\232\371\366;\310B\203\301'\373P\252A\357\340\222\241B\204~\334\350%A\036\350\232\\\372\006\227\336B{+\360\306"
+	.ascii	"\252\310\321\214\267\337D\002d\220\350\311\016\004\224Ao\242"
+	.ascii	"\016m\332\017`\237 9\272\003\037%\272\203\n\250r\2501\0203D\f"
+	.ascii	"\211\210H\220\024$I:R\016\204\b\r]u\003\022 \322$H\263\\\b\r"
+	.ascii	"Ua(Ij\026\016W,\202\374\b\237\024\222\374"
+	.string	"\327\031\227\035\231\226\006\307%!W\226\225\364/x\351~\022_!\363&\340\210\361`\214\234\031\025>\211\265VL\206y\340\322\n\177\301OBn\313\326b\020\016N\2410\302\376\304`\315\310\234X\362J#\210\005K0U\364\211\273H\352h\r\314'9q>\256\031\367\220\210\020\241\370=\276\320\342\177I\362\3462\207|\013\300\266;\036Tn\354i]\333<[\367,(\262\315x\322\354\273\270\237\302;\247\352\341\345\211\n[\260\261\210=,S\310\020\207\2055l\t\326\212\324Q\344\311&\236\3175\247\306\220\351\005k\377\362\026\020{\343\353[C\246\210\004FN\021\005b\222\bw\337;\036\372\324\2667\230r{\026B\370\253\013d0r\224( \226\222D\377\"\361\031\317\273\310^6\260B\304\021\355\024&\346B\264\204\222\340\343'\236w\t\302\304z\270%S\221\365\274\214.\331\262H\336\206\327.\362Kj\213"
+	.string	"\013A\300\220#\363~\261\315\350\032\006\277\242C~\313i\260\344-\354\351/V[\306\013\023\261\306Z"
+	.string	"3\243\350a\306\034\027\254\220\253<\ng\r\262\r\306\215B'\002A.\274\246\2100p\037\r\306\277|J\230 *1\331QU\354\325O\275=7\200\302\301\270\374\254\343\376\305wfC\034\b\370\337\372\302\247^To\266v\333\030\261\346\034\375\201w\222\303\221e\276\205W\355 \207\316\343\243\221{{2M\b\346\233v9qH\340\347e\270\304\313g\342'\236u\"\003\337\"\240c\203@"
+	.string	"\343u\2029\371\214#\260b\366\324\377;o\301\253\223i5\224:\327\336\360\274s9JN\2703\357\274zj\262-NlP\217\360\243\370\375\225\377\274\247\362\252o\210\221\210\375\364\027xu%\317sK"
+	.string	"!\365\022\314\n\212 5\221\365\306\233W_\265e!=\267\206\227\3573\236\221\212\017\311"
+	.ascii	"\224\r\001+5|\n/f\366\022\254\304\301\220Z\001\212\377\303\254"
+	.ascii	"\013\307@@TqR\247\"F\001*~\n\227\352m\221\034\033$a\256H\260"
+	.ascii	"\214\230\206\250\272S\257wh3\2613\211x\357\270x\350\313\216A"
+	.ascii	"\3371\333\n\016+W\222\355\324r\\\0227\034\032\300\236\2424\214"
+	.ascii	"p(%I\224\013?\225\265.\264\202\267`g\335\347\216*\372\034\036"
+	.ascii	"hkp\365\340\253>\344\302T\326\306\353\301\325c-$\215*\206\037"
+	.ascii	"\320l\025\343\f\364] \302o0\216z\037\331Cm\r\256\036\274\036"
+	.ascii	"x=\304L\036\\9\270\276\006{\341\375\035<\256<\334\226a\007\353"
+	.ascii	"\323\037\255\f+\2130\\\220\224\324\363W\364\354\315,s\336\254"
+	.ascii	"uk\306\2705\272gx\365\356\222\270\217\247_Q\245\363C\352\360"
+	.ascii	"t|\210Ko\247\344\213\232\230l\365\207F\236jr\220\346\303\235"
+	.ascii	"\344\341\373\310QH\226\375\344\372\257\tQT\025\246M\255\263\364"
+	.ascii	"ab,K\365\342\302\334\203B\347\022%N\tb8\365 \316\005!\263P5\356"
+	.ascii	"a\2519t\214\002%\262\004\3778\020d\213g<\255\035\320\303p\202"
+	.ascii	"\226\232\256(\271\022~\306x\30271\037\365K\035\235\030[CA)\215"
+	.ascii	"\205\274\302\002_A\350\335^l\257\242\373\336\353^\311\003/\205"
+	.ascii	"H\006G*\017T\304N\347V\342\307\250\376\003T@\236\312\221\202"
+	.ascii	"^;\203\262\215^\205\350}\334\221\336(\276e\333\303F\324g\221"
+	.ascii	"x\326\367j\262C]\373R\256z!\025y\341\341Lh,\235\373\352~\217"
+	.ascii	"R\036y\351\350\350\201I\353I\322\264\nT\340:t-\372\036\".\376"
+	.ascii	"\260\206\r~\341"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.83.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`\314\005M$"
+	.string	"*Bh\016Dp\250M:\023*"
+	.string	"\np\022j\240^\b<\017pb\374\200\004y\267\343P\374i0C\031C6]\312v\367\b\367\255\244\214\341\202\\(\002\241\344\266\211\367K/}=\270\326\221\311\330\335\2324\"M\356\224\002\330"
+	.string	"\302"
+	.string	"\321"
+	.ascii	"Z\200\257W5\206\2370*j\265\026\031\274\364\205s\351\213\300\013"
+	.ascii	"\250\302\263&\023\316\227\246\324\376\225c\241q\261\031\306\325"
+	.ascii	"\352EhL\255\305\006v:_6=\311|i\373\221\371\322\266\035<\240a"
+	.ascii	"\340\200\032\301>MaM\206\\\004\325Z\344\355\221\003O\264\323"
+	.ascii	"\345p\347\315,mK\201\276\361\025\204I\222\304\254\340\211\270"
+	.ascii	"\276\3432\006\241:\272\365\234\001/\035@\216\373\034, dZ\364"
+	.ascii	"\264%\311!\242gA\227\233\035\037\273\201'X?\350\355^:\266n\366"
+	.ascii	"xi[\240f\006\b@\326\225-)"
+	.string	"\007\023\342\2175\250\315\326\324\0069\374\034,.[\201\"B\326n<\265\221eEw\230\313\022\232IJ\316,\271\027\026\327\322\233\204Z\253)1K\307\r\340\266\001\331\016a\227S\001H\341\006\375\262\243\020\204\fRCWrF\t\232\335/\237\214_f\300\207\32400N\352\0201\376\030\247\235\273\3170_\276\306n!\257(\bc;\355f\256t\005\2515\370.\247QbU\3602\300\322\243\024'kjV\364\220]\024\322\375\262\277\311dr\315[\304.\251\231\226\226Z\t\351^\356\243\222\332\350\305\277\350b\177\200k\271wK\255+\251sK\215[\352s\251o%\265iR\227K\275KMK\352\027H1&\007\216\254ou\2515G\262PE\226d\232\334\313\257\345d_\334Ak\317\224o\361\307\274\310\200\022V\266\341\\~\264u\206\361-^\212\243\246\326\252\203a\353^R\233\206o\264\316v\026^\007\370"
+	.ascii	"\211m\247\323\301\200\340N\2555B\206\237i8k\255\020\346Pq8\200"
+	.ascii	"\004\354g\2764\367A\022\261*\232\264\037\347\310\237\017f\017"
+	.ascii	"\037>\230/\313\375\016-\264\265\037J{d\264\347\214\271\253\264"
+	.ascii	"\246W~\2044\351\242\335\375\330;\b\203\004\032\036\272\331\023"
+	.ascii	"\240i\335\366\353@\263h\227\366\306\333\320h\3211\242\035\273"
+	.ascii	"\204&\022\245{1\367\217\"F\224\033d2\302AS\276\204i\264&~4\211"
+	.ascii	"\257)q\326j\005\301Os5O>\330K\367|\364D\237\371\322h\177<\245"
+	.ascii	"\202\003J\027\026\261\035\245kC\251\240'\272\311j\203.Z\2727"
+	.ascii	"\"[\201\206\207\252h\322e\242$\323lE\373\2352\346\261\242\203"
+	.ascii	"\214\243\266\224\013z\342\367w\354\020\n\276\027+\236@\300\360"
+	.ascii	"E\235\277\026>\237\211\022\352'\325\342\214\222\202\242\352E"
+	.ascii	"\275\240`\344\236\323\217*\312\307\202\352\367\"\305\211\247"
+	.ascii	"\022\275)^\017\005/\n\352\211\005\2577\365\3439\025\260T\013"
+	.ascii	"\337\024\217JJj\212\247+V\335V\267H\0212O\026d\325\n}0\267\021"
+	.ascii	"\355\250n\355\n\273\325=\001R&D\353R\\S&\314n\277\374\261\337"
+	.ascii	"\307\321\n\216\034\322\036,ll(\306\\\332\335\332\260\201\346"
+	.ascii	"\3567\214\310\341sf\t[\206\177\312tV3\373\203\314\355\236\314"
+	.ascii	"}\262\003<\374\b\302\355\027\2333\221\231\304\367\350a\332\223"
+	.ascii	"\035m\036<w\316FK\317\332\0177\317-\322RCW]"
+	.string	"\270\315-\001.\347\271\270]zsU\345\266J{\256\255\316\225\023so\333;\343\352b5\263?\310s\277\216\326\334{\331\001l\250a(\304\020\223\246Fd$\020!\205I\213\001\220\002\221\251\263\016\021\2009TC\025\246\205a\016|0\025=\341}~\002f\226\315\013P\304\371v\nE\351&\236\210\200\022.\202\b$\037\b:+aOUuLy\262\313y\234H\370\304p\222\274I\252O\217?\301>QH\371\"\201\345p\263\210\217a\275=\371\307\254\006\207C\217\2675\2712\205a\304I\032\313yE@\314\210\240F\203\323{)\\\336\021;}\272\004\243\020\224o\227\236\227\2750\315;E\335\274\342\323\250\350\346s\204\336\271\203\b\357\236T)\035\323\260@U\\8 vp{~\221\277\247\255\2535\030&f5\300\0037\310\001@2\301\221\033\022\222Qr\213\201<\030\240+}/\314\364\030\237\320x\353"
+	.ascii	"i\341\030\242\3169\200\305=\270x\251z\013\017\354{j"
+	.text
+	.section	.gnu.lto_calcActiveAdjustmentRanges.84.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`\237\006=&"
+	.string	"ZD\354\016Ep\\N:5`5\204\271\233\3257\350\023a\370\\\256(4\2041UK\276)\b \235\266j\327\033\024!a\333YE\325\362$\236\275\226\351z\303,\3042\271\023\272\312\262\333H\236\"\236lk\333\b!r\247\024\331"
+	.string	"\311"
+	.string	"\341"
+	.string	"8\356\305\317\223\262!\242(:f\377\376\345\213u9\330\3710\033\217V\241\227:nq\275\241(\212\201\367R\001\211\303\376\275\334{\371\347w}\313\371\342\322\321 \332\353\332\212\362\206\242TB/=\304{i2'`\276\364}\200\371\322\247\355f@\007\312\004a++J\354\210\242(p\2278\350\344\327\335\253\347}=\336\316,\311\255\247\357u\006\251\233\023[\231\220\351>\262J\205a\272\032UJN\220\243Rw1\247\332\333UPR%\344\274\005\273]\205\270-/8\254*\253\233$\0017H\3508\270Z\343\343'\204\252e"
+	.ascii	"a\324O\250\243\222_\276@\215\312\212T0\366\312C\370T\367b/\221"
+	.ascii	"<9\353\232\303\252\022\362\272\253\200\242\250kPXu\377n\333h"
+	.ascii	"[\205m\226\b\367r\257#\036\320\332&N\354\307\376\036ci\310\234"
+	.ascii	"\354gG+v2;\305\323,m\232\034\024E%\030o\206\302\317zi\242\242"
+	.ascii	"\"\363%\320\236\354\036|\0209\233\"W\006\244\251\326m\035\256"
+	.ascii	" s{\306(G\212F\024\272O\346el\364\263\274\302h\352\203Fc\276"
+	.ascii	"\274\221\2569\3065\325:\377\252\357Vc\n\375_\367:\n\300$h\303"
+	.ascii	"@\252\017\272\216\031\337\346\336\240\226\311\376r\252;\264/"
+	.ascii	" L\016"
+	.string	"\2247\211\035\264\253\006z\330\375CV\003\330\352\337V\373\310\352\336V\363\266zgV\233eu\271\325\344V/Y]\267\372\t\216\210S=\204wR\007E\247\352\350\3206\245\031\255\207\375\305W\373e\276\027\373\\Nf\377\034rg\225S\245k\304<xNL\327\210q\275\265\317\255\3379\261\234*\205\023\301\266\214\3339\263\230\305\024\016\361\355p'\327\271\345\364\252\026\314\237\355-\2027Yc\242\372\360\326\355A;\017\276[\336\236\316n_v\rW)\234,Ve\332\374(b\376\030LsW\r\254\355\302\347`0\257\244iG\3336.G\203i\226\246\021Q\364)\316\3316\220\034:\230\037\314\227\346>\314\234{\217\333Z\237r\207\026a\226{,\26096\210\277\021\321c2\322\251\271)\367Ti\332\\q\350\273\344\006\341\201\272r\252u\256\273\373\250>\036\3614\022?0\305x\274\352B\321\247\bl\226\266"
+	.string	"\334\032\330T\327\232\243\3150_\326\375\227k"
+	.string	"\222\246e)^\016\r\f\035\271C\013\375\233\004\326\366T\365x@\275\230\007f\321\342F+b\020\205\260\240\364\242\006\221\n\243\024@.\032\242\241\024\303\b\206\022\215\032.R\020\241(J\002\026\251"
+	.string	"\306hA\004\003X\224D\0038\224\300H2\214\222\200JHHI\300\337W\3237\2113\250\371\232{kZ'/\221(\212E\341\305\377\255K\255\363\371\334\265G\235:\265N!\347\220!\346\313{\275\001\234\031\235\253.)\337\016\275k\343\005\355\266U\241\377,\017\033\315\237}\361$\212\242h\357\301\1776h/v\222.E\003c\033\253zx;\264\215\024\251\301\323\310q\207\224\226\224\355\b\340H\205b#\272\250:N$\346Y\032\347X\235\352\3239\\r6\251\017\236O"
+	.ascii	"\310\375*\223\221o\177u\276=\230\223\\e\314\254\\m\261\032\362"
+	.ascii	"\271\322f\267\303S\013\312\351N\255\343\036=R\322\265c\\\323"
+	.ascii	"Y\305\264\317)\017\177\250Q$\245\220S\310(#\"3#Z\220t\220\002"
+	.ascii	"\031\242\262y\021\200\251eE\n\013\013\232\375\r\\\265T\022*\263"
+	.ascii	"^,\353\334N\245Dd\376\353J\337\312\230\204\363^6\330\233\233"
+	.ascii	"r$\027\205\257?= )4\266\310PN\206\005Q\003@\017Jx%\2655\323\271"
+	.ascii	"\260\331LbD\310E\312H\b5w\364\034\342\"5\335\022q\340Gf}\314"
+	.ascii	"=\360\363_\342?\343A\001\002x\260\033\007(y\337\244i\177p\260"
+	.ascii	"(5\tG\036\334p9PJb\3473\2469\270\370K\2237d\352\247\271\333\036"
+	.ascii	"\315\224\004\207.J\204\2273\215x\021K>d\217\016\345BB,\326\364"
+	.ascii	"$\265\221\230\030\257\0222\255y\234\203\274\207\335\232\234\345"
+	.ascii	"\202.Gp:\304\211`\313\327\336/\032P\331\211\234v\021Z\351 \265"
+	.ascii	"\004\207\303\340!>\302\205\017\207\344\257\"P\274pM\260\314\323"
+	.ascii	"\2401~}\224\335$C-dv\250\231\356Y\220\f\254^\177"
+	.text
+	.section	.gnu.lto_processStepwiseAdjustments.85.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`\342\f\235C"
+	.ascii	"\252s\304\031B@\346Q\007\027\301'<w|\331b\360t\305\242\031*\270"
+	.ascii	"\377\311\034\257L\032\204{7\2769\332&\365\235V\231_\302\001}"
+	.ascii	"\321\257\216\356)e\003\266\203\202\030\331S\350\0326\037|\357"
+	.ascii	"\330\332n\222dJ\001\211\001n\001\217\001n\234n3\202F\257\360"
+	.ascii	"\216\242\273i\247\213\253g\355k\316\326\355\266\016w\323\032"
+	.ascii	"b;n\232\3665\336\206M\016\251\345\024v\n\225`\330`\374\324\030"
+	.ascii	"\245\222S\230\313\205\213\342\211^ax\272\302\315\264\2439\323"
+	.ascii	"m@\256f\3179\030\206O\374tt\273\316\276\227i\267\235\214S_W\333"
+	.ascii	"\341\260\027\354A\266\230\201\315\301\360\324\201\263]\342\347"
+	.ascii	"\254T\357s\367\204\n\257O}\3704*f\213\312\201a\265\251\336\340"
+	.ascii	"\271\333\243\236\366\272\364\207/\301p\224;6\030\236N5\204\237"
+	.ascii	"\263=u\247\326\331\237\013[g\373\355\036\024@\013NR0c\302,s\205"
+	.ascii	"a\230\352\307:\312{S\357\246\374\272S\223\220iI)\t\351(\350\032"
+	.ascii	"\001\177\276\226\355}~\333\3138\002\2605e\\\032g\322\235z>-\256"
+	.ascii	",\376\326\205\245\207\301n\016\216\243\361,\304\251\314M\276"
+	.ascii	"\rR\274\256\270\220\351\002 \262\245*T\262\222\021T:\215\326"
+	.ascii	"%!\275u9y\346#\337\2060\257)\036lR\365\003e]`\331}\353\262\322"
+	.ascii	"\223*\353\212\263\321G\317D\321\200^\326\305\344\300[\327\222"
+	.ascii	"\374;\020\346\365\345\276\336\200g\235#\376\326\365\325S\220"
+	.ascii	"\007\032\310u2s{4;#\024\346e\305Y$\347\226\353\324\312\275^\203"
+	.ascii	"\2717\210\\\347\262\347\304\225\245\351m<\027qj\345w4\316B\321"
+	.ascii	"\346\242ua^W<\3736\3000\334\271\351\364\362\006\340\335\336\325"
+	.ascii	"\335f\335.W\200|?\345G\352~j$M\201\341\2457\273_,\336\347\325"
+	.ascii	"\342\302<v\266\260q|\332\367Q\301\3045\223\220\271\236\034mY"
+	.ascii	"\334v\006\303\313\243\303\275\\Zi\\\275\302\360\022C\036\177"
+	.ascii	"{\275\364^\263\027\255}\303\264\316.x\377\212\333\320 x\357\331"
+	.ascii	"\217j\333z*s^\377\367\336\3374\277c\364'Bv\242<\2430\274\264"
+	.ascii	"\340p\272{\270\365\025\363O\204\366P\357\242u\334\016\207\016"
+	.ascii	"\037\2627C\264\316\376\267xq\265N\352\237\337\327\306\304k\021"
+	.ascii	"NgDk\241\273=\370\234\022\3553v\203\301\315\345\230h\277\222"
+	.ascii	"\"{SE\353\254\277\267q\020tq\025M\232\225\363~\315M\313\371\335"
+	.ascii	"\224\273Y\264\310\336L\360\005\266\fM\353\346\224\237\354\236"
+	.ascii	"*\363\213u;\206)v\203\372\243tgp\251\373\004\t\021\202\271\247"
+	.ascii	"\\\215\367\003\237\272;\370\334\f\234\215\367\202\245\334\n\\"
+	.ascii	"\315;\201\307\361\216\3623\336\005>7\224Rn\002\237{\200\233["
+	.ascii	"@0w\200\317\375\004\314\r\340s;\001s7}n\341\347fJ\312\275\364"
+	.ascii	"\271\225\220r'}n\244\243\334G\300\334\301`n7\230\333\310\315"
+	.ascii	"\r\374\334?`n\237Q\356\366s\263\237\273\007\314\375\237;\003"
+	.ascii	"s\273\006\2505%\234\232Y\374qS\230+o\021\214\207\205\243\305"
+	.ascii	"\343\270\253qg\343~\306]\255\273\332\001\316\026\013\002`G\346"
+	.ascii	"\206\344$\245\326A\2369\375\013h\232\333\326Sy\364\022>\337!"
+	.ascii	"\357r\023#U\037d^\006{\223\256\323\252'\316L\232\336\245q\240"
+	.ascii	":\004P\342\320\t\276X\013\303\250\326e\266kk\231^\370\276\266"
+	.ascii	"\245gzWf%\257\326/#\311I^f\220W\210\220\326\331\245\257@E\232"
+	.ascii	"\364J\357\375\"\033y\211\374:;\263\327\313\325\316\327H6\322"
+	.ascii	":\233\364@8\017\036\351\275\352#\340\322\326\230x\255F\035\353"
+	.ascii	"\342\276J\332\243\307B\222\213\274J|o\254g\317h&\362rqa\036r"
+	.ascii	"\364=\34284i\317\215m\360\037|\276\333z*\227\344 \306$\2475\003"
+	.ascii	"\311\314\340{\241\230\017Z\220\2556}\214zN\235\226A\201>Z\007"
+	.ascii	"\017E\244P\322\020\334\357\305|\030g\345\220Gl\275\346\254\234"
+	.ascii	"\374\212\255W:\367\363\254gxwl\231f\241\247\363\267I\233\340"
+	.ascii	"\335\177\242\206\211\333z\366\325mQ\234\357u\3222x0\"\203\362"
+	.ascii	"\030\202\273\363\f\336w\210\211g\364\t~\352\235\315A\2245ass"
+	.ascii	"3\263\245\356\205^\023\031\275\206\330N\235\257YK6[(\"\200\300"
+	.ascii	"\236\360\207u\373\013m\273_(N\367By\304n\206\n\371\226\330\355"
+	.ascii	"\214.+\347\275+\352Z2\331\034\355\202?\222R\375,\263]\316dcE"
+	.ascii	"\356z/\326\303\026\370X\324?\313l\327S\271\375\337w\277c/\225"
+	.ascii	"\354M\340Ki}\262}\377{?d\305\005\031]\262@\001=\003\202\321\306"
+	.ascii	"\360\250\203\212X\274q\243h5\240gT\035m\\\301`\211\305\341\321"
+	.ascii	"\212\250\003\004\223\b\033WDb\325\f\253 \217+\030\304!\273\243"
+	.ascii	"H\374\252c\225\007\036(\256\214*\210UVA\031\303\030\304b\207"
+	.ascii	"\253c\025\n\033E\254#\261h\265\324V\020\214G\342\325\215\243"
+	.ascii	"Q\007\r\030U.\254\260\250\254bP\021\207U7\250\254\260\214T\020"
+	.ascii	"\ft\021\307\025\026\325\261X\304\242r\247Ys^\306\177kN<usY\257"
+	.ascii	"\234sz\261N\262\023f\370\377\223\035x\201\027R\340\241\276\203"
+	.ascii	"5\247ei\267\301u\265\253\255\263Po\300\317WV\316\353\3010\f7"
+	.ascii	"=\360\002\237\341\035\215\263x\261\033e\234\231\2472\347e#\302"
+	.ascii	"\027\0133\364\215\271C\007\006\r\357J\267\247\210\210D&\340\007"
+	.ascii	"\th\231\273d/.\332\2574R\020R.{\023)\327:K\340\t\334-\371\n\221"
+	.ascii	"\273\221\206\220\207\274\217\034!<\036r\324\017\370\t\337\215"
+	.ascii	"\254C*\312\336l\251\255O\266\202\037`B)M\304\304\313S\360\235"
+	.ascii	"\231_LS\271*\327\023\252M\326\234\245\027\353V\321\027\244\b"
+	.ascii	"\357Q\2639L7A\t\037\365B\\\316\005\374"
+	.string	"\3212\314\202E\300\003\235w\246<\323\244\031\300\264\310\224\362U\256\013\3273@\266\362B\201I\353\242*\231\312\236f!E\236\340\003\274Wc9j\234\231\274\364\261!0i\275>\243RJ\370\022\241:\213\236\321,&\347\356X\2302\351\351#\024\002\360O\357P#\205)ao\322\205b\r\004\345\t\200\017\200\366\250q$\306\214\203\210FDDD\222&\031\016p\002\221\241\243\342\006\021P93\306f\244I\322~\006\303\363\220Q\203H\204\007O\343\315\255'\231uTC,\022\344\320\345O\262\242\216\310\314\022\355\237z\372 B\263\021R\"\317\336\f\031>\223\372\214\322\275\301\375(t'\037\323\202t\302\204\340\235\351\277\222~1\227\\\372|t\023\344?\003\037\005\251\360Z\2079\300\273QMWj}\036O\276 \307\243u\224n\374^\021\2067\223\343d\022\0332ns\234\345\262\312\217Kr\362\310J\t\251"
+	.ascii	"\026\002\240D@sX\300^U\236,[\277\251\202\322x\306\370\334.\275"
+	.ascii	"^\357M5\241S\226x\016F\311\240\001R\te\007\265\216eU\254G\267"
+	.ascii	"i\337\315V\t\320\t2_;\350w2\332\203;\220\371!\tND\341\020\360"
+	.ascii	"yK\322L5\3108\303\037\n\020c\250j\210\324\004\263\357T\202\207"
+	.ascii	"\211\241\335$\230\257g@8e\246\226vT\361\222\254\220S\360\242"
+	.ascii	"\302\3614\347\2339:\277:\322\205\355\250\3747\037p\302\234A("
+	.ascii	"\273%\241\3063\177Z%\270\277&6\017>\002\024\321>\206\272J\002"
+	.ascii	"\001\006\350k\310\3071\321\235Z\373P\330\026t\213k\352?"
+	.string	"\316\021\200\215)\204\030M\251\022^l\007\261\266\334\265j\257\"\007\225;\220%g\260~\242\356}\nH\340L*\241\262O8\354\267\231\001\0201nL=\003\215\377ETa:$d\314\375&s\332\020\207\036b\205I!_d\262\033t)0\370@|\221\033jE\224\300\201\270FX\226I;H$\312y\344\362\210l\t\024\244\004\376\274m\342\266\002\320"
+	.ascii	"\363\237\250\250\336 N\225Q\036?\332\261\201#\322\3448\307\300"
+	.ascii	"F\204\350\351L\034a`\211}\022\331\221\325\267\213wfz\002\n1:"
+	.ascii	"~d\0200\023\264.\237K-\372\365M\260\371\375\001"
+	.text
+	.section	.gnu.lto_processContinuosAdjustments.87.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`~\020\205P"
+	.string	"Z\211\200\036O0T\322\031\016\201\377\334\245w\255\352\335;h\321\352\327GUw,\3718BuX\303\375\321\210\223\336\254\002ED\314\356=\310\002\346\246\212Ev\005_\017\002x\023\002\337~#rF\021U1cP\240\210\354\336\356\276\255i\251\221\335M\312$\003\312\001\260\001\325\001\353Ky;\310\313@\336C\220\202K\330\333\025fV\307\201\255H\232M\254m\347\331\326\325\376\263\177\354\327\362\223\375b\277\225\377v\277\366e\227\222\315\256\"\324\356\230j\246\200]\236\266+\\\023>\304n\220\304\313\363\262G;\33341L6\273u]\277\232\355\nM\330\025\336l\217\227d\023\356>\313^\210oy\031\r\033\352\311\210_\215k\221*\314\037\230\264\240`\244\215\371\205\004\3749V\0049\205If\001\360W\366XV\370Sl\323|\353\330\352k\262\005\254J\327\272\256\024"
+	.ascii	"\177\366\303V\270\013\366 \324[I\341k\325\372\025\362\230P\354"
+	.ascii	"\326\025\214\200\237k\004\374I\344;\357\276\312\275\324\177\251"
+	.ascii	"p\235uu\262\327e]\301\nX\031\300\237\013v\037\364'\360<\350\317"
+	.ascii	"Uw\353\200\244V\247\032\314'G\261\274u]\213\372\206Uq\037\330"
+	.ascii	"W\210\325\017\t\005\001\375\234\360\351\341\331\321\311\301\271"
+	.ascii	"\031\332\b\323 \360\207\236\276fu\3773\3625\371\322DR9}\310\367"
+	.ascii	"\223B\242u\267\251\037|9\324\330\235\035\213\024\013\331PE\345"
+	.ascii	"A@??\243\023Z\367\321\352\221\262\206\003\363lqME\341\235\255"
+	.ascii	".PX\207\005\223\252\255\347l\341\370\006\260\363\202w\267)\032"
+	.ascii	"|>H\264\220O{\3027J\036\376Iy\233$\032\026\013\335\246\262\272"
+	.ascii	"\234\005\327\224\022N}>a\232\224\271\333\024\3237\200\362\210"
+	.ascii	"$\347\232\232\201\20320\320m\252\313G\3045u\305\277&\346\330"
+	.ascii	"\031&U\314\243\3072#\237?#,\307\200\331u\206I"
+	.string	"\025\225\373\222\274o\250\242|D\353\272>\354|\204\n\212\371g\264\256\3532\222\252\352\213\342\273\274\263\273<\354\336D\ti\003[\330Bi\216I\202\035\343i\337F\007{\210\355\270\367\353\030\007\366\311fl\002j\323P\264\177\215\226\235\215\366U\036\236\206x\235%pywh\316F\223$\3010\277|'\242\276\266\321\274\306\250\204\342\246\017\267#\342P\301\225QVY\327\250\033\347\262K\344fTf\377\234\201\023\323\252B\367:\365\007\325K\005\202\217\\\240\257D\222M\357\213\273\373\307v\334\333\035O\202\007zc\312\3118\200v%\217\310!\367\271\007\"\220`\002\364'\367\313\356\363!\00789\245\327WgQ\223\242:{\271(\262X\2315N\263\331l\036\006\332\342h\245\305E-@\037Y_/\337\016w\030\222D\344\335=q\023E\022\257\256^%\364\035B\030\231(V\263\3730wS\332K\331\n.\270"
+	.string	"\375\371\246\221L\323\273z\342\346\372\360\257\034\214\006\300u}:r\317v$R\330K\371\271\031h\300Gj\200r\320\001\037Y\324-\216V5\350\331E\265\323.\030\024\367r\3679\236\250\261\333v\262\033\344\355\021\344\345\321@\220\327H\201\224W\307\277\376\004\256\366E\340c_\034\327\362\275q\262\257\215 o\215\224\367\200\224\227F\312;\243\350g_\030\027\373\276\270\225\257"
+	.string	")\257\213!o\213\034\336"
+	.string	"R^"
+	.ascii	"R^\026)/Q\312\273\002\207WE\312\233\"\345E\201\303;\224\362\n"
+	.ascii	"\245\274A)/P\312\373\023\344=\021\344\365\271\341\355\031\362"
+	.ascii	"\362\fyw\200\274:6\2749)/N\312{\023\344\035\nymR^a\312\233\246"
+	.ascii	"\274\301\224\027\230\362\376R^4\310{\0069\350\321\036\024\303"
+	.ascii	"d;r\261Q\240a\364\021\246\341FO\333\242\036G!\236Nb\344\240\250"
+	.ascii	"\313\353,\211\333\201\263\370\006~\002\004\375i\324O\273\013"
+	.ascii	"'1\f0\215\306\321\273\3055\305&\243\275\007\f\215Z\233T"
+	.string	";\355\233BM\243\227\217W3:\250\205\222tF*?=\243\227\221J\020iBG\007\261\2224F\345/\352\200\326\321(^\216\016@}@/\033\357v\032\250\177\336\314\324\216{0:8\345\247W\204\231q1R\201\2729\021=\3216_N\254$\0029\311X*\224\224z<\242?O\364\217\310\362IY\2027\354\345\376iY\036\323\246\235\330\374\234\3060\0216\347\323\nt\227\031a\031\210\277\"\247\036\341+\265\205\343%\353\362b\200\301\247\217\366\036U\311:=\0331Fv\020^\245B{\372\\asH\370\005\225\3523$\353\270\212\251z\372]~\316\220\254c~\271\330\262F,\355\345\362\364N\237\311\013\214D\265\272]\262L\036\273\300-\360\264\216\254!|D\265\002\256\353\232c\331\b#\325\030V\006U\t+A\177\356\264\007\3112zg\301^\356\213\2408zH\345{&M\030'@\235^\n#c"
+	.ascii	"\3474\332\273*\r\352\022>R\247\211\244X\n\310\215\334\272F\035"
+	.ascii	"\271\2536\341(uy\036/c\272N\206\342\247\234\3765![\002\t\303"
+	.ascii	"\r\274\026A\271\222c\272v\027\2047\325,\364+\t\227\267\256Qk"
+	.ascii	"\276\247F\361\341\240n\241G\2529\240?q\364\257\222c\2302~\323"
+	.ascii	"8\255\"m\3307:\234\t\342\177\316\214\221\242Fo\330\350^\022N"
+	.ascii	"\357\353\347S\256\315\344\177K\302\312\030\232\002j\323Kas7Z"
+	.ascii	"\200\266i\234\267-\315\343\225\260ot\213\005\033\004\2118\304"
+	.ascii	"\307\t'\223\020&%\n\202\0345\tA\201\t\207\b\222\bI\017\fAJ\262"
+	.ascii	"Y\032&)\ti:J\"\366\330\021r\246!HII>\202\354\020\001\tH\222\217"
+	.ascii	" G8@\204\374HR\332\201\324\344\303\202!JKMIJG:{$\203\251)\t\211"
+	.ascii	"\204&&\342\b\"\370\370\340h\251\350\350GQ\222\020\037$\024\035"
+	.ascii	"-1\025\311X\261J% -\0255))-\025\t\301\236\336N6\354_\001\017"
+	.ascii	"\210\266\247\206\032\352\345\016\265\0045\320M\306G\300_\364"
+	.ascii	"\221\027\355\242w \261\214\004\203\3314\265\035b\207@\177\272"
+	.ascii	"\350\237\271\373\326u]\205b\374E7\320\307r\016\240\266d\341\027"
+	.ascii	"\202zi\205\032\241Z\021\3012\353Z\373\362\262\237\\Xf]w\207b"
+	.ascii	"\347\005\017\250E\253\251V\237\302\"#\"\355\244C*\201v\326b\r"
+	.ascii	"\213L\357\354g\213_N\250\262\200\003`+\202!\212*c\263\017\212"
+	.ascii	"a\212o|d\361\r\375\031\300\013\25225(\275\256N\254u\022\264."
+	.ascii	"\037\256\367\350\037Z\210B*!\306\262\364\350\030s_\f\206\005"
+	.ascii	"\255\236^.\2175\261+a\342\362\302\254\360\350\257I\300\b4\216"
+	.ascii	"N \2568\347kC\243\327fl\247\005\240Y4\002\335tF\345P\003\320"
+	.ascii	"El\307\275\276#j\026\r\243\314HeE\247h\242\036\2423r\251\350"
+	.ascii	"\025\375b\022\374U4\363\2410qr^UT\364\315d59A\321)\372GgT\242"
+	.ascii	"\350\027\361\f\302\270\250\035\367X\200\262\342\351\345v]\330"
+	.ascii	"\234\016j\214\354\364r_4\203\016\365\335\212t\354C\321\214\320"
+	.ascii	")\256\215{`\036\206\bp\212kSz\001\305\335Q\3518\300\373\264\""
+	.ascii	"\232b\032>r\227\272\332\240\332)hf\n\222\234\031'\2425\372\307"
+	.ascii	"\022\234\003QH5eK\253\206\216\0309%\026p\314*\r\247\227\033#"
+	.ascii	"\213\222\275a\201:\250a,\306\024S\n\315\210\210H\222$\031\016"
+	.ascii	"Q\005\204('\035\\\017\021`)DN\211\214$M"
+	.string	"\206}\003\013\327lW[J\243\3009\006E\266\324\030\354\207\211\361<\264^Mx-l\304Q\242*\335+\326\317\354\342\tS\377EL]@\242\006\270|hf\323\300\320\337\267\347T\0174\216\"\3230jgw\213\256Q0\272\337\377~\036n\200!\222\371\273\"h\365\207\210\323\221\327.}5\320\271@\037\235\273d\277\204\325\2310\351U\351o\237\003\247\336r\274\230\353\361\352Ki\377d\350]\223\020L\bI\306{\220\2769^\227.\024R\223r\326<\360a\355\317i\r\262Z\230\034#\330b\b-Fu8\023_\250\251\033!T&K\344\245"
+	.string	"\314YI\314H\306\302\332\262\364F\276\261\242d\232\204\325\375\245\031\007r\202\230\025\337\342\"\347))\315R\354T\363E\007;\321'\375m/\026<=RP\215\231\263\240/\357\265db6\347\233\020"
+	.string	"\033\304\302\261\274\233\035a\227\373\344\322\036\343\347\206\2005)\2555\364\371\270b\376)\001\n$P3\373\313M\257\r\200\326\226B;\236\264\034\326\255\332\350C49=8\267B\316\245\204q\264\274\266\b\b\325(\214D\244\307Y\212\323X\372\236\262\374\204!\374]V\323\222aO\314\001q9\305\365\353\312v\257\264\003\246+s\312R\255k\335\022\007\254fkbc\036\243\310\243\236\331\237v$\3512\234j2\212G\305\n\007\017\203\255r\nz\243\333\261\246;\275\025\265\370\270\016\235\376+\327\034\235\272Nf\336b\256\301~\3562Z\220?\227\220\223O=\352\336\177\233\314\362\273\325P\244T\341t\262\313\301,\336\376\253\373`=\336N\245\371\027\373Ft\007\335?\310T\254\337\037\225\354\310\013\347\303\263?)x 7q"
+	.ascii	"\222aH\304\331\276\224\343\013\352:\213\034\2668\024t\204\221"
+	.ascii	"y+\222\305'\023\003qb\243A<^\212;\232\"\023\302s\345\375\337"
+	.ascii	"=\300\351\n\336\277\342\344x\216/\262v\277\004\345\206\001\361"
+	.ascii	"\252\324\334+\325\265\017-\373w;r4\235\177Q\001\237~\217 (:{"
+	.ascii	"f{\214-D<\263\021\327\264\357Q8\210\251y\263\203W\322\375\032"
+	.ascii	"\276;;\233\024t\333R\203\333\220\343\017"
+	.text
+	.section	.gnu.lto_processRcAdjustments.88.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`r\001\325\017"
+	.string	"\006^mH\320\222j:\"0HR\230nG\033\320\036r\302\345\201,\237\342\222\202\013Q\355d\324C\331\2523\347a\373\366{\351\024l\204\035\203\025\031\b\301F)\227\364!\303+\036\252\203\367\007\260\333\252\225\236\202g|jB\344N)X"
+	.string	"U"
+	.string	"U"
+	.ascii	"\336;\316\007x\357l\262y\374t\251\004`N\254hl\265VpM\334t\257"
+	.ascii	"\343\226\232\374\303\3361[\345\275\017\357\270\0034\0275\221"
+	.ascii	"\026\007\216\204\245\302TQ\316\303\227[\240\262\211\020i\245"
+	.ascii	"8\317mU\343\260\323\016-\024\245\237I\255\325\324l\261\334\337"
+	.ascii	"mW\260\375\300\376K>Wk\255^\227\375\327\337\371y\177KM\227"
+	.string	"\372\236\0026P630(\366\306YY7@\352\254{\361\362\363\267\177\230C\254\200\201\351\347JIyV\326g##F\214\255\326\023\301;\233pN\355\307\234\205\351\257\r\037\251\325\205#V\353\231\300\037\316;\237'\t\235\265SB%\252-\367%f\310VAN\364\206\003@m\321Ho\372-j4|#\366\"\261\333\342\317\277\022dr\244\350\315\376\314i\f\303Oa\f\256\2417\337\371\256\361\336}\3172B\266\002\304\211\336\330\243\266J\006z\363\333\245\325d3\324\226\366Y\322mq!\031:\320p\002*A\030\205\242'%\2042\032\033\200\310\360\304\302H\"G\2438b\361S\"G \021YR\2410!\214 \222@\021\005\034\205B\021(\222J\340\307\200\307\013 \022H\216#\t\f9\353\271\272.s|\204\230\235\026\345\t\240\241\370c\226\332\362.7Z\254[\361\276\335rG\017\031\035\001(\335\032"
+	.string	"3\241oi\214\257\301\322\260\367\250\306[\027>\203\323 U\304\001\2175$\006CO\215\254\314\342\036\366*\332T\026z\310\306X\323\256\331\\\270<\316F\236j\032\270\220*\\\t\024"
+	.ascii	"\206\233R\250="
+	.text
+	.section	.gnu.lto_activeAdjustmentRangeReset.89.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375 \356\225\006"
+	.string	"2\f.5@m\223\016c>v\2463H\220\350|@\311\214`\251\314\002#M\224_H\361\277\031<\356\255i\352\355\270\243Y\206\021S\314\001>\222J\317\353S\264\203\020\231\002S\323\205]*\026\354\212x`\240,PV\244\032\342\305\201b\211\224u\305\351\340\n\242bE\254\252\254(qY\270\031(\031\371d \305SoG=\016\271\234'\366\274j\215\356\236\200F\022\027!\016\222\314\353\236\303<\210\361\005H\270yXp\302\331*\322eZt\241\374D \033\177\245\263\007\225\323H\203\016\250\342\303$3#\314h\326\227\335vJ\240m\230>\001\205\314\374i\233\246\303\376\b\177\302\257\t\b"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.110.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`\024\002E\022"
+	.string	"VawI\320\3226\035\242\227\332\302Y-\200\300\342\232d\301\222N\206\270\261\274\025\372Q\327'42I\013=\301r\001\214\367\315\260Ij~Q\315j\331!(_\312\003l\355C+\324\207\346y\032\002\320\222\210\210\364\301m\326\332\336)\005\\"
+	.string	"f"
+	.string	"d"
+	.ascii	"\224\336d\231K\0033\245\366c\\F\3533>h\0036\006\207\004\321\256"
+	.ascii	"\271\340\233S\3347\223\227\230\276i/`\372f?f\233\005s\313\366"
+	.ascii	"qSgO81\021\262\331"
+	.string	"\356v\337j\213\267^\251\326\362/\273\310\213\306\365:Bs\342\224\344\332\t\302\356\232Cqo\267\315\300\366h\323\013\001:&\034\2500\332\231m\214y\342\033'r\361XG\310\300\334 \3401\023\302h\266kv\337lr\324\276_\343>\376i\224\020\353A\245Mb\314u\301|\240\333h=\250\344\\0\0138CJ\273\260\223o\246p\004@\346r\037\033(\361\242fgwQ\324\227\261l\024\312\225\276\207\347\305\225\347\005\210hw#p\337\034\001\356\231\354\017\244\177Y%f\023DI\246\272\354\253Lv\206\237\252\242\244\031\220Z\355\225\237/'\032I0V\320j\267\374\024Ktv\267\301_?^i\375y\005;\220z\220~\206\300\320%Zs\\5m+\013\373=\177=Q\323\233\377G\022\350\020P\263;\263$dm6\034..\364\"\226GmS\230\001\326\220\362 \246\254|\036K\212Gz\022\310\020\354"
+	.ascii	"\212\200%\213W\301\005\f\271PT\221_XN \361\227\032\311\020l!"
+	.ascii	"\307r\203\212\207\362\255\272\017C\027\252\274\226\356[\215]"
+	.ascii	"\352\200E\016\340\252#Eq\325\241l\323\373\334O\354\b\246\202"
+	.ascii	"p\2555\307v\251\355\336<\270\320\257\304C\227L\200~\350'\312"
+	.ascii	"s\364x\005/ \300\002\231\244\325\001\334\202\237\310GH{wD\331"
+	.ascii	"\342\016J@\303\3108\260\030\036I\264\\\037\035\215\265\2045Q"
+	.ascii	"\030\346u\215\301b\004`b\277C\271\205#B\276\247@\2736\357\201"
+	.ascii	"\001\332\306\273\211\332\221\366\261\001x;\333\242\177i\016\221"
+	.ascii	"\260\006\2540\237\316\354\350\233-\231m\201\345\274yY\220\274"
+	.ascii	"\360;\245\246\237@\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`\020\005\325\026"
+	.string	"\026\343\204I\240\232M:\200\006\036B\007K\325RP:\003k\177t\317m\037\224\306?\327\322W\263\032r\034aL<\336vS\263\306\223\002\253S/\370\322\344x4"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"M\321\324\333t;&\203\\\235\350\007\2406L\220$2\005m"
+	.string	"r"
+	.string	"t"
+	.string	"V\241=\241d\250\357\202\341g\314Cy]\250\257\n;\030\f\266\t\252\367\205\026\352\267\204\025\376\023)\034K\374\017\013R\372\002N\250\237\n%|\214\030\341[\020\352\265\334n\316\363<\037\324\003C\007\217\002z\226\006\277\"\366\311\340R\342u,xO\301\261\210\375\263\356Lp+\342i\355\371\344\257\177T\020&{[<\020\324s\t\377\303\3069)\217E\322`\305d\215\2232\016\222\244]L\326C=\262\346\235\031k\336qw5\021iC\340\215\333y\257\250\367\242\242\336L\212z.\024\365hN\324\2071Q\177U\242^\f\211\372tD}\226\210z2!\352\313\200\250\327\372P\377\205\317\363\374mA\017\365`\270\303\253\210\377\215\034\215\031/\212\\\344X\024\311"
+	.string	":\353\2148\334i\303\237D\r\365\0018\2629\353Ji\262Lw)\t\312\263\214\224\326\213\303\326Hs1l\321\025Bm\2509\300\352\354f\035 \315\271"
+	.ascii	"\356\254a\350\254k\273\332\3305\235ml\263w\033\333D\231'\312"
+	.ascii	"Z\311\306\206\375\270\235\252\214\204\370\214\215+0v\230\224"
+	.ascii	"\006\277\324\\\340\325J\323\246\224)Ur\231w\031\t\315a\303\346"
+	.ascii	",\f\224\b\265\325~\254sd\251\007\217\254w\256\200\033\207Yf\245"
+	.ascii	"//\251\222\326|GZ\263\345kIE1rZ\343\016\320\232hW+\233Hg+[\250"
+	.ascii	"\307=\304\347\344Vv\013\224o~\3548\232\225m\356X\326\265\004"
+	.ascii	"\310\255\354\035\313\343\317\007\023\262\354\234\036s\026\327"
+	.ascii	"}\362)\033\367S\366\354\307\237b\345\203\352!\177\216\326\260"
+	.ascii	"\211\221&\225+\252\030\331\334\343\373\232\004\201\006\310\036"
+	.ascii	"b\346M\361\250\002h\250Q \217yFA\244 II1k\260\002!\262\332\034"
+	.ascii	"\021\240$\24784\021EQ\222\364(\354\255d\324\005\272\313\251\024"
+	.ascii	"\311 ~\033m\200\202\366q\245\205F\3413\320\344\212\237\345z\367"
+	.ascii	"\265~\345C\377\377\257K\r\007\3070\254\023\240\302\265\233F1"
+	.ascii	"\244\256|\306&a</V\252v\210\023\024\374\034\007\345X\241'|\233"
+	.ascii	"\261\372\213V\310\310\377~YCh\231\342\311\322t\b|\317/\232\035"
+	.ascii	"\345u\016\277O\242\317\371\370\305\301+ \342\257ju\210\335p~"
+	.ascii	"\316\366\262\346\306\324\205be\324\257\215\344(\311L\316\013"
+	.ascii	"\366}\033Xv<\202\275\356\f\377\177\024\271N\037v\221\255\274"
+	.ascii	"\200$H\032\016;\317[\310T"
+	.text
+	.section	.gnu.lto_.refs.7bec5dcbf36173cc,"e",@progbits
+	.string	"(\265/\375`\200\001\245\f"
+	.string	"\226\230K;\020\223\222\326\277\245/\250\377;,\t\232f_\177\266\210\201\tbH\020\031Z\346\214\016\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\355z\365\2674$ \353\353\257\342\357\r\265\375\3765!\233\354-S2"
+	.string	"B"
+	.string	"F"
+	.ascii	"\3551\332\024\332/m\227v\250\335iIZ\262Lw\200tC\322UQ\027\244"
+	.ascii	"Na\027\205\335\023v?w=wIt[O\353h\251K]u\367\263\262\020\321."
+	.ascii	"\321\006<\263t&\020\035Z\013`\027\304\366\260K\262\006\260\324"
+	.ascii	")Z\261%\240\212C[]8\"\004\310\r\017\033\0345`\310\260Pq\302\304"
+	.ascii	"\210\0201\037\332\267\201\363e(2\344\207\217\035\234\347\250"
+	.ascii	"\t\337\211\n\0202\341|\326\233\221i\261\"\005\212\022$D\200\210"
+	.ascii	"\361\320A\003\006#D\202\374\270\351\241\303\346F\r\215\214\027"
+	.ascii	"m\230\366\203\366\202\366\201\366J\373\323\236Z\223\226\025\356"
+	.ascii	"\t\354J\340\374\302n\300.\003v\025\004W\324R*\352\335\201\246"
+	.ascii	"\3346\324ihH\367\214\316\314\272\2135\314:\302\032\302\332\301"
+	.ascii	":\001\312\b\242Y\244\013t\016-u%\032\264nK\322\321t\325\024="
+	.ascii	" p\323\2440\017l2<\"l\237\002\350l8\0326\306\212\263\324Z\213"
+	.ascii	"\274\220q\016\206%$n\260\220\031\307\301\206\304\tv!\352q\301"
+	.ascii	"\204\304\r\026\362\342\302`B\342\004\013y\33450N\r\260=j\210"
+	.ascii	"\270`C\342\006\013!z\234`!\342\202\r\211\033,d\334\360\301B\306"
+	.ascii	"E\260F@\022\201\216\002"
+	.text
+	.section	.gnu.lto_.decls.7bec5dcbf36173cc,"e",@progbits
+	.ascii	"(\265/\375`\263Ueg\001\212[:\203U Jq'\215\001Lp2Iy\317\f\203"
+	.ascii	"\347o{\3636\023\033T\263\004b\352(\023\2104\312H_/\037r\027\266"
+	.ascii	"\031\355mN \346lnh#\334\246\353\272"
+	.string	"\242\035\026\244\rE\323\244I\323\266mK\220t\376]}\331\020!\362\217\366\265\236\246\345\226[n)SW\0079\bh\bP]v\304J)[\206\364!\302v\333\244|mD_\373\320\3279\3645\224~)\247_\236y[c\247\311\027\215\213\325(\005EQB\245\314\305/\323\364\2258B-T.\032\321\270w\324\034\341\r#\343#l\273`\356\230\213\346z\271en\230k\346\222\271i\256\230\373\345\272Y\342=s\323~\261\334,S\350\024\357\231{f\253X7\257\006\220\351)\356=\274g.\361\242Y\267,<\026w\303\356\231\013\345F\261n^\230\254O\261\212\034\241\235!\235\360I\002\306\374\024\367\036\206\235\271j\267\213u\313\302M\376\024\255X5\242q\357\037-\334\2603\267\314\252\225K\266\370d\321\211\270 \247\305\006I\007\374_-N.\221\3136t\004\207\2154\027_.w\355\227\355n\331\227\255"
+	.ascii	"[{G]\266\242>{G\025Y\373\301\332\017x\254k\t\226\214_\002\321"
+	.ascii	"6J\211_-Eo\\\356(\271\370\245\r}\257lR\006Q\247\237\363\350\347"
+	.ascii	"8\375\374\246\237\313\350\347/h\377\225b\265X5\017\244KvT\271"
+	.ascii	"\370y\213\036-R~&\352\3470\375\242M\312\317A\364s\f\375\337\261"
+	.ascii	"\337(\377\025\263g\266\212\335\322Pd'\311\036$\027\333\262\022"
+	.ascii	"\277cH\371*kX4\256\201q\321\347\342\223u:[\244|2\217\006\262"
+	.ascii	"H\331\3506\001[\341CO\335\305\377/\223+\274,\334%\226x\301\256"
+	.ascii	"\022+^\347b\335\256\354\026R4\bs\0257FG\344\026\271V\326-kC\311"
+	.ascii	"]\020F\0307FGv\301l\\\2331!\3305r\223\020M\r7\326\005v\334\230"
+	.ascii	"\330\336[I\204\b\021\"\306\270&r2\202\360I#\372\036\271_\226"
+	.ascii	"\370\266\213\304H\030(#\027\237\f\242U\354\275\267}[.\337\226"
+	.ascii	"Of\351\2231\364\311\255\177e\b\005E\303\0343\204\b\261n#\226"
+	.ascii	"\263-l\272\254\312(`\272\256\\\374_\256 \016\230\322\205\344"
+	.ascii	"\342-\2418^1\204\264\371q}X\342\005ru\020\315.\220\233u\265\316"
+	.ascii	"\b\201\230\031\212\343\242KF\306w\307\345a\211\033n\217]d\353"
+	.ascii	"xIa]||F\213`o\273!\333\272:\273!\037w\321\307O\364\177s\340\b"
+	.ascii	"\252S\004{q\361\r\245\361\306\026/t\027\037o\351\377\267\306"
+	.ascii	"\275\272X\226xm\334\030\307\303\275\257\354\275\177[\310\270"
+	.ascii	"VDP\303M#w\211\251Q\203n\357\341\265q_\\\030\243\224+m\005mK"
+	.ascii	"\361\332\270.\270\024E\bi\201s\001F\343ku\357\214K\343\327\352"
+	.ascii	"V\235\003\017>4u\255\360\336Q\326~ \262\366\003\331\226$\n-\343"
+	.ascii	"c\036\372\370\206\376\350'\304\245\002\232\032\026\001\271\231"
+	.ascii	"\363q\345\342\217v\364\3078\372c\233\016a\223\362\177\247\256"
+	.ascii	"\324\220\2346#@.\276Q$\226\034Sz\\\374q\212\276\265\002g\347"
+	.ascii	"\020M\031\355\251./\341\037{\307\372\031\207\3022\013\232\021"
+	.ascii	"\373\307\306Y\271Q\312\225\336\202\006\244x\367\205\262u\226"
+	.ascii	"h\377\330:\267s\326\316\261\b\021\"\224\306\037}ZDi\334g\203"
+	.ascii	"\356\"%#\316\305\037\231h<<\364X>\226h\367\330<\347\300\003\262"
+	.ascii	"=\226\256Gq\357\241\210\r\"\354\\\030]\235\214?\006\321\037\255"
+	.ascii	"\364G\030\372\343\224\276\233M\312C\026)\377\312\321\261E\214"
+	.ascii	"DM\032=f\350\244Y9\303?.|\\\374+\246-\034\033\307\022m\013\277"
+	.ascii	"}c\255\034O\331\332\304\275\207\027\306\250\034g\270\\|\033\""
+	.ascii	"\027\325\325\325\325\331\020\371\027Lc\353\346\267Q,\231m3RU"
+	.ascii	"m\355+{\017\217\310+!\f#\027\263\031N\355\275\225T\230[#\345"
+	.ascii	"\342\337 \372\036p\261a\306\241P\313\220\202R\334{\277\0031\245"
+	.ascii	"\225.\261\"\231\031[\205(\312hOI]\371\255\032\233\306\236\261"
+	.ascii	"h\354\233]c\211\326\315\216\271%c\313\374\016\367\236\332{\337"
+	.ascii	"\236\375%n\335\354\320V\031\207k\372\005\332YQ\313\0262k\305"
+	.ascii	"\315^\261j\326-k\217oe5j\210\355=\024!B\204\222\b\021\"\256\213"
+	.ascii	"<UD\"|+\247\277f\223r\220E\312\267i\364-\0270JC9\246\310\345"
+	.ascii	"\270\370v\250\377\333/\326\213%\3326\313f\207{\017\367\336\367"
+	.ascii	"\240\213U#\2022\332Roe\204{\017\337\301_\342\347\300\003\333"
+	.ascii	"f\327\254\3328\024n\2517\266\017\246\274\211q\207n\357\241\222"
+	.ascii	"\b\021$\232\230\215\272\214ok\350[)\375\025\372\252\376\t\255"
+	.ascii	"d\223\262M\263X,\221\002\233\345\034x\360\021j\312&\333{Xt\341"
+	.ascii	"\017\224?|.~\006\364-\005\331\326Y\n\362G\320\036lR\266R\354"
+	.string	"\024K\304\300R\271-\263f'\243\206{\270\367\260\350~\371IC\273\370\b\320\267h\3470e{p$}\213A\036\353\352,\006\371Wo`\223\262\221M\312\327\"\345\017mR\326\026)\377#p\t\231\337n0\342\267$\376g\031\307\374\367\353\037\303\374V\203c\370\311,\377=\373\375\363\207\177\004b\373/\236q\355\277d\243W\017.?\3723\005\377\2252~\334\362\337\355^\376w\371GR\313\177\271\376+\246\366\237\316R`\346Y\306\2541G\026\001(a\320a\304\362\217\302*\377hv\342\025\370s\322\177\317F@%\352\316\031\211#\332\177\177\343\224\016nf\234\361[\rF\030R\376\253\371\277\346\037\207\377\377\\+o3Z\235]\021J\377\343\330\013\3570\232\225\375\243\330\177\025\354\211S\340'\351\374\027\r\005\266\303-3>9\262F\277\325\277-\372\237\345\202\031\235\3746i\f\273lc\0234?3n"
+	.string	"\354\277WF\037#\323?\262\300$\316;\214\302\377Zy\001~2\004v\rk\264ad\314\024\374\371\302\263\330\023\307\340\317\343o\325\374\226\355?\225\337\256\375\266\313o\271\374\266\355\277\366\267`\352h\340\277d^\2775\361[\f\374\367\355\177q,\362\333\017\374#\221\377\202\215C~\333\201\337:`|\022\362_"
+	.ascii	"\357\360"
+	.string	"_6\377\330\365_\005{\342\"~\362\314\177\331\376\357\371_\367\333\377\377\363\333\373?\356\177\234\377t\377\373\374\017\372\311!\377\270\200\177t\300?\206\360\217\f\370G\004\374\243\002\376\261\001\3778\302\177\323|\374c\210\177<\300?\032\340?\321\237e\374\243\326?\356\370\307\033\377\210\365\2174\3761\306?F\375\343\376G\025\377\210\342\037\323\177\f\376c\323?r\340\037K\370\307\007\374c\322?\032\375#\321?\016\375c\320?\346\177\264\377\345\363_=\377\315\363\337:\377-\3767\356\277m\376\213\346\277f\376\033\346\277]\376\233\366_)\377=\373o\331\177\213\374W\354\277N\376\033\366\333\t\376\313\301o\213\377\005\373\255\371[\017\277\315\360\237\315\177\231\374\366\302\177\227\374V\203\377\"\371\257\221\377Y\376\253\360\277\370_\257\377\022\371\357\213\377v\360_\002\374W\203\377\212\370o\006\277\005\301oO\374\266\203\337^\360["
+	.ascii	"\374\026\304o?\3746\351\267\343\3776\377M\374\237\300\3772\377"
+	.ascii	"\207\352\352\352\352\376\322\353G\372\361#\200\003\0015\364G"
+	.ascii	"X\362\354\354m\020\330QX\033\204\201"
+	.ascii	"\355\f\336a\217>9FF9IF$\311\310\262\033\355\275%\265\367\017"
+	.ascii	"\037\271\r\355\314\214ng]\205\370\177\347d\331\343\206v\007r"
+	.ascii	"M\023%X.~\2074\372\277\335QW{\357\032\344p_I\r\345\337\336\222"
+	.ascii	"\326\206\370/\330\321\202\370\217\367\376\212\013\354\375B\215"
+	.ascii	"n\357m\355h0.Q=.\376\357a\223n{OqA5\200\013k\212K\007\025\221"
+	.ascii	"\013\353\210\212\310\265\241\246\224@\035]m.(*\342\336GSSP#l"
+	.ascii	"aQ\021\243\366\021\025qc\355\026k\260\354\036rA\355\251\255}"
+	.ascii	"\264\247v\324&nay\240\232\342\302\242\"Fa\035Q\021\271\2606\221"
+	.ascii	"k\033\355\251\250+\030S\373\352h\023\271\3446q\013\313\210\212"
+	.ascii	"\270\205EE\344\242\263\177d\270\371\241\303\n\335\022\0326\b"
+	.ascii	"\325\324\266\232\241\025ue\344F5\334\332p{\333+.\366\325v\333"
+	.ascii	"\033\304\336Z[WpQ:\354\232\224\233\225\224Z\324\226\035\356\275"
+	.ascii	"7\314\220\352\332\332SnPv\273Q5\331\332\273\211T\323\236\261"
+	.ascii	"\367\336\005\200\032\272m#\326\rJ\210\326\256r\2617\207=\334"
+	.ascii	"{\306\336Pv\273\355\275\241\366\336\345\225\326po\036FT\302\031"
+	.ascii	"3\366\316R\232\261\265\240\330\\\354}\257\304Y\303\242\"vm\225"
+	.ascii	"`\253B\024\356\027C(KU\265\265\205\033\216\353J\023\241\244\354"
+	.ascii	"\252\275\267\235\323B,\033u.\026\3035\310\240\021r\361;|\351"
+	.ascii	"\241\320\332\217\264\033\027\223aS6\354\007\327\226"
+	.string	"&\301\224\264\220\037f\304\213\337\201\206\376I&D\222\311\205\001\201\035U\343\202'Rgft\373j-\203O\320\246\205\374\f\263~\\L.!\225\004\345\220\222\332\027\177\202*\372'\223\220H\350\264\314\200#\277H,~\276\350\\\374\t\270\364\220l\357!Qv\202\344\005\033i\204\364\332[cp\027\017/\031\324\021%\027\377d\021R\310\025?t\240\\\374\016t\304\301\242#\265H\037\344\017\022\b\311\203\034Br\221]d\020r\213\354A\022\261DR\b\231u\274\204\334qk#\256\006\235\033s,\216\252=f2\370\304\260j}`\b!s\264P,qR\b9\203\274\"\202\032n\250\314\305\306\230\026\235R6;\222\204\216\003\266T6)\237C\036}\016o\3649\264\351s\300\242\317aL\237\203\020}\0169\3647\324\351\237\244q\362\212\315\003\231j\212\253\311\305\244U\211\2234\340\260\330p\\L\322\321\337"
+	.string	"\247\277\241M\177\303\231\376\206$\372'\251r\024\0313\274\370\326\2148\307\n\234\033\226\226F(\305\254\254\217\360l\250\247\004\033\027!\346\203\337\3405\030\016\327\3418\370\016\326CJ\3417\334\207\214\"\247\360\037\354\206|\201\331`8\244\013LG\266\300-`?X\016\336\203\351`<x\216\204\302E\034\207\347`;8\017\226\303mp\035K$7Ns\354\206\325\034\217ZP`\024\255L\031aX\267\254\004\210\321)\222e9#<\263j{\212a\344\306a\027\206\225\320\212\2262E2?\027N\214U\373\201E\270\367\220\313\030\263(\177\302`0Y\326\304\b\311\215\313`4D\343\336B\316\204c\322\204]\254\332\026\263-d\212%\274h\261\363\005\203Q+\252\231\301\202f\354ViA,\314I\225P\013Z\234\220\314\225\242\031\2711\0259E3r\343'V\255"
+	.ascii	"L\300\216\324\241\333{\250\004\344\206\r\\\024\t\340qh\2232\b"
+	.ascii	"V\372\307g\216\321\334\252y@C\tVgU\347bl\246\304\361\231\n\264"
+	.ascii	"\264\261]\\Z\244\374\rT\372Jx\364\225\330\350+\215\321W\022\323"
+	.ascii	"\270\r\34783D\311\305W\022\352+\351\320Wj\241\257\001\216\276"
+	.ascii	"\0063\372\032\330\3645P\321\327p\246\257\301\211\276\206$\372"
+	.ascii	"\032|\350kh\241/\301\034}\t\310\350K E_\2020}\t\214\350K\260"
+	.ascii	"C_\002)\375\244<\372Im"
+	.string	"\364\223\262\350'!\321O\272\241\237\241\217~\2064\372\031\252\350g@\242\237\341\207~\006+}\244:}$:\372H_\364\217\233\200\331\341\026\024?\302c\260\0373\301,\\-\333\"n\306\236\213\357\226M\312\027X\244\214\227\2248\026\022aA\241\202\345\342#\254dC\371\204\r\b\221$\030\350)/Y\3100\022\374U$G\013V\037\3745\312\205\321\322\303\344\342#M\220\024\315\250\3040\253\002\343\316]\2727Y;\252Nx\347\356\036+2|\372\310\330#\024U\030\231\017\263)3\314\320\252\204dK\240\024\375\304\3301\364\034Q2V\234AG\270e\320U]\315\341\321\245f%\312\217\342\334\375\363\006\306\221\257\262b\230\230\221\"\217-.\302\261\nK\216\320L\212\325\020,\302\2521\307\2204fD\031{l1\302h\261\247\310\243G\031.-U:\320\220\335\341Q\f\203\342U\034\265|\220\3711F8\322"
+	.ascii	"\"\206\317\214b\t\2711m\f3\016\327J\220\252+\206\225i\205=9r"
+	.ascii	"\347\256\23674<\360:\023\232\215\303!YG\300\222\b\311\202\003"
+	.ascii	"n\217rW\355v\031\207B\022\250\370\031y\024\271\262\245\372\334"
+	.ascii	"\271\233\247\310\216\342\336\303\261*\353L\261j\224\033\255."
+	.ascii	"\032\021\224\321\336C\342F\036\243\2216f\027\317\r8c\033L5\342"
+	.ascii	"\301E\306:<\004K\341.\354\003\343\300\\\230\310\250g\3143\312"
+	.ascii	"\301UX\013\357\300<F;8\013c\215-\214l\306:\343\036l\205a\214"
+	.ascii	"wF8X\006v\201[\340)\\cL\203c`\035#\037Lc\2343\322\215\177\306"
+	.ascii	"9|ct\033\343p\017\374c\\3\276\031\335\214}\360\221\261\2107\266"
+	.ascii	"\201_\214p8\007\016\202\241\3068\243\037|\205\2670\020<\003\033"
+	.ascii	"\301^8j\2443\276a!\243\032K\034\345F3\037\317\214h\302\234|\t"
+	.ascii	"\305\370\031\217$\211R\344A$m\334S|\306\252\032-\bo\335?\232"
+	.ascii	"\235\355\030\253v\2640#\f\033\003R\274-\230,\021\262\240D8'w"
+	.ascii	"\355\274\351!\254\2621$\316\230>\366L(V,\263\347\232\375\343"
+	.ascii	"\221QnD2\204l\3441\312\215A\250l)\356=T\262e\364t\235\331,\254"
+	.ascii	"\327lR\2661,R>\222\025}$1}\244\"\372HY\372H-\364?b\031\255\214"
+	.ascii	"WF0@7\306t\331rq\333\370'\306\226\262\213\217\341\217\376?v\031"
+	.ascii	"\331F/\343\232%\216_\306-\036\250)\2612~\031\271\210\231eY\322"
+	.ascii	"\301\370e\324\342A\227'<\304\366\036\222F\262\352\274\005\341"
+	.ascii	"cx\323\307`F\037\003\031}\fb\3641\200\321\366M\211\217X\260\020"
+	.ascii	"<4X\270\370\030\272h[\264I\271\002\213\224\217a\250\217\301K"
+	.ascii	"\037\203\226>\206\031\372G}\364\217\344\350\037\211\321?:\323"
+	.ascii	"\036,R\376\321\022\375\243,\375#)}#9}\2435\372Fl\372FC}\243\""
+	.ascii	"z\003\213\224o\244\245ot\245_\304G\277\350\215~\021\233~\221"
+	.ascii	"\024\375\"'\372EB\364\213p\350\027\271\320\037Z\244|\242\242"
+	.ascii	">\221\032}\2425}\2422}\"&\372DY\372D[\377B\234\376\205/\372\027"
+	.ascii	"\320\364/0\321\277\260C\377\202\013}8\233\224?4\247\277f\221"
+	.ascii	"\362\207\320\350\017\245\351\017=\321\037\342\241?\024\245/T"
+	.ascii	"\324\027b\323\0272\323\0272\242/\204C_\214M\312\027\242\241/"
+	.ascii	"\204\224\037\204G?\350M\217.\306\027\226\2504R\255\221\262\322"
+	.ascii	"\272\370Af\364\b\266U\312\257\263J\371AD\375\240/\375 .\375 "
+	.ascii	"\034\372@u\372E\213\224"
+	.string	"Og\223\362\201\350\364\201\340\350\003\205\321\007\242\242\017\004\246\017$D\037\310\206>\320\326 \024\3655\031mw\035:\026\n\212\006\325\305\267v\330T\321\271n`\310\3359W\316-\336\026n\234%^:\027\316o\330\215\243\006WW,s\351\33462\212\026.\206p\357!\235\373\246D\270\214ra"
+	.ascii	"\275\361\210\363\006\006\032\032}\366\\|\001t\321C\"\026\026"
+	.ascii	"\210\\\245\030i"
+	.string	"F\310\005\032\022:\345\0232\314\232\216#\027\017K+\\\206Y\302\272\020\371\360\321\302Z\331$\237Y#$J\t\330\025\333C\212\227\026,\300\271\235\325\031\271\270\374*\277J\241\275\272\252CB*K\215\032H^\n\313%B\340\266\240,Q\222\301X\3312\303\206KT\021 \027\227I\354\030\272/m\276\244\350\277<R\336P2\354\322\302H\031N\333\341\325\345\305\306\215j\214\333\305\303!\0324\276\266\210\220M\204\320\2668\311Q\016\301CG\246\r\214\213K %\220\262\353\030\242\276\202\372T\315i\321\355\254\033!\376\222\353e\027\351B\216\2355\027\227A\336\246\371\244\235\261\271\270\334z[Y\006M\027\020\001h\351\277\374A\246I\215\361\341\344\342\036=J\255\fe\346\376\230Ea\001\307P\3532\001\353\252\272\370\002\240\312\221\243\334\021\342\314\333\0373 =m\260dd\275\334\001\343I\224\032Bt\374\007\262"
+	.string	"\233\257=\245\216\013#-\316M\306\234\r\033\345\215\013\236H\215iY0>\320\240n\b\301\301\022+\273\370\001(\261J\254\214\207\211\033\237,2\272;`\027?"
+	.string	"bUU%\215\273\263\266\240\344\006pU\025g\017\2062\203\263uqI\243\264\322\263c\313\317\305\345\214\336\020+_.~"
+	.string	"n\350\007`F9UN\2251\206\030\221\241E7\004#\213\0267%\214\2271\256\025Q\334\215<Y\027\227TV\215L\t\233'\027\377N\371\242\210\306\256\303\246|Q\272\370\n\023n\201\001\372\343\347\007\214\213\313\026\226\215\354\352\201g\327\225Qe\024Y\326\301\334\230\326\216/a\224\342\236=\345N\253\334|\021#\372\362\022CV\367r\307%\271Cw\344\217\020\032\0365\340\376\370!\341pX)\341\223\373(\2310\247,\314\305\277\200\212\316|F3#\231$b\346.\376\005O\350\350\326F%N\204k.\376\005D\354\330\311x\312\034Uk\310\304\204\324\210\321\"\344\3163\236(]\206:\360\324\251C\226Y\263\252\263\033b{g\205\310,\224\371"
+	.string	"\303\026\347qr\321\bj\312\246\241\004\026$D\031\307\305\027\027:\317E0\303}\344\342\034G\n\207\240\\\341\3002\247\350\217\227 P\362\234,\207\b\314\0177c\262\234\334\302\006<\247G\220\263\213\017"
+	.string	"2}"
+	.string	"|\245yV\223&\303\215n\354\224\235\2457\031\231\237\342\205\242\232+f\330<\303=\277\341\300\203\317\021s\342&\352\342\354\346DYg\272\024/~n\023\0046\204\370\344\342\353)9\260\260.\316o\237s\233\314\251\222\2738\257y\333P\326\033\272\"n@]~\f\341\272\370%\0267=\204\027\037"
+	.string	"B\364\377\347\264g.i\371L\021\225\335;kKjj\377\320\312XUcct\233*+\004\320\215\267\255*`\236\317<\233\341\300\203\267Y58\241\327\305\271\314\255\221\271*T\027?\217\311d~  &r\324\376\\|"
+	.ascii	"\264\320Y\f\001\376\003]\037{\202\364\271\3709\214\327\232$a"
+	.ascii	"\027\337\266\323!\303F\327\343\342\374\345t\324\244xi]\374;\331"
+	.ascii	"\313\177\240\021M\327\233\324"
+	.string	"\305y-\263Y\342\313\344.\037\026\021uy\221V\346\342\203\370\243o_&\217\300\276L\316Z\236\267\374@Bfm.\336.>\b<:gyV\373\201,\021+\2675\027\037\204\234\3763\226\037hH\016I\216#\027\037\204\034}\020m\364\237\255d+d\232\207}\305h\357.\032k\373*+\003\013\243\314\035\031\027\037\004\226\254\343YH\036\222\211Xb\326\221\2514`3\221\332QI\022\300\244K+\203!-=\272\314\\L\034\226Qo\334\214\271\370 \312\364\r+\222\215\310)\036iAI\026Z7\257\0068IS\374\312^\035\244\250 @\026\247,\263\220\307\254[\226\321\236\332B\227\313r\022\270\263\214\226\247\344a&\313fY\212%\346\262\314\344yH&r\245\\\226\221\300)\356=,\262\023\305\212\016#\\\344s:HQA\300,\256\230\241\344(\226\230\307\2564\334y,\203e\261\016RT;\212\313"
+	.ascii	"h\252\300X\240\273P\207\r\\\217\214\377,\366\204HmXd\356\342"
+	.ascii	"\354$KG\231\026\027\037\204\017\375\347&\226\230\303\356\210"
+	.ascii	"\261\361\231\023\346H\027\017}\0207\364A\274\320y\211nS\364\201"
+	.ascii	"\346\342\203\200\322\377\340G\377\003\036\375\017r\372\037\340"
+	.ascii	"\350\177`\243\377l${\021\311\330A\343u\337\316TI]\374\017n\372"
+	.ascii	"\016mR\016a\221r\336\312\\\271\353\007*\032[#\222\345\342\177"
+	.ascii	"\020\243\237\203\374\007\232\300\2214Y.\306\366m9\377x\006\362"
+	.ascii	"\003\3352K\2043.\376\007/\372Y+\373\370\201\210\340\224\244e"
+	.ascii	"\321\317=\262\324\331\331qq\346\241]|(\303 \310\307\026 =\262"
+	.ascii	"\236y\374y\307\250u\331X\324\371\311s\361\005\213\224\355\\\211"
+	.ascii	"\347,!4`\212g\027\377C\227~\266a3\016b\306\221mx\330Y{c]\300"
+	.ascii	"\004-+\203\"\270\2529)\027\377\003\f\235m\334\017P\030\f\265"
+	.ascii	"\341\331\201v\361\237k<\333\370\261\231\213\307\252y@\210\233"
+	.ascii	"\266\267\213\257X\211\347\032\267\214\b\325\221\213\257\256\310"
+	.ascii	"2\275\367U\331\333\231\231\330\316\312\n1TcHY\223\213\357\301"
+	.ascii	"M\266\312V9\006\2362\314FV\b!\242\035\026\244\\|\017l\372\317"
+	.ascii	"U\267\304\\EB\361\260\263\266v\215\0040\221\032\323\002\032\252"
+	.ascii	"\361zq\361=\224e\252L\225c\2248\2442\214\347\030/\310\324\300"
+	.ascii	"H9r^2\256.\276\207 :Ke\251\354\302\303\336C\027{\305\026\330"
+	.ascii	"\222\334\342\331\205U+\"k\301\313\227\213\363T\371\225\306\302"
+	.ascii	"\226\213\177\207\354\302#\207\313\305\367 \303\217\237\fu\346"
+	.ascii	"-\357g(\240,\033M\212\\L\326\33173x\204\\L\376\261r\370MO\020"
+	.ascii	"5\013\346\364O\362\271%\222|H'\036\366\225\255]C\0030\033G\352"
+	.ascii	"\024u\255I\031^|\013\336\364O\352\261DR\017\006\363\260\275\266"
+	.ascii	"v\r\017as\177\314\31033~\300.\276\005W\354\330!\363\314u\235"
+	.ascii	"\231\321\3419\231G\263Q\363\023\344b\362\016)g\b\017\232\030"
+	.ascii	")\253\377@C1jx\371q\361-\250C$\353\340/\274\245\250\266\242\272"
+	.ascii	"\n\300\004lL\213no1\031\210\240G\f\316\305\267\240\207\376\311"
+	.ascii	"\342-\221,\222M<\354+[Q`\0270\221\353\262C\267wV\006,^\230\261"
+	.ascii	"s\361-h\361\346o\3108\273w\324\316\332Pr%px93\243\233s2\256\355"
+	.ascii	"\302\220\n\0349\027\223pH9\377\201\204\212?\274\246\344\264\240"
+	.ascii	"\225\344\205\0135B-\246\346\334\\\034\347\246\375\277\331\327"
+	.ascii	"\022&\027\223pV\355?P\020\027 ;\354\342\337y\333\177 \214\203"
+	.ascii	"-\312\231\213_\201\234\033\331\306\215d\223\3676\202\032n\321"
+	.ascii	"\270\332YW!\324\250!\331\334\2755\265\205\245\225\256(E\362\355"
+	.ascii	"$\233\022L1\212\225\213\3115V\356?\320\005;Th\344\270\370wn\222"
+	.ascii	"\377@\031N\223 /.~\005[\364+\020\242"
+	.ascii	"\177\022\r\221Ds\255\2246\224\334\006Ol\f3x\0051\364O\216\261"
+	.ascii	"Dr\fi\006\303U\noK\212f~\222\fY\346\006\261A:\324\344\304..\207"
+	.ascii	"6)\237\356\216\376\311/\226H~!\303\330H@\030\332U\006a~\262\215"
+	.ascii	"\004sq\\\252&n^\\\\\264mR\266E5\372\026\212%\263X\"\231\205\354"
+	.ascii	"\002D\265\367\215\013\312\244ndp\245\210\252\220\321p\343r\222"
+	.ascii	"\355'\325H-\344\332E\022\203\313X\244\322E\352brK"
+	.string	"\211\223\\\3108q\346\336.\376`\221\362\206\241M\312c\326\025\375\223h\226H\242\221iz\327\270\212\300[\214\342\276\312\312\340\002\225\271.8\244\225\223i?I$\251\220W\306\026\334\266\212\350\032t;\313\305d\225\022'\255@\201\362\241\344b\n,R\306\340f\223\362Eb\221\362)\370\222\"\345m\330hOu)\021R\020L\350\322\017(\002\321\372;\177\246Sz\242\260\002'\260dB\007\037\272>q\320A\320\211G\252M#\324\246\325t\"\361\003:9\001y\352\017\310\003\362\231?&\324\004\323\017E\201\236\2743\005\325\004\025)RO\204\365,AE\232A\204\365d\372 \302\311\3643\233xJo\032q:\241+\t5=Q\240i\217\303\272SO8\235\320U\253\250\317\207:e\025\275\260bM\321\021N\225\350M#V\364\207\356(X\321\237\t=4xA=Q\244Oo\032A\002\210jP\203\347\351"
+	.string	"\2474=\203\347yB\303\233F0\375P\024x)\254\350\0175z\312\260\236\252\323\351\224\3374\202\351\207\246\253J\342\354=\371x?\224D\252>\221\220\300\347{\372\375\200\277r\335\235,P5\247"
+	.string	"\246M+\360W.\231\247\017\237\351S\020\007\235xN\247S^\021\004\212\300a}\323\b\246 \t\246 \357\367D\002SP\350\267t\327Se\n\016\255\273\037S\220\3741\005\307\246\225\351w\372\362\311\002U\261\252\236i\257g\226+\202@\036N\327\340\330;\177L\250\317,{\247\372\204O\265|\272c\n\216\270\260\"]U\224\351LaC\320<\341\354\001O"
+	.string	"\252"
+	.string	"D{O!\364\320\340\206\377\037\257-M\016*/\205\fH\"L\300;}\247\211\244\365\311\007TO\204\240\241HE\232f\023\252z\362\200i\220\003\n\353\357L\323'\336QR\360\\M\254\360\005\203&\022\210\rF\254\251\031\034a\002\023P\002\003P3\250H*\023\272\364[}O\346\322\331SZa\246i\b&v\035\224\326\337\023P\004\025M\021<WU\203z2\375\314\024N\236\317\344q8\017M\317\337\311\244_\200\017\b\360\001\b*\312\203p\200\r\016\260A>\b\007(Q\342"
+	.ascii	"\037\224\320\377\240\304\270\256\353yNfJ\202\272\201\004\242"
+	.ascii	"\365M#&p:Wu\205JT\204\002]y\346\321\331\003:\005\251<tU\321\325"
+	.ascii	"\\\325\335\n\252\271\026\251@\024>8W3MZ\201\007\364\361\236\202"
+	.ascii	"\274\013\247\023\252\302\3113\323\022~\024H\317\024\300\240\004"
+	.ascii	"\351\211.\241\353\357\354\231\320KM\340\211\"\026M'\234jSN\237"
+	.ascii	"x\030\316\325L\341d\201:\241k\220\002\351\351{\352\235M<5\211"
+	.ascii	"\351\207:\245!\254\300CW\023\247\357\204\371;\217\3364BEJ\202"
+	.ascii	")\210\224\006\005M'^J\246g\017E\001L\203\275SE\3523\321\364T"
+	.ascii	"\217T\234\276\340\323\bK>\263)\350\207zXw%\223\251\002\020\335"
+	.ascii	"1=\371\202Ji\357\207\236\330\255\246\272szJ\327\025\316\240:"
+	.ascii	"\301\320\3513yAkz\242\370\241\274\264\207:\221?\324I\257\300"
+	.ascii	";\233x*L']\244\372L\024? j\002/\325\240\236g\312t\216\340d\212"
+	.ascii	"\200\"\270\204a5Q\240+/\204\263\007<!EM\245\037\312;\325'\025"
+	.ascii	"\251\220\212's\247\302t*R\223\326S]Z\002\n\235\301\025\353\321"
+	.ascii	"\206\n\326\247\340\017\325p\006W\254&\n4={\035vL?\224\227*\365"
+	.ascii	"\200hz\006O'3]\332\361Ru\207\252j\272\241\207\356V\364\367t\201"
+	.ascii	"\003\237\212T-ZUsi\327{2O\354\324\247\023*Q\372Sw*\322\335\251"
+	.ascii	">\355\226\324\224W\244"
+	.string	"\356\316\036\232\246'\n\340.\250:qPQ\350\241\301!\026M\273\024\346\n\"\026M;#\026MM\274\025\370[\3374\242\207\006I(\221`\325\335R\017\rf\024\254\tv\004\333C\203\343\372C\201(\004\237z?\364\002\032\204R\230\030x2\321C\203D?\364\2045\204\036\0324Zy\347\322\022\322\232\236A\025\347n\365\241\353\356\007d\201\246\300&\245\263\007<a\305\212\2420\323\022\320\365g\026\251 \301\0175KH\201\253\231\236\031RHa\2568\362\235<^\b\347j\246D=&\243\236\017\330\244\236i\323\272[OU\351tB\327\240\025\246\357\354\te@\372\001\321U\205^j\246H\201$\364\316s))\205\271bW\024\304\242i\307\201\252\232\301\024@\337\321\212\364D\001\344\235\351\256I5S\036\021Q\322\n4B\205\230~\246\222\212\2520wLO'\316\236\206\037j2\035\251N\273\236y6\231+"
+	.ascii	"\201\276]z\376P3]w\300\224gn\370\241&\223\321Q\nL\323S\303\322"
+	.ascii	"\022p}\342\355v\352\t\023\003\007\351\271\372\320%\f,\232v?\224"
+	.ascii	"E\223Sz\256\275\fg\017x\002\n*tXQ'T\002\247\217\351\027\202\206"
+	.ascii	"\037j\226p\264\236\352\231Bz21\241\251\n)\200>_\b\"4\361~O\246"
+	.ascii	"\257\202\335\251>aPa\372\316t\227\302\\\261\353\235\253\2312"
+	.ascii	"\235\353\017\315\300\002M\315\363\207J`U\237\322\246\025\211"
+	.ascii	"\374\241&S\320\311\373\231(zf\357\302\372\024\\\237\200\273"
+	.string	"\024\270\002\2350\344\365\367\004\344\355|\276\223\267\003\256O\246\206\335\372;Q\365g\246\253\322\252\002\201'vKK\332)\230\356~\250\323P\357<\203\352.)\367\320 \321\251\232g\312\373\241\247\257\207\036\005}\300`z\256?t\267\264t\264Sa:\355\226\226\216V@\203\352ni\211(\005\256<si\327\264\002\201N\352ni\311\b\030Tq\356N\024\351\023o\267\024\364\355~+z\030N\236\231\356|'\212\323W\364\003\242\253\251\376\316\240\023\220\267c2\325\335j\236@\221\364\246\021F\347j\246\273\323\027t2U\241\223\207\2428{y\005\325t\332\365N\337\tSE{;5\203\352\264;\323\2475h\362v\300t\005S\221\232\002W\036\332;\323\340\356D\201\256A\263g\"\255o\032A\202\267tAj6\361\360\351dN\340\364\241K\3004(t\256f\n>`\272\376\200<$\020z\350\ti\323Z\202"
+	.string	"\f\252x@\332\264jU=W3\005^Z\002\203*\036\300K\263z\256fJ\216`\002\ni\223\n\277\025=\240\365\207\002\203+\230gzbg\006W\2423\270bEZ\177'/=\203;\337\272\002\323\246U\202\025uB}\273s5\323\240\263\007<\301\f\256\345\233F\250Kg\257\347;\321\245\235\n\340\211\025x\246\357\304"
+	.string	"\324\335\017\335\255\277\023\305\003\230\200\022X\233\230P\337\022"
+	.ascii	"\312\024\347O\237O>\323\002\253\t\364\221\220\342\374]`2}$\254"
+	.ascii	"&\320\267\004\264\226\346j\216\300KaUM_\220\n|\372\241\353\017"
+	.ascii	"\310\343\260\372\200@\007\354\310\025=\363LIuw\256\346j\"\204"
+	.ascii	"\336\351\204\256\022\254;\016:XCX\237\200\247\023\272\002\255"
+	.ascii	"\353\316\\\315"
+	.ascii	"\021\324\037\020]Q\025\210\202Z\364\024<W\025\233\253\331\303"
+	.ascii	"\352.\303\017\210\256\274\337\023\t\030\316\335\331\003\236p"
+	.ascii	"\366\200Nx}\323\b\325\202\323g\362L\024\035\251x2\213\3267\215"
+	.ascii	"P\317\036\320i\303\201\3013%\261\002\201)\t"
+	.string	"\241\340\271\232\350\375\316R\335\235L?3\005\036Q\360\\M\254\251\271\252@'\323\317LI&t\351\007\\w \254?\364\251Tq\366~&\370\316\337\317l\022\241\211\267\242)L\250x2\223\326\335\007%\326\037\372\244_\242\204\b\036*0\201\0224o\204\272\343\245$xK$~\250\351D\202\227\252$FT\220\236\353\357\024a\375\235N\253\372\364\201\236i\364\277,S\264Md\320(#S\216\231\033\213{r\361P\255l\210\006\307\213\2272\214\227\006L\344\272\354\204)\301t\361\261\225\200iC\341M\013\272/$XP\213:>Z_.\234\\#\212\234!\027\037\203+\375\227]r\f\354$\217\326\\\311F\346\311Ml\354X+\327J\255:UC\270@a8=-\200l\311.\212pT\235\255\321BB\201RU\206K\251V\356p\3231\005\306\305\345\225\362J\211\345FQ6\312\264\227X\364\370h\021F"
+	.string	"s\031\262\236XU\331\367\207\235=tT\342\320\230\261\025\271C\262\254'2\226\240\221N\272\354\330\321\242\234R\306\3106\270\330@a#\022\306\020\323Q\016K\032e\270\204=\271\030H\fM\017\237\261\261\262lI\331\244\nO\221\354e\331Mr\247\322\262\322n\205\346\2503\302\204Z\230H1\210A\246\2202E23\264\3513\025@0`D \225\215\207\311=\023"
+	.ascii	"\003K\212\325\221,\347\234BB3\"\n\222\242\244\220\2155\350n\032"
+	.ascii	"Pw\030U\315\324\204\004\020\032\216d\324\203\224\350\3416\004"
+	.ascii	"\033\314\377\245\244\003@y\242?\331\022\304\367\372\334\001c"
+	.ascii	"B\353~.\354X\rx\370\3031{\201\360\bu `\252\025\300\2561\325\320"
+	.ascii	"WEJji\260\212t8\004\317\276[h^\002D\270\203m\016N\0260>\373\003"
+	.ascii	"\365'"
+	.string	"\251\206H\031\367\356b\330\323@\003g\016\016\323\250\336\233\017\254\311\366}\360v;\001\353\3515\200\331\201pZ\013\217Va\206\207\274n!(1\2728?\220\250\320\360\246\316\230\231t9\037\353ZHku\b|`\332\332'\350\240\245\321\205\313\315V\204$\223\b=Na$|\023L\022\347\271\231b\351\2526\032\004\030\245\277\020P5\354\031\\ \260\213?c]c\316c\036o.*\r\345\351\341\320\214'\273\232\033\333:\220x\361\213\265\304\370\317\366/\360\264!\267\177t\025\355\027\016\222e\005\t\357\334z\330\026\236N\373G\352\263\325\317.\030 H\266W\210\030\b(e\032\023\\\343\275\316\024\032i\215J\266Fp\271\345\327\213a\320X\215\0370gn\315F\212\036\0271\013X\307\2125P\260:\027\034\202\252^\220\263'q\345L5\317Tl\"7\024\032\2168\331ZN\234\204\032\264*\211\336\204\2105"
+	.string	"\0322a\326tY\025v}\016@'\245\367\306\257|3\231D\001\264\255{\240\033q\016\351\264q\307n\302b\254\b\221\352\n]i\200\366\267o+\234+~\361\342(W>"
+	.string	".\341\245\217\036\332\206b(01\303\342\203-\355\242Z_N\374?T\225C\037\267"
+	.string	"\n\331\313\2436\320\271\202\204Z\341U\231\263\213\177\230.%\013[\217po>\3039#n4\f\275;?\357\226\n@i\261k\300\367\244T;)\206n4\033 \377\312\322W\300\371\260R\336\231.\276\340-vKw\024<\235\240\345\270\027l\220\204o\004\253\312\020\337h^}\023&\317\236\366\031\353o\247\266\035\363F$\225w\0175\345\347(3\253R\016\031\027@\2163\267\364U\250\305DLD\300}//9\036G\305\374\204\300\020*b\240\001\t\312\207cH\302\027Fy\026\"\323@\345*\356\216\327\225\372\222\244\226b\360\233\257\200e'\344\362xZp\325\177h\340)^e\034\266\324\211\254\301\203\322\274\272\303zC\267(\024m\353\234\004`\256]\311)a\244\313\007\310\315\027\244\341\3477\007"
+	.ascii	"ktx\035\273\211\311\301H\304$tJ\203=w6\371\004L\026/\201\311"
+	.ascii	"\025y\301y$\324\230\272-|<]\304\343\201A\211/,\322\247\314\341"
+	.ascii	" \375\224\205f\024G\221\322[\317\361:]\004\017(b\004 \034\200"
+	.ascii	"e,\0268w\366=\237\321\234\216\222=\322\246v\200\300\203<\227"
+	.ascii	"?_\362\351\357~\206>\345;\016\204\330\312\004\215\026q\223ya"
+	.ascii	"\260'\251d\340\211\320R\263\013\016T\347X\315\213\236\022>Y\033"
+	.ascii	"\346q\345\0018H{Y\2068\371kR6\266\271o\321\270\210\263\243j\215"
+	.ascii	",+/U\246\322\373\261+\337Bf\bz\265mU\025\362*}\320\226\217\025"
+	.ascii	" \311\007\312s\313\b\177x\272\020\025\354\025\372Tm=\200\257"
+	.ascii	"\217\336\330\252\353SX\261g`\320\341\223\013\030\306\213@\316"
+	.ascii	"\331\220"
+	.string	"H\277\371\202\013\2123t\246\347\2104\331K#\213\347`!\315R\b\241\371a\232\360\036:\247\257\224\201\353\022QN\276\030\325]>\311\350\335\252\247D\031\266+Ah\354L#\bF\207*O\222\243eo\346,\214\241\221\222R\375F\242*\3321\034wL6\003\002j\031\352\306vJH\022\266\003\345'\264U)\242\240 \324\317\310~/!\024\255>\372\226m\021\313B\335\374\320\017\353d\303\343\337^\3271'\031L\272\202o\263\305\003\245qi\277\321\244\361\350cN\213E\203<gN\"\353&\246\304\334\216\237\036;\211\225\0139\360\0326\030R\360\222\235>\261\314,\027g\364\177Z\026c\223\2554\220\256\\\221hP\255\364\004\007\220L\326\005y#K\334c\033\370\267U\325\303\017i)\245\354\226\324\253)oU&\241ud\301\300\311@5\024paw\2257\315\033\026<\216\342\337M\251\215uk\352\217\335"
+	.string	"\371$ \342@\227\037H0;J\337\003\200\324pQ\363\207O\311\227\362\021|\325\373\034\2332;\342\310\276\211\0330\346\274\206\262\272_Fq`\260L\254Zn\244\270\320\346\242\367\016\237\340\316"
+	.string	"\036\213,,j1\333b\230+\253\027\361\327e\263\264,)\202X\252\372\272\227\373\221\335S\250X\226\254\025`\276\247\2565{\265\037s\333\332`\274\037l\226\330\377,\257\t\006\005@\214\017~\327b\256\022u3\tU\313M\f\026VQ\317T\302`\374\374fKO}\0367G%S\022\305\212kJV)\366\343\302\344n\270U\252"
+	.string	""
+	.string	"\2316\354\005,\0346\221\377\253_\r\005\336\335tI\324\002\220\330\322Y\027\350{\214S)V\376\030\300\331pO\307\275\340)?`\313G3c"
+	.string	"\021\320\222\241\337\241\241\247\026\263I\216\214\211\rQ~8P5i\246\026\276\240\240\234\230;\021+(?\336\350\363x0\363\301\007\374\b\222\341\237\260:\b-\201\327\277\335\352-\177q\256^\276\002U\350\tg\371\311\211n\341\270\302\260"
+	.string	"\275\007\217\361\321E\303\212[\362\016\231SD0jq\340\241\317\344\333\313\337I\220!\004\020\006\003r\005\331pcV\0043\016E|\326\310\252\346\351B\304\262\212hE\343\266\b\017\214\333|\310<\316*8\232n\224\324\301\236\f\303\213\375\033\213\021B\342@Hk!A\032\0300s\334>\265B\202\177A"
+	.ascii	"\002\022\003\247\313\034\264\033O\374\360"
+	.string	"\nm\332(\221\303L\024~\263\034[\330D\3736\361\273\331\bx\201S\255/\352\332\243\177m\032\241\335V\322j"
+	.ascii	"\217l\343\350&+\371,$\320F\2455\231r\01362fx\322C\245\034\273"
+	.ascii	"K\246\030\nJ\361>+ b9\\\275fLh\334\027\305C\322CL\f3k\026\321"
+	.ascii	"Z\362^K\305\034$\204\303\362-\277\027M%v\261\357}\364s\322\342"
+	.ascii	"\244\213^C\263\030v\305\033\252\223\b\261\354\250\326l\027q\336"
+	.ascii	"=\217jZT\2307\302\"\206\036\007#K\213\320\272\007o\324\260A\352"
+	.ascii	"d\3353Fc\270t \006xW\026\363\030\013\002\203\230\253%\352\247"
+	.ascii	"\242\002#\312\345&\n\336"
+	.string	"\232K\331\005\335\247\272\310gCi\226\216\335\022\216\027y\257>_\361\331\322\317\276\013)\357\276\346m\261\032KfJ\236\331\263\005:\327\373F\316\270l\037\352\305\245\235\003\242Z_Q\325>~\236PW\271Kk\363\240s\352X<\240\313G1,sDY\270\222ff\346\253\207\305d\260$\005\342\313\354\241#\373\313\025\305\245\027/\204\247\310\354\b\340-\310B8\353!\375\335\370\rl6\f\203L<A\360;E^4\024lJ\362s\031\214\340\313^\262b\2645\275\321!3\334\340\370\370\352v>\301K\351%$\302\013\260\223\033H\0378\360\213'\304\217\322\354f\037\251\373\005\320k\272M\365\204|\243+\"\274Mn \264\231\t\334\225\372\207B\235\266\273;`1\331YR\261\0310\232\013\205GJ\346\251\307\237\240\314\0079r\025u\035\210\2648.F\310\231\001\026\030,\340V@\373\017[\202\256\320\276\301"
+	.string	"\3763,\347r&\004\346\3442\237\213\312\205\331Ur\211\n\203\221\206\004\255\311V~\330\330g`\354h"
+	.string	"\007i\244\304\303Dn\254\226\233\222eag\363`\354\002L\257\201n#w\032gxY\310g^\335\251\316\237q\371T0d(\016\261\016/o\th\327A\352\273\226\227\303\277\217p\024\260\230\225t\236S\364\324\031l\315\326\257\362\266\336%\324\277\273\352x\245m\225\037\300{\240*y\336\200l\225cv\250%\321*\233\021\023\367p\370A\236"
+	.string	"\262q\274\225g"
+	.string	"\344\277,\235F\244\n\017R\005s&\031\322\374\303\220o\247\216SK\211&G\266'\312\211\253_\315\b\t$\333\264h\314\254'\375\352\204\212\2415\344\220\205=\177\2752\310\370\312\237\033m\352\231\310\222z\304\263\030L\354\021\233T~\361\204\264\355Q\376M\331\225\264\331y[Cs|/\013 \356\020\006\353\005P\237\327\313\213$r\247!\364Z\310V\2209mk\371\316\2107\273\234\366\373\035G\033N\271\202\373\007\337\356\300\206\253CV\327\365\333\006\214|\322\345<\233\271\271\224\275p\021R#p\243\340\204?t\301\315\252\262\t\247\366d%\372\366Z\220\tZ\241\365\020p\b(\357\275\333/hu\335\371\323g2\316\200)\025\020\326\223gk]\237\207\032!\337){'\344\354K\326\201\356\236}H\354\230\022\270U\037\004\340\fFl\321&\274\330f\246\372\211\350\3205"
+	.string	"\347N\232\272XP\241\201\356?\250\321e\013\032\273\027\323\230\360\332\027\202\270\033\250\023\236p\247\023t\367\351\264\226\304\332\032W\342\276<K\331\233\225\241\326p\300\235\273\352\n\3404\223W\266c\371<\354"
+	.string	"=\033n\370\305\341\221F@\244\036\242\275R\205e\036\2447\017\207V\345)ev\270\021)^\031h~\265\235x\202{\006U\2512+\334\371\326\f~\262/\260\001\213L\200lD\345\267\231R\252\345q\216\272B\355\034\201\366$\365\374o]\002\327bQ'\302\336th\212\240{C\374^\250\253\360\204\355|\337\3152\036\270\313\340\313\305\217\022\032x\267~\206\2237i\374\221\363\025\202d\013W\322\211\366\310\236X \342\301\341t\305 \272\027\341\352E\3737\273\356,\261\335\2335\030\237\336\336\342\036\313\b\277M=\363P\3650\013\234\027\313n\220\224\222Z\022MqY \200\244\027\222\354\354\201\347\371\225t\333\361O\206\372\025\347\270YHn\265\234mV5"
+	.string	"j\027l)|\002?\210\214\272`\206\320\317=\003\374\215I <\034\205\n\301\257#{@\331\023 q\242\2054`\232\301\201\345\026\340D\262\0010\305\300\255@\023\341#{\037\222\033e\302u9Y\351\276$[\034\371JR\222(\362\223;\241<R\203\320\377\"F'\026!8\202v\266\233\023so_\277\016\002<\236\340\036\001_\374\217\332\207\322\021\201\216\202\267\024dE\366Y\236\256\372\340\316\260\337\331\340C\303?\266%\267h\372*\020\037g\362WbfJ\346L\313}6;\373\333\256\235Q\300\315\343\301!\344K \336 s.18\022e\303\021]\r\306K\344St\353\rC^\001\005nqg\210\271)H\333\024\3535\223\257"
+	.ascii	"\f&\336R}\002\315\217\272'\320]\322\376\f\321\320\371\221\306"
+	.ascii	"\273P\356\241\365F\025#f\237\2534\267\227\366o!\273 y\203\356"
+	.ascii	",\030cp{S\347\177\275=j]?O\030`\274@\021\027\300\322,c0\305\304"
+	.ascii	"\221\0160~\201\335\241\370y|\216f\027\370\346\305\323\033T\337"
+	.ascii	"n1\234n\357\320\006Z\330]y3g\247\236\035\306t\336\271\332\276"
+	.ascii	"\325Q\225\355\n\313\216Md\321\303\351Q\213\2335\217\213\373\363"
+	.ascii	"u\343\350?\221\262\231\212\356d\232\267\365\271\357\366)fN\343"
+	.ascii	"\315\362\264\354.\257b\311i\024\231Y\366Ah\351\260\374\272\362"
+	.ascii	"?\376\237\250\267#6\255\200=#\177i\023\237\325\317h\177\332{"
+	.ascii	"\273H\273Z\241\272\002"
+	.text
+	.section	.gnu.lto_.symtab.7bec5dcbf36173cc,"e",@progbits
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"pidAudioPositionToModeMap"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"initRcRateCurves"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"rxGetChangedChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7bec5dcbf36173cc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1362 @@
+	.file	"rc_controls.c"
+	.section	.gnu.lto_.profile.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"-\007"
+	.string	"\244\t\207\001"
+	.string	"\030"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\302\374\277\243\n\004\002\001\002\002\003\240\342\234\212\n\004\303\375\206\360\n\020\002\003\002\004\002\005\002\006\002\007\002\b\007\005\b\353\361\305\232\007\\\003\002\003\002\005"
+	.string	"\002"
+	.string	"\003\002\t\007\002\007\002\n\005\n\002\n\t\n\013\f\016\020\220\237\222\215\004\002\021\367\372\342\307\013\004\002\003\002\013\023\344\371\276\347\t\024\326\352\245F\025\026\253\262\211\366\t\027\333\314\243\214\005\030\031\353\227\221\315\013\032\366\336\365\327\f\033\034\240\342\234\212\n"
+	.string	"\" p\202R\311\016\310W\336wt\372\261\036\254e\310y\214M\322r\221\036}YhvK\322\231\021\3216\030p\260*\346A\030\002t\t|\004[\300{"
+	.ascii	"\201\303\"\260\276Fh\255\005\374\031D\334}\263\346\302]\310\205"
+	.ascii	"s\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375 \204\265\001"
+	.string	"\350x"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\b"
+	.string	"\001"
+	.string	""
+	.string	"\020\002"
+	.string	"\003\021"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\n"
+	.ascii	" \007\327\240&\fS\365\305\264b\327\335\334\215\025&2W\201\001"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375`M\001\335\006"
+	.string	"RI\036)\2205I\007yy\252\370\324\347N\227\36390\330a1\212\261\302ez\217\375\rv\027\322U\356\231+\336Mk\315\223-e\n\3777\344QN\300\335=\033\312\260\274S\262\352\356\230!\376\317\3427da*E\3420h\325\347d\217\004\202\006\017\026C\373\251\202JD"
+	.string	"\321'\303 "
+	.string	"\b\003\207\327\377\222\f\262\337)\347\266\350\344\356\234{\243\345\025m\237\221\335\335\255_n\", \300\"\233\252\016R<\300\375\200\031L\334-v+.\004h\325\366V\246O\"\271"
+	.ascii	"\016\006\t\340\270\336v`\270\006\005\fJ\035\214\013E@\\A\335"
+	.ascii	"\200\r\t8 B\204\203\376 \217\021X\204\021X\350T#\017\273$\314"
+	.ascii	"^\341:3\222\336\221\255\205^\360p\007s\274A[s\253j\306\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"}\006"
+	.string	"\022\t\033!\220)\351?\227a\356\362\246\334\335\355\231\350\337o\373\367\367\376?\022\373(\310G:2\264#!2\311$\371\217\007JW\240k\371\n\206| \235\224v\226eD\363\303\326~\256e\354(qmt\235q\253\324\224\\w|\343[C\367\320u.\312\222\204/\334\316H2\fhX\303\216V\215Y\265\311\254\270\226TJW\372\222<>\t+ \200\202\t\326\030\017U\2411\fi\322\230\320\372IlN \263\201\254@\250\2342\213\344zG\272\337\241\223K#\003C\204`\235M\201\027\034Q\027{\030\205\231\030\220\007"
+	.ascii	"3\005\033E\326\rP(\036\271PR\205\337\220+\\\344d\244\326j'\\"
+	.ascii	"\020\202\2569L\215\031\255U\311\221\257+\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\230\004\b\230\004\020\204\004\021\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375 ~\225\002"
+	.string	"D\003r"
+	.string	"\005"
+	.string	"\001\002\026\001\002\001\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\027"
+	.string	"\001\002\030\004\003\002\031\001"
+	.string	"\002\032"
+	.string	"\001\002\033\001"
+	.string	"\002\034"
+	.string	"\001\002\035\020\002\300\007\200\021\001\002\036\001\f"
+	.string	"c\020\002|`\005p\340*\254\0075\001%\b7Ga\336\335\331"
+	.string	"\026o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.54515062f3bad4e8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.80.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\315\321\025\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\335\007us\357\006uq"
+	.string	"\005\001\006'\001\005\005\001\006\035\001'\001\031?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.82.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.86.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bj"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\326\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\002\005\001\006\035\001'\001\220 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.88.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.92.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\361\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\007us\336\006uq"
+	.string	"\005\001\006'\001\016\005\001\006\035\001'\001\032?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.94.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375 W5\002"
+	.string	"4\003J"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\001\320\017\350\0072\264\013\352\376\n?\202\210\2008\177}\301\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\007"
+	.ascii	"*#\300!\314\306\2004\225\313)V\017\240\b"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.95.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375 \347m\006"
+	.string	"\022\314,3Pm\222\016$\243\252\022\252\272<\\\200a\300 K\310\244\226\177Kv\325\376\335\016;\273s0'0\210\235\231E\024\321w\200\007l\006\317\262\323,\3312\005\273\314\246\341M\034\315s\bnjn\241i\030\022\034\232\2336-\203\371=(L\215\363\336\324.V\226\215\220\t\200X\304\027\244!\324\335\030\242\203\255*\335\016@%d\001\025 \274\336\372 \303\370V\222\215~\034\231\245\343\004se\206\256\2244\221J8~\317_.0\360L\325\322\b\365\202DB\004%\323j,\243T\221\272\375h\305\303b\244\022}\212\226\203\314\034+\021Eg\375\007~\202\177\"\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.96.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375`5\001%\r"
+	.string	"\006\032YA \217\223\016\310Ex\316@l'\fc\376W\3771\033\241*F\230\213\315\fR\244\346r\214}Xc=\f\214\321\007\311\226#\024\240\n\001\b\232\256\340\304\017\036\0022\275\202\315\332\267\204\354\235dJ\001H"
+	.string	"A"
+	.string	"F"
+	.ascii	"\036@\371\241\005P~5\340\351\307\033\206\026[ !2\311dn\326/\370"
+	.ascii	"\343\347\216\237\272"
+	.string	"\002y\033(\264\030i ?\tv\034\r\002\036\200\246\34262\323\035\214,Z\nb\005\222\231\305\221\026\301\245\3346A\333\002\255'\004\265\313\314\354Im\261\033\277\330\031\307V\016K9\354sXw\354\035\026\035\326\234\312%\205\306\212\314\226S\214D\361b4\264\365\264\234\266\307\326.\346\340\361\313\203\276\314\n#Ddn\036\345\320\370\005\b\247L\036\006azG`\314L\320_:\276\200)\241\2020\372\273{\305E\306\177gB4\343\343\255bE\246\3550LCh2\363@\355\301\037\034\324\031\374\332AA\217\374j\024\312\317\327`\021\023\302S\273\201\360\245\006#\n0\222\020\023\221\252\327G\247\001\226\235\224`W\310\225Y\327\002\253\204\201\b\211ue\035\353\203@1\223\221\314:\301\260\314\342li\227'\025\035\207\361\035\256\316\322v\363\215\320SZ}s\213fBx\242\336K\356\356$\352\356\304;\025\031"
+	.ascii	"L\204^\350\206\0275E .\210\001n\300n\025l\001e\300\270l\220\003"
+	.ascii	"r\345\020\214G 1\261^\202{\025<\244\272\200\270\346\300\312b"
+	.ascii	"\203\017\201h5\344U\205\253yo\273\212\036"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.97.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375`\262\003\325\027"
+	.string	"\306\352\226J\300\324Q\007y\2273\004fDW\202\022\250\216W\2035zQ\365\231\217\201\267\004 \227\272n\247\334<\030\373bC(\246<,\336M\202\366X\32545\r\034\005\020\032\315\365\352\330\265E\365m\341!cd\357\275\267\2242\245\224\002\202"
+	.string	"t"
+	.string	"\211"
+	.string	"'\222+U}%\230Y\207\231\344V\321J:,\243\274\"\334\330\333\341\263T\344^\236\251\322\245\355J\273e\273\276\210\22659\212!h+}\227q\217\270\235&G1l]\017@\n\332\340`\317<\264\245+C?\241\326\021\324\201\226S z\220\270\036\257>\224\205\253Q\225{/\211\343\361\247+@d\fi\035A\034hy3\262\265\256\375\007Gs\007Y\356\275\3546\234\206\346U3s\0233\2570\377\211^\366\214e\256@\343m\363g1Au\321\021 1\2361\330\376\t=\0365?\302\243\253\334\256\261\314\260\013\336\266\376\326u\0031\321\220\252\375\0163\217\346\237c\356?\317\363\344'bf\347\262:\247X\347VuF\241\316'\325\331\244:\263\252s\211u^Ug\322:\217\325Y\244\316au\006\255\263\255\316\225:\323w~wvwn"
+	.string	"`\325\224\200\247{o\0015Z\240V\337NT\273\361I\005Mc\306\370\005\250\302\027}2\302\007M\0201\342\003?\327\035B\bP\317~\216\301\017\275\237}pA?\265\300h'\006\r\\\\lW\373\346\210\035\375\372\355S5\363\323\325/\034\204\367\336\003\334M\355\342\001\204\227\227\257A\206$\371f~r\325OH\2516\214\375\367\024\314\021\272\005Lxo\315"
+	.string	"7\213^\222\300M\242+\307\310Tn\231G@\265\233\371\3113t(\212\350\347x\355\037c\005\374r\341X\200\305rl`\257\230W\314|Q0mhdj\314W\f\307t\005`\330\315L\314\314\201\301b&\311\233\365\023\361\315\212\037c\267\314\266\256E)]\224\345\226\331\362\177\230\271|f\231=\215^\267\001$d7~\216S\036\3453\264>%*G\353]'\217\202\343\306\311\327\251$I\016\305s;\022M^|\026R\357g\362\004|\364\f\321\374\354\362fd\013Y/~\033\365\242J\236|\326\2039z\216h~\362\352K\022tH\250Q8$\031b\250\2102\222\322\202\264\001\240\002\031\251\3329\020PU$SAZ\016\317aT\2524A\332\006\t\b\2443pM\360~\324}\036>\262Ry\212:\272M\034\253\231\236\232\333h0\372M\273\236\003f\303\311\323\035I\3302I_["
+	.ascii	"\307n$W\006\207We\222m\200\202\177\024\271\004\266|p\005JtM\033"
+	.ascii	"6\356\001A0j\316\351\003\224\360\036\317\007B\030 \255\347L\247"
+	.ascii	"\0215\333\213\337\242\210\255\\\366KE\030S1D\330\241\244\020"
+	.ascii	"\330\006N\371\026E\272\276\336\325"
+	.text
+	.section	.gnu.lto_processRcStickPositions.98.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375`{\033-u"
+	.string	"\272\265\344(L \016\333\031\003\027n|k\232,\353\227'\242\377\354+\020\357\303\314\215\020\241sb\225\204\253\372\301\206w0\227\027\373J^\340\307'0\270x"
+	.string	"\202\3211wc&\354\354\353"
+	.ascii	"\002\220\035Z\324)\212s\322\036<DD\210\224R\246\224R\211\002"
+	.ascii	":\002\217\002$\306\220\211E\203|\031\267\327\204j\f\357\224\305"
+	.ascii	"k\322V\272\253t\257u\353\254\257\376\3562"
+	.string	"w\234\025\021\214\264\334\336\257\020\352\264<\245\272\215\373\215\221\334T\332\215\331U8\257\230\365,\312\3051!|\337wD\261Y\243\366i\233][C\333\2547\033#9\252\004\263\327\260\214\262\334^\023P(\231\256\035\276\257[S\263\334Tl\226\231\314i\332-\311\333qa\\q\207\357\373*\037\t\257\275\2725\027\235\331L\307s\234\205\2610\013,\307W8\216\2550\034\277q\025vc\261BE\212*\024'\250LL\225 !\0255B\204\022\352\311\251\211i)\204\022\210\017IH\036\216\214:\024\021q\030\022\332\020\004\364\343\323\243\201'\303\216N\016N\022y4\026\335\226]\337\231\334Y\315tP\266\346\364\262\244\035\301R\200\331\020\256\273\037,\004\021\002\r\023cY\356J\234\225\0368\267E\217\346\267\225\253\354\340\341\354)kz\265\274\376(kv\261\354\306\241\254i\302OY\263\004g\021\366dE5\321U"
+	.ascii	"9\222\0021\006\257z\323(\336H\237n\374\004\033*\037OL\260_S\207"
+	.ascii	"i\332\235\347\013\355\316\223\272\226`\262!\261R\325\275w\256"
+	.ascii	"\264\212\326\322\347\240K\241q\301\243\250\\r#\004[\204\240\031"
+	.ascii	"W\3765\324_\030\177:#}\372\271\023\bO\232\372\230\326\016F\206"
+	.ascii	"P\033\360\tf5\342\233r-}\t\341\205\317\225@(\261q\311}p[$\325"
+	.ascii	"5\022\240\207\225\211\254\357\207O\013E\006[\372\314\342GX\346"
+	.ascii	"\334\210\216\005\357PG\305\213\352\332\234h]\232C\214k\300\247"
+	.ascii	"\335\372\263\202\326\224\226>\331\234\203\333\202\255"
+	.string	"\t@B\306u\367\243\254\210X\017\tM\351\rR\324<h\n\3403\212\003Mi\342?kT\226/\273\006|\256\2558ii\244*\270O\317\022\327pg\346<J<\303]\n\276s\327:\200\317$\253\221\3649\304s\244O&\200O2\307I\036\225\201\2155re\"\334\302\246\001\237c\253\217\t*8[\372\024\342\307U\212\204C\261\006|\212\255I7\\c\232\255\217\244\317 n\\\223\201N\2024\3403l\225\n\243\013lz\321mq\004\f\332.\220n\271V#\367\372\332r\366\204^s\276HX\215\336\367E~\351\360\357\267fRbf\215Z\006\006mw[\274\357\313\356\374\002k\216\321\314l\0363\277`\376Y P\006>\347\035\221+\3215\203\363\f\274\033\327~\215\363m\346\313K%l]\220\202\206\374('\337\370nV\241\030\277\256V\221\237\374\325o\213\354\003\350\361\221\037DfKJ\221\373\364"
+	.ascii	"-s\001\007x;\217o\234R\317t|\026\027\337\330`\232O\006\b0`\264"
+	.ascii	"\315\026?\024\376Q\241Z=}\205h\216kQ\305\017\275\327\320\273"
+	.ascii	"O\003N\220{\257\275`q/a\017b\304h\233u\221\n\377\324\240Z^5~"
+	.ascii	"\224]0n\367(\036\346\205\361\246^\361^\274\272)\276\331\272h"
+	.ascii	"\230g\347\334X\255\212\367Z\361\312\023\240\300\235\321\341n"
+	.ascii	"z}\337\367-\276\265q\311^[\333<\236W\266\352S\274\027\263S\257"
+	.ascii	"\370\356\361!(ya\213\254\351Uw\335\232\250\255\372\346\361M|"
+	.ascii	"\355G\271\227\354\365X{\307\217\220\227\246\352\275\332>\366"
+	.ascii	"[\005\032o\013\373F\251\237Z\233\026\373\321\267\211\332\035"
+	.ascii	"\017\201\231\034\327\217\246\013t\002]?\312\353\373_\301\205"
+	.ascii	"\321\341n\370\177e\240\355\032(\276\257\216)n\272\256{ \202\t"
+	.ascii	"&h\233\375\377 \330\326\357\337\\\211Z^\325\352,2\212\357\373"
+	.ascii	"Rq\263\320X*\340^\322,[0\303\333\331,\367\214\266\331~V\272G"
+	.ascii	"\305\323\362*{s^\253\342\333\353\373\255\221\n\367\232e\256$"
+	.ascii	"6\275\372at\201h\377Qf\267\246\277\221@'aZ\370\2150w"
+	.string	"\017\036;\332\353\350LA\321\231\201\2433\214\243\363\213\256\322\274BE\212^k\256r\235Q \235O \235\251\\g\023F\347\251\243s\211\2433\211\243\263T\3229*\351<\"\351,\342\350\254\314q\206\302q~r\235\235\222\316MGg\246\243\363\322\3219\004\216\263R\322\031\304\321\371C\3229\311uFr\235= \235\217\220\316F\256s\207\243sQ\322\231\310u\346\320k\315CGg!\243\363\206\243sP\322\031(\351\374st\366I:\367$\2355\270\316<H\347\fH\347\035\327Y\007\351\234St\306):'\213\316\310\242\363\261\350lt\235\213Gg\267\350\334\032\235\331\242\363jt\376\242\263\273\316\335\317Ldc\336X\037\201\207\206\306/{\203NUJP@k\n\321B}R\205i\207h\237\036\352\207\020\237\276\035\3629_\314``\212j\031\255\323\177\031\234\337\232\323\257\020\364\242\022\324\230-5}"
+	.ascii	"R\232\236\344\362\256\204\bQ\004d\372\020\036\205\351Y1d\324"
+	.ascii	"\342\232i\306\224\222vU$\262\266\035 >\264!B%LZ\301\350c\257"
+	.ascii	"\373\254\230!\365RM\273\364\311D^\302\340hK5\336\304\317\226"
+	.ascii	"k\226m\226\324%\265mv\351O4\367\324\332<t\275\361`\3646\263\253"
+	.ascii	"U\372\030cP\340\004\001p\346%\342\262\352\355Tz ;\277)\217\031"
+	.ascii	";r\004\342[\312\242\311$\301\333"
+	.string	"\t\342\177\354\370z\354\276\364q1z!\370\341_\244\360\341Y\214%!c\203\366h$>\272\254\177jG:$E\223>I\260\215m\205tE\336\325HE\220\236U\323\205\007\221\f\224\350\005\261\352\224X\021#\034\206>\312\314)\234\335r\236LS\270Q3\273\274\230<\332\210\232\247X\t3\206\036<\310\321{\370\304\255\266\321\032\375Q\2077\002\322\341].qT\256\323\314/\037\314\023r\300\204\276g\256\332@\330L7|\364M\303p\323E\017\303\277\212\336\005\254\252\345\370\323B%l\fZ\036.\030\342\241\2417AS%\210\350\333\215{\021}\222`\273P1=\200\324\264\214\226\203\227\300\341\331BD\265\034\264+b?\177\215\325\016}\007 e\254\324\tR\361!\341k3\303\2040\307~\346\370@\244\351\321\363\215\325\n\275\023\020'pa\204\\\253\033\253\rz\241j\020\225\327\264\320\245\001\350\223J\206"
+	.string	"};\346\355\302\033\030\317\317{\240\262\b3\352\355\374\371V#\322\374,\026\313\0365\303G\231\250\245\300X\006w\246\211Z\237\247\340\331\271\240T&\022\237w\001\327\250A\225R`\246\34111a6A\266\355(93\323\t3\315\333\3119sS\246\315\317\342\316kC\254\016b\270R4\207\206Z^\335)\364\322\245\323\363WI\316\315Tk\231\231S\230l\336\316\236\317\231K\233\352\370\254#2g_9\037\345\301\326\3604\340\316\020b\300\244\342B\303?\330 \025:\364i\212P\210B\306\206\363Q\306\240\345>\323.`\200\303\205\213\266Y\026/0\212\241\214\266\f+%sh\310[\364\216\210I\362<\231v\026fx\236\235\317\371\f\337[d:\277#F\347\215\0013rd`%"
+	.ascii	"\016\rl\\9pe\225\303J\203\033WV\031X\325\2501\003\310Fs"
+	.string	"\240\201\0039p\260\\\003\nG\0067\256rlp\243\206\0055\256\2245.Pn`c\206\006\312\032W8\224P\034\370\006\007VW\312\0347n\\)\221Z\335B\353\233\374(t;\"\002O\177b\235\324\363\203\361\205\254\223z{/\234\270@;\251\267\345"
+	.string	"\263%\027\266\351\007\351\037)\323 \261D\003\206\360\277fc\354\210*\234\275D\204\260\273\031;\3730\3666^I\316\036H\357\320S\233ny\"\365iX"
+	.string	"\321\222)\031\333\377P\242x\260\023\217\302\241M\365'L<\325?M\274{\202\\\235^\230\r\177j\262D\363vr\007hD\224~N\b\340\362\372\221\370\246\255\206\f\360Q\035N\276\353G\f\211m5F(\300r\213\315\232\266\032;\243\022\006\360\321\226\221\366M\031Of\230\227P:n\251\006\"\311\373\276S\315\342\0301\214b\250u\330-\204\360\220\020"
+	.ascii	"\021\326\367-c\021\327\031\b\337\3244\267\310rDd\033&.>\372\266"
+	.ascii	"\331\035\306\300\216\310vGew3\245\356p-\n\033\3666\r\245\270"
+	.ascii	"\300k\347e-\212\241\225\220)\225p\313\023\231\206\257\315|mS"
+	.ascii	"\367\225\216[\262\365$q2/\251,\253\304u\357\340\002e\272\365"
+	.ascii	"Y\\\325\345\257\305GY\251\335\360\255\324N\375\006\037t4K\270"
+	.ascii	"e\334RN\256mv\352]#\203j+\220\351\302\002\013\027\037@Z\006W"
+	.ascii	" \t\212V\351\236\270\251\230S#\3247\226\002Hc\265%\236F`\211"
+	.ascii	"g\215\354U\325\341\355A\215a\202B\257\261Z\022\037\0245\203\023"
+	.ascii	"\364\274\356\023}\205\315\257\035O\215\312)m\257\035\017\315"
+	.ascii	"\204\004[\226"
+	.string	"\\\360\306\034L\363@\247Y\216\310]\006\314o*\f\373_\030\261\263\227\b\037{\237\337\216\263\367\365\302\376\205\323\024\3377\253\311\230\217ew\276]\320\263\227\310\273\344z\334d\356|\227\214H\360\304.$\336\2018\252+\226eM\211<f\032\342\264I\325\347E\342\243\f\246\261Z\251\177\251\026\251o+\177\206\213\233T\324\323X\243>yGu\363\216T\243F\354\361\211\030\321\200\257\275\344\363[\376y;G\274\216\027\345\262\005fZ\316\035\025\316c\363\006%\"\001\357\267\227dZ\346e\231\245\240\267S\304\347x3\245\022\276\360\246f^\242Y\276p\007\305u\234\r>\3555V\253t+\312\017\202d\250\022\3510\021\343L\251\241\021\221\024$I\2411B\013\020\bca\332S\352\001\022@D=K\204\316\\\215\202$\225\264\006\370\322g\035\021\025\354\272\215)\341\033\023\021~\260\256\257\325\2679\007\222\304\030\017"
+	.string	"\225\020\033\263\211\360\255:2-\r\252*o\004\330\203\034\214I\315\240\003?L\222?\n\205x{\307HNko\326"
+	.string	"\2611\257\237\227\352\0176\204\315\364\212&\370^fb\203\2669\266\346\032\204F\304\222KIh\312\361\234\367W\344\326\217\261!\334\336\215~i`\367\201\237&\222\256n\343d\271\262\340\312\353)@b\333\256{:\257\243\030\220\006'\001\363\341J6\030\024%\t\320?\237rO\275\265k\3513\250\340;\331J~\025\214\253E\001\206dvA\322(\t"
+	.string	"\003?"
+	.string	"\216\260\224]j\245\231F\217\335<\217O\r\301\212\231YT\002I\001d\\!1\357B\275\340\255\266e\307^\225\013\251\232\020\306\304\365\020\315[F\036;\006\242\377\241F\303\221\204\262\033\021\006f\215IP\025\f9:IO\22112\306\250\004\324:\242\220v?\306\031\005\260]\353\341q\r\024q]\023\247\361\312\301\356\221PR\342|>\240$\372\270\216\362\377>\336%\341\330%\004L\265\240\017\366A\032\006\364\272\024f\345\270&\316[\243\2632V\216e\261\356\353\315\245\310^\271\\"
+	.string	"\242\f\315\225\202\3237\025C-nL\202\2301Q\033\374\016E\221\363w\315\200\0374\251\031\342\022\327)<=1\030/\004\273\n\204fnR\3147'\362\207\221\265\035\305\263fKv\006\2456\332\301X\200\372q\300F(\230(L\177\366\271\207Wh\030\001n\037\330\231\341\240\225.1jD\276\214\377\273tN$\036\264\243\022\242!|\222\\\020\265\003\2629\313e\215p\"\277)\252\002\364\316\321-A\205\016\327\005\265-\245a=\307\003\b\375\013%\310\254\237\2420\214\327\307\034\220\253<\257M\266\233\226N\030\275\2061\220a\360\354\214\352\272\267\333\303Y\260\025\247\")(\3011\207n!\341\326v \210\216\240:n\231dpEu\344\t[I\224\232\312\371\333\027v\342"
+	.ascii	"\020@J#' Y\333X*\220\257\241\017\242)\322\232\221@\255h\232\206"
+	.ascii	"\330\2723\342\257\302qB\315\311\362K\210\360\272\007\227^\325"
+	.ascii	"\020Z\036\277\303\001X2\006\273\250\002\245\330\337\220\314l"
+	.ascii	"\2712CV1\372$\315K\271\316h\\\271\2103\3058\334f\b\005\023\274"
+	.ascii	"\243\222\371\3273\345wT\361z\373J9RE\334hFfU\t\265\210b\334\320"
+	.ascii	"\215\031\210$/\013\005t\360\023m\220^\257\300\302\2151\311\267"
+	.ascii	"\374NY\331\220\221\031\250S;<A\325\204\343h\213\236\200}\302"
+	.ascii	"\353\301  *\004\231\362\304\205q\342uG\361\224g\300\207\354\334"
+	.ascii	",d^kK\367\273\3419\367\023\370u>\324\223\315\265{\334\351PR\214"
+	.ascii	"Z\255}kcj!7Q~#\342\242\352Z\247\215a\202M\366\n\237\257i\304"
+	.ascii	"\303vWU\025\341;r\257V6\322\"` "
+	.string	"J)\320\355\210&\203Z\327X\224\353O\366\2118\215dC%\345\310\325\366\005q\302m$\237\3646b\001%\236\330h\301q,\235\255p\213\262[^\310\036\016\306\212\221P\361\\\034\f\203\023\357e\241\343\264\361X@\370: UC\211\027%\2519g\237\035\201\270y\300\026\226\373\231N\004\r\020\303\201\024\212\222\214\245\377\\\214\022\340\026\246\0328\356v\232\256\037P\234\257\016?\217%%\354\024G\034go d\230#\334\320XT\347kE\266\327F\263@B\311\303\267\357\235\337\024\232&\233\005\365\220\371zk>\003\320\212 \261s\236\263\365+Es\206\255\202\r_\255\246\303S\377\315\033}\032\374(\237*pwn\224\237b\344_+\210g\270\303\\\2111\361\007q\215\301ad\rcB\350\302\301)\b&\342\203\232E\0210\244J\034\025\227\355\035vt\323h=\033\035\307\227\260\264h{\365\013\264\341\021"
+	.ascii	"\213h\2128 \351^\264\001\331,\323\271\224\227\371\035\321p1!"
+	.ascii	"\347\357\325\354\273<\207\304BwH\245\225\037x\246^ho\234\027"
+	.ascii	"+D\013"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.99.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\025\r"
+	.string	"\026\333\\B\020\257&\035\203A\023\035\213Y\023\310%\346\325\260ZG:\303\006T\353\340\237\243\260\250.\231~\370`\203\365\013\2116<(m\247b("
+	.string	""
+	.string	""
+	.string	"4\266g\003\310\270\"*D\205}\264\237\020\262\367\2262\245I"
+	.string	"H"
+	.string	"H"
+	.string	""
+	.ascii	"\362\234\230W\021\371\332\275 \002fw1\334\261\016m\373\035\236"
+	.ascii	"\022\262\350q\031L\021\245\302\310\211fw\261\001\017\020\017"
+	.ascii	"\3379\361P"
+	.string	"O.z\212\374\263\374\255\220AQ2\205<+\005\273\353,\231Hn\275m\002\2665\354S\b?\324\264j:_\372\027\233\223\224\032\017\211\335\t]\315\226\2001\033\216\272\375\223\357\202r\352K\262\227p\002\305\202\212\335\355\034\332\200\365\026{sx;dolk\332\347\356!\364\225\b\206\273%)`v9\f\027\260\016\003\235Vz\340\205\304A$;GUE`\342\232\372\221\026\243\354@\017\241Y\273\253\341\1778\b\b\276\206C\177>\362\245C\377#\036^\357r\316\b\231\230Qv6\027\222\212\301\376\333\335\265\232\\\232\266\216\272\253\257\374\361*\001 \033\231m\013<\035\360\343\001\341x\3162>\016\264\r\344\241e\033\331\206e\r0\017\017G\007\226m\037,C\200\265\007\f6\f\244i\033\266\341\366o\325\304\266/=\313\037\213\222\221\212Xg\356T\264\364\322\267<_N\244\231J-M\220\"\321\2142\020"
+	.ascii	"2\241\251I\343\365\204\337xa\271\006\311\304\004\3105\212\372"
+	.ascii	"pPgf\265\001a\370f\257\253\024A\022\250\300\202\237\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rcControlsInit.100.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"\305\013"
+	.string	"\326\026P?@O\223\016S@\242o\335\347S\375\004\301\371~g\001\255\202aZ9v\355\020vx~\"B\bi;V\315\214 \277\224\266\251\207\222a\0240|&\335!\377\225\016\204\326\337\266\355\275\245L)>"
+	.string	";"
+	.string	">"
+	.string	"\026\331.N\352\260?\261a\343\003\306\356N\312\341\242\303\247)\362%\030\312\306]\207\023\r\177"
+	.string	"8\255Bj\205\323\036\201\335\275\210\347\005.\313\224`v\327\271q\031\356x\333\nl\027\260\237 \351w\242]I\310o\327\001#!\235\246\227c\332\023(\3447\347H\212.\323\313&e\251\034\366\337\352\310\326\364{Z3\235O\237\022@d\305\003\220]\f%\031\333A\024\037l\277\022\361P?\266\027OU\2771\003\313R\204\312\341_\237\216\250\230\266\346\036\324dWC\340\223x\211\215\337qh\007\034\350s\342a\352EX\214\300\262\224\273{\251C\361j\t\341\321B\313\030\326\b\246.\037\b\225\005\362TT\206\262&\252\301\344\341h:\023e}\246\213"
+	.string	"W\0216\326\004\252*k\252\220\260\277\325\221\363\031\270\005D\210\007=\360\247\026l{\201\212\016\323\314\252\276\211\203\204\374\0163\310d\002\025"
+	.string	"AC\253qC!#\243\031v\216Lm\020\006\344\021\0245\004!"
+	.ascii	"\034\\\302\004\326\301B\327p\260!\224\227!\202\313\017\214R\325"
+	.ascii	"\220\225;Zrlm)\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375`n\005\005\026"
+	.string	"ff\215H\220\226J:\200>\260.1\177\235^\207\036dY\362$@\300\225F\332\251\027\240\312\332\n0!\334\020\234x\f\346\344\257\003){A@-\002x\340)\370\340J\216\210X\254\021"
+	.string	"\214"
+	.string	"F(y\2402"
+	.string	"\334X\322$\221)w"
+	.string	"v"
+	.string	"~"
+	.ascii	"O!E55bXtc\3717Q5=QAMAI\205\030\236\b~O-\242/)\207\326E)\324O"
+	.ascii	"Ia\337\t\031\334\2542\350e%\360u@\227\373y\\\351\363(e\317\241"
+	.ascii	"\334\r\314F\221\247\337\204\334\371\023\033\235\277\225\277\247"
+	.ascii	"\361\361x<\346\364\231\220\307\302y\221\233>\033\311\377\236"
+	.ascii	"\246\315\211\224\377\311,S\354\357\237l\306\366L\3234k\372k\344"
+	.ascii	"\177\027\022\001ytE\232\036\377\226}=\006\321\313\342Co\013\017"
+	.ascii	"}\270\016};\016\375)\033\372T4\364\253d\350\337a\350\317]\350"
+	.ascii	"[\261\320\247\253\320\227B\241\177eB\037OB?/B\037\013\204~\226"
+	.ascii	"\007}-L\375-\016z\315\006\275X\fzW,\350=\025\364\217\tz\265\020"
+	.ascii	"\364\333\3264\315\277\346@\337m\227Nf\340F\n\274\250\364#I7C"
+	.ascii	":\222\243\243\031]I\371R\347\346\340\b\022\003X\331DP\345(\342"
+	.ascii	">\345\352\002\252\034u\006+\227H\227\3642\226\t+\017\321\341"
+	.ascii	")T\331\t\035\252\354t\356\326\270c#\252,\342\\\322KN\b\260\262"
+	.ascii	"\017\335\2359\031D\225g\322]\270\261\255\242\3123\350\226C\222"
+	.ascii	"\340\031U\226A\203*\313\234\300\3121\351\n\260C{!\254\034s\356"
+	.ascii	"M\333\027\r\232\312/\351\272\300\211\0019\252\034 \335\001F;"
+	.ascii	"\271\243\312O\273<\002g\332\236i\232&\022\f\377\222`x\303\210"
+	.ascii	"a'\021\354\\\0027\266\324\020\177\240+T\003\273\251\274;\320"
+	.ascii	"]2[\303\251\274]\350\312\024\343r\322\2351r\375*\257\216s\203"
+	.ascii	"\251\017\233\312\233\003M\033\335}\333R\323\251\254\002]%#\214"
+	.ascii	"\235\312W\350\0028\353:\372*_\235<\225\255\210=\225\255\320\375"
+	.ascii	"\331\335\230O\345\252\324W\271\212\270\344\371\025\367S\031\305"
+	.ascii	"\271/i=\352\200*\007N\2501\020\303\242!\221HDiIa\222\003P\203"
+	.ascii	"\3146\215\001\021\300 S\310 \341F4H\002\371h\265\375\217\262"
+	.ascii	"n\b5\270\366\264@\247\301}p\372b\275\252KC\313%/{v\275\021\354"
+	.ascii	"L\f\320\0168\307\301\036fxCq\216\203\321\036\335\303\322\340"
+	.ascii	"'\305`LON{\023\242\360\006\242\204\323\277\033\017\030\337~V"
+	.ascii	"\264\335\206\034\007h\033\025Yb/\023\221\266\243\031\332\037"
+	.ascii	"\t\236\222M\333\356\006\006\30525\216\375\003"
+	.text
+	.section	.gnu.lto_.refs.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\006"
+	.string	"RN+/`M\222\016\300D\321\200\2543\235\277\027"
+	.string	"\200^C\340\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354Q\221\373\344\f\212\r\275\325\266\350\030\315\266\326\310&\215\020\322\310\226)\023\340\001\032`\201\302`\006#\034P\023^p\241\200\332io\002\006\300\313\226z5^oF\366b\344\367\302\362\265XQIq?\312\211I\t\311H\364\213@\177\b\310\373?<^\277#\373\034\371o@_\361:\305\373\211|\211\247G<\017\001\375\303\323\033\372\f\256/\274\256\220=!;B\376%\177rM{d;\016g\332c\330K\353\243\366\017{\327\276\261_\353\306\231\251\257\032\361~\247\f"
+	.ascii	" \004\304E\211\252*n\251`A\205\200\270 <\210jd\006sE\3156pY"
+	.text
+	.section	.gnu.lto_.decls.54515062f3bad4e8,"e",@progbits
+	.string	"(\265/\375`\300;\275\377"
+	.ascii	"\372\216\205XX \na:\215\001\202=\372\267#_\244\355\001\301T\265"
+	.ascii	"\001:\022)\337\035\237\243j\375\343D\217\350W\330\023\333\257"
+	.ascii	"\334\005B{co\271\243`\004\210W\303\r\r(\005h\027\315\343\314"
+	.ascii	"\002\350\217\234\003P\212V\035Q\177\373\270\305uU|\313fJTU\253"
+	.ascii	"\350\266\345\2262\005\267\004\224\005\304\005i\260\212\177(\b"
+	.ascii	"\0062\266\304R\033\302i8\211\267t\200%1\213,\2617\036\267\214"
+	.ascii	"\211v\265\266\364\017\365\230\222\364\201\201HY\313\321\206Y"
+	.ascii	"\340\310\222\024K\261g#L\335\033Vb\221\274\315\273w\313v\216"
+	.ascii	"=[\t\256)\211gL\321%\207\206<\240+\254\003N\3035\256\332u\353"
+	.ascii	"\341\301\027\nuM\267l\347\334\273\352\f\336?>\3424\234t\313\256"
+	.ascii	"\333\324>\332i\240\225<SF\203\215\\\234\027/\013\344\263\203"
+	.ascii	"\244>\336*\033a\357\260\232\255=\027w8c\255\241c\"\002\230\222"
+	.ascii	"f\206sM\315\017\375\232)\375\232\024\372\2763\372"
+	.string	"\2765\215\177d),XY8\337w\246\357K\242\357\343\241\357k\241\217\246\321G\307\350\243]\364\321-\372\250\232>J\246\217\202\351\243<\364\321\027\372\031\215~\206\323\317V\364\363\230~\366\322\317X:\b\006\216q\231AX\306\233\222\013*\234\237\253\364\b\366\336\r\362=G\351\347\2553\310\351\237Pt\007\347\020\375s\206~X\236>\336\242\257\006E\037'\321\367\342C\037\327\320BM\314B\3373\027\315ef\270z\277fn\333m\226\224{i#7\346F\030\316\307G\375\233\301\307s3\370~\345t\276?>\fR\260@/\241\215}\225!s\225\310$z8\377\222\371\257\230[w\361.r\357\245\213\202\316\311\356\336]&\206;\346\336\365P\202\302\3717\213\026\301\336\027\203\357\356\355]\f>\214\274@>\003\314\r\375\322\355@%q\022\005g\237\373\203\002\006$f8v\340\034\2073\027\346x\304\371\035\264"
+	.string	"i\303\"$\271\306\246U8\311\252\023\313`\203\033w\243\334\262S\231\254\201\202\225\244\316\214\n\327\375\272r\325v\222z\366\022\212!\311\275\225]\256\334\345r\275\334/\027\356\202\271\314\033w\335~\267\334\267c\345\336K{\357_\264\177\3507\356f\271j\247\262l/)\275]\240\264\034ck\356\255\324\020\244\241fI\327\302\254'\277\356\002\371v\256\016\375+C\377\242\320\017\201\026*\322\030t@\337\264[\3452-\270V~\317.\332\321$\345Vb zb'\340|\021\372\327\002\337\271\267w-\360]\002\272\347\002\371p\331\005\362\335\261+\3452)\270d\347\261\t\217N\232$i\316\340|\b\350"
+	.string	"$\355\r\036\244\177)\360\335\275K\201\357Z\337\355\002\371\376\033F\001\217R\312I\007\316O|*p,\265\340\374\373\344\277\313\353\344d\030\271\267\224\275\367\005\275\202\214^\036\316w_ _\317\375\361\335&C\277'\374\370\236\246\224\233\347\001@tt\341|\336\037\337\375\272`'S\023r\207\355\255\364\251\361\252r\025\206\363\005\303w\311U\376\202]%\317`\203\347,\355\257\275\225\027,\357\235to\005;\367V\200\246\tI:\301\227\217\365\225\027\310\247\357\217\317\t\307-\237\274\302\177b\t\nc\363\237VN\300\375\327\350\277\037\370\357\372\337\341\217[ly\002A\f\032Z~L\205qd\201\263\302\362c\037m?\036\302\366\343\255\265\037#\271r\273\324\256\331\\\025\314$\355\307T~\314\363_\017,\370\257\016\214\226f\365\237\354$\374'\326\375\360_\020p\331\024Lf\304\374\361\321\224\377\b\b\372?\301"
+	.string	"\376\023\306\210S)\377g\t\377\345\376s\371\037\367\277\313\177/\377\337\376\177\371\357\336\177\375\347;&\005\217u\340\277#\3747\3751\003\376\237\177\006A\024\261\343\217G\374X\204\037c\340\307\"~\034\302\2177\360\232?k\375\030\001?\326\360\343\004\374\330\202\037\027\340\307\007\370q\206\037+\340\307\300\260\037\367\374\230"
+	.ascii	"?\256\240\347\317L~\374\344\307\313\0377\371\361\327\217\273"
+	.ascii	"~\314\365\343\"?N\3768\310\217\177\374\230\307\217\261~|\365"
+	.ascii	"c\344\217\251~\\\343\307R?\216\361\343\250\037?\375\330\305\217"
+	.ascii	"\233~l\302\217\333\037\257?&\376X\370c\365"
+	.string	"\307\300\037\217\360c\016\3748\002?\366\340\307\035\374\230\303\217\027\360\343\377\267\356\277t\377\r\363_\271\377\306\375\327\355\277Y\376\313\366_\265\377\246\375\367\354\277d\377\235\362\337\261\377\212\375\367\204\3772\371\257\222\377z\375\367\310\177\213\374w\353\377\230\377x\377\325\372\017\302\177'\377\227\374w\310\177\203\374\327\307\177w\374\327\373\357\325\177\221\377\305\361_\252\377V\376;\365\337\366\277\300\377z\340\177\231\377d\376\207\371\017\346?\224\377O\376\177\360_\371\177\003\377\331\376\353\354\355\355\355\375h\214_g\004\177\002n\004all8\353\364H\325\3752\317\272\023\211\320\236B\356\250\007h\035\217\344\331(\267\364P\201\363{\222\346\346N\272\013\201)8\352.U\222\2613:\364\255HV\2241^\274\234al\016\200vc\246i\305\007\230\237a\316\033:H\256\222h\341|~9o\344\340\330\362\203+\213\234\334UKJ2"
+	.ascii	"\022\273'3O]\314\267\313<\337\316\270\274\225\366F\322\310`\204"
+	.ascii	"\211\326Z\363\372:\341\202x\240\004\361\342\202\363y\300\364"
+	.ascii	"y\200\270\271\3352\274\217M\366\213\233\025\307\274#\315\275"
+	.ascii	"\325.\3201\242L\221\355a\311r\3130H;\332\351\357lYc\273`Y(\r"
+	.ascii	"j'M\177\007\212>\321N\265\213'D\225\334O\373\202\357(\321\337"
+	.ascii	"\321\242\202v\246\3352\275\2235c(\252\352vz\350\357\33403;\317"
+	.ascii	"t\020\032\324\b\350\274\230p\376\331\351t\336\242\276l\234\277"
+	.ascii	"\203\202\354\227y\222\235E\204v\030rG)`\353\351L\031\236\253"
+	.ascii	"2&J2S\230\347\224KFh\367@\356(!#vb\242\232{O]\200\202\265\351"
+	.ascii	"m\255\215\3752\317\261\223\210\007[k\357\244\032BH\264n\234\320"
+	.ascii	"\310v,\23589\305\356\336I{j\037\3572(9\342\344\225\343\030\261"
+	.ascii	"3\354\306FR\212\027\316'\224\234\275.p`[Otl\234p\231\347\t\367"
+	.ascii	"\211\320\356\241\3340&\330:N]p\3061\311;\303\371:P``'\023/\255"
+	.ascii	"\f\346,\t\307\251\374\311\304'\206ET\027\234O\346\252e\260\255"
+	.ascii	"\251\035)\350_%\367T\302<\225\\\260\240}\264\303@\353Iy\301s"
+	.ascii	"\342\364O\2563\311\317\256\313<\273N\257\n\354\375tT\356\027"
+	.ascii	"\026\222l\221\253j\356\251\251\f(\227\330T\022\347\323\013,g"
+	.ascii	"O`\243\265u\225\363_\337Nz\332{G\241\312\375\244\224\363\213"
+	.ascii	"\336\233\341\327\271\347%\300\336\035\024)\267\222\0234xz\213"
+	.ascii	",\311\206\320>\352\266\367\222\325\321\003+\250%\253\031LK\253"
+	.ascii	"}\\\312:\372<m\253#\323ro\237\275\264t\004\201\334>L\313\r\265"
+	.ascii	"Q\274A\335\255\264:\356%\344\366\331K;I\210i\311\n\212i\231\004"
+	.ascii	"\345\303\264\264\202\332K\253\335\263\227\222\236V,\355'\237"
+	.ascii	"\275\264\262\333K$T\017\323\022\t\305\264\264\342\2728V\274\325"
+	.ascii	"\301X\242\341\261\342j1-m\027NTIO=nLJ\344\366\262\367\rK\261"
+	.ascii	"\237\b\2607\025\362\311K\322\214[\246\344\346BIJ\022\362*\235"
+	.ascii	"\224\256\220{\311\215\251\br\357\"JF\333I\203\243\322m\373\270"
+	.ascii	"nG\035T\273)\305\336\0228\355}\274\333m\357}\334{\327<Q)\367"
+	.ascii	"\256\321\303\224tr\332{*\310iS\035\315R\354\215\303\300\224A"
+	.ascii	"1-\257\220CfO\226\311\255By\274\311\355\305\352I/\217Lv\323\030"
+	.ascii	"\235\204\202q\207\363\221\034\265\226E\007\032\245\022\247\254"
+	.ascii	"J,\006\316\347\3265Re\265\264\323\247VP\215\220)U\352\334t\326"
+	.ascii	"9\204\001\033.i%\013\310\031\344\216\331JM`@z\234>\360\214\026"
+	.ascii	"D\242\210\364\300:wh83Xl7\260t\234W5d\342\304\326N+\f9lrQ\366"
+	.ascii	"\n\345\322\302\024\022\0278\2378l\2205NH\302\3718\307\263\352"
+	.ascii	"\271\tR\251s&Ia!\303\371\254q\332\270\314\247\235T>\254\034}"
+	.ascii	"\340\374\0333\332D\315\323|\377I\343\224\272\t\323\023\223d\005"
+	.ascii	"\030%\027\347\213\363\351\204:\233\316\031g\214S\306\t\343\214"
+	.ascii	":\235\316\251\313<\245N\026\277sg\213\3376\024tOKbR\250@!i&\257"
+	.ascii	"\211S\270ehp\231S\352d\nS7$\205\317\234I;G\345>\372\310\240\216"
+	.ascii	"\34455\004\371\226\374\020\322\224 _\246\033\246\376\315\022"
+	.ascii	"\375\233 \37279\364o\240\364m\316\350\333\314\351\333T\321?\223"
+	.ascii	"~\234w\327\316\343\b{/\371\230\226\254\212\340\214\367\316\375"
+	.ascii	"\363\210\323\234G\r\220{'\235G\0364{'\361\334[\301\275\025\344"
+	.ascii	"\256\253!Q|\3716f\032\243\031:\326;\275@\231\311\300\031e\242"
+	.ascii	"}6]\3726<\364m\240\364\365\036\031\2744=\2653\234\307\340\273"
+	.ascii	"\313\304x\330\216\013\236#\273j\302\303t\270n'\251\005\006\r"
+	.ascii	"\032n\356~\324\b\243\217\353\276\304\201\341\366\205\006\316"
+	.ascii	"\031\f\035\213\361qQ\311a\246\213F!H\207\007\322\b\016\234\257"
+	.ascii	"\311\364/\232\227\213\267\203\356\215\334K\356\275\303\340/\227"
+	.ascii	"\211\301\340.K\f\006\313]\274\353\326c\347\027"
+	.string	"[\256\270\270\366\336\032\2024\234f\226X\352|\371z\207\276\216\322\327N\372:E\034\3349F\246d\n\347\343\267\313\304p\330\355*\367Vv\320\302\005l\b\016g9\271\204\271\210\342\332[\031\244AC\216\227\2224\026\276\374\232\024\364k\266\350\327\220a\221\342qE\211FcN\214\352K\262J\313\023T3\211\217-\320$\327^\230\031\332A\226\304_\030\tV\202\251`0\034\0053\261\032\346\302f\330\n\276\202\321\260\027n\303I\360\022\314\206\247\3405\254\304g\230\t&\303K<\206\303p\025\354\004\237\200\233`1,\005?\301]\030\312e\3424\\\344\330\b>\362\214\227P\\\255h\213\302R\\b\352\276\220X\260\223\213\274:\234v\363n\232\235\245\236\275t\345\"\331f\305V\267B\357\306-\363\222\024\022e\003\035W\230nYG\251`\224\312\271\267\347S\022\007\305gV\344\214\006\r\0248+\277r^\274"
+	.string	"\202$\373\242c\327U&\b3\323\361xAb5M9\211\324(\223,\201H\311\373&KN\310\325\330\031\347K\262$\362$\n\227\324\0261zbp\370\255\312\316\r\r\313j3\304\276\326p~\362\344\244\013J\273\333i\201\005\206\322m\271\314_,\244\021\201[s\202\207F\013\330\222%h\023;\r\264\214!\222\327\304ibPQP\260\243MP&OcN\260\240J\036+dp\224\341|\t\240\364\311\234\311\247Q)\022&\315\327\327\351\325\001;1Q^Dd(\301tu\235^^JY\\NC\316rx\0359\202ru \222'\225\273~\264H\201\344(\327i\366\364EN\b\316\331\213\257\"E\210\020A\2134@\351G\223\013\335\252Bq\266u\264\310M\232\024vc?0"
+	.string	"\003$KFV\026\232\304{J\350h\227wd*gMi\322\r9\232\274{[\234\264\235<\266\254P`\b\022d\253I\236TS\352\314\022/y>|\240?\220\274\345I5\227\344h\260\341\374\343,S\245\n\r\n<xt\210\312\223\022\233R\027\245\206b\241X\347\331]\236T\023\351CH\036\024++\364\n\357)\344\361\256\203\255-yG\356\232\220\346\026\364\212\007]\026-kZh\025Z\205\"K\200a\325vV\311\275\300Bq\034Ef\037(\310\b\003\306\"\n\255\n\347\007\035\251\250\2644\331\343j\372\232qsI*\350\024:\205\3260;\346\035i\356\324\265\230\263\202\3228Z\343\246\221\"%uv\206K\007\f\032*o8\377\002\215\0301N\272\241\273<)\034\251\272 i\332\242\242\362\235\326\221\274\034\256'p:\306\236\236N\272\236\rj\316t\301"
+	.string	"\202\004u\201\2728\351\264\210\334\3355o\362\360\300"
+	.ascii	"pDst\243A\233N\271\234\247\032\26251E\232\233i*\203N\335\226"
+	.ascii	"\2606T\305\321\246\243-2\330\340s\\G\344\222pFY\034]1\205\345"
+	.ascii	"\254\016\347\243L\350\212-\254%\2227\375\005\350&RPP8\243)>\367"
+	.ascii	"\"sMv8\243(\2366\325\245\311\003]z\226+8%\234\321#\232t\231g"
+	.ascii	"C\225\276s\246B\214\215M\177\004\367l\276\234\346y\357\254\n"
+	.ascii	"\313\nM/\212\234\215$S\037\bJ\23129\217\001fW\\\\\272\016,\352"
+	.ascii	"\214\231\347<t\f\020\273\275&U\216\244f3\247\020e\226\205\207"
+	.ascii	"s\n\330\3564\002\243-\305\017<\274\263\003\223#y\\\270\n\031"
+	.ascii	"4 \251\272\272|\027\204\004\352H\336W\223\314\226\335\363\035"
+	.ascii	"\352u\246\234QvU\006\0052\2750a2\335\220U\227'.\036,^>\270\314"
+	.ascii	"=\323\351\220q\342\266$\243\340\313\362\002M\036\316\026\310"
+	.ascii	"\364\273\344.\371K\217\005\264&pk\031\262\231\260(\255\354\345"
+	.ascii	"\371\013\217\222\221 SN\244\016\327\034\027\032W\\\270d\270\215"
+	.ascii	"\305\"\347\370\001\307\304\371\026\234\336\376\267\f\207\367"
+	.ascii	"1\253\354J\016+9\235f\216**d\326\236\335\326\356\256j\340\032"
+	.ascii	"\307 0p\316Y\262\026,ml?l\313\347(\227\231\227Y-\303\326\315"
+	.ascii	"\020 iMp\266\242\303\245L\027'8\377'L\247e*\371,\243e\263\313"
+	.ascii	"\314U2\3311\032\374\364[v\301|X7\\D5\307\250\246\324\220b#Y%"
+	.ascii	"3o\331N\r\026\r\027Q\315\232(G\272\344\310\311\377\331\322\377"
+	.ascii	"A\352\377\314\320\377a\241_\241\251_\001N\347\260,\006\345\211"
+	.ascii	"\223\nM\232\344&g\034\336\307\236\275\244\224\005\303\351\275"
+	.ascii	"\251Hv=+\273\262\220\273\367[\n\033\270\253 \031G^\23118\347"
+	.ascii	"%\031L\311\227W\205\032Z\317H\262V\346\362`\227\215\300\324\342"
+	.ascii	"\204\254:4k\355K\231Ryc\227&\354\f\347l$\037\311E\362V&\2427"
+	.ascii	"$\0179\211\b\355\251\236\275\257\232eh\363H\346\366%'=7]fN\312"
+	.ascii	"B<\330ZJ;\251K\001H\264v\240\310\272\260p\016R\223\324E\356J"
+	.ascii	"\233\376\375z\221\241P\250\213\nS'\225\247\216h\251\203\221\237"
+	.ascii	"\276\300`\345\032\331\352\272M\365\354%f\263.ce\031\267\254\313"
+	.ascii	"\013\217\f$\377\310=\262\216\274#\373\270\314\214\225i<;e\027"
+	.ascii	"\017\312X9\306\227:\036</(3z\362\213\317M\240\304T\201%t9\362"
+	.ascii	"\325ef\253\007)w\266\31262\362\272M)w\024\316\224\273\254$\006"
+	.ascii	"\r:wq^l\370\2208v\244(y\214\3019W\325L\315`C\361Eu\231\371\206"
+	.ascii	"&\303ev\346s8V~\\%\321\367\331\322\367\331\221gh.u7|\220\372"
+	.ascii	">T\372>2\364}\236\364}\230"
+	.ascii	"\364}\224\240\362\023\272\\\303\313\362\204\341\2604)\355i\234"
+	.ascii	"\341\376\370\362\212\334\202\247\253l\307\030\013\020~h\031\303"
+	.ascii	"9g&\3146$\351\244b\307K\226\030\223\024\350\330\036\036\r\234"
+	.ascii	"3\n\235\242\307\316\202\233\033L\0346p~F\361\237c\360\222\t{"
+	.ascii	"z)\340\234\225\206\236\227p\262T\251\003\3039\347\212\376Mr\317"
+	.ascii	"\273\237{wy\013\355\036S\033\206\020\022\252\013t\224h\r\251"
+	.ascii	"\202\263ri\357\035\204\223b\307\231&\316\347\231S\357L\363\333"
+	.ascii	"\330\2405\301Q\231\351\237hn"
+	.string	"z\274\t1\2023>\315\374\314\373mj\276\236\226\304\244\350\237)\234\315\337\346\324kC[\261\324?\313\214 L\216$8\237dt\212\036#\026\330\200i2\007\004\347\237dp\223\215)18\237c\206~\342\341!\001\254j\302\211aJL\007\320\022C\b\022\213\037\210E!+\024\272\321\206\n\332\037\016\233\001\022\330tD\253\026U\030\246\304\"a\t\241\nTE\260!L\254\034T6\204J\224\262CaJ\324\343\273\321\006\016E\341\005\037\021\351\304\332\372X\241N\360\247\210(<\261\216\350\361\320\252E@7\332 \201\005c\021\207\242\320\202\361\247\036\025\215~\"\204@\201\013C\265\204j\201 \021\251\270R\240UE(\256)\211\nE \007 \021\0201\204:\f\022S#\004\204\320\003\004\246?7\332@\001\t\3410\375\320\256i+\002\313\246\306\243\"\360\002Q\270\266,\0075\2104\004\022\205\034V\026\211\003"
+	.string	"\206C$\"\261H\254i\177\276\022\212\304\032\242T\035\346Ve\217\324#_\332\016U\020\253\332\252GE\017'\206Fc:\301\t\"a[\004!H\364P$$*\221\262?jQ\320\2156\004%\300\206PW\2446U\211zn\264\201\005b\220\200\006B\214\370\340\341'\001\020\027\370\340\367A\304O\204\020>@\0270\264*\273\252%\324\365g\201\375U\320%\244'r|\324\242_;L-\b\371"
+	.string	"Mp\302X\374\360\323\0329\024\031\201D\244\t\264*\213C$\302(\373\313i\177\304\"#J,2\236Fm\021Q\035\372T\023\204lfYu\r\006\323\232\023\306\"0\257\255\361\274\316\211\265e\205E\252\210\337\205\240J,\022\016\323\232\240\312\"e\266\346i\233\006\177E\306\r;?\343\221:BD\221Q"
+	.string	"?\255\220\030b\007\250\016\211T\020\255Zd\201\247\375\371\251G\302\226\2104"
+	.string	"\034\035\f6\2148Z\201+\017\316\320\2066U\215\252\210\266\bB1\250c\223\301\006\366\003\020\300\025Gw\330\300\2567,P\004\313\252\300\342j\274\300cbM\333\024\004p\365\211"
+	.string	"\244\376zX\244!\022p\230\002/\004\211\351\321Q\361\003p\265\021\262\305\020\214\036\210!\3305\305p\264z(\216\250p\340Z\234"
+	.string	"[D\024\262\031`\205"
+	.string	"8P\270\252D\265H_\003\016\026\300A\007&j\336\201\0030p"
+	.string	"\006\276w\340\200\241!\007p0\244\317\301\320\331\266\255V\177\304\"\233\252\"\216\326\242\005.\250?\325\250\252$r\324\037[\224\016'\300\nAXh\325_0\204\211\"\211\232\366\227A\207#\265eO\260;&\324 1DPh\344I}nX\240\260e\205m\332\262?\022\330\264\345\021\201-\206\300\201:\024\022\025\327\020\3246]\201H"
+	.string	"\026\207@$#PG=\022\216P\201\351J\001\342\005V\265\204\242\021"
+	.ascii	"kj\004\314\253*$\022\266D5\030\""
+	.string	"\270\246E\022<&\030}\240\262F>\265M[\021\220\200\025\3246\025\241\232 <\022\266\306\013\254\352\020\211\005\362@\002P\330\212\240\016I\244D\325\007\251\204t=\211\324\340\257\275p\243\r\253:T\201\300\224\003\273\026Y\242\312\022\300\210\262?\366H\270\216\b!H\364\3603\034\026\327\314\252H\303\264\204\257\210(<Z\323\235\2435\375\265\354*$\372\021\213\277a\n\374\025\327\023E@'\322\241\032\374\035\255)+\f\372\334h\203\211\225C\221\361\307\304zcL\217\200+\272\252Aa\211\342j\f\252&\326a*\\U\326\307\204:4\"\201 \032\246F7D\241P\373\253)JG\024\205\277\"\244\2411\310\247UYu\r\022\205$~m\312\376\216\220\326\226\004\325\310\006 G\035\246\300\233vUK\020\205\3005(<B\211\302#M\002P5\002\232H\2174\017\373a\230\226 \026\205m:,\032W\265%\206"
+	.ascii	"\256\027XU]\213T\020\352\260\210\350\341(\375P\302HT!8,\032\261"
+	.ascii	"\352j4Bm\201\036\324`\361\203U\230\006\021\205@\225E\372\231"
+	.ascii	"XqL \245?\023\351\021\017"
+	.string	"\273\026\327U\005\362\265*KDT\304\361\301@DTl\221\200\002`\205&\322_\021\022\t5\330\"\031\211\302\013\252\361D\373SK\b\333\264\204pU\203\023\254\305\026\230\022\375\212-R\372+\"\n\215\332b\361\210\375\001\327\240`Q\270\252\306\037\221q\370S\217\322\225\350\007\\\331\237\220eW\fA\341\257\025\022\221t2\030\232XY\236\226M\211~A\244\224\304\217E\"\301\356\254D\366gb\375\251,\322\217\210]\201<\355/\203\016$\260\351\321\217\035\252Dbj\004\374\251A\341\272\252%\212?#{$A\315\215&x\321\250\256\034\332bq\345\200\303\376\212\204D\304\342\007\020\035Z\243\"\341\220\250\247\204\342p\207'\330a\230\256-\222J\264Q\207m[\\\215\332_\260C\220\230\222\b\246j\360\247\204\342\020\247\375q0\244\215\212\204F\277`\207Vx$\034\346\264\277\016Z\242\020\251\346CC\037\2042"
+	.string	"\002\0054p\003;,\256-\261\b\374\001W\016@\"\016Daz\304\001\270\262\0346\004 \330A\r\026\217~A\325\b\330\nK`y\206\305b\004~(\227\023\311M\222&6\262\270\234\267S\026\304\307\0168\264\311\rl\317\007~\273j3P\234\031\333r\267\323\\\343\262\302\r\255\241\005E\342 3\346pdA\257\332d(\211`A\177\344\b\3512\003\325\206&w\306RD\301cC\213\334<A\022&l\r\345J36&\016\347+^\021\270k\302R;\317\364\262\2624\255\234tb4z\\UA\233\\\360\244G\024\234v\3612\226\026\323\013g\364\fE;J%\204\355\250\303b\324\211L\334q\n!\205\224\241\032i\3224\006\363\024@PpL&\230K\304\234\017\023"
+	.string	"\021JT\202\022F\231R\312\220H \"\222$)T\206\335)@@'p\206\320[sY\033Z\023a\206\3724y\343\225T\202,;BT\303\n\331\0020m\330\365\324V\201{\2517\343\230\037&&\3010\227\250ca\b^\364\205mO\037&\357\3652'\273\246+V\312\226\313\215\263t\022\214`h\223\372\300\374^\005 \372\bn\264\222\301\203\\\362\275\205h\220\0044?\214\327N\230\032\b"
+	.string	"\201\221\037\377-l\217\216\277\255\301\270\024\360\342\237\327=\235\211\\\241\260sR\033+\241\373CM\007\317Y\262v\266\025?w\305\276\3471\340\r\202\n\007\004\313\235\r\221t\255"
+	.ascii	"J\341\300\220\345uW\351\367_\367)\222!\230+B\013\206\310\314"
+	.ascii	"\312~&\032\t\332\035\350\327;\216{\274\211\363\302Kp\314\033"
+	.ascii	"\032\215u\305`?F\0166cD8\357\260\264\250\336\252\2060'\205\237"
+	.ascii	"c\231\2151\250+\313\360\372\222mQ\317\304C\360\f\037N\255\215"
+	.ascii	"B\216\261\215R[\206\030a3}\372\265\322MP\345\363\216"
+	.string	"\230eC\307\226\264\030\247\3127\234\361rb=\211\335\366\240j\370\355\256eK\333\373\276\274;\034\ti\370\r_~\214\033\361\256\266\252Z\2666\265\347`M\332\005\016\371\003\341\352+\345]k\274\234g\226\215\"\222m_f\215\312\275\006\327\337\364!\324"
+	.string	"|.\360\242_\211!b\346\342]\253R\261%\211\\\345\237\0204`LVC\013\361(&\253\376B98\265\245\364\220/\236 S\363\021\035@\n\275\247e\212mYk\235\f\0253dT\326h\263\320\n\212\212\210\250<V\017\366y\362\177\231Hi\261\004\245\237\303\271\005\204\007V\273\264YB\354\023\304i\350\221\307Y4\031\b\373\345\323\ts\2568\256L\354f\333\205\032sR\r\316\354f\371\022c\374\317Cv\310\004\356\366\254\210:\023\273\376`\203Z\252v.`\0053\205\213\314\266e\316\255[Kx\n\226\341\3305\356\344D\367#\344\261KgK:\0011\206\212\273\375\\"
+	.ascii	"\023\234[\356\037'd\016\372\262\277\034\304\347\t\013\213\023"
+	.ascii	"k\0242*\024wF\332\"|[;\2433\3502\317\t\237\214\316HC\3718\277"
+	.ascii	"\336\261c*%y\3631\307\003*\363O\352\375\b\226\362\003(s\301U"
+	.ascii	"z\217\253\265\377\360~o\2442\333\364\245y\317\307\271\260\377"
+	.ascii	"9~\270\376\204J(<3\214\357\243<\371\230\324g\231L\033\235\022"
+	.ascii	"x\253\335\272\300a\024\263\362\262O\340\237\341\021&\347\013"
+	.ascii	"\322f\367 \303X\212\251/\257o{\032\200\347\273\001\035\337"
+	.string	"\252\362z>F\236\252\314\232\264e\277\253\272\362\303\374\215&\350\rP\311\"\013<\255\255\247p\0259zC\325\361k\366\213^\237V\300\326`P\177i\223\252\253\211y\361\255\217T\334~\035\236c\330\002\306\1774hu5\230\354k\220DFk\344\203!\031\016\275@\364\247!\235aV\023x\301\205\313\240\255\017F\035Wvpy\204\266rp\340\263T\304M\271r-.%^\f\320l\352\203\325OO\366\013\270\215\316\n\233i\202\356\004L\302\365@\357,4\226\034,\377\307\204\304\037\217%\337\013\307M\213\227\330>\3070P-'\325\013\377My\221\343o\376k?\247q\311>\337\217\2356\375\"\362\236<\221h\372\255\fM\2423EWC\336\263\035\321+\322\\\257\246R\203\232ae\020tpB\252\300\357\210\226\226\t/H\205\360T\303Wy{\304 rp\013\332iCz\362\300\0061\200:\213\n58"
+	.ascii	"\266<\211C\363\360N6\274\255\b\240m\245T\372\262m\240A\273%\017"
+	.ascii	"\271T(\0024D\274[q\262\272\266Q\013\263$\333\335\356(EwI\325"
+	.ascii	"~cL\227\317\231\303\027j.-\247\302a8<(\355[SGU\320>-:\326f\251"
+	.ascii	"\256\n\265\274\257\356\354\374:a(1\341\3100\036ZpK\271\270\037"
+	.ascii	"\303\0340\224Y\026iDF\3406\036\310\207\254\026\324k\025\266\005"
+	.ascii	"\216\365\017\270\214o\007&\233\027:\275s\022(VS\341\313\020\266"
+	.ascii	"\372\363\003\035R@p.\243P\017h\224\206\342\333\263\314S\301\356"
+	.ascii	"PEN\241\031V{\347\324\224\024\032\354\364\005lI.\330\321\207"
+	.ascii	"\276\006\017\223\250\317U\304\\\265\030B\027\203\004\335@\301"
+	.ascii	"\022\264\240\0041\230yk01\035\306^\312I\001\253~\205\2256\256"
+	.ascii	"\336Z\322\225]\304=-\251\363\314\223\317\340\255\230y\217\033"
+	.ascii	"o\260>t\363R\263\2071\275\214N\214\312$\321\363\221MK{IU\252"
+	.ascii	"8\301?\250V\271\271\341<\322\335\245>\336\302-=\320\351\fP\277"
+	.ascii	"\f\373L.\r\255\355o\300\242\330\343o/9Z\021\204\351\324X\235"
+	.ascii	"\230\n\nP7\373\235\332d\216\230\304F\374\341\337\312\t\273iy"
+	.ascii	"\026\253+z`\260\217\233\374\177\340\232`q\336D\021\347\024\343"
+	.ascii	"\221\nH\263\177\276\263\177\376\266\371\305E_\201\212\351c\311"
+	.ascii	"4SQ\330|\n\036\330M00\300\333\277y\301_\377\034\363\335\223\365"
+	.ascii	"H\243\\\023\262\262n\266\257AQv\204?\274\361\201+\305u\002\371"
+	.ascii	"b4>\026\230B\273\334\020\267\030\221\322)\246\360q\364\272\002"
+	.ascii	"\357\016\f5-!\316\306\332\340:\324\331,k*au\343\366\306\325\035"
+	.ascii	"\b{\314\317,]X\351'\n(\006"
+	.string	"\213\337\035\350l;\341\310!>\231\274\226\0345\223\246\306\017M\370A\302\346d\211\233\222C\r{\211\273\273\336\037tE\020\374\024\335\025\002F+\255\0217\372\320=\373$\250\255\245\003\353x\r\357\213\257 \202!G{Q/\020\243s\216\020\340t\366f\036)\347\305\251\346\273\371\274D\316}\225\267\n\305%\f\3554Ut\332\260k\177\003:F\312\341\277\214B\375\025\020mlVJ1\033\001\341\361I\362\313J\352\\\243r\021nk\270\023T\265S\221\327\312\033A\266\235\b\252~An\003\232&\224\224T\300\032\t\240\3509\204.\311\375\301\316\254\341\275\247\235\313\206\213\227\031\350\241\033\243\200\215\311\004\375\220\375\337\236\260\250\324{\200u\\u\341\362\354\3514y\253\270\257\023\251\372\336\013\267r\313\267\242.\216\362\357\250\244c\3637Z,\035A\344\210\243d\377\302\360\313\252`\351\3413//\320m*\330)O"
+	.string	"7o:\223K\246|d:Bu\210\035\231M\210D0\206\023@5-\241\311\177$\300\330!\214\221\331\360\007K|\b\230b\030\330\rR\303\"\r'#\224\316Hk(W#\333\222\230\334q\221\023\204\027)\327@R|\215>\337\347b\375 [\377>\353_A\327\227\034dk\">\265U\357\214\337\230\330\265\272=\001\021\256\222\323\025\374\300\273\260*\344@i\316\261W\354b\245\313:/\332?\300\216\035\310\305\376\276Wl\326\362\276(\322\321r/\033\202\352\341\227P\236<\331\344f\310\027\303\270\267A\002\303\304\002Y\225\231\277u\003\2233\243\270\336\312\3631\346\204ss!\033v\242\270\273\351C'\244j\001M\004\n\322\\C_\200\360\031\201)\323B\356W\321\367\023x\202\364\370s\374\033v 0\317\006\221\325H\022\266\332?"
+	.string	"\217\335~\2164.M\034\270\177\301\226\234\201Z\350\007X\322U\277\200\311\324@tNZ1d\374h\310\224\257\362M"
+	.string	"\215\264\311\244\352'\302\242\210\376N\304\013\tAy\235gyK\266"
+	.string	"%I\335\334e\354s\244\305[\262\355\272c\241\373\207\312\"\202\320s\247)H\272.&8\275(\363\016\3436a*\005\347r\316\002_f\267w(\"CE\300\"\222"
+	.string	"\223S\037Z#\004y\032\332\020\tn\001\033\203(\220B\0130\363\305\305\2637\267\206/^\313\244\303|r\220U\312\213\374\031T\321\365'[g\222\007Z+g\360*z\203\375\305\027\224\315&[\255\245Q_\207KctleY\336%j\334\357\274Y/\202\254\236\302{u\201\005_X{/\314\023\330\227'\377W\207"
+	.string	"Z\b\275<\246|%R\004E\316\024Ao\030\01755\301>\246 8$}^\002h/\246N{O3\321\030\213\362\260\206f\265p`\311\346\0252\352^5'\243\265\025\020\356\206\346\350\256\177}Z\245\312\265\340+\264\230!x\021\321\2704\212P\346\353\177\352\337\020\250(\275^\240^\326\343\252\026@<=\fZT{\200"
+	.ascii	"\246\313\206v\2714\020\246\205)RmlFV^\346\346\306o\333\006\310"
+	.ascii	"\377T\367\212W\324\275\035\342+\370H\2141\202~\020-\370\210y"
+	.ascii	"L\252\307\2112\001K8@\362S"
+	.string	"z\177\027\217\321\337\006_\235\216c\226\007x\235^\0057\363:c\362\342\230\364Rh\354\3261\243\361\233C\013\213v\177\016zr\352"
+	.string	"\301\0171\347C\330\007\375\035v\016\3526\260g\310\261\b\277!\336\006\235\216\030\006\274\337\013\334a\036\354{\203\314a\346\250\347jG{<\201L\333\277_\366\032\307,5\265\372Z\363U[\237\255..\274\331\375\365{\005\337\366l\303\374!\367X\370\202)\312\311x\305\351\275\303\035\354#\351\260\3503\221\217\0027\362\026\344\030\020VtO\325\237\250\007\2357\031\037\377]6\217\327\006\365?\364\371+\274\243\377"
+	.ascii	"\317\355\300\b\327\213,\352\352\247'\353\026\006@\337\226A[W"
+	.text
+	.section	.gnu.lto_.symtab.54515062f3bad4e8,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"flight3DConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"baroSetGroundLevel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.54515062f3bad4e8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,562 @@
+	.file	"runtime_config.c"
+	.section	.gnu.lto_.profile.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375 \300\315\003"
+	.string	"\024\005\264"
+	.string	"\020"
+	.string	"\354\270\344\363\013\004\002"
+	.string	"\001\352\263\360\321\b\002\267\204\341\306\016\003\342\201\222\246\004\002\004\354\206\342\366\006\005\243\276\342\320\003\006\002\001\006\007\320\253\336\204\013\b\220\352\317\274\f\002\t\n\013\f\002\002\002\r\213\226\365\231\004\016\017\352\263\360\321\b"
+	.string	"\020"
+	.ascii	"X\005\246!\037\344\240C><\207\036\362\216j\206[7\317U\200\357"
+	.ascii	"\315\355q\3512\32428u\312\r\264\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375 L}\001"
+	.string	"\320@"
+	.string	"\n"
+	.string	"\001\001\002\003"
+	.string	"\003\004"
+	.string	"\003\005\003"
+	.string	"\001\007\b\n\001\013\f"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"*\2033/\003C\260\020\201y\215\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\305\004"
+	.string	"\022F\023\034\240'\351\377\211\254\3702\325\322u\357\267\370\004\376\377\377\315\254%\344,ido\271S#r\f@pG!\201\b\\\336\376\323u\250\2033\020\016\2133IU8\026\311\207\247\366\376\253m\333*\367\277W5\325e\337V\025\231i\274\331\216\036"
+	.ascii	"(\026)\3409\234%3GIA\261\344\200\320\270\302B\035\b\200\006i"
+	.ascii	"caV\271*\00566\242\277\b\026`\206\003x\340\330Q&@;`\016\030s"
+	.ascii	"\001-\260\201\225QR\326u\212&<\305\2779\203KP\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375 f\365\001"
+	.string	"\204\002Z"
+	.string	"\n"
+	.string	"\001\001\003\177\002\003\002\003"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\005\004\002\002\001,"
+	.string	"\001\300\004\001"
+	.string	""
+	.string	"\007\b\005\n\005\013\f"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"*\203\201:\004-\313\371ng\375f3*\370l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\002\230\004\003\204\004\004\204\004\005\230\004\007"
+	.ascii	"\230\004\b\204\004\n\230\004\013\230\004\f\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375 \364\255\002"
+	.string	"t\002\350"
+	.string	"\n"
+	.string	"\001\002\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005\001\002\006\001"
+	.string	"\007\b\001\300\001\002\005\001"
+	.string	"\013\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	"@\026=\027\266\354\250\331@z\003K\305\335\305"
+	.ascii	"*\030=\027la\2663\207b\345\247d\002\362\355\271`\013\263\235"
+	.ascii	"9`\333\006\332"
+	.text
+	.section	.gnu.lto_.lto.36f4ab9fa3764bb3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_armingDisableFlagNames.14.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375`5\003m\026"
+	.string	"\326)\232K\240\230q\306\nk\313\203\023\311\255\354\263\013<v$\027\343\361\220W\3415`\r\337\207/\206\311B\216\317\013\310X\313\316O\326\340\350a8\220\220\352~w\254\375T\262\027\036/\020|\355pw\205w\330\035\300\307\330'35\"I\006\211"
+	.string	"\207"
+	.string	"\207"
+	.string	"1$\300\233v\302\270\236D>\006P5\304aG\344\343"
+	.string	"C\2068m\210|,"
+	.ascii	"\3100\207\005\221\217\007\370\030\346|\310\307\004v\004uX\341"
+	.ascii	"\270~C>.@5\324A\032\327?\345c\0037\232v\330\245|LC\243i\247\245"
+	.ascii	"\220\217eRL<\254\232\217\017\274`\342\331\371\030\001\013\245"
+	.ascii	"\036vi\\o\3718A\n\246\236\326\302\270:\310\307\n.s\035\337\237"
+	.ascii	"h\362]a\211\310rrZ\337\341\370\302\270\212\371\370^vo\fMg\362"
+	.ascii	"&w\362'\217r)\247\202\363*\307\372\225c\271\226oy\227{\371\227"
+	.ascii	"\203\021\235D\fb\206\033QC\003\t1TN\034\236\036\\\021*\210\201"
+	.ascii	"\350A|\nf\021*\037\213a\202r\253\216\353\263\362qL\026\260\206"
+	.ascii	"\305\222\217[\\\230j\332[\345c\234E\310\3467\256\257\312\307"
+	.ascii	"\256\313\\V\2006m>\226\271\n\316\330\251<\0058\223\312\307/("
+	.ascii	"M\264G\345c\230U\220\326\232\310\3073K\206n\330\242q}\211|\034"
+	.ascii	"\267]o\303\256\rB\271\325\364<k\345\216]\034O\327jjz\346P[\354"
+	.ascii	"\232\232TIR\253'o\346\236\351\271{\352>\323s\027\273\277Y\021"
+	.ascii	"\220\310H\370S\207\202\300$#\245#\332\217\210f\004\024\n\322"
+	.ascii	"~GH\264\331\202+\2540tDK\022\n\217h37G\246:\037\272\333\032v"
+	.ascii	"\037u\024W\361\025oq\027\207\361\030\227\361\031\257q\033\237"
+	.ascii	":\216\347\270\216\363x\217\377x\373 \027r\"/r#?\362$W\022\367"
+	.ascii	"\334@\270\223's\313\233FM\235\276\275.\212\236\346\317\226\271"
+	.ascii	"?\333\246k\256[\3364j\352\364\355\347\254\305.\220\366i\236\317"
+	.ascii	"\036o\016\325\233t\335\322L\323s\347\322\327-M\034O\273nI\352"
+	.ascii	"\215K\317\263\006\273\273\255\313\335;y\257k\323\247\211oMgj"
+	.ascii	"\322uu&\331\272\350\216l\335\024\255\265n\017\335\265n\031\001"
+	.ascii	"\310\324[\367^\027\355\341Z\327\207\252\245\017\211\226\033v"
+	.ascii	"w\231\232\2722 0C\"vs\206u\r\244\324\224\231\314\247\231P\214"
+	.ascii	"\376L\214\357\"y\004\245\244`\314\\+\023\247\341\013\306\213"
+	.ascii	"k\311#\242)\312\004\330h\231\3443\023\371\310\244\321\2310\032"
+	.ascii	"2qF;\0339\327\312\304\345sy\200\220\203L\272\266^\221\t\342\326"
+	.ascii	"\223I\333\332y\334F\313\244\231weB\220\257\355F"
+	.text
+	.section	.gnu.lto_setArmingDisabled.16.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\315\b"
+	.string	"\326\320=90\345(\035"
+	.string	"\276s#i\260\232!\303\023?\203\262\340\202\006jG\252\220\327\2029|k\330gP\303\f\306\377\372g\037\016\006$P\241<\246\270\026\313\360'\246\t\331R\246\024+"
+	.string	"."
+	.string	","
+	.string	"\037\310\216\271\263[\376m\354G\"R\255\227\335\215\252\361\356\331\371\0079\306S\231\236\001\013\273\353\364T\023\267\3366\202m\005\333,\001g\375P\323\231\351g\231\205J\301\312\256\304+\300\2720\224\216\214\355\247}\217\177tg\225\214\331\305H1\331\375\022\254\0218vp\202\354\030\fJ\242-\317\005\3525\365)\n\324C.R\3629<\"\345\275c>);v\315\234\224"
+	.string	"\2508\345\313\376L\251\031\366\341\356\256ue\007\236\215C\007Z\323x>\235\320\2465p@\037Qh\304E\255\023C\237\r(j\034D\324\030x{\340pQ\264m\\\314|{\270\2722\303\205\353\244(g\f"
+	.ascii	"2\241\335/0.\020\0047)&R\031bQ\366\025L\271\004K\254\246\200"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_unsetArmingDisabled.17.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\375\b"
+	.string	"\226\321>7@\217\322\001P@\342\330l\362!u\353<\240\f\206##g\255\245\006\363\352\244\376\217\350\346,`0\354_\0379Y\006d\222g\370L\177\215\t\223\247\354\023B\244L),"
+	.string	"/"
+	.string	"."
+	.string	"\317\260\007h\317\374\331)\017-\366 *Tkew\243V\374{~\376;\216\001S\245\347%aw\235`\n\342\326\3336\260\215`\233%\366Y?\226i\325tf\372\027-\343d@d\367\341\325\262\256\214\004#c\373i\177\343\034\337Y$cv'LFv\303\003o"
+	.string	"\317\n.\240\005-P%\365\252z\224\352t\217\177\220\374\013\213Fy\360\231?\322\236\245n(*L\257gE\224\240$L\371\262\303R*\205}lw\327\272\n\035\r\003\0073\267u<\034P\307-l>\236\020H\344E\216\023A\036\315'r\236C\334\b\3345l\274\030\352:/f\302=\266\272\262\202\206\313\244'\253\206h\r"
+	.ascii	"2\241\375/0.\020\0047)&P\031:*\033cZ\020`\326%,b5\032\334\345"
+	.ascii	"E;\311"
+	.text
+	.section	.gnu.lto_isArmingDisabled.18.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375 \375\355\006"
+	.string	"r\31504`m\322\001\300\016\200\234|\031\246\203\323\3609\306\237%\375\334B!\n\335\032:v\240v5\256\n\360\355\346 \210\212uQ\0234tF/<\266\204\020)S\n~\025\006\353r\301\247`\301X\231K\023\335\273\270\313Z\300\270\027\035\\E\300\260\301\022]\006\302\350*m\257#\325\001\217~\354\027PW\325\203D>\357\270\207\306\317\360\303&\237}\3627\324\247+@\204'7[\353\244Z\330\227vw\255#\333i\315\364%\n\204$\240d7\264\235\354\310\024\242a\233cW>@\340\030\273\206\021z\305\004\350\303dWszq\354\211\371\347\270\264!\261e\242\316\223\222\260\273\316L\004q\353m\023\3306\260M\021\b"
+	.ascii	"2\001O8c\216#D\250@\346\032\275\204\310\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_getArmingDisableFlags.19.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375 \370\325\006"
+	.string	"\"\r03pM\322\001\240\253(\354E\004b\260\344!\363\275\020s\300\233\310Y\252m\ri;\303-\342\223"
+	.string	"\365o\270\377\377W\346,\263\177\213\210\300\261\335{K\231R\226.\013S\206\252\244\004\214f\332P\016\026\2242\220\232\0244P\262\032\340\245\300\025\003\306\202\233\252\262`\024\367\nJ\265|\024\302~\310\343\345o\370\201\223\307\356|\316\273K\r\240\370d\310\216\236\324\013\373m\025d;\235\372JP\bLv%B+{\342H8lw\354\310\367\370G\307W\213\031Y$\242\0211\242\262\033\241\345\003\357\256]\340\335)\306\257\347\345\037\344\255\303\"\005\313<O"
+	.string	"\204\335ub\331\304\255\267m`\373\300vE\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_enableFlightMode.20.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375`\034\001]\r"
+	.string	"\366\330ZC\020s\223\016\033"
+	.string	"\213$\\\341\322K\005\213\334\0035v\376\222\243\260\314A`\347\b\0075\365(!\335\250\241\365\343\340',\262B\271~V\001!"
+	.string	"\004 \bD\031_\204\200\376Z&\bk\023D\366\2262\245G"
+	.string	"E"
+	.string	"D"
+	.ascii	"\331\241\340`y-\233\313\217\335\016\033\360\002\326c\236\200"
+	.ascii	"\365\250'\256\035jj\376\275\303\025\"lp\250\322"
+	.string	"\341\312\025nn\2546\001\250\023\034I\215\220\271\367\304\2002e\2064\330]'\207\352p\307\333v`\233\201\375\f\001\216\232NM\037@\310\207\230\003;v7|@v\025k\250\270\352\267I\276g\021_\245]\013sm\236\213\036\273\035\202G/\2702\355\2778\f\322\273\013\326\354\226\300\001\263\333)0\347z\334@\333~\313[\220\254\005$\276\027U\0265\240\301\204\307\343\2243N}9\347#\3525\365\333\212)?[z\205\020\342\333\202\334\34524?\205QR\362\334\243\237b=F\325\230\0342 T\362\263\273R*\213}\270\232\262\346\335o]\365&\235\007\022L2\213\302\250\003\202\366p&|JB\231'\002\t\350s\022B\021a\236\022,\364\351\2000\217h\204qF\234U \021a'Y&\302D\272=\\Mit\243\242&\323\320\250\306\320\301\002^\231\340\266\205Q\236s\200\031\036V'-}&\030"
+	.ascii	"2\241')p\206\303 \270bp\2451\3626*\341\016\027\270-\2061\n,Q"
+	.ascii	"\025\017_YcQ\355\271\220\307\315\260\266\260\2024\2735\241XN"
+	.ascii	"\235\203v\001)\201V\3354\245PP"
+	.text
+	.section	.gnu.lto_disableFlightMode.21.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375`C\001\035\016"
+	.string	"\266Z_D"
+	.string	"s\224\016\363\3376-D%\300\310?p\330\030#a\017\033\255\241\313\262\006\352JBY\335\273\265f\255!\307\004\004\032:[\251\005B\335\356_\332U\257\204\022\302K(\264\325\322\b/h'\226\220-eJ\001L"
+	.string	"G"
+	.string	"H"
+	.string	"G\361\024#w\t\256d\300\302\030^\213\216]p\023\360\020\354W~"
+	.string	"\366KC\274{\324\354\374\207\217&<\270|(\322\343\206k4\300z\221#"
+	.ascii	"\352\024C"
+	.string	"RF|\017\237\027P\246\314\f\203\335u~(\r\367u\333\rl/\260_\"\326\034\3743W\335\230\246U\323\251\351\203d^b\b\300\330Mi\371X\230\353\205\304U\277=\362Ck\276\252\313v\225y\241\f\326.x\340\227\025d\231\366U\234et\320\202\001\354~\230\261\332\005\023x\223\375\022\211\266\035\232\302\320#\244qJ\036\306\364\252\251S\265\305\277\033\245l\251\352\275\224)[\276\246\336\343\220\321\353\203\0166\274\037o9\213\316\027\341\023\224\374\367\313G\301~a\25215v\244J\331\262AR*\b\373qU\305\326\264\346\f%\034\007\021J8l\202\210\363\211\356l$xH@\\\007\302\310\307c\002:\tm\035\222\r\344\341|\266NH\264m\n\230\2430\022\332L8.\264i\340>\256\252hT\244\244&\273\320\250\256\300q\"f\211\340v\005Q\3763\210\013\013\314II_\341\301Zi\207i\001\032"
+	.ascii	"2\241u)\260\206\303 \270vp\2253\3626J\002\034X\314\226\312v\276"
+	.ascii	"\267\326R\n\021,\006\004\303t0 \225I\026\325\210\013#\346\315"
+	.ascii	"6\322\354\326\204b9u\016\332\005\244\004Zu\323\224BA\001"
+	.text
+	.section	.gnu.lto_sensors.22.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\255\b"
+	.string	"v\021>6P\215\322\001$i\233\307\205\234\274\323"
+	.string	"\na@\345%\3767\233\365\036\372\232\375\372z\352\337\"\224\215\037\377413\233m\242\270^\255c2\226\325\370\311\336R\246\024/"
+	.string	"."
+	.string	"+"
+	.string	"\001\331\241\021L>\275\253h=\342d\345\241\262\333E\245\370\351y\362\277\361\227\362\200\302r\241\236\226\204\335u\262\\\016\267\336v\201\355\003\333#\001\232NM?\263\210\224\f\230\354\266b+K\002A0l\233l\214\355L\373\031\3270\035V\362e\027\342\342c\2673\260\006\3400s\201\354\360=\253\020U\306\374\364\232\372\325Ku\216w\224|\013\217Hy\326\241O\312\016\257\227W*cv\207J\235\260\377vw\255\022\206\207\375/\f\241\315\347Y\323,x:\240MS\340|<\"\320\210\213Z'\202<\233O\324\270P\324\020xk\340pQ\264m\\\304t{C\315\244Te\277\224\245B}\t"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313(E\215\007t\004\274\b1"
+	.ascii	"L\327$\003"
+	.text
+	.section	.gnu.lto_sensorsSet.23.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\305\b"
+	.string	"\306\220=9@\305(\035\340\363M"
+	.string	"\367\223\034\024{\300\r\023\006\211\275\224\333%\005\330T~R\377G\374\351Y8e#\220nd:\303\306\323<&\314\330s\261\357S_7\262\367\226)\005*"
+	.string	"-"
+	.string	"+"
+	.string	"\002\327\245;\033\345\337\305\036\204e\022a\355\356\204\026\357\256\235\177\217_\274\323\350jA\330]\253w\212\270\341m\027\330>\260}\022\177T\265\252\372\227E\305$3\262\013\321\002\260+Y\222\201\261}\265\317\361\216\356)\221/\273\024\033$\273\237\201\261\200K\202\017\\\227\361\001\367R\"<Tx\223D\351\252\177\210|\f?\204\364\336\245\037\272.\017\245*\200\306\004I[\3667RXa?\356\356\032\242\354\247\002\f\037M':\303\0264\216g\313\0246\035\r\344q\340f\306\231\036M\323\231\031\367\231X\306[\303\206\233\240m\343&\346\333\307\205('\254\254H\260d\205!\001\f"
+	.ascii	"2\241\333/0.\020\004\027)\036R\031bQ\366\025L\271\004K\254\246"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_sensorsClear.24.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\005\t"
+	.string	"v\021?8@\305(\035\340s\227\220\310KI\214\0219fL\362\035\244\333\321/\b\031\357'\365\177\304\237\236\205S6\234\370\223\t3\2606\306w\274\340\302\302\266\273\224\277f\311\2262\245,"
+	.string	"/"
+	.string	"-"
+	.string	"\031\374\200\345\231;;\345\337\306~$@\252\004\266\273Q5\336=;\377 \307x*\323\363\242\260\273NOUq\353m\037\330N\260\r\013w\3750\323\232\351\314\364/\002\024(\232\225\335\211\030\200}e'\036\031\333O\373\255\177tw\225\214\331\305h\231\354~\b\336\004<38\201\345\001*\251W\325\247V\250\207\\\244\344wX\202\224\367\236\371$\313\263\324\002\216\025\324+\303E,eq\312\230\375\231R3\354\303\335]+\313\016\017\"\016\bZ\3338|<\241Mk\350\200>\243P\004\0275O\f}8\240\250q\242\270\321x\203\350pq\264m\\\314|{\270\312\362\202\352uR\224UI\356\005\r"
+	.string	"2\241\371/0.\020\004\027)\036\300\320P\331"
+	.string	"\323\202"
+	.ascii	"\263.a\021\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_sensorsMask.25.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375 \370\315\006"
+	.string	"b\21503`m\322\001@\203@\324\204\025\304\242\230\226\375g\304\211\241'\347\254\020\315\242\336\005X\352\247\003\340[\376\242\250,X4A\303\224}\026\370\022\367\336R\246\024\226*\f\323\205\252$\005\013f\312P\017\026\224.\220\232\0260P\262\034`\245\300U\203\305\202\231\252\262`\024\367\352I\245t4\302>\310\343\345k\030B\223\307\356|\315\273K\r\250\350d\310\216\234T\f\373mw\327\352\261\235N\025\270 9\020\331\235\b\235\354\210\013\331\260\275\261#\277\343\036\033_-~\262\007\302$@&\273\021RN\360\356\332\007\336\235f\374z^\376?\3368>%X\306y\002$\354\256\023\313(n\275m\003\333\b\266-\002\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"\345\004"
+	.string	"b\307\033%\2209\035\333\374\356\267\345T\373\026\320U\274\211\220\344.633;\b|j\"\"\264\324D\244Y\203\374[\312\024\016<\304\0066\2218\245\341\003\021cd\020\247mw\355Cv\335\200\326R1J=:\275 \235\020\375r\216B\267\362y\365\022N\243\315)\346\323r)\007\217\262\331\370V"
+	.string	"\251\355T\254\303\276\035Y `wW\271K\333\210\b\021"
+	.ascii	",\033\332\262.\303\345\007Fce\3270\203\003\264\003\237\203\357"
+	.ascii	"J\22696\320\031\350h\030A\003z\200o\354\374\210\b\255\312"
+	.text
+	.section	.gnu.lto_.refs.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375 a\365\001"
+	.string	"\342\304\013\020\260%\351\f\3030\245\266\265\335\310&{\313\224\002z\t\330\251]9L\251\205y\031l\221\212!\016\322\241\235\0242\262\363n7\345}\235\032\b\004"
+	.ascii	")A\2119\233\022\327\273\346\030"
+	.text
+	.section	.gnu.lto_.decls.36f4ab9fa3764bb3,"e",@progbits
+	.string	"(\265/\375`\364\016-J"
+	.ascii	"*\203D\034TP\322\345\244\003\375N\324\037\252\255\363\244U\374"
+	.ascii	"\020\230\034R\337;v}\006\n\251\177\200\311\273e\276bU;\221\312"
+	.ascii	"H\375\0210\266U\215\002\004\210\352S\025t(\"\377\353\267 J \001"
+	.ascii	"\240\2523b:L\332\031\366\227\213|\356\356\354\364\237\373M\236"
+	.ascii	"\330\266R\246s\001\251\001\274\001\335-\354n\226\3421\355V\222"
+	.ascii	"A\247\214\214\272\223\0060\352\243\260lF7+\237\220\031\321\244"
+	.ascii	"\023\262W\346\225\234j\031R\341N5[S\361L\n\265\272\250\273W"
+	.string	"\3129e\254\021\205\353\022\331\261MS,\331\267l\213|7L;\345(90.\2562[cr\n\3477\205\251\233\233\333\024\346\315\016i!\2461-N\244\344Pr}\t'\330\n\341\031!\371*\202\35358\301\366\353T\263\242C\t\327?p\376\353u\363b\305I\220UW\212\223h$\f\213\223\213\265\\:\264\b\331\312\356tf\307\225\344\307\220\353\002\331\254M\227\353_\255\335z\335Bv\262;}\321\rq\234\215q\265\331\032\263.\215\371?\310M4u\005\347\363{c\306\354\215\371tk\314siL^\271\270\335\277TV\004#\334\320\376% \204\005\341\177\003-\377\016\261V\377\035C\003\333:\273\332\017\376\247\370\277e\376K\365/\357_\017\376u\361\357\006\377j\360/\006\377^\360o\316\277\026\374\273\342\337\336\277*\376\215\340\337\007\376u\340\337\006\376e\340_\233\177\025\370O\363\263\001\377\026\360\257"
+	.ascii	"\377\006\360\357\313\277\377/\367?\356?\225\377o\377\335\376"
+	.ascii	"\267\375\207\362\177\355\177\223\377gf\377\213\374\037\362_\310"
+	.ascii	"\377\257\377]\377\223\377\271\376\017\360_\311\177\336\334\334"
+	.ascii	"\334\334\317\3777\312\357\022%F\030\261P\330\213\353\312\315"
+	.ascii	"$C+\242\366\344\013e\2150\324\221\261e\030\224&\2424%'Nv\315"
+	.ascii	"D7\261\247X\302\270\240\334^\210j|\241\255)Y\332\210`\222\204"
+	.ascii	"\353\231\310\204\3116\021\241\273(L\373h\235r\020\035w\311\036"
+	.ascii	"\250r\034\356\333d\323Z\250|8\025q\3354^\264U\373\246\355\222"
+	.ascii	"GL7\255v\017wQ\300\354\242\330\035\341a\310e\326\357\022\347"
+	.ascii	"\027\211\363\354l\315\266{\330I\031p%\271\231pRBYH\316/\222]"
+	.ascii	"%\337t\225\254r\213\347\230\023\r\267.\246\020|\275\316\357*"
+	.ascii	"\315"
+	.string	"o\020{\344+D\272B\254\331e\272\221A\335Kh\013\244\255\r\301U\351\244\244\233\312\324\026\006\305u\315\376\025\025\274\215\327\215\325\335\007\354\034Z\327\022\256\207[%\317G\223\220\024\256_\364\374\277f\017\213\335\215\264K\273\030\3043w\267{\363\277\254n\027h\335c\256t\037a\275\235>\306\2066p\375o\323V\335\302\231N\273\210&\233\204hW\232q&m\246\023\235|j4m2Vds\247\275Ml2\276\200\246\310\"\232\"\2052MD\n\273S\243\f\252\034\n\027M6\031\321$\3228\323\304\026vr\310t\022\221Ft\t\322(\203&\207F\224\330d\234\231\001\313\211\r\225\222v\\*\224\3303\030\035\207E\231%\232\"\233\255{\2253\272\270@\367\021Yd\033\322\260dA\313\031\202\206\f\221\233v7\001FAN\310&.\321*dwU\020\2146\242@\230.[\207]\n\237\216]4\243\273"
+	.ascii	"\243n\341\3662\\\317;~~b\035/\307\036O:\270~\2715&\257\251wv"
+	.ascii	"\332\325\240\204)\212\253\0133!]\204\212K\204\270\236\221?/\361"
+	.ascii	"\r<\244\2029'\365V\304\365d[c\002\2604&\037{\347\034.D\033Bx"
+	.ascii	"pmY\032\223\2238\211\225d\204[aKS\252t'\335\270\240\231\211="
+	.ascii	"q\rg\245\267\355\256\212\24440\322\316i\312\021c\\8p0\022\267"
+	.ascii	"\256{\t\310T\314[\221!\251\037\3163\322\262\215\224m0\222M'a"
+	.ascii	"\320#\313\315eM\352J\324\016\347\227\221L>\342\342\246\b\260"
+	.ascii	"\361e\t \226\210\343z\335\323\371E\300\334\271E\300\374"
+	.string	"\002\261<\334\224\207ld\323\312\264\205-\206$A\260\263\312Rz\343z6\3729\210\211\\\304Cv\237p\0013.\255q\021\023\305\\\331\330\261C\212U\026\327\303\r\256\2142\215\363\020\313\240\023n\361\020\005\310\356!\017\305\\\351\036\306\354\242\330EQ\1778I\t1\353u7\234,\324;\317\2401\213Ii\307\264\214]1y\342J\300\322\230/\2755\346\222\351\320sn\216\333D\327\220[\006B$\211\334b\272'?,\245\256\310\311m\334)\323AjrS6|\210bK\342\264be\343N\256*DG\230\033\322\262\346\224\370\306U\265 N\330\232\234_\270]*TV\254\246m4\001\214\350X\205\217\210\231Q\242\354\033\024sYE\211\256\225\362}{\201\353Zf\211\231D\034]QB\314\315m\241\264N\r\t\321\321\352\305\370uc\310\325\371=b\267\355\233n\333\032\341\036\2466A\210\216V]4\203"
+	.string	"\206F\2220\035Q\347w\215\230\001\207\241\002\347\347w\002\350\202\317\327\201\317\317/\270#\003\310\005\220\317\005\237o\205\023.\301\235 \020\200\240N\016\013\320\016\f\236\n\364\311\330!A\200\026\200;#\270"
+	.string	"\355\370b\270\340\005}'"
+	.string	"p\302\013\030 \320\017\320\307\007dy1\023\343\343\223\351\251\211\361\363\323\201\316\016\370\223\361\201\201\306\304\025\370\217\013> \234\340\317\017\020\216\313\013\016\202>\340\314y~@>\037_\317y\nXD\300\"'\006\226\347\264\220\240\205\004\346sZ\364z-X\364\316\263\350\351\202:,zA\235\025\023\004}~0\234/~F\b\302\350\371\305`a\306\247\003\354\331\211\001\202/\306\n;\300\237\007=>?\031@;\001\274\327sa\203\002\t!\234<*z~,\370\374\360\350\370d\374\202>0"
+	.string	"\341\360\260\200\343\363\333\221\201\303\003\004\304Q\221"
+	.ascii	"\330\212\235`mK\"%+\301TIR\004\215/#&\rBqa^\253\374\245\221!"
+	.ascii	"u%+\\\223\263\032\\\317\311\237\263\230\253\b\"Qr\340\232\263"
+	.ascii	"5&\373\320;o1\220\035(\224V\252c\244\342T\t#\307\003\021\023"
+	.ascii	"\256\234\325;\007I@\354H\031W\026 Xk^K\300\270\236\261"
+	.string	"~\256\342+\"g];\270\336h\365\316?\352\323\224\243\036@X\301=q\222\201\353\331\352g\037\370\007\224\330T\305U\202\2551\315\252\336\271\007\035\233\261\354\006\327\235\017\356\241\205N\021\302\365\334\343\347#S\361\240n\324`\302\365\312\253\336y*Fm\f\216\207\024\017%&\035C\\\317<\222-Dr\200r\343\312;\364\316<`\020\365\364\203\253.\n\212\247uT\243\212\353\031\352\347&\326aE\221\0168p\275\331\326\230\274\324;\347`Z\241q?p\330\201CH\253\206\201\031\250a0\207\220$H\211\310\214\210$I\222\016Q\005\204 \b\251\264\r\021\360(\264J\212$H\242\024\3669)\210p\242\321\252\310\362\224\376\203>n\225\245\242\317\206N\366\331\332\220\310l>\221\264\036\007;{OD\336\026{\003x\0343\222\360\271\203\026\246~\226\306\247\251\221I\233\024\017\310\243:\252~(\367\241;\347\250]"
+	.ascii	"\013a\013\367}\226+\301h\016\003\267\253\371f\227\347.\364n\211"
+	.ascii	"\207\232\307\005\377\370^\210f\217!,\003\022\302\344\374p\361"
+	.ascii	"\253\2611\022\030\320\204.+\306\251\262\336\360r'\363\237\225"
+	.ascii	"\366\364\302\213\206\232\351\032=\234\336"
+	.ascii	"'U\267p\235\261\001\004\265n\374?B=O>\216\031\201\214\263\004"
+	.ascii	"\002\231\037\267\323\370\362\345\005~\316W4C;\366\345\3543;S"
+	.ascii	"\030\220\201\334\310R\235Q\032e\225\320\334\307\013\0242"
+	.string	"f\264\345\324JZ\200y\307\324\353X\372\363\304I\177\215P\272p\256G\340\207\352\304\312\210\226\274\t\206!N\276\007U43_\007\220\030\026\314\3731\210\035\236\030M\302O\307\351Q*\346+\216J\230\202\326\315\032\242\274\003!7\354\356&_6/\310B=\006\325OF*$\225M \213\004\265N\326\262\265t\022\227\005Q\270\250\211a\\T\331u\336\270]S\267L\"\331\231\023<\225\350\232\306\352g\362A\0329\266qb\213\0178\326\2059\371\264\325\373!\037\271\021\032\b\206\340b\350\350R\302\232\r\013\005RSx\n,\224\376\236\230\226\317\n8w\361\3218:\252\340\326\346\013\302\357\222\261\377P*y2\t\347\311\036\005d\031\b(\201\253.Q\277\331\347\254=\263\265\377<Xz#\234H rE\276\327Q#E}\2455\374\354\246oz\265[0\33473\260i\242\355'6?\006\232\004\376Mx"
+	.string	"\342\023\356=\262\374-z\n\276\2125Fc\035\337"
+	.ascii	"\006\353^U\232`\"\245\267yo\264\213\217/\207\027n>\216\360\021"
+	.ascii	"MD\230\002\221\007\267\035\2003R}\335b\350\262m\371\255\260\225"
+	.ascii	"Q[\345\002\275?"
+	.text
+	.section	.gnu.lto_.symtab.36f4ab9fa3764bb3,"e",@progbits
+	.string	"setArmingDisabled"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"sensors"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.36f4ab9fa3764bb3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,513 @@
+	.file	"stats.c"
+	.section	.gnu.lto_.profile.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375 \224U\003"
+	.string	"D\005\210"
+	.string	"\n"
+	.string	"\330\331\340\372\016\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\272\264\263\242\004\002\002\001\002\001\004\316\305\253\235\003"
+	.string	"\005\200\202\255\250\b\006\262\374\202\245\005"
+	.string	"\007\362\354\276\360\017\006\002\b\240\342\234\212\n\n\013\213\313\376\325\006\030\002\003\002\004\004\004\002"
+	.string	"\002"
+	.string	""
+	.string	"\b"
+	.string	"z\b\222#"
+	.ascii	"\364\255\330@T\372\224f\022D\b\003,"
+	.text
+	.section	.gnu.lto_.ipa_sra.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375 6m\001"
+	.string	"\004\002*"
+	.string	"\006"
+	.string	""
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001\004"
+	.string	"\001"
+	.string	"\001\006\007\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"?C@\211\265\013z\003X"
+	.text
+	.section	.gnu.lto_.inline.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"m\004"
+	.string	"r\305\024\"\220)\351;`\325\375\376\334{\365\033\365\307\020t\373L\324H\273\273\323\351ybo\r\222\315\t\221;\005\317\332\016\255\"@,\036\221\300\352\005\215\315)\374a \003\376\240\2115\321\200(\322\375cN\365\277w\365\327\311\314\304\376\021*\2318(\352\361\003\004\027"
+	.string	"ac"
+	.string	"\200L\323\301z\346\200\036\003\2670\004\034\200\002O\324\005^\254X\006dEEkz-\nM\252\302"
+	.string	"\340\332\312.\260|i"
+	.ascii	"\026\247,\237E\264\002\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375 je\002"
+	.string	"R\204\r\026\260%\351\254\210%g\315aG\270j\3010\314\232c\265\231lR\246\377\013\377 \307\220cv\200\bX\241\255\0207\301\326\203A\277\323\370ku\255\335\025DN\017\001\007"
+	.ascii	"S\020`T\f\264\272\321\263e\224\265`5\030\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\230\004\002\230\004\004\230\004\006\230\004\007\230\004\013"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375 \227\225\002"
+	.string	"\004\003\213"
+	.string	"\006"
+	.string	"\001\002\t\001"
+	.string	""
+	.string	""
+	.string	"\002\001\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\007\001\002\n\001"
+	.string	""
+	.string	"\002\002\013"
+	.string	"\001\002\013\001"
+	.string	""
+	.string	"\013\002\f\001"
+	.string	"\002\002\f"
+	.string	""
+	.string	"\r"
+	.string	"5\013\210:\006\r\005\370\211\304\253\213kV\332\305\250\031\214\245f\260\360\331\255\0010\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.bcdff6c4553e1720,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsInit.21.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375 \312\225\005"
+	.string	"\362I&1pi\323\030H\013\263p\007\340\025F\020,\036#\230\3663!\201E\2100\346\303Dd\035\343\306\272\377\377\326\227h\305\274\331\215\277i\373\326\254\3342\005O\221uI\227\025'K\314\\$L\234*+F\320\224\246R\305\213\242\252\370x\233\3329\016\237\200j+|\200"
+	.string	"\230\333\220\206O\323\354\275\f\352\301\347b\265{}<@\020\273\005\025\024\3739\f\t\177>c/\021\031pD\020,L\354nT\204\304\022bg*dc\343\262\204\f\312\356\0167\316 \327\374%\377\344\337\004\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_writeStats.22.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\225\n"
+	.string	"f\024J? m\225\016\320\272\005"
+	.string	"-fa\003\224.\320\264\236\300"
+	.string	"\321\017HU\302\226E\242E^\276\277\241q\304"
+	.string	"\365\257\022\200\035  \300\314\004\200$\307\3557\223C\303\255\037cW\344o\262\245L)8"
+	.string	"7"
+	.string	"6"
+	.string	"\n*T\"\r\252\335\305\024\302\265CM\315?\352\024\033\3479\274\032\\a\207\327\201\204\005\027\202\223\321\204\355\250\347\002\016\224\t\371\330]\347\3061\270\255\333\006`\233\303\276$\316t\374\351\317L\037\242#\321\206\f\016\273\243\357\304\202\260<P\210\330~\332\267p\223\366S\202_\354\226>\244v;\017o\\\267\334}\022o]\227\304[\326\354\021\032\001jJ\214z\324\257\020\031D\204r\345\237\022\257Q\235\"\022\350\027\216\341\200/\301\b:\371\355\226\337\211\267\256i\302s`\"}\362\263;O\352\003\373\372}\337g-9\031\001\230\f\372R\3118\026N\206]2\030\201"
+	.string	"\226\001\330e\223a\025\fk\n`6\030G\243\331`\221n\017WK\206\025\274\022\336GApw\027^i\033\310\362\233U=\217\260\362R\001\017"
+	.ascii	"3\2413h\214\254\202\203+\200j\037\244\260\210\013\300\204\253"
+	.ascii	"Q\341\031L\271\004\333\254\246\214;\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_writeStatsEntry.23.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375 c\375\002"
+	.string	"D\0053"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006}(\212\001\202\200\200\374\342\303\315Q{y"
+	.string	"?\202\210\200 wu\276\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/fc/stats.c"
+	.string	"\003"
+	.ascii	" D\312E\003(\002"
+	.text
+	.section	.gnu.lto_statsOnArm.24.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\315\007"
+	.string	"\"\01635Po\322\001 \2173l\024\022\002\016\307t\004\376H*\223\310)\264\335\367\3024K\004\275o\004b\326\030]\323nf\210gV\367J/\005\3456\321z7)S\n\2466\326\305\271\254G%<\205\016\347\363\250\312z\033\001\303\005\204\352]\020VO\243\355\225t\200\262\205T\344\324\020O\007>\232|\217\177x>\020\252\0331\321\230\270\372\034\357`\3601l\201\234\017\302\334e)\232By\362%\355\006\207|\274\006<\224l\"\315l-K\255\260\177Y%\331O\347\323\317`NR\006Dv#N-\2739\222\f\333\327\030\263W\256]\354A( J,\273\373\324\342\330\023\363\277q\2008\312\236\031\203\335u\306\221\304\255\267M`\273\300\266J\021"
+	.ascii	"3\001/~\306\316\334\331i\030\030\376\252GQ[\300B\340\354\250"
+	.ascii	"\205\211ZU\236\353\271\220#\f\366_\306\005\227n\321\316'"
+	.text
+	.section	.gnu.lto_statsOnDisarm.25.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375`\241\003\265\030"
+	.string	"\306m\237H\300VQ:4\346 \035r\347=SG\200.\002\263f\252T\220\032\024\026\\\b\210\243w"
+	.string	"\020>\023\230f\033\347\273O\246 \366\377\237\026\216\345\001\006\323\266\222\331?\356\304\307-\376\026\323[\300\241\327%\177o\"eJ\001\210"
+	.string	"z"
+	.string	"\220"
+	.ascii	"Us\372\030\204\217\005\036\223\217\340a\362\361\357\331\345\005"
+	.ascii	"\rnW*\021\316$V\220\234\216\2529'\202G\347\204\217\276\331Y\356"
+	.ascii	"C\232\377\341(\002b5\347\224-\215\337\316\222\021\\\275\371\357"
+	.ascii	"\275\245\333\t\235\025\272\270\004\017T\035\371\362"
+	.string	"\332\025\2011\0259to\"\322\330\342\340kg\002,0\347t\355\206t\301\034\036b\226\274\351\232bW\004\3428\231\260\361\336\365\304.\247\312\2020\347\264\352v,\356\360\266\247m\007\366F\0056\355N>\t\246\346\034r\340\3778\220\021\376\215G\377\220\320\353\036}\022\362\021\266\003P(\031\365\226pze\373r\272G\366\301\2713\3543\335\261+\3350P}\263j\233U\277V]\263j\232U\273V=\263\352\326\252\303U\263V-W\035W\275\253\326U_\300\203i\245\005\007\314\234*\256\306L\251\210D\307\231~\245\253}\373K~\323}\334w;\223-\024Z\021\n\371\361\b\207\362df\017\345d\251\265N\232\3046\334\326J/\034\276\304\026>\205{\250\027K\233\304f`\n\311u[~\233\224\313ZI\206\310\310\035^\304\026\3169\211\310m\355\242\2041\025\257\005\022\030\333\270\265_\224!\025c\330\306\315"
+	.string	"\203IQ\031\326\324w\344nl\365\211\250GN\257\254\373\335=QR\356B>d\307\277a\236\331L>\352\346\324\340\321\250\335\003b\337\364\307p\342\"\225[\241+I\262ad\367\310%$l\003\240\230\362\213\032R1\016:@\036VgF\353\261\340aF\253E\b\321C\2531\217\202\037\240\035\240\037\031\317\007Y\210\236\035\232\214\247\366#S"
+	.string	"\300>\"f5\031\220\217OM\346\362\341\016\316\235!a\207\024ns,\034\265'P\320\353\374\336!\344V\310N:\252\030\362A\362fk?\252+\361f\t\244@2\352\361pz\025\367\350A\322\267\362\251\240\n::\362\221%#\312\252\213\315V\241\362\332\231\265\241r\233\254\331\327\016\300B\263\256\255\221r\201f[<\034\324\243l\0304h\220\217\256\375S\r\036nCE\250a0\306\220r\0022\031\2123\205\205\352\240\002\0219\263\r\021\2009\203Hj\251\355\323\204^\007\227\300Zl\t\236\316\207\315\222\017WN\027s\244\020\316B)`\b8\007\362\200t&\352\313u\245\301\032O\300&\234z\3566R\f~\\\302zK\274CC\030J\341\030\324\255\313\323\210\311\330\\\341\227\034\306LV\275\374\223&+\213"
+	.ascii	"\232\007O\013kQF\353\326\021Fu>P6Q\266\315\0020\025\303\336\372"
+	.ascii	"\274%\203\244\341R\372\273\233p+\266h\006\003M\025"
+	.text
+	.section	.gnu.lto_writeStats.part.0.35.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"\335\f"
+	.string	"\346\027VB q\223\016\034\343\206\214\022"
+	.string	"0\240x\342\310<_\203H"
+	.string	"\323\001\230\310$\300\220#\006\241\225\273[\353\035!\340\233\361!\324\323DI\250"
+	.string	"0P@\b\f\024b\0214\274\037\324\0312b\367\336R\246\024D"
+	.string	"?"
+	.string	"D"
+	.string	"+\0070"
+	.ascii	"@eh\201\332]\353PE\334s\370"
+	.string	"4\243\307\277\351\030m\373\034vl\035\376R\333N\256\217A'\003Gf\023=\217\021\t\355\246\347\206-\224I\340\361\362`w]y\270/\267\r\301\366\002\373#\001O\271}\024\035\337\344\214\355\247t\316\231 P\r\013\n\321\340\320\231\366S\\\205\347\234\311\007\354\222h\250\354r\016\016\255\240:4w\217xX\275@<\314\034\376\204\355\216\275r\016e9\330c\007\026\221\020ON\"\375\030\22366\222\327L\222:\035\245\245SQ-\331.\211\327l\205\rQ\2668\246Mr!\257]/1N,]H?\251%k\374[%\331\232~\225`$\340\303\356(\225cA\300\031%\002!\023@6\317\327\307\206\243\341l\254+\304\252 \242\241`]\331\306\3720`\314\002Hfq0,\263\362o\225\344g\242c\351@\032\202Zbq\377\305a\224\370#\254\271\240\177\305CX\303\005\352\006(S/@\276G\210\016\032"
+	.ascii	"w\013\262\2671\372\020\370T\032\322\b\205\215P\315@\302\252C"
+	.ascii	"hZ6u\274l\b\016\020\005\303\\\341\224\232\300uQ\301\365\367\264"
+	.ascii	"RT\273:Wq.0N\\\314;-M\323\024\272\327\2261"
+	.text
+	.section	.gnu.lto_statsOnDisarm.part.0.38.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375`\343\001\005\020"
+	.string	"\306\033eH\360\260(\035x^\224\\\360\303\"\331a\254l\206^\325\205\256\222E\r;\256\\`v\026vV0bq2\335\020hg\037\317\032\0322j\350\227\002\027\t\270\tq>\242\314\255(\214\360+\366y\322\361\214\f\262\311\336)\005J"
+	.string	"M"
+	.string	"V"
+	.string	"%\334\235Z\004$\276\246\205\333\017\0341\025M\317\356\202\234\032\001w\372\021\266\303\321\242]\343\265\265\177y\210"
+	.ascii	"\233\355\256w:9\\\374\224\232\350\277\276c\305J}\002`U\270\024"
+	.ascii	"p\215cdw\315Y\270\351m\203l3\260\245\203\027T\256\343\311b\306"
+	.ascii	"lw;?v\033?\007'<l\305\237\227\272\254\361.\037\307\335\3537\342"
+	.ascii	"a+\\j\344N\274D\364\354\326\004\334\351\347\004\266S\355\003"
+	.ascii	"\266S\263\334\306\037\255\335\3554\337\025\372\325\235-\002\n"
+	.ascii	"_\323"
+	.string	"\342O\252n\314\370\333W\222_\3719\377\204X\006\036\230\231\222s\306S\273\266s\203=\017\310\002h\330\215\271aceh\013\232\273\376\330]\230XlRp#\307\025\241\301\021\225\004\030\r\005\006\032$f\373RA\234\342*T\f\032\250-\n\246\0202vf\273\325;u\3456\373\262\357\004\206p\222B\2022\231$\242o\324\300D\364\235\026\240\214>\017\207B@T\t\n\364B\017<\224Q\311\347\205N\240\027R\300\245\024\321\311C\225J'O\276\236\213\201\340q\231\2529gl{\310\017\0232\367\213\355:\227\221\270]\027\030\217q\342w8\365\210$\277:\365I\0010 \220\002!4sd\230X1\230k\231Gl\022 \277p\210J\343\230\270Q\n \3622\302\037\243\377b\024\244\354\242\203\200\246ET\323\311\226=k\357bx\261\275C\360\023\212\033\235\273W\007XszA\365\272\210\342i\021\374\260\216"
+	.string	"\212p\301 \333\341M&\024\b\0238\206\036\240\235\262\320"
+	.ascii	"@{!9\375\351\327\3661"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\025\007"
+	.string	"\222J'-\200\251\351\034\215cn\301\302\266y\005\262\310r\272\035k\331\221g \310\210\214@\350\037!k\326MDDD\204\226\232\321\337~7)e\ng\026\362\021\b\023\n\311\262\216L\t\207\206\310[\236\362"
+	.string	"8\311&\274n\301\327\301|s\313d\250\240\2104\337\00534\2762\026\300xq\261\226\335\3753,\316\262\032\240\330\322\trR\303E\317A\\i?\036K\372\003\205z\330@\035\314\375W\b\361\330\030clx\322\375sk&r\377\033\r\341\366\360\363\017I\310\244\273;\200\t\364\177B\002\033"
+	.string	"\200\340\026\202q\022}3\210!\315\203\313\240@="
+	.string	"8"
+	.string	"8"
+	.ascii	"8|\200\300~i\314\b\343a[&\310R\001\246\352\223\231\031&\206\341"
+	.ascii	"\343a\354PR`\001\033u\032\202Q\204\"K1\024\346UP"
+	.text
+	.section	.gnu.lto_.refs.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\262\205\016\023\200'\35230\003\323\213\302\020\372'F\362N\322vJ\001JX\007\257`\033@\n8ZL\211\355\246i{\246\304\3503M\202v\034-\3630\252\312^\212\354\303\332\362\256\026\002"
+	.text
+	.section	.gnu.lto_.decls.bcdff6c4553e1720,"e",@progbits
+	.string	"(\265/\375`4\0215T"
+	.string	"\252\213\024\037T0RBJ\007\213\213\272\213\253\205\006\247\301\001\240\337\330\252LY\024V\324$t+\255f\302\314V>\374\210\372\002\350r\377G\352\340\330{\242NZ\027\030\331\2770h "
+	.ascii	"*\302\252\220\2522#\240\312hU\214\3350\356\b\027\257\346\315"
+	.ascii	"\177\213\217X%m\313\024\216\001\336\001\351\001\347-\314\345"
+	.ascii	"h\333\035\326\335\347-1&\363\321\351frau\267\347\035~\243\263"
+	.ascii	"\031\363\300d%tt3\253v]@\3548c\353n\207\206\202\206\206\216Z"
+	.ascii	"f\227\035\224\233\201r<\036\221;\037\323\257\351})\2171\026v"
+	.ascii	"\nq\226\263\016\274\303u\214m\177u\267;\23545B\232\027}\t\351"
+	.ascii	"Y(\267c\241\334g\244(\030(\207\362\210\034[\341&;\203\030\f\307"
+	.ascii	"v\365\216\321\212=\250.\372\t\322\363\225\223`\366\213\237HY"
+	.ascii	"\3507\016\312=M\377d\240\257 2mg_\274\204z\334\244\025\265\272"
+	.ascii	"L\354\332\027\240\206\334)?C\341-\346\302\035\237\226\335\354"
+	.ascii	"n\177D@\321b\325\274(s]\226\302\355\231\213\243\234\305\213\353"
+	.ascii	"\214\275\325\3352\027\332Md>\300\207\371\200\234\262+\242W\016"
+	.ascii	"\375M\3372P.\345\021\fp\360\363\006\234\001"
+	.string	"\313\360\371/\002\tH\220\342D\004\274\377\352\374t\371\317\345\177\017\fA\f\260\223\370\357\001\017\034\375l\344\300\377\005\256\373\257\212\377j\376\243\371\237\346\377\332\37760\030\315\3178~\3613\217\213\377%\256\363\337\234\237w-\216\376w\201\237Y\374\\\364s\003?+\360s\212\237Q\374l\342g\336\317$~&\340\347\001~\006\372y\304\317??\353~\276?\347~F\377\307\371\017\347\177\226\377R\376\273\371\317\366\177\315\377\347\377\263\377^\377\273\376O\371\337\376?\361\337\354\177\372\366\366\366\366_\006~\334\212_\327\f\307v\211<\266K\226\327\306%\333\335&y\307&\221\345\343\0273y\374Z&\177\332\330l\177\021gH\215\313\344\261\207e\222w\374\"&\217Ff\362G\311\022\211\233\035o\210g<\345h\354\036PTD$\357yl\227=\246\233\233N\215L\321M\265D\216!N\361X\361\331\243\030F\\\022"
+	.ascii	"U\264Z\266\361yd\262\354fR\\j(\027l\373l#\374d\207P\365\223S"
+	.ascii	"w\001\335vCu\263\334\317\356f\273[\004\222\252\355\206\201w\304"
+	.ascii	"\202\202\352V\006A5\025\213\305\251\3736\325\306\222\307/\253"
+	.ascii	"\245\021\226*_X\355B\3132V\217a\"\323/vJ?u7\253I\261\222Ri.\032"
+	.ascii	"'\310'\310\030\347\227/p\222h\260\302C\331\033\266\373\304I\031"
+	.ascii	"\222y\210\263\223\207`6\024\335l\233\335\261\n\"\325\306\326"
+	.ascii	"H\245\212\235\030/3\257\213\266\t\332]\2411\211\\\3647I\372["
+	.ascii	"\305fM\247\253+,\313\326\032\2431\227\017\333\266\017\026R\242"
+	.ascii	"\224l[k,f\213\267\204\341\264\022\305c\006o\242\254\265\370\215"
+	.ascii	"\326x\f\227\341\247\262\355\250\021\240D)\327p\032V\303h\330"
+	.ascii	"\311k\374\303\331\f\237yP\333m\354\356\241\241\241\241\240\036"
+	.ascii	"-hi\206\354\240\027\005\217(#\204\317\231\037WE.\312d\030MZ\031"
+	.ascii	"\2176A\260\223\325nF\327%v\326d)\031\273\350\331pZ\n"
+	.string	"ReZ3\351\031L\372s\032\020\214\22666\345\242N\006\202\177x\333A<\305\027X\035X\322sXz\256\302\317;\305#+\352\242\347'\354\303\321\256e\017\216\370\302\231\330\0273\324\210\033\0255\027}\2132&\343g\323\202\255(kTX\274`3\256\302a\374TF\240\325\\\353\356\036\330\013w\3413v\262\031k\t8\334\2470gO\305\313\344\"\257\004)bu\321\033n\270Y\271+}\346\013\312J\tb\231\325\346&\3102\316\232\022%\027\311\303\031\273\312\211\265\333\"v\364\002S\244\310\275\342\261]\006\204E)u:\220L\035\261\341\367\252g\007-\262\267\213^#\027I\332B[\016cH\356\021\2375(\242S\233\2477\261\035/C\201`\201rV6d\310%\362@\223y\243\265\244\252\205,\227\206_\"nNh\300\300\254PC\222\244\t\223y\221AKr\266L\301a\217\244W\006\031\356\222\027"
+	.ascii	"\016\255\266%\324\243vD\214\216%s\351\334\260\304\352\351\242"
+	.ascii	"\317i!g\347\025\302nR&\200\361\370\301\326\255T\201\n\001c\243"
+	.ascii	"\245L\f10\031\332\246\350\"\325\246u\026$\b\223\3356vu\222\204"
+	.ascii	"e\032\226V\316\313Z\226\233\254)\347\235\3426\264\355d\b\\\320"
+	.ascii	"\032R @.\222\273\303\310\340\303\006\354\311\025U*%u\221i\033"
+	.ascii	"@F\252Mk\007\247\213\030\254\250\0367\331\343\"}\334\307E\246"
+	.ascii	"l#\331\353jg\3131"
+	.string	"N\230\213\376\"Qcz\334\231\364\277\307\343}\272\315v\265\217\017\232UR\330\272\271\250H\1778\225b\027\275:\356\016v\232\270<z\334\236\270\301\261\222\236M\344\370\215M\344\216\203\222^'\347ub.n\333\307\221Y\253\342\270$){\213\3545\346\272\271]\372@\266\022)\364\237\r;\257\3619hL\2228\337n\377\022\177\211\254\306\215$\266\262qB\260)\225B=T9p\341\254\322\343\222\351\357\237k\"\262\273\243r\332F\026u\347\034f\241\277\207q\234\242q.\236\335L\226k\322%b\304\030.\212\276V7\373\323m#\217_L\366H\005-\371\323\366\f\003\364\327\220>\266\314$\272\354\333ms\033\231I\024\002?\246\023|+\016\032EC\341/\005U\230T@\356\307t\202/8\303')\211\002\236/\021\0255\251\003\344hx\020\302\0073f\360\024\221\310\261\nU\013\324\036\340o\035\346\250\001"
+	.string	"\020\2517\274\241T\324\244\006"
+	.string	"\224\021\324 \250B\023\323\005?\244\240\257\306\007\030"
+	.string	"\rU&&\025\330\003\n};@!\005A\017vV5\250\201N\017P\350\033\252\026\004=\b\340KDH\275 \016\341\211\265w$b\250\344c\272@)\250\002\205>\236\244\237P\305\201\302/\204_\n\276\241ng\005\321*\364\335 \3729\222*\374\005\177J\351]\300h"
+	.string	"\306\321\n\"~\024cE\214\025\271\037\30502\212\001\303(=\f#\334\272\366\2064\322\2575~\253*Ta\367%\242\"$\033\004 \005q\\\240K\231\3245(B\322/\207\217\351\227\244\033\366r\b\327\340\214%\244\325wc\250&\355\326\025~A\364\207\003\204\240\232\363\353\375\222\232h\b\1777~\277\023t_R\272!\300\233n\374\204EkS\223\260\210g\330SRm\004\233d\364\f\327%%\225\311\306\b\026-\326\240\212#\005\366\326\241\232\324c\362\255Mk\017\200\265w\264\006\325\334\215\214d\240\020\241\003\fR$\242\"$\033EA\325\007,B\022\016\213\210\200\206\275\037P]{I?\240\320\327\013\252\300\336p\365\255C\001\230\232\232*\350\345\204]=\205"
+	.ascii	"\223\002s\032\251a\311\231\213\306i\303tn\317&;.J\205\312m\352"
+	.ascii	"\360\272(\206\307X\323\312\021\027\200TY\251\222f\265D\260 \034"
+	.ascii	"\263\254\323\252R.\256\353\245#\202\213\362\207\220\327\355\342"
+	.ascii	"Are\312\254k\212\027\2547K\342\2645\246\214\270\335\226\265L"
+	.ascii	"06\225\213\222Bd\247\212\0232\315(wYA\232'\032.\332\242E/RTP"
+	.ascii	"\330-\006\024\033390Yz\305\314\223\307\2236\234\0220oX\255,\234"
+	.ascii	"\231\030\016N\234\260\032\332\304\b\261H"
+	.string	"\023\343\r\201j\250q@\246\224C#\"\"\"\"I\222\244\003A\005\204 ')\255\007\021 \255\263h\212$I!\313\030\264v\240\252\201]["
+	.string	"\357\223A\222\224\316\007U!@\311e\336\006\260P\210\314g\375[\025\222}\304G\363\022\351r\363s,!@\207\247\"\350\220]&C9\361 H\371B\230\266\3028l\021\245\327\312\301L%xn;\312,\201\265\022\"\215\376\250\017\030\263\224"
+	.string	"\217b\345\317/\025\231\3141\002\376\340\256\341\325_\215%\333\230U,\177\356o+\021\321\331\001\222\241o\327m\226\004\2246\022\277\253\036\235\302^\200\225hY\020]\021\307\357\021\220\200\303\t\\M\202E1\236+\026\262n\363\257\003|!\235f\370T\024\326\215A'Q\ni\233\300\233\306\252\271;\210\310E-g\376\301\216\335^N\024\343K\2017\346\340{flC\367\375\364Rd\301\260\265\205\220@\301\231\342\200\036\321a\031m\211\244z\246\236\330\200z<\247\2002\230o\255\243\352\235\355!.\227\366\302l\004\237"
+	.string	"a\257{iT"
+	.string	"0,\366\021\3078M4\247\371&`\270\004\215\345F\332E\022r+l(KXes1W7z2\020o\020\326\034\254\341m.\024B\211\305n\340-5\300\307\205\265PO\352\357\311\270rNkdm-\216\374\304\344\224\213\020d\304\310\264\373"
+	.ascii	"\233r\270>\035\004\351\272.\301\243P\b\204\233\021\307It\n\321"
+	.ascii	"\220)\307\017\243\361\257\f2bYe\362\355y\264\021\344\326\377"
+	.ascii	"\262_\363:\017\016\005\3773\211O\f\022\242\261\024\247\353/\235"
+	.ascii	"\311o\223q\022\300I\271\224`3\016(\001\256\222@\322\253\374i"
+	.ascii	"\250t,\315j'\326\330\324a\303-\206_\322\311(\235%\306\304\205"
+	.ascii	"\310\207`wc\223\n\304L\204W\263\344\355\\\310\037\353-\241\005"
+	.ascii	"X\234Jc\373\222\310~K\270 \224d\360\b`4\004\f\253\204l\3265\201"
+	.ascii	"\312s\020B\231\330\036\002M\334\256z[\027S\2541\236s\231o\327"
+	.ascii	"|\304\316\033\240'egv\221o\356^\210\216\226\007\247!\335\266"
+	.ascii	"\2660-\231m\300\367m\257\021\220\032fD\337\370z\262\013;\342"
+	.ascii	"I\020\253\037\251\177\021 \356\300\013,\2108\364\013\\O>\024"
+	.ascii	"\330\317\236\217\3663\344\3200\307\326a\363\267\343W\357\332"
+	.ascii	"\374\005\030\213\203\247\365\224\372\231\360-~\267%\303\007\316"
+	.ascii	"Su\017\033\306\200u\346\324-\315V\221\215\262\263\334\035\036"
+	.ascii	"\202\037\032n\252\274\324\337\365\217\322\317\022?-\026*\343"
+	.ascii	"Jxc\b\237\024\340E\343P\370]\262\250\200q\337\226\255\347\203"
+	.ascii	"t\025"
+	.text
+	.section	.gnu.lto_.symtab.bcdff6c4553e1720,"e",@progbits
+	.string	"writeStats"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"writeStatsEntry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"statsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bcdff6c4553e1720,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1627 @@
+	.file	"tasks.c"
+	.section	.gnu.lto_.profile.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375 \261\325\004"
+	.string	"\204\b\245"
+	.string	"\017"
+	.string	"\354\301\314\336\005"
+	.string	"\001\314\345\244\232\005"
+	.string	"\002\223\317\352\353\001\002\002"
+	.string	"\002"
+	.string	"\004\276\376\210\236\003"
+	.string	"\006\275\236\357\212\016"
+	.string	"\007\313\233\235\316\016\002\002\001\002\001\t\204\337\376\243\007"
+	.string	"\n\376\376\316\323\004"
+	.string	"\013\376\303\253\241\n\016\305\352\265q\017\202\312\321\202\003"
+	.string	"\020\316\305\360\246\003"
+	.string	"\021\256\336\231\302\007\026\002\002\002\003\002\004\002\005\002\006\002\005\002\001\007\002\b\002\002\t\n\002\013\027\346\300\255\206\004"
+	.string	"\030\300\255\361\243\005"
+	.string	"\006"
+	.ascii	"@\fP\306v\371\214jzT%\316\006\332"
+	.text
+	.section	.gnu.lto_.ipa_sra.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375 \372\205\003"
+	.string	"\244\002\356"
+	.string	"\016"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001\002"
+	.string	"\001\004\001\006\001\007"
+	.string	""
+	.string	"\t\n"
+	.string	""
+	.string	"\013\016\017"
+	.string	"\001\020"
+	.string	"\021"
+	.string	"\027\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\036"
+	.string	"@@\n\201\244\b\310q0\024\002@ e \346\275\\\306Q\006n\f\025\334BQ?({.+"
+	.ascii	"o\023v\234 \227\013\303\330\344\003-\223\212\033gm\347\204\225"
+	.ascii	"\033\240\ftZ\2009\\\025~6\200\005"
+	.text
+	.section	.gnu.lto_.inline.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`+\003-\n"
+	.string	"\322\312&0pK\323\030\344\307=\312,\240\236\002\271\215\227`wT$\211\034{\303\203\022\370\004\217q\360\273\377\377\017n\274\317\232u\023\262\327Z\263{K\231\002\377h\236\025\315\324\001\275\250\350\360\270\020\350\307U=\244\303\224k\001\203\343=QL\202\035}\373!\027w\367\355|Jd\026\365\206K\361ur\032Q\0350\300\337\347\3242(& \240j( $@7\315\314/E\375\237f\341 @D\240md\026\345\254K\321\321\200\326\260\273\220\363\225\371\202\3355x\375\234tw\267}\264\263\004G\2501\272\021\t\204\0246i7P\"B\205\346\001\022\340a\251\002\006dA\306(\2012F\211F\tfj\266\367\330\223V?E\r\200\351\337w\302\322\211\346\365\275\177"
+	.ascii	"\222\342\272\245\025/\354%\007\\\226:K\3437\216iT\312\217\251"
+	.ascii	"{$\254#\221R2\371\234\254\002\204\032\244{-\347N\016\333\246"
+	.ascii	"a\231\310a\206\bM\313Jk\210fl\231\004\352X\371F\376 \300\336"
+	.ascii	"\352K\002\272\240\263\252c\315\f\274S1\245Jh<\266B\005LV\252"
+	.ascii	"\344w9\267[\215U*\312\"9\320\243\314\022\036w\3541\034T\245\271"
+	.ascii	"{"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`v\004-\016"
+	.string	"\346\22195P\245&\3510+;\305\204\313\262cY\005\376`"
+	.string	"\222\210\252\252\272m`\253\231$\266\303\361\235\315l2\231\fX\236\251\255c\177#\255\233\265o\1777Bv\222\001("
+	.string	"'"
+	.string	","
+	.string	"x\023\360\206\035\n:C\r\016\360\205\241\351\006\310\241\346\\\213}Y\226e;Ow\236\333^\016)\034\177\n\333oU\b!\237\241`\373K\366K\342g\033qnM\"V\302\214\271}M\241\274Itm!\215\260\b\233 \361\201\370y\315\311\347d\231\217\007\004RAQk\262\252\336\033b\304\267\254\037\306\003\246\370\211\321\365}\336\347f$J$O&\022\353\265Z\342#\256`\273\316d\235\360j_\351&#"
+	.string	"\243\033\343/\216\"\251\303\322\261t$)\022\2610\f\233\246G\216\266qi\334\232s\210\220\305\350\004\024<\357\201,\203\240\177\2501q5#-H*\225e\f\360\302!2\017\021@dj\314\220\214\314h\201*Y\326b\023\320\207\346\371\270$\225\2613&\030\301\022\330\t\032h"
+	.string	"\257U\022\212\031\302$Y\321\372\353\2662)m$}\023\030\017\322\3258\274\213\372\bWb\022{\207\254\204u\036P\236\235\246b\314'\364\307+\023\245l\0325wW\256\202S\345\261c\210T\321\375\200\306\032\236 \203\265]q\2223\237\030\335+\216k\217\\\0161@\350;\207\021E\222\371\017\274IQ\025\223\202\244\261\370\231\016\250\273y\221\237\301\222\031\031\325(YYnZR\037("
+	.ascii	"\216\303\240+\204\252b5\233\306\034\320\214\336a\353\205\r3\223"
+	.ascii	"\271t\3722\231\301,T\340\223\205\240\364g\234\341\265\004\240"
+	.ascii	"\370\231\204\036\25080\003"
+	.text
+	.section	.gnu.lto_.pureconst.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\200\004\001\230\004\002\230\004\004\230\004\006\230\004\007"
+	.ascii	"\230\004\t\230\004\n\230\004\013\230\004\016\230\004\017\230"
+	.ascii	"\004\020\230\004\021\230\004\027\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375 \326]\003"
+	.string	"\242D\017\031\260\325r\f\3030\f\3030\020Zk\315\310vs\215\355\035\213K\266&S\n\204\355`.\330\006\346\320\0260\277\346\326\274\332 5\237\266\322\212G\247a\224\004\211\366\241!\341\356v\261\020\023"
+	.string	"\277\231-\3006\026\"\240\270\252.p\356!X\230\204\267\200rIM\330\305"
+	.ascii	"\001\263\020\f\bA\260\315`\001\301 \353\r`\001"
+	.text
+	.section	.gnu.lto_.lto.2d5234ea44063478,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskMain.123.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375 \362\235\006"
+	.string	"\242\214.2pm\032\003\240\361\207\034C\314\272\342\206\207\241\003\005C?\0137\206\232H\b\364\246\021\273(j\313\250\030\370\353\003+U\305\372\031BO~\267$R\246\024\222a\362t\026\252\317\024#\004\f(\334H\007\311\251\036lx\237\016\307\363`\224oCP\352a\212\257\242\250\3702\327\335D\325H\264\211\366\002\261\226\321\332\362\377m\242\226I($\005%\177\305\212\312G\234\bG\246\255Y\353\016{L\177D\024\363_\214B\376\013\241\007"
+	.string	"v\032\017\\\354,\026\270\330u\266'\2766.a\230P\200\244\374\177M\303\323l\326\036\031\023\262@f\222\302\377\262\220e\3416\2675h\233\320\326\n\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_taskHandleSerial.124.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"%\013"
+	.string	"\206\224L>\0201\324t"
+	.string	"\300\313m\311\204*7x\016L}_\211\001\005/\372C\026\003\203\241\237/\306\326\264\335\336\333\266D\364Y\373"
+	.string	"\2517"
+	.string	""
+	.string	"\"\020\n\246\250. \353\370H\300Zo\262eJ\0019"
+	.string	"<"
+	.string	"8"
+	.string	"\273\232\f\361\357\363\222\372\371\220\320\363\371\030\375\222\242\026(\032\251pty- \315\3300 \f]\022U\311\306O\327\f!H5\243\354\256\025\fE7v\333\016l7\260\177 \252\352g\017\306U\016\0048v5\264X;\316\030%\"\266\257\366O\034\305w\323\005\003\330\365\340\342\305\256\310\300\n\036\237\t.\301>\257\027\300>\375\3317.\212\330\254\304\302\260b\265\001&F\220\364\234\004H\032\245;\330\245\004T\215\220\356\260\237\342*:\376\b[\340\350\301O\237\203}^\376t\002,dp\370h\313\026=*A\330\277vw-?\3307\375\001^\004\013\346\002A\223\261t\335f\023\340m\342Q\360*\032m\233\240e.\025\214\266u\23661`\256\202\245\3234\034\327i\021qO\371H\320\204\250\215\341\244\302\320\241\352pej{\033=\350"
+	.string	"\251\023"
+	.ascii	"2\003\302p\311\302Z\021h`\366\202.\240\326\005\256$J\026\\\025"
+	.ascii	"aW\322`\241\300\224K\260\304j\312\270\3137\333\223\n\263\242"
+	.ascii	"VA\001"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.125.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\255\013"
+	.string	"\346UPA O\234\01601T\221x\242&\245O\016\271\304\366\252F|\200v\2023\307@%\303\246l\3422B\204\003(\320\250\034>\3367-\340\371\217\3254\001\233pp\343\033@\310\235\205!\350\223\275\267L)<"
+	.string	":"
+	.string	"?"
+	.string	"\266\213\203\247\225x\234L\"d\354\356\0251|\273\214\272\371G}\342}\334\245\205G\211I\221\210\021\340+I\313\206\006\357\250+\205\257S\225$\330]\253\367U\270\347m+\260}\300>\202\366\345\356\256c\207\255j\353\037\377T\365'\224\324\n\314\210\335\215\221\031\033\316\022\033*\266\257\366;\334\303\366\217\t\236\354^8\021\262\013\032p\001\353\223\300-\325\247\274\200\352\323[\216\240\351=k\200\240\b\273\310\375$\222\n\211\276TV<\352\026\213\020-J*\342\377R=Z\321j\342\350\376\341 D~\006K\030\351\275O\177T}>N\030&8p\220t\304\0069\215\036\001Z\203\215\207\303 \364\331d\231\b\003`,\243u4M\350\302\034\\\037\216\306sa\231ve\006\030\004a\223]!\020(\273*\340^n\354\360\202\027!)v\0174\212\212\212\316hw<\n\222\",ENZ\352\023"
+	.ascii	"3\241\201(\006\210\243\\u\330\246a\254\232\023]\206\007x\023"
+	.ascii	"%\013\256\256\260\213\037\314\261(\373\n\246\\\202%VS\304]\236"
+	.ascii	"\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.126.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"m\b"
+	.string	"FP<8Po\322\001p\372\311\275\252\262S<'\306\364h\322\005\f\354\315iZ\034Z\326,\342\274\267\004b\220\276.\202\324\005 Qn1\277x)\002\006\36215k\311&[\246\024)"
+	.string	"-"
+	.string	")"
+	.string	"\227\376\354\230\207\036\273Q\205d\240\310\354\356\214\035\377\256\237\177\222w@T\351\272a\330]+\210\332\270\343m\037\330^\260\255\022\366W\277^"
+	.string	"-\227\204\227]\215\232\326\262$\013\210\307\366\325\276\310G\276\257.\334\331\345hY\331\r\025\214\300\27148\001vy}"
+	.string	"\013\352\237L\274\344&\235\377qi\022\205\036\274\f\270a\260K\215v\205\205\036\264\246\314\2600b\311\016O\032U\366\257\335]\307T\335\203&\n9x#\215\343H\231\200\263O\027\321\201\274\231A\314Q\b$\232\031\327\315O\2017\t\215\233\336\266q\323\023\232~mL\271\201\206e\212's\002\t"
+	.ascii	"2\241\243/0\\(\033\025J\301\220K\260\304j\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.127.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\265\t"
+	.string	"\346QC=0\345(\035\300q\343\017\201\267\217\230\033\025\313(R\363\026\\(\241\277A\n\216\345\326\344\376\3210\207"
+	.string	"5\210\350\303\234&q\241))\234A\003\355@\236N\026\321\230\210\266O\366\226)\0050"
+	.string	"4"
+	.string	"/"
+	.string	"\273;\243\311\277\313\250\237O"
+	.string	"\236.9!\2172\2015B`\003Q\262#\023S\375u\365"
+	.string	"S\252\233\317\356ZW \310\255\335\266\203\355\006\333\002\0023\0131\273\037\263\002\033\323`P6\333W\373)W\371\356\322\360\300n\311\013l7d\260\002\347Z\347\007\232k\362\006\232k\376\354"
+	.string	"\017Ov\323rQ\261\f\b$\263\226\350\f\315c\304\n\200\224\312\254\251\214\366\005\206~\365\370\327\337\301!\022K\305\223\035\2364\266\354\313\335]G\226}\327/U\375\315\006\013\036Dh$z0\221B]g\301\025\230\363x\023\036\31049\211I\022\201F\223\353\274\351Ap\211\"\324MS\251\324\315-\334\1776\"Jr\324\256\360\364+\307\313\002\017"
+	.ascii	"2\003\302p\036\302V\rt\205\275@5\017\274\264\356}\027\326\013"
+	.ascii	"\300r\261\226XM\021w\271\251\366h`j\017"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.128.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"%\n"
+	.string	"6\023G@ \3078\035"
+	.string	"o\034\214P\024\223\b\235\205`\236+\222n\336\021\020s\326\204\003\370\226`\2126`\003Q\203\006\263vF\316\227\021\246C\206%\t\001\200\315\224\373\024\344\374n\2230\303F\366\226)\0053"
+	.string	"4"
+	.string	"4"
+	.string	"\233,9\370)\025\364\277z&\024G\237\230\221\313\331\340\002\220\340\3435D,M\215\311$\374\352\n\"\222T/\020\273k\rE\221\033\273\355\b\333\017\266\021\004\r\030l\013\013pb\177\264\265k\266\257\366Q\236\002^\325\341\314.I\013kwt0\003\346\330\3025\331\261\371\204\354\230A\373\300\307\324^P\006>V\024\354n\251\227\213%\315\221]V\250\024(\351\313\231\316\2132[cC\037^\036\260\bh\225\344\310\036G*Q\366\347\356\256\345\311\276\352\237\252\376E{\r\330\020\3305\005\037E\347\343\231\b\201:\236'\342\020\314m\276\213\217\023\3328\213\r\344\341|6\316\373\266\215\202;\214\216\267\205\272\316\333\264q?W\236,\261\240\345!I3\243v\227\241\017-\037\016"
+	.ascii	"3\241\367/\306\325PU\330\013T\363\300\013\353\336na\275\270`"
+	.ascii	"\251i\221X5-Nr\314+\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.129.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"e\007"
+	.string	"r\31646@o\323\001\230NL7\f\247\345+\223w\314|\372\200\335\322\365\276s\006S)q\202\240TP\233tD\320U#,\004\034\003KW\266\336\304\320\374\370\326\332\226)\005\332\303\005\3728l\241+\313&\254\200Z\035-B\363l\321\202\210\241\217\007\024\255L\213\235\202b\022W\0267\f\313\"\347\273\251\303Q\033VN\027\020\243T&l)*\322^\263$\345\224\001\273\366\353\022z\264\246\376\277p\324\332d'%\240\322\262`\362o\304\300\374T\241\200p\332:[\207X\204\263\311\242\233\277\203\345\344\377\022\212"
+	.string	"\340\312\300\004\031W\224\0072\256\312\265.\376J\327\220J\032$/\377#$\231sr\265G\274\361D\235S\303\360\277\351\2118\\\350\266\007m\025\332~\004\b"
+	.ascii	"2\241a/\360\270\340\n\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_taskTelemetry.130.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"\245\013"
+	.string	"\226\226QA0o\223\016\200\2050\200crr\0328\016q\2341\001?)\034C^R5H\261$\023\216a\377\023\254\177\f\310B\225\265\326\277I\2663\363\326\200\311f\347Yk\t\241J\277G\241I\333{K\231R?"
+	.string	"<"
+	.string	"?"
+	.string	"${\031)\261`\"\306\356V:\362\354\360if\376O\216\3318\355p\322\360\227\2418R\352+\240\222\002\006\305Ux\032\020\020\333O\236\027\270\217\314K\202\335un\034\206;\336v\003\333\034\373\234\177\273\273\326\020\373&\177\314\264f\372S\206\205\005\202\023\273 -,[\202*J(\333O\373\">\"\273\t\005cv;\240H\331\355\f\230\300t8\340\232x\370\036 \036:\263]\274\013\3670\345\264\227\020ml#\277\251:\340@R\355\356\264\237dE%EU\304\357\210\327\007(-H\271b\237\304Kt\370\037<\201#\277\035\372\034\361\360\252\031V\310\330\340\221-v\247\245\212\330\001\030\003O\350\263`\244\341\271\256\r\013\200\255\r\006\302:\243\312\202Pi|:\241\312\272\260j#\300\242\b\236\253\032\211DWEu{\r\261\202\031%\017\375\200TF\265A\241\374\346\247\232\017\224^\204xG\271j\021"
+	.ascii	"3\003\3369\004k\250\212\355U\205^V-\r\234\321U\370\004\327`\001"
+	.ascii	"\226\213\265\304j\312\370\345!4Y\025&h\254\312\235{"
+	.text
+	.section	.gnu.lto_tasksInit.131.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`K\013\3453"
+	.string	"\352V\314\022E`\246\326\030+\f4\017\326\214\363\322\353\247H\353\013\024\273cMi#\234\307\232\013m-\004P\262\214H\311\305_\245\237\016\366a8]~\330\rm\224|\315f\316\323\376\347\255\362\315\312-\267\334\222-\245L)\245\030\001\003\001\035\001<d\235\205\2543\220u\376\261\316\276w\356\265\316<\326\271}gvu^\337\371\337\331\335\271G,\307l\355"
+	.ascii	"\373\362b\326^\253\2737/\225\265\"\244\317\272\323\332\231\273"
+	.ascii	"\321Z\215\201i?ic\316\314\032\364\232e\005Hn\237\305\bb\256\275"
+	.ascii	"V\021\324\350\316\350\336wM\331,\027\365\232e\227\371L\257\205"
+	.ascii	"\275\315\346\345\351\204\356}\337\345\203\265\333<\311\035\244"
+	.ascii	"N\316\321X$\016\205A\340\317\327\343\265\354\372\356r\363$\370"
+	.ascii	"\240Rf\363$\315\204\370\016OB\217\032f\215\\\027L\321\355\350"
+	.ascii	"\270h\2205h\367\f\323eQ2\3271\033\363\034\261>\212\031\343\242"
+	.ascii	"?\200x1\254\211aeQ.\037\206m\271P\253\203\035\027\325\022*\213"
+	.ascii	"\356p\240P\217\032Y\375\313r\237\216\262(\226\367\342\2429x-"
+	.ascii	"\225\243\333\241\364\t\224R9;\224N\255A\357\373R\371j\243\177"
+	.ascii	"=P\255\322"
+	.string	"f(u\256H\253 \320Vk\257\2226\335y\022\336\367e\207Jk4\3674s\2531\363\005\346\237\203vU\267\377)\267\213\266\375\022L\3108\335\216\201\234\231B\005oh\373A*l\250M\366\177H\317\376/m\356\031G\2521\264\353#}\303y^iZ\350)\030\244t[\006\r\0336\264\315\256\237\202\253\310\026ZZ\322\377\273I3s\350\020\344\017\301\271\326\214\245\375G@\225\244\351w\334\357\337\3178\314\037\032\n\210\336\373:\031p?i\266\020\334c\315\262\b\022\336\320f\271I\264\315\366\303\340\032\333BK\223\362\273^\214.\272*\321\217\272{\251ef:At\243N=\223\201\316\254\242\311\033\312:n\250u\325\3463\231\327\232\376S\346^\337\377b^\235\223\372\254\371A\2475#\275\263\201w.\360\316F\357L\200u.\3529\017`\235\211X\347!\326Y\350\235\203Xg\240w\376a\235\005\274s"
+	.ascii	"\326\331\347\235\001\260\316=\357\314\363\316Iw\336qg$\353\254"
+	.ascii	"\363\3169<\347\343;\033y\316\305w&\362<L\367\306\235\277.\016"
+	.ascii	",7+\253m\026\371Er\303\237\262\216\353\3741\213\320\325j\252"
+	.ascii	"\322U\233s\3244}\345f\246\217f\324\244\347\374z\374\0346k\216"
+	.ascii	"\357\013\323Vg\374/"
+	.string	"\276\221\253\253h\212\017\264\321\206\204\370\336K\355\360\211\337m.\217.\343\212\365\336\367e\300-\327d\\/w\352\202\271`m\263\303\367\255\221R\027\374)[\370C\032\304w\324\005\276J\250\364nW\214\314\025\342\r\025~\320\312\020\252\263\300\007\201]S\317l\201?]\377\367_\254l\243\377\366\375\224\235\247\354\241\234t\253=j\243\257b*\235\364\255\326D@\276\304x\277~\322\263?m4\375\256\327\003\032y\361}\333%\3222\273F\334#\336P\340\363\224t9\237\271\362\0254\2630\336O\373\261\300y\231i\177\037\364\201\244\341\250\277o,r\376\276/\223\355\267\366\375\220\214\222\006\023\343\213\357Q|}\365\036\370\340{\377\203\302\346\252\265\274\177\200\326[\\5-\274O\301\365fM\272\221\214\256\022\2442G\235\352\260L'\224\242V8y\210b\301\364\364\344\202\302\213'\246\250(\245\tLP.\214\274\224"
+	.string	"J\005\224R\324r\311\304\222\005\n\245\246\345\322\023\3242\301\016;\265`zZF99=-\201kR\375_\314l\250R\337d\242\023\370c\321\023hV\360\206\026\275\223\251\275u\325\346T\023\022\036 \215\345\343\025&\227\364)\307\304\230\3109\335\256\251\340\244|\331!\272\271\3270\313\325\020\226\227\032\344O{\355\316h\007\374\023\023\271\247\203\2713|\352>\334*\032\256\225U\333\354\200O\002{c\f\276\301\3211*\373\341\264\300\034\217\332"
+	.string	"\321\227\350\021}\360\315\215\201/\346\210-a\343r\034\372\217si\017}\317\271\361\247,\364\037\207\325B_\364\326%\350\211@\037\264\002=\320\333\333\317\017\005\374\217\322{\002\276\350JI\200\027\372|"
+	.ascii	"#o\237\007\272\"Bu\002x_\317\003x\004@\322\n\336\320\236w2\254"
+	.ascii	".\036\022\353\255\253N\025\333^j\275\360\274;;\371\035\245y\276"
+	.ascii	"\333\250\222\354|\362\373I\265\363*\246EX+\\\210\356\215\026"
+	.ascii	"\371\335\346\312\003\200\345\250\221,d\031T3\"#))I\2411\220\002"
+	.ascii	"\021\241\242\352\006\0208\205\212J\223\f\007U\306J\f\227\202"
+	.ascii	"\355\r\001U\036\255\b{D&\227\n\312j\230\251\202\007\317\017i"
+	.ascii	"\361\210'\246\r*\2154\236\3318!\350\\\003yv\\O\322\336\3501Y"
+	.ascii	"\352\0375\032\236\013\222\255\227\025\212?\034\0035xv\025\212"
+	.ascii	"\363\202\313g\337\203g\331}\372\226\365q\177`\374\002$\236Y\b"
+	.ascii	"\"\013\"\fA\226\366\035\310B"
+	.string	"\023\214\324\363\240\3516\244\264x\225\301}\315PaY\354\370\375\237\316\232\375\004!n\362\035pU-\271%0\244\300\323\377\275\377\324\327\254\243\322H\334+\006|NFg\034\016\214\200\262\342\005\022(\245\236\245fw\030`E\344\244\"J\225\357\352}y\223\311\372\373\357\032\324YS\351\203\336\251XlL\224l\323'2\213\310\322\300\276\244dD.\210|\277b\344B\362\356\221\f\273\210[\r\034\005\031\024=\220\002\270\301&}\034\336\365\365Z}\3678\244 \327&K\373\360'\367\353}>v8\351\215m\210I)\342\316*50\313\350\312\007\3066\311P\253\355B\274\331\305\017\200k\017\201^\235<\366\302\2024\252\3636D\2461\305\266\271F?[\314\310A\330\203\363t/\007\220\007~d\207 \001l\220\262S\372\022,B\241\364\363\275\274\256\361\242\206>2\246~\315\247/Z\321an w\274M9E"
+	.ascii	"z\216\021\253Q\247\340M\004\023\037&nx\3719\257\024B\253\347"
+	.ascii	"G\237\"\226\033\352\243I\353\340\345\020\304\233\006x\336Ftu"
+	.ascii	"6\n\361\031\247\357~S\3321\330\271O\317[r[V\223)\272\253\001"
+	.text
+	.section	.gnu.lto_tasks.132.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`X\006\225\035"
+	.string	"\346\254\257I`\034v\003\377\221\036\224\342\327Y<\253\212\345\025\216\335E\254?\334\304`\226[\026Y\215c\254Q\022\20218\020\337\t5w\342\350q\321Z\377\231UM\353{\362\316\356\035\206\304G8\303w&\276\177\233D\354\366\373#\245\024\242"
+	.string	"\237"
+	.string	"\236"
+	.ascii	"\301\317\306u\341C\242\002\264\331\375\211\033\024\tt{\327\303"
+	.ascii	"\357B\307DuPM\235\037J\230,\231@l\357 \242\357\336d\242;F\354"
+	.ascii	"~\204\r\211\257\350\313hp"
+	.string	"=\207\227\200\037\306\016\304\356A\206\b1:j\357\006\305\017\224F{\232\235O\007\350\330\301c\215\267\353+G\372\262Z\225)%\320\r\350\372\332g\030\273\324\356j\307N#\251\327@\366\033\031\224\t\226NL\016lh(\300\024[.\357\r\355\215`\307a\311\303wylizC\263\\2\365\247\276\332\334E:\237v\036]_\271\024\316u\307l\034\265\312\251\177\365Q>\205G\321\317\272\276;E\245\352Ix(_\002\354\353\273kU\242\254\007a\373\020G\177;\211\370ac\355\335\235;\262\245\036\270_\366;@\243Z\334:\237\276\331~\351\231\374\207o\366\237\355\335\231h\037\302\323\213)u\313\030\273\031\273\237I\203\246K\245\375\0312T\312\302\2557b\342\306\364\246\257\366q\240Ip\270\330\275\313\027/\277\306\333\336\311\336'z\236u\253f\016\234\335\257d\301\002\377\332\273B\374)<\305\230\322\034*\033"
+	.ascii	"\336\354>\205\n5\002\260\275\213\002GI\274bR\311\3639\300\221"
+	.ascii	"\030\220\222<%$2\311\303\341\035G\317\321{t\037\235H/\322\247"
+	.ascii	"=Io\322\235\364(]J\257\322\255t-}K\007\323\303t2\275\332\325"
+	.ascii	"\3645\276\211\201\037\341\237\274\t\177\302\253\360R\236\312"
+	.ascii	"Wy,\337\364[\236\313\213-\3602\024\374*\037\245\315\366cdH_\026"
+	.ascii	"\003F\333\325w\235l\336\331\345\277\220>\f\354\233\265l;\257"
+	.ascii	" X\037\350\271\305\224\362dy-\377\242\257e}\367v\253\332X1\257"
+	.ascii	"hh}\327I\315\371\025F?e{\026.Z\244q\375\334\367\006\345\225\003"
+	.ascii	"\341\232&\322,\207\353\327'\034\262<8\023\177+\237\341Z\216\037"
+	.ascii	"\260\334\027\013s\274\327{s\365\353\362\241\331\206\313o<\303"
+	.ascii	"4\313\201z\365+\244c\237\313\341\337[\313A\241:\b\236\347ao\207"
+	.ascii	"\323\365\f\313\257\021q\206\353\372\375\321\341\264\360\227\343"
+	.ascii	"4\375\n\201\301^\313\203\363\373\263r\3307\254\343Z~"
+	.string	"]N\234k\030\b\313p}\303\341^,\004\373z\263\313\207\202?\3018(\026\272\274\350\243<*\217\224xE\013\274\013v\200\221\250A`\212 3*\252Si\016\020#\0211n\003\020(\205\310\206\252\320\030I\307\024\035M\3039\250\353z\232S\304\260A\205\211\304k\333\256\321d\320s\240n.\300b\211-\305\244\212\013\004\223\240\303\332m\231\255\nj\372\377\311\210\332@\303\234\177\223-\363SQ\020\243l-z\264\030\031\243\005a\362V\002<\264\036P\213\206\242\234\263aD\316\035\267\261\032.\274&7\027\032\232\321\234\227R\"\272I2\245c\334\177(h\2201+\202\0245:T\302h\367M(\253\274\315\253,J\241&\006X\362`=;\204\252p\211p\336\364\336 \276Oy\343D\016\276?\242\302\021=OhO`\276\305oX\313\006\007\351\320\376\200\212L~\005by\232}:\234\210\203\252\375\214U"
+	.string	"\303\262F\363\222V"
+	.ascii	"\216l?\036\273\361-\020\205O\226\017(\360\367\370"
+	.text
+	.section	.gnu.lto_getTask.133.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\265\b"
+	.string	"\346\220=90%'\035\236\365D\344\022y\224WJS\337\245\364\b\035\257\352\324\252\013\205\200\266Ij\223\373\004"
+	.string	"\262NjB``\200h\030|;\301\026;\017\205c_\373d\223-S\n,"
+	.string	"."
+	.string	"+"
+	.string	"6\034\252\233\335)=\357\271\0369'\270\036\241\310\275\253\347_\345\026I\200\232\317D\272\0068\354\256\3653\235nx\333\t\266\027l\323\0041\273\035+"
+	.string	"+\023_R\266Gv\307\266\252}\224\247\214>\025,\260\373Q\342\262;\031\214\300y\374X\266}\223\237\214\354\031L\324\351J\005\234\007\265\273\r+g\271\360G\036\215!\322\177\217\276\350zT\370\317\243\244+{\222\024\206\330\267vw\rA\254\237\377\255\003\230\031\215\020\017!\016\353.g .\304a\235\314$d\305\004F!\263\215\223\240\002k\026\021\233\3544m\223\235\271\267\302O\tn\330o\361\006P\237\355\214\253\002\013"
+	.ascii	"2\003\302\260a\234\"5\246f\323>.\243&\025\355Z\305\203\273O\252"
+	.ascii	"\025\2230\311"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.180.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\215\t"
+	.string	"\246\321?9@\305(\035\374\002\247s\013s\\\310\315\016\265\017\013\301`\327\253\024\232/\223\034\037Y?F\026T\373\224\244\221\230\305q\025V\344\300\002\013q\036\221\322$\203\264vo\271S\n-"
+	.string	"."
+	.string	"."
+	.string	"\366\312\277\220\305\250V\033%\257\335\235\227\252\272w\205\321\363\337zV:\221\256\001\247\216\303\202GL\303\356\032\363\270\345m3\330^\260\237\005\020\376\033\235%\212\337\236L\206\320\376\310I\274\263D\316vALPv?\205K'`\227\b7\270\\\306g.\227\366El\217L\273;\355\005\035\301K\302\253mq\001_\262\300\t\213KCIPS\326\030WQ\366\277\37723Uv9\002\264\354\207LY\331\276\375\326\310\326\264K\333\001\035\004\307\323y\b}8\034W\261\rx\323t\022\335&4\267\210\371\351l<s\343\272\25190h\202\303\315\020\b\304M\355q\025e\007"
+	.string	".\f\315PM\331\306(\002\023"
+	.string	"\031\213\021\261\002\343\202\271\212\f8l\323\360\233-\200\367"
+	.ascii	"\nW\343Em\2753\b\312ygvZh35p\355\305\224\323r\372\265e\f"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.181.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`3\001\335\r"
+	.string	"\206\231\\D\020\217(\035C\032\221\006{\031\024\024\351)hj\357h\342\310\003@\223ifu\025\240\217?'!jE\277\037\33416\b\254\322\271&[\200&*\002\263\017\001K@\036\006\256\220\257\321X\361\t!{K\231RF"
+	.string	"I"
+	.string	"G"
+	.string	"\266I)\227l\026\017Mf\246Z\021\302j\231sn\227[\362\322\343\252,\371_\035\363\201\246G\375@\013\337X\340e\302\005"
+	.string	"\020\0255#\035\276\273\256\"\340IU\3432c0\347\264v\341\306n\333\201m\005\3663\004\276\210\253\370\256\026k\344\r*\234`\312f\2154SJ+\001\322\362B\240\035\345>\n\311_9\223Bz\350\261\321`\340\322\252\366A<D\351\241\2071sr \2612gx\340\322\004\264\313\3155\330e|"
+	.string	"\3542sy\017\001'(Bb|\350\213\3677qy\255\354\252l\217\260\357"
+	.string	"\f)TT\240\324\305\231\332^\207\376\373\336\365\227\210\264`9\255IW\345\225\217sI\354\250\326\267\356g\032\013>\3149\362\002cn\220'N\336\372S\256\366\003\034\3103!\002\207kP\201\003e<\b\334\307\363@\004\342\272\256\243\223\341\316\206\307\341qD[G\302\006\362p>[\247\363\266\r\001\016Q\340\272M\024\nu\233>\316%Y]\033\361\202\345cO1\243\272\232s`\366'\244\377\274\001Y\223\277\272\t\002\035"
+	.ascii	"Q\013B\272\00171\356\ft/\365\312\214\306\022@\036\030\341\212"
+	.ascii	"Q\217\025\n\030\002\344\003\031G\201 \253\211\3110\274E\243\024"
+	.ascii	"\326\005\242 \230{\206.\352\234N\013m\246\3544\020\\{1\305\241"
+	.ascii	"\251q\357*c"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.182.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`\031\001-\r"
+	.string	"\346\230XC\020\221\232\016\323\025\340\023@!\020\350\321O\030\200wc@;\243\350\270w]\3234-\270\271\216\254i-\276\025\033r\020\f\252\276\021\b\240I\221v\005 's\300hUp\350uoh\205\376do)S\nA"
+	.string	"J"
+	.string	"A"
+	.ascii	"\273\237\202G\033\240\036\253\017\230\036\341\005L\217\233\307"
+	.ascii	"\237\260\375Y\261g\327\370"
+	.string	"\027b9>\324\210H4\273k=*\210{\327\204\236\017\272\002\300\220\341\371q\310!\262\273\2464\334\361\266\027\330n`\177C\376\364q`\306\256J\251f;D\031#.\363\303<\355\333O\361\361Y\234\344\215\2149!\237\307\234x\305\346\204x\2179\251@\337\252p^h\240\240a@=\302|\376\241T\034\022<:\323\276\212\257\360\376\241\270c\327\003\214\030\001#U{\304\223\037\271\272\240 \247*\202\027\033\242\033\177\201\351\232\352\024\261\244d\311~\213\273\320|\021\256\300\345G\217>7=^O:,A\342\205\t\226P\226R]\254\360p\265\305\216i\205\351\204\031Ww9(\341\036d\335eB\341\262\220yp\0212O\007BG\222m\233\t\026\300\030\b7\302]\235\205I\260H:\227\307\3026\316\002!`\255$\333\254N\3236kc;\257-\026\ti\212\252\213m\217\374\f\226}fB\207\332\r=\033"
+	.string	"8g\340W\357\201$Z\306a\025\272\262\n\020\020\005\303\\\341hc\305\346*\244\316\023\257\f"
+	.string	"-\f\365\224\302b@\036\b\341\236Q\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.part.0.183.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"E\t"
+	.string	"6\020<9@\345&\035\340ag\274\254\216\361\364_\213'\363/y\250\207\265\013\0178\332\276EP\037\243\t=H\036\034B\312\325\314\261\261\230\214\006xm\370\006\030\002:\332\266\275\345N))"
+	.string	"+"
+	.string	","
+	.string	"6\314\277\220\325\244T*Rbvw^*\310\275+\214\236o\272r24\016;\217\032\320\356z\263q\313\333N\260\255`\337\n\252\356_\311\323qpi\b\355\237\034\305\373Wr\300\356\007K\313\356\207pi\203\315\245\347\004\231\313\370\201\314\245u\371\022\333\035\206\275\366f\221HhKL\300[\370\253sVF^Nj\202\232\262\306\307U\224\035;\013\034\273\027\001"
+	.string	"\254\207t\021\271\352\366M:\177e+[\0036\0221p$L\323\".\001_\237\355a\013q\363r\230$Qh4/m\233\237\002g\020\2306\271,\323\246e\033^Q\006Q\350I5\025\027"
+	.ascii	"8g\340\256\266\212\024\034\243\331\032\234\342\002\362\300\b"
+	.ascii	"W\214Q\023L\017\224B\\p\n\214\271\247\351\242\332\351\\\320\246"
+	.ascii	"\313\316\005\200\023\017\344hi\372\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`z\007\235\025"
+	.string	"\026\341xF\260\330I:\220N\030\360\233\362\345\323\237c\230\303\333\b\236h2C\260%Fv\301\312\250A\260Xb\202N\177\322~"
+	.string	"@\332\f2\022\212\215$\301\t\250E:\272\210z$;\306\377\227\220b/\204\372\264\332\227$\355d"
+	.string	"b"
+	.string	"j"
+	.string	"\276ad\037\262\"\367\220\2014\013\321\r\203\301\345X7t_\351\276\3133]\355\356\262\224\262\243`T\312\236\261\001\367\023\013\335V\272\333M\027\334U\202\274%\003\272A\n\202\024\313\317M\305\263\227L\301e\032\003>V\"Kp\211\006\301M5\243 \b\366%\345\245\344b\345\032J)\265]\232\351\244\224"
+	.ascii	"^\004%n)$\356(#\356&\"n'!n\033 n\032\037\356$\036\356\252\016"
+	.ascii	"\267\310\341\346\332pO\321p\3472\334K0\334L\350\205\033\211\205"
+	.ascii	"[\253\302\235\325t\037\241pcM\270\215H\270\213D\270\211@\270"
+	.ascii	"\207<\270\257\034\334B\230\356 ^\272\201X\351\376\341\220*\311"
+	.ascii	"a\203;F\207d+\234s\034\005P\270\2716\246)\2465\266\305\3239\322"
+	.ascii	")\362\214\2745\350\316K\0310Y89\013ewUa\205\021\345\254C\234"
+	.ascii	"u\262\271\031\272Y\233\220\315g\263\3362R\230\030\257\031m\241"
+	.ascii	"n\264\240\3316\315\200j\326\243O\267\026\273uh\347\304\306t\371"
+	.ascii	"\351\326\346mq\313`q\327Xq\343Pq\353Hq\357@q\3638q\3170qC\tr"
+	.ascii	"j\ni"
+	.string	"\256T\235+5z\207+\027\346\233+\025\372\300\025\027\231o\256\0131\252F\215Ou\356\223\370\024:\215Nb\355\031{\302\333\\\236\312#&\315\345\tw\352\3167\267\300\210\233[\033k\242\322\334ZXG\334\\\002\242\2001@\365\352\\\017\247Z~\321\362\225\273\315\275\031i\343\\Z\2704wV]\277\271\001~\250Q\024\f\331tY\255s\360\002\021\242\2421\021P\024\2071\214D&\224\230\241\017\016\242w\013<\177\212D%\231\230t\335\362\261}i5\235\315\303\2614\001n%\374'\004\0358\177\274\r\234\036\0329\247\340\234\3646\312B.\235\220\321Y\325QW\324&\263yu\210\334\340e\340=H\353\225=6>\233\364\215\005!Drw%+\253\253\223\006\301]\232\364\263Yh){\211\275e/\261\267\354%\366\226\275D\222\326+\335\222~\025\336\215\341\200TS\275N\210\367\335'\\a%-\205\237"
+	.ascii	"\022q\206\3471\0078V\237\277{\225l\205\210\177\200$\366]\324"
+	.ascii	"dBs\216~\007\2078CE\343u\313\213\r\223%9\330\362\265\276\334"
+	.ascii	"\202U"
+	.text
+	.section	.gnu.lto_.refs.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375 \214\205\003"
+	.string	"BH\031!\220+\215\001\377\377\377\367\273\273\273\273\031\\W6\260h\333V6\2649\274\235\037\r\022\242M\222L\001R\256v\276\003O\226\374\324\221!G\027~\354x\335\230\361bW<5o:q\232A\350\245\251\245iE\322JRJ\322\306\2241%0}\230\256\203\006(:\327`\227`\250\361\036\235\363"
+	.string	"\257\363\032?\025\023\002"
+	.ascii	"7\003Q\301\034\003"
+	.text
+	.section	.gnu.lto_.decls.2d5234ea44063478,"e",@progbits
+	.string	"(\265/\375`\nu\225\347\001\352\017\327\255U \fQ:\035\235\322\343\327p\177\3610\210cP\3658\026\0065\223qv\306\013R\276\353\346-;\210.\376o\327\354\202\363\371]\303\021\0348\334\332\267\362\002\277\335\324\353Cs\211L\354f\027\344l"
+	.ascii	"\337\313\006\022\251\bp\022\347\b\177\263\222&\267\334rK\231"
+	.ascii	"\002\347\t\345\n\005\013\313\275To\030\354}yeK\037\245`R=L\247"
+	.ascii	"\246\211\310=\321G)\227\274\2554O\037\245^R\274\265\311\223_"
+	.ascii	"Y\264\206\031\246\253I\203\376\233$\256\327p\316\376a\030\376"
+	.ascii	"C/\374\207u\374\207Q\370\017\225p\275g\313W\300LE\263\376\241"
+	.ascii	"\021\376\303.\376\001\316\331i\227\232\245\f'X\262\376\241\017"
+	.ascii	"\376\303\032\374\207/\370\017\221\370\333\374\361\267\031\303"
+	.ascii	"\337f\217\347\330l\341oC\205\3477\236\343\304:;\207\341\234\275"
+	.ascii	"{\225\224J\252\346tcf=\245\247X\276lH\311\372m\324R))\334\036"
+	.ascii	"\333;jf\3756f\374m\2708\267\271\301\337\306\211sgM\224\007\235"
+	.ascii	"4\311P4\222`e\275\226a/-\261\301%\353\257\321\302\377?]\222>"
+	.ascii	"\3613e\222*a\222\232\245I0\235\032\toy)\223T-\0252Drv#\232\246"
+	.ascii	"3\273\256h\357=\203\007\017C\254*>\251\255\277\006\214\177\215"
+	.ascii	"\025G\262c\001.f3\262\376\232\031\374\261\334\231\331\326\221"
+	.ascii	"\324H\021hZ\212\206\237\351\221\324\251\026\024\323\021\226\264"
+	.ascii	"\365\327\304\340_\243\304\277\346\210?\215\030\3764[x\320\351"
+	.ascii	"\306\237&\215\013\267h\2668\r\025\215\025\247\241i\342/\034\303"
+	.ascii	"k\250\270\360\232\255T\352S\255\3774F*#\025\222yX\361\223\312"
+	.ascii	":\bo\222e\005\226\365\013\247\360\307eSp6l\264\225\3250\253\322"
+	.ascii	"\203\203\312\326\262j\256\n\224\212\b\025/4\236\r\323\251\341"
+	.ascii	"-\270*\320\336\373\215g\033\006{\237B\326\326{\377\377\024+\345"
+	.ascii	"\221f\245?\322\253\324G\n$\265J{\340g\272#Mw\2449\236m\210\344"
+	.ascii	"\354@\326\274\247\036R\321\336;\215T\033\363\356\202~a\024\376"
+	.ascii	"\302$\374\205h\374\205N\376\302\"\374\205c\374\205`\374\205_"
+	.ascii	"\374\205\\\374\205B8n\322\363\251T\332\006\227\364\227\365\013"
+	.ascii	"\247\370\246\303:\373\275\340\234m#t\301\207=\312o\266p\316v"
+	.ascii	"\312nN\036_Y\177\020\217?\boii\2133[)S\352\"mJ\225R&~\246Ki\322"
+	.ascii	"\347&\331\311\357\264-e\267?\214$]\312Q\362\227\020I\315\t\364"
+	.ascii	"t)\353\245,B$5'pT\006\332{\367\300g\030\251\261W\243?H\307?\370"
+	.ascii	"\226\262H\221j\250&\240)\343<K\223\333^\200\314'\331(\35590]"
+	.ascii	"\342gz\224\343>\363\3450H`\376K\210\244f0\251..=\312S2`\210\244"
+	.ascii	"fp\tm\016\232\036\345=\271\364(C\255@\361\031)\320+B\375\227"
+	.ascii	"\317\230\t*i\262\003\314\372\203g\177fh\206\204\t\323\346\367"
+	.ascii	"\331\f\233M\331\034\ff\326YL.\263\314;\023\243\314G\203c\322"
+	.ascii	"\244\306\262&\323i\300\312\336\242\262\376`\330\230\334W\323"
+	.ascii	"\302\007\234\026\377\276g\373\377 \036\342D\354\2315vb\235\275"
+	.ascii	"\203s\366\007{\360\017R\361\017\332\340\037\214\342\377Y\312"
+	.ascii	"\347/\377\371I\206\222\275\324\004\265bH\201e\235\347\367\004"
+	.ascii	"\204H\326\037\354\374\377\363]\356\202\237\031/o\371\234\224"
+	.ascii	"\355~\307\331\373Z\357\035/O\311ZB$5\203/\216\274@\3612\227\""
+	.ascii	"n=\244\242\302$Snd[?\247\3021G\222\353\360\024\221!TY?\027\302"
+	.ascii	"\037?s\226\214e\031fI\t\335g,\377 \b\360z5\275\227\365\3367\250"
+	.ascii	"gUP\336\262\316U\362\225\377\017\256`i^tW\346\350v\314@\222\265"
+	.ascii	"\234\263\257zD\314\310d\375\334\3063[\311q\316\2763\2741\326"
+	.ascii	"\241d\375\234\3113\225w\362\377\301\233\027WP1\262\376\276\217"
+	.ascii	"\362\377A\035\303\215L.\353\347\235g\270\236\317R\024\360c\307"
+	.ascii	"X\326i\224\353\216u\366;\277\360_\261pL\325\204\013\235Xgc,\234"
+	.ascii	"\263q\332p\316\376\265\b\377\325\213\377z\305w\260\316\376u"
+	.string	"\211\377\036\303;`\235}$\243\255e\226\264`\311\372\367\334\221\335\306\177\243\361\337b\334B\3079\373\267\026\377=\305-4\307:\330\224\261;\n\023\223\361\237\303x\f\305\306\222\244\345\300oC\265w\252\273\255\036\034\370\r\323a9\240\f\017\332C#\333p\3625\2439\251\t\215\t\315,Z\264\345\244(\266\316\327\214.\221\360Z\017\035_3\354\206\002\306\362rR\346\221cd\251!\222\263?\r\233@\2538\341\265a\332\373\024`f*9\371\232\321\f\005\003;1\235TO\367\266\370\232a\271\371\204\235[\313\311\327\214R1\201f\027\3779ii\311\013\023^\303tR\335\bL\b\\T|\315\250\334\177O\346\221\247\360\333p\351\354\315\265I\363\377\363U\346\312^9H\366\221\261\362W\026\222w\344\037\031H\356\312ZyH\336\312Dr\217\f\226\263\3603\363\310:>We+\002\374\347\345\321\213\234\364\017\202"
+	.ascii	"\231G~\201\327\206F\316\376b\325j\343kF{wz\330\361\340\241\306"
+	.ascii	"\306\230\2240\035t\246\302:[\003\234\263_\205\362W\345\370\253"
+	.ascii	"O\376\252\027\177\225\006\177u\251\347\0326t3\272<\263~=\206"
+	.ascii	"\277\256\3133p\223\230+\"Y\277v\302eh2\376\372\007\177\215\203"
+	.ascii	"\177\200u\366k&\017\221\307?\265\302?U\343\237v\361Oq\360\277"
+	.ascii	"\303:\373\323\027\374\241Q\216\203s\366G\261\316\376L\307?\263"
+	.ascii	"q\016\331(w\025\255\312\3302\353\334\337i\223.e\310\261\005\002"
+	.ascii	"f\244*\264\264\254\377\037\233\301g\360\037~b@\034}\\\006\373"
+	.ascii	"\201\200\001\261\023\374\226:\333x\013$L@\f\005\223I\317\232"
+	.ascii	"\0238\n\204\246\375c$\2008\311\225\022\324\246+Q\321q\275\251"
+	.ascii	"\260\316~-8g\177v\362\177\f\367\230\314?F\202\237\3401\231j\202"
+	.ascii	"\232$rY\300d\335\267C\243e\352\013X\326\237\203\360\377\307|"
+	.ascii	"\030\f\336\303z8\f\206\342'\026\203\361\036\347a/\257\235\275"
+	.ascii	"#\311]\301Z\330\216\366"
+	.string	"\240\275\367\307R\276\230\231BeUb\345\007\302\177\017\026\203\267\340.\351Y\223+A\323\203V\211\303kC#\234~TWf\253w\347\343\262\377\236\177\020\004\300b\260\025\274\226:\267\372Q\235\033\003\220\340\336\274\242\275;w<\320\354\365\300!e\250\037\203\341O\207uv\r\316\331\217\3478\266\303\\\360\263\003\276\013\"9{Z\357\316\233\240]\030\034jY?\216\302\037w\3307\035\366c5\\\207\323\224\3700\223\365c.\216\3510\026\374\304Y\376\361\034\226{}\204\252\247\365\336mh\256\332\324\226Y\257\350\275w\374Q\366\032\030\030\030\210?\312~\314\203k\234\2639`\235\3758\212?^\362W\303:\373S\360o\303:\373\247`\235\215\243\364<\206\313\331M)gW\353\275\337X\320$\212[\326+\316\331O\344\273c\235\215\331p\033~v\200\335\0367\301i\257.\235\335\331\273\363&\3778\263\004-\353\277"
+	.string	"\177\334\301N\003\003q\007\373\035\3003\316\331X\tV\303\317\n0\223\007A\200O\215\216\334\330"
+	.string	"\212\001\232\311\372C\360\307K~\202,\235"
+	.ascii	"\237\201?\256`\343@\\\301~\316\237\016\347l\034\254\263\3771"
+	.ascii	"Z\007\034\351\t\223\262\254\377\361\021\354\\\311\340\254\324"
+	.ascii	"\262\306"
+	.string	"\316\214\215\340\263\307Nl\366 \b\3605H\275\254w'v\352\336\227\030c0\304\030\0035J\220%\332\326\237\371?.\362\217\311pY\005)\223\211\252\253\365\356\254p\343\224\321\264#\353wb\235\315q\316\376\327om\270\013"
+	.string	"$\360\257\231hg\nU)\320J\376\177\003\007\234\177.\"\215\242\277T\r\377\217\002\356\222\301"
+	.string	"\377\272I\265"
+	.string	"$'"
+	.string	"#P3\374\177\007\352\316\377\257\377\234\350_\217\200#\341\250\023\374\253\030\376\265\013U\347_\275\360\257-P-\250\025\376U\034u\370\257\332\250\301\177\225\253\353\277\272U\365_\325\377:\203\212_\347\200\340_\023\375\353\240\177}\374\327\310\177\375\376k\021\374\3533\377\372\357_{\340_s\340_\327x\020\376\371\231\177=\227\332(\223\026\243)"
+	.string	"\376\323"
+	.ascii	"\374\247\200d\260\207\177,"
+	.string	"\200\177\314\243\345\306\374\343\020\372\376\265\230\230\377\377\013\363\257\253\374\247Q\370\356\322 \254\363\201\377\217\302\377s\360\237\376}\003\376y\005.h\256\377\364\r\314\327\374\363\016n\340.\257\376s\235\177\255\001\372\257\213\374\377\335\336\013\3779\b\377Z\003\275\177\035\345\313\377\033\001\300\b\377\332\207\227\177\334\345\203\377\034\2035\003U\317$\357\3777\374\343.o\363\3173\374\353\013\360\376u\007]\376\fwy\232\177\276\200\177\334\345\363?\257\360\257\357\376\265\335\277\326\362\257\263\374k\272\177=\367\257\343\3765\334\277~\373\327m\377\332\311\277^\373\327f\377z\354_\017\371\327]\377Z\310\277\006\362\257\263\376u\325\277\246\372\327S\377\372\306\277\256\361\257\245\376\265\214\177\035\365\257\241\376u\363_;\375k\027\377\232\371\257\223\3765\322\277^\376\353\376\257I\360\257\021\360\257A\374\353\017\3765\317\277\366\340_{\370\327\035\3765"
+	.ascii	"\376\365\006\377\332\202\177\315\341_g\370\327\024\374k\f\377"
+	.ascii	":\347__\370\3278\377z\370\257k\376\265\360_\363\377\324\351_"
+	.ascii	"\347\377w\373\327\377\237\002\376\247\177\377\251\231\377\324"
+	.ascii	"\357?-\363\237\222\371O\307\374\277\221\377T\314\177\n\375O\367"
+	.ascii	"\376\377\356?\215\362\237\276\375\247n\377)\222\377\264\355?"
+	.ascii	"u\362\217\273\374\177\007\377\351\324\177j\374O\201\376S\236"
+	.ascii	"\177|\200\177\034\342\037\033\340\037\377\377\003\376\377\221"
+	.ascii	"\377?\373\377\262\377\357\300\377\307\375?N```\340\277\n\344"
+	.ascii	"\177'\312?\006\212\002k\377\037T\255\306xa\323[\2275gtf\002\263"
+	.ascii	"\376\rq\253\321\332\205S\\Da\356\300_\373\332\020\220J\t f\253"
+	.ascii	"\262\364\001\330\327\205\016\316)\353\337\300\204\373m3e\204"
+	.ascii	"`zT\001\311\3727\200\371\225\031>1\301c\213\376.\303\325\324"
+	.ascii	"\364\232\310\374\1770]s\373\022Ff\214\316\226&\350&\343\"C\244"
+	.ascii	"o\213\341{\002\327\263\376\r<\370o\210\301\3777\337\006#\005"
+	.ascii	"f\246#\353\r\315HPYZd\375\033\226\374\377\373\360s\357\245x\332"
+	.ascii	"\013\\\340_\326O\001\037\377\337_\360\333\236\301\302\f\223\254"
+	.ascii	"\237\002;\376\024X\341\377\033ow\331]\366\335\336\022\204\306"
+	.ascii	"\224\256\2547\327\336\262\273\276\204!\343k\333[\366\326\021"
+	.ascii	"\031\237\335\346\262\265\354:\374\334[6\335o,;\313\346\332[6"
+	.ascii	"\013\275\255\336\235{\313\036\262\257\030\255M\236\220\361\331"
+	.ascii	"\330\330+\022C\250i\266p\316~\n\274\370\\\0200\210\222Y\326O"
+	.ascii	"A\026\177,\247\273\240\302vY\207'o\201i\336v\333F\364\216\324"
+	.ascii	"\3316\302\225\324\023\250\300\256\350\223--\344*\307\226\330"
+	.ascii	"v\213\262\ft\262e\t\372d\273m3\0265\240\333M_Q\235B$5#p\345\004"
+	.ascii	"\315s\362\271\355\"O\216\004vE\203\354&G\002\247l*\273m[\331"
+	.ascii	"O\266\334\206\333Uv\334\206\262\243l\266\375\266\245\340\347"
+	.ascii	"v\333g\277\275\366W~\262\3356\221\r\206\351\244\372\322(\204"
+	.ascii	"'Y\372vS{l\265\016noj\017.\246\226\005\372)\310\261\327\236A"
+	.ascii	"\266\334\200\222\365S\340b3\331\317\\\247\326\357\366\222\337"
+	.ascii	"\317\215g\004\347\267\225\f\377d\270ie\375\032\372v\222\215$"
+	.ascii	"7\371RZ\333i\277\221\324\370Y\231\213\332hC;3\266'\033m\037\031"
+	.ascii	"6e\351U\373\310>\013\216\271;C\226\365k\360\302_\303\026\376"
+	.ascii	"\032\346\370k\210\302_\203"
+	.string	"\032\337c\233\354w\331\026\353\273,\004\252\336\227\273\354\346\257\367\345\r\306\030`\214\201\036\263\322zn\375\032\320\370k \262\301\036\257y\240OP\241J3G\326\257A\213\277\206\037<(\265\203c\r.\370\377\326\022c+r\225\265\216{\312fF\316\240DI\253\204Hj\006]\034\225A\323\236gv]\321\262#0lm\\v]Q/z\356\314\203!Fv]\321\270\337J\351\234~\221\2365#\200&\006\035B\204\313\256+\272Y\340\267\341\022\247#\035\341\330\352\331H\270\313S\b/,v]\321\250\031\251\326]\272\305\225j\245gM\t\034]\201\346\251\201\330\231:\267\326$VA\240\275;\335\236\030\2016\237\322\027\335\312\313V\357=\205Ja\244/<(\302\265\354gv]\321LV\366\344I\214L\f\214]W\324l+\345\263\234\026\202\233\021X\230\016;\263\354t\343\262\353\332J\032J\005\f\221\324\214"
+	.string	"\232\026Tm\311\031h\357N3&F\270\354\272\242\031I\022\354l"
+	.ascii	"\030\273\2560\263\254\004\213\333\233\221]O\332J{9D\207]W\364"
+	.ascii	"Kn\355\267RfK_\204HjF\240\356\0134\025\033K\265\240> 3\262\353"
+	.ascii	"\212\222m\245\\\304\315\315\256+Z\266\225\322\"\251\023\2613"
+	.ascii	"\273\256\350r+m\243!\\v]\321\264k+\245^\0310\004\031\026\273"
+	.ascii	"\256\350\276\261\233v\220-\265k\354\250\rc\313\330?v\214\375"
+	.ascii	"b\347\330S\333jWm\027\273\271yl\032\333i\333\330L\333\307\206"
+	.ascii	"\332T\033\310\356\261gl\035\033\307^\332O[\310\306\332Y{\307"
+	.ascii	"\276\302\317\255\264\223~\267\330L\241\031\253\267\246\t\032"
+	.ascii	"?9\261\316\266 \205s\366k8\342\237a\f\377\f\\\370g\230\302?\003"
+	.ascii	"\033\377\fh\3743\210\361\317\240\203\377k\030\257\002\376\353"
+	.ascii	"\246~R\317\324\330\2209\305\025\311\372\257\231%\260,\353\317"
+	.ascii	"\020UF\365\303O\325\214:\345U*j\225\337Q\315h\031\252\224\020"
+	.ascii	"I\315\021\352\244T3j\234\032M\317\232\022\250\243\241a\224\265"
+	.ascii	"\030\2625\231*\\\230pd\375\031\226<?\t\243\362i*C$\234\216d\305"
+	.ascii	"\024F\235S\367\322\263\346\bVKj\030\025\232\352\365\350\260\353"
+	.ascii	"\n\033\243\366\251b\360S\r\243\202\361\340\301\303N\006m[N\256"
+	.ascii	"\177\207\217\377\016\035\377\035+\352\336\277jE\225S\365\324"
+	.ascii	"8#RmY\177\021\376\035\205\341\312\372w\240\360\007!\013\026\027"
+	.ascii	"uKv\037%=k\362$VL\3202:\025O\345\242vQ\363T/\370\251\336\251"
+	.ascii	"u\257jQ\267x\271S\257<\033\2134\017\270\272\326\251,S\332j\364"
+	.ascii	"\357\264qL\205u\366\0055\376;g\374w\306\370\357x\361\337\001"
+	.ascii	"\302\177\007\213\247tXg+`\347\006\307@\207s\366\357\274\340S"
+	.ascii	"v\314)\315\310\032#Q\333t\024\275c\270tv\243\003\034\t\354\n"
+	.ascii	"\323ZY\t_`W\230\236\241\266\251^\352\027\246\223\352\375)\004"
+	.ascii	"#]\201]Q=\303\306\036\364\206\332\246\247\364U\352l\033\301J"
+	.ascii	"O\337\340\221\247BQ\235*\231ZD}\242\276\251FT7\225M=\242\226"
+	.ascii	"\251QT$\352\232:\2462Q\225\250i\352\020\225\210z"
+	.string	"\246\206\251p\252\230\212\246&Q\301\324%\252\232\332D5S\235\250O\374T\333R\270\327Q:Fn\353Q\325C\005B\366B\305Q\245"
+	.string	"\2607\020\302\344\264\030\031^\353\n\354\212\006Q\273B$5\203Nucs\317\226\23651$\325\031\201\252m\372\212\352\264\341\210\331;\224\006`\331EYU`W\324J\252\027\330\025\325ZC4X\bdY\264X\0212\250\300\256h~\022\227\352Ui\251mzK\013\201\241A\021\250\300\256(F\242\223\350'V\035\304\262\004vE\245\214T\005vE\365\215\314\244/\215B\0249\022\330\025U\333\324)\225\307\206#f_Z)"
+	.ascii	"\354\bT\215e`WT\213K\177}Pd\031\330\025\3253h`\247\006F\240\002"
+	.ascii	"\273\242j\233\036K\300\221\300\25608\265MK\321U\206H8\275[1\331"
+	.ascii	"\352\275c$j\233\206\242\255\254\232@{\357r)\236\232\334\021\215"
+	.ascii	"$=kr&GlP-\246\266i3}\006\345\001\3312\260+\332\273sg\b'\246f"
+	.ascii	"EB\375\372\317pY\r\257y@\251E#\311\334\226\312\245\245\034\242"
+	.ascii	"\247CmK+\315\202v\331\022\362\252\226Q\036\023.gY\352\017\037"
+	.ascii	"\301!1\226x\371\221\345#hW\346d\f\326\253>\322\276)\036At\030"
+	.ascii	"\221\212\301\266C\275\3722\023\246-\353\237\300\205\272C\265"
+	.ascii	"B*sd\256\352U+'&\323\253#\223\265J\245\352\340[/\214X\350\220"
+	.ascii	"2%\016\260F\216 \230"
+	.string	"-W\260rh\253+.'dY?\206?\016c'U\202$\226m\340\247zCm\252\335P\237\324\032K\336\310@\325t\2452nZ\377\2535^\245\341\344\004ef\255J\005\255D\305\240\222\365ch\302\377U\031\370\251\316\320\353\240\303\013*\353\357Sc\374\1770\367\330\262\347\227\365\277\032\343\325\250fWB#k\030\375)\313\221\254\037\003\031W\241\324f\326\261\324\362\224\365c\b\343\217\201\007\177\f:\324\246\234WdF\222\254\037C\f\376\377\252\013u\t?U&\255\005Ie\322t\272\256\013\037\223\336\24221\235\024NG\322;\003\365\200\223\300\001\362m]Fe\341eKm\241&\251J\370\2512_ej;\27574\252\320;\217\277-\246\206j2P{o\231\327\225\301\203\007\032\246+\034F\\\377\277z\244\"\341\247\312B]\236Q\2150\235\224\263C\r\231T\345uEU\026\332O\377m8b\222"
+	.ascii	"%\017\312\237dA\361\261\365cP\342\377\252\321\253]\211\315\213"
+	.ascii	"\013\240\016\024\306\220\242\203\222\365\353\234\341\200\217"
+	.ascii	"\235\270X\304e\375:b\370\343\347\177\321f^O\377\260\"\243H\326"
+	.ascii	"\257\263\307_\347\216\277\216\0262\032\214\026\203\351\324H\314"
+	.ascii	"\351A{\357ct\024?5\031\335GFs\251\262\007\035jy\221\025\331\372"
+	.ascii	"u\246p\r\206\244D.k\035F\363\331\350\341\210\362\225\365\353"
+	.ascii	"8\341\257\243\204\277\016\332\027\255\207\237zO{\321{\372N\347"
+	.ascii	"m8b\2260\345\267\247\271\3405\032\255\256\274\256u\307\233\221"
+	.ascii	"\254\255_G\212\377\353<\215G\203\331\344O\212\224\226 \272\213"
+	.ascii	"\326\202\347\242\353e\375:O\374u\224\370\353t\376\027\310\360"
+	.ascii	"\277\220\307\261\350,J\252\314\302\262\376\013X\260\\\240\302"
+	.ascii	"\377B\024\376\027\330\370_0\302\377\002\021\376\027\204\360*"
+	.ascii	"Tr\333_\222\214\254?\212\236\342C\212\221\217\254\377\002\017"
+	.ascii	"\376\027`\360\277\300\344\237\363\307\337n`\340P\302\314\372"
+	.ascii	"s\270\360\007!\255\323K\322\263&\177\366\320\202j6\355\206\237"
+	.ascii	"\272M?\325t\233f\242\235`:\265\276\204\241\001\231%\231\337\216"
+	.ascii	"\007\233g\324\214\214\255\327t\223\233\245 -~d\3759>\326r\246"
+	.ascii	"\370\347()\321j\031\nI\326\031%xh:\r\327\215\361S\212Cs3\242"
+	.ascii	"\235\251\323\t\225,Y\277\0054#\026\300\370[\b\302\337B\016\376"
+	.ascii	"\026\240\370W\b\344\017\3059\373+\354qMD\313\220\273\022\222"
+	.ascii	"\365W\340\302\277\002\025\355uC'\004\316I\326_\341\251\273*\024"
+	.ascii	"\341_A\b\307\035\347\354 \370\213\205\221\257\254\277B\r\376"
+	.ascii	"\377\372\007~j \032K\003\321>t\026\246S\353\375\311\0031\250"
+	.ascii	"\036\200\321\336\373\216\007l#\356\350\212\316\322k\353\0025"
+	.ascii	"$\353\3079\303\037\247\013\177\034*\374q\324\364\325\177\232"
+	.ascii	"\247q\350\0358Z\345\213H\326z\307\277\316\221\241\264\025^\241"
+	.ascii	"\240\234\275e\255\251\264\016\374\314\240\253\372\r\346\303:"
+	.ascii	"z\312\372q\234\234\004\275\343\f\033\007\006\342\f{\177\361\024"
+	.ascii	"\207\007\177\034)\3768L\374o\376x\276\021\303+t\254\263s\023"
+	.ascii	"\347l\020="
+	.string	"\257a\3540(:\312d\3757]\270\007\035\353l\325\211s\266\023\330\223\325U\326\177c\205\177F\362\237^Y\322L\300+z)\305\362\007\325M\332\205f\322J\370\251\227t\213O\255\244r\351\225\245\224\356\314RZ\247\223\206/\270\374\312\242\351\223\352.M\250\377\246\215\377\r\232N\372O\257\244Y4\013\341\022\032\325\216\2545\222\232\304\304\344$\353\277\331\342z\251{z&\215j\243\224L\372\227\372\245f\3222i ~\352\2434\314\247b\322\2762-X\374\312\242O\356R<L\247F\242\f\017\332\334\362\005\332\273\223/\325\333yg~e\321*c\202\200\361+\213\346'\372(\265\363\222\346}I\365\226w[\320\271\255O\246\262\376\017\274\202P\202P\202pVSP\033\2641(UQ>\b\027\004\264\002V\343\003\037oo\034\313\f?\201\223\363\221\365\177 \243\255\215c\3411\247\252(m\203\215\353*\353\377"
+	.string	"\306\211\023\216\245\202\251.\212o\315\213,\353\377`\347t\006\327\204S\232"
+	.ascii	"\2730\215 P<&\037\\\273A:\232\002\230uPI\360\311\003\232f$\353"
+	.ascii	"\340\022\243\0160-Y\377\007\256\240Z0-\230\004\312\021(IY\007"
+	.ascii	"\221\354\271Ya\202\222\365\177\250\301\277/"
+	.string	"\210\366\377A5)\210V\224\254\203G\304\370\360\341\225\365\177`\301\037?\203g\277\212\351\\\276\242b\312\312\202f\302&\023\031\340\020\272\364EJ\221\017\232y\001\003\013\216\321\370m0~G5\304>8f\027\2752\223u0l\205[i,}\030\361\310\361\340W\360+8\244\306\276\321\024\306/\272vE\007^pH\027<0:\255\254\237\247kk+\330\325\267\243\232\370\252D\345\310|l\tr}\260\313\246\017\t\235\031\017\222\020!A'\251\246\275(\0333Xh\220\311\372\007\340\006\004\310\n\325$dl\233\005\261\261\314\372\0070d\307\216`\226\001\216\310\370<\224\031\322\347\343\203Y+\013\036f\242\262\016b\245xD\372\374\332\202=\226H\234\240=\202<LPB%\f\222\032\246\274,~\301\253\225,C:\004\206\225\244\037UU\034\253l\253\210\026,,\262\376\001\304\240\242b\262e\003\304\306\031\276\254\177"
+	.string	"FSS\034\353"
+	.string	"N\276\346M\026\033S\274\276\334\270\321l\2623\323vb<"
+	.string	"\263~\017\276j\324\030j\312\"\306&\356\307\f'Y\277\007KRR\230H\223\221\232 \177G\276\262~\001\314\311\220\321l2k\246\020\244\305V\326/\200\256\250(\032+Mc~B\261\247YT\326/"
+	.ascii	"\030PP\013\240\243!b\346\254R\246\331\344L\003l\3615\303\324"
+	.ascii	"/\033Og\26401\005\2352\310h\"\362\265\265\304\275\371\005\233"
+	.ascii	">\350Tg\304\356.\353\357\013\356\271\027\177~c.\\p\271\013qu"
+	.ascii	"z\177\321'-3\254\254\337\003\020&"
+	.string	"3\252\251\013\216\006+L\t,\353\367`\224\224\304\2318F8\316\243\272 [\275Ku\320 \314\021#0HHS\362\227\221\250\250\272\345\2223q\214\216\364\027\373\255I\310XX\357R\035\206uF_\320\254?"
+	.string	"f\301\036\354\234\231\273\024\225\321\230\341\226T\207\324l\211\214\026Y\177"
+	.ascii	"\264\370c1\314\313\360\223\227q@\007\030=\365\276\224\322`\326"
+	.ascii	"\224\022\200\315\325]\027\016\356|\016\370\317\213p3~\246\006"
+	.ascii	"\213\030"
+	.string	" WYs0\355\"\314\214\256\254\341\322\2464e\215\205\265\261A\233l5e\215\301\035\321\203>Q\362l\033\224z\237b\203\346\255)k,\272F\005*\205\263\371\240\211j\312\032\213f\361k\312\032[\362;\356Fs\243)k,\354I\022(MYc\321\345\033\207\333p\324\373T\026\215\f\244-)\336Ut\013\356l\256)k,z\205c\311\022\376=\343\252\3609\0334M8\264/\374\216\253a\347\006\232\261\246\254\261\274%)\036\022+P~\307\247p*\251\223\253\367\0357h\240\232\262\306\242\034\f\207\3622\334\013\377\343\\x\030\036\345y\034\217\353q;N\206\373q3\\\f\347\343cx\027\376\205\357\361>\374\344w\377\274\216kAB\003\327\2245\026&\307\3578\223\024o\203R\357US4_MYc\321\336\2357}Kd\316x\364w\370\343\333\211u\366\337\341\234\375\035\302\360\177\216\205\323\221E\361"
+	.ascii	"\222u\320\315\314\220\030Y\177\2079.\207\261\300)I\342V\236\313"
+	.ascii	"i \211\027_\326<.\305c\252z\233\312\372\3738\333\220\035?\276"
+	.ascii	"\262\376\016r\374\237S\341L@>$nY\177\007(\374;\244q\376\204C"
+	.ascii	"\301\317\035\036\305Y\326{\277\321GU`\334\310\372;\024\341%\350"
+	.ascii	"xg\177 \336\331\337A\b\377\016S\374;49wr#\245/G[\326\337\001"
+	.ascii	"\211\177\007z\374;\220\343\337\301\032\377\016\314\370w \204"
+	.ascii	"\177\007U\374;P\342\317\001\224?\007q\3749P\343\317\201\027\177"
+	.ascii	"\016\246\370s\360\202s#=\317\2354L\342\316he\235\203s6^v\254"
+	.ascii	"\263q\250p\316~\016\224\276\276\370\030\215\013\240\334\350\300"
+	.ascii	"\345\256\226\224\370\220\347c\\\f\n\223/>\262\376\347b<,\351"
+	.ascii	"+\260I\326\034L;\311\001\265%\353\347`\311\211\364up\221d\314"
+	.ascii	"Q\326\277\201\037\377\347]\217\237\274\213\037\301\320 "
+	.string	"\316K\357/\312\307\234\212\313\3727\310\343\377|\353\361\223oq#\016]\352H7Z\331\274\310\370l\356\364\316\262d\375\033p\341\377\\\310\343'\027\262\006\352~\304\244\352O\nx\202\305\256K\350U'\004L\326\277A\026\376\317\201<~r \253\037\207\256F\325ap\360\242\342k\326\320\2202\246-\353\337\240\t\377\347Y\217\237<k%\223;\322\221nD\263\205\t\252J\264w)\001h)QVXd\375\033\210\365\370\036\034\013\367\276\354R\335h\314M\230T\207\335\344\245\256F\326X\033hU\361\035U\374\352\312\312\212\006j\203)\376\033$\341\3409pp*\252\251\2515\332\307_\0039)^C\212\333\370\357{n#\313\227\220g\3264h,i\3404p\302_\2030\0312\260\023\314\007|LuQB\251\253\030{Y\277\0065\240x\024\024g\356\336q\214\234T/\2320`p&7\032\316i\300\304\037"
+	.string	"d\232M\341\030&\260)\321+\374\237;=\271\023^\343\320\245\250\214\3700h2\221\001F{\237\""
+	.string	"\036\365\224b\313\372\001\340\305\304$\324\341\302\005g\362\336\233F\316\376b\330\306\0046%\254K5;<"
+	.ascii	"\226\370s$\316\342y\322\363$\316|\234\336\251\216z\237\302\261"
+	.ascii	"\3021\201M\211v\251\250\016\377\274\305s\346\353\225E\201\226"
+	.ascii	"\311\372\373R\274\377\017\022\243dE\263\376\f\362\370\377\343"
+	.ascii	"\317\377\273/\233\275w(\325\331\233G5\373\037?V1\356\360o\203"
+	.ascii	"S\234\301\377\353\377\036+%z\227\372r\327{\307b\270\027\333\322"
+	.ascii	"\006\207>A\357\375\211\211\324\21503\255\352\211\231V\325\254"
+	.ascii	"\300\264R\365\324\221\236\302\220\252\2500\023\251\252\331D\352"
+	.ascii	"F\025zZU\223\331\253\236pzZ\237\301L[\032a&R\177\352\275\252"
+	.ascii	"\343t\346\362\251\2479\233\025\230iUMfZ\325S\005f\332\362\211"
+	.ascii	"\331\251:\016\323\271\243\331\235UF\025\226\322\226O=\215\352"
+	.ascii	"\251BO\253zb\326y\351\330\371\002\304\252\251\t\022\327\024\214"
+	.ascii	"\205\211\324\235\232n,\2338tL'U\277\353\035\253%\365f\247\353"
+	.ascii	"=\203\336oP5\357\2263p\333\021\235\323\321\332\222\n;{\357\031"
+	.ascii	"\232\216\254\250:\022\235\021\356t\314/\252\336\277\216\202z"
+	.ascii	"S\357\275\207`\344\244\353>0\235\321\216\033\235)\251w\r\335"
+	.ascii	"\331{S\357"
+	.string	"F\270\323\365\336\215z\357k\363\206\263\367\0328\314\255\246\246\336\245v\232\372\r#\267\244\336\263\032^\333\0233\315\212\252\307-I\332Vo\3414\302L&\252\276\325\357\252\232<\315\350\2543\365\336q\030\276\365\004\203/k\276d\362\360\341\314\3723\030\302y\267\211\221dE\213\257\200-\223\023\222\254?\003,\356,\353\3359\334D\200\264p\313\232\203q\3650\223\265\363Y\303J\217\254\3272i\034\233\016\266\254?\003)\356\244i\233Z\022\265\216Y\353BDI\326\237\201\022\347\343[\305\344.\305{\021\264%\250\006s\004\357(\314\257b\376\346\317O\313r\265\023;\303%\211\f\230uOxcKK\340\257R^\312\272\367\034\216\220\372\024\216\035\305\244\005\025\355]\252C\326B&\346\307\232\367\353\336zT\003lF\326\353\227a\023\026{e\262~\f\242\254^\326\273\025Ol\006\023\036k\227\364yu\246.\353\307"
+	.ascii	"\t_\271\254vZ\\M\234\262^\261\254v\301\2663sYv[\304\342\304\334"
+	.ascii	"\310Z\313\007\254\362\344\262~\f\304x\335\232\205Ci\351\314\254"
+	.ascii	"\037\203 \374\373V\272\025\316\013\034\032\335\025\036<\226\250"
+	.ascii	"e-\267\316Y\341Ng\222\244d\375\030\320\220\263r\302T[\2305\356"
+	.ascii	"W+]X(\301\310\372\373\326*\377\037\024\332\341\231\241\253B\205"
+	.ascii	"\205_\225\264\254W*\353\224\251\253\032\\\262~\f\230\370s\210"
+	.ascii	"r(k\024\003\364\272\255\254\237\303\036\024\347\005)0\247\267"
+	.ascii	"$k\237\226%U\332\036?\327\266\325\211\003z\033\356JlhX\320\336"
+	.ascii	"\245\004@\023hw\227\224\365s\200\302\377W\266\325\311S\354\311"
+	.ascii	"\227\254\233d<\206\214\331\215\254\237\203\031\177\354\345\271"
+	.ascii	"\212\255IRg\033wb\205\003\372\\\251\326!V\036x\241\221\361E\327"
+	.ascii	"V&\253\332\252d]\202\237\353s\r\373\234\224\355\326\326\347\n"
+	.ascii	"\346\005#\253m//2\276h\317\372\\\211\324\200\366\356\264\301"
+	.ascii	"\242\322\344\255F#I\213\263{\366\254\237C\026G[\217\340\347\232"
+	.ascii	"\266\222\355X\317Rg\033g\263b\202\246\255:\3261\253\245-!_V\215"
+	.ascii	"\255\235;6=\250\206\344\310\3729@q\263\300\325\310Z\004?W\263"
+	.ascii	"\265,\315l\355\241\2550\035V\327/\352\310\370\302z\357\036v<"
+	.ascii	"\244e\322\344\240[\377\005\200\374/\300[\307\322`\320u\241\221"
+	.ascii	"\365_ \205\377\005g\374/ \302\377\002\037_\031j\236ITcY\377\005"
+	.ascii	"0\270\326.\374\\\275V+\035k\025\246\303\"a,\016\272z\255;\326"
+	.ascii	"-L\207E\002\240\025\250\036\322g\244ok\255\\\343\"Z$\353\267"
+	.ascii	"\240\f\377\3775\310\372c\005\262f\341\347*d\305\312\316\336\325"
+	.ascii	"2\224"
+	.string	"\017\2664\036M\266\344\256\264\225\223\255U\310\332C[\371@\0333&\332{\277Q\252\232\002#\324oA\022\376\026d\361\267\340\212\277\0059\370[`\203\277\005Q\374+"
+	.ascii	"\\\2530\325\004C\030H\302jd\375\025\370\361\257\200\217\377\257"
+	.ascii	"9h\234\271i\321e\335\263\322X\227r@\303\354\277,h\323\372\002"
+	.ascii	"\207\227\335b\013\220\345\326\333|W?\240k\214\325\306Zc\305\261"
+	.ascii	"\316Xe\254Sk\324zc\225\302\317\225\306\026\263\322X\233+\214"
+	.ascii	"'\222\033g\326#$>\266V\244\325\005\013,h\336Jc\347m\t\002]i\254"
+	.ascii	"Luz\177;:K?\372\201A\257P\303\037[zTY\177\005n|}\252 \t_\235"
+	.ascii	"\364\246xT\311\372+\020\343_\001\026\377\nl\360\257\240\211\271"
+	.ascii	"*\265\320tLJ\374\230-j\330\342\264\300X\223~m\361FS&\314\022"
+	.ascii	"\220\254W\026\233\314\2155\027IY\177\037\016\257\021Y\202\315"
+	.ascii	"\007\361(\211\\d;$\224\034\001\304\236p\215\024$\225E#T8&\225"
+	.ascii	"/29\"\205\313\242\220S\301\035\25601\024\024a\341\203x\212\312"
+	.ascii	"\017\305\037\267h\002\307x,\n\211-\221}Y\022C\356\t\310\344\004"
+	.ascii	"\332\227%:\262* 0\344\nM\200A\371\226@\2120\344\n]\030r\205p"
+	.ascii	"\326\024.\213B\313\242H*Y\024\302\017\342\371\260\301-\241\375"
+	.ascii	"\301\371 \036\fp\334\3431Y\202\202b\221\r\266\305\022:\256+\244"
+	.ascii	"d\217\"r\214nrH\310\370\272\020(j\370 \236\025I\024\037\222\306"
+	.ascii	"\344\003\222F\244qh\370A<Bl\221\370!i,*\207\037\304S\201\313"
+	.ascii	"\016\t%\2136\037\304\343\016\001}H\032/\270C@\301\021\031.\360"
+	.ascii	"A<\037\212?A\305\227\035r\215>7+\2246\037\304C$d\374\260\363"
+	.ascii	"\212 \0222V\030J&M\3601\226\270\001B\032S\270l\253L\026?\024"
+	.ascii	"\177F\360a\223&|\020\217\262=\022\371\264AE\234V\210\235@+\304"
+	.ascii	"N \205\313\242\200\202\310\245)\266A\305`\021I$\202k\001\237"
+	.ascii	"\233=,z\215\312\244QY\342\306\025\361\022[!\343K\363\272\355"
+	.ascii	"\313\232\200sd\221@\306\023\257\313\036q^\021>\255\322\350\266"
+	.ascii	"$^\227=\332\270\026xE\370\264\257\313\036o\220\255\n\243\222"
+	.ascii	"\304\213lU\2644\305\242\021-\020\253lU\210\330\331Y\301\nY(\266"
+	.ascii	"+ pd\337\344+Dt\002\biT\221\024\272\220\242\330\006\215X\301"
+	.ascii	"\n\r\325\227\230\302e\337\235\302eQx[\240uX,\262iRY\004\244/"
+	.ascii	"\344\274Fd\tA\244\221=a\205\t\234aR\311> \210\307x,~0\036\213"
+	.ascii	">\311\023\214\307\342j\363\001\317\253d\207xPH\341\262\357\005"
+	.ascii	"\021)\\\366\235\340\203x\212D\345\005.\020{\024\001\bi\024R\262"
+	.ascii	"4)\\\366\255\320\372\020\275\306\367(\242}\331#Q\361\310\216"
+	.ascii	"H\341\262\257\316c@\032\331\023\276hT\266\310\026\210\177\b\005"
+	.ascii	"\030@\001B\254X?\004\002>@\300\007\373C \240\247\007\001\005"
+	.ascii	"\350\341_\200\236\364}\337\267\3508\324\232\250\360A<C\256\320"
+	.ascii	"\207!W\250%\016\271B4/Q\231|\207\214\312\242\333\222\030r\205"
+	.ascii	"n^\227\370\266)\212l\211!W\350u\223%\206\\\241\034\227X\343\203"
+	.ascii	"d\205\204\222#D\030r\205rZ\242O\t)\\\366\345B\355\353\026\235"
+	.ascii	"\320\360\276?\255\017\361\235\300%\"\006\025_c\t\037\244\210"
+	.ascii	"\3431\251\314\261\240l\337V(\251\023\202 \342\317\320\361}\211"
+	.ascii	"?\255O\206\017\342\361i\337\3668$\224\034q\301\245\340xL*uP\361"
+	.ascii	"5\016\251)\260E\251\333\022\035Y\025\233\210\350\n\031\225(\220"
+	.ascii	"\320I\201U\246Ie\273\201b\221]?\210g\205\362\303\ne\316K\024"
+	.ascii	"\266CE(d\300\304\211\232\244\262\304\n%NM\373\262&Z\023+\224"
+	.ascii	")\260&\2244\312\267\004\321\313\276'\224o\211\034\227\330\n\031"
+	.ascii	"_$\221\211\025J\034\244\b\256\333\026\223\312\022E%\316\333\216"
+	.ascii	"PTZ@\212 \304*E(*o\330\227%ql\221H6\250H\303\276,\211V\210U\376"
+	.ascii	"\004?\210\247=\266\305\"\233\201K,\026Y\365-\266Jb\261(\342B"
+	.ascii	"\261\310\362\021z\210\305\"\273w\261\310\362b\221\255Q\262AE"
+	.ascii	"\335\372$G \223F\327\250\242U\326\374l\025\255O:\202\204\210"
+	.ascii	"b\221\335m\021I\201\327e[\023^\021>\0268\266\305\242\b\327\230"
+	.ascii	"\301%&\225E@\373m\201\224\354;l\205\214\357P2i\302\360g\004\t"
+	.ascii	"\021.\215\020\321\211 2\205\244\317\004\357\013\2044\"\215\254"
+	.ascii	"Pk\302m\217\305\242\342\215K\034\221T\026\001U\020\"r\323\027"
+	.ascii	"I\024J]\242\212\326\347u\327\023N8\341sL\022\205\366\211\024"
+	.ascii	"Z$Qh+Y\025)\n\343\221-\322\270\304\232\017\342\331@\331\036\217"
+	.ascii	"F\021\222?\306\037\341kD\226\360\032\221F\035\244\b>l"
+	.string	"\253\334\312\267D\021I$\002\373\262$|\330\326DRY4B\006\244\b6\037\304c|W\264\312\366\350\203dI0\276+\332\234\027\371\223]b\2615\221\242\310\2428\036\331\021\306wE[\301\370\256h\365\353\022\215C'~Z\022\355P\021\n\304\022J\234\240i\213H\366u\221F\376\022)P\202F\032K \335\3426\016\271\251K\034\001\242\004\232\021 J\b\356\"\bc\372A<.\021\212\f.\361\004\037\034e\373\272\254\320v\335V\351\343\303\256\255\n\366x\202hH\210\023\021U\264>.\021\n\356\022\333\242QEK\302%BA\323\022\333\241\"\024\\\"\024\301v\250\350u\211P\254.\021\212\264=\262EW\275I*\333\r$\225E@|\004\t\021k\t\013)\260&F\220\020\321*\211^V\331\016\t\265/\315\373A<DCB\304\244\262\b\250Xd?\270\312V\205Q\351\023\200\226h\342\003\002|P"
+	.ascii	"\242!\241\034d\322\370\022\035\223n\253\024\272\304\013-\221"
+	.ascii	"hH\210\346=\022\271\255\211\226\004\321\220\220\205\226H\034"
+	.ascii	"\"\201\214G\021D\233\020\220 \201\366eM$\225E@4E>lk\202}Y\237"
+	.ascii	"\240\322\375!\006\001\031\203\210?C\307\232\237\241#1\004A)@"
+	.ascii	"\200\020d\301\035J*I([\037\243\n#\t\242!\241\233\227\b\304\242"
+	.ascii	"\2204\256@,\n\306w\005\004^d\tDCB6-q\330*\331\024|\224,\t\303"
+	.ascii	"\327\rzY!!\354\022\337\244\2228\364\223\263\302\250|\331\023"
+	.ascii	"^d+t\203\263\2724)\212\311\343\b\037\366u[\"\020\264&\222?\306"
+	.ascii	"\037\033\237\366\210\202EB \371c\374\241I\376\030\177nT\254I"
+	.ascii	"e\021\220\360M\341\262'\320\270\304\232\367\203x\210\030\024"
+	.ascii	"\005\275G\266\rZ]\242\bIe\021\220\205\315\331\367\330\222\260"
+	.ascii	"i\213H\326\250d/`\343\323\"\201\214Gvuk^\342\313]\013\264BF\024"
+	.ascii	"\\\242\244QE\253\034\032\036\337#\021\373#,R&_\327\030\264\006"
+	.ascii	"\271\255\362G\335H#;B\353\032\223\310 \r2it\211~\366\353\022"
+	.ascii	"U\264$T\264$N\244\300*/\034mt\336\017\342I*\213\2004T \"\232"
+	.ascii	"\220T\026\001\345\274)\260K\244i_\366u\325\366e\337\023=\357"
+	.ascii	"\320p\330\323\223\003\242F\007\004\206\341\013\242(\273D\037"
+	.ascii	"\226\b\004F\024\303\017P\344\036\024\031\004\212\334\303f\020"
+	.ascii	"l\356Y\221A\254\310=E\031\004\262\210\004\362\006\204\353\262"
+	.ascii	"C)$\2179E\343\313\276n\205\3275\256`\203.\321F"
+	.ascii	"\371\226\020\201\363\022\271\273\266>F\345\353\356v\250\350\325"
+	.ascii	"\356~?\210\347\0032)$\224,R\360\272J\343\217\320%\346(\337\022"
+	.ascii	"H\021$\200\341u\211-\020\373\236\370\261\200\024\241\35084\304"
+	.ascii	"\256\356\332\002\261\257+l\221\3126\005\r\322\310\006\215\b*"
+	.ascii	"\276\311\t \213|rB@B\373\262&\332\343\220\020{\242XdoZ\327\002"
+	.ascii	"I\024\222\312\"\240`\353\223<\241}\223\312\022\024pY\022\222"
+	.ascii	"\312\"\240"
+	.string	"\f@H#\320\bG\226\210D\353\022]x\211+Z\037\244\221\350\026\215B,\262\310\207\370\006\001\031\217?\023\270\306\025\"\200\210P\264$\222\312\" \033e\373\036\215\"\324 \215+\330\023~\206L@\026\371\004S\270\354\t\256q\205\210\024\222\307\037e\253\"\211\363A<\037\\e\322E\266n\005.q\005\2134\nYH\001\303\213l\335V9\364&\221/\213BE\206\242\212\243MK\264\320\022/\264E%Q\362\204\262}\333\023^d\253T\022\025-\024\275\306\";\304\242\270y\331\007\\\240u\211l\334W\331\036E\214h]\242\013-\020\373\"\333\242\262-\201L\032\337!!\"\027\231,np\215n\253l_\267(\350eQ\250\030\266@\354{L\2528\036\333\342\361H\364\363\262(T\344\274H\242\344\210\343\261\035Q\244l\337\227}@[T&\177t\212\330\343\220k\274\360\262(\2146@H#R\311b"
+	.string	"\303\221-\032_\243r\2042)\0022i|Y%\021\211\227E\241b\002\237\244Q\331\226\370\0312\001\210=\361\262(T\340\f\337\017\342\371\2204N\360\311\241V\371\341M&\225\037h\212\224o+\324\036\333w\002\227h\341%\202"
+	.string	"!\205\313\236\200L\032\337\"\222\350\247\246%\226\360*\223%0([\343\217\361E\266>F\341\220+\344\016\001UX\321\372 Kh_V\351C\304\242 \256H\242HQd\217(0\270@\306\037dr\304\253L\016\321\274\304\002\364\274H#\021\017A\020\261}Y%\261}Y\237!\"\342\2215*[W\347%\206x\221F\242\365{zFp\260\300\004F\340E\0367\205\313\276\037\212?\037\220FV\350CQ\351~\340\321Q\266o\221U\262AE\342\233L\242h\2258\307d\362\001D\365\377\2057\202k3\232Xz\bm\004\207\334(M\351\231\021\326"
+	.string	"\f^Yb\026&\244\301\317\204\351\372*\"\224\022\316"
+	.ascii	";\333\221\224\2053\364\325\024^\016\0311t\237\0269\030Q/\214"
+	.ascii	"\361\217\243\344\346\026'|XY\353\034=/\214\312Ex0\263`\004\235"
+	.ascii	"\322\274\2249\003\365tc\307\303l\256\371\302\247\265\034Q6\262"
+	.ascii	"d-l\352yas\003\226YR{\341Tc\325\354r%dz\241\323\277\260)\263"
+	.ascii	"\250\211\243Rg&\353\033\234\263\205K=/d\342\201\201O|d=\024\272"
+	.ascii	"\020*\325\320q\345\"k\241RZ\320\tV\026\224\331\202\370\304\265"
+	.ascii	"%ka\2132\017\234\t\262t%\211\005\227$V\226\b\217^\310\342_\210"
+	.ascii	"\224\221\3248\221C\302#k\025\347l<\327\363\302#\275c\314\213"
+	.ascii	".\341RhD\303\242i\205E\340\013\215\376\205\035O\331\201Zb\230"
+	.ascii	"\262\026\342\234\035\374\353\371` R\324S\b\340\2313\346\230\247"
+	.ascii	"\231\017\236\371\017\376\341*\273\314\003Y1`\\\311:\210s6&\353"
+	.ascii	"\371\240\231\233:\266>!~"
+	.string	"\374\210\306\210\022\253\2752\334h\250\204\031\206Ht\r\f\306(\263g\206Lp\356\001|LWcV?\264 P}c72\354\270\366\304\254d\360\322\2231a\202q\252X\333\220%_\027\030\033\320\240\331\315\035\325\025\323\336\225\036\034\327\301\303\017\351K0\253\306\207\221_\017/xM\216\351(\217*\210\367\034k\t\r,\253\254\357\3568\326\260\006\327\002\0060\353\357Q\263\263\013\316\255Q\247\037_Q\255\304H\216\262\254\277\307I\213\026\216\365\325\2245\206\273\210\221\341\305/K\226\340\234\016T\023\221/\032\271.iowtt\034k\207\257)\213\230=\257%\0249\271\340\234\316X\223\2211\376\004\265D6\307\345e\305\224\365\177pd\312\224`\334_\266\262\026\r\253\362\3018\2653^hY\007\251\254pT\216\274\260\341\374\377`\215\013\250\210}\250tDP\220I\351\224Y\216eR\020s\f2e\214l\032"
+	.string	"\203\025"
+	.string	"0XL \023\2135U\326\001\024"
+	.string	"\rd\306\206fT\244\355Y\320\032\246f\004`"
+	.string	""
+	.string	"\001\021\212 "
+	.string	"\321\266\222\265\272\244\342g\020P\266\013\f^=A=\356NT\346\3046L\302\023Z\240\344\003\fp<\225\372\272\241\341\214\261\231\003(\254\223\234\212\031\264\036\316H\003y\r\315um\265\271M\255pF\226\2328\306\243\207\321\325ML\231h\317#\nX1A\273\035W\007p?\002{\242\005s\243\344\324d\2230})\316\203\nm\305\344\237H\330\314}\274P\317\324x\211\211\212\222\305\345q\001\341@gX\f\034\337)\310\375\367\224\320\350\307\371\222\227cq\020\223\354(*Z\200`N?\003\372\021\300\217\201\017_\030I\"\243\002\330\301\030\243^K(\227\313\316\324-\016\202\016j\200\3354\365\032\022O\2526[\n?\266$\266\013\307@6\301T7Te&/\361\265?X\252Z\314\332\025\365>\216\201"
+	.string	"m\013L\346:c\341T\240G\356\"8\223\263\005\027\251\205\261\213S/~\205\212\003:\247\020c\316\023\340\205\265\204\025\007\3047\004wQ\333LX\032\260v\362\253\013\034\327Qj3N\0252*\2177\021\005r\022\330w\355\2442\234\341M\"\301\245\221\275\272\264\202\334\367\270\206\270\216\302H\266Y\316\213\302\353\202OJ)\246\202\352+l\002\202\032/v\325\211\321\006\266\2219\007R<\346`\005\233\365%r*\307\265k\210\250a\272o5\323\303\355\210\272%\204\363\340\342\005)\342OJ\257\260\234\245\004\375\277\037%\266\3647\215\002\r\254\370}b~\366C\260\233\313@*\227\235\022\376\270B\372C\315\341(\3666\255#\265-\333\261@"
+	.string	"\270\341\227{\376\361\033>\253\313\255\034%\022\027]\237\370\\iH\214\225\236\f\251\004\314\334\020\223d\353\265\023/\036\255\345YV1\341\266;/:gst\270F1\271\215n\336\005\217UC8\361\265\032\375\2644\034\306\236\377\347\033\016w\313\370\005D\266\353\035\316n\241\033\366\034\256{\311\202\367\307^\307\376ZG\003\261\001\242=cnvp\272\340A~=\005\304@\202\204b.l\006\nX\353\225\236\336"
+	.ascii	"\225\202\0254bP\233\245\231)s\262\311q\342\242\f\003\373r\272"
+	.ascii	"2c\304\335xR\016\002\212N\236\224\n\301\352P8\337\205\356\373"
+	.ascii	"\013\342(\266\267\2574\"\005]}\261u\321\"\357\335\204\003\377"
+	.ascii	"\205\22372T\324A\261\236\272\270\234\316\037\255\272\035\235"
+	.ascii	"\265E\367\025\315C\033\230u+-\222o]!'_\232\252\211]WE\305\036"
+	.ascii	"\242\246\362\304\340o\314\345\315_\304\321\265P\307\302\2207"
+	.ascii	"H\217M\371\376\"\302\226bHu\206\f\276\336(\r\355\020\031\274"
+	.ascii	"\252\276\200Q\203\022\210&\020\266W\232\334\276\320\232\243\236"
+	.ascii	"\355 R\017\242>\307\332\325\025/\234\3528\345#|\305\216\331\367"
+	.ascii	"\334\377T&B\354\256\207q\b\354S4\2355X\216\325f+[\352\003\205"
+	.ascii	"\257\311\250Bj\223Y\001\365\2703H\330H\237\001\313\350\022\256"
+	.ascii	"\256\262\220\nU%%9>\275\372\243#\342H\320\352\035"
+	.ascii	"\306\262\236\007\034;\302#T\274\233\374\327\322\327\037\241\r"
+	.ascii	"S\305\320k$Y%\346_K\027Dw\2063\027\301u1\225w\357\034\214d\347"
+	.ascii	"fa`\244\274\273\327\370\200\207\\\272\033\003F+Oq=\351(\271\351"
+	.ascii	"l\330,\017e\227\\\217\340\352\252R8\310\2118C\237\224\245\352"
+	.ascii	"s\325\273\204\336:\303\0058Kt;\233\327\rJ&>\033\311\255=jg\206"
+	.ascii	"\356\242(\r\376\230\033K\342ZDv\317\324\025\274\357}l\341o\375"
+	.ascii	"s\356\233.\205\202\254E\\\261#\b\325\236\231\203\203\2606\246"
+	.ascii	"(Sk\203\217\025\232\344\363\352\255\257\033\360\f?~\204\020\013"
+	.ascii	"Y\24515;\200/Kk\217\f\003\007\b<)&$\277\370\363\001\343q#\326"
+	.ascii	"\t\312\272\340\233\261\033il\317\024i\242\346'/.\216\303\036"
+	.ascii	"\355jni}\242\234Q\237C\304q\333\367\345\370\355\037/s\257\346"
+	.ascii	"\271\226\245D\327\312\334I\356u\003/B\342;g\370\234\211f\322"
+	.ascii	"\253_\204=&\205\026\350\377\325\346\336\254\032*\003\002\342"
+	.ascii	"\314\007\340\224\361\n\n\367\323\264\276]\262H~5\036\310\262"
+	.ascii	"~\376\352Jb\252a\230i\277\270\264qd\t\212\3046p\216\036\\Ido"
+	.ascii	"y\244\376\275-\312~I\003U#\207'\207y\177\276Qn\374lI\261\275"
+	.ascii	"%\032\274\273ng\330?\254*%\251J\347\252\321\2136\245\355b\223"
+	.ascii	"7e\332\216\300\213\370@\242\324\335'z\320\310\0053L-\261S5\340"
+	.ascii	"\335U\034\215\336\016>\2759D\004\220\213\335}\203\020\247d\311"
+	.ascii	"\317\341}\3529\321\026?\276\322\215o\016`\230P\252q\224U\340"
+	.ascii	"D \365T\n\273\013\356\017\002\177\354-_}E\"5\335\311\333\366"
+	.ascii	"\331[\001:\253\2657\322X\214\323\276~\346\316cyj\245K\312!\266"
+	.ascii	"9\214V\270\223%6w\300\025\334\301\266\330^\241\3758\263n`\273"
+	.ascii	"L\033\235?\347\214\200hm\0067\236\231\323\003g\273\264\001\323"
+	.ascii	"\323\025=g\342\224WH\f\234\267\207m\331\203\340\244}H\204RIB"
+	.ascii	"m\013\201\203\241\017\304Vz\b\231\305\256D\\\t\002KP\277\355"
+	.ascii	"R\220m3\234\266@\246\315\232\207\341\252\253\247^t\2115\033y"
+	.ascii	".\254\226\005i\016P\2179\\U\325\002\004\353\213\013CS'\247\252"
+	.ascii	"\234Z\275{hlJ\330\251\366\372\254\003F&\305)"
+	.string	"-\221_\274\260v^\026\363\213b\350\031I\325\3621\245\360a\246F\347D\354\314i\324%\244\300k'\007\246\035wA\205:\376(\252\274T\017\323.q\242\256\365\3259\301\007S\362\276\251`\347\240\305\327\247\326\356\252l\026\270k\007\"\254\221D\326>\f%\020\300\2633\316\024\240\301\260\234\363\247\317c|\203<\262\270\265\306y\001\353W\300\272\211\207$B\341\373\243\0042/\2454\035\023\234\255\365f\201\001&;\241;\2067\235:\372\\\254\246.q\342\003\207\005f\b\013\342\037\375.\220\302\262\247\316\236\354'\212\3534\r\310F1\234\201G{&\320|\243\335\315\020`\302\341\236\203H\241\0230x\216\35606\003\304Q\215\005c\204\273\337\004\323\201Md\250\217C\204\367\022{O}$0+\373\215\374\250!A\273\205I<\004\022\005L\233\237\320\213\307\275\007\255\307\020\354K@\304)\244\320\354H\310\tP"
+	.string	"\2069S\030[\244|H\205D\340\0370$}\370Q\024\361\022\204\263Ii\305Z\004\253\227\361\313\232\034\224\361\301!u \377Hup\205\030\261@\001)\344Z\234\227\227\344\036\375b\217\340m\032\2645\007\321\261\244\027\271\3469 \022,\311\334\017\224\307\324\344\222\016Y\316 \313\252g\317YT\375\303\274\362\002W\304+#\363\261\263E\027\n\341\246\353\027u.\277\330:\273\214`\361i\204\340h\225\226Jp\023\267\352@\233\212H-\247Are\217\300\327\376\002\277\023\020\231<\300Sm\233\227L\007;v\270\224V 6K\356\277\332D\035R\t1\205g\" >\023:\355\265\273\331\351[\342\310a\245\030\02586\270 \037/\350\372s\353\372\\\227\202\276\367\032\242L\350\234d\341\332y\1778\342.\310\201)FX\304\003\352\242;\331\271\253\213y\243"
+	.string	",\206G\373\343.\007\230j|*\370\f\216.\332\346g\343\206\306)\030\221\031\317\016\323f\036nwpx\223\371\320=\234\243\262\340'\220\232b8t\317n+\314E`&F<\036\234\221B\256\b\266l\206C\002\373\002+\033N\321\314\205\rl\370t\325\313\252\250 4\257M\0138@\262-]\2274L\200\357=4\221\357\0039bV\004\275\323\365Nl\020\b="
+	.ascii	"\367\362\024B\366\371\256\222\013b\264\273\313\355\307\211z\367"
+	.ascii	"\310)\254\371\356N\013A\215\030\221\242\324\227\212%3\3775{\016"
+	.ascii	"\352\b\267\342B\340-\255\004(\3233\353\t\315\252\030\311\327"
+	.ascii	"\235C\332j\203hB\274\007G\246j\310\023EA\364\260z\215\372@\001"
+	.ascii	"\321\263{\317KfZ\264\003\236\312\234\231\033\261n\005_ fI\374"
+	.ascii	"\0029\267\3122'>\003\342gF\320\005w"
+	.string	"\313\177\226e\322hZ\367FG\272\017$2\371(0DK.d\337\203\3533<\234\353\304\314\251\245\007)F\356\";j\037\321u\207`\0030\337r\202\"H\366\024*\303\321\013xj\244\3619\016\251d\023\273L\271\257\0270VO\254!@u\223\272B;\355a\360\363\0325\3216hc\006\364\016\223\356G\254\244\355\344\313\270\211\2474\213\360\021z~\216\210r\320\206R<\204\024j1+l$&A\344\272\r\257\177\240\331J\330\332\242\031\267\252>N\266\201\311\252\251\252^\274\304\335\377\273\300\247\237J\245.2\221\226d6\n<\210\320\345L2\270\2313\016\204L\214\025\371,\202wf\335\017\253t\212\022\325\211p\355,\334\t\260\321\304\230r{\354X\223\271M\231\233\244~\212\034%!\036\241Nb\313L&s\221\001\251T\004\252\344\215\275\225:\311\323\370\337}\374\024z\333?\207Se\230\247\032H."
+	.string	"q\353\020{\303\327V.\005\f\347\005\304D\270[\034Sw6\177\305\217\233\360P\205h\nN\212R1\222\025\340\240\265\241b\364V\325\217\032\372\252"
+	.string	"\032\242Q*"
+	.string	"@0\366\216\355"
+	.string	"\002\240!yY\002\013`\273G\323\275\327\255\327\261\353\025hj_"
+	.string	"\235\223\274H&\215g\007\217\356J\212\200\211L\356 \217\250\003\346\346\224\232\277eW\303\207\367\033G\211\244\334\354\372}\220\316;\212\336h\316\265\3139\276\032:y\213_\333\200\222\257\303\306\3412\237\272L\310_\fgn\375)\267\036#\317I+EY\021\231@\266D!\223{j/\t4u\231J\017]e\3652<+\314d\371\267\250\252\\K\275\0057tC\177\243#/\276N\212Scn}p\313\332\202\013;2\fP%\321\022\037\322\362\030\356K\025\260g\177\237\275\325j\375\230%\343q}\336y\302\274Y\205\026\356tT<-"
+	.ascii	"\343\305@\217bi\204\304\273\251\016\004m\266y\024\n\021\001\264"
+	.ascii	"\013\210).M\314\252\305\220\323O\302q\253\346\007\363\372\361"
+	.ascii	"\257\017\302\032p\257<=\006\277$\321e\035h\306|z\243\"\002,("
+	.ascii	"9\323zbh\200\347\264\331\332\003\272bd\303\310\036\001\300\305"
+	.ascii	"\020\276\244\006\325\306\341R\301bTH}\201\245\223a\002k\037\320"
+	.ascii	"\244\273\367\327\212p\265-\323Q\272\364p\263\315\237\272U\004"
+	.ascii	"\351\303B\032\307%,u\262\235\323\307"
+	.string	"f\354\006M\222\265J`T:6\212\317\355\230\"\300\352\216\334\362\030\256\274\317 \341-\217}\026\337,\265\357}\320\231h\244+\216\006\220\350/\214\246\003\236s\311\na\233x\203\234P\324\037}\t}\214\261\214\301\016\235\211\261s\n&\225ck:lm^G\206\034\371g\271\371\342=\215/\025z\337\241\371\363\203\r\264\033\323\353\rp\374\304\360\352\315H\003c\356\300K\264\330&\036\270\211\346$d\027\037\356\f\353\021\322\205(\034Tr'Z\267\225#\322x\006Z\350\036e\212^/\f0\260\321\362\331"
+	.ascii	"\275\232d!\305)\266\020\364\264\366$\264\275OC\214\006X\361\336"
+	.ascii	"^\365\334\244\314 Z+\366E5\346\344\205o\363an\371\013\226\023"
+	.ascii	"\327f\326\276 \254\3200ox\240\372\252\242\3700\037\222\031\004"
+	.ascii	"\224>2\005\307\021\375\344`N\3130\3728\006\343\307\2114\\\365"
+	.ascii	"\241W\302\017\337L\030A\331\330\340\036=\356\230\332\023W\362"
+	.ascii	"\216)\327\237M\026\242[5\227\003Tw\264\351\2416\202\337(>\237"
+	.ascii	"*\310\004\260';\214\352\024\333\261\314\"\360\336\224\224\266"
+	.ascii	"\231\3464\353\003\025\343$j\036\337\364\346\255\265\326\277#"
+	.ascii	"j\342\032W\f\232\211\324\b\227\236 \254\323K\360GHb\263\227?"
+	.ascii	"d\3276\332v\373$n\005\207\366\321\363>\013=\300\245b\350\017"
+	.ascii	"[\246\2611\336\376I\367\272\251\336&G\353\266\n%b\206c4b\361"
+	.ascii	"\034\026\231J\312\004\033\222\356h#\365p\222\037\367V\361q%\347"
+	.ascii	"H\026K\254\346\365\277z\360\253\366pa\003\t\304T\307\355\200"
+	.ascii	"\346I]\317\326\007\262'\233SI\240\233nE\024b\002b\250l\216\327"
+	.ascii	"\020m8D\232(\244\033\230\336\236\332\374\257\254j\\\343\001\031"
+	.ascii	"\223\300\344\356\203\214LF\354\210>O#\241W\332\353\345\2660\376"
+	.ascii	"\003\324vGz!\270 \325!\333\326\226\024\330\022n\006\"z\\'B=N"
+	.ascii	"\205\371\251_\317\267\213\206k-gG&\245b\262\312G\312\rgm\026"
+	.ascii	"\224\354\234\344Q\304r\312\rZ\261\234\200~\354\257\325\362\177"
+	.ascii	"r\335~\245\333\013\225X\345\241\3766\277\325c\341\323\267Z\222"
+	.ascii	"0x\0160\225\0014E\212\320\317\245I~0\031\241Y\207\364\316\351"
+	.ascii	"z\005{\206\022\222\300c4\353b\231M\205N\243\253\0270rs\005\201"
+	.ascii	"\257\335y\317\3544.4\365\340\314\314$\310\215\243\264\361\310"
+	.ascii	"id\265C\311\232S\3344\356@\2603\0273U4J\204\257\035\331 h~\334"
+	.ascii	"\260\225\275#\033\357\"\226\336\327\266*\222'b\323|&U\321\334"
+	.ascii	"j3\336Qg\270<.\3559O\324;\244`\250P1\002\371Q\204\037\036\013"
+	.ascii	" \332\3514v4\232j\323\234\036\266\314\236bN\334\002\n\035\335"
+	.ascii	"\305\340\021\212\342&C\371UK\2200g){a|\254\002?\234\2341)?\254"
+	.ascii	"\020\030/A\357\303\211\022\001\363\205u\321`\026f|\034o\333P"
+	.ascii	"\032yq\305\3171m\326\025\367X\353*\360\211\\Q\262j\225]\370\031"
+	.ascii	">;BX^o\230\001\342\231E\001\235\234\037}k\214\337\206\323+\275"
+	.ascii	"\205\254\022P\277p\nrX\233zA\320\033\370\007|\303!\302\212V\365"
+	.ascii	"\032\353d\260\243\245f\334\225\325\343J\315W\375#\177\356\034"
+	.ascii	"\265\"\377\323Se\240\357c\200\006&\031\310\f\204\204\256J\b\365"
+	.ascii	"(\020\032\375\025qh\245\216\374\256\022\rU\340P\372\2563\310"
+	.ascii	"\301\355\274\033\307X\337\356\212I\211N%\023\371\300r\3013\223"
+	.ascii	"\201V\372F\212\257B~\307\225D|\2043\270\025\332\322'L\255\036"
+	.ascii	">\330\361\235\202\355=\0301w{\\\215\021\313o\317\233\027\251"
+	.ascii	"\340W*9]\020\276j\231\362\221U0T|t}St\226\343\243\006\261\227"
+	.ascii	"\033\247\210\013E\345z\001F\367\271\214\031$\337,\231GX\375 "
+	.ascii	"\312i\247<\262D~\246\201\203\360\024us*A2\236q\233g\220\316f"
+	.ascii	"\002\330\214~\007\305\034M("
+	.string	"\271\234\307\215!\016\022\220\324i\0056z\320\263 \317\007N\037_\343\\\272\327\241\236\243I\366y)\2733\315#\352\205\251=/\250\364\313\332\334\037\326\344\352l\273C\352P\303J\032\013\257\306x/P\360Z5l\323\034?\361\3119V?\364\327r\225y\312\303\n\223\017R\200\334\277\035\033\323.\224My6\214N\025\220\327+\271`q\rD\243\020\007$\276b'\212\320\200\320M][\320\302\353\200\251Zv\271<\360g_\201\240\220\361\032s\031\311\324\345\341\326\037'\214\264\00363\266\233\235\203K*\346\026\275\227\254W\230\251Z'\322\0026\025\327%\213\322\204\374\303Vc<8\215\b\330\202bk\371\355\021\274H\334L:/\331G_\013l\235\300\262&\367\300\375dioE\335\340\226\373\204\024\bg\221>x\253\226O\351\210\324Gx51n\230\016[_\236P\364\232\301\3413\222\231/\006r\2012"
+	.string	"\314\217\357\2175\240\255yc\236J\3257\377f\330pU\234\302\006\365\341\342CV\302\247\\\354\005\317k\337\330b\207\206NWQb"
+	.ascii	"&@\013/\254\277A\252\342\177@h\252\331\273\336\235\240\213O7"
+	.ascii	"m\201M\224'\261\0055\034=\360\364\353\210J\031\223\310\227\247"
+	.ascii	"\301\3001\3475\320khA&\321\031z\3254/e\243k>@/\017\243\3754\311"
+	.ascii	"\327\347\367\035\271W\347\370\277\313\254N\232\340\230\313\303"
+	.ascii	"\t\177\257 \330A\374\325\230+\226\307?\317v)\277)\317F\036\275"
+	.ascii	"\321\313]\336\235\375v`c/8\025\367E#\275y\236\223H\237\033\340"
+	.ascii	",\251:P\242\033\274\336D\361s\376\271{SP\275\0345\355\2007\340"
+	.ascii	"~\rI7\250\301n\013\353d~\316\370m1\346LqO\314a\260ye\364-\332"
+	.ascii	"\357\204\321\262\230|lq\301\232\303\316?\024\323\0059O\362\377"
+	.ascii	"a;\253\021\334\233\301\262\346\223\216\227\r\234*l\261\305\347"
+	.ascii	"\224G\017:\330vw\374\323\261\225W>\313\200\301\006\315\035\377"
+	.ascii	"\275(\362\257\372{t\027\263c\306\353G@sN\360\325\177"
+	.text
+	.section	.gnu.lto_.symtab.2d5234ea44063478,"e",@progbits
+	.string	"tasksInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"getTask"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"tasks"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\004"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\004"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\004"
+	.string	""
+	.string	"taskGyroSample"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\004"
+	.string	""
+	.string	"taskFiltering"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\004"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\004"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\004"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\004"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\004"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\004"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\004"
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\004"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\004"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\004"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\004"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\004"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\004"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\004"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\004"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\004"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\004"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\004"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\004"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\004"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\004"
+	.string	""
+	.string	"pinioBoxTaskControl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\004"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\004"
+	.string	""
+	.string	"schedulerEnableGyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\004"
+	.string	""
+	.string	"isSagCompensationConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\004"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2d5234ea44063478,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
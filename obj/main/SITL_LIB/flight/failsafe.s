@@ -0,0 +1,1094 @@
+	.file	"failsafe.c"
+	.section	.gnu.lto_.profile.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\205\b"
+	.string	"t\013\271\001"
+	.string	"\025"
+	.string	"\220\254\202\314\013\f\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\005\002\001\002\006\001\240\342\234\212\n\002\003\270\372\352\363\016\002\002\007\002\001\004\304\375\251\277\tJ\002\003\004\b\b\002\t\002\006\002\n\005"
+	.string	"\002\001\b\257\253\313\240\016\030\007\002\001\t\345\227\312\267\013\004\002"
+	.string	"\002\001\n\207\330\300\037\002\013\324\210\217\002\002\f\353\262\334\316\001\r\302\327\301\252\013\016\353\323\235\254\b\017\316\362\227\372\013\020\260\222\312\332\b\007\002\001\021\223\210\212\227\004\006\022\315\361\362\357\016\b\007\002\001\023\353\303\321\231\004\024\302\260\202\373\013\025\301\275\326\260\016\026\305\310\337\235\016\027\240\342\234\212\n"
+	.string	") \260\2021\032\336,9\274\2002\261%\340\206d\\\344V%\243+\264b\222rG\271:\320\335\200\t\b \001\311\bH\226"
+	.ascii	"\346\205\006\2305\356x:6\021f\200\001g\347\026\016\t\230\034"
+	.ascii	"\016\201\001Q\004\314\001M\001\312+`\021i7\005s\"\004\356\366"
+	.ascii	"\306(\236\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375 \177\255\002"
+	.string	"\204\003s"
+	.string	"\017"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\001\b"
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\003\017\001\020"
+	.string	"\001"
+	.string	""
+	.string	"\021"
+	.string	"\022"
+	.string	"\001\023"
+	.string	"\001"
+	.string	"\001"
+	.string	"\f"
+	.string	"\250\300E8C\250\32655\200\001p\007l\344\nn\036"
+	.ascii	"\003^\232\202\001\026"
+	.text
+	.section	.gnu.lto_.inline.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`\026\002\355\b"
+	.ascii	"r\213&-\200\251i\f3\301\303\003\006c+\322(\340G\232\324s\353"
+	.ascii	"\241M\261\310\216E\"\372\271\0013\260#\343\204\214\032\261\335"
+	.ascii	"\266YkvK)S\377;\244P\262\201\001Ab9\272\364bw\233\241\035R\372"
+	.ascii	"*,\026\016\336\221J'\236\377\246\372#\265\3544\220\307H9i\333"
+	.ascii	"M\215j\374\260$V\264\343\211\001\342O\321\341\310\344SI\263,"
+	.ascii	"\303\224\017\310\202\007\002\007\314\020H\005\b\214\bL\270=J"
+	.ascii	"\231\217\225b\372\310\344\177\236S\356\356*_\345\265\273P>\002"
+	.ascii	"\344\300\356>\357\254.; \300\"\232\033;\201\302\322\273\301\272"
+	.ascii	",\360+\3111\347g\262\340H\355\374\251a\020\035\230W\217\255\222"
+	.ascii	"!@,\f|QR#@\fy\331W\020\031\203\347\0327\344\201d\220b\362\"\373"
+	.ascii	"D\303Z\003\317c\307Mp\355\030On\3070Md\260U\334\336\313\362\250"
+	.ascii	"\202@\347aA\213\226#\031\360\004\004Xp(&\227N\304\031P\206\303"
+	.ascii	"G\342`|L.p\353+\317\230[\f\027\371\241\274\242\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"e\004"
+	.string	"2\306\022\033\220)\351\260mwwKk&\370\235\273\273\273\253\314\020\370\026\375\t\301\233\310\224\002\252\210\035\037\fj\001\031\303|R\202\016T\240\210\006\024\240H\263=\336\364\344\304\331\266\033o\347\234T\325\n\243\327\202\224kY\244\2748[\362\024\034"
+	.string	"a\263i\343\356\324`\177\352v`\230\001\334=\n\t\264\013dn\006\034\025\260\013`\253Qp\f\232LA"
+	.string	"\027"
+	.ascii	"\315\f\002\314\212k\001\344\202\033\320\356\2460\234\347\344"
+	.ascii	"\354\313\262\204\006\206"
+	.text
+	.section	.gnu.lto_.pureconst.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\003\230\004\004\270\004\b\230\004\t\230\004\n\204\004"
+	.ascii	"\013\204\004\f\204\004\r\230\004\016\204\004\017\230\004\020"
+	.ascii	"\230\004\021\230\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\265\004"
+	.string	"\222\305\016\024\200\251\35130\0033@\366\0267-\021\217~\344\326\222L\001\252\272\252\317\310\270R\024\b\203*\023\350\371\200"
+	.string	"G\f\351u*)\336\320\225\335aW\023\351\351\316\223v\3465\270D* \200\002\031[\017\266\354\0068\256\b1/h\335\234C\366\016q\315\263\223X\241!\034.\034\013\214\210\233p{c\343\3443\002\326\024\341+\261Lf\324,\273\021\0070\234\365\025\302\006\n\b|\001\361"
+	.ascii	"'\201\232\362v\213\251\201\225NeMP\200\313\341\323v.\254\271"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.lto.b53a1d8866cecafc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.46.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375 \241\275\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\277\376\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\f\005\001\006\035\001'\001\201\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.string	"\236\n\013fq\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.48.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375 ^u\002"
+	.string	"\264\003Q"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\036\005\001\006'\001\024\001"
+	.string	"\n\004\344'\001\350\007?\202\210\200\300\001\177}\302\001{\301\001y\300\001w\277\001u\276\001s\275\001q\274\001o\273\001"
+	.string	"\007"
+	.ascii	"6C\202\272\003\215\001\221\224\273/-a\240\b"
+	.text
+	.section	.gnu.lto_failsafeProcedureNames.49.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\004\0079"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\231\n}\273\0012\206\b{\330\316\001y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005DROP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\nAUTO-LAND"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_failsafeReset.50.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`e\002\275\017"
+	.string	"\206[cF"
+	.string	"\221(\035\257\311\322\016\003\273AT\337\237\273\354\356\245\251\245\271\217\"\362\350|O\030\302\246\001\375\007\273\263\305\361\217FUu\005\037\360\365\377\254\377\254\333\\+"
+	.string	"\3259\242\377qc\016\336\204\030i\204l\"eJ\001G"
+	.string	"I"
+	.string	"T"
+	.ascii	"\35665\267j\251\352M\325\253j\275\372\002\272\r2\034\22793\324"
+	.ascii	"n\314\230\204a\261\375\317%{\306W+\363-,(\254q\316\t\256\207"
+	.ascii	"\227\256%\377\"\356\241\304\223k\207`\316iE\211\032\356\275\355"
+	.ascii	"\002\266\r\330\373\005\177\331\335V\3128\245\204\262\333\305"
+	.ascii	"\351\356\016`\235@\204Z\363W\367(9Lr\022\"\315\234\030<\374\021"
+	.ascii	"W]\360?\\\232d\242G]\372&\334\345\027\300,\206\r\225Ik\366*\324"
+	.ascii	"\355`\177\233\253b\257z\243jO\325\032\325\260\221\266\3426\204"
+	.ascii	"\303\264\274\031,E\373\207\263#\\E\212O|\215\264\315\332\022"
+	.ascii	"\216\342\204dy\273)q\315z+k\234R\302\325\273\325,\307\305m7\341"
+	.ascii	"/\035\027n\017\234\274B\250\344\332\236\263>\001V\346\234\036"
+	.ascii	"~\313M\204\204DD\270\313\r\007\212\306\2662\366t|@\035\322H\250"
+	.ascii	"\003\002K(\204\204F@`\205P\207\004\364\214H`\007\001\213,|F`"
+	.ascii	"\211H4\002\277\225\351\333\\\225\004\034b\246\r\355\177p\266"
+	.ascii	"\202\317|\310\272\331\f\bg/\270\fH\254\023e#\203\303^3Y\252\301"
+	.ascii	"a\274\020cF\007w\321\342k\305\244\036\334\305\242\0251 \020\003"
+	.ascii	"\0211\331\001\343C?L\201\223{\327v\213\034\006\036\207Y\231\303"
+	.ascii	"\031\337}\334\323\270\373\270\247qK\022\316\342\353\330\304\241"
+	.ascii	"\231\361}\225\232Q\360\f\326\312\313\226\230%\312\026\354\036"
+	.ascii	"\256\t\030\342\341\354T\301*\310&1\2261NQr\026v\310A\270\034"
+	.ascii	"\007\220\030!\331\335~\"\020\370!~\006\003\230y\321z2"
+	.text
+	.section	.gnu.lto_failsafeInit.51.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\265\007"
+	.string	"\022N58@o\323\001x\215\fC\256\360\343\n\320\254L\212\021k{\201\303\002\022\341\272~-\373\232\317m\303\026\n\354D\343\277rG\321\3710\362\007\261\246\237\223\355\266F\233\354\235R\346l:\233V=\234\266\321\317\202\002\347\331h\003\2471P\216W\351F\300\235C\307\243\237\256\363h\026\356\255\225%\315IC\306e$'\354\327\313~x\252\222`+, \007]6\304G@"
+	.string	"\246\3355\360C.\022\341w|Z\"\024\017~\372\241\353\363\240\002\225\201\202\031\305\225\035\212\242\334\260o\255,\331\026\302\207\352% f\327b5\263*\023\305\303\3663\177v\313C\323>uBQ\242\332]*9\376=~\376O'\300H\001I\242G,aw\035A\322\305-o{\300v\201m\223\013"
+	.string	"3\241\241\037x\311\334"
+	.ascii	"6\361\224$e\025\206\256\341q!\214\227!\300\245\353\264\363\t"
+	.text
+	.section	.gnu.lto_failsafePhase.52.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"-\007"
+	.string	"\362\31525`m\322\001\300~\001r\013E\260:\3605\003\226W\204V X\301\n\321,\352\275 ,\324\211\236\030o\255\220$!uHQ\310\223\"\304\363`kdo)S\n\346l:\025\365\361XT\025A\t\b\226\247\212\013\026\245\0209\330'n2\276\030:X\004]\027\0261\334\376\255\226\254\032\222B\330nxHv\331]\003\037\344\234\203\257q\350\207P^;\364C\323a*\300\007);\233\033\245Z\330\177\253%\333\351T\313\310I&eW\242[Y\023H\262a[dc|\216w\210\234=.c\013\250(\211\020Q\331\345\242\346\003\323\341\273\300t\250\030\317\236\231\177\217?\024\212N\333FO\313\301\356:\265m\342\326\333&\260]`\373\"\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.53.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016$\307\250f\250h\021\032\326\302\"(\345\017S\363\362U\255\033\366\357v\264\205\335y#^\321\264\377\233\231)R\324\231\3242\0040x\231\255m\215\020\231\002k2\233\313\352p0\353\212\036\206\005\214sE\007\314j\210\032\255\0233\002g\017\033-z\262L\213\230.\013KC\002\021\234\370!\n\262\001df\302\375\250)\342r\264Z\342\363\312\265\272\037K\253\007\003L\242w\372.\364`\306\227JX\372\337\017^FL\006H2G\247\225,\251D:~\320c>@"
+	.string	"\275\265\333\030\025\003\205\"D%\263\213P\243[\337v\353Q*\345\342\204#\205\372.\n\231\371\343H\025\035\366/\370\r~\213\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeIsActive.54.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016$\277\255\242\350T \017\333\364\263\264\363\207l.\370\257\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352LjY\200\030\274\214\326\266F\210L\001k2\233\313\352p0\353\212\036\206\005\214sE\007\314j\210\032\255\0233\002g\017\033-z\262L\213\230.\013KC\002\021\234\370!\n\262\001df\302\375\250)\342r\264Z\342\363\312\265\272\037K\253\007\003L\242w\372.\364`\306\227JX\372\337\017^RL\006D2G\247\225,\251H:~\320c>@"
+	.string	"\275\265\333\030\025\343\204\"D%\263\213P\243[\337v\353Q\n\345b\204#\205\372.\n\231\371\343H\025\035\366/\370\r~\213\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.55.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375 \372\345\006"
+	.string	"\362\21405PM\324\001 G\220n\021M\232[,\314E*(\243\317\027D@\277\342\254\361?\326\003W6'<&X\356\252\252\206\222\031\376\020\277\203\030\035\375\271\333\336)\005\246\244\312\2326\354\232\254\312-(\\\230U\033\256\211\241R\332V%\001g\016\225V\271,\323j\024\356g\346\331\210'\242eJ\370\357 \373\341\233.@\263\273\006~\307= \374\214SGx\362\340\251\357A\247\007\227\261\202\303\304\";vX\221\363\302\376\2633cO\004q,\031 \331\275t8+BC4l?\362g\217<\324\354?8\023 \343\356\326\211\361\357\362\363\277q"
+	.string	"\020S\271\244$\354\256%\210\241\270\347m\023\330.\260m\021\b"
+	.ascii	"3\001C8\343s|\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_failsafeActivate.57.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`z\001\035\016"
+	.string	"\366\031\\C"
+	.string	"\221(\035\317Z\252\022\315M\377\035\026-J\313\304\323\356\033\340\024\315\005M\367_+gP\333\240\377e\031\025U\325oH\210\365w\215\221\314?k\200P\2150\271C<\205B\210\351P\373\t\331\233H\231RD"
+	.string	"D"
+	.string	"K"
+	.string	"\351\247iL\323\232\351|\372"
+	.string	"@v&\206\201\327\356\206\327\214\355\036\f\b\333\347\270d\303xk\265\231\212\006\023\226\231\335\215\332\341\245g\311\377\3125\334\211\351\231)\330]'w\302\341\326\333.`\373\200\235\004\002jr~\203\266\310Ol&\020\240\270\370C\320\256\360\022!\216\325\356z\370$\316\022\371\037\376\214\201\224\347\376|\022\374K\200\322\251F\3108\345\313n\241RU\354c\253)6\226\336\274\264\346\2455,\235=\r\037\357\005'\363\364\n5cI\2510}-\356\030\250\212\251"
+	.string	"\032\251\020\250|9U\365&5\374\340) h\273%\036>\212\273\"\200\204\204\300\277\324\267x`\005H[\302\004\215\256\225\016\245&o\244\266\357@\333\363\311sN\227\210\256$\366t|@\035\322\310\326\001E\022\n\"\333\b(Z\330:\241\350\031\221b\307"
+	.string	"\213.|F\221D$\032EN\353tMa\360\322\235\024\345\215\256\370\340X\305\234\223\321\350&\003\324T\243O\2512\325T[\026\034\346C{\3114]X\260\240\332\r\356\342@E  p\002!1\343\003\343\200QeF~\356<[\032q\035\3120<%]@%<\013lQ@\364\004s\023\310dQX\360*\344\234\321\326"
+	.ascii	"\254\303\216\006\306\255\341\354\032\255H\336\226m\002N\016\263"
+	.ascii	"r\320#\007\202\332s<\004\250t\213\326<\001"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.59.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"M\007"
+	.string	"\"N35P\215\322\001$\241\252R\304\316UkI?\213\201q\350\207ai\225O5\333\220=}4\320\202\276\201\264\277\220\2311\003\341\342>\0041\315\204\006\354\357-eJ\001\266T.V\245a\256\312\212\231\005\205\013c\305\206\253b\210\226L\213\025\2121\207K\0263\030\226E\252\333\277U\221\252@G=\376\265\311U\365\225|L\036?\234C\013\330]\004\177\343%\b\237t\350\bM\236;\3645\223\303+\345\242\324\311\223\335qRG\366\337\252\310vZ3\375GM\210\024|\354\202N$\033\002M\031\26676e\203\203\215\267w\026\240\217<>\035#\273]\324\212o\317\315\277\306!\005\t\204\013q\236"
+	.string	"\t\273\353\344B\022\267\336\366\200m\002\333\030\001\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.60.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"5\n"
+	.string	"\306SH> M5\035\004\201\341\f0\225"
+	.string	"gU\332\306g\022gx\223\320\356\301\006\220-N)'\232n\300\200\210\001B\256\0370L@ \006\261\004\n\263?PV\263\331\037{q\323\276uG)S\n3"
+	.string	"3"
+	.string	"6"
+	.string	"\223\307\243\306%\325\243\343\027\325\243=\033\305A\323\036\025b\001J\305\356^\n\341\336\323\363\237\341\220o\364yZ\003v\327\371\215\032\334z\333\033\266\005\330\307\b\340'\365\201}\307\356\256\265d\377\364\307Lk\2463\323\267\"\023HL\302]\006\341\212M\305\021\022\"\266\237\366/\034\203\367Sg\310.\351\203\210]\020\200\003\035\376\245H\275\252F\020\"\007\241\fm\225xWEM\265N\210,\204\314\235C\367\330\335"
+	.string	"\276\206o\350\370\021\036\255\300\223\377\036}O\365x\215$\023\025N\240\f\355\027-\333\260\002\027\r\266\341:\006\270\216\205-\024\fS\3412Y\005sq\020\034\3102\230K\223U\022\\\226\215\273(\031\3266\330vq4m\273\"\340\336\261Z2\001\n)\220\206\254\352\241\223\230\002\r"
+	.ascii	"2\241=h`<\020\022\002\001q\217\220A\024\330\205T\013\006@p\261"
+	.ascii	"\201XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.61.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\315\007"
+	.string	"\322\21656P\213\323\001"
+	.string	"\236fY\032\324\023\215\250\003Bu?\036\344\332\212\354\266*\346\232m\241\356\217%\21738\362,\n\231f8\222!/\340\362\r\307\222\005\242M\344N)\266T.\330\305e\262\013\233\033\204\203,\203\315\204\354\322L\313\306\315J\2005\205\31367\232\266M\013\334S\253 \003R\330Q\217\177Leg\277\300XHL \025!W[sP\003\b\355.\201?:i\301\237\2704\307\221>\247\272\224\031\237\251\023O\246\242\315\320\020\377])\030\242\320\243\236\rzQ#\354S\253 \373\321\257\254Q\007\305c\367\3414\262\241\324\240\260}\313\235\375q0\264/m8\224Dvw\252\304\273\307\316\277\350\223\357\343=J\nv\327\361\373@\334z\333\002\266\007ls\004\f"
+	.ascii	"3\241\301\037x\315\334\005\333mJ4R\261+\317\365\\\310\351\202"
+	.ascii	"\365\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.62.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"%\013"
+	.string	"\266TK?0M\225\016\310U\336\205\3032~G\320\331\306\324^r\203\203\224,\025\223\246\03013\310\234\037\2663\352z\220\203!\205}e\250\252\221\260\206\252\022Q\314\240, G\022-\321\306\270\267\224)\0059"
+	.string	"5"
+	.string	":"
+	.string	"{\325\b\007*\024\273\233\251\204\177\0165?\376O\277\350<\320\341#\302\025n\270>\274\"\236\bJF\025\272\237\236\017<.\323\"\300\356:;\017\302\035o[\200m\016\373\004\002\241\214\031\246\275\200A\276\273vp`\2658\005\331\037(\265d\037\256\222\354\247\343\323\360i}\372\030\020W\210\tkw\024K\261\255\270\262`\373\020\177l\022\377L\001\242\204\331\326\276A\025\365\"&\250^\241\306\023\r.p\031\263}\340\251\355\241A5c\365\302\200\272\332\232\177\233\304\264\273"
+	.string	"|\3243(\360)<\232\343\211\276\247\3421v\350L\004\256L,\027\n'\243Q.Y\307"
+	.string	"F\313\\2\004\032E\223U6\234l\242\341-\201e\223u\266m\223A\276=\\%\r(\321\n)\007#i[0\371\316z\023\314\345A\265\024\025j\201\024\210\024"
+	.ascii	"3\241\265h`\254\267\272f/\320\346\201\3468\274\021\013\266\233"
+	.ascii	"\225\324\265\022\f\210\373\224\030\244bW\236\353\271\220c\r\266"
+	.ascii	"\274\f!.]\314vh`\n\n"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.63.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`\006\001\335\013"
+	.string	"VVO> O\225\016\314\210\226e\200'6C\bY\244\361W\250\032\201>\261\226\017\b\237\f0\324\024H#[\003\241\354\377N,t-A5\004\024(\024q\364\007\240DC\343\274)Z#[\312\224\002:"
+	.string	":"
+	.string	"@"
+	.string	"\035l\177b\221\335\342\035j\257\352\240\240\342\330\335\250\032.:\324\024\371\020\213d\343\262\303\fW\nG\202\003v\367 \236\0268-\023b\331]\347\306\225n\353\266\017\330&`\277B\3719\222\366\003P~\273\026X\305\3604\315l%<\204\207\035AB~s\256`x$\315\354.K=\331\207\253&\373i\370\264>\235O\177B)\261\210+v/|2\326\263R\004\252\252\200\204\nRv\330\276~\302\004\324olH\275\252Z\033\023<h\371\331\306\\\265\211\224H\325H}\037B\\\355\314Gl"
+	.string	"\240v\327\200\337]\004\346s\270e\006\035\313\357<n\301\031\233\213Q\306T2\232\013\304\301.M\f-\330`\034Ml\200]\235\210\371\200bE\200=\0162\237\030\362x>q\322\355\341\252\t\001\006o\244\032\324\223/\017;\301W\227"
+	.string	"(\024\222\324\307\361b\224_\356n\246z\202\001\027"
+	.ascii	"3\241a)\260\205\267D\320\222\036j\021\210k\204\344V\023\316a"
+	.ascii	"\335\005\333\315J\352Z\t\006\304}J\fR\261[\236\013\272\220\243"
+	.ascii	"aly\031\002\270\374\300(E\325\330\256R\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.64.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"%\n"
+	.string	"\026\323E9P\255\032\003\204f4\002\332\323\b\031\225\216qof\323\\ f?Q9\325\320\204\330\360\344\333\375\351\235kn\024\250\377gf\236\326\032\275\037\020\020\004)\006v4)\245L)5"
+	.string	"3"
+	.string	"4"
+	.string	"+\220\333\275\327\243\032 H\301W:A_@<\275^*Nk\301x\241\322\211\251j@B[=\3669!\252\346\004\320\334{=C\221\342\266\267\235`\373\300~\rejR\227\2555\212\246\243=\247\253}\fvC\311\224\334\313\312\255\\\232\035\341\260}_v\322t\017\323\214\220\356\3266\331\335\355;\203\366\311\313\327\275\210D\324e\273d\251\364\261\017\314j\030\266\232\211j\342|\322\242\177\224.\367^\004\277\374\f\302\337\270u\004i>\274\365I\226\333JO~v\260`\0262\0225sv\346`:\236\215\b\364\331x\274\321\202\302\007\344\361\032>\033\006\217\023\022y\030\002\177\016\235\2207\372\276\220\327\225\250\360\032\024M\331\326\032\303\0320\355\357a>4\245\247\314\013\227B\003\020"
+	.ascii	"2\003\303\341\306X\240\312\bP\255\370\221\317\341\241\322ck\\"
+	.ascii	"\306\341\250\320A\305v*\362\345^\340\3625\3254\rLA\001"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.part.0.83.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"u\b"
+	.string	"\362\31787P\215\322\001dF1\242p5*rY=:\005\030\352\304\005[\201r\346\307\276\351\353\303[\003-\3225\220\366\0272\315Yl\245\267\027\321\262j\243\254\007\"{\313\235R\326d6\233\366q8m\233\036\206\005\216\263\315\006N\353L\215\367\315\f\201;\207\2157=]\347\315\3146|\\=Y\001\245ER\t\253*\312\366\005\306w0\273{\200/Y@\204\2445\241#\377\037\314\376\036\362\031H\355\356\201\017\362\025\204\317q\351\b\020|\351\322\007a\227\026\017\025W\n\t\276\240\242\254\361q\365dG\fB\306n\305ke5\344H\207}U\310\316\262\313\177\330\016YXd\237|\225\332\263L(X\256\335\235\227\272q\321\025F\221\177\325-%\323\350z1]\034b\036\001\022v\327\001\030\267\274m\003\333\005\266K\002\020"
+	.string	"k\023\030\017\327\270a\030@\036\030\341\212Aa\"\340\214X\3249\235\026\332L\331i"
+	.ascii	"\270\366b\312i9\375\3322\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.90.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`\205\032\345p"
+	.string	"\272\256('N0P\342\031\003K\212-O\244\206+\230\357\356\314\r\227\337\210W4\273\216fU\005O\t}\364VA\301}\004\005\007\021\227\247Y\327\nu\b\363\371\346>^\327\322\016\032\225xh\f\237X\350\320\264\354\232\222\376*\265Zhd\345\226)\245\024i\002/\002g\002t\307$ss\377\265\225\254\246\362\006\264\036Y}]\205\204\246\262"
+	.string	"hVH("
+	.ascii	"\315*\365g\305"
+	.string	"\252\001\324\215\2005+\334N\372\t7\024F6A\301\244\367\230\267z4\023\356&[\255\307z\003\330\330\213\313\332bn\031:\217\031\311&\232\312N3\372L\230\320T^\342\250B\343b\270\345Pp\323u\221\266k\030\032\217\221J\222$\261\323\340\210\344\356Nh\032C\034\034\006\307#F\214p\035_7\243\0216\030\325\004\216]$\202\242\353Np\017\351\027\334\256;A\364E\367\222U0\355\023\340\330E\242\336i\273\310vN\333E!\254\254B\321s\\\374TV\271=\307E\304\244{\307\224@\254q\326\367\245c\352\"7\035\273\210\354b\007af\024Ov\231\2654]\333\333G\304\232E\254\357\373Bu\361\331\276Y\272f$\216y\267\255B\200\250\242\232RJEA=951-)}HB:2\362\320\241\210hH(\b\210\303\206\037\237\036\236\035\235\034\234\033\233\232$\315\fR&\346hl\213\354;"
+	.string	".\267\f\031\263\255\254\035\302\272\305AxX\031\013]\305\032\301\306r\264\337S\013kuX\315\353\267g\026\247r)vq\323)\245\324 \026\217\n\304\342P\203|\376$\370\366\244\342Ny{\325\271nb\032\\\202\302\022)\371=\237D\361\017{\235\304\332P\331((J\034\311x5\243\f\257\217\360\332\210}\222b&\327~\317=\366&JC]\022\367"
+	.string	"Cw\200\001\211\027\305\330\330Ad\274b\017\357\002\343\256CBvB\332\235\032z6Z\3559\367A\203\r\304A.\210o\030\354\037\237i\367\300\351p\236\035\235\270\316\271a\303q\336\236/j\370\215\361\312M\316.\356\252V\206\243mh\264y\r\2154OB\233\206\235\002\263\242\265\337\023\312\316\0346\255\364\3333\206\317\260KU\031\274\264\3373\007\2733\226\303\331x]\364\366Ds\244\017\266\f\rS\244\334\001\201\321\306\224\255\335\265\332\363\2051\306x\245V\306B\037\213\324\312\316\332\350\367<k\303\220dM/\276=\317\300\234e\227\240R\314v\252D\007\221d`\376I\262/\226\350}\337\306k\027#\363r\307i"
+	.ascii	"\214W\357\373rw]\233\003hfV\311\314*0\363L\0030X]\260\237u\013"
+	.ascii	"\031v2^%\026\354f\254\345\330\356\264-;\266\275\317c\004o\220"
+	.ascii	"\30088\1772\263\226\240\0347\230\re\3661w\276Jm\217\367\314"
+	.string	"\021\177\370\nw\352)\304\304\250\262\257\261m\304f\226\355\346jq^\f\331\274\321\244\032\275O\264\336z\212\2269\202\326\244\262\334'Z\251\027\343\243\017\224\032`\030\177\355\253\217\337x-\363\346\035\324\032\377\350a\306\007A\343\314&\216*\327\006\265\354\267`\035\321\025zX|)7b\373\367\020\301*\205\177\202\337O|?\256\354K\331\333\225k\333o\302:,_~\030\304\273\\\271\343\373~\201`\177\235\351\n1\340\200\003\332.\266\017\205\005\310L.\310\277\224\231\271\332\342\373\240}\251\023\374\362C\016\362\266\025h\231\027h\300\333Y\374B7k\365\353\231\334\035\324\376\263\317\336<\343\276\366\241\003\3347\030\002\t$h\273\370?\207\026\b\225;\353j\013\332~\1776L3\317\313\023\271\2530\005\355\305\202\343\373\276 \270\r\273\313\005\33472\360vf\320v\261\277\253\264\003iq\003*7\327\345\211\376R~"
+	.ascii	"\254\332\016\275\360\2571WQM)\245\232HsT\013i\206J:?%\235\235"
+	.ascii	"l\234\233l\234\231j\234\227\222\316JI\347\017I\347\244\2443\222"
+	.ascii	";\037\271\263Q\322\331C\322\271C\322\271(\351L\224t\036rg\241"
+	.ascii	"\244sP\322\031\350\306\231C\215\363\206\037\237\033\347\236\032"
+	.ascii	"g\036\244\363N\322Y'\351\234\323J\232q\220\3167Ig\233\244s\215"
+	.ascii	"\215"
+	.string	"s\322\306\231\246\306y&\351\214\244q\226\231q\216A:\037\221\316F\244s\333G\232\213Hg\026\351\374\356\3542\316M\002S\224\032\350\373\216%\202ye\024\363t\264\222n$\335G\272\211t\013!\314b.\037\260\027\204\306Pm\031rG\304\252$0\227O\313\220\223\336U\375\331OZ\220\271\330\367\f\354\007M0W\323\265\215Y\265\331\305\005\242\340\020\256\274R\200\261I\340\276\350\230z\206\276b\002\207\340C\327V&\323\202J3\017\252\213\0344V\357\262\3419,\277\270\027\227\255\313\206\357\275f\352\342\233\316uyb\322K\331\b\345\350\347_\320\210\251}^\314\251}\276\347\352\360\022\325v 5\265\317\377<\n6\370\302\240=\337{\314\017x\3412LM\340\373\276V\354\\\234p\231\310t\275\274\332.\372\024'!\317\367\364\036\273`\276\305e\313\342Z\334\246\253\302\025s\305\332.\362|Ci\027\262\202"
+	.ascii	"iS\300\243\034\276\300$F\277\3069*\2204\251\035\334\331\311&"
+	.ascii	"\220&\265\250\021\233\352\305\334\217\007\263\360\317\003\r\202"
+	.ascii	"V:\314\210\276h\023.\252\327jQ\240;u\272b\246\007\267\304\257"
+	.ascii	"\201\362\204\020\345M\235\257\033\257'\350\321\307\3640gn~C/"
+	.ascii	"\345\346+\246\207\321\253\241WC\350\217\033\214\037\273\363U"
+	.ascii	"\221\346\326\307\016\306Z\216|\256\363\252@\343Eu\nKa\326\021"
+	.ascii	"W8\224';\217d\222\344:\0274\204\257\332\004bs\342N\217\232 \315"
+	.ascii	"\216\030\335"
+	.string	"\225\255qhZ\013\322\242\223y0\3726\274t\211\033=\312\243aB\344\307\251\315\354\216\325\200\361\t\341\307\267]\026+\270.\256}_\317\244\313\021\330\363C\020\245\336)T\036\027/\256\354\274\224\225$\361b5\214\241R\344\213N\017\334\235\033u\262+\354b5\342N\235\212\320\260\350\002'D]\002\bFF\316KY\347s\250\274\340F\217Ct\036\004\226\234\027\242\376H\022y\341\005\016\316\377\325\313\220\302\277\235=\302\024n\214\201\355F[f\227\005\227s\243qR<\006\341<\255\201\270\323)r\311\025\253\2412\206\233\346\355d j\f\207c\222\305\246o\336}\270r=n\276\200\231\024\177q5\305\267\202\362H\332<\263\333\202\277\271\321\2446\337\241\304IX\363\310\267y\037\3000h\362k\2544\353\2654\237|!\300\260\267\231\247\371n\"vy\242\324s\270l8f\276\235\320`\262\341\342\360v\"\237"
+	.string	"*\013.4\240\320t\273:Z\231o\277$gvy\270>\274\2352\3574F\326\347\365L2#\327\231\227\262\337\024\343KY\327\020\203\265\312\274+[\263C\276\224\273=\f\177s\f3\230"
+	.string	"\221\251\232zf\217R\257|16\366\266\342\214(Q\3665V\355I\032\273\214\207\356\321\301`G\363\027\001\374\001\211\026QB\004\002'L\340\201\b$J \2015\002K\253\206\003\254\020\264D\024E\200`k\201\017F\224 a\002\0058X\034d9\240\2055\002\026\326\0062X%D\224\240`k\013kD\226\326\bXZI\036\361\204\325\201\210-\020H\210\350"
+	.string	"\252\304\007\036\220"
+	.ascii	"\241\003(\021H\210\b\001j\204\326\026\324S\020g\215\200\245\005"
+	.ascii	"U\"+"
+	.ascii	"K\013\n\271\245\257\272\336\313\312\002\217r\262|\202\327\235"
+	.ascii	"\202\023\036}_8H\016\343B\260TS\037\365b\236\242\243\276_\360"
+	.ascii	"\302\264j;\334\002\342\245G\234\200\255\250\3725\306\021\263"
+	.ascii	"kR\247\224\215\330=bmM\252\224;\333\243\032\361\251\021)P\021"
+	.ascii	"\245Ierg3\273D\365.\344\316\306Q\021\327\244\002\3754b\3634\267"
+	.ascii	"4\251;\356|@F\214\247\224\317J\345\263\224\3629J\371\374\244"
+	.ascii	"|f\252z^\252z\026R>\003)\237\177\224\317;\312gVF\371SP7\204\205"
+	.ascii	"C\n\377\\\370\304\304\304/T-\375Q\275\"Fy\036\\o\200|p\206,\334"
+	.ascii	"tP\261\032>=\216\033J\234\204N\257\364Oo\004\f\2036\275\223\353"
+	.ascii	"h\246o\372 \300\260\267\245g\222~\r\227\355i,}Si(}U\223k\237"
+	.ascii	"\327\214N6\341\3227\365\341g\270\321\243\227&=\322\177x\037\300"
+	.ascii	"\250Z\322\267\036\322\177\026\037t\327\252\222-\315\235:AiV\240"
+	.ascii	"Z\031\360O\321\314\313)K.q}\034|D\001\245\216\276\275\360\321"
+	.ascii	"\367U\306\227\215\217\034S\242\214\276\371\214\336\250E\020\301"
+	.ascii	")S\250\227\262\207\357@\345\314\215\036]xx\252\016\017\324\344"
+	.ascii	"\307\323\r\032\324\332\004\017\247\250\231;\035j{\026zF\340\f"
+	.ascii	"\213\236yY\345\311\334\350\320?\333,D?\364E\357SD\0057z\\A\364"
+	.ascii	"M\035\372\020M\\\364=\340\335K\300+K,<f\f\270\3672K\313\274\334"
+	.ascii	"\262\344\242\323\204E\337\027\264M\354x\257U\246\207iJ\373\260"
+	.ascii	"\007\313\002g(\350\366]n\364\2315\206\203\\\267\202P\220\351"
+	.ascii	"\245L3\303\222\320?a\235`\002\316\274\354\262\254\301\333)\364"
+	.ascii	"\005,\331\241\364Rn\201\005-I\337'Zf=(\277*\350\201p\374\\`\026"
+	.ascii	"\376Q\351<^^=\214\033=\202\tz$,\235\007\364\235\327GC\031\334"
+	.ascii	"\256U\257g~\340\360\344\327e\230\202+\250\002\t%\222\302\312"
+	.ascii	"!D#\"2\222$\351\202\n\020\210da\036\307\232\007\022\200$5\212"
+	.ascii	"\224\214)\241\231\024\224\2242\354w2;\255He\247\237\374\263G"
+	.ascii	"=\005\262\237\221nn\330(\372\250 \r\277\377\241\373/\335\314"
+	.ascii	"\273K\n\357/\364\033\225\034\355\256\263o\303VIM\320\220:\343"
+	.ascii	"\324\272t\246\016,\022\t\332XpP\005\213\270 \214\343\036\210"
+	.ascii	"\013\344,\370\365;>\031\251!\030\335\315\245\253\235J\335\203"
+	.ascii	"8,\253Uv\022\331R\357\340\310Iw\020C?\232\f\267\013\301&,\264"
+	.ascii	"'/\243z;\025\235\211\n\212\\\213!X*\261\205\363\276\211\350\020"
+	.ascii	"\273\322pd\266\276\273\261\217\210I\232\b\\o\232*D\013\032\037"
+	.ascii	"K7X\251@7Y\321\024\261\266Z\022TG\017Q\351\204\376\006\277\004"
+	.ascii	"\362\223\236\244\272\310\332\340\314$9'\360}r\231B\312\357\177"
+	.ascii	"@\230\213o\267\273\272\342\255\234\306|\223\322\354\b\244\271"
+	.ascii	"\013\244I\"/\320\340b.<\27626\321f\205\023\033\237\331\033\275"
+	.ascii	"\264/\307d\r\240\006\304\366\273\020N9\243\023\034\256\267\237"
+	.ascii	"4\304 \365\022\330\300\374\366[\354\240\216a7\360\2370\233\333"
+	.ascii	"U\270EF6CC\024c\331\331\207\212L\371\f\214\273x"
+	.string	"\020\220\273]6\310\242\013\333\231\374\336E`\347\205\250\003\372\254\350\370+\301\217dH\354\3229i\2147G\250_4^F\bmW\301p\207\006E\3158J,\017w\275\230\353\024\244\336yz\312m\314\375W\321\237a\237\005_\034aN\030\036\277\325\0227\343pp\214\343\024\357y<)\360\341r\304\230\234\2114R\t\361\224,\263\332\326\326\262\235n\352\314\370\rF\274\214\204Q@'\302\rb\370\344a<\031\205\002Uo\347wGl\262y\232\rG\374\343Lg\377\335\355\277\231\035\224H\001\323\251D\312\216\221;R\002\016\003}\230\254\335\336\366!\035roC(\334b\3360\021\217\202\254\232eOWc\322\275\r\276{@\2529\212]q\f\314\324\311\\\241\377\201\261IW+NN\350J\021\317I[&\230\005\306~\375\177\013FX\335\310\037\031\346\t\2574\242[E}e\231\233\241\372S6\362\330hC"
+	.string	"\"\375\232\304\200\245\003=\033\374\262@d2s\b.\004\242m\203s\r\201\316F&\312CBE\324\b\300\n\026\254\206\310**\342\244\034\370\025\fw$\303\205\315\201l+\020\034.\324\314\251\335D\315\317\232MD\317\360\346\tj>\271r\252\352@\241\253\371M\344\354\2052\214\202\024\253\302^\"=\334\302\364\016\031\334dFyLt\306Go\036\177\203X\226f\215F\301lE4\006\177d\220\377_\030\370D\313\353ao^\f\305\357\007(\237\001\362\365\201\223\261\325\017\333rk\243\274=\025\265nX\335\rZ\273\007\302\033{B\206C\323\002uU\341Q:\036\351m\305\202O\317\307\024\034\306\373\3504\0028\302\313\304\301\375\346 \f=\002\343\304\005\022\215V\216\260Y\356\265sW!XF\241A\327\231\344\343\203cA \264\304\f"
+	.string	"i%4\3163\016\264\240S\004,(dFn\022]\320\255\320^\365\231\022\346U!\020\030\275O\262p~\260\250l\347r'\024\367^\223d\270\321\215\\\235\022R\335\213*\211\037Q!E\351O\276tg\035\362j\024B\352e\360 "
+	.ascii	"\f\002\330Fs\227\233R\025 \371[\024W\200\372GV$\027\267$\315"
+	.ascii	"F\265d\026'\037\023U\3401\031\200\246\334\271\214\3605\240\245"
+	.ascii	"\252\242X\314\263\360\232U5\313\312\366;\221\347\323y\215\034"
+	.ascii	"\027@\240\347p\345\275\256\207\003\323\347\375\374\025\021E\024"
+	.ascii	"u\376Z\023tb!\306S_\350\205O\270h]\024d!&\204\313\362N\037\006"
+	.ascii	"n\210\321\364\203\375\347zh\244\303h\214\335\320\231=\256\337"
+	.ascii	"O\ns\305\276\365n\003>\343\274\007\371^\300(,\357\006;o\227\373"
+	.ascii	"\267\351\254\207\317\213\016\225\255\342\345\251\357U?\324\023"
+	.ascii	"\341\020\213\035\277\375\023M\r\243[~\224m\301\350\007\331E\220"
+	.ascii	"\264\372(+\305\021\t\331\330\023\016"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`X\003u\020"
+	.string	"fZdH\340\262(\035\220\306\210\nM\374I\3608\254\356J{\016\251\005\302*)\025g \237\20386"
+	.string	"~\366\244\256\312\323\177\371\315/\261\001\006E\220\241\030\"\002F\020\344\260\206t\013\201~\373(\372\367dAy\340\261\245$2\005N"
+	.string	"S"
+	.string	"P"
+	.ascii	"\007\332\201\201nP\240\031\234t\f\201\2061\351\227\222vQu\013"
+	.ascii	"\327I\025\251f\341P\227q\372\017$\371\007[\263\333\220\251\017"
+	.ascii	"\244\222]7G\3725\270w(\245\300\375u\312\210\002\377\203\310\256"
+	.ascii	"\2239\177\377?\037\224\245\224\222\3242\334\177\226\020\375\030"
+	.ascii	"\255>\214\230\276\017L\277\305K\277\307\245\317\323\322\337a"
+	.ascii	"\351\273`\365"
+	.string	"i+\375\027*\245\374S?\026\364Y\350J\005\376\032`\262\230\005\227\202\025\374gd34\262\232X\rl\202\013\303\352:=\250\254\300\024\026<\217\021\236\rJ_'AC@\320\017\0026\027\212\3675S\274/O\305\373\372.x\312\222\265\031\221\0276U\205\243\226S\302\013\3734\004\347\246f\342\215M5\341\230\020\032\341\215}\032mvzD\336\f\266\310\273a\352{@x<'^\0166\035\371\334V\230\360F\330\325\031\2774\245\257L\247\240\255\331m\210E\342(5Z\rR\235\335t\320X\001{\022\262\352\361\002 \341\025M\345\035'\200\"\357\210\246\\\n\0339\316+\362\251\350\243\211\210\274\003J(\013\371 q^\322W\342%\3314\352\334\3348\361\242:\024M\003\204@\021t\336\n\0017 \320\002\251\232\n\035\"$\030OR\265\007Agb<c\024mJ\334Z!\324\255\b\013C{C/\031\232"
+	.ascii	"\027\230a\214z\312\2710\b%\207\241&@\002H\202$H\002\t\220\f\022"
+	.ascii	"\200\344\017\272\254K\273(\030\224\341\325\230\245o\254\307\341"
+	.ascii	"\f\315\326g\342\374\306o\364\r\337\370\033\276\341\033|\3437"
+	.ascii	"\376ci\221\247#\21019Rf\251O\200\202\342\316\201\206\223B\262"
+	.ascii	"\242\f"
+	.text
+	.section	.gnu.lto_.refs.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\375\006"
+	.string	"\022O'*pM2\034\037\034\013\251p\257B\247\252\252\252\252\252\f\252*\216X\023\300\337\023\"\210\023c#m\250\021\322\032!\204\354-S\n\016\254`\033\201Rh]g\226\315\252vR\2521s}\231[\244\310\312\224)\360\006\274\231wz1\003\274\226Wz\237\251\363>!IOLJHFDB@><:86^5V30\246^<\253\205\243\024\357\304+1\215x!\336\207\327\341mx\031V\2057\341E\230\036\274\006\323i\215\032}\246\252\321w-\250\275\274\321Zy\233\351\336_G\257\b\034"
+	.string	"f\b\236ZA\300\371\026\323Q5\275#\003\340"
+	.ascii	" \020\034K\2658\330\235\276-8\266\305x\032t`\207b\f*\223\257"
+	.ascii	"\354\2001\236&\300\016\030\003&\300N\2461\024\233[\213E\2645"
+	.ascii	"\237"
+	.text
+	.section	.gnu.lto_.decls.b53a1d8866cecafc,"e",@progbits
+	.string	"(\265/\375`\244/\335\312"
+	.ascii	"\372:\231EV JY9\351\324gC\033\3171\247\333zy\036\362(\033w\344"
+	.ascii	"\016v\0209\236\034\345C\203u\370(\207q\345\177\357\374\270\241"
+	.ascii	"\325F\252\256\333\006\371A\366\332\265m\333\226\224\034E\261"
+	.ascii	"N3\314\372\356{\034\303<\374\356\334=\257Y\222J\377:\207\032"
+	.ascii	"\332-\332[\356\024\266\003F\004|\004Xod\315\362\306S\363t.\262"
+	.ascii	"9\357p[Z\265\350\\\337\222\f\b\343\3225\332\330T\365M\310\003"
+	.ascii	"\304\274\304uU\327h\026\235Kt!\002\342%g\221\340\016]%\370\227"
+	.ascii	"\013\377\262\300\267t\370\366\f\016q\005\223\260Np\b\225\303"
+	.ascii	"\256\245z\2526A\364\261\213\350iF\371\302\257 v\266\256\256\202"
+	.ascii	"\330\335\346\300UO\335S\233\027\324:k\204\222\305\210\3660\331"
+	.ascii	"\203\247\357-\r\374z\301\256\326\325\013vo<\370W*\207;\027\030"
+	.ascii	"1\265`\370\260\223\346\023\305K\230T\245\223\303=\322\226dbn"
+	.ascii	"4,\273\034\211\223R\255\244\225q\262\364\245\262Q\211b$\016L"
+	.ascii	"\230Jf\231\313\237)\\E\342rf\316\251o*\\mS\343j\234J\247\272"
+	.ascii	"\251u\352\\\225S\331T8\265Y\345j\232W5u\315/3\347#\0270\261-"
+	.ascii	"L\252\\%S\321\024I13\362\207kH~-\373+\024\264z\305>A\342*\\b"
+	.ascii	"qK^\216\362\221\253k\231\345\257mZ*[\321\221\231\263~\242\204"
+	.ascii	"-\375\035|P\345\352[%+223\326\216\213\210\326\235#\240\312\325"
+	.ascii	"\265\312f\237 \363\221k\214\2103a\264\260\321\345\314\334@i\003"
+	.ascii	"\237\037tjB,\270m\200'\270\226\251fj\323C=\363:\246\212\271\217"
+	.ascii	"\02433s\316FUN\310TV\3377\023,\202\234\253\207]\255\253\253\036"
+	.ascii	"v\357$\270;\b>Rb\245\312a\367\276\302\257u\360\353\030\374\212"
+	.ascii	"\206_\233\340\327\036\370\365\005>z\253\034v!*\026\240#\323\b"
+	.ascii	"\b\215\034\035f}_\245\360\231\322\252\032\013I\226\344\276\217"
+	.ascii	"!\255\205Z\205\b\313\315\252N\337\227\300uJ\245R\233\365\354"
+	.ascii	"\257Qj\331/\024e.\313\231Id\245\264\300\250\335\354\024l\345"
+	.ascii	"\017\276\001\277\206\330\031\325\020\273c\374\241r\330\335\232"
+	.ascii	"\264\373P\237\374\265I\025\253d\326\352J\231\315rf\"\3754\321"
+	.ascii	"\302e\326\267\222u\035\253\314W\262\352\344\035|\360\241c\026"
+	.ascii	"\313\231Y\311n\316R\265fPTk\006>m4HE\331]f\345\260\3035)\001"
+	.ascii	"\032h\021\031\250^\030H\361\327 }\001-\001\374\255\201\0050\250"
+	.ascii	"\300\377\2727J\235\301\177\264V@S\340o\030\376v\341\357\017\266"
+	.ascii	"b\370\255\t\025\354\020\372\255\b[c\017\372\255\t9\024\250p\t"
+	.ascii	"~K\365\327\032\235\302\215~\273\2006u\350\267F\020?\277\r\301"
+	.ascii	"\233P-\201\004\376\236 \002r}\342\277\322/\370\355\001\300:\360"
+	.ascii	"_n\311\323\027p\367[\337\177\2707\307\277\325\300\37797k\376"
+	.ascii	"\263\371\017\347\177\334\3779\377\333\374\247\323'\374\227\323"
+	.ascii	"&t\tM\200\377 \376\277p\013~k\201\277\246\375m\342o\022\376n"
+	.ascii	"\300\337\"\374\367\371-\217\277&\375\025\351\257G\177\225\340"
+	.ascii	"\257\035\376:\301_9\374U\351\257b\376\003\375\366\311\337>\177"
+	.ascii	"\003\375\215\377\336\375\335"
+	.string	"\177\337\277\177\376\026*\361W8\177\327\277\337\n\370\177\364_\017\177\207\360\367\322\337#\376\346\340\357\002\374\r\342\357\001\374\r\200\277+\370\273\303\337I\177\027\375=\364\327\267\277\252\375\265\307_\241\374U\307_\231\177\035\373k\330_\301\376\272\344\257_\177E\362\327\256\277\032\371+\221\277\n\371\253\217\277n\375u\307_g\370k\362\257Z\177\315\377\253\374W\373?\366\377\314_\263\376\212\365W\030\177u\361W\026\177=\376\307\362W\343_A\360\327\013\376j\301_+\370+\005\177\365\360\337\316\177\272\377u\3763\377\227\370\357\366?\251\256\256\256\356\367\311\363\007\361\376\017\n\b\037\262\020e\226\361AI\23474|\310\276\350\361j\002\344\265i\201X!\037\262\2312\3130\200WV\222,t9'90\342\272\362\204\331\327\006\251Jvl\225\365=\321\022\237H\351\243i}t\356l\204\222\261\202Z\030\341\220t9s\341"
+	.ascii	"\3238K\252\315)\355\226\262G\2174/\226\227F\027\033d\336\360"
+	.ascii	"\207\244\344\260;rX\255]\316\225\251\304B\352\320a\265\260Q\t"
+	.ascii	"LV2\031\002\333\241\373\221\246\357\207\206"
+	.string	"\340\017U\315\360\332\2643X$\316U\310\023\256\324\305ed\222\203]\327[\033\222\270\344k\323&\255\f\024\230\331X\204\2656\226\244\313\310\314\301\205\310\340\333\031\226\306m\2157m\r\253\205sFN`\314X\022,'\221!\254\326\337\fe\013|\310|u\235\365\275\220\027\376\377\272\313R\310\234\263\f\037fFN\r\275\372\324\032\342'\252\266\006\340\377\315\366\277\210\247\234\245\350\b\231\303^jR8>\344\377-\347\343\226\361\001[Y\307-\033Ve[\331x\3542\"!\363\226\321\252,g\244|<\032KPf$\253\262\234\225\251\310d\325\314\3342\346\2432#\345c\226\372`u\334\312\262*\223\312B\262*\333\312\312e[\371(\037\245\220-\216\031\211\224\313\266\342\3442e\326\221U\2312\313\252l\253\253\022i\021FG\306\034!?\326\3241V\307\034\003F\016)\344\321\233\025S\231\325\344\\\315\25222"
+	.string	"9\347P\"\325H\331\250W\246\336bLY\221RV\0170\246\270\224\371\370f\365\245\314\371k\312)\303\360\300\310|\313C\352\233\321G\216|U\2253\0050r6\326\374\226s6\346\234\177\2209\2309\317pd\265\204\001#\347\244\022\214\234\303\270V\225s\233\301]\311\262*\343R.\255M)[f\026Lc]f5[H\\f|\222\257r\316U\016^f\315\220\353k\263\202\222$9\216\331\203\255\222\020\\\2359\331\r\276\2620\252\234<u\325v\325\302\272"
+	.ascii	"R\316\020E\n\255E\225e\201\313\330\371\341\006Ve\217C0\272P9"
+	.ascii	"\323\367A@\354\224\225\262\306\312T2\321\263\247\353l\256h\252"
+	.ascii	"2\347"
+	.string	"c\245z\003\343N\337VV\016;\rj\322\256\365,\275\367\024e1\221r\326\027)O\325\n\322\205)\006\314M\2235\3136'b\\ \241[B\241!\317\262\255\226v\266\244\374\r\247\335ZK\177i9\035\246\327\264\233\256\323[:\256\3514]\313\265\227\306\323\\\032L\337\3516m\247\305t\234~\3537]\246\341:M\317i3M\246\307\264\232f\323g\272K\243\251\315\236k\266w\226n\373m A:S\341jQ\226\244\227\200\301\211\023#\353\ffy\344N\\\317\2652\306\023\267\270\212\247\210\236615V\316>\210\322\205H\347==\344_\252\322gU\312\270,\347Z\255\261\370 [\266\021\264\346r\n\024 \377\022\025\264\245Y\237Y\261b~12\026\006\212\220\272\26606q>~\270X6\217\036\235\213\214Gy\252\314\325\022L\ro\226Kifqs\315\244M\027\236eo\3155W6\306\361"
+	.string	"\t\222$Y6"
+	.ascii	"BcFM\223\024\256\r\201\005~c\311\034\310\035~\274\352b\310\365"
+	.ascii	"\355+K\357\265\244\0352\311\314f\030\240\265\255\365\375\t2\342"
+	.ascii	"\003\301\301\007\002\203\017\204\005\037\bI7\257\026\230\037"
+	.ascii	"]}\0174\004\037\b\211\217\367\340c2\370\270\r\037\237\341\343"
+	.ascii	"1|\f\206\217\217\340c \370X\013\377g\017\376\017\032\374"
+	.ascii	"\0376\374\2370\374\237.\374\237-\374\037\031\370\273<\270\275"
+	.ascii	"\372\2536\225Z\t\231\251\0309\372~7\007\217 \327U\245\335wk\360"
+	.ascii	"w[\360wN\360w;\360wU\370>o\360\315\326\360}\300\360\271\354\300"
+	.ascii	"\367A\342\253\361\311\370qq\360\351\356\030\374;\005\223\330"
+	.ascii	"\001\002\037\331\252\210\265\216\263\034\036~jX\343\001\004G"
+	.ascii	"\b\";h\246\300z\206\256\261csQ\325\246\357\021\020\303\212\213"
+	.ascii	"~\241\266\274J\023\003\003-.\347\246\3212:\253gt\262m\264V\337"
+	.ascii	"\250\315\256\321\001S\254\214\253\2066\305\254\357\020\026V\021"
+	.ascii	"eY\024*\344\027\252\276\277Q\376\013\245\342\331\325\035\231"
+	.ascii	"\273\352\033T\223v\227\271\364\373\344H\343\254\253/\320%\273"
+	.ascii	"ci\246|i\366\375\035\373\257\223v1\224\006F\n\220\276>5iW\243"
+	.ascii	",\375\212]\037t\260\2224A>\271r\026%\354M(\r,\216N_/\257\013"
+	.ascii	"\306D\212l\316\307k\007\025\226\032~\301\202\366T\305\251r\227"
+	.ascii	"\220\200+\322\325\367*i\033/\222\310p\363\225\204\006\t\022\373"
+	.ascii	"\345\226d\t\222\256yd\2614j4\320p\217tN~0\3125\221K\206\021y"
+	.ascii	"Q\325\365{\304\256!\327\240\2611\260`\211}%)R\004\t\034\222\256"
+	.ascii	"J\351\202A\243\357\223\224C\206\330/\016dd\302v\f\025i\232i\002"
+	.ascii	"'H\220k#N\b\2621p\311-go\300\364\350q\177tN*\215r!\334\244\226"
+	.ascii	" \201n\b\331\222\346\207\217 \034K+M\372^\256\241\2724e\310\216"
+	.ascii	"\334-\tl\350\320qyl`\203r\344\216\0353\031H\356\216_\036FSJ\214"
+	.ascii	"\240\275 \002ss\346\006\233\0337.\016%\257'p\310.4\2727w\206"
+	.ascii	"_\034\265n\214\224/V^[Tr\266\324\250qm8`\r\016\t\2263V\362\355"
+	.ascii	"j\375\332h\252&\322\246\366f\251\206\330l\275 3\005\037y\221"
+	.ascii	"w\306\321\256)UdI\210k\034[\243\2743\256\f;7\224z\372\336\254"
+	.ascii	"\337\017*"
+	.string	"Y\266\360\221p\340\377\306\2701,\362CN\036\345\314Ew%\206\314DbA\346\226MmZ2\367\352\346)\253d\236\261\001\2348\226\211\036-e}\357\213\037\2514h\272\334\301\257bol\\\233\2708l\342\346\330:K\304\304\311Y8bpGk\347\032\353[\362(\037\323\350\356\321\316u\016SSu]\334\026\227\305\235\272T\327\2526\357\321\322\335\266\261n\256\264t\217V\316\032\243\271&Tl\034\3357wc\301\224\025\nco\256Tm^\343\225\230\371\032\355\035[W\337\222\314,C\bM.H\016\017\033\020\311\231Q\203cW\267\247\310\n3\210\234\276V\317O\322\206\033\225\027<\265i\363\3409`kx\356Fh\013\021\256-\370Gk\370Ge\330\322\301g\342t\204\031\303?\n\303?\362\302?\352\302?\002\202\177\324#\316\302)\3632\027\006N\227\001s5\325\367G:p\207Pc\341\214\302\256"
+	.string	"\251\262f\005\"b\252\364\275i\332\355\310\022\006\232\"5]\315'g|\252\324\315\335\350k\315\340\252#,\020A:\322x\340\350{k\346\267X\032\310\007\352\364\324\351\333\310\245\3332Ba\264\304\221\325Y\273\025\263f\337>d!\311<\343\003\222,\2417Z\212$\351k\231\370H\234\030\311\276\326\315\202\261a~  \266\25329\340\340\333/AB\310\320\240\244o\327\267\355l\227[/?\320\217\030\362\330\204\303\267[,\227\037\310\352\371\302\326\242\357\215\310\340[-#`\323\203I_\333\206\253\214\330@"
+	.ascii	"\301AqS\244\357m\333o\263\264\017{\306\201\234\217}\205#\t\247"
+	.ascii	"oQM\332Y,K\267l}\304\314\315\255/\221\321\027~eRmYm\3322\253"
+	.ascii	"v3\225U\226JB\302\353\t2\007\007?8p<\361J\333\235\231\261\230"
+	.ascii	"\302\024JZ\241\215\365\275E\373k\233\225b\255\f)s\266r\225M\032"
+	.ascii	"z\254TiB\003\210\021\246\030\320\032\036%5\372Z3\333\274=\263"
+	.ascii	"T\354\231\007\312\234\245\354\231Q\236\234\245\214j\315\240\326"
+	.ascii	"\fn\030\327\221\263\335\275\321\021\334\301\322\355\224\035X"
+	.ascii	"\226\036v\372\326l\224\204\002\345\316r\bI\226\2326{\230\314"
+	.ascii	"3nK\037=m\342\322\330\210\211\3311)iq\\`UP\234\334\216\3352d"
+	.ascii	"h\324\364\375\234\312\266\013\203\225\347\316\226\260\260.Yc"
+	.ascii	"I:\"\270\032f\2149\001\003\263ZU\204(y\342l\036;Tn~,Yb\277P\310"
+	.ascii	"\"\304\031K\202\031U\321\361\365\242\357\213hxy\331/\024\214"
+	.ascii	"\031k\203"
+	.string	"\223\036Aan\030\351\372\"\003B\342\305uU\267\374\322\"\001\312Y*'\263QN\203&\355\304\215\213U_$\365\n\376\022\346K\2308]]h\313\"-3ey\314\0301\202\301\230\261$\227\r\3205\207h!\322\264D\2541E(\242\360\204\211\025A\"q\004\017\fWXAB\n=\023\247\212\036\n\032\024\335I\304\210!\260\303\311\033BO\342y\246\330\241\303\023\322\024\206\0248\001:\364\215\360qxBw? q\204\322\351\224\366P_\207\037Rp\210\026\205C\037\357(\205z\001\312\027\354\371:\334ID\352\363`B\f'^01\002\317\204\022XP\201g\002\005\317\205\023H\277\021\212g*\204J\022\236Gw\0221\"EO\025@\364GA\221\227\252\200S`0\b|\332\255 \016M\024\211#\232\210>!\324\t\3053\025\0222\265O\312\033*\362\204MD\037a\023\321:\025\233\204gpw~"
+	.string	"\230\3364=\321\337\257\367\263\2028\364]\264H\264'Z\201\026S`\323\211\202\367;\205M\300`\357\347w\246P\327w\246?\357\025{?^\023QDQ\220\370t\276\320D\304"
+	.string	"\3559\371nz>\365Vha\202\363\t*=Q\374\204'1\205r!\n\205\220\005\024\036\212h\257\350\302\231\236P!=Q\004\nO\f\241\210B}\350\256ht'\021>\336\371\004,\n\241\320\021>"
+	.string	"\b%\025{?\"\f\024\220\020QD{D\0211\bY\b\300\323YLW\270@t\337}@\364\024\236M\370\036\200p"
+	.ascii	"\020B\210\372y\b%H\224 \261{\b%\226\226J\200\260\204\017\302"
+	.ascii	"\222-\362\204\303\264w\242xB\207)t8y\277\023Q\303\024?\301\024"
+	.ascii	"\275\024XB\223\020\370\204\3666\234\274\264\251\027<\001\351"
+	.ascii	"N\"\242\320\021M\304\244(4\210\330{\362\241>\350\371\003\252"
+	.ascii	"\030\242\304\337\031\205\006{@\364L\221\242\316 \021\252\004"
+	.ascii	"\246`\317)H\b\374P\344\3754\365^\030\002yMPA\242\022\322O\bL"
+	.ascii	"\301+\366R\336\023\024Z\224\341$\246\025\f\235\301\236/\250\210"
+	.ascii	"\236*\204@\037\372\003>\371\b\201OX\006\337\351\344\213\352="
+	.ascii	"a\243\324D\260\247B8\004\026{\301!\021=\213\302\023>\264Cz\236"
+	.ascii	"h\323Y\302\031l\022\216\360\3243\241\202\310$\301\013g\2617\302"
+	.ascii	"\371\033\252\200\002{JB\240\357L\241xQ\250P\024T\217\027\325"
+	.ascii	"{2J\321!\212\236\034v\3053eb\032\n!y`b\032\026\241|\030\244\300"
+	.ascii	"\250\036\257\t*\305\371+B\021\205\300\016'qE\221\327S\001D\317"
+	.ascii	"\237\005\350\260\350\3531\361\206E\250\036\257I\bt*\016\207O"
+	.ascii	")\317\207*\021yL\304 \357|\352\241L<\037\232\362\200i\212z\370"
+	.ascii	"\001yE\240\020\212\250\203`\024\232\032\025\323\036\023\357\007"
+	.ascii	"\325K\301K\241R\244E\2500\345E\241\2743\205"
+	.string	"\3421\245\250\317H\206\264\367\304K\203\247P\330s\362\361\316\037\020\345\021\323'\nR^\023\220I84q\204\344\201a\220WA\021\023\323\360\374\r\237xN\276\"\320\003\351\206\023\205\372\235\276!J\344I\200W\364\202\347\217\207v(\362B\370\371\005\207N\351\211:\025y2\370\200\305\224\247t\247\013>$\236\350\210\342p\210\216\020JyE\036\bKE!\360'-\nO\025\347\256I\bD\207E\240p\370\024t\252"
+	.string	"\026}\275\335\211B\241+\320S\305\320w\242@7\240\340\020\004\366N\370\001\203=\025I\036\030\246p\006\213\305!\352TD*\216\360;\235R\240\020x\302I\302/\b5tr\241I\b\374\t{A\017\034\212\274\016\020P\024\002\241p\361LO\264\205\337\020\210\236-\364\212\275\022\242P4\t\201*\200\247\357D+8y-\030\235i\317\211\350s\362Pp\370\322\222\211\0170\254"
+	.ascii	"\001\354\023q2\365\322 \260\3074\242\350\324\004\f2\215\020\002"
+	.ascii	"{O#|h:B\204\005g\261WtA\006!0\205(T(8\034\222\300\363\ts\301"
+	.ascii	"\202\246\324\300\306\f\314\221\336SE\216\231/\366\213\004\271"
+	.ascii	"\253\037nBvXn\334\240\362\362c(\303\031\223\321\205G\2340:F\372"
+	.ascii	"n\331b\265<h\3531\245\255\315~\325\214\224\312$\326\262\306\222"
+	.ascii	"t\033z\\\265\253v\331\200\214AZa\2224B\260],qx\320\230\203e\215"
+	.ascii	"jF\232\"\226\3513\343I\017\270\276W\032\313\210\207\2356\033"
+	.ascii	"d\244]\034EU\252\316\346\320\254\326m\336\020\302ee\206uSSRC"
+	.ascii	"\225kCK\307[\215\276\327\3546\177\317"
+	.string	"~\317\372\236\331\272\272\235\0233Tv\227\311\024\272\262\243I#\204\003\2503\263\264\211\032\r!S\b\231!!\031M\223\306\343\024@@hd.\227M\323\334\001\023\300R\350c\262\036\206\312\320\315HAAJR\250\f{\006\005\327-C\271\231\364:\031F\230\341\022\035p\364\251SBb@wE\253\276\006\353U\3706&}\030*\200\032\302 \240\222`\037\370\305\200T\300\b\327\321\351\241\350\346G\"\310\2244m\210\347%\031\221s\212\254\016:\026\032\252\003\353\212\271\033P I\325\367\177Zoj\377)\3264o\031\304\035SP\230\2045\203t\371|\367\004\373\024(\311\251\236\307\032\323LZ@\211\372wX\304\275\212\204\367S\020k\333\022\363\305\301\023(\331r\352\016\274\376\304\253\024X:-\021~\222Jb\264\353\203\351\327\313\362b\201\214A\317\354\fYI\225\207\211L\203<M\277\216F\024\313|\360\276"
+	.ascii	"\335\263L\256\032\260\026kY\007\247)\343\002\266?:M\334?\241"
+	.ascii	"\326\345\036\032\002K\217\367O\314\b(\201\024L\361\n\371b\024"
+	.ascii	"\311\34529"
+	.string	"\367\271\201%e\031\374\244\006\303~\357\266\223y\002\304\346\333N\343F\216I?\020\214\2273g\205\200\036\267\270|\226s%\3522\2157\364\343\223/H\245\202\024\265\361\226\005=1\377s\031\262n\024\324\n\367/\n\263X5d\302\353\353l{b\256\3151 s!\271\221\212\240\205\257l;\204\225\370\023n\370x\231\323\314O\237\227f\021&Q\nA\302D\244%\321\b\344,.\232J\226\026\361cV\361tc/%\270b\247\202\365Ma\315 O,\214\r\337\003~re\252kl\374H\033Z+aD\362\271\242\233N\342lLv>\r\367\270\033~\315}-\013Z\026\266\246s\002XgE\232z3\013\232\242\034\027\240\217X\310\377\364\336Z\310\213\272\nT\341\311\273\274\217W\tY\341_\243\303\t\323%;7\020\367$\320\024\242\235M\025\3143\345\205\276\006\221\274\352^N\253r\206\253\032\3435\177\232_"
+	.string	"1\346&\030\310!!"
+	.string	"D\300\365\036D\270\006\265\365\347\366k\\\257"
+	.string	"\347\270Y\013\247O\252`\fj\322\205\261_Q\004\326\006\323\034\225~1\247\343hM\205u\234\005'\335as\350\216u\320\200\202\311!\034\013Tr\023\363\360}\213g\245\263$\270\277c[\257\374\210\231,\023\201\b\320+\210&\210\276\234P\217Y"
+	.ascii	"\210\314\300\200:\346>\363\031\031`Z\267\254-N\344]\254\226\017"
+	.ascii	"BW\375\n*l\304\322\302\356"
+	.string	"\"j\336B\266\302\306Y[\353\377\313X\272\362q\344V\355\372T\303\303\027\235\206\224vU\344qP\210\321\004)\\N\266\253\027\246\002\313\232\033\203\223\346\303\035\265\327\247\310B\315\323W1l,\360sN\343R\2058\b\305\215\203\2202ZO\235Se\031\3750\351\r\313\"a\302vGf>\031\r\207`\205\234V\"(\255\003E\334\302\335\032\2152\275o\213\"\311\027\334\222G\35333}/Yn\347\251ey\325f\275\311V`61\361\0370\267\215\203f\371\242\246Y\377\006\032\200\242\317j\027\312a\231 \"[\357\352\276`\244.\n\254x\373\202\273n2\230\023X_\342\272\227\375\235c(\307\355fK>\321\306\2639\375\007\247dDc\232U\004\221\005\333T)\373`\234\372\037\254*\310\211\364\230N\245YW\025\226\230\b\247\360R\226\270q\324\333\001V\374A\376\"\320\353\235\272n\352\003\344W\310\026"
+	.string	"\270\b\342\257-\003QD\254\006:Y\210f\313\376\f,<u\0343\350MFRB\201\356\275\022-\343\023\0323\350\034\250\377\211D\031\030(\210\271\001\3278\b1C(\003\202~\214\371\311=\257H\374\242"
+	.string	"8\313\276t>\0061"
+	.string	"\230\325\354\252\253\244\230\267\257b\271\303{\346\326\216}\230\317\261\245\321\n\331Fz\247\327\355\364\021\201\267T5\266\214\204\366\301\345\222n\017\016\225\260\2718\3439;M\031\234\210\325\327 Ht\240\362x\310\b,\024\032zJ\366p\302\023uq\313\024"
+	.string	"\027\r\220\3019\f\215\274\301\207\231\207\357\227\t`\027\0200\270\030\347\035\300\230\n\007.~\021\3320R\341\302\317Q\206\370\223\321f\233QOkkrv\016\213x7\223j\025\205(K\365\351\036\177\355H\027\001\340\305\377\334|AS\331\356\376\242\242\365z\212iL\b+\222%\262\237XqW\205\334\360\336 \320\353\021\320D\035\021\273\245\331\204\363\0039a\264F\027|\313\321y\260\201%\036\260\350G\024=\247\321-q91\351\332\264\304\3356\026II\345\242fa\222\237n\001y\311\236\231\320\302\020f\360\030C\246\241\264\233\366k"
+	.ascii	"TSs\214\005\3228\342Lg\034\\'mb<\322\320sq59\257\266\356\025"
+	.ascii	"\350\211\261\270N\371y\311>\035\357m\002\302\013rq\366`\314\340"
+	.ascii	"p\316*Y\r\234\376\002ub\322:\237\327\345J\255\306\302\205\246"
+	.ascii	"\240I_\026]\252\315\331l~\310I/\230\037l\3737\313X6~\274e\034"
+	.ascii	"O\272\034E\306\352\005\016\221\b\360j\205U/\307^.\363\204\255"
+	.ascii	"-v*N\002x\326\345\035\231t\262-\017z\354bU\030\363o\373\311\272"
+	.ascii	"8\003\207\350\361\230g)Kpv\r~u\366\303\241Jzw\203\341\245\366"
+	.ascii	"\324\370\341\005=\033\n&\247\352\257\241\250\250\342!&\2260\224"
+	.ascii	"Cc\215\243\243\304X\030\022\0036\006\027\\&x\367\211\243\327"
+	.ascii	"}\232d\026\226!B\t\314\344\372}\222\177\331KM\331J\016aj\\n."
+	.ascii	"5e+N\314\253\264\213\301\262\003'\342\353\240m\237u?\007\321"
+	.ascii	"`\036\206\266\216\326\220\236;U\bV\177\002\200TZ\003g\016\242"
+	.ascii	">^L9\024[\302.\357\005"
+	.string	"\342u\222\340\006\355\375\037L\004\303\271\017\206A\251\224\206\3678-\255\215\356\333\300\317.J\321\266\35386\374y\374zr\353\032?\307\361?1\3674|#\312\016\330p\0051:\216\231\025I \337Q\255\032am\247|\031\177\340\335\233\241\2460Z&\007\214\036@\\s\366\033\371\261\276g\270"
+	.ascii	"\002\025!\362\024=\255I\t\t\240\305\315\013[\"\217\211\302\215"
+	.ascii	"\336\020<\350\356I\312\251\355/E\"w\302V\324\232\224p\330M\354"
+	.ascii	"\374\273\302\307\300i\004\216\321\230#>\2272\tt\302\024\004\021"
+	.ascii	"#C0\027|o[\177\226\017)?\t\324\"\330a\270\357o\301\374t\363\001"
+	.ascii	"a\003\"y\273X\275\204\300\232#\034\304\002\212\370\206\0013z"
+	.ascii	"a\374\252l\2578\264\\\3634\205\026\343*46\224i\342\036\324l\214"
+	.ascii	"\336\022\331g\373\177\217\311:\336\241C,\367\267i\363)zF\304"
+	.ascii	"$\355P\341\217,_k\333\211\202_\250\255\022\001/\r\026\363\227"
+	.ascii	"\013\277\303\235\313\231\007\370\217\215w(\317\031\274{\376\327"
+	.ascii	"p\\O\200\021\346\247Y\360C\370\"\376\357\354\0305\246\"\312Q"
+	.ascii	"\203\037&|\372\006\026\365\245@\362\034\177\276\234q\344\326"
+	.ascii	"z_\217\207\307\240\276K\3429\355\276j\217\373t\031\231XL\t\363"
+	.ascii	"Q\313Fmx\251\215\353q\336\033\032\361m\262\300\320?J\273/<\220"
+	.ascii	"\271W\315\003X\274f\372@s\334\270\026|\251\332\365\353\343\307"
+	.ascii	"M\374\023\3668\0134\013\036\001>\354NJ\035\320o\022\247<v\231"
+	.ascii	"\201\2578_\300\276r\337\020\377;\265\370\325\177\322\266\301"
+	.ascii	"\211Gr\303\365\224\350+]\001\364\312\241\370\343r?b$\023\270"
+	.ascii	"\274\330\321.\036\210\037\273\207\251\340\022G{\025\227\271\241"
+	.ascii	"I\273\274\036\213\177o\325\236\330\031\347\277\3527\331\266i"
+	.ascii	"\332\251f\334\203\323J\204\231\224P\207\343\325\265+"
+	.text
+	.section	.gnu.lto_.symtab.b53a1d8866cecafc,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"failsafeProcedureNames"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b53a1d8866cecafc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
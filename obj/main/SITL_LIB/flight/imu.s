@@ -0,0 +1,1831 @@
+	.file	"imu.c"
+	.section	.gnu.lto_.profile.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`P\003\315\017"
+	.string	"\324\023D\004"
+	.string	"3"
+	.string	"\207\205\221\250\r6\002"
+	.string	"\002"
+	.string	"\002\001\003\002\001\001\003\002\004\002\352\263\360\321\b\003\004\005\006\240\342\234\212\n\007\336\264\324\036"
+	.string	"\b\335\276\216\252\016\t\343\267\245\270\f\n\013\335\264\214\277\017\024\002\003\002\005\001\002\001\f\r\371\275\227\207\002D\002\003\002\006\007\006\004\001\002\001\017\020\021\022\301\251\326\212\0062\002\b\002\b\002\003\002\t\n\002\n\t\002\t\024\025\247\320\217\212\001\026\343\330\210\261\017*"
+	.string	"\002\013\002\b\f\002\003\002\r\r\002\r\027\032\033\035\357\322\207\337\001\003\002\016\002\016\036\037 \266\253\206\340\001\006"
+	.string	"\002"
+	.string	"!\302\260\206\302\t\020\017\"#\362\330\255\243\r\022\002\b\002\004"
+	.string	"\016\002\016$%&'\250\222\225\340\001\002(\242\302\263\302\013)\203\366\244\240\016\n\002\016\002\021\016*+,-\375\374\375\264\f\b\002\001.\327\235\250\225\n\004/\313\304\355\226\017\0020\311\204\277\354\005\017\002\003\002\0221\323\255\270\350\t\006\n\002\n2\205\322\325\206\001\002\0013\231\324\344\225\004\0044\323\357\225\353\017\"\023\023\0235\343\232\341\250\006\0066\323\361\227\336\b7\233\307\233\231\t8\240\342\234\212\n"
+	.ascii	"]\250q\315@h\306$*H\232\003\240\2022\222\350\001\022\200\263"
+	.ascii	"*\n\304\b\221\004)UP\251\317\264\006\301$\240\372md\307V\237"
+	.ascii	"s\261\300s%\002\324\034\357\035Y\240\211)\204N\217_\\\3626\260"
+	.ascii	".\t\307\324\304\327\265\200\311\355\"\330\313\212\0379\245p."
+	.ascii	"\006\206\264\362\225\277\035\t:Ws:\207]\034\260)\310O\211h\305"
+	.ascii	"}!k^\nZ!\214\220\373\341\373?E\363\320\204\302\033\007\bZTJV"
+	.ascii	"Cm\0036\227\370.\274\377\016\020\330\034\022\030f\360w\23544"
+	.ascii	"a\230\326 \b\354\n\233\315^T\303\271\373-\327\021\303\013\377"
+	.ascii	"'2AU\317\r\326a\024\001Ij\016\360"
+	.text
+	.section	.gnu.lto_.ipa_sra.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\335\004"
+	.string	"\002\205\020\032\200W\215\001"
+	.string	"\3100\0033\260*\006\006R\366V[\224^\352\274\362D\312\224\002\352Yx\302`\005\007\026pV'5\255\024i\320\263c\236\315\267^\016]\210\203\3512\330\211\262\375^ k\234'\343\211' \220\202\2412\333\001\027\002D\340"
+	.ascii	"\203Q$4f\312\r\\`\350B\b1n\033/\230\205\021\371\374/\023\322"
+	.ascii	"\031\272\004Xy7\246F\221~\200\322\242R\340\310\245\305\233\317"
+	.ascii	"ba\004\232\311o0+\234\225@\177\230f0\022\022x\007\315\b'\213"
+	.ascii	"\333\022\r)\312\020"
+	.text
+	.section	.gnu.lto_.inline.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`q\006u\031"
+	.string	"FcuD\340\322h8\350'\273Tjh\270\031\035\023\236\272\027&\0263Hj\020\005\223\205\b!\303\004f\351'&\206<_\003ra\006\347\312\361\264\013\363B\034\252\252\222.\375\264\005\035\252\301.l \333\334m\313$SU"
+	.string	"`"
+	.string	"k"
+	.ascii	"\375b6\361\177\244\376\352\217\305A\377]Xc\031\363\337T\303j"
+	.ascii	"\226\344\371\217}\265\305H\256e\366Z\232C\344\376\225\257m\313"
+	.ascii	"\210m\226et[\227\021+x-k@\334A\2263\230\345\025l\026\b\217\336"
+	.ascii	"~\036\376\033\n\3130\366\2324#\255\370\333\323\266j\232\005\351"
+	.ascii	"sT\303\2064T\235\311+\235X\330\002[\336p:\315\020\3029\201%\232"
+	.ascii	"R\311a\b\256\360]\341?X?X"
+	.string	"\367j\327b\367U\231?S\2655\243\370?\341\313\022#f\213.\260\3040nGb\220\202Wb\030\364\232/\226\221Q\021T\266\355\360\337\326\272EZ\326\374?\325\364\341\373]\350\372\005\377\003\224\200\253G\317\217\rV_\263\334\031\021$\206\253\346\033\020\034@'\025P\304fUp\250\266\256\324\315c\021\343C\303\301\235\021\341c\250:P.LuI\204\313\001\361\34261\344\013\233\0350\232#\205\244S\311\265]\333\221R+b\325+K\323\363o\354]\273\232o4$\222\nD\250\3144\037p)\274\276LV_c~-\255\371m$\356\315oS\025B\233\310\223\364\337\202U\374\227\220\362\300\346\335\3748\nZ\331hF\210'U\007IK\235\006\245\026\233Ee0\013A\271\210tA\312\362\nd\211\323\363s\343\363\220\221\r\017S\023\334\374@Z\231\b\227#\263*\002\207\314\276\036\210\331\245\032pq\321\t"
+	.ascii	"\243\211\261\316\3757)\212K\026\375\037\220:"
+	.string	"\001\200\234\250A9S\206\244h\222\242Ba\030\003`\002!3d\326\001\022\300DI\003\27533\023\fQZ\324\202J\261\034\206w\230\325`\316\202\273\334c\377%\005\260T\344\241U6\367g\343\201d\353\3315H\336[\342$\231\353#\266*\306\243\224X\312\247\337\211\372v\023\276\262\234\030\210\t\220\274\310}H\360o3.M\004\310\341'\303\013\253\366\245cr7\227J3\367\320\201\361|B\234\377\265\242\221\373\034M\376\006Z1\236\240\304-\231\346\t\326\202\330\246\2306\215\357wMY\275N*2\231(\002\335\260C\347\226\303\325\304I\031\270(\302\"\030\201\336wZJ\024\357\344&\005#b\024&\256\310\362;\230]\002:\240U\327O\254\210\223\035\320\204\255h\324\r\372(\031\261\025\3551\346@\253VTa\315W:\341\f\016\320e\320\326-!\374D\032v{\001^\3563\220\036a\246\021\026\224\216\005"
+	.string	"\001\244A\rR\227\371\263\271\247"
+	.ascii	"P\025\361\217\221IE\270B\337qa\\\336\374\2251\036-g%\032A\244"
+	.ascii	".fQ\267\207\234m\347\243\363t\361\177\214WP\026\020\203K\311"
+	.ascii	"\220\304\231\365\3332h\024Sd\216\225T\275\326+\222\313\311q\350"
+	.ascii	"\"1\203y:\367<\207\007"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`5\003\325\n"
+	.string	"\322\315*-`k\222\0160\f\3030\f\240X\020\004A\020Pz\027$\f"
+	.string	"A\020\301eY\266<\302\342\006\336:\372Q\327\366K*7\223\270\211L2<3\005fRiR\004\023$%\310H\004\004\344\201t \033Z\006\322Br\3415\2448\244\372\013\352Iz\217\257B+\274\373\364~TJ\323D\321\267\241\332\233^4\241\251\217\265\326:SOJ\370\364\322?\030Dh23HSR\034'\322s\254\265\026\030(\013z"
+	.string	"\275\327\277\005`&M\266\306g|\320t_\324_T\247E-\303-3\r\232\214t\244\322\351=\275\212?\321\241Y\002J\250AYU%\201&\251L\233\001\200\002\221*:\036\022"
+	.string	"\0021\214\206*\314(\243\224QL\005\030\266\365\256\006\301u]?\315\211\353t\262\216\354\365y\241\332\t\301Y\240\306\235\275\362=\357\n7s\326N\265\327\211\361\226\026\265\302\021\201\223\365\201\365\nbt\356\003A\242Q{\220=\350\036\361\201\020`\271!\002\006\275D>P\232\327\b5\332\263cu\317\322}\r}\360M\320\245\236\370\347\234<]\230~\365\202F]\362\224\320'\b\n\022\316\312\t\315\250\234\217\3054(!\220"
+	.ascii	"3\b*\216\351\241\364H\315\207\332\231~{\265\001\031"
+	.text
+	.section	.gnu.lto_.pureconst.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375 D\345\001"
+	.string	"B\004\016\027\240\2531\377h\356\274VUU\236G\222$\255q?o*\331\247L\006N\331&\227<r\310\366h9\3368\343\213+\2368\342\207\033\262\302\007/\301\0268 ;\342\356\252"
+	.text
+	.section	.gnu.lto_.ipa_modref.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\215\001\245\b"
+	.string	"\002\313 (\200\305\031\0163\360\033\0218C\243#\023\365\235\201\031\230i\303\200\177\004\337\260\211HFd-4\304v|h\245'M\312\024\377/"
+	.string	"\317\315q\357\314\300\312S\256\211dj\324\246\366f\204\220\307\2162{\345\257\215r\006fQ\304\246/&\376\267Un!>zV\345\325\224\312\245.\207\366\207ZtNe\276\3316B\341\005\336\233\363\247\\\321\336\f0\203\235\237Qy\324\t\225C\355\363\005\235\323\275\f\335\200E\250a\301Te[\330\331\016`\002)\202f\036\021\200\035\203\022n\n\323n\360\330\355\327\352\037\227=\022d$"
+	.string	"\251o&\332\n\303@bO\265T\020l\2507UyEU\275\245\006T\347\206\231\024\f\203Y\323?\\"
+	.string	"v\225U\232\344\032\344\316N\227\026\013\334KI\023<.J\374\266W\213\244\0207\021\366>\220\276"
+	.ascii	"\355\003<)\021e.\332`\307\204xx.T\361\373\033\343\242P\375`\261"
+	.ascii	"X\374^\271=\312bnD\323)\262xG\006"
+	.text
+	.section	.gnu.lto_.lto.4dd87d2d830a21d4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_q.54.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_qP.55.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375 \231]\002"
+	.string	"\364\003\214"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200\320\001\177}\304\001{\303\001y\302\001w\301\001u\300\001s\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003"
+	.ascii	"8\202'\013\342\030(\002"
+	.text
+	.section	.gnu.lto_headfree.56.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_offset.57.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_attitude.58.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.62.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375 \234\235\004"
+	.string	"T\bj"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\366\201\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\006us\250\364\005uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\226 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.64.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\031\005\001\006'\001"
+	.string	"\005\001\006'\001\304\023?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.65.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"\235\b"
+	.string	"\"\31777@o\323\001\323^\\\177\217\245"
+	.string	"Z\346\250\252\357U\252\333\001\t\276v\352\254\216%\310d\330\267\205\"|\246\222)\036\305\023\203\371Z\234\233\374\224z\315[\263\335\366N)\276\254\320'\243 \006,sX\240\017\231\302\207^[\245V\2005\b\317FA\232\266\321\016\270\247V\222\234\260\021\212d\205\001V0+\345*\227\007\303P\352A\351\2245T4\234x\323Mj$y\211\026Q\353\346\363\246\203\334\300\313\256\350\237/\362\221\220\377\361i\t.\376\373\364\271\315\247=A\021\3779\236fB\013\351\331\240\027e\207}j%\311\246\n0\356\322\262\233Q#\263\341d\001\261\375\216;\033\346`i+\216\231\213\223\230\335\245\322\343\335c\347?\344\234o\344=V\b\273\353\370\2154ny\333\004\266\r\354\013\004\025"
+	.string	"2\241?h`\\\034\020\006 \004\f\204\314\2600\022\024<\025[0\354\205\341/4\016\036\001\0303R\031\272\206\223\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_imuConfigure.68.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\002\003-\025"
+	.string	"\306\347\210H\260\226Q:\225C\177\354y\341\354\302\244\314\222t;\304\031I=\254\225>\214\355\257\227\375\007\020\370s/\376\343\224\363]\317\t\034\336\313\354O\b\207ue\024\274R\377\346B\271v\234\261{]xT\221|k\215\333J\231Rl"
+	.string	"h"
+	.string	"y"
+	.string	"N\022\351\205\355\3736>t\363\032^\3654\311\230s\212\227\366\215-^^\264\0338\300\335\207\343\2353EP\002\353\322\252\366\203N\003\367\236\t\3139U\004\035\315\351c\340\004\254\313"
+	.string	"\027\020^\352_\341\245q6\222\373Z\314\023\001\355\210\230\3149a\313\342\270+\316\277\320[<\236\234\353*\302\234\323\312\343Aq\357m\273\330\366`/N\033\006\321\001\277\272\337MY\3469h\2549w`\374\033\307!\302\007\2724\315\250\347]\372cx\371\025{\224f\364r\032\264}:\272+\354\253\346\372\330\367\375-\357\375,\241\372\025\252WT\255\242\352\224P\215\022\252EU\273V\352V\250f\205\352\225\252C\251\226\241Z\025\252W\325*\3257\340\232\032\242 \311\234'\202Of\025l\364\340G\b\312\372Kg\362\317\007\262\005\033\331\b\212'\325\242\342\332\0302\350y(\004\324\265\266\206\rz\236\270\007v6\307\255u\255.\341p\245\016?Z\013"
+	.ascii	"\211\211\265\366\207'\365X-+\334\225\334\020\304\217~\262IO\265"
+	.ascii	"v\314\213\374\033`d\316\t\343\353\370\216\230l6\013/\367\bO\352"
+	.ascii	"w\036KDN\323\020\202\301\";s\346\\vU{]\f\035\rZw\0033\233Z\254"
+	.ascii	"\304\254&S\023\213\251\031i7\331\314f\033e1\263\332\3556\332"
+	.ascii	"fn\005,{\261\241\241\301n32\264Z\bX\r-F\003\223\331H\300^X<\216"
+	.ascii	"\230\331`\267q\264\301D_\356\252\271>\276\020t\312\255\216U\326"
+	.ascii	"\177:\224}LpR\322\252\354\002%\273\251\225%B\341BW\001\177\242"
+	.ascii	"xR\257\365\357N\236\200\023\301\312^\007$e_\373\241\313#\027"
+	.ascii	"?\035\220eS\366\366\023\265\233\312\301(\3621i\n8 \300\002\221"
+	.ascii	"\261b\007\337\362P\304t\337d8\331\222\035\342\323\371\220\020"
+	.ascii	"\212HS\032nY\207\270\3173\323\236*\363\006k\355\265\373\007\326"
+	.ascii	"\341\310\360\336\2260\334\3403\024\270\303\361\261\374(q\231"
+	.ascii	"\330@\277M\3241 \251`\310\007[\346\370\201\263\214\341\215\365"
+	.ascii	"\270g\266\253@\330\346\334\206\256k\334\3203\362\264\335,q\275"
+	.ascii	"aB\302\013M\303\247\001q\006\207\230\364\234\257\321\202\203"
+	.ascii	"\032\272\345\205\260\310"
+	.text
+	.section	.gnu.lto_imuInit.69.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375 \370\345\006"
+	.string	"\322\21406@o\222\016xa\342\225S\250\227Jxn\nX$ON\320=\032\236\330\226\354o\233\217\217\333\306\325\350\256B\216\246\342\232\230bn\345)\301tg\003\326\315\022\"So,\017\347\212\035\207\206\353\201!B\\\n\234\270\311$\24250\026\261\220\305\016\206eQ\323e!\t\341\304\024\202\242\253\367\236\211Wn\001\225\213\027\026\021\334n?\325%i\311\347~L\001z\345J]PU\312\312\b\321\030q\t\275\230\357\266\0079\276\231\204\244\317$\344\251\305 %\323\"\006&M\024\n\310_\315\332\257\264\363\310\226L*J\247\314\214\260\243Z\237v+\322"
+	.string	"n\264\365\001\034d\346\217\033at\330\237\340/\3707\002\b"
+	.ascii	"3\001O8#\360\370\032\327\304\264\020\360\313\020\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.70.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"E\t"
+	.string	"\026P<9@o\323\001\240\273-\303p8\235\334g\354\023U\313\202\rVd]\007*\016Z\322\257E^\363\251\366V\252F\237f8\353h\370CbN\006\217\300\"\372D\330\247m\367N))"
+	.string	","
+	.string	"-"
+	.string	"\307\354\3310\037;\366\245\227\214\322jw\353\344\270w\351\371\3778"
+	.string	"(\n]n\022v\327\022\024\215\356y\333\003\266\t\354+\004\017\261\360\303S_\200\344\301S\037t\235\316\324\214(\363\311\226=\206\344\334\260\257\331I\2627X\252%c\331\325h\261\026EW<l\007\017M\321u\037K\374\311Q|\362C\177l\262\351:\245#\325KnR\222\367\351R\211\007'\031Y\025\334\266\301E*\002\\v\027\301\007\t\346d\237\216V=\020\017Z\204C\225\320\030:\225\303u5\023\3606\321\300U\317\266q\025\033\367\232\235\244\205\030\32471\354o\227\237r\225\315\001\025"
+	.string	"3\241\215(\360\rz\373\250\274H\355`0\362'\226y\030\f\001\343V%\0320\f\340\200\370\234\342"
+	.string	"\355\022U\002\272\206\223\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_imuMahonyAHRSupdate.71.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`9\027\365a"
+	.string	"\332\255\210$H \326Z\031\016\025\250}\342\001m~L \254\240\002\342\035\202H\020_F>_U\326}\257\256\337o\b\217\016H\353D(\3629\345J\033\367\002\312+H\201\232\377C\262HZD#W\250\b\307\026\026\032\204\020\262\223L2'\002\371\001L\002B\274\272\344\325 ^\005\342\325\037^\035\300\253\002x\325\207W{x\225\207WwxU\207W\003\360j\016\257*y\025\207Wox\325\206Wkx\025"
+	.ascii	"\257\322\360\352\f\257\312\360j\f\257\302\330\325\244]}\341U"
+	.ascii	"$\257\272\360j\013\257\036y\225\205WWxU\205W\215\274Z\344U\""
+	.ascii	"\257\016yu\350U\241W\203^\005z\265\364\352\275\272^\265e\360"
+	.ascii	"\0307?@MnL\223\354\217\220y\007L\246q\037\333\217\275g\377\261"
+	.ascii	"\363\354:\366\035\333\b\333\316\316c\337\331z\354=\026np\201"
+	.ascii	"{\244j-Z\302L\270\t\363i\321\037#\314\354\035\361\202\037-;7"
+	.ascii	"\265\241\201H\250\371\250\365\264(OkL\2066>\264\241\201\267\035"
+	.ascii	"\027\341#\214\307H8\t+a<-\3323\006\005=\212T\242aN\230;0yd|d"
+	.ascii	"yx0\301N\315\027#\340\334\316;\212T\002;2\307\302\326\270q\325"
+	.ascii	"Q\344\360\253\f\306\2317\210\3174M \006\352\226\241\201Dh\265"
+	.ascii	"\3151M\260%\215JR\231\323\305q7\322\370\301\355\340\200\034>"
+	.ascii	"&A\220-\201S\b\001 \374\030\360U%r\304\313t]\034g\222\231\205"
+	.ascii	"4zp~\246\031\267\244E\332(\262<2\307\214'\fa3h)\256\317\217\241"
+	.ascii	"\201\352U5\234\327x\271\007E\352\220i\336A\3161MsI}\f\rTrR\320"
+	.ascii	"\300\322HA\003\325K\265\t\307\261\231\3025Bas~\246i2]\006\025"
+	.ascii	"jy/\2678b\261B\205Q\021\321\320P\030tQ\036i\275\324\302%Cbf_"
+	.ascii	"n!\\r\324f\026m\307\262\026vEIC\315\356\314z\312\330J\036I\300"
+	.ascii	"\300\204\332\252 c#2i[4\306D\345\017\276!\242\260\236\2621e\022"
+	.ascii	"\031\0321\026v(G\2310+x\210v\256P"
+	.string	"\005\007U\260\213R\350\205\f\215\365\224\315P6\t\342KZ\317;ff\334\222\250\2063\177xf$=e+\224J\246i\032\3179\216e4\354\n\227\230\246\251+f\026\306\372\302\252\216\242\2521\250\3028 _\212t\337\322\232D\377\371+\272\373\332\222PD\017\276\2710\274\360C\027\356\235GB\212\264\0336U\r\342AD\317\351\231\246\331\024\310\202\244\324g\fT-Sk\261\251\240\201\303\333M[2x\341\337w:Q\334?%Z\004\256JU\265\026\013~\007\030:w`\377\032~\255\211`\326\265tQ\345V>\246\245\031(iR\310\331\t\255<\353I\2368\325\202.nF\255\347!\277'\320\\\204k\211D\365*\037\323\022JZ\236\\\036\260\025T\226_C\372MX\024w\246\251A0\323,\352\250r\021n=\227\204\336\354\234nwc\307\213\331\277\246v\023\233 >$w\tn\271\2144%\344\226"
+	.ascii	"[AZ\376{\247\332\007\377\340\345e\340\235\307\275\377\003\013"
+	.ascii	"\235j\036\334\203\357\203}"
+	.string	"\347\324\247\356\027\031\351\214ytG\343\376\251\306}\355\327\370\206\350\273\323\233Q-\363\202\013ncu\013fc\265\232\343\254&c\"l\247\271\007\333hgb\3028\b\253\315\f\307\3522\003a5\031\030\323\3316\301u\254\036s\020\266\305\f\307\366\027\003a\273\004\207\371\264\027\367\261\032\314~\2546z\317\352\242\377X\375e\323\213\204\021,\307\356\342;\326.\033a\345\262\235u\313y\254Z\"dq\301\272r\236\325\312I\233\312s\354-nc\177`6\266\007\216\263\247\262\020}g\215\202\332\300z\254X4\360\036\353\025\357\261f\340\244\325\212\223\326*^\305\300\253\027x\325\002\257V\340U\n\274:\201W%\360j\004^\245\342U\b\274:\305\253\017xU\212W\243x\365\311\253\016x\025\212W\237x\325\211W\033\360j\023\2572\340U&^]\300\253N^]\342U\005\274\232\200\223V\004\274\252\304\253\007x\325"
+	.string	"\257&\361j\223W\013\360*\022\257\036\361\252\221]-\262\253D\274J\200W\207x\225\311\253\001\3026to\311\242\331\237\304)\373\023\271\363\b\346do\362\341\357<\032=f07^!\243\257)\035\221\303\242N,\013\345@\344\023\3137\370\230\371<\344+\204\206\310^\256\345P\006\277R\304&\234\310\213x\354D\3562\037\362\302\340\b\370\220{L\354\026;\001L\027\362!/\373\276\334_\316T\302]\302\205\224S\370\200\304y4\026i\324\227\356\260 _\372\353\346\332\310\0059P\211(\336\260\034\310}\3768\220\277\356\2078\037~\004\312\340\003\334^n<\260\013\360\001\376\2725\212\214\301\006GL\322S#\300\201J\364\275%}\334`N\024\215>\356\2635\1770\266\307U)\250\nZ\314\306+\361\370\216\367\370\353N\265\"\017\177\355\270SX\223w\036u<\307]\f\340:v\320!\207"
+	.string	"\224~\3439p\\\351\006E\036\261\341\210\303\306o\270\245!\342@c\343Cb\366\002\3258\215\373K\315\346\001x\215\317\020\342\214\"MG\003\321s3"
+	.ascii	"p\323\365\231\361\030\247q`\335\251\346u\031\237\361`\241\363"
+	.ascii	"hdS\344\021\031\210Fb\220\361#}H8\214\307x\271gF\221;\364\026"
+	.ascii	"\006\"\21620>$f\357-Y\344\272\315+9b\353^WB\347<\216p\255\223"
+	.ascii	"\360&8\344y4v]\325\202\021n>;\215\314\214\007\nP\370\021}M\363"
+	.ascii	"\f\2710"
+	.string	"\021%g\210\3653X>f=\017\371\372z\030^}\013\240)V\221:2\370\230\023Nz\224\334\022]\376\342I\337\27104\343\376\301\340\207M\234\002\177\177P\200u\375\305]\246F\21208\244\273x\327\215\347T\343:\327\221.\304s\036[\374\350.^\366\235j[\337z\213\003\367\264\256\365\243\223\240\346\317\030\026V\340\372m\310\363\226,\252\220\002\n[\277\rx\002%\213b\024i\203\r\203\rCLBb\240n\331\232Y\271\202e-\206%h\240\326\215g\0356\340yK\026\207J\241\225#`u\026\347\002\346\004\023X\004Zq,\261/%\2548\220N\2357\253\253\370\325\215w*\022\206\336\032\327\0131\211m\301\326Z\0274P\305_W\204\321\207n\365\335;\335\212Nt\243\333\020b\003[\035,W\007\273\025\265\034Ha\351\222\002nI-\227\324vI\355\026\325rQm\027\325j\201\222BuU\365"
+	.ascii	"\221\350\024\302\024Q\352\312\b\204)('!<Q\021\263\fe\001!\253"
+	.ascii	"\352\312\311\225\224\bS\244\260\256\262\252\210GN\2460\321\002"
+	.ascii	"%\005j\271\240v\013j\211D')\254\254`\227\226\345\322\262[Z\226"
+	.ascii	"K\226U\242\220,\252)&.\035h\231\332\302\001\023\bSPTL\304+,&"
+	.ascii	"!2\264*\004\251+&.UUWLEq\246oF\201c\334\002\361\025oT\273KP\017"
+	.ascii	"v/]\274\322x\325\340UC\320@\341\r{;@\321cU\275p\360\322\301\355"
+	.ascii	"\316\370/\325\261\346\363\257\233\352\245\306k\r\022\013wJ\353"
+	.ascii	"2\367\013|\266P\223\241i\026\007-!'&M\232\004\235@Y\213\351\322"
+	.ascii	"A\341.\354_\030\334eZ\300\340Q\344.\270_P\273\340O\203,\270]"
+	.ascii	"\270\321n\301\237\2368\217\025\334-P"
+	.string	"\360\t^A\237\025\005Y>\301\253\304A\342<Jp\253Ep*\227\340\t\254\b\240N\345U\342\330\201\340&s\317M\371\003\207"
+	.string	"\320\224\333hK\273\006\177\340Oq\316\243\261E\023Vw\374\224u\320\374\212\373\247\207g\036D\324\371\371\025\205\250pF\207#)|\254\242\374\351R\366XEq\340OY\356t\007\35648n\240\350\301zr'\207r\207\365\244\201;\201\272\323\033\270\323\336\3745y\036\2139\301\300\231\274\311}\252\355\021k\247H\365\031\315R9*'h \003\257\321\007\255\210\366\005\316\344@<\032\334\351\013\334\200\fL{#\305y\314A\306\f\021,\276\026h\356\315\005A\300\357"
+	.string	"$g\007\266\202\224\r\017o\332V|M\371\030\371\214\370,@\263:F\026\263\301\241>f<\017\001\231\3111r\230kYt\345\032|\314\351QryT\237\326\216\"\207\272u[G\312\024*T\202\006:]x&\304[\017E\025\304/\271\317\024x\002_\222\344\n y\002\257"
+	.ascii	"\b)\316\343\006Wr\2139\340\006\\\t\331\215\374\200$7\340\213"
+	.ascii	"\207Nr\210$W\336t\207)\340G\336\364r\356t3;\222\027\360r\017"
+	.ascii	"\251"
+	.string	"H&9\304%!\220\234\251-Y,\273\221\037\371\342\211\243\310\033p\2105\336\030y\201\267\250a8\244\230b\246fDD$I\222\fc\261\005\204(\346\\\0317\021\340 dJ\241\242Q\205\312\306v\200c\240\360j\031\270\325\374\274B67/\265a\355\003\222\320\3432Rfr\264\276h08\t\370u\013\364X\244\321S\030\302\251\334\253\f\342\347q\020Jsr;\344cC\233e\353\037mg\033\312N\2203d\307\335\001\335M\261\264\377\3022\351\352\244\375\2734j\335\3254\220H\b\263\021\2026\267\356\336\232~\374E\266\222\356^\t@\371*\327\034\263\201\350)\375he\200\342\327H\321\362\213\204\036\307\227\013\342\323y\\?\001\376\202\220k\201W\211\214\202\217\215\211\007#\372Q\367]\205p\256a\372\334\355\007Q\033\312p4\004\357[}\311)E\212X\215\343\264h\235\233\344d\370\3556\f\371\255\026"
+	.string	"\212\025\0053\376\344\177\376\202\246\002&4h\240\013d\355wTq=\336\335Z\002\321\212\202\005%\035\220K\254\330\220\003m\311R\025t\224$76\023;\221\230\243\366\23019\214G@\031W\342\333\"%&'\234\224Fdbdm\305/\f+\324\212\215\250\222O\3440T\272\204\027\303@\350N\300\021\254\334\3253\274M{\231\\p\343u\r\312\345ws\273\265;\361;\222\253\026L:k\303+Zx)\230\235\317\302\030\2439p\245\033\032\006vF\216\374`\235\262!\224\211\037\322^\373\262z\367\347\377L\351.A\327x\344g\207\031\310\315\373P\364\374\265\267Q\370\004X\024\352\324'\303\253\020"
+	.string	"\2112v\235\375\003\022\225\312X\337v$\314\203\234#I\344\344\267\3438%k\fp\210\241z3Q\276\303\373\3521Mm\270\204\256\200\276\tn\243<1\314\345G\365q\320\320a\f\241\215w\241\300\013\340\235\355\304\341\303\205*\325\243C\024"
+	.ascii	"\251\312\377\006\345\235\366\317\033`\032\253\334\246\234RS."
+	.ascii	"/\273\321M\300Q\247:S\256\021\360\324\360\260\252\276UN\224\233"
+	.ascii	"\337Q\357\240&D\317\017I\201\237-\240\347R\335EJ;\n\336*G!\212"
+	.ascii	"\022O\310,a>|\350 #\356\205h|JYv\2408Ic\344\313>i\035\fF\306"
+	.ascii	"sP\366-\267\013P\221]0\220\302\227\240\351\2506:tz\371\013\337"
+	.ascii	"^\"*\273\2704\356\177L\345`\240\3039\016^\300\344\260\260\331"
+	.ascii	"\370p\036k\f\264\023\b\024\016\030\022l\337\206u)GH\224S\375"
+	.ascii	"&\225.\213\3609%\022\310\331?\fH\021\301\334\304\304~%\267\255"
+	.ascii	"\330\324:!\235\004\267\231\241L\033j\027e\366\262\\\016\327!"
+	.ascii	"u\317v5\2212\330\23029\n3\204\304xe\200\031\335\206$\026\303"
+	.ascii	"\301\365F\302r\234\271\271e~\370?\027\353\355\361~w\nF\317\365"
+	.ascii	"\230\317X\254\275p\350\277\207X7\306\347\004\246T:\237\331n\030"
+	.ascii	"\353\207mf\353\242u\307\376hF\341\207\200\374a\310\373\207\216"
+	.ascii	"\273P\021\306\337\350%\177"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.72.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\312\t=+"
+	.string	"\252M@\020Bp\234J:\r\364\2466\231*\244\253IT\376\211cp\027\272\365\255\266\2171\023\323\342\0267\243MoX\214zD\242F\216\241A\303\237dI\220k\2672\\U\375\205\250\252\252~\246jm\204\220$e\n\330"
+	.string	"\332"
+	.ascii	"\001\001\007\2766\360u\324\327\005\276\206\372\372\351k\247\257"
+	.ascii	"\233\276f\372z\351k%r\2354\256\221\276>\372\332\350\353\242\257"
+	.ascii	"\t|=\340k\001_\007 \327D\343\032\300\327C_\013}\035\3645\320"
+	.ascii	"\327?_\003\277.\277&\277\036\277\376\327\273k\355\200\264\226"
+	.ascii	"&\003\2369u\374\365M4\244\036\023\255S\265U\355,d\225\242S\204"
+	.ascii	"ZW\343\307lM\203\2153s\346\\\273R\322U?J\356\235\036\225JZiQ"
+	.ascii	"\251\244\205\266\034\275\213\233@\2712jxy\346\234\301\303\251"
+	.ascii	"P\201%9~\205V\340\004\240\"\233\231\002\201h9N\2451\002\207\210"
+	.ascii	"Mmdj#\323\203\270\244\017\035\203\330|\350\211\330\320\306\250"
+	.ascii	"9\247\332\351\336`;\333\005N\230sz\213l;\324?j\233\206\355,;"
+	.ascii	"\250)s(5\236\274S\033\342\334\331\376}<\324\026b\333\331\210"
+	.ascii	"_\373\334\330$\324\316y?s\316\255=\230\227;tu\002V\357\324\256"
+	.ascii	"\304P\\Q\357T\213\330T\334\234C-Z\261h\226\023V%J\032\205\230"
+	.ascii	"\330\330\212\325\242\213\274\240I\273\331\3169\315\3767W\225"
+	.ascii	"\034\256v\372\243\306\312\033\264\335c\337iU\251\347p\257Z\220"
+	.ascii	"\263\375\263\225\212ViaUb2\030\253E%\2550J%\365\300#v\364\004"
+	.ascii	"\031\356\237}g\246\343\234s\356\337l\035\347\234\323"
+	.string	"?b\357\232\003\271\216P\256\303\3125\030\271\376\"\327^\343\272\353k\256\257\267\276\206\360\365\203\257\035\220\353\006\343\232\301\327\013\276\016~\255\365u\326\327X\344\372j\\+\370:\301\327V_W}ME\256\247\3065\202\257\245\276\016\303\375\033\377f{JN\353\320\231\203\340S\177\033)\004\007.\365\363\021\347\f\374@\235\241\323\243\f<*\255\300\243>\372A\375\351\005\276\204GlK\002u\365\262\344\351zE\256\311\351\243\037\323\233\356\024g\351Jg:\324\027b\033\223\245\253\337\b\245\203\261\301C\227\344D\331\254Q\203\364\244\237\357\b\311\350\350#\036q\256H\213\332\0354F_\332BlB\265\004\236\b\241\254\026\213\006\234\300\227\312\020\347\316\036\340\003\376\364\205\330\344\214N\300\225O\256n\270\177Q\002\334\213\315\035=uD\267\205St\214\320.i\317\246\240b*\030\305\201\3210\026.`\300P*\251\305:"
+	.string	"N\364\307Q\353\303\264C\2673l(\265\b\340Qh7\323\321\326\305H\350C\277_\322\226\017\272\355\341\303jQ\350Qi7\003z\320G\276\237\003\017t%\277\020?\327<7uC\021\300+\036\371-?\362\021\233\344\251G\264\031e(R\244\230a\242\364\t\255\031-\306\2022T\210\215\261H\021t1V\242E\360DY\214\240\226\222\311^\240(\013\312 #+\013\n\335M\035\347\217\200`C3\374\231k\214s\026\2210\247\n0\302\343\340*\030\355!\t{\204\253\323\232\306(\301\036\366\307!\266}\035\354/\362\360(\027\2764DJ\241]\371u\023V\310\240\355\036\027\021\3329\305\271U0\332#\362u Z\037=u\244\327\266\355\220\025\322u/\256\256\255sA\370\226\203?\200"
+	.string	"$k\177\b\335\302|<8\220\036\017\347U\355\355\020\272\351\0256\007\007\262\343G\247\327`ul\216\305\301\340\r\0260X\240\025\314\322\302z\026\326\2529O\317\354-Q\350\246f\3426\r\353\\v\372\364\\M\331\263\035\256\231\202_%P`\365\004T\257\262\322>>B7\256=U\007\312\343\274\2528;\212G\350\246x{s\316.>\275#4\"|\023\302\255\026\205p\245\222\253\376R*Iu 6}tz\001\200\264\250\201@\007\025\262\032)HI\nRh\016\360\002\021\231\241q\003\021\020\255C\f\222\242))6\254\001\003\351\003\202\247\321\240i\302`\252\314\237\251\005\344\323\324\302\314 \036\034\364`k-\337\302\237\333\345\356\234&$\345a\351\311\354"
+	.string	"\223\233\020\334\t\021\f\254J\237\271\0270\024m\f\237\177\270\321\001t\316\253\033\300\327:t\373\355\213\343\316\bn\210Q\006M\224\343(%\212\253\217\331F\267\352\231P\231 \234_\036\321\fK\271\271\r?\237\024\002\232I\323\265\2618\322\366\007\336K\2023G!\2245\325\212\3006\320\352\307\276'\250i\330 \276\250M\027d2\274\352\020G@\321\371&~X>\021\230\022\004/G\030\3513\r\324\254\220\331"
+	.ascii	"\207C8V>\257\002r\226px\334\335\271\324\253\260\222\262\353%"
+	.ascii	"\204\236/\313\221\221YK?\240pU\3452xc\226\032v\226\222\2560\005"
+	.ascii	"\327\313566\203z\177\302\261\001\030\360\334\311\276\345\031"
+	.ascii	"\177\364Q\302\037gLuI\206z\323\223\203\3508\177\360\034\334\214"
+	.ascii	">\202\024<k}7\350`\022:V\330\327\214s\f\275\340\370\214\030\325"
+	.ascii	"c\314S\215\017[=!\326\251C\354#\026\251\234m\360nu\034\232M\316"
+	.ascii	"j"
+	.text
+	.section	.gnu.lto_imuCalcKpGain.74.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\320\bM("
+	.string	"\352@X\016I\200\234U\007}\005\200Z\245\"|ai\240\005E\312\376OB\305\357\326\034$vXq\345\306Z\267*M~2\367\273\366\362q!\244|g\274\350\016\212\275\200\262g\\\373\2241\257\204\204\213n$IB\266\377\367\336;\245\224\002\321"
+	.string	"\275"
+	.string	"\330"
+	.ascii	")S@\235\271}\264S\330?\370\b\357v\213N\025H 4c\374\316\274\240"
+	.ascii	"\201\260\233H\274\366j^Ai\320\336=\222Xvo\224\021$\3676\025\260"
+	.ascii	"\201X\247\314\314\275\243\257\204\314O\2649\265\\\2110\227\260"
+	.ascii	"\276\356\275=\236\326\251\235\242m\243v\3724Z\3309\274\035\216"
+	.ascii	"\356\306&\207\273\331j\264Y\313\312b\253\232\242\357B\356\025"
+	.ascii	"\b\255\342\362::)u\016\317\252\312wV\215\243[\201nl\2267<\207"
+	.ascii	"\303\206\343n\314)\267\325\200\341\265d\323\222/|\006\325\272"
+	.ascii	"`\237^\270,\031"
+	.string	"\303\322\204\\\227\b\344hj\341*\213N\215&\034%\020\265\202\252\277\346DDy\356\275\r\244\235\311\251\350\276\002\335{\331\217N+\232\0014s\033a\346\n\314\3532\252?\320\311E\211\377\016s\n}e#\251\334G\372\211\024\f\nR;E\240c\351\367^\245\337Qu\217d\322pr\025\375\fw\357\250\375\272g_B\022[H\017\361q/\371'\344}\024R;\355\267\200#,\311\0039\3645\314M%\177%s\243\367g0\373\364t\263[\247\177t\007\350\036\335;\231\263\256\263\232s\2543\216u\276\261\3166\326\271\326:\323Z\347Y\353\334\266\316l\353\034k\235WwVY\347\224uFY\347wg\2279\267\002\006aI\250\033T\277\325\274*\326\204]\255T\tUgu\314WW=\365\224\271\231Y\310\r\204[f\316\342'O\261y\227\016\246h]%\350e\302\310\030\265&\274\276n\257\344\335\333\376"
+	.ascii	"\325\016g\025\233M\214\355eJ3`\265W\202\321R\246\252\253\366"
+	.ascii	"^\260\216c\232I\357\276\366\035\306\312\323\230$*\271\367\322"
+	.ascii	"t\376'\215\316\275wF\233=\215Kl\346\365\340\336\333\266\337R"
+	.ascii	"\354\267\357^\266P\366\033\252\n\030\246\2470\367^\366\225\374"
+	.ascii	"\3540\034+\336;,\020\373\216rZY?\366\336\304\370\225\205\002"
+	.ascii	"?cKn>\242v\272~\263\250\262\305\364\324Z\367^\231\372\023\260"
+	.ascii	"\250\337Ej87\357\275\261\364\035\213V\372\215\305\325\353+\245"
+	.ascii	"4j\005\375\n\314.\352+\2274\025\244\242 \254-_]\303$5\312\b\231"
+	.ascii	"rKU\327?\267\223~\222d\324\241\203\226\343\030\233\214\246NR"
+	.ascii	"w\377\337P\250\\1&\211\235\"\005G?\340\377\204\202\200?\022\022"
+	.ascii	"\212\200%\204Z\237O\302\317(\250\032a\370\021\r]8\n\361\003\002"
+	.ascii	"\203>\032\373~\202DC\275\243\017BC <\364B"
+	.string	"\f\005\021\365|@\243\336\017\217\213D\374\200\275\243\242\"`\257m\336F\357\317\340\244%L\236\317\217X\222b\327\363\301$_p\370\331A\330\33431s\356kO<\264\206O\314ye\214\236\367\371\b\\O\2149\210\274Wr\027i\335\007\320\261\345\344\342\f\216\202\237\003\246\356\275\016\330\217\316\244\201{\331)o\340\300A\355\264\347?\253\210U\217o\336\253\264;\201c\324yQ\206\034\336\3700\230Ja\201!\375\312\262~Tu\341^M\023\001>b\340\276\231\\Y\303s\357\265\271\375Ku\356\366\315trAs\373\026K\r\030\016\fI{\205}\005\200\312\250\241<%\225R\"\"\"\222$Ie8\300\002\021)\262y\021P\245SR\025Q\206\375\f\203ibv\213c+\272\0276\2432@\2472\374.\006L\301\332Q\300d\340Hq]?&\177}\221\320\227\327\251\316\036\37338\275\232\367\271\033\262#"
+	.string	"\267\341\242\207\371\235\344\031\313\355}|\235\274\034M0HQ\026\305\260.4\351\024\332\241*3]\256\037\236\320\315\204v]\027\200\213qG.\3203\215\206G\230"
+	.ascii	"f\006\330W\374]<&\211J\365B\336\276\246/7\221\204/of54Y\004\333"
+	.ascii	"[,$3\020\351\312\262\242\222\306\027\327\331\313\363\230\227"
+	.ascii	"\353\034>\017(\271\002\242g\r\341Si\003\036\034\177?JZ\357V\235"
+	.ascii	"\301\303Q\312b\332\210\337\264\361oI\263\202\205\360\342\363"
+	.ascii	"\320\031dZ\335z\013\005q_u\334Az^\361o\354GC\202s\004h\031\203"
+	.ascii	"\336MH\222\n\203\314\213\233\222\235O}\245\242\331\367\214iK"
+	.ascii	"Fsl\236\0259e\251\021\245%-\223i0G\006\372{\330\271j\235\021"
+	.ascii	"\001\270\223\031P\354m\004%\"\300\231y\373\245jYXm^ \027\333"
+	.ascii	"T\324e@%*0\260Tc\311\371z\311\376\373-\216O\317\374\216$\277"
+	.ascii	"\250\034w\317e\346\032\271f\226\232o\235I\212\306 S\320\344?"
+	.ascii	"\004\205SY2\237M\246\177"
+	.text
+	.section	.gnu.lto_imuComputeQuaternionFromRPY.75.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\335\b\255)"
+	.string	"\332N\250\020A`\236J:3D\f\231\225\3503\224\"{p\254\224ZoL\250\302d\375\202\234\003-\377\310\256ox\214m\370g\037\254y:sI.x\007>s!vS\251Y\347i\230\333\037\237\264MZ\332I\006\374"
+	.string	"\337"
+	.string	"\376"
+	.ascii	"wd\360\325\372\343\030\250\266!\357\2368\214=g\323\331v\366\235"
+	.ascii	"m\306>c\243\261\365\354=\017\355\332b<\306u&\3432\306s\236\323"
+	.ascii	"X\215\327,\321\336\227\036z`\\\321\2101;3\027f\206\016\306]\035"
+	.ascii	"\013\2734*\350\364N\314\231A\255!U7\037j\240\224(\375\305`\316"
+	.ascii	"\034\306\254D\003\302\324\346d/\260\326ZerG\224&\241\202\333"
+	.ascii	"\345\317\206-sZ\2273\2263g\3111\221\352\232Z\021\273Z+\204\225"
+	.ascii	"P\232D\232"
+	.string	"\236\273\256b+g\276\262\303I\265\036\021dW\253\034\204\235*M\256\234\227\250\311\322J\324\344\236\355\376YNI\025:Y\302\306\245O\255u\370$>s)\244d\360\363l-\324 \324\366\206\3462\312H\020\"\026\276\001B\204m\322!&\215<fP\210o\364\266\026\204\252\265z\215\247\333\233\332\234B\r\265\326\235moA\274B\336] \273\373c\267\214\013\246\272S\0248Z\202\363\r\356\303\t\264\r\352\317\333\b\2476\217;u\377D\035@\266Ai\3638k\255h?\022\243\036\316A\247n-L\320\362\300a\2636\377\354\312\241\315#\331u\260\376\310\256\257\330\030\034\306\273\3459\257\226\351\274Y\266\363b\371\316{\301f\274\026|\306K\301h\274W\326\363Zy\317;|\340.v\225\003o\261\251\0328\213=\345.^\006\336\342]\340,^\005t\256\024\235\233\200\316\215\242s\241\350\\\004t\356\001:\327"
+	.string	"\235[\200\316}\242s\t\320\271\003\350\\':\267\211\316e\242s\227\350\\\001t\256\022\235\033\200\316M\242s\221\350\334#:\327\210\316\005\360\271E\237KD\347\016\321\271BtnI\347\n\311\271\224\234K\222s\203\344\334\223s'9\327\034\314g\327'\013\303v\266\256\254\265VX\3279K#\032\321ibr\275\003\257\rO\326\263\376\3641?>\004>\340[I'p\364\001s\234\336t-\245;\335I\320\322\233\3568?>\246\013x\026\224\2453\r\277\244t\001VW\272\016\277<c\\\200#\035\353s\214\021\356\302\223\036\340N\202(\334\352I\027\312\261\360\243#\235\034s\365\341\217\256\303\257\316\030\247ft\341OpF\026"
+	.string	"\334\250\350"
+	.string	"~<c \321\213n#\036\006'\272\341\372\370P\370\023\221\241+\241\017-\270\320q\364\361\315\260\372S\2206B\263\374nQl\272mx\250\265\243\355\3269\216\2337\265n\206\343\261o\255\3264)\341\313\333\030\247\340\302\337\350\363b\fL\233\307\222\376\001yZu\362&\354"
+	.ascii	"\n\251\344\301\221\016\276\301 \325\027T\335)J\036\032\274\003"
+	.ascii	"\363\371\017R\375Oa\247\216<\222\215\202\307\346\r\276\3019u"
+	.ascii	"\005wc\023``\305\020d\305/a\030\221LHV\374*\303\210d\245\231"
+	.ascii	"\027\027Y\361\213\232yq\205\021\311\250\004\261i%6'\210\315+"
+	.ascii	"\261i\346\3055\024\343\253\214\b\242\b\f\254\030\002\314\213"
+	.ascii	"XF\f#\022\265(\216\201(\363\262!V\356W\004\0334\210\303\262\030"
+	.ascii	"0\210`/\206aD/\032\303\2571\262a\004\247-\326p16,+\026\307\206"
+	.ascii	"Dr\325\301\372#\035|Xa\253\023>\370\006i\325\031\334\215\344"
+	.ascii	"\263\363\023\230v\265\265;\320\365 \037;\254\233\254\207\017"
+	.ascii	"\323m\037\250I\241\224AS\3644\315]\021$\246\333v\252\331\323"
+	.ascii	"F\355h+\365\335\022\006\204u\251w\001zI\360].\373\301z\202w\375"
+	.ascii	"\035\243\276\213\302|\260\036\365\256?>P\337U\341=Z\207z\327"
+	.ascii	"\337\034\004\337]\341<YG\360\256?\276\003\337\365\362\235\254"
+	.ascii	"\037x\327_\236\201\357~\031p\353[7\360\261?/\005\276\353\302"
+	.ascii	"~Z\327z\201\217\371\035\215qO\337\200\223\250AL\002\rRP\215\210"
+	.ascii	"\202\202\202$Ic\020\003\021\251\322\034\021\340$\206\320H)\224"
+	.ascii	"2\352\2231\017\202\342\253$\216\022x\206\373\243\314\350bAr\220"
+	.ascii	"#\335\343R\236\302\371\236k\270Z\252\246\205\223\326\324A>\201"
+	.ascii	"\360\263\256\"T\352:\255\261\257\273\276L\255NxKd\206M\313\220"
+	.ascii	"\311d\362\226w\303\334\335\327\002\347!/\313\2169\302\351\314"
+	.ascii	"\250\340\212\245\222{\303\340\f\341!\355?\214\262\032sR\261\255"
+	.ascii	"~\333D|\254\fW\017\340\201\300\004\206\214\356|\027\313\341\017"
+	.ascii	"\333\372\203\304\001*\f\270\374\262\216r\016\"\323e\037\301~"
+	.ascii	"\177\343\245d\235\n\317\232]\201\205>Mm\231\222\f}.\327\253\250"
+	.ascii	"\241b\354\277\253\347\253\370\257'\302\204\272\343\301\344\277"
+	.ascii	"\222a\215\355\0232\254\261}B\2065\266/\244h\260\034\370\272!"
+	.ascii	"\264\0368M\314\001\235D\0306rmZ\375OD\177\250\331 \217\246\325"
+	.ascii	"\273G)\265\310\306\235?"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.76.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`Y\016\035I"
+	.string	"\032\201\354\033Q0\222\312I\007\332\002\023\211q-w\367:\272W\312x\201\304\215\331\331\365\273\n\210{\242%\327\004\003^\346_>\344\275G\033\023U\246\375\232\275\365S\235%ff;\030N\354\376"
+	.string	"\315\r\262{g\235\270\327\002\276\370\215n\352\356n\215\020\"e\222\001\245\001\205\001\252\001\274f\311[\226\274\275\343\345\035\357\023\370\230#\212X\310F\350$\214\225+yEE\232h\310\356\366\253\371\331\3749\374c~\035\376\035\376\036\3762\3271o\367\373\"\216\334\355-\224\267\355Q\232\026(\273=!\316fO\304\366\202H\201\270\232\375\232\037\3223w\333\017\261\275\233f\322\253\267-\321\rq\3053 \366A\244\261\332z\341Y?\263\377\001\315\246\321\001\273tk>T\201\023\341jof{W?\356\321\013\222\033\362\211\356&_\355d\276v\036\356\303\331\266W\306M\252\207\032q\31031\265\032-\b\200\200\364;H\t\002\032+W"
+	.string	"qoF\bt\330\243\016\330\345B\030\307\n\234\2211\037xQ0\307X\227t\306\343\220>\207\020\202\264\214\025\210\2244s\026Wk\027"
+	.string	"7\227"
+	.ascii	"\335\315E\372\316\273?;Z\3724\021vW\253\nM\230\251\325h\264;"
+	.ascii	"t7\203\376s\336,\317\342\274\271\351\256\0237r\25192*C2q\265"
+	.ascii	"\326\243na\373\245\361\273\303\351{xv~>\250\257\307\333\351"
+	.string	"r\247Y6\247\373\234\322\216\350\005|O\227\363\224<\\\312\037k\212\274\223Sb\341J\330\177\373\254\260\373t\021*\353r\201\321,\367\225DE6$\274\314\315\nM\034y\2417]X\270'\304\313)\251p%\205\357P8\201u%\021\334\231)~\270b \276\254\013\214sC>\205l\276\351\312\322\363\232\302eYW\026\356\237\227V\031Tk=\333y\313+\310\234S\252\265.\023\275\256|Y|\367\025\354np\027\325 99n\266\350z,\212\2477\234\272F\227H\321\036\227\336@\205\256\217D\tTk\315\225o:s\355+Sk\263\273t)\232t\265V\244=\024\217B\310\336\313\315%\302\304t\336\314\365\333\224H\313\342d\377\250\265\2364\316\242>\333yo\3704\316\263\213zy\b\006\347N4!qr:o\236\235\244\004/\262\326j\232}\026\202\314\376\0279f\346\300i\031k\255\345\337^\366\247"
+	.ascii	"\342]\004\024\340\023\313\276\227\226`\003_k\255\275R\316\356"
+	.ascii	"\013\324\226\320\342*\366\207uw\340\334\205 \002>\261\333\327"
+	.ascii	"\306\f\251\325\300=j$ra\312\314\301\302\375\243\231\316\260\316"
+	.ascii	"\373\250\271/\224!\37077B\204\275\227\245\232\200O\234\340\274"
+	.ascii	"\371\246\340\fYD\003\313\342\344\2561\310=\266\373'\223\311\344"
+	.ascii	"\366\226\335\367\360eR\362*)y\235J\336$HP\336#(o\223\021\246"
+	.ascii	"\"(/\221\263\371\016\341\341\025\262\303\033d\207w\351j\276J"
+	.ascii	"%/\220$\244\217\371\376x\332\177t\267\257\021\217\267\210\350"
+	.ascii	":|{|\207/\217\227\371\356@yu\240\2749P^\034(\357\020\312{\003"
+	.ascii	"\345\025B"
+	.string	"y\203P^\033(o\r\224\227\006\312;\303\307+\303\307\033\003\345\205\341\343\005*y_\370x]\374x\177|\274-~\274,|\274>?\336\236\036/\017\312\273\343\343\375\365xQ\224\327\347\343\355\365xy%\357\256\307\253\343\361\346x\274g\031nIaY\220[\300\212\333\343\267\355\2749\244\3154k\301$|@!\213\223\033\244\337\306c\351\227\004[\204\364\2053\224\3375\347R\007\351+\365R\237\210\367\240a-\230\304Z\377zl\377\373\234\271\262g\212\311)6S9\023\026;\347X\314\247d\261\257\257Go\331\353\321l\262\330\3178V\206\307\336\343\356\362\020Qo\361\371\267s\256\374\333\317v$\\l\303\243\357o\337\262\307T\316\346\337~\222U\031\036\373o\347\361\202\265\244_E\016\013\241J\372\365\305\365\242}EX\201L\342\267]-\375\302\301\205\270\233\226\220\232\360\223\224a\016\234V\003k\255@T"
+	.string	"\366\351\026\355\242\337\306'\244a\272Z\263N\\6\201\301\322\024\262\244aag*\226\256\300'n\320\260\201\373\323.\306\230\204\264\213\001_)\fIW~\332"
+	.string	"\026\335\242\017\247\005\356J\273<\315\333\246/0W\n\303\333\270\334\\\256\302VR\262\364K\n\006\314y\223E?\215\022i=\355\323\2073\254\303\323=[D\236!\036\322\274\024\321\322.\345\034\036\371\034g\326\244(\236I\301nA0\341\353\261\335\261a\270\306CZr\0243<\356\222\272Go\001Y\326\342)RR\032\3220i\230\363&\220>\362C^kpE\264\336N#\375z\007\355\037\003\271\242\375"
+	.ascii	"Z\023E4\336\361G\270ySk\335\003\222I'\264j\315\032\362uR\267"
+	.ascii	"\034aY\220\223\333k_\347\350\b\341x\335\353\233\235\316\025\274"
+	.ascii	"\356\r\331\230u\025phv\273\256Jm\330\365\257M\021\310`\0037O"
+	.ascii	"\267\232\362\340\251\204\242@T\223\253(SO\244\236\234\240\240"
+	.ascii	"\236~PPKRONLK\204DY]\235M\236\\QU1UEu\260$\312\252\352\212\n"
+	.ascii	"\212g\201\247(\033D59\243\244\236\252\242:X\242\252\372@\252"
+	.ascii	"g\305@\224\223\251\005\242<\211\252\252\272\202B\027\312\307"
+	.ascii	"\225\223\251\243(\031HMm\200\301\321\223\251''GPUVG>\200\226"
+	.string	"\212\203\250\252\243(TTUG=c\326{\313\362\216u\206G\036%}\222m\r\217\350\337\276C\367\006\f2\253\203\033BY\253\n\007\300\345\300\3115\302\273XO`EqA\221\b\303h\242\216\3212zF\323\350\032\r\324A}\243q\264\016*\260\346\360\211[\326\260\006\nS\210\243&G\353\370\3219\372B\270\241\306Q4\324\307\"\3247\204\372\234\001\214\214\231\025:U\264La\243\203\372+P9\n\313\202W\263\321\271302fElC\r5\214XL\030\032\275C\003\206i\330c\0013\3607\315ysF\357\3200i\031<:\206\016\250\217z\027\213\016V\222O\204\321A\302\006\356\216\006\352\263\235\bl\214ZO\271S\244\215\234:I+\351\022\316\020,\310I\024\340\320\324\352\32492C1AN\036c j)\221t\222n`\2108\303\263#m\324H\232\233\272\251\217t\016\ta\031\220a\330\343"
+	.string	"\\\356\266i\220\275\244S|\270\300/\244\303\021\322\255\255\363f\223\321\0246\2634\236\036\333\335\022?\335\234/m|"
+	.ascii	"\270Ro\235\210\357\334|\251\363c\352\017q\035\234/m>Ez\313\350"
+	.ascii	"J\345N\321\225\332H\177\315M,nq\2124\221f\352&#,\0069\271CzH"
+	.ascii	"\023i\020\002\201\020\250q4\344\224Ch\206DDA\222$\031\0161\005"
+	.ascii	"\004\031)\241;\017\021`%S\216\321H\223\032uZ\003\340\360D\325"
+	.ascii	"q\f4\034&\215\323\223Y\215;\265\321\342\354\247~.\302\311Bw\323"
+	.ascii	"s\364\0215H\254\203!\027v \204A\006\226\033Q\247\321@Fn\361\034"
+	.ascii	"\343\370\222\276\031\357\231\016\351\347\277\002U\204\267\354"
+	.ascii	"\376l\275c \202\375\262\232V^\307}\336<\223W\0017\342\336\260"
+	.ascii	"\353\n\2773\362\267AYbT\207\317$2\215>\266\021\205\035v\211\\"
+	.ascii	"[\003\205qX\214\032\226\\\215oE\025'\022O\032\350\n\344\352\234"
+	.ascii	"\212 \345=\022\226\f\317\033\305\227\363\206\210\323\231\200"
+	.ascii	"\302\n\022\212L\r\331\351\225\017\035"
+	.string	"G\270I\324(AT\344[\306\223\003#\212{\314\021e2\337\0217\377\016\223\222\253\327"
+	.string	"d\362\316#\335"
+	.string	"\177\004\242 "
+	.string	"6\n[\335\324\2621\243\020]D\322\317\t\217\2030\225k\330\fOg\262e\221VT\313\002\t\243\026\366\231^OC\022\275(75\3305\377^Lr\235\242_+\253\341^dO\007r\303\254\t\254\021~\375\237\333\250"
+	.string	"}\323\350\031\2550=H\370;\336B\265\323\033\236\223:\372\245\277%\270/\264C\376\220\344\212\371\203\r67\225,\265\354\214\233c\214\372\245Q\240$/U\266\217\204\222r~\225n\221[<\327\203xa\272\343\364\307\373\305+\332\035\016\325M5\227\243y[\003A76\030\322\334\242uF\246\205\214\235/\271\366\361A\253}\334\310\357\232\016\016\203mh\033\261U\361J\"\\E\034\032\033\013b`\320\217\234\201$]\223\376\300\023\342\256\304\351\320\207\214\214\355\337/\b\350r\343\"\376\224\312\25435\032J\360\007*\322O#\020a\201\030G\301\004\2140\026\352\314\36207\025\244\214\254\260\004\037\340\320\037p`:"
+	.ascii	"\030u7\255\264\005p\3164A\217\202\3541\275\246B\205a$ut\323\210"
+	.ascii	" bLI\037AI\305z\302;\003\217\314z\314\226\304\177"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.77.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`A\002\205\023"
+	.string	"\206\346\202H\340\360&\035\332\216\302E\3440\230\276\r\355\361r\316\337\327\r\327\320j\214\020:BR"
+	.string	"\373\277\316\b\265\266c\330\330\023\b~\261\351\3668\0249\306\030\213"
+	.string	"\231\361\006\202\260\345Py\270\234\233\350_3\321,\331[\312\224\002m"
+	.string	"a"
+	.string	"v"
+	.ascii	"\036\321\335\346\234\337\245Mc\177\217\371A\376\216\263\356\023"
+	.ascii	"g^\302\213\236\020Os\316\222K\023P]\372%\016\024\263u\t"
+	.string	"\"\310l\006z2\330\020\341\230s\202$\027\361.\343\001x\227\353\341\261\307\325\230_\363\230\no\212j\266\234o\f\240\263!\007\210-\214$MN6\017\272\336\330f\252)\2249\247\265f\303\271\345m#\260]\300\326\241\216\231\321\327.\375\031\357Ro\235w\331\332\017}@\317\021\220\006\023K2\335\331\271Pw\307~\234\253cG\265\353\270;D\325\255\250fE\365j\325\237\252?T\355\241j\225\252S\252\366\242Z\256:\252zU\255\252\276\310J\004\217\355\023b\314ia\247c:\311\245\021\307\375\366}\241\017\331\237i\236\013*~n\251Y\310\262\326\013k7hP\241\356\0347d\217d\263\203\245\273\266\312\212\367Z\\\022\335\357\356i>\341\217\216d%\237\307,N\322\327\234\264\256\031\267O[k;x\355\346Z49\315\266\346Q\034vF\273;V\272\r\026\035\234\246\017\354vP\2639e\002Z{\243"
+	.ascii	"B\250\206\213\0253\215\262\221\225Dd\374\304\213`\256\017s\316"
+	.ascii	"\023\242\243\200\340\363\\\006+.,/)\322*&3\257\026P\246\001K"
+	.ascii	"\213\013\003\360\245%\345\005\252\300\304\200&#\206=X\201\001"
+	.ascii	"e`0\030\360\263\355\234\354\253c\020\032\206\nA\177\016\355\002"
+	.ascii	"NK\276\332\033\333\2535\212l\303\270;\266\277u\355?>\217\365"
+	.ascii	"\366c\017\203\346\023\252\326V\360\322\327<~H@M\032\251U\261"
+	.ascii	"6\265\222\210\366$\327\333\323\236d)\276d\335\00231y\227rOn\001"
+	.ascii	"( P\002!s\212\017\320\341\037\205\366\232\355\t\233\231\210a"
+	.ascii	"|\325\303\t\033t\021x\325\021\303\007\361\351\3408\r;N\311\217"
+	.ascii	"\003k/\232B\241\022\201\030\2135\020\270b\220Q\203\347\3434\364"
+	.ascii	"N\317f\b.I/\203\237H\225\026ta>LY\350\031\336)\306\3718\300\316"
+	.ascii	"Zl\330\364\\]\236\026\357\001"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.78.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\272\001\005\017"
+	.string	"\246[cF\360\262&\035 \321\353\023R\265\343\003m\322\023\333\277]b\255\340\232\363\350\247k>\234\373%\272\264\276\255\033\t*\340\335\304\317p\235\343&Sx\214\207\305\005\205%C\211E\233\330t^.\370=4!{\223-S\nO"
+	.string	"K"
+	.string	"O"
+	.ascii	"\0270/m\262s|\225\332\021\0215\031p\\\273\273E\0177}J,\252\311"
+	.ascii	"\317N@\300\360\373\004\020\306\\j1\307\260\003:Z\364\200`@\200"
+	.ascii	"\237\020\245Q$\304\200\221\354\356I\\_B\027\325\354dw\255`\250"
+	.ascii	"\341\316n\233\263\235\300\326\001\001\372\322\264+X\320\203\217"
+	.ascii	"O1\303G\013\025?{\365i\354`\037\333\335u\224\261\257\3723U\253"
+	.ascii	"\252\377\tP3\023\376\245\306.\314\353\307\266\244\213\020\037"
+	.ascii	"\333W\373#nc\272\352\202Av9\344\350\354\256Jl@\273$9h^b\001\234"
+	.ascii	"H\3522\307\301\206\035.\327I_\216\037nP\304\220!\232E;\245\323"
+	.ascii	"\203\306\342g\357\330\320\244\260\337\\\343{l\t?\321\242\355"
+	.ascii	"\256\002\337\304qD\376\314\245G+\322_\231\227\032\013\334P\235"
+	.ascii	"\364u\335\335/\272e>>(\201\003\245=<5,\rB\242\216\001I%\344y"
+	.ascii	"%.\304\234II\324m\244\b)\335\004\b\233J\207\"\3328\217e3\031"
+	.ascii	"\361\210B\310\333H\243\221\267}V\373(c\215\206\214\326)\272\314"
+	.ascii	"\2778\f\236\035\275y\246\253\344:,\026<hX\266\225\200m\004_a"
+	.ascii	"\026\310\306\356.\260Q\256\"$ \320\202\2311\333r\001\363\315"
+	.ascii	"`\003\337\345rPZ\233`P\356\372`\210\345+\210\335\304\235\203"
+	.ascii	"\r5\204NNE{ \316r\310\2126YBQ69\230\341\017\340\200\371\020\026"
+	.ascii	"\r\3571e\203%\326)\202K\032\370u_\255\221\005!\267+\353\001"
+	.text
+	.section	.gnu.lto_shouldInitializeGPSHeading.79.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\335\t"
+	.string	"F\322D= \345*\035G\216\"1%\221\210\t(\210&\226h\270\022\305\f\001\2524J\310\001\"S\251\371\377\317\324c\240\370<^t\016(\001\241\200C\230,i.\002\304\0208e\232\020\"eJ\0012"
+	.string	"1"
+	.string	"4"
+	.string	"\337z\034<\267\n\372\246s\f\254\322\345Ee\\}\271\204\026\313*3\246\270\202\226\216\230\307\256\252\021\245*\260\231sZ\303q\343\356n\273\3016\202\375\007'-m\322\244\373\262\317\3159\247\327e\253\357u8D\325x\2216\247X\336f\255[\021Q\275]\2623VX(\031<\371!\022\300l\031)\2669\311\336\234\026\305\355\353\240g\342\300\032`\013\360\220\260U\333}\371\240\367\205@\201I\251"
+	.string	"\373\262\223\200>\2101H\372\360\235O\362\336}\037\373\3018\003\320\222\261\002\346h.@\236o4!\341\371t>\n\317\003\350\343\210,>\215\201C\025\021\242o\024\n\211\276\f9\277.\177F\302\031M_\362\307>p\203\2253\332\376\344\272\032\266u\003\016"
+	.ascii	"p\b\370T\307\253\303\216\251l\200u\267r\215\004\035\343\303\205"
+	.ascii	"\\f\235\337h\203\345q\315Q\245CQ\253\240"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.80.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\245\007"
+	.string	"\262M36Po\322\001\240\234\206\355\324\240z+\237\241@(\304r\211\2728\205|p\253iM\362\331\263\231\241\023B\316\232\231#\2142\017\255t\215Z\323\245_,\331[\312\224\002\356p@\036+~\034\032\254\007\206\ba)xb\007\223\210\034\002_\021\013X\374\\\027\0263\334\376\255\226R7#\255p\211Q\032\026\221\223\200\006L\273{\300}d\302?\035\232\"\224\327\016\375\320\215R\035\246\002\244F\331\331\234(u\303\376[-\331O\247\006\254\\l'\265\354ft/\233\002S\035\2663;\343\177\034$\263Q\2173\235\n<0,N\\v7n\256\251\016\337\005\252C\345x\366\314\374\207<A\205\324i\233\350\211A\330]\247\266i\334z\003\333&\001\016"
+	.ascii	"2\241\221\037\030b\202\2219\032\023A\305\201\330\fV%,\327p\341"
+	.ascii	"\020#fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto_getQuaternion.81.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`D\001%\013"
+	.string	"\306\223G= \345*\035 \305\001\022\0231\354 \"\202\203\223\007U\241A\327A2\"\003lR\301\276\r\370\0336e\030\031[n\305B\025"
+	.string	"B"
+	.string	"Y\003\301`\207L\200]\3136e\302\b![\246\0243"
+	.string	"2"
+	.string	"6"
+	.string	"\337;\2277\360\336}/\360\336y\264\001\274d\255\346C\303\342%`w\301\311\361\361:\372\027\371"
+	.string	"\231:]\005\030v\327J\2462\356y\333\007\266\023\354\327\002\347vw=W\366]\277\247jN\325S\325\252\352c2\265\213\324U-\273\030\267\001K\353f\036\030\333W\373 \017\031\3572\235`w\005[\331-\025\214\020-\235'\242\303L\324\366\371\022K\031\326\356\336\205\f`\322K\034\373vw\301\0379I\311\357xg\n\223\236|\347\233\274w\237\034\225J\313\205\322\233]\236tn\330\001\243\016)\304\331\263!\201>\340\b\342\341\023\341"
+	.string	"J|: \320#\212\300\215\306\341D\203\b\216\302P\0041\345\236\333\271\362\367\"\243\241f\205\271\311\022~&\343ls\306BOA\231\223\243\212\005\035"
+	.ascii	"2\241+h`\\xQ\001\003\315\001C\200\0340\026\005iE\005\002\264"
+	.ascii	"\001\306\005Y\242 XT\300@s`H\024\344\200\261+H\003A\024\265F"
+	.ascii	"(#2U\203\007\020\\lhVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.82.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\220\001%\r"
+	.string	"\206\030WC\020q\224\016H\315`\211\276\002\304\303\260\232\354\257\250hLl\202\027W\313\254\t\n3\315\007J\002\"A4mL\264HC\260\037g\255\002"
+	.string	""
+	.string	""
+	.string	"\212\340\005\306\273\270&\354|\352t\377\255\344\223M\244L)B"
+	.string	"="
+	.string	"G"
+	.ascii	"\007\321]\345\2251\273,T(v\327\200\013`\217\004.\340"
+	.string	"z\264\036\340ztg\3178h\262\036\017\032$\210\250\261\273\231fx\367\354\374\2078\346K\201</\nv\327\371\245*\334z\333\037\333\b\354\004\005 H*\006\373\326\356\256\265\304\376\311\2779\370g\256\372/\231\276\236\216\231\266\236\326L\347\323\347lZ&\244>\022c\227BxcW\242\n\007\333\327\330'-\007\300\026 \354\321O\373\037\002)&T-U\027\031U\355\260\220\240\244\332\246\227\330\006\230\330\020N\242\203#cw\023\2148\212\207\277\341\321\037\250\374\207\272\036\377\321\3602\3645UW\210\274\360V\267`,\302\256\367\271\350\265sa$\024\351\020\222\241\035\037\"\224\222F'\215#\226J\033gy\024\3620i\331\211\324@+1\310\036h\"S6\342:\262\220\307\033\307\002.;m\033\227i\300\275\265Zb\f\206\215\025OC|\251\255]\205J\212\250\227j\312F\243\002`!YYj;\370\211\036"
+	.string	"2C\303\020\201\341\302\002\343\300\301\300\007\201\215"
+	.ascii	"/0\030\034r\006\016@Q\300\3626 z\261\304\306\252\354\263[\224"
+	.ascii	"9\316,M\265\321\270p\254\303\030`\016d\006\006\001\362\200c\016"
+	.ascii	"\n5\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.83.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`a\001\265\f"
+	.string	"&\027S@"
+	.string	"Q&\0358Bx~\366r\320\2403V\346\370Y#\337\236J\223x3=%\335\212\343\352\366\037\321w\3568\301\360\257\205?\206\377\377\377w\325z8\357\257r\300r\240\240&4\242\311&{\247\024="
+	.string	"="
+	.string	"D"
+	.string	"v\371\261\013\023\221bw%\036\320\275\0068"
+	.string	"\356u{\007\367j\321\216\361\262\264\221\017)\n\254\331\356z\224\303\305O\321?\353\217\221\374|n$\330]\317\221\264p\323\333\026`{b\317-\240Y\263\313\317\244\033\354o\273\273\246$\373\253\277\273\352\347^\376\333S\377\344"
+	.string	"O\242\n\344/\324vE\265\032\033\253\257\016\266\017\261W4$\252\027\006JX\201\356\325\237\366OG\211O\0053 \323fp\231\037M@\246!\026\242\037w\324\016\377RA\343\250\r\341\256\226\013\020\033\2653Gq\342\300\250\005mR{s\023v\321\322\356\"\360I\274\004\3077\275\272\343\231\037=\334+%[\245\f(\f\001\023\336\271\204s\356o\262\271X<\315\002\320\322@\201\347\300B\271x\037&\343M\"\016\037T0\236&\f1\036\244\334oKI\356d\250\030\210\206(sD\b\0174\031\377\307\371+\316\342\363M\256\200 \367\032a\004c\026\037"
+	.ascii	"2C#\020\201q\301\340\330V\re]\340h.\263\230\025\003N\300\274"
+	.ascii	"@0\300]\200\030\\\006\270\353\224$\260*\317\316\204\260\256\261"
+	.ascii	"'f8`\004\344\003\003\003R\200;\2001 \005\270\353\240\260\200"
+	.ascii	"ky!L2"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.84.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\206\001e\017"
+	.string	"v\235hE\360\262h8`\372\3554\362ppU_\037F\214\204(\200\346\226\224=\212\006 \327\227\325ycU\376\013J\2662\2508\026\356\307\2129\207[\207\201'\262w\232J\227\207m\271\311.\275\240\3328\233\354\275\245L)W"
+	.string	"O"
+	.string	"X"
+	.ascii	"#\037}\200\367.\355\224-\362\002\006)\253.\312\300\b\314\334"
+	.ascii	":\334\374\354\212\240\232\270\352\035\247\251\362E\302\325\273"
+	.ascii	"/\3049\216\244\247&d\004C\361\022\205\256Tn\304S\002H\200\320"
+	.ascii	"\205#\201\271\001\3424\317\227\260\225\0312\331]\347+\374p{\267"
+	.ascii	"\375\300v\002\373C\002"
+	.string	"\026W\2511\373:\216\343h\215\261O\273?\247C\237\335\236\323\234\246S\323\027\251\240\002\346!\374\b\333.l\274\355\216\256F\212\323\376\331\323\276\315\001\326\310\272\\t\320\360Y\370\342k.K}\206\372\276\366\255 3A=\273\253\340\235\021|\357\002\352@\307\302e\240\024'FJ\006\301\370\3646\027`\373\361\254\371\360\220P\215Yi\337\340]O\363\217G\013\034\256\004\262\247W\003>\034\200\\z\016\3526dl\323qR\256\343cw\033\270\370\215\212\177\342\235YZ\362\257w~\213\367\316\323\213\007k;?052V\216\016\032 \244OJXJ$p\205\002\n\351\302\004\020\003)B\t<9\251\200%\005l\312 \341\004\256\230L'P$\3565\306\231\237\361\333\n\0219;\352\253<s!\345\364\3056\2476ai\313\334\356n\007 m\024R\376\025R\325\225m\243\345\350\301i\354\305\3630\331\247\031\035"
+	.ascii	"b\b\270\352\034\206&\034D\261\260\253m\330(\265\343\336\020\034"
+	.ascii	"\030\020\020\bJ\202\301\334 \021X\334a\371\370\032H\220\030f"
+	.ascii	"|\331\f\345p\031\001\006vT\217Ie\b\254\222\244\030\005\256\221"
+	.ascii	"\257\304\253jdV0\367"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeTransformVectorEarthToBody.85.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`#\006\215 "
+	.string	"\026<\313H\220XN:\204Hl\260q\343\365;\321\372J}\3751\245\221\020\245q\344iQ"
+	.string	"&"
+	.string	"\013 \324Dl\354\217#w\371q\177fi\007HD\006\220Xp/\332GZ\250\353\241\2449\254\354\277\274Q\207\337\266\021\231\244\224\001\270"
+	.string	"\241"
+	.string	"\276"
+	.string	"\315\232kV\262Y\273Y\337\254\334\254k\200w\303-l\311\274\314\251\"\316\314|#\221\340\330\264]\265]\266]!\333\252\273>vm\177l\233\332"
+	.string	"\331 \303\025\342E\363ff\3742\347\212\340nIv\332^\216\215\006"
+	.ascii	"\265\022=\201\354\321\254\3061J\321\266\307p\323J\354d1y\212"
+	.ascii	"\230\231\215/s\316\250%\365i\267\244Q/\253\256\216\3351\3343"
+	.ascii	"\023>\235y\302\207\n#s\242\001\320\246\335\222\212\266>\271%"
+	.ascii	"w\333\313-\251C\325.\21366}f/R\254\221\231s\006/c\207\313C\335"
+	.ascii	"m[\232b\330\327\262\016\301\234S\271\030\306b\365\253\252I\252"
+	.ascii	"J@5\307#B%,H8\254\333\032\021\002\307\346$nQ\227\310\026\321"
+	.ascii	"\322\255\261\244n\ty\213K\352\ns \272x"
+	.string	"\213\352\224\345\310[\371/U\264/~\f\325\355y1\325M[\255Z\265U\252e[\235\332\263]\001\315*\325\254Q\315\n\325\254O\315\352\324\254M\315\312\324\254K\315\252\324\254I\315\212\324\254G\315j\324\254E\315J\324\254C\315\nlV\241f\rj\326_\263\372\232\025\250Y\177\232\325\247Y{\232\265\327\254<\315\272\323\254:\315\232\323\2548\315\312k\326\233f\265i\326\232f\245i\326]\263\352\002Uf\\)\217?\327\371\324y\210\317\177z\336\273\317\241\026\254\226\2363\024\236\357\274\367'\006<g%dg\304\006;g\266\234\323\\\347?\270\322Xd\265O\314IL\302y\316\267,\003\3438\345\375\3468\037r\260Vx\33706\257\371\315\201\017l\276[\310\316\210\020j\276Rv\327\235\346>.eY\204\245\242;eh\224\260\253a\342\353\226;y\335uk\345qB\356\253\326\377\311\223p\345\221B\277"
+	.string	"\177\377\367Zi\004\253\300\227\"S\265\260mZd7\347,\260\037\341bI\2313\"\307\251N\333\005\306R\\\267}\",r\222eu\265\001\311\033\212\177\351\r\257\3332\021\362\222\254$\001\\WXX]\030r#\326kI\254\210U\253"
+	.ascii	"]ZY\301\020\0322du\300\nz\310\272\240\025\264\342\002\021\f\340"
+	.ascii	"\323\255\017W\\\301\020[[\\A\033\264\271=/\266\313\"\346\215"
+	.ascii	"x0\365\3529a\034X!\273_\3228N\253>\246\f\325\305@\3111u0\037"
+	.ascii	"\033\340\242I\231\026R\177zU\324{.\005\365\334\243\202\016\365"
+	.ascii	"\"\270\362\350\364\247\246/\335\211\351\2747]\b\216\351\2773"
+	.ascii	"\345Q\351\273/)y)\215I':\025\322\223\216\336s\244Cq)\313\214"
+	.ascii	"^\364#c\002#\005EC\377\235\350\272(\245\021x\336\207>$t\340\201"
+	.ascii	"k\3451\350}\241\007\005\375\267V\036}\377\001}w\337spe\031\030"
+	.ascii	"\320{\001v\250qD\305\030#VA)Jq\322\032\300\002\221!\252n\021"
+	.ascii	"01e(\247 eUs#8\260,J\272\244\"\002D\231\200p\r\322t\202bK\177"
+	.ascii	"\232\306w\274p(\252\354\031\022\304\301\237\021\362\203w\004"
+	.ascii	"fDCjN;[M\337\337\334\327/\224\260\025K\023\315G\n!\371 \"\204"
+	.ascii	"U\231\243\246\362\340\365\350\365o\233\222r^\366\002\335dk/\027"
+	.ascii	"\233'\216\004\270\303\256|Z'\030\340\330\350\017f\205v\b\300"
+	.ascii	"NCz\213\025\342\225\247\322:\341\323\341\307\324>\2226/\204?"
+	.ascii	"\024\375\034+\276\034\030\212g:K\240,\240\302?\fR\277u\347$4"
+	.ascii	"\354\356\034\233\225\277\007<L\300\377\243eLKu\276W\335\224\354"
+	.ascii	"q\r\020a\307-\263\356\310\036\367\0138\204X\306}\344\345\250"
+	.ascii	"\320\244\026\306\372\003"
+	.text
+	.section	.gnu.lto_isUpright.86.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`s\001\305\016"
+	.string	"\346\333`D\020\257&\035#V\004\264'\244]\020D\013\323\007\236\025lt\203\366\360\346\373\371\027q\210 \303\365\247\324ZB0\276\027\225oM=9D#"
+	.string	"\n"
+	.string	" Bl\246&*\204\005\211s\322\215{B\310\336R\246\024M"
+	.string	"J"
+	.string	"P"
+	.string	"v\347\3616\212\335\361\001\004(\336\376\271\254h\304\234TB\304\330\3752\335\360\355V\204\232\233\177},\310\360\262\"y\334-\314\302cJB\001\236\204Qj\307\023\301\215\335\275\314\223\202\227\222y}\354\256\223\344U\270\257\333\036\261\315a\377D\313\2517\353\232\032R-F)\303X\346#X6\211I\236tU\200a\244\234\375\211RM\366\341j\311v\032\323\364\005\323P\323\232>\200"
+	.string	"\036\\x\177\201\261\273\262R\255\212\210\303\301\366}\324gN~\362U\027R\304x\264O\002 \266\311\223lc=\252^\3460\206\313Q\265\240XL\370f\300\212\213x\t\217\206\313\356&\030q\022!>\314\243E4\355\316\261\036/\375\314\013t\2409\265\240p\272\\\035\252\351\303\323O\035\304\346\303\330\301'\372\037\3531\225\203\005K\227\253\314\335\366x\230|\264\254\244\201\210\366\200A6\242\201|2O\210$\363 `\020\204\220PV\002\002\205\262\316\327\035\256\226\234\260\343\251\035\317h\340P'\330\306t\243S\221\241b\nkTft\271\302,5\371\317o\227\213Z\362\245\252\372\"\205\202\3465\276\t\" `\202Q\210\224\033\320\b\r\021\031\312\f\225j8\235\216\346X\024\\\004\365\301\316R\245-"
+	.ascii	"l^\254\315\362~6\276o\2355\302CX\t\360X\216\272\305\345\332\360"
+	.ascii	"\374\3412\026\314\346\234`\347\377\266\306\355)\340s` \325\036"
+	.ascii	"C\033\205\033\233\200\313"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.126.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\201\002e\024"
+	.string	"6\247\206I\320\322(\035R\213mJ\245\001\253\270\037\304\214\212\310\001\326o\304\3219\252\354\001\246f\033@=\244\235d\340\242\277_p\324"
+	.string	"^\037\177X\342x8\260\221Sp\336\254\350\006\250\030\023\213\206\021I\254T>\210\020\262\211\224)\005r"
+	.string	"i"
+	.string	"n"
+	.ascii	"7\003\2276\205\227(/\371.\275\017\370.\355\017\331~\361\030f"
+	.ascii	"\347\370\355\3034\021\032\2729\3721\347D]\256\207\303\016~\322"
+	.ascii	"[\ra~\001\035\035\264Z\354 "
+	.string	"\270\202;\313.G\007\255\226\341\237\322j\030.\275\224\035.|\224\354\004\321J\265\n\352\225j3\335\221\232\215\2072\347\274\356\232S\223\251\222<\004W\346\234~\215\355\026\271m\033\333\fl\355\020\033\323\005\362\206\336\334\037;|\356\006\245\372\223j\351\251=O\275\253\326\337\376\217\250-\001\2119w\222\204L\016\362\205\210\347~\373\276\211\033\371:\227l?\3672\312l\236\216,\343\323\302<N\017\241\031;\346\234\247K\037\b\217\273\217{\331\245\222U\177{\275\210\306\273\315\032\217U\355\023\275\004\354E4\026\231\323\007E\2139\003\362\344\373\256\303\343?\371\344~/\016\243%%\212\337\245\334\017\001\3619\347\364L\237\267\327\035\200\317\336\364\355zk\275\261\3114\311\376\212\263pQ\301\300|\227\273\317\331\330\353\2343\266\013\344\323uG\243\0333\rb?\305UX\206\037\302+\307\320\323.}\307\370.u\021\330p"
+	.string	"\261\325h\222C\375\332\024d\3644_w\001'v\032\220f\001\254\226\312\225\022\307\261\265@\214qa)\020c\\\256\326\370\342\" \343@\\\251\032\270X\3428\316\244\0028\2452\263R\241\\/.\252\030\t(\226\252e\205J\2152(\025\023\267&\210#\312\325j\215\250\322\367\007\367\343\354h \325\254\f\\ \233r=,$\270\352\235>\222\353\t\322\323\303\315\261K4\\\373\001\204\023;\"\244\231\367\221\250\035\201EO\003\327\373\261\033\201$\333\230\367)\033j\\\b1 \200\002\231#\335\0063\n\300s\ff\007\342\235>~G\323\220Sr3\227\270F\214\313U\005\307\2611R\300\346c\026\025\r\006^\207\243\330\376\026\003\344\021\270\375\200\262\216\3579\n\177\343#Y\"\200e\020\341\207\241q\360{\003\354\324\330\300\303\361i\263\303\353\245\"g\017\333\222\262\306"
+	.ascii	"\251\275sA\314\301G\217/8\305\351|\213\265\330\t"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.part.0.127.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\276\003\025\027"
+	.string	"\206i\217J\300RN:\"th%3M\245@\341c\341\333x\017}`[\316\351\237\257dp\326\002!\373\001Q\302\035\315\210ml\373\367\274f\246z\217T*!-\225\212 \211\200\356y\001\350v\0204\250\037Q\257\203\334\032\331D\356\224\002v"
+	.string	"t"
+	.string	"|"
+	.ascii	"1L*\335\236\304\343Y\031\254??G\362\225`<\210{\022\317\253\257"
+	.ascii	"~'\304hH\220Z\253\201S\023\210\235\236<\300x:\2372\236\256\217"
+	.ascii	"t\263I\033g\223\247\177\341\026\227\333\217m\267\270\340\234"
+	.ascii	"{\220\310\007\200\321\227\007&\257Z\203\264\323M\361\334w\212"
+	.ascii	"9\177\372\200t\337\013/\002\203\234P\370\200\002\022\361\211"
+	.ascii	"r\021\006Skul\304Mo\033\201\355\003\266\250 \345\034\316\035"
+	.ascii	"\362\212\027\353\n\331\236\226\321i\023:]B\247I.u\223tz\204N"
+	.ascii	"\213\320\351\030\235\206\321\351\221NS:-\322\351\245\323\223"
+	.ascii	"N_E<\n\222\375j\365\031~U\023tJ\305\227~\247_\352k\337\207\022"
+	.ascii	"J\335\036\265\343\031/X\213d|\006\356Q;\257!\352\334\321\302"
+	.ascii	"hX v:\023\2372\232tzjj\232\225'\225\327cE\343K\007\372\001;\343"
+	.ascii	"\255\216\\\222%wD\302\221%wn\365\272d\223\256\310\33245\363\276"
+	.ascii	"\221\235\365\254.\266\"\273X\260\0357\266\260\250\336ogs\035"
+	.ascii	"U\260M\240\005,k\317\201c\334\027q'\335\305\352\255\020\336\""
+	.ascii	"\257\326reW\\\001T=\026\2739\364\334\357\356\200\252\336ow\341"
+	.ascii	"7\250\346\336J\313\276\271\r\013c\265\326\027\277\306\247l~\321"
+	.ascii	"\2517\344\314\373r\306\323\357\021\227\360\353\207\004\f;3<\333"
+	.ascii	"Af\232\206\205\303M\215\246S\301\246\206\201\002-Cm\346\206F"
+	.ascii	"\203\223CcQ\261MC\r\016M\307f\303\241\221\027\353\n\371\302\243"
+	.ascii	"\314?7\312\366\203m\331\032\246\334\235\367\342\356\220m\013"
+	.ascii	"%|@<\325=a\223\265\027\274\213\213\201\311\316\253\037$\256x"
+	.ascii	"\253k\360- ^^\345\212\355\340ZY\020\202\230\\x\225\254\375\340"
+	.ascii	"=,\224e\3618V\004\t11T\276\256r\016\2152I\326\236 3\357+\tI\250"
+	.ascii	"q<\345\214r\002\022\242$A\n\032\r\007\240\002\221\271\252:\021"
+	.ascii	" A\211(\020\252PaK\333\0010\004\353\"\247\266\327\316\206w\264"
+	.ascii	"\232\312U\265\270\347n\252\225\377\001\bt\017f\213O\305\343\355"
+	.ascii	"\013\004u'v\253\350\370P\310\025/Y7\224\361\327j]i\240\234\013"
+	.ascii	"\256+\214\016\312qq\236\031*\267\026\030\373-\347\331\303\270"
+	.ascii	"=\250\030\310\355\221\2606*T\341\333LUf@r=\324\320\212\255Wr"
+	.ascii	"\t\265\034\021\t\211\327!\302\273\304a\267`]\b\214\212d\252\303"
+	.ascii	"\250\325\253\2731\032\177\211A\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`G\007e\032"
+	.string	"f\250\224J\220VN:\002\310\366\0029ll\221<J\034\006:7D\006i\236D"
+	.string	"0\f"
+	.string	"\360\334\2638\361L\022\240[\335]\225 t\216\335\217\255q(\245\224\322\020\013F\233Y\273\373C\316\3723\315\345\"\207\255j`\323H$J\262S~"
+	.string	"\202"
+	.string	"\201"
+	.string	"\327hL\035\364\253\224|\033\3440\300Y\320\327Q*\370\231)c\340\350S\214n\244\350\307\004O\263\311d2\211\240\237\243$\022\232\247\212\001\032:\021\241\376WI\374\223\341\335\204o\013z\223\273\215\301\245\001\365\275\312\237\036\237~X\t\023|\3711\005\370\364\364\263\312 \017\317\331v\276D\347JL\376mzs\236\344\207s4\363\177\356\032\215\267\306\337\277\330\013\273r\357\2757}\260\362?"
+	.ascii	"\243\207;\321g\302\324wb\242\017e\251\037E\251oV\242\277V\354"
+	.ascii	"\007\261\367\336_&\251/\304\222 \232\177\213\250)\251&&\244!"
+	.ascii	"\363O\232JR\232Z\222Z"
+	.string	"\212Bb\202\272\271M]\2148\226)\242_\026\242\377\203A\364\311>\364}x\350\367\350\320\037\343\320\347\261\241\277\243\324\320\027+3\03401\330\230\027j,\364\273\312\n7\024\372\\\345\004\035S\302\216\031aX\032\257\r\b\375\265\004\006\231\017\372\311\326\336\013\345b*\243\306\2440\352K\352\202\252-\001\326\035r\253\307\2724\253\307\347z\255\036\333\324R\t{l\257\216\347*\304c{\245\016\361\370)-\252\307\3421\272Z\0021\336\342\210x\254#\362\370\\-\220\025\025\267!\217\213\306s\307,*K\272\333\351\220\303\035\353V\342\216\217\202N\246\021\236,\325\217\213\352\003a\321/\002\325W[\321\037\362\324G\252\350\037I\321G\202\242/\305\251\377\326\324\001\357\021\006\303\202o\313B[\003\362\260=\366v\330V\331\223\335\240a\365\263a\032\273rm\270\350,\300\347\314\301f8\267j\001\371T\201\254S\201<"
+	.ascii	"\375qN\313\326\3108\203\341\373\361\231\036\307\217O\344\251"
+	.ascii	"\016}l\327,\037+YKeF\362\353[>v2\366Pf:\362P.V\241\354\262\242"
+	.ascii	"\214\"\271Pn9\332\322\254\214m\207\236pj\352\273P\316\251\326"
+	.ascii	"b\335{-\322\332\373\205\262U\003\200\212\2501\030\313\212k\224"
+	.ascii	"$)d\032\003\320\002\241\242q\016\021\220\024(\2211\022\210\204"
+	.ascii	"\022H\205=\017\352\"I\250.\314\330\023\226\201\203{\367g\n4("
+	.ascii	"\210-)\307\016\356\311\214'\305fK\373 g\336;\341hi\2423\r>\263"
+	.ascii	"\375\353e\226\025t\270\361Xr\017\226\206\030\277\277\311?\367"
+	.ascii	"w\272\211\242\257\365\276\244\305DxN{E\216\300\2605\325\021\363"
+	.ascii	"\006k\315\322\024\035g\227\341\243D\367\371\377\337\367\377\276"
+	.ascii	"\317\377\377\276\377\307\377\373L\331v\260\021\220\031\264y\006"
+	.ascii	";\231qg\317\344\001^\213\337\256v\267{7\327\271\273\231\003\302"
+	.ascii	"\312\226\"\260~g\270\267\325'\303\315R@\365\006!'\004\252\005"
+	.ascii	"\331\202V\275\230\313\210\013w\265\244ue&C\001{\371I\234\007"
+	.ascii	"P\332\243!\177,4K\270x\026;b\202hd\2025\265\017w.(\240\364\377"
+	.ascii	"q\363ig\211*"
+	.text
+	.section	.gnu.lto_.refs.4dd87d2d830a21d4,"e",@progbits
+	.string	"(\265/\375`\304\001\245\016"
+	.string	"\306hk>0m\223tXl\243\204Va0\024\344K\215\303\300\300"
+	.string	"5\334#W\272\024\024\024\024\024\024T\354\0203\300AD4<\026\231\265\350\300G\337o\377\361\351\355\377n\303oI\023\333\032![\246U"
+	.string	"_"
+	.string	"Z"
+	.string	"\360=\340cT\376\242\362\240\312w\340o\340k\340c\340[p\212\354+P:\351\t\363\244\362\276\224\270?\246\367\310\336\221}\224\235#\273\250\365\r\327C\355\263\354\031R\307\\\307h\335\302\375\307\365\253\365Jz\212\366\023\367P\352\224\353\257u)\337eo\177\363I!\267b\r\3469\304\376\205\370[\210]\001\202\330\220\330;\340\217\340s\304~\305~\211\335e\362b\276Tw\002\245WB\204\227\027\202\345\373\300\372:\250\276\r,\275\f\254\336\005',}\023\226\277\204\325'a\375#\252\276\210\352\0171\375 >x\350\260\001\376\030\340'\200o"
+	.string	"\376\b|\021\370 \001["
+	.string	"z\025\352\223\354\341\324\247\354\245\2517;\203\372\202u\013\353\025\326+X\227P?Q\237\324\227\032\343-\351;\314'\350\2136\005zg\361\205\177\332k\360\374\031<\236?p=\210'\037yr\r*\017\305\317\210\177\301yP\247\177:\277\341|\206\363\026\347+\234\237l\336U4\217\244\201\314\262@{\n\275\004\277Q&\320\316L^,\007\270]\374\306E\362\211\322\335\353\355\365|\275\257!\322T\354S\354-V@[\362^z\337\336\367\r\342>z\353\364v\366\310\337\325%W\237\256\336\256;\334\322\250;\216\336D=E\275\242nH7@5\272\006\3243\026\r\r"
+	.ascii	"{\020q\270aN\037\013T\321-\304\217\345\310\310t\031e3y.\001+"
+	.ascii	"`\017,{P6\334Ww\006"
+	.text
+	.section	.gnu.lto_.decls.4dd87d2d830a21d4,"e",@progbits
+	.ascii	"(\265/\375`\205K=M\001\232@\312|U \016\251\234th\212\344\343"
+	.ascii	"T\330 \211O\025g\236\204\311\341\023_<\020\273:\351\325\260`"
+	.ascii	"b\025O\324\\\223\3653\032\225\370\177\274\246\342\322n-\352\304"
+	.ascii	"F\366\265\325n\355\031\351\235=\320\267\257\356\241\336\267\026"
+	.ascii	"JX\234\351A\352\346q\250\377\260m\t\331[\356\024\251\006\274"
+	.ascii	"\007\363\0079\330\232\302\334{+\007\337\232\301\267\\\360\225"
+	.ascii	"u\350|]\026\354S\326\rg\255*\303\267b\270&{\340\232\325K\372"
+	.ascii	"\310\034\260\267\256\276}\244w\364\013v,y\0012ru.\314U\265\253"
+	.ascii	"4\177\033\351\257N\322^\215\244\225\324e\037i\"\357\"\335E\242"
+	.ascii	"D\037\351d\333\260J\257\036\225-\272\272\234\225\257w\376\232"
+	.ascii	"\345F[\0011\te\247\2465^9+\3379\216\264\216\266\262\3124\334"
+	.ascii	"\202\0245u9+\177\266\354\300\211\001\335\252\254\033N\242:t\336"
+	.ascii	"N\r\251A\316\252\254\365\275u\302\377\233\253\201t\220\272l!"
+	.ascii	"\355\243\007\233\327\217\336\002r\022\312N[n^d-\244\261z\013"
+	.ascii	"\310I\231\245z[mTb @\370hqrw\205\357[\016\277\331\360\273\013"
+	.ascii	"\356\254\346Q\227_k\255\327\262Jv\237\2232\223\005\351\202\f"
+	.ascii	"\322\367\215\206[\344\234s\375\332\331\313\313\313\313\253_;"
+	.string	"\337g\370M\005\277\241\340\367\021\374\272\272\341|\377\300\215\243\251\352\222\203\256R\006\365\020;K)}\337W\370\225\203\323\346\345U\016\316w\025n\251\236\252\313\f\272\306I\224\270EF\t\372\271\303\344\016\235\276\357$~\315\340\254y5\203\363\375\002\377M\243\243z\252x\265\301\322\267\332i( &\241\234\213\260\325\315h\031u\331QQ\r\243cT8\256\033v\245.\347\f\242\003\210[\005o\013\314\3311\272\251\366\246\266\214e\351\373v\201_\357\264\323\027\257n\241_\364S]6\324_\351\324:oe\316N5\257\233\200\314\234\263\300x5T\273\350& &eN\246\360\362\324F\004\002DQ\314\007\035|\337\031\277\316\301\235\033Y\227\035\232\351u\256\336\271\311\244\314\312\234sP\275\343j\222\352\373z\207Y\220s\355p\326\274\274\332\341|\245\303Bu\303\371\212\006{P7\234\347\0341>Y?\276`\310\341"
+	.ascii	";i9s\202\027\307\312I\323\343I\337\377\025N]\3268\365M\215S\335"
+	.ascii	"T; 'eF\206\3006\303\b^\316\231\b\304\317\030\023\252\265{_\245"
+	.ascii	"\340W'\370\257"
+	.string	"m\356\270\362\224Q\356\376JW\331T;_\232\334T\2225uU\355h\235uA\207\261\333\201\327\327\247\016\235\235U7\234\033\324\241\263\316\215x]3t&\253\224A6\215\313S\235\276\255&\315\020/<\240\372V9\242\266\261$\rM\337\327 \370UM\213\331\b09\262\254\205\245e\341\322U\321\334\260\244}\331\241\366\217\350\362BZ\231\nW\343j\230z\246\232\251c\352[%S\321\324e\025\363W\266\332\346\224s\376\007\177EK;\253Y\266<Is\"\246z9\032\220\2232\277\220\302\fF\030^\316\031\004\021\b\020 j\217:rD8\334W\030\270\225u\303\371\241\016\235\257-\340W'\374\212\304g\001\276\n\360[\340\037\361\213X\250\016\235\207\253\033\316\023\261\207:t\376\025\313Y\377\250S\302\245\357?\240r4 _\316^\346x\345\234_\311\376\021\177-\253d\365\254N9\032\006/r\366\222C"
+	.string	"b\272<%\301\3139\377\257V\352\225\272\254g\265\312\2572g\263\2343\b\020D8\216\0306-\234\367\013\300\027D\311%\316\001?\b\037\343[\207N\017u\303\371W)\037~\344\234i\002\353\373\327(U\331k\302e\313\254oUv\205R\307^\225U\354$J\334\307);\311YY\2257g\246Z5"
+	.string	"\252U\003s\215\b\223\224\363\276\361_\237\374\265Iu\222\201\205\222\221\225\315rVb\bR\342\210\352\321\367\312\272\341\304u\350\264\365h\332\244r\277-!\374\373\310\242\240\205+\216\301\n%\016\377\025\3637\013V\034\212\b*\231\377n\365\314\1771\325\314_\343\316X\t\330\275\235\340\377\tmz\210\351\201\277M`Sh#\320\177\321@\351\201\342\257\247y\237\337t\300O\240\022\361\36375"
+	.string	"\036\312\225\362\327)\255\302\006\377ZF\f#\354\023\210\240\223\317\360_\265\f8\300\"\375\355c\217\376\252\344\257Q\376*\366\267iY\3745\016\007\1775C\377\006a\215p\003A\250\"F\374=\002\013\004A\233 \205\337\212\370\253\234\337oG\020\202\023~\200s\360\263&\260%\250j\216\342\277A\376C\tC\306V\333\201\247y"
+	.string	"\376\353\201\377g#\250Cg\034\374\307\340&T5\337\360\337"
+	.ascii	"\324SL\305\033\374\255\232?\177\355\375]\255\b~\033\002\020\374"
+	.ascii	"V\203\017\374\017\203\246\353\274\251D\326\003\277\355\300\177"
+	.ascii	"\242\377\"\270\334=\370\257\325\307\032\207\212\337\366\244\370"
+	.ascii	"o\305n\340o\376j\307\242\360:{k\302W\034\001\377]\372\253\034"
+	.ascii	"\253\201\277aT\266\373~\363\347o\017\366\204\377P>\366\336o\232"
+	.ascii	"\366&\374\226\001\031\260\030\370o\345g\177\315\263\027\260("
+	.ascii	"Z\005\307\340\007\370m\t\177\035\252D\037\300\177\333\374\375"
+	.ascii	"\346\377\357\354\b\177\327YS\335\336\354\211\2775\270'\376\352"
+	.ascii	"\345\257\\\376\272\366\367\223\377\3677W\360\267\230\277\315"
+	.ascii	"\374]\346\3571\177\277\375\r\3677\231\277\321\374\255\002K\201"
+	.ascii	"\277\255\374\355\366w\2335\361_\3507\325\376\332\303\363\337"
+	.ascii	"\376\227G\0345\377\311\374\017\363\037\315\377\267\377f\376\227"
+	.ascii	"\371/\346\277\333\3771\377\317\274\347\267l\177\275\362\327\264"
+	.ascii	"\277b\371+\232\371[2\277\235\300o\033\360\333\020~K\342\267\036"
+	.ascii	"\3746\001\277\005\361\333\017\277\335\340\267\004\370m\006\277"
+	.ascii	"\345\360[\240\337\372\374\326\374\255\375m\375\333\316\337p\376"
+	.ascii	"N\363w\334\337b\177\023\371{\310\337\306\277{\374}\3657\325\337"
+	.ascii	"\311\277\177\177\023\377\216\372\033\306\337P\177?\375\355\364"
+	.ascii	"7\323\337\371o\026\374\255\202\277\227\376N\377V\372[\370\367"
+	.ascii	"\t\376F\372\033\375\033\3707\t\376\006\301\337\036\370{\305\337"
+	.ascii	"(\374}\302\337\031\370\373\002\177\223\3607\005\376\216\300\337"
+	.ascii	"\017\370[\001\177w\360\267\006\177\013\340o\f\376\356\3607\207"
+	.ascii	"\2773\374\035\364\367\317_\343\3766\377J\200\277\202\371\333"
+	.ascii	"\376\325\355\377\212\277\353_\363\376j\347\277\335\177\271\277"
+	.ascii	"\322\371\253\234\277\306\371\353\233\277\266\371\253\335_\331"
+	.ascii	"\374u\315_\207\376J\364\327\376\253\232\377P\376\237\360W\271"
+	.ascii	"\277\276\375\225\355\257_\376\232\345\277\212\277\232\375\225"
+	.ascii	"\312_C\370+\320\1779\377\361\376\307\371\177\367?\315\377+\377"
+	.ascii	"M\370\037\345\377\330\177'\377\323\377l\3773\310\313\313\313"
+	.ascii	"\373y\224\277\217\327_\302\f5\352\275qg\\\034v\356f\263\3144"
+	.ascii	"Ub\211TW\032\236\017\r\374\0368\370\325\316\235\257\312z\245"
+	.ascii	"~\022%\356\214;U\225\036\220\312L\243.Av\245\201\345\244\262"
+	.ascii	"\203\367\310\341\367\200\301\377\245\261\2744\332Fgd\224L\203"
+	.ascii	"\347\005\262\211\033\274\234\275t\200mT\251B\353\373\236\"\370"
+	.ascii	"\267\205\013\365\373\342\367\305\215\25293\345\252\214\264c@"
+	.ascii	"\0221]ix\271*\371\341\2772~\243\216\026\204\225\321\330\365\275"
+	.ascii	"1\354\334\177_P\035^\225\221\276\027FU\376\3675\025T\021*}\377"
+	.ascii	"\346X\376\373\360\027\227\027J\372\276'\013\377\257\357\377\314"
+	.ascii	"L\311\234\363\224\251\314\311&\237\363\257\257f\255\037\376"
+	.string	"\237j+\001\376\337\234\037\302\003\312\314\344\246N\316\271\272\301G\320\230rx\310&\\\316NZ\310\thI9iQA\221iIa\200\"\323\312H\247\"H\f\311\254\205\204\"\313\031\203\223\023r\204,)(2\246\214\001\212,Ke\027c\244jVj!\263SV\306\220\2352S&\313\222\362"
+	.string	"\345\244%\005E\306$\205\001\212LK*\223ie\241\354\304\224|\341\224\223\0302\231\226]&\313\222\022\202\"\313\222\202\"\323\"R\363^\204yM\261\251\343#L\375\202r\3123\242t0%\205\340\240\224Y9.\347j\366\224\223\031.g\002\344\254#+\031\307DU\323\232\340f4Ya\312\252\312\234s\207\250\246\255\254\354\004\207\254\031\016\nIV\316H\232\220rT\3169\203\200T\302\345 \025\016\331CG\226\361\2243"
+	.ascii	"\2622\347\250\234\2215\303\345\234\2219\347^R\2072g\027\204\240"
+	.ascii	"\274\242\242r\256\"\212\312:\220jO9\267Y\2324)(\262\255\254\021"
+	.ascii	"jS\310\274r\013Jd\205\222\221\225\275r\234V\022\223!\307\262"
+	.ascii	"\214\234sm\203\275\244j\334\365\275.~n<\265\241\365=\317\033"
+	.ascii	"|\233L\267\257(v}\317#\207/\262\003\017\332Y\225T\337\363h\301"
+	.ascii	"6\317\312\321\301\272\321\367<Jl\355\364hl\271\302\n\243C\307"
+	.ascii	"\276\335\354\002*3}y\360\004\371c\203\t\226\264\276\3479\"\307"
+	.ascii	"w\246\315\225\020\374\3338K\033\247\332y\310U\312\214\304`\t"
+	.ascii	"\217\252\016\200\324\224\201M\301z\363\306\276\341\f#\351\243"
+	.ascii	"\322\024\246.'\253:\250f\244\240\211\352{\036\034\370\257\313"
+	.ascii	"\243\3316c^9g!\2374n\256\230\365=O\322\256.\255\235}3\2412\223"
+	.ascii	"\221\0044\031\233\201\177\313fi\331\324;)\021\230\330\361\274"
+	.ascii	"\300\257L\252]S\227vMM\343\203\312\271F\002\232\250u\245\341"
+	.ascii	"\345d\262\203\373\326|\260j\202|\230p`\021\323\367\2762\370\267"
+	.ascii	"i.W\306kIS\3378 sva\372\336\267\005\277\222\301\271\340%\346"
+	.ascii	"h@NB9F\223U\031\213\306\236\251Kk\306\216\261f,\231\223L\016"
+	.ascii	",8AL[D\202\340{_\026|\237\031\276o\n\276\217,\314\233\317\034"
+	.ascii	"\332\026\027\326\215\310:I\002D\255\357}L\332\330\312`0Q\265"
+	.ascii	"e\333j\237\264:O8\300X/Rr\221\030}\275\330-asu_l\027\313\245"
+	.ascii	".\255\027\273v\207J[\251\361\312Yi\275\324)m\365\2004Omx HP\255"
+	.ascii	"\201\301\367>\"\370>\036\370\267Z\262\234i\003\244Gc\261j\026"
+	.ascii	"\315\246\325\245\315b\305\311\031V\332\225\034dV\256\324l\026"
+	.ascii	"[\245\t\2140\020\246T\026\256\027x\356}X\370\276+|_\016|\237"
+	.ascii	"\025\376\355\262\332\365\304\242\254\240\314n\313\210Xy1\322"
+	.ascii	"7\314\226u\223j\267\306\016H\033\036\230-k&Uyv!\201\264M\261"
+	.ascii	"T,\231\225R\227\266\314*o\307l\024\2470[\326N\332\212\316+g\245"
+	.ascii	"-k(\026\n\262wE\rH\033^\316\371'\007\233'7xnO\256\033\316\352"
+	.ascii	"U\207\316\343:,\346\273C\344\205X\337c4\370\225l\313W\255s\245"
+	.ascii	"\325>h\311\315f\277ZM\307\260\3124\013\370\250\252k\266n\353"
+	.ascii	"4[\037\264H\375\230\302\353\261\216\322f@NB9\373\300\362R\336"
+	.ascii	"~\331\"mV\341\314r\256\261\301\032\362\307\024\236%r4;\226\344"
+	.ascii	"\360d&\306\330W\2575\030;\226\304g.\\\250\263_\275\306^\211\360"
+	.ascii	"\224\274\200\217\031\3156\327V\025\216+3!EP\263\3731\205\227"
+	.ascii	"\345\357\261\257\326R\225\025\256*#\3556\3202\366c\n\017\210"
+	.ascii	"}a\354\307\024\236\005\263L\254\227ub\217\330'V\211\r\263M,\022"
+	.ascii	"\233\304vY#vI]\332/\213\365~\322b\275\374{\314~u\225\266R\341"
+	.ascii	"\2522\023\022\004-b~L\341}\331\035\366\007\006MP\231i\353\203"
+	.ascii	"\232\332\217)\274\234\225&\220/\250.\001\334\343/|\374C\210\035"
+	.ascii	"\022\004\0231\243cK\337c)!A\310\230\3458\256\333 \247;\323 \271"
+	.ascii	"\314\3010\254\217\255:8\324\272\372\276\367\006\277.m\017\273"
+	.ascii	"u\005\311\013+Z\267[?\211\022U\351\2231\360\231\323\366f\243"
+	.ascii	"\357\337X\036"
+	.string	"\377}@g\304\320\264\364\375-\217,\240\2501Y+\313b\371\340\304\331i\322\367\2759\374\236\031\253C\315\023\252)}\337\373\202\377[+\353B]\332\034\335\206\310\346h6}'W\227\243\335X\252\nW%\224\235\350\354\324\325)\\\356\334\235\327BY\033s^8\354\r[U\227\226\352\226\252\337\364\035 $\206\234\177\324\361\242\352<\373\004\344\244\314S'\233\034'\f\017D\217\f\037WH|\377\333)[\243.\255\r+%\303&+\\\2252O\001\235e\305\t\303\2636\354\013\033\003\203&\250\022\266\250\251\303Z\204l\tr\336\367\256\340\337&-\215\027hG\320\364\2653xnT\301m\351\373\336\030\266Q\2573\276\\\260\365}\017\f\277.\277\306\3028\335\035\322\206\343I\337\367\216\340\367^\300\357q\341\177`\237l\266M\025\316l\2047\272:\353\302\266P\227\366\311:\221(a\237\032N\333\250pU\017"
+	.ascii	"\303\246\016\250\353H\223'\347}O\007\276K\234\250\270\365\265"
+	.ascii	"L\026\231\177~\350\256\326\220\364}o\n\277\027\003\277\327B\235"
+	.ascii	"\266S\227}\247\351\274fi\272\023)s\266r\247\343\364\034\f\232"
+	.ascii	"\240P\354\230S\227\263r\304\235\206\3236\200\220\312L\243\247"
+	.ascii	"\313+N\030^\316J\"\020 z=\262"
+	.string	"@\021r\336\237m\370\3579-\307\n\352J\035\245\331\245\252\f\221e\343u\033e&\352I\003#\323\365\375\271\206\177^\301?\311\360\317&\370g\027\256k;*Zb`}\177\372\250;\257p\315u\303\371\323\n\377\234\302?c`9\242\240\032WT\240\372\336\204\203\377\201[\303\331\261$\256\002\244\353L\307\325e\243i1dhzL\233\251pf\231\251\306\006q2\035\030^\316J\020D ~\252\340\321\301q^2]&(\006\221\026\206\200\221!\202oV\341\267\016\323SeBL\031o\246\013\374{\207=\250Cg\177\251d\340\314y\321\367\227\fn.\335\245.\333\313o\224\254L\226\263\362\3072\341pC\353\373\372\341\f\372p\376\202\301\277i\370W\n\376P7\234\215\326io\265\306\222[\r\204\254\234\231Z-\250N\316LA\265jP\253\0067l\253\253\312y\177\305\360\357\027n+o\033&\310\027`"
+	.string	"\223\304\352Kb\304\373\354\004\333\302CN\337_!X\204\272\341\244\202\304\005\024$}\177q\224\325eOi)\277=\245\311\352\035\362$\263\304\202S\003<~j\241\361\210\263\002\322\367\314\272\200\251\352g\216\252\363\252\276\2713"
+	.ascii	"\026\230\006`IR\346\324\361\363\252-\257,M\353t\341\264\242\223"
+	.ascii	"\374\211#y\"\273\256F\311UYH;\021\264\314\201\243\004/C\351\370"
+	.ascii	"`\331\240\320n\364=m\374\274\361\373zh\314\260E\351{\016R\360"
+	.ascii	"9\365\263\306\3573s\324P\203\244\3579\210\341\377\224\372}>\\"
+	.ascii	"mow}\317\001\f\237\203\221s\3069\203\206y\026\225\005\256\357"
+	.ascii	"9\b9[8[8e|\261<\352\210\0309c\374\224\321\023\344\f\214*}O\030"
+	.ascii	"\346\r_\326\2312\264\276\347\213\023\212\003\216\323\305\351"
+	.ascii	"\302\244\002\003#\f\257vaS+\353{\016Lg\323\331t\"\205\220B\312"
+	.ascii	"&320\225!NI\342"
+	.string	"\344\345\235H!d\224L\243\232\211\201\005\307'\315\310\013-g\376\211D\243\222F\214\2269<<\323\216\220u\312;\260x\345\\\365\341\247j-\252\252\316M;>\\Zb\270\372\232rL:\226nH]\016:s|B\306P\275\361t\305\221\033\323\367on\020\037go\\\350\373\rY\360\334\234\t\247sU\226\235C\203\021\206\227s\325\207Kg\007J\216\272\233pn\276\351\261\305lc\272\371}\27690ld\372~\303\0316\355\314\273\377\276\363\f\2168>\372\2767\224q\340\313C\322\305\351\373{\321y\241H_s\215\311\246F\034\231\227fC\307"
+	.ascii	"\271\"o>\271,\"_\226f\250\256\244\365\375\006-\374\233i\3144"
+	.ascii	"\327\2513\223P\316[P\322\200\210i\255\365\375\206\032\312\233"
+	.ascii	"UL\245\0317\201\374\325\224\231\212xx\242v\343\240\331x\321\027"
+	.ascii	"M\217\t\315\231/}\277\341\t\233g\346\025\261\271,&\0265j\246"
+	.ascii	"\226\n\3075\001%a\352\032\216i\005\203&\250\022\234\244\251\313"
+	.ascii	"Y\tg\256\231nX\360\352L83-n\214y\3064c\2221\303\230b\3142ui\302"
+	.ascii	"\231[\210L8\023\255\255*\034\327\004\234\310\325\345\254\fr\323"
+	.ascii	"\204\n\225\320=\373\032\f\232\240J\020\243\373\3156\363\255."
+	.ascii	"M73\323\315\344b\262\365\\\271C\263\245\003\210\237\2732q9\316"
+	.ascii	"\373\233l&\030+J m\372\232_zUTl.\372^\303\031\374\233]\352\322"
+	.ascii	"\364\202\337\200\251\321Y\363\337\327\323E\310\026\031|\rn\370"
+	.ascii	"\032\322\314,\330L\335\325[\337k\250\202\257a\n\276\006(\370"
+	.ascii	"\032\302\3605$\301\277y\305\n\031\0307oV\332\206\233\214\246"
+	.ascii	"\276\327\360\205M*\3462(,\355\307Y\337\233f\377}'\b\ts\326\367"
+	.ascii	"Ni\266.\257\250\2767\313\200\342\212,\307\372\336$;\313sc\325"
+	.ascii	"\327\224\202\2374lq\300s\205\005+\307\330M)\277\351eFa!\317N"
+	.ascii	"\234\276\217\253\033\316Z7\342\346X\317\033\227:(}\257!iv\335"
+	.ascii	"|bv\231b\0362WU\236J\300\023;\035\035\330/fb\300\351\253t\302"
+	.ascii	"\362\262\224\323\327db61\235\374>\237\026\031dt\364\275\006("
+	.ascii	"|3\354\277\217\207k\f\221$}\273~\3554\227\334\004\373}='I\247"
+	.ascii	"e\337kh\3027\223\230J~\237\265\323\246\345E\337\017\321\3017"
+	.ascii	"\221\374\367\265@\r\017&}\315#\370ih\216\003_\232(k\206|\335"
+	.ascii	"<\362\233F:G\253\231@F\216*6}\201\352\320iz\215\270\371\325]"
+	.ascii	"fll}\177\352\320\371\241,\330$b\022\311]vD!\355\372~\310\354"
+	.ascii	"\307\017s\310\251e\254+\r\f\177\275\261\303\022rsHmbf\356G\220"
+	.ascii	"\336\023\222\032eA\270L\0330\334\320\210\263d\346\276t\001\261"
+	.ascii	"c\254\344\231\251\253\302\3022{\210\371\224\3312\226d\353f\017"
+	.ascii	"\313\206\345\315\233\276\246\326\321\300\344\264\354\3645yd\r"
+	.ascii	"\2710\255L+\363\352\001G\206x\335\246\032n\270L\0357\257\362"
+	.ascii	"\346\324\234\3645s\034\315\034\363\2416\246\257\351B\233\251"
+	.ascii	"O\231T\235\263S\366\352y9\342B]\256\252\372\340se\311]\022\307"
+	.ascii	"M\252\013\307E\324\013}\377\306\274\361S'\013\207\032\363\206"
+	.ascii	"i\343\344\341\"\211\030\353\306\223\305\34401k<\203\031\223\206"
+	.ascii	"I\303L\372\342\234_j8\313\234\026/f\362hUC\222}\237a\r\337\214"
+	.ascii	"Q\315\250(;g\002\310$\236\"\305I]Nz\351 h\016O\313\262\3573T"
+	.ascii	"\301\257v\316\371\016\252\t\003\306\327<d\263\nl=\341q\261\344"
+	.ascii	"\212G\337g\020\303\277\teBY\266\233\233\240r\226\332`\211T\263"
+	.ascii	"1\302\345\313\222\247'7\036A\\\320\310\330\350\373\fX\370U\254"
+	.ascii	"\232N\246SUvF*3\r\rK\304x\351\300G\t\032<;}\237a\206\311d2]"
+	.string	"\036_\244|r\244t\310\351\373\fO\3707\263\231\217v\205r\214\246*^y\370\267N\275w\356|a\250\243C\347:\341\f#\3431[kz\240X\341\222\354{\fa\340\300\271r\210\326z`\306\250\320\341\375\312\211\243\303C\255\357\215\323V@WK\260\0336\266\340\314\241\365=\206,w\327\315\335\025\323\246\r\2241\323K\310\232\260\276\307p\004\037C\024\335\255\243\273[\316\234\2532\213F2W%?\260as\267\3009\251\276l\220*-\240\365\275\020\035|\2411ss_\253IL\245iY\207\206\377\233fy\323\034\255\204\354bL\004&H!'h\320\334\270\013\345\234\325\224\363\016\035g\215\257\270\257\335$i\236|\365\275P\016\374_3\257\313k\346>y\310UQ2\262\207\366\005\244\355'\216nlL\337\013Q\205\031s\311T\345\004\232r\336\301ub\361\020\212\001\007w\305\324\234|sb!\253>"
+	.ascii	"\361HN\265\365\025\343\373:\262%\243\357\203\352\360\203\306"
+	.ascii	"\340\377\262\275./\333u\003*C\243\0223\325\204\310\271\350{\333"
+	.ascii	"\256\230\215'\261\276\017J\303\017Z\342\377~\371\3226<\344\252"
+	.ascii	",\344\235\007(_<mo\326\270\365}\220\030\376/\227\265\333\305"
+	.ascii	"\316ad\022\237u\301\250\013\342\302\017Jf\311r\267\224\260Cj"
+	.ascii	"\371\335B\007\344d\255NN\337\277)Z\023\202\327\367@w7\355uy\323"
+	.ascii	".\223\207\314\225\363\324\003\236|\365\344\362\013a\372\036H"
+	.ascii	"\016\377\027K]^,m\345!se11m\260\304.)'\031\326\367@_\254X\271"
+	.ascii	"<J\344P\003\"\303\277T\352]V\231\003\206\017$DJ\275eS\216\346"
+	.ascii	"a\007>P\362B\251w\354\311\215"
+	.string	"r\264\233\315\262\213(\037\354\244\200\234\360\177\340\340.@u\213\363BN\354\212\331;\235\235\242d\344\003\336f\030\301\313\271\252\003\237.LP3\356\272\272\256\2230c]ixM~\235t\220\246'p}o\330\0242U\234\372^&=:7gQ\372^0\263\n\013\f\253\276w\311\321\356]U\0228}\257\022\245+h\316\372\336$G\263E\206\244\275\350{\221\034\rG\226\233\270\276\367\310\223$7\236\372^#U\211\346f\316F\337\373U\225>o;z\210\351{\275\216\026\204e,n\b\332\177_M\202\205\311\033&B\244*\2112\262\215\207&R?f[\337\272Cp\316\3115\036]i`W\310\357\020\2362J~\334\351{\177\334 slg\224\364\375o\220\313\305s\006\007OK\225\0132\203\205\216\255\357\005r}X\262\033nW}o\017\337X\030\253&\335\344\345\346\005d\337\377\274\220\225uy\200"
+	.string	"E\355\362\2403\307 )R\245\357\177j\340\377\356X\336\0357[\250\314\264\225"
+	.string	"&j\271\203\3770\341\034:\252\362\346\252\214\274\323`\311WW\032\236\032|\237,UVv\316\203\223Pv\032\022\346\365\004\337\347\007\376\rKH\251\360\207\226PDS4\211XDQ\034\223\202\035\322\242_*DG@\223\202iO"
+	.string	"\226\204J\301Tx4\3018\374\005\215~)\210+\214(Z<B\215\204RT\305"
+	.string	"\226\220R\341\017-\301\210B\250w\244\020E\264E0I\304\3210\350\001#\264E\220\004c\260\347H!\210\305\245#bq\351\b"
+	.string	"\302c\322\021\b4\221\242\026"
+	.string	"\002\177\035~=$\206\277\364\347\303\"\035\006\213B\241\360\0074\246\301\024D\034\207G\nhq\034\006\205\n"
+	.ascii	"!\204\242\020Dh!\0025:\n\201\303\240\210\242\361(B\304\n\304"
+	.ascii	"\"RJ\034\366X\374P"
+	.string	"\341M\215C\"\320d\221\026S`4\323b\nT\2500\f\366\320\024ER\221x\302\220\221\b\344iA,*)\375\212\206A#O\007\243\021\005\002\177'\t>\020\301\210\022\230\304\025\004XR\"\236"
+	.string	"J\217\024\342HI\304\221\322\020px$\241g\310\242Mc\321\221\222OZ4<R2\207GJ\026)=\032\242\302\023e!h\274KJD\340-\246J\366?K\305\324\030<BS\024e0B{F\250\361x\215\275\377\322\237Q\212\032\321b\321\221R\b\240\"4\375\t\225\222\320\025GJ\035R\244\243`Q\211\003\306\240o\311\210H\001\342\n\244\264\370\253@\007\222\212D\026\306\341\257\270\342w\334@\006\020\240\220\"EU\034\223\202\030R\364\350'\025\006W\030\211'R\364((\351\250\002M\n\256"
+	.string	"\002\177<\351\360H<\321\223tT\001\004\376\316\244\243\n\023\307\244\340\005F\016\f\177@\24148DqL\n\366\200\300_\021\220\305\031\002#P\022\232\032\227T\024\t\241\305\243\217"
+	.string	"RTE\212\032Y\260\320@\t\307\244\240\0010x\020\"-\376\224B\020\241G\341\257\003\250\360\007T\221f(\026\211'Pa\232\022\213H+\200\036\200\300\237\3559\032\006\215~h\t*P\260"
+	.string	"\n#\341\221\210d\004\200\007!\214P\026\202\302_0\r\016\203?\351\231\376R#\317\006\021B\240I\301\025\0340\001\205\361H\f\252\200\026\225.H\n\246\306\n\240\351Ox\314"
+	.string	"\243FD\023\202\216IA\r,\214\b\301\302\022\211\020K=\037\204hA\001\022\204\277\342\021\232\016\203?G\277${T\221\242\004\023KC\"\322\317\204cRp\310\bE2\006\205)\374Rc\005\214(@\200B\212$b\221\204\r\004 \005\232\036\225\222\210\204@\ba\204\246\250P)\211x\202HC\211\0245\242)8p\b!\204\321\260\002hRp\205\0211XDQH\321\340q\003\304\342\322\021\221\317\002B\240\351/U\221T4\221\032\177B\240#\205"
+	.string	"\026\025E"
+	.string	"\007`<\372\tI8\032\006\223\212\277\236a\360g\001%\f"
+	.ascii	"\205\277\023\307\244\340\317\201\301\":D\217\360A\bA\001!\210"
+	.ascii	"\320\242w\021\032\340A\003<8/B\003F\214h@\b#\360C\030a\323\264"
+	.ascii	"\310\210\n\217\206&\212\250\360X\001\324\350\230\006\323\364"
+	.ascii	"\267!MS\324\310\202\005\361L\213H|\200\036\375\212\250\n&\200"
+	.ascii	"\300\037\017\212\026Y\030\375P$\234\376\210B\026f\nj\3723\241"
+	.ascii	"x\017D!\005\235\026\0319\200&\005S\314\0025**J\203BP\213\224"
+	.ascii	"X\370>PAPy\216I\301\036Tx4\374\025\t\205\277$c\317\n\265E]\252"
+	.ascii	",\324#\205(\242B\024\b\374\021\300X\004\004\376\314\364H!\f\220"
+	.ascii	"\016\321\244  Z,\342I\203C\024C\022\322\3400x\026S\024\200\303"
+	.ascii	"#\tF?4\005\020hB\203\261H\005t\004 \360\207\207$\030\375\320"
+	.ascii	"\342\231\032\213\202J*X\240#\240JK+\212P\240\240\242\007\005"
+	.ascii	"\016\177\251q\030\304i\221\006P\334a\020\205\241\021x\006\225"
+	.ascii	"\214\326Xt\202\004\212\236\023$P\370N \211\240=R\b"
+	.string	"\3431\205\016\306\"\023\214\204\212hj\374%\235F#Z42\372\365P\025~B\025G\245$|,R\00152\036S\300\306\"\024\030T\001\035\301xL\241\007-B\225\226V\030\217)\370P\245\245\324xL\241g<\246`-0\242\b\b\374\235+\374R\234\030\301\304\231\036)\304Q)\251\210X\\:\002\002\177\"\214ET\205`\321\b\001hQ\n\017Jx\020\302Q)i\310\210\026y\214E\032\320\"\025G\245\244\2363\025\036\215h\212!1\230\002\321\024\035\341\250\224\224\001-\032\036\005\205\277\"\240\341QPh\002\b\374\341%\243\037\232\342\227\376\214|E#\213\"\244\243 R\021\020\370\363)\376\220\200\0275\"\236\030\022\203\306\240\nh\321\247\210\n\205A\026gz\244\020F\244\364\227\004\200\244j,*Rb1\324\"XL\177&\244\304\"\220\n\250\221e\241\0044\375\245@\205JI?\243\317\211\021L"
+	.string	"\201\277\023\005\0165\220\032\177h\006R\023Fh\3723R\342\200\020\005\002M\030\203\035\214E\277\3647\302\220\030L\217B\242\n\243\322\021\206\364H!\214JG\"\210A\rI'R\341\3174\026\r\211\301\364\007$f\300\250t\364\223\376\2046-\"\361A:\f\366\206D\241E\022\n\255\321\007F(\252d\354\031\241\250\222\212\036\324X<\022O\030\r\217\304\342\221\317\021+\021\215\220nZ$B:\f\036{\351OE\322qx\256\360+Z\241\220X\274H\3004\250d\246E!\214H\207\301\336\n\277%kD\217\302\237\n\347\221B\030\215?\245$\"P\204\261H4\016Qc\006\306\242\243_\222yb\004\023G\277\244\323\230\002\217F\304\"\nCbpXD\323\3371\005\031\216\024\242HL\201\250\n\"\206\304\244$\"0"
+	.string	",\260\320+\254\320-V\350\245\025\232\205\025\272E\213^j\321,\264\350\245\245fa\251\217Dt\242\022Z\024\221\022\211E\021=\306\242\243 \213!\361\004\232\024L\207\307\024\307\244`\206\217\030q\302\003\007N\260"
+	.ascii	"\006\2068&\005E\244HGA!\013\021\303\340/I\004\260h\024\021\342"
+	.ascii	"\202\240\022\n\212\222\200F\247\220H\244@\221\371\377\\s*\371"
+	.ascii	"\351\242\202\025f..h\253\310\02345\247\322\347\214\220\274\267"
+	.ascii	"4[\316;wejr\327\tO\227\"sc\342\242\202\2128}\031A\363D\005\252"
+	.ascii	"\215\2223'W\257\214\013\n\226\231;\304\254\362\341\204\246\214"
+	.ascii	"\333\025\024\325\220\276\257\313\223\314\025C\201;\031>\306x"
+	.ascii	"\305e\371\220\321\367\204;\341N._N\216\370\342\321\201\352|S"
+	.ascii	"\222\345\234\203zZJ\264\246\372\276C\f\374\237nv\256\247-J\035"
+	.ascii	".m\227\t\004\336\217(m\026\t\025\2603`\316\253\336\024<,S_N\255"
+	.ascii	"#L`y\247\227\266\242rA\347\254\357\271vr\371\331\345g\227>\273"
+	.ascii	"\330\274\274\363I\031"
+	.string	"*\347\026\223J\312N\0317-\247\f!Qp\230(\335\310u\005Q\263w\254\222*O\356\322\354\034\274\244\203\213\201vy\334\245\025\327\026\226\023\311\263\314\263\233\273r\206y\241\303\353\253tB\203\306\220\254\263\\\341\304\270@\244\257\262'm\307\322F\337s\3129\3454\263\023A\213\235\215\017\377I\345\247\031Z\317\227/hD\332\n\312\221\252\037}O\304\006\377g\031\234\276#\304\316\0322\323N\357\312\206\2131)\327II\021*\251(\246\330\024,e\356\372:qr*\275\300\bk&e^\3048\241\374T\322\221\271C\"\325\367\0243\351\240\221\213\023\326\367|b\322\331\241\004\322F\324v\202\235`g\030\031\267\236\034\245-\217\311\317\260\033k\256\236\210\316\220 9\225\020=1\222\367v\275\276\256\362\222\374T\322t\340TI\362\265{C\255\211\333\020#F\004\2207\303\b\030\026\034o\310\\(R\344\364\332"
+	.ascii	"\262\211\0330\240\272\030k\272t\375\364zS\006'6\347\215F\235"
+	.ascii	"9}O4\365\302\013W\f\004\356\362\336\300z>\234\300\342\364\375"
+	.ascii	"\005jN!\247\220\223k\005\246;i`<U\230\260\225\365\375\005I\316"
+	.ascii	"\037\347\217\223K\303\022) mS\310\232b\234@~r\375\250\211\n\322"
+	.ascii	"uA\216\036=f\364\310u\211\021\245\357/\240\201\205ujE\371\222"
+	.ascii	"h}9\235\001"
+	.string	"\204\373\250\243\221\223ZD4\214A$\n\032\304\224R44\333\026\003#\025@ HP\032\222\016\027N>\023"
+	.string	"C\f\r\205\201\236'\231S3#\222$I\241\315\363U\373\003\227\320\025,\240\355~(%(\214R7h3\323xX\021\324\374\017\031]o\022F\233\355\306:\212\203\205t\316\211\312\220\030^\252\t\030d)\234\200\342\037z\226`L\220-6\233NMb^\235\212\340\200v\376$\f{'\033\034\260\362\365\273\274\345\"A\270:\272\355+TM_<1\250vK\251Lx\006+&5\3314\322_\007z\330\310\316\2456S(\211\260\331\355\364x\373\247\225\311Pr\272WJ\277\220\214\351\245R\324?\230\317V\tM\254\264\237\016\217\254\333^\275\234\363\2639\ti\347\206\244\0269p\243\364\254\250S\241\215\005\362y\207@\2209\035\227\035\277G\266%\324\305#\020\205\235\333\352\004\244\303eq;\027\253\376\366g\023\020w444\232t@?C\315~<\252"
+	.string	"\210\220)1.\266\351\232]d;9\377\200\bY\374CT<\"M\353\303\357\311\253XeR\262\036#\263\356\n\232F\021`\004\177\375\314\020s\364\350\374AP;T'\005}\004\363\005>\023\364\356\345(X]Ha\367O\343\333\365=\f\017\317\277\236\373\242\2242\373\305\2641\314\307\2129\323hm\017\321\030)\333\246\2202*!\311y \225T3\274\033r\1771\333D\325\257\353\313\216F\317\024\343ke\224\300\177%\351\021\245\301\307\221\320c\344\257\0079\331qkv\246c)m\004\027Hy\253\272\370\004\321h\263E\013\003w:9\306g\323F\016\333~\302M\304\224\305#\337)J\310\216\032f\0333Y4\314\034\321} \324\333}}WR\230^\030\235\322\241T`:^4\251\246i\237\304\356\351\336\203\206"
+	.string	"0\004A\203\267\377\345\350"
+	.ascii	"\200\246m ;8\200\f!\254\253\242\002&\0139&m=\233\230\212\304"
+	.ascii	"\321~'u\223\013+_dk\004\350\275\335\2443\237\231R\310\223\003"
+	.ascii	"[\002H\365\337\251\347u\272\372\335\225\302PSO\220\255>\213\302"
+	.ascii	"\006szu>\300\373x\007C2bj\222\316\375\362e \005X\"c\204\275\002"
+	.ascii	"\224q\346\253.\221\352\3000I\303KIn\225\325\n*\364\025\256\024"
+	.ascii	"GY\022\315\205#R \203\017\204\210f\312^\274DW/Q\023(\230\253"
+	.ascii	"9\374cm\331\365Q>iIC\245~\375?\325\307\250\230\301Y\032\016\037"
+	.ascii	"M\022\246\313\267\272!xQ*\233Gm9\246\340V\227\247\376W\r\372"
+	.ascii	"\211P\226\263\304\314\250"
+	.string	"\346N\312\360T\3333\267\352\244\240\374\362\225\211\205\f\302>\364\256\201\034\225\365yh\036\200\021K\002S\004\365\177\304\322\327\367\243W{\035\305\200IY\253\227Hn\026\036\001\276$~\340\233G\031|\311\013\r\257\265\352]\241~\370\026h\304\303\272\211#pe'\314\241y=BA\330v\224\220R\211 -\333\311\332%\343[\316\247m\334\372H\004?\271g\254\311}H\271u\027\325\227\f\372\311S\276'K\305\340\314\235=\252\373\006\350\023\271DV7H\364\027\373j\372\254\020\bj\372\236\005\n5\256\026j\022$\347s-J\332V\215 \221\03630\217<\036\027\300\3639\241\243I\341N\023v1\217\242\307xN\037\364n\336\345\246\013\253\017\315*}Z\362\344#U\2071\036\365\371P'*\374q\303\226e\231T\207\322\246\202\340RNIlR\352\260\275\2476nY`o\337\206\242\345\314\334\336\033\223Y"
+	.string	"\360]\313\275\366\277'~\257\036\024R\360\275\250a?\301\t\3619\203\b\261\004p?\300\263\020;w^\326\215b\213\242\177\345}\016\003\233\305\274I\353*\252x&Jr\321\370\326=a,\r\217Q\007\r\030h\317\304\027\345\017Wsc\230fO\203\016\273\314/U\301}\342C\363QJ\202g\315\355\035\324^\342>\261\0320\n\364\301\037\307U\336g&\026\300"
+	.string	"?\001\334\272d\0011"
+	.ascii	"\2755\3468\001\357\307\266\365\315\204n\310\033\307\030\251\371"
+	.ascii	"\327\013a\334[\222\001\302|g\251\2200\343\0074\004\361\275\362"
+	.ascii	"*h\222l:\031\337]\023[Z\036\262\301\265\020\032\263;!\\\331\265"
+	.ascii	"\030\206\231P\230\324!\211Z@\324\t\361\3735G\005\322\0160\350"
+	.string	"l\355{6\343e\341\342\003\221N\r\225(*<-x\263\353v\364]WR\025\221\241F\225\216\204\340\021\236\200m?\321\003\256D\\\200\235\217\214!\267\335\244\177\020K\203\027\333#\377\350\270\034\300\267\241\340\331\353 f\305 \274\266\346\374\210TJ\300\314\355\305'\215]Fk\"\372GLzE\2071\326\2245:f\037\274\260+\260\271\030\227\001\035\366\032\214\034\306\206\fdM\326\377fU\271!z\t/\374\033\313\204\341Ne\374\242@\233\247\226H82\322F\224\324\375nA\337'<\264\265;\bp\204+\016\020U\007$\bn\251\002>\227\315v@H\003\337\\\276\273\2746d\017\030B\254\207R\020H\021s\233I\3339\305\370H\3165\203hV7:\030l\352\204\270\233\343\224\303\370\302-/\265;\300K\243U\tNZ\b\341\225't\317\217&a\273\205\034\033\257\245$\256\260h7\254\272\324\247\324"
+	.ascii	"\177\206r@@\350\022&\215\\\t\037\251*\037\254J\317Z\220xU\024"
+	.ascii	"\"\362\333[p\017\224Em\022\021W&<6d\362\371\030B\017\205X\006"
+	.ascii	"`\177\370\212Rq\262BFt}>,(8\254\343\360\346\367`\025\270It\251"
+	.ascii	"'-e5\254Y'\223\307l\224\246\254\017\236\267*g`\327\217\217\263"
+	.ascii	"\356\216\234\031.\037K\363r\007;\262A\276\217|\200\323\037\201"
+	.ascii	"h\354\370\210\002\201x\325\240x\302\001\357\027\374\225\223\316"
+	.ascii	"\331\344w\017\213\357\025\223\217\340\305EL^\230\310%\033\266"
+	.ascii	"\006\241\211\236\007\257\265\353p\243\234\207K\234\321\341\366"
+	.ascii	"]\357\266\235\231"
+	.string	"`\254A\364\275!\"\030\034Uz\013\313 \215+lA\303\3367]\034da\264\240\353\350\343\252~\n\364\353)$\230\277\203\033\247\264vH\344\203\301FNk\335\\\004\357Y\n{\244-'\235\255\030\207\2171\241ZJGv\217\313)\244\022S\214\323M\303\002\206\367\253\221\376tPz\307\301TZ\364\036y\2678\200+\321\340\021@\217\233B\214.\205\r\024\260\033\267\244\351*\201\265ri\016\340\302\202\313\317\2143I\265\005\201\207\253hI\344\371~\035\021\346\210\370\267@f\263\257\246J\250\256.35\213\217f\340(e\307\327|:s\354\031C3T\351\355o\r\307\2271\\\215\3706\223\363\311\254tl\243%R\021@\303\371om\334\333M`L\335\376d@[}\2728j\265\354\371u\353\023\t\244\375(\022:\205 \244\202\033\204\\7_\365\"#\221\336,1_\275\036cz\022p,8I\027w"
+	.string	"\231reQ\251\331A\342\b\0251\350\262\333C\37265\204\336\021 \222\360\220\341\032\355\215;XAi\255H\251u2O\036Kn\t]@L[\025\240@L\246\007\375t\260"
+	.ascii	"T\377\345\256\n\261>\344\2732\2044\324\261J\273\334\317f&2\365"
+	.ascii	"B\323\325C\024\023\231\264\251\324A\236\326\375Y\022\276%X\235"
+	.ascii	"<\b\023(^\364\332Ar\270\335\032\025\302\344m\f8\260D8s*\037\255"
+	.ascii	"\342J\327\341\036\313G\016\373N\003\004G\366\214\rN\t\032=d"
+	.string	"\3403j\004\317\0273\021\366a\020b\320\364\333\331C\353\204\252U\347 \276C\312\003E\234\216\037\317\232&\342\030/\223\003\217\362\230\n&\021(\215\303`\305\223\336\311\344\272\325]\376\254\233\276\300\354\n\260\266\004{O\240S$G\221\200'\006V\032\330\245(\232\250\255@\320"
+	.string	"\252\256\347\255\211*\340\340\217\257\354\247\0368\345T;\233#\216\321\210\365\207\002-P\237\t\001\026\022f\016A\363\342~"
+	.string	"\230\335\"l"
+	.string	"\226\237\003~\213\005B\266\210\274\007K\2301\313\005\213G\264\322`\241\002\247\247\331"
+	.ascii	"F\225\277\017\"\252=(\306\"?*B\317\340q\225p\003\326\330X$\377"
+	.ascii	"\3706\333\n\234\327\\?0\303P\346\237\241\264\261\026\320\343"
+	.ascii	"\363\335H|\n\242^?\302\314\341\3053\335:\336\347G\031+\214Ia"
+	.ascii	"\3500S<S\001H9\366\021Z#^\206I\331?\302\227\221_\021\252\307"
+	.ascii	"\206t\323j\335\275\360\240\2729*o\303,\002\371\035V\2375i\221"
+	.ascii	"\337\337\352\260;Q\2719\350\017\304\357\350N\267*vz\354\373\311"
+	.ascii	"\333l\232\201\261\207\333y\f\311\335\373\336^\365\335^\017\362"
+	.ascii	"\372\221\363\246\341zs\027\316\327.\270\261\3755\236\035\260"
+	.ascii	"~~G\016\336'\007\276\333\344\027\221u\303\r\315\377\237U\335"
+	.ascii	"\241\240]vD\313\250^\367i;\373<\367\225\223\327\\s\275\357*\304"
+	.ascii	"7\002\326S\252\275T\215\021~\235\354O\367W\225\177\265\340\231"
+	.ascii	"\2354\004\332\023\264o\3666\234\306\246Jo\241\270W =\220M"
+	.string	"N\273$}\372\231\305W\031\344:\321\203\225\234U\364\252F\027h\300Lm\331\305<^8\021:\350\302\225O\237\255P\016\244<\r\222c\262\327\214\375\3021\024\330\225m\252A?\312V\365\002un\272\r.\363\367@{\314\217<\301\370i\tc\210\237\3020\315\377-\211\353\254\347\027\363g\330ob\372\242)\273\264\355\256\314W&y\206\311N\346\310\344\345,\210'\241\035\206\314\t\330|m\373\224\361\035\336m\\\267\363\376\362qL\357X\272\232\3746\260L\211\236C\212C\346\313(\357o\271SJM\365\360Rkc\350\"\352\377\b\366\270\363i~OD\375$\367W\322\037\n\177\020\332\343\252\256!\343\fz\356\324\275\302j>\347k!\247R}\034\037\272|L\033u\342\226\364\034\303E\230?O\373\323G\1772o\342\267\301\274\323\355JK\360Q\211\036,8\260\352g1\3023\0359\323\340\362\306\317\305\357"
+	.ascii	"Nu\005"
+	.text
+	.section	.gnu.lto_.symtab.4dd87d2d830a21d4,"e",@progbits
+	.string	"headfree"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"accAverage"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"offset"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"canUseGPSHeading"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"shouldInitializeGPSHeading"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"getQuaternion"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"isUpright"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"quaternionProductsToRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"quaternionComputeProducts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"quaternionNormalize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"quaternionIntegrate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"invSqrt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"accGetAccumulationAverage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"gyroGetAccumulationAverage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"quaternionMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4dd87d2d830a21d4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,743 @@
+	.file	"interpolated_setpoint.c"
+	.section	.gnu.lto_.profile.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\235\004"
+	.string	"\304\004>\001"
+	.string	"\020"
+	.string	"\363\325\356\265\017\f\002"
+	.string	"\002\001"
+	.string	"\002\002\002\003"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\004\005\354\207\264\260\016P\004\002\005"
+	.string	"\002\006"
+	.string	"\007\002\b\006\007\b\t\n\013\016\017\020\367\376\334\304\001\016\021\374\351\233\315\016\002\002\002\002\003"
+	.string	"$ \360\002\252!\017\2370\013#\201i\007\372\315\264#\214\223hW\2059Y;\336\002\243\263\031\024\243\f\003\027\030\364H\022`\032\006\034t\356F\r\326\300z\316\005N\031\211"
+	.ascii	"\334e\357\332XJ\337\325\227S\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375 l\375\001"
+	.string	"\264\002`"
+	.string	"\004"
+	.string	"\001\002\002\t\002"
+	.string	"\203\001\001\001\204\001\001\001\020\002\006\001"
+	.string	"\001"
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004\003\021\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\007"
+	.string	"@"
+	.ascii	"` 8\030\314\343*Uj%\244\r`\001"
+	.text
+	.section	.gnu.lto_.inline.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375`\242\001u\f"
+	.string	"FVI< q\222t\004\023p)`\277\212~\026\216\024\0306\2760\tD\360L_\037\034^\260\237\253!d\301}\026\264\216\332"
+	.string	"\013\035"
+	.string	"\001\001`\204\213\222Y\377\241\262\376H\342\233\335[\356\0245"
+	.string	"5"
+	.string	"="
+	.string	"!%\211Q2\303P\266\374\232N\327t\356\r\203\353\205O=\311L\313\305\013\322\251\231\231\317o\356Ef\nx^\025^\030\356K\355~!G\"\263\"\360x)\0042R\022\214\343\246*\035 \2500\027{<a\365\274\324\314\254\n\375P\255?\307o\324\354\r\204A\035\351\233m\036\250\"\375\003\306Q\221\177[\360lt\304"
+	.ascii	"|\001\b,\337\246\036TP$\0308\322tl\350\036\307`.YFc\364Q\026"
+	.ascii	"!R\214\260\314\214\231\217\232\330\220\362\240cs\004)\n\0320"
+	.ascii	"2\340\270\306%\335\212\t\247D\201\321r\244\316\302\212\377\257"
+	.ascii	"\247\313\314|\216\301\375\250;\311\254.\007\360X\342L\255\321"
+	.ascii	"\340\303J\307+\363Rp'H4\224\364\365\222z\241j!b\035Mq:\034<O"
+	.ascii	"\235I\004\016\023\006\254\37315\013) 0\002\342\330\230y\275$"
+	.ascii	"\003Wrp\206O\221:\306`\270\025Fh\023hJ\366\254kq\017%i\203m*"
+	.ascii	"\036\257E\022I\212\003\325\001\324@X\311\200\253!\233\253\226"
+	.ascii	"\005{ \030nCy\231A\016\310,\f2\222Z(\300\363\241\211(i\363Q\f"
+	.ascii	"d\265\240\361\250g\261X\330\344\226\243\327\344\272\250X\024"
+	.ascii	"\300\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375 \353\005\004"
+	.string	"B\007\026\037\240'\351\377g]\017\336\244\252\272\354\307\212\337\254\352\370k\237\274\342\276\263\366\350\3356\221I\006<=\363\004\301\351\277\006\274yU\226\201\036\240wz\210\337 \216\021\331\005B\212B\017\033\356\346\272\361\214O'\306\023\353\247o\305^\261\316Dk\341\265L\332\245y\026\037\001\017"
+	.ascii	"\372\b*\\oU!0\\\024\301\245,\242\020\001\256P\371\300\032\334"
+	.ascii	"\2638u\241j\201N\255\316Y\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\231\004\005\230\004\020\230\004\021\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375 O\r\002"
+	.string	"\024\003C"
+	.string	"\004"
+	.string	"\001\024"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\374\007\374\007"
+	.string	"\020"
+	.string	""
+	.string	"\001\002\017"
+	.string	"\001\002\020\021\001\300\007\002\021"
+	.string	"\001\002\r\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"8\203\024\025\334%\2142I\330@\033"
+	.text
+	.section	.gnu.lto_.lto.ce92169f2f23c4dd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_interpolatedSpInit.35.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375`q\003\305\030"
+	.string	"\266\255\235G\260XQ:\300!\262eV\361\263\2203\304\tg\245\035\364\307\027\037\021?\230$<\3322\365%@A\320o\201r\327S\211d\205G\207\257\2311\222su\201Cu_\035q\227\216\322\031-0\216o%\237l\"wJ\001\202"
+	.string	"\201"
+	.string	"\213"
+	.ascii	"l`\342\347\337\344\226\275\273\221\333\231^\200\373t N\324\214"
+	.ascii	"\331\335\004\237\266 ~\352\200\227\366\211\274\310\355:\030\017"
+	.ascii	"\260\253\004\325dw\267\300\021\304O\357\356\n?\305\013\b?}\263"
+	.ascii	"\305\0248\272I\023\203wfw_\312\303zpw\203\362\366\t\252\274\371"
+	.ascii	"M7\220\344\033s\270"
+	.string	"O\020\300\356\342\344\216\300\0062rE\022\fR\343z\247K\337\324\230\253q\251\232\260\273\226c\216\306\035\336v\315v\b[u\004L\273\265\204\337\257\214\321.\321\001\325\034\225K\220\204\024\311\237\245\252\026\340!\215\271J}\2146V\361$+\304]\243\035\377\351\004M\364\361\351\303\b?\257%\212\240\321\021\311\237\275\303I]\262\377U%\333u\246;\347\272\037\347\274\273\245\222f\201\322+\225\026Ci\325\224\016\247\364TipJ+(-U\372\0030\330\350r\034\276\335\031\2775\0335\235\3748\357g\262\177\304w\3429\n\270O\026\210\004+,\242\256\222~\305Ln>\332Vp+\356}Jj\303\2418<\214\324\356\356|V\3419\230)\247\322\341\003\f\026~\252\324A\022\222\361F(\305=\002R\276\021\266\210\036\205\312\321\251\241\266x\374\246\332N\361(\356\271z\354.\004\377\311\241\2140\211\236\0363#\231"
+	.string	"\322\275\313\226\332&b\362\343\324;}\205\205M\324\221\342Tw\027\247\006\325g\362\236\217\357\3032 \371\021(\374\224[F2\263+\001U\203n\210\256\367\035_\002\263\313\202b>0\231-\006\302E\214\347\347\007G\0264\373\241\325<\240\230\r\261\354\303\300&4\243\r\331d-L\240\220\331bA\264\241\232\314&4{\331R"
+	.ascii	"\315\202~^B\263\330\212\227O\255\305\213\001\002\323\206d\265"
+	.ascii	"\227\215F\253\275Z\273\375W\225\232.:\331\210\"\322\242\251K"
+	.ascii	"VMQ\227\252\027\231\340-\225\261\340-\275\256\311\213\221Ls\020"
+	.ascii	"\324\245\226\272T\345\233B\312\241#U\272R\226\332\024*\310\217"
+	.ascii	"\326AR\234}.,.|K\206\035-<\017\262\260\364\343\rQ\003C\250Q\034"
+	.ascii	"\005\031D\310T 2\021\2158i\f\220\002\2211\263\016\021\240\271"
+	.ascii	"T\246i\332\f\242,\377\251\2444?G\232\373\244&\221\227\206\346"
+	.ascii	"y.\r\264\260\356\345\223V\376\377=\302\237\035\201#Y\256\302"
+	.ascii	"\252 H\370\"`\336<`Fn\344m\332\273\213\212\036\340h+\023\323"
+	.ascii	"\260|\365cZ\363\255\357\206}\n\030?u\004\354]n\357\024\024\256"
+	.ascii	"\251\357B\317\030[\"k\327\"\302\023a\367c\323\352\034\251+%9"
+	.ascii	"}2\315\263\302\355=\037\362J\271a\360\2308LUHm\372o\036\235\333"
+	.ascii	"\374\001"
+	.text
+	.section	.gnu.lto_interpolatedSpApply.36.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375`2\031\335l"
+	.string	"\372\261T'K \220\332\351>%@\203\273\314\017n\305o\r\346j\236[\004\342\340\017\027\277\302\342\320<\231\373[1\241\020\327|-)no\260\225\362t\301\005\251"
+	.string	"\004b\216\t\226\364F\334\210\264\304IcV\361Z\260\026\fzj$\311N)\245P\0023\002t\002D\327y\350:\013]\347\240v\006\272\316?Hg\237\353\334\323\316<H\347\235\353\254\203t\316qg\034\244\363\315u\266\271\316\036\256\363\362:\327\\g\345uN^g\344u\276\327\371x\235\327\353\374\355\354G\347\3562\207\353\"\247X&z\344\301\314\261H\032w`\005\217U\267\366\353\256\353\306\322\255\245{K7^w\333\235\327\255\327\275\327\315\327K\346fn/\334\177\274\364\033\342\305\226EN\261\260\255p_\351,m\327w\315\245\273t\265_h\030\272\217\227|\204H\016\275\354=\331\340\260\252\307\201\225\274\016\334\332h\223(gx\334\2668;\224S\234`\313\22015\267\303.-\3342\305r\3301#pQ\266\260p\233\f#\373\231\026\306\035Zu\335\020\246\330\034\333\246"
+	.ascii	"\024E9\250>r\216d\037\233\371\311\274d\346w\241\310\232\303\212"
+	.ascii	"=\241\322\245\306\b\022\317\236\003\013\352DA\271>\226\235\223"
+	.ascii	"\342\026\355M\205\367X\311\262iY\272\260,+\305(\222}dfn\026Z"
+	.ascii	"\356\311\334\256skm7zdZ\247\310\262,\025\263}n\037\327\346\271"
+	.ascii	"}|\021\372\331SRQPONML!\226@(%!1\217>\030\025\021\r\t\005\001"
+	.ascii	"\375\370\364\360\354\350\344\340\334\330xX\326(\223\310{\\\337"
+	.ascii	"\237\334t\275\"\302\265\324\262\260\236\222\n\354\250\365\b\004"
+	.ascii	"'hz\220\354\313\312\374\023\234\002:\324_?\375\371\271\223\227"
+	.ascii	"n\362\322\347Lm\207h\271\370\022^\203\300\273s\245\277-\236d"
+	.ascii	"\327Hv\314,Z\374\250\212\177hh\2256\232B\305\213\344\232H\356"
+	.ascii	"\215\214\005\037\032$\263[\301\205\342:h]\032z#\203s\240\225"
+	.ascii	"\371\027\347\346?>=\353\320R\233\363\224@\202\357\214P\202\353"
+	.ascii	"\224\3209\353\023\032\240\222\036$c[}dxrC\277\221\2559N\2237"
+	.ascii	"2'~\343P\332\246I{@Z\"_\244%\201\3225\034l\340\312\016\316<\371"
+	.ascii	"F\306\304\221\203dh\3357\365k\326\307\2322\263^o\312\214\254"
+	.ascii	"L\226e\227eb\376\353\323a^\016\335\327H\203d\201\253\017\022"
+	.ascii	"(\324\246k\037+\213\272#_\260,\313N-K\322L\325\314O\203\231\023"
+	.ascii	"\231}\302\004\337f\035\200\221\276E\227U\327\241UGk\036\246\314"
+	.ascii	"\233\001\316L\r\026>#58\337ot54\202%\323\340<\262\205@e\325\275"
+	.ascii	"\371N\243\323\241*\211\246\027i\324\260a\343\366\361\346\221"
+	.ascii	"\037|\211\253&_\215m~\371\236F\007\270xX\365\3606\217<#}\313"
+	.ascii	"\341\f\017\034V\036\276\357\f\253V\277\374\365K#[fv\245\346\267"
+	.ascii	"\240\r2\224!4\024\363\305\013\330\2108\250\270 \n\232\334\361"
+	.ascii	"\325\032\354\216\001\373Y\273\241\305\030p\300\216\035\267\217"
+	.ascii	"H\023\366\340\314@\275\221_\230\002\267\266\276\032\327<\362"
+	.ascii	"\275\350\002\333\236cW\345\327\374\255K\276\362\357\236T\021"
+	.ascii	"j\030\006\201\344\367\035[\365\352\221\237b"
+	.string	"\203V\252x\277\371W\337\2144\024&p_\004\016\\\342\030\370\3437\277\031\245o\353[\375\361\217\205\322(Qo\244 K\023r\233dY\366\004\267\f=\310\203\273\255\217\334\303\352\310m\3658yxh\252\377\334\266\231$\334$\306\262P%\006^\2013>\251_\324\033\331\377\037Y(=\354\367\357i\032\2507r\21637\261\274\251\375KR)\202\321\017c\033\357\361\314\rlyS\255\276\373\272\321\2568\021\024\373\260^[<\354\362`\227\307\367\034a\013e\bk\020\363E\346\2710\1775\346\376\306\306\306F~\020\230\257s\223\265\013\335}\244\353\232\333\202f\237\024\364\226f\260\"\327\231\210\220\353\034\201\263\253\375\232\271~<\260\245\325y\315W\315\336kf\240\371\232\255\232Jw\217\236\353\346\321X\232s\340h-\3157ZK\263\215\306k.\240\361\232k4^3\001\3356\323\350\266yF\3535W\265^\363"
+	.ascii	"\327YF\215s\214\353\f\343:\277\270\316.\256s\213\353\314\342"
+	.ascii	":\257\270\316*\256s\n\2453\n\244\363\t\245\263\211\244s\211\353"
+	.ascii	"LB\351,@\3229\200\353<B\351,\"\351\f\300u\246\272\316SHg\251"
+	.ascii	"\353\034u\235\241\256\363\323uv\272\316M\327\231\351:\207\270"
+	.ascii	"\316K\327\031\304uV\272\316I\327\031\351:3\257\363\321u\376p"
+	.ascii	"\235\215\256s\321u\016md\244\212G\257\306L\017\342=\f\206x\246"
+	.ascii	"/b\\\372\020o\264B\\\002K\357V\330\252\036\304\337\024\332\332"
+	.ascii	"C\025\374>`1z\020\270\341\370\306\020=\177\002>\f\206l\374\230"
+	.ascii	"\322#\005\2269\273\023Lz\245\277\216\202\237\220\364m\305\220"
+	.ascii	"\371H\357xRE\250\277\271\t\314W\016\316P\364jO\301?\037\252\214"
+	.ascii	"\364\355\350)x?#\365\213~\370\243\177F)\232\321\027\375\207\027"
+	.ascii	":c\3647\317\003!/\344\213\276\003I \263#E\003)DD\337i(\020)\261"
+	.ascii	"CcB\220\214\224\241\365\247\206\242\036\227 \3473P\215/\340\307"
+	.ascii	"x\375\231Q#\247G%\250\353y\005\232\3614~\f\354\2134\260\201N"
+	.ascii	"\005\260\017a\027\003\221/\340\213\374J\344\243\354\376\"\370"
+	.ascii	"\253\027\362\177&\202\007a\347\345*\004n\213\302\270\232\022"
+	.ascii	"\272\027\307d\350\237pk\264\346i\3178\253\025\217\212H\343\205"
+	.ascii	"~\350\221xI\316\374\234\362\254\342M\025\232b\247'\264v\325E"
+	.ascii	"k\302E\321\f\264\306;\277\345\330\300H\337\270~\306w}\243\261"
+	.ascii	"%\345\265\300\026\364j<\304\305\270\276I\211\rt\200b\276\310"
+	.ascii	"A\377\363\\\377x@\037\344\363@\037\2047M\363\363\375\327P\203"
+	.ascii	"wt`\2560\320\253q\3675\215\345\025\001?DWe\332\326$m\256\276"
+	.ascii	"\306\032\227\302\362\207\220\312\264\255\271\217$l2\343\307\272"
+	.ascii	"\257u\020\336M\333\245\326\363\3523\300{\215M\363\253~\314\347"
+	.ascii	"\275\316|~\205\022A\264)L\240\336\370\363j\354<W:WOD\3278m{\266"
+	.ascii	"\036I\2106mw\256~\210n\314\264\315\371\361\004\374\230\3634\337"
+	.ascii	"u\232\357=\315G\022r0mw\232\357mS\270\344<\360\003\374\330\222"
+	.ascii	"*#\263$up>=\177\365[\337R?\236\357\371\226\036\356<\3177\240"
+	.ascii	"\223\306i\032\350\321\312^`\317\316\367\240g\340J\252\270\333"
+	.ascii	"\030\206\f\031\267\217;\277\fk\214c\002U\232P\266\306s\244s\036"
+	.ascii	"\247\220\350N\360\202\235\n:\347U \251\342\024F\357\212\216\316"
+	.ascii	"\377x\213&_\347/\034Z\242\024-\372\300w\nh1H\337\242u)\360\345"
+	.ascii	"x\264s>\n\311\023\027P\250h8;t\316w\232#\251Jb\220\363M\346\254"
+	.ascii	"\232\006P\211\334\315\253\331\374X\225\021\265L\f\234\031\017"
+	.ascii	">\225\322\240\310\262l\363\265\002>\262\274\276\272\262d\354"
+	.ascii	"\354\030\322\364Zf}5u\020\361\2726=>\262\262\202\354\360\361"
+	.ascii	"\221\265\245\265\345\303\211\243\313\271\365\325\364\312\002"
+	.ascii	"\222\205\205\005\243(\206\226\226M\220- X\353WW\004N.\030_\020"
+	.ascii	"8\235WK/\347\027Vs\206\003_N'\327\016-\255\233\254 E\276\326"
+	.ascii	",\256\246\327\f,\035C\262\272j \330\"\322\\\031k\352\253k\313"
+	.ascii	"\031\344+\013\202\005|d"
+	.ascii	"}5\2018\203xe}umQ}9\320\300\026\020-\252\256\255&\027\025\226"
+	.ascii	"\027\004TSO\354\f\222\345E\365\345tzQ-\347\330^\331\007\201\311"
+	.ascii	"\236\t\375(W\300m\362\247d\337t\315\224\201\0254\325uJ\306\033"
+	.ascii	"y1'(\034\306\307@\362,\363\246\312x\246\221\017c\376\260\037"
+	.ascii	"Ka\250\314"
+	.string	"\317\f\236}j\3200\224\350c\343sI\267k}dg\3644\3173\016\236M\232\334>\306\3706sK\244\232quK\007P)\035\2705Ztb\325I\334\300P\021ap{\241KT\027\271}\344\213\226\220I\344\026h-\007\t\334Z*\"\f3e^<\213\207\361\227Q\212\026\265\340]\374\213\027\252\223\276\261\370\026\357\342\213\276H\243\340\300m\362\260\305w [\025:F\314\007,\336\006\272C\\\025\372\344Y\305\202g\032\213ApE\r\206*>\305\257\370\025O\212\226\343q\274\212\277u`hH\361\310\264\034\342\252P(\246|\006\302\240B*\342\211G!CUR\360\304\367\013lU\350\323\022\021\234L<\240\007~\361\346\275[\342M\220(!\344I4-y\302$\200\224\367\361\005\360\002\214\b\240\310\217\ba\327R\357d\326\310\266$\342\365\236j.\326<\317\253O\021\330\236$<I\270}l*\""
+	.string	"/\342\203\n\247i\234\234\352\231\237nO\023nS\001x\246\330\207e\271\231z\252\017bt<n\223wS\3371\030V\213"
+	.string	"\263\234\001\361j\254\242\253\256\324w\bt\206Z\236RdH=\322\0052qL\224\314x\031\203\324\354;\323\2614\237\231P\216\037c\244\033\317+\363\206\220\253\3208~\f\252{|\221Y\"\235\341\025n\213\326\352z \021\305\240\251\242s!\201$b\362\222\300\276\3107\373\022\264%J\337\242HQ\357\364\277\b\365QO$\346\351\241\236\210\261\n\225\247\357D\247\277I\332\3100\225p^\240|\340\325\310\306\337\370\261\246W\n\264\372\246\327\021\201\367\250\2010%\221SfFF\024$I\n\205\306\201\005\204\030\346\240\254n\021\300(\347$34B\222\024*\215\001\007\006X4\335\363\330~\007\322\303\004\311R\304\205\232\205\315\320\2412\017>i\366\235\024\256\363\214wn\352V\314$\316Jz\036\250\236\312\376\036\205\037\352\253\332\363\357\377\301wI\020\370v\3371\317\310|"
+	.string	"\202\244\211X\310\256QY4\365Y\234\315\215c\\e\210y\350Z4\267\034\376\243\323\357n\267u\313\334\255\006s$\206jG\367\374\0172f-\372v\0265k\213\020\340K\013r3\302 \261\212\314>\372\bJ\260\023}\316\205\031\315$\343\370i\326>\001\353\360\270\372\241\020\341\r\366\247z\207"
+	.string	"EM\342\203\004\366\323*\372\235g\270\0248\242ub\036\204\3654\nR\245O\201\266?\345\216r\331\005W\342\257\255\202I\357q\345\376\321\373}\307O##\027m\356\266J>:\262\020;\203Ve=2\\R&\336511\013\211%\225\256\271\323\260\235\031\320\313\230\332\036\260i\354W\303\221\235\001\366\203c\366\331\337\020\033-\344\315q\351\352\265\266\262\306\241*\364.\352\"\024\223\203w\320b\262X\301/8Y\211\026O\242\242\213\212\332s\254\030)pG\215\032"
+	.ascii	"%\320\224B0b\205T\200*\023\302\253G\203\220/\"\217\226\357\261"
+	.ascii	"\351aO\005,\365\275\361\025r|\267,\344\032X#.\017EV\346\305*"
+	.ascii	"\321\243c\252\334B t\330$,\261=\253\232\207:cak\2716\303\243"
+	.ascii	"\025\037\346i{\335B]\326\324ML\205'\n\35783\314D;@\026\001\237"
+	.ascii	"\360\004<a\235\036LG`\302.G\234Gs\2023\240\247;Z=\243\236\t8"
+	.ascii	"\313\365\223\305\320>\253e\340\254m\273X.u\352g3\267}\203\270"
+	.ascii	"\2167\nL\251\026\240\023\261\037\311 \311\307\241a(\210\bkR\253"
+	.ascii	"\213\26101**f\247\334\344\327\327\344\031\215\001\3769\317\372"
+	.ascii	"j\033\031N\005\321\237ha\350X\017\207\222P{\023\335\255+\200"
+	.ascii	".2\367|V\231c\267\343\324\341+\177\233\307\262\222\005\312m\233"
+	.ascii	"\316\325\342\003\002R\021\235\034L\310\216\226\240\272\035\270"
+	.ascii	"A\t\313s\2028\024\017\244d\373\204$w\317\372P\016x\333A\215\005"
+	.string	"4\021\274\037\374*\310\377\273\324\220\020\2314\341\205\3413\306?\336\211\236HL[\206Z\261\006\271L^\210\"U1\206c\345`\"\221\265\004'\215\n6dK{m0\353\342\255i\"8\202Kf\201\202\002\336\243\005\b\365\264\027\234\304`_\313\236T\320\324Hhy\244W\226 \327\001\232\035_\306\203i\002Lh\022F\003\037\354\305\303n\325.P'Z\356a\234\235\210t\355\272\313\270\301D\322\2572H95\363\027Xr\200\007\023\2401\2405\334\200[\306v\262\274\334\334\242\007\231\340\021\213\247\2601\tO\375\nWl\341ml\004\216\310\t\221r!T\240\270\273\266:\267\236\261\343R\364r\0264\024D\002\027\336\223\251\372\360\277\211\304~EA';\320G\376\\\022\3136\310\370\002\007\351PsB\2730\f\367\256\025\310\370\016\235\261\342(i'\354E\340v^\024\314\013i\343\220G\032\307\340\246X\030"
+	.ascii	"\360\316\260\236\017\\\347\351R\371\226\2423\364\032\375\366"
+	.ascii	"O5\264\211\235\237\301\362\206\346wq\221\360\312E\324j\003Mx"
+	.ascii	"\206\t2\306\212Y\250\253\324(\215\322\027\034n\272\234 \"\005"
+	.ascii	"\364\230@\362[aG\265t\326\253i\ry\254S\211\310\370f<\361\234"
+	.ascii	"\022o\005`\262r&\230\206\250\001"
+	.text
+	.section	.gnu.lto_applyFfLimit.37.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375`<\005\355\036"
+	.string	"\0267\302I\240\326Q:\304\250p\312\026\335\260\234o\307\325\246<B\375\303\rBWT0\330z\353\323{\005\020P6\034\323\\\316\365\227e\224\325}\360\321\3435`M`\017\340\304"
+	.string	"\211\356\231&\357\270\246\324\021\277\375o\215\020B\266L)\257"
+	.string	"\233"
+	.string	"\257"
+	.string	"\266\2170\022zX\211\260E\033\221\\A\370~\207\271,\253\225\311FV\255\365\306\016b/m\3738\236\343\3076\222E'(sHbH\345\245\326\212\033\360\032\363%y"
+	.ascii	"\346K\n\343?\267\325h3Y\3544K\222\356\217\177\346\220R8\216\f"
+	.ascii	"\025\001\335F\200\311H\3515\245(\"\026KSJ\332\331\231\303d\204"
+	.ascii	"t\331\277\210VX!m\354\213\b\211\034Pk=\325\tD\021\035\355i\n"
+	.ascii	"\267Tq\222<\260\264\004\305\255hH\3268q\201\345T\337\021EBKE"
+	.ascii	"\004\315\232'.\031\263\242!\3353\247\326\352\035*2\272o\267}"
+	.ascii	"\264\r\264I\035\001GA{\364\205\374\306\302\013h\305\374\211\353"
+	.ascii	"i\213b\371\006\211X[\fq\002\203\305j\005\362\016\325a\tb\255"
+	.ascii	"\325\300\203\330\006\373\227\300bN\225\250\026\253\201\2273t"
+	.ascii	"\261\222\274\204v\214]\f.m\262O\217\307c\230\351\013\373=~\233"
+	.ascii	"\373\370"
+	.string	"\003\274\370\323|\307?\263k\231\027\357[\271\266\221\353\332\256i\273\236\355Z\266\353\330\256\317]\233\273.\3135I\256i\271^r}\001W\3122\345\324`J\255&\216a\252W\2515\303\257\272U\210\377pyb\213\026\302\246\275\274\375c\323\002\364V\337\243\024T\222\212<\351\262\2413J\223\321\031=\271\204D\223\312(\031E\310\305\206\2364F\367J\030\0254\351IO\251\033F!1\270\307\307h\223MZR\fSL\204\026\214\2057\2611\306\344]9\035\235\316|iR\0061\264\002\320\222*\270Q%\364\002\344_1\307\223\274\271\222$\244\251u\212\204\3223xu\365\305\252Q.\265\235\340F6,\240Rkm\340o\235k\347C\2754\007\036o\210\013\r]z^\t\273\202\366\370\007A\032a$m\362\203\367\314\323\017SU\204\026\214\375\254\023\351\371P\356\360\333\017\375\314\227\247g\260\352K\336\301\371\355"
+	.string	"s<\\O\217\307\353\351\b\250\220aG\001\330\243\363\371<\350\314\370LX\235\007\236\334\207\362\267\003\221#\255\203\003\354\331\365|\200\272\337\205\f:`\216\247\347\343\323\001{v8\340\316\206\035\217\006\\\317.\307\303\351\370~8\234\003\356\371\350|8`\257\347\303\321\212A'+}q\243\267\022a^A4h\263Q(\227\022eo\256\033\265\371\210\b\023\304Z\355\253F\245\224r,\3518\n\332Z+\020\2156\231\bf\214\321$L\22114\2366\026\270\325e-\224d\201\031e2\364FG \370\f=\325eWxlyB\326Z\353,Fi\250\f\365\n\2738\201\321\222%\243\241\264f\250AL\306\020DB%\222\202\024'k\240\002\221\261\2729\021`!\224\206\246J+\303\034\317\t\321\001\225\2760\023\234\272\330N\213\n"
+	.string	"W=\366K\002\260k\021\375\356\321\274%\311\324$\324r\374\354\252\373QJ\2230\3125Y\300\001$\253LKQr\360\222\337\244d\353\323\253\331&\262%8\267\020o\340\215c\311\002n\213\341Q>/\033\355\314\024\241\236 \372\240-\255\035q{\001gQ\256\030\307\247\322e'bu\030N\021E\t\275\0206g\313\n\bn\226\335\320f\330\200\336o\232-By<\f\224\305\030\004\023\376G\336\231e-9nX\017\004\\uTDQEf*\n\343"
+	.ascii	"iY\302G\354\361Q\252/\335\211V\240~\377\007\232u\215\371\003"
+	.text
+	.section	.gnu.lto_shouldApplyFfLimits.38.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"]\f"
+	.string	"\226XWB q\223\016\037\260"
+	.string	"S\201M\301\r\220\205!#R\314\320\301\350_\336\240\324\003\242\225\251\370\330\330Z\237\0065\022\024\232F\005,\202\023\006\001\004\240\353n\006\f\206\251\360\301\200\204K\\\326\222\275\245L)G"
+	.string	"@"
+	.string	"E"
+	.string	"\026\335#q\372I\212\344E\216]\317\322\223\213\036\241\246\310\277x\304\024*>S7z\374p\b\021\260\214\270Q \204\f\017\231n$5@W\202\232\335=\213gI'\222y\361\330]\247\251\353pW\267-\3016\004\373\235>\334\335\265\242\034\217\362\303L\247\246_\t\340\300\362"
+	.string	"\307\356\351\323\2614\342\312\t\333!;c;\323\376\212\247BGq\f\003\330\025\221\202\261\273\013\354"
+	.string	"\363\2509\201\352\021~@\365h\333\035\006\241\244\374\252\250&PA\214\234P@Eys\250\021f\224\262\345\271\273#U9p\315\032)6J\331b\333\032\236b\025\314\3566\360[\334\305\346\233xt\206\220\274\351\321\017\251\036\257\006J\254\220\362\263\275Q\252\211\003\033\266\301\003\375\301\341>X\006\342\256m\002\205\213\363\200d \355\342>\230\305]\260\200\201T\260>\230\007\203\365\241m\026'\2013\320\245Y\\\226iV\306\333\303U\224\023*x\352\346\251%\266\243jH*\342\324\250'\331\021\020"
+	.ascii	"M\204^\316\206\307G\2217\304\351\031\b\242\250\020`\023\2671"
+	.ascii	"\034 \227Q\212\032_\261L0Z\ryU\305\232!\267\253\350\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375`\216\001%\t"
+	.string	"\262\21546`\213\322\001\020\215M\302]i"
+	.string	"\337[\005\350\307\266\005\320\201x\320\366\313\336"
+	.string	"\033\215+\b\234\202;\206\301\276\375o\377\333>i-!\204\220f\355\032B\331\344\226)O\nU\236\003C\3424Y\315\211\r\312\252\303\327"
+	.string	"2\250\222\353\270XUV\027\276\264R\021\n\2504\360\370H]\253%\020[-\241\020:0[M\320V\0172+B@4\266U"
+	.string	"\353\232`jw\233$W\022\203F\034\022\261(\304#\020\223>,\340a\202\016\027p\330\223\335\375w\033\376dD\303\235\270\3120'b0\357\322\r\354\177\357\022`\271\270l\265\267N\343\262\r\263h\030\206\341\305\233xSE\243`&\231\325?\277\226x{j\213\237\377\f\210\314\356n\2135\361\177|\b(  \003\271M\007\200Q\bVZ\025\222\241\026\346\273ad}(\236)\365\b\016\340"
+	.string	"\016p"
+	.ascii	"\007p\0208\374\201\200\263\264\264\205y\330\220\200\336\267\270"
+	.ascii	"-\022K:\006\036%\226v\34209\261\006\2079\f.\376\021\t\303\214"
+	.ascii	"Y\231Z\353\217\001"
+	.text
+	.section	.gnu.lto_.refs.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\235\005"
+	.string	"b\016(+pM2\214\001\200\367\bx`g\\\021\247\377\377W\222\362\031"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"b\251M\013P\013>{\263\255\021\262w#\220\337\b\221)\317\211\331"
+	.ascii	"\314\264\005\322\026\3475m$\375L\353H\003\240\273\270<\213\n"
+	.ascii	"Js\024\227\335\204e'\261v\021\353AX\336\303\332'&%\352$#\"\323"
+	.ascii	"\016Y\007\221\376\361l\017hwp@\337h\256\221\021m\214\265\016"
+	.ascii	"j\0336\203Z\205\235\240FP{\2406\243\326\2402\201z\240Y\240\262"
+	.ascii	"\230\312N\321\n\032z\002,\264P\232\322^\224\246r6j\366\331>7"
+	.ascii	"\t\007\004\001l\371\240\356\315\002W0P\023UC\024"
+	.text
+	.section	.gnu.lto_.decls.ce92169f2f23c4dd,"e",@progbits
+	.string	"(\265/\375`J(-\256"
+	.string	"\332\021\005=Y0\nQI\035t\241\023\027\f\252\253\200{\226z\262\351\360\024!\364\351\026\215\357\274\2613Q\261\237\3314\223~G)\241:\265\033T\233[xm>\323w%_'"
+	.ascii	"\024\nUJ@\234\370\377\013\270a)%\"*;+\340\206\353X\023\237\304"
+	.ascii	"\fC\254\253\226\2204)\245L\001Z\003\324\003\342\003\322\336\241"
+	.ascii	"\033v6\340*e\246\272ps\377\315\030\347h0n\266\370\337`\361\277"
+	.ascii	"i\342\177\023\203\277\315\224\177\376\372\317\317\f${ag\315\214"
+	.ascii	")\0350\313\033\272\243\323\3000K\222\367\333\310\361\377\317"
+	.ascii	"I2WV\222\221\340h\356\312Z\237\217\340%\237\241\357\241\b\026"
+	.ascii	"\323\320gol*\253,w\345\255\234\324P4^\004\246%\305iD\260\230"
+	.ascii	"/\371\353B[~<{\207~\006\377=\377\030x\310]\331\b\026\353\365"
+	.ascii	"\266^46\345cW\305\253\310\221i\357\320\235\r\0336l\330\355h\316"
+	.ascii	"m\261\331o\303\204\363\300\370\333x\361\267\351\342o\223\204"
+	.ascii	"g!=\237\207l*\021\224\202\344\275m\216p,\201\215\025\177\033"
+	.ascii	"%\3766B\374k\306\360\257\331\302\277\346\t\377\232.\3765:x\206"
+	.ascii	"\232\032\374y\035\177\356\205?"
+	.string	"\227\302\237/\341\317\265\370s+\376<\211_\300\205\370\367\310\360\357i\341\3373\343\337\323\342\337\273\342\337\303\301\277\027\203?\357\f\177\036\034\177(/\n\177\036\031\177\236\021\376<*\376\274:\376;7\376;5\376;$\374w<\370\357\232\374w\235\377\206\343\377\266\251\360G\333a\034\247\301u8JA\356\217\2458\355wJh\207f,4K\300\362\376\315\305\037S\300\323uu\230\002\336o+\376\233\006\177=\345\257\333\370k3\376\372\007\177\375\304_\027\361G\023\303_\n\236\373\307q\370\f\213\271?n\210\345\215\245=\217\3454\332\032\321\231\2743\034\327mY\013\377\266\f\205\177\366\342\230\013\016\001Gw\260[\016\326\"\224\364\224\367\347-\316\201^\207wx\237\245\370g#\376\271s*X\tn\263@\357C\275w\0138<h0a\311\033_\301X\036\267a\266\216\333:8{W\342\266\2343\275+s0\236"
+	.string	"\343\t\366\326\324\017&\274\375\330\f\307Hz\036[\241\300c6\241='g\313\031]V\336\217\303\360\032\254\205\277\324\t\177\3514\214?.\302\037S\361\237\f\276\203;\317\220\001\256\301\002\374\202\023\034\004\256\300\303^\370\013G1\340\260\307\300\303\353\344W\347\352\035\232#!\315\2214f\362\376\007p\001(\273\207\237\300\037c\340\341:\214\201\367\231\343N\206+\360\376q\222\177\214\004sa\320\313#g'\353\035\252\223\003\255\201D\225\367Cq\005\036\307\024x\275\377\255\363\244\304\377\376w\315\177\206@D\231\274A\0032\006\006\274\\\216\246\013\026\360\237;h\260\363\377\025\370\377\b\276"
+	.ascii	"\037\342_?\371\317?\005\374c\266\177\f\366\217\257\374c+\377"
+	.ascii	"8\313?\326\222CTH\300\377\207e\020\377\330\370\217\2316>\202"
+	.ascii	"\377\214\200\237\340_;\375g\017\377\271\347?s\370\317\007\370"
+	.ascii	"\317\033\376\263\206\377,\301\177\016\300\177\006\300\177\326"
+	.ascii	"\371\317\374?\357\177\214\346\037\233\371\307e\3761\231\177L"
+	.ascii	"\367\217\305\374c\271\177\034\346\037\303\375\343/\377\270\313"
+	.ascii	"?\336\362\217\237\374\343\264\177|\366\217\313\376q\323?\336"
+	.ascii	"\361\217y\374\343\350\377G\340\037\007\371\377\024\377\030\352"
+	.ascii	"\037\367\370\307X\377\230\352\037O\375c\251\177\354\374\307N"
+	.ascii	"\377\177\342\0377\377\237\353\3779\374\177\225\377\337\325\325"
+	.ascii	"\325\325\375\347\036\3775D\377\030xRK\313\250rIg\031\225Z\352"
+	.ascii	"Q\251\376\353CJ\246\321Pg\352\364\250\224\\\217:\227~\313\250"
+	.ascii	"si\031\225\332\302L\214\276\024aZ\273\262\302\302Y\226C=\t\351"
+	.ascii	"I\311\374\265-\241\316\376\326;&#\352\314\001\364\376\344d\276"
+	.ascii	")m`4\241\266$!'J'\276\200$4\345\354Cm\313!\316\336\207\b\021"
+	.ascii	";R\207$\264\255\357\300mI\252\247~D\324;\004H\275'qo\353\275"
+	.ascii	"'{\357=\346\023\264\367\246\337\362\211\204\324{s\007\251?%\323"
+	.ascii	"\210z\317d^\320\226\226\321)gO\232X\364\331\213\240I\374\354"
+	.ascii	"oRL\036Mz\365#1\374\271\3044\027\026\345m\245Q\353\312\033\214"
+	.ascii	"w\004H\024\231\274_\302\222wi\"o\026\201\320\022\002Z]\264r\322"
+	.ascii	"\267\353\335y\345\231\246\273\264\221\234\304mW\033pa\321I\364"
+	.ascii	"\227V\242\241\332\013Gu\227>\362zK#\371\235\236\327]\272\310"
+	.ascii	"\237\371\206\240\275\007\017.\331\365\020\335\245\271t\224/\t"
+	.ascii	"\355J<\0379\334\264p\310\260=\227p\366\343p\341x\007\347\214"
+	.ascii	"?N\022\3768A\370\343\\\361\307\241\300\013\302\273\322\304\353"
+	.ascii	"G\336\217\223\304u\226\376\201\243\032\210~~\026\202\313~\177"
+	.ascii	"9{\264w\250\204\234\356\203*n\312\037k\340\345`\rP.\034%%,g\017"
+	.ascii	"\215\025\324l*\311\3735\026\017\354\354\235\314\307\024\246\325"
+	.ascii	"\224\267\266\322W8zA\357\230\273\022Z\222\362\r\364^W\207/\360"
+	.ascii	"p\\\317k\035\032`QmU]\350\031I\213\322A\205\347\270\316\342\240"
+	.ascii	"SR\022\300L\241dyk)\035\245\275L\2431t\216($kSdy\353\250\254"
+	.ascii	"\241\264\363u\224\306\2013\244\2436\236\300\207\361\004;5\037"
+	.ascii	"J0\336\376\033/\374_?9\365\224 \335X\346\255\2330\334\237\345"
+	.ascii	"\214E\016j\2327\316\353\033\272\271\023\242\245\354\221\267\266"
+	.ascii	"\001\255\221s\322J\312\373o\330\370g\200\243\207t,g\301\260\312"
+	.ascii	"?\214\236K\2304\245\340)u]fIaf:\020\003G\261Z\246U\341\260\312"
+	.ascii	"XHV=\216\236\\\315#\322\256'n0<\340.e\230llI\325\300\204y\256"
+	.ascii	"a/S1c\340\204\216\234\224QAuAq3b\3123\222\344\330!\2453:\243"
+	.ascii	"\303\"\200y\362H\022\312IL\236_\314Ta\261\362\021c\r\004\374"
+	.ascii	"\366b\004\351P\225\030e_\360\031.W\2720\324\252\211K\352J\232"
+	.ascii	"_\020Qy\026My\212\311K)ghH\322\036\266\034$\177i(Z\t\241:)\224"
+	.ascii	"\216')\224\223\207\264\tv\242\364\364\260\324\365\264\312;\252"
+	.ascii	"\232\371\311GFj\362\\\202Gx\2236\311l\270\n\316\242\241O\022"
+	.ascii	"ah\244iL\2622\254\345L\027\231\325\2154\214\206M\n\227\331p\030"
+	.ascii	"<\327\253\342\236\031d\031J\306p\231.iyL\326\242\231\362\027"
+	.ascii	"\275\224\303h%m\244\223:I\313\310\\\362\226,%O\365R\277\320D"
+	.ascii	"\271M\017e49JF\313Wr\by\204L\227\263d\265L&\317e\271,\315ir\223"
+	.ascii	",\202\026\312n\331L\236\222A\310^2\026\335\263\223LE\027i\030"
+	.ascii	"\331,?\311\035\310o\272F\266\222\301\344\272,&C\321J\215\224"
+	.ascii	"\341\362Z\356\222\317\350#\035#\227\3214\364\214\034\227\253"
+	.ascii	"\3443\315\314e8\232\331\362\330g\262\214\245Da\365\200\t\241"
+	.ascii	"\201\253\201\344Li\311\032\336b\346\013&\303\345\213\332\177"
+	.ascii	"\266\312W7\244\312\234\364)\177}\350\205\225'\324T\224\264I\323"
+	.ascii	"\217g\231\023\227\254\247\222\177\334\305\304\315\351\311\206"
+	.ascii	"\247U^\242g\226\334\320\222\212\215 \345?3\261e\032U\\\\\377"
+	.ascii	"Y\210-\303\b3\013cE\300\340\322\362\336a\321\tY\276\234\256\374"
+	.ascii	"\350\261\006\0352\246\025\002\364Jlj&\243\013j\3038##\243\004"
+	.ascii	"H\001\212\216\320\222\020\341qP@@\340\332K"
+	.ascii	"9t8\210\212\220\350-n\323\251%{k\327\320J{\202;\202\305\362\026"
+	.ascii	"\266#\241\274\317\266\021\257g\357\375\207\343eL\031Y\025!B6"
+	.ascii	"\221\2708)^\273\022\201\312\220\337Dp\230$\251\2232\301\311\363"
+	.ascii	"\271\201\360\316\276\254\240LyV^x\301x\272\337@r\322\006\313"
+	.ascii	"\213(\307\220\254\254$eK\\F\260z\374\367\330P\277\344\017*\004"
+	.ascii	"\327\365\254r*3\301\006\017\036\030\246,\025\221N{\3206#D\352"
+	.ascii	"\270\363\267\016\347\276\302t\370\2537\235\3119\002DQ\311R2\355"
+	.ascii	"\313'\r!\314\210\200`\365\373\312\n\257.\fMjS\375\256\372\257"
+	.ascii	"\351\271q\251\3625\306\267\324\357)'\246/C\276\370\377\316qe"
+	.ascii	"\345\312\034\027\177\035\"8pl\250)\311\"R\255\2337\""
+	.string	"9\244yC\365\256\202P-q6\233\333)\203,nZZ\273\2544%/\232~;\371\330\266\240\350\362\3367\266R\r[\327\216':DLL\273\006\016\243\264\202\342k*{6m\032\277k\350\252\344\323\230\274\367\214W\363y\351*\342\345\306\037\306\303\330K\277\035!iM\ry.\206W\321f\376^\222@\204\004\365#\357}\264\225v#\354h*\333J;\351\006\253\t\203\t\226\003\202\217\244\253\215\244\217\260h\223r\311{\307\310I\274\024\303T\305\214\003Y3*r\266\2116\321^B\340\0012i>\035V5\262\024\375^\352(N&+\215Mm\323HC\302\206\244\256n\017\311\345(\261hu\331B\277\207vQ\272\214Q\276\232\2043QBf\344\275\223\177\266\363\252J\323\222\367\356\177\226c\346\365\206\365g\230\210\331\221,4h\312~N3fr\374d\224\211\3522\032+\367\335P\247\322z\366\336\254"
+	.string	"\317\211\t1\311\373\177Gd\310`\261\334\223_]\311\246h\251\016\312\264w)\025\350\260\"(9ottN\244kb\304\3409\f\355I\033\243,N\344\242ZNKa$ qV\246\3210a\336\204\300\301ay\346\370\362E;\355@{\262W\226\263\304\205\213\356\202{W\366fO\312e"
+	.ascii	"\342\245\301x\001\202\343\355u\2273\tde\344\224yk\267W\3039R"
+	.ascii	"2r\224\267\016AG\371\270L\331\246BvUja\252\320\250\341\250V\323"
+	.ascii	"[v7Z\3564l\322\316lV\300\343\361\305hj\313\277^\323Q\264\026"
+	.ascii	"\034\337\026\215\035a\362\316\322C3D\210F\336\357\303\302\261"
+	.ascii	"\350+8\252\3334\225\327U\264\025.\335\246\211h6\334F\326\201"
+	.ascii	"\026\025i\006\272MO\321Q\334\326\204\366dN\214\2458+\323\r\033"
+	.ascii	"r\334|\3101ylZ\212\023nD\207f\204\274\263\006/\376\276\255\n"
+	.ascii	"\274\336O};"
+	.string	"\236<\321NX\247we\230gS\032\216\3524\355\244\227\233k*\355Lf\005\357c\236\341\250>\303b;\032\240\201\221v&\264\202\367%\371k1=\366\232\354\311t\031\357\235\211\317r\304Y\231\366fSC\206\276\350Z\234\274.\3738\234\036A\215\017\272)\217\274\237N7\371\377\232\233+M2\336\2320y\243\221\224\245m\230\200K\022%\357\327K\362\230\246\342C\212\0300\3768\377\363\272\222\331{\227\261\203v\246\020\316\343\035\306\032\376%`\215\007\360\377\273w\r\364.\024\345j\f\027r\246t\312\320\377\333z\037\222Jn \2654$ec\031\225\352\311\241\254\244\016\263K%\227\321\336u\372\320P\222\003g\327YF\373R\177\241e\tw\250T\262\0179\273N\037\352\312\f\313\241O\344\200$\276\352\017\004C\233Wm\213\303\335\273\372\020\221\253;\\?`\361\301k\\]\027h\304\273\372XH\301\001w"
+	.string	"\205\025\351\256AF\023(,<\221\003\262XT\203\304W\375\341A\276\254\n\036 \243\217\005,\200\214l\321\202\016\037\200\037@\260\340Y\205@\305\240\221\345q\221@<<+Z\227\370\266\306\336P]\213\373E\032\333\340n\370\032Y\267\310#\201bH\342]K\b\331\243\360(\201\013O\344\020ty\202C\n#l, E\b\213@-\021IaHB\305\221 a\367D\016<\302\"\013\244\342BM\361\370cB\247\346\270\276(|X\025=c\313\376P\350\240X\241~\020\264\272\307\234\026\305\343Q\004\205\327\310\252\370iG`\340\371\004\211P\337\342\312\301\317\307B=1\034\326\214\3601\262\252\3577\274\254\321\304\021\205p\302\007Yw5\256>\374;|\260\340\003\b\026\275\007\021\342\202\020\027\360\036D\210\236\236\020\037z\370\177\350\321\357\0239\360\030\333\237\2376\030"
+	.string	"\341\372\303\272G\036\022\270\372\250\356\032$\342\204p\365\361Q\213\025X\254B\243\211\025\255\316\352\202E\261\242\025\032\331\0256?@(|\214lP\373S3\004R\241\337\025\270\036[\2440\266\254\211\341\260B\257\330\266\016"
+	.string	"\356^\244q=\376\264A\240\217\212\004\276\252\212\240\nH\240\007B\366\210\343\202\b\364\271 \002\177.\210\304\340\333\032\337'r\020\262\307\235o\217\253\313\363\266\255\313sC\002#\201C!{\344y\200M`\016\260\220=j\017\216@B#;\001\0137+T\n"
+	.string	"\241\020\262G\237\221=\361\212\020\262\307\337\033\\\207C\n\257\273\276E\366\005\032[\027\254\333\022wZ\274l\220\352\226`_\243\232\223\002"
+	.ascii	"n\373\252\356\372\300\007+\324\026:\3055\030\024\341\023\372"
+	.ascii	"\374\204\305\226\210\\w\326\037\366\265i\241\026W\341\315\003"
+	.ascii	"\024R\b]u\205\333\222\020\256\353\260B\216\215\013\"\020\003"
+	.ascii	"$R=\256h\213:-\3345\250\r\256.\220\210T\335\240\317W\341m}?\366"
+	.ascii	"F\335A\262,T\240\017\220\212UhA\007\371\003\024\252+Q\305@\333"
+	.ascii	"\026\201\356jdU\367\005\266nP\275\360\323q[\327]-\f\207\355\013"
+	.ascii	"\024\004\006\201H\025\352\204\365\330\342\005b\340\256o\221\035"
+	.ascii	"NpA\004\032\331\027\370\241\207\273 \376\270\353+|`\025\266'"
+	.ascii	"\214k\320]=H\021A\007k\321\307(\302\202\221UK\350\274+r\375\300"
+	.ascii	"]}|X7\305\212\266X\024Ql\335\327\330\216 \006\215@jQ\002\340"
+	.ascii	"\212\004\232\300B-\256.p\205\332\002(\364y\300\330\262\257\352"
+	.ascii	"\202u\325\325\310v\360\"\201\\\342KagdU\037\2335hT\203\204\252"
+	.ascii	"P\302\013t|\201Z\240\333\276\355\017\3575\002\265A`\261\270\006"
+	.ascii	"\201\300\366\005R-\024\337\267u\211/\2134\252\356\273\363\"\333"
+	.ascii	"V\005p8\344\256J\f\356\365G\215\300Zd\207\255{\274\3719\272@"
+	.ascii	"#\373\203#\\\327#\022\370\032\327\237\027\tt\001\241Z\201'd\217"
+	.ascii	"\276\025\251\256n\320\310\256E!\253sD\002_\325\005\262P\177\200"
+	.ascii	"\303\241\316\313\376\260E\340\212\001\366\350s\3337\250\016\201"
+	.ascii	"\304\267m\177\220\300\341\360\327\036Y\254\3005\310\005\n\002"
+	.ascii	"\207\307\"\320\330B8\341\005\202x\215,P\357{zFd\220@\004J\360"
+	.ascii	" \207\327\310\266\307wE\002\205\353\253\026\333\243\273\276F"
+	.ascii	"\226\347%\372\260\305!\217\221U\177x\202.\222\207\203\001Va\373"
+	.ascii	"\003\\\203\252\013,\256Ak1\3477\330\006\333c\230\311\234\353"
+	.ascii	"PEiDk\332\23334\374o\261\337\001\203k\250RQI\306(BF\206FDF\222"
+	.ascii	"$\351\322\n\020\206$Q \330\320\003\022@4M\2173\346fF\222\024"
+	.ascii	"\324#\373\261\031\003Y\364\255\243\252x\024\234\365\362\207j"
+	.ascii	"H\271Dy\343\007H\247>\027K\204\022Gc\021M\036\201\202\205\204"
+	.ascii	"{\203\341"
+	.string	"\256R\307\017xh\3402\227Q\036\3439\373aO+\032L\372\325H\335/h\0341\217\340\371y\300\217\354Sx\336c6\260\007\311:\264\006\210\245\233%\240\226s\310\216`\2576#\367\366\355\200\300\227\003\233'\203\277\333\0307\251]\277\252\246\227d\262\223k\nY\036k\267\266\037\345\307h\375\300w\206\020z\244\027"
+	.string	"\007\242\310\324>\343;w\ta\321\022\213\266\351\253\021`\023A\205h,\r1C\016\322\177\t\224\310\004\037B\031\322\353\304Jd\220\224-\364a\001M\263\242g\245c0yS\242\362-\360\\\355\330\235\334\250\221P6&,\b\345\026m\024\204\002\232+\b\t\237#\312U)\205\246\027\305\334\f\004,,2\32041{\303q\346\343\311\327\232\037c@t\317\274\350\2541_\r)\001\"\275\232\225X4\370y\240f\213"
+	.string	"\266Ah@;\201\315Q`\256pd\361tb\312z[\334\262\352\272\301\017\027\321\263Y\307\013\021\270m\223\214\342\255;\270\347\242\306]\303\027\247g\267\036\r\243\333V\366;\004\267\373\f[\322O\346\021\276\356<!\245\262n\237\215\373\251\335\254\264\003\020j\2078\217\220{\353+\312\267 r\310\265,\361@\367g\277\265<\331\177\320hzB\245#\222!\244\355\024kI%A'E\326W\211I\364\242UBlI\265\355\260\231\006a\246\263\274N>\037\232\2371\323'(&\230\227s\3636\307i\320)\306F5\036.\036I\324\241T\326\024@h\017\320\373\365\255'4\302s\2010\240\304\022\312\r\303N+\"\224\3106\b\200\242}\202J\227\002_\245cV\3527c\247\360Z\314\211\363*\254\255\024\203\352\207\312&\226\211V\037\355\256w\372\334\326\357\352"
+	.string	"<?\343\306\221\313y(\320\034\037\303\006\323\033x\215&\033%3\257\363\232}V1i\277\232u\230\001Y\314V>f7*\034\214\033GL}w\016v\255]\212\232\022\246\355:\355nu\016$U8\017\353\253\314\004\253\003\342\343\345,p\211\200!\266Dr\232\037U\017dWp\3408\027(\2138\341\24073\301\005@\004\b\013%\231\316;\343\237\250Q \b\351\303\363-`\333UGj|0\017\251b\0022\321\n\016|gQ\312r\361\266}\017f\ro\317\224\345Y\001\367\303\013\242\221\226c\244"
+	.string	"|~\221U\346-\353)\363\276\316\372\0262\235\232\307=\342\227\375\314\330\030n\262\253H3\207\201l\013\243\312N\023={\224BIH\241\337\312\376*\316\243{I\234\202Q\364\350\325\275\312\242\236@\2001\211\224\327\302%\263'\fR\036\222K\332\027\t\324\025\334\001\360\304\205\022\"d\b\301\033K|\352\335\300\300]\253\177'+\351\370\314\261d\224\372l\241l\367(\177B\237\207;\031\002e\254\237TrOE)4t \306\360\t\371\216\023]\t\274"
+	.string	"\221|C*;\26161\243Qs+\315\213\212!\301\317\242&\357\3569\261\266D\204;Q\331\016\275\253\241\177'\362\035\016a\264\251D\230Y\212[T\311\331\003\202k]/F0\233\254L|\315\333\351\301\320\337\273z\240e\263\205z>w\256\2564C\203\313\220D\356n\033\250z\311s\270\213\r\312r\202\357\277\347\026\343+\247RE*gE\353\016y'\274;\265\340\025\223\374\t\223km6\024x\302\322_\035\277\013P\325s7Zc\2604\227\313\016\f\007"
+	.string	"\021\314N\257b\274oO\317X\237\301\222\207\025\226\267r\226o\313\331\236^\356`v\356\364$\0304\225\344t\340\035\355}\3433\314\306\343\256\261\3040;\347\016\207\316u \266@"
+	.string	"~$e\204\345\017\207\222v\363\356\350\323\350\353\207\036\335B\230\304\340\356\230\001D\277\201\254\b\217WV\007t\213\364>\336\276\301\270\202\340\251\276\024\033\322\t\227M\327_\317\t"
+	.string	"\214\330]\216\240\f\223\f\222\311\255_G\320\216\t\303\354\245\344`9>Fl\236\205\231\207\256\274\346\273\236l{\255\316\206d"
+	.string	"C\363[!\314\232E\274\374\240o\321\037\027.\263\300\275H*U\255\036\253\220+D\244\032Z\177\214\372\006\006\0341\310b\234HVm\235\b"
+	.string	"\372\245uLI=q\235\224\020\271)}\365\315\310\317\325=\336o\3005\245j\220&\027Z=\304`\310\212d\346(\275\330\022\f\333\264I\252\364\274S\030\350\333L\377\363HN\240i\211bw%\317}s\246}\245\0139\203d\363\3512\207\362\315|\271\375;\276\267\262\204\216\372$@D\355\266(hE\342\365\327\362\235\\\270JJ\320\231)H\247-\306\272Z\345T\3363}\346\266m\271\3014"
+	.ascii	"K\264\224]\317\305\021\243{\237\\\363\352\343\223rp\226\241|"
+	.ascii	"\330@\243Y\022H\271d\273\321\235\250X\214\256\200R\201y\266\276"
+	.ascii	"\247dYP\355y\235`\b&\337\224 \376\325\356\334\367e\2612\370d"
+	.ascii	"\270\276OP\354\250\233M\021\365\321\211ij@m\0372Z\322\272v\002"
+	.ascii	"Qn\022\222\006*\202\0242\202\337V\352\2720\210.\261]\027T\327"
+	.ascii	"\335`m\261w\233\277\377\007\025\254\252,\3608\003cda\2345\034"
+	.ascii	"\270\323\213\207\203\355b]\315)\212\276Z\327aDO\013\013z|9\017"
+	.ascii	"j6J\246\207\330\271\t\354\250\340`\f6\234\263\002n\265\352w\\"
+	.ascii	"\325!\232\276\324\212E\2434\b\303\351\257v\232\224\226\206\324"
+	.ascii	"\216+N\211eg\253\220\3024\207y|>\312\377\207\315\bb\306\024\311"
+	.ascii	"\313>\313x\267'6c\256A\327\2712\277}\274\364>G\372=\224\213\351"
+	.ascii	"5@\303)\256O\236\354oM?\3277~\316z'|\\\023\226\356\226\302\237"
+	.ascii	"(\247\252\237\307\244\035;\225n\226\352\333\376\345\\\360So\346"
+	.ascii	"\272\204\255,\277P\006~f\376{{\365;\016\r\247O\310?\300\351\247"
+	.ascii	"7\337V\251\303\374\223\373\364sT\374\323\366p\202\321\356(Y+"
+	.text
+	.section	.gnu.lto_.symtab.ce92169f2f23c4dd,"e",@progbits
+	.string	"interpolatedSpInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"setpointDeltaAvg"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"interpolatedSpApply"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"applyFfLimit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"shouldApplyFfLimits"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"pidGetFfSmoothFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"pidGetSpikeLimitInverse"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"pidGetFfBoostFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ce92169f2f23c4dd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2715 @@
+	.file	"mixer.c"
+	.section	.gnu.lto_.profile.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\210\004\335\025"
+	.string	"\344\034|\005"
+	.string	"O"
+	.string	"\350\332\270\264\n\234\001\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\001\002\003\003\002\004\002\005\002\004\006\002\006\002\007\002\007\005\b\002\b\t\002\n\003\352\263\360\321\b\006\240\342\234\212\n\007\b\t\n\013\f\r\016\017\020\021\022\023\024\027\030\031\313\241\312\356\001\036"
+	.string	"\002\013\002\f\002\013\002\004\002\r\016\004\002\016"
+	.string	"\002"
+	.string	"\032\033\034\035\036\037 \373\365\205\353\r\b\007\002\007!\"\353\252\315\223\t#\234\363\353\250\003 \017\020\002\020\004\002\016$%\313\206\250;\016&\341\350\252\241\006^\002\021\002\021\002"
+	.string	"\002\022\001\002\022\002\004\002\023\024\002\024\002"
+	.string	"\002\025\t\002\026\016\002\016)-.1\350\300\306\254\005\0022\354\206\342\366\0063\260\216\270\207\0064\333\207\312\212\004\0025\304\204\356\361\013\006\004\002\0047\345\272\277\270\016\004\002\001\002\0279\311\251\326\357\017\022:\273\355\313\341\006\n\002\030\002\r\004;\323\225\374\231\n*\031\002\031"
+	.string	"\002\032\033\002\032\034\002\034<=\322\245\257\357\005>\220\236\340\376\004\n\017\002\017\032?\203\341\306\354\b\016@\202\335\331\235\013"
+	.string	"A\343\252\334\277\001\006B\346\235\352\343\r"
+	.string	"C\256\330\276\211\r\002DE\020\002\020F\237\251\231\266\006"
+	.string	"G\337\357\263\274H\316\317\221\317\017I\216\205\223\310\017J\314\311\255\300\001K\235\206\367\317\002L\206\270\257\235\016M\222\254\341\316\003N\221\260\327\363\002O\207\254\251\246\016P\325\233\244\265\013Q\334\356\363\332\tR\335\372\220\202\003S\247\327\342\262\fT\254\275\261iU\321\256\205\311\017V\251\323\316\250\fW\201\340\323\240\001X\204\206\332\243\016Y\320\343\254\234\rZ[\346\213\241\374\007\\\267\373\263\327\016]\240\342\234\212\n"
+	.ascii	"\200\202\250\241\301\300\214\310\005\005\205ie;\300\002\242!"
+	.ascii	"\232\007\022\340\0233\206\035\032\033\n\n\322\312\264\177\006"
+	.ascii	",\336R\311Da\325\273\210!\253.\001\236m \236\021\373S\216!c@"
+	.ascii	"\232X\232\343\240\247&\207w\247g\210D\353\352S\235\357\034n\216"
+	.ascii	"8\2013\027\333R7Y\374\232`\bh\331\323Cw\203\343\3100\260\316"
+	.ascii	"S\330\354;\223gE\037\245\177\217\210l\211\rB\324+\215y\315[\022"
+	.ascii	"\n$\350z\376\333,\177\334\273P\265@\025@\304\224\026Q\234\300"
+	.ascii	"\036.1\210\331\333jM\367\234\206\036z0\205\024\350K+9\354\177"
+	.ascii	"\316\221\027]3\364J\327B\013-8I\024UD\021\220\246o\204\211\233"
+	.ascii	"\366\365b\240\324\344\f\334\030~\276{\r5BN\227I\231\374\232\346"
+	.ascii	"\214K\245F0F\007\270\n\246\334E\1773\367\253vY3o\f"
+	.text
+	.section	.gnu.lto_.ipa_sra.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 \370E\004"
+	.string	"rE\021\035\240\267\320\001\377\377\377\377c\377\377\203\230\375\377\377\177GDJM0\367\341i\330\345N)\316\304\020\3630\r[\360\t;\020l`\001;\255t\264\3203\235r6\223\231\313_\257\314DQ_\310\357~\035\257\341\"\034"
+	.string	"0\345t\206k\031\246\032\266\r\207\235\262A\261\313c\313\217\311rq\203\036\301\005[h\247\005\035`\f\022\350\316\fB3\006\204\333\025\341\242\002\177\3110\307\343f\006\234t(\021^\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`J\004\025\023"
+	.string	"v\032aG\340\262(\215\001\311Kq :\253\332\037\266?u\310\316g\207?-V\205\030F\300C\345S\013\373\221\245\322A\266\006mh\376\330[\373:0\303\\\3443g\342\233\373\017\262\334\236\277\013\007qR\217\030,\b\"[\312\024K"
+	.string	"R"
+	.string	"P"
+	.string	";\033\237Iw6/](\376\00443\217(\255\351"
+	.string	"\341\021\360\350\314I\255\375\336E]\314\250Y\2218\\\324\247GE\216\\\255\222?\030K\322Du-\351\356\256\276OE\235\\\220\235\342\350G\225\356 1\242D\262x\225EX\002\241\035\230Fn0\b\320I\205\354\256Hf\020\027pP\325\317R\364V\240\017\300\233\324R\032Cp;\245\275D\031>f3\031\216\020\260\276W)\355\025s\205n\274b.\360\003\231`\276(\217\036'R|\350\2403\272\030\265k\\`R\313{C\324\301\002O8i\214\r\206\314'\223\255\313@\374E\232\347\251\2126\234\211\027)\263D\035\263\234\037\230x\233\345\374L[\202*\312\204\260\035Q\264\ta;\241#\240T\304\356&\360\371\321\002\305\200!\234T\266\273\242\223\346\036\374\310\037"
+	.string	"d\212'\250\330\332\335\3777\372\315\356\202k\030m\322\335]\224\370\257h\312\311\203\262\345[Q\017{\247\311\344\f\211!^H\013!\276/y)\215\325\360\340\200W\350\211\261\205\267Z\016\207r\313\303|\244\331]\221)\264X\341\rLE\032Vx#\tg\250!5DF\310\304$I\235\016\220\"\022\262\242\007\021"
+	.ascii	"\2453R\221\200H\306\244Pw^${\252\263\376Fw\035\033\343\254\323"
+	.ascii	"\216.\242\355\013k*\017\2005#\202ORc\203\270p\302\205_\265\255"
+	.ascii	"\211y\2761zz\352(>u$\237}\330\335\0028\224\300(\357\211I\262"
+	.ascii	"j\375ij\364\333\311v'\322&xy\2614 \300\235\276\025$eA\270\234"
+	.ascii	"e\230&\362L\251@}+\220\333|\242\263\311!\036P\265y\001\363sx"
+	.ascii	"`\304o\377\221FaA\211\314\272\371\257iN\261\021\356\310\265\341"
+	.ascii	"\177VlVy\034\264C\211^\247\210\234\r\270\254\225\374,\032L\337"
+	.ascii	"\005\344\364\243\351w\330\036<pP\247\236\301\344q\267\204\336"
+	.ascii	"\361\031\264\0379\201f\232\370\202R\220oN,\007\334\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\340\001\335\t"
+	.string	"\302N.1`M\222\0160\f\303\241\037\261\254Bw`\222$\241\021\364@\213\202!\230\255#d`\327\030\343,\300C\017V\020\210\351(,`\023\275-B\244L\001?F\346\342-\276\002C\321\326\226\234\220$\236\207\204F\273\372\021\017\001\3650\017\357\360\r\237a\370\205\002\202\001\201\256\316\246\35374]\224W\370\204\037\341\245?\370#E\216\220\021\244R9\362>\236\362N\243.6TUU\3651\306\222\233\327"
+	.string	"pXBd\024\324c\321\317KH2=\245c\2328\242\f\026\320k=\210lc\b\r\346\260m\371\311\323\366/mj\023\017\204\214\262\220Q\334\302\023y\332\326[\344\227k\0227 `\002\221sU\036\020\341\013\027'h\013\271\217\337!@X\227\023\205\216\344\336W\n\246\257\362\333\344 \025\271\210\344\376\261>\221\374S\271\315\242W\303\216\2138,$j\253\224&v\306qa\304\326\257\2600"
+	.ascii	"\301\275\320\242\007!\263J\221/\025\033\300[8\351\261\225-\354"
+	.ascii	"\366\022y\345)\360a\331\3335\274(\304\023\353\n\351\212G\002"
+	.ascii	"\355\016\305\036w\350\215\253a[\264\352\255\321\362\202\017\001"
+	.text
+	.section	.gnu.lto_.pureconst.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 P=\002"
+	.string	"\002\305\020\032pW\351\255\036\316\252\252\252r@\250J\377'\273u\3339\301\367\241\212\363\262\003\223\260a0\0053p\001\267\272\324\235\256\364!\372\240\373|\316\327|\314\\\2462\223\211|\3074\276\342\022w][fV\b"
+	.text
+	.section	.gnu.lto_.ipa_modref.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"5\006"
+	.ascii	"\342\207\027 \220+\303\001\377w\315\377\377\377\377\177\236\373"
+	.ascii	"\276\033\376:\372\376O\223\330F \237`\311#\224d\nj2*Fw\321b\205"
+	.ascii	"2Q7\327n1\236\315\303Y\242[\357\342E\016@\024\317\304\200\307"
+	.ascii	"\020;\350\t\275C\t\257\261%\275!\212.\350\272\3519\355\324S\275"
+	.ascii	"\222\236\207\247S\007\002\327\t- \200\202!\252\343\001M\034("
+	.ascii	"\270;\315\244\252\2348yw\306\350#XN\330\236\315\362\226\0306"
+	.ascii	"]\351\355#\027o\033\027;V\330\240\f\r\222\373\026.\342\022!\345"
+	.ascii	"\242\213x\340\220E\307\200%\313\020,\341\326\255\277\204cz\r"
+	.ascii	"0\306\300\342H\210\235\316\300\233\266e\314\304p\003\241\002"
+	.ascii	"\001;\205\t\241\r\265(n"
+	.text
+	.section	.gnu.lto_.lto.4b5657440d04b79b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.82.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 \235\245\004"
+	.string	"d\bi"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\305\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\006us\250\305\006uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\024?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.84.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 7\205\001"
+	.string	"4\002*"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001#\177\035\001\003?\202\210\200 }{\276\001y\275\001w\274\001u\273\001"
+	.string	"\004"
+	.ascii	")\"/\001Rn\031@\021"
+	.text
+	.section	.gnu.lto_customMotorMixer_Registry.88.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007\\"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\317\221\031\006yw\250\364\005yu"
+	.string	"\005\001\006'\001\200\001\005\001\006\035\001\b\0048sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.string	"B\b\021\346\r\240I\310"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_mixerQuadX.97.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"E\004"
+	.string	"\362\305\026\"\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\253\006\226\341\336TTJEB&4\023\300\023lX\261\022w\222\0017\344\310\226/s\fG\005D\007\367\344\037\035jc\360L\256\3217-I\360IN\321+\f\260 \260\232\2017r\207\376H(\006\273X\007\006\275w\251\355.\302\352\276;\n\022"
+	.string	"5\003\303\237\301\310R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306\300h\220\305\200\004\360/u\030\006P\212\234\027"
+	.ascii	"\203\3471P\004"
+	.text
+	.section	.gnu.lto_mixerTricopter.98.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"-\004"
+	.string	"\244\005$\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200$"
+	.string	""
+	.string	"\200\254\325\252\001\204\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\002\244\304\001{\303\001y\302\001w\301\001\252\311\001{\310\001y\307\001w\306\030u3\312\0014\305\001\300\001\277\001"
+	.string	"\020"
+	.ascii	"5\002s\237\341i\b\b\335\200l\034\214F\016f[\bC\347\203\311x\006"
+	.ascii	"\022\203\340r\276\206\363e\234\030\226\300\007P\004"
+	.text
+	.section	.gnu.lto_mixerQuadP.99.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"]\004"
+	.string	"\022F\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\027\266\241\343\275\r\377\377\377_\327\300H_\377m\242\221$\003=\262\344\313\230;\205C\204\203\307\376\334 \274:ck\356\r\316\241\326\304\246\334\025\334\022\035"
+	.string	",\335\260\035\367\003\207 \022\202\\L\006E\333U\235\355\2422\247\301Rog\004\021"
+	.ascii	"5\003\217\237A\327\032@\331\007,\326\342\003\223\001O\300@4d"
+	.ascii	"\200U\001)4\200\251\300\001\246\020\352%9-\006\317c\240\b"
+	.text
+	.section	.gnu.lto_mixerBicopter.100.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 \275\375\002"
+	.string	"\004\004\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\202\200\200\204?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\013"
+	.string	"5\002+\234AN\005\276~\360\242"
+	.string	"\230\300\205\2343\205\022\fGD\226\023\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mixerY4.101.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"}\004"
+	.string	"2F\027\"pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\227\221\006\213\373^\377\377\377\277j\202\231,\336\203\372$\311=\262\344\313\230;\206C\005\204\347\376\340\240|jgn\r\276\3119\222\232\334\024\274\222[\032`A\340u\343v\340\217\034\222P\f\330\":\264Y\253$\306\242\251\255\"\274z;#\023"
+	.string	"5\003E\234\001\314\347\260#<\204q4\334hlL"
+	.ascii	"\363q\325\031\214FC\0260\037\305\216\300I0\007P$\347\273\270"
+	.ascii	"\347,\213c\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6X.102.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\302H )pO\032\003\374W\202@\216\253v\362I\257\277\376\372\370\277\256\377g\2224\350\336&\377\377\377\327\217\370^,\251D\034i;\311\273\344\311\2303{\376<\232t\352p\313\220(\250\344\335|Eg\305Kr\323\374DG\305\250=\220<4\347\350\"\200F\276\231s\350\035\314\325\275b\255\031F\221W\346\026\372e\333\340\202\300p\207\3741\207\320#\212\305\24022\304\356>\356\272\373\264Z3\302p\337}\215\036"
+	.string	"4\204\200\202y]\373\002\376b\\`2@\013\370\007\006\203\241?\307\031^\340"
+	.ascii	"\254\013\003b\215\301\335\024\300I.\224\341\005\202\300\272`"
+	.ascii	"\300\301<4p\001\376\222\204ar~&\224\006\226#9-\006\304\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_mixerHex6H.103.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`{\001\315\005"
+	.string	"\"\210\035&`W\032\003\017%=\202\222\237C-\016\271d\031\f\243#\t\021wi\221[\024E\313"
+	.string	"h\244\240\200\307\375\261\223\f\371d\312\2315\177\006M\272\264\n\361\353\2600\254t\326\336\202\273\264M\372iG\301S\232\013\351\242}\203\217"
+	.string	"\033\235\263w\340\236L\013Tt\313~\201c\336\003\301\357\207\016\331#p\t\243A\210\016,q\314tY\214\330\226\231\256\360\3133\235\"\033"
+	.string	"5\002\303\237A\303R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306`t\035\262x\216\004\245\007.`\004\232\f\200\362r"
+	.ascii	"\332\001\346M\205\031\f\355\004\0130\n@\021~,e\005\216\340,\212"
+	.ascii	"\017\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6P.104.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\202H +`u\322\0300\f8\021\344\270j'\237\364\372\353\257\277\202NB\002\217%\230\277o\035\202 \b\262\346Bc\336\b\240\340\217\264\235d:\345\312\2327\203\016]\332\364\n\361\353\2400\260\366.\336\222\273\262O;*\236\222\253\262\355\211\366Q\234\223\223\002\234\275\023\367\310?"
+	.string	"]"
+	.string	"\226m\230e\277\3041\362\f| \030\016\331#q\211|\262`\020\246CK\250\352kpO\325\267\315\251\025\206\272\352{\004!  C\232\352_\005\264\346u\311\003I\005\220\315\270/\nH\237\317\f\201\001\315\372"
+	.string	"\257"
+	.ascii	"\251p\360\026\200\335\r\3046\203{\017\2241q\230f\276\030w\003"
+	.ascii	"B\363\200\2575`28D;\341Y\316\r\231\203\203\003"
+	.text
+	.section	.gnu.lto_mixerY6.105.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\253\001%\006"
+	.string	"\202\210\037(Pe\2451,?\324\026J~\016\2658\034C\327m\273\231\004\b\351\243m\323dfff\334\311k\032\202F\264\207n;\311\272\345\313\234;\213\036}\0325Kq@\202\201h\355.\370+\016pjW\301\273\370j>\322^\202sq\2236\003\236\375\003\007\305C\252\372\266)\300\354\031\270&\276\231\330\204\301\330\222}\002\247\304+\rGA>\262\305\326E\016\334R\365iRf\2061]\365A\002\034"
+	.ascii	"V+\340D\313\204\034\031<P\320\007\223w\327g\20010\364\300d\001"
+	.ascii	"\0240.\f\314Z\006\336f\311l\357t\006\016\360\017\f\006\206\036"
+	.ascii	"L\206t\2100\247\267N)\013\312\340$7g\306\200\370\001\024\001"
+	.text
+	.section	.gnu.lto_mixerOctoX8.106.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\266\002\305\006"
+	.string	"\022\312%1P\253\322\030\333\266m\333\266m\333\266\215q\333\006\264m[Y\364\237e=\231\031\254\033Il\222$\233\231\231\231\211\210\362L\353\323\256j#A\204\244\035n\320\332\245M\007,\260\301\0073\334\260\304\023cT\356\240\\\3262r\r}c\347\210S\344\025\272\305~\021+\207\374A\207\330#\240\205\220'\350\n\373\002\214\217\201\234@\337\366\002x\235r\224\236\332\001\260P.\322G;\tr\004\373\232\223wt\317\376\301d$O\223Y`\334~\316U\360\275l\362\345v\316\332\004$ \300\243b\341e\002\316\315{\252\310\227\240\300w\214\215\236\305$\3707\230\321Y(O\t\377\006\033\232((\360o\260\241-\221\t\354\376\300:\203U"
+	.ascii	"\361\241C)\364\337\314\030\361\003(\002"
+	.text
+	.section	.gnu.lto_mixerOctoFlatP.107.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`z\002m\007"
+	.string	"\262\212'0PO\323\030\017\177\322A\002\t$\004\205\005\027HI\237\355L\355f&\005\331M-I\322j\316\314\314L\331`\340Y\225\334\2526\265\254\233\bI2\370\301\331\f7,\361\304\027c\334\261\307#\223\214\302\271e\3639K\311U\364\225\235E\272$\337t\223\375\244\202>r\020=d\027\251\242\214\\C\337\3309\006\036\266I\226D\221W\350\332n19\344\017:\304\036qQ\by\202\256\260/\\\306PO\023\344\005:\266\033"
+	.ascii	"\004d\234\300\353X\316=D\204\264\035\"t9\3674O8b\344\t%  #)u"
+	.ascii	"\f_\0054\363\332~$[@<\350/1&\016(\363\024\031\243\347e1\360@"
+	.ascii	"\004a\367>3\204\201\224A\220\234p\335\003\272\301\371$\\\\\267"
+	.ascii	"\201(\031\3705\220\354\003\240\\&\307g\205v\3027\311\013?\217"
+	.ascii	"\361\""
+	.text
+	.section	.gnu.lto_mixerOctoFlatX.108.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\316\002\305\007"
+	.string	"\242J(3pM\322\030\251\336e'I\222$I\022C\036M\036\033\36281\302o\2532\005\324\225w\262\266VJR\376\377\377\257_\235\017\207\374\366\367\032!\215\220\264\003n\203\255\025^\370a\210)\2568c\215?\006\271\204\263\312\246\263e\222\237\350({\312!\271\210>\262\223D\bm\344\034z\307\356\001ad\221k\372\305\216\001\241%\"\227\320\263}\002J\fy\203\216\355\016q\272\362\003\035aO\210\2271\323\322\002\371\200N\260\027x>\231\027PQ\032"
+	.string	"Fm\333\n\314~\316A\361\275J\263\344v.\272\002) @\303\022\267\001n\"\220k\006\240"
+	.ascii	"\034\f\222\255 @\320\215\030\214\304\327\200\204\336\317\fa\003"
+	.ascii	"\305d\240\363\r\b\214\\\303\177\203\035\332\217\270\375\331\313"
+	.ascii	"b\355\016\315'Z\002\273\036\210[\006\035\241\353\027\300}O\326"
+	.ascii	"\331d\025\276\007\217\350\314\030\361\303,\002"
+	.text
+	.section	.gnu.lto_mixerVtail4.109.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\265\005"
+	.string	"T\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\004"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\244\240\270\275\224\204\304\001{\303\001y\302\001w\301\002$\244\312\001{\311\001y\310\001w\307\001\204$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\033"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\230\017\347D\351\021"
+	.string	"\005A\f\007S\347E\0178@sR=\001 \201x\201\036<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerAtail4.110.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\225\005"
+	.string	"D\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200$"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\004\240\270\275\224\304\001{\303\001y\302\001w\301\002\004\244\312\001{\311\001y\310\001w\307\001\244$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\032"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\360"
+	.string	"\020\204\323/\347\032S=@\0173\300uR\021\0016\001sA\031<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerDualcopter.111.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 \275\245\002"
+	.string	"\324\003\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317\002"
+	.string	""
+	.string	""
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\244\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\b"
+	.ascii	"g\020\260 \257*\f\261\324gY\204\344d\030<\217\201\""
+	.text
+	.section	.gnu.lto_mixerSingleProp.112.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\344\002N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\bu3\277\001"
+	.string	"\005"
+	.ascii	"k\312.\025.\216\340,\212\017\240\b"
+	.text
+	.section	.gnu.lto_mixerQuadX1234.113.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\005\004"
+	.string	"\022\306\026!\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f+\026\005\177\023**\245\"!\023\232\t\340\t6\254\240\374\235d6\344\310\226/s\fO\005D\347\366\340\237\\Z;\346\316\340\232|\263KI\356\tN\311+\273\200\005\201\241\031w\003w\344\217\204b\240\213\350 \255fj\251F\204!\333\354)\016"
+	.string	"ek\300\201y\360\261\260af"
+	.ascii	"T\300?0\030\030z`2\300\b\352\200\r\311\211\032x\023\003p"
+	.text
+	.section	.gnu.lto_mixers.114.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`D\003e\017"
+	.string	"\224\026\020\004"
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\204\005\177}"
+	.string	"\005\001\006\035\001\004\005\001?\202\210\200\030{y\275\001w\274\001u\273\001\005\001\006\025\001\032\005\001\006s\035\001\003\302\001w\301\001u\300\031\002\305\030\274\027\234\236\274%\177q"
+	.string	"\275\312\026\301\025\274\236\264\245\037om\317\024\023\254\245(ki\006\325\324\022\250%\177g\330\021\274\020\240\245\037ec\301\335\017\374$\340\016\274\236\370\244(a_\b\344\343\r\364$a]\347\f\360$a[\352\013\354$kY\325\355\n\350$\177W\275\360\t\274\236\344\244\363\001\340\244(kU\365\007\274$kS\325\370\005\264\244\037oQ\305\375\004\274\236\260\244(\177O\200\002\003\234\236\254$\177M\203\002\274\236\250\244\037KI\206\330\003G3\210\0024\207\002\205\002\204\002\202\002\201\002\377\001\376\001\374\001\373\001\372\001\371\001\367\001\366\0015\364\001\362\001\361\001\357\001\356\001\354\001\353\001\351\001\350\001\346\001\345\001\342\001\341\001\337\001\336\001\334\001\333\001\332\001\331\001\327\001\326\001\323\001\322\001\321\001\320\001\316\001\315\001\314\001\313\001\311\001\310\001\307\001\306\001\304\001\303\001\277\001\276\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.ascii	"Z\250\221\264#Fj?\326`\223\304i\003\021 $\323\021N\003U\013\007"
+	.ascii	"\354\022\200\214i0\023\346\2316m\245\361\240L\203i\224x\221\224"
+	.ascii	"\3757@\032r\003\346\222\363\222\3165\323\312iq\312a\201\377\032"
+	.ascii	"\365S\320\t\323\b\206\270(6\037y\017\275\226\210I\344 \t!Pn\006"
+	.ascii	"e\001\301\367A\362-\003z\377\347\331B\021\245F\361&\360\013h"
+	.ascii	"\245\036\001\236\215\350\370\f5(\205\200AW\203:\324)"
+	.text
+	.section	.gnu.lto_getMotorCount.124.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 \345}\006"
+	.string	"\362K-4@o\222\016\230\016\303?1\374\232\004\030`_\364\363\003\266\fm\336$\342o7{(X\204\364\270\212\276\307\031\236\002!\302\207*\035\207\347\312s\366\333'[\246s6\257#Qy\334\247\201\241rXp\017\225\202\307q^\204\333\blAt\236\373X\326s\232,\333L\330\006F\215\342\033R\221\353v<\001\302b\245.\bS\n\033"
+	.string	"\306\bO\237\211\260e|/\331L?\216-"
+	.string	"e%\201$\223tjI\025\352\304\343\017\275f\203\203\320W\263\r\022\206#\245b\204%3sM\243W\361\272\005\351\345\243\304\004+\211\212\031\204\314\034\261\322Eo\375\t\376\202\337\"\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getMotorMixRange.125.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 \367\305\006"
+	.string	"\022\215/4Pm\222\016\244DX\205\222\257\n\332Q\031\276\246\230\333\370\340Xy\374\305\262\2657\025X\005wX4\303\216\233%\246\210\025\334\302\355\251jw\366\321Z#[\246k2\330\006\302\342\274\316\202\202\305\220\360\032,\004\316\323`\017/3\360\345\260\301^\347\272\260g\331\262.\204\016\363q\022_\220n\223\256\350\210GX\255\324}T\225B\027`\361\301\322o\036t\030\337)]\350\213\243\273\214\224\034\240dR\224V\222\204\022\331\370\263\267\334\216zdO\2326\rQMN&BT2\363a*P\225\232z\251J\271\214f\305\354\366\243\023\307(E\003y\212"
+	.string	"\006\2319j\240\212\356\372\023\374\005\377E\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_areMotorsRunning.126.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\f\001\205\r"
+	.string	"\326\331\\D"
+	.string	"\221(\035\274\242|\242\030M\"Y-\212\200\376\274\307VG\374\240\006\203\212M\351\324\274\004\f2\243\246[\006F0\354\031\344\305\362"
+	.string	"\272\252E\264C\375}W\031F\335\200)rf\321\307 ido)S\nI"
+	.string	"F"
+	.string	"I"
+	.ascii	"\362\324\301R\221\342xt\001\354\321\035\007B\356>7\234\256\002"
+	.ascii	"SZ\275H9\263M\351\264;\\\355\374\214\007\f\261\302\204\311\023"
+	.string	"\035b\031\276\001\274\021\334H)\377]K<\222j\306CJi5y\030\356x\333\013l+\260\337\005\266\252\343U7\334\247nU\3653\006\\\234hP\211\331\027S\236Z4d\213\210\302\303U\177\352j\337\276\b\177\305\232\217\370\f]e\226\riJ\357\001\353E&\300\0367\037p=\302\013\270\036\362?k\236\3526\242\031%\226r\034n\211\215\251]\341\2437\351\356\212\216\240\205\005\207]\2247\256\270\377\216\265\220\210A\322\030\377\033\3277\256\265d2z\211\257D\374\016\2660\2427=\372#\313Iq9\371LH\264eO\221.J\306\nD\n/J\332C<\232\307#\342\340\303m\240\255\003\300\037\034\016\344\202\326\311@\022B\264\t\0212\217\006\241\223}p\237\214C\300\033\005\020.\003m\033\227i\246\374\242\370\337\033\300\250Qb\351\337]\206\253\273\336\031\037$\214\013\311\216X\340\242\374\22538\321\n\026"
+	.ascii	"r\b\370U\323\240\006\226\342r\016\254\336\025\201\0232\343\032"
+	.ascii	"\215\220b\202r\315\020\204\b\200\212}\013\007\200\tX\255>\214"
+	.ascii	"\205D\021\035*\242p\227\0305\344P\223\267\253\224\001"
+	.text
+	.section	.gnu.lto_mixerIsTricopter.127.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"m\007"
+	.string	"\342M25`m\322\001\300\216\002r&\0038\365R\204\234o\243N\257\340=o:\260f\321\261N\325\256\2060\024\274\265\b\032d\f\031^u\rA\032\005?\221l\"eJ\001\266X\360Rqa^\346\301\341\202hx\021\027\003\346Y\340\304\263\b\214I\\\340\313`\030|U\334O\253\"\325\002\217~\234zU\275v1\220\277\206rz\275F\372\\\344#\215\357a\212M~\273\3637\324\235\323"
+	.string	"\fO\226\354\330I\325\260?\255\212\354L;\2475}J`t\262\200\262\013*\255\254\211#}\330\346\330\225\021\0228\316\0369@\357\310\320HTv\343\323\215g\317\314\177\310\035HI\312\026\352<\001\024v\327\271\205,n\275m\003\333\007\266G\002\r"
+	.ascii	"2\241\215\037X\307\304\2028p\231L\242\021*\020\327\3045\004\225"
+	.ascii	"\237X\202\345p\315\231\204\371\004"
+	.text
+	.section	.gnu.lto_initEscEndpoints.128.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`V\002u\022"
+	.string	"6avG\300\226M:R\201\033\265\207\034\003\347\301\257\260\\\177\233\324\254\267\032o\312d\251\233\373b9\361\217\250G\264m{\027U\210\212$t\026\3513_\245a\276& r\233\351 n6\304\275fw`\362\212F\354&R\246\024]"
+	.string	"Y"
+	.string	"f"
+	.string	"\021\220T\376 \253\370@\257\301\272\3145T\213\004\213\216\222\013&\273\233\340\321.\250\307\226\257\234\036\271\0178=\232e/}\306b_\364\263Cd\333]OW\234uN\223\345w0)\260X\353\234\211k\200X\016\327\262\273\017z\362\304^\231\035\314\356:a\261\022w\274m\006\266\037\330\031#H9\311d{\303o|\250\335U\340\023\201"
+	.string	"Q?8\247\307\324\024\331\205>\204\343\377\330\203M\036\366\350\333\234\036\257\235\317\221\223\023\256\274\331\263W\252\217}nw\327\332cw\227\3351\2469.\255\232\316L\037"
+	.string	"K\323\221\nKvG\334\2326)\366xq\331o\337!>s>.|v\036\246\305\026JR\324\276\3035\f\246\231vz\214z\033\327\221rybc\002\332u\035\346\027=G\214eRyXjF\225\207\031\301R\323\242\320\026W\273\n%\241\331z\301\355\326$g\327u\200\323N\325H\007\306+oV\345\264\200\221\016\223T\325\323\030\202c'J\356nK\325\307H\376\235R3\f\005\246yY\201!\370y35,\241\352S5\boj\302\033\007+0\004?\001\226yY\245>\250>/\244\231Qq\320\340uP\305|\236\314\312\306{1`\260&\265\362B\020\\y*3\327\271\325\036?\311\f\021\332\351'c)]\373fT\036\tP\222\\\372b\262\t\030q\rBGT\304f[\311\317\216Dd\202\220 \024\216\200X\370a\032*2 \220\002\231"
+	.string	"\311\016\3714X\017\355\331\020\\Q\330\303\206-\027\367\334\300\26151\021P;f\263\341JN\335\222U\362\213\2606\201\037\204\261\t\374 \214\274\263\302 \002\235\021\234\350\307\030\271\244#\245\225\303b\245,\336\206\315\036\317\366\025\347pZ\244\232\216\274\234?`Wl\234\005\332\343\307E\260\301)\303>#\341\266"
+	.ascii	"2y\300\322\345\266\353\351\001"
+	.text
+	.section	.gnu.lto_mixerInitProfile.129.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\326\001-\020"
+	.string	"\026\\dE\360\262&\035R\361\241\272?\265\223\247I\332\374pA\"i\264\265\321\312\255\212\232\306\3060\016\373\262\322\327m\301\030\342cR\f\323\215\262]*\003-\262;\242\316\227B Be\237\371d|\367F\b\331[\312\224\002O"
+	.string	"H"
+	.string	"R"
+	.ascii	"\276"
+	.string	"\210\200\032:\034\320\330\335\360\tY\234x3\302\366A>\331:o\205\330\333\324\270\320\274vwS\020?=B\315\223\237\225|\270\256\345\261\303!\250S\245\002\3502@\003\273{\025O\r]*3+\331]'\327q\270\261\333f`\033\201\235\n\0020,\330c\352'\346,.\303RJI\301\036\257\031+\007\210\007\317v\036\360W<\306\236\017c\025\273\362\334\243o\027\366\230\375\310A\361B\345g\267R\251,\373p\365\305\216i-\246\263\230\306b:\3024\324\264f:\237\001\2579\246_\221H\345g\250Q\343\214\325\216*\324\273\f\361\203\307\200\240\355\252H|\233\3030qH\224\347D\330\243\252\310\211\036)\274\3378\200j\027\365\302\336\211]\221\245\363\312\335mQ\243`\251\021fv\2502\210\355\321iP\264\335%\361[` i\001\016\215\230D\027F\244me\302\311\210\202\204\255\302\310\204\264\205L*\333\310"
+	.ascii	"\227,\210L\333J\251d\332@-\324\341\352\213\027\330\300Ai*j*\003"
+	.ascii	"\366p<\037x\310\264\022|\237\217L5%\200cU\"5\323\233\310\341"
+	.ascii	"b\265s\250\254\250\005D|370\365\032\330\245=\034O\324/ @\002"
+	.ascii	"c\210\261=\223\320r\304\270\023*x{c\266\021+k\244\314:R\205#"
+	.ascii	"\202\302Y\004$\223\356\210c\030\200\211o\204e\3102\203\3079\347"
+	.ascii	"\262n\255o3\345m\t Z7\240\033f \300\262+\214\366\020]#\004AT"
+	.ascii	"M\214K\263\341\024\211+\f^z\272\321b\367\364l\326\212\305\210"
+	.ascii	"\260\261\373:Dh~\036\345\232bT\234\336.U\006"
+	.text
+	.section	.gnu.lto_mixerInit.130.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`H\003\305\027"
+	.string	"\326i\224I\300VQ:\024\320\t\245\270\363\032\260\341\274H\177G8\313v\276\232\315a\322\361_\004\200\300\363\263\325\330\177\275 \224#*m\244\036\025\"\260\257n\214Y\022\255\354w\327?\322n\036\304,\220>u\343\333\2364\262\211\334)\005x"
+	.string	"y"
+	.string	"\202"
+	.string	"6\221\315:\235,\333\237\366q<\207\355\277\"\253j]\201#H\255A\005>@\236\326|f<\025\017`<\265\315\206z\360E=\020\250\335\322\260\326\032[\027\267=5Rq\247\315O\341"
+	.string	"\257\342\365\214\236B\361\221\325\323M\352\352\355\304\232Z\353\205#\246\210\364\025\021D\t\311\342\352\345\304\231\243\030\274\003?I\364ps\246pj\255\236\274\236\211\233\274m\021\266\027\330[\"KO`\243I)\3515\355\036\331<\317\263\b\226'\334\032y\327\367\361\037E>\f\373\314\346y\263\361\224>\351\242\224\3426K;\210\233\353\263/\326ma\257\246a\253i\231\325t\314j\372\245\232v\221\3230\251\351\3268\315\242\323+:\255\242\323\2448=\376\367o"
+	.string	"\232\024M.\224\265\036\225]\352\023u\222\341\363\370\322\320\203\336\023_n\f\331\327q!\321\203\236\320cx\032J\277;\031\226\253\365\226$\202\231\250\017j8\274\315r\326Z\215\350\316\330Z\r\027Z\302\217\354\220\265\326\033\337\310\017\005\037F\320x\332Z\325\357CN$\250\002\017\317x\312\332\224o\212\226\244[\223\355Y\300\027r'7Y0\223\231\306\323\013o"
+	.string	"\313\224\033C\021C\253\b\227\277\330\022\025d\rb\\\355\201\237I2\254\354\210\222\233[\254ZrW\373\035\222"
+	.ascii	"\325_4\216K\356wN\270Y\032\310\270\017\262\r\264\034\225{lj\262"
+	.ascii	"\0203\240\230\320\217\317\254\003\207\230\207Y\006\240XO-(fC"
+	.ascii	"c\332\007Y-&D\243\325b\254\340\355b\335\026\300\223HT<\335\026"
+	.ascii	"\227\202-\024\321\013\257\n\013)\302 \203\262\274\"\263\260\035"
+	.ascii	"\240DG\243\2652\373\032K|\214\353{-\201\030\345\216$1\353\244"
+	.ascii	"\201\231\326\013\257\312^\311c\366\272\031\256}-\035\242\213"
+	.ascii	"\202Y\327~\367\3456K\007o\362\200\2545w\3433\371\023\204\034"
+	.ascii	"\035\235\361\024f_6\250\004J\250a \006\225B\006\032\032\2310"
+	.ascii	"\005\005\205\351p\002\221\271Q\017\021\320=TC\005\315v`xy+y\240"
+	.ascii	"\237\202N\337\360\262\3110\242\370\2425\b\001\212\205P\305\355"
+	.ascii	"\320 E\307yQ\030C\364\356\320\256ZF\250r6Y8\030\020\002\020\220"
+	.ascii	"l\227Q\221\3531\006\256\320\360\303\327o\315V\354d\302\247\020"
+	.ascii	"5[s\037A\370\222\212J\"\033!\022\327>\031$\303J\022\244\253\227"
+	.ascii	"\206\016A\365\242e\275\213\324\344\003\316<y\242\265\374\202"
+	.ascii	"\375\202\260<\002a\ri\022\033\376\241<\363\n\262z\327\265f<\005"
+	.ascii	"\355j"
+	.text
+	.section	.gnu.lto_loadLaunchControlMixer.131.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\t\002\235\020"
+	.string	"&\235kH\340\260*\035\270\007\032\264#|y\327\351+\374i\215\241\234\257\255Q\214\211"
+	.string	"\177\240\177\002\313(\0335/\023\247\310\260\265\267S\007\251\331\321\243v\207\031f\230A\np\020\237\3452\\J\231\367jP\247\243\021B6\331;\245V"
+	.string	"R"
+	.string	"Z"
+	.string	"\024\204\305\177\345\rN\324C\260~t\242\374\230\023\310\351Zd\352\341\027\272\270j|\220,\337\210g\207\303\313\317\026r5A\017\022\257\327\r\377\276\220\034\0177>\310\013_\b\206\323"
+	.string	"\"Y\223\276\274\210\216\256E\276>C\005\273\353\331\"3\334\342m\273l\213\330sA2(\215\331ej\216xVF\230\276\330\237\317\356\371\351{\204p9\244\235]\f\275\035\213SiD|v\373'\374\322\240\243\270\f\365\231ob\312%\326f`9vw\344\325\007\304\327\001\007"
+	.string	"\276~\007\001_\0172\312\306\361\022f?\323\201e\305nw\307\273\235j\366b\330`\200^\267\022\273\233xA\243\361\321\230m\263=\013\234\232h8\326\354\261=\341.l\013\201\331\335\004-N\002^Y\234~>\330\360d\265\223H\346\304N\271\212S"
+	.ascii	"\033\273;\362S\234F\301\017\361j\013*\363\255W_\245\274\001\035"
+	.ascii	"6\036\215j\366h\315\205\027\244\233Dd*\251@2\031Q\0368 Ah0F "
+	.ascii	"10\031IL'\243(\344\222\204\022\323\210R*\231FP\271\247/1\027"
+	.ascii	"of\340\250\350*\2441\2077\365Cin\216|\322\026\337\300I/\243\345"
+	.ascii	"X\263\347\337\356.\210\340\223~h\212\216n\005\266\232\275YSK"
+	.ascii	"\277\331\324\310\334\002, \300\202\241)\333\006q\201\375\356"
+	.ascii	"H\227qR\356\262L8\037Q\004\277\265g\251!\005k\033\217\343`\202"
+	.ascii	"\372NR\f\356\203u\bN\245\206\365'\313Y\006\344\020\026s,[\305"
+	.ascii	"B1\226Cf\032\223\304A\326a\313\223[\335\tkN\332\t\256VN\210\237"
+	.ascii	"\031\0327\334\001\221\206,\3377z\335\316\005\311"
+	.text
+	.section	.gnu.lto_mixerConfigureOutput.132.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\303\t%3"
+	.string	"ZU\310\022FP\036R:\021\374~A)\322\026n(\340\272&#\361\223\272+,\3448\326\307\326\204\304\232\305\325\314\bF9\247\021\207W1\274\263\b\221<\321l\200\001\340("
+	.string	"\364\322\204\322\3705\036\026\265\276\355\023B\310\336I\006\031\001\n\001\033\001O2\035\375/\207\366\323Z\350\005\271\343\317\026\241w\263\276\227\376\331\273\3548Z\303\375\252\270~jm\315\274\367}\215g{\301\357\254\322\211\332\263\353\207\332\263\335;\272\205gY!\262{z4\261\367meY`\250\357\373\0363\223\240!\267\177_\321\336C\026y"
+	.string	"CBDAE \342\360GX\024\004\376\334\226]3F\366]\t@\255e\325\001\214\215q\202\207\236\\\350\311\211\240\2445qP\223\027\305\016\264\036\230\343\022[\007\244!\301\304\325\345\001$\312\235\366\362\336\356f\004\017]\ta]G\376\203\233\\x\253#/Z\207\212\260\325\335\355K\r\352\2540\243\340\340\222\222.\346\201s\\\314\"\370\267\272[\\u\237\343\372Z\235\354\324a\236\215\007v\251\020y\273F0#kB\\&\327\374EM\315\331\276T\205\353\013\263+\203f\033!\237\343\362Z\211\340,\301[\177D\236\211K\254U\351}\337\227\035+\227W\030\273\022\336\367m\254\265\354z\033\275\373r\272\273B\367o+a\350\252g?#W\267\206\315\316\016P\366\377p\002\275\303\302{'@\006\365ZW\343{\305\306\257Y\331o\264\252#\330\n\223\346\266\321\346\234\002*\305\302{\215\363s\316\317\022\""
+	.string	"\033\335Dk\224\237\237\365v\225\346jL\240\210\212j\317\032ea\230\\\325\353Rm\377\355g\244\372c\275b\n_k\252=\313&\343\250y\254p_7\332\025\316\316\356;\331IN\351\f\326\255\300"
+	.string	"\213\273\351\3207\323\322\327\336J,\356$\244\243 n\243G\337E  nb\213{\350\342\376\371\341\026\376p\007]\334\300\026\367\257\305\355\266\270[\0267{2\357u\305\235W\334x\305}\007GypZ\314y_ }|\3367\354\233\224C\377\265?\372\223\371\332}\267\026\"\311\264\331\345\261C\350\2508\336\326\300\344\034\262\356?\373l \360\304<\251b\276\326\037\243\206|\227\021\370\334\236T\035\1776\253\345\331|\206\351\253\351P\302Bc\342s\013k\233\222)\314\300\374\223\237\274\362f\323\006\2630?Y\245\230\203\371n\267\3205\215f\365\261\302}\271\245b`[?\331\331\2305\036\273\306\343\241\361O\373\257zf\0324^AV\266\360\303\245\236VQSh\201\231\n*\235p>\024\020\330\361a \262\333\003f`\232:\325\340\365Nu\223S\262<@*R\342"
+	.ascii	"\263\263\245\332_&\220\245\0164\356\247\007\323\035\317\205\243"
+	.ascii	"Xww\370\035\fHb\357\213\345\224w;\031\326\r\034Z\016\355\331"
+	.ascii	"\237\261\216\316\2263\241990\277\354lf\213\224{\315k\006\312"
+	.ascii	"\312\206k\201\362\247P\351\377\351W\2258n\203\003e\244\374.\274"
+	.ascii	"\250\233\351\\\353\316\245\3326\273\371\311\246\264\315\307,"
+	.ascii	"\317\246\231\327\313\330\315\241{\"`\327\217s9\036\240\360\265"
+	.ascii	"\240\332\2639\360\366(\231b~(\251m\210\356\306Ml\276\022"
+	.string	"\350]\367\207\277\t\241!\313X\363\371\276X\020\036\355>q\271'\267\351\343\311\346\371\276\257\223\233\307\215\350\217\235m\022P3\362\331\276 \315b\352\035\365\200J\352\306\324\213c\r\026+\246\\\2508\302\230B\361\342\030EE\343\370`@\307\220!Eu\254\021#\006\325Q\210f\365\f\326e\257 \367V\363\254\362\025\200\354lw\215\320R\316R\"\343\225\224\206\224\362R\316\301\247&)\177\255\033y\206\223t\324\250q\023#AZ\301\202\324\202\324\3226\376\302F:\212\334\322e\336e\332\263I\371c\216\313\314\360\204\2102X\257)\032\310\275\n\025d\246\254\234\236)\377\f*\375\372\276\357\033\304\224\r\344\034w{\222\315\253\342\007\354EdH\0308*\325\n\367\005\351Z\n\207\300\221Q\271\260A\347\200\262\263\243M\231\n\332\346\320F\226\341\255\216\036\020{\337\027\302\217\247$;\037M\031\030\206\246z\246\365\364"
+	.string	"\3678\264\033\311\005g=\025H\"\315\240\322\236@/Z}\313j[U3\304\354l\241\364\347(\263\322\"\343\213YY\314\304L!n\230\211\371Y}\2540\3260'\335}\017\027\246\327\260\230\217\362\237S\265>*\220]\236f7\326\335%p\325\023\022~\003\200\322\250\2010\304\030C\210hd$IRI\007\200\002\221\251\272n\021p)d\254D$\315\262\033\001\362\207\301\357\3778\024\3729(\021\035\237\255\272\203\270Q\263F>{\3762\273S(\266\013i\034.\331[#\325/D\270"
+	.string	"UZn\321H{\177\030\032\263\025\337j\333(\3053\"\330\360\201\264\235\352\370\017\273\323f\272\315\205\231*\001E\217c\026p7\356)5g\371\002NQ;@e\221N\032\204:\337W\215\260\215ld\350\222\375\254\347\020\"\252\3161o\275\317"
+	.string	"\257\342]_ \035/f\357\317\037\342>=\214\345\234\371\261\321\331\22409P\341\305\344:\313j\365\227\260\033\337B\361Q=\307\222q{6\370S\177\300\2365\243\313Z\261b\261e\250\237\372\231"
+	.string	"\005w\261;+\244\227\343!\016.\222FJ\307\323"
+	.string	"\353`\241\222\316ST\201\n\250\030.\024\242\355\300m(17\236\234\267\245?X\313\005\326E>\247\241@\332~\323\335\311\304L\375@\240\310V\023\324\236H\024<\305$0C\334(\226\r\2274\323Q\223E\022Z|\201e\342!\020\366x\204]\203E\t\256\261\253@c\312\272?,\037\265M\202\210\255\032\001\227\326\024\374r\025\247\343\335i\334y&"
+	.ascii	"\026\017\246\335\005\336`)\363\260\006\300M\204\357\323\261\322"
+	.ascii	"\201\"_\243<\035A\245\353\304\031\005\301\003\001\020\032\270"
+	.ascii	"\304\356\027\310l?5\334\016\267\013\222l\333\357\t\367*\324\351"
+	.ascii	"MN\206\004A\204\0244\244O1\343\354\003y\330\314\021\310k\220"
+	.ascii	"\007\270\177i\216\265dC\360\037"
+	.text
+	.section	.gnu.lto_mixerLoadMix.133.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\236\003u\032"
+	.string	"&\261\252I\260\226Q:$\362\351 v\332\254s\002;dc\b\211\376DO\020\177\035\222O\217\333\260H\240\363\301Vn\256v\253uFa\363\202;\360a\3357\322~\330\177r\340\024\216V\257\021\030\311G\321G\316.\372\204\020\262\345N)\225"
+	.string	"\212"
+	.string	"\230"
+	.ascii	"\265\272\260\201TkmY\001\371\320\300]\304\207\364,\361\241i\266"
+	.ascii	"\223\363t\365GQ;\276`\255\325\2650^\276\034M\236\362n\272\264"
+	.ascii	"\223\243\230\n\351N\232\337\373\3641\262\001\201\344rN\322q\204"
+	.ascii	"\211\032\227\211\202Jz\321m\216+B>\027I\237\247(k\205\221\323"
+	.ascii	"\213~@I\217\n\272\300)\307\317{?\200\243g\305\f\351X\242\307"
+	.ascii	"\t@n\004\225\201\362\344\007\227\263M*\204\342{\242\317\"e\017"
+	.ascii	"\b$\207\342s\214Pk\365\344\311\235\270Wn[\3116\004{k\263\264"
+	.ascii	"y9s\203\354\313@\271\335\360\002\331/.\037\372Y\337\335-\337"
+	.ascii	"\375,\377\335\253\373n\325\247W\302\351\324\234&\351\364\270"
+	.ascii	"\323\342N\207t\232\316\351\335\351\271\323\037\360\240\251\005"
+	.ascii	"\013\032R\026\310\253&\312)\265)L\262\361\337\357+2\240\303\253"
+	.ascii	"\271\t\301\246\035\301\373\360\211|V\"sz\310\337Q\tUk\215y\350"
+	.ascii	"\007"
+	.string	"\344\303\251\262=y\357A\373\220\210\267\324\n\224\004\251V^\313.\362\241y\344\247\375\035\347A\373\316JN\005O\360\304D\"\265@ D\272\027l\277N\204\346EW\253\216\003\333\024\236\004\013\360T\253\216\f\322\207l\24051\361<\261}\3570@_\224]-\334 \217K\373\262\313d\306\\\2658+\211\252\375\256\307DgF\235\326Z+U\355\313\206xR\336\204 \260=\334\310B\n\350j\255\016\374 83\001O3D\210\017at\301\332,=\227\265\273\277\351`\271\221\210\337\271\277\341P\355\367D\247K\301\337N\225\332,w\177%\242\fY/8\313\266\354\276\250\322\003\022\265\260\005\260\317d/\034\230\204\232\330\315\354\303\314\n\347\205\301\006\026z\206\201\354\205\003\253q\335h\240\201q\310\340\262\201Y\250q\315\310f.\006\004\034\353\360\222\271nb1\231K\305\253_\240\336I&\241\246\332\332\310\rr"
+	.ascii	"\036\321eC\031\251\230\257\026\267r\322cJ\355\312~\247J\315\025"
+	.ascii	"\216\304Bk\t\006s$\265\255\030\273\332,?\227P\211\302\215\253"
+	.ascii	"u\331C\005\2017\322a\246\201\316\247\021\203\330\314\nl\023\334"
+	.ascii	"O\215\265\344\356\221\270t\307\377x\270\342j\303}\321[0\210z"
+	.ascii	"\300\337\034J\301\302&n\220\037E\250Q$\243\220\204\0022\023\310"
+	.ascii	"\004BcZh1P\002!\307\312<\020hg\233d\031\003\021\344Z\251`t\254"
+	.ascii	"-;\222\037m\343\313\b\264\244l!\226=<e\3610@\353p\345\242aM\264"
+	.ascii	"@\216\t\376W\354?\024\262s&$c\2105-r\003\320\376)\243\362\017"
+	.ascii	"FHo\274?\016\370^%Wo)\f\322\374\234\n\203\240X8\273\n\357j\007"
+	.ascii	"\252\221\305C(;\342P\240[Z\340uo\274\024\faj\3543\214\255#\\"
+	.ascii	"\271\006\2023\305\340\370\3528up\230\350\\\327\267\212\006m\274"
+	.ascii	"\204\242\002"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.134.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\t\001\375\f"
+	.string	"\246\230XC \257$\035"
+	.string	"6K\217\016!\021\221k\b{%\321\216\330\034\357N\351C\353\203\213$\305\210\217\3142L\267\326\230!9@\310\3559Q\233\251\020\200P\3012"
+	.string	"@D\r\006\242\274\220\365S\204\220\275\245L)C"
+	.string	"D"
+	.string	"F"
+	.string	"22v\367\322\016\266\376\342\375R;|\232\232\377r\003&\234\215\013\035\276\n%\245\205\006g\341}rp6<>O\270Q>\020*\327\307o\230j6N\345Y)\330]\347\306e\270\251\333\316lo\330\367\b\037\254+\366\273\356\316\247_\021\330aQB\332\305p\232\2616\020\205\313\273\333\037\341G{N\3420\332;\323X\241\024\213T\022\001cw9\016\215\300:,\360"
+	.string	"\324\341;"
+	.string	"\352\360\036k\366\213G\017\373\222\313\205Jb\2521\3410\312\223\257\266INrI\200\213\335\375\37027!\301o9\364\204\221\221-\206(O\366K<\306%\277\305%\236\311o\207\276g\364\361\007B\250\320\321 \312\223*\tE\347\204*\213\035C\371\3111\t\330\375\321\221\201P\300B.\221\006\f0\007\013\256\007\230G\310\365\221E\270:\006\030\004\001$\273D@\240\354\362\304\275\256\274\334Za\262\021\351\b*\213\253\024J\251\336$\307SOLC\245\036&\346\246B\356\374\355\356>'x*\025\027"
+	.ascii	"1\003\373\334q@\343\224}Yb\326|\210\342<\2042T\212\210\232\003"
+	.ascii	"1\366aZ\202v[\342o\233\030\272\220\301\352\364K\023\201c\034"
+	.ascii	"\276Q\366BU\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_writeMotors.135.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 \370\305\006"
+	.string	"\322\214/5PO\222\016 [\036-\367Ki\305\320|BMa\201\355\272\030\243\264\376h\333~\264\216\261zo\260\356\237\265\331\231YFUc\201\241\030\036\370\316j\237\020\231\002s6V\207\202\362\300O\003\003\345\260"
+	.string	"\037(\005\017\344X\021pCp\005\321\261\340\247\252,\250\321\262O\224\360\261\201\036\306\223\353I\265k\340%\023\324xQ:\222\270$\225\236\270\\c\245{M\225\276\342\3025\356Z:\266\214\227\275\226\271\027\362\005\310'\372W\340\341b\241\222\2711#\223\233\304R\362W3\3660\325F\262+#\215\224\230\314\204O\244X\035vkR\201\030\312\352\002\0202s\027C\034\375\3657\370\017~\220\b"
+	.ascii	"3\001K8\023\350\370\032\327D\262\020\360\313\020\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_stopMotors.137.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\375\001\325\021"
+	.string	"f\242vF\340\360&\035\303#\341{eb\336\357\003\203~\214\302\023\225\210\361\n\300\203x\327\212&q\276fX\230\237\261\366\334y\220\017\352\177\327\245"
+	.string	"\303\360\204\031\326\t\316s\030x\033\340\b\021\246]\273ul\204\220M\244L)`"
+	.string	"^"
+	.string	"c"
+	.string	".\3671W\003\247\345\"L\242\204z\264]l\324c\242\334\262m\034\266\263\217\301\230\001\312\261\273\236zpw\rvk\331z\3244[~\317\0234\305>\360\345Q\343bj>\004"
+	.string	"c\264\221%\031\321\303'\r\370J-\304\315\365\341C\230f\037x\363\344\032\354\256\363\0035\334\333m\257\330\016\261\263$\257T\035\373#;K2k\216\275\245O1\335q\017\2727MG-\235\232>"
+	.string	"\004D2\\p\354\326\314\230\026)\022\201x\320o\337\017\272\217\037\032\005\3242\b\flA\233\335M\235\204\017\364\0227\321\362\0236\352^l\2720\026\223\355n\352\321\n\272G\220\177l\217\332\tl-\366G\374'\237ib\361!\224\024\225j{\354\324"
+	.string	"\r\034mwW[\360M9=\007\246\231L\207W\316\034\365>6\353B\216\t\330\331\335\021_\305WP\360y\036\255\262Z}7\\9sj\324\207\327\212v\20422\r]\304\200\252:\232z\231\030G\361\024\216\371<\276`\241\374g\241\355\361J\242\244\003\307\2253\033\026\252\373D\204\205\222A\245\342\261LHQU\220\340\255\250LT\274\023\026\006O\344\200W\026PX\036\313j\305\362P0\3275\307\021Z \271\364\345\002\311\340%\233\375"
+	.ascii	"B\317=\216\206\006\344a7Z}\314\330u\375+\37219\311\177\376\317"
+	.ascii	"=\2166 \301\350KT\035\237\222\224SM\312\3247\245\261\355\223"
+	.ascii	"n\352\340\005L.\271\323\223\006' P\002A(\245\007b\002\217ud\035"
+	.ascii	"[6\rC\324\301\315\002-\323W\236GC>\005\\5\037\251\234\354\026"
+	.ascii	"\347)>\333\020\200\342\202\200\316\007\030\327\354\246\305\300"
+	.ascii	"\335lK\222\233\016\277\017%\211`\266{/m\244F\334\255\211\263"
+	.ascii	"8\260|\332\r\034\303\356Fb\241j\274?\221\316\205\237"
+	.text
+	.section	.gnu.lto_calculateThrottleAndCurrentMotorEndpoints.145.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\302\030\035l"
+	.ascii	"\232\260D'H \214\333\031\003\375=\352\313~-e\n\273\"jI\217c\240"
+	.ascii	"f\235]K\306R\266n\264R\323\276\335\311X\376\250\203\376h\215"
+	.ascii	"\307]s\332\341\223_?T\201\364\340\361\316<,\214\230N2\022\001"
+	.ascii	"0\204\271\310\312\336)\245\024V\002&\002\200\002\316L\255\363"
+	.ascii	"R\353\254\364\343\234\324:#\265\316GA\316FA\316EA\316DA\316C"
+	.ascii	"Kg\241\245s\273t\016Z:/\203\234\201\202\234\177\226\316J \347"
+	.ascii	"\344\2173\273tF\0029\373\217s\367\264\013\023\343\240di|8{\356"
+	.ascii	"\332\365\004\227\rrL\226.\323}\246{\260\233Lw`w\265\233\257\033"
+	.ascii	"Lw\230\356\275Vz\322Yo\231\233\271\013\271\3154\032^\236!K\344"
+	.ascii	"\300\243e\200\020"
+	.string	"\351\304\340\361a\034\323\204\274$\303\202G\327\317]>\341\342\340\335\271\256\333F\331\310A\026\234B\333s\257$\021\347\342\340\361\361\003\344\026\344e\240\220N\202WW\205\332\037p\203\320}\035B\377\3612\f\221\243;\227U\267\246E\312\227\366s6\030\"\355F\3356\233\253{\023]w\257\243\312F\022y\037\261|E\216\256_k\251\333\242%L\331\310j\221\0216\250\343\262\245l\244\267\027^2\363\036\013\266\353\346:\033:uJ\022]\327\335\320H\026\241lgn\274\316s\266\236\221#\221\213&\207D\214\353\356u\340\f\312FNu\022\333\310c\037\261\215d'\263\235\336\233s\223YNH\343\343\343\272.\326Sig_]\260`UU\201jJ\212B\024\324\223S\023\323\222R\022\322\221Q\021\321\220P\033\264\004\372Q&Y\344\361\335\311\235\314\252\360f\370\204\023B\233Y_\t\366\205\277\266\020\330V\177h"
+	.ascii	"\275*LW8d\013c\307\026\202S\035-P\031\3134\232\246:d\013<:\365"
+	.ascii	"\035\251\322\204`|J\260\245\2724\205C\266.z\036\345y\r\365\304"
+	.ascii	"\245\235\270l\361\246\243\006\324:\246\273^\272\313\342J\324"
+	.ascii	"$,\0318\022\226+~\324gymD%\305\255J\027\3215\021\335\234\017"
+	.ascii	"Y\261\300\205\222Y@xu$\340\221\342\206\327-\\\007\035\223F\220"
+	.ascii	"\243\323\207lpG\rqi(h;6(\276\214;N\001\035\223\3262\210\366!"
+	.ascii	"\333\333QC\342\240\236\376k*;\266'\376C\245Lf]=\223$\342Y\245"
+	.ascii	"\270I;\371.\333\322\234\205\376\2459\262I\037\205\332\216\374"
+	.ascii	"\241\371\037\262\371\035\247\\\327m/\355jmO\367d\226\353\272"
+	.ascii	"\354\3216\267f\f\315\354\03607\024s\022b\357u\240\211]B\017="
+	.ascii	"\321\367\215\037\372\036U53i}~$\270\n}\373E\352\272\221\354\004"
+	.ascii	"\241o@:=Fk\373\375\327H1\257\031V:\377H.\n\007\032\027\364\313"
+	.ascii	"/\373\243\033\250\026#\037\364I\276\264>{\364,\277\305\274\205"
+	.ascii	"V=\007z#\357\215\320-C\336\346B\366\347\201>\231\007\032\247"
+	.ascii	"\374\237\357\264>g~\325\240\025\361(\277\005\033Y\346-\244\352"
+	.ascii	"\235\371u\317u\335d;=`\223\357[8h;N\017\350t\035'\325\311\305"
+	.ascii	"\231\347\314c\033\231|\022r\330\237\246i\366\307\252s\246<\251"
+	.ascii	"K\260\314Z(\274\243\354w\234"
+	.string	"\303<6ho\206D>7\234\216C\004\210\n\025|Q\3053f\321n\310\224\256\213\026\202\033\261\333\270\340\276\322H\206\021#\006\333H\344\367\335\013h\325s]\327=F\261?\276\377Z\251X\225\323\035\305\372\377x\366\264\367\351W\3466\3545[\334WxF\r\357h\215\327\363\002R\3373\277\366\377\224\301\330~\007\252s\320\234\221\221|\312m\034,s\016\006\274\243\375A}ml\254\211ho\306\274\367\364\2372\367_\257\327+?\006\314\255\327\335H\272\332\334f\315\327\334\256\263\3034\227u`\263\021\t\2124{\260Y\254\31343\373LsX\223i\376\002r\376\321:7\320:\353h\235s\364`3\216\006\323\274@\207i\276\321{\3156z\257\271F\353L\243u\236\321:\313h\235\267Zg\005Z\347\030\255s\002\2553\214\326\371E\353\354\242un\321:\263 r^\321:\253h\235S\0209\243h\235O"
+	.string	"9k\265\316&Z\347\022\255sV\353|@\353L\242u6\240u. \310\231\200\326yD\353,\242u\016\321:\017\320:\013\020\344\f\242u\016`\310\371\303\2203"
+	.string	"B\316X\255\263\207\326\271C\353\314A\310yC\353\254\241u\316\320:c\370q\276\002r\276\260t\266\320:[-\235\253\204\234+\264\316T\255\363T\353,\325:Sh\235\243Zg\250\245\363S\353\354$\344\334\324\006\3241S?\225B\300\231\235G\234i\336Q\3568p4`\n?e\266\016j\324f\177\325\007\247\007\325\356\327x\265\241(km\204\375"
+	.string	"\3007\222\377P\007\200\017\"\205c}\335u]\263\250F\254s\250\007j\316\033\2738n\316,>\275ic=\016^0\305\t\253\rV\033\017\207\035\336\303;=\237\\9\260y\262\247\203a\232\016\337d\310A\2043\034>\210\324\220\372&\317\356\270M\202U\205:\244i\356\370\234\371\225L\223\231w\221iPZ\206\n\345g\212\t}K?\335 \270\341\373\225\026Z5"
+	.ascii	"bx\r\357\204\370\366%C\030\3515\003\230/\031\276\351\013\006"
+	.ascii	"\276*\206\017\"\355\263\276J\272D\225\256~\310\313\237\225$W"
+	.ascii	"\357~o\234\b\0351t\223~\312\275\305^\370\017Q\376\250T\345x\227"
+	.ascii	"-\327\273\360m'\345\243\352\t1\271\200\002\244\033oA\r\236\205"
+	.ascii	"o-R\020\254\357\321O\241\334\340\242FV[\254~\351\271v\255\272"
+	.ascii	"\213\372\252\377\265\022\240\206v\035\3649\263X\264A\243\025"
+	.ascii	"J\313\347I\035\242\256PW\241\221*\313\347\211*\236M=\325;=\327"
+	.ascii	"\244\260\f=\327\246\254\320\251M=\323\0364RT\246,\270\204\003"
+	.ascii	"\245>\310\273\207\372\016\375\224)|\324w\006\3255EO\341\221|"
+	.ascii	"\320D9)Q\037\301\253\207:F\b\352/`\3015\016\364<H\017\365K\210"
+	.ascii	"\023\230y\3628\247\177\372#\037\324\020\312\023\247\357\016\336"
+	.ascii	"E\353\030\nZ\312t\347\314\"\235\366\247H\236\275\002wb\004\002"
+	.ascii	"g[\033\333\310f{\355X\241,\211\336\351\tr\266\223\t\333\364-"
+	.ascii	"\305\335\234\211\223I\023\247\023'l#\233\276\337\327\016\365"
+	.ascii	"ez6\351\2610\252x\246\364L\357\204\270D\020\252\3459\301\023"
+	.ascii	"\243\347\222/Q\305%%pQ\013\226\236\251\215\364Uz$Q:\252\350G"
+	.ascii	"\034\312\202N9\016\344@\266\221J\037\344]c}\013G\220#a\231\364"
+	.ascii	"o\247:\247\2033;\2518\351\274\243I\237L<4\201\315\363\315\232"
+	.ascii	"0\357n\016\350\247\254G)A_\223\300\244\363\027x\265\376\353\024"
+	.ascii	"M\336(\213\364\024h\023\275d\331\337x5\244?\372\261\252\232\241"
+	.ascii	"G\372#\240\007?cA\245\353\272#\330]7sZ\301\342\314\222\205m\344"
+	.ascii	"\321\353x\r\255c\214\276\315\212~H\214\3217T\313\002_\364\024"
+	.ascii	"\344\324\326\244\365!\372v\003]>\270\232_L\033__]ZF@\200t\205"
+	.ascii	"\361`2U\020\031\353j6\271\034\030\022\302|\321$\023k\222\305"
+	.ascii	"\200\301\243\313\353KL\214+i\214\331\334\301\225\"\214\351\325"
+	.ascii	"\344\"\013\353j6K\2141\233L\260\247f\027\220\036=b<\260\243\353"
+	.ascii	"\307\2160/0!!\314\027Ja\\&xpu\235\340\001bI\b\363\305\323\017"
+	.ascii	"\037^+x\200\340\021\306\005\006\306\324\3321"
+	.ascii	"\006\325\345#\214KF\223L,\214E\327W\263\311\034\373\321\004\244"
+	.ascii	"F\027\230\027\215fX\327\330\030\331\216\226wx\030\353\032\342"
+	.ascii	"\005\206\325\374\341\303\353\253\007V\230\027\027\030\326\216"
+	.ascii	"1 X\036\234\230)\3265\206\325d2\307\260\226{g}t\037\003n\302"
+	.ascii	"\356i_a\340\205\346\363Q\252\306\333x5\345\034+\233\263\177r"
+	.ascii	"\216\277\262\346\245\213t|\016\032\257\303\306\317x\032s3\276"
+	.ascii	"\275\364Q\314\233\032\353{\365Sn4\335W\372\310\350Y\211\375P"
+	.ascii	"\337\240\341\024\216W\343\237\016yKs\267(\343\345\036\306\313"
+	.ascii	"x\245j\225\353\326GyV\331\023U\334\262 \212\002\277\365\310F"
+	.ascii	"h\\\214O\340\025\370\206\332\3011c|\177\221\363~}\213O\340\303"
+	.ascii	"\252U\356<)\223\323\374\256\340\255\f\025\306K\341\032\243\212"
+	.ascii	"/\276\305\303\210\303\361.\376\30535\266x\026\357"
+	.string	"\342\235\264\370\237\367\233\260H\261\370&xa\305?\0237\025\277\202\021I\354U\374\223\032\013?\265\372)\177\264\265\036\331F\270\247\n\305\347\371\2652\022D\314\375\222\237\240\254N\331\2352<ex\330\023\217\342\223n\240\206~B'\276\251\261\255\226XQR\241\267X\255\357)U9h\316\370I\266J\250\241\365C\336\002\251&\276\304\213=\022\020j\367\364\353\247\231\370n\303\374\254/\361My\240v#\236\304g\275\003U\2725P\021R<\323HM\003\237\342Y=O\327\017\370\006\236\035\272H\342\r\370\003\276\241\"<\317\362\220x\017to\001?\342\r \340\013\b{\002\336\3353\342Y\2677@\252\2263\227\231P\326\350\035\r\373F\323J~s\352x\316\333d\216J\304\217U\r\321\234\361\204\262\253\210\377\301C\210\027\227\3672~=\002R;\3267\004\237\302\250\242`32\022\232\353\236U\r\360!\004\370"
+	.string	"~"
+	.string	"\020/\30074q\321\363p\241\031\023\022\262\215\004\361Xr^E<\001|\023\366\221Qj'\201\373\250\2014\005\225B\206fDDAA\222$\215\001\261\005\204 \306\2343n\021\3400\347\234\032\031\021\222\202\024\n\303\001Z\355\2441'\\!\267T\214\273\273\372\377T\260\237\376\326\237\342d\241\336\330\337\030\254B\264LA\016\232\333O\326u\265\214\3259\263\361S\204K<\342\305/\322+D\374]s\325\\\321\315\357\022~\3147\237\265\300^F\245\001\345\243\223\177a\"\021;\214\200R\236\341\220\316/\206[\244\300\352FTg\035x M\341qTK\023Z\3424\314\312\007\306\233\313\323\242N=\033D\271\210\006\200\327K\312/\023\306"
+	.string	"\246\300+c=o\375\f[A'\31756\342\031K\322\345\311\026\347\025\335)\302\276\376N\252\311\007\020\246\276J\007\343\023`\020\037\203\342\257\233\305\fW\374\031\217D\247\256~\234}\3360\313\250\026\310\035Y\221`\031\225\356>\024\370N&\240\020\r8^U\202J\204\323\037\227\323\202=\021\275\225\273\213\243\02768\200\246\007f\013e\375V\304I\353\214\241D*\037\274\305Sv\220\016\007^\302\037\312 \316\f\317y&\206\036aB.g\2030:\323d\276|\003:\030b\bUok\r\n\302:\037\203P,5\336\266\030\002\306\037\314\t\346\226\240\273/\3262Xh\031\033\367\n/\321\b\032\013q\227\301J_\301K\314s\277@\303\260\026\225\264\271v(\342\0379\216\300\264\337g\322\023^~\\\f\245r\224\261\335\375|$P\260\177x\273\302\207~\332\034\266\260\276\025\277\260\371\367\213\267XkQO\260\327"
+	.ascii	"\365\212I\031\203?\320LeX\013.S\200\244\325\360&G \205\006\016"
+	.ascii	"7G\3170\373\246\364\3569}\271\217\271\037\3115\360\242\353\020"
+	.ascii	"N\263\300\324\233\031\340\332.\240\003\32146v\357\016!B\024y"
+	.ascii	"p\321\350\017\t\326!\335\304\221k*A\rc\343Q\354\rok\364b\266"
+	.ascii	"]\224L\357\373\317:\273\020\2666\3652\205\231\263\2417\231\r"
+	.ascii	"\355>\324i\004q\274x\206\367a\312\r0\234f\354\277\3425\210.\347"
+	.ascii	"7\304\210>6\317J\314JS\321\241\255KP\233\326\204\005\023)\233"
+	.ascii	".K\277]\nMw\217a\204\005\300Pl\313\314\373\227\200$V\222\227"
+	.ascii	"\373\310\342\220\243Dh%5\213\353\237\321Q\343\240\216\005\202"
+	.ascii	"Ix%j\214\024\245\341g\273*%wC\323b\370\333-\212\020\034k\344"
+	.ascii	"\311\337\266\341\r\0302[\006\330\2405\202\355\331\354\201\250"
+	.ascii	"Z\340\214\231q\022C\333\226\2203<<\245\356\351\030om!\314\337"
+	.ascii	"(9\236[!\016\"\036\375q\302#\027\236\227>V\366F\007)5\264|\314"
+	.ascii	"\026\205\b\203\242\205\311i\231\303a\bUm\250\030b\224q\316\016"
+	.ascii	"\013)\355.\021\210y\200\262\204\252P\022\023\006\004)\334\016"
+	.ascii	"\363K\354h\203|\345D\312Sl\027+\270y\202\222s\252@c\214\031o"
+	.ascii	"\207\n\376\350\357\265\"\206\331k\263\205!C\007\222\202\343%"
+	.ascii	"\212\357\346U\"\206\2048\251\203c\264:>\"2pK5\340\241u\b4\307"
+	.ascii	"\234\032\026(Q\257\303A\350\213X\327;\220\035\205\013E\rx\225"
+	.ascii	"\034\311\353 >\324\276\230\2270\273)r\f\241\032\214\2171o\330"
+	.ascii	"/\360)\360\265\366GJ\037\265v\350\350\334\224\205!-\002\255A"
+	.ascii	"\037v\362?\020L\342\360\350\225L\031\031\337\232\t\305n\307@"
+	.ascii	"\342\321\344\0300\377\275\203\307\"S\004\005Pa\001+I\223`\007"
+	.ascii	"\3274\246\b\3477\342\365X\350\002\245\215\214sB\005"
+	.text
+	.section	.gnu.lto_applyFlipOverAfterCrashModeToMotors.146.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`Z\023\355Z"
+	.string	"\232\233\f\"L \220ZI\007-P\340\t\314V\347\260{e\271\320\\u$\277-\212\266j^_\346\270\243@\002\n\034\022N\344g\205\001@\211\n'\336\322\t~\261pA\304;\203\226U\2242y\367xn\230Y\360\327\342/Fg\373\215\354$\245\f\022\002\317\001\032\002\265w\247\366\"k\257N\355=\326^\264\366\326\367\276{\273{\331\002\037\3064IxJ`\232\"i\224\223\026\242a\252\260\"\363\031fDf3\314\206\314\204\314X\230\2650\3671\3731oa\346\302\334\205\331\013\263\223\031\f\263\f\314\200\314\201\314b\230\005Y\271\313i6\351<\263\214FI\035\336\225\033\226\313p\342&\315\254SJ\035\030$\342:\247\340\361\371\035n\222Q\303\005\344\016\344\360\344\372\270p\223\204\353\f2\203\222J\201"
+	.ascii	"\005\357m1\013?yo9\013\263\300-\360\037\273\300/0\f\374\205c"
+	.ascii	"\3400<\003\323\3005\360\030\036\334\244 \fub\274,\t\374\322e"
+	.ascii	"\200NE\031\212\210\t\003\246\310\030+\316;\301E8/O&]\310\254"
+	.ascii	"qY\347\035!s\260e\235wg\302\374\326Y(\347\016\315b\216\276&/"
+	.ascii	"\264\024\251\251\013\\\207\347\244\356\004\222Q\276\302|d\214"
+	.ascii	"\245\b\247li\333\220\002\336\333b\232\246Q\214n\t$\243P\254d"
+	.ascii	"\242#\2435I\266\273\006\311HZ\206\342\216\313\021\277\035\322"
+	.ascii	"4\255z\tJ\213\344\232\205\227\351d\334\304\264\244\224\204td"
+	.ascii	"\244,\"\032\022\n\002\372\361\351I\362\354 u\216h\275S\223-\353"
+	.ascii	"q\205\273B\230\226\244\214\233\322\3505\023\tl{\274Tu\214 \241"
+	.ascii	"c\303\265+\325*\316b\030>4\241\225H`\263\302IHy|\264B\2256\242"
+	.ascii	"c%\035\225.\242K\234\322D:.\016\031y\003\236\\\233(lVxh\216\205"
+	.ascii	"\244\314u\320\\\205\262[\223k \035\027Q\330\236\360\217\341\332"
+	.ascii	"\223\267\366q\302=M\234t\322\215y\f\327\332*T\232\246n\275\363"
+	.ascii	"!\n\033\023F\262\341\332\222\017vkLZG\004>2\2174\n\002\327\032"
+	.ascii	"\302\006\2704?I\320\252\322\333\240\022\0364\322g\263=v\252&"
+	.ascii	"\026\3010\262\341\032_U\"\241Kc=n\265$g\335:.\3224\335NK\302"
+	.ascii	"\306\373\304\273\rc\227\275v\203F\b\311;=i\\\306y\376tH%p\347"
+	.ascii	"\307\327xC\036\375\316\247\020\2217\3417\343:wr3\3432~\374\326"
+	.ascii	"\031\025gP7/\340\021\353h\242\342\223(\032G\027\025\235\004\265"
+	.ascii	"\024\357jq5\247\3158\272\203\242[!\332\313\026\375"
+	.string	":\271e\274\3250\353\316\234\f\247\310B\2264\335\026\215\215:\240\245\251\031\210z\364\314\264;\353\306\375\353\223\020\231\213\375\237\217\364`\266]\354\346\013\231\246h*\226s`\035\226\313S\030\335\013\202\00492\332\347AF\031\333\312\344\361-\221\t\214\3627\227\331J.\316\242\323\343\266\351\b\343\254\307H\303>4h\035g\231\233\216|\030\337>\262\344\214\3270\033\260\345)\213\201Xs\232\330\221Q\376\2166D8K\314\272q7\313Y\2779\303\2210l\373\270]6\344]\326\336\257\332\353\305\210\274]\265\327\007\237\341\345\332\322b,\274\025\324\336\036L\310K\001k\341\345\301}\274;j\257\216\332;AV\016\034\354\344\275\301`xm\260\f\2745\030\220\027\213\003yi\260\030\336\031,\310+\203\025yct/\214\332\373\242\366^\275\327\305{[\324\336\004j/\002\254\310\313\202\315\360\036\300\206\274+\330\217\327"
+	.string	"\336\302k\305\\x\013\340.\274*\270\013o\n\366\302\213\202\275\360\236x/\001\335;@\355\025\340\275U\335KU{\247j\257T\355\215\252\275&jo\211\332K\242\366\216\350^\021\2657D\355\r\240\366\202\250\275"
+	.string	"\324\336\017\265\027\252\366>\325^\247\332\333T{\231j\357R\355U\252\275I\265\027\251\366\036\275\327\b\355U\326\336\242\332KT{\207j\257P\355\r\252\275@\265\367\247\366\372\324\336\236\332\233\254\275<\001*\376\341"
+	.string	"\374^`\364\b\353\224J\204\342\300\b\271'\037\316vn\200p\370P\374\351P? \323\356,F;Y\347\224\\\232\246*\322\272\211\003#\022\3234\265jk\267\007 \250Q\343\310\350\3239\221\321\024\334"
+	.string	"\271p\205'J\210\336\\f\233\036\204\202R|\201R\\\305\325\266\n\235`'\177m\310\004m\005:q\024<\336\343\025\f\251a\2169\353F\n\336\343+\3460\031\r8\005\347B\336\231;\313{\263\343<\376<Ef\235\323\233\276\343)\302\226t\021\275\323\231\2740\355\230\300PFN\323\237\340\362\314\f\275\271\3077\200\211B\217C\313\006Q\350\033\fzs\333\247\003\377\b{\370\321\361\253\247\0307W\277\226A\023*\320Z\235\351:nb\016s\314\235\331^aMS3\020Kgz\323\234\245_"
+	.ascii	"W\245\221\177\336\334\251\277']O\326\217O\306\344\215\033p\265"
+	.ascii	"\021\177\317\267\236\034\017\361\367\\\223\304\272\325\325\214"
+	.ascii	"\376\b\277\364\034\005\031\2238^\300\232\236\004~\304$\374 \305"
+	.ascii	"\325\200\376\004\311\364 \360\243?\302\267\344\t\253G\320&\260"
+	.ascii	"\321\347\315\355\341\241bV\303\024\354aG\212"
+	.string	"]Lp,$\016}dh|\306'8?y\247\314!\235\031&\243R\326\241\222\216t\245\243O\033\267\361\244\223PS\3435\216\364\2573\272@\246]\037}7\002\034GN\313q\250\344u~t\242C:'\363\315\3508\316s\\\274\305\215\216\204L\276y\364ac\002\030\036$\025\003\315\351Hq\213\253epT\376\007M\037\232\335\254\346@G\037Q\376\030C\033\0338|f\335\270\203<\002\375\t\256A\023\270Z\321\217\206y(\302\242s|\334v\215;\n\322\200\300\325\210\242\210\376\030\024\257T\364\315\016\242\313\201\257:w\267A\f}\203\276A\264\216\303c\350\257AQO\350?\277\021t\364B\227\002\fz\t\254\003\335\311\017\3532\376\363\247>*\204>\347\271\215\236\243\367\271\324\234\236\227@\244\361>\272\304\226@\264\202\204\201\321P\216e0d,\003\b\302\300\306\300\202$\227\274\325\243\303\300\306\270\264\032"
+	.string	"\022\333\272\022\333\272\022\333\272\"\242\225\245D:\"\242\225e\364\203kl\211\265\003\004\b\230\r$\021\255,!_K1\035\345\217\261/!]3\300\226c\\]@\274\272\026\020K\002\033\242\001\003B\226\0174\360CL+\214K\331\365%D\313\306\005\\\313\261\033?a]D\300\260\206,\201x\355,\027UX\227\006\313 Uc?\276\226@\274\252\204,\265\202Tq\205\211UQ)-\330\220\256\260\25210\260\260\252d\0263~\234\0363\007l\360\n\315~\3264\267\024\343\350\234S\024\263`q\002\0068\001-\f\360\2463\\\231\336\\\026\217q\243\276\275F\001\316\202\226v\223\206\003\263\261\254\023\311\207\002\231\236"
+	.ascii	"\3474\2146qK\223\027\306\254\033\377-\201F\222,\275\271\311\266"
+	.ascii	"\244\345\321\271\241(^q\265\025\257\272\002d\250^\325{`wbT\225"
+	.ascii	"\321m\206<\226\023\002\243\nJon#y\t\001\376\301y;\372\372\013"
+	.ascii	")^\361\345\371\220%\200\263\262\345\305\255\254S)\267\275B\347"
+	.ascii	"\221\341\221\345\221\351\221\351\035\031\335\341\206\bgI\222"
+	.ascii	"\nW\274\276\323H]\377\272\005\207{Nf\335b\023$/\034\275\271\307"
+	.ascii	"7$\024M\375\275\371@\271u\345\237\2337\""
+	.string	"\255\037p\265\375\324}\350\372\236h\035\007\n\217\324\247\356\004\267\347d\276I=\352]\357'\363\355\0042,RG!\305\307M<j\233\256\253\254sy\312^\355\227\375rd\324D\003un\204yK\270\356\343UO\246\016\025\374\200s\235\321\360\016\334\231\036\033\246\335\231Q\211o\035}\222\370\210\2278\022\"\323N\304I\034\311\rsQ\353#~\004\247\267\205\211\003UY\323\003\345\233\373u\024q\266S\240\245|\311\2118+q\013\204\3037h\366B[\321\233ZG\313\236z!\016\342Z\3479\264\342,\340\001<\304\357\307@7\327)%\027\347\200\210D\270"
+	.string	"\316un4\344\001p\250\203\270\022\234\225@\346[\201v\250q0\004\025b\246\204DD$I\222\264\006\201\005\304(\b\241u\003\021\340\244tT\215\210\220\244 i\f\034\346\n]J\312%\324P\020\273\360\304\302\371\300q\241\0016\004\033\034\240L\340T\301\022\261\f\367\314\343v\242\271\374!\314\363\022$)\252$3`G\355\351\251\3152\243*\355#R\351\251[[\302\247\355>\325\237\267\371\301\016\035e\033\254\353x\300F\350 \315\315\351\312f\213\317\2273\222F\225\022\322\317*\325v\351-V\346\005J\302D\023\017\265\214\270>f\364\027Fg?\363g\305\271\356|\346\351\305ez$\345\f\356\213Zj\205\344.\363\360\341\306Z\255\246\312x\217Drp\303\202\230\267\020\030\322k\2631:3\003(\201:L\203R\b\300\030\354\f\251\017\363\307\311"
+	.ascii	"B\253\347\006\006\302\2776(\230\337qe`\301\023\201/_\022\371"
+	.ascii	"\347t\377+\355\253\013\261\n\\K8\f2\224\264\351.\266\215\214"
+	.ascii	"\361&\266\315\311b{\306\241>;\221\277\375?\005\270D\352o\370"
+	.ascii	"G2\302\257\204\362\330\245h\330\026\206\274\227\005\316\231\206"
+	.ascii	"\304l \206\3162\220\336\001\033\254\215 _T\017\265RC\331*\204"
+	.ascii	"\220\242N\227\346\0366-d\247\036aj\245w\360&\332\033\321b\354"
+	.ascii	"\211i\351=\342E\277q,\305\031\251\316\366_!\031\343\377\002\201"
+	.ascii	"y\246\037\001\307\330\264\216\301B\355\0225\262$\303\023\355"
+	.ascii	"\370\374\017dP\362\271=\337,*\302\r3\206\203x\030\033\215R0\013"
+	.ascii	"\333\224x\nAx6\234%K\202\206\233y\251\302E\235N\235\367\354\334"
+	.ascii	"\006\274\354M\033\272\001P\332OFX\212\362\0361y\334\003)\036"
+	.ascii	"\202\354\201\0049\266YA\202\345\341|\372xtx\206rl\331\313\271"
+	.ascii	"a\234\204\347\216\023\336\253\310\312\214\3378\n\317\035\023"
+	.ascii	"*\234\332\241\021\373\244q\312\205(\223\262\271\302i\005%=\205"
+	.ascii	"$F\372d\177\002\205{\220z\322\242\362\376\317\264\321A\372N0"
+	.ascii	"\300\001\034\006/(K\257\007}\324tI\271\355U\326>\320<W8\274\302"
+	.ascii	"\224\205F\033t\234,z\220d\253H\350\200\245\244\242\3576D\370"
+	.ascii	"e\325Q>\217\300\320\230\f62l\275\2365\275/%\361\2365\361B|\270"
+	.ascii	" \271\2404c\374\372\005A\020\212\330\372\366\fSR\222G\021\001"
+	.ascii	"7\341\230\273\313\330\261\204h\247X;rLZX\032\231\201\202\302"
+	.ascii	"\221kr\216K\022\2724\001\376\035\217\0050\2037r\274\302\251\227"
+	.ascii	"\331\367=\006\241C\201\376\321\244\230$\324\263\242\240\230\n"
+	.ascii	"*\245y\251H/\001*\342\2366U \307\313H\363\340\224Q\rf\225\t\317"
+	.ascii	"\250\254\202\264\357t\n\252c\235c\332>\254\310\213\032"
+	.text
+	.section	.gnu.lto_applyMixToMotors.147.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\201\t\0355"
+	.string	"\212_\240\024BP\246N\007\227\317_A\212\225w9\b:B\254!U\247_\355mB\003\177t\200\374\bX\026\255\275$\004\033\236~\003"
+	.ascii	"\004&\"\"\"Z\341\247\t\353\272/*n\350\241Pc\244\355nr\357\224"
+	.ascii	"R\n9\001\030\001C\001\235\306F\237\341\013e\207l0\303E\255\265"
+	.ascii	"Y\353'\216>\3035\226l\3002\334nf\370\315\351\016\235\345\t\241"
+	.ascii	"\212\341n\343f\3531\305&\303r}\311n\357\310;\263\273\273\367"
+	.ascii	"2\350\224A\250\235N\2418\230\201\235\242@fvg\016\223c\017C;w"
+	.ascii	"Z\177i0\305V\343g'\335\313\304\r\356^5\007\fA\255\233l\247j/"
+	.ascii	"\331\366\302\274v\312\013\324N\271\310\334'\200\216\353%\341"
+	.ascii	",N\330Z\336\275w\370N\220XmT\255\331\350\213\235\204t\244\024"
+	.ascii	"4*\002\376V\325gS\364\275\310\355\263B\227\224\031\203Lzu\322"
+	.ascii	"\023\271#\216d\326G\375e\326Jr-\254\033{\202N9\241x\020\365\351"
+	.string	"\370A\245\353\306\230h\005\275\273\270n3\272Q\0232#]\004,\353_\327\215\025y\226\371\352\326B%d\313V}VJ\310\224\355C\251\230p\200\004\223ah\323\234%{\032\256\205W\306\224n\353\306\210\240S\367\336\243\247A\032E\251\356\320\f\n&u\240M?\250 \333\255],\t\346\337m}\342\314\356\217\0222#\355>\253{/;2I\326\274\324\314\035\203\231\211\314\2522f9l\247\277o8v_\324\037\376\212\244>\224 \373\376\276\267k\307+\3067]\374\246J\341\346\247\355\324~\213\025\371\372\252O\277\217Y\320\3467\366\037\375>^1\372\036\013\377\337'\027\226\250\337\277\217w\315\246\333`qK\341,\027\336H\027\266\323\376v\353\024\256L\020\232\362\313\367~\f\033\035\311\377&\263\232\321\273\202\231\336\035?\023\346\325\231\303\352l\245:o\320\220Au\306p\001\350l\201\202u\236\240:K\210"
+	.string	"\341A\207\351\036\266Zw\225\203\2373\325\352\234\240\3254\0370\320f\232\0134\231f\341\352<e\235\t\254\316\003~\316R\253s\324\317Y\300\352\f\265:?Y\347"
+	.string	"\2533"
+	.string	"\353\354\264:7\255\316L\326yiuV\262\316I\2523\222u>\262\316A\353ld\235\213\2543\320:\377\334y\3659\253\326\331g\235m;\247>g\324\347\374\326\331S\347\356\020\204\322#\331i\204\356\375\261w\350\322\245qUZM\267\231n2\375\314-\307@\036fh\313\270\177\201\r\b\340\241>\301\017\352\237\276\237P\001\376iP\227"
+	.ascii	"N\017 \220\223\002+u\2620\323\224\35379\305\026\337\200\025\211"
+	.ascii	"\2331=U,\323[\275\030\263\325g@\361\226k\316;lw\252\3227\375"
+	.ascii	"\200g?\0062\372\236\257\351\231\276\341\332\225B\220\024\321"
+	.ascii	"Cg\256\3007-=\023^\332\322\257I\257\364}\234\373\272\343\267"
+	.ascii	"\"\030~&}\215\345Z\241\246\243'\f\031\373M\216b\333\243\202R"
+	.ascii	"x'6D}>\302\027x\261=\215\364\\N\002\316\354\341\2037\022\351"
+	.ascii	"\033\217\037Ct\306\367J'|\204\247\360\177\346\310\214r\3413\207"
+	.ascii	"\020\341\215\234\360O\347GP\013\2512\b\b\372M&\332\r\277\364"
+	.ascii	"\221(\t :y\300\\\2171\274\204\337\360\035\006\344IB\367\bk\341"
+	.ascii	"1|\207\305\341i\273\021$Jx#K\330N-|\247i\177#%\217\231v\364\301"
+	.ascii	"\217\360\316\347\310\264c\342\350\025<\201\360F\037\254\203\302"
+	.ascii	"\350\033\257\214\020\232\222\311\037<s\n\025\336H\b\357y~\334"
+	.ascii	"\320\201\275\027\027\275\357\037|#:2\201\377\373\242\357\236"
+	.ascii	"\303o+\370\t\374v\263S2\213\226\303o\r\007\317\275w\002\367\034"
+	.ascii	"\214\253f\023\374\242j\306\213\256\253\255a\f\342\326\026\021"
+	.ascii	"\253\213\206\214.\032$\200Z=\"\253\206V\027\326\025\360\206\326"
+	.ascii	"\b.b\027qK\305\312\2221c\312\005\327\225\312XU\\Y7\264\266\206"
+	.ascii	"]/\\h\301h1\214\241u\2655\304\342\2321\254\202b\242\214,\256"
+	.ascii	"a\027\221\3105\004\252}\3653qv\357\300CC\367\365\306\244o2\020"
+	.ascii	"\312\221\203O\241(1\350\003\007~\352\273\217s\016"
+	.string	"\314\365\374\336\353\205\364M>\360\016\336\311\331v\207\300\207\361[\223\037]\020\022o\213\203\361\233\352\306(E4\002\337r\235.\227\317Bq_\276\367G\337\344\356( i\\\224\236\tw[\367\0206DL\243\250\237z1\226\262Tj\235\323\256[\312J=\325\263\207)\215{S\212X\244\276\235\215\316-\317\004\277\311k\236\"\r\377y\234A\013_L\370Q\357A\300G}\207%:\324\210\212U\254\024\261`\261\235\n@\347\312\002\025j\364\336{\215\276\311\276\344\032\340\205^\216I~Q3\274\201\006-|\r\337mm\302\371\345\355\3104\360^Z\217\337\216\314\356\275\025\270\363\272PQ\013\027\317\212h\334E4\267F\220\244\216\027f\232\027\375\022|?\327\247\347\300!\200\275\250A<#\0313\206fDDF\222&\313\001\200\002\021\2622n\021\200\271tE\nR(t\312-=/ B\305\331w}\034]4"
+	.string	"\237\373\303&\376\260n\220Y\013\237\344\323d\236\216"
+	.string	"\334\b\202a8l\207O\317,\b\030n\230b\322%\022\306\254\270\214\344\253\016L'\311\205\271\362Iu\257P\211] \0175sU\222\221\205_S;j\366v\327\254\367j\017F\263\201\2345\031|\302"
+	.string	"\027\031\236:UR\333\317\247\320\034'\240R\350\371l\201`\337\316l\234U\0218,\240D"
+	.string	"#z\016\277l\350\254\300\362t"
+	.string	"\025\3514\250Y6?o*\353\n\307\f\0365w\330\275\206\330\302\202\262\332r\306k\337B\272\367\212\302\212?\001\213\017'=\262[\255\346\215\320\2273\206\351\375\241[\302\251\034\274\321\307I\230\223#\277\037\265\230\025QS"
+	.string	"\b\2452\337RK\302\303t-=E\200e\346\351\215\360\004EBI\017\277\251\2400\347\b\030\261-\243\022\b\023\b\201)R\001-)\206_\232\310\346\273\342\033C\263=\225a\307\023\2516\235]\206\277\215{/\233\232\262@\276#\272\323\346\030!O\r\275\310\311M\217\313\004\225p\257\023\004\003\320o\334 *\303\340,\\\2243p,\342\365+"
+	.string	"\206\013\240R@W\237\0019\222rBe\222\347\211\273"
+	.ascii	"\243\354LM`\377\003"
+	.text
+	.section	.gnu.lto_updateDynLpfCutoffs.150.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\342\002\345\026"
+	.string	"\226j\226H\300\030Q:p\361\2462\220\303\037\t$+\0340Rk\205\307\230\030\371/\256\326\017\253&\226\374-\225\264\375o}\262\242$*+\340\254\251\022!\300\334\266(V^wtg\336\023\033\021\036\2420\n~#\210\020\262wJ\001}"
+	.string	"u"
+	.string	"\210"
+	.string	"\342?*\332\2469\0279\332\031\331\335\006\206\020\376\363\251\375\036\367\361\272\217\t\227vg01\262\233k\340\005\341\277\324\t\200\377\274\017"
+	.string	"\377\371ec)\220\263\260\007\270%4 ^vw\2545\376\372\347U\372\362ejJ5\033\354\037\214{^\252\211\216v\262\345x\bvd|\021m3Z\207NY\330r\274\324\356\376\347t\205MF\251L\315\356\232\326l/n\360\2665\330.a\3231\001:1\272\263s2Zy\354{\273\273\256;\266\211\032u\242{\346B\267\370\334o\n\251K\367\371CJ\375\231\250\275\022u\245\3244\244\276\200\223O\217\355EF\273-vaV\367\035\261q\242_\3502\024\244\236}\373A|!\026\211nh\224)8+\023\302\003\371C\266\320\210\357\213\275\212\036\034\024\244\335e\360\3175A\377\201s ;\270e\331\261\273\342?\033\307\016\365B~!\210\210\021\n\244\230\305\270\330M\361*\217\305\352U3\310\212\177\344H\254D\204\2238\tx\342\246\005\247S\253X\251\223"
+	.string	"\224V[E\202\257\325\232\232U\230]\344A|\232\355\306\022\230*\255\037:\005)E;\0248dtwa\265\362X\001\355\037@T\325a\241\343'I\312\223\031\005\343RE\325\002[hc^\303Z\252\377q/\007\025$\\\f\241\033\262\017y\221\t\277\307\256\222\276V\202\377^\035\334\262\340\002\266\241!W\3459\262Z\253UKe\300C\b\t,\234\016\247\n\035\310\022\345\311\342p#\002E\2028\317\226is\206.\013\344\252\254p\262H\323\274Q\001\260\212\306$I\224\253\361\264\371P\202\3600\262J\016\253Qe\272F\232\003n\205 \315\361l\265\314Q\314\305\356m\335\371\317\237\")I\027\253\262/\254L\356\342\326\005w\213\035\235\307\215\313\027\f\256#\235"
+	.ascii	":S\355\f\033\350k~\225$#\035\215+@\271\b\273\235\226\257\316"
+	.ascii	"\324Z$\326/5 P\2021c\305\033\326\031!O,\251O3\317^\314\254\035"
+	.ascii	"\247ML\241PA\260\002V&\3366\035\257\027\303\242Mb\341\356\332"
+	.ascii	"2\256\030\226L,%\231\320\n\f\254\016\3461dF\302\214L;b-G\202"
+	.ascii	"4\375\330\242\275i\016P\203\313ZH\016\033o>\013\364\314.L\251"
+	.ascii	"\232\r\2515b\r\0234$\302V\024\327\275\232\023K\2761\324\232\345"
+	.ascii	"\246\303t\024\020\203a\355\031\227[\n\363\207P\006"
+	.text
+	.section	.gnu.lto_mixTable.151.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\355\013"
+	.string	"D\024(\001"
+	.string	""
+	.string	"6"
+	.string	""
+	.string	""
+	.string	"O"
+	.string	""
+	.string	""
+	.string	"\001\006"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\002\203\221\213\002\001\277\001\354\243\341\025\004\204\221\016\224\334\236*\004\003\001\225\004\001\025\005\001\201\221\n\001"
+	.string	"\177\002\003\004\005\001\177\004\177\177\177\247\003/\200\200\200\370\305\207\374\271\034\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\005\001\006\023\001\004\005\001\006\025\001 \005\001\b)"
+	.string	"-\300\200\200\320\271\242\200\200\t"
+	.string	"}\276\001\177\275\001\274\001"
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	""
+	.string	"\013\257\322\005\340\200\374\377\217\200\200\357\317\001\221\216\217\324~\t\001"
+	.string	"\002\002\004\001\001\276\001"
+	.string	""
+	.string	"\244\003"
+	.string	"\252\325\252\325\245\003\002\203\300"
+	.string	""
+	.string	"\201\003\204\360\371\360\237\307\n\001\277\001"
+	.string	"\212\001\002yw"
+	.string	""
+	.string	"\003\004\002\005"
+	.string	"\201\003\203\340\223\366\310\001\003\001\212\001\002sq"
+	.string	""
+	.string	"\002\b"
+	.string	"\372\002\204\352\303b\003\001\006{"
+	.string	"\003\273\332\201\035\203\340\225\366\310mk"
+	.string	""
+	.string	"\002\013\004\360\372\2508\004g\005\253\001\203\003\202@\001\253\202\300\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\rcurrentTimeUs\026"
+	.ascii	"2\003\303\341\313,\\au\303\b\205\020\002\362\312\320\030p\217"
+	.ascii	"\250\300$\356k\"\237\023&\226\016\026\272\314hS\361.\001\020"
+	.ascii	"\253)\302\035ii\257)\341\246\024j\017"
+	.text
+	.section	.gnu.lto_mixerSetThrottleAngleCorrection.152.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"E\b"
+	.string	"&\320;8@\217\322\001S\260\n\230Lf\305\tm\207\325\036Q\026\031\300\222k3\034|\n\377S\001\020r\013\373\227H$\030\256\016\003\201\321\325\020\215\r\3345\366\310j\262\311\336)\005)"
+	.string	"-"
+	.string	"*"
+	.string	"\227\356l\226\243<v\340T\262 q\331\335\031;\336\035v\376O\327x\237\350\020@aw\r\275\017\343\216\267m`;\301v*\246\037^\034\225\225\357/-\273\027-\230eI\223\217\215\355C\373!\027\351n\362\312\232\335\r\224\222\335E\360A\346\262\340\002\330\345\365"
+	.string	",\231\230\024\326(V\030F?\365\021\257\374\222)\254\202\367.}\253\260\313\t\215\023\220\214\021l\331(\021\214\034\366\257\335]G\222\375Z\304\307\263\020\242\033\227i\265\322\214\343\254S5\211\r49\207\206\355\3030C\233\0074\263\n1;\004\246\017Z\235\034\245unP\373k#\311\001\b"
+	.ascii	"2\241\213/p\340\002<\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_mixerGetThrottle.153.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 \371\345\006"
+	.string	"2\21505Pm\222\016@69\243\214\264\025^To\361U\254\221X\323\224\321\321\346\257\331\177S\201Up\207E3\354\270\231E\202\030\302-\334\206H\2505\230\321H#D\246g0\227f\242\332D\216CC\365\300\020!\252\205M\314\\\022\021S\260\025\241\271\"\307\262\256h\331\262\017\344\336\305\363>_Q\267I74\305#\327\254\360>\242\n\335\013\310\360\270\225\337:\356m|\247|\240\257\333=\001\024\013\255\245\222\314\213\025\225<\201$\036?\366\226\013\322\020\354I\323\326\0212\020}T\214\244df\274\224\200*\234:@\025>\216bu\330\255H\025>%\223L\353\324\001$d\346.\3230\372\353\177\360#\374\032\001\b"
+	.ascii	"2\003\346:\203k\b\305518\"k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_getMixerMode.154.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375 \365\315\006"
+	.string	"\362\314/4`m\322\001@aZCB\023\342r\372c\211\330"
+	.string	"\031\303\271\226\235\002#\326Zo\331\256\2060\024\274\265"
+	.string	"`O\021\244\276\305\257\031\252^\247\232l\"eJ\001\306\\^\206\202\322\270\315\203\003\005\321\340\"(\006\215\303\274\tw)p%\221ynSU\317U\260\275\202R-\226~\354\213\216A?\344\nN\376z\3639\323[j\200\206\225\231\215yR9\354K\253 \333\351T\201\223P|J\266\213\221\215\326\244\225x\330\356\330\025\377\343 \035\303\005\013+\"\210D.FPv1g9\301\364&}`z\323\216\303'\364\037r\205\317\210\344\212\236'@\302\356:\257\230q\353m\033\330>\260\275\021\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_mixerModeIsFixedWing.155.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\205\f"
+	.string	"\026\227SA\020O5\035b\355\fL\205P\345\231\261\004M]\260\003\3741A\214\202\b\371b\035F\005\326~\251\007\361\032\343\345\232\332\275\037o\310\002"
+	.string	"@\021\364"
+	.string	"\345P\360\rX\003\315\256H\360i#mo\231R@"
+	.string	"="
+	.string	"C"
+	.string	"\330\257y"
+	.string	"\330/\037\020\271{\030\302\024"
+	.string	"dQ\001E\310n\250I\020\357>\245v\276\367y\360S\305a\224\261Z\361e\270\2440/\273K\371F\252\022\315\356ZK\037\206\373\272\355\004\266\r\330\007\005 $\035\261CO\345\007\373sw\327\022e_\365\253\325\237\235\207\351\302w\326j\327T\203\265\037\227\207\b\333\"\273b[\325>\307G\210\256\ny\262\353\241E\307nX\300\230\354\327\345\002\002\227\320\bC@<m\351\356z\322*<Zfh\030\220\302\243e\365b\343!\314\204\177\302\343GR\247\r\331C\330/-\331'a{\314v\275\237l\217'\311\326\007Gj;,\346\227\312\203\247\210\"\035\"\001\034\006\233\202\2117\031\216\003\352x\264\317\003\007\035\b\r\264\b\235\005\036m\303M\3202\004\274I\340p\332g\3338\255\022\356\347J\224\021\304\020Ei\360\031\013\204!\272\320\277\303.-H\225#\277\304\255\361\2645\037\006\031"
+	.ascii	"`I1#\236\342\n)f\200A\303\363\3142\237m\202\300\220\t\002L\201"
+	.ascii	"{uZ\341y\004\252\346\227\022\245\250E\234\205H\355\302\027\306"
+	.ascii	"\273k\nX,vg\b\231\252r\221\272\252\313\312\023"
+	.text
+	.section	.gnu.lto_isFixedWing.156.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`F\001\355\r"
+	.string	"&\231ZD"
+	.string	"\2576\035\346\031\207@[2\2671\314Dw\035\346\267\373\260a\222\220\252\354\277Mn\230\367(\337\363\244\200\377\2156d\003\306\353\237\177F\004\376_w)%\206\350\333\262\341\020R\373\201\361\233\376\267\266\345N)G"
+	.string	"B"
+	.string	"I"
+	.string	"\235\203\330\035#H"
+	.string	"\342\355\037\312\210\200\025\026\"$R\273\037\246\036\276}\252\334\374\224\317\022\t\306\024\236:\356\363\336\247G\022W\204\247n\303\325\302,\260\273\234N$\245&cw-G\235\206\333\272m\006\266\r\3307\005\366\277\213\320\374\017\246\340!?\272\345{\\\267\256\027$!9c\177\"\251'\366\347\252\211miU\351\317"
+	.string	"1-\335W\341\356\310\214\314\276X'@\330\276\037\342\336\307U\254\200\004\223\332\335\316-\373\303\016SO|M\314\227Bqr\224\273\313\251[,zZ\220\f8Y\364\204("
+	.string	"\\\273@\277\204\305\257J%\0346\327\256\263\310\321=\177\204w\271\227\3307Y\334\240l\006\361!:\276\250\224\266\303\036\270w\016\250rQ\241B\344*\326\300\3106*|8\260\016\b\017>\021\034`\022>\r80\215L\3030\b\0304a#\303:@\240\f\373B\237\253&^\240\002\004\325\337\256{\337\310\254\244"
+	.ascii	"M\310\177\273T/\330V}\312\217AdtQ\241B*\362Y\356\fN\216\001!"
+	.ascii	" P\0022\347\312\003\254)\032\2233\300\204,\021\321\016]\356\255"
+	.ascii	"{W\nw\313\245\335\2101\364\301\232@/n\2548\t\020\200\r\202\310"
+	.ascii	"\341d\013\271\320\353B\325\023,\200\244KOn\2131\361-\007\031"
+	.ascii	"\036w^\344\331u\314\371\020\\\325e\370\t"
+	.text
+	.section	.gnu.lto_areMotorsRunning.part.0.218.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\013\002U\022"
+	.string	"F\342vH\340\322&\035\252R0\206\"\241@\221\315\026\346\374\323\001#\241O\275\374\331b\223\026pf\330g\255\256\324\207l\234\256\214\316\222\025\331\006dM\222a=\343\206R\306\207\023)\364\312C\370\030r-\263\270#m\357-wJ\001d"
+	.string	"\\"
+	.string	"b"
+	.string	"`\2059\205D*L\237N\240}>\205O#(1\247\221\024\177\007G\300\374\206\307\313\307\250V\220\373\\\021\326.\301[\306\357Sn\244\237\177\360Rg\306\314\005\246\362\031\002kqE\031]Lt\370\312\0061\235\233\020\330\212\\\236\231\214\317\036_`-1\0228%9\250\265Z\363p\223n{\203m\022;B\b5\366e7iFS\031=\345F\357F\307\377\334\007`\372 `\246V\230\243\037\225f\016\225\270\354\377y\264\357\377|\205?\363\346\203\342\230\313|\037\236\367\244\234\205c\224X\300\n\223\020\032U\006\332g\351\005\350\247\374"
+	.ascii	"\372y_\206\342\203\336v\036\373\034\223\342\357x\373\364c_I%"
+	.ascii	"\364s\356\201\"\031\227\254\265V\251\340_\271G\021\036q\230Y"
+	.ascii	"\001\002QC\264k\263\017\321\203\203%\366\260\357\342B\016\375"
+	.ascii	"\034\247,d!\372\271\213\240H\346-\034j\265V\022\037\350A\236"
+	.ascii	"\237\363i\f\254x\227O\237E?\343~\366(\313\241\231\211\r\271\342"
+	.ascii	"\221\367{#\007OP\\\033/]`\203\006\2167\335Q\252N\245\312\020"
+	.ascii	"\201\265\362Z^*\200KDV&\032\272\024\327\252\200\352,P\340T\335"
+	.ascii	"\204\024W\262bq\"\006\354]0Yq-\317[q\233\355\370\2551\275\361"
+	.ascii	"\361\n\245\377\321\255\b\310+\214\377GI\244=xm\307\211\312C\207"
+	.ascii	"kWH\314\265\361\304\241\246o8\373b\333t\277\017j\314\245\373"
+	.ascii	"W\220\2778\fTwr\0220 @\002\202\224\326\016Y22x\325\333I\322\""
+	.ascii	"\231\204\361;\315iq\367\211\264\002 \376m\307(\001v\fmJ\314\320"
+	.ascii	"\200\253\307\340\032S\211\b\020\233U\210\273\304\030\252\205"
+	.ascii	"m\201\271\364C\002\277\267\333\225{\033\2308\030\221\372\320"
+	.ascii	"7\364u.O\026\313\361\253\312x\032\013?\330\246y\341\026\230\205"
+	.ascii	"\266\237\367f\013<h=\356]j\f"
+	.text
+	.section	.gnu.lto_mixTable.part.0.232.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`\362\"\225\235"
+	.ascii	"\032\375H8F\0208Mk\f[\031_c7W\314v\306NG\342\353\253$O=\347B"
+	.ascii	"\371\223{Z\332\275\352\260Y\024\330$\030\312U\271\362\313\241"
+	.ascii	"\320\223\326\277(\037\033\212\364\205\300\nT\234\375\001\234"
+	.ascii	"V$\327\301\375BHJ)\005|\003-\003s\003L\346\034\004\306\372)\336"
+	.ascii	"A\263o\310%\235eo\343\244\263\261\001V\227\200aN\322\304\306"
+	.ascii	"mMP\016Hgy\005\\\235\024\020\035\311\240\024\251\235\233y\232"
+	.ascii	"\227\371\031;\332K\266\350Ofg\371\370e\320Oj\347e\314\213\354"
+	.ascii	"/'\231\375\347\310\\2\216\f\240\032\222\311\254\330O\244\213"
+	.ascii	"\215\330\211\314I\026\322Y\036\"\365s(\204\271\253\263\034T\246"
+	.ascii	"\030\310m\330{\270\371p\022\006\262\257\316\362\263)\032J\355"
+	.ascii	"\336\367M\352\341\206\201\223_]\310zl@V3n\034\355+\0037\0302"
+	.ascii	"\3560=\246\313\364\231^\323l\372M\307\3519\355B\333\351\300&"
+	.ascii	"\344\344\240\240\340\222\254\036d\037\363\2205\036\"\256\241"
+	.ascii	"\372\266\001\366\035g\343!\242|\351\274\315FW\347\244N\025\331"
+	.ascii	"\313\366\205:G\352\0341\276c\232\256\316\n\335\232?:t\352\260"
+	.ascii	"t\025\331G?\262\356\013c9\315\347\354\2760'\263\352\033\005\262"
+	.ascii	"\302\311V"
+	.string	"\273\004d\037\225\336\313v\017\016\034\352\0247m\332\354E\3658\005\013\262na\214\235\312\252\357\222\350\373VS\260pv\013c\375\246\275F\024\353\366\262\357[\3552d\037\325\220u\232\"e\321\367\215b\033\215\263\323\0241\276c\214u\213t\357\0335\202\354\243\277\215\324.\333<3f\030\353\024\364\276n\336\320p\221!c\201\261E\317\276C\273\303\013\256b\216\2109\322o\333\353s\252\334\301\311\326@\366\nd\034\2652\326\351\254\372\316\265\177\202~vS}d\027\310>&\331\275\253d\355e\003c\365e\213\262;s\3375\236\263\275l\300A\357K\205\212\346}\253&\372\310Q\310>:5R\333Gc/\333>2w\0353\223E\331\311<\330U\271\227\211\252\250\026\346\360}\337\252>\376\bN\"\030\331\306j\363\013\243\263e\304\200\361\302\312E\013\026+T\244@q\242\212\312D\211)\251(\022#D@\205"
+	.ascii	"\361\341\311\311C\207&&\016K\0334(%!\035-]#e\021\321P\206\244"
+	.ascii	"P\020\022\250=\032\337g8\271\035\312V\3262\250\264)v\214\030"
+	.ascii	"\032F\f\315\347\320_ \266\025b\273 \364\026\211\203\316B\320"
+	.ascii	"W$\006\272\212-\321<\236\302\210\264$\013\264\351D\023\215R\331"
+	.ascii	"4|\3608\212;}\002\260\253\372\024\001\235\212\257M\030\245\344"
+	.ascii	"\030\221\022\371\274\304\324^\034\227\272\323Qo\232\304\0337"
+	.ascii	">\002;%\317E\210\320v\246\241\316t\b\343\022\034#\324\234\270"
+	.ascii	"@3\016\242L\1770BQ\023\3314\235h\031\343\222\030\264+MH\306\237"
+	.ascii	"\214@hK\2624\235(\013F\253\304\254\032o\273s'\021\332\306\264"
+	.ascii	"\007/\335\001\317\233x\361\2461\315d\327\034\354\352|I\205\336"
+	.ascii	"\240\002\3255\244\320J)$e\321\342H$\364\221\035U\005=K\240\253"
+	.ascii	"\007\342\312T\355\020\251\264\315\265\213\245\251D\257\264HW"
+	.ascii	"\364\260\360\023"
+	.string	"\225\350\334\0339\332\234?\255\270\222\0049/\212\322D[\242Q\350D\245>\004\327\031\240 \201\363\344\023\225\266\267\0262:\321\211\276=\361 \240+*mN\032\331t\242nI\372iK\324\211\003\t\261\205\320m\232\257\251\371\321(%\215\003\002\322\234\270@47\"\231\364\023\261=\215N\357\3736a\373\032\333\231\273\3333\200\256\336\367\3456\363\323\f@3\033\2330\267\030sS\234_\204\374)O\300\246M\276\257u\220\224=\274c\320g J\302\202\t\037s%\372\024pl\250x\330~v\360\346\367\276\034\300\237?\203g\357k\006\"\303\017%\020\007\007\233\266\345\t\364\323\366\223\317\236f\370\204bb\330\247\375)\037\341\030\331W \242\004\250\305iBs\201;\223B\0236\024\231g\007C\004J\356}\315\032\352,\301iBRO\240\013R;\024\277&\364A\357\326\004\020\033\303\037\337\231'\236\340U\306f"
+	.string	"d.\341^\234]\232"
+	.ascii	"\337\367\265\272s<'\225\235u\316;o\250\363\256\355\243\320\007"
+	.ascii	"\341!?\b\350\221\177\324K+\004z\240:j\213\307o\277\363\322\262"
+	.ascii	"f\376\307\213\327\205ep\244\032\277"
+	.string	"=\204\323\243\036\177\332X\355\177\363\261\336a\026\300Q\300B\276\357\333\202\375\004\r\n\340\236\313j\373\370\037\204\307\276\305M\310\342\236c\003\020\360\206\"\360,\254\270\231\371\037\376f\002\341.\005#U_\027\303\347\261\266\377\313\002\t\255x\316<\221\227\234\271F\003\336\320\376&\354\026\341ZB\0261\373\3742\377)\377\f+\271\304,\177\025f#E2\030\023[:\207)\235\301\210\364\236\346!\256\363\327\322\331\313\310\271k\351\314\245\344,\304\310\031\003#g\346\221s\020\2453\020\245\363\217#\347-\037\275B\263\226\353\334\303u\316r\235/p\235-p\235y\270\316\025,\235)P:O \201\353\034\201\353\f\201Ki\336\341:\353\310\201\303u\276\341:?\340:;\320\327f\033\256s\003\2563\003\256s\r\327y\001\327Y\001\3279\001\177\322\214\200\353|\200\353l\200\353L\303u.\240\253\335\004\270\316X\256\363"
+	.string	"Kg\001\224\316W\001\270\316"
+	.string	"4\231\346\031\235\327,\303\2314\307p\235a\274p\235\255\\g\027\256s\013\327\231\205\353\274\302uV\001\344\234\242\3634\243Hr>\221\344\\\345l\315TG\316&\216\234K\264^\363\324\322Y\352\3109\312u&\341:\217p\235E@\271\316!\226\316 \224\316\037\\\347'\245\263\023\222\263\207\016G\316M\355\246\231\311u\346\340:/\271\316\033\\g\rKg\245\245s\222\353\214t\324{\315\313\366kv\373\257\331\310uV\272\316E\2563Q\277\320<\344:gp\235\223\256\263\220\353\034\264tF.\235\201\\\347\326\310\371X\344lT:\177\221\263\367`sw\024\243\227+E\322\367]\362G\361\225rT\243\245\007\273\363t\277\320\375\327\355\327\275\327\355\246[\257[Mw^7\231\356k\367\n\355l\355L\332\237\264K\231\323\002\302Z1\236Z\232\030ZA\226E\217\232@\241*f\231\261n\331"
+	.string	"~\207\324+Y?k\216NYn\356\235\022\302\2145V\345\346\222S7\037,Vy\034o\031_\267\252\\[\377a\317\252S]\274\365H\320\314\246\250\210s\362\001\nU}\354=\315\304\334\354Q\246pR\212\220u\020\r\234Ca\b\244|\207noO\234\034qrd\016\227;\273(\310\250\177\300\336\204\223\001kl\300\367\260\3625i\3661\340yH\345 \272\321x\020\240\205X^\30037ch\372\361\206\322x\2473\266\002\336\206\264\r\342\225c=\001e\316'\232\022\254\357\240\347\304m\206\017\360\314N5g\007\336Pv:\373\262_\033@J\212Et{j\353(<\036\002xf\312\340\251\214<3\215\375\214_c\017E\236\215Lb/\343\327\370\251\036+\316\325\013\360\255\266\370H\276\003\2545g\222$m\037\257\214|\322\025\234:"
+	.string	"\360\3344\343\215\374\032\033;\310h(\3275J\232b|\221\022M\365\001\274\267\365\r+\3405\306S\3515\214=\002\364&m\204#=Cu\3630\343c<"
+	.ascii	"\375\227\007\314\230\016?e\031\037\343\377\213\241\027+\037"
+	.ascii	"\214w\3611\036\350\017\260\315\213\267z\030\377{\226<\232\325"
+	.ascii	"\267\235T\fb\213_\361.\236C\034`_\232\224\305\033}\2137\206a"
+	.ascii	"\373'\213o4R1T\025?\364+\376\375|\360e\214E\376\353|\3424\201"
+	.ascii	"{\216H\333G\025_u\007\357\304\243\370\024\337i\\\224\315{m\325"
+	.ascii	"\237\370N\333B\365U\357Mz\307\023\260Om\321\354\257m\320\330"
+	.ascii	"\2328L\265\267u/QK\243di\2523\360\323@d\306~\3159\270b\017]\275"
+	.ascii	",.\211\375\0323a\023\0259\374\364\313\b\377\254K\306>8\340\f"
+	.ascii	"\017\0177\374\224]\251D\263\270\326\341%M\265\324\257\231\370"
+	.ascii	"\036\326\022\277|\023\377yjnS_\342\213\236|W\265'R?\365\355G"
+	.ascii	"mQ\203\322W\341~\254\2447\035\365\237\205IT\025\265::\244\237"
+	.ascii	"\362\210k\bY\226#\272\3125\004%\256\210w\243'd\226\212\247\206"
+	.ascii	"U>=\t\022o\330\002\\\340\323\016\231B\263;\315We\356\347h\304"
+	.ascii	"{Z\007e\261\226i\223f\230\355\006,\204a\t\365O/\342\335\2702"
+	.ascii	"W\017l0>\2772\367\303\337F7},\270z\330\013=+E\312K\245\322\275"
+	.ascii	"R\004\331\007y\020\371\276e-\355nj\003\221ro\364\351\3525\244"
+	.ascii	"j\311\372\223\035\017\267\224\331\35703\331\240C\337\250\036"
+	.ascii	"S(\307\357\314\027\343\362\200\251\032\206x\250w\301\264- >\304"
+	.ascii	"s\020L\313~x\020\357h\215\374{\222!T[$\202J\343\030\3755V\373"
+	.ascii	"\341{X\345\370\223\235!x\235\017\357\317\216\232R\207NzG\307"
+	.ascii	"\377\030\353\204\317\360\231\266\217O\017\001\\ \325M\371SnR"
+	.ascii	"\243\342\021u\370\241k\227\305!\246\177\201\325:\275y\037\337"
+	.ascii	"\225\023.G\333G\247=\217\223\303\031\3059eJ\333G\017\337 \300"
+	.ascii	"\331At3+\372)33}\007C\270:V;b\n\2112,\275#Ijx\016\277\266\243"
+	.ascii	"m\372\036q\356f\f\371\276g-\330\331x\033\347t\004\247\025+m\037"
+	.string	"\233\236\007\\\035\016\317D\343o\357O\332\226\347\320O\221~)\303O\271\375\352\352\324\260B@\200\035\3266a#\017\353\262\250a\203\334?\332\360\032\336\221\250q\254\247A\303zm\0377(\275\206\244W\372N+L\372c\336\321#m\201s\341iGL\326,\371S\241\257\302\023\260A\026\275'\331\342\205\020(\350\225\277\346t\275\374/\023\314\343\304\262\374\020\327.Q\022\334L\330\n9\367e\300\265Q\276\221Q\r\234\236\325\216\230\240\237\266\001\034$,\210XVW\225\327WW\327\227V\020*#`U@\206,\177\f9 i\204\331\365`_bZY4\304\226\314\026\200\353\013L\314\353\013+\210\226\327X\026\327\262\306V\006L1\255\254$\027\327\327\003FA\264\304\2306\\1f\027s\201\256\261\033>\2306\212d\035!\362\261%\246\265%\266E\200\027s\310\215\"YG\212\212dE\340\203i#\214iD"
+	.ascii	"\037[\\YZaJ\037[\\=\262\274\n B\032\311\362b\3260\302\254\001"
+	.ascii	"\366%\366\325\225\364\261%\0266\206\201\217,\2571w\013\210WV"
+	.ascii	"\020\254-.1\261/\260 8\266||u\2011\263\220\302rlu1q\210ym\201"
+	.ascii	"\201\215i\r\261\026\025\330\226\021fW\225X\020 L\256\037U^\314"
+	.ascii	"\254\256*-\260\260*\252%\376\032\262\005V%\366\365\005V\225\354"
+	.ascii	"+\263\177\312(b|_*\001d\301\304\370\341(\276\263\275\246Y\327"
+	.ascii	"$\007en\236\320\354\342\301u\317\213\230Es\021\006\013\033\030"
+	.ascii	"?\345 <VD\376\361\270\230\352!a?\004\354\303\336\200\275\022"
+	.ascii	"P\007h\240/\206<\221_Z\315\364}}\357anJ\277\rc\213\344\364\236"
+	.ascii	"M\021j\263\256\256]\303\330;>\363\365\315\247\241\246\274@'\275"
+	.ascii	"\023\341%\264\342?\354\233\213\257\302^\317\365?\254q\272\336"
+	.ascii	"\313\313\247i~y\354\243iZ\3034\257\327\266\217]o\302\n\236\220"
+	.ascii	"\347b\252\317k\262`\305_\346\3154\313\3445\261\330\266\217B^"
+	.ascii	"G\224\274\276JOh1\242\305\340\216\362\355\021-\3631\020\363\327"
+	.ascii	"\2604\3155k\332>2\237\203(yT\267Wb\227\207\205b\235\026\n\242"
+	.ascii	"\336\212\237r\220\377\341\364\006\371\006\\,\301\357,\003\025"
+	.ascii	"\006,*~\312M-\220\177\301\212G\260\177<\220gWs{~\301j\3529\223"
+	.ascii	"\374x\260(WD7(\276\227K\212\2372\324\265\217\357\204\326\017"
+	.ascii	"]\367\316D\371\330\302\341\312n\276i\231\233{M9\336\320\255\357"
+	.ascii	"1\213p~3\334G\237\263\203&l\241\253\036:\304\354\031\212\252"
+	.ascii	"\254oE*\036\337\343\327\230m|\217\327:6\221.Z\355\210\241{\236"
+	.ascii	"\260\361YU&,\370N,\301\343/\3705\033\337\212\027|]\034\251\037"
+	.ascii	"+U\005\177\343-HvQ\2733\301#1N\216\347\201\343+x\242'a_\032\335"
+	.ascii	"\323H\316O\257\304\215\357B+_2L\036%S\377\245O\23656P\244\276"
+	.ascii	"G\274O\336\242P\240@\332\347\360PyF\315\025\022?\345\251\226"
+	.ascii	"\002\361\245O\335\210\237r\362\n\224\004\177\274\022b\252wP\360"
+	.ascii	";&x\n\270L\360Mw\334\262@\245sD\374\224w\274\004\237d\035l\223"
+	.ascii	"&\215\340\223\240\205:"
+	.string	"\036\202\217\340?/\r\316\323\3774\321 !x\237\262\007Q\215{\020\230\230\004\352\t\256J\013!\276\212\216\377\262>#Xuhi\316\221\223\343q\274\216w\343\006\257itO\022\232\177B\177\202}\240\2057\260@\013\037x\007\376\306\267\225\007\276\310\212[\rgn\332i\336\361\206:\360\033\240\340'\202\215g\343\003(\275\003\301\r|\025\177kW\017\312\3007\360-\237\247\377\361\263\032\317\300\002\257\300\327\370N\223JY\340\223\254\270\231=\002\257\300\2674\201\357\254\224\357\200\247\361\b\320%\3404\336\241<\224\246\036\344?\371\267\246`\223\260\251\307\033\332\324\323\204\241\271\307\033z\300\373[#e\023\021\375\320\276\214\277\225\262\304q\371\3404\343s8\311x\034\037\202\325\250\362\370$R\242\2141\205fFd&I\n\035\202\n\020\206\204\211\240\246\324\003\022\240t9MCC\"B\"\"\222$\251\324\2435OB"
+	.ascii	"?T\3214\t\020A\261\027\261\031\231v\022\377\304i\230n'\324p\226"
+	.ascii	"7\255\254(|Ke1)q9s`\253lV\265\307\335\262\352'L\246\245\200@"
+	.ascii	"\027\361\246\276\026\226\267\264\233\013Rx,<\246\277\327\003"
+	.ascii	"Xl\276\307\332\206\317\3276tLK\005\244\304\224\271\231~\276\022"
+	.ascii	"\212\2567c\033-\0344+\200o\203\315\376\354\250^\003\3745\331"
+	.ascii	"\251\336Ru\245 \245\270\315\304(B\274\237f\n\225j\345\376\223"
+	.ascii	"\256\003\3279\f\r)\246\0071\363\316\206T\320\fs\245Mc\343\225"
+	.ascii	"\177\352\035U\263oI#VL\02099\240\342\375K\022CM\020\273k\274"
+	.ascii	"?l\230\251Br\364\320IM\367a\343y\373\013\265\020\351H+\365M\036"
+	.ascii	"5\256m\321$\242\254\323\0273mi#\0305\244K\372\262\337\362]\277"
+	.ascii	"S\207\345\257!I1\213\322\326?\3679S\235|$\223K\253\361\364)Q"
+	.ascii	"tjs\332\231\214\t\247?\344\231\327\rA(\232b\332\273\233\316\325"
+	.ascii	"XA\001\277',g\337vI\022N@\265!\257[\371\301\370.W\020\352DL\036"
+	.ascii	"\212D\227\"\321\020T]\214\233RP\277a\3127}I\002BIu}\rS\275\025"
+	.ascii	"y\247\340\201.y\240\336\rk\240m"
+	.string	"v\335\0037\n\213\220\201\036<\003|\375=\371\002\201\027I\331\247\234\232\233\017\333\005zi\024-_LDmh\334\312-\361\353_3\021\\\301Sd\333\022`e\306\336\375\277\252\217%\344\214\310A\336\222\030\201\361\2313\031\304\365\253\355YI\327"
+	.string	"\313\253,R\214\226M@\224\310Rd,\372\263\n\022q=\364\006}\306\357|x/Q/\177\356\fL`\314e\bA\255\365ay>b\263\354rS\006\226#j{\262\0209%\2743\"@\316\007\003\371\313\261\b\343\020\335\270\235\340=\354lEd\213\021\001N\030\266\360\374\207Np\264\361\351*\f\325\006\fj\320CV(\2720l"
+	.ascii	"\250\364\177\377%Z \355\341\026\207-M\370\360\220\201\335?B\334"
+	.ascii	"\004F\253\316\375U\313\265\252P\2138\276\307q\367\302N\374u_"
+	.ascii	"k4\361cM2\302*%\367\005C\337\255\263\006\325q4\371\205\r\215"
+	.ascii	"-\246\230l\227x-\365\004\353r\275\001\f\313\206\256\205\037\254"
+	.ascii	"\326\220\007MI\034\300D\n\316\223gM\021j\330PJ\201\367\375\364"
+	.ascii	"\027\3537\326\310~'\b\r\363y$e\341\275Cx\007\n\224\270H\341i"
+	.ascii	"\222\347\311<;KI.\210\304B]\345'\221$\212\334|\344\266\346\003"
+	.ascii	"!\373\231\245\361p\330\337\214\261\307\f*C\263\032\204\243\265"
+	.ascii	"\340\375\214\003\242\252\n\304E{(\346js\3407@\220\320iQ]\"18"
+	.ascii	"\372\347\364\277\366\224\013\016\004\031a\202RZ\364\002'D\016"
+	.ascii	"\216\324E!\370\276\233\224\022\222\001\031\246m\204\300$!\025"
+	.ascii	"i DC\244\232\202C6m>\327\215\234\303\357v0:\231\335\006\306y"
+	.ascii	"M\332B]\325mS\0216\370P2\250\307\2529\024e\312\033\365\276\003"
+	.ascii	"\031\321\366\376k{\227h\200\322\003=\3323P\026s"
+	.string	"\332`\"M\227\267\354q\331\214\222\373\225\302&\333\313<\366\242|I\304\034\267u\266X\352\002%\362|\270\002\334f\347\360%Qq\352\351C/\212D\244.\366b\265K\364\027*\013\330\301@h\320\260\210J\217\226\006; \032\326\326)q\230K\264J1[\374\326\220\350\257\236\341\031\002\302\324+\t\016\360\226\022\013}\270w\233\002l\313'1/\026\306K\233-\216Qe\353Uy3\247a\237|AYh\240\374\037\013\305\301Y\266\021t&J\037\032+(FY\201QXQ\305z)\226\300&\312\216\300\310\324\013\354\3619\273E{\336\250#\026\366\313\346\213*>\3318Z\303c$\005\\\206`\371Cx\002[\272\220{\007\274\226\220\234\204+G\2466m\"}\202\220\316\362\004\335S\310O\271\313\211\250\320\211\300\203\322\202\\\254\213O\377W\2137;\340\305\243E\367\003\257,y\271z\263\376{\225\243\bm"
+	.string	"\3446\364b\372\030d\377\035\371\352\022\322\036\261\021T\024B2l\340OJ;\234\031\320\314\305\212\251\005\001\335\340\277\355\237\317\215\256[@!\361i\302>\251Z\260\030\237~\004\305\202C\3734\003\030\030%\256V\270|1\bn;\201\255\004\237'G\021b4\261\223\376\020\r\200\214\312\251\270\200\215I|\212\016\320U\022tJ\314\367\231\245\337\3533Q\360\205W\204\240\300\342\334|,6}\311\354\341v\333o\303\310Z8_\234Q\306\235`\326\313\301@(\001\336\342\247\344\3011R\240\327\331\006|\213\330\356ll\372\231\323\006\"\237\027\277Om\3506&\216]\025M\006\023FOC\254\256\007\025M\223<X\0035\373P\333\362{\216\32530K\233\320\334\347\357-39'\315\b\025+\226R\307\373\330w\276 )\2444\3755\237q\016i\234\352\363\260\315S\205\342\334\302^\203t"
+	.ascii	"\311\254E\031\026\025\246v(Y\331\211\367\346\204-\312\3645\254"
+	.ascii	"24\001\217\002\301y\336 \377&\245>e\365d\227SxZ<\353@\016:\263"
+	.ascii	"~Z\031\322\203\363\260\365\222\257\325\233-\361\341"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`5\t\245\037"
+	.string	"\326t\2729@\254Ic\3350vv\203C>\221\b\013"
+	.string	"\221\314\020\313P[\023gJ\361\343\267\267!\244\371\376M\345\031UUeM\207\270\345\306\322P\200\337\374v\t\374\337\266\265\334)\005\253"
+	.string	"\256"
+	.string	"\244"
+	.ascii	"\347\214\2439e\334\343\231\251\321\250Z\260\213\244\026\343~"
+	.ascii	"\316t\021\206'a!\377\366^\334\1771]\034\356\264i\213\013\002"
+	.ascii	"\220\246i\312\342\336\314\\aI*\f\351t1\202#90\250\024\246CaE"
+	.ascii	"\216\023cTv\342\276\3144\361?\247MKX\024\211\373\031\361>\"L"
+	.ascii	"*\204\377@x\324i\323\017\256t\272\330\300}\017\354\347\341Y:"
+	.ascii	"\\\017\207\217m\270\027\r\337\222\341] 8\024\206s9]D\375)\353"
+	.ascii	"y\260\016\350\264\366\325\364\302\361Xx!\341\325\317\234\266"
+	.ascii	"\201\251\321\230\272\331\327N4v\273\\.\227\025\356\311L\333\001"
+	.ascii	"&\004]D\270\266\210=\270\226H\360U\260\203\371\221j>+\346dt\247"
+	.ascii	"\2421=\265\336\365\246*\326D\305yS|I\212-}y/\212\361\2408\323"
+	.ascii	"\023\257N\\\327\304w^\266;\273\356\315\020\357\3130\271'c.\271"
+	.ascii	"\037\243\344\376LNMN-\311\275\030$\367X\314#\367bF\356\303\314"
+	.ascii	"\"\367`&\021{:\207X\356\344\272W\371\302\346\b\271\267bn\335"
+	.ascii	"\033\203|\315\t\344\276h2\270\232\363\307}\252u\275\264\036\\"
+	.ascii	"[\234\217\353S=\256M\231\306t\017\217\353R\346\216\337\321q;"
+	.ascii	"9<\207\343Z\206\227s\343ql\374M\rS\242q7\001\300\343\017\320"
+	.ascii	"9B\363\245*\373\265\336yga\220\246\263ur\244d+d}\020\214.u%["
+	.ascii	"\002\353\035\347G\017\322u\266@\365\267\263\265\272\365\235\355"
+	.ascii	"\361\376\230v\237\206v\217\266\346>\215\232{:i\356\347\240\271"
+	.ascii	"g;s"
+	.string	"\017\307\314\375Z\231{52\367\3101\367m\316\356\r\211\271?dv\217(\314\275\022\314\375\240/\367\204\312\356\003\221\335\277\215\335'\275\334\327\351r\337\306\345\236\315\226{7-\367{\236\246\251\255\340Y\356\371\034\213\027]1\243\323\326\362\322\n\342\265\325%\346\270\363ant\332Q\210^\001>\332\261\220\177{\250\223\366\306#(\316\361\251r\322\212\250s\322.\260\223\026\270\212\362\233\005*C\371\315Z\205r \344\337\336\"\373eY\020WY\026\250\032\324\225=\032\003\n\326J\017\265A\225\023j\023tB-q\017\265D;!j\273\216|\250\001\266\264;\366\204\332\257\265O\371\t\265W[\331\324\013p\353[\363\035j\337\226\374\005\270\265FC\324\006\327\274\241\r\252\277\231\034?0\3264\264T\312[B\216\300\310\274ih\251\216\230\204\226J\275M\215-W\343\t\355\225/:\223\320\032(\240\\\253,\201\343"
+	.string	"e\320R\225\005\256\312\200\241\2501\f\202t%\005iI\251\322\001\360\002!\242M:\021\220 \350\221\021\021\211DDh\222\036?\3706\345\347gq0\243W\f\0220\244\031N\222\002\352(\241\257`\001c\210J\220\321\3317\033\307\341\316q\242\225\337\277\255T?\243\317\263\27414a\026\226D\036A>~\265\242|\360\326\250\234\242\f\203\323\204e\030\2322,\243P\226\341\0241\013\006\305pkc\336\264\b"
+	.ascii	"O\030U\356k\200-\2472\314\274\354&\316\223\330\007\231\021\230"
+	.ascii	"TA\227@E\024\362\302\035\266\\<\377\334h9\273\032\322\035\322"
+	.ascii	"\230\375R6\326\330\372\2167,\234\206\344\332\202\024\264\027"
+	.ascii	"\200\203S&\232\3513\220\315\2119\237\311G\217\353\"\030\355{"
+	.ascii	"\326\205.\207\327\200\024\363\217Y\3422S]7\202\347\261\335zV"
+	.ascii	"\007_\\\204\315.\355\373A#\305\252i$\037\001\035L\351\245|>\332"
+	.ascii	"\347;SE\226\205\250\217\247\310\373C{s\255[O\025"
+	.text
+	.section	.gnu.lto_.refs.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`8\003\215\026"
+	.string	"\2668\233E\320\3306\303\001\200\t\304.\203p\274\264\025D\320\025"
+	.string	"\t/\270\302O@\320\033B\020X\004\232A\256f\220\233\215f\220\313:\277\3000tM\024k\333f\337\217\346\251M\315!\232u\330\367S\023\021\221\221\266e\n\205"
+	.string	"\205"
+	.string	"\213"
+	.string	"V\202`~*\241\037\212\350\177\342\244\311\022%I\220"
+	.string	"\221\376#Z\337\310\350/Bd\210\250\037\344\373\201x}\037]\277\007\327\377\331~\037\255\317#\373q`\277\215\353\257\001\366i\310\370\3721D]\302\367\021\274\316\323\365\035\256\353\220\036\202\326sF\337 \3648`_p\365\233\320'\370\272\215\250\037\370\276\345\365\262\353,\256\257\266Wi\275&\373\001\241\217\301\3364\2374\377\233\337a\257]=\233\177\365\367y\f'_\253U\2523\362\347\351\213\272\346zg\354:\250\177\320g@\376\315\330Y\332\253\270G\235~\344\276\224z\230\356G\336{\337\005\300G\004:H\3237\232/\201\007`\037$%\n\212\374\231\214}%\247\316\373\177f~\035\342\177C\024?5\363\330\314\267\013\030\335\026`\357\n\360\233\342\353E\341\365\236\350zMh\275$\002|G"
+	.string	"\370\212\340zC\220\276 \262\357\007\0172\275\034b\376/]L\277\226\322\217%\374\257\004\313\204=4u0\347E\245\336\255\236\013\373\225\372\246\na\033\f{g\352Y\316\207J}\256\276a\037ds"
+	.string	"\372\266\315\267\321|;\3157\322|\313\346\233\203yW7\330nj\2342\350\265yA/\271\202^\030\344\367\305\330\353\242\305\374\262\270\371\252H\360-\321o\210\016\033\274\330\364\271 \350o\321\222\005\004\373U\202Z\377\224\003\363\243\264\2364Y\002\376@3@\260\347\200\275\005>\313"
+	.ascii	"\212\365!\353\263r\236\211s\021\353\265\325\001\0174O2g\246\206"
+	.ascii	"\353#\223gf\230\030z\241\027\301\026zaZ\241w\343\\#\037\033)"
+	.ascii	"`w\234\023\372D\365\236\2260\271\236#\314\213\314\211\314\207"
+	.ascii	"\314\205\314\203\314}\200\314\177\314}\314{\314\177\346>s\036"
+	.ascii	"\363\035s\035\363\034s\034\363\033\263\247t\013\325\r\234^U\366"
+	.ascii	"\232\262\027(\237F|\232\262\243\310?\211]\246\347c\310^\"{\330"
+	.ascii	"\363 \331?\362=\236\367\304\316\361\374L}\311\356\230\016\225"
+	.ascii	"\035+\373,\277\342\267\254N(* \220\242\251\261;y\340\204\030"
+	.ascii	"\303x\026\356&\342UA\243\025x\354\343\002!4\215\353\034\236`"
+	.ascii	"b4\263\215\027\022d\326XW\204D\\\034%\365\300\224\013\337\355"
+	.ascii	">\247\227\300\016!\007\216)\\I0O\005P\356\030\021\017O\026\273"
+	.ascii	"\037Wb,q\004#\2048\202q\b5c\177\342\"\201\200\003@0\244"
+	.text
+	.section	.gnu.lto_.decls.4b5657440d04b79b,"e",@progbits
+	.string	"(\265/\375`rz%\364\001\232+W\262R\020(\245\3514\006\204\030\226\021s\013\bB/o\324^#o\003&\225\372z1\302I\327\326\217<E\372\230`T\031\317\346BC\244b\214\330\255\373\272\005"
+	.ascii	"\310#\210\2566\311_\3430\n\304\267\212\230\277\026\247sHr3@\207"
+	.ascii	"\342&\367\336rK\231\002\311\t7\013\227\013w\3641\304\351cH\323"
+	.ascii	"\3070E\037\003\227>\006+}1\267\350|\220\236~P\034\375 2\372A"
+	.ascii	"T\364\203\210\350\007U\351\003\325\351\003\271\351\003\235\351"
+	.ascii	"\003E\321\177\371\003{\271r.\032\373\304\307\031\316\267N\322"
+	.ascii	"\313\037\245\23021\372\340| "
+	.string	"&\372@E\364\343n\321y ,}\240\255\177aN\377\202\232\376\2053\375\2276h\\\267\322\212\003A^;\260\326\340\\\336(q\274\264*\253J\253\022Z{G\225VC}\366\216\032\272\327\202{-\310b\\O\276\234\371\027\310\364\265\222\364\322\306\220\0335<'8\377\002\230\366%\321\277\220C?y\213\316_\250\241\357\353\243\357\233\243\357;\243\357;\323\367Q\321\367u\351\373\260\364}R\372\272\216\376q\037=\252)86\316X\017\303e-Z\030N2O\330\262\360\301\343\213SG\207\214=y\004`k\322u\325\260\236\253\235p~\204\351\302\031\357k\224\007\017\215[\02018\343\375X\016\317a<X\253\303\205:,p\304\340|wT\266\335q\331\203\363u\234>\t\272\031?\266\203\353p\022\333\3353|\007\323\t36\207F[\235\253\tM\021\355\032R6\216{o|\007\313\271\332\215\353\262a\220q"
+	.ascii	"\005\312\336\340h\203\r6\300j~\300\331\270\220\257\337\364\265"
+	.ascii	"\232\276>\323\327d\372\332\212\326\373\032\235w\307yC\255\224"
+	.ascii	"\341\352\002\347\215\020\272;W8\377\307m\260\033\314\006\307"
+	.ascii	"\3353\374\006\257\371E\356mvf\211\031&I\023h\360\033\006`E\270"
+	.ascii	"\254\362\336`\270\ru\247\004\330\025\227U\336\336\310\243\r6"
+	.ascii	"\330`\003-\206\025c\314\205|\235C_Si\374\206\261\033Vs\374\206"
+	.ascii	"\323\334\003\023\017\232\302oy\357\250{-\020\272\327\002\263"
+	.ascii	"\255IT\331\231\257\243\364\321:}\264\214>\312E\377\270L[\213"
+	.ascii	"\254\254,md\256\226\020\326\226\260\0378\3435<\346\236y\300l"
+	.ascii	"vI\244\256p>:\246E\260\367\365p\336\275\275\353\341\374\261\030"
+	.ascii	"\017(\2255\"]j!\366\304\221\nK;\302@\327G\r\034Z\230S\006\021"
+	.ascii	"\26358\377\370\313q\230\377\336a0W\303Z{\207\331{w\3203\360\374"
+	.ascii	"\360\301\371\356ktb/I\307_\022\260\304\210\030\316%\356B\006"
+	.ascii	"T\207\016\n\n\347\223\300\262\3448f\245I\234\330\265+\221b\264"
+	.ascii	"\214-N\222d\230\312\221*I4aaU\256\235P\024\321\236\202\361\304"
+	.ascii	"\f\227a-x\013>\303H\314\345\236a2\234\345x\354\256\035'\221\341"
+	.ascii	"+;\n\n\2046\244\236\216\274\275\221\250Y]\2155\242,t\213\316"
+	.ascii	"\243W\372h\224\376i\247\177\316\351\237d\364\317.\372\247\025"
+	.ascii	"\375s\211\376\361\224\313\003\t\032$\316\277t\377U\243S\347\016"
+	.ascii	"O\316\361N\317\2326"
+	.string	"n\362\216jo}\216ql\366$\355\251\375X\t\336\201\2550\017\334\004ga.\214\004C\301W\330\013\037q\024\314\004\353\300`8\007\356\201\277p\027\226\202}\340%\370\007N\202\205`#\270\b~\202\207\340 \030\b\336\302G0\021\214\205\265\356\031v\202\253\216o`\034\317\310\275\247\330\310\\\264\022yD\271p\315H\216\275\271s7.+\001av\222W\366\250\201[\303'\211\235\\-\267\213\320\024\321\236\342\272q\034\323sK^\2654~\356\362\314\241\211\361\305\304\177\357\374\240\271j\367\314E\373s\315\374I\030\006\236\002\363\347L\022v\202g`\033B\345\336F\306\216{\357_7\031^\326\366EK\243\353\223&\311\366'a(\264$\034\205\247\302\304\361yK\272\375\367.\017\356\330\366_\265[f\357\016\017]r\355\277jch\034\221^.\232\020\024\321\226rc\343(gN\3351\tS]\264\033\227\225"
+	.ascii	"\261.$\260\223[w\355n\\\222\006\\\241\223\274\242\346\242\t\225"
+	.ascii	"{\017\321;\356\215\374M\373\257\332\357\201\t\354\344\212\271"
+	.ascii	"h\350\216\3332\270p\325(\277\344\331Q\311\333\033\271\301\321"
+	.ascii	"\006\2768o\346\254\230\220K\3445:A\270E\347\317\255\261\215\213"
+	.ascii	"\306\201\335\001\225\262w\303\016gL#\351\270F\321i\225\205\334"
+	.ascii	"]\366\336C\025\240\265\255\341\214\336\242\363&\037}sN\337,"
+	.string	"\243o\202\3217\2754\226\312<\324\034q\202\363\315-}s\206~\326\243\237\335\364s\232~.\323\317T\3643\024\375\234D?\023\321\3178\364K=\372\345\032\3752\214~)E\277D\242\211n\321y\355\334\344=\323\340\336\371\255s\351nF!7ro\344\020^\342\307K\031\316/\207\350_\r\316ro\357jp\276\314\241\361-:_Fi\":\372\b\316\215s\317\216\256\334\036\272m\244n\004\301\371\030\216\036\301\276G\347\367\356\321y\214F\037s\321!\232\350\016\256\321y|C\203\220G\377\302\351w!\323\027\223D\377\314\r\375\270kt\376n\375\271kt\276\250\237\274F\347S\r\342\026\235\317\273F\347\375r\301\3343\nn\230{`\342%\224\226}eo\344\020\206?U\376\350\341|\013\350_\n\316\273w)8_\202\276e\327\354\236\205\270\\~\311\356\330}S\310m\2667r\310\027\347NH\027\234\337"
+	.string	"\375\273\345\023\264\331&N\201\376\rq\016\355\355\355\355\335\020\347\261\316\267\350\354\340\026\235 \256\321\371\337,\032\350)60Wp\376/\226\377Z\271W((\251lh\355.{#3\f!yT\031\301\371\310kt\352[t\376%\007\362\235\362\304\302\277\034A\031\202R(\213 \177 \371\347\247\037o\341b\347/[x\340\204\\\367g\n\220\301)\236\300\217\325\277l/\007p\210\277dq\002~\214\342\307)\376\262\310\341\307\032\326\037)\255\310\200\307\237\353\374\231\356\317p\376\354\346\317j\376l\346\316u!\\\372O4\270\317W\224LkR.\006X\370\361\224\213\201\245'?\236\362\373\313\027L,\360\227H^+4 w\225@\271\r\207\035\303\177\232\241"
+	.string	"\231?\263\215\371\263\332\237\3070\360_\203\314$\257\205}\303\177\022\021*+(A"
+	.string	"\263\004\310\262\212?/\225\034\334\026.\360\016\371\213\212\213\370\3172\f\206M#d\263\262\254E\002d\377MS\374e\b\177\356q1P\2368\245\256\n\377]qW\310%\220%R.@6\300\237<\366_.g9\316\313\b\270\020\370\313\0177\305\1775\370/\212\322C\306\362\347\005\374\330\312\225?[\371\357\207\277\314\220\3052\212\234\342\317U\376\037\275C\271"
+	.string	"\0169\354\377\035\034v\023\376\323\303\237u\374e\371\365g\253\373\243,\345/\215\334\350GU\374\331\352\277.\356\323\223\243?Z\302V\b\327\003\377\360\013|\3053\374\350\211\377\272\270O\267\t\017\371\312N~\344&\1779Bf\322\003O\ts[\270\300\217\211\374\204\354\205u\r~T\304\177=P\216p\235\260P\r\312\006\344\256\213\001<\345\025\374h"
+	.ascii	"p\215|\344\326\225\035d\360\242\037\355\220i\340e#\\?\026\300"
+	.ascii	"\3770\345\360'|\310[\357\360\243E?\236\222\211\374\267\205\277"
+	.ascii	"\224\201\016\375\245R\036R\n\375\303_.\371\376S\355'\240@}"
+	.string	"\036\346\177\376Q\363/\177d!\1779v\246vFM\016\362\227d\376\f\344/\331\344\037\331\307_\312-\3711\223\0377\371K\0379\353?\005?Z"
+	.string	"\266\277dS\362\227[\300\250\375e\226\2621+\177\231\206\n\020\"\\\3762\f\224\277\314\322\344/\267T\375e\226\021\374e\025\247\277\314\362\337\341\177\233\376K\374\257\007~<\004\225\312\037\376\353t\241_\233\370o\372_\026\377\345\300\177\177\177\326\340\277\030\370\177\376Z\002\177.\372s\207?s\370\363\206?\023\375Y\303\237\215\376\354\341/C\350\361\227~\376<\364g!\036\377\211~\235\376y\307\237\257\376\\\365\347\032\177\026\301\237A\360\347\027\177\366\300\237\211\177n\3723\013\177^\377\274\364g\365\317\300?\247\177\276\300\237+\360\347\025\177N\341\317'\3749\305\237\031\360g\004\374\331"
+	.ascii	"\177.\300\237M\374\331\203?w\360\347\020\177\376\360g\t\376R"
+	.ascii	"\316_\312\375%\234\277t\363\227l\376r\315_\252\371K\267\277<"
+	.ascii	"\363\227e\376\222\314_\252\375%\332_\236\375%\331_\216\375\245"
+	.ascii	"\330_\202\375\245\224\277|\362\227L\376\322\353/Y\370\313\256"
+	.ascii	"\2774\362\227[\177\251\365\227@\376\262\307_\356\370K\254\277"
+	.ascii	"\274\372\313\252\277\254\361\2273\376R\306_.\375%\214\277\214"
+	.ascii	"\372\313\021\374e\b\376\362\003\177\371\342/[\374e\373\227\354"
+	.ascii	"_\026\377r\370\227\302\277d\372K\340_\246\177\271\302_\246\360"
+	.ascii	"\227\021\370\313\007\374%\t\1779\302_\206\360\227'\376r\001\177"
+	.ascii	"y\200\277\004\341/?\370\313\022\177\351\301_v\360\227H\177\311"
+	.ascii	"\301_n\360\227\031\374%\006\177y\301"
+	.string	"_\202\370\313\n\376\362\303_J\360\227\034\376R\303_\n\375e\320\217\207\374\327\370\337\366/\317\2774\377\313\347\277.\376\262\374\313\373\227\377\361\237\037\367\3711\237\037\347\3758\317\217\271\374\370\354\307W~l\345\307a?\236\362\177\305\377\023~\374\365c)?\216\362c\"?\026\362\343 ?n\372\261\322\217\227~\034\302\217K\374\330\304\177?\360\337\027\377}\372\257\323\177\325\377\006\377\273\302\177#\360_\205\377\236\360_\025\3775\341\277\212\377\216\360_\023\377\261\374\277\362\377\310\177\267\377#\366\366\366\366~\2410\277\004G~\t\334\t3\366>\343u^IA\321\277\300\207\026\023\363\301uA\224\376\317\2603\f\267\341mNm#a\307\275\263D\\\2733\251/8\337\202>S\246\\4\020;K\013\312\016\204\235\215':\312-2\310t\301\371\026\234\371\372z;Z\240%J\224\031n\307*\307\343\325H\3300\310\f"
+	.string	"\204\213.,\317\002\"N\234\274\215\204\035u\325\001\225;\272\260<\013d\350\237K.\246\303tjtj\377q"
+	.string	"\256\032=3\344\340\374\023\311=\225\234U\247\227YECYi0O\366\222 \362\364A\310\351_\263\312\371\237]]w\256\003\224\213\235=I2F\214\344\225mm\325\371\322\322\272Z&\3325p\3309v\351\377\0342\344j\031\271\231\\?n\350\302\302\266\325\026q\020Y\372?\203\374\236\235Ap\030( X\321\322Y\242\360\231\303\371 n\350\377\314\372=;\263\316\037 v\022\255\215\205\201\031\244\236\016\fA\260\246\360\301\371\364\2016A+\223\304\371"
+	.string	"\360\243\017"
+	.string	"9\375\023\353\236;\316\252\223\307\265\313;\311\216\2122\261\347\006)\342"
+	.string	" \243\017\2001\375{\355\316\377\264\372=;\255\316\034;\007\007R\254\354\340\206\270\304\220!q>\257.\330\220-3\234\017\200/}"
+	.ascii	"\030\321\377y\343\367\300\304=;o\\4\274\241\264l\034\027fH\361"
+	.ascii	"\311\312\333\373\214\b\255\343KV\236\376Iu\316\370I\343'\215"
+	.ascii	"\323\306\335;jgm\250;&\366\312\350\302\362v\226U\210\377\254"
+	.ascii	"\361\323\306\353\202\366\007\241+m\311=8\037\317\254\362\337"
+	.ascii	"\367k\363\312\303\371\025\244\351\377\367\370?w\224\325\336;"
+	.ascii	"\207\211\334VRA\347\177\177\315{C\374\030ny/\370\237\367~\bD"
+	.ascii	"@n\031rx\366\336\027\217\226\242\026\005\004\347\377 \266\031"
+	.ascii	"\267\367\324\026T\003\266\256\246\266zP\231m]e\2402\333\332P"
+	.ascii	"SN\2402X\355-(*\263\2753LMA\245\320\272\2422\213\332\031\250"
+	.ascii	"\314\366\325\206\321\346\352n\344\026\324\236\322\332\031\366"
+	.ascii	"\324\216\332fZW"
+	.string	" \250\246\266\256\250\314\242\2562P\231m]m\263\255M\264\247\242\254fLm\253\f\333l\353\3166\323\272\"\2422\323\272\2422\333\352s\325\324\270{\353\021\007\317\023\264{E5\265oT\005\211\262\"\212\243Bj\355\271\275o\227\030\333j\307\355}\301\336A\264\254\346\242z\\1Rq7\244\302Di]\344\336\333C\225\024\227\326\236\212\203\272;\216\352Kk\357/)\246]\265\367\336%\240\220q[\311\215\2032\022d\333\210\261\267\004\033\271w\325\336Pw\307\355\275\241\366\336\250U\020\344\336?\210\250\216UU{g\035U\355 Pk1\366\306]\346\210\271\2422\343\322JZ;3;n\031H\250KeCk\037\367\334\226\2256\203\"\3336\366\336\367N\037\257\260\354pF\002\211\031\342E\007\316'\f7\265\"j8\277\002\037\372\224\n\036\341B\006\347W`\245\1773\311=3\223\340<\020\273\013rC}"
+	.ascii	"c\273\300\243\213\0349\234\377s\237\273\316\317\237?W\273o\357"
+	.ascii	"3^\304\310\351\323\347j\327\212\203\f/^\222\333\312J\304)0\303"
+	.ascii	"\207\317\325\360\366\355}&K\314\266\312\022q\3718\301\362\302"
+	.ascii	"\371\024p\321\277\231w\317\314\274\253\201\330]6\2142\001\364"
+	.ascii	"\270\243\013\313\333VY\"t\0345.n8\237\002!\3727\275\374\236\231"
+	.ascii	"^\314< v\022\275\247\336\376$\367\316\022\201\036\327x\221\203"
+	.ascii	"3\036\236kKc\006\347S\200C\377\216\245\361\271\273c\326\321\263"
+	.ascii	"3\357\314\244\211\307\2543\355\3343\363\216I\347\346\027\023"
+	.ascii	"L\034\232y\307\034c\322\335\270$\371\355\216\251f'\351c\323\361"
+	.ascii	"\205D(\237\202\255\377\301N\317\021\262\013\243u\206\363?\260"
+	.ascii	"\321lr\306\320\274\245\221\2013\343\3146\263\314\232\343\336"
+	.ascii	";)\215\333\321-M\2333j\340\342\342L3p\3116\246\034S\316\214c"
+	.ascii	"\2621\335\230s&\034\363\215\271\346\236\231q\246\232\233b\314"
+	.ascii	"\2658\363\r+\316W\336\336\310\021\276\342\350\341\220\377A\212"
+	.ascii	"\376\207-\375\017;\364?L\351O`\247?\201\033\375\t\332\364'(3"
+	.ascii	"\313\340)\2355e\203\007\316\237\340\212\376\004G\364'\330\241"
+	.ascii	"?\301\225\276V\327\350\324\300G_\202:}\t\332\350K`F\337\270k"
+	.ascii	"t~\270E\347%0\323\277\331\345\f\350\t\231,\273,gf\026\363\f\304"
+	.ascii	"\356\242\025\265\2254\226CLG\336\336Y\"\314\253,\032ep\336r\264"
+	.ascii	"\202\\\226\0368_\2020\375;Fv5!\337\336g\262\230Z\314\261\253"
+	.ascii	"\tM!7\223S\216-J^\236if\226\3353S\213\211|F\356\r68\362U)\022"
+	.ascii	"\026\343\314\227\340\207\276\0047\364%\240\322\367\320\007\271"
+	.ascii	"!\213\312\r\234\305L+>\255\037eQ8\337\003\03613,(\212G\032\033"
+	.ascii	"\234\357\201N\233S\206\276p\030A\203\363=\254\321\310,RO\334"
+	.ascii	"\360\227\326\2229$p\260\224(\346\034/T\352\266nF\371M.\323\210"
+	.ascii	"\t%Hk\255\314\315\n\347\343\321\231$\017\225\024\316\367`F\377"
+	.ascii	"7\231\230ML'\367\314|b\"9\"\321\005\344\2707\322|b\036\t\222"
+	.ascii	"4\237\230I\314%\037\244\250v"
+	.ascii	"\024\027\006R\326\270\254\204\264\352\274\300\321\3717\227x\225"
+	.ascii	"c\376\330\335\271C\236_I\354\330\356\231\251\004\323\371\377"
+	.ascii	"\213\334G\030K\216\222:\234\357aM\337\203\027}\017Y\364=\200"
+	.ascii	"\351\t\3665:\313\343-:\315\"I7\267\202\356\346\314\252\340,\201"
+	.ascii	"\251e\022\371\002\2037\005\211\216aKV\r\301w\242L\301\263\003"
+	.ascii	"\347\337\024b\326\020\252\"v\246\027\343\332\t\231{k\315\035"
+	.ascii	"\343\246\346$\223\366\314\25024xT\311\264;l^pyw\231\217\232\224"
+	.ascii	"\027\\^\362\242%\271\361\202\0133\245\314\032Y/\377\021\232B"
+	.ascii	"\356+!\264;/\270<\267<kve^pyq{\360\233\024/\2700\270<\374v>)"
+	.ascii	"\363\202\313\223\001\346\316\013.\357\356\256F\033\036(\\^py"
+	.ascii	"f\r\023\306\265\023\212Bn+\024\r\313\013.\317\244a\3620\263\314"
+	.ascii	"\034\346\r\263\312\364ab\2313L+\363\312\354a\3520\177\230;L "
+	.ascii	"\246\r3\210\211\343\236\2315L\252\347\253f\007\207Y#\353)\355"
+	.ascii	"\260y\301\205\355\215\f\002\"f\346.D\276\007\031\372Gx\364\217"
+	.ascii	"\330\350\037}\321?:\352\037m\231P\030\342z\310\371\202\363\217"
+	.ascii	"\252\314\315'\373\271Ux\216L\301\371\035\340\350\334\347e\024"
+	.ascii	"\0175j8\277\303\030\375\016Z\364;|\351w \242\337!J\237\303\235"
+	.ascii	">\2075\372\034\274\350s\370\322\347\320\245\317\001\207\276\221"
+	.ascii	"\036}\2438\372\317uu.R\253\212\2379\231\016&sa\324U\361\301\031"
+	.ascii	"k]\243\023\203[tf9I\317s\204\256\252l\371\202s\20699\\\347\354"
+	.ascii	"\213M.\316\005<_Kp\340\f\347\202\025'[\334p\276\321\030\3156"
+	.ascii	"\347(GL\tD\250\334;\252\316\361KF\223\323d5\271M6\223\327d\267"
+	.ascii	"\034\227\341\262\233\374\226\317\3447\367,\263\311d\236\333r"
+	.ascii	"\031\2674;I\231M\016\263'\231\331d\265\022\310\215\313\312bu"
+	.ascii	"\367.\263\311]\262\227\033\227$_\351\223\\\243\203\306\305Of"
+	.ascii	"S\326(\257n\\V\376\372\223\034Cw\334\033\351\201\211\314&\203"
+	.ascii	"\271hBP\310\215\003}\262E'v\204\341N\2207L>dlu\215\316\013n\321"
+	.ascii	"y#\037\372FW\372FT\372\033\374\350o\300\323\337P\247\277aN\177"
+	.ascii	"\003\234\376\0065\375\rV\3647\030\321^~\355\356\020\236&|\230"
+	.ascii	"\340\374\r>\3647\\\351?\237m\311`\220\250\255\3019o\3713\225"
+	.ascii	"\034\226\3150\0360($\316e\372\311\334\21438\177\203\224\376\237"
+	.ascii	"\261d\262<\226\2219\313=\313Zr\225g\261l\245\rM\227\261\266,"
+	.ascii	"G2e\031\031X\262\226|\345j%\231\025\207\030r_\222{\357\243\240"
+	.ascii	";A\336\300\005\345\027\355\351\253u\215\316\rwt\031w\215\316"
+	.ascii	"\004\344)\031\214\016\332U\037\234\377\fV\352\231\t\262\007\n"
+	.ascii	"\316`cL\222pi4\324\324f\034\343v\326Q\306\214\275#\226\213\272"
+	.ascii	"\361Fo\252\306QFIEu\221gB\222`\252\302\3308^\021\253\222\204"
+	.ascii	"AC\306\216=I\260*b\311\036Yv\2162x\344\365\bR\247\313I\230\261"
+	.ascii	"-C\260\\\f\271\031%\330\024,I\244\026%\311\256%j\307\262\207"
+	.ascii	"\020:\307\253\366\345F\327\361\313\261G\271ud\215\032Z\r\031"
+	.ascii	"\245\216;\007\203O\262\354B\342\326\004\255\007\027\334\021\313"
+	.ascii	"\341?H~\\)K\222dK\222F\t\232\262\313\353\214\234R\252*\251W\216"
+	.ascii	")\331\224H1#H\355%\367\336\\\202$\221d^\3116%\024\216\243\224"
+	.ascii	"\261c\351\345H\026X\226&O\300\304\025\231\223\241W\326(\257J"
+	.ascii	"\344Q\204-~\222eW\224.2r\364\301rx\017\211\217\262\207\0215\311"
+	.ascii	"\036\245^\351\243\004\"\004E\264\367\221\272\343\336\273\253"
+	.ascii	"\374\202\223\005NKN\262\264\223s\344\235\241\344\031\371I\256"
+	.ascii	"\312M2\222L$3\311\307,\225\241\312<\231G\356\312\\\331H\371'"
+	.ascii	"oe %^YW\366\311S9+c\225{\345]\336\221\2552\216|#\007)\345d\035"
+	.ascii	"\271H\206\221}\224zrT\246*\375\344!\345\2342/\037\311IJ:\345"
+	.ascii	"\2352\231c\344\257\222O\246\221\205\344\253\322.k\345%\271F\211"
+	.ascii	"'\313\310?\262WV\222{d)9J\266Q\356)\353d'%\335=+\365\3128/\345"
+	.ascii	"\3129$rIR\033)?\307\022,\314J\262\013\n\034/\245\f,\275\262\307"
+	.ascii	"\020\272.>\312\036G\336\216\027iF$\331\346\312\223c\tVb\201\343"
+	.ascii	"\004\313a?r@\216=\210\034\231\343\246O\234\225\260$\034>\311"
+	.ascii	"\022\254\324+\257$\313\256R\257d\222\226\334\033\271\301\321"
+	.ascii	"u\333\3035v\263\262\026s\215\316K\343\026\235/z\243_\324\246"
+	.ascii	"_d\246_\004\246_\264\245\377\222ML\271V\306]\237\0164c\322p^"
+	.ascii	"\363\207F\032\026\234_\004D\377/\337J\267RM\231\346\236\225p"
+	.ascii	"\245\231\227gn\334\261\2116'\311\261\022\256DS\026F\346\311\261"
+	.ascii	"\204+\313\214\021\323a*\311\262ss!\277h\353s\217\276\006=\372"
+	.ascii	"\032\360\3645\334\351K\226\364\222-\033\311\203#\n\316\327`G"
+	.ascii	"\337\3445:+\270E\3475\250\321\327\260E_C\025}\r^\372\032|\350"
+	.ascii	"k\230\241\237\001O?\303\233~\2060\372\031\300\3643h\351g\270"
+	.ascii	"\241O\264\247OT\247O\244F\237\310L\237\250\212>Q\023}\242,}\242"
+	.ascii	")\375\241:\375!8\375!6\375!2\375\241(\372C\\\372\310[t~\250J"
+	.ascii	"_\350\217\276P\035}\2414\372Bi\372B`\372BB\364\205j\350c\b>("
+	.ascii	">)w[\355)\363E\271O\312\220\0351H\350`2G<L\240p>\211>\372\367"
+	.ascii	"\035}W<\336\336\260\341\214\274\202\003\307\022-'@\3208i`UgW"
+	.ascii	"\3631!;\356\275\211\202\346\340A\353\202\363I\344\361%\361%\361"
+	.ascii	"y]C\224\022\016\240\334\341\262\362)\271\317\313\\r\272I\n\241"
+	.ascii	"A\002\216\376}HN2/>\222pu\2351\320\312\232\344\360\0351\351\270"
+	.ascii	"\251\022\307g\304W#N\021\263?8\373\212\370\212\370\266\256\225"
+	.ascii	"\025\002p\270\211\363\225\267\263t\204\360m\371f \34189\202\363"
+	.ascii	"I\240\321\277O\313\2442$\207\031\020\234\177\317|DN9\007\330"
+	.ascii	"\3318\342\033\202\212\361\210\242\247C\210\033\2245t"
+	.string	"\352\004!\243\341K\324\017 h&\234\261\262\344\007z\026\345\306\217\036\037\350\230\007\304\370\261\223un\001cV&\252\207N\262\306\017\336\024\316>,\037\226o\307\323\r+}\362\226\214\r\361\351\270o\307\20590\274t9\247\322\220]\275\301\371$\302|8|8|W\247\330\r*y\222\\\307(>\253\373\256\352\326P\245y!\341\345\253\362U\235d<n \211\022\026\324\205\346M\031\316'\321\303\267}\333W\343\314r\203J\2360_\2316J\266\370h\334W\243NI\233^\026\316\276\030\276\031xo\202t\341\374\373f\370\250\200\204\261\222\303\023\201\026\0375>\031&\035\f<\300\324\342\340\354\203q540\234\304\301\3317\365\264[\343K\335\027\316>) \255:I\272p\366E=\rM\032\336\016\234}PO\253\242EO\2204(efL\301\371\036\314\351?\377\243\317\340\235\2457\0264 \311\275\263B"
+	.ascii	"\345\030\222d\007\031==\335\347\262i\021\323\021\246d*\216\017"
+	.ascii	"\234\373\\-I\024#^p\276\007awwz\217\t)Q\362\302\206\246\350P"
+	.ascii	"\t\311\273\336\263\245\317\021:8k<Z\317\177_\020V\221<5"
+	.ascii	"\255G\347\201\322\344F\217-\033\343Y\251\223\322x&\262\316\r"
+	.ascii	";}<Pr\347\216N\243\200-JLG\236\356\222\253c\206\363=\240\262"
+	.ascii	"cg-\207\230\216\241*`\320\304\340\324\251s\312]\310Ru\307\343"
+	.ascii	"\002\215,b\\\310\320\321\235rB\177\252\366\360\204\235b\244\262"
+	.ascii	"\260\341\374$\244\0349<\252\354\344\311\273>\262\322|\301\371"
+	.ascii	"I^rr:\355\256\331\211\351\b+\273\220RPp~\322\r8p\364\030\n\262"
+	.ascii	"n \211\242\277\312X\331\301\371\035\200q\343\346\224\303C\217"
+	.ascii	"7\270\304\204\252\236\214)\202\363;\b\362v\275\346M\263A\311"
+	.ascii	"()\322;@\032\330\233\270k6o\347\336\0261[pZM\007;\322\244\321"
+	.ascii	"g\206xT\355\341\t\333\321\345\317\0319e\312\3503\036\314l\211"
+	.ascii	"\351x\202\204\013\216\231\3533u\370\212\331\233*3d~2z\fQ9\265"
+	.ascii	"\207\270\035\207\362v\264m\301\371#\314\304\210\321c(\370\022"
+	.ascii	"\273\003\265\245\327\256\307\250\005}\301\262wf\304\327\331u"
+	.ascii	"\2303\235\006\204<\322\222\232\332C\206\\\030\253\342\223\225"
+	.ascii	"\267\251\202\204(\335\250\324vh\264\353\264\313e\016\0336\375"
+	.ascii	"\345\032\314\357C\345\340\270i\301\371H}\264\356r\355\345\367"
+	.ascii	"\231@\260\350\276p>\222\036\375k.\277/(\311\033\234\035\316G"
+	.ascii	"\272\243\217DGF\246\315N\035Uy\256\f\251\261\242\004N\331\265"
+	.ascii	"\031\006\274-qYp>\236\326\362\337w\302\341\350\303\007g$,X\260"
+	.ascii	"\350\261\013aUw<\302\366t\311\001Eg\271\036\033\222\002c\202"
+	.ascii	"v\345\277\017CX\0358>p>\322\225\025+'\\\225\235<a'\\\330\035"
+	.ascii	"\264\270*UN9\2431UuaZ\316N\317\026+T\250\234dDPZ6\016\017cQ\304"
+	.ascii	"td\27238\344p>\001\232\350/\375\245\301\360\316\322\202\272\023"
+	.ascii	"\302\312]\b\034\207\215\235\026\rv\355.,!\213Q\004\347\023@\207"
+	.ascii	"\376u\024\035\345\334\2027\024\321\236\342B\343\233\002\005\357"
+	.ascii	"\013\316'\200\224\366\272>j/\375\343\356\335&\206o\254\214Fr"
+	.ascii	"[\005\021Q\312\331e\376\340\254\235\350'\272\211f\242\227pP\247"
+	.ascii	"\207\\#\321Ct\022\020;IVT\216\022PL\2729H\206 \315\232\230\351"
+	.ascii	"a\301Y\033\321]>6\033n\202\340|}$I\233&`8c\315\205^\261\232\362"
+	.ascii	"\202\363\365V\351\347\215m\006\316\327E\376\373F@W\244\n\316"
+	.ascii	"ZK\307\340`\215\006\2769Z\352,\301\371\327D\256\265\260\r Yv"
+	.ascii	"pF\353\222\256\211\340']\334\334p>\007e\372\327At\020\214\207"
+	.ascii	"\367T\206\275\243\372d,^T\312\340|\016\222\320\035\335\203\362"
+	.ascii	"A\365\356\031J\247\1774`C\221\332QL8\220\342F\b\211\214\254\215"
+	.ascii	"\263\017d\224\\\03448\237\003 \372\367J\037\364O\026:\350\036"
+	.ascii	"\235\224\206q\343\2224`\312\232\344F\375|\220\242\"\341\312\234"
+	.ascii	"d\016-C\343\270qYD{*-/\251s\350\2509\035:K\367\320;\364\225\306"
+	.ascii	"\322<\356\231\316\241c\034\345\203\352M\351\034\032J"
+	.string	"Nro\344\020\036+\\z\020e\264\317\353|\220\242\"!K]R\337\320V\367L\343\370\021r\237\204\306\241\251t\325\226\001\340\252\332\f\361\260\001\006\2737s@\316\374\353*m#\f\022\311\035\316\272FV\0177\0308_\204\236\376\365\214{\246ih\274\2605\275:\377}@f\274\270\362\364E\330\351\213\200\243\365\224\206\223\024\002\207\363E\254\321\027\341\246/\202\214\276\b5}\021\\\364Eh\321?\372\007\365c\226\006\017\234\0377jlH\341|\021Y4F^\2433\304-:Q<T\017\232\367\373\206\304\304t\201\301\371\"\246\350\243y\376\373N\360Z\003\006\347|\337v\242wG\361\374>\354\366\344X\205\363E@\321G\357\240v\277Oh\316\211\0272\234/B\211>\232\004\263\207\307\007\316\250\035\035C\004\020\r.\bI#\002\244\316Q;?Zw\331J\253\026\366\374\350\301\031\303-:Q:IG\353"
+	.string	"\301\225I\216\341\034t\213\316\213\200\222#\247\316\321NN\016\035\363r\214\003\007\016z\366\001\2542n\334\240h$ 7\324\nXtaa`\330\260A\307\304\306\326\254A\362\343\250F\r\352\266w,\222&\r\352F\002rCi\240\214.,\354\003v]Op\376\006;\316\234A\321\216\340\330\200F\2312\350\030\t\310\r\305"
+	.string	"7taa\033D\255\241k(\231\020\310\215\025\002,\035\"L\"\246\230\0300\310\240c\216\262a<w\212\212*\017\347\244\244\243c\356\230\036\231\031\234?"
+	.string	";55\024\355\210\230\\\227{\206vA\321\216|1\211\374\274\336\264\340\214\206\371\313\036\250\027\214\247\214M\214\017\234\321/IG\301\314]\255\355\300\331\274E\347\271\246\f-C\317\352L\"x\254\r\314\216\331\321-\030\217N\362a\223\304\331\203\244\243fg\030\231\"{p\376"
+	.string	"\326\310\310\274\f\340\354\312=C\257\240c$\020\355\315\005w,\267\034A\002\206f\371K0\024\013j\004\215\\\032\316\331\n\225{\206RA\305|T{cq`EJ\207\b\223H\232\271\030R\320*\377E\242a\030\017>\263\304@\201\303\271\334\327\350\374"
+	.ascii	"\230\200\201\235r$\370\221\202\216\211\341\331\300\371\003\320"
+	.ascii	"\322(\024\024\n*\005\017\335#%H\b\223.\213\256\b\032\345\250"
+	.ascii	"\024"
+	.string	"\364\254\207\027\252\001\324p\342\004}\202\265\306\262h8\2756A\236\230T\260\f\321\221\007\347\207\370\303\204\t\nC\303\336S\373\210\276\215UI^;\311\256-u\222$A\275P\2742\272\26009V?\266\340\214za\275<_\300p>^\336\261fE\r\316\017\201\326\325eG\3151J\r\275\0378?\204\026#F\354\214\001\315\330\243b\207\363CL\331\332:\3114\324\305\273\243\013\013\303O\202\220}\301\371!\204\b\021\202j\255\341\242\013\313+\235\\\355\341\202\0229\252U\247\265\202\340\355\301\031\035\3626mgJ\325\227\020V\372\267\312E}\3343\324\007\n$\001{wAD`\27177\264\320\037C9\234\324]9\n\262\001$\255\r\347\207\230\241\177\264\007\332\003\343\345=\203j\357+\020\244\270\031\002\363dm\b\235\035;N2\275\255X0\207\n\227\031,\254:A\216;++\204v\023\366&\007\316\327"
+	.string	"\251Q\034(\016\364Jo\017X\334\\\220\301&u\007\347\037\265:zu\366A\016\251\242\362\337'\364\307OU\027\234\257\301\024\375\243Uh\325\031\003\013\204\024./\270 \037f\362\210\301\371\032\024\251Q\343$\323P\333\n\212hK\321y9\002\255\231\2311\301\371\032X\315\230q\222]0L\222;++\204/LH\035\036\316\317`O\2432P\031R\250\334P\203\202\3633\250C\247\320)\024\206O\001r\350$1\300\3304\366P\030W\313Zb\205\3633P\243Q(\024\n\215\362\355}G"
+	.string	"@\356\224\234`\t\203F]4 9WaXp~\006j\372?\367~\317\316\275\\'o\030S;*\311\tg\343.\317\330\233\037)8?\203/\375\237~\356\331\351\347\332\201\330I\264\242\2420\240rg\265\307J\f\347g`DO\317\204\024\036\372\247\236{\356\331S\226\001U\236<W\203Af\200\261\250\223\256\310\2353>x\360d\271\274\245\250\264\242\270J@\211B'v\236\301i\361\202\363\005\020\247\377\323\316\256L"
+	.ascii	"h\372?\223\367\354L\346-\006\300\242EL"
+	.string	"\210NMV\034\234/\200-uu\031\254\001\033\312\3246\202\345\344a\203.\n\212=arp\276"
+	.string	"z\3149\351\3149m\234ttVzP\"eA_;\302\214\341|\001\334\320\307\340\017\234s\016\316)\227\301\336\027\251\205\303jgY\205\210\023\347\224#\001j[A!7\016#\"XY!\316\2538\\zp\226{\363A\221\302e\003\347cPG\037\20367nL*xO!\367U\001\244\316\2100\337\336\350\021\301\371\030\230\2311s\262\001\26172\306~\302CEM\322\355'\233\237q7\212\016\334\r\234\177\302\235k~\237i\307ff\f\316\307"
+	.string	"\213>\337N5\377}>.U\322\260\341|\214\001\025\rV\224\231\371\201\363\177\324c\342\004\3473\315\323\376\373.\250\001C\203\007\316\307;\321\374\367\025M\241Bu\2429\317\374\220\362f\347\256\2042R\303\r\347c\320\245\217tO2mo\323\252\362\226\304 \206~"
+	.string	"\336\35051\347\030\263\312\3359\366\235\361U\305-"
+	.string	"k\372\001\270\022&\314\251\206\002\301J\373\251F\246\215\311\022\234O43\355\212\255\f\347\343\371.XZ\225/8?"
+	.string	"I\364\177~9\277\340\274\274gP\231n\234$\267U\226\b\024\314L\325\032\316\017\200\017\375\233]f\327E\353"
+	.string	"\375\"\345\365\223\313=;\271`<\037\325\3369JP\301\242\013\313\013\200\215\262\262sK\336R{oe%"
+	.string	"\n\227\020\2351)o\247\331\221\231\305\214\315\023\234\177\301\037\375\013\350\220\310\223\354D{kI\355=D\310\211\006\353x?\311\3146_N\276\340\374\013\270\350\237V\356\211%\313\325\032\020K\253\322\220\210bmZM\320\240tA\027\211\255\n,\261%\n\265\277\264\025\252)\324\246\265\005*6\001}gB22\265i\323pMY_;\\K\243PxB\250M\211B%\223\b\350LHj\323\332\232B\341\t\265]Y\n\254\303\0224\030Y\265\305\312\006\333uX\202R\321\204\242\023\255:Bp-N \024\\\213 N\004\327\342\005Ab\023\273\246DA\265\005\252\255\232b\270\026Up\221Z\200\310\276X*2\256F+^\b\213\305\023\301\2658\301\231\220\332\037\005gB\032A\201\261\004U)5\n\327T\211H\251\035\256\254\360<\023\022\221}\261Dd_\214@\324\304\252+Rd0\2628\241A\250\244\246"
+	.string	"\246\320\252KC\302\024\310\324\246M#\214\355\312b\204\323p\211"
+	.string	"ON\303UH\200\022\037\374>"
+	.ascii	"\341i\204\032t\022"
+	.string	"\002\207\353\b\326\3504b\204\013\"\313\324\022\207\250R\252\nsk\034\022\201\246R\313z\300h\236\tiDP\025\262H\207!\030KPY\2476U\225\210\316\204d\fa\002%\254@q\342\027B\212\b\250\370\241H\341\247B\t\031\316\204\244\262D\240\221j\\%8\023R\n\306\225\250\211U\333\022\202k\021\303\004\204B\025\305R\252B\253.\035\275(\022Q\020\375\236\266i\260U\215B?\265M\205\305&u\305\004/\212D\024\022\264gBZ*\216X*\002\207N\",\025\201\206J\3304\376\226\212A\355o\270T4\207K\305\222\251]\032\252\302Sma5f\243Qe\203\301\024}Q$\0023\333\026\313\240:\\Z\205)\032T\215N\331\210\236\375-\025\2210\274`[\343\272\244\246\340\241\004\t\017\222*\020L\235$pB\230:\245\030\"A\270\246\355\004\204PhS\241\b\304\026\030\001\020*@l\201\021"
+	.string	"\252@\211\"\221EA\025.\rW\025\206P\370\340I%\341\003\013\240\016\300P\001\024\202\251\223\004.\b\255@K\303\225\002A\365i\025\301X\302\006\025\255\272\0244B\253\252"
+	.string	""
+	.string	"c\221\330\032/\264+\353\002\310\250\2468zZU\004S\242\tA\306\363E\312\262'\210\255\321\t\370Ae\2356\230\020L\211B\016\355:,\301\267\241]\207@c\b\355:\\\211X\265-\022\201+\273\302X\002\021\221\212V]\302\360\304\246m\232\002\310\236j\220\250b\bCk$\022\035\200\001\205\007V}Z5\244m\232\"\270\026\321\021K\253\322\020\205\fZ\025\262HW<\255MCD\035 \265lZDZ\032\256\303\241S\n*\233vP\203D\025DF\243\n\004\246\247\006@\300@\007\0330\237V\025D"
+	.string	"\350"
+	.string	"Imam\207\251\223\004\202\026hHB2\256\260BkL\205\033\214(\224\212&\f_\244P\3334Xt*\n\252?V}Z\203Z\rF\342\n5HT\301dLY\024\254\332*\235`\325\026\021(\256B\021^\b\213\3054"
+	.string	"F\036 \225\320\201\203y&\244%'\026jpDP\270:\261P\203D\025>\225\270B(t\022\241MY\264\320\"\240XJU\030\022\327\026\250\262,\021E\007!\022H+\204)\321piU\341iU\241aU!\364\224b\030\256*\324\245a\232\002\n \353k\2154\224@2:\021\327\026*\213\002\220\335\320\016\235\t\t\370S\233\326v\350\304\216"
+	.string	"\002\300\270\224\nEX\032\256Ml\nd\f\016C`\211-\021EpxB\350\004\024\246\300\001\034\270\262\352P]\322/\361\001\001>"
+	.string	"\341\t=\b\007\350\340"
+	.string	"\035\234\007\341"
+	.string	"II\007\370 I\377\203\244\262m\177F\025.\210&h`ZZI\b\222P\321\304\246\3065\230\201ii%a\350@\027D\023\"\320\252B\"\nBF\f\355\231\220F,\0259\260j\323\272\"\250rh\241\246P\3334\205 \242!q5\262j\213a\tM.P\310\320\344\002\205\240\n\034\2760\016WP\215NB\255\221ur\200jt\302\360\202m\325&U\250\256\310`<\205D \261%\262(\264,\261\310ai\230\262hW\007\264D&c\n\325\3504\324B\r\226\252\2230\235@\004Ta\260\004a\332\256Kk\220\303pm\002zJ\233\200\202\303\264\251\211\b\034\256M\027\232\324\326\370B\2053!\215\030\022\233\232\210\300\tX\270\306\237\bIm\021Hm\323\326h*\025M"
+	.ascii	"R\177"
+	.string	"\301\022\236\210,\320\366g\\AmZ[\255\376\200Z\323\370C/\020[\260\252\n\252\321I\237\ti\204\221%\032\207\252\221\202\247t\2706ip\301\241\035\252F\225-\266\304a\233\262h\341\001\330B\210A\375iP\177\033T \353DT\201U[UE;TY\326\t\250\341E\273\002\323b\312b\250M\0350\001\325\350\204\301\330\262\252\360\004\n\325\350\264A]J\207\304\265-69\031\207D\340\007\343jTY\2655\276`jS\026-\204\324\245\264\025\022[\b\205*P(tRjS\026-\212\332\241\023\021\205P\250\242x\301\252m\233:@\005\262D%\243\027\251\260h\\7\264)\213\025\303\322p\035\262)\0058\bS\340\332\256,\n\226(\002\353\224\242MY\264\350\200\202R\321\204\245T\2056e\321\202\250=\023\322\b \006j\233\246P\004BpU\3012\265(\b\304\342S\b,S\253\215F\265MS"
+	.ascii	"\262(\261\370\024\002\220=\215j\233\262f\212\022P`\231V\f_\004"
+	.ascii	"},\244*\313\342\227\026[\016\027\324 QEZl\321\266\311I\205\322"
+	.ascii	"\370K\3334\205q}:\021\\\213\030\214?\024\202k1\250\005\246\237"
+	.ascii	"\213\364\205P\013L?\242\026\230\230\200-q\330\236\t)\270\026"
+	.ascii	"\217D\270\306\237Rp-\236(\334\022n\212\033\\\213e;\\\211(\024"
+	.ascii	"\235\202\303\225\002\035\200\\\244\026pR!\270\026\205"
+	.ascii	"\206\253\212\366Dp-\022\265@UI\251\250e\325\342\223\372k\205"
+	.ascii	"k\373\033\022[XY\"\323\221\032$\252x\321\256-Rv\204\265\035\246"
+	.ascii	"C\034\206k:\002KlSV\335\220\202\213\364E\006\241\n\004\236P\333"
+	.ascii	"\224\025\n.\021\255\304b\253\032\217\324\246\265\275\360\"\025"
+	.ascii	"\252A\240\rEC\342\332\256\b\262\251\013\226(BPU\225\214\\\244"
+	.ascii	"/~C\027Z`\372y`4\246E\027Da\206\027\254\332\202\bT\331\237\220"
+	.ascii	"QK\024R\213/Z\242\025hi\230\036u\030\256\351R\006c\323/\230\252"
+	.ascii	"L)\013D\242\360\307\252\3035e\333\037\221\005\246\036\206k\272"
+	.ascii	"D\224\241\203\221E\252\301\003Vm\205\253\222\206\026\230~\303"
+	.ascii	"\265\005\246&Vm\203\033\324 QE\006\024V|h\327\246\325\204\016"
+	.ascii	"\3035\035!\005V]ZZ\331\025.\210B\341\t\024L\300\241S*\254\340"
+	.ascii	"\247\032\2354<\245B\225\375\271H_\374\202j\233\262Kj"
+	.string	";\\7\264\260\262\251:\\Mh\215N,S[d\016\327t\351\202\n\034\246-\202i\020C\353Tl\235\210?\r\355\320\211\b\374\t\205*\360\327\241\035\252\253q\230\262\355Qk$\022Y\374\224\2244\2332\001\263\332\224\236\240\nW%\"[\004j*\262\277\341\332\024\024T\325\242\361\327\016\325\246\326\350\324\201`jt\006\327\242\220jLU\0268\\Uap\315P4\376\324\265MY%\245\f?\225\205\265h\374))\t))\021\251-X'\340\360EP\203\nL\331\237Pm\241\n\207\214C\265\330D\004\376\226R\343\257MY\2640j]\244/J\343\217U\237V\025AZ($\262\231\t\330\256E\363L\022`P\203D\025>!\221\350\200\237\031T\215\254\332Be\177F\027\351\213\242v\250\002Y\265\370c\211-\261\251\003\261\370\244\376\212\253P\211\311\230\262@!\364LHF!\221m\207D\340\017\310\216"
+	.string	"*}HA\202\310\005Q(\304\264\2642\r\005I\bS\266uR\207>U\330\266D\226\251\375\005I\004\207)\213`\252\006\213\\\020\205@LK+\323/H\242]\233VaP\220\204\032$6\375\202*\023\260]]\030\207\316\204\364\304\216X*\026\235XT\331\021-\221\310\216"
+	.string	"2\376\226V\245!\021\305\023{\241\2306\001Y\223U\203k\013\"[\f\252O\2540]Y\325\230\341I\025\026\235R(\tS\246\013\303\025D\373C\227\322\025\304\365\267\344$,\036ehU\243\312\006\207+\213_\233\032\177MNl\313\202Z4N\020\244\nS\340\205\226U[\fW \033\\\233\314\341\332\244Y"
+	.ascii	"\252L\300\247\264I\017\031Q\b\323\026C\342\332\246Bb\221U\333"
+	.ascii	"a\t@\266\203QU\331%5\205*\\\032\236hJQ\264(*i\b\n\211LF\225e"
+	.ascii	"Z\241\266i\213\265\005\236P\203D\025\354\232\036\r\327\366\367"
+	.ascii	"A\022P5:\375\236\322\246\337\023\013\364\344\224\376\236\322"
+	.ascii	"\246!#KdY\325"
+	.string	"\350lU\243\222\022\021H-\276h3xPR\"\266N\300\n\214\353S\372[rb\241\006[\247\342p\355\240\026_\264?\265\305\332\246-VV\r~`\211-0U\372\021[\247\364\2674\\\231Z\"\261\311\370\003\262GA\342\312\252\305\237RQ\370S\233RV\351\007d\215\277\325hd=\004\327_\273\016\2350x |b\215C\2551U\372\005\235R\026?\243\023\013\243P\373\003\241\035\256N(;4\376\236\330\237jt\372)\031Y\340P\373\363\200D;\\\235\364\223\222P\200X\341\204\0214\020\211U\237\326\246\021-\323\322*T\0321\\\323\246\021@\3268\002\311\003\013\306\264\351g\024\252\303a\312\004\374\251\301\225e\325\026\304_\321\330$\301\177\237\335\311FS\261s\223\273\323'\323P\353\242'\251\367\f\205)\202\003\216\235SmN\236*L\352|u\234\320\301b%tF\314\032\234\345\344|tC:"
+	.ascii	"\273\303eE\347\233\023\264\367\251\347\212\031\2239>9\031\020"
+	.ascii	"\213Qg\3564\363=)K#c\016\257\311T\252j\234\341|\023?\340\300"
+	.ascii	"\321i\277VC\320\035\\&d\254Y\343s\323\004\350\330\346>7jzJY\235"
+	.ascii	"5\234}l\256Fvd\255\r\316\276\270\2414\262\271%}\320\240\361\251"
+	.ascii	"\tRB\212\225\035\234\032\337\333\025&@\200\274\271\235T\250\260"
+	.ascii	"q\223\346\274:\322\"eH\032\\\025\2445\207\347\316g\306g\346$"
+	.ascii	";Q\224\017"
+	.string	"\254\022o\364\357+c\343\217\335\226\265\2663F\262\364\274\274\225_\\\302\3304\033\364,/-G\2300\276\265;\002\\\271\221v\337\232O\314\034$mi\324\314\340\021\021\203\363Kd\321\276\262\315\237&zJ|\235\235\371\276,\271\320\347F\033;\237\227\373\276\274\315\214A\007O\033\234}]\336\246\347e\354\r\316>.\250\033\034\027\221\02284\022\217\234'J|f:\315\313\336\035:8\013\235S\230\310X\323\242\307\350\272!P\336\220\201e \303\206\030\244Y\005\350MK\2372cw\356\214\302&\017+\313\371\003EV1[\202E\217a\270#\226\207\311\225kw\366\200\241\007\306J\216s\214\017\0370\304\264\331\234\326\021\0338\373\246\370\250\334\263\267\371\302\340\344\342\314\341\374\0225\364\323\336{\277\355\374}`;\220\177\252\320\341\354\203\022\210\377\250\324c\023U\306C\262$H\002%\207I\346\024\002FD\034"
+	.string	"\303\025"
+	.string	"0h< \221\t\323.\366\024\200\013`\276\250vP\033\rZ\320!\305\b"
+	.string	"@"
+	.string	"0@\030\002\"\004\001\276e\241\004\310\304\t\013\203\260\276\202\240\273ct\372\304P\tN\313\201\r\240\243\317\303<\224^\\\005%\271 \f|\372i\032\341\006\356\035\367%\304H\275\307\210\365\251frv\215\252\315\251{\347]d=\001\227\234\367\362(~\306\257U\232\304A\277g\\\201G\017\302\326\374\274;DV%"
+	.ascii	" \376Y\260\246z\226\354c\035A\030\347\262\363\364\330f\242\245"
+	.ascii	"\374\355\020\233\277\367Y,\210\026a\222\371\340-\314\251\346"
+	.ascii	"\250\331\022{T\266\242\036%\376\207\n\250\373)'z\013\2044\007"
+	.ascii	"\376\264\031\200\241X\177\376:\215G6\2556\325\211\310,\222\237"
+	.ascii	"\356)/\"\2637\267\214\211\"\t\232"
+	.string	"E\332\353\301\315\225s=\373F\246)\020\347X\034i\232,\216\023\341\217\350\313\222=h@\025~>o\221gF\3636\b\341\210\246\207\225\261\"e\017M(\230\234\025J\rEQ\275X\263D\200\355#\261\325\315\270\275\261i\306\020U\302\301\317\r\331\322\364%\367\237\204\330\255\317\203}]\325\322?\032{\301\377otS,\2316a\271\317\303\331\031\224\345TK=,\" w\024\231\032p\244\024\344\345\030e\004\215\021.]\341z\003eG\227.2\212\252F%A\275\201\251\201\370\233\231Q\221K\243\025\340\t\200}\266\027\250D\016.s\335e\205\354\215\262\333\tO-a\340\370\214\275\004\037\225G\022oC&\251\027\006[[\363\244\304\301\374+\243V\310w\267'\236\f1\347\332r\335\314\225\220\3207\007N\260\033\032aAL\002\316,s\002\355\234j\231\367V\347\204\302\313U\272L\377R\303\333\336\206U "
+	.ascii	"\b\032\217\223\331\335\353\226Q]d\230\216MUT\266=\275\260\330"
+	.ascii	"[@\311\235a\375\345x#|N\306K4\215t\370\243\342\370r\272o\256"
+	.ascii	"\":B\354\320T\223v\364,\307XA.\275\343\215:0y\231E\"^h\327"
+	.string	"\250\255?\027`\b\355\224\274x\270V\332\372\027\216 L^\316\"\252\251\230\365\244W\352\205B9y\365f\2129eJ\216\tM\272\374Q\271?\022\007\023\340%Y\357\b|L\316Dh\200\213\200\210\021<ty\356Zb\033\b\237$\017n=\252G\005a\337\020"
+	.ascii	"\"\031\326\227X\332\270G\262\013U\341\226z\362F\366\263\017\216"
+	.ascii	"\3433\254\301\361\246\346\2168\030~*\002\210\215\325\006\261"
+	.ascii	"\301R\206\246\213\013m:\034\364\006\257\r\201\261\321c\350\206"
+	.ascii	"\204\212\300\263\374\002\250\312\214k\375CKp)\313\273\325\362"
+	.ascii	"Z\f\311\227\030\333\211;.\307\360e\350\026Bq\026\262{\215\346"
+	.ascii	"I\007\234!\264\230\324\313\246\244\304\216\233#\353\312.\353"
+	.ascii	"\270\205\276ZHI?\351\306qw\342\363\342\034<\241\306\225j\250"
+	.ascii	"P\246ZE\204P\223=5~\b\205\374Z<r\205\013j\200\017YB\025(U\214"
+	.ascii	"\263D[\2267\205\3614\351\341\025\332\257c(4\251Y\202/[\017U%"
+	.ascii	"\263\034\257D6\032\243\037\226\341\366\201\365\344)\235\230d"
+	.ascii	"\221\202\256\347\252\345\254N\335\223AVC)\b\375\226\223\343\341"
+	.ascii	"\217\2038\320L~\345'=\037\225\"\333J\341\307\333\002\020T\353"
+	.ascii	"\037Sc\232\177\367\2041\363\310\002\241\260\270q\204\262S\364"
+	.ascii	"\2571\240\203\315\036OA\231\361\025\247\017\311f\255b\232Zc\341"
+	.ascii	"\272\257\253\242\027\034\264\215\370\020*e\273\206D.S\335\213"
+	.ascii	"yS\377^,\035\230\r1\243\326c\006\004\322\374\271\271\277\255"
+	.ascii	"\335\205LU\246U\030\324\314\347L\204W/94\214\222kG\342\300\270"
+	.ascii	"F\204\373\2504\344\355\277-\245\003\327\361\365\247V\363&Q*\331"
+	.ascii	" \314\273\236&y\325\017\362\224\3417\263\265'G~3\370jl\352d\177"
+	.ascii	"\363\357\262+.qXSNf3\352~7`\013\231\300Wj\260\227{g.\335#9\337"
+	.ascii	"F\320\3438\257\306\021\266\3665\343\242\025\224%\303_\314\375"
+	.ascii	"B^\330 &\336\346\236\\yg$D\0372\333Vub\373\212\307\356\326\021"
+	.ascii	"\275\313q\2515\336\260\375\220\321\364b\374\303\234;\026\307"
+	.ascii	"\260\323\207\340\\\230\265\371eK\330\0059hs\346\257\261-f#A\030"
+	.ascii	"\322@\374\201_\213{\200\035M\313\243\202.\037Y\327n\370y\316"
+	.ascii	"\t\274\235\026\007\nw\207\2024\331\232>\206F\343\020\372:\265"
+	.ascii	"\b=%\217\245\223b\340:8\302Q\215\217L'\265\bC\317d3\217\253\374"
+	.ascii	"\035\006\252\261\246\345\fp\312\002\312\036\206\035y\206`\t7"
+	.ascii	"\260K\311\005a\311u \210=vq\376\244\367\227\026C##\036"
+	.string	"\375\255I\264\207\277q\026\344\350p+up\324\004\323\022\235\224\205P}\250\033\037$QEG\341\252u\266\351\032\001\016\272<\356\350<\345\301\265\250\321\273\374e\345x\3731~jY\3055\226\242mI*qg\371}\016b\f\261\227\017/\214z\036\332Cg\234\212p?\266\233\030O\360w\"Y\277\355j\343u{\375]\306\337,5\237\333\020\250c6\257\217\\\321\336\013&\364[/\261K3:\r\272\324\3606\316\310X\341\266b\274\022Z$\330\257\363Q\324\312\013\313\315*]\251\211\366eEu\254\317\304\322\245L\313\037\3674l,\353|\t\331\204\250`u6\210\326\235\352\344\220dC%Y\262A\030\217\260QN\373\211&:\337\224%\362{\256\361\262\301\327\002P\335}\241\002s[4*\343\005\223\n{\222\357\360\307=n\244\331\252\027\342y\001)0@w\266h\353\013\361\244\340\324>$\336kqg"
+	.string	"\257\031\250D\374F+\361\n\325+\226\037a\235,\023Eu\264V\373Mn\372\242\263\002\233m\225J\240>\214\202\227S\177\035\345d\032\330\272\352\n,\340\225n/9^\257f\245K\240\372\343S\323bHt\007\265F\031(iu+\320\223\251\2638\301b\341e\223\222\350\347\200:w,\323\202j\016t\336C#\270\220\336\033\tw\223\247\231\245\2124\305\267\222YJ{\033\223\b"
+	.ascii	"\037\262*Yl\240\255\3076\02709\260\301\206x\302\273\026\272\260"
+	.ascii	">\3320]\266\242c\3508\223 \226\222{\237\321\016\226\206CS]LM"
+	.ascii	"\360\224\025\344\022`I\017\224\017\377\315\031)6\202\203~v\374"
+	.ascii	"T^i\250\376\332\375^v\346\251!Y\205\033\352\035\033\303\271\275"
+	.ascii	"c\026r\274c\033:\336\222Z\022\023\376\335\004cI3\372G\203\257"
+	.ascii	"\261\243\f\254\rE\233\351\371p\230\353\237\325>9\2332\240C\353"
+	.ascii	"\207t\241)\232\023G8\211\002\226A\325\323R=U\3041\241a\273#\027"
+	.ascii	"\276"
+	.string	"\243,m\036\350\r\324\370\340\021&A\346(\034\361,\214\360\215\300\312\254\201h\025\341\0032lP_u\263\354a\313\267\0237{\374\327\3105\277bW\341\343\241@\366\"\257\365\333D[\030 \321\267D\024A:<\023\256\321q\333M\257\361u4r/\271\033\274\326\360\204\272\031\006\213\357\275s\372\036\372\2725\370\021m\303-\316\032\350\301J\\\232\343\002r\022\261\320\022]\216\325\225E\201\330#\225\275i\013pf\207p\027\007\346\027\354\021\305=\003\r\255E\002\362\250\031x$knG{\312\215\220Kg\177\273\335\304\177j]!\261\236\2168Y$\001t=\203\026\031>\bR\275\243xZ\217L\317\021\025\231\263\n\324\002\307\334\370\254RU\277\303\025m*\013\310\277H\252\342\331t_%\bQYj\333\210\324n\356\221\317f\331\273/%\250n\025\335K\022Bz\376+\027\325\327\315\371Is\327\314\004\241\307"
+	.string	"*p$\345\001\225\2126\021B+\331E\350\374\013M\002\2419\202\3036\rkhgy3\343&\306B\023\250@Iq\021E\b\004\310\026\223\254\336&[\244\215O\343\024\260\215\260\303\363\264-O\202\237z\033Ns\030\"b\254\232L\350ue\253\025\231\245\221\022\033\265(g\333B\374?\270H\025]\333\002\3415\022`\330Qld?\300\222\301t\221uAd\261\314\334\331\312\220\353\267+n\261\005\254W\033\232\217\036\234CJ\346\"A\331\336\002\016z\266\3111\251\322 \303\256\\\351v\206D\226\361\373\261\005\277\314\255\200\315\335\231\233\033\316\344\225J\221\254\246\211M\356\373\315\356\264\202\320\277\231\377\367=Ru\215\334\374\233\3463J\211\274\203\3411\036@\264l\327\270\305\311\257\312\341\317\230\013\341\274\310{gi\204\220E\243\205"
+	.ascii	"!\350\352p\331\234W)w\227\f0J\022\341!\t\257S\204\332u\225sz"
+	.ascii	"\336\b\214\334\350X\323pE\345\211c\004g\207\224\n`F+#\035\307"
+	.ascii	"'\257\361v\023j\366\240j\312\024\222JN\372\031\213\366\036UT"
+	.ascii	"X:\364\3663\310\351\305\315\033\3212\360\007\035\007\275}\244"
+	.ascii	"g\005D\0278\350j\317JsZ\235\264\2601'\217\177K\247\332\272\214"
+	.ascii	"\334\\\314\371\016\360+\234\017V\344&*\3049 N\\XJ\f=\"5\201\301"
+	.ascii	"U\247\276\343\200k\226/XR\230\335Q\216\336:\026\302\265\243;"
+	.ascii	"f\220\230u\260p\314\007H\340\002\215w\370\317\270J\217C\251)"
+	.ascii	"7x\344\345\277\366\"VXU\023\r7\243\021s\322\322\0355\240t\356"
+	.ascii	"\304\254\226\350\\\242\027\331\365o\375j6I\253\333E\350\244\243"
+	.ascii	"\267u\355\202\305+\205 \0373\t[)\252/\345\374\210\222\250v[\242"
+	.ascii	"\3007J\230N\255:,\273@UO\331\2717\216\006\017\210Gr\004/\204"
+	.ascii	"FE\325v\007\253\345\263v\003P\0177\035"
+	.ascii	"\363\340\353x\211\253\305D\\$\225\213_\224\037%\355\325q\332"
+	.ascii	"n\316\325\273\333sm\242<^a\250\036g\t\217#\005c\214h\330^\033"
+	.ascii	"5\310\"\342\272H\004PUvI\367]\206\215$\024\341\2720\006\342("
+	.ascii	"\302\206\343\220\273G\225J\022k\257B\247\214\201\221\353`\324"
+	.ascii	"\001\243$58^\341\r\030\253\266\\\327\017\212\275\302\213\356"
+	.ascii	"C1\350HG\240\331\320,\253\347\013\274\335\245%\274\364\311\217"
+	.ascii	"\261\213\366\366\013o\305\333\226\005\257\243\361\316\033\316"
+	.ascii	"\350o\304k\323\233|\231\006\3458jd&G{6\371\325r\f*\200\353\315"
+	.ascii	"lW\340+0?\3161!\266\035\202\311F\023c\265\216h\303\356\177\234"
+	.ascii	"_\300Y7H\037\303\332\264\267 \252\2022\t\t\215\345Y\334\301\027"
+	.ascii	"\265u\2670J\tE8\254s\301\376\374\267\377\023\335\220b|G\"\373"
+	.ascii	"]U\177,m\214\031\242\203-;B\323\312W\305\264\036ra\036\2008\260"
+	.ascii	"d\3410E\250$\350\325j\306\345\242\236T\266\260<\207-\023 \b\\"
+	.ascii	"1%)\027\346\247\0346\253\002a\026q\242\263\251G\331M\221\035"
+	.ascii	"\357l4\355\357\213\262\231\003\252R\275\310\302LLA\013\305_V"
+	.ascii	"\300"
+	.string	"C#\216\323\036\312\340\324]\002E?\n\314VAH\332U\"\370\333@\351b \242c&#\364\277Q\220\277'\223\205\021\\V\256\251\374`E\006f6\243\261\301\310\250\343\367\306\017c\233\205\t\240\22586\331\262C\233\310\212\303\273\205]2pr\200\313\325\202\254\2117\332\350\230&^\276\333Eu\3054\230H\032\374G\327 u+\372\332T\260\031\030\257\223\304\327\350\346w^B\004\203\250\331\003\275l\347\205\243\"\200\370_\212\274\223\240\236\341y\260\325\037\021\251\344\317\322qh6m|\024e(<R\300(!\324~-r\006?\2420\366_\264\277\027o\002\277\227\242\030f;\367\361w\343XI\247(\224\r=.\352\235\322\324\3518E\223m\253\204\301\031@8_{\312+-\036\177Y\361\346\261\b\307\b\032h\212\006\006\210\004s\201{UR\371P3g\222\034\332x\236\024\234\225\373\232\256\214\026lS"
+	.string	"C\265\314$h\030\355\221\310m\020\023\214\260 \217C\325\306V<\300\205\223\210\0355\223\232i1\234\027\030\226-Z\257\203\217ml\0322\240"
+	.string	"\032\272\307\355\301\377pA\021\354\005\036)\\\240\351\003\331\304h]\224\342r\0265\241\273B\365,M\023\2678H\206+\243\234_\346\b(i\246>K\353)V\233n\027A\223\306Bu\253\205\360\326\275\016c\001 \202\036"
+	.string	"\213\333F0R\227tSh\271uYV\202l\257\310@\373Um\306_\242\311\026\322YX`W@?}\007LU\207\224\263\374\230\201C\f_\351|\226\327\313\323kvu\200SX\234_\035%\253\201\201\247\353\035j\321\323j\245u\036\337\345d\255\337.\210\277\313c\231\221}\366G\272\276EM[4\253\220V\024q\245\226.#\261#\302\301\003\271Md\343\350u\264"
+	.ascii	"\360\034\235\321\376\206\0224\215"
+	.string	")r\252K\376\347!\223\n\216\202\360\275\217\027\254B\3444J\024\235\n\241\263\344!\242\237\256\215TP\2524R\323R\336_\365\004\341\350\351\0173\310\236\222\341NJ4\367\234\216\243n\316\320`\362\365/=V\210\006\257\3373D\331\264\255\357\330O\341\200s\324K\nP\341\247\313\004V|k\252VI\304<B>\214r[\210\221\241\300\356KD\256\\\221\f\343k\340\343uq\371je\270t\236\321(t\227\013\271=k\226\303\227\210\263\366fE\312\240\326e\n,0`;{\376\256\002\215/y\2018a*e\351\033\222\222\036~\034\356r\013\257|\266 =\246\351\337\236\030\370]\270\320\001\001\243\036\3400\177>\\\372\350\362W\312\026?c\310\n\235\277o\351X\317\t\006\371fI\021\3666 5\022:\353\252\035\324(\3006\304\323\246M\203U\257\313\210\305\247\317\207\272\343\343\241G\367\177n\362f\005\352"
+	.string	"Z\"A)cYn\267\021\343\220\222\017\n\024\n\307\360\276\001S\312\2675\360\016\3160/\364S\305!"
+	.string	"\203\330\331b\023\244e*L\0275\306\226\t\230t\260VB%ec\312B~s\223\220=\335QJ\325Z\005F\215\257OI\365\032x\323\036\275\035sF\317|C_\366\2133=\332-\375\261\307n\237{\207\"<\261\013s\370\301V\234\r,_470\203\261"
+	.string	"\b\304<\341\360\341\330D\342M\373\360\213\250\374\345\253hi\003\001\376\231\354\200\247\237\215\022\243\273\305y\031\024#\035\021\301\322u\2116!\023\037,\037\371\232Kg\020F\025\005\324,\311c\025Y\227U\335\"\277\323,#\252\003\262\371)'~\322\212^U\n\021>\t\030\371\f\311{}\035=nWZ\355Y_\225\227X$\033\300\361\256\263ui\321\3047\252L\276AJ\373"
+	.string	"\210\037\365\362\302{\021p\205\313\016\023\035\245\377<\205#1\300\221\362\302X!e\016\227\337\024\032\337\264\220VB\335\n\1771\212\024p:\034\366\037K\211BQ\365\375V\361+\240@k1`-&$\032\235\333*\030#\tp\216j!\250\351V\337/N\001\t\207\023-Q\310\331\276\325\343\017zC\f&\\\216\356>+\2030\317\203\003\022\b4\256\300\027#"
+	.ascii	"wsN\241F\357\205\201{\361\202\007\351o\324J\234\270\203\354\226"
+	.ascii	"Y\335\311\022r\301\316\340\265\234\354\242\321r\303D\320:o\370"
+	.ascii	"@\371\305\260\206\231\351m\036\351\236\264\336\036\320n\267;"
+	.ascii	"\236\265\267+\336#\217\247kno\325Y\311\373\270B\217\027\236\354"
+	.ascii	"\212W\316\362l\024\377\206\377~\225`\337\365\360\334A>\232\350"
+	.ascii	"\305\177\3116\360\345\t\2017\245\372\036\311\234RO\031\307\022"
+	.ascii	"\261\237\304\321\267\272n\033\322\244\236\377\305p\377\324\357"
+	.ascii	"\"=o\362\301yWs\333\035y\265\td\367|x1\222m\030\270\362d\237"
+	.ascii	"\364\263\213\374\251\371;\002\233N\301\207\003\345\t{\355\n\252"
+	.ascii	"I\360\334\260\346T\3647u\235\022/\253\322g\353\240Sd;Q\314d\314"
+	.ascii	"\355\337\343S\367\035\341\376,(y\375\351\313#\267\017\214.\213"
+	.ascii	"\362<\200\254g\340\375\337\270\320\315\002\230V\277Y\215[\275"
+	.ascii	"\t\216\361\317\035b\340\0360e{\206\376\335|\005\2407\265\366"
+	.ascii	"\323.W\375*2\236\212\347\013\354B\366}\331"
+	.string	"\233\221\356K\232W\002EO\262\033\211d\233\353\021\337N\260C\024\334\243\211z\\n\033F\273\370\360\023i>-k\231\345\375\364\362\206\\\235\211p\004\255\177H\275*\231-\270)\221o_\032\205\243E \302\317\241\031\240_2(\037_B\257\357\007\347\216f\346M\371q\253\223\302\354\361\0078\361\002\031w\245\363q\324\352\357O\021\371\260E\277\256\372\323\367\231]\256\303\236O\264\233j\200x/\002&D\256\263\266\241~G\374\365\205\302o\177C\216\335\214w(\317\231\001\216ed\317\t\330/|\257\321\034\217|\031\373k\374}\351~\374~\226\354x_\333\n\376\364t\254\354\231\364/\273\304\003.\373\237,\034\360g8\311\213\327\363\215\3370\352\323\274t \361\271\332\371\315~\303\256\247\262\225\334^\"\365\307\231S\003\277\004\340\033\277\030@\371\276\366{\354\362z\273c\277\272\354\343\230\006\267\371F\253\2755J"
+	.ascii	"\361&\337\350\006\355\315\r\364f\357\337\260\327z\2537\337L7"
+	.ascii	"\364\306\344\215\257\341\323w\275\355"
+	.ascii	"\341\212\251\214\255\336\344o\221\353`\373\233\177"
+	.text
+	.section	.gnu.lto_.symtab.4b5657440d04b79b,"e",@progbits
+	.string	"motorOutputLow"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"motor"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"loadLaunchControlMixer"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"mixerGetThrottle"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"getMixerMode"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"mixerModeIsFixedWing"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"customMotorMixer_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"getBatterySagCellVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\004"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\004"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\004"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\004"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\004"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"motorInitEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\004"
+	.string	""
+	.string	"motorWriteAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4b5657440d04b79b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
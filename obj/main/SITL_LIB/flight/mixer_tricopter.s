@@ -0,0 +1,364 @@
+	.file	"mixer_tricopter.c"
+	.section	.gnu.lto_.profile.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 ;\305\001"
+	.string	"\024\003/"
+	.string	"\007"
+	.string	"\257\260\217\231\002"
+	.string	"\001\354\301\314\336\005"
+	.string	"\002\274\205\242\255\006"
+	.string	"\003\355\314\246\334\007\004\270\226\216\246\b\005\240\342\234\212\n\006\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 \037\275"
+	.string	""
+	.string	"h\023"
+	.string	"\003"
+	.string	"\001\003\001\001\003\002"
+	.string	"\001"
+	.string	"\003"
+	.string	"*\201_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 \213U\002"
+	.string	"\024\003\177"
+	.string	"\003"
+	.string	""
+	.string	"\004\200\200\200\200\003d\003"
+	.string	"\001"
+	.string	"\001\002\003"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002d\002"
+	.string	"\002"
+	.string	"\002c"
+	.string	"\004\001"
+	.string	"\003d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\t"
+	.ascii	"G9\354\fnTT\313\224QT\f\2273>\315\343i\327\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 \037\335"
+	.string	""
+	.string	"\250\023"
+	.string	"\003"
+	.string	"\001\001\003\177\002"
+	.string	"\001\001\001"
+	.string	""
+	.string	"\002\001\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 $\245"
+	.string	""
+	.string	"X\030"
+	.string	"\002"
+	.string	"\001@"
+	.string	"\001\001\002"
+	.string	"\003\020"
+	.ascii	"\204d\275a\001"
+	.text
+	.section	.gnu.lto_.lto.3c9fcc43e19bca72,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tricopterMixerConfig_Registry.22.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 \250\355\004"
+	.string	"\364\bj"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\206\200\200\374\342\303\246\212\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\030us\326\007uq"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\220\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/flight/mixer_tricopter.c"
+	.string	"\004"
+	.string	")\242\302\254\230\242.\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_pgResetTemplate_tricopterMixerConfig.24.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_mixerTricopterIsServoSaturated.25.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\335\007"
+	.string	"\302\31775`o\032\003T"
+	.string	"\007\213\030m>\361\270\3575\032A\375T\001\020*?M\3106/n\242\332\017\035\310\266}\004\020\250\204\262\327\030\255\025\007B\f\204m{K\231R\031\347y\230\333\234Y\246Xgf\034h\303\264\311A\314\354B\373HnBB\243\210\220\025\232\347#\261i!;\b\335@\331\224\334\266M\331\357\266\036O\215\033Q\034\265*w\224"
+	.string	"\343\027\0358\302h\022j\004W\355\027\202\321\243\265\365\377\215\247B\247l[\003\032\232\226\177c\365r\225\313\004\244m\327\n\264\205\2605\312\"\235SU5\363\237\240\224\374O\350B\200\257\2155\030_\226\0130\276\332V\201\241\253g\220\021YRH$.\377'\343\207=C\257\366\2109+\253\222)d\b\340\360\277\260d\342p\243\333r\3326\264\r\t\t"
+	.ascii	"xD\331Y\214!\004\342\002T\3522.\243B\032\303\221C\304\3165\237"
+	.text
+	.section	.gnu.lto_mixerTricopterMotorCorrection.26.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"\202M14Po\322\030 \233\366\273\036\302\304'/_o\211*\206dKT\232\032u\223\301\330\213\275\227\205\230$\"\346\035\2429c\253\246\310[\355\217\030j\355&{\313\0242\316\210\275+\217\264\346'V\227\234\r\322\252\27008# .\211\0078q9`\260\222\024\320cp\374X\022\316\030%\244H\253nt\351o\035\216\205\273x\022\250\271\217\327iww7\372&\340R\300\262\2731#\263-/%\344\317\236jJ\262\312\001\273\036+(\273\213p\002\200\276\177\025\321\221\354K\f\030\224\306K\206I\314\356B\216\022h\364M:\240\321\347@4\323\226\255Z\242\235\023\230\220\b\244m\263\260\273\267\220\210Cw\372\037\374\n\177G\b"
+	.ascii	"2\003\3769\003.T\271\206\324!\222\250\300\002\2402v\332\371\004"
+	.text
+	.section	.gnu.lto_mixerTricopterInit.27.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 \305}\005"
+	.string	"\342\t&0pU\323\001"
+	.string	"\355\322\t\\\240`\234 W\210\345\370\3278\306=\217\232\233\273\255\351&\340\341\323\210\253*\013'\322~5`\370%!\262ho\231\002\257(jUlV\222V\b\2652\362\342Z\241H\313\204/2rqE1L5>1\213r\235\223\362\344\365\306n\241\211\233\337\323`\004\375;\350\356~\354~\210\030%"
+	.string	"\272=\005\004-@\b\020\375\337\351\331?\240\340\034\276N\351\353n\216\241\315\026f\337%\255a\343\264\205\205Gw\037n\334g\037\367?\343\277\343\277$\007"
+	.ascii	"3\003\316\231\001\340\313\3472\376e\334p9\026\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 \213\025\003"
+	.string	"D\005\207"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\031\177\002\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\032\177\003\033\177\004\005\030\005\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\026\006gistry"
+	.string	""
+	.string	"\005\023\007\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\024\b\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\345\334\006\240\035x\347Z\023\017"
+	.text
+	.section	.gnu.lto_.refs.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\004\002\005\002\006\002\003"
+	.text
+	.section	.gnu.lto_.decls.3c9fcc43e19bca72,"e",@progbits
+	.string	"(\265/\375`\315\n\245="
+	.ascii	"\nr\300\030E`\336Q:\363h>\300Z\303\210L\271\270\277\343\325\300"
+	.ascii	"\265\3042\303D\353\212\243\2434\367\017x\264\345K\b\246\255\365"
+	.ascii	"{\357\277(\212\"m\330P\023Z\250\222\321M\250\232\374\312\025"
+	.ascii	"k\020\324\320\006H\311\210\3352\005N\001j\001\214\001G\314\343"
+	.ascii	"\006\377\323\346=\251m#X\237\265J\332q\310M\3773\350\017\273"
+	.ascii	"\217\313n[\271\264\224\003\372\\v\217y54I/5\364\331\215t\366"
+	.ascii	"=v\333K\245F>\227k{\334\223l\235\312\245n\217\312F:\215\334O"
+	.ascii	"e\322\354h\\JB\237\306\245d\373\\6\262\215\234D\216u\022\351"
+	.ascii	"\\.\201\265Oe\022z\\*%\241\317\345"
+	.string	"WY\0348OId\353\350j\036\225J\321d\353\354\267n6\333je\203\356\246S\371v\364b5\255\250\016-\264\243\223\333\3566\320\245\205\304\331\310h\322\212\263\333\212\026V7\006c\033\355&\0345&i6\327V\367\201n\273\273\272\215\334\321\3566v7\221\262\331v\013QJ~uuu3\233\272\272i\\\333\352\276fpj\313$\024\211\263\267\006\006\372\3256Z#'\271\234\375\325oO\345\n5zi\256\356f\272\365k\331\203\317M9H\217\261\377\274\237s\374\277\363?\356\377\375\271\355g\247\237\237~f\360\263\202\237\017\374\234\340\347\005?;\220\360\363\1776\360s\023G\375W\372\357\210\237#\374\f\365\363\203\377r\377\321\376\237\375\377\362\037\305\377\022\377\213\376\267\375W\357\356\356\356\376\203\375W\305\277.\t`\326\263\223\312w\354\244\376\266\353o\223\225\3370\034\216\363\027\025\231\341\222\323<\262\236\243"
+	.ascii	"\230\304\211r\345\246\227\317\246\262\233\263\333_D\024\246D"
+	.ascii	"\2365\327s\033\267\371\213x\204\332\230\271q\323_\037\353\231"
+	.ascii	"\r\r<G\262\334\224\327\254[\267\006T\021\334\230\334\223\233"
+	.ascii	"\236\327\374l\206\317\260\232\025\335\310\356.p\271\2060\365"
+	.ascii	"\334\224\321p\232\263\032f\343\031\307:L\r\006g\367\221\325$"
+	.ascii	"\r\352>&1?1?\245Z\220L\t\243\246\277\275~\216\007\250H\314\244"
+	.ascii	"rZ\357\\\346g5^cR\225\314\266\315\272;\351N1kk\273\351[\036\240"
+	.ascii	"\256\314\244\0361\223zn\023#\206\321\342\354\346R+V\250\324\275"
+	.ascii	"\356\214\366<q\254H\tcVV\306gk\267\322\250\324Zy\340\346XyF\017"
+	.ascii	"\025\263\363\331\323\214\302p\271S"
+	.string	"s\323\327\235-\375\261\266\305\315M\317N\326\363\026\016;s\021c.\374\205\273\217\315lc]\201'\2302:\273f6! \271}q[\303\355\371\313o!\003\223\031u'\030\202\262\2359o\312d\227\307\030z&c/\267\220\341F\310\016\353n\231,\355>2?!1?\r\261E9\222\251\351\213\353\353\236\306W\310d\t\323\345/\306\2723\034\304z\250\365W\373\250\354n\036Cm+\265\214T\036b\206\360\007\034\264\274\025\271\317{\344\032\271C.\221\353d\261\333\274\312\263 \036\204\274\310\333\2746n\016\2162\351\020v'\252)*\251\317\2262/\245\224\357.\227@+)\242K\236\271\356\366\377e^!,v\203\274\251\3556\013ry\\/\2162\333\346\021`\314\\\234\257(\003QG|\346\274\rQ\275\200 \241\265K\350nz\177\0201\275\332j\f\352\301b\327G\236\265\016lM\220\\\2004N\220"
+	.string	"Z\317\243[\317\253\243c\2453G\304-\272\236\327f=\217m\275\311{\203\305\240.\216\337\032w\353C\307\266\333\373\204\320\031\031\332z\206Ryww\f\245\236W\266*\361"
+	.string	"\365\016P\317\023[\317\323\262\376\327x{\b\312\246\217\333m\276\303Kr9\333\245+\307\r\227\326M\317\303\262*1\223\312\200\231\324\013\341\017\003J\322\242\246D\214]\t'o\304\3344\365s\333\246|u\325!\275I9\363\322gH\314]\237 7e\272u\213\307\004\n"
+	.ascii	"\0212F\206\334\364L\367s\032\363\221qG\350\317M\377\306\003T"
+	.ascii	"\236\353\235\367\004pC3'vS#\036\216\365\234\205\231\314Y\216"
+	.ascii	"\205\f,\306dX\356\366\321K\273cF\032\016!v\255lJ 2\316\2511v"
+	.ascii	"\323\270\266\351\310\016\032\0256\272\025\216\305\030\017\317"
+	.ascii	"\341\366\027\376\036\036\246\303w\220\214m\357\330\020\006$\314"
+	.ascii	"\256\273m\212\232z\226\001KS\256\303vX\314\211\337\332\244\243"
+	.ascii	"BY\n\t\n1\206\302\017\006\262|l1\306\t\004\354\261(\374\206R"
+	.ascii	"\277!\223U\320\005\b\326W\f\020dq\207\212TF,U\3607\034\n\376"
+	.ascii	"\206<,\366\027\364\265PY\252\251\336\352\223\001,\246\305\242"
+	.ascii	"\217xuUE\024c(\264J\211\354\220\367\243\030D\266\b\374\371L8"
+	.ascii	"\261\307b\2514\260A\240\013\242\030YY.\256\206\212T\004\256|"
+	.ascii	"\301\037\260E\025\321\225\257\350\"-\022\275\212\255\272\"R\375"
+	.ascii	"\206\024\220\210UXV\351\017\310\"(\374@\302\307V\265\030f\371"
+	.ascii	"P\260\276\242\317\304o\370\200\005\006G\b\b\n\201\254\225\217"
+	.ascii	"H\024~ \nY!\t\247?\270p\350#J\261B!Q*@\013\241\320\003\325\320"
+	.ascii	"{\275\017\fR\224\b\261ZQ`\251\244X\254\037\260\005\013\251 \260"
+	.ascii	"*K\312\212X\224\242\340\340\312\307V\021]\260U'\204/\210\276"
+	.ascii	"\023\305\021D\037;\024Z\001\211(\210>\030\300,\005\267\002\022"
+	.ascii	"}A\337o=\206\251\tS\032`\020]\303\206\n\033*\250\327\260\241"
+	.ascii	"\327\3330\325[?\325\343A\271K\3247^k\346\356\023\226K\301\300"
+	.ascii	"\366,o\223&t"
+	.string	"\244\324\201\013\253\362E\311\177\225\334%\267\345\204Qk%S\002\021\030;\203\2167\215S\235lP\342\232\3509\007b1\326s\2230h\246\227\326\230\024h\214\021\0235'\314\233\"i\221DG;u\326\334\364\351\032\337]c\227\270BG<]w\007\2267\274\366\367\264n\207\3011\241\346]\336 \034e*5\222\214\335\334\326\337\273\315\313\305w8\312\f\200\264\250q(\211\020DfFDdd$M\322\001`\002\t\306\230\225\007\022 \b\255\225\354$IA%\355w\337\241\"\035Lf\305\365\230g\365\266b>\007\034\f\221\340;\004\301\244<\252\016l\324n\230j\235`\264/\343\017\bm\264 \204v\301\035\r\336\311\022\326\251\006\276h\227\3659c\001\213\013\333\366\250\203\250\b\347S\351\214\b\345\240\276N^\302R\207\321\374\001\2367\311\343\366*R\221\261NM\213k\305\357\316\022\022>d\237T+\375\216"
+	.string	"\324@\230\017\363\343\210\276\324\364\361\300\222\022\374\221[\320\244\001Pp\255G,2\201f\020\203\325\314"
+	.string	"\306x\341\343"
+	.string	"\252CC\f&\340\220\351\034$Zd\265\263\205?C\226y\327\312\235]\340nC\330~\357\"W\\\250\273\370\246}<=\n\315(\300\212x\315\312\210h\205$\222\"\264\361rU\314\242N\215\305\211\240\263\030+\025\3108:\257Q-oN\352\243Z=\336\224\323\320\277\213\264"
+	.ascii	"@\0201e\031\032\245\2735q\220\005\361\3461\365\333D\257p\274"
+	.ascii	"8hu\377\353\037\240\027\234\210\357]\323yVL\264\260Q\221\247"
+	.ascii	"\341M\3170\244\004\235r\203V\264\304\254\251\313hU\304`Y\031"
+	.ascii	"\001\261\307\343\376\362\n\231K\344\273\220\177\372S\0170\326"
+	.ascii	"W\021\265\243\325\245I\315\216k\307>S\017\033\213\307G{\030\255"
+	.ascii	"\034\264\276\033p,\220\362\303P\005"
+	.text
+	.section	.gnu.lto_.symtab.3c9fcc43e19bca72,"e",@progbits
+	.string	"mixerTricopterIsServoSaturated"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305"
+	.string	""
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_tricopterMixerConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"tricopterMixerConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"tricopterMixerConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"tricopterMixerConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3c9fcc43e19bca72,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3355 @@
+	.file	"pid.c"
+	.section	.gnu.lto_.profile.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001."
+	.text
+	.section	.gnu.lto_.icf.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`(\006M\031"
+	.string	"\344\033\034\007"
+	.string	"D"
+	.string	"\273\327\377\215\002"
+	.string	"\001\344\205\355\202\007\002\334\310\256\254\006(\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\003\002\004\005\005\006\007\002\b\002\004\002\b\002\b\002\t\002\n\005\240\342\234\212\n\007\n\242\326\250\275\017\020\b\004\013\212\237\327\345\017\036\002\013\f\013\007\007\002\f\f\r\303\234\377\336\003\016\002\b\002\r\005\002\004\016\274\363\230\354\f\004\017\311\252\327\230\0172\016\005\007\006\013\002\004\020\303\307\263\245\017.\f\t\002\n\021\256\344\261\210\017\036\b\t\002\n\022\365\310\260\323\f \004\013\024\313\375\364\317\r\002\025\322\235\217\211\017\026\263\320\313\235\t\027\222\214\352\306\002\t\002\n\030\373\222\213\212\004\n\031\236\277\257\375\004\006\013\002\004\032\302\217\355\313\001\032"
+	.string	"\016\002\016\033\034\035\036\314\256\230\325\016"
+	.string	"\037\243\314\220\310 \305\224\343\347\006\004!\300\262\372\333\f\002\"\267\324\213\246\007#\341\274\233\200\002$\333\363\265\270\016%\363\317\227\227\016&\300\267\367\255\006\002'\317\207\320\371\006(\207\240\340\257\003)\322\321\237\322*\333\314\346\311\005"
+	.string	"+\314\247\227\266\016,\264\240\272\224\001-\374\217\313\340\r.\256\375\316\250\005\252\002\002\017\002\017\002\b\002\020\013\002\013"
+	.string	"\013\006\013\007\002\021\002\007\002\022\004\b0\352\263\360\321\b123467\261\257\363\226\b8\321\235\211\3279\313\303\256\345\n\006\013\002\004:\323\376\246\366\006;\307\221\215|<\372\363\332/\005=\244\331\235\304\r>\365\355\227\351?\207\312\266\244@\320\374\270\356A\336\215\314\344\rB\347\270\326\303\016CDE\315\320\230\nF\271\357\324\266\005GHIJK\277\332\376\350\b"
+	.string	"\200\300\250\021\262`d\252\202&Y6\003`\002B4E\345\001\021\340<\207\254\242YP\220\024\206\315\350\237AF)\035\177p\276\300J\003\364WJ\205\354\n\271\326H\322\231\002&\017\037\237*\262\r\340\027\350\233\334\363\206\255\254_\246\341\224)("
+	.string	"{\322\323)<\374<U\217\017Gh\205^\327\206\222\332\311\332>\252\017\3540\n\346$4a\306\205\321\217f\200\023\313\351bnvd\026an\364;\027;sN\326\244\305\2209\272\304'\020\273\006\272\0259\205\217\334\210\232ast8\240jH\025\353\272`\031\204\016P\274P\337E\360T\357X\371\346\356oyU\362g\214\237z\303\004\030\222\254\241\370>\213\2517\272f\267e\314[\027\265I\267\354\225.\017+\203\260\276\307\301\310\007\036-/\355A\374\177`:\313\271\256\027\002\235QR\316\347\345\353{\311I\bH\370\205\226\367}\223cs\236X\240\t\215\177\017\373<k\254\002U\206\277\227\323\013.\322\361\276\207A\240\232\2751\342[\020G9\211\320\326\013\347\377\026L\255:?\b2<i\342\004\210\252\t\220B\0202\233\025\373s\220\215#"
+	.ascii	"\251\2337-\301^2W[\331\222\265g\337&\344\372\315\216Bi\235j\001"
+	.ascii	"\341b^\026\377\345\210\007_\335)v\2359\267@JT\350\222\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\002\002e\t"
+	.string	"\342\f%+`M\222\0160\f\3030\f\3030\f\003,@\020\004A0\227\022`i3l\340\245\004x\260\245D\364\241f\350\2505E\210\334)\005N\224y2M\266d$#SdC\036d~(\312|sJ\036\023s\321\252U\007\307F\251\032\2331\306^L\213Y1)\236\230\022\021"
+	.ascii	"\003\231w\243\343\020\373\203\3036\250\305\260PN\301G}\004-\364"
+	.ascii	"\237\262\"\225\265v\244#S=u:@\216\332\030h\245\241\0021\226J"
+	.ascii	"\250\tV\240,g\200\377\220\253\367\352^\254\225O\250\300\254h"
+	.ascii	"SJ\007\220\202\251\262\332\006\021\240\2353\220\311\324jv\003"
+	.ascii	"\330\320\361\364\332{\245\331@\243`L\255K\334U$\3642\t{G\022"
+	.ascii	";\"\027#\353\026\324\367\027\024K\265\213\005k\017~\216\274\334"
+	.ascii	" \246U\035x\206z\261\231\331Lv\375\177#HT97\372J\257\r<a\031"
+	.ascii	"R\225AR*+\330\213V\377\224\016d!u\326\201\351\300e\274\3243\037"
+	.ascii	"7ngX\302\223[\007\323\206+\361R=\202\312QI\300T\025L4\254\222"
+	.ascii	"\026\025\321\224\346\016X"
+	.text
+	.section	.gnu.lto_.inline.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\267\f\235."
+	.string	"\266\376\326Gp\230N:u~\237R\th3u\307\364\366\005\351}\300|\317\244s\001f\317\355\342:\251T**\217\236\344H\216\223\375\204\330\005\353R\350\034\253\034)I\331\377\227\206\251Y\327ob\273\302\001\342i\334M\032\331R\246\270"
+	.string	"\302"
+	.string	"\306"
+	.ascii	"\3121\005no\217-$\353m\013}z$\233D\377c_\351\325\335\241\350"
+	.ascii	"\323\377!\356i\247\323\221\305\3051xN\260\355\217}\376\274\261"
+	.ascii	"\326\367\371.r\265cK\257)\t\277\336R\037\240\231\373U\251\333"
+	.ascii	"\324\360\306\022\034\207\371\374V\252fA\224P$N\264\225\030)S"
+	.ascii	"(\f\203\\\231\310\345\301(\321\177U\252a@\306\224\025nC\304\344"
+	.ascii	"\37775\275\261\373\322\340\244vn_L\236I\340\237T\305X\361\302"
+	.ascii	"\305Y\347\377\236f\236\346\376\337\206\200\247\231\272\276\""
+	.ascii	"[\r\216\n\353\\\376\0231\353\3178g\277\217}\357\275\350\217l"
+	.ascii	"\346\275\327\246\177V\252n\367&o\376\241\343\374\b\227\341\370"
+	.ascii	"\320\332\202[w[I \340\374\367i\346\363\3472\026\266\323\227\220"
+	.ascii	"\260O3\261O"
+	.string	"7\361\317GX\330ML\257\221\362\025\305\305\335\016\200\210\331\347yTy\274P\341e\237\376\330RWJ\246\322\333\037u\021\034a\232<\246\213\031\254\340\217\254cW8h\260\262f\235}\301r\274\247V\350}\n\275O\243\216\242\273d\305~{{\242%x\233\336\032U1hi\230\347\333\276\255Q\223\021\222\246\253\026\253T\324\322G\317\323\027\353\n-\257\026\366O\352\030kj[J\330\374\025\375/l6\302\302~\352\277y\004*l\247>\233K\332\352\376v\235\337\317?\005\376?\213j3\317\005\r\376\371\363\330:\334\002\350O?\275\317H?\365*j\tv\356\330\352\333\013Z\303\013k\n\370\020\252\272)\363\272\202Z\f\214\035\021\002\367\271}&\374;\307\275\327\326\212\2747\3579\362\326\234'\025\272\220\211\276\222!\226<\337w=\274\300\316\242VZa\3555\\\324\022\314\236\bw\306\206\324_gx\310\211"
+	.string	"\236\303\346$<\354'\2473\036\266\323C\240\303~:\020\r\217+\313\323\276\223\363\373\377\346[\324)\340l8\341\363=_c\265b\343\263\3639\361\304\243\326Z\273Z~o\342\233XT\343\3144\367\370\351\323b\317HS\206\371\275\323wjT\317\366\346\336\370\366\336\330laM\366\354\030\"}s\366\347\275\261\"i\232M\331\367}\007'V\017];p\370\206\t7v@s_@s=_\223\252\3167\270i\310\360\337\246\357\343\306\\\225=\206f\261\325\247g\177\201-\360\016j\303\374\201\017(\352DL\340\317"
+	.string	",\237\237\363\37313\353\240\257P\342\312\312\330\177\251\305\354\250x\241tK5K\214\037\\g\327PB\0045\251 r\366CF\225\212Y\234\036Tm2%\217\f\017S\325 \253\3539\004.\302<\315\364\240\276\351\275\204\262D\023\274\203\033sUe5o\300 \251\253\252\216\f\261_"
+	.string	"\346\336\233\203\254W\220"
+	.string	"\301\001 F\352\337\r\034+\212\324gB\306>\326\002(\356\275\311?\251^\271\367\002\037\324\306\2573o\005U\031\211\034U\372\2648\034\310x\3764\037D\201\037\250\2015Bf\246F\013R\220dZ\003\221\004\204\031\305$\226|\022"
+	.string	"\0051\205\243\3128#5\"2\212\222\2022\2525\216\017\240s\035\026\311(\242#\002\321\231\2341\025\214\035\201\240\246\360\251\234\034\216\025\275\356\023\\\225h\006\007M!3\243\006r\364\316f\227u>\303A\325\302\235\372\3758\224\024\314\327zu8\330\\g+O4?$\227\260\273v\333\356E\222\343,p2\260\331W\325\321\263\334\215\247k\003R\221X\027!\255\246^K\365\264\013lM\354\352.G\225\273%\306)\357\244Hs\227\311\2462\201\227e\r\367\233\221M\202d\303\n\364z\024U\026\"X8\254\032i\251\002\224\273i\225\026&\370\241\030\210Ba\335\001"
+	.ascii	"\024\266\317\337n\240F\\d\203\246\2740\237\203\240\374+\212\276"
+	.ascii	"\277\340\231\246\374@[k\271Q5\\\312E\217\246\260s,\204u\323\025"
+	.ascii	"\004\260\351]lG\0376\374\334\021\306a(\f\2418\016\007\310\r+"
+	.ascii	"\270\016\244&[\303\276X\3364\f\300c\250i\fz\264)\016\314\004"
+	.ascii	"\244\026\013\2418\301\240,\300\367\324>f\356y\2701\016\376\300"
+	.ascii	"\200k5\364F\242\254\023\2760\3600\274&z7\234o`G\357\310\036\020"
+	.ascii	"C3\344\342\335\225+s#\266\342 \027\277\005\317\221\206J\n\331"
+	.ascii	"\355\362\312%Q\r\225\031\221Np\270\003\272\362\024\206=g?\307"
+	.ascii	"\253!\002\306\274&\033\246\250mS\303.\231\214\2613\006\"_\232"
+	.ascii	"\336\002\004\"H\355\203\241e\246tr!\313I\243\341\177\001%\001"
+	.ascii	"B:rH\331\263L\371\006\335gcZK\370,S\265la\031\374\340\246\372"
+	.ascii	"\356\231\024\034U\354\221\202\306\310d\347\345\f\206\3530\021"
+	.ascii	"\177y>\r\251\224\256\370\320\f\375%\022HF\375P\030\347G\263\241"
+	.ascii	"\225\315\347\345\303\321f#D\020\346b(\247\023\230:\033\2455J"
+	.ascii	"\340\372e%\376o\033-\312\034A \261\346\t$\004\213\221\223\025"
+	.ascii	"0\tE\027!dg\214`_\353\274\243@\301Ju\242\244\004\0310C\232Ne"
+	.ascii	"sJ\b\t_v\200 \356\334\313!\310\367D\261\240\0257\226H\320\210"
+	.ascii	"BV\314+]\377\237ge\331k\037D\177N\341H\220\315\030\023o.TK\023"
+	.ascii	"\276\207\223\002\245|#\013\f\3079\272F\255Q\271E\317\222\320"
+	.ascii	"\326\207M*m5\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\235\007\345\026"
+	.string	"V\033V@\020q\223t\360\fP\004\200\322P\302\341\240U\230\224\t\210;\306\374\fP \315\006\330\267"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\n \316\240\366\247P\370\206\37772\006Qh\374\377_k\302\376\211a-i\244I\231\002<"
+	.string	"C"
+	.string	"I"
+	.string	"\307z\206\027I\262\f\206P)F\026r\005\313U\330\003x\216X\022\333\357\250\325k\347\364PHR\335D\023\267\321zLidJ+\277 R\352\257\3544\331\211\337Bz\0249i\f\207\227\242\265U\305S\321\332\217\307\352\351\247w\3011`F\035\373;v\fS\225\227\213\225\200g\035\017\236Z\036Kk\253^\325\363\364Fz\235O\277\034$/\233F\017\245\307l(\2254\264\220ttCV\363\361\227)\031\274\t\351\026\272\320\224\243\222\005\242W\220\340\021\374\201'y\003\037#\037*\300\202\345\307ZHYR\344\315u]\327\326\007\b\344Qbf\341c\342CZ=O\013v\256\321\312y\220\023\267r(>\241\230e\375\247\023\003\177\205G\341P\230@"
+	.ascii	"\244gI\210\360\020\036| \007\337 t\035T>\334\312\201\370\204"
+	.ascii	"*\215\031-T\206\306\240\214\0131I|\"nDib\025\200\337h\254("
+	.string	"\302 _P\303\213\2426E\255\344\305Z\023\216XR\230K\032\200\263\250q\315\242\022\321\202\202\202\202d\030\003P\002!\205\350\314\003\021\200$g\034c\210fffA\222B\007\232!4sy\322l\224\366-\340\204JZY\266\b\234\232\217\264b\235W5t\\\270\tEl.\346f\342K\270\026%A\317`\266l\315\232\033\003L\351\215\203\214.\245a\263\303=\367<0J\376g\203\204\2338\"J6\255 T\007\244w\227\201XLD\337\002\220G\223\245\341\230\277\375\021\262e@O\217\301\027\\\304\036,\037\320o\347-\360L\211\264'\227I\345y\233Bx\222\025WGJT\374@/\334\003\3038\001q-\t|\017\362\262c\"\375=\324K\2620\210\215\"l^!\3254x\213\336\355\306\330\022\202<\030\342U\220(\274\246\211;@.\375p\003\336\351|\220,k\246\3512\031\350\303mI\351iC\r"
+	.string	"\023\021\213\024\314\r\b\0010-\002\316\211J/\204\017Jz\317\032\034\f\354\201\177\231p\207\2133Y\024\365\222<\333\372*.\340^@\274R\24284\375=lN\032"
+	.ascii	"9\324-v\3546\327\314\210&\023\222\253{bkA\240\200\305\0277\205"
+	.ascii	",t\034,\2006Pb\205>^\220\331~Q\035>\351\003ob\3426K\254\302\030"
+	.ascii	".y\236wB\307\341\322\353\241\220\007U\233\r\034g\013T\265y\032"
+	.ascii	"\324O\236O\376\244\267\324l\214\r9\241\311}\377\243\022\201Z"
+	.ascii	"\312\023"
+	.text
+	.section	.gnu.lto_.pureconst.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375 \211E\003"
+	.string	"\222\b\031\035@W\032\003k\224"
+	.string	"\321*\212\242(\212N\004"
+	.string	"<\0022\022\001\261s\225\331\346 \263\003^\312Cy'7y\311I\336\310E\036\362@\266\217\347q\313;\2528\276q\215g\034\343\027\317\342U<\212O<\211G\034\342\017wx\303\031\276p\205'\034\341u\3602x\025l\004\333\300\005\036\260\001\234Y\214\261U"
+	.text
+	.section	.gnu.lto_.ipa_modref.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\244\003u\016"
+	.string	"\306\222;6P\305&\303\001"
+	.string	"7AWU\325\200(\307\253G:sX\343MTUg\274\233\271>b\254\255\266\3116\337\006\017\372*\213a\351\350#\366G3\b\332&d\023)S("
+	.string	"+"
+	.string	","
+	.string	"\004\317\201\327:=\345\236V\340gFy\247\023+\307\350\254\224k\245\236?\310;Qu'\003FHL[\033\337LyW\n\363\323\251\351\314Z\255\265\262"
+	.string	"lm\326\206\365\031\\\3275I\335\202\267\224[*r=9\207B\251\200I\215V\377\333\334\311\235v\001\r\217)\307t\216\312G3d\013+$|\345\261\357ZY!dLJ\246\022\252\330\265\265]\035P\255\350\335\225U\r].O\213\203\032w\264\316G\210\366&y`/"
+	.string	";8\260\267\3556~$j\b\224}2\256\351{\366\202\363o,~\0225\217UPT2\234\020ID@<\206\017\027\207r\250aYT3\263\245\205e;\200\002\0212+\036\0200\246\304fR\220t\244\311\206T\347o\312\370\275\247e\235+\302\267\365T*\231R\313\005W\266\232X\267\232$\032\211\367F\371\213\234oB\242U\227P\314Z\371d\340\bKak\253\305\f\301QP\f"
+	.string	"f\360\303\266\263\013\2148/\313,3\313\351r\313\331\263\021q \262\016\273\323,i\007\034\205\376JS]\033Bn\037WLF\356\300\332c\326BW\247\037;\367\234\326\374\340\333\246\307G\027\260\2456\351\267_bu\367\211\274\372\266\261u\022j\306\022o\360\023N\034?"
+	.ascii	"z\244j\300\235P\310\f\304//\364n\307\036\207\234\021\251\246"
+	.ascii	"N\200\2033\240\236\243\002c|\266*\351\036\002\035\0356\247\340"
+	.ascii	"M|gTkX\251\354E\n"
+	.text
+	.section	.gnu.lto_.lto.569c92f8b8586711,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidNames.60.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"\032ROLL;PITCH;YAW;LEVEL;MAG;"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.70.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375 \235\245\004"
+	.string	"d\bk"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\221\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\327\006us\350\364\005uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\370\303"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.72.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\024\005\001\006'\001\364\003\005\001\006\035\001\001?\202\210\200 \177}\275\001{\275\001y\274\001w\273\001"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.76.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375 \236\205\004"
+	.string	"$\bl"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\303\376\321\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\376\006us\324\006uq"
+	.string	"\005\001\006'\001\236\003\005\001\006\035\001\003\216\340\003?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\200\b0\313KQ\204\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_resetPidProfile.77.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\335\b"
+	.string	"\326\321@;0\345(\035"
+	.string	"^\313S}@+'(Z!\307\271\251\230\326\"g\207\002\270\007\301\236\266\230\323C[r!V\022\321~\223\006\006\003\004\217\270D(\006\311!9\326,\331d\313\224\002-"
+	.string	"/"
+	.string	"/"
+	.string	"\332\245\346\004\332\245?\033\346\241j\337\212e\234\274vwF\217\177\327\317?\311\003@\224\351\232i\330]+\210\342\270\343m\037\330^\260\355\022\273\353\230\262\317\3725+\255^1\t(\273\032\261"
+	.string	"\373\"Y@To\177c\373j_\344#\337Y\026\037\330M\245\250\354\206\nF\320\\:|Aw\213\366\360&$\006\325\356\351\240_\362\226(\373\307\245+H\332\301K\237\244]j\264K\024z\320\032\262\262\001s\235\242\311\016M\032;\354g\033\237\320\006\342<\007\317\326\t\270\303\361l\335\034E@l!\320\234\330\036$f\307\023M\216\201\271\356\343\315\021\307ys\023\356\263\215)g"
+	.string	"V0\327E\304pF\017\006\007"
+	.ascii	"2\241\307/\320\301\205C\227\241\233\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.78.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\213\001\315\017"
+	.string	"\206\237kF"
+	.string	"\223\223\016\273\037$\035:\3723\377\376\2662n\020vA k\222\223\341\031\270\312\373\217\b\251x\241:\007\263F\031\001\020Z\226\314\b\377\001\372\377\353\377\377\370\242\202\261H1\375\352\331\376B\304C\b\331[\356\224\002V"
+	.string	"U"
+	.string	"R"
+	.string	"\026\321>\r\336"
+	.string	"\366\251\275"
+	.ascii	"\366\351\220\275\343\240\314>\244qq\365\330]NGX/\301[\306\320"
+	.ascii	"\247\324\030\3623\223\325\023\244h|&\321\247\034\260\273\001"
+	.ascii	"L\034$\203\370b\"Ei\342t\275\353\nR\274>\323\35113\331]\307\317"
+	.ascii	"\344\341\306n\373c\333\201\375\032\001o\335\362\321\252\321Q"
+	.ascii	"\243\037\"\340\204"
+	.string	"\343\001\217\335\016/ \2333c\224x\353\267\357\253x\330\362\032\353\207\034(v\367\240\357\362\266\342\254\320[\236\241\211`\2640\\\355\354\356\310\247\033h\237\bd\213\275}~\263\375h?u\232\320U\032N`\027\205\363b\027$\t[\372\347\263x\013O\236\304\247/\200\260\177\237>\b\373T\365C\f\031\342??|\310\f\f\030\037;%\0259j\246\252\277)\315\374\273m`\327\250/\235 \305\227\245^\357\372\f\221\n]\202\214\342KuwE\25216H\212\337\335\265\242l\355\252?\013\335A)+\235\212\367\211\200\322y6\237\224\240t\036\216\205\302\204nE\205\263\320I\250\300\235|@\\\311\001{\236\224\017\307\342y\037n\003G\377*\312_]s\001\"g\244\244\2511\316pTS\325\211#\227\372Br\251W\261t6\304\037\227\322\013.U\023\221q\203\245\243F\004\200x\233\337\3467 \b2\033\035"
+	.ascii	"3\241\361i\f\246\001}\332.\221\265\304\230\035\314\214a\314\240"
+	.ascii	"\035\266\314\024\354\210\246\021\230\226\202\021.\207\246e0\013"
+	.ascii	"\346]\332\240Z@W\313\201\270^\245iV\255\004\342\342\206\210\262"
+	.ascii	"\301N{{\016\370\223r\347\232O"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.79.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"\245\b"
+	.string	"\326\320>;0%'\035"
+	.string	"\336\277H\226\013\371\270/\232}\276i\235\221\254\246\237\220<\013\205\200\266\021V\204'\333\215,3\261\023\032K!\274\301\326\261\300\312\266\232T\374\266\201fd\223\275S\n+"
+	.string	"."
+	.string	"."
+	.string	"\367d\237\006m\233\263>\366+2\030*7\273K\245\307\301G\320\277\311\2650uz\f`\330]\3070\245q\313\3336\260\255`\233%\273\226*\373\253?b\035\221\231\005\230\335\214W\200u\315\227\020\216\355G\373$/\001\277r\313\332nL\213\313\356\"\370@\340\263\340\003\331'\026\017#.\224\274p\224v\305S\334\352\320\354n\202\177r\224\222\017\362i\013S|\370\351\233\262Om\243\006"
+	.string	"\007*\276l\326)\312\016\373\330n\325\373@\225\013q\333\326 \252\334\347P\342F\036o\037\210\216D\277\t\211.\024AG\035HD\267JA?\004\366H\\\245\237\347U\312a\355\261\225*\007\b"
+	.ascii	"2\241\235/0\343\002,\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_pidOsdAntiGravityActive.80.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\215\007"
+	.string	"B\21635Po\322\001 ;\351uN\327\314'\030\373\320\250+\300\222\251Z\253\334Iuk(\331\035m\364\343\031 \037\225\231\231^\031\306\375\233s0\001\352\250\333\336R\246\024\336d\030*\016\364@<T\021\016p\242Z\220\200\233\253\0033\004\2668\r\027\364X\326\0051q\357VON\013D:r\352\325\351+!y\214(.\022\222\252q\347 6\t\330]\215\377q\255\302\327\370\263\305'\237\375\371\237\313\337u`E\023\345f\307P*\206}\267z\262\235v\231\316L\377\t\244T\022\266\335\322\326\262)/\265a\373\266A6\306\007\b c\217\031\245\243PH#,\273\021*\352\330\023\363\337\361\307\241\221d\246\320\023@aw\235\231\351\342\326\033\330>\t\f"
+	.string	"2\241\271\037\330\314D"
+	.ascii	"\327\001C,%\007D\345\240\013\371\316`%\\\313\322\024\370\314"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_pidStabilisationState.81.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"E\t"
+	.string	"F\322C< \005)\035`\305\322\023\035\214.\004P\253$\253^&W\212U\313\017\340.\033z\353\377\330.\001'\251\214\252\302\fl\003\201"
+	.string	"\262`\214\221\321,\005o\002\031(#T\311&{\247\024/"
+	.string	"0"
+	.string	"3"
+	.string	"\006\334\351\366\002\356\324\242-\3631d\017\203\331H\241\355n\235 \027/E\377&\347\254X\250\313\200\210\335\265\\\261:\356y\333\t\266\037l\267\004\366\267\335]\317\226}\327/\245\364\351IF\243\201\230\355r\324"
+	.string	"\254\214\306F:\266/\355\223\274D\274\353d\316\256G\314\312\356\310`\005\201S\204\007\237v\351(\032\003/\273\333\340\237\374\205\341\213\234:\303$\277:\365M\334\351\202\312E\245&%k\376O\234\234\237\016,6\257\031,\246\2225{D\311\371\021]\370\t'\300N$\372\300p\364I\204<\022\201A\236\220G\252\241E\205'\242\250#\357sQA`\251z\016\374\221:\260\206\337\007\326\316\270\337v\266\274\005\220\335\314\244\246\312\001\b"
+	.ascii	"2\241\315/\020\302\205#0\352\022\026\261\032\r\356\362\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.82.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidGetSpikeLimitInverse.83.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\365\006"
+	.string	"2\21504`m\322\001(\033\004\215\330\261\267b\364\347`\0207\026qF\276S.\370f\345\275 \226z\271G\276\242\r\202"
+	.string	"g\200'\342N\b\272_\270\216do)S\n\276X\030,\314\313@<X\021\016o\302Z\220x\027\214\342Y\f|a\032\260\227\271.\354Qq\257\236\324\212\243\030\266+>bQ\300\356\"\370\241G\013\037t\347\013M>\273\3635\323]\252\200\b'Kv\334\244r\330o\253\036\373\351\324\001RJ\302\311\256FieQ\\\211\207mhS\376\307A\240-j\361\003\372\210\224A\242\262\273\257z\301t\327N0\335i\307\341\023\372\017y3\t\215\262\316\346\t\240\260\273\316\254\263q\353\017l\177\002\t"
+	.ascii	"2\001K8\343h\034\240k8n\210\02136qW\244\331\360\256{\003"
+	.text
+	.section	.gnu.lto_pidGetFfBoostFactor.84.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\355\006"
+	.string	"r\r14Po\322\001 ;\351\025"
+	.string	"Q.\224\005\017\004n\027\027\177\272\356\036G\263m\223M\335\"\020\317"
+	.string	"\371\250\314,v\005\361\365\346rkrf\217\214l\"eJ\001\345l\030\252\316\363@<T\021\016o\242Z\220x\234\213\342m\fju\032\256\347\261\254\353e\264;G\230\232Pb\264\255\260I\267\200\377\bu\2115\213\272d\327\213\017:\263\253?\224\035\246"
+	.string	"I\bcZ\r\204\351\321z\372\377\346\2505\026s\240\243Ea\3737b`\316\342R@\332bm\246\016\261\b\326n\223F*\331E#\343\344\345\377\323\270\200\262\233L@\331\345\2071#V{\304\323\n\212J&\002\031\001\022\376\0273\021\207\233>hK\n\b"
+	.ascii	"2\001\0378\343h\034 ]\346\305\fC\334\025i6\274\353\336"
+	.text
+	.section	.gnu.lto_pidGetFfSmoothFactor.85.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\365\006"
+	.string	"2\21504Po\322\001 ;\351\025`\330\177\\}p\002\345\222F2U\013\005\016\305\255\371z\\\026\201x\006\310Gef\261+\210\2577\227[\223s\030\321\222\275\245L)\336h\026*\316\353<8T\020\rO\242R\210x\233k\342i\nlq\030\256\327\261\254\353Qq\257\242\324\fH/lS\274\304%\200\335=\360I\036+|\322\235-<y\354\316\367Lw\251\001#\240\314\354\370I\345\260\337VE\366\323\251\002\037,\t\331\256F\366\262+.\305\3036\264)\037\344!\320.\2658\"\275%\003\303\304ew_\346\004\323]\373\300t\247\035\207O\350_\344M\005\345\004\013}\236\030\204\335ub\241\215[o`{\024\t"
+	.ascii	"2\001K8\343h\034\240k8n\210\02136qW\244\331\360\256{\003"
+	.text
+	.section	.gnu.lto_pidResetIterm.86.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`/\001u\r"
+	.string	"\266XXC\020\221\232\016\030\203\215\276\002\235W\342\205kp"
+	.string	"\376q\213\350\200\226K\377\307\240`yp|\367\317,6\036\345\207\203\362\331\r\250`\001"
+	.string	"@\005\006i$"
+	.string	"0\270\031^\304#Q\313\013N\215\354-wJ\001B"
+	.string	"D"
+	.string	"E"
+	.string	"\007SF\300\204v\227\322\023\326\313\357\2261\373\224\0323_\002qy\202\230\033\033\247}J\001\273\033\200\023!\035D\024\356\023\245\212\356\372\357\013@\232\215\353\036%\220\335u\3348\023wt\333\227m\217\375\223\252,\366\247\305\257\256\330\367\274\373\322"
+	.string	"\0326\"\344\330%Q\323cg\246L\212{\267\277\302\377\2749\213\267\310\356y\306\244\225\230`\200*:v\327\363\351\316\364\211\340\234\350S\236@\364\371\2153\033\307\277\226\rO\001iNT>1\0169~\214\203\226\006,~\303\242O\251\223a\207\266\243\002{\303a\034\032x`\033\304_p(\320\262\273\020\\\374\305\203\217\342\323\037J\342\267O\277$\372\374\367N\027\206B&\261Fuw\265X\325!DZ\344CB5B\221X\250P]\240@e\250B0P\"\027F}\034\26052\341\242H,\353\2426\337^W\\>\311\324\2301\321\317T\026\003"
+	.string	"i\244\n\212\236_Q\032\374\372\035/\240\020\221\307\345\356\2564\203_#\r\036"
+	.ascii	"2\003\376\031c\205\306\211\375]\002\313\022X\0212V\265.8\242"
+	.ascii	"\021#DA\302\350\252a,\341\026\230\246f\323\036L\233`\256\353"
+	.ascii	"\360\323\254L\033k:;\301\252\225\027!\202\314\270q\243l\260\323"
+	.ascii	"\336\236\003\376\244\334\271\346\023"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.87.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"u\n"
+	.string	"\026\224IA \251*\035(\303g"
+	.string	"Ad\337\n\006\320\262\0308P\373m\211\315\b\204\222U\240\340dMX\034\277q\235\200\310\251AZ\241dY"
+	.string	"\240\330\202(B\003`\245\335\003$\315|\033\254\204\221\275\367N)7"
+	.string	"6"
+	.string	"6"
+	.string	"\007R\"\006$\354n\225'\377>e\374\374\257^\001C\321\347Vr9%`\tb\fai^L)\360\253\307\221\220\024\243B\305\356:\202!\311Mo\333\302v\265_\t\276\352\2271\372ZC\314\301\305l\3274\233\260/\252 \305b\373\321\276\200\017\370\2562\002Wv\0274p\355\356\204#\266S\210_\264\323y\007\355\324\237\r\341,\324>2\230K\032\244]j\264\036\224\242\314\366\307[\240mw)|\002/"
+	.string	"\342\243\234:$\024\017\236\372!\355\364\222\002`\020@5\2123\233%\212\322\304\376\334\335\265<9\232\216\347q\335\306\333\234\301lp>\325\333tp:\034\325\203\223\341\251\231\016T1\017\346>\232\256z\034\327U\013k?W\236\214\021\3415\222\244\271\020\245\264=\\<\350)EG\005\016"
+	.ascii	"3\241\037h\214\254\241\336\260\227P\255\202@(B\364\034\002\f"
+	.ascii	"\230r\t\266YM\021w9f\22340\265\007"
+	.text
+	.section	.gnu.lto_pidAcroTrainerInit.88.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\215\007"
+	.string	"\242\21524Pu\032\003"
+	.string	"r\357\021\373\323\350{\225\306\236\237\036\022\351\233\305\"\374en\344F\277h\3274\343\247G\340\272at>A\025q\346\273\202\200\352\030rK\231R\355p ,\317\374PLX\025\022\363\302z\260\230\035\fcr\nzy\"\260\371\271.l\312\355\256\016I\016\"'\021\354Hp\013\313\212Dq\251\003\267E\360\326\230M\351\377B\233a\025\215\201\231\377\n)6m\324%\216\345"
+	.string	"=k\2165\b\300Qr\334\tJ\364\272v\013=8\322\272:$\265\025A\210LC\367\177t5?E\030\223\266\226\315Z\032o\245\373\305\344\341\222\372?!\2113\277\2546\212\005\264Q\310/\200\341\177\2376\002q\241\333\032\264\335\264\345\002\016"
+	.string	"3\241\321\037\270gn\001\303"
+	.ascii	"\356\300\301\272\312\314\020\304\315fx\256\341d!\214\227!\300"
+	.ascii	"\245[\264\363\t"
+	.text
+	.section	.gnu.lto_pidCompensateThrustLinearization.89.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\025\013"
+	.string	"V\225L?0O\224\016D\020\005\2404q\302\243\323\025\354E@\375\021\261\213_\355d\353Qi\344\271c\267\377\023\275\300\021s\230\345\377\344\035\236\221\230\021/\031`\314I\251\001\364\3609\f\"\273\267\224)\005:"
+	.string	":"
+	.string	":"
+	.string	"\257D\016\337)\221C\355\360\354O3\363\317\361\027\302\004\fm\373\374U\032\256\317"
+	.string	"\b\212\030\223M\364*$\017\3329\236\243-\224\251\221`w\235\332\206\341\206\267\255\300v\264_ \360\334\377\316\335\371\364+\312\006\213\005\251]Rj\306~\300\024\037lg\266$\317\2713\200]\025+<v\367\200\tT\207\266\375\32372\273{\250\222\351-N\\(!cw\243\200\372y)\004\304C;\3339\340\332\240\303\205(ClSx\207\273jw\021\370#N\242\202o:\264\005O^;\364=\221\303+\004\361B\004\007\312\224\215\372\244r\260\377V7\330\001\230\r\206YW\006\253|\2618\320p\"\226\201\240\331<\210\0224\f\"\304\313\325\211\226"
+	.string	"\2668\230+b\226uE\tj\257P\375\362i\352H'\031N\037 \r\275*\237\332\023:y\r\352\013\021"
+	.ascii	"X\b\b\303J\026s\210\020\351\260\302Pm\201\024\025\001B\313\004"
+	.ascii	"\343\232\3301\221\325\212\2471AD\205+\200\312C\263Q\032\230\332"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.90.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"-\f"
+	.string	"F\027SA\020\221\232\0168\204y'j\302d.=\224\341,\231m=\255Z\2142d\200x{\"\322To\210\210Z\035c\r\001\353{nV\f\n\200\313\004\024(\200\006\213\022[,\017\362\255|\262dK)S\n?"
+	.string	"?"
+	.string	">"
+	.string	"\321\237^\023\375\245\312\261?M\304\374\314\207\206\350Rh[\366'\245\\\325\200K\210\305"
+	.string	"\024'\037\246\315\203\t`;\321\216\335=\211#\312f\202\230\371\330]\243\266m\270\243\333f`;\201}\220\316\016\366;\367\353\271\033\217\276\244\241\001\003\244\333\325\020sc_\336\212\026\333\230=\3419w\346\330m\341B\305\356\"\360\001\351\317\266/\342#0\273\323\317\n\313e\304\310p\302\306\356R\035\017\020\232\004TZ@/<\030\302\335\315\262\263\215\005\236\016@0\036\f\331\356\034\344N\332]\005~\211\233\270\340\263\374\031\003\t^\373\363I\242\277\347\003Q\303\205+\301\030\373\223az\260\257\273\273\001W\207su\026X\325U\211L\016\361x\260\341P\327\004\t\033\n\021\250\n\233\006\"T\2105By\bp\305\201`QWUY\324\364\331\353Kkjb\242\244f\306KI\232<\t5m\013#x\355\245ff\030\016)+\032\025"
+	.ascii	"~\b\b\303K\023\326i\3702\202]l/#\264\005\204b\224D EE\200\320"
+	.ascii	"2\301p\031\240V\220\226\211$*0\004\250\034\261\032\247\25295"
+	.ascii	"\343lW)\003"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.91.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`+\b\035,"
+	.string	"\212M\330\020Fp\\N:\373\266\230\376\260\222\217`\2254\331\343W\216\016\233\022\251\343\212\222\333GE!\233\307\271rcC\367\211\2723\244s\2108k'\266\350\r\256*\347\305\324\001\312\350\365\215\377\303\222M\267&\215\220-w\222\001\375"
+	.string	"\335"
+	.string	"\375"
+	.ascii	"\3744\376\215\221q#I\027*\024-\f+\267\344\254t@\277$]\001\335"
+	.ascii	",..0\\\370f\374\343w\271\227\252\227\305\370=\336[\315\311\331"
+	.ascii	"\330\200\336\004\252\037:\371w\223\371X\370Y\256\205\177I\254"
+	.ascii	"\262\f\350M2V&e\001\335\032Zq`.\2407M\346*\376\225\217\361O\214"
+	.ascii	"\225\251\034\215\007\350\315#e\240V]F\307$6\346\334{\237n\262"
+	.ascii	"\023z\223_\345V\252\230\225V\354\210\022^\227\273\255\344\235"
+	.ascii	"{oT\322\213\316\233\366C\347\3156\362\252\377"
+	.string	"|=\224w\232\266k\025\2377\301Ny#s\364\262\372\317\3674]>\320\256\024\326\365\243\366\224P\336\204!8z\234\227\246\213\007\332V=O\224\365\2403\004\307\217\233Z\325\332\001_m:\236\246\353\207eBC$\316\317+\253\366\217Wj\223\356\275\037{\255\341\205U+o\302\275\227\353\321\013\307\331\347\314\354\205\231_0\363\334\002M\367\346\336\353`\355l%\370Jn\262\360D\375\361&\377\304yS\251o\366\"-=\220Wu\311\005\032\251\r4\004\267\264\016\253.\271W\241\n\364\357L\220^}:3qE\375\021\251\257\345Aq\324r\300e\265\025\263\030Vm0\346\333\333E\230\241\236\026(\370\230s\002\247#\317Mge\246\2632\202\237\235\227\316\312\007^vV\262\225\223le\003';\027x\362\214d+\013x\2303\360b\347#[\331\310V.\262\225\211l\345![Y\310V\016\262\225\201l\345"
+	.string	"\266\362\217\255\f\300V\366\261\225\177\266\262\317V\356\331\312\250\255\314\263\225O[\3314+[[\271\273r\355\312gp\244\206\346\302\362^\256\245\236\013g\2421\371\230?\314\177\366\227\375d\177\362G\376bG\231\317|1\001D\344\304|\272H\326v\341u\350|\372hg\252\363v>\265PC\365\207<i\330\255\277~j\233\226~\231\355\353_\003\345\244l\\~z\355k\336\2364\314@\367L:67\351\334U]\376\264P\237uX\025\355\237\346\232\322\241}\236\245lM}6\257\257<\205;kv\322&\274v#\t\304<\273\332a\270\2348gG\210\373whq5\261Jf\256Kf\027\311\3364<\216\225o\3146\353\230\341\251\367^\253n0\346p\332\026A\006'\253\3321\363\206\263\341\200^\315\327x"
+	.ascii	"\021\242\376\030\242M(fT\220\312\233\265q\022\344\262\204\345"
+	.ascii	"\322.\353\336\253\245\356\246\256gi\030Sw\177\354KG\267t\016"
+	.ascii	"\202>\320L\375-_\242\221V\033\301R\327\236q&u\270\030\274\267"
+	.ascii	"3A\236\332\333R\377\313\217\266\304!\337\007\372[wJ\375\256\300"
+	.ascii	"&\265c"
+	.string	"\236z[\214\326s\204\231\352f\202\001D\241q*\203\260\310H5E\301(d1\f\262\360\275\220\252SRU\204T5a,1\f\026\215\032P\004]\004-\f\2110\204E\242\t\242!Qh\234\032\nQP\r+\030\207\301b\261\005\225\020S5\030!T\021e4QB\210\202D\324P8\225\"\212\252\310\"\252\001\220\211*\202\305(#\221X\214\372\211]\275\213p\355\261\373\204H\371\262U\353U\352|\013|H\240\334\231P]\205H\371\352\035%\375\306\2164\270\253\306\022\320IG-\340g\324\013\212\232\250\215\032\230L\303\200]\324\300=)\033Q\277\316m\231\316\371\032\214\217v\223\212\032\352\324CC\005\311S\320\300\256\301\314\300FZ\242\206\314-\253\332\365\226\254l:r\347T\324f\ry\205&\350\241V\320\235\324\223g\250{I6x\220A\355\323\t\272\317\322/\254(Ze\346\200:\250\237\206\005h"
+	.string	"\r\324\003\322\3220\237"
+	.ascii	"M -m\302\312?\271\367\002\001\350\247\335lkS\362\032\314*\200"
+	.ascii	"\240\250\2010\003\225R\250hd\024$\005\005\205t\220\002\231)+"
+	.ascii	"n\021P)T\316PI\224\215\335P\007\214X\252\212"
+	.string	"6\b\361\372\3577\244\322\026\f\237\231\376\303A\355\034F]K\342\311\tp\n\200+dA\232\001YP\030\201\377`\013\333\277\037\242\326v~\260R\276\207\217\tL\200h\234\371ruB\343&\332(\026\327\363\210\2309\326\033\342](\021\035\244\217\004#r>c9h\355\"\202\217\326\356.8X8\247\221\205\357\201j\3056\016\037\020&Cg\026NN\236\340\242c\030\274\360\242\271z\265\251\313\0278\231\220\232\322\037\224L\313Xo\004\206\204\2332;\035\303l\330Ht\272X\256H\223\322\t\035\341\353)\271\223f\254\203\374\373\375q\365\034>\242q\343\263\240\203\336\334\003.s\204\321\340\315\252\301\017\357\271p\020\364RY\373\257\267\341f\372S,\277;\254\306\237\036\223\314\333\352\336-z\0325\260G\342g\245\007\310g\316.\321\244\350\031\277&\321<\3661\022TS\205\346W9\367\214\370\t\"z\352&v"
+	.ascii	"\207F\202\b\370\007\360C\177\230\324\"\340\333\0046\331/\201"
+	.ascii	"[\301rbpox\326\031\335\337\344G\005"
+	.text
+	.section	.gnu.lto_pidLevel.92.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`b\005=$"
+	.string	":D\330\016Dp\336M:\353l'\366b>\256\247\250@|\361\210\031\021WKL\322\342\351\211\243\032\304\336\215\237S34\335\333?\373\371\007\213;p\031\204\016lB[U\310\336\002o8\340\360\203F\315\2324B\266\224I\006\327"
+	.string	"\276"
+	.string	"\343"
+	.ascii	"J\276|'\332\313\354\362V\353g\333ms<\255]\336K\336%\356\307\334"
+	.ascii	"lyd6\355\230\207\220\224\030\030\347\326\216&\244\022\034q\265"
+	.ascii	"\326\006/\367\004\005\263i\364\250z\025\3352\264\027\032\003"
+	.ascii	"\216\252\261\013\226\n\314\273/\373\026\342\271\3308R\255F\340"
+	.ascii	"\324j-{\260\016\312\316=?\271m\273\253\225\310\025\265Z\353\203"
+	.ascii	"\215:_\356\356\376\312\261\020w\323h\331\030\231\316LP\327\027"
+	.ascii	"A\265\326\336\323\231\314\227\364J\346\313Nr\342ufI\233\211\373"
+	.ascii	"\233\235V\271\223\006\t\266u\335\217\233?^R\246\257%\310\"\260"
+	.ascii	"#e\020\267\026\350f7\230\022\201\365xS\006amz\024\201\025)\023"
+	.ascii	"\234\"z^\346\354\005fd\326a\250\265.#\301x|\317\357\256\214\335"
+	.ascii	"\355\261[\202\b\355\324w;>)\362\334\032q\201\336\245\362\361"
+	.ascii	"\221\264\317&f\354\255\345\356.\r\035\343\336\334\357:\264U?"
+	.ascii	"\363;k5R\330\263}xq\222\3310_\276um\206\006%\271xn\267\254\310"
+	.ascii	"}d\367\264\266\221\335\035\357\002\005\t\016\346\207\272\332"
+	.ascii	"\027\301\305|\237\356\345?@y\r\234\314\327\351\311\277\300\271"
+	.ascii	"\374\004\016\346+\200\3626Q^&\312\273Dy\225(o\322\216\027\211"
+	.ascii	"\362\036Q^\243\363\026\2357\300\311\013\340\274\274\223\227\210"
+	.ascii	"\362\356\316{\236WGyM\035oIy)\345\355\363\262"
+	.string	"\216\367Q\217\302\347K\016\2510\265~\315\025\252o\245\031&W\373\305\374d\336\273\337\375\331~myj^\001/\363\235\030\233&\207\322x\327\006\332k\243\314\005g\234.x\214,\267G[\2172\221zA/w\001\271\234\317\341\260'[\017 \370H\020\346K\244\346!\3612\b\310Q\033\350\247f\264c\223b\332\317\352@\021\253{anN\316X+\027\224Q\037\365\217O\212\332\250\t\270\035\343\0024\257\213Z\347vl\002\240\003\274\2118\232\235Z\215\026vG\374M\t7\030L<\314\030\r\363%\200>\332\0353D\315\333\016o\203\202\202\205\335\024g\243b\302X\255\225\202\232\257Y\261\313B\212\217\2242_\022\365\315\316z\242\210\205e1C\315v\352\244^>\376)\362\032 8C\272\217\254S\357\032\210\017;B\330\344\2701\262\334\236\275\323\365\331m\350\350G\327e[\327\241\262\315>\3341.M\331\021"
+	.ascii	"\315\rJ\322\356k\005A\313j8\205\325\003\006"
+	.string	"\261\260\202T\004\254\206U@\237ph\342\312\027\303\027\002\030\254\361\023\006\255\226\312\f\302\240P\350#\032\002\177\301\254\241\317D\213\037\211!\320'\024\302\240J\302\372\tO\370\256\252\200S;\337\325\317EPH\242\305/\213H\3537c\212.\025\204\026\277\254\336\320\252\352w\345\242\007\374Ma\365\250\204Z=\b\0036\230\345\023\366\206\301\240\260\307+\343:\255md\277\366\222\355h&\350\367YK\226\nZ\200\200\353\b\"\345\215\253\213:\250n\352\004a\b\232\251\233\272\300\227\247^j\246\326\031\242\362=pK-a\312\231\225$\324\025b\026>\022A\177\355_\022D\310[\261\267>&\027\247f>\265R+\350\246s|R$j9\236M;\367v~'\203\206\r\033\314\227JpQ\310\302\262$\271\322\334\370rR\366\221]\201\246\223:]\250A0\002\tR\312\021!\221\021\"I\n\351\240\"\021\2432\017\021"
+	.string	":#*-\354\006\336y\265\233\025V(\215\0309\243 \247P#\032\216l\001U\302\f\231\242\375|\222\360J\033\330*{\303\301w\032\262\t\013\351\323\027u\243\204Qw\206L"
+	.ascii	"\031\217@hj!\314u\214\036=\030\335\246ec96\300\310\332K?\210"
+	.ascii	"\226\034}W\200\242\245\377j3Tm\362\257u~\t\310\222\\\2057`)S"
+	.ascii	"\2273\004\211\337%?\363\364]Q,\272|\2615\215\025\007\361\317"
+	.ascii	"G4\273\360B\353\031\301\257\306\356\351\352\200\037\367\002\t"
+	.ascii	"\331\032\3011H\214\242RD\177y\200\372\361\035\332\006\312\216"
+	.ascii	"6?\214c\004P*\360\371C?~\3015\302\374\007"
+	.text
+	.section	.gnu.lto_handleCrashRecovery.93.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\256\f\275>"
+	.ascii	"jj\204\027CP\236N\007\303r\002U(\241G\220\317'v:\224\261\025"
+	.ascii	"{\307AR\033.\277\\\204t\034z?\245\337\237\022U\360.\035\200\f"
+	.ascii	"F#@\3539\253\304\324\370\3542F\352\371D.\322v\273\t\331{'\231"
+	.ascii	"Rh"
+	.string	"\001D\001h\0011\217\303<\261\037k\367\304\367\334\315\270\347\371w;\037\235@==3}\347q\217\330o\f\006\232qh\321\351\332\313\344\271(nI\001\360h\342&\030\3071\223\263\255U\274s\251\220\261\3631N\247k\242Y^\025g\267K\365\272\026N\327\217\367W\350lw\213n\327\331\326\355\016\243\347l\2774\335\331\b\326\213\2132\207u\035V.0\332\030\307da\352*\274\026-\227\026\273\004\216\t\3061\264\251\243r\234c\201=\313\214\242\237\030*\027V\027\307qM\375\240\350l\307\025=w\273\025\177\203\035\216\206K\213\32491\3018\326\322\324\b\212\316&\371P\353\354\352B\255\263\rw\307\361\270\263\230\330\304\210\215-\205q\034/_\211\303\256\024\n\002\372\361I\"_\367h,\022[v\375\f\267\023\243\214^_[\256$F\t\245y\320\222\f\224\206\226\177\230\234e\237\244XF\246\031\311\357z"
+	.ascii	"M\0228Fb{?\\MZ$\273D\224\324\244c\371h\034\242&\r\313Eb\224\022"
+	.ascii	"Y\217!N<~\t\361vM \266\367#\371\025]\207\320$\201\343cldvE*\033"
+	.ascii	"3\3644R\2605I"
+	.string	"\317\317\206\373U#\257\356\0274\177\032i\332\232\024\307\261\317y\316\361\325\22531*\216\343\316^_=\274\207\274\333et\267[\267\333\f\355M\327:\333\276\347\030\262>\373\036\035\344\352\340p\232\372f}\242Y^[ca\213\333\301\376\264\263k\265\n\376h\n\233\034 4\343\361\365\247\016\376?\247\221\333\373\340U\020m\376}\316\227\372\236\336\301\027\325\261\261'\177\202\177z\277\363u\312\237\240\230;\\\240tu\b\377\023\261&\177\023\240\3478\216\267\376\247\355\315\326\337\204\234\033h\306\323\335$\034M\263\030\307\361\203\3663\356W\242=\315\331\236\242\312\356E\325:\353\3174\245L\354\r\216+\037v\307u\345\237v\373\032\177Y\267\233{\3021\267\224\233[\202\357yGpsCp3\336P\307\334Onn\007\036\306\275\201{qg\340_\334\027x\236\367\322\263\270;\271\026w\005on&\347\342\236\300\315}"
+	.ascii	"\231\333\200\233{\t\231\273\200\233[\311\315\235\204\314\215"
+	.ascii	"\344\346&\200\314=\300\230\373\350\315-\340\315m\364\346\016"
+	.ascii	"\360\346.zs\023\275\271\001\274\271\207\336\334J7\267\3201w\320"
+	.ascii	"\233\033\350\315\375\363\346\366ys'\337\334H7\367\353\346v\221"
+	.ascii	"\271\217nn#2w\321\230\233\370\346n\337\334\354\233{us\3771w6"
+	.ascii	"\346v\n\316WW8GE\2278\324\246\260\334\003&b\240*\315_\260\221"
+	.ascii	"1\030\t\222\326\331\241w\315\330\030\211\355\375x\177\232\225"
+	.ascii	"\377Bn\317)w\303SXIv/\345+\365\302\374\272~+\356\247=\341\205"
+	.ascii	"\376\t\243e\0359\207\320\031\2254\251\237\020\364\t^\352\275"
+	.ascii	".\343\020\221o\004\375\343\375\031.u\303Lr\215\246\022e(\334"
+	.ascii	"D\311\225\273\340'Q\340\265\354^\360Z\353l\220\277*\205\\\371"
+	.ascii	"\360\b\004\366\177\f\336\347\201\336\311\274\221\023\205\342"
+	.ascii	"\363bMUV\327@\257\301\345'\337\347\333\273)\276GO\362}\330\364"
+	.ascii	"\265\301Q=\f\233\265#qK8<\304\003\215c\256%\344/\377\003\243"
+	.ascii	"j\357#\337HOT\320}\343\277\317\336E\217\357\342\201\331\240\236"
+	.ascii	"\272\34167\204\335\036\234\335\361B\370\255\341+R\331\275\244"
+	.ascii	"Zg\217\017\205fW|\343;l\346u(8\265\032\307\320\247\356\nNh\241"
+	.ascii	"\030\307\320\007t`\262\013>w6\343\275\214\257kv\370\f\355\214"
+	.ascii	"?M\343\304w297F9;\206\266;\303\206\354^\304\237\346I\r\005\241"
+	.ascii	"\277\025\301\313\225\301\342O[\004^\373\363>\306\215G\364\242"
+	.ascii	"\250=a\331g\372\034\335L\237\254\372\234#\210\346u\265\3712H"
+	.ascii	"\\\277\375\237\357\034%\354b\022\342\346\254m\237}\260 \3254"
+	.string	"0j\372<\016\f\326TO\013]\345\204U\2255\3254\352*'f\323*ky\345l6\235T\001b\224\310R\307\247\363\371d\032\263\256\254\234,\262\230\035NXi\bbfMqp>\265R\024\261>0\233V\036\262\256\230\317\247\013*$\226U\214\251\265i\365\364\300\\\221\342j\312\250\365d\276pR1\237%\252\260\246\236T\311\246r:a\305b\231U\225\302j\005\212\345\225\325TsI\365\304Z:\025\265\223\005\363\271\314r:\237K7\216\313\327\370\313X\276:CA\256\357R\2625\007P\251b;\"f\205P\350\247\335$\262\224&Ru\r\311%N\025\302\242\224\267*A?m\t\257\244&\327\027\341%|S\340\201_\372\b\177\244\307\300\037\210B!\343\235A\241V\r|\306C+\360KN`6\317\323\004vs;i\005\336\371|\275\022$\360\247\212g\016\020\204W\362\221\227\300@\320\224\202\366"
+	.string	"\302A=\204W\240'Z\230\364\004\036\352\217\370\220>I\t\205\234\3152\322g*\240\335\200'P\006\263\271\235jN\002\2739a5\223\rx\327\363\365\r/\260MIL\0354?G>\307\217^\251\027\305\017*\227\344\215\234\217"
+	.string	"\243\027\220\213\34411#\331\373\256u\326\310\260\355\222W#\031\340\211\372\212>@S\036\022\006V\364\256Y\2336$\017'^\310\2376\321\003xW\023\222\203d D\357Z"
+	.string	"\341\206\036\300g=Q\005\331G\007\200\373\250q$D\221S\310FD\202H\222\024$\215\001\240\002\021!\243\252\003\021 -S\316\315\310\224\2449]u\370\232\005b\365B\260@\332\264\257\323\353Ir\205\214m2\004\235\205\357]\223\354\301\213\337-\034\303\365?\306\254\227\362'gW;\207u\325\r\235e\\Y9`r\002\220\262\207\346\250\247"
+	.string	"z\024\323\220\2631\251a\202\215\350WG^E\206f\360z\207\233\273\241$j\263x4T|\247\215R\363\036\267<\260WA\232\\AQZ\031^\221\037\341"
+	.string	"\334\017\3501n\353\313o\340j\257\344\355\200\036\024\222\225W6\364\221\227,~\345"
+	.string	"*\240\021\356\372\206\256:\002\220\332\214\276\324\254\243`"
+	.string	"\242\307\213\322\274\026\232\233\324T\340\341\"j\263\275\347\322\263\334\351\027\2547\001\214\243\2700\272B\247v^\310\312Ui\321o\210\261\206Z\335p,\360 \333H\033\021\333F\r\301kKE\032 \036-\201\367\0258\202\277\261WHy`d\266\206\273vw\221\257^\032\354F\206^+\343B\002,,\225,\013aS\306(\b\235g:X\330\221\320\b\305\350\327\301\322\212\222\f\0332\302r\361H\017@\\\372p\341\201\\e\374\375\242\341]\315\341\276\227B\023{\227X\331\206r\204\372I=F\360AB\311\237<\346\360\313\233\212R9f6\251A\215\017\343\007i/F\020N8T\274hmG\002\024/-\215Z\207\332\201\020\340.\215\\\203\377\301\354{,\377YP\211\362\214u!\215\346\b\204~\206\270\216_\001"
+	.string	"\302\242"
+	.ascii	"\217\030v\223d\211\002\023\235\034`\301\340\254\b\264\240d\007"
+	.ascii	"*\253-\347/\330\"\005\234\037)\321\007\343~e8\352\253`0w\224"
+	.ascii	"\212\2253\257\327\353\016\354\021\305\230?\212cE"
+	.ascii	"\031\265\216\"\372\363D D\001pg\275\353\3613T"
+	.text
+	.section	.gnu.lto_detectAndSetCrashRecovery.94.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`[\b\025,"
+	.string	"\312M@\021B`\252\325\030n\300\026\306i\023\313\274\177{@4\301"
+	.string	"\206S\3144\031hq\031\3156\021\244\275\204<?\340l4\232g\314H8.]-\327\bd\366\220\335T\346X\331\207_\262\222H)\245\224)\245\024\001\001\346"
+	.ascii	"\004\001(\357\305:&E\240dn\314\261\363\341\307\344h%\253\346"
+	.ascii	"\207!\013>\246\203\333\367\325r\266y_\344\003\236\300v\312\355"
+	.ascii	"\314\r\326a\305\026\333\321J\266l\215\263\355}\311<`\005l\247"
+	.ascii	"I\rT;E\333\247v\312Ef@=6\345]\273\002]\225q\276\357\033|)]l\340"
+	.ascii	"\317g\324\343\025\355t9\027\327\262\253\232\242\357E\3565C\233"
+	.ascii	"\\R5\360g\305}]m\324SSr})\2518\257k\212\0275Y+})\231\370NI\267"
+	.ascii	"f\320\n\302\354\034\n\241\312\231\325j\312%h\356\355*O\177)\263"
+	.ascii	"\334U\3428\346\2272\211\267L$\3162\217\370\212\016`\236\ri5%"
+	.ascii	"\023Mp\347\t\233\273\274r\265\325\224U\334\245\225\247_\312\256"
+	.ascii	"\335\262\312\321VSv\241I\357\373\272K\244?\332\240\315M\241\335"
+	.ascii	"\362\210\002\201\\I6Y;\326\022\351\276fx\337\227=\271\f\322|"
+	.ascii	"\324\314M\204\231\211\314\253\207M\205y6$\035\252\376\271+=g"
+	.ascii	"^\321\344\235\364W\23149>\325\233\205}\231\202*P\227\276\311"
+	.ascii	"\272\335\323\344\275\255@\355_z\366\253#G\1772\367\232f\343\304"
+	.ascii	"m\205\205.\274\223.\324N\373\231\326\216\030\375\351.\247\n\b"
+	.ascii	"\226\347\035\352\200\357\246\030'\202\360\370A\372\033\363\330"
+	.ascii	"\321\177\213\271\377\371|>\371\2410\253\316K\256\263\003\234"
+	.ascii	"\363\202\036\323\215\240\307\272\225\332LwR\223\3516\320b\335"
+	.ascii	"\003V\347\243\326\031\330:\377Zg_\353l\324:\367\\g\036\353\\"
+	.ascii	"\204s\336\255\316\272\3269\327:\273\2553\256un[g\266u^[guuN["
+	.ascii	"g\224u\376\325\331U\347~pa\0133"
+	.string	"\253\353\355\371\214\275@\236\210\336\264\364\215\027377\232NS\243\317p\f06&X\247\3145\230\335N\333ef\324\314\215;\004\317\\\344jA\305*n0\300\322\230aY\335C5\320\320@\037@:22\347\240\306R\223D\307\300\323.ze)j)\220$\201\363X\027\275\250\314E0\3050\336I>BCr\240\013U\356\227\300\274\232kH\177k/*%n\356\335\263bX\363\331\223{\f\270w\337\365X9]\351\2315l\360N\342\036\211I$\r\371T\216f\344\202k\237\345\320x\324\332\217\220\364\354\243p\226\261P\314\004\265\277\305\353\253\337Q\232h\035:\215\313\354\254\317\264&f\340\325G\341$\263r\362\320p\361a\177\353M\247\357nM\376\320u\206\354\373\276\023\270\351\364\031\bn+\235r\b\021\"\324N\323\277\300%f\364g+\005\201\303f\375-.kv\344\373\032\017\240\337ZM;"
+	.string	"\234\231\204\t\357$\372?:\317\264\343S1\205\"N*\025I-b\335\272\221\324\377\"\263\216s\"\205\n\025j\247\377k\224'\030\016\374\202I\b\3654\025\234\021\005\005\025\345$@8\3254\202\030E$\n\333\246)\031B\026\251\224\t!\324S\211\251\031B\"\261\206\223N\352\tG\023\232\203(\264\021\345$$\256x!\325Dt\332\261\023\023\213'\032\301\251\027.\236d\264\b\316xj\202\n:\021\245\202L\0018\212\206\220\030\234\212\212\"\006\3351c\243\357C\341\224P\033Cm\306?\242\357\373\276@\037C"
+	.string	"X.\231Y\205\243[\217\337\321\367\025\3571dy\034=\206\260&\31401v\273\312#\304\367[\314\037\334j\210\324\307\253\256\3308\007\031\375\351\326\371\361\307\b\370?4?\272\021\350\373\237\357\221\230`P7M\242\364\214\276\367?\265\346\331\223\313\022\031\275\263\365\236\201\036+\347\256\n\355\345\375\026;x\336\277V\023\r\351o[\215\250(\345\020\357"
+	.string	" 06f\230\330\202w\360\001\b]%\332=\202_\360\235\246Q.z\332\274\0301\203\305P\261\212s\367\022\326\b`\201\275E\272o\255BC\226\320\257^\326\030\n\200\236\250A4D\225DT#\022\2244I\241\320\001\320\002\021\241\262m\021@\245D\016\316(\230a\r\2303\324\210-=\273\225a\016;>,\t\212y5\031\255z\023`\007\246b\360\274B\205\220\322}2\004\\@\034\004\r\226\0137\277\345Y\305jP\265\310\206\003\t\f\351\207\220\254\027\246\374{\270\347\267\376\200J`i\202\036\340\217\331\203\221!\245\221\026\214\300\317\316U\216\306\026\371R\363%\030\304-\215\351z\343\206\253\207-0*\337\330oC\342\0344\006\263\221"
+	.string	"\204@_g\272\\\353\034\006s"
+	.ascii	"\260\202?\270 b\021\312\234\343jd\n\305X \023\026\320\370dls"
+	.ascii	"P\253\246\025t\b5\277A\255\256\373y\277\207uq\304\003)\2233\027"
+	.ascii	"[\242\222\251}\300\206\233[\356?\202\305(?\237_\t\355g\211\246"
+	.ascii	"<\252\310L\035\033Y\376\002i\003\260!t\334\265\366\254\271\026"
+	.ascii	"@\377\001\376\371\031$\241\020W\366!=Y\205\336\243O\262lK\247"
+	.ascii	"<\260\025o\016\207\254k\322\275BUpf\257\352\231\301\341u~pC\330"
+	.ascii	"\204\334\205\320\211\254?"
+	.text
+	.section	.gnu.lto_acroTrainerSign.95.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\005\t"
+	.string	"\306\320=80\221\322\001"
+	.string	"g\251Bt,K\332\306OE?\307\017\243\230\345\365\205\005\365\371\333\367\215\004\302\364\3369\201J\2670h\201\322R\324P\3302\251\312\025\2447,\331R\246\024-"
+	.string	"-"
+	.string	","
+	.string	"\351\371\207\035\316nfP_\351Pu\205\007\"3\325\300g\202\n4\022\232\303\236\251\357\224\t\360\260\273N\324\027ro\267\035a\233\301\266K\236\374\3132\013\354\276\270Tv\327\301\013\001\337l\373\256\243xv\013\214\231|o\235|\244\330\354n\374\274\240\363\r\236\240\363MK\356\035j\371\225\032\332\210\312lgB*\004\314)kv\254\224\312\262\017WW\366_\177f\372\020\241F\353\210\331\005\311\301Y\231\215\245e\333\263\003\0347\210\233\350D\221ta\321aTD\215N\"#\202F\033\2213pHD1\212\244Ph\024=\261=\\]9\225{f\303\257)\375x\250\tBe\005\016"
+	.ascii	"A\204\306\265Pl\b\005\252\"CE9\rP\016a\271\206\243f\3618&\210"
+	.ascii	"\250p\005Py\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_applyAcroTrainer.96.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`n\0205N"
+	.ascii	"*\203\314\034O0\022\332\351[| \250\013\2521\006\341\217\210\240"
+	.ascii	"\206\204"
+	.string	"\240q\371&3\027q\b\016h\032\236E0\031\364\313\364z\355\3760\334\267\213\304\023\020\276\217\343N\327M7\335=\316k\236\n\327\361\032\320\222^\2344\030)x\301+j\"dwK)\245\300\001\207\001\301\001|u\334O\330\350\204\333\342\336\r$\026\f\357\204X\256\320\320L0\350:.\300M\f\003fc\f\255\204\331\310\033t\035\253gqc\321\265{\257\261\221p\313\3203t\313\001\b\300v\222*\237\253\267\313\205b\013\340\032\340\275o\023\f[\245\203\372\361)0lu.\003\037\347\333-\213 \260n\r\260\305\006\314\306VUf\226\373\b\033\231\331\b\267\303\253.\233\247\037\224\277{oQ\253\314\364q\334\006\217w+\213\310\tw\346~\353\027\330\206\241\203\233\343u\302\341\250\273\367\355\210\215\336\206\334\336ml\307\304{\203\310Pw\357=b\242a\253\314\314\255\326k,s\033|\033+\023\2665@\345"
+	.ascii	"\357\275H>\215\\[\r6\315\332\352\017i\266\205\202\200~|zxvtr"
+	.ascii	"\22487I\033d\r\315\214\3141\006\346\305\305X$\016\205\253\032"
+	.ascii	"|g\271\205+\202i`Q\262\246\314y]\265\220Z\007\251\311\340@s\375"
+	.ascii	"3\027\203\373 \351\036$n\316\323\326;ml\256\323Xt\235\243\266"
+	.ascii	"\346J\027\032\307\205\"~\223L3s\233\264''8\222H\327\004\225e"
+	.ascii	"\301\241<\"NS\264\021\005\372\227%\310\227\t=SB\320\007\317\004"
+	.ascii	"\227\021\256P\322?A\276\322\372H6\3461>\032\006\255+\352/h]="
+	.ascii	"\334\305\007\0177\206u1\210\274A\b\225\022Q(\"4Z"
+	.string	"\327\016'J\351\n\323\341\303\237 _`-\204\336\365\017Z\027\230\2579Z\r*\243PD\200\361\262\021\034\272A\b\225f\362\364\240\323\277\355\037)]tA\237{o\037i\337\362\312r\027\256\270\367\262ky}5\0175\263\2531\363\0273\f2^\345\211F\374\342+\345\236\177\303_\237\370B\271'\nY>e\341\017\253$\320tc\367:\225\230\027h*\f\f\357u\236\340\201u:\320r]\326\301\332\252\360\233\216l\211\372\35374\020\313\247\354\263\373\0360\241\304\fA\363\305X\362\335{O\350\320S$\340.{zZ[U\277\333\366>\267\261(\333\022,\237\256/5\301\2266\246\276\030\267\314\354AI\337Lz\306\212\337\225\225=\033\356\2757\370R)\215\242A(\341xQt?\321\252\364}\244\207R\340\372\234\256\205\277\211\326~\245g\207\202eu\224\326\203\342.c\246\fo-\031k\253\3751\332"
+	.ascii	"\243l`X>e~\313\362\2272\367O\247\323)\277\030\363\213vv\321\324"
+	.ascii	"N\232[\2643\213vf\352\271\346\245\206\241{\200n\353V\361\316"
+	.ascii	")\206\316(\206\316J\035\327\235\324t\315H\313N\322|d\324F\232"
+	.ascii	"\213\210\316%\214\316$\336y\004\321\231\310\350,\202\350<Dt\026"
+	.ascii	"2:\007\2753P\321\371\247\235}\212\316=\357\314\363\316;\357\254"
+	.ascii	"\363\3169\357\254|g\234w\276y\347\344;\333\2743\362\235k\336"
+	.ascii	"\231\346\235g\336Y\346\235\217\355\034\323\3160\357\374\362\316"
+	.ascii	".\355l|\347b;\023\333yHt\026\266\363JtV\337\371\337\331\207\316"
+	.ascii	"}@\313\r\021\345a\206\367S\336.\327t\210\253\247.1k'\335s\335"
+	.ascii	"t\335I\272\215\344\325\300\235\0066\003^\r<\024{}65\313\356<"
+	.ascii	"\032\243f\372-\345\277|\007\201\203\322\364J&`I\262\246\030\001"
+	.ascii	"D\276\264\346\3058\306\235"
+	.string	"\f\267}\275\361\232\370\003\357/\220k&\371)\232\276\363\226\036\347\233\376sxF[<\362q^\271w\243\311\023-\305\337|\013v\005\037!\307MP\355,\016\207([\033\315Kg\262L\247z3\215\327\336#\307\237\017\270\254\033az\177N\233O~0\357\211\206|\233W\257<\001\375\213\333\216\343c[p/\266\210\n\347\362.V\215ec\335\274\265X\267\265U\344\367\223~\361\005F\227\205e\304\376\375\327 \262|\252\345\336[S\363\377\354O h~\346k\336\363\236hYL\200oq;\324\242\371\256\"\3633\217s\345\211\302\361_^\346\333\305\037\177\375\002\223\313\232b\344\357\370\342\3206:\264c\270\266@[\230\356\252Uh\026\005\332\272pW\255G1O\266[\332pJ:c\336\370B\234X\224mI\314K\035\213\355L\370\225\323\216_,\201E\212\177J\202\200q\361,~\204\233\337\013\314\273\270"
+	.string	"\327\027\310vMe\213S\337\215\r\001\363M\245\317\345\345]\276\t\307-Z\013\267\303,\217D\326\266\364.\257b\332\344\th|)\026\266[\216\005\341\224\344\273\362\322\002\2264 \212/e\026\237\244A\b V\366\232\337\356\275\304\227\262\013\227\335wm@\273\006mW\243v\361[Em\374&\334\016N\327b\205\355\226.\372\007'\235\261\277\366\001\206\001\b \260\266j\314sSa(|1vu\331A\243f\361[8\364\322\367]\333t:\244\360\343^f\232N\2658\357\305\n*\376\322\007<cY5\303\352I\ni\212JJ\212\nJI\343I\203&\323j\n\306\005P\314\031P/RM\246\025\f+f\025\263Y\244\200i\005\305\264\200\252Y\003\206"
+	.string	"\253)f\263\231\001\224\213\025\263\371VSQT\nX1\253\206RQ\315\006\2304dL=\021\253\2428x\n2\324\222\202\250\032HV3dD\321\250"
+	.string	"i*\352I\n\t\252Y\205\264\274a\252\032\314&\222\025\025U\023\311\370\206\325\301\373b\334Gz\306\223\236\2039E\277~\322\033\375\226\214\236\224-zX\237\305A\241\022K_S#\361%F\220@\372\021A<"
+	.ascii	"\021\375\n\336\002\013\336l'\342\211\212D\374\252\343\207\363"
+	.ascii	"\257~\246\370\f\0359\332Y\314\017\3658Y\377\274\352%\267\307"
+	.ascii	"#\364\314l\344f\017\f\340D\374\004v\004\035lX\230\326\017A/\364"
+	.ascii	"73@\003\001p\240gf}\260@\326\326\nz\037\347_1\267\375c\270\364"
+	.ascii	"@\177\223\303\023\r&\207\300\275\035\021\315\222\255?\337$\300"
+	.ascii	"\365\371\020\037c\311X!\254T\272\266\372\363\034\2005\311R\004"
+	.ascii	"\303\021':/\315Q\361>\337\204\353\353y\237!.e\311\304z\336\003"
+	.ascii	"\260&E\224/efMp \334\356\214\375`\211\330(E\335\007kv\306\246"
+	.ascii	"\220B\333DJ\344\312\242k\2008\311\246wd\323\377\235\355\200\266"
+	.ascii	"6MN~|\320\366\210\324\321g\b=$\375\203f\344\321\263\315\321s"
+	.ascii	"\360x\364\313\337\352'MT\341\254\007\264M\276xG&\275\360\203"
+	.ascii	"\002mm\222\276\225\240\020\310u\364/\372-\206\366\222\007\216"
+	.ascii	"\022^\270\341\371\235\177\361^%l\007\317\267_\323\353\374\316"
+	.ascii	"+\345r\376\345u\230>\347y\340n\370=\377\222LA<p\f\271\262\022"
+	.ascii	"\201U\250\201<B\025B\210FDD\222\024\244\220\016\201\205\3048"
+	.ascii	"\351\340y\021@%T\214QI\223\354\254\001\266+\276\200]\t\247R\365"
+	.ascii	"\030\325\351\035q\253)\020u{\f\214W\"*h\245~LF:\205\022\375\242"
+	.ascii	"?i\211\270]\347'#\221\306_ \004\325W\224H\266md\244\241d\341"
+	.ascii	"\274\t\270\340\030\215\230t7\002y\227,\264\001\261\037\375\275"
+	.ascii	"\221h;\177t\352\234q(\013\3510\025\323\260B\351A\364\027\037"
+	.ascii	"z7\364\032\332\313\352\240j\341"
+	.ascii	"V,m\332^8\310\324q\265\203]\035\267W\367\263{\027@\226\201\340"
+	.ascii	"\033_;[\361\002\215w\370t\237\206T\304\351\233\234\341G*\336"
+	.ascii	"go\201[5)vj\330;\232\314\225\313H\216\035\036\335\316\307BB\303"
+	.ascii	"\347\264\033/\236\021\207]\274O@\330`/\224\310(\316\006n7\033"
+	.ascii	"\224\355J^Q3\333[\213\303S\332x\260\375\306\3619\246\341\312"
+	.ascii	"\227\370\022> \220\260#B\337\311<\255lx\254\204i0\273s\212'\b"
+	.ascii	"\332\227/\016F#\037)\211L\215C';\3379Z\322nv\b\306\304t;\232"
+	.ascii	"\363A\212\271\330i\241n\2456\373\272#0p\304M\226\200o\373\243"
+	.ascii	"\301\314\275\241\272\216\033E\034G\346c\002\2103\262DQ\003zB"
+	.ascii	"\243\273\r\316\001$>\2115U:\325\216\215\325\243P)p\312>:\336"
+	.ascii	"\020\"\"\215h\005\342V\347'\254\332\363\357\253\324\322`\241"
+	.ascii	"~\221\301\020\022p\003c\344\303\023b`\257\344\374$\325\230\274"
+	.ascii	"\3332\n\367\"\350\2230\357\263Y\256iI\327S.\324*\324\367@\304"
+	.ascii	"\230\217^XHl}Q\317\0233\353)\326\231\031\177z\350\217\335}\207"
+	.ascii	"\240\346\035n\330u(\331\241\031w;\254S\016\245\310\254\233p\013"
+	.ascii	"\020+\023\326\220\2521`\200N\225\032\342\f\016\r\345\352\r\300"
+	.ascii	"L\315\3376L\224\235\245\261\337@O1\226/[\201u\035\tmt\200E\272"
+	.ascii	" \025\022YE\347\260sR,\025p\326\035.-kH\346-\362\313\004\264"
+	.ascii	".ZS+h\327b\225\240\3332\336\300\263k\370\036;\372\004\247\232"
+	.ascii	"\307\231\206\3649\231\243!\343\2018\013Y\254Q\342[\"XI\340\230"
+	.ascii	"\207\217\215*\301\013\250\241\304b\212\tn\237F\026\344\201S\242"
+	.ascii	"\271\277{1\033\363q\344\270\277\260\263\353B{\024\242r\353*$"
+	.ascii	"Ht\252+\311\233\207\033\344Ud\202\304\262(\272\214X\232{\226"
+	.ascii	"\342\327\035\025"
+	.text
+	.section	.gnu.lto_rotateItermAndAxisError.98.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\271\007\325)"
+	.string	"JG\274\017E`\336Q:s0\007\233\327f\016\023\344\351=\016w\361\004Q\276Z`\352\034\373\245\272\005\021\201\227m2\276Z\312\271\345\024\237\262\b\371\310q&\001\303;.@d\030\372\264\f\022\3472\364_\374o\204\020\271\223\f\357"
+	.string	"\326"
+	.string	"\352"
+	.string	"\314`w\225\333\216\264^\365\335h\275\332=+\346;\003\260\256q\202\230\233\035g\200\356\275\302^\022\374q?u\236u\251\325\215"
+	.string	"\024\005\211\200?\337Qo\210\267\323\255j\332\326\212\257kJ\277\270\334 \223\306\033y)\233\034"
+	.string	"\330\213\322 \2234\302\232\021\033T\242l\236h\355;>cYy\274\224\315\003\323`W\032\001\f\021\373\3235)Q\026\271\357\307\"?J\225\300\302l/\201\227r\310\207\206\244Hn_u\316K\227\254\0042\3637-\256\224"
+	.ascii	"\032\026\330\315\236 \212\226\020\273K\203oZ\3134\302S\207\325"
+	.ascii	"\211\005\371\252kz~\303\027\220'2\031\344j\332\240k\315\326\337"
+	.ascii	"\264\232\244HiJ\240k\315\0260\231#]r\373\252\323Kb\331\006&\257"
+	.ascii	"R\245{\357\261\334\372HbY\253k\272\367\262E&\225g\2443\177\n"
+	.ascii	"3g`^\245\004q\266\272\231L\265\276Y\224\315\311a\0031\363\214"
+	.ascii	"\263Q\355\356\275\024\370b>\206\310\017\273\3126\244\354\221"
+	.ascii	"W\371R\353\3257\211%\0379\262\243\235cv\032m3\231\377\255\253"
+	.ascii	"5&\334I\230\225\222\n\274\354\034\340a\316\300\253\235\177G;"
+	.ascii	"\373R\313\275\324\362P[\346\251\226w\251e]jyM-\253\251\345T\265"
+	.ascii	"\334\251e\333\226\237\300\007W'\371\254\347\275@\346\006\335"
+	.ascii	"6\225\355\311\303\374j\377\227\037\355\337\362\227}e\376Zz\275"
+	.ascii	"h\030\313\202\242\306\007Se\f\231\306\275/\274\260\261\036\030"
+	.ascii	"\316\370O\356\241q\231\367h\212\001j\332=\013\337y3\356qy\027"
+	.ascii	"\253\227\341\260nR\304\356\304\335{'\354\256*\245|-'\263\372"
+	.ascii	"\226\252_\345\335\r\022\303\023w\257\026\323\325?{\234\323\202"
+	.ascii	"\346\275\307;\307S%\302\311\036\351\264\2260a\217\344G\337\b"
+	.ascii	"j\303j\343\332s\020\334P3\325|\327\326\t\235]O`\262\247O\030"
+	.ascii	"O\327\305h\034]\332fYh\327L\356\245Y\225Z\005S\231\356k\037\017"
+	.ascii	"\356k\253\344\251\316\301}\255\324\002\276\200<ut\255\355d\250"
+	.ascii	"\201h\333A\352\t\320j\257\275\236\2758\034\206Bh\336{+0\237\370"
+	.ascii	"\233\252\245\250\333\337R\254xzZ\257\252\375\347\325*\313Arl"
+	.ascii	"G;\327}\3575\256\315|\026\241\037G\356e\013ss~r\334{T\220v\200"
+	.ascii	"\266vtD\271\342\026o\303&\355\233]\275\262\374c\345\336{\325"
+	.ascii	"f\262\204C\255\335\026\254L\316\321<\r\024?\214\243\206\303\026"
+	.ascii	"\312Y\036\355\334\017\204!\001K\241"
+	.string	"\314l\025\330~Q\326&\306\3150\264\214m\024\313>\234f\f7><\224\214(\032\027\210#\210E\252\250\236\224\213\247\0204\210\303\251\247)b\321\307- \270\030\326\020N\301\210\032\312x!\2441|\232!lQ\224\022B\030\300\304\032PE\341\024\221X\024\366\234\367\235\004\313\317\003\216J\333\261\257\214\314\016\240*\275\327\313\302\277<\256\213\235+\"*\320\352\034 \323\201\300 \260\013\374\35153\007{dhR\224\2055v0\320\264\267\231\305\256\327_\273\252\344z\312\261\021\251\335\351\304@\355iN\013\232i/\212\302\rq6\223yi|I\255\3169b\372\357\327/d\177\277Nj\243\257\345\231\241Nc(R\323\366A\3529r\270\034C\227\232\314.\016\250\003\202\n~\376\307\303\007\020 \326\253C}0W\267\270\316\344\310\356k&\377\354\274\367\036u\0222\347u\221\017\325\036^\253\3402\263B\366\236"
+	.string	"\373\263;\235\204Qd\200\244\250a0\245\230C\312\220\214\004#MRH\007\240\002\0211*\333\021@\251U\212j\244Ia:R\f"
+	.string	"\017C\033\232M{\341)\025!j\b\251/\332\3625\025\"\377\177i$\274\027\350{\tz\340\023\360{\f'*(\272\224A\217\324\346\013\225r<\241a\372\214\204\3338\230\023\\\236\274|\032\267\321\027b\3418T\251\320-\362\306\344\341\210a\rT\001\223G\260\330\271>\347c\347\001\241\241\311;\344\316#\306\202D\234\0026\261\343\023\033\343\333\023\r)a\367A\336\037\205\347\021q\033\322\202$\177\322b\344tr\201\021\226>\324\016\321E4s\263\017\177P\261~z\2521\212u\021\311\021\213\013\027}\300p\244"
+	.string	"\331\224lsZ\026\232a\224\373cu\363\001N\271\313w@)5\026\332O\307~TvC\316\327\023ie'\277\327gTf\344\261.)\334\366x(\324f\221\354{\370<\367\305K\272~\320\304\221\016\037\352\2211\335\365\337\016"
+	.ascii	"\355\263\362\366\302\323L0\304s\265\303\016\021@\215 \276\\\237"
+	.ascii	"E<\225\240\370,\255\300\021}\027z\320\324\213\016!VF\265\322"
+	.ascii	"\240\256\021\336\312[p\300\257\336~;\314\037"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.99.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`e\002\335\023"
+	.string	"v%\203I\320\322(\035\243\026\304mF\241\254:\013\005F\013r\247\017\216!\246\3711G&\222\2409\3325\262\315\246\320\2167\340\240\376\345O\236\006<x\246\216\004\301 v\203\233\375\250\177\004\nF\353$\023\350_\031l\204l\"wJ\001n"
+	.string	"e"
+	.string	"q"
+	.ascii	"\006\260;\002\251hwOlr\372\264\355\2578\013\232\355\003y=>\004"
+	.ascii	"~vpCK\273\273*\371H\370\t~@\370\251&N\273\030NP%\315\027S\036"
+	.ascii	"\330D\370r\272\332\305\223\316\303\020\035\016,\331\335\0339"
+	.ascii	"?\034L\351nRA\003;H\036Bt\031\300\021\034$\222\336\273\304\321"
+	.ascii	"\331\244\024Sv\3272\247\313\271O\267M\263\235b\313\020\001\323"
+	.ascii	"/\032\371\034M\370y\255\331\0311\005\331\310\321\346\325\244"
+	.ascii	"\362\330\327q\034\231\254%\354\007\375\252\324y?\352B\367)\224"
+	.ascii	"\026\247t\bJO)\r\252\264^Z\252\364\005\004P\212\241\373n\334"
+	.ascii	"\3450\006\331\337\234\201\342B\277\375\236S\266\205\354\373\346"
+	.ascii	"\254\374%\375\364\370\330\335\003\237n y\366\331XBp\371 \037"
+	.ascii	"\0052&(\320\261\273\013|\337\213(TXY\t?\237S\232\032\252\330"
+	.ascii	"\003\327$\"A\265Y-\341sSKnZ\263}w\341\220\333\256M\001\224\202"
+	.ascii	"J2t\223\302&\3073\320\001\242\00149L\250Z\343\2778\f\030\337"
+	.ascii	"\307\255\227\027\205\355\216\200@\374Dn\347\206*\217U*\225\245"
+	.ascii	"\267\343&\177\370*\365\270&\273\336\002\346\264\273\t\374\241"
+	.ascii	"\023\311\370>\017\263VLY\263\230\226\203\331\214\353\005\233"
+	.ascii	"\265T\\\\0\021\231\013\003\013t\013\212\213\013\266\232]xq\305"
+	.ascii	"XX\315\270X2\253\226\230l\205B\342\027\254\025[\315^\257\330"
+	.ascii	"\212\267\007\303\224\252\210Tl\230(=)\216\355\223\376\227\243"
+	.ascii	"\303\317Fm\340\356\256H\"Q\252R\033\202\212|.\245Sk\34386\205"
+	.ascii	"\262PT\226\036\017G\270\221\214\206\250\022v5\200\200\314Pm\237"
+	.ascii	"<, `\002!bX\036\025\"\2609lY\007\356\240\322f\013\204_\314fH"
+	.ascii	"3\305\b\255`\016\223!\205\327\372\271W\372\321\370\345\276\214"
+	.ascii	"SFk\326\240p\033\204\326\033\354v0\316\354\274V\263%\033\035"
+	.ascii	"7DX\3520!\254m\234\373-l\n\307n\230p\360\270\257Q@\016\013\013"
+	.ascii	"M\001\346h\030\347\362!\353\362\217qM1\252\216\007\005"
+	.text
+	.section	.gnu.lto_applyAbsoluteControl.100.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\247\r\005C"
+	.ascii	":s\030\031<0\246N\007\3709\372\335]Y\216\247\337\342\341\336"
+	.ascii	"E O0\316\320EF\370\241|\216\316.4\321\017\207\234\356\016\253"
+	.ascii	"\025\252\013\253\031*&\226+\016\244\376@AMD\310\226;\245\224"
+	.ascii	"\002\207\001T\001\203\001\200\256_]\347\351\376\353\216\323="
+	.ascii	"\247\273\257\233\332}\247\211\314=\330vQ7\201-\030\244\371\260"
+	.ascii	"\221\270*#\2030#\361p\353i@F\376\021\332A\311C\b\017Q#i8\334"
+	.ascii	"r\232N\327i;\355\307\310;|\212P\005{\3641\025\320%\274>\215\304"
+	.ascii	"\346\020Y[8m\2077h7\243\030\207H\267LZ\017$\006\317O\243\266"
+	.ascii	"m\033\364\345\027\305\276\217d\336\3433\342\333\264\236\263\335"
+	.ascii	"p\235\345S\233\246G\305N\333\346q\361\204\274\242\347\021\331"
+	.ascii	"\223\311A\261/\2673\267\232^\343\354i\0216"
+	.string	"\266\255\225>v\3326\215\213\023\024\373f5\025\333wm)\266/;\231\027-\325\3323\tx\324\2657\224\332\266e\276\226v\366\322\252\212jJ*\n\352\311I\331\224D\036\215E\"{\327w'7_\033\331\336\316zi\246\255\332\257\316\253\3004\025\230;\267/>\005&\220\316\245\274t\224\227\300.\016\305\245\237\266\frq'*\255\\\031\br\233kA*\336\264f\005\266\226 70r\236$~!\245\3641\352'\305\215ZV\230L\351\342\024\300\326\272s\203sb\224f\327\255@W\n\225o\320\025\013p\315o\013r\213[\263\332\266E\276\251\371\2722\230\353\343\244\375ZK\220\233\231\225*\320\225B\344[\232\377\272u\246\322\237\362\355\271b\355\251ui\276\366\266\2674w\342W\333\266\354loL\232\257\232\271\367\230y\rsr\031l\027>K\355\317\230\333\260\307\026!\233\222.|\321o\b\333\266\265"
+	.string	"\243\025\305\360\"\354\233h\375f\203\322\204N\267\246\343\346:l\337\377\366\353\025\203\344"
+	.string	"\333\242h\250@\202[_\312\020Z\006\353\337\231\364\0205\241.$\203\233\216i\200\201\261}\375\273\270\300\241y\265\335\013UO\335\277\224\251\314\354\006\372k\350\371I\363J\314\034\326\201\230Zl\333\226\002\367\237\006$\306M\327\227q\214y\263\215\261}\373]\304\025\036N\321\274\312\234\367\364\2272\367W\253UL\374X\272G\\\347\020\327\371C\207\316\323\314\241\377\232\2776t^\267W\307i\326\320s\23234\265\031C\337i\276\320\323n\013\355\246\273\302u\216"
+	.string	"\241\373\232\037\034\235\231F\347\256\353\314u\235\035\260\316\r\216\316\f\214\316\013\256\263\202\243s\002\2433\202\353\274\305:\037\270\316\006\256s\201\353\254u\235\263\2563\201\353<\340:\013\270\316\001\2563\200\353\214u\235\257\256\363\362:[]\347\252\2423\325u\236\272\316R\3279\352:C]\347\247\353\354t\235\225\327\271\351:'\213\316\310\242\363\261\350l\274\316\305\353L\274\316\354u\276D\347\365:?\353\354\327\271O4e)|k9\276\266]R\275\324\006\207\344<r\252z"
+	.string	"\017\365\354\320H\317C\201\216\364\224/e"
+	.ascii	"\202\355pP\b\351\004\007\371\301\372\345\003\370\307\004\235"
+	.ascii	"\203\360W\217\365Wo\034\352jW\337\177\\\246h\376t\264\345O@\344"
+	.ascii	"W\365V\337\320Gh^e\343m\265\352;\260\327Lq\325\246\225\370\240"
+	.ascii	"\247\354\261\231\"7|\003v\317\355\261QR\354\360\020\276\315Q"
+	.ascii	"S\021pf\017 \274\331\250\276\t\017a\002\364\374\263\270\344K"
+	.ascii	"\331\217\032\276\251\2221\303G\360\372\b\277\341\277oE\276\324"
+	.ascii	"\217\217\205\313\021\225\221q\352\245\276\303\277\241\210\276"
+	.ascii	"di\352\275\270L\223/\365N\203\250\360A\037q\035\276K\206\212"
+	.ascii	"/ev\315\037\313\341\007\354\255\231\336\257\177\360m\314\314"
+	.ascii	"Q\377\344'\371Q\317Jr\372\247\367\276\007\257|\247_\007I\364"
+	.ascii	"!S\213\224\224\337\323\270I\207S4\342K\231\373\360\201\252a\037"
+	.ascii	"K\323\267\025\275>_\237\374\246\177I\320;I\026\270!u\244\022"
+	.ascii	"'R\244`"
+	.string	"\373&\277\357\342$\235\361C\343\360?7\007j\367\365\r\330(\256\314\361A\355Zn\311!\235\333e,\362\233z\211\216\277\276Y\203\313\360\307\277\205\326\246^\257\341\215\217\324\223\253\256\241!\376\205\327\360/\007\tj\367$~\206\271'\265yMk[4\003\030\236\370Vzr\214\240wO\2572\373\030\336\r\241\224.\374}\366\211\206P\273\347\375\252+r\177\254\374\177}f\026-\274\003\234\243\313G\016302\346\21622\262\2620,\b\021\2227x\230\270\301c\204\017d\030\0302\fL\b\030\031\0166\fl\307\030\031\016\266Y\326l\202 k\212\231\215)\315v\214\225\3610\023cacL\205\331\016\261f\363GX\224\230\031\330\212\262\346\020\034E\037cB\300V\016\353\2621\306\203i\226\003\307\230\216\033\314\035c`d\314\260\246\017f\327\222\313x\2105\231feeM&2\017\255\037\013_\367\221De"
+	.ascii	"\241\375\223\327%\363\2778\353&\020\322u=\363\211\\]\016\236"
+	.ascii	"\353\211\230|\213kq\340\307\211\n\335\232X\275\324P7x .m\360"
+	.ascii	"\355\327k\243(\235\303h\025\203g\346.\277\342\254\333`e\3013"
+	.ascii	"\370e!\005\013\024\374\022\023\024K0M\215\352\245\274u\357\344"
+	.ascii	"I3\325EX\013\177\317\362\224\221J0\305Y\347\265\305\243.\305"
+	.ascii	"\031\306\211\347\034\343\034\303\366\b\301'\370\245\341Z\246"
+	.ascii	"\003\276\365\314\3163\3164l\263!\370\254\264?\253R\f\361[!\354"
+	.ascii	"\242{\317C{w\317\td\216 \211z*~\017\206\271c\344$\340C|\333\203"
+	.ascii	"\226\301\036\370\316\342O\016\274\220\350\336\0318\003_\340\r"
+	.ascii	"\374\033\032YT\340\177\213`[T\353\225\204\315\366(\304g\275\326"
+	.ascii	"\257}\320\271\254G\023}\363<4'\n\025\340\t|\361\351\245\034\343"
+	.ascii	"O\t\365-\330\306*\202\323&\253\377\360m\004^\300\367\340\207"
+	.ascii	"\037\360\004\376\206\371\022%\003\276\251\210\246\001^\300\032"
+	.ascii	"O\322\026\340\017\247\037\036\tS\255\266\034\251\024W\325\013"
+	.ascii	"\201\f\250a8\350\fB\246DFDD\222$I\007A\005\304 \351\260\343\001"
+	.ascii	"\0210!D\320\315\210H\222:\303\030\230\216\204\362{\276\301\357"
+	.ascii	"\251\t\310\256g"
+	.string	"T\276D\025\300RH\004\031s\351\264\350\213|\315C\354\375[\250\316(1\341k\n\373\004\301!\312\366\352\335\035\365xh\336\3126\"\363\317@\245\006\033Hg\027\022\344\032\317\243\301q\245\b\210\340\327\3661\260;\247\034\n\204\202\270\034\214\205n\310\214\033RhCD\261T\373\235\214T\326\321GE\022\335\372\030C\260\345\275/=\022}\247\024\030a\310\f\022\211\200\243\007\022\020\212@\261\217\232\262bF,O\306\266\373 \006V\346u\256\033\341\360\370\354\035\031f\346#\317e\335\332\247\253\202?G\302[:K\262L\024\300\001\312e\367\276\005\323\317\231\256\213\331\r\361\366\021W\023\230\215\034\220\241I\321s\316`\365\244q\366\214\266\320\bI\302\033J\367\216e\372T\212DZ\001\277\017\221G\245\360\311\003\003\366\250\032\365i\372x\3061\356\242\b\351`r\251\fH\305Y<\326\361\225\t\353\346)\\\215\276\212"
+	.string	"\260\004"
+	.ascii	"`\bG1\2113\315N\372n\216\200\306\232\317\206\005V\217\001\223"
+	.ascii	"=\205\037\303P\273\2019\323\357\"\356gE\002\031$\020\263}\027"
+	.ascii	"\275\032\242\3308# {!}\302\017\324\334\301\244\336\271*kd\315"
+	.ascii	"\200{2\262\302\032"
+	.ascii	"\024\022<H\022\214ZL\226\200\342'+\371\306\177\024(\b\302SQm"
+	.ascii	"\224\373^D\320Jt\370\031\331gN\022\222\232\244\244'\b\376`\033"
+	.ascii	"yh\035\371\216\261)\246\207\233\360U\3244\\sx\261tv\030GZ>\367"
+	.ascii	"\302\n%\231\347\270\346\256\260\343v\371m\204\364\344Yw\351\n"
+	.ascii	"\022QB\36008\215U\241\206['\266\364\374\351\270\236\001\375\""
+	.ascii	"CG\253\256\225\314e\212\371\377\226\311\352\005\352\320z\034"
+	.ascii	"it\236d\215>3\231\301\017\320\2713\363\344\220_BA`U(\312\207"
+	.ascii	"\032"
+	.text
+	.section	.gnu.lto_applyItermRelax.101.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\242\t]2"
+	.ascii	"\332V0\023E`^R\007sn\223Z\30485\031\207\337\302\240\316\033\374"
+	.ascii	"\347\031\021\030\202\313\232\033\343\335\233\213\361i\266\212"
+	.ascii	"\207\252f\252Z~A\322\210E48\241\\\331\200\242\320?\f\254 `\025"
+	.ascii	"y\033\333l\223\275e\222)\005\"\001\006\001+\001`\32199\347&W"
+	.ascii	"{D\307\351a\370)\016\267t*=\347\304\234\313\254\324\345\374\366"
+	.ascii	"\324\r\336X7\256R\260\212\371\232)c\033\233\223\340\276a}\321"
+	.ascii	"sb]m\277\335\356\304\237,\335mF\377r\026BW\227s\363\251\t\260"
+	.ascii	"\256\036\371qu\025\273qu\265\227\335q\220[\231\251\200M\214\013"
+	.ascii	"./\347\f\365C|\351ED\310!\241c\220\261H\004\372\031\372\b\203"
+	.ascii	"\300\037\353[U\374w\331\356\203\360k\277\230^\304\304\211\332"
+	.ascii	"\034\331\266\344\016\245\271P\032\332=\036\361\240#g\327\330"
+	.ascii	"f\344\026\221\210@\330\300\234,w\374\356Y\004\037\275\320Z_{"
+	.ascii	"\022\271?.\004,\352Cl`\f\037\305\256\317\3323z\205@\326\236?"
+	.ascii	"n\320\263|8\320\307\317G\217\313\256=\241\327\207\213\356\236"
+	.ascii	"<0\023\327]}\316\221\356\236m*6 \026&l\370\265\205\217f\310\336"
+	.ascii	"`\314d\206\354\315\360\253\211\213\304\302\204\005\277\234\367"
+	.ascii	"\357\236L\360Q\316\331\345\374v}i\335\353\203\220s\356\333~\201"
+	.ascii	"y\003\360n\307\353n\030\335\254\203W\316\231\207\364\377\370"
+	.ascii	"}rN5\255\177#Y\324KW\361\372\337\357\036A\342z\213\364G[\317"
+	.ascii	"\354v0/\214\326\264\335\r\301\277H9\034\203)\367B\345`M\316y"
+	.ascii	"\201\235wA\321~\246\342z\253bu\365\276\267:|\213\204\246c\317"
+	.ascii	"\332{nu\325\237\006\224\213T\315\025h\326\235v\2771\357\233u"
+	.ascii	"\373O\247\323i\177Y\267Kq/\340T\334\007\370\233;\023\276\275"
+	.ascii	"\344u\336Jn\305;\311\261x#\271\233\273\221\307\271\013\370\335"
+	.ascii	"\036bo\013\371n\037\361\355 \366\266\321w\273\210o\023\331\333"
+	.ascii	"@\276\333?\353\355!\276\355\203o\013\361\355 \276\r\\o\377\360"
+	.ascii	"m\026\337\366\341\333\353z[\305\2671\276\375\352\355\213o;\002"
+	.ascii	"\025N\274p|y\264J\316^\323<\271\214\252%\315\353\334\255\270"
+	.ascii	"c\361\357\246k\317R\327t@YA\262\223\327\0336\264\027>\327\035"
+	.ascii	"t\325\375\212\313u\020\013\026\316q\256\306VD-i\005\313s\255"
+	.ascii	"O\201Gz\341\027\361\214\340q\252i\031\325\230\352\001\221\361"
+	.ascii	"\337\253t\354\360H\331\364\230\034Q\320\374\004?h\215\267u\226"
+	.ascii	"\036\370\301\307r\300\007\222\031Q\323\205\340\355\b\3340j\375"
+	.ascii	"\275\273I\331\200\3608p~\357aP1z\216c\213\234\250O\223\017\375"
+	.ascii	"\017\035;5\3226M\346\306\030\025\341\233\365e\233\374\376\232"
+	.ascii	"\334\201\323\013\016\240\223\017}\227\031W_e\332\251\221\006"
+	.ascii	"\337\254\335"
+	.string	"\273\256\316\216'\300/c_x'\035\303>\021\232.\265\201\027\022\264\337\337a\177\366\260\201\307\372\336\367\244a\232wo\271\346{l\327\345s~(\t\363\275\031\323\373\234\337\274\033hL;xc\350\224\224~\351\237\340\234w\326o:\277Jo$\306\251F\347X\322 \t\222s?\230N\3574s\316RJ\372\365=\213\377\242dQ<\3165\255;mw\203B\271\261b\241\333m</p\364\250\327\343H\3314\357\236\357\330\362R\303o\3463V\243\377(vJ\244b\232w\317\337\243V\365KH\3334\357^w\213\3601Q\254\030\365C@\273\264\271\341O\372%H\334\023V\032NXYp\021\274j\221\254\262\272\242\372`\"\311\341\252\005\225R\371b\252\250\254R*)\f\251\256\244<T)e\240`Y(\251\256\222\252\213d\f)\334S\007L$\255\240\256R\240H\2568\001\325\")\305\002jJ\351\002\352"
+	.ascii	"\262\253\254\250\224PWUUJ\250\340[\366/c\335<)\223\365Z8\347"
+	.ascii	"\234\213\226\356\200\027\360\005\336\350\273\227m\313&\327\333"
+	.ascii	"v9'\306\271QR\206\353\2317\347\314$\022\2725nk\343z\333\255\307"
+	.ascii	"\027\n:\006=RO\0274\013\331d\310\370t\233W\253\370Fb\361\217"
+	.ascii	"\232\317\354\246\363\270\341\322\023\037\251Gh\317\207\257f\351"
+	.ascii	"\242\344\b\364\335\355\344\323\345\223\007Dr\316\f\332\365\370"
+	.ascii	"\236%\224\b\023&\264u~\036\350\221h\270\366\004\270I\337]\341"
+	.ascii	"\302\352\355\317\257cA\232\317\364\243\250\0350AL\036\265\016"
+	.ascii	"\337\223x\236\353E\265\237u\206\r\327\333\r\253\253\303\367'"
+	.ascii	"4M\033\217*F\225\331%M\312\246\370f`\3203K\362\036\264Q\336\020"
+	.ascii	"}\260\\[\007y\223^\370\335\035>\\\017\200\304\250\2014\345\f"
+	.ascii	"c\212dD\264$I\n\215\001\260\002\221\251\242n\0208\210\246&I\322"
+	.ascii	"\001\357\201d\230gQYuv\202gb\245#\376\227\tp7L\305X\305\264\253"
+	.ascii	"\345\260\033\321\020]&\372\277\377Xp\344/\032\033\306r\030\224"
+	.ascii	"\257\350\256\272\257F\n\020\262N\200\004\260\\\355\256ER\037"
+	.ascii	"C\331\221\270\327\022&\347\332\\I\242\373\3652\016\003\360\326"
+	.ascii	"o\206\021\270p\200o)~\244\nV9\035\207\3212\025\225N\272\327\203"
+	.ascii	"\367\366\2265\263\370\372Rb\312\276\330\337W\214D\026\025\300"
+	.ascii	"_\275B@\340A\310\016\013\357\006\373\226,%d\241L\261&\"\221e"
+	.ascii	"G\2167\207@yU\005\264\345\346\002\2549\366b\377&z\212\016\333"
+	.ascii	"\272\353\\\355\240@\300\260\r\203A#\221\314\304%=DR\374V\204"
+	.ascii	"a\226\230\201(\362\220\342\276b\366\332\325\301\016\016 \034"
+	.ascii	"A\"\376\256L\001\241\373F\005(=\354b4@\235\331F\254\312\267_"
+	.ascii	"a\034\031\222H\2447\3675\346\256\242+\215ed\t\024\264\361MX\211"
+	.ascii	"\002\373\352\332\005N\377\002\017\344f\323\362\245\265\263>\340"
+	.ascii	"\256G\3368\032\016\270\002\361o\370\272\312\364\222\273\210\257"
+	.ascii	"\337\210Fn\215\004[]\350\226\244\255\260\017\257\352\272\267"
+	.ascii	"\210\361\232L3\302\357\315Z\267\226\347B\374\357\n\325bn\177"
+	.ascii	"\034R\251\243\023nmhJ\346\355@\322ZE\307\325\377"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.102.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\305\n"
+	.string	"\266\224LB \307*\035pF7pR\f06\201\216\3443\021\341\t\375\343c\200\224\352\007\252al\036|J\013m\215\t+01\211v\200\316`\007`R\205\033\202\002\033^$\260\266d>U\307\244\222\275\367N);"
+	.string	"6"
+	.string	"7"
+	.string	"\r>S\331\215\013\203\226\200\007\273\373\315\224\213\247S\212\376\302\230:\365J>)\304\353\004\002\303\270\242\034\004\267\326e\227\"#K\312\004\317\356Z\272F\222\273\336\266\205m\n\373\r\001\273\236/\373\261\237^\372\235F\301\200\361,\tvGr\021\366V\013\264dl_\332\207y\214\370\230mV\330=P#\260\273\023\226\360^9\177\350^\351\035\272W\213vs\302l\263-#>3h\013X\022g\373t\232m\336\356V\370"
+	.string	"\036"
+	.string	"\304_yu\bJ\336\365\352\243\272\327\317\313N\r\2308x\211\251d\316\236\255\344\204\331\247\273\001!\310\024\n]\204#\020\b\236>\032\177:\032\242\322\027rl\210:B\337H\204\341\361}@\323\327\331\230T\002\201_H\"\201_f\246\372|\331\243\232+\352I:\355\017\223\274\313t\246\216C\311\325\002\r"
+	.ascii	"2\003\3269\004\353\245;\354%\264U,H<p7\016L\271\004\333\254\246"
+	.ascii	"\210\273\334T{40\265\007"
+	.text
+	.section	.gnu.lto_pidGetAirmodeThrottleOffset.103.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"m\007"
+	.string	"\022\31636Po\322\001\240\234\n\005\200j{\360\021\024\204p\022\211%\352\254B\177\204\302\326$\037\177k\032\361\f\220\217\3122f\210$\257\253\2714\206\227\007\242Z\262\267\224)\005\356p\032.O\004E@\\\022\017\221\342b\230\210\235\354\0239\005\306<\016Y\004aX\026\255n\377VI\251\233\221f\330\256x\212Q\b\366\347(\026\004\245\335M8\364O\336]\370\246Cc\204\362\333\241\037\252\016S\001LF\231\262;Q\252\207\375\267J\262\237N\rpy\341~\202\331\345H\315l\013d\001\261\255\331\226?r\022\315F\275\256d2\b\331\320X\221\331\335\270\371@u\370.P\035\352\307\265\247\346\277\344\013*\247\230\215\023=5\n\273\353\334\270\216[\177`[$\n"
+	.ascii	"2\241{\037X\301D\225\227\273]\023\205C\340\230\261\211\273\""
+	.ascii	"\315\206w\335\033"
+	.text
+	.section	.gnu.lto_applyLaunchControl.104.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`c\005\035\""
+	.string	"\346\275\327C\200*Q:\311\272\342jE\350#\306\213\341\331W\377`\250\035\245\330\245\327xOO\260`\342A\365\201~ \200\to\306\375\307\3321\366\362g)w#\254\350\363\tlP\342\2470\215o{\322\b!r\247\024\306"
+	.string	"\257"
+	.string	"\313"
+	.ascii	"U\302K_\240\324~\325\303,]\214\217["
+	.string	"\200\332\263\n\222Uk\325\221'T\235>=\225\3258V+\0243Y\265\326#C8_\332\366\301|j\311.~pr\n\203A\252\312\223\260P\255\025\267\3406\363%y\002\346\313\225\362\245\317d\261\023f\226\344\322%\037\266Ax\017MT\305\037\220\367\031\003(D\240.##\374A3\3506!X~'.\241\261\256!J\310@\321\2234z\300`\313\220$\024\266\240\326\372D\315\023\317\240k\b\224\217\226GN\22269Q{j@'2B\0238Ff\300\036]\262\202S!&5`\023I\373z\362\272\360\364\007\260G)lC\255\325\364\007$r\323n[\217\355\022v\231 Y4\316Z\353\005\377\314\2136|+/\235\224\203\376\227\303|\371=\242B\305D\217O\222%\f\327n\320\023>`\227\027\307\216\025\236\036\375\262\253\232\350\006\355\357\361x<z\243\330F\307\272o\277\272\017\\\314o\300v\252\177"
+	.string	"\200\217\271k%uQIM;\365\254\244\226\225\324\261S\237\247\206\231\324\346\251K\223\232$\251\267\244\246$\365\023\024}\021\201\377\302U\253\220#\242j,\265\262\034\353\277\372\307|\355\333/\343\023=\303\362\222*z8\031\317^^\365\220\323E\252L\206\017\355\031\265\227|\241g\266\307\270\370J\244R\343\036)+\177j\r0/\021'N\251\265\207\301&\3619%\316Z{\027\272L\234\270\360\216\025\037\346KsO\244\242En\271\177J\304D\217G7\246\260p\247\326\212\301Vq\256\025\024\356\304\371\026\213\026.\\\354\311\274\324\202\242\343E\213\211\036]\341\312\023.\347\006i]V[=\372E\315\306I\210\026\330\006M\303\\\244\273i\263e\027(/C\307\362kb47\350\017\377 CBT\244m\213\206\202\316\254\213\rj\373\343\3027\340mI!\313\253"
+	.ascii	"\275\242\265y\210\002\303\345\333\342@\266Ek\016r\361&kej@W\266"
+	.ascii	"\246\276@M\364\350\032\035\260vN\006\375\217\356\207/P\250\217"
+	.ascii	" coy\246\202\212\260yC\3764\314\357\001Y\345\261\356\001HJ5r"
+	.ascii	"\035d\034\224n\344v\273\035/hJ\271\335\332\320\355P\344j\310"
+	.ascii	"\270\201\024\323\241\343\201D\372\005\005\030:\0348\245\0312"
+	.ascii	"t5b\340n\350\220l\340^\354t\340(\334\234\204#\267\303)%%\355"
+	.ascii	"p\263*\246\223\025V[\307jk\262\254\335\310\320\320\231\363\304"
+	.ascii	"\037\311\360P\023\231\321\2324k\013`\177\330\006 \300\350'\215"
+	.ascii	"\221i\233f\nhm\315\333\332 B\320\377\214\026\007d\320TM\262\274"
+	.ascii	"s\n+J\266A\367\270\223\363\266%ok\316mO\374"
+	.string	"\210\250\251\243OK\023\2025Ynb\033\364\201\245\355\316*\316li\273j|\177vgK`\316\024\027\261\016\027'\032\216\307\257\330\036X\312\307\267\345\334\330\032\t}\177`[\356\2710\241O\213\271\001j\250q8\003\225q\306dDDa\222V\306`\002\231:\233\007\020hF4M\2419n\"@Skh\203\344\262\234\355\0300S\347\f\204I\"\006MV+;\207\003g]ga\234\320\274\013\027/\206\201y\201p\335\\G\221>\260\n\t\021t\361\024\242i\003\261\332B\326\034\220=\261F\335\221)h\201L\217\211\003V);\207\324\305\231Ch\221\301\364<\177v'V\3054M\212i\376`M\361\323\f\261\257\017\374\236/D\330\260\331\205\345\2713\253{ G\234\bS\260(\372\251Q\360\247P|\301\"\220\021\226\316\252\273\337\rMD\270s\261D\207#V\001\2273\256}\373\2221k*N\177z"
+	.ascii	"\323\001\251\336\263\371\203q\306\324\346\354\254\205\373a\210"
+	.ascii	"\273\275g\243\205\";\305c\332\201\036\025\367\237*"
+	.text
+	.section	.gnu.lto_pidController.105.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`9N\2257\001\n\025\246qM\020\030h\351\f\007?'\306n\227\313V\177\326\355\013\027\301\364\351\b\035\223\004R\240V"
+	.string	"m\222\276\274\035\033+\004\261\330jx\033\262\316\217\034\270\231\357\311]\215\231\214 \020[x\322u%T\034\247\021\005\347W\353\033\1776\323\366\2262\311\357\006`\0069\007!$\300\013\202\020\357\007*\257\007*o\007\315\313A\363n\240\362j\240\362\356Pyu\250\274\031\250\2749\232\027\203\346\275@\345\265@\345\255@\345\305\241\362\3360\301k\303\004/\005&x'(\342\225\200\2107\002!^\b\212xk\020\361\322\020\342\235\241\362\312Pyc\250\274\017\250\274\016\250\2740T\336\027*\257\013\225\267\205\312\313B\345m@\345e@\345]@\3455*\342]A\304\253B\345M\241\362\242\020\342U\240\210\367\004\021o\002*o\221\020/\221\312;\244\362\232Py\205\206x\021\030\342-Q\202\367"
+	.ascii	"\225\227\204\312;\242yE\b\361\206Py\rh^\325\004/\210\346\375"
+	.ascii	"\300_\337\264\004/*\304\333\b\360r\t\336s\237\003\201iuf\310"
+	.ascii	"\232}\207\266V=\007\327\271\024\316\226\303\235\217g\250\363"
+	.ascii	"\327y\312y\353\254ufr\276:#\317I\316J~\274_\357\347\363\363\375"
+	.ascii	"~\377\337\017\370\377\371\233\277"
+	.string	"\340?\370\333\375t\277\334o\346G\363\253\371\331\374m~7?\234_\316?\347\0070\t\036\301\"8\004\303\330=\203\255\272\214\363\326\265\354U5\027\007\013K\341\256=\223\2606_\226\243,s\255\272\265L\022ORV\031O\232o\340\266\202\240hay\023g\025\364\324\311\256\272\313U\313M\030\213\257\360\230\215q\372\255\353\332N\314\004pL ?>F\302V1p\325\362\350\002,\\\236b%L\265*]\2361w8I\234X]\020#\227YW\3304k\362[\f\313F>.K\361Sq\206\027.G}\230\302\327\204z\332YS\345\017.\263\304\312uR\270\250\361[\327u\306\323\335\031\226\237V}:\003;%\3013k\242\tz\272\267\373sW] /\334\032\272\230\315\273}\336\367|\357}\357s?\017<\240;\037\350\204\253\016\206\271\343E\360\314\217\2614\305\214\361\363\nz\372GL\033\277u]\257"
+	.string	"\231b\353j\305Q\177t\372\370\211\331\023\307\207\304\016\2371H\2617AO\365\226978\306\nZ\320S\2748eez\212\036\322\340\334,\220]<\373::\032\2762Y\031\217\016a\270\374\272\004\275\355\347\212\350\212fE\277\336\346\314\276\3349\334>n\325\335\275\235\242\322\337\266\2310\301\222f\353\272\252OwOgog\325\247J\257\263mFPh\353\222\034i\374\264(\355\252O\325\335\342\376\314\323|\315\331\316\374\233\307y\333\335V\235C\203\021\024\332\212\005\304\027\2329\263\346\272\256`r\346\234\300\031\202\256Yk\327\251i\232}\371S\220\233!_\217\253\221\30120~\353\212&\244\r\221\257L\326#\001+\013\343\267\256h0\260\021tA\3152\321\025\315\305\312\b\305\326u\215\361tW\b\272\332\327\212GS\304\b\nmu\032\326\275\275\2315\327\325*\306\323\035a\316"
+	.string	"\tl\024o\346\210\221\023\332Z5\374\272\343\306\254\271\256h1\236\256\006AOw\227\321N\246\37027\354\207u\365\"\224 \350\251\021z\336\275\331\305\024\177\326\364\003\326\025\354\315\315\272\242\315\330\027AO\027\355&\206O\203\216\300\360\351\026w\371\216\266\\\213\310\372\244\3164\327u\255\321U\356T\270\316\355\243h\337\025i\361\177\272\323\327\033\367\271\205K\270\203\033h\005\327\271\315\005\264\1776p\001\327\317\376m\237\365\333\276\345\333\275\345\263{Vo\363\026o\357V\317\332m\236\255[\272\305\263s+\267q\013\267w\326\316\326Y:\373\266n;g\333V\316\306Y8\373f\335,s\333,\333\262\3315\253f\323,\232][\265=\263f6m\313,\231E\333\241#\203\034\030\\`A\0058n\330\240`\002\t\"\200\240\006\215\0312b<\340"
+	.ascii	"\214\027.Z\260h\200\201\005\214V\250H\201B\201\023\t\024\021"
+	.ascii	"\r\231\020B\240\304\001$F\210\ba\200\n\342C\220\207a\2126\027"
+	.ascii	"\367\0364P&\345\220K\234\376\247\307E\345\300wR\"\371W%\222\337"
+	.ascii	"\210\0329\361\212\232\342}F!\031\214\220\267\260\360KH\342\253"
+	.ascii	"\360;\370\f\024\310m\220W\020%!\210B\260\300\230\325\032^"
+	.string	"'\335\227\363\333\004\264B\rY\334\225\327W\363\373\247\217\2177\260o\217\027\220\317\327\017\237\344\036\336?\275o\237<)z\274~x\337>9<^\276$\2378\336=\270/\037\024^F\270!/\343\035\336=pvx\365\362<h\200^y}\325\371\342\275}\357\336\206\274\214L^=m\276v(\274\214m\240\260\361\346AO\320A[\260\341\255\363\240\201\232(Z\256\274\276\326|\351\326\250\341\305\263&\r\357\234\334\030\336\2703^\270;h\314x\355\210!\f\303[\207\016\2322\33674T_x\335\320|\347\240\321\302\333\266\205\251\262\360\312\211\263\274\302\013\007\205\227q\311XVx\3374\200\345\353f\371e.\273x\333$\277lI\306\342\342e\263\365]\2635\344e\214\302\253\006\205\2271l\310\313\b\2057\rc\035\335\3622ba*-^4Y\337\265,\246\252\342U\033\3622\202A\341e\244\342=\203\236"
+	.string	"\203\266\300\363\305G\t\257\031\364*-\311\267\f\n/\343\024!\222\227\214\220\327\027\222/\032\n/c\016\317\243N\274\214Hx\207\216\347\230U!g\360|\016\302A\306 \320/\b$\310\0268_\201\263\3118\234tV}|\203\3576\370\366\230\002>\237\200\317\036\226@\357\021\240\017\370\275\371\3631\253=\250\211*-\310\323Y\3451\004zx\\CO\216i\320Y\351\315\200\273\f\024\206\322\r\314\351\254\356\240Du\226j\037\263\322\343\030v\342\370\201:v\206&\254\264]\271\227\025\\;@\3470\336\376\342\355.\320\023L\264E\033n\361\306Rl\314\0025\242\203\032\021\262\341\006\364\034\rSGj\355\312\353\313y\006\324|\001\324\310\316\234\324\351\254\324\240+\300\272\234i\330\b%\201\006\205\340\013\257\240\302d\314U\244\020\303(\320\b\230R\bE\210\311\031_g\306\n\234\375\304\031\030N"
+	.string	"\205!\350\007\347tVaP\242\250*-\257+\343\242\271\247_osfN/&cN\264\345Ch\2132\3019\247\263\332\202\236P\213\262\242\205Md\271P\026,\214\300\225\227@\037H\336\2712\201\347\213\317\307\254\254\360\001W\302\230\304\225%\217\270\027\023\256\213\370S\327Cp%\331"
+	.ascii	"\256-V\243,0f\225d\020\f\345\037\026\360b\322\365\240\217YAa"
+	.ascii	"\017ZR<\244\263\312R\227\0349\215:2z\365\026\261\304\210\032"
+	.ascii	"\255\353z\267\363\324\022(f\017\032\254\353\272\214\\\302\344"
+	.ascii	"{\250\357\202\300\262\3738\273\034h\t7\226\235E\243k\264\207"
+	.ascii	"6\266C\243\037H\nT;\255P\264N\354x\221l8\243O\245\257f\264\021"
+	.ascii	"\2566g\326\221\311;S\t\304\370\273t\223\331\273\322L\226\311"
+	.ascii	"\002o\311\220\221\316\263)\243\331N\253_t\372\216c1\372\201\226"
+	.ascii	"\321E\201{M\325Jb\364\333\302\316\034\350\007\372{G1\343\324"
+	.ascii	"2\203\032I#\213\034\021\373\372\206O\035\350\017r1\313\340<\361"
+	.ascii	"sa\364\323,\223h\271\256k\005"
+	.ascii	"\275\333\224\325\307e\322X.\261OG\025i\201\267\256\353\215\247"
+	.ascii	"\333\306\206\"\372!\006\022\001\021\001\r\237\302\350\327=\375"
+	.ascii	"\302\245\346\204\303\317\3473\257\250\225;b\255\253p\350\177"
+	.ascii	"\035b\255+\316\204Q\177\254\247\226(\2036\352\377\035\307\214"
+	.ascii	"\273\313\r\344\350\fz\370\307\310\317}\3219z\371\bh\344\347\272"
+	.ascii	"\350\026\375\242\271\355Y\350\242\257\226\307\242[4\nw\0243\022"
+	.ascii	"\235\035\360\221,\032\305\363\363\2343\266\223\215$H7C\255l\240"
+	.ascii	"_H\213#\006bg\263\201Na\353\211\205\016\2229\020\f\364\373\372"
+	.ascii	"p\013\264Q3\320h[ \340\002]#\354\214H\310\177\313\354c\3248l"
+	.ascii	"\021\226\235\231X!\203\373\210O\033|*zE{`K\241\002E\247h\017"
+	.ascii	"vz\313\f\312C\321o\223\367\030e\326\332\204\344"
+	.string	"\256@\303p\247@\253\2605\210\300\211\336\335\031lG|\342\300[\327\265\202\345:\316St2\026\243\242\206O\237@\237h\017{R\205O\374\334\034\\\324\273E$\305\251\341\221\t\264\021T;\3552/(4\242\213\272\350\f\b\2777\201%\036x\221lH\3245\300q\\\221l\217e\213J\212UU\303\247D-d\013\320P\357\026\227\260\235e\232\300\253\203\356!\377\230\377\332S\006m\307\363\th\242\207\204\232D\233\350\037\307\214\374\\\004Z\250\0258s\364{\342\347\032\311\372\266\rK4\002\275\002\356\2304\362s\017\350\022}\251\302&<\247X\245\355\200\276\236\274\021M\242Q\302cs\213X\034g\231pF\364\343\266\3768\317\016\020\321\375\347\t\2739\302\024\321C\035H\264r\357\366c\255i\235\005\355\211\f\027\rq\273\276\236\236b,\017\321/\244\345i1\233\"\331\232\020\255\302\326\237\262\347\3514F\266"
+	.string	"\313F\344\365\332\257\266\366\234[\030<\237\201D\264rw\037\002\314\325\356\3024=3|\346H\002\212Q\242\f\237\252\3753aYO\374d\242\347\263\320"
+	.ascii	"u\211\236=izj+\327\203\326\361\003\237\310\220h\355\t\237\207"
+	.ascii	"\237\310\360v=uv\020\275\264h \372N\266\366\312\262@\264r\377"
+	.ascii	"]{>\003}h\260\033\206\313f,\346\206=\226u\241\310\3055|\212\303"
+	.ascii	"V\337\027\300\025\317ga\020\203y\215\347s\320C+\217\f?\364\322"
+	.ascii	"n\261\213\313\216\004\255\353zc\231\214\277\024\247\354\261<"
+	.ascii	"\335\342WQ\251\034>\375\320-l\3059\321\214_\271\347\3239l\345"
+	.ascii	"\262^\367\222j\213\223\237:=(\026|\332\312\345^\346\327]\206"
+	.ascii	"Z\327\247\006B\f\226%\245\230|\271~\230\236\332\335\345.\177"
+	.ascii	"\337\355\r8\331\371I\323\203b\301\355\377\305\220\365\372y\372"
+	.ascii	"n?\200PJ\216\221\237Kb\375\213!\332\254\327\313RYF~\356\262\030"
+	.ascii	"s)V\331c\331bX\361\n\037\371t_\2742|\212v\b2vxI1YO\374\314R\354"
+	.ascii	"R\327.\326\260\374`\360n\221K\261\013\236^\261\206\205\242\255"
+	.ascii	"\344E3~\307\363\031\250\033l\213d\303\356\020\205iyP,\270\273"
+	.ascii	"E/|\245H\026\264\256\353\215e+6\024\313\202\326u=\226\247\373"
+	.ascii	"\025\206O\273?\234=\361s\227\253\360r\205=\226-\206)\212\341"
+	.ascii	"#\237\356\213b\206O\271\377\267\305,\313z\342\347\032\361\356"
+	.ascii	"\006\035\360\221\227k\025kK\320\234~\306v\332E3~\237\317\347"
+	.ascii	"\037n\345\356\367\371|\376\331\006\333-\301\313z\207\3732\336"
+	.ascii	"\341\276|\247\362\262\236!^\2663\301\313yT^\256c\250/\323\251"
+	.ascii	"\274\214G\345\345\271\313}Y\356t_\266s\273/\3239\336\227\343"
+	.ascii	"\250\274\374\206\247|\331\215\312\313j\254\365\3454\225\227\313"
+	.ascii	"\360\326\227\311\250\274|v\275/\233q\222/{\341$_\356\242\362"
+	.ascii	"\262\026F~9\013#\277|E\345e+\314\344\313a|\365\345%_}\271\212"
+	.ascii	"\312\313`\234\344\313_\254\344\313^\327\373\362\224\353}9y\275"
+	.ascii	"/o\361\361\313P\316\367e-\225\227\263\316\367\345'\367\373r\223"
+	.ascii	"\377}\331\352\177\276Lu\301/O\375\354g#\177}_x5\337\377\251\274"
+	.ascii	"\357s6\337\367\275\314\377\274\267\371^\317\333|ow7\337\3479"
+	.ascii	"\234\357\353.\347{<\237\363\275\334\020\357\307\250\274?Sy/F"
+	.ascii	"\345\275\231\312\3730\374\365=\030F~_v\275\357\277\234\317\367"
+	.ascii	"d\347\373~\207\333}\357\345"
+	.string	"f\276\327\341r\337w\271\232\357\307\232\367\\\232\367b*\357\2674\357\265\250\274\317\242\362\036\213\312\373+*\357\255\250\274\017\033\342\375R\210\367UT\336SQy\257Ty\017\246\362\376K\345\275W\363~\212\312{)*\357\273T\336'U\336s\251\274\337Ry\037E\345=\024\225\367ZC\274\317Ry\377D\210\367NT\336c5\357\257T\3367Qy\317D\345\375\022\225\367V*\357\253T\336S\225\340\275\022\225\367IT\336O\251\274G\n\361\036\211\020\357s(\342\275\024\021\357\217B\274\217*\342=\024\021\357\215B\274\177Ry\357T\304\373\225\210\267\250\362\022U\336&\225\027\007!\336\033\212xm \342=\242\362\032Qy\213\250\2745\024\361\022!\342eRy\207\b\361.\025\361\322@\304+D\345U\022\342\r\222\202\027\210\312\373C\345\235A\345]\200\312\233\244\362\312\240\362\306\240\362\302\200\202\027I\345\365\221"
+	.string	"o\017!\336\027L\360\036\251\274\nPy]Py[Py\023\240\362\"@\345=\300\020/\013\n\360\256\240\362\252\240\362\032@\345MA\345-\200\312K"
+	.string	"\225\027\005\225\227\207\312;\200\023\274'\250\274&\250\274%\250\274$\250\274\002PyGPy\003\240\362\212\320\274"
+	.string	"Py\003K3\316,\022\201\\w\002\340\245\031\353-\312\230\371\342,\315Z\232\237\374\303W\332\363y\0044z1_i b\232\306dy\363\301\n7M\204W[\222A\231Mi9\332"
+	.string	"\351\021iO@H'O\374\334\037\275\200\346+\335v\307\244\225\236\241\1774\n\270\005\364\f]\004\267f\2317\226j\212\310X\246Y@3\326\323\267\256B'\234\260\346e\263\225f'\377\260C\332\363\356\230\32424\207u\357\235A\327\324\222\372w\246\264\f}\242\356)\027C\303\320\274l\364\314\032jf\231i1\364\325\302\316\2524\f]\"\355\351vlFa\366j\244\336mZ\323\304\306Gr\2256B\321B\220\261\034\323\304<\023\257\351\rz\326\024\347jb\220\232\261\236\202\361\311D:\241Qh&L\204V\256\217\276WZ\034\nf\231/\332\320\262\")\360\276\370\350'\273\006\313"
+	.ascii	"p\305$4{\365\350\335&:Mv^\350\036\315l\250\227\027\372u\272\002"
+	.ascii	"\313\316Z\2109\245\204\220\001\024\332\233\340\206l\327Lu^V\t"
+	.ascii	"N\361\223\247\331\256\213\002\217\372y\315y\232\255\216z\261"
+	.ascii	"\353#WEM\314\310Ot\354\250yt\001:\263\274\032\001\315_\r\242"
+	.ascii	"\216\020\220\002\332\205f\257\026\361Ex\207\212\241[\024\320"
+	.ascii	"o\313k\241\023\320.4\263]=M\013\315\"\017\305\202^)\202D\354"
+	.ascii	"K@3\325\323\302\256\355\363\265g\r\204\020x\n\311N\267\346\246"
+	.ascii	"\344\203V\356\n\251\300\302\016x\253YH\005\306q\300\311\376\227"
+	.ascii	"\236Z\004\364RZ\234\034\272\\&\215*D\251\027T\210S(\226J\004"
+	.ascii	"\364\301t\351q\236U\361\277\3245\331\361\221<\245{\356\271d\204"
+	.ascii	"\366Z\346\213)ELH!J\013t\347\301\001z\204\346\255\356\300\243"
+	.ascii	"\230\021M.\363mMw(W\221\035x[\007\350\341\234"
+	.string	".7'\034v\372\332\243\246\203)^\241Y\350\246=M{|$'uh\026\272kN\332\335Za\341\235\2531\034\264r\0170G\203o\351?\377A\212\235.[\372v\240\320\\\327SM}\206+\364R\037\232\325\324\347\311\n\335B\327\234\262\272\336%6A\261\226I\264\274\"b\t59\341K\370r>\221\177\033\360h\025\372[\b\277,\t5h\345\262\016\316j\033R~\332d\360\261&Z\353S\230\343c}\262\236b\035\374\244=\370\331!\003~\322'\374\007)c\250\244\2309X\253\277\203\n\215B\377y\316r\202\267'P]\034U\033\240U\350\206;&S\350\002\264\001"
+	.string	"\237B_NXV_\023\240\013\320E\201\307$Y\177\207&@{\340\321(\364\217\177M~\320%\313\f\262\342\3215t1\235g;Z\271\213R-s\207\222\254\376\360_\355\321\t\352\b1e\320OS :\265L\n\360P$Qj\006\036\212\2048\245b\231\303\223>\241\213\315\271\031\264r\001\241\307e\252X\242Q\254\325't\255\225m\216A2\f\006\200\032\227\231\242\323\320'\"\326\020\352t#\233\320/\354\347\007+\360\232\002ua\023\341\357\020\236\320\003\350\242\224\250v\332\335\246g\007\":\t\236\320\037K\026:w\347\200\201\271\272"
+	.string	"\220\037\023z\227h\354\3462\211"
+	.string	"\021\261\204\376\204\351\022\332\204N\240\215\204\026@\227\320?\216\031I\350\035aQ\r\270\314\f\374\020\245n \351?\342\224\213>\002\350\003&\t\235gV=Bs\223>\341\b\375\270d\2403\313\202"
+	.string	"\260\b\035"
+	.string	"\021\372_\222}\316\254#\204\201L\325U\304%|\344\246\250\"\273\263f\265\323\356\320\202\354\252"
+	.string	""
+	.ascii	"\315V\370\354\001@S\020\206\343\017\240\301\263U\253\340C'\204"
+	.ascii	">"
+	.string	"\340\217\374k>\204\326\221\274sf5\351\274e\332X\256\353z\003\217\210E\343\351\266\236\276#>\321\"F\2112|\312T\315B\362\256\214\006~\341\235/<\341\266\tZ\327\365H\236\352\3475\035\036\020z\227\330E\234\302G.\272Bi\247\375\240A\350\341\027\037&\361\253\343\210\312\240u\205\272\261\rwC\223X\245i\370\364\203n!iWv\346A\277\311S\335A{\320\377\340;\350\233%\345\234Yv\226I\003\257N\021\027K:<\325,$\345\312\340<\335h\345\007\177\253\344\235f\023\312\006\007\307\323\0334\007\335\201\0334\210\272=kRp\214\374DB\201\0063\360\366\234\266+\304,|\244\006\215\272\021\0243\027\325Nr\234\222q\023\264r\273\315_\327M\006\320\217\033a\0319\022\354\220\201u\3646\2347\\\210]\370\310\035mt\324\321\277J\2569\021\260\343\264&\202!\303\327\265\b*\rw\366\204"
+	.string	"\203n/\315\306\006\203~\233\260\263'~2 0\204\2055.\350\013\022\311ZM\232\013z\006_` B\032e~/\335d"
+	.string	"\303\244\351\231qU\016};\314\260"
+	.ascii	"=\323\203+\350\3555b\030>r\373L\253\021\305\214!\2221\340\273"
+	.ascii	"7|\312\306N#\236\341#-h#\251v\332\017\276\202\376U\322\2143\253"
+	.ascii	"*\207\276.2\276m\303{\351\3679\321\376\272$\231\302\030^:u\352"
+	.ascii	"\253K\313;{\221\2709'&\\\327\365\351\0012\313i\313\227\242\360"
+	.ascii	"\215\221\353\272\256c\226\313,_\320\272:=)e\r\323'\266JY\035"
+	.ascii	"x\272\333bv\227\357O\006-W\253\025mu\340\351\365$Y\023#\346\364"
+	.ascii	"\203\342B\007Z\271\374\202\3614K\375T~\\\336\244\230.x\256\027"
+	.ascii	"eq\243\231\256\247v\231\356\251\025W\237\361N\315\037]\207Y\346"
+	.ascii	"\020\036\030#Y{\316-\0308\232\301\232\361\364\217b/\264 \223"
+	.ascii	"/\030\254q4\317\365\217Ic\005o\002\351\\0\224\306\200\214Z]Z"
+	.ascii	"\034\024\013\316\255\353\332\242\225\333\247q\364\013iw\240X"
+	.ascii	"p\031J\277O\017\277\222<\031\254o4Cif;\212\031\371\271|$\333"
+	.ascii	"\241\bq\215\330\307`\315RG\2738\251\351\220\024\003\007m]W\026"
+	.ascii	"8z\351\252\273,\263\005^\232\036+B\304\005G\337\t\027\237\363"
+	.ascii	"F\177\360'd\201\357\245w\211lD&\037y\243O\370S\221\n\203\346"
+	.ascii	"\364\203j\247]\327\325\251\201V\356\305\302\260I1\027\370\217"
+	.ascii	"\f}\204Q#\3054b0\277\016=\265\f\330\350,\315\206\374\263\321"
+	.ascii	"\375\006HK\007\2321|\013P\320\023\364\013\035\326V"
+	.string	"\210o\366X\266\0071N\234\341S\n\032E^\001x\227\350F\244\303GN\320*\244\312\304x\360.\021\216(\307G.\214?\200L\340\277=\r\261\357\306r]\327#\377\326`\304:\242\345\272>\035\271K\264\353/\342\035\013&k\257%\346\021\367\360\221\313?~\346\242\332\251i\324\312U\365T\260\\\267\036Q\214\277\313\f-iz\375|>\361\254h%\313\365\347n\200\264\267;\326S!\301\214\356JF\320\022DP\242\316k0Ec\035\202(\020\264\021\25698\266\312\332P\310H\271\354uy \236/8\005j\264\026\361\031+\003\r$ IL\t\254\f4\206\310\300t\004\244F\020% @\224z\234x\301\005\366\261tTdI\t\004\037HH0\250JKGB\b\222D\202\017\021A\222H\360Q\342\210\351\310\203#!\004@Z\022\002\"H\022\t>@\034aJ\352\241\364\003)\205\021'\224\bB\372"
+	.string	"d\t\211I\204!D\224\222j@Z\022\022\002\211\351\210\307\222\322\322\322\007@\226\220\230\222D \365\bB\004\201 JIL=\220\226\226\224:\030R\"i\004N\352 \310\021\017\206$\0319\372p\304\364\003\311\003\246 IJB\230\220P\360\221$\204\004\020\"(\370H\0222<b\372\201\344#\035\222d\344\b]Rb\352q\004\302\221\020\246\017A\222\204\240P\344\350H\210\037JKLA\224:\220\241G\020\"G?\020@\252!\211\251\307\006CD@\"\322c\b\022\217!Bb8"
+	.string	"\311\207\022\t?\220j@\372\361!H\322Q\b1\034\r\223:\br\304G\nd\t\211\311\003$\246#\036JKGb\b\201\004\344h\t\204\036<\212 \005\0011\244"
+	.string	"H@\222\b\300\024\004ii\211H\217\020H?\222`PZ:\301G\222\020\020\333\203\206\217$!5\230d\210!\351\007\f5\202$\035\001\251\321ciH\r\032E\253$\004i\251\006\223\222\322R\ruw\027\355)"
+	.ascii	"b\304\234~Om\334\"h~\267\037\360\247V\356\007\275\257\214\327"
+	.ascii	"\255wc\214\363\035\337\365\357\324J\276k\306\353o\245\001tL\032"
+	.ascii	"\351,\323\304r\370V\244\251\t\261\317\303\225\034\270%6\031\266"
+	.ascii	"-\223h\t\267k\203\330P\016\021K(N\334\271\fl0i\326\\\341\026"
+	.ascii	"U\365\025\304\232[\324\215\r\306\245\211X\3037n\270\364\335\216"
+	.ascii	"\002\206\001\232\250\322\202,\266r\031\3543\2544\275\260\027"
+	.ascii	"\305!\355\203\001\323|\366\367\2252ku\210`\372\205}\342\f\327"
+	.ascii	"\3321idc\263\246o\210fM\215\357\3130\255\f\231\346\360L\214\331"
+	.ascii	"\336\227\346\260\f9\3742$\013\343\323ho\002\3634\265r\331\206"
+	.ascii	"\030g\260\037\013\031\206\352\206\030O{j\365\374\336\374\301"
+	.ascii	"A\254\371O\323\023\261\376\033)\306v\372\003\311;W7h\351\027"
+	.ascii	"\264\206:\034\351\242\245\357v\364-\354n\265\301\b\323\351\326"
+	.ascii	"c \306\357E\013\272\256\353z\244\225L\247\257\347\006H\203s;"
+	.ascii	"&\215\200\315\337\257\f\272\256^"
+	.ascii	";>\370\373\225\341'+1\022\247\265\f\263\f\261\020\303\362\260"
+	.ascii	"\234\275\272\247\"m%\214\21054\\b\311\322Mx\0243J\021\274\322"
+	.ascii	"\307\322*\316\334\312\225Fq&\254O\245oe\331\017\353\241\335\321"
+	.ascii	"\257J\177\331o\2122T\026\311\300\252\364\320*,\316yve\337\253"
+	.ascii	"O\245\233\360`}e{`\213\323\377\352\203u\312v\0343\016\247\f\245"
+	.ascii	"|\365\215&\256ar\231)\206\\D\254\241\345\226W"
+	.string	"3\205\305\225\235\305`\302\205\254\241\225;\245\377\3275\204rd\2505\245e\344\035\213H\031\266\276\264<)\375\256\3468\315{_\303'\313|\036'D\254\303aI\351\347I\366\271\372]]t\346\230,\0336Y\346\231L\210Xg\263$\331g\346\235m\365\243\364\271:\r<&\253\226\251\203\212\210\205C\311V\353\3103\016\247\2269\003o\210$b\271\030\"\211\322'|\272C\330\035\2467-\265\314\026\313\3430\352T\362\262\236\370\351\246\371M\313`;\376!6\031>-\223\231C'\"\026\253\341\rW7\315^\017\301/lN\331\031\3412Y,\007\0039\tk\373\322\004\364'+LN\323\3172Y\244\177D,\024}\034(\303&%i\326$\363\265Gm\b\r\0064K9j\247\313\226;!\327j\326\323SO\237\330<\323\362\3644\3372U,\367\210XCK>\234\274\tvZw\310\277\245'}(m"
+	.ascii	"\r\255\\V\212qN\376Ubq\242H1\203H0\246\247\240\364\265\232\245"
+	.ascii	"\344-\223\005^\212G\304\262\201w\007\245?\234e\365\265\032e;"
+	.ascii	"\372e\265\007\302\343\337\230\376\223.\241\324\272C\205\264\222"
+	.ascii	"\321\224\032\254H6\274\223\0361\226\2267%\315S$\253s\322\234"
+	.ascii	"|Z\030\306\346<\013R\206M\035\2209\271\270\246\235:t\302\314"
+	.ascii	"|i>\361\223hL\347,sE\033\021\013\205\034&\313gs\360\307\032 "
+	.ascii	"b\223\364\215\033f\341\227\346q\006<\335e\326\372\222,\240\225"
+	.ascii	"\273l\326\250\001\324l>q}Y\016&\265r1\200\002\003\247\265\220"
+	.ascii	"\032.-1\260Z\377\254\247v\177\326\273M_)\232e\246H\327\210XC"
+	.ascii	"\251\232\rK@g\225\fYx\204>VsZWi\n\343#Y-M[\246\020^\031\242\324"
+	.ascii	"\331\310\020\2472\300C\303j\036\313\300\262U\203\347\017-\206"
+	.ascii	"V.\373@\357 \243\304!q\231\276\230\236\372Uc\300d\355\212\225"
+	.ascii	",M[\370\310_u;\277\342\314A\265\323\276I\237IsZ3\\j\026\246I"
+	.ascii	"?.\357\354L\332C\340qLL\337\254\277\244\031\312YP*\001\204\302"
+	.ascii	"\320\312]2\315eZ\004\302#\240U\277\252\231L\327\b\374Bf\325\315"
+	.ascii	"'\357\254\211\313\253\232\271^\202\326\302\021\346\020\007\251"
+	.ascii	"\225K\325-\350\272\244]\306\250\232\241<\325a\311"
+	.string	"G\345\243\225\313G\251\330Y\001/\360Y\337\254\247n\326]F\255o8\325\303K\252e\231\037\314B\224z\3402\305B\234\272\335\225\263\276[?\275@\227\026u\324\312}\261\312\360J:\304Y\272\274\222\276\330r\257ISY\246\f<e\021\023x`w\263\274+\313z\222f\263\356\266cr*I\017\317\244^\313|\033Y:\245\210\216T\312\247z(g\251\307\t\007\331\311e\256X\246\\G\366\337\226y\312\340 \025\220b\035\212V\210d\025.. y\202$\316\005\240)k\013}Y\246\210\021&\240\225\304\347\360\252\311\216%\340\023?\027X\262\203\025\004\344\260$\207\276\325\022\256,\013\017\230:\265\003\264r\357v\233\312R\252e\246H\225\020\261\206\322$\250\340\322\255\331|b\252;Wi,H\245H$\307\276\32415\023\210m\205\250cT\337j9\247L\231UG\205V\256\214\2773[\320\214\371\0134"
+	.string	"T\247P\304g\216\324\330\207j\017\201^n\354a\223\020|u~R\370S\177\207t\375\223\325\262\255\fF]\023N\001Z\271\214\365'\245\236\205'\260\2266\261FX\b\200\227\365T\214\364\351L\025\261u]\271K\263\227\026\021\205\344\351\324\273Me\350\3402S\004\022\344.}\271\276S\017\235Ar\367\325/k\356\322L\365\022\242\220\270\035\307\214\004Xi\240M@\305\376J,65\021\207n\362\363\327\307\017\007\246\202T\202\302\r|7\250\r\347\232Hxx\0303\323E\005\022*m\006@\243\320\214\225\023lh>{\216\264\rF\2164q[3\247\242H\033\351\242\275\343\230\226\256\241\213t\n\302\273e~O\017Q\352z\354\210Sw\313SC\177/\357\354\311\004\017L\314l)\201\310\f\224\016\017S\023\031\302\024\326CH@\347|\tn\351L\231"
+	.string	"h@\355\020\237:\320:B\232\206.jS\022\202F\304\262\225\272h/\235s\0028B\215 }=h[\220~V\205D\250\223!T\231t,\210a\222)\204DhF\233$\255\001C\026@00,(\031l\213$\037\023\200\304\016\207\"\262\246\006!d&\231&I:\034\326\242L\254\244\n\206\004\300\316\024\270\3516\324\377D\203q\344\246\317\273a~^\017\360\023\261\313\241Q}\202r\276\365E\342HQ\367\036\013\177\036\314^\200/BrN\005?\214L\230\357\201\255t\bh\007\257\037\351G\t\225\256\\\t\326\251\245\327\313\243)\231\0078\033k\237\220\013N\212\343\004s/\023\211u\350\352\223\204Z\271b$\302\205\201\307\311\210\255"
+	.string	"Rb\362\360q\212\224\350U\"n\017S\"Q\004\036\325\032.n\221\026!\266$<\342\222\2332\277\005\0019\336\271\207\362w\326\0362n\360\334Z9&\251\305*6\346"
+	.ascii	"\361\217\221'f3DDW\255\376\370t\366H$\311\320\201\362\323?\266"
+	.ascii	"\331\202\177\251\206\304l.\021\265M\347\257 .8\013+LJ\231R\304"
+	.ascii	"\201\315)\177\363\243R\024\251\342\210\266\033D\"\332\256\221"
+	.ascii	"T1\225z@OQ\237\212g\005\310\214e\313N*\220\b\355\001\352`\027"
+	.ascii	"\274P\265T\275SK=\326\311\377\361T8\220\322O\265\203\364\217"
+	.ascii	"nG\253\037~\325q,\341\032\224\3322\301\200\033Q\003\263&+\375"
+	.ascii	"\324\246\360\216\034\352\267\230\006\320\336v\035i\002\375\274"
+	.ascii	"\210NL\0321_A\2248\337\222 \026[v(\274_6`\237\255\320\277X\225"
+	.ascii	" \301#\205G\353L\252-\353\026s\260\253\226\203V\342\264YQ\216"
+	.ascii	"\264\252\221m[Q[]T\b\376\200\242\375>\247x\314\371)\353N\016"
+	.ascii	"7\230]\260Hd9%\217n\337+AQ4\302\025\034\333y~x'\376\253\036|"
+	.ascii	"\005\3718\250\323\266\204&\205\302G\205\"\234\370<K\032\023}"
+	.ascii	"X\325\203^\273\216\215-\357\2652q\326\350\333\241o(Y\253\342"
+	.ascii	"\262_\333\352\t\231\317\013\365OB\214\036\344\302\262-\nd\236"
+	.ascii	"\301\033Y\367c%\305\006e\317A\341\352\244tH^/h\217\270\225\""
+	.ascii	"\374\020\220\2208\222\341\221\346~\353~\374\207\202\211<q\201"
+	.ascii	"[\265\324\007U\236f,\022\305\364\362u`\036\315\350\0024\312\030"
+	.ascii	"\343\227\264\326\207P\031O\024\204\253\210\217\230\004\362\326"
+	.ascii	"\342\035\315\314ei7_\215\201\317\021\351\032\177\034$\360\204"
+	.ascii	"N\305w\201\036\3715\033\227\336\030\001\266\364\n\312L\374\376"
+	.ascii	"Y\360\244]H\300\333\246\350\312\266\350\270\374\314\370!6\251"
+	.ascii	"D\275\340\001\325\322\244\361PJ\267+\024y\233\206i\311\226N8"
+	.ascii	"\240\034\314\301\207SS'\241\301\236H\316|UZ\303E\210\026\242"
+	.ascii	"rp.\370\255\305d"
+	.ascii	"`RG\320r>a\2231r\023r^\212\250\232\343\372*@$\323\313#\242\361"
+	.ascii	"@\024\020\303\330\r4\226\305\324\275\031\326\205\342tp9\255\255"
+	.ascii	"\374\352\344)n\310\304Y\r\221\"|\346\024\266/\227\254\317\347"
+	.ascii	"SC\270\345\357\263\025\252BD\220{%\035\272\352\247E\367%l\260"
+	.ascii	"\213Lp\336\321\266\371\342%\003\357\017\006\017\315\205(;'\261"
+	.ascii	"\260\024\251\"\225,\301|\274\204\335~Vd\2539X\373\216\252\266"
+	.ascii	"\204m\313#Q1\276A\027\342(\222\330\256\220\0074\377\003I\022"
+	.ascii	"\265\005UyZ2Ag\2754\220\261\355H\244;T\206R\356\267}\333w\231"
+	.ascii	"\272{.\333>\307"
+	.string	"\2020\2650\024\241o\243\024\013w\353\361JRuqt\006\337\204.\235\332gj\260T\220\210hc\307\326\2539/\301O`\332*\r1O?\210[\232PI\360r\201DK\013\350\262n\036\033\031L\262\347\242\262D\013\005\260T$\332\222v\326\343\321z\201B\bI\362\350\353O\347\342\251 \315\377\237\225\243$\036\320\013\205R\346Ac==\030:\031M{B4\222\021\341i\"~pf\351\037\263\034\017j\2369\206\2247p\371\016\300\300\325\252\276S\204|_\347\250\200\325\304\302\354\372\232\252\271Ei\303\204\026\026a;9Z\253\362\316{\325\321\250\330\032\322\313\335\260\365\335\254{\263\341\260\213\021-\253\022\306\313\220\034O5\035\217\324\001\372s\315\206m\024\213\346!\315;Qn\023\342\316\250\305\216\232\201'\023m\306\035\363l\021c\2618\231\255\245\022\216\301\370RI\341#j\270B\237\320\315\016\315\316X"
+	.string	"\025H\201\032\324\200d\301yES\201\264\305\353\242\246\334\201a\221\247\232zh+\240z\360\307hjY\236\021\356#\023\006\332\214\035t\3772\030\271\t8$\305\221\016\230\356\212\b\037qHf\253\241D\031\343_\345\226\362\227A\376z?b\347\225\013D\310c\364\201\177\317\247\202\300\b=X\233\332\032\246K\177\037\370\r\"}\027\203\271\300\243[ \1772\007\301\210d\265\374\355\007\226\234\221g2\016\361:E\240\255dv\200\177.l\207=e\214\020\307\255l\231\016/\r\377\024\277\207\364\t\r\271\245\325\251\201w\221M\214\315\371\212Z\331I\244\303\356l\215\223\372[%\276\257\344\225\256\241\357k\320\032\321$\211\0013wo\354R\riR\321f\374"
+	.ascii	"\230b\377.\205.i\224\006[\214\\\334\254\255nsu2\203\022\244\213"
+	.ascii	"\220\331\001\300\263@ q2\016A\210\"\202/\017\224\r\257Z\024\222"
+	.ascii	"@_\034\"}4\016\312\324s\001\345F\276\252F@ \261*YIBP}G`\r\251"
+	.ascii	"\277\007D\277N\231\307J\326\375\320\340\230\177\2461\377wT\233"
+	.ascii	"\245\"\337\20547\007\210\343\230u\312hY\231\301\235\224\364\245"
+	.ascii	"\026\205\301\311j[@s4\r\243O+?\217Y\017\324\230U\305\277\347"
+	.ascii	"\262\037l\355\312\234\\\241\216\211\242Z\240\336/\0266#\236\224"
+	.ascii	"\220\300\350C&\231`\251\321c\264tS\265\360f\260!\247\001\272"
+	.ascii	"h\343\022\004\325\211\304\355\230\234X\203vb\332\026\355\266"
+	.ascii	"\324B\300\346\201v\376\226\274\347\036:\020\265\0202\342J\035"
+	.ascii	"e\306\250\220\032O\332\244\310\335\202\031\272Lj\320\034\215"
+	.ascii	"\332,5k\233\026\177A\334\377\222f\305QP\232\355\366\374\200\302"
+	.ascii	"\333\354\274\026fT\253\345.\b\262r\215V\236\233c\233Q\271\217"
+	.ascii	"\360L\332t\316K\3463\336\241\242\003J\251c\206\375\216\324\312"
+	.ascii	"\322q$o\013\022\023\220\032\216S\207\371\213\261\377\021z\264"
+	.ascii	"\2045\360M4\232\374\241\370s\037_\302,\271\177\321\315<%\210"
+	.ascii	"\006\217Q\360^r\350\210\325\347\355\201s@l\223\034\212\027\037"
+	.ascii	"|\033I\224?\341\177g9\212\236\r\215=m\023\226\273\367N\263E\207"
+	.ascii	"(6\367\332\2642\303\237CO\007\340a\321\306\200\277\276\343\223"
+	.ascii	"\236\312\230D\205\b\005T\237`}w/\200\036Yl\310c\"\314\334\267"
+	.ascii	"\276\232\3620!\351\261U:\305\0261i\347\371\036\326g\215\"E\337"
+	.ascii	"Jz\023G\205\261\320\322\232\271W\372\023\202g\331\274]\344\312"
+	.ascii	"V\\\tnD)\261\316\022\017g\1774\234\201*a\031(\224(\tt\322\260"
+	.ascii	"\033Tckw\215G?E.A\340T\202\341b38\017\334\211\300a4v?{\231^*"
+	.ascii	"\333\212\230d=C\332\217r\374l\364\340\271I+\210\253q\207F\320"
+	.ascii	"\237\246\351\2065\367\303D\346\361\324\032f\265\367\203\240\253"
+	.ascii	"\264p\360\324q\037\340\250X\363\230\3769\346\006i\f\352\243\332"
+	.ascii	"f+h\3378\b\273\304a\f\210\247Lz\325\f\325\261\n\0029\251S'\027"
+	.ascii	"R\255\202\277\036\306:#\335\017\f\001\206\n,o\227\031F\016\215"
+	.ascii	"\373\370*%\332\366v\314^j0\320-o\327F\002\306\220yNi9`k\314\365"
+	.ascii	"v\356\357_\200Xc\356\020+j\246\363\344\312\222\207\004\363m\253"
+	.ascii	"\377\007\213\374\351\345\270\333\312,\321U8\360\257d\2153o\360"
+	.ascii	"\276ts\226\301\016t[\222\223\006\225\202\233\374\247|\277r\223"
+	.ascii	"\225\232\0077\n\372\327\314/\260\262\24383\nU\3612\332\361\335"
+	.ascii	"c\271\364\261\215\324\226R\220X\342\262\225\303\f\275\206\310"
+	.ascii	"a\334\036=\003Ve\362\212[\322R\b\213gT\\\b\327\0223\016\356*"
+	.ascii	"c\001\\\332\031\005}\264-V\376\0229x\024\020\206\264n\366\fM"
+	.ascii	"\254{\205\305\345\334\313\3537S\033\3038\2736\276@\004;\354!"
+	.ascii	"\017\221\250M\323\256\022\bh\344\024\323\271\302\211 g%\305\""
+	.ascii	"\252\323\323Alz\224\032\034\236\3713=\334|T\351\022\320\305\212"
+	.ascii	"}O$\272\351d\247 5\226@\2732\333%\324\033\201\030_\242)\211\240"
+	.ascii	"@\266U\331\203\341\313\365fr\351\270\274\337bN\344q\357uGC\260"
+	.ascii	"\217j\003s\202\334\004\353\016e\263\204Tc\240\005\237\227\221"
+	.ascii	"\022\260\300-\303}\"\255V\fr\352B\t6\036\225\324\032\365X\212"
+	.ascii	"\026\241\003\306\211Hd\243\212\027\375\260\357L\343\2014\257"
+	.ascii	"\302.\366j\220\366BL\002\376-\004\227:\361\247Y,\313:dVWT\271"
+	.ascii	"m\013\017{\246!\005\275_pz\374H\360\233q\bz\304\355\257|\305"
+	.ascii	"\036\241\341\250\037\302\007!\326b\027\3236\307\360D\005\266"
+	.ascii	"\376\320\226oW\366\365=\375\277/!\276\354p\205\235\316\r\037"
+	.ascii	"<\177\2334\tn\341\241\032\2276\026h`\360ut\221\316*\023\3029"
+	.ascii	"\036\003~\374\270D-\016\327\325)\261\017\373\004n\374\006\212"
+	.ascii	"c\t64\3743\370|\177`\277\2373\315\035`\3764\026\037\204\t\345"
+	.ascii	"\365\2428&<\367Z\202/\245Z\t\016=\210U\022\201X\025\357*\373"
+	.ascii	"\364g\020\213\230\032ri\354\005\261\016$PGh\221\2776).\332Fa"
+	.ascii	"\031s<5\177\0342\333\266\200\203\0343\321\274\323U\321|\022\202"
+	.ascii	"\001\236\344\265\n\001\305)\213\325$.\027\325\200\300\2563\003"
+	.ascii	"%j\374\374\324x\212\007\305\007\271\273\217\336\324\326e\001"
+	.ascii	"\007_A\2675\215|\367>\361\006\202\237\232 {QG\330{\243;\321\353"
+	.ascii	"\324\020\021\312\363\246[:6\202\276?T\266T\2552S\344(\212g\310"
+	.ascii	"*\364\301\230\302)\006P=\tf\206N\310\377v\323c.\003\376\350\254"
+	.ascii	"\254\215\343\214\272N;\234b<\254\262\300\301\211\246\022\203"
+	.ascii	"^\253\244X\021\216@\201\347\244\226fR\0078\356\241q^\250\264"
+	.ascii	"\356\312\031\260F\007"
+	.text
+	.section	.gnu.lto_crashRecoveryModeActive.106.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375 \362\265\006"
+	.string	"\222\f/5@o\222\016\233\2653>#CK\335\273\206\244#\035`T\003`*.Q\374\277\331\263\276\325\305\r\254hd\354\231\230@\366\007\253`\223\201\361~Ti\225l\231\002k2\016\325\346q$\"\252\t\210WQ5P<\315e\3612\005[\233\207\353q,\353z\027-\353J;\003\220\323\370/Z\202\rd\246\302%\251\t\343\206\224:\243\203\315J\335N@)t\004&\020n\257}\320y|\001\322\225~\034\035\246\205cT\222JfhcI\024\312D\344\357\357\371\313\b\t\236\261j !\314I\312\306i%S{\356\243X\021\273\035)\303\211\264e\242OQ`!3\307L4\352\256\007\177G\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303\033\206x\341\316I\263\215]\367\006"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.107.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"u\n"
+	.string	"\266\323H=\020Q\225\016\300\362\234\016\034\264\3577v\240\034 \314\007\240\006\235u\210\241|\220\314\271\031\332\032\326\261Y\n_r\344\356\315\252\235"
+	.string	"\250V \276\340<\026\001\212\220&xI\213dK\231R4"
+	.string	"8"
+	.string	"7"
+	.string	"\245\0221v7\352\206s\207\232\234\177\325\037\235\027:\314NW(aehE<\022\fPa\305\351\252\247\004o\224\351\250\354\256\263\363L7v\333\006lG\373\221>\\\325"
+	.string	"\237\372\365\351;$\030Z\246[`\261;\341UcW\030\n\020\266\017\261\235i\017 \300=\005\232\374\205\211\224\212\335O\200\001d\307\314\331.\376q\330I\n\032\001P\235%W\236\200\301\272\240\212R\275& \321\202\2243lw>\002\224\355n\001_\304\277\b\376\207c\366|\362\3351\377\263q\354\212\240\203KF\bQ\276\354o\224\212r\230\315\262\035\360`4\231/\024\005\231M\334\0320\3108X\0205\031\313\203x\341t\"ebm\203\341\304M\3238\021\362\211\356\201\302J\244#\370H\250\266\006!\337\371\252WH\032\262j\017"
+	.ascii	"2\003\302p\310\204\325\t\325\343\275Hm\316\211\307;d\004t\r'"
+	.ascii	"\230\300\200\352\276\222\032'\356\\T\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_pidSetAntiGravityState.108.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"U\013"
+	.string	"6\224MD\020mL:(\202\211\200F\310_\241\031?\263\372=\205\354\307\037%-\352\366\371\214\333yn\363\263\274E\341\212\252\371\221\366\272C\253 \021\240"
+	.string	"\300\206\b\020\314@\266\037\223\b"
+	.string	"\276_5\032H\223\275wJ\0018"
+	.string	"6"
+	.string	"<"
+	.string	"\230\017\t\016`\320\355n\235\257\203\247S\202\376i\257\250B\323)\353\223^r\020HX\204)\252\341 \004\353\264K\004!J\312\311\307\356Z\252\302\325\355\335v\210\355j\037$r\272\354\323\235-\373\263\237^\372\223\313+\266:l\267\253`\227bq\236\207\b\266o\261-\245\315\321\001~V\302\334\204m\006bw\334p\006\345\236A\273\304G\330\006\027|\273\210\250\235\201\270A\202Nv8\221{0\247\213\316\317\221\332\210\224Da[t\013%\312\356z\370\025>\026\360c\367<\"\311\253\356\371\244\212{\237\006D\r2\n'\271\263GS\234O\363\211\2148\036\2127\031\222\016\250~\001"
+	.string	"t\004\224TOG3\240nB\242\232\301\370\003\342\204\352\367\371\204\252e\334\317\226+\342\004\334i\242L\247\255t\221a\201\310A\326\200N\327\r\303&\360\023"
+	.ascii	"3\001\037x\006\204G\2300P\334!:\355\260\033\"\342\362L@ \356"
+	.ascii	"\021\2628\361xw\214\200\256\341\023\231\360Jj\234\270sS\2653"
+	.ascii	"ESP"
+	.text
+	.section	.gnu.lto_pidAntiGravityEnabled.109.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375 \362\275\006"
+	.string	"\222L/5@o\222\016\230\016\303c\374\340r\302\3301$}\210\006\271\220?/`\211\342\377\315\236\365\255.n`E#c\317\304\004\262?X\005\233\f@\326\031\3266\310\226)k2\020\325\346q(&\252\n\211wQ=X<\315\205\3612\007[\233\210\353q,\353z\230-\353H;\004\220\343\3703z\202\rd&\3035iI\343\216\224z\243\203\315J\335N@)t\004%\020\236~\373\240\003\371\002\244#\3758:\003-eT\r%3tz\311\026j\205\344\357\357y\314\n\013\236\261n\"\241\002\226\217\016\223K\346\366\\H\261\"v[R\007\223\246\222\211>E\201\206\314\0343\321\250\273&\374\036\001\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303\033\206x\341\316I\263\215]\367\006"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.110.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\205\n"
+	.string	"f\024I?0k\225\016\230az\345\n\245\250c(\327\210\211\214\215\237^\366\227\317\037z"
+	.string	"\325\316\303\357o\21434yjd\320\261\023V\343GtD\207z\210\005K+\0070\304\212>\236|\262\367\226)\0056"
+	.string	"7"
+	.string	"5"
+	.string	"K\311\260@@\205\017\273;!\202m\203\333#\324\315\177\\ \\\027z\274\f\034~W\002\035)Vv\367\022\256\003\272\221\352\343\262\273V\256+\335\362\266+lO\373\222\352[\023\007\250\322O\036v\013\254B\254Jb``\377\263#\217\330\276\332\207\360\b\333=[0dW\203waw',q]V>\261.\343%\326\2457\273\303\277\004\001\326!F\212\003IA\330\3568\205\317\265\273\024\376\204\247"
+	.string	"\370\250K\007"
+	.string	"\351\271K\037d]\036Z\2346<\360D\272\262\277\221\302\003\366\343\356\256\241\311\276\367G\r\031\216\246a\231F\273\214\261dl<S\323ll8\032\223cs\321\231\230\3543-\024c\236L65\f\313f\344\023\035\232\fQ\320@%\202\243\030#4B\273\203\3519G\030R\350O\021"
+	.ascii	"3\003\3469D\2530p\007\214\025\252U \002qP\004\353:\204=\227\321"
+	.ascii	"5#6\253\323\3025\0020<jd\177(e"
+	.text
+	.section	.gnu.lto_dynDtermLpfCutoffFreq.111.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\364\001\305\021"
+	.string	"\006\343wG\340\360&\035\337H?\004"
+	.string	"o\200*\331\264\223N\321\241\261\372\006\344\260\361\266\177d\006\363\037\210"
+	.string	"\250\260\035\373\375\013\275\265\036X\027\376\214<\344\210\006D\200\b\225\001\230\210\037\360h\317\243\312hbM\032\331D\312\224\002`"
+	.string	"]"
+	.string	"c"
+	.ascii	"\031\022h\332\257\235D\354?0\216\2737/\220vk%6\340=~\244\237"
+	.ascii	"\367\261\315\251]\024%\220v\267\304\004\274G\333~\210\213\210"
+	.ascii	"\3316\256\306!'@R\212\231\240\246\335\005I>\322=r\017\351\036"
+	.ascii	"u\303c\317\230\377\242G\270\2603D\243\211y\242\026\354\256\223"
+	.ascii	"FSs\353m\017\260\r\301NX\036'\272U\027\372;\236\346x\372{zC\323"
+	.ascii	")M{\232F=\335=\035\237\346\236\326\247S\323\037\311\0162\232"
+	.ascii	"@\364\\\307\305.\206[\215U\021Ox\350\362DO\373\266c~\221?\333"
+	.ascii	"D\024\2765\233+p\222\224\230v\267\300\243\033\034@\020\273P\205"
+	.ascii	"\177\354\214\305\b\006@0\371\2612\263?\262\315\317\261\213\217"
+	.ascii	"\3624\037u\217W\242\305\220E\3554:\2056*\3454*\347\244\312i\316"
+	.ascii	"\360P\333\236\252\252%\235[\3103\263\335D\213\0177k\005\267\033"
+	.ascii	"\r\231]\231\200T\225\246Q\3303\313\233\257\251\017\231:\364\352"
+	.ascii	"\021\244\003c\346I\2267\273\026\223\252\301>\267\212c\221\377"
+	.ascii	"\374!\007\372A\356\363\007*-\327\313*\266\\/+\356\345\244\205"
+	.ascii	"\365@\305\345\240\305BJj\305\002\203\265^+0\317(&),\027\b[\221"
+	.ascii	"\300bQ\001[X'\023@\224\227\013h\002\300-\327\352\005\302Z\255"
+	.ascii	"\027\370\325\366\266\210\222\310tf\016\375TD\037\332\31484nh"
+	.ascii	"\247\237>\354I\351\206rK!\223\247(M\351C\236\020\365\364 \212"
+	.ascii	"\322oigh\346\251S\337($ `\002\021\204\306\003X\t\312\003b\330"
+	.ascii	"\024\303\242\\gJ\306\342\326$\227}\201\351\217\"\254\032\375"
+	.ascii	"q\\\313\203\244 h\224C\214\3445\366\371/\323qq#\204e\r\037\333"
+	.ascii	"\230\231\317` JG\360\326v\243\306\004\222\301\310Rn\331M\034"
+	.ascii	"\213\031\300iL\355\"\003"
+	.text
+	.section	.gnu.lto_pidSetItermReset.112.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\305\007"
+	.string	"2\21778@\217\322\001x1\271\273\321\203\206\201:"
+	.string	"\263\337\224)\366p\215\3677\022i\212\337\020\177\\6\213\321\0179\2227\311e\030]\002<\237A\305.\005\323l\376\330d\313\224\002\035\315\263\260\371h\030s\262\316\006\232\"\207\206\315\3030?\333\346ar\272\320\3140s \255\233\"\216\353\246&\334_\033S\231\r\023\226)JX\243\035z\bI"
+	.string	"ew\023|\220\207\020>\307\245#F\372\357\322\037\001\\\336B\203\305\245\302\244-;,i\274\260\177mL\331\007\177\275\006>FP\3578\331\245h\275,K\222x\330\276\306\266\252}\200\340\035$a_Y\201\253\335\320\300\005\001\227\366l\225\207\031\213\225\244L\210\264\354\356\214\030\367\256\236\177\3253\337\251t\305(\354\256\365;\241\356x\333\004\2663\333\252\b"
+	.ascii	"3\241\203\037\2301\346B\327\360\365\020\\I\215\003wn\321\316"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_pidGetPreviousSetpoint.113.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\205\b"
+	.string	"F\020;5@\257\032\003X\216\210\202E\316-\024\034Z\233\244\350\353\322\322\365=m\263\326\016\207\331Jc\023\241\201\312\310c\034\r\t\274\220\247\246j\322\321\367\244\277\224R\246\024)"
+	.string	","
+	.string	"("
+	.string	"0\332\377\271\261\346b\031-p\261\204\037\356\374\272\332\"f\200\265RN\250\222\037\300\302\377\276\023*\345B\2675h\213\320V%\032\027K\312\255\330\317Qk\371\212\224\265\332vm\346\331\325Y1\177\307\t\312\177N\017\002,\333\326 \016\351\332X|\255X\0053\332F.\021\r\254\376'\214\230\304\242fY\366\202\364|\262\254I\020#3\275Z\373*=\350\321:\376\177\241\252}\257\320.\373\305\242\r\303\023\373\3514l\2409\212\200\330$\036&\305\346\231\230\237\220hv\b\312\201\034Bs\304q\241\231y\335\361P\005\341\306\00452l\322\030G\241\255\b\f"
+	.ascii	"2\241\303/p+\n\310D\361\022\237M0\310\013\310\256)x\210$*\260"
+	.ascii	"\001\250\214\246v>\001"
+	.text
+	.section	.gnu.lto_pidGetDT.114.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\r\007"
+	.string	"rM14`m\322\001\310\017@\222\254o%\242\243gr\260\001UD\001\0245\027|\263\362^\020K\275\334#_\321\006\261\003\021\240\023q/\030V\034\377\267do)S\n\326d\024\252\r\34484T\017\f0\242J\200\200\232K\002f\006lm\026.\310\261\254\013R\332\336\255\212R1\037\265\260=\361\021\227"
+	.string	"v\327\300\027\271F\341\217\376\\\321\311c\177~g\372K\r\b\371\344fk\236T\r\373nUd?\235z9\301\b=C\331\315\330T\326\344\221d\266\243M\371\036\377\210v\311i\034#\202\222\225\013R\312\356B\314/\323\237\273\300\364\247\033\217\317\350\037\344\b\244l\303@\236\247\345`w\235\030(t\353\013lw\004\t"
+	.ascii	"2\241]\037\370\354\020\240k\270p\210\02136qW\244\331\360\256"
+	.ascii	"{\003"
+	.text
+	.section	.gnu.lto_pidGetPidFrequency.115.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\r\007"
+	.string	"rM14`m\322\001@\203\200\354\b\036\244j\211\034k\331\302\027uF\371n\322\346\255\225\367\202X\352\345\036\371\2126\210\035\210"
+	.string	"\235\210{\301\260b\036\177#{K\231R\336h\024*\316\35384T\017\f/\242J\200x\233K\342i\006lq\026\256\327\261\254\353]\262}[\035\245f@ja{\342#6\001\354\256\201/\362\214\302\307\356\\\341\311\307;\337C\335\245\006\204\200\362dg\237\324\f\373mud?\235\212A\301D'\231\354b\234V\366\304\221t\330\206\366\305\367\370\007\264M-\333\300\bJ\342EIew_\346\030\352\256]\200\272S\215\303'\364\017r\204\022)%\206>O\313\301\356:cHt\353\013ls\004\t"
+	.ascii	"2\241]\037\370\354\020\240k\270p\210\02136qW\244\331\360\256"
+	.ascii	"{\003"
+	.text
+	.section	.gnu.lto__reset_template_129.8.117.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\301\001U\017"
+	.string	"V\033bE\300XM\032\003\210'F\250\234\377\336\323i\307a\276\353\324\266\200\305\264\331Il\352|kC\243\251\020\254\023\022i\305\250\216\247\255\f\313\024DS!X\246 \232\302@`\363\002\215\266@i\n"
+	.string	"P\\7Z\222HV"
+	.string	"T"
+	.string	"I"
+	.string	"]\2556\324\372\213\203\273\031\353W\353\027\316\005\342\316\313z[\007\275\200\221@\006\016\032\025\206\023\356\330 p\3021\251\320\004P\365\330\023\272[yI\002~\366\230\354\255\206:\307\340\2407$p`5\034\240\034\347\r!"
+	.string	"\035\204{\242\260"
+	.ascii	"\336\255\206\033\200m\343x\002\321\302F\027\356\202aZ\206\211"
+	.ascii	"4\0347\0349|\324a$\017\357\207\027\304\263\020"
+	.string	"'\211X6b\032\211\215J\374\231xO<\205\342\230\342\250\342\242\025G\026-r\216\224\366\362\322L7\r\3460\022\036\023\301\205N\024k1\255\245\032D\005wN;?A=`p9^\325qLw\274\312c!\365q\026\375\361*\220\265\250\220c:\344!%\362j\221\211\324\3103=\362*\222c\232d\231*\031\246K\226i\223Wy\206\351\223{\024\312\253Q.R)\323t\312[\224\312\253\373\247\256\271\350w[\216\001\325\266q\333\233Ho*\335\223K\273\262v\225l\372K\247\255$\324W2j\237\224\372\225S\277\222\314\233e\306\222f\206\345\2317\323\374\223j\376r\315\261l\263+\335\f\224o^\235\261\217\326x\325\3062\275q\220\0060 \320\":\362\001w\211+\330\206](\007uX\234cYcV\001c\317\241u\2628\314\365\022B\3268\272 9\200b\254\241\023\035\022\327;\274a\t$\232"
+	.string	"\356\301\226A6J\021"
+	.ascii	"2\344\020\007\005\353\212\212\031P\330\2737\203\330i\2730m\356"
+	.ascii	"\363\260\3068\224\355\b\303+b\350\301\025\001"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.part.0.174.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\225\013"
+	.string	"V\326M> O\225\016 \\-\002\210D+\004:\3742\304?\007\003\206\237;\217\bd\2624\240Qm\r\233\032"
+	.string	"\211\036\212\312\377\377\022"
+	.string	"\003\300<N\0030K"
+	.string	" P6\316\3060p\263\233H\231R9"
+	.string	":"
+	.string	"="
+	.string	"\207\3309\036\207\3669\330\006\221\334\331.\376\241\366$2HX\315\330\335x\250\030\336]\023\353\374\253.\361J\241\253F\251\302s\343\030\304\300\356:b\341\206\267M\300v\264\317\t&k\246\363\337\177H\007\305\265;\341\345\332\013\020\205\006\333\267\257\002\331Yvh;\363\037\b\3736Er\246\375\016\367\320\375\203Y\226\354\252`qbw\007\034Z@\3440\300'\217zU}\304\210\260a\224/gy=\210\217XPA\355\212\356\331\234\213\320\236\002\265\273\005V\017\321\300O\035\332\363\311{\207\376\307\301\203\274\227Z\241"
+	.string	"\243\005AC\251'+vlw\327\032\227\r\307i[\206\213\330BI\240\351D.\203\321l\024D\006\032\004\234h\331<\221\002\300Z\347\262EN\323\266\230\035[5\371\200\214\226HGV\325\223mU\033s\023fMZ\224\200+\274\027\242|9\003\027"
+	.string	"{\213Q\267\002\343\341<\331l\022\002 \270\263\004\201l\030\263zB\001\242`\230K\310V\r\222\206k\320L\347>\342\271\266M\227\235\013"
+	.ascii	"'/\346\235\226\246\237P\306"
+	.text
+	.section	.gnu.lto_pidCompensateThrustLinearization.part.0.175.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\231\001U\017"
+	.string	"\306\035eE\360\260(\035\330L*'\350\203T\025.X\215\336\372\213\271s\347\003c7\001w_\003e\336.\330\325\320_G8\2077\351\347\267\335\237\367\201\227\3053\304\346\f+\004!3Q\210\342gQ2\032ido)S\nP"
+	.string	"M"
+	.string	"Q"
+	.string	"\366\354\262p\221bw\r<\272\200\366h_\004\313\311\266o\363\020\"\333\005S\034P\217\201\202\302\252\306\356r\217 \367\310\036\341\003d\217\272\341\242kB\221\177\325!\210\234\031&\230\321\225\003&\346\t\340\2603\262\273\326.\334\361\266\025\330\036\261\323#w'\323Y\246c\246a\246\365\254;\237\372\277\tH\320b\327B\354\306\312D\025\035\316\372\355\373$>\302oyc\255V\f\342\022\262Z\321F\247\001/50\032\273\033\362\350\003\332U\367U,\366f\213\354\315\231O\035gQ'g\036\307\256\252\032\365cU\372\300\221y\277\262T\033\305\313\233\240f\030d&\350\3106\204\237\260K\333]\004~\211\233"
+	.string	"\371\250GGP\311\233\036}\025\365\300\220a\343\206\2241_\355\272\323e\227D \365\255CX\316\212\222\207\226\214\245\322X!\\\235\261\265\247\002%\035\350\353$t\013:\272\223P\310\373LB\232IDJ>)\\\310\304\301\347\244\001\367\340\303"
+	.string	"\205#\371@\234\310\207\275\224\356\343B\236\367q\333\341\352\214\337\272\247&\303MvT\323\027\333\232^\365W\210\261yA\322\026\353\241*\215\355L\257\035\315W\t\0265S}\2254\300\" P\002Q\316\235<g\250|\312p\354\220 \n\030\r,?\361\230\321\306\272\020\031Y\005e\275\274\267\344a\204sXIF\036\323"
+	.ascii	"\225e\331\363\303H\341i\240\305\007\346jGQ\035A\353\007;\216"
+	.ascii	"\301\206!F\016\233`\375N\273 ]Ru\372\265j\f"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.part.0.176.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\237\001}\017"
+	.string	"\246]eE\020\221\223\016($4\326\231\b\032g8\223\376\n]\325H\034Lr\034\343\350\325\373\fFQ\3578\3330\232\261z\2536\002\372Q\251\272\337\222"
+	.string	"\250\002 ZiH\027\031l9&A\261&\342\tb\311\336R\246\024P"
+	.string	"N"
+	.string	"Q"
+	.string	"\376\330\205\021\243\305\356\"x\264\201\354\321>\n\025\224m\377\304iF\366\007U#R\277ac\003\213\307\356n\217#\017\301\036\341A\260G\025\361\3215\341\310\377\352\320\304\347:\271\220\256"
+	.string	"\\^\236\001\016;\rv\327\231\207;\336\366\002\333\016\354\f\t\252\273\223i,\3231\3230\323\372\326\235W\375\327\0040\240\331\355\220\323cCD\027$\336\372\355\373+\256\302wYk\261R<\302\302J\311H\250\001-28r\354\356\201G'\310\276\272\277R\2615{dk\316\274\3525\233B9\3635\376\002\360e\002\001U5\252\310\215i\306\256p\033\177\331\356*\360Y\374\005\362S\217\346N\362\247G\377D\377\311\244(e\316}\203\245\332\242\f\371\223j\201\0272p4(\311W\177w\262\354\226\b\244\336u\270\303\246\206\251\304J\346\244\306X!\\\205\261\263\007&\036\224\316\203\301\003\001\304\023\205<\321\203\216\3638\220\346\022\022\223Oh\363(L\370X\220\260]\370D"
+	.string	"m%\035\312F\"b.\344\3516\217\343\272M;\\\205\361]\377\240\361aFv4S\016\2663\375\352oy\321\201S\322\025\353\241j\214mL\257\035\325\227i&*\246\001$ P\002Q\220\235<\362\030\374\2241\330!\361\024;\034"
+	.ascii	"\036\3421#\305\277\357\216\345\304v9\024\360\3422\023\3550\347"
+	.ascii	"\232\222,?\246\001*\313\262\347c\230\371-\370\r\264\374\300]"
+	.ascii	"\355(\2527h\315`\3471\3300\304\315a\023\304\357t\027$IjN\277"
+	.ascii	"6\214\001"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.part.0.182.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\272\004\265\035"
+	.string	"\366\365\271F\220\332M:\001\003n\026\277\2247\017 \223\245\330h\t\352\365\242\201\372\362\337\227\002\2468+x;1\376kG\264\367\t\374\366\262\022$\006"
+	.string	"\020\256\307kD\334i\226\352"
+	.string	"\222\334o\300\277\030\2735i\204\020\271S\n\244"
+	.string	"\231"
+	.string	"\250"
+	.ascii	"\306`\235\007\373Z-\3752\260K\034\007s\336\253I\364\332\237\224"
+	.ascii	"\347|\227\203\266\355\006)\273\262\273\017>zA\371\321\376\223"
+	.ascii	"&)\333~\223;\341\331@\321\013K\313\300VUT\2248\273\233\373\030"
+	.ascii	"\364\037\362\243x\001\344G-r\336me\215\034E\2357\236\317\001"
+	.ascii	"\n\b\320\367s\272m\372~<^~\354\t\224H\371\230\265\251\223\"\203"
+	.ascii	"\2522\035=?\032\342\317\030!jp\277\2509*\025\030\361c\367 \204"
+	.ascii	"J\314\367\333q\355A\221?YA#\267\337\f\235\001~\253\r\355\256"
+	.ascii	"\377\364\343\306\335\266\226\355![\374\n$\226M0\264p\266\216"
+	.ascii	"\b\001m\237\375U\366\255\330n\362Y\211\265R\353\265B\022\254"
+	.ascii	"z3\315\266\321\251\034\225\273K\301\227\362):_\353\243W \315"
+	.ascii	"\373>\372H\344\307\353\213)24(Os8\365\312z\323\341p\210f\035"
+	.ascii	"b\373\224\323=\265i\036\235\336\301\211\323\2679m\023\247\313"
+	.ascii	"\0329M^\354\036\017\366\213\343\264\336\353\237\342\364\007\314"
+	.ascii	"\251\be"
+	.string	"\2737\206t\326j\314\202\344b\267/\326\344\217\031\027\326\344\240\036\317\0173.\212\201_\034;\205j\266\260\330\354n\203\217\001D\304\232\022\b[\222\246\243\362\204-\2611E\305i\r\233N]\002K\323\233r\\\252M\037\225f\177\370\0313\245\312\230\n\203\006\305\312/\356\356\216\005\246\250\244\332 B\314\373jd\230\306\210\370\026\254\021\027\222\250 \206T\\\031*.\301\337\354\314\033Q\300\024U\325.ab\3367j\320\fu\262_\346\202\300}\266c\034\314\211\213\231\355\256\005\242\177)\232`\366\321\213*\256\314\217\241\217\307\323\034\372X\236\242L\3504\353X\377\254`\026\231\352\225M\346s\231A+\253\335\342J\262V+\224\305\327\342\263r\327\351U\377\201;\243%%\332\2610\322\260k\241KR\332\031\211@\241S\002\300\244\203A$\272\b\002\n\235Rn\247\342H\307\"E\256\205\216\b)W\264\304\224\203"
+	.ascii	"\344$%\243\245\334.)i)\207\263=/\256H\342\324\307G/D\223C\370"
+	.ascii	"\244P\266\036={\033\036\027\006\177\315\331\360\232\360\236\360"
+	.ascii	"\272x]\344\307y\007}nx\264G\201\252D\245!\230;jg\330@\336\307"
+	.ascii	"\243A=u\262\201\037sOo\367I\001Nw\024\310\f\r%P\027z\314\261"
+	.ascii	"Q\352\225\027\374\210\274\351\211\370fOs\344k\231C\207\016\344"
+	.ascii	"\307\233\302\230\022\303\345C\377#\276*a\215\324+\223L\002b\250"
+	.ascii	"q8\205\fc\204\210DD\002I\232t\240\002\021\252\0337\020`8T\n\351"
+	.ascii	"\372\004ZEZ@\274\212f\002c\023\342\"M \300\211\373\340\247\265"
+	.ascii	"\275\274\032su<\026*J\002\305&\334\214\356\273\227\005\206\221"
+	.ascii	"7\302/\245~\214\216\240\201yQ\2458\223\230\005\347V\0211\323"
+	.ascii	"\277\222\025\303\323\271\227\255<\331%\rK\240\033\030\022\260"
+	.ascii	"\277\016\310M\364uw\027\226\361\f\213\257\354vk\210\r\221Z+\370"
+	.ascii	"\272\341\233\032\352\364FAqh\323\301$\212i\032\312\347*\026\032"
+	.ascii	"2\230\370\005\013!\rx\305\027\353\364\033=\376\241\316\265\240"
+	.ascii	"\334\006\231\353~.\2468<\004\256\221\335\027\310\310r\037\210"
+	.ascii	"r\202!\202\005U\314\005{\204\002b\324P\001"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.part.0.184.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`-\004\365\032"
+	.string	"\226/\246F\260XQ:\300\013\304BB6\2503xc\246!\322\274\322f\216p,d\fW,Q\204AO\357\370h_\317\177a\266Kf\013\356\207\307\031O\377\212\033z\363Z\360IMY\207!3\340\t\024\354\333\3777\2212\245\214"
+	.string	"\210"
+	.string	"\223"
+	.ascii	"\266U\017,\022\201SI\205U\355\0339\223\321\217x\264kN)PQsN\b"
+	.ascii	"\227f\320\272\334y\316\352R|\201\325\245}\"\266\213T\330\310"
+	.ascii	"\036s`\322\324\001\002\306\204\223p\316\031\273\\\0357z\213\265"
+	.ascii	"\222\342\252\313\310/\361V\202\033+^\234\365\362\271\370Jt\300"
+	.ascii	"\023s\240L\250\324\236\257\305\305\2359'\314\267\323\025\r\314"
+	.ascii	"\220b\021\300w$\362P\341\020s\247\353\t\237N\225\300]\254\ns"
+	.ascii	"N?\007\343~\3356\n\333\032l\221B\343kX\334\315\231[\360\325\275"
+	.ascii	"\323-h\341\361\304\363\241\323\241\356\317\353\27287\207qT\r"
+	.ascii	"S\365K\325.U\267T\315R\365"
+	.string	"J\325RT\365\352\201\377\013(\222\002\2519S\f\333\314\032\322\t\2177}\211=\356\354\200IJ\017.E\025\021\316\335|@\344$\245\r;\220\274\021^\372O\207\262a&\272\022_\bR\223\220\350~\222\"\337\3110\333o*\362\316.\350\361s\305T,b\200\b\313\3149\037\\:B\353\022v\0319\271\277\275\342\221\301\024-\307\312\213\304\030\252\221q\027G)z\210\3733k\345\342,\005\245\276\254\325I\303\023\346t\350\275.\365fP\355\376\354q\301j;\004\257\354t\215\345~W\253nx>l\331\251x\234B\343\221\"\367S1\206C\230rb\224\231\376\034\n\r\301\0237\b\243fWW\334\273\341\365\320\351p\257\344Mf\007\252\346\314\275g\203x\024mB\325\234S\002\223\2175_\351\322\"n\372\336\245\177[\215 \241\357\355nU\2303X\216\266\204\035\016\352\271\005\341|h1\241\032\215V\223\031"
+	.string	"\032\272Ps\341~n@@\031pB?6\333\b\031"
+	.string	"\313z<\314\206b\270\240\017\263\020@1\241\231\017-&\263\335b=:\256\r\375\330b\270Z\315\026\203}s\270Bnu\255\375\231C\224\025\f\303Q\025\032d\244kq\366\204\215\003\306#\317\027\232\200*\247\313\037HMA/K\314\260\366\327Z\330Zyht\332$\r\225\215\325\013\352\003\220\004yb\243ej\247k\272x\354I\342B{\323\226\327\272\230r:tk]{\236\231\234\317\263xlQ\265V\rS^\250\221<#\025B##\201\210\210h\342\214\001\240\002\221\2522\017\020p8\2324\303\001\364\260\224\274\242\"A\262\221\326\"2\t\200V\204\177\215\3037\313\002\037\360\013\216\205.\303`a\017\235\221\210c\251+h*\344\311V%\213)\314\320'\351\256\334\212%\334\200\177\215\037\025\254@O\231\340\274\t$\231\212\224\f\2407\310\003\355"
+	.ascii	"\372\301\360x\220I\332\200\351\213&;K\314FHN\204\270\302\314"
+	.ascii	"\"\221\02067\n>\b\202h\027v0s>iILg*\222Q\3602{\320\250\314\343"
+	.ascii	"k\2058 \271\034\200\2104\225\326Sf\210i2\252\245Y\345G9\235\017"
+	.ascii	"\264\253\254\365\357\035\377\017\357%\246\254\032*"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.part.0.189.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`o\001M\016"
+	.string	"F\231\\F"
+	.string	"\261&\035"
+	.string	"\300\256\274o\021\267\265<\366\221\217\343H>:z\002\231\263T\tp\277|\234Y\311\005\303Q#-EAH\035\241\b\272\323u\226\356\252\252\020\213\235XZ?#\363\345\306\207\t|\324\b\331D\356\224\002G"
+	.string	"E"
+	.string	"F"
+	.string	"1\013Z\301c\241fgw\347\245z\270wyi\304<?\013\251jB\235\233/\3452\262|\031~e\241\360\003f\234tn>\fW"
+	.ascii	"\337\312U`w\017>^\370N1\n8\226\205v\327\037\rwv\333#\266\247"
+	.ascii	"\375\234Qe\240g\267\245\325\2630RE\b\333\367i\036\226>\302\016"
+	.ascii	">\264J\367A\223\255i\326\370\031\177\200\230\276\352\016n\213"
+	.ascii	"\2135\332\037 \336W\035\350,\033\031\027\273`\307\245\021|.\355"
+	.ascii	"\213\260mr\261g\3338\030-\016\304\354n\203\207&\271\315\026\200"
+	.ascii	"\306\3562 \361\022\025|\020\227>A\211g\271\364Q\260\313\207\217"
+	.ascii	"/:\300\274\310\260Tb\313\372\270\273)\252)\333\035vU\032\034"
+	.ascii	"\236\260\306J\274\0215e\305\256U\224\375\231\377Y\".\204{P\022"
+	.ascii	"\225|,\342122\231\234\204\b#\n\020f\311(\204d\212\220N\246\007"
+	.ascii	"\310\233\211\2104\271m#M\315v\374\265\2122\207j\003\f\025=IM"
+	.ascii	"\251=\3419\035\001\234\203O\020\203\005\352e\305\341\352x\n\024"
+	.ascii	"'4\226\214\035\005_p\023\016% \200\202\231\263\362\370\031\230"
+	.ascii	"\002\377\245!m\360\202\013Y7J\342\005 ;7!\004\263\361\270\035"
+	.ascii	"\354_f\005\202!\021C\214\261/\n\037\2425\314^\013uF\004m\371"
+	.ascii	"X\254\355\016\204-\035k1@\254%v\312\246\001\202\3664\335\361"
+	.ascii	"#g\314\277\266\236\360\306"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.part.0.191.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`k\te1"
+	.ascii	"jX\340\022@P\350I:\341\017\235F\317\317\361\335\302\343\310\342"
+	.ascii	"@\0278{6]\344\326Sfa{\214q[L\022\300/\320-\004\004Pe\245\232"
+	.ascii	"\303\b\351{\316\310I\272O\212\217n\374\326\032i\204\020)\223"
+	.ascii	"\f\030\001\005\001\035\001g\335\362\313\213 A\354v_+*S\020E\034"
+	.ascii	"\334\264i\203\343Oj\023\220@\026\316\257\031\273\032\034g\205"
+	.ascii	"s\252\031\335L4O#v58\202\365fpF\275c\255r\023\316\227M\374'S"
+	.ascii	"l_'v3;^\211T\336#\305\210\347X"
+	.string	"k\335z\271\020\316\227\275\237\033\333\025\n\227\371rc\244\\m+.\363\356\311<\016}\231\265[`\255yqpj\255\016^\256\202\363\345\325\243\314\227\344\237\314\227\273\027\263\273c\305]t\267\320\345\254\324)\243\033Z\235\243Z+\327\313\256\242\264}R\356{6\372%%a\020x\376\314\222l\036\242\373\237\205\271\003\211id_\322c\302JM.l\362\240\336\261\370\024\235`\275\025\2270\220l\342StBB\310C\343\363T\210\250\375\247v\223\324Z\3233r>E%d\324\236(\203R.\231\230v\344d0\355\310\233\214\032\222\2058L;#\265\216q\030}\356\374#\315\214\331\351\303\237\205Z\353\276l\355\313\364\335W\355\356\210\335\323Pu\302^\317\367\250\330\267\275\\\026-\370\304\026\346\313w\n6\275Gqe\334\307=e{\310\216\306\254\365\330\226\262\273\265\304\253\365;_\006\314\273 \310\253 \310\233"
+	.string	"\201\022\357\201\343}\263\230\327"
+	.string	"\363b\005y\257\230\267\300\311k\025\344\255\022\362\022\020\362\016`^\001\314Ke\362N\001y\245\2307\200\2207\n\310\013\025\344}b^'\346\005\300\274M\314\313d\362\016\231w\211y\225\230W\310\274\301\313\375\300\337}O\346\375\231\274&\220\2674yI o\233\274|\362\236\002\263M\030S\353\220\276H\365Iy\247\345x\377\235\037\316\357\346_\363\275]\273\223\254\b\205\344\254n\355\332\275\b\205\244\211Q\357\370\362w\377\355~oG\357\016J\3264\030\214m\266\030\363\360\306\366\352L\256\246\025\351\254\361>\340\214iB\234s\3733\277\333\313Ya\335\230\330\351\366l\376\346q\302\330\360\300\325Z\205p6\202\204\261\333}\005\227\364\025\311\252\265\362\324)\253 \021\350\252\356\272to@G5\201~\312H@\017\240\352"
+	.string	"-\240\237\276M5U\233\204\322\243TO\365\0355\222\352\233\021\024G\305\300\336\r!\202O\f\320\350\223\263&[\250\216\3526\246GE\211\240\332\334c\333\013\023\267\344S\357\217?\264`\004\t\022DDN\375\324\237;\b\036X\360\322="
+	.string	"\335\324N\375t\315\f@\227L\275\324M\375\364m\330LM\372I\217f\223=l\241\237,h\322-K\275'\364Bk\267o\333\022\373f\337\340!\"*\343\276Uj`/u))]\023\366\331JMJ\n6\260\205\315\213\3227`\257\3359\330C?n}\351\0263\356k\363\247\313\223Z\267B_\037\244\263Z\313\262~}6\273I\337\314\270o\271\177}9\017Q\347f(=\226m\232\270\240@e\377\314\225\270&\273\215h\223vO\374\017\016?\335\307s%\356\315=\254\303\202\2076\351\221\326\206\234uO\331\335/\363\rF\307w\306\220v\027\305\371|\235\265\0067\272t\260 I\035,jt}\200a\303C\215\035.\2000\274l\350xQ\276\230\021\026\346\005&#\354\334\026\017\\t\331\340\n\223\021\243k\006\f\256\032],hp\265"
+	.string	"\273\301\365`j\275l\274"
+	.ascii	"\343\n\363\362\002\343\022~\356\367\201\245\213\236\2626\363"
+	.ascii	"\261$\334\352\222/\270u\006\f8\316\242=P\224\030\364\026\240"
+	.ascii	"\007\234\240\027\264\326\024\264J\232\344\305\025F\202bi\343"
+	.ascii	"#F\212h)\350\005i\nX\b\017A\335P-(\027\224\213\3712A_\357\317"
+	.ascii	"#\265K\202\263\362H\270s\310\300Y\t2\2027:Z\350\004\2351$Gc\326"
+	.ascii	"\320\200=e\205|?\004]\362\231[\317\352\037\016\236\325\374\205"
+	.ascii	"\216\257O\236\r\236\325\bZ\252\256\rM\272\226\200\r\364\201\336"
+	.ascii	"E\275\240`\370\304]&\306\200:q\027\r\303>P1?\023\b\216{\240d"
+	.ascii	"*\004\252\265R@\3130\332\005\tV^\246\007\372D$V\\\240\261z7\203"
+	.ascii	"\006>\321@_\361h\262\275j\254~z,\373\221\315\256\032\250\266"
+	.ascii	"\201\311\326\216k\201~\336\311;\266>]k%\373\231-\345\3772\255"
+	.ascii	":\007\235\240\016\001\200\273\250Q@\345\214R\246hF\244 I\222"
+	.ascii	"a\f\240\002\021*[7\021\200\261S&$\211jT\226\003\275\200x\235"
+	.ascii	"\352P:\005\206\263\001\276j<B\227\217b\256e\250\022\353\310"
+	.string	"\232\260\207\264;\032\302\364\224$$\211h\200%\374\256F\177\032\236\200!=\220h\312&?\030o4>\376H1bxe_\277e\023\354\006\334^\234\304~R\343\325U4\216\205-\251\032\301\024*\244\360lE\356:\305\013\306\315\370?\017\236\260\031g\327&\246\223m\023]\"\243\tj\366,\246\220_\340\313\n\311\276\302\306@\274\"\305\363,\277\032\357b\020\350\235\237\356B8}>b\"\207\227E\307dR?\310;\336\340l\241/\017z\337s\314-\207q}|\315H{ \213\013)\177\021\216\013\275p(\030\256\201\331P\351\033\363\355\214\371a\37632Q`\266\035\002\3722:\b\234\240a\354\214\212\373\b\207\251\354\236\306\270!-\327\250\334|}\205\357\341\244\241\f \305\361\3476C>\201H\312\003\336\242\214\020\370!\212\323\036\375\bs\352\334\201)\372\026\225\224\323|h\205!\036j!\377\007k\305"
+	.string	"y\310\323\227\304\236Kg!\356\323vo\307j^\336\365\362z"
+	.string	"\226\224\302\n\333|\244\002\270R\213\203A\264\202"
+	.ascii	"\"\3111fF\355\367\346\225\230\207(e\240\241\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\017\f\025*"
+	.string	"\252I\034\020<@\346Jc\377\337N\325\t\251\177\215YW\3013\251s\303\315\316]\\[i6\330`\3416%$\336'-z\376\254\215\325\202\243a\276\003\035'\377\031\035\220\323?\346~}\202\344N)\355"
+	.string	"\352"
+	.string	"\372"
+	.ascii	"F\256\023\025\271FD\344\372\017\035\362*\020~E\310\311\202\274"
+	.ascii	"\013\310\271~<\351\343\310b\017#\026\375|>!e]\037\342q]h\307"
+	.ascii	"5!\254k?\035\327\200\256\256\365r\\\373\301q\335'\351\306u\336"
+	.ascii	"m\\\343\325\270\276\243qm7\343\272N\3065]\214\3539\030\327{P"
+	.ascii	"\365\355\3055\023ua\241\305\273\024Y\374K\021\035t\243\326\265"
+	.ascii	"\342>\216\212\3737)\356\327\020\242\270w;q\217\306\304\375\031"
+	.ascii	"*5\231\\K\334\233!q-\305\021\327}\"\256\007!\206\270v\202\270"
+	.ascii	"\376\203~\2706\344\341\232\217\312p\3052)rc:\\7\321$\253\353"
+	.ascii	"=\224\203\0137xP\303\205\f_\213F2\300\200\341fT\027\256\002P"
+	.ascii	"\223I\225\215}>\237O\013\327\201Pk\177U\017X\260h\033M\302"
+	.string	"\275\331\327\226\033\373UUU+\\\313\241\266\231\226\002\2363Zc\363o+l4\247\304\224\244\3161Y\243\363\206SUU\311y\313\3259$\344=K\326J\301\223T9%\373c\345\341\324\261\3368(\321\317L\324~\275UU\025i=\266^\256\017\331\256\023\327\256\237j\367S\272\334S\341r\377\265\345\336\212\226\373\260\264{1\264{/Y\356\331\316\356\327\314\356\325\312\256\r\311\256#a\271\037\273r\277e\354\236\213\330\275W\330=\032\3305$+\367iU\356\245|\335g\361\272?\353\272/\243r\217e\312=\030\3275\341UU\265\021|\275~t)\025\222\226\203t\334U/\257\347D1\235\242\235c+\007\326\326\216#Pl\347\211\3618\361\235\242\315Dk\353\210\217\254\035Z7\262\212\244\376\312\325\304z\212L\314\247\270\344:P\3115`\222kGH\256\033m]3:r\275H\353ZQ/\364\362\264S"
+	.string	"\202\r\220\374\237\317g\342T\225\275\023\314\314*\373\344\375\207f\326&\345\200@\003{5\200\201\236\003\326\270\336\207jb\253\377\034m\324\262\357h\245"
+	.string	"\035\355Q\371#\256i#t\240\243\265Z\013\330+\357\246,\200\365'sG\006\317|SVIy\nY\f\303\314\234\262VR\026k\217\300\335"
+	.string	"\033\345|\022\035[\030\343\262\017T\0027\244\375@\331\245\365h_R\215\363\240,\200\345'\234\r\"]\007e\257<j\367fM\233\365\240\3541\356\250\323\223\235rJ-\243\224\247\"\023\350\307\314'\333\344<\202\256'\241\361\236,\326\255\357\236l\226\362\376K4F\246c\371\343\336\312u\265^\202[\227\227\231N6jM\263\235\223\275\363\350\333Z \232\357\234\354q\275\347\200A4'j\255k\262J\353/\330\211\003h>M\326\250\274"
+	.ascii	"7y\300\230\316\210\n\222\345\351\005\276:\252\252\252z\244\200"
+	.ascii	"\322\t\nb30\301>\215\331\215\247|+K\223\320B\345\037\250\361"
+	.ascii	"\225Y/\265h\233\365\306#\b\020\316\202R\213\276)\377f\235\274"
+	.ascii	"07S\213\272"
+	.string	"\255\367\037\304\256:\313\245\026\025\263|qi\310D\303\254gZ\344\027\370T\036\r\363\005f\270FR\006:_\ft\366\bPy\227\332#Z\237&.\307\330/\265\377K~\001\032B6\250\324\276\231\254J\355\3418\357D\276\2628v\246\366e\232\307`\346k\355)\265\027\323\364jj\376vH\265>cj\377%\371\250=d\0364\265N\342~\261.Fi\230R\253\225\227Z\"\316ED\326A\251\035\322\\J\355\220\345\240\t\245\026\310z(\277/\207Y\313GP\265\244\035p^\202\225\2579\327\245\366\270|U\\\235;)\347\225\032\321\t\232\231\332;\013\245\366KC\251U\340C\251\275z\200\255\250A\f\307\251\216\214\210\210L\220\0244I\007\360\002\261\3316\007\021\260\030\202J\031\"\020\"\"\221$\031=N/*\250\2238\321\336\227=m\305:\300\324\243M(\013y\r\333\266[C\344\303\244<\361mc"
+	.string	"\343\033)\277;\340\267\f\333\276y\302\277\324\356\3716\t\260\216\226?3L\223\310{<>\340\327\334\322\303\353g\205\020w+B\235\326\177\214\346q\316O\004g"
+	.string	"q\302{\331\2257@\360\251\316\332\363`\354\037\260\377\2041\002\206\016\302e\025\255\t\264.hM\240uAk\002\255\013Z\023h]\250\002\242\006\271\204fZr \266\fI$\356\351\261\233\3422\032\022\370\201\316J\313\276"
+	.ascii	"\342\3208?\033\246\262\365Es\257\026h4\313L\331u\bt\365\364\316"
+	.ascii	"1\2319\326\004\005\215\244\250\316\242\021\367x<i\267@\354\202"
+	.ascii	"}\\\335\360X\377\020\r\3613^o[\035\335\260\002W<\205\251\327"
+	.ascii	"\2701=\324\347S\362o\211\247m\032\316&\n\0377\223\203?3\323\360"
+	.ascii	"\034\306,\235\325\262\264\026\214\002/;R\370h\016\2158\217zG"
+	.ascii	"7\2039\244\230\213\361\264\032"
+	.text
+	.section	.gnu.lto_.refs.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\240\004U\031"
+	.string	"&0\217H\260XM\322\001\360\311\203\031\b\236\305\004u\331\n\001T\303H\314XO\024\027\033\302\3075Ax\315\177J\177J\177J\177J\177J\037\332\320\021\211`,\037\277Z\365\243(\212\306/\365wT\373U\257k\335Zk\2735\"Si"
+	.string	"r"
+	.string	"t"
+	.ascii	"\336\007\360^\206\223\177\363u\232\356\303|/aV\267\344\307<\305"
+	.ascii	"\321p\237\352~\351\206}\275\365=\013\025W\201\241\367_~\202\317"
+	.ascii	"\3457wq\331'\237'\377\225\303\344\277\344\177\335w\335-\3403"
+	.ascii	"\365X\302\021\366i\200\217 \377\366u\001\371A\371?\336\357\344"
+	.ascii	"\303\362m\262\273\362[\3712\331U\371`\367\345\216\254\273\306"
+	.ascii	"\373\311!\261\214\367\274t\362s^3\257\236\262\351\33650w\031"
+	.ascii	"\2634\334\252\354/\3313w}\263\302\236\002\337%\336e\004\340\265"
+	.ascii	":\323\271\354\315(\023\247e\027\362IXW\211b}\344^\305L\024v\241"
+	.ascii	"\260\307\302\316\003\276+\252\276\377\261\003\365/\201\177\216"
+	.ascii	"\032a\277\201o\313\257\345\017\241:P\276\f\365?\371.T\234\003"
+	.ascii	"cV_#\263\027\350~@\276\255\373Y\3616\270b\345\351(\376\023\243"
+	.ascii	"\276\022\243?\211SQ\037I\321_$\34371\001\341\241\303\326W\312"
+	.ascii	"?\311\366\333\360\376\226O \037)\377(\337(,\r\374Y\330e\340\307"
+	.ascii	"\262\353|\rQw\325z\213\350Y\265W\325z\212\37384\255\016f\025"
+	.ascii	"\352-a\357\300\203: Y,\376\364\210\352\375\352\023{x\272\243"
+	.ascii	"\323cN\274Y\234\336\306\233^\3138\355\3653\330\007\237\024\317"
+	.ascii	"\021W\212\f\270\3437\342"
+	.string	"6\342\002NA\002\004\267\016\332\364@\r\264@\tp\003*\240\307,\250\036\261\\\251B\345i\212\024(L\2268\0351B\244i\bS\020 >z\360\330\261\224\364}\234!#\006\214\027-X\254Pq\202D\210\017\0368l@\352QC\006\f\027,|=V\230 !\354\021\002\370\361A\026+U\236\242@q\322$\354M\002~\235\216\020i\022\022DG\355\253t\003\351KcF\f\027-R\2400Qb\204\210\2147\004\210\257\267\003\206\n\337\227B\004\357\373\340(\200\231\250Q\210&\030\261@FFI\222$\255\001\240\"+\242u\020\300\245\220\016@\b\005)\252\t4Tz?\3336t\357q\r\326/\006\236@$\202S\201\037\025\252S,\214m\334\312\004\013\223\310, \002\253F\031\221\333*\025\266H\252o\333\n\350]S\2135\007\303\337u\252f=\224\035i1\bw\007\026\275\2045\226\226\032\"\020\341"
+	.string	"\005\241m\364\205\335>\251\2577^\220`\265&\2233m6DG\031*G\364=\302\266\230\261]f\216T\306\037\323\254\2515K^\024\033\202=\307&+N\024\022( \252\367\001&\220\324k#\177X\023\262\030fqQ"
+	.string	"\337\020\2574\323\177k\006\207\b\354g r\350\205\205Y\316\227\200\017KU\305G\2278\177Q\343\033\345\347\2156\004\365\313,\032\3243`\2404\257\312[\034\301"
+	.ascii	"\254*"
+	.text
+	.section	.gnu.lto_.decls.569c92f8b8586711,"e",@progbits
+	.string	"(\265/\375`\205\266\335\333\002\356\205\204\t\020S\020(\205%5\006\213\310\270\210\021\337\370\307O\322w\347\021\037\253t\212\255_\253\017\362C#\302\317\034\303\277\361#\273%j\266e\233\275\367\177k*\f\243"
+	.string	""
+	.ascii	"\304\210 \206\006\037%@ \200\243\301\217\230\247I\222dp4\366"
+	.ascii	"\361\215lM\356\275\345\226;\005\350\r]\020s\020x\n\347p\242\225"
+	.ascii	"\332\245t\2460\201\323\373\372\261e\220y@\225\006\247\027e\302"
+	.ascii	"7\240,\325E\361\035\023\325\bUL\234\370\016\316\373\231J\306"
+	.ascii	"\3340C\316\bt\357}\225\353W\265T!TK\316\324.\315\313@J\032f\302"
+	.ascii	"M\"HY\202\323\213\252x\262\231z\247\332\331\243\202\323\213\252"
+	.ascii	"V\331L\275J\251\336\340\364\276\262\231\252\207\3216U\007y\322"
+	.ascii	"\264d3\274\005cI\335\236\233i+\203 Z;\233\251{\351\036\006y\310"
+	.ascii	"\340\364\242{;W+a\262<\245M\362\271\3544\210\365eh\242\237a\211"
+	.ascii	"~\206-\375\f5\3641\330\321\307\260F\037\203\031}\fX\3641|\351"
+	.ascii	"\024\003\227\306[\265\243\326\301\277\031tPQp\246\323a\003vy"
+	.ascii	"Y8\037\203\2169j]\372T\355T9v*\035\306\242\2221}5\212|\201\252"
+	.ascii	"v*\024\177\245n\317\275q|\200g\016\234^\324\347\352j\212\026"
+	.ascii	"6\037\003\r\375\237\250\376\017\235\376\217\233\306\314\024\210"
+	.ascii	"}\203\323\234D\236\340\374\0370\372 \200\3415\257\300\245x=K"
+	.ascii	"?\273\t.Oso\347\177\325\215\332F\225S\331\250k\322\247\032\247"
+	.ascii	"\252\271\nE\215r!\021~\365+N\235\222\247\206\305\251UT\265\022"
+	.ascii	"3\230,p\335A\343T2\352[\211\031L\026\232\360@\367\336 x\214\371"
+	.ascii	"\220\023\314\377y\352\377\200\351\267_\rS\307\250nA<N\262\262"
+	.ascii	",\254\023\275\24708\377W\321\250gT6\265-}\252i\3242\247\265\307"
+	.ascii	")1\203\351\233\001\307\006\335\333\231F%S\235\330\270\322\206"
+	.ascii	"g\244Q\313\244x\252\263\331j\341B\243\246Q\315\340(\325\211\246"
+	.ascii	"i\\9\003\005\001\"\315C\006\232\346\227\377\323D\377\007\211"
+	.ascii	"\376\017\021\375\237 \232\275\352\274\252\366\253b*\025UL\320"
+	.ascii	"\267\244\312J\n\316a\204\332;\252$Qp\376\217\r\375_ES\323\322"
+	.ascii	"\247\nF\375\"\344\334\273\013\030\225L\365Rb\006\3237\3254\007"
+	.ascii	"\335\333IB\004\025\214z\226\342\245nV{iN\bT\320\234B @\374\262"
+	.ascii	"`\245\205\261\371?[\337gNsQ\273\230\245XQ\240d\341|\0375.f-\223"
+	.ascii	"\235\r-[\256\232\321\255d[b\300\340\254^Q\237\377}\255\2242'"
+	.ascii	"n\317kY\335\204\360\300\202s\026gK\027\245\312\035\234\357cE"
+	.ascii	"cQ\313z~\200m18\337g\211V\255\374\313\324\020\034U8\277\216/"
+	.ascii	"W\245\205\241\301\371>E\264:6\342\252\223\004$B\300pV\203\350"
+	.ascii	"\354\243C\337\347I\247w\364\317\231\006\261iW\n\304\252;\005"
+	.ascii	"b\325&M-Rm\364p~O\033\375\364\2512Q\233P\354\354\320\226\\m\376"
+	.ascii	"$D\370Ypo\261\275\267\007\241X[\216'\234U#\252\222\377>\037&"
+	.ascii	"8y\252p\376U%\252\227\317N\231\025\030\316I\200R\304\300\350"
+	.ascii	"\300\371=h\364\377\364\251\"Q\217\374\177\352\334BA\032F\306"
+	.ascii	"D\301\371=b\364\353\370R(_\246\230\341\374\036*:\367x\351\367"
+	.ascii	"\370\320\357\251\241\377L\203\330\013\355tn\266\351\013\265\350"
+	.ascii	"\013\247\350,\034\242/\324\241\037\334\323\017\312\351\214\246"
+	.ascii	"\362\370U\032\352\223\272Cm\002u\325\004\347*!\037W\235\017\035"
+	.ascii	"8?XF\037\204(\266\246\312T\251T\034\252\216\364\251\346P\245"
+	.ascii	"\216\263\324\033\317\316\275\273\220\3318#V\343g=N?\333\006\r"
+	.ascii	"4\315:5\207:\225\20178\275/\020\232\n\026:R\277\374\240\230N"
+	.ascii	"w\032\304>\210D?\330\245\037\034\242\037\334\322\017\346\320"
+	.ascii	"\352N\203\330\017R 6\007\241\364\201y\364\201p\364\201c\364\312"
+	.ascii	"\274\242\017\364\322\007j\3515+\005b\017\224\322\377\341\371"
+	.ascii	"\200\3618}\202L;\276\274\341\374\037T\377\327\246\327f\n\304"
+	.ascii	"\376\347\205\216\017\231:A\320p\376\217L\377\327\324X\016\206"
+	.ascii	"\246\317\253\3419\36799w\231\0212KFp\376\257K\307\330{\357\364"
+	.ascii	"jl{5\366\277\032\372\276\250^\235l\364}i\372>0}_\022\275\372"
+	.ascii	"\264\364}9\364u\236\276\246\323\327k\364\352fF_\233\351\353)"
+	.ascii	"\372\272\251\257\215\350k-\315j\035\372\372\206f\231Q\315f\321"
+	.ascii	"iV\215n\263\320~\374%\255\373\031N3\007+\212\363\3331:\230\002"
+	.ascii	"\261ms\213~\373\245[g\n\304\276\025\242\3372u\213\226\002\261"
+	.ascii	"8\313\217\303\260\030\306\202\327\334\342\272p.\023Z@\\\025\036"
+	.ascii	"8\277u\322O\311\234U\232d\270\n\025\350\025l%}b2<\226\235 @\b"
+	.ascii	"\371\246h}\315`\363[&}\326\216>\013\325g\327t\352L\203X\241\024"
+	.ascii	"\210m\335R \026O\371\361\017\f\004\177a \2213wV8K\021\322^\216"
+	.ascii	"pI\301\371,\027\375T\354\037A\304\f\024gq]\241\211mUY\0331\304"
+	.ascii	"L3H\222\266\265\256(f\240uZ?K\335\236is\314\032\316\022\362\263"
+	.ascii	"\036\337\336e\302\320p\023\334\304O0\024\274\004;\301Q\260\027"
+	.ascii	"f\222>\261\022l\344\370\bF\362\214\225\340\"?\353qr\356$-\034"
+	.ascii	"\246]\225\350\336\033\204\020\b\240\025\332\223\033\r\371l\022"
+	.ascii	"\215\263\322 \026\203\024\210=\013D\237\365\241\317\362\320g"
+	.ascii	"u\350\263T\372\354\r}\326\206>\373\244\317\312\320?)\020K\301"
+	.ascii	"\234f\335\322 \366s)\020\333\256\\\364\327(\372k\226\376ZC?\317"
+	.ascii	"\321\332\355\214~\356\242\237\3010\325\325p\326\346\260N\215"
+	.ascii	"\241\342\204\363\363\020"
+	.string	"\255\241)\020\373l\245\237oh\f\205k\244O\r\260\r\247\017F\222g\313\025\234\237e\350\247\032\260\352\336^\252\001{\025O_\205\243\217fF\277L\032\304^%\323\276\235\002\261W\231\350t\017\247zx?\335K\363\234\204\b\017:\245{yo\2464\255\240'M+X\325\274\230\256\260\371*\022}\325\207N\243)\236\364\031Azw\022\"\\]\262\262\305\366v\372\b\365\246\350\341\341|\025\207~\032\001\233\356\245\021\260\307{\372\003\034}\fF\373\230)\020{7)r\3306.dKp>\326\322)\234t.}\246ti\234l%k\227\355\355\024\372l/!t8\037\333\320O?\260>{{{{\351\007\366)T?}\323\276\254\2706)\233\2468\234\3318\313\366\336\035\3242d\274\242p~\352E\303\245j\322g\272&es\246o\252\023M\237qEA\327\244i\351Z\017\323\317v\342\262\321\334{w"
+	.ascii	"\001\342Ww\304\007\233\335\204\204E\262\240\004\301\371)\224"
+	.ascii	"\266\2754)\232\364\231\266\245g\312\332\322.\251Y\017\223s3\007"
+	.ascii	"\240WC\214\212\247\f\r\224\315\347\200\276\005\364\237\232y\272"
+	.ascii	"\366\247eR\262\262\2757\007`\0167\271\0368\223\030\361\324\f"
+	.ascii	"\373%F\013\017\316\231L\252\0064k\332}\301\331\231\236\3650\375"
+	.ascii	"\354\255\204\r:&\025\223>S5\2654-\r\223\272ue0/\320\2757\210"
+	.ascii	"\016 \262Y\224k\215\315\177\n\346i\230\324,\315\342\320\342\020"
+	.ascii	"C\006\006\347\324\312\210\247`\200X\246\225s?\367\336>*\332\230"
+	.ascii	"\031y8\237H?\275\302\305\314\237~I\321R/\3513=\373\323*\351\330"
+	.ascii	"\261so\247\275\367S\262\262\324"
+	.string	"\254g\335;k\255\271\367>\b\377\210\247gi\227\324\314\203\214\275\263\214lX\372\222%Gt\357\rB\b\004\be\225!x:\237\004\375"
+	.string	"\350\024K\232%}vH\267<\265\222^\371\312\344\334\316\275\267OZ\327\325D\205\363C\350\247Z\016\264\265E\270Ps`\357\264\003\233\356\355\245\035\330\373\364O\032\304\342\024\210\245 \rb\217\365\007i\020\313\246T\3764,\025\323@}\212\312\332\317\275\235\030\264S\030.b8\337\231\006\261:\005b\177V\354g\251\374-\210?\205\376\251"
+	.string	"V\253(\355\006\177:'\245\363c\375\247u\232\230\260\036\345d.\274\301\217%\370\361\212\026\376k\340a\245\202\022\361\003\201~<\201\023\360\307\031X\300\002\007~{JB\374i\211"
+	.string	"\204\360\377\256\335p\017\0318\006\377\357\316\217GX\312\375\354\220\366\303\217\177\220o?\376\220\337R\024\026\020\376?\265?C\340\317\033\370\363\005\376\374\343\317\357\237}\3749\306\237\255\376\214\343\3175\376\314\343\317W\177>\376\371\350\317\304?/\375\231\352\3177\376<\365g\343\237\245\376<\343\317\025\370\363\003\376\\\364g\344\237\233\376\314\201?[\340\317\024\370\363\376s\006\376\374\302\237\225\376L\343\317-\376\334\201?G\3759\371g\247?\273\3703\322\237\227\1776\3723\324\320\237\231\177\316\361\347\006\374Y\002\177\216\300\2371\360\347 \177v\377\234\364\347\247?k\340\317\023\370\263\215?\357\370\363\213?\017\377\254\254\372\263\216?3\375\031\353\317@\376\f\343\317\305?;\340\317=\376\314"
+	.string	"\004\3749\305\237Q\370\263\212?\243\370\363\001~\325\305\237\265\217\354\307\021H3\366c\023\320\204\245\t`\223\362c\n\310,\371\327\034\277K\201T\027@\365<\0011\374\330\203\032\022\017a\212\374kS\253\301\217'X\235\200\276\037\223p=.L\301\317ja\005\374j\233\037\377\3247?{\245\005\300\317ji3\300-\374\351\324\217S\370U7x\005L\200\037\243\360\263^?k\366\267\030\374\251"
+	.string	"~\274\200?-\361\343\007\374+\261\275 e\276\300\376\354Yk\301\217E\374\227\363\343\016\177J\365c\r\177\272\344\307\bp\341O\233\374j\334\237\346\370\323\252\037c\360\247;\376\365\001m\005\007h)\370\363\002V\003\264\023\374k\004\255\004x\202\177\035\341\177\2336\002,B\353\341g\301\264\020\374\353\007\355\003?\273\366\267\035X\266\277\025\372q\004\310p\360\307&`\016?\376\360c\017?\006\266\034~\f\0014i\262\224+\377\n\266v\240\327n\370\037\347O\233\177\366\342\341"
+	.string	"\320\322\252f+\2226\350o5\\/o]\312\017\304\300\317r\340g;\360\267\030\260\017_\360\377.w)\241\003\177j\"E\341\244\250\003\031p \317\277*\240\375au\264>?\006\300\217\035\360\377\256\304\237\242\320\"\277A"
+	.string	"\n&\361c\017~\226\306\317>\375m\317\217#\220&`\252\025\342\r\177\212B\004\336\276\342\033\374\277!\377\252\324\006\177\034\364\177\313\007\377\357.\264\276P\207}\325:-\360W\311L\370\177\247\342\307\003H\023\360\b\376\337\320\n\242\375\265\276\177\375\200\r\360\377\316\004\306\360c\020\"\360\337\003"
+	.string	"\364\330\273\267\270\b\377\257"
+	.string	"W\177\340\020\353\343\317q\255\376Y\254?\277i\333\037\267\340\201Y\370\361\211\037\223\360\273\350\277\376\370Y\255\277eY\320k\325|\366\020\377\017\313\2179\300(~\225\254]Y\031\f\300)X\246_u\322\346\037g\370q\004\230\004\241\026\327k\325\334\305,\237]"
+	.string	"\377\217\307\217\013\360\257\035\260z?N\221\002\331<?\213\367\377\355g\363\376\263y\230\377``d\031\177~\036"
+	.string	"\377\205\330\273?wy\233\267x\006\377/\351\307'\374\030\350\307\032\374\270\001g\377\273\374W\373\377\345_1\260t\376u\315\356\177\013\266.wy\207\377\027\201w\031\367\257GV\316\217G@\376\322\374\270\204?\375Y\275\"\360\257F,\335\217=\374g\341\300\377\027&\303\311\375j\234_\245S\345\334\367\003\033\360c\241.\005\374\030\002\"+~\354#D\205\177m\363\257o\377\361\017<\373q\006\363\366\007\236\370q\002\256\007$\300\217\333?\307a\343\374g\341\354\017\024\301\355\020\310b~\377\217\203\237\235\313[m\256\177\037\225\016lZv\315\006?\333\301\317\212\370\331\020?\373\301\317\222\370\277\376\301\242\237\025\376,\206\237\375\371\331\236\237\375\375l\360g}~\026\350g\r"
+	.string	"\367\257x~\326\367\263\372gA\370Y5\377\177\376 \214\237]\341\177\372\007\257~\366\355g\323\374,\232\237e\373\3310?\213\366\263f?\373\374\331\262\237\245\362\263R~\266\311\3176\177V\311\317\022\371Y\255\237\r\362\263W?\313\343g\253~\226\371\263O?+\343g\233~\266\003?\013\343g\223~\326\002?k\364\263\025\370\331\025?\213\342gO\370Y\023~\326"
+	.string	"?K\200\237\005\341g!\370\331\016?\253\341_\343\3765\315\277\242\371W\266\177%\363\257T\377\372\364\257j\377\032\346_\235\3765\355_\317\376\265\313\277j\371\327\262\177%\373\327*\377\n\366\257_\377\352\344_9\360\257/\374+\223\177]\376+\362_\275\376\325\370\257H\376\265\353_\211\374\253\220\177\325\372W \377\352\343\317m\377j\365\257;\3765\307\277B\375\253\214\177\355\300\277f\340_\337\177M\376\253\005\376\265\370\257.\376\025\002\377\312\342_\021\360\257%\374\353"
+	.string	"\376u\304\277z\360\257 \376\365\303\277\002\340_1\370W\013\376\225\202\177\225\340_\203\376k\360\247\t\370W\240?\305\300\237\276\177\326\372W\f\377\267\374j\335\257\322\3759\316\217\021\360\343\n\376\364\315\1776\377\352\363\257\302?U\372\361\372c\013~|\200?\323\375)\212?\277\371s\334\257:\371\363\232?\303\375\371\355\317n\177\026\363\247\300\377w\177\006\363_\357\317g\177\356\362g\263\377-\376\263\360\347\347\237\265\3749\313\237\313\376\214\345\317\\\177\336\372\325:\277J\347W\355~u\316\257B\177U\316\257\246\371\277\342\307\023\370\357\302\3776\377\307\374\027\373\277\365\237\355?\b{{{{\277\206\017?\006X?\007\226\004\367\t\371\200\247M\323\227\217\313\267\345\344\213)\t\316>-\247o\316\325\327\r\234\357\201\225f\222\004Z\245\006\0162\0065\206'\316ji\257\331\342\025\271q\345\f/\217\215\246\336O4\244"
+	.ascii	"\201\006\t\223\302A\304\242\264\327\024\250^\215U\216\n\217\030"
+	.ascii	"n\003\006\315!\247)\207#\252\206\245u\342\2604\270\272@U\037"
+	.ascii	"Xm\355^\034\224*v\204\n\224\306\023#P\226F\326Y\325\\\023\007"
+	.ascii	"\001\273\301\322\030\302\306\314N\217!i\202P\261\001\225\323"
+	.ascii	"Q\232)\343\356\355\007\033KCoyi\206a\031m\315;>\2404\240tA\327"
+	.ascii	"9 kM,3M\354\024\244L\236T\234\266\242\273\250N4\025M{\320\275"
+	.ascii	"\267*\344\007\324\311\221\265\255\275\213\233\022\241k\254\211"
+	.ascii	"\203\350)C\254\304\232^B\270\340&7\253\\\234n\322P\252\263\231"
+	.ascii	"\002K\036h\221gS\256F\336\332\326F\213\364P\303|\240\201\206"
+	.ascii	"\3518\255\203\205\353Y\372\331{\b\035K\303H\225f\230\225\234"
+	.ascii	"f\323zz\316\007D\327\361]i<\276\036\276\034>\033>+\337\017-G"
+	.ascii	"\307\321j|L>\034\276)\037S\277\361\335\360\321\320ozM\273\321"
+	.ascii	"P\237\223\336\323pt\032\337\222\316\323x\372\316\367"
+	.ascii	"\244\325|\333'\245\347\370dh8M\247\351h9_\r=F\257\361Q\371t\350"
+	.ascii	"2\032\215>\243\353|Y\272\215\266"
+	.string	"\343\203\322yt\233/\312\307C\337\321n\332\3167\303\267\303W\345k\362\005\361a\351\250f\243\315\370|h2\351S\307\351\264k0:\214J\243\t\222\021^\3624\223\204AY\032D\266d\271\177\225\263\201\327\f\333\001\247\211\203|\r\351q%\343L3J\020\250\035%K\232K\330(Q\271\304\304]5\3034\2177\320/yP\265\307\027\024\355\016\252\212\3518\215d\210\030T\307i-\034\205\345\013tog\312\206\207k,\265\312\367\200Ik\2644\210Mk\324\321\357\240\215~\007j\372\035d\321\357\300\211\376\365\225\353.\277vj2\315%\325a\006\314\027\234\315T\275\032_\250\340\374\016\222\350\377Z\213\316\242\237\032K\372\324[t\031\234\022\250\336\322\276}\251Y\322\324[\3325^\253\021\253:\270_~\007CtZf\304\365\225,\304\316T\023\234\337\201\226N\241i\020+A\n\304\276\203)}\016\356\350s"
+	.string	"G\237\2033\372\034p\321\347 L\237\203\"\372\034\334\320\007qG\037\004\033}\020c\364A`\321\007\361D\037\304\225>\b\246>\b'\375\r\344\350o\300\246\277\001\027\375\r\246\350opD\177\203+\375\rd\350\177\260\243\377\201\215\376\0070\372\037\262\350\177\360\322\377P\245\377\241I_\0039}\r\312\350k\220E_\003%\372\032\\\351k\360\244\017"
+	.string	";}"
+	.string	"\264\351\003\200L\037"
+	.string	"K\364\001\300\324\317 \217~\006n\3643P\243\237\001\031\375\f\266\350g\020Ek)}#}\n\351)5M7~\340\374\f\226\350\016\354T\210\375^*\304>\003\036\372\030\350\351cPG\377\332\351\032\352\327L*\227~\252\300\221\252\034ip\32634\215\353'-c\353\247\020\262\366f\322O>y{3\371\244i\005iZA\006\343Zb\306\346c"
+	.string	"\325i\330\210k'\037\270\263:Jp>\006k\264/\005b\217\001\031}\f\310\3641"
+	.string	"\323\307"
+	.ascii	"\211>\006=\3641\240\241\177A\035\375\013\332\350_\240\246\177"
+	.ascii	"\201\025\375\013\232\350\277\265\203\321\252H\365xj\353\354\265"
+	.ascii	"ac\270\236t\354^XYU\301\271\265K{r`\371\362Q\327\241\225\222"
+	.ascii	"\026\204\310\234\b\234;\244\204\264\320V\016\227\"gip\226CG\007"
+	.ascii	"\312\222\023\3478z\211\033\25028\377\002!:\256\205\323\312\265"
+	.ascii	"oZ7\351\263\235k\331\324\275=\311\340\2524\325\2145\367\336k"
+	.ascii	"\2504\367\336Y\355\\\253\244%4\347\307\232\266"
+	.string	"`\376\005Y\372\027\340\320\277\200\251\177\301\r\375\013\242\364/\250\241\377\326m\312\031\225!8\037\004\266\006\0165RV\230T\353\216\0223\230\276\032Mb\320+\031\316\230\025\272\272\250X\223\246\250&tu\321:V\n\n\023]]\264\005[{\254ZT2\346\001\256L\201\336\3415\241\253\213\266QpT\023\220\346\210\026J\373\244\204\0235vt\360\0247\315:v\232\322@U\032J\270\274\240{;W\251uj\f*\007\252\302\331\\s\315\275\367\234:*M\202,\261BW\027\315i\262[\030\034Yo\335S\352\350\352\242jZ\260\f\227\333\204\220\306\224\227g\213\256.\253\3017\322\232\320\325\201\255[Z\257\0223\230\007\270\262$\313\275\311\003\335\333\251&\317\2155\241\253\213\332\211K\367J\250\243\253\373\312j\262\23315tuQ\251\033Ltu\321\254\026\254e\002e\013\017\032h\234\026,\323\251pJ\314`\036"
+	.ascii	".\0164\353\345\275\017\302\230\350\352r\232\026\f?\225H\003C"
+	.ascii	"W\027]j\301V\246\325F\016\f\246X\241\253\213\006i\301\332&\224"
+	.ascii	"&tu\321|\247\005\313\32105tuQ/m\225\266\255\335\322ri\261\264"
+	.ascii	"e\255\226\366L\233\245u\266h\355Y+\246\r\323\206\265d-\231\326"
+	.ascii	"\254\035k\273\264T\332\265\366J\233\326\242i\313\264\317\026"
+	.ascii	"L\373\245\025k\255\264iZ3-[\253\326\216I\237-X+\345\355W;\345"
+	.ascii	"\207\307\005\206\271BN\251\234i\020\233\301*\005b\177A\223\276"
+	.ascii	"\005v\364-\210k\235\370\332\330\001y\342|\013\332\364-8\323\267"
+	.ascii	" \213\276\005`\372\0264\365-\260j\275~<\267>\333$Aa\330\r6*8"
+	.ascii	"#q\302L5{b8\337\202\266\2535\222>\333#-\215\267O-\224S{d\345"
+	.ascii	"\322\316(1\203\251\002\316\n\332\036ik\264ET2&\002\340z\344\034"
+	.ascii	"b4\240\260\231\310Z\\\024\020\234_\001\036-\266\325j\341\272"
+	.ascii	"\036\247\237\355\304\025\325\334j\245Z,\225\214\251\202\313F"
+	.ascii	"\273\325\006\301h#\266\350\352\276\206\264BZ\256\364\331n\265"
+	.ascii	"Y \204,@k:u~\005r\372\025\220\321\257 L\213\365\2676\332\250"
+	.ascii	"\026\310\3126f\205\206\363\217_^\223\035\023\234_\001\027}\020"
+	.ascii	"\250\2305\340ldU]M%c\352,\\QP\261\251\266G\273\243\265j}\264"
+	.ascii	"W\351\263\345\321\342x\233\243\325Q\327\362ho\374LFY\007L\234"
+	.ascii	"\264Xj\312\240\005\363+\320\242\323\2544\210\3250\246_\301\227"
+	.ascii	"~\005L\364+8\242_\001\227~\005A\264\352\226\006\261$\344\320"
+	.ascii	"\033v\032\304\342\nfh\035@!mP<p\016c\367\330\031i\230\036&\347"
+	.ascii	"^j\255\242\2120\277\326\266\354\246\312\035v\217U\303\302yh\332"
+	.ascii	"\233\tHk'\252\b3z\347L\016\024\215\335[\323V1\252\023M\005\027"
+	.ascii	"\035tU\203\3236\261r\3307\354\\\313\324.\261t\355f\365\3309,"
+	.ascii	"\234\326\211\245\303\342\261r\354\035k\207\265c\327\260lX(\033"
+	.ascii	"\327\312`\335\260ul\035\266\r\033e\357\260yl\0346\017\213'}\262"
+	.ascii	"{+\216\253s\253\331\327\0301cX\266\260*l\227%\354\035\bqh\362"
+	.ascii	"\333\277\312\301\211\022U\204\031=\303\276\225\230\301\364\335"
+	.ascii	"\200\003\203J\301\215Ao\260T\230\214\260y\353\\\234' \330\300"
+	.ascii	"\021U\204\271\266\255Y\333\210\255rtM\242\2120\243b50\032\323"
+	.ascii	"U\253\203\335[\323\254h<@\355\3154\245\005\023U\204\031\r[\357"
+	.ascii	"\260N\036\240\366\026\002\326\376\350\222\342\001i\351D\025a"
+	.ascii	"FW\264<\207\243\260\3322QE\230Qv\217\365\302\252\251N&{\013\031"
+	.ascii	"c\243QE\230_\240QE\230\3216\267\025.I\213v\307K\272\347\241i"
+	.ascii	"o\254\036m]T\021f\324\315\277\312\355\255o\332\257\250\"\314"
+	.ascii	"/\226\006\273\307>\261P\\\\\232j\030\273\307\312H\315\270\274"
+	.ascii	"@i\260Q\370N\313\225'\231\335jG%cj.Mg\320Uno\225\263\326y\200"
+	.ascii	"\332{\013I\333\214*\302\214\356\355\354\0313\345\311\205\"\377"
+	.ascii	")\030u,\313\245x\025P.\351\221E\215uSB\241\323\032K\323v\004"
+	.ascii	"*\327\304\231m[\202\303%\356\313\f\273V\306\007\245j\313\334"
+	.ascii	"\226\2312\2766b_\354\2209[F\255\203E\304\013m\314\252\352\354"
+	.ascii	"\212\025\223>\301\243`\211\r\303\202q\302c\245-\355,\230\237"
+	.ascii	"\204\b\351^\032F\007w\007g\366\214E\323\315\251%\031hk\016\237"
+	.ascii	"2lz>\276\370\346\260I\323\365%5\033\302\344K\030\316\237\300"
+	.ascii	"N[\021R\2658M\301f\351\223\345\302\216=\271\260Nv\313\2260z\320"
+	.ascii	"\340\206\302\223\226\363\317n9\373\274q\003\372\2043\253\305"
+	.ascii	"wFG\225\031\234?A\231\376Y,\351\223\315\362A\313\t\016\234_\207"
+	.ascii	"-\373\357\303E\330\310\271\303\231\275\302\334Zz\340le"
+	.string	"S\251\261\202\363'h\242\311\3301\254\305\264\206\n\347O\260D\177\002 \372\023X\211\301\241\302#\013\316\237 j\n\013\226>\33106\207\023\033\306N\2618\344\354\302X\035\254\224\324\315\352g;\321\345\201\202H\263\214\321\253cs\027\373d\256\031\205\205\302~\245OV\312Y)l\025\213\325\263\204ao\"yMV\n\033\204%\302\312i\262cFA"
+	.string	"\243\206"
+	.ascii	"Y\322\371?\333\204u\222>\331',\023!\020\222\260\315\324\315\312"
+	.ascii	"\271q\364p\341\262c>a\215\260H<4=\245 \006\016T\2079\"\306\b"
+	.ascii	"\233?\301\326?\333d\227@\2359\211\363b\225\374\252\254\334\304"
+	.ascii	"\340|\t\350h\257\2477\230\310`\303\371\022\300\321O\237\217\303"
+	.ascii	"\0369]Frf\007\025\234/A\033}\t\322\350K\300F\204\315b\271R\267"
+	.ascii	"'\212"
+	.string	"6:\350\336{\b[$}\262DX!,\021v\307\232\034h\317\022'aT\330|\t\316t\226\342\244\005\r\316\354\026\253\265\205B: jOp\276\004X\364%\250\242/\001\030\373\203\005\222>Y,\366\212\305by\260><4=\251\200u\307b\261;R<\340\022'v\314V\b\230\261#l\276\004S\372g}\260=z<y\311[\311X\255\361b\255\330\034ojl:\234/\301\223\276\004[?\202;\372\021\320\351G\240\206\245\322\262U\345\013\347GP\206eF\200\246\037A\027\375\b\262\350G\020E?\002/\375\b\206\260P\270\016\243\345\315\330\201\363#\300\241\037\001\r}\017x\232m\362\311\001D\313\023\316\367\320F\037\004\254\365N%cj\263\"K\240\354f\231\322'\273\264\342=G\260Kk\336\272\207\301\235&\270hto'\b!\020B\263(\336\0166\347Y\365|lx\321@\202\363=t\345\361"
+	.ascii	"D\337\303St\305\203q`9\222\027\225\243\263\326I\341\354\334A"
+	.ascii	"\255\321A\203\256sT\347\0273jp>\004V\240\020D\321\207 \211>\004"
+	.ascii	"X\372n\322 \366\020P\351?\240\247\037M\203\330?@\267\262\311"
+	.ascii	";\320\fQ\202\363\037h\243\377@\231U\215\217\233\2221_p\376\003"
+	.ascii	"[\326\267\007\304\364\037\360\322\351N\201\3303\351\023\031c"
+	.ascii	"Op\376\003=\326\322\347\312\266\222a[\313\254f\246\344X\222\027"
+	.ascii	"\335{\013\201H\257\330\232\322\344l\006\243\241\311\341\200\202"
+	.ascii	"\363;\344\351wp\243\337\241\214~\007-z\025\223\206I\203\321\265"
+	.ascii	"'Qp^\301\214\370\032F\002/ji8\267\035\302t\332\301K\277C\020"
+	.ascii	"\375\0169\364;4\351\013\341i\fBP\335\301N\203\330,R\250\270\206"
+	.ascii	"\340|!8\375\324\216So\365\261^Y\177\344AW,\253\225\265l%K\237"
+	.ascii	"\353\225u\354+\217\325j\365qe\275\312se\305Z\253\364L9\331Z\213"
+	.ascii	"\252fYn\312~\371Bd\364\205\314\364Z\345_}\254@V*6\256d\t\301"
+	.ascii	"YLh\235\021\025\365\005\347\013I\211\262\202\255_+\224\265\271"
+	.ascii	"NY\227\254O\326&\253\223\225\311*%"
+	.string	"}\256a+\222\257IV/\261 p[kQ1!(\304\336@\327,\2558\320\275\235G0\032\013\347\312\326ZT\t\353e\267\265\246\212\255a\353\026\t`s4\210\270iv\265\005)\202\321z|{3\245i\256a\253\221\034\005\rTl\r[\271p\024\234&\2155l\035\202\357z\234\234\233\252\365\222ck-\370d\327D\352\201|!)\235\273\244@\3549\334\351s\260\323\347\360F\237\303\031}\016_\3649d\321\3470E\237\303\021}\016A\3649\350\320\347\020\245K\244A\3549\314\320\337\260\247\2016\324\321\337 \247qs\203\032\r\344L\203X\374\265\356X\253\324\2473\355\tg\035[}{rE\006\347o(\263\346Xq\260`r\232\2308\177\303\027\375\rdZ7\223\350o\300\322z\303\223^m\25450\216\036Y\272p\206bml\271\212\303\371At\364\377u\306J#}\256O\253\323\372\2646\245"
+	.string	"\006\316\372\264\312\300_@)+tu=][uVl~\220\026\375 '\372AB\364\203\252\264/hI_\003\035\375s\323\3000\032HE_\003\021\035\314\342\241\203M\r4\264\220i\247{\366\233\366iz\321?@T\364\201\234\350\003\r\321Bi\020{ \033\372\031\354d6-\036\033k\336p~\206\266\274\346*\323\0164g8?\003\232\316"
+	.ascii	"M\203\330g\030\323\031\230\271M8$\256\351\f\347\247dh\250\340"
+	.ascii	"\364\2766\22378#c\320\275\235^\3160\232J\306L!7\007]sK\361z0"
+	.ascii	"\201\323\373\312\263\227c\216\03528\275h\030,f\004\020-9-8\275"
+	.ascii	"h\221.-y\202\344\341)y\346\244v\351\2357\325J\355a\245\002Q\263"
+	.ascii	"\250\264\342\340\360X\232A\203I\032\030\234e)\005B\004c\351q"
+	.ascii	"rn\034\035x\323R\267\250\250\340\364\242\271Gnf\"\231*\203e0"
+	.ascii	"\331F\256\3125\262\220\374%\007\311G\362Tv\346\254\214#\217e"
+	.ascii	"+\371I\206\222\231\344\035yI\226\222\271\362\214,\226\263\344"
+	.ascii	"\265\354%\217\311[2\217\254$;\311\317\214&\177\345\"\331L"
+	.string	"\236\222\331\262V\016\313>r\216\254\226\313\362Y\306\222\223d\254L&\337\310T\262T\216\222\313\344+YG\356\312U\262\226<$\247e\253\374\224\231\371G6\222\3212\227\034\225\201\344.YL\336\312M\362U\206\312^9LF\222id\031\371L&K\237\331,3=7e'\2651\030\255\307\351go#m\315\2653WZ\352\222\f-8\275/3\334\005H\332\034\216\263\244\031\367\206\nN\357+\317~\203\323\373\252\332\261\004\247\367\225\227:\310\243\005\247\027\235bb*\255\f\234\220\301\351E\247t8\241R\227T\247\034L\356`\274*-3\314\005\310\333\033\033\036ipz\321\324\256\216\326\233\032\234E%c\036\300\210\031\364\312\217\327\332\214x\201\202Q\t2'\017\326\303hT\036T-\215Y!\261\001\255\302<\230\314Ycc2\027\207IU\017&\251\233\364M\n\315\341A\030\023|\205\261\360\024\225\214\211"
+	.ascii	"\033O\320\2757&\203\315\\\221\341\301\233\243\303u\"T\275\301"
+	.ascii	"\351E\363\344y\203\323\213\216IQ\001\t\002e\243\271\2446\345"
+	.ascii	" \203\323\213\342\2654)\236\b=\310\346L\2313#\233\251P*\217\021"
+	.ascii	"rPa'\031P\346<\231\250O\236\315T)*\034\017MO{\343\350`\217\314"
+	.ascii	"\316\217\337\326\244{=K\316=\225\362p\342)\214\003\311\025to"
+	.ascii	"'f\302OP\264\346\354p\035&\034\031T\211\rI\367Tg\263\315Rd\017"
+	.ascii	"\252\002Q\261\250\356\250Q\325\211\207\246\247\315\264UbO\013"
+	.ascii	"N/\372\326\206\fN\357+u\223\312\205\221\301\351EU\253l\246\372"
+	.ascii	"\300Q\251[\327fZ\032\201j\016\231g3\\\006g\311\340*m\343*\354"
+	.ascii	"\203\t\025\234^4\265[\222B\245.\251L9\322p\034v\303\203\t\234"
+	.ascii	"\336W\321\fv\304\306\f\037\027^\251iL\2716>7`\246\304\236\344"
+	.ascii	"\361\340\001dK\233\350\030\213~\355m\365A\230D\215V\2319\034"
+	.ascii	"8\204U#\330-\311\373R\347\302\314\221\323qa\325\231\226\233\036"
+	.ascii	"Ep\026\346@#\254!\254!dz\200\322\264\253\022\365q\232{\002\""
+	.ascii	"\234\272\220\211%o\310\034\316B\033\302\033\301\034Z\3213\341"
+	.ascii	"\r\241\024\023\257\033<\312\352\204\3215\341,\214\302qn\310\311"
+	.ascii	"C\341\013\r\032\302'6\252\003\016\3247g\255\353\f\316Ov\306"
+	.ascii	"`\345\341|\024\206\310\220"
+	.string	"\361\363\272\323\352\320\361\346\tU\031[\033\036\341\222pI\330\204\267U\326R\235\037\363\306\330\217\036\250\2158d\204L\0276\325\301\342V\245}\302\266M\345\335\315\301\203'\270W\200\246%y_\230\312\033\033\230\336\203{g\277,c\274\340\3019\230\347g:\356\351C\017\347`\336\317\276\344\266\362\340\034\304\373\331J6$M\r\316\301;6w\356<\321`s\226\266\324\346\346\202u:X\351\200\253K\361h\344\001\"\347\301:\017\322\231##[\303\371\301\272\240]\236\375\004\347\243h\242\203\320\340\234\377>\f\272`\024E4h\307\360\200\302\3735\361\222(\3019H\367/pxP\271\022\214\303\322I\373j\013\306\361\322\243J\206\027\234\217\202\371\346\177\003d\373Y\262\262\247\"\210\242c,\032\335\333\352\203O\264J\r\013\316?!\247\346\3016j\202nZ1BYMN\033\313\b\020\236\216\260\272\350~\372\361a"
+	.ascii	"_\240\254\t\306=\350\346\f\273\207\005m+\310\246\215c\303f\005"
+	.ascii	"\347\340\232\365*\007\234'p\277/\330u\246\255\016\347\237p\242"
+	.ascii	"\177\342\301\263\007\303\374\3513x\026tS\341R+\333*ki\316\bR"
+	.ascii	"t\200\255E\367\223\325\207\236&\264**k\017\272=\230\206\204\b"
+	.ascii	"\217s$\222%\013\316\301\266\247F\354\262<\341\374\340\231 \232"
+	.ascii	"\337\347c2\327E\017\347\237\220\322A6\017\200\334i\345\005\315"
+	.ascii	"<\016\226\002\003\005\b\316\3012\227#\354B\326\025$\303\005\327"
+	.ascii	"\204sPLP-}\236-8\346N\237\03604\266\260\341\374\0233\364\323"
+	.ascii	"\263\261\035H\317\306\006\323\036\004\363\373|`\260\206l\341"
+	.ascii	"\374\023\364\364\037D\373}\255Y\233\253&\316?\001\217\376\tu"
+	.ascii	"Y\322g0K\320\213\3365\230*\232\246\240\233\371\203\003\022h\326"
+	.ascii	"d\004\2730\001\321r\223\206\007\245\312\354A.\177PK\360\351%"
+	.ascii	"u\304\f\347\340\226\021\017\232\371\316\302"
+	.string	"\322\b\301\271C\n\304\246hi\020\373@\n\304\376\0049\375\007\313\202e?3a\211\271aF\323\022\240\0279uL8\377\0046\375\007\255\004\255`,z\317`\372hp}As\232\036]\252\316\234\3161\264:8@\222\340\374\023\234\372\017R\tR\tV\301\233I\204\256\261&\\\320\\\t\203\363OX\022\204\362`X\020\312\0207\254\035\033L\274l\341\034\234\022\004\013~\005\245\004\243\234\360#\b\344\301\"A A'y\313h\332LH\332&\253\245\211\207\027\316M\202C\234\316\330\341\374\023\230\372 \0341\002\r*\tviAb\344H\323+\330\f.\t2I\237A%A$A%\301$!\324!\203\323[\271\\\355\033\277|\023s\372&\334\364M|\3217\341D\337\004\016\035\024\022$\342\013\023\005\367\003\347\007\207t\251\361\202\2023\016r\265bL\247-8?\270\245\3469\023\006\n\347\007\265\376\373:"
+	.string	"Gk\n\316\301,=\303D\223\006\2767V\342 \301\371\017b=\230\365\007\203\3447\375T\201\250++98\367\244@,\020\316\210\007\261\360\222'\033\233\334\325\325\332\217L\025:4p\276\ta\364\037\334\221>\203;\202=(\330\317\237\275\271\240\3206\323\212\003l\003\313\313\f\347`\217?\310#h\345\023\243\253\356\356D\341\334\001\232\006\261*V\n\304\336\2040\271\003\353"
+	.string	"\355"
+	.ascii	"\357\244O\240\\P\207\3363\230\315]d\252\275K\361\312L\331\301"
+	.ascii	"9\207\323\211)\256\215\031\234o\202\022\375T,\n\274\233\203\002"
+	.ascii	"\361\340@\365\202;u\3532!J\032v\007\020\217\207\246\247\024\304"
+	.ascii	"\336D\005\231\202PN_\242\320`\0240\217\233\033A\034A\252\340"
+	.ascii	"T\320FP*\310L\237\301\250\340\322\201v\200w.\024\214\002\346"
+	.ascii	"\311A\367v\372\320\t\323\302\343'\003\243\217\343\241\351)\205"
+	.ascii	"*t\320\340S\260F\372\fB=\b\305:\2034Fh\323\261E\247\003\ba\335"
+	.ascii	"\0327Wl\376\2034\2023z\2728\213\330\341\034\224Ag\305\203M\006"
+	.ascii	"\3167\341\206\376\203"
+	.string	"M\3513\350DW\347+\r/\316\177\037\220\314\021\2566\234o\302\223~\tx\300=\315\006\n\244\r\347\227PG\277\2049\372%\274\321/\201\215~\tn\372\007\336\001\361\254ekt\332\200xR<84QM8\277\2043\032;\323 \366C\n\304\002\353\200tV\"\277\317\007\f\215\b\027\234\017\264\373\357c\341H\032.8\347\364j,\020z\340\234\337\207\331\2264\245p~\td\364\201t@9\277\257\307\215\222-d8\277\2043}`\034.{tz\340\f\234\3233J \323\340\007\344K\220\2537\007\316\375@8\353\334\013{y\356\340,L\201X\374e\304\201o\200mc\240c8\277\204$\372\351\224\024\370\366\006\2143a3\331[\210\227\017\364\007\007+Z\336\016\323&\230\025e\0074\3730cS\2063\220\rp\rV\213P\311q\341\f\204\333,\231\017'4\234_\002\026PM\t4\322\244!S\243"
+	.string	"c2\252p\276\001\350"
+	.string	"\321"
+	.string	"\321"
+	.string	"\205\370\324\362\254q\364\2264\201c\306\f\220\355)\263\216\003h\217\216-8]k\007\262\235\005\315\250\354\225\021C\206\f\320\t\357\355\264\233m\03158P)!UW\324\324\300\200\250\002\234\013\022\007\217W\2300@\247\377\250\001\361#C\221\262\227\005\347\033`GZ\032\020\310S&\030\r\326p\221 rz8\277"
+	.string	"z_\3160\232\tMO{S\211\250\223\332\243\363\345F\277"
+	.string	"h[\270"
+	.string	"\273`\264\237\255f\373\272\230t\201\026`\314\314\354w\227R\340\364v\201\216\002x\351\027\300\207\376\201Y\264\264O\236H\301\203\026\240\206>\tQ\375\003\257"
+	.string	"\247"
+	.string	"\3130Z\272g0\367\036\242%\342\216\2044\372$\224\351\247{)\320\371\223\020\0018\005H\226\356\351\335\334Ml\226H\340 \301K\237\004\035\372\300\260\024He\n\260\n\276\323K\314\3554$\215\004Sj\217N\224"
+	.string	"{\372\004p\243\237\342;\366\007\202\001\301|XL\330L\234\266\020*\354\016);8\330,mV\266\340|\002|\001B\001B\001~\275\211hS\273\240\3459q\006~\321\375\336\276\236yp\006F\371IA\223[{\303\371u\360\335\177\337P\355H\324\351\304\tP\310S\346\236\023\302Jj\217NTx\005OU\030\234O"
+	.string	"!K\226"
+	.string	"\231\244\233YG\202\037\037\262\325\021\271<\315\003\231\250IM\305\361\"\200\016\r\364\002z\001\221Ti\226I\302\244\r\316'\300\222\006\036\001\036\001\"\331\362\003\272\255\254>\034\327\336|!Q\363D\211\231]W\327\215f\234(\216&\234?\2006\r$\002$\002\024\222\302~\312\\icnf\\\\@!w|\350\370\2108o\324\001\205\234u5\021\262\005\347\017\240\t0\b0\bP\253"
+	.string	"Z\340@{\364\326\234\224\001\263\016\324\022\316\350R\306$\fY\027\027\222\037?~"
+	.string	"\201\370\352\370\210\035a\032\303\2023\020\b\023'\\Q8\177"
+	.ascii	"N@\037@\037?9;>M\220\\\355\r\301\371#\304\321?\320\352\t\264"
+	.ascii	"j\237\344\r\265\367\326\025+V\206\003_\332\334\224-\234?\002"
+	.ascii	"[\025\024p\307\207t\343\330)\324\032\265%\320\315tr\360\021\320"
+	.ascii	"\364G\270\242\177\240\r \016`\216\237\245\033\307\306o]jm\320"
+	.ascii	"\315\334\034|\004*Q\217\002R\341\235\345\264\233\355\031\265"
+	.ascii	"3Ple\013\264\013\363@*1j;\312\340\f\234\372\331\2345#l8"
+	.string	"\003o\340\2505q4\312\340\f\224\302Q@\266|U\341\375\367\255\\v\346\316\212\350\217\020\204\006\020\212\306O\356\351\351'\007bMj\217\316\327\317I\222\270-8\177\004)\375\022t\200K@\031\300%\240\023\220\t\310\004t\252\323\300\216\232\306\304Z\202\363\017l:\320\311\310\\\025\034\234_'\335\253\201#\f\026\316/\201F\277\304X\236\337^\236\237\234\236\336O\356?Lo\034\210\0216}1\251\302\371%\220\350\227`\332\371\341\331\371\335\335\271\363\273\233\003"
+	.string	"1\251=:__\3166?\360\374w7d\351\007\035\234\177\321\253\365\274\031\213B&G_"
+	.string	"Z\352~t\352\354\354~r\364\322f.\375\354&97\315me\365\201U\362\203M\020\234/"
+	.string	"$\372\002x\232\373A\347~r~q~q~r\n \367\005\372c\233\332\023\243\373O\316Y\252\345\315[\2308\375"
+	.string	"\214\265\371\275i\363\223c\367N\235YS\314m\305\374\020\027\367\223K73\303\231\026\307\325\r67\377\311\211\225\255\221\n\300\017}\021\352\326\254I\361(\330VYKu\0250u\230Y\235\341|\021\332\2349\363S\243\367f.9\367\024\004mR{t\276\336\376S\223\221\314\360r\003\347\237\333oK\020Z\247\007\007\347_\232\253E\325\334\264\375\260\344\26380P\234\177h\276\220\271A\202s\0271b~k$@\301j\232\371o\rx\204\212\334\017\234\177e\256\226\345\212\032\316?2?\2632\363D\017\347\337\03051/^~`4\300\222\332\243\363\225\366\037\030L\244\315\315\016\234\177hWc\262\327E\n\316\277\263/E\310\310~\\\200<"
+	.ascii	"f\366\037\227\236\255\271$Ep\376=\177[\376\373z\242\226\274\021"
+	.ascii	"\003L\323\005\356\006\316?-\277\253&r?\236p\376e\271ZX\0261P"
+	.ascii	"p\376\225\375\260\374\367m\300\306\224\035\234\177W~\366\223"
+	.ascii	"\343b\206\f\316?+\3772\305\312\235\037_4\2231PQp\276\b9\304\304"
+	.ascii	"~csB\210\221\332\243\363U\345\2771\265\212\227\"Fp\376QQ\333"
+	.ascii	"\272\200\021\202\363\353\374\256\210`q\301\371\"l'N~`\034\240"
+	.ascii	"S\376\003K\311\276\350x\302\371\367\025\364\222ve\205\363\017"
+	.ascii	"\312O\212\017\032\032<e?)\277(\253\233\252\033J\204T\210C\205"
+	.ascii	"\f\316\277'!\334Y\262\344\307$\315\273\271\233\340\322.\250\022"
+	.ascii	"\226\225\006\375\257I'T\203Cn\343\374\020\322$I\362\363\002\312"
+	.ascii	"{\235\377\274|VH\262\350\377w\344\371;\322\332\341\275:m!_\315"
+	.ascii	"\275\2558H\353\2624\231\341\374\020\234\372\377u\375$DH\237\277"
+	.ascii	"\256\024\017\357%+{Jy\003\356\307\327\336e8P\261\320\020\363"
+	.ascii	"\304\371!\374\320\377\217H\372\374\021i\345\230\260D\2657S\027"
+	.ascii	"[\305\212\003-E\211\021\035\372\377\ty\372\374\t\371\351\310"
+	.ascii	"\273\351)kS\221\020F\r]\335\317\t\234\22298?\204)\375\377\266"
+	.ascii	"\236\277\255\037\016\274\231\254\354%\r\244\231\001\026\335\333"
+	.ascii	"\212\203V\211\0179&\316\017a\206\376\177Y\317_\026\216\312[\206"
+	.ascii	"\323\3162\302\352\335\030\373\021\335\273\f\007\232\211\207\t"
+	.ascii	"6\206\307y\374\260\376\263wV\323\336XX\023<a~\370\177@\376\303"
+	.ascii	":\323\321,sGp\376\375P\227X\301\333\201\363\317\352w\205\205"
+	.ascii	"\247J\r\316\377\357\352\347\203K\034(\037l:\370\234\310\210R"
+	.ascii	"\345\327#e\203\222\343\314\f\234A\300\362\253\372U\355\236;\237"
+	.ascii	"\247<C\302\340|\020\226\350_\0167\352\006\026\234\017B\227\376"
+	.ascii	"Q\375\316\270XQ\341|\020p\350\3777\365\364\371\233\372I\231\260"
+	.ascii	"\321\322\ruv\245\013\272\267\025\007\300\2756nf\340|\022w\364"
+	.ascii	"\377\273\361\2232\233\022&\016\316Q8\265s\247\312\017\234O\342"
+	.ascii	"M\377\240~N?\031\252\023M\177\341\002\002\375A\371\240\276\275"
+	.ascii	"\036&\347\306\321\003\367\243\206\230\350\317\306\257\306\217"
+	.ascii	"\306o\306\357)}\376\240~M]~P?&\034\325^\351QCLts]\325\020\023"
+	.ascii	"\375A\375\226T8\0375\304|\355\355\024v\231\361\002&X\306\326"
+	.ascii	"\306l\343|\022_\364I|\351\223\360\322'\221\245O\"\207^\207\240"
+	.ascii	"\331\214,\260<x\276\274\364\351\313\343\233\223\326\332\245n"
+	.ascii	"])\200\261A}yR\247\357.u\353JA\357\f4C\2513V\207\315xp\260F\224"
+	.ascii	"\n\316\037\001\247\377\373\356\370\352\370\354\370\350\244O_"
+	.ascii	"\324W\367\034\363\331\235]\361\322\374\342\213\246]R3\021\254"
+	.ascii	"n(\361\021\365\201\332\302\232\363\313\037\321\324\037\241C\377"
+	.ascii	"\003=\375\017\354\350\3377\367\364\351\233\363\321\351\215\203"
+	.ascii	"\251\002\256\013\272\231V\034\260QL#Np\366\305\021\332\021\313"
+	.ascii	"s\302\371\037\310\351\177\320\246\345|o4\034\236!l[\344\332\370"
+	.ascii	"\342R\273\335\024\205\363?`\322FL\355\006\\\372\364\301a\264"
+	.ascii	"\021{3a\261c\230L\016\376A\021\375\373\324`,K\304X\325\341\374"
+	.ascii	"tJ\352\033s_\032\237\233o+\3358\230\t`\003\005\335L\035\034\374"
+	.ascii	"\203\034\372>2\2762\367\231\271\031_[\272\231L\333j/\331i\365"
+	.ascii	"\244\366\350D\267\225\325\207\340\236\333\221\355Cs_K6\025\005"
+	.ascii	"\207\363\353\370\316\374\367\375\352\336\330\304\235a\313!\207"
+	.ascii	"E\315\247\265\032\301\313\321\305\267\246\323\326\274\312\330"
+	.ascii	"\341|\021o\364\237\036\377\354fb\356\275q\254\316\315l\n\262"
+	.ascii	"\177\372tM\323\017\2770US\013\376\347\275\005\220\227\302\336"
+	.ascii	"Wy\326\354\275S:\332\311\031\323\025\005\233\303\336\233\352"
+	.ascii	"\311i/\245Oe[TOe[L\fOg\266\250\266\023\325\227\323VV\372\344"
+	.ascii	"\264\305d:\355%\f\273l\213\371\264\267\250~v\331\346\361T\306"
+	.ascii	"\264\224>9m\252\275\267\366\317~b\242\332eN&\206\247\262-\346"
+	.ascii	"S\331\026\025\206\2472&\252\247\235\265\177\236\234B\230\333"
+	.ascii	"\271\265\204\301F\031\023\325.\313\242\302\260\313\266\250\236"
+	.ascii	"\344\330QA\220\247\213k\254K\231\224h\232\366\344\264oH\375`"
+	.ascii	"b\376\270=9\263\266\233\275\323\347\214\315\334n{[\260\367\217"
+	.ascii	",\246\033&\036)Z\223\333\215\246.LY\035\244\232\270\262\266\223"
+	.ascii	"\333R\272\335\236\236d\355\375\244\311hK\355\275w\bKN\267m$u"
+	.ascii	"[\022\362cG\315\330\373\201\355\334[j\357\245t\273\355\275\227"
+	.ascii	"\366\336-\363\207so\037?OM)\251\275\255\204\244\366\217\245\264"
+	.ascii	"\031{\343\347\0334\252\2472\256\254\021iY\312\232\233\206s)}"
+	.ascii	"\212\312\332\315\355f\213\251\313\226\310v\324\336;\265\323M"
+	.ascii	"\252\034u8_\304\022\375\373\324\304\264E\346,5\261j]\340\312"
+	.ascii	"\244\371\300l\354e\007\233/\036i\2763g:C\r\233\f\234/\302\311"
+	.ascii	"\367\345\351\363g\276.d\315\275\367O\360\r\035/O\234\037B\317"
+	.ascii	"g\346\354i\213k\343\006\347\207\270s\212MM!\311z\246tYF\231\030"
+	.ascii	"\032-*\223\264F\016''Y\260\3408Y\236\204\301R\366\243\363\004"
+	.ascii	"\311\024\316W\302\224`a\303\371!\332h&o\224\260p=\352\336Lq\232"
+	.ascii	"Y]xM\237\024\337\227/\314\347\364A\361Q\361M\361U\361\211\371"
+	.ascii	"\310|`\276(>+\351\3237\346kr\237\023\337\223$r\240#|c\276#&\210"
+	.ascii	"\341\201\372\306|^,\\\352f\225\301\350\262|c>\"\276\"\251[W\026"
+	.ascii	"\313[2\207$:\004g\371\306t\223\206J\335\254\362\023=h3\305\353"
+	.ascii	"Q\367\306\202\323\364\215\371\214\210@G\312\016\216\350\336N"
+	.ascii	"\020 @\b\t\347\374"
+	.string	"X\223\304C\306\3144\210\265 \005b\037\302K?\304\020\375\020?\364CP\351\207\200\322\017\301\244\357A\236\276\007u\372\036\300\351{p\246\357\301\227\366\0259\216\362\241\343u\227\004\347{\340\245\357\301\020\375\356\020x\243\020.\222\361M\"\r\371\210\216F\242\362\227tt\337\327\004\n\025Zx\335\242\016Gc\322\005\030\304\007,\215A?C,^\267\350'\351\002\320\362(\ti\264\004\272Q\210\242\b\020\257\021\311\270\002Q\212`\212\026V\b\n:\032\211*\204\300\021)Ph R\2720\220I\026\251T*\322P4\361\272K\fE\326}\211,^\267\310\247x$\272(\022]\024D=7\n\341*\221C\"\206\202\212\356K\\\0323\334(\204\322\215aD\022\021\303\270B\211|\221+^\267\350\247%\002\372\334(\304r\351\016\r\021\331\t\200\020\201\021\024\230"
+	.ascii	"\b\021\370\200\002\277#\"\222\013\356K|\221\356\213\r7\n1\244"
+	.ascii	"\0241D\264ta\342\210\310E1\304\342u\227GG\304\241\345kt!\"\351"
+	.ascii	"X\344A\214\244\243\361\310\203\020\0020\f@\211\030\"\336\345"
+	.ascii	"\0219\264\022\275G\243\362\210\275Q\210\242\243Q\371.E\270\305"
+	.ascii	"\244\243\241\243Q\204r\231$b\303\321Q\322\361\210<\266\357\320"
+	.ascii	"}\301\270da \225F/\362\330\022\021\335\243\254\224\034Br\221"
+	.ascii	"\330\245\213Dd\241hLj!Qr\005\240R\022y\242\347\347\202\345\020"
+	.ascii	"\210\204<\272\305\341r"
+	.string	"\351\016!\225\311a\321\230\304pD\032\337\243\373\302U&\037p_\342\013\343;Dt\213C\"\"\244{\001\342;T\"\302 \036\223\224\024\234\370\022\213\257\273\354)2\022\265\350\240\224D\236\bR\"*\225&\2267\nQ\224\024Q\224\004\032:&\001\327\345\260(\031|\207\307\242\344z,J\252G\254\373\202q\231\225\222\310\241\254|\223j\321]&\345e{\345\260(\031B\250\244|\227\306\"\227\305P\230$\256\210\341\026\217* [,\211\306#\023C\312\r-dh\201Bo\3701&\203^w\203[D\256\340\020\004\002\207\037\f$Bd\360\t!\204\322u\201\224\304\202\213DT\246x\227\304#\fB\"\204p_\"\f\"\213\0076\004\300M\032Z\272,\226\311\"!\r\002\b\361*\211\257\013n\021\271b\303\211\367\350*\225IC\035\224\356\221\320\004\004\307\"\243\013\257\361\250B\321\230\314P4&\205\032R"
+	.string	"\275\256\212\2421\311!\250\270L@\321\230\344\240B\321\330\002\206\337\210\020\030p\225)\202+\006\\e\n\"\"\344{T*\006}\020\242\305\200\244t[\240\020\332\220\214"
+	.string	"\210(\271\302\003\024\260\320"
+	.ascii	"\202\242"
+	.string	"1i\001\005-4\260\340\203\020\257\222\230\fa\302}\211\305\344\002\212\306\344\006\300\327u\241x4Q\354\240\202\217\353\302\204\006#\240\0252\024\215I}4\301\301\350-:\272\312\327\205#\367\205\273B\nCG\304!\241\365F!\212\222\\\270E\021\305#c\222\013\267\210\\\3413&[\244R\251(\353\033\205\030R\212\030\"\232\240\210\\\341c\342g9<\246(J\006\275\357py\224\204\202[Lz\215\357K\fBr\337\245\222\013\017\274\031\224\356\353\"!\203^0\032\032\"\376\206\206\210\301\367\035\022\271\305\0167\n\021A\321}\335\243$\022\362\204\206%\004(\202\220J\027\002CC\304\366\375\271\303e\021\361(\205{\344\342hDR\0225\270\303#rItY )\211K#\212\"\344\n@\037j\301\347CF\245{t\213\364C\b\200\007\001(\021\243}\211\001|0\200\017\330\227\030\300\210\021\003\b\300\b\375"
+	.string	"\214PK\204\030\201\304\210\241\373\022\217\222H\356;|\335\245\253\034\006\271CwX4&3\274D\344\021\321\372\036\215\352{\243\020\"\206\2100X\016\213\214DG\344\t\367%\262"
+	.string	"*Q4\256P\032\275m\td2\006\nJ\243W/\227\356Kd1\244l\221\311\030(\f)\331\245\373\022\225+\n\025ZP\032\2658*\025}\027 \272J\027Cb\362\005Jn\370\271E\344\nb\362m\337#\32284,\".\207/\321\305\213\240\345\260\205\2421\031|\301h\b\203\250\324\363\202\321\360\347\005\243w9$*\032\223l\321\230T1p"
+	.ascii	"\"%\271P4&{\216\306\025\257\211\2421\3713\344\022\021\001\271"
+	.ascii	"\303\367\310\370\016\2056\260\200ATZ\301}\211\312\236b\321\360"
+	.ascii	"\347\035\n\271H\306\367\247D<r\213@\r@0\210JC\237\027\214\206"
+	.ascii	"C\345\260\247'\310M*\275?\300\242#\2218,Jr\341\0269\034\215\304"
+	.ascii	"\"\fK\244\341\321\360\035\"\225C\304\016G#\261\350\007\203\022"
+	.ascii	"\251T\272\034\206\206C\303\245\013b\0067\251\364\016Idx\301h"
+	.ascii	"x4\276`\244\301\303\321HT\341.]\026J\267\250\310\250l\001\003"
+	.ascii	"ytdB\202\241\273L\312\020\203x\344*\2070\210JC\r\353\321H,\372"
+	.ascii	"\271CG\342\213\"\261(|\223\222o\022r\250D\276H\244\f\354{LB\016"
+	.ascii	"\r\217\216\334\241\341\020\371&\0219\f\337\243\373\n\275K$\322"
+	.ascii	"\305\220\210H+\211FC\331E\"\262\340\036\031\211\220\312$\020"
+	.ascii	")\251\034\036\215H\301\242\353&\227\303\367\350\"\275\313$\013"
+	.ascii	"\024\211Al\321\230\354q\227DW9t4\272GE#\206\344r\350\032_\242"
+	.ascii	"r\030\203\2104$\"\302\360\032\221\214GC\367\002\306\344rHD\324"
+	.ascii	"C4\\\016\211\210~\220\311\030\356\320}\241L\032\032\022%\217"
+	.ascii	"\206G\245b\006\267\210D\032\272CD\345\320\347EJrA]\016\211/\021"
+	.ascii	"\305\322\030"
+	.string	"\303D\321\230\024\266\220\252\220\242HS\244\313!R\251T\304\276n\221\222\370\366\274C\022 \270H\3067\211D\256\320Ct\002\205\211%\020)\311\005\337\021\006\262\310\341}\213\216\306\243\221\210\344\262X\272GCJC>\313\341\t\244R\251\b\003R\322R}\217C$u9|\341\026\337e\273b\205\013\305#\344\020\211u\001\206{\034\"\261J\342\013\325\205\361\2108\004\\\016\2037\n\221\201\322=:2\246@\022\031\211~\257\361\250\302k<\032\203\216)\212DW\311*\337\026\206\216I)\210/\021E\221\350\262@*\225Tt8\246\020\336(\204\361\215\341*\335\243\342\221\230\202\361\215\341\002\275G\"\274\034\016\271,.0DtqtD<a|c\270\030\214o\f7\277\313\2411\351\002\221\213\302M*\265\030\252\320\202\013@w\350H|\227G\243~\207\tP!\037\215-\034\227C\2541\271T\227\303\023$T"
+	.string	"\236 \241\202\217\035\"aTo\024b\231\344\242\303r\270\242\370\243t\337%\021\211].]e\261Hl\335\027\304#\027\222\222H:i\370\302-.\223\\\350\345\320\0352\276pQ,\223\\"
+	.string	"\227I.|nR\351]&\271h\227I.T\367\2108\264\\}\220J\027\002H\245R\221>\201\302D\013\031`\020Y\234@a\302U&\275D\245\233Dr_\340{\243\020II\244!R\251T\344\2760*\213\033\270C\026\037\210\360A"
+	.ascii	"\222\222H@G\244\361M:B.]\345o9\324\340\016\223\222H\300\367("
+	.ascii	"i\351\2628\"\215II\244\f\356p\330s,2\036\231\030\n_H\001\001"
+	.ascii	"\356Kd\201T*\025\001\225\212D\227\005\361%\026}\312%\321\320"
+	.ascii	"\250\310h4$J\036\005\211\222G\303\027\214.@\002\004\243\f\313"
+	.ascii	"$R\211B\351\026\215/\214(\222\222H>\357\260\210\330"
+	.string	"\002il\213\210-\214o\f\024\336\243\nII$\241;\354q\225D\030E%1\205\236\367F!\226F/\021\t)]\016\225\303$\021P\f\243\362%\256x\217.\222\317\317\022x\201!\344\321\211\"\361]\262@\022\031\211\204H\"#\021\020Id$\362y\321\"\225JE\277\367\002K\342\n\340r\030|o\024bX\201\222\321{Dt\215\332\3450\005R\251T\224\201\325\304\367\310E!t\207\216D\243\222\310"
+	.ascii	"a\321=\026\031\217\210\3552\330\242\347\350=J\"\022\375\224\224"
+	.ascii	"\310wi4j\215\226\256\222he\217F\242\nwiD\036}\300#\322\270L\""
+	.ascii	"b\337\345\360\205\213\342\205\213\302\005\030D\245\206#a\320"
+	.ascii	"{\243\020H\245R\321\003\030\222\206H\245"
+	.string	"R\021PO\317\210\021@$\202A$6\364\2208*\2418\372\2208\002\0322\276\304w\211\341\250T\004z!\005\367%\262p\217\222HD\027\206\206\210>\356r\001\310\026H\245R\221\317-\"W\274He\013\tX\022S@*\225\212:\024\035\215E*\216\210I(\334e\222\206w\030\303-\036\215\303\345\220\021\211xT*\0169 \225JE\302\013,\211+\226\306\030&` \217\210\224\356\013\344\317r\350\"\031\337c\022\213\2421\031lQ\304JCG7\t\003\2562E\321\230\f.\215GF\027\304\327\205\2421\311\301\330\3022\ti|\341*\223@\030\214\206^$\013?\240 \t\ro0i\330\343#!|\227\306\030D\337r(\\\266n\321\250|\227\254\233Tz\363\222}\337\245\322H\364[\016\201\224o\013\307\024\b\330\360.\207n\021\361u!\003\261]\266n\021\361]\376\336c\022\362\304\221{T\272\027"
+	.string	"\036\215D\243\023HJ\367-\376(\337\026~\336\345P\037S(\035%\223&6\300 >"
+	.string	"I\351\276I\237\242{\344\202xD\301\207(\271Bq\231"
+	.string	"\rD\311\024\224^\343\013\242R\205\361=\0227\274K$\362\004\"\"\241\273T\272/\216*\\\300\230t\201\210\b\350\007iBCQI\204\241D\246(\272.Q\320{\243\020Ec\222\b\001x9\374I\""
+	.string	"\033\021\200\213\b\300\357\3215\016\031\211\210\\\344\211\2421\331s4\022U\370\216F\242\n\340\021i|\215\313#Q\211A\003\322\370\022Ydp\213\310\025\257\322M\306@\341=2\2668\"_0*\221FAJ\257q\by\3442 \006\021\t\370\342\250\302{4\"[h"
+	.string	"\220[D\2568q4\002\275\303\345\002\\$\343\253\227\013xM\024\335w\310}]\024\313\005\020\337\027\270\\\200\022\361\310E\341\"\031[\374\274C\022 \274Gc\273t]e\221\213\3028\344\242\210\300}\211,\224\224\356\013\344\220\313\002\203\222\212\fHJ\367E\001T<B\032-]\245Q\213\r0\210\0170Z\022\225C\302\027)|\335\245\nH\245\373\302\006\267\210\\\341\016\021Y\034\271/\334#!Qr\205dR\361h\204\341\373\271I\245\026=HJ\3675\376\020\021!\337\244\023CD}4\022U\f\021\331!b\373\032\221\214+(\221J%\nC\304 Qr\205!\342zD\032\337!W\251D\2368B\006\271EG\"\013\337rIL\302@\256\360\036\335!\245\333\302\321\270\242\b<\032\211*\220J%\025G\343\212b\360h$\2528\032W\024\177F\220 J\256"
+	.ascii	"\364^ \035\361&\201\356K|\227\353\210\267\205\240\367F!\210D"
+	.ascii	"\034\221HH\310!\bH(\341\345\320E\317\007.\360\b\027\230\204\013"
+	.ascii	"<\202\210I\020\361\210\030\230D\f<B\t\027\211I\0300\236 Tt_0"
+	.ascii	"\036\021\215\257\361\250\002Qr\005\367\205\361%\2760*]\024K\n"
+	.ascii	"4\270I\245\026EG\343\2202(\310E2\266(\022]#\342\005\220\310\025"
+	.ascii	"\204\226\306\030&\212\222\\\270(\216F\242\n\037\367\205\361\035"
+	.ascii	"\302\340\276\304\327\205\2451\206\t\245{4\022\225-\220\312!\242"
+	.ascii	"\006\245\373\036\031S\004\217\306$\035\203\270\302\207L\306@"
+	.ascii	"\301}\241L:A\224\\\341\250T\364q\213\310\025\030\334\243\242"
+	.ascii	"\243\t\016F\004\034!\225\357\021y\302h\350\230D<\3629B\"O\030"
+	.ascii	"\256*\270\313\244\237wX\342=\032\223\332\030\304#\227\005\f\342"
+	.ascii	"\003\212\356KT\026\271\357\321\230\341\005\243\222\350\036\215"
+	.ascii	"+\274\313$\245\321\013\364\036\223\220H&\334\227\270<\272I$\344"
+	.ascii	"\211W\3505\"\031Wx\335%\021Q\002\334\243\367E*\215Z\270E$\222"
+	.ascii	"\322H|\340u\207nR\251\305\021i$\"\nz\217Fd\362u](\272/\361\b"
+	.ascii	"\231T\272\357Q\005$\2442\005\021\321\003J\344;DLa\364\"\221H"
+	.ascii	".\020\021\365\274Dnq\370r\270Q\210#\322\370\022\225\356\221;"
+	.ascii	"4D\024\261T\"\227Gwi\3012i\270D2*[\030\r\275\306\026\212G\023"
+	.ascii	"GGH%\020\f\242R\275Q\210$$\243\320\221IW)\342E\"\225\"\200GG"
+	.ascii	"He6\032z\215\311\365\035\006`\304{4\266\0371\342\004\005\013"
+	.ascii	"`A\205\036\nQ4&E\274FE\306#\"\021G#\021I\304\220r)\"\004\007"
+	.ascii	"\030D%u\351&\035\021_\260\377{\220P\311Y\324\314\230rD(E\215"
+	.ascii	"\035\036\033#B\"\033t\325\331\321\005tJ\302#N\220\"eA;\266\""
+	.ascii	"sD\204O\314\344\n\2311C\224\350\"M\332\260\204\250\t\002\271"
+	.ascii	"A\007\r\227\020m\t\030=\275\255\265l\003\n\2244Z\\|yd\266\252"
+	.ascii	"d\215\371\232txq\n\362\303Z\267\3548c\005\353\007&\304\343\342"
+	.ascii	"\332@\332'z\013\235\233\215\037\3020>\254!paW?&YJ\227\024;>T"
+	.ascii	"8\031j\313\032\226\036B\266\274)H\212X\341\2733V\362\306\364"
+	.ascii	"\360\300_x\362\220\211\202\263Slog\017\033%\t\2154\234{t\b\243"
+	.ascii	"\354\005\251\302\371*\344\350\311\201#\270\007\254\303&\r\035"
+	.ascii	"\325\017\214\036\233\203D\213Y\325:a\372\332\233z\nz\201\341"
+	.ascii	"\241\272!d\372t\321\232b\323#\365\273\373J\373\021'*X\347-L\331"
+	.ascii	"\027\347\023-_mzj\270\311\022\375\202\243\007Jx\205\365\270\330"
+	.ascii	"\255\351y\022\006\3412\303\214N\017\r \220\023\352\242\206\314"
+	.ascii	"\320\341\253\302#\007\257G\206\260\311M\326\220\250\236\335\263"
+	.ascii	"{\232\354<\020\253*R\327\303\364\236&\\\307\347M\021\2655\234"
+	.ascii	"{\226\360\235\252F\317\353N\nr\364/\334\373y\t\253<\255\316\350"
+	.ascii	"\341(\0362\360\270\340,\314\313g\232\300\330\300\331\351\274"
+	.ascii	"\203\233\272\203\263\320\216\320\216\360.e\206\300\326\264$/"
+	.ascii	"\272\255t|\370\205x.\274\213r%N\032\316\302\350\235\024\326\350"
+	.ascii	"_X\347\207\003D\224\210\025:@6:,&kp\026\316\021\326]hw\241\035"
+	.ascii	"\026\332\251{{,\2255Z\330\374\013\241?9[\366\346\314\t\345\310"
+	.ascii	"\t\261\302\333B\347\243\203>\201\021\316]\030\307\247n\207\326"
+	.ascii	"\025\316\3027B8R\232fr8\3239\231\003S\005g\241\033\241\\WsK\030"
+	.ascii	"\234\241\314\350\223\350\233\270\240[{#\f\217H\233\036_\342\272"
+	.ascii	"\300\261\361\265M\211\223fM\260J\216.'Y\340\202NX\253=5_8\013"
+	.ascii	"\337\204o?\257/\035c\321\350Z\207\311\236\303\371)\230\245I\003"
+	.ascii	"\004\002\243\216Ek\252\022\006\347\247\020\005\r\032 \220vG\332"
+	.ascii	"\303j\315\f\347\247\220\245\246&d\023J\313\262\253\"\274\373"
+	.ascii	"\341\325\264v!\033]\017\0366q\244\340,\034#4\003\226\306\353"
+	.ascii	"\216\031a\0311;\270\322\336\3200\242\006\f\031U\215\016\223\002"
+	.ascii	"\206#\205)0`\204a\360\006uA2h\\\027\234\303\264O\254\334\331"
+	.ascii	"\362\204\363U\350u\351\"D{A\307]\335\227\306q\247M\324\331\205"
+	.ascii	"hg\302'\2369L8\013\277\\-jJJ\024\316B/\351^\017\233(\232h\n]"
+	.ascii	"\207\250\311\031\202\363U\27413\023*\361\340$\313\256\np,\013"
+	.ascii	"\323Y&K\026\341S\203^;$oJ\033-\027>\323\275;J\322\320\250(\033"
+	.ascii	"\033\023\226\345\351\270\253\263\253\342\004\216\360\312\205"
+	.ascii	"egd\344\3504\301Yh\345j\302\274 Nt\340,$\023:UDM\231\"\244\362"
+	.ascii	"\263\364\343l\202\233j\246w\274\346\304\021\273\220\212\225\250"
+	.ascii	"5<"
+	.string	"8\013\303\204I|\310@\215\345\301Y\b\366\2632V\274@\355<y\"\224\202\267\225\336T\256\034\201\376\b\202\027\345B)t>_z\\\252p\026Bqk\322DX%\302\266\253\242V\365\230*\002\246\331\374\311Q\332\242\253k\261\250\316pe\351\352\022*\001\201iWe]B\306\331$\364\272P\311Y\360\211\251\016\025\234\205F\204I\270\266\310\355H\"D\222&\244\213IJ0\357\252.\356\b6\242>\331\002sK\301\204\213KHdJ\230%y\321\237\227!>\354\f\271\220\310\331\223\310]\032\316B!\352\0266X?R\034\321\322\002\002\321pG\r]]\020\314\225]\036\316OQ\005\004\2100\310\317\222\025\tn\214\375\260\302\242DJ\207\020\353\302 t{oX\316\370\340\004\235l\311\260\303\371)\232z\364\020^\331a\243\350\200\003\r\215\035\250tD\321TG4\272,\206\002-\0052\306\030BV5\215"
+	.string	"3\025"
+	.string	"0`H\036\222IuYt\017\024\200\f[\262\200\204b\033\316\264$\211\220bD@\006"
+	.string	""
+	.string	""
+	.string	"\001\b\240\200\002\227&\362;`Y\t>\376\324\321\232\332s7A\245h\273\221\262a~B\250x\201&nI"
+	.string	"\274\207N1W\034\352BR\025\177(\362\220\201j?\320\250\246\365&\rfU\271\006\310\017\213\005\306\217B 4d\212vkg\234:\020\321\017u^\221\237T\272\331\206\207\0047$\024S\022\003K\342\305\362\303P\374\310\253\371\351\237[\013\266\306\250,Z\360\007\b\2460\270\252\225`y\037\346\f\225=\207*:\202\362\353\330{V\327\360[JF\026O\342\370\\.\242\225p\244\266\032\350g\202\270\037\235NWU\276\277\335\027T\021\240^AVQ\\K\223\331oF\343\023\315\216\312S'\264\341\312rjj&\270>\323u\261\370\202\227\215^L\360"
+	.ascii	"\221Q\310\226\3755,\314p47\250l\215\362\276D1\233\tAlB\376p+"
+	.ascii	"\023^cP\034p\325\276\231r\f\314\216J\341\351p\262e!;3\251oC\265"
+	.ascii	"\003\031ga\334\016\226\205C\0133\215\024\263\005yR!nz\377\237"
+	.ascii	"\335\247\022\264\t\263c\340N\337\034\005v\345;.\370B\244\305"
+	.ascii	"\331k\352Z\\\246\034ZX \227\034\275K\006\354X\037lp\"|2S\215"
+	.ascii	"\244:\277\203\301\346\370\252g\345\004)\361\216\213\224\035\317"
+	.ascii	"~\202\2162y@K;\265B%\027\273!WUCN\355~k\232\261\255ZGi\205\016"
+	.ascii	"bEM\353\024\226p\0051;vr\031\275\351\337m\320\001$\037\211t!"
+	.ascii	"\217X\357s}\300\330\022\252X\233\331^\243\2004\245UC\374\253"
+	.ascii	"\034+\026\364\343?\321\024\250\023\352\b%\036\022q\327\266-\270"
+	.ascii	"\265N<\310\223g$\274\203\214\306\034\177\036\327\257\202u\346"
+	.ascii	"\302\263\203\002\344\331{=\335.*\340\265\232;\357\321bS\261&"
+	.ascii	"\237\3513\035@)\022\t[\266\372z\315\022\342?@\232!\3118e\375"
+	.ascii	"\025=\235\325\345\243\017\370\226ax\223(mCy\360b\256\232:\031"
+	.ascii	"\224\0223\230v\023\006\251?%X\220]n\212\307v&\fK\223\260\326"
+	.ascii	"he/b\350\302\206\210\020\222<"
+	.string	"\267(1\240 \353j8F\204\256\252H\330\022RC\245\307C\270\300\022\337\351\366i\251\233\001\264v\267\310\200\002\245\207\f:\317\333{\351J\347\261A\240r\376\021\"-\346\f\224$r\221F\356\212:\327\013^>cE\312\326\216\023\203\354\304o\201?\251\024|#\256\226T\237\367\363\327\344\027H\033\204y\220\021\020\267J\230\360,\316\212t\231\334'\\d\013\256\020|\246\\\b\025\2023\365\365\004^\312\346\255\203\330\316\264$\261F\260h\3523\273\340,]\371\323O\2075\016\256\023!o\303\325\fP\331\271\002\243\210\035-\023\337\006\347\224\032J\023\355H\213\236\313\020c\240B\360\007\364\230a\376s\224\037\234\t\236b\254EYZ\027L\024\f\331\256\350M\204\232\360\003-\224\003\2729K\367\234\350\352\250\340'%^\333N?\025(\236\210\352\3461\354\305\331\236\253\357\247<?\310\3613\b\003\3004\312C\274"
+	.ascii	"d\314w\235\016v\003\261\214\225\373t\331\245\216\363\367\033"
+	.ascii	"\253M\305\222.\240/\232\0349\274\247*\250\333\272b\003h\205\375"
+	.ascii	"\303\373\025X\217\301\256\246@\321\324\"\217\250\301\0135\365"
+	.ascii	"i\365\357G\375q\013\325\346\\Y!r:1\274\315\332\261\205\002\354"
+	.ascii	"\234;|\312\317\262Z[\037\321\240\255\026LUN4\224=\322\262\232"
+	.ascii	"7'C\021#dg\213K\2221\200\350\262[\353\362A\330\013\037V\260\216"
+	.ascii	"\343C\252\276\334c\003\327\343\355\257\270~k\370\313\t\351\331"
+	.ascii	"\362\364\260Qb\316\231@X\252 \002\023\322Jw]\\\357?Dh\004\226"
+	.ascii	"\206\377cf\020\320'b\377\\lz^o\260\2412i\250\n\243\343\036\343"
+	.ascii	"\237\216\356&\362bm\345\306\207\335\342\320D\345P\315\314\243"
+	.ascii	"\225\035\256s\226\360\036\275et\304m3\260\263n\350o\221+\265"
+	.ascii	"wc_\341F\r#e\016\213\331\362\320Z\260\0214PS\201 A\353\216\272"
+	.ascii	"\303\210\020\206\266\274(\200p]4\356.\177|d\245r\321W@\271\021"
+	.ascii	"\340J\346\3024\032\355Z:R\206\"\300\252\331\254@\2530\215\303"
+	.ascii	"\r5\026;\3763\031\302\241\t`+\354\031\224\351v\331\325|\363\360"
+	.ascii	"'6\340Y$9 \3219\235\304\237\236a\365|:\275\r\304\351\254 \205"
+	.ascii	"\213\006\301\371q\212\274t\313\25238\360\306S\210\311\316\201"
+	.ascii	"\220Fk\243\2477\252\372\027\nh\343\035\025\316\3266\264\021$"
+	.ascii	"\021\267\225\224\270\023q\322\\\037\322\300(\244*8\371`1\007"
+	.ascii	"S\225\024\372\223\255=\377\277\025\005K\317{y\025\222\244m\345"
+	.ascii	"\307\031\032\352^:\020\204f\211\272\005\227\304\243\372{\261"
+	.ascii	"\351i\366\275\254\203Z\330\231\024\335\213\261\264~\374\034\320"
+	.ascii	"G\236$T(\250\314p@,\371\001\350\033z\034\225\203,\375\177\212"
+	.ascii	"?-\346\272lg\274\231X6\266\274\257\317FYJ\237\211\b\307L(T\202"
+	.ascii	"\223\274\312\231\306q\233\322r\323\260\254\246p\3171\275\201"
+	.ascii	"j\2330`\255A'GZB\013\026\346x\027R\257P\222jA\005r\370>.Q\253"
+	.ascii	"\272 W\261l\362\233\313r\232\221w\007A\361\232\352\260\270\202"
+	.ascii	"\206\025<Q\353\033n\240\255\356\331\324KX0\305Xf'\2021\033r\006"
+	.ascii	"R\226ebZ\353S\371DGLM\243\240\033\234En\312\221\260\013\251n"
+	.ascii	"(u\254\332\"N\323\346\036\246\364\037\001\037\237\021\333\032"
+	.ascii	"\250ZB\226\204fO\027DAE\323\360 \374\217\302\240Z\033\023\261"
+	.ascii	"\\\211\337%{\304\356~\356\205\tx\345\306\305\212\261\311\263"
+	.ascii	"IF,\226F%"
+	.string	"2\001JP\304\355E\002\004\017\320\021\377\230\207\352\354g\376\003\302K\030\310\2247\220\210\226\304\253c\257\026l\203\247"
+	.string	"\220m\277\333\202\\\347k\227\234\002\230\372\347\313\001!\271\207V|\274b\357'R\255\225;!\371j\217v\016q\337\275w\245\314h\300\332\017\3210\251\326\207\253\376\221\257\266[\213!\327\332\007D\214\232\1776:\207\267\253\317\2417\177\2115\344\350\037\352q^ \267_\233c\177@\t@\3206\370\006\365H\373`uP\036\346\310N\357-\f\322\345xP\370\271\263\006\332r\210|Y:\324\254\314\200Q4!\332\243\2070\240>\300\003}@\f\267\356\336\300\030\207\271\217!\316Q:v\310K\342\242\035\001"
+	.string	"\212!\244\221z8T"
+	.string	"\236\307W\034\351\370\326\030\354L\352ZNU\026\302S\257,H\214\265\350\347P\251\240\177\342\273\273%$\357\n\300\243o\300\332\351x]\344\270XF\275\325\330&\263\004^\217\215-R)A\002\224(Hf\032{\333\027\b\314\026\264\333\222\303z\n\364\302\377GT\355\"\035<\301\201\341\222\016JW+\2120\325s8"
+	.string	"$p\340\337\324\316v\225\337;\207\023\256\372=\204\225t3\254"
+	.string	"\356\247`\367\317\026\004|JB\316=B\336\333\301\335r\307\240\242\250q\344Q\343\340\375\366\024\370;\332t\020\371\322?\342p}}\335?\252~O\352\240\272\n\033B\274A\373&\277\021\335\303\206\327\236!\037\313\355\234M!\007\273\253\335\313\006\232\372a-\272(1\360\360\302\b5=\212\037\254\3216\377Q#\305x\330\324\301)N\335\034C\212\2502f\030q"
+	.string	"\352\375Y:I}\354mC/iX\263jfk\336\231\fG\202f]%\235\024\001\332b-d\235\377\003\222\206)\215\006?\233\273N\3162.\242\317\023#\337\240\b\bKY\217\362\032R'\372\351w3\360r\241\310\244\335\363\305\357\341V"
+	.string	"\003\027\205\f|\377\213\3436n\260\215\343\370`\366\223y\2531\254\275S*-U\003\344\301\345^\234\270\357\362\"'n\265\231cK\211\037\311\241\217\251\023\310Cq\311\371MNL\315\230\266Aslg3\344HN\266\336\373os\251\360`\276|6W\205\333\034\201E$\\\316\030\277\007\342\367Q\301\001W\244\306\276\016\362\241\365\032\354\b\t\032[s\273fM\013\244\221+\230k-_\t\312\3212\"\320%W\352\r\303\037\004S~)c\225\201\233\210y\307\007\367j\036^\0054\250\032\265\365\330\004\036\270\273\3234\033\\g\264\203\237O\300\027\257\266~\006/\367\232\3220#}\246\310\310s^HH\322\3752l\224\016\347\242X\312H\333\b\004*\037\355=\030\030n(}\t\216\311\0060\352v"
+	.ascii	"{e7\376\244.\340u;:m\250\271%&\333\211Q\260\274\323WE\323q\024"
+	.string	"\brzI\023\217\204B\242\t9\376\261\326\357\375\220\020\"\340N\004iP\212\255\236\003i6\355%_\033k\363!\252\206\323\026\t\225z\325\200\253\313\204md\003\033\325\026%`,\035\301\267Hu\315$\bD%)\244\345n\270\2519ET\300\330\337\003\242\260Uc\247o\324\004vR\030\364\254\020~;\006\016\243\346\374s\005_\237\245P>\235i\334\371AR\364f\254\231x1,\336\243)\002\334\317\255!<O\211?\025\340%#`\001\256*\314\t(t\200\344\263\324\244$\025\261\272\271y\236\272j\355.\373dy0U\236\366G\017\022+\307\3450\206?N\"\374;\213\036\246\355\277\375\247\202\225>\030\032(^9\210\233\256[\312.H\215\004\332\246\367D\302t\341\001k\350\024A\314\205F-E]Ns\206\313p\3576\307\250\260<e\320\232+\216\322\005';\231\346\317\220\207\311\302\246\b 6\003"
+	.string	"\017h5z\262\003\006@\205,\315\224;\315[(\253\021\313\f\331\f7\316\351\204\017'\243\034\202C\004.\342\322\223\347#\034\350\260p\017\322\256\026\f\203\266N\271\b\242\201-D\371"
+	.string	"\003<O"
+	.ascii	"\243oj\r\333\330\367\252HAU\310\376\335rj\244\270&\034\272l<"
+	.ascii	"\006t\025%\326gT\373\023\211\371W\245;\374hF\224\215\317M\021"
+	.ascii	"\017x\276 \341\243\213\240\315\360\247\257ax\265d\215R\347\362"
+	.ascii	"3\201\\R\\wP;\353kc\025 qS\r!\036L>w\036\316>\214\270E\251e\302"
+	.ascii	"\036\315\030\030t\344\257\020g\024\006\266\b@h\013E\001\333-"
+	.ascii	"J\310\023\217w\022\211\013\265\266`f\364Q\307.\331\b\"\231F|"
+	.ascii	"y\235AC~\277\234.\274\265\256\"\006\310(\031\b\323\221\214\243"
+	.ascii	"\207B\347\332@\246\025\n`\301\264F\262\201\223\320w\243\270_"
+	.ascii	"'\207\241z\320\305\004\025:\324\362cB\320oqZ\265\370\007?\374"
+	.ascii	"\330\366\376l\341\270\332\210\302\314\025\353\357\375>\337.{"
+	.ascii	"\b8\317\274\343\262\006C\205|\232\265\275P\2731\234\371\b\272"
+	.ascii	"!c\025\347^\364\214O\343\223\277\252\026\242DU\375A\356\306\031"
+	.ascii	"f\026\322=\222!\253R\036!\177\020\270s\177\261\230\3610\224\300"
+	.ascii	"\230\013p\244\220t\341\245\005\022\256)\354\3409!\377\016ev\025"
+	.ascii	"6;\342\032\200\316\3670+\3659\336\314^\323\202R\273\271\236\016"
+	.ascii	"\360_\331}\332D\301\220\2524\312\250\201\361\361@\321\330\220"
+	.ascii	"\024D\024\307\275\207\227 [O\017c\0256\377\370\3463<\025\307"
+	.ascii	"1\300t@{\032o\246\270O!\311\222(\370\032\320\302K\3600\365I\353"
+	.ascii	"\343]\nd\200\243y+\363%#Gx\30750W(\324yb\r5\177\030F\251.\262"
+	.ascii	"\200\250\230\351\317Xd\300\232\273qq\363A\377\260\361R\205\320"
+	.ascii	"e\330\322\265\002\302\340\345\003\013\212w\233,v\217\236*E\307"
+	.ascii	"\035z\210\224V\372EX\317\344q\3215!\026\246\2502\324\361\034"
+	.ascii	"1[sOvD^*\346\177\310\250\331M7\031\224\tNzJ7K\240\273\233\034"
+	.ascii	"\360\235RL\374s\303\004\252=\222\316D\236\b%\fKr\022(\331$\221"
+	.ascii	"5$B\255\274n%\242\025n'\361#\031k\021\"\0035N\260\372QGz\266"
+	.ascii	"\036\0365Ud\254\261\350Z\007\355\032T\036|}g\313\352\325\036"
+	.ascii	"Fg\340\277\362,"
+	.string	"\257\006}\300 \201\001e\253\n\244'.L\b:\260\205\021B]+Ii T\343*\367\t\364\023I\363\023}\247\037\215\322i+\335\350\312\035\237\310`A\004\307\214\272v^\246/\374,\331?T\2004i\267p\337\261\355/D\266\243$\375\b\242\366B2t\324\271\355\032\370\377(:z\217:\033B+\006\337\003s\263\273M\227\306\356O\313\032o\370\004\241\261\375\2412cF\221\212&\364\330\233\217\225\361\226\024\375\231#)\262\003\273|VW\306w\212\364@i\335\362\370vk\025\341\206\222\001\222\243\036ADI\004\346\272_\231~\2566\305\364]\2205\273\275\204t\314\337\205\363\206\346>\034\0202\214\201\373\277\300\036\361Vs\301<\221\350\326\234\235eV'\335Y\345c\221\r~'\227\217\3351d\340E\354\242\354`\364\251%8\002\235:\326\350\326\346A\330\246\023\333/c\"\203\004\336\355\177x\214\030\221"
+	.ascii	"\353\3435lP|\351\020\031\2717\232\177\032\021\201\336t~\374\273"
+	.ascii	"\317\312\017\rx\231\022i\002\247n\267\346\n\307\355\272,j\257"
+	.ascii	"\204\205?Pa\206,6\016\225'\247\263\242UQ\220\2100\025\214e\376"
+	.ascii	"&a\316\236BI\341r\232^\321\267"
+	.string	"\r\351\205\257\326\341\263I\b\360\302\345D\331O\212\007\352JV\224\224\023[5\007!\3000\302\234\271\333\362\320\3701,t\021\r\026\005\201\265U\240X\256&\311\370g\347C6v\324h\337\333\213\326:8bf\360|\001\266\345\375\320\350\034Z\244\026\352\362\313\201-\316\020\306m\241X\016\260\346\253\177[\220.\030'j\246\027Hne\351kSS\306\025e\247.\310\t\253\255\034\003\312\322\225\364\236\016\r=\033\316\025\004\330\2262\325~\3143\306*\312\204\367$\030oE\355\327k-\177\275\360\211\026\250\363M7ng\037\027\351\253\226E\016!\364i\331J:m\017x\213\245\3136\356\205\363\211m\331\216\030\036\216\332`\317\213\342\332\201\233\341O\227\362\254H"
+	.string	"x\370\250s\314\013\334\375\026\326J\354\352(\300SDnd\234\254\234\24022\0073$\016\267@DL\273+\324\b\301f\215bEtjB\306\344\363?I9\225\252tj\207\245\307\036v\376\241q\366\026\323\230\007!\344\265\224\305\222H\325\013\345,\263\275\334\200\020\023\017s\001\274\316"
+	.string	"a\037\237\312Fv-H\227\266\001\2720\345\375\372\205\022B\375*/\036\324\017@\372e\266.\t2\230a>\2102\271\004\306\367Vs\304G\211\372\255\"\033G\253\264\260\213\004"
+	.string	"\030zo\036\360p\032\321\376BM\340;\302\341\023w\261c)\275\266\377.\203\377t\355\223E\331 Xs+\013\3218\265]>\213F\317{XEu\275\231\251ai\277m\321[\220%e\220a\236l\310\215\021\275\244;\3423_\036\021K'M\325\225b8\334\323\310\335WApG3\272\347s*\rq\221\214%\264\305;\236\331\250\352o>=,X"
+	.string	"y\3431\273\236\273\307e\351\032<\365\272G\303\315\254\335t\346\030}\024\002a\345\033\245\033\332\001YoK\270\276\323\260\347\365L\274n\336\326\002\300\020\327\024\337\303\275\377\200\035\341\375\267=\304\326"
+	.string	"\264)`\215\363\202\345\276\333*\t\243\320\314fuf\017>\017?\317\336~\363\f\340\207"
+	.ascii	"\t\033\342\007\034@m\345=Y\036N\373\202D\334A\225lT6\323\245"
+	.ascii	"y\021\347%\017e\231\003\b\206g@\374\274\303ly\272\353\024^l\311"
+	.ascii	"||\006\334+kL\344i=\177\366\360\360\275\f`\260\203hY\324\177"
+	.ascii	"L\361\343\275a*\257y\303tE\005\017\357\270\330\203pBW\311@*w"
+	.ascii	"\335\265dV'\333\342\002\t+\257\323\256\354\333\355d\001I\013"
+	.ascii	"\277\022>b\321(*9DHEMd\246\016\276\036\223\255\0028\202\324\231"
+	.ascii	"\007\360_\274Um\0078\033\300\275\361\236\002\t\031\234\037M]"
+	.ascii	"*\265\311\242\016v\001\213\315t\034\360\320\005\262\215\r\223"
+	.ascii	"(\353\254i:\005hKOB\256\n^9\f\271-\370"
+	.string	"#\\\341\310\232\257\372\302w\333\235\fH\030r\030\210r\316T(\343\226\027mg4-\201o\2454 \2005\331\t$\243\007\305\031e(\237\304\254\342\365\024\256\003>)N~\305\221P\336\347\026\254k\220\361\205\224W\255\210\237N(e\331{T\275L\312\342a\314}\302\256\020!\3215O>\347e7oN\346\320\"\370\360\217\261eG\270\261ZR\rU4\376\344\351\204=\206\372\273\302\370\315\271F\343\247\360u\346\311\007\261j\326O\034\301\f\321Fh\335z\336\324\326Z\372\332\001\230F\267Xy\201\232\024@<\373\301\253\302\352`*&Y\232\322\354^\222\244\377\030\362sC[\302J\241>A<\252\237uV\312U\345\266s\206\223\202H*\315\230\255\036j\352\342\2356$\017to\371\336\363\272\355\267\217\233\307n)\301\376j\0226\213k\353\300#\364\236\027\361\221\005e\243o\262\244\310\013\212\331Be\364"
+	.string	"@L\226\315\376\332\001F\264\353`\265\225\324h\240\031L\207\312\326nH\356\276\351\225\222\366\347\321d\313*8'\201\310\244\330\224\224\325\rr\372\265\025\232]f\2476)\372x\264L\016,Fdd\0253\3758OiyT\345L\b\350\3052\263\223-\346\026i\360=\315\352\306\347\213h\276jt\347\336\370\300\227\323r$\341\311\343\032\225\272\200\275t6\257Y\340>0\306\231\357\352rD\360\363\035G d\336,C\323\313G\343\266\374\332CK\236\307\201\235\013\346\033\026\247eT\216\320\345\034S\272\307\232\253\252r\245\220\347\\c\013\3612\273\2235\2333\317\316\247\030\327"
+	.ascii	"\006\316\0016\240\013L\323H\3775\016\220A\276\301G,\316\227\361"
+	.ascii	"\311\n\304\373\261h\321\302\020N\337\300g\366Rx\035\002y]_\""
+	.ascii	"\365\241<pVb\025PZ\310b\366\227|^\177\322V\323s6\245\332\030"
+	.ascii	"K\006\347\211\322p\331\342\250\355\372X\325F\345\334\352"
+	.string	"=\330\251\213\224V Rr2x \353C\304{\241\341\206\205m.u\0234?9E50 (\327\024a\326\345\n\207?\031\270\220\303QuH\2458\263\256\320c\222\2308=\003\230\254k\253\006C\020%xYe\217\306\bN\355\232\205|\001O\267\020\035\236\236n8\r\270#\215x\302\373\275\207\317X\233\005\247D\313\371j\003\366\224\005\274\025\234\213\033\360Y\254\266\337\001\200\022p\016\276z\026\271Nt\306\366\350N\216\271h\001\231\214IN\246\n\241a\345\350\006A&^\207<\267+\271\327\200\n\210\235\322\232y\244~\256b}:\254\021\316\205m\316\270\241\321\033\333\360\037\243\262\322\035\306\201\034\372HB\331\033\037\r\2264\370\376\216\327\\K\357\252\342\366\210\335\363\204\212\231\340]ih\265v\240\245\225aC\242\2450y7H\324\037l\222Wk\016\342\303\n\255\312\266\3376\214\363\323'#\3615\207\246"
+	.string	"x4\304\313\342NTc\264\0332\335P\343b\2055\033\232\374\307\031*\340\036S\001Q\317\021V\200\bn\177\375\242|R)\303%\256\300\342\202\037\234\200\217\020\361\3169\226w\343\356\033pa\347\036Q0g$P\265]-\343\024\244\326\375bz$\350,\203\3600T\016\002^\232vL\1777\034\2363zq\330#\313\360D6\200Jy\365\225\222$k<\017\357\235\235\216{\025iC0\224\226"
+	.ascii	"\347"
+	.string	"\304\374\321nj\242\225(FxN\220cb\337\006\001m\017\003\257\224T\020%\376\355\304\255\357!\024<\247lK\354g}5\216\022rcb\333\232\216yVlYZV\370\036\361\347\340\231(\253%%\317\371\304<'y\034\357\276\021\330;\241VBR\njiX\260\347\030G\317\b\255_\224\007$\256V\244Y\n\360\027x\331A\242\375\311z\377\360L\204\370\223\255;\346\305\275\262\315\214&\311\217\350\016a\t\302\330f\304+\320\311\330\377[\210\3375\370\231\037\303\304\331o[\370#8\214rsc\201C\0311\361\237\364\276g/\345\326\231\231E(\204\003\340(\377\363'\002n\273z\356t\200y\332\334\017\276H2&\t\315-\356\323\267\201o'@=h\210\233\274\215\251c\307\305jT\227\f\257Z\360\363\220\370n1\303\305\331\260\"#3\357\250\237^\033\213\001\213\0219\226\212Ii\300\006<@\0070\273"
+	.ascii	"\226{\303\025\242\252\220\307R\245'\307\332P\022u\253jB\277\241"
+	.ascii	"Uq\r\266\206\316\n\206\201\026z\376\370D\346\346\237\357\221"
+	.ascii	"\216\251\255\0040/h\256h'9\317\353\264\024\007cjW\205\270/\272"
+	.ascii	"d\210\200\263f\f\334\203Wa\264\251L\006\201`TK"
+	.string	"\303uta\371\351\025\004\251\351\253\310.$Jg\241\302\207\213\322\364\367\246\201\332\224\033\033&lach\324\017\233\313\020\352\345\313[\313\"L\217A\345\312u6\341\221\354671O\360]\302+\346\t\340\224\321\373\224\235fZdl\246\356I\237\211.\332H\007\007\021{:T\263\03403`\364Z\277\362H\235\3455\300\200@\215\351\312dA\201\336iXpt\215@\373\270\004\270\013\013\223_\230\255GT1xz\363\034\251}\324I\030\r\016|\260~\237\372vnu4|\256\022g\342\032D\215\024\345\fk\002%`W\327\243\006\306*\234\216\371\307\255\245!,\262\316/nX?\256,\362Bk5\022A\344\217\234\fq\237\220O\244y\025\266\027"
+	.string	"2d\024\246\246>\217m\235)\244\032\257c\343\031\nI6U\256%0\001#\235%\252y\007\321\352\277Zq\346\033\211w\006\0133\252 \342\363 f\330E\347\t\3016\343\361\217pI\333\316\bt@\267\332#s\230*\250\022 \177nB\277\342\330<\017G}\020\332\236L\245\227\223\235\227"
+	.string	"\261\002p\340>\325\274\315\312\351\033\247\322\252\021\002o\023d\005U\261H\005\223\0212\322&\247kx\331(\264*\363\220Y\223\352\016\217\210I\316\3227\330\210\023\321n\031m\205i\247\247\266$\317\004\323Fz\307J\232\355\347\001Y\276D\254\301\016\221f\223\310\267\324^\363k\206i\177\267\200\3532\211\206Mg\031\327\346\356\261\361'\314$?B>\030\275\232\237m@E\242(\355"
+	.string	"\213J8\222\250(\fe\341\262\334\013\310fh+\264"
+	.string	"\264Q\033\376_\223\257\303\027[\244:F\201\300\323\307Vt7y\245\2655\027\230\324\361\310\377F|\206\245\343I\272\017p0\273\037\203e\022p\025\222\217\223o\007\b$\001\b\366\005\262\017\267\343\\\300\323\004\326\321u\013\3048\322\371"
+	.string	"\022\305\320\004\251g\272\356\343\001\270\bG%\346\327.\364h\2679\203\364\315\030\333B\266/\355\242\333\303\240O\245\346\220\373\205\254\tJ"
+	.string	"V\022\210It\032irQu\241\207-\270"
+	.string	"?\335\n\366\241\323\337F\025\375A7\201mY\212u\023J\246Y\272Px_{a\355l\244>+\256J`V,v\033T++\251v\214\310\247\214wtTff;w\3003\2108`\022\330\265\207\370\260\262>\260\257X\260\360/\013\275\003\327\230\247\220\2637\207\254\331l\216d)\363\264(\310j\336\337\017\345W\351t\220C\301"
+	.ascii	"\033\224\177u\357\021w?\353a\333\275\237\007\177\354C\324w}\275"
+	.ascii	"U\241\233\021J\303\301]\334#j\b\341\267\200\345L\264i\277\247"
+	.ascii	"V\374n\006\310h\203\374\371\231K\025r_$3\346\324?lY\217H\r7\272"
+	.ascii	"\335\226Q6Dj!c\247\001\314\371\241P?\202\024\301+\260\376\374"
+	.ascii	"B?\370\326\377\373\017\347\377sy\215\035N\240\203\201\210\017"
+	.ascii	"\365\237q\340\365\225\371\373W\336-|Pr\026<\374\323C\243\203"
+	.ascii	"\317\204k,\343~\264\327g\225 7\320\312\1771\224\240\357\253\246"
+	.ascii	"U\343\364\304hp9\031\201u\f\325\021\355\3712@\377t\362\021\332"
+	.ascii	"3\322\323\371X\375\374t\353\213\275w\227<\316A)\216\305\303m"
+	.ascii	"\273\314\035\345\353\344s\273"
+	.string	"\225\236\273\230_\321\373\256\264\016\347\376\353\356\376\350h?\246\033\f:\277\342\301\207\253\3740\355\013Y\311Fn\351\b\310\340\331\001\376\365}\361\240\364c\274\200\253+}\272I\375\251\375\260\223\272^\355\355\356\341?1k/Xm'\205a\306Z]\312\353\314e3\200\307\344\231g\335\342\b\214\265F\227\177\220\374\215\265N\353\214\371:\265\275\221\255\036i\027\232\023\323\362!\327\\\220`\207\226\327\223g\3267r\312L\337\300\376\217\215G\035\033\324\340\233\\>/\311}\361\367\215\321\t\340\237+9\265\236\355\331\315\226\353\377\323\327\tI\306F\340\020y\303Z\331\224\245\036w\372\316\351YJ\373\271\332Y\351\232\310\376u\t\253(4n.y\366'\b\273\371\272<\346\334\236\373m\376\260\177\257\347\377g.C\200\335\363`\256\350\005\341{\013\275M\3570\307\274\305d\027\341p\276~\323 ^\274\f\271\237\262\353\244m"
+	.string	"Vw\322[Fy\234\354\327m\304\3572\361\t\020\237\235\232\022\367{\262\r\344z\213\371\303v\347\320:y\267o\324\237\277\315\202\271E,\217\356\201\367\272\267+\361\325\206)\370\374+Oq32a\267C\344Ni\343Q\314?\303\312bz\253\036O\314\033K_p\302\227\204\266\224\313\031\340,\007w\0060\256\300\205\317<e\350\217]>\274\307_\276\036\357\330\307vo\277\234"
+	.ascii	"\263\242\274\344g\272\324\177\275\362\207\371Sp\263\030'\216"
+	.ascii	"1\355\254\007\373e%\372\t\374w]\361a47QiG>J\016|[\244\344\213"
+	.ascii	"\232/\363\227\201\216UVO|n\355\020\214\177\005\356\035\377\021"
+	.ascii	"\323?Bk\210\316\374`\214O\361;h\033|\236\347\321Q\0326\273\256"
+	.ascii	" V\327\030\372\262\3566V\235\321\366\340\"\036\224\252m\030P"
+	.ascii	"\034\250zC\3766\367p}<\262A\256R\007y\214\232\333'\276(3C\330"
+	.ascii	"\234\277\372\"Lq\031$\177\021\263\245j\333\222\373\216\362\352"
+	.ascii	"\\]A\313\236\274\220\022\030\234c\257f7\342\365\376\003"
+	.text
+	.section	.gnu.lto_.symtab.569c92f8b8586711,"e",@progbits
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\005"
+	.string	""
+	.string	"pidRuntime"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\004"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\005"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\005"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\004"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\005"
+	.string	""
+	.string	"pidOsdAntiGravityActive"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\005"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\005"
+	.string	""
+	.string	"pidGetSpikeLimitInverse"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\005"
+	.string	""
+	.string	"pidGetFfBoostFactor"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\005"
+	.string	""
+	.string	"pidGetFfSmoothFactor"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\005"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\005"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\005"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\005"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\005"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\005"
+	.string	""
+	.string	"acroTrainerSign"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\005"
+	.string	""
+	.string	"applyRcSmoothingDerivativeFilter"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\005"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\005"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\005"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\005"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\005"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\005"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\005"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\005"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\005"
+	.string	""
+	.string	"dynDtermLpfCutoffFreq"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\005"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\005"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\005"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\005"
+	.string	""
+	.string	"pidGetPidFrequency"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\005"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\005"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\006"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\006"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\006"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\006"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\006"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\006"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\006"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\006"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\006"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \005"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\005"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\005"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\005"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\005"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\005"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\005"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\005"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\006"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\006"
+	.string	""
+	.string	"vectorRotateSmallAngle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\006"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\006"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\006"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\006"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\006"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\006"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\006"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\006"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\006"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\006"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\006"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\006"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\006"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\006"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\006"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\006"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\006"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\006"
+	.string	""
+	.string	"applyFfLimit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\006"
+	.string	""
+	.string	"shouldApplyFfLimits"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\006"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\006"
+	.string	""
+	.string	"interpolatedSpApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\006"
+	.string	""
+	.string	"getRcFrameNumber"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\006"
+	.string	""
+	.string	"filterChainApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\006"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\006"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\006"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.569c92f8b8586711,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1309 @@
+	.file	"pid_init.c"
+	.section	.gnu.lto_.profile.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`q\002\245\b"
+	.ascii	"\342\007\036'\200M:`\361\225\233g\250O\301e\"*\271\204\213\236"
+	.ascii	"\006\324iC\230\002\031\221\021\031\363H\020-B\310\226;\311$e"
+	.ascii	"\210Xf\262\320\b\027\226\2256\221\201\255\326\365\345S\363\257"
+	.ascii	"\366\377\036\262\241aP\230OQ\220\020\202[)\t\244\022x\231\377"
+	.ascii	"\237\327v6X!\013'{\3506\206\347\341\266r$:\333\321\350\333VW"
+	.ascii	"{\322\230@j\247\321\350\005\210.\243\017^\250\205]\250\201\326"
+	.ascii	" \005I\n\205\306\320\002\231\262\316\001\021`\021\201\030\t\241"
+	.ascii	"\302\224\246=\003X\002:K\337\311\202.\341\375\365\210~\260\027"
+	.ascii	"\352\207[\267I\272d\005\207\312\3218c\226\205\357\007\2776\177"
+	.ascii	"\342\027&\n\372Q\246\334\272\350\357\b\300\211-H_lO\0174\340"
+	.ascii	";VZD.\244\372\2647g\361\253\245\237xTh/.\251\007O\364\277\336"
+	.ascii	"\035\334a7 \346\227\343\242\367\377c\315\356\036\225\347j\224"
+	.ascii	"\276\216\315\236\275\342`'\317\\\026\023\346\036\t\225\021e\336"
+	.ascii	"oX\365\004)"
+	.text
+	.section	.gnu.lto_.ipa_sra.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"\355\003"
+	.ascii	"\262\004\r\023\240)\035\377\377\303\377\357\246~\265o\3777\022"
+	.ascii	"\273\211L)\256?EH\006\236X\315_L\255\330#\307\177\214\365\013"
+	.ascii	"\275B#\266\323\016\270V\317\373\263\203/\001\" \260\20213\017"
+	.ascii	"\350\f\200\225\246#\200$\240J\214\317\024?0Hq\33413\200SH#\304"
+	.ascii	"\003\254#\210(\031\256\004\372\004\315\005\023\202x\356B\"sE"
+	.ascii	"(@r\204W[,$\232\306>\206\f\f]\\\250!"
+	.text
+	.section	.gnu.lto_.inline.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`\335\007E\033"
+	.string	"\246&vA \217\223\016@\200K\300\365USW LW\023&3\025t\372\246\246"
+	.string	"\351y\250\222\016\321\370\215\206\226Q\246b?\013kD\\\t\216@\207 p\"\300\301\265\031\274\323\354\330\210V\004I\3332\311\024^"
+	.string	"n"
+	.string	"g"
+	.string	"\226\0217 f\220v#\213\036\024fQ_\363\303+T\240\254\340\251\027\355k\333\340\377\2505\307\210.v\244\351\377E3\246\337d"
+	.string	"\201\276n]^\331\255\353\326\271\305\315\353\236\003\252\r9\3467\311\300\360\260\310\337i4_;\322\365\307\355'\377\237\312\266\033c\261\031r\367\037@\253i5\"\034\320$\377HS\214n\035\366U\255e\216<\235N\247W\254\037?\222\337\263\207\342X\204\034\205aQ\207U\376\221\325M\306H\306H\267.\323W\344P\3702\356\346\312\372\020t\356\353\3432\002\205\024\022\256f\345H\024-4\220PuV{\374RA\304\007\027+V{r\302\005\017&\004\371\245\204\013)@\353\341\022)\203\t\262\250\272\221e\003\331[\201H\257\331\373q\351\177\246\316^s\204\322@\373\341\007\377\310 \016\364\275R\306d\255d\311ZiB\311^\357${\275.k\275\237\\)Y\312Z1na\"\201,\227\261\204\0353@kP\035\352\371\304\025\354X%{bAK\205"
+	.string	"\301\016\330\261\250})Y\fQ\035\203\264@\363#K\376\033B9VEz\001\355\326u\353\256\202\254iU\316\234\237q\2011\001\263\251"
+	.string	"\316W`M;-n%%X\354\275\252z\002\267Xh\301\340\342\213\347H\033OH\375j\232\265\352\251iY\206\345\263f\031\376o&R\025\257i\331Ay\362\177Sc\177]\375\255\376\227\313\254\237\215\307c\305\270\324\264V!n\025\200\310\250AEh\246F$IAA\262\034\220\002\241\231\262u\022 \0255\007\243\2109E\245\240\244\234\202\324\032\346\013'O)\270\201\3539\021\342&[\310\263\253\224\271\274\311\0366\316C\254\207\350\030\3172+D\021(\016\030\004\323\231p\275\314\221\016)z\314\204kD&\204\306\022\231\201\035J\275\tb\233\323cw\212I\003\035\247\270&\371\314\271\313\220\004\251*\325\263y\030\363\210\301K\210\030\021\"\220?p\367m\343\351d\325j\233%4\366\215\002"
+	.string	"7E"
+	.ascii	"\326}\3008\022\036\177%\3261\346\213u/&O\331\253\205\255\177"
+	.ascii	"3W\376ho\257\232\203)o\312\304\316\013\313\026\301\0243^t\274"
+	.ascii	"\230{\rJ$\253\b~{o89N\032?\261@\332\334\020*-\f\037\304]\020"
+	.ascii	"\002\373\023\216\027\005\225\016\n6\237x\334\031\316\355\b\376"
+	.ascii	"K\023H{\261\257\f\336\006\304\214\313\221\267\250\221\032~Y\240"
+	.ascii	"\022e\254\326(\331\365\n\246\302\007X\324\337<\300\232z\241\252"
+	.ascii	"\365y\337\323\235\235\224\266T\237\270R-\364%\262\032\373-\\"
+	.ascii	"\347\3606\261(\225h*\207'\274\332\246\007\257,\205\002\310\254"
+	.ascii	"\003\b\235\325\005\204\371\276\315\033\b\235\320\257\277*\377"
+	.ascii	"GNV|\241\223\024\233\342X\360\020z\242}lo\365\257\007e\361g\315"
+	.ascii	"\364\r7\020\024&\317\035\267\312\360$\237\240\366\003\353\034"
+	.ascii	"w\272t\341\333f\033\206\261\300\307X\312\256}?\220\314U\200\347"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`\351\004\205\f"
+	.string	"\"\016..\200K\322\001\235+\225\f\344-\261\352\277}\030\007\231\241 2\263\027\033\032\"\243\212F\330m\006\240\234f\013-\377\214\0231\204\354&eJ)m\032\005~;`b\375\277\313\261\236\370\346>;\202\232>\3644\260\345\031a\"\324\344M\213\274\270+\273\265\006\302&7\332\231Y\177\256\300\307\314\230\016\254a\004\n%aR\250tm.L\f\225\316i\270\f\3740\320\305\371X\016\230\307\031\033\303}\350\206C\250\326\251\240(\n\202\243+\313\256\254\273\226#C\210I\242\322a\363\236\335\264r\345v\254?#\373\022l\324Zk^yd52\267\030\201\b\035\300\363\354>\225x\004`\250\221U!\232\231\026\262\034\220\002\021*\243:\022@\361P\026e3F\030#\204\020\"FB\2222\312(IqK"
+	.string	"C0R\226\265r\341\232\374'T\341d\214\241\215nvy\206\276\255v\026\361&[l~d](\363\253&\177\241\322s\351.2\022V04\005\003*\330\356\f \005\362\337\205\316K\307\n\023\374\345\371\367kvR\261\026zy\303,\2146\255i\372\201U\320\200q'<l\300\312\225\262'\330\f\3501\324X"
+	.string	"\211\036m\221\306$S\362,\"\341\343\366\205o\261\263\321\222\323\214\305\211\177W\354\263\265\032\032\357\267\243\304\305@\374\325F\330\r\254\t\222\232\302U\271\272\275\033\371"
+	.ascii	"\221\356\347\212\t\245\205\217\226\264\373f.\362\337\206P7\025"
+	.ascii	"\324\023"
+	.text
+	.section	.gnu.lto_.pureconst.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\003\230\004\004\230\004\005\230\004\007\231\004\r\230"
+	.ascii	"\004\016\230\004\017\231\004\021\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"=\b"
+	.string	"\242L'+\200)I\007;\002@\200\230\200\316\007)\243\206C.\302:\003\030\031\214\007XM\003!\025a\247#\200\177\013l\331\215\020\322\244L\001?\034\217\005\006\307\362@B)\320`\260\325\230\212X\212\032S\236\210\035Y\364\356\234\305Y\320\3539\306)\310\\\341\224\303iR\250\222[\023sB\356h^p\351\231\r "
+	.ascii	"\363\323\240\275\351=\334\3424%\231\337\025\232\253g,E\346\214"
+	.ascii	"\2556?b\317\225\027\355\b\004\\R\304\2445@K\242\352O\007|6\255"
+	.ascii	"\362\263Q\336t2\345L\273\342{B\004/ \220\202!\"\263\003P\310"
+	.ascii	"C\210y\346\302\341\2050\331\016\253\226\"Db\004\032c\006\351"
+	.ascii	"\024D\330\0255\334,\303\320@\343c\233\214\312\232\272\326t\322"
+	.ascii	"$x\267`K\247\t\332\016,\266\233\361\017f\233\026b\033\257G\036"
+	.ascii	"2\234\260\343\271S\257\24443\370\341\231=\276`\255\206\037\033"
+	.ascii	"\013o\355\367\017\267\356\270\r\023\016"
+	.text
+	.section	.gnu.lto_.lto.7bd082eba082b1a0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidSetTargetLooptime.31.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"\305\013"
+	.string	"\326\326QA0Q\223\016 \350\365\237/\231\313\363\366\001\371\234_g\246S\n\247>3\336\t\201\273\366i"
+	.string	"\343n\r\335R\320\310\346\211$\220\330[\353\032\032Q\220l\307|\255\334\021\350\254t\203\240O\273I\231R>"
+	.string	";"
+	.string	"B"
+	.string	"\246\220\253\335\0203b\354z\t\214"
+	.string	"\300\241\201\017\240\016+\027@\035z\263q\334+\261\rxl\030\331\261\273QI|{n\376W\274\352J\242\347\307\203\335uv%\220[o\373b\233\201\375+-B\276\2103\200\362\335\241\017\242\016\243\t\305\207Q~\266'J\025a\277\262\273k\r\261o\372a\2465\323\231\351W\nF\020\250\261\313\341\353\261&P\206\t\213\355\247\375\024W\261=\327\001\262{@\265\"I\341JH\3719\325\306N\342S"
+	.string	"\033\273\273\300\037\271\013\f\276\310\241=\237\017u\2304:\224\3239\017' \326\016\276\257D\303\356\350rM=w\202t\255RN\270\034P}\026\017\233\313\3222\f\213\240\2612\2133\030\315\342X\0224V\0265\013\025\254\013\024\"\307\232p\305L\307\0231\005\214e\233N\3240\254\023-\336\276\262\273{\r1\204\016&#%Y\325\276\016\343\205\336\350P\256>\005\022"
+	.string	"2\303\303\005\025\2708Q\300cG\006fO\212\274\250B+\340\342\024\262m\341\002\314\336$j="
+	.ascii	"\b.6\020\253)\343\016/\332I\006"
+	.text
+	.section	.gnu.lto_pidInitFilters.32.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`E\"=}"
+	.ascii	"\352\302\200+J \016\333\031\003w\264\240\243,dL\244\021#Fw;a"
+	.ascii	"\020[\325Teo+X\b\017}X\232\276o5&N\235\372\310\221\214\334\334"
+	.ascii	"\340 0\020\013\212\035\223\035\327w\242\361&(\031\214^\340+1"
+	.ascii	"\t\221\220$R\312\224R\n\241\002j\002\266\002@H\347\237\325\331"
+	.ascii	"\347\350\334\323:\363\254\316;\254s\222uF\036\235\333\325\371"
+	.ascii	"xtfW\347\365\350\254\262\316\317:\373\352\334]\202\317\037\032"
+	.ascii	"\"8"
+	.string	"\357\353d:\303{f\305Kk\300n\277n\276n\275n3\335x\335d\272\355\272\351\272\277t\203\351\026\323<\314\035\030\027\007\302\341\037\235>\276\2710n0h\367\330\362\320\312(\261\200^\254\350\222,wtp\206u\334R;\316\233\203\233+\322s\334cx\247W:\r\332\252\256!\256*r\207\357\373J\265\275\266\r\327aZ\216wZ\3508\267\305l\320Vu\265tWg=\332^\225j\007\261`:PZ\001\275XWW\262\320h\337\232\005\267\277t\320\276d\332-\270\276\303\367}[\366\312,\332^\201\274\235\271W\3506\267\335\224\264\206\367\265\302G\346}\337\230\314\324\366\312o-\304\366\332v\020\333+\263\313l\330oeo\3031\331\n3\347}\337\346\233\200\242i\251D\342\320\201\277\325\267\346\035\244\333,\236V8\251H\201\342D\263\211\331\202i\271\344\302D\t%\022I#\220D\034)\215B\024\201"
+	.string	"\340\203\007\242\016CB\034\2026h"
+	.string	"\372\361\351\341\331I\"\333#\273\252\357.wU\263x:F\221A\r{\205\341\033wr\323*\334\264\361\024\205\201\204\216\202M\237`\323M\301?@o\nlf`\267\370\023\234\343L\177}}\276<F\225"
+	.string	"\365\353\245\266\362k\027}}\224\246\353o\321M\224\030\344C$\203\362\265R\232.\027H\330I=\311\213\332\210\272\2759G\242k\021{\235\304\246F\006\245\353\243\272</\256\024\323Fy=#\212\206H\006\025\323!\344\334\306|\321PT\f\221\fZ\327 \332T%"
+	.ascii	"\252\262\213\252\224[\301?x8F%\201\240F\006\345\322De\260x\207"
+	.ascii	"\264\036*\323IK\324\310\240i-\304\345\016\3159\\\351\240c\324"
+	.ascii	"]\317\250b\210H\006\275\322\033Nh\262\2563V\350,\017\215\217"
+	.ascii	"\310\272\266\274\00663\007b+\363\037*\355\243*\251\250J91\357"
+	.ascii	"!\203Ni\036\025h\212z\342h\255k\004\3379"
+	.string	"*\001\032\326\311c\224\264\221\346\324\310\240a\215T\227\016\357\344\b9\301\362\354\265.0o{\255+\212\037\223^P\232\3554]R\264|\365\361\312R\225\357\373\356xm\271\312V\241\202H\006\205\323\257\252\310\232#\305\307\013K\345a\334\202\241\345\332\271\274\256\334\217Q\357\373\262?\275\240\315\0014\263\352\307\314\0310\027\021\006\356\304Mc\"\004\201\347\333\231\354\374\335\340\342\177\211\323K*9\362\223\317\354\242\340\246\340\375$\362J\033\237\374n\037\371\036H\221j\035\272Z\\6\030e\016\370\022\337\032\323\253\024)q\317'?m\276\304!?\312\256\027\266\3756\304j\177\247Jp\261\233\323\351\264\375(7\241\0261\266\202\357-)\030\252\352\333x\256\016X\033O\324d\nW\210\345\214\202\323i\343\361\243\025<U\230t\253\321h:\235\262\307?\002\367\307\376\261\213W\261\277\"\376AM\247\323\365\243,\344\327\227"
+	.ascii	"\016P\375\365{\253\321\312\247m=u\275\264\357\213\365\304\335"
+	.ascii	"\350\2742@{E\311\257jz\213n\377B\336\007\265\002\255\244\315"
+	.ascii	"\352\373Z!\371\377\023\345i\255]\261\214\246\303\322\226\321"
+	.ascii	"\277\207\205<67\236N"
+	.string	"\247\215j\2213\273\347z\316\f\036B\004Z\261\006\211\262^\345\260\r\034\336O\346i\241\355L\326W5\021\352\350\030\020\333\020\362h\3037\275\006\266\206\331\243\013\331x\360{>i@\212\251\354}\255\372\311\354@\253y@\210\360}\337'n\030z\020\002\356+\275r\004>|H\001\333{>Q\266I\353\374G\371\007\333/\001\034\033,gd\3563\215\346\007\367\025\016B\201\367\263Wn\n\330^\373[\256\225\324\306\260E\261\362)\363[\225\177\224\271{\254MJ\207\337\ns\217\261\316\035\326~\315\375\325]]\325z\315J\2224^3\225\221\251\246k&\322`\232+h\267n\251\026\323,\204un\200\201\366k\356\321|\315\013\264^3\2176\323\274\243\361\232u4\231\346\034\375\245\031G\3335\337h0\3156Xg\005\220\3165X\347\004Xg\004\220\3164X\347\031\254\363\001\254\263\001\254s\001\254\263\f\326\231"
+	.string	"\244\363"
+	.ascii	"I\347(\326\031\212u\216\321:\303X\235_$\235\005`\235\003`\235"
+	.ascii	"]\260\316-\220\316,\222\316O\254\363\n\326\331\t\351\254\202"
+	.ascii	"uN\201tF\301:\237`\235\233H\347&\326\231\311:3\261\316K\326y"
+	.ascii	"iu6qt.\261\343\254\264\343Lb\3079\251u\036\301:#\035\235E\254"
+	.ascii	"\316GIg%\353l\304:\2078:\027\261\316 \220\316\037Vg\017Gg\242"
+	.ascii	"\326\271\003\353<\264:\013%\2359\260\316A\254\363\006\326YC\003"
+	.ascii	"6\007`N6"
+	.string	"N>\212\353\3250@!!B\b_=\276\313\t\211\337\241f1\001\037\321\354\307\366\3343q\276i\237\313Mk\301g\317\375\222\031\376[\257\345\204\343D\334b\007\376\352\201\366\255\222\336\325\200\375;\303}Zc\2047:\035\224$\306EE<:#D(\371\265\360h\331<x\350!\361x%\337q\320\244G\217\364#\344$\272h\335\202\013\036\307m\002%\203\353\345\024\303\b\021\217t(\342;\220\215\233\341\321C\001\331\242\210hS\310\005-NoN\360\310\250\253~-\f\261\354\035;\364\224;\276\253\276\343\234\t\032\275r\215\032\227\013\252\254\317\007\335&/\312\23428\f/(A|\210/\243\242\017\361^w\306\365R\364=h\346\026\b\b\342;\257\223\240zlF}|\\\316\366\314t\022/\304\036{4+-/\313\254L\333\207D\277s\247|\370\343\232\0316.\"\344\341vukf\212 <\274\307"
+	.ascii	"\027H\364\036\376X\007\300G\211\024\235\316\365B\364\353\232"
+	.ascii	"\335\364\003S\314\003BqY\314\244S\017M0pep\304\346\300\210\206"
+	.ascii	"\250~-\024Z\266\016\035\035t<\325w\234\2628\031.\364C\337\341"
+	.ascii	"\231\235t\234u\264\336\246\234S\367\342\242u\230?ws\233\304h"
+	.ascii	"s\275\234V\350\200\343\207\270\b=\024\314b\224\241*\227M\213"
+	.ascii	"\nT\326T\351\226\353f\022\227(\364Q\3769\013J\362k\341\206e\347"
+	.ascii	"\310\361n\270\224w\226\307!\307'\371\216#\246\030\303\203\236"
+	.ascii	"C\226\273\245\314Ba\b\007\367\003_s\271b\020\006\272\232\333"
+	.ascii	"\204\005\241\023\317\342z1\313\3228|?\237(\271\206\337\360\025"
+	.ascii	"\204\3437\210\340WX\332\242i\370\276\353$/\305\017\372(Cq\301"
+	.ascii	"\032L\017/{\240\203\t[\304\340\370X\037]8S\345u\222ygy\033>\312"
+	.ascii	"V\330\243\315\230\345\035#\201\235\254\213\330^\257\334dy\337"
+	.ascii	"\327\204Saf\303\366}\253Z\214\375\371f1\311\362\216\275&T\214"
+	.ascii	"ayc\230Oq\247\374\374Q-q\321M\003#\334\037\216\367\3716#\266"
+	.ascii	"\267\325\b\324\305\320\247\347\223t\301\322c\344q<\227[5\216"
+	.ascii	"\3771\373\371\250\317[a\317\352\236\227\200\212\207\365\374\252"
+	.ascii	"f\270\350F\202\2031\t\215\374\243y\323\363D\0049"
+	.string	"\305\347\223\303\020\332\264\360|\224{\n\223S\277\236!\227}\343\271\230}\343\335\255\241\260<\247\3540\365\215\237\372\376\223\262\247%v\345Sn\362n7\312\022\371\235O>\217\t\256\231\372F\371*f\367\232\362ag\032\357r\321\236\312\336\367m\341\236\020R\215D*\211\017U\307\005,\025\022)\f\214lpc\203\037\027\004\301\300H\220#\007"
+	.string	"\221*\022\304\001\r!?\250\246n\0209\022d\001 <\034\b\211"
+	.string	"\t\022\037E4\230\262 \002\"G\202P\001\001\nb\201\324\004SGr"
+	.string	"\221*\222\344\037MTR\027HE"
+	.string	"D\252H\223J\b\005R\026L\320\274@\312\007\221\346\217#H\232ME<U$\310\221&\325\324\324\221\346\316\333\333QV\177U\207\205\023K\221`\024\256\350\260o\240\001/j\324\212\231\372\244\300X\207}\210D\255\276\032\257\300{"
+	.string	"\324:\\\361\321\247\3235\376\207\013\013*\t5\276\347J\017N\245\302\322\037B\261O|\3060F\r\ncP\323)#\002\237\300\037\007\265\326h<\002\257\206\t\243\206\321\370\236/=\266\031`C<N\215\342r\031A9\340p\206\nU\275\016x\036yN\0068\221SAhR\300X\322"
+	.string	"u\211\272U\300\277\024L\306\367\234\232E\247b\251W\004\234ae4\326!\340\377\313n\321mI\354/\004\025S\330\001^\202\272g\034"
+	.ascii	"\005\273\024\201\315<;\321c\317j\023\350\031`\340\035K\267\212"
+	.ascii	"\202\201\357\261o3[\024\241>Jq\210\034\227\253)\375D'_R\234\250"
+	.ascii	"\030-\324!\234\030\377c\300\334\254^<K{\314\007\013\206V\233"
+	.ascii	")\036\274/t\321V\2249\357\236\215\233\306\364\2040^\315\213\377"
+	.ascii	"\257\270\305(\177\342\243\354L\313\356\300n\347 \0326-\033\350"
+	.ascii	"\271\270\233\314\376\372\365\254\305\262{\364h\352\361\375\365"
+	.ascii	"\rM\023\f\340\005x\301\314\247q\271\232\312\234e\036\215\223"
+	.ascii	"O\351\317\b\320\342]\004\220\367\200,\375s\361\310>\276\026\337"
+	.ascii	"\177\215\204\327\310\306l\361V\342\232\305\236\036\213_\253\303"
+	.ascii	"\364QF\216\260\324]\277\236\271X\366\002\376.\360\335\365\r\305"
+	.ascii	"\262f\305?e}\231!>z\217\347r9\355\375\235\223O\351\311<\245x"
+	.ascii	"\247\025*\336\351\373\215\337\327\215Q\361m7\307\322\366\345"
+	.ascii	"R|\3675\022\236\234E\267^\372(\267\213v\n\262(\234\200\337\202"
+	.ascii	"S0\f\212_\327\022\027\335\254N\300\ri\237\205\377\342r9\321\f"
+	.ascii	"\361~\016a\231\337<\361M\337|\346\013\337\346Ni\372\027l\334"
+	.ascii	"\272\260\264\345\302\374\035qL\304p\246-Cx\b\007_\213\313\225"
+	.ascii	"T\246\202\222/\375\222\251\304/\177\215\245\255\332\322?\324"
+	.ascii	"\220\r\n\313\t\202\317'BN\260<K4\351\370\2637S\341\004i\341\341"
+	.ascii	"\235\034%\023\357j\340\002K\274\211g\023\267\032\371\355}_\022"
+	.ascii	"%\326\274\t%~]s\023}+\256W\017\226UQ\"a\214\n\217\227\022\246"
+	.ascii	"\364;\326\260}\223\202\261\250\362 )\323Q\310\024\032\021\021"
+	.ascii	"\221$I\322\0302\f\020\206\3418J\255\274\003\022\240\3430\312"
+	.ascii	"\203\022\"%\325H\322d\330\r\351\313\250\310Pe\275=\361\217\303"
+	.ascii	"[M\235\351\274N\321+\005\254\315L\013\231R\377:U\001\301J\255"
+	.ascii	"\\\322N\037'\377C1p\024Z?M\002\003\230\2010\370T\367\2670\330"
+	.ascii	"\346F\240\315p\032J\255\246o\220;\006-\300\020\366t't\326"
+	.string	"XSQ\323\021\207\270\317w\266|\221;$\311\017\300\254\225\243\230\320\200\347\004\253h\355%b\321\202\342\236~~\270\340\330x\013d\215>i\003v\232de\210\021}\250E\231\025\243\322\r7\021\355\210\f\033\234&\330\265\241\221\300\037\230\032E\026\230\252\262\213\022\234WS\300\234\227#\255v\245\323H:\3729\242\224j\351\263ALH\f\025S\306\241O(A\263\241\311,\335\350\020\026g\242\262\212\223\240i{\336\377\345z\261\364\342\255\334\013\016\003\320j\017\230\204\366\330\332\022>\355+\365\301\236[\311\251\305F\004\370R\2708\274\037\232\314\353\020{M\301I\375J1\004\f\013\321\216\365\337\311nC\026\263`\204\002x\334\267\205\253\"\340M\207H\2430y\203M\263\246\304\270\342\234:\024\361\246\236'\312BM\026u\335\363w\251i\217xy\3743E\037^\276\225\375\231\370@B\225Q\372pln|~\032"
+	.string	"\312e\371\305v\262\346MD\350\222j5\373\177\262e\3459\2337-m\366\360\005s*\316\353\372\340\222\347\244\203"
+	.string	"\002'\312\337n\314h\347\335\253R(e\265\036T\345\343(5<\262\250\035\244.\342Z,\367kR\236\216\345\355\236l:\343\237R\276N\216d\273\226\275\007\350\231\361R+V\230\301\033D\276\277\017\364\220\261\303\371\261n\243\\D\300\301\fF\201\037\264\361\004,\217\216\361x/\365\234IS\027\301/\350\201\263\250\314\311M\242Z\302\220\177\340D\324\034\327)\226\224\343V7'C\224\027$+\203<\210S\201\f\n0_\360\226\307\311\251\307\236\215\027\270o\264S\251\340\033\332EHM\220\247\212\336g&\023`\256;^+\020\233\247\252\340\213\216\034\367\022\202e\330#\303#\377\240q\270\304C\343\024z\210H\"\242\265\017\220,\231\370\005\340\310k\036\3759;\005c\310\267\323\365*\005\b\004\036=\306\327\220"
+	.string	"\3772>\250#f\263m\254\300\274\220_\211iP\336\331m)\344\013\371j3\377\372w\362\227\243\204\352\0277#\324\030T3\220Ng\217H\032\245\225\324\371\016\204\255\316<\354 wv\302s\225\305\202@El\2259\022\202\224aS\252\031\235J\235\211d\372\231\322H\302\\\243"
+	.string	"y0P\\GQ\3660\226\276\214\bK!k*\016$E_,"
+	.ascii	"\016\305\t\357[{x\001\370\336W"
+	.string	"Hn\365\021b\\o3j\214\017f\252\"\226\202<\221\030\315\321-r\306\364\335\265:\316 \307\251\030\206\377\271S@\023\264\347\027x\200\035\261\261\205\3263\236Y\335\341\261\304\026\220G\373\202\223E\272\350\223a\205s_\007n\201\360\224tH~X\021\246\216r\243\2275\244\2561\004c\2110\377&\031pU\312\325#\332:\022/_\251\315\310\211%\016$\316'\251\374\220\365Q\303`\211/\312\322\361\315\304\245\rc\367d3$\264\205-\206\354\2565\330\3178WA\342\2132\254Z\237|\303\340j{\224\n\230q\033\024\005\036\f\300\321&K\260\230\031d\347h\177\210\221\n\202!\322)A\273\214\"\345Y\254;[\031E(\262{\213\022t\321\202\220\007\225\363M\303\007\252\256\360\343\306\275\367\003\347\357\350\316\224\236;\212l\360p\tQ\357(Cl\231\275\347\013\266G\373,\222R6\234f!\264\277Q\375\t"
+	.ascii	"_r\314L(\036k\325\312\r\331Lwk\333\034X\f1\210\356[\363\376\363"
+	.ascii	"\201\363}\206\261z\214\253\371[\rL\355\205f\267\007\016?\370"
+	.ascii	"\240\003\315\341\225]\314\246\024\310\322\337\305\307\215\246"
+	.ascii	"\t\335\264\335\232)\b\247\023\235\350h\213\312k\224\333\377\214"
+	.ascii	"y\334{%\251\360\020\001Ub9%L\311\002\251\013\247M\234\032\342"
+	.ascii	"\327y\017\343\206<\250\355\020\003:\374w\363Z\250\332\fD\214"
+	.ascii	"\246\316\rN\326|{t\305\005N\274#\214\210EMf\017z\245\326\037"
+	.ascii	"\301\200\rq\270$\030\373\336\223\252\277\202\355\036\312\017"
+	.ascii	"\"\237\205t\207\241xS\213x4UA\207s\377\002M\201\203\336\\"
+	.ascii	"%\321\200\257ea'S(9\330\261\330\363\030V\207"
+	.text
+	.section	.gnu.lto_pidInit.33.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"m\t"
+	.string	"v\222B80\221\322\001 r\303`\363Fi\017\206\320\304<\217Tk\273\024X\362\006G\373Q\313\260&\275\261\276\327\333\337\372$\025<\fnU\020\217|\f#\017\375W\3737\3312\245/"
+	.string	"1"
+	.string	"1"
+	.string	"7\330\\v^\260\271\364g\317<\004\331\263\214h\254\320v\227\213\037\377\256\237\377\223\003\2000\327\225\323\260\273V\020\326q\307\333N\260\035\262\257\001\321\303\376\266\273\353\030\263/\3737U\2373\300!\303\340\262\273Q\253\331\231\204\021\371\330\276\332/\271\311w\331\305\tvc-/\273\341\202\025:\227\016\003\266i\n\320\314<\372h\243:=h\204\214\350\262Mq\225UgwC>\312S*\374\220K[\264\364\340\245\337\332\\>B\304\220\310^Z\263C\227\006\244\323,u\336\303h\252<\026\201X35#FS\305\261&L\363T\342RS\002\305\211\274\025\007:p\247\"y\034\253\353<\356\023\356\267\2151;\300f\257\210!\242\005\350\026\003\r"
+	.ascii	"2\241\rh`\\0\220\017\f\003\027m\232\023h\332\0300\345\022l\263"
+	.ascii	"\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.34.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`m\001M\016"
+	.string	"\346Z`D"
+	.string	"\261&\035\277\330\342\\\321D7\203~-Y\324\224\017\016\314\031\276\251\255g\333\337U\341\033\017\265h\221\035\035\302\310\366e"
+	.string	"\313Ae\204\350\273\002j\262\321\206\3513`\227\257Jk\221\247uI\334\233l\231RH"
+	.string	"J"
+	.string	"M"
+	.string	"\330c\310\005\310G}"
+	.string	"\371h\317\226\361\017\304\236\246\246\345\004\316\356f\360\203\247\336\343\005\325\363=>\035\325\352\364\210m\370\225R8s\305\260\262p\025\330\335\267\256\027V(U\217\317\356ZU+\r\267\274m\3156\211\375\227>\234s\3020t\261\037\363c\227\371\345\277\377R\265~\230>\234\032\fnv3\314\034\353\"\262x\261}\3733\266\347\036[F\304\b\202\004\336\277\322C\026e\243Z\200=Z\325~\211\303x\21719\356vh\261b\367;`\003\001P\241\265e\207\347\2349WIJx\033\377\234\363\006\264Ibp"
+	.string	"\313D+FJs,\241\315\275FE\307\346\206\304\005m\nOQ\002\360bw\025\370(N3\362C<\232\264\242W=\372+\362\221\2045\202\005\303\201E\247\375\235\024zpZ\250\344\340c\264UhpB\212\240\231t@ \256#\215\210\264\016e\003\201\270D\244\333T\266\007&[(\353$\234l(\240Le\203\220\222\225\210F\231\b\001s!M\224u\034'\312<\337\036\272\\:>\0344X jF\364\250B{B\212^\345\267\376I\301\223\261\034"
+	.string	"\202\316\2113\003\356\231\301\340\345\314/L\024\347l0"
+	.ascii	"l\021\252j\250\273`\345\207],c\031\030\267)I\210*\001\200k\216"
+	.ascii	"\033\256\003E\30080\230OB\013\324h\341.\201\001\2030\344\236"
+	.ascii	"u\370X)\003"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.35.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`8\001\205\r"
+	.string	"\306\232]C\020\221\223\016;5>|}\032J\020\f\322\212\355\352\235\310"
+	.string	"\024h\033\177c9\321\213M\261B\213\277\341o\237\221\332\377Du\031\256\037\b"
+	.string	""
+	.string	"P\"\254\\"
+	.string	"X\220\210\340\332u\246Ro\322\310&R\246\024G"
+	.string	"I"
+	.string	"H"
+	.string	"\207"
+	.ascii	">\300:\314\013\260\016\335\3314\377`\366)\232\226\0224v7\323"
+	.ascii	"\016]v\207\225f\347o:\034\217$:\274.\274\032\245\242\236\023"
+	.ascii	"H"
+	.string	"\022\252\216\335}\314\323\205\304\222\271\351\354\256\323#Y\270\255\333\366\330N`\337\013\246\037\376tk\246S\323\347\004\300\300BA\334\245\020m\354\f\224\001\361\323\355\177>\312\230?\342$\272\237\254\342\022U\270P\244j\304\330]\217C#\270\016;\252c\2663\355\207\270\210\356&\025\303]\016+R\354~\0376p\005\235\221\212\f5\325\331r\3031\306\232\352\304\272^\206\267\2378\271v\367\200\237\272\211\220\377\341\320()y\357\320O\321\017\017\246\225\214\177\214q\206j\311*\026T\002\033Z\234^\214\262\306\376D\251%\373\032cta}\261\037!-BH\365\371l\034\312\002\220\207\033\321>\034\026\001\341\264\022\215A\003\315$\343\0368\320F>Y\211\026B\222\211\200B\031H\001o&\036P\306m\033(\303\276\275\276\\2\031fV\224\005\006\324\222\217:\007&jP\217\253\272\330X\246\332\020H\362\236\037\363\026"
+	.ascii	"2\003\3769\203\013`5\030X\231\002\201\224'J\001\024\371H\306"
+	.ascii	"\370P{\204a\254r\031\250\213#.\034\334U\325\030\261\022-\334"
+	.ascii	"%0`\020\206\334\263\016\037+e"
+	.text
+	.section	.gnu.lto_pidInitConfig.36.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`\213)\345\223"
+	.string	"*\353 3K \224\312I\007\333\227W\034\364\t\2379\341\276k\334\232>\230\312\217_fr{V\232\331\201V\340\261f\236b\335\236\365\221\275\217k\201']\326\270w<\2529\270x\223:\376#\300\305\341Wa\207\305\226YIo-!;I)\003\357\002\013\0036\003\013U{\227\240\2751\324^\030\320\336\027j\257\013h\357S\355m\001\355U\202\366\262P{\223\324^$h\357\021\264\327\310\257\267\b\332\273B\355%R{U\250\275)\324^\024\320\336!h\357\tg\257\tgo\t\265W\b\260\227\204\332;\002\332+\002\332\033\344\354\r\241\366\202\200\366~\360\353\365"
+	.string	"\355\355\340\327\013\004\355\345\340\327\273\001\332\253\301\2577\003\264\027\203_\257\023\332{A\355\265\340\354\255\340\354\245\240\366Np\366Jp\366\376\370\365Fp\366Bp\366>\360\353\365\361\353u"
+	.string	"\355m"
+	.string	"\355e"
+	.string	"\355]\340\354U\240\366\366@{y\240\275\t\234\275\b\234\275\007\374z\r@{w\240\275Mh\257\216\2637\307\331\213\343\327{\003\355-"
+	.string	"\355%\340\354\035"
+	.string	"\355\025"
+	.ascii	"\355\r\340"
+	.string	"\354\265q\366\002P{k\324^\032h\357\214\332+\003\355\215\201\366\3028{\231j\357\013\264\327\005\332\273t\366*\325\336$\264\267\005\332\313\242\366\"\241\275+\320^\025go\212_/\n\264\367\b\355\025\236\275'j\257\021\332k\002\355\r\236\275%jo\021\332\013D{\177g/Z{O\264\267\242\275?{\273\366r\027\227\352\376d\360&M\2454\023\245~\316;f\030\017s\035f:\314s\230\3410\273an\303\277]\336\345;\313n\033\334\003x\f\031\217\02405\373\315\221\343\201.M\325P\260\223\314J.+7Hg\225\234r\245\375\307LV\031\023\344,\267\315Y\345\025!2@\342l\220\3179c\336\270\311\001X\245\305\"\253,\351\003\310j\313kA0\233!\267\331%\260J\013\370&\216\027]\232\2467\370\\\005\200|\312\2505\270\273\334\273\f\004\253\0312r\212Q\244i\230\020u\322T-\307\342"
+	.ascii	"\362\271j\214\204\362\td\025(\237\273\303\3359V#K9"
+	.string	"\216\224+6\2754M\233>&\343h\317U\215\227F\035\362\f\0311`0\275p\261\244\224\324\202\005\322\n\025)P\034\tO\030\231\b\226(\002\322@\353\357=\\\246AH\211\265U\3053\352Q\234\272\303\316\017-\003\016\307\200\301\"\031\345\020\030\327\032f:\323R\323/\220n@\264\013;|\222\311:\004\306\005\207\227\224\300\270|\340\244c\232n\301\"\211\024\224\323\303\212\337\017'1k\016\201q\231a\025c\030LK\f\212\024f)fg\200i\221y\2122a\032E=*\253;\342t\351#0\\d,\374\375\210\303\247\2301\207\300\270\310\370\204\027\033yqi\023[8\270EK\227\230\001\306\225\205\213\252\214,3\316\264\2604\260\036\031\241u\245\356X36\r\006\303%\207\321\312Vr\370Wb\313\n\377\304V\261\312H\323\224\327pgm\021\273\177?\3224\335\306\332\342\342\255\301\273\315\265\273+\354\n"
+	.string	"%o\375\003\343x\216\277\2203\236\3358\0162\035\204\323\215\363X\003T\200\231^\263Jd}\373B\210\215\232\035\001/`\200\023p%\271\0054\300\031M\333\033\243\231"
+	.string	"=\264\017\253<\312\005:\203E\255\003\270"
+	.string	"6\036\300\225\370\214t"
+	.string	"\234\315\330\370\tg4\253q"
+	.string	"\3164Z\215\013\213}\2304\320\372\3140\355\254\336\035\333\214\306\215\302\372\034g\374\320e\310\324%V\235\214\317x\2053\322\265\030)v\023\027f\310\003de=\342d\334"
+	.ascii	"7>\314\030jz\f\f\034\214\307`:\214\377\336^\234\311\203\376\""
+	.ascii	"\345\003l\210\016/8^\\X\344st\361\335\341\232\356\262Ja{}\331"
+	.ascii	"\026\350\314\327\336\322](}\351\277d\322\225Z\213\224\002d::"
+	.ascii	"\313\220\034\215E\200\244\033\001z+\321\342V\252tQ\341\257\312"
+	.ascii	"\342-~\336\031\317\210@zk\2259\032Jk\265\224\216\322\274K\224"
+	.ascii	"O\026\017\206\025qD\026]L\bF\222\240\263\220l\254\345a\002/\266"
+	.ascii	"\274\3069\302\240M\374\326_\rg0\317\312Q\246\315\240b\3571\363"
+	.ascii	"\233\315&\037\r\034\314`\336\304\263[\234<\243\327\212\357R\320"
+	.ascii	"Oz\207\276j\243\326\226\261\2578\025_\221\342*P<\205\005Mtb7"
+	.ascii	"\262\266\032\302I\262\256\212Cq\036\305\345\361\350\273\031p"
+	.ascii	"\263\217"
+	.string	"/\021V\036\261B\302\037\235\270\320\350'6`\246^\236\021\323\304w\201\360\235]\022u{]\324\022\005o\242\304\203E/\341\001\033\232\223+:\002vnG$\360\273 0\241U\342\030\024\304\006Y\232\246#\260 !|\306\301a\325)\231x\005\315O\004\315\246\336\357\300\263\361\f\375\357?6#\335y\364|\325\267&0\234\024+\343v\247\316\030\320\020n\213K\323\342\002)\360\021D\370d7d\347y\215\353\031;\345\273\331l\366\241\365\177\374\234K\254\272\177\225\fgO\024\323\324\252F=\033\367\020\273\271\375\037}3\322\361\373\274\206\317\2768H\\\365\325\213m\377\006\363\032\003\231S\346\352\r\256\341Y\313\277\213)w\267k\354\026\341\"V\211\024\227\246i\217\345=L\304\221M\242\244\031K\t\312g0,\231FO-M\323_l\245P\276\2216\202\212\275\267\273O\254G\n\230\246\305\036\313y\246\252\274"
+	.ascii	"\034\303\347\362\024\312'\377D\323\306DZusW\255\252/\326l6\233"
+	.ascii	"\373\260\335&\366%b:\274\214\210\347\360\362\036\223\361\360"
+	.ascii	"2\036\273\341e6\214df4\\\207\227\311\030\016/\2171\030`/\213"
+	.ascii	"\205}\001\363\362U\324\313]\274\270l\321\222\005\313\025+U\272"
+	.ascii	"\250L\341\332\322\222\022\005\n\017YXOv\2702\242\275\354\344"
+	.ascii	"\354\345\"\321\n\330\313U\265\227S\264w\210\366R\235\275S\265"
+	.ascii	"W\207\332\233\003\260\027\207\332+U{o\370\365\332\300mxk\250"
+	.ascii	"\2754\374z\243\320\336\031\320\336&h\257\fh/\023\264\003\367"
+	.ascii	"\2614\342\355}\2063\242\337\2003z\001y\335*\277v(H\363\321\t"
+	.ascii	"\3519C3\234\225\\\017u\3519\"\215Y\332|59\357\235\371d8\2237"
+	.ascii	"\271\022\033\b/\264J.\024gvBA\030.\356\203\204p\0362A2\234\013"
+	.ascii	"\tbrn\343\272\267\307\220\261N\bu<\022\201\222K\016\365\277\375"
+	.ascii	"p@K\036d[2cPs#\376\310\301\360\030~\2765\357\003\303\215\234"
+	.ascii	",\217/\004\361\267\"\316\346\302_\370\333|\217\013\017\242\271"
+	.ascii	"1\237\330.\304*\365\360a\325\265\360\247?i\244{\363e\013\017"
+	.ascii	"\212\271\035\221J\342\034\317*\357\354\261p%O\342Kr\026^\227"
+	.ascii	"s\256\224Jr#4:H\222O\016\323\336\246\274\034$7\352J2\221G\354"
+	.ascii	"\034\316*\205o\346\214\374\310]\260\025\271\221\237ox\276\346"
+	.ascii	"T\344B\266\344q\205\345\331<\b\"_\341\365\316H\247\347k\210\334"
+	.ascii	"H\254\215\251\302\020W3L;\020D\334\007\025\036\\\272a\246\360"
+	.ascii	"\3664i|}\216\226\302\203hn\216H\024\376\374\3140\355\354\r\253"
+	.ascii	"\316\352\210\233\241\360\242;6\346\211!/\263J\244\223I\022\237"
+	.ascii	"h\3613\350\204\0171\341'\374E\322Hw\303\225\022n\302\225\356"
+	.ascii	"\214^\304\022\316t\312\346U\237\3210\r\025\362\2441DTp\037;\030"
+	.ascii	"\267>==!H<l\230\366/lXu\202\356EJ\310\203"
+	.ascii	"kyG\022\b\275\013\324\275\316L\350\b'\341|\345F\244\222\273\026"
+	.ascii	"\251\021\036\f\303c\"E\370\376\312\261\254ry\314R\031Z:\315X"
+	.ascii	"K\007\345\263\337\202\\\204\020\036\344(\233\221\016\204\207"
+	.ascii	"p\350]R \374gw\367A\022\237\302\345\301?\370\337\356\256\345"
+	.ascii	"\301\213\354\354\230\035\344=\n\024 \357\340\277c>\013\310\203"
+	.ascii	"avG\016\020\375\311\016\033\234\203W>*\276\0337\270\021\032C"
+	.ascii	"L\r\276K\325|\361\304\f\256\301+\\\325\2532\270Q\321\320\021"
+	.ascii	"\003b7\373\234\216\301\353\233\221\316I'rz\320n\216\211\274\340"
+	.ascii	"\252\367\230\026\374\202\327\245\221\356I\347Y\360 \240\271c"
+	.ascii	"\005Y}7\204bwR\360\n\276\224\234\340\024H\351CR\023\\\030&\307"
+	.ascii	"\224`\253\r\3155\022\374\343\022\374\367\026\301\177L\351BN\021"
+	.ascii	"<\350&wDB\320\325\203\206V\204\202j\362\027\367\300!\370oi<\363"
+	.ascii	"\361\007\260t '\037\017\272\025r@K\003\032r9B\256K\377qr \007"
+	.ascii	"\225BG\023\r\274\317*\221\370\260a\3251\320\300O>\343\036\"\233"
+	.ascii	"3p\346\323\226g4#.pf\363\226S\340\013\\\t\316H\327\343\n\234"
+	.ascii	"\337\360\351\326f\350\252/x\004K\241=n\244\315[\261\367\274\264"
+	.ascii	"\020R=~\242\ttD\356\016\277\364r\225B\267\24258==\036\277c\247"
+	.ascii	"\016\\\002o:\017\004\236\300\225\226\007\034\201'\301\031\360"
+	.ascii	"\003\304\232\216\223\0017*\302\035\2218\272m\225Ls\206eB9;\336"
+	.ascii	"pV\tA\334\356p\254\337\f\313\022p\243\304\206U\327t\035\337q"
+	.ascii	"\246\267\241\230^[%\260M\3239O\0202\307u\234)K\236\200 \251F"
+	.ascii	"\210\364\022\250\247\250#I\2324\201\242\340)\030\265\344\t\352"
+	.ascii	"\003&4 Y\362$$\206&I\242\236\216fx\272\241HM\002\303\023\013"
+	.ascii	"PM>@\362\304\244\304\036\321\021\365\264\344\211\b\222'&MQ-("
+	.ascii	"y\202\201\205\246%OEbh:\322d\206&\035L\013\305$I\223\246((\250"
+	.ascii	"&MA\265\2249}\330\tI\370\261:qY\214\210\263\n\352L\357\302\316"
+	.ascii	"bo\265/\354A0\315h\376L\035\321\214\265\275\207\b\376\002W\021"
+	.ascii	"\255\262\356\201\361\0273\242\235\2273\330\225\356\276\316^~"
+	.ascii	"&\215tHT\274\257\013\301\3449v\021T\355\246\b%\341u\356\"W\017"
+	.ascii	"y\335\bo\311\344b\250\032\232;\337\266\234\271h9o\371\3222\313"
+	.ascii	"Y\313\241J(\313\215\360\334\260$Q\005\255\262\306\345\351\003"
+	.ascii	"\367U\347\312\031\313c\274\031\317\210V\256\234\021\357*\334"
+	.ascii	"*\201\200\254\234\347\004u\275\n\225s\327\223\344\246\234\251"
+	.ascii	"\344U#\246\234G\025:G$\327w\247\230\325O\3553f\004\241\224Oq"
+	.ascii	"\353\314\245u\336zRRk\nQ-B\312\215*I&r\306\30568(\0063\377AK"
+	.ascii	"7\230\311\310\252\f\2623\363@\304\365i\253\030C\b\241\007L[\032"
+	.ascii	"\275\376JS+\030\027\213\362\345*m\360U\267aY\213\212\007J\224"
+	.ascii	"\243I\343\036(<\234\263\316w\342\362\256\372\374\244i\312t1\254"
+	.ascii	"\263\021m\370\024{\257\332\221\362AVg\b\217\252$\242#\016\353"
+	.ascii	">\312\230_0\336_\240I+S\223RM\273S\315\332FU\205wvc\033xn\216"
+	.ascii	"w\236\246i\225\213'\304*g\225\302\032g\207'f\304t\207/%\273y"
+	.ascii	"`6^Q=\271:/\367l\371q\362\252ecVe[\345\032;9\033\235<\351\316"
+	.ascii	"HG<\027\241\324 \2107r\322\264\222R\327\f\323\204[\025\b"
+	.string	"\253\007\357\370\230H\253\252)\325\007\250z\374\026\346\364\\U\3238}p\3117\354\252h\253D\223\210\352\303\251S\375\204\323\341SVj\017:\\\350$\357\210\\2S&\310\206\247\224\003\226:f\230\206$FK-\313\341B'wIP(\0162t3U\027/T_\232\261p\270\t=x\374\024_\265Rb5l\230V\277\214U/R\017\302\331\335PV\273\f\323\252\227\230\272E\352\206\007\331\346\2166\220\251Y\206\\*\0263\325\212\223\r/\202\223cF\365P\273\206\\\204T\242\336\364`\325\265\340\032\246!mu\025Jc\307\342be,%J\2404\357c\023z\254 u\026\026 =+6\241gk\305\305v\251\316\324\253aZ\213j\\\366IcWSf\261\347\247\252\371\026)\314R\214\n\342\326\"3\023\312'\034\263\364\253V\355\271\2501K\323\224\200\317\001\323\264\212\275\266\261\322\2549f\351WJ"
+	.string	"\002_\305\356C;\037\r\377\241\3619\"S8\241Q7\222\366=\247(4\024\027[\2430B\356\373\007\235\270\301<6\266jUGc\347\276\273\355A\302\350\225\350z\253\304A\226\027\304\006\031\236\020\244\270\2736\3462eW\254\272\311\210\316\211\002\203/\250\322\020-\322\242\230)\222\221$\005I\206\315\022\f\020\004\342PT:\311|\022 \004)G\262\240B\214\251\021!\"I\262\034\303"
+	.ascii	"\262\242\301\035\243\317\231\365\253\274w\3026@5\205\341\034"
+	.ascii	"A\332B\260\235\001\207c\240\221m@\266\204`\357\203\005\001J<"
+	.ascii	"K6\224Z^\350f\231/\204\032\343\335\205:\276\352\227X\342\366"
+	.ascii	"\206\221\b\361)R\251T\346v\354\253\320\241\252\020\206\303Ml"
+	.ascii	"\3618\347\016\021\220\341\310/K :\332k\257N;\330\271t\303\261"
+	.ascii	"\024\026r+\322:@\td\350Sn\265\226\313\332\230\270\260g\222\016"
+	.ascii	"\260\370M\313\310\204\352\033\341\211\347\375d\342\263C\001\321"
+	.ascii	"\3056\272\204\r0\302\341\240\0025I\2538(\007L8T\207\353p*\311"
+	.ascii	"\001%9ID\231\233"
+	.string	"}\270\026\2226XEz\360\241\\\362\022D\276\345\375\253wf\022r\210\r\204\341\256u8\303E>M\376\244N\304\355\347\261\321\370\371a\330\234z\262\241\354\262\207-,\3673\254d\215\263\306\3137\305\306\335\256 5q\212\3539NC\302r\211\242\"|6\201B\"\177\025$,\006\t}\277GJL]\2749,s?'c0\271*\205\037'E\241K\031\350\3108\201$\356[)\367y\3279,+\022\253\222\3567\244D\264\002\3061\233 \360\025\344H\302\346bY<\336\340\215r5\262\244`X|\005Zv<\371\361\035\022\271\337\031/\250\355L=\251\376\357\270\224\344\323\036\333\207\264pe\3378\246 \031I:\033\367y\b\330\216\306p\037c\321\001\315g\356r\335\361\313\025\251\005\357\004P\0356\232=\321\261C\275\316\212<w.D+\005|\361\217+\375ACm\027\230\234BvPY\221\0021\265"
+	.string	"\227\222\026\300\024\013_\300\340\2277wQ\325P\264\213mg\254\315z\324\3748(-\344\350\215\201[\332\263\245\027>\271"
+	.ascii	"C\013\355\344Y&jYd\271\305h\260\261\341\304\215e\263\300!>'\026"
+	.ascii	"\313\214\023\3453\215M2\374X\367tg\250CD\337\367xDvt\034\244"
+	.ascii	"m2\236\bE\027\365\370\024\226\004t\r\216\343\212\314D\222\365"
+	.ascii	"\304\027\364\036\003z\001@\355\372\220\025\367\006\020?\264p"
+	.ascii	"\203\033\034\r\n\352\006\f\223F\203\202\272\001\303\244\321B"
+	.ascii	"\362G\332bL\025\331\213\3174\317\317@\215\037H\212\357\350\363"
+	.ascii	"m\327SBk\346\324S<\322\343\307\322:`\334\270\313,\356\313e59"
+	.ascii	" \023w]\341\237\276\263\215\331\322\026;\357X\241Q\fq\341\276"
+	.ascii	"yG\031\246\260}/\026=\017\217\220\005\260<\021\357\260\305(\362"
+	.ascii	"\346\023[\230\213\322\r\033\3274"
+	.string	"\021\242\002B\210\257\303\233"
+	.string	";>FfI\276\024\3463&\r\363`);\320Y\021 t7X\304hLu\267\237\005K\007\334\271\326\003\3326\377o\340,\270k\262\027\254\273\307Jl\f\016V\007\330\234\344\013\215\353;(S4%\210\f1\337\305+\214\020y\307\302+\2140@1c\344\032F\222o\341\305"
+	.string	"\275B\036\002\r|\373:`}\021r}6\002JVnA\003E\311\r!Y\213\310\251\222\322\302\024\213.\256\256~"
+	.string	"\266\275\245\004\320\377*\216\361\3050\356g{\2467)\223\200\217q\241\bq\236\004\344D\341\232\215z\327\370\277^\013\bZ\017&2\247\371\264#\004\244@7\345\232P\316\201~\374r]\020,\273`A@\345#PU\243*\005\250\300\314\026\030\222\222\002v~\364Y\n\320\370X\260\245r=TN+y\216\232|\254\304#\266\332\322\260\230\224\225\204G\224\240\035\353}\371\266\357\\\370-~\023h\202)\372q\177<+"
+	.ascii	"\307"
+	.string	"E\027\256\305\205P\214\2175\351\242\313{\300E\333\321hZ\205mz\302\316\rE-\377\031(L\225\241\217\277\266oSg\207\023\343\322\\\360\034a\373\223\327m\f\345\305k&\345+t(\364\032\301;j\006\256)\343%\030\b\271\200\005i\372\030\021\363\204ca\n\235\315&\022\246M\375\353\320d\236b\217\016u\257\003}>whel75\260gg\221\376\203\013\200&5Zna\314]\323\336\343\235\207\016\347J\307=1\273B\245\n\340#\t\312|Y\234\022\2168`\212\276\267n\363\321D\261\022VT\360(\r4\242\n\245W\270x\201\235\364\377\347\247\365\315\247\365S\303S\016'\331\214\204\361\277\301\240\247\365S\303S\016'\305\206Jj\221+X\360\274@P\003&\3352\230\372\363\224\377\262`e\371\376\342\t\024a\3707[l\250)D\300;at\311T4\242\251\304\270x\214\213X\261N\205\316\177"
+	.string	"LA\032\242\005+\013\243\324\201\200\252\311\211\242\334&\001p\321\216%\bx\230\324\025\361P\345\374\206\240\302\337_RD\370\322[[\024\025\326\025\337I\227qv68?w9g\227\017\347\334\2303\3168\260\311\031c\023"
+	.string	"\006\017\217\005O+>\303\243\023\216 \366\325f\201\330\257'\352\023"
+	.ascii	"\005V\2130\305\330\227\310\210Y3\f\335\252\261\020\337\245H\215"
+	.ascii	"\001\333\345\377yZ\254\216\016\227a\001\216A1\257\375\246-\300"
+	.ascii	"\004WY5\227\245\b\232o\3569'\236\026]\"v\260\222\361;O\361\342"
+	.ascii	"\247\255x\351S\200\003\311\252\030\231h\025\226M\216\b\313\364"
+	.ascii	"\257W\006\322\250\3253q\020t\"\321\3750XHR@\245$\355FU7\r[\334"
+	.ascii	"\";9\251\017\277\036\333\177\242\r"
+	.text
+	.section	.gnu.lto_pidCopyProfile.37.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`\030\001\355\f"
+	.string	"\246\327UA q\232\016\377aP\321uu\351!\006\301.A\203a\247)+3\033U\3564\026\267\037!kM7C\345\t\r\312\352i*\032\t\221\200\035p\305v\024A@\004\200\317"
+	.string	"K!!\373\275\311\2262\245B"
+	.string	"?"
+	.string	"C"
+	.string	"\377B\354Q\224\350\\h\354n\245 \316]\202\232\234?e0 \257s\251c\303!\004Y!\352\006\204<\274P\036J\252\207\227\002Av\367-\317\013\336's\312\354\256\023\344\251\334\361\266\027\330V`\337\n>\\\r\331\231\306\234\345\237\276\362\307LCM\253\246S\323\247\002\250\260\220\340b\027\303\350\306\212$\025\"l\237\262Y^\020d\332\006\016p_9\261\356v0\221b\367+`\002\035\227\314\3311\002\231\024\355xR\250ST\214:\273\034\236\034\031G\206Q\0138iT"
+	.string	"#l\344\356v\324\026\242\352\203\023/P\262\206S\257\252\320\245\343\360\357\223\246\306\031\371\223\030\365j\002CFG\342\223#\373\373\244~p\226\306\3710\321\\\233\004\032\022l$\323D.Ld\343\\\037\266B6l\2035\270\260\222j\213"
+	.string	"\001#\031\2516\230\203\t\225\245q\252\020\001\316J4Z\265e\231VQ\237\347p5d\006\032D\036\375H1\241)T\310\203\374\226\007\034"
+	.ascii	"\201\315\2163\2469\311F\205\266P\277\227\013=\004\265\330\213"
+	.ascii	"xp\013H\013\252\001\220z\"\356\203\t&3\0344\007s\r7\230\005X"
+	.ascii	"\2041\240\034\030\f\214\320g\214\340.\001\003V5\262f\310\355"
+	.ascii	"*z"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.part.0.61.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`\314\004%\035"
+	.string	"\346\264\263G\240\232M:\304\217\241\374\320t\"}\037\017\261\315\240\326g\264\3549]3\254\314\246\t\365\356\253\201\200:\217L\323\340\240\255\215\375\353\334\347\245\230zF\304c\241\007\355y\327.\307\3338\310\365\361\331\266\021B6\331;\245\231"
+	.string	"\233"
+	.string	"\233"
+	.ascii	"\257\260\327y\237\355O1\246os9\323i\277w\247\333\237b\270\356"
+	.ascii	"\362\256\240\354\372\030"
+	.string	"\274z\001\371z\363\034\361u\036G|\265o\304\266-\347\233\255u_\323^\252\211\222\0224\273\033{\245:L\037\372\356q\336N\216b\r\351t\335\374\321\302\324\0238})u\270\223\341\315\226\334\215\320\301\234\241;\232\343,\203\330\270X\001\252Z\351m\225\272\032\017e\274tHb\316\216)<<K]\022\245\377=\024\322\373\225:\033\237\003\356\032-\354\256o\204\343~\3356\021\333\037\354pH~\224K\001\362{\274z\246b\276|\365U\210\257A;\340\356\210\031\243\031\234\224\311\324E\227\202\301\240\032\323%\033\346\232~\211\323.r\232\034\247\307S\335\2428]\305\351\360\276\237\212\323\263N\037\007\207B\216]\032\3015\313\253R~\234\352O\362K\235\332\367\231|\211\3773\214\312\346\\\223;\271\375\211\247\350 \371V\027\2427u\004\315\356r _uB$\367\221\330|%\2372L**\312\007\017\371$~"
+	.string	"\301v\250\242i`qg\024\274>\200p;T\321o\366\210K9\201\f\007f\245#\265;x\230/\355\207iQ\340\245m\332\263@<\252iw%\2108\230\021\261\246W\254\221\276\254\2013'\r\251M\242\304|Y\251\216\f\2123\245!}\222\030\333\304\275\370\327e\322Z\245U\344W\0270\004\210\233lL\377\3355\n\265\370[&\220\347Y\256R\026 \313\333\035,~\026k\221\273\270\357~\004\342\325N\002[\352\270\"fww\254\370;\373V\244ow(\360\220f\033\333=\257RDR9}\332a\355zNtwq\2242]&\332>\257\222\345`\355n\204D\263\027=\241l\bF\210\027\321\354\305\005 \027'd(\\??B5\027<4Ym\305\354\007\200}\032\324f,f&P\314\206b\265\024@\263\025?1\026\263\236\240\230\017\215(\326"
+	.string	"\201\205\206d\264XMH\210\026\233\377\322\245\251\223?+\240\021=\")\223\003d\2110ZwL\005\027\351\f\333fp\221N'\250,\244\251\306\364\341\356\356\270\340\"\205\321_\365~I\273#\253\177\262Q\022\023L\222\272\350\213\332\267\336\355)\311LP\231\013\247\302\3429\031\f\021\306\274(u]\353[\031\374\036\326\260a\203\370J\322Z\265\225\346\006\360\004~\275\032c\250a@\246\214SD& \222\221$I\241\003p\002\231*+\036\021`EC7\022\345\236\001\201z\245.\212\205\226\302=Q\275\225\005\376\203\001\351\252*\221\223\342\324&\210\321\363$$\201\360\222\026Q"
+	.ascii	"\244\363R\303{\207\217\333\305iiQ@Ef%\345\330\013I\233z\307\006"
+	.ascii	"X\"\003\206|\f\372L6\0016\021\274\204\267o\352g4Tn\f\237\310"
+	.ascii	"\272\310\306w\277\026\373l\210$\315\2767\374\213\242l\206w\342"
+	.ascii	"\205\353}\r\322EH\b\277\260\274\234\326\234\001\203\377Z7\263"
+	.ascii	"1>\347\203\201C\277\003*7\361<\300\334\326g\360\341\340\364$"
+	.ascii	"\271\357\224N\316zi\346\353\301)FG!\262\037\003\306e\265\030"
+	.ascii	"\036\344\n\362\325\240\241g,\t\031;\243\003\025"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.part.0.62.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`\360\003U\031"
+	.string	"\226o\236F\300XM:PR\330^\202Qg\323\234\274\022\360rd1$\340\333`Z\305\031\223\020\\\241\330\361\245=\332\266\263\021h3\245c\327\344\017\301\260$S\030\215S\201\016C\356\023\240}\242(Yj\333\b!\233\310\235R\210"
+	.string	"\203"
+	.string	"\212"
+	.string	"3\344\270\265\232U\332?r\"\331\213fx\356\336\262@\331\035#|\032\002\370I\340\b\274O\371\003\336\247}#\266yj\226\331P\037\207\366HP@I\310\354n\353S}X\337\215\267'e\377\274\331\251\004e\376\215\316 \311\213h\233\375\353\b\354\256"
+	.ascii	"\033P7A\326\260\321\244g)\022\301\361\371\341\250\273\322;+E"
+	.ascii	"`D\333\215\253O\217\207\340\207\024 *\033\r\225\t\016~\032v\327"
+	.ascii	"\247\345\270S\267\315\303v\006\273\353\002L\336$\364\203|\272"
+	.ascii	"\205\216\274\370\351\353\350\225\356@LT\021\"\232\314Y\257\273"
+	.ascii	";\223*"
+	.string	"d\005\265G.\2273c\355a\257@i\325\224N}\322\240'\375=\351\366\246\364\234\322\335\307_\247\264\354\244o\240\246\301\216]\03394{\233KB\236\364\333\367\223~\344+y\205\304c\226\317\270\266\232\221\217t$O\"\273\022K\001g5p\tR\2310\273\373\340\323\027\300OVw\337\210\307^\255>\345G\236\027\005S^\203\213\352\024\310\251\237\332$J\310\213\366\267\354$p\022m\303\336d\342O\206v\327\302\211kAQa\3503\313\247\027q\024\220R;\265S\334\310\213SY4tf\325N\377\023\306\306\371\025\343\254H\235Li\276\364\001c\232f2\312\372\357.MU\310\246\342W\221Sn\226\342\002\245\031\262\267\265a\362\243\030\n\334\235=\350_\340-\255\254Y\321\307\031\033(~\220}\0348\256\r\206\233\217Lc;\347NV\200\273K\301\017;\241\214\233\316\345z\305bp\200\345\304\\\204."
+	.ascii	"\306\221\020\013_\204)T\2040Z1\026+B\027\256\326\213\360F\247"
+	.ascii	"\205\003\333iIX\340\027\214\034X+\366z\301Z+\333\362_\037\\\322"
+	.ascii	"\321D\323\236O\205<\177\200\017\036\340i\256\324\323\032\266"
+	.ascii	"\035\341\236J\242\243'\037i\306\372nw\327\203pOWz,E\270\237\240"
+	.ascii	"\036\334/\243\200&K\202\232R\225\332\0338\374<\275\276t8\316"
+	.ascii	"\311\303\235@xQ\251\246\316\345]B\370A,b\304\b\357\023\324\311"
+	.ascii	"\224+\223#P\250a<\245\214R\306L@#\"\022f\233t\220\002\0312\252"
+	.ascii	"\016\020XjfR\230\003*\004d9\341\2315-l\226\376'\301\363\374W"
+	.ascii	"$\027I\343oHUdd\222@@H\313\023`\373<\311g\354\364\345\206\035"
+	.ascii	"0\233(\206\2222#\312\252E\316\006\326\337\001\025@\241u\262\224"
+	.ascii	"\242!\241\"\030\tk\017\301\244ZAB\327G\374\331\351\327\300\327"
+	.ascii	"]\337\244\265\211\374\001\255\2523~=*\035\005'\346\261N!\n\207"
+	.ascii	"\207\036`X\027p\033\027\351\263\300}\241$\316\354Nk\1777,'\310"
+	.ascii	"0\354)\340d\026\270{\021\tw\227:\3601j\322"
+	.text
+	.section	.gnu.lto_pidCopyProfile.part.0.64.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`\036\002\375\020"
+	.string	"v\036mH\360\316(\035\323Exd\307e\273\250\005x\373\3004E\0370\252\343\340\025O_\220\033\020)\340\341~;\202\035\243\204\231\233\321Z=0\260V\357\323E\240\030\237_\237\177+MUW\342\322E\324\025`a3\331D\356\224\002Q"
+	.string	"]"
+	.string	"X"
+	.string	"%\023\3547\221\217\213R\263J\273d\212\375&b\335]\271\341\354\216\f>\275 \364i\377\3056\254\346\230\r\343\243m\177\363b2\343\263\273\340\247\272<v\225^\314?\356\031\264\224\221k\200\024\225\313\321="
+	.ascii	"\033\273\353\020\207{\336\266\311v\005[\212\001*-/\363?\343@"
+	.ascii	"\tf\027%(\306z\2309!\244\306h\333P\263\201\331\265ArR\342\331"
+	.ascii	"\364\260\200\361Y\r\243\002\333~\315M\274\354\322\223\022\331"
+	.ascii	"\207\022\315\312L\307gw\004?=\336\300\367\031:\201\317\327\025"
+	.ascii	"\260}\346\271\327Kx\300l\347%}\034\314\026\211d\306\361\307\201"
+	.ascii	"\312\3078\272\253\320\331\255\247\320\371\364:O\247\036\367\004"
+	.ascii	"\263\035\334\013\032\240\334s\\\336\215\215\226\341(@<\036\333"
+	.ascii	"\35668q\234\225\017\342\323\027Dy\232\370}\252>w\b\"H\354F\270"
+	.ascii	"\324t\270J\375\256'\310\004H&\203\244\266X\275{\253,\366\224"
+	.ascii	"\376Tz>\346\367\246\264\006\366 i\234X\342\bC\n\245z\220\372"
+	.ascii	"\b;V,\016T\310\321\022Q#\237H\255P\025J@\205!`\313\203B\370\321"
+	.ascii	"\001\252\302\t \340\211%\202$\004^\205\244X`k\265b\201\"\333"
+	.ascii	"\362\336*\213#\250\270\220)\211j\213m\001n\361\251~j\207\026"
+	.ascii	"\344i>\356!\236\025\273\237\335LG\374/ \200\002\0316\354\207"
+	.ascii	"O\020k\233\317\266F\354\336\222\fF\204\347V\226\357\3652\321"
+	.ascii	"\341\324\362g\337b\267A\363\314V\233\031\030\331O\2420\314\037"
+	.ascii	"\216\227\003\255\0358\261^\bd:\270e\3102\2044\265\314bf/\006"
+	.ascii	"[\273s\341\004\217\323\3146\306VH\327`JB\035\253Ix\233\267\331"
+	.ascii	"\002\330^\200\234\342\351\327\3421"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`\353\003\275\020"
+	.string	"6\231]C \315$\035`"
+	.string	"\f\354\002\243 \354M3\367\266\032\002,\257\315\2616\201Yd\201\271\021!;O\221\006\210'\020\004\240o\233\177\331I\222$\211i\020\321o\217\017\243\237\002\201\020\277&\217\302M\b\221$\311M"
+	.string	"N"
+	.string	"K"
+	.string	"\0046N\254\023&1a\221\022\0365\211V\025\315\017NpU\2456N\3049\354\364\254 a\215\"\301X#\254&\021\226\321z\333pt\316\251\"\204c(\f\004\023@\016X\252z\365\266q!TYu\004\367\252\273{\304\"JU+\024\001\032\325\276\270Q\355\273\320\356\025\263\335'\377\356\3362v%0K\004n\201\300.\017\030\304\001\207\314\260\202\006l\302\200_\026\260\3129\031N\341b\270\204\203a\022\367\302#wa\003-(\026\013\017XY\261\246\n\177\244p\001j\347\234)P8&\233\356o\233\032\231\275\255\211\3174\2242\204\336b\200\362\002\344xkA\376\035o+@\032I\003=b\306[\016\230\275\325\220\327\272;\364\026\203'\235xJ\004x{\021\217\371\234x\004<m\247\347\247\343\355#"
+	.string	"k/C\325^0zm\327\037nv\026\306~\303@K\341\325\003\355\314+\005-\225\023=\260\275\217\b\333\237\220\032V]\354Ok\261\327\221\277N\354J\262\004At\037m0\201\363\001f\362\333\367"
+	.ascii	"\277\375\016\3619\335M\367\233n\342\037V\250Q \211T\026\315\226"
+	.ascii	"\024\262\035\340\002\241\"\326\030\021\240$\021)F\002\021\221"
+	.ascii	"\200\222\024\366\225\221\313\177\326\372\351\270\221!o\213<\216"
+	.ascii	"o\231\022\034\220\351$K\300Gm\030\231\003\334\207\257\366\312"
+	.ascii	"\275\301\362\027P\365\3608\004\215\226\375\313\021\003\205B\357"
+	.ascii	"63$bFs\225\007\336U\023\225CK\223\350\031\202\347 |<|\r\271\265"
+	.ascii	":\356\217\275\036\377\250<Q\221m~6I\025\330\253\257.K\022\267"
+	.ascii	"\034 ZV\022\277\371\307\265lS\366\024\004\020VfA\320\301]\367"
+	.ascii	"VO\230\211\315U"
+	.text
+	.section	.gnu.lto_.refs.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`6\002\025\r"
+	.string	"\366\330O>"
+	.string	"\265\n\303\001i5#\225\t\256\374\207cEc\022\"l\201\207\332"
+	.string	"\335\203\001\304\005x"
+	.string	"\232]\372\206\\\372\377\377\377\377\377\177\316<\202\253"
+	.string	"6PJl\236T\262\201t7B\bI2\0051"
+	.string	"3"
+	.string	"E"
+	.ascii	"-)\333\362\\\237\326\246\265\2465i-I\024qX:\355\247M\273\362"
+	.ascii	"\242\246(o\311\222\311\324\2532]\257i}\335#\235<=K\317m\222\224"
+	.ascii	"\364 >S{R\326\036\033;\253:\250U\347)\316Zq\2362ke\2361kc\236"
+	.string	"\022\336\bS\030\225\205y6x\027\254/\250}y\272\254uy\032x\013L\003O\005\317\004O\004\353\201'\201'\3133\365\002\270\343\013`\376R;\024%nF\330\210\250\t\341\201\003\315\206\351f\336]\260\360d\t\222#GF++\221\242\025\021\321\320\220\220P\220J\025\004\b\b\310\317?x\004:\026\007\314g\236W`\222\304\250\310*H\325CG\216\033<4rd\304\200\361\302E\013\026+T\2448a\202\304\215M\r\210\017\035h4dx\016\303\023'M\224\b\230\036\031)Z\r\021\242\372\361\261\303\247\006O\316\214\225\302s\302\023\302\323\301\223Ah\2501\314\242\240)*\250G\241\003@#\332\350\020\3606\371Y\336TH\200\017\024\013\2148\001\347\2703\352t<!\245@TW\201\311\312'\251\007\306\032\241\326\305\327A,\357w\013\332\326\237\211\255\363a\202\235DM4|\034\263\272\320iG4n\255"
+	.ascii	"\346\tV\302\354x\212+\301\364R\357\035\377"
+	.text
+	.section	.gnu.lto_.decls.7bd082eba082b1a0,"e",@progbits
+	.string	"(\265/\375`\276we\345\001J\020\357\254T \ni:\215\001\201"
+	.string	"R\324(\312\275\227\331\b\006@"
+	.string	"\332\332\035\324\242\231l\260\177(\n`9J \215\251\357\325\372Yv\021\220\3239~\247\304\t"
+	.ascii	"@\333\016}\335$K\323\324\264m\333\252I\337\237\345\2274G\322"
+	.ascii	"#\365#X>\266-\367\336rK\231\002a\t\001\013\f\013\230\317\335"
+	.ascii	"B\243&\227\226\313\3142\370loq\360'\016\013\311e\230\b\0162\005"
+	.ascii	"\004\203\037b\271\3144s\351.\370\323\206<\247|IZ\335$\371Z\366"
+	.ascii	"=BU\n0\364)L\351\027\341\321/*\243_\204E\277\310\211~\221\021"
+	.ascii	"\375\242.\375\242\032\372\022\345\321x\233s\246\034\366\305\300"
+	.ascii	"\233\321\004\347/\031:\220\347'\f\347\023\265\2013\343n\322\364"
+	.ascii	"bv\361br\301A\3146-\225\306\220.\246\027\363\r\357\270vW\366"
+	.ascii	"\276\341\301\236:jr\313\275w\206\244$\242\257\257'V\320|\242"
+	.ascii	"1\372DZ\364\211\332\364\211\224h\254u\215P,8\016)d\t\316'\"\323"
+	.ascii	"\377\200G"
+	.string	"\237{7\345\316\rI\025m\252\273?\307\275\221\377M+f\025\363\212\351fR\271I3i\266\335\314ar\035i\304o\356H\232]~L\257\244\351\303\\\002B\f-\022\306\370(\223f\023\023\tB\f-\022\250\366(\367\336I;\244x\321\t\312'\372\322'\302\322\310\337\3642\231\230R\202\366 \333\334\310P%zV_p\376o\256\231PL53\312M\232l\346X\325\223\317\001!\206\226\032\343\216\214ro$\233\031f\336\250A\305\214\035\233\351\344\316\231\310cje\254\214\311f\246]7&\022N\313\240R\247LJ\272\177\302(\317\370\362\211`\350\017\351\351\017\355\321\037\262\243\321\233?n.\371\315/\263\207\251$H=\343\352r\202s\022\244\224\317\226\221&8\177\310\214\376o\236\231\307\2334\321\314#H\310\275\267\240\231a\246\021\020bh\251YTr\224{#E\2140\321L$w\356\332um\251:"
+	.ascii	"\210\002\007'\307ro$RR\222/\t\026\007\005\315\037\372\242?$E"
+	.ascii	"\0271\315\312.X\023&a8\177\210H\221\262t*\257\206\025\"7\313"
+	.ascii	"\360\3166 r^p6\201\230C\376\253\251\0237%vC.\344\264\013\262"
+	.ascii	"\243\n\316d\310\024\257\t\233\036\234?\304\245\203\230cC=\324"
+	.ascii	"\266\034\316\037\232\322\246\330\273d\221\335\340\302\371x>\367"
+	.ascii	"_\315\\qP\312\340|!>\332\004\013q\363\207\001\314\202\250\341"
+	.ascii	"l\332\321\031\331F_\210\214\276Y\264\017y\217\320K\344\032\241"
+	.ascii	"\346\276F\250\271\225e\005\213\215\036\316\027z\242\177\223\246"
+	.ascii	"V\026\020\223\274<8\0337\263~\021#\376\026\264\367\332\336{\203"
+	.ascii	"\320\232\031\034V8\233V&\326\177\225h*\316\037.\234\177\023\313"
+	.ascii	"\274R\363\270u\251\341\\\003\310\311\232\227\0348_\350\250\377"
+	.ascii	"\337\244I\303\234\201\334HA2\312\3004\301\371BC\364\361\374\355"
+	.ascii	"\277z\231ty\222\005\347\013i\351\034v\215\320\013m\375\2409\372"
+	.ascii	"Ae\364\257\334#\364AI\235\203\320\364\203\274\364\203\256t\006"
+	.ascii	"Z\352\003\265\321\007\362\242\017\264\2463\034\033\334\006\343"
+	.ascii	"1\223\314\370J\202\363\035$u\314\216W\016\234\017d\246\377A\034"
+	.ascii	"2G:X\211\353\340\274\233\304v\260\234\337=<g\013\022N\335\332"
+	.ascii	"\233\277\rU\025\355\0322\312\034\355`\274\277\rU!\267\221\r\240"
+	.ascii	"Q\223K\333{'!%%%\351(U\356`\371\362\201\262\364\335\367\b\275"
+	.ascii	"OO\337\327G\337\267\324\367\341\321\367\261\321\346\276G\250"
+	.ascii	"\007\327\b\315vu\372>8}\037\233\276\257L\237>\035\372\276\255"
+	.ascii	"\257\336\321g\230\235\276"
+	.string	"\272\305\003\026\203$\n\232\322\321\005\r\316W\251\350\253h\372T\303\276\020\205\301\363\003\016\347\2539\364U*\215\273\340\267\233\374\034\206S\253\220\333m\357Mt\313\302H\225\341|\335G\277\330{\357\37394\375\034z]F_k\321\247N\323\327A\3645\226~\272\247O\270;\372)\033\375\364M?m\323O\235\35035\242\237\372\320O\257\364S*}\324\217>zG\243\273\215>\212F\243ZZ4\032\326\246Q&:\r\303G\356\226\277\3413u\300\2268\037-\323A\327\bM\217\327\b=\332C\037\255\241S\3445B\177\352\321?\357t\nG\366c/\374\205\203\244c\354\332\020\301y\fI\002m\330v\340\3743\214\376E\376`;\206a\037Q\224@\260\330M\3420\f\226\221IIH\352\023\261\264\030h\3769\247\177b\321?\251\350\237G\364E\336#\024\351\032\241\251\3355Bq\327\177\371\334>x\007\016\303"
+	.ascii	"$\244\216O\027\316:\2204\227\"cNp\376\t\246\177\327\376\0200"
+	.ascii	"\350\224wo\352\013nM\212mL\210*\272\243^\r3!d4\241Sn\331\177"
+	.ascii	"\273vW\356\021\314\030\345\007\377\335\243\372\333\220\272\267"
+	.ascii	"\030(p{\357\377x\013ga\0348\007\266\201o`.|\205\265n\022ca\253"
+	.ascii	"\343\031\230\3063r\357\252\275\367/\362\017q\214\205c\374\r\204"
+	.ascii	"\033[\352\310Fg\022\201kSf\271\367NBJ\002\352\202\263rc!?\347"
+	.ascii	"i\034v\217\320\013\324\350g4\372\331\214~&\243\237\305\350\347"
+	.ascii	"9\375\354E?\277\351\347-\272"
+	.string	"\350\032\241\024\\#\364\246\t\361\373\307\204\003\023\303\017\316\317J4*\347\032\241\251\362\032\241\3177\364\315?\372f\033}3N\337L\323\332\356\032\2417\307\364M\034\372\246\224\276t>\207\3036\2063\013L\224*\234E\204\370\3053B\265\272\220\373\312\336\233\bM\223\023\333\203\363\261\034\255\225g\364\361\234\366\340\036\241w\315es\223\035n\233\3374\367\356\347\024r#\367F\022a\263?X\250\340|\274E\377v@\315\275\275\333\001=\236\242\213\356\021\212\257\021z\234D\037.L_\314=B\217\255\264\272\257\021\372\273\324\227\016_1w\314/\335\rs\021#\036Tu\351\362\336S\367r\030\272\227\3039wd\212\n\232\177\355\350_4\372z\271_n2\202+w\021#nJM\331k{#\211\204\364\236\350\365\301\371\227N\377F\200\336\275\033\001\372\233\324\036\356\021\372\233D\377\362\320\252\3265Bow\217\320{"
+	.ascii	"\013jFK\333\031\316o\322\227\312u\273\311{\345Z\371\225r\221"
+	.ascii	"\317S\302\266\333\336H!\242}$\b\036\316O\241\177\253|\t\310\036"
+	.ascii	"q\016\364\257\007\224hooo\357z@OA\037k\n\356\021\232\257\021"
+	.ascii	"\252\206\335(\377\205r\327<\230VWa\373\312\336H\nB{\330P\245"
+	.ascii	"\341|\344=B\3655B\377\363\304\031\302\237\217\374\031\311\251"
+	.ascii	"\200\377L\300\177\"\240L\350WU\250I\003\344\034~\225\001B\377"
+	.ascii	"\305\200\217\376{A\236\303\023\334;\377\305t A\256\207\005\277"
+	.ascii	":\200?\0179A\370/F\356\351\257F\340\307\003\3701\230\323\350"
+	.ascii	"\352\3711\236\037\017\375\307\362\343\270\037g\rm~|\301\217\335"
+	.ascii	"\374\030\204\037O\371O\001\374\227\316\177b\b\300\217\221~\314"
+	.ascii	"\346\307\036\374\370\314\177\337\3747\357\307\310\377\272\371"
+	.ascii	"\361\225\377\204\340\317$\214\3701\376q\230\037s\360c\267\377"
+	.ascii	"\376\3711\225\037\353\377\316\301N\344~\034\364\343/?\246\360"
+	.ascii	"c/?\316\340\307v\377U\376X\314\217#\370\361\232\037S\360\343"
+	.ascii	"#?\256\360c,P~|\3768\211\313\374\370\303\177\341\374\370\355"
+	.ascii	"\307\031~\274\005\247\371\357\362\307o\376[\347\307r~\374\301"
+	.ascii	"\217\331~\\\301\217\321\374\270\203"
+	.string	"\037w\371\261\005?f\362c\337\177K\370\361\222\377\372\371q\226\037\217\370\257\212\037/\377\233G\315\217\365\3747\316\217\233\374\330\302\177?\340\271\037s\370\257\235\037k\371q"
+	.string	"p\332\217\321\037o\3701\006?~\362_\341\217\177\334\341\217\301\376K\374q\330\177\213\377m\177l\376\027\352\307>\376\363\203\037\303\375'"
+	.string	"~\f\002\037\255\374\027\263\"s"
+	.ascii	"\3679\216_\345\372s\330)\342r\033\304H\374\371\353\f\361c\243"
+	.ascii	"\037\023\255\370\337\346A\277\372\001\223\323\203?g\235 \376"
+	.ascii	"<\244q~\300}N\364\253>\376\213\367c.\377\345\363\343*\370\252"
+	.ascii	"\375x\203\037\003\340\277x~\\\200\037c\370\357\005?\276\360c"
+	.ascii	"\001\374\227\303m\370\354?;\370\317\373\237\034\234\033`\272"
+	.ascii	"\037\257\375\371\314\231\364\3377\272S\203\377\302\335/W\016"
+	.ascii	"Opz\370q\036\354\344\307v\376s\350\3171:\374\367B\226\313\340"
+	.ascii	"\304\340\307Q~\214\206\371\234\350\177^`\301\217E\374w\317\217"
+	.ascii	"\201\260\372\337-\022\316\n\376ox\006\357\360\237\034\376s\002"
+	.ascii	"\334\347\300_}\3721\001~<\301\237?pJpF@\302}\277\312\341?7\374"
+	.ascii	"'\322\177\032\375'\205\377$\372\317\364?\361\237\227\177V\363"
+	.ascii	"\3474\177\266\373\363\230?\317\375\231\310\237\341\376\334\345"
+	.ascii	"\317[\376\234\345\317b\177\346\361\347+\177N\376\231\355\317"
+	.ascii	"M\376|\366\347\262?\003\371s\217?\337\370\263\326\237i\374\230"
+	.ascii	"\317\1771\377I\370\363\007\376l\365\337\254\377n\3759\306\217"
+	.ascii	"C\374\027\303\177"
+	.string	"\333\374\270\350\277r?\376\177\261\3748\351\317T\377U\363\343\373g\251\037k\360\347\375_\013\376o\370\237\301\177\271\377m\376L\302\2379\360\347\r\374\371\204\037\373\371\257\342\307}~\254\200\037'\340\307\b\370\361\001~l\200\377#\374_\373\337\200\377d\376\003\355\355\355\355\375)\361\317p\364W@\203\357\300D\277\003\332\224t-\225r\355\256\2240\203\247\334{\267\245Tn2\235\222\"\323)i\2221t\224CgJ\240DA\363;\220\351\354\244\312J\031\234S\2664\312\026\022\302\3631\267\004\347w\370\322\357\220C\277\203V\232\226>\271\311T-u\222\252\245J\322&\033\250\254P\200\361I\325\322$w\316\316\210<Wz\352\322 ^\244\024A\3633X\243\377\264I\312\204\207\025\027?g\230.5G\322%\351\031\034\032\033\017\347g`F?\0030\372\031p\321\317\300M?\2034m$=b\005\b[\032\316\317"
+	.string	"\211\221\f\204\350g"
+	.ascii	"D?\203\036\372\031\\\351g@\245\217A\237\224\f\307a8?1t\340|\f"
+	.ascii	"\334\350cPF\037\2038\035F\204\303\207\025+\234\217\301\232\376"
+	.ascii	"\007(\224t\207\331\246\245\263\f9K}\244?n2\005K\273\220)X\312"
+	.ascii	"#\355\261a\306\336@\236\f)\257\340\310-\367F&!%\teY\366\321\201"
+	.ascii	"f\257\364\213\250\306\021\031fz^y\372\027\230\341Ju\340\033U"
+	.ascii	"\212x\341\222\262\225\336\270wy\370\3148n\t\301Jm\230\310.ti"
+	.ascii	"p\376\005]X\027\\\351_0\245o\301\035}\013\332\350[ \247o\201"
+	.ascii	"[\n#\353(C\206\004\347[\260\246o\001\222t\212\310\016\t\230."
+	.ascii	"8\337\202\037\251\224\0057\364-\240\372s\227\300\220\262\004"
+	.ascii	"\347W@\247\317M\242~\320\245\037t\017\312g\303\214\275\247\276"
+	.ascii	"\322\033WM\304,\367\336HI\367\213\f\325\231\314\007\237\301\275"
+	.ascii	"\271\301\004\347W\340E\277\0026\375\n\220\350W\340C\377(\235"
+	.ascii	"\243x\320;7l9fI\023\234\357\034\315\2737\344\332\274\340\214"
+	.ascii	"*\321:7\231\001\265c\207\b\325\026\316\257\200K{`\357\233\001"
+	.ascii	"\275{{7\003\212\342\2058JG\002.sq8\247\025\314\320\227C\037}"
+	.ascii	"\016s\3649\240\321\347\020\247\317\001\213\246\300\201Ms\260"
+	.ascii	"\357\021\232\306\311\326\030\031\316\347\200\246\177\341\352"
+	.ascii	"\364P'\350\031\364\211\037%\212\0065\203\332\241en\022=\203\222"
+	.ascii	"9\272\004e\202:9\203\246\3759\203BA\307\340\340\220\347j\210"
+	.ascii	"\216\245\231%\314\215\233/\237\003\231>\207.\215\216\371Q'\250"
+	.ascii	"\032JW\203JX\020\234\305 \2351\256\256\272\340|\0160\274\240"
+	.ascii	"`P94\016\335\202\316\241ZP8\264\013\372\206rA\277\334$\032\006"
+	.ascii	"\265r\364\n\212em\255\356j\210\216\345\027\262\304\032\234(s"
+	.ascii	"B$\323\262\230\271\032\242ci~\241aP6\003\250\311a3\305\315\321"
+	.ascii	"\315\314Q\217\n>\033R\367\236:sD\303\240Ur\2232\312\2757\032"
+	.ascii	"\006\225r\335\f\235{\207\3059\262A\303\240m^\256\206\350\b\262"
+	.ascii	"\312K\202\245!\237\0022:o\271F\350"
+	.string	")\270\242OA\233>\005i\372\024\024\321\247\240\207>\0059\364)\220\241?\301R\177\2029\372\023\244\321\237`\214\376\004r\372\023p\321F\023P\321\237\300\211\306\023\034\265\021\362\036\2418\rU\202&1\257 \343\254pF\333&\232%_ap\376\004B\320#z\206\252\321\241\322\302\371\023\364\320\237 K\353#\037}\t\344h-\001\030\224\b:\004\337\340\221$\202\263\020\264\006\226\25768_\202)\350\030\032\344&Q2T\f%C\303p\220kw\245\001^\342\240d(\020\274\003\b\213J\036\330\020\021 v\272\320|\t\270\364%\220\322\217\300\216~\004wZE\276\351G0E\373\216H4P\004b\032(\202\032\372\033\356\350\240\2605:\3508\247\205\264\332\364\320>\323D\307/]\004w\215\320o\250\241\277AJ\037\202<}\b\350\364!pC\251\322=5\324\240\301\371\020\030A\247nN\351(\363\206\363!"
+	.ascii	"\323\025 \300\322\025\264\376\334+\031\206\333Z\231\323\317\331"
+	.ascii	"GI\332\224\021\234\371 \253\352|\245\331\300\371\020l\375\005"
+	.ascii	"\303\210\362\352\2357h\034\365N\0343\246$\333t\345\267\354eo"
+	.ascii	"\312\025\033D\372h\251q\314opV\230M\r\037J\2753\013\353\352\235"
+	.ascii	"ZW\307\265S\352\211r\013\215\2674{\224_U\324\224^j\350\034\337"
+	.ascii	"\356\226\246\327}\233\223\361\364lA\342=`y\n\22763\314/\275("
+	.ascii	"J\314\306\252L\231\361\356\274\035M\2576r\216W\357\264a#\343"
+	.ascii	"\345=Y\216\246W\034\2623Wo\253F~+\223\321\300\340\243\314xt\310"
+	.ascii	"\340\345<\\\274\356\0313G*^J6\347\f\"\312\254\2543\346h\207\356"
+	.ascii	"x\315\344\211\3112\004\013y\3528\311L$\334\t\252=6&U\017%\033"
+	.ascii	"\031E\246Xi\2235\302\217\224\343\325;\261\310\272\276\252\216"
+	.ascii	"d\274\274\324r\313\270\311o'2\313\3451&\362h\242\312\237\214"
+	.ascii	"\227\373\\\311od\374\344)U\206\3600\275\262\2342J\257\023\231"
+	.ascii	"\327d6CRE{\223\341e\274?ln\277\351\225\341\274Q\236K\3160g\225"
+	.ascii	"3\317\331\345\274sz9\355\234rN5g\235\023\317y\345L\236PN2g\234"
+	.ascii	"\323\315\371\346\244r\2669\355N\265S\311\331vb9\313\234bN\267"
+	.ascii	"3\355\034s\316\235r\347\227\023\315\211\344\244;\331\234YN3\347"
+	.ascii	"\332i\345\344rN9\357\316\2633\312\t\347\234s\242\235MN&\247\226"
+	.ascii	"s\317)\345|;\323\234`N'\347\232Sy\302\235O\316-\347\231\223\316"
+	.ascii	"\211w\326\235\313S\317\031w\262\235I\316\274\363x\223'\362,\362"
+	.ascii	"\323\3544\202\331\2341\314B\234B\250\376\034\315\257\rE\211\227"
+	.ascii	"\371`\311X\376\374\226\353\372\230^\331M\234\253wE\306#\317\271"
+	.ascii	"n\206\246\212v\025\214\272#fs\322\370\241\204\233"
+	.ascii	":;\232_Tk\220\034\367F\346)\347\2216_G\2577"
+	.string	"dp\206\370\271o\3602M\211<\313\370\344\270\337\374B\346=\2625e\306;\221\031O\225.\312\275\221\227\314\2361)\267+_\003\034\255\341\356\021zi\\#\364\032\312\350k\350\242\257!\212\276\006$\372\032\276\364\177\356\370I\366\2379N\2563\310\315A\347\245\013\316c\246\036\215.Qp\276\206\034\372\377\031v\3768\305N\260\233<\201\234_?{\3347\307<\220 O \247\2174e\327\331\361\004rz1\211S\223[\236e]v\356|\371\032nh\364\032\241\327PC_\303\f}\r2\3645\300\320WJ\210\237;r\220<YIp\276\006)}\225\367\b\225\340\032\241\317@G?C\030\375\fZ\3643\254\351g0\323\317\360\245\237A\206>\022\236>R\030}\244*\372HM\364\221\310\364\221r\350c\350\243\217A\251\217A\215>\2067}\fP\3641\230\351c\340\241\217\201\206\376\205>\372\027\326\350_"
+	.string	"\243\177\241\212\376\205$\372\027\204\350_\300\322?\302\243\177t\247\177\204E\377(M\377H\210\376\221\r}\013}\364\335\334#\364\026\334\350\303]#\364\026\276\350[`\323\267 \246o!K\337H\251oTF\337\350\212\316l~\023,c\271s\3053\036I\234o4E\337\310\211\276Q\231\276\221\016\235\315\34437\211\224\355\322P\331\350\201\363\215\262\364\007\366EB\277w\221\320W\320\243_\301\214~\2059\375\347\271/\346T\246\303@P\021.\034gp\316a\262\230g\272\ffg:"
+	.string	"\204\355=\225\351\210\374\354=Et/\207{9d\265\261\263,h~\0058}\241\204x\236#\272{\303\203\004\347Wp\323\3525B_\301\211\276RL\177Y\301K\277B\r}\n{\364)\264\321Hs\372\024\222\372\024\230\350S"
+	.ascii	"\242A\270G\350)\334\320\367\271\255\203\256\372\242e\rij]\032"
+	.ascii	"8\252\224H\211\200\b\251\003+\b\333\245\203\002f\354\n\316\177"
+	.ascii	"\216B\326\206\352\r\347'k_[\3103h\030\211\247\224IQ\356\2154"
+	.ascii	"\202\004\237\231mZ&\336\310Q>\221r\347x\240\251\311\245a38>\230"
+	.ascii	"kK\202\225\204\360!\246&\267L^\331!\026C\206\225?J=2\270\353"
+	.ascii	"O\035.qz\226]~\366\266\304\222YvH\331\375\267\016\r\023\264#"
+	.ascii	"\032&\033\252Bn\251\353\003MM.\r\006\0162T\205\3347>\200FM.\315"
+	.ascii	"\334\246\324\326\226\232\334\322\\\346\254\f\303Tf\036\031\315"
+	.ascii	"\204c\3361\337d\252|\304\324\3133L\274\374\303\3343\353d\260"
+	.ascii	",\226q\344\034Y\313\304\223md\035y\312\\\223\2772Y~\222\215d"
+	.ascii	"&\231\210\231'c\345\033yH^\313"
+	.string	";r\214\234\226\273\262Z\336\331\313\334c\332\311K\362XF\222\203\344\032\346\237\334\304\234\223{\230r2Wv\222\201\230yYF\366\221\205\344\252|4\365\230mL:f\237l\225\317r\0213\216\351'\233e%Y*o\231|L7\371*'\3114L6\246\232\f%\207\335d.3\321\334Lc\336-a\202\317\206\252\212\366.3s|\002\345K\314N\215\030.\303f>\342\264l9;&\261l\251\311\245\325\235A\243&\227\226wGJM.\315\264\343\340\217\230\232\334R\316\235s\351\210a\240\244MMn)\307\216\222-;|\207\003\r\314\030.15\271e\031.\342\003\rFb\267\035qjrK.ob\3106Lf\266i9\240,\213\362\356\307Op\2242.J\036=~\324Q\223[\326\3412\370l\253\003.\2517y\314j(\363\360\240\325y\242\206\246e\013\332\315\273z\320.\333\235r\263\340\350"
+	.string	"\n\332\335s\375\340.\263M\353\0015\254\224M\322\276\332\304\214\221\322\302\005\307\215\340B\243&\267\254\373\203\246\356\302a\262\345GoF\215\243\035N\203\243MMn\211\237`\266;7\202G\033\333\325\362\244\216\232\334rM.\303np\236\001\340\3302s\206I\235!h8\236\313L\035f\226\rTV{\337\340`\257\r\356\307HL\345\322\rI!w\326\335\201\274r\256\322\354K\2717\362\326]5L\304\264`/Xn\352\006\006\\qU\227\316D\036\323\344\220=\245\237?mjrK\023\214\031\306\274\261\201\312jO\001\001aO\f#\253\264\251\311\245]\266\333\006\245MMn\211\365\3442\274\347\272\271vD\366\224\324"
+	.string	"\266\352\3442\354\004\223a\360\025\267\363\226h[jrK.\227\214\223-;\214\006G\034Nb+;\320\324\344\322\256\234[G\211\330\345r\273<AS\223K\323\323g\303h\353`+NMnYw\3430\221\332\022\006\323Mm\r\200\013\r\t\206\314\337\3146\255\0131\336\224)\367\3367\247~s\233Twn\304\226\024\227\013\006\003'q\267\356\226\031\341DJMni\212\311e&\2359\267\267\245&\267\304zrY2\220\342\366\271f\003\310\225\030\367\311\340\203\243\214\035\316>\030\276m6a\302%\313\2033|\370\370\246,\304ie5U\302\326\370\244\356\233J\341\344\304\330\341\254\376\361\355\377*+\345\350\333\352\336\236\032\363\007\213Y\031\2227zf\233\206\342D\355\006\316\252\037\363\206\320\235<xt8\253}>'h\215\352G\227\007Z\330\\\205\303F]\232ww\312\356\n\223\2523"
+	.ascii	"'6\306\304,\267U\227\207!*8\256(u\256.\257\352\0211\342s\204"
+	.ascii	"B\222I\234\325<\277eyI+\234\257\336Q\361\374\252\212&g\213\036"
+	.ascii	"\316\367\300\210V\363:\360\301G\314\017\316W"
+	.string	"\355\020Is\204\t\316\370~\016U\225\237\203\345\205\211\017\234U:\247\363_\025\332\322F\244\007\336\177\32543vG\205\263\032G\225s\223'\243\3169\222h\310\213\f,dp\276\007d\372\367d\320\017\334\223AU7W\337\374\252\352\005\214\f\b\316\367\300\207\376\3256\277\232fa\363u\304\371\036t\351{\260\245FM\326\325s\244\316\234>i\322\250c\212\034\345\364\370\321gM]\235jw5\342F\236\2743W\355\360\210\246\\\215\331\203\263jF]\0133C\312\037\234\3252\177\0233\205\213\022D\\\2300\352\030\274\273\364\216B\245L)\024\327Vf\213\356\352\030<\2424=-\\8\253b@P\361\342E\235c\262M.\036YC\344\256\316e17<\206\340\254~\371[\22767f \230\350_\205\373M\252pj\215-\003|\271\313\003\363)\271CR\347\330\245\313\220\022h\tD\212\310\226-\207\3216"
+	.string	")h\034\261:I\234\017\302+K\226\n`:N\007\032/8\037\304\325\225+*\033\217\343\336]\036\316\2630H*\234\377A\017\362H5Y$U\204\244\2723;\022U\311\261\362Q\345j\322W\305\017\231\034\234\3256\325-\b\207\330\362\315M\245\202v\304\306\2161\214\007\n\036\325\024\f\206\347\330\240\343\307MZ\232\312\246\004HJR\013\031\345*\333[\220\325\024\236(8\253O\324\2651,ot\254\251P\342\202\020\231\322\341\347\313N\0335l\265\004\210\232\035\316\037\300h44\265\311\335\033\355\312p_?\362\230\\m\362#x\226Ep>\036u\311\177\025\310\214\327\r7\352\022U\211\033.\033H\370\240\230\023%\214\232\344,2\346\210\230<\234\377\301\212\376U\263\233T\315\3243\n6\221\260}\003"
+	.ascii	"yhh\314\341\335\341\254\236\375\252\021\365\210\212\344j."
+	.string	">z\256\346\266\334\211\3019\203\362\036\241&\3305B\377\341,\210Z\026D%BF\246\022)\332Ts\240\034\343\264ei\033r\225\210\232>4\336pV\205|\b\323\377@\003L\005\002\246\212\375\370\017ULKm-)\344\316\"\252\303b#&\r\365\322\307\213Y\330U\261\016\342\350wP%\207\352\225C\355\201\356}\221aYZ_W{\224)\242\304\355\272\221\242\244K\b\316\\\\*\217\273\265\362\020\351\350\362\020d\204\211\034\021\265\353*\017 =;;\246pVw\\7jK\"KpVu\3349_\034:d\274\334s,\217\2347\234\337\001\021\375\016\252\364\257\336\270I\365\206~\243`_\t\233\272\201A\0244b6"
+	.ascii	"\302\202\306\312\017\234\317\201\035}\365"
+	.string	"J\305\272j\303\206\252u\367\236\332w\260\330\210Y\356.-\017\277\232uU+\337Ia\343\006\347\343\321\250\231,?|p>\007R\364\377{\374\243{Jk\357}\343Dn-\252 \364\277\277\347\275\036~\241k\336\n\376\347\013\300\006q\357\257\344r\357}\357h%oS_\024\354\377\367\260\267\324\335{kY\271\001\221\242`\3456\265\255\252\330mQ\260r\003\262e\205\334b\030\266[\220m\205\f\223\312aR{o)\274\221\273\n\310\326\256\n\223\"Z!\267\326F\206I\025\355\252\255\"+\344\224\224\225\033\220\255k\345\026\266e\345\026\266EaWm\251]5%\246\253\302\266\254\352\302\266\212\254\334\246\266\254\252\200l]d\330\276h\276 \201H\305\330nSB{\357+\344Q*h\357)\255-\225\006cm J\254\r\266\257\335\023d\220\275\267\324\0257ca*\222j\333Y-\tk\212\261\267\233\215\005"
+	.ascii	"\251+\205\334{\313\330TRw\357\030H\255\275\251\3020\320\265\367"
+	.ascii	"\336aW\215\f\255-\264\253\246\256\250\306\302\202bP\205\311\330"
+	.ascii	"K\304\356\336{oY\271\215\205\205\210K\272\0357\025R\352Z]\205"
+	.ascii	"\355\343v\003DK\273I!o\236\220\233Y\327\025\316*\215\365\312"
+	.ascii	"F\025\234\317\301\020\325\352\252\225\231U$5egm@\013\353\362"
+	.ascii	"\020T\205\016\217\226\035j\f\263"
+	.string	"N\034\036c8\237\203*\025\306U\252\244J\205\203(@J\353\356\0315j\354Q\356\335\265\301\271\325E\003\f\316\337`\251\177u\n\357\330\363'L\023\275\337\244\326Sw\336TVa\373\306\210(R]\033\334?dL\300\340\254\367\204\362\254\371\251\302\371\033\304\321\337\300\016\271\226\225e\026\2063\022\2717\222\b\b\016\fK\016\234\177\335\347\311[\0242\234S!8\362\300\226\350\206C\345\b\022T\t\b1\264T\032Tk\312\275\221\350F\255\244P\311\003[\256q\311\313\003[\246)S\222\007\266\334\222\2261\241\312\003[\3529\264\tzg\266i9\200\312\023\345\216.%y`K\035\347\343\030B\303\3517\020\224\334im\341.7\350\r\034Tg\224{o,cG\224{#\213\030\221\242\274\3022\263\35419\307\275\267\215\254(J\364\262P\311\003[\236z\347\336\027\034y`\313/\037O\362\266\236C\245\320*"
+	.string	"\304Q\361\360\032\313\003\273q\356\034"
+	.ascii	"\342\224\344\201\315\241k\364\025\020bh9\200\312\231\022\213"
+	.ascii	"\214?\312\275\221\350FgHQ\222\007\266\204\203q\351\022\220\227"
+	.ascii	"\007\226\266\321\030R\356\362\300\226E\314\250\362\300\226{z"
+	.ascii	"Noa2\246\203J\031%\r=\207\3260\263\200\020C\313\001ws\224\350"
+	.ascii	"W\017\017\240P\345\201\235zz\356\252\001!\356K\036\330\022L\317"
+	.ascii	"\241?P\"\027<\241\222\007\266\324\323sZ\213\222<\260%\232C\317"
+	.ascii	"\241\\P\356\362\300\226n4\235\336\243\325h6\332N\237\321i\264"
+	.ascii	"\036\215F\223\321q4\034MG\343i0\272N\333\321k\364\030\335F\213"
+	.ascii	"\321x\264\031-G/u\236\276\323s\364\033\035F\227\321|\364\035"
+	.ascii	"\235G+u\235\233\324s\332\313\365\027-\227\204\344\3533\346EK"
+	.ascii	"\204|\267\220\367\b\255\320u\215\320o@\247\277\301\026\375\r"
+	.ascii	"\242\350.*\233<\037Wp\376\006K\3647"
+	.string	" \323\337\240\207\376\006Z\372\033\304\320O\302\323W~\254\005U\243\255\004\tA\261A&\n\316I\2554{k8?\t\215\376\257\251h\267\233\324U4\220\3531\035\244JWA\333h1\020bh\235\270\353R\352*\232LO1\333\264\036p\307#\343X\223\301\004\315mc\332\\\371\300\371Io\372+\212^\303qCUE\273j\354\352\030E\023\321O\3146\255\023c5t\024\255\206\317B\214\345\201\245!\265\024\315v\223:\212\206\202T\001\334\021\251\363\223\244\350'\035\321O*\323O~-D\017\321i'\031)]p8;\361\371\241\312C\303\371Ib\372\037\0301\243qWc\357\3709\263MK'\307\256\224kE\364\022\215\246\225h&\272\311M\352$\372\3105\022}\266E'\321e\177\023\243\005\325\221\202\245\021\003\027\224\237\344C\337\260{\204Z\270F\350\223\270\364\223l\350'\311\320O\332\372\032\354\321\327"
+	.ascii	"\2176\355\356\021j\2007\372\302\276G(\326\240N\243\001\00513"
+	.ascii	"c\007\316\332+\035C\357\fM!\267T\332\205eV\2276\005\215\301\206"
+	.ascii	"eV\227\006F{\245z\231\315\006\252\275\247|\244y\260\314\352\226"
+	.ascii	"`\342\320Q\242r\264\027:\007\305c\"\341N\214\341)\363\304\321"
+	.ascii	"`\232\206\206\241eh\037\272\207\236\241\2774\017}\245c\350\037"
+	.ascii	":K\353\320U\232Koi\033\351\236\336\272\206\236\322a\232Jci--"
+	.ascii	"\245q\350\033z\207\266\322]:\307Mj/\364\354\246\026\224\315\016"
+	.ascii	"=rvR=P\224cR7g(\237\017d\334\225Ig4\3012\253[.\323? \304\320"
+	.ascii	"Rm\334\251\225\335IQj\257\264HJ7U\206\372\311J\032K>\030\202"
+	.ascii	"\317\260\314\352\362\224\264*\215\261\226\337\322\032I\260\314"
+	.ascii	"\352\226B\360Y\016\355\205\356\241zSOR/9R\261\r3\366\016\242"
+	.ascii	"\226\366ps\347|\244w\260\314\352\226\250\034t\306u\263\001\306"
+	.ascii	"\336a`\251\030,\263\272\245\366J\337\244uL$\332\336A\244\240"
+	.ascii	"K,\263:8J,\263\272\345N\251\214\244p`\3207\227n\003\325\336`"
+	.ascii	"<R;XfuK\355\225Z\335\2714\r\313\254.M{\245AR\2621-\307\275\267"
+	.ascii	"\366J\201\240yc\\\224l\210`:+T\256 \265R\034f\233\226\326B\365"
+	.ascii	"\366\246\275\322\2534\313,=b\231\r\201yre\254D\276\006f\251\037"
+	.ascii	">E&"
+	.string	"xb8_\003\256\264O\312\307,\242|sL\367<\345#\025GK\033\rl\340I\363\334Q\231pa\221\263\304sGe\263\326%O\336\323;&\0360!G\344H\351\342z\253\223*\357\222>\036\302\350\337dJ'\305\253\3323\305\314\234\247x\277\210\021\227\356B\301\273\323\203s\032'\225\243\217YR0\344\034\305\220\321\363\202\243\326Ys\206\b\0344\217\f\255\013\024\234\357\001\2136\203dZ\251z\222\262\271\311\264MJ\346J\233\264.]\343\2055\266\026\264g\354\211\313\371O\327\244jl\330PZ\341\234\336\251u9\270\350p\276\007/\375\247hn2M\343AL\311\r\234\217'\265\373\257\342!k\350\360\301\371O\355\236\236\321\332Vx\340lfo\245\231\202\363=X\3512)\031,6\245f\013\347{\200\241\337!O\277\003\236\2308Qv$q~\2074s)\230\233L\303\244gUi\230\324,Er"
+	.ascii	"\2600\3511"
+	.string	"\375r\355\272\212v\025\336\037e\322M\202\321\263\203f\267\024N\316\321K\032\227\312\335d\372\345\351\227\024-U\033\222\242\260\267\020?\307\364K\n%\235\322\201\362JO]\206\244$\240+2\037R:wI\337n2\205K\271\\I\267\214i\260\344JO\335\022.\255\222Z\331@e\325"
+	.ascii	"\2718J\375\245\210\\\031\232\337\001\214\376\323-\251"
+	.string	"\226\031oJ\332`I\263\370\270\272\354\344p~\207,\032\313\257\r4\030dp~\2076\375\233\374\2344y<\263:\035Qp~\2075\035\253\023\013`\0135B\205\0268tZ:\337\364A\251\bBi\002c\272T\\]\f\211\350\233>$\265\254\020\005QE\260B\004\232\224\332!\t\355z\242e\205(\212ZV\210\202(\030\f\201I\310\026[#\2105\b\345\244$dA\024\215P .89A\t\205Ca\332\376\326\023X#\352bXlj\207\302t\t\270:\345(\242\322\323\372\204\232(A\204\243#\023%\210\320\262B\024F-+D!d\201'\204\206\305(\246\234\n1\261K\302!\t\241\020&JX0\016E\001\213\305\020\236\326\326\030\245\342g\3040\024E<\222`m\201A\242\004\202,\021\203\r\036|h\213@\342\207\226\025\242\b\262D\013\202l\t\024\036\301\n\242\205+\261\305U\2702\351\003 "
+	.string	"\035\004"
+	.string	"\204\027ik\302\311\tJHTa\211(\002P\3533\376\206\305(&\264]\231\212\300v\250\375\211\370`}b[\342p(\302\320\022\211\022!\030\201\236\240T\250B\027\303 \206\266e\022\262B\026\370\264\2460\256NJQJD\306\037\211a1\212\211\302\023\224\321l\205\277'\323\370k\261\006[c:\302\b*\202N\303\337\023\252\302\305*\374=\241E`\013\263\310\202u\002*\001\031\177Ao\372\200AqurbM\f\227\330%_\313\nQ\264\254\220=\022\232\b\002\327\"ZlKP\022B\231"
+	.string	"\266\300\022A\340\232bX\214:\221AhB\350M\037\330\366\305Z\\\235\202B`\003\330\366\305j\324\n\227\260\361\247\264\2460A\t\310\302\311\tH\202m_\254\024\330\366\305\232[\343\217%\252XZK\254\304\250\025?\024%\250"
+	.string	"Z\225\204\300\326(du\373\203"
+	.string	"\212,dK\020\032\225P\226h4\215?\022\"P"
+	.string	"\221\020\201BE\225D\260\346\233>\030\241Xd0\376F\b\026\025\327\326\b|B\215\306\265\030\f\002\323\265\005\320I\005\024\361IC\375Z\254A#\024\013m\374\255Jl\213\265\204\021\212\005\220\021\212\205\272\022\243Z#\024\213\324\b\305\302\\\235\200J\306\223hX\\/0,F1i\022%B(\241\202\013`\n\022%BX\213P-\260\270\022\237\326\026\250}\323\007(\342\323oX\214bRR\002\2020\026\327\026l1\250\301\372K\341\301\b\017\002"
+	.string	"E|2\022\016\331\026\312ih\\\213>\343\317\302\372\203\">\001\265NP\3065\205p\310B\021\237*\254\277\337\220\220\211u\n\341'tB\003\036\260\266\300\024\303b\024\023PT\020\270\246"
+	.ascii	"\266\300\240Z4.\375\232\230\330\246\337\022\321)h\211\350\364"
+	.ascii	";\241\311\004\021\0374U0\022\207\305\022\3055\310\266`K@\021"
+	.ascii	"\237\210\332\037\023p\305\220M\231\200+\330\366\005\003Z!\n("
+	.ascii	"\342\223\320\372\033Z"
+	.string	"\213@\027\301\"\260\001C\355\233>\030\233Z\340\323\3235\376\210KF/\330b\013\034\241\025\256ODE\251\021\310\004\245\241\023\211 \2605\246\030.\261KB\303%v\th\270\304.\021\265H\207\305(&_k\202\0218\002\220\361\027\324\276\351\303\217CTS\353\004\\\233R\343\317\304\260\030\305T\001\325\300\326i-!\264*\t\201l\0218\001\241\340*db\235\200\2511h\305\220S\353\004\005\\\362E\025\207\255\221mJ\233\214kq\351D\205,\360\304jd\207B\025H8d\215PKhk\374\265XK\264XK\250p\001,Zp\022:j\337\364aX\214b\002a,\016\215\302\325\250\201\002\324oX\214b2\032\032\n\021\302HD\320\221\210\013C\"\204Q%\204DFJl\013l\215\024\204QA\243\023\032\260\266\300\024\253\023\361\t\250BI\tH\264\032%0\\1,F1\251kp8B;,\226"
+	.string	"\001#\260\001\303b\024S\006&!\313t\302\t\bUb5BYh\177/\326\240\220\375\031\225\330'\2400*\370\3030,F1\t\231`\004\216`d_\204\340b\350\264T\\[\f\213Z\341\220U\3721\001\215\277\026\310\242\305\221\361WB\220%\006\235\320\364s\001\214\032:\241\351WtBS\223R;\024\266&\256\361\267\024d\211h\t\027\305-q\203,\321\244\200\001\350\tJE\220%\016\t\331\021\332\020\202,\261\250UZ\227\226\214\326_\353\304\266?\244\013)\\"
+	.string	"\243DX[`q(\310\364+j\177H\353\023\333\372\242\200Nk\020\310\202\221\013`\324\217\350\204\246\237\b\247_\36174tT\374\255\304\250\266\b\210I\b\004\376\230\240X\254A\fB\026\310D\301\370\364s\372\265\277aQ\t\230A\310\002\231\212(\024\207\305\342\212A\351\247\3643\262"
+	.string	"VX\211Q\355OD\205\023\232~B\366\204&\013\033\204,\360\304j\\S\024W&&\266\270\302\305\320\311)\004\t~\253\021\252\302\013\240\323Z\374\271"
+	.string	"F\375,\234B\026\310\344[\225\204\300\026A`P\250\205\"\266P\303_q\330\016\237*\240\255\020j\250\364srZ\225~\277a\013\005\304\360k\205k\213\324\032\207C\026\277\245%]\0046)\345\365\tH\302\352\304.\r\213D\240'b\361'd\237\202\202\353J4\376Z\341\372\324\032\2412\020\004\036\241A\2268\264\032\201kQI\310\256NA\226\002\321\370[\331\026X\374\275"
+	.string	">\375\226\226(\264\354\023\353\364[M`\211\306\337\322\322\320\322\317\370[Z*\032\022_\254\277\265E\021J\351\267Dt\372\t\243\202\025\326\340\360\351\267*\001\213?\"\343o}b[!T\212 K\fZ\021\304QJ\302\025J\003k\321D\220%\006\031Y'\226\005\260U\021d\211\030\330\022\214PC\266\305Z$\032QhRj\207$\370\214\202DXh\203\240~C\252\b\241\326\310\276"
+	.string	"\252\306\237\2201]\203l\2615\242+1\252\315F\264m\215Ev\311g\374\031\025\333\022\204&\036p\2415\376V&`\253\242\00205\246+\023\2605\372Z!\324\220\204\323*,\256&"
+	.string	"\tY`\023\211\247\342\332\006\213\212m\tE\255\361\247\205&\242\234\210\304\020.\270"
+	.string	"Z\340\251\270\266D\242\340\352\304\002(d"
+	.string	"\321\022Q\204\240\021\002\026\226\210\r\210j\331\026\300\342\t\266\025\002/\264\306\341p\001KKB\253\261\270\266\020\2420\201%\252XZ2*\032\266\300\342\352\264*)\205`!X\004\272(\016M\004\327u\351\250}\323\007\244\245\007`\343\257\210\370"
+	.string	"\314>"
+	.string	"\007\037\200[\341\312*\261KK\353\220D\220%\016\tY\340\tU\310\002O"
+	.ascii	"\t\207l\313\032\205\300\"\005\013C\266\005\246\250\260\006\207"
+	.ascii	"#\264\305\225\370\202\001\255\023\273B8<\201-\016\233\216\242"
+	.ascii	"ZVi\350\264N\340\005\360\t\250\205\020E+d\207%P\300h\r\016G "
+	.ascii	"!d\215\332\237Q\002\353\023\333j\243\004\332\020\202k\253\264"
+	.ascii	"\266k\t\243\004\200m\013d\224@\024\320i-\261>\261+\212\332\237"
+	.ascii	"\210\017Z!\233"
+	.ascii	"\032\327\265\310\264\226`\225\326\022\021\254-0ETqm1TZSP\210"
+	.ascii	":Q\341\251\270\266%\214\202N\303&\343ZlZq\301\005\320\002MF`"
+	.ascii	"QI\250\035\n\265\253\021\305\260\270\236pa\r\016GX\225\200)\234"
+	.ascii	"\326\026\253\223\320\022Q\004\"TP\310\272P}+1j\305\320Sqm\331"
+	.ascii	"\242\245\245a\013EB\t\250\205,\360\204\022\020U\002\246-\373"
+	.ascii	"\304\212P\034\026\213\fP\002\006-\021EP\002\236\302!\333*\255"
+	.ascii	"\305\342\220\204\323\360he\022\002S\250F#\220\350b(B+\\\225\212"
+	.ascii	"k\tBv\204 \220\220\005\236\030\026\243N\b\331\021\202AB\026x"
+	.ascii	"B\310"
+	.string	"\216\020,\n!b\211(\202Qk\302\r\321\022\201\326\026\330\032\317\020m\tG\355\233>,\201\020\016\237\236\206J\020|H\\\213 \332\341\260\b\002HD\0246\376X\fy\300\002\207`\201E\260\300!\200X\004\020\207x\201E\274\300!\242p\020\b\245\001v\001H\301\365\004\326\t\310\266\254\020\305\022Q\204\265\005\333\002[\260\305\265\204\221\002\013+1j\005\223\220U*\036\035\255O\354\212 pm\002\2320\034\212\200dd_\204\300\004\305b-!d\201'\210\326\026l\253Dam\201\255\n#\373\"\204\342*d\201\305\025\303\242\022\320Bqm\235X\023AB\266\375\005 D+d\241\364\013\340\b\352\220\370\202\001k\213\"\024\211%\242\b\302\250 \321\032\034\216@aub\022\206\200\201}\200\323\260\330\n\207$\232\224\204P@'\"\247\341p\001\277\023\305j\204*j\177 \264B\026*}\001tZS\270"
+	.ascii	"Z \270\266\300\"\323\332\n\331\n\302!\333\002O`\213\300U\310"
+	.ascii	"\212\320\032\241\212M\255Q+\204\032>\205\260\266@\243p%>\rI\264"
+	.ascii	"H-\373\304\212\320\256\306\245%\b\254Nm;,6\255X\203\303\247\""
+	.ascii	"\013\324\320\256\277\225\030\265B8d\227\226\216\036\"\004\t\n"
+	.ascii	"$@\302\t\255\364\241e\205\354/\310\022A\264ML\254\323\022\b!"
+	.ascii	"\013|\002\241T4\202\370\260\241\025\262Cb\273\252\b\256-\320"
+	.ascii	"iH,\256\255\020\305\323\260hbiICq\330*\001M4\265\303\341\223"
+	.ascii	"\212\245\245\241\377>+\367]!\262\243C\354\013g_\025_\322\311"
+	.ascii	"1\313\033\234\361\224\310\361\302\206\263\217\212\317\215\310"
+	.ascii	"\021\313\227\323\271Rk\271d\tg\3122\265\001\245\217\2206\365"
+	.ascii	"L\250K\233-wH\025\311\220:RT>55\037\333+L\3550\252\275\301\326"
+	.ascii	"<\344u\345\360\360\373\240\334\307\346\213\202\275\224\355\275"
+	.ascii	"\361E\361\255\371p\274\2512w\226\365\301\261E\004\225\376}O\210"
+	.ascii	"\344\331`#\203\263\376\203\001-P\226\\9\351\322\200\b\036\035"
+	.ascii	"Mz\270\t#\273\302\331\267\344\252Y\003e\310\324\020%bIz\234s"
+	.ascii	"Z\244\210\2405\301`w\370,\217Z\331M\316\236?gj\r\225k\017\235"
+	.ascii	">H\314\271!\245\036\256.GpWz\234\022\344\206\021\337\024Q\224"
+	.ascii	"?mRfv\31141\236\024\031\223\323\344\365)S\223D[\304\262\326\020"
+	.ascii	"\361e\r\215\001\261c3d.U2\225\266'De\323C\222\230\001"
+	.string	"#3\263\344\031X\306T\t\342\223\201\302p\303Bf\f\0079\223\353\262\223\374\233O\254\355\270\367.\n\202s\207\313\025\234\037\342\017\322B\227\023\033\276\037[i\345\305\007\366\206\005\317\256\006\316^^\276\036x|Z6\220\360\031R\326\230\023\346\353\276\036Bx\252\330\261\315qq\371\272\360\356\n\223\322\223z]5\021\343\343B\346\225g\307}]oCW\204\360\211\303\331\247\343oX\326\200\365\b\321\305\207\303\207Cm\202\264\264a\246\203\254\f\034$8?\204\226o\313\267\245\316\335})\333xy\331\341\374\020\3337\3037\303\227\025\002\016N\216\264\255\262+*\237\215\373\262\204|\200\271\311\301\331\207U\200*2kp\366]\375\315\016\251\003\013g_\215!#dl:p\366\321\370[\372#\213\037<\252\f\354\226\006\212\035\035_\225\257\312\027\210z\250\004\244Q\226\3473\302$\b\322(\007R\2149\204TUq"
+	.string	"\203\025"
+	.string	"@hH \022Ke\305\327\003\024"
+	.string	"\t[\270x\222v\236nZ\t\315\324\b\004\020!"
+	.string	"\bH\320A\001\327\306\330>\233\0018;\335\202\221\021b\252\030\345THQT\247\276\271\204\265\3374\364\020D\\\013\004\374\353\2671\231\263\255@\334"
+	.string	"\236\262t\nh\3532:\264\n\242\331\273\274\214\001\\Z[Dq\023\331\322\221y@\303{\315\210@\310&\237\024\001*\233\213\237\260\354z\322F\314cL\234\322\351o\006\360\317\216\363\346#\024\253\343\023\333\345\341\004_\261\307X\f\335Cc\272H\344\304\367\177\364\233\313\016\203\2703%\257\220\200\332ZZ\331\303^\345\n\276\005\344\362\377\016\321kT\n\332\300\351\232\276\260\273g\234\214\365&\0204e\032A\352\244\022\237.\272\222\307\202\251x\315\311\2546\204\345\375\004\037d\013)[\226\016|G\232\234\252\342\214\332C\357\263p\272\305\340\250e\344\361\377-\236RT\202\372a\036\221\374\310;k\034@\371[b\305\264\210^\b\006\rI\325\360\315\252\330zh\213\221\210\314\"\f\227/+\263AO\005\365"
+	.string	"\027\250\267\f\250\307\232\030x\310\314\007\005f\274\343\340\t\360/\026\177E\247\006f\255\234\354]\013\222I)G\252]\3620\nXq\205\236OG\331,j\024\027]>U\033\027\031F\260\rr\0171\330\332Tvt\271cs7\341\363ob\262\021:\320\356\274\260\333O\031C\261}d\365\334\005\355\254/\316]\003B\371\367\002\355);D\275\222\220\322:\035\206`\240#xl\253\364|\326\310\031j\037\341\021\025\365\326\230\264S&@@\f3\t\223\007\3649\257\221qP3\030\254'\232\223U\242\330I\266\354~\353:b\301\207d\020S\374\211d!r\276\017\271\372\205\027\272\024\247\250\222\275\332\241\022| \3010\255T"
+	.ascii	"k\035["
+	.string	"\302\177\t\340aw.\235\033o_ML\375@4m\223\360\323r\330`mK\333\212\252\312\302\256\277\025\215\202V\233\320\177\262bL\301\b8\332\245\217\365]\006\300\2049\241?ws\013\207\\\217\t\256\217\321\213\362\016\325\207(\366f\n\264g2\ba\376\332\253$\026#\216\227\243\362\3073p\027\361\262\001\312\201\300\036\004B\032\224\227\3158tQ\205Q\233\303\347\2762\334\006\020\204\356\nxG\215\215\256\203\031\216\037k\367U\020\313\336\362XxX!\032e\340\267N\213TvX\314\246\034Q\343\320\272\001\300e\363\027\314\256\023\246/9\016\226/<\006\0255J\302\3753\032\f\303\301@2U_\305\344\201\307i\244\210\312\031\025\204\"]\247C\263L}\225\177\302E\215\367n\220B\322hH\307\201Y<\223\242\032Q!Bc\313\257$L\231\020+X\034\342\002\020\350\026\340\2179o\306\267Y\037n)!\230"
+	.string	"\256\316\271>\"\213\340J\344y\344)\241<}*\374\344\273\315\337\216#3m\331\333m)\304&\247t\237\223#\016\331\235\360\200\316-\232\364m\3026\306w\330b\262\200\213\275\f\325\322\326p7\300\203\261\213AV\260\00537\2660\251\367T\361\265\320\313x}\330%B\251\272gU"
+	.ascii	"U\276#Y{!L\230#\234\353\302^!\346\tz2\255L\233(\030^\353\300"
+	.ascii	"\023{-\337\001f\306\241:\235a\307\026\361\220\226\3261\270\364"
+	.string	"\237\334\242)\230.\241\354\t\270\312\017\341\244I#\361\204\327\270M\035\216\311\234\237\215S\375\216\307\214\373\346\242\206\361\226\2041\357\322\203\002%QT\335\036<\336\321\250\023\314\355\036[q.\177\323=\273\343\360\335\f\207\003]4k\216\363Q\006\346}\256\327A\262\214\321,\313\350\335\222\202h\315'R]\276\341.\310s\354\020`\320i\243\024^\2169\217\305\272\365\027\f\003\330\r8\305M_9\347\272\244T\b};I\270D\230\322{\356sJ\376G\033P\022\344\263\274\300I\370$\027\233g?3m1\345\r\317\b\333\261\274\334e,\272\267\372B\322IY\240o\347\244\251"
+	.string	"\375\312\371\351\016i\212\2643\027\315\007\016%\377M\246W\244\254\262`p\374\201{\031+\351\365\360\361s.\227\201\241\0013\345\213\277\303\323\257\270)\237\320\3702\332aX\362\2408J\016\275\302\376ko\265O\343\364\246\035\337&\365n\317\320/\347w\331\023E=No\332\361m\262l\223\035\335)\367\2576\340\004dg\332\364\227.\037\242m\256\320\251\f\200<U\327\003Ss\202\205 K\017\177\325\313\347\f\344\001m\001\306D\301m\\\251\207A\275y"
+	.ascii	"\275;\224\320|-\320\016\221\316\264\260\30231\357\254\0276\377"
+	.ascii	"&d\366[\030\020\003\312\263\351\204\016#\231[]\346\277\303\334"
+	.ascii	"\317\377\326=\231\300\266\241\t\344\t;\242\311\320\367{\240\177"
+	.ascii	"\326r^\234P8U\365\336\317\341?\327v\004D\031Y\317\221\352\337"
+	.ascii	"<\006_\276\323s\265\334\316\245\300r\f\224P\363'\300\251\344"
+	.ascii	"c\364\214\313\343\355\240\f\211\326\033/3\210\332\177\243h\""
+	.ascii	"@\315o!\003\377\t\205\344m\346]\325`d``\247\335H\354\200\314"
+	.ascii	"j\231S\023\206\251E\272\335\024\263\231\231\355;\306I\373\241"
+	.ascii	"_\217\202\314n` \373\001\231jY\305N\275\027\275\t !\177\205\211"
+	.ascii	")\262\252\177b7"
+	.string	"3^\022\035u\006\356\2218\323S\272\ba\260\345\263%L\230\225\031\030%\202R\322\325'\215\266\033\301Ui\375\320\304\f\2018\350\317\024\037\331\320\250\005\270\321\361\021\371\200{X\177\3671\302\204\007{\302\206P9\035\353\006\027\343m\314\207\bR\357\370E\352\206\245<*\204\304\267\332\007\020\204Y\3530\240D\330Q\002\036\205\3429\177\323u-S\240\210\021\024\324\003\0262\233\032\231#\213NL\007\3502\344\362\242\035\\f\005\005\251\362g\035A\320\205\263\017\252y\276\272\034\004\247F\2004\374.\367\255\032D\335\210\324\016\006\006F8_\231\241\353\267YG\365\305*\375r\222kM\312\214\204&\030\225\270.\240\353\215b\200N\237\360\"U\324\321\215SO\364\261\212\263\353[\272\267.\320n\252\246\324}Q\250\034\267\312\341w\005\366\361\245,\332^7T%\r>a\350\200W,\016T_\252\344\222\205\353\266\021"
+	.string	"\232\371\304\251o\366\265\361\026\001\315\322\002\216\334oa\352\377\252\241\257\202\374%h\025z\325\021\247\262\351 "
+	.string	"\024\373Mk\237\333\302k]\200\213(\376\0235\226\202\2712+\257\326sb\300"
+	.string	"\227\366(d"
+	.string	"\240\335\346\351\035\037:q|\202:\215:\243\365\223\307\032\257[Y \226\007\254ld\255\320\255\235\277\305MoWp\201\255\273\036\003\372g\035;$\366nH\305./\361\345H\273a<\001\346\202 \022\231\373f^\227|\005\225\020\210n\273\301\303cZu\202(\001\272\244\037\020\363\207K\372\310\305\240\201\301\273\212\024(\333\377\f\273\370\352\027\233\3504\216\031H\262\236\212\r\364\217\300I\356\001\376\374\320a\232xA\274\226KNd`\247\303\232\314\325\343\236\302d\262\317"
+	.string	"\204P\355}\330\220$wZw\3279^\250\363\353\240\333\016h\225\345\232\364\2629\ff\263\346\356\3203\251\023\024\n\322\020\305\252%e\2452\342'\305I\2768\022\315{\215z8\376\225v\233\255\230\003\301\362\347\316\352H\242\222d"
+	.string	"%\277/\264.U\242fxT\016\202\214\304\\\211\342\266\204D\372a\245\360\325\r6\f\233\257B\304\210A\003|\222\034\250;\230{\367o\324x\374\250\300(\226v\307\331S\215\241#\205V\303\037\373V\246\352[\330\201\004x\213z\r\324f\005\342)Q6\337m\020\264\032\243'\353\325ty\021\222@\261\210L\250\275/\267\332C\\\177\034?P\324G\207\234\bL\027\272\324\fj\304T\251Y\035\224\017\2305]K\276U#\255\217[`\347\351$\250\020\177\243.\2506\215\007\036\223\361<\213ok\377\372A|\302\253lr|\255[\363\370\263\347\271\2052:\224\253\314%~`\270&4\302L\257\3262UY\316\351\206X\237MeKRv\306\355\226\325\225\374\356\347@\0329xaS\365\031"
+	.string	"_\266\205\2004u\341d\307g\234>\264/\327?.\310\353+D\034\301\372f\3461]TD\003\361\031\361\243hS\346\340]\321\265j\361\032)pA9\017\2424h\256\206i)\217t\f\214\027\021U(\220\317\bn@\377\002\340S\360/yvA\021\265\354N\204h\266\242\256x\002\272\305\364\334\300\333\347\343\323[7\267\272\334\213\221h\323\205pa\022X\313l|\016\304KC\242@%\037c\323\337\262\254\333\231<s3n\307\315-Z\031\n\226\202G\240l\203\007~\t\207\313\221o\342\007$_|\b\r\274\252\003\205V\203\206+5\350\342[\202\262/\224\223\313\233I\f!,{z\340w\353\365ei\002\231T\307d\315\352\346\026\007\035Q`m\233\025\335\305\321-\256\017T\002\214}\260\275O\351\304\307r"
+	.string	"L?$,\253\034-\022}\374\200\235\244i\323\311[%\312\244F\033\217\224\221\"\363\3355\300\fp8`\n\001\220\341\233j\t\005\034\021\2227\fP\r-\216J\317e2\3619\310\220\343\266-I\034!\225\270\221,\217\016sg\331\322\240\350.\222\214\024\336\n3\027\007\301\340\363\300\370y\373rI\220t\350\272\353Z\207\201r14jr\fA\007?\223\264\263\240 G\017.@\321\227\017\376 \027}GL\244)\370-\352\223X\301\352\001\251\2306\020\0172cr7\342\nm\233\334\237\336)\215.\300\336~&I\263\344n\361\262\272r\025\326\311UJjf\357\266\253\017Tnb\007*\214d\033\224\002+\2725j\316\316F\240\275\2003U\024\345\t\256\274\304\342\204\"\313C\030\236\232D\355F\364\260\350\222\261\035\227\326\21620\211\374Y\301\206\374\020\235\365s\345\221`\210\307\263\272\301k\304\216\034"
+	.ascii	"\231w'\211\031\300\016x\250\371L\270\311\242<@\fJ\221R\36615"
+	.ascii	"\030\377B\213\320\224\357\334\305\347\334\003\302k.\260\264j"
+	.ascii	"\027\037\233{\301\2314)\303y\213\3226\247\243Qc\310\222r/\361"
+	.ascii	"F\245\bW\374\275!\031r\177K\017\223\031\266h(\315\277\n\232\021"
+	.ascii	"GE?\203\203\200\306\332\006\244P\375n8\300\007~\305\357\317\202"
+	.ascii	"\332R\3047\367\316\244\220(\204\027\317\224\355`\004\004\001"
+	.ascii	"\364X\260I\345\263\304X\376;\306\216\212P\201\177H.;\262]\006"
+	.ascii	"\271\002\334\bz\234\031\234\214\313\375\362\332\034\364\351\243"
+	.ascii	"\322{\365\327\373*\371\224\277\335\213\376.\323\017J\303\366"
+	.ascii	"\367\031\200\333\303d\251\223\013OA\275\367\002\271\315\251Q"
+	.ascii	"\232\017&\032|\272\003\234\220\361Z\252\355\034V\016\3502\242"
+	.ascii	"C\206\023\365\306\b\f\177\243\360\243N\314\022~\201\237\334"
+	.string	"orW\260\301\207)7%\333P\2570\202\255D\247\363\340a\245\202\354\263\006 F\243\203\312\"k\244\331\203\345\316e\031\035\331\2347\334\313\210\2656x\205T*\020\364\212\304\227\356\361\251\\\315\313\345\037\377\373\220\362\225\227By*]\251\221\352\360\222b8+U\331\323=\306\225.e\307uO\346\227\226\343\235\211\243e\227m~.\024\362\002j\003\377\360#\226\025\202\326\002k\343\207\237x\265\352(^$6\034\005\220\035`\3628\244^\021\036W\317\263\264!U\376\214\204\252\177|\001"
+	.ascii	"7\017\234\374\275\307\021i?\226\r\3471\037\211/\315\027*}W\031"
+	.ascii	"\fU\346\307_3\035\343\245\026z\270\317\264\247\001~3\317\317"
+	.ascii	";\017\"\225\027\337\363\234\200\006\306\271g\33237&\235\343I"
+	.ascii	"k\314l_\263\366X6\23162D\204\312x\370\037{1\006\272<\256|\016"
+	.ascii	"jL\234Xe\310cP\tiQ\370u\235a\326sN\313\033K\\\321\305(\225q\341"
+	.ascii	"\360\371\356\313\264\324w\031O\346\0167"
+	.string	"\r)\022\3347@\006\031\226\\\307X\002`\277\325\377\350\"\316\365\337\204\375\024\204\261rD\030\3751\320N\313\027\t\334\344\177\237-S\361\311\231)\301\263q\264\220\0063\232d)\036\302\304\345{\237\307\277\375xiR\326\367\334\254002\367tn\026\360d\007\227n\306\253s^>\020\342\201\017\332\211<\030h\262|\302\355\3444\326\334\360\334\007\345f\374\237\217\217\350s\333\tmC\210U\033~\t\3279\352\356k\356\233\353'67\224*\322\2410\363m^?\310?c\003\356,\246\203Z\3714z`\032I-\020o\220\223NK9\034}\200p\026,\201\003BSkXU\np\326i\231~\242\364\256z\007\341\354Z\t\355<\300k\334\213\261\320\334H\236-\341\354\304l\375\246@\364\031{\305J\263\231<\237)\336H\234,)C]\276\r\274\347\231\205\350%\342\351\367\261\360\2225\352\234g\032-\212T"
+	.string	"\206\013[s\330\333Nhvf\364\177\332|\006\220&\231\006\004\367\363\270\307\r\220a\374\363c\266\375\020\355y\343\177\225\356\237\243\3225\005\351\001\277\341\211\314\364\fs\220\ra\367L\243\374\322\250L@\f\320\253\207\322\212\342\316\032 \243\263qx!Z M\340\364\250p\266\362)\026\264=\224wCE\355\034\275\2113\034_E\344\260_\224\253 \240|\003\376\304\363i\007\242\362H\376T\273\"0\373\266]<R\237c\235`\355\200\246N\262\035f\363K\310>\323\032\321J`f%\221\266\342[L\302\221\226\030\347\372\365\260\234\200\215\200\373\362RE04(%j\232 \306\303\265Q"
+	.ascii	"\375\334 vJ\230t\031\264\210\217\"J\001\313\325\t\025\312r\255"
+	.ascii	"2\371\231\005\324\302"
+	.string	"\025\315F\227\230\276\\\316s\223\313g\241\031\365\025\2746\314\030\276\013\303I\247\201\227\376R\201\347\202\263t/s\220\313\013@1\353\327\251G6kP\213\321y\026\341\2009\266\033\303\210\311'\303\324V\240F\r+`r\002\232jyD0\256\020m\021vdTAx\302\236AR\273\343D\032\211`\221\332\"\030\270o\270u\306h\266\226ba0\326w\264%u\331\300\356\027\225\033\337#[\214\211>q\373\007\315\245K*\262\354\027Y\254/\337\0279\314\265B9AZ\262\004acRBMRp\231\034\376v\272\036]\310\216\f\024\r\325\333\322\255\306\222\277\331|\254&\270B\266\253\232xjL\307\bd\025u\227\203\364\024z5\301o.#\357\204\334\364y\2570\344\3105\237\003\215_)\227\f\234#d\206BzGtbD\217\032_\375\241l\275W\306\236\bw%\204\320\266\215TJ\375\355H\b\370."
+	.ascii	"\300\346\233\273S\266\r\237\251<\222>'\360S\""
+	.string	"\257\226\212\207QUi&\343\3719c\301[\325\342'i2\244\272\203V?*\035\361\215\333A\204\2251H3\264%\206\033\b+\273\301Ha\271\225\227M\250\354\260\347!\331\3067\177!D\346m\032\300\027\330\366fr\341i\2721\256\264\324\2467\332\206\220\322\267\206Z\355z\037\303\234\230\366zt\314\005,S\211\231\343\230\312\035\017\334\221\024\313\"\007\347\217\214\240\312@\344\350\216\205\001\302\253GmyX\302\205\320`\002\241PY\304\350;\240\226\240t%w\242\023\250\372\342\243\231d\312\251?\022\211w\261\264\030\271\350\3061S-\t\227\257\f\375M\201\r\271\342\337\341\242\227\342h\255\006\236\234\031\b\200\246u\037\234J\324\027\271\317\370\370\016\307\020\262\253It\023PV\333\017Km\265\253\265\220\022|7\0168@\233yL\300\230et#3\235\203\331\341\342_\007p\037\350\233zXjE\223\250\244\t\250!"
+	.ascii	"k\245\004I\2577\0271\221\346zMU\343\305wax?G\354\377\345\227"
+	.ascii	"'\335\266\024\310#\244\336\021\374|L\2765\376z\322\334\305\260"
+	.ascii	"\351\214\362\006\215\037i\260yr\362\0041Wh\225\2561\301\203U"
+	.ascii	";\347\365\027\212\257@\034/\331-\211\277\256\252K\251\035\223"
+	.ascii	"p\007\241\224\255a\315\367\231s\215!jt\216b);\240|\030Mr\017"
+	.ascii	"\235>\322\306\333\361q\255\357;\275\377\234\265}\177\354\373"
+	.ascii	"\005Qf8\223\033g\214\334{\210\303\263\267;\226s\230\363k7vl\327"
+	.ascii	"l\273\037e\355Sc\367\315\366\226^G>\377b\376\030\267\351\033"
+	.ascii	"\023\006\r\222\004\016\244\355\241\255z\246\375\215\207Y\261"
+	.ascii	"\315]\275\377]\364\266q\261\302W\350\373\214\303g\216V\036\353"
+	.ascii	"\f\357\201\374{\366o\325xH'N^\3679\b\276eho4\334@\263\255\313"
+	.ascii	"\213\204\375\313'\233\334\016\261\342y\033\033\367\317\217\353"
+	.ascii	"\033\270%\241\001\220L\377\001"
+	.text
+	.section	.gnu.lto_.symtab.7bd082eba082b1a0,"e",@progbits
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\004"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\004"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\004"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\004"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\004"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\004"
+	.string	""
+	.string	"pidRuntime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\004"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\004"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\004"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\004"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\004"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\004"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\004"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\004"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\004"
+	.string	""
+	.string	"filterChainAddStage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005"
+	.string	""
+	.string	"filterChainInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\005"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\005"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\005"
+	.string	""
+	.string	"interpolatedSpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\005"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7bd082eba082b1a0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-f"
+	.string	"no-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
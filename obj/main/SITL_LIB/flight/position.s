@@ -0,0 +1,742 @@
+	.file	"position.c"
+	.section	.gnu.lto_.profile.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"m\005"
+	.string	"$\007\t\001"
+	.string	"\021"
+	.string	"\201\277\312\340\b\n\002"
+	.string	"\001\002\002\002\003\001\352\263\360\321\b\003\240\342\234\212\n\004\261\312\232\202\r>\002\004\005\002\005\002"
+	.string	"\002\006\002\007\002\007\002\001\002\006\b\002\b"
+	.string	"\005\002\t\005\002\007\002\n\n\005\n\013\f\r\016\017\022\350\300\306\254\005\002\023\354\206\342\366\006\002\024\347\273\234\355\f\002\025\355\314\246\334\007\026\332\322\311\233\n\027\240\342\234\212\n"
+	.string	"\031"
+	.string	"P\204\311#\f\301\204\201\273\235\306HO\004\334\201\306R\"$\346\260(\033v\206\276\370\230I\260U"
+	.string	"C\225\001\371r\024\257"
+	.ascii	"\224P\303\314[\203|\301x\271\334\0130\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375 EU\001"
+	.string	"\3009"
+	.string	"\005"
+	.string	"\002"
+	.string	"\001\003\002\001\001"
+	.string	""
+	.string	"\004\022"
+	.string	"\003\023"
+	.string	"\003\024"
+	.string	"\003"
+	.string	"\007"
+	.string	"-\031"
+	.string	"\001\226\0331{\270,\f0\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"U\004"
+	.string	"\002\007\027\"\200K\322\001\372b\306\201\330j\bA2N\227JS\bK\220\214-\212g4\t\301\204\253Cmo\271S\037\f?\277\036\273\013\037\250\037\245\207\004s\261\324\204o\rn\"\025\312\232\017\245\372\007\366\243\304\237p\367\202s>l[\3003,\323Va\277\200U\2659\bi\233x\347B\004\021"
+	.string	""
+	.ascii	")\034%\tf\034p\214J\304\204\351I\300\213\364\303.\256\"C \270"
+	.ascii	"@\002\007\250K\n\027{\223CW\346\344\322\264\006\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375 \324\225\003"
+	.string	"R\305\021\034\240'\351\377\243\330w\277\212Wu%\026<\252\252*\226\357?\024\366;M\310nR\246?\341\007/\250\372\224X(-\272\273;P3\3102\346,\016\b\256(\345\177'\204\206\322\215u\314:\370uj\200\032\";9\021\021"
+	.string	"@\004\334{3Hx\307p\266"
+	.ascii	"t^Q8\357e\023T\261\201v@\230T\321R\202X\024\303\233&\234\331"
+	.ascii	"\034\f\260"
+	.text
+	.section	.gnu.lto_.pureconst.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\004\230\004\022\204\004\023\204\004\024\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375 \250\265\002"
+	.string	"\342D\f\023\300%\303\030\377\377\377\377\356\222\275w\263C\270\033\2212\005_\203N\363\260:\323\2632SSdJ&\326\001\267\312\264\254\004\323\300jL\307\204\342 \016"
+	.ascii	"_\221\240\304\341BtE\207\022\214\0136\024\005\253\002\2712\326"
+	.ascii	"\242\312\326$\340\2365@h\033h\003"
+	.text
+	.section	.gnu.lto_.lto.a70c00116a751975,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_positionConfig_Registry.39.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375 \240\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\266\377\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\007us\336\006uq"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\270 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/position.c"
+	.string	"\004"
+	.string	")\242\302\254\b\242.\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_pgResetTemplate_positionConfig.41.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_calculateEstimatedVario.44.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375`\320\0035\033"
+	.string	"\3463\261I\260\326M:\266\343\\\347\367\276\313\004\236\273\3510\251k.K\341\b\345;q\344\006\2677\025\352\fq\351\321\007\0075\366\207I\2240\371\350\\\210\347?\245_\303\r\361j\225\016\234\0138\332\346\303\337\254l\315nB\b\221;\245\231"
+	.string	"\215"
+	.string	"\240"
+	.string	"\300\217S\234\241\375\251\247\253\027\317q)\033f\016\307\341]\242\003\306\301\206]\234\366\220\177\343Q\206\001w7F!\232\032@\355(o\004\215RB\241Uk\035p\321\t\350\332\350\020\306\252\221\022\b\253Z\241\n\330"
+	.string	"\275\3509\355\323x\215\241\377vv\325\232\342\207U\255\265\200\t\320\2137\241m_\306g\f\231h\376X\214\030\225|G7\240\324Zi\261\313\214\027\347a\306\213\273\342D\237D\376\243\256\363t\325C\"\205\304\373$\027\324Z=}H$\356\275\355"
+	.ascii	"\266/\330!\202\341\276t\352\315\240\347\356\206[\245\326W\266"
+	.ascii	"s_6\365N\365\252\235\317d\241\333\274\3576^\374\222\274)\030"
+	.ascii	"IE3h\377zsU\330\017\353.\331\236\316\3019\324mSs\340=\273\215"
+	.ascii	"\237\346"
+	.string	"\277_\366\232\236!\247e\350t\f\235\206\241\323/t\332\205\234\216\221\323-\3444\013\235^\241\323*t\032F\247_t\332ENS\3274I\247G:-\322\351\220N/9=\311\351\353\320$D\232\030I\222\365\250UDPJ\305\022y\2648\324\037\273\262\262\254\036\210\022X\325V\020\f*\201\255\312k]\013\333\227NA.\304U\032Le\252\361\342k]It]\373\255R\213\\\272?\232b\t\0072\201\326jt\300\367\361\037\024|\246\213\256P\363k\343EraOU0h\260\314\327w\243\314\332\266\f\363\276\232}\324\251\024\027\277(Z\037\226g\335Rle\326\263|\002\013r_\215\263\215\355\245\036\306`\262r\261\002\350D\266<D\244\251(&\306\235\355\263\312!\342\206;\356K 4+\356x\244\324*\252\272\023\022\265V\0130\252\265Hg7\356\331\021\352\321\325p\264\237\034\016\227\343\231\371\330 "
+	.string	"\341t\025|l\033H\033\356\346\340\202\250\363a\220\013\252Y \315\263\363\223\273\351nB9 \232\256'\303\315\007\003\355\347V\303\321x\202\204h;5\316\001\331\202h\272\\.\210\006\373\025=\374.\345\354M\321\366\334\2629\033\345\241V\226my0\210\263,\373)\361\273\321\006g[\200;\260f\326f\237u4ef\306\254\375 \302x\337\314\002"
+	.string	"\326\3002Z\236c\266\310u\370\230\300\254\312\306,)\244<\361\262+\013\263\262,\227u\325k\235/K\223U6\365\\\353\262\263\255\322\251&D\2501$\343\220b\n\252\221@Dd\244\205I\007`\242Q\316\310\016\021\020\262\2422\311\260\277\001_\030@\206\222p4\326>\313\356\n\371\253\375M\323V\350T\272\200\373\\\234\260c\326)\204\206\013\346\207\0177h'\342\214#6\223\030\311I\016.\205\320\013\no\231\263\270\365\270\273\257\347+<\204\302\203@;ux\266\304\224X\323=\276q\214\034\321\266\300\262\221\224^\340\366\305`+c\031\334K`\033\306\256)r\016\256\036\0211&\022\253_x\230`\001\277\f\027"
+	.ascii	"\376\336\032Q\372\262_\032"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.46.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375`\362\017\035L"
+	.string	":}\034\034@0\242N\007\033\254\324\031\002\021T\305\301O\376\001H\024I\177\215:\225\340\350iAr\237\355\311\t\022\037x\357\003\324;B(\202EdP\204\317M\267\303\214"
+	.string	""
+	.string	""
+	.string	"fh\210\bm\262\273%\231d\266\001\220\001\255\001I\255]k\017\243\265\322}\213\3779\240{q0N\350\263V\026\316x\321\326^0\320\276\3048\266\322\030$\234\022\343\375R\343\251V\024\253Q\013\247\304q\334\302\273x \354\2026\3368\314+S\257\211q\034\217x\275-\332\\\364\374T\263\306P\024\300\245\321\343\340'\005g\250\227\245\302k \001\354\326\033O4k\374\303"
+	.string	"\234\035=Bql\r\340\255n\360\372\326\332\365|\017v\276\034\032\031\307K\324\204\211c\353"
+	.string	"-\340\365\366\351J\256\267FGr\275\325\260\326{\334:\027\373\037\236\fH(\216\343\256\227s\330\267\264"
+	.ascii	"da]YUQ=\247\244\234QPONMLKJIHGFEM&\321R\231D\276G\2675\376\206"
+	.ascii	"\265\243\371\326\325\265\256i6\200\331\263\346\302\215E\350W"
+	.ascii	"\204\203\333"
+	.string	"\n\214W\201\371\262\251\236^\246\214\007t\020z\363\303\265>\343RQ\226\343wk\202[\312\013\337v\266^\354\242\366\240\214\\ql\204\370\341Z\236Q\t\0165\217\337\255\351\355\247=-\333\351\350eL|\342\305\233\230\262\370R\235\224\255\204\027e'\341A\331HGN\266\321\023\272]D\203\316P\017\273\004\310\023o\316!\331\314\271\270Mt\364Z\002\004\316\227o\256|;\262\223wkF6\362p\r\316m\277TK\200\264\3711\311&\304]%\233l|\306q\354\263o\037l\321\335zZ\233\033\215\\\211b\0041\331\324\214J?\244H\225l:\366\033\247\230 \3012\331\240\306\347\032C\331g\247\272[\273\356}\364\212\343Xo)\033\020\327\\\256\365\346\243\265\276\2415\021\216\356\227\370a\307\r\255e\345 \277\252\231\324<\362|t\277\341\272T6\362l\364\253o\375T\031\007\217<\037\037\374\221J(\317\306"
+	.string	"~\365\323\366\331\376\212\276$\257sk\r\206a\273\364\3013\005\2429>m\2555l\330.\325\314@2[\325\302\330\375\352\325\377\313\230\266\326\035>l\227\3767e1\206\320G\323c\300\274\241\265_u\017\263h\027h\374\252\276\341\356O\361w'i\033]\204\2535\t\023\333\245\373W\344%b\023\325\036M#\3703\355\2269\3307WT\222\r\374\257\376\311\371\f7\3017\371\240\376\265Q\333\212\332\037\301'\370=':\005\352c\234L\016\355P\264\331\211\355Ro\265\237p\275\365W\323c1n\257-mg\265\266B\367W\265\366\317f\263Y\375L\264\276"
+	.ascii	"\306\334z\302\227\227\204\007\311\255\031$\267^\340\205\256\023"
+	.ascii	"8\237;\002\267\372\271\336\322r.\256\001\270\240\353,\377\342"
+	.ascii	"\032\313\007]_5\267\266jn]\325\334\232\252\271\365s\271\365\024"
+	.ascii	"sk\251\344\326\316\346\326Q\311\255\241\222[?5\267vZn\335\304"
+	.ascii	"\334\232\211\271\365\022sk%\346\326I\314\255\221\230[\037%\267"
+	.ascii	"6\332[\027-\267n.\267f\356\255\211\366\326\313\344\326J\242\255"
+	.ascii	"\223D[#\227[\277\312\255\217\311\255\335\275u\273\267\376\275"
+	.ascii	"\365Fn\355 L$!\324\007\nM\034\377\310.\306\206\355\230:\267\272"
+	.ascii	"\373\271sq\027t\377\342>\350^\350\357>nw\007\255\321/\240\343"
+	.ascii	"K*\342\372\255/\372\020N\352\310m"
+	.string	"\315\307\372\013;\232\377~e\230\177\365`\357\213[f\276sH\222\270=\244\253\2169\013 \002\202\352\002\035\021=\205;P\242\027\200\330&\317\033<F_\325X9%\177\342 \252m\305\274k\337\231\242\257\276q\355\330\215v\274+\314\002\b+;\006S\017\t\261W\257}\321\r\325\220\001S\251\256\267\255\037B\274\266\264\346\362w\023\307\272\342\215*,'\347z\273\374\fB\3440\277\252]j\233\253+\241Yy^\372\033w\251m\344\031\351W\347\372\251\033g\315\037O\002\366\220\347\345\204\177\221\307\207\364?\256\365\323#\365*\317\257\017r\345\237!y^z\275\003\"H\3556\334\254\237\276\001<\t-$\317K\t\177\244\026\31232\200c\375T\2163x\017\335\235\256\362\031\004\202\373\350((\177\017^\211\276\252\225\200RyV~Y\210\263F\236\223zv\267A:\022\262\331CjS\255\365\354t\250\270Y\215"
+	.ascii	"~\302{\030\007K\234\343\023\005\004]&\377\353w \371\020\362\265"
+	.ascii	"\030\027\324L\2658N\263J\276G\325\274\217\374\017\024M<\376\373"
+	.ascii	"\3766\207F>\244\204\243\270\307/{\342|\340(\357\236\343\007\020"
+	.ascii	"\302$n\217/\r\217\347\261\001\327\301v\260\235\353\255\327\267"
+	.ascii	"p\016a\2518b\r)\255a+n\007\306\0225\027\307\261\002:^\007\306"
+	.ascii	"\323\016\305[\r\347\301{\360\236\353\255\204o\321\fa\371\"\b"
+	.ascii	"\366\371I:\335\005\357\263#\005mw\272\356/x\275\34568~\b\367"
+	.ascii	"}Q\240\340z\033a0\304<\254hS\034[\270+\302\302\310:\234\225\205"
+	.ascii	"\2010#k\261<3\233Q\346\301\214\254\305{\366\342k\254\f\305\004"
+	.ascii	"\345\331\213/32\2600\032(\\$\315>\204\301\020\363p\026#\254\254"
+	.ascii	"l\206\n\"\255\202@\2141\26131\2631\262\2563\027-\304^\260\350"
+	.ascii	"\212!\206\002F\227\2122\263.\002N=F\026V\326u66V\326\245\264"
+	.ascii	"\246\2711\366J{\250q\313\212\300\316\323\222\305\352\025 \266"
+	.ascii	"i\025\241\002\250\372*\373\212\025m\306\255\312*\204E5`\337\331"
+	.ascii	"Q]9q\347;\021\031\364\207\250\266\025\255\236\257\265\026\260"
+	.ascii	"\353lt\331\211\343\230\201\336Q\266\024X\336\001O\247\356\324"
+	.ascii	"?\337\325#\037\222\372\251?\002F\335\314Z/\365M\201\242wP3\323"
+	.ascii	"\300.U_\325L\207\373\\\347\263\370C\204\263\351\340\276\036\024"
+	.ascii	"\234\337\372\355\301\023\244\212\222\213z\347\024\016\214\t\035"
+	.ascii	"<,\2773lO\250_\322)\020\247P:\345P\357~\224$\201z\004t|U\366"
+	.ascii	"\210HM\021\251\323\213v\024\2378\263\342\322\344\274\035\307"
+	.ascii	"\274\301FH\004t\022\345\303\237~\311\367\207\b\201\220\0254\250"
+	.ascii	"\375\364\276\307\255\355\351\273\020\237\270~jH\241\277;NN\257"
+	.ascii	"\035\317&b\343\007l\367\200\013v\202\007{\255\341 \360\220\355"
+	.ascii	"R\247wJ\261\206:\036\255\351B\220\315\306\255\215\251\351\331"
+	.ascii	"j\024q\251\037\246oz"
+	.string	"#a\324\315\322#=\323\273z\242qJ\237\364KwP={\274\225\276iNt\n\330'\375\321P4Q\353\217\036\351=zw\341\217\336\2538\031\024M\\\212\032\202E\351\210k\364[\312\237\333\356\001\037y\343XM\201\336\323\315\003\206C\002+Q\342z\201B\250\2014$\221#C3\"\"\222$)\244\003q\005\204 F!4\017\022 \304-I\204\316\025q\322\376o(\034\263\232\224p\2472;)WJb=\206l\234An\210\201\336\304\312D\365x\002\221}\f\273\377[9$\274\226\327J\354\tf\372\003Sa\007\200k4T\355A\022<\245\307\237\202\313\206-\220\343\020\f\\Y\347\007\344\304\335Z\365xl6]\320\221\177\253\007\241\244\327\342\311Y\241\363\355\226\300m\260\332\270\003Ap\241\370v\367\230\302\306\026\300\251@\365\240B\255\037-{\352\020\253.\304\311\360W\017k\036L\373p\257\253<"
+	.string	"X"
+	.string	"\327K8"
+	.ascii	"\364\241@\231\356"
+	.string	"\221b \020\016or\271A1\242\360G\035\023\357\\~\242|\317\005\311\231\325q\2115\320V\367\2411\367\327\274\264\025\276\231\037YQ'\213\247\250fH\034S\267RUs\306\2648xJt\231\023\363\315\353a\327\317\323\365\035\352y\354\231\235\274h\304\310\336\211\210\325Q\264\032\013\300\337?\tb\"\211N"
+	.string	"*p\370\372\245\211'RZ\254\024"
+	.ascii	"t\273$a\001\250yW\304\371u\301\306L\305~\230\310:@\216%\320~"
+	.ascii	"\302#8t\2207l\375\200\315B-\355M\344\326y}\220\321\240\373w\237"
+	.ascii	"2g\354\021q 7\320\016\367\177\022\023 \253\207\271\263\231\330"
+	.ascii	"\343\327\332\030zK\254\263AX\260E:\305\"\021xg\246\300\271A\205"
+	.ascii	"\255\364\037\256\316ko\004\353u\036\301'\277\005@\024\345oG\013"
+	.ascii	"A\3100&|\242Nl1C\321\252\261>\363\004+\344\0329!\323\210`\013"
+	.ascii	")\3719\253\222x\267>\323,F\336pDc\332\210\262\314\264\b@\027"
+	.ascii	"\355n@\220Z\243Y=\355&\t\032\324Y~\365Q\217\317\322\217\210\303"
+	.ascii	"\250\327\236tD\3044T\021\225RE\253\314\\\245\226)\220\006\237"
+	.ascii	"\007a\361\003\2716|\033\022\264=\336\313\\^\374\\\262\204\340"
+	.ascii	"\035\215#G\340\303)R\003\342\032\023\211\347(\002H\2133\311\005"
+	.ascii	"t\006\357w\360I\177\211S\n\2443\"\354#pH\022\276\231t\316W\361"
+	.ascii	"\331\247 \031\224\342\244\316!9\003\333\275wI\243\236\"\222F"
+	.ascii	"\256\020\203\206\267\320?\300\315}\037\3644?v\305y\3443T\026"
+	.ascii	"\335\025\320\331\226H\361yq\326\304\020/\220wj5\210\327\"\035"
+	.ascii	"6\224\250\001"
+	.text
+	.section	.gnu.lto_isAltitudeOffset.47.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375 \350}\006"
+	.string	"\"L-3Pm\222\016\244DX\250\344\253h\326\005\030\200\b2\302\323Z\376-l\351\377\273\035\346\332\236\306y6\213\343ff\212D\334\0337\027@\341\332\250\355\223-S[\250\313\253\256*\3630\356rh\250\036\030\334\245R\200p\026+\343\250\201\037f\301r\327{\226\233\262l\013a#\3504\211\257G?\260\233q\204\006\353\251t5"
+	.string	"\225\260\tXtp\364\031\007\233\350[\311\026\372ql\223\b\te\222\371\031\245\344\210\024\262\361o~\372"
+	.string	"a3\326\f\343SQ\311\004\bJf\346\332E\261\"v\333\321\n\207\306\211\007\304)\006$d\346\350\001U\364\326\277\3407\370)\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getEstimatedAltitudeCm.48.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\002M/3`m\322\001(\033\004\242fj@\212\034\035%\326_*\266WNY!\232E\275\303#)\364\272\024<Z"
+	.string	""
+	.string	"\212@WoE\237#\"\207\221\354-eJ\001\256P,o\252&\314\273h\305\26005(\250eBp\320\n\205Q\n\201\337%\201\322\352=J\245l\237\035\314\t'!\354w<\263|\f?d\360\327\235\237\211\3560\003(8\030\262\263\r\246\307~\333\354\330FcJ \021\005\331\225\b\225l\210\373\370\330\326\330\222\257\361\r\215\255\226]`\221\007\024\341A\262\273:\371@t\327.\020\335\245\305\255\243\345\237\343-\3433ra\233#\300\301\356\032/l\342\316\333.\260m`\273\"\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getEstimatedVario.49.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"BM04`m\322\001@\203"
+	.string	"'\340\031\272\374\265\021\260d\377t\206\263\031`)\323\232\265\036:I\241\327\245Cp\005"
+	.string	"\240\2308\237[\242Y#\267f\265\275\211\224)\005\316`4\360U\217\0037\256zpx\020\rN\363\026\"\\\206\3428L\201\341\206\201r\025\204\224\273\\{\025\245\032\200t\302\376\310\257\350{X\242\223\267\316\374N;K\005\320"
+	.string	"e\311\276>\251\034\366\247\335]\253\310v:5 #%\241d\327\242\264\262(\314\344\303\266\307\276\370 \017\3618\346\325q\321F\025\024$*\273\353\004N\320\316\362\003\355LG\217\317\350_\344\023\211tb\205>O\213\302\356:\255\020\306\255\267}`\033\301\366F\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375`D\001\335\t"
+	.string	"\244\016@\002"
+	.string	""
+	.string	""
+	.string	"\002,\177\025\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\0052\026\200\204\001"
+	.string	""
+	.string	"\003\0056\027 "
+	.string	""
+	.string	""
+	.string	"\0054\030\002.\177\031\377\377\377\377\0037\032<\033=\034>\035?\036-\037\005\300"
+	.string	" \301"
+	.string	"!$\"\201"
+	.string	"\005*#\200\003\005+$\302"
+	.string	"%\303"
+	.string	"&\002/\177'\0020\177(1\177)\005)*\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005'+gistry"
+	.string	""
+	.string	"\005%,\0013\177-\037"
+	.string	""
+	.string	"\200\200\200\0015\177.8\177/;\1770:\17719\1772\003"
+	.string	"\030\344\006\003"
+	.string	"\031\204\016\304\016\003\004\032\307\377\241\372\001\001\244\001\003\004\035\201\234\313\322"
+	.string	"\001\344\001\003\004\034\200\316\245)\001\244\006\003\004\033\304\006\007\003\004"
+	.string	"\362\277\310>\001\302\037\003\004"
+	.string	"\221\326\302%\001\342f"
+	.string	"# \300\0021\333v-\213\333\265\227kl\016\215\3400\326Cp"
+	.ascii	"\207\301\341\003\202\303\245\bD\230\206%\330@B\036\276\274\215"
+	.ascii	"\323n\357\313\271\022\231\260\241\020\203$\232fv\230G3\223\344"
+	.ascii	"\301:,ix'\370\305\236a\032t\316\023\332\300\343\001"
+	.text
+	.section	.gnu.lto_.refs.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375 \277u\004"
+	.string	"\262\312\037(pM2\214\001\360\007\310\363\245\250\252\252\252\252\252\252\252.\267\376\222g\302\\hD\255Eh\023B\272Qk\215\020\262e\n\007\322%A\211\200\271\325\262\213Vv*e\177x\254wpl\bl\215\200g`\\@\267X\273\"\332\024\320\022k#\242\205\210\366\001\332\341\271a2\203\332\005\265\202\332\204g\021&{\2406"
+	.ascii	"\330\022\271\"\231\022yAn\234\235\263)xav1?i\311v\333\371D\005"
+	.ascii	"\004\0012\013\\\024\007L\227\031\005"
+	.text
+	.section	.gnu.lto_.decls.a70c00116a751975,"e",@progbits
+	.string	"(\265/\375`\250\035M\222"
+	.ascii	"\252\364\3245P \222BJ\007\027\b\260\336\343\204]\3030^\241\315"
+	.ascii	"\232\366\223\307\032>/\366>\325\270q\277\224\374\037\3338\242"
+	.ascii	"\256j;\fP\221Gk\250\357\203\346\315V\231\003\017P+\"\"\"\242"
+	.ascii	"\031\205\250\2250\340^\336\335\231-\346O:m\272\337\032!R\246"
+	.ascii	"\316\002P\003s\003Vm\375\304qx\fm\222Y\035N6O\036*\271\266+="
+	.ascii	")\007\241\314\316\021\304M\266\204\241uz\024\b\273\324\310fb"
+	.ascii	"g'y\356\314\004\177=\345'\322\264\372\376\334$\325\232\025\203"
+	.ascii	"\351$;\301r=\311\346\215\342Q\251\001\031\023w\357\3351\323\202"
+	.ascii	"+b\323\367\033\373N\302\276\327,\317a:\354<\032\3279\3071\230"
+	.ascii	"\367\222\315\333u\357\365\341&`\220M:}\243\331\035xssss|\264"
+	.ascii	"\335\273\314\246]\354N{\331w\226}\023a\337K\354[\312\376\260"
+	.ascii	"\2127\007\3704\205xB\342F\210\307\t4LS:\375\371\215\335R\300"
+	.ascii	"\211\341\201\004\333\242\346)f\f\237\251\201\t\263\206\366\205"
+	.ascii	"-,-\315\f\237\3416\\\206\225`5\274\206\331p\032N\202\321\260"
+	.ascii	"\223\335\230\355L\206\333\336\315{\223\367\336\313X\023S\346"
+	.ascii	"\205\317\310|ea\257\036\364^#k\254\256`a/ncn@\205\rk\261\033"
+	.ascii	"\223\361\030\2671\361@+\315\363\336\346-\370\211~\n,`7V\3433"
+	.ascii	"\003\230\3565RD\200\256.(1q\3676_\004\275\330M\261\231a\"(\375"
+	.ascii	"\223W\354z\270\214=\243\331\263\227=O\261g&6\b\210m\301?X!3\236"
+	.ascii	"'\262\236\240\323\351\031iO\264\023\340`\231\013wa\247\013\026"
+	.ascii	";k\341\260\353\226\232\267\331N\344\2648;\375\f\366\354b\207"
+	.ascii	"\316\315\261\213\335Q\260?\274b\327d\035\330\267\361\212\035"
+	.ascii	"7y\213\235\007p\327)\260\340(\222\353"
+	.string	"j\335\333\364I\205XK\362\244\323\317\260\003L]\013\376c\317\007\354x\216\017\330\275\355\323\360\212\335\317V~\256\302Z.P\245\223\324\005\273\267\td\223f[\264:}\223W\354,\253\330\245\241\245\177\217\311h#\3633\r(\376\213\261\375\314?\373\374\254\373\371\204\265\377f\313\237\203j?gI\373\331h\314\317\\b~\016\363?\250\005\003\376\273\020\341\034\374\315\3643\230/\377\331\240\375|u\366\263\331\377\032\376?p\030\274|\200\277\203?\023\360\363\375\337?\212\376\274\344g'?W\375\314\344g$?+\371\271\311\317Ep\3719\352g\252\237\247\266\374\377\371\321\260\237\301~\366\372\331\3713\226\237\261~\266\372\371\311\317\310\237\223~\316\341\347\243\237\213~\266\3613\016?\333\360s\r?\317\3603\f?\273\3603\013?\253\3603\n?\223\360\263\b?\177\3603\007?g\360\363\005?W\360\363\002?+\360s"
+	.ascii	"\377W\370Y\202\237#\370\371\305\317\020\374\257\363\263\213\237"
+	.ascii	"\031\370\271\200\237\005\370\031\350\347\237\377n\376\277\375"
+	.ascii	"W\341\177\233\377Z\377k\374\227\361?\355\277\235\233\233\233"
+	.ascii	"\373;\314\277C\377\025V\002^\246X\037a\314\261\255.\316\356\322"
+	.ascii	"S\036\\2\276J rTy\246k\264\232\302Ti9;[Ko\351\233\344\272\310"
+	.ascii	"\036\2571 cteUjrt\032\326W|4\355\230\366\273\250,\354\354,|\326"
+	.ascii	"\3422\245\220p-\260X\275\361\022wo\030\030(\324\344\274\255\241"
+	.ascii	"\261o.\356.\256\366\352*\252*\317\273l\302\270\016\214\275\356"
+	.ascii	"\313\236\273j\207\005Ko\331{\227AR\226\275\247,1Q\232\357\255"
+	.ascii	"\273\351\321B{:Q\345C\253\212sb\337T\270\265\254|,\275`7\007"
+	.ascii	"\227P\024+4gq\272%\366\272!\354\307\030\340\265&~P\223uvvV\027"
+	.ascii	"\321w\211\353\"W7<\226q\3672a\364\276\216\270a\351\364: \354"
+	.ascii	"ap#\201\325RX\316\"\227v\013\223\323\363./\214\247O\330\247O"
+	.ascii	"\373\206\322V\357(\177G"
+	.string	"\351+\276w\3512/\022N\003Q\244\320\234\305]&S\b\205\227+'\345\210\367\325\324\216\0017 Y\022\327i\033\301r\274&\330\314\216tz9\355\344\177o\307\006Ug\016\025\373\367\277\273K\313{/\017]\363.\231v\316:f\241\237\207Q^\340\242k\363\"\277\316\304\261G\214-\ry\213{]\333\275\311)\244\007SQ\311) \312\256\251\213L>A\002-\357\024R\331u/\320M&\221!H] e\327\215\2729\312D\361mN!oR\352\002\335\344]j\241LNE)\273\226\242\200\224]SQ\267k\352\376\334\344\322\362\207\344]\002\335\256)8\267K*\352G\331%\025\245\354\232br\226\322\214\217(\2573T@p\2312yw<\021YZ\376\264)\233R7\315\275\f\326t\227\013\334KDj\231f\t\b\2231\265\355`\342\262$\305,\236\230\250\244n\262My%u\357\025\023\322}\252"
+	.string	"\331l\273M\270\r\211\204\310uj\272\227\200\247{\221|\333\356\275\310{/oI\244y\257\220\037\245\325\323\323\275\314\240\247K\004Y\326to\203\255!\213RvQI\021\225}uY]\035M$[\3354SK\333\205\334\272NKX\253\250\036p\2356\233)\310\214h\361\321i\023\261\203\326\306\213\255\323\247LvI\017\315\022E\300:mrw\226\204\020Kb\216\355$\255\204\235B\275\244\331\025"
+	.ascii	"S\312\0168\366,\264\363\021BBu\203\311\274\322\351\233\252\247"
+	.ascii	"X\352\016\320\323\303k\212\220N\373HK\261\223E\017\001\307\204"
+	.ascii	")J\215\355\341^f\261\343\2719f\261\353\"Do#*vKf\363\202m\340"
+	.ascii	"\004\t\225N\321&\"d\027\306\t*qB\232\311g=\310\346\205\322\200"
+	.ascii	"\212\021$\342\206\260\263\205t\020n\336\373\"\210\207\215\354"
+	.ascii	"\3113M\217R\261G\255\200\374\250\362\205\n\254\323\376\321\355"
+	.ascii	"\243\205x\377\350\036;\311\376\221\336\273\304\254@\017\263\002"
+	.ascii	":\264\"\226\234\273\364h\225\375\233\007\013\236\224\262#J:\252"
+	.ascii	"\237xs\246\260A\351\3642\372\211\233\350&tky\202\0315\317%\332"
+	.ascii	"|\311Y\343\324A4T\003\321;z\311\316~j\035oe\377\360\264\237\030"
+	.ascii	"\016\237\241M+^\026*7O~\302\361X\317\322\317M2\275\005\316 O"
+	.ascii	"\037!\266|\370@\301te\256\236\204uyy\365\232\035\025\223\307"
+	.ascii	"\222\207V\204\213\362\311\326\277\205:\177\220\\\027*\200\262"
+	.ascii	"\373\306K\3173\210"
+	.string	"70(\327Q\347\0179^mWR(\221r\324\212\024\024\013\313a.\007\216\210\221\242\026w\225D\2044\020\303:s\345(\026\265\335\234\027\331\324\030c\211e\205u\212V9\252\345\246D\032\227\033\213f\035\2452\244\007\233+5S\376\336\016\0235683\366(\324\354\215@\215@\261\3722\245\220p\032\310J\002\t\036B;u\220\200\353\201^\035\305\352$V\324[\247\350\021;\250&\334\223\345\324\\\r\241\343\b\253\037\265\352\264\276f\342\310x\307\2216a\216\240LG\235\330\2112\241O\322\313\244d\336\036/\336\310tF\320\226G:-\242\231\344-\271\241\021\323\351Q\360\260g\255%\312\343J\233\036l\200\240A\220 \343\003\215\322Z\203B)A\207\240T\334\306\374\271I\261\270g\030\252\004\025\202\317\3220A\211@\235\240M\320$\350\022\264\212\235\250\022T\310\321't\307\203P%\350\017\2378U\262"
+	.ascii	"\371I\227\1773\200IY\302\0257S(\022v\242T\017jR\241D\320!\f`"
+	.ascii	"R\336"
+	.string	"\324+\t(u\302\260x\301\003w&\315\220\335\020R=\\\232K\226\350\024=\302c\002I\313\001W\204\235\250\021+gJ\031\235\277\245"
+	.ascii	"SE\365\306\276\247\306\276\247\2062\255\022\317\"l_\354{^\354"
+	.ascii	"{[\354{_\366\275+\366\275,\373\243<\320(]\327\2308lQ|\326f\326"
+	.ascii	"\234\230\260l\013V\261k!V\261C\177@\203"
+	.string	"\360\241B\246d\013\020+T\221\331\322i\212*;\r\212\325\223\216\2364O\264l5\351\266\314\305\t\322)\232\3036\365\226\270@QD\354\310\220N\217\346\370\373\311Wx\230\223k\242Sf\202\350h2\005\333\227'\026({\316\342~s\364\276A\221}\227\266\232P=OO\"0R\2652.M\235\216i\006\241E\242\300\325\351'z\356\357\365\314\234\314\020\321a\337r(\230\224)\002\253\323\3569o:Z\313\244\226N\337[\262\357\270v\342\357\241rjf?\314\261\357&|`3DV\247\315\204m\262l\\\364\326p\2759\351\364\315D\313\301a\200v\032\302|\323i/\321q\336r\032\356\266\234\n\244\356]j9>u\356]\362aV\200Y\201\224\n\025\224\260]z\213\306\366\223\350\r\247\241\200\245\245u\312c\263\3306m\372\255\204\237\313\344\246\264\342.k\224\3137\236#\2544\361\205e\325\250\3515"
+	.string	"X\361\276\222\314y\356\272@}\211Y\303r\273\034W\230d\031\261h\320\264[\t\001\2545urF\b\t\342r\336n\375\243\027\345\b*\247\2473\316>\323T}u\311\213d\212\025\303}1\205uz\253\243L\031\267\345\034\025\324K\307\031\230\031\373f\343nk\353\251\376\271I&\245\325\331\324n\215\235\275\306r%\204@F\347\331\024#\246\323Z\274x\"c\302H\271l)Y\322\351\230\240\335\023K\240tuz\036\024{^\220/`X\256\205\025+\236\223\375N\316\354\214\345\226xL \245\271{c\277#c\337?\270\313\312\372G\320E\302\231"
+	.string	"\353\211\346,n\327el\fUs\337\004\303\340\317\330SW\342\321\004\026\252\020\210\203\206\321FP\370\243\221d$\032\031\325b\0014V\360\204\302\037\360\270\006m\f)\r\217$\330Ai\030\024JP\301\f\337\f\fv\030R\213\224\204\300ap\310xT\032\032\322\201hDZ\211C\236\321O\025\246\353qH\004\352\214\326a\320(\334!\255\277\244\241!1)\211\b$\240h\370\263Q\364SC\300!,\026\177<8\212D\032*\326\342\320QQ\005p\2504\302\252\036S\f\215Zw\364\355\254\276\341QQ7<*\242H\353\321P\025\356T\036\202\307\224\207\243H\004\246\306\265\210\236\007\207q=\006\217\324\027|\003\024\251\303\243\240\360\307+R\217J)P=\362\376[\177EF\337Q1F\217\361\207\004L}\305$\025\206U=\252/\034\025\021"
+	.ascii	"J\242\261\252"
+	.string	"G\002\034\203?\272#\305\030*\022\006\225l\260P\213\210*\034)\331P\213z=I4T\025\353\212\235\t\216\305\243\036\036\242\030\253\360\203U\255\261\252G##\026~@G\303`\222\361\227\242F\022\215\241\t\302\0370\270\032\325\033\276\032-\220 \300\n\364\r\225\214C@\243\343\321O8\202\272\376\326#\212\036\nb\300pT\"\006o\250\306\342\217Z\244\264\006W\341\007\004\b\325\033\250\214\030B\365\206.I]\2178j\b\220\242\202\030\253\360\003\242\361\007\302z\374\ty\016$\006\215?\031\212\324\365\227\024\\\217\"\250\353O\250\004\024\376\200\003\034\0304\252C\365\310\276\202\031\022\314\300`\007\3361\320`\002\r&\330\035\003\r\210\2104\230Ad?\203\b]W\3371\0065)\270\332#\035\360\243\002\215J\304\032\253\360\327\023\022\211 \370tG\337o\375\205\240$$\3268\026\217\200\326#\3058\026\217\206\210\301"
+	.ascii	"\222h\254\302\237\356\350\373\001\211)\034\213G<\353O\210\256"
+	.ascii	">\nd\254\303 oH\024\242HB!Z$\343\310+R\325b\215\024\352\321\250"
+	.ascii	"D\244Q4T\"\032\217v\212\304\"\244t\375\325HR\032\356\216\024"
+	.ascii	"c\350h$\036\207\3521\201\023\213\252qh%\022\215C)\216\276\243"
+	.ascii	"\240\321\220H\303\250\256j\022\220Z\304\261\036\225l\370\f\217"
+	.ascii	"@_\260xT\201\301\033j\221\317\361\250\032\213\212~> \005\301"
+	.ascii	"\037\325\370\323\241\310\370CZ}\030\360\326\241\022\021\350S"
+	.ascii	"\205\305\244\337\021\310\250(\364\251\307 q\330\263\372f\020"
+	.ascii	"\255\303\240\222\025\2527|F\300\024@\242\272\263\372\216~0\020"
+	.ascii	"\203\274\023\021\321h\021\303\n$X`\214!1\270\006\217\304\342"
+	.ascii	"\320\212t\024\024\032\r\r\203\277\244!\240\3618\024\303\200\243"
+	.ascii	"\337\3523\n\201;\370\210\306\237\r\236$\372\352\214\315\333U"
+	.ascii	"\247fM-(('Rd\246\322$Q\304\252\260\365\226\236\"J N\326\326\354"
+	.ascii	"\234\314\254HQ\003K\265\004aB\225\346\006\002\234S\2221N\237"
+	.ascii	"4RI\234P1]\245\306U\347K\023\275\3122\005\r\030,\274\25781\036"
+	.ascii	"_\272\210\264\307W\020'4\254\236\226\233\330\362L\016\312\016"
+	.ascii	"(r:E\305P1\324\013/\227p\021\200a\372\020\372\321\262\243^\320"
+	.ascii	"tMm\342\224\351\024%;\232\245\243\005\313\231N\321\261\243=\215"
+	.ascii	"\215\352\310\321\322\037eU\326\346t\3514\333\306\315u6\027\344"
+	.ascii	"\016\2354n\316t\032\026\326nL\025\004\21293\252\246\266,YP\260"
+	.ascii	"\276L{\255\004\202b\2502\3414\b\362\224R\312\240\231\031\222"
+	.ascii	"$IsR\n\020\204\203i\036\311\251\017\022\300e5\021*\250F\222\244"
+	.ascii	"P\3309\232\0220\353\207\226\310\372@q\f\322z\tJ\247\n5\350\236"
+	.ascii	"\fn\254L'y\252_\342\032\013\375\tQ\344\016\016N\223\002\202\214"
+	.ascii	"\262\007\327*fLWC\260\003h\277?2i\277\n\027\033I\230W\235Z\300"
+	.ascii	"rn\r"
+	.string	"\265\370\036c\341\362\320\352?\001v\374\372\336W\377I)\375\326E\370 \033@\316\207\2775\242~\305\017=\211\007\340\t2Q\0325\335\351\317\004\331\177\"\326?W\2039|\013z\231>\f\270\220\202\350'\007\251\265]3~\323\033F\301\233\030Kr\256\200\366\220\210\200\342\235J\312\264.m\364\325\315\f\231V3\177\223W\255lf\026\031'\031\213\304v~\272\202\262MG\236\234\217v\025\270\013\306K\247\337\362\241\"\256\201)\032\335\214K\260>\254\033\302\372\373\350\257\350\366\263%\3519 \033\234\3521\310\337\262\304j\255\374\341\277\031\273w\311 \225\212X\236\017\332\322\360\264\323\325\305\310$\205f\305Bcm\305\226\220\026\322\236\343\264\304\212^\376@\243j\370\357\340,{\035\0249uzY\021:\bq*\220\322\t2\027\214\351\370i\177\322Om\357`\006=\006\222\314b\323\272\327\t\231\321f\007E<\033"
+	.ascii	"\033F\0163\224j\365\263\367\214W\022\362\207\361\224\220'wn\026"
+	.ascii	"^\215D\030RYi\216\242\017\003\240'\320nl>\235Y(\022F\354\207"
+	.ascii	"\rY\360?$\252\241n\2449\255\312 \226T\234\301uq\27181\333\300"
+	.ascii	"\327\027\026\351\017,,^Te8\342\206\352&i_=\365\275\323\222\361"
+	.ascii	"R\207.\007kL\002\274]\023xE\326D\007&\243\002YAy\223\215{\244"
+	.ascii	"t/1\300\024#\336\273\201\366\341\351\357\320\250\200{4\247\217"
+	.ascii	"\321\023\341\023\323\036G1\2712\226\204\334\333\234\034\031\037"
+	.ascii	"{O\201\036\204tF\311\207\216N\005\235\245\300\342~]"
+	.string	"\300\275\0313"
+	.string	"5YYa\314\007@o\334'\257cP_E\001^(\312}\271\371;D\335 r\356\033N\360\033\271Z\005\031\214;\226\223\024yq\351\261\222Cb4\3013\205\274L\231)v\336\340,ex\241\354\027^5\340\013\026/1pC\355\220\264\177\221\232tf'\210I\224\341\301T\016&,8s\240\305\212\005\226Oq${A\247\301r\264uH\361$n\201\225G\320\264Wu\005\201\213\006\\z;<43\025\\\017\346\023\305\245\241m\327I\222\026;\006<0\317\375\221\206\024\343t\nw\241\020\204\265!R\177{Cb\227\003\006)\322\276\301\246\307\325d\207\257L\375k\361\276\232 \033\365\310\362s\346\214x\207\203g\344SP\001\314\363\367\336\227\2279\241\351\235\277\361{\200\016GC\013\264\022\354\306\275Q\310mVE\206,%\207jL\271<r\222\373"
+	.ascii	"\315\270\347\327\317\343>\3729V\331\354\240`s\177y!)/\324\246"
+	.ascii	"8\242b?\236U\321O\327\316\255\354\n\342F\320\360"
+	.string	"\203+\0339\031\3120\247\374\205\223|!\t\206ep&\3729Z[\302\007Z\353M~7l;u}4`\2508\220^PJ\266A\245\ri\262\240'\027\357\321\314\034\b\320d\311\2323\024\376\r-\237\030\230[aR\250\0033\355\337/\223\005O\t\201`Sz\264\025\023)\006!:e\345 \326Jc61\005lt\217\002\367q^b\360 \254\375\342\234\370\300\360 \004\323o`e@\007\027\317\261l\013\314\307>\206\343\221<\276f\276\207\255Y\247\004;\036%\244Kx\204AT\212Eh\016\350\207R^\203\262\311\250\323\200'\034X\247\250\240,c\306\352\374u\237O\037_\250\004hx\372\0270\"z\026\220\204P\230q\214\177u\177\247\355F\375\272P\202\364\233\013\310m\215\370j\\\333\220\376\333\250\300CDZ\222\366\250Zh\001\244\234\327=\017v\352\00771\213\247{\021\372\215~\360{>\276\367"
+	.string	"\273\022\"AP\225\206\022\331P\0248b\3459\"\270\n\305x\367\340G/\244\314|\327B\357\260\333<~"
+	.ascii	"L\352\261\225\311\362\231.\370:\360\277\341\274P\357A\037y\314"
+	.ascii	"0>\257O\341||\341\005\304\265\202\237\314\330\370Ya\216_\026"
+	.ascii	"\034\261\3648\246\177'\256j\034%1\264\372L\355\221\337\251\023"
+	.ascii	"?\220\3763\373\344\327\375\027\216\3375\2472\306F\354\245\326"
+	.ascii	"\022\273\033)\023\304\372zrA\340]7\256{8\034\344\2775ic\315\225"
+	.ascii	"\216\375\233L\r*\017\314P+"
+	.text
+	.section	.gnu.lto_.symtab.a70c00116a751975,"e",@progbits
+	.string	"calculateEstimatedVario"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"positionConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"isAltitudeOffset"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"pgResetTemplate_positionConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"positionConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"positionConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a70c00116a751975,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1987 @@
+	.file	"servos.c"
+	.section	.gnu.lto_.profile.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`O\003\205\020"
+	.string	"\004\026C\004"
+	.string	"."
+	.string	"\334\301\274\312\f\f\002"
+	.string	"\002\001\002\002\002\001\001\351\361\316\337\001"
+	.string	"\002\214\216\274\341\007\003\274\331\333\367\005\f\002\003\002\004\002\005\004\240\342\234\212\n\005\006\224\305\200\177\006\002\002\002\007\002\003\002\b\007\n\232\242\313\204\f\n\002"
+	.string	"\002\006\t\003\002\004\013\f\r\340\216\253\313\016"
+	.string	"\002\006\017\331\312\303\304\004\b\002\002\n\021\240\367\360\225\r\002\022\227\241\264\221\007\b\002\002\002\013\002\f\003\002\004\024\025\206\353\317\360\016\f\002\r\002\r\002\016\002\017\026\352\263\360\321\b\027\030\031\265\314\211\315\006\020\002\002\020\021\002\020\022\002\022\032\227\257\311\336\r\033\344\362\241\220\b\020\002\023\020\034\375\251\320\324\006\212\001\002"
+	.string	"\002"
+	.string	"\002\024\002\025\002\003\002\026\027\003\002\b\002"
+	.string	"\026\002\030\002\030\024\002\031\004\002\002\002\017\032\002\017\033\033\004\026\002\026\"#\350\247\211\367\002>\002\002\034\002\032\002\t$%\256\373\201\203\rX\003\002\004'\342\201\222\246\004\002(\230\227\377\334\t\002)\257\260\211\347\004*\265\371\317\206\t+\362\324\245\255\006,\303\306\351\344\006-\320\266\271\326\t.\374\234\315\270\013/\227\213\266\256\t0\376\312\360\275\b1\265\332\223\353\00123\244\376\226\227\01745\235\336\315\261\00567\362\326\362\261\0038\240\342\234\212\n"
+	.string	"R\250\301\241\200\231\231\224&)T\2265P\002cd\264\016\022"
+	.string	"\204R\324!\204\314\004c\021\r\323\372w\315\370)\350\030\350\376Lc\256\244PhO\265\242]\230\341ya\214\352\336\017\343\366F\344\017\243{\241M\360\232v\245X\360\371\002\325\235\007\034_#\246z\340@\344\3542\b\357\347\255\303g>u\213{\301\b\212\342\304\324\2753\275E\207\241\336\256\217%\216\243\322\307\034^\007\323\003$F'"
+	.ascii	"\341\311U\236\240\215\307\031\2746K\342\211rx*V\337M\002\266"
+	.ascii	"\r{\0272\233\310\320\360\342\351\334H\276\312\262W\264\342\323"
+	.ascii	"~}\2647\201\030"
+	.text
+	.section	.gnu.lto_.ipa_sra.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 \355\265\003"
+	.string	"\204\003\341"
+	.string	"\021"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\001\001\003\001"
+	.string	""
+	.string	"\001\001\002\001\002\001\006\n"
+	.string	""
+	.string	"\r"
+	.string	"\001"
+	.string	"\001\017\003\021\002\003\022\025\031\033\001\034#\001%\001"
+	.string	"\001'"
+	.string	"\003("
+	.string	"\001"
+	.string	"\001"
+	.string	"\033"
+	.string	"\270"
+	.string	"r\n8\003TU@en%0\227,j.\376lYM\026\030{\035\246\2403\020\027\001\304\200\343$X\314'6.\f\004\323\f\013\002\2119\360\317\",A^\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\261\003\205\021"
+	.string	"\346VVF\360\2568\215\001\360~\263\273y\366C\262\\\233r\024\035\237\r/p\351\\\222\254\275\255f\357\235h1\235j\354M\2756\221U\356\207\343\271\305a\332\300&\262I\371v\266\211B\221\357\004\371bl3\f\375\311\2262\005;"
+	.string	"G"
+	.string	"K"
+	.string	"\233\222?\307\352\272\024-j\316\251\261|}O\224\037;\347\234\231\007\260C\t\r\005\226X\333\272'>\207\355\373\255X\242Bf{\321n"
+	.string	"K&>\373:Z\026\260\304\002=hlB \t\003\323J\301J\262\007\221'&-cFH\277\315\260br\372\f@\f5\304l-`\205\0237\347\211*\222,L\r@x,\007\224\205S\267\246\"\022\2343\354\366\345H\222RTZh\234y\342\376\233|\301~\001*3+\252ld\303\0274\253\004\035#\013\001%\302\207\2157\324\263!\222\304\313\345B\201\204UL\3501\2019,\034\341\232\251\t\221^\030R\003\026\240\236\325\324A\215\013\205\220\310\216`\353\205\343\214\016H\007\323\277c\365]?\214\003\377k*3\316\b>\260\315\007\364WU\006\005M\n}\215\256\013+\324e\003\243%\231\036\260\224%D\252u\362\211\013\274n\376"
+	.ascii	"\034\006\331\223\254\bU\210\262\253}I\262\243*4\351K\327\205"
+	.ascii	"l^\250\221\255b\002\032#I\352\024:`\002\231)\252\363\022\300"
+	.ascii	"Se\305$\024HH\202R%v\3327\234\303\241U\201\300\b4Z\361\344\006"
+	.ascii	"[\317\200\224Ht5\200\334i\353?\024\221\277P4\226\\\r,\274M\233"
+	.ascii	"\205\t\226~W!\3065\005\367[\325*\251v\3020[*'8\256\\\201\"\021"
+	.ascii	" \311t6\275\227\371A\222f\017\t\210\231\207\330\3338L\330R\021"
+	.ascii	"\033\223Z\257\302\226aE.\272\363Z\317~\025l\336;$\361\237>b\362"
+	.ascii	"Z\305U\373\247o`w\262j\024\021\304^g\\(\225{fG\224\337\325\307"
+	.ascii	">[\213\372fX]\221\334\212\303%\335hjL\257\324\337*K\344<\265"
+	.ascii	"\032\224O-\206J\333\302\251\227b\334\271d\t\210\035F+Ki\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\021\003\325\f"
+	.string	"\206\02063`U\223\341Tq\350\022\3341W\352\330p\035\030\275\367\b\202@\261h\003\031\315m\0316\b\202 eD_=\351\333\212q\275aacQ\264\356\270\267L2%"
+	.string	"'"
+	.string	"-"
+	.ascii	",\320\352\336]\264N\211\206.\322\2651\fYj\\j\0352\2538\253\""
+	.ascii	"\263jFv\033\255\354\272\365\254\220\r\004]\215<\340\345RQ\324"
+	.ascii	"\316\242\265\006\226:K\035\345[Y\240\220\362\336{$\201"
+	.string	"\306g\334\311i\311\250\361\315\244E\211\344\037w\217\357x\201\026\210\343\341x&\235I\207\233\320&\364\336\004EM\002\255\273\250\024gZ\301\231\326\327S\260$\220D\370|\246\033\201\t$\231!\0378=`Nk\332\005\301IsY[jc\334!W\267\034C\316q\024\355*\034(J\300\001\036\300\007]\250\021I\314(\221\304\222a\016\200\002\221\272\243\007\022\200\302\202\210a\305\030a\220\330\331\2375\004\205\022\241\355[\334B\007\227\026\254w\025\216_\320Qs\220G:f3*V\247\272\261\305\312\024\367^\242b\266V\310o\204\326\345\246X\360\335KQ\346\262\243\231m\313\341\306\021y\003\351\3121,\265\005\243\277.J\203\367W2;A\207\332ojA\314c>*OW\210\3236\257\347U\263\021\245+\032Q\2462\bl\017\330$\207\210<V\2536\002\261\017\357\177\342\264rG\221'\021\211\364g\342\227\344"
+	.string	"\r\274\275\222\313\251\312.\2311\310\223E"
+	.ascii	")\001G\322\025\034\027a=\2401NQ\325\023"
+	.text
+	.section	.gnu.lto_.pureconst.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\230\004\003\230\004\006\230\004\n\231\004\r\230"
+	.ascii	"\004\017\205\004\021\205\004\022\230\004\025\231\004\031\231"
+	.ascii	"\004\033\232\004\034\231\004#\231\004%\231\004'\204\004(\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"\205\007"
+	.ascii	"bJ (\200\305\031\016{Jg\226\321M,\neD`\0013!\322\020]\t\364\004"
+	.ascii	"\276\241\237,\344\365\341\315\332>d\242\333&e\ngX&\231`\317\244"
+	.ascii	"~\257\320\312\265\316H\235D\206\200`\345\341\245r\251\335\300"
+	.ascii	"gk\341\321gcTBu\225_\323Q\376\332\f\032\235\214\316\327\306\371"
+	.ascii	"9\255r\253sQ^\265\215\3402@\251X>\303\351\r\232\346\016Z`\347"
+	.ascii	"\016\230O\356y\247\332_\271\203\341\321\320\023 1 `\002Cd\346"
+	.ascii	"\001~\262\200v\310\206\210\004~\005\n\n\001\323\350\2626\241"
+	.ascii	"\204\201\003\030r\263\263e#\b\211\217A\211]\026\303\256\251\016"
+	.ascii	"k\r2x\374_\343FZ\361w\013\005r.1\327\205\004B\024\240\226\300"
+	.ascii	"\005\272v`\317$|\365\261:0\016\205\320\036_\034\372#L\307\002"
+	.ascii	"\303\021tP\206 |\260\350\320Y7V\301n\021"
+	.text
+	.section	.gnu.lto_.lto.a9dfb1e0426082bc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.64.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 \235\225\004"
+	.string	"4\bh"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\275\310\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\346\006us\250\377\005uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\0014?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.65.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`R\002\225\022"
+	.string	"\006\241vG\320\362&\035Rp\335\300\252\tue\334!\001!\365\214\0057\027K<(B`*\307\327\352@\326\362\260j\323\202\360\323\204\345\220\306\234\243\035\211~\260\202\3761\344i3\356\317\2427Dg\346\252@k\311 \233H\231R_"
+	.string	"\\"
+	.string	"e"
+	.ascii	"9vm\021|\362=\332\366\004\336\343\367\003\336\243e\366\217\005"
+	.ascii	"7,\"9FT\273\013\352\n\177\357lw\227\262\307NS\346\023\335\001"
+	.ascii	"\n$Zm\366\330\215\354\360\360\030P\273\351T\242\240R\034\367"
+	.ascii	"\324\251\331d\027\324s=\356'>P\264Z\317sdew\235\264\332\211\333"
+	.ascii	"\273m\230\355\025;{\002\321\247\361\036-\020Q\005\251\311\234"
+	.ascii	"m\233\245\002\331W\211\302ya\375\261[]\232\365\241\337\373\355"
+	.ascii	"VMg\246O`\002\216\202\251]\023\271!\353\024\225\\\374v\3736\037"
+	.ascii	"W\364\031\262\337L\276\031\317WcG\t \2736\b\217N\371\036K\272"
+	.ascii	"\257l?\355\307\270\f\331\207h^`\367\207)$\321\007M\312@^\277"
+	.ascii	"k\360\354\r,yZj\311\215\316\314\322\353q\217C>S9ETY\352\244I"
+	.ascii	"\325dN\025iGH\222\272k\271\216\227\200\231\221\353Ja\222\221"
+	.ascii	"\320\377\362\354\227\343x}E8*\t\036~\303\006\200 \234\320\252"
+	.ascii	"\351\241g\303\234FH\362d\2078R\354\333\335\224#\230\b\004,v\367"
+	.ascii	"-\0363.\0161\025\002\274\274\\bB\n+\267\240\304\302\0210W\f\224"
+	.ascii	"\351\360\362\372\340\002\306\274X`\300\026X\fDa\340\020\204\013"
+	.ascii	"\006\312\204!\f\\\331\366D\377\216\202\234j\324&*\220[K\332\322"
+	.ascii	"\b#\255\223U\267\036$\262\352\335\356n\247@7\361T[\372*\037("
+	.ascii	"\034\0256\231s\252\355\2317]x\240bc8S\206\006OK\0013 p\002\241"
+	.ascii	"J\242\007\217\230\364Wbk\327\202\315\005J\254c\226\372~\215\305"
+	.ascii	"$\026\374\370\305\214\337L\033E\262\002\234\205 \037\"\300\275"
+	.ascii	"jD\246 \236\212H\362\217\022o\340\307\213\244L\323k\002\302["
+	.ascii	"\022\035i\342_\202@\317\265]\305`\\\254\022\335\357;\346\013"
+	.ascii	"\233\323wM\254\325\272\373\206i\327@\304z\267\331V8a\321\020"
+	.ascii	"\301^\250\031\357K\244s\365'"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.69.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 \221E\004"
+	.string	"\244\007\\"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\315\361\037\006yw\350\316\006yu"
+	.string	"\005\001\006'\001\360\035\001\020\025?\202\210\2008sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"0e\250\204\004\232\344\r\240\b"
+	.text
+	.section	.gnu.lto_servoParams_Registry.73.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 \237}\004"
+	.string	"\364\007j"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\316\301\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\376\006us\324\006uq"
+	.string	"\005\001\006'\001\340\035\001\b*?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\005"
+	.string	"0e\250\004\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.74.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`l\0015\017"
+	.string	"\226^iE"
+	.string	"\261&\035;V\360L\326\\\n\247\367\235\303\263\033[T2B\344c6\277 \241:\320m\341OZ\316\210\261\245\202\017k\342\312\036\356\214[\377\377\256ZA\3038\003\2461\203^\327/q\377&\215\354-eJ\001U"
+	.string	"R"
+	.string	"U"
+	.string	"'\200=f\037\200=\032e\327\270\007\263\377ZPZ9vWS\020\316\016\275\033&\352\021j\242\374\231#\360P\323\251R\217\320\243\2622#\200j\003$\331\321Y\235\365LQ\235$$\301r=\353 +W\247byz\030\354\256\263Su\270\261\3336\331^`\337D\376\\\346\367\374\273\341\323\252\351\324\364?\260\0332\n\274v9\274x,N\204!\"\363\237\375\326=\237e\320\243\235\342*P\377l\223\245V2\327\007ccwC\036\255 {<"
+	.string	"\017\262\375\264\177\342(P\227\311p\001\273.7.v\275\004\006\311\036\355\005y\232\237\346-\266\324\241\261\313\275\363W\234\005\005\370\020\217\306\260a\357\036\375\r{T\265+\\\310w\376\330\371\300i\312\251\036U\025iq%"
+	.string	"\3341\260k\352\271\230\223|\031\352\365\2557\210Y\325\240\3640\311\227\252KE\307\013\325\027\333K%\311\0167\302\352\342\243\213B\244\222\323F\032e\016\215l%\013&\321\246\235 <\030Ep\240\221F%\022\264\220i\323F\f\2704Ad\322N\245\222I\003y{u\361g\236\321\340\3001\321\223\250/\366\334\350G5'C\0165\3056\030\324\313|9\032r\307\341\356.\264\310\241~\364\254\303\035+\027\327\222\005\031"
+	.ascii	"1\003\373\274\201[?ieQ\\\363!\n\210\305\032M\b\223\231A`\006"
+	.ascii	"\005'@\237\265V\211B\262\020\316S\2259hg\225\260fu:h\027\207"
+	.ascii	"E\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_gimbalConfig_Registry.78.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007["
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\336\201\037\005yw\250\324\005yu"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\0038sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.string	"A\210!\345.\320$o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_servoMixerAirplane.83.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"U\004"
+	.string	"\364\005\370"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\001\006\303\001{\302\003\002\005\307\001{\306\002\004\312\001{\273\276(o3\314\0014\313\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\023"
+	.string	">\003"
+	.string	"\351\200\312\002x\332B\035\270\030\370\t\212\201\023\320^\360\211T5\257"
+	.string	",\302=\320\003\026P\301\221b\365"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixerFlyingWing.84.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 \3725\004"
+	.string	"\244\005\355"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\303\001{\302\030\001\234\177\273\001y\306\002\276\273(o3\312\0014\311\001\310\001\307\001\305\001\304\001\301\001\300\001"
+	.string	"\022"
+	.string	">\003"
+	.string	"\350\200n\001\205\177F\025\fx\271)\323\026,"
+	.string	">I\225"
+	.ascii	"\354^\026X\204\366\200\f\b@eFJ\320\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerTri.85.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 RE\002"
+	.string	"\224\003E"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\002\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001?\202\210\200\bo3\300\001"
+	.string	"\005"
+	.ascii	"@\006\004\2402#%\350\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerBI.86.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 \323\265\003"
+	.string	"\364\004\306"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\001\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\003\002\302\002\234\177\004\306\305\306 o3\310\0014\307\001\304\001\303\001\301\001\300\001"
+	.string	"\020"
+	.string	">\001@\230.\307Y@\037\027\032\003*\2466\f\203\300\300'\200/\231j\017\310\200"
+	.ascii	"Tf\244\004=\200\""
+	.text
+	.section	.gnu.lto_servoMixerDual.87.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\304\003k"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\005\005\001?\202\210\2008\177}\276\001{\273\001y\274\001w\273\001u\275\001s\274\001q\273\001\004\301\001{\300\020o3\302\0014\277\001"
+	.string	"\t"
+	.string	">\003"
+	.ascii	"\0201U\016L@V\367\300\002\225\031)A\017\240\b"
+	.text
+	.section	.gnu.lto_servoMixerSingle.88.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\365\004"
+	.string	"rF\030#\220-4\006\177\375\257\205\277\205\377\266\265\221gf\026?\361\247|Qsw\033\027\345\254G\265\276\204\320N2\371\3457\346\314\2339w\366\034Z\364h\322%\303\246\202\342\027\243\202\200\017\033\264\002P\243\013\225\340\301\256\267\305\216q\245qs\354\0367\266\005\0229H(\023\304\272\257\323\204\327\256y\346\211\031"
+	.ascii	">\003\200tId\361\204\177L7\252\320\036\370\230Q\234\200O~Hx\331"
+	.ascii	"\021\314\002\017\355\201\217\215\036V\005\300\200\nh\017|\214"
+	.ascii	")\026\376\252\037,\240\202#\305\352\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerHeli.89.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\225\005"
+	.string	"b\007\034'pO\032\003\374\374\327_\377q\333^\377\244\361\357\252*\244\237XD\321~\377\377zWH\002\005D\255\216\354\326\032I29\346\260\346\315\234;{\356\006\035z4\351\322\246Q\206S\205\305\335I_\255\362\265\"=*\002\037}S\365\"\214\013&d\262\271\301\313xklq\274\2177\235\313\276@4Dd\"I\374"
+	.string	"\326\330\352k\f\376\362\314)\001\033"
+	.string	">\001\264x\002P0"
+	.string	"\035i\312\024\261\026\024\r\034\332\300\001x\304\024\037h\031\360rS\306\223i\031"
+	.string	"y\202v\340c\200\005S\355"
+	.ascii	"\211\214\252\353W\347@\017X@\005G\212\325\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerGimbal.90.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 \177\315\002"
+	.string	"$\004r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\375\035\001\r\001\005\001?\202\210\2008\177}\300\001{\277\001y\276\001w\273\001u\275\001s\274\001q\273\001\f\273\001{\302?\202\210\200\020o3\303\0014\301\001"
+	.string	"\t"
+	.string	""
+	.string	"\021\250\253Q\347\206\352QY\007pP\231\221\022\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixers.91.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`T\002u\f"
+	.string	"t\022\037\003"
+	.string	""
+	.string	")"
+	.string	"\005\001\006\177\001\035?\202\210\200\020}{\274\001y\273\001\005\001\006\025\001\032\031\030\027\026\005\001\212\001\206\200\200\374\342\203\304\243\017wu\b\310\001y\307\025\370\377\202\017sq\002\314\001y\313\024\023\022\021\020\234\236\350\027om\t\330\001y\327\017\374\302\017ki\005\334\001y\333\016\r\f\013\n\t\274\236\254\227~kg\334\001y\351\001\007\006\240\227zse\314\001y\357\005\357\342\rca\004\363\001y\362\004\003\002\360\226o_]\001\373\001y\372\330\003[3\375\0014\374\001\371\001\370\001\367\001\366\001\365\001\364\001\361\001\360\001\356\001\355\001\354\001\353\0015\352\001\350\001\347\001\346\001\345\001\344\001\343\001\342\001\341\001\340\001\337\001\336\001\335\001\332\001\331\001\326\001\325\001\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\312\001\311\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.ascii	"3 @#\031\221\033M\022\200)/\210M\\.\334\016\265\025,\021\351"
+	.ascii	"\036\244\\\f\2757\302\"\0349[\221\005\273$\332\262Ap\321\314"
+	.ascii	"\262\355\301\354\346\023\226\210\344$l\022\203\226\373\241#\204"
+	.ascii	"\031\351\302\366\003\316$\271\ts\"%\351\032d\312]zT\223\257A"
+	.ascii	"/W\177\330\311%\354\022\341d(!2\350a\025\001"
+	.text
+	.section	.gnu.lto_determineServoMiddleOrForwardFromChannel.92.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`[\002\005\024"
+	.string	"Fe\205J\300RN:\303\225<\251;\371\027\377\007\202tFP\006\335\034\365\246\205\342:\342\235[\266\373u\023\372\023V\332\336t>\006\356\0012\252\206\2665A\352\310\305!4\025\024p\325l\025 (\243\300G\213c\333&\215l\"wJ\001o"
+	.string	"h"
+	.string	"q"
+	.ascii	">\322_\344\376\323\340W\255&\2024j\375!\360\310x"
+	.string	"j \264\355\273\370Q\316\272\371;\001B\034\032\221\263\004\244\326*\003p\021\361t>\200x\272C\327]\244\341N\235\317\341\342yZ0\321\025#+^\217\347aH\017'\326\273\231\033\212T\005\371\b\351\341\204#?S\"^~\352\364l\346t\241\324Z=y\275\020\267\353\266m\266k\366\334\005W\342\201$\356\367\345)\013#\251\234\255\335\f\332?\233\271>\373\033\f\006\203^!\303<\375z\322=\376\367\213\236\246t:tM\2578=\351\364c!\300*\005O\265~\bj\325\034\024\230\342I\277\375X\220\223i\256\344-\243\212j\255\261i\347\374\3221'(\311=\251f\254*\\M:z~\324\372;p\352\222qN\007\007>\210\240\242\"\236\276\366\005\0347\334\025#+_]\005\001\303\365y\334\335\271UR\331\022\3764a\254\265\232\370N\237A\241\302l\2367\333K}BeU\001\355\372\034|\2158\356"
+	.string	"\037\254\262\307\315\f\342\271\343N\034\246\275\251\266\035|v\374\034\325zcr\030\366\206\313h\231\005Jh\225=G\265\326\023\246\307p\361\211N}\001f\236w\352\223\033\266\301\220\270\024\026\334\214\006G\246\220\020^j\267\333\314F\023\220\241\306r["
+	.string	"3\215$\206\234\301\325bd2\266\026\227\027\013\262\233\313\fFF\303\305\310H\b\230\304P\303\311dH\022'\213\375v\017\353\ny\022ey\240\260}\371W\021\026U\370Z\272:\266\351\032e\2676a\255\265\212\353s\203K9`@\002h\351\206\r\330\276VD\031!\355\354L\241\240\353\363\314k\350N|\250+ `\002\031Ch\036~\261#\215\350\277\342\305R\202t89\301n\311h\211\275{\260\322t\240|a\023\226\031\343\314\311\241\261\206\332\236&\343%\333\205?Z>\230\236\341p\235H\204\235>4&\216\376\230\313\376_\215h1\026\252\035\300 m"
+	.ascii	",\r&F\316\313\327\204 \005\224\256\021=\002\262\213m\274QF\365"
+	.ascii	"RP"
+	.text
+	.section	.gnu.lto_servoDirection.93.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`<\001\305\r"
+	.string	"\246Z^C"
+	.string	"s\224\0168\251\251R\241\003%\254\033\350\214\177$\373\330\374\365\336\220L>\2609P\r +(}\030#B\277Eh\0248\347\265\031\256RA/\004\fx\004\323Q\352\225\327\337b5\364Gdo)S\nH"
+	.string	"E"
+	.string	"O"
+	.string	"\0052\217\266}\227\257J\366\013~*\274\267\254@\275\364\330]m\344\001\262Gx"
+	.string	"\331\243\266\274t\250Y\362S\016\035\270\314Hy\"\256\"^\007Gv\367\255\247\212w\312\004)\331]g\312\003q\307\333^`\033\202}\017\001\031\263\277.\225\305>\\]\261\377\375\231\263~\220\247\243\246\241\246\365\351\324\3645\"<p(\310\261\373!\006\333\033\261F\013o\370\013k\b\030\325\356nn\227\354\215\375\3318\360<\313/kvS\250h\354\256\001\007\376dP%\270t\234\322\207U\257P\263\027\212D\2271\247\252\036\025\223Q\222\247f?8\300:[\270\214\023\006%T&V\273'\004w\331\241\307\330r"
+	.string	"\n\230\253\303jw\023\300\370\013\006\237\305\243E\244|\n%{\274\276u\002\035\214\013\226)6\361t8\322\366`D\n\201>\033\r\236\t\240\006!\356pD[\006\316#\322F&\025>\027(h\240O\204\023\255\303\2114\216"
+	.string	"o!\017\247\215\266\215\3236\237\351pu\305(#\224\344o]sbGLr\036U\305vT\227\230\264\203\312\222\273\233\242\001\027"
+	.string	"\255\262+-)I\304\273vC\006\331\272\2115\364\330\n,m\037\027\353\343\204}l\266\266\274u]\030%n\266i\301\n`\004\344\003\303\202\n\255"
+	.ascii	"*G\251j\030u|kK\031"
+	.text
+	.section	.gnu.lto_servosInit.94.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\316\0025\026"
+	.string	"\206\351\217K\260\324Q:\270\304\302-\035\027\177\270\314\2319\237\262dK^\335\310;\322<\221\211\226&\361\321\334\036B\021@n\250_\342[ap\224n\341}\r;\360}\331\373\202\r>\203\356N\363\316\325\225\247\0252T9\2144B\210\334)\005|"
+	.string	"v"
+	.string	"z"
+	.ascii	"\343M\317\354\246\003y\365A\037\217QT\255\265\265*\\^\004\336"
+	.ascii	"&\235\235dU\232\244J\\:\363{_\2358\332ITN\344t_1\335t\357]\305"
+	.ascii	"\305\215\004-E\225\317\315\307\231n#D\327\023\020\335\177;\324"
+	.ascii	"|\212\034\320I\nt\225\210\213&8\0361\245\326j\342ltE\224\037"
+	.ascii	"\026\247\t\256&\2628!A\275w\332\203\263Q\252jPk5=q\271\273\344"
+	.ascii	"\266\215l\267\3304)\037^d\303\342\325js\311\370\214\227x\241"
+	.ascii	"\217\306pC\376\374\350\337\220\037\351\256\254\370\351\320)\227"
+	.ascii	"\324\346 \243?\277,!nX[\232\r\244\321\335\331w=\355\fy\203l\226"
+	.ascii	"y\337\275\032\251K\221\232\034\251\307\221Z\024\251w\251)\245"
+	.ascii	"\276\200\023\"\036\013\210\324\3723e\244\016\307\244\026\367"
+	.ascii	"\335>\221\377\263\211 \301\354\276\234\262\016\251\216\202B\247"
+	.ascii	"Z\201-\037\315R>\344G\024\336j\311e\340\013\356\006}\244\220"
+	.ascii	"\310\335\231\356\205\377\357\242\024\224\350\347\220\346\366"
+	.ascii	"\370\252\003\2771\242\350\021%\244\025#\207\r\361G\037\227\026"
+	.ascii	"1\260\326q\257d\302\266\264\003`\332a\264\273\363;\220\342\316"
+	.ascii	"\024\375\260\321\"\016@S>\201\264)"
+	.string	"T\240?\305-\021\206\030\332\226\346]\277\306\203\306\341\013Y\306K\364\247\227\310\217\037r\006\241\273{\236#6\315i\324\254(\260\035\257\233\306E\006\363\020\253\221\265p.\330\2742Xhix\311\334\264hb\262\226\013\001\3036\324\304Z80X\254e\002\3537\310/\276\241\316\326H\nP\333\301\003\372\323%B\030\253rg\006P\033\302\013\375Y\356{?\b\341\213rw\376\357\006t$k-\252\314]mO\371\246\377b\335\335s\310\325\262\3669\242\251\235\0225:eS\307aH\333\261+\301\234\360j\255.\037\351I\021,!\206\306\0047 P\202Q\246\354<b\201\325#\275mY\250k\260{\253\026F|\027\202p\210 \2061\315\212\371\2319\353\272\005\013\220\323\3202,\231\254\2749\031!\364h\253\2760\017\b\031\243$\312\037b\261E\344#c\213\245\341L\326#V8\266`\346\240@\2348F\030"
+	.ascii	"\302\200\016e\326\200\212\2537Qx\203\316\216\211m\374B\254\314"
+	.ascii	"l\\\370n\313\203\027<\312\312\031i\337Xl\316h\020\200\310\227"
+	.ascii	"5z\327\203\002"
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.95.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`c\002%\023"
+	.string	"\226\344\177I\320\360(\035C\245\177\"X\251)\002\316\302D\366\307\374\3156:k\017\237\200\001\t\273\3574\225\t\324vXx\347\333\376b\254\370\222\\_s\347\032p\341\005\347\305y\353"
+	.string	"\366\200\241(=X\330C\336\031\347\017\262\267\334)\005j"
+	.string	"f"
+	.string	"p"
+	.string	"\247\006>\340;\235\027\360\235J\320-[\307\305\233z\036\016\r=I\265\326pm\034\340S\274\251l\375\243se\313\337\371\001\3358\243\271\376\315\035\n\022!B\223\315\223\232M\215\213\22704\230\24493\237\363\004\2473B\204\026\233\313\303\003\002i2\271\027?\222\033g\264\231\313\017\006\265V\313\031\255\303\375q\333.\333\rl\031\023g}\376\211\367\260|\034_x\221\237\235\372/\337)\335\365HBz\311\321\026arm\366M|d7\27456x\335=WzWZJ\351\207"
+	.ascii	"h\032Z\320\2535fd\252B\264\005\211\353~\373\353\202))\303M\030"
+	.ascii	"D\246I\247\326\n\332\277\371\242\301\323\343\236k]\347\237\223"
+	.ascii	"\213\303\211\307\333aTk%9\365\310))\005n^`\320\021\301\204\340"
+	.ascii	"\345"
+	.string	"(\201\230k3\312\367]\355r\304\344\222\355\007g\201\342\200\306F\355VkL\301w\266\313W\244|\3446\340\314\270\325ZM|\336SY\371N\277\027\217@\206I)\267CG8\036\2736\333!\322F\267\214\217\344\277]EJ\344\246\326\327g>\212\247@\3718\247\226\220J}\247\266\312\202\374\314\262\007CH\266.;fA\335*%,\225\313j\205\025\266\260D@M\200\020R@\245\244B\225\025+,!`U\205\225U\330\242R\255BP|}k\276\363So\024z-\214\350[\233AJLp\267H\222|.\214\177\276\271\317\355\212br\351\263\326Zi\202\317\005\367\036r\343.\215\317\216\316\372\344\356^V\203\311\3211\344\2064H5\334\207\227\034}\236 \240\237) \220\002\2412\233\007\n\267\"b\315E\234\277\267\343\335$\004\323\374F\361\320E\214A\005L\315\356\263\225\327\013\005\326\354\371Z\\p"
+	.string	"w\320`\344m"
+	.ascii	"\326eU\352u\2323GS\214\340\226\205\007D\275\236\224u\225{\335"
+	.ascii	"5xiI\016\273\026\374V\276\020Uf0/\330\002\216c\"\202D\347\242"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_servoConfigureOutput.96.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\245\003}\032"
+	.string	"\3460\253H\240\232M:\234\347\321\315\321v@\311Lq\362\260\236\352\267\023,\2145d\f\301)\177X\\\215*\00456\3559z\365\276\256+\372D"
+	.string	"\353\2360\t\300')~\344\205\331c\301QeD\377\372\321\232%\204\354-e\222\001\227"
+	.string	"\212"
+	.string	"\232"
+	.string	"\247\b> <\235\027\020\236~\266E\273d\356\353\325c\315H\372\255\251\265\222\315cu>}_\312E\037\305\220\316Xs\321\236\241\210)y\271\217\257z\205\036\2752:\234\240.N\235^X\231\031/i\222\\HL\233"
+	.string	"L\023\024\207SDb\242\242\361v3(\f\fx\337\021S\031\220\247\317\361\351\261) *+\314O\030!5^\365\004A\232\242\270\347\0030*i\356;/\361vs"
+	.ascii	"\023U\371\252\263\022O\307,N\250\265.\227<\247\257\354\273\353"
+	.ascii	"\333]\237\335\246\n\374\222"
+	.string	"\233\201ST\227\256s;\345\310\222\257\376\333\304\325\230#\016\333=\223_\355\326~j_\254\026\277<\335\257V7\215\037\033(#\016\356\372r\334R\273\377\0311Rnl\357\330\ryyvn\365\2451o\316yq\232w6ye\2247Fy\307\311+2o8y)\363\316\346m\346\345\363\276'\300\225/\027\270je\n\266\251]\024\370\343V\337=\222\275ogOr%E\267\332\2551\3274F\301Z\002\253\265\372\234\356\2031\nz\265\326\240}\226k\331\260\034<\360K\017\341\351D\243T#\326b\313\372\273!\342WK8v\254\277\013\242\343\340\322zl\002\277\2447F\034\344\022\372\317\013w+\265\b^[b\377\027\366}?\021\247\034\335N\270\220x\263\245\366\017\352\205\201\305.\024\322\306\355\207S\021\372\351\305\370\224ZOO\n\355\237\036\263{\2006\272\367Q\236\025B\304\b\036\361+\315,\211c\225"
+	.string	"\002\332]\031\177R[\340U\353QP\223;\031\232\237:]\024\266\320\026\236v\003})\221\361.\213[\266o\r\002\321-\006n\210\210\204\221\002\205m\305\t\262\205\255\004\013\262\206#\"!\024\330\233\213!\034\t\343v\303\221\263\255\357\035\333\001K\227Q\353F\003\274k\001\003\277\\\034`\222\261W\233j\255\016\002\030\351\312\261\233\225\360\264\006\213\330 \344\001q\305\005@0\030\364z\2030\247yzy\207C\227\323\257\372\227\200E\302\226\332\034\037s\247\351\230\230\317i\255Dk\234\246\320e\3268\375\2447^f}\340\013\312\210\203\237\265\326J\177N\353\235\276\326\0235;\034\272WQ\221\341Y\237\332]\023\337\242!F\250q \001C\f\032\344\204%B\")h1p\002\031\242+;\020p8\2440\031\016q\004d\233\023\025\b\324\234\325y"
+	.ascii	"\300U\326\255\226\203bHB\231\252\205g\334\221\035\367\2102HO"
+	.ascii	"#\330]\347 \233\030C\251\347\032\225\n-\332,\371\341\224`\244"
+	.ascii	"y\324\367\256(\264M\267\264Ze\326\346\304\005\245\243\253Vja"
+	.ascii	"\326\310]\362<\372\305\343\220\347\247\245\004\005\f\330E\224"
+	.ascii	"7.<\021A\202\024s\332\306\013G\331 \250\002\007\223\377\220,"
+	.ascii	"\001\024\027A\340\271\367\364\270\013\340\301\231\b\372?5"
+	.text
+	.section	.gnu.lto_servoMixerLoadMix.97.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`.\004U\032"
+	.string	"6\357\245H\240ZQ:2\376\332]\322\325\364\217\347\257\337\353\316\330\254\237\366\322\217\363\256\273\327\225t)v\\\242[\247\365[\337\245\206{\257Z\b\233S0\nF\301\200\327x\340X\005\333\361dr\306(\264{\366 B\366\336r'\031\216"
+	.string	"\212"
+	.string	"\226"
+	.ascii	"*f\376d\376\356I`\347q\022\337\334\313c\027\345\336\273\303\f"
+	.ascii	"\306W\004'`_\351\007\330W\2061\223yOw\177$\304\307H\315\275\227"
+	.ascii	"l\037\226\005\234\366\316\264a\027m\035iO\030\237\350\n\234("
+	.ascii	"\325l2.Rq\206\215 \001l>\224\202T\031\244\003gL\013`\210\320"
+	.ascii	"\353(\364\221v\223\025\036\347\002\224\203V\270\371X\272\357"
+	.ascii	"\363\307&\233tH\320\373\2763\b>\325lA\237\342\205{/\317\232\355"
+	.ascii	"\306\371\346\314\\\204\23150\323\004\001\265W\376\313\276\336"
+	.ascii	"wz\305iIMT\254\233\316$1\323\334\340\252\306i\bA%\332M6\207\314"
+	.ascii	"=\331\354\034\363\017\320\360\001q\343\230sV\347\235q\316\373"
+	.ascii	"U\377\235\307\027\235\305O\266ur\355\311\224N"
+	.string	"n:y\366\344\023\030\020\324\204\341w\257\215\341\324e\252HB\376\373\2138\306\217\270qNF\200D8\302\t\272;\tc\\\ts\240\262\244b~\217\357c\325+3\027q\322(\003h\374\035\355\312\334{u^\371\301\370Z\0033\t\314l\342\\>D\020\336;cz\023\b\032B\204\025\321\007\236\3049\035\341\305\346\260\217\246\311\2215\265s\374\261q|\203\244s\272\241\246\316\305\376\021pN\262b\237\247\004j6\245N\357\275\227\212\235\323\027\n>\375\312\231G|K\231\341\247%\213\365b\3002\223\270\225\262\1770Q\252R\200M\355\f\3132\363|\n\253\247\214\220\244L#aT\354\245e>q(e\005\346\242n\022\276\204\231\305\237\244P\001\2511\004\265\273\367R\b\336\311\n\376\320+\267Z\314\007\214\242<\fV\211\236\2622\217\203W\353\205\213\365\"]\2408Q\2520A\366\224$V\220<\256\027\351\240"
+	.ascii	"\267X\260\\\244\213V\313E\252z\261\023}\234\202\203)\3262\261"
+	.ascii	"s\274\302RW\335P\243\316\307\261\355\322lJqm\333\327\3601\033"
+	.ascii	"v\204b>,\320\205\251\275\003f\332\224\246jv\354U_*8\244\335d"
+	.ascii	"`^p`X\217\035\267\335\020\337C\023\346\236?}\241i~t\304\346\220"
+	.ascii	"\273\337\264O+\"\236\263\330\331\335\247\021\031{\266\310\306"
+	.ascii	"\247\rwx\027\017\026t\367\006Q\250q0\204\224Q\304\030ED\204f"
+	.ascii	"f\013\323\001\320\002\231\242\255\003\021\2205Cd\264\304Zk\f"
+	.ascii	"pV\305:\225N\260\347\302\021\223\300\027#\272$\334U+\230t\021"
+	.ascii	"\0013\002z\347\372\035P\347Lq\353\204\rX1g\n\274\270\366q\371"
+	.ascii	"\364\333\334\331I\207Q{#rc\306@\262{\f\207\377\306\016\033q["
+	.ascii	"\b$\375\276z&\223p$\321\027\377\265\021\223W\274\3451\346Ga\375"
+	.ascii	"\200\215\252\370b\202\0345\344\231w(fi\020\321\022v\301\301\275"
+	.ascii	"zP\331\306\276\031?\347 L\254\353\021P\027\330\223\201q\334\220"
+	.ascii	"\232F'\025\376yvB\237\006"
+	.text
+	.section	.gnu.lto_forwardAuxChannelsToServos.98.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\335\002=\027"
+	.string	"F\255\234G\300\330*\035\231\363\371B,l\333\277N\345\032\360v\202j\224\001(\340%\252O\233\377\022\325f\nm\377\254\277\375`\027E\355D\267\224\357\004\273\356\301\377|\341\020C\t\377\242\003\233\356\2126\365\343'\204\354-e\222\001\204"
+	.string	"~"
+	.string	"\211"
+	.string	"\017r!\264\227\373\204\354qA\372zAa\2555\301\351B O\r\034%\236\316\237\304\323\335e\336e\320\200v *\266k\345iYRk\271`\021\220\247K\333\365\362\322F\035{IrE\304\324ZS]c\001|\226\337\311\264\323\331L\333\007\375"
+	.string	"0\213n\327s:\307[\213\034"
+	.ascii	"v\267\211C$\034\372\357\354\263\263\361\334\361\363\376\357\b"
+	.ascii	"\200A\335\356\347<J\250\265.\353v/\276\342w\327\265\273\034v"
+	.ascii	"\233&#\3668N\267\304\213\257;\335\277\304\323\367\350J\2261A"
+	.ascii	"j<\334-m\334@\273\307\261A$\334\246\261\213:\220\377\024\200"
+	.ascii	"ym.\364\2551\335\367-\275\374\222F\336\231\221w4\362\222\314"
+	.ascii	";N^q\362R\221wR\336f^\236\274\027p\352a\005\303\227Z[\f\311\324"
+	.ascii	"*tH\307}\277\320_\276w\377\363\375\214L\271@~\310\236\210\320"
+	.ascii	"\354\025Wg3zR\204\265\226\025\310S~\320\2226\343\0170(\200g\217"
+	.ascii	"\275\273\241\003_\267\006n\335\263b\217\247\246-\366q\274R\323"
+	.ascii	"\236erE\335\263\017\304\tk<\344\271\023\017d\255\025g?\364&\037"
+	.ascii	"@\344\344\210\247\335\021zC5\036\256\202\223:@\377w\n<\200Qp"
+	.ascii	"<\033\017\273\177Qn\273n\240}\"r\333\364q`l<\334\232\346\276"
+	.ascii	"\t\243\363\340\214\241h\001^\211j\265\263#\236\326\364\211|2"
+	.ascii	"q\322\305\307\333\324\007\346\212\266u$3\262\326\025\016\366"
+	.ascii	"F~$\262U\214\305\312@\n\221\303\262U\214\305\312@b\345r\351\360"
+	.ascii	"\250hR\254D\270,h\220\305`-\226iU7\261\027\n\330*\226\222\361"
+	.ascii	"\354\264H\260R\256\226N\211\224\n\026K\335\024\330\227\211\025"
+	.ascii	",%{\275`)RY{\323h\342\243J\255m\264\201\366\301\215F\365L\006"
+	.ascii	"\217\023\274\324>\377\375,\266\310\310\021t\022K\214\"65\251"
+	.ascii	"}\366'\304\231\236\300e\005\023\355\250\311\236\351\001Er0H="
+	.ascii	"j\002\300\334\017\233.5\331\224J\256\207\215\207\237\265\326"
+	.ascii	":\025\274\324\250\0161 p\002\241\272\353\235\322\356(\262h\376"
+	.ascii	"y\241\266\363V16:\222k\177\250\306\264\006\325\226\203^\325U"
+	.ascii	"N\b\344u\264\252\353\354\013\376\017\317\262P?\032\340%\361\220"
+	.ascii	"E\331\265K\350\3550\331\300\204Sy4\036R\002\365\253\300\006\243"
+	.ascii	"\255\241fO\303 \234\353\030\325\t\207\204\256\334@cTK\350\214"
+	.ascii	" \343a\202{Q\212@[\250\307\357M\244s\231'"
+	.text
+	.section	.gnu.lto_updateGimbalServos.101.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\301\0015\017"
+	.string	"f\\cD"
+	.string	"\221(\035-\377F\333\224P<\\\320TFq\023\245\r0\273$\017\313dS\275O&DP\256~U6\354\263\003H\331\355\265>\323\3742*\b\b\372\006\237\330\222\362Q\222\371\300\337\330,!{\023)S\nK"
+	.string	"M"
+	.string	"S"
+	.string	"7\341\007/\227\335\335\016m\023{;\314\315v\246}"
+	.string	"\301\351/'\326\335\225\031\027\273\037\310\006\264C\237\354\032\377Dl6\202\207\nF\307\356r\032\342\247\347\311?\353\234\225\n\3123[\260\273\316\225J\207[o\233\200m\005vB\b\377^ GM\t\027\246\327N\f\r\325\013\2257\366\227J\005a\037[e\261\263\364'K{bz\203\351N\226\346di-\2463\230\216\177\371\261L+\226\316L\037@"
+	.string	"\233\031\rd\354r\270\261Y\032\350\"a\373-\3545\363\023\377L\002g\035\272\304\330HYI\345\215?\332\342+\034\007\211\036\375\350U\036R_q\026\021\374\026K\020\021\211\207\036\205,5;>|\344\246W\377\013\211\362+\017\330\240(\356\350\246\240\224\033Gq\025$\332\356&\360a\236b\344\267\034\332\002)\277\"\305.\036v4\032D\024J\03080\225\274\321\310\207C!\245.\203'*q\246\n$\243\013#\\\311h\002\211\013y%.D\200;\f\"\2173u\235\307m\037\352\254k2=hP\2322'F\036$j\312\201\241e\252\352\267\242f-\373/.\343z\324\267RUA\252\327I\30445& \260\002\031\262\351\001G\02494\030\251\314"
+	.ascii	"\326\205\273\330iyS\030\\E\216\31173.\326v\302$Kd$\266)\0173"
+	.ascii	"\270\nxLj\317\240\345\251\335/\272\343Y\273\320v\244\333b\270"
+	.ascii	"\n\354Z\0069\311ng+BF.\t\2605\225o\016,nq\255'"
+	.text
+	.section	.gnu.lto_writeServos.102.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\331\025\245V"
+	.string	"J\217\354\036J0R;\031\016\340\206\363\266\224\223\276\365\rlg\260\337\307\231N\312\353\224\270bz\343\\\244V\370\301\n\2655\363\276]tp\244\236\352\241#\331hgq\036"
+	.string	"@\335M\307q\005:9\356\370\"\237\364\033a\333M\366\336R\246\024\332\001\257\001\367\001j\245R\235d\244F*\325G\242\0328\252\177\245\332\364\251\215Ju\351S\373Nw\217\244Z\274\231{G\265\212\352\277l\352L\035\216>\347\351d/\321I7\302u9\335\217\347\227\373\315\\\264o\021\336\203\177|\336\306\330\267\263\353\330\300!\233\323\343\2553(\217\237;<x\353\344\371\031\177\207\307\335\316\360r\256Sz\225\225np \223w\236'\002\345G\022\017\222\037\3057\221t\350\240\301\311\311\211\213\263\007\355\215\017n\344\332\004\201\366&\267\246O\232\021\020\332\321\334\315\376y\204\237\361>\3013\364\321\036\301\376}Dz\233\1776"
+	.string	"\201\341\315,)\3175\037\033-hy\347\351v\365\321&\312\217C\033\357nX\316\343@&v\203\241\363<\2616\206\262,\243H\2224-^t\273\223\304\341\251\246\244\242\240\236\202NMLKJIHG\300\237iT\372\310Q\\a\225\016}_\326\035\24213\257S\225\371T\23162*%\372\232\224\361\271]\031\233\270B\b@i\257\333\242Qc\016\325\345O\242\211\2749\204\202N\270\214\335K\031\027\r\332\225u\231A\235\306\274\311\312\231\2263\211&\252\340Q\341veZ\304`\335\013A|I$aW\226E\006U\022\201|\276\244\035\020\345\r\237\347\251\242I%\256\234\261p\2444Gn~3`\234\237ht6\307\206\333\225a\021U\374\341\202\346;\274\204\227\262(j\372\262\256\234\245\335\350_X^\302\375fV\316\320\356\363e\321\371"
+	.ascii	"\206h\260r\206\345$\224\217Hfa%\250\3703\013\023I\264]\233\230"
+	.ascii	"1\321M\273PYxU\033\225)f\304\244\230f`dy\236\347\255\224a)\325"
+	.ascii	"\227u\236"
+	.string	"\247u\314\354\354\026q[\215\330\266\300v:\n\256C~4z\222\303\030A_\272\347\367\260&m\254\"\257\366m/\t\251\271\373\253Hq\257\326*\206\006\246{\266\226\240aK\374-\236AC?Fc\317&\013\332\227\356}\331\230\360ETB\352v\251\361\303D\365\f\245v\r\033\3721\335\244\2702\277\373\333~\003\f\235\227*\332@\277p\325\020\335Y^\252\310\177\225\325\313x#\0349\251k\221{hQ\327\"\023\371\212\2147\n\n\036\362\365\234\360\020\362\013%\301\031\302\027d\274\021\217\034R\236/D\251\345\217\217'\266Y;[\360\343\003a\274\362\327\"?Z\307N\262\264\265\037l\343\215\211\320\316\323\353Ut\354\034\340\343\367`N)\272\310Mj\347\320\241\037\373\"\305}\331\3614%Im\037[\3721k\234\024:\260\365\262\335\300t\325\354\257\020\"l\315\013\203m\252\225\230\352$\246\032I\251\356\372"
+	.string	"\250>\362Ss\231j#\246\272\bPM\344\247\366\300Tw`\252\207"
+	.string	"\325B~\352 \246\032\210\251\336\002\252\177\374\324>Lu\017S\315\003\250\346\340\247\336a\25270\325:\200j\r~\352\034\246:\003S\215\001P\215\343\247\3262\3257L\265\r\240\372\202\237\272\206\251\266\300TW"
+	.string	"TS\360S\3230\325\023\230\352\031\246Z\202R-\003\250\216\340\247\216a\252!0\3250\200\352\027?\265\013S\375\200\251n\001T;\360S\2630\325Y\246\272\001\240\232\201\237z\001\005\022PA"
+	.ascii	"V\n\024\244\372j\304\361\310\335UB\252)\251\250R\r5\252\237J"
+	.ascii	"u\020\250v\372\251\233L5\223\251^2\003R\213B\304\032\355\363"
+	.ascii	"\\$\243G8F\315\nH\035\3549d;X4DH\232 +$\r\"\275 \3734F\f\025"
+	.ascii	"Y#\204\212\020q\363`\211\270\r\021\310\203\275\233!\266\243\f"
+	.ascii	"\362\\8\006\233\001\036\0068\026\305}7Z\213\303\r\020~\264\366"
+	.ascii	"n6\370A\274\025\251c7\330\243C\203U2\367\333\344X\r\332\330J"
+	.ascii	"\247vu\232c\337\246\207\236[\221<\266\307\035\036\034\274\355"
+	.ascii	"X\016\336l\215S9;\337\261\177\003B\307"
+	.string	"\212\334Z s\266~\254\361\261?\326\330\372F\343\300\261\217\375\232AR\200\253\346f\205W\260\026\264\251\200\20284\226\20287\254\241\261\217s#\215j\271\215\275\341f\343\20275\366\2027mfj\354\337\004a\307\354\267jNJ3\"`\237E\f\027\241\222\035\022s\306\bk\320\227&B\223\225Uf\rj\374\274\200:/0\363\304\253\226\2001\320\035;\023\3240c%\330\t\300\314\330`\0264\031+\301^l\221oO\\\306\036\211\263\027\226\b,\202-\327\277\023c#\270c\037Q\032\326b\354\357Dm\271\377#\266\350K\310\250\305\332qPX\225\252\365\355w\270H\346\316\234\330\242/\335[\023pyT\214V\355A\031\274x)\037\230A\351Vd\213}@\206\026\016\354\211\373p,\326\0018[\3254\206+\"\213=\034\004/\224\267\"a,\004-\300x!\307\305\276\220c\253\024\2452e]\354\345"
+	.ascii	"2\343\354\370\2626\312\307\002\221\270\025\331\300f\355\305T"
+	.ascii	"x\242P\206b\206l\3032\3032\344\307\006v\204\241\320!\264\022"
+	.ascii	"\312\300^\335\2473D\303\202D\t\353\345\005\226\201E\021\226w"
+	.ascii	":\266\226\351\231\213\322\254\005\371q\201=\235\013 \250\020"
+	.ascii	"\033\334\227\356\221\253\346\202\264\255c\212\202\213 \226\363"
+	.ascii	"<WX\311\364\004\030\376\226\217\216!C\006\371q|\0262\344!l\375"
+	.ascii	"0\022\303\264\217\024H\270@\350\332B\202\225DH\220!D\200`\031"
+	.ascii	"\031\302\243\b\226\217.$X)\250\314ud\253\013+\t\027W\027\326"
+	.ascii	"\317\355\353h\350\276\026\214\352J\241\242|\260P\242\227\273"
+	.ascii	">b\213\230\354\346n\230\212\022\356\007Ov;\317'\036\304\320I"
+	.ascii	"\255\232_w\001x\200R`\3354\356\210%3\024\325Zl\332\025\216\371"
+	.ascii	"\b\355\002\246\313\1771\312Ih\206\231\203\367\224\300Z\f\n\227"
+	.ascii	"j\311F\254\002\373\272\213z?\314)T\tu\332\340\332\302\r\n7\201"
+	.ascii	"\025\3774\255\323\376OX\036\225\235\322\264?>l\330\340\334\203"
+	.ascii	"\023B{\236V\315\037\212!\231"
+	.string	"vkXZ\245e\332\213\241m\224\245=\233\273\244U\032\261'\236\264R{\256[\326\254@\t>\212DZ!\0301C)\013eH\205\0040kU\314\234'\023\025\367\341\311\220\205Q\317\211\017\200\314\234\347\271\342\2437\205Ua\350\302\360\205\241Z\f\344G\244\275\335\261\336\336\330\316494\307i\325\254KW\177\335\313Cs\3160]}\\2\213KS\253L*v\227\314oZ\024>\265*\026\307\334\336\225\036\255=\3242\234\201\311zyj\217\326\200\271B\0014\271\002\004\323\252y\274\026\t\\\325Ss\307D\365\200`\354 :\332\222\230$\265zW\246\nP\374\022R\225\355\026\315\250}\230\270R\277\204\324\2730MH\345\362\251%3\330\177\333\303JI|H\003i\017\277\f\303\350\307~?\301\016\":&}\256\264j>`\f)\305>K\033\227*\024\027\261d\207\332\316 \241\250R\266K\371D\230z"
+	.ascii	"\274\351\240(I\304\246x\261\246G\311\232\220d\221\254\222\rK"
+	.ascii	"\322\265H\214\366\304\273\216\254\271\376\034\327\036\231\263"
+	.ascii	"\211,\330~q\355\347\244\326T.\017\201\265\250QL\004\231"
+	.string	"24\"\"\"I\222\2445\321\005\304 \245\230U=\021\2600\206\024c\304dFAAA\222\f\273\001\214\375IU*\004;Q\202\n\024DL\237\367no\320\234\213J\346\034&^\002z\306\315\212\377J\031W;t"
+	.string	"\261\227\262\016\373\365m\\\245\271\227\217G\364\344\263I\016\3031a*\233\355g\025\250\247mY\007VU\005\202\2076\217\311B0\036\354\303c\tD\002&\341\311\021V\342\007Y?\336\230\306\275K"
+	.ascii	"h\243<\004e/W\304\356\266\217\240\264\310k\005[\376\035\341j"
+	.ascii	"\267\r\332\367\360\207\375P\357\006XX\320\223\345\364\307Muu"
+	.ascii	"GY\325bM\246\006\306'\360(K\312b\203\023\275P\304Q\256\037\357"
+	.ascii	"\365\013\024'\215&\370*M\300\322\2048\223\252\035$\n-\035\306"
+	.ascii	"\313\314k\365I\310dU\252\032\021\320\033/\232\235\223\245\317"
+	.ascii	"\311\260\227j\341d\253\240>\357\030\234\214\177\247\343\371>"
+	.ascii	"\365\361\246\260\364\361y/]\340D\314\267\233\351\006\0235\020"
+	.ascii	"\326\323C\316\017\035h\267\257\227ne\216\347\367\231\371\022"
+	.ascii	"\331\275\017\203\362t\020\260\337Fm\025\345\213\233\234\007\365"
+	.ascii	"R/\235\300\260\335Fm)\352\232i\030\271\373\367\352\r\201\221"
+	.ascii	"&a\300\366f\321\234\273F\301"
+	.string	"\324\272o\261s\362\021rc\300tk\346\021<\\ \340\324z\013\214\361\337\2277\242\342\340\344\340D\377\234\032\211\036\031u\263N \270Mt\245su\356^\024E\320\274\001\367\252\017\373\271\003X\310\353\003\227\003T\307\020\303\257\203S-YU1\345\233M\370\266J\202\021\230[\311H\372xG\330\202\232\324\375\342f\275\337w\t^\210\313\257\213xf\357{\301\335]\004\255\357\243F\361:\377\353\024\254tB\b\224IL\373\rc\312\b\245\221\221BB\270\30317\324\342\n6\031\236t\367\033\330QF\343\034\001l\"<\036\317Jo\205\332\275U\022\035|\224\215FX\254\032\363\250Kms\321\f\002\200I\320\231U\267\322\373Z\360/\256\255\276p\235(x\036\023\250\003z\003\244\306\344w\262z\\@\227\231\002\f\277Sy|\r\211N\2044`E\200\272\036\226G\271C\3738\002\331\207b\377p\001_b\256"
+	.string	":dP\341$\020y-\246+R\321\256\226\272\210\037U\\X\252\310\240U\006\275\030E$\330\321\004\024[\241j5v\324\262\223Rv\335_>hIm\267\013\334+@"
+	.ascii	"\r8\305\330\001\235\344\026&\\\232\250\277\233\027\035\037E\037"
+	.ascii	"\035\272\214\0045\241[oDh\357\214\220f\201#&_Y\177Xp\203~\033"
+	.ascii	"~\250H\271\223+\"\215sCc\261\377\323\320\227\007\276\3300\315"
+	.ascii	"\031\003F\023%=\321h\272<\323\231\251\366\322\351\334\246\016"
+	.ascii	"\365\312\326\207\240:\323\274\271e\341\267\f\337.\003\227\235"
+	.ascii	"\231i\033\321g\337\271\252\231\03236\245*\324\324>\324\337>\277"
+	.ascii	"$\264\032c\231\242\006"
+	.text
+	.section	.gnu.lto_servoMixer.103.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\177\036-\206"
+	.string	"j\335\\0H\020PKg8m\217\233E\003\330\006\352\222"
+	.ascii	"\347\375\302\3244\210lt\266lA}\216\301x{O,7\f\030\332\273\202"
+	.ascii	">\\D\372\347\245I\223\343\345\274!\247\205q\201\353ZQ\037\352"
+	.ascii	"\331\256\267\3314=\021\021!IJ\031\350\002\300\002\021\003\275"
+	.ascii	"\004\244\275>\216\275\003\034{\005H{\223\322^\244co\217c/\217"
+	.ascii	"\264wG\332\253\343\330\233\243\330\033\300\261\027G\332\013@"
+	.ascii	"\332{\303\330k\303\330[#\355\245\201\366\316@{\217\322^\243\264"
+	.ascii	"W\006\332\033\003\355-J"
+	.string	"{\211\322^\030\307\336\027\307^\027ho\213b/\013\264w(\355\025\362\351\rJ{\201\214\275?\306\336c\332\353c\354M\215\275\306\264\0275\366\026\215\275+\322^\242\261w\230\366\n\215\275\301\264\027h\354\375\241\275G{\273\330\313\234&\003O\034\026\334\326\325\312\236<+\034 \233\030\236c\216cNcVc^cN\202\231\r\363\031\363\223W4;\271\270\313\305.j`u\373\247\022rxn\231\356\211%\216\263@7\270\245\345'\266\270\304N0\255\241\313A\203a\234\025\322\275\301Y\003\303c\240\356\t\267-\021\355\354\255\310\\c&\330\315nq\235p\333\372\2709y\302n\373\033\334\226\317\270\315\356\f\334\266B\2726\260u]\323,\033\301G0\022\314\306Jl\221\315\323\021\324qU\336Qy\255+\331\021\037?TN\342i\270z\t\323\304T)\262\006e\255\006\274u%C@\ry\024u\\\245\254\330"
+	.ascii	"d\310@5\274F\3454\344pEbH%\306\212\217!\003\217\315AA\264#\251"
+	.ascii	"\343*%f\212\327\f\273E\006\3562\331r\031\032.B\345\347\266\r"
+	.ascii	"\241\252\206hj|\002\f\031x\364#\362\330\0269\214\305TvF\031\256"
+	.ascii	"H\030\t\002\f\336\272\256;\030\270:\206\fd8<\024d`\021\007\005"
+	.ascii	"\031\250\356J\301d\\+\253u1\315\360\254\353\232\364/3\216G\242"
+	.ascii	"\035\362\217\214\227\370S\231\306\214##\0311\212j\020\301x\341"
+	.ascii	"\242\005\213!\241 \240\237\243OjD\213+l\020\207\302 \360\367"
+	.ascii	"V\227\307\230\006\037\335\224\025\024\323X\003'\254g\250\341"
+	.ascii	"# :.\243\"\332\226:\\\256\322\260\214\261\257*g\307\220\253\032"
+	.ascii	"\243\023\353\"5\\\343'\224b%\f\313U\245\375\202\354\341\2611"
+	.ascii	"Z\016M\264uu\206a\274\020\016A\343\341\235\273\251:\\\256\314"
+	.ascii	"\260\0130n!\306\rX\263`6\353p\271\n\303CA\264\t\323BA`\030\350"
+	.ascii	"\247#\353\r\007\226\253\372\3417\024\247K\024\374\006\246\177"
+	.ascii	"\200\350\352\243\017\027\017\235\n\207p\271\002\202\215YJliT"
+	.ascii	"\256\252\371;*\262\\\225\016h;\364\n\216:\3036~B\033\252\346"
+	.ascii	"X\256\312\210_\220:w9p\031\317\370\252\302j\342\214\255+-<\344"
+	.ascii	"2\006\006\301W\207\313\225\026\026f\341\340\262\201\251\025\363"
+	.ascii	"w\264\256k\321JJ\377VXe\341\377\206\254\204\231J\255\244~:\360"
+	.ascii	"\222\270\303c\334TV\312n\341\220u]\267\247\254\256xo\360n\227"
+	.ascii	"\355\356\226\335\"\240_\324\256\256 \003\211\356C\004\235\236"
+	.ascii	"S\bc\350\305a\270\370\213\003\325\226v\200\356\342\034D\021\307"
+	.ascii	"\354\373\261\275Y\013^\253\305\207\336v\3177\026o\241\202\351"
+	.ascii	"\034\324 \206\353*\005d\033\253\265\250b\204P\307\214\t2\220"
+	.ascii	"\305Ym\216S\350Cgf_T\357Aj,\310\306\241\257\250C\250e\324f\363"
+	.ascii	"\224\332\f2P\350@\272\230\250%\226\005T\n\006\275\211F\037\255"
+	.ascii	"\254\212\005w\325\261\006\232\247\202\2366q\005\216\324\241\026"
+	.ascii	"\350?\007\372\217\316\361?\027\302\325\260k\006t\025\"IT\307"
+	.ascii	"\033\347\342\364|z\244\367\371O\217\361\351\205z\230\273&\244"
+	.ascii	"G/\211\024\300\325R\214\367\331\212k:\321\342\3215\036\243\305"
+	.ascii	"\b8\353\272\277u\215\252\261\342\305\013\351,\277\224\0174\324"
+	.ascii	"\256)\300\265\256+\220^\211$\325\365\361\036#\022\0349\022d\340"
+	.ascii	"\212\373,\337\3509\201\326\354\235\371\021?<\361?:\254\307|{"
+	.ascii	"\333\026d\340\360\306%\\S\330#x\341\177zz\360\235\274\340\215"
+	.ascii	"[ozl\300\217!}\270x\312\316\357\300\377\362\226o\242z\017\017"
+	.ascii	"\266\263k\303u]\203,\343q\235\n\226\201`\340^\220A\0067byk\262"
+	.ascii	"\335x\263\216\371\265v\315y\214\207rO;\251\336\333^\031G\220"
+	.ascii	"\317k\276\315\304R2\024\034\005\224e v\203\016\232\247:\b2\220"
+	.ascii	"/\334rkbE\365\236]2e_k\227\203p\355I\261\367\262\273FM\232\263"
+	.ascii	"\262'\231\223\323xY\214\325x\215\227\317\230ir\022\274\f\306"
+	.ascii	"lx\271\f\031\241^\366\n\023\324\313`x\216\227\273~z\371\213V"
+	.ascii	"\027-\034\307\313U\370\214\227\251\370\311\313Si/S\231\302<\366"
+	.ascii	"\362R\n\332\313Rh/+\321^\216J{\031\n\355\3455\250WE{\223?\275"
+	.ascii	"Q\322^\032\216\2753\034{e8\366\"\323\336\030\320^(h/\fh\357S"
+	.ascii	"P\257\023\332\373$\355mB{\235\240\275/\240\275L"
+	.string	"io\023\264w\t\355u\001\355m\001\355e!\355e\202\366.A{W@{U@{\225\244\275I\320^$io\ni\257\022\332\213\302O\357\t\307^\023\216\275%\240\275$\240\275#\240\275\"\004\365\206p\354\005\241\330\373\301\261\327\003\264\267\003\264\227\003\264w\003\264W\203\240\336\f\212\275\030\244\275\027\024{-H{+@{)\360\351=\002\324;\001\332+\001\332\033\301O\257\221\264\267\310\261\227\310\261\027\202\264\367\201\264\327\201co\003\307\336!i/\003i\357\002\307^!\307^\005\322\336\004\322^\004\216\275\007\034{\203\244\275\006\244\275@\216\275?\216\275\005\244\001\033gE\256\b\237$O\341\374\005\226\004\311\201t\230}W\310\241U\n'~9\242\311\226*\335\n\322\3505\334\206d\023-$\341\340\332\246\3548y\f9T:\221-\n\354(\234\277\364\334\326\311\203\231\322\330v|\302\231K2\356SO"
+	.ascii	"PQ\2257\246\234p\242\233\021&\234\305J\270\t\347\245\027\t/\341"
+	.ascii	"Q<\302I\020\341\033|\204\007\345,\277B\270\bq\276\224r\251\020"
+	.ascii	"\364\234 \234\303\336t>\270\007\007\341|\346\037\234\227}\035"
+	.ascii	"\334\203\2770{\202\203wp\027mK3\033\\\203sp^~)\317|\203\007\345"
+	.ascii	"0\3732\270\006N\034*)'\251\356\253\252D\342\332\223\301\213U"
+	.ascii	"\240518\363\316[z]p\f\350ZO\022\212\377\020\227\207\357\202s"
+	.ascii	"[W\005\267\340<\247\365\222P0\205\221\311\n\3437\273\311\271"
+	.ascii	"\306\223\244\323F>\344y\256\205\335\351*\222w\311:\311)\222y"
+	.ascii	"A\006Vp\003\346p\231Sp\306\302s\307\354\253\242\251x*`\nU\211"
+	.ascii	"d\007\354@\267\263\2463\251\327xO?\270\356TeR\235\024\\\346\254"
+	.ascii	"\004\337p3\323sv\236\261)&\332W|\344-\305\323\316\201\236\340"
+	.ascii	"\273I=\311=\315SG~$\301'80\217\331\027\301%x\021\035#\217\340"
+	.ascii	"Ef\314>\306\"\346\316\225\342S\320\310\233\236s\244z\017\252"
+	.ascii	"\347<\331\250\353:Ui\024d\256\351T)L\225\n\225 \003\215\234\321"
+	.ascii	"8G\026\263\246\363hnR\254V\\k\331\306\275\254\320\315\220\323"
+	.ascii	"\374v\302\035T\273\346\344\275*\252\250\020\257\305S\3474\227"
+	.ascii	"\341.n\231\205\f\356n\024\273v\002\351\303\025\247\345T\252\032"
+	.ascii	"T+V\312\370\306V\037\030\025Q"
+	.string	"\275\347/\342\210+:\f\213\304\025\211\274\b\004'\362\300!Hk\270\267\007\364\034p\263\242\201;0\344\r0\360!g\275\204\033\003'n\345i.\320F\024\362\005\024\270\220\004\256"
+	.string	"\232f\303\226"
+	.string	"\002H\f\0178\002A~\200\001\017\322G\250\031p\342V\025M i\302\274\037\007R\300\177<\370\002\324\244!\340\304\271;z>\316\202j\003\334\207"
+	.string	"\037\340?=I\027\240\313\236I'b\271\323DB\003\204\353q$\036\357q \334\322k\307y\2149w\234HD\236\036\233\216\260\337\333r\\G"
+	.string	"\307\361\034^J3\315"
+	.string	"\016\004\200\343(C\004"
+	.ascii	"'n\3455\331n\334\306o\234![W\026R5n\343B\263\245\227\262\277"
+	.ascii	"\332\253\205P\255"
+	.string	"nP\257\\\t2\260\306\213m\3504\331h\2041\3168\215?\257\265\270\275pw\341\346\302G3\214~\364\237Y\226\006\203\024\302\365\203\332\345G]\227\321}\266\242h:e\364\027\036C\032\271P\336\266);1.\343\327C@\237\n\032\252\244S\234\340)\372\256\252\203\272\245y*\306\177+\326\241\226\350E\377\2511\373\242T\036\272\007\244\220:\325\207\346A\355\002\204\201\333[:K\325\n\273\004\351\311\022'\245\245\244&LKKLH`\354\222%\246\246\"I\232\224\24041\025a\342\300\005%M\232(-A\"\344\244d\205&%\247\340\022S\223\n\277%NI\230@9\241\330\204\311\322cPZ:\023vzz\241\t\023\340\"Az\302\004C\223\222'INKV`\342\202\nIM\230(-%!iz\222\204D\264L/(iJrbbjJ*\222E\361\275\254\tzp\242\256\334(\277u\345\302"
+	.string	";\231\307\370\007\257\b<\032\327Z\241\233#&\363\333\325\330\301\\\245J\213\021sB\207\031\327\332\006\"\317\006#\326B\004\233\342\215\f\356rVs\252*g2\227\201\217\3127\r\351\303\265f\312\231\312\2319%K\251\346\314d\251\363\362\027\306\347\306\354;J\242y\232$\024G\266\3640\007\355L\313\211c\224h\302\215e\2513\332(d^\366'w9Q\353$4\357\230}+\307\006=O\031]\347/\357\276\347\363h\236\206\037;Y\322,\211\226T\223T\363\345\3546\247kL\032Y\214k\355\036f\nr\327]\3540\305\323\256\353=\267\311\264\207%\327Ne\207:\2733f\346\300\234\351\370'\304\rjMV\236\245\336mK3Q\254|\020n\371\005u\216\002C\016\313@]H\027\233z^\337t\324>Dr\215\004\261'\344v\243\314\235\314\230\344\235z\206\303;\320\336\364\300\024\341\325\270\227-\376"
+	.ascii	"\203\317~;\033;\250\250\236\374\003Q\236\274\327\205xJ&\221d"
+	.ascii	"\303&\310\300(o1\007\353GDu>;\223\301\203\3267\300\270\326\023"
+	.ascii	"\034\006\031\203+\bF\343v\212ye\205Q\261iY\370\246^\264\350\263"
+	.ascii	"\033\026N\316N\032\016\0069\304\365\303\f\247A\206#?\303y\231"
+	.ascii	"\245,\273\f?\034\263/\206#\271\220\303\177\211\341C\316s\230"
+	.ascii	"s\331\235=\267\345\227\322\305\013\207\362\346\253\222b\266\270"
+	.ascii	"\326B\3012\304\203\271\rO\300\024\303\\\023Bb\016s*(n`8\0243"
+	.ascii	"O\177r\030^\324\266\374r\372S\333\265\222r8"
+	.string	"\017\227\027U\311w\352\336\305\351\234\247\313\331\364'\177a\346C\017M\347\270.\266\250\260;\021\373\013\300\275=7&\213kI\r\335K\322-\310^O\341i\307d^\017\2661\261\314\234\233L\347\301l\346A=\313<\3126\233d\342[T\261\b\266\200-\361\035\256C\362\216\3330\331\271\r\347P\2725\235L8\350\332\224th}S\204\256\265!\020\001tb\017LXq\271\373i\341\374<\325n\023-X\3177\311A\267\366\244C\013\272\321\327\212\006\350Z\273\364\306\215\205\245\007\256&\234p\341,|\311\313\205\023\251\265pfaO\022Z\035\037~\016\b\343{\276\221\352\275#\223cA\336\340\272\302R\316D(O\311\227\234\245|{I\305\nW\341K\0164[f\235\360\025N\244\226\302U8'\271\222\263\227\336]\202v\250\342\030!\020\222\026*D4\"I\222d\230\003\362\n\020\b$\201\332by\003\022"
+	.string	"u1H\223\020\225\2204)(\244\003/\202\340\034w\310\316U\362\203i\001\252\246\377\322$\0023n\237 \357\207\321\330"
+	.string	""
+	.ascii	";R\205\344m\354\373\252^I\310C\037\3712H\026`\302\036\213\037"
+	.ascii	"\344\202\2224\004s\306W\274\327V\033w\304\307\376f\321\352C8"
+	.ascii	"\241\361\250\037\334A$"
+	.string	"f\250\032\352\365\241\251X\264\013w:\005p\236\216\005\206\311qK)\316\230\fR\024#\232)\233\274\305\344\353\245\266\n\001 g\260\371_\332KQ\232\321\306\303\037]\342\301`hw\272qEc\005xD\211\024\275\213\t\340\244\033r\202\236c\242*\304*q\226\370Z\211~\242d\276\345\322VR\232\267\b]j=\n\225\220\276R$\032\236o\251\314\301oC\b\340rs\\\262t\223\030l^\302\332;\374\324m\340\n\350\335#\334\341u!H\2143\t\f5\354\266\202\337C\232\334.F\256\021H\201$&GW\346\004\016jAD\234B\330\357\217%\222\021\340d\376 \251\237e\013\034~\326\217u=/\324\261\232\357\036\361\200X\371\262\363s\356N\335eH;h\232M5>\363\272\363\211\344:[\206?#\027F6G3\032\037\317k\2262r\252\013\004\264\253^\177\202\335\245\356\367X\026\320\2419\316\016"
+	.string	"\005\301\230j\372Z\fp"
+	.string	"\211\204\200\265 \223\253\021$\237\374g\370BF\334\263\304%m\262\237\322\231\326\007\306\306,vm@\252o\235\030\321\262\032\256_+\340y\262\240L\232\202\001"
+	.string	"DD\225\027\t\211\367\236\344\026+\214W\306\243\310\254\312Nu\302\315\344HA\3718z\032G\250WDz?j\365G\246\034\372\030\270\210\037\325x$\2732F\307\025\001\204\315\032\343\367\304u\222\205\3205l\n\214\274\207\272\030\021\363\276nL\026Jn\020I\231\242\221 \341J\327z\315y\313S\256\254\200\f!\006\b%%\033\250\374\201\345IoP(i1\034pg\212T\222(\377\367zsJ\367{LQ-xO\225\035\245\021\270\356D\203\234\234\244\226\274\037\202\242\276\276t0\341M\237\326\240f\273\006\343}\247\234\021\376\033O\201\365\224\375\025\022\363:\217\315*!\205\366\222\314_\273\0350\\\2367\300\375\332\265U\237\233[n \201,Y\232WS\317-\r\020"
+	.string	"\213 "
+	.string	"F7\034\t@\300\260\n\320\003\250\177\303\354\312\026\037\214'\013BcxY\354\320E\350X\007\252\007\335\221t\bN\343\236\323q\2278\003\312\351\275\220w>\033\226r"
+	.ascii	"\031R+qC\347^n\020\245\214\001#\326\227\325Z0vU\tLr\315]\226"
+	.ascii	"\246W\002X\031\261\250\221y\313)Q\276*{\223\210\221\034\223\351"
+	.ascii	"\001\021x\025\013q|\216\306\221%G6z\251-\320\216\027\237\212"
+	.ascii	"Q1-\330\241}\3271l\322\240\016\317\0038\303?\r\026B\307\273\217"
+	.ascii	"\303\030\366v\355\f=\236\212\302\231\207 S\362\300\001\250\367"
+	.ascii	"\335\203S\022\3220Z\2333\202\300>_\376\252\365\247\253I91:\001"
+	.ascii	"C\271\007\321\304X\205&r\371]\316kH<\216\327n9:\360\222\t-QB"
+	.ascii	"\2471\234\036L\017\270I\234\246|\025F\345\214\332\021\354\237"
+	.ascii	"D\230\234\240k\276"
+	.string	"$\007\241@\337\004\323\022kx\257F6\022\035p&\320)\342%\233Lp\2219{\235ob\262M&"
+	.string	"\3722\361\227\214\200\3715\"8-\253M\265\352\262NC!b\"\255\210\267\375^\350\"\201\235\353\017\003\232>*\354G(F\245JTCB\217\376\224\2608\226\341V"
+	.string	"\f(s1\300\323\022\3017\274\202%\221\357kv\3368\200\245\033\271\372\246\324\304\232Qo\214\007\355\242\t\221\274\217\304\360\254\254\214r\303`U$\037T\251\\Z\314}\216\f$R\237!\367Q[\364;\020\311%\004\233_\205\036\212\006c\234\261e\260\347\371\250\025v^\245\312'\032\206Hd\244o`N\016\313EZa\345z\020{\b?\270\316\3739\001\n\243\216\257\355\240\236\016\200\322>\310\241\370\023nc|`*\225\273\246\231\206\310\344\243\243LP\207\022\034\302\352\363P\001\345C\247\004\013\247\261\032W\304}|&\371\231\302\211\356\346\300\330\322c\213b\rd"
+	.ascii	"\030`E\033\277\220Ts\302tE5M<J\024\377\034%B\360B\bQ\246l\266"
+	.ascii	"\354\315\03385\360tm"
+	.text
+	.section	.gnu.lto_servoTable.104.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\367\020\315M"
+	.ascii	"\232\205,\035L0\214[\351w[\b3\2424\337\225\030\005\005\225U%"
+	.ascii	"\246\022\362\037\231\210X\272\333\"\001\212$~\267V\022\263?\021"
+	.ascii	"\0040\3321\353<d*@\243TH\027E\302;\302\001\300\bqPZe\311\372"
+	.ascii	"\377\307\214\306\336{\223\275IJ)\005\264\001\244\001\303\001"
+	.ascii	"\274\304:W`\235)\254\316J\252s\322\352\214\304:\037\261\316F"
+	.ascii	"\254s\321\352L\244:\017\251\316B\252squ\016R\235\201R\347\037"
+	.ascii	"\325\231U\235W\325Y]\235S\325\231\250:\243\251\363It\036\242"
+	.ascii	"\316\217:\373\351\334\007tS\ri\226,\363|\313v\254\360\2046\357"
+	.ascii	"\254K\366\262\273\331=\327\317\334\334\035t]\221F\303HjOjh\270"
+	.ascii	"\371\034\355\270\337\270\351\332L\237\271=\307wM^\313\266\214"
+	.ascii	"\310\004\333\323\002\220\366\331\324Gh\237\303.B\373$\323\344"
+	.ascii	"\226\033\023g\205\255B\007Ao\300\317\264\003\303-\246\227\334"
+	.ascii	"c\330D\212\333a\2164m-\333\261\002\332\324\274\3551\322o\254"
+	.ascii	"v\020\207\206|k\333\326\b\333\247\211\024F:\314\221\264e#\232"
+	.ascii	"\341\213\022\330\266K\247>YD\332'\221\345\313"
+	.string	"\374\327K\265\226\230\024\363\325\334\323\266m\324_\341\264\207\313f$\277\235\204tdTD4$T\f\002\372aW5%\242\347\360\375rk8\336mu\322\220\250\204\214N\353\221%\207S\202\200Q\232.\213#e\260`\311\005}\264\245\215\264\324m\361\"\242\346\272\240\207\210,\250,Yk!,j^\254\300\203\200\220\375sf\346\354\231\\g\340B&\305W\">5\225\310\202\314\231 \225%Q:\345Bvt\342\360HN\225\021Z\217\f\312P\004\322M\223\036\323.V\366\345\350\260I\217lm\330\324\266-[f\364\023\t3\254\314I\017\333\2557<\341\353\3423S\346\244\337\253\013=\302r\227e-K\362Nd\321\266-{X\331\222f\245fn8f.\302\\\374\022\237V\330GP\252W2\303S\365T\357o\276\b{\311T}'\200\0073\353\363\222\3528\346\247\026t\341LSN`\202M\001v\240"
+	.string	"\334Z\372\354\245U\214\223{"
+	.string	"\264\317\252\3571\275\001\314\254\017\031\006\216\313\013-\200a\036\321O\343!\250?\002L;^\316\207\223\274\251\t@\231m\334\360\016\363o\267>\013\363\366\004z\3315\263\330\362>l'\0161l\332\343T\2207$rf\036\007x\207\361O\034)y\375A7my\037\"\023\270\310\376\323\230\271\217\377\210s\360(\320\341?\"\037\236\322^\207`t\224\327r\360\202\212\215\205\266\341\206\303\177\304\021\322\306B\3334\b\355\206\377\210~\303\223=\254\035K\303\326\242\255\341\306\343?\"\235c7\026\332g:\243=\001\357\rL\3371\363\037"
+	.ascii	"! \315\332v\253\221\036\326\206\350\263\2771h\2418!\0079\263"
+	.ascii	"\217\005\274\303\372\035\030D\033\f\354\372-\346e\227\177\032"
+	.ascii	"sO\t\032\223\374V\230Ug\036\252\363\216\325Y\307\352\234cu\306"
+	.ascii	"\241:\033\320s\3157Rg\033\335l\276R\235k\254\3164V\347\031\252"
+	.ascii	"\263\214\3259\206\352lEt\206\241:\277P\235]\244\316U\275l\246"
+	.ascii	"\":\267\350\271\346\025=\327<\265:\253P\235\245V\347\024\252"
+	.ascii	"3\212\325\371\204\352lbu.\261:\223`\235\243Xg(\326y\304\352\374"
+	.ascii	"\244:;\251\316\"V\347\020\2523\210\324\371\303\352\354\201u\356"
+	.ascii	"\300:s`\2357\254\316\032T\347\f\252s\323\352\314\244:cH\235/"
+	.ascii	"\254\316\026X\017o\364\347\033\242/\372\376\"d\273\3124I\364"
+	.ascii	"IkuC\317\276\214g\3623\"e\b\375\320O\315)>\320\013\375\b\277"
+	.ascii	"\240/&q-W\351\205jY\256\230\353\351\303\022\364^\270\006\367"
+	.ascii	"\363@\317\324G\315-\360+??\357|kp&\232\357\320\365\331gj\032"
+	.ascii	"5P\237\370\353[h\032\271ty!\247\257~\177y\225\253\354<}|\301"
+	.ascii	"\234\312\025k?\265>\331\321|\312\235`\354\226\225\241}\246\337"
+	.ascii	"y\352\300\241O\374\263\217\361\316\371\350\243M&\216\f\340\354"
+	.ascii	":\261\212q>\032x\224\033\034\332\021\254#\324G\320\3417\025f"
+	.ascii	"\035/\347\363\304\243\034I\331\217\016\345B\221r\317\316>\b\306"
+	.ascii	"\261!\303\004\231M\231+\002\315\370\226k+2g_i~h|\214\027k\277"
+	.string	"\376\327b\332!\341k\337)(\363\255r\323\274\303\376\273O\357I\236\327oq\214\347&L\232\034\343\230|Aw\213\227\225!\363\261\346\f F\022\350\023\270\0044\256\336\305\317\325\303\270m\036\346`0\206^\360\240ic?\215]\013\tJ\324\034*\030<pR\034\257\343\305\030O_\331\370\253&S\371\027\007\314#\334\350I\2326\276\345t<3?y\327U\026\325|\313\271\356\225\265\233%\013\332g\273\265\037\343\272\366\314\334Y\357\226.\274I\25334&a\237\034\257v\261k\203C\372:s\2472\0224m\302UNq\0176\237\333\305\313\315\340f\200\366\211\343\325:\2527\340w\264\001~\021\242lz\230\351\2471\325\267x'd\302\361r>\267\255\365\\\267\264m[)n\022\272\204\033\206\257\230\026\336a-\320>[|\257\251C\244\027\247I\f\374\003j\310\017\"XA\242\204d\005\t\222\325\243\002\377"
+	.string	"\322A\262\264\252\022\320\302*\242\225U\225u\305\200\017!B\260~\3640\342\036PC\262\036\320\3621$\212\310\217\005\2000\240@\224\020 XA\242zh\r\211\202Z\342\254\006|hE\021\311\312\322\212b\227\\\375V\334\272#\320\273\313\343\372.N\3724n\272\376\320\346\350\306\363ph\305O\275\330\224'%\270\"\007\317^w\017\333\266m\221>\215q|1\342\241\242\261!\003L\026\241\370\035/6\3657\276X\005\254P\305\313\271\312b\336\216W1\264;\332u\361\221!<\372\264\227z\036\317n\314\323\345Z\330\25081\3724\226z\024\337u\355G\n\320\244\210\260\007'\305K\301\271\312\364M\212\357P\247\356\304\243\330r\020n\022H\216\2326lN\274\212\265\022o\342}N\227\257\271\311.R6\321\3220_%\376\301\235"
+	.ascii	"\\\342\233\256\253\276\034\355\332\340\236\214\222A5E$<\250\213"
+	.ascii	"z\022P?\342\243\254\036\352\351G\250I\363\344\364V\217\341N\304"
+	.ascii	"\203x\247_z\023\342E\320]e\377\315]\261\246s&\304\367\337\207"
+	.ascii	"\007\361\247\037\007e><\212w\234\033\204\363 \327\354\360\036"
+	.ascii	"8\374\206\357\360\3429h\370\r\314\r4d\370\027\217\301\257\351"
+	.ascii	"1|\206_\362c\372\246\345U6\240\230+\326|pL\337\200kp\027\036"
+	.ascii	"\303\237$\274\271]\250rs\234S\225\311=\"\"\247\366\323\251]\310"
+	.ascii	"\251\233\256{\314\310\2040\310\251W\274\030\367\220\205o\003"
+	.ascii	"\263\364\026*<\205_\3726\"k|\205?\357\224\236\302\027/JI\317"
+	.ascii	"~\215g\232cD\272\225\026\372\244o\275\275\b\364\0305@\372.W\231"
+	.ascii	"\244\306\245\303\356\034=\222\321\027\375\321\267\221-\201B\250"
+	.ascii	"\201(#\221bH\321\210\210$I\222a\r\241\005\304\030\006\035\232"
+	.ascii	"\007\022@d5\213c\3201\022\t\305na\357\377\013\343\255R\305\037"
+	.ascii	"\376+\227\374\313\304\005\305\004_:\306\207j\006\3211Z\177\311"
+	.ascii	"\0135\225G&\277\3601d\301\346\276\231,0\t\304Au\031\016\274N"
+	.ascii	"\266\225\217\264\340\262\200\272\2416W\211\353\345\246J\202D"
+	.ascii	"r<\252\t\245\370\3051\355fI\311"
+	.string	"\276\371\341"
+	.string	"\202bh(\3767\217\363L\217\023\201\222\204Y\177\245\213_\353\341Z%\345\017q\262\306\225\202u\027\226\303 <\b\252\376\207\252\263"
+	.string	"\371Ms>\210>\330R'\231\344\325 kJ\353-\375\260\215\377\022\333\266\366\271L3P\326D-\344\0223\367\261\016O\365\037ux\026\235u\231\225\374\313*\017\025y2\037\272l@q\246\036\037\255T\310j\277O\211z\323FE\244S\272\207^\221,\244\f8E"
+	.string	"\300*\016\357-w\252O?\006\334QQ\030\200\223\037\177\024g\204:\262\213cO\317\206"
+	.string	"0\017\254\356\342\032*\237\021\301v\213F\262X\0267\265\336\251\bC\371hDm3\372\272\232\274\354gKJ\267m\224\273\020yY\244_\025a&\343\254\031"
+	.string	"\226\203\227\023\303\230\003\225u-\362\025tY\373\241\007\353+{\\\002\301\234\370\310\335\372\t)\264)\\"
+	.string	"\2320L \326\344w\323z\362Z\246\255\013\313c\375\261\346\036\237\354\307\241\361bi\203\201\243$P\n\244\271\300o\202\277\362\274\270,l/\005'\272&\221Dy\352\362t\371\231\006\024\305_\344\304\233(Q4\020Z{\227\207\375;q\316W7\375lh\212\356z\337w\021\223a\351\363\243\266\033;\344\374\265o\335A\220\326xH"
+	.ascii	":\336\001N\\\341r\312xz\232\2711.n\3052?V\337\005\024m\341Y\200"
+	.ascii	"\2147\265\221\311/W_A\327\223yM\364\002}\006G\226U\232\307\364"
+	.ascii	"6N\300L\212\033\262wG\311\336B)6x]\013\205\346*\002\372\273\314"
+	.ascii	"\246*p\305&@\216\263\260\306\244\304 \007\346S \242\036\\\n\327"
+	.ascii	"\332\026\267\024\227\244h\007\304chO\0212\242\374\373\302\212"
+	.ascii	"\203\361\033e\005\241\022\257\026\316?\276\025S\203\205\356;"
+	.ascii	"\320\211\022\366\374n\363\004s\264\235,\371\003"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.105.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 \374\345\006"
+	.string	"\"\r05Pm\222\016\244DX(\243F+\032."
+	.string	"\220\001M\001xZ\215\366\252\315jk;#vv\305\r\344av\334\314\"A@\364%\013B,\024\034}X\373\233\310\024k2\026UQm\254\327\201x\340D8\274\tN\203\304\323T\326\313\020LQl\252\327\241\250\352a4\330\034e\026\200\022\033\241\315\314\2066\254!\025\271\344\222\266xs\215\235\356\333\245S3"
+	.string	"\003\344J\257}\\j|-0G\277;\235\273\026\201\216\223\254\021\005BQi\005\232L$\036\277\3471'(x\276\252q\210\006>H\241\021\025\b\265\227\033\275\352\256[\2202`1%f\237:\200\005\b\341.f\027=\373\033\374\007\177F\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_servosFilterInit.107.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"e\013"
+	.string	"\326UP@\020Q\225\016\030\216@?\322\201\007\201:"
+	.string	"p|\234QVo\321\005\3345\"\260>\314\033\021\265}\373TF\372\377\300 \326\356\306\004\001"
+	.string	"\371"
+	.string	"\220\306\200Ka\244\"\367\b\320\276\222F6\2212\245;"
+	.string	"<"
+	.string	"?"
+	.string	"\236\035\362\320c\005|\2504\260\260\261\273\232\216\360\322\373\245\351\371\022\314\344\003A\2772\020\327\360\351\001\034]\225\335\275\352Y\002E\231\022\314\356:?\320t\307\333V`\333\200\375\002\001-+\312>\353\326\247S\322q\202\006\370\222\214\335\017#9\266\025[\2248\353\366Q\370\341S|\345\235e\027_\323\236\203\307\307\252\306\356Z\036M {\254<"
+	.string	"\366x\035"
+	.string	"\366x\212\003io\026\362\237UAG B2\241\232r\007Km"
+	.string	"2c\2248lw_\321\311vG\007|\025\007\271\340\223xt\206O\376{\364?\330c\352\002\021/n\254B9b\207\242\324\224\b\214\016\001\030\034$\330<\234\246\313\234\271t\233\207\323t\032'\002\204\215\204\007\032\205\r\203\tZ\206\353\264\313"
+	.string	"o\0254\234\306\3316N\243\204\241+J\365o\210qj\205Tti\312\017\377\020\244SHZ\256Z\262'\001\017"
+	.ascii	"2\003\006:\306\022\003I\217}OX\336\0073\240\313\214?\025O\027"
+	.ascii	"\314\262\312\362\322Dp\356\001\\\216\032\304\037J\031"
+	.text
+	.section	.gnu.lto_filterServos.108.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`\345\003\245\033"
+	.string	"v\263\263J\240\326Q:$ p\031\3243F3Y2\363\321\377R:/\307\006\256\344L\250\020\303%e\320\207g\037\336F\323\233\036o\355\376\2240z\320X\t\256\037\347\340l\260[\013\211\362\265"
+	.string	"\027x\213\363Y}\321'\204\354-e\222\001\231"
+	.string	"\223"
+	.string	"\245"
+	.string	"\\\262\335;\355\211+;\375\323\241v\217Z$\257,\352S(-)\271Rk5p\272\005\312S\233\317\214\247\363\265\361\264e\273\333\345\n T\201\020,\005\361\025\267\324ZmMc\313O\342w\344\335\311\221\316.y\267'\027\304~@\240\223\2234:\202B\003\372&\216W\027\214\023\203x\\\n\236\302"
+	.ascii	"]|\316\002HX-h\300\336\234i2c\353\3053\021P\210\273\f\276$\236"
+	.ascii	"\215\200\276iSk}\323\t\3448\0222"
+	.string	"\223\013j\255\313? \213o\354\273Kcw{v\033H_F\272\207\373\343x\r\341(;iw\306w\207)*=\006\333]\235\003\331)k\355%\330S\375G\317\336\306\351\202\300\361\177\247{\334x\372\326 \334\372\202\342q\330.1\210{\350\345\244(k;i\227\246\344\225)yk\217\372\322&oL\311;+ye\223\027\246\344\215M\336r\362\222$\357Hy\351\310;)oO^n\336\003\230\355\330\002\276\250\253\326\025a]j\026\255\272\361\250\177\367\373\036/\232\270\324\016\220Rk]\023\253@\351\304\245v\304\022\006/\270h1\3511\330\222=\353\373\276\300\264L\307\231\354\236^\363\232Z\202\005\323'2\245\354X\267\227\246+\331=\275f\311\207\026$\247\363\270\332EQ\260\025O\2528Y=\t\203\006\016\370?\b\343i\331$\223\220\353\013jl\262\333\212\357K\r\323\336\2250a\374ol\233^\003m"
+	.ascii	"\356\236\275K\241\002\377G\333F\250\201v\177D\367_\225\205\373"
+	.ascii	"P*r#\0270d\3100\236\316\376/\310\335\335^\206\256\3608\254\303"
+	.ascii	"\207l(k\2558\373 \027\302!\347v\033O\271O"
+	.string	"\374\203-B+_U<\016\353\2462\n\313s\243\343\371\311\301\331D\344p\270\334M\300\362\224\360\020\241\334\333\215.G\302GGg\373\341\331\351\t\361\301&\242'\007g\273\371\350l75\233\033\241\343c\373\311\345|l2\"\357\235\324\364\243\320\262\312\342u\020\331\303\215\241Bi\232\326(\r\234\326D\213d\244\365U\021\223T\026\255\317Zk\035{\270\030\230f\255_|,\306\325Q\224\256\226\265L\023\355\0368\255i\272fJ\205\325\020RLo\223\r3JY\377a\221\351\230\t&\344\232\212BEc=\353Z/\017i\t\342\260e\0338d\004g\017w\326\262~\361,\f\306\bF\250Q \346\2302\0041\"\024\210\310\214\226\354`\002)S9\036\021\320\255E\264I\261\264go\337H\3354\2148\002e\233#\304)*X\313\213\"\317\372\261j\2179\347\256\277\211\217Z\355Y\217U\251e\241\002\325\035"
+	.ascii	"\255E\022&\325\006\270\247T9X\345\024\376\013pgK\204~0\363\273"
+	.ascii	"pjQ\321\376\0342\025\302\202\024\\~\001S\302\221=\232#\177D\320"
+	.ascii	"I\017\261\026\217\232\177\251iV\337 \264d\357\200O\026\3435j"
+	.ascii	"=\367\351\370\017 :\234\265\026\236\234\342=\314S\224\037M\037"
+	.ascii	"\356\276\376\246"
+	.text
+	.section	.gnu.lto__reset_template_81.1.111.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"\264\0027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\030\001\177\344\031\001\334\013\320\017\350\007?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"@\260\312\021L\273)\255`\240\b"
+	.text
+	.section	.gnu.lto_servosFilterInit.part.0.192.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`=\002\325\022"
+	.string	"\026d{H\340\360&\035\3006\321\021\b\204\227.\200U\242\255\236\210!\224*U\300\332\257\034\237 =d\263\\\rU\225\2263F\327\253/\023\f'\265\026\037\3429\032\3158\006A0\310\334\376\200\357\201k\346\371*\026\261do\271S\nc"
+	.string	"i"
+	.string	"h"
+	.string	"\237\252\013\350>\345A\272O\317\374\346\222\332\214T\364}Zv*\365\371\036\333\255\231]\366\215\207\266\r\341\351\261\220c\332\335\357SC\330\273\fo\215\256K\215\323\345\337\347"
+	.ascii	"b4\232K\211\272\231\035}\320^\322d\t\207\207\347\036e\264\232"
+	.ascii	"\250\036<\032\036A>Q\007v\327\336\206\273\273m\025\333\t\354"
+	.ascii	"\350\n\250\350)\273h\235\321QF\337#\326J\234"
+	.string	"v3<9-\210)D\342?\217\263\026-\313\310\255\2056\234\343dE'\230\366\025\216x\305Y\314X&$\264\341\240\212lADL\273\341\367\351\320S\373\236\271\n?G\315\310\377\371\315\317\341ZV\275\302\245\315\356\343\343\302\243p=\205\207\2768{\f6\236\233\322\356\216|\232\200\0271\253`Jc_\006\205\017\244\230\355\230\0231 A\332]\223\030\037j\340\340\344\244\373\234\372\030\207\250\252\267\001S2\312\205R\274\335\227\001\037\306\203V\374\235O\263\254V\335g\324\003\211\270\371.\376\002\202\277c\0270>\366\351\203\335\347\365\271K\0235\243\246ZM|\262^\201n\232\202\242\352X\247\311\022\254\2045\307\356\002n\251\240\202\300s\n\311\013\030\303Zy\371`ZXV\021\036|\022V(._\n\353\345#\02118a\205\365\301\200 \353K\331\216\327\034\333\377\205\032\035h\324\250\215U\252\216\347\2109\362"
+	.ascii	"I\261S\2512\333\366\356\241Nj<\302%\275\342\016\353\345\356\256"
+	.ascii	"\252\216\355\002\227\332\251\bN\246\003\366\301&>y@\274\252*"
+	.ascii	"X\020\037. P\002aL-6h;\332Ii;\270.6\017\210\355\270j\357\202"
+	.ascii	"\"\253L\213\300\230\233\247g\234X\033\004\357\222\260\300\302"
+	.ascii	"\332In\357\001+\253't\0340\"$.\3371\020\332\240\t\267\345\313"
+	.ascii	"8\266\261`\263\323,\271\313\272\301Z\372 !\234\037\f\262S\330"
+	.ascii	"#]e\364[\257\020\210\206\343\306\273>l\256\211~\327\034\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`#\006e\032"
+	.string	"\306g\223I\200\226N:c2\216\r\343\321\364\3002\322=\362=\322\267qS.\345\370g\346*\347r\001\340R\320I,DHck>\356\300B>\334\326\030c\2141\306\223\257\300+\304\366\230Z\241\363\301\363\357\216,N2[\311\222D\246|"
+	.string	"\203"
+	.string	"|"
+	.string	"\024\016\346u\\\233p_vJ\270\030\032\341r\020\356\241\234\017\356\23788\034\252bu\263\331l\002\335;9\033\260\rT]W\366\352\347\262\362d\360-t\301\247<\356\f\207\231\317=\225s\3708\002=\254\362\364\374\260\203\023\336\237\355\034\r\275Q\347_\350\177\236\272\256\352\025"
+	.ascii	"UU\325\234{\265\263\177f\325\233[A\025\334w\235\253\022\353\277"
+	.ascii	"\277\027\222s\342\216V\t\356\227\347\377\236M\267i\272\270\257"
+	.ascii	"\302-\206,\256<z\226\321\265V\234\213x\"\250\212\033A\377\246"
+	.ascii	"\342\222\222\021\261\250\030DLBpf\241\212\356E\364%C\037\023"
+	.ascii	":Y\212\037Aq$Agr\342JP\023OR\342\336\215\304}\3339\342u\"\356"
+	.ascii	"\327B\274H\025\210{)\347\007>z`\250\016\347\302\201kl\340\025"
+	.ascii	"\325\300\306\267\f\367lgM\016&\022\303}\224\363\306\013o\302"
+	.ascii	"rl_S\026\356\315\316\033+\234\231>\f\r\300\216Yy(EG6C\323/,/"
+	.ascii	"\311-\021\037\fk\331v&M\003=k\246}\255\317\257}\254\362\367;"
+	.ascii	"+\323\372r\371k\2343\177\315\311!Ls\032\217\257\271\355\361u"
+	.ascii	"o\fj\207\220\327=a7\357p\363Xn\256\250\2720\235\267\323=\035"
+	.ascii	"\215\373\273\246\313\354\214\373-2\356\2650\335_\211q\217e\351"
+	.ascii	">\213\322\375\\\361\362\r\030\367]\222\356\233/\356\355\220\356"
+	.ascii	"\337XU\325\007\347\225s\342\216V0\006\232\203\254\274\264\031"
+	.ascii	"H\222\251Z>\232\21695a\332Og\\ \212\312\255\323~b\235\332\264"
+	.ascii	"\231\222=\204i\027Y\244\366\2108$T\323\0168 \0067%L[&\371\222"
+	.ascii	"\346\023\246\275(\344\332\271\322&J\373\307\227\366M0m\231\226"
+	.ascii	"\201B\262|\274\r6\217\r63\201\301\337\335\212\374V\260q\316\f"
+	.ascii	"\266\022\313\314\243jN\352-\260\005\244\005h\257\005\354\230"
+	.ascii	"$\377\272\354\206|\031\200\200\250q\024\207=+\221\231\024\024"
+	.ascii	"$c\240\002\251\261\2619\021\240$I\235\032\031\tD\202\214\024"
+	.ascii	"t\223\f\344\351\236-\265\bqf!\fG\306\313g.\037WNd\253\264\236"
+	.ascii	"p\005\201\252\347\352\376\235O\n\003\223z\331\225\024z\353\t"
+	.ascii	"\275\234\246pC\220\240*$\370\020\003\306\237 \274>3$\013eOUW"
+	.ascii	"-\314i\307~\024\301\2645N*\317f\267\360\022\027\263\330\231\247"
+	.ascii	"\343\274\351\3558oz;\316i>;\261\312\346u\033\371\227x\203\274"
+	.ascii	"R9\345\260X\305\220\331\214xlL\254\341\340\337*B\240w\307\242"
+	.ascii	"\261\271fXI\304\f\323\221\201\216\220$\365\261\260\253y\215\217"
+	.ascii	"V\233\271\246\353\202+K\321\007\364\312\212\003\032:X\327M\030"
+	.ascii	"\365y1\373\204\247|\355\"\243\342\377\205\022]\003\214\330\235"
+	.ascii	"\321\bJ7m\360\202\035\007\346\t\256\032\375-V6\211<\210\360\371"
+	.ascii	"\303\341\312\265D\025"
+	.text
+	.section	.gnu.lto_.refs.a9dfb1e0426082bc,"e",@progbits
+	.string	"(\265/\375`M\002E\021"
+	.string	"&'oB"
+	.string	"\257&\351)D\225am\202A\034\023\227%\246\242APD\034\356"
+	.string	"\232A3\250\211\236\017"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\bD\330\003$!\016\203iN\306\367\276\365\274\331\374y\350\257\372\244\215|\373d\267-ST"
+	.string	"\\"
+	.string	"]"
+	.string	"\035\r\340\332C\352\035\3227\323\267R\267L\217%\274\244\202\\\277\354n\324s\324\361c\217\274oQ=\356[\350\361\335\221\347\006\216\327\227c\220\265G\366\215\367\356}\333\300\255\374t\276\334[\236\357u\307\272\243uP\373O\376\325zk\217\271\3259\021\333\267\034\004\177\216\013\026\245\377&\37365\"@\270\037\306}\213{\026\367)\236Gqo\"\340G\262_e\037\342\371\223{\220\324\213R\017J\375\007\365\027\352\023\365\r9\300\311!\354A\246\356\260\236\246\216\246\236\256\023L\200&\210"
+	.string	"K\220\004\017\340\bb\236E\244\347(\365\017\366\027\366\215\324\023\373?\315\214L\376\036\262wy\337\222\235%_%\373I>I\366#\357E\262W\275\317V\037\222\375\364\036s_\n\375\350\375Gv\321\373\220{P\350?\357\001\251;\023\363\301};\204\276\0346h\310@\372b\270\220\275\026*\224\276\024&\274\257\204\b\252\336\027\325\367\201\252Oc\206\f\030/^\217,x\341\212\305"
+	.ascii	"M\250\202\305\024|\270\300B\301\025*@\003-\320\013\341\245\306"
+	.ascii	"\213\221\323\002g\205\212\033\0246&jJ\220\240\231\t\321~\231"
+	.ascii	"\230\326\207i\357\222\337\322z\203\366J\353*\355QZ\037i\277\312"
+	.ascii	"\317ZG\265?\345c\255\233\332\203\344\177\264.j\317\221\017\312"
+	.ascii	"\376!\260H\311\343\334\2448aS3\"\0136 \020\243\261m\033\373R"
+	.ascii	"\340B\031\352&\301\272\217V\0356\230\020q\202\t\021'\230\020"
+	.ascii	"q\202\t\021'\230\020\304\225\212\242\375`\214\276\263\b\006\032"
+	.ascii	";\231p;\306h\342\330\352Jv\235\231\354@\230\2201\357\306\330"
+	.ascii	"M\230\260\022\302\212\331\254\\Y\001\266\355l\214\233h\305.s"
+	.ascii	"\306\300\244B3e\3316f\307+MS\bl\017"
+	.text
+	.section	.gnu.lto_.decls.a9dfb1e0426082bc,"e",@progbits
+	.ascii	"(\265/\375`\251Z\rz\001\312w\026\211U \016\245\234t\276\272\252"
+	.ascii	"s&b\"\253\346ov\366o\367\277\252+\273\266\251r&\334\253\276\253"
+	.ascii	"\252\273\372\357\363\023[?\345\355n\202\\EFe\304\001\327H\336"
+	.ascii	"n\245\373\227+&\035#\032\324\277=\243\304\377\240t\270\274\365"
+	.ascii	"\347\242t\377\377\205%\204\220\275\345N\001f\007\206\b\264\b"
+	.ascii	"O\235\244O\213\244O\277\322\247B\322\247Z\351\323\034\351\337"
+	.ascii	"]\270$\265\230\3705\376{\356\315\345o\272\336b\367\254\226\006"
+	.ascii	"\353\"o\352M\343\326\262A\347\006\026\350l\271\241\367\034\217"
+	.ascii	"\025\023(Q\032\377\264\026,!Z\222\215\377n\234\261\3231\006i"
+	.ascii	"\307\243K\225\025\037\362o\205>$\225\233\241 n\310\226\322K\372"
+	.ascii	"H3\351\267\036k\264\216\322V\032IO\351*\035\327n\255\244\263"
+	.ascii	"t\222\026k,\275\326W\232\254\333\272\254\331:\331i\255l*m\326"
+	.ascii	"N\272ICi\265>\353\026\372\211U6\\#\337am\344\270\233\234\242"
+	.ascii	"\340\256\032\313\326e=`\t\232%\231\326\226\226\232z\263l8\353"
+	.ascii	"\306\372\361<\371\344'.\031H\270\255\271\245\375\203\362\333"
+	.ascii	"\201\207\204\361\017}E!\361[\273\037Z\354\337\013\213\026g\210"
+	.ascii	"\005\253\205\rH\026d\3035X\027\341\2719\377p\202\3149\277\243"
+	.ascii	"\206\2549\021b\321\332\354\032\227\\\323?\3245e\310\313j\221"
+	.ascii	"\3222|\320-\243~k\327\203\0132\347\344\337\323\237]\2162N~\373"
+	.ascii	"\327L+ \333\3308\026\215\207\311';\335I!\333FV\036r\210\210E"
+	.ascii	"\263uY\017\020S\263\177\r\3278l\233\255\353\n\201\314\314\222"
+	.ascii	",\206E\343\2719\363\200\203\3149\371\327p\235\207\302\266x,\311"
+	.ascii	"9\371A\350\0030\314\027\2741\f\340\233\264A'\b\026\350<\332\227"
+	.ascii	"v\0214\364\310\237\214\275\306G\331\244G\277\244G\251\244G\323"
+	.ascii	"\322\243A\322\243S\351O8\351\317.\351O*\351\317\264\364\347X"
+	.ascii	"\3723I\372sH\372\223+\3759#\275\t'\275y\227\336|Ko*Io~\2457{"
+	.ascii	"\2447\251\322c7\251\220\r:{F\323\260J\241\256a\347$CG\343\343"
+	.ascii	"\275\264\005\331\n\235\377\263B\347q\230\364\330J\352A,\365 "
+	.ascii	"G\n\202\r:\217\235\322\3372\351\325\332\322\277%I\237\305\006"
+	.ascii	"\235\2779\322\337\251\364x6\350|\373\245\357\274\264\203\005"
+	.ascii	":\337\\R\373\306\302\261J\017\266\357\226\317\302\035\370\224"
+	.ascii	"\314\312\234\223=\3000iv\2505~\307\245\267\036\316\236\277\277"
+	.ascii	"\277?\353\341|\213\245\330\002\235\036X6x)\016,8O\326x\330q\023"
+	.ascii	"\306i\211\2324\326\313\337\025[\247\271\335\263Z9K\3119k\350"
+	.ascii	"Y\303\244\026\246\261Ec\227V\271\301\352\345\036\273\327\345"
+	.ascii	"d\325\370m$eA\316v\303i"
+	.string	"\377\376\354\206\363\267y\033P%p=\202\234\321\240'\2115\365\243\361o\315\224)a\231\214\322\230L\016\223\031\220,\215\337?\322['I\213v\223H4\215+\316o\301\3301V\214\rc\225\026\317z\271\265\263wix6\212_\002\376\241[<\373f\353n\362\355\002O\372\226MF\220\260x\366\213E\343aJf*\224\353\357\n)\364\341\303\007\036\257\276/\251\013\370\226Lj\263\r:}\350\322.Bv\315WX\234\306\267l\351\023P%\205\361$j\231s\362\026\356\037\242\263qV\356&\221@\030\\1\2269\347\377v\213\235\263\\\254\322\322Y+\267n6\355\235\314\371)\347<tKg\251\330\266\233|\313ON^\006pvf\005?\276\234\223\037>\b}0\253v\200\341\222\342\337b\271\225\263ZR\310\032\322\254')\254\306Y0\326\026 `\215o\261R{e\350\026\013\320Y\225\225\314j9\347\036"
+	.string	"L\211\203k\214Z\240\363\226*=\013\322'\245O!\355`\203\316\213 \325\261@\247e\263R\254\262\003;\345V\315\256\335lJ\346d\316\311\236\376\362[{\322\370'\322\333\016\316\373\367g;8\037B\352c\203\316\266@\347\353l\320i\315\354\231Uj`\241|\004\211_\246\263L\226s\262g'\016\2238p\032\037\204\364\366\3115\330e\022\317\220\336jp\332?\253\301\371N\277\264A\347\371l\320\371\333\262\337\216Y\262\016.\224\224VV\3139\371\223>Ua#k\374\244\r:S\013t\3767I\f\214\316"
+	.string	"\0077\314\177\277<\2319\026\311\226\340\347\217\213]\270\374\327h\313\337&\374\235\202K\367_/\004\177g\200\203o\360c4\177\257\270b\215\3029\370\205\337\004\376}\343\f\377\246\213\3561\022\300\337!"
+	.string	"\322(\256\267B\354B\327\360\020~\363h\267\254\321\177\217@\321\300F)\301o\207\377Mr\245\346~\313\206\301\337Hz\376KC\356o\f\177k\370\373\347\357\021\\-\277\225\300\337\377\033\375;\375;\354\214\315\263\306\377\035\264\211,\277m\312"
+	.string	"\0071n\034\024=\233\346)\374&\n\177\023\333\350\2725\007}7\256\nV\\\261\016z\203\213\202)\377\3407S\320H\377m\353`\312\021\206\373/\nj\377\365Ph\343\177\323\310\274L\006\376\013\375\347p\024D\274\305NQ\006\375\226\315Z\351A\006\004h\377Q\034\203\337<\361\367\212+f\255\214\271C\372\307M\276\003\333\346c\204{\244{\\\250\337\306\331+N\376C\351\273M\216\3417\027\360\367\n\261\277\315\230t\t\356\212\2775\260\304.\301\372\333\306U\362\337\025\264\360\333\246\377(.\n\376C9"
+	.string	"~\323"
+	.string	"\326\004\177k\240\203\243\270\316o\026\340\267H\377M\262n}\340\"\371\255\212\377\036\371\373\303\337y\307o\213\032\256\221\377\016\351\030\033~S\303\337?\356\327e!\313\365\272]W\310\r\362\333\273\337\332\375\315\005\364\233\027\370\373\215\353\357\272'\177\207q\373\373-\355\357(6\376F\243\n\373\033\313o\331~\253\366\333\265\337F\371-\224\337*\177\233\366\333)f\2221 $\376\373\303\026y\374\007\301\201?6\001\323\216\253\243\204\036\366J\317y\376s\004\377\263\374\247\373\257\345\277\021\370\333"
+	.ascii	"9\376\177\371\037\346?\336\345\376o\001\363\277\313;\370\317"
+	.ascii	"\341e~\301\217\327\376\013\364_\r\377\275\340\277"
+	.string	"\031\376\353\363_\f\377\r\372\357\206\333\200\366\373\357\316\177y.\216\377>\377y\202\377\336\370\257\215\377\326\370\357\324\177\243\376\313\202\377\252\360_\343\177\225\376K\374\357\321\177S\370\257\007\376{\342\277\022\370o\003\376\013\302\177=\370o\210\377r\360\337\r\376\313\341\277\030\374-\346\357\273\277\275\374-\367w\226\277\341\376f\373;\355\357\247\277\317\376v\362w\331\337c\1773\371[\311\337H\376>\362w\330\337E\376&\362\367\327\337^\177\003\371\333\307\337=\376\336\361w\216\277o\374\235\3657\215\277\257\376\236\372;\306\3370\376v\3617\323\337*\370[\205\277\327\277\215\177+\375M\374\033\351\357\022\374}\3647\211\277\213\376\036\301\337!\370[\203\337Z\371\355\224\277?\360[\342\337(\374v\004\177w\340\177\337\177\275\377{\377\247\374'\3637\212\2777\360\267\006\376\316\300\337\013\370\033\304\337\006\370\217\342o\016\376C\371\233"
+	.string	"\177\003\340o\016\177g\360\267\320\337\300\337\252\371m\336\177\023~K\346\267c~\213\367[1\277\275\362[\267\337\266\375?\361\333&\277%\362\333\342oI\360[\017\374_\363_\315\3774\377\317\3747\363\277\314\177\262\377*\370?\367\277\303\337\337\337\337\277\363\301\317\263\345\227"
+	.ascii	"T"
+	.ascii	"d\224\230\214M\203\263\013\250\334\024\266\201\022/Y N\24725"
+	.ascii	"\264\032\337g/\314\303`<\233sS\316\312Lz$z\370\250\362\360c1"
+	.ascii	"\307x\346\030\225\244\r\237.]\272\340/"
+	.string	">\331\311\214\337\022\335\343\222auw\374\005\bF-Yf\367\037\blJ\223\265\303\016{\331a\203i\215L\216\341\025&\207\353\254\227\"4\212\2705\276\317Z\212\267l\270\340\306\226e\325\370>G\3229e\031\037[\032\337\347G\212\265@\005\361J6\276\317\2144\231\363\306c\215Fc|\305&\341\261\245l|\037\250\264\n\266\002\324\302\361\244\251\361}r\0258\253\304p\367\n\020*\347\253\017\230X\265A\302\227\253\252@\274'/\231!K\211\f\26767~XZh<%\235\302\002\227\222\306\357\351\322D\313\322\332\215\345x#\023k\"7T\246\005\371w\306En\231lA\313\222\211E^\221[\222\335\215\007\230s\226\26175\214\206\243`6\f\005\257a)\370\tN\263J\254\304f\307J\354\344n<O\311<\004-c\025\007+'\353\r\n/\003~O2}OX\372\036\260\364=_\351{\272\322\367"
+	.ascii	"I\337\263\225\276\247G\372\036\035\351{n\244\267L,&r\334\002"
+	.ascii	"V\322hl~Qe\342\316k\231\253h\200x\317\213\364\030\f\0279F\036"
+	.ascii	"\211\223\2449W1%3\225\320\021/m\220"
+	.string	"\360\345\254,\017=@r\210\235Ar\234\344\037A\342yv7\250\264\340#<W<\246\226\370\b6\222\027\327\324&/\247Qk=\254pX\203\341\021+R\304E\343\363XI\377\333\367\177\346\246\252\234\363\225\231\314UN:\347ooMk=\374;\366\332\001\374\307\367\207\200\t\311\354dfH\316\331\252I\217\2705\345\350\220\315\272\234\237\266\230B\330\262\202RnY\375@=m\331\200RnY\375@)\2672\323\023\030\323OU\336b\202R\346\374\223s\316\371\351\211\211\004-+(eS\376\201Rf\253\354\302\316\312\346\344\026S~\322\312?\371)7e\245\226U\007\250\247-+(e\223\325\017\224r\313*+\267\262O~j\252\212z\312U?Y\271\245\227\225ZV>PJ-+(\345\026\231-\023\225\206o\206\230!B\246X=\250\247,cJGS\225O\035TR+\343\345l\325^\344\252\\\227\363"
+	.ascii	"r\326\241U\205\327d\303\2769\325\311p\222\322\244e\2239\347\r"
+	.ascii	"SN\\Z\371\251\216\311\346:($Z9#q:\312S9\347\374\001S\262.{\331"
+	.ascii	":\246\037:\262\324\213\2341\310\311\234\247rf\262\271.\347\314"
+	.ascii	"\224sF\253t$s\306\341\003\205\234\232\3129Kh*\353`\202{\221s"
+	.ascii	"\253\221y\263\202Rri\r\301\241)\221\031F\222\311BIied\306\333"
+	.ascii	"\252J\225LfY*\347l\323\244H\253\031{\215\317\203c\310\327\022"
+	.ascii	"\353\213\236\031\007\005\307\213.\354\325L\310\300\346\032\237"
+	.ascii	"'\252\013\007\311\371\262d+M\343\357\364a ?0\027\220,F\020,\274"
+	.ascii	"e\225\230\013\373\370\b\022d\230\013kyY\241\311\312i\353\352"
+	.ascii	"\253\201\361w\342\322\357\274\245?\356\201y`?\261\262\031\230"
+	.ascii	"\207\335\263=8\260\210\354\020*\323\267\205K\343\037\353\310"
+	.ascii	"\201\200*D\2024\316\361\333?\214\343n}\202\301!%H\343\316\370"
+	.ascii	"\006\266\221\023\005\231\246\255\261\024\276\342i\362\311\031"
+	.ascii	"ln\231\205\261\254\022\333\30060\r\\\303\326ua\261)\313\234\363"
+	.ascii	"\207\r\037p\024>.\271\263\206\335\263\350\225\0253*\215\277#"
+	.ascii	"%\275]\223\241\005\211\255\360\f\\e\225\370\352\3071Z\306\033"
+	.ascii	"n\312\356\361\2309k\311!\361\025\246\262{<M\311\\u\341\213\251"
+	.ascii	"\314\025\241\017\037\214M\200\300I\361w\300\322\357t\245\337"
+	.ascii	"\371\221~gGz\342\025p\024f\023\342\326\205\315q\324\177\333\\"
+	.ascii	">\f\325@5I\230\222\2151\214\264\b^T\226\306\337\241J\377c&\354"
+	.ascii	"\002;\341'\334d\225\370\305\365\373\215s\377\322\334\250\301"
+	.ascii	"\301i\202|\343\004y\373\356\306\363\344\223c\300(C\346\234\361"
+	.ascii	"\013\234\357f\353\324\262\013\263\003\270\361"
+	.string	"!\206\216/\347\254\243\247\343\013\027\035|\235\275\324j\331\2403\203\005:\257\363%\275\216]z\235\272\364:\\\322\353\320\245\367\001\026\350\264jC\277l\356\333\225\027}k\324\344\205\375\251\321\373U\363\337\275\233\306\356\331\rNu\311\306\266\316\006\235\034,\320y\227C\277z]Dmn\256\361\016\232\233w\302\350\241\354r\317\374\346\335\255\323\2505~o\032_3C\277g\036\360\365C\254\361-\023\227\2725\325IqkK\002\313xa-\307\270\021\031\202f\331xb\314\263\25621\215\257\230\377\312\335\271\033F\347\336\261\225\2655\006\323eLPk\032_\307-\265\273\\\256\027\256\271e\316I\273K'\207\374r\357\254\362\332\335-\037>\b\245ZkTl'\376\257\227:`\337\216\025\226L\001\006\t\"&7\356r\237\3406\252\354\325\370:Q\322\353\224\245\327\001K3\270\310,C\277Zt\322\340)\2314\306"
+	.string	"\313\025T\212\022\215\030*\277W\376[\345Z\271q)\340.\245\234\333E\203\325\002Ucti\201\316\0137\364K\345\214\343&\206Z\343\236\267\247y\361\301\206\005\267\266\267\246.\027\215\247\350|\301\241\006\256\361u|\244o\031J\265d\331]\023dW\3319I\300\231\230\224\273v\243\\\266\213v\241\\5\253\274i\367\311\355\225\226\272M\353\272\306\272I$\232\346D\266\3149\337\264k\226\357\335\330\025\022(\003J\223\223\017\276\316\216\364:U\351u\232\322\347\260I\237\263L\377\353\244\311\033'p\2144n\362\377\267LG\253*?\355\211\031\003\2451Y\027\033(\247\306\317\301K\377\337%\227\311\025\263\312;v\303\204\222O"
+	.ascii	"2\307\320\035\273E\356\3305r\225pp\202\312M\\\033\034\201k\""
+	.ascii	"\306\227sR+o\rL\212\377\253\244\205K%\316\236^\343$H\272\366"
+	.ascii	"\2524~N2\275H\356\221\2361\306+\257\361s\216\244\317!\222>\007"
+	.ascii	"H\372\034\034\351s\254\322\377\202u\231\301\025\251k\374\206"
+	.ascii	"q\273\256\r\333\006\245\307\022\316\205b\341\306\325\261c\331"
+	.ascii	"\246\367:\r\f0C\376ZM\277\001\362\265\274?.\013\327\353\016\271"
+	.ascii	"A.\220K\344r\335\257+\304*oW\367\375\372\270[\027J\346\374t\273"
+	.ascii	"\356\216\253u\315\252\322(PtD]*[\227\345\223\237\240x\331\335"
+	.ascii	"\252\213%\303E\227m\323\325z?\003\302\213*\340\0130D\226\267"
+	.ascii	"\353f\235\360\242\344\215\020\266\313N_\027`\234m\320\371\244"
+	.ascii	"\005:y\334\036<_\310<\255%\01707GO\036\217 r\215\177!\313\305"
+	.ascii	"q|\246\265s\233\260\266\244\245\277 \226\376\302\020\032\267"
+	.ascii	"\306\f\\'\225v\341\006\215\031:ns_f\\\375\316h\313q\223&\306"
+	.ascii	"\220\306\327\n\353\220\262\302\213\306_c\321\376\003M.6f\334"
+	.ascii	"\032\377\302\324\324\225!\245cV\007\347\357\315\224\324\205,"
+	.ascii	"+\304A\305\370\225\262h<q\264\322\032\177\315]\341?\320\272\311"
+	.ascii	"5y\255\360\366\343\031SwE\006\231\013\343\202\236\220\255!\215"
+	.ascii	"\017\274\222\336*\357\213\353\202\307\212\215\214[\343\377\346"
+	.ascii	"_\027\377\b\022\327)US\313\233j|\235\3726\335\247_\247\313\364"
+	.ascii	"\021$\256\363t\235p\316M\326\n\200\307Z\001\230qD\232\236\234"
+	.ascii	"\370\300\267\364k\372\357?\360J\201;\263\344/N\020\230\251\245"
+	.ascii	"\3209\026\326\246"
+	.ascii	"\205\306\377\255\262\375\272/\231s\336\253r%7>\320Iz \330\033"
+	.ascii	"7YJ\232\370h\334|\375te\007\243\361\2019\322\377k\254\262\333"
+	.ascii	"\260\321\311\034\260\231+\177}\215{\215N\023V\233\227\306\007"
+	.ascii	"^\245\0076\245\261m\247\r\027p\330\032?e\223>5\263D\223b,Gi\234"
+	.ascii	"\227\274\240\345\356\005\215\306O\273\244\267d^\354\036\227\231"
+	.ascii	"e\316yL\177\261~\327\254*M{2\346\316\356\3614\371\344''2\310"
+	.ascii	"\226\321c\332\316\356q\225i1\215\327g\232L\227i3V\331c\032\f"
+	.ascii	"N\346\374\004\243\256\261\316 \333E\217\3510\215\345\224\227"
+	.ascii	"\321&Vj\274\360\340\247R\322H\250~hi\374\f\346N8\347\233\323"
+	.ascii	"J\221*M\032?\003\270\364\031(\325\2509\333\fq\215\361X\262e\314"
+	.ascii	"\013\314\311\346g\2335P\352\232\234k2\300\332\3333\3172\224Y"
+	.ascii	"5\021\343\353\251\222c\003k\374\f\\,\227\270M\347,\255\013f\310"
+	.ascii	"\025rI\316Y\036:\310\226\032yzdN\346\314\353\234\225\346\262"
+	.ascii	"'R\313\234\263<\220\270b\223\346\314\317\274\274\2363)97\215"
+	.ascii	"O3X\242\234\3705>\313\334-\313\331\224\245\337\177\340\311\205"
+	.ascii	"\252\357M\343c\260\305\316\356\304\343p\304G\034\254\034'hUI"
+	.ascii	"1?\361\356\246\003\325\264\246\254\361yw\206\341Z\033\203u\206"
+	.ascii	"9\301\300\375\350j\232\242\323\227cO\314\371\005\233]$[bulr?"
+	.ascii	"\271\310\235uv\215=\313YZL{"
+	.string	"\005\3501g\204\r_\206\322\341\241\001mI\276t\371YGw\376Ay\333:\267\240b\300\314\2355>\351\314\0343\312 \231\373\201:]t\\\366\032\037\203\032\3511\220\021\367\307\235Y|\230\3162\225}\242#F\216]\0202;,?\263\3305/\310\334\032\237W,\332\215d\324\362nI\332\230Di|\f\262\331O(fg\225{\247S\305t\226\251P\266\261\"F\3702T\226\007\036\247\267\032eR~V\371Ie\004\211\237!\006ACk|\302\335z\245A\203j\374\323\355|\373\201\30003R\3424\376\006/\351\331\206\200\035o|\3645\3769\345?\360B\227\035\221$\215\333>\356<\331z\212J\222\035\215\317(G\363\037\270#\305\254KG\343\2579\327\376\003/\027\256;\247\306'\332\231f\225\237;\325\316\252\254d\017\017\025\030ks\215\277A.\275\375\334\331\002\373\271\363|\362S\371\003\201Tx"
+	.string	"\331j\374\rT\322\377<\373\201h\22409\220\215\277aJ\372\rh'\331Iv:\351\234\245\305\244W"
+	.string	"\033w_H\370r\316\362`\256\305\230\332k\374\237M~j\3119\202\303\316G\343\263\f\263\360\037\330C\243\n\216\216\r5\322\377\024;\305l\231\016\271k\n\220J\006\226\264\306\337\360d\344\347\022#'\2164\277\250J!\263\251\201\003\224\261\306\n\254\361\331\302\251$\t\222#h\322\377D\236\310{%F\017\223\270\265\257*]?\301\272\304\236\340\310q\362\001\225\245\3619\344$\362\305\202\327\222\364?\203\234AL\246\016Y\315'g.\271\2352pU\226\215/\264u\362\370\371\343\344q\342\2609\333\275"
+	.string	"\336\335\351X\346*\035 .\260\320\225\244\252\361\271ur\235>N\255\263\207\320T\372\237:N\035\230\256\363\315\231\207\231\267\\\225\005\202\007\t\2259\250\306\327"
+	.string	"g\314M7\346\033\023\216U\232cN\034!\3440\247\334\344u"
+	.ascii	"%f|\310\2502\215o\240Mb\302hi|\ry\351-Y\237\031\307\314\322\374"
+	.ascii	"+\343t\272\260u]!\264\320%\233~\034\234\240,@Ff\371w^\2350\316"
+	.ascii	"6\276\345yu6\341\3218\263N\033g\215\323\352\234qbY\345yu\276"
+	.ascii	"\270\371\306\204\3634t^\235Lc\2269'{\324\214\245\331\360\301"
+	.ascii	"f\337\317pp\202"
+	.string	"\262@\223\274S\306Ye\225'\225\332IuB\235S\266.+\231\257r\246\354\305Q\263\341\303\316\336\027\274\034'\376\317\251SJJRH\232\306g\f4\313\306\234\213\306\327\320\226\376g\224U\236+<o\315\02288\215\277\006\230\203\205\005.\266\364\032\240\244\327\260$=\237R0\313\035\\\032_\203\221\364\032\300\322k\020\222^\303Vz\r8\322k\250\221\376f\034\323O)\247\206\213_\337m\221rj|\rVi'm\320\351\301\002\235\346\032\263\215\311\367\003{\304\336\202\2605\276\206\250\364&\233\377\300\f\260\320\205\2551\266\217;\31547\325\374\300\236+\202\234j|\rO\351M=s\357\007\362\340\201\255\2315\376\005}\351\315%\333\237\232\033\215M4\351\213\013\362:\270\260\243\255G\01627\321\374w\331Mf\036\n\376\374\33246\315\230gn\346\231e\314\274\017\264rn2\363z\372rn\352\261V"
+	.string	"\326\n"
+	.ascii	"\213q\025\211r\342_0&\265nC7\311\344p\271\262t\322\370\027T\001"
+	.ascii	"c\2021\305d\265qI\241\363\ns\343R\2103\343\013H\343_pvw\027\343"
+	.ascii	"\b\235U\232t\246\027 _:P\256\220H\351r\263\3567\267\230\\\032"
+	.ascii	"H\026#W\032\333\261\241\233]z\356\334\326\2005\276|6\350\224"
+	.ascii	"\200\005:\177\301\01799\267\013\254\252X\245Y\305\314b\001\237"
+	.ascii	"\234\271\272\344\\Q\221\n\273r\023\313oZ1\343n\\\ne\350\244\300"
+	.ascii	"\032[\276\241\233W\360\0176TF\032w\226\r:\t\3207\305*\315)&\234"
+	.ascii	"\220O\316@\246\264\341\241\001\343\246\261\371\366\233m\326\311"
+	.ascii	"\2153\253\256\244\3605\0361t\323m\211\025\037n\032\363X\240\363"
+	.ascii	"Ae\326\254\322\\3\331<\370\344\314\325\207\314U4@\264\355\300"
+	.ascii	"\b\302\206\312\214r\343R\b\343\345\306\246\361\203\270(\255\322"
+	.ascii	"T\232iB9\3178@\231\036\r\020m)`\371\202\345\005\224\233h\327"
+	.ascii	"\371\322$5\246\361\320\320M(\326\t\0343,\215\037\364\226\232"
+	.ascii	"\231\231g\300\234\327\2345\314\320,\371\22446\317\302\216pI\225"
+	.ascii	"9qb\321:3\235e\252\013QM4\242d\2715~PXY\031n\023v\355\244\266"
+	.ascii	"\320h\374  \351o\216\231c\230\256C\316\312L{\035\224\230\235"
+	.ascii	"+\304\021K\322\370AV&\023\223\tnS\304\3112\350E\372\233-\230"
+	.ascii	"CL%\230G\bQCqf\031\370\322g\300K\377kDy\215\340\034V (1k\"v\343"
+	.ascii	"\350\360\222qDi\036\301\\:7\235e\246\0366\2752WP0\034c\252\032"
+	.ascii	"?C\227\3647\303\254\322\f\303Q\f(3\023C\307SfKV\230\306\317\200"
+	.ascii	"%\375\315\"f\221\233\027\006\302\330\326\235\232\264\211\221"
+	.ascii	"7x\215\237\001\231\376&\021\245I\304\266u\310]ZMM\033(\331\263"
+	.ascii	"{K\253\334T\2115~\206l~\231_\270\315\031/$]\024\332\221\306\007"
+	.ascii	"Zc\n1\205\230^\033j\350\351\240y\203\263gv\335\364\202\303&J"
+	.ascii	"\022\240;\223\313*M.\023\b\316QP9_y0\247\003D\372\345K\016%\346"
+	.ascii	"\017\334\343\315\2145xj\214\227T\343\003aI}\370\330`eu\272\200"
+	.ascii	"\321F\256\361\201\316\322\337\354a\366\270W\322|UU\201'8\226"
+	.ascii	"\271*\013\204N\027\222\262\261\306\007\372\221\336\324a/\235"
+	.ascii	"\362\322Y4\241\314\264\327\201\211\265h\247\231\303\314\201\333"
+	.ascii	"\370\235\261\311\203j| \252\364\277En\221\307Y 7Yy\300\304G\006"
+	.ascii	"\361\233XXf\326\025\bJ\302t\200\270@fO\f\224i\303\364\221\306"
+	.ascii	"oHR\212T\216\266\270\306\007\2022i\2304p\033"
+	.string	"\b\244\225-\247\226\310ui|\f~&\225Ie^Y\200)\303\2320 \022\275\035I\253\233W\217\353!C\256\201ilV\241s\\\270z4\376\232\307\325\200\033\333\322\370\030\362\322\337\234\272U\232SX\016g'(\255<c\203\271\260\234=(\036s\215\217\241K\032\025e\306"
+	.ascii	"\352m\220\206\251\205\ba\332j\374\233+\334\214a\367v\316\320"
+	.ascii	"\360\001\005\013\211\342\307eF\343ch!\375M\030&\f\353\327!\253"
+	.ascii	"i5]\025\240\314K\026\0209k^\322z4>\206\037\251\223\351\302\t"
+	.ascii	"\2679s\266I-\252\252\234U\345\301|2\237p\033\233\253\330\234"
+	.ascii	"6\302L40!Y\215\217aF\372\0378\351\217\343X%\216c2\205\300d\225"
+	.ascii	"sS\326\006G\314\356\231\335\2264\215M\246\037\377\231\031\177"
+	.ascii	"Y:"
+	.string	"0Wt\215\317\327\335\245?vc\225\330\r\356\353\255\f$\013c\262\314UU \372~\374\006\303\301m\235\245\310\311h\214!\333\240\263\265,\320\371\037,l\330\3406\367\311Y\313)g\036;\316\033f\270\215\035\022\260(\215\377\023%\375\261\032%V\323\\:\344.\255|\325!\211\236\2227\246\023:\277#\215\377\363$\375\361\336\255\022\357a,\035\262\232V\276:\300\021\253-\036|9g\201\350\341z3K6\376\317\221\345\322\226\311V\003@\023\266\003E7\304\251\361\177\264\362\3620^\347\374\224\221h\232\227\224\345\217\213\364\307f\254\022\233\261~\026\310MW\005\330\301\224\004q\037\276\364\307\0019\304\241\320\b4\"\016M@$4\2428Z\207(\\\240\"\245\020\256K&\b\375\344p`\203\f?\nq<Z\205I\252\021Qh\342\302\217B\034\325\242bR\220\310(\202H\305\006\nt\240\004\024#\210\020\244"
+	.ascii	"\t\0320!8\202\211\340\211\022~V\365\230\244&\235j0'\t\250\026"
+	.ascii	"\025MXU#\235\037\205\020\241\"\245\020\022)p,A5.\255BU\205O\t"
+	.ascii	">JE\242\241\021\305\021\250\304\t\030X\207\304\022\200Z ))\211"
+	.ascii	"\360\203$$:Z\205I\"\216\3530\205\210%\242\021\002X,\021\207H"
+	.ascii	"\b\370@\001A\005\200\300B\304z$\026\211L\025+qhD:QHR\301\210"
+	.ascii	"84\256G\021j\321\022\022\021q(\302x\\\022q\001\022\322"
+	.string	"\022\221X$\242kPE\301\360x\252P4\036\255E\"\252B\250\"\341\026JDIj\322\371\243\020-&\260\252\025\310\340\223\001\006-\224\212#\004\005\217J\305\021~\326\037\2050R\022a\244DD\\\312!\252h\363\0304R\322Y\203D#%\223h\244t\217V#\242\212t\252(\030\036\361\361\250\032\213\212\204h\013\245\"\0216\256J\267H%\032\r\221\204h\221z\\\302G\364\306\240\221R\210\035\243\360\210\b\2670\256\307\241\221j\"HE2\"\016O\370 \t\227H\030\"\251\026 \n\221\224\214C\0210\030\021\207(\030\021\207-\220Jd\360)a\002C#\212\235\243\021qx\344\300q\210\341h$D*aD\034&\031\2059\307uhT!\007HEJ!D\261\343A\210\236T\270\nI(\032*\241?\nqD*\032Wb\221(H\304\241\210(LJ*\216@d\004\376(\004Q\320(\202HE"
+	.string	"\216EE\023z.\260\030\232P$,b\340\347\230\243\001\325\270\224\201H\203\244\342z\\\032\241HXD\312p<\327!\261\204\343\005bq\270\022\251\306!\t<%\214\0320\2018L2\252\253Z\344AM\032\256J\305\"\006\212\206'\374\370x\020b5\n\225B\254Cb\t\307\026B\243Q\004\r9:\302UH\002\221\361\354IR\327c\213\023A\fE\024,\226D\300\200\250\256\353\320\210\202y\254\200\272\n\213\224\2260\254\301\243QEZ\242\200Z\264\264\016\327U\030\264\256\253\032,*\201E1\005zb%\252F\343\022\321\317\372\243\020*D\020\213IIE\242\021-\372\0304\252+\322\260D\221p\351\004\303\024<\036\244\350\241\024=\"E\017\t{\204\260\207X\364\b\026=\324\2421\234\350\030$\226X\325\243j\302H)\350DC\243JT\215\322\177\240"
+	.string	"\004("
+	.ascii	"\004\026\350Ah\200\007\r\360\340<\b\r\030\032j\200\002\206\322"
+	.ascii	"+`\350\016\205\030\002!\250\256B$\245$u\r\0063\250A#!R\t\325"
+	.ascii	"Hx\344\200QM\032\256>j\220\205ZD,\341G!D\024\207\032\220\204"
+	.ascii	")\222\206F<jQ1\t\253"
+	.string	" 4\336\037\205XJ\032\"!\025\215\370\210h\035*\231*\b[\334\243\272\204$\\q\256?\nQ4T\022JZ:q\217A\341*$\3418d!B\321Pi\347\004[\202%\301\226\260\253\212\264d\304\307\340QEZ2\241\243\"-\231\340YY\024S\334\243jd\024\256;9E\252\252t4\327\037\205XuL\3201\217A\243\312b\230\204\032\213k1\351Bq\205Q=\241\036\227R\026\3065xAUj\201\302\003&N\350\234\340\263\022\227\212#\350\250\253\320\304\321Q5\252PM\2600\356\030\327\023\210%\204\253\220\004\025\204&\212\204\252\t\"c\216q=\001\003\261\304qi\025\256'\214\353\t@H\305\342\004\202\3461\250\256\302\365\204\2324\\\211K&X\030}\210%\216G\225\250h<\201\310\350\263\252\025 2bX\203kJ,q\344\200\2324D\241&\t\215%\210\214=\302UHB\216p\025\222"
+	.ascii	"\\\223\212\306\022*0\034\203IB\243\360\250\022\031\227\212'\212"
+	.ascii	"\324\243Q]\241\032{\210\303\244\313B\230tU\244\242\242a\322\251"
+	.ascii	"\256B#\376Q\b\026F\021FJ@,\214\027\224\204IDF\323\250\026\rW"
+	.ascii	"\024\215JE*\013#\222phT\217?,T$\245%\022T \t\217.\020\207\035"
+	.ascii	"\202FKHJB?\253zT\215E\304a\212\340*<\006\223\226\214\253\tT\245"
+	.ascii	"c\006:*\222\220\350\302jTW\020\207D\306\242a\222I\034&\245& "
+	.ascii	"R\217\210X\b\223\322\236#\222p\005\2618\\\205HE%\243\272\022"
+	.ascii	"K 2j8\252\252\321H%AE2\"\212\220$\034a\205\222\n\fEH\305\243"
+	.ascii	"\243j<B\241\256\302\025\303\225H\004\265\250h\202q(\024\"\016"
+	.ascii	"\211\324\343R\220\2050)\310\302\230\303bI\030d!L\3529\032\213"
+	.ascii	"F\243\032t\256\352Q\205\212b\216\252\324b\375\331\240BEq]\"\002"
+	.ascii	"\300q\310B\0304ZJ\241\026\255KJ\304\241\006U\251\305\032TW\f"
+	.ascii	"W\341\212\241Q-\342`,\256DB\025\301\342\272$\f\032\021\207Gk"
+	.ascii	"\261\230t\f\022\031\205\212\212C\243\252\024T\241\204\024T\223"
+	.ascii	"\204F\025A\"\34318<\036\215\033\212\206\301uH\\\332\031\201\304"
+	.ascii	"\302x\354Y\217B\025\301\242%a\212\340q)\305\221\307H<\006Y\030"
+	.ascii	"\203\352q)\250\342h$\352Y\203#\022`\202\2430)x\f\252EC\243Q]"
+	.ascii	"Q\f*\035\2230@\327\037e0\302j\024\256'\214\210\303\"\243P\005"
+	.ascii	"c\261\004\222J$\n\217\2104\330Y\177\024b]RZ\227\212\301$\025"
+	.ascii	"\224D\034\215\352\212\241\261\250\303\213J\252Q\304Z,\032E\344"
+	.ascii	"\254A\364h$DQ\034\236\307\240\321P\005\2618\302\n\225\204#\322"
+	.ascii	"\322\tFu%\252#\370\250\253\320D\222\n'\350\254P\213\356\032T"
+	.ascii	"\300\320J\034.\245'P\215*\202\307\243PI\205\"R\020\303\032\004"
+	.ascii	"a%\016\227\320\017\r\215\320\201\003\031\250@J\024\342(b"
+	.string	"=2\032\"\251\020A\034\n\223D\020\031\217\"B`P\\aT\217\301\"5\311($.\005\207\306\365\347?\212w\346a4\273\027L\304\204!s\003\205\214G+\311\227\270\366\342\005\375\242\347"
+	.ascii	"\027+\\!\371\320/\350\335\026\"z[\350\035jgR\321\252\332\222"
+	.ascii	"\362h!\217\257\3615\240\222&\221\244-\t\323\245\016E\343k\273"
+	.ascii	"\342r\342\245B\214p\341\261\005\3675\362\214X\027\335\324\216"
+	.ascii	"\236\030"
+	.string	"\233!sh\r\233\203\306\325\0179.\037\370\202\2345F\261\240Y\216j9\252\245Q-\367\357\357,\373\222v\302\301\241q\007\300rw\207\303\312\321\270\270\027f\324\3305F\253PQK\177\364\r\343\361\311\201\211r\263~kyu1\032\243Q\320(\350\024Kb\007*\345\350\224\r\320\210\331h\214\262Y4\026\306X\210\242AX\372\243kg\222\277\244\224\032\306B\345\306\r\027\215\3213\364\fE\0032\215\221\361\366\344(\032\ne\305\217\247\033PPe\n\306\207%\266B\022\276$Y\351\217\232\001\341B\303+F\022\215\252s\362\347EF\2066\331\340)'_\344\026`\\l\313\262\243M\256\227+Y\326\212h\360\"\375\3211\214\327ntq\211\235M`O\n\b\223\263M\017\236\026\020\251%YX\220dJ\31680\330\254\225\275\271\243j\223D\316I\032\027\232\306Nr3t4F\301\300P#\266\252\252i"
+	.ascii	"\\n\256\220|9\213\206\207\037-r\324\b\032v\311,\031\333B\303"
+	.ascii	"P$\312\324C\013_\017y\273\342\366&M\222QQ}i\rI\273 \005\005\006"
+	.ascii	"\354\213\r3\341z\373b\301\314\322H\310t9\343ez!3%\227\244\313"
+	.ascii	"\204K\245\360)A\n\021c\372\200\022s\026\204.G\020\034V\350\217"
+	.ascii	"\243@z\366\260|\344h\214n\241\\J\220Q\3064\276U\376L\336\021"
+	.ascii	"3T\2324F\265P\037]\310\265*h\276\254\342C\302G\246\307Y\005\225"
+	.ascii	"1\006'\b\017\223i\347\253\310\327\323\016\234D\313\023\260-T"
+	.ascii	"\307\351dF\225\257\270\034_\330\236\350Yi|\343\206y\006\004\354"
+	.string	"\n\311\203u\327\244\256\3619\304\2416P\033\270\r\024\"WH0 }l\215\317!\211R\241Th\r\007\244\271\303\261D\210\225\230\0364\216\326x\234\2211LD\032\2433\036\247\205\346v\2431z\3658\034Bf\2605F\255\036\007g\315\311\227\306(\007\034h\f4\006:U\345\211]\025\037v\243v\025\206J\035\235rJ2d\n\216\333Yr\006\314\215\306\317 \017\315G\233\320\214F\3350ns;K/jt\215\177\324\305\321\250\243P#H\374\314\222\026\30245Fa\234'k\013\225e\343\243/.\034\001\242T\322\370\b\370\017L\317\260\254\254\032\243OH\316H\3515F\235\036\247\223%\206O\b\312\224\201\0307n\3168\037\224\3015\021\003B\305\235\321;\343\234~e<h\260i\334\327\023\206J\250\3231\204bH,\306(L*\244\024R4B\233$\035c\025@0XD\036\226\312\266\315v\023"
+	.string	"\303L\214ui\242\005\235b\210fDR\222\202\222Ja\230\003f\360c\213;<@\0275\347m<\303q8\337l\377\264K\224\036\201}/\266\021)@e\016~\013}|\264\236T\340\372\034\250\212\226P\247&\300c\033\022\\\025a\017"
+	.ascii	"\267]\373T\312\214\224\362\275\225!\335\243+V\367\027&\224R:"
+	.ascii	"\365\261b\031`G\324A\223Y\245\334\200<\306.T,B\365\322m`\301"
+	.ascii	"\217V\b\276c\312\017.a\003z)\020\267\030M\364\017\235H\200\225"
+	.ascii	"R([ \230\366\2058\203V\320\324\256\363QA\256\264h\235\305a\365"
+	.ascii	"\235\264\345w#\267:E\215\303\312Ihh#\246\007F&o\2263l\323\312"
+	.ascii	"\023n\204\257\031\034\216A)\334q6\210x\3738\177\275\020g5\001"
+	.ascii	"\243\371\004,n@\271@_\017<\022lu[\337%7m%\002\250\242\212pe\210"
+	.ascii	"G\257\312\351I\254\177\3578?\024\235O\300\376\201\344'\2412\256"
+	.ascii	"\227"
+	.string	"K^P\\e\264y\333\336^\023\261\021e\026N\333\r\276\323\331V]\254\205\210\3521o\210i;\017\270\376\032GL\223\0271b\tP\342\200\027\307\266>J\212\tWK\361\003|\373Z\027\036\313j\250\210%\216#\374\035\364e\n)]\340\0245\265\302^h\005\242r0\340\372d\0218k\256\342\035X;E\225\261\275\031\256\352u#\240\247\320\264\017\266\220\200c\357\b@D\343S\375\002x\263\036\230s\243XD\230\265\017\241f\332\274{\305B;\333\377\316\264\354S\315\304\016G\222\371\212\021\306\006\007\032kh\274.\bW\214\262_\201\205r\213P.\323\204A7(\266z\325`Q\374W\201\246.H\265\254\266\202g\030\211\256\217\273b\224\206~6\303)@\357\325\002Y\265\023\304\335r<:\030,#\224E\335Bj\340\232_\310+\203\007\274\377\212{\252\3470\334\347\221\336YC\320\216\372,\2111\264"
+	.string	"\336vK6\001j\364_\336\246\377fz/\260\323`\3700s]\242\341\356\207\341\316\220k\357u\tW1\206\342\241\031\357U\t*\352}"
+	.ascii	"\257=\"\356\326\314i\253@j_zr\004O\246\362F\033\nlZ\262@\257"
+	.ascii	"\273\315E9\312J`\371\350\3675\022\327{`\276 \335m\002\223\021"
+	.ascii	"\226\026j\037\030\356v\303?\007\210\0018\337x\236\273\221\200"
+	.ascii	"o\177X\242\315\276\310w\257\257\304\036Mq=\241{\333\307\213\214"
+	.ascii	"\311\024\343A\363\017w\024~\374\227T\343\276\024\316z\3556\207"
+	.ascii	"\232\334\244-\211\244\214\355\322\317\033\036a8\253\202\313s"
+	.ascii	"x\231\344\245_!\236\0054\332o-\361\327k+\024M\226\276\210\325"
+	.ascii	"\215\236\270\035#4\201\031\343\322\375I\302#O\240%\033\271xP"
+	.ascii	"\\\217\367\321\231e6gn63\361\336]\006\267\206\024bMR\215:\357"
+	.ascii	"Y\231\333\271\214\304pZ\b\254\212\270\213me\027?X\201\217\b\201"
+	.ascii	"\325-\214"
+	.string	"\351*/\3277.l\306\271\217s\370|x\2259\345r\227\265\270|\223j\316\261\277\231\nK\274\267#\377\276;6u)\246'[Q`\325\331\227\245\254\261\252bNUy\n\022\371^\366\357\031\027\006\200K\207\313\033t\277U-\331\274\315\273\377\276\211\b\b\022\364B\245\037\\{\261\263\222\351]\247\327\337$%\256\311\330/\306\323h\0331M#\275G\274!\303\207R\274H\266d\315\275\224\263Mu\262s\346\2441'\0241\030#\244ay}\027\233\006\273\232j\031\253\315<Y\272a\320\203~\206#\375\023\b\326\236u\232G\250\301\016\200\326\243O\355\320\017\311\013\311D\326\214cV\303\312G\330\205a\b\336:6\371\345l1\356\375\177\022\024O\307\216 g)KA\206\211\303\352\216\215+Jy\032\314\240\241\213o\271\0230fO\007{'lZ6\215DzG\031\334\nY\206\256./ \354\377xtJ"
+	.ascii	"\004\220\266\3410h8\363\fD\340\242\\\377\004\301M.\330\005H\313"
+	.ascii	"\340\203\367\263>\023/\024\245]\315k\234\346\336\022\313(F\373"
+	.ascii	"\362;\335\254\021C)D\233;\340\234\006\375!\271\211.\220\353\""
+	.ascii	"\235~\005Q\342\225h\301\255\245?\023\221\236\3118/\207\372\230"
+	.ascii	"\r\241'\r\351\177t{cO\2551(dxh\\\2635\261\372/y\033\256\204\001"
+	.ascii	"%A%WC\323\305\213\016\224Q!5\2652\333\225G\376\322\0244\205\r"
+	.ascii	"\247A\177\236F\352"
+	.string	"\323D\216\303\036\214\017T\272\230+\022z\030&\374\355\363\203\214\370\243-\265\242Hg\205`\230\305\370|\237GW\363|R\276x\216*\2255\037c\201\351\274q\315GV\345?w\200\377\345\330\362\206\251\t\337\005\026G\2600\304\032\033*\242A\362I\376\n\235\026\003w|\304H\345\344K\"E\230L\006t\266=\367\303\341_\r\235\003\343\303\322\365\033R\031Y\343\tD\032kxI#\364~\256\006\240(\252\223;\353\\X\374\374\201\005\360F\362\037"
+	.string	"\016\203aTN<\01701\244\023\302\221MS\025\217\212\354\340eT\031\201\210\345c\373\030\024\245\236\201\373\204\341\300P\202\220 \302"
+	.string	"`~\350\366\021\213\007\224A?\004(_H\tPn)\206\007\244#o\302\250\341;\321\004\200\031\255j2B\352\350\341\347\332@\007\214\3405\217\242\205b\366\3167$\335\237\253\203\245Ak\2257W6\276g\345\\\317\200\257\262\016B\rIxQ\367\217\262\337\f\316\352\333\367\336C-\341\373\324X!$U\232~l\030\224\225\244{\035\341\277\375\376\260\253F\307\\\177\036\267\352\213\2721\250@\224^\2052\265\340\017m~J\246rk\263\036U\374\226A\225h\303\365"
+	.string	"D\n>\363\246\360A\315K\252C\f\006\317U\202#\203,\235\f]\224\262\205*\266\177aR\254\354\320L\341g\342\215\275\236.O\262\337\262\314\343\002L\350\002\351D\264\302W\222\234~\207\302~\262Q\004$\020\205\320V\"\312I\033\006  \030-uu!\260\215Ny-\335Y\376\350\315V\346\031\210\213\200\262T\245\210I\254c\224uK\024*'Kt} \340\310X\017\203\251g(\274\013V\r\004D\207\204"
+	.string	"\225\377\204\024\356\024\302\376\351\341\b9`v\032\221\233s.\b\325\304G*K\365\273\360\273O\243\007\335t\200\256\317\305~\364rP\226\b\3367Q\330h\246\337\243\271\222\035y|\340~\252?\337\314q\217>J\226\343\260\362`\254\264\214\351K\334\037\030\245\253\252<E\360t\245C\214/\342\033po\225!\362-:+\370U\300\303\2765}\025\243B\235F\277\226>\203\021\b\331\007\016\026\"\253\343\310\177\ri\345"
+	.string	" \272\371\3435\325?%$|\215\230\213\332\201\323v\311_\020d\033\206=E\320\207\315\331\323l\026\0343\003cU\331\271\203\355\n\2471uGL\236!\033O\355\023x\037\271\263&\275\013]\271*W (\310\032\017\214m\220R\326{\baf_hu\001\241\262\032\fk\324^\017\212\016\n'\262\r\271\203\226\212"
+	.string	"LF\270\211\034M\356>\270Y\260\021\231x\240\270\325\352\265\273\337\337\200\222\036W\024\221\305~\0266g\246&\322nJ\222/#\023w\022$\321\367\241A\305\031\\j4P\310\374x\340UU\377"
+	.string	"\3524\225y+\261\313\017\327\341+\342\232\365'4"
+	.string	"W\2245\352_p\326\026ww\370\b\252{s>\300\277 3\220D\001\303d\271\f`|\247\302\232|z\013A\n\212\312GH\262S\215\004\333\266\226K%\013\257\332\356\376\f\363\002\033)G8\323\336\275\347\363?\327\364vU\266\007\036\275\013\317N\212u\217<v\303g"
+	.string	"\332\224\375\223z\002\025\\n"
+	.string	"\254\220\366F\031f\240C8\347b\247r"
+	.string	"\226Sd\327\337a\033(\214\006\035a\021\306\300\256\242G\007\332\216\025\017\007\205\315\327\032y\351\370\r\334\316\347\312Q\310\246\002&\263d\245\365\260>\212\352/\310\246\034\221\246!\322\251B\223\007;\325\236F\260&\345\2028\263\256}v\ry\335\361c4\257\367\022\312\277\360W\0266\240\305\004F\006N\262\001\247\351&\233\271\3020\2568e[\233[!\320\237/\250\251\272S\3066%.\256\300$\267o\233N\334\t<\256\304\374Zp\024yr\327\271F\212\370G\\\244`V)\337Z\330\2342V\025\016\347\3059\214\305\275\205F *"
+	.string	"\242\347\262n\226\217O\220y\\\266\302\236\265^\301\301\242G\013\324\340\027\245\222L\327$3\321\316\215(\347F\300r\033~\b9\226!\n\256\305\004A9\251\362\002#\370\351\033\313}\322\234_\201\304g\264xI\007,2\\\365\216\312\021\345\002\357\017\036\026@_\211\345\310)%\330\234\003\331\231\004\373\231\310\361\022J\312\305\266Q\312a98\345\317]\307\027l\226\310s\302\242\365S\310\017p\037r\2510\360A8\005?r=\311H\310\fL\262n\352fq~\314/\017K\202P4j\373J\255\017D\257\314iG\377\n\220\242\346\215\207\020\307\001\006j\007\334t\r\254Q\275.\345\276'\274\320c\022J-\221\344\316`[\"tWi\260\217\270&Nr\264[\343\245\037\214\006\335\206\253\022\"\n\017~w\004\220\215\021\210\f{\025\023\224D\004\221\352\217U@\367eyX\271[|\246"
+	.string	"4\370@^D^\225\263\b'+K\030\312\362\032\351\323\037<|W.\004\202\243O\2158/+\351\212u\267$\275\230\264\244`l\252\211RU\210dx\230\220x\272\224$%\202\332\277\222\315=\353\210%\020\035\264\330PEC\275\236"
+	.ascii	",\242}\004\300\032%D\311\226\341\217Y\222-i\003q\271?\230\026"
+	.ascii	"\277\214\307\375y\206a\335\017\3065\355\033\036\221-\373\037"
+	.ascii	"j\035\254z\254,\nn\001k\241\364\270\024\362\331\312n\204 c\320"
+	.ascii	"\202g\0057\356vW\2331\316\007\320\007\013\303\2368;\307\375M"
+	.ascii	"\237\303\263P/\245\020\314\346\252\335AJ)+\357\250\264\237\207"
+	.ascii	"\021\237F~e\310\341GL1\244\312\340\335\215\214/\214\302y\261"
+	.ascii	"\351n"
+	.string	"A\204z8\266\034M\315K\251\253/v\277i\352\t\240)bhW\340?AB:R\177^\230\301\003\306}*\034J,3\222\020\237\365\360\352\275\371\347P'\177\f\220gP\210\352\335\326\243\255Ah\023[\227\251\225M\350\235\266g\351\232\031-*\017\225\241\007[)\f\311\0253\031Q\"\370\367h'\301\303\326\\\334\fB;\304U|\":\022\356\217\"\272\274\315\241#\177\320bi\271\226\334\336\030\304\306&\371\225\334\277j'cc\346q\235\037\311\275\361\334\247\376.\273\262T\265\271\376\377\245`1\224\031\001=\356$\232\272\364\003x\275B7vy\374\226\302\t\350\030\262\361#\333\243R\034\016\372\372\255\302\023R\305k\270}P?\235\277#\t\021\236 \334\021\311}\206\275\177\304\275\375k\205\363D\017\312I\f\271|\370+\247.$\371\263}=\360\257\372y\376\254\t\215\241\312.^(S\037\277\346\204\216"
+	.ascii	"E|\002\214\366\033?\303\235\337c\215Kyv\205\320NA\353x\233\305"
+	.ascii	"fg\232\223\177\036\240\324\351w\263\357\273\357\311*\372\377"
+	.ascii	"\302\257\031\313T\221\377\352\362LC\375\031\2646\304\261\235"
+	.ascii	"\3747\310\350\031fu\341\241\341\233\316\270\322z\337=\330\033"
+	.ascii	"/e1pZ{\026\3772\247\367\205w\377%\362\223%\037\241\034\211\302"
+	.ascii	"\225=\274\2311\026\316o\225\266\274\374\207\r\177\275\021\337"
+	.ascii	"\211\362\0014\334\210\317\367v]\347?\213K\273\037\363\357\250"
+	.ascii	"X\3551\340\367\341\2041o\344\237\320\271\207\242\001\366\376"
+	.ascii	"\277o\023\366m\335\031\364g\261\302\013\335)\370\023\243\307"
+	.ascii	"\003\370fi\003\256\236\005\364\252\322/\2469\212\327\223\360"
+	.ascii	"\016\202\325h\325\2768\367\005\306AE<u\270\347tg\340\365\002"
+	.ascii	"\3504\024\270Io\374\"\236\246\377\311\332;k{a>j:"
+	.ascii	"\356\340w\347oc\013\027Um\263\210Q\340\037_\263\373\354\265\375"
+	.ascii	"\263\306\311\227\017\273p\257\206\r#\212|\321^\300\027\354\205"
+	.ascii	"}\021\272\240\226\247@ yC\236\261Q7\310\"\021\035N^%b\017\371"
+	.ascii	"\310\022\274\265\001dA\3165\354lD\2660\016oGU\376\304\301>\005"
+	.ascii	"\303\037\357J\374\274\213|\\wB\364\202F\310\302I6UW"
+	.text
+	.section	.gnu.lto_.symtab.a9dfb1e0426082bc,"e",@progbits
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"servo"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"determineServoMiddleOrForwardFromChannel"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"servoDirection"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"gimbalConfig_System"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"gimbalConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"gimbalConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"getMixerMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a9dfb1e0426082bc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
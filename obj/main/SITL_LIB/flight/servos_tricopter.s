@@ -0,0 +1,293 @@
+	.file	"servos_tricopter.c"
+	.section	.gnu.lto_.profile.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375 '\035\001"
+	.string	"\350\033"
+	.string	"\003"
+	.string	"\242\316\326\257\007\002\002"
+	.string	"\002\001\002\262\374\202\245\005"
+	.string	"\003\274\205\242\255\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\003"
+	.string	""
+	.string	"\003\002"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375 \200E\002"
+	.string	"\024\003t"
+	.string	"\003"
+	.string	""
+	.string	"\005\200\200\200\200\002e\001"
+	.string	""
+	.string	"\002\004d"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\003f\001"
+	.string	"\201\200\200\200~\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"M\005\320\025v\216\302\362\022\203\347=,C\270\334\272\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375 \030\245"
+	.string	""
+	.string	"p\f"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\204\004\002\230\004\003\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375 &\275"
+	.string	""
+	.string	"X\032"
+	.string	"\002"
+	.string	"\001\002\002\001"
+	.string	"\002"
+	.string	"\004"
+	.ascii	"<K\200\320 \340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.a8865788cd057c34,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servosTricopterIsEnabledServoUnarmed.27.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"m\007"
+	.string	"BN46@o\323\001\230\016\004\267&\203E\002\335(F\034\247"
+	.string	"\025"
+	.string	",\250\275\031Hh\274_\271\261\361\020\256\332\030\3161L\314\201\300\210\340P:\254\215\361\374\326\232\224)\005\256:\321\322<XuEm!\303*\242\225A\355\301\341\202h\200\022\027C\004\254b\006;\034c\036+B\r\303\"\334|\334\247\325\221*\001\247\235\375\001\314U\365\241\224\316\023'\311"
+	.string	"v1\022\374\221\223(|\220S\266\370\344\275S\376\007s\352\252!qY\262\277.\265\303\376\264:\262\235\326L\177\322\230\004\250\354j\224^\226\205B\t\261\r\26276@"
+	.string	"y\023\310\320\226\223P\211\313\356\007\325\343\333s\363/\362\002\216\025Ot\361\314(\354\256\323\023m\334z\333\034\333\007\266?\002\t"
+	.ascii	"2\241Y\037x\301D\360SA\273&\372Ed$D\036w\243\323N2"
+	.text
+	.section	.gnu.lto_servosTricopterMixer.28.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375 \331\365\005"
+	.string	"\342J)1p\307\351\220,tB_\313\275 \360\016\355\035\301,\345\023i\206E\210\320\346\240\334\027t?\263\370\215fU\r\212\363\235\307\372\241\372\326\243\311\227[\246\247&Z\325kR\026\255\022ljh\205\311j\251X\027\212\314X\023\214\244(&\247\307\347UQY\347\244R\372z\331\213\f@\017o\347\370s:q\2713\n\300\215\265\377\323\"\013\374{h\366~\226\002\026aw(lh0R \370\277\322\263\177\241\361Q$\200\020\030\272[\362\300f\033\263\357\036l\202\353\264\215\210Hw?r\035\300\236\367\277\343?\344\377&\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_servosTricopterInit.29.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375 \306]\005"
+	.string	"\262\211$+pm:\240{\263\017-\302\try\270F]\0306 \324\304\213\265/\350\300\202?\235\243\252\3522\026\274\\\030\003P\204\350\357-S\277,\212Um^\031\255\214mV(\266q\215@2\311\203)Yc\302\027\335\330J|j\030\345:'\345*\354\225\340\301\"/\177\330E\311\371\027\320\022\374cE*\224\2725)T\217\002!\317\377\255\316\375&\003\206 \312\200N\335\315\262\263\334F\356\273\237\035x_\267Q\260\350\356G\357\333\354\345\376G\374W\374w\004\b"
+	.ascii	"3\003\316\231\001\340\313]\303W!\364\313\270\341r,\332I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375 z\215\002"
+	.string	"\344\003v"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\033\177\003\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\036\004 \034\177\005\002\035\177\006\001\037\177\007\377\037"
+	.string	""
+	.string	"\200\200\200\003\002\004\200\200\200\200\004\001$"
+	.string	"\006"
+	.ascii	"U\204Z\3412\\\366\264\2423\240\021\301\252'"
+	.text
+	.section	.gnu.lto_.refs.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a8865788cd057c34,"e",@progbits
+	.string	"(\265/\375`v\007\375-"
+	.ascii	"\312S|\022F`\236n1\177\376\365{\027\260<\2156\2341g2\236\313"
+	.ascii	"\203\036~`g\304:\241@(\030C\355 \213q\r\034\362\321J*\340.:\316"
+	.ascii	"Ld\372\2033\001\3704\265p1\204_X\345YF\220\271_^Z\271S\n\001"
+	.ascii	"\001\022\001\020\001\216\305\255\244\363\331\033\253\3048X\246"
+	.ascii	"a\341\230\373\237\207\206~\206xH\034e\300\260j\273\232{A\361"
+	.ascii	"\007X\245\361J\013U\273\250Zk<\206\240j{\023\326\267\370\332"
+	.ascii	"\271\364\254H\345\374\004\030PICC\325\034G\302\266\367`\333i"
+	.ascii	"\260\3551\033\344FV\307{V\237\342T|\031\301\253\264\227\271Y"
+	.ascii	"\363\212\363\317\350\227]\331\022U\273\005\333\036aM\237O\217"
+	.ascii	"\260v\023\333s\237\025m\236`\373\315}V\237]\314\227@\316\354"
+	.ascii	"\n\030:\205\237|\330\377L`\300\235\222\273:T\355\020OZ\251\353"
+	.ascii	"1t\020\333\016\264\372\323\201\326F\331\236s\237\265\333\231"
+	.ascii	"t\373\022\017\003J\343+\371\311\376g\036\002\263\326q\007\252"
+	.ascii	"\366\354>+\353=\253\303\351\3569\357n\217\353ngw?\357\272{A\033"
+	.ascii	"\267\353\356\272\356\246\353n\271\356v\323\335j\272\033Mw\207"
+	.ascii	"u7\333\335j\335"
+	.string	"\255>\237\317gwSu\373\\7O.Ed\257\031\317\362;\377\235\314\352\221\016\376\271d\244\263X\303\317\252\232XUS\212\262\317\377\217\340X\345%\277\261\031\037\221\377\217T5\375\361\002<7\377\2077\341\035\\\177e\365\237\340\370\017\3737\377\037\376\377\034$\327\374\277\325\213\301\216\307\177\345\317\361\271`4\253\177\224,\315Y2fz\311>4(L\260w1\303\016\366\316.$\313\204\305\376\352\377=\216\005K\316\200CU5\002`1\036\\P\265\321!i\234\354\226V\335\022J\024\037Kg\260\234(^we\034\215\237q3\276t\247\263\265\217q2dN\227bg\301\235\216\346b\322\371\354\3032\316[\223\n\030\334\351N|l\007\236_F\216\3273+\313\317\320\320\320\316\2178_W\001T\177\367Y{\250\221m\376\370\233/\"wql[\310\302\272X\276x\373\237\333\257t\373\326\\\213\253\2453\030"
+	.string	"\027^1\336\272\035\214\177\3610\276\3645Ok?s\262F\347\177\343\377\267\233u\373\332\327\002\217L\377s\250\201\275\222Kh\247-k\213\227\2719\247\363\266*\350\334\226\234\035]\273\361\330\216\f1\033\223k_\272\234\267\241_|\362\260\2001\030J\t\351\230\033\026\030T\355\264\b\333\276\306\335\332\331,\235\215\273\001\360_|\345\247i\312\266\222\314\275R)\364\300\213\2260o\332\335\300\351\374\207\375\377\002"
+	.ascii	"D\214x]\241\252\303\241\336\306\343\332\341\374M\307\350p\352"
+	.ascii	"\177\321\275\301\216{\003^\232\220\342rU;\265b\033\025\3036\332"
+	.ascii	"\275~\021\371\377Y\274\371\221U:\253\363\334\205\272\007x\352"
+	.ascii	"\016>\355\t\315\177!\262\033\326\210\225\342\rT\355\356\240\357"
+	.ascii	"$\3770\317\317\217\214\231]p<\306\226\344\231_\307\201g\356\370"
+	.ascii	"x\356J\252\362\243?\277\277\261+\271\"\236ed<\313p\357\2152\374"
+	.ascii	"?'{1Y\021\366\230\331\225\214\231r\222\347\215\017?\263\250\203"
+	.ascii	"5\312\311\370\213\234\354\305\314b26v%y\202\310_6`\260\025\255"
+	.ascii	"\270Xl|\254#WnK\025\004\021\340\r\n=\364\270-U\020\204\201\247"
+	.ascii	"\366%\262 Q\240!8\r\207\031~<\023$\226Z\247\024@\341\006\242"
+	.ascii	"\207\022\304\007\255\024t[a\313\304\366\005\243\tFGT9}\204D\001"
+	.ascii	"\211\302\332GH>\037\222\221\217m#_\372v\023\221\202\001o7\021"
+	.ascii	"\275QPo\324\360\3674\005UDt[\251\240\273\024\324C\250\326-z\207"
+	.ascii	"C\267H\300\373\313!2\001K\f\203+\361\307\024T!\034&I\265\032"
+	.ascii	"\210NQ\"\334\366\025\266I\275\366\005\216x\232\022\241#\325."
+	.ascii	"\245\357\317\310\307\256h]\025?\"\021\b55t\372\025\370-\265O"
+	.ascii	".P\030\365\013\272/\317\373;z\205\301\250\234\366\371\222\202"
+	.ascii	"L\204\350\300*\021\271\355\0135T\n\272\357\2178\224"
+	.string	"r[b\321\333\304\024tRQ$\f\002\237\212\224\\b\021\321\203\244\327\005\276$\230\204\301%\0278\345\01698\265B!\260I\t\250\273Q\230N-\263\341\303\2139\353\310\220\361%\243\3176\017o\263\031\252\332\3319\035\372J9-\003$+K\222\177\245\220\233\211\203\006\315\255\256\316\351\330\017\177\250a0f\220B\206\020$\030\231\231\231\021\027\033`\002\221)\264u\021`A\202*\250m\322\236\001\027Gb?8\377vP\304oGA/\365\211\253\343w1\217\037\224\244M\377\272\374\006\233\336\333\360c\207\240b\r\365\225\336P\330@\016\2071hb\3040\314\267UF\377\2573\234e\3403\262\224h5Sdc\243\027\356\344}%E\030\356+\325\346\r\367;\r\354\336\271\243i6\243\204\274\3672\222\256]\004\221\030\013Q\220\266\024\304\257\324J\334l!0\205\334\320<\206]\3723\352\027\323T\002\237\244V"
+	.ascii	"?\360\022\001\325\022\364\215\266\371(LC\2556\233v\235\331Yr"
+	.ascii	"\020\272M!\236H\017\027\025i\355\263\006k\016\353\3702n\247h"
+	.ascii	"T\033\276\002\337\327\344\340\336\033\313\204/EU9@q\300k\315"
+	.ascii	"%W\341\006\204\312\245D\b3\003\351\004o\f\307\322\t\316C\"c\001"
+	.ascii	"\372\310\235\302\357\343\034M\372>\236S_F\2474\004\nv\377\301"
+	.ascii	"\326\3472\261\350\006_\213\024\371\003V\003"
+	.text
+	.section	.gnu.lto_.symtab.a8865788cd057c34,"e",@progbits
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a8865788cd057c34,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
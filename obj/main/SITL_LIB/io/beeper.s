@@ -0,0 +1,438 @@
+	.file	"beeper.c"
+	.section	.gnu.lto_.profile.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 [\005\002"
+	.string	"\324\002O"
+	.string	"\013"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\004\005\222\252\354\340\007"
+	.string	"\006\317\253\250\341\002"
+	.string	"\007\b\t\n\222\252\354\340\007"
+	.string	""
+	.string	"\007"
+	.ascii	"?\207\200q\201Q\301\020\225q\305\034k\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\370?"
+	.string	"\013"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\003\004\005"
+	.string	"\003\006\003\007\003\b\t"
+	.string	"\003\n"
+	.string	"\003"
+	.string	"\007"
+	.ascii	"1\007\203\3034\033\001|*\203\265\f\272\2016"
+	.text
+	.section	.gnu.lto_.inline.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"U\002"
+	.string	"\224\002\216\001"
+	.string	"\013"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t\n"
+	.string	"\r"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344\001$s\0249\233Kp\023\217\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\350?"
+	.string	"\013"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\004\002\005"
+	.string	""
+	.string	"\006\003\007\003\b\t"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"1\007\203\3034\233\002\301TF\300]\024\3137\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004\n\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 [\r\001"
+	.string	"pO"
+	.string	"\007"
+	.string	"\001\002"
+	.string	"\002\003\004\006\007\b"
+	.string	"\b"
+	.ascii	"`\013\330\0076\003[\300>\227\315@~\033h\003"
+	.text
+	.section	.gnu.lto_.lto.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_beeper.45.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \351=\006"
+	.string	"\022\214+0\200M\032\003h*T\026\017\320\253\\\240\005A\231I,\264(\036\021QAMb\344iJ\206\216\021C\bLw\3048\024\250\273;\222-\267\224)\005\217\001^\236V\250\3700\357-8hq\r\026\205\213\253D\007G\r\024b^t\017\020F'\315\233U\235\"\230D;3\213a\264~\376\277\254jW\202+\316O\32199I\033\331\220\332z\265\356\260\207\364\007D\243\377\202C\344\237\007-"
+	.string	"p\233,"
+	.string	"\271=\016\200\334*\333\022O\215;\2443\3011\371\357X\206\245\227\254\r\342H\263\311xQ\020\376wi6\026.s[\202\266\006m+\002\b"
+	.string	"2\003&j\006.\234\301\270K"
+	.ascii	"\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_beeperSilence.46.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \273\r\005"
+	.string	"\002\t\",pe\322\001"
+	.string	"\335\353\371\177\304\017\354\343b@\255:\221\303\205h\t\277\366\006l\002\177\237\241\252/\336\004^7\306 \360\240\305\275S\n\256\250\031\257\030\033*-\205X\214\207V3\242T\301\362\212S%RN\235\272=\344\016\023H\261\273\354A\215\375\300B\316~\212gD\273\227"
+	.string	"\200\035\tB\035\333\237\214\331\244w\2345x,\025Piw\025n\216\375a\376?'h[\3667X\354\256\237\266anx\333\b\333\t\333\216\b"
+	.ascii	"3\003\316\231\001\340\313]\303c!\364\313\270\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_beeperConfirmationBeeps.47.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \341%\006"
+	.string	"B\013*2Pm\222\016$\203\310\"\242R\020\232\324k\020\202\206{V\331\221\020\373\350+\345\372H\030}V\332\204\231i"
+	.string	"U\034\256]/*\246\276\307\332\270\311N\001\036N\004c\270\254\311\264\325Y\313!\331&9\233\206\207\3244\210\314\f\314:\253\245\207\261\226\230\251\207\243\202\t\004\375\364Q\250\361\007P\034\275B\213\333\030i/VTzb1\361\370\017\363+\365\t\n\322\201H\214m\006II;!| p\226\245G\271\251\243\004\037\025\024\")m\0239N:%}\027r\227\220\350s*`\241\355*$\302\270\361~\203?\177P\t"
+	.ascii	"m\21173\340\234\031\036\276\3345\034:\204\241R\223\301]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_beeperWarningBeeps.48.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \340\025\006"
+	.string	"2\213)1Pm\222\016$\203H\t\210\312\346B\004m\220R\374\231t\217\277X\266\026L\347'l\364Yi\023f\246\001Tq\270v\275\250\230\372\036k#!;\005\034M\004c\250\214\271\264\265Y\313!Y&5\231\206\207\3044\210\274\f\3146\253%\207\261\226\226WT\240\002\217\232\370\327I*\364\bP\005\372\34404\322V\234\230T\204\022\242\361\243\345O\351\023\024\034rH\254\332\213\017\220\366!| \200\224\335\223\340\313(\301FD\341Q\3226\025\006:Ln\304\016\254D\237\016\246\200\205\266\247\350c\201+\374\r\376\374=\001\t"
+	.ascii	"m\21173\340\234\031\035\276\3345\374\034BS\251q\340\316-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_beeperUpdate.49.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \363\215\006"
+	.string	"\262\f.1pm\032\003\240{=\037\020\205\346J\214\252\323k\322\037\226x\316\f5\tAI\001-\201\225\354R1T]\241Bi\204H\362 \332\204\204$\2212\245\036\206\267\231\026>\234\027\343\203\024PI\023_\347=\007\007'\307\231\0326N\212\036\247!(\354\274\350>\020F\207\2317\0135\023\301$\332\tZL\324\232\362\377e\241v1\312\"\221\277\342\304\344#-D\003\323\326\253\365\310\034\322\035\020\275\374\027#\220\177\"\364"
+	.string	"\300-\343\201\212\033\305\002\025\267\312\226\3043\343\005\033\024\023\037%\377\035\303\260\364\222\265=|\241*\220\227E\341\177\027UY\270\314m\r\332&\264\255\002\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getArmingBeepTimeMicros.50.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \314\265\005"
+	.string	"\"\312&0\200\267\351\2003\242Y\021\026~0'\262\202\302\216\232\301\032\361A\232m\033\343]\275\326\232v\032`N\006\244\371\202\252\322\203\367\241\006\236\032\331;\245\236$*+)+qR\021CQ.q\242\231(9<+I#\300\2344B\334\276>\021\006\005l\356zp\263\337,D\260\237\345[\267k0!\261\020\316\203\202m\313\206|\2067X\256\223\001L\213,\024\020t\021\273\\\214\316x\3564_<w`\302\353_\365\357\360F\227i\327\237B\262\273~\231vp\303\333~\330\206\330\016\b\t"
+	.ascii	"2\003\202\341\243\302Z\025\220k83\242]!\310pW(\355$\003"
+	.text
+	.section	.gnu.lto_beeperModeForTableIndex.51.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \360\235\006"
+	.string	"B\314-4PO\222\016 :\203B\227\301H\370\016\240\270\200\352\266\270\232S\360\324o\355V\212L{\256\251`\303\002U\0253\t\023\260k.\207\331\236\233\261F,\3312\005\024\017T\273\303\261&\31749\274\212z\021T\003\304\353X\022\217Sp\345\231\2547QU\326\323d\331K\332\204Z\305g l\243o&\233\307c\003\351\b&3#\346%Y\\J\310\377y\315\217\330\222U\026\310\354XA\311\314\204\017\002\352\376;R\222\317\027\203E\bS\020\301\2708q\311\314\336\246\004R]\246\003R]\373\350U\274nM\212\034-\"\fT\004X\310\314Q\204i\364\326\337\340G\3707\002\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperModeMaskForTableIndex.52.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \360\225\006"
+	.string	"B\214-4@o\222\016\320\036\243\237\361j\3267D\331T\270Zt%\235\002\036 @k7A\217\315\035p\305\306XU<y\216\300\321\316\235\211\024yf\306\232X\262e\n\024\017T\233\263\261\246\31649\274\212z\021T\003\304\343X\022oSp\325\231\2547QU\326\313d\331K\322\200Z\305g\037l\243/&[\307c\023u\344\222\211\361\322\222*\356\344\343\367|\346G\354\310(\013dr\244\230d\246\302\007\001u\377\r\251\210\347\213\301\002\204!\200\210.JX2\263\247)\201T\207\351\200T\327<z\025\257[\222\342\306J\b\373\024\001\0262s\fa\031\275\3657\370\023~\215\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperNameForTableIndex.53.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\355\006"
+	.string	"R\21505Pm\222\016d\364\214Y\312\003`\332q\240\350I\210\316\026\250\324\377\200i\017\373\267Y\213\333\270\260D\035\00333\255\252:z\327\303\005,$\017\266\266\233%D\246\021\f\327\333\323\311\254\217e-@\354\202\016\227B\003\364d\017\260C0\366\2612\b\201a\031\324\304\354VmBO\342#\310=\322\367\222\231\371\333xWp*\365c%S\324\302\222)\224I\307\257\275\346w\356\033R\021\255\361\223\00123PJ2\363`N\246\324\346\362_\220\226\264\267W1\021\302@\360\020Q\230N\231\021\036;P\225\312T\240*\3658\272\325m\267#\r0i\250\220\214@u\230\204\314\334Y\214.\372\353\317\371\r~R\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363Z0\361\340.(\325\240I\230"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_beeperTableEntryCount.54.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \313\255\005"
+	.string	"R\n'0\200\267\351\2003\242\271\025\330\00351\034\271\032\261\031\273\246\312e\373\315\231\315\267\245\3275m4(L\214\210\362+A\245\367\3340\306\237\032\331;\245\256(*/)'qZ\261bI(\261\242\226H1</I\343eN\032#n\017\267\307\247\f\324\330\034\366\340\200}g\341f\277\310\267n\027 \002b\035\036\006\003\333\325\216|\204'T\273\301\341\n\264\305\201\300f\341aw\343t\t\372\343\\\001\375\201\004\257\177\325\277\302\245.\323\260\277\004dw\3752-\340\206\267\335\260\355\260\215\t\b"
+	.ascii	"2\003\326\231!\340\200\\\303\235\021\r\013A\210\273Bi'\031"
+	.text
+	.section	.gnu.lto_isBeeperOn.55.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \302u\005"
+	.string	"\202\311$.pe\322\001"
+	.string	"}"
+	.string	"1\252\260r\326\347\207\202\330\022\256\200\344\212-\"v\237\275\031\033\r\335g\250\352\353\353\230\326[\020\031\020m\210\354-S\307\256:\2659\033\222f\022\2221\036\022\253\021y\025N\265Y\245\204\322*\255\333l\005\206I\244\374\227\203\221\363s\325q\363\303\352\033q\b\325\335\005"
+	.string	"\364\0270}\376o\277\365\204b\273\345\353\351\b L\205\224\352\2762v\3302\264g\0261g4\247\222\3071\034,\272\373\320\342]\370\221\377#\376\037\376;\002\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8\\\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\245\002"
+	.string	"\224\003\n\001"
+	.string	""
+	.string	""
+	.string	"\002-\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002.\177\005/\177\0060\177\0071\177\b2\177\t3\177\n4\177\0135\177\f6\177\r7\177\016"
+	.string	"\013"
+	.ascii	"\200\036\340\033\340\033\340\033\340\033\340\033\340\033\340"
+	.ascii	"\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"(\265/\375`\363\007\305,"
+	.string	"zN\220\021Ip\032R:\017\350CU\016b\005\215 \232+\332p\207m\001\243\300\314\235\212\372XY\b\244\375-yB>\"h \372\271]S=\023\201\335i\\\252\367\323\351\301,\312\352\036\211\231T\2502\306\020\002\277\177D\265\221Jv\n\350"
+	.string	"\370"
+	.string	"\026\001\271\241\335\335v\367\216\221*\356\346\361\363&\213\305\356\251\003\305\246j\235O\335i\263\f\354\3702\221p\317Y\205\231l\250\270\315o\024\334\311&\2632\256\314vJGuwN[\223G\033h\251J\224\233<\304\270\231;7\307W\231T}\205533\225\274\305 Wy\004\n\327i\227\255\325\035\363|\340\236\300\265\245\352\213\326\307e\006\272\274Lu\314HR#U\337`\315YY+oe)9\276\272\204\233\331\035\373\350\2709\304\264\244\252P.\240S\363"
+	.ascii	"\335\377(\017`\325\024\236\256\317D:^&\322\265\275\275A[\343"
+	.ascii	"\2742fJ\2230$:\177\276\312\177F\376_\246\177\366\361\037\356"
+	.ascii	"\377\332\177\265\377d\377\317\374\207\206\375\177\376w\376\377"
+	.ascii	"\372?\342\177\363\177\225\377\313\377\274\377a\376\357\342\342"
+	.ascii	"\342\342\376\254\376\031\370\353Z\004\260S\367\0175\027\312\270"
+	.ascii	"A=a\353)*\"\236\224\361\311\231fy\376\272\233]\267Vw/\350\201"
+	.ascii	"{:\363J\325\303\311\\\377y \224]\035I\325\263\353\257k\327\330"
+	.ascii	"\3355rq\033\235v\272\234\313\231\350\367\311:\271\301\177\265"
+	.ascii	"\373>\321\356bR"
+	.string	"mU\242\305\355\221\252\377\205\332Iw\013\324q\033_\246U\373R\031;\002\305]\025\324L \375\306VG\025\356\264\343\316M\264:\266xc\330\370\306p\373\323D\270\355\216\217?o\323m\363\313\264:\276L\370\b\324\304n\233\351V\255D\370\370\212\201\217?/\323=\276D\253#PT\022\351\3435\343N\345\366%6\215\"\225k\374\201\2761\334d\335\271\371\324\306\006\335T\260\221\314\325\221\301\234\2404\234\260\270p\216\273\033A\321\t\t7\021\372b\301\335XN*\2728\241\215\241=$C[ T\035\365\324\235\240\343\356bw\033K\312\242(\233eeYMM)\025\365\361B\216]\261yV\313ih\256\264\322\376l\226\333d4\235fw\f\304\313\272!\244H\314\343q\266-\301\221\252\371M\216>\237e7g\023\340n7\237\361\334\272]^\316C9\017\251P\220H\272t\352S\256\365q.\240[\363"
+	.ascii	"]z\225&M&\243\261S\253Zn\251y&#\323\023\244\n+F*56\226\317\260"
+	.ascii	")\213\321\\\003\372ef\346\371L\346Z\263\004\362\376\251\342p"
+	.ascii	"f\211\255\211\211e\250Pw\374\324/\310\224Q\321\236\256/p\320"
+	.ascii	"gh&\243S\326\004\212d\fO\2324\037M7\353\263\227/_r\230\031\272"
+	.ascii	"$d\306\204\200y\016\023@\353\031\225s%\351I\204\355JX\230\214"
+	.ascii	"\244rN\227\"\023.\\\3623F2\227\326\305\013Z\227\347g.kK\254\303"
+	.ascii	"J\016\031\307L\313\0170\260\354\314\335nOYP\276\311\365\255\315"
+	.ascii	"\333\022N\336\312\316\334\030\326\221\256T}6\256\317]\331\353"
+	.ascii	"\031\313V\306\222\277\376\323\035,\202\301\fI9`\b!\333\364\353"
+	.ascii	"\031\002]\0045\300\020\016\201\033\n\b}*\224Tv\311\007\"hE\223"
+	.ascii	"\357\203\202\027\354\t\240\007\226\205\t\337\ba\220C\3200)\202"
+	.ascii	"\204\265)(T\372}`\227~#\226\204\030\206l\212 v\350;\301Db\227"
+	.ascii	"\002\370\003\n}%\00441\261l\006`\3607\364-\t\177(\200A\rA\254"
+	.ascii	"\022\220e\361\023\341\363\240\007\231Xa\3210\030\024\026\001"
+	.ascii	"\320]\351'd\201l\212\365\023\214\034\030\035\275\330\371\021"
+	.ascii	"\022\004$\b\272\037!\365zHF"
+	.string	"\275\365F=\235aR\023\tv\3517\\\207IGC\340\317\305\016\233\304\236\b~\330\275\327\323 D\002D\207U\351\201\220ebY\023E\301_\021\360\347[*R\0226\025=0p9r2\\o\007T\324\311N\021/!kp\331\215G\251\004\031\225\252\331-\315m\371\355\331-\317\331\021\263\233\332\355\346<\024 \347\241\334\323\210\313\265f}:&N\234\274\266v\033\333\270\245\b(\247\240\242l:\250Y\216\346\332\237j\200\241\250q4\246\234%\"2\"#iAA\322\001\320\002\221\031\253m\021p\245\322p\246 \3110\007  \315\340\312O\311\345z\255\027_\257\372\261\250\021\306\373;V\013\223!V\n\r\251\273k\231\273\3706jUUr~\232\037\206V\307\275\301\256\376\300,\033\201\374i\225\331\277\216\325\235%q3\232F\321\027E\271\244\021My\273\362H\006\005W\210A\244?I\001.\372\276\007"
+	.string	"\273\330\307m\313\242\023)\351C\013\254\001\374{\253\021\245\214\310\177\367\020\360\022\221\230G\325)V\022\202e\rh\360\"\257\034\360C\241/\335a)\337\030\311\220%\216\344\344\223\223|Hyy\"u\347\345\033j\320Uf\024/g\353=\307\b\253\277%)\331vk\273B\222\245\026\337M`r\311\223U\022\2442\206C\364\t\214ji\244v\224i\004\250k\343\301l\234\037K\231\213d\345z\254"
+	.ascii	"\213\321\024R\016\305_\202\2159K\235\330CN\342\370K\\>\037\030"
+	.ascii	"m\021\037\336\216\005\027ag>b\007\364$\355\200\317s\361\277\306"
+	.ascii	"\310\275\214e\320\365.0\315\305@5"
+	.text
+	.section	.gnu.lto_.symtab.62e7d93f5d2aa3c2,"e",@progbits
+	.string	"beeper"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"beeperUpdate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"beeperModeMaskForTableIndex"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"isBeeperOn"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.62e7d93f5d2aa3c2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1907 @@
+	.file	"displayport_frsky_osd.c"
+	.section	.gnu.lto_.profile.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"m\t"
+	.string	"\244\016\240\001"
+	.string	"9"
+	.string	"\317\253\250\341\002"
+	.string	"\001\002\003\004\200\314\324\344\b"
+	.string	"\005\234\315\322\307\005\006\002"
+	.string	"\002\001\002\002\006\203\214\247\213\n\007\312\336\235\231\b"
+	.string	"\b\t\335\231\366\261\006"
+	.string	"\n\324\206\222\355\017"
+	.string	"\013\f\330\267\334\237\t"
+	.string	"\r\016\227\232\363\377\r"
+	.string	"\017\020\021\022\023\024\025\026\027\030\031\313\211\332\263\016"
+	.string	"\032\244\210\203\377\t"
+	.string	"\033\212\355\300\270\007"
+	.string	"\034\307\373\372\231\016"
+	.string	"\035\036\037 !\"#$%\307\356\346\263\017"
+	.string	"&\374\363\3124"
+	.string	"'\365\315\257\266\017"
+	.string	"()*+\337\353\247\276\n"
+	.string	",\310\225\313\200\002"
+	.string	"-\334\317\222\204\002"
+	.string	".\341\345\355$"
+	.string	"/\354\310\222\225\003"
+	.string	"0\242\363\323\343\n"
+	.string	"123\264\233\356\375\t\004\002\003\0024\217\215\236\360\001"
+	.string	"5\325\203\205\227\t"
+	.string	"6\240\342\234\212\n7\273\266\332\202\0018\367\202\306\263\007"
+	.string	""
+	.ascii	"  \020\0039\321\003C\201\021\343jb\224\356\220\307-\2033\356"
+	.ascii	":X\206\350\214#\035\314\220\216\333l\270\306y\006s\2108n\037"
+	.ascii	"\354\020\343\f\306!\364\301\215\301}\324\032C\331\340\343\034"
+	.ascii	"L\206,\272\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`[\004e\n"
+	.string	"\242\013$&\020\317$\035O"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P"
+	.string	""
+	.string	"P\371`?\360`?p\024'I\222$\211iPHl\244\221F\310\3362\005\377\267x\266\242\367|B\032\177]\264\211\022G\364,\304C\035\334\277\214\206L\206\351\037\306\002\216\247BO\350-\302\001\032\\@\220}\r\bd"
+	.string	"@\250\217\240\217\247\303\331\270Wi\334\252X\2172\230\274XZ\245Q&\222\b\005Ye\017G?\352\263\376\352g\324\366\032}\304\346\324\357\217N\352m\310Vb\263M\335)f\026\001a\250qA:\324\312\326\001\360\002\231\251m\033\022"
+	.string	"t,\306t\034\222D!G$\020\211*\242\274\236\003\322P\310\250\t=\t\316\030\365\022Cz\236\335\224 E\305\024\326@\326\030)\035\2735;S4m\342<\2105Ji\231D\303C\321\217'n\344\034\216\034\317\324j\231\016 x7\037TR\301"
+	.string	"\330\030zt\"\211\377c\276\320\206,A\315$\254\357\006+\b$x\007=ON\005\301\300"
+	.ascii	"\201\242\341\363\334\016\335\275\323T\200\221\373\255*o\242l"
+	.ascii	"\302\372\210_5\021\306\026\241\227\354\316\200F\276\021O,\244"
+	.ascii	"\033\307\221\0077\2020u\025\006\206\266\350\304|T\030!\277p\317"
+	.text
+	.section	.gnu.lto_.inline.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\306\n\325\022"
+	.string	"\206\324D80%'\035\300@<\301h\322)PS\336\226,\2630\201\257\200\201M\017\006#j\005\035\006\"\020TH\177(\351\001\241>\207Z\034j\215\324\255I\223\266\311&[\312\224\0021"
+	.string	"7"
+	.string	"5"
+	.string	"\032w\351\311\262\306]EJ\332]\312\234h]\244\317U\352iw9vHG\032\263\273\226\251\247y;\241\315\262\273-v\332\337rwW\355\022wL\001\336t\243CI\345\253<\005\352\272\256{\006\r\363\344\316g\220J\225\2476\273\353q\002\302\201A\001\301\200@"
+	.string	"\006z\266?\324(\243?\036h\033\253FI\272:\3268\007\031\264r\345Z\332\335\313\032\031\030\331\237\027\234\374o\241\266=\317\336\024\252jVPLHD@<84h2\304\274~\3467\375-<}\347\024\254q\224m\020t\276;YS\272\221\261l\222\272$\3362\355\022\340\005\306\362\210F\222H\b\310\3073=\236\177\332\221\021\300\356V\346Pn#b\216(\231\306\234\242\227e\372i\376\355\366\003\200\223\250\361p\307Dk\310\260g\220\002\021!\242\252\007\022`\0039\001Gq\210\" \212\b\210"
+	.ascii	"\t\t\022\020\207\2148\022\314\r\335\016\260dVa\254\247T\367\264"
+	.ascii	"\353gJ\202)\341T`:S\360w\033\022\262\200\242\351\267\210X\"\032"
+	.ascii	"\267\352O\316\236VJ\242\306\"\\>,\013X\315\330\316\177\252\302"
+	.ascii	"\365,\225D\017\225B\340;\347\366A\227\377\214\374\275 #\t\205"
+	.ascii	"\314\304\340\220\204\023\241T\004\362\301W\222\302t2_\036\204"
+	.ascii	"\022S[\362\362V\235\032\2455\351\341\341X\234\210&\317S\316\034"
+	.ascii	"\013\271\315\362R\311\0301`q\251\216_\205)\257+,\2206\350\005"
+	.ascii	"b\226\007\331\311\030\022\034\246F\016W\326\322K\213\376\355"
+	.ascii	";\364e\357\251\020\360q\301\253\003\327\036\245\253cv\377\252"
+	.ascii	"\033\346\301\312.a\036 \255B^\320\260\363\347U\f\360\242\371"
+	.ascii	"\240\252P\210a\363\266\266``\226\016\206!\322h0\035\177\212\004"
+	.ascii	"9\255\327\302\213E<BU&\301G\261(\361\201\214[Ap)\243\214b\332"
+	.ascii	"\231d\234\035\003\231\216*x`]\333\036HCh\350\341\301rG;+\267"
+	.ascii	"\367\222\007+\374X\256\322\016\235\231\2659ai\002\024"
+	.text
+	.section	.gnu.lto_.jmpfuncs.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\375\b]\021"
+	.string	"\026\024@5`U\223\0160P\240\n\202pT\312\216\001\f\020\004\341\330\266E,\001\001"
+	.string	"g\002\022\351\377\373\372i(\327\337\327\377\377\377ff\215lo\263\204\220\275\345N)\005,"
+	.string	"4"
+	.string	"6"
+	.string	"\2142i\f\023W\242\013\340q\344$O\304\311]\331^\021'~r\373\225\354OR\035\265\356\365s\331g\016q\271\033\337\332\r\351t ~\004\354\001^Oz\206\024\352\347\350IE\t\365s\325\352\252\335+\357H\364dOJ\343i\b\007\006\005\004\315E\031\314\305R\241p\245\021T#\310\022\205y\034\037\373U\362\224\264\002\031X\265\367,\267\304\301h\035'\362\304\213\242E\005\253\330\246\376\364\364\353\354S4\346\220'$\"\032D\345\241\324{\314A\323\300P\277\320B\003-\365\336{n\346"
+	.string	"j\0036\310\230\257t\247\331\235vW\300\345\013[\020\374\364\342\375\321\242G\007Gq\003\023\375\241n\324\360\363\246\325\233\026\200\207\250\200R\321$I\2065\240\002\221!\243q\003\022\3001q\024\3029\234S\212\004#\001\305H(\022\210H \211\222\302\r\3201\370\301\332v\022\0052\210\025w\376\366\030\233e%<\330\346\367\216A]\003\366\300x\\\036;.t"
+	.string	"\331\2658;\364\274\035\300&l[\305\303\357\030g=+\351\203Ht\033\334\276<{%\023 \007\242\252\303QQ\366\024Rr'ROQ:5\3236eBsB\335`-\030\353b\034\246\377\305Cr\301\033%(\257\270%f\310 \024|{\325{j\030\006#\034RI\205R?\356\020\260\246\331\005\250\216"
+	.ascii	"? \234\371\004?\246\323 f\304\302\236\200\230\330h\236\321\364"
+	.ascii	"[w\321B\f\203\347%\230\177}NA\033\177F\034p\234\033\3737\200"
+	.ascii	"1\3574\257\217\256\221\215>:F1\tX\031t\034`.\0254Z@\304\210\320"
+	.ascii	"\211\210\300B\210\250\204\220\301\350\340\324\350\031j\343\344"
+	.ascii	"\240t&\337Y\002/\307 \230x\2238v\376_%\354\260R\3435\376\006"
+	.ascii	"1s\225\3354P3X&\031\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375 \246\255\003"
+	.string	"bJ\034\0370\205\265\006\200\366\300\302"
+	.string	"\r\f\f\f\f\f\f\244\305\b\245\224RJ\322RJ)\005\344h2\032\200\313<\346\006\363\227\273\274\345,_\271\312S\216\362\223\233\274\344$\037\271\310C\016\362\217{\274\343\034\337\270\3063\216\361\213[\\\363\212S|\342\022\2178\304\037\356\360\2063|\341\nO8\302\017n\360\202\033\301\247o\340\023\370\002>7s\316\005\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\007\002\215\007"
+	.string	"\342\b\"/pU\222\016 \377\377\377\303\300\325\377\377\177\373\377\377\377\037\364\323Zk\255\265\364\377\377\377\377\237\307s\177\333\332\304\272\216mk\033i\255\021\271S\237\360\3015\370\313\312Mk\302.\013\br@ \240"
+	.ascii	"%\322\225B;JQ\b\324\217\347\251\303\371m4\315D\nsIK\345\2122"
+	.ascii	"\371+I\344i\031\366\020\362p4.\006\265P\300\004\342\357;\\\203"
+	.ascii	"\005\217\261\361\312\315\352\334\334\347y\326\2165\013\273R\323"
+	.ascii	"k\346\bw!@\250al\264\254i\317\020\003!\333t\020 #\0201g\223c"
+	.ascii	"PY\312\322\217&J\0168/L~\324\371\027s\275oo\334\260\205_\f\367"
+	.ascii	"Er\253\026 L'\373\246\370\306`S\023aw\017\253:\f\300\203\322"
+	.ascii	"\322\344\243\024\260R:\035B\344\205\377\004Ds\022@MDF\005\216"
+	.ascii	"\232\276\252\r\231\357\tA\356\231\017"
+	.text
+	.section	.gnu.lto_.lto.458485c6f2c8f7dc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_grab.4.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"M\007"
+	.string	"\342\31526Pm\222\016$\243\252\214*\271J\2705%\247,\316\250\2116\216U\230\231\335\250vl\022\006b\274\031\366\3174\262`m*\001\325\003)\2720N\323\342\267\337\210L\001#\370\030\256?\033\020\366:\244\007\f:tF\360\211H\036\b\021\026\002\271\027r\022!O\204\373@\314m\016~\242\006\350F\357Aw\305\354#TCQU|,\265J\343{\311\n\365\355\332\030h\311\274haI\025\013\305\343\317\376\372\333\276!\025\311\032'\032\220\211\"9\311\214\t+dj\0353\377\375(H\366)\227\330qZ(\261H\255d\246\323\224"
+	.string	"S\353R\001L\255\212\243Y[v;\322\202\224\211\351Tj\003\340d\346\315t\302\350U\177\203\237\363g\004\n"
+	.ascii	"\3043\241L\213`XQ\201\272&\212X\210\nL\020p\302H\265\322\021"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_release.5.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"E\007"
+	.string	"\342\21525@\215\222\016<\314\315\n\002\356\177\207n\241j9\225\241\272#\230\200\0265\242\2255\376Y\f\025,V\370\232\215q\203h\236S.\233\300\t~\006l\003\3557\"S$\370\0262\2038!\354yJ\016\030l\360\220\340\033\225>\017#L\024rO\344\"D\037\b\007\202\230\343\030\374F\f\320\221\336\203.\023\263\177\320\315\204E\361\321\324,\215\257%\255\324\267\200\nMJ\346\305j%Q\256\222\216?\373\314\337\366\005iH\326(Q\201\314\324\bIfD8\001\323\353\210\371\257G?\2627\261D\016\224\302\211\205J%3\335\246\232K/K\007.\275\254\215fm\331\255H\tT\253\023\312\324\006\320\311\314\333\t\205\321\255\376\005\177\347\317\b\n"
+	.ascii	"\3043\241L\213`XQ\201\272&\212X\210\nL\020p\302H\265\322\021"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_clearScreen.6.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\305\007"
+	.string	"\022\21766Po\322\001\2408\2761\347\276\244\321\3402\354\340J\030\374Y\205J\204\331H\fz\357\b;\262\240\231G\275w5b\263\026\216\207\266P1\313\001ci\324\b\331;\245\331\224\r\225C\035\021&?\032\0046\037>\331\224\227\006\212\2700K\024\245\025',\220D\fM,v\020,/\207\0313)g\254\352\336N8\005K\351\002\216<=[\253x\347\314Y)\215\340f\327\355\301\r\373\323B\222\r\003^\bZv3fd\266D\245x\330\246ve\373\317\276\310G\350\253\305\005vI'(\273U\301\013\233S\256\033\333>\310C\250\2552\325\216\216\301\005\243$fwc\3019\232S\323\0074\247 \307\351\037\365Or\003\023\030\256\333\376"
+	.string	"<\273\353\307u\0327\274\355\003\333\036\333\037\001\n"
+	.ascii	"\3043\241L\213`\330X\205\354\232(b!*0A\300\t#\325JG\230d"
+	.text
+	.section	.gnu.lto_drawScreen.7.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\325\007"
+	.string	"bO76PO\323\001\200\340\230\231]\262\300\202\373\007X\024\230"
+	.string	"\212\311\360F8\213\215\230\335\033\033\333\241\351`lk\263Dz\256p\371\320\026*8,\037yb\330\204\354\235R\031\235\f\225A\234\0206=\332\003F\035<\031\235\227\366\201\2700+$\247%%\254O\204\004QLr\016<\257\006*\2639\251\254\352\336F\370\004\314g\021E\226\240\255Q\300w\336\270|\242\310\331\225\203Q\303\276\264qd\307\200\225\001\225]\214\230\227\375&\224\016\333\233]\331>\264\037r\221\355\265\342\002\273#\223\223\335\232`\205\314'\327\3145\324'\333\376\307A6;E\252\034\336\202\313\005I\313\356J\202o\250O\3225\324\247\270\361\355p\363?\362\202\022\226\316\343\016\001:\273k\330y\031w\274m\003\333\035\333\036\001\t"
+	.ascii	"\3043\241L\213`\330X\205\354\232(b!*0A\b\251\333\235v\222\001"
+	.text
+	.section	.gnu.lto_screenSize.8.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"=\t"
+	.string	"\366\221@90\345(\035\2363b4\241p\f\213AAH\205\335\002\210\367\250\202\306Y\235\0316\213\353\200\332`\364F\231\214\3757\f\030\201Ca\300X\360\255\002\n\036\306\022B\210\224)\005/"
+	.string	"0"
+	.string	"-"
+	.string	"\237\207J\363(P&/\273\0135\037\310\216]\027\310\216i\307\273g\347\277\344\330\005FKJezj\235\335u\246T\026\267\336\366\306v\307\266K>&\323`!H\331\255h\001\330\025\f\345\303vggl?\355\217\234\244\373'\361\200\335\225\312\311\356W`\003\3141\177\030\333~\310E:\233u\005zT\200S\266\234zU\275X\023 ^\266\036R\237\221\245\r\021\221O]\0176<5\331\237)\225\303\376\265\272\2625\255eZ3\235\231\001\244-\"d\f\342\204\270\350)-p\233\202\207\264\305Q\351\3030\342D!\030E\320A\364i\200\240\215\203\234\215\343(a\203\244\0307\230\371\366\266\246\232\223zV\325\002\r"
+	.ascii	"\3043\241L\2130,a\b\002N\3244\202fc.\344'\231\275\022\214=h\367"
+	.ascii	"II1]\223\f"
+	.text
+	.section	.gnu.lto_writeString.9.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"e\013"
+	.string	"F\325MB \213*\035\247\202\00149R(\324A\343~\357V|\321\205\002]\002\035T\004'\332Z\255m\370\341&\024!\017\310\013\236\f\366"
+	.string	"1\364xL\320"
+	.string	"p\357\024\2370vo5|\207Q\244\021\262\345N)8"
+	.string	">"
+	.string	"6"
+	.string	"\266}\326[\242\275a\216\fR\023\022\3124\001\304\356v\226Wl\327\346)\266k\272\340\342\245\350\337\302\347\003\325\207SJt9\331\330]\313S\n\301\255\267}\261\rb_$\033\32348\260-\332\024\333\023F\300\242\262\007$\\\370\240\320\300\343\025zeI\035P\035*m\215\214xW\310\272\233@\306qi\037\302#\210\037\r|bw\205!\303\356\230\341\fw\315#\027z\225j\017"
+	.string	"\345O\266\224T\344\251R\257z\215Py0\205\030\311\231=\212\244*\260?WW\366a\377v\327?\377\372U\223\226\232\364\271\255\305\341\242\302.j&\013\340\2770\334L\320\013<\374\274\020\2129\230\016\350i@%\340G\242\t?\357\003\332"
+	.string	"\370\200\236N\347y:\001\236M\200\216\363\201\035\346b\3573\362u\241\347}\035e\334\333\030\227(\261b#%\231\223[\025"
+	.string	"\3043\241L\2130\314U\b\004\314\001\\\023\235\261\241\345\026b\034J\004\203"
+	.string	"~`00\b\300\031\f\3433"
+	.ascii	"0B\240\302\301\335'\325\212I\230d"
+	.text
+	.section	.gnu.lto_writeChar.10.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"e\013"
+	.string	"v\225MB \251*\035/\307\221\005\220{\301`\307\261\024?<40\300\024H\230_c\001\253 \273\226\025Z\303\013/\300\b\006\2203\334\r\214\001\262L\364\335\002"
+	.string	"z\247}\3028\202\031'}\252}B\266\334)\0059"
+	.string	"?"
+	.string	"3"
+	.string	"\027\333\376\200\023\020\355\006sl\251,\246\026\312"
+	.string	"\205\335\3452\227\330\256\315Gl\327\024\300\305K\321?\202O\001\253\t)\025\351\322r\261\273\226)U\312\255\267\255\261\315a\277\013\333\003\b\023\nvQf\026V\2461\b`[\2641v\314\265q\240\245\001\033\375aM\021N2T\332\026\034\361\257\221uW\245\002\306\245}\327\013\210\037M\016\261\313J\260`w\2540\347r\315c*U\325\006I\344S\316\234\224\344MUS\251\237zmXI@](\311\231=\222\244\256\330\237\273\273V\226\375\327\277\035\366k\217\375sJ\353\224\226*}\206\335\2770\364L\321K\036~^\007\306\335\346\003z\035\021\b\370}t\302\317\013\211<!!\020\364\341<\0207\002\362\210p\335\007r\033\215\275\220\307\307\205\236\367q\230qoS\334\341\344@VR\223-\362\001\026"
+	.string	"\3043\241L\2130\214`\b\304\205<0\007p\327l\270\t\020\024\001\343\300\300"
+	.ascii	"\0270\016\f\f\360\bF\360\031\026\314\025\250pp\367I\265b\022"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_isTransferInProgress.11.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"M\007"
+	.string	"\002\31636Po\322\030 [\211RPj|\nw\007\322\212J@\247*\264z\037=\032\202\250\017dg\0264\363\250\367\256Fl6\274\027G\026X\2718\367e\263\220H\266L\001\233\214\f\327\037\rH\213\235\320\203&\035:\233\214Y\310\003\221i\030\bF\fJ`\236\b\370\221\032\324\034\034\263\006\t\267\030%\274\346jg\025PP\243\237\242Gi\274\002\354\356N\231\376-\234ZX\bNvI/.\233R\231t\374\334_\377{\257 \032\302\251\310\204\006\354\232VN\2733\341MF\253\247\016XZeT\300\322\352_a\303\335\351\344 aF\037\025$-\273\023R\033\332\351\353V\035Q\003\017\224\f\225\222\222H\037\206\263\273?\213\322\205N\351\217\360s~\214\b"
+	.ascii	"\3043\241L\213`\370\250\260X\005D\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_redraw.13.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\205\007"
+	.string	"\202\01656PO\323\001\240\\\354P\001\207\002`o\001\2461\346b\f\006c\224f\262\330\210\331\275mn\207\246\203\261\255\315\222\260\267\032\027F\025\262$\262\242\3026\333m\357\224\002\027\235\n\223=\232\21759X\203E\0318\027\235\025\326q\250,\352#'%!\250\316\203\364PKj\f<\253\005*\2579\251\234\352>Z\3109\341\243\233\200 G\317\306\"\3367\277\222\216\016\0045\273j\017b\330\217vw\r9\033J\036*\004,\273\025/.\333\305\024\216\311\366\237}\220\207d\027\221x\300.g\202\262[\017\214\220yt\375"
+	.string	"\3461s\001\314\2433{\345uc\245\213\023\n\222\226\335\225P\343\331_\346\177\344"
+	.string	"[H\373\2236\273\353\267\205,nx\333\005\2667\2663\002\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_heartbeat.14.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"U\007"
+	.string	"\022\01635`m\322\001@\203"
+	.string	"\303\340\313\307)\316\322\255\020\254\272\033,rB\rC\326\256\341$\373\262'\302\003\265\256\313\002Y\267S\233M\2032W"
+	.string	"{\233\264\275\367N)\330\224\006\224=\232\317%9\240\204k\"p\260)-PG\301\272\252O\224Ud\250:\013\3213\257\250\311XZ\0073bR\316H\325\275=p\214\203\023\3315\324\034\205\375\267\216d\267i\344D\240\264\013QJY\023(ra\233\332\224\3557\373\033\347\240\257\r\277\354\222>Bv+\201\013,\207\256\026\333~\3065\250M\362\252E6\211J\036<Pv7b\036P9|\007\250\034\272\212\3237\352\277\343\017C\002d\224\205\336\246\315\356\272\215\262\210\333\335v\306\366\306\366D\n"
+	.ascii	"\3043\241L\213`XQ\201\272&\246X\210\022L\020p\342I\265b\022&"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_txBytesFree.15.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\235\007"
+	.string	"\202N56Po\322\001 vS\323\236\256ER\340,\023H\226\031\356\247\0255\0028\032\202\250\017dg\0264\363\250\367\256Fl9\210\213\225C\225fA\001c\032\"\204\354\235R\332\224\r\226?\033P&;!\210l>t\264)\261\220'\002\313.P\224W\234\270<\022\3613\263\270A\260\304\034f\324\244\234\321\242{[\240\326Z\317U\232\nhaS\321\203\034\366\247\205#\3731l\351\305\300e7\243\306l\n\205\342a{\263-\333\357\331\027\371\310vJ\361\201\335\021\313\311.U\360B\346\224i\306\266\017\362\220\315\334D;\272\200\215\226\213\222\322.\215\232\027T\247\246\023T\247 \351\334\037\347\237\344\007\0370*+&\235\350\017\200\263\273~\030\235\306\ro;\3016\3076)\n"
+	.ascii	"\3043\241L\213`\230\245\202uM\244b\201K0A\300\t#\325\312K\230"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_writeFontCharacter.16.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"\375\t"
+	.string	"\266\323F90\255\246\003\230\020\207Az~P\022)\241\265w5 \321a]\001\356\316g\357o\266\207Pk'\330\312vaB\241\244"
+	.string	"\210\246\006\354\n\371\221\024e\316>\243&B\366N)4"
+	.string	"8"
+	.string	"2"
+	.string	"\333\265\356\001\3335\3336\330\230\026\375\314Hq%\224\323\353d\367\364*\306E\247\"\377\257g\033\026&(\325\350\224C\330]S\224\252\342\256\267\235\261\255`\277\022\261\224%\321B4l\233\266\305\266\346\212\030\270\254\351\203\225\220\235\3670\337\n\321\313\232J\024\007\335\265\013\245\324>\307Y\346;$\016\260\273\022\001\331=\013\274\351\256\371\274@%WhV_\355\021\202\036\265U\314D\035\231\326\327\237`$\032\263\317\021\255\027\366\263\335]\327\225m\352\355\256?{\353\247\033\3659\016VB0\262\233\n$\003X\3110\374\262\016\350\371@\245G\354\fj\302r\344\204\032Jr\201\003\"\307O\350s\370\224b\350\215\242\347\021\277\007\017$KO\223\361\370\351\220\036h\034I\317r\356\275U\f\251\006\r"
+	.ascii	"2\003\3020\021\341\352r\315\336\231\020A\2110\222\204\270@\370"
+	.ascii	"L\215\202\313\222\246&\232\256\371\004"
+	.text
+	.section	.gnu.lto_checkReady.17.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"\315\013"
+	.string	"\246\026SB o\233\0160\261%\007\3009\031 \364\352\201\225p7?\001\004p\310X\fX\020J\240\343\003\033!\352\003\2023\272\254\354b\214\321\250\017\0060\255\004W\242\007\235k@ \2604\260\355\254u#R\246\024@"
+	.string	"@"
+	.string	"="
+	.string	"\266\235\240\243\343\356\021\004\312\245$\203\311\210\321n\254\364\303\273K\232\235\217\371D.\301\rWIA\311\250\203\200\217D\n\320b\302\362\320\363\344\3632/\036\273\353\364|\032\356\351\266\031\330n`\177#?\365\370O\351c\036\244\214b H\261\213R\203\306\256\230P\204\260\335\2613\2665\037;\003\227\341BE\305\202L\373*\027\3219\b\303\007\354~J\210v\343\206;\340'\307\027\240>\301\023\240>\005\251'j\217\021\365$"
+	.string	"I\251\255U\310{\240Jn!\002\245\250;\352\na\345\005I\266\230J\333\302\205\274\347\372\320!\313\t\321\f\030\236\212\330\321K\365`_\332\335\265~l\247\341A\001\231uq\232\215\322\\\231\305\3412\f\372\342"
+	.string	"\341\264\217\020\t\334\026\341\203\263i\233\020k\302\206\303@*\r\2532\314\242P]\033Wq\034\260\266\321l\025G\323\266*\023G\256\037?t\007,8\2200\221_\271\025j\020"
+	.ascii	"]\b\270\323i{\204\312\302^C5\005\274\262\356\265\032\326\323"
+	.ascii	"\005\335\274\233\312\3261\202\034\270[\200\262\323T{40\265\007"
+	.text
+	.section	.gnu.lto_beginTransaction.18.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\204\001\325\016"
+	.string	"6\334bC\020q\224\016\030\002\233'\272\320\327\220\020\272\302\333v\224\031"
+	.string	"\340Cym#\026\027\253\247\366\357\313j\375\337\307\327\213r\216\351\013\352\027"
+	.string	"\252\020\340Q\205\n80Fr\020i\343t\300O\310\336[\312\224\002L"
+	.string	"O"
+	.string	"N"
+	.string	"\235\002/\310\016\335\275@<\314N \036:d\327x\247Z,\025\242\324\332\261\273\232\216x\350\021>\315\220\217\221`L'\321\343\207C\r\031\362\251\\\003\234H\017dw\337z\246\234F\231\030\311\356:M'\0177v\333(\266\037\330g\tv|\313\017\337Y\267\276t\276\3641"
+	.string	"r\3048`c\227\303K\217}A\227\022g\375\366\337\362\207m\026(\023u\310\\Z\252\033\273]\202C7\260\263;K\350-\026\236\200%\211X1\310\016A\336\323\276\211\237\b\035\305\205\017\330E\275p\261\033N\0268^$\025EM\255\270jT\0044J*\243|\201\232\362W\\$\364\007\305T\2716\244\017\212\252)*\236\231:\262\222\3614\225\273+\322\207\304k\204\0243H\311\303\177H\204z\035Y\265(\201\030\345\213\335\211RS\366\337\356\256\025\025\334\247\003\001\303}:\333;\321p2\037\216\263\311\254\0211\341\266\022\020\n\347\221P\362\361l\035PfB\207\333\230h\333F\343l2\0244\215\207\323D\fx\353\234x\264\317\266y\264\217n\377VQ~\353\230\025\027\f\030\325\357\251>\007:^\030td,\237\332\\\205\274)\037"
+	.string	"\202O\211E\205\336@BP\214\201\311X\227\016\373\233\302\016\320\034x\002\b\372\253\036Ruu]\200<\254\307\005W\213\225\242\354\021L3\212~X\302\272`}\246PAci\n\265p\215"
+	.ascii	"\fAq \013`FQ5\266\253\224\001"
+	.text
+	.section	.gnu.lto_commitTransaction.19.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"m\007"
+	.string	"\302\01654`M\323\001@c\003\221Z\2250\f\346k\006C\351PMu\216\271k\277\3611L\273\241Gb\2576\215\200d%\330<\206\023\301P\233\202\245\321\314Z\333;\245\032\312\2322\314\252\"S\227\fF1Z\003V\0310Y\245\22769\\X\225\231\264\232V5=L\252b\363R`zi\352\314(\255S\002\367\317\312\317\013^(!7~\242\255A\304w\216!\235p#9\033\344\242\344\330\177vw-?[J\025%\006&\273\024\235\224\r\241\021\r\311\366\243}\216wl\367\210x\300\356G\"\262\013\036\030!:d\360\003\225C\321\005*\207\274\331'\0073\326\302\331\230"
+	.string	"A\331\335)1\276=n\376?\016\320y\334\243Eaw\035;\317\342\226\267M`;\301\366E\b"
+	.string	"2\241U/p\270\340"
+	.ascii	"\346]\002hVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_setStrokeColor.21.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`E\001\205\f"
+	.string	"\326\326Q@0o\232\016\344r\324\007\217\372['\006P<\377\322q\224\237\262C\226\340\212\005Nt7d\352\fr`\304\333\376\263\336}\333\025\016\351*\331\001\006\300\036\372\262F\\z\3646\324\226\354-eJ\001="
+	.string	"@"
+	.string	"<"
+	.string	"\320a\364\002\320\241/{\345\034\210\265\230\274\300\200\002\306\356N\372\341\327\237\346\345\037\345\032\332\326\371\273l\034\256\322\206=\314\356\006\330\262L\313\202\335uj\333\206\033\3366\003\333\r\354\217\b%\366KCM\353O\376\204\244\026.2*\273\032:\031\373\201,D\330\276d;\271\237\270~R\341\r\330\314C\b\216\350\020\363\236\366I\274\304u\023\026N`\267\304\263b\227K`\005\321\241\271\033\bPm\tV^\363Q~I\361|2\355\244\250x)\354\t\366Jj\213\340\3609#w\267\243\337\200T\325\223e\f\013\350\272\256\373\006\224\252\352\274\320\001\313\316\346\260T\023\373ow\327\032U\374\210\032hQ\024B(\016"
+	.string	"\326d<\254\3301\022\301\252 t\210T\2213B}p\254\215\307\0247S\310\206\002\2314\2255e\0168r\036T\223H\214\325$q$\327T\277\364A \250\031\034\250|H\024s\224\001\035"
+	.ascii	"\3043aP\026aX\206\215\337\301\204\203\340:\365\001\202\013/\334"
+	.ascii	"\260\327\325\302bv\025cCM\303E\303\020!\n\270\242j@g\260/\\\003"
+	.ascii	"\212a4\020>S\243\340\26245Z\334\345\230M\376\224\367]\205\f"
+	.text
+	.section	.gnu.lto_setFillColor.22.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`E\001\205\f"
+	.string	"\326\326Q@\020\221\232\016 \344"
+	.string	"\n"
+	.string	"W\357=\253\335F<VM \017}k<"
+	.string	"C2\260\217\330\242i\275UF\b\263\005a|\276\255\002"
+	.string	"\250\003\301"
+	.string	"\024\340\251.#\210\030\264\315x\326\226\354-eJ\001="
+	.string	"@"
+	.string	"="
+	.string	"\317\037t\003\317\237+\273\345\232\210\305\244\314\310\220B\306\356B\r\361\352N\263\362\277r"
+	.string	"X\306\271\333\310:\\\243\314r\034\273+ \27321\fv\327\211e\034\356w\333\rl;\260O\"(\266K?M\353U\376|\"\227\030\320\305\356\206\315e;\257\305\b\333\217l\247v\024\325U,8\002{\201\370\360\001\375q\270\247\375\0227Q\375\304\205\027\330Ey\301bWS\340\005\320\237\265\037\bO\355\tT\036\363W\276\301R\243s)\207e\205SaS\260[\022\333\004\177\317\227\334]\216\276\343QU\030W\322\360\200m\333\266w<\251\252N\f\036\254\334l\315JM\261\357vw\255\001S\024\211\231GI\025H\244\217"
+	.string	"\316x\204P\021\304D\0025E"
+	.string	")\231\342\306D\022\331P\232\020\0305\220D#\215\300\314DA\017\004\216\033\b\023,\211q\202\221vrM\265K\177\344y\252\341\301K\347D-C\031\035"
+	.ascii	"\3043aP\026aX\206\215\337\301\204\203\340:\365\001\202\013/\334"
+	.ascii	"\260\327\325\302bv\025cCM\303E\303\020!\n\270\242j@g\260/\\\003"
+	.ascii	"\212a4\020>S\243\340\26245Z\334\345\230M\376\224\367]\205\f"
+	.text
+	.section	.gnu.lto_setStrokeAndFillColor.23.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`E\001\225\f"
+	.string	"\326VR@\020q\233\016<\002H\b\200\227"
+	.string	"\355<\266S\0203\020\244\201W\322\340Y)2\353:u#\323\372\257\025u\265\215\352\266\246m\020\001\005\b\240\003\235\004\231\363\005\250\362\037\257\367\177\332\222\275\245L)="
+	.string	"A"
+	.string	"="
+	.string	"\321\241\364\002\321\241/{\345\\\211\265\240h\310\320\002\307\356N\212\362\353O\363\362\257r"
+	.string	"\332\006\372\273l\036\256\230\r{\232\335\315lY\246\205\301\356:\265\255\303\ro\273\201m\007\366O\004'\366KCM\353S\376\2142 l,\220\261\313\241\323\261!H\303\204\355cl'w\026\327S,\274\001\233\215@\341!\035j\336\323~\212\253\270\276\342\302\t\354\236\334\230\261\313%\260\002\351\320\334\r\004P\355\tV^\363U~\211\361!\224)\b\306\213\347\302\246`\257\244\266\b\016\237;rwA\372M\244\2525\262\314a\001]\327u\337D\251\252N\f\"\260\354l\016K%a\377\355\356Z\003U\f\211\035hQ\025F(\217"
+	.string	"\356p@\254\370Q\"\301\252\"|\220T\361SB\205|,\017\310\024=\323\210\207\022\231:\2255q\0168~ T\023I\214\325\204\341L\256\251~\351\213DP7<\b\0212Q\314R\006\035"
+	.ascii	"\3043aP\026aX\206\215\337\301\204\203\340:\365\001\202\013/\334"
+	.ascii	"\260\327\325\302bv\025cCM\303E\303\020!\n\270\242j@g\260/\\\003"
+	.ascii	"\212a4\020>S\243\340\26245Z\334\345\230M\376\224\367]\205\f"
+	.text
+	.section	.gnu.lto_setColorInversion.24.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"-\t"
+	.string	"\346\221A80\257\322\001'\036\262h\004l\032j\255\312\344vF\311\263]\361\200\253\344\271\206\260\007t\366\021\200j4\214-+\034\310\225\242\036;\033mh\231\304\301\326\\QI\3332\245."
+	.string	"2"
+	.string	"/"
+	.string	"\231o\233\027d\2769\264Y>=V\003k\255HZvWF\330\303k\350\177\344"
+	.string	",W\352\252q\330]+\313\265q\307\333N\260\375`\033% *\r%\273\255\232\313\322\266\223\017\333\347\330\216j3x\302\317\213\317\003\216\231l\366\271\332\227=$\274\b\306\tv_+&\273s\301\236\3157\317\033\004\230\215/C\304h\252\230\341\214>\332\025\026z\226\0214b\312\032\037\003b)\253\027\225\326\354\231\322\330a\037\263\273\353\370\262?\177\215\352o\003\001\242\221\351\033\235H\335\006\344N$\356#\340PG\004z \224\004\370E\200L\237WBq\023%\260\023I\257\223\244\216\243\220\241\017\224\035\005{\245\321'M\236\367I\316\334\007\n"
+	.string	"\3043\241\214i\3553\034\234-u\r\235\ns\301\211"
+	.ascii	"e\005\\\313\013a\222\001"
+	.text
+	.section	.gnu.lto_setPixel.25.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\223\001\345\r"
+	.string	"\366\331ZB \217\223\016\344\020x\201\264\001RX\317}8\017\377\241J5\353\275\272\022\t7\021\366\310\247\031\2628\250\367\"T\273\277\250q\366*!\260\320\351\006*0@\033\031f\242\325\035^\326\266\021\262\267\224)\005E"
+	.string	"J"
+	.string	"C"
+	.string	"\313q\030\001\346\320\334\013T\207\230\023\250\016\255\331/\347>\254\205rr\301\304\213\335\275\024\345\332\237\246\346\237\345\031\322\026\372\323l\034\256\233M\3644v7c\033eZ\nv\327I\3326\334\360\266\027\330v`?\025*?|\312\377^Z\277\362'&c\205\213\004\335\256\206\016\306\242\240\n\020\266\277\261\255+\240\020\rT|z\002v\344\001\003\203\344^B{\212O\316\354vH\271\354.\207=0\207\032\357i_\304Gh'a\341\003vK-.\033qB\236\344\263\\\223\342\2042\321P\013\212\247&\377\204\235\331/I\332\003\207\317\030\271\273!U\223\363\033\225\252\266\030e\312\001\272\256\353\276Q\245\252:MND\331\331\234(\325d\377\355\356ZK6L[\017X\024\211\035\bz\205g\034\n#\034\017"
+	.ascii	"\356t\200d\361\003\024\222a\021>H\260\370\001qD>\231\007\344"
+	.ascii	"\212\236k\304\303\221pu\260\354\3520\340\370\201\200]$1b\327"
+	.ascii	"\206+\371[-\251_\372!\225\245\031\036\260@\225\250\310\231\264"
+	.ascii	"\024\352S;  `\2021\265\252\016\304\022\006o\032@2\\$\346\303"
+	.ascii	"\300\036\353:|\fn\327\013\356\227`\033~hC1\\\034\2068\n\205\343"
+	.ascii	"d\354[\343\200\036C{\013\003/C3\210\362\202\360\224\033\313\206"
+	.ascii	"5\221VXd-\007E>\335\373ZL\006"
+	.text
+	.section	.gnu.lto_setPixelToStrokeColor.26.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"}\t"
+	.string	"\326\221A;0\345(\035\340\301\307|H\332C\034[\360f;\231G\035$\211\213\005t\375\363\"\372\270\002\252j\bl\241\336\212\r\255\241Q\t\303\240)\332\373\320X\240\245xB\377\337d\357\224\002."
+	.string	"1"
+	.string	"0"
+	.string	"\232K\316\r4\227\376\354\227\327\221\335\264H<`"
+	.string	"vw\306\326\277\303\317?\354\001\251\025\352p\323\260\273\206\251\325\307\035o;\301\366\203\355Yr\245\304\366;\366\013\304\001\326\247|w\231E#X\216\020Ulw=\006q.\021\264C\373&?\371\216\222\361\202]\226Kl\267z\274\300\271t\375A\206\220\221i\304\rK\030#\214\366\205\007\2372T\201\221uD\224]Q0\212\330\327vw\035Y\366_\177\274\353\207r \246\205afW\025`\266\262\3361\336m\026\245\r$`\321g\324\321\2207\321q\022\241\023GM\336Fa\352H\243II\263D\332*\246\210\353\346G\301\324\024\301\315\023\245\334\354\324\275\266\221\025\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_setPixelToFillColor.27.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"m\t"
+	.string	"\326\021A9@\217\322\001P\330\303R\227\252\203\340\324\330F\310>+\007\216\32356`\330lXx\002\3534v[(/b#t\020\374r0\233\211\025p\327@\211Zcf\333&{\247\024."
+	.string	"1"
+	.string	"0"
+	.string	"\231\313\315\0132\227\376l\227W\222\325\260Z\0350\230\335\235\221\365\357\360\363\017;"
+	.string	"*u:\3240\354\256!*\245\272\343m#\330v\260=\013R\245\304\3669\366+\244\001\326\243|wyE\033\330\r\021\217\330\356v\374\331\\\036h\207\366[7\371~\202q\202\335UKl\267v\254\260\271t\275A~"
+	.string	"\221eD\rK\030#\214\266\205\007\2172LI\3118\342\311\256'\030G\354k\273\273\216+\373\257?\336\365C)\240bYx\331\375\210\231\255,\336/\336m\025\244\355\023\340\220G\324Q\220'\321q\021 \023GK\3366Q\352F\242IG\2234\332(f\210\353\246'\301\264\004\301M\023\245\334\344\324\275\266q\025\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_setStrokeWidth.28.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\345\b"
+	.string	"\266P>:@\345&\035\340ag\365\0278\370\022wb\217`#\261\240z!7\373\216\261\342\337\340I\377bI\247E\355*j\310pk\362\326\236\300\260\214\364\027\360#8\365d\333&{\247\024+"
+	.string	"-"
+	.string	"."
+	.string	"\006\233K\1776\315\253\310rV,\033+5\273;\343\352\337\341\347_\345\001\250\224\351\220\363\260\273\206\250\224\307\035o;\3016\204m\230/#\266\337\261\r\353S\276\263\026.\202=\201p|\260K\204\353\320\276\311O\276\243`\274`W\025\343\262[\031\334\200]\272\376`s\211=*G\224\2642\242\206%\204\321.y\360(\303\226\217\326)\232\354j\2021\304\376\265\273\353\250\262\317\372\3415@\"\3430\263\333\021"
+	.string	"\300\266d\245w\331\305(\373\b8\344\021u\024\344Qt\334\004\210\304\321\315\313*\266N\023M\252\315\221\226Y\314\020\327M\217\202\351&\301M\022\245\334\354\324\375\2651\f"
+	.ascii	"\3043\241\214i\3553<\316\272\270F\021\303\274 |\246F\301eij4"
+	.ascii	"\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_setLineOutlineType.29.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"-\t"
+	.string	"V\221@9@\217\322\001\230N\274\351\302\375ck\235_\316f&\3763\347\256\277s\216\246-d\344\350h\244s\306\352F\177L\005\030LN\367\231\030 \273\004J\324\032\214\326n\262wJ\001-"
+	.string	"1"
+	.string	"/"
+	.string	"3{\201\346\323\240\r\363\020d7+\226\215\223\230\335\245ru\360\021\364or"
+	.string	"T\312\364\270i\330]GT\252\343\226\267\215`\333\301\366J\03432\373\232*!\266\317\261\035\303\227\200w]`\003{\362\020\361d\237\007\330\243\375\221\263\300\2670N\260\253zI\331\r\025\274\220}:\274\201\346\001\035\345\204{l\245\312\017$\257\f\251\341\031\243\264-\276x\224#\n\353u\222&;4E\371a\037\333\335\265T\331w\375\021\023h\2710\264\354\006\"\356\203\020\221\266Q\211\242r<\255\202\244y\002\f\352\204\274\372\371$\274.\342S\352*\367i#\316\333B\264n\224\264i\023\024\324y\264\223\340\312\211:Z\2525\f"
+	.ascii	"\3043\241\214i\3553<\316\272\270F\021\303\274 |\246F\301eij4"
+	.ascii	"\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_setLineOutlineColor.30.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"-\t"
+	.string	"\006\021@:0\345(\035\2003\226\315\244\232\232*\207'o&\263\350<\255\353R8F}]\243a\316\030\354[\320=+\201\266e/%\006T\207\266\300\"\210\r8\021,Y\255\265M\366N),"
+	.string	"/"
+	.string	"."
+	.string	"?\330<\272\263i^A\226\363\222\331@\251\331]\t_\357\376:\377'\017`\265T\177\234\207\335\365c\265:nx\333\n\266!l\263\004\261\270\"b\373\036\333\257\336\244;\354\"+\330\225G\b\250\363\230\220\375\331\0379I\367\022\214\033\354\272fTv+\203\033:\217\256G\330<v\002Tz\352\036&\226\0015\034\337\203\266E\352\235\345\227\342\022[A\225]U\017~\330\317vw\r]\366a\377\313\b^b\034Zv9\002"
+	.string	"\330t\226&\210d\332J(\212)\300i\025&\r4`\321g\304\315PJ\202\243\021!\024\235\247\224V:q\333H\316M\2326mB\212('?\013\236'\022\225\2509\003\r"
+	.ascii	"\3043\241L\213`Xk\330\340&\270\270F\021\303\274 |\246F\301ei"
+	.ascii	"j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_clipToRect.31.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\235\n"
+	.string	"\306SH> \345*\035"
+	.string	"\350<\005 \200M!\367\326-\272\264X\003i\324ob\300"
+	.string	"\200+T\351\2608\224\265\2020\200jAn\233h@\004O\216\263\2568\262a "
+	.string	"\300\244\251\350\333\337d\357\224\0023"
+	.string	"8"
+	.string	"3"
+	.string	"\234W\227?\320\274rn\240y5i\317\274<\331\315\013\267r\301\355\256G_'?I\377/\357\260Z\252\317M\303\356z\262Z\"7\275\355\004\333\022\366\037\002\267\n\223b\373\036{\206\022!\033\201\210\331\326\021\354G\t\210\303,\337B\036f\233;\273$\271\332\356~\034\342\274\"t\237\366U\276B\236\205\343\005\273\256\230\332n\371\361B\036\256\263\322\216R:\251\235\032\347Y\2364"
+	.string	"\267\025U\331\245jR\023\373\335\356\256\251\313\376\354\257\227\375\335c?=\354\237\233\201"
+	.string	"2\f\264\335\220\001\271\r\026O}\374\306\305O\303\364\205\004<\002\221DP4^\210a\205\b\025\202\247\361\3038\211%\222\007\226<S\351\313\360F\241\350\201\024\f\236(B\017\005\202\241\347)\367\335R\227'\004\334:h\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_clearRect.32.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\235\n"
+	.string	"\306SH>0\305*\035"
+	.string	"p\373\003\236\n\374 \177/\311\371\367G\232\022\013\304w\034\\j8\3400b\037\235\260(\032\002P\245r.B\241\230\250b8Q\342\005\266\361\225&aT\034\337\376M\366N)3"
+	.string	"8"
+	.string	"3"
+	.string	"\232W\227G\300\274j~\200y\365h\013x\351\332L\353\226j\031\260\273\035m}\374\034\375\277|C\252P\237\231\206\335\365$U\"7\275m\005\333\023\366\037\002\266JC\261}\216-sI\304V\0200\3278\202\0051!\035fy\226\361/\327\274\331-!0\333\335\216?\232\327\004\356\323~\312U\306\257t\274`\227\005`\266[v\314\020\037\256\263R\216R:\251}\022\347IO\332\210-EQv\211\232\364\304>\267\273k\312\262/\373\353c?w\330O\377\372g\306\200$@\204\313n\310\255\300\006\027?]<\307Co\203\344}\006\034\362\210\302\017$b\204\240\005\310\004~%\321\313(\205#Q\367\215:\322\310\323\350B`\330y\026\374\225*\300\316\364}`\307)\367\334R\226)V6\017\032\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_resetDrawingState.33.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\225\007"
+	.string	"\242\21656Po\322\001 [\036-\0026g\231\334\360\335S|\230A\321\006@\263Z$\210\361\341\354\375hQ?\201Z\332\215-\335\276YjT\241\226\244?\333tk\204\354\235R\264\242"
+	.string	"U\f\001\366p>Tv\260\b:!:\241)/\254\222\270\250\365\211\322\212 \253\232\210\236I#\347\300\362z\2301$\345\214\233\272\237\026rv \351.\240\310\323\263\261\212\367\315\217$\322\211\240fW\355A\016\373\323\356\256!g\303\201\221\225\206\322\256F\351e;\212\024\262\261\375g\277\344&\331O,.\260\313\261\250\354V\004'hN\271\276"
+	.string	"sJs\002\314)gv\313\353\307f@20R\\v7B\217g\177\231\177\224\003l#\355/\243\260\273~\333h\343\206\267m`{\301vG\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_drawCharacter.34.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\003\001\245\f"
+	.string	"fXVA\020q\233\016+\034\205Exe@\324\333\336.\025\215U\023\240\364S\311T* q\361\034\207\305\327\351\2261\243\231"
+	.string	"\365\352\3236\210(\nb\003L\240\204\251O\307\013\320\320\241g\363n\"dK\231RB"
+	.string	"I"
+	.string	";"
+	.string	"O\341]E\206\013\330\r\311P\331\0055FP]2x\002\323\245\352\230\351\222=\273\306A\022K\225\370\360\261\270\261\273\227\216\270\367\364\374\247\334\002\225x\236T\202\335u\202J:\334z\333\005l;\260\257!\231>\200\0011f0\260\261\313!\304\261+\022\214\023\266o\261\035E\"4\032\264\270\013\357(]^\226\344cbAu\351\222\307L'\036\305\313\222\204\330\240 \301\257\360n\342\221\255]\020\241\312\356j\354Q]\312\304\247}\024\001\266\005.\017r\346S\217\243\246\336\322\353S~@\364\342\3131\222\241\037^dR\265\324\371y\370dh\203\236T\021\366\343\356\2565dKi\353'?u\223\177:\312\037/\3725\323\031\\G\313\342&a\243\3351\234\303.\204`\036\001\274\351"
+	.string	"\341\262\217n\002\267E\370\350l\231\326a\0244\216\003re\234+\204\203U\2706\033wu\030p\246A\330\256N\226m\227\005\334\307\325\220\037\214VF\364\343*\257\251\224N\032\026"
+	.ascii	"\3043\241\214\351Dj\2308\3738s<\341\032\346h\343\235QM\tW\200"
+	.ascii	"\316)\341\002\260\237\216\321u\270\b8\027tN\t\301\002\201\301"
+	.ascii	"\025ij\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_drawCharacterMask.35.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`&\002\265\020"
+	.string	"6\337kE"
+	.string	"\261&\035DD\327p\337\357\344:\005\227\373\256\2051\242\245\357\263\377\241X\244'\246\213\255B\263\325\240\243{\215P)\003Q\343\317\270\365^\362\235/\031A!L\0244\005\374~\2002?\252M\032\331D\312\224\002U"
+	.string	"Z"
+	.string	"T"
+	.ascii	"\327\323\376\211\243\370\236\002\303\007\354\306\364\350\354"
+	.ascii	"\202\"N\220=\032|\001\3541\373\007\366\350\317\3669\030bA\"H"
+	.ascii	"\254V\330\330\335MA\374\373\245\371\371\317y\210\325r\371\005"
+	.ascii	"\240\305\341\252\265R\027\310\356\006h\2512A\nv\327\311jm\270"
+	.ascii	"\343m/\260-\301NU\326N\363\207>\363g\267\371AX\032\373\315\037"
+	.ascii	"\217\363k\2463\323\357 @C\206\203\031\273\032B\034\313\023wL"
+	.ascii	"\330\276f;\342\264\310\214\200p\335X\350y\300\3425\337mN\351"
+	.ascii	"\261\252T\211\006\331\243G\376\003\243\351\300 \301\253\370>"
+	.ascii	"\343\027\227\307\252>\274\350\354\256\210I\262G\220.\006i\352"
+	.ascii	"\352\007\225!\f\027\327\216\255b\373$k\017<>s\344\356\272\250"
+	.ascii	"\3128\037\202a\2521Ty\303\002\3020\f\037\202E\305\324\231\301"
+	.ascii	"\203\246\327\347\034A\213\232\325\017*C?|\013\246\252\251s\005"
+	.ascii	"\223\312\320\006S\2512\366\257\335]k\214\235\245E\240\f\036\213"
+	.ascii	"\211\273:.\205#\305\216\002IO\277poTaeD\322a\322\210\211\307"
+	.ascii	"\225\234P\274nB\tK\307\231N\243\024\223W2\331\270\322\266R\032"
+	.ascii	"\251l\244\316\333F\f\2303\235t\033\013\307u\233\006\242\256Q"
+	.ascii	"}\245\177\202\211\364%B\r\036\224\246,\312\253HSC\232\251]B\311"
+	.ascii	"\263|-\214\006, \220\202\231\271\253\003\304'\fY\274\303\372"
+	.ascii	"(~16\336\223B\013\270\353\355\200\373\331\243\345n\263\353\214"
+	.ascii	"\255km\321p1LI\224\352\217\007\314\221\234\375\310\036\206\314"
+	.ascii	"xU#4\300\210\341\236/D\271\fdD\341\200\354\2473\272\376\"\316"
+	.ascii	"\221Y\300\210r\334\210\301\025i0E\360rP\223O\362\276\253\223"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_drawString.36.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"\005\f"
+	.string	"\366\226RA q\223\016C"
+	.string	"\021\006\202\242$\2631\355{\276\217\360\b\020\354\313\t\n\004L|\200\005\"j\250\222P\305\216\f\002*\336\365Oh@\260\035%\203\004f\311\240\270\202Ber\366j\322\310\336R\246\024="
+	.string	"F"
+	.string	"8"
+	.string	"\017\260;z\241\262\313u|`:4w\001\322\341\364\215th\315\236qN\304^F\230\330X\320\330]JC\\{j\376S\216\t\211@\317\013\202\335u\206D\034n\275m\002\266\033\330\217\020\231>f\263\001\006\203\030\273\032\272\226e\201.J\330~\306\366C\t\221\261@O\262\001\232%YAB\201\211W\236fI>dH\220\334Uh/\361\2121\273\036ZTv\267c\216\351\220\363\236\366O\034\205\366\024\030\002\372\324\256\020\363!s6\005y\322\353Sn\240E\267\325\020\311\316\357\036\"\245N\352\334:\214dgs\240T\020\366\337\356\256ud\303\364\364\223_\272\311\017_\362\277\243\374\031\361sY/>\373\205\307\312\002H\305\001\300\036\033\037\321\352\310$D\fB\307\007\263\256\254\232pE\317\007ey(\020OE\201\362\300\"\265Q\300\326\365"
+	.string	"\243>\226\205Q\031n\377VGv b\021\321\021Oy\225\024\006\024"
+	.string	"\3043\241\214i7j8\340\354\001\\#\356l\350-\024zu\031P#^\205\013\205\32100 eP\024%\330\r\330"
+	.ascii	"M\244),\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_drawStringMask.37.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\t\002\335\017"
+	.string	"\246\335fD"
+	.string	"\261&\035\037\036@"
+	.string	"4\2241\034h\307\375\363\374\310\0024\271\211\177\231"
+	.string	"\302\226\216q\034\315\254\221\001\335\323\r\2252\020\001\177\306\255\237\332\321~\320\b\n!\242\240\333\300\327\343(\033Hc\322\310\336R\246\024R"
+	.string	"U"
+	.string	"O"
+	.string	"#N\302\364\022\027N`\367E\007g\327\003\361\002\354\321\336\013\\\217\330;\256G\233\354\027\367@\254'\306f\205\"\306\356j\372\341\246CM\223\377\233\003`\265N\207\237\026\207k\326JA\217\335\025\320Rez\030\354\256\223\325\332p\307\333n`{\304NQ\316<\351\317i~\3543\277\3472\377u\245\343k~x\233?3\375\215\016\027\027\021Z\354\262|3v'\346\210\260\375\314v\264Y\201\211\221"
+	.ascii	"k*\260\200\2404%\003\034\253:\021\342\301\f\213\203\364n\302"
+	.ascii	"t\031\257\200\034\253\362\220\001gwA,\202=z\300\247\375\376\315"
+	.ascii	"\017l\213\236T\344@\034;\305~\221\254M\360\370\244\221\273{R"
+	.ascii	"\205q\376\343\212\252:\252\224\341\001\337\367}\377\270\240F"
+	.ascii	"ubp\371\350\3657W\220\002\306\252\006*?\377\373\312\225\372Q"
+	.ascii	"\347\252%\225\237\355\245Ra\354\303\335]\353\213\215e\035i\264"
+	.ascii	"AnC\331B\261{\351\026\336\201(\250\200D\0028\024R\322m$\245\223"
+	.ascii	"\216\233@B\342\266Q\t\2042\352D%\332&\322TD\240\024-\304uZ\b"
+	.ascii	"\002o#\023N#m\033\247e\036\352\n\3250}\223+S\r#\035vP\232\362"
+	.ascii	"F^3\305\324\243\227\332\242\223<+* \220\202\231I\363\304'\f["
+	.ascii	"\f\303\316$\376\032\305\033\\\367G\301\305\213\007{}\026S\332"
+	.ascii	"I\311\206\332p9L\371(\225\035\017\314\221\244\375\306\035\006"
+	.ascii	"\373xW;4\300\210\303\335P\310q\031x\304\037.\205Q\007\266\224"
+	.ascii	"\335\005 S2\2216l\"\355\260\310\267\034+\362\367\336\327\032"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_moveToPoint.38.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\205\t"
+	.string	"FRB90\257\322\001P9`\260\314\324\b\336@z\303kgY\250\035\254E\251\353\367\035fq\0079\207\020`\301\177/\312\n\3172\r\335\212\027f\271i\250\036\\\266k\333&{\247\024/"
+	.string	"2"
+	.string	"0"
+	.string	"\003\231\317\315=\231O\203\266\313C\221\325\214\254h\304^v\227\312\220\203\217\240\377\3309\252U\352Q\203\260\273\216\252U\307-o\273\300\266\202\355Z~\307\206y\266\005,\306\307FB\f\177\002\376\345\2319\273\0360\262\335\3758\264\371$\330\036\355\267\356\002oRq\201]\026\213l7\374\370`\363\351\360\001\026\362\3023J\031\245=\361\305\253\034SJh\0312e\207\251(A\354o\273\273\226,\373\260_\376\365\307\351i\265,\250\354r\304\324\2266QH\354\337)\356q\022&.\004\340\021\210\344U\321\367\340u\016\"TWO\037\007q\362J$ZK\324T\342\"\350\250\363(\310\300\365\324\320QT\255\035\355\204\373m%\313\f.Z\016"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F\006\035QB\334@\fpE\232\232\002\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_strokeLineToPoint.39.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"}\t"
+	.string	"\326\221A;0\345(\035\340\341\005CM~jH\373\221\372\2671-$PM\007\021\313\274\271\032\262\270\002\252j\bl\241\336\212\r\255A\345\002V\007S\334I`H\342A:\241\377o\262wJ\001."
+	.string	"1"
+	.string	"0"
+	.string	"\232K\316=\232K\177\366\314+\311nJd\034/"
+	.string	"\273;\343\310\277\303\317\377\353\001\252U\352p\243\260\273\206\252\325\307\035o\373\3006\203\355Y\222\305\304\366;\266\013d\001\326\253|o\331E\033X\215\220\016\330\356~\034\342\\\032h\207\366O\216\362=\345\342\004\273,\031l\267~\234\300\271t}Av\210\211a\304\fK\030#\214v\205\007\2572ly\211m\304\224]S0\212\330\327vw\035Y\366]\177|\353\207\322\003#\323\260\262\353\021`\266\261\336-\336m\024\246-$\340\021\210\324Q\221\027\321q\020\"\024GO\336&q\352J\244IK\323T\332&\346\210\353&\b\301\364\364\300M\024\245\334\354\324\275\266\221\025\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_strokeTriangle.40.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\023\001\305\013"
+	.string	"6UN@ O\225\016\300\246\300"
+	.string	"@\324\330\f\013j\333\245\241\360\017\201\353E\2024"
+	.string	"\233\214\021\372\206CC\301\217\001T\213\255l\232H\017(\324\330"
+	.string	"gh%\215\221K\200a\361N\332\026\021\262\311\226)\0058"
+	.string	"B"
+	.string	"5"
+	.string	"\273\343\304\003\036\237\036\317\241}>.\321>-\332.>\232v\003\361\302\202\t\330\356r\362\303\305\253\350\037\305!#\222\350\272\021\330]\353\210\244\341\226\267\r\300\266\002\373\031\002\n\221\300ZdN\354b\210\021\333\327L\021\302\366#vk\005\002\326*\263\022q@e2\220\332P@\307\227\020\217\262\212Lc+t\270\340\332\335\2111\217\317\216\354j\177\304I\210?I\370\306n\211\205+\t`\274&H\n\236\272IMN\231I)U\332\021B\375\310\002N\261\345 E\366(R\351\301~\266\273kY\262\337\372\267\263~\355\253\177^\365gO\375\362\250?\227P/!\265\204j\ti%\324JH\301\016\202\247\303dxC\341\200\236&l"
+	.string	"~\f4\240\317\373\204\235\203\017\330\341p^\207\363t\272\007\334\346\0039J"
+	.string	"{\237\005\037\007\362\274\217\213\214\373le\311\001\033"
+	.ascii	"\3043\241\214iJj88[\004\327\210y3\006\230\003\231\201A\200<\340"
+	.ascii	"\030\300\004\310\003\216\001L\200<\340\030\300\004\310\003\216"
+	.ascii	"\005EQ\202\335\200\r\320D\232\302\002\256\345\2050\311"
+	.text
+	.section	.gnu.lto_fillTriangle.41.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\023\001\345\013"
+	.string	"\246\225O@\020Q\225\016`\001 \200\254\352\204P\375\357\375\3738\f\240\003v\277S\221\003\257\225\331<\r]C^\037\005\210\205\355?Ax\203\244\\\222\200@\267eu\266\233\340\031\305o\330\266\021\262\311\226)\005:"
+	.string	"B"
+	.string	"7"
+	.string	"1Z\273\343\304\006 \237\036\017@\373\204\374C\373\264h\327\370hb\267\023\260\f-l\354.'K\\\274\212\376]<2\"\211\256\333\201\335\265\216H\035ny\333\003l3\260\317!\036fdb\273\033b7\3665a\244\260}\211\315z\261`e\312\250P(H\205H\200\262+\353X\f#4 \320\361,\304\237\354rdW\004\254\265\273\023c \237\002\262\253}\025_!\336T\341\036\273\245\037^\026\344\005O\335\244&\247\314\244\224*m\n\241~\344\0024d,\b)\262G\221J\022\366\263\335]\313\222}\326\277}\365kW\375\363\251?;\352\227?\375\032\t\020\227P/!\265\204j\ti%\324JH\301n\202\247\303pxC\341\200\236&\204"
+	.string	"~\0174\240\317\373\204]\204\017\330\341p^\207\363t:\t\334\346\0039\n\001{\037\007\037\007\362\274\217\223\214\373le\311\r\002\032"
+	.ascii	"\3043\241\214iJj88[\004\327\210y3\006\230\003\231\201A\200<\340"
+	.ascii	"\030\300\004\310\003\216\001L\200<\340\030\300\004\220\027\024"
+	.ascii	"O\t\306\002\206A\023i\n\013\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_fillStrokeTriangle.42.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\023\001\335\013"
+	.string	"6\025OC\020o\225\016`\022\250\nR_"
+	.string	"\036:T\331\255a\244\374\003;O\270\313\205\200\366\203F\207E\337\260=\204\002\004\213\036,\306\240\r\354\373\276\367\005T\354vl\375\306\276\300}T7\313\375\033!\233l\231R8"
+	.string	"C"
+	.string	"5"
+	.string	"\273\343\305\"\224O\217\347\320>)\337\320>-\332+>j\330mC\204\007#Z\354.'3\\\274\212\376I\274b:\225\256\333\310\356ZM'\n\267\274\355\017\333\001\354O\bZ\351\360\200b"
+	.string	"\213]\t/\\ll\226\350`\373\026\373u\002\200\353u\322J\231\2608\224\254,\220\350x\021\342U6\221e\254\203\013\020`\273{1\207\362\351\221]\355\247\016B|\210\005\327\330E\251\200\005\002>\304\030\310\006\236\272IMN\231I)U\332\nB\275\311!)R[A\226\354\261\244\022\203\375lw\327\022e\377\365ow\375\332[\377<\353\317\276\372\345U\177\233P7$\325\204\252!i&\324\fI\301.A\250\343`\330\203\371\200^'4"
+	.string	"~\005:\243\317\023\205\335\001\021\b\372p\036\210\013\201:\004\234\347\0039\f\210=\021\201\217\033y\336\307Y\306}\266\022\345\033"
+	.ascii	"\3043\241\214iJj88[\004\327\210y3\006\230\003\231\201A\200<\340"
+	.ascii	"\030\300\004\310\003\216\001L\200<\340\030\300\004\310\003\216"
+	.ascii	"\005EQ\202\335\200\r\320D\232\302\002\256\345\2050\311"
+	.text
+	.section	.gnu.lto_strokeRect.43.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\235\n"
+	.string	"\306SH>\020\005+\035\200A"
+	.string	"\216\001\364\002\366\177\237\264Uo\231\001"
+	.string	"5\243\335a\204\374\345\233F\335\3205e\006\241"
+	.string	"\261\360\263\2171X\004.Y:\201\022f\251\355\004p8\3558~\333d\357\224\0023"
+	.string	"8"
+	.string	"3"
+	.string	"\236W\2277\340\274z^\300y5i\003x\231\262\235\025\222V\214\200\335\365(\312\311O\322\277\314?\256\027\353\263\303\260\273\236\256\227\310Mo;\301v\204}\207\270jc\261}\220MS\201\230\215<\310|\353\006\366\303\004\244a\226\207!\037\363\315\237\335\222\\mwC\036y^\021\272O\373-w!\377\302q\202]\230Mm\267\fy!\036\256\263\322\216R:\251\275\032\347]\23653\270\026e\331%k\322\023\373\335\356\256)\314>\355\257\237\375\335e?}\354\237\235\003\333\315D\200\335\220\001\271\r\026_}\374\306\305O\003\365\215\004\\\022\231D\2204^\210a\005I\025\202\251\361\303H\211'\223\007\236<\324\351\313\360J\241\350\211\024\f\246(BO\005\202\241\007*\367\335R\230%hp\0354\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_fillRect.44.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\245\n"
+	.string	"\306\223H>\020\005+\035"
+	.string	"\004\021\\\206\2227P\367j\025T\333\022G\200\n\242\335.(\221\215J\343\372\3215e\006\241"
+	.string	"\261\360\263\217\321J\200|\026\272\032q\262\244\315&x\234\366\034\277m\262wJ\0013"
+	.string	"9"
+	.string	"3"
+	.string	"\237W\2277\350\274~^\320y5i\337\274LY\217L\346z\001\260\273\036E9\371I\372\2079\350\005k}z\030v\327\363\005\023\271\351m'\330\216\260\357\020\271*\243b\373!\333F\002Q\033y\240\031\327\r\354\207\tH\303,\357B~f\234A\273%\001n\273+2\351\363\212\320}\332_9\013\371\026\216\023\354\306bn\273\245\310\013\001\036\256\263\322\216R:\251\315\032\347_\236349\027m\331ek\322\023\373\335\356\256i\314\276\355\257\257\375\335i?\375\354\237\236\003\234\232\t\233\335\220\001\0026\026g}\374\306\305O#\365\221\004l\032\235D\2604^\210aEi\025\202\252\361\303P\211\250\223\007\242\274\024\352\313\360L\241\350\215\024\f\252(Bo\005\202\241\027*\367\335\322\230%rr\0354\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_fillStrokeRect.45.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\215\n"
+	.string	"VSG=0\345(\035\236\267/pY\300\321H\341\372f\375\032\215\301B\201\220\270X@\327\177\034\325\rW\020\372\032\002\243\330<u\313n\034*\361\264;0\305\332\202\302\b\313\206\033\377\333&{\247\0243"
+	.string	"9"
+	.string	"3"
+	.string	"\247\036\217\3009\365\374\200sj\321\016\360\021e;),\254\030\001\273[\347\311\305K\321\277\314\007Z\257\325e\307aw-[\257\221{\336\366\202\355\t\373\020\001\353\272\rX\033\235Y\261\375\217MS\221\230\221D\310\\\017r<\214\370\230i\270\202\r)\021\251\355.\310\"\317\251\002wi\277\345.\342_<n\260\013\263\251\355\216 7x\0027\333\307\0041\225trsN9mU(\337\262\254!`c\315\225=\256\3444\261\317\355\356z\302\354\323~\372\331\317]\366\317\307~\331I("
+	.string	"\240\342f\003\030W=|\307\301\216\343\324\211\bL\n\225@o\024f\200\337\305(\365y\250\260\323@\201\246R\365L\365d\3526*\351\003k\210\301\036\312\342\253)\317\373\352g\334s;a\246\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_strokeEllipseInRect.46.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\205\n"
+	.string	"V\023G> \345*\035 !\210%\002\210\005<\025s\233\252\r\357#Hd\002\223\355A\362\005{-\366q(k\005a"
+	.string	"\325\202\3346\301\005\220\b\234\t"
+	.string	"`0ol\203\t<\326\237mm\223\275S\n2"
+	.string	"9"
+	.string	"2"
+	.string	"\247\036\217\2409\345\374@sj\321\026\360Qe7/\232*f\300\356\326\231r\361R\364O\373\300\212\225\272\3348\354\256\345\212Er\317\333^\260=a\037\";R\200\300\336\250\314\212\355w\354\031\213\204\354\025\021k=\310\3610\342a\236\341\n6\344D\244\266\273\036\2038\247\n\334\245\375\226\273\210\177\361\270\301\256+@mw\364\270\201\023&\267\217\tb*\351\344\346\234r\332\250P~ei+\271\251f\312\036Sr\242\330\347vw=]\366g?\275\354\347\036\373\347a\277\334$\264"
+	.string	"T\3306\030G=|\307\301\216\243\324\201\b,\372\214@/\024f\200\337E\350\364y\246\260\3230\201\244Q\365H\265D\3526\252\350\003\353\207\301\236\311\342\253'\317\373jg\334s;]\246\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_fillEllipseInRect.47.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\225\n"
+	.string	"V\223G> \005)\035 !\210\005\b\310\203pE-\320^\375\221\262\007\020\317\254\203\302]\306\241O}C\225D\315\206\301\210E\271\320\262\t\002n\254\253\020\210\343\016B\265\260\341*\255\276\265M\366N)3"
+	.string	"9"
+	.string	"3"
+	.string	"\247\036\217\3409\005\375\300sj\321\026\3601e?+;\256\232\001\273['\312\305K\321\277\315\007^\260\326\345\307aw-_0\222{\336\366\202\355\t\373\020\001;R\200\300\336(\016\213\355\207\354Z\213\004M%bV\362 \307\323\210\2279\207+\330\020\023\021\333\356\212L\002\235*p\227\366c.#~\306\343\006\273\261"
+	.string	"\266\335Q\344\006P0\267\217\tb*\351\344\346\234r\332\254P\376e\251\343rs\315\226=\266\344<\261\317\355\356z\306\354\327~z\332\317}\366\317\313~\371Ix\001Pq\263\001\030g=|\307\301\216#\325\221\bl\032\235@\257\024f\200\337Ei\365y\252\260\323P\201\250S\365P5\205\3526\252\351\003\353\210\301\236\312\342\253+\317\373jh\334s;c\246\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_fillStrokeEllipseInRect.48.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"}\n"
+	.string	"V\323F> \345*\035 !\b\005B\037\003=p{\327\336\265a@\r\f\260B\003\023\3206\270\204\243\341P\326\n\302"
+	.string	"\252\005\271m\322\n\020\021\215S"
+	.string	"\320x\256\210\203\023L$\027\321\332&{\247\0242"
+	.string	"8"
+	.string	"2"
+	.string	"\247\036\217\2209\335\374 sj\321\276}l\255\006%@\212e\300\356\326yr\361R\364\357\362\001\325\nu\251q\330]K\325j\344\236\267\275`{\302>D+R\200\300\332\350\213\313\3669\366\354%!sE\304Z\017r\374\212x\230a\270\202\r)!\241\355n\307\237\315\251\002wi?\345*\342_\0367\330e\335h\273c\307\r\233"
+	.string	"l\037\023\304T\322\311\3159\345\264O\241\274\312\262V\263\245&\312\036Qr\232\330\347vw=Y\366g?\275\354\347\036\373\347a\277\324$\304\b\250h\331\030?=|\307\301\216\203\324}\b\034\362\210@\017\024f\200\337\005\310\364y\245\260\323(\201#Q\365F\2254\3526j\350\003\253\207\301^\311\342\253&\317\373*g\334s;Y\246\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_ctmReset.49.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\225\007"
+	.string	"\242\21656Po\322\001\240\250\234\325j"
+	.string	"\245D{\007\f\r*\350\023\303\215\242Y-\022\304\370p\366~\264\250\237@-\3257\252\206\262\\n5\245k\036\262\354\3336B\366N)\264\242"
+	.string	"U\f\001\366p>Tv\260\b:!:\241)/\254\222\270\250\365\211\322\212 \253\232\210\236I#\347\300\362z\2301$\345\214\233\272\237\026rnh\351.\240\310\323\263\261\212\367\315/e\245\023A\315\256\332\203\033\366\247\335]C\316\206\005,*\016\245\335\214\322\313v\024\n\310\306\366\237\375\220\213d\037\261\270\300.gr\262[\021\234\2409\345z\002\314)\315\0070\247\234\331\244W\217\315|\2200J\\v7\302\216g\177\231\177\222\003l#\355/\243\260\273~\333H\343\206\267m`{\3016G\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_ctmSet.50.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\031\001\355\013"
+	.string	"\246UO?"
+	.string	"Q5\035\034\036@\004m\032d\315\204\374\373\367\374,\n\264[\224\314t7\233\346\270t9&\237t\200X\240H\362\343\365\347b\202\277QV\rf\272\004\317\205\3552\354\322\377\243\365&r\247\024:"
+	.string	"D"
+	.string	"6"
+	.string	"\253\326\356(q\202\307\247\307\017\300>\037\027\200}Z\264c|\034mV\302F\206\0253vWS\022\027/E\377\253C@!\317e\246`w-A!\017\267\336\266\001\333\020\354w\b\037^Xd\354r\270Qc;f\013\023\266\037\261U0\036\244X8@\235hp\03210\231u\001X\r\237\r\013\344x\025\342Kf\031\262\353\202Fkw%\256<>\013\\\227\366IG!>\305\205\007\330\025\005 :0\350\307Sf\212\351\324KU\245\332\026:\362 #\020A\332\020\352\261G\217\324\021\366\257\335]\253\310\276\352\317\236\372\261\243\376\371\323\177\335\364\353K\277\204\020\b\034\305\323\215\342)\307y\272q\236r\233\247\333\346i\330U\320t\025\016_&\230\360\263t&\204\240\004\013\007\3746\235\216\302&\314`\264/\243i2\235\247]\300P\233\034\360\267\211"
+	.string	"j\234\357\003\265\310\270\017\033"
+	.string	"\3043\241L\2130LD\330\253\256\360\202k\230\274\031\016\030\001\371\300\300\200\024\340\016`\fH\001\356"
+	.ascii	"\306\200\024\340\016`\fH\031\024E\tv\0036@\023i\n\013\270\226"
+	.ascii	"\027\302$\003"
+	.text
+	.section	.gnu.lto_ctmTranslate.51.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\235\t"
+	.string	"\366\221B<0\345(\035\340\341q\340\037\202\275\350 -\347\376\323\b\256\350\240\205\013!\0247\227\305\216\217+\240V\004\201Ql\236\272e\227R\200\3017\312\203\265\005\205\022\026\r7\376\267M\266L)."
+	.string	"2"
+	.string	"0"
+	.string	"\232K\316\0174\227\006m\001\017Ov\203\022\342\341\"\260\2733\232\034\274\202\376]\037H\251N\327\215\303\356ZS\252\221;\336\366\202m\b\333\261R&\305\366;v\213\344A\303\303\200g9&+X\020\324\307kw=\006q.\025\262\253\375\226\273\200\177\331\270\301\356\n\300k7\364\270\201s\351\360\b\001\216`\201qD\224\245\306\250\321\316\370\364)\353\214\n\254#\236\354\360\244\261\304~\266\273\353\270\262\337\372\343Y\277\312\204\225"
+	.string	"\024\003vE\n\304\026\026\237\247\032\236v\032FI\003\021X\364\031u[\350\253\350\270\211\220\307m\246O\2630u\244\321\334H\263D\322.\246\210\353\346\207\301\233I\202\233\336\266q\263\023\356\263\215\253\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_ctmScale.52.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\225\t"
+	.string	"f\322B9@\217\322\001P\330Y\374\367b\337\200\347_\013\0079\361\205\225w\252\317\023(e\037\236\300:-\241Q\f7\360\023vU*\007\235\007\274\002\356\"\240\264\374[~\273\311\336)\0050"
+	.string	"2"
+	.string	"2"
+	.string	"'\310|j\037\310|\032\264_\036\206\254F\304#\243\005\263\273T\202\034|\004\375\267\276A\245L\217\032\205\335uD\245:ny\333\007\266\031l\307\002\266\317\261Yve\001\253q\332X\210\341Q\300\257\354\362fw%\366\332\335\216?\332\247A\366h\237\344%\340M,.\260\253r\275v\303\216\023\264O\207\001\r)\260\013y\362\214RFiS|\361(G\226\023\030\2064\331\241)\312\017\373\331\356\256\245\312>\353\227_\375q\026\274Z8\227]\216\230\330\302\246\312H_\215\0255\326mb\264}"
+	.string	"\034\362\210j\007\372 \252\367"
+	.string	"*y\035\351\333\"H\225\023\321\216\243#n\223\240!\257R\017\202;\222\203GK]\347QN\270\317V\252\034\016"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F\006\035QB\334@\fpE\232\232\002\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_ctmRotate.53.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\325\b"
+	.string	"&\221>7@\345\2501\264\327qu\304<2\020*\374f\001-p/-^/\277\037\007\263G\346\240\344B.\256*\301Z\237u\364r\372Y\220%\031VB\226\fl\263rK\231R,"
+	.string	","
+	.string	"/"
+	.string	"\033\017d,\353\265/\376<\256\001\371\3108\201\371?c\207=C\257\266\2119\252U\312P\243\360\277P\265\332p\243\333\036\264]h\253\022\255;m\341\347\022\317\255\242\224\363\277"
+	.string	"\270\376{\n\332X\032d\206\255E<\342\231\244\302\002?\353\345\372?O\0236\226\375L\220\261\fe\200\305,\342E%\204\261\245@A\253\nWXb\0301\325~)\0309Zg\377\337\310j\335\262aV\320\342\362"
+	.string	"\3735\002\304<&SB\032\234;m\242\244\201\002*\372\214\272-\204\202\3508\207\320\211\333L(-\302\324\221Fs#\315\022I\223\230\"\256\233\037\204n\246\006n\236\266\215\233\235\357\316\036Y\001\013"
+	.ascii	"\3043\241\214\351\3553<\316\272\270F\031\303\274@`pE\232\232"
+	.ascii	"\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_contextPush.54.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\225\007"
+	.string	"\242\21656`m\322\001p\341\036\341\250{/R\354\035,6\0304&\f\250\223+\232&\370\230\252\354\315h\r\373?j\250>\210\374\310?0A\302\277\251\274\t\255YB\366N)\264\222"
+	.string	"U\f\001\356l<Tr\260\017\235\017\234\320\224\027VA\\\324\362DiE\220UE\304\316\244qs`y9\314\030\222rFM\335O\01397\260t\025P\344\351\331\330\304\373\346GZ\351DP\263\253\366`\206\375iw\327\220\263aA\t\345s\262{\321R\332\2162\361\320\330\376\263\017\362\220\354\"\024\027\330\345H%\273\025\301\t\231S\256'\270\234\312|\340r\312\231\235\362\312\261\230\216\017\013\022\225\335\215p\343\331_\346\177\344"
+	.string	"\333H\373\303(\354\256\3376\302\270\341m\033\330^\260\255\021\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_contextPop.55.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\235\007"
+	.string	"\242\31656Po\322\001 [n\225:(a'\374\206\323\242dm#\246s\\\263Z$\210\361\341\354\375hM\375\fntuU\rE\333o5\245\255\034\263\354\3336B\366N)\264\222\020U\f\001\376t@Tz0\b:\037<\243)/\254\n]\324\002EiE\221UE\304\317\244\261s`y9\3148\222rFN\335O\01397lt\025\220\344\351\331\330\304\373\346\307\222\321\221\240fW\355A\016\373\323\356\256!g\303\002\215\226\020\312\356E\f\314v\224J\b\307\366\237}\221\217d'\241\270\300.\267\222\262[\021\234\2609\345z\202\314\251\315\0072\247\234\331.\257\037\253\0019\2610y\331\335\b=\236\375e\376K\016\260\225\264?\215\302\356\372m%\214\033\336\266\201\355\005\333\035\001\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_frskyOsdCanvasVTable.56.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\326\001u\017"
+	.string	"\364\032\226\002"
+	.string	""
+	.string	"4"
+	.string	"\005\001\212\001\202\200\200\374\342\203\317\267\005\177}\370\316\307\005\177{\315\247\005yw\270\315\227\005us\370\314\327\005uq\270\314\367\003om\370\307\227\005\177k\306\207\tig\270\306\247\007ie\370\305\307\007ic\270\305\367\005ia\370\304\227\005i_\270\304\267\005i]\370\377\266\007[Y\270\377\326\005[W\370\376\366\005[U\270\376\246\007SQ\370\375\306\005SO\270\375\366\005MK\370\374\266\005IG\270\374\246\007EC\370\367\346\005A\277\177\270\367\246\007\177\275\370\366\246\005i\273\270\366\266\005i\271\365\306\007\267\177\265\364\266\007\263\177\261\270\364\366\005\257\177\255\370\357\306\007S\253\357\346\007S\251\370\356\226\005\247\177\245\270\356\246\007\243\177\241\370\355\346\007\267\177\237\270\355\326\005\267\177\235\370\354\366\005\267\177\233\177"
+	.string	"?\202\210\200\330\004\231\177\227\177\335\001\225\177\334\001\223\177\333\001\221\177\332\001\217\177\331\001\215\177\330\001\213\177\327\001\211\177\326\001\207\177\325\001\205\177\324\001\203\177\323\001\201\177\322\001\377~\321\001\375~\320\001\373~\317\001\371~\316\001\367~\315\001\365~\314\001\363~\313\001\361~\312\001\357~\311\001\355~\310\001\353~\307\001\351~\306\001\347~\305\001\345~\304\001\343~\303\001\341~\302\001\337~\301\001\335~\300\001\333~\277\001\331~\276\001\327~\275\001\325~\274\001\323~\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/io/displayport_frsky_osd.c"
+	.ascii	"# \220\243\255\006\305\024\223b\246\305\b\025-\354R1c\245\304"
+	.ascii	"\273\354\262R\004\225\302ALRH!\005)\244 \205\224\244\220BJRH"
+	.ascii	"I\n\321\245$\205\224\244@t\270\024C\352P\341"
+	.text
+	.section	.gnu.lto_getCanvas.57.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\023\001\335\f"
+	.string	"\246XYC\360\2226\035\322\304\224\361\t\023GdU]\266\0168\336\242\325l\024n\327\325\311|\217{\242\025\212\370\236\007\261\t\243\307h\032\213g;\345\306\342\260(\262sji\311XJ\026\217\275}\332\021\"{K\231RF"
+	.string	"C"
+	.string	"H"
+	.string	"\004vK3h\354~\f\\R=\372\273\001\352\261z\001\352\321\266\033\224\204,\372\327B\n!\231Xqq\332\375,-q\321S\344\237\305\023\244\3001b\006\206e\364\f\201\260\273N\217\345\303\255\267\275\300v\004\373!\002\246\031\030\020)Yc\177\243T\022\366\341\356\256\265d\337\345\247b\032\302\264\306t\302\364\001\234\306\303\311G\206\033\273\244\032 +\023k\240\260\035\262El\353\007B0`5\230:<\310\264\257\342+BwAy\232;&\250\216\210\320\221jo\036\343\272\367\343\232\2321+A\004\244\315\251\220\367\256\007r\304\310\250\350\310>\fm\244ew\303=\377\305_2x\242Q\367\264\355-.T\273\353\3007q]"
+	.string	"\036'\036}\024\3521\276\330\b\034\254s}\272NVu\027\206\316\205Q\306HL\272m\003:\3518\n\233\017\267y@\227\005O\227\231X[fu\262K\2630\256\263H\024x\363p8\353\263m\234\345o\017WK\276\210:\r\207S\217\024U1T[\302e\250\302\024"
+	.string	">\033Ej1\216\254 \200"
+	.ascii	"\001\b`\232\b\201\233!\307+x\311\020O\251S\241\306\004\255\301"
+	.ascii	"\250YB]\270'\306FP\"\030I\200\n\363\272&\031"
+	.text
+	.section	.gnu.lto_frskyOsdVTable.58.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"]\b"
+	.string	"d\016$\001"
+	.string	""
+	.string	"4"
+	.string	"\005\001\212\001\202\200\200\374\342\303\355\247\005\177}\270\355\247\007{y\370\354\227\007wu\270\354\267\005sq\370\347\267\007om\270\347\307\005ki\370\346\367\003{g\270\346\247\005ec\370\345\327\007a_\270\345\247\005][\370\344\307\005YW\270\344\267\005US\330\337\007eQ\270\337\307\005eO\370\336\207\005eM\270\336\327\003eK"
+	.string	"?\202\210\200\300\002IG\312\001E\311\001C\310\001A\307\001\277\177\306\001\275\177\305\001\273\177\304\001\271\177\303\001\267\177\302\001\265\177\301\001\263\177\300\001\261\177\277\001\257\177\276\001\255\177\275\001\253\177\274\001\251\177\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/io/displayport_frsky_osd.c"
+	.string	"\020"
+	.string	"\200\024 \205c\210\006\244"
+	.string	"R"
+	.string	")\200\024@\n \005\220\002H\001\244"
+	.ascii	"Rb\222b&\251\003\200\003"
+	.text
+	.section	.gnu.lto_frskyOsdDisplayPortInit.59.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"M\013"
+	.string	"\206\325N? Q\224\016"
+	.string	"EdO\322H!\013X!/\016\224\223\034\024\214\266^"
+	.string	"\312 v\266\223\373\277%\3112Q\033d\256[13\353\007\242"
+	.string	"\232V\300\341\200\272X4BBT\355\311\330dK\231R;"
+	.string	"="
+	.string	":"
+	.string	"\036s~\227\277\017\210\257\254\013\210\257\266\303\273\303\325\316\227x\237C\013\303\027\036@\271X\021\300\023A\312F\206\017O]I^H\025\200e\316i\035y\246\273\272m\005\266-\366\t\004V\353\252\0379H\207\307\f.d\316R\310\307\354\250T\200\260\315\331\023\333\252\366G\234\004\367\317\202#sn\370H1'\007\002'\260^\025\200\266}\021Gq\356(\237\007\223\244\304\342B\211\272\244\265\005\264!\030Q[J\320\217\342\35694\2048\261\336\342\267\301\306\013\221\326pT\270\366\204\n\372\321\367\251[-@&\r\031\242\375\330_H\227\203}8\367\344\370\357\207\001\234\215G\333\030\310\215\006\2430q\246\242\321\344e{\240e\016.\236Lv6\f\204\216\206i.\211]\0210\f\347\312d\332U1`\331\331d\227G\312\354\232|\240\357\311O}A\f\030&P\250\337Eo\334\020"
+	.ascii	"\\\b\230\2473\366\b0\013+\202j\txm\335\0134\254\342\302\0302"
+	.ascii	"\3268\325\b=\306\bh\"\222\022\330\324\3254\006\005\005"
+	.text
+	.section	.gnu.lto_checkReady.part.0.114.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\201\001]\017"
+	.string	"\266]gE"
+	.string	"\221(\035\257\211\026\354\233k\357\325S\356\205\323*`\0039\f\250\260\330*|\212\202*q\374I\227\210\b\331\342P\264X\2145\207Z\3772\350\377\177\367\216\344,\037\340\303\023Tzi\2731;id\023)S\nQ"
+	.string	"S"
+	.string	"R"
+	.string	"\353z\021c7t\360\350\317\366\350\360\007\264\307\355\005\264G\373(,\362A\261l[\344\2232\370\360e\325\301\220a\005\226c7\344\036u\304\301kf\240\237*\026\224\353aWp33\243\006\r\013\207\347\307\263\316\310\356zk\271\343mC\260-\301>N\273\312\331\261!\242\214\022\227\371\355\3733\217\331\036\237\234\205\021\264\230h\275v\327sr\177\005\312\207\331c\3732\217\001\263\365p\0346\257\232\335\260\301\243\263|\f\br\034\033\257\232\b[\312\366X\363!\3520'\220p7\260\254i?\305U\244\016s:\201\r\232`\246\203M\352c\026\335\005\005\003/\273\373\300oqa\344\223x\364O\332\343U7\327\324\344\261\322#%s\034 \375\230I\227W]\037;"
+	.string	"\032'X:n\250(J\252\2135{\266\352\262\235\326:\351\250\245\263\207\277v\322\251\245/`\301\207\001\255\r$P\350\023y\232(D\002\231>\322hs(\244\344\353HN\025>o\002\211\311\353J'\220\205\3227*\341\272\021G\032\201L\270\220\367q!\f\334\225D\036g\352:\217\313g\253\256\217\374AMS\r\2665\365H\212\252XU]`\377\212\006\304\252\025[\025\341\b:\214Lc(\013\036"
+	.string	"I+\210\002\021\370\321\300~6\203\306\n\005\301\f\241\003P\f\310M\202\213\234\260\217/\353\201\247"
+	.ascii	"\231\313\\\002\262,\300\330%\272*\330\272~\b9\204l+\313H0\235"
+	.ascii	"\263\017\355\\P\023\031uZ\222\324\3005\357\277\266\214\001"
+	.text
+	.section	.gnu.lto_frskyOsdDisplayPortInit.part.0.116.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`4\001\335\r"
+	.string	"\206\231[D\020\221\223\016\220\257\302\212\002\314\020\276\")\226\326\266\260~>@\325\341\375G\b!m\212\372\354\001\307\337\320\336\362T[RlG1\212\241\375 \212#"
+	.string	"\256(\225\320\276\364\341PL\314:TH%\233\310\235RG"
+	.string	"F"
+	.string	"H"
+	.string	"\217%@\030l\3730'\021\362g\240\364\222A"
+	.string	")\006\n\352\306nI>\272\364\002\326\343u\002\326\243z\370w\205\325\347\303Q\212\350\372\323\017\240\320\230h\310\244h8\364x\005`\263\273\276T\356x\333\flo\354\203\b\262F\307\312.)G\315v\210.B\334\364\333\367Q<ec.9\312\272\201f\304\356b%\367M\200\374\2231\023\3501\336\307K\202G+\264_\372\211\320c<\007\330e\251\231\331=)x\364\202\353\361\243\262C6\026)N\006Sw"
+	.string	"#\002\207\215\023\025y"
+	.ascii	"<\3523\333\265[\201\305[h\325\310fm\326\343Q_\361]\273&2W1\375"
+	.ascii	"\017\217&\371\340G\217\376\327I\200\037\371\247\377\202\214\027"
+	.ascii	"3(\250\b\252\213\265z\265\332b\033\3721[\366\351\274\0063\353"
+	.ascii	"h\0230s@:\335\f\361F:\356A\310\207\233\036O\004\202\247\323:"
+	.ascii	"rj2\202&\262I\016\327I\020\004\236\236\214\223\23799\211\275"
+	.ascii	"Zm\361\200&\271ZPoL\364\304\252\352b\253p\200AZI\261\312\342"
+	.ascii	"\016\350\007  \260\2421\272\016]\212\021\234\300\243\002\241"
+	.ascii	"?\307\200,Oy4\375\013\002L\2647\315=\307o\324X\241m\371\024\220"
+	.ascii	"\331\346\006\3156Ll4J\256\253h\301\326\004\361\204\242\306\212"
+	.ascii	"\260\256\\\346\016C\200\351)*\357\277\266\217\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`T\f\r\027"
+	.string	"&%\211H\220\224N:"
+	.string	""
+	.string	"\b\030\235\355\221&\357N\242\311\273S\244i\242f\304;\221\210"
+	.string	"\314\314;Y7\"E\323"
+	.string	"1\0040\357\f\001"
+	.string	";C"
+	.string	"\363\317\020"
+	.string	"\302\303\237S\264\244\031\232?\244\211\244\311\233\223H\362g\013iw\nr"
+	.string	"r"
+	.string	"p"
+	.ascii	"\257\221\272M\324o\240\216\363\364\034\247\353(\277\323t\"\323"
+	.ascii	"\213\311\363 \337s\274\317\322Q\245\377$\035\b\351AG\0272\372"
+	.ascii	"\220\361DE/\"\272q\350FB?\n:\022\320\223~\256\024D\277\344\363"
+	.ascii	"c\317\221<O\026\317D|Sp\355\332Lw\224B\235;\345\274\005\347,"
+	.ascii	"7W\261\271p\2302\231YA\354\333f=jI\232\246i\315K\202\266W\252"
+	.ascii	"\002\367\331\207\333\314\303]\326\341&\343p\217m\270\3054\334"
+	.ascii	"a\031n0\f\367\327\205\333\313\302\335U\341vR\270\271&\334[\022"
+	.ascii	"n\255\bwV\325\247\3224\265\211\201\020NUm\007\231\351\220\007"
+	.ascii	"\207\n\306<\taV\330tp'i\360\227b\312d\246B\030\334H\026|\250"
+	.ascii	"\340+\tn\202\340(\007\236b\340.\313\237\0248\f\201\307\f\270"
+	.ascii	"\214\200\317P\235f*Z+\316\002@\2452\225\"\205\022u\262\250\311"
+	.ascii	"V,\341.\205\033\370G\005\362\270\324\216\233O\307}$\307m\004"
+	.ascii	"\307]\344\306\rh\343\376\253q\367\321\270\375f\334O\031\367^"
+	.ascii	"\214[\017\306\235\367\342\306sq\337\265\270\355X\334u+n:\025"
+	.ascii	"\367\\\212[\016\305\035w\342\2063q\277\225\270\335H\334m#n\266"
+	.ascii	"\253{M\304\255fu\247\205\270\321@\004\266\252\325\351\003\bX"
+	.ascii	"R\271(\240\362/\271\313\344ZU\373\241\021\371qD.\352\207<nm\342"
+	.ascii	"\035\373\226\224\026\345Kz\"mm\356\035\355R\317h\227x\306<\343"
+	.ascii	"\016\357\212\026\265#\252\033\332\372\244\023\232\013\262\034"
+	.ascii	"\320\326g\334\017\034\372\346\343\326\323\306\303V\\#\252\355"
+	.ascii	",\232\246\263\265\211\226\263C\347\031\316^\231\335\354\020\253"
+	.ascii	"\314\206\254f\214Fl&L\006,\300W\214\027L\327\213\323\205\253"
+	.ascii	"e\213%\200\246\2501\bM\225\247N{\006\200\203$I:\021 \bBB\322"
+	.ascii	"\b\t!\204\b#\344\007\311J,\"\177\241\235\267\316\256\370\270"
+	.ascii	"\377f>A\335J\363\352\335\254\253\376\276\332\0366\325TI\007\025"
+	.ascii	"\024\234OG\323(\341\261P\326Uo\325\336\256]\267F\205I\274\321"
+	.ascii	"#+\272\304\023\221=Q\307\023\373\274\277\236\240\307\266\224"
+	.ascii	"\226VWUWUUUkKkKKK\253\253\252\253\364\363\323j\205\306KS\353"
+	.ascii	"\177\365=K\263\210\354\317\"\021Y\251\361\234\007\330\327\036"
+	.ascii	"\005\200\207{?\367f\177\354\315\374\354\217\375\231\037{\263"
+	.ascii	"?\363sO\347\263x4\315\342P\241\017+,\234i\340W\001"
+	.text
+	.section	.gnu.lto_.refs.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375 \203e\003"
+	.string	"2\b\032\"\020K\2475"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\374\376\377\377\377\377o@\377\207\222\036!\344g\202\232\220\264eG5x\360a\302iC\351\n\027\"d\350\260\275\231u\023\366Z\366\032\026BJT\\dlt|\204\214\264JNRVZ^bfjnrvz~\202\206\212\216^\001\006\0248\220`\301\352\272V\245\332\335E\004"
+	.text
+	.section	.gnu.lto_.decls.458485c6f2c8f7dc,"e",@progbits
+	.string	"(\265/\375`\263R=.\001\332\351\251jT N\271\225t\207\272\367"
+	.ascii	"'\205\323\205\222\231\206a\252Y5yxh\013W\203\376\244!\342\336"
+	.ascii	"\024EQ>\340\257\262Fq\233\034r+j\"\260u=\356\2771\3434\320f\372"
+	.ascii	"~6M\3174\227\265\351\305\346\034\217Sm\236F\373^!\345\017\322"
+	.ascii	"\b\331[\356\024\241\005~\006\321\006C\222\312\032w\323m\202\243"
+	.ascii	"\207\256q3\221\341=\0315\356\243^R\243\262k[j\2451\243\251\254"
+	.ascii	"'Y\316\331\005%.z\343\250q#u\322[F\307\270\315\035-\343\001\316"
+	.ascii	"\234mZ\206\213b\3166.\326~`\355\007XLjkM\305\357\350\332Dm\224"
+	.ascii	"\306#\303HQ\303Py8\325\272\216\024\375\020\205\001OG\256\032"
+	.ascii	"\267\3201\310\316\023\332\370\275\266\266O\277\260f?\rt\274\303"
+	.ascii	"\231\317r~\262\\\233\030C\336\032{`?\2508\204\352\322\330\330"
+	.ascii	"\330hC\250\357\261\365\275\265\332\334:\235\303\362\226$\244"
+	.ascii	"G\343\316I+\313\361\243q\337X4\313\007\246\307\244q\333t\323"
+	.ascii	"\372\016Zm7\027\025[\240a8\202\032[E\226'G\310\236\215\355\023"
+	.ascii	"\213\226Bu\006\304\330\330:ai\3521\203Gc\233\370\271\353D{\223"
+	.ascii	"\321\3306A<\024\\\255\263\310z{\267Z.\266\3656\207\325>i\374"
+	.ascii	")Qs\374\331\334\360\273U\322\022\244\306\221\033\215m\222\251"
+	.ascii	"'5\024\033[$\237SQ\242\202\301\326\330\036\371\\TMG_ck\344sG"
+	.ascii	"<=\251\247\271\243\270\261!\215o\201V\013g_\324[\234=\350\212"
+	.ascii	"\340\236\225\024\221[(J\264\360\212\252\261\325\263h.[\201vb"
+	.ascii	"\215\355\0205h\255\306\223\3066\357o+\2224%\306\306\026o\005"
+	.ascii	"\363\213Zll\357\376\226\232\321\210\343kl\355pX-\324\276\250"
+	.ascii	"_\261\376v.\210\313\2232\034Hr\267ARx,!\322ll\201\374D"
+	.string	"\035.il\343\376\346\362\303,\t\026\212\325\022\332\027\365\267?\334R\262\310\304\202\332n\335\324\245\253&\215\215-\033\336\301\333+\322\370\207\177\373\217bo\374\b[k|\023\254\277UK\303r\201pV>n\323\376\022L\270\340J\316d9g\001\244\213Pn\213\215\177h\321\376\243H \252F[\343\337\242\375v\314\222\331\036\227\347\307\231\323r~z@)\333\001t\326\370\314\2629\205-5>\f\353\177kfy\330\035\031\204\013\017\335!N\343S`\275}\236\003\233l\302[\326\367\332\331\276\250=d_\324?\355\007u\265/*\nn\r\177\237\270F\2010b\266b~[g\177\334\t\340\026\341Mu\370\323\022\177s\335\241\377\326\bu\214\305;\361w\f\177\227\340o\017\374\r\202\277M\360w\b\376.\3617\t\376\326\300\3372\374\275\201\277G\360w\007\376\206\341o\016\374m\342\357\023\215\"\252\002)\224p"
+	.string	"\005\374-\345\301\r\272\215Z\304\013\364\237\001?6\373m\227\345\372m\t\215\243Up\177~\253\365\004\320\274\374x\310oc\374\026\207\337\016\375\366\206\337\026\375\026\306o\363o[\374\266\347\2679\277M\372\355\213\337\342\374\266\371\333\235\337\272\370\355\013~{\363[\026\374\026\351\267.\370\255\r\277]\301o\203~\013\364[\235\337\n\375\326\346\267D\277\375\371\255\317o[\360\333\243\337\262\370-\317\337*\260*l\214\035\201-a7`1`Q\260\n\260\036\330\364\212Wr\350\203\334\355i\377C\360c#aK$cL\277\277\313\356\013\026\177g6\004\376\315\343\372\264\030\374\373\307\355\371\337\201\033\n;\316\005fR\267\202\303;\0264\311k\201\023=\034\242P\027,\376-\344\336\274"
+	.ascii	"7\376e\373\267\222\313\323\274\177+\271<6\251\341\315\361o&7"
+	.ascii	"\343\240\374\356l\220\243\362\337\243\316\006:,.9\226\305\245"
+	.ascii	"\204\267\374\251\313\177\001\200\363["
+	.string	"\026[\002\217\007\rz^8\360\371\360\267\220\233\377&^\004\340\003\373\362\243\301\177A\260\371m\f@\034\374w\001\315\377 \004u \202\020\001\376f\222\377\233\270\372\247\037\230\360\202\257\253\374\251\001\376\033\001\027\244\370\361O\0210\001\030 T\300H\001\177G\377\353\001\016\377m\301\337N\372h\001*\304h\300\177]\270\341\262\360[=\244\021\376\256\272-\376+c\303\177\023S0\374\327\003,\376JxJ\371S\013\f`.)'\325B\212\337\037\307\3757\004\314\377 81\360_\023,\377\203\200w\224?\035\321^\312\377&\240_\377T\004\n\2422\3607\230\n\236\376\351\013(\336~\213\367\376\261\333\177W\374w\346\277\310\377\316\360_\024\374\367\004\377\025\301\177I\374\027\206\377n\340\277/\374W\205\377^\340\277\025\370\357\004\376\233\302\177O\370/\t\377\025\341\277\f\370o\210\377~\360\337\016\376\313\301\1775\370o"
+	.ascii	"\376\333\341\277\353\177\355\337\210\177\033\376=\370w\340\337"
+	.ascii	"\177\177\363\375\r\375[\357\357\274\277\357\376\256\373;\356"
+	.ascii	"\357\267\277\321\376>\373[\307\337c\177\207\375\215\343\357\257"
+	.ascii	"\277\267\376\356\372{\352o\253\277g\374-\365w\324\337P\177;\377"
+	.ascii	"~\372;\351o\244\277c\374}\364\267\321\3370\376.\372\233\350\357"
+	.ascii	"\241\277\205\376\016\372\033\350\357\237\277_\374\355\363w\317"
+	.ascii	"\337<\177\357\374\255\363w\316\3378\177\337\374m\363w\363\357"
+	.ascii	"\374\367\013\376v\301\3378\374\335\202\277Y\360\367\n\376v\361"
+	.ascii	"\367\r\177\267\370\333\206\277Y\374\315\374{\371\267\362o\232"
+	.ascii	"\277S\360w\362\357\024\177\243\370\233\206\337\336\375V\351\267"
+	.ascii	"^\177\307\374\215\202\337\006\376\366\357\2671\374v\203\377&"
+	.ascii	"\376w\340\267\320\337B\375V\357\267)~[\302o]\376\203\360\333"
+	.ascii	"\227\337\342\375\026\307oo\374\366\353\267K\377\363\177\274\377"
+	.ascii	"\021hlll\374U\022\177\225\343?\201\031\001(\203IH\352\323!\337"
+	.ascii	"O\214c$+\272\237gc|t\r]\212r\320\365(\002\243(\355+b\343\204"
+	.ascii	"\350\270\3100\210\340\221\306xh\235\3321D\2601\026\302A,u\177"
+	.ascii	"Y9AFf\204\2555\306@.\205JG\342\032\037\005\016\377\240\371\364"
+	.ascii	"\240\324@[c\202y\216{\\\216\330\232F"
+	.string	"\032\343\235kh\225\364!u5\306:\355e\327Tx\325\370\2078\207\310\026\332\032\316\3018sAz,\211\373Y\373\3027\267\210\212\204\306\246\323\370(^\353\217\2338\247\344 f\227\3436\036\347\366Si3\f\262\323\3702^C\224\302\253\354<J\325\372_\305\033u12\267x\343>\371\215*\276\331`5\276N\256\241\220\216B,\"B\306h\3405>\n\322\372\337&\0271\345\352\260j\361\036\376\"6\220\"9\310\032\377\360\032\312@{\2522d2E\305\207t\227\345\216\370\030-\271l\307\035\243@\257\306G\311YSV\304\365\277\201\267f7\360\342\271\360\314M\0255\263\251\262\304<4\264\200\257c\353\177\001\377\272\t\247\351\250\261\222\030\177g}\215\277f\255\377o\022kv\375n\221\333\247\337\355\273H,4)\217\320\025\025\004,\347\f\"\204c\230\0304\b\343\377\036\371E\362\267\217\313w\243P\020"
+	.ascii	"\224\302!\270\256\306\327\210\210\337#/\352P\3223\247\3710J\332"
+	.ascii	"kl\001\373\242~\005Z\177d\\q\336\203\272\334\310\3431#\225CS"
+	.ascii	"\334\321\370\352)\240\354\354\250\361\217E\356\220\274\213\267"
+	.ascii	"\324\344\356\252\361\235\n\020#\276\032\215\177\234[oB\217@\302"
+	.ascii	"\234\237s\177;x\334\250A\2563hT\357\307\005r\345n\220\013w\205"
+	.string	"\\\272kw\337n\335\215\263fw\356\262\275\363n[\323s\0026\242e:n\016E\256\234\363/X\330\315!\004\027\325K\3149\317\335\251\273\366\022\350\214\352%\232\265\237\272\345\214\352%\242\335\250\226\3463\013\035\265\236Q\275\304\271\353\326~\026\232\224\233\205\007\350\312Q\275U\353\351\016\017\004\376\261j\355l?\250?*\255\377]\273j:3\242lZ\336\202p\236\244]\037,\214_|L\215\177\324Y\177l\256W\025\327\253M\326\253KV\020\366\203z\265o\275\232\267^\005\262\222`?\250W\354\216Y3\020\227\314\305\362\335\00415\276\312\266\276 [\020\352\033-\b\365\252\331\212B\016\035\270<c"
+	.string	"\315\300\001\002\216\034\033\331\215/\353<[\373j|\226\311\346\366\226\032\337\222\321x\240"
+	.string	"nx\\\300\341\204\320\206T{\265\2449;\243\\W\353\316h/\013\255\272"
+	.string	"\331\023\302\333\224u\243Zn\316N\213\rT\202\tW\353:\335(\013M\232\200\230\"\241\326\235\272V"
+	.ascii	"\330\312\202y\211\\w\353\332\270]\327\353\326\260fW\313\356\370"
+	.ascii	"\275\272X!\204\200\002C\007\330\221\026|uk\265O\373A\005q\255"
+	.ascii	"\252\340\320\262`<\217:9\214\021]\252^\322\342\304\312\006\264"
+	.ascii	"\361\325\252\365*\324zui\275j\264\336\247\353\264f\035\\\250"
+	.ascii	"\247\013\013c\030c\264\361\325\237\365\266\003\3256\332\016\324"
+	.ascii	"\247\3215\204\375\240\376\227i\351\345\007\232\337\275E\2011"
+	.ascii	"l4~\342\344\234A\260\350\0041\332k\034h\007\355\237XG\265T_Y"
+	.ascii	"\345\350C\250`\036\230\221\301n\023\301\365_\244f\274D\355\344"
+	.ascii	"\302\270F\267\331\211\327\347\352\\\031\367\347\346\\\233\313"
+	.ascii	"\323On\2768\255x\223\272\261\233t\364\n\335\240\273s\207\356"
+	.ascii	"\315-\272@\367E/\336\030\215x{\254\331=\352%o&mx\020\317\234"
+	.ascii	"qr\316Bl\235\335K{\243\263sjsx\255#Tf\327\354\0176\037\355\326"
+	.ascii	"Ad\364Y\367h\342\352\263F\263\177LyCZ'\210\260\320\376\205u\236"
+	.ascii	"^\367\001q\025\261\200\366\017\002O\021\205\3356$\230\007\306"
+	.ascii	"\3042\332\305\032>\322\272M)P\320\376\215\021.\261\177`\275\323"
+	.ascii	"<\255\2035G\327wIL\f\355\342\226\020\313g\325t\330\306f\353d"
+	.ascii	"qEauX\025\227-\263:\254Z\004\340\004\363\300\214\034iA\021O\301"
+	.ascii	"<\260\235\356i\250+\256\234\237w\300\337b<\254\232Scg\273\250"
+	.ascii	"\365\006g\347\326l\021\333g\377,4\251C\306\341\221\203\253\305"
+	.ascii	"\306z\207\205&=s\221\003\b\005\363\300r~\336\222\375\"\356Q\023"
+	.ascii	"v\333\212\037g\356\331\271\361\271b\204\2027\022s~\206\020B\b"
+	.ascii	"!\200\b\341\330W\226\204\345\002~\252c\365\360\264\037\324N\262"
+	.ascii	"/\352S\253\365\251\322\372\024h=n\262\376-\030\270\"\241\243"
+	.ascii	"\363\003|\007\252\204"
+	.string	"PB\317\306\3757$\343\246\307\317\247H\316\251q\373u'i%o\277F\362\022L\370\nN&\313\371\331~8g\033k?h\261\366\203tN\313\206\207\212\217\013\327c\"k\207\276\"qLr2\032w\021\033(\3440\253q\357a\033E\031c\215\033\3729\033?\002\255\0327\221\317\261\020\375\364\204a\272\365\370\271z`_\324\343\254\365\357\273\266c\212\002{\321\270\355t`\020\0016n!\026\255)\204\230\325\370\207!\\|\320\020o\032\0377\255$\004\221C\"\002\227\b\344-\207\002\205\265$G\343\216[\251a\243\250\t\234J\221\342b\340\217~s\376\2449\033\037\333\374\270\203ml)\210p4\374\326\336l\027\021\221o\253q\253Y4\276\253\253\302\306?\\1bt\003\322\370\027o\375\023n\375E[\017w\277\326\277w\264\331\255\261\227\204F?\337fW~G[\215[\007\212\317\016\333^\343.[\215"
+	.string	"\251r\032w\016\333\267\325\264\321\270\311\332+e*J\3056\265\036\032\326`*N#\205C\235\303\033\f?\231\342\311\321\270q\354\320A\311\032\367\215\234\027\315&\215\373\353s\353\021\033\021%\215[\253\275\232xc6\032w\215\336\262f 4\327\273\253m<\265y\346g\316O\227\306ZT\343\321\270\203\375\240\266}Q\177\233\326[\020\324\333\330hAP;\353\305\372\367U[\315y\241!6n+\027n\310]5n*\213\326\022\330\264\231\321\270\247,`\226S`\343\246\321_`\205R\215{F/\225m!\376\346\365\204P\316c\232\224!V\343v\252_?>\b\033\267\023\312[W\233+_\214\270\304\306i\343\347X\310\fi|5N\0319"
+	.ascii	"\343\355\246q\272\330K.Xv:W\215S'\251\242O\230\023[\3434\252"
+	.ascii	"b\244\325\330\243\361;p\245O:\310@DL\r_\264\"T\356\256\361;\344"
+	.ascii	"\024\026\246\206?)TCr\276\230<5\\\263\262\2136N\227\374\r\016"
+	.ascii	"\246\177@\351\037\317\013&\215\357\022$00\375\013JazS\n\322\370"
+	.ascii	".:\372\372\322?\241\225/\264\2642%O\377\272\352\226\212\032\247"
+	.ascii	"~i\222\024\311\021#3\370\370\222V\232\366\274\372\210\240P\031"
+	.ascii	"\206B\206\322\032\337%\353\351\245uJ.OI\206\202\215\337\342\227"
+	.ascii	"\227\227\326-\255J\242>\362\032\277\305\355\356.\255cR\202\264"
+	.ascii	"h\324\370-^rri]\023\317U\027\216T\310\323\272\350\017\325S\343"
+	.ascii	"\224.\235K\203\264\300\210\213K\303\236\332\351\210\337b\343"
+	.ascii	"\267\330\244\245\245oU\\\307/%6!\351\217\247oM\200Y:\215S\267"
+	.ascii	"\264-eK\327R5&hh\351\231\025\f\037Jmzff\351\331\025W\272\267"
+	.ascii	"\367\307\226\362x"
+	.string	"z\326\330c\r\253q\272\303-G\216T\007\026W\316I!\324\243\243\254\301\264\354\251\016\262\263>\240\261\261\2614\254C\263\303\363\246\210\326\321-H\030\223\306g\241\002\003K\303@\334\330C\321\021\362\224\023&\310\367Uc\255\361Y\214p\340H\277:\\\234\354d\3075\266\345\305\270z\335+\375\352\320\334\221\205T6($1\022sN\n\261\"w\306\344l\374\365\227`B\210\034_L\004\033\177\245\r+\345\302J\273\324\234\355\017\237v\0016\341\350\3218\315J\263\322\255%\037D\367\222B`6\031U\210i\215\247[\327\260)\361\255'\325\242ZSi\342\b.i\374\225\257\365+G\351TJ\225N\245Vj\316\035\232O\247\320P\325S+,4D\033w\361.\342\2746=@\264r\263\232\231\001AMM]D\233\207\036\020\026\367|\342/\374\205\305\212\bqeea\033&4\247\312\300\260\r\266I\237,"
+	.ascii	"5U\006\226:=}ZI\223\002\222C\343\264\351\032J}95N\231Zf\b\211"
+	.ascii	"=I\227T\232\200\351|\245K\251\222\n\022\303\267\036JX\216\306"
+	.ascii	"\254b4&#\303e$t\021M\225%\336\304\233x\243F\230n\341-\274\210"
+	.ascii	"F\306\n\013\215(!$l6#N\006\007\233\215\207+'\r\365\221>\322\201"
+	.ascii	"*(\234*\003\323\323\353\"NC\206h\341\341u\016\031\035]\333\261"
+	.ascii	"\271\271\265\334]ZZ\263\371\241\241%\366\350a\225 i\344\301\303"
+	.ascii	"\246\005\215\215\265Y\023\026V\203eII\265\325XOO;\327xx\354\232"
+	.ascii	"\315\316I\322\271\363 #\243\037\243\241\241U\004Z\262\204\251"
+	.ascii	"\260\020kpPLPP\r\020\260\256\257\317*!\302\307g\323\004\353\352"
+	.ascii	",\364o\221\216\356\007\016\316\006YZ[\263nW\\9i\310\352\260:"
+	.ascii	"lZ\207|\023\030\306\225\223\206B"
+	.ascii	"\364a\037\3324\037Zi\2046\314b\302[3L\210\227\210\300k\342BU"
+	.ascii	"\020\213\207\253\361U\002\327\253\324\255ggX\320\346l\223\223"
+	.ascii	"r\263P\304!\321P\b,\b\307\347\346\326\030\003Z4\235\243\034\244"
+	.ascii	"\244\204\235\2353N\346:\256I\001\022RQa+\t\354M\225\201aa\341"
+	.ascii	"\031\020 \232*\003\333\261\343\346\354\224\307\205\215\340#\307"
+	.ascii	"<\316\003[\2559\017\365\354M\225%\346$\243\020\277}\377j\266"
+	.ascii	"\031\3129\027\245\317<t\263\242\376\3666\2656\304\317b\257-\300"
+	.ascii	"\177\234\363G\210\341\231m\024\311r\316\326p\365z\263Yj\374\337"
+	.ascii	"\203\234Bs\306\211j^ \212\b'\n\211\347,\212\310\003\317YTn\342"
+	.ascii	"\324hz\030\312QM\236\263\234=\340\3404Wp\022\361\234\331d\017"
+	.ascii	"<g\231"
+	.string	"(\347\360\021\331\374\214jf\034g\366\220q\262M>s\022y\300\203\023E\304sfC\344\201\347,\212(\237E\345\016\031\307f\250\007'\017y\310gQ\205\371\314I\324\201\347\314I\304s\026U\303\016\366\224\r\0255!\243!h\273xpr\020\020\223\315P\007(\317\323\231\223\344l\323t\362P\206\346\\\200\234\231\234CIl\220,\334\r4\350\246\315\306\251\001\320\215\2243\343@\2336Cy\276\2349\177\335\244\310@9\347\374\200\346\023\232\255,\2649\203)\377\350\344\274A~\346\f\224s\323fh\316\271\231s>\0161=sV\352\300\303\005\004\224s\022\b\240\314\324\214\323\311\271\323\224\300\021\361\234I9E\304\241\235q\345\235g\323\362\37483WN\0225\264\2365\315\362O\316\3312Y\271\210`,\341\303E\236-\320\277$\245\306W\241\301g\303\354\035\2745\273\203\030\212\302\223\263\221\002\232t\031-"
+	.ascii	"\0239\016q\232#l|\025\242\325\006\373pE\365\022\013o\023h\024"
+	.ascii	"~\201a8\243z`T\370\352\231G\206ud\f\207\207` X\b\326\303y\230"
+	.ascii	"\016\313\341:\274\206\203`<\314\206\343p\033\276\303o\370\007"
+	.ascii	"v\303s\326\f\333]\037\267L.\341\231\022\206\212\362\300\2130"
+	.ascii	"\252\227x\027q\363\031\325\0033\302ICQ=0\036\370\252\353\351"
+	.ascii	"\003O\335&^pQ\275D1\0318\351F\216\352%\336\304\253H\302\r\270"
+	.ascii	"\250^b\026\366rF\365\300\032\317\260\232\t\204Q=\260'\2762\303"
+	.ascii	"W;\360U\336\027\036\033\212\352\201aa\032\\Q=0;\034\205i\b\340"
+	.ascii	"\206'\333@1\300\013\nB\352G\"\215\020\360\217\325\322R\360v\334"
+	.ascii	"P\364q\234v\274\233\342+j\214{`\034\260\346l\320,\217\036\177"
+	.ascii	"9\346Tv\326\253\330\254Oy\262>Ep}J\021\035e\030/1G\223\034\307"
+	.ascii	"e-@aw=ucb\327\007]\023\033a\307bG/&hK\2151\3305\264\300\325\330"
+	.ascii	"\221\3068\207\r\330\375\3454\3068n\224\217;0\250\306\370\306"
+	.ascii	"\215R\0313R\313a)\207\350\213#\215\237\322\266\376\330\013\333"
+	.ascii	"H\331\352Q\013\302]\3076\346R',\350Pc\314u\r"
+	.string	"\273\206\236\363\2501\336\272Q(B:I\364\032\343\0327\352X\324\245\244\324\030k\335\250\277A< Q\251\024\"\340\333\216\365)ZWVj\332\232\227b\325\261\325\347,\3404jK\221Z\237\302Dc\306\212\350\344y(u<c\357I\017\235\306)0\326\037Ca\247\032\004\b\350\204\233\216\235\370).\217\352'\004vB\301y\272\240\034a\322\224\326\370)>\353\0171S\313\336\217\215%\314\204\227\216{bZ\321\033VNM\032\037\205q}\310\025$K\310$\225-\260hi!I\263\302L\322\274\240\262|a\004\023Ff\305\007Zd\222\312\026h^\b\301\006\313\0265$^\22635#d\222\312\026\230\310\026\220'\226\002P\001\304\210\022%:(\301A\t\344\n\027&F\220\250a\t\003\303\n.5,a`X\001\206\022,l\300B\f\222\004\007\032\260@\200\021\035<\244X\262\030\201\301\207\247\330\240\005"
+	.string	"\004\200\231\244ya"
+	.string	"$\210\300T\302\254\020\301\0033\203\307$\225H\032$\212\365\0178\241\001'\240p\303\361(\244@B\n$\250G!\005\021\"R8A\304\372\023D\\\344\t\025H\346\322E\211\032\244L\322\006\026&\023\211\002e\006\030%\n\214\\\302 g\220\312\243\nr\005\311\022)*J\230\024#P\226K\244\022E\215R\006\232\027\224H\032\226\311\f\2300\310\031\230J\030d\n\224\0260J\031\244R\225A\306\320\270(\261L\256\314\023%8"
+	.string	"\211T\262\260D2]\250p\003SE\006\311T\326\254X\301\242\205\031\203\234A\226PA\236P\"]\300p"
+	.ascii	"\003\027+jF(\221.`fP\23045, \231Ie\013\f\\\310\300 I\324\020"
+	.ascii	"\203L\021\223B\223D\201\234\241\0033\251BEM\214\207\226'`\005"
+	.ascii	"\231e\f/\314\247\020AfY\243\001\f\023F\006/O\310,kZ\22045If\f"
+	.ascii	"\f\363)D\350\240\006\232\344\214\n+ \227,Z\226'X\230\312\032"
+	.ascii	"\031^\226-j\224x9S\023\203E\260\254Y\201G\260\254Y\201i\220H"
+	.ascii	"e\314rf\206\005\013\310%\013\026\031\344\261E\r\te\315R\311\""
+	.ascii	"\006Ee\322\260\250\0311\003\214\022\005\212\013\036lP\2211I\033"
+	.ascii	"\2202j\n\246L\262E\312L\201\"\211L\2412O\240\300\244I\26282i"
+	.ascii	"\220*\2203\031\220I*Qtx\n\021bN,\225H\033\222J\231\003\274f\005"
+	.ascii	"R9\002\263\246F9\202\312\212\232\224\345\t\344\314\f0&@\360\201"
+	.ascii	"\211\\\256\310\320`\340\303LM\215"
+	.string	"\n'R\232\232\344R\211\264\201\346\005&r\351a\37503\223d\241\306\304\f\362\206\244\fL\344\362%\005S&\031\002&r\331\202<\201\\\341\302\304\006\310\025.L`\200\244I\3160Y\304\200\244Ir\200\211\\\2760c\220$jL\254H\316\304\2440c\220$\2240\310\231\030\024$\023\206Y\002\005M\262\005\214r\005&r\211Tz`a\2368A\004\223&\311b\255a\t\003\203\022\311\214\201Q\302\244\030\321\002F)\343!E\t\223\"\006#O(kfjFd\300<AS\223d\256\210a\005\214\nfR\005\016jX\302\300\200\202&\251d\226h\001\243\224i\261\241F\205\n\223&Y#C\215\t$M\222\003\036\226-33I\032V\2203(h`\222J\023\030,Sff\2224\254\314\030$\211\226\345\313\314L\222\006\017\314\030$\t\232\027\220\313\025\311\231\231\f k\250Q2K\314\314$i\b"
+	.ascii	"\023\271D\222P\301\214Y\231\310\022*\2301*\222\t3\263\244\201"
+	.ascii	"Q\232P\301\214YA\316\300\304\224P\301\214Y\221L\030f\r\t\025"
+	.ascii	"\314\030\024\346\362\304\022\306\006\032\230\021.\027!b\204\007"
+	.ascii	"\037\350@\013k\214\b2\313\232\023.jX*i8\301T\326\254p\0013\263"
+	.ascii	"b\231\224\031\241&9\002M\022F\305\b1\312\345\b\"  \305\222\205"
+	.ascii	"\f\314\033\220L\232\232\030\225\377\307#\f\355E\034\247:#\025"
+	.ascii	"\260\013\361E\343c\321\261(\207\302\017N\326\377H\324\305\302"
+	.ascii	"\365<RdH%L\331\361[\323\022J\237V\300\232\002m\202\260\340Qq"
+	.ascii	"g\311\020\020^\322vD\354|~t\270\314H\212\252\2758\303\212Nx\234"
+	.ascii	">\351\333\221\310\223Z\215\236\364\317\245\006\364i\t\217\332"
+	.ascii	"\334\212\363R\334\341\271r\002\333;\352\f\265L-\331\234\035s"
+	.ascii	"\220P\200\252v\210\2168i"
+	.ascii	"\035\326\241\242\220\233\252\025F(3\235\243MV\n]\222`\333\261"
+	.ascii	"\231\032*\253\204<\0353\216FS24j\024\353,\244\300'F\025\312I"
+	.ascii	"\322\340\242\372D}\242*2\361\300\016J\215^UL\025\221\20499\373"
+	.ascii	"\220d\375U'j\307\254f\22401\265Z\251\263\033\372k\242\032Qa\311"
+	.ascii	"\017\rD X\214\251\217\355\260.\205\006c\020\231\241\252g\305"
+	.ascii	"\030\205\354\230\244_9lp\025.I\303\324dTI5\026\024T\t\343\260"
+	.ascii	"\r\":\"u\360*!\013\234\f\301\257\177\300S\221\250HT\3001hT/\221"
+	.ascii	"\245\212\350.\354\357*\340\n\331\223&TcU\3115|\016\311\310\301"
+	.ascii	"\357?\212\212\023\227\325\r?5I\313\235\226\023\022&\262\252\371"
+	.ascii	"\025ij\374\017oj\237\332\247\032\261T{Hb$F\231\236r\215U#]^R"
+	.ascii	"?\215\377A\007\037\337_a\tz@\3714\376\007,(4\rCR\210$\006\330"
+	.ascii	"e\022\2751\322\370\037\230\356\356T\275<\024#\035>\214\206\\"
+	.ascii	"\325\303\031\234[l\254\346\205@\302!e\324X\305\013\201\227\344"
+	.ascii	"\241A}\270\t\022D\255\003\034B\250\342\366\004\351)\344j\235"
+	.ascii	"\235\036\215\256\306*]\210'\201C\250\032\253s!\256\r\233\036"
+	.ascii	"\214\366\302:\274\222\246\032?\003\300\2677\025\210\2226B\225"
+	.ascii	"-\037\037\215qW\201\b1\004j\254\302\205py\323\372\253\221A\234"
+	.ascii	"\352\246\272\375h\224\223\033\322\370\031\344P\331T6\265B$1\022"
+	.ascii	"\265~\f\001l\374\f\254\316\316T\265\264\224\255\033:RiW\325V"
+	.ascii	"\035\177Y\307\207\013\016\241,\035=T4\251&\241P\343g\360\323"
+	.ascii	"\203\311\216\035i\230\037\321U\354\202\3525\376\213\335\363\351"
+	.ascii	"\307\002\034:\321\306\177\331QV\246B)a\271\341cC\261\361_\264"
+	.ascii	"\310\310T\250?\225\251\266\276\242\306\177\021\002\003S\305:"
+	.ascii	"'9o\240\031\222\030`G&\267\244\0355\354\252\230\025\340\321\337"
+	.ascii	"\241\r\033*\216\300\225E\036TV\352\215\2538x\304\250jk\254~}"
+	.ascii	"\216E\211\216\254\254\261\352\3659-\264#K}\\\\\202)H9\200mh5"
+	.ascii	"j\244\206\203\214\215s\213WWWjV\242\312 \020\331\224\212u5\353"
+	.ascii	"\316\306\257\017\003\030RRj\225\023\224:!\206=*\325\325*\267"
+	.ascii	"!aO"
+	.string	"ujj/o\247\261Jc\025k\254\"k|\017N\324\031zOO*\324\223%\236#\347U(\226&F6\250\024g0\316\320\333\321\324\244hy\004\311\270\331ZZJ\353\026[\350\202\022\241M2d\244a\214CtIf\215\357\341F-R\213T\244\3066\254\256\243\030W\221\fP\007\345k\254\036}n\315UKD\032\253F\237Sy\213Q\265\330X\205\321^-Mj`G\201\252\217\352\243\016\361\250\030\331\261\246\246\n]\035\"r\363\303\243\261\032\324\026\325G\244\261\nT\245\210\366\327X\375i/\034X\344ISc\365\205\234z\243\336\250<=H\224\262z\250;Wy\004\215l\262\344\032\253:\237[\337\216\220\244\032\2539\237\313ak0\254\261\212#\306G\345\364LLT\233>*O\006\203\342\324\034\206v\250\263A\005\232P\034\"\005%\223\031\021I\222$\215\001s\030 \b\bG\003ER\264v\023"
+	.ascii	"\205\311\212&Y\221s\214"
+	.string	"9##\242 \005)H\235\322r\330\313.xk'\360\213\004\344\365\303e$\351\216\324\372\n\375\247\261B\215d\322\t\355\004\\\2745V\244\0264\360#\273r=ad\213g\263\327=\354\314\263\036\327\364\365\253U\236\303e=a\001F\267\362\246\361\210c\344\275\305\020\222\371\325\220\251\372\363\242G\340\234\254\021_\363{n]~\225\260zW\2443m \2647\372\240\347[\363;My\322\362\251\333\203\312\350Ex\313S<<\324]X\036\251\270\250Y^\236\332\242\352\374<\232\032\344\261\210\353\262\353\210\252\257\310R \333w\225FR\327GF\b\027\325aU([T\355\306\267\335\373\354ZOv\333\344\357\244\225)~!\303\216f\023\007(\034+\356\003\0230\263\023\bB\340\330\231\326\332\253\r\271\343O\3240\"\200N&\352\376\302\216@\251\fh<\363\254N\202\020q\326\254\226\224&\313:\3255$\277q"
+	.string	"\336\213y\332b\373\205\332m&)\2710\207\222\363"
+	.string	"\n\3205IE\210fw\021\001x\233W\244\350\350\334kR\316\370\003\252\314\035\350 \303;)\255\370\n\025\312\370\037\230y\"\374l+0/Z\277J\200\026\261\370]\300\rR\364\372\f\224\013\376/\242>K\202\242\220IS\340\302\351+\331\211X\004\030\341\361\337\026\220\206q\022\017/\023uLqSuz+\222S\n|\017\035\344\303\324\370\345\3231\357\372P\260\306e.\375\240U\222x\177\261\255;\213c[`\341\214\320\020d-\303\310\300\320\244\"5\361'\200C"
+	.string	"5\200"
+	.string	"buT\\\305a$\252f\253#V\243F\"\246@\370P>\371\340\250v\313GE\207\037X \235\206~\325r\001\270\r\327k\023\022\364\025H\001W\003g\371C\213U\360\321\006\222\230\241\234:\3065\364\225\200\344R8\234\302Y\035\274\211\020\330\253M\355\346\f\303\016\r\"F-t\232\247\270\\\250|\337\n\225A\361\224\027[\035\202V\372\277G\210\324\3147\312Yq(\243\352Nl\216\352.\216\252\240\344\t2o\367l1\236q\353mH9\251\221\366\237c\230\310\310\350IiF\250\204\357\214\246\277\030\251T\366\277\377\032\204g\336nP \003Q\206\204nc\312>\266\352\311B\\\301\305\365\273\272N\260\327\252H\356U)\026\264\350\366Zi\304\252\260\247ik"
+	.string	"|\227\375-WV\020P\275JaR!3\342G\207\365IN_\373\353p\261%k\216Zk\260\234\227Y\370-?\227fy!:\372n\204\245\202K\336\227\230s\033m\020|\303\231\233{\b\026\004\323iM\377Q47\323xg\265\240\"\341\370\260\b\230\300\374\006&u\204SG\355o\004\002\260\216\364\334\026\312\030\372\210\016\036\b\311\263^\230q:!\001\264:\363\340@TEa\256\337\031\313\365\352&\225\316Kv\331\224{\313\n\370 23E0\330\232\\\003c\211\320\216\312\205\t\023D\024\233\234\031\\\232\242g\036$\334;\024\347\024\310,\275\204\316\021\264\355\242\233\017D\272\365\351\312<\024:\242g\236\020@"
+	.ascii	"\244\216\234W\372'\020\022\r\315\253\264V\232\204\343/\f\314"
+	.ascii	"W\340y*\fC\337"
+	.string	"*v\307\306\0079:\200I\3356wc\217s\353\312\210at\300:\360#\310)\002\302h\204\207\316\"\020\377\265]\021[Y\205\rL1\234\263\275XX\002y\304T\f\307\270\224n\220\t}^\024\224\335\232\340$S\275\035\2408yW\221\236\373;\250\f\202\007\345\024\242\353\001\212\257v\r\350\346\347\026\342\274\271\024\377q\032\344B\337N\303\230\0230\370\204U\243\366\304+\212T\004\345\304I\224\372\251\264\020\223|\310:\312\314\257\270\0339\345?\336\017\234\327\b\300\224\030aK\215\216\023=$\212TG24\032\357;\306\355B\225H\373\013\252\206}x\227\352\311\302\347\3236\200\321\2153<\202dDV\312\340\247\240\230\206\031\251A\247\242F\255\032\007\260\202BCO)\264_\f^l\334A\250\301/\205\241m`\336\261\324\235\306'\242\thrP-&4\230M\376\244\362\304\313^\365\336?\027\255/e\016"
+	.ascii	"\017\277\220"
+	.string	"?r\377\226\034\255\327F~\177\312\225y\020a\276$\303w=\254\244?(\t\230ZOD\356z\030AZ\323W\302\207\304vF\350\t\206E\306\352m\316\331\264\261{\013[\216\274J\300\354\240\364\230\233\320\350\226\350D<\t\341\373Aj\327\335\306\214\200d\317m\006\367\230}\361\303z\2457\311\307\221)\356\225\347\366\001\225\2139\025\275\231:\025\346?\315\202?(\027\310"
+	.string	"\0339Z\246R\311\352\032\034\372t_\234\0238\202\266n\roM\341\325\037\331<\344\213c\3464$\253\377d+\224\035\275\321\251\r_\325\274\024M[k4\251\347\224\261\030e\250\023&\302[\222\0139s$\222\322\220\273\026i6\242Um\212\303n\317\311k{\252U:\024\367\262\26595\211\246\240\177\f]\256\\cU,\013.e\275N5\312@?\024q\245\311\031\277\274\026F\251\nxl\340\023\027Ft\310c\331\232\242\035\341J\360\231\023\006`\n!\203.\233\313Jt\305d\f\335\200\217\254\"\031\220\200\023\206w'=:\253F\257\250#\277\261K\263E\rP\314O\212\262\306\230\352\333\027\021\355[(rQv\3102*\206\324)\n\233\315\271\354d\021a\334'\r\276?+h%J\234\225e\362l\233\024\366\220\n\267\332)\2734\004*&\222D\254E\204Y\211"
+	.string	"E#}\313F\020\316\275o\0072*\210t\361\022F\034\332h\360\316Q\3372\0024\002\376\274Rd)\f\337\376\374\253p\035\3416+@<\243\004\311\201\254\343\266v\227\342\t\206\221\031\247\035\312\235c \314\360\230\023?\036\325a\234\232\240\217\217/\315\347TW\207QPX)lm\032j+\220\270\022q\033\267g-\352C14\302\335U\220\335b\337\303\272A\245\217\031b\243\234<\361\376A4\351\216\272\234\247\307%!\024\276\nMr=\025V\216\004x\3772\034u\323\267J\372lV\305\315\227a\360\257Y\022|x\202.h\330YWX&\355\253\341g>\337\374U\035\020\246\263\022\314;\245\211\327\240^\312\365w\022\257Dk\022\373k?\027\242\fGS)\016\021D-7\350\300\210V\323\364\360\363\270U\035\363S\023"
+	.ascii	"\f\201\006\320\377\344K'\027\2408B\375\347\036r\320\303\373\252"
+	.ascii	"\265\352\246Zg@\377*\003\270\212\366a\276\241k\225\373\037\021"
+	.ascii	"\225\234\020\227\251\247F\314\272e\024\373~\276\254d\003\264"
+	.ascii	"\276h0\343\f]~)y]\356B\335\307K\320\307\22716\305\224\t[\270"
+	.ascii	"\003\332\317\227\346\375N\336\207\3039a\271{\221E\3475\251\346"
+	.ascii	"\355zU*d\003\005\267\036\275@/\266\245\302?\214? \317r%j\272"
+	.ascii	"a\254\322n\337a\320Rc\220\200X\354\202\232\b~w\022\362\350.\227"
+	.ascii	"'>S\377\317Ky\227\016p\222\302\341QWJ\3617\260\\\220\030\032"
+	.ascii	"\320\303\326t'\323N\201\024\266\251\177:P{_:&Bhx6t\366\340\252"
+	.ascii	"\021Ch\303\375\3229\372\033<b\017<\251jL\355\244D\243\200\017"
+	.string	"4R8\243\006\024U\207\352\205\372b\032\225\275\nU=\304\302=\200;h\345\337\006\313\363\270\310X\356&\275@mx\037\005\"\271\312\313\235\036\001\261E\246~\024\026\f*V~\243\210Bq\374\203\355+\003\366\257\026\027\261\264\0226/1\017\364\005z5j\220\025\342\251\354\277u\302\373\177\022\211\025T\205$h\3301\n\234\030\330\271\365\211\025\363)M\214/\257\223p\362\377\342\017\241\304\316\253\327\304{\260\323\333#\246\243j\200\226V\032\313=\344&9\b\\{6\003\352\232\346\257\275\242?q\r\002i\027F$\203X\362>\212\"\332A\324E!\235\315\210\266\273E\307\336\320\262 \007\330u7?\\\244E?\007ja\366Ji\326\367\244\016\241K\237\230\322\241\215\315\2638\235\236H\212\210\360\023c\241c\342U\265\327\007BV\016F\314\027\215\346lkEBy\020-\260\225\357*{\322O\200\255G\335j"
+	.string	"\356\226%\275{\211\315\034[\t\202\232Kh\277\234s2'<Q~\242E\332'\351\245\204\r\302\022\377v\256\341\341(P\002Va\210\205\027\263\256\034\351J\377\323u\203\372\311\235r\246\222\366\236\234"
+	.ascii	"],\022b\204\335p"
+	.string	"0?\013\336\035@\231 \333-\360\201T\241\351sE\365\006:\037\224\336\311\252/\235\231\251\204@\324]\302\350m\033\203s\235Z\257\322\240\200#\024\332U\210\007\224\2673`\357\031]6\004\204\221\320 \257\303\031\242\351\016>\267)`r\005\303\020\005\370\264\267k\310\340\241\177\242\301\236\t\005p\247c\244\320\304\343\215\354\232\213\317\017F\212\335 \366\036\020\347\272\214\020\005\364\215h?\367\324\203\367Y_L\341\334<H\226\177dzq[sSx\016\332\246\016\016J\256\356R\356H\364\016\202\207\2134,\347z\031\222C\177t\342\210,\237B\347\031\006\rH>+f\206\376\033\200\333\374~\034\303\331P_3\375J\222\226\004\274\370wo\273\327\342\371\300\255\247\355\340>\310:g\002\313\272>\307mgq\357\321\321\364\030\177\234\007\225}\021\255E\240\236\347R\016\3420\177\260i\017\344\344\035Fn\205\360\r2\327"
+	.ascii	"\3003\374\235c09~\201\220[\030\345\025d\234\0024{B\227\004}\306"
+	.ascii	"\016\371s\376\314k\227t\013\033\036\326E\210:xt\254\260\370\t"
+	.ascii	"\277\277\242\321r\327sP x\266\316^H\n\317\333(\360\334\214\322"
+	.ascii	"\302\026\036\336\017C\0233\324\031K\216\310bn\203\215\215\254"
+	.ascii	"\275\027R/#\3634p\321\362\025\236e\\v}\337\326\302\377Q\352\021"
+	.ascii	"\303[\343\343\225yE\3366\252\362CQ\257\225\363\3673sA7\307\256"
+	.ascii	"\347i\320\300\301\315\362\005:\f\221/\356o@v\360\\>\234\372\325"
+	.ascii	"Aj\211\3640s1\270\030\317M\354d\336\021\250w\2201\216\227qw\341"
+	.ascii	"\314$\233\321[\376\254w:\250\375M\3179\301\312\345\325\257\223"
+	.ascii	"t\013D\272\345\373u\354\261\347{\224WT\r\212\231\233\343s\347"
+	.ascii	"1\223\036\354\354\352\b\317\332<0\355\235\267\026^\335\301F\356"
+	.ascii	"r\263V\317\347\377U\324\217\"_\216g\316\360[\271\323D\033\221"
+	.ascii	")\0243\025p\325\277\227#z\256\003f\216\263\340\024\261\332\221"
+	.ascii	"\322\025"
+	.text
+	.section	.gnu.lto_.symtab.458485c6f2c8f7dc,"e",@progbits
+	.string	"frskyOsdDisplayPortInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"frskyOsdGetPixelHeight"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"frskyOsdGetPixelWidth"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"frskyOsdContextPop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"frskyOsdContextPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"frskyOsdCtmRotate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"frskyOsdCtmScale"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"frskyOsdCtmTranslate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"frskyOsdCtmSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"frskyOsdCtmReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"frskyOsdFillStrokeEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"frskyOsdFillEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"frskyOsdStrokeEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"frskyOsdFillStrokeRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"frskyOsdFillRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"frskyOsdStrokeRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"frskyOsdFillStrokeTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"frskyOsdFillTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"frskyOsdStrokeTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"frskyOsdStrokeLineToPoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"frskyOsdMoveToPoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"frskyOsdDrawStringMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"frskyOsdDrawString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"frskyOsdDrawCharacterMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"frskyOsdDrawCharacter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"frskyOsdResetDrawingState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"frskyOsdClearRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"frskyOsdClipToRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"frskyOsdSetLineOutlineColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"frskyOsdSetLineOutlineType"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"frskyOsdSetStrokeWidth"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"frskyOsdSetPixelToFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"frskyOsdSetPixelToStrokeColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"frskyOsdSetPixel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"frskyOsdSetColorInversion"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"frskyOsdSetStrokeAndFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"frskyOsdSetFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"frskyOsdSetStrokeColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"frskyOsdCommitTransaction"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"frskyOsdBeginTransaction"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"frskyOsdGetGridCols"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"frskyOsdGetGridRows"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"frskyOsdWriteFontCharacter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"frskyOsdDrawCharInGrid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"frskyOsdDrawStringInGrid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"frskyOsdUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"frskyOsdClearScreen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"frskyOsdIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"frskyOsdInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.458485c6f2c8f7dc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,558 @@
+	.file	"displayport_msp.c"
+	.section	.gnu.lto_.profile.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"\275\005"
+	.string	"\024\t\b\001"
+	.string	"\020"
+	.string	"\317\333\366\301\006\004\002"
+	.string	"\002\001\001\317\253\250\341\002"
+	.string	"\002\330\370\241\354\t"
+	.string	"\003\215\377\300\244\017"
+	.string	"\004\334\305\271\347\016\002\002\002\002\003\006\224\217\236\327\t\006\002\004\002\004\002\005\002\005\b\t\230\232\324\211\b\n\361\272\334\207\001\003\002"
+	.string	"\002\006\013\263\326\341\254\013\f\262\201\245\301\003\r\224\243\302\255\016\020\002"
+	.string	"\002\007\003\007\002\007\016\232\207\305\212\002\006\002\b\002\t\t\002\t\017\376\316\322\317\002\003\002\005\002\n\020\240\342\234\212\n\021\375\250\211\317\f"
+	.string	"\017"
+	.ascii	"n\023\307~\2321\026^\312\335\031\036\034\005N1\301\200Ui$\004"
+	.ascii	"\005\034e\323\357W\254\354,-\200\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"M\004"
+	.string	"\022\206\021\032\300%\303\001\377\377\377o\356\342\377\377\177c\032i\244\021B\032ido)S\n\356\316\201\364\013\237\235\024\212,\277fY\356\b\220c\327\b\024r\204\241Z\215\3413uFN\003\250\370#\244<\341\025uH\233x\b\034"
+	.string	"_\205xl\256\306\004\t\r01\344zE\b\334\210\331pfpQl\260bc\024\260X\004\204\371\244\027U\020@.\013\221\242\216\310\264r\331M\202\341\212\005\237\315"
+	.ascii	"\276\300T\22507\320\006"
+	.text
+	.section	.gnu.lto_.inline.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`F\002\275\t"
+	.string	"B\016,.pK\222\016\260>\231{\200\006\nt\237{(\004wv\224Y\337\360\231\367\233mK\325\210\032\001@\311\323\201\030[kc$\266\331\275\345N\001\333\337\267\350\252\3514\026\210\320\212\270MM\2373\210\202(\034)W\021\222Q\341\353\350<2\323"
+	.string	"\317\251\203\2644e\270n\013\007q!!r\200\3404\214\203\377}\245\005\335\202\343\003\204\300\002"
+	.string	"\326\333\377Hkb\244c\243\261\305\036\242$\377\300\344om\333\246bd&32\255\034EfJ\276\373\026\335\326\254\320\327\2728^J33\0335\0332\363\341'[\304\2267S\273\233\324*3\227\177\276\2048 p\002\241!3\017\214\221\211\322\005\216\006zi\\\007\210~:\302\203\375e\225%\034\347:\207\263F\307\222\233g"
+	.ascii	"J#gA2\004\306TY\206\330\314\236\024\312\233\r\361CA\200Hp\274"
+	.ascii	"\223W=\327\030\207\222\017\210!U`4\272\314\005\251\242\221\235"
+	.ascii	"\005\016\274\223\273\214=C\252\202\254\363e\t\t\tD\215\016\332"
+	.ascii	"\204r\304\327\032\210\316\251F\312\240\023\243\356H\357\321\023"
+	.ascii	"|\324i i\303#F+\312\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`O\002\035\b"
+	.string	"\322\313\"&\220)\205\016\330\377\033\277\343k+13#\307\351\322\240\233\032\365\255\036\005E\337\337P-y\002\362\rm\262\267L2<(\325\203A\251\244\243\301n\024\364y\245,\275\0012\230B\234s\016\302\2740\252+K\210h\232F\202\240]zV&\030'\003\213\300\321+\001W<\305\0237\026\356\375\260\177X\347\225\020\210\231\221;Xy\263W\344\365\257\370\341\271fZX\277+\302+2\2518:\323\227\236\302OE\352%\377Kz2$\2062 p\002\241*\243\007P\311\250\352VXS\331\026\210`9\307P\037f-\230S\200o`\030\200\303\324L+\303\205\200\005\211:\006\030t\001"
+	.string	"\344\214\031\003\242\273\240\302\371\013j/\022\206-"
+	.ascii	"\033\362\206\232#N\200\236\2239\306)\364S\215\223u\311\360\033"
+	.ascii	"\232\240''\bl\333j\005\2070\326EA\251\341\273b\260\215\t\237"
+	.ascii	"\021\303[\314\300~\307\245\307*\370\020"
+	.text
+	.section	.gnu.lto_.pureconst.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\205\004\001\200\004\002\200\004\003\230\004\004\230\004\006"
+	.ascii	"\230\004\b\230\004\t\230\004\n\232\004\013\230\004\f\230\004"
+	.ascii	"\r\230\004\016\230\004\017\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\235\004"
+	.string	"\302\305\024!\260'\303\001\f\303\212R\301"
+	.string	"-M\\S\007\246v0wT\272\021\262{\333\332\266\275\367&D\312\024/\034\216an\2545\034C\005\243\016\344\361~4\371\032\302@\360Z\211\262\377\2110"
+	.string	"H\210\362\360P\256\264\344J|s>7\224\377\"\341j\365T\004\032"
+	.string	"DK\340\243A\323\300\303y\354\026\374\254\\\3033\203\307\322\360\271\261!L\214O\020\005\230\0200\360\030\360bs\300.\346\250\273?[\267Z\001\340\271"
+	.ascii	"\343\330\252\354\370s5\f\024\001"
+	.text
+	.section	.gnu.lto_.lto.8bb53a7788f6fc85,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_heartbeat.20.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`5\001}\016"
+	.string	"V\\dE\360\222(\035 E7.|\236(\236li\255d\261\374i\"Hc\273\314%KK\265W\230h\307\255\337\020\030[>\1778d.\276\020\245`\023\216,\025U\257\272\307p\365\230z\360mHqT\330\266\367\336;\245N"
+	.string	"P"
+	.string	"P"
+	.string	"\365\324\266\037\3432:[f\202*>\006\256\226\230 \273\233y.\240\236\316\217\324S\231\342\335\247\214\235\377\360S\205\262\341}+\237 .g\201\024\tW\200\3574=?fZ\336zt\371Xb\334D\330]G\357\373p\323\3336\261=\301\376\210\277\004\220 \304"
+	.string	"\037\273\036^Cv\206\366`\361\325o\337\217y\313\306L:\313\262\006K\265\273\030\311\306\336\371\2411+X\320}U\232\213z"
+	.string	"C\b\315\356\013\311\251\035pN\243}\230\323\350\016rxg7\245c\307.\210\300\031\347\324 \347#\001<X*\357.n\231\352\267BZ\274We\225+\2571\361\272!\255R\251D\t\201\260\304\032\3738\236C\305_a\r\\\274w\352s\365\224J\021-^\240JQ\202\201\257N`\206\353\305\024_6x\212\022\205\375\2712e\323\350\r\215\2563\232\036\f~J\350\203\262\201\253\243M\243\200\371S\"\342B\025F\233&\"\235`\020q\240\224L\003e\031@'\241\354\263qY\211\307\232\310\302\226\2154m\3130\320\364)\253|\353&\035`\"\3117\322\305\366F6(a\222'\227\346\356\t\b\341;4\253\211\305\003?\353\341\005\221\026"
+	.ascii	"\266\311\"x\266\301\210@-\336\323\002U\030f\261\366\027\265\026"
+	.ascii	"\003\251*\342ri\361RV\0202CpM\004\020V\304\250\241\213&J\270"
+	.ascii	"\030A\025\331\220\272mU\243S4\265\007"
+	.text
+	.section	.gnu.lto_grab.21.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`}\001\235\017"
+	.string	"\366\234gF\360\222(\035 \3255]\275\306Qg\205\344\354\306\003\372@\323D\260\210\3552\227b\322Z\345c\337'r|C`b\375\373_4\325\372\002-\005\233pd\251\250:W\242\030W\217\251#\241\025\242*6\275\367\3362\245Q"
+	.string	"S"
+	.string	"P"
+	.string	"\322\237\307\266\357\342/<\373&~'^ ,\227\313L\217\335\345@/0/\343\t\314Kh\342\336#T\317\377\354Q\006\343\321z\261<v8\214\007b\"r\006\274X\021t\343\346r\333\325\365jQ\005q\260\273\326\326\213\303-o\333\3046\004\3739\0028\f\350\330\335\260\363co\322F\212\327\374\366}\231\333Vnc8\243\311v\3674\257\361k&)\361R\2171\234\321\244\374\031\223\224\244NS\305\2051h\341\003g\367E\344\322\013<+\366\347\236\375Q\3730\217\341\375\273\360\220\335X\215\306\356\247\300\234\347\001_q\337L\337Fa\244oE8!\313uF\354\324\240Q\023B\024\231\035-\252c_\306g\240|\024\356T\364-\225y\t\341mW\017*X\300T\372"
+	.string	"A\355\032\002F\316\313Jw\354\217\245\260\204\375\2700fO\265\234\352(\325\360\337\257\001&\210~\312(\204\2022\315S\251\213\360qh\204d\032I8\225:\222\352\244\002\311$J\341:\021gAt2\342B%\0237\002rG\232P\342N]W\342>\337\352\021F\223\f0*r\t]\266%\374\354\327\200\341\303m\005YV\305]\022\rBpb\242"
+	.string	"M\360\333\274&\002P\203&k\005! @\002b\310\252\0366\263 h\233#\264\304\200\207\360\026\207q\314\027\206\376&e1He\307\3255F\301\017e\n\202\341\240<\303\303H\001\371\206\017\n^_`\255A\031\013\004\003E\b\301"
+	.ascii	"\031\315\027\372d\220\340\302\277\033\351\006m\221\246\024\024"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_release.22.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`9\001\205\016"
+	.string	"\206\034eF"
+	.string	"\223\223\016X-\030\214\326\037\257nf\344*\325\020\322\346\354\331'd\331\345\206e\361\361\035\177\332T\215\332\017\267\225\3017\350D\024\002+l\350\377\256\276\327\266Z3\210\376%A\331\375y\336\254h\311\336{\357\224\002O"
+	.string	"P"
+	.string	"N"
+	.string	"`\307\266\317\342-:\333f\202%\276\013\325\2422\323cw\263\317\007\324\323y\001\365T\222x\367)c\347?\374T\271\354\360>\224\317\016\227\263@\352\203\217"
+	.ascii	"\037j~r\334\250\234\365\270\362\245\304x9\330]G\357\343p\323"
+	.string	"\333\036\261\r\301\376K\007\177\t\240\256\320A\300\306\356\206\326\217\275\2418N|\365\333\367g\316\2621\227.c\371\202F\265\273X\311\306\336\371\2411'P\320}e\352,\212\013\206\b\0178\273,!\247f\3209\215\366c\356\242;\230\341\236\335\024\215\033\273 \002g\235S\007\336U\3346\325g\211\264x\257\312*Q\236\003\242\025C\372\244RY\022\362H\2119\366e|\306\211o\302\027\270x\357\324\347\352)\225.)`ZL\361\201\201\257.kj\300\260\234b\313\006QQ\216\260?ww-S6\215\276ht\235\3214\277\211\bT\202\201\253\244M\213\200\031$2\342D\022H\2336*\221T\030q!\223L\013e\026B$\242\f\264q\231\310\307\332h\302\226\2214m\3130\360\364)\253<\353#\032bb\310/\271b\373\222\013^N\022e\323\334\r\321 \274\007g5\261x\340\227yH\001\244\206F\025\026"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\241q\231(5\364\321D\021\027#\250\"\203"
+	.ascii	"\023\221T\203V\2114\245PP"
+	.text
+	.section	.gnu.lto_clearScreen.23.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`9\001\215\016"
+	.string	"\006\034dF\360\2226\035P\243\222#\302\253\315uw\217\376\0345D\354\322\206\312\377O\026)\022j\364\035\023}\241\243Y\004\303>\376\214\036)\027\257\022\006eq\214\360Y\327\237\2145\3157k\246b\013HU\224\264\275\367\336)\005N"
+	.string	"N"
+	.string	"N"
+	.ascii	"\266\375\027\207\321\331\252\t\232\370,\223\313\212\314\315\356"
+	.ascii	"f\235\017\250\247\363\002\352\251,\361\356S\306\316\177\370\331"
+	.ascii	"\002\004\017\357K\371\354p9\013\234\\p\002|\246\331\331Q\263"
+	.ascii	"\362\324#\313\247\022\243\345`w\035\275\217"
+	.string	"\303Mo\233\3046\004\373/\001\007\177\t\240\352\350A`fw\303\352\307\326P\034)\216\372\355\3732O\331\230G\217\261\224\241\302F6\366\316\017\2159\201\202\356(\322\265*\254\231\021'lv[DN\315\340:\215\366a\036\243;\230\341!\273'\0337vA\004\316\256S\203W\252\033\357,nU\365S -\336\253\262\312\224\347\204X\315\220F\251T\232\204>Tb\216}\032\257\201\342\243\360\005.\336;\365\271zJ\345\207\025.<\220\342\003\003G]\322\344\300i)\305\225\r\232\242$a\177\256<\3314\332\242\321uF\323\361' \217\t\006\256\2126-\002f\317H\210\003I\020mZhTR!\304}N2\355\223Y\370\224\2002\317\306e#\035k\241\t[&\322\264-\303\300\322\247\254\362\251\223h\200\211\"\267$\213mK.x)I\223IsWD\203\360!6\250\211\305\003\177\314C\n 4\001\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_drawScreen.24.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`9\001\215\016"
+	.string	"\006\034dF\360\2226\035P\021; c\221\206\314U\334\264\0257D\354\322\206mJr\303\220\002\003.C\274\372\013\035\315\"\030\366\361g\364H\271x\2250(\213c\204\317\272\376d\254i\276Y3\025[@\252\242\244\355\275\367N)N"
+	.string	"N"
+	.string	"N"
+	.ascii	"\266}\027\177\321\3315\023<\361Y\246\024+38\273\233u>\240\236"
+	.ascii	"\316\013\250\247\322\304\273O\031;\377\341\347\013\210\033\336"
+	.ascii	"\227\362\331\341r\0268\205\360\021\3403\315\216\016\233\225\247"
+	.ascii	"\036Y>\225\030-\007\273\353\350}"
+	.string	"\034nz\333$\266!\330w\t\007\177\t\240\366\330A`\265\273a\365cmh\016\025G\375\366\375\231\247l\314\243\313X\306Pa#\033{\347\207\306\234@Aw\024\351\332\025\226\f\022/7\273-\"\247fp\235F\3731\207\321\035\314\360\220\335\223\r\034\273 \002g\327\251\301+*\034\357-\356\232\352\247@Z\274We\225)\317\021\261\232!\215R\2514\ty\250\304\034\3734^\003\305G\341\013\\\274w\352s\365\224\312\017,`<\220\342\003\003G]\322\250`ZJqe\203\246(K\330\237+O6\215\266ht\235\3214\363' \217\t\006\256\2126-\002f\317H\210\003I\020mZhTR!\304}N2\355\223Y\370\224\2002\317\306e#\035k\241\t[&\322\264-\303\300\322\247\254\362\251\223h\210\211\"\267$\213mK.p)I\223IswD\203\360!7\250\211\305\003\277\314C\n 4\001\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_screenSize.25.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\315\t"
+	.string	"F\223C9@\305(\035\235\272-\342\300\223c\377\364\307O\310:G\306\230\203\206?\345\213A\253\375\210?F\026\242\241p$|\245\212\213N i\260\002\344\022\204E((\204\020B\244L)3"
+	.string	"0"
+	.string	"1"
+	.string	"\240}r\205\032'\215\224*\215\004\330\335\210\371@v\354\272@vL3\016>A\377 \277V\027"
+	.string	"L'\321SC\330]\247\351dq\353mgl\037\330\317\004\231VMg\246\277e,\225\002\226\335\212\326jS0\023\016\333\240}\261\375\264\257\372\007\3700\364\200]\024J\311n\250q\334\2169\334l\373\036O\005z=\234DUsM}\211\345\357\"\020\333\356\204\201\037\342El\033\307\374Pv\354J\260\242\032e\313\016E\251\030\366\257U\224\255i\355\341\237i\372\n \217K\270\270\263\351\276\217\002\310\343:\tNC\367y\026\"\347\211\016\036\316'v\274/n0\346:\006/\2028\316\213\227pok\212\031)\311\227\246j\252-\024\035\244lY\003\017"
+	.ascii	"\266\231E\246m0\302\210\t\003l\356\251\344\252\232M\351\255C"
+	.ascii	"c\231k8\264,`\t&\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_writeString.26.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`\352\003U\034"
+	.string	"\246\265\272I\240\326Q:\304\253q\361\326\230\001\205+\343N\216\327a\023\313\276\357\213k\321Z\227\246\200\317\037\216\236\311\270n\237\203/\332\213{\322v\303\006\307\204\275\343\\\372\007|\202kY\370;\0356\036NOVj\2364B\210\334)\005\244"
+	.string	"\230"
+	.string	"\256"
+	.string	"b\265\326\237\227\026:\311,\025;\001*\323\025\224\013X>* \351=@\375U\251\021\264\324n\360\300w\253\236\267\326\241\231\t\247\366\215\374\210\357\304\026\307\251U\252\310U+q\201m\347K\023O\333>\221\027\361\331^$qJ(\373-\001&\031Sk\265\371\\\200\371\222|\216\371ry\334w\263$\227\372\374\027OR\r\307\202B\245\2333^\222\006\244n\220\261\021\272 }\244\200\001ol\242\344\323\227D\020\026\305\305F\310D\326\206_O/\236\276\020\376(\225Q\250\265\232\006\2052n\331m\037\331\376`\223\265\3003K\364\350\032J\2636\n\034}\360{\243\304\006\030\323*\331\304\037\335\035\366\311\272R\346Y\352\332\211\377\316\261~\035"
+	.string	"\3249\267\372q\216\344\277\271\326]\363\254\237f\251g2\352\363\244\226-\2659\243.Oj\362\244\336\245\2462\352\367\310\250\204\021xRk\214\243\231\nV\032\177\\\353\337\362\273n\264i\336\235\313[5FUk\245\355l\332\313\333>\237\311\213\246\271\311\235\370\276\225tV \026\242\232\210\325\352\364\363\322\035\316\227\324\351\300\265\354u*9\235XQ[\001\\\307\322\301f*x\345\305\236NIz"
+	.string	"A\037\264O\323*\331\334s\001\f\261\2202\233\340\227%\342\013\230\344\312\226\303\260\b|\372\321\343\273\304\204\341X\033\231\345\022]}1\3212\326\331r\033\f\225"
+	.ascii	"\317\220@\267\022\374\022\364\236\271K\356\216\030 \215\037="
+	.ascii	"\2628\225\020\016"
+	.string	"\"\330\">eD\202,\2652A\220\362/\022~\217\227\036\272\225\376m\035h1\352,]\023\312\306\030\360\f\316F\241\267W\225\02727k{\201\227!P\373\236i[\301\213=\232\251Zk\204\255\3522&L\317\355e\326\254\271\f\240\216Ma~\364\350o\315\336I'\222\210\366\310D\321\2428\302\351x;S\307\343\r\221*r\272-\312\335\226\247\313q\240\371\006\204\2643\"\301\323\345\220V\f\025!\355p%l9\234\355\b7dd\273\351v6 \037\347\220L\350l\274\\Ng\243\021\227N\326\225\262\311\262\226\001\206\021\362\347<\373\3026\317J\300\261\264?'\221\265\352\b\372\326_<\216\230\225Y\200\316\212\026f]cT\027r{\231\276\021\203\006\372`m\315U*\223\343\230U\2460s\226\350j\213\257\345[R\370=\274A\210>(d\276\314\331\033Ok\004\031Bc\311\312\315\235m\017\230\246\341"
+	.ascii	"z.\315>H\250A0\303\224B\006\tF0\023\320\024I\222<\200\"\231\272"
+	.ascii	"\353\020xW\022u\266%\341&\023\3400\342\246k\222\365\346\357#"
+	.ascii	"\f\257}\036i\330\3278\242?\226\265\242\247\211\370B \306AG\231"
+	.ascii	"<\256m\335\003\036\013B\247\350\262\204\314\244|W\356\330x\220"
+	.ascii	"\322\037a>\f;vNb\227\001w\024\315,\301\373S\310\340B\b\304\372"
+	.ascii	"t\013\013\344h\016\202\003q\272\302\037\023f?\035p\215\357\331"
+	.ascii	"\036\261s\277x\332\201\311l\206\214\001\341\257+\b\370\324M*"
+	.ascii	"(\266\232\301cS\310R\003"
+	.text
+	.section	.gnu.lto_writeChar.27.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`~\001\315\016"
+	.string	"\306[bE\020\221\223\016\300rF\025\256\302\221\226#\024\360\341\203j\223\242\220V\346\232\315k\235\360\276\203\365j\321\"\377\354\331$\252\261z\033\310\230"
+	.string	"P\316\021\255\227\2757(\213\241\200%2|k\332lA\266\355-wJ\001K"
+	.string	"Q"
+	.string	"J"
+	.string	"'\216\242\373\227\341"
+	.ascii	"vY\240\213\335O\304\331\365\351\357\262\355\227\270\211\316\206"
+	.ascii	"!\277\226\025'\245C\265\"\307\356f!\027\260\371\224\017\260\371"
+	.ascii	"\324\020\357\036;\377\340\245\013K\350\255P\217\234\005\273\353"
+	.ascii	"\350\2556\334z\333\003l?\260\037\006S\243\245F\253F\307\031}"
+	.ascii	"Pge\006H\214]\225\260\307\312\230/F|\346\267;\0374f\231\263\350"
+	.ascii	">s\272\226\304\245A\005\017\232\335\025\002\237vp}\202b\214L"
+	.ascii	"\003\030\021\f^P\016\332\024\r\225\022\215\266\201\003\335[("
+	.ascii	"\326\335\016;\024<\332\017\027J\361\336G\345rP\2241\225\035U"
+	.ascii	"\275\252\346C\243\222\260\2047ml\213h\212\320\005\307\325v\201"
+	.ascii	"\203&O\313\356\222\334\2731\365\nbCU\223\022C\373CE\005a_\256"
+	.ascii	"\262\374\371\367{\336\372\261\277\374\235\303\374\037\217\371"
+	.ascii	"\003\025L\022T\364\215\343B\362\244mj\242\211\224\3334\b\230"
+	.ascii	"E#\244\322I\004n\323H\030B&\244\322hB\246\2152\013\243\320I&"
+	.ascii	"\332J\331H\2105\022\205-\3434m\313\260o/WY\037M\340!ES>\311\335"
+	.ascii	"\017%4\255\370\026\0075\0045\274\250\252R=j\007\" \260\"\262"
+	.ascii	"\013=6\263\b\354\265Y\213@Sf\f{\031?{\355\260\264U\203\371g\263"
+	.ascii	"(-\037\341)T{\242\027\303\001PD\364H\230\215\335H\223\r\016\350"
+	.ascii	"{\260\203\300\317\301\016b\316\r\343\005\340\b\201\341\337}r"
+	.ascii	"+&a\221\001"
+	.text
+	.section	.gnu.lto_isTransferInProgress.28.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"\242M25Po\322\030 n%\"\245_\022C\322\026\bP\t\203?\251\264\352\225U[\004\311;\2623\033\213\204\273\315\006\220\206\211^['P\271\005+\225\326B\342\3362\005\231\214\f\325\235\315\205y\0342\031\257\tN\304\205Y\0170ZP\302\342x`Gbp\2439^\020\022f1JX\315\325\215\322T<\213\237\037\3676^\001vw\177\243w\r\244R\213A\312n\350\305eI\023\212\307\257}\365;\367\n\242!\232\212Ph\300\356\210\345dw\036\f3:=u\200\322)\243\002\224N\377\b\t\332\233\316\216\020\346\002\204AR\332\235\360q\350\246n[uD\t>JTVLD\037u\230\205\335\335\201D\031\372\323\277\340W\3705\002\b"
+	.string	"\266\231E\246m`\344\250"
+	.ascii	"X\005D\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_isSynced.29.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"%\007"
+	.string	"\002\01635Po\322\030 n\203\240\360\034\2512M\013\004\250\204\201\025B\331\273\005U[\004\311;\2623\033\213\204\273\315G\304\222\224R[\344U\225c\235Z\333\210\264\275e\n\230\214\013\234A\036\353\n5`2Z\022\037\b\353\252\034`\254`D\365\tA\220\274\240\247s\264\036$\304b\224\360\271\232\331\267\255\032\325\241x\025?E\356q\274fvw\177\333;\206Yz)@\331\035\305\300,\313\244\362\361g\317\371\235{\rQ\221LG&\024`w[I\331\235\006\303\215NO\025\240t\332h"
+	.string	"\245\323\377\001B\266\246\323c\244\261\330\270()\355N\370:TS\247\255J\242\003 '-.&$\221:\215\302\356\3560H\031\372\323\237\340O\3705\002\007"
+	.ascii	"\265\311B\241\301\3143\227\225\235t\r\201\354\020\361u\315'"
+	.text
+	.section	.gnu.lto_redraw.30.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`N\002M\023"
+	.string	"\226$\200I\300\322Q:r\251\237\237\303\210n\r\250\006\236\260\274\342\005\211\270\035\341\203N\002\364\340\265\3438\273\353x\351\315\246/]\030\377(j)\300\3669\021\273\r\fB%$\037Ze\002\363\206\023y\207\321\b\370\212\366\367&{\247\024e"
+	.string	"f"
+	.string	"o"
+	.string	"\247n`\032{u\372\225\355K\373A\027\242=W\363\222]\234\322\322\356\270\300\240\352\324\343\t\324S\325\005\324S\323l\037\037}6\325s\3139\342\355.8U\234\366oJ\232\377\241\213\2106\233\177\">\277\0038\236("
+	.ascii	"\266\332g\242\343)\347\272\313\0176"
+	.string	"\034)S\017v\327R\264\205\270\351mO\260\035\301\226/\002@\271\033\331\263\307\232\234=\366\277\335]O\234\235\222\036y\356WU\351Z\245)\225\376\252\364\254\322\222J?\200l\272\321\3033y\214\253\323\013\262Ot\267\342G\277}\237\350:\232'y\0229\361v\3670~\344#\031%\2056\363\321t\204\317-hwg|#\243\244\314\274hfb3\256\016\003\023c\020ow'A\3771\206\025yq\245\236\216\314\022-\200H\314$\004\004H\227'@<\335\204v\352\2643\334\206\201\267*\235\365\233\224\3455v\337$\3311E\345\346\264[\276\324R\355\256\212?\003\2065\300\347\247\246\236J!\342\017\222\267\252\234s\316\035\036n5\331\363\247\234\317\031b\r\227\341R\355\342\250\3701\256\264\301\3779\365+\224\027\303z\372I\262c\n\337_^,\227\016\262*\023\013)\254\314:\201\311^,2\261\0206k\341"
+	.ascii	"\223\271^\300\320\005\302\270Z^ +&\003OL\034\302Z1P&\fc\340j"
+	.ascii	"\274\371\267\0237t\tM,\242\240nf\315\263o7\205\203\022\250\242"
+	.ascii	"\257\200T\360'\035\251\202\b\r'\236x\027wS\365u\026.\310\213"
+	.ascii	"\256\323\346@P\364t\3231ud\272\030\365\300\221@\354\343x\216"
+	.ascii	"\030\007* `\2021\202\220\036\266\227E\266\207d\333\323\007P`"
+	.ascii	"pi\261p\251\1777V\200\300\032\206\220\2231\\6\340\223\"\377\t"
+	.ascii	"\242\2438\005\246\322\003\266y\031\355\341v\341\305`fvd\257\302"
+	.ascii	"\362M\253-+\203?\301>\316\304\201\341\013\007?/@\255\201\227"
+	.ascii	"\246&\264,@\030#\022\2619O\313-\317\b9\245\020{"
+	.text
+	.section	.gnu.lto_txBytesFree.31.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\225\007"
+	.string	"\222N45Pm\323\001\244\024\241n\336\200(k\327\320P\233^\251\264Y\276\201\371\263\321\b\372\\\2322\253f\027\357\350h2H\242\326\232\274\335\206\327\321\344\355\267-wJ\001\230%\021$s4\325\325I\300,Yy6\f\325E)DI\305\006j\323\211\034\353\212\232\311\262Z\260\"&\245\025\245\271\267\352\004\241\037G\317v\360\274s\252\323G7{nOC\366\341*\310\n3'%\004(\273\022+*K\022\215`\330\316l\311\366{\366;\356\221}>\034`\027d\"\262;\013\0341\217<1\266\375\215sd\326\340\254\3502\241\213\b\220\224\335\031\247\013X\036\301\007X\036)\305\265?\315\377\307\241\206E\b\327m\177\227\203\335\365\343\272\211[o{\300\266\201\355\214\013"
+	.ascii	"\266\231E\246m`\304U\335\341\232x1\321\022\215\333\201\t\002"
+	.ascii	"N\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.32.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\035\007"
+	.string	"$\f\356"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}\212\001\202\200\200\374\342\303\347\302\005{y\270\347\222\005wu\370\346\362\003sq\270\346\242\005om\370\345\322\007wk\270\345\242\005ig\370\344\302\005ec\270\344\262\005a_\330\337\002o]\270\337\302\005o[\370\336\202\005oY\270\336\322\003oW"
+	.string	"?\202\210\200\370\001US\310\001Q\307\001O\306\001M\305\001K\304\001I\303\001G\302\001E\301\001C\300\001A\277\001\277\177\276\001\275\177\275\001\273\177\274\001\271\177\274\001\267\177\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\016"
+	.string	"\200\024 \205\fD\003R"
+	.string	")\200\024@\n \005\220\022\223\0243\351A\260\224\360\006"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_displayPortMspInit.33.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`2\001=\r"
+	.string	"6\227VD\020\2176\035"
+	.string	"\334\340\341\264\033!\240\025\244rz\365\221?\264}60-\325\r"
+	.string	":/\355(0\222\221\367\365\2341\214<\213\277\006(\257\325\r\n@EP`\004\220\006`\220\362\031\202\374\361\375i\223-S\n@"
+	.string	"A"
+	.string	"A"
+	.string	"\026N2JL\021T^vC\314\3417\254\313\353"
+	.string	"\254\313X\341\241WQC>\306\243JAq\371@\321\253\t\217\032\240Wq\354\3567\\M\300\221*\306cw\255\037xr\313\333.`{c\037%\34198\360/\\\232\003\351\277K\037d]\332\017F\364\237\003\2508\241N%Qd\207#\215$\373\325F\n\266\252\217\341\234^Z\020p\331\225\220\212\261,r\005\203m\022[\343g\270\006\022\207\006\204\001\235\246twE1\222lg\326c\002\017,<\205a\373\343#\262k\327\353\360C\\D\307 !\032\0223]\013\252\324i\312\032}\351 \346\265\013\341\303U\026T\237iM\353\362\245w"
+	.string	"]\273\335??\356l4\356\363!\262Mm$c\240q\036\005\330\364`\r<\331\007\353l\034\266\341\360\324@6Ld\316\r\323\204\335S\240\32001\261tq\344\215\023+\006\016\230L\240N^\025I\347X6\202\227\340\bX\261\273\035$2.^\244\264\004\037"
+	.string	"2\003\302\360\325\206\235!0`\210\245r<c\0076\036\260\236\0218"
+	.ascii	"\303\320j\263\361\020\004\253`\211\216I\2762\361)M8p\007\314"
+	.ascii	"MU0\020\032\334\301G\r\350\032\316\304\302\371!\b\340.Dj\234"
+	.ascii	"\242jlW)\003"
+	.text
+	.section	.gnu.lto_output.part.0.42.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`\033\002\355\021"
+	.string	"\246\241sF\340\360&\035C\037\260\302Q&\21705\221\366\364\320_\242u/\\\013\353\337\340=\350\223\233J/\227?P=\271\310 \021\"\216\363\261\333 \030\326 \303\032\344s$\352\234\244\003\266R.\352\215\324 \333\366\226;\245["
+	.string	"d"
+	.string	"^"
+	.string	"0\017\267\306\306\032m\221\021\360>0\326\335\234\032E\273\341\201Oo\331\247}\024-\033\333\376\211\367\200\366\221\fyn\030\304\240\201!\355\356\366\371\361\001\246Oy\001\246O\025q\360\032%\350\307\327M\314\365\261\027`a\343u\303\341\021uy\"\331]g\035\356y\333\rl\263\354H!\353\nAl\177n\361\byp"
+	.string	"\334p\201!\007i7\334>Ot\177oa\007%L\354\256v_\250\345\307\254\021\r\275|\304|"
+	.ascii	"\371\364\034zy\200]\035\241\007\031hkA\007\332\003\371Hv\254"
+	.ascii	"+DN\321\356.\220\361\260V\27082\332W\361\037\360+*xt\254\353"
+	.ascii	"g\003\2020\263\306\207\026\031i\335'r=h\214U\245~\006\215\222"
+	.ascii	"\235:\fU\266\353R\340\033\375E\212?\342\323+\225\370\327\247"
+	.ascii	"\257\242\th\244\270F}\354\0344J2q)\352\216U^\256\3528\323\350"
+	.ascii	"\323\203~\323a\377\344\210\226Y\264jt|\370_;\201\244\335\232"
+	.ascii	"\245\244\0051\215H\024\271\205d&\303\005\371\003\223\321\203"
+	.ascii	"\024\236\020\362\251X+\024\316\353R:\003.\036\007AcQ\261\024"
+	.ascii	"\345E\202\236\254\244\324\251\220\356[)q\361\270\316\202\t\253"
+	.ascii	"\373V'\033\267\332XV&+[\312\373\266\220\017s\235\312\333\\8\316"
+	.ascii	"\3334\333\361\252\343\307\216\212'\315T\203\355LM\"\2433\252"
+	.ascii	";\266Q\321\217`2\351\324\250R\355\022\223\370\327I\003/ `\242"
+	.ascii	"a\314z\034\314i\264\213e\310p\214\321%\035\270A\336\023Y\024"
+	.ascii	"\376\211\3260k\270\345\302\271\334\320\326A\2342A\357\204\331"
+	.ascii	"\232`\320\n\200\223Z\273TX\275_\270\216\b\317 Y\003\374\303}"
+	.ascii	"1H\260\353g;6h%5\2739F\356\233\255\201(\016\221\b\216\363\261"
+	.ascii	"\362\r\222X\304B\260\274\302\260\360`\312\330\371\327\2521"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`\256\001\265\007"
+	.string	"2\313)/pi\323\001\346\364w\372\366\361?\f7=\001\\\374w\240\372\377\377\377\377i\340\365\377\277\337\276\333\354\277U\355&\242\206\325V\365\367&r\313\024N\206'\262\"M\n8\240\020\324\207\202\025\024\320\204t\361\004"
+	.ascii	"h\306\314\212\205\214D\343hb\246F7I5\341\021\204S\016^\271|\222"
+	.ascii	"\273kg\031\203K\222\322\236\332\211\331Iz\266]\\\b\313!\2253"
+	.ascii	"(\307&\267\266\023H\376p\221\0278\310+m{\331)\367\260<\333\332"
+	.ascii	"\306\270\017\216_\032\317\030w`o8\033c\204\203}{B!\233\335\335"
+	.ascii	"\353\227\263\355\032\002% \020\003)\252\034\030\330\201\350q"
+	.ascii	"\220d\250\2145\004\333#\031\344\260Y\177\327\336\3105\207\241"
+	.ascii	"\036\301!px\200@[\032)\005\003\371\345\301:\234\332\251\235\332"
+	.ascii	"Q\355zu\366\024b\035\004]\2031%\022\244\307P\017\365\340\032"
+	.ascii	"4;\234"
+	.text
+	.section	.gnu.lto_.refs.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375 u\205\002"
+	.string	"\342\005\020\024\220\265\351\377\377\377\377\277\026-A4zzj\264\366'\231\002\n\377\231\274\001\033;q1\332| I\332J;$w\354\322\001\242\240\250)\215Q1O\321*]y\004\302\314\213d^\016S\007\001\005"
+	.ascii	"\216 \f\342\352y\013\354J[\302"
+	.text
+	.section	.gnu.lto_.decls.8bb53a7788f6fc85,"e",@progbits
+	.string	"(\265/\375`\323%\005\246"
+	.string	":\005\3259V \nI<\035\027,J1\370\177\013\346\033\002\235\247\306\330\324\026\001\315\353\320X\324*\261xP\302\212\346\240\"\225\257ao\033\242\02245f\036\323\265"
+	.string	"EK\321d\214\365\272\306\364\271DuE-\2031\212\333J\225=M\323kS7\314\376\003\221\356\366\2202\245\024,\003\222\003\210\003@\216\210\262\310\002],\313KOm\260k*\030\344\210\350\217D\341\326\021Q\3157\335\212\003:\021\231\372u\327|\323\231X`vD\224\365.\336\347c\274\363a\374\317\277x\031^\375\346/\373\231\337\363\342\326#\210\036\006\334G\\\303\372\362gl?\030\333\257\305\366_\261\375Nl\377\020\333\237\331v\300n\257\342h\356\266\201\234\2539g\n`\362\212P\253\036\373_M\373\225\f+4J\315c\037P\331"
+	.ascii	"\362\370\372\2618\3155P\241\201\271\023\214S\342}|XI\300l<\336"
+	.ascii	"\2436Y\330\304\004\277\234\260M\002\211\273\001\221\242\307\005"
+	.ascii	"\327R6\3648I\360q\247\266\346nS\246F\216\3445q(\036\305\357\334"
+	.ascii	"\211\347\271\024\327s;\237\342O\274\352x>\327N\347uMC\315\271"
+	.ascii	"IV\346g.\027\375\340*Po\310\230\213\305\334\234\227\004\247\356"
+	.ascii	"Eu\261\022\203\2719\350\256\301\363$.\347rQj\036\362\245(hi~"
+	.ascii	"6\002\220\2037w\213YRs\220\t\274\347U\220\356\021$\034\317\231"
+	.ascii	"\370\331\245NsO\235\320\005=fD\002\377r\246\322\034\200\255b"
+	.ascii	"z\203\243\301\355V\354g\327\260vp\251\234/i\361\261\341\304\244"
+	.ascii	"\306\240=\233\200\217\253\256\304\343\250\231\006\206\260\007"
+	.ascii	"\235\377\260\355."
+	.string	"\330\026\001\333-\330V\262}dg\330\274\210W9x\033U\006\206P\2130\360q\247`\3339\254^\350\034\326F\301\322\240\300v8{7\363\025\332\317\234\210\205&\325\317p\316Lw\0171\356\036X\332\252\230`+n\t\260=\002\373\3015\254\375\001+\3025\254.\304\277\274J\343a=\202D\337\345W\346\3129\3138]\3173\351q\223`\333\301\232\002f&\321\026\330\021\344B\247Y\373\331\022\256a\235\361\f\253sq\270\316\037i\036\313\231zA\206j\004d\343qS]\303\312z\206\265\333\237|\2133\371\002t?\001\312:C\367-\352v\023\315\004\307\274\005\034z\202\356\313\243\333\247\335\216\243\333ot{\216n_\352v\251n\327\321\355L\335\016\325\355\322n\267\352\366\247nw\352\366\251n\357\241&\344\002\004\t\340\351@\267\247\350vbwc\320}U\350v\270\337p\354\356\265\373\202@\306]\326\356\017"
+	.ascii	"\005M\323}\241\270Z\364\355\276,\272\375\007\250C\273t\337*\232"
+	.ascii	"\257\340%`\351\376\f\217\241\373\207\217A\006(h\013\272/UwO\351"
+	.ascii	"\356&\033\232\355\276<jOl7\212L\2355L\367m\352v\262\237\351\260"
+	.ascii	"n\217i\013\335\027\251\373e\272\237\355\366\301n\207\322"
+	.string	"\355I\272\035I\267\273u{\221ng\353\366\265nW\353\366\264nG\353\366\263n/\353\366\256n\347\352\366\255n\007\322\355\027\272\333\254\333\177t\367^\267cu\273\210n\337\320\355 \272\035\001\335\215B\267g\320\355\030tw[\267\017\240\333/\350v\017\335\316\241\333i\272\035C\267\317t\273L\267[\350\356\276\356\346\353n\256\356\006\321\335p\335=SXXX\330\215\263\2721S7\007c`@S\272\373\342>i<\257\262~\220\360\253l\350qf\f\206\364\274\372(\327\352\373\276\312Z\267\364\274\032>\255\360\007u\200\245\253\344\002\367\205%x\223\372*\275E\321\r=\276\321\213\024\002\2526\346\343[#\354\256\253\355\326\2704d\234n~M)\273\032\261\275\n\261\275\302`\233e\220m\026\276\241+\204\341\376\272\254\\h_\241\030 \2557\030N\236@w\210\233\225\253\237\276@C\036}bH\217\257\214\327Z"
+	.ascii	"\216-\273\3077\006\004\220\334\271x|a\304\fy\313jz|\235/[Dd?"
+	.ascii	"^\207\314\217@\031vp>\327\205\213\016\030d\317\333\354\353\202"
+	.ascii	"e\211J\016\372\370\366\274\326[)\221\026=\276\314\226 \237'J"
+	.ascii	"\036\337\345phG\215\032\217ov7\227\273)pk\356\306\362T\005\017"
+	.ascii	"M\215m\026.V\204`\340:V\306C\020\260?\260\333\026 %2c\271b\233"
+	.ascii	"\205\212mj\025?\266\312\025\252\037\225~\2779\3000\237\307N|"
+	.ascii	"{O<\274\245\274\376\275\327[\325\222\334\370y\374\341\247\264"
+	.ascii	"4\251\271\332b\327\2474F\203m\277\227\0223\367s\205$\005o8\007"
+	.ascii	"\244*\020kj\311\312\343f\001b;\r\023>q\2622\371\321\375\330\365"
+	.ascii	";\361)\267\037\352\343o\362Z2C]na|l\313\321\315\2610\251c^\221"
+	.ascii	"\353\237\243R$\317\356\361/y-6\352+.\357\361+\3718\230#w9\\\304"
+	.ascii	"5\261\241U\006\367Id\366j\330\251-\201kCr\244\305J\254\254\317"
+	.ascii	"H\377\021\231\"\"\313&\217\337-\n\223\243\035\217_\355\333V$"
+	.ascii	"J{8\036\377\332\263y5\203/\322,Lj\246>\325 \031\230\031\333\236"
+	.ascii	"\301z\013\013=\203\265\375>m\211\016\261\2624\264\266\"a|C\265"
+	.ascii	"\237\262\036+\374\331z$F\304\247\213m\214\203m\27522\227\037"
+	.ascii	"@\220t\215\365\223\371\331\213\031\225\"/\036\377\220\327"
+	.string	"j\331\303\221\245~f!\306\020\333\022SXU\246I\333 \026X\177\025F\020\215I\365\370\277^+\310k\217J\210\221-(8\257\247\032 H\265\350q\343\246\327\355c={\006\256-\027\034~R\203@\372\267:\317B\336\360ku]\\\217\333\357\265\272\273\305i\2101IieE\335\240;\332\313lv1\210\376\207\317\r_\020I\3411\307:\3243\254.Yz\315\246\355\325\237\376\020\t\324\274\324\300\033\222\217\277\f\205j\3207I\207\325\026QT\216\026\265@\254\242\307\237c\265\203\026\372<\356\013\304\376\324\343\360\352S5\376\222Ra.\323(\016\355\303*\343\037\244\334\352\342~z\036\177\024\324\337\350\217jj\224\214\340\3630\233A\270b\252\205\240 *\351\323\363\2559}85\255C\330\300\246\217\373\233\272_\352F^i\0039S\327&!Um\217\3373\254#j\372\231\326\254\"MW\252\277\244\344"
+	.string	"\037Hw\217\037\351\223\372\225\276\306+u \315\231\371J2\20293e\334=\270{\300@\236t\224\255\270\257\223\306G\275\246\254\232<\356\217v\277\321\0375]\214\242}E\036?\3245\254\027x\206\365\211j\372\213X\242D\351\253{\354\3013\314\370!\013HV\336p<\336\243yY#\242\263\022\362\263\341\226\333\323\0304\b?\331\274\330\036\367\007q\311\264e>\270\30755\375O\367\n\024b\344\201\276\031\2047Wd\204\220\353\210\350\263\213\005-\345\201\326\260\224\036_*=\305L\210T\322\355S\362T\327\363\370\352\335=\2576\334\345\353\230\265\027dpfl\217\300\033n\275R\372\346\255-A9U\361\312\354\220\246^l\263YJ\224\\(\237\243l\356\202\312\322k\321\312{;\356\223\276P\246"
+	.ascii	"2\371x|\351\256\223\246\025\240O\036_;\257\016\231\nlbo\335e"
+	.ascii	"\342\325\333\2443\314\013T\332\030\363\261\007\206\335\266\336"
+	.ascii	"9w\013\022\343\307\332\343+\367R\227+i,\310\343\273\244\333\356"
+	.ascii	"\327\331[\220*\027\240\253(\032\217\233\235\3016\034\334M\362"
+	.ascii	"9*]\356}0"
+	.ascii	"\002-L\362\001Ow\350\020K\242w\243\374\220\3231\307\336#\367"
+	.ascii	"\310E\342\342\".\372\241\205\312J\223h\373\365E\362ZxJ>\302V"
+	.ascii	"`\277\360\013\257\213+/^\\ \262\242\242\3504G\241DD\037\3102"
+	.ascii	"\375\337\377\375\026\013\2654c\306\007\316\344\236:\253\3515"
+	.ascii	"\272F\037X'\003\311G\026Z\365\242\371Y\207\034\225^'\320@\275"
+	.ascii	"\254\234\217h\340\022\205*\2322e\377\312_\371\300+f\355\325k"
+	.ascii	"v\263>/\277\362\362\003hQ\r\236\351\354\211i\006\353u\305\274"
+	.ascii	"n\331\232\363\314\222*\r\202\222\365-kSB\3473\345\361\035\033"
+	.ascii	"B\245\3360v\231\241In\265oX\233\232\017\273\256\307\027\354\265"
+	.ascii	"V#\313\032C\036\337"
+	.string	"/w\273\323\271(S\217\257\220\227\002\332\301\034\322m\270Hm+\356q\017\177\330^\t\331\277\373\273\337c]\240\252\372\372\242O\330\204\357\34793s4\337&1\220|d\345(\321\207\276Z\027H\337\240\016\272B$\344\f\035\366pE\241\037\272\277{\315Lh\316y\210\205\232\241=\026\332Y\334?t\303\370\3059sXA\315\313<*TX\036hL\244\356\220\233E.\347\246\323\222\001NBM\247#g\325)/\233V\313\013\320\354\264tVs\276\220\233\315\245\b\322|\301Y\315B\331\005\235\220g\252\32327\245\371Bnff\007g\323I\310Ye\n]pV\235\204r\325)\317\344&\023\n\243\231\241\027r\325i/W\245B3\316\252T\310YuR\362.\247\225$!)T\236\340\\\310\331\314O\240$&tF\316I\225\346'9\373\230O\206^\220s\222\024\372\204y\344i=r\317\0363\246\024"
+	.string	"@=O\322\334\224s\366\220\346\334\243''\003u\260\244\312\345)\227[\332H\312?>9W"
+	.string	"\224\363\322\263\\\316y\231s\036B\223\2509\327\230qN\201\200r\216\322"
+	.ascii	"\345\244\245\232O\316?\026%M\310Y}\222\326\250\211U\247\371\005"
+	.ascii	"u\351\316\037i\236\346'NP\266\272\024\222\177r\316\336\307N\205"
+	.ascii	"f\360=\276?\376IXe\250\312\266k\371_\265W\377\352ba\b\333\"\322"
+	.ascii	"\340\366\030\306-\265\351M\331v\2567{$TX>\254\236W\177D\336\236"
+	.ascii	"\016\307\363*\313\312\225\027Lz^e\321\335\240;\024}^\375\335"
+	.ascii	"\253{\343\346\270<\356\216Ku\245n\325e\272Swz\2457\3526]\035"
+	.ascii	"\327\306}\272N\027\207W\257\225\307\365\363\370\036Q\356\236"
+	.ascii	"\317\245\207\251\353\305\276,G\035\223\1772Us\215^\360\307\312"
+	.ascii	"\337s)=\257\376\352\240\374\023\251\347\325_W\220\017\033\366"
+	.ascii	"T=\257\376\006\277\360\372\324x^e=\326\321]\322\361\274\312\232"
+	.ascii	"\0214%z\326\024\275\240\313Egr3;I\0234\274\264H\036#R\231\\;"
+	.ascii	"\007D2D\213\303c\274\321)\206@&yBL`4\362\350\350\034u\206J\233"
+	.ascii	"\366\003\305\344\312\342\210\314Q\036u\206)\020[#n\261s\243\242"
+	.ascii	"U\261\026S(*uZ\234\022&\310I\362\234\220\264\331I\252\330\200"
+	.ascii	"\202\262\250S\302N\322\204\316\001Q4\336hhq\216&\024\2157C\025"
+	.ascii	"\2552\331\342\204\315N\322\204\r\253\b\020J$q\007\204\222gG\311"
+	.ascii	"s\204\351\233\"\262\325iS\260\335\201\007\033xP\302\003\303."
+	.ascii	"aB\204\t\021k\2270QSc\302\203\032\266=\250\271\312\244\215L\222"
+	.ascii	"\270B\207\030\202\262M\321\202\333$\2615\266\310\341\313\t\227"
+	.ascii	"\366\003\305\023.)t\212H\345\211\227\226d\262E\2468\"O\320)\001"
+	.ascii	"\331\246\220,J\240$\266(\224Hb\233\323\302\202\210\304i\221+"
+	.ascii	"N{\243\323\342D\262\310*mFp\320\266\310\021\222\255"
+	.string	"\262\005\b\036P\276\340\264;<1\312\233\326\330\236xim\"\200\241\305\3161\004d\333\202hlQ\332xP\303&mp\222\307\030d\253\274!\"\2119!(u\216#\264\312\"\222\005\206\0268\304\226\002*\334\26497.;\023\250@\247\230\242E1CL\352\020\221((\213*T\034o.H\320\035Z\033\235cQy\323\"\213\"\354$U\304 \21197\270s@$wR\354`\220\264i\215\305\024\216\310\023$0\036oZ\224I\036\016\3404\200\305\021\331\242D\266+t\212\253\n7D#\n\231d\262\325Q\346\244(\"Ah\225\305\034\0262Fb\021\331\236\270\220ly\214D\013 \225J\242\213\262s@$\221\355\212\"\022\207C\037wZd\b\345\361\210\f\361\242\202N\321\b\202\bm\222'&i\003\223\264\261\200\022y<!CkDADa\305\332\336\024W\2648k\222\305\021\211\223\306\343\r\276"
+	.string	"\317\020\003\311\343\016\326i[\344M\322h\344\031\241M\362\300\030\217G\020lXpZ$\2615\336\fY\034)\200<&\221<7-J\233\022J\235\342\33255!t\250\200\004\036\300\336\200\330I\252\260Q\"\217;-\210\306\235d\021'\304\261\030B\247HT\021\342\006\231\f\001B"
+	.ascii	"J\035\236c\b(\210\310\024-RP\220\354\366\336n\340\2501\264&\225"
+	.ascii	"\346\205k\352\255=\306R,\3056Z\226\200hGD\177\330\006~\342@\235"
+	.ascii	"\223\034ONKeN\212\356\017\366k\211\024\032n\372\345\324\224B"
+	.ascii	"\030\217\273%\006{\261\006\233KG\226p\220\322\216*2\224n\022"
+	.ascii	"\030Ky\201\217q\317\333\214$\\\2431\022\237Q\023\322c\034\305"
+	.ascii	"4~L\313\240\264\224<\036xkA\036c#|$5%c{\334z\320\277\036\177"
+	.ascii	"Q\212\006\237[\201Q\217\337\306\220\336T\332\214\2335\224\321"
+	.ascii	"\203di\b;\323\202\274\304\204n\031\330\317\r\036\217;F\343\030"
+	.ascii	"8h\306\301\224<\257\376`\244\204\336\264\360\263q\220\005.\300"
+	.ascii	"e\323c\f\364ZC*\224\306\017\374\323K\323)\254\037,#\346\255j"
+	.ascii	"\351\350\366`\311\240\324)\021\0266\356)\304\316\313\307\346"
+	.ascii	"\345\227\002\332\256\2547vH\253\232\215\235\215_\214 q\373\236"
+	.ascii	"mNU\036c\237\276\200\321\2705=\027\027\220\007Tu\003\366\313"
+	.ascii	"HH\b3\373\346\005i\363\251{\214\227}\361\242\236rt\217\367r\030"
+	.ascii	"\341\270\3026\313w\327w\312\335\035\274u\026\240\313\257\034"
+	.ascii	"4$\242\025U\345/;\243\037bz\322\212\272\252\364\035\354+8\202"
+	.ascii	"DK\321\211\022\023{|\003\333\247\372\304\234W.\340\016<3B6\366"
+	.ascii	"\376m\240\004\330"
+	.string	"$hE\212\256\n\353\361\373\005\203(\250\"\0019I\363\2302C$\"\222$I\241\003r\n\020\206bi\036\311\231z\022 4MM:\007\315\314\210HR\220\222\02466\003@Y\374\252,%\335\321U\203`!\213\354H\266\273l\214]|\005\274\314$\340\025X\352@e\260C\3344\306\340H\344j\3142\223\020(I\002\367T\314\271>\321y\312\013\261+\"\fI\224\352\027\350\372S(@\246\360(\236\255\313\344\210\n\342\304\346\241A\230\022 \354\313\017D\241\205X\361\037=\270Y\340\321 \201\306B\367\333\322\002\304\2151\202\346I\350D\273f\206\251\334\230\310\302\203?\013\256\013\rq\202C\273\301\213\001\232\211\031\346\300S\201\202\242\252\f\b\256\326\256\034\351j\345d=18\300iu'\315G\001\364\237\203\262\370\343\232\252J\254N\032T\230\212?\257\3346\371\022\373\237kY\305\235\335\260\031\236\257g"
+	.ascii	"@\240\276\277\317n\017\301\022bf\024\003&1\210\237^{\352\317"
+	.ascii	"\321-\307\333tOp+\352\310\323\2640\003\f\217\372"
+	.ascii	"\262\304U\023b\365]D\327\330\223v\357\370\256$?\030*\003\314"
+	.ascii	"N>\236\257\276\275\270\374\037\333 \360\257*\314f\244N:\325\013"
+	.ascii	"\253\334l\362m]`\312\b\032\\\"7\225\nl\276\216F\245q'M\033\267"
+	.ascii	"\335\262))\210\241\245\267m\r\333\241~\212q\\\271\341\275\361"
+	.ascii	";\266\fQ\333h\253Wr\031\376v\343\0222\374\200\274\273\025\237"
+	.ascii	"\226\270\016(\367\n\250\177J!\202[\330@\n\"\226H\211\355IL[o"
+	.ascii	"Q\235\005\361o#\231eM7\3431p\004:T\237E\025eS\312\004\240\017"
+	.ascii	"\024\304\332\306\"Z\021\002\253f\252\317\355\3139\233\032\007"
+	.ascii	"AR[l\314\212R\206\034Nm\356@"
+	.string	"{=:\212>\022\320\021\377\035Bh\351K\020\003\273\001\341\365Y\303\321\342\237\251\334<\376\310\f\334\301\020E\233<\253\025\337\301)\253\233\221\302\234\324\331<v\324\305;$uv\322J\327Y\304\357\220 h^c\366Q\265\342\007Hv\250\317\252\272\274Q_@$7\024\361\313\307\2649\026\347y\034p\261\270Zw\237\365i\326\223\275s&3\023\005\013\224>\264G\341\204\242\fo\361,\270\026\244x\005\215\334\377\244\203\250\342\007\037\303\214\273\226\364QD\257\f\\\223\0069!\263\016\317\3355%\226\361\325\227\317\270\260\013\001\243J\001\202\2570\202+N\340\211h\274\n\207\336e\r\222Xbu\013\350x\316\325\222\232+k\231\325x\252`\244B*\025\210\264VJ#\251\021w\214\215\233]B\037\227\364\216\264pv!\276\2633+W\250\314o\240\217\214L7\021\303\360\206\211\210!\217\320F\234\ng\240\201\271"
+	.string	"#3DF\345\242\233@'\270\224#{\367^qN\201\304&go\r5.\006ey\\\202\250\220"
+	.string	"\245?~\016\335,3\fe}\371\347\233\251\312Z$\366\375\374t\334\030\245\317\324\200H\211q\352\027\275h\303\016R)\003\" W\215\241\257B\216\353\325\272t\313\363r\313T\234\306\001\226v%\365\261a\312\237\356\320\362J\267s\242)j\345\325\214\325h\n\361\255\252\303\315:de0/*\267[\324P\034\nT\022\2541\314%#\027\b\317h\262\210\322\006\336\247q(\266I\215\031wF\031\215\201@H\334*s\372\232\024b\3705\226\342\212\276\260\274\nZ4\223\200\214\221\301\276\236\034\003Ac\2535*w\223\005\007|z\250M~Q\310\304\344\340"
+	.string	"\365c\247\007\002\376\022\227\347{\204\365\251|-y?\255\204\253Q\263\002\343$0\\\243\330\346\324|\027\304K\013\237\302\270*\366[\233-\365\"\346\306\252}\265\376\212\321\004KC\315\335\313\353*P\312\327\277\030\t\020\274\306\250\313\372\217\351v\306"
+	.string	"\030\253\033\0312\034\3179\231\006\306\025\365\343-t\325bAQ)c\002\367\324R\321(\355\253%x\007\223\217Q&ZH\351<@\306#\020\205R\251\227\254\f\364U\333\267[\307-_a\363\332,\023=\342\270\004\324\344\003\365\203Qz\363\206\267W\r\b\037\325\211\246\365\307\360\250\344\230U\360\345y\270z-u\355]\377\202KK\324Rd\n]v\"Tp\254\023*\230\006\347o\t\304pFp\304\312\324Ml\347[\361I\235\354\375yI\231`\257I\352j\211\355\201\302\272\374f*\336\272A2U\031\305\261,\301\220\363\001\354"
+	.ascii	"\265\236m\003\006\231\347\253$y\237M\032\374b\270+KtF/\221\276"
+	.ascii	"9S\302>$N\257F\252\235\006\037[\007\356\265\274\231;\371\346"
+	.ascii	"\017\360\233e\352\027\247\327\214\b\345\202\200.z\024\274M\375"
+	.ascii	"\024n\346\325\317\350\271\232E\375]\bd/4\211\t\207\037Xx#\243"
+	.ascii	"8\262\003e\006\254V\313\025\0302\3401\202B\r\232\024\373\225"
+	.ascii	"\323\352-\305\335\247\240\240\325Z\354\206\215\266\356!8N\031"
+	.ascii	"v\361\345\223\262\334^\036\262\030\201{\270\302-\327\nj\245["
+	.ascii	"\032X\030E%|U[[AW0D\023\016ye\204\242\304\005\2623\343\241\312"
+	.ascii	"\365\3023.f\312\r\030S\321'\2226r\261U\240\003\\v\372\304~\002"
+	.ascii	"\316\t\214\276\372?\200\324\017\330\203\001\273\001Z\312\356"
+	.ascii	"\377p\306\324\243El\006\237d\030W\\\220\366%\336\177\007\232"
+	.ascii	"&\335\365\360\204\347{53\312\353n\277\353=\337\275\t\3635\371"
+	.ascii	"\374\367\254\270\365v\373i\365\177\355\360Qs\250\245\377'\373"
+	.ascii	"\250\327r\036\202\337s\364!\331\270*\234\3452\361\003\333D\311"
+	.ascii	"\350\220\301J\362d\316[\332\263k\016\241\036\300S\235%\326?w"
+	.ascii	"\314\024\223A\217\344\373~\n\035\027U\203\300/\3606\205\313A"
+	.ascii	"\375\307\372\231X~d\334z\275\343\204\342;\206\313v\2078\2473"
+	.ascii	"\r\350S\275\323\027?\326\337\030\017-\362\266x,\263Iy1\371]\350"
+	.ascii	"\336\241P\377B\325\355\013\252\337|U\373Y\356\327\236\223wd\233"
+	.ascii	"\347\274\341\303:jl o\360/\025\320c\320X]\341\310\327\227\255"
+	.text
+	.section	.gnu.lto_.symtab.8bb53a7788f6fc85,"e",@progbits
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8bb53a7788f6fc85,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
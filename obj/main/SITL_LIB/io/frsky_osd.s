@@ -0,0 +1,2473 @@
+	.file	"frsky_osd.c"
+	.section	.gnu.lto_.profile.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\027\005\005\030"
+	.string	"\364\"\013\006"
+	.string	"@"
+	.string	"\311\323\267\232\006J\002"
+	.string	"\002\001\002\002\003\003"
+	.string	"\002\001\001\240\342\234\212\n\002\202\313\257\254\016\b\004\003\245\203\376\302\017\022\002\002\005\005\004\265\323\366\226\003\020\006\002\006\005\222\274\200\203\f\002\002\007\002\007\006\205\230\234\341\t\n\002\b\007\303\242\237\321\b"
+	.string	"\b\237\263\321\376\017*\002\002\002\t\001\003\002\t\n\013\002\013\002\f\r\t\342\254\223\235\t\016\n\246\214\362\003\016\003\002\002\001\013\330\262\206\224\004\004\f\373\207\245L\b\002\001\r\336\357\337\307\002\006\002\016\016\372\316\255\300\017\032\002\017\002\003\n\002\001\017\273\362\264\244\f\002\020\306\234\214\254\007\002\021\230\357\275\333\004"
+	.string	"\022\332\220\373\226\005\b\002\023\226\304\334\215\013\001\024\212\341\274\267\017\f\002\003\001\003\025\303\337\344\366\r\b\002\021\003\002\022\026\251\236\360\230\003\027\236\316\215\321\002\001\030\254\341\220\343\n\002\031\356\355\304\344\006\032\365\247\303\255\r\023\023\002\023\033\235\331\203\342\004\f\002\002\002\024\024\002\024\034\221\340\210\037\035\365\216\305\212\f\036\216\333\376-\037\204\242\213\245\003\004\002 \225\344\334\313\t\004\002!\251\240\264\362\t\b\002\016\002\025\002\002\025\"\342\305\201\360\005#\357\373\376\224\r$\361\335\271\311\013%\323\253\250\222\001&\205\201\330\356\016'\245\360\234\\\n\002\016\002\026\027\026\002\026(\223\312\344\345\b)\247\302\251\352\002"
+	.string	"*\230\254\336\331\f\030\003\002\030\002\002\002\030+\230\367\275\344\013\f\002\016\002\031\003\002\031\002\002\031\002\031,\237\352\337\244\007\032\002\002\032-\222\374\252\256\002\033\002\033\002\033.\237\240\365\325\b/\274\346\314N0\304\305\314\373\001\034\034\002\0341\367\310\362\232\n2\234\220\234\363\0073\360\257\277\260\0044\214\237\323\365\0065\276\212\273\364\b6\226\314\345\255\0037\355\264\317\242\0028\206\243\210\376\n9\232\352\222\345\002"
+	.string	":\202\261\365\221\005\016\002\035\002\036\036\002\036;\237\353\353\307\001\006\002\035\002\037\037\002\037<\302\216\275\330\007=\337\332\355\325\004"
+	.string	">\300\262\265\244\t"
+	.string	"?\366\311\255\311\005"
+	.string	""
+	.ascii	"j\250\361\254@\t\2246S%i\241\003\240\202#6\234\007\0210\261q"
+	.ascii	"\206\031\221\tf\024/\354\254\0016\220\241<\265\201\273\027\345"
+	.ascii	"\357?\244\244\352\232\025\357h\021\345\220\326b\226wR\210X/\330"
+	.ascii	"8@\370>\252\340\326Q\206{8\347\213\177\026Z\317\363\006[\204"
+	.ascii	"\274=\3440\217\342Q\034r\230\332@VO+\271\263\350\340\314\027"
+	.ascii	"\204\362?\001\031\246\351d\253\240F(\235\372\230`)^/5L \202:"
+	.ascii	"\242\377u-\236\351\027\310\331y\374_\332\374\033\345\263L5Y\t"
+	.ascii	"\235\314S\354[\223\313\002\201\215<\254\263p,\351!x\305g\355"
+	.ascii	"\202\220\265<\253 N[\222u\323A\377\222=i\277\001\255\177\336"
+	.ascii	"]\267\247W\352\267\337\271\236\032=#\207'\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`%\003\025\n"
+	.string	"\202\314#\"\360\330\2461\260\310&\262\211l\"\233\310V\254\022EQ\024EQ\3044Dj\377\377\337\215\354-wJ\001\356R-\373,\373ZQ\331\237\024\224\023\223\022\222\221\235\211\204\200\354\317\307\362\330WG\343\200\2246v\215\f\214\213\235YTP\354OH\354\021\373A<840,\254\302\325mH)\341\234N\204\363\3404\270\200``\005\336"
+	.string	"\351\004P\357,g\2632\315f0\021\364\270\354\272\225\275|kT\255[[\333\217\355{\372\357Z\256\224l\nd\250\220\224\215\323v\260\002\252\242z\022\200\325\030\206f\214(\026\225D\333\343v"
+	.ascii	"\017u\375 \245^o\\18\271\203\207\272?\2106\020\347L\006\350:"
+	.ascii	"\211E8\032\264\362\352\211\210\325\231\262\212%\211\317l\250"
+	.ascii	"\372\213\3700\223\320\0062z\007\307F\221\210\200G\004\025)}\340"
+	.ascii	"\262\274p\271\265\033\214\267\302\037x5\240\232Aa\203p'&F^\311"
+	.ascii	"\214\234\0032>A\370\236\212n\266\023\252H\036\232\212\205\027"
+	.ascii	"\256\tO|)4\356\304\021\251\264UHm\324J,\263\357\030!\346\035"
+	.ascii	"\032*\335\017\356^\303\324\036\271\303\020\262\270ytrP\254\255"
+	.ascii	"/1"
+	.text
+	.section	.gnu.lto_.inline.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\311\022\035+"
+	.string	"\246\362\255H\240\232M:\305GJ\017\270\020\233\244i\312\372\323?\267\247\"\270e\3219x \337\304\021\bt}\214:\360\n\207\3018~%\210\236\302\210Qx\0351"
+	.string	""
+	.string	"\200Q\303\342\372hR\266\217\0307\327Y[3b\t\331[\312\024\220"
+	.string	"\226"
+	.string	"\235"
+	.ascii	"%Y\316\323\37151\253\272{g;\214\355O\367\364C|\306j\311\216 "
+	.ascii	"\035/\357\367\304\214\361{\252\302\235\236,\367d\t \334\237\340"
+	.ascii	"$M=\320\030\300a\265\244\351'\234"
+	.string	"\237M\372\323\350\317\364LK\360\r04\264\360\353\251\217\273\273\305\337hJ\031\002$3\206\377)o\216w\377/\013\221\362\212\317/\n\236\002#\004I\316\371dI\243'\313\375w6\371<4\273\272\272\220\304\037\005+QeE\255\r\3767\005\247I:\203\345W\177\207\333\232\004\035b\334\026R\n\351\270-\302\311~\354\365G\241\351\024\324\232\242\257\265E\360\267\373\\k\207\3405R:j\354k\257_\205\370\207\305d\205\276\276\226\340#NA3\342s}\"\234\245\002\3670\357\323\233\367\261\340 w\253==\274?\274>\274\313\303\033\245\316S\031\347\251\242\254\213(\021\001\037\355_\233\210:V\301\377\344u\301D\344\341\243\357|\213\370\207\r\340o\303\307m\361\027\315\254\356~\375%\343\177>F\304N\260\230\244jF\274\345e\307\225m\305\223\345<\031\033B\005\265\240l\277\341\263YS\006\313\353\365?Q\370"
+	.ascii	"\377\356_\377k\260\256\"Idx\370j\262p\225\272\003\240\343}S\004"
+	.ascii	"\342=\357N\374\216};\021\210W\234\277F\023\206\325\326\227:i"
+	.ascii	"O\206\314\370\325L\260\222\2321Un>#\313\307V\306\262\2450J\200"
+	.ascii	"9t\370\233b\212\341\332\212\032p\331\337\363*K\213\016\235-U"
+	.ascii	"\200|\251\217-Y\376E\034\344\207\305t\343\232\361\343\202s\330"
+	.ascii	"\267\327\247#\345\355\336I\260SP\353\t\356\271\356\261?\214\270"
+	.ascii	"\021V\332 \256\354I\214\335\034\357\260\034\276a\3240\307\f\363"
+	.ascii	"\206\341\202\205\n\024&H\240\021 <h\016\251"
+	.string	"\bs\320\200A8\303\005\2247g/\005\034\224`7)\221\356\226\211@A?\013|v=\b|\224\307\203M\036\337\024y\274'\252S\220;`\340A[@\n\212G\227\327\tT(\335\035K\300;\253\272\233\026\0168Y\206<\362\326\211\023p\333\031b\366M\235\247\262\273o>\225\363?\200\230\265\223\321\3355\306\351\245\240\226\221\327mM/\240|\340\222\332\264I\222\363\032\255\271\336G\037#\371\020\003\024\337C\242S\246\354R\355\321w\201\001\201G\250\321X\247\214\b\211\210\244 I2\034\001\005\0041\347\240t7\022\200\304,\t\242\234AF)C(\020\231@B\td\342hA\2226\300\261\247w>\234}\223\372B\2465e\302\316\371o,\253\"\347\244bg\344\210\035`\216\270\351\030y8\357\034\2078\305j\230\271\245u\325\312\243\355L\235\346\030\364\210\3645\002\247r6i\235\025\024mI\023M\025\333"
+	.string	"\264%\273\202\026^\322Q\234\300\026\254\277\363\256\255p02\022?\334\2037\331\221fI=^\234\177\320\002\225\253\023\237\236\313\250\253\214\322\342c\345\324D>\tIG\310\364\202H\273\276\202\320\257\270\375e\371\246z\002\364\254?3\351i\343\230c\260\316\343"
+	.ascii	"gm\220{\270\323\023\246\205\002O\265`\260\002\f\352\305\274\017"
+	.ascii	"\246"
+	.string	"\3429pJX\211]\363K1C\245\274ECT|3\326Z\325\300\001q\243L\f\336x\250?#\033\020\3547~wx\365\246\203\032\024\221\352}\342\236*\220\304\253t\324\311\200\334\355\242\t\327]\320Ayn\274~\013/\\6\204\027\336\251,\247\357\201\214\213v!JDp5%O\n\0223\250\377\254\242\264qB\246m}`>\362\024\322\005\357\r\274ea\244\306\237\323B<\204L\007\004rU\372\017LC\223%\020\016Eoq7\256#c0\366\354\246\344D|\207(0\r@d[\222x\37545b\330O\244\2210a\360\245c@2?\343\207\277\0134\316\231\320\017\253L\006\255A+\247\356\367~A\375\214\004\355\270X\026\224\237\207\261\022\340-|U\313\345\305\216\002\341R\036V\022F\253\003\213180\230M\367\036J\354\322S\022\007\270\030\020\267\020\037(B\2704\2268\243\"\30368\377\247"
+	.ascii	"\312\ffq\212A\277E\313\037Q9h.\325tU:\336t\323\365eM\333\213"
+	.ascii	"S\315\341\n\361\021,\375f\373\324\374t#\026v\016\035\364\362"
+	.ascii	"\223\223\354\216\213\2678K\274\0276\330\360\032\362)\204\207"
+	.ascii	"\202L\274d\364\"\272\226\332\376\317\260\016\276f\344T\002S^"
+	.ascii	"\007\302\001\303KY\211\267\001\376\206[\0274\222\007\234g\337"
+	.ascii	"\377\256\0377$i\266k\301\265)\351\f\337\355\354C\310\332>{V\323"
+	.ascii	"\325\201\335\241(\232D\024\247M\302\266\225,\205\366\026Hc(\034"
+	.ascii	"\361{\244F\\\303w\303\226\321p\370\370\314\001\345\033Z\364\""
+	.ascii	"\307\2115q'\321!l\025m\251\017\350\316\240\312\3779\270\305\223"
+	.ascii	"LM\312ev\362j\0164*\236s\207\256\2621"
+	.text
+	.section	.gnu.lto_.jmpfuncs.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\306\0205$"
+	.string	"V\350\202D\020\315\2501\245\bh\237f\225\027\2421tc\277}\037\375\344"
+	.string	"\210 \333\221\235\001\025\006\306\264\356!\261\t`\005"
+	.string	""
+	.string	""
+	.string	"T\204\333\342#Cm\364A\322\235\002ck\f\354j\024\260\201\357%v\313-wJ)]"
+	.string	"o"
+	.string	"x"
+	.ascii	")\257\266=k\244\373\335nM|\331\333\026\267\333m\306r3\372\373"
+	.ascii	"\3646\270\353\n\362I\362\371}\302\330\346fv\215c\214\356\b\371"
+	.ascii	"i\317\f\362\356\004e\r\312\3337\313\226F\363\214\037;2\342\212"
+	.ascii	"\220o\023x\201|l\271\370}\306O\013\373\177}sl\347\343\254\216"
+	.ascii	"3\267o\013\323\322L\245^\314x\f\f\022\251\324\226\324Z8\307\207"
+	.ascii	" ?#\310\327\223\221y22O\t\2225A^&\223\311<)\310w\272\242\256"
+	.ascii	"\267v\305\352\206\343..J>9[@\0034\266\365\tr\333D\004\320\266"
+	.ascii	"#\247h\314\343,\004\302!\246\205ZC'\006\005\367\003w\276qOHw"
+	.ascii	"\2349\3304\026}\260\007\257V\263\231I\241\220P\353IS\233|*\007"
+	.ascii	"\277\177\336\224\272\217\202\362}\246T)\327\254R\201R\202\240"
+	.ascii	"o%(\224\212\344\343\343\244\300\351\004\216xx\210p8\035\035!"
+	.ascii	"\221\306\301a\002\262\261\261\372L&\224\206\306G32T\247\266\036"
+	.ascii	"\355\272\223\364'R\253\245\300\216\273\303g4\216K\262\331F\261"
+	.ascii	"\037dq\264\033\255\251\325h3< \017\310\306f\236\370!\330K (\310"
+	.ascii	"\263\202\374\337\340\177\350\365\t\016h\213Q\n\375\371\201\361"
+	.ascii	"\3619\320\323\023\032h}\007\346\341y\t\205\276\263\023\232L\f"
+	.ascii	"\272"
+	.string	"y_\b\037\347-\013\317\315\307\204\b\302{\376\013\337\371\206\267\254\216N\030\313\311\201\275\274\274\302\320%\026k\201\301X^\257\025\027\227\250\322\322\342\022\2410\013\213l\211D++\250\233-STTX.\027JW\"\266Z#\333\211I8\322L))\243\3573\366\333L</\262X\252\317\224w[\311\0327\003\201j\250\021y5#I\222B\226\315\301\005\204 \345\034\232\007\022\300!\242\f\343\030R\312\020E\002\221@$\230\021\211$H\220\256tH!y\241Rt\362\0240F\3438\323\263\262\020\037{\306\312\253\201O\365^\002\350\334\032\205\030\b\270\312\377\233\002Z\343y\303$\342`\254TUJ9\232\004\035zM\016\304\257\025\245*\353Pg\177\002\006\352U\250\224;\343N\225(u\346\235\254dNex\203\035x\035\3401\034\205\245\360\207)\t\312,\261\330L+\247\357\3035\274\240\036\241_\376@\236"
+	.string	"\216\201\006\377"
+	.string	"\33086\327!\340\247\034\230\3163\242\303c\177\317\024\243\260\320\320'o\256\230L\177\240\027I\n\362\3010\334<:\302\230j\361j\270\223b\220}\346%\205\333\333\004\336|\253\246/2%\221g0\327\243\027\216\177B\2144\316\231\301\002\205G\237\251\206F\004\311\373,\275\031[\355\275m\347\301xk\330\331"
+	.string	"\260\210\bl\234\021Z\275\340\335\333\2232]$\343\335\365>g\256v\226\017\310\335!*\347\201B,\225R\202m\213\327\355\230\025\321\260-\243Ko\312\021W\267\352\311\017l4o \232\302\244>\006\240 \025\246H*\211\273d@1v\223Q\373]j\370\244Brx~\2560\253\006\031D.\271\236\350\033\344\206\352\354%\205\032v\300F\233k+\221\342\230\024\270K:\330:\262\372\316\317\bv>\311P\332\330\331\365\315\341tdD\236\240\262\226th\026BQ{\245X\376\224\242}TpZ\331\357I\212\304\366p(\215\230^\317\211\316\031\251\017\222t\211\214\r\016\331w.\003[\"\344\370NI\002R\267\201k\210\315\244\n\312\306\274y\230\210\317ClH\013*\202>\250\342J7\350\322\245"
+	.ascii	"\340\211\307\353\222\317\235\360\271f\312\250\347\3622\376>\267"
+	.ascii	"A#1\311\022\016 \036\026w\312\t\3518\241\306\035\346\322\304"
+	.ascii	"\341\310\201\032ZW\001?\205\212]\363\023\272-\253\333,kq\346"
+	.ascii	"\377\324\250\255\242F\006\355\005s\333\252\324eQ\271m)\271\232"
+	.ascii	"\364\256\302\346\314Qh\200)\226\220\035f\255\021ey9e_3\001\004"
+	.ascii	"\334-x\022'\fl\367\240\362\266\211\365+\215\001\265\212x\005"
+	.ascii	"r\031\004kO\0050\241x\2441\256\2157\301\033\353\300`G\257\003"
+	.ascii	"\203^4BEj\367"
+	.text
+	.section	.gnu.lto_.pureconst.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\"\314#*@\315\264\006\257,\212\342\325r\206"
+	.string	"\036\3030\f\3030\fk\310o\311o\311o\311o\t\370[\370[\370[\370[\370[C\272\f\216\271\206g8\206_\270\205W8\205O\270\204G8\204?\270\20378\203/\270\202'8\202\037\270\201\0278\201\017\270\200\0078\200\277\334\345-g\371\312U\236\362\241\374\344&]IG\322\215t\"_\310A\376q\217w\234\343\306\306\247\361\214\017cvq\213\257\342\243\370\304%\036\361\351\0209\036f\rk\255u\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`[\002\035\n"
+	.ascii	"\302M.3`O\322\0300\f\303\024'B\301AQ\204\332\217\203A\240J\301"
+	.ascii	"\200\220k-nIG\020\275F:\202\b\254Q\330\371\344c\330G\304l#\331"
+	.ascii	"\204\354-e\n_)"
+	.string	"\237L\264\0265\224O\204{8o\233\\2\311\233G\0269d\220\265?\216k\366\310t$h9\336X\343\354\214\2611\276\330\342\212)\236\370Z\342\b\210\207\035\022\264\r\f\237\275\360\n\to\337~f\256\262\"lT\317\254\377\340\r.\370\334\243yG5\253\034\230\302^Zbv\227e\030Z\371\t\004<\200\006\206\336M\303\250\271D\255\313FK0\326\356\355t\232\362\223\243\371\246J\240\252\271i\336\271zw\022X\250`\f#J\032\003\360\202\031*\316\001\020H3\3026\205\345\200\210\362\227i\312:\302\b\275\325A\245\330\275\2127\340Y\"\261\341erF\223\017]}\372\237@!.S\233\327\020]\350k\t\024\211\1776\236$y\301F\001\254j\363\321\312wQ\264\261Ve\350\341\371j5\270\\A\354E\021\345\\\350\002.\344C1\374f\220haK7\233\237\316E;\033d\306\222\242\037T.\034\201"
+	.ascii	"`\210@\220!\2713\363H"
+	.text
+	.section	.gnu.lto_.lto.72b45c4435c3dfbd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_frskyOsdProcessCommandU8.20.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\311\001\275\020"
+	.string	"&`qF\340\322&\035\2235z\2468\3258[\314\364\022#\037\211\302\223\0250pI%\376*)H\035.\260r\2378\366=OW2F\027<\013\374`\231\034C\b7\224%\250\270(~\236\026\375\177\353\335\322\032\331{K\231R_"
+	.string	"W"
+	.string	"Z"
+	.string	"V\331@\376\345\314l\305\211\226\017\2219\247\266*\274\252\272\2140[U\371&\260X\347\255.G<\302\004=\204b\240\274\032hR\"\305\215\363\\m<\226B\001.p\236\301\214u\303\002\345\321\300\224#\243\240\223\327\322=\317\241\fX\216\316\303\271f\020\346\234\326\316\023q\227n\273\3066\212\255\246\366\267\322\224\234##\257\313\376\316\217\372\367\217Hu\266j)\325\021\252\341\2527\252\025\252O2@\210G\204\2379obH\223(\006\265\260\375\223\315\240\201\352_\214wN\023H'W\3733NC\365\035\231\223\314\351\032\002\232\363;\361\202\322\243\277\033\220\217\245\023\220\217\001\013\327VY\321w.a\301l\3005ydw\001\300\206ZI3\032\203\373\362\277?;X^\266.\177\223\272Z\324\363\203F\217\034@\277v\006\026}\247\373"
+	.ascii	"\005\315\256l\267\334\247Ci\316\351\300\357y\r\027_\347\321\334"
+	.ascii	"\213\276{\221\217_\023\f\035Evf4v8\347\234\273\257\333\267\324"
+	.ascii	"\266\336P,\300p*\037Z`R\0304\216E\323\300\262\342\242m)\030\r"
+	.ascii	"\005\201\271\r\027R\032\007\216Ki\247o~]\022\206\210f\026\204"
+	.ascii	"\314v\304\307\207tB\n\350\256\\{\002\005}\227m\tkW\216+W}ZI\307"
+	.ascii	"Q!\246\244\023\327\003,\210\r\t\005!\200\210\342\276|\031\211"
+	.ascii	"\332\003\257\027=E$\272\001\" \200\202\221\262\365\342\300\352"
+	.ascii	"\rz\255\204\352\355\332\360U\260\315\0212\314%m=\334\362\206"
+	.ascii	"\r\323-\216 \2055\237\033\223\021w\366\355\255\252IC\026m\005"
+	.ascii	"\026\345\"C\277\206b\004\226\253\233\033p\224zon%IxS\313\030"
+	.ascii	"?\302t\0312"
+	.text
+	.section	.gnu.lto_frskyOsdSendCommand.21.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`'\005- "
+	.string	"\006;\316H\220\230Nc\202\327\026\3277\227Oi\310\036\214#^7]\032\273\002}M\244\027\001\211x"
+	.string	"tR\023\021\n[\024\302>B\265!iB4\001bF #\021\020[\252\0170\203\3348\364\\\303\364A(\222\275\367\336R\246\024\267"
+	.string	"\247"
+	.string	"\276"
+	.ascii	"\227\310tS*\261\205v/\262\301MK\260\313\034F7\001\356\020\013"
+	.ascii	"\212\307V\373W\307\021<\322R.s\257\324\332\016\362\002\316\233"
+	.ascii	"\351i\316\233\256\325\206\300\023\374\r\240\355\275\306!_\367"
+	.ascii	"\"w\274 \275\351\240\035\345\310\251\213R\325H\322q\345\336\233"
+	.ascii	"\263-\202\265D\336i\r\376\226\242gik\320G}\020pY)6\035\375V\242"
+	.ascii	"$\226\252\216\204\351\251\354YC\363q\260\244\232\036`\341\224"
+	.ascii	"\342(\352\003v\223*9e\205S\212\237(^\226\f\320\300\252\bX\252"
+	.ascii	"*\336kXmL\023\261\324\271\367>\371\252\324$\254\025\365\271\367"
+	.ascii	"\272\026\233\234n\227\333~a\373\202m\036\bH\265\315F\n\253=\332"
+	.ascii	"\357\231ZC\263\225\262\237u\347\340\034\371\337\374\306os\255"
+	.ascii	"\273\346[\367\314s\3742\377\272c\236u\303\244\325/\265\032\227"
+	.ascii	"V\273\244\325\267Z\235\246\325hZ}\242\325&Z]\246\325\026\255"
+	.ascii	"\256h\365\013\320D"
+	.string	"\035\261 v\357R\233\226k\304\364\001\343_\177\326\257\365o\275\264o\237\313\0073\356\313\250H\225\264\360\256{\3318\377\316\345\262L\310\275\027\367\263q7\353u\274\307\223\306m9Lg\030\340\016\251l\304\250\220\3568\217\340\265\034\226\0361\245;\250\254\320\356\275\023\322\233:\345i\316\254\242\007WH\265\315Z\036b$\232P\033k\033\304\315\200\004z\354\fg\242\301\306l\311\016F\tO\223\250\323\246\326dK\332\202\332$H\216\274\230\006<O\213Z\223\215h\024\222\001w\306v\t\212\234\226\b\013)\243\325\325)S}\257\r?\365E[{t;Z\031K{\364\201\247\265\367\372M09\232\222\344lX\327rNX\321\260\366Xcg\354\3151\013\026\331\260\256\331\2645\245=\362D\247iM(\304\030\326\226\366\006\272\030\220\202\231\255{\220]\204\251{o\004 \017\343\371.n\332\203P}Q\350\274i-"
+	.string	"52,W\325\316\330w\375D\347m\265'\032\205\265\3152\366\326\227,K\332\022<^\r\322\371xED:_*\244\363Y_\210!\253\033\301\373\225A?\275\017\"~\206\320 ! k \007A\277\336\006\021\036~>\016\271\036/\007\202\367#\224\003\362\375r\016\006\2707\244\363\345B\364z\276\034\016\211t+\225|\372C\205\021$+\274\331\243og(\2165\241N+\035\354.T\236\256\320\034\373\344o2\236\252\316\033\013c\225dl\214}\032V\221a]{y\357\275\351\203\303\330\234\031B\2433\306\342\330Gq\225\021\215/\035n\005h\240\212\206\034*;"
+	.string	"jl\305\264\247\005aH]\370E\347\315\027\213v)A\335,\316\236c.h\300\234\224\235\202(e\277Y\027{\216=\001\346\234\354\024\234\335\354\301\336@mI\215_\250A(\244\021\244\f#B3\"\"I\322\030\260\002\031\261\"7\021p\265CdbRm\007\261\300\267\\\0379Gd6qT\3221\345\352\207\245`6\215I\301\211%\2160\377"
+	.ascii	"\333H\027\222v\202L\337\210\025\237B\354F}\374\225\310\2508\264"
+	.ascii	"3\236y%\006\bP\240r3[\327B8>\025LNF\016\326K\210\377\030\027"
+	.ascii	"$\253\346m\321\030\203\252]\030o|\021T\034m&G.4\324j\235\264"
+	.ascii	"\357\263\246\322\202\275\203lq\375\373\367-\377\236R\232\372"
+	.ascii	"p\213\1774\270\235\224f\3053\300\360'\2716\035j\305\275$\251"
+	.ascii	"\326`\305\r`\341\330\200u\302W\376y\016FV\241}\342\214d\214]"
+	.ascii	"\257\276\023\035\347\346\330\024\252\006"
+	.text
+	.section	.gnu.lto_frskyOsdUpdateReceiveBuffer.23.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\024\017\225;"
+	.ascii	"\332[\234\024GP\\V\007\177\327\360\201i\320\214A\035\262\f~\b"
+	.string	"\375\250\006\320\024\307\007H\020\024\365\032\340#f\317\033_\230^\327\261\022\317\250R{\033\222V\250*\223\247\"K\247\261\310\201 \204\324\"J\327u\263{\357-eJ\0018\001 \001:\001\356\253]\273\332\277\002\362+\f\007\274y\266\332\356\315oo\026\257\267~\326F\024)h\330\264-_\363<\227\275Y\213\277:0\n[^\013\377'O\346\342\257\376\222\221\316\363,|1\3771\005\f\240\336*\377f#qv+\317n\236\257\t\376\365\241\337\277\356.\334\205\377\276B\207rO\363\327\352\034o\3219\243\344\315\363\254\334B\034\251\241\376\2104\362\354\350\344\340\024\211Ca\020\370\213\341\327\335\032\312_\267\305=\243\315?\2721\225U\221\207\203\026q\037\350\331e\371\260\3271\242R\032Yu\345\365F6;1-\017\331\177t\207\310\020\255\223\343\"\250j\234\230B1\231u5}b\217\251\036b\205pP\036\356"
+	.string	"$\320\035:\350\002\301A\273\334\002H\240:4p\354]']\354\304\264\277\354\023\230r\025\323\306\017\007\225\n\243N\r\307[[5YW]\377\272\3060@\320\024\243T.\202)[\215\037\373$\022h\227v\267||\0264GU0:\005\007\323\206\244y2\013\332\005\357\017{\fsuj\262\256\274^\307\024\346yv\375\214^\275\373\274\373Wqw\004\356E\235b\n\254\366\276\304\233\352d\\B\326~\250\026\2057\365exN\026 '\3074V\343\200f\333\257\273\237\271\034a\257\320\313pr\037\020RWffJ\353\371\253=\317\335[S\3639\025\355\215\033\356\246\276\030\3771\256\365\315?\314\366j\363\007\243\255\274\370\177\371\030/\214\314X\\\374\273x\232\337<7\177\352\037"
+	.string	"\376\327\365s\206\241g$\315\177\252\237\363\320\002,\247\356s\367\245\327\";\250:\323ga\026\311\375\213Eo\342\230=m\216\376\355\016\242I\3773\271\007L\355\246\273\213x+,~\363<7\360G\373*$\374\271\376\365\022&\364?M\300\377\376\376\261/\260e\017\314\032\245\267\373\214\013Uto\252\373UJ\377\203\252^\237o-\367W\2732\326n\364j/z\353{Rk\007"
+	.ascii	"\324\036\344j\007z\265\377\304\332}b\355\310W\373\021\326n|\265"
+	.ascii	"\367\300\332y`\355;\257v\235W{\316\253\035\347\247\275\370j'"
+	.ascii	"\306\332\207\260v!\254=\370j\007\302\332\177\261\366\030\326"
+	.ascii	"\016\277\332_X{Z\230\243\356\215\270\265\206P\3164\331\210\031"
+	.ascii	"\036\351&L\364\022$\235DF\242\217h\223\264\327\262\210\356R\322"
+	.ascii	"D\206\350-\254/i!Xg\322A4\025{L\342v\025\316\277\204\207\233"
+	.ascii	"\210\013\257\f\314\224\326#\212\033k\006\235\340\342\376\254"
+	.ascii	"2\267\344.\356\016kn\316>\342\376!c\371\210_\206\201\233\270"
+	.ascii	"\377k\215K\325t\270y,w\350x\2561\332\361\036"
+	.string	"\366\3609k\b\267\321v\035\334\277-\3340]\325\036p\007\367#i\251\374hU\034\314\tr\372\306~\264\255\3753\322ms\266k\247T*I\323X^1\215:\272_\2645k\321\266\232!c\210\212&\025\227]\023\244\335\ro\177)\0326\350\177\026\355\227\362?\273\355\233\326\216j7\375\335\360v\3118\373\\I?\345\307\302`Jx\361\356\307\316Y\223\333\335/];s\366\261\375P\315\007Pk*=\3054j\251\261\327h\\J\246b\277#\335\224\365\274\325:Cz\276=&\361\315\3312\351\363\226xn\356\260yo\367\237u\245\277c\263&\326\302~\335\371\313\360g}\351\353\344c\326\231>\r\223H\367\331\327bZ\\\323M\357MF!T8}haB\305\323\b\245S\t%\212\022 N(\233\236T(\215\200\334)\205\210'\345\n'\247'\245\360\032\365`oQ[\312\356\b\365\004\016\332\332\315"
+	.ascii	"\r\264\335+X\320\377\f\332\020\260\364\226\305\257\017h\177\330"
+	.ascii	"\017\215\301\373w\221\233\272\345\235\302;\215\357\033=m\021"
+	.ascii	"%S1\236#\215\347\246\r\222f#\257Q\223\244\353\226i\350\224\364"
+	.ascii	"\0313sd\276\244\343\310\234I\227\321d\310v\222\373\307\214\030"
+	.ascii	"\331@\025\216\031@.\314\317\006\222q\323Z\341~\250\306\247\363"
+	.ascii	"\344\335d!0Ld\233\220\252-/gS\335g#\347\276,#xa*\327|v\2049\353"
+	.ascii	"q#\271\310BjLd\332q\003m\264\201)\265d\301\302V\306\263\215\333"
+	.ascii	"\337L\271\337\254g\033\255TA\353\341\331/\375r\305\331\347\356"
+	.ascii	"\036tV.\360"
+	.string	"\300\375\202\236\222A\200\024\246\361L\302\234\024g\357l\230\317\331\247\263\243\310\f\314\230Deo\346q\266\316\206\371\252\246RG\232Lfpe\022\215\341l\342\02260\253\333\017\325\334p6\3255\321}\031\026>\207\373e\030\300\216\341\016`\207\311BrN\230\310*\2304Jo\335\342\246\006\2016\250q8\350\234#4\"\242 I\n\222\326\261\005\204\030\351\224Y\007\021\300$\245\030R\fUM\2224\007\361\261>\256)a\324\023(\310\242\267in\251\037\257#X\020\322^\331\23700\275JB\\\241a\322\315I\371\003t\223\353\264\013\262\023\224 \337\037(\352#75\333\355\371\241\222\343\366|PI\307\351\321h6\220L\206~\250\332G@\r\205\257\323wU\215\372t\250\203\021\033\315\224\310\231\304\240\003\004v\367\252cm\352\273\363\227GH\354)\022\002\332A\210\245\263\305\007y\035\030\331-BA\027\237"
+	.string	"\372{ #\334\345\307\007^\265\031\233ih`1\005\202\001\005\2627w \312\352\323\225do8\263\3668L\032\235@[\266\217;\373/\200tD\2674\357\357\321\234\375\247a%\r`\374\216\273\206>Cc\262\224XO\367\270H\037\331\007\273\335\236/I@\227\313\274\373\360>\230\267\323#\313\007\321%\375\243\241j\037A]:N\003\207Q\213v\220\260}"
+	.ascii	"\235\020\234k\251\351\023a\032\313HJ\333\342\213\270M\375-@8"
+	.ascii	"o\363\322_H\3761\0231^sM\215.!\007\244 \031\332\342\223\230b"
+	.ascii	"8]\013T4\202\374eA@0\200r:k\033\252e\271,Y\177\023\354a\270k"
+	.ascii	"N\244J4\034\026E\346\034p\347\220\311\237\305\315\232\371\223"
+	.ascii	"\260\207\226\007:\b\272\374m\251\342\374b\232\254[\370\203\n"
+	.ascii	"<o\245\340\356\027\305\025gG?\277\316\370\fs\363<;`w\246\036"
+	.ascii	"\346\356\373\241\204C\267\221\272N\207\026H\221\321\025\206\242"
+	.ascii	"\363\373\355\303\367\267\017\337\356?\200rO=eQ\261\004\233\001"
+	.ascii	"\205C\036\230\022\270\003\303\205\251\n\304\001\303[H\037V=\303"
+	.ascii	"\201\002y\b\254ih\250^'\343Ido=\034\213\034hJB@\030K\366;\231"
+	.ascii	"\314\262S|)\206\373'\361j?\034\352\003\312\273h<2\324\2100\177"
+	.ascii	"\342JJ\325M\307\214KL\334\306=\257\215\353\3521\006\330\br\030"
+	.ascii	"\tc?\231\241\304P~b$\304~\271g\006o\306`mt\340\"H\024\030K\263"
+	.ascii	"7\2113S\233\376\257\261\245\364\246\354\373\003"
+	.text
+	.section	.gnu.lto_frskyOsdHandleCommand.25.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`%\n\0252"
+	.string	"\272S\200\022CPdR\007'\254\301\257^\035\255^v\302G\032\216\306{\341\313fP\312\342\235 \001\020\315\n1\255y\207\026\357i\274\237wDi\210\n\b\001C\001\306\336"
+	.string	"\334\217\350b\277\332Zkw\223\275\267L)\005\023\001\f\001\032\001su\276\346lRn\246\221\272dY\226\345\234=M\252;\330\243;\350+\356\236\352\016v\267Z\306G3\003\206\372\230)'\323z\006\212\262\361LHR\353kC\333\377n/s\263)\177\006i7\347\2579p9C\223\032\251\365u\201\033\261\276\252.\200\365\265\273\373B\206\251~\035\332\334\372i\341e\241\r\312\031J\304R\374\365\"\242\241\2410\bt\333\037\273\252\370\337v`\222\312\213\274\252\351D-\370\224)\223~q1}H5\332\302r\\\252\022\366\322\004\032\252\024\3248\003;d\023U\200\262-*\374-\301y\0033ke\316/.\246\007\031|qu9P=\002cJ\335\016\311D]"
+	.ascii	"\247.\313\331\272\336e*\277\265C."
+	.string	"\371e\261CI\254u\315\337H\362J]\220s\366-\310\346\253\252\203:9\245\333!\233j\002&\025<\216\346\f\266 \231\217\231^F`\322\212\025F\307\230\370\027\262\271\376o)\347\334\177Lry\003\360n\177\321\335\034\272\335\254\007\332\242c\354\030gb\035\373\327\231\036\343\363Qp<L\n\2329\0337t\303\360h\2146g\243\322\235\025M\004\356\2548\261\276:\376\245\2459\343\252~\212A\331\026]\213\232\\\240\234\321\271\361'1uR\325}\260\003p\004\261:gr\214\317\327\316\306\335\254n\320\036\325\367utL\351\206\353\332\351t\236\322\335\322\013\323\265\313y\274\2657\355p|\216\223\271\3666\235\327z\020\326\327\026E\226\263W\366E\256\273\363\016\220\021\242\362e\336\0373\222\257\001\260\2439\01338\351\036\326\027\352\206Z=\016\353v<\235N\365\032\203u\003\277\217\234\214\273\221\227q\037\340O\367"
+	.ascii	"\375M4\374\036\022~\017\201\337\302\340w\260\277\201\300o\027"
+	.ascii	"\370\335\272\337?\367\233u\277W\367[u\277\261\373\375\356\267"
+	.string	"7\320`e\351Ue\017\306\003\315[SB\271n\215\023\353nw4\036\267\303\323t\n;o\016W\344R\354\336\321\255\346m=\374L\343'\001\257\224\367ccL\345k]J \004\366\b;\233\377\222\"O*?u\362\264ax\260\227\002\241\3159k\350\017\373()\332\333~\315\233\017\353k\321\021\3666GJ\242\225-\315\340\334_\366\311[\240\351\304%\223\033\364\247\352\247\215\225mQ\327_\026\210\375\235\362M\336\326\013\210\327@oR\267\3123Q.Q\262\242]y$\257\323\305\301\350[+\366G^-\016\336\261\347z\273$\221}^\336\310\353lq\220\r\032\351/\314\023\321:\016\341\363\232}\326\017\007\311\3208Y\334\375\212\371+\023\n\232\037\336\b\342\304[}\225*\027\3423\213\203XnR\021^\250\217\320\b\347[\261\233\346\346|V\375\264U\334M\302\007\231(p\327}\302\005\2450j\346\234\225"
+	.string	"y \025\335,\\\274\037]"
+	.ascii	":\366\351\027\356\207\251Uq\t.v\226fOvL\351\326\2569\023\213"
+	.ascii	"\2610\317\367\230\374M\317\325\356\274\345X_1\366\267)\377Ss"
+	.ascii	"&\366\361?\223\034\217I\351N\017\261\371X)\217\007O@\240\244"
+	.ascii	"T\031M\305\033?\232t\374d\340p\302\355TA\206T1\306\017\033RQ"
+	.ascii	"3\210E(b\016\250&\034D\247()b\005\004]\324\361\024E\344Q,F\021"
+	.ascii	"\203\320*W3\006\353\377\255\370\207\302_\372\263k\236\264\245"
+	.ascii	"\246\246\376\222\004\036\237\332\033\321\1779\021\326\352n\""
+	.ascii	"\374\330\252}\215\373\367\2519\347\\\204\303\346x/\271{\226\253"
+	.ascii	">}DK\337Po8\354\020\017\341\356\227\352\265\352\340\344\241O"
+	.ascii	"W/\346\315j\307j\274C"
+	.string	"\206\360\n\350\230\344\315hh\360c\367\253\365eo\021\017C\354q\366L\217I\252~\332B\334\375n=\230W\313\203;\347\333\365\305-\371d\257\363\273\254x\217\264/\022\326W!\016F\243\316g\0015t\332\f\341\260\036\223\241\357\214\316\370|\2556w\205\034B\261\301<J^\013\024\005\345gy\273\304\202\330\325\370\004,:\3513\216;\232\267w\346\220R\241\205o\367\301\266\267\036;\241=\356e\276O<\316Y\bBJ\367\2600U\260\302\267\263\275a\001\200\326\250q8\004\225sfDd$I\222e\f\240\002\231!*n\003\021P5SN\215\266\311p{\260\016\233[4\031\355\350\276\017\213\277\304S\365\b\340S,!\002\337\370\177\022d\373\177\0258a\207$\262\302P\232}0\262\035sl\213yV\320\223\376MA\224\b\352\031TsA\230\254\264\340*\235F\230\322\324\242\345O\351U/\203GK1"
+	.string	"\245\360/&s\220\371H \026|9\325\025\254YT\003\301omS\242\3509\266\357\324>\n\377^v3\224K\t5\031\022\335\023\301\266\222-\336\317\246X\317d\324\025\201\357H\344\214\335o\305\262%\244\026l=h\221\344^\006\205\354\312s\024\242\266\247\235\230\313\221\254'\212\202\347\024G\005i\3758y\344\254_\004/=\016RW\267{\357\350\245w6\232Q\310\360"
+	.string	"\bq\224\370W\256f\211E\030\300\376B\336\2458\t\207@\262\266d\253L\205\325\270BG\200L\203<\375\300\267\332-\276\210H\221+c\375/\305T\360\216\22202\023_\357\013\201\204{\370\332v\276\306\236\007\b\361\322\352M\374\343P\357S\207\026M<\365\022\254`B\023\030d"
+	.string	">\306'm\020t~\251m\327\277\354\032(\266\352\002\317\227\361\342Ae*\235\363\3525\300\013\247\375\315*\013\243\001\020\345P"
+	.ascii	"\206\023w\003\365\231\305\362\"\271\215\237!\321\321\327\036"
+	.ascii	"\235\223C#\233]\212\025\336s\361/:el\233:\026\231\300\265Q\""
+	.ascii	"UJ\201\341=\261I\306\363\f\3543j"
+	.text
+	.section	.gnu.lto_frskyOsdDispatchResponse.26.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`P\003\305\026"
+	.string	"V*\224I\300\324Qch\306\224\200\247D:\212\377j\371\004f\210\335z\243\215\234\017];\366\021\023#@\256\253\346\345\361\231}\031'\261\0174\243v\311\214/\216\243\371p\024\202)mS\342\335\177\320\001Lh\017m\203\244m\271\245L)\177"
+	.string	"q"
+	.string	"\204"
+	.string	"'\372\n\235\233Vr\361\230\b\204f\351\273\367.`\335\272~2\336\2127\031o_\326\\;\346\315\251\b\217J\224['`\335Z\245\201\216k7{\271\325\007(\037\026T\367\232\257j\342\265[\261\322\232\277b\371]\364Q\rq\272\235\333"
+	.string	"\272\233\350\272\367\376\354@E\226\210WQA\024\r#?OA\350n\342I\016\005\356\277\323\037\035\017\245+\226{\257)N\027\342\036o\033f\333\201]{\001w\245\305]\324\370A\267\226\335\320\343n\306\333W\f*\230vCD6:\264\315\033\255@\366\305[y6\371\340]r\363n\275\274\255\251\305\221\272Zj*R_"
+	.ascii	"\004\246\035\t!\"\265\311\274\271!\222\313d\223R<\370\227\277"
+	.ascii	"\371j\337~\221\177\232\f\322(\b\235Vnt\240M:\347E\266\245oW\336"
+	.ascii	"{\311[;\307&o\251\255\343\017\375g\322\001\274\240]"
+	.string	"9ek\243X\r\224%\214L(\255?\272\r\027\3333\364\335k;\316Oz\215\f.G7\324x[\253\375\002C\217\023\253\253\247\356\270\244\326z\262\322\372\200\352Ly\253\222\265\202p\330\263\273]\306\221`\004\234\202~^f\274-\251?/&\t\205?#\336;\0225C\254@\257'\212\316\245Z\201\214\362V\275\021\321\257\310\217'\036z\304\257\255\372\030>I<s\0304\006=;\366\0274\007\234\356\r15\260:c\023\223\231\265hd\324\260\224\030\034\331\013\215\006g\246\341%\213\275lb05/\330\f\347\225R\300\262\r2\263\027\007\231l\366\"M\333+\317?\037!\347\301\007I\374k\343(T\345\203T\257t[\177l\333\372\337YRRQUQ\266z\233\371\020\332\223\020\336)\341MA\200\264\200g\313\204\373h\351\3014\025\244z\216\037h\013\347\261C\307\212\027\364M\331h\343\201\276\360%\332"
+	.string	"\240c\307A\003\240w\243\006xZ\006; \260\002\231!\253\003m\243\340)4\247e\350Z9\033\214C\330\341\334\314\335\203!\235_\350\027\035\237\007C;O+s\202\307\375\227\005\t\201f\030\334d\213V[PY;\225\356p\341\005\343\374\322\306\324Np1v\3400\266&\235\r\033N\270\376I\330EQ\244\321K\020M\3603oKlVo\302Zw\242OG&%\034\253\271n%\266\023E\342z\020"
+	.ascii	"9\321\001#\n;\302bst\327\032x\260\f\005"
+	.text
+	.section	.gnu.lto_frskyOsdClearReceiveBuffer.27.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\204\002\255\021"
+	.string	"\346]nH\360\316\2521@\230\333B'\202\263o\"\t~\021~\324\330 \031F\236~N6\331\244\276\360\340\023\227\373*\206\312-UK\206\027\350\316\375\177\376\247\201\323.\262\025\312I\307\274e\246<Y\224xI`Cfo\271\245L)X"
+	.string	"S"
+	.string	"\\"
+	.ascii	"\226\206\254\262]\234\006\273a\254C\313\246w\357\025\353\207"
+	.ascii	"\253\016\332\257R\225/;\201\235\223\2037\317qc\355B\224*\267"
+	.ascii	"\033e\206\317\300\2757T\246\320\017@\251\362\372%H\351y\330("
+	.ascii	"Q>QPk\305e\247\032J\026\245\341\202{\257\251\253\344p\207\267"
+	.ascii	"}\262\215\300\246\273\364\256\021\360\326\326\237\247\263\230"
+	.ascii	"K\313\214\271\242"
+	.string	"3\fR\333\302\005z\227)N&\307\252'6\215E\353\213\375\357\326\227]\251m\245\276\310\203GG\322s\357\206\0312n\316\342\304l\337\247\375,\371\314a\t\226\022\37337M>s]\321\211\271\265M\354\320\003\346\351\354\005\3232\343\375\266\222\003\262#\370\212\201\246\205\035\362\021\343\001\230]\372\315\324!\342U\243\225#SYb\247\356\023@m\221\221\b\007\302>7\246K\255/\366#h\353e\037@\343s\276\330\261@\241A\376i\322m\243\007\354t\3515\023\307\317\275WA\315mN>\314\255\311\221\036}DH\221\020HL)\224\004\221,\211\023J\"'q\204J\211\037\005LR \241\304\n$\211\022C\264\325\353Kv\0060h1\200V\225\005\206|7\252\320\275l\r\336\203K\241Qc\363A\300\233vp\024 'xx\265\336\203\357\350\344\204\257Z\f\357$~\323\244\343\214\035?\246K7a\n"
+	.string	"\273\t7 \320\002\231\251\262\003\002\003~\222\306\350r \330\223\021\033\34025\256\203\351\332\234\303\211\343B\016]\354\r\366\020\365\301\230\271\303\301\374\3622g\224\253\210\331\004\267\037Se\350"
+	.string	"\206\314\004j\374\301\332\215;@\3121\003\226B^\231\035\177\212\307\356s"
+	.ascii	"\235X\266\306\327\245=\214E\323H\270\335\342h(\202\204\006_#"
+	.ascii	"\374\3532@&1\231\020\303\324%[\3735\004\006\005"
+	.text
+	.section	.gnu.lto_frskyOsdSendSyncCommand.29.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\254\003\345\032"
+	.string	"v\362\260F\220^Qc\f\002N\270"
+	.string	"\2357\377\352nJ/\343\022]\376\360\227BY\310XF\377c\006\303\332\253@\242jZ\223\273=\327\301\276\277\033\020\t\020\\ \006\b`=3\023PhL\212\357p\334\315\335\366\336R\246\024\237"
+	.string	"\216"
+	.string	"\241"
+	.ascii	"\346\272\200{\177t \240\237\221\037\313\367\220\037m\353\245"
+	.ascii	"p\266\367:eQ\271\027\205\340\006\345G\t\023\214\234;\032\225"
+	.ascii	"\004K\222\262\001\345\315\275(\315\nqi\230\315=V\302L\362\034"
+	.ascii	"E[s\276\3561-\245\246`\215Z\376X\312q\230\f\t\323M\035\017^A"
+	.ascii	"\022\245\246J\"-\345\370)Z\230b2\344ZJ;D[e\205u\372\220\352\370"
+	.ascii	"\340\027,\031\003,#\3641]\304q+:\350\252\342&\200\217'\316\222"
+	.ascii	"\214\364\236\276\336\360\355j\205a\270\367\272\366|K\367\316"
+	.ascii	"mo\261\255\301\2665\002\026\312\376\201\364L\224\355\3176\253"
+	.ascii	"gfu\317\257n\331\243\374<\257\372w\216\376\347\245~"
+	.string	"\323\325c\254Zt\265\215UW[\375\002\227\203\276Y\203\343\2727\351k\316\0053Z9\362\253\337\276?\345\251\355B\227\020c\363\245|h\237\206q\241-\026\2317\367\336\023\206}~\254\266\221\037\364i\373\352V\352\224J\253T\330u/\372\340\243/\220O\016\305\350Qn\242\354\362\2004\251P~L \216U1\b\310.\017\250C\202X\355S\335\211\321\321Co\270\027\034\202\250\2419\274K\207\001f\262f\366\303W\251#ONST\036v\2764\331\2554U\302\221\307V+\263o\203\344\264\253_\366\2516\210\020\365\275j\037|\f\t\234'8]\342S\0215\033\333\n2\264\307\221=V\005\020\r\257\306\361S\217\270\026\234\0013\251I<K\t\236\250{/\205+\307b\302/\362\321'P\324\367P\220\037{\354\3233\360\r\273\234\246\250du\307\236\366\326\376\001J\200du6\355-\r\240\215:G\365\313"
+	.ascii	"\252\315\242V\337\363\2037\275|\201\331Y\235\215\356jA.\204l"
+	.ascii	"Q\f\233\320P\255\b&4\243v\023\177\212~\202\304\240! k\240\bA"
+	.ascii	"7[\n\031-nD+h\266\032\315E\355g\210\006Dt\243E\360\261\355\205"
+	.ascii	"\020\021\255\310f#\242\235\350\321\355\317$\027\027\253\264|"
+	.ascii	"\230?\370\017\\\251UJ\3769r\2647\2541\034\331\335\220\230\205"
+	.ascii	"\262\314\212\366J\200Y\274\032G\264\001z0\375\342\275\367\226"
+	.ascii	"\024\264\270\020\201\025Xbsd\332\237\237#\255\255j\024T;\347"
+	.ascii	"$C}\317\332O=\355\254\356>Sxx\221\026\312\277\r\362\370a\235"
+	.ascii	"\366\347\3618r&`\313\313\207\327\326\231B\250A0\242\210D\206"
+	.ascii	"\221@h\202\021d\220\244\003p\002\221I\325\003\020X\311\264-\214"
+	.ascii	"\001\302hM\245\016\235^\032\201\177\367\bj\3636\003\270o\266"
+	.ascii	"Z\013\n\007\351d\272\302\003P8\233\206\347\324G2\257\332\367"
+	.ascii	"\351\266\300\355\003\005*'\271\035\3536\330\346$\035>g\373\220"
+	.ascii	"\266\020\330\211\343~\261\251 S\251\030\240++\202\b\272\204\217"
+	.ascii	"\f\343X\234\004\355\345\3409wA\337\220!\327\227\025\334#\344"
+	.ascii	"\315\243\ns\220\373)\217w\206\314xD\250\371+\344S\254P\003"
+	.text
+	.section	.gnu.lto_frskyOsdRequestInfo.31.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`U\002\325\023"
+	.string	"\266\244\202I\300\224Q:\350\230N\247\002\211T\354i\246\243\321H\225\256\037\331>\273\006[ue\025\033IT\276\366\215\205\272\361-\017k\317\313\243\207Z/M\230o\334\262(\212\005@U\246\274q\263\207\331\210\267\347\367G#{\223\275S\nj"
+	.string	"f"
+	.string	"q"
+	.ascii	"\3627\257|\241\017\311n\253I\315tRF9\212\364vq\nN\255\222:5\360"
+	.ascii	"\224z\372\035\245\236Zf\0339"
+	.string	"\356g\301 \"%tO\273\313\232,.{\245\337\2242\377\267\233\210\265\331\253\252\226\342\024\305?\022\273\0339\277\004=\035INj8_JN\013\361\267K\0235\232\224\340\204\335\265\024k'n\360\266]\266\035\330\022(v\bB^\2543\200\212$\036m\316l\034MN\037\373s\034\307\321\263\307\256\322\252\333\356J\245%\225\376I\201'!#\226vs\306\250\345\321\035A'\372m\227\366}\243\357f^d0\352\307\214?\343:{e\232\027y\356D\305\330\335\325q~\256\301\003\331\211b\251u\001\326\bj\352\355\"1H\235\3324\366\3524L;\263\274\307\005\036\252\371\335\021\324\216z<C6\024\371;\251\276\3509\f\035n<\036!q\301}]\206\026y\321\327\235\305I\007\252\2073g\376c5\367\003;NOHl\344\370\037%=\2449}\\\347\347KN\351F*\261\355r\0345)L6\314o\264"
+	.string	"\374\354.\004\033?\342\340\003\235\332\025#/\306\324\323O\n\303I\206\315F\2166\221\0012\241\013\366j\211"
+	.string	"gB\231i\230\025\r\260\260%\026\003{m`\205.\226\214\313\305\003\013\346\005c\255\fp\370\241\365b\205\b\303\027k\205\263\371\267\263\347\366T\020(\236\315\244}\273\2735\366\355\256\220\320#\222\243\345\004\242\324J\372t\342\021\220\3515\265N9\237\273\312\322\022\332\022\r\036\032\025 \375\035\205\ns\316\"\360\232^|\217U\325|\311\r\371\316\026\356#F . p\002\221A\304\007\362\320\020\007\234\312\034\\y\253KAk\267nI1\3161F\222Q`\271\007_p\033\002k|\212\202\036\241\340\236qR\277*\356r&\351P\2748m]\216\013\301U8T\260G$v\324&P \200\233\030\fFLX\341\030\213i\322Bi/\364\375\035K"
+	.ascii	"V\001\352H\\d\341\373\266\305\231\205\347N\006\030\n"
+	.text
+	.section	.gnu.lto_frskyOsdInit.32.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`D\005]\035"
+	.string	"\326\364\273J\220\232Q:\032JC\204@ha,\231\006%~\265\326.\266\221H\311\005\274\006\n\350/f!\362\013\325iv\024\325\177\366\325\024\277\223\345\310\022\221H \020\b\024\360\351\277j<\277\311\363\242sQ\332\241\252y\322\310&{'\031\237"
+	.string	"\237"
+	.string	"\256"
+	.string	"\263c\333-\324\377\365\254\277>\212\320\245\202\n\344\255|5\254g\364\225\363\032\341\270-\230\307\275\232\326v\337w'B\177\002\243e9\007\tV\311y\225\320\020\314c\006?P\036\2237P\036wwS\260 \324\350\327&\244?\265\221Ae\314y\245]\246\243/1y-\332\307\275|\360d\226\244!W\227\225\232\343\330\314q\222|\260#\311\325"
+	.ascii	"5%\021\200\231\0025Sc\330K.\340\312\202z\360\366HM\311\006J@"
+	.ascii	"\256\376\273-Rs\326\306pr\316mu\252\215w\354\335\355\323\335"
+	.ascii	"\031\2721Qf\316\351\205>\226\037\036\323\351\370\367\301\343"
+	.ascii	"\254$!\223'C\366h\325-#-\367\362:\250\214\335\213\233Z\362\023"
+	.ascii	"\223\3325\035\300\2229\277Vv\257\350\261\327\305\356\177?\022"
+	.ascii	"\"u\005\373J/\256{\315\331\313\353\376=\036\217\307\276\273\356"
+	.ascii	"\003\337\262K\275cm\333\232\266\217"
+	.string	"\340TNKJO\307\333\265f\244cX\326\302W\236\016\374\245\336\247\362!\213_5YF\013\213n\252\013\273g\375\342W\215\207\020_u\253nq)}\255L\025\227|9\347\331\247\372A\340\315\327K\3021[t\317^t\007F\276F\347\246\351\310\301\320'\002\304F{7\242J\324X\335\301\316\f\324\323\f\033]\362\"\312\004\315\207w\260\243\022\325\344gt\276\274v@\324\311\313\220\031#\233\002\346\240PN\314\351\002S\2542^\353\0276\206{\341\332\212\355\252\242\212\327)/l\r\357\242sC\024\366\206gq\020\320\224s\276\260\345\\:t{\370`\257\373P\036_x\353\3339-\371\212\375\205\210\203\b_\336/\017\035c\300\310\313\353\337J\331U`\304\204C\303uc\373!\312{\021e,\315\037Q\322\336'Q\336\312\177\273K\230\260\327\311.\001\254\314\243O\034k'@\266\363\207TQK\341sb"
+	.string	"\262\235?"
+	.ascii	"zx\200nA N\036\0245\027\263\336\231\200\342v\232\bZq\263\245"
+	.ascii	"\240\2355\232O\355D\017m\307v\243MH\320\347\017\217\215\006t"
+	.ascii	"\2366\332l\035:\231\357\256\377\273I\246W\0048$m\215?x\231S\357"
+	.ascii	"\007p\210\177\264\264\267\3506\316\320\315\2219\347\\^^wW\260"
+	.ascii	"\335\350\016\264\207\275\256\037\374\217\252nh\201}\345\216\226"
+	.ascii	">,\022z\204\213i\242d\367\2075\272\t(\302i\021L\t\210\2451C\006"
+	.ascii	"\221,\3652\206\021b\323\034\005<\233C\231\354\220\305\025\275"
+	.ascii	"\242\210\374\330\206\r\252$\f\313\2141^\250aD%\0254$\"\242@a"
+	.ascii	"\031I\007\340\"\241\262\315\001\020X6\001I\320\270\r\220\245"
+	.ascii	"&\330\345\024\243\324\243\2362\272\2657\370\204\325&\374U\177"
+	.ascii	"\035\350N\333\301:\2010\001m\f\3457D\021j\210\222Y\004\r\331"
+	.ascii	"T\237\205 \201\203d\021\3628\2531\354#\002\207\304\243Q[\241"
+	.ascii	"0\005\\\341\267\301\346{|\235\002\0163\356+/6,\361\256c#>s/\333"
+	.ascii	"\023\362\233\300\221\236\374P%B\333'E\311\303\026\237\032\372"
+	.ascii	"\305\303\037\202L\260\330\251\2627Ek\016\f<\353\233\246]\354"
+	.ascii	"\007\300\236-e\006\006\365\347m,\356OsV\210c\334\247\330\351"
+	.ascii	"L\244W2\254U"
+	.text
+	.section	.gnu.lto_frskyOsdIsReady.33.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"m\007"
+	.string	"\202N45@s\322\001\230\266\317y.4\351\274\211`\214\241GI\257\027\365\220\350\320\255!k\3633:{\234fe\256\204K\201\024\220\243\300I\314\001\254H\177\262\211\224)\005\376x&.\030\021\262\270\254\212\007A\017\003$q\361>\326\365<\007\206\031\024\326\323\200\320z\034mO\255\202\250\"\220\264d\277S]Uo\222)1|\345Z'`w\035|\226\267l\370$w\346\b\345\343]\276\3344\325\035\301\r\252\273\253"
+	.string	"\f)7[\033\245\206\330\247VAl\2475\323\247\006L:\262\307\232\335\323v\2633.\346\304\266\310\346x\241Ad\354\332\310\251"
+	.string	"\245\304\344b\263\253=\0259\366\304\374\253\034\342#n1\033=\001\036v\327\0313\217[o;\301\266\202\355\224\t"
+	.ascii	"2\241u\037x\304D8\254\302vML\031A\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_frskyOsdUpdate.34.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\025\t"
+	.string	"\266\320>: \005)\035\340\030 \b\026X\253\002y\222XL\247y!\rxLX1E\tgB\355\327\357\227\360\b\030D\271\205\032\001\003"
+	.string	"o\203\201\356O\023 -\264\207_7\262\245L)-"
+	.string	"-"
+	.string	"/"
+	.string	"\"7\035j\232|\001\357t\330\361\270\302\204\226\213\214\300K\301\202\231\353\343\257'\313Se\006\200v\327\271\362:n\355\266\027l#\330\226\005v,\225\032b_\277\357\373\254 \366\323\327\006\\\033\336Y2\273\034_\200\235\321`Jl\337c\223m\363\330\310\032\230\240h\264\334\354n\3244,/3u\211suX\251Q%"
+	.string	"\333\030W)uvW\301O9,\303'\271\346\021)\277\272\346\2238\327\256\177\035\302Z1'0T~\001\016}\036\272\215a$\321q\021q\023E\nQ\303D\fq]\374\034x\253\200\340\342\305\266q\321\023C\035\204\322\024\334\335\205\235\264-\272\374\312\252\247\f\016"
+	.ascii	"2\003\352\fO^\330\252\202\200+\200j\037\244\250\210\013\350\020"
+	.ascii	"\216\\\206~\031B\\\272\246\232\246\201)("
+	.text
+	.section	.gnu.lto_frskyOsdBeginTransaction.35.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`}\0015\017"
+	.string	"\326\333dF\360\320&\035P=\325\326\033%\006\307b\233\326\033\333\361\266\335Nfl\323\366\330\323\235\206\rA\272\0137!N\272\255\"r\231Z\347[\360\331\272\370X\034\226\236<\243\344\347\237\260\341\005\207\277\375m\333&[\312\224\002Q"
+	.string	"R"
+	.string	"M"
+	.ascii	"9vw\323\017G=\0245\250\211\362[>0\236\034/\365\320\353#\225\307"
+	.ascii	"z\f\225\304\036 F\307\223\343\261\256yx.0dw[\022\212XWX`\306"
+	.ascii	"\002\207\207\307\002AV\"T\277yZ\360\272\314P\311\356:U^\206["
+	.ascii	"t\333)\333#\366a\001\243\222\214\025\214\367\0133vW_\320\322"
+	.ascii	"\320Z\214\210]\026\"F\303Q\374\245r\227\325\223\231\210\251\331"
+	.ascii	"]\3225[\305&]K\222\355\247\375\232\237@\335\206\202G\273\035"
+	.ascii	"\202tv]#& \272\026r\220x\r\376#^3\312\356\271\213f\005\224\200"
+	.ascii	"\361\222\"3\027\020/\331\013Mgp\236Z!SI\036`v^r\247eE\002\306"
+	.ascii	"T\265#H\310\253\f5u\032\240\231\216Z$^\025\300l\260$\220\177"
+	.ascii	"\221\250z5\320\352\351j\310Z]~\266\253K\235\261\257\337\367}"
+	.ascii	"V\031\3736\277j:5\375\247\024\024\016\272D\262\340\304!\230\340"
+	.ascii	"\340dj\260q&\333\003\223\004'[\311t\332H\006\230Ca`\332R8\316"
+	.ascii	"\264\221\\+\207\25327\027\341l\230\375\314V\264\203\273\273\241"
+	.ascii	"\257\370U\034\300\353\365\344\020;\322?\211\276o\304\217\333"
+	.ascii	"E\364c\034\204\307~\300\007\303O# \220\002\031\303v\"B3\247\200"
+	.ascii	"\245\216\367\226X\266\307\245\312\350~\267\311\261,{\242\211"
+	.ascii	"y\350\303\244\335NX\250\025b\251\035\244\233\210\327\366\201"
+	.ascii	"\0358\212P\270+\321\234$\215m\020\237\246\003\204\212\263\334"
+	.ascii	"\355\t\016\342\r?/o\f\032\303\201\002"
+	.text
+	.section	.gnu.lto_frskyOsdCommitTransaction.36.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`P\002\r\023"
+	.string	"6ayI\320\362&\035R\t\220rv!b\250N\250`]\213\221\266\f\354\342\253%\326_\243\215,\260\331\325\201\2422\315(\364\251\264W\322\032\305$\320\301w\321\212f\220k\2616s\357\rF?\320\032\300\325:\372\021\215\220-eJ\001g"
+	.string	"\\"
+	.string	"h"
+	.string	"\2722\215}\343\266\241iB\304\213\345z\3149Y+t\232\253\300O\256\322\370!c\315U<\007%\212T\323\016\2211&KvH\310~\313\321\017\202O\016\007\2654\362\\J\224\237\247Y\211\f\0216V\343\215\256D\020\004\304\023\031qd\002\247\030\261\037]uF\230\252Je\316i\225\215\036n"
+	.ascii	"\267=c\233\201\255@\001J\031\374\021\377\374\212\321\313b\300"
+	.ascii	"\177\337\037]\346\350\351\031\325l\264g\333`\2724\373"
+	.string	"rn\220\275j\220U\253\244ZJ\365J\265\256\372\001\n\350`3\224\210\246\026\3126wz>f\214oW\302\366}\333o2G\362uH? d\354'\2756s$\207\370\234(\232s\256\376\255\376\0059[\263B5CP\337\322B0E\270k\372\314'W\244\303-~\260\370 \227\346\r\240\\\027\256\306\256\256\334\307f\003v/\340!\250Z]\223\027\261\035L{\r\256\013\025<\260_\316d\341@\324\222X\202B\265\237\365\364x;\305\2011\215\366!\370m\301\321\270\321)\333\255\233\bO\242l\230\347\304\221\2419\247\003\334\003vI\241\360\022W8\204/W\005\226\330b]h\261\300\260\\\\/V\212\001\213\030^\\,\r\242\350b\255l6\337 \253\330,LE@\375\233\204\t{\035\246\251\020\340\322T\034d[~s\353O\341I\324\3150w\022G\\\200\354o_0\352\244~\222H\324_\001}\343"
+	.ascii	"I\356\025\240_cq\321\313\374\332#\360\350\300\223\n4 `\002\231"
+	.ascii	"\252\343\003\342\200\325C\256.y\273W\2446\376u\tu\034\254\237"
+	.ascii	"\230\303\266k\032\027w\351I\226\274\246\307\237\033\253Y\030"
+	.ascii	"\tF\326\361`\023$\254\367$E\334\225\333\331\256\274\r3V\314\366"
+	.ascii	"\350\255\240\230Up4\204\266\344\374\032_@\323\313\236M\314\255"
+	.ascii	"\002\275\204\2031\035d{\320JAr\212\310BB\261\350\350\241\335"
+	.ascii	"0\367\036\205\306]\341\341j^\315\262\360\036"
+	.text
+	.section	.gnu.lto_frskyOsdFlushSendBuffer.37.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\245\t"
+	.string	"\206\221B< \005)\035\340\334&\016\340\320\033$X,i@\244\277S\350\370O\016\344\361\006c\305:\333\377\231&\341\021\261\260\251\313\267|"
+	.string	"\003b\024p\344\255C\235\b\f\035\324\2535B\344N)/"
+	.string	"1"
+	.string	"1"
+	.string	"\032~\323\031\372\207]@\034Q\337\002<\256\233B\331r30\256\266\002V\211x\330\347\306\250\232\263\323\260\273\236\342\330qs\267\375`;\301vM&QSE\354\377\365\362\202\261\266\354O\237\013\315X\034\343?bvY\265"
+	.string	"+\303\271\230\330\276\307\241ms\322\265\006' \032+\263\335\355t$\f\003\245\272\304\271J\250\320\254&\315\266w\262\2040c\203O\301 p\355\356B\354\262\f\237\344\234M\247y\361\234\177\342\234\273vF\2262$&K\315\232\003\006}&@\017\3024\002\277P\347\211\272\nQ\004\251\003}`\3679\260gA\361u\027\236\367u\036r\257-;\240\220"
+	.string	"\312\224\2526\317\264G\244y\321\252(\006\027-\017"
+	.ascii	"3\003\3569\004k\340>,\373\323>\210\242!\006+xa_\202\336f s\031"
+	.ascii	"\372e\b\340\362\305l\207\006\246\240"
+	.text
+	.section	.gnu.lto_frskyOsdReadFontCharacter.38.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\221\002\315\024"
+	.string	"\006\347\212J\260\022R:\342\261\320\026\030\273\316\241\222A"
+	.string	"\322\322\253g3bF\005p \334\321\251\374\245\242c\332\236e\t\364\327\037\321v\240\220\031\363QX\357\007\365\007\375\007-qN\2229\327\016a\347j\33025E\177\023D\b\331;\245s"
+	.string	"o"
+	.string	"y"
+	.ascii	"Kct\243R~\364YRj\337\367!\333\177\t\034\262\273\323\202i\367"
+	.ascii	"d`\005\345\307\326\013\220\037\305\017 ?\3326J\212\315\267\237"
+	.ascii	">;\002@\277\032$\036\273\247\253\206\370\355\243X\351\315\307"
+	.ascii	"}\204\320\273\021%\225\304\353pQDI\342)\211\220\3001\202\305"
+	.ascii	"\243\241u\204\247Al\355\356\205\2476\274\031JAVv\327T\307\313"
+	.ascii	"\271\311\333\236`[\202M\251\0029\304\372z\341E_o\306\214\024"
+	.ascii	"\360G\216\016\355\023Gk\217}qw\327\225\307\376\321\315z\321_"
+	.ascii	"\376\367\213\246\256#5"
+	.string	"\035\251?\342\342\333\335\360\356a\270\273\033^-\324\330$\342G\177\360\324\266\371H\027\232\345\2278\320\366 \255\225;\027\007\304H\347dzP~$\241?\272\265p\347\356H\020:U\276\005\037\335\240\254\347\211l/\252\225\220\004\270Z{|#Y\265\204\303\016\"\035Q5h\250\017\3735\362\205\223\213\343\364l\004Y\t\240\325\352,$\275\235\310']\370r0\245\243\367\n\322\206\265\320\353X5\300\006!\250\036U5\025\347\262\332.WQkJ\021\202S\372\3710\244S\207\303\323H\033\346J4\004Sv\314Q\310\210\370\354\256\212\211\237\220\371?\037\215aF\257\373\350\317\310\217\317\351\321\b\262z}\360\327\005f,\366\022cd\324|\201\325\331\254\305\214\305^,\346\353\005\006\300\260\223\330L\306R\213\231\231\024\\2\030\227\005\230\227\214\013f\316\\'\007,\273\320b\2722\310d\246\213u\356\305\255<O\257"
+	.string	"\004\003\270D\377\364\013_^\0019\001\227\304\377F\326jS\275\222\2533\246\211\273;\021\036\374\253\212\306\332\343\024\026BA\261\362\320\372j\032Q\311\240\231\304\2201"
+	.ascii	"E\253\t\325/G\207\247\273\033. \220\002\241\241\r\036\345BG\b"
+	.ascii	"L\346\303\205\222 (\306\231j\246\272m\353\002\003\327P\217\306"
+	.ascii	"\375&\207\205\354\334\003CV0\316\301X\005n\031\333\\h\221`y\334"
+	.ascii	"@1\f\262zo\312h\335m9\333\352\303Es\262-\002\263g\002j\2521$"
+	.ascii	"\266p\362\333\255\260\373\342\365\233Xh\2670\3601P\256\316\253"
+	.ascii	"E&\267\326\350\001"
+	.text
+	.section	.gnu.lto_frskyOsdWriteFontCharacter.39.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\004\001\255\r"
+	.string	"v\032`F\340\2228\035R\266\305\263:\3620\023p\350\264\252\240\350N\322"
+	.string	"\351\241\356X\212iu\246P\341UP\f\247M\247U\327\242\203\342\301\002\274\376,\2061\306\030{\375LR\353\264\006\347`\326A\242\022#D\233\354\235RJ"
+	.string	"K"
+	.string	"K"
+	.string	"G\001\336\245\343\315\256\312\214\030\273\243\307\013\264W\005\347d\257\330\rd\257\266\335\340\001\350\360#K\352@K\013\005\323cw\334\350\210\207\237\241\377\362\230\t\224\231\032\254\030\325\351S3aw=EU\207\233\336v\307v\004\373\036\002w\371\353\311\237\326\351oJ:R\034TO\201\261\233z\315\254L\225Q\342\253\337\006\375\322\001\374\025\207\001\277\032\371n\330\215\215\226\033\256\335\023\006\257\206\240\275b'\347\220t\274\n\360$\t\202\002\253\341%\004H{\365\250\315i\377D$\007-\321s\273d\232\027\335a\341\220A\321\223O\355\220\227\"\224ewA\027sTz\2521I\341\201\372\361\027\031\276\267xL\347\223\360\313\013\276\370:\377e\257"
+	.string	"Pv\274\260\\\200(\231/{<M*\302>\266\273k\272b\007\334=\020\216~\037\311\033\215D!O\004\302\t0\367\031}]\210$\344\363(l\235i\253`\022\211l\234\367m\237\004\356,\220\274\rC\327y\333\270\307\226\256<\314\006\254R|\360\341*\241&\036\301vU$\270\310\3712\201\251i\235\313L\3364\262\263x\031\023"
+	.ascii	"|#\332k\340n\273P\321\f\323k\215\b\301:Umd\360\026\363\354;\327"
+	.ascii	"\300\250\211\022\\\274*\034\026\210\005\34175\005\356!L\315\201"
+	.ascii	"]S\017"
+	.text
+	.section	.gnu.lto_frskyOsdGetGridRows.40.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\31766@S\323\001\2336`@@\026\234\262\377G\3054\240\025b!\332BA\373:\210\3117\237\243\262\3336\315x\251zvk\222FE#\274\225\263X\325\207A\233\310\235R\366t \260\351\220}\260KBNKNX\017 \351\2710\3319\360\244\210\270\244\305\234\227\334x{%\251r6\315\360U\365\242\032[W\371 \224l\320S\246\301\207+\216\202\021\224vW\341\344\336\205\017\362h\214\f\236{\3643\352\361\032`\262\301\317\366BP;\354O\253$\033B\353\241?\t|0\335G1\273\033\037\315\272D\226\020\333\232\275\361GN\242\271b\320\330\272J\204F\2642\263\353I\316\013\250\307\351\003\324\243z\\;\324\374\227\274\341e$\303u\241C\200\205\3355\344:\216[o;\301ve\273%\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdGetGridCols.41.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\31766@S\323\001\033\214\035"
+	.string	"\301%\257\354\377Qq\033\f\353\202\252!\034>t\032\315\344\233\317Q\331m\233f\274T=\2735I\243\242\021\336\312Y\234\366\177\320&r\247\024\376x \260\351\220\201\260KBNKNX\017!\371\2710\3519\360\244\210\270\244\305\234\227\344|{%\251v6\315\360U\365#\033[g\001!\224\354\320W\246\201\347\212\253`\004\245\335UH\371w\341\213<\032#\203\347\036\375\214z\274\006\240l\360\306\376DPA\354O\253$\033B\353\241?\t|pt\367`v;njV&\272\214\330\326l\216_r\023\315\025\203\306\326U$\033\243\026\232\335Ov^@=N\037\240\0365\344\332\241\346\377\344\r3^\f\327\211\016\001\026v\327\220\353<n\275\355\004\333\225\355\227\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdGetPixelWidth.42.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\31766@S\323\001\033\214U\204\031\223\300T\035\025\267\001v\362\017*\206 Iu\032\315\344\233\317Q\331m\233f\274T\r\320w\273\313\321\b\017\344|N\373?h\023\271S\n\366t \260\351\220}\260KBNKNX\017 \351\2710\3319\360\244\210\270\244\305\234\227\334x{\035\251r6\315\360U\365\242\032[_\371 \310\330\240\253L\003\222+\236\202\021\310\354\256\002\312\275\013\277\364h\214\f\236{\3643\352\361\032p\262\301\317\366BP=\354O\253#\033B\353\241?\t|\224\272\223\276]\216\217fa\242\213\210m\315\336\370$/\321\\1hl]5\262!b\231\331\365$\347\005\324\343\364\001\352QA\256\035j\376M\336\020\023\322\302u\241C\200\205\3355\344\272\216[o;\301ve\373%\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdGetPixelHeight.43.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\365\007"
+	.string	"B\317660q\323\001#\002K\357\323p\264\305`B\234\034\324kn\326a@\241\203\316if\003PZ\265\365\377\205\313\207\003'\300\025a\372\037\b\355@\321\302\037\2106\221;\245\366t \262\351\240}2LB\316KN\\\017 \351\3012\3319\360\244\210\300\244\305\234\230\334|{\035\251r8\315\360U\365\242\032_W\371 \230l\320S\246\301\207+\216\222\021\230vW\341\344\337\205\017\362h\f\r\276{\364\265\352\361\032`\302\301\223\375\205\240z\330\247VG6\204\326C\237\022 \261x/\305\354n\234h\366%\266\204\330\336\354\215?r\222\315\026\203\006\347Y\"\035\242\225\231\335Or^P=R\037\250\036\225\364\355p\363_\362\006\230\222L\347\205\016\001\026v\327\260\3638n\275\355\004\333\226m\227\f"
+	.ascii	"2\001\2738C\350C1\341\314\213\3451\323\313\246}\256\341\231#"
+	.ascii	"^\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOsdSendAsyncBlobCommand.45.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\205\002\245\024"
+	.string	"\266\247\210I\300\322Q:\342\250\245\231\366\004\365\230\\w\037k\305\355'\027F\t\346\"\t\177\211\223\304 \261\362F\240\341\003>\001\325\321\027hn\315no\001\022\200"
+	.string	"\001HP\200\217!3\2226\235\f\224i\323\323GZ$\261\204\310\235Rs"
+	.string	"k"
+	.string	"q"
+	.string	"\337\200#\310(jw\017<\264\203\361!\nh\203E6P\r\224\310PK,\340\220M\211\025\235\366\205\276\302v\237\241NZ\233\201\005\207\024\337MT\017\307\227\250\036zN\033A\002\333{8\326\335\335\016\244]_\212\r\214\017m\263y\234h\330\234\225\240\336N\013\251\335u)\211\333>m\376\177\017\311\351r>E\006\273\353\231\323\365\334z\333\004lS\260\247\217\177\353F\367\310\213~\326\207~\362\276\1775\247GqZ\034\247U\342t(N\203!\323:NOq\372&\254\024<\335M@\355v\230\002\262La\322\211\033\375G\237\366\375\031O\262I\327\216\344\325\007\035*v\227\254\331\344\303\037\306\177&c\\\206\355G5_\334\216=\202\204\242vy \214\017\307\375\332w\361\027\266\033\231\306\267g\003_*E~h\376\303\t\360\243\322\347"
+	.string	"5\324\343v#\n*\311\215w\2435\257SU\355\027l>7\242(,U\375N\020_\251\024\340d\227\377p\0248\355\356\202\207S\237\363\2403\247L\352\367\266\241\272\222M<%\034\320mN\2315I]\351\221\376\263 \362\223\263g/\3639\027x\3221\3414\307\366\335\246\216\260\017\356\356Z}\354\367~\222\023\005\261W\ts\363\232\021idf\264\327\205\032rl)aZ@\031\206\331\203\025M\026{\311\\T\261\030\230\032\246\022\253\225\023n^j\264\n\256r\346\222\231\275b\\0Z\315\2452\300\345\214\214\346\242)K\232\213\364\351\034\\\365\361\370\004\202IGo\256\001wE\260\374\350\377\035@\324\320\234r\311\024CP\324"
+	.string	"\332\365F\365\223\"Hx\322\303\037<RQ$:\2624TQ\225\327\204\333\261\264\245*%C81 \220\002\231A\363\267\340\240\b\370\200F6P(\364\211\f,\b\356\356)\265\316\344\214\317\016D\211\2071\212\356\2041B\021)\343\203\210!\223\0228\202\t'\261\rB\271"
+	.ascii	"\023\262N\313\277\035Sh\354\007C)3\201\032\020\267\333\"%\302"
+	.ascii	"\025\210\215\001,\3442F\b7\\\323=\206\021\004\270\260\313\030"
+	.ascii	"1\034B#\276N<\300s\213\266?\001"
+	.text
+	.section	.gnu.lto_frskyOsdDrawStringInGrid.46.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`P\001=\016"
+	.string	"V\234bD"
+	.string	"\261&\035\360\363\037\206\201U\316\363\017\266\216`\345\335\227\200\346A\0072\226\260\367\365/;\b\032\236\326\re\254u\346#+\n\364s1\377\377\377\327\006\313>\322U\003\005\027\210\304\311\021j\220H\366\2262\245L"
+	.string	"N"
+	.string	"O"
+	.string	"\331?\260\317\025\222=\372i\177\304c\272\313\0340\307.\013\213\233\335\357c\004\331c\201\023\300\036\341?\260Gwv\316?\227\365\300\240H\225\240\261\273\233zx\367\354\374\263\316\341\251N\317\215\006\273\353\364T\031n\275m\003\266\025\330w\005\273\326\026\3735\277\366\357\317.\363\307\230\2061\2550\2350\375"
+	.string	""
+	.string	"B\270T\177\261\331\275\360\252\261\255\230\342\303W\277\375\263\254\371&n\323}e\372\256l\007\b\230\026:\273\030B\036\235 {\364h\316\234\246{M\005\217\200U\241\261\360\371\002\240\274g\270\032\364\344\377\004S\205\372Y\341\200\312\227=RS[\204\222\367TAnpbZ*z\262_\302\354\321\310\206\034\0213Rm.\323|\221\332\271\332\021\316*y\270\354\356\202{2\242^7P/+R;)\371\262\277Sj\007\373p7&#\220\206B\023\034@\323)\334 \021\223\022GbB)\221B\033'\332\036\210JF\033\210T\332D@\314A8!m\0228\216\264i\337\036\256\2668\303!\321JQ\224Mp\227\205\301W\277\316L\276< \241j\252\267\013\354'\316\"\031\201\3419\306\255\002\263K\002\030"
+	.ascii	"2C_\025Xx\224\200w\205\330Ui\020h\200\303\250\030q\306\0323,"
+	.ascii	"\342\032\3432\227\305\231C\273:<\013\326\003dMM$\241%p\016\f"
+	.ascii	"V\240F\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_frskyOsdDrawCharInGrid.47.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\352\001}\020"
+	.string	"v\036jG"
+	.string	"\261&\035\331\013\022\030\364\360\256\253\271\303\275!\245\342Y\270%\360\351\372>\335\376@4\312\236\006\262\203h\253QFG}\260@0h|\264\276\344\252Z\277s(\211L\320&N\223\033\352ct\373d\023\262\311\336)\005R"
+	.string	"U"
+	.string	"Q"
+	.string	"\273\001VRO\003\310\207h\"\r\222z\352K\373\252\223\b_3bnWft\355\212%>PO\013\\\200v\232=D;uh\363\\\004\261\003hf\234X9v\267\233\037\036^\206\376Y\347P\251\227\313M\301\356Z\242R\031\356y\333\006l\243\330\262\024\317^\363\317\333\374\007\371\030q!\365\020:\273\030b;v\207\266\020\361\326o\337?q\227\313q\354\021\023\343+\336\362\307\233\020\274\t{\304\334"
+	.string	"\375\033\037\305S\200W\321\3625m\355\241\231y\355\302\220\234\372\244\236\216P\027\373s\372\217\355\271z\211\3606\025L7\246\371b_DS\325\036\316\305\254\223\253w\216\366Y\347M\260\222\214y\373\352s\323\020dS\233?\301\350|\313>\371(b\224\243l\314I\347\307/\3400\243s\202\221d\314\026Krz\260\237\355\356zv\2607i\256J\327Mz\333\244\265M\232^|) /\302\b\304\262}\020Bst\nw\310$\005\364\032\214T\300\357A\347\211:\t\"\320J\027\372\300\316\204\200=\026\007_7\301\363\276\356#\222\316\372-\324x\261C\232%\267d\2732\t\306\203\274V2f"
+	.ascii	"\222\3360\264\343|\024}\260\310\221\241A\2052\217\357RY\221G"
+	.ascii	"\371\2563\300\001\243\343\025, \240\202\031\272\232\007\" \017"
+	.ascii	"k0\354<\211\245\016\211\301$\341\272\n\254\023\226F\364b\030"
+	.ascii	"(\264\266\013G\004\344\021\002-\240\013\313'\035.\026\316\233"
+	.ascii	"\315*J{#\367D\210\203\331\223e\002\266q\277\030\236\\jG(\217"
+	.ascii	"\360\030\020\315\241\335A\235\361\023\315\3603:\341\242\3470"
+	.ascii	"X\301\215\006_^\264\213\f"
+	.text
+	.section	.gnu.lto_frskyOsdClearScreen.48.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"u\n"
+	.string	"\226\223IB \251*\035"
+	.string	"w 0s p\rP\203\342\323O\002\232~L^\212\037t=y\201\303\004\022\350\bm\325K\021l\220c<\b\211\232\025"
+	.string	"\030H\2571A\231\215\016`\033e\370rX0\332&r\247\0248"
+	.string	"3"
+	.string	"9"
+	.string	"+\261"
+	.string	"Vj\305v\227S\003\007]S\t\362\033\300\320\265\013\200\253F\201\"p\301\001\034i\025\022^\245\253.Q@\222\224\f\232\335\2654\201+\367\274\355\r\333\026\366!\002\026GRS\366\265U\224-\245uvb'\025\360\t\306\335\3238\333\327\214\240\300\366}\326\303\317W\316\0200c\260\273\333\247\375\261\267\317o\006\331\260\213\007\002z\325e\200\2240da\002\005\222\224\371!\306\305?\300\\vW\303op\007&>\202\317\207'\036y\323\247t\335\025,\237\017\217\260|\252>\374\005\330Z\r`A\020\311\321\001\336d<\276\216\303\323\371<\020\256\343p\"\234\216\020n\343}\\f\302\335\310\207\307\225t\235\307m\242\350\212\262F\244#\355\"m\222O\336d\325\320e\005F\227j\312\307X4\016"
+	.ascii	"2\003\3269\304\352\245\202\331\013h\373h\020\276p\367\270&\262"
+	.ascii	"\017A\006\025\342\345\nq\351\232j\232\006\246\240"
+	.text
+	.section	.gnu.lto_frskyOsdSetStrokeColor.49.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"M\013"
+	.string	"v\326PC\020o\234\016\b\251pP"
+	.string	"\035\376&\244\252t\200c\352Su\001\365n\340\312-\214;+\316\031\366\325c\267c"
+	.string	"\264=\337I("
+	.string	"\001"
+	.string	"\240U\376\003b)\315\b,\027\024i\205\t\254~#\332d\357\224\002;"
+	.string	":"
+	.string	"@"
+	.string	"\224\335\220\212\323.Hb\021\354\024\344\034\327\251\365\215\353\324\236\235:\330a=<\254>#^\354n\235\034\356]z\376\303S>\320\346rr\331]\313\017d\341\236\267\035b\273\304\376%\024\306\030\213\242&F\007\177\373\276\210\213v\346\314M\316\300 f\031;;\275\355\371\2413\003\b\340\035\324|=\033\241\305\207\t\252\335\323\310\251+vj\373\322>\351!\274\227$8\257lR\2102\220\276\216\373\304\345\213\035\004\371\317\027?\300E\005\030*\317\334\370\363c!\347\347D\003\b\022\237\025G\2166\330\221s\203}kw\327Sd\277\364KK\372\023\215\025%@\037\215\273\001\332\271M\301\246Qk\026\003\335F \223\240\343\020\324\rS\031`\n,\250\032\327U\313\207\267\006\007\270\372`\333\270\232\201\234[;E\306R\027P\234\331\261\306\332\r\t\b_Q\231\344hL\376Fq\335\364\320A\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetFillColor.50.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"U\013"
+	.string	"f\026QC"
+	.string	"oj:\333\221\312\201\363\002S\006,\250t\007x\254\021d|\352\346aAq\017\037\366\337o\266&~\f\301\313\035\2266\\T\200\nP\325\224\364\001\360\245\264\205W\210\221c\2141F8\240H\233\354\235R;"
+	.string	";"
+	.string	"A"
+	.string	"\224\335\220*\265+\226xD;\ryGv\212\235#;5h\263.v\330\217\321\307#\202\305\356\326\311\341\340%\350\177<%\004i.'\003v\3272\004]\270\347m\213\330\006`\337\022\025^.vEIx\270\370\333\367C\034eo\306\374d\f\f#6\214\275\235\336\006\375\321\233\003\b"
+	.string	"/f\276\235\225\260bD\241\265\233\"9u\325Nm_\332/\035\004x\323\004\007\0174N\230(e(\205\036w\211\314G}\021\344C\037u\002.\013-Z\235\251\361g\250B\316\317\211\006\222\313\363b#_\266\310\221s\203}lw\327Sd\337\364KL\372\223\f\024\037\320I)v\003\334\275nA\307Qs\225\003_W"
+	.string	"\243\340\363\022\324\356R\033\\\f0\250\234\367\325\n\210;\007\b\274\n\241\353\274\272\211\233c;E\326X\037V\233\311q\006\333\rY\306o\264N\362eM\376Ve?}\f\r"
+	.string	"2Ck\025\030\036U!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetStrokeAndFillColor.51.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"5\013"
+	.string	"v\026PA\020O5\035\303\3046\020\245\002jLl7B\037\260]\372\364\377\235\304\370\334\f\325\264`u\007\231\372w;\006@\333\323\302Z\021\b"
+	.string	""
+	.string	"%R\002\274\207\002\2360\251\312G\246\274\232\266\264\311\336)\005;"
+	.string	":"
+	.string	"?"
+	.string	"\221]O\213\323\2568\300\001\262\323\217w`\247\327%\330\251?[uQ\304N@\033:%`\354n\235!\376]~\376\307G\3000s\t\251\354\256%\030j\270\347m\003\260M\300~%\030Z2\026EQ\214\270\370\333\367I\334dk\276\274d\r\016'\264\213\255\235\336\376\374\321\232\013\030\370.b\276\234\265\300\002uX\355\236\004\234\272f\247\266/\355\213>\372N\272\340\227\204+X\036D\340\344N\201\371&\257\202<\350\233\216\340E\206\030+\316\314\370\023t!\347'\344C(\325\231\241\221-[\334\310\t\302\376\265\273\353\371\261O\372\345%}\310F\312D\370\020\213\335\333;\356\001\267Qo\224\005\036\227\340\342\300\353\032T\316R#X\024@\250[\347U\212\2079\t\f\272J\201\343\272\252\211\232_;?\316T#\224fn\214\271v=\007\306s\254J\262\345L\376V\201\275\364qB\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetColorInversion.52.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\035\013"
+	.string	"F\225ND\020\251j:\007\007\373=\020\026\261\bn\360\330\313\300\334O\300\230\310\271\213\340\001\007\006\007D\332a(n#\323n\251\236\265L\336a\023\263\002("
+	.string	""
+	.string	"\246\001\252\2467\023\t\301\242#Q\345217\273wJ\0018"
+	.string	"9"
+	.string	"<"
+	.string	"\366X\210'G8\267\315H\006\273&\205%2\347,\332\264\233\256\345\274\\\253\003\024v\327\253"
+	.string	".\236\212\376\313kF\326\351\024\203\261\273\246#\353\344\256\267\035a\273\302\276'\324\3074@ a\035\206`\267\344fag\234\202\001\217\375\366\375\002?\355\316\245\233f@\221u%\273;w[\364Kw\266c\246\257jEl\257"
+	.string	"\265\335\004\023\347\354\241\324\001\016.7_~\337\020x  \205\034\037n\331\305?AB\372\321?\2371\301\244BMUO~\2150J\240\365\325\301"
+	.string	"l\301\352\002\212\336l3E\353\212}\313\356\256k\313>\371S.\237\203B$0\0242\022e\374\351\200\302O\303\324\021\202\034\336'\362F\242\r\017\357\003\206^\007\302\337G\b\364H\337\007z\235\211\272ek\313\031Z\203\031\252\246l\262\354\252\\\224\337\324Nz\263\206\376\016\016"
+	.string	"2Co\025\030\036\365!\002\347\267\310P\b7f"
+	.ascii	"\202k\"\r\301L\025l\242\206\355\347`p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_frskyOsdSetPixel.53.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`D\001\245\r"
+	.string	"\206\233^D \217\223\016\340\337<\215\001P\325\026OS\201\\\364\314&\342\224\027`\200\365\321Jj\254)\020\307\255\241\255Z\240\303\034\331\341\3315\032\250N\013H\216\214\207\022\255\017P b\305\363\007\202\324\032\331D\312\224\002H"
+	.string	"J"
+	.string	"G"
+	.ascii	"/\034\233C?\355\257\274\204\350,\226q\266{\242\022\263\273\034"
+	.ascii	"'\330\034\036x\001\354\360:\001\354\320\"{u\017\304\032H\tQ\372"
+	.ascii	"^\354\356\246\037."
+	.string	"z\212\374\177\317:\023\311S\323`w\235\235i\303\255\267\215\300\366\002\373\252\336\2579\313\177ai\205\351\204\351kh\254`L'\321\332\325\320\212\261*hB\304Q\277}\337\345)[\363\310[\234\301\001\2056bk\207\377g\3156*\364-\331L\2252\202\265k\302qh\005v\2362\254\210\331\3658\346x\001~\312\363\221\357\374\324\035\2700\201\301*Q\022\253\332\022\376}\334\311TSm\220\303h4\365\245\231\253\035\362\227\013\356\330\361_\005w\016\337\261\270\364\n\200\244\342R\232\031e\313\366H\251\036\354_\273\273V\024\373\247?{\"\240\344\342\204\350\201\241c\270=\035\020@\361A\b\004\304E\330\342g\243\360\361\b\331<\034h\353\330p\024\371\3406\0131r\233\346\215~\255\242x\263j\241\032)\311\241k\367\204\301Q\377\367\001\254S\266, \257\373\004\366\226\177\036\001L)TtX\3516n\031,\026"
+	.ascii	"2Ck\025\270x\224\266\256@@v\200\330I\221\351\223\333\230k)\027"
+	.ascii	"\032\2331Q\325\314\305X\323(\005 \004\347U5pE \005\270\353\240"
+	.ascii	"\260\200ky!L2"
+	.text
+	.section	.gnu.lto_frskyOsdSetPixelToStrokeColor.54.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"]\f"
+	.string	"\206\230UB\020o\234\016\001\341\027\341\034"
+	.string	"r9X7\b\026=R\272\374\3237\251X\310x-\017\304\352\203\205\317\020Rmu\307\020\334\1778\343#P"
+	.string	""
+	.string	"\310'\020\020[\004\345\"\356\202h\230h\032\264\211\334)\005@"
+	.string	"B"
+	.string	"?"
+	.string	"/\361\035e\016KvI*P\354\356\305\b\260O\003\037p}Z\247\\\237\376\354\026\027El\305t\022\215.vW\323\020\377.?\377\343%`\350\271\004\260`w-\301p\303\255\267}\3006\306>\207\237\004"
+	.string	"\311\020\036\343cW\303Jd=f\212\021\327\370\355\373'\236\2623{\337\360\244CG\346\331\331\347?:\3633n\342\273F\347\033Z\t\t\023J\265;\262|\372\202}VT\354\260`\237\276\264\177\n\034\227\237\332(\310\203~\352\fBF/T!\365X\252\335]*\365\242\221\253m\341\343\005'8\b\242z\315>`\204\210F>re\213 \251 \354[\273\273\326\222}\361\277\216\372\325\222\226\226t\234{\307pg0\017\272\255\201'\241\343\"h\233F\233\240q\260\3212\\\247a\bx\343@\340\264\n\333\306i\231\370\271\265Z2\366\021z|\024\344\216\265KR0^\200*C\256<\221z\257\270\276\361qsJ\310B\304\303\t,p\007\024"
+	.string	"2Co\025\030\036\365\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdSetPixelToFillColor.55.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"m\f"
+	.string	"\206\030VB\020Q\234\016A\356p\331\300\007j\f*nLTT\26184\302\271Z\005\322\331\252\316\250\341Z@\334\001\275\367O\361\211e\375\340{\302"
+	.string	"\n"
+	.string	""
+	.string	"\317(\020\262t\037\265C_\357W<\r\332D\356\224\002A"
+	.string	"B"
+	.string	"@"
+	.ascii	"'\361\335\303#\236\354\232P\244\330]\214\021`\237"
+	.string	"\006>\340\372\264.\340\372\364g\307\270(b-\035'F\343\215\335\3254\304\277\313\317\377\370\tX\372\\\002X\260\273\226`I\303\255\267}\300v\306\376\206\247\004\250!Rz\350b7\303*\307\222L\025#\016\362\333\367M<eg\366\036b\n\207\027\231gg\237\377\350\314\377x\211\357 \236\257h'\250\016\021\325.\351\362i\f\366iQ\221\305\005\373\364\245\3750#\227\237\332(\310\203~\352\fl\220p\250D\372\261T\273\273T\352G%W\333\302\307\013Np\220\206\3525\373\020\302\030\225\200\344\312\026CRA\330\267vw\255'\373\342\177\335\343WKZZ\322\001\235{\307pk2\017\272\255\201'\241\343\"h\333F\233\260q\300\3214\\\247e\bx\353@\340\264\n\333\306i\231\b\272\265z2&\243\003\tHC\366X\273&\005\343+\252\017\2712E\352\275\342z\310G\316+3Z\240<\204`\201;\024"
+	.string	"2Co\025\030\036\365\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdSetStrokeWidth.56.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"]\013"
+	.string	"vVQC\020o\225\016\303\234G\253\037\001\b\275\356b\007Q\214\206\202\006\352\212\204vo\t\210\350\003U}\364\251X\027\217"
+	.string	"\2028\240\321G\240"
+	.string	""
+	.string	"\220\017\200WXZ\217\021\f\303\nVR\323H\r\322\310&{\247\024<"
+	.string	":"
+	.string	"@"
+	.string	"\224\335\322\207\326\256X\342\221\355\024\344\034\332i\366\r\355\324\240\255\342\242\206\3558\221\030yp\261\273uf8x\t\372\037O\tI\237\313\311ew-C\022\205{\336v\210m"
+	.string	"\366/\001\022b0\326ECl\270\370\333\367;\234es\356|\345\214\n)\270\216\315\235\336\006\375\321\234\003\b"
+	.string	"/z\276\242\205\320\342T\342\265\333\"9u\335Nm_\332G=\005^%\342\257|N\240\260\200\n?n\021\232\317\372\036\310\207>\353\004`\023^\274D\363\343\317\220\205\234\237\223\013\251\021\243\030 \031\263\305\220\234\030\354g\273\273\236&\373\252_f\322\237h\300\"\220\236\002\261\033\234'\330d4\034j\214%\363u\005:\n>\017A\3554\225\201\306\300\202\212\361\276j\361p\327\340\200W7]\347UN\004=\333i\362\266\202\203\0134C\366d\273\245\001\343+\257\225\214y\223\277Mh_}t\020\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetLineOutlineType.57.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\205\013"
+	.string	"\006\227RA\020O5\035\003\366\215f\007Bf.\200\364(\363\303\357\322\376\332\235\017\360!\201:\356@\330@\241\376{\t\214\216\342\017\203X\005\320\021"
+	.string	"P\322\001j\304\221\312#\323\320\232\324)\256\246\215\032\331;\245>"
+	.string	";"
+	.string	"A"
+	.ascii	"\023\034\331"
+	.string	"\035\275X\355\226\004,`{\006\340\034\3323\354\033\3323\2176\212\227\034\266\243T\"\364\201\305\356vu\303\307\323\321\277\371\b)\352\234B*\273kJ\212,\334\365\266\003\3306`\277\022\247s\227\302\tc[\331\210\016/\177\373\276\207\253l\316\342S\316\270\360\342D\233{v{\364Ms.@\031_r\276\240\225\360*\235p\355\256\006<3e{f\373\324\276\351\247\361\250\332S7#\\\"\302\004\t\203\211\374\270Y\232\257\n7\364\244\257z\202\025\025Z\270@\265\343WR\005\255\257\220\f(\020\241\030\036z\332\345\207V\r\366\261\335]W\222}\324O1\352C4\\\204\020=^F\324`^FD\340a.\0174\233\217\263e\302 \374\024\210\016B\260A\367]:\314e\001\204\316\002\206\335\304\303_\306\003;\315\367\201\035Wz\216m%yK\301jy\352\307\034lwt\300\274\304\225\242\2477\372\233D\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdSetLineOutlineColor.58.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\205\013"
+	.string	"&\227R?"
+	.string	"Q5\0352\237\2700\231T\032~<"
+	.string	"\320\f\016\035\341\337\333\347\341B\n\250\301\345-v\373\322\206\320cT.;\324)\013P"
+	.string	"\200X\335\31652j;\303\374\230\321\035*:\322&{\247\024?"
+	.string	"<"
+	.string	"A"
+	.ascii	"!\007CvG"
+	.string	"0R\273\342\002'\320N\017|@v\212]@v\352\317^]4\261\004J1B*j\354.7K\374\273\374\374\217\207\200\242\316\345c\262\273\226\240\b\304=o\033\201\355\007\366'\001\242\207\254]\017\257\033\253\242+N\\\374\355\373)\216\2627o~2G\b\327\266\261\267\323\333\237?z3\203\006\337E\316\027\264\033h\224V\255\335\224\202S;\320Nm_\3327\035\305\367w\213\354\247\217\032\036y\341\302$\302\004\032\270Yd>\312\323\310\203>\352\022\\\037l\264@\263\343Op\206\234\237\217\021\241+\324\341\221/[\374\310I\302>\266\273\353I\262\037\376\022\223\376#@G\207]\275T\n\355\352\245F\250`,\227\214\246\0020ER\301\253\0236\027\274\316\002W-\034\306B\001\003G\351<NR\3005C\245\3432\265v\334&z\216\355$Yc\311Py\346\307\034lw\004a|\244u\222/k\362\001\r"
+	.string	"2Co\025\030\036\365!\002\307\260\221\237\020m\314"
+	.ascii	"\004\327\004\036\202\235*\252\001\"\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_frskyOsdClipToRect.59.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\245\001\245\016"
+	.string	"v\\bE\360\2606\035\226Aau\n\246\345\376Jew\263\326\335\311\336!\006\212D\336Duf\327\332{\235}\377*\023\235\226$\216\356$N}\305B7\221\315;{J\356\n\304\005~a\217b\027\243wG\262\267\334)\005M"
+	.string	"M"
+	.string	"K"
+	.string	"(\234\217/\364\270>\375h\337\345/\335a|c\317\356\312K\315\356~X\301\365y\340\004\254O\371\001\326\247;\373\305\277\021[\240\305\206\351\004\215\335\315T\304\273\307\316?x\217wBy\344x\260\273\216\336\311\303\255\267\215\300v\003;B\b\237\177\377u\230\177\312h)\243UFG\031\375\016"
+	.string	"\253\360\364\230\234\335\016\253\235\325\2316$>\363\333\367U<\2641\217N\343\317\007\0256\262\261\317\0374\346\243x\212\3563'\337\224\365\224h\331I\355\252x|\232\301\365\271\300\222q\221\005\341#\314P\251\221JQ\024K\265+\234\005H\245\252-\272\r\311\301\222\217jT[{\315\245QoR]\355\f_a\342\020\233;\270\301!\237\367bL\275b\245\230\026&\025)\256\354\257\0245\204}\271\273ke\261/\363\203\216\372\003\333-\334\344\243s\270C \0238M\302\210\204\333(d\232(\273 \022)\311B\033\227\201\030\260\206ad\3134h\332\226a\037\351r\225\305\027\214\033:$-\371D\356\2568"
+	.string	"/ \205\212+wD\353\306\261NsP$\200\211\034\031 \\\274\004\367\215\345\207\241\221x\317\017\037"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdClearRect.60.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\245\001\225\016"
+	.string	"f\334aE\020\221\223\016\300'A\211\b\032,\272"
+	.string	"\272Y\377#\0365$\350\272\263\253\227\b#\025\300S\fD\257\315\"jl\b\f\361p@r\215\373\016P\004@\341(\225\3177\376B2-G\212v#\033\251do\271S\nM"
+	.string	"L"
+	.string	"K"
+	.string	"\251\032!\336\f\bv\351C\373\250\267\340\016c\033wv[P4\273\033b\005\330%\202\027\270.\343\t\\\227\346\354\034\367R\254\201\027\017&\027;vw*\212s\207\234\377\357\235\356\244r\b"
+	.string	"\302\356\032v\247\020\267\336v\002\333\016l\030!\367\334\373\261\303\3742B\307\b\255\021\032F\350\177\0040\361\341t\225\214]\020\255\036{#kV\\\365\333\367g\276\2623\217.c\317\210ldg\227\377\347\314\177q\030\334U)\337\225\355\260x\351X\273, \227n\200]2\270bp\314_]\202\016\026\036\254\025UqT\333\302g|4\252\332\241\327\230\374;\361\250B\265\265\323`\n\365\246\234\253\255\3411P<b\213\376q\360\310\345;\034\251\327\254\244\242a\312!\301\226\355\225\240\236\260\037ww\255.\366c\376\317S\017\333/\034\345\243w\270A\"\024D\332\204\221\211h\2530\265\320\304\020\"9\231\240M4E\016X\313P\262\315\r\232\266\315\314#=\256\272\030\303\021qC\322\222S\342n\313\203\357\003X)\330\362\007\274n\033\327e\376\221\b(qC\005\tT\267\340\266\271\374\025\250\004\276s\037"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.ascii	"\302$E\246Onc\256\345\\h\302\326\"\2105B\263D\334r\020\22709"
+	.ascii	"\2009\220\031\030\004\310\003\216\001L\200<\340\230\203B\r\256"
+	.ascii	"\345\2050\311"
+	.text
+	.section	.gnu.lto_frskyOsdResetDrawingState.61.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"e\007"
+	.string	"2\016470\217\222\016D\341\233\233IHfO\251n\201>\314\2177\276\336\214\022_\365\371\036\241\375|0l\3061\316\031\377\006\022\006\271\b.\274\261I0\250\252\007k\373\204\310\024o4\r\234\266\320\201\340\266\207\250q\242\004\207!\"n6.j\n\326&\034\266H\241i[\314T\240f\022\236.\252\001'\032%\326\n\004C_\357V`w\027\f\241\257`7\325\261x\025\335T\025^J\254\325\005\374\274*\364 \3077\223\360\364p\003!\215LEie\222Z1\311r\251|\374\275%MyJ\362\300F\212Hff\275\336\363Y\257fw\337R\225G\022\214\2140L`23\302\216v}\335-\252\002\"\323\247\017 !3\177\"SF\207\375\r\376\203?$\t"
+	.ascii	"2\241w/\260\341\002t\r\307\036\342\r*\372\345^p\351\026\355|"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_frskyOsdDrawCharacter.62.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\177\001U\017"
+	.string	"\206\236iG\360\3166\035\323\013\214[\343\223\036%l\235\032w\366R\374`\177\236h\302U\314\017\265\353\252\006\332\233\236\177\006\231\034\034\206R?\276_\255s\322qX\234\212\347o\001\2449\226&\272\304\"\2479os\023\273\333\336)\005Q"
+	.string	"X"
+	.string	"P"
+	.string	"#\217\262S\221\274F\025q8\262S_\332\207\271\b\3601\3261h\227\245\306\265\273##\310N\r\234@=\305\256QO\r\332-.~\330\215\227\r\252\022=\273\273M\227\203\227\240\377\361\240pur\t\340\301\356Z\206+\r\367\274\355\003\266\033\330r#U\372\031\031.,Vg\251\330\315\360\023cwh\016\210\333\374\366}\023o\331\232I~\343\220\nN\210\335\325Hl\355\364\037\255\3715g\201\267)\371\242lh\345\205\303k7\205\343\324\245\3544A]\300"
+	.string	"<\315\351\242M\241\300\240@\346$\300\317\230\230\356\256\254p\355\212\001/R`\274P\346\211C\323\236\360\361\224M\333\364\321\304%\220\212\2346\310s\352\224\363*\237O;\344\256\317%\273\373h\301\245\323\207<s~\016H\261\\\250|P\362\307\026Srz\260\217\355\356z\266\330\247\371C\237\371\263\213\177}\314?\253\264\f\234\207\374FD:\314\243\300\315\323/\334\034\311\343\353\"\234@>O\302\326\231\266\n\246\216\220\215\363\276\215T\300\235\310\207\267\215t\235\267i\"\352\330\316\026g<#vP3\345\022l\227\305\301x\001/\031\371c\221\254\367\211\372\233\217\035\001V)z:\300\204\244[\247\372-\356C>\364[\207\020\032"
+	.ascii	"2Ck\025\030\036U\273\005^\371\n\232\031\326\251H 0I\221\351\223"
+	.ascii	"\333\230k5\027\232 l+\215\021q\346\320.b.\224A$\320qQ\242\306"
+	.ascii	"\022\256\004\207\201,\034\324\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_frskyOsdDrawCharacterMask.63.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\357\001\035\021"
+	.string	"V\341sI\340\3206\035\352\007\226\024\f\274+\3650\026\342\003\017\340\023\001mW\200N\211\241\370\331\022\303\264,\"W\351\217\344\243u8\350\316\312h\313A\021\256\207\030f\250\037L6\364w\003\320"
+	.string	"h$8`\305H\255\233\355\266wJ\001["
+	.string	"a"
+	.string	"Z"
+	.ascii	":.\256\273 p\314vI\224Q\334\253i\376D\"\207F\270W\177\332\277"
+	.ascii	"\271\212\3618\016riW\306g\266\273(\033\340^\t\\\204\364\252\375"
+	.ascii	"Dz\365h\3378Ib\005\330\224x\261\320\261\273\036\035\361\361s"
+	.ascii	"\364_\276\004\213\275|n\017v\327\023\026\363p\323\333.`\273\201"
+	.ascii	"=[\001\333q~\215\233\246\333\364\334\246\037\002\200\306D\354"
+	.ascii	"=0v;\034\361X\242\nt\342>\277}\337\305gvg\361?\376\220\t\241"
+	.ascii	"\330\335N\264\273\327\277t\347\367\274\305x\237\226/\314~\324"
+	.ascii	"\330\320\024\355\306\214\274\232\001\367\272`C\220`<\317"
+	.string	"\352\246u\325H\241\200\356\2604\323r\b!;\220\363\025\343\003E0\364\305\224\332\024^\256\234\002\241\264\243v\311e\254J\3246y\f\027\247J\262I\355\357BA\033\235\364\257\036\2476\312_hp\312\266p \225S)/U\234z=\314H\243\247'W\317\214W\217\326<\262I\327\244\"\354k\273\273\2463\366w~\220\363\374\335u\376\322\311?\337\311\024YV@-\0041\200_\r/|\224\365\r\367Gr\"\202%\254\0241\254\340\201*/\203\312D\305\373B\321#\031`p\005%\364X@0\364:\262um\351\2149\243!\242\026u\271E\333\225qP>\244(g\036Ydn\367\020\351?/#\004\240a\243\346\303\r\314\273\203H\376L\302\204y\230?;\204\0341;\002\" \200\002\022\272\253\003rh\235\201\021\242:$\003\367I\201\230~\336,,\336\364\350zq\326\314\356\214\032\350\021 \2149h"
+	.ascii	"\243\235\030$\314\331\202H\341\275\347b\006\001-Ax\264\354\244"
+	.ascii	"D\220!P\250\261\350J\016+\013\207\232\002\271\274h)\031"
+	.text
+	.section	.gnu.lto_frskyOsdDrawString.64.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\201\001\035\017"
+	.string	"\006^gE"
+	.string	"\257(\035\025\210\024\242\016Zgv\277y\2179YH\215\331\002 "
+	.string	"\021\332\237\320\256\251\307\340\032\320\330\320B\341D\367\"\213m\253\006L\375\377\377\235\331\246\326w\266\b5Iq.6\007C\003Ad\023)S\nP"
+	.string	"Q"
+	.string	"T"
+	.ascii	"a\310\241\220;h\013K|p\217~\332\217\271\314\367\031\347Xc\367"
+	.ascii	"E\006gwC>\300=\026\270\200\355Q;h{\364g\273x\b\263\003Z\254\224"
+	.ascii	"\210\027\273\333)\210\177\317\317\277\353\032\240\n\365\314x"
+	.ascii	"\260\273NP\305\341\326\3336`\273\201\235\004\002\366k"
+	.string	"\376\317m~\317\303\237\373\314\037\267\264\266\2455\2463\246\017\240\203\325B\365\327\210]\r3\030\013\213'X\277\371\355\337\345\r\3337)_\226\365\304\264Z;\273\033>\036\255\300\t\026|\2679Yw]d]\322<\304\367\032\f\017\260\273b\201\263\033\037\331T5\r\261\270\254\344\314\035\371Q\273dB\036T\365\320\211\305\200eP\224=j\217\356:}\034\264\250h\265\244\332&7\301i\256H\311\2566\351/\013\034\266wW\205\017\314\3562x<\030\213z\315\360\360B\221\222\251\344\314\016Q\251\037\354k\273\273\326U$$\221\232PN<\315\364\323/\334\"\020\022\223'r21\225$t\336\250\2430\032!u\242\222\251\003\361\260wRR\352P<\257\324m\204{mue.6\203\251\350\212S\264\335\227\220\035\232\234\031\224\232~T\273Sl'q\027\204\020\035\020\301\235\263\331\021D\362\240\265\355\240(?\033"
+	.ascii	"3C_\215\241hC\035\331ha}\303,\341\036\2606\340AU\f\243\342|\271"
+	.ascii	"5\246\335\3065\346gwO\030\n]C\230\341&Ps\020\314\022\342:\r\261"
+	.ascii	"\204\213\3009\220\231\203\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_frskyOsdDrawStringMask.65.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\335\001\325\020"
+	.string	"6\241rG\360\320&\035zfi\325?\271f\316w-\021e::Pp\314\227\262q.\277{\202.\256%\312\256\216\r\004\0316\220\262\351\232\241\242uqP7\221\215-\357*f\243\365}\343\255\006\025c\333n\321\210%\233\310\235R["
+	.string	"^"
+	.string	"_"
+	.string	"\340w:<d\367\246\bhWL9%r\027\331D\032#\334\247/\355\253\370\n\3609\016ri\267\306\007hwSV\300}\036\270\200\355S\273\310\366i\320\276q\021g\t\304|dZ\344\330\335NK\034\274\004\375\313^\ng^\227$\t\273k\031\316\200\270\365\266\021\330\206`\313\r\001\376\316\217:\317\177z\317o\272\370\227\236\363o\234\364\344\2445\222\264n\322r\223~"
+	.string	""
+	.ascii	")\306\231\2173v=\314t\254\320\224a\342\343o\3772\233|\027\377"
+	.ascii	"\001?\266|c\326\303F\354\307h\367\303\310\247\035p\237\t&\203"
+	.ascii	"\022\360=.\007Y\330P\254Dy\\\032\310\302\330\210\350\244\316"
+	.ascii	"Y\004\0266M\247\246bF\300\344\314!\022\245\266\311\211|\250\251"
+	.ascii	"\001\240\243\023B0\372\262\252\255:\251\252\307\32083\251\235"
+	.ascii	"r\231\313\307\003\032\242\030\215T\033\303c\224T\026\311\354"
+	.ascii	"\270\332\253\303\370N\266\312e\254\017\234\335m\360\371\020\307"
+	.ascii	"\246W\222\315H$\263\343E\316l\361%\225\204}mw\327z\343(,\225"
+	.ascii	"~,+\236\326\3622x\252\371\335u\016\267\212\004\345\363L\\*_\353"
+	.ascii	"B\347\255:\r\253\023V\247j}\035I\001{+)\255\216\305\363Z\235"
+	.ascii	"I\334k\2537\346\216P\b\275(\314-\332nM\204\217\277\221\216\234"
+	.ascii	"y\200\234\212\322y\327\330\376\342\262\t\347\301\t\027\334A\233"
+	.ascii	"M\241\202|hmC\350\313\177! \240\202\231\311\252\003ch<bHNFq "
+	.ascii	"\2055\224U\216\030\271p\257\265\341A\215a4\316\367\255\261v-"
+	.ascii	"\323\0304]\026\315\321\356U\027\006\213\004\316-0\324\022A#\213"
+	.ascii	"k1\330%\356\362E\23733\007\030\r\177y\321\n2"
+	.text
+	.section	.gnu.lto_frskyOsdMoveToPoint.66.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"]\f"
+	.string	"v\230UA\020Q\234\016Q>\233Ni(\250\310C\345\335W\374\023\t\230\032\356\n\025p\203\325JE\244\036\254\372\200\336\373\247\370\304\262~\360=a"
+	.string	"\005"
+	.string	"\200g\0240\266 \245\302\241\377\331&J\2366\221;\245A"
+	.string	"B"
+	.string	"?"
+	.ascii	"G\001\036e\017KvI\250\025\273kq\202\354"
+	.string	"\363\300\013`\237\327\t`\237\006\355\030\027I,\305\344\"4\322\330\335MG\034\274\004\375\217\227\204\243\316%\200\006\273k\031\216:\334z\333\bl_\354{\b\237\0048\261a\364\025\310.\207\226\310~L\026%\276\361\333\367U\\ek\376\316\341\311\007\020\355\263\265\317\177\264\346\247\236\002\374\006\347\013Z\211\t\323\013\326\256\250\362iK\366IQqU\311>}i\377\024\036\230\257\342,\310\207\276\352\016BD5X \355X\252\355a*\365\241\221\253\215\341c\006/x(C\365\252\205X\205\204F<\262e\213\037\251\"\354_\273\273\326\222}\361\307\216\372\365\222\226\227t\233\177\327pc.\021<\356\301G\301\353&l\\f\253\220\201\240\3310\235\267]\f\230\333H\350\266\013\034\327m\232\350\371\265Zr6\243\343\303\243\037s\256]\022\203\361\003X)\331\362D\352\335\002;\307G\215\200\016\030\" N\241\202;\024"
+	.string	"2Ck\025\030\036U\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeLineToPoint.67.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"m\f"
+	.string	"\206\030VB\020Q\234\016A\336\303\267q\213r\275r:^\324\375\025\213\205\326\330Y}7\335\303\265\312\370\367\023\363\032\350\275\177\212O,\353\007\337\023\006P"
+	.string	""
+	.string	"xFV!K\367\021\r\372\272\353\342i\320&r\247\024A"
+	.string	"B"
+	.string	"@"
+	.string	"'\001~\303!\236\354\232>P\354.\306\007\262\317\002\037\200}^\027\200}\032\264]\\\f\261\226\024\213\3218cw7\005q\360\022\364?~\022\226>\227"
+	.string	"\026\354\256eX\322p\353m\033\260\235\261\277!\247\004\030\361Q:\310\212\335\f\255\032;2S\210x\307o\337?\361\225\255\371\273\207)\034bh\237\255}\376\2435\237\343&\300wx\276\242\235\240R-X\273\244\313\2471\331\247EE\221K\366\351K\373\252!\230\277\342(\310\207\376\352\fd\220h\260D\372\261T\333\303T\352G%W\333\302\307\013N\360\360\205\352U\363"
+	.string	"B2*\001\311\226-\206\244~\260\177\355\356ZO\366\305\037\373\306\257\227\264\274\244\003\235\177\307pk2\017<\256\301'\301\353\"l\334f\233\260q\300\3314\235\267e\b\230\353@\350\266\n\034\327m\232\b\372\265zr\006C\305\bHC\366\\\273&\005\343+,\016\3312E\352-\202\335\343#\347\225\022$\250\016\252\020\301\035\024"
+	.string	"2Co\025\030\036\365\234\005\306\330\n\310O\336h\332\037\323\356\342\032S\262\020A\2041\230 \342\302\341^\023r"
+	.ascii	"s 3\0075\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeTriangle.68.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`J\002\215\020"
+	.string	"\266\336kG\340\262(\035SbP\025xp\350\037\021\273\303}\004\363\225\252_}\216\345HktH\016\022-\322\303!\333\260\217\346\373i\215\315x\211\006\214h\2141\3066>\320\366(o\t\235\203\325\032\377\036\377\331,\331{\313\224\002W"
+	.string	"S"
+	.string	"V"
+	.ascii	"\245\375p\002\204\203\233\036\223\214\307\027\263\261 \364\351"
+	.ascii	"\253\375\232\263X\335\3067{\2732/l\273\313\300\tB\237\007>\240"
+	.ascii	"\373\224\027\320}ze\373xL\305\026\240\341q\271\340\331\335/\246"
+	.ascii	"\370\352\272\362O\273\367\202\275\\A\023v\327\372\202\215\270"
+	.ascii	"\343m#\260\035\301V\035\001#\217\375\242\333\374 \251\356\244"
+	.ascii	"zJ\265\224\352(\325*\325'@j\021\002\366ZmW\304\017\221\305\315"
+	.ascii	"\235\025\317\371\355\373\265\333\354\221\303\353XT\242\310(\264"
+	.ascii	"G\237?\315#\037\306c\254\236\343\362\205Y\017G3$\267\033\243"
+	.ascii	"\340\323\020f\336\214\304\003\034\337d\267\235\202\220\230\236"
+	.ascii	"\034L|q\227\203$v\363\306J)NY\203\024e\234\3012\022\243F\033"
+	.ascii	"\274\fQ\324x\227\317\243\315\341;\036\214b\247N\353`\224\317"
+	.ascii	"\277\200\200\342#\251U\243\341\362a\351\217\035kiDa_\356\356"
+	.ascii	":\316\330\237\375$\307\371K\277\371I\227\375\001-?\t\365D\245"
+	.ascii	"\246PM*5\t\325D\245N)\271\220\002+\204+)\024\206\017<}\032N\026"
+	.ascii	"X\276\024T\352+1`p\203\n\352k\001A\3247\212\261.7\3168\024\244"
+	.ascii	"\007\307\212-\273\310]\031\t\264\007\310\311\324\273qt\3279M"
+	.ascii	"\005\300\217\035=L\324\354\356_\r\356[\347\3332\234\364/\007"
+	.ascii	"0 0\003\221\031;3\241u\304\220,\241\020%tl\030\360\270|\260\345"
+	.ascii	"\274+\314%\310\351\273\207\340\203-'\357\036\302^\242\034\361"
+	.ascii	"\232\024d:s\033c\355\353B\343!&\004\230\371o#\3426PL\320\256"
+	.ascii	"\330\205x\216\305\004y\260+\231\023\330\221\214\223\330I\206"
+	.ascii	"N8h,\340-/\004F\006"
+	.text
+	.section	.gnu.lto_frskyOsdFillTriangle.69.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`J\002u\020"
+	.string	"\266\036kF\340\222*\035\243\177hJ\300\220<\3663\341\025\226g\336\201\322\264\t\030\232\3071\227"
+	.string	"\204\262\225|\37524\232\303\374>Xs0\270\365E\b7\3140G\027\210\216\361(m\016*B\263qv\373\212\266F\366\3362\245W"
+	.string	"R"
+	.string	"U"
+	.ascii	"#^\032\320\354Jd9H1\234\017f[\340\371\364\325\276\314U\244>c"
+	.ascii	"\234?\2731+n\273\313\300\t<\237\007>\300\373\224\027\340}:e\343"
+	.ascii	"8\314\304\026@\221\303b\321cw\277X\342\251k\312\177\355\237\226"
+	.ascii	"\253\345\332\211\260\273\326\226"
+	.string	"\353\303\035o\033\201\355\007\266\342\004 \207\375\240\317\374\035\251\366\244zJ\265\224\352(\325*\325' \262As\335\266\333}\331\375\330\334\2649q\332o\337\267\375f\207\034\276\306\240\020\262Ph\207>\377\232C\276\213\277H\235\306\362u\331O.\205\007\335.\214\202O;\230}f\306\311\321v\b\277]\002\017\030\037:\227\330b\257FH\364\346\214\224Q\234\362F\024e\224\241\002\022\243F\033|\fP\324xV\316\243\255\3416\034lb\237^\333`\223\317\267tt\342\243hu\323\202\225\243\322\235\r[i$a_\356\356:\276\354\317\376\220\323\374\243\313~\321c\177+'\t\225\004\245\244PI(\035\tu\004\245>\021\251p\002'\204)'\223\205\017,}\030J\024T\276\023\323\351\0231`0\003\212\351[\001A\323\027\202\251.7\276\354\331\001\"\247\212+\263\310\335\030\b\265\007\320\305\364s\323\360^\363\032\n"
+	.ascii	"\0307^\"dv\367\255\222\033\347\371\267\013%}\313\0010 0\003\221"
+	.ascii	"\031;3\241u\304\220,\241\020%tl\030\360\270|\260\345\274+\314"
+	.ascii	"%\310\351\273\207\340\203-'\357\036\302^\242\034\361\232\024"
+	.ascii	"d:s\033c\355\353B\343!&\004\230\371o#\3426PL\320\256\330\005"
+	.ascii	"\361\260+\031'\260+\231\023\330\221\214\223\330I\206N8h,\340"
+	.ascii	"-/\004F\006"
+	.text
+	.section	.gnu.lto_frskyOsdFillStrokeTriangle.70.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`K\002}\020"
+	.string	"\306^kG\340\262(\035\243\333\324\232B\033\331\246D\344\340B8/\200\277\002=\240\236\261^`\n\003E\236\032\r\207l\303>\232\357\24756\343%\0320\2421\306\030\333\370X\235\003\274%t\016V\353\370J\350\177kd\357-S\nV"
+	.string	"T"
+	.string	"U"
+	.ascii	"\245\345 \242\303\202\232\037&\332\roF#\001\350\323W\373\262"
+	.ascii	"\243`\235\3067\207vcB\333\356*\360\001\320g\201\007\350>\345"
+	.ascii	"\001t\237f\3318>+\261\003f\\^*x\354\256\027I\234ue\371\017\037"
+	.ascii	"\202\305X\256\037\b\273k\205\305@\334\361\266\r\330v`k. \237"
+	.ascii	"\375\242\323\374\037\251\356\244zJ\265\224\352(\325*\325\027"
+	.ascii	"@\252\341\022;.\307\356\207\036\037\233\2339&~\363\333\367]\334"
+	.ascii	"f\217\f\036\307\"\230\025#\320\036}\376\241G>\213\267`\375f\345"
+	.ascii	"\333\262\241\334\214\007\235\335\027\004\237nP\013\325`\030\330"
+	.ascii	"\370&\003\267=\302\316K\017\235\226\310\342n\206H\354f\f\224"
+	.ascii	"R\234\022G\2122\302H\001\211Q\243\375\375\205(j\374\213\347\321"
+	.ascii	"\316\360\234\r>\331\252\207\032|\372<L\307'>\222\\\270\235\027"
+	.ascii	"OK{\354\231K\343\b\373rw\327Q\306~\355\027\271\315_z\315O:\355"
+	.ascii	"\017*/\001\265d\245&PM+%\001\225d\2456\031\241\240\372$\200("
+	.ascii	"\252T\005\357Cy\027P\023R<\223\224\312\033!\340\017\303I\312"
+	.ascii	"S\371\276\2247\232\265.7\312\030\264\343D\256\025]^\221\2731"
+	.ascii	"\017\302\207\350\3204t\313\350\216\363\360\344!)l\310B\310v\367"
+	.ascii	"\260\323}\353|\233\005\224\036\3460 0\003\221\031;3\241w\304"
+	.ascii	"\240,\241\022%\264p\030\360\270|\260\345\274+\314%\310\351\273"
+	.ascii	"\207\340\203-'\357\036\302^\242\034\361\232\024d:s\033c\355\353"
+	.ascii	"B\343!&\004\230\371o#\3426PL\320\256\330\205x\216\305\004y\260"
+	.ascii	"+\231\023\330\221\214\223\330I\206N8h,\340-/\004F\006"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeRect.71.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\245\001\245\016"
+	.string	"v\\bE\360\2606\035\3330\370\312\225M*\037\237\256T+\003\300\340\267`\025\027\206\224\005Z\034\274\326\336\353\354\373W\231\350\264$qt'q\352+\026\272\211l\336Y\247HL\347\275D\307\340j\300|\277\355\311\336r\247\024M"
+	.string	"M"
+	.string	"K"
+	.string	")\234\217/\364\270>\375h\337\345\250\356/\266\261gw\005E\263\273\037Vp}\"x\001\353S\236\200\365\351\316\226\361\317\304\032h\001aRqcw3-\361\356\261\363\017\336\343\235P\036\001@\330]G\357\364\341\326\333N`\273\201\035#\004\237\177\377\365\227\177\312h)\243UFG\031\375\216"
+	.string	":\341\3517/v=\254rl\316\2549\361\230\337\276\337\342\241\215yt\031\177D\314`#\033\373\374Ac\376\212\263\350\036s\362MY\017\212\226\020\252]\025\217O3\270>\027X00\262\341%\330P\301\241JQ\024K\265-\334\005H\245\252-z\r\311\301\222\217jT[;\315\245Qo\332\271\332\032>c\342\020\233;\310\301!\237\367fL\275b\245\033\035\323\016)\256\354\257\024\225\204}\271\273ke\261\017\363\203\236\372\003\333/\334\344\243w\270C \0248m\302\210\204\333*d\232(\303 \022)\311B\033\227\201\034\260\226ad\3136h\332\226a\037\351r\225\305W\rT\016IK>\221\273+\017\300\017P\245\342\312\035\321\272q\254\313\034\024\021\220\"\006\215\021.\236\203\333\306\362\303\320H\274\347\007\037"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdFillRect.72.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\245\001\245\016"
+	.string	"\266\334bE"
+	.string	"\261&\035\320\226|{\205U\325\236"
+	.string	";\177\354S\"\277Eb\316\345{\344W\206\241\372\354g\270\240\272i4\2423\037`0\006\334?\323U\257\252\326\212\373:5\034:9!4\242\177DS\213T\262\267\334)\005M"
+	.string	"N"
+	.string	"K"
+	.string	"\032\252\006\004L}`\237~\264\377\362\024\336a\274rg\227\3454\263\273 V\200}\"x\201\353S\236\300\365i\317\266q\320e\r\234\\J*pvWS\022\367\036=\377\341;\237)\345\021"
+	.string	"\204\335u\374L n\275\355\004\266\033\3301B\340\217\035\346\2372Z\312h\225\321QF\337#"
+	.string	"\r\017\246\333\274\330\375\320\332\2617\223\346\304e~\373~\213\253\354\314\242\247\354\t\261\302\331\335Ldg\237\177\350\314_q\026\336eP\276*\333Aq*\301\332]\371\3704\003\354s\301\0253#\227\220cE\007KES,\325\266p\030\037\225\252v\3504%\017M<\252Q\355\3553\230F})\347jk\270\213\023\213\330\335C\016\026\371\374wc\3525#\331\304(\345\214b\313\006IQG\330\227\273\273\326\026\3731\377\347\250\337\363\334/\374\344\242w\270A!\024\272m\202\250\244\343*h[H\303\020\0321\321@\\\247\205\034\360\226\201\204\3236l\033\247e\340\350r\265\305\030\216\232\233\221\222\214\"wY\036\204\037\300B\305\226=\342u\313\270\236z8\"\300T\303\204\210\227\317\301\275\272|\025\210$\376\363U\001\036"
+	.string	"3Ck\215amC\251\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\025]h\202\260-4F\304\231C\273\204q\001\342\001\307"
+	.ascii	"&@\036p\f`\002\344\001\307\034\024jp-/\204I\006"
+	.text
+	.section	.gnu.lto_frskyOsdFillStrokeRect.73.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\246\001\245\016"
+	.string	"\206\\bE"
+	.string	"\261&\035\320\207}\232S\353Zo\346\226\037t\204bp\303\341oZ\207\315\353\340"
+	.string	"\n{\n\027Tk\026\215\350\314#\036\306\200\373g\272\352U\325\372\007\002\312\311\276_O\b\215\322\033\320\324\"\225\354-wJ\001M"
+	.string	"M"
+	.string	"K"
+	.string	")\030 ^\213\017\354\322\207\366]~\202\373\213m\334\331]\371hv\027\304\b\260K\003\037p]\306\013\270.\315\331\253{\"\226@\313\210\023\212\033\273;5\304\271C\316\377\367N\207\"\035\002p\260\273\206\035\252\303\255\267}\300\366\002\033>\b\236{?\366\227_F\350\030\2415B\303\b\375\216"
+	.string	"+\025\352.Z\273\034Z9\026G\326\220\270\314o\337Wq\225\235y\364\031{<\274\310Fvv\371\177\316\374\024\217\341.\203\362M\331N\211\026\023\254]\225\217K+\300.\023\\0\253\031\252C\260\241\202\203\225\242$G\265)\234\305G\243\252\035zM\311?\023\217*T[;\r\246P\177\312\271\332\030\276\342\304\"\266\350\237\006\213\\\276\233!\365\232\231nbN9%\330\262=\023T\020\366\343\356\256\225\305>\314\377y\352\017\333+\374\344\243o\270A!\022DZ\204Q\211h\2330\265\320\264\020\0321\231\240M4C\nX\273@\262\315\f\232\266\315\314+=\256\262\030\253A\003\247\244&\243\304\335\225\006\337=X)\330r\007\274\356\233\3533\377F\356A\222\021\343\203K\307\340\266\271|\025\210\004\276\363\003\037"
+	.string	"2Co\025\030\036\365\225\025X\021D@"
+	.string	"u\340m \b0\003\020&)2}r\033sm\347B\0236\023A\230\021\032#\342\314\241]\302\270"
+	.string	"\361\200c"
+	.ascii	"\023 \0178\0060\001\362\200c\016\n5\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_frskyOsdStrokeEllipseInRect.74.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\246\001\225\016"
+	.string	"\206\334aE"
+	.string	"\261&\035\340\363@\274R\3762T\345\203\376\347#\316\342\206\330\213\377\033\336\n\355\240\262\247!\\P\3354\032\321\231\0170\030\003\356\237\351\252WU\353\037\"\032'\034:9!4Jo@S\213T\262\267\334)\005M"
+	.string	"M"
+	.string	"J"
+	.string	"\250\027\036 \213\016\354\323\217\366M7\341\375\344\031svU`bv\327\303\b\260O\003\037p}\312\013\270>\355\3311\016\216X\002,&\322\211\031\273\253\251\210{\217\236\377\360\234\257t\362\b\300\301\356:~%\017\267\336\366\001\333\013\354\370 \235\203?\366\323?e\264\224\321*\243\243\214\376F\200\032\016\245\253d\354vh\331,\315\224!q\227\337\276\257\342);s\350/\356|h\221\205\354\354\363\017\235\371(\236\302\273\213\311\027e9%XN\253\335\224\216O+\300>\023\\-5\264\251C`\245\320X\241\350\211\245\332\024\276\302\243R\325\006]f\344!IG5\252\275=\006\323\250'\335\\m\f\207)1\210\335=\324`\220\317\1775S\257\331H\305\"\335\210b\313\006GQC\330\227\273\273\326\025\373-\277\347\250?\334+\274\344\241o\270?\037\022\272-Bh\244\343&h\033H\263"
+	.string	"\n!\321>\\\247}\024\360vA\204\3232l\033\247e\240\350ru\305\030\253D#\322\221M\344\256J\203\360\034+Tly#^\267\352\372\313\303\220s\270\200a\003\302\3641\270g.?\365\021\211\377\374\037"
+	.string	"3Co\215\201mC\275\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdFillEllipseInRect.75.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\246\001\245\016"
+	.string	"\206\\bE"
+	.string	"\2576\035\223m\252\236\205\222\271\302\220!\342$p\361\215f\001\264G\302\257a\366\344riY\254\242\334\252\034a\361\234\312\005\270}F\313U\277\364\353h\035P"
+	.string	"\027\302\2442M\302YX\214\336\035\311\336r\247\024M"
+	.string	"M"
+	.string	"K"
+	.string	"\250\027\036_M\307\365\351G\373.'\321\375\3054\366\354\256\2042\273\353\341\003\327g\201\013\260>\345\003X\237\356l\234\177 v@K\312dB\306\356f\372\341\335c\347\037\274\307;\235<j4\330]G\357\304\341\326\3336`[\201\035\035\004\237\177\377\365\227\177\312h)\243UFG\031\375\r"
+	.string	"1\302\323mX\354nX\315\330\2339\023\3421\277}?\305C\033\363\350)\177TZ`#\033\373\374Ac\376\211\243\350\036c\362EY\217\210\226P\265\233\322\361\351\004\327'\002\013F'\013\341\037\344\244\350\250P\364\304R\355\t_\001R\251j\213>3r\220\344\243\032\325\326.si\324\233v\256\366\205\253(1\210\315\035\314`\220\317{0\246^\261\222\215\013\323\016)\256\354\257\024\325\203}\271\273ke\261\017\363\203\216\372\003\333)\274\344\243k\270C\037\0218\r\302h\204\333$d\232(\253 \n!\311B\033\227}\020\260fAd\3130h\332\226a\037\351r\225\305W\216\312\rIK6\221\273+\f\300s\250Pq\345\215h\3355\326S\007C\316Q\002gD\007\027o\301Mc\371aH$\336\363\003\037"
+	.string	"3Co\215\201mC\275\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdFillStrokeEllipseInRect.76.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\246\001\245\016"
+	.string	"\206\\bE"
+	.string	"\261&\035\320\316\360\366\036\371\024L\017\037\324\324L\234\305\r\211%3=\350\r\376I*\236\206pAu\323hDg\036\3610\006\334?\323U\257\252\326\177!4N\366\375zBh\212\317"
+	.string	"R+\211do\271S\nM"
+	.string	"M"
+	.string	"K"
+	.string	")\236\020O\006\bv\351C\3730?\301=\3067\376\354\266\340\324\354n\210\017`\227\005.\340\272\214\377\270.\315\331;\367D\354\200\027\030'\024<\273;5\304\271C\316\377\367O\207R9\344h\260\273\206\035\252\303\255\267m\300\266\002\033:\b\240{?\366\230_F\350\030\2415B\303\b}\017"
+	.string	"\254\r\250\347\264\330\345\320\272\261:\322f\304g~\373\376\212\253\354\314\244\323\030\344\201FF\262\263\313\377s\346\247\270\n\3563)\337\225\375\220x\301Y\355\262\200\\:\001v\211\340\222i\315\252?`\261\330X\255\250\212\243\332\023\356\242C\243\252-\272\215\311\277\023\220*T[{\r\246P\177\352\271\332\027\316\002\305#\366\350_\006\217\\\276\253!\365\232\231r^\234zJ\260e{&\250 \354\307\335]\253\213}\231\277\343\251?\333)\034\345\244k\270C\"\021F\032\004\222\311h\22305\321\254 \"9\231\241m4E\bX\263P\262M\f\232\266\315\314+=\256\272\030c\231\320)\251\311)q\267\205\301\367"
+	.string	"\253\024l\331\003^w\214\3534\377H\376Qbg\306\007\230n\301}s\371\252P\t|\347\007\037"
+	.string	"3Co\215\201mC\275\262b(\202\b\b\240\016\274\r\004\001f"
+	.string	"\302$E\246Onc\256\355\\h\302f\"\b3BcD\2349\264K\030\027 \036p\f`\002\344\001\307"
+	.ascii	"&@\036p\314A\241\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_frskyOsdCtmReset.77.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"]\007"
+	.string	"B\31636@\215\222\016\274\201\276L<\202\311j\201\365\236\200L\237\255\271\262\243\325\200yy\370\177}`\323\261\345~I)X\377\214#\272\354\274#\373\355\352\322\316j\333'D\246c.\f\234\246\260y\3406\207\250ebDf\001\"b6.^\n\326$\032\2668\241i[\314R\236Z\022\222\256\251\001 '\021k\345\201\237\257w5\330\375\004;\244\213`\027\265\241x\005]T\023RD\254U\005\354|\352\363\240\306\327\222\220\364P\243\n]\214:\322\312\f\265V\262\344Ru\374\275\247\2428\365x \003\245\224\231Y\257\347|\326\253\331\335\2334\305\221\004&\022\213\017\225\314\214p\243]_wk\252"
+	.string	"h\324\351\003@\310\314\037h\204\321a\177\203\377\340/\005\t"
+	.ascii	"2\241y/\360\341\002t\r\307\036\342\r*\372\345^p\351\026\355|"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_frskyOsdCtmSet.78.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\334\001u\017"
+	.string	"&\034eG\340\2626\035R\342\206\260\367\263\007\252\243\27791{\312B\324SP\024\b\"\210\214A<\200?l\332\353\177\333\260\017\3434w4\370\241\001 \210s\030C8\035\264\367\210L7\201\202P\367F\025j\277\365\247M\366N)L"
+	.string	"R"
+	.string	"P"
+	.string	"6:R5\242\275\372\323>\352'\306\317x\345\317.\214\023kwGl@{%p\001\331+\366"
+	.ascii	"\331\253G;\307\311\021\033:\335\340\200\242\307\356rT\304\307"
+	.ascii	"\317\321\177\371O\311\324\362\351q\260\273\236%\023\314Mo\273"
+	.ascii	"\200m\b\366L\t\307>\363O\221\220"
+	.string	"\0379\246\317\240\261\353\362\332Y\234\312\242\304o~\373\376\352,{\263\350*\203b|\230\330\335Mdo\257\177\351\315Oq\025\343oX\2760\253\345\234p\264v_\016\274\372\201\366z2dC\202A\215W\230\310v \271,\240\331A\220\n\342\266CG\215\017\250\222W\334.2\237\265\242a\276\344\263\036\301\365\242\323\332@[\f\022\243\202P\332\013\232\321\026\023\363>\223\332\356^ze\005\tbx\350x\030\315\227M\222&\ra\037\333\3355\225\261o\363\203\274\346\007\235\346\327\236\372\263\223\017\"\312J\005\223\f\231W\362\321\256\344\243\236\367\321\316\373\250\327}\264\353>\352\023\222\t\"(ADA\fS8P\205\263\240b\362q'\241\310\221\f0x\001%\3440\200`\310m\344\350\330R\031k.\027\316\210\222\314\202\355\202hP\036@+5_\366\314\320-#\273\352e+ \020\203\221\232\270\0013\2415\306"
+	.ascii	"%\241|\3301\2321\262+\3071\026W\236\001\346^\246!x\206\273\006"
+	.ascii	"\266\034\261\272p\356\201UG\200\365\016\316~\242\360a\376\024"
+	.ascii	"d\206\367^q\216\346df\020\344\301\216d\234\300\216d\234\300\216"
+	.ascii	"d\352\204\003b\201\267\274\020\006\031"
+	.text
+	.section	.gnu.lto_frskyOsdCtmTranslate.79.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"%\f"
+	.string	"VWS>"
+	.string	"3\324t\\c\247"
+	.string	"v\331\251\034\t 7\356\314\226\304\320w\322kb\333\001\004Z\275l\266&h$d?\207~\240\323\024(\001"
+	.string	"\320A\273\036\032\311\362\ba\373?q@A\215\354\235R@"
+	.string	">"
+	.string	"B"
+	.string	"$\247\034\331\2751\203\306\3566\260\202\355\031\202\027\320\236a'\240=sh\353\370\330b\r\210~\214 y\354n\245,\036~\206\376\311GD\217\346\023Baw=E\317\347\246\267\235\3006\004\373!\002\236\343p\355\226(},+S\275\270\351\267\357\3138\312\346\f\376d"
+	.string	" \016\264\271g?i\316.=FxS\346\373\331wr\210\312\326ng\3013\327q\033W\f\266g\376\264?:\214\360\001'\277"
+	.string	"5v\270"
+	.string	"\215D\253n\033\232\217\302|\230\027}\324+\270:\257\226\b\2521\366 2\251m\007'\235\262\204\b(\312\327\211\315,\355\2213\351\n\373\330\356\256i\310\376\370c'\375s\023\240\202D_\005\243a\342A\003/\023\304e\232\"\271\360u\026\300\f\237\207\241v\226\312\3012\331P)\336W%\007\334u\250x\365\322u^\345\306\315\261\245!o=L\2606\224\343\f\266\233b\002\371\001\255\322,\r\231\333\275\322~\n\025"
+	.ascii	"2Ck\025\030\036\325\216\005NiE\006Aj\316\005\347\035\202k\342"
+	.ascii	"d\307\206\260\2150V\0026\2402\201vMp\001\342\001\307\034\024"
+	.ascii	"jp-/\204I\006"
+	.text
+	.section	.gnu.lto_frskyOsdCtmScale.80.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"\035\f"
+	.string	"\346WT>\0203p:\230\277\005\254\024A~\314\222N\243>\370\365\307>#\013ME\300H\364\301E}\336\"\276]\020\206\004\372\363\300\017\002\021"
+	.string	"@\031a\217\375e\002\022\204\222\244\324\277\221\b\331;\245@"
+	.string	"?"
+	.string	"D"
+	.string	"\336GFY\262\233#\254\261\273\r\254"
+	.string	"\273\205\340\005\256[\325\t\\\267\354\331=.\256X\003a\t\022#\220\335\2554t\357\323\363?^\362\201\232\317\b\205\335\365\374@\317Mo;\201m\b\366E\004\337Q\356\232(\207l\312\262\321\342\245\337\276/\343';sw\223\001|h\270\330\335\254\263\263[\377\350\314&=\206\367R\346\353\331wx\204'\310\335\316\202[\256\"&\242\030`\267\374i_\3640\246\217\\"
+	.string	"\320\007\371\021}\276q\343\270\374\023\006\304\374\347\237^\341G'\b9\202j\\=\220Lj\333\301G\243,!\302g\306\013\024\233Y\332\"gR\025\366\253\335]S\220}\361\257>\372'& \304\002\f\234\005\243\201\362\341\352\270\031\202\233\256L.p\232\205.\003\267a\250\332\245r\270P6\324\312\306\325\311\001k\035,[\365\240i[\315\304\315\253\245 cB`\2446\224\343L\265\233b\302K\377\370\001$i\226\216L\354\326q=\023"
+	.ascii	"2Ck\025\270x\224\224Vd\020\244\346\\p\336\201\270&\016\021\006"
+	.ascii	"a\242\004b@\025\002\367\232\220\003\230\003\2319\250\321\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_frskyOsdCtmRotate.81.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\365\b"
+	.string	"\226\321?90q\323\001\200\306\0252\232\247[c?\224C\037\233\314_\245\020\317\320_`\262K(n\366m\355h\235\005\326\217\277\013NF\004\203\001\356u\252y\210:F\030\2767\331;\245-"
+	.string	"/"
+	.string	"0"
+	.string	"\247\330\013\262S{\366\314G\222=P\201p\240\334\354n\235#\367.=\377\342=\037H\272\004p\330]\313\017\374\270\347m+\330f\260-\023\273\036;:\373\242.&\376\311Y\243\217\026@\265\264S{dk\247\327l_\332O]\345}e\026{v_V-\273\247\006/\004\234&\334 \013\037/ze \244&D\245v\367\237[\267+\363Y\032\"\371\317g\375\301\346\204C\2631I\366h\222S\304>\266\273\353\031\332\223\240D\005|LJ\334\r\372Ht\033\204\250\242\343(\352\026\252\027\241\b\213\n\342\272\372A\360\2061\301\325\214m\343\2526\226\216\355\f}\361\357\310q\275J\323d*\261\033&\013\n"
+	.ascii	"2C7\0258\340\302\221\313\220\246\342\005\215\215\205H\315\352"
+	.ascii	"\n\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_frskyOsdContextPush.82.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\007"
+	.string	"B\016470\217\222\016D\341[\333L\026X\221:a\231y\006\330mr\"\r+\203\203n\341\377\375\351m\364\214c\2343\376\r$\fr\021\\Z\332,\030T\325\203\265}Bd\nk2\f\234\246\300y\3406\207\250mb\304f\001\"j6.f\n\326$\032\2668\241i[\314R\237b\022\222\256\251\001$*V\213\365\201\240\257w)\260\373\n;\245\253\260\213\342X\274\206.\252\t,\032-\326\005\364|\n\364`\307\027\223\220\364\260\342D\2241\252\312*S\364\342\222(WI\310\337{*\252S\221\0078LJ\231\231\365\372\316g\275\232\335\375JS\037Ip\002\301\030i\311\314\b=\332\365u\267\246\n\204F\236>"
+	.string	"\204\314\374\205F\033\035\3667\370\017\376R\t"
+	.ascii	"2\241y/\360\341\002t\r\307\036\342\r*\372\345^p\351\026\355|"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_frskyOsdContextPop.83.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"e\007"
+	.string	"\002\21637@o\222\016x\r\200&\301\231\256\3516\351\364\333NX\367\006\331\237\020;\225R`\377o~:\234\255(BV\352\270\207E\201p\215\251\216\b\2449\213\006\352f\t\221)o4\f[\246\320y\3304\207\230qb\004g\001\"n\264-j\n\316$\032\2648\221eZ\304:P3\tK\327\324\200\222T\367\242\002\301\320\326\273\024\327\275\345Z\245\237\\\027\325\261x\025]T\023\\4^T\027\360\363]\350\301\216o&a\351a\305j\224A\352J*s\024\003\223)\226\t\310\337{*\312\323\221\0078P\260Z\357y\254V\261\271gi\367\221\004'\021\f\222UfF\350Q\256\217\2735U@D\372\364\001 d\346OD\332\350\260\277\301\177\360\207\004\n"
+	.ascii	"2\241y/\360\341\002t\r\307\036\342\005\025\306\251\310\227{\301"
+	.ascii	"\245[\264\363\t"
+	.text
+	.section	.gnu.lto_frskyOsdFlushSendBuffer.part.0.101.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`^\005e "
+	.string	"\006\272\310J\240\024R:\024\027l\323\005S\232\f\372+Ql\0162|\372\f\235uj\214h\227\332C\321|cU\351(\264\330s\252)\201\2748)g\2037\364~\214\2273E8\001\367\013Dc*\300w\002\306\221x\265\377\033!D\356\224\002\263"
+	.string	"\255"
+	.string	"\257"
+	.ascii	"\025\030\241v\223\n\310@\"/\022\364)#gZ\030k\220\3264\354\202"
+	.ascii	"\252\271\351\006\265\2333\037p\336,\037\340\034\362(\352G\001"
+	.ascii	"\3318\334M!\266\201\200A\366\225\033\211"
+	.string	"\265@qxd\244K\255Uwsm\270,K\337\370\322x\3236\350\266\032\3554\313\245\267 ?\352\013\204aDc\307\240\320m\nj(\t_+iEI;>\005\270T\342\230%\275\376eDi7\0373~\326f\334,a\304\212C\231`Q\tA\230%v\256S\030A\"ZR$\0372\276\347z\371C\210\234\032;\006e\234\002\370\215f\241\326\352\017\ro\334mg\331\276`\233\030\002v\017\005=\222\217\365\307\250*v\225%\213V\210\356\223\367v\034\242Y\322\353d\237\324\271\222Z\306\244\216)\251ap'\365\255\244\266\335\353\256\321N\352\263\2446\277u\227\247\272\327\244\246%\365\021\224E\250\034S\255Ig^*\r\323\213\307\217\277\325O\365o\375^>\222//\032#\rTqG\262Vc\315\215\317\362\271\214\333\322\252ZF\276*\325\277 \026s$k\2559\037r)\337\310\257\216e\334\321\017$"
+	.ascii	"\375\310/\tXk\327\003\tA?\362+\353\022\205\"\261G\255]\023\254"
+	.ascii	"\252~<#\004\254\372y5\252\177\341T\274\221\254\001k\265\244("
+	.ascii	"x\232\353d\\\223\245\255\211\203\326\274\\\030\273\373-Sa-\250"
+	.ascii	"\231\367T\230%F,\035\274\\\332\022h\032B1b\":\367]\307\342\251"
+	.ascii	"\315\230{\356\255\254\370\325\257Vk\3051\367\\7\223\b\225\004"
+	.ascii	"\361\032\242g\336_JS\025 \273O\266\005\320\362vr>\353W\034r\210"
+	.ascii	"Ht\355\016\036\350\221vg\214V\310_\272\213<\372\342\017\017\373"
+	.ascii	"Q \332 \376dgCVk\275qr0\035_\307M\217\340\321#\361\316\233\337"
+	.ascii	"'\205\310 R\376\357\374\361fP\213\006"
+	.string	"\023T\226!z\346\0335\221#\177\026\243t\271Q\0067\362\364y\316<\036\335\371v\353\323\331\331Q\021\342\324a\301\323@\"\305\210\036\035\0237\357lD\370\364>\374J\370\370vt=\236\256\207\007\202G\267\363\371\350l\f\270wB\307\247K\321\353\371t\364\353d\373w!V\026eh\211l?V\277\262\326\0329\311\"L\276\345w\200L\313.G\314B\223\242E\226\333#/\263\271\375\321\227\037/\263\307\002+[\032\242g\265}r\356x\342\32643\035\263\265\2458\246\300`6f\237\374\335\020k\2557Xv\016\256\300\354\315\r\251\262\326Zi\373d\373\2479k\213\333\004DC.\267}\022\333\336zN\345w*2[\303\3116T \216\355\"\210\331\366_\317\240$\\R\026n\250Q@\243\024S\246D\202\031\221Y\3404\006\200\002\031#\253:\021P\275\204j$\251\266\003\234\205\264\311\274\023\223\tA"
+	.string	"T]\0046\250\304\216c\241#\330\001\364)A\021\351#b\253n3\025\261\205\005\264\004\357\004b\245Y\271\346\321C\314m1\220\373\240\222F,\304"
+	.ascii	"n`\2053\322\032\306\257<a\275\310\347^\255\217|\2471/\356\317"
+	.ascii	"\324Sc\032\327\231\326NJ*\260\355_\232\2162U\224\215\323\360"
+	.ascii	"m\002\302\350\316\024\213\024\233\td\245\001\237\rgN'\217EP\331"
+	.ascii	"\016\t#\360^\214^`\007\231\231\341[\273\314\275|\271\031Q\035"
+	.ascii	"p\006\027\201\022\344\r\354\317\275\356\244\230\200r\222YK\344"
+	.ascii	"\362\340QS@7\024M\265\fx\017IhNz\211\273y\247\273\026\020N;\220"
+	.ascii	"\341\325q\246B\266\031&\003\337\037"
+	.text
+	.section	.gnu.lto_frskyOsdClearScreen.part.0.111.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"M\n"
+	.string	"\266QB<\020\005+\035\240\301\345$\244\016Gb\203\002z^\327\035!\234\024\345!\212\274\360B\363\352\253\273e\216\032\030Da\373\257\b"
+	.string	""
+	.string	""
+	.string	"\204P\304^~\223\n\343\332\212\325v\b!{\247\0240"
+	.string	"/"
+	.string	"4"
+	.string	"\365\265\005\260Z\007\315\266\273\364\335,\371\351Sr'_\252X\250\317\327\023\300\244fZX\037\227\003\347\002B\273k\016\310\335\335v\203m\004\373\013\001\240\321\244\327\327\352#*\232\230m\267\322\337g\371l\274\314\f\255\033\312\350\257\274\226.s\247\005\240$}\025\223\375}\357\236b\333\344\341\223]{~\0253\344U~}'\346F\206c\242\344tyr\347v\222\330\223\203\335\004BvW\001n+\322\271\234\320\374\001\231L:@\315Llb\266\335\250\n\266\375\t\026y D\320a\234\020C\t\n\216h\305\350\201\202\212B\221z\f\fZD\204\024\003\004C\372\331\226\017i\314\324\234.\333\034\351_x\276k\274\204\373\305\013\032"
+	.ascii	"0BE\200\204\t$T\221\002\310\003#\\1t-X\302\304\211N<\340\213"
+	.ascii	"\002\002\003b\340\236P\333%X\354lw\246\360\242n\350\264e3o\247"
+	.ascii	"\005\340\332C\n\013\315\226\236P\306"
+	.text
+	.section	.gnu.lto_frskyOsdUpdate.part.0.129.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\225\002\205\024"
+	.string	"\346#\201I\260\324Q:X\264\265l:\203\337\343\211sx\021\006\360mZ\365k\370\357[\236\034H\376\234\325,\250\253eee\273,\323\237\271;X\317\002\375|\350_\331\333\323-\375\rK)D\265b\212\203\314\361\314\225\266\021B\266L)j"
+	.string	"j"
+	.string	"k"
+	.string	"v\253u\361.l\373\200\360\217m\344\273\333\"X\321\202\350)\270\273\344\305i\342?_\215b8\225\365\343\007(c_\215\370xR\022\205)\273\333*\207T\fQh*f'\245P\350"
+	.string	"H\003\311yC\032\352\254\024\361\031\266\b\005\221N\312\240P"
+	.ascii	"\025\021\220\347\256E%\220j\201\263V0\273\353\313j7\200\333\226"
+	.ascii	"\331n`\253\217:\227<Y\017w*"
+	.string	"\331,u\310R\317\225ZG\365\007h\355\005i\227V\265dmb\r&\030<<\240\314\342\342\343\235\224\330\356F{\257\350\207\013n\320\356\201m\263\270\300\274\363\335\215\026\201\t\020\027\334\335\221\276\377t\037\317u\236\245O)\t\307c7\275\327s'/h\262%\341v\367\273\363`\327\231\245\026\004\326\243~\316'Pw\221\361\"\201\243\214\027u\276w1D-*\311o>\334\335\rQ\324\306\220\001j\352\310B~:\333\234K\026\0373~\326\214X\22482E$H\251|\2375\374\027\303\340\346\263\314g\314\034\030\262\273/1.\203\306Oq\32156\372\231\315x\361\363\276+\216\311\226\224\323\311\264\312-\265qr\3643?\367\337~TI\001\315X\246Y\331\240\343\222\201\341\350\2748\220\256\033\262\303\315L\016I\363\322!W\024\330\345\241\346E~p\271^d\313\266~*\031F6\201V\022\214|$\244\222"
+	.string	"'\n\247\0279\306\271\344p\316\371&\275\036<O\370\016\n/:\302\351rB\227@}^\005\013\372\331\234?\262\375F\005\374\211*\243\316\363n@\tU\254\327r\033\217Ra\355.\004\377\306q\\xO\003; P\002A\352\3166\350\020\216K_\350\020#\374\336-\225\222=\007K\360\360+1v\266\330\034y\357\262J"
+	.ascii	"\201\324^i[S\241\317R\020\255\311\0233\2628\322\340O\341\004"
+	.ascii	"\224\222@\032\344!v\341M\333\267&\317\245\361\036PXmlP\366\266"
+	.ascii	"\256\201\341\244N\001YXIk\233h\021\037\215\375\006\341\226\232"
+	.ascii	"%\362\261I\003\226{\353dc\213\005\342\024\001ZS\266\033 loD\350"
+	.ascii	"\2335X\347\312v\320h\034\273\202\023"
+	.text
+	.section	.gnu.lto_frskyOsdBeginTransaction.part.0.136.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`J\002\305\022"
+	.string	"\366awH\360\356&\035@\207\246\233\347\236\033o\275\233\017\213\007\005\034{;.P?:=\213\037\375\370/\002\214)\362F\0052\206\035\037?\377\221G\306\211_\344\036\214\3055\324\223|n\003\361\227v\351\r\3427oh\223\275wJ\001`"
+	.string	"c"
+	.string	"a"
+	.string	"\234\013\234\316\205\374\243\236\243\027P\317\331\027a\233\005s\313~\361PgAxP\314\370,\355nwnvx\353\034\235\262\266|\020%\3279\331\345\353\313pz\242K\233\240Y\013\240\017\303'50\022\301"
+	.ascii	"\360\305\320\017\032\017\257\213\227\026>\030)=^3\026\354\256"
+	.ascii	"O\032\356\214\333N\331\356l\271\0231\023'2\313kNP\223\024\002"
+	.ascii	"H\034b]h\305!\256p]0\377\304\203Z\027Z\371\312\254\306\021\217"
+	.ascii	"\212q\0276r\316$\247s Sf\263\330?\377\331\001m^\342>-\237y~?"
+	.ascii	" \300\330\356\266P_\306\262Q(K\371\220\365\036\027\032\356\007"
+	.ascii	"\263\224\366G\234D\353=.\326\330\275\211Q\333\r\017<r\336)\352"
+	.ascii	"k\027)\274\203\005m\t\214\275<"
+	.string	"n[\365m%&\362/\337v\007J0\246Qf\272\274qr\362S\252\355]L1\202\213'\360\321\222\300X\322\213\274\311\231\343YOww=q\354*-\037\376\337\240<H\001\300]\232[\214\345\300\025}\370\320o\337V\363\374hKFEnp\264\002\f(_\251\240x\324)\222\b+\357A\213\311J5\241\363J\272\n%\020N\272\224j\325\221\f\260\207\"A\325\251x\236\252C\235\356\304\221\375D\33302\215/\023\206[\241\2737\n\304w\2142\312!\375T\365\215TG\214\214\346\257\3234\326\346\314\261-R\345T\315\\\304\310&\313\213\324O9/\236\301\354\302m\246\006F\336\314\0216 p\002\221UU\007<\022\003\326\200\343\f\00711\016.\310>\242W\324\266\004\2373k\306\375\323!\rr!\363\333\325\302j/\226<>b.\212ApJ\271\013\3157c\030\216\210\3772\240\304\336\204P\n"
+	.ascii	"\306m\256\377\231 \206\377\336\220i\360\336\221\357B4/\t\202"
+	.ascii	"\375jl*\361\374\211c\323I\237\331\013,\347\205\313\n\345\275"
+	.ascii	"\016\217v\004\206o\372{\257\rc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`Q\n\r\036"
+	.string	"\306o\252>`,i8q\0013\272HIq\035\254|\347\020>\222\221\354\271\322\343\353\314\232Epu\030\337~j\022\355\037\363\305w\\]u\235\254*\030'\332\266\341\035\204\250\017\304-m\267\335iK\031\242"
+	.string	"\225"
+	.string	"\222"
+	.string	"\355\301Hw(\322\034\2104\326\256\257\206\364\006!\255!Hg"
+	.string	"\322\030~\364\005\037m\241GW\340\321V;\232\202\216\226\220\243#\340h\b7\372\201\215vP\243\033\360\035Dw\022\321h\0063Z'\243\027\304h\024F+ \325\224\317\361ES\271h&\323\242YKj\220%\037\213\226Z\321Q*:W\226\242\017\240\350-\373\361x<\236\350)\262L\3234\315\352*\322D\027\240JU\225W\242w\022\211\211D\023 \277\313\274\324\n\300lw\315TU\323=\273\275+\226\206\261|\306M#\332"
+	.ascii	"\271\273\347\213\344\371\267\200\310g\375\310\023)r\231\376\331"
+	.ascii	"Gm\235<^0Ml\330,\327>\213\017T\024F\315\256\3732\275\220\310"
+	.ascii	"\364\036\032\323\213HLo\2420\275\214x\275\215\300\364:R{\037"
+	.ascii	"i\365*\342\264w\021\247i\272;\325\275C\376\322k\310Ko\241.\275"
+	.ascii	"\204\270\364\n\267\364\016\322\322+\226\245W\020\226\336\260"
+	.ascii	"+\275`Vz\277\252\364\006\242\322\033\234\322\013\224\322\353"
+	.ascii	"\025\245\267\013J\357\357I/ '\275k\223^.&\275\177\226\264\b%"
+	.ascii	"\035\"I\203@\322\037\216\004\307\263\002\027\231\270\323~\300"
+	.ascii	"3'\366&\223\355\274\244K\353\327\236\347\342\002\317\363\312"
+	.ascii	"6Iu\302~~W\236Go\347Y\345%\023\372\211c\273\355\355\246Z\263"
+	.ascii	"}@\221\r\030\032\033\256W\355P+\277M\030\245\262v\250\036s\320"
+	.ascii	"M\033Z\355(\355\246\312W\221\312\362\334<\367\230}FL\302\322"
+	.ascii	"\274\216\277@\3634\265\234\335\334\342\255\256\331u^\263\233"
+	.ascii	"+\333\350\364\201\363\362h\211\256\337\3541\217\315\271\244\207"
+	.ascii	"\374iD\362?\211\344o\3768\001\032a\244\345\n\213\2128\032\342"
+	.ascii	"(\210\017\337y\350p\224\003\326\325\006\r\031nb\270`\341\264"
+	.ascii	"\nVg\n7\327\252\233\274\252\t\023nJ8G8\n\341\346\203\233=\007"
+	.ascii	"\r\030\350\316\275rA\211\236\211\n\250\246\022H}\307l\224s\f"
+	.ascii	"\322\020\334$\226Q7\325Y\356\374\225;\253\005\316\275\223\300"
+	.ascii	"w\037\300f\300\214q.\300\216\226\217\254\024p&\342Y\201\3032"
+	.ascii	"\300wN\001\276cr\354'\210\f\007\340\267\225wR\2455b\314\2473"
+	.ascii	"\217I5\3043\303\r>\005z\372\316\351\274:\341p\347\342\002q\001"
+	.ascii	"\200\241\250A(#\212&\")IR\311p\360\002\231!\252\016\021P\024"
+	.ascii	"\005\231c\204\020\tD$\220,\351\330\252j\307\0066%\215_\005`\267"
+	.ascii	"\002pj\026\267N\301\213\306\353\310\300\231\215.\261\237\357"
+	.ascii	":\206u\211\020$\360\036\327\265'5-\216\351\320\264S\226\216\322"
+	.ascii	"7,\030\366\340\320\311+;\360\261\2278cu\320\347H\305\372\211"
+	.ascii	"\345\271\352{\301\273-\324[s\264\037\275B\275\250B4o\350\357"
+	.ascii	"DB\311\003\217\360V\224\013`UW\370\3076:\241\272pzY\321\335\n"
+	.ascii	"q\243%\323\223S,\241\277$:_\036\352Mm\312\257\006\375\247\372"
+	.ascii	"S\361[\375\251j@\245X&\0058J\"\b0@\002P\007M\317%\211{Iz\016"
+	.ascii	"\232\236\036\037b!1>\212\327\202\343\265Qdo\024\257\005\307\253"
+	.ascii	"\273\307)7\246\027\334=LN\336wWv\327\275\006\n\020?\330\242O"
+	.ascii	"\231\202\221&5<\302\235\030\246\357\252\211x\304\247?Jr\240`"
+	.ascii	"\330\315\357w\205\376\r\2618\254\n"
+	.text
+	.section	.gnu.lto_.refs.72b45c4435c3dfbd,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\005\b"
+	.string	"\006P))\200K\263\00630\027\214\r0\00330\00330\307\230\247\2206)P(D\216\265\036\217\317\305\245MBVvo)eJ\001\031"
+	.string	"\034"
+	.string	"!"
+	.string	"/\302K\260R\353\300;\255\321\013\275\317\353\274\357m\336\345e\353kD\377\b\357\305j\361V\254\024\353\304+\261F\274\020\357\303\352\3606\274\f\357\302\033y\025\336\204\325\007\274\322\033\271\247\254k\025\266"
+	.ascii	"k\364\332\"\344Y\333\262f\262\226z\254vplhd\274\030\001\372\036"
+	.ascii	"lEm[\240\251nj*=\344\350\326a6o1I\263\270\227\215qj\260\026\274"
+	.ascii	"\2205% `\"\221R\355\264\006\304=\250\335\234\306U\033B\027\376"
+	.ascii	"UHy\200\207\261z\217\266\0014\207\315\264\034W\304*\017\0237"
+	.ascii	"\263>\3229\306\237\026'\203\335,\263\260C\213\350\177\371\321"
+	.ascii	"N\225@\223\317\261U\331$\267+\350X\301\271a\366\037\f\022w\203"
+	.ascii	"\341\020\205A0\244"
+	.text
+	.section	.gnu.lto_.decls.72b45c4435c3dfbd,"e",@progbits
+	.ascii	"(\265/\375`\373bEv\001\212]\242\203U \016%\225t_\025S\255pG\344"
+	.ascii	"0RQ%P\005U\0255\220\234\205P\352\306N'\006\024\001AU\004\021"
+	.ascii	"\325\332\250wE\277\325\212\263\202E\275\342hr\211\036\323\367"
+	.ascii	"/W\214.\222.o\267\322\007\2124\250\237\3158\273\0037q\261\230"
+	.ascii	"Y\255\204\020\262\267\334) \007\003\b\202\b.\352\224^=\304\272"
+	.ascii	"\335\025.MJ\253R\244\211\330\265\275\336k\316f9g\017\0364\234"
+	.ascii	"TYkJ'>\256J\217\245\322c\031\351\341l\317y\254\224\366\372\376"
+	.ascii	"\321>\354\332\\\277\345\322UL\232\253\257z++\257\271\272\207"
+	.ascii	"u\313!ZsSM\232\227\2518\277\234W\r\036<0\340\305\f\252\023\377"
+	.ascii	"\352\245\177oi\235\025A\312k\234\325\365E\fL\343\337\272\264"
+	.ascii	"y4\226\r\264%G\215\177\337\322\337%\351\257Xj\263\3559\033\216"
+	.ascii	"j\352FY\242\363\321L9jI\234\224\326a\315\334\350\300\212\332"
+	.ascii	"\322\370\227H\332v\226\347\354\250\356\033-\365\216j\250\203"
+	.ascii	"\b\361\033\243\216\3029\023Y;\200\034k\007`\312q\021)9\361oW"
+	.ascii	"\372k\3254\200\260\322\342\032\377F\245\2770\322^Z\236\363o\031"
+	.ascii	"N9{ey\311\306\335\364\325#k\256q3i0\301\224g5\032\277\003\323"
+	.ascii	"\2634\373D\304Q\023\r\223\222\036\313\271:\035J\271*SJ+\027E"
+	.ascii	"k\213\324\362\b\022k&\342\250\211f\351\216k\231\363\372\341\213"
+	.ascii	"\005s\311\232R\266;\245e\036\323\362\303\030\353'\342\250\211"
+	.ascii	"fF\021\2143\264\353\2118j\2429\272\3631\326\305R\3111\332\311"
+	.ascii	"FVQ\312\234\327\207\360[9+9\354\006\355\025\253E\304Q\023M\322"
+	.ascii	"\035\216e\316\253=\362\203\ba\007-\240\r\274\253\022M\263\352"
+	.ascii	"Z\346\274Z.^,\225K\326\224\246)\271\261\314y\375\337\311~\321"
+	.ascii	"-z\251\223:F+uQ\0235\2146\352\334.\032\311\n\366\221]\355\240"
+	.ascii	"5s\373g\317\\\303\232\263Q\316\371v\354\377`\007\355\322\212"
+	.ascii	"\271dM\331\b+Y\200\026x5\244\370\345\274z\320\340!\247\354\207"
+	.ascii	"\322J\200U\007G0L\360L\343\367Zzf\333s\336\316\362\234\357\261"
+	.ascii	"\364\267~e\324\310\276xY\261\220-o]\215-\031\333\267f\r'\222"
+	.ascii	";\255)\215\337>\322\367U\030\313\247SFi\214\226\033a\236\354"
+	.ascii	"\336\215\227\f& \215\337GV\357\270\214\n\347\022\325\250\362"
+	.ascii	"\326\370V0\275\355Ko\271\244\267t\351\216\223\364\267Z\262\230"
+	.ascii	"\312\2562\275\306\026\213\275\263k\007\026\357 B\374&\313\362"
+	.ascii	"X\316v:7\202F\356v4\276eKo;8\355\240\355\340\274%K\005\340\225"
+	.ascii	"\336f\245\267Q\251\225b\247\330\265\203\245\273\205b\347Nc\264"
+	.ascii	"f\263\234W\035\032-br\2505\276uJo;\234:\203\203\203\203\266\303"
+	.ascii	"yk\224\n\300\366\234\330\362\234\r\260<\347\355lO\023\353\004"
+	.ascii	"\016\267x\362D\253\361U49\334\211\345HFk\374\333\267[8\035.\267"
+	.ascii	"+W\215\255\232u"
+	.string	"\033t\243\"\327\330\256Y6\273z`\227\3342\261m7\211\326\274\346\274\352\264\217\3005%\215wl\317\331\226\347\374\211\364\326\203\363\016\016Z\017\316\367]\357?\215\315\\\017\253\272\306g!=\n\351W\313s\336\256\266\314*Im`\021\3515>\210\364v5b\307,\331E\212A\225\325r^3\324\004\002\251\363k\374\203\b\361\275\233\234\307r\316\034p\260\310\350\222\033\337&y\006U9\304u\322wz8\313s~\265=gjy\316{pM.\223\004v\370\333\036;\302\003\273\301O\253\203\337\354\200\227\214\003X\026\026\b\206K\346\277\211sxa\0058P\004D@\020D\354\003\\$\260V\340\300\n;Th\r\374\337\300\323\377\264QB\213\n$'\260\202\b\300@\302\n\021(\030AH\204!\b\265\357\204\277M\270\300\337\346\035s\235\377\024z\300\201{\2003\003|\022\370\033\002$\204\271\211k\360\237\030"
+	.string	"\323!D\270\b\366\212\034\234\016\370\362A\203\300!\017\2033\001]\016\360w\001\f\360\267\351\341m7\033L\230\247\315E\271d\370\033\203\2779\370;\203\016\3766\267\\{\336\277\276\366\0133\246\313\362J\237\260L\332\354\275*7\013M\223\337>\371;\375\333\264L.\236\211g\370\315'\257\371\3154+I\252\030\341"
+	.string	"\330t_2\332\251"
+	.string	"\026\313\337\277\211\343\374f\327\337I\377\265\273V\356U\335o\315\374\366\357\267g\376\003\336*\177\027\233X\375]tW\320\331\024\\\004+\034\203\337\334\360\333\020K\326f\374\026\002iL\007<3\223\246\224])\377\215\362[\276;\367\267P\331\316o\266\370\333\352B\271r\036\200\270\214\\\360\233/"
+	.ascii	"\375\346\307g\016\270a\005E\204L\374\270q\377=\350\021\334\346"
+	.ascii	"7G\240E\3349\315or\340\267#\332\353\374\315\341\022Q\004\b\330"
+	.ascii	"\017\310\2703\376\373\344\267]\356\215\277U8\371\355\334\177"
+	.ascii	"\233\274Y\275\026\022\3427U\213\264\0258\240\355\371\006\277"
+	.ascii	"\331\001\322\222\277Yp\271z\005\266\307n0S\350\250\313v@\344"
+	.ascii	"\345Z\373o\3273\370M\b\264\r\233\202\233\366[\030>\320\036\370"
+	.ascii	"/\202\377\034\2446\374\246\003\376\213"
+	.string	"\266\376\266\307o\267~\373\343\267d\3775\362[\017\277-\373\355\231\002~+\364\333\005\374]t\223\310(\3766\304om\374V\004k\302oC\370-\r\b\374\266\306o\037\360\333\022~K\302oo\374\326\002\277\205\372-\005\206~;\302\346\230\372/\222\337Z\335#\377\035\373-\027\0071/\250[\3407?\230@\004\366\003\277e\341\267\036\260!\370-\b~\253\342\267#\370o\n\260[\344?\002\316\341z\335\256\023\340\307yV\375\355\211\277\221\227\353\267@\277\r\372\355\317\355\361\367\n\332\304\215L\232\377\002m\375WH\353\372d\375\226\3707\320\345q\017n\221\357\371q\337\177\261\376\033\365\337\031\377}\361\337\243\377\272\360\337\241\377\022\377;\374\257\372_\023\374W\004\377\005\301\177?\360_\022\377]\341\277\031\370o\t\377\255\300\177'\360\337\b\374\227\204\377\212\370\357\b\377\025\341\277 \376\333\200\377z\360\337\003\374\267"
+	.ascii	"\377\345\340\277\030\374\367\346\277\346\177\357\177\355\337"
+	.ascii	"\177\177\373\375=\346\357\345\337{\177w\371\373\356o+\177W\371"
+	.ascii	"\233\356o\247\277\347\376n\362\367\222\277\327\376N"
+	.string	"\373\373\354\357\262\277\215\374\275\202\277\213\374\315\365w\326\337^\177\013\371\033\310\337Z\177_\375\235\343o\251\277\241\376\226\361\367\322\3371\3766\372\233\005\177\307\360\367\212\277\207~\373\345\267;\177\003\375\337\300\337\305\277\205~\313\365\177\357?\237\223\277U\374\235\342\267=\277]\341o\365\357\023\177\013\377\233\370\355\206\277K\360\277\355\277\007\177\217\340?\361o\020\374\026\206\377\034\376f\341o\023\377\001\377^\341o\025\376\253\3607\n\177O\340o\007\374\375\341o\004\374\035\200\277\001\360\267\315\337\366\267\201\277\025\363[\276\337\352\3756\312o\343~\213\366[ \377\203~\213\365\333\253\337\252\340\267)\370m\f\277e\361[\344o\217\2775\376\026\005\277\315\360\037\306\177\272\377\025\030\034\034\034\3741\340\360\347\300\375\025\030\fd\222\372\346\354\274l\301\\\222F{|N\266\310\335\256-\207\263\240\260\346d\216\213\277\2518\277\334\324\244"
+	.ascii	"\214w\303GF\212\257\361o\312\356\216\236\372\234\356\354\360"
+	.ascii	"\225TlPkL\313\256\n\256\263y\342\032<k\374"
+	.ascii	"\033\250*S0]j\225\\2\235\231\262\332\300\351X{j\214\347\260\221"
+	.ascii	"\337\223\243\306\267\331\303P\260\023\374\304\256\247\303q_u"
+	.ascii	"r\234\270X\243k|\233-\351\355\351\316\026\330\323\235?n\202\341"
+	.ascii	"\342\300L\021|;\206S;\373\223\303\321\030\304\207\343\267\023"
+	.ascii	",n\207\031\354\206\333\270\222F{l\307m?^\202\231\374\255\251"
+	.ascii	"\314'\\\220\242\032\333\325\366\234\032>\034\263qqjBcM\355\374"
+	.ascii	"\"\246\016F\032>\303hv\305jX\t6\273E.\025\027\353\236\262\f\037"
+	.ascii	"}Q\252a2\275e\3169\207\235r\316&.\275M\223\3646n\351m\226\244"
+	.ascii	"?N\202\217py]"
+	.string	"\001\323\370v\356H\017%\022<\206\215\330\025\037\301aX\f\347f;\262uD+\207\251\213\212)\305\002\373\322\t\353B\212R\004\023\261+\376\302C\260\327\327\355\313\222\372\312\212:\301\316\362\224NlS$$\210\211\245d\227.\254\264+\016\202\177`.\f\344\266@\302R\327\005\016\202\267\260\217\273*I\270PZ\342 XkI\231\002\312\3601\345\304\250\3459\361\322\0365\\\224\214\334\032\277f-}\rZ\372\232\261\364\307Y\330\nF\017$w\215\337lV\267/\353\205\325\340\022[\365U\032\022\346\201\2570\226]\261\025\336\201\253\260\324u\341A\203\2052K\202\225\342\035\351\217\251\360\223\215\267\253\035\215\177<\205s89S\352\322\370!@YY\346\234q`\035v\3059\360\r\034\205\245\256\213\034X\t\333\270\2532\003-\270\3204\3015\331\235\370\264<g\215\214\3645Ii\r\334\224\203W6'\246\361i"
+	.string	"\323\207\2604e\211e`\032v\305O\230\t75\231\233\204\237\250,\361\f\374\204\235\350\314.c\376\236R|\232\2774/=M\227\3644x\351\217c\340\244\033\275\365\306\022\206\201_\330\025'a\027\030\311B\261sI8\t\027\235Y\346\274\342$l\204\217\356\252\314"
+	.ascii	"\326\237\275Q\306.\311\331$\305-.\234\006\026\300\270hj|\032"
+	.ascii	"\262\3644I\322\323\204\245?&\302\311\366\202\345\326b\3608\371"
+	.ascii	"\343\334l6\320\312\230\253\352jlZ\236\323B\371\360;\210\257\310"
+	.ascii	"0\t\021\f\244\332\262\321\325\177\367\314\005\264\353\r\274~"
+	.ascii	"\327L\223\271Ie\262 \tA&\211\362\006\336>\033\210b\251y\270\231"
+	.ascii	"\023\003C\006MTz\032\033\351i\236\322\3230\2151\373\261U\243"
+	.ascii	"\253\361\177\305\\>\2445\2035\352bR\326\370.o\230_\276\013&_"
+	.ascii	">\021\370t\260\230U\027\333\211O\003#\375\357\236\036\r]"
+	.string	"Z\333\332\370\313\372\302\312\027\264\306O\313t\271\\\256\226\233\345z\271[\354z\363.\226\337;\033wl\001\257\335%kJ\337\212\300,\247\340\235Q\322\375-o\336\275\262\267\274T\252\334\231Q\346\335:\033h\355\240r2\214\bI\222<\004\375l\300d\345\230\313\301O\323\322\033\313s>\365J\237f\245\327\2125K\333:\323\370iSzT0=\372%\275\232\3559\217\312\245\217\"\345F\221s\322\013\323\370B\271sv\275Q\236ql\260\340\324\210\032\263\3109g{\271\023\275\234\334\023\300*FI\215\037\202\333m\3139\261\032\265hS\346\234\235\3348\273\336'\367\355\3025\231\233t\325n\223\313]\265\373\344\262\3356\016XlF:\302r[\346\234\237\374\256\345\004\301Xo\313\234\263\007\r\036<\244\201-n\240\245\370,=\252$\275K.\223\33763iw\333\260\031U\316D\267\355\016\002\346L\244c\355"
+	.ascii	"\254\035\300\211e\006\031\220\023\037%[\353`\004a\240\2124\276"
+	.ascii	"ICS\206):j|"
+	.string	"\226\223c`A5>\312\225\376\277eW\211]\257\331U\336 W\310\035b\326=\246\314\332\355\222Y;(3\213\217e;\035\345\3658\223\334\325\256\227\354\227\354\032\271H\266\\\374V\356\222]\"\027,'\271\346d\rV\217\2518?\0176kYK\265\023\377\367\310/\222\377\206]\261K\205\344\207\327\370\216}\370=R#6\027F\260q\b\036\351U\332\236s\204\257_\260\377z\265R\347\013\026\233\225\306\267\310\207\337/\243'6 \215i,\317y4GZcyN\334d{\316\227\241-\322\377v] \335\247c\271\005\310\345\242q\306\312\\\226\016\220\274\026a\327\207]\357\217\306\272?\332\355\366\260vP\031\004e\231\"`9g\r\036\32001\273%\214\377\273e\317n\026M\230&\270 \215\257\326\207\337-\233\366\004u\2451\005,\317\211\363\345\021\205\032\201b\245v\261\356\225\215Z`\2151\215\255\324t"
+	.ascii	"\277h,5\376\031\227\276\331^$)\211\240\2249\257\027\307U\272"
+	.ascii	"LXH7'o\334\244\030/\004{0jy\245n\216;uw\\\250[\343\332\270Q\267"
+	.ascii	"\352\336\270:.\225]/\216\333te\334\031\367\351v\315HF9g\032R"
+	.ascii	"J\027HYb\300\200\321\312\"\246\333\342\377pq\334\2434,\245\261"
+	.ascii	"\213\343\032Y\267k\246L]\234--q\242\fF}m\200\177*I-\222\3559"
+	.ascii	"3\\\247\237\246\246J\231\033\312\306?\307\322\237X\351\177\227"
+	.ascii	"~\231\376&s\223\214]7\320\032[&\037~\227.\034\224#\300\306?\247"
+	.ascii	"\322\2372R\r\266\347\374\331\"\275\351\227\336\004\2236\340."
+	.ascii	"\025\021%\275\311$\275I\226\336\354J\317\245*\375\322\366\234"
+	.ascii	"\177\007v\3001\243\245\b\f\260\tz\206\243j=\363\007\343\310\230"
+	.ascii	"\267^o\230\230|P\231\361\263v`S\3122o?\263\275\270\225\253q\223"
+	.ascii	"\371\360.\023\001\037Wb\215o_`\337U\211Q4\306\203\324\350\311"
+	.ascii	"\22211\035\350\2545\224\256\370\362\244\320h:j\f\244\253\315"
+	.ascii	"r\214\326<\303n\3412\025\3477#\257mtTNr\315Lg\326\336T\234\037"
+	.ascii	"\216\274\316\321T\"\216\232h`l\321[\366\216\316k\253\346\262"
+	.ascii	"vP;\331h\313\027e\316\271\363\332J\343\031Q\266\375\215\326y"
+	.ascii	"\275\326Tr\210\326\234\264[\226L\305\371y\351e\203\351\275\016"
+	.ascii	"\323_Z\317\256\235\327[\336\\\272K\317\310\353\247\256\221c\264"
+	.ascii	"f'4\r\fvkcz\261\2035Xm\317\331~\226\347\274)#m\274v\353\2730"
+	.ascii	"e\243\3415\023\261,\255\305\256\215\367w\225\2563\252\251\273"
+	.ascii	"\373\361w\342\277\261\240\265\035\216\336\023/\301\306}\345\303"
+	.ascii	"\033KM\013%=\244\032\333$\226\347\2741]\2447H\266\347\264dsM"
+	.ascii	"\327Q\032JOi)vm*\177\247\265\332{\375\320T\332\255\233\344$w"
+	.ascii	"r\316ZS\306!Q\312\035Q:Qk\266\277\227Pi&lmT\372\t\214\264$\313"
+	.ascii	"\234W\r:Txiy9\370f2=\016L\217\307\244\307Z\322\277\341\272\315"
+	.ascii	"\006\232@\203\033'\274\270\245\306\375\366\341\r\307s6A\255Y"
+	.ascii	"-\347\254c\263\203\213\311I\343\017Z\236\363\370J\232\346*\251"
+	.ascii	"\315\226\347\354\340$M\225\266\347\264G\226\347\264\2532H{eY"
+	.ascii	"Q\346\234\377\367Y+i\262.\353\325\256m\206\327\234\231\230\365"
+	.ascii	"W\033\271\2532=\332B\267\3149?\004\022\267\2716\353#]#\355m\231"
+	.ascii	"\363j\326I\330\262\332<x\360\220\23212\245\354\006\0373I\217"
+	.ascii	"\321\322c\261\364!\300l`Nr'\027m\231\242\034k1\273\266\221\333"
+	.ascii	"5\267\221\016[\222%e\231\363\352A\203\007\234/&\201XN|L$=\346"
+	.ascii	"J\217\265\322\3336!\326-\207h'\033\005I@\310\032\237c,\225>)"
+	.ascii	"\260\306\247\230\3563\375\230\220"
+	.ascii	"vl-\227\247\035\316J\233]\240\235)\241RG\376\226l\344\345\235"
+	.ascii	"{\235\241\322|\344,i\2313T\207\236\262\3144\364~\356e\361\003"
+	.ascii	"|\321\370\374\322T\355#\316\306\220\rI[\266\234]:CQ\335,L6\232"
+	.ascii	"\300R\274\374U\206\313\317.5OR\312xP\321\330\221!\243\326\370"
+	.ascii	"\0332\026,g\226\254\273,\0359pR\336\244\340\375\314b\003\251"
+	.ascii	"H5\361\322\370\274\033\001O\tJ\343\367u\220\347\206g\245\361"
+	.ascii	"5\320\235T\250\234v;\311\262\314t\236\305\260\321\344\2273T\007"
+	.ascii	"\235\034MSl\247\225\237v\226\312\r\326\335\017\253\263nM\346"
+	.ascii	"\275\272\263\n\r\337\227<\243\234\")eV\343k@\2332\005\367I l"
+	.ascii	"*\016\354fk\t\243E\343k\030\022%\n\356;\362\203\005\"A\356\032"
+	.ascii	"_\303\324\031w\306\235P\216L\321\b\311\313\202v\312\375\2042"
+	.ascii	"f\206\247\244A\311\211\223\023\356\310\222\315\235\222\231\036"
+	.ascii	"\200mm'\\\240\322\006j1yr\276\375\204\033<c\363\321\370t\333"
+	.ascii	"r\232\235f\347\022\b\344\241a\234\322\312\234l?\227\2309\276"
+	.ascii	"\3748j|\256\375m\211\r\310_\343S\355o[\324\242\004\033\237i\177"
+	.ascii	"\003\353R\025\330\370D\373\033\031V\023,\215\317\263\277\351"
+	.ascii	"\270\221q\361\361\366\237\306\022q\013ck|\r\242\224\225\341\276"
+	.ascii	":%\233\022\214\306\327 \355\\\317\365L\032\2112C\315\350\253"
+	.ascii	"\3615\310B\202\204\rm\033;\373k|\r\224\306\306\306D(I\222%\214"
+	.ascii	"\230\030\220\034,/<\244)``ZN?\276|\254\025)r&\243\314;'ODE\274"
+	.ascii	"\274\214\304\300IBfkOJ\210\020Ae\256\341\244E\343gptn\235[\247"
+	.ascii	"2\314\317R\261\301\303\354\354\372\251\214\"%\243\361\t\344r"
+	.ascii	"89\316\256\2244>\271.G\205\366v\243\361\371\343\364q\366\350"
+	.ascii	"\001\223\225e\356\331\234\275\334\204\301\262Bi\374\0369,,s\217"
+	.ascii	"J\231\031g\\\032\277\207,=s\2349N+\233s\330\332I4dJ\213\263\352"
+	.ascii	"\247\025\226\032M\374\032\237;\306\306`y5>\25140\343\255\250"
+	.ascii	"\3619\205\227:>\244\034\365h|\352\350Q\243\306)\325\205\007\337"
+	.ascii	"\206P\211\372)\225\363D\364\343I\343\363F\372F\303\206U\343\023"
+	.ascii	"\352r\346W\027\230\260\306\247\r\274\324\021\303\222\245\243"
+	.ascii	"\307\306\271t.\235Oa[\347\325\227Q\3329\343\347\223\225\242\030"
+	.ascii	"J\032\2372.W\205g\245\361\351\204\243\005\210\226\327\370l\262"
+	.ascii	"nX\357\356/G\343\223\t"
+	.string	"[\2710\302t,\t<]\234.\316\030\017\220\232\212\003C\251\226wSI?c\024 \212\035\226\306'\214\254%e\245\361\371\342\255\206V`\343\023\311\272\345\344X\003\243\201\301\226\263\305\331\002\367\331\334\024\266\364\243E\216\"\215\217A[z\026\235Eg\322\346\034\206t\005/\020J\343c`\004\020\360L\376\335\f\021\334\262v\346\237\31131\262\246\032\233\203\227\263\211\312\232\261\244\261)\3703kI\360\032\233\201Z\177\177&\335\027e\217:# \215\217A\f2dL\277:%\226\332:\013S\346\246_\267U\t[\261\334\360\270B\305E\030>>sL\024e\316\322\2258A17\307L!\352\202\327\370}\035`\240\221)j|\236)\313\245\271g\277\330p\250\034i\221\201$/\317\334\033S\322\344\266\257+\275\233{5l[R\31646\277\\\016\245\253\263\232\272\034\215&F\2524>\017U\226,f\027\007"
+	.ascii	"\231\212\003C\233\272\323\343r\263\213"
+	.string	"\215\222\032ZL\032\233[.\027\005e\fIcS\313\345\270\320\264H\3610]\271b\336i)k\302\264\234\344\260\334\274\333\372B#\257\243n`\310x\242\243\361/\350\263b\305\244\263_Q&\022\262,c\032\377\202\271*UL:\373\025c\360\310`\231\024)&\235\340T\034\230)\003k\211\322\224\233t\337+\363$$\313\312\225\340U]\343_\340\343\311\023s\316vQ\326\374 \013\303\001\345\346\034*\245\016+HcS\256\377\364\252d56\343.\321\222\272\031\326\r'\031\002\305\243\361/xjk3\233t\316FY\211F!\362\266\314PP\035\316#\201>\236\340n61\002#\027\330\330|\353`\243\210\325Sc\323\255\303\177\032\314G\005m\307\362\353L\222\2263K\226HYe_\027\037\336\332\332\222\215\336Q\332\031\267\264\264\b\020y\241\314PP\035\320\262\277\314\324\370\031\304\314\314\3143\232d\230\016C"
+	.ascii	"\343\212L\0255>\373A\204\350p\304K\314^\343g\340q\344\210Y\026"
+	.ascii	"\002\227\25180\263\316\355\n\007\331\3152\034dn\214Rcs\355\360"
+	.ascii	"\306\225\007\244\361\373\314$e\300\216\274\222\230Hl\266\214"
+	.ascii	"y;\303\241ad\253F\343gH\002\0033\215`0\004\211\316\226\2300*"
+	.ascii	"\261\233F^T-Qil\206u\300\3612#+o-\245\031\3415\376N\230\264H"
+	.ascii	"\021\334\227f3Sq~w\355\f\216o\316\313\313\224B!\371\201k*\016"
+	.ascii	"L\217(\013\226\306\337IS*M!\266Kp*\316/\r\\\202\373\nrS\b\016"
+	.ascii	"\334\215=\257.\377i\026\220\305\306\327\370;b=L =L.\037\367a"
+	.ascii	"r\331\334D\224\241\"\020d\212\262\356OjJ\343\337\374q\223+I^"
+	.ascii	">\242R\204\351G\222\306\337\331\221~'i\3620\265L\036f\226\231"
+	.ascii	"\025D\f\377\bCb\324\370:|\351u\250LM\231WLc\346\025\221^\333"
+	.ascii	"Uc\263\312\006\326\204\235\331j\322\330\334q0nmbL\032\233TX\256"
+	.ascii	"\315\372\214\200i\374\276\2561\205\314\t\317,G\016\334\327\025"
+	.ascii	"\245\263eF\231Q\246\224\236\336T\034\230)E\023d\210U\214\306"
+	.ascii	"\327izz2\241\222\362\246\342\374L\0337\241:\352\005\\\222!\215"
+	.ascii	"\315\0328\n\316\2133b\270\032\2334\376\314&S\206\331d:\231ND"
+	.ascii	"\366Z-\031\026\330\3709Z\322\347,1\227\314%\334\007&/\347\353"
+	.ascii	"\350\310\214\021bl*\016\314\214\221\022\341\323!\325\330\204"
+	.ascii	"\241s$gFLc\363ENU\223\034\312\306&\022\226K\351\222a/\032\233"
+	.ascii	".\242\314lf\323(l*\316\317,\272i\024\202\025;\035\215M\242S\212"
+	.string	"\325r\260\261\231<\030\034&dZ8\260\334\255\263\272+j\374\234#@,\b\210\373\316\234\355J\305\324\224\241\232:\004\006\342\2764\251aH\024T\2074\351\253\007X\343\343\354\245\307y+S\006\377\331\234\2112T\276]\246\246\342\300\260\231\343?\233\344\214\031\266\306\330\257\373h\304\271\310k\374>\033\370\237\306\264\"\363\345\255\361q\212\244\307|X\314\361\230\3431\270/\315\271iKo*\316/C5u\370\337w\334gb\361\002\302\326\3708Q\351\177\373\376\317L\324\224s\226a\256\271\251\350\346\374\355\255im\207\037\307^K\200\377\370\376$\230XsQ\034^\316\331\216I\207\274\021I\t \233v9\033U%+P\345dTe\003\311\254\312)\003\222YUN\032\001Ifh\312UI$\263\2343\030\031%M\240rB2#\312\031\220\314\262Sn\201\305\311\346\265*\231\215\250r\206l\224\211\262\031\225\223"
+	.ascii	"\220\214\252\234\220\314\210\2342 \231U9e\263\252\274\223\215"
+	.ascii	"\210\232^\030\345\246\f\331\254*L6\243r\332A2\243rB2\253\n\263"
+	.ascii	"f^xy\232\361\206\227\245\3036A2\312KJ8\210\232v\354\220V\252"
+	.ascii	"\314%g\253v\224\233\262]\316\004\310\031\007U\023\027"
+	.ascii	"\"\033\026\256\310n\251\210\t\021\325\006\245\"+\252ld\227\264"
+	.ascii	"\331\016\311\213*g\257\242\024Y)\347\234EH\256vy\313\332%\257"
+	.ascii	"p\344\030G9o\220"
+	.string	"\327\234\225rN\332l\227sN\346\234\321&\034k\316Q;HJ%\245\234\2414(e\034\311&G9\267\232\0278'$3+\252\017M\320\314\224\331\305\232\264H1\250\2622s\251jJ\315\222d9F\316\331\212I\225N3\370\032\257(\031\030\270\270%\030#O<~d\035\232&g\210\320\330\323\313a\224\203F\226Y#\317\f\317\013\316\313\tA+\212)J\370 \221>\027 \325\343\ta\320P\350\202\005\216)p \264\342\250\342GM1b\307\270b\b\023\325 #\362x\002\021\207-`P\202\250\016\025s\236\342\003Uh\210<\016\203\202\206G\020T\240\025A?\304!\b\306\343\n\0202\b\nZA$\026\211\350\013Ec\nd\221\210\266 T\2030\fC?B\252\320\371\024\037pP\201\212?\304\013 \211C\243\320\205\0258\252j<\301D\006\033 a\315S|\360c\374\001\201X\024\022*\376h"
+	.string	"q\3649\341\002\220\217\210\037\343\217\r\n\342\0209\024\262pT\2210\224\300\202\304P1\305q\305\n#T\244\020Y$\221A\r\022\376\224P\221\302 !\344\b\f\220j\t!\344\b!\344\210\235"
+	.string	"\004\005\rO \246\240\036\207\206AA\027@\376\250$~T\022AA\303\023\220?*\211\0136\b\n\032\236\220\001q\250\201\242\t\325\205\242\n*\216B\025P\020\207/\b\215& \325\243J\002\371\243\222\310\200\374QI\024M\f\r\203F\\\200TKd\300A\321\304\0161\205\r@D\013t\020\0244<\001\251\226\300@UQ4\"K \325\022\031"
+	.string	"\r\215\030 \246\200\20284\"K\274 4\232\200\201\025z\216A\305\021\030@\252\030\340Q\221C#\013B\225\004r($T\034\001\003\220P%qL\0019$\246p\243\2018D\241\226\020\200\234\236\037\"\f%\200\210j\t\rR\374 \205C\307\241\t\032\324  \242\020\205\036\036\242\252\032\177J\030\205j\320\210b\013\304\024N\024\203J\370!\302p\264"
+	.string	"\020Q-ATK4\340\003\244Q8\364A\211\024\307\025A'"
+	.string	"@\204\007\216G\365\247h\\A\203\212\024\002\ry\200\203\377\f\215*QE\221^\204\021\0300\202\b\026\350E\220\320"
+	.string	"\022\032p^\004\t\037>\2200\302\207\364#|\270\252\317\t\030\250>B*\362\bC\211\242\n4t\001\007\251\016\301`B%\016\203\220+8\240\022\207\032\330\240\372\b\217D!\007\325\007\350X\274A\372\234G\0375\b\005Q84\232\3700\324 \206:\204\241>"
+	.string	"\020Q($T\034aD\226\030\200\212\243P\005\344\017P\033\213A\305\021*\216B!\232\027\204F\02368\372 \177T\022\304!\212\241\261x\"S\330\243\217\032\3030\347\005\253\3060<\342\243O\220\312b\270\002R-q\001r\310\032\213A\305\037\363\350\003$4\302\250\"K"
+	.string	"\r\215\030xAh4\001"
+	.string	",P4\f(\372\210\034*b\2430\305\017F^P\034j"
+	.string	"\203\021\251\n\251A*R\203\243\017\212a\013\304\342\210\013T\034\205*\020\213C\344\017qE\0137\252O\n\031\f\035\205\216C(2\260P\201\210)\250H\241\021h\205\360\204\017\213\342\t\025?\302\240\023\031\034}\220\304aq\005\026\026\006\213\344\031\022\n!\207'N!R\b$D\252B)\222X<A\203\247\370"
+	.string	"\350XD\2521\fK\250\370\021\"K Y\250Hb\361g\007HU\361#\034:\217>\352\221X\034:f\3603Dq\002\241\261H\034\252\220\342\007)\\\201X\034\036\215\252\0137\307\027\212$\200\206F\024\351\b\240\241\021\205M\n$\320\220\205\032\024\202T\026\303!\033 \243\020\210(D\226p\001Y#4\252B\302\021H\325\204\2430E\0065\206a\tUHh<\201\205P\350\346\350\243\"\205\310\022@G\016\350"
+	.string	"\021\325c\215\212\024\"\217\346\217\361\347\246\310\026\206)J"
+	.string	"\251\310\037u\210\205\212#D\n\201\360\2618t]\370Q\2155\306\342\t\204B\246\261H\034\n\231H\026*\321\346\370B\321\210\217D\241\025A\305\037\024hhD\201S \201\206/\230\310\024(\206j\212\023i,\016\275\240\016]H\213-\020\207\370\033\030\201\200\204\030y\364)\346\030S\374\\\243\212\374\021\032\205)F"
+	.string	"\0359\340\302\217j\334A\032\213C8\250X,\301\307\004Rc\030\006\t\207\310!qh\203\3649\252\240\n\r\221)\362\250\256@\201J\242\330\0021\005$\013\225\250\203|\212\017@8\032U\027\206F \016/\016\251F\020\220\305\242\021\004\033\243:la\210$\252@\303\232\243\317\315\007\220\306\342\n;j\320\t\241\t\027N\325G\005*\252\2004\026\207jT\240\242\020V}8\2004\026\207p\216\304\342\0209TDU\244\220\004\320\n\341\211T\215aXB\215aX\"E\372\210@\022\207+Pd\n$TQ0\336"
+	.string	"\tU\024\220> B\b\032\nM\030\325\026ZXQ\002\013\344\215\013C\365G%\241\001\3513\302\007$q\270\"\255\021\"\205&\2600\346\030\221+\244\020$\034\032\325c\317?|\030!"
+	.string	"\017l"
+	.ascii	"\003\351\317\007@\307\242\017\f*\216\306\026@(\016A \016\205"
+	.ascii	"B \374\030\217 |\260A\305\217\360DP\220p\204\032\0044\274\271"
+	.ascii	"\237\237)\305T\327\301W\372\243e\360\237\325\2332FF\246\317\270"
+	.ascii	"\024\263\242c\272F\214-!\215\337\301\225\030\2761M\353\227\306"
+	.ascii	"h\230T\214\006\2311\215\317A0\375\321%\n\306\306\212\0256$t\017"
+	.ascii	"{Y(vN\013-\016H\343s\240\222\376\250\036\372\005\243I\021\203"
+	.ascii	"\346]\252\247*\200\215\317\341H\372\243^\260\217\245\037N\360"
+	.ascii	"\272\240\\\322>1,e\032\243[\254\024)\343\322\370\034\200\244"
+	.ascii	"?\252\005\315\322<\210\230\251\202\342\231\241\222\242\244\361"
+	.ascii	"9Ha\301b\316\205\320\342`t\005\255Ca\207\333\024;3\306\331\240"
+	.ascii	"\023'\324\n\212u\3021%AC\253\240zF\314"
+	.string	"45>\007Y\322\037\245r\222\261\200\035\323\027\272(7g\332\206\0345:\345\035`\300$a\352\244\220\365\326\223\223\024\033\034~F\340\346\254\333i\243\305\231%P\256p\366\262\212,\311\231\\\350\217\344\231e\334\f\223\354\251\n\321\223(\276\033bQ\0327i\262\223\213\272D)\333\332\332\320\267(Sq~nG\337xH%\3078\020c\202\276\270toD\276\226H\225\300\027\003km\315\224B!\251NG\372\243j&\024\032\221\240\023\212v4\215\257\306\016\251\306\250\031z\366\245d\353\322\370v\275\336\336\220/N\2204F\313P%Z\312\265'\007\363e\223\237\227\237\027\262\243%#gx\240\253i\344\006\003F]\343\376[b\304+F#\271=0\026\216#\274#\350\330\026(3\232\364M\025.\300\271\306bb\246Q\027\020\016Z\204\235]@hQ*5F\277D\240\312\231\b-\202\202\035\375\372\212~\351"
+	.ascii	"\352X;\200\036\302d\206\340\211\203\004A\275:S\031e%\312\346"
+	.ascii	"\002p\211\0169\352\205N\235qQj\214\n\261\2015y`\350\234l0\006"
+	.ascii	"\355B\273p_\232\334z\261\201\224\364G\201\340\276\265\033ZV\215"
+	.ascii	"Q\037\267\005\203\203\203\250\217F\271\320\037G}\\\007\345\002"
+	.ascii	"\206Dt"
+	.ascii	"\366\310\322Xa\242\264\330:\367r\372t|\361@\265N;\250@ U\262"
+	.ascii	"\262h\315`J6\306q\224\n\007\212u\371\322\234,\223\200\334\231"
+	.ascii	"3+\b\025\327\216\243XG\257@\204\300rKrUd\032\243V\317\201\252"
+	.ascii	"\342d\331\370hU\315\020,\263\257\306g@ZV\303\311\t\235\262A\""
+	.ascii	"wt\327\030\325ay,\331a\311\361\323\334\204\371Q\243G\343o\020"
+	.ascii	"\227~\2036\0324\320(1\013\220\013\302C\260\346G\027/\203h\215"
+	.ascii	"\243Q\350\r@'9\r\275\201B\331M\251Q\365e\203\332\024'\324\306"
+	.ascii	"\305\302\201\036R\033\376r\323v\005\255\r,)\t\235\321\031\212"
+	.ascii	"*\031&\002sax\b\222\001\222\005Q\031Gg4\025M\217\260\030D\032"
+	.ascii	"\243N\327\016-seeHc\264\t\177\2619\273r\033\322\030e\262Ot\266"
+	.ascii	"\274\210!5F\227\256\207\215\256\202\3205F\225,\2251\035N\244"
+	.ascii	"4FcX1g\340\264\274\260`.\332V\026$\215\277\301\026\212\204\""
+	.ascii	"\241/\326\212\204\214\341$\222.T\215\321\0275\314\334\240\nl"
+	.ascii	"\374"
+	.string	"\r\\\370\375\004\364C\217\356\335M\023\272\304H\027\234_F\202\352\220S\004G\343\310\340\321\243\243-@\204\270\036\221\007\032Zc\324\350vK\f\032R\343\243Dh\321OC\023\344\013\023\301\306\337\300%E\223\f\310\361\267\003\260\361\321\254\205\205\213H\343\266\227;O\301\353\265\222\023\"9\032\237\201\347\337\3173?\r\215\023\035XU\215\277\301.\375O3?\r\312\246EJ\331\370\033\350\322o\210\343\343;\311\330\255\"\037u\375\002\251l\251\357'\231\313\301\b\207)\250#\"\204bH.\305((\235QhhdH\223t\263\026@ @4&\023K\303\334\035\023\300\304\311h\365y\246\307\220c\310\214\210\210H \"\"\222\202$)t\211o\267\201L\360\356\254c|\027\025E\346F\237\037Y\225eZ0\016\365\236\247K\300P\265\332(:\205\244\214\275\027\260\200\367\2100\370O\344\256\337!\213\013F\263\024g"
+	.ascii	"7YH#\350k4[\352\222\347\017\202:2p\214L\373\320\252j\032\\\347"
+	.ascii	"c\006Z\244\316\371\233\031\t\340\235\n\250n\370\310\001|\206"
+	.ascii	"8\272cp\004\367\002\340MoLg\f\200'\347\320\276a\272\253w\230"
+	.ascii	"\322\220\353\330>=\321\001Q\272\323\336\377\302\322]\216CU\215"
+	.ascii	"\024\027\315D\002\021\343\222\261\227\253\212>\270Cm\\~$\032"
+	.ascii	"\342\370\032I\327\214\321\206r\317\217\255\226\2025\243`.\262"
+	.ascii	"\004\233\222\371\371~\033\266\231e\370\324\362\031\242\026\270"
+	.ascii	"\2622\226\363\2535\220e\333\031luw\211\340\262\346\223\026\031"
+	.ascii	"\317\237\007\226\246y\304\342XU*\350\001\303\347j\277\234\311"
+	.ascii	"J0\232\270Z\205\032xJ,\001"
+	.string	"\277\365\360\367\001\275`<^\031\343c\357\257\244\332\237o\350\273\225L<a\001}\223AK\340m\321\3045)\256\021\340\363\026\227\245\331<\324\271\341\273F5d\240\020\301`\\5\034\251\nR\035\016Zl\252\313@\360\343\231\242\221\201<\234\b\032\321B\341.\310\261\333+w\234\314\251\357\331l\207O\001\025\t\322?\255f-BE\336 \221\rW\330*\234\037[e\301\202\265\241^U\276'\344KG;-jPF0B\354\212\316N\313\264/\232\256\3072\325\362\361\240k\213[\230*j\376\307\263apm\244\357\236\376\027U\373\256C\361)E\324\006\3714\375\023Y\201\032\210\331\023\005\212\362o\302\347\221\r\254&\264\221\207\373\003\b}x\034\3262\303\f\264_\347\357\233\b\310\305\331\271\233Z\bKn\335\367T5j\233B;\373\321\025\333\302\357B\023:(\357\257\b\247\202\374O\364b\026cV|<2"
+	.ascii	"\315{<\347\201\203\234%\352\323\202G\235\305?!\242Q,\254\235"
+	.ascii	"\317\213\230\346\202_%2\312\274\304\b\t;\242\227-od\251j\023"
+	.ascii	"\023Y\3510\023\305/\377\352\304\274\207\264\201\024\364\231\211"
+	.ascii	"zi\333\313\315\365\303\232\027\303\"\273\243\017P\346\244\313"
+	.ascii	"[\377\346OxR\202PV-\021'Yzd<m\016T*\324\360yP\202K\310N"
+	.string	"\223\214p\247\022\375\036\373\350\324X\210\252\224%\250W\236\304\244@CRjh}\321Y\033U\fI\030\250\363\242?\237\223+\362Z\332v\037\262\262=\376\255PKE\r\366\025\253Xc\346 t\002{\f\237\365u\016\247\345_\372~\243\345\267\375E\345g\323\216\007 \376\270h\302\007\t(\202\n5z\366\2311\002rB1\265\370>\030|\006F\301\\7\021\036\215\300-\345')\350^\314\207\003\270\377\251@\220*\252\036\003\302\346\357\tdP(J\246G\354\027\017~\246\232\350\215/\343\275\200\353H/\024\237\216\007[wa\306p\"^cK\024V\375\337\0207\372V\377/\273Z8\261\036\225j\035\217T\t\275\271\251\324\205\335v\031an\202\256\315A\337j,?\216\276y\003YiO\255E@\350\214\346\210\3717\341S\227\024\tW\257i\263\342\364\327\3571\272\f\347t>\004\350e\243G4\204KA"
+	.string	"\357\217\200\004\232\256@K3K{\301\270\206\005\247\233\370\025L\200,\260\217\017"
+	.string	"\261O5\351\227I\304P`\034\200\215\216 DrC"
+	.ascii	"\376\"\260]\357\351\212\215\035\370*\350\233\340\234\320-\372"
+	.ascii	"-\337E4\223x8\305\"\b%\252hg\207\225\361\322\241w\375=\336\r"
+	.ascii	"\264\264?\270\202\213Q\362\242;?=\374|\"g\024\221Z\322\n\225"
+	.ascii	"\311\024\241\244#\355r\253$\007\264p\231\260\305\222.\241;/\371"
+	.ascii	"\302\206F\201\023<\177d\261\333\240e+\223\356Ed\236\242\272\312"
+	.ascii	"8m\315\342\337i\231&qDS`\207\007\330hd\307a\356\360\246$\fYj"
+	.ascii	"Ce\257\313M\202\245\344\261\256:\250\246v\350\330M&h\304\226"
+	.ascii	"M\236\215\262\377G\227\323\016\204\005z\357btf\323\230\261\244"
+	.ascii	"\n\304]\002A\311_\"b\207#\036\344\360\205;\254\232\365\031?\213"
+	.ascii	" \r\323ke7/A-\234\362\233y\247l\313?\300\236\227\365\264\025"
+	.ascii	"\314\372\374\002\214\220!\226O\346&\265\036\361\t\256\300?yT"
+	.ascii	"\245\n~\270\261\210i\006,\243\301\214f\242\036\030\215\366\241"
+	.ascii	"=\365\026\344g\307%\261.\226\305\205\227\035@\026z\200{\245\355"
+	.ascii	"b\007%\250\006\037X$\374'\024\242\353\354'\210\2550\327)\205"
+	.ascii	"P>e|,\211\037\177\274X\201\211\350\021\374'2F\362\371\365\230"
+	.ascii	"\350\260oa\030\373\241@"
+	.string	"\033H\305\300\360\332\220z8\364\250\005\277\211\224Z]\032\215`x\235\177\254\370#\311\267\375\354km7\017\257\206\377\006\003\307\236\215\356\021P\263\352\021\331]\373\3026\202t\306\004A\215\007\343cN\013\260>or\276\267S\346p\\\346\350\212\340y2\\\033\261q2\314\275s\210\346\332\227\351EJL\217J\227\344\342w_\360\351\213\314\372A\266\236\342\243\364:M\002J\325.\367\002\242w\\\357\202 \270%\364\312\362\313\313\226)\220\227\252~/\f\305\217\323\231\247\316e\210\263\302f\276l*N\2112\006]v\350\234\316\333=w\350#\261\n3>o\343&\325dO\273\346>\226\335\3516\253]\364G{:)\320s\223\021\245\300F\006\204\232\263\021\\\334\364\240!,\266R\321\273i\303[m)\033\303\274\2521{\251\210\357\344AjH\307\234\\\246P%\350\322\221I^\t>\311\340l\"\315\032\bS"
+	.ascii	"\b\201\277\251\347k"
+	.string	"6GQ\001\227\2702\307;$\253b\213?I\r\340=\027\304\200\340\334e\313R\231\370\365\350\025\225\013\344\005h'\313P"
+	.ascii	"\362J\036\370X\230\345\242\344\211\217-@eyA\2705|\346d\b\302"
+	.ascii	"\033\274\343O\356\006q!.\306M\017\363\b\210\267\342\222\261\203"
+	.ascii	"W?\317\275\202\231\371\341\201\220#3qx%\rW\223m\374JJ/\003J#"
+	.ascii	"\362}\017H\247\302\220\364\034\251\b\001\354\325\f\303\334\223"
+	.ascii	"I,\247\205x\334\251x$\246Z\277m@\242\220\372Tdr\001CXd\353\320"
+	.ascii	"\\\326\241HT\334\266]\003\321;\3153*\240\230K\335\377c.HS\340"
+	.ascii	"\277\315\305\212\020\242\361\221\201E\212&\025\327\035\260(j"
+	.ascii	"\311:\276\\\273\343*P\257\336\321F\\,\370T\271\325\026\r\344"
+	.ascii	"h1\234\017]B\337\026\364\317\236\315\245w\365W\324\007\3428\034"
+	.ascii	"\021\363\251\003\2536\205\005)\0211\253c\346\365\215U\247\036"
+	.ascii	"\203\333\246Q\325H\252M\006\260vV&\202\023\027\263\370\217`\220"
+	.ascii	"J\005\245\2574\301[-\341\226\035\370\356\257\363\247\f\307#`"
+	.ascii	"\356I&I\243P \320\357\023\007oo,\200\f\340U\266\007^\276}\336"
+	.ascii	"T\371\335U\344\336m~\305\313\311,\200r\273$\362\b\2007\346\310"
+	.ascii	"\035\224\326\331py\0257\333\334\362E\227\016\0262\346\321\342"
+	.ascii	"\261\275\306\261\0355XfC\025\306Pn\275\345\256\221\360\315\341"
+	.ascii	"\303\003\257\\\263\322\276\006(\261\24168\013x\f\rt\0020fB\245"
+	.ascii	"\321\330\307\246Y\030\354\347\363q'\200P\300\254v\210I(\023c"
+	.ascii	"4\217\177\032\313\2030\304\264z\2109\222L\207\342}k\237\354\332"
+	.ascii	"\360\030\304\203\245\005\254\253\177J\304\241*8\367\2511uc\272"
+	.ascii	"\245\226\202\032\305U\357j6r:\304\t\335kA^\263\210GQ\343F\341"
+	.ascii	"{\251\006\342\211\315H\366\343\003\232^\202\342s*d]\265{WeB\364"
+	.ascii	"\260\030'6\300o\367\242?\254Q\233\213\254\237\016tQ@\327\266"
+	.ascii	"\206\325\373\303\257\223\312m\376\257,FC\320\210\272\033\216"
+	.ascii	"\320\021\322H#\027\277\374cJ\364I\023s\250\354\243T\022\230\235"
+	.ascii	"\013\b\216\244xM\023ab\225\r\033\254\342[l@Ru#\345`\355\316\343"
+	.ascii	"`\356(\354\007\221\036\245\003o\325QKp\204\326\225[=\357\325"
+	.ascii	" \232Phf\034Y1\350\200\035\357 \264/\320\"F\372O$\276\300\311"
+	.ascii	"\353\240|G,\206\024\033\221\265\250nX\244\340%\270\221h\351~"
+	.ascii	"\303\036\326\332s\032]\272\202\206\026\257\271\255\030Ld%\020"
+	.ascii	"X\316\340\232,\325\241\024s\325&\022y\301]\332I\220\260L\345"
+	.ascii	"\256![yO\267|\362\326k\305\005P\356\261\206_\nr\334\013\367\033"
+	.ascii	"\034\207\353*6\200\033\263\013\240\031\031\t\224\343\372\334"
+	.ascii	"\t\tN8hF\274/\264\230\030\276\004\216\365\317\233\326Q%7\322"
+	.ascii	"lHN\323SX9\221\374;\354\3500\"o\345h)\232\367 \330\016$\337\312"
+	.ascii	"\302h\320\226y\003\240\204\320\312\320\020\n\241\221\323;"
+	.string	"/F\263\306\357L\0318G\3312\233\366\273\274.\344\035\245\b}\367\234#<\365\034\321\271E\034^0#\202Mk!$\274\212B\306\274x\203\277#\220\322\357\350\235H\002\267\337\201\007DN\270qt\271\246Z\310j\212 Y\221\002,\310\317)l\356\207z\376\351\325\":\252\375\232i\206\035\334\325H\336@\344*\274\237%c\251\"\212\306\020\2449\330\346\221S\"\330\226\205\356\226@h\205g\352\030\363\370\3209\201>\243\371\206\363A\003\034\254j\265\033\300\231[3\252/X\331h&zz]xx\256\327\365W&^T\256\201\327\f\036sh;\264\262;x\264\025\324;:U\301\333\027}|m\313,3\216`\271\214}D\376I\246\312\257 \234_\337\352\211\033\205\376\236\265\277\300\322|\203\275W,\371\367?\226\374\213;-\211\236\216\263\222\373/8\267$\352\254x\177\224a\217\231\253\026*\226\364F\350"
+	.string	"9\310q\371\236\024\212X\202"
+	.string	"!O\200\210\350\025\232\334\371\275/\030ye,\0024H\326\356\351o\f\216\204\343\3776@V\233\024$\027hN~\353\242\312\362\310\275 j\235\364\027\rf\003\034Tp\244c]Lnq:\177\250\221_j\270\347\n\003\2616\332\307lN'\367i\r\357V\332AdCz\226j\026\236o\357\200\024\007?\33409\341\275\021\270\016\021l\370\027\365\3265dqt\313\255t0q\302i\310r\361\013\034N\230\343+pC\005\220i,\305\r"
+	.string	"\256~C\332\001\030x\026\221\374\030\347\316\225\311@Nxg\252\373)\332\253\324\305\302\360<\254X\3205\fq\236\210f\363ry\270Y\321\337\365C\233\321\354\213DUd"
+	.string	"\212\250\373\t\373\332\001\3140\342\006J]\005\3061ZY\225\005& \356z\371\375n\361\n\374\263\275{p\2323\376\3030\351\201\034\342=\223&\245f\007\007\223\240?\264 \215\304\330\037a\343fxu\275v\354.,:\322\305\313\331\037\007z[\254\261\252\261\033\177\0225\350}\017T\227\237\r\021\376N\201\356\021\036\364r\327\037@\307\324\207p3\254\025"
+	.string	"\n\205A\241"
+	.ascii	"do(\004\027((W\253\305\237$\210\002\024\020}\210fV\261\034\316"
+	.ascii	"\2473\203\235\035\217^\205|[\307__\351$\347\331\333H\377>Pv\323"
+	.ascii	"N\026\203\206\351\250\257\t\206E\235Z\257(\271\334\360(v\214"
+	.ascii	"P\343\261\016\371\f\214xN\334\333\327\321\243\3432\002D\355\336"
+	.ascii	"e\250\255\327\327\026E\217\274s\210\271\275\311\214\021#\033"
+	.ascii	"\242<\035\325\357H\343\f\3117\002\245w\356\241\341\004\233\276"
+	.ascii	"-\373:\222\362b#\302~t\n$w\020\310\302\323?\246~\0073\205j\364"
+	.ascii	"\007l\342y\245A\353\235"
+	.string	"y\337R\212\377\334\036\026\3218\225U\247\003A`}\002\364\276\373e\331\346\345|\306\211\f\036\252\037F\316\375\235Z\216\215}\\\373\363\260=\316\250\267\017\350.\332~-\2717@o\217Y{\246=\355\341\206\256\3477\337\205\347\\\226\031\227\023a\275P\235\201G\253X5\222\r\341\253+\222\334\300\030\025\211o\005\017\035\222\005\230\374*c\354L\345CX4o]\377g\256)\300\357}\234\314\255\340\304\tj\036A\370\203\352\332\256.8\362\346y\372\342\275\200-\007^\275\264\313\313\244\3351\310\205p\274\210\326\334$_\333\227%N7#M\316z\374@\205_\252\333\274\353\216t\347\237H?6\313\t\031=\f\\\216\320WD>\217\365]J\367,?P\255+z\276r\345\344\343Q\271\367\201|\032P[\216\030\037C\202-\030s\235\274\006\234\f\303\317v|\267\247'k\3461\334\230?$\206\337\223\375\341\374"
+	.string	"\342\025\314=\343\214O\371^|\337\325\375\f\241s\303\353\0360\257\354\234P5\263\313\255\362\313\232\023\277 a\315\2442"
+	.string	"\344\035\313\007tO\344\356K\361\001\332)+\373<\b\215\352\365\200rW{\036\245\336\240\250\270\035\347\250\255\017\362l\306"
+	.ascii	"w\003g\257\020\347\037\233\234#27\335S\021\357\006\335\231\237"
+	.ascii	"\217\313?c\367\355'\232\360^\366\265\341\263K\264\003\357\303"
+	.ascii	"\355\352|l\2021r\213\216Ny\003y\312\024\330\016\352\326i\363"
+	.ascii	"D\377\034\227{\237A\213\032\016\210\230`\320_\256\377\205\265"
+	.ascii	"t\016b\273\230/\323\374e\367\204\265+\024\261z\261u\265\277\""
+	.ascii	"<\272\001"
+	.text
+	.section	.gnu.lto_.symtab.72b45c4435c3dfbd,"e",@progbits
+	.string	"frskyOsdInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"frskyOsdIsReady"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"frskyOsdUpdate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"frskyOsdBeginTransaction"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"frskyOsdCommitTransaction"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"frskyOsdFlushSendBuffer"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"frskyOsdReadFontCharacter"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"frskyOsdWriteFontCharacter"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"frskyOsdGetGridRows"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"frskyOsdGetGridCols"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"frskyOsdGetPixelWidth"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"frskyOsdGetPixelHeight"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"frskyOsdDrawStringInGrid"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"frskyOsdDrawCharInGrid"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"frskyOsdClearScreen"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"frskyOsdSetStrokeColor"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"frskyOsdSetFillColor"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"frskyOsdSetStrokeAndFillColor"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"frskyOsdSetColorInversion"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"frskyOsdSetPixel"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"frskyOsdSetPixelToStrokeColor"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"frskyOsdSetPixelToFillColor"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"frskyOsdSetStrokeWidth"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"frskyOsdSetLineOutlineType"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"frskyOsdSetLineOutlineColor"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"frskyOsdClipToRect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"frskyOsdClearRect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"frskyOsdResetDrawingState"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"frskyOsdDrawCharacter"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"frskyOsdDrawCharacterMask"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"frskyOsdDrawString"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"frskyOsdDrawStringMask"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"frskyOsdMoveToPoint"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"frskyOsdStrokeLineToPoint"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"frskyOsdStrokeTriangle"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"frskyOsdFillTriangle"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"frskyOsdFillStrokeTriangle"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"frskyOsdStrokeRect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"frskyOsdFillRect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"frskyOsdFillStrokeRect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"frskyOsdStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"frskyOsdFillEllipseInRect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"frskyOsdFillStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"frskyOsdCtmReset"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"frskyOsdCtmSet"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"frskyOsdCtmTranslate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"frskyOsdCtmScale"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"frskyOsdCtmRotate"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"frskyOsdContextPush"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"frskyOsdContextPop"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"uvarintEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.72b45c4435c3dfbd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
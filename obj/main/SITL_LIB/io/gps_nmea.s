@@ -0,0 +1,653 @@
+	.file	"gps_nmea.c"
+	.section	.gnu.lto_.profile.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\210\001\005\t"
+	.string	"\322\213-3`O\322\030\213]fN\273\"\364\275wA\221~\257\346\345\200(\372n]\362\302\030\220\0228$"
+	.string	"AF\030&\246\202\tid\023\262\311\336\204\354\275w\3322\013=\026\330\247V\206\020\026\016EE(|@\246\231q\0340\224vV2\020$\371\265\326\265\374\022\270\301\003\243\231K5>8$\244|\001Z\t\211\006\213\026:i\333V\365\345jX\257\024A\235P\361@\003\233\226\205(\023\016:20z\032\3129]\332\345syt@3\310\262\212\027\217\363u6\036N\034\205\3006(q\267\320\3608\234\2022\024)\027\355\275o\370\333\335\336-'2\202a\262\325^\0203 \300\202\252\252\016\223"
+	.ascii	"N\327`\207qAW\254a\320.\002,\301\005\250\025\300\223\003^\035"
+	.ascii	"6|\300\027\201\t\241\3676\021\357\267Cb\022\270f7\335\374X\233"
+	.ascii	"7<\"\354\204\342\022\270\337X\253\231\251\230(\017\243\r\241"
+	.ascii	"\326\356\016l\2520\367]\254\236\tn\306\350\f\310[\252b\356\274"
+	.ascii	"\346\026Np8\303\376B\r\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375 \233e\002"
+	.string	"\204\002\217"
+	.string	"\b"
+	.string	"\003"
+	.string	"\001\001\002"
+	.string	"\020"
+	.string	"\007\003\003\001\200\f\t\003\001\004\001\001\007\001\b\001\t\001\n\002\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\017"
+	.string	"\270"
+	.string	" @h\006\204&\200\030P"
+	.string	"*\002T\006\023\025`N\f \214\236\253iZ\003\f\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\262\tE'"
+	.string	"\3067\275H\240VN:\020\317\377?&\f\357a\331\230x\230\207z\"\037\312\237\236\256\343A\212!\240\347\304V\3270\256\375\303x!\344"
+	.string	"\377\323\335]\"o\t8\2747\261y\n\343$\334\343\n\202Q\254n?\203\250\356\337\226\354$S\233"
+	.string	"\256"
+	.string	"\253"
+	.ascii	"\023H\372%\312\b\250\304R\361\212\250#\203Q]&\032\370\242/\372"
+	.ascii	"d\212\260\021?5S\343\\Xk\245\341\364\324l\237\2243f\n%mo\346"
+	.ascii	"\355<\276\267\302Y\f)\003R`\321\026\336Z\265\326\030\027i\033"
+	.ascii	"\241\265m\204\244\355\027Q\264\3578w\216l\252\265\022\220\273"
+	.ascii	"^\035\311Uk\275\271\254\275\273\327\320\215\"\266\255E\367~\273"
+	.ascii	"\030GNSS\277\367Zk]\337\247p\241ZA\264\330\026$VY"
+	.string	"\013#\232i;\346{O\2414\314w\277\226^\013\222IY\213\243\00565\313R+\224 \274s\367QBbj\331Z%\034(\266\304H\372EURl\334Lm8\231\324\244\353,\006g\344\251\207Cm\254\236\3603\"#*\365\257\373OW\226\326\264\357MSVA\f\214\253\2579\031<2Voj\033w\277\372\242R\2446\352\244\020\037NALm92\210\306\020\242\373\330f\343\375G\005\f\256\251\315\346{\222\340\231\217i\352\223U\2022\2004\237\322\352S\236$\202!\025\266\026\253X}r8\034B\231\266\206Zk\217=@\300\327DBP@DR\356\203\t\363\235\255+i \353`\312\234\307\373`Bmpo\317`\007\265Z\374A\340\331\304$4\2522=vy\354\356\315\364\3554;\233\344\367f\263Tl\315\334\201\025E\333\253]\253\2259\206]\255\255\231\2369\315\3147\334\265\255\2312\337Y"
+	.string	";:\016xs$\240\332\3331L\355\355\027>\253\334-0o\347\221Z\231gX\333\300\316(\305\b\2232\227Yr$X\355T\310\322R\220hj\212#\217<!\221\301\354\266\032\207\207)(n\272u)n\311\t\2105\215\303\361\326\342h\261\367\037faG\3678\2568"
+	.ascii	"\320\nw\2707"
+	.string	"szu\376\302\t\2305\232\266\334E\342p\021D\b\262J\024\024\001\266\021\272\027\224\247\241\027\347\256d\354KiG$cI\300\226\335\305\304\226\374V\306\236\324*\202\232\2622\376\274\273'\232'\177fT\"\244\255\262\b\353\356 Vl\315\330\327\232\223dGT\316\276\264V\235\314!\"H\325m\2535\302\213\250\222~\226w\260\251\022\277\331{\320\207\032$\246\351\270t\354\235M[eq\231I9\203\354I\325\232V\335;$y\205\220\276\237;\035\253N\207HwB\032\325\335\247\351n\361\271o\235\030\366X[\355I\027>C)\026\261\362\344\013\246\"$\321\326\373\017\354K\212\350(H\232~/>}\255C?B8Yo\r\201\001\250\001I\247\310\b\tiR\220B\2411\321\004\304q\310\230\231\007\022\200tAJt\f\021i\322Bi\330?\003\360\231\237#\0216\\\005\3758\200\002h\223\022\205\330\b\253"
+	.string	"\351p\335\021S\213\320!\244\0372\323\036ac\223\200b\263tm\360\327RM\034\270\240N\031\3135\260\352\025\323\367\203\347\316f\243\0379$\223\255=\307 \t\341@\376\240\313\232\003\330\335\230W\241\327\023.c'[\270w[w\257E\026p\236\005\211\302\257Q\372\374\212\205\025&'\357*\363\340G|.i7\363]\270\323^\340\005\200\301R\340\206d^\030d\365\360\276\262k\306\032\001KI\272\210Z\245\217\271\2232\013;\203.\005\3421\023)\001\207p\304J\341\354\301<u\370\032\037\346\333\3640\250\221\224\241\302r\\v\371'\261\235fJ\347]V\314r\2501\250\225\3052\024+6!i"
+	.string	"\277\271\327\227i4\023$\232@\204\r\242\224S~q\312\242$\274dKe\332j\246NaG\236\023\276c\020T\365@h\354\255\257K\314\224\275\334;\257\304\205\366j\257\033\240\023\202~E\215\177 \336 \334\325O\337\340\234.\247\203t\235\223!H\320Ggs\321\231\030nKphIJ\304\"g\3344\355U75\343\022<\251\365\354\303\311|\362yT"
+	.ascii	"\035$\301avm/\233\340+\211\334\024\362\bq\264[\203,\023LQ\363"
+	.ascii	"\203U\206\311\n\213\354\370\201\025H5\f\252\t\357\006\321\r\267"
+	.ascii	"\343\r\202\331\0026\231\266\223\343\023\211QBc\361\377P\2227"
+	.ascii	"$|\230\"\023\fN\245\336^\206\223\210\021\213\232\0252\035dQ#"
+	.ascii	"\234\346\254\300\332<\216z?EG\305\200'\365\363q\313\225n\376"
+	.ascii	"\325/I\2370\215\234\"LH\020}\377\036\005\246j\365I\232\343\203"
+	.ascii	"*cS\202\215\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\031\001]\005"
+	.string	"\262G\026\036\240'\351\340\177t\375k\333\244\252j|\271"
+	.string	""
+	.string	"\214\372\r\374;a\337\261\244\221LZJ2\033\341J\327@\007l\016\207k\240\267\202\247\244\374\302\327\340'I\027\242gI\342\030h\025\232\320\335\207%\203\224A;D}\232y\032\347\352\240E\201\356r\235\313\353\240\"Sv \" p\"1\207=\234\020X\360=I\221a\301`\016\267b:/I\202\371=\b\220+\360\b#\t\320 \300\371f\034\205)\030\026\314"
+	.string	"\317f\251\253\tg\210\027\246\235c\240+\347\320\342^\272\222\277\t\3040\262\222"
+	.ascii	"\002\352\261DC+\312\020"
+	.text
+	.section	.gnu.lto_.pureconst.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\204\004\003\204\004\004\232\004\007\232\004\b\232"
+	.ascii	"\004\t\230\004\n\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"\345\007"
+	.string	"\022\315'+\200)I\007\233+V\360X\250\036\213\302\f\007\3044\302\020P\234\3118\326"
+	.ascii	"\004\n\035;>Q\024?-4\372h[\322\032\2212\00578@0,GL=\367$\317"
+	.ascii	"<\375r\215~\265\017\rP*6\236\b\212\t\0016S\3670%\321\224\241"
+	.ascii	"u3b8|\201\241\304Ih\304\250\341\360\207\361\302\341\321\032\241"
+	.ascii	"\221\303\227W9C\307\367As\255\345>h\272)W\260\317Xk\211\fj\246"
+	.ascii	"n\366\246\375\025\210\n\204\351w\034\304\354\373[\027\324l\213"
+	.ascii	"IN\320\364@\371|5Q\220@\332V\317\211' @B\345\334yWI\330\004\236"
+	.ascii	"0\362!\030\314O\025\243\0170\024N\222\bm# 8\223j@\033\242w\002"
+	.ascii	"\b$\260\227H\343\017\215X\210\3058\017\233l\244T+\327\210`\200"
+	.ascii	"o\003\320 x\035\354\326\b\366\240\005\244\021\257\371\264\225"
+	.ascii	"\334+Ad(\203\340Oo5\207\335\""
+	.text
+	.section	.gnu.lto_.lto.5c1030323d7ff2c5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nmeaTalkers.5.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375 \235e\003"
+	.string	"\364\004\220"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\004\005\001\006'\001\301\216\001\005\001?\202\210\200\020}{\274\001y\273\001\005\001\006\025\001\003\003\314\300\001y\277\002\002\316\304\001y\303\177\001'\001\320\307\001y\306 w3\310\0014\305\001\302\001\301\001\276\001\275\001"
+	.string	"\f"
+	.string	"o\b2\206\215&\004\006\201\200\0358\006\232"
+	.string	"\230\200\0358\246\242\032\301"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_nmeaSentences.11.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\215\b"
+	.string	"\024\rZ\001"
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\303\305\242\025\002\177}"
+	.string	"\005\001\006\035\001\021\005\001\006{\001\005\005\001\006(\001\301\246\235\002\005\001?\202\210\2000yw\277\001u\276\001s\275\001q\274\001o\274\001m\273\001\005\001\006\025\001\004\230\305\002ki\b\004\307\250\331\305\001u\304\001s\303\302\003\330\304\002kg\004\003\326\313\001u\312\311\001o\311\001m\310\002\230\304\002ec\n\002\303\232\311\321\001u\320\001s\317\316\001\330\377\001ea{\001(\001\301\216\325\001u\324\323(_3\326\0014\322\001\315\001\314\001\307\001\306\001\301\001\300\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/io/gps_nmea.c"
+	.string	"\034"
+	.string	"\027K\210\254\206\354a\204k\002C\320C\3138i\210\001;\240\035\020\f\214\007\262\2001E\\t0|\2401 \004\030\n2\003C"
+	.string	"b\300\016h\007\202\0251\036<!o)C\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_powersOf10.12.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375 \221u\003"
+	.string	"\364\004\204"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006(\001\200\255\342\004\005\001\006\025\001\007\300\204=\006\240\215\006\005\220\316"
+	.string	"\004\350\025\001\003\344\002\n\001?\202\210\200\300\001\1773\310\0014\307\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\r"
+	.string	"6E\300\275\236\303\264:G\225\th\027\310\200\273\240\r\220\033\363\006\231\255b"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_nmeaParserInit.13.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"M\007"
+	.string	"\302\01643pM3\006 \334\375\357\247\301_\376#x\243\003\017\266\200\177fuP}\275\343\b\320E7\031(&\235\365\347\356\177\247Q(\031\335\202\367\243\221\b\2212\245\323\312f\205M\315P\225\265\3418d\330\203\2744\222\243\2516233I\031\364\302\254)!\256kJ\214wG\217]\033P>\212X\321\b6\344\246L\n\206\261\215\220\200\346\nCL>\213\270\265\336\006\243F\353\350\377\033\273\326\037\033F\002'*\t#?FK\350\237T\302\201ik\330\332\303\037\232?\023\036\370;\021\222\337[(\302\305R=\027L\226.&\230,UkW\354yn\220\347\002\304\362_\306\rk\206Zm\020\007p\235\315\020\200\341\177!\327\311p\243\333\036\264\245\332v\004\b"
+	.ascii	"2\241s/\360q\341\025\314\273\004\320\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_nmeaFieldNumber.15.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\221\b\2151"
+	.ascii	"\252V\004\023F`\034R:?\300K\344\272[N\272m\"\331hU\272\313k\340"
+	.ascii	"\"y3r)\035\271d\223\001R\213\3133\303\307\201\024V\214ra\201"
+	.ascii	"\217\237\235^@\021\243>\251]\327\213\2074V\373\366\277\375_\362"
+	.ascii	"\t!r\247\035 \001\024\001\027\001E\327\352mk\202\242\375z\345"
+	.ascii	"j\315\257I\2656\236\255Z\032]\210\366\353\220z$ke\252u\233\364"
+	.ascii	"\324\336:8\256\033-\372\2125`\254f\214!Hh\376l\352E\267\252\f"
+	.ascii	"\223\244\034\235\021Tt\255\320t(\2371\276\224Oi\336\214\306\215"
+	.ascii	"\256\353u\267\305u\243F\230\250\375\212\243\377a\277\266G\262"
+	.ascii	"_\233\030\273y\024\211\333{\313\260\322\356\270\256\253\354#"
+	.ascii	"\237\336\330\314j\364\030\330\315'\221Gc\2218\024\006\201?_\333"
+	.ascii	"cW\265s\023\237\211Z\226\226\215'\221d\344\330\023,\037\325\f"
+	.ascii	"v\227W!\016\252CI6~m%y\221}\305\344"
+	.string	"\025\331Jr\342\307\236C\3620L\035\032{ve\341\330\323G\016\252}\246&w\351S\210Ja\nY\222 \031\330\273\360\265\005\344\277\002E\266\270\356\223>\271\n\214=\177\3446\003y\257\307Y\254\253\274\362\270\2526\350\242\333\361C\306\b\036P\353F\356\241\226\225:\344\272\356\337\236\235ZU9\367.\270\256\213s\226\326\326\361\3171\376\017\214q\023\306\275fP\354\327n\265\316\311E\225\247\027\340D\254K\367\213\t\264Pk\200\032A\243\263\312ypn\241&\320\271\355\352IU\236\342w\356c\365\301#\036\246D\373\366m\211\201b\366/'\200\324\270\256\325\2630V\272\334R\353\272VI^2,\205\324\204\321`\277\n\265\007\2607YP\252<\3058Z\225\373\305\370I\3229%\270\2750n3Fj3V\266\031\037\265\031\0331 Z\360\263_A\002\004\007\f<\372\017]\3131\001\241\233\375\003\324\214\203"
+	.string	"\334\3121\320\327\326\216\223\310\243\261H\374e<\ff,\ff\034\374e\f\374\3752\366\0053n\317v\334\013f\314\336\355x\005f\254\3762n_\306\271\315\370\017\200p\310\024\245q]\035\323=\356\230\025\216\311\255\374k?\333\257\345w{\334\032'\r\031\227\303a\f\3040\276\005\367\244o\20000\006~\315O;\226gy\333\3370\320\rJu}\024]\253\264).Z-Pw\257\236\276\254\327\fN\0136\251!\253\027\301\002\373_h\242\200\3073^\206Adc \262{\355\304\301bc\025X\354\265\235k\007A\365\200\t}\237b\217:\fZ\366-\027b\215\372\250\177\325\345k\243~\334U2%S\254>hL\370\372oO\266\3452l\316\330\202\375b\374;\022\033\331\316\277\275\210\355\207\240\261\332\373u\261\235\305v"
+	.string	"-\373\257\272\375\342\277\335\367d.\207\357@c\265E\366\361\301\213\215\240O\026f\347\3276\333\007:\267\271\352:\352\266U:X}~l\327\020S\273\032\253\312\323\233q\203\013\363\365\213\225rU\246\227b\221="
+	.string	"J\005\255\256\261\b\361\372\322\256\227^\006\030;\026_\212%\266\363^rv\253Pg\326@\377\332\211\337\353w\315\221\354\2006\320\021\302\344\330~qV\213\236\211\200\311\321\016\036\324\316\242\007u\020\364\b\332\032\2651\006\3611LI\370b\232f!\2043\330\257\231NV\234\240V\331\265_\325(J\034.\265\275\260\321E\260\335\271\b\332\035>]\006\021\370\356\001KW\341\264l\346\222\3052\312\211\251\327\256\030BE1\261`\302\340\364\304\024\265\244\304\314 C\251\311\310\\\246h\222rb\231K(\246\322\013\026/\035)-\233\234N@\275`\241|bR:1)5)\227\230P\312\243"
+	.ascii	"\370\351\305\222\251\214zzb*\201Q\252\267\027\306H  <\240v\316"
+	.ascii	"\234\335\360x\007\320N\214L6V\215I\341\245\307\35219\274\364"
+	.ascii	"?\355\334\2207\206\252\2530\200\306\230\303\345L\365\316\354"
+	.ascii	"\340\371i\214;<Oj\007J\2571\376\3607R+\\\035<>\250\3624,\331"
+	.ascii	"/V\320@*\227816d\277j\216T\006\235\246\271\262\221\206\255\354"
+	.ascii	"\303\221\030\366\233\210M;\216\f\024\034G\274\272\256\"QG\315"
+	.ascii	"\331\021\261\363du9\212\013Z\306\234\033\361\322'\3339\201\253"
+	.ascii	"\310\240;\0171A\033\333i\354\376\222\343\363vf46\203f\343\374"
+	.ascii	"S,P\023u\214%oW]\302\016\366\202\316t\220Z\330k\332\315<\331"
+	.ascii	"\301\376\326\222\025\273uA\343\244\330/^;A[\020\233^=\361\035"
+	.ascii	"\271\323\"\366{\024\200\261\250q(\304\020S\210\031\032\021\221"
+	.ascii	"(\2054\006`\002\031\262\262n\021\220\265d')H\n\313\030\210\004"
+	.ascii	"DnY\0306\221\210\307gsw\266>\021\"d\020\302\216\205$\361\216"
+	.ascii	"\226\236\266R\243:\265L)\342\374\302\270\340X0\242N\t\034\017"
+	.ascii	"\226\373\327V\202\256Dj>\320\227\233:N#\370\305x\017\nv\025L"
+	.ascii	"\331}\211:\fY\344\246\023\364\361#;\363\234\f\312p\260R$L\203"
+	.ascii	"'\240\035\022\347j\001\t\277\365\231r\b\325\334\fb\206\b\276"
+	.ascii	"~\374\232\360\0328\t\320\201\334\362\317\226#\n\312\002\367\253"
+	.ascii	"r\020\230\276\005\344l h\026#\362\350x_\360\344\362\343\321\200"
+	.ascii	"\032i@\r\227\024\236 \222X\376\352b\030\by\372\277^V\3219\316"
+	.ascii	"yO\007M&\334(\274y\243\216\001'\221t\272k\365\370\376)H\207\201"
+	.ascii	"^\345\301\315\007P\350j\311\371\211\356\327\017\215\021\213\200"
+	.ascii	"*\330\220i$\026*\025\251\245\275\3570\364\256\214\246Qo\310e"
+	.ascii	"N\270\f\351\236\360\006{\f\311\033P{\376\030:\347\346\226{\201"
+	.ascii	"L\020ad\304\030>\347\325L\b \253\332\364\374'9\363 \306XD\370"
+	.ascii	"\352\035\336/O\236\226\r\033\275\233_Bh7p\307t3d\363\334\307"
+	.ascii	"?\331\261\271\332,H[=\342\254\210\031e-H\375\344\273F\341\371"
+	.ascii	"\366)5"
+	.text
+	.section	.gnu.lto_nmeaFieldScaled.18.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\227\002\355\024"
+	.string	"\306h\213H\300TU:yc\013}L\r\204f\311\206\247\200([H\247\374\317\366\247\360\245\271u\375o\226\222\341\320\365\227\313\262\233\202\357\304\025\376\236\004"
+	.string	"\310\242\272-\354N,\r\207\361\020:a]\234\200-\332\326\b!dK\231Rt"
+	.string	"o"
+	.string	"{"
+	.string	"\240OF\251v\002\005\266\357\300\234d\342rh`\251\332\357}\205\355>\f\0070'\216\017\2409}\bl`<h\337h\333Oq\0256\307H\237\b\036I\327A\3273d\316\311Z=@xP^\025\036\334\020\2179(Wc|1\005\354\351\024\355x\267\2036\227$\236\315\027\305\233\221\2539\347\177W\032\036NUL\231sZw<\016wx\333\020l;\260\025HZd\373n\2729\366\345\\\034\333\352\022\253U\347\271S\367\375$\337\371QV\237\244\3324R\227D5IT\217\244z\224jqT\207\242\032\024\325RT\257\250V\251\276"
+	.string	"\024\020\016\0065\346\334Pdd\336"
+	.string	"\203J\234\347\367\271\3326\277\347?\227\334\342.l\367\251\215\267\232\007.<\f\315Y\203r\303t\236\227\361V3\302\320\335\f\315\351;\360Dz\244\225\233Z\335\221\273\031-\270\244%\360Cv\0323F{\035BA\342~\307-`#g\"\\q\257#\212\360\037L\270\027\"\324\223"
+	.string	"\356c\b\355\352\312\005w\344N\340\234\341@/\343\2343'\276\214\377L\220'q\320\024T\302\357\016\372*\333`D\220[\377\271\3069\347\002\335\021\212\037\235\336I\277\177\361\037\313\270#Y\033fA\277\363*\2677\243\366K\322\341\241#\222\t\264W\205\330\213,\\y\265\264\\\265\260\326\322\212\301\\\257\225\221\366\252\321Z.\241]&\255WL\246Rsaa\315`,\031\254\025c\271h5\226\311"
+	.ascii	"\317\\^4\326\205\331\214\306*\371\346\345\\\034\253T\255n\311"
+	.ascii	"\236\226\306\366iW2\213sM\316\371\001\345>\377\320\216\026I0"
+	.ascii	"\265\252\275J\323\226,x$\027$\265\246\335#\3279\347m7\307\261"
+	.ascii	"\260\264J\304\242\307\214\026\371/VZ\020\304O0 \260\"\221Cy\205"
+	.ascii	"\207>\242\302\373\265\272\335\351\215\245B\255\346\314W]n\017"
+	.ascii	"\341\344\356\361\267\212qw&C\b\226/\363v{\245\310\310h\031\205"
+	.ascii	"\004k5\276T\244+\237G\274\237\343\026I,\313-\020\346Hxv\030\365"
+	.ascii	"[\234\016\031r\345\007`\023\354n\254\206\255\324\305(\357~\256"
+	.ascii	"@\370\357\016\262A9>\2175\2068\275\265\246\f"
+	.text
+	.section	.gnu.lto_nmeaFieldCoordinate.19.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\036\002u\023"
+	.string	"6\346\204H\340\320(\035\353\004a\274pv\214\bU\2050\263\034v\034\r\372\351\244u\244\204\001\3061\240\215\345\301T\255\365\225\223\213\330\373\376\nmR{\221\024d\020\023Zr\277\222\023O\n \016\021\020q\317\366\255\021\2627\221;\245q"
+	.string	"h"
+	.string	"q"
+	.string	"-\"D\247{\320\035\225\017\026Te\211\0211\223\3409*\340\254\0054a\253)\2525W\340\323!(\245}\234\217\220=w\341\251Za\214R\324\2323`\020\360\3239\320\266\217\373\215\314+^\256\203K\311\366\301\306cTk\r?\036\200~z\367\240\237\033\363\225\313\025\377\272{G8\0277\227\331\345\347\240\326jys\311p\357m\017\260\375\300\2261\001\340\215cm\226K\376f\3713D4\356\314\316\315\344r\260\357\325\205q\307s\356\324wn\324s?\307\224>Mi\323\224.Mi\322\224\006?\351\357\223\246TzNioJ\357\224\226S\372"
+	.ascii	"8\214^,\230Q+\206\235\215J4\203B<\347\337\371}\276\266\314\327"
+	.ascii	"9\317u6\231\304{d\367I\001g-\020zd\212j\r#MM\356^\027R\001ke"
+	.ascii	"Q\340\253\370\n\t\336A|z\302\b\375\355\323\037Y\0024\202\350"
+	.ascii	"\376\304\277\235B\343\314\\\272\267\035\321H\256S\315=\340\001"
+	.ascii	"\207V\342\355\3240\344\301\220\251\007\241rwi\215\221\346?\377"
+	.ascii	"\312\375\r\016h\f\212\361\025\375\242V\312\030mjrg[\274n\005"
+	.ascii	"\326Z\021|I:-jphrg\223\374n!\372\022\327Y\b0\221\002\013\245"
+	.ascii	"Ec\242\b[\211\025\276\230x\202\3222a}01\006S\275\250KBT\"\253"
+	.ascii	"E\022{\255B\227I\3302Q\261\302\022X,\f\021`\327K\204\205'.\027"
+	.ascii	",4\345\352\275\2720\035\373A\333\232S\274Z7\210\334\347/\312"
+	.ascii	"\221;\237\266\303\264\245=\355\336\030_\032|ESk\332\211b\264"
+	.ascii	"\251\255(jK\313\200\305HC\332\335\324F\300\001\215/\340zK\332"
+	.ascii	"\035\n% \220\"\251:;\342\320F\004\256nL\246\260\277\0031\t\277"
+	.ascii	"\024B\302\360\202\361_S\270k\0059\016\337\022\334#\242\255\026"
+	.ascii	"wDs\236\032\361\207|\020\032\261\315\030\036\265\300\316\233"
+	.ascii	"8\365\306\254\341@M\240v)\266\344\203\316\033\333\300Q1_\347"
+	.ascii	"o\327\bRL\027%\003"
+	.text
+	.section	.gnu.lto_nmeaIdentify.20.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`G\007\205)"
+	.string	"\032J<\020Gp\\N:G2\240\026\271\222l\215\331\"\177D\213\350\003\022\363\313\371(A\200\246\f\217\337\204pQl\fz\232;\333\020[\261\006F]\020\351\326\320\347/\266L\227\317\343\321P\007U3\335\335\032!\204l\"w\222\001\360"
+	.string	"\336"
+	.string	"\365"
+	.string	"\023\320\333\236z\344\243\024O6\003\255q\205^\241R{s/r\301-\007\321\333\243\362\225\371P.V\374\221\306}\356\345\002\263\345^d\003VBo\031y \363\026\375\217y[dns\344\327=\275\306\250\246\314\335{\203\355e\255\217\313\227\310\363\331\305\377|=^\nDO\323\226]\213\374\032\377\225\2744,Z\316v\025\244\204`D\t\230\217\352+@$\013\310{u`B\262\202\234w\266\253\037?\323\252\351\243\200\034X*\330R\333q\266\253\255\022\310\314\0206h\351s[\242u\266\253\036\245\003\037gn7{\265\302\222\252'\030\217\233\247\027\034\034!Y=nK\nbM\212"
+	.ascii	"\261\246\312&+\373\322\303\262Q\313\263\202\331\025\210\325\251"
+	.ascii	"\302\342\361\006b\031\313\243{\357\313^@\311U\220Z\317\n\367"
+	.ascii	"^\256UXYg\2363?\211\23130\233Z\002\335r\334\350\216L&\263\211"
+	.ascii	"\2471\315\tM\346\023G\023\332d[\223\017M\346\246k\031\242\367"
+	.ascii	"\336\b\374,\305\343\212\337\333\221[>\r\363\366eG:\203fnNT\275"
+	.ascii	"cF\326\250\335\305\374\323\305UY\343\346bN\220t\2623\202S9#\035"
+	.ascii	"\370\361?2\272\225sQY\231\250\254<\324\253,\224V\026\300\253"
+	.ascii	"\034\304\253\fdV\016\220V\376\261\225\001\244\225}\322\312=i"
+	.ascii	"e\036[\031\230V\376\245\225}\266r\017\255\314C+\247\2662\372"
+	.ascii	"+\347\023\255l\236\225\355Y\2714+\267\255\\\313\312g\300cg\206"
+	.ascii	"B\331\275:\356\352\356\232EC\362+\277\225\237\354\247\362\222"
+	.ascii	"\371gGR=W\312k\216_\205o\306=+Jfi\310`@o\353\223/\343\236\224"
+	.ascii	"O)\236\212\214\243\250\236+E%&Iu\246\266\214\365\256\032q\374"
+	.ascii	"\340b\226eQ\037h+f\240~\003\324mUqx\303\333tX\372*2y\334\007"
+	.ascii	"\006ol\200\272\227\234\023v\fJ\232\255Y\244\016\320\304$\234"
+	.ascii	"\207\253\2211\340\355^\251\b\314\314\341p\037\214\276\356\225"
+	.ascii	"\222\220\346o J\016!\302|\225\b\3636@\337\354IK\334\320\035\333"
+	.ascii	"\307\231\033X\311?\355\323\b\272\266\001\350\237~[\034\200.\352"
+	.ascii	"_\373\364\031G\265\343j\347\351\236&J\0036O\013M9\303\006\330"
+	.ascii	"CqVZ=\276\376\265)\327k_\227mkkz}4\2614VZ\274F\352\332Fe\227"
+	.ascii	"\266\331\274\035\306N\373d\324\234D\237rVZ\266\315>\261\240\347"
+	.ascii	"4\263l\333\346\230\251:c\275\343\356\262_\273\273\304Be'\246"
+	.ascii	"x\034\301p'\321\207\"V\306J\213\353\350\240I\322\335\305d\276"
+	.ascii	"Q$\325HU;\314\\\342`\230\320\007,\236\242\003q\330\302\205\020"
+	.ascii	"\nM\321\2018\204\202\022\276 :\251\350\021\2071\210\302'\223"
+	.ascii	"\233\226\204\303\0270N\304xZ\021tb\021\204\301B\370\"\330D\214"
+	.ascii	"\021\\\032b\247\247!1\b\345\344"
+	.string	"D\f\366\220\367\315\305\025\242\332h\346\027\246\227\240\255\023\340\345\334\310^\3114\262\203\225\303\327]pn\324\t4\204\031+\253`\310\037^z\251Q\237D\315l\242\032\231~&s\250\211\372S[g\017\365\257\306\312P\331\t5sS\275C\271b\330\355\212O\036|=\375Nql\351\255N\250\177\306;>g\346\334\340u\027#h\001M,\212\335\316\f\002\032NW\034\033P\347s\026.d0_\225\301\274\025\320?{R\227:\272cMr\351PK\273\213\177F\013\223k\002\354\362\240F\221\204\223\023\006\365\313n@\016\235\260#\332]\fA\313Lj\353\244\331\352q^\336\356\272\222Y\324I\032\320\304\002\200\211\25014e\030\203\214\311L\020i\222dX\003\220\002\231)[=\021 \251U\322\224$)J\206\315BT\233\006\371\373\362\t%\267C!\351v\360.S\352\264\021\321D#\200\336E\006\314\262\374"
+	.string	"\230G\017\315n\361\2205,\006O6\327{\350\016\315N\354\3007\326O\335%\357\235A\310^\334w#c\n\r\022\320\217\344\237"
+	.ascii	"\300l\316\276\223\327\235R\312\"\013\326X\367W;3\252*\264j\241"
+	.ascii	"\242\030\007\361\274\266\343\305|o\325\374\355\323\330\262v\030"
+	.ascii	"\002=\324\037\204\312H\377Ft#\261%\2035\255\316\335\035\024`"
+	.ascii	"\215\202\225\356\307\374;\315z\254W\r]\25260bn)\236\230\377_"
+	.ascii	"\026ey|A\330\241\242\256\207\273\271\205\023\2356\323DL%r\246"
+	.ascii	"J\211&Q~\b/\212\b\201\217\354\027\257\217\026)\375\267x\326\306"
+	.ascii	"\251\244\342\220\267j16}\216\310K\252\274\231a\277.\005/\210"
+	.ascii	"\357t8@\223\302\025\373\261-\230\275\272\b#7\023lK\325=J\374"
+	.ascii	"\277\335\276\315O\r"
+	.text
+	.section	.gnu.lto_nmeaFieldEnd.21.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\370)\005\214"
+	.ascii	"\252\332\240/H \020[\031\016\237Y-\324G\022\027I\260\374\254"
+	.ascii	"\252c\204\375Fz\250UO\3043\235U\325\363\301\200F\264\261`q\f"
+	.ascii	"zsV5\233\200\231a\272\317\223\224\353l\211\256\230T.\007\275"
+	.ascii	"\034\201Q\314\310\037{\023\262\245L2\364\002\255\002\372\002"
+	.ascii	"_^\367\337\375y\277\336\317\367\367\375v~\032\376\300\237\317"
+	.ascii	"\017\350\017\364\037\376\205\316\353\371\353\207\373\321\356"
+	.ascii	"\307\320\277=f6\034=\206\034\306`"
+	.string	"\374\265\274\344u\331\013\315\037\305\304B{\304\303\375\r)\330\240!\241\027\022\021T8\206\310\256 \033\002\355\t\001\355k0\346\241\033\363\307\017\237}\237\300\275 \2244\206z\362\320\260\307cg\177'\217\035\340_\337\336\217oO'}\342\355\311\321\333\307\311\333\303\231\323\033#\367\031v\221[\302\335l\214\3006\277\333\343\261\271\232\327\355\355\322(\215\\\206\035b\241\017y5{6k\242\330\344I\274R\215\354\323,\022\315\347\214\234\016\211\352E\246\246\231C\264Ro$\201>\351X\302.\362F\344\343\026\271/\254\224\207\343RW0)\033\301-5\254+\\\213\033\227J=\357\336\314aP\376L\222\037\255+\226=7\353\n\347b\243\324\033\027\356\036\2167\252O:\336\270\312\335\301\303\271\255\351[\2239g\270\256+Ug)@\200\252\251\025PL\333\341(\334w\221\206\224_\271\225a\343\026\256\200\032\333\346\212"
+	.string	"\032\003\b0c\331\310\210a\005\243\352E"
+	.string	""
+	.string	"PM\271\220j\301bE\224\212\024(\240N\230(Ab\204\210\247\020 >851-yPJB:\352\300!iT\204$\032R\027\315\316-\335\246Y5\273&=\032\321f\345\236\250\314\353+\2672(\362\306-\261-\307x\341B\260-\233xJ\270\200\305\327X\374\266A\243\260-\245\360\025\001\210\206L\003\261\020\017\200\37087\260"
+	.string	"\207\237\361\257\303/\233%\266\245\032\313 \024c\220\017[\r\376a\030\203~~\270\252\317_\320\005 \350\307"
+	.ascii	"\b\0062\225 \036@\236\372\273\013\025\304\244\372\366\270E\037"
+	.ascii	"\035f\321\327\207\217W\314yT\2308*\360\332p\n\274;F\201Gh\307"
+	.ascii	"Pu?\021\246\315\204\025B%\254\264@\202\n\241\021)\026\233Y\f"
+	.ascii	"\027q\207,\006\224D\341\031~\242\013A%\n\b=\037\312xa\2472d\270"
+	.ascii	"\251\f\342\030f*\321f\366\345KR<\274\261\322\305\220q\341$\224"
+	.ascii	"\267\b\006\372\035\262.\350\025\234(Mx\271\205\221\332\314\264"
+	.ascii	"\374\250\203\033s`Z\341dZ\013Fh\321\343\2460\222\304\330K\210"
+	.ascii	"!\223\302Dg-\f=\356\30631U\313\027\315\227\357\\\335\227n\316"
+	.ascii	"7\315\337W\r\367\371\256I\004\224\206\326\004\0056k\324\300`"
+	.ascii	"\346\005&Jl\313%U\250\250\245\235"
+	.string	"\215\f\355\330iuz\026}\302\266t*\245\314c\b\266\245\023Y&\306F\224E\225\276'\311\2620\324\203\235+~\226\330\226NF\265\312\006\237\260]q\276\321\2520\303)\31120\264\350\006&\236\307\235\235eK\346\024k]\327\345f\231\331\267\201\357\036\277v\267\306.\224T+\354 \352g\357\bf9\314\016\242z\214]\226\275\240k\264,o\331A\364\017\255\263,\2731\0310\353\032\226\345\347\016\252?\327\361\306\345\346:\346\005\f\263\355\356\240\361\017m]\275^\205\233\353\n\026[\314\254]Xqw\r\3405(\030m\\A\357p\220\n~\006\245\\\307\252n\302R\210\251\200\300u9\201\373\004\2167V5\3739\325\210Zmd\177H\024[\341\330D\rb\020S\021\001\226\222@\225 \2654\265\217'\370\207\td&\313\261\237i\037\373^\344\372\024\3403.\016X\356\f\327\025,\306\356\026\341(\013p"
+	.ascii	"\273\033\263\256`3n\\~\302P\030@\327\001\b\216oJp\2741\355\253"
+	.ascii	"\267\245\200\315\216=\004\347\356p\352h\033\333iN\254\312\222"
+	.ascii	"\027\227\033\355+\256\331\303Td&ri/\030\373\311L\316\0260\031"
+	.ascii	"\267\021\254\256\321\276\304\331A\225\370E\357f\240\203\337\334"
+	.ascii	"\2427R\352\200\265\327\356qsf\2557\353\370\356@N\020\214o\330"
+	.ascii	"]\rxI\226\272\256k\214e\247Rm\207\312%\311\361\306\367\343~B"
+	.ascii	"\020\035\2313_\274\270\013\267<\272\366s\367\350\332Xv\275\274"
+	.ascii	"\013\227-Z\336\334~\367}\226\266'\226+\257\373\236-\2055+U\250"
+	.ascii	"\\\357\373)R\324\322\320~\026\005\312\023'f\357\373\276\214\254"
+	.ascii	"\t\nL\276\304\231\344}sL\t\3634|/\026\006\266D\362\376\353v\276"
+	.ascii	"\367Z\223\274J$oW\312\233\344\204\363\371r\231\200\344-!\345"
+	.ascii	"%\001\311\213\344H\312k$\311[\004\311K$\345\335\032\341\201\276"
+	.ascii	"C\204 y\203\244\274@\220\274\"\374H\362\206\220\344\365\221\362"
+	.ascii	"\202\220\362\366H\362~\200\344\325Jy=\340\361B\337\016v y9Hy"
+	.ascii	"\263\220\274\033\374\360\253#\345\305 \311{\001\222\267\202\224"
+	.ascii	"w\202\b\370\353\373@\003H\336\034)/\016$\357\r^\2776\236\367"
+	.ascii	"= \311\213\225\362^\275\356K#\311+#\345\265:\334\027\006\363"
+	.ascii	"V\375\314\377\"\345\245Ry\247\316\367u\221\362J=\360\333\"\345"
+	.ascii	"e\241\362\256"
+	.string	"Hy\243R^\025)o\212\"^\024*/T\021\357\t$\257\t$o\t$/\t\225wD\021\257\b$\357\023\2227\004\222\027\204\312\373\301\210\327I\345m*\342eRy\227R^\017)\257\222\312\233\244\362\"\251\274G*o\007\225\227\203\312\233D\362\032\251\274EC\274H\"^\242\003\372\016\r\361\252)o\232\362\036U^\243\312\213\362\372\355\224\227S\336\377\313\222\242\035\034\200\353\332d\021q\255c|\023\037\032Ds\342\207\206\312\033\024\027\210D?\227E\370@\342\t\364\367\264Ne\275\246\365\247I\030w\036\307\020\332\251\317\334\0252\337,yq\204TSy\341\024\037\"@x\241\032\227\nB\277\360\314\027\353\251\311I\243%\365\232\204M-\302\211\234:a/\234\363\364B0Ai(\312\263\245fj\316\343\367\245fr2\303\030\242\274\030@8\351\350m\322\321\2132\351\350w\361\220\326f\357\322\036\372\354"
+	.string	"}Pr\035N\375\334f>\253\217\330b\357\321Y\037t\217\276\342v\225i\262\0376\371\240i\211G\002\375\365\016\332y\304\245\035\375\033\022h\257\353\320\352\016<h\255\0372\361\240\217\310\324\317\304w\320<8\350\rzGVs\300\210\327\321\033\364\021\227\224l\364&\331\350E\221lt+I\351fV\362M\302n\245\026d'\307\003\225\234\270E#\302*\030\354"
+	.string	"R\352\347\016=\353\210\203\371\234\025\312\371\335\315\237\216\0304\216\376\005\215As\330\3211Z\026\267\353N\207)\255\\\317-\205\006S^9]\340\005}\275\2677VcPp!\251\237{\305w\024A\237\013\340\237\215u\362\362CX"
+	.ascii	"\007\217\032h\366\272j\bxgc\235\025\364\003mD(\3277AW\300\353"
+	.ascii	"*\237\275N\360\266\2673\213%\343\005\3040H\375|\324\361\201\216"
+	.ascii	"\240S\276/\200r\364\215n\240\331N\254\n\216\316\321\250\036S"
+	.ascii	"\361H\2166\372F\363\362(\241/\205bb\226\274\030@\035\033\263"
+	.ascii	"\243\244.\364\007\251\223\272\023\017\221z\b\315\236\016r\316"
+	.ascii	"\343\210\325\346\002\223\020s\020\026\207+\246\rW\315\314/\311"
+	.ascii	"#*\034\310\356\250\237\362\240p9\3479\251c\324aP)O\223Cw\350"
+	.ascii	"\036$"
+	.string	"F\350G\331E\345\320C+"
+	.string	"\222Y\374\313R\224w\036G\031=\345Y('\270R,\250\264\022#0\005\016T^\221r\273QF\017\275\341\3029M\220\375\\\256r\253n=r|xl\225O\326\303\245r\036\245\2322\313\236\213\362\355x\243U\363\330Q\\\241;<\363\365\366\305\"Jna\032\224]z.\212\303(U\3407\223\375d6\250\016X\333\371\215\rCF,p\035$\200J5\245\013I\251+\311\034o\344<M\302\2426\3523\025M0\177\365\216J\030\2241\360\233E\315d\006X'\254\275\226\257\374q\237\240\257\216\027'\252bl\260\220"
+	.string	"\233\033v\n\270\371q\3643\357\213\345\305\211\373\033\001\211\261\262"
+	.string	"\3372\235\244/`\32659\313{Hn`\32658\313z;h\274;\232a\371\315\016\032\353\366:\334-\343\355\2401\r\2076\313u;h\234K\252Y^c\344T\002f]\233[\246+B\224aY\016i\030\3032\334\016\242\204\366\210\314,\3030\304\007\314\272Ff\271\214\n\330\302\262\013;\210\016\246*,\007>\276\245\325C\253H\020\037\351\020#B\266z\030\267\264\210l\355\030r\\\036S;\264\200\004\311\"2\244\007\225\020\037TA|\354"
+	.string	"B\305c\213\b\325\224\323\n\031\242\265EUD\210\220-*$\334\327{\271\234\302\317\211_\\\\4D\300"
+	.string	"\254\263\365\242\005\234\255iP\265 [\007\356\241\321T\215\332M\321\301;\200\315"
+	.ascii	"<,[\372\\\3723l\0220\235\247\016\317\026\254\032wc\240\277\234"
+	.ascii	"\307\253\361\266\276\035\003lZ\372Y\336\372Z\352\356\274\025"
+	.ascii	"\220\245\357\366l\303\322\177\262\365\257"
+	.string	"\364\361j0@\303\034\300+\032\003\374\254\027\025\340g}@;\353d)\3715\t\237u\204\321R\375(|{\272\016\333\257\217\216\322\020\024=CA,z\267\253P\317\311\022\341\306\245\367\272\022\227\266k\261\345(\275\324u]c\334\250t@\263\200\321+\370\3440\025\t8s\372\253\301\220F\234\264\265~\n\375\275MB\327zyp\326>\3641\247\f0\343Tr\364\227\363qf\\J\037N\2163+\375)V\362\336p\251U:\305\033\b?E4\001\246\364\251\250II\353\253\235\365\321\372q\232\364<\307f\364sO\226C\313at\210.Y\344\374\342\304\231A\206\025\214/\351E\253\276\244]D-\333\215\213\216\252aNa\214%V~(@\351G\351\003n\222\276\276\343\263\203\002\343\305\315\026\350/\347\375^\234\254Og\201%O\372eO\370\3328\351\373U\225\365\315\232\220\241\320o\262\244\317\244\357\367\002"
+	.string	"\252{\365\242S^\230\311w\225a\255&\3138\310\316P\220\nf\323yi\025\206s\344\004p/"
+	.string	"\360,\337\354;\373z6\ta\243\271\035\271&\225\2133q\364\227\363x\\<\254\177\007G{9w\254/6f'\356J\372x\246.\326g\036,\354\313>\330\275\372_}<.Z\034\351eq\244\027]q\244[\244\030\3533Y-:\305\337\336\242\324\221\026$\364\373|m\022\224\375\265\377g\273\224\264\231\300\027\224,\242NP\240\277\316\325\316\367\2112\241/\250@{\375HWs%\351\256@2I\372}Vp\365\t%4\2226\201\204.\341H#\351\367\211J\361\243\027\305\217^\024\352G\017\r9\273\005${{{\232\204*~\244"
+	.string	"\322'4\322@\212\264\221\276\240\355\252\322+"
+	.ascii	"R\241\b\212\023#\334\350\257\017i\347\tO\b\351\327p\243\275\376"
+	.ascii	"\203H\017\331j\"\200\302l\365\t\241\206\364\bAZ\204\026\002\244"
+	.ascii	"\203\374h\021\372\204'P0i/P\215\242[\n\252GDq\222\346\034\247"
+	.ascii	"\314\304\211-&\372\004\322\243\216%\332D7\315\211\2251>\352H"
+	.ascii	"\242K\214h\022#\032*/\021\3159\357\260\204\210&\335\366\324\""
+	.ascii	"\232\3770\025\357\310\036u\f\321O\335\344'Vf\211\366\250#\210"
+	.ascii	"\016\321i\03611\001\203U\250\302P!\020\223\216\251\021\221\021"
+	.ascii	"\221$I\322\030B\f\020\n\003%\245\356:\022 d-\205\243\f!\204H"
+	.ascii	"Ff$)J\n\225\306B\340\311KbP\353\364j\256\030\201\301\365\025"
+	.ascii	"\251\310\274\333\200\2208T\324\262\340j;\034\200C\034:,\034\243"
+	.ascii	"\034O\021PM\245Y\351\245C\357\207\013\324q7\216v\340\034\253"
+	.ascii	">\213n\203\371\231\277q\201\341DV\303\022\314\315\357,\037i\315"
+	.ascii	"\331\037-lI\255\321?n\305\ni\207-,\033\326\360\326\222\245\303"
+	.ascii	"\215\347\201\206\252\235\206\257\b\301$0\005\203\221\260\347"
+	.ascii	"\022\330\237\tr&8\f(\034\311\274\347YS\334P \310tt"
+	.string	"\333@\374w\3208\"Xj\235\236\260t\230@\255g\272\3078\335q<\340\232X\232\210ECzqs6^\002\227\322\235Ot\234\003\234^\223\017\267\361\017\250d&?H\3442<Z\345b\215\274A\237\333\252Q\267\tG\302\232y\316~\017(q8\r\255\252\204\003\375\020\034c@\002\235N\317N\265\021z\373\351@\275\270\260\r\322[\007\375\213\2378B\326\021\214B\207\243\242\273B\346Y\336\023\\\230b'\\8\005\342\373cH\316\373}\374\224G0d\223)@~\266\254\306DI\226\360\205hXLa\246D|(\n\257X\201_:M\235|D\200b\302\f\335l:\302E\277\245\203\322\321\260t\304p\210Y\234)\333zOT\030\253a\n\303\f\240\376!\201\025\340\213p1\317\302\203L\253\246\365-Z\374<\256\005e@Y\215\b\350k\214\307\241\267zY\037\246F\256\251-}\234\n\007\301\262\300\025"
+	.string	"VU\322\241\033}\272/y\212B\243\2126\374\233aD\020\033\366\225\306j\007\234\262\333\301\257j\254(9<\215Ls\231H\312}\206\213\314\300/\213P;\251\003\002R\302\240\304 \226\002&\371\242l{B\325U\335f\236\273\272\340\333"
+	.ascii	"\323\204ca\337^L6\310cd\231\364 \027\2310\245\244i=\372_"
+	.string	"\375\304\326\177\261\316@-\260\321\371N\035\270\232D\261\202\317k\231\365\371\353\232\267aB\206\034\373\257]\333\362&k\266\350a\313[\006\202}\215\033E\222y\300E\226\035\314\n\346\0324\276\271B\263\341\013\342V\320\212\n\222{\256\303\b\372\363\276&Z\267\241\025\215\205\021\323\323\2640\3228\230\026\037\034\371P\365\360\332E\304\022\221\357\314Gu\362\006\030\rr\242s\317P\006\366\001\334\252\310\260\266\306\221I\305\267\3527\f\221\206\231w\367\203\246\377\026nn\245\027R@w\200\363\261|RbJ\253\354\266%h\316\325d\0321\f\0162,Cz\255\037^E\214\261\243S:%\2557\nR\034o\323\367\322\t_\336/8!T\\ E\265 \352\031\024\200\007\247\216\336\033\272=\324\252'U_\220\241\367\020\f0\363\210g\3567(\354\3555\214\353\022\253\307\243\376}\270\261\302\313\341\363\300D\206\001\214\205C"
+	.ascii	"W \202\023\021dW~\201\024\335\036\315)\233\375o\360\002:\260"
+	.ascii	"1\217\314\200\340\321HDk.\301\355.>\017\213$\334\036.\f\030+"
+	.ascii	"@\302~\270z4!\266$$\345\224\226\321 `\325\207\373\222l[\334\336"
+	.ascii	"\364\354\036\250\256\322x\020\207\002#3\030\214P\312\274k\210"
+	.ascii	"\321w8t3\335\253(5\327\377\033<l\216\321\257\334WY\334nD\302"
+	.ascii	"\322\234\305UL\246\263/xX\377J\343\367\323\242\375|\261 \312"
+	.ascii	"\177\235\301\250\341\374\331\002\0074"
+	.string	"\005\315\261\326p\n\223\334\241\305${\351\300\355\265{\007\350\314,\013'\020\223\257\304\370\277\035@\001\265\275\213\216'=\"\304!\302hC\205\0251\032<\001r\2356T\310\035\246i\002\302[&\021|\233\242\033\304d\026P\263\002\340\354\3709\\s\224\013\314\316\324\316#M\006q\201\025\343K\356\341=\374\346\017\334\334\316\240\276w?\261\207\023\341\267\200\246f3=?\017\301\357\231\371\202K\312?8zg\320}\313\027\177\362\025.\342\254\36464D\273\266(NBF\273\215\007\311I\304(\233\205\2430\2120\001\302I\210\236\236I>$\027H\017\262\243\371s\2105\202B\374\330\341\320i\233\311\377\0274,\t\020(\273\037@\375C\234\037\177\360\332\213P?wHi\340b\177\360aj\207\205\372q?\370\355\024\222+\360\233\270\243<\354"
+	.ascii	"\334\257u\376((\003\361\211\274\013gg\351p\001\016\004\322,\265"
+	.ascii	"%^/\347\360\351\333\345!&;\316\260m&\212\326\353i\030\307\311"
+	.ascii	"\343<\244\261\345\231(\221\226\344\272q \224\227\336\200rjA\324"
+	.ascii	"\367\361\243\222\225\216\365q\251\350T\f\212\303f[\013\267d\312"
+	.ascii	"V@\253a\375\222\213\036z\233=\353\264~Y\372\343\026\177RK}u\374"
+	.ascii	"\302\246\317h\363S\331\262oQ\355S\352'\332\036\\\023\306a\354"
+	.ascii	"e\363z\220\267i>\227\\\252~\246\304_N\331\240\361~\245\017\234"
+	.ascii	"\3565\241\212\330\257%\177V~\305\262eu\251\3016+\310\214W@\321"
+	.ascii	"\335 G\025O3(\351A\200{\332a\006\264\256\250\220\253`\225\335"
+	.ascii	"\235|\325\345\223\tT`l\247G\027\013D\362\031|3Zp|\372\265\277"
+	.ascii	"!J\205\023\370\265#/\245`W\311\236+!\243\264\202\2776l\371\377"
+	.ascii	"\355d\256{\243\364\265\313S\272\037\002"
+	.text
+	.section	.gnu.lto_nmeaFieldNext.22.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\360\003\345\027"
+	.string	"\326g\216J\300\020)\035[\250Im\216\271\366q\247\367t\252''=\366kT5\362"
+	.string	"\203\217\214\354\313\b\r\322x\024\304\243V\2477a\360}\242\036\377\224\267\246\263\242(\n\2011\333D\236`<\021r\210\300\254\366\325\366\t\331\233H)Sz"
+	.string	"j"
+	.string	"\177"
+	.string	"9IF\265\002\023\374@\271\363\300\375\240;\313\r@w\036\367?-p\247\222\035L\354\206\246j\255\262\346\260\270e\255J\222\316\261\031\367e\365`\226\025\242\241\006gW>47\\\312\240\301\031\013\324Z/0ia\351\256\325\233\341\371\352\311\254\320\206\370\320\340\360h\263=~,mpz\365bF\004\276\0276+\264L\241\247c&Gj\255g^\257f\337\332\377 \376\307\376\221\003\364\277\355\210\226\262\326*\362\025\321`\202\253\311\303\316\357\013\335\371\303\363\301\007$\225\343\342\017\204\341\326\371w\254\235\363\357o\367\203\371\036\314\2075\377\325|W\363;\230\337j>\213\371+\346\227\314'\231O\233?\233?2\277\231\317\314\337\001\033\004\234\272\361@\251\326\n\305\0345\306D\352i\375_\376\027h\203p\373{Y"
+	.ascii	"\265\006?\313\2520q\341\201\362\001\325\032\243\340h\221h\343"
+	.ascii	"\t\n]^\204\236R7\277"
+	.string	"\034Iv\021\211\245M6\031\302\306*\351\202RP\242\245)\213\202v\023\237p\374b;\366l\220\241\031\237\216\213\357\036{\253\204L\273\252\334\fnwIpX\333\023\335S\306\351\3477r\227\2005\361\242\226{\316`\3221\021\371t|D\\\312\320\305m\241\333%\301\0321L\365_\302\016\225\333M\244\201\343\267-\0016\332\3156[\2417\211\315h)*$\267\225\023Y\rE\246\2022K\221\231\330n\262\030\310k+4\233\214\245V\263\311Z\300\272c\355\234\217\344Z\307\362\350%X{t\013g|:\007\253\004\353I\274\371\t]`\024\361\242r\013~z\303\325\213*8tuG\277\032DX\266\253\005\bwU\255\356\200\260.f/-\222Z\315`\370[5\253\227\305\252\r\fw\207\n\312\250l\235\317hI\262+f\004z0\210<S\250q0%\rd\252HIIRPH\007`\002\231);\017\021"
+	.ascii	"E\311\314\314\314\024\224h\2171\362,d!O\025\351\210F,J\007\251"
+	.ascii	"|W]\252\332\341\205\232\203\020yI1v\305\306s\257\b\354z\031^"
+	.ascii	"\002k)&)\230r\254dl\204fqe/\250\205\023Y&\022\317\371`\377:\351"
+	.ascii	"\312\267\211(h\322.\226\224\220\211xo\314\007m_v\031$+_\322\203"
+	.ascii	"\200\005N\007\362\bL@\327I?\020\033R9\032\205M\f\ri!j\203\013"
+	.ascii	"va\345\370\345\362T\274\306\217\336,m\3377g]+k\363\372'3\253"
+	.ascii	"\003\322-\334\277k\213\354\030w\306\326\256\331\0066\033\373"
+	.ascii	"\346\234R.5"
+	.text
+	.section	.gnu.lto_nmeaParseControl.24.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`:\013\3756"
+	.string	"Z\\|\024BPdR\007S\363\313\321j#S\253\355\353\262\rSd\376u\033[,\0235|69E7H\306\263\213\202\"\373\305(*\b\001\355P@\210\200\306r\027W\026\205l2\316\005\3327\222\266\233\354\224R\n8\001!\001:\001?g\336\301<d\346\325\231\241&\354\35009\370\357}V\335\356\275N\214tgni\243\355\3504\035mt\257\030\235\333\275iN\314"
+	.string	"\330?N\0032\267\227\035\254\265\246\2159\205v^\3141{\367\246!\017\364\221\355\337\332Hl\377>Jk5\323\022"
+	.ascii	"\245c\022\322\221Q\221\261H$\032\n\203\300\226\375\255\357Z\334"
+	.ascii	"[\315D\254\313\022F\344\254\227V\003P\037{Z\256\031]\017\304"
+	.ascii	"\031\204\244\331\310\034\200\3220\210\234\2740\"d},:\225lW<i"
+	.ascii	"x(\013\322\352Q!\324\226kZY1\254\3459\351\262&\025?*z\0252\232"
+	.ascii	"R\326\224\342Ee\370\362\302\210Ti\343\352\3409\347\253\345\232"
+	.ascii	"c\353\321\316\223\272nc\342Eb\321\251Tk\004e\315%N4\224k\202"
+	.ascii	"\255\007\356\275]\326T\342\302`\222\262&\022\007\n\235_\335\256"
+	.ascii	"Q=\366\300Z\256yd%\"\304\304\303tv\331a\315'{\234\362FE\350T"
+	.ascii	"\376\257\223g\275\216\230\253v9\277\372W\2506'\232\242\263\307"
+	.ascii	"J\334rW\326\323v/'\227{\253\341\336\313\336\345$\322\034\240"
+	.ascii	"\231\273\0133\203`\0266\bM\224\336\307w\200\375=m\005fog\322"
+	.ascii	"\377R\003\244\317\357\241w\336u\033\260\206-?\304\335\357\366"
+	.ascii	"\266\365c}(\223\3508\024\t\330D\327Aa$\315\2314E\317\201\202"
+	.ascii	"&\252\242\343,\317\354\255\3507pg\242-\032nM3\273\3506\255\232"
+	.ascii	"\231(\277h5{\335U,3U\243\251\002\336{\245\270\317\224\210a\344"
+	.ascii	"SE\007\333\277\237\240\265\250^\322\253\334\207\f\220\220\177"
+	.ascii	"('\350\034l\322\037\321\302e:\247tB\314i\\\376P\346\376j\265"
+	.ascii	"\312\307/\306<t\2760t\266 t\256 t\236\032:S\020:K\t\235'\f\235"
+	.ascii	"%\b\235\243\204\316P\253s\204\326\031B\353\214l\235\237Zg\247"
+	.ascii	"\326\271\251\323\272\225:Lw\022;\037\265\316F\255sQ\353ll\235"
+	.ascii	"\213Agb\320\231hu\036\256\316\302\3269\btn\201\316,\320\371\327"
+	.ascii	":\257\255\363\267\316\235A\200 ;"
+	.string	"2\366\334;\244j\350\306\375\326\\a\346\346f\353\266\254&\303\255\236\272h\213a\316\342\036\323j8Z\f?\\\236=\034\314\303\016N\214\301\246\301F\2715\r\026\352\243\276\227O\250\357\266^\333P\327\230}|\272\247\215\002\216\037>?\305\244\327\002s 9\n\214\335{\247Z\2157\270\027\007\251\376II\001C~\204g\3070\373 \374\217*\005\235\246\221\017\341\333mIu\371\344:\236Q\r\021\215]\305\"\037\306\224\216\322\t\255\360%\362?\017\357L\372\364\312*\"\037\247o\372\247\243@L#I\357\364\354\314>5N\341In\372VkW\"Do\356\213\224\210\312/\236=\007\200\320\370\206\017e+\266\375&\233\322\261\377\373\366K\310\376J\207\370{\026uk\3145\\^}\323S\375#\354\320\205\216A5\252\207\346;\006\365P\243.\350hV\207\357x\207\t\027t\360`\013^\033s\r\370!\200^"
+	.string	"Wz\346\020\"\274\273\270\030\007P\234\362\267x}?G>]\177\222^\345\246&\300\376\257\377\201\230F\270\274\312v\377?\2639\002\240D\321\3226\r\330\202\326y:\300\234\270-?\324K?d\205\3309n:O\243\207{\017\337\001\357\335\352g7\001\266\177\354]7\b\031\226\333\3446\220c\346\273\356g\3770,\203\252\261\252\262\260^\\\261L\365\364\242\252\206\r\027YW1\220V3\2206f\274\250\201\244\302\312B>1\261\325U\025\026\362\206\225\025\026r\230\226\354\027\343\246\243\266\324l\035\314\"G\252\344\255\305\366\264\203N\330\364\255\334Z\354\321\321\373s\255\367\336\313d\302\241(\030#\341b(\240\004\342\223&\225\226_cKF_\374\016\233\322q\n\0173z\242\231^\023\274== ]\332"
+	.ascii	"xh3\211\321\251Q"
+	.string	"z\036\331z\201\231]T\317\237S\261\343C\271\321\340\220,|\333A\223\032Q\bJA{\032%\374\205\367\032\324E\2175\235+z0\245\316c\374\242o\273\345\223\253\203'1\376\017\016\357LZ\374#\306\365\255\353O\362\213\027\236\350\211\337\314\257\341\023\375R\236\265\371\215\025\376\360\333@KC\301\027~3\373\222\036\274\3107[?0\273\343k\245\232>o\222*\274\005)\025\376\212\2127\005\206\216\r\351\241\354\315\236b2\365X\324=\313\247\2058+uGRO\341\233\214\324_Q\251\313'W\201\260!xF\277\246\301Nx\036h\023\036\213\352\206\341$\277\304)\212z\t\177\202\232\206\331\227t\262\313\013\200\332\250a$E\0254\250fDDA\222$i\f\200\002\021\261*\326\001\021\3600\346\230\252\222\202\024$I\0077\352\307#\244N:G\\\007qzW\022CQ\376h\276\332\256r\237\311@\225\036\223"
+	.string	"\310 [u\224cr\334\217R8\"Lp\304\273b\023|\342.B\364\017n\266\275\007\177\347\"\207`\340rDKx\0232\306\005\022\351#\326LL\264=,\032t\273\3771\232\304\177\343\202\030\235\335s\277\375*\3028\347(\210P\036;o\334<2}y\200<\315Hm\201\325\02681\322b@\202\235\253\311\3134i\363\3414\276\221\035\234\376\373\274,\224\224\027m\364L\037\277l\364\270\230e\377\261\372z){\341\314\250\337\357\276\353\001\235V\372$\r\226\315\242d\032\272Wl\017\202\312y\352\220R\206}\333drA\037\236S\346m\350\215\033\215\005\265\030Gp+\304\306B\036\225y\376\004q\005i#\264\251\211\021\336\350[B\352\255\026m\366\233"
+	.string	""
+	.ascii	"\261g\341\316\246\226\362\333\002~.,,\223\3651S\362\217\254\345"
+	.ascii	"\222\245G\352\220\332\314\315M\363\222\360Z\275\350\232PMa\270"
+	.ascii	"\227\b/\013\372\220[6jq\311}\225\363\252!\220fr\262\023\b\t-"
+	.ascii	"\250\022\f\031I\227\263\322&\3768In\205\360\304V\021\242\"\307"
+	.ascii	"1?i\364F2\232\031\025\374\305C&\326\006\355\360d\237=%\350\303"
+	.ascii	"\211\b\355\307\261R\222\034\026\264\246&4\334\f\251 \263\204"
+	.ascii	"\253G\022\024\345\233,\242\005\303\273pcY\235*0\303\263\317|"
+	.ascii	"a\227\240\223H\036j\260\342\226\361\023z\267D?\256\032M'\324"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\365\007"
+	.string	"D\013\306\001"
+	.string	""
+	.string	""
+	.string	"\002\017\177#\252\333\3426\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006\022\177$\200\200\200\200\004\005\f%\200\204\001"
+	.string	""
+	.string	"\003\002\023\177&\002\024\177'\340\310\355\371\001\005(\005\013)\025\177*\026\177+\r\177,\272\200\202\002\030\177-\371\377\377\377\003\005\006.\005\007/\b0\t1\n2\001\031\1773\377\037"
+	.string	""
+	.string	"\200\200\200\003\001\200\004\001B\003\003\"\003\007\004\240\276\320\347"
+	.string	"\001b\003\007\001\237\262\357\005\001\242\016\003\007\003\017\202\026\342kn\242s\202w\342z\003\t\020$\003\n\007\264\247\246\033\001\302\n\003\n\b\342\n\003\n\007\326\207\343\025\001\242\013"
+	.string	"\037"
+	.string	"-\241\31604 \030\020\004\204\265\224\026\024i\200\b\300\030 a\313\332\030\366\210\246\t\234\323"
+	.string	"c\2201\310\230\225\007\034\306\354\314"
+	.ascii	"\210\343L@z\2161\342z@\035Ip\0030\f\004\3570J\371=\207\317\354"
+	.ascii	"\034\003"
+	.text
+	.section	.gnu.lto_.refs.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375 G\275\001"
+	.string	"2\304\013\020po\341\374\377I!\234\036\306\335P\330\226v\n\212L\327\024VM\207\031|\2746.V/\311L\227\251\2224I\"\004\034\211\025\355Ym\002\001"
+	.ascii	"\022\224%"
+	.text
+	.section	.gnu.lto_.decls.5c1030323d7ff2c5,"e",@progbits
+	.string	"(\265/\375`\235$}\241"
+	.ascii	"\332\377\3247O \320BJ\007\006M\360;\3758\252\2046\266\007c\261"
+	.ascii	"\354: z\202\355\375\217q\035x\nF\302A)x\361\253\277\335\r#F-"
+	.ascii	"\306\033'\314\304\317C\201R\335\245\315\260\371\220U\252\356"
+	.ascii	"Y\256\373\257\373/\357l\202\207ZQy;\366\2262\005\340\002\203"
+	.ascii	"\003\205\003.\256\3309T\357\355\262S\336\273|\006?\322\217\201"
+	.ascii	"\213\316j+v\036\020uo\027\221\004\344\326\314\004\241\273wy$"
+	.ascii	"\201\004\2762%\\\304"
+	.string	"\360\354\373\016}\317A\337p\320\256Bz\367@\301Cj-\257\363\003&aU\332\326n\203\276\337\320\267\033\372>C\333\210\226\342\346\303\364\324%b%c\210J\264\2409z\017\303{GA\337H\260h\242\317\270\274L\237\\\035\"\316$\350\033\f}w\241o-\224\363\260\036n\256`\2733\035\273\335\247\270\274\313f\362\304\231Y\333\267\025z^\301\253ww\274\202\367.\242\315z\320\263=\321\223a7(\3175?\231\316y\216\347\004\031y\316\336[d^`\210y\001\2370N\212f<{\216C\317o\350\335\254\241\1776\321\323\225\241\347(h\303q\n\036\005\214\202\247\202Q\360\326p\334\020\\\222\266%H\326tq\032_R\315Z\225+\224\317\360\0337\031\315\317ex\355vK\3622\357]\n\325\"\0204km\317,xD\314\202w\336\201Z66\242'\002\275\020-\262\201\036%\241*\\@Y\210\200^"
+	.string	"\003\205\301)xl\306Ln\"\300]\216\201\213W\342\226{\345\336%\221\320\036*{\364\264\375\005\350\177.G\021w]|\b=#\300\343;F\200\367F\371r\n^\021\234\223S\360~\306\302W\020\250G\252\344u\336\2734\"Z\002\251\nk\373%\247\340\241\214\202\347\342g\022\244\214\360\363\0136\001\306"
+	.string	"\255@#\360w\n-\377U\374u\252\203\243\370\253\360g\243\237S\374\374\300\317\002\374\314\300\317\013\374\254\300\317\006\374\234\300\317\b\374|\364\363"
+	.string	"?C\360\363\001\004\374\334\300\317*\3628\300H\272\350\347\025^M\3643\b\034\260\223\036\372\271\003\006\242\205\376\366\335\204\277:\265O\333\256\335\"|\360?\004\276\203\200\367\334\201\277\352@\303\fI\002\370k\f`O\360\026\333}\311\270"
+	.string	"\177%\341g\032~\226\341\347\031<\320\363s\t?\327\375\214\302\377\025"
+	.ascii	"0\335\f\004\374u\203\237\347\330\371\341g\260\377\374\327\261"
+	.ascii	":t~\026\342\347!~&\342\347 ~\276?\027\361\263\021\377\341\346"
+	.ascii	"\376\033\375\325\207\237\221\370\331\306\317\300\237\225\377"
+	.ascii	"\337\376\373\3745\375Y\314\317n?\177\3719\355g\263\237\255\374"
+	.ascii	"L\345g)?\223\375\374\344g\261\237\223\374\034\366s\362g\256\377"
+	.ascii	"v?\367~\216\340\177\334\3774?\377~\346\377\317\237m\370\231\352"
+	.ascii	"\347\024~>\340\177\227\237s\374\274\343g\035\377g\374|\374y\352"
+	.ascii	"g\251\237\215?7\375\274\364\263\322\317=\374\314\303\317I?\347"
+	.ascii	"\3603\016?\337\360\363\n?\253\360\263\214\377W\376k\360\377\314"
+	.ascii	"\377\240\273\273\273\273\337\347\200\337:\371\r`\006\312+\037"
+	.ascii	"t\332\326\252\256T\265\307k\325\227\265J\001;\242\25542Ox<\270"
+	.ascii	"\206\200\020\243\2504\353\016\262\023\242p1\241\243\2274\301"
+	.ascii	"\242j\353\245oM\223\"j\246\244\344L\021\231K \251%\305\253jD"
+	.ascii	"5\006]\3311g\247\355\253\361\357g\317\325\250\240\237-&I\020"
+	.ascii	"\333\326\342\016RR\244TA\355\222<\355Z\316\353Yg\211\022\017"
+	.ascii	"\035&O\273\246\353<0\244\220>\036QM\236\350=}\327z*\261^n\266"
+	.ascii	"]\337y\343i'~\264\264k;J\030\f\0323qCy\352\352\016,v\326\332"
+	.ascii	"\006YY1I\266\275\017\024\224\227\234\202w\344\323\205\336\307"
+	.ascii	"\007z\237)\3646\017\332[\322\225Az\317\261ax\254\236\310\211"
+	.ascii	"\323\313\272\261\257\216\323\004\220\025\035\232\231\266L8{L"
+	.ascii	"\272\242\204\264A\335\264\334\326\323\r\327\233\206\303\315v"
+	.ascii	"\323m\234GDrI=6\t\364\266m\211\025\250\321-\355\212\022h\330"
+	.ascii	"\304\351\300\002\302vD\231 ^kx\215\217\231\231*E\270V\223'\356"
+	.ascii	"\252\355[M\247\351b'\3575\242G2[\316\264\355~Cz\243I\300K\230"
+	.ascii	"\266\266\275\367\0310\034\207,\212\322\f\013\241:\271\250)e\232"
+	.ascii	"LQ\032\022f\3331F\252\336\236h{\313D\317W\324\330\251\201\333"
+	.ascii	"\022\tL\267\361\034q\316\001766ct_\214l)\301\264\227.\026\257"
+	.ascii	"`\270)\331\214\321\205i1\355\326Ip\263\301\364\332\233\215\307"
+	.ascii	"\370\322\270\310\325\375\330\333\"h\220\315Bo\251\320\333(\364"
+	.ascii	"\325\016\372w\032\317\365\254\210\001s\242\235Y\311:\322dy\305"
+	.ascii	"\327\246\207\354G;\273\360\334\234HMi\333\\\326\262\013\005\254"
+	.ascii	"\rz^c+{\232\365\225^\366\224\336\322\\\272\254\253\264\225\246"
+	.ascii	"\322X:KKi-\334lf7y;i\2612f\037\321Q\352R\351k\232\251y\371\222"
+	.ascii	"\345\331LzI\325\202\\!\312\311\363\f\355\354\n\034\263I\213:"
+	.ascii	"\342\331\006\006\013\031&\233a5hfS\266\244\271\bcE\351\226\304"
+	.ascii	"\025\245\230*\312,LVs6\223\333\364\022\342O\224\030O\210\031"
+	.ascii	"'\\\002\366\035\205\2654\031\017\367\252\371\274\262\270\342"
+	.ascii	"\3326\224\036{\223\365\223\333d\032$\357-6\031\221\335\275E\""
+	.ascii	"\346\005\230\027\260U\300\216@\343\331\327"
+	.string	"8\264\225Ho$x{\352x8\333\022\211A{pv\365\f}e\242J\206\350\266t`QA\317c\242\272X\265 \321.fT\317+\306>\016\031\227\367\252\007\306c\253\214\216\253\251:\b\026\020\230\222\273\243\217:\224v\356lm\225My\003\307K\251\204\033v2\234\326\255l\222l\225MA\322\321G\206s^\013\266c\253l\n\023M\260\263\007\326\265UF\327\\}\2738d,\272F\260*\345\225\272\242k\214\322R\256\335\361\023u\311\206N\231\365x\216\251\303\316!b\321\215b\303u\244\277\032\254\223\255\325C:\254\267\272\253\2054\221\366\352$\215\244\213\264\021n6W\3638/\301r\267\313{\215\214\307\tv\326\245\262\327\005L\3103\255\271x\017?1T\\^d\317\314j\253\214\216\343\374\274\344b9<7D\\^+\036\330\220\2552\t\216$\220@\002 8{\340H1`\337A\032\b\017w"
+	.ascii	"\240!M\260\255i\373\343\210\325\360h\335\266\257J\332Gcq\263"
+	.ascii	"\263\032\311\313{\037P\2140\245lA_\001\272\005\310\325U\333\n"
+	.ascii	"\347q\306\342P\315\265\255o\036&H\253\r\035\0227i\300\330D\265"
+	.ascii	"\255KT9n\376Lm\363!0Sgg\254\240/\202\177\206W\343^\331\374>\037"
+	.ascii	"\230.#_P\320\277\256\371}=49.T\f=\212\004}}\343\232\246Y\323"
+	.ascii	"\3247\026sP!h}ktj\305\020\02305u]\307{\260`\035\333\276\236\371"
+	.ascii	"k\231j\206\235?+Scm\371\310)xFK\244W2?_\236V\254\222\340*F\314"
+	.ascii	"\233\272\347\212\240\"aTv\332\270\2725\253[m;*\272F\2633\312"
+	.ascii	"8\264\266u\257\314\212\336q\204\371\004\005.\037n\225\315\331"
+	.ascii	"\203r\327\203\216\032\327/_\352\331Q\321\275`^\224i\313\025\266"
+	.ascii	"\313\t\220\266\266\257g\\\323\2325\255\236U\030RzO\320z\326="
+	.ascii	"$+\332\007\230d\261\353x \242\264\353j\373\352\374k\027\306\303"
+	.ascii	"N\036\210\2320\202\246\246\355\017\243\340U"
+	.string	".H\257M c\026\232X[\037\243\340a\301R\315\270\202\266j\245\307\221L\226W\263\272\305l\314\235:m\253\026\267-h^?\352\262\226\325&^\244T\201\322d-\347M\fX\333\367\254X\251b pI\362\274ZZ,*\020\303\025u\207\n\225*\206\336\213d\002M\331F\212\224*\346\342*\31133\306\315:V\311"
+	.string	"@\312\300f\317S\n\351\245L\230\232RY\237d9@\366\254H\fiI\253\253\263t\252q\225EY.YR\305\272\013\222,O'\257b\275d\030-M\206\226\264m1\242\t\023_\035$_j1,Q\207\006\312\221#5\211\217\216\212;H^\223\3240\316\345V\025R\203\224ify\241g*\\\277\270Y\277j\230\357x/\326\007mp\310\254\t*Xw\223\354\315\222\266Kf"
+	.string	"ZRzd\021!R\223"
+	.string	"({hSB\236^\257\311>\376\bQS\246\244m\355\002\"\336)\236\021}\265\252\310\327\253_U.\276\267x\307(\265\220,\376\272\365\312u9A\367"
+	.ascii	"\036\034 T\262\264\255@\252\020\016S\342\211\035!ZTXgz\232K\237"
+	.ascii	"/\2619J\202t\023t\t-<A\332V\254\372\343\205\0327\266\376Q\263"
+	.ascii	"\212\230I!\216\021\002\363C\314\027\037\275\026\224\304\035\022"
+	.ascii	":\332\376\016;\377\373|\300\3604\261f\007\355\237w\213\310{/"
+	.ascii	"\226\317\362\"\243\202x\354\303\314\342\027\342z{\353\177\003"
+	.ascii	"\232\226\227\230\246\211\035\024\312Z\221\253\355\375\341\356"
+	.ascii	"5~\021G\370\2722~\00592\277.\321(F"
+	.string	"4B\336/\342\221y\257\3215\032\211&$\257\321\221y\257\256\021qW|\227_\304kL^\243k\274E\025G\343\327\325\221Y\2742:2\277\256.\363\353\026]c\021\251\303x\221F\227\3715w\231\311\253\242#3yud~q1\223\243\034\272+4M\300\250\360\334\321x{T\r)\"\213\340\216\313\344us/;\245.\222\201{\207$\221n\212A\230-\n\256G\224Z1\311\004TE\201%\257\021\3568\226\274w,\312\306\255\322\200\270\204\273J\030\216\0306\344RI\335[@\325\275D\276p\367^\342\275\267\207\034\262\274w\253\350\250\254\252\272W\353\250\352\016!\266I\335\333N8lWG&X\022\251\255\311T\336\251%\221\225\327\315\027\022e\022\265\\\252:h\303$\030\303 \220\227#M!\206\320S:\034\246,\020\251P\344\273\r\013j\004\201OCa\213t\t\212I)\bl\361$\204j!"
+	.string	"\023\023T0\350\024\354\r\223\322 \200B\336\017NO6\206N\301\036\215_\312d\207\251\260)m\342\2210C\006J\364\033\311\230\241\206\240\013\035\255a\206\f\024?"
+	.string	"FE?\032\243\005\031\206\204\200~\370?$\310\220!\364\241=\236\217\255\315\377I\223\206LP\302T\006#&\247\247a\320)F\321\020\030Tah\230#uAh)xB\220PH\b\004\004\r\3400\230.\251\220\016\177A\340\322\223\223S\f\024\027 \321xA\370\224\376\340t\343g)e\372)\315@A\t\370\224\006\323\032\3505xQ\301\013\0309z\207\321\301\005\035\\\300;\214\016\220\220:x\201\204\376\005R\035\ny\001\f\237~\303\031@\303_z#}\n\032\n\223P"
+	.ascii	"`\t\330\303\240+\2458\200\303_\2154\210\366\320"
+	.string	"\004\345B\215\024\r:\001\207J\277'\032C\303\247\237\r%\373\224\322\240\001U\2020\351)\025>\375`\370\r\207\267A\300\235n\244O-\206NNO-\200\234\202JU\230\224\016\201LL\351\3607\203h\t\210Chq\b[\230\364\033\376L\370\3711\2415\202NL\276^S\214t\tj\b\0342\375~\322&\340\320\016\2230\310`\370[\2627\234\226l\330\2454\275!\364\031&\275@BS\341\023\224S\214\245 \224\323S\215\240\341oF\023T\220\007\304\020\310\364\203\212!\007\220\306O\272\344\324B\016 \215\036\223\223S\tI>K@\246\037\016\237&(\027\322\032?\2410m\001\2070\350\207\024XCP\005\034Bt\030\204r\212\201C\330\263\2414\374=)\t{i\322\214\241T)\230\016\203\251\020M\223f\bzJ}`\372\ry\351\3607\024\372\370\344H\227\202*\334\200rz\222\361\203\306XJq"
+	.string	"S\245\364\251H8\004\326"
+	.ascii	"\232\320\004%\364A)\265\24144\3745=9\321\340\r\223`\f\203@\250"
+	.ascii	"\336\221\220b\250\240\301\005\031\250\222\005\277\264)\230$\274"
+	.ascii	"Q\243\205\023\260E\020\370kj\241\364$la\301\221\215a\215`\312"
+	.ascii	"\302\022S\n\244\001t\233\324 \351e\213\334&\257M\0225\0245\037"
+	.ascii	"{x6\210\rb\211\314\201\200\005N\353\226\210\035\342#\366\004"
+	.ascii	"\313\252\255\025b\267\270yd\271\342\242z\fA\202\026q\357\370"
+	.ascii	"\210\267\205ba\331\037>\342E\002E\235\331*\243\263Y\267?\314"
+	.ascii	"\346\300\031kk}\370\250\320\337^%\361\t#\323\342\205L\276Q\026"
+	.ascii	"\217\326J\fN\024\343mkyX\036\266\n\200\233\344Au[E\346|\363A"
+	.ascii	"\304\316N\331)\253\003\203\2334\222\347i\217\267:\212\250\227"
+	.ascii	"\231\030-\224\t\2642\245\220|\261FT2#sl\202\264]\n\205\311\221"
+	.ascii	"\253b\243\352\0236#]a\332\332\313wwv\227\350\310\264EK\274\275"
+	.ascii	"\277D<P\201Q\361\354r\t\304\326u\226\265'\314\207\f\254\210\327"
+	.ascii	"\023\\ra\342\250U\273\252\307\013\236\313\245\317\204\320\356"
+	.ascii	"\336\034\351\245Z\bhD5m\361\340\251t|\221*\302\260e\261\370\253"
+	.ascii	"\023\257t\354\024aH\327q\315\235\347\020"
+	.string	"\\\226;%v\316z_\274\270m\325i\373\341\002G\317\033\235\372\326\343\214\007\230\266\207{U\002\256>\253\\\020\222\270\345Z\365\326\312\034\031\243\273G-\026B\3175\3167&^\237\257s0p\3618\350\224(r\305\266U\316k\034-4`\236M\3248\277\357'\203\024\250\202\3718\310\262L!33\"2\223$\351b\n\020\006Ca\232)\346\035\022@$A\2212\347\314\310\210\210\244 %E\251\fc?\316V\001\355\026\351\3775\201R)\331\220\233?W: \242Vdy%\233|\335\250cg\\\341]\001\336\251\240\022\t\024RD\272\\p=\037\327\025\321\3165{\362\3511\307\321\254\217\253\242\007\245N\256\312[8I\347\251\205>i\233O#\260\002\207\340\223\032\031x\212]\033o\231\346cb\236\330\235|\206\327N\231\212O\341B#\202\250\256\231vhI\016\202`\240\037\372\202\320\b\033\022\216\300"
+	.string	"h\207U\273\013\320L\204\234\270\030D\373\\\212\3051\035\255\222v{J\363\340\363lJ\333\241\013\2200\232V\315\222\274\323\316\311\201A\023(\203\230j7xT\027\330\030\245\\I\234\024\036\343;Z\003b/X\203\t\347\225U\336\337jf\227&cu\360\307\204*\350\001\370gl\336T\342O\255@\223gp@CC\3704l\337\242\355\t\323\206o\n\230G\304\352N\242\355w\250A\2774Q%\035Zq\352'-\260\270TF{\302\271\363\3121\215\313\024'\006b\370\363x\001\016Z\225mYl9\025\315\360\202\301Wr\036\315\221\262!\210\026\3246>\327\345x\325\016$\bt|.\231\261\212De\311\203'\340\016\025\334d\f\235\317\263\337\337\206\003b\2504\240\262W\263\243\242X\250\2720bj\t\336\t\035\271\351\261HO\225\336"
+	.ascii	"\375\f\024*\345\214"
+	.string	"j\271\031\220\243\222\235Mj\306\243\003\217/\213\360\351\340D#;\326e\311?\0034\361F\223\360\037\265\357\031\035\251\350#"
+	.string	"0\027\332\344=\372\237O\325\204.~pH\235&\n\374\247\376\270o\272\rAY?\262C\251#\336\034'\r\261\350\330\201+q+\237\350\313l\034Y\314\317\025\237\306T\210m\013^\032s,{\233\336\354\235B\331\227\206\272\335\217\310`\325D\305R\304b1\341\233RC}\003.\216\221Y_zc\026\210(\247\243|\343\212Od\266\246I\237\271\207\251B\210\256\343\357@\326\222\200\343\267\220v\221\004i\221s4\261R\250\032U\027\331j\240\206,IQ\3668|e>\307\302\020\274\204\336\001\301"
+	.ascii	"\344\201B\204\f\244@\\\257d%\366\260\210\331\237C\326\253\373"
+	.ascii	"+C>0\017\251\021\204\331\252\371\200\363\023\372\f\fW\264G#\024"
+	.ascii	"**\332\312\206\001\316 K\005$\352%'\301d\242\b\217~\365)\214"
+	.ascii	"\364\n\342\323\214z\320\321X\326\273\357\204,]\320.\034H"
+	.string	"\343R2K\342\263\240\206\342x\316kK\265z@\2137\225\270\313\202\223\376\3334J#\257[\254{\341\245\204\023ip\326\353\rk\375\001\030a\300^m@\353G/@i\247\256\270P\225\255\206\342r,5\t\340\037\230V\025\002\255}(\"\345\"\357\022?t\317\236\300negtg\243\366\273<'\352\\s\333\353\350\231\033\220k\302\207\303~\261e\365\\\275\032\234!\255BS\253\374\206J0\007\020;\322\243\301\367>\002?\207\211`\323\322\213\336\266\027\036%\313\245\260s$\303\265\032%\331\207\270\236\252\272\244T\210J:\352\251\303|\214\235n\344\003\314\377\345S\256\r+6\226\330$\236\177\323\202Q\242\327\017(\004\221\027\305\323'\212>\304A'\376\316\354\314\357\336L\257E\355;\022\271\f\372\t$\034&!\232\232\206Q\266\"\200b\377\370\032\004\301>\006\205\253\024\245\247\363*D\002\323\257ViC"
+	.string	"\324\033\251\322\033\360\254\216\036\007\322\017QC:\253\013v\360\b\225\027 \331\354P\240\271EBK*\200\245\234\037\320Z_\344\327#\201\t\355\236\206\037AyN|?\200&U\027\016\243\242Wh\025\314[\3471\266*\253Jp!\214x9\002a*"
+	.string	"\324\341\207\306\023\0328\013\016I\221\361L\036\353\177\346\367Nw@\337\222\356\203\300Bz58\236\347\325\246\317x\027\264\347\207\265"
+	.string	"\314\207\3336I\370\361s-[\237Z\207\336\260\274\301'\272 +\006+\311\375\204$\n_\005\f\264FN\362O\232\363\327\206\243YA*\234\237XR)>\253\223\374\330\264\323|\r\216du\266`*\270\271\245\372\\\274t\235\034M\310\362o-^^{\274\303\0034\205\230\212\355\t=\3348\277i\026\200w\256\241\361\2024gg\333\375\024\326\226P\203\213KD\002\361;\341\322-\316\311\276\301\234\350U\252"
+	.string	"\220"
+	.string	"\221\002Xrx\306\3521\030\035\240\340\231\214\270\027\206\300\030\t\241V\354bu\305aAs\363\301@\2633\177\313\376\252\371\234\230"
+	.string	"T\337=,\223\275\240\216G\267\272K\362\320$,[\244]\352j\202\323\354\315\221X5\224\221\201R~2\300\240\246Rr\334Y\037!\266I\250x$D\264\003f\032%f`*Ve\304\243\237B\237\321\374\f\tiV\022\371,^\332\247C\303\322\274\303\366<c^"
+	.ascii	"x\300\234\242\257\2362\335\240_\201x\273\002\334\241\302\326"
+	.ascii	"N\343k\237's\365\326\212\236R\344\274\360o\377&\373`\333P\230"
+	.ascii	"\311\223\267\316\234\366\026\371\340\340\307j\305\340\216\334"
+	.ascii	"\343=\343V\366o\332\314=\353F\334C\320\257\330\213\200\341`\263"
+	.ascii	"t.'\212\236\261\336\331\223\360\300\304Xe\026g\0042\254\370C"
+	.ascii	"\353\323oE\372\252\371\315yC\330?\243O\230\376`\277~1\206\255"
+	.ascii	"\r]/x\016|\271\2448\310\356\313o\305\331\037\341\351\334\021"
+	.ascii	"\342%\300/\342{\311\215\331\031\307\036Q\277\306C\n\234\327\220"
+	.ascii	"S\377\217\263BI\034\3320~Gz/8>\251C\354\344\362g\365b\316\235"
+	.ascii	"\346\251y\233lH\207\036\337\216%J9\365\371;\246d])\306/\305J"
+	.ascii	"\357Mu3\360\336\315\303\302\310~\314x\315\211\276\331\017\317"
+	.ascii	"\213\370\317\246\334\215\031f\273\370|s\252\362|M\032f,o\350"
+	.ascii	"D[\365\310\007\266\002"
+	.text
+	.section	.gnu.lto_.symtab.5c1030323d7ff2c5,"e",@progbits
+	.string	"nmeaParserInit"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"nmeaParseControl"
+	.string	""
+	.string	""
+	.ascii	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5c1030323d7ff2c5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.ascii	"'-fno-"
+	.string	"openmp' '-fno-openacc' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-Werror' '-fPIC' '-fvisibility=hidden' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits